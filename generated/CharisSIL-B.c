@@ -0,0 +1,6220 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_CharisSIL_B_cff_size = 133729;
+asm(".section .rodata");
+asm(".global fz_font_CharisSIL_B_cff");
+asm(".type fz_font_CharisSIL_B_cff STT_OBJECT");
+asm(".size fz_font_CharisSIL_B_cff, 133729");
+asm(".balign 64");
+asm("fz_font_CharisSIL_B_cff:");
+asm(".incbin \"resources/fonts/sil/CharisSIL-B.cff\"");
+#else
+const int fz_font_CharisSIL_B_cff_size = 133729;
+const char fz_font_CharisSIL_B_cff[] = {
+1,0,4,3,0,1,1,1,15,67,104,97,114,105,115,83,73,76,45,66,111,108,100,0,1,1,
+1,92,248,16,0,28,8,197,1,28,8,198,2,28,8,199,3,248,20,4,251,242,12,3,247,
+12,12,4,28,250,61,254,216,28,24,0,28,10,40,5,30,160,0,72,130,128,152,143,
+139,139,30,160,0,72,130,128,152,143,139,139,12,7,29,0,75,109,153,13,29,0,
+0,139,20,15,29,0,0,139,49,16,29,0,0,139,51,17,187,29,0,1,211,142,18,7,65,
+2,0,1,0,9,0,17,0,26,0,38,0,49,0,58,0,65,0,67,0,75,0,80,0,87,0,98,0,103,0,
+110,0,117,0,124,0,131,0,138,0,145,0,152,0,159,0,166,0,173,0,180,0,187,0,194,
+0,201,0,207,0,214,0,221,0,228,0,235,0,242,0,249,1,0,1,7,1,14,1,21,1,28,1,
+35,1,45,1,52,1,59,1,66,1,73,1,80,1,87,1,94,1,101,1,108,1,115,1,122,1,129,
+1,136,1,143,1,150,1,157,1,164,1,171,1,178,1,185,1,192,1,199,1,206,1,213,1,
+220,1,227,1,232,1,239,1,246,1,253,2,4,2,11,2,18,2,25,2,32,2,39,2,46,2,52,
+2,59,2,66,2,73,2,80,2,87,2,94,2,101,2,108,2,115,2,122,2,129,2,136,2,146,2,
+153,2,160,2,167,2,174,2,181,2,188,2,195,2,202,2,209,2,216,2,223,2,230,2,237,
+2,244,2,251,3,2,3,9,3,16,3,23,3,30,3,37,3,44,3,51,3,58,3,65,3,72,3,79,3,86,
+3,93,3,100,3,107,3,114,3,121,3,128,3,135,3,142,3,149,3,156,3,163,3,170,3,
+177,3,184,3,191,3,198,3,205,3,212,3,219,3,226,3,233,3,240,3,247,3,254,4,5,
+4,12,4,19,4,26,4,33,4,40,4,47,4,51,4,58,4,65,4,72,4,79,4,86,4,93,4,100,4,
+106,4,117,4,123,4,133,4,140,4,147,4,154,4,161,4,168,4,175,4,182,4,189,4,196,
+4,203,4,210,4,217,4,224,4,231,4,238,4,245,4,252,5,3,5,10,5,17,5,24,5,31,5,
+37,5,48,5,54,5,64,5,71,5,78,5,85,5,92,5,99,5,103,5,110,5,117,5,124,5,131,
+5,138,5,145,5,152,5,159,5,166,5,173,5,180,5,187,5,194,5,201,5,208,5,215,5,
+222,5,229,5,236,5,243,5,250,6,1,6,7,6,14,6,20,6,24,6,31,6,38,6,45,6,52,6,
+59,6,66,6,73,6,80,6,87,6,94,6,101,6,108,6,115,6,122,6,129,6,134,6,141,6,148,
+6,155,6,162,6,169,6,175,6,182,6,189,6,196,6,203,6,210,6,216,6,223,6,230,6,
+237,6,244,6,251,7,2,7,9,7,16,7,23,7,30,7,37,7,44,7,51,7,58,7,65,7,72,7,79,
+7,86,7,93,7,100,7,107,7,114,7,121,7,128,7,135,7,142,7,149,7,156,7,163,7,169,
+7,176,7,182,7,189,7,196,7,203,7,210,7,217,7,227,7,234,7,241,7,248,7,255,8,
+6,8,13,8,20,8,27,8,34,8,41,8,48,8,55,8,62,8,69,8,76,8,83,8,90,8,97,8,104,
+8,111,8,118,8,125,8,132,8,139,8,146,8,153,8,160,8,167,8,174,8,181,8,188,8,
+195,8,202,8,209,8,216,8,223,8,230,8,237,8,244,8,251,9,2,9,9,9,16,9,23,9,30,
+9,37,9,44,9,51,9,58,9,64,9,71,9,77,9,84,9,91,9,98,9,105,9,112,9,122,9,129,
+9,136,9,143,9,150,9,157,9,164,9,171,9,178,9,185,9,192,9,199,9,206,9,217,9,
+224,9,231,9,238,9,245,9,252,10,3,10,10,10,17,10,24,10,31,10,38,10,45,10,52,
+10,59,10,66,10,73,10,80,10,87,10,94,10,99,10,106,10,113,10,120,10,127,10,
+134,10,141,10,148,10,155,10,162,10,169,10,176,10,181,10,188,10,195,10,202,
+10,209,10,214,10,221,10,228,10,235,10,242,10,249,11,0,11,7,11,14,11,25,11,
+31,11,37,11,44,11,54,11,66,11,73,11,80,11,87,11,94,11,101,11,108,11,115,11,
+122,11,129,11,136,11,143,11,150,11,157,11,168,11,174,11,180,11,187,11,197,
+11,209,11,216,11,223,11,230,11,237,11,244,11,251,12,2,12,9,12,16,12,23,12,
+30,12,37,12,48,12,55,12,62,12,69,12,76,12,83,12,90,12,97,12,104,12,108,12,
+115,12,122,12,129,12,136,12,143,12,150,12,157,12,164,12,171,12,178,12,185,
+12,192,12,199,12,206,12,213,12,220,12,227,12,234,12,241,12,248,12,255,13,
+6,13,13,13,20,13,27,13,34,13,41,13,48,13,55,13,62,13,69,13,76,13,83,13,90,
+13,97,13,104,13,111,13,122,13,129,13,136,13,143,13,150,13,157,13,164,13,168,
+13,175,13,182,13,189,13,196,13,203,13,210,13,217,13,224,13,231,13,238,13,
+245,13,252,14,3,14,10,14,17,14,24,14,31,14,38,14,45,14,52,14,59,14,66,14,
+73,14,80,14,87,14,94,14,96,14,103,14,110,14,117,14,124,14,131,14,138,14,145,
+14,151,14,158,14,164,14,171,14,178,14,185,14,192,14,199,14,206,14,213,14,
+220,14,227,14,234,14,241,14,248,14,250,15,1,15,8,15,15,15,22,15,29,15,36,
+15,43,15,50,15,57,15,64,15,71,15,78,15,85,15,92,15,99,15,106,15,113,15,119,
+15,126,15,132,15,139,15,146,15,153,15,163,15,170,15,177,15,184,15,191,15,
+198,15,205,15,212,15,219,15,221,15,228,15,235,15,242,15,249,16,0,16,7,16,
+14,16,21,16,28,16,35,16,46,16,53,16,60,16,67,16,74,16,81,16,88,16,95,16,102,
+16,109,16,116,16,123,16,130,16,137,16,144,16,151,16,158,16,165,16,172,16,
+179,16,186,16,193,16,200,16,211,16,218,16,225,16,232,16,239,16,246,16,253,
+17,4,17,11,17,18,17,25,17,32,17,39,17,46,17,53,17,60,17,67,17,74,17,81,17,
+88,17,95,17,107,17,114,17,121,17,128,17,135,17,142,17,149,17,156,17,163,17,
+175,17,182,17,189,17,196,17,203,17,210,17,217,17,224,17,231,17,238,17,245,
+17,252,18,3,18,10,18,17,18,24,18,31,18,38,18,45,18,57,18,64,18,71,18,78,18,
+85,18,92,18,99,18,106,18,113,18,120,18,127,18,134,18,141,18,148,18,155,18,
+162,18,169,18,176,18,183,18,190,18,197,18,204,18,211,18,218,18,224,18,231,
+18,238,18,245,18,252,19,8,19,12,19,18,19,25,19,32,19,39,19,46,19,53,19,60,
+19,67,19,74,19,81,19,88,19,95,19,102,19,109,19,116,19,123,19,130,19,137,19,
+144,19,151,19,158,19,165,19,172,19,179,19,183,19,190,19,197,19,204,19,211,
+19,217,19,224,19,231,19,238,19,245,20,1,20,5,20,11,20,18,20,25,20,32,20,39,
+20,46,20,53,20,60,20,67,20,74,20,81,20,88,20,95,20,102,20,109,20,116,20,123,
+20,130,20,137,20,144,20,151,20,158,20,165,20,172,20,179,20,186,20,193,20,
+200,20,207,20,214,20,221,20,228,20,235,20,242,20,249,21,0,21,7,21,14,21,21,
+21,28,21,35,21,42,21,49,21,56,21,63,21,70,21,77,21,84,21,90,21,97,21,103,
+21,110,21,117,21,124,21,131,21,143,21,150,21,157,21,164,21,171,21,178,21,
+185,21,188,21,195,21,202,21,209,21,216,21,223,21,230,21,237,21,244,21,251,
+22,2,22,9,22,16,22,23,22,30,22,37,22,44,22,50,22,57,22,63,22,70,22,77,22,
+84,22,91,22,103,22,110,22,117,22,124,22,131,22,138,22,145,22,148,22,155,22,
+162,22,169,22,176,22,183,22,190,22,197,22,204,22,211,22,218,22,225,22,232,
+22,239,22,246,23,3,23,10,23,17,23,24,23,31,23,38,23,45,23,52,23,58,23,65,
+23,72,23,79,23,86,23,93,23,100,23,107,23,114,23,121,23,128,23,135,23,142,
+23,149,23,156,23,163,23,170,23,177,23,184,23,191,23,198,23,203,23,210,23,
+217,23,224,23,235,23,243,23,250,24,1,24,6,24,13,24,20,24,27,24,34,24,41,24,
+46,24,53,24,60,24,67,24,74,24,81,24,88,24,95,24,102,24,109,24,116,24,123,
+24,130,24,137,24,144,24,151,24,164,24,171,24,178,24,185,24,192,24,199,24,
+206,24,213,24,219,24,226,24,233,24,240,24,247,24,254,25,5,25,12,25,19,25,
+26,25,33,25,40,25,47,25,54,25,61,25,68,25,75,25,82,25,89,25,94,25,101,25,
+108,25,119,25,126,25,133,25,138,25,145,25,152,25,159,25,166,25,173,25,180,
+25,187,25,194,25,201,25,208,25,215,25,222,25,229,25,236,25,243,25,250,26,
+1,26,8,26,15,26,22,26,29,26,36,26,43,26,50,26,57,26,64,26,71,26,78,26,85,
+26,92,26,99,26,106,26,109,26,116,26,123,26,130,26,137,26,140,26,147,26,154,
+26,161,26,168,26,175,26,182,26,189,26,196,26,203,26,210,26,217,26,224,26,
+231,26,238,26,245,26,252,27,3,27,10,27,17,27,23,27,30,27,37,27,44,27,51,27,
+58,27,65,27,72,27,79,27,86,27,93,27,100,27,107,27,114,27,121,27,128,27,135,
+27,142,27,149,27,156,27,163,27,169,27,176,27,183,27,189,27,196,27,203,27,
+210,27,217,27,229,27,236,27,243,27,250,28,1,28,8,28,15,28,22,28,29,28,36,
+28,43,28,50,28,57,28,64,28,71,28,78,28,85,28,92,28,99,28,106,28,113,28,120,
+28,127,28,134,28,141,28,147,28,154,28,161,28,167,28,174,28,181,28,188,28,
+195,28,207,28,214,28,221,28,228,28,235,28,242,28,249,29,0,29,7,29,14,29,21,
+29,28,29,35,29,42,29,49,29,56,29,63,29,70,29,77,29,84,29,91,29,98,29,105,
+29,112,29,119,29,125,29,132,29,143,29,150,29,157,29,164,29,171,29,178,29,
+186,29,193,29,200,29,207,29,214,29,221,29,228,29,235,29,242,29,249,30,0,30,
+7,30,14,30,21,30,28,30,35,30,41,30,48,30,59,30,66,30,73,30,80,30,87,30,94,
+30,102,30,109,30,116,30,123,30,130,30,137,30,144,30,151,30,158,30,165,30,
+172,30,179,30,186,30,193,30,200,30,206,30,213,30,220,30,227,30,231,30,238,
+30,245,30,252,31,3,31,10,31,17,31,24,31,31,31,38,31,45,31,52,31,59,31,66,
+31,73,31,80,31,87,31,94,31,101,31,108,31,115,31,121,31,128,31,135,31,142,
+31,149,31,156,31,163,31,170,31,174,31,181,31,188,31,195,31,202,31,209,31,
+216,31,223,31,230,31,237,31,244,31,251,32,2,32,9,32,16,32,23,32,36,32,43,
+32,50,32,56,32,63,32,69,32,76,32,83,32,90,32,97,32,104,32,111,32,118,32,123,
+32,130,32,137,32,144,32,151,32,158,32,165,32,172,32,179,32,186,32,191,32,
+198,32,205,32,212,32,219,32,226,32,233,32,240,32,247,32,254,33,5,33,12,33,
+19,33,26,33,33,33,40,33,47,33,54,33,61,33,74,33,81,33,88,33,94,33,101,33,
+107,33,114,33,121,33,128,33,135,33,142,33,149,33,156,33,161,33,168,33,175,
+33,182,33,189,33,196,33,203,33,210,33,217,33,222,33,229,33,236,33,243,33,
+250,34,1,34,8,34,15,34,22,34,29,34,36,34,43,34,50,34,57,34,64,34,71,34,78,
+34,85,34,92,34,99,34,106,34,113,34,120,34,127,34,134,34,141,34,148,34,155,
+34,162,34,169,34,176,34,183,34,188,34,195,34,202,34,209,34,216,34,223,34,
+230,34,237,34,244,34,251,35,2,35,9,35,16,35,23,35,30,35,37,35,44,35,51,35,
+57,35,63,35,74,35,83,35,90,35,97,35,104,35,111,35,118,35,125,35,130,35,137,
+35,144,35,151,35,158,35,164,35,170,35,181,35,190,35,197,35,204,35,211,35,
+218,35,225,35,232,35,239,35,246,35,253,36,4,36,11,36,18,36,25,36,32,36,39,
+36,46,36,53,36,56,36,63,36,70,36,77,36,84,36,91,36,98,36,105,36,112,36,119,
+36,126,36,133,36,140,36,147,36,154,36,160,36,171,36,178,36,185,36,192,36,
+199,36,206,36,213,36,220,36,227,36,234,36,241,36,248,36,255,37,6,37,13,37,
+20,37,26,37,33,37,40,37,47,37,54,37,61,37,68,37,75,37,82,37,89,37,95,37,106,
+37,113,37,120,37,127,37,134,37,141,37,148,37,155,37,162,37,169,37,176,37,
+183,37,190,37,197,37,204,37,211,37,218,37,225,37,232,37,239,37,246,37,249,
+38,0,38,7,38,13,38,20,38,30,38,37,38,44,38,51,38,58,38,65,38,72,38,79,38,
+86,38,93,38,100,38,107,38,114,38,121,38,128,38,134,38,141,38,151,38,158,38,
+165,38,172,38,179,38,186,38,193,38,200,38,207,38,214,38,221,38,228,38,235,
+38,242,38,249,39,0,39,7,39,14,39,21,39,28,39,35,39,42,39,49,39,56,39,63,39,
+70,39,77,39,84,39,91,39,98,39,105,39,112,39,119,39,126,39,133,39,140,39,147,
+39,154,39,161,39,168,39,175,39,182,39,189,39,196,39,203,39,210,39,217,39,
+224,39,231,39,238,39,245,39,252,40,3,40,10,40,17,40,24,40,31,40,38,40,45,
+40,52,40,59,40,66,40,73,40,80,40,87,40,94,40,101,40,108,40,115,40,122,40,
+129,40,136,40,143,40,150,40,157,40,164,40,171,40,178,40,185,40,192,40,199,
+40,206,40,213,40,220,40,227,40,234,40,241,40,248,40,255,41,6,41,15,41,22,
+41,29,41,36,41,43,41,50,41,57,41,70,41,77,41,84,41,91,41,98,41,105,41,112,
+41,119,41,128,41,135,41,142,41,149,41,156,41,163,41,170,41,177,41,184,41,
+191,41,198,41,205,41,212,41,219,41,226,41,233,41,240,41,247,41,254,42,5,42,
+12,42,19,42,26,42,33,42,40,42,47,42,54,42,61,42,68,42,75,42,82,42,89,42,96,
+42,103,42,110,42,117,42,124,42,131,42,138,42,145,42,152,42,159,42,166,42,
+173,42,180,42,187,42,194,42,201,42,208,42,215,42,222,42,229,42,236,42,243,
+42,250,43,1,43,8,43,15,43,22,43,29,43,36,43,43,43,50,43,57,43,64,43,71,43,
+78,43,85,43,92,43,99,43,106,43,113,43,122,43,128,43,135,43,141,43,148,43,
+155,43,162,43,169,43,176,43,183,43,190,43,197,43,204,43,213,43,220,43,227,
+43,234,43,241,43,248,43,255,44,6,44,13,44,20,44,27,44,34,44,41,44,48,44,55,
+44,62,44,69,44,76,44,83,44,90,44,97,44,104,44,111,44,118,44,125,44,132,44,
+139,44,146,44,153,44,160,44,167,44,174,44,181,44,188,44,195,44,202,44,209,
+44,216,44,223,44,232,44,239,44,246,44,253,45,4,45,11,45,18,45,25,45,32,45,
+39,45,46,45,53,45,60,45,67,45,74,45,81,45,88,45,95,45,102,45,109,45,116,45,
+123,45,130,45,137,45,144,45,151,45,164,45,171,45,178,45,185,45,192,45,199,
+45,206,45,213,45,220,45,231,45,238,45,245,45,252,46,8,46,15,46,22,46,29,46,
+36,46,43,46,50,46,57,46,64,46,71,46,78,46,85,46,92,46,99,46,106,46,113,46,
+120,46,127,46,134,46,141,46,148,46,155,46,162,46,175,46,182,46,189,46,196,
+46,203,46,210,46,217,46,224,46,231,46,238,46,245,46,252,47,3,47,10,47,17,
+47,24,47,31,47,38,47,45,47,52,47,59,47,66,47,73,47,80,47,87,47,94,47,101,
+47,108,47,115,47,122,47,129,47,136,47,143,47,150,47,157,47,164,47,171,47,
+178,47,185,47,192,47,199,47,206,47,213,47,220,47,227,47,234,47,241,47,248,
+47,255,48,6,48,13,48,20,48,27,48,34,48,41,48,48,48,55,48,62,48,69,48,78,48,
+85,48,92,48,99,48,106,48,113,48,122,48,134,48,143,48,150,48,157,48,164,48,
+174,48,181,48,188,48,195,48,204,48,211,48,218,48,225,48,237,48,247,48,254,
+49,10,49,23,49,35,49,42,49,49,49,56,49,63,49,70,49,77,49,84,49,91,49,98,49,
+105,49,112,49,119,49,126,49,135,49,142,49,149,49,156,49,163,49,173,49,180,
+49,187,49,194,49,201,49,208,49,215,49,222,49,229,49,236,49,243,49,250,50,
+1,50,8,50,15,50,22,50,29,50,36,50,43,50,50,50,57,50,64,50,71,50,78,50,85,
+50,92,50,99,50,106,50,113,50,120,50,127,50,134,50,141,50,148,50,155,50,162,
+50,169,50,176,50,183,50,190,50,197,50,204,50,211,50,218,50,225,50,232,50,
+239,50,246,50,253,51,4,51,11,51,18,51,25,51,32,51,39,51,41,51,84,51,99,51,
+109,110,111,116,101,113,117,97,108,105,110,102,105,110,105,116,121,108,101,
+115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,108,
+112,97,114,116,105,97,108,100,105,102,102,115,117,109,109,97,116,105,111,
+110,112,114,111,100,117,99,116,112,105,105,110,116,101,103,114,97,108,79,
+109,101,103,97,114,97,100,105,99,97,108,97,112,112,114,111,120,101,113,117,
+97,108,68,101,108,116,97,117,110,105,48,48,65,48,108,111,122,101,110,103,
+101,117,110,105,50,53,67,67,117,110,105,48,52,51,48,117,110,105,50,48,57,
+48,117,110,105,49,68,52,51,117,110,105,48,51,54,51,117,110,105,48,50,48,49,
+117,110,105,49,69,65,68,117,110,105,49,69,65,53,117,110,105,49,69,65,55,117,
+110,105,49,69,65,66,117,110,105,49,69,65,57,117,110,105,48,50,48,51,97,98,
+114,101,118,101,117,110,105,49,69,66,55,117,110,105,49,69,65,70,117,110,105,
+49,69,66,49,117,110,105,49,69,66,53,117,110,105,49,69,66,51,117,110,105,48,
+52,68,49,117,110,105,48,49,67,69,97,109,97,99,114,111,110,117,110,105,48,
+52,68,51,117,110,105,48,49,68,70,117,110,105,48,50,50,55,117,110,105,48,49,
+69,49,97,114,105,110,103,97,99,117,116,101,117,110,105,49,69,57,65,117,110,
+105,49,69,65,51,117,110,105,49,69,65,49,117,110,105,49,69,48,49,97,111,103,
+111,110,101,107,117,110,105,49,68,56,70,117,110,105,50,67,54,53,117,110,105,
+65,55,51,51,117,110,105,65,55,51,53,117,110,105,65,55,51,55,117,110,105,65,
+55,51,57,117,110,105,65,55,51,66,117,110,105,65,55,51,68,117,110,105,48,50,
+53,48,117,110,105,49,68,52,52,117,110,105,48,50,53,49,117,110,105,49,68,52,
+53,117,110,105,49,68,57,48,117,110,105,65,66,54,52,117,110,105,48,50,53,50,
+117,110,105,49,68,57,66,117,110,105,48,52,68,53,97,101,97,99,117,116,101,
+117,110,105,48,49,69,51,117,110,105,49,68,48,50,117,110,105,49,68,52,54,97,
+108,112,104,97,117,110,105,48,52,49,48,117,110,105,49,68,50,67,117,110,105,
+49,68,48,48,117,110,105,48,50,48,48,117,110,105,49,69,65,52,117,110,105,49,
+69,65,54,117,110,105,49,69,65,65,117,110,105,49,69,65,56,117,110,105,49,69,
+65,67,117,110,105,48,50,48,50,65,98,114,101,118,101,117,110,105,49,69,65,
+69,117,110,105,49,69,66,48,117,110,105,49,69,66,52,117,110,105,49,69,66,50,
+117,110,105,49,69,66,54,117,110,105,48,52,68,48,117,110,105,48,49,67,68,65,
+109,97,99,114,111,110,117,110,105,48,52,68,50,117,110,105,48,49,68,69,117,
+110,105,48,50,50,54,117,110,105,48,49,69,48,65,114,105,110,103,97,99,117,
+116,101,117,110,105,49,69,65,50,117,110,105,49,69,65,48,117,110,105,49,69,
+48,48,65,111,103,111,110,101,107,117,110,105,48,50,51,65,117,110,105,50,67,
+54,70,117,110,105,65,55,51,52,117,110,105,65,55,51,50,117,110,105,65,55,51,
+54,117,110,105,65,55,51,56,117,110,105,65,55,51,65,117,110,105,65,55,51,67,
+117,110,105,50,48,66,51,117,110,105,50,67,54,68,117,110,105,50,67,55,48,117,
+110,105,48,52,68,52,117,110,105,49,68,50,68,117,110,105,49,68,48,49,65,69,
+97,99,117,116,101,117,110,105,48,49,69,50,117,110,105,49,68,52,55,117,110,
+105,49,69,48,51,117,110,105,49,69,48,55,117,110,105,49,69,48,53,117,110,105,
+49,68,56,48,117,110,105,48,49,56,48,117,110,105,49,68,54,67,117,110,105,48,
+50,53,51,117,110,105,65,55,57,55,117,110,105,48,49,56,53,117,110,105,48,49,
+56,51,117,110,105,48,52,51,49,117,110,105,48,52,52,67,117,110,105,48,52,56,
+68,117,110,105,48,52,52,65,117,110,105,48,52,54,51,117,110,105,48,52,52,66,
+117,110,105,48,52,70,57,117,110,105,48,52,51,50,117,110,105,48,52,49,50,117,
+110,105,49,68,50,69,117,110,105,48,50,57,57,117,110,105,49,69,48,50,117,110,
+105,49,69,48,54,117,110,105,49,69,48,52,117,110,105,48,50,52,51,117,110,105,
+49,68,50,70,117,110,105,49,68,48,51,117,110,105,48,49,56,49,117,110,105,65,
+55,57,54,117,110,105,48,49,56,52,117,110,105,48,49,56,50,117,110,105,48,52,
+49,49,117,110,105,48,52,50,67,117,110,105,48,52,56,67,117,110,105,48,52,50,
+65,117,110,105,48,52,54,50,117,110,105,48,52,50,66,117,110,105,48,52,70,56,
+98,101,116,97,117,110,105,49,68,54,54,117,110,105,49,68,53,68,117,110,105,
+49,69,57,69,117,110,105,48,52,52,49,117,110,105,50,49,55,68,117,110,105,49,
+68,57,67,117,110,105,48,51,54,56,99,97,99,117,116,101,99,99,105,114,99,117,
+109,102,108,101,120,99,99,97,114,111,110,99,100,111,116,97,99,99,101,110,
+116,117,110,105,49,69,48,57,117,110,105,48,52,65,66,117,110,105,65,55,57,
+52,117,110,105,65,55,57,51,117,110,105,48,50,51,67,117,110,105,48,50,57,55,
+117,110,105,48,49,56,56,117,110,105,48,50,53,53,117,110,105,49,68,57,68,117,
+110,105,48,50,53,52,117,110,105,49,68,53,51,117,110,105,49,68,57,55,117,110,
+105,50,67,55,65,117,110,105,50,49,56,52,117,110,105,65,55,51,70,117,110,105,
+49,68,49,50,117,110,105,48,52,53,52,117,110,105,48,52,52,68,117,110,105,48,
+52,69,68,117,110,105,48,52,50,49,117,110,105,50,49,54,68,117,110,105,49,68,
+48,52,67,97,99,117,116,101,67,99,105,114,99,117,109,102,108,101,120,67,99,
+97,114,111,110,67,100,111,116,97,99,99,101,110,116,117,110,105,49,69,48,56,
+117,110,105,48,52,65,65,117,110,105,65,55,57,50,117,110,105,48,50,51,66,117,
+110,105,48,49,56,55,69,117,114,111,117,110,105,50,48,65,48,117,110,105,50,
+48,65,50,117,110,105,50,48,66,53,117,110,105,50,49,56,53,117,110,105,50,49,
+50,68,117,110,105,50,67,56,56,117,110,105,48,49,56,54,117,110,105,49,68,49,
+48,117,110,105,50,49,56,51,117,110,105,65,55,51,69,117,110,105,48,52,48,52,
+117,110,105,48,52,50,68,117,110,105,48,52,69,67,117,110,105,48,53,48,49,117,
+110,105,50,49,55,69,117,110,105,49,68,52,56,117,110,105,48,51,54,57,117,110,
+105,49,69,48,66,117,110,105,49,69,49,51,117,110,105,49,69,48,70,117,110,105,
+49,69,48,68,117,110,105,49,69,49,49,100,99,97,114,111,110,117,110,105,49,
+68,56,49,100,99,114,111,97,116,100,111,110,103,117,110,105,49,68,54,68,117,
+110,105,65,55,55,49,117,110,105,48,50,53,55,117,110,105,48,50,53,54,117,110,
+105,49,68,57,49,117,110,105,48,50,50,49,117,110,105,48,49,56,67,117,110,105,
+48,50,51,56,117,110,105,48,49,70,51,117,110,105,48,49,67,54,117,110,105,48,
+50,65,51,117,110,105,48,50,65,53,117,110,105,48,50,65,52,117,110,105,48,53,
+48,51,117,110,105,49,69,57,70,100,101,108,116,97,117,110,105,49,68,53,70,
+117,110,105,49,68,57,69,117,110,105,50,49,54,69,117,110,105,49,68,51,48,117,
+110,105,49,68,48,53,68,99,97,114,111,110,117,110,105,49,69,48,65,117,110,
+105,49,69,49,50,117,110,105,49,69,48,69,117,110,105,49,69,48,67,117,110,105,
+49,69,49,48,68,99,114,111,97,116,117,110,105,48,49,56,57,117,110,105,49,68,
+48,54,117,110,105,48,49,56,65,117,110,105,48,49,56,66,117,110,105,48,49,70,
+50,117,110,105,48,49,67,53,117,110,105,48,49,70,49,117,110,105,48,49,67,52,
+117,110,105,48,53,48,48,117,110,105,48,53,48,50,117,110,105,48,51,57,52,117,
+110,105,50,49,56,49,117,110,105,50,49,56,48,117,110,105,50,49,56,50,117,110,
+105,50,49,56,55,117,110,105,50,49,56,56,117,110,105,50,48,65,70,117,110,105,
+48,52,51,53,117,110,105,50,48,57,49,117,110,105,49,68,52,57,117,110,105,48,
+51,54,52,117,110,105,48,52,53,48,117,110,105,48,50,48,53,117,110,105,49,69,
+66,70,117,110,105,49,69,67,49,117,110,105,49,69,67,53,117,110,105,49,69,67,
+51,117,110,105,49,69,67,55,117,110,105,48,50,48,55,101,98,114,101,118,101,
+117,110,105,48,52,68,55,101,99,97,114,111,110,117,110,105,49,69,66,68,101,
+109,97,99,114,111,110,117,110,105,49,69,49,55,117,110,105,49,69,49,53,117,
+110,105,48,52,53,49,101,100,111,116,97,99,99,101,110,116,117,110,105,49,69,
+66,66,117,110,105,49,69,49,57,117,110,105,49,69,49,66,117,110,105,49,69,66,
+57,117,110,105,50,67,55,56,117,110,105,48,50,50,57,117,110,105,49,69,49,68,
+101,111,103,111,110,101,107,117,110,105,49,68,57,50,117,110,105,48,50,52,
+55,117,110,105,48,52,66,68,117,110,105,48,52,66,70,117,110,105,48,49,68,68,
+117,110,105,48,50,53,57,117,110,105,48,52,68,57,117,110,105,50,48,57,52,117,
+110,105,49,68,52,65,117,110,105,48,52,68,66,117,110,105,49,68,57,53,117,110,
+105,48,50,53,65,117,110,105,48,50,53,56,117,110,105,48,50,53,66,117,110,105,
+49,68,52,66,117,110,105,49,68,57,51,117,110,105,48,50,53,67,117,110,105,49,
+68,57,70,117,110,105,49,68,57,52,117,110,105,48,50,53,68,117,110,105,49,68,
+48,56,117,110,105,49,68,52,67,117,110,105,48,50,57,65,117,110,105,48,50,53,
+69,117,110,105,48,53,49,49,117,110,105,48,52,51,55,117,110,105,48,52,68,70,
+117,110,105,48,52,57,57,117,110,105,48,53,48,55,117,110,105,48,53,48,53,117,
+110,105,48,52,49,53,117,110,105,49,68,51,49,117,110,105,49,68,48,55,117,110,
+105,48,52,48,48,117,110,105,48,50,48,52,117,110,105,49,69,66,69,117,110,105,
+49,69,67,48,117,110,105,49,69,67,52,117,110,105,49,69,67,50,117,110,105,49,
+69,67,54,117,110,105,48,50,48,54,69,98,114,101,118,101,117,110,105,48,52,
+68,54,69,99,97,114,111,110,117,110,105,49,69,66,67,69,109,97,99,114,111,110,
+117,110,105,49,69,49,54,117,110,105,49,69,49,52,117,110,105,48,52,48,49,69,
+100,111,116,97,99,99,101,110,116,117,110,105,49,69,66,65,117,110,105,49,69,
+49,56,117,110,105,49,69,49,65,117,110,105,49,69,66,56,117,110,105,48,50,50,
+56,117,110,105,49,69,49,67,69,111,103,111,110,101,107,117,110,105,48,50,52,
+54,117,110,105,50,67,55,66,117,110,105,48,52,66,67,117,110,105,48,52,66,69,
+117,110,105,48,49,56,69,101,120,105,115,116,101,110,116,105,97,108,117,110,
+105,50,50,48,52,117,110,105,49,68,51,50,117,110,105,48,49,56,70,117,110,105,
+48,52,68,56,117,110,105,48,52,68,65,117,110,105,48,49,57,48,117,110,105,65,
+55,65,66,117,110,105,48,53,49,48,117,110,105,48,52,49,55,117,110,105,48,52,
+68,69,117,110,105,48,52,57,56,117,110,105,48,53,48,54,117,110,105,48,53,48,
+52,117,110,105,49,68,65,48,117,110,105,49,69,49,70,117,110,105,49,68,56,50,
+117,110,105,49,68,54,69,117,110,105,65,55,57,57,117,110,105,48,50,65,57,108,
+111,110,103,115,117,110,105,49,69,57,66,117,110,105,49,69,57,68,117,110,105,
+49,69,57,67,117,110,105,48,52,51,51,117,110,105,48,52,53,51,117,110,105,48,
+52,57,49,117,110,105,48,52,70,55,117,110,105,48,52,57,51,117,110,105,48,52,
+70,66,117,110,105,65,55,51,48,117,110,105,49,69,49,69,102,114,97,110,99,117,
+110,105,48,49,57,49,117,110,105,65,55,57,56,117,110,105,65,55,70,66,117,110,
+105,48,52,49,51,71,97,109,109,97,117,110,105,49,68,50,54,117,110,105,48,52,
+48,51,117,110,105,48,52,57,48,117,110,105,48,52,70,54,117,110,105,48,52,57,
+50,117,110,105,48,52,70,65,117,110,105,49,68,52,68,117,110,105,48,49,70,53,
+103,99,105,114,99,117,109,102,108,101,120,103,98,114,101,118,101,103,99,97,
+114,111,110,117,110,105,49,69,50,49,103,100,111,116,97,99,99,101,110,116,
+103,99,111,109,109,97,97,99,99,101,110,116,117,110,105,48,49,69,53,117,110,
+105,65,55,65,49,117,110,105,48,50,54,49,117,110,105,49,68,65,50,117,110,105,
+49,68,56,51,117,110,105,48,50,54,48,117,110,105,49,68,55,55,117,110,105,49,
+68,55,57,117,110,105,65,55,55,70,117,110,105,48,53,48,68,117,110,105,49,68,
+51,51,117,110,105,48,50,54,50,117,110,105,48,49,70,52,71,99,105,114,99,117,
+109,102,108,101,120,71,98,114,101,118,101,71,99,97,114,111,110,117,110,105,
+49,69,50,48,71,100,111,116,97,99,99,101,110,116,71,99,111,109,109,97,97,99,
+99,101,110,116,117,110,105,48,49,69,52,117,110,105,65,55,65,48,117,110,105,
+48,49,57,51,117,110,105,48,50,57,66,117,110,105,65,55,65,67,117,110,105,50,
+48,66,50,117,110,105,65,55,55,68,117,110,105,65,55,55,69,117,110,105,48,53,
+48,67,117,110,105,50,48,57,53,117,110,105,48,50,66,48,117,110,105,48,51,54,
+65,104,99,105,114,99,117,109,102,108,101,120,117,110,105,48,50,49,70,117,
+110,105,49,69,50,55,117,110,105,49,69,50,51,117,110,105,49,69,50,66,117,110,
+105,49,69,57,54,117,110,105,49,69,50,53,117,110,105,49,69,50,57,117,110,105,
+65,55,57,53,104,98,97,114,117,110,105,48,52,53,66,117,110,105,48,52,53,50,
+117,110,105,48,50,54,54,117,110,105,48,50,66,49,117,110,105,65,55,50,55,117,
+110,105,48,50,54,55,117,110,105,50,67,54,56,117,110,105,48,49,57,53,117,110,
+105,50,67,55,54,117,110,105,48,50,54,53,117,110,105,49,68,65,51,117,110,105,
+48,50,65,69,117,110,105,48,50,65,70,117,110,105,48,52,66,66,117,110,105,48,
+52,57,53,117,110,105,48,53,50,55,117,110,105,48,52,51,68,117,110,105,48,52,
+65,53,117,110,105,48,52,65,51,117,110,105,48,52,67,65,117,110,105,48,52,53,
+65,117,110,105,48,52,67,56,117,110,105,48,53,50,57,117,110,105,48,53,48,66,
+117,110,105,48,53,50,51,117,110,105,48,52,51,70,117,110,105,48,53,50,53,117,
+110,105,48,52,65,55,117,110,105,48,52,53,70,117,110,105,48,52,52,54,117,110,
+105,48,52,52,56,117,110,105,48,52,52,57,117,110,105,49,68,50,56,117,110,105,
+48,52,49,68,117,110,105,49,68,51,52,117,110,105,49,68,55,56,117,110,105,48,
+50,57,67,72,99,105,114,99,117,109,102,108,101,120,117,110,105,48,50,49,69,
+117,110,105,49,69,50,54,117,110,105,49,69,50,50,117,110,105,49,69,50,65,117,
+110,105,49,69,50,52,117,110,105,49,69,50,56,72,98,97,114,117,110,105,65,55,
+70,56,117,110,105,65,55,65,65,117,110,105,65,55,50,54,117,110,105,50,67,54,
+55,117,110,105,48,49,70,54,117,110,105,50,67,55,53,117,110,105,50,49,48,67,
+117,110,105,48,53,50,56,117,110,105,65,55,56,68,117,110,105,48,52,66,65,117,
+110,105,48,52,57,52,117,110,105,48,53,50,54,117,110,105,48,52,65,52,117,110,
+105,48,52,65,50,117,110,105,48,52,67,57,117,110,105,48,52,48,65,117,110,105,
+48,52,67,55,117,110,105,48,53,48,65,117,110,105,48,53,50,50,117,110,105,48,
+52,49,70,117,110,105,48,53,50,52,117,110,105,48,52,65,54,117,110,105,48,52,
+48,70,117,110,105,48,52,50,54,117,110,105,48,52,50,56,117,110,105,48,52,50,
+57,80,105,117,110,105,48,52,53,54,117,110,105,50,49,55,48,117,110,105,49,
+68,54,50,117,110,105,50,48,55,49,117,110,105,48,51,54,53,117,110,105,48,50,
+48,57,117,110,105,48,50,48,66,105,98,114,101,118,101,117,110,105,48,49,68,
+48,105,116,105,108,100,101,105,109,97,99,114,111,110,117,110,105,48,52,53,
+55,117,110,105,49,69,50,70,117,110,105,49,69,67,57,117,110,105,49,69,50,68,
+117,110,105,49,69,67,66,105,111,103,111,110,101,107,117,110,105,49,68,57,
+54,117,110,105,48,50,54,56,117,110,105,49,68,65,52,117,110,105,49,68,48,57,
+117,110,105,49,68,52,69,105,106,117,110,105,50,49,55,49,117,110,105,50,49,
+55,50,117,110,105,50,49,55,51,117,110,105,50,49,55,56,117,110,105,48,50,54,
+57,117,110,105,49,68,65,53,117,110,105,49,68,55,67,117,110,105,48,52,52,69,
+117,110,105,48,52,48,54,117,110,105,48,52,67,48,117,110,105,48,52,67,70,117,
+110,105,50,49,54,48,117,110,105,49,68,51,53,117,110,105,48,50,54,65,117,110,
+105,49,68,65,54,117,110,105,48,50,48,56,117,110,105,48,50,48,65,73,98,114,
+101,118,101,117,110,105,48,49,67,70,73,116,105,108,100,101,73,109,97,99,114,
+111,110,117,110,105,48,52,48,55,117,110,105,49,69,50,69,73,100,111,116,97,
+99,99,101,110,116,117,110,105,49,69,67,56,117,110,105,49,69,50,67,117,110,
+105,49,69,67,65,73,111,103,111,110,101,107,117,110,105,48,49,57,55,117,110,
+105,49,68,55,66,117,110,105,49,68,65,55,117,110,105,65,55,70,69,73,74,117,
+110,105,50,49,54,49,117,110,105,50,49,54,50,117,110,105,50,49,54,51,117,110,
+105,50,49,54,56,117,110,105,48,49,57,54,117,110,105,48,52,50,69,117,110,105,
+65,55,70,55,117,110,105,48,52,53,56,117,110,105,50,67,55,67,117,110,105,48,
+50,66,50,106,99,105,114,99,117,109,102,108,101,120,117,110,105,48,49,70,48,
+117,110,105,48,50,52,57,117,110,105,48,50,57,68,117,110,105,49,68,65,56,117,
+110,105,48,50,51,55,117,110,105,48,50,53,70,117,110,105,49,68,65,49,117,110,
+105,48,50,56,52,117,110,105,65,55,54,68,117,110,105,48,52,51,66,117,110,105,
+48,53,50,70,117,110,105,48,52,67,54,117,110,105,48,52,53,57,117,110,105,48,
+53,49,51,117,110,105,48,53,48,57,117,110,105,48,53,50,49,117,110,105,48,52,
+51,52,117,110,105,48,53,50,66,117,110,105,48,53,49,53,117,110,105,48,52,48,
+56,117,110,105,49,68,51,54,117,110,105,49,68,48,65,74,99,105,114,99,117,109,
+102,108,101,120,117,110,105,48,50,52,56,117,110,105,65,55,66,50,117,110,105,
+65,55,54,67,117,110,105,48,52,49,66,117,110,105,49,68,50,66,117,110,105,48,
+53,50,69,117,110,105,48,52,67,53,117,110,105,48,52,48,57,117,110,105,48,53,
+49,50,117,110,105,48,53,48,56,117,110,105,48,53,50,48,117,110,105,48,53,49,
+52,117,110,105,48,52,49,52,117,110,105,48,53,50,65,117,110,105,50,48,57,54,
+117,110,105,49,68,52,70,117,110,105,49,69,51,49,117,110,105,48,49,69,57,117,
+110,105,49,69,51,53,117,110,105,49,69,51,51,107,99,111,109,109,97,97,99,99,
+101,110,116,117,110,105,49,68,56,52,117,110,105,65,55,52,49,117,110,105,65,
+55,52,53,117,110,105,65,55,52,51,117,110,105,65,55,65,51,117,110,105,48,49,
+57,57,117,110,105,50,67,54,65,117,110,105,48,50,57,69,107,103,114,101,101,
+110,108,97,110,100,105,99,117,110,105,48,52,51,65,117,110,105,48,52,53,67,
+117,110,105,48,52,57,66,117,110,105,48,52,65,49,117,110,105,48,52,57,70,117,
+110,105,48,52,57,68,117,110,105,48,52,67,52,117,110,105,48,53,49,70,117,110,
+105,48,52,51,54,117,110,105,48,52,67,50,117,110,105,48,52,68,68,117,110,105,
+48,52,57,55,117,110,105,49,68,51,55,117,110,105,49,68,48,66,117,110,105,49,
+69,51,48,117,110,105,48,49,69,56,117,110,105,49,69,51,52,117,110,105,49,69,
+51,50,75,99,111,109,109,97,97,99,99,101,110,116,117,110,105,65,55,52,48,117,
+110,105,65,55,52,52,117,110,105,65,55,52,50,117,110,105,65,55,65,50,117,110,
+105,48,49,57,56,117,110,105,50,67,54,57,117,110,105,65,55,66,48,117,110,105,
+50,48,65,68,117,110,105,48,52,49,65,117,110,105,48,52,48,67,117,110,105,48,
+52,57,65,117,110,105,48,52,65,48,117,110,105,48,52,57,69,117,110,105,48,52,
+57,67,117,110,105,48,52,67,51,117,110,105,48,53,49,69,117,110,105,48,52,49,
+54,117,110,105,48,52,67,49,117,110,105,48,52,68,67,117,110,105,48,52,57,54,
+117,110,105,50,49,55,67,117,110,105,50,48,57,55,117,110,105,48,50,69,49,108,
+97,99,117,116,101,117,110,105,49,69,51,68,117,110,105,49,69,51,66,117,110,
+105,49,69,51,55,117,110,105,49,69,51,57,108,99,111,109,109,97,97,99,99,101,
+110,116,108,100,111,116,108,99,97,114,111,110,117,110,105,49,68,56,53,117,
+110,105,49,68,65,65,117,110,105,48,49,57,65,117,110,105,65,55,52,57,117,110,
+105,50,67,54,49,117,110,105,48,50,54,66,117,110,105,48,50,54,68,117,110,105,
+49,68,65,57,117,110,105,48,50,51,52,117,110,105,48,50,54,67,117,110,105,65,
+55,56,69,117,110,105,65,55,52,55,117,110,105,65,55,56,49,117,110,105,65,55,
+55,50,117,110,105,48,49,67,57,117,110,105,49,69,70,66,117,110,105,48,50,65,
+65,117,110,105,50,48,66,54,117,110,105,50,48,66,65,117,110,105,48,50,65,66,
+117,110,105,48,50,54,69,117,110,105,50,49,49,51,117,110,105,50,48,66,48,108,
+105,114,97,117,110,105,50,49,54,67,117,110,105,49,68,51,56,117,110,105,48,
+50,57,70,117,110,105,49,68,65,66,76,97,99,117,116,101,117,110,105,49,69,51,
+67,117,110,105,49,69,51,65,117,110,105,49,69,51,54,117,110,105,49,69,51,56,
+76,99,111,109,109,97,97,99,99,101,110,116,76,100,111,116,76,99,97,114,111,
+110,117,110,105,48,50,51,68,117,110,105,65,55,52,56,117,110,105,50,67,54,
+48,117,110,105,50,67,54,50,117,110,105,49,68,48,67,117,110,105,65,55,65,68,
+117,110,105,65,55,52,54,117,110,105,65,55,56,48,117,110,105,48,49,67,56,117,
+110,105,48,49,67,55,117,110,105,49,69,70,65,117,110,105,50,49,55,70,117,110,
+105,50,48,57,56,117,110,105,49,68,53,48,117,110,105,48,51,54,66,117,110,105,
+49,69,51,70,117,110,105,49,69,52,49,117,110,105,49,69,52,51,117,110,105,49,
+68,56,54,117,110,105,49,68,54,70,117,110,105,50,48,65,53,117,110,105,65,55,
+55,51,117,110,105,48,50,55,49,117,110,105,49,68,65,67,117,110,105,48,50,54,
+70,117,110,105,49,68,53,65,117,110,105,48,50,55,48,117,110,105,49,68,65,68,
+117,110,105,49,68,49,70,117,110,105,48,52,51,67,117,110,105,48,52,67,69,117,
+110,105,48,52,49,67,117,110,105,50,49,54,70,117,110,105,49,68,51,57,117,110,
+105,49,68,48,68,117,110,105,49,69,51,69,117,110,105,49,69,52,48,117,110,105,
+49,69,52,50,117,110,105,50,67,54,69,117,110,105,65,55,70,65,117,110,105,48,
+49,57,67,117,110,105,65,55,70,68,117,110,105,65,55,70,70,117,110,105,48,52,
+67,68,117,110,105,50,49,51,53,117,110,105,50,48,57,57,117,110,105,50,48,55,
+70,110,97,99,117,116,101,117,110,105,48,49,70,57,110,99,97,114,111,110,117,
+110,105,49,69,52,53,117,110,105,49,69,52,66,117,110,105,49,69,52,57,117,110,
+105,49,69,52,55,110,99,111,109,109,97,97,99,99,101,110,116,117,110,105,49,
+68,56,55,117,110,105,49,68,55,48,117,110,105,65,55,65,53,117,110,105,65,55,
+55,52,117,110,105,48,50,55,50,117,110,105,49,68,65,69,101,110,103,117,110,
+105,49,68,53,49,117,110,105,48,50,55,51,117,110,105,49,68,65,70,117,110,105,
+48,50,51,53,117,110,105,65,55,57,49,117,110,105,48,49,57,69,117,110,105,48,
+49,67,67,117,110,105,48,52,51,56,117,110,105,48,52,53,68,117,110,105,48,52,
+51,57,117,110,105,48,52,56,66,117,110,105,48,52,69,51,117,110,105,48,52,69,
+53,117,110,105,49,68,51,65,117,110,105,48,50,55,52,117,110,105,49,68,66,48,
+78,97,99,117,116,101,117,110,105,48,49,70,56,78,99,97,114,111,110,117,110,
+105,49,69,52,52,117,110,105,49,69,52,65,117,110,105,49,69,52,56,117,110,105,
+49,69,52,54,78,99,111,109,109,97,97,99,99,101,110,116,117,110,105,50,48,65,
+54,117,110,105,65,55,65,52,117,110,105,48,49,57,68,117,110,105,65,55,57,48,
+117,110,105,49,68,48,69,117,110,105,49,68,51,66,69,110,103,117,110,105,48,
+50,50,48,117,110,105,48,49,67,66,117,110,105,48,49,67,65,117,110,105,50,49,
+49,54,117,110,105,48,52,49,56,117,110,105,48,52,48,68,117,110,105,48,52,49,
+57,117,110,105,48,52,56,65,117,110,105,48,52,69,52,117,110,105,48,52,69,50,
+117,110,105,48,52,51,69,117,110,105,50,48,57,50,117,110,105,49,68,53,50,117,
+110,105,48,51,54,54,111,104,117,110,103,97,114,117,109,108,97,117,116,117,
+110,105,48,50,48,68,117,110,105,49,69,68,49,117,110,105,49,69,68,51,117,110,
+105,49,69,68,55,117,110,105,49,69,68,53,117,110,105,49,69,68,57,117,110,105,
+48,50,48,70,111,98,114,101,118,101,117,110,105,48,49,68,50,117,110,105,49,
+69,52,68,117,110,105,48,50,50,68,117,110,105,49,69,52,70,111,109,97,99,114,
+111,110,117,110,105,49,69,53,51,117,110,105,49,69,53,49,117,110,105,48,52,
+69,55,117,110,105,48,50,50,66,117,110,105,48,50,50,70,117,110,105,48,50,51,
+49,117,110,105,49,69,67,70,117,110,105,49,69,67,68,117,110,105,48,49,69,66,
+117,110,105,48,49,69,68,117,110,105,48,49,56,68,117,110,105,48,50,55,53,117,
+110,105,48,52,69,57,117,110,105,49,68,66,49,117,110,105,48,52,69,66,116,104,
+101,116,97,117,110,105,65,55,52,66,117,110,105,49,68,66,70,117,110,105,48,
+52,55,51,111,115,108,97,115,104,97,99,117,116,101,101,109,112,116,121,115,
+101,116,117,110,105,65,55,52,68,117,110,105,65,55,55,65,111,104,111,114,110,
+117,110,105,49,69,68,66,117,110,105,49,69,68,68,117,110,105,49,69,69,49,117,
+110,105,49,69,68,70,117,110,105,49,69,69,51,115,105,103,109,97,117,110,105,
+48,52,65,57,117,110,105,49,68,49,49,117,110,105,49,68,49,51,117,110,105,65,
+55,70,57,117,110,105,49,68,49,52,117,110,105,48,49,65,51,117,110,105,65,55,
+52,70,117,110,105,48,50,50,51,117,110,105,49,68,49,55,117,110,105,49,68,53,
+53,117,110,105,49,68,49,54,117,110,105,49,68,53,52,117,110,105,48,52,49,69,
+117,110,105,49,68,51,67,117,110,105,49,68,48,70,79,104,117,110,103,97,114,
+117,109,108,97,117,116,117,110,105,48,50,48,67,117,110,105,49,69,68,48,117,
+110,105,49,69,68,50,117,110,105,49,69,68,54,117,110,105,49,69,68,52,117,110,
+105,49,69,68,56,117,110,105,48,50,48,69,79,98,114,101,118,101,117,110,105,
+48,49,68,49,117,110,105,49,69,52,67,117,110,105,48,50,50,67,117,110,105,49,
+69,52,69,79,109,97,99,114,111,110,117,110,105,49,69,53,50,117,110,105,49,
+69,53,48,117,110,105,48,52,69,54,117,110,105,48,50,50,65,117,110,105,48,50,
+50,69,117,110,105,48,50,51,48,117,110,105,49,69,67,69,117,110,105,49,69,67,
+67,117,110,105,48,49,69,65,117,110,105,48,49,69,67,117,110,105,48,49,57,70,
+117,110,105,48,52,69,56,117,110,105,48,52,69,65,84,104,101,116,97,117,110,
+105,65,55,52,65,117,110,105,48,52,55,50,79,115,108,97,115,104,97,99,117,116,
+101,117,110,105,65,55,52,67,117,110,105,65,55,55,57,79,104,111,114,110,117,
+110,105,49,69,68,65,117,110,105,49,69,68,67,117,110,105,49,69,69,48,117,110,
+105,49,69,68,69,117,110,105,49,69,69,50,117,110,105,48,52,65,56,117,110,105,
+48,50,55,54,117,110,105,48,49,65,50,117,110,105,65,55,52,69,117,110,105,48,
+50,50,50,117,110,105,49,68,51,68,117,110,105,49,68,49,53,117,110,105,48,51,
+65,57,117,110,105,65,66,54,53,117,110,105,48,50,57,56,117,110,105,48,52,52,
+48,117,110,105,50,48,57,65,117,110,105,49,68,53,54,117,110,105,49,69,53,53,
+117,110,105,49,69,53,55,117,110,105,49,68,56,56,117,110,105,49,68,55,68,117,
+110,105,65,55,53,49,117,110,105,48,52,56,70,117,110,105,49,68,55,49,117,110,
+105,48,49,65,53,117,110,105,65,55,54,53,117,110,105,65,55,54,55,117,110,105,
+65,55,53,53,117,110,105,65,55,53,51,117,110,105,48,53,49,55,117,110,105,48,
+49,66,70,114,104,111,117,110,105,49,68,54,56,117,110,105,48,50,55,56,117,
+110,105,49,68,66,50,117,110,105,48,52,52,52,112,104,105,117,110,105,49,68,
+54,57,117,110,105,49,68,54,48,117,110,105,50,67,55,55,117,110,105,48,52,50,
+48,117,110,105,49,68,51,69,117,110,105,49,68,49,56,117,110,105,49,68,50,57,
+117,110,105,49,69,53,52,117,110,105,49,69,53,54,117,110,105,50,67,54,51,117,
+110,105,65,55,53,48,117,110,105,48,52,56,69,117,110,105,48,49,65,52,117,110,
+105,65,55,53,52,117,110,105,65,55,53,50,117,110,105,50,49,49,55,117,110,105,
+48,53,49,54,117,110,105,50,48,66,68,117,110,105,50,48,66,49,112,101,115,101,
+116,97,117,110,105,65,55,54,52,117,110,105,65,55,54,54,117,110,105,48,49,
+70,55,117,110,105,65,55,70,67,117,110,105,48,52,50,52,117,110,105,48,53,49,
+66,117,110,105,65,55,53,55,117,110,105,65,55,53,57,117,110,105,48,50,65,48,
+117,110,105,48,50,52,66,117,110,105,48,49,65,65,117,110,105,48,50,51,57,117,
+110,105,48,53,49,65,117,110,105,48,50,52,65,117,110,105,65,55,53,54,117,110,
+105,65,55,53,56,117,110,105,49,68,54,51,117,110,105,49,68,67,65,117,110,105,
+48,50,66,51,117,110,105,48,51,54,67,114,97,99,117,116,101,117,110,105,48,
+50,49,49,117,110,105,48,50,49,51,114,99,97,114,111,110,117,110,105,49,69,
+53,57,117,110,105,49,69,53,70,117,110,105,49,69,53,66,117,110,105,49,69,53,
+68,114,99,111,109,109,97,97,99,99,101,110,116,117,110,105,49,68,56,57,117,
+110,105,48,50,52,68,117,110,105,49,68,55,50,117,110,105,65,55,65,55,117,110,
+105,48,50,55,68,117,110,105,48,50,55,67,117,110,105,65,55,53,66,117,110,105,
+65,55,53,68,117,110,105,65,55,56,51,117,110,105,65,55,56,53,117,110,105,65,
+55,55,67,117,110,105,48,50,55,57,117,110,105,48,50,66,52,117,110,105,48,50,
+55,66,117,110,105,48,50,66,53,117,110,105,48,50,55,65,117,110,105,50,67,55,
+57,117,110,105,48,50,55,69,117,110,105,49,68,55,51,117,110,105,65,55,55,53,
+117,110,105,48,50,56,53,117,110,105,48,50,55,70,117,110,105,49,68,51,70,117,
+110,105,48,50,56,48,82,97,99,117,116,101,117,110,105,48,50,49,48,117,110,
+105,48,50,49,50,82,99,97,114,111,110,117,110,105,49,69,53,56,117,110,105,
+49,69,53,69,117,110,105,49,69,53,65,117,110,105,49,69,53,67,82,99,111,109,
+109,97,97,99,99,101,110,116,117,110,105,48,50,52,67,117,110,105,65,55,65,
+54,117,110,105,50,67,54,52,117,110,105,65,55,53,65,117,110,105,65,55,53,67,
+117,110,105,65,55,56,50,117,110,105,65,55,56,52,117,110,105,65,55,55,66,117,
+110,105,48,49,65,54,117,110,105,50,48,65,56,117,110,105,50,48,66,57,117,110,
+105,50,49,49,70,117,110,105,49,68,49,65,117,110,105,48,50,56,49,117,110,105,
+48,50,66,54,117,110,105,65,55,55,54,117,110,105,48,52,50,70,117,110,105,49,
+68,49,57,117,110,105,48,52,52,70,117,110,105,48,53,49,57,117,110,105,48,53,
+49,56,117,110,105,48,52,53,53,117,110,105,50,48,57,66,117,110,105,48,50,69,
+50,115,97,99,117,116,101,117,110,105,49,69,54,53,115,99,105,114,99,117,109,
+102,108,101,120,117,110,105,49,69,54,55,117,110,105,49,69,54,49,117,110,105,
+49,69,54,51,117,110,105,49,69,54,57,117,110,105,48,50,49,57,115,99,101,100,
+105,108,108,97,117,110,105,48,50,56,50,117,110,105,49,68,66,51,117,110,105,
+49,68,56,65,117,110,105,49,68,55,52,117,110,105,65,55,65,57,117,110,105,48,
+50,51,70,117,110,105,48,49,65,56,117,110,105,48,50,56,51,117,110,105,49,68,
+66,52,117,110,105,49,68,57,56,117,110,105,49,68,56,66,117,110,105,48,50,56,
+54,117,110,105,65,55,55,56,117,110,105,48,52,48,53,117,110,105,65,55,51,49,
+83,97,99,117,116,101,117,110,105,49,69,54,52,83,99,105,114,99,117,109,102,
+108,101,120,117,110,105,49,69,54,54,117,110,105,49,69,54,48,117,110,105,49,
+69,54,50,117,110,105,49,69,54,56,117,110,105,48,50,49,56,83,99,101,100,105,
+108,108,97,117,110,105,65,55,65,56,117,110,105,50,67,55,69,117,110,105,48,
+49,65,55,117,110,105,50,48,66,52,117,110,105,50,48,66,55,117,110,105,50,48,
+57,67,117,110,105,49,68,53,55,117,110,105,48,51,54,68,117,110,105,49,69,57,
+55,117,110,105,49,69,54,66,117,110,105,49,69,55,49,117,110,105,49,69,54,70,
+117,110,105,49,69,54,68,117,110,105,48,50,49,66,116,99,97,114,111,110,117,
+110,105,48,49,54,51,117,110,105,48,49,65,66,117,110,105,49,68,66,53,116,98,
+97,114,117,110,105,49,68,55,53,117,110,105,50,67,54,54,117,110,105,48,49,
+65,68,117,110,105,48,50,56,56,117,110,105,48,50,51,54,117,110,105,65,55,55,
+55,117,110,105,49,68,55,65,117,110,105,48,50,65,56,117,110,105,48,50,65,54,
+117,110,105,48,50,65,55,117,110,105,65,55,50,57,117,110,105,65,55,56,55,117,
+110,105,48,50,56,55,117,110,105,48,52,52,50,117,110,105,48,52,65,68,117,110,
+105,48,53,48,70,117,110,105,48,52,66,53,117,110,105,48,52,50,50,117,110,105,
+49,68,52,48,117,110,105,49,68,49,66,84,99,97,114,111,110,117,110,105,50,48,
+66,56,117,110,105,49,69,54,65,117,110,105,49,69,55,48,117,110,105,49,69,54,
+69,117,110,105,49,69,54,67,117,110,105,48,50,49,65,117,110,105,48,49,54,50,
+84,98,97,114,117,110,105,50,48,65,69,117,110,105,48,50,51,69,117,110,105,
+48,49,65,67,117,110,105,48,49,65,69,117,110,105,65,55,50,56,117,110,105,65,
+55,56,54,117,110,105,65,55,66,49,117,110,105,48,52,65,67,117,110,105,48,53,
+48,69,117,110,105,48,52,66,52,117,110,105,48,52,48,66,117,110,105,48,52,48,
+50,117,110,105,49,68,54,52,117,110,105,49,68,53,56,117,110,105,48,51,54,55,
+117,104,117,110,103,97,114,117,109,108,97,117,116,117,110,105,48,50,49,53,
+117,110,105,48,50,49,55,117,98,114,101,118,101,117,110,105,48,49,68,52,117,
+116,105,108,100,101,117,110,105,49,69,55,57,117,109,97,99,114,111,110,117,
+110,105,49,69,55,66,117,110,105,48,49,68,56,117,110,105,48,49,68,67,117,110,
+105,48,49,68,65,117,110,105,48,49,68,54,117,114,105,110,103,117,110,105,49,
+69,69,55,117,110,105,49,69,55,55,117,110,105,49,69,55,53,117,110,105,49,69,
+55,51,117,110,105,49,69,69,53,117,111,103,111,110,101,107,117,110,105,49,
+68,57,57,117,110,105,48,50,56,57,117,110,105,49,68,66,54,117,104,111,114,
+110,117,110,105,49,69,69,57,117,110,105,49,69,69,66,117,110,105,49,69,69,
+70,117,110,105,49,69,69,68,117,110,105,49,69,70,49,117,110,105,49,68,54,66,
+117,110,105,49,68,49,68,117,110,105,49,68,53,57,117,110,105,49,68,49,69,117,
+110,105,48,50,56,66,117,110,105,49,68,66,57,117,110,105,48,51,66,67,117,110,
+105,48,50,56,65,117,110,105,49,68,66,55,117,110,105,49,68,55,70,117,110,105,
+49,68,52,49,117,110,105,49,68,49,67,117,110,105,49,68,66,56,85,104,117,110,
+103,97,114,117,109,108,97,117,116,117,110,105,48,50,49,52,117,110,105,48,
+50,49,54,85,98,114,101,118,101,117,110,105,48,49,68,51,85,116,105,108,100,
+101,117,110,105,49,69,55,56,85,109,97,99,114,111,110,117,110,105,49,69,55,
+65,117,110,105,48,49,68,55,117,110,105,48,49,68,66,117,110,105,48,49,68,57,
+117,110,105,48,49,68,53,85,114,105,110,103,117,110,105,49,69,69,54,117,110,
+105,49,69,55,54,117,110,105,49,69,55,52,117,110,105,49,69,55,50,117,110,105,
+49,69,69,52,85,111,103,111,110,101,107,117,110,105,48,50,52,52,117,110,105,
+49,68,55,69,85,104,111,114,110,117,110,105,49,69,69,56,117,110,105,49,69,
+69,65,117,110,105,49,69,69,69,117,110,105,49,69,69,67,117,110,105,49,69,70,
+48,117,110,105,48,49,66,50,117,110,105,65,55,53,69,117,110,105,65,55,54,48,
+117,110,105,65,55,54,56,117,110,105,48,49,66,49,117,110,105,50,49,55,52,117,
+110,105,49,68,54,53,117,110,105,49,68,53,66,117,110,105,48,51,54,69,117,110,
+105,49,69,55,68,117,110,105,49,69,55,70,117,110,105,49,68,56,67,117,110,105,
+50,67,55,49,117,110,105,48,52,55,52,117,110,105,50,67,55,52,117,110,105,65,
+55,53,70,117,110,105,65,55,54,49,117,110,105,65,55,54,57,117,110,105,50,49,
+55,53,117,110,105,50,49,55,54,117,110,105,50,49,55,55,117,110,105,48,50,56,
+67,117,110,105,49,68,66,65,117,110,105,48,50,54,52,117,110,105,48,50,54,51,
+117,110,105,48,50,69,48,103,97,109,109,97,117,110,105,49,68,54,55,117,110,
+105,49,68,53,69,117,110,105,50,49,54,52,117,110,105,50,67,55,68,117,110,105,
+49,68,50,48,117,110,105,49,69,55,67,117,110,105,49,69,55,69,117,110,105,50,
+49,50,51,117,110,105,48,52,55,53,117,110,105,50,49,54,53,117,110,105,50,49,
+54,54,117,110,105,50,49,54,55,117,110,105,48,50,52,53,117,110,105,49,68,50,
+55,117,110,105,48,49,57,52,117,110,105,48,53,49,68,117,110,105,48,50,66,55,
+119,97,99,117,116,101,119,103,114,97,118,101,119,99,105,114,99,117,109,102,
+108,101,120,119,100,105,101,114,101,115,105,115,117,110,105,49,69,56,55,117,
+110,105,49,69,57,56,117,110,105,49,69,56,57,117,110,105,50,67,55,51,117,110,
+105,48,50,65,67,117,110,105,48,50,56,68,111,109,101,103,97,117,110,105,48,
+50,55,55,117,110,105,48,53,49,67,117,110,105,49,68,52,50,117,110,105,49,68,
+50,49,87,97,99,117,116,101,87,103,114,97,118,101,87,99,105,114,99,117,109,
+102,108,101,120,87,100,105,101,114,101,115,105,115,117,110,105,49,69,56,54,
+117,110,105,49,69,56,56,117,110,105,50,67,55,50,117,110,105,50,48,65,57,117,
+110,105,48,52,52,53,117,110,105,50,49,55,57,117,110,105,50,48,57,51,117,110,
+105,48,50,69,51,117,110,105,48,51,54,70,117,110,105,49,69,56,68,117,110,105,
+49,69,56,66,117,110,105,49,68,56,68,117,110,105,48,52,70,70,117,110,105,48,
+52,70,68,117,110,105,48,52,66,51,117,110,105,50,49,55,65,117,110,105,50,49,
+55,66,99,104,105,117,110,105,49,68,54,65,117,110,105,49,68,54,49,117,110,
+105,48,52,50,53,117,110,105,50,49,54,57,117,110,105,49,69,56,67,117,110,105,
+49,69,56,65,117,110,105,48,52,70,69,117,110,105,48,52,70,67,117,110,105,48,
+52,66,50,117,110,105,50,49,54,65,117,110,105,50,49,54,66,117,110,105,48,52,
+52,51,117,110,105,48,50,66,56,117,110,105,48,52,70,51,121,103,114,97,118,
+101,121,99,105,114,99,117,109,102,108,101,120,117,110,105,48,52,53,69,117,
+110,105,49,69,70,57,117,110,105,48,50,51,51,117,110,105,48,52,69,70,117,110,
+105,48,52,70,49,117,110,105,49,69,56,70,117,110,105,49,69,57,57,117,110,105,
+49,69,70,55,117,110,105,49,69,70,53,117,110,105,48,50,52,70,117,110,105,48,
+49,66,52,117,110,105,49,69,70,70,117,110,105,48,52,65,70,117,110,105,48,52,
+66,49,117,110,105,48,50,56,69,108,97,109,98,100,97,117,110,105,48,49,57,66,
+117,110,105,48,52,52,55,117,110,105,48,52,70,53,117,110,105,48,52,66,57,117,
+110,105,48,52,66,55,117,110,105,48,52,67,67,117,110,105,48,53,50,68,117,110,
+105,48,52,65,69,117,110,105,48,50,56,70,89,103,114,97,118,101,89,99,105,114,
+99,117,109,102,108,101,120,117,110,105,49,69,70,56,117,110,105,48,50,51,50,
+117,110,105,49,69,56,69,117,110,105,49,69,70,54,117,110,105,49,69,70,52,117,
+110,105,48,50,52,69,117,110,105,48,52,66,48,117,110,105,48,49,66,51,117,110,
+105,49,69,70,69,117,110,105,48,52,50,51,117,110,105,48,52,70,50,117,110,105,
+48,52,48,69,117,110,105,48,52,69,69,117,110,105,48,52,70,48,117,110,105,48,
+52,50,55,117,110,105,48,52,70,52,117,110,105,48,52,66,56,117,110,105,48,52,
+66,54,117,110,105,48,52,67,66,117,110,105,48,53,50,67,80,115,105,117,110,
+105,49,68,50,65,117,110,105,49,68,66,66,122,97,99,117,116,101,117,110,105,
+49,69,57,49,122,100,111,116,97,99,99,101,110,116,117,110,105,49,69,57,53,
+117,110,105,49,69,57,51,117,110,105,48,50,57,48,117,110,105,49,68,66,67,117,
+110,105,49,68,56,69,117,110,105,48,49,66,54,117,110,105,49,68,55,54,117,110,
+105,48,50,57,49,117,110,105,49,68,66,68,117,110,105,48,50,50,53,117,110,105,
+50,67,54,67,117,110,105,48,50,52,48,117,110,105,65,55,54,51,117,110,105,49,
+68,50,50,90,97,99,117,116,101,117,110,105,49,69,57,48,90,100,111,116,97,99,
+99,101,110,116,117,110,105,49,69,57,52,117,110,105,49,69,57,50,117,110,105,
+48,49,66,53,117,110,105,48,50,50,52,117,110,105,50,67,54,66,117,110,105,50,
+67,55,70,117,110,105,65,55,54,50,117,110,105,48,49,65,57,117,110,105,48,50,
+57,50,117,110,105,48,52,69,49,117,110,105,49,68,66,69,117,110,105,48,49,69,
+70,117,110,105,49,68,57,65,117,110,105,48,50,57,51,117,110,105,48,49,66,65,
+117,110,105,48,49,66,57,117,110,105,65,55,50,66,117,110,105,48,50,49,68,117,
+110,105,65,55,54,66,117,110,105,48,49,66,55,117,110,105,48,52,69,48,117,110,
+105,49,68,50,51,117,110,105,48,49,69,69,117,110,105,48,49,66,56,117,110,105,
+65,55,50,65,117,110,105,48,50,49,67,117,110,105,65,55,54,65,117,110,105,48,
+50,57,52,117,110,105,48,50,67,48,117,110,105,48,50,52,50,117,110,105,48,50,
+52,49,117,110,105,48,50,65,49,117,110,105,48,50,57,53,117,110,105,48,50,67,
+49,117,110,105,48,50,69,52,117,110,105,48,50,65,50,117,110,105,48,50,57,54,
+117,110,105,48,49,66,69,117,110,105,49,68,50,52,117,110,105,49,68,50,53,117,
+110,105,49,68,53,67,117,110,105,50,49,52,70,117,110,105,50,48,65,65,117,110,
+105,50,48,66,66,117,110,105,50,48,66,67,117,110,105,50,48,56,48,117,110,105,
+50,48,55,48,117,110,105,50,48,56,49,117,110,105,50,48,56,50,117,110,105,48,
+49,66,66,117,110,105,50,49,56,57,117,110,105,50,48,56,51,117,110,105,50,48,
+56,52,117,110,105,50,48,55,52,117,110,105,65,55,50,67,117,110,105,65,55,50,
+69,117,110,105,65,55,50,68,117,110,105,65,55,50,70,117,110,105,50,48,56,53,
+117,110,105,50,48,55,53,117,110,105,48,49,66,67,117,110,105,48,49,66,68,117,
+110,105,50,48,56,54,117,110,105,50,48,55,54,117,110,105,49,69,70,68,117,110,
+105,49,69,70,67,117,110,105,50,48,56,55,117,110,105,50,48,55,55,117,110,105,
+50,48,56,56,117,110,105,50,48,55,56,117,110,105,50,48,56,57,117,110,105,50,
+48,55,57,117,110,105,65,55,54,69,117,110,105,65,55,54,70,117,110,105,65,55,
+55,48,117,110,105,50,49,53,70,117,110,105,50,49,53,50,117,110,105,50,49,53,
+53,117,110,105,50,49,53,57,117,110,105,50,49,53,48,117,110,105,50,49,53,49,
+117,110,105,50,49,53,54,117,110,105,50,49,53,55,117,110,105,50,49,53,56,117,
+110,105,50,49,53,65,117,110,105,48,49,67,51,117,110,105,65,55,49,68,117,110,
+105,65,55,49,70,117,110,105,65,55,49,69,101,120,99,108,97,109,100,98,108,
+117,110,105,65,55,56,66,117,110,105,65,55,56,67,117,110,105,48,50,70,56,117,
+110,105,65,55,56,57,117,110,105,48,50,66,66,117,110,105,48,51,49,50,113,117,
+111,116,101,114,101,118,101,114,115,101,100,117,110,105,48,50,66,68,117,110,
+105,48,51,49,52,117,110,105,48,50,66,67,117,110,105,50,48,49,70,117,110,105,
+48,50,69,69,117,110,105,48,50,68,48,117,110,105,48,50,68,49,97,110,111,116,
+101,108,101,105,97,117,110,105,50,48,50,55,117,110,105,50,50,49,57,117,110,
+105,50,48,56,68,117,110,105,50,48,55,68,117,110,105,50,48,56,69,117,110,105,
+50,48,55,69,117,110,105,50,55,69,54,117,110,105,50,55,69,55,117,110,105,50,
+51,48,56,117,110,105,50,51,49,67,117,110,105,50,51,48,57,117,110,105,50,51,
+49,68,117,110,105,50,51,48,65,117,110,105,50,51,49,69,117,110,105,50,51,48,
+66,117,110,105,50,51,49,70,117,110,105,50,51,57,66,117,110,105,50,51,57,67,
+117,110,105,50,51,57,68,117,110,105,50,51,57,69,117,110,105,50,51,57,70,117,
+110,105,50,51,65,48,117,110,105,50,51,65,49,117,110,105,50,51,65,50,117,110,
+105,50,51,65,51,117,110,105,50,51,65,52,117,110,105,50,51,65,53,117,110,105,
+50,51,65,54,117,110,105,50,51,65,55,117,110,105,50,51,65,56,117,110,105,50,
+51,65,65,117,110,105,50,51,65,57,117,110,105,50,51,65,66,117,110,105,50,51,
+65,67,117,110,105,50,51,65,68,117,110,105,48,49,67,48,117,110,105,48,49,67,
+49,117,110,105,48,49,67,50,117,110,105,50,48,49,54,117,110,105,50,50,50,53,
+117,110,105,50,50,50,54,117,110,105,50,50,51,52,117,110,105,50,50,51,53,117,
+110,105,50,50,54,50,117,110,105,50,50,56,50,117,110,105,50,50,56,54,117,110,
+105,50,50,56,52,117,110,105,50,50,56,51,117,110,105,50,50,56,55,117,110,105,
+50,50,56,53,117,110,105,48,50,67,67,117,110,105,48,50,67,56,117,110,105,48,
+51,51,55,117,110,105,48,51,51,56,117,110,105,50,48,69,53,117,110,105,50,48,
+52,49,117,110,105,50,48,49,48,117,110,105,50,48,49,49,117,110,105,48,48,65,
+68,117,110,105,50,69,51,65,117,110,105,50,69,51,66,117,110,105,50,48,49,53,
+117,110,105,48,50,68,55,117,110,105,50,48,56,66,117,110,105,50,48,55,66,117,
+110,105,48,51,50,48,117,110,105,48,51,51,53,117,110,105,48,51,51,54,117,110,
+105,48,50,67,70,117,110,105,48,51,49,55,117,110,105,48,50,67,65,97,99,117,
+116,101,99,111,109,98,109,105,110,117,116,101,117,110,105,48,50,66,57,115,
+101,99,111,110,100,117,110,105,48,50,66,65,117,110,105,48,50,70,54,117,110,
+105,48,51,48,66,117,110,105,50,48,51,52,117,110,105,50,48,53,55,117,110,105,
+48,50,67,69,117,110,105,48,51,49,54,117,110,105,48,50,70,52,117,110,105,48,
+50,67,66,103,114,97,118,101,99,111,109,98,117,110,105,50,48,51,53,117,110,
+105,50,48,51,54,117,110,105,48,50,70,53,117,110,105,48,51,48,70,117,110,105,
+50,48,51,55,117,110,105,50,48,51,56,117,110,105,48,51,50,68,117,110,105,65,
+55,56,56,117,110,105,48,51,48,50,117,110,105,48,51,50,70,117,110,105,48,51,
+49,49,117,110,105,48,51,53,50,117,110,105,50,48,52,48,117,110,105,48,51,54,
+49,117,110,105,70,69,50,48,117,110,105,70,69,50,49,117,110,105,65,57,50,69,
+117,110,105,48,51,50,69,117,110,105,48,51,48,54,117,110,105,48,51,49,48,117,
+110,105,49,68,67,66,117,110,105,50,48,51,70,117,110,105,48,51,53,67,117,110,
+105,48,51,53,68,117,110,105,49,68,67,68,117,110,105,48,50,69,67,117,110,105,
+48,51,50,67,117,110,105,48,51,48,67,117,110,105,49,68,67,55,117,110,105,49,
+68,67,52,117,110,105,49,68,67,67,117,110,105,49,68,67,53,117,110,105,49,68,
+67,54,117,110,105,49,68,67,57,117,110,105,49,68,67,56,117,110,105,48,50,70,
+55,117,110,105,48,51,51,48,117,110,105,48,51,51,52,116,105,108,100,101,99,
+111,109,98,117,110,105,48,51,52,65,115,105,109,105,108,97,114,117,110,105,
+50,48,53,51,117,110,105,48,51,52,67,117,110,105,49,68,70,68,117,110,105,48,
+51,52,66,117,110,105,48,51,54,48,117,110,105,70,69,50,50,117,110,105,70,69,
+50,51,117,110,105,48,51,51,69,117,110,105,48,51,53,66,117,110,105,48,51,53,
+57,117,110,105,48,51,53,51,117,110,105,48,50,68,70,117,110,105,48,51,51,68,
+117,110,105,48,51,50,66,117,110,105,48,51,51,67,117,110,105,48,50,67,68,117,
+110,105,48,51,51,49,117,110,105,48,50,67,57,117,110,105,48,51,48,52,117,110,
+105,48,51,53,70,117,110,105,48,51,53,69,117,110,105,48,51,51,50,117,110,105,
+48,51,48,53,117,110,100,101,114,115,99,111,114,101,100,98,108,117,110,105,
+48,51,51,51,117,110,105,48,51,52,55,117,110,105,48,51,51,70,117,110,105,48,
+50,69,68,117,110,105,65,55,56,65,117,110,105,50,48,56,67,117,110,105,50,48,
+55,67,117,110,105,50,50,53,70,101,113,117,105,118,97,108,101,110,99,101,117,
+110,105,50,50,49,51,117,110,105,48,51,50,52,117,110,105,48,51,48,56,100,111,
+116,98,101,108,111,119,99,111,109,98,117,110,105,48,51,48,55,117,110,105,
+48,51,53,56,117,110,105,48,51,50,54,117,110,105,48,51,49,51,117,110,105,48,
+51,49,53,117,110,105,48,51,49,66,117,110,105,48,50,70,51,117,110,105,48,51,
+50,53,117,110,105,48,51,48,65,117,110,105,48,51,53,65,117,110,105,48,51,49,
+67,117,110,105,48,50,68,51,117,110,105,48,50,66,70,117,110,105,48,51,53,49,
+117,110,105,48,51,51,57,117,110,105,48,50,68,50,117,110,105,48,50,66,69,117,
+110,105,48,51,53,55,117,110,105,65,55,50,52,117,110,105,65,55,50,53,117,110,
+105,65,55,50,50,117,110,105,65,55,50,51,104,111,111,107,97,98,111,118,101,
+99,111,109,98,117,110,105,48,51,50,57,117,110,105,48,51,48,68,117,110,105,
+48,51,52,56,117,110,105,48,51,48,69,117,110,105,50,48,56,65,117,110,105,48,
+51,49,70,117,110,105,48,50,68,54,117,110,105,50,48,55,65,117,110,105,48,51,
+49,69,117,110,105,48,50,68,53,117,110,105,48,51,49,68,117,110,105,48,50,68,
+52,117,110,105,48,51,49,56,117,110,105,48,51,49,57,117,110,105,48,50,69,66,
+117,110,105,48,50,69,65,117,110,105,48,51,52,57,117,110,105,48,51,49,65,117,
+110,105,65,55,49,55,117,110,105,65,55,49,56,117,110,105,65,55,49,57,117,110,
+105,65,55,49,65,117,110,105,65,55,50,48,117,110,105,65,55,50,49,117,110,105,
+48,50,70,69,117,110,105,48,50,70,68,117,110,105,48,50,65,68,117,110,105,48,
+51,50,55,117,110,105,48,51,50,56,117,110,105,49,68,67,50,117,110,105,48,51,
+50,65,117,110,105,48,51,52,54,117,110,105,48,51,51,65,117,110,105,50,52,50,
+51,117,110,105,48,51,51,66,117,110,105,48,50,68,69,117,110,105,65,55,48,56,
+117,110,105,65,55,48,57,117,110,105,65,55,48,65,117,110,105,65,55,48,66,117,
+110,105,65,55,48,67,117,110,105,48,50,69,53,117,110,105,48,50,69,54,117,110,
+105,48,50,69,55,117,110,105,48,50,69,56,117,110,105,48,50,69,57,117,110,105,
+65,55,48,68,117,110,105,65,55,48,69,117,110,105,65,55,48,70,117,110,105,65,
+55,49,48,117,110,105,65,55,49,49,117,110,105,65,55,49,50,117,110,105,65,55,
+49,51,117,110,105,65,55,49,52,117,110,105,65,55,49,53,117,110,105,65,55,49,
+54,117,110,105,50,55,52,68,117,110,105,50,48,50,51,97,114,114,111,119,100,
+111,119,110,117,110,105,50,49,56,54,117,110,105,65,55,49,67,97,114,114,111,
+119,117,112,117,110,105,65,55,49,66,117,110,105,48,51,52,69,97,114,114,111,
+119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,101,97,114,
+114,111,119,108,101,102,116,117,110,105,50,48,69,69,117,110,105,50,48,69,
+68,117,110,105,48,50,70,70,97,114,114,111,119,114,105,103,104,116,117,110,
+105,50,48,69,70,117,110,105,50,48,69,67,117,110,105,48,51,54,50,97,114,114,
+111,119,98,111,116,104,117,110,105,48,51,52,68,117,110,105,50,49,57,65,117,
+110,105,50,49,57,66,97,114,114,111,119,100,98,108,100,111,119,110,97,114,
+114,111,119,100,98,108,117,112,117,110,105,50,49,68,53,97,114,114,111,119,
+100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,104,
+116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,105,50,49,57,54,
+117,110,105,50,49,57,56,117,110,105,50,49,57,55,117,110,105,50,49,57,57,117,
+110,105,50,55,49,51,117,110,105,48,50,67,53,117,110,105,48,50,69,70,117,110,
+105,48,50,67,52,117,110,105,48,50,70,48,117,110,105,48,50,67,50,117,110,105,
+49,68,70,69,117,110,105,48,51,53,52,117,110,105,48,50,70,49,97,110,103,108,
+101,108,101,102,116,117,110,105,48,50,67,51,117,110,105,48,51,53,48,117,110,
+105,48,51,53,53,117,110,105,48,50,70,50,97,110,103,108,101,114,105,103,104,
+116,117,110,105,48,51,53,54,117,110,105,49,68,70,70,117,110,105,50,54,52,
+48,117,110,105,50,54,52,50,117,110,105,50,54,54,68,117,110,105,50,54,54,70,
+117,110,105,65,55,48,50,117,110,105,65,55,48,48,117,110,105,65,55,48,52,117,
+110,105,65,55,48,54,117,110,105,65,55,48,51,117,110,105,65,55,48,49,117,110,
+105,65,55,48,53,117,110,105,65,55,48,55,117,110,105,48,51,52,70,117,110,105,
+50,48,54,49,117,110,105,50,48,54,51,117,110,105,50,48,54,50,117,110,105,50,
+48,50,65,117,110,105,50,48,48,69,117,110,105,50,48,50,68,117,110,105,50,48,
+50,67,117,110,105,50,48,50,66,117,110,105,50,48,48,70,117,110,105,50,48,50,
+69,117,110,105,50,48,54,48,117,110,105,50,48,48,68,117,110,105,50,48,48,67,
+117,110,105,50,48,48,66,117,110,105,50,48,54,68,117,110,105,50,48,54,66,117,
+110,105,50,48,54,67,117,110,105,50,48,54,65,117,110,105,50,48,50,56,117,110,
+105,50,48,54,69,117,110,105,50,48,54,70,117,110,105,50,48,50,57,117,110,105,
+50,48,48,49,117,110,105,50,48,48,51,117,110,105,50,48,50,70,117,110,105,50,
+48,48,56,117,110,105,50,48,48,54,117,110,105,50,48,48,52,117,110,105,50,48,
+48,48,117,110,105,50,48,48,50,117,110,105,50,48,48,53,117,110,105,50,48,48,
+55,117,110,105,50,48,48,57,117,110,105,50,48,48,65,117,110,105,70,70,70,68,
+117,110,105,48,50,70,57,117,110,105,48,50,70,66,117,110,105,48,50,70,65,117,
+110,105,48,50,70,67,88,105,67,111,112,121,114,105,103,104,116,32,40,99,41,
+32,83,73,76,32,73,110,116,101,114,110,97,116,105,111,110,97,108,44,32,49,
+57,57,55,45,50,48,49,52,46,67,104,97,114,105,115,32,83,73,76,32,66,111,108,
+100,67,104,97,114,105,115,32,83,73,76,2,163,2,0,1,0,27,0,101,0,108,0,114,
+0,121,0,167,0,195,0,207,0,237,1,122,1,134,1,184,2,0,2,22,2,84,2,96,2,99,2,
+173,2,211,3,179,3,200,3,241,3,247,4,17,4,23,4,75,4,111,4,138,4,179,5,84,5,
+93,5,148,5,157,5,165,5,230,6,17,6,44,6,140,6,144,7,23,7,31,7,34,7,38,7,76,
+7,141,7,145,7,153,7,161,7,171,7,214,8,41,8,97,8,144,8,199,9,33,9,47,9,64,
+9,67,9,81,9,128,9,153,9,201,10,77,10,105,10,132,10,224,11,75,11,206,12,80,
+12,207,12,230,13,7,13,127,13,137,13,198,14,60,14,158,14,244,15,71,15,131,
+15,162,15,177,15,211,16,68,16,78,16,170,16,254,17,53,17,148,18,0,18,103,18,
+151,18,221,19,61,19,159,20,7,20,75,20,107,20,125,20,209,20,235,20,248,21,
+41,21,136,21,184,21,224,21,246,22,38,22,87,22,148,22,197,22,220,22,223,23,
+55,23,59,23,68,23,110,23,113,23,201,24,22,24,77,24,162,24,186,24,194,24,206,
+24,216,24,220,25,25,25,101,25,176,25,219,26,37,26,53,26,56,26,85,26,114,26,
+157,26,195,26,215,26,252,27,24,27,101,27,109,27,114,27,133,27,138,27,209,
+27,226,28,45,28,71,28,93,28,167,28,182,28,232,28,236,28,251,29,0,29,5,29,
+28,29,64,29,89,29,92,29,121,29,138,29,172,29,217,29,234,30,4,30,29,30,45,
+30,110,30,165,30,190,30,208,30,243,31,52,31,57,31,115,31,127,31,189,31,250,
+32,33,32,54,32,72,32,82,32,109,32,141,32,172,32,201,32,207,32,239,33,30,33,
+64,33,70,33,93,33,145,33,154,33,188,33,204,33,234,34,26,34,56,34,107,34,137,
+34,186,34,236,35,30,35,80,35,85,35,112,35,159,35,206,35,214,35,233,35,242,
+36,19,36,65,36,82,36,129,36,170,36,197,36,243,36,250,37,38,37,63,37,88,37,
+97,37,110,37,155,37,200,37,213,37,226,38,14,38,47,38,91,38,128,38,170,38,
+179,38,222,38,254,39,20,39,62,39,91,39,106,39,148,39,167,39,176,39,209,39,
+234,39,239,40,22,40,61,40,82,40,122,40,142,40,182,40,204,40,242,40,253,41,
+7,41,46,41,70,41,109,41,146,41,184,41,215,41,251,42,7,42,44,42,52,42,67,42,
+103,42,139,42,159,42,179,42,188,42,195,42,230,43,4,43,39,43,64,43,91,43,102,
+43,107,43,121,43,130,43,163,43,169,43,200,43,232,44,8,44,40,44,72,44,102,
+44,106,44,124,44,142,44,153,44,184,44,215,44,220,44,251,45,3,45,32,45,35,
+45,41,45,71,45,101,45,131,45,161,45,191,45,214,45,242,45,249,46,10,46,31,
+46,60,46,69,46,74,46,101,46,110,46,138,46,163,46,191,46,219,46,233,46,242,
+46,253,47,9,47,14,47,26,47,36,47,44,47,49,47,76,47,103,47,130,47,148,47,159,
+47,186,47,213,47,240,47,255,48,24,48,43,48,69,48,95,48,121,48,147,48,173,
+48,199,48,225,48,243,49,13,49,37,49,52,49,67,49,82,49,92,49,97,49,111,49,
+128,49,153,49,178,49,187,49,212,49,237,50,6,50,31,50,56,50,74,50,99,50,116,
+50,127,50,138,50,158,50,177,50,201,50,225,50,249,51,9,51,33,51,41,51,48,51,
+69,51,93,51,115,51,129,51,136,51,144,51,167,51,190,51,213,51,236,52,3,52,
+26,52,49,52,65,52,88,52,107,52,119,52,141,52,163,52,170,52,179,52,201,52,
+218,52,238,52,251,53,8,53,21,53,27,53,34,53,55,53,61,53,82,53,103,53,124,
+53,145,53,164,53,168,53,188,53,208,53,228,53,248,54,12,54,32,54,52,54,72,
+54,90,54,108,54,120,54,132,54,144,54,151,54,163,54,168,54,180,54,188,54,207,
+54,226,54,245,55,8,55,13,55,32,55,51,55,57,55,76,55,83,55,91,55,110,55,129,
+55,148,55,165,55,175,55,184,55,202,55,220,55,238,56,0,56,18,56,36,56,49,56,
+67,56,85,56,103,56,121,56,139,56,157,56,168,56,179,56,190,56,207,56,224,56,
+230,56,247,57,8,57,25,57,35,57,52,57,69,57,86,57,103,57,120,57,132,57,137,
+57,152,57,167,57,172,57,188,57,204,57,220,57,236,57,252,58,12,58,28,58,44,
+58,60,58,76,58,92,58,108,58,124,58,140,58,156,58,163,58,173,58,183,58,193,
+58,203,58,213,58,223,58,231,58,239,58,247,58,254,59,13,59,28,59,43,59,58,
+59,73,59,88,59,103,59,118,59,133,59,148,59,163,59,178,59,193,59,206,59,211,
+59,225,59,239,59,253,60,11,60,25,60,39,60,53,60,67,60,81,60,95,60,109,60,
+123,60,137,60,151,60,165,60,169,60,181,60,190,60,199,60,208,60,217,60,226,
+60,235,60,244,60,253,61,3,61,9,61,19,61,32,61,45,61,58,61,71,61,84,61,97,
+61,110,61,123,61,136,61,149,61,162,61,175,61,188,61,194,61,207,61,215,61,
+224,61,231,61,238,61,243,61,255,62,11,62,23,62,35,62,47,62,59,62,71,62,83,
+62,95,62,107,62,119,62,131,62,143,62,155,62,167,62,179,62,191,62,203,62,215,
+62,227,62,237,62,247,62,255,63,7,63,15,63,23,63,31,63,39,63,47,63,55,63,63,
+63,71,63,77,63,88,63,99,63,110,63,121,63,132,63,143,63,154,63,165,63,176,
+63,187,63,198,63,209,63,220,63,231,63,242,63,253,64,8,64,19,64,30,64,41,64,
+52,64,61,64,70,64,79,64,88,64,97,64,102,64,107,64,120,64,124,64,138,64,154,
+64,167,64,183,64,189,64,204,64,214,64,221,64,234,64,240,64,249,65,8,65,25,
+65,35,65,47,65,65,65,87,65,96,65,116,65,148,65,195,65,227,65,230,66,18,66,
+61,66,69,66,72,66,99,66,155,66,171,66,180,66,214,67,7,67,96,250,222,22,235,
+7,49,246,29,248,162,248,198,29,112,247,82,21,139,39,94,51,248,114,29,30,11,
+28,5,160,28,4,246,21,243,252,107,35,7,247,8,129,5,164,136,159,123,112,26,
+253,90,7,251,113,51,251,38,251,107,251,117,33,247,3,247,148,30,249,90,248,
+86,29,252,242,35,7,247,3,129,5,163,136,162,123,112,26,253,74,247,225,29,249,
+74,7,166,162,155,161,142,30,11,28,5,115,22,163,29,11,250,144,235,170,29,11,
+28,4,199,22,198,29,11,249,66,22,243,7,251,19,150,5,117,141,114,247,117,29,
+164,155,161,142,30,247,19,149,5,243,253,19,35,7,247,19,129,5,164,136,159,
+123,112,26,254,178,248,88,29,7,11,137,29,254,178,247,5,29,252,201,250,119,
+21,251,125,251,67,100,251,21,129,117,141,141,104,247,80,29,11,249,195,250,
+93,164,29,194,247,199,29,6,11,250,146,248,37,21,247,118,251,78,227,251,62,
+225,30,143,29,252,11,6,139,247,78,61,247,105,248,78,29,30,11,28,6,170,28,
+5,211,21,247,93,71,243,251,80,51,39,69,33,65,218,76,139,30,247,89,6,251,152,
+251,9,44,251,31,80,30,247,37,7,166,160,155,163,142,30,225,149,5,243,252,70,
+35,7,237,129,5,164,136,159,123,112,26,253,90,7,251,113,53,251,38,251,105,
+251,119,35,247,3,247,148,30,249,90,7,166,159,155,164,142,30,247,2,149,5,243,
+252,238,35,7,247,3,129,5,163,136,162,123,112,26,253,74,7,251,252,247,56,251,
+85,247,246,248,17,247,72,247,42,248,39,30,248,54,7,247,183,247,21,247,25,
+247,21,247,187,26,11,210,29,253,69,204,29,248,210,247,216,29,11,21,227,73,
+209,35,45,71,77,96,115,151,104,182,162,161,151,139,30,164,217,5,151,147,153,
+143,156,27,170,171,94,78,71,86,107,78,122,31,251,52,202,247,11,7,188,160,
+246,184,237,26,14,28,6,127,28,5,150,21,247,92,92,246,251,81,51,37,67,33,65,
+221,75,139,30,247,76,6,251,4,88,34,251,23,80,30,247,52,251,15,251,84,241,
+251,130,27,247,156,29,247,27,106,247,17,79,247,1,31,247,62,208,247,3,247,
+36,247,60,26,252,154,253,138,103,29,11,247,43,29,250,178,80,29,252,131,7,
+112,119,123,114,137,30,33,128,5,35,7,11,28,5,117,28,4,143,21,247,25,67,207,
+39,67,53,106,39,82,184,81,139,30,247,56,6,251,11,34,58,53,104,30,247,31,223,
+29,248,48,235,7,49,145,5,114,141,116,160,164,26,249,27,7,247,77,194,247,19,
+247,72,247,27,26,11,225,29,250,213,240,29,254,178,248,60,29,11,68,29,14,28,
+5,139,248,211,21,247,142,29,252,35,247,162,29,161,201,128,115,202,31,156,
+133,156,116,142,125,180,251,113,24,247,52,247,246,6,139,251,85,219,251,160,
+252,60,251,201,251,166,252,79,252,72,247,199,251,179,248,46,247,166,247,93,
+235,139,30,248,93,7,166,161,155,164,141,30,11,249,140,184,21,241,247,198,
+29,247,155,251,34,7,251,2,251,110,251,50,45,5,57,247,27,253,21,7,251,64,205,
+59,247,74,248,104,29,30,11,28,7,168,28,5,0,21,207,32,198,33,32,64,110,92,
+92,30,251,50,251,47,188,251,54,35,251,50,124,119,51,53,72,120,8,248,119,7,
+166,159,155,164,142,30,243,149,5,243,252,230,35,7,246,129,5,161,136,162,123,
+112,26,252,119,7,71,158,49,225,125,159,34,247,50,188,247,54,251,47,247,47,
+8,186,90,63,168,32,27,33,32,80,71,92,170,92,215,77,31,247,99,223,221,37,139,
+251,33,194,251,7,25,176,57,188,67,200,105,55,122,74,98,110,94,251,172,252,
+80,24,251,26,128,5,35,248,50,213,7,247,197,248,105,156,161,204,156,160,149,
+25,252,68,7,112,116,123,117,137,30,32,128,5,35,248,230,243,7,35,247,70,29,
+248,68,7,159,129,203,122,155,117,247,197,252,105,24,65,248,52,243,7,251,27,
+150,251,173,248,80,112,184,74,180,55,156,25,198,173,189,211,177,221,193,247,
+7,139,247,33,223,241,247,96,55,24,217,201,168,186,186,26,11,21,251,172,247,
+202,5,190,92,112,153,84,27,51,110,80,90,112,162,248,128,29,28,4,170,22,235,
+7,53,246,29,28,5,86,247,44,29,251,222,7,139,251,5,164,247,209,29,247,36,247,
+19,156,170,30,251,11,7,247,95,247,144,29,11,250,89,229,169,29,11,28,4,205,
+188,21,247,251,226,29,247,240,6,200,251,83,53,164,251,47,247,242,29,248,76,
+29,11,249,3,22,194,29,11,28,5,195,248,179,29,252,230,35,7,243,129,5,164,136,
+159,123,112,26,78,7,252,160,253,9,5,249,70,133,29,235,7,248,160,249,9,5,253,
+105,7,112,119,123,114,137,30,35,128,5,35,7,11,21,235,68,217,34,68,71,100,
+59,107,153,106,166,114,30,247,21,6,74,73,75,60,117,30,57,7,247,49,169,247,
+25,238,247,31,26,14,28,5,74,22,243,230,29,252,236,35,7,247,21,120,248,19,
+252,232,252,43,252,170,247,39,29,7,11,21,251,3,6,86,133,98,96,96,251,13,96,
+235,251,0,27,251,29,65,248,116,29,178,182,184,247,13,182,41,245,27,247,31,
+213,247,5,247,33,174,31,11,28,5,233,248,189,21,247,138,37,247,119,251,170,
+251,77,37,251,3,139,139,49,247,3,251,107,251,93,251,123,51,251,44,80,159,
+121,219,30,247,76,247,88,6,139,186,147,164,247,23,198,72,251,38,30,82,7,252,
+68,37,251,49,73,251,115,26,251,29,216,251,23,247,77,247,101,247,78,247,41,
+139,139,247,33,251,41,247,158,247,118,247,47,247,10,139,30,247,54,7,139,251,
+21,251,2,251,53,251,103,47,247,14,139,30,247,128,248,229,7,139,141,166,153,
+26,253,238,251,240,21,139,43,84,59,53,94,210,221,237,184,201,247,154,208,
+30,248,214,234,21,251,214,6,206,141,247,111,247,64,247,30,149,251,53,57,30,
+11,249,5,22,235,247,52,29,7,11,21,188,110,198,51,84,110,125,88,94,30,251,
+173,251,202,5,247,36,6,247,221,247,73,5,170,155,162,182,166,26,252,77,22,
+188,248,117,29,251,202,5,247,35,6,247,222,247,73,5,170,155,161,182,166,26,
+14,68,29,247,44,249,47,112,29,14,28,4,190,250,123,201,29,11,247,7,29,254,
+178,7,247,181,29,252,17,249,5,21,251,37,78,251,5,251,126,131,96,141,139,30,
+248,123,7,144,211,136,139,154,27,247,111,182,251,7,251,13,31,213,253,19,21,
+251,89,251,7,68,251,101,127,55,143,139,30,248,158,248,46,29,11,21,75,245,
+5,131,127,88,96,112,27,72,104,186,198,219,192,205,215,196,31,251,21,6,77,
+96,35,47,251,13,26,251,0,237,75,247,21,201,247,25,203,139,30,14,21,251,119,
+247,243,5,251,134,6,251,119,251,243,5,247,62,6,247,70,247,87,247,70,251,87,
+5,11,28,7,4,22,243,7,251,9,150,5,115,141,118,247,117,29,160,155,163,142,30,
+247,9,149,5,243,252,218,82,7,251,178,254,1,251,181,250,1,5,196,252,224,35,
+7,247,7,247,247,29,251,7,128,5,35,248,109,243,7,251,2,247,105,29,250,191,
+7,248,39,28,251,53,5,247,50,6,248,47,28,4,211,5,254,199,7,112,117,123,116,
+137,30,39,128,5,35,7,11,251,216,73,29,178,29,252,146,43,7,213,247,22,29,251,
+164,7,81,157,84,155,116,172,72,239,147,230,88,221,8,202,98,63,182,61,27,251,
+0,34,80,71,92,158,102,219,76,31,247,74,220,170,76,139,63,180,78,25,163,100,
+158,100,186,100,92,125,118,118,112,102,251,127,251,232,24,251,7,133,5,43,
+247,249,207,7,186,210,247,35,247,99,139,26,153,149,209,174,168,27,251,137,
+248,40,29,65,133,5,43,248,146,235,7,65,145,5,115,141,118,160,164,26,247,137,
+7,174,204,104,125,150,31,139,247,31,251,99,186,68,30,71,7,11,28,4,147,248,
+164,130,29,11,90,29,14,251,66,134,29,7,247,70,96,247,70,251,128,251,68,251,
+74,251,17,139,30,247,17,32,7,251,201,35,5,55,247,33,253,66,247,10,29,249,
+39,248,87,29,11,28,5,145,28,4,246,21,243,252,94,35,7,247,2,124,170,135,141,
+117,135,122,25,251,205,254,17,251,216,250,15,133,156,141,163,163,143,25,247,
+7,154,5,243,252,220,35,7,247,24,120,248,115,28,250,252,5,247,86,6,248,107,
+28,5,6,5,11,247,106,29,14,249,240,28,5,72,157,29,11,28,4,117,250,27,222,29,
+11,7,248,105,29,245,149,5,174,29,11,43,7,233,247,22,29,251,33,129,252,11,
+81,251,15,30,121,131,117,100,120,27,251,11,247,19,5,251,31,104,42,76,59,201,
+73,231,247,11,247,25,248,71,29,11,247,202,29,247,246,247,60,29,252,228,205,
+29,248,151,7,248,102,247,38,247,31,247,171,31,249,23,252,54,21,243,7,251,
+19,150,5,114,141,117,247,117,29,161,155,164,142,30,247,19,149,5,243,253,19,
+35,7,247,19,129,5,161,136,248,81,29,116,123,117,137,30,251,19,128,5,35,7,
+251,212,248,54,247,85,29,11,21,204,69,205,61,69,66,69,80,30,247,0,51,5,122,
+127,67,80,53,27,39,86,192,162,122,31,247,1,225,5,202,61,207,71,68,65,77,68,
+251,19,247,52,251,15,247,84,247,87,247,50,247,23,247,13,30,14,250,238,22,
+248,65,29,123,27,252,126,6,249,81,250,250,5,247,13,254,117,252,9,247,41,7,
+176,247,116,5,155,141,149,147,156,27,248,88,6,253,82,254,252,5,251,13,7,11,
+21,247,36,251,9,247,7,251,35,251,33,251,9,251,7,251,36,251,35,247,9,251,7,
+247,33,247,35,247,9,247,7,247,35,30,251,23,22,68,82,81,67,69,80,197,210,211,
+198,197,209,211,196,81,67,30,11,250,119,247,193,21,247,91,251,47,224,29,235,
+243,247,89,31,248,202,251,193,21,235,7,55,246,29,249,80,247,113,29,252,169,
+43,7,223,133,5,166,137,157,118,115,26,253,80,7,114,121,118,112,137,30,55,
+133,5,43,7,251,199,247,193,21,39,125,42,251,71,30,125,94,141,129,27,248,42,
+7,159,197,141,153,27,247,25,176,51,251,17,31,11,247,236,251,33,7,248,150,
+29,251,244,206,29,7,11,235,7,65,145,5,115,141,118,160,164,26,248,197,98,29,
+7,14,183,29,14,21,247,240,29,60,198,79,219,219,199,203,214,30,11,28,5,96,
+22,243,7,251,45,150,251,224,248,101,108,182,80,165,63,152,25,202,173,205,
+211,239,29,248,123,133,29,248,72,7,180,131,188,122,159,111,247,228,252,105,
+24,65,7,11,250,203,248,23,21,107,29,68,247,58,227,122,247,47,27,248,60,247,
+62,247,56,247,148,31,11,27,247,60,205,251,58,251,140,251,196,251,18,251,2,
+251,71,107,70,145,151,89,31,158,56,5,122,212,204,126,208,27,247,142,247,153,
+247,60,248,7,247,221,251,106,247,58,251,175,11,247,174,29,213,145,5,235,252,
+138,43,7,203,133,5,163,137,162,118,115,26,253,33,7,139,86,106,251,5,251,21,
+92,231,239,30,248,130,7,163,159,160,164,141,30,203,145,5,235,252,128,43,7,
+200,133,5,164,137,162,118,115,26,253,33,7,139,63,106,51,251,30,99,231,239,
+30,248,130,7,163,161,160,164,141,30,202,145,5,235,252,140,43,7,215,133,5,
+164,137,159,118,115,26,252,197,7,43,174,251,108,247,140,247,49,247,99,247,
+30,139,30,96,176,194,44,247,48,27,247,52,247,68,247,15,139,31,11,28,4,168,
+22,248,199,29,235,252,179,43,7,233,133,5,164,137,159,118,115,26,253,80,7,
+181,29,7,14,21,197,7,90,143,5,123,127,151,155,31,247,228,122,29,251,187,7,
+123,125,127,123,30,98,248,166,29,247,160,29,252,220,35,7,233,129,5,164,134,
+159,125,112,26,254,172,7,112,119,121,114,30,251,180,6,116,117,157,166,31,
+250,172,7,166,161,153,162,144,30,235,149,5,243,252,210,35,7,234,129,5,163,
+134,160,125,112,26,254,172,7,112,118,121,115,30,251,181,6,114,119,157,166,
+31,250,172,7,166,161,153,162,144,30,233,149,5,243,252,218,205,29,11,7,235,
+105,247,109,251,140,251,52,251,97,251,31,139,30,184,102,84,233,251,48,27,
+251,51,251,68,251,17,139,31,247,17,36,7,251,193,35,5,55,247,23,253,66,247,
+148,29,249,33,7,139,192,172,247,4,247,19,189,46,39,30,252,129,7,114,118,118,
+114,137,30,76,133,5,43,248,128,235,7,75,246,29,249,33,7,139,215,172,227,247,
+27,182,46,39,30,252,129,7,114,116,118,115,137,30,75,133,5,43,11,134,22,133,
+165,230,120,192,27,247,78,229,239,247,26,182,31,247,52,191,188,198,231,27,
+190,251,193,6,127,133,126,121,30,38,133,5,43,248,136,235,7,110,141,72,143,
+139,26,120,131,152,151,31,249,123,7,158,149,143,156,141,30,235,147,5,235,
+252,181,7,251,9,251,135,105,251,112,251,64,247,31,78,235,116,31,90,128,107,
+115,110,111,63,66,136,251,24,87,72,8,90,101,83,132,36,27,248,101,249,1,21,
+247,4,215,197,247,43,30,180,251,242,6,119,124,137,131,27,39,251,17,165,247,
+48,31,14,248,117,247,191,21,86,247,3,114,247,33,247,31,26,247,167,238,247,
+197,247,176,219,207,108,84,192,30,215,251,3,21,192,33,168,251,36,251,43,26,
+251,156,34,251,204,251,166,53,69,174,196,86,30,249,115,28,5,5,21,33,198,251,
+1,251,83,5,180,49,35,164,251,7,27,252,72,251,148,251,199,252,40,251,172,247,
+0,251,99,247,68,251,13,31,251,8,251,97,243,78,247,11,247,99,5,98,233,247,
+1,118,247,8,27,248,48,247,169,247,214,248,27,247,140,251,1,247,111,251,76,
+247,25,31,11,28,4,137,248,96,21,248,112,253,114,247,32,247,75,26,232,220,
+185,221,192,184,120,97,199,30,187,251,54,5,127,158,198,135,158,27,231,195,
+205,195,239,251,27,247,27,251,201,251,118,251,68,33,251,80,251,20,247,68,
+41,247,63,251,11,31,251,127,66,251,133,251,22,251,147,26,251,234,247,179,
+37,247,161,247,137,247,186,247,36,247,233,30,251,199,125,21,251,107,53,251,
+33,251,54,251,45,58,247,19,247,92,247,77,247,27,247,24,247,24,209,30,247,
+11,44,235,251,5,251,42,26,14,128,29,247,115,247,23,251,117,247,11,7,247,78,
+163,205,180,200,30,247,97,251,82,11,21,251,156,34,251,204,251,166,251,144,
+251,3,247,195,247,183,247,167,238,247,197,247,176,247,130,247,13,251,169,
+251,213,30,11,21,247,53,100,247,37,251,63,251,67,59,251,90,251,49,30,251,
+71,7,73,186,92,245,214,26,192,133,247,42,217,174,175,115,139,148,140,247,
+10,36,251,54,85,251,25,251,65,251,55,247,22,251,14,247,50,109,30,251,64,7,
+122,126,130,122,138,30,73,135,5,80,248,5,198,7,73,143,5,122,140,126,148,156,
+26,247,63,7,247,63,169,247,9,247,22,247,48,26,251,69,22,62,93,35,74,92,30,
+247,71,7,247,0,158,247,36,177,185,147,251,45,89,30,14,248,21,29,186,178,158,
+190,162,29,11,248,10,29,249,12,247,146,29,251,148,252,2,247,148,7,156,152,
+148,155,141,30,209,145,5,201,252,24,77,7,208,247,12,29,70,132,5,77,248,24,
+201,7,69,146,5,123,140,126,149,155,26,247,189,248,2,251,189,248,109,29,7,
+14,247,76,251,41,247,17,251,105,168,30,247,115,217,225,247,29,247,11,26,247,
+95,251,91,247,37,251,182,251,52,38,108,51,251,72,30,251,209,247,50,7,180,
+247,84,141,147,166,182,147,148,25,159,157,172,178,245,27,223,247,54,74,251,
+79,251,72,251,43,61,251,17,124,115,141,143,84,31,251,45,7,139,237,157,194,
+211,247,95,104,251,109,251,82,251,48,251,9,251,42,115,102,145,153,98,30,65,
+166,109,168,132,172,96,247,84,24,251,47,251,222,6,11,235,7,55,246,29,249,
+80,247,113,29,252,157,43,7,213,133,5,164,137,159,118,115,26,102,7,252,41,
+252,84,5,248,121,7,163,159,160,164,141,30,213,145,5,235,252,159,43,7,223,
+133,5,164,137,159,118,115,26,253,80,7,114,119,118,114,137,30,55,133,5,43,
+248,159,235,7,65,246,29,177,7,248,41,248,77,5,252,115,7,114,119,118,114,137,
+30,65,133,5,43,7,11,28,5,127,251,222,21,247,1,7,118,49,79,135,99,27,251,42,
+251,25,221,247,40,143,31,247,218,206,247,103,247,181,247,232,26,248,33,251,
+173,247,222,252,62,252,72,251,148,251,199,252,40,252,41,247,119,251,144,247,
+222,80,30,251,108,141,247,7,251,33,247,186,27,247,3,247,3,154,171,247,33,
+31,251,154,250,126,103,29,14,21,75,98,162,178,117,31,247,20,247,130,5,172,
+102,99,158,86,27,40,58,37,251,8,251,18,199,251,15,247,167,31,138,132,139,
+132,132,26,251,176,247,66,251,120,247,240,248,135,29,30,247,75,29,251,157,
+251,79,251,60,251,125,89,30,249,27,22,252,5,6,247,21,189,247,43,247,43,247,
+13,186,35,251,23,30,14,186,77,182,55,53,61,67,139,30,251,119,252,137,5,247,
+60,6,247,240,248,64,5,149,151,150,157,164,26,248,56,22,186,77,182,55,53,61,
+67,139,30,251,119,252,137,5,247,60,6,247,240,248,64,5,149,151,150,157,164,
+26,11,21,188,108,198,51,84,112,125,88,92,30,251,172,251,202,5,247,35,6,247,
+224,247,73,5,167,155,164,182,166,26,11,21,250,128,251,5,7,251,39,43,5,198,
+67,49,131,29,7,114,119,118,114,137,30,55,133,5,43,248,156,235,7,68,246,29,
+249,39,7,139,247,2,166,221,247,44,159,251,28,72,30,11,247,132,21,247,72,251,
+119,155,106,137,30,176,143,247,80,176,247,50,26,247,37,251,43,203,251,38,
+251,58,251,25,69,37,77,188,113,197,159,164,141,153,163,30,247,44,7,139,176,
+149,166,235,207,75,61,251,10,40,106,41,127,128,137,141,123,30,47,7,139,186,
+145,178,247,17,194,67,61,43,64,70,46,105,112,147,147,110,30,96,247,29,5,147,
+125,121,145,116,27,96,86,121,71,58,239,63,247,64,247,91,247,70,229,247,52,
+31,11,28,4,117,22,235,124,29,43,7,11,251,6,150,5,114,141,118,155,166,26,248,
+185,7,247,115,251,59,231,251,83,61,251,19,92,94,37,30,247,174,7,248,105,29,
+247,7,149,5,243,252,249,35,7,247,7,129,5,164,136,159,123,112,26,254,178,247,
+193,29,248,238,247,61,29,248,230,7,149,155,247,15,215,186,27,246,219,102,
+251,25,31,252,146,7,112,116,123,117,137,30,32,128,5,35,11,28,5,201,22,235,
+7,65,246,29,249,80,7,163,159,160,164,141,30,213,145,5,235,252,77,74,7,251,
+160,253,38,251,168,249,44,5,198,252,66,247,153,29,248,31,235,7,63,145,5,114,
+141,121,160,164,26,248,193,7,247,189,253,87,5,247,70,6,247,165,249,39,5,252,
+145,7,114,118,118,114,137,30,66,133,5,43,11,21,251,33,251,9,251,9,251,35,
+251,33,247,9,251,7,247,33,247,35,247,9,247,7,247,35,247,33,251,9,247,9,251,
+35,31,251,21,4,211,196,80,67,69,82,82,67,69,80,196,211,209,198,198,209,31,
+14,21,247,4,73,209,59,178,30,201,200,176,219,209,26,247,66,251,64,247,19,
+251,99,248,31,29,30,247,60,7,149,148,208,149,174,27,217,182,41,57,251,31,
+86,87,251,44,31,41,7,194,137,5,247,50,135,170,80,63,26,51,100,45,251,15,251,
+1,251,8,184,247,33,251,46,30,251,54,7,251,19,247,27,247,23,106,247,3,27,247,
+154,247,54,240,247,107,31,14,28,4,223,249,70,21,248,46,251,131,247,199,252,
+124,251,41,251,19,112,90,251,60,30,251,215,247,49,7,170,247,72,143,159,154,
+160,151,145,25,151,166,237,172,237,27,247,105,247,89,251,39,252,3,159,31,
+252,174,251,23,248,174,6,252,5,117,251,75,251,64,251,143,27,63,40,160,141,
+133,31,123,147,125,151,137,156,89,247,117,24,251,45,251,226,6,139,247,113,
+61,247,117,248,161,247,92,248,9,247,242,30,11,7,199,116,247,21,251,54,37,
+251,25,55,139,30,165,114,104,197,37,27,35,251,5,63,139,31,213,71,7,251,88,
+77,5,90,225,252,48,7,123,124,127,125,30,90,135,5,81,247,217,197,7,99,143,
+5,122,127,151,155,31,248,28,7,139,172,159,212,221,172,84,77,30,251,187,7,
+123,125,127,122,30,98,135,5,81,247,214,197,7,98,248,137,29,248,28,7,139,188,
+159,197,227,165,84,77,30,11,28,4,223,250,220,21,247,21,251,76,247,183,247,
+44,29,35,251,189,251,21,247,189,49,248,185,29,248,39,235,7,53,246,29,250,
+70,7,251,164,254,17,21,247,200,29,108,139,30,11,7,65,246,29,249,80,7,163,
+159,160,164,141,30,213,145,5,235,252,138,43,7,205,247,22,29,251,214,7,115,
+87,82,122,94,27,251,9,119,172,221,31,247,140,247,147,29,251,167,7,251,51,
+247,62,75,247,52,198,242,162,170,213,30,251,148,248,40,29,65,133,5,11,21,
+247,54,7,251,33,251,45,251,7,94,251,1,27,251,14,100,233,227,215,169,198,247,
+48,143,31,248,123,29,221,180,237,218,174,209,129,129,147,31,251,60,7,139,
+178,73,225,211,200,203,217,247,49,251,64,215,251,84,251,99,251,64,251,19,
+251,66,69,176,59,200,78,30,59,100,74,69,251,4,26,251,107,247,53,38,247,154,
+247,1,247,25,172,247,19,247,25,30,14,249,222,21,247,74,251,117,155,104,137,
+30,176,143,247,82,176,247,48,26,247,39,251,43,201,251,38,251,60,251,23,69,
+37,79,188,111,195,161,164,141,153,163,30,247,44,7,139,176,149,164,237,205,
+75,62,251,9,40,104,41,127,128,248,153,29,247,15,196,67,62,42,64,70,46,103,
+114,147,147,110,30,96,247,31,5,145,125,121,146,114,27,98,84,122,70,59,239,
+61,247,66,11,250,76,248,134,21,247,180,251,82,247,130,252,1,251,4,44,119,
+102,251,16,30,251,136,247,37,7,161,247,23,142,155,149,152,147,143,25,149,
+159,207,160,192,27,247,29,247,9,34,251,142,154,31,252,15,251,9,248,15,6,251,
+145,122,41,251,1,251,56,27,92,71,149,141,135,31,127,145,131,148,137,151,104,
+247,54,24,251,35,251,142,6,139,247,57,79,247,58,248,30,247,53,247,165,247,
+142,30,11,252,70,247,11,6,247,78,163,205,180,200,30,247,95,251,82,5,248,43,
+29,247,8,251,7,187,58,251,175,251,83,251,153,251,154,30,200,29,248,72,253,
+74,7,114,119,118,112,137,30,37,133,5,43,248,228,235,7,251,17,145,5,114,119,
+162,164,31,249,74,11,212,29,251,121,251,46,84,51,174,151,96,30,71,247,121,
+247,98,29,251,43,247,158,247,207,247,152,247,152,247,154,31,11,248,174,29,
+32,7,251,195,35,5,55,247,27,28,251,145,192,29,11,176,63,27,251,181,251,100,
+248,99,29,247,41,247,64,247,34,139,31,42,7,251,139,33,251,30,251,8,80,103,
+149,175,85,30,63,247,84,5,139,96,149,110,78,67,79,78,251,20,247,48,32,247,
+140,248,69,227,247,142,247,135,30,251,165,247,73,21,139,53,100,66,251,70,
+50,247,37,247,105,247,105,193,247,60,248,164,29,21,248,114,6,181,174,174,
+181,181,104,174,97,31,252,114,6,97,104,104,97,97,174,104,181,31,14,247,60,
+29,252,228,205,29,248,228,247,61,29,11,21,251,3,6,84,133,98,96,96,251,13,
+96,237,251,0,27,251,29,65,251,5,251,33,104,31,247,3,6,192,145,178,182,184,
+247,13,182,43,245,27,247,31,213,247,3,247,35,174,31,14,250,66,249,72,21,247,
+161,251,123,177,251,105,30,252,95,43,6,241,131,5,154,137,151,131,128,26,253,
+129,7,129,129,130,122,137,30,41,131,5,43,248,148,235,7,251,5,147,5,125,141,
+129,148,149,26,247,127,7,135,176,167,141,168,27,247,97,247,117,215,247,150,
+31,251,152,131,21,251,64,251,5,86,251,43,149,30,248,56,219,7,247,2,213,65,
+251,23,31,14,7,53,246,29,248,188,7,247,13,100,247,93,251,134,251,52,251,90,
+251,19,139,30,248,255,32,7,247,223,29,28,251,101,114,29,252,119,7,114,119,
+118,114,137,30,74,133,5,43,11,28,5,162,22,247,195,29,8,247,3,155,247,138,
+205,247,168,26,247,183,251,187,188,251,44,30,253,60,35,6,247,1,129,5,163,
+136,162,123,112,26,11,248,9,29,28,5,18,219,29,252,15,247,217,29,7,247,50,
+248,247,247,150,29,14,21,247,0,61,186,45,118,131,141,139,30,247,55,37,251,
+173,7,139,169,143,154,186,182,118,90,82,71,126,86,90,59,156,139,30,36,7,139,
+221,117,223,247,37,246,211,247,25,30,11,7,35,247,105,29,250,178,247,60,29,
+252,228,35,7,244,129,5,163,136,160,123,112,26,254,170,7,112,118,121,115,30,
+252,99,6,114,119,157,166,31,250,170,247,60,29,252,228,205,29,11,7,247,30,
+29,252,166,43,7,213,247,22,29,253,64,7,114,120,117,113,30,251,140,6,106,127,
+161,164,31,249,64,7,163,159,160,164,141,30,213,145,5,235,252,169,43,7,233,
+133,5,164,137,159,118,115,26,253,80,7,247,159,29,11,35,247,105,29,250,178,
+247,60,29,28,250,98,205,29,248,228,247,61,29,250,170,7,166,159,157,164,30,
+248,99,6,163,160,121,112,31,254,170,7,112,118,123,115,137,30,34,128,5,35,
+11,238,29,251,84,247,26,45,247,37,61,30,247,54,51,247,68,69,251,62,247,131,
+29,11,148,29,14,28,5,35,249,60,21,248,7,251,148,247,246,252,89,251,232,251,
+54,251,107,139,30,251,105,7,229,211,247,76,247,85,247,163,27,247,150,235,
+251,181,251,183,31,254,33,75,6,251,203,247,41,251,230,248,54,248,42,247,158,
+247,206,248,35,30,251,234,251,42,21,251,57,137,38,251,136,251,90,27,251,48,
+37,247,45,247,64,31,223,7,14,247,13,29,14,247,122,29,248,76,247,4,7,11,176,
+29,251,228,245,21,253,111,6,247,138,159,246,247,130,248,68,29,145,251,25,
+21,251,152,133,34,251,189,251,160,27,251,134,251,2,247,171,247,170,128,31,
+11,152,29,14,21,251,42,6,254,29,28,250,113,5,247,42,6,247,33,248,240,21,247,
+132,53,7,114,251,1,5,252,0,6,247,156,247,52,247,76,247,27,247,68,26,247,40,
+251,19,229,251,60,251,8,251,97,102,251,48,84,176,104,204,180,186,162,139,
+30,247,58,7,147,170,143,143,176,27,239,197,67,43,251,109,251,214,251,81,33,
+58,31,36,7,11,21,247,136,251,23,247,27,251,115,251,72,251,44,251,19,251,82,
+251,9,231,251,25,247,81,247,6,229,200,139,30,113,251,51,45,42,251,85,127,
+248,93,29,247,213,26,251,82,184,21,139,143,92,133,84,30,139,85,112,64,251,
+11,84,213,247,1,243,186,235,233,247,7,188,251,29,251,9,30,14,247,86,29,248,
+82,29,30,251,202,220,21,252,84,6,247,52,149,192,247,64,247,52,27,247,54,190,
+251,64,251,52,151,31,141,251,23,21,251,62,133,90,251,76,251,62,27,251,62,
+90,247,83,247,55,131,31,11,248,226,28,5,211,21,245,251,23,170,251,1,251,64,
+251,21,49,251,35,251,103,247,126,94,139,30,251,150,7,122,126,131,123,137,
+30,53,133,5,75,248,43,203,7,53,145,5,121,141,129,147,156,26,247,168,7,139,
+251,122,203,247,68,26,208,174,227,223,166,153,139,125,160,30,186,35,5,139,
+165,128,170,168,184,152,192,30,14,7,49,96,122,248,147,29,94,32,26,41,247,
+46,96,239,247,21,247,74,211,247,74,30,11,245,29,112,121,159,166,31,11,247,
+19,59,231,173,29,247,25,124,251,47,11,21,247,191,29,200,29,247,107,29,11,
+247,100,29,14,248,142,250,132,21,247,25,217,247,19,180,155,27,184,178,85,
+78,149,31,247,72,247,154,6,196,90,49,160,59,27,39,41,47,59,61,31,247,31,252,
+81,33,7,199,135,200,135,139,26,166,136,143,135,115,26,28,250,18,247,121,29,
+11,250,144,248,148,21,247,177,251,66,247,119,251,240,251,154,251,62,251,13,
+139,30,248,155,29,247,91,247,6,251,31,251,115,30,253,49,89,6,251,131,247,
+6,251,120,247,216,247,203,247,97,247,120,247,201,30,251,187,251,27,21,251,
+21,90,251,46,251,44,251,13,92,244,247,25,30,184,7,11,235,7,53,145,5,112,141,
+121,158,166,26,249,254,251,5,7,251,39,43,5,198,67,49,176,63,27,251,181,251,
+100,251,95,251,244,251,181,247,43,251,97,247,142,247,41,247,64,247,36,139,
+31,251,11,7,247,95,4,139,53,98,66,251,70,50,247,31,247,107,247,103,193,247,
+66,248,164,29,163,176,180,203,144,202,175,202,247,75,37,24,216,203,160,186,
+186,26,206,55,209,251,1,62,46,96,76,99,30,85,57,139,61,70,38,100,84,57,96,
+94,127,8,11,247,222,29,252,91,28,4,225,5,251,125,6,252,95,28,250,250,251,
+7,122,5,35,248,77,243,7,251,7,154,125,141,116,159,147,160,25,247,5,247,209,
+5,248,74,6,247,3,251,217,145,124,127,121,126,137,25,251,13,124,5,35,7,117,
+248,236,21,251,240,6,247,64,248,128,5,11,21,221,29,139,247,55,83,247,93,248,
+25,29,30,251,0,11,170,29,14,7,114,119,118,114,137,30,53,133,5,43,248,169,
+235,7,57,145,5,112,141,121,160,164,26,247,205,235,7,11,114,150,121,149,127,
+30,247,240,252,64,5,247,60,6,251,119,248,137,5,139,61,211,53,55,77,96,92,
+30,11,247,63,29,251,198,141,21,251,75,98,251,115,251,78,251,82,102,247,130,
+247,68,247,68,180,247,119,247,76,247,80,180,251,129,251,66,30,247,12,249,
+84,228,29,11,21,247,218,29,251,85,251,10,247,44,247,132,247,146,247,27,247,
+19,247,17,31,153,147,137,156,27,248,32,29,251,31,233,251,107,247,152,29,11,
+21,247,56,7,139,251,42,251,7,247,40,29,248,135,29,30,247,177,29,11,247,77,
+29,254,187,7,112,116,113,117,137,30,251,5,128,5,35,248,247,243,7,251,5,162,
+5,116,143,115,151,166,26,250,62,248,2,29,11,21,248,114,6,181,174,174,181,
+181,104,174,97,31,252,114,6,97,104,104,97,97,174,104,181,31,248,192,11,251,
+56,163,30,247,64,195,170,247,4,221,26,247,35,251,52,247,1,251,136,251,21,
+45,102,76,251,40,30,251,142,247,7,7,143,155,164,247,29,139,26,143,159,156,
+149,147,30,166,174,205,171,198,27,197,241,111,251,27,251,21,45,83,51,131,
+120,141,143,82,31,251,31,7,139,229,156,180,186,11,243,252,231,35,7,190,29,
+11,7,247,46,29,11,28,5,195,249,60,21,248,33,251,173,247,222,252,62,247,156,
+29,30,11,249,242,183,29,11,7,251,4,145,251,130,247,232,115,176,118,160,92,
+153,25,184,178,160,178,163,178,180,200,137,215,172,202,247,74,58,24,217,202,
+159,176,186,26,207,35,198,251,1,62,63,96,76,98,30,88,57,147,48,69,39,119,
+106,83,123,82,121,8,247,164,247,174,29,213,145,5,235,11,248,3,29,248,222,
+34,7,248,133,29,28,250,207,247,13,29,11,28,6,115,249,97,21,248,76,251,251,
+247,248,252,70,252,74,251,246,251,250,252,74,252,77,247,248,251,248,248,68,
+248,76,247,249,247,248,248,77,30,40,22,252,19,251,203,251,210,252,21,252,
+19,251,201,247,208,248,17,248,31,247,207,247,201,248,15,248,19,247,203,251,
+205,252,23,30,11,247,159,29,248,169,235,7,65,246,29,247,170,7,172,137,190,
+131,163,106,247,134,251,205,24,67,11,7,112,116,123,115,137,30,251,5,128,5,
+35,249,7,243,7,251,21,247,70,29,11,21,247,36,251,23,237,251,78,51,46,108,
+139,30,247,91,248,85,247,29,252,193,252,66,7,139,241,157,227,247,19,244,74,
+251,3,82,79,251,13,251,41,127,83,143,139,30,96,247,40,5,147,117,120,141,123,
+27,77,105,96,102,35,247,29,87,247,25,247,91,247,80,246,247,78,31,11,28,5,
+127,249,82,247,207,29,137,162,122,247,4,29,11,247,10,29,249,39,7,139,223,
+166,247,4,247,15,205,38,35,30,253,97,7,251,134,79,96,94,30,251,105,247,97,
+5,59,90,57,74,34,247,21,84,231,247,216,247,66,247,93,247,141,31,14,250,128,
+193,29,247,173,29,247,41,248,11,248,42,29,6,247,90,29,11,248,27,29,30,11,
+43,7,195,29,11,245,129,5,164,136,159,123,112,26,252,64,252,199,248,64,7,231,
+29,248,131,248,199,11,21,208,251,49,7,251,23,110,178,222,222,168,178,247,
+23,31,247,49,208,251,36,6,251,85,84,73,251,17,251,17,194,73,247,85,31,14,
+155,29,247,187,7,139,217,118,220,247,230,247,107,247,114,247,223,30,251,195,
+109,247,100,29,11,196,29,14,235,7,40,145,5,115,141,116,160,164,26,249,254,
+248,41,29,247,23,253,68,248,40,29,45,133,5,43,7,11,223,247,22,29,251,173,
+252,25,247,173,233,29,247,207,248,25,11,28,4,246,21,243,253,13,35,7,247,19,
+129,5,161,136,162,123,112,26,253,92,247,45,29,249,98,7,166,159,155,164,142,
+30,11,7,251,93,112,69,96,74,30,251,111,247,95,5,70,116,73,86,71,26,251,17,
+247,15,96,227,247,197,247,93,247,177,247,175,30,248,178,247,146,7,247,108,
+29,251,146,11,235,7,49,145,5,114,141,116,160,164,26,249,254,223,29,7,11,28,
+6,102,249,7,21,247,237,29,211,251,43,128,251,87,123,72,69,247,94,29,212,194,
+191,8,14,251,23,72,5,57,247,26,253,74,7,114,118,118,114,137,248,48,29,121,
+162,164,31,249,74,11,21,248,11,248,42,29,7,247,33,29,250,215,247,173,29,11,
+21,247,78,7,149,123,102,154,108,27,78,55,45,100,106,31,247,21,69,7,251,98,
+77,5,90,237,252,50,7,125,124,127,123,137,30,82,135,5,81,248,15,197,7,55,143,
+5,122,127,153,153,31,247,237,7,139,174,161,190,190,162,106,123,151,30,14,
+250,238,22,248,65,29,121,27,252,133,6,248,30,248,224,251,238,248,170,5,248,
+79,6,155,149,131,123,142,31,173,251,116,5,247,44,248,9,254,107,251,13,6,247,
+247,252,174,252,32,252,230,5,251,13,7,14,7,115,119,118,114,137,30,49,133,
+5,43,248,222,235,7,251,23,145,5,112,121,162,163,31,11,35,7,244,129,5,164,
+136,159,123,112,26,254,178,7,247,158,29,11,6,248,172,249,144,5,247,6,253,
+209,251,209,247,37,7,154,247,50,5,157,157,164,160,30,247,201,6,252,160,253,
+130,5,251,25,11,28,6,250,247,121,21,247,52,251,52,180,104,151,30,203,170,
+235,182,247,9,26,247,37,251,35,205,251,30,251,43,251,58,81,251,78,37,231,
+75,192,121,30,74,120,251,7,102,251,25,26,251,31,247,27,41,247,83,247,66,247,
+60,212,247,58,30,11,247,205,247,37,29,248,132,29,125,151,155,31,248,161,71,
+7,251,85,77,5,88,223,252,21,7,139,88,119,84,251,7,131,214,201,30,248,17,69,
+7,251,86,77,5,88,225,251,209,7,251,17,184,65,247,43,236,247,6,221,139,30,
+71,7,14,249,244,249,56,21,247,203,7,247,137,29,11,143,165,210,144,160,27,
+247,62,247,33,251,45,252,25,251,248,251,70,251,30,251,213,91,88,142,145,85,
+31,119,150,52,133,26,127,201,212,132,216,27,247,216,248,36,247,25,248,170,
+248,45,251,123,247,91,251,249,107,68,135,137,106,31,11,250,205,188,21,247,
+68,251,70,247,79,251,144,30,248,9,248,129,5,233,254,37,252,94,247,37,7,153,
+247,74,5,157,141,158,164,159,27,248,60,6,251,203,252,54,194,86,5,139,147,
+155,211,247,50,202,251,0,251,48,251,52,37,11,21,247,121,39,247,89,251,134,
+251,133,36,251,89,251,121,251,123,248,160,29,247,123,248,4,29,246,145,247,
+141,247,35,247,36,145,251,141,32,30,14,247,253,251,173,194,251,168,30,247,
+140,29,254,178,182,29,247,240,248,131,29,11,28,5,252,21,254,66,28,249,143,
+243,78,250,68,28,6,115,5,11,7,245,110,232,29,168,80,75,30,11,247,174,29,230,
+145,5,235,252,220,43,7,247,23,133,5,164,137,157,118,115,26,252,207,247,83,
+29,11,248,113,235,21,250,52,35,7,251,206,37,5,55,247,38,253,228,247,91,29,
+242,213,30,218,245,172,247,40,247,39,26,11,7,139,251,77,164,251,31,252,23,
+251,166,251,60,252,23,251,156,247,47,251,122,247,138,247,58,247,35,244,139,
+30,11,21,247,35,47,217,251,48,30,57,7,243,189,98,41,41,89,98,35,31,57,7,247,
+44,235,212,247,40,31,14,229,29,251,203,6,11,21,235,252,34,43,7,225,133,162,
+137,155,116,131,119,25,251,115,252,203,251,93,248,203,247,127,29,247,244,
+250,13,5,11,248,41,29,247,21,253,21,7,139,61,104,53,251,66,125,247,19,239,
+30,249,15,32,7,251,193,37,5,55,247,25,252,165,7,251,101,209,251,17,247,125,
+248,129,29,30,251,5,11,247,17,251,187,116,100,247,81,29,252,189,43,7,233,
+133,5,164,137,159,118,115,26,253,80,7,247,159,29,248,107,7,248,19,11,250,
+226,247,68,29,11,247,211,29,251,236,251,19,247,189,247,179,247,246,247,66,
+247,122,247,173,247,235,29,11,7,139,247,247,32,251,187,26,251,6,83,251,38,
+251,21,137,30,98,119,141,162,106,31,68,247,66,5,139,96,155,91,94,72,119,53,
+251,70,247,92,85,247,58,247,159,247,90,247,44,247,130,30,14,21,247,57,253,
+76,251,57,7,11,139,251,15,194,251,95,251,131,251,64,251,13,251,82,251,27,
+239,69,247,7,82,30,247,29,71,247,48,94,251,3,247,178,29,11,7,251,21,156,252,
+42,249,13,248,19,248,133,247,41,29,11,166,159,155,164,142,30,247,0,149,5,
+243,252,234,35,7,246,129,5,164,136,159,123,112,26,254,178,247,2,29,11,246,
+251,44,251,6,251,11,63,139,30,215,69,7,251,92,75,5,90,231,252,48,7,123,124,
+127,123,30,92,135,5,81,247,218,197,7,98,143,5,122,127,248,138,29,192,155,
+213,219,11,247,113,29,252,179,43,7,233,133,5,164,137,159,118,115,26,253,80,
+7,247,159,29,248,179,235,7,55,246,29,11,62,70,102,88,69,26,112,147,94,157,
+102,30,84,148,251,41,85,251,62,26,251,111,247,115,41,247,107,247,160,247,
+177,247,46,247,129,247,64,251,66,233,252,85,176,30,115,197,169,171,188,172,
+11,251,91,247,47,43,247,144,247,135,247,65,228,247,98,30,247,42,248,178,29,
+251,52,7,251,13,87,100,57,57,11,21,65,102,88,115,112,30,41,182,36,180,237,
+26,205,196,186,207,223,192,71,64,30,158,252,73,21,59,63,101,59,45,61,214,
+236,221,200,182,156,159,30,219,102,247,62,98,251,13,26,14,21,251,20,6,88,
+132,92,99,90,251,32,90,230,251,17,27,251,49,53,251,0,251,26,99,31,247,20,
+6,191,146,184,180,190,247,32,188,46,247,14,27,247,52,225,247,0,247,26,179,
+31,11,251,36,210,251,25,207,247,37,26,247,13,247,9,203,247,27,227,174,106,
+139,139,166,121,141,128,30,173,251,111,5,247,50,247,228,6,139,251,70,221,
+251,101,251,156,251,122,251,42,251,158,11,178,221,192,247,7,147,247,33,223,
+241,247,120,251,17,24,214,203,168,159,234,26,204,65,219,251,31,33,65,110,
+92,90,30,251,36,251,33,166,251,50,47,251,45,96,65,73,73,35,127,8,11,6,247,
+138,29,11,7,112,121,123,112,137,30,251,23,128,5,33,249,7,245,7,251,23,150,
+5,112,141,121,155,166,26,11,248,21,247,74,247,185,247,171,247,172,251,74,
+247,185,252,21,31,253,1,251,5,248,252,6,247,172,247,58,251,90,251,154,251,
+155,251,58,251,88,251,172,31,252,252,251,5,6,14,247,5,252,252,7,251,172,251,
+58,247,88,247,155,247,154,247,58,247,90,247,172,31,248,252,247,5,253,1,6,
+252,21,251,74,251,185,251,172,251,171,247,74,251,185,248,21,31,14,21,247,
+200,29,108,139,30,14,7,112,119,119,114,30,49,133,5,42,248,199,236,7,251,0,
+145,5,11,145,5,114,141,119,160,164,26,11,247,155,251,34,6,251,2,251,110,251,
+50,45,5,57,247,27,253,21,7,251,64,205,59,247,74,248,104,29,30,248,171,29,
+11,21,64,204,5,251,25,44,252,6,110,252,25,27,252,28,251,250,168,247,25,41,
+31,65,74,5,251,73,247,13,247,215,45,248,124,27,248,121,247,214,238,247,68,
+247,4,31,14,7,112,119,123,114,137,30,32,128,5,35,248,234,248,102,29,11,247,
+45,251,26,206,251,28,251,15,71,79,69,102,166,102,139,30,247,63,6,185,127,
+158,92,83,26,75,82,35,251,80,65,30,251,1,7,247,178,230,247,49,247,50,247,
+93,26,11,112,26,254,178,7,112,116,123,115,137,30,251,5,128,5,35,249,19,7,
+248,70,247,173,247,125,248,105,31,251,222,117,21,248,39,29,30,251,62,135,
+5,11,7,112,116,123,115,137,30,251,1,128,5,35,248,243,243,7,251,5,247,70,29,
+248,78,247,248,29,11,248,132,247,13,21,247,11,67,216,251,15,51,55,70,36,98,
+153,88,189,100,30,247,16,6,148,251,84,251,42,73,35,123,8,39,7,247,88,153,
+247,120,247,105,247,146,26,11,28,4,209,247,23,29,11,21,206,7,251,79,162,98,
+247,79,247,144,26,247,144,180,247,77,247,79,163,30,205,7,251,154,132,251,
+27,251,92,251,212,26,251,213,247,27,251,94,247,154,133,30,14,7,165,159,158,
+164,30,247,15,145,5,243,253,1,35,7,247,7,133,5,164,159,120,113,31,11,7,114,
+119,118,114,137,30,66,133,5,43,248,137,235,7,78,145,5,114,141,117,160,164,
+26,11,248,113,29,253,107,248,108,29,11,248,77,29,253,12,7,123,126,129,123,
+138,30,11,248,11,7,248,19,247,109,247,138,247,207,31,251,189,78,21,251,183,
+251,25,43,251,119,30,126,133,141,115,27,249,107,7,139,198,151,188,247,85,
+241,251,25,251,113,30,11,247,4,34,189,251,4,251,8,99,89,89,96,160,105,139,
+30,247,14,6,174,129,156,118,107,26,104,117,66,251,50,87,30,52,7,247,105,199,
+247,37,247,1,247,48,26,11,247,216,29,247,31,247,203,6,247,137,29,7,14,248,
+240,248,21,21,247,109,252,172,251,109,7,14,21,247,9,65,188,47,47,63,88,251,
+7,30,247,5,253,195,5,247,3,6,247,0,251,175,21,240,51,200,63,63,49,84,32,251,
+12,238,91,206,227,215,213,233,30,11,27,247,232,247,73,247,105,247,198,31,
+251,198,141,21,251,75,118,251,115,251,78,248,54,29,247,80,160,251,129,251,
+66,30,11,35,7,246,129,5,161,136,162,123,112,26,251,133,75,252,87,251,2,251,
+111,30,34,251,99,251,103,51,139,26,252,64,247,42,7,247,195,247,76,247,3,247,
+1,30,11,247,88,7,138,148,150,139,152,27,247,96,247,59,247,48,247,117,247,
+81,251,16,247,57,251,117,119,121,138,137,122,31,247,99,248,159,29,11,21,211,
+75,167,95,82,89,95,83,79,196,101,189,190,196,173,203,30,140,253,39,21,66,
+248,125,5,67,6,67,252,125,5,70,188,108,198,199,188,172,206,30,14,133,5,163,
+137,160,118,115,26,11,248,35,21,247,163,251,111,196,251,44,143,30,205,153,
+247,117,205,247,138,26,247,178,251,181,170,251,39,30,253,40,35,6,247,3,129,
+5,164,136,159,123,112,26,11,43,7,247,4,131,5,164,137,145,127,112,26,251,150,
+78,251,175,85,47,30,55,251,41,251,8,94,81,122,248,47,29,11,21,217,7,254,9,
+247,175,5,61,7,249,171,251,136,253,171,251,135,5,61,7,14,7,166,159,155,164,
+142,30,244,149,5,243,252,228,35,7,243,129,5,162,136,161,123,112,26,251,246,
+7,141,106,98,143,107,27,251,249,251,113,251,60,251,172,11,21,209,37,242,251,
+19,251,159,251,49,251,71,251,129,169,30,247,44,28,251,102,166,251,84,112,
+248,6,29,11,247,58,29,248,5,251,21,252,1,247,55,29,252,72,11,28,5,176,22,
+248,70,247,173,247,125,248,105,248,36,251,152,247,164,252,103,31,253,21,6,
+252,103,251,152,251,164,252,36,252,105,247,173,251,125,248,70,31,11,45,145,
+5,115,141,118,160,164,26,249,80,247,174,29,233,145,5,235,11,247,57,29,247,
+246,249,249,24,11,251,254,21,139,247,25,75,201,247,21,237,203,247,0,247,13,
+35,231,77,182,30,251,21,6,215,82,192,73,59,248,111,29,11,247,90,29,254,215,
+6,112,117,123,114,137,30,251,11,128,5,35,249,5,243,7,247,255,29,11,7,247,
+50,29,14,21,251,51,227,89,229,152,240,8,143,141,155,139,30,247,13,6,139,180,
+188,203,26,225,91,202,35,33,63,47,251,13,251,228,247,228,49,139,30,14,21,
+247,131,251,31,247,23,251,132,30,251,29,7,247,52,215,72,251,58,251,56,63,
+71,251,52,31,251,29,7,247,126,247,37,247,19,247,134,31,14,249,76,21,207,86,
+192,72,71,86,86,71,72,192,85,207,206,192,193,206,30,14,21,203,7,35,143,5,
+123,124,149,155,31,249,122,43,7,251,181,47,5,75,7,247,91,164,5,252,247,7,
+123,127,129,122,30,251,6,135,5,75,7,11,248,49,29,120,161,160,164,25,247,168,
+247,250,247,121,251,252,247,194,29,11,251,98,251,93,251,7,247,32,247,115,
+30,249,52,188,6,247,130,251,9,247,121,251,213,251,204,251,96,251,119,251,
+202,251,176,247,66,251,120,247,240,11,247,141,29,152,112,116,120,248,146,
+29,166,123,151,162,154,27,247,0,149,5,243,11,21,211,91,186,62,79,86,96,79,
+115,147,106,172,117,30,221,6,143,251,9,43,100,71,131,8,77,7,247,19,147,247,
+40,247,22,247,43,26,14,28,5,233,22,243,7,33,247,70,29,11,34,7,251,211,36,
+5,55,247,44,11,7,251,201,57,36,251,44,96,129,174,139,30,92,247,166,5,251,
+52,252,10,6,116,203,247,21,104,247,4,27,247,228,247,36,247,105,247,208,31,
+11,247,158,29,248,228,247,61,29,248,72,7,180,131,188,122,159,111,247,228,
+252,105,24,65,11,249,115,250,203,21,247,81,251,13,247,23,251,111,251,99,251,
+37,251,9,251,93,251,86,247,31,251,9,247,95,247,113,247,21,247,19,247,74,30,
+11,247,29,7,251,52,66,207,247,56,247,58,212,206,247,52,31,247,29,7,251,130,
+251,33,251,23,251,131,251,134,247,38,251,19,247,125,31,14,7,139,95,131,97,
+68,100,167,218,30,247,226,247,77,217,251,77,247,50,47,7,68,251,23,36,83,5,
+90,227,252,21,7,36,181,91,247,11,11,251,23,252,37,5,247,26,6,247,23,248,37,
+5,247,232,247,236,251,33,6,248,150,29,52,6,247,122,249,80,5,11,21,43,210,
+63,244,210,207,176,221,172,125,172,112,163,30,251,21,6,205,205,202,218,162,
+30,221,7,251,49,108,251,25,41,251,34,26,14,7,36,248,79,29,28,5,86,247,165,
+29,11,21,247,30,251,29,212,251,15,207,30,42,194,50,193,220,26,211,191,180,
+225,206,192,119,108,163,30,159,251,56,5,247,6,247,175,6,139,11,247,83,29,
+251,110,245,7,14,7,251,74,247,74,67,247,22,239,247,45,182,237,30,11,250,228,
+28,4,229,21,247,13,254,117,252,9,247,41,7,176,247,116,5,155,142,148,147,156,
+27,248,88,6,253,82,254,252,5,251,13,11,65,69,25,251,66,247,25,5,80,113,79,
+90,63,26,40,137,242,74,219,27,219,206,174,194,196,31,247,3,243,209,247,69,
+190,247,14,11,251,220,21,246,88,184,74,176,30,251,89,251,79,5,59,96,156,229,
+31,11,247,21,156,5,243,252,94,35,7,247,2,124,170,135,141,117,135,122,25,11,
+7,248,105,29,243,149,5,243,11,243,7,35,247,105,29,11,7,139,251,247,247,0,
+247,185,26,247,7,195,247,39,247,21,180,159,137,119,172,30,211,251,67,5,139,
+182,121,186,184,206,160,227,11,21,247,203,251,81,247,111,251,230,251,209,
+251,115,251,85,251,227,251,216,247,107,251,89,247,203,248,82,29,30,11,21,
+247,159,251,9,247,53,251,125,251,126,251,6,251,53,251,159,251,158,247,6,251,
+54,247,126,247,125,247,9,247,54,247,158,30,11,251,128,21,191,248,117,29,251,
+204,5,247,35,6,247,222,247,75,5,170,155,161,182,163,26,14,7,72,142,5,122,
+140,127,151,155,26,249,200,71,248,141,29,123,127,127,122,138,30,73,136,5,
+81,11,247,126,29,247,130,247,53,248,0,26,11,22,247,243,29,11,247,193,7,167,
+146,130,109,143,31,169,251,68,5,11,150,5,114,141,119,155,166,26,11,31,248,
+10,7,166,161,153,162,144,30,225,149,5,243,252,210,35,7,244,129,5,164,136,
+159,123,112,26,252,47,7,251,115,11,251,111,247,84,29,11,21,251,81,251,7,55,
+251,89,112,107,140,139,30,248,162,7,140,173,177,146,173,27,247,38,247,11,
+53,251,68,31,14,7,247,180,251,24,247,175,251,217,251,3,45,84,36,68,200,73,
+209,30,247,93,247,95,5,202,36,133,251,162,139,26,11,247,56,7,139,251,42,251,
+7,251,98,251,93,251,7,247,32,247,115,30,249,52,188,6,247,130,251,9,247,121,
+251,213,11,61,251,44,98,61,72,88,251,48,157,8,35,7,114,225,205,131,190,27,
+247,29,225,182,203,198,31,247,74,247,58,86,11,247,159,251,21,247,76,251,189,
+251,62,251,125,35,83,108,30,247,19,252,85,35,7,247,15,129,5,154,155,124,127,
+31,11,252,138,21,251,172,247,201,5,191,92,112,153,84,27,51,110,80,89,115,
+162,94,167,122,31,247,224,251,72,5,14,247,93,29,14,30,248,160,7,174,141,169,
+137,139,26,247,91,246,55,251,64,31,11,137,137,115,30,247,121,7,163,159,160,
+164,141,30,233,145,5,235,11,163,160,160,163,141,30,234,145,5,235,11,7,139,
+84,102,63,57,104,194,166,123,30,251,34,251,204,6,121,164,196,120,187,27,233,
+247,23,247,44,205,190,31,11,7,49,118,122,87,30,251,38,247,79,5,73,102,88,
+94,32,26,41,247,21,96,214,247,21,247,24,211,247,74,30,11,21,247,96,29,11,
+28,4,109,248,130,21,247,203,251,81,247,111,251,230,251,209,251,115,251,85,
+251,227,251,216,247,107,251,89,247,203,11,251,83,248,173,247,127,29,11,28,
+5,20,22,252,240,28,5,190,253,64,28,250,66,5,250,134,247,7,21,253,236,6,248,
+91,250,94,5,14,216,77,29,248,0,29,247,121,11,7,139,145,251,161,75,35,30,251,
+92,247,95,5,69,133,78,81,66,26,38,233,84,247,2,247,50,247,5,204,11,21,251,
+13,92,251,19,251,3,251,5,90,247,17,247,13,247,9,182,247,13,247,15,241,191,
+251,15,251,5,30,11,21,251,125,251,14,55,251,81,137,30,121,133,139,141,108,
+31,248,254,247,7,7,247,43,239,251,2,251,83,31,11,88,88,8,251,33,7,247,45,
+247,41,246,203,247,228,251,11,247,25,92,186,110,247,54,150,247,14,147,247,
+5,11,145,147,135,129,141,31,139,164,45,141,122,30,247,17,248,3,251,17,6,122,
+251,1,5,125,137,127,137,127,27,11,251,97,66,43,251,126,248,145,29,165,180,
+144,160,27,247,60,247,4,51,251,136,31,11,21,221,7,34,90,180,237,237,188,180,
+244,31,221,7,251,48,47,61,251,35,251,40,233,66,247,46,31,14,5,150,117,248,
+69,29,11,28,5,143,21,251,41,6,254,29,28,250,113,5,247,41,6,11,21,251,122,
+39,251,74,251,89,96,70,164,139,30,249,76,7,248,119,29,30,11,26,247,2,67,227,
+251,15,251,1,53,65,48,114,145,114,153,113,30,247,80,153,5,149,130,143,126,
+121,26,11,249,171,247,95,21,247,168,29,11,216,247,106,29,11,249,214,252,164,
+21,28,8,110,251,67,28,247,146,7,251,156,22,28,8,110,251,67,28,247,146,7,14,
+150,5,116,141,117,155,166,26,11,21,28,5,46,7,181,104,174,97,97,104,104,97,
+30,28,250,210,7,97,174,104,181,181,174,174,181,30,11,247,113,247,23,251,115,
+247,11,7,247,78,163,205,180,200,30,247,95,251,82,5,248,43,29,11,155,156,117,
+125,141,31,159,251,32,5,247,19,248,120,251,19,6,119,251,32,5,125,137,124,
+116,121,27,11,166,159,155,164,141,30,246,150,5,243,252,235,35,7,247,1,128,
+5,164,137,159,123,112,26,253,185,7,11,251,232,248,34,29,28,5,112,251,157,
+248,34,29,14,251,195,247,7,6,248,157,29,11,248,83,29,251,26,41,251,24,56,
+30,11,7,163,159,160,164,141,30,223,145,5,235,11,248,140,29,43,11,251,109,
+251,131,47,251,44,55,231,150,139,11,21,247,19,28,251,52,251,19,7,11,155,166,
+26,250,178,7,166,11,6,247,136,29,11,7,166,160,155,164,142,30,247,4,149,5,
+243,252,246,35,7,247,4,129,5,164,136,160,123,112,26,11,7,139,221,134,190,
+247,233,247,94,247,35,247,137,247,154,251,120,225,251,133,141,30,251,99,143,
+5,11,7,112,116,123,117,137,30,251,15,128,5,35,249,1,243,7,251,5,150,5,116,
+141,115,155,166,26,11,7,112,119,123,114,137,30,251,1,128,5,35,248,236,248,
+102,29,11,7,247,62,252,58,234,176,247,213,29,11,25,247,13,152,5,243,252,194,
+35,7,247,17,122,247,234,28,250,250,5,247,89,6,247,205,250,189,11,43,6,235,
+131,5,156,137,149,135,120,26,253,123,7,127,131,126,120,30,139,72,135,110,
+137,30,43,11,251,17,251,10,99,105,141,144,93,30,144,114,146,96,144,118,193,
+128,189,135,181,140,8,247,92,145,11,131,161,151,248,29,29,247,220,254,15,
+5,247,95,6,11,21,247,9,251,83,247,80,251,9,251,80,251,82,251,9,247,82,251,
+83,247,9,247,83,7,14,45,246,29,249,111,247,63,7,167,144,130,109,145,31,169,
+251,38,5,14,7,166,159,155,164,142,30,247,0,149,5,243,252,234,35,7,246,129,
+5,164,136,159,123,112,26,11,26,251,29,251,35,83,251,13,61,59,174,139,30,133,
+120,154,155,137,31,105,247,140,5,251,54,11,248,42,247,55,104,230,252,212,
+251,141,5,251,25,7,248,212,251,141,174,230,252,42,247,55,5,11,94,30,251,105,
+247,97,5,59,90,57,74,34,247,21,84,231,247,215,247,66,247,93,247,141,31,11,
+102,247,5,107,221,251,19,179,8,235,162,247,31,200,247,64,26,247,112,251,135,
+173,251,9,30,11,112,118,123,116,137,30,251,6,128,5,35,248,230,243,7,251,7,
+150,5,116,141,119,155,166,26,11,114,119,121,114,137,30,251,7,132,5,35,249,
+1,243,7,251,15,146,5,114,141,119,157,164,26,11,158,115,81,157,92,27,45,251,
+23,251,44,74,88,31,248,115,29,11,166,159,155,164,142,30,247,7,149,5,243,252,
+247,35,7,247,5,129,5,164,136,159,123,112,26,11,247,79,5,72,102,90,96,251,
+1,26,41,247,43,96,242,247,19,247,76,211,247,74,30,14,252,210,35,6,247,11,
+129,5,163,136,162,123,112,26,11,247,21,158,5,243,252,103,35,7,247,1,131,5,
+157,11,244,252,254,34,7,247,29,129,5,164,161,121,112,31,11,21,251,240,6,247,
+64,248,128,5,14,4,247,168,29,11,6,248,19,247,109,247,138,247,207,248,51,29,
+31,11,7,156,154,148,154,141,30,207,145,5,201,252,22,247,219,29,11,7,163,159,
+160,164,141,30,202,145,5,235,252,137,43,7,212,133,5,164,137,159,118,115,26,
+11,7,114,119,118,114,137,30,63,133,5,43,248,140,235,7,76,145,5,114,141,117,
+160,164,26,11,248,108,29,248,187,248,125,29,11,21,139,68,131,79,251,68,35,
+247,31,247,115,247,111,225,247,60,247,135,186,174,131,139,30,11,21,239,251,
+41,248,148,251,35,7,252,75,252,143,5,34,248,48,251,148,247,62,247,148,7,11,
+251,185,251,127,251,113,251,216,251,160,247,68,251,128,247,211,247,99,247,
+19,223,170,209,31,11,43,7,212,133,5,164,137,159,118,115,26,253,80,7,114,119,
+118,114,137,30,66,133,5,43,11,116,21,249,71,7,247,70,76,247,70,251,128,251,
+68,251,74,251,17,139,30,247,17,32,7,11,251,62,143,5,251,68,143,251,117,247,
+5,248,74,26,248,149,29,11,252,72,251,148,251,199,252,40,252,101,247,193,251,
+156,248,45,248,48,247,169,247,214,248,27,11,248,125,29,249,107,7,160,157,
+149,158,141,30,241,147,5,235,11,112,119,123,114,137,30,34,128,5,35,11,114,
+119,118,114,137,30,45,133,5,43,11,7,32,150,5,117,141,116,247,117,29,162,155,
+161,142,30,246,149,5,243,11,7,35,247,70,29,250,178,7,166,159,155,164,142,
+30,243,149,5,243,11,7,135,90,114,143,121,27,251,214,251,70,247,117,247,244,
+247,183,247,27,247,175,247,249,11,21,251,42,6,247,147,252,129,251,147,252,
+130,5,247,42,6,247,222,248,79,5,242,7,11,30,72,247,64,5,139,116,149,110,78,
+67,79,78,251,46,247,38,78,247,140,248,51,205,11,35,7,251,206,36,5,55,247,
+38,28,251,101,247,114,29,11,251,6,247,22,251,49,44,38,81,36,71,182,72,163,
+131,30,247,73,219,5,213,122,145,11,247,210,29,119,159,164,26,11,247,200,29,
+102,139,30,11,248,105,29,245,149,5,243,252,231,35,7,245,129,5,164,136,159,
+123,112,26,11,252,80,21,217,7,254,9,247,175,5,61,7,249,171,251,136,253,171,
+251,135,5,61,7,11,21,217,7,253,170,247,135,249,170,247,136,5,217,7,254,9,
+251,175,5,61,7,14,248,21,7,163,150,131,106,143,31,176,251,121,5,11,247,121,
+7,248,156,29,11,7,163,160,160,163,141,30,11,247,42,6,251,147,248,129,247,
+147,248,130,5,251,42,6,251,222,252,79,5,36,7,11,21,248,11,254,246,252,11,
+247,62,7,144,247,120,5,155,141,150,147,156,27,247,109,11,251,185,248,163,
+21,252,5,6,247,21,189,247,43,247,43,247,13,186,35,251,23,30,11,26,92,102,
+55,251,31,73,251,11,184,152,133,30,139,121,247,25,133,194,30,251,21,11,247,
+70,251,92,190,251,58,251,159,251,90,251,44,251,129,251,244,247,250,63,139,
+30,11,247,111,247,142,247,27,155,5,235,252,62,43,7,217,131,159,137,146,120,
+126,125,25,11,112,119,123,114,137,30,251,3,128,5,35,249,83,7,247,95,247,162,
+155,248,19,31,11,251,64,251,3,251,86,30,251,191,248,144,149,248,158,29,11,
+235,7,38,145,5,121,133,152,151,31,247,193,190,7,247,15,166,33,251,5,182,31,
+11,155,192,237,154,57,98,30,251,181,7,123,124,127,123,30,96,248,166,29,21,
+49,191,253,101,28,250,247,229,82,5,14,7,251,2,251,110,251,50,45,5,57,247,
+27,253,6,7,251,64,205,44,247,72,11,25,251,5,251,232,251,33,248,64,5,251,38,
+6,251,41,252,62,34,247,230,135,11,251,0,194,247,231,29,11,28,4,135,248,197,
+248,3,29,11,247,234,251,30,7,101,251,123,135,128,121,117,131,135,25,130,120,
+99,122,97,27,11,248,83,29,251,28,42,251,25,58,30,81,49,108,43,32,26,11,21,
+251,9,155,86,170,247,11,26,196,176,166,178,171,185,128,64,155,30,14,7,112,
+119,123,114,137,30,251,7,128,5,35,11,156,114,131,117,120,137,25,251,17,130,
+5,35,11,243,7,252,87,86,247,177,248,173,252,85,227,11,34,6,248,133,29,11,
+251,76,251,23,247,76,11,7,139,71,125,74,251,1,80,186,247,23,30,248,193,247,
+176,247,23,251,176,11,247,231,29,247,19,11,139,53,100,65,251,70,51,247,37,
+247,107,247,103,229,247,58,247,82,201,223,11,156,123,114,153,104,27,69,251,
+21,90,251,48,251,88,247,60,75,246,143,31,11,28,4,166,248,54,21,247,172,251,
+113,247,60,251,249,107,98,135,137,106,30,11,28,7,123,248,181,21,247,31,7,
+252,234,247,150,102,45,248,58,251,62,5,11,21,248,13,251,17,252,13,7,251,46,
+22,248,13,251,19,252,13,7,14,247,254,29,14,7,51,96,120,59,30,251,89,247,79,
+5,74,102,88,96,251,1,26,41,11,21,248,36,251,152,247,164,252,103,30,253,7,
+35,6,247,5,129,5,163,11,27,203,247,26,168,247,19,236,251,19,177,139,31,251,
+36,251,27,5,51,11,61,251,201,251,117,251,87,251,244,251,181,247,43,251,105,
+247,142,247,41,11,114,119,119,114,137,30,65,133,5,42,248,146,236,7,66,145,
+5,114,141,11,251,54,7,94,251,134,135,127,118,116,129,135,25,129,117,92,122,
+89,27,11,28,4,209,248,35,21,247,172,251,156,226,251,249,107,98,135,137,106,
+30,11,251,150,248,234,5,251,32,6,251,150,252,234,234,102,247,62,248,58,5,
+11,247,171,247,166,247,11,247,158,247,113,209,247,42,45,78,171,30,14,233,
+65,217,43,45,61,61,45,43,217,65,233,235,213,213,235,30,14,7,139,194,176,217,
+219,174,83,113,157,30,11,7,112,121,119,112,30,251,5,133,5,42,11,247,50,7,
+118,112,251,27,59,251,17,27,11,77,7,208,248,77,29,11,149,123,133,122,118,
+137,25,60,131,5,43,11,248,159,29,31,11,243,7,61,154,110,145,133,147,129,164,
+25,11,251,205,36,5,55,247,37,11,7,170,218,133,184,143,30,235,252,143,43,7,
+188,135,217,145,108,26,11,7,251,252,247,62,251,85,247,244,248,19,247,70,247,
+42,248,39,30,11,21,193,92,180,81,82,94,98,85,86,184,96,196,197,186,182,192,
+30,11,21,227,69,209,51,51,67,69,51,51,211,67,227,227,209,211,227,30,11,21,
+247,250,29,11,21,185,112,167,93,95,109,109,95,94,169,110,183,185,166,166,
+186,30,11,31,168,251,78,5,247,40,247,242,254,165,35,6,247,9,129,5,163,11,
+40,193,248,11,29,11,251,15,122,5,43,248,36,235,7,67,147,119,141,133,158,151,
+153,25,11,131,161,153,248,29,29,11,248,50,29,44,131,5,43,11,190,211,116,129,
+161,31,154,133,151,118,133,26,184,251,121,5,247,52,11,223,27,247,60,251,60,
+5,139,247,1,205,227,26,190,80,232,251,56,11,247,33,7,251,33,251,17,251,9,
+67,251,139,215,251,5,174,251,38,11,21,139,73,114,82,83,100,178,191,212,184,
+172,247,65,172,30,14,7,251,73,251,202,5,247,62,6,14,223,77,205,61,57,82,71,
+57,11,7,112,119,123,114,137,30,251,17,128,5,35,248,171,7,248,102,11,27,252,
+42,251,207,251,185,252,62,252,58,247,191,251,191,248,56,11,248,44,251,56,
+7,112,251,128,5,123,137,121,108,110,27,251,248,11,250,5,21,167,144,130,109,
+145,31,169,251,38,5,247,7,247,195,11,250,27,21,235,252,36,43,7,229,133,162,
+137,155,116,131,119,25,11,113,160,118,165,165,161,160,165,165,117,161,113,
+113,118,117,113,30,11,129,5,163,136,248,81,29,116,123,115,137,30,11,180,7,
+248,37,251,129,253,15,248,164,27,190,201,162,149,229,31,11,191,182,182,191,
+191,96,182,87,87,96,96,87,87,182,96,191,31,11,214,76,201,63,63,78,77,64,63,
+200,77,215,215,202,201,215,30,11,215,76,201,63,63,78,77,63,64,200,77,215,
+215,202,201,214,30,11,221,247,7,178,247,9,202,78,190,73,160,30,251,95,251,
+83,5,11,251,150,49,193,78,239,205,212,178,139,30,247,168,7,153,184,156,11,
+7,247,62,247,62,251,7,251,197,31,11,251,13,150,5,115,141,118,155,166,26,11,
+176,247,120,5,155,141,151,147,156,27,11,6,155,151,170,203,147,161,180,239,
+215,247,79,141,248,13,8,11,7,176,168,247,84,217,247,17,27,247,41,213,251,
+75,45,31,11,21,248,51,29,30,11,30,251,84,22,33,133,251,140,251,36,251,35,
+133,247,140,245,11,47,124,5,45,248,5,235,7,48,152,5,129,135,149,143,31,11,
+100,92,116,25,251,70,247,81,5,139,251,19,96,251,5,26,11,251,33,7,248,150,
+29,251,244,6,11,248,140,250,140,21,252,64,6,247,13,252,23,5,247,78,6,11,28,
+4,156,252,85,21,236,7,55,145,5,114,119,159,166,31,11,250,107,249,165,21,201,
+7,71,146,5,122,140,126,149,155,26,11,220,26,211,197,180,235,213,198,119,108,
+166,30,161,251,56,5,11,246,88,184,73,176,30,251,88,251,79,5,59,96,156,229,
+31,11,7,251,64,205,59,247,74,248,104,29,30,14,248,66,248,57,29,190,28,4,216,
+21,52,248,80,252,203,226,249,34,7,14,248,219,251,196,21,226,252,80,248,203,
+52,253,34,7,14,133,5,43,7,14,6,157,153,121,119,144,31,171,251,62,5,247,40,
+247,219,11,6,165,152,127,106,145,31,166,251,66,5,247,39,247,228,11,6,147,
+147,133,128,141,31,166,251,23,5,247,27,247,148,11,7,251,17,147,251,148,247,
+230,114,176,98,160,92,153,25,11,249,236,251,114,7,253,47,253,228,5,251,56,
+249,8,7,11,21,248,91,254,9,252,91,238,247,169,249,67,251,169,7,11,249,5,252,
+82,21,235,7,39,145,5,111,119,160,166,31,11,247,95,247,107,225,247,150,247,
+30,251,44,212,251,29,207,11,66,42,100,251,37,251,64,247,128,251,54,247,199,
+247,254,11,247,136,251,25,247,144,251,142,251,57,251,56,251,21,139,11,113,
+39,30,131,124,141,119,27,247,242,180,7,247,43,135,11,160,164,141,25,233,145,
+5,235,252,175,43,7,247,13,127,11,252,45,251,217,21,247,25,247,4,251,25,247,
+5,5,65,11,251,85,251,66,63,251,49,61,203,75,210,223,180,205,139,11,251,122,
+7,121,167,162,114,225,27,213,210,201,231,247,23,11,247,254,29,247,41,6,14,
+21,247,57,28,250,144,251,57,7,11,247,62,209,69,251,141,31,247,17,11,32,7,
+251,195,36,5,55,247,27,11,247,103,247,86,6,139,171,147,195,11,247,158,247,
+50,247,72,247,128,108,11,252,74,251,117,251,5,251,68,135,11,7,114,118,118,
+115,137,30,11,35,7,251,191,37,5,55,11,28,251,99,252,11,247,39,11,205,161,
+200,188,203,26,11,7,251,8,247,77,44,81,248,44,253,15,5,225,6,11,7,247,53,
+136,206,66,251,135,26,247,17,248,51,6,11,7,141,196,164,139,159,27,247,113,
+236,55,251,68,31,11,8,251,221,247,17,7,247,113,247,5,237,247,21,30,11,30,
+35,133,5,43,248,230,235,7,251,17,145,5,112,11,251,24,122,5,35,248,120,243,
+7,251,15,150,125,141,11,137,147,131,128,26,253,129,7,129,131,130,123,137,
+30,11,247,185,251,76,247,62,251,111,251,46,251,35,45,139,11,152,155,140,25,
+200,143,5,196,251,242,82,7,218,132,11,247,205,251,41,7,105,134,148,251,60,
+87,27,251,158,11,251,82,122,247,130,247,68,247,68,160,247,119,247,76,11,251,
+113,6,251,179,254,95,251,109,249,191,135,156,137,11,247,25,7,252,212,247,
+141,104,48,248,42,251,55,5,11,254,74,21,28,13,122,251,142,28,242,134,7,14,
+28,5,94,21,11,6,246,247,25,41,251,113,31,251,158,248,74,21,11,7,112,119,123,
+114,137,30,251,5,128,5,35,7,11,7,86,111,128,87,30,251,20,247,4,5,97,117,11,
+247,60,251,129,21,247,79,251,10,251,198,250,188,11,26,251,136,247,25,251,
+27,247,115,247,73,247,41,11,30,86,135,5,81,247,230,197,7,92,143,5,122,11,
+248,39,251,41,7,98,251,145,5,124,135,128,131,11,247,110,7,155,149,131,123,
+141,31,174,251,120,5,11,247,136,247,4,227,247,60,160,180,134,135,165,30,11,
+247,143,27,247,101,247,11,251,105,251,163,164,31,11,110,153,102,27,76,53,
+108,251,6,251,28,247,99,11,28,4,117,250,27,21,235,252,36,43,7,229,133,11,
+166,247,23,217,31,196,237,184,247,202,247,232,26,11,247,17,36,90,125,80,90,
+30,42,198,86,39,26,11,248,7,6,157,153,121,118,143,31,168,251,78,5,11,248,
+111,29,14,247,27,247,97,247,84,247,5,247,78,31,14,247,103,247,64,201,159,
+190,31,11,133,5,155,137,152,130,122,26,11,247,181,247,150,247,38,247,180,
+11,145,5,113,141,120,158,166,26,11,146,5,124,140,125,149,155,26,11,162,123,
+112,26,254,178,7,112,11,247,232,247,93,247,105,247,198,11,247,8,251,7,187,
+58,251,60,11,248,27,21,247,95,11,252,96,21,197,7,11,7,248,105,29,247,2,149,
+5,243,11,7,139,223,166,247,4,247,15,184,38,35,30,11,7,112,119,123,114,137,
+30,251,19,128,5,35,11,7,121,131,128,123,137,30,251,1,131,5,43,11,248,37,251,
+23,7,100,251,72,5,252,218,6,11,35,7,247,0,128,5,164,137,159,123,112,26,11,
+247,76,252,109,21,223,6,247,83,247,139,5,11,82,145,24,43,7,247,234,135,247,
+121,247,60,11,251,21,62,89,251,54,131,102,139,142,118,30,11,135,5,155,138,
+154,126,125,26,252,28,7,139,11,250,87,247,117,21,44,197,251,8,251,77,5,11,
+247,193,21,247,91,251,58,247,17,251,187,117,11,158,153,117,124,141,31,158,
+251,31,5,247,19,11,251,91,251,244,251,179,247,43,251,103,247,142,11,252,76,
+248,143,29,11,217,247,2,211,31,209,70,188,251,1,176,106,11,243,7,251,0,247,
+70,29,11,135,129,125,137,25,88,248,166,29,247,58,247,54,209,139,11,166,161,
+155,162,142,30,11,136,5,81,7,14,7,251,139,37,5,251,11,7,247,139,241,11,7,
+121,123,126,121,137,30,36,131,5,45,11,7,123,126,129,123,138,30,70,132,5,77,
+11,21,247,1,7,247,78,156,216,188,183,30,11,26,80,104,92,72,112,88,182,147,
+127,30,11,248,46,251,142,247,62,247,142,7,251,62,11,43,7,242,131,5,157,137,
+155,129,118,26,11,53,79,207,223,247,15,209,194,247,156,192,11,247,109,32,
+7,251,209,35,5,55,247,41,11,251,5,251,33,104,31,247,3,6,194,145,11,111,198,
+51,83,111,125,88,94,30,251,173,11,248,130,21,247,203,251,61,247,111,251,230,
+11,139,219,170,210,247,70,219,251,52,251,72,11,139,30,247,12,6,139,141,123,
+135,26,152,11,251,72,247,74,65,247,21,239,247,46,182,11,251,83,49,45,108,
+139,30,247,91,248,97,11,194,141,5,237,7,251,41,86,191,247,31,11,213,121,247,
+3,247,51,26,247,146,247,27,11,233,7,37,147,5,120,141,121,152,157,26,11,235,
+7,37,145,5,112,141,121,158,166,26,11,7,251,93,251,232,5,247,72,6,14,96,167,
+123,31,247,224,251,73,5,14,247,42,247,66,247,30,139,11,249,230,219,21,223,
+251,42,11,7,133,194,180,141,178,27,11,21,197,7,79,143,5,123,11,251,205,36,
+5,55,247,35,11,71,7,251,96,77,5,88,11,247,152,247,64,247,13,139,11,143,5,
+196,251,219,82,7,11,143,5,123,124,151,155,31,11,151,155,31,248,32,7,139,11,
+28,6,11,21,201,11,7,112,120,120,113,137,30,38,133,5,11,7,251,96,77,5,88,234,
+253,87,7,11,249,234,21,221,248,115,5,215,102,192,11,21,28,7,155,251,57,28,
+248,101,7,11,27,247,155,247,57,247,23,246,196,31,11,30,117,116,141,123,27,
+249,2,7,143,11,31,251,144,251,217,251,97,247,215,5,11,59,30,251,88,247,79,
+5,73,102,88,11,251,228,247,39,7,166,247,66,5,172,11,248,107,247,123,243,247,
+103,30,247,21,11,112,251,66,5,119,135,116,110,121,27,11,251,33,104,31,247,
+3,6,194,145,178,11,127,154,147,153,153,141,247,11,149,24,11,137,141,125,30,
+47,7,139,184,145,180,11,247,181,247,111,247,88,247,70,139,31,11,251,56,7,
+139,247,41,247,7,247,99,11,156,149,131,123,141,31,176,251,120,5,11,169,247,
+38,5,169,145,144,148,167,27,11,251,95,26,92,102,55,251,31,67,88,11,247,21,
+7,247,103,247,123,35,252,107,11,242,251,89,247,133,247,134,239,247,89,11,
+7,139,247,250,215,247,244,26,14,21,248,13,251,19,252,13,7,14,21,247,22,252,
+15,251,22,7,14,247,84,199,231,82,92,167,30,14,247,17,178,199,104,111,157,
+30,14,135,5,81,7,14,21,247,82,29,11,6,166,159,155,164,142,30,247,0,149,5,
+243,11,247,172,29,14,8,247,195,7,163,159,160,164,141,30,223,145,5,11,241,
+7,139,71,125,74,251,1,80,186,247,23,30,248,193,11,247,240,29,60,198,79,219,
+219,199,203,214,30,14,247,78,163,205,180,200,30,247,95,251,82,5,248,43,29,
+14,21,188,29,247,21,11,247,240,29,60,198,79,219,219,199,203,214,30,247,73,
+11,247,112,29,82,48,107,44,32,26,11,251,216,90,29,247,100,11,7,247,82,29,
+252,177,43,7,223,247,22,29,11,22,243,247,160,29,11,247,255,29,250,215,247,
+173,29,11,7,247,159,29,248,169,235,7,65,246,29,247,170,7,11,247,254,29,247,
+41,248,160,6,35,247,105,29,250,178,7,166,11,28,4,184,22,235,7,247,30,29,11,
+247,180,29,251,166,251,220,5,94,248,196,11,7,139,251,5,157,247,209,29,247,
+36,247,19,156,170,30,251,11,11,248,42,29,6,247,90,29,254,215,6,112,117,123,
+114,137,30,251,11,128,5,35,11,147,29,247,226,252,160,5,63,11,247,169,29,251,
+238,7,37,64,76,55,35,75,208,235,30,250,58,7,166,11,235,252,180,43,7,223,247,
+22,29,251,173,252,25,247,173,247,113,29,252,179,43,7,233,133,5,164,137,159,
+118,115,26,11,28,5,233,28,4,246,21,243,252,231,35,7,245,129,5,164,136,159,
+123,112,26,252,64,252,199,248,64,7,166,159,155,164,142,30,247,0,149,5,243,
+252,234,35,7,246,129,5,11,247,82,29,252,177,43,7,223,247,22,29,251,52,7,251,
+13,87,100,57,57,76,189,247,2,30,248,226,7,247,82,29,11,87,29,14,248,65,29,
+123,27,252,126,6,249,81,250,250,5,247,13,254,117,252,9,247,41,7,176,247,116,
+5,155,141,149,147,156,27,248,88,6,253,82,254,252,5,251,13,7,14,243,7,251,
+19,150,5,117,141,114,247,117,29,164,155,161,142,30,247,19,149,5,243,253,19,
+35,7,247,19,129,5,164,136,159,123,112,26,254,178,248,88,29,7,14,60,29,127,
+247,40,228,29,14,111,29,14,175,29,248,60,243,7,251,45,150,251,224,248,101,
+108,182,80,165,63,152,25,202,173,205,211,178,221,11,7,247,187,251,52,192,
+251,128,247,115,29,30,248,37,29,247,56,169,251,4,61,137,30,139,137,90,108,
+26,252,199,251,17,76,49,251,76,26,251,54,247,12,36,247,40,247,72,247,68,247,
+19,139,30,166,37,5,11,235,105,29,247,195,7,163,159,160,164,141,30,223,145,
+5,11,85,29,247,94,248,205,112,29,14,111,29,248,56,22,186,77,182,55,53,61,
+67,139,30,251,119,252,137,5,247,60,6,247,240,248,64,5,149,151,150,157,164,
+26,14,243,7,251,19,150,5,117,141,114,247,117,29,164,155,161,142,30,247,19,
+149,5,243,253,19,35,7,247,19,129,5,164,136,159,123,112,26,254,178,248,88,
+29,7,28,5,94,22,248,194,29,21,227,67,209,51,51,69,69,51,51,209,67,227,227,
+211,211,227,30,247,9,28,250,178,21,194,29,250,246,28,5,78,21,227,67,209,51,
+51,69,69,51,51,209,67,227,227,211,211,227,30,247,9,28,250,178,21,194,29,250,
+246,28,5,78,21,227,67,209,51,51,69,69,51,51,209,67,227,227,211,211,227,30,
+247,9,28,250,178,21,194,29,14,2,0,1,0,227,0,237,0,1,1,10,0,2,1,44,0,0,1,58,
+0,0,1,64,0,5,1,135,7,61,0,0,8,48,3,0,0,1,0,0,27,0,0,30,0,0,36,0,0,74,0,0,
+185,0,1,80,0,1,175,0,2,90,0,2,94,0,2,146,0,2,198,0,3,34,0,3,66,0,3,72,0,3,
+77,0,3,87,0,3,107,0,3,179,0,3,229,0,4,32,0,4,169,0,4,201,0,5,33,0,5,135,0,
+5,169,0,6,54,0,6,155,0,6,164,0,6,176,0,6,208,0,6,227,0,7,4,0,7,91,0,8,16,
+0,8,21,0,8,26,0,8,31,0,8,36,0,8,40,0,8,44,0,8,49,0,8,54,0,8,59,0,8,63,0,8,
+68,0,8,72,0,8,76,0,8,81,0,8,86,0,8,90,0,8,94,0,8,99,0,8,103,0,8,107,0,8,112,
+0,8,117,0,8,122,0,8,127,0,8,132,0,8,136,0,8,160,0,8,183,0,8,207,0,8,215,0,
+8,223,0,8,227,0,8,231,0,8,235,0,8,240,0,8,244,0,8,248,0,8,253,0,9,1,0,9,5,
+0,9,10,0,9,16,0,9,20,0,9,25,0,9,30,0,9,34,0,9,38,0,9,42,0,9,45,0,9,50,0,9,
+55,0,9,60,0,9,64,0,9,68,0,9,73,0,9,77,0,9,81,0,9,86,0,9,211,0,9,219,0,10,
+87,0,10,163,0,10,217,0,11,72,0,11,166,0,11,186,0,12,50,0,12,130,0,13,30,0,
+13,167,0,13,185,0,14,18,0,14,34,0,14,42,0,14,50,0,14,136,0,14,202,0,14,215,
+0,14,226,0,15,39,0,15,43,0,15,86,0,15,119,0,15,152,0,15,240,0,15,244,0,16,
+3,0,16,70,0,16,167,0,17,0,0,17,8,0,17,17,0,17,25,0,17,34,0,17,43,0,17,52,
+0,17,61,0,17,70,0,17,80,0,17,86,0,17,95,0,17,103,0,17,112,0,17,127,0,17,132,
+0,17,157,0,17,197,0,17,202,0,18,97,0,18,118,0,18,123,0,18,128,0,18,197,0,
+18,201,0,19,92,0,19,233,0,20,23,0,20,42,0,20,148,0,21,19,0,21,23,0,21,106,
+0,21,145,0,21,224,0,22,34,0,22,89,0,22,113,0,22,166,0,22,186,0,22,243,0,23,
+63,0,23,137,0,23,148,0,23,242,0,24,34,0,24,137,0,24,222,0,24,232,0,24,242,
+0,24,252,0,25,6,0,25,17,0,25,27,0,25,37,0,25,47,0,25,57,0,25,67,0,25,77,0,
+25,88,0,25,99,0,25,110,0,25,121,0,25,131,0,25,140,0,25,149,0,25,158,0,25,
+168,0,25,178,0,25,187,0,25,197,0,25,207,0,25,217,0,25,227,0,25,237,0,25,247,
+0,26,1,0,26,10,0,26,19,0,26,28,0,26,36,0,26,46,0,26,55,0,26,65,0,26,74,0,
+26,83,0,26,92,0,26,100,0,26,111,0,26,121,0,26,132,0,26,142,0,26,152,0,26,
+160,0,26,169,0,26,178,0,26,186,0,26,195,0,26,204,0,26,214,0,26,223,0,26,233,
+0,26,241,0,26,249,0,27,1,0,27,12,0,27,29,0,27,39,0,27,68,0,27,164,0,27,224,
+0,28,145,0,28,158,0,29,20,0,29,60,0,29,82,0,29,217,0,30,79,0,30,94,0,30,161,
+0,31,41,0,31,81,0,31,121,0,31,235,0,31,238,0,31,242,0,32,98,0,32,199,0,32,
+203,0,32,247,0,33,41,0,33,46,0,33,49,0,33,94,0,34,254,0,35,2,0,35,100,0,35,
+108,0,35,115,0,35,124,0,35,139,0,35,148,0,35,157,0,35,172,0,35,186,0,35,195,
+0,35,204,0,35,218,0,35,232,0,35,246,0,36,4,0,36,19,0,36,28,0,36,37,0,36,46,
+0,36,55,0,36,70,0,36,86,0,36,101,0,36,111,0,36,119,0,36,127,0,36,136,0,36,
+145,0,36,154,0,36,177,0,37,57,0,37,161,0,37,212,0,38,66,0,38,103,0,38,164,
+0,38,211,0,39,65,0,39,167,0,39,174,0,39,236,0,39,249,0,40,82,0,40,177,0,41,
+8,0,41,13,0,41,22,0,41,31,0,41,192,0,42,77,0,42,206,0,42,211,0,43,35,0,43,
+113,0,43,123,0,43,133,0,43,143,0,43,159,0,43,174,0,43,192,0,43,202,0,43,212,
+0,43,227,0,43,242,0,44,1,0,44,17,0,44,35,0,44,45,0,44,55,0,44,65,0,44,75,
+0,44,91,0,44,101,0,44,117,0,44,128,0,44,138,0,44,149,0,44,159,0,44,170,0,
+44,185,0,45,17,0,45,109,0,45,198,0,46,5,0,46,47,0,46,114,0,46,184,0,47,68,
+0,47,111,0,47,203,0,47,208,0,48,90,0,48,150,0,48,160,0,48,170,0,48,240,0,
+48,249,0,49,2,0,49,10,0,49,30,0,49,59,0,49,73,0,49,183,0,49,252,0,50,15,0,
+50,47,0,50,159,0,50,184,0,50,246,0,51,70,0,51,196,0,51,201,0,51,211,0,52,
+69,0,52,74,0,52,188,0,53,5,0,53,16,0,53,25,0,53,35,0,53,66,0,53,190,0,54,
+14,0,54,153,0,54,209,0,54,230,0,54,248,0,55,48,0,55,58,0,55,112,0,55,216,
+0,56,98,0,56,103,0,56,114,0,57,0,0,57,8,0,57,16,0,57,151,0,57,156,0,57,161,
+0,57,169,0,57,176,0,57,186,0,57,195,0,57,205,0,57,216,0,57,232,0,57,246,0,
+58,11,0,58,83,0,58,93,0,58,168,0,58,244,0,59,97,0,59,218,0,59,226,0,60,45,
+0,60,67,0,60,109,0,60,114,0,60,125,0,60,210,0,61,59,0,61,64,0,61,74,0,61,
+79,0,61,84,0,61,174,0,61,185,0,61,196,0,61,207,0,61,218,0,61,234,0,61,247,
+0,62,70,0,62,82,0,62,142,0,63,22,0,63,175,0,64,52,0,64,164,0,64,186,0,65,
+46,0,65,158,0,65,163,0,65,250,0,66,94,0,66,104,0,66,213,0,66,218,0,66,228,
+0,66,232,0,66,236,0,66,244,0,66,251,0,67,3,0,67,13,0,67,23,0,67,32,0,67,41,
+0,67,51,0,67,93,0,67,97,0,67,117,0,67,135,0,67,160,0,67,199,0,67,244,0,68,
+40,0,68,183,0,68,226,0,68,250,0,69,6,0,69,18,0,69,73,0,69,182,0,70,35,0,70,
+88,0,70,91,0,70,94,0,70,204,0,71,67,0,71,72,0,71,143,0,71,182,0,71,192,0,
+71,202,0,71,212,0,71,221,0,71,231,0,71,241,0,71,245,0,71,249,0,72,46,0,72,
+128,0,72,220,0,72,233,0,72,246,0,73,4,0,73,24,0,73,74,0,73,157,0,73,162,0,
+73,177,0,73,212,0,74,38,0,74,82,0,74,247,0,75,244,0,75,248,0,76,65,0,76,73,
+0,76,80,0,76,88,0,76,97,0,76,106,0,76,115,0,76,130,0,76,144,0,76,159,0,76,
+168,0,76,177,0,76,186,0,76,195,0,76,204,0,76,213,0,76,228,0,76,243,0,76,252,
+0,77,4,0,77,12,0,77,22,0,77,31,0,77,39,0,77,108,0,77,116,0,77,131,0,77,153,
+0,77,164,0,77,174,0,77,182,0,77,219,0,77,222,0,77,225,0,77,228,0,78,44,0,
+78,116,0,78,125,0,78,153,0,79,35,0,79,124,0,79,132,0,79,221,0,79,233,0,79,
+241,0,80,79,0,80,92,0,80,176,0,81,26,0,81,118,0,81,201,0,82,46,0,82,183,0,
+82,188,0,82,197,0,82,238,0,83,18,0,83,72,0,83,76,0,83,160,0,83,191,0,83,201,
+0,83,211,0,83,221,0,83,231,0,83,247,0,84,6,0,84,19,0,84,29,0,84,39,0,84,49,
+0,84,59,0,84,69,0,84,79,0,84,95,0,84,111,0,84,121,0,84,131,0,84,141,0,84,
+150,0,84,157,0,84,164,0,84,171,0,84,186,0,84,195,0,84,208,0,85,49,0,85,58,
+0,85,97,0,85,192,0,85,224,0,86,55,0,86,153,0,86,157,0,86,161,0,86,172,0,87,
+49,0,87,180,0,88,64,0,88,68,0,88,78,0,88,119,0,88,149,0,88,201,0,89,23,0,
+89,33,0,89,56,0,89,66,0,89,129,0,89,162,0,89,167,0,89,177,0,89,232,0,90,24,
+0,90,42,0,90,65,0,90,98,0,90,129,0,90,165,0,90,209,0,91,32,0,91,41,0,91,102,
+0,91,126,0,91,160,0,91,239,0,91,243,0,92,49,0,92,79,0,92,87,0,92,137,0,92,
+155,0,92,177,0,92,206,0,93,93,0,93,102,0,93,111,0,93,120,0,93,129,0,93,138,
+0,93,147,0,93,158,0,94,41,0,94,155,0,94,161,0,94,250,0,95,8,0,95,50,0,95,
+216,0,96,69,0,96,180,0,97,28,0,97,131,0,97,168,0,97,179,0,97,189,0,97,200,
+0,97,211,0,97,221,0,97,232,0,97,242,0,98,42,0,98,156,0,98,238,0,99,54,0,99,
+138,0,100,35,0,100,144,0,100,253,0,101,99,0,101,180,0,101,188,0,101,195,0,
+101,204,0,101,214,0,101,224,0,101,233,0,101,242,0,101,251,0,102,1,0,102,8,
+0,102,26,0,102,73,0,102,120,0,102,214,0,102,238,0,103,55,0,103,114,0,103,
+161,0,103,164,0,103,215,0,103,236,0,104,59,0,104,147,0,104,168,0,104,210,
+0,104,214,0,105,2,0,105,5,0,105,29,0,105,61,0,105,78,0,105,92,0,105,188,0,
+105,222,0,106,9,0,106,31,0,106,99,0,106,110,0,106,126,0,106,192,0,106,221,
+0,106,243,0,106,247,0,107,15,0,107,66,0,107,71,0,107,75,0,107,79,0,107,149,
+0,107,160,0,107,171,0,107,182,0,107,192,0,107,202,0,107,209,0,107,217,0,108,
+21,0,108,64,0,109,197,0,109,219,0,109,223,0,110,11,0,110,32,0,110,209,0,110,
+238,0,110,242,0,110,254,0,111,39,0,111,53,0,111,75,0,111,79,0,111,95,0,111,
+210,0,111,241,0,112,6,0,112,54,0,112,66,0,112,79,0,112,130,0,112,162,0,112,
+177,0,112,188,0,112,212,0,112,216,0,112,221,0,112,226,0,113,23,0,113,32,0,
+113,39,0,113,49,0,113,59,0,113,70,0,113,81,0,113,92,0,113,110,0,113,121,0,
+113,138,0,113,149,0,113,157,0,113,165,0,113,175,0,113,189,0,113,238,0,114,
+30,0,114,97,0,114,162,0,114,170,0,114,179,0,114,189,0,114,199,0,114,212,0,
+114,239,0,115,29,0,115,71,0,115,181,0,115,186,0,115,191,0,115,228,0,115,233,
+0,116,20,0,116,35,0,116,92,0,116,103,0,116,114,0,116,125,0,116,136,0,116,
+147,0,116,165,0,116,176,0,116,193,0,116,204,0,116,215,0,116,223,0,116,231,
+0,116,241,0,117,22,0,117,55,0,117,125,0,117,145,0,117,154,0,117,162,0,117,
+173,0,117,183,0,117,193,0,117,252,0,118,91,0,118,155,0,118,161,0,118,169,
+0,118,178,0,118,186,0,118,195,0,118,211,0,119,20,0,119,128,0,119,133,0,119,
+141,0,119,208,0,120,49,0,120,122,0,120,154,0,120,189,0,120,224,0,121,32,0,
+121,57,0,121,85,0,121,133,0,121,176,0,122,13,0,122,38,0,122,42,0,122,107,
+0,122,175,0,122,185,0,122,219,0,123,0,0,123,101,0,123,123,0,123,184,0,123,
+219,0,124,8,0,124,95,0,124,124,0,124,154,0,124,199,0,124,222,0,124,249,0,
+125,71,0,125,159,0,125,243,0,125,253,0,126,7,0,126,16,0,126,22,0,126,30,0,
+126,56,0,126,101,0,126,168,0,126,216,0,127,32,0,127,83,0,127,105,0,127,187,
+0,127,190,0,127,193,0,127,203,0,127,223,0,127,248,0,128,26,0,128,139,0,128,
+214,0,129,25,0,129,30,0,129,40,0,129,50,0,129,70,0,129,152,0,129,238,0,129,
+248,0,130,3,0,130,13,0,130,20,0,130,29,0,130,76,0,130,155,0,130,218,0,131,
+37,0,131,116,0,131,143,0,131,246,0,132,117,0,132,122,0,132,132,0,132,152,
+0,132,181,0,132,221,0,133,77,0,133,153,0,133,227,0,133,232,0,133,242,0,133,
+252,0,134,17,0,134,22,0,134,35,0,134,74,0,134,85,0,134,95,0,134,106,0,134,
+114,0,134,128,0,134,138,0,134,147,0,134,158,0,134,188,0,134,223,0,134,255,
+0,135,30,0,135,78,0,135,171,0,135,195,0,135,241,0,136,72,0,136,121,0,136,
+163,0,136,199,0,136,244,0,137,16,0,137,24,0,137,76,0,137,115,0,137,187,0,
+138,24,0,138,73,0,138,186,0,139,45,0,139,178,0,140,31,0,140,35,0,140,85,0,
+140,106,0,140,164,0,140,174,0,140,183,0,140,192,0,140,199,0,140,212,0,140,
+221,0,140,231,0,140,241,0,141,13,0,141,57,0,141,116,0,141,190,0,141,237,0,
+142,31,0,142,65,0,142,127,0,142,136,0,142,145,0,142,210,0,142,215,0,143,96,
+0,143,104,0,143,110,0,143,120,0,143,131,0,143,139,0,143,160,0,143,230,0,144,
+179,0,144,208,0,145,6,0,145,48,0,145,67,0,145,209,0,145,230,0,146,86,0,146,
+242,0,146,248,0,147,1,0,147,5,0,147,9,0,147,97,0,147,214,0,147,224,0,147,
+235,0,147,243,0,148,43,0,148,47,0,148,169,0,149,27,0,149,132,0,149,141,0,
+150,67,0,150,144,0,150,177,0,150,187,0,150,196,0,150,206,0,150,215,0,150,
+224,0,150,233,0,150,239,0,150,247,0,151,45,0,151,162,0,151,243,0,152,26,0,
+152,105,0,152,201,0,152,218,0,153,12,0,153,53,0,153,97,0,153,184,0,153,216,
+0,153,253,0,154,5,0,154,10,0,154,20,0,154,31,0,154,70,0,154,81,0,154,92,0,
+154,161,0,154,236,0,155,65,0,155,75,0,155,85,0,155,95,0,155,105,0,155,116,
+0,155,127,0,155,138,0,155,149,0,156,67,0,156,165,0,156,226,0,157,1,0,157,
+89,0,157,179,0,157,197,0,157,214,0,157,223,0,157,235,0,158,161,0,158,166,
+0,158,176,0,158,184,0,158,217,0,158,228,0,158,239,0,158,243,0,159,49,0,159,
+57,0,159,64,0,159,73,0,159,82,0,159,91,0,159,100,0,159,115,0,159,129,0,159,
+144,0,159,152,0,159,160,0,159,169,0,159,183,0,159,193,0,159,203,0,159,212,
+0,159,226,0,159,240,0,159,249,0,160,8,0,160,16,0,160,30,0,160,38,0,160,46,
+0,160,88,0,160,113,0,160,239,0,160,242,0,160,245,0,161,32,0,161,41,0,161,
+128,0,161,232,0,162,61,0,162,146,0,162,154,0,163,56,0,163,144,0,163,207,0,
+163,212,0,163,221,0,163,230,0,163,240,0,163,249,0,164,2,0,164,80,0,164,227,
+0,165,45,0,165,167,0,166,39,0,166,186,0,167,50,0,167,132,0,168,24,0,168,67,
+0,168,101,0,168,145,0,168,188,0,168,193,0,169,12,0,169,86,0,169,96,0,169,
+105,0,169,114,0,169,123,0,169,138,0,169,152,0,169,169,0,169,178,0,169,188,
+0,169,198,0,169,213,0,169,224,0,169,235,0,169,244,0,170,3,0,170,18,0,170,
+27,0,170,42,0,170,52,0,170,68,0,170,79,0,170,89,0,170,98,0,170,114,0,170,
+118,0,170,122,0,170,132,0,171,1,0,171,82,0,171,172,0,171,181,0,172,21,0,172,
+119,0,172,124,0,172,133,0,172,143,0,172,153,0,172,164,0,172,174,0,173,73,
+0,173,211,0,174,82,0,174,231,0,175,123,0,175,238,0,176,102,0,176,106,0,176,
+216,0,177,63,0,177,67,0,177,166,0,178,10,0,178,18,0,178,27,0,178,48,0,178,
+154,0,178,180,0,178,251,0,179,44,0,179,65,0,179,109,0,179,138,0,180,0,0,180,
+112,0,180,179,0,181,24,0,181,117,0,181,197,0,182,90,0,182,229,0,183,131,0,
+183,244,0,183,252,0,184,4,0,184,108,0,184,112,0,184,194,0,184,198,0,184,202,
+0,184,210,0,184,219,0,185,36,0,185,90,0,185,150,0,186,22,0,186,129,0,186,
+221,0,187,11,0,187,89,0,187,205,0,188,81,0,188,224,0,189,6,0,189,44,0,189,
+113,0,189,209,0,190,123,0,190,126,0,190,161,0,190,223,0,191,38,0,191,97,0,
+191,208,0,191,241,0,191,245,0,192,102,0,192,165,0,192,236,0,193,50,0,193,
+119,0,193,128,0,193,135,0,193,144,0,193,154,0,193,163,0,193,172,0,193,181,
+0,193,192,0,193,202,0,193,219,0,193,229,0,193,251,0,194,24,0,194,32,0,194,
+73,0,194,103,0,194,138,0,194,236,0,195,41,0,195,103,0,195,113,0,195,138,0,
+195,152,0,195,170,0,195,217,0,196,6,0,196,24,0,196,69,0,196,74,0,196,84,0,
+196,157,0,196,204,0,196,234,0,197,83,0,197,143,0,197,152,0,197,162,0,197,
+171,0,197,181,0,197,190,0,197,201,0,197,211,0,197,228,0,197,238,0,197,255,
+0,198,108,0,198,154,0,198,251,0,199,51,0,199,118,0,199,123,0,199,143,0,200,
+35,0,200,196,0,201,16,0,201,130,0,202,9,0,202,152,0,203,27,0,203,113,0,203,
+222,0,203,225,0,203,228,0,204,129,0,204,254,0,205,16,0,205,107,0,205,199,
+0,205,208,0,205,223,0,205,232,0,205,246,0,206,0,0,206,10,0,206,26,0,206,36,
+0,206,45,0,206,150,0,207,9,0,207,95,0,207,149,0,207,239,0,208,44,0,208,159,
+0,208,168,0,208,248,0,209,27,0,209,41,0,209,173,0,210,110,0,210,114,0,210,
+229,0,210,239,0,210,255,0,211,7,0,211,21,0,211,31,0,211,40,0,211,55,0,211,
+64,0,211,73,0,211,143,0,211,209,0,212,77,0,212,230,0,213,234,0,213,252,0,
+214,5,0,214,13,0,214,23,0,214,34,0,214,43,0,214,53,0,214,63,0,214,73,0,214,
+83,0,214,92,0,214,132,0,214,171,0,214,206,0,214,215,0,215,37,0,215,99,0,215,
+119,0,215,207,0,215,251,0,216,17,0,216,172,0,217,10,0,217,81,0,217,121,0,
+217,189,0,217,245,0,218,1,0,218,14,0,218,45,0,218,102,0,218,106,0,218,176,
+0,218,235,0,218,243,0,219,20,0,219,29,0,219,38,0,219,47,0,219,57,0,219,67,
+0,219,77,0,219,120,0,219,193,0,219,204,0,220,36,0,220,72,0,220,130,0,220,
+204,0,221,19,0,221,40,0,221,61,0,221,119,0,221,237,0,222,98,0,222,160,0,222,
+168,0,222,175,0,222,185,0,222,194,0,222,203,0,222,213,0,222,223,0,222,233,
+0,222,248,0,223,2,0,223,18,0,223,34,0,223,50,0,223,61,0,223,77,0,223,87,0,
+223,96,0,223,105,0,223,112,0,223,120,0,223,126,0,223,135,0,223,149,0,223,
+221,0,224,35,0,224,40,0,224,50,0,224,59,0,224,69,0,224,79,0,224,90,0,224,
+146,0,224,153,0,224,222,0,225,17,0,225,88,0,225,160,0,225,221,0,226,52,0,
+226,136,0,226,246,0,227,76,0,227,116,0,227,194,0,227,203,0,227,213,0,227,
+223,0,227,233,0,227,243,0,227,253,0,228,12,0,228,22,0,228,38,0,228,54,0,228,
+70,0,228,81,0,228,97,0,228,108,0,228,118,0,228,129,0,228,140,0,228,152,0,
+228,163,0,228,174,0,228,255,0,229,65,0,229,70,0,229,80,0,229,89,0,229,99,
+0,229,109,0,229,120,0,229,209,0,230,17,0,230,65,0,230,91,0,230,199,0,230,
+203,0,230,251,0,231,4,0,231,11,0,231,19,0,231,29,0,231,52,0,231,84,0,231,
+130,0,231,242,0,232,47,0,232,93,0,232,144,0,232,155,0,232,167,0,232,179,0,
+232,238,0,233,41,0,233,195,0,234,71,0,234,192,0,235,25,0,235,33,0,235,41,
+0,235,46,0,235,105,0,235,163,0,235,173,0,235,184,0,236,10,0,236,40,0,236,
+53,0,236,67,0,236,87,0,236,153,0,236,206,0,237,62,0,237,67,0,237,143,0,237,
+153,0,237,163,0,237,173,0,237,183,0,237,193,0,237,204,0,237,215,0,238,26,
+0,238,151,0,238,235,0,239,97,0,239,225,0,239,230,0,240,57,0,240,142,0,240,
+152,0,240,162,0,240,172,0,240,182,0,240,192,0,240,203,0,241,21,0,241,204,
+0,241,208,0,241,212,0,242,46,0,242,54,0,242,61,0,242,71,0,242,81,0,242,108,
+0,242,158,0,242,234,0,242,255,0,243,8,0,243,21,0,243,133,0,243,141,0,243,
+149,0,243,154,0,243,159,0,243,170,0,243,180,0,243,239,0,244,90,0,244,105,
+0,244,115,0,244,127,0,244,131,0,244,212,0,244,221,0,244,230,0,244,238,0,244,
+246,0,244,254,0,245,6,0,245,14,0,245,22,0,245,31,0,245,41,0,245,50,0,245,
+60,0,245,131,0,245,228,0,246,79,0,246,103,0,246,139,0,246,231,0,247,21,0,
+247,83,0,247,87,0,247,97,0,247,177,0,247,194,0,247,211,0,248,81,0,248,86,
+0,248,169,0,248,179,0,248,189,0,248,199,0,248,209,0,248,219,0,248,229,0,248,
+240,0,249,50,0,249,86,0,249,191,0,250,61,0,250,66,0,250,75,0,250,85,0,250,
+95,0,250,105,0,250,109,0,250,120,0,250,183,0,250,205,0,250,225,0,251,81,0,
+251,236,0,252,69,0,252,124,0,252,135,0,252,145,0,252,156,0,252,166,0,252,
+174,0,252,228,0,253,29,0,253,82,0,253,133,0,254,6,0,254,87,0,254,160,0,254,
+199,0,254,215,0,254,242,0,255,117,0,255,173,0,255,183,0,255,193,0,255,203,
+0,255,212,0,255,219,1,0,11,1,0,50,1,0,75,1,0,111,1,0,236,1,0,239,1,0,242,
+1,0,245,1,1,85,1,1,95,1,1,153,1,1,246,1,2,100,1,2,203,1,3,49,1,3,162,1,4,
+8,1,4,13,1,4,97,1,4,206,1,4,216,1,5,68,1,5,174,1,6,29,1,6,135,1,6,148,1,6,
+235,1,7,76,1,7,166,1,7,193,1,7,215,1,7,219,1,7,223,1,8,0,1,8,37,1,8,88,1,
+8,224,1,9,76,1,9,162,1,10,135,1,10,206,1,11,184,1,12,0,1,12,46,1,12,55,1,
+12,103,1,12,180,1,13,12,1,13,33,1,13,140,1,13,174,1,13,208,1,13,212,1,13,
+222,1,13,242,1,14,12,1,14,76,1,14,140,1,14,246,1,15,94,1,15,102,1,15,178,
+1,16,10,1,16,99,1,16,130,1,16,162,1,17,17,1,17,128,1,17,210,1,17,219,1,18,
+54,1,18,144,1,18,228,1,18,233,1,19,17,1,19,28,1,19,39,1,19,60,1,19,78,1,19,
+95,1,19,116,1,19,150,1,19,168,1,19,174,1,19,219,1,19,227,1,19,237,1,19,251,
+1,20,22,1,20,49,1,20,58,1,20,72,1,20,76,1,20,84,1,20,89,1,20,94,1,20,101,
+1,20,105,1,20,188,1,20,192,1,20,216,1,20,222,1,20,226,1,20,230,1,20,234,1,
+20,243,1,20,252,1,21,4,1,21,14,1,21,51,1,21,89,1,21,107,1,21,112,1,21,130,
+1,21,135,1,21,154,1,21,159,1,21,178,1,21,183,1,21,219,1,21,224,1,22,7,1,22,
+44,1,22,49,1,22,88,1,22,109,1,22,114,1,22,135,1,22,156,1,22,161,1,22,182,
+1,22,217,1,23,22,1,23,26,1,23,62,1,23,97,1,23,158,1,23,193,1,23,201,1,23,
+221,1,23,252,1,24,1,1,24,6,1,24,70,1,24,94,1,24,118,1,24,206,1,24,214,1,24,
+227,1,25,76,1,25,83,1,25,95,1,25,200,1,25,214,1,25,228,1,25,235,1,25,252,
+1,26,12,1,26,49,1,26,54,1,26,59,1,26,64,1,26,80,1,26,96,1,26,111,1,26,116,
+1,26,124,1,26,133,1,26,146,1,26,159,1,26,171,1,26,178,1,26,183,1,26,192,1,
+26,199,1,26,210,1,26,221,1,26,232,1,26,241,1,26,249,1,26,255,1,27,10,1,27,
+26,1,27,33,1,27,38,1,27,46,1,27,54,1,27,60,1,27,70,1,27,80,1,27,88,1,27,94,
+1,27,109,1,27,142,1,27,148,1,27,156,1,27,162,1,27,168,1,27,174,1,27,215,1,
+27,223,1,28,15,1,28,45,1,28,72,1,28,124,1,28,130,1,28,137,1,28,149,1,28,190,
+1,28,198,1,28,205,1,28,213,1,28,245,1,28,252,1,29,1,1,29,8,1,29,38,1,29,65,
+1,29,108,1,29,137,1,29,166,1,29,226,1,30,31,1,30,38,1,30,42,1,30,77,1,30,
+84,1,30,159,1,30,163,1,30,167,1,30,174,1,30,180,1,30,200,1,30,232,1,31,2,
+1,31,33,1,31,84,1,31,116,1,31,200,1,31,207,1,31,216,1,32,11,1,32,72,1,32,
+131,1,32,139,1,32,145,1,32,154,1,32,161,1,32,168,1,32,176,1,32,182,1,32,196,
+1,32,204,1,32,208,1,32,233,1,32,248,1,33,19,1,33,40,1,33,48,1,33,58,1,33,
+131,1,33,158,1,33,202,1,33,207,1,33,214,1,33,218,1,33,225,1,33,234,1,33,240,
+1,33,247,1,34,0,1,34,26,1,34,34,1,34,40,1,34,48,1,34,156,1,34,163,1,34,171,
+1,34,181,1,34,189,1,34,195,1,34,204,1,34,213,1,34,220,1,35,19,1,35,70,1,35,
+88,1,35,105,1,35,112,1,35,119,1,35,126,1,35,133,1,35,140,1,35,148,1,35,177,
+1,35,194,1,35,204,1,35,225,1,35,248,1,36,13,1,36,36,1,36,57,1,36,78,1,36,
+101,1,36,118,1,36,125,1,36,134,1,36,171,1,36,222,1,37,3,1,37,21,1,37,48,1,
+37,74,1,37,82,1,37,94,1,37,111,1,37,115,1,37,121,1,37,198,1,37,205,1,37,212,
+1,37,233,1,37,254,1,38,22,1,38,75,1,38,89,1,38,101,1,38,113,1,38,125,1,38,
+136,1,38,150,1,38,162,1,38,174,1,38,186,1,38,197,1,38,206,1,38,214,1,38,222,
+1,38,230,1,38,237,1,38,246,1,38,254,1,39,6,1,39,14,1,39,21,1,39,110,1,39,
+126,1,39,142,1,39,184,1,39,208,1,39,233,1,40,4,1,40,27,1,40,44,1,40,82,1,
+40,100,1,40,116,1,40,134,1,40,150,1,40,166,1,40,176,1,40,193,1,40,218,1,40,
+236,1,40,250,1,41,31,1,41,78,1,41,111,1,41,145,1,41,187,1,41,220,1,42,2,1,
+42,50,1,42,89,1,42,128,1,42,167,1,42,206,1,43,16,1,43,45,1,43,73,1,43,82,
+1,43,113,1,43,121,1,43,148,1,43,155,1,43,183,1,43,211,1,43,220,1,43,228,1,
+43,234,1,44,6,1,44,34,1,44,46,1,44,79,1,44,212,1,45,89,1,45,167,1,46,12,1,
+46,20,1,46,28,1,46,36,1,46,44,1,46,62,1,46,114,1,46,132,1,46,150,1,46,151,
+1,46,152,1,46,153,1,46,154,1,46,155,1,46,156,1,46,157,1,46,158,1,46,159,1,
+46,160,1,46,161,1,46,162,1,46,163,1,46,164,1,46,165,1,46,166,1,46,167,1,46,
+168,1,46,169,1,46,170,1,46,171,1,46,172,1,46,173,1,46,176,1,46,179,1,46,182,
+1,46,185,1,46,188,1,46,191,1,46,194,1,46,197,1,46,200,1,46,202,1,46,205,1,
+46,209,1,47,82,1,47,87,1,47,92,1,47,97,1,47,102,1,47,198,247,103,239,22,28,
+4,176,28,7,8,28,251,80,6,189,89,21,250,224,28,249,92,254,224,6,14,252,225,
+14,252,129,248,152,243,10,252,22,249,19,248,142,29,55,57,104,86,63,30,219,
+252,115,5,251,217,22,218,248,115,5,215,103,192,57,57,104,86,63,30,219,252,
+115,5,14,247,221,28,5,111,249,228,21,247,27,251,161,7,247,46,248,68,251,33,
+178,251,44,252,107,5,251,158,6,247,43,248,70,251,29,176,251,50,252,107,5,
+251,238,251,27,247,195,6,51,251,162,5,251,207,251,21,247,166,6,251,45,252,
+97,247,29,102,247,52,248,134,5,247,148,6,251,44,252,99,247,34,104,247,47,
+248,134,5,247,255,247,21,251,210,6,227,247,162,5,251,35,22,45,251,162,5,251,
+146,6,229,247,162,5,14,152,250,218,248,56,21,247,179,251,200,216,251,27,176,
+30,248,58,7,170,247,48,108,121,143,31,178,251,119,5,247,33,247,234,6,139,
+251,97,198,251,58,30,247,44,251,13,251,44,7,139,252,43,123,252,11,26,251,
+169,247,146,62,247,45,94,30,252,87,7,139,251,39,141,55,192,30,96,247,132,
+5,251,37,251,246,6,247,68,81,247,135,129,139,26,251,101,247,13,247,103,7,
+247,152,176,247,75,247,39,247,126,26,252,200,248,66,21,139,251,39,174,247,
+58,26,247,68,247,39,149,139,30,247,196,254,15,21,251,91,251,75,125,139,30,
+248,50,7,209,120,247,5,92,251,27,26,14,249,22,28,6,236,248,31,21,247,159,
+251,11,247,53,251,126,251,125,251,7,251,53,251,159,251,158,247,7,251,54,247,
+125,247,126,247,11,247,54,247,158,30,251,249,250,103,21,251,39,6,253,230,
+28,250,162,5,247,37,6,247,91,247,53,10,249,166,252,220,21,251,144,86,59,63,
+66,73,219,247,144,247,144,205,219,212,215,192,59,251,144,30,254,131,247,156,
+10,14,247,208,28,5,193,22,243,7,251,58,156,251,85,247,99,5,139,247,17,247,
+17,205,247,107,30,247,33,167,5,236,252,66,42,7,245,121,147,137,154,118,137,
+127,25,114,251,19,55,37,139,26,251,207,247,219,5,165,143,247,173,199,247,
+166,26,247,146,251,138,207,251,51,251,134,251,95,251,13,251,119,251,92,247,
+73,251,10,148,133,30,251,65,84,251,7,36,251,86,26,251,134,247,70,251,52,247,
+156,247,156,247,48,247,62,139,30,225,43,5,90,7,251,62,247,125,21,139,76,58,
+251,30,251,37,251,48,225,247,125,247,21,236,196,139,30,247,213,248,54,21,
+251,8,92,70,55,64,30,251,33,247,21,85,223,229,26,233,209,205,233,240,200,
+49,251,5,30,14,253,6,242,10,252,22,249,113,251,183,21,247,3,7,251,181,178,
+76,247,203,248,56,26,248,56,202,247,201,247,181,178,30,247,2,7,252,39,127,
+251,101,251,224,252,170,26,252,171,247,101,251,228,248,39,129,30,14,252,22,
+249,62,248,226,21,248,170,251,103,247,224,252,37,151,30,251,2,7,247,178,100,
+205,251,201,252,56,26,252,56,73,251,203,251,178,100,30,251,3,7,248,37,149,
+247,103,247,228,248,171,26,14,251,57,250,39,28,4,145,21,251,43,199,251,109,
+251,52,153,108,247,156,137,5,251,103,247,204,21,37,247,14,37,251,14,223,251,
+148,5,173,6,247,132,251,132,21,251,111,247,52,114,114,221,251,146,247,48,
+98,5,251,179,248,11,21,251,111,247,54,251,39,79,227,251,25,247,158,141,5,
+176,88,21,114,164,251,111,251,52,145,251,52,247,48,180,5,14,249,239,28,6,
+102,248,187,21,247,19,252,187,248,187,251,18,252,187,252,187,251,19,248,187,
+252,187,247,18,248,187,7,14,252,174,247,6,29,14,252,153,247,16,29,252,174,
+248,107,247,37,247,67,10,14,251,55,250,150,248,58,29,251,54,6,253,244,28,
+249,228,5,247,52,6,14,152,250,254,249,66,21,248,19,251,49,247,222,252,9,252,
+7,251,47,251,222,252,19,252,21,247,47,251,218,248,7,248,9,247,49,247,218,
+248,21,30,251,191,22,251,70,129,252,48,251,113,251,111,131,248,48,247,70,
+247,70,147,248,52,247,111,247,113,149,252,52,251,70,30,14,152,250,76,22,245,
+7,251,53,146,5,114,141,118,157,164,26,28,4,225,251,43,7,252,78,251,52,5,251,
+0,7,247,197,182,5,254,148,7,114,118,121,115,137,30,251,68,132,5,33,7,14,152,
+250,236,22,248,90,29,248,42,247,158,247,195,247,114,247,184,26,247,138,251,
+97,247,52,251,152,251,70,251,214,69,247,253,29,152,194,27,247,48,237,251,
+17,251,54,251,252,252,152,251,208,251,56,251,29,31,251,62,7,14,152,250,236,
+248,29,21,247,193,251,236,170,86,137,30,194,145,247,185,196,247,153,26,247,
+137,251,134,247,7,251,115,251,150,251,109,251,17,251,62,39,213,92,225,171,
+180,143,163,176,30,247,144,7,139,209,164,178,247,41,247,5,251,7,251,23,251,
+89,251,64,84,251,46,121,122,139,141,117,30,251,45,7,139,221,149,200,247,83,
+235,251,13,251,21,251,52,251,19,251,19,251,33,83,90,162,151,94,30,74,247,
+123,5,150,116,110,147,103,27,75,51,112,251,6,251,28,247,60,251,27,247,158,
+247,197,247,177,247,52,247,158,31,14,152,250,254,248,21,21,247,58,251,59,
+248,142,10,251,68,249,8,252,52,247,153,248,54,7,251,153,247,58,248,33,10,
+14,152,250,244,248,101,21,247,129,251,101,247,56,251,185,251,29,251,37,90,
+139,30,247,222,249,86,247,119,254,4,253,97,7,139,247,54,172,247,31,247,93,
+247,55,251,4,251,75,43,47,251,101,251,129,118,53,155,139,30,74,247,136,5,
+151,102,110,146,112,27,41,88,67,78,251,69,247,107,47,247,101,247,205,247,
+191,247,81,247,201,31,14,152,250,254,248,130,21,247,86,251,35,247,113,251,
+179,251,66,251,35,37,139,30,180,247,158,247,37,247,56,247,189,159,229,129,
+24,247,52,7,252,164,145,251,246,251,172,252,173,26,252,42,247,94,251,115,
+247,237,247,168,247,125,247,101,247,210,30,251,184,77,21,251,66,67,251,50,
+251,35,251,73,66,247,122,247,82,139,132,219,148,231,30,139,221,182,247,8,
+247,77,223,251,15,251,72,30,14,152,250,124,28,4,205,21,247,37,254,174,252,
+72,247,35,7,170,247,82,5,248,228,6,253,48,28,251,119,5,247,154,201,6,14,152,
+250,252,248,13,21,247,158,251,143,207,83,159,30,242,188,247,43,211,247,87,
+26,247,135,251,121,247,9,251,107,251,132,251,154,35,251,202,251,62,247,39,
+33,221,108,30,37,108,251,74,76,251,113,26,251,124,247,109,251,64,247,189,
+247,168,247,156,247,23,247,171,30,251,197,249,33,21,251,13,80,53,98,96,30,
+251,46,207,251,51,209,247,55,26,247,1,227,227,247,0,247,23,225,251,13,251,
+19,30,166,253,105,21,251,25,251,11,65,251,19,251,39,251,13,247,25,247,52,
+247,29,233,213,164,172,30,247,19,79,247,160,70,251,93,26,14,152,250,254,249,
+156,21,248,42,251,96,247,117,251,234,251,169,251,125,251,103,251,209,251,
+87,247,33,251,113,247,181,247,68,247,31,241,139,30,98,251,158,251,35,251,
+54,251,189,119,49,149,24,251,52,7,248,164,133,247,246,247,171,248,172,26,
+251,186,215,21,139,143,57,133,49,30,139,55,96,251,7,251,76,55,247,15,247,
+72,247,66,210,247,52,247,36,247,70,215,251,119,251,87,30,14,252,174,248,107,
+247,37,247,35,10,252,174,247,6,29,114,249,111,21,247,215,29,249,239,28,6,
+102,219,21,247,19,7,254,221,248,43,250,221,248,44,5,247,19,7,28,251,52,252,
+107,5,251,19,7,14,249,239,28,6,102,249,117,247,116,29,28,4,204,252,8,247,
+116,29,14,249,239,28,6,102,248,187,21,247,19,7,28,251,52,248,107,5,251,19,
+7,250,221,252,44,254,221,252,43,5,251,19,7,14,251,12,250,62,250,142,21,247,
+129,251,93,247,44,251,156,251,58,251,109,73,251,70,251,19,247,15,135,192,
+160,143,143,139,30,231,247,138,5,247,72,227,33,251,46,251,173,251,189,76,
+139,31,251,164,247,32,247,66,7,139,248,80,229,247,240,26,251,238,254,9,21,
+231,71,219,41,51,69,65,49,51,207,61,227,229,217,207,229,30,14,249,108,28,
+7,6,249,134,21,248,49,251,177,247,132,252,80,252,130,252,92,251,220,252,234,
+252,123,248,4,251,208,248,114,247,152,247,99,228,235,247,76,30,96,241,5,43,
+251,66,251,62,63,251,107,27,252,52,251,164,247,197,248,56,248,95,247,232,
+247,218,248,66,247,144,247,184,251,56,252,23,251,222,251,94,251,81,57,65,
+145,201,229,160,31,139,247,23,248,205,151,178,30,251,64,6,112,88,5,164,86,
+69,176,76,27,251,189,251,134,251,146,251,198,251,88,238,251,36,247,78,244,
+231,209,211,223,31,63,151,178,71,247,17,27,247,133,247,179,247,138,248,42,
+31,253,11,180,21,57,252,56,5,90,98,88,63,51,27,76,71,198,247,46,247,146,247,
+29,247,78,247,56,209,168,63,107,132,31,14,247,108,34,29,14,247,12,66,29,14,
+247,6,55,29,14,247,186,53,10,14,175,32,10,14,95,132,10,14,247,169,49,29,14,
+248,22,45,29,14,252,90,37,29,14,251,32,186,29,247,100,51,10,14,85,47,29,14,
+249,40,68,10,247,227,39,10,14,247,251,35,10,14,203,72,10,14,247,251,109,29,
+247,145,38,29,14,48,40,29,14,197,65,29,14,247,196,33,29,14,247,149,76,29,
+14,249,169,48,10,14,247,77,59,29,14,247,61,43,10,14,140,84,29,14,72,250,172,
+251,162,21,247,10,251,206,28,5,199,247,206,247,15,252,204,28,249,72,7,14,
+251,69,250,136,251,82,21,253,232,28,6,28,5,251,52,6,249,232,28,249,228,5,
+14,156,249,21,251,162,21,28,6,184,252,203,251,15,247,205,28,250,57,251,205,
+251,10,7,14,252,129,249,76,250,252,48,29,252,129,249,76,251,232,74,10,253,
+6,239,10,83,32,29,14,175,85,10,14,251,53,54,29,14,197,53,29,14,33,35,29,14,
+252,114,78,29,14,87,36,10,14,232,44,10,14,252,143,54,10,14,252,161,248,134,
+60,10,162,57,10,14,252,143,62,29,14,249,46,63,10,14,230,41,10,14,146,40,10,
+14,187,72,29,14,185,138,29,251,196,42,29,14,251,170,39,29,14,252,57,50,29,
+14,220,36,29,14,109,79,29,14,248,169,45,10,14,68,61,10,14,109,34,10,14,251,
+75,84,10,14,251,67,249,244,251,142,21,247,5,7,139,251,23,133,76,200,30,251,
+15,247,13,247,37,247,199,251,60,247,52,53,221,251,0,148,117,140,8,161,247,
+0,146,222,225,31,247,60,247,50,251,37,247,203,247,15,247,13,8,202,200,247,
+23,133,139,26,247,5,7,92,251,148,147,47,37,31,251,79,251,58,247,48,251,252,
+251,11,251,13,8,59,59,251,37,163,139,26,251,14,7,139,247,37,161,219,59,30,
+247,11,251,13,251,48,251,250,247,79,251,58,8,47,241,247,148,147,186,27,14,
+252,10,248,131,248,91,10,14,251,67,250,54,248,173,21,247,14,7,139,251,38,
+115,60,219,30,251,13,247,13,247,47,247,252,251,76,247,58,8,231,37,251,148,
+131,92,27,251,5,7,139,247,23,145,202,78,30,247,15,251,11,251,37,251,203,247,
+59,251,52,8,55,227,247,1,133,158,27,114,137,33,129,54,59,251,59,251,52,247,
+37,251,201,251,15,251,11,8,76,78,251,23,145,139,26,251,5,7,186,247,148,131,
+231,241,31,247,76,247,58,251,47,247,248,247,13,247,15,8,218,219,247,38,117,
+139,26,14,248,153,28,5,250,248,250,21,247,87,7,251,37,251,87,251,2,102,51,
+27,98,96,147,151,96,31,180,251,36,251,29,215,251,46,27,251,2,251,27,98,251,
+9,251,46,31,251,86,7,247,21,247,62,247,15,194,233,247,93,247,64,251,29,247,
+91,27,247,8,247,5,176,247,10,247,58,31,14,252,129,248,148,249,236,21,247,
+13,41,186,71,51,63,65,45,39,227,77,215,217,227,195,245,30,141,254,222,21,
+251,5,249,195,5,251,2,6,251,3,253,195,5,251,6,215,87,229,231,215,193,247,
+4,30,14,152,250,191,194,21,247,197,251,19,7,114,251,55,5,98,7,139,94,106,
+45,30,249,189,7,192,209,112,125,158,31,92,7,161,251,40,5,247,19,247,187,6,
+172,69,251,23,168,49,27,247,99,251,9,251,103,7,251,178,251,130,251,114,251,
+203,251,181,247,132,251,117,247,176,31,251,105,247,9,247,103,7,184,247,111,
+166,167,166,31,252,44,211,21,251,14,170,251,11,247,31,247,111,26,247,169,
+247,23,247,4,247,2,162,30,14,152,250,238,22,248,114,10,247,85,247,21,167,
+247,25,247,37,26,248,3,247,23,252,7,6,139,135,184,205,26,247,23,131,247,205,
+247,140,186,153,131,139,30,251,142,7,139,192,121,174,223,221,188,233,247,
+66,251,99,211,251,37,251,226,251,33,251,136,251,213,98,147,77,139,30,251,
+33,251,23,247,35,6,141,49,145,251,250,251,72,153,100,121,25,251,48,7,14,251,
+51,250,154,248,58,29,251,56,6,253,246,28,249,228,5,247,54,6,14,247,3,28,5,
+6,248,106,10,243,252,74,37,7,239,118,176,131,137,115,131,126,25,251,154,252,
+117,251,148,248,128,128,159,156,162,159,141,25,234,147,5,243,252,200,35,7,
+247,17,118,247,81,252,2,5,251,142,32,247,207,6,238,251,84,5,252,50,34,248,
+74,251,209,6,124,125,113,102,135,30,251,15,128,5,33,249,15,245,7,251,13,150,
+5,102,143,123,165,154,26,247,209,248,66,244,252,72,7,245,247,84,5,247,222,
+246,251,158,6,247,94,248,0,5,14,252,114,249,240,28,5,72,21,248,83,29,251,
+30,42,251,27,57,30,84,49,108,45,32,26,251,23,72,5,57,247,26,254,27,7,251,
+79,116,74,96,77,30,251,95,247,83,5,74,118,77,88,76,26,251,9,247,7,100,221,
+247,29,247,13,206,232,221,30,227,239,184,247,23,247,29,26,249,169,247,107,
+29,14,251,57,250,62,249,7,21,248,2,252,209,137,247,107,26,242,233,194,231,
+247,9,210,84,139,30,162,251,60,5,247,4,247,174,6,139,251,27,191,251,86,251,
+113,251,89,44,251,94,251,64,247,37,73,193,106,30,98,121,251,91,59,251,115,
+252,27,248,218,163,251,131,26,44,49,76,36,94,47,153,172,86,30,112,247,82,
+5,251,17,251,176,6,139,247,35,71,247,87,247,93,247,117,221,247,130,247,60,
+251,54,208,94,168,30,154,147,247,125,219,247,138,26,251,80,69,21,251,23,251,
+79,57,160,149,30,251,11,199,251,89,206,247,62,26,247,42,247,56,180,145,143,
+30,184,108,247,159,67,251,78,26,14,199,28,4,164,248,37,21,251,103,247,103,
+5,200,213,168,233,236,26,235,104,241,82,211,30,247,105,247,105,65,213,251,
+109,251,109,5,198,69,45,172,45,27,43,40,108,80,66,31,251,107,247,107,65,65,
+247,107,251,107,5,73,67,111,35,44,26,43,169,47,199,65,30,251,103,251,103,
+213,66,247,103,247,103,5,73,214,234,108,241,27,233,235,172,203,213,31,247,
+103,251,103,5,251,56,248,185,21,251,64,251,29,251,38,251,66,251,68,251,36,
+247,31,247,68,247,71,247,34,247,31,247,70,247,64,247,31,251,37,251,62,30,
+14,253,209,247,109,248,142,29,57,55,106,86,63,30,219,252,115,5,14,251,51,
+248,80,28,5,66,21,105,214,5,139,251,226,47,251,226,26,251,2,206,38,247,11,
+225,201,195,229,219,98,173,139,30,251,13,6,139,137,148,153,26,247,44,235,
+208,241,197,30,248,101,22,102,216,5,139,251,225,41,251,209,26,251,7,198,251,
+1,247,17,223,204,199,233,192,98,192,139,30,251,14,174,6,247,87,247,92,211,
+139,30,14,251,161,248,16,247,163,10,249,90,252,77,21,247,175,29,14,253,53,
+247,248,247,163,10,14,253,53,247,52,247,138,10,14,247,96,28,4,193,28,5,78,
+21,227,67,248,123,10,211,211,227,30,247,8,28,250,178,21,235,7,41,145,5,114,
+141,117,160,164,26,250,0,34,7,55,88,5,252,170,247,11,6,247,78,163,232,10,
+247,8,251,7,187,58,251,64,251,30,34,251,27,57,30,86,51,110,49,34,26,200,29,
+248,84,253,74,247,44,10,43,248,17,29,247,96,28,5,55,22,248,126,29,28,5,86,
+34,7,251,131,46,5,201,102,59,170,76,27,251,62,251,28,36,251,25,57,31,84,51,
+108,47,32,26,200,29,247,199,10,192,157,189,188,157,184,25,200,28,251,101,
+6,112,121,120,112,137,30,39,248,17,29,251,57,250,148,248,84,29,254,148,251,
+95,7,14,251,57,179,10,245,253,232,5,201,6,14,251,57,179,10,247,6,251,255,
+5,185,6,248,84,92,21,251,29,247,17,251,183,43,5,92,7,247,183,251,1,5,251,
+91,251,84,21,251,4,247,172,5,93,6,33,251,172,247,21,251,48,5,96,248,93,21,
+186,7,251,175,235,251,37,251,17,247,37,251,19,5,14,253,184,208,29,251,16,
+250,7,28,4,215,21,247,19,157,5,247,9,252,87,7,251,203,251,85,37,251,203,251,
+220,247,120,57,247,215,31,249,74,247,19,28,250,129,247,42,7,14,252,211,248,
+179,249,76,21,247,23,34,244,251,23,251,23,35,34,251,23,251,23,243,35,247,
+23,247,23,244,243,247,23,30,14,253,6,248,123,205,21,247,12,64,232,251,1,37,
+92,75,53,76,180,89,248,120,29,37,90,50,251,52,51,170,62,248,163,10,251,53,
+250,76,213,21,247,2,72,240,251,11,53,75,83,49,59,180,105,139,30,247,15,6,
+139,141,130,125,26,251,44,43,70,35,82,30,173,63,5,139,247,228,229,247,228,
+26,252,99,124,21,247,7,80,247,3,251,17,55,72,77,45,86,180,88,139,30,247,14,
+104,6,251,87,251,88,68,139,30,172,61,5,139,247,227,235,247,209,26,14,251,
+53,145,10,251,161,248,176,247,138,10,253,90,248,77,247,163,29,14,249,239,
+28,4,170,247,37,21,236,59,214,49,45,63,62,44,47,209,61,239,231,217,211,237,
+30,253,62,22,236,59,214,49,45,61,62,44,47,211,61,239,231,217,211,237,30,28,
+5,86,22,236,59,214,47,47,61,62,44,47,211,61,237,233,217,211,237,30,14,28,
+5,103,28,6,174,248,31,247,64,29,251,216,250,103,21,251,41,6,253,230,28,250,
+162,5,247,40,6,247,119,247,53,10,249,107,252,220,21,251,144,86,59,63,63,74,
+219,247,144,247,144,204,219,215,215,192,59,251,144,30,254,72,247,156,10,28,
+7,180,252,220,247,64,29,251,113,22,251,144,83,59,66,63,73,219,247,144,247,
+144,205,219,215,212,195,59,251,144,30,14,251,12,249,181,249,238,21,227,71,
+217,51,49,61,71,49,47,207,59,237,227,209,213,229,30,247,70,254,146,21,247,
+19,251,15,143,86,118,135,135,139,30,47,251,138,5,251,72,51,247,1,247,43,247,
+173,247,189,203,139,31,247,164,251,32,251,66,7,139,252,80,49,251,240,26,251,
+130,247,93,251,44,247,156,247,58,247,109,205,247,70,30,14,252,59,248,162,
+250,252,52,29,252,57,249,148,28,5,115,33,10,252,129,249,76,250,252,48,29,
+252,106,249,99,28,5,172,38,10,252,129,249,76,28,4,176,74,10,252,184,249,21,
+28,5,182,58,10,254,34,247,171,28,5,57,42,10,252,112,249,93,28,5,59,37,10,
+253,51,248,154,28,5,106,85,29,14,253,65,248,140,89,10,251,114,250,91,28,5,
+115,63,29,253,108,249,52,251,154,67,29,252,129,249,76,28,5,199,49,10,249,
+239,28,8,0,248,84,29,28,248,0,251,95,7,14,249,176,64,10,14,252,90,249,95,
+249,164,188,10,247,138,251,60,21,211,252,249,67,7,247,243,247,173,247,238,
+29,85,225,29,249,5,6,247,160,247,70,76,233,251,97,251,27,5,247,219,247,118,
+10,252,158,7,251,105,251,33,194,39,247,50,243,5,252,31,247,51,10,247,251,
+100,29,14,250,8,28,7,217,22,248,11,251,39,7,108,251,105,5,124,135,120,115,
+123,27,252,64,248,158,247,115,6,158,157,117,124,31,157,251,31,5,247,17,248,
+117,251,19,6,123,251,31,5,125,123,116,120,30,251,117,248,117,248,5,6,157,
+151,121,119,143,31,166,251,62,5,247,44,247,219,253,230,251,66,6,149,134,38,
+247,79,251,157,27,252,171,251,6,252,72,251,167,251,250,247,103,251,245,248,
+31,247,170,247,21,247,96,149,146,31,251,81,7,143,249,56,21,251,216,251,23,
+251,125,251,113,251,140,36,247,193,247,162,247,142,219,247,209,247,177,247,
+117,247,5,251,168,251,197,30,14,252,47,247,47,29,100,252,103,21,211,252,248,
+67,7,248,91,248,105,247,97,10,248,26,61,29,14,252,143,56,29,14,252,143,249,
+78,250,54,21,80,235,251,54,251,5,5,248,239,47,7,251,218,36,5,51,247,38,252,
+238,7,251,111,251,46,196,41,247,54,247,7,5,252,72,7,112,118,120,115,137,30,
+38,133,5,43,248,204,235,7,36,145,5,115,141,116,158,166,26,249,4,7,14,146,
+100,10,14,248,221,28,6,172,241,21,247,54,7,139,251,21,251,0,251,85,251,123,
+53,247,90,247,56,30,249,19,184,6,247,140,251,11,247,107,251,170,251,165,53,
+251,80,139,139,33,247,80,251,165,251,227,251,64,251,130,251,182,251,165,247,
+55,251,131,247,216,247,210,205,247,78,148,142,30,130,142,208,251,78,247,195,
+27,247,142,247,35,247,8,139,31,254,39,248,13,21,251,52,102,251,113,251,66,
+251,79,106,247,116,247,92,247,38,170,247,137,247,83,247,51,189,251,96,251,
+122,30,249,6,247,46,21,251,232,6,247,2,182,247,62,247,27,247,17,176,251,10,
+251,15,30,14,247,89,194,22,248,169,235,6,57,145,5,114,141,117,154,167,26,
+249,245,7,188,133,247,236,247,150,247,21,194,251,29,38,94,121,251,4,139,30,
+251,24,106,39,51,251,46,251,176,248,58,163,251,119,26,65,80,57,40,64,108,
+168,139,30,122,247,84,5,251,27,251,189,6,139,247,15,98,247,38,247,105,247,
+82,247,26,247,105,30,247,178,252,48,180,247,68,26,242,234,180,229,141,30,
+153,162,141,135,163,31,153,190,146,200,205,26,247,152,251,101,247,15,251,
+99,252,130,55,252,64,251,87,30,253,140,7,111,117,124,114,137,30,57,133,5,
+14,252,45,248,254,249,164,21,203,7,33,143,5,125,124,151,154,31,249,129,41,
+7,251,179,43,5,73,7,247,91,166,5,252,250,7,124,127,127,122,30,251,6,135,5,
+75,7,14,220,28,4,164,248,23,21,248,109,254,230,251,15,250,107,251,242,7,14,
+142,28,4,178,247,134,21,74,6,36,118,115,113,100,27,108,125,204,182,31,249,
+158,251,155,253,123,7,55,66,96,92,65,27,100,100,182,182,121,31,131,159,130,
+180,201,26,249,45,251,150,253,244,7,252,29,74,194,251,21,26,68,221,87,190,
+196,223,193,212,30,203,72,247,17,247,41,26,184,7,113,169,227,85,178,27,247,
+15,215,180,247,15,221,31,37,176,219,77,210,27,247,54,215,227,247,71,151,31,
+14,247,77,28,5,31,249,195,21,190,7,71,154,5,248,43,7,207,151,5,195,251,130,
+112,7,251,4,251,234,251,7,247,234,5,166,251,128,83,7,201,129,5,252,45,7,77,
+124,5,88,247,83,190,7,77,154,5,248,37,7,247,50,252,103,5,207,6,247,55,248,
+101,5,252,35,7,80,124,5,88,7,252,162,248,23,21,247,46,252,113,251,46,204,
+7,153,227,5,143,148,145,149,30,217,252,55,6,71,124,5,88,247,152,190,7,72,
+154,5,248,55,218,7,150,145,135,133,31,153,51,5,14,247,186,75,10,249,49,28,
+6,229,22,247,134,51,7,117,251,3,5,252,3,6,247,156,247,52,247,79,247,27,247,
+68,26,247,40,251,21,229,251,60,251,9,251,95,102,251,48,86,174,102,205,182,
+186,162,139,30,247,57,7,148,169,142,143,175,27,240,196,67,43,251,109,251,
+211,251,81,32,57,31,37,7,247,205,28,5,143,120,10,14,249,239,28,6,102,249,
+113,21,247,19,252,187,248,5,251,18,252,5,252,187,251,19,248,187,252,4,247,
+18,248,4,7,248,187,253,113,247,116,29,14,207,28,4,158,249,91,21,247,197,251,
+113,239,251,140,143,30,251,99,143,5,234,247,9,29,254,187,7,247,136,29,247,
+0,7,139,221,133,190,247,244,247,83,247,58,247,179,30,251,197,130,21,251,113,
+32,41,251,97,113,106,141,139,30,248,248,7,141,174,176,146,173,27,247,44,247,
+5,40,251,97,31,14,249,49,28,6,233,247,111,247,151,29,251,39,28,4,180,247,
+254,10,247,41,6,180,248,240,21,203,7,35,143,5,122,127,149,155,31,249,122,
+41,248,21,10,126,129,123,30,251,7,135,5,75,7,28,5,27,251,177,21,251,175,6,
+247,175,247,226,5,14,249,239,28,4,123,250,68,21,207,84,194,71,71,84,84,71,
+69,194,86,207,207,194,192,209,30,248,127,252,29,247,116,29,249,117,251,158,
+21,208,84,193,71,71,84,85,70,71,194,86,207,207,194,192,207,30,14,252,118,
+248,42,249,68,21,249,199,34,253,199,7,244,254,218,21,249,200,34,253,200,7,
+14,252,170,248,189,28,4,225,21,247,17,39,240,251,17,251,17,38,38,251,17,251,
+17,240,39,247,17,247,17,239,239,247,17,30,57,22,59,76,76,59,59,75,202,219,
+219,203,203,219,219,202,75,59,30,14,187,28,4,147,248,164,21,188,29,249,1,
+248,36,29,28,249,164,192,29,14,249,49,28,6,250,247,111,21,239,251,42,248,
+148,251,35,7,252,72,252,143,5,34,248,45,251,148,247,62,247,148,7,251,39,28,
+4,180,247,68,10,247,31,116,10,249,123,252,159,21,251,174,6,247,174,247,226,
+5,14,252,45,249,103,249,164,21,247,132,53,7,114,33,5,252,15,6,247,157,247,
+51,247,88,247,23,247,68,26,247,40,251,25,235,251,60,251,9,251,100,96,251,
+45,83,173,104,205,180,188,162,139,30,247,58,7,147,170,149,147,176,27,237,
+205,63,43,251,109,251,228,251,80,32,57,31,36,7,14,248,161,180,29,251,107,
+252,62,21,206,7,251,178,105,247,78,247,238,251,193,200,8,211,149,247,58,182,
+247,73,26,247,13,10,247,181,7,153,141,137,150,247,160,251,56,252,35,247,248,
+27,172,172,139,147,200,31,252,4,249,7,21,251,44,251,11,112,57,131,124,139,
+141,117,248,57,10,249,239,28,6,102,248,187,247,116,29,14,134,250,242,248,
+173,21,248,49,251,222,247,242,139,30,247,112,247,9,87,233,251,125,251,17,
+251,50,247,46,251,213,33,5,48,7,247,74,133,207,68,251,114,251,9,189,45,247,
+137,247,23,174,104,233,251,31,148,126,25,126,59,164,82,27,251,203,251,70,
+251,152,251,167,248,2,10,31,251,183,126,247,176,10,198,199,100,139,30,155,
+106,192,251,5,251,101,26,14,249,239,28,6,41,247,33,21,252,107,248,109,248,
+107,248,109,59,219,252,109,252,111,252,109,248,111,59,59,248,107,252,109,
+252,107,252,109,219,59,248,109,248,112,248,109,252,112,5,14,252,45,249,103,
+250,144,21,247,70,251,108,161,100,138,30,182,142,247,71,176,247,44,26,247,
+40,251,50,208,251,37,251,58,251,33,65,35,80,186,112,194,162,165,141,153,164,
+30,247,44,7,139,184,153,164,237,211,70,61,251,11,251,5,106,41,30,102,49,6,
+139,192,145,180,247,15,202,68,61,43,55,61,47,104,107,153,145,110,30,96,247,
+31,5,146,125,118,145,117,27,98,81,122,72,248,13,10,248,161,28,4,180,247,177,
+21,247,148,251,6,7,110,251,68,5,139,90,110,65,251,76,251,3,247,54,247,107,
+247,70,223,247,97,247,109,219,176,102,139,30,168,251,56,5,247,6,247,140,6,
+139,35,194,251,77,251,207,251,82,251,109,251,156,251,197,247,100,251,71,247,
+181,247,68,247,13,191,139,30,248,83,248,68,194,10,14,247,108,34,29,248,30,
+249,83,33,10,247,108,34,29,248,48,248,72,48,29,247,108,34,29,248,57,249,27,
+37,10,247,108,34,29,247,157,248,72,52,29,247,108,34,29,247,215,249,74,85,
+29,14,247,108,34,29,248,60,249,140,38,10,247,6,55,29,251,125,251,209,59,10,
+175,32,10,250,9,28,7,3,33,10,175,32,10,250,27,28,5,248,48,29,175,32,10,250,
+36,28,6,203,37,10,175,32,10,249,136,28,5,248,52,29,252,90,37,29,249,29,28,
+7,3,33,10,252,90,37,29,249,47,28,5,248,48,29,252,90,37,29,249,56,28,6,203,
+37,10,252,90,37,29,248,156,28,5,248,52,29,247,227,39,10,251,127,248,228,38,
+10,247,251,35,10,99,250,247,33,10,247,251,35,10,117,249,236,48,29,247,251,
+35,10,126,250,191,37,10,247,251,35,10,251,61,249,236,52,29,247,251,35,10,
+129,28,4,156,38,10,48,40,29,44,28,5,198,49,10,247,196,33,29,251,133,248,171,
+33,10,247,196,33,29,251,115,247,160,48,29,247,196,33,29,251,106,248,115,37,
+10,247,196,33,29,252,6,247,160,52,29,247,61,43,10,251,103,248,180,33,10,247,
+61,43,10,251,76,248,124,37,10,140,84,29,250,12,28,7,87,49,10,83,32,29,247,
+82,249,247,33,10,83,32,29,247,100,248,236,48,29,83,32,29,247,109,249,191,
+37,10,83,32,29,200,248,236,52,29,83,32,29,247,11,249,238,85,29,14,83,32,29,
+247,112,250,48,38,10,251,53,54,29,251,36,251,250,59,10,33,35,29,247,65,249,
+107,33,10,33,35,29,247,83,248,96,48,29,33,35,29,247,92,249,51,37,10,33,35,
+29,183,248,96,52,29,252,143,56,29,248,244,28,5,115,33,10,252,143,56,29,249,
+6,250,252,48,29,252,143,56,29,249,15,28,5,59,37,10,252,143,56,29,248,115,
+250,252,52,29,230,41,10,247,174,28,5,172,38,10,146,40,10,241,250,23,33,10,
+146,40,10,247,12,249,12,48,29,146,40,10,247,21,249,223,37,10,146,40,10,112,
+249,12,52,29,146,40,10,247,24,250,80,38,10,251,170,39,29,152,249,173,49,10,
+220,36,29,247,48,28,5,115,33,10,220,36,29,247,66,250,252,48,29,220,36,29,
+247,75,28,5,59,37,10,220,36,29,166,250,252,52,29,109,34,10,37,248,142,33,
+10,109,34,10,64,248,86,37,10,251,75,84,10,249,175,28,5,199,49,10,247,38,28,
+4,131,247,37,247,67,10,253,64,22,247,252,10,14,252,174,248,107,247,37,247,
+67,10,14,247,122,28,6,35,28,5,72,21,247,8,251,7,187,57,248,75,10,30,102,29,
+5,204,161,201,188,203,26,14,250,36,28,7,133,28,5,78,21,227,67,209,51,51,70,
+69,51,51,208,67,227,227,211,211,227,30,247,11,28,250,178,21,235,7,41,145,
+5,114,141,116,160,164,26,250,0,33,7,55,88,5,252,170,247,11,6,248,41,10,247,
+97,251,82,5,204,161,201,188,203,26,247,8,251,7,187,57,248,75,10,30,128,29,
+248,84,253,74,7,114,121,118,112,137,30,45,248,17,29,250,38,28,7,254,22,235,
+7,37,145,5,112,141,120,158,166,26,28,5,86,33,7,251,132,46,5,201,105,57,170,
+77,27,248,75,10,31,102,29,190,157,188,188,158,184,25,200,28,251,101,6,112,
+123,120,110,137,30,41,248,17,29,152,250,186,28,5,242,21,251,1,6,92,251,63,
+111,146,112,145,112,142,25,181,247,47,5,251,1,6,98,251,40,5,251,234,135,251,
+155,251,171,252,40,26,251,142,237,251,96,247,52,251,11,30,50,251,215,5,247,
+5,6,211,247,157,163,127,165,130,165,131,25,74,251,128,5,247,5,6,197,247,105,
+5,136,163,164,138,165,27,247,71,247,38,198,158,183,31,247,190,29,103,105,
+143,147,108,31,247,145,250,49,158,35,5,247,28,247,224,6,108,150,111,149,114,
+147,8,253,4,253,16,21,247,182,247,2,247,95,247,75,190,30,251,129,253,238,
+5,100,233,122,247,3,247,1,26,247,25,252,77,21,247,165,250,121,167,136,169,
+129,161,131,25,251,177,254,160,114,156,116,159,119,162,25,14,152,28,4,128,
+248,84,29,254,226,251,95,7,14,249,49,28,6,231,247,121,21,247,52,251,51,180,
+104,151,30,204,170,236,182,247,9,26,247,37,251,38,205,251,29,251,44,251,57,
+81,251,78,37,233,75,190,121,30,76,120,251,9,102,251,25,26,251,31,247,29,41,
+247,80,247,66,247,60,212,247,58,30,251,232,28,4,170,120,10,28,5,145,158,21,
+65,102,88,112,112,30,41,182,39,180,237,26,205,194,186,209,221,194,71,64,30,
+155,252,73,21,59,66,101,57,44,64,214,236,221,198,182,155,248,103,10,249,49,
+207,29,251,222,28,4,170,21,251,41,6,254,30,28,250,113,5,247,42,6,247,62,126,
+29,247,91,247,68,229,247,52,31,249,250,251,111,236,29,249,49,207,29,251,216,
+28,4,170,247,172,10,247,64,177,29,249,242,251,131,236,29,249,49,28,6,176,
+247,121,21,247,52,251,50,180,105,151,30,202,170,235,182,247,9,26,247,37,251,
+37,205,251,27,251,44,251,58,81,251,78,37,232,75,192,121,30,73,120,251,6,102,
+251,25,26,251,31,247,27,41,247,80,247,68,247,58,212,247,58,30,251,250,28,
+4,170,247,68,10,247,252,28,5,61,247,149,10,28,4,125,135,21,65,102,88,112,
+112,30,43,182,36,180,237,26,205,197,186,206,223,193,71,64,30,155,252,73,21,
+59,65,101,59,45,61,214,236,221,201,182,153,159,30,221,102,247,60,98,251,13,
+26,14,249,49,28,6,227,247,132,21,247,72,251,117,155,104,137,30,176,143,247,
+83,176,247,50,26,247,37,251,44,203,251,37,251,60,251,23,69,37,77,188,113,
+194,160,165,141,153,164,30,247,44,7,139,174,149,165,235,207,75,61,251,10,
+41,106,40,127,129,248,153,29,247,14,197,67,61,43,63,70,47,102,112,147,147,
+113,30,96,247,29,5,147,124,119,145,116,27,98,84,121,71,58,239,63,247,67,247,
+88,247,70,229,247,52,31,251,228,28,4,159,120,10,14,249,49,28,6,254,115,29,
+251,199,28,4,159,150,29,14,249,239,28,6,102,248,1,21,247,19,253,35,7,247,
+138,247,137,5,248,45,247,19,251,174,6,247,35,247,36,57,221,251,117,251,118,
+5,253,162,251,19,249,35,6,251,138,251,137,5,252,45,251,19,247,174,6,251,35,
+251,36,221,57,247,117,247,118,5,14,249,239,28,6,168,248,254,21,247,48,251,
+29,247,19,251,46,251,45,251,24,251,15,43,35,30,235,33,251,24,247,15,251,43,
+27,251,46,251,29,251,19,251,48,251,41,247,15,251,31,247,46,247,74,235,247,
+0,247,1,247,17,31,251,1,247,15,237,251,0,247,74,27,247,46,247,15,247,31,247,
+41,31,32,125,21,37,45,63,43,251,27,47,241,225,51,30,211,225,247,8,247,1,247,
+11,27,244,218,49,38,31,253,23,149,21,53,51,47,37,251,25,27,43,43,215,241,
+240,218,229,244,247,11,247,8,251,1,67,225,31,14,249,239,28,6,102,247,132,
+21,247,19,7,254,221,247,217,250,221,247,218,5,247,19,7,28,251,52,252,25,5,
+251,19,7,28,4,204,253,9,248,127,10,249,239,28,6,102,249,9,21,247,19,7,28,
+251,52,248,25,5,251,19,7,250,221,251,218,254,221,251,217,5,251,19,7,28,4,
+204,251,132,248,127,10,251,24,250,111,249,220,21,247,19,61,248,111,252,74,
+33,36,104,112,78,30,223,33,5,186,247,0,164,161,245,27,247,46,247,41,251,64,
+251,100,135,31,137,57,137,61,121,51,8,247,2,251,36,86,174,251,17,27,251,19,
+251,187,47,252,70,251,64,247,48,251,99,247,142,248,103,196,249,84,247,73,
+31,251,95,251,93,21,251,183,105,44,251,222,251,105,27,251,80,125,247,105,
+223,247,79,239,247,166,247,103,247,23,196,51,90,184,31,14,140,203,29,247,
+229,148,10,167,28,4,152,247,203,21,61,6,251,66,75,59,78,51,151,221,247,29,
+30,248,181,247,17,7,247,7,178,223,240,31,87,6,110,131,94,114,94,27,253,117,
+6,251,64,73,251,47,47,31,199,6,175,151,145,219,247,29,27,225,251,150,6,252,
+19,35,86,77,94,107,194,219,30,71,6,251,33,166,251,38,247,10,247,58,231,247,
+56,247,105,30,248,105,247,171,252,215,7,251,9,161,251,42,247,91,247,19,244,
+247,5,247,115,30,14,251,116,250,13,28,5,80,21,159,190,133,184,94,182,112,
+164,70,145,75,127,251,94,98,77,251,48,119,252,209,131,251,122,24,128,251,
+228,121,251,213,135,63,133,100,112,80,251,5,237,78,192,61,92,123,102,118,
+90,147,92,182,98,166,114,207,131,204,154,247,76,178,232,235,163,249,27,149,
+247,166,24,150,247,169,141,247,217,145,213,143,178,166,201,247,6,40,199,86,
+216,184,154,174,8,14,248,12,109,10,128,28,4,154,28,5,92,21,201,251,56,7,251,
+226,28,251,57,252,35,249,160,251,132,251,13,172,78,247,19,202,248,78,253,
+252,5,201,6,248,6,28,5,92,5,14,249,239,28,6,102,249,181,21,247,191,10,127,
+251,87,124,72,67,247,94,29,213,194,190,8,251,240,4,247,191,10,126,251,87,
+125,72,67,247,165,10,149,247,14,148,247,5,212,194,191,8,14,247,12,247,88,
+29,252,225,14,50,250,152,249,183,21,252,50,249,166,5,251,21,6,252,49,253,
+166,248,49,253,183,5,247,21,6,247,179,249,183,21,251,242,253,68,251,244,249,
+68,247,244,249,50,5,14,251,15,248,55,249,236,21,158,131,123,149,121,27,112,
+117,115,115,111,163,119,165,166,157,162,164,145,138,146,136,145,31,247,207,
+253,139,21,157,130,120,151,120,27,114,119,115,116,111,163,118,163,166,160,
+163,163,145,137,145,137,145,31,252,95,249,65,21,148,130,127,144,127,27,114,
+117,117,112,114,160,118,166,167,158,158,168,152,133,151,130,147,31,248,218,
+252,216,21,147,129,126,144,126,27,113,119,118,113,114,160,117,166,167,159,
+161,164,151,134,152,130,148,31,253,66,248,93,21,141,133,133,141,133,27,115,
+116,118,112,115,158,115,167,163,164,159,165,158,127,158,120,147,31,249,139,
+251,206,21,141,134,133,140,133,27,115,114,123,108,115,157,116,169,164,162,
+159,166,158,127,156,121,147,31,253,188,247,52,21,112,119,118,113,114,159,
+116,165,31,141,6,163,163,161,166,164,115,160,114,31,249,201,140,21,115,137,
+115,119,112,26,115,160,117,163,30,143,6,165,160,161,164,165,117,161,113,31,
+253,188,251,54,21,120,132,129,122,121,26,112,162,117,164,166,160,163,164,
+165,117,159,113,133,132,138,136,133,30,249,139,247,207,21,121,131,128,121,
+120,26,113,161,118,163,167,160,163,163,166,115,160,115,133,133,137,137,133,
+30,253,65,252,95,21,130,130,134,128,127,26,114,162,116,164,165,160,162,164,
+166,118,159,111,127,128,133,130,130,30,248,216,248,218,21,131,130,134,126,
+127,26,115,160,115,165,165,160,161,165,165,119,161,112,127,127,134,130,129,
+30,252,93,253,66,21,137,133,137,133,133,26,116,161,115,165,163,163,159,166,
+163,119,163,112,123,118,127,121,131,30,247,206,249,139,21,137,133,138,134,
+133,26,115,159,114,166,163,163,159,166,164,118,163,112,120,122,127,121,131,
+30,251,52,253,188,21,247,246,29,249,201,4,247,246,29,14,83,32,29,14,252,86,
+249,94,248,85,29,80,142,5,123,140,126,152,154,26,247,208,7,247,69,35,170,
+251,45,251,34,251,47,84,48,89,199,145,139,30,247,29,247,9,6,139,160,143,175,
+246,158,72,92,138,30,139,138,110,120,26,252,2,64,98,85,251,2,26,42,217,77,
+235,247,9,247,6,215,139,30,157,78,5,121,247,6,21,139,74,112,82,83,100,180,
+189,213,185,172,247,63,171,30,14,252,90,249,95,249,164,138,10,251,154,28,
+4,135,138,10,83,32,29,247,147,248,236,46,10,83,32,29,253,232,4,215,10,247,
+100,28,5,172,48,29,83,32,29,247,100,248,236,64,29,83,32,29,247,100,248,236,
+65,10,83,32,29,247,100,248,236,68,29,247,74,249,104,38,10,83,32,29,247,100,
+248,236,68,29,127,249,63,43,29,83,32,29,247,73,248,236,62,10,83,32,29,247,
+73,250,58,58,10,83,32,29,253,232,4,248,175,29,28,6,250,58,10,83,32,29,247,
+73,250,58,66,10,148,247,225,33,10,83,32,29,247,73,250,58,66,10,251,12,205,
+52,29,83,32,29,247,73,250,58,66,10,178,248,26,38,10,83,32,29,247,73,250,58,
+66,10,251,47,247,241,43,29,83,32,29,247,98,249,224,83,10,83,32,29,247,100,
+250,75,49,10,83,32,29,247,100,249,52,74,10,83,32,29,247,102,249,191,37,10,
+83,32,29,247,109,249,191,56,10,248,57,247,153,74,10,83,32,29,249,189,4,247,
+240,29,59,198,80,248,105,10,14,83,32,29,247,100,250,196,228,29,248,124,251,
+155,42,10,83,32,29,247,11,249,238,248,200,29,83,32,29,123,249,237,220,29,
+83,32,29,165,250,7,43,29,83,32,29,253,232,4,248,172,29,83,32,29,251,33,253,
+33,119,29,83,32,29,247,236,254,14,67,29,83,28,5,254,248,191,10,119,160,164,
+26,248,162,248,198,29,112,247,82,247,79,10,14,83,250,50,28,4,148,21,251,0,
+251,82,5,171,73,53,149,40,27,247,115,29,31,248,37,29,247,29,182,61,68,149,
+30,60,251,31,5,252,126,251,8,82,49,251,67,26,251,23,217,46,247,0,109,30,81,
+36,243,78,228,247,49,5,247,52,159,247,35,242,139,26,166,37,5,248,17,235,6,
+49,145,247,253,10,239,120,211,106,191,30,247,13,247,105,5,251,234,254,47,
+21,139,39,94,51,132,133,139,140,132,30,247,100,248,1,5,251,226,251,106,21,
+234,181,193,247,33,184,30,251,51,251,172,5,123,163,131,169,171,26,14,248,
+187,28,6,169,22,235,7,49,145,247,253,10,248,42,10,251,0,251,11,116,97,47,
+30,190,69,40,153,251,11,230,10,247,45,247,69,247,0,171,189,30,51,178,221,
+87,245,27,248,132,10,31,166,37,5,253,14,247,82,247,79,10,248,243,251,230,
+21,139,39,94,51,55,77,203,227,247,15,209,194,247,156,192,30,251,226,247,245,
+21,139,214,167,210,248,61,10,251,35,107,251,1,110,55,109,8,14,248,217,28,
+6,171,248,118,29,251,19,32,108,80,56,30,211,70,251,3,157,251,28,230,10,247,
+74,247,96,247,9,188,216,30,32,224,247,25,80,247,63,247,18,29,253,91,251,198,
+247,79,10,14,248,203,28,6,173,22,247,115,10,249,254,248,41,29,247,21,253,
+21,7,139,71,104,53,251,66,133,247,19,239,30,247,179,7,248,42,10,247,115,29,
+30,248,37,29,247,56,163,251,3,60,30,59,7,252,199,251,17,78,248,113,10,248,
+132,10,30,166,158,5,45,176,217,87,247,43,27,247,29,247,69,247,30,139,31,251,
+5,7,253,175,247,37,21,248,114,29,31,251,111,7,96,141,100,145,103,30,131,120,
+41,101,60,27,14,248,3,28,6,2,250,27,21,247,141,10,251,186,253,126,5,248,206,
+248,198,29,247,244,6,247,244,250,13,5,253,111,253,79,247,79,10,14,248,23,
+28,5,238,248,144,21,247,23,251,88,7,238,247,142,247,9,153,5,247,141,10,55,
+251,105,5,251,102,176,6,96,10,247,244,6,247,93,248,144,5,252,216,251,210,
+247,79,10,248,67,119,21,251,50,252,38,5,248,38,7,14,248,119,28,6,118,247,
+245,29,251,201,253,134,81,143,5,114,141,119,160,164,26,248,162,248,198,29,
+247,201,6,132,121,112,72,88,251,28,247,31,29,253,235,253,79,247,79,10,14,
+83,250,191,249,140,21,247,54,251,11,241,251,39,251,75,251,68,251,19,139,30,
+115,241,5,252,19,43,6,229,247,48,10,252,162,7,251,187,247,52,85,247,127,247,
+109,247,134,232,247,41,225,47,129,139,30,251,103,251,89,6,139,104,131,86,
+251,58,108,247,7,217,141,30,139,141,188,167,26,248,202,247,17,200,231,247,
+77,26,251,183,81,21,251,14,72,83,251,159,84,30,247,232,7,139,242,184,227,
+223,198,71,55,30,14,252,89,249,74,28,4,217,21,236,61,200,44,251,11,251,7,
+63,139,30,124,200,5,251,141,82,6,197,248,77,10,251,208,7,251,69,243,107,247,
+45,247,33,247,50,195,228,191,79,133,139,30,251,29,251,10,6,139,116,134,104,
+32,118,208,186,141,30,139,140,168,156,26,248,4,214,179,194,247,3,26,251,82,
+104,21,66,96,105,251,66,106,30,247,96,7,139,206,166,196,194,177,99,88,30,
+14,193,28,4,168,22,161,29,252,18,249,155,249,165,21,197,7,83,142,5,121,140,
+128,151,155,26,248,160,248,25,10,251,13,251,104,251,65,237,251,15,247,55,
+235,247,4,225,139,31,68,7,247,14,4,139,83,114,92,251,8,81,223,247,21,247,
+18,174,244,248,165,29,193,28,6,92,87,10,252,72,247,220,21,161,29,193,249,
+168,250,123,21,251,11,7,139,251,64,247,36,251,41,251,142,251,43,251,97,251,
+181,251,244,247,100,251,95,247,181,215,229,176,198,211,30,247,39,43,5,247,
+5,249,254,6,166,157,158,166,141,30,225,145,5,235,7,252,40,253,177,21,92,111,
+47,82,79,27,251,84,85,247,66,247,103,247,107,228,247,31,247,70,212,225,98,
+139,31,14,193,28,4,156,248,166,21,247,181,251,46,247,97,251,140,251,41,251,
+64,251,35,139,30,247,10,252,42,43,7,225,133,5,166,137,157,121,112,26,253,
+255,247,7,7,247,39,236,5,79,211,227,102,217,27,247,181,247,101,247,95,247,
+244,31,251,189,92,21,251,105,83,251,66,251,82,77,47,199,186,113,30,248,230,
+7,139,225,180,212,247,69,229,251,32,251,107,30,14,252,18,249,147,250,227,
+21,247,65,39,247,15,251,53,42,251,4,54,139,30,209,251,156,82,7,195,135,5,
+157,138,150,128,123,26,252,161,214,7,235,197,5,103,185,197,117,189,27,247,
+80,247,28,247,14,247,103,31,251,85,111,21,251,20,103,35,251,16,99,79,175,
+167,122,30,247,248,7,139,195,164,186,247,7,198,55,251,21,30,14,248,26,61,
+29,14,248,26,61,29,59,249,105,33,10,248,26,61,29,77,248,166,74,10,248,26,
+205,248,84,21,251,138,241,251,119,247,170,247,77,241,247,3,139,139,229,251,
+3,247,107,247,93,247,123,227,247,44,198,119,157,59,30,251,76,251,88,6,139,
+92,131,114,251,23,80,206,247,38,30,196,7,248,68,241,247,49,205,247,115,26,
+247,29,62,247,23,251,77,251,101,251,78,251,41,139,139,251,33,247,41,251,158,
+251,118,251,47,251,10,139,30,251,54,7,139,247,21,247,2,247,53,247,103,231,
+251,14,139,30,251,128,252,229,7,139,137,112,125,26,249,238,247,240,21,139,
+235,194,219,225,184,68,57,41,94,77,251,154,70,30,252,214,44,21,247,214,6,
+72,137,251,111,251,64,251,30,129,247,53,221,30,14,251,55,182,250,178,21,251,
+40,205,251,28,247,73,247,12,205,206,139,139,198,72,247,32,247,22,247,42,192,
+230,174,126,150,87,30,251,11,251,9,6,139,108,134,123,54,101,179,227,30,173,
+7,247,172,200,241,179,247,25,26,222,89,217,251,12,251,28,251,13,50,139,139,
+48,228,251,65,251,39,38,68,139,30,42,7,139,223,205,244,247,29,199,66,139,
+30,251,34,252,22,7,139,138,123,131,26,248,194,247,101,21,139,201,172,191,
+195,168,96,90,80,110,102,251,62,97,30,252,12,82,21,247,101,6,99,138,251,23,
+251,4,49,133,235,189,30,14,247,49,28,5,37,247,150,21,36,6,139,127,49,94,88,
+139,227,247,42,110,30,176,220,160,234,161,225,8,139,209,247,129,151,233,30,
+251,109,6,86,251,127,5,247,58,75,251,17,233,251,99,27,251,240,251,37,251,
+171,251,170,251,123,247,7,251,153,247,166,247,85,247,39,213,247,21,247,1,
+31,251,27,165,186,71,247,17,27,247,17,215,247,175,139,31,252,93,247,54,21,
+251,56,90,90,47,251,19,27,251,60,53,247,54,247,68,247,99,182,247,84,247,78,
+247,128,131,251,129,251,136,161,31,14,247,108,34,29,14,251,168,250,31,248,
+84,10,88,148,120,143,135,144,133,154,25,251,188,249,129,5,251,43,6,251,191,
+253,151,64,128,5,77,247,179,201,7,64,148,130,141,124,151,145,151,25,212,247,
+82,5,247,177,6,211,251,87,143,130,131,129,130,137,25,61,130,5,77,7,125,247,
+252,21,251,119,6,247,4,247,187,5,14,74,250,240,22,233,7,70,151,118,144,137,
+141,135,155,25,251,253,250,19,5,251,90,6,251,253,254,39,47,124,5,45,248,5,
+235,7,38,152,5,129,135,149,143,31,225,247,109,5,247,220,6,223,251,115,5,137,
+141,135,133,137,27,32,126,5,43,7,119,248,85,21,251,134,6,247,11,247,201,5,
+14,247,108,34,29,248,95,248,72,46,10,247,108,34,29,248,48,248,72,64,29,247,
+108,34,29,248,48,248,72,65,10,247,108,34,29,248,48,248,72,68,29,247,74,249,
+104,38,10,247,108,34,29,248,48,248,72,68,29,127,249,63,43,29,247,108,34,29,
+247,96,28,250,120,90,29,247,100,28,7,60,48,29,247,108,34,29,248,21,248,72,
+62,10,247,108,34,29,248,21,249,150,58,10,247,108,34,29,248,21,249,150,66,
+10,148,247,225,33,10,247,108,34,29,248,21,249,150,66,10,251,12,205,52,29,
+247,108,34,29,248,21,249,150,66,10,178,248,26,38,10,247,108,34,29,248,21,
+249,150,66,10,251,47,247,241,43,29,247,108,34,29,247,96,28,250,120,21,248,
+175,29,28,8,138,58,10,247,108,34,29,248,53,249,64,83,29,247,108,34,29,248,
+48,249,167,49,10,247,108,34,29,248,48,248,144,74,10,247,108,34,29,248,57,
+249,27,37,10,247,108,34,29,248,57,249,27,56,10,248,57,247,153,74,10,247,108,
+34,29,247,96,249,25,42,10,247,108,34,29,248,48,250,32,228,29,248,124,251,
+155,42,10,247,108,34,29,247,215,249,74,248,200,29,247,108,34,29,247,122,249,
+99,43,29,247,108,34,29,247,96,28,250,120,73,29,247,108,34,29,202,28,251,63,
+119,29,247,108,34,29,249,90,28,250,82,67,29,247,108,250,220,215,29,247,85,
+28,250,63,21,163,29,14,247,108,149,248,58,29,35,7,217,124,168,133,145,131,
+149,114,25,248,91,28,251,31,5,247,125,6,248,95,28,5,6,247,7,156,5,243,252,
+77,35,7,247,7,124,153,137,162,119,131,118,25,251,5,251,209,5,252,74,6,251,
+3,247,217,133,154,151,157,152,141,25,247,13,154,5,243,7,161,252,236,21,247,
+240,6,251,64,252,128,5,14,250,185,28,8,128,249,60,21,248,33,251,143,247,222,
+252,62,251,171,251,66,251,18,251,87,251,4,30,251,9,247,213,92,10,252,1,247,
+0,247,118,251,39,247,217,27,248,48,247,139,247,214,248,27,31,251,222,131,
+21,251,156,64,251,204,251,166,251,144,58,247,195,247,183,247,167,208,247,
+197,247,176,247,130,230,251,169,251,213,30,254,163,67,247,143,29,250,180,
+28,8,187,22,247,222,29,252,91,28,4,225,5,251,125,6,251,193,253,222,251,198,
+249,222,92,10,247,3,251,217,145,124,127,121,126,137,25,251,13,124,5,35,248,
+202,247,222,29,75,247,67,191,247,38,5,248,74,6,247,3,251,217,145,124,127,
+121,126,137,25,251,13,124,5,35,7,117,248,236,247,195,10,253,44,252,128,247,
+143,29,250,33,28,7,253,247,143,10,67,251,38,251,83,251,38,77,205,228,98,30,
+138,143,252,41,250,235,92,10,182,251,17,5,251,137,223,247,11,251,34,247,178,
+27,247,234,247,51,247,42,248,39,31,249,74,248,131,10,254,253,253,40,247,143,
+29,249,52,28,7,48,248,106,10,247,112,10,251,203,254,10,252,29,250,205,92,
+10,247,80,252,148,5,247,86,6,248,107,28,5,6,5,254,28,253,33,247,143,29,249,
+52,28,6,203,248,115,21,247,13,251,159,7,247,131,249,33,247,59,29,251,107,
+252,248,5,251,88,6,251,185,249,187,92,10,247,80,252,148,5,247,86,6,247,79,
+248,148,5,253,0,247,13,247,195,10,248,159,252,249,21,247,1,6,86,251,45,5,
+14,249,52,28,7,48,248,106,10,247,112,10,251,204,254,9,252,28,250,204,92,10,
+247,98,252,201,106,52,112,83,97,97,25,251,125,247,6,5,53,75,100,65,98,26,
+82,225,59,247,33,247,93,237,247,28,247,79,207,30,248,149,28,5,123,5,254,28,
+253,33,247,143,29,152,28,4,109,247,227,21,247,17,251,53,7,105,247,7,5,247,
+87,247,17,251,124,6,251,100,249,87,5,251,81,6,251,97,253,87,5,251,124,251,
+17,247,88,6,106,251,7,5,251,55,251,17,247,19,6,78,251,106,46,122,5,35,247,
+249,243,7,46,154,127,141,121,159,145,160,25,187,247,65,5,248,71,6,192,251,
+73,144,124,129,121,129,137,25,41,124,5,35,248,94,243,7,75,154,116,145,134,
+147,131,164,25,87,247,69,5,252,103,249,137,21,247,6,252,28,5,251,117,6,104,
+251,17,21,247,189,6,172,251,7,5,251,254,6,14,247,204,28,5,158,22,235,7,32,
+248,79,29,28,4,233,247,125,10,251,201,248,154,29,251,37,7,247,156,4,139,251,
+17,63,37,251,99,251,50,247,136,247,214,29,247,204,200,248,58,29,43,7,246,
+133,5,165,137,158,120,112,26,28,251,23,189,7,247,135,247,21,5,71,225,247,
+45,78,225,27,247,228,247,148,247,195,248,91,248,9,251,105,247,201,251,181,
+251,111,251,88,251,70,139,31,247,37,7,251,156,4,139,247,17,215,241,247,99,
+247,50,251,136,251,171,251,166,40,251,158,251,113,69,251,62,233,200,107,30,
+14,249,176,64,10,14,240,28,4,226,249,165,21,247,117,42,7,118,251,20,5,130,
+137,128,125,129,27,251,173,247,205,247,40,6,150,150,127,130,141,31,150,54,
+5,222,247,181,56,6,128,56,5,130,137,129,125,127,27,251,40,247,181,247,135,
+6,152,145,128,127,142,31,157,37,5,236,247,88,253,161,77,6,205,133,150,137,
+154,127,131,127,25,252,59,253,39,57,130,5,77,247,183,201,7,63,146,127,140,
+133,150,148,153,25,247,23,247,97,5,247,187,251,97,6,127,122,125,121,138,30,
+70,133,5,77,7,243,248,12,21,251,137,6,247,137,248,14,5,14,248,40,249,158,
+247,233,21,251,108,7,129,131,129,123,138,30,38,131,5,43,250,13,208,10,254,
+142,43,6,240,131,157,138,145,119,127,122,25,252,122,253,128,248,5,29,247,
+33,247,110,5,248,1,248,199,21,252,90,251,187,7,14,249,176,64,10,248,131,248,
+174,33,10,249,176,64,10,248,149,247,235,74,10,252,28,249,134,250,244,21,247,
+68,251,11,242,251,35,38,47,81,139,30,247,245,248,134,29,233,253,177,247,136,
+7,247,139,247,34,247,40,247,80,31,251,85,102,21,251,66,51,82,251,39,130,135,
+139,141,125,30,248,70,7,139,178,147,170,247,17,206,60,251,26,30,14,175,85,
+10,73,28,4,253,42,10,175,85,10,247,34,253,220,74,10,175,85,10,73,253,204,
+73,29,175,250,121,251,107,21,249,97,251,21,253,101,154,29,247,54,249,156,
+174,10,175,247,189,29,247,54,247,105,247,21,251,105,247,187,248,36,10,251,
+0,251,66,251,21,247,66,254,216,146,29,175,249,118,28,4,248,237,29,248,57,
+253,91,174,10,154,28,4,117,248,197,21,247,185,251,79,247,62,251,113,251,43,
+251,42,39,139,30,239,7,247,148,247,19,247,1,247,7,30,247,64,251,91,5,139,
+247,17,155,247,15,26,247,19,251,56,199,251,70,251,93,251,21,48,251,14,69,
+30,90,55,119,40,43,26,254,148,247,244,7,248,56,247,101,247,128,247,217,31,
+251,189,78,21,251,132,43,251,37,251,134,30,65,249,103,6,139,207,149,188,247,
+84,242,251,19,251,113,30,14,247,158,28,5,109,248,197,247,106,10,252,157,7,
+251,134,251,52,251,79,251,143,251,132,26,251,236,247,127,251,111,247,197,
+247,24,246,156,176,244,30,247,19,7,119,69,73,129,77,27,251,125,251,67,247,
+75,247,203,247,55,187,247,60,242,247,20,31,253,78,146,29,175,247,189,29,249,
+6,7,252,84,252,119,247,65,35,5,254,93,146,29,175,247,76,22,248,11,247,145,
+29,248,75,7,151,148,157,160,30,247,251,248,19,29,254,7,6,249,58,254,140,247,
+78,10,99,250,207,248,132,21,247,164,251,49,247,148,251,243,251,27,251,13,
+76,77,60,30,247,46,180,247,2,247,25,247,173,27,247,183,202,247,21,247,23,
+168,31,53,6,127,135,114,89,251,72,27,252,52,251,170,251,51,252,210,31,251,
+47,7,251,142,247,49,251,163,247,242,247,237,247,57,247,136,247,169,30,251,
+168,22,251,132,41,251,64,251,28,251,16,34,247,64,247,132,247,133,235,247,
+70,247,27,247,19,244,251,70,251,133,30,14,251,12,250,130,247,193,21,247,91,
+251,58,224,29,246,243,247,89,31,251,177,22,247,124,10,14,251,12,153,249,248,
+21,247,62,253,98,6,247,159,29,248,107,7,248,19,246,243,247,89,247,91,251,
+58,247,17,251,187,116,100,137,137,115,31,247,139,247,62,247,23,251,62,247,
+63,251,167,251,63,251,62,7,249,87,253,78,247,105,10,14,175,28,4,135,248,97,
+29,110,247,81,29,253,119,251,225,243,7,164,247,68,5,163,141,155,154,159,27,
+247,7,6,164,159,116,115,31,253,64,247,114,10,248,97,7,248,19,243,243,247,
+89,31,251,179,22,39,148,42,251,109,30,124,125,141,127,27,248,42,7,159,168,
+141,151,27,247,62,157,51,251,17,31,14,105,250,216,247,173,21,247,90,251,58,
+244,251,187,116,100,137,137,115,30,247,53,194,7,170,141,129,110,147,31,162,
+53,5,247,16,247,105,251,135,182,6,166,159,160,164,141,30,231,145,5,235,252,
+187,43,7,233,133,5,164,137,159,118,112,26,96,251,137,251,105,247,17,7,161,
+225,5,168,147,141,149,170,27,196,252,227,6,247,159,29,248,107,7,248,19,246,
+223,247,89,31,251,177,22,38,53,63,32,30,125,94,141,129,27,248,1,7,141,159,
+197,141,153,27,243,205,70,251,17,31,14,248,53,86,29,14,248,53,86,29,248,75,
+250,162,37,10,56,250,164,247,191,21,247,29,39,211,251,27,163,30,227,172,221,
+209,247,2,26,247,38,251,3,247,0,251,203,30,252,144,43,6,233,247,48,10,253,
+80,247,114,10,248,162,7,247,112,247,141,202,247,128,31,251,174,127,21,251,
+23,51,89,251,32,30,125,96,142,125,27,247,234,7,141,165,172,141,168,27,247,
+11,231,96,251,17,31,71,248,84,21,37,94,81,251,13,125,30,137,123,110,139,119,
+27,247,228,212,7,225,211,88,251,1,31,14,247,12,66,29,14,251,231,249,181,250,
+148,21,247,55,251,34,173,40,142,30,182,147,247,38,179,247,39,26,247,64,251,
+79,157,43,30,252,65,77,6,211,247,12,29,67,132,5,77,248,93,7,247,24,247,67,
+149,247,121,31,251,139,248,11,21,52,99,72,251,44,134,111,140,139,30,247,184,
+7,142,186,137,139,148,27,247,35,167,70,66,31,187,252,19,21,251,10,64,96,251,
+28,131,85,142,139,30,247,205,7,140,176,155,139,152,27,247,36,202,89,33,31,
+14,251,12,250,128,247,187,21,247,62,251,19,196,251,3,154,30,213,165,241,201,
+247,29,247,177,10,253,129,247,223,10,149,247,177,31,251,155,129,21,248,94,
+29,247,240,7,141,176,155,139,156,27,247,60,206,81,251,8,31,82,248,88,21,43,
+98,65,251,68,30,108,247,218,248,56,10,247,12,66,29,251,33,28,5,72,42,10,247,
+12,66,29,206,253,105,74,10,247,12,66,29,251,33,253,89,73,29,247,12,247,7,
+29,253,94,251,68,251,21,247,68,251,103,182,10,247,142,247,129,247,21,251,
+129,247,35,248,46,29,14,251,231,249,183,250,145,21,211,90,181,79,165,30,247,
+9,239,251,56,6,199,176,186,190,205,26,247,72,251,84,155,51,30,252,70,74,6,
+217,132,5,152,138,145,132,130,26,251,153,34,39,244,251,184,7,131,133,132,
+126,137,30,61,132,5,79,248,94,7,247,18,247,71,154,247,113,31,251,92,22,32,
+81,79,251,45,132,100,139,141,122,30,247,197,213,7,247,26,205,95,43,31,93,
+248,9,21,60,94,85,251,32,30,96,247,169,6,157,160,140,155,27,247,47,157,62,
+71,31,14,251,12,250,128,247,177,21,227,77,190,63,170,30,247,40,247,13,251,
+96,6,213,184,197,200,219,247,177,10,251,190,251,23,251,13,247,23,251,222,
+247,223,10,157,247,159,31,251,155,22,248,94,29,247,238,231,7,247,51,136,193,
+85,251,5,26,82,248,88,21,45,109,75,251,56,136,30,85,247,209,248,56,10,247,
+157,28,5,98,248,35,21,247,163,251,111,196,251,43,143,30,206,153,247,115,205,
+247,138,26,247,178,251,180,170,251,40,30,252,203,6,251,109,251,11,70,251,
+44,49,182,71,231,141,31,221,153,152,190,193,248,111,10,204,6,166,155,123,
+112,31,254,174,247,116,10,251,2,128,5,35,249,82,7,247,95,247,162,155,248,
+19,31,251,199,125,21,251,89,251,5,68,251,102,126,55,143,139,30,248,158,7,
+141,197,163,139,160,27,247,113,235,248,24,10,133,94,141,139,30,248,123,7,
+144,213,135,139,153,27,247,111,182,251,7,251,13,31,14,247,243,28,5,184,247,
+23,29,252,84,129,7,251,116,251,67,247,167,10,165,237,247,66,30,172,252,117,
+6,247,181,29,251,199,125,248,62,10,248,160,241,7,247,113,236,248,24,10,30,
+88,248,125,6,248,50,10,14,247,12,247,212,29,249,34,7,252,119,252,116,247,
+82,251,52,5,252,250,212,10,247,12,247,212,29,248,103,211,10,136,159,123,112,
+26,254,178,212,10,216,247,202,29,248,3,211,10,136,159,123,112,26,254,178,
+247,241,29,247,38,247,31,247,171,31,251,187,22,251,97,45,39,251,126,30,117,
+116,141,123,27,249,6,7,143,165,180,144,160,27,247,62,247,23,248,165,10,216,
+189,10,251,208,22,247,96,29,14,216,152,28,4,229,21,247,92,254,217,6,247,158,
+29,248,151,7,248,102,247,38,247,31,247,171,248,70,10,31,248,29,247,92,247,
+13,251,92,247,42,251,185,251,42,251,92,7,249,241,254,80,247,85,29,14,247,
+149,28,5,90,248,54,21,247,172,251,111,247,60,251,250,108,98,135,137,104,30,
+247,246,248,131,10,246,149,5,243,253,208,252,29,247,42,7,176,247,121,5,172,
+143,149,147,164,27,247,10,6,170,147,129,108,31,254,174,247,216,10,248,152,
+7,248,103,247,35,247,31,247,171,31,251,207,22,251,97,67,43,251,127,30,118,
+117,141,120,27,249,2,7,143,166,182,144,157,27,247,62,247,3,248,165,10,247,
+173,28,5,117,248,64,21,247,173,251,113,247,19,251,251,108,98,137,134,107,
+30,247,128,247,58,7,169,143,127,110,146,31,167,251,21,5,247,42,247,175,252,
+21,208,6,248,166,10,141,30,243,150,5,243,252,230,35,7,246,128,5,161,137,162,
+123,112,26,70,252,23,251,175,247,41,7,170,247,21,5,168,145,141,151,170,27,
+247,60,254,29,6,247,158,10,248,152,7,248,103,247,38,247,42,247,170,31,251,
+210,22,251,97,68,33,251,128,30,119,116,141,123,27,248,230,7,141,163,182,143,
+160,27,247,60,247,2,92,251,136,31,14,249,63,82,29,14,249,63,82,29,248,67,
+28,5,41,37,10,243,28,4,202,248,89,21,137,247,159,251,65,223,251,112,170,8,
+247,23,170,247,33,247,9,247,78,26,247,99,251,37,247,32,251,148,252,4,251,
+42,251,198,251,174,30,28,251,59,7,120,125,111,114,137,30,43,128,5,42,248,
+198,236,7,251,13,150,5,124,123,157,170,31,28,5,21,7,247,98,187,247,69,247,
+46,230,201,40,251,15,251,78,108,251,3,251,98,141,30,136,105,139,98,111,26,
+247,175,144,203,251,30,251,127,26,251,159,42,95,39,102,72,154,174,73,30,251,
+18,7,112,195,219,125,203,27,247,117,247,142,247,1,248,5,136,31,14,251,240,
+249,177,251,80,104,10,251,240,249,177,250,181,104,10,248,48,247,104,247,50,
+21,119,123,116,110,137,30,33,131,5,34,248,187,244,7,72,147,5,110,141,125,
+162,159,26,248,178,7,248,96,247,69,247,4,247,35,237,224,108,54,241,30,252,
+4,252,88,5,248,30,251,54,232,50,251,31,26,251,19,66,57,251,20,96,84,159,163,
+100,30,124,148,122,159,137,155,112,247,74,24,251,61,251,215,6,139,247,75,
+53,247,63,247,247,247,50,247,105,247,97,247,124,33,230,251,252,247,43,30,
+247,245,248,67,5,223,251,116,251,38,172,251,82,27,252,46,251,122,251,100,
+252,115,31,14,251,53,54,29,14,251,53,54,29,14,252,155,249,7,249,220,195,10,
+251,198,28,4,191,195,10,251,53,54,29,79,28,5,25,33,10,251,53,54,29,97,250,
+162,48,29,251,53,54,29,97,28,5,109,49,10,251,53,54,29,251,142,28,4,223,42,
+10,251,53,54,29,79,28,5,25,112,29,55,28,249,129,59,10,251,53,247,212,247,
+32,29,248,217,247,238,169,29,14,251,53,250,89,251,107,21,247,249,251,21,251,
+253,154,29,247,197,4,170,10,14,251,33,248,198,248,201,21,251,67,6,247,128,
+148,247,22,247,11,247,13,247,136,10,251,158,251,111,251,75,251,168,102,31,
+47,251,13,226,6,251,145,153,247,67,251,108,247,197,27,247,99,247,19,223,170,
+209,31,247,218,29,251,58,251,3,247,4,247,77,112,31,247,60,6,14,251,53,54,
+29,103,250,158,247,185,29,251,53,250,89,251,250,21,247,47,7,119,112,251,29,
+61,251,17,27,251,68,251,27,247,37,247,97,31,248,126,7,248,76,10,153,174,137,
+139,30,248,32,29,251,39,233,251,109,251,167,251,143,251,105,251,183,31,252,
+123,7,251,163,247,66,251,127,247,211,247,99,247,21,221,172,209,30,14,251,
+32,28,4,170,250,195,21,229,32,195,251,18,251,22,49,50,251,6,107,30,145,102,
+102,143,98,27,247,152,29,247,218,29,251,85,251,10,247,44,247,132,248,76,10,
+153,164,137,139,31,248,71,10,198,111,192,85,178,31,247,5,170,211,235,30,221,
+251,75,5,139,247,11,143,247,7,26,14,251,53,250,103,247,146,21,243,57,227,
+251,15,251,56,51,45,251,64,96,30,45,248,124,29,247,34,247,17,153,164,137,
+139,30,247,202,10,251,185,251,127,251,113,251,216,251,140,247,82,251,66,247,
+95,84,31,122,51,131,43,63,26,247,1,6,213,147,225,153,221,30,137,156,167,132,
+158,27,247,76,247,58,246,247,64,31,251,64,143,21,63,94,84,53,106,127,139,
+145,110,30,244,166,180,210,206,27,180,168,127,100,31,14,252,157,249,16,250,
+61,21,202,86,192,59,32,82,82,36,111,30,78,183,128,206,234,26,247,45,226,224,
+221,148,155,138,139,30,251,30,7,128,157,154,124,195,27,187,185,176,194,218,
+49,195,251,32,251,82,251,45,251,24,251,87,251,40,247,15,34,247,24,106,31,
+128,86,134,82,93,26,210,6,184,144,190,148,188,30,138,150,157,135,152,27,247,
+11,247,0,203,242,31,251,3,142,21,93,109,106,83,118,131,139,143,120,30,202,
+157,165,181,183,27,166,158,132,116,31,14,251,53,250,89,248,154,163,10,252,
+157,249,7,250,220,21,247,54,251,7,247,33,251,100,251,26,55,89,119,96,30,46,
+7,151,154,227,187,222,27,247,16,218,48,251,35,251,45,50,63,58,129,135,139,
+140,128,31,247,28,7,152,119,124,152,85,27,90,92,104,84,60,229,82,247,33,247,
+82,247,46,247,25,247,85,31,14,251,53,249,25,247,58,29,248,55,251,21,252,51,
+247,55,29,247,212,249,226,163,10,146,175,10,251,198,141,21,99,137,98,134,
+98,30,212,93,57,187,47,27,47,58,90,66,93,31,133,183,137,184,181,26,247,110,
+10,41,251,152,21,247,244,10,14,251,53,173,10,14,251,53,173,10,248,123,247,
+150,247,54,10,128,248,208,250,103,21,251,162,251,128,251,69,251,213,251,97,
+223,251,21,172,72,31,247,47,6,119,163,59,247,27,247,19,26,247,83,247,44,247,
+13,247,131,247,146,247,19,251,28,251,17,123,139,133,137,123,30,251,119,6,
+116,109,119,115,55,26,64,198,67,231,247,23,234,247,31,247,109,247,183,251,
+114,247,130,251,213,30,14,251,63,250,76,174,21,247,142,251,33,7,102,251,54,
+137,127,131,130,127,133,25,137,135,71,129,92,27,251,56,41,247,1,247,145,122,
+31,248,15,247,9,252,15,6,247,142,154,247,8,244,247,30,27,192,206,118,129,
+160,31,147,135,149,126,141,123,162,251,23,24,247,37,247,136,6,176,251,15,
+43,159,251,4,27,252,1,251,82,251,130,251,180,251,142,247,53,251,165,248,30,
+247,57,247,58,199,139,31,14,251,63,127,29,14,251,63,127,29,251,13,249,221,
+37,10,247,6,55,29,14,247,6,55,29,14,251,28,250,111,178,21,247,166,251,37,
+7,102,251,74,137,135,124,125,135,137,25,132,123,102,127,102,27,251,150,43,
+247,97,247,93,247,139,247,25,247,48,247,101,153,244,129,112,145,31,176,251,
+66,5,247,35,247,160,6,187,251,48,72,157,251,17,27,251,214,251,143,251,105,
+251,203,251,199,247,129,251,110,247,226,247,60,247,25,184,158,188,31,14,247,
+6,55,29,251,28,28,6,210,33,10,247,6,55,29,251,10,28,5,199,48,29,247,6,55,
+29,251,10,28,7,38,49,10,247,6,55,29,251,218,28,6,152,42,10,247,6,55,29,251,
+125,251,209,139,29,236,28,8,15,33,10,247,6,248,156,247,32,29,249,25,247,197,
+137,10,247,20,249,33,4,229,6,252,40,155,247,186,251,174,248,45,27,248,76,
+29,247,251,247,211,29,251,224,251,22,247,168,247,169,130,31,247,173,247,25,
+251,168,6,247,187,169,247,59,247,79,247,145,27,247,235,29,247,240,6,200,251,
+83,53,164,251,47,27,252,10,251,189,251,141,252,8,94,31,44,6,14,247,6,250,
+190,215,29,196,28,250,112,137,10,247,6,28,6,106,28,6,41,21,213,251,18,231,
+59,251,109,251,85,251,23,251,124,30,158,63,74,147,51,247,242,29,248,76,29,
+247,251,226,29,248,62,6,247,6,184,223,192,160,30,247,107,251,91,5,194,160,
+184,202,213,26,14,152,249,128,248,153,21,169,247,17,5,251,247,6,138,154,139,
+155,155,26,172,248,10,7,169,247,17,5,252,29,6,247,153,177,247,29,247,52,247,
+93,27,183,200,116,129,157,31,247,168,10,251,194,251,134,251,112,251,232,83,
+31,251,34,6,109,251,17,5,247,52,110,6,122,139,122,140,122,30,251,23,6,109,
+251,17,5,247,67,6,251,220,200,247,122,251,114,247,197,27,247,71,247,38,201,
+159,183,31,247,251,251,30,7,101,251,134,135,127,121,116,131,135,25,129,120,
+99,122,97,27,251,126,251,9,247,85,247,116,102,31,14,152,28,4,115,22,247,167,
+251,2,7,118,251,46,5,133,129,128,136,30,251,161,247,224,247,35,6,160,142,
+251,3,131,141,31,234,247,238,44,6,126,137,135,33,119,27,251,35,247,194,247,
+120,6,146,145,134,128,141,31,160,251,16,5,247,0,247,135,253,50,48,6,220,131,
+5,150,137,147,132,128,26,251,175,7,251,60,173,75,247,48,247,62,26,247,127,
+247,5,247,40,247,70,151,228,129,114,144,30,170,251,58,5,247,14,247,147,6,
+185,251,25,82,156,33,27,251,166,251,105,251,95,251,187,251,177,247,84,251,
+77,247,165,130,31,251,203,7,129,132,131,127,137,30,58,131,5,48,7,14,152,250,
+199,248,144,21,247,110,7,152,122,98,152,106,27,74,47,32,94,103,31,247,44,
+64,7,251,113,66,5,80,243,252,58,7,124,129,126,124,135,30,251,30,242,85,247,
+102,247,97,26,247,246,247,40,247,122,247,131,183,200,116,129,157,30,247,168,
+10,251,237,251,159,251,185,252,62,252,58,247,146,251,191,247,249,247,71,247,
+38,201,159,183,31,247,201,251,30,7,101,251,84,135,127,121,116,131,135,25,
+126,132,118,130,114,133,8,137,6,120,126,155,156,31,248,38,7,139,178,165,193,
+195,164,99,121,152,30,14,152,249,147,251,98,21,247,99,7,247,50,147,247,18,
+190,179,157,8,247,190,29,122,250,239,142,6,183,200,117,129,157,31,152,133,
+149,119,134,26,178,251,111,5,247,28,247,224,6,251,36,190,65,164,33,145,8,
+247,39,251,16,251,43,7,251,198,99,251,118,251,159,252,11,26,252,8,247,109,
+251,164,247,207,100,30,251,102,7,251,152,250,14,21,247,164,235,247,88,247,
+56,204,30,254,189,7,251,80,215,67,247,123,247,117,26,14,247,6,28,4,205,252,
+35,21,249,187,164,10,221,215,149,151,205,31,252,94,7,14,247,32,250,254,247,
+235,21,57,36,79,94,251,106,27,103,104,141,143,108,31,247,20,247,179,174,214,
+145,174,91,232,25,251,82,247,253,5,248,112,6,247,54,247,65,115,200,5,252,
+222,6,251,218,251,193,5,251,12,251,5,55,251,37,251,82,26,251,87,247,52,252,
+25,248,170,247,14,247,76,176,139,30,247,61,247,164,5,253,88,101,21,251,100,
+208,53,247,59,247,62,26,247,65,157,172,229,237,30,247,128,252,96,166,85,127,
+94,128,111,25,14,247,180,250,236,248,86,21,251,58,111,45,251,113,251,99,27,
+251,78,251,56,247,69,248,74,31,141,247,221,7,247,171,247,17,251,27,222,27,
+236,6,163,168,161,186,205,34,197,251,113,31,253,18,6,247,255,158,247,83,247,
+26,247,54,27,247,59,247,13,251,119,251,9,156,31,247,179,6,247,124,114,251,
+216,247,93,251,151,27,251,172,252,67,251,37,252,188,252,66,247,231,251,115,
+247,231,248,57,247,85,247,124,247,138,166,31,14,247,6,133,10,14,251,29,205,
+178,21,120,188,247,25,94,247,60,27,247,226,247,129,247,110,247,199,247,203,
+251,143,247,105,251,214,251,17,72,121,91,251,48,31,251,160,247,35,7,176,247,
+66,5,166,145,244,149,153,27,247,101,247,25,251,48,251,139,251,93,43,251,97,
+251,150,102,102,151,146,123,31,135,141,124,153,137,143,102,247,74,24,251,
+37,6,14,247,6,28,4,205,249,68,21,248,62,251,208,247,185,252,41,251,50,53,
+114,78,251,80,30,251,240,247,49,7,185,247,121,5,145,153,160,151,145,30,149,
+162,212,162,191,27,247,170,247,66,251,122,251,246,251,179,251,19,251,189,
+251,236,90,92,156,149,116,31,129,143,119,162,137,151,92,247,134,24,251,52,
+251,251,6,119,190,247,62,77,247,105,27,248,56,247,191,247,191,248,58,31,14,
+247,6,133,10,252,232,149,247,54,10,247,26,28,4,223,184,21,247,226,251,45,
+7,89,251,117,135,122,127,127,121,131,25,137,133,42,118,61,27,251,141,251,
+75,247,64,248,5,117,31,248,174,247,23,252,174,6,248,3,159,247,87,247,39,247,
+105,27,237,237,106,127,166,31,153,133,154,118,143,119,170,251,72,24,247,49,
+247,215,6,188,251,62,251,19,166,251,39,27,252,124,251,131,251,199,252,46,
+251,242,247,92,252,9,248,161,247,115,247,115,217,139,31,14,247,26,121,29,
+14,247,26,121,29,251,161,250,173,37,10,197,53,29,14,197,53,29,14,252,18,249,
+156,249,164,171,10,251,123,28,4,135,171,10,197,53,29,118,250,37,42,10,197,
+53,29,247,79,28,250,168,48,29,197,53,29,247,79,28,251,76,74,10,197,53,29,
+118,28,251,92,73,29,197,53,29,136,28,251,117,58,29,247,232,53,29,249,53,248,
+161,79,10,197,28,4,170,251,111,21,247,207,248,176,10,251,215,248,185,29,247,
+166,251,115,247,206,29,247,45,96,240,247,21,247,74,211,247,74,30,252,39,248,
+58,244,29,197,123,29,14,197,123,29,247,200,28,251,132,21,247,23,7,254,35,
+140,5,251,23,7,14,197,28,5,45,28,5,12,237,29,251,23,28,250,244,21,156,10,
+14,248,98,249,171,22,247,193,144,10,115,6,114,119,162,164,31,28,5,67,161,
+10,223,247,127,10,228,28,5,199,28,5,63,21,247,32,251,60,172,251,15,251,142,
+251,39,251,56,251,161,30,62,248,185,29,248,39,235,7,53,246,29,250,57,235,
+10,230,28,5,199,251,191,21,247,236,10,28,6,15,247,44,29,251,215,146,10,251,
+46,7,251,160,247,41,251,62,247,140,247,17,247,58,174,247,31,30,253,68,248,
+138,244,29,230,28,5,199,28,5,63,21,247,32,251,60,172,251,15,251,142,251,39,
+251,56,251,161,30,62,146,10,251,46,7,251,160,247,41,251,62,247,140,247,17,
+247,58,174,247,31,247,236,10,250,242,235,10,247,98,28,5,154,247,138,21,229,
+71,219,251,9,76,75,122,115,80,30,28,4,117,247,44,29,251,222,7,139,251,5,164,
+61,251,201,251,117,248,99,29,215,219,176,176,200,30,78,49,89,43,111,53,243,
+100,24,180,235,207,247,21,225,247,1,8,49,202,247,3,124,223,27,247,58,247,
+58,217,247,93,31,251,26,106,21,67,64,66,59,81,123,239,233,135,30,160,180,
+184,149,186,27,199,179,114,84,31,252,141,131,21,118,94,77,123,82,27,251,70,
+51,247,31,247,105,247,105,229,247,60,247,82,201,223,108,139,31,252,236,7,
+115,141,118,141,119,30,14,197,249,171,250,123,21,248,184,10,248,39,235,7,
+53,246,29,28,5,86,254,7,248,148,29,143,155,151,164,27,247,251,6,160,151,117,
+131,31,28,251,114,247,127,10,249,20,247,102,29,253,244,4,248,8,247,145,29,
+248,222,161,10,249,55,248,17,247,78,10,250,188,53,29,28,5,116,253,244,248,
+192,10,250,188,53,29,28,5,116,253,244,248,199,10,249,8,28,6,215,22,247,236,
+251,33,7,112,251,66,5,119,137,117,110,118,27,251,244,6,248,172,249,144,5,
+247,6,253,39,149,10,7,249,3,250,7,21,251,240,252,136,5,248,136,7,251,167,
+253,60,244,10,249,38,28,7,16,247,171,21,231,82,196,251,11,251,49,48,251,29,
+251,62,84,30,251,25,6,248,173,249,144,5,247,6,253,50,149,10,248,155,7,114,
+39,127,44,135,62,8,247,12,6,142,204,155,237,159,247,1,8,199,6,247,58,247,
+49,217,247,93,31,252,33,248,240,21,251,240,252,136,5,248,136,7,248,246,253,
+15,21,65,74,86,61,30,59,6,247,0,172,178,215,200,27,203,165,135,86,31,254,
+9,94,244,10,249,30,28,6,238,188,21,247,68,251,69,247,79,251,146,30,248,9,
+248,129,5,233,253,33,149,10,247,56,7,247,1,203,215,247,94,247,51,27,247,52,
+201,251,0,251,48,251,52,38,251,121,251,47,83,53,149,152,94,31,72,247,100,
+116,150,110,155,102,137,25,76,53,119,251,5,251,27,247,99,251,11,247,158,247,
+207,247,153,247,152,247,154,31,252,56,249,97,21,251,183,252,33,5,248,33,7,
+251,167,252,199,244,10,248,246,247,102,29,172,253,116,21,45,192,247,14,80,
+247,91,27,247,135,247,65,228,247,98,31,247,42,7,187,10,28,4,232,247,44,29,
+251,222,7,139,251,5,247,201,10,247,69,247,28,156,170,30,14,174,101,29,174,
+101,29,252,24,249,135,250,185,21,247,178,252,113,223,247,1,26,195,191,167,
+192,174,168,127,114,178,30,170,42,5,132,152,177,136,151,27,199,176,179,173,
+199,51,220,251,93,251,39,251,6,75,251,5,62,247,6,81,247,3,67,31,251,44,95,
+251,49,61,251,45,26,251,97,247,78,78,247,67,247,52,247,83,225,247,97,30,251,
+92,131,21,251,21,83,54,34,39,87,215,247,12,247,3,227,218,224,181,30,217,82,
+201,72,49,26,14,252,56,249,107,250,231,21,247,140,251,107,247,102,139,30,
+247,35,209,105,196,251,43,64,36,231,251,100,75,5,85,7,247,10,135,183,97,251,
+36,68,171,83,247,52,218,161,118,200,55,145,131,25,131,87,154,102,27,251,94,
+251,8,251,48,251,57,251,61,247,6,251,31,247,133,247,81,247,32,247,11,247,
+110,31,251,81,131,21,251,28,104,251,16,251,6,251,11,108,247,10,247,12,247,
+25,186,247,18,247,21,178,178,115,139,30,149,120,174,71,251,18,26,14,247,186,
+53,10,14,251,118,250,39,28,4,182,21,247,132,251,61,247,55,251,196,30,252,
+44,77,6,213,247,80,10,65,132,5,77,248,52,7,247,174,247,75,247,32,247,173,
+31,251,107,126,21,251,155,251,38,71,251,7,137,30,251,2,137,5,249,60,223,7,
+247,29,247,42,77,251,175,31,14,154,247,101,10,253,129,247,161,10,251,173,
+123,21,251,198,251,62,64,251,25,137,30,251,15,137,5,249,162,229,7,247,52,
+247,68,69,251,219,31,14,247,186,53,10,123,28,4,175,49,10,247,186,53,10,251,
+116,250,181,42,10,247,186,53,10,123,28,251,96,48,29,247,186,53,10,123,254,
+144,74,10,247,186,53,10,251,116,254,128,73,29,247,186,53,10,251,98,254,103,
+58,29,247,186,75,10,247,186,75,10,154,247,101,10,251,186,251,64,251,21,247,
+64,251,218,247,161,10,252,134,80,21,247,21,251,101,247,203,229,7,247,52,247,
+68,69,251,219,251,198,251,62,64,251,25,137,31,251,15,137,5,247,234,7,14,248,
+79,28,6,23,249,82,21,248,36,251,153,247,164,252,103,30,252,168,6,251,107,
+251,11,70,251,44,45,192,77,199,239,154,148,194,194,248,64,10,165,156,123,
+112,31,254,191,7,129,124,125,125,137,30,251,23,126,247,144,10,251,69,135,
+30,251,62,135,5,28,4,110,247,21,7,247,103,247,124,35,252,107,31,14,236,28,
+4,219,243,21,251,17,247,70,29,250,178,248,39,10,247,17,149,5,243,254,148,
+248,148,29,145,152,151,165,27,247,203,6,160,149,121,127,31,252,103,7,139,
+75,149,97,251,249,251,153,37,251,192,251,191,247,158,70,248,22,30,248,171,
+6,252,99,247,7,21,78,6,251,126,251,16,211,247,83,247,136,247,53,167,247,62,
+172,168,133,135,165,31,14,28,5,20,53,10,28,5,66,253,60,248,192,10,28,5,20,
+53,10,28,5,66,253,60,248,199,10,28,5,204,53,10,28,5,240,253,60,21,248,193,
+29,28,5,204,53,10,28,5,240,253,60,21,86,10,250,12,28,7,87,49,10,215,215,248,
+54,21,251,171,247,38,251,31,248,102,30,248,151,243,6,34,247,70,29,250,178,
+247,26,29,31,247,208,22,248,67,29,253,2,7,123,116,137,117,27,251,126,66,235,
+247,97,31,14,249,62,249,236,217,21,72,226,247,0,105,247,41,27,247,115,247,
+142,247,3,247,99,31,247,37,247,9,10,251,52,7,37,64,86,55,35,75,198,235,30,
+250,58,247,26,29,251,104,240,251,108,248,47,239,235,173,193,211,31,252,100,
+247,232,21,248,67,29,252,238,7,122,109,97,134,100,27,251,57,47,235,247,97,
+31,14,247,12,247,88,29,247,186,184,29,247,20,29,31,252,14,116,247,206,10,
+14,250,182,247,20,10,28,4,231,21,247,21,6,247,103,247,123,35,252,107,248,
+39,29,31,251,62,135,5,251,185,22,247,155,29,6,14,250,182,247,20,10,247,13,
+21,247,20,29,248,39,29,31,252,99,135,21,247,155,29,251,99,6,141,121,121,140,
+120,27,251,117,251,16,251,57,251,81,251,117,247,59,251,48,247,96,151,150,
+139,140,149,31,248,122,247,232,247,206,10,253,59,22,247,48,213,241,247,11,
+152,30,252,174,129,7,51,44,228,247,70,31,14,247,186,184,29,221,7,247,217,
+154,247,64,247,15,247,243,26,247,216,251,24,247,60,252,1,146,30,203,247,221,
+29,252,207,251,175,247,3,10,243,247,228,21,247,214,10,250,182,247,29,29,250,
+174,249,60,21,248,39,29,30,251,62,135,5,221,7,247,217,154,247,64,247,15,247,
+243,26,247,216,251,24,247,60,252,1,146,30,203,247,221,29,28,250,101,22,248,
+149,29,75,6,252,1,132,251,24,251,60,251,216,26,251,243,247,64,251,15,247,
+217,124,30,57,7,248,51,10,248,152,247,183,21,251,27,65,54,251,81,251,117,
+247,9,63,247,6,152,150,139,140,148,31,63,7,251,152,150,62,247,6,247,116,26,
+247,94,162,247,70,247,206,137,30,59,7,141,122,121,140,119,27,247,240,252,
+210,247,3,10,252,33,247,228,21,247,48,174,161,208,152,30,252,14,129,7,99,
+85,148,247,70,31,248,137,22,247,214,10,248,4,247,87,249,82,21,218,230,247,
+39,189,247,37,27,151,150,138,138,150,31,82,66,92,54,97,46,92,36,112,251,10,
+111,38,8,171,104,100,162,91,27,251,12,67,67,40,40,220,85,203,229,197,172,
+218,192,31,77,186,201,84,237,27,247,214,247,25,247,103,247,208,247,79,251,
+17,247,14,251,58,188,31,202,208,214,193,231,174,102,186,24,251,13,104,43,
+75,59,54,8,142,114,114,141,113,27,251,60,251,34,84,45,251,8,31,248,48,251,
+113,21,177,246,185,235,199,220,8,247,27,86,196,251,22,251,12,26,251,165,71,
+251,94,251,114,67,90,203,206,87,30,130,151,179,222,181,247,7,193,247,45,25,
+248,82,253,212,21,208,247,59,149,212,175,247,6,8,103,155,218,121,202,27,247,
+25,221,206,247,5,247,2,40,197,41,251,41,73,85,41,107,31,83,251,64,118,251,
+49,66,251,55,8,247,140,248,106,21,202,196,191,209,209,196,87,76,76,82,87,
+69,69,82,191,202,30,254,53,245,21,181,171,98,89,173,31,48,108,101,77,73,27,
+91,101,189,196,220,178,195,213,31,14,33,35,29,14,252,119,249,43,252,38,21,
+237,7,139,41,70,251,25,251,23,64,223,247,26,30,248,73,168,6,247,35,63,247,
+29,251,101,251,95,251,24,251,28,251,78,251,62,247,5,251,29,247,118,247,61,
+247,4,212,139,30,251,82,247,208,21,251,132,6,216,171,230,237,218,170,76,61,
+30,14,252,120,249,42,249,222,198,10,251,180,28,4,193,198,10,33,35,29,183,
+248,96,52,29,33,35,29,247,130,248,96,46,10,33,35,29,247,83,248,96,64,29,33,
+35,29,247,83,248,96,65,10,33,35,29,247,83,248,96,68,29,247,74,249,104,38,
+10,33,35,29,247,83,248,96,68,29,127,249,63,43,29,33,35,29,122,254,116,90,
+29,247,100,28,5,172,48,29,33,35,29,247,56,248,96,62,10,33,35,29,247,56,249,
+174,58,10,33,35,29,247,88,249,84,83,10,33,35,29,247,83,249,191,49,10,33,35,
+29,247,95,249,164,38,10,33,35,29,247,83,248,168,74,10,33,35,29,247,83,248,
+168,228,29,249,58,248,201,33,10,33,35,29,247,83,248,168,228,29,248,185,247,
+190,52,29,33,35,29,247,92,249,51,37,10,33,35,29,122,249,49,42,10,33,35,29,
+148,249,123,43,29,33,35,29,247,83,28,251,108,48,29,33,35,29,247,95,253,222,
+134,29,33,35,29,122,254,116,73,29,247,157,250,146,247,233,21,138,137,138,
+137,137,26,144,7,139,251,42,251,87,247,40,29,247,79,247,33,242,198,204,30,
+62,165,216,54,233,27,247,56,217,247,93,139,31,247,55,7,130,134,53,251,77,
+251,17,27,51,45,198,247,29,31,251,187,247,174,247,225,10,14,33,35,29,209,
+254,60,59,10,33,35,29,247,56,249,174,66,10,45,28,249,62,59,10,33,250,66,247,
+245,10,211,234,227,182,31,251,52,124,247,197,10,217,248,94,165,29,33,28,5,
+176,247,28,29,248,60,165,29,33,35,29,247,114,248,92,247,185,29,247,54,247,
+201,249,3,110,29,247,69,248,241,227,21,171,91,5,247,35,100,150,109,251,183,
+26,247,31,6,247,183,143,169,247,50,178,30,163,187,5,253,172,248,171,110,29,
+33,82,10,33,82,10,33,82,10,252,119,249,43,251,45,21,247,63,251,5,247,28,251,
+118,251,63,251,2,67,139,30,40,7,139,236,208,247,26,247,22,213,56,251,26,30,
+252,71,109,6,251,35,213,251,29,247,103,247,94,247,25,247,29,247,77,30,251,
+84,58,21,62,107,46,41,60,108,202,219,30,166,7,14,252,120,249,42,250,216,21,
+247,62,251,5,247,29,251,117,251,62,251,3,65,139,30,41,7,139,235,208,247,27,
+247,21,213,55,251,25,30,252,70,109,6,251,36,213,251,27,247,103,247,92,247,
+26,247,29,247,77,30,251,83,57,21,63,108,47,41,59,108,200,219,30,166,7,14,
+33,160,29,248,155,250,86,37,10,220,249,61,248,13,21,248,96,252,228,6,248,
+98,10,248,12,10,249,91,252,225,7,247,231,159,169,10,14,247,128,28,5,174,249,
+117,21,61,182,5,57,119,126,37,49,27,74,127,207,218,31,247,87,7,59,180,251,
+81,251,17,5,243,53,251,29,205,251,78,27,251,154,251,62,251,13,139,31,248,
+155,29,247,15,229,86,45,190,30,252,242,252,42,5,251,70,180,247,17,251,40,
+247,150,27,247,203,247,97,247,116,247,199,235,118,233,98,217,31,247,11,219,
+5,251,58,7,49,209,43,237,247,48,174,247,33,233,157,30,253,99,251,144,21,251,
+39,125,251,136,251,89,251,43,122,247,46,247,6,30,248,3,247,142,5,147,102,
+143,94,94,26,14,33,250,144,248,123,21,247,222,251,105,247,99,251,171,251,
+215,251,34,251,101,251,129,30,69,249,34,7,251,124,75,251,80,251,51,251,75,
+251,33,231,231,51,30,251,29,7,251,13,241,247,27,100,247,91,27,247,171,247,
+115,247,101,247,195,31,251,205,247,28,21,252,26,6,247,10,150,204,247,58,247,
+11,27,245,213,251,15,251,53,154,31,14,251,168,249,244,247,27,125,29,252,231,
+248,197,249,246,21,236,7,55,41,63,112,69,27,60,112,194,190,187,159,173,242,
+143,31,174,199,6,42,105,170,221,190,165,196,190,162,184,133,133,143,31,38,
+7,139,166,101,194,186,180,177,184,236,251,5,184,251,17,251,27,251,2,63,33,
+98,161,91,178,103,30,88,116,98,96,71,26,251,21,243,80,247,62,211,225,157,
+217,225,30,14,251,168,28,5,20,247,28,29,248,99,125,29,251,168,249,228,247,
+183,120,29,252,226,248,187,250,84,21,206,96,181,87,162,30,180,176,163,187,
+181,26,243,251,4,215,251,27,251,17,251,5,94,45,92,180,100,185,194,166,179,
+139,30,240,7,145,145,183,145,162,27,190,167,80,90,55,104,108,41,31,80,7,174,
+138,5,242,137,159,103,94,26,86,114,83,59,68,64,166,223,39,30,42,7,63,226,
+224,119,212,27,247,62,244,200,247,21,31,14,251,168,248,248,247,38,10,247,
+128,248,255,120,29,216,28,5,14,249,144,21,62,182,5,57,120,125,35,51,27,71,
+127,208,217,31,247,89,7,59,180,251,80,251,17,5,227,71,251,13,194,251,29,27,
+248,31,29,31,199,10,247,4,73,209,59,178,31,201,200,176,219,209,26,164,135,
+163,133,162,30,247,19,227,5,251,60,7,49,208,40,237,247,48,174,247,36,233,
+157,30,14,251,196,223,250,29,21,251,54,7,234,247,4,247,5,189,225,27,244,188,
+65,51,63,89,66,33,31,84,137,5,41,7,247,41,212,77,251,21,55,97,251,0,251,33,
+99,96,153,147,132,31,247,60,7,184,116,103,160,73,27,67,78,75,61,251,49,247,
+84,63,247,84,247,99,247,84,247,29,247,66,229,82,228,58,171,31,226,190,177,
+227,231,26,247,77,251,43,247,3,251,124,251,11,38,110,49,251,4,30,14,252,250,
+194,28,5,48,21,42,7,196,211,213,169,195,27,207,171,94,87,93,106,95,70,31,
+104,138,5,80,7,236,186,102,62,88,112,74,47,113,111,148,144,135,31,239,7,166,
+124,115,152,96,27,92,100,101,92,45,247,17,93,247,16,247,27,247,17,221,244,
+193,102,192,86,158,31,196,170,163,192,194,26,247,3,41,205,251,43,62,73,122,
+85,67,30,14,66,250,177,248,132,21,247,238,251,50,247,74,251,242,251,81,251,
+135,71,251,125,248,65,10,251,179,247,166,110,247,113,247,234,247,42,247,107,
+247,198,30,251,138,141,21,251,75,88,251,117,251,77,251,25,251,4,199,247,35,
+215,169,198,247,48,143,30,248,123,29,247,31,198,184,247,15,247,113,178,251,
+150,251,43,31,14,66,250,177,247,183,21,247,4,71,209,61,178,30,201,200,176,
+219,209,26,247,125,251,138,207,251,79,251,244,251,47,251,74,251,238,251,198,
+247,41,251,107,247,232,247,113,247,169,168,247,179,30,251,152,141,21,251,
+35,251,7,79,251,23,251,79,88,247,117,247,75,247,43,178,247,150,247,115,247,
+15,199,94,251,31,251,31,83,87,251,41,30,41,7,194,137,5,247,48,135,172,80,
+63,26,14,251,98,205,247,171,21,251,75,247,28,251,13,247,242,247,19,235,158,
+188,247,35,30,247,162,251,12,7,112,251,35,133,106,114,129,121,129,25,122,
+104,251,13,123,121,27,251,1,43,198,247,30,247,47,247,25,154,186,180,229,122,
+139,31,247,31,7,135,82,120,137,131,27,51,45,195,247,21,247,27,241,167,197,
+198,205,107,112,174,31,149,131,159,122,135,26,139,164,251,29,143,123,30,247,
+7,247,142,6,202,251,40,45,176,251,21,27,251,136,251,52,251,1,251,35,57,170,
+251,4,247,64,83,31,251,56,115,59,47,251,19,26,14,251,98,94,10,14,251,98,94,
+10,48,250,184,37,10,251,98,247,112,247,140,10,240,66,220,79,188,30,247,185,
+156,247,8,247,8,247,61,26,112,10,247,14,97,227,120,241,134,8,198,88,178,81,
+70,248,74,29,37,250,42,247,171,21,156,29,251,48,135,251,17,139,30,172,6,247,
+62,247,12,69,251,141,31,247,17,6,141,248,51,251,16,246,29,14,248,78,250,44,
+247,155,21,247,19,57,247,0,173,29,247,27,113,251,47,251,91,247,37,43,247,
+144,247,135,247,55,228,247,98,30,247,42,248,178,29,251,52,7,251,13,97,100,
+57,57,91,192,247,2,30,14,175,32,10,14,252,29,249,136,249,165,21,247,117,42,
+7,119,251,20,5,130,138,127,125,128,27,251,182,247,205,247,50,6,151,148,126,
+130,141,31,151,55,5,222,247,181,56,6,127,56,5,130,137,130,125,127,27,251,
+50,247,181,247,140,6,150,148,128,127,143,31,159,37,5,236,247,88,253,60,77,
+6,213,247,80,10,65,132,5,77,7,14,251,90,250,64,22,208,10,253,218,43,6,240,
+131,5,153,137,149,248,135,10,131,130,123,137,30,38,131,5,43,7,14,175,32,10,
+249,136,28,5,248,52,29,175,32,10,250,74,28,5,248,46,10,175,32,10,250,27,28,
+5,248,64,29,175,32,10,250,27,28,5,248,65,10,175,32,10,250,27,28,5,248,68,
+29,247,74,249,104,38,10,175,32,10,250,27,28,5,248,68,29,127,249,63,43,29,
+175,32,10,249,75,248,177,29,28,7,60,48,29,175,32,10,250,0,28,5,248,62,10,
+175,32,10,250,0,28,7,70,58,10,175,32,10,250,32,28,6,240,83,29,175,32,10,250,
+27,28,7,87,49,10,175,32,10,250,39,28,7,60,38,10,175,32,10,250,27,28,6,64,
+74,10,175,32,10,250,27,28,6,64,228,29,249,58,248,201,33,10,175,32,10,250,
+27,28,6,64,228,29,248,185,247,190,52,29,175,32,10,250,36,28,6,203,37,10,175,
+32,10,249,75,28,6,201,42,10,175,32,10,249,101,28,7,19,43,29,175,32,10,250,
+27,252,140,48,29,175,32,10,250,39,74,29,175,32,10,249,75,70,29,175,32,10,
+249,189,89,10,175,32,10,249,189,251,160,139,29,206,28,8,82,58,10,175,32,10,
+250,130,251,254,67,29,175,250,120,215,29,200,28,250,63,21,131,10,14,251,90,
+190,250,123,21,251,181,247,29,7,166,247,54,5,145,151,151,143,30,247,228,251,
+242,251,70,6,112,135,247,9,147,137,31,251,11,252,0,247,11,6,153,141,145,247,
+3,164,27,247,70,251,210,251,177,6,131,131,145,150,137,31,112,247,23,5,251,
+27,251,148,249,218,235,6,38,147,5,125,141,129,147,150,26,249,129,7,149,147,
+148,155,141,30,240,147,5,235,7,14,248,132,28,6,86,249,150,101,10,248,72,249,
+74,227,21,171,91,5,247,35,100,150,251,22,251,183,26,247,62,6,247,183,143,
+247,22,247,50,178,30,163,187,5,247,218,249,62,101,10,175,247,19,248,58,29,
+251,220,247,39,7,172,247,62,5,160,143,154,157,157,27,248,17,252,117,251,136,
+6,121,125,161,154,136,31,121,247,31,5,251,19,252,117,247,19,6,157,247,31,
+5,153,142,155,162,155,27,247,136,252,158,252,82,6,248,151,10,251,42,252,11,
+250,234,243,6,251,4,149,5,116,142,115,247,117,29,163,155,162,141,30,247,4,
+150,5,243,7,14,100,247,42,28,5,80,21,251,32,249,70,252,106,253,50,251,32,
+249,50,252,106,253,70,251,32,249,230,28,5,80,7,14,100,247,89,251,77,21,242,
+98,224,247,118,5,248,251,28,5,80,40,6,214,247,88,33,178,50,251,127,5,253,
+11,251,32,248,214,6,251,70,252,106,5,252,16,251,32,247,219,6,251,69,252,106,
+5,251,62,251,32,247,9,6,248,209,248,246,21,252,106,252,38,7,247,71,248,106,
+5,192,247,32,21,247,62,248,84,5,252,84,7,14,252,29,222,28,6,73,21,251,88,
+234,7,161,241,5,151,141,149,150,151,27,247,139,251,181,251,50,6,127,130,153,
+148,137,31,127,222,5,57,251,181,221,6,151,223,5,147,141,149,153,150,27,247,
+50,251,205,251,182,6,128,128,153,148,137,31,119,247,20,5,42,251,117,249,101,
+201,6,66,145,5,124,141,124,149,155,26,249,12,7,156,154,148,154,140,30,212,
+146,5,201,7,14,247,94,145,29,247,94,145,29,247,94,150,10,249,18,28,4,185,
+37,10,216,28,4,172,247,158,21,246,73,180,70,92,102,128,139,30,43,251,154,
+108,107,110,122,55,141,25,251,207,143,102,247,21,247,23,26,247,75,231,245,
+247,117,150,247,15,135,139,30,247,15,7,63,135,5,251,136,80,247,31,247,31,
+247,48,210,237,247,87,180,198,133,98,197,31,251,95,7,139,223,121,163,215,
+213,172,243,247,38,251,30,237,251,205,251,209,251,107,67,251,166,251,89,247,
+27,55,247,52,90,30,251,110,131,251,49,43,251,132,26,251,123,247,43,251,81,
+247,253,247,140,247,252,247,5,247,78,30,14,216,209,247,158,21,251,78,247,
+252,251,5,247,140,247,253,247,43,247,81,247,123,247,132,251,49,235,251,110,
+147,30,247,52,188,247,27,223,247,89,26,247,166,251,107,211,251,209,251,205,
+251,30,41,251,38,35,213,106,215,163,223,157,139,30,247,95,7,180,197,198,145,
+180,27,247,87,210,41,251,48,251,31,80,251,31,251,136,31,63,143,5,251,15,7,
+139,247,15,143,150,247,117,231,33,251,75,251,23,102,251,21,251,207,135,30,
+55,137,110,156,108,171,43,247,154,24,139,102,150,92,70,73,98,32,30,14,105,
+216,248,23,21,251,148,247,62,251,56,248,60,247,47,227,156,210,247,58,30,247,
+222,251,47,7,96,251,84,132,106,109,110,65,112,25,125,98,102,133,115,27,251,
+42,251,48,247,9,247,82,247,109,247,95,174,211,194,237,121,139,31,247,45,7,
+135,84,115,137,124,27,251,17,251,43,217,247,72,247,79,247,54,204,223,245,
+172,100,119,157,31,147,130,166,96,141,131,180,251,84,24,247,50,247,209,6,
+227,251,72,38,170,251,52,27,251,182,251,91,251,37,251,95,251,11,225,251,29,
+247,115,61,31,251,105,110,251,41,251,17,251,76,26,14,105,92,29,14,105,92,
+29,251,78,28,5,72,37,10,105,247,182,247,140,10,236,72,217,81,189,30,247,241,
+164,247,35,247,48,247,127,26,107,29,247,48,72,226,120,247,32,137,8,192,90,
+173,84,75,248,74,29,233,250,203,248,23,21,147,10,30,252,27,247,254,29,247,
+42,248,160,6,251,44,150,5,116,141,110,155,166,26,14,249,68,249,170,247,235,
+21,251,163,247,78,34,247,122,247,115,247,142,247,13,247,99,30,247,223,7,247,
+86,10,44,86,196,247,52,247,140,251,11,246,251,135,177,183,10,239,247,64,93,
+251,146,30,14,253,108,248,195,28,6,68,21,208,65,168,86,251,9,47,73,53,86,
+30,108,88,123,80,79,26,55,98,5,90,225,252,52,7,123,127,127,122,30,84,135,
+5,81,248,9,197,7,57,248,136,10,248,52,247,38,217,251,40,221,7,247,3,155,177,
+166,176,30,247,23,251,4,5,184,151,178,170,176,26,14,252,114,78,29,251,75,
+248,1,42,10,252,114,249,17,251,107,21,247,139,251,21,251,143,154,29,247,115,
+28,6,31,157,29,14,252,114,78,29,251,63,253,125,38,10,252,114,249,240,28,5,
+72,21,247,191,29,138,251,82,251,23,247,82,7,140,251,38,5,251,83,251,21,247,
+83,6,141,252,72,5,247,166,10,138,248,72,5,247,108,247,21,251,108,6,138,247,
+38,5,247,109,247,23,251,109,241,6,248,173,29,249,131,28,6,240,247,154,29,
+251,38,90,5,252,37,247,11,6,247,78,163,232,10,247,191,29,200,29,248,13,253,
+74,185,29,252,114,176,10,14,252,114,176,10,251,188,248,61,42,10,252,114,249,
+42,250,216,21,247,23,251,82,7,147,232,159,186,169,183,247,95,251,82,24,248,
+43,29,247,112,29,126,118,127,118,129,118,8,251,116,251,23,247,71,6,133,107,
+136,106,105,247,100,10,250,66,7,14,252,114,249,68,250,54,21,80,235,251,54,
+251,6,5,247,74,7,247,78,161,232,10,248,176,29,251,166,7,251,106,251,42,196,
+41,247,49,247,2,5,252,72,247,130,10,249,5,7,14,251,96,250,68,249,46,21,247,
+225,254,23,121,10,249,111,248,169,10,251,96,250,68,249,46,21,247,225,254,
+23,121,10,249,111,247,69,29,134,249,109,33,10,251,196,249,226,250,5,21,247,
+225,251,9,7,108,251,68,5,111,135,133,128,110,27,252,250,43,6,247,57,10,249,
+111,7,14,251,96,250,68,249,46,21,247,225,254,23,247,10,10,247,60,7,248,35,
+29,248,51,6,65,246,29,249,111,248,169,10,251,96,250,68,249,46,21,247,225,
+254,23,43,7,247,87,10,248,169,235,7,65,246,29,247,184,247,76,247,11,251,76,
+247,212,248,169,10,251,96,248,214,251,107,21,247,203,7,65,246,29,247,184,
+247,76,247,11,251,76,247,212,247,69,29,247,7,247,225,254,23,43,6,247,87,10,
+248,40,251,111,154,29,14,251,129,250,33,249,107,21,247,164,253,240,43,7,247,
+1,131,5,155,137,149,131,128,26,253,121,7,119,125,132,119,137,30,139,69,133,
+112,137,30,43,248,169,235,7,251,7,147,5,125,141,124,150,155,26,247,195,247,
+75,7,247,95,29,251,75,247,228,247,167,6,159,145,131,128,141,31,164,251,35,
+5,14,95,132,10,251,125,249,93,42,10,152,250,30,248,161,21,247,17,252,5,247,
+7,248,5,247,17,252,5,247,251,248,7,7,157,154,121,118,142,247,230,29,137,162,
+122,112,26,251,216,251,56,251,17,247,56,251,7,251,56,251,17,247,56,252,1,
+247,120,10,248,1,7,14,95,250,214,250,148,21,247,242,254,165,247,193,10,28,
+251,15,197,29,248,140,248,73,29,14,95,248,142,28,4,225,21,248,7,6,157,153,
+121,118,143,247,230,29,136,162,123,112,26,252,105,247,197,29,253,45,197,29,
+6,14,95,247,94,250,148,21,168,247,78,5,160,143,153,157,157,27,248,7,252,140,
+251,146,6,121,124,162,247,200,10,156,161,155,27,247,146,252,90,6,112,119,
+123,114,137,30,251,25,128,5,35,249,9,243,7,251,3,150,5,115,141,116,247,117,
+29,162,155,163,142,30,247,9,149,5,243,254,165,251,242,7,14,111,206,10,14,
+80,250,205,250,181,21,98,247,244,5,254,127,108,6,247,19,221,96,251,8,31,254,
+169,7,47,251,11,88,49,30,108,248,252,170,7,49,251,11,190,231,31,250,191,7,
+207,180,169,191,30,247,150,6,247,60,186,251,17,251,49,182,31,14,251,45,250,
+139,249,91,21,247,180,254,84,247,11,29,248,187,248,125,29,249,101,248,130,
+10,247,221,6,248,128,10,111,206,10,86,249,194,33,10,251,20,250,140,28,4,227,
+21,248,27,251,42,7,102,251,121,5,108,135,129,131,115,27,253,118,35,6,247,
+7,247,11,10,251,7,128,5,35,248,249,243,7,251,7,247,105,29,250,215,7,14,111,
+247,56,10,247,15,247,254,29,247,42,248,160,6,247,133,10,14,111,250,240,250,
+105,21,248,29,254,187,35,7,247,72,10,248,249,243,247,61,10,14,111,249,46,
+251,107,21,247,211,247,61,10,247,41,248,29,254,187,35,6,247,72,10,248,120,
+251,111,154,29,14,252,88,249,107,28,5,8,21,213,251,66,7,151,96,78,164,55,
+27,251,56,251,23,71,251,39,251,21,247,8,94,186,128,31,88,98,115,107,98,26,
+122,145,113,151,116,30,102,145,43,107,36,26,251,23,247,37,80,247,32,247,66,
+247,76,231,247,35,242,251,5,196,251,182,162,30,122,173,160,158,169,159,8,
+247,19,131,247,85,186,247,56,26,190,110,182,139,30,251,39,47,21,67,108,64,
+65,68,108,214,211,209,166,210,218,205,174,68,69,30,192,252,134,21,59,61,88,
+68,67,63,201,219,30,141,184,162,165,157,164,8,205,133,247,80,124,53,26,14,
+87,36,10,228,28,6,0,33,10,87,36,10,246,28,4,245,48,29,87,36,10,219,28,6,67,
+58,10,87,36,10,246,28,6,84,49,10,87,36,10,246,28,5,61,74,10,87,36,10,38,28,
+5,198,42,10,87,36,10,252,34,28,5,160,247,51,29,87,28,4,113,251,100,21,247,
+3,58,7,140,144,139,144,144,26,248,23,10,8,247,85,127,247,189,217,247,166,
+26,223,98,211,139,30,247,72,247,13,251,158,6,247,111,10,251,105,247,73,61,
+210,122,31,248,92,10,91,147,251,12,98,109,251,15,8,67,251,3,209,6,251,74,
+172,247,96,56,247,89,27,247,109,247,119,240,247,56,218,31,251,210,250,20,
+247,92,29,251,40,254,172,21,54,49,202,228,104,31,248,67,6,45,106,40,81,50,
+27,251,54,248,29,21,230,130,247,131,121,192,36,8,252,80,6,147,198,169,177,
+162,172,8,14,87,250,242,249,197,21,251,49,108,5,128,170,127,162,139,26,247,
+72,247,13,251,158,6,247,111,10,123,140,124,141,125,31,251,6,117,161,251,9,
+247,23,164,197,43,241,98,189,127,25,234,29,247,81,127,247,180,214,151,247,
+152,247,55,170,24,251,240,253,219,247,75,10,252,40,249,207,21,247,9,182,247,
+13,247,15,226,189,49,42,152,30,251,208,77,5,247,54,251,127,21,67,93,189,206,
+115,31,247,185,196,5,45,123,92,59,51,27,14,193,250,185,159,113,29,252,18,
+249,70,249,177,21,248,238,248,25,10,251,11,251,103,251,64,237,251,19,247,
+55,235,247,4,224,139,31,81,7,251,40,70,56,64,101,115,145,161,104,30,90,247,
+7,5,139,111,145,120,99,92,103,102,62,241,75,247,53,247,173,197,247,42,247,
+38,30,251,70,247,1,21,139,83,115,92,251,8,81,226,247,20,247,20,174,240,248,
+165,29,248,78,28,6,75,247,23,10,252,186,247,8,113,29,193,250,185,28,4,168,
+21,247,58,170,172,188,163,30,247,94,251,82,5,248,43,29,247,9,251,6,178,57,
+251,253,251,17,251,177,251,195,30,198,68,61,131,29,87,155,251,182,21,251,
+13,247,158,7,117,207,235,98,247,21,27,247,142,247,95,247,5,247,137,247,105,
+251,73,217,68,156,31,216,208,176,190,209,26,166,131,184,121,176,30,194,130,
+247,41,193,247,62,26,247,111,251,115,237,251,107,251,160,251,177,251,46,251,
+129,251,64,247,66,45,248,85,102,30,163,81,109,107,90,106,8,251,85,151,251,
+189,61,251,166,26,55,180,67,139,30,247,121,247,44,21,247,13,186,247,19,247,
+3,247,5,188,251,17,251,13,251,9,96,251,13,251,15,37,87,247,15,247,5,30,55,
+249,209,21,247,25,247,15,225,247,1,247,0,247,11,37,251,23,137,30,63,102,94,
+113,100,30,36,149,251,183,160,247,35,26,14,251,36,222,249,170,21,248,178,
+6,251,172,56,83,251,5,251,21,26,42,174,75,192,87,30,251,95,70,251,21,251,
+18,251,70,26,251,86,247,42,251,50,247,185,247,181,247,115,247,99,247,111,
+30,247,239,252,137,178,247,106,26,226,247,32,226,247,137,202,30,159,247,101,
+253,201,6,248,26,253,201,21,247,22,55,247,42,84,251,55,26,251,35,251,26,65,
+58,251,22,33,247,9,247,28,247,0,193,230,247,9,206,30,14,35,250,76,251,131,
+21,252,168,6,247,172,222,195,247,5,247,21,26,236,104,203,86,191,30,247,95,
+208,247,41,247,18,247,70,26,247,86,251,62,247,50,251,185,251,181,251,95,251,
+99,251,111,30,251,239,248,117,100,251,106,26,52,251,56,251,6,251,133,103,
+30,119,251,101,249,211,6,252,16,249,201,21,251,22,223,251,22,194,247,55,26,
+247,35,247,6,213,220,247,22,247,18,251,9,251,28,251,0,65,48,251,9,72,30,14,
+128,249,49,250,27,21,166,186,134,123,167,31,251,81,7,116,171,176,114,207,
+27,221,202,213,219,247,65,251,102,191,251,86,251,233,251,136,251,107,251,
+203,251,165,247,95,251,142,247,218,247,194,247,1,247,47,247,1,153,31,159,
+247,48,168,143,213,150,8,235,252,144,43,7,247,39,133,163,95,134,40,8,47,134,
+103,71,251,14,27,251,32,251,49,247,24,247,165,247,161,247,61,247,20,247,53,
+31,14,251,129,250,46,250,254,21,202,252,37,76,7,228,133,5,155,153,128,123,
+31,251,131,7,136,107,123,142,127,27,251,101,251,8,247,27,247,103,247,66,227,
+247,62,247,124,154,179,133,124,180,31,150,136,150,125,141,130,165,251,24,
+24,243,247,104,6,139,251,17,187,251,66,251,168,251,93,251,56,251,158,251,
+154,247,92,251,64,247,158,247,71,247,22,197,139,30,247,166,7,155,153,149,
+156,140,30,14,128,28,4,117,248,46,21,248,125,10,121,129,31,251,159,247,16,
+10,143,131,251,46,196,251,105,247,131,10,247,218,7,149,149,157,156,30,14,
+247,169,49,29,251,88,28,4,206,33,10,247,169,49,29,251,70,250,87,48,29,247,
+169,49,29,251,97,28,5,17,58,10,247,169,49,29,251,70,28,5,34,49,10,247,169,
+49,29,251,70,250,159,74,10,247,169,49,29,252,22,28,4,148,42,10,247,169,49,
+29,252,4,253,244,58,29,247,169,28,5,139,248,211,21,247,142,29,251,3,251,176,
+251,7,247,176,251,65,247,162,29,161,201,129,114,202,31,156,133,157,116,141,
+247,39,10,247,123,247,58,247,7,251,58,247,3,7,166,161,155,164,141,30,14,247,
+224,28,6,3,250,87,21,254,213,251,103,5,247,163,155,247,31,247,141,247,227,
+27,161,201,128,115,202,31,156,133,156,116,142,125,248,38,10,139,251,85,219,
+251,160,252,60,251,201,251,166,252,78,30,251,53,108,160,251,11,247,40,167,
+5,252,3,191,247,178,251,127,248,7,27,247,166,247,93,235,139,31,248,37,10,
+243,149,5,247,142,29,252,35,7,135,90,114,143,121,27,251,193,251,67,247,88,
+247,204,117,31,250,237,247,107,5,14,247,169,28,6,147,28,6,41,21,213,251,19,
+231,60,251,109,251,85,251,21,251,124,30,158,63,45,145,51,27,247,182,10,31,
+248,37,10,243,149,5,247,41,10,190,219,112,129,161,31,154,133,153,120,131,
+26,182,251,119,5,247,52,248,62,6,247,4,184,225,192,158,30,247,107,251,91,
+5,194,160,184,204,211,26,14,128,28,5,139,28,4,197,21,247,8,251,6,178,57,251,
+128,251,11,251,33,251,126,30,152,76,90,149,32,247,131,10,247,207,7,150,149,
+167,156,30,231,148,5,248,125,10,111,128,31,251,148,247,16,10,247,78,164,204,
+180,201,30,247,94,251,83,5,205,162,200,188,203,26,14,247,55,28,5,6,184,21,
+28,5,82,247,125,10,251,181,248,154,29,251,7,7,251,74,251,0,251,89,251,117,
+36,65,154,175,90,30,247,79,7,193,101,90,173,65,27,38,74,75,38,251,29,247,
+57,251,55,248,24,247,252,247,158,247,108,247,189,31,251,185,247,131,21,139,
+251,17,63,37,251,99,251,50,247,116,247,214,29,152,249,57,251,98,21,247,98,
+7,247,95,148,247,36,221,139,26,248,72,7,165,157,154,159,141,30,202,149,5,
+239,252,20,39,7,158,136,5,159,136,157,118,113,26,252,17,7,136,100,119,142,
+124,27,123,123,140,140,124,31,250,218,7,140,152,153,140,153,27,157,188,130,
+115,190,31,152,133,154,117,140,126,172,251,103,24,247,20,247,230,6,139,251,
+37,211,251,96,144,30,247,38,251,16,251,47,7,251,177,90,251,89,251,141,252,
+14,26,252,13,247,93,251,151,247,173,93,30,251,105,7,251,121,250,27,21,247,
+108,204,247,103,247,56,222,30,254,146,7,251,41,215,59,247,76,247,144,26,14,
+35,227,28,4,141,21,248,198,6,251,172,56,63,251,10,40,26,62,167,97,219,85,
+30,251,95,70,251,51,251,18,251,70,26,251,86,247,72,251,50,247,185,247,181,
+247,135,247,99,247,111,30,247,229,252,157,188,247,46,26,226,247,56,226,247,
+143,197,30,159,247,101,253,251,6,248,46,253,136,21,247,22,55,247,62,84,251,
+55,26,251,35,251,36,65,58,251,22,251,38,247,9,247,28,247,0,223,230,247,9,
+206,30,14,35,250,101,247,101,21,252,188,6,247,172,222,215,247,10,238,26,206,
+121,191,59,193,30,247,95,208,247,51,247,18,247,70,26,247,86,251,72,247,50,
+251,185,251,181,251,135,251,99,251,111,30,251,229,248,147,90,251,46,26,52,
+251,73,37,251,146,96,30,119,251,101,250,5,6,252,26,249,136,21,251,22,223,
+251,62,194,247,55,26,247,35,247,36,213,220,247,22,247,38,251,9,251,28,251,
+0,55,48,251,9,72,30,14,247,169,28,5,169,249,60,21,253,28,34,6,247,78,126,
+180,67,251,50,26,251,11,57,56,251,21,251,75,251,133,247,46,248,50,248,17,
+247,89,247,85,247,187,186,200,120,123,178,30,157,131,155,120,142,123,248,
+38,10,189,251,35,251,44,169,251,46,27,252,95,251,174,251,179,252,66,252,92,
+247,180,251,159,248,53,247,209,247,20,247,53,247,75,166,31,168,247,88,168,
+197,247,26,149,8,14,251,240,249,173,248,85,29,83,142,5,123,140,126,152,154,
+26,247,223,7,212,113,247,12,251,49,35,251,21,63,139,30,248,8,70,248,141,29,
+124,126,126,122,138,30,85,136,5,81,247,230,197,7,93,142,5,122,140,126,152,
+154,26,248,31,7,139,211,156,192,238,152,57,99,30,251,182,248,40,10,96,248,
+106,29,251,254,249,181,249,164,151,10,251,103,28,4,135,151,10,232,44,10,104,
+28,6,32,48,29,232,44,10,247,161,28,7,127,49,10,232,44,10,247,170,28,6,243,
+37,10,232,44,10,200,28,6,241,42,10,232,44,10,247,134,251,17,58,10,232,44,
+10,247,161,251,232,74,10,232,44,10,200,70,29,232,44,10,251,30,89,10,232,28,
+4,205,251,107,21,247,203,136,29,248,23,251,111,154,29,14,232,28,4,205,22,
+235,7,53,246,29,248,188,247,25,10,247,87,247,105,247,23,251,105,247,185,32,
+7,247,223,29,33,247,197,29,254,66,114,29,252,119,247,44,10,74,248,17,29,232,
+28,4,205,22,235,7,53,246,29,248,188,247,25,10,247,87,247,234,247,23,251,234,
+247,185,32,7,247,223,29,33,247,197,29,254,66,114,29,252,119,247,44,10,74,
+248,17,29,201,28,4,164,248,80,21,247,236,251,56,247,103,251,171,64,251,7,
+101,91,43,30,247,71,247,234,247,23,251,234,247,185,32,7,247,223,29,33,247,
+197,29,254,66,247,44,10,55,133,5,43,248,156,235,7,68,246,29,249,4,7,178,206,
+197,170,198,27,246,247,55,55,251,208,252,29,251,100,251,193,251,169,113,31,
+42,7,248,5,248,27,247,124,248,221,31,14,232,28,4,205,22,235,7,53,246,29,248,
+188,248,201,10,252,119,247,44,10,74,248,17,29,251,247,249,179,249,164,247,
+227,10,251,48,33,251,19,63,139,30,215,7,247,45,221,205,213,159,170,129,139,
+30,192,251,7,5,139,160,125,161,178,172,184,180,214,251,25,193,251,9,251,111,
+55,251,46,251,33,30,252,161,7,123,124,127,123,248,64,29,127,248,138,29,211,
+247,184,29,192,248,95,28,5,236,21,32,6,247,223,29,28,251,101,114,29,253,1,
+7,251,140,78,251,8,65,30,251,111,247,119,5,73,104,88,90,43,26,251,7,247,42,
+86,247,68,247,213,238,247,162,247,197,30,248,236,247,25,10,14,192,250,222,
+241,21,248,236,248,201,10,253,1,7,251,140,78,251,8,65,30,251,111,247,119,
+5,73,104,88,90,43,26,251,7,247,42,86,247,68,247,213,238,247,162,247,197,30,
+14,232,113,10,249,80,249,203,247,187,21,251,99,247,86,248,67,10,249,109,248,
+41,29,247,21,252,194,7,37,59,76,55,35,55,208,235,30,248,58,247,25,10,248,
+255,32,7,247,223,29,28,251,101,114,29,14,251,192,248,64,248,91,21,247,155,
+6,247,95,29,251,155,247,194,6,238,10,14,232,28,4,219,252,7,21,223,251,37,
+28,4,113,247,113,29,252,156,43,7,210,247,48,10,253,40,7,139,251,2,113,57,
+251,44,119,247,27,207,30,248,119,247,222,10,204,145,5,235,252,152,43,7,225,
+247,48,10,252,189,7,251,15,178,251,91,247,134,247,52,247,90,247,19,139,30,
+252,211,246,7,14,251,248,249,188,248,198,21,190,45,249,62,7,153,152,152,155,
+140,30,194,143,5,196,251,230,82,7,185,248,77,10,252,32,7,139,67,123,86,40,
+126,220,180,30,247,182,7,153,152,152,156,140,30,181,143,5,196,251,228,82,
+7,195,135,5,156,138,152,126,125,26,251,224,7,65,164,251,11,247,49,243,247,
+21,215,139,30,251,237,208,7,14,247,147,28,5,127,252,7,21,223,251,39,28,4,
+113,140,10,252,211,246,7,14,247,147,28,6,166,251,214,21,209,110,227,251,11,
+30,251,64,251,95,5,80,129,76,244,247,29,26,250,109,140,10,251,23,7,251,189,
+247,85,251,39,248,164,10,232,44,10,14,49,250,58,249,76,21,247,195,254,13,
+121,10,247,251,7,141,159,162,141,158,93,29,112,110,137,137,115,31,247,153,
+247,183,7,167,146,130,109,143,31,169,251,38,5,14,232,113,10,247,10,28,4,239,
+22,235,7,44,247,173,10,249,80,7,247,82,29,252,180,157,10,7,14,247,188,28,
+4,252,247,244,29,253,121,43,6,160,10,248,177,235,7,44,247,173,10,249,80,7,
+150,144,150,146,148,30,14,247,10,28,4,236,251,211,21,248,51,118,10,247,68,
+248,161,10,247,10,28,4,236,22,235,118,10,248,7,247,239,29,248,116,28,6,70,
+247,193,21,247,91,251,48,247,17,251,189,116,103,137,137,112,30,247,121,247,
+222,10,233,145,5,235,252,176,43,7,223,247,22,29,251,152,251,228,247,152,233,
+29,247,225,247,228,251,225,247,217,10,248,96,7,248,19,236,243,247,89,31,251,
+177,22,39,112,42,251,47,30,124,94,141,127,27,248,42,7,159,199,141,151,27,
+247,9,184,51,251,17,31,14,247,10,28,4,239,248,139,10,252,180,189,29,252,13,
+7,251,168,48,247,126,29,247,133,247,53,248,0,26,249,108,247,174,29,14,247,
+10,28,4,239,22,235,7,44,247,173,10,249,80,247,174,29,234,145,5,248,189,29,
+253,142,7,251,168,51,247,67,29,247,235,248,25,251,207,247,217,10,7,14,249,
+47,28,6,135,248,56,21,248,191,29,252,177,189,29,251,87,7,248,31,10,14,248,
+213,28,4,216,22,235,7,44,247,173,10,247,250,7,142,162,177,143,166,93,29,101,
+96,135,136,114,31,247,123,7,247,82,29,252,167,43,7,213,247,22,29,251,173,
+252,5,247,173,247,215,10,252,169,121,10,247,207,248,5,251,207,248,40,29,65,
+248,17,29,203,28,4,184,22,235,7,142,10,7,14,203,28,4,184,235,21,142,10,247,
+57,7,248,35,29,6,14,248,153,28,4,144,22,235,7,45,247,173,10,247,249,7,142,
+160,185,144,171,93,29,95,88,134,136,117,31,247,124,247,174,29,233,145,5,235,
+254,247,247,10,10,248,149,235,7,85,246,29,249,64,7,163,151,162,172,30,247,
+100,248,19,10,85,248,17,29,203,28,4,184,22,235,141,29,247,224,7,247,31,180,
+71,251,143,31,247,31,6,247,143,182,207,247,30,30,14,203,28,4,184,251,207,
+21,248,47,141,29,249,169,7,247,62,218,73,251,141,31,14,249,1,91,10,249,1,
+28,6,229,251,211,21,248,51,97,10,28,5,76,7,247,62,208,69,251,141,31,14,247,
+64,28,5,26,233,21,247,179,10,28,251,29,247,11,29,248,177,233,7,47,147,5,120,
+141,121,152,157,26,249,87,248,130,10,247,246,6,157,137,155,129,118,26,253,
+87,7,248,94,10,7,14,248,22,45,29,14,251,58,106,29,251,58,106,29,224,28,4,
+195,22,235,7,44,147,5,123,141,131,148,149,26,249,129,7,150,147,147,155,141,
+30,234,147,5,235,252,128,43,7,233,131,5,156,137,147,131,128,26,251,184,252,
+54,247,184,7,238,10,247,232,248,54,251,232,7,129,131,130,122,137,30,45,131,
+5,43,7,14,248,22,45,29,247,109,28,5,248,48,29,248,22,45,29,247,109,28,7,87,
+49,10,248,22,45,29,247,118,28,6,203,37,10,248,22,45,29,148,28,6,201,42,10,
+248,22,45,29,247,82,251,17,58,10,248,22,45,29,148,70,29,248,22,45,29,251,
+196,89,10,248,22,247,43,29,249,197,247,43,247,13,251,43,247,8,247,9,10,251,
+8,252,199,247,8,247,130,29,251,8,251,44,251,13,247,44,253,197,247,2,29,248,
+131,248,199,227,10,7,252,48,249,166,21,247,83,248,199,251,83,7,14,251,57,
+248,10,29,248,126,237,212,41,208,247,146,29,70,252,2,208,247,145,10,70,41,
+66,237,252,126,247,22,10,251,160,248,108,21,247,6,248,2,251,6,7,14,248,22,
+249,39,248,58,29,252,148,6,251,107,251,11,74,251,44,251,1,202,91,211,189,
+194,163,180,182,248,64,10,146,146,138,136,144,31,152,132,148,127,141,123,
+8,135,7,254,178,7,136,139,136,138,137,30,138,139,137,138,138,30,138,133,137,
+134,135,135,135,134,24,131,131,127,135,127,138,32,128,24,35,248,234,243,7,
+251,0,150,5,137,6,135,6,135,140,135,140,135,141,133,142,24,137,140,137,140,
+137,141,137,141,136,141,137,142,8,140,138,140,138,140,30,136,144,136,146,
+147,26,143,7,248,131,248,199,252,131,7,135,7,136,138,137,138,136,30,138,139,
+138,138,138,30,138,135,138,137,137,136,8,138,138,138,138,138,30,135,134,135,
+136,135,136,135,137,25,138,138,138,138,27,137,136,136,138,135,27,138,137,
+136,139,137,27,33,128,5,35,248,231,243,7,33,150,5,137,6,134,135,140,141,135,
+31,138,138,139,140,138,31,133,142,137,140,137,140,137,141,25,138,139,140,
+140,138,31,137,140,138,141,137,141,8,140,138,140,138,140,30,138,140,138,141,
+140,26,137,144,5,140,139,140,138,140,30,140,138,141,140,26,147,7,250,178,
+7,143,7,143,7,140,140,140,140,26,140,141,139,141,140,140,143,147,24,147,148,
+143,142,143,142,144,141,25,144,141,144,141,144,140,8,141,6,245,149,5,243,
+252,231,35,7,245,129,148,137,147,136,142,138,142,137,142,137,25,143,137,142,
+136,141,136,142,135,24,142,134,5,140,137,140,136,136,26,140,137,140,136,137,
+26,135,7,252,64,252,199,248,64,7,143,7,143,7,140,145,141,144,142,144,142,
+143,24,143,144,145,143,144,142,8,140,140,140,140,27,148,142,148,141,247,0,
+149,5,14,248,22,28,5,233,248,106,10,174,29,253,168,247,73,10,28,5,10,247,
+174,10,14,248,22,98,10,250,88,28,7,196,250,148,21,35,6,251,191,37,5,55,247,
+21,252,194,7,37,59,76,55,35,55,208,235,30,250,58,80,29,251,252,7,251,99,247,
+104,248,67,10,14,251,19,248,142,249,20,21,247,226,6,247,108,29,251,226,248,
+79,6,231,29,14,247,155,248,151,250,166,21,169,141,155,159,163,30,225,102,
+170,95,247,31,127,179,136,247,28,247,43,210,236,79,168,24,123,122,118,121,
+100,27,251,103,205,5,83,126,252,35,251,186,43,26,76,247,166,251,228,155,117,
+30,153,120,117,117,131,131,8,124,39,232,141,251,3,31,121,121,136,131,125,
+31,251,47,251,173,202,112,5,156,153,152,147,157,27,176,159,136,71,247,42,
+31,248,53,248,94,36,247,31,247,10,207,247,74,115,221,251,23,138,251,58,25,
+38,112,251,8,82,57,30,84,251,72,175,251,8,27,251,78,251,157,209,114,5,160,
+156,150,147,165,27,247,203,109,5,247,90,247,70,247,162,247,169,247,107,26,
+247,65,76,247,126,251,232,30,97,113,251,34,44,251,23,64,8,14,248,22,247,43,
+29,250,178,247,174,10,245,149,5,248,189,10,254,250,247,52,10,248,169,248,
+199,227,10,7,14,247,127,110,10,247,87,28,5,51,22,243,7,117,29,7,14,247,9,
+247,105,247,52,21,112,119,123,114,137,30,251,7,128,5,35,248,239,243,7,34,
+247,105,29,248,217,7,211,29,248,3,211,10,137,159,122,112,26,14,247,87,28,
+5,51,243,21,117,29,247,7,248,33,29,249,8,247,43,29,250,215,247,99,248,20,
+10,253,246,35,6,190,29,227,10,7,14,248,22,98,10,248,22,247,43,29,250,178,
+80,29,227,10,248,51,248,127,29,249,163,28,7,106,248,54,21,247,172,251,92,
+247,60,251,251,109,98,135,137,106,30,247,246,247,113,10,252,229,35,7,245,
+129,5,162,136,159,123,112,26,252,66,7,252,70,141,5,247,42,10,161,136,162,
+123,112,26,254,178,247,2,29,248,131,7,248,70,137,5,252,129,247,216,10,248,
+152,7,248,103,247,16,247,31,247,171,31,251,209,22,251,97,88,43,251,128,30,
+119,116,141,123,27,249,2,7,143,164,182,144,159,27,247,60,229,248,165,10,248,
+22,248,190,29,161,136,162,123,112,26,254,178,247,2,29,248,131,248,199,252,
+203,247,52,10,250,216,247,174,10,14,250,115,28,7,190,249,6,21,200,10,250,
+58,80,29,251,252,7,247,248,10,14,250,37,28,5,183,22,243,7,33,247,70,29,248,
+218,7,143,170,197,229,10,110,77,136,137,104,31,247,245,247,9,10,252,64,252,
+149,248,64,7,231,29,248,131,248,149,227,10,7,14,248,12,28,5,221,22,243,7,
+142,29,7,14,248,12,28,5,221,243,21,142,29,242,248,33,29,249,233,28,4,218,
+249,121,21,211,29,247,246,247,60,29,28,250,208,205,29,248,218,243,7,45,247,
+105,29,250,170,7,166,159,157,164,30,247,245,248,18,10,44,128,5,35,248,218,
+247,61,29,14,248,12,28,5,221,22,243,140,29,248,60,7,247,62,180,251,5,251,
+199,31,247,62,6,247,199,180,247,5,247,60,30,14,248,12,28,5,221,248,0,10,140,
+29,250,73,247,205,29,249,253,28,7,209,22,243,97,29,7,14,249,253,28,7,209,
+248,0,10,97,29,28,5,166,7,247,64,247,60,251,7,251,197,31,14,247,229,148,10,
+252,143,54,10,14,252,143,54,10,14,253,126,247,221,247,247,21,192,92,181,82,
+82,93,97,86,86,185,96,196,196,186,182,192,30,215,253,195,21,197,7,75,248,
+78,10,248,160,71,7,251,86,78,5,89,224,252,49,248,40,10,78,248,106,29,253,
+123,247,222,28,6,63,218,10,252,128,28,7,182,218,10,252,143,56,29,249,53,250,
+252,46,10,252,143,56,29,248,235,250,252,62,10,252,143,56,29,248,235,28,5,
+182,58,10,252,143,56,29,249,6,28,5,199,49,10,252,143,56,29,249,18,28,5,172,
+38,10,252,143,56,29,248,162,28,4,176,21,247,57,252,132,251,57,7,14,252,143,
+56,29,249,15,28,5,59,37,10,252,143,56,29,249,15,28,5,59,56,10,248,39,248,
+92,33,10,252,143,56,29,248,80,28,5,131,43,29,252,143,54,10,249,24,74,29,252,
+143,54,10,248,60,70,29,252,143,54,10,248,145,251,254,67,29,252,143,250,183,
+87,10,252,189,28,6,150,69,10,14,252,143,248,142,28,5,78,247,226,10,247,15,
+254,38,21,247,23,251,44,248,85,248,41,29,247,23,251,155,251,42,251,23,247,
+42,251,186,7,247,255,10,248,193,248,126,10,247,186,7,14,253,125,247,222,28,
+6,63,247,226,29,217,252,184,21,216,42,247,163,70,7,251,87,77,5,88,225,251,
+50,43,62,235,251,69,248,141,10,247,255,197,7,75,248,137,29,247,69,7,14,252,
+143,247,104,251,251,21,51,211,69,227,227,209,209,227,227,69,211,51,51,67,
+67,51,30,251,59,28,5,78,21,43,7,238,133,5,163,137,162,118,114,26,253,254,
+243,7,247,191,241,5,223,251,23,249,68,7,164,160,160,163,141,30,233,145,5,
+235,7,14,253,126,247,30,248,206,21,86,186,97,196,196,184,181,192,191,94,183,
+82,82,92,95,87,30,251,1,249,194,21,82,7,204,135,5,154,138,154,126,124,26,
+252,160,207,7,247,86,200,5,190,54,248,48,7,154,153,152,154,140,30,200,143,
+5,196,7,14,247,49,54,10,250,238,60,10,247,67,54,10,250,246,67,10,14,249,237,
+248,142,28,5,78,248,203,29,249,32,54,10,28,6,221,219,10,14,248,247,54,10,
+28,6,180,22,235,73,10,7,14,252,45,249,160,247,150,21,248,49,10,249,130,36,
+7,251,197,37,5,53,247,25,252,220,248,1,10,14,253,62,248,143,250,64,21,42,
+6,91,114,102,139,129,27,130,108,139,196,31,248,86,72,7,251,90,78,5,88,226,
+251,243,7,251,23,226,104,217,208,245,183,247,18,186,30,14,252,45,249,6,248,
+91,21,247,13,251,59,248,84,36,7,251,197,37,5,53,247,25,251,152,251,25,251,
+13,247,25,251,95,248,1,10,248,49,10,247,73,7,14,248,38,28,5,248,248,130,21,
+247,160,251,11,247,154,251,242,251,232,251,5,251,134,251,127,125,30,251,25,
+247,195,6,163,159,160,164,141,30,213,145,5,235,252,148,247,153,29,248,148,
+235,7,65,246,29,247,184,247,23,7,251,131,153,247,9,251,120,247,228,27,247,
+236,247,19,247,136,247,167,31,251,171,22,251,134,80,251,60,251,25,251,17,
+73,247,60,247,134,247,131,197,247,77,247,27,247,17,204,251,77,251,131,30,
+14,252,90,37,29,14,252,90,37,29,14,252,143,248,113,28,5,40,21,141,166,156,
+158,165,141,240,145,24,235,252,202,43,7,242,133,165,137,160,120,137,112,25,
+28,251,110,203,10,14,252,90,37,29,14,253,92,248,82,248,84,10,56,146,5,125,
+140,123,149,155,26,249,12,7,156,155,148,153,141,30,222,145,5,201,252,51,77,
+7,221,247,12,29,57,132,5,77,7,14,252,180,248,234,22,247,157,29,252,187,247,
+11,29,7,14,253,166,248,7,249,164,21,184,7,71,146,5,127,127,147,149,31,248,
+95,7,151,151,145,151,141,30,207,143,5,186,251,228,92,7,204,135,5,152,137,
+151,133,127,26,252,95,7,129,127,131,126,30,74,132,5,94,7,14,252,90,37,29,
+249,94,28,5,248,46,10,252,90,37,29,249,20,28,5,248,62,10,252,90,37,29,249,
+20,28,7,70,58,10,252,90,37,29,249,47,28,7,87,49,10,252,90,37,29,249,59,28,
+7,60,38,10,252,90,37,29,248,203,28,6,64,21,247,57,252,132,251,57,7,14,252,
+90,37,29,249,56,28,6,203,37,10,252,90,37,29,249,56,28,6,203,56,10,248,39,
+248,92,33,10,252,90,37,29,248,95,28,6,201,42,10,252,90,37,29,248,121,28,7,
+19,43,29,252,90,37,29,249,59,74,29,252,90,37,29,248,95,70,29,252,90,37,29,
+248,191,251,254,67,29,252,90,249,95,249,33,21,247,25,251,95,248,64,240,10,
+252,64,251,91,251,25,247,91,252,129,248,88,29,249,19,247,194,10,248,129,7,
+14,252,180,249,3,248,87,21,247,21,251,56,247,174,247,146,10,251,174,251,58,
+251,21,247,58,251,208,247,149,29,247,208,7,14,253,187,248,8,250,193,21,197,
+33,247,78,7,151,152,146,151,140,30,205,143,5,185,251,225,93,7,205,135,5,152,
+138,150,132,127,26,251,78,35,81,243,251,106,7,127,128,132,126,138,30,73,134,
+5,94,247,225,184,7,73,144,5,127,140,126,146,151,26,247,106,7,14,252,90,249,
+66,22,247,194,10,28,5,74,240,10,28,250,182,247,171,10,14,248,231,37,29,28,
+6,156,193,29,247,173,249,66,22,248,202,29,250,140,37,29,28,5,94,22,248,202,
+29,250,116,37,29,28,8,65,210,10,14,250,44,37,29,28,7,250,119,10,14,251,166,
+250,39,247,197,21,251,47,6,251,0,94,79,118,121,27,63,137,98,174,202,26,250,
+226,252,97,35,7,247,15,129,5,162,136,161,123,112,26,254,33,7,251,127,247,
+1,36,247,82,247,19,247,77,209,247,160,216,30,14,250,12,28,7,211,249,66,21,
+248,21,251,93,247,228,252,90,252,69,251,86,251,181,251,238,114,30,251,82,
+248,78,6,247,159,10,252,228,186,10,248,99,247,80,7,251,245,158,247,88,251,
+195,248,75,27,248,90,247,93,247,228,248,19,31,251,214,22,251,234,49,251,142,
+251,135,251,136,47,247,142,247,234,247,236,231,247,140,247,136,247,135,229,
+251,140,251,236,30,14,247,171,28,5,141,250,131,21,35,6,128,251,19,5,117,137,
+123,114,112,27,254,178,6,112,123,164,161,136,31,129,247,19,5,35,253,19,243,
+6,149,247,19,5,164,142,155,159,166,27,250,178,6,166,155,119,114,141,31,150,
+251,19,5,243,6,14,252,161,248,134,60,10,253,127,247,216,247,246,190,10,253,
+127,247,216,28,6,63,190,10,252,161,213,10,250,156,48,29,252,161,213,10,28,
+5,103,49,10,252,161,248,134,28,5,78,247,227,29,247,31,254,38,185,10,252,127,
+249,19,252,54,21,248,115,10,233,235,26,250,46,34,7,251,205,37,5,55,247,37,
+254,19,247,185,10,247,8,248,101,29,8,106,28,7,62,21,227,69,209,51,51,68,69,
+51,51,210,67,227,227,209,211,227,30,251,193,28,250,8,247,170,10,253,116,248,
+51,248,170,21,105,173,100,216,89,176,8,158,189,149,196,196,26,248,189,71,
+7,251,96,78,5,89,234,252,173,7,142,120,119,141,119,27,38,35,94,46,82,207,
+79,215,247,0,214,186,205,186,31,185,98,170,73,164,119,8,117,250,237,21,192,
+94,181,81,82,93,97,86,86,185,96,196,197,184,182,192,30,251,88,254,41,21,92,
+132,116,79,76,27,99,106,165,162,182,196,165,195,158,157,132,135,155,31,14,
+252,161,218,29,14,252,161,249,17,248,80,185,10,253,138,248,50,250,175,21,
+217,35,247,162,71,7,251,96,78,5,89,234,251,51,251,7,61,247,7,251,164,7,139,
+143,251,53,98,76,30,251,22,247,14,5,93,135,99,105,95,26,78,201,106,210,242,
+212,178,200,187,30,189,204,162,226,229,26,247,100,7,14,252,96,250,3,28,5,
+80,21,247,9,251,7,178,57,251,177,251,78,251,151,251,156,30,252,31,251,97,
+251,21,247,99,252,171,7,251,78,112,80,98,77,30,251,94,247,83,5,73,118,78,
+88,76,26,251,9,247,6,100,221,247,150,247,103,247,99,247,92,30,248,171,247,
+97,247,21,251,95,248,146,7,247,78,162,199,182,200,30,247,95,251,82,5,204,
+161,201,188,203,26,14,251,78,248,39,250,123,248,110,29,144,157,155,142,155,
+27,242,190,251,1,33,34,83,35,251,3,31,252,9,254,210,21,251,134,76,97,247,
+133,29,250,15,204,7,247,88,247,163,205,247,172,247,105,251,54,228,251,61,
+251,177,251,78,251,115,251,186,31,251,97,251,23,247,99,6,14,247,14,28,4,240,
+22,235,7,44,247,173,10,249,80,7,247,82,29,254,107,81,29,247,148,253,111,6,
+247,255,10,7,14,247,14,250,248,249,230,248,167,29,254,107,81,29,247,148,253,
+111,6,247,255,10,247,77,7,248,35,29,248,51,6,45,247,173,10,14,247,14,28,4,
+240,22,235,7,44,247,173,10,249,80,7,247,82,29,254,107,81,29,247,148,253,111,
+6,247,255,10,248,17,247,239,29,248,135,28,6,86,248,97,29,120,247,81,29,254,
+78,81,29,247,117,253,111,6,247,159,29,248,89,7,248,19,243,243,247,89,31,251,
+177,22,39,125,42,251,70,30,124,115,141,129,27,248,42,7,159,176,141,153,27,
+247,28,173,51,251,17,31,14,247,14,250,248,249,230,248,167,29,254,107,81,29,
+247,148,253,173,6,251,168,48,247,67,29,14,249,51,249,232,247,162,21,235,29,
+76,189,247,2,30,248,226,7,247,82,29,254,107,81,29,247,148,6,14,248,213,28,
+4,210,22,235,7,44,247,173,10,247,249,7,142,162,180,144,169,93,29,98,92,134,
+136,115,31,247,124,7,247,82,29,254,77,81,29,247,118,253,111,6,247,255,10,
+7,14,199,28,4,170,251,211,21,247,221,7,59,147,5,110,141,129,148,167,26,249,
+173,247,59,10,254,78,247,24,29,248,88,248,59,29,252,64,248,1,29,247,146,6,
+14,250,213,28,5,58,247,42,21,114,118,118,115,137,30,75,133,5,43,248,136,247,
+96,10,247,248,235,178,29,252,136,43,7,203,247,22,29,251,203,251,175,247,203,
+247,59,10,254,58,247,24,29,248,68,6,246,247,25,41,251,113,31,247,17,247,221,
+6,59,147,5,110,141,129,148,167,26,248,14,247,175,7,252,191,251,208,21,252,
+44,248,1,29,247,126,6,14,248,215,28,6,214,22,235,236,10,254,21,81,29,247,
+84,6,247,190,252,50,247,27,10,7,14,251,32,186,29,252,144,249,33,248,139,29,
+252,48,77,7,222,133,5,153,137,154,130,122,26,252,63,7,251,77,86,77,40,111,
+132,160,139,30,109,247,56,5,35,251,116,6,125,180,223,118,212,27,247,110,233,
+247,20,247,82,31,248,66,7,156,152,148,155,141,30,14,251,227,249,183,248,139,
+10,252,150,43,7,247,0,131,5,156,137,147,131,128,26,252,141,7,251,111,77,75,
+33,114,133,153,141,30,98,247,95,5,251,33,251,177,6,121,194,242,112,229,27,
+247,158,247,7,247,50,247,124,31,248,145,7,150,149,147,153,141,30,14,251,32,
+192,10,247,80,247,160,48,29,251,32,250,173,249,33,21,247,25,251,107,248,64,
+7,247,137,10,252,64,251,179,251,25,247,179,251,43,247,45,29,247,49,7,14,251,
+121,249,125,28,4,190,21,247,137,10,253,211,247,185,10,247,26,248,101,29,231,
+217,24,248,115,10,234,235,26,251,191,251,165,247,170,10,251,99,247,120,84,
+21,34,135,251,43,84,98,30,251,93,247,105,5,63,114,86,90,47,26,251,25,247,
+17,104,247,9,247,105,247,117,247,95,247,178,30,249,125,204,7,247,88,247,163,
+173,247,192,247,105,251,54,238,251,61,251,177,251,101,251,131,251,156,31,
+125,251,97,251,21,247,99,7,247,185,247,21,248,110,29,146,160,158,143,156,
+27,235,187,39,36,251,2,85,251,6,251,2,31,14,247,227,28,5,180,248,179,10,254,
+254,80,10,247,214,254,215,6,247,158,10,7,14,247,30,248,52,249,230,21,251,
+33,128,252,10,82,251,16,30,131,121,118,106,119,133,251,52,247,7,24,80,65,
+54,76,59,231,73,233,246,247,5,248,71,29,247,158,253,126,6,248,94,10,247,157,
+29,254,125,43,7,239,247,22,29,14,247,227,250,142,247,52,21,112,118,123,115,
+137,30,34,128,5,35,242,248,182,29,159,155,164,248,104,10,254,254,80,10,247,
+214,6,14,247,227,28,5,180,243,21,35,247,70,29,250,178,247,113,10,254,254,
+80,10,247,214,254,215,6,247,158,10,248,50,7,251,93,251,232,5,247,72,6,247,
+93,247,232,5,14,249,200,28,7,141,248,54,21,247,154,251,82,247,78,251,249,
+107,98,135,137,106,30,247,246,248,39,10,244,149,5,243,254,224,80,10,247,183,
+254,215,6,112,119,123,114,137,30,35,128,5,35,248,150,7,248,103,247,6,247,
+76,247,126,31,251,207,22,251,97,251,3,43,251,58,248,145,29,166,180,144,159,
+27,247,5,247,29,248,165,10,247,227,28,5,31,28,4,190,21,248,166,10,248,104,
+10,254,254,80,10,247,214,28,251,117,6,247,55,10,14,250,64,250,142,247,187,
+21,247,248,10,247,223,7,248,188,29,159,155,164,248,104,10,254,254,80,10,247,
+214,6,14,249,253,28,5,140,22,243,7,35,247,70,29,248,218,7,143,169,199,229,
+10,109,77,135,137,104,31,247,246,247,113,10,254,214,80,10,247,174,254,215,
+6,247,158,10,7,14,250,89,28,8,86,22,243,230,29,254,221,80,10,247,154,6,248,
+17,247,5,10,7,14,247,219,28,5,172,247,95,10,254,228,247,19,29,248,193,248,
+43,10,252,220,247,240,10,247,214,6,14,28,6,49,28,6,106,247,52,21,247,46,10,
+248,52,243,7,181,10,226,10,252,123,251,251,248,123,247,113,10,254,208,247,
+19,29,248,173,6,245,247,79,251,3,251,195,31,247,41,248,56,6,37,153,5,102,
+145,129,164,172,26,248,154,247,251,7,253,32,252,113,21,252,200,247,240,10,
+247,194,6,14,252,42,249,150,248,85,29,60,145,251,96,247,210,247,34,247,42,
+227,149,5,196,251,169,82,7,190,134,152,138,143,127,131,131,25,251,70,251,
+89,5,109,248,227,71,6,251,95,77,5,88,232,253,87,7,124,126,126,122,138,30,
+83,136,5,81,247,239,197,7,86,142,5,121,140,127,152,154,26,247,80,202,7,247,
+38,251,120,5,89,7,14,252,37,249,154,249,164,21,197,7,63,145,251,98,247,209,
+247,35,247,44,227,147,5,196,251,169,82,7,189,135,153,137,143,129,131,130,
+25,251,70,251,88,5,110,248,226,71,6,251,96,77,5,88,233,253,87,7,123,124,127,
+123,30,84,135,5,81,247,238,197,7,86,248,136,10,247,81,200,7,247,40,251,121,
+5,89,7,14,162,57,10,247,59,28,7,43,33,10,162,57,10,247,77,28,7,127,49,10,
+162,57,10,247,77,251,232,74,10,162,57,10,116,70,29,162,57,10,134,251,191,
+58,29,162,28,4,170,251,111,21,247,207,81,10,247,177,251,115,7,51,96,120,57,
+30,251,87,247,139,29,162,249,122,250,216,21,247,23,251,175,247,185,248,36,
+10,33,247,197,29,254,66,166,29,247,117,252,15,5,55,248,50,235,7,251,13,149,
+251,207,248,167,248,184,29,6,14,162,250,187,248,206,21,64,216,251,43,251,
+35,60,247,25,248,184,29,247,175,247,23,251,175,247,185,247,196,29,33,247,
+197,29,254,66,166,29,225,251,37,251,20,251,13,212,63,247,2,243,223,251,33,
+5,55,248,50,235,7,251,13,149,251,72,247,196,5,14,162,250,187,248,206,21,64,
+216,251,43,251,35,60,247,25,248,198,10,225,251,37,251,20,251,13,212,63,247,
+2,243,223,251,33,5,55,248,50,235,7,251,13,149,251,72,247,196,5,14,170,28,
+4,178,249,71,21,252,56,58,123,166,247,180,29,251,140,251,189,68,126,5,250,
+90,248,36,10,253,212,7,251,99,99,161,251,9,247,77,174,5,251,117,247,148,10,
+247,169,7,244,159,247,108,251,255,5,55,248,50,235,7,251,13,149,251,126,248,
+30,248,14,211,5,14,162,28,4,170,22,235,7,251,13,149,251,207,248,167,166,10,
+248,206,6,247,78,165,232,10,247,9,251,7,178,57,251,174,251,85,251,159,251,
+156,30,253,215,166,29,247,117,252,15,5,55,7,14,162,28,4,170,251,211,21,248,
+51,81,10,170,7,247,119,170,251,5,251,98,31,14,162,28,4,150,252,7,21,223,251,
+38,28,4,113,247,174,29,225,145,5,235,252,166,43,7,221,247,22,29,251,205,42,
+7,251,119,248,14,5,223,252,48,43,7,247,11,129,247,210,252,167,251,111,251,
+141,251,30,122,5,43,248,62,235,7,64,147,116,141,133,158,151,153,25,247,169,
+247,220,5,184,254,64,241,6,14,158,95,29,158,95,29,158,95,10,247,31,28,5,115,
+33,10,158,28,4,168,251,211,21,248,51,99,10,247,119,170,251,5,251,98,31,14,
+247,81,249,138,250,123,21,253,113,247,111,29,247,37,253,111,6,181,29,248,
+19,248,199,29,14,158,248,95,250,216,21,247,234,247,23,251,234,247,185,32,
+6,247,223,29,33,247,197,29,254,66,7,181,29,248,19,235,105,29,14,207,28,4,
+217,22,235,7,251,17,147,251,146,247,230,113,176,98,160,92,153,25,186,178,
+159,190,164,176,180,203,143,202,174,202,247,76,37,24,217,203,157,186,186,
+26,206,55,209,251,0,61,47,96,76,98,30,87,57,137,61,72,38,133,133,133,131,
+130,133,8,247,68,251,6,251,132,7,104,127,108,129,123,135,248,170,29,235,252,
+179,121,10,247,170,7,153,137,174,137,172,133,8,251,160,247,6,247,78,7,247,
+95,251,156,5,67,7,14,117,249,51,248,131,21,193,170,178,217,248,193,10,235,
+252,179,121,10,247,170,7,248,0,251,93,217,251,83,251,26,26,251,2,80,34,251,
+13,93,98,142,143,96,30,144,118,146,98,145,116,8,133,181,218,128,201,27,247,
+124,247,9,247,57,247,68,247,47,48,247,70,252,15,247,121,31,14,158,250,91,
+248,152,21,197,235,251,93,244,153,177,149,177,161,177,25,247,75,37,5,247,
+251,10,110,96,126,97,123,94,251,13,203,24,78,43,247,27,68,121,111,100,84,
+57,96,94,127,25,247,195,247,8,10,253,80,248,194,10,176,170,159,178,157,172,
+8,14,248,55,52,10,14,248,55,52,10,57,28,5,92,83,10,248,55,52,10,61,28,5,59,
+37,10,248,55,28,6,57,251,211,21,248,51,71,29,247,78,184,69,251,141,31,14,
+251,173,250,32,248,84,10,44,147,251,171,248,48,247,139,247,164,5,182,143,
+190,143,139,26,201,251,197,77,7,214,133,5,149,140,129,134,136,31,251,179,
+251,214,5,102,247,201,6,248,155,10,252,26,77,7,210,247,12,29,68,132,5,77,
+248,26,201,7,69,248,79,10,247,156,212,7,247,109,251,206,5,93,7,14,97,250,
+250,22,235,7,251,12,147,251,220,248,114,247,181,247,205,5,190,143,206,143,
+139,26,235,252,25,43,7,240,131,251,232,252,13,5,110,247,248,6,150,149,147,
+154,141,30,235,147,5,235,252,130,43,7,236,131,5,153,247,234,29,248,130,235,
+7,43,147,5,122,141,131,148,149,26,247,193,211,7,247,148,252,1,5,78,7,14,247,
+100,51,10,245,28,7,3,33,10,247,100,51,10,247,16,28,7,87,49,10,247,100,51,
+10,247,16,251,232,74,10,247,100,51,10,55,70,29,247,100,51,10,73,251,191,58,
+29,247,100,249,39,250,101,21,247,13,251,45,247,8,7,247,2,10,251,8,251,46,
+251,13,247,46,253,197,248,187,29,248,81,243,7,251,38,152,252,66,249,66,139,
+10,247,171,6,14,247,100,28,4,170,249,21,21,64,216,251,46,251,38,251,36,247,
+123,139,10,247,171,247,45,247,13,251,45,247,8,6,247,2,10,251,8,251,46,251,
+13,247,46,253,197,147,29,247,34,251,115,251,51,251,42,212,63,247,36,247,27,
+247,26,251,102,5,63,248,81,243,7,251,38,152,251,120,247,255,5,14,247,100,
+28,4,170,249,21,21,64,216,251,46,251,38,251,36,247,123,139,10,248,152,6,247,
+2,10,254,178,147,29,247,34,251,115,251,51,251,42,212,63,247,36,247,27,247,
+26,251,102,5,63,248,81,243,7,251,38,152,251,120,247,255,5,14,247,100,28,5,
+94,249,248,21,252,166,36,116,177,247,123,10,252,65,252,158,70,126,5,248,150,
+7,247,2,10,252,207,7,251,134,93,160,251,11,247,113,181,5,251,252,247,122,
+29,248,53,7,247,5,161,247,225,252,159,5,63,248,81,243,7,251,38,152,251,230,
+248,174,248,121,233,5,14,247,100,28,5,238,28,4,203,21,247,0,32,193,251,5,
+251,39,251,17,251,17,73,86,30,252,46,252,136,5,82,248,152,6,166,161,155,162,
+247,189,10,254,178,248,187,29,248,79,243,7,251,36,152,252,66,249,66,247,199,
+248,4,5,160,162,200,192,139,26,247,81,251,58,5,170,156,227,167,240,26,14,
+247,100,28,4,227,247,9,21,127,10,160,7,247,87,192,251,17,251,187,166,31,247,
+41,248,160,6,14,247,100,198,248,58,29,35,7,247,38,126,248,66,253,66,252,17,
+252,90,5,73,132,61,133,139,26,35,248,105,243,7,251,8,149,5,124,137,156,147,
+145,31,248,77,248,173,5,196,252,152,6,112,119,123,114,136,30,251,0,129,5,
+35,248,236,243,7,251,1,149,5,114,142,119,247,117,29,159,155,164,141,30,247,
+1,150,5,243,252,236,248,91,29,252,76,251,4,7,251,226,248,160,5,215,7,14,152,
+250,250,248,236,21,247,22,252,43,7,100,212,247,216,248,90,5,195,146,205,145,
+139,26,243,252,35,35,7,238,129,5,152,140,122,131,134,31,251,244,252,141,5,
+68,248,120,6,166,156,155,160,142,30,231,149,5,243,252,146,35,7,232,129,5,
+160,136,156,123,112,26,252,120,251,23,251,22,247,23,252,76,7,112,122,123,
+118,137,30,46,128,5,35,248,146,243,7,47,150,5,118,141,122,155,166,26,248,
+76,234,7,247,176,252,160,5,63,248,14,243,7,251,16,152,251,149,248,119,5,14,
+247,100,91,29,14,247,100,91,29,236,28,7,3,33,10,247,100,28,5,96,248,0,10,
+93,10,247,87,192,251,17,251,187,166,31,14,248,64,28,6,60,22,243,162,10,253,
+222,252,11,247,39,7,248,0,29,247,77,254,215,6,247,46,29,7,14,247,100,249,
+55,250,101,21,247,13,251,61,247,8,248,173,10,247,90,10,251,8,251,44,251,13,
+247,44,253,197,175,29,248,60,243,196,10,247,142,7,14,247,169,28,5,166,22,
+243,7,251,46,150,251,223,248,101,110,182,77,165,64,152,25,202,173,205,211,
+248,157,10,247,119,251,17,24,215,203,170,159,234,26,204,63,219,251,29,251,
+1,66,110,92,89,30,251,33,251,33,164,251,50,46,251,45,133,126,129,127,129,
+129,8,247,219,251,42,252,51,7,102,124,103,129,106,135,8,248,123,133,29,248,
+72,7,161,135,184,133,178,128,8,252,25,247,42,247,142,7,247,152,251,254,5,
+65,7,14,247,94,249,115,249,52,21,202,173,195,201,239,29,248,123,133,29,248,
+52,7,247,208,251,77,247,117,251,78,251,143,26,251,29,53,36,251,43,104,80,
+143,142,97,30,144,116,147,70,144,118,8,133,174,240,128,198,27,247,171,247,
+47,247,64,247,129,247,155,251,171,247,119,251,199,247,74,31,14,247,100,28,
+4,111,249,163,21,196,246,251,135,247,21,159,206,162,206,185,194,25,247,120,
+251,17,5,247,250,10,63,65,111,60,115,59,251,29,213,24,82,32,247,51,54,127,
+105,125,105,119,106,25,248,175,10,252,228,35,7,244,228,10,254,178,248,197,
+29,146,155,146,156,145,157,8,14,249,165,51,29,14,249,165,51,29,253,0,248,
+132,83,29,249,165,51,29,252,252,248,95,37,10,249,165,76,10,7,247,109,186,
+251,7,251,197,31,247,44,248,160,6,181,10,14,252,143,62,29,14,253,110,248,
+43,252,96,21,197,247,66,29,7,14,253,127,248,42,249,164,21,197,7,73,143,5,
+121,126,151,155,31,249,200,72,7,251,95,77,5,88,231,253,87,7,123,129,127,120,
+30,76,248,166,29,252,143,62,29,248,249,28,7,83,33,10,252,143,62,29,249,11,
+252,140,48,29,252,143,62,29,248,187,251,232,248,16,10,252,143,62,29,248,59,
+70,29,252,143,62,29,248,59,248,177,29,28,7,212,74,10,252,143,62,29,248,77,
+251,191,58,29,251,116,62,29,250,10,247,37,29,251,134,62,29,249,203,28,5,109,
+79,10,252,143,249,5,251,111,21,247,207,247,52,29,248,73,251,115,248,60,10,
+87,248,116,10,247,75,211,247,74,30,14,253,126,248,42,249,34,21,247,81,247,
+66,29,247,176,251,26,248,61,29,105,113,74,26,80,239,113,204,223,247,11,182,
+247,2,30,14,252,143,249,62,249,33,21,247,21,251,97,249,114,247,12,10,252,
+183,251,97,251,21,247,97,252,139,203,10,248,139,7,14,252,143,249,11,250,216,
+21,247,23,251,46,247,185,247,12,10,33,251,49,251,23,247,49,254,66,203,10,
+250,66,7,14,252,143,249,62,248,162,21,247,21,251,97,247,38,247,97,247,23,
+251,97,248,220,247,12,10,252,33,251,97,251,23,247,97,251,38,251,97,251,21,
+247,97,252,12,203,10,248,12,7,14,251,184,250,21,250,44,21,251,27,6,83,131,
+90,96,83,27,117,118,141,143,119,31,249,69,34,7,247,223,29,252,45,7,109,145,
+251,64,141,71,251,11,96,251,35,25,247,29,6,194,147,187,182,194,27,161,162,
+137,135,159,31,252,244,7,112,121,120,112,137,30,37,133,5,43,248,203,248,126,
+29,248,150,7,167,134,5,247,64,207,247,11,247,34,182,31,14,252,143,249,246,
+251,185,21,247,249,10,28,5,222,247,12,10,28,251,72,248,46,10,30,14,253,126,
+248,199,248,245,21,182,101,178,92,30,251,22,251,13,5,98,200,142,247,54,139,
+26,250,26,248,134,29,234,253,104,7,251,66,224,251,60,247,104,211,200,172,
+199,30,14,251,209,249,252,247,140,21,247,21,68,198,251,36,74,79,121,120,84,
+30,250,241,247,12,10,254,250,7,63,49,51,251,38,98,251,9,229,60,24,174,214,
+217,247,50,190,213,8,65,209,247,23,110,237,27,247,21,247,82,236,247,68,31,
+251,23,129,21,91,78,47,59,53,114,238,223,131,30,159,186,191,160,196,27,207,
+175,116,78,31,14,252,37,249,168,249,66,21,117,233,86,107,55,65,34,110,25,
+247,64,10,252,14,247,114,29,248,204,235,7,34,248,79,29,248,23,7,229,163,247,
+7,225,198,178,8,252,172,88,247,192,29,252,37,248,160,248,173,21,229,163,247,
+7,225,198,178,117,233,24,86,107,55,65,34,110,8,247,64,10,252,43,248,46,10,
+247,249,10,251,164,249,1,247,192,29,251,57,250,91,22,247,221,10,249,160,7,
+251,234,251,17,5,249,91,247,12,10,253,117,7,247,234,247,20,5,252,206,247,
+114,29,7,14,252,143,198,250,123,21,43,7,242,133,5,165,137,158,120,112,26,
+28,250,214,243,7,247,206,242,5,223,251,38,28,4,111,7,166,158,158,165,141,
+30,240,145,5,235,7,14,251,16,198,22,248,83,144,10,115,6,113,120,160,166,31,
+28,5,67,247,12,10,28,251,101,248,140,29,14,247,49,62,29,250,245,60,10,247,
+67,28,5,27,22,247,221,10,250,66,247,77,247,23,251,77,247,185,247,12,10,33,
+252,46,247,185,247,12,10,33,251,77,251,23,247,77,254,66,203,10,250,66,248,
+46,254,66,247,114,29,7,14,247,114,28,5,35,249,66,21,247,175,7,229,29,251,
+135,6,95,142,247,65,10,248,212,7,123,204,241,130,247,20,27,248,25,29,31,247,
+188,29,14,152,248,153,22,249,248,247,12,247,196,10,233,247,6,167,160,188,
+30,247,6,7,136,116,113,137,113,27,251,1,80,186,247,23,31,248,193,247,136,
+247,23,251,136,248,44,7,251,154,44,5,251,205,251,12,248,44,7,251,155,44,5,
+251,205,251,84,251,23,247,84,253,248,7,14,152,250,3,249,247,21,247,11,7,251,
+210,251,23,5,213,7,247,210,247,23,5,247,11,7,251,210,251,23,5,247,62,7,141,
+163,158,154,163,142,247,7,149,24,243,252,233,35,7,247,5,228,10,251,173,248,
+107,29,5,65,248,107,29,140,253,1,5,247,224,6,248,41,247,38,247,212,247,192,
+31,251,149,6,251,118,86,251,161,251,121,30,73,248,247,6,14,247,29,28,4,236,
+22,247,236,248,7,29,248,172,249,144,5,247,6,253,134,248,153,247,165,29,7,
+248,89,249,220,21,157,143,153,164,160,27,247,251,6,252,69,253,0,5,248,55,
+7,14,247,28,28,4,238,188,21,247,68,251,71,248,112,10,253,127,248,153,34,7,
+251,203,36,5,55,247,35,28,251,101,7,112,121,120,112,137,30,41,133,5,43,248,
+199,235,7,39,145,5,112,141,119,158,166,26,248,252,248,94,7,251,203,252,54,
+194,86,5,139,148,155,210,247,50,203,251,0,251,48,251,52,36,251,98,251,45,
+83,51,151,151,96,30,72,247,121,5,150,116,248,69,29,251,19,247,158,247,207,
+247,153,247,128,247,154,31,14,252,12,248,0,248,36,21,136,195,135,205,217,
+26,248,59,221,247,150,220,188,163,100,251,115,251,110,39,251,118,251,21,251,
+67,30,247,188,68,21,251,91,65,75,106,95,27,102,101,180,247,17,116,31,247,
+79,247,114,247,42,247,212,247,199,26,247,154,75,170,251,0,251,16,251,103,
+251,183,253,79,75,143,78,150,89,30,80,83,79,95,82,110,189,50,24,190,166,192,
+176,189,185,8,251,0,182,209,84,233,27,222,208,170,247,176,247,15,31,14,251,
+171,247,76,247,248,21,239,247,89,216,251,89,171,247,13,181,247,13,178,247,
+12,25,213,251,17,205,251,29,251,64,26,38,95,59,45,105,30,149,103,5,247,55,
+163,237,209,247,36,26,247,111,251,26,247,66,42,247,80,30,179,247,28,169,247,
+26,247,21,26,244,91,175,67,251,25,85,251,9,46,251,37,217,251,16,220,251,25,
+30,118,68,116,68,117,72,66,247,76,24,251,99,252,35,5,248,70,250,15,21,140,
+46,120,251,3,110,251,7,8,101,225,113,230,239,26,208,152,188,182,174,158,127,
+75,140,30,14,152,250,36,248,161,21,247,17,251,239,7,138,174,137,176,137,182,
+8,247,244,247,17,251,245,6,247,38,154,247,149,247,117,186,153,131,139,30,
+251,142,7,139,193,120,173,223,221,191,231,247,68,251,99,210,251,37,251,209,
+251,34,251,112,251,189,125,30,251,95,251,17,247,95,6,145,251,7,5,251,101,
+251,17,247,104,132,6,251,249,251,66,152,101,121,30,251,48,250,152,248,114,
+10,247,47,243,188,241,151,247,10,8,14,85,47,29,14,252,88,249,96,249,165,21,
+247,137,33,7,121,251,34,5,130,138,127,120,120,27,251,123,249,33,6,156,152,
+148,155,141,30,214,145,5,201,252,33,77,7,212,247,12,29,66,132,5,77,7,14,251,
+149,250,23,22,248,53,29,249,143,6,247,154,10,253,119,248,89,29,7,14,252,220,
+248,220,249,165,21,247,80,42,7,118,136,145,39,105,27,251,65,248,93,6,146,
+145,144,150,140,30,202,144,5,196,251,222,82,7,210,134,5,149,138,145,134,132,
+26,252,79,7,128,133,133,129,137,30,68,248,166,29,85,47,29,249,233,28,7,3,
+33,10,85,47,29,249,251,252,140,48,29,85,47,29,249,251,251,232,74,10,85,47,
+29,249,43,70,29,85,47,29,249,43,248,177,29,28,7,132,74,10,85,47,29,249,61,
+251,191,58,29,247,121,47,29,28,5,63,247,37,29,85,47,29,250,129,28,5,19,79,
+10,85,225,29,248,164,247,211,247,25,251,211,248,64,240,29,252,64,251,105,
+251,25,247,105,252,129,247,51,10,85,170,250,93,21,247,74,253,189,6,112,119,
+123,114,137,30,251,5,128,5,35,250,171,247,243,29,249,224,247,162,247,21,251,
+162,247,8,240,29,251,8,251,74,7,14,85,225,29,247,240,247,142,247,19,251,142,
+247,46,247,142,247,17,251,142,247,227,6,248,105,29,247,7,149,5,243,252,247,
+35,7,247,5,228,10,251,227,251,105,251,17,247,105,251,46,251,105,251,19,247,
+105,251,205,247,51,10,191,28,4,186,22,247,242,10,248,156,164,6,247,58,229,
+246,247,29,180,31,251,25,6,86,131,92,100,85,27,113,112,143,143,112,31,248,
+45,247,119,29,251,217,114,7,251,58,49,32,251,29,98,31,247,25,6,192,147,186,
+180,193,27,165,166,135,135,166,31,252,207,248,87,10,7,14,251,149,249,37,249,
+104,21,80,235,251,54,251,6,5,247,60,7,247,154,10,251,238,7,251,76,251,21,
+196,41,247,19,228,5,251,147,248,89,29,249,228,248,53,29,248,93,6,14,193,247,
+214,250,26,21,247,201,29,251,204,248,87,10,250,170,247,242,10,247,248,6,229,
+164,247,6,224,198,178,117,233,24,86,107,55,65,35,110,8,249,5,247,119,29,253,
+15,4,247,204,10,247,201,28,5,185,247,68,29,249,145,6,251,255,251,27,5,248,
+95,247,118,10,253,58,7,247,255,247,25,5,252,145,247,51,10,85,194,248,58,29,
+252,44,247,56,7,166,247,128,5,155,141,157,170,168,27,247,248,254,213,6,112,
+119,123,114,136,30,251,7,129,5,35,248,247,243,7,251,5,149,5,114,142,119,247,
+117,29,159,155,164,141,30,247,5,150,5,243,7,14,248,246,47,29,28,6,42,60,10,
+250,119,47,29,28,8,36,193,29,248,82,28,6,66,247,68,29,250,213,6,248,166,10,
+142,30,247,7,149,5,243,254,243,35,7,247,19,247,11,10,251,19,128,5,35,7,249,
+1,28,4,236,21,248,29,10,87,134,82,144,5,117,141,114,247,117,29,164,155,161,
+142,30,196,143,5,14,249,46,63,10,14,167,28,4,141,248,85,29,91,142,5,123,140,
+125,152,154,26,247,229,7,196,117,247,22,251,53,35,251,25,56,139,30,166,115,
+103,195,38,27,35,251,6,64,139,31,214,72,7,251,88,77,5,89,224,252,48,248,40,
+10,90,136,5,81,247,219,197,7,98,142,5,123,140,125,152,154,26,248,28,7,139,
+173,159,212,222,171,83,79,30,251,188,7,124,125,126,123,138,30,98,136,5,81,
+247,212,197,7,97,142,5,123,140,126,152,154,26,248,28,7,139,189,159,196,227,
+167,83,79,30,251,188,7,124,124,126,123,138,30,97,248,106,29,148,28,4,145,
+249,164,96,29,111,28,4,135,96,29,249,46,63,10,94,28,5,115,33,10,249,46,63,
+10,251,127,28,5,57,42,10,249,46,63,10,251,127,70,29,249,46,28,7,6,251,107,
+21,247,139,251,21,251,143,154,29,247,107,4,88,29,249,46,28,7,75,248,243,21,
+251,7,6,85,123,251,69,75,251,3,251,207,251,205,247,10,251,173,27,251,248,
+47,251,7,251,35,48,31,247,9,6,195,153,247,65,203,247,8,247,206,247,207,251,
+12,247,166,27,247,253,231,247,7,247,35,230,31,70,252,243,21,88,29,152,28,
+4,183,28,4,149,21,251,9,6,251,14,251,63,5,152,119,115,148,111,27,43,251,25,
+251,31,139,31,184,117,106,233,45,27,44,33,251,17,139,31,247,17,78,7,251,83,
+35,5,55,218,253,66,7,114,127,118,124,137,30,93,133,5,43,247,77,7,33,251,41,
+5,247,7,6,247,150,247,254,5,76,7,114,126,118,124,137,30,121,133,5,43,247,
+147,235,7,121,145,5,124,141,127,160,164,26,247,185,7,247,90,247,170,5,144,
+115,141,112,112,26,252,129,7,114,125,118,125,137,30,121,133,5,43,247,183,
+235,7,94,145,5,125,141,126,160,164,26,248,197,7,191,132,229,109,208,30,253,
+91,253,152,21,249,33,7,139,171,172,206,216,169,46,39,30,251,160,7,251,82,
+251,159,5,129,148,133,154,157,26,248,6,249,33,21,139,185,172,191,160,157,
+132,128,153,30,251,43,251,104,5,14,250,202,28,7,186,249,201,21,251,122,253,
+80,5,115,6,115,118,162,164,31,248,178,98,29,248,48,247,34,29,249,22,28,6,
+143,116,21,249,114,247,83,10,247,15,36,7,251,193,37,158,10,253,107,7,251,
+132,78,92,93,30,251,105,247,97,5,60,89,57,74,34,247,21,84,232,247,215,247,
+68,247,93,247,141,31,14,140,250,216,249,150,21,248,76,122,29,252,72,7,251,
+35,100,110,111,30,251,31,247,15,5,87,107,90,100,75,223,107,198,247,103,247,
+7,247,13,247,41,31,14,249,46,28,7,18,219,21,223,251,23,249,66,94,29,251,15,
+241,7,14,150,28,4,145,249,211,21,191,55,248,45,7,156,154,151,153,141,30,188,
+141,5,196,251,219,82,7,180,137,5,155,137,153,127,122,26,252,27,7,139,106,
+121,66,55,108,194,198,30,247,187,7,156,151,151,156,141,30,182,141,5,196,251,
+214,82,7,180,137,5,156,137,153,127,122,26,252,27,7,139,90,121,81,51,113,194,
+198,30,247,187,7,156,153,151,153,141,30,180,141,5,196,251,217,82,7,188,137,
+5,153,137,154,127,122,26,251,228,7,82,161,251,21,247,54,241,247,25,223,139,
+30,112,164,174,82,241,27,244,247,4,215,139,31,63,207,7,14,249,46,28,7,18,
+252,7,21,223,251,23,28,4,113,94,29,252,209,241,7,14,155,28,4,152,248,198,
+21,190,54,249,62,7,153,153,152,155,140,30,187,248,136,29,181,248,95,29,104,
+119,66,55,108,195,199,30,247,188,7,153,152,152,155,140,30,181,143,5,196,251,
+212,82,7,179,248,95,29,90,119,82,49,113,195,199,30,247,188,7,153,153,152,
+155,140,30,180,248,136,29,188,248,77,10,251,229,7,82,162,251,22,247,53,241,
+247,27,222,139,30,113,163,175,82,240,27,243,247,7,213,139,31,251,236,205,
+7,14,204,247,7,251,140,21,235,6,145,213,5,163,141,160,160,164,27,248,197,
+6,235,247,109,173,247,140,247,52,251,31,247,97,139,31,184,176,233,194,247,
+48,26,247,51,251,17,247,68,139,30,247,17,242,6,35,247,193,5,55,251,23,253,
+66,6,114,118,159,164,137,31,133,215,5,43,252,140,235,6,145,202,5,164,141,
+160,161,164,27,249,33,6,139,172,86,251,4,26,251,19,46,89,39,30,252,129,6,
+114,118,160,164,137,31,133,202,5,43,252,128,235,6,145,203,5,164,141,160,159,
+164,27,249,33,6,139,172,63,51,26,251,27,46,96,39,30,252,129,6,114,118,162,
+163,137,31,133,203,5,43,6,14,247,249,118,29,7,14,247,249,118,29,247,232,247,
+239,29,249,40,68,10,249,40,68,10,151,28,4,143,248,84,10,63,248,80,29,249,
+12,7,156,153,148,154,141,30,215,145,5,201,252,14,105,7,251,78,252,162,251,
+80,248,162,5,173,252,18,77,7,214,247,80,10,64,132,5,77,247,200,201,7,67,248,
+80,29,249,20,7,247,154,253,116,5,241,6,247,160,249,121,5,253,25,7,123,124,
+129,124,138,30,74,132,5,77,7,14,247,182,28,5,158,22,235,7,34,147,5,125,141,
+129,146,155,26,249,125,7,150,149,147,153,141,30,244,147,5,235,252,118,88,
+7,251,107,252,228,251,107,248,228,5,190,252,121,43,7,239,131,5,156,137,149,
+125,128,26,253,123,7,129,131,130,124,137,30,139,68,133,106,137,30,43,248,
+31,235,7,43,147,5,123,141,128,148,149,26,249,74,7,247,191,253,199,5,247,32,
+6,247,197,249,205,5,253,76,7,123,129,132,122,137,30,51,131,5,43,7,14,249,
+40,69,29,196,28,7,3,33,10,249,40,69,29,251,25,28,6,201,42,10,249,40,69,29,
+251,25,70,29,249,40,28,6,98,28,4,190,21,155,10,28,251,41,7,251,124,251,5,
+251,0,64,106,120,159,156,121,30,69,247,64,5,139,88,155,94,72,46,82,71,251,
+39,247,30,57,247,160,247,252,247,3,247,254,246,30,14,249,1,91,10,250,180,
+248,128,28,4,190,21,247,109,29,251,160,247,93,251,66,247,174,247,54,247,5,
+205,214,247,2,30,59,207,243,78,247,50,27,247,70,180,186,239,247,15,31,251,
+6,248,89,243,7,83,143,60,145,139,26,120,142,133,145,159,26,250,195,7,248,
+166,10,141,30,246,150,5,243,252,234,248,91,29,254,47,7,77,59,63,65,33,27,
+251,19,51,246,247,80,31,249,144,7,247,109,29,78,147,82,154,89,30,103,69,53,
+89,65,27,251,21,251,33,247,1,247,78,31,14,249,40,28,4,172,248,58,29,35,7,
+239,128,5,162,137,161,123,112,26,254,199,7,252,47,28,4,211,5,251,50,6,252,
+39,28,251,53,5,250,191,7,166,161,155,162,141,30,247,2,150,5,243,252,109,35,
+7,247,7,128,5,163,137,248,81,29,116,123,115,136,30,251,7,129,5,35,248,224,
+196,7,247,181,250,1,247,178,254,1,5,82,248,218,243,7,251,9,149,5,115,142,
+118,247,117,29,160,155,163,141,30,247,9,150,5,243,7,14,28,5,185,28,6,108,
+28,5,127,21,251,86,6,251,217,254,51,251,223,250,51,5,251,86,6,252,87,28,250,
+250,251,21,122,5,35,248,94,243,7,251,2,154,108,143,137,161,143,156,25,247,
+185,249,253,247,196,253,251,145,122,137,115,115,135,25,251,7,124,5,35,248,
+220,243,7,251,24,158,99,247,3,247,161,249,181,248,14,254,192,5,247,86,6,248,
+87,28,5,6,247,59,29,251,185,253,253,5,14,249,40,107,10,248,56,248,127,29,
+112,250,212,247,95,21,247,24,92,202,33,245,30,251,131,247,134,247,34,247,
+70,5,55,236,116,94,182,27,177,214,184,247,34,211,121,217,34,215,31,67,192,
+108,168,178,162,149,131,151,26,151,140,145,120,106,251,18,57,251,33,79,146,
+91,242,61,30,251,28,251,63,251,177,247,176,5,251,31,247,32,119,163,189,162,
+164,161,148,26,154,141,152,119,106,251,4,43,251,30,251,24,181,76,246,32,30,
+186,92,5,251,30,251,44,96,34,47,251,10,247,5,251,8,63,26,87,74,115,79,132,
+30,129,90,5,247,146,6,236,219,206,230,31,247,58,251,126,247,7,247,57,26,173,
+145,176,186,208,30,248,113,252,113,5,247,35,251,34,156,113,92,115,114,119,
+127,26,128,137,123,158,172,247,8,235,247,30,30,14,251,233,249,159,248,85,
+29,98,248,78,10,247,203,7,246,111,245,251,45,251,6,251,11,64,139,30,214,70,
+7,251,93,77,5,89,231,252,48,7,124,126,126,122,138,30,92,136,5,81,247,218,
+197,7,99,248,78,10,248,31,7,139,194,156,212,219,168,78,77,30,251,181,248,
+40,10,89,248,106,29,252,14,249,164,249,164,21,197,7,98,143,5,123,125,151,
+155,31,247,204,216,29,251,181,7,123,126,127,123,30,90,248,166,29,230,41,10,
+247,144,28,5,115,33,10,230,41,10,247,15,250,252,52,29,230,41,10,247,162,28,
+5,199,49,10,230,41,10,201,28,5,57,42,10,230,41,10,247,162,252,140,48,29,230,
+41,10,247,162,251,232,74,10,230,41,10,201,70,29,230,41,10,219,251,191,58,
+29,230,28,4,182,251,21,21,247,117,7,76,145,5,114,141,117,160,164,26,248,154,
+75,29,252,117,247,44,10,63,133,5,43,248,11,251,25,7,251,44,96,94,248,147,
+29,248,116,10,247,74,219,247,156,30,14,230,28,4,182,22,235,7,76,145,5,114,
+141,117,160,164,26,247,154,7,228,183,197,208,175,221,8,251,19,6,133,112,118,
+109,110,116,8,247,33,7,247,70,96,247,164,10,251,183,7,49,94,80,70,104,57,
+8,247,20,6,144,168,160,170,169,162,8,251,174,247,10,29,247,189,7,247,19,108,
+247,1,86,247,20,135,8,251,101,247,44,10,63,133,5,43,7,251,135,248,232,21,
+247,105,248,87,29,251,13,7,251,19,169,251,1,190,251,20,144,8,14,230,28,4,
+232,249,98,21,251,52,108,5,247,64,136,90,247,57,251,119,247,198,10,251,216,
+7,251,81,103,161,251,9,247,59,171,5,251,133,247,10,29,247,185,7,248,0,208,
+5,251,254,247,148,29,248,50,7,247,75,174,5,253,200,247,102,21,139,223,166,
+247,4,247,13,185,40,37,140,30,252,0,69,5,14,248,133,28,5,117,249,201,21,251,
+122,253,80,5,111,6,116,141,119,161,163,26,248,135,75,29,252,117,247,44,10,
+63,133,5,43,248,61,247,34,29,247,14,28,4,213,22,235,7,76,145,5,114,141,116,
+160,164,26,248,154,7,247,70,94,247,70,251,125,251,68,251,77,251,17,139,30,
+247,17,35,7,251,201,35,5,55,247,33,254,46,7,251,134,80,96,247,133,29,249,
+212,7,139,223,166,247,5,247,17,184,38,35,30,252,117,247,44,10,63,248,17,29,
+251,250,249,183,249,164,21,197,7,98,143,5,122,125,151,155,31,247,204,7,245,
+110,246,251,43,251,7,251,11,63,139,30,215,72,7,251,95,75,5,90,231,252,191,
+7,251,35,100,112,111,30,251,32,247,15,5,88,106,90,100,75,225,107,199,247,
+103,247,4,247,13,247,41,31,248,136,7,139,193,155,212,219,170,80,75,30,251,
+181,7,123,125,127,122,30,90,248,166,29,230,250,240,247,154,29,251,201,35,
+5,55,247,33,253,66,185,29,251,250,249,105,249,150,21,248,52,7,245,98,232,
+29,182,80,75,30,252,68,7,251,35,100,112,108,30,251,29,247,15,5,88,106,90,
+100,75,223,107,198,247,103,247,5,247,13,247,41,31,14,230,28,6,2,251,214,21,
+209,110,227,251,10,30,251,64,251,95,5,79,129,76,244,247,29,26,249,183,75,
+29,252,247,7,251,188,247,83,251,89,248,164,10,251,247,250,123,248,228,21,
+180,121,192,61,30,251,2,251,15,5,100,133,98,203,220,26,248,120,216,29,252,
+2,7,251,71,247,16,251,10,247,91,199,220,167,203,30,14,247,120,28,5,158,247,
+117,21,236,53,214,40,82,88,131,125,90,30,247,185,75,29,252,83,7,251,15,251,
+31,72,251,66,104,59,247,15,96,24,168,201,200,247,12,221,247,3,8,94,194,221,
+118,227,27,247,50,247,54,232,247,49,31,251,9,115,21,73,78,90,73,63,121,209,
+221,135,30,165,182,186,154,188,27,184,180,106,94,31,14,230,249,221,22,248,
+35,29,248,51,6,76,145,5,114,141,117,160,164,26,248,154,75,29,252,117,247,
+44,10,63,248,17,29,230,28,4,182,252,85,21,236,7,76,145,5,114,141,117,159,
+164,26,250,91,75,29,254,54,7,114,119,119,114,137,30,63,133,5,42,7,14,249,
+135,41,10,250,200,60,10,247,26,50,10,14,247,26,50,10,247,8,250,252,52,29,
+247,26,50,10,247,160,28,5,92,83,10,247,26,250,220,235,21,43,7,251,73,251,
+202,5,139,247,62,138,140,26,140,247,73,247,201,139,30,235,7,43,4,108,29,247,
+162,28,5,92,83,10,247,26,50,10,247,155,28,4,176,74,10,247,26,50,10,247,164,
+28,5,59,37,10,251,91,250,76,248,139,29,251,201,77,7,215,133,5,154,137,154,
+130,122,26,252,127,7,252,19,248,190,5,172,251,221,77,7,211,247,12,29,66,132,
+5,77,247,199,201,7,65,248,80,29,248,190,7,248,84,253,30,5,247,55,249,108,
+6,156,153,148,154,141,30,14,169,28,4,147,248,139,10,252,31,43,7,242,131,5,
+155,137,147,131,128,26,252,182,7,252,74,249,4,5,186,252,56,43,7,237,131,5,
+154,137,149,248,7,10,248,29,235,7,41,147,5,123,141,130,148,149,26,249,0,7,
+248,159,253,125,5,247,105,249,254,6,150,149,147,153,141,30,14,252,32,249,
+142,28,5,45,21,196,251,150,82,7,206,135,5,150,145,133,133,31,251,220,7,251,
+179,248,11,5,165,251,162,82,7,200,135,5,149,146,133,133,31,252,87,7,133,132,
+135,129,30,76,133,5,81,247,148,197,7,73,145,5,129,133,143,145,31,248,9,7,
+247,232,252,83,5,247,31,248,161,6,145,145,145,149,30,14,247,227,39,10,251,
+157,248,171,33,10,247,227,39,10,252,30,247,160,52,29,247,227,39,10,251,139,
+248,255,49,10,247,227,39,10,252,91,248,113,42,10,247,227,39,10,251,139,28,
+249,28,48,29,247,227,39,10,251,139,28,249,192,74,10,247,227,39,10,252,91,
+28,249,208,73,29,247,227,39,10,252,73,28,249,233,58,29,152,28,4,140,248,186,
+21,247,17,251,16,247,7,247,16,247,17,251,16,247,191,7,166,157,155,157,142,
+30,227,149,5,243,252,16,35,7,233,129,5,158,136,157,123,112,26,251,191,251,
+158,7,251,98,248,40,5,194,252,40,35,7,227,129,5,159,136,155,123,112,26,251,
+191,251,16,251,17,247,16,251,7,251,16,251,17,247,16,252,26,7,112,123,123,
+119,137,30,49,128,5,35,248,14,243,7,48,150,5,121,141,121,155,166,26,248,26,
+247,163,7,247,173,252,186,5,247,92,248,186,6,253,132,247,132,21,247,41,6,
+197,251,7,5,251,99,6,248,61,247,7,21,247,94,251,7,251,35,6,252,120,248,44,
+21,224,251,60,5,54,6,248,184,252,1,21,218,251,47,6,14,247,233,28,5,226,250,
+78,21,251,83,102,5,247,189,248,86,29,252,111,247,193,10,251,220,7,251,172,
+85,251,202,248,123,5,194,252,142,35,7,247,3,228,10,252,145,248,108,10,252,
+58,247,122,10,248,88,7,247,159,190,248,59,253,43,5,247,142,249,173,6,247,
+107,181,5,252,217,251,4,21,247,102,179,5,252,4,7,253,164,249,68,21,247,89,
+251,202,251,89,101,5,14,248,28,28,5,86,22,28,4,190,247,174,10,247,2,149,5,
+247,47,10,28,250,230,7,251,132,69,129,94,30,251,92,247,76,5,61,88,57,74,32,
+247,19,78,229,247,178,242,247,52,247,133,31,133,28,4,131,249,70,254,207,5,
+14,248,11,28,5,224,248,0,10,251,87,250,234,247,174,10,247,2,149,5,180,10,
+247,20,118,247,60,45,251,197,26,14,169,247,38,250,19,21,153,137,149,131,128,
+26,253,254,247,105,7,248,159,249,125,5,253,0,7,129,130,130,123,137,30,41,
+131,5,43,248,29,235,7,41,147,5,122,141,129,148,149,26,249,129,7,150,149,147,
+154,141,30,237,147,5,235,252,56,92,7,252,74,253,4,5,248,182,7,150,147,147,
+155,141,30,242,147,5,235,252,31,43,7,14,251,102,247,9,28,5,252,21,150,138,
+147,132,130,26,253,110,247,62,7,248,55,249,2,5,252,154,7,131,132,132,126,
+137,30,60,132,5,59,247,207,219,7,60,146,5,126,141,131,146,147,26,249,6,7,
+148,147,146,151,140,30,217,146,5,219,251,228,100,7,251,242,252,157,5,248,
+92,7,148,145,146,152,140,30,221,146,5,219,251,208,59,7,14,247,255,28,5,88,
+63,21,250,156,7,171,29,254,203,247,73,10,14,248,40,28,5,88,250,80,21,171,
+29,28,251,45,247,121,29,14,250,123,39,10,249,48,237,168,10,28,5,104,39,10,
+28,4,150,149,205,10,14,250,165,28,5,238,28,5,12,21,217,48,176,55,251,199,
+121,251,185,251,132,30,251,242,7,252,48,249,171,5,198,252,70,247,218,10,254,
+14,7,251,17,120,92,113,116,30,251,44,247,13,5,55,94,96,86,69,26,61,227,102,
+225,247,199,158,247,185,247,132,30,248,97,7,248,133,254,85,5,247,89,250,175,
+6,247,17,155,186,166,161,30,247,44,251,13,5,225,182,182,195,208,26,249,27,
+253,54,21,247,108,251,23,247,90,251,185,251,187,251,21,251,90,251,108,251,
+111,247,25,251,86,247,183,247,176,247,32,247,86,247,111,30,251,140,22,251,
+68,102,251,31,251,31,251,27,98,247,31,247,68,247,69,173,247,31,247,34,247,
+27,180,251,31,251,69,30,247,66,252,254,21,247,7,253,76,251,7,7,14,247,239,
+57,29,14,247,239,57,29,228,28,5,248,52,29,247,239,28,5,195,22,77,10,247,239,
+28,5,15,243,21,35,7,251,93,251,232,5,139,247,72,138,140,26,140,247,93,247,
+231,139,30,243,7,35,4,77,10,247,239,57,29,247,137,28,6,203,37,10,247,239,
+57,29,247,128,28,6,64,74,10,146,40,10,14,252,46,249,116,251,56,21,247,79,
+251,14,247,23,251,112,251,98,251,37,251,7,251,93,251,87,248,101,10,247,75,
+30,251,90,141,21,251,2,112,251,26,251,13,251,16,115,247,35,244,245,166,247,
+28,247,12,247,14,166,251,34,35,30,14,252,47,249,115,250,203,202,10,251,144,
+28,5,174,202,10,146,40,10,247,235,250,23,63,29,146,40,10,247,59,249,12,46,
+10,146,40,10,247,12,249,12,64,29,146,40,10,247,12,249,12,65,10,146,40,10,
+247,12,249,12,68,29,247,74,249,104,38,10,146,40,10,247,12,249,12,68,29,127,
+249,63,43,29,146,40,10,51,253,200,90,29,247,100,28,5,172,48,29,146,40,10,
+232,249,12,62,10,146,40,10,232,250,90,58,10,146,40,10,247,12,250,107,49,10,
+146,40,10,247,24,250,80,60,29,109,247,235,33,10,146,40,10,247,24,250,80,248,
+195,29,146,40,10,247,24,250,80,248,200,10,146,28,4,109,248,130,168,29,14,
+146,28,4,109,248,130,168,29,249,58,248,201,33,10,146,28,4,109,248,130,168,
+29,248,185,247,190,52,29,146,40,10,247,21,249,223,37,10,146,40,10,247,21,
+249,223,56,10,248,57,247,153,74,10,146,40,10,51,249,221,42,10,146,40,10,51,
+249,221,245,10,247,100,247,155,74,10,146,40,10,77,250,39,43,29,146,40,10,
+51,253,200,73,29,146,247,86,29,168,167,141,142,166,30,79,91,63,56,36,248,
+63,10,248,66,10,214,200,231,241,207,31,247,61,223,234,247,58,247,102,26,251,
+198,141,248,183,10,146,250,86,247,245,10,213,239,247,7,209,31,251,81,92,247,
+197,10,247,63,249,236,168,29,14,174,205,248,175,21,252,112,249,114,251,32,
+251,75,26,46,58,93,57,86,94,158,181,79,30,91,247,54,5,151,120,80,143,120,
+27,47,83,73,83,39,247,27,251,27,247,201,247,118,247,68,245,247,80,247,20,
+251,69,236,251,62,247,12,31,247,127,212,247,133,247,21,247,148,26,247,234,
+251,179,241,251,161,251,137,251,186,251,36,251,233,30,247,199,153,21,247,
+107,225,247,33,247,54,247,45,220,251,19,251,92,251,77,251,27,251,24,251,24,
+68,30,251,11,235,43,247,4,247,43,26,14,146,149,29,146,149,29,252,47,247,47,
+29,251,90,188,21,251,185,6,236,145,174,243,243,27,244,173,35,42,148,31,62,
+4,36,134,107,251,2,251,1,27,251,2,106,247,6,238,135,31,14,146,152,29,248,
+219,250,19,37,10,181,28,4,141,249,56,21,247,228,251,58,248,31,252,21,252,
+21,251,55,252,31,251,228,251,226,247,55,252,11,248,21,248,21,247,58,248,11,
+247,226,30,251,199,229,21,252,123,6,247,82,161,139,247,206,247,113,27,247,
+116,139,251,206,251,82,159,31,251,25,4,251,91,135,123,251,222,251,116,27,
+251,113,123,247,222,247,91,133,31,14,203,28,4,219,248,206,21,47,6,247,162,
+110,251,76,247,76,251,202,27,251,185,251,105,251,57,251,181,108,31,48,251,
+18,229,6,251,185,161,247,100,251,68,247,186,27,247,213,247,89,247,82,247,
+171,160,31,229,6,252,22,22,251,62,133,80,251,76,251,62,27,251,62,80,247,83,
+247,55,131,31,248,106,247,18,21,252,104,6,247,52,149,202,247,69,247,52,27,
+247,54,200,251,69,251,52,151,31,14,252,25,249,142,28,4,167,21,247,93,251,
+0,247,129,251,142,251,142,33,251,129,251,93,251,93,245,251,117,247,142,247,
+142,247,0,247,117,247,93,30,251,91,193,21,251,209,6,247,6,153,139,247,80,
+247,36,27,247,38,139,251,80,251,6,152,31,59,4,251,12,136,129,251,90,251,38,
+27,251,36,129,247,90,247,12,135,31,14,146,175,10,251,202,239,21,98,117,122,
+82,68,47,134,247,4,251,4,27,63,112,119,108,111,31,247,60,145,188,247,74,247,
+62,27,247,50,192,251,49,251,48,153,31,141,251,42,21,251,64,133,92,251,74,
+251,64,27,251,56,88,247,60,247,52,129,31,170,153,164,182,202,247,7,137,251,
+15,247,9,27,198,178,184,169,159,31,14,146,100,10,241,250,23,33,10,249,239,
+28,7,20,249,136,21,247,115,47,247,91,251,39,247,35,30,247,27,247,54,57,204,
+251,25,251,51,5,237,251,23,251,54,196,251,68,27,252,72,251,244,251,244,252,
+72,251,120,235,251,96,247,43,251,36,31,251,60,251,95,223,78,247,56,247,91,
+5,47,247,23,247,50,83,247,64,27,248,72,247,244,247,244,248,73,31,41,137,21,
+252,15,251,201,251,201,252,15,251,39,251,30,186,219,251,4,30,250,2,250,174,
+5,247,21,251,17,217,251,66,251,82,26,251,179,248,193,21,254,2,254,177,5,251,
+21,247,17,57,247,68,247,87,26,248,15,247,201,247,201,248,15,247,44,247,29,
+90,57,247,4,30,14,247,189,248,242,250,148,21,247,98,10,247,207,247,88,247,
+76,247,163,166,31,247,86,149,247,18,244,247,84,26,247,35,50,247,36,251,125,
+49,61,105,97,85,30,188,59,38,166,251,11,27,247,113,252,164,154,10,247,63,
+248,13,21,161,168,176,156,182,27,225,208,76,251,12,251,8,77,77,70,124,31,
+131,247,28,94,247,8,59,224,8,14,153,210,248,125,21,248,2,10,248,129,252,200,
+247,152,252,145,228,30,140,251,37,247,103,88,247,59,68,247,17,51,25,251,199,
+136,251,68,251,151,251,165,26,249,141,174,247,176,10,151,151,137,136,151,
+30,241,251,3,189,251,23,251,39,26,14,247,85,47,10,14,247,85,47,10,235,250,
+23,33,10,247,85,47,10,106,249,12,52,29,247,85,47,10,247,18,250,80,38,10,247,
+85,47,10,71,250,39,43,29,247,85,47,10,45,253,200,73,29,177,28,5,8,250,191,
+21,61,6,80,133,70,118,251,11,251,77,53,176,251,31,27,247,98,10,247,232,247,
+93,247,107,247,196,247,21,106,247,2,79,227,31,137,150,188,137,149,27,247,
+54,149,247,89,192,145,31,252,97,252,207,21,251,73,98,251,117,251,78,251,82,
+102,247,132,247,66,247,110,10,14,247,66,249,47,229,21,251,83,251,8,247,64,
+247,131,247,130,224,247,79,247,94,146,31,122,230,5,252,4,251,88,251,123,251,
+184,251,192,247,158,251,118,247,231,215,230,151,159,202,31,118,194,215,128,
+191,27,241,219,170,212,198,31,102,214,5,88,90,70,126,84,27,128,129,140,140,
+129,31,247,17,236,210,247,38,247,57,26,247,201,251,82,247,31,251,79,251,71,
+251,91,251,39,251,215,251,55,224,251,24,247,5,51,30,136,121,120,137,120,27,
+247,212,248,44,21,251,11,97,41,96,68,30,92,216,93,242,241,26,247,147,188,
+247,2,184,185,177,251,1,251,142,30,14,131,250,239,248,131,21,247,203,251,
+80,247,110,251,236,251,208,251,93,251,94,251,213,251,224,247,100,251,86,247,
+206,247,197,247,114,247,66,247,238,30,252,149,251,116,21,251,93,251,112,186,
+247,75,247,79,247,116,176,247,65,247,88,247,116,92,251,73,251,77,251,116,
+98,251,64,31,14,226,28,5,26,247,77,21,251,74,244,5,161,197,152,204,225,26,
+247,203,251,80,247,106,251,238,251,84,251,37,75,251,23,51,30,251,63,239,81,
+50,247,72,35,5,114,74,123,67,59,26,251,238,247,100,251,90,247,205,247,91,
+247,53,212,247,39,230,30,247,62,40,5,251,155,247,165,21,252,212,247,230,5,
+156,204,214,144,208,27,247,88,247,116,92,251,77,84,119,98,106,107,31,36,80,
+21,113,62,49,125,60,27,251,87,251,112,191,247,75,206,168,184,181,173,31,14,
+103,250,234,249,226,21,236,7,139,55,75,251,17,251,42,83,247,10,238,30,248,
+51,166,6,247,41,62,247,21,251,73,251,69,83,251,5,139,139,70,247,5,251,70,
+251,109,251,4,251,35,251,66,251,56,245,251,35,247,102,247,99,182,247,3,145,
+141,30,133,141,184,251,3,247,89,27,247,54,232,208,139,31,252,231,247,118,
+21,43,115,251,24,251,5,251,13,117,247,26,247,12,227,159,247,39,247,17,242,
+171,251,15,251,30,30,248,43,232,21,251,113,6,205,167,241,227,220,163,68,65,
+30,14,248,221,205,250,23,21,251,54,7,139,247,21,247,0,247,85,247,123,225,
+251,90,251,56,30,253,19,94,6,251,140,247,11,251,107,247,170,247,158,227,247,
+70,148,144,30,130,144,247,0,251,70,247,158,27,247,227,247,64,247,130,247,
+182,247,165,251,55,247,131,251,216,251,218,78,251,88,139,139,75,247,88,251,
+203,251,142,251,35,251,8,139,31,250,39,252,13,21,247,52,176,247,113,247,66,
+247,79,172,251,116,251,92,251,38,108,251,137,251,83,251,51,89,247,96,247,
+122,30,253,6,251,46,21,247,232,6,251,2,96,251,62,251,27,251,17,102,247,10,
+247,15,30,14,248,205,248,9,248,140,21,247,115,201,247,72,247,55,226,160,116,
+95,223,30,252,200,7,251,2,43,63,45,251,61,81,247,84,247,114,30,250,34,253,
+180,21,114,121,117,114,138,30,36,133,5,43,248,202,235,7,34,145,5,115,140,
+120,161,164,26,28,5,40,34,7,99,51,59,104,251,15,251,16,251,99,214,251,114,
+27,251,226,251,98,251,96,251,220,251,203,247,96,251,98,247,214,247,125,247,
+116,247,14,247,54,31,248,163,7,193,129,247,19,140,192,149,8,14,249,67,28,
+7,21,248,118,29,251,42,251,17,96,58,50,30,217,55,251,11,185,251,45,27,251,
+209,251,95,251,85,251,227,251,216,247,87,251,89,247,203,247,48,247,15,184,
+218,226,31,59,226,247,12,95,247,39,247,18,29,254,51,252,42,21,248,54,29,247,
+90,149,251,173,251,22,251,46,129,251,144,251,88,31,14,99,248,211,114,21,247,
+183,247,112,247,83,247,124,247,91,251,49,247,41,251,95,182,31,247,43,166,
+247,57,247,16,247,84,26,247,106,251,102,247,62,251,149,251,143,251,107,251,
+44,251,124,251,93,247,57,251,13,247,40,118,30,251,94,102,251,46,251,46,251,
+92,26,251,125,247,91,251,82,247,202,30,247,57,28,4,137,21,251,43,102,251,
+22,251,21,251,18,101,247,19,247,46,247,30,165,247,31,247,31,247,10,186,251,
+9,251,52,30,251,57,254,176,21,251,63,108,247,54,247,61,247,70,195,247,21,
+247,37,247,39,197,251,17,251,74,251,55,97,251,60,251,54,31,14,146,249,207,
+248,136,21,251,79,98,251,115,251,78,251,81,102,247,126,247,68,138,30,251,
+199,6,251,220,247,107,251,89,247,203,247,232,247,93,247,105,247,204,30,14,
+252,48,248,174,250,209,21,251,4,112,251,26,251,13,251,15,115,247,32,245,138,
+30,251,91,6,251,89,248,101,10,247,79,30,14,146,28,4,109,248,136,21,247,198,
+251,84,247,110,251,227,251,208,251,116,251,83,251,225,30,247,199,6,247,72,
+180,247,119,247,76,247,79,180,251,125,251,66,140,30,14,252,48,249,116,250,
+209,21,247,76,251,16,247,22,251,110,251,98,251,37,251,6,251,92,30,247,91,
+6,247,0,166,247,28,247,12,247,13,166,251,32,35,140,30,14,247,251,35,10,14,
+251,75,250,83,28,4,169,21,247,130,251,75,247,90,251,169,251,175,251,59,251,
+76,251,134,251,171,247,88,251,51,247,158,247,160,247,72,247,85,247,127,30,
+251,107,134,21,251,50,71,251,79,251,70,251,56,67,247,73,247,67,247,57,203,
+247,75,247,77,247,47,217,251,58,251,85,30,14,199,28,4,160,248,130,21,247,
+180,251,118,247,134,251,229,251,243,251,96,251,115,251,187,251,230,247,133,
+251,85,247,220,247,220,247,113,247,126,247,177,30,251,193,134,21,251,80,79,
+251,103,251,99,251,78,74,247,97,247,99,247,86,196,247,99,247,105,247,66,213,
+251,78,251,120,30,14,247,251,35,10,247,93,250,247,63,29,247,251,35,10,164,
+249,236,46,10,247,251,35,10,117,249,236,64,29,247,251,35,10,117,249,236,65,
+10,247,251,35,10,117,249,236,68,29,247,74,249,104,38,10,247,251,35,10,117,
+249,236,68,29,127,249,63,43,29,247,251,35,10,251,122,254,120,90,29,247,100,
+28,7,60,48,29,247,251,35,10,90,249,236,62,10,247,251,35,10,90,28,4,166,58,
+10,247,251,35,10,117,28,4,183,49,10,247,251,35,10,129,28,4,156,60,29,109,
+247,235,33,10,247,251,35,10,129,28,4,156,248,195,29,247,251,35,10,129,28,
+4,156,248,200,10,247,251,35,10,117,250,52,74,10,247,251,35,10,117,250,52,
+228,29,249,58,248,201,33,10,247,251,35,10,117,250,52,228,29,248,185,247,190,
+52,29,247,251,35,10,126,250,191,37,10,247,251,35,10,126,250,191,56,10,248,
+57,247,153,74,10,247,251,35,10,251,122,250,189,42,10,247,251,35,10,251,122,
+250,189,245,10,247,100,247,155,74,10,247,251,35,10,251,96,28,4,115,43,29,
+247,251,35,10,251,122,254,120,73,29,247,251,35,10,88,254,158,67,29,247,251,
+35,10,117,250,52,228,29,249,47,28,248,86,67,29,247,251,144,29,247,251,144,
+29,247,251,148,29,249,109,250,210,37,10,247,183,250,151,248,176,21,247,172,
+79,7,99,119,119,99,30,251,232,6,99,119,159,179,31,79,251,172,199,6,179,159,
+159,179,30,247,232,6,179,159,119,99,31,248,68,247,38,21,248,41,251,185,247,
+189,251,247,252,22,251,186,251,192,252,42,252,63,247,186,251,179,248,4,248,
+15,247,179,247,200,248,46,30,251,118,113,21,252,63,136,251,71,251,86,251,
+152,27,251,172,142,251,42,247,154,248,20,26,248,25,247,48,247,132,247,164,
+30,247,192,136,247,39,251,132,136,252,50,8,14,248,26,28,6,43,249,161,21,42,
+6,247,242,96,251,160,247,168,252,25,27,252,41,251,142,251,157,251,253,106,
+31,45,251,20,230,6,252,74,157,247,187,251,140,248,32,27,248,38,247,166,247,
+199,248,15,151,31,230,6,252,56,22,247,213,10,249,116,247,20,21,253,111,6,
+247,138,159,246,247,135,248,68,29,14,247,251,176,29,251,232,247,52,21,67,
+104,75,61,76,75,251,49,247,46,251,50,27,63,82,106,94,81,31,247,209,162,247,
+29,247,79,247,117,27,247,71,247,17,251,50,251,164,182,31,145,251,114,21,251,
+176,251,52,251,132,251,95,251,95,251,18,247,74,247,167,102,30,200,157,221,
+201,217,231,247,9,251,46,247,58,27,210,195,180,196,188,31,14,247,251,100,
+29,62,248,151,33,10,249,113,249,148,28,5,127,21,248,10,10,247,250,247,148,
+247,135,247,212,200,31,247,142,145,247,134,247,46,247,187,26,247,101,251,
+23,247,105,251,234,251,28,33,86,74,68,30,213,251,2,251,27,183,251,46,27,248,
+13,253,115,103,29,247,222,147,21,247,85,72,247,69,251,9,247,23,30,185,176,
+196,182,218,27,247,18,226,47,251,97,251,79,69,35,251,24,129,31,14,248,42,
+245,249,32,21,252,61,247,183,251,152,248,45,248,48,247,169,247,201,248,27,
+248,93,251,243,247,142,251,248,30,252,202,6,123,122,161,247,200,10,154,163,
+157,27,247,127,138,5,251,101,251,21,251,34,251,105,251,141,26,249,80,248,
+227,21,247,97,247,46,251,195,251,173,251,156,44,251,191,251,166,251,144,251,
+13,247,222,247,123,247,92,197,247,131,247,93,247,39,31,14,248,140,44,29,14,
+248,140,44,29,87,250,247,33,10,248,140,44,29,251,73,249,236,52,29,248,140,
+44,29,117,28,4,156,38,10,248,140,44,29,251,108,28,4,115,43,29,248,140,44,
+29,251,134,254,120,73,29,248,126,249,195,234,21,251,182,251,22,247,157,247,
+220,247,218,243,247,181,247,195,150,31,116,232,5,252,44,251,188,251,212,252,
+35,252,48,247,235,251,201,248,38,226,242,155,166,216,31,111,207,231,124,209,
+27,247,31,241,181,240,220,31,89,214,5,69,71,52,119,64,27,112,115,143,146,
+115,31,247,68,247,23,247,4,247,103,247,130,26,248,59,251,93,247,83,251,148,
+251,138,251,106,251,93,252,79,251,133,246,251,83,247,39,251,11,30,132,110,
+108,136,105,27,248,73,248,225,21,251,86,86,251,56,57,34,30,57,247,7,79,247,
+67,247,56,26,247,241,203,247,43,215,207,208,251,41,251,234,30,14,248,147,
+28,6,98,22,247,181,251,29,7,115,251,48,5,123,136,129,131,123,27,251,199,247,
+242,247,41,6,158,147,129,120,141,31,139,151,49,141,133,30,247,11,248,0,251,
+11,6,137,129,127,51,139,26,119,137,129,132,122,27,251,41,247,210,247,158,
+248,20,29,253,72,80,6,192,53,55,170,251,13,27,251,240,251,78,251,115,251,
+187,251,230,247,113,251,85,247,219,247,7,219,168,188,221,31,86,7,92,248,125,
+21,251,80,98,251,103,251,97,251,78,92,247,97,247,99,247,86,175,247,99,247,
+105,247,66,195,251,78,251,120,30,14,250,112,28,8,64,251,232,21,251,50,146,
+5,112,141,120,159,162,26,28,6,159,251,46,7,82,251,8,64,121,32,251,96,37,214,
+252,11,27,252,90,251,139,251,197,252,50,252,31,247,135,251,218,248,103,247,
+154,247,178,247,43,247,113,31,249,181,7,206,127,247,41,134,206,153,8,28,250,
+111,7,113,117,122,116,137,30,251,66,132,5,33,249,96,7,254,197,249,210,21,
+251,113,251,58,72,251,1,251,116,251,31,247,137,247,241,247,198,247,10,247,
+166,247,157,247,11,169,128,89,245,30,14,28,5,71,28,9,160,249,60,21,248,33,
+251,153,247,222,252,62,251,122,251,66,54,251,32,251,5,30,247,30,251,11,251,
+67,226,251,110,27,252,72,251,128,251,199,252,40,252,101,247,173,251,156,248,
+45,247,105,247,63,225,247,29,247,8,31,251,37,247,14,247,77,61,247,114,27,
+248,48,247,149,247,214,248,27,31,28,250,177,131,21,251,156,54,251,204,251,
+166,251,144,48,247,195,247,183,247,167,218,247,197,247,176,247,130,240,251,
+169,251,213,30,250,153,22,251,156,54,251,204,251,166,251,147,54,247,200,247,
+168,247,137,193,247,237,247,198,247,130,240,251,169,251,213,30,14,201,28,
+4,154,248,5,21,247,97,251,64,247,21,251,92,168,30,247,41,164,247,59,221,247,
+104,26,247,127,251,133,247,13,251,146,251,139,251,139,251,13,251,127,251,
+104,247,59,52,247,38,119,30,251,90,115,251,64,251,25,251,98,26,251,128,247,
+138,251,58,247,197,247,179,247,156,247,59,247,127,30,251,231,249,56,21,251,
+6,55,251,29,251,21,251,24,54,247,29,247,6,247,30,224,247,12,247,25,247,10,
+233,251,12,251,30,30,177,253,40,21,251,30,39,251,51,251,42,251,61,53,247,
+43,247,38,247,26,247,7,247,43,247,31,247,24,247,11,251,21,251,48,30,14,252,
+12,249,146,250,130,21,247,15,251,4,217,251,22,156,30,236,154,247,0,188,247,
+20,26,247,33,251,48,211,251,57,251,53,251,53,67,251,33,251,20,247,1,87,234,
+127,30,251,21,125,251,4,59,251,16,26,251,33,247,52,39,247,91,247,78,247,64,
+239,247,33,30,251,113,248,42,21,71,85,56,55,53,84,222,207,222,194,211,226,
+215,200,67,56,30,164,252,32,21,56,74,44,42,251,2,83,229,227,219,214,230,229,
+225,216,62,45,30,14,251,111,250,29,247,160,21,247,47,251,17,230,251,38,157,
+30,247,0,147,247,24,217,247,39,26,247,56,251,76,234,251,87,251,82,251,90,
+56,251,68,251,45,247,14,64,245,134,30,251,36,124,251,17,45,251,47,26,251,
+70,247,79,251,7,247,124,247,111,247,93,247,8,247,69,30,252,56,247,201,21,
+32,109,246,222,240,192,212,233,219,192,66,38,56,98,32,37,31,49,4,241,198,
+35,35,39,91,251,8,251,5,251,22,106,247,2,245,237,196,247,2,245,31,14,248,
+12,109,10,122,248,222,250,14,21,247,20,235,251,27,251,51,251,64,72,56,251,
+3,91,31,251,185,248,90,247,150,49,7,251,5,78,119,104,30,251,27,203,6,247,
+106,189,247,19,247,58,247,85,26,247,112,251,59,247,86,251,245,251,245,251,
+59,251,86,251,112,251,85,247,19,251,58,247,106,89,30,75,251,27,7,104,78,159,
+247,5,31,49,251,150,248,90,247,185,6,251,3,187,72,222,247,64,26,247,51,235,
+247,27,247,20,30,14,248,36,28,5,229,249,68,21,248,23,251,203,247,224,252,
+37,252,34,251,211,251,218,252,31,252,31,247,211,251,216,248,32,248,33,247,
+209,247,216,248,33,30,251,107,137,21,251,170,251,115,251,118,251,168,251,
+167,251,117,247,118,247,170,247,171,247,115,247,119,247,171,247,166,247,115,
+251,119,251,171,30,251,215,147,21,242,145,51,210,45,27,42,62,64,40,43,212,
+53,240,237,223,221,239,133,31,14,187,72,29,14,252,16,249,138,251,35,21,247,
+38,53,247,43,251,55,32,32,62,139,30,216,70,7,251,89,77,5,89,227,253,61,7,
+122,126,127,122,30,81,136,5,81,248,2,197,7,69,142,5,121,127,151,156,31,247,
+69,7,139,190,126,192,247,111,247,32,247,25,247,91,30,251,89,121,21,251,30,
+74,251,1,251,20,111,94,154,139,30,248,53,7,139,191,158,185,247,8,191,43,251,
+0,30,14,252,20,249,142,250,226,21,247,37,53,247,44,251,56,33,32,61,139,30,
+217,69,7,251,88,75,5,90,227,253,62,7,125,124,127,123,136,30,82,135,5,82,248,
+0,196,7,70,143,5,122,142,127,151,153,26,247,70,7,139,188,127,192,247,112,
+247,33,247,23,247,93,30,251,89,120,21,251,29,74,251,2,251,19,110,94,155,139,
+30,248,52,7,139,190,157,186,247,7,192,43,32,30,14,187,72,29,211,250,21,33,
+10,187,72,29,251,10,249,219,42,10,187,28,4,113,251,107,21,249,97,251,21,253,
+101,247,84,29,173,249,123,128,10,187,28,4,213,248,80,21,247,23,32,7,247,120,
+129,43,247,113,251,128,27,248,137,10,31,247,60,10,251,153,251,58,251,23,247,
+58,253,123,245,29,114,119,159,166,31,247,187,7,139,217,118,220,247,200,247,
+66,247,77,247,176,167,30,251,195,247,23,21,252,2,247,124,6,139,219,170,210,
+247,44,192,251,9,251,38,149,30,141,251,23,21,251,94,131,72,251,48,251,73,
+27,96,70,164,139,31,247,225,7,14,191,247,32,10,247,60,10,254,77,251,80,251,
+23,247,80,88,155,29,190,7,248,45,249,126,158,29,187,28,4,147,248,164,248,
+196,10,170,169,141,143,169,30,247,10,251,64,230,210,51,247,20,5,247,105,213,
+247,20,247,83,247,147,26,251,195,109,21,251,44,95,251,23,52,67,30,50,247,
+23,48,68,214,251,3,5,135,120,118,137,118,27,96,70,164,139,31,248,27,10,14,
+187,249,58,59,21,251,3,6,86,133,98,116,96,251,13,96,215,251,0,27,251,29,65,
+66,248,151,29,162,184,247,13,182,61,245,27,247,31,213,212,247,33,174,31,248,
+129,248,244,128,10,187,28,4,147,248,164,248,174,29,102,10,28,250,213,245,
+29,114,119,234,10,14,187,249,133,250,220,21,247,21,251,186,247,183,248,36,
+29,35,251,76,251,21,247,76,28,250,141,155,29,247,187,7,248,95,10,188,29,247,
+93,7,248,45,252,234,158,29,191,247,32,10,249,1,248,36,29,28,250,90,251,80,
+251,23,247,80,88,155,29,190,7,248,45,249,126,158,29,248,133,247,215,248,159,
+21,248,103,248,93,174,247,244,26,247,58,247,166,29,84,95,251,134,252,232,
+251,16,252,95,26,251,227,247,188,251,46,247,210,105,30,251,176,155,29,247,
+171,7,247,223,171,247,243,247,54,248,50,26,247,136,36,247,84,251,142,248,
+137,10,30,247,21,32,7,251,162,46,5,44,241,253,110,7,251,93,183,251,27,247,
+33,247,124,26,248,247,247,176,21,139,219,170,210,247,33,226,39,251,72,251,
+208,251,68,251,8,251,95,108,30,14,247,74,247,111,247,95,21,251,116,140,251,
+47,251,35,251,86,26,46,180,251,9,247,21,247,5,174,247,4,172,151,30,251,46,
+247,16,5,193,155,247,0,247,66,141,30,178,171,130,126,171,31,252,3,155,29,
+247,185,7,128,177,183,131,196,27,247,250,247,107,247,114,247,223,248,27,29,
+31,247,60,10,253,23,7,145,111,109,143,107,27,248,1,248,240,21,248,119,29,
+251,122,39,251,67,251,89,138,30,98,138,102,148,105,152,8,14,248,115,249,168,
+250,148,21,248,137,10,31,153,10,247,137,247,72,247,8,247,83,220,30,241,251,
+35,247,220,29,248,156,235,7,251,1,156,251,207,248,76,247,164,247,228,247,
+235,10,251,48,251,83,5,247,83,98,251,18,247,56,251,93,27,219,252,162,158,
+29,174,248,249,251,244,21,32,145,5,111,121,159,166,31,247,23,7,247,240,247,
+73,247,242,247,166,248,9,26,247,84,56,247,64,251,158,251,71,251,62,251,61,
+139,30,247,61,32,7,251,196,35,5,55,247,28,28,251,145,7,115,123,117,110,138,
+30,48,133,5,42,248,200,7,251,45,28,4,131,21,171,167,233,239,247,7,27,247,
+3,189,70,251,61,251,80,48,251,130,251,199,251,85,31,14,251,132,248,129,250,
+69,21,251,158,251,49,251,39,251,167,127,31,139,161,253,155,74,251,90,30,247,
+63,6,182,247,15,133,247,254,139,26,106,176,247,18,96,232,27,247,125,247,69,
+247,36,248,38,247,176,251,66,247,48,251,114,31,87,39,21,247,50,247,22,251,
+53,251,180,251,180,251,27,69,40,251,78,55,247,46,247,144,247,135,189,247,
+50,247,58,31,14,252,209,247,212,246,21,251,64,36,51,251,57,132,31,139,153,
+252,101,97,251,11,30,247,3,6,167,213,135,247,109,139,26,119,163,221,113,199,
+27,247,44,247,7,226,247,133,247,62,251,5,233,251,37,31,106,79,21,241,224,
+42,251,64,251,65,51,97,75,251,13,84,231,247,43,247,38,172,234,247,0,31,14,
+181,28,4,152,248,142,21,247,179,251,69,247,66,251,139,186,30,247,103,7,165,
+159,158,166,141,30,239,145,5,235,252,203,43,7,239,133,5,166,137,159,120,113,
+26,251,103,7,251,140,92,251,68,251,66,251,179,26,251,167,247,73,251,74,247,
+135,88,30,251,189,7,112,119,123,112,137,30,39,133,5,40,248,203,238,7,39,145,
+5,112,141,119,155,166,26,247,189,7,247,135,190,247,73,247,74,247,167,26,251,
+163,22,251,17,88,251,52,37,61,30,249,103,7,239,61,192,251,47,251,19,26,252,
+62,251,255,21,37,217,88,247,52,247,17,26,247,19,194,247,47,237,217,30,14,
+252,25,249,144,250,213,21,247,64,251,7,243,251,52,167,30,247,19,7,155,152,
+150,156,140,30,204,143,5,196,252,4,82,7,204,135,5,156,138,152,128,123,26,
+251,19,7,251,53,111,251,6,35,251,64,26,251,57,247,9,251,2,247,50,109,30,251,
+70,7,122,126,130,122,138,30,74,135,5,80,248,4,198,7,74,143,5,122,140,126,
+148,156,26,247,70,7,247,50,169,247,9,247,2,247,57,26,251,68,22,64,106,43,
+73,92,30,248,70,7,204,92,173,46,63,26,251,169,251,110,21,73,186,106,235,214,
+26,215,175,232,202,186,30,14,248,6,28,5,213,248,130,21,247,180,251,52,247,
+126,251,205,102,102,135,133,108,30,248,146,251,35,7,251,177,55,5,57,247,48,
+251,236,7,145,108,102,143,103,27,251,206,251,51,251,126,251,180,251,181,247,
+51,251,126,247,206,175,176,143,146,170,31,251,173,7,247,210,29,118,159,164,
+26,247,173,7,132,170,176,135,178,27,247,203,247,52,247,126,247,181,31,251,
+181,22,251,114,251,9,251,78,60,92,104,162,145,128,30,249,137,7,146,148,176,
+159,184,27,220,247,9,251,76,251,113,31,252,197,252,15,21,133,131,102,116,
+94,27,59,251,11,247,78,247,114,247,113,247,11,247,76,219,186,174,119,132,
+147,31,14,248,110,248,8,248,141,21,247,71,186,247,68,247,81,212,30,128,230,
+5,251,245,101,251,70,251,113,251,152,26,251,160,247,44,251,113,248,100,104,
+30,252,73,247,165,248,72,7,248,92,174,247,81,247,113,247,161,26,247,180,251,
+3,247,123,252,18,251,190,251,19,251,62,251,213,30,252,69,7,251,148,183,85,
+247,62,247,83,26,248,219,198,21,247,68,147,247,69,247,45,247,27,182,251,114,
+251,82,251,86,58,251,61,251,150,97,30,14,251,244,249,176,251,44,104,29,251,
+244,249,176,250,217,104,29,238,249,22,114,21,248,3,137,247,108,247,173,247,
+152,26,247,160,79,247,134,251,156,251,160,251,15,251,222,251,154,30,251,181,
+7,37,197,67,247,80,247,17,26,227,129,247,142,247,12,193,194,98,139,155,141,
+247,89,251,50,251,141,55,251,115,251,179,251,164,247,119,251,157,247,241,
+137,30,247,202,248,175,21,251,21,68,251,76,40,81,30,247,181,7,247,72,168,
+247,132,198,209,151,251,148,57,30,14,203,72,10,14,252,11,249,146,28,5,80,
+21,247,108,251,75,172,251,71,30,252,9,77,6,216,247,80,10,65,132,5,77,248,
+44,201,7,55,248,79,10,247,101,7,135,175,165,140,165,27,247,62,247,71,202,
+247,102,31,251,91,133,21,251,32,59,89,251,14,137,30,127,135,139,141,119,31,
+248,6,214,7,237,204,73,251,6,31,14,251,80,135,29,251,80,135,29,203,72,10,
+209,249,227,33,10,203,72,10,251,12,249,169,42,10,203,28,4,154,250,82,21,248,
+82,10,247,140,29,251,96,251,58,251,13,247,58,253,109,182,29,247,240,248,131,
+29,247,154,247,167,243,247,242,31,252,90,70,21,247,13,251,110,247,131,247,
+7,7,248,129,10,251,125,251,14,55,251,81,137,31,121,133,139,141,108,31,247,
+150,7,14,203,168,247,156,21,247,76,35,6,247,135,10,243,247,160,247,21,251,
+160,247,7,248,131,29,247,154,247,167,243,247,242,247,253,251,173,194,251,
+168,31,247,140,29,253,201,251,76,7,249,223,248,191,247,79,29,203,249,230,
+247,241,21,230,210,61,247,5,5,247,67,190,247,32,247,17,247,141,26,214,29,
+172,172,140,143,172,31,247,24,248,75,21,251,26,99,55,69,90,30,48,247,25,48,
+68,211,33,5,134,111,108,136,107,27,247,210,10,14,247,116,28,5,59,250,82,21,
+247,253,251,172,194,251,169,30,252,172,6,251,54,251,19,251,29,251,29,251,
+36,223,101,198,240,169,235,139,31,251,29,247,88,5,176,158,212,147,209,27,
+227,6,160,149,129,121,31,254,191,7,112,114,123,117,137,30,251,7,128,5,35,
+249,9,243,7,251,21,247,70,29,247,240,7,133,192,180,141,180,27,247,154,247,
+166,243,247,242,31,251,197,129,21,251,125,251,17,55,251,78,137,30,121,132,
+139,141,109,31,248,254,247,6,7,247,42,241,251,2,251,83,31,14,248,158,247,
+229,250,157,21,248,11,248,40,150,247,206,26,247,38,247,166,29,104,95,251,
+130,252,163,114,252,64,26,251,222,247,204,251,18,247,176,109,30,251,244,182,
+29,247,236,7,247,165,143,248,35,184,248,41,26,248,82,10,252,148,251,0,6,196,
+133,5,163,136,162,123,112,26,252,206,7,251,85,182,251,33,247,25,247,105,26,
+249,7,247,108,21,247,7,6,248,129,10,251,161,251,69,96,251,81,132,31,14,248,
+14,248,49,249,56,21,251,116,251,47,247,167,10,155,247,0,247,66,141,30,184,
+179,131,127,181,31,252,19,182,29,247,242,7,135,179,183,137,190,27,247,155,
+247,166,243,247,242,247,253,251,173,194,251,168,31,247,140,29,252,185,7,146,
+105,101,143,97,27,248,43,248,209,21,247,7,6,248,129,10,251,125,251,14,53,
+251,81,119,121,140,140,122,31,14,248,161,180,29,251,190,247,140,21,247,13,
+10,247,161,7,134,165,173,139,156,27,247,104,247,54,224,247,113,31,251,97,
+92,21,251,15,85,80,32,109,107,138,145,116,248,57,10,248,181,249,1,248,58,
+29,247,140,29,254,178,182,29,247,240,248,131,29,247,8,247,12,159,193,235,
+31,247,153,252,52,247,194,29,248,251,243,7,251,21,156,252,42,249,13,248,19,
+248,133,247,141,29,152,112,116,120,31,251,60,251,108,5,247,219,119,251,162,
+190,251,158,27,247,143,252,62,247,79,29,152,198,248,142,21,247,46,251,7,251,
+46,251,7,247,46,251,11,6,119,123,116,110,137,30,40,131,5,35,248,251,243,7,
+251,57,147,5,110,141,125,162,159,26,247,11,248,27,247,7,252,27,247,7,178,
+7,247,226,247,185,247,39,247,200,247,195,251,132,247,2,252,23,31,252,92,36,
+6,247,1,131,5,168,137,155,116,119,26,252,231,251,46,7,248,53,249,4,21,139,
+129,141,177,247,153,241,47,251,91,251,129,251,25,41,251,111,30,100,6,14,152,
+28,4,178,250,119,21,247,17,251,46,7,247,108,73,251,100,177,251,97,248,47,
+10,45,251,42,251,17,247,42,251,7,251,42,251,17,247,42,252,231,247,62,10,247,
+74,247,81,201,247,81,215,31,247,60,247,17,251,29,6,142,163,141,165,167,151,
+138,152,151,26,251,166,92,21,114,138,117,136,118,30,251,218,247,7,247,220,
+6,140,124,140,123,123,26,251,222,247,193,21,243,6,226,208,93,56,177,31,251,
+190,6,189,252,127,21,123,133,139,141,111,31,247,16,247,183,7,93,50,54,103,
+251,2,138,8,14,250,250,28,8,220,247,211,247,53,29,251,11,194,251,66,247,6,
+10,251,100,6,138,129,129,139,129,27,41,86,186,247,23,31,248,193,247,88,247,
+23,251,88,247,155,251,20,7,40,251,110,42,75,5,247,233,129,251,139,192,251,
+135,248,47,10,254,178,247,62,10,247,106,247,116,225,247,170,178,31,221,253,
+21,6,251,64,198,59,247,56,229,227,165,159,196,30,123,191,247,6,109,247,24,
+27,247,75,247,85,225,247,150,31,28,250,53,249,9,21,251,125,251,2,55,251,62,
+137,30,123,133,139,141,111,31,248,254,243,7,247,28,229,251,2,251,83,31,14,
+207,168,250,174,21,247,76,254,18,247,118,29,206,247,120,29,229,247,150,247,
+13,251,150,187,247,9,29,91,251,76,7,249,228,252,209,247,73,29,207,168,247,
+82,21,247,76,105,247,118,29,173,247,150,247,13,251,150,221,247,120,29,228,
+247,9,29,254,32,251,76,7,249,228,248,93,247,73,29,238,248,24,29,247,218,7,
+247,219,247,120,248,60,247,248,248,61,26,247,73,251,16,247,79,251,133,251,
+60,251,3,72,38,32,30,247,27,247,152,10,248,54,28,5,227,21,210,214,241,200,
+244,27,241,189,251,2,251,15,251,70,251,47,251,246,251,171,251,99,31,14,203,
+214,250,82,21,251,242,247,167,35,247,154,178,180,137,145,194,30,251,240,247,
+116,10,251,21,128,5,35,249,7,243,7,251,5,150,5,115,141,116,247,117,29,162,
+155,163,142,30,247,11,149,5,243,252,210,7,251,168,251,173,84,251,253,31,247,
+198,129,21,247,83,239,247,2,247,43,30,247,7,252,254,6,137,108,133,139,121,
+27,251,81,141,251,14,223,247,125,26,14,248,200,28,6,141,249,66,21,247,205,
+251,131,247,81,251,163,78,92,129,128,104,30,186,7,166,159,155,162,142,30,
+246,149,5,243,252,230,35,7,243,228,10,92,7,150,104,92,149,78,27,251,163,251,
+131,251,81,251,205,251,181,247,131,251,103,247,163,200,186,152,149,174,31,
+90,247,216,10,248,230,243,7,32,150,5,116,141,119,155,166,26,188,7,129,174,
+186,126,200,27,247,163,247,131,247,103,247,181,31,251,207,22,251,152,32,251,
+27,251,0,73,125,155,168,96,30,249,82,7,168,182,153,155,205,27,247,52,194,
+251,111,251,70,31,253,13,251,242,21,110,96,123,123,75,27,251,0,32,247,27,
+247,152,247,70,194,247,111,247,52,203,155,123,110,182,31,14,185,138,29,185,
+28,4,211,251,140,21,247,23,251,76,250,240,219,29,251,89,251,186,251,23,247,
+186,88,247,162,10,190,7,251,167,248,46,135,10,247,219,248,9,29,247,195,7,
+247,213,247,141,247,6,247,18,247,24,247,101,29,81,251,9,251,4,251,42,251,
+15,30,249,230,219,29,37,7,252,7,251,170,5,251,32,7,248,7,247,168,5,251,27,
+247,217,29,7,247,50,248,247,135,10,185,28,5,168,28,5,86,21,247,9,251,7,178,
+57,251,121,251,97,251,75,251,129,102,30,127,57,5,141,112,139,141,125,27,247,
+181,10,31,252,15,247,162,10,28,5,121,7,198,159,247,79,184,212,30,247,97,251,
+82,5,204,159,201,191,202,26,253,52,28,251,76,135,10,210,28,5,190,251,214,
+21,209,109,229,251,11,30,251,52,251,97,74,127,95,247,74,138,247,35,25,138,
+137,138,216,141,250,102,8,247,94,10,251,21,7,251,218,247,99,41,247,162,229,
+247,19,184,245,30,253,74,248,120,135,10,72,28,5,72,251,214,21,209,110,227,
+251,13,30,251,64,251,95,5,104,53,247,38,247,66,31,250,197,7,247,121,251,70,
+247,44,251,136,251,137,251,68,251,44,251,121,251,119,247,70,251,46,247,137,
+193,186,143,152,186,30,253,89,7,251,169,247,117,251,41,247,167,229,247,17,
+186,243,30,253,95,28,5,68,21,251,21,137,251,68,251,38,251,39,135,247,68,247,
+21,247,21,143,247,66,247,37,247,40,141,251,66,251,21,30,14,249,20,249,156,
+247,54,247,150,29,247,167,254,23,21,248,95,10,188,29,243,219,29,252,15,247,
+162,10,248,45,249,177,158,29,247,251,109,29,247,241,28,6,217,251,171,21,225,
+55,213,47,149,30,251,52,251,125,5,61,164,125,247,12,247,23,26,28,5,95,7,196,
+251,0,251,26,180,251,146,27,252,180,251,101,252,13,251,234,252,103,247,158,
+251,146,248,121,221,207,154,167,194,31,63,7,251,131,247,25,251,60,247,154,
+247,114,243,247,11,214,30,253,101,248,93,21,88,80,84,98,57,27,251,116,251,
+103,247,64,248,62,248,68,247,122,247,62,247,135,228,171,108,103,176,31,14,
+247,251,248,241,252,80,21,247,98,247,2,5,111,199,216,124,235,247,208,10,78,
+81,153,165,91,31,247,104,247,5,78,247,6,251,137,251,22,126,166,133,170,140,
+174,25,193,10,140,49,160,62,184,80,251,48,55,24,248,237,250,126,103,29,14,
+249,35,247,229,251,205,21,251,22,7,248,67,247,25,5,96,204,229,115,247,13,
+247,208,10,86,88,150,158,96,31,249,48,247,107,245,231,247,95,247,101,29,64,
+45,58,252,254,251,85,30,121,170,130,175,140,180,8,193,10,66,153,74,168,86,
+30,248,105,250,7,103,29,14,252,250,248,198,85,21,247,78,7,151,123,101,149,
+109,27,78,53,48,100,106,31,247,22,70,7,251,98,77,5,89,236,252,50,7,125,126,
+126,122,138,30,81,135,5,82,248,17,196,7,54,143,5,121,127,153,153,31,247,237,
+7,139,175,161,190,191,162,105,124,150,30,14,252,0,251,220,21,247,63,7,149,
+123,101,149,109,27,78,54,56,103,105,31,247,11,70,7,251,98,82,5,93,236,252,
+15,7,126,126,127,122,138,30,81,136,5,86,248,17,192,7,54,142,5,121,127,152,
+152,31,247,208,7,139,175,159,190,191,162,108,125,150,30,14,252,250,248,197,
+28,4,166,202,29,251,221,28,6,29,202,29,251,196,42,29,224,249,99,33,10,251,
+196,42,29,247,42,248,88,46,10,251,196,42,29,215,248,88,62,10,251,196,42,29,
+242,249,183,49,10,251,196,42,29,34,249,41,42,10,251,196,42,29,251,40,254,
+140,248,16,10,251,196,42,29,251,168,254,124,73,29,251,196,42,29,251,168,254,
+124,90,29,248,15,28,5,244,74,10,251,196,42,29,251,150,254,99,58,29,251,196,
+249,15,251,107,21,247,139,251,21,251,143,154,29,247,121,250,15,197,10,14,
+251,196,210,29,251,153,251,51,251,23,247,51,251,189,204,29,247,189,247,51,
+247,23,251,51,247,38,247,184,10,251,196,42,29,93,70,38,10,251,183,250,9,248,
+215,21,252,62,56,5,247,119,247,26,10,252,31,7,251,95,100,161,251,9,247,73,
+173,5,251,64,204,29,247,117,7,248,85,225,5,14,251,196,210,29,253,99,7,251,
+236,247,91,251,138,247,168,247,252,29,98,201,113,204,247,79,26,249,160,247,
+184,10,251,196,210,29,28,251,145,7,114,119,117,114,30,49,133,5,42,248,222,
+236,7,251,23,145,5,112,121,161,164,31,250,144,247,184,10,251,196,249,249,
+243,21,251,81,119,136,199,98,235,109,208,73,197,66,159,8,247,82,180,247,20,
+242,247,69,26,247,81,251,56,247,7,251,120,251,73,32,94,65,34,30,251,39,7,
+187,202,240,212,247,20,27,247,6,215,62,38,251,42,251,21,73,251,28,31,107,
+95,141,133,27,34,140,7,247,29,94,186,91,191,251,9,8,41,183,203,44,247,75,
+27,195,230,167,144,198,31,14,215,194,22,249,31,144,10,252,75,6,248,34,247,
+198,219,247,12,247,63,26,247,35,251,5,247,43,251,201,251,61,251,24,60,100,
+77,30,251,50,7,207,207,247,7,198,244,27,247,22,203,59,45,251,64,110,90,252,
+34,251,219,31,14,247,38,248,95,251,118,21,250,159,248,87,29,140,251,29,119,
+251,15,37,26,251,73,204,251,5,248,5,247,252,29,114,174,132,193,205,26,247,
+14,165,247,54,136,247,46,30,247,70,138,97,247,70,251,128,247,198,10,28,250,
+227,223,7,14,251,196,248,92,29,250,71,247,15,29,251,196,248,92,29,248,53,
+247,159,7,139,140,247,23,137,30,251,158,137,5,248,37,247,15,29,251,196,248,
+130,29,249,66,217,29,251,110,245,7,14,252,250,248,188,249,213,21,189,42,248,
+48,225,10,251,23,208,7,14,251,196,250,226,251,209,21,202,77,190,74,160,30,
+251,97,251,83,5,98,201,110,204,247,79,26,250,33,217,29,65,7,251,236,247,87,
+251,140,247,176,221,247,7,178,247,9,30,14,252,67,249,96,248,231,21,177,99,
+169,97,152,30,251,26,251,7,5,113,176,120,178,247,5,26,248,181,225,10,94,7,
+251,98,247,19,251,41,247,76,193,213,163,209,30,14,251,196,248,130,29,28,5,
+72,35,7,248,133,29,254,174,247,54,29,251,196,248,130,29,249,144,7,247,236,
+251,90,247,136,251,169,57,251,6,100,251,9,75,200,90,205,117,30,247,94,247,
+82,5,180,78,166,73,251,78,26,253,203,247,54,29,251,198,201,10,14,251,198,
+201,10,251,50,251,174,38,10,251,22,249,180,28,4,240,21,74,251,137,40,114,
+41,43,60,50,25,248,115,29,253,69,204,29,248,210,7,139,213,186,228,155,155,
+137,137,154,30,251,29,252,159,5,247,22,6,247,17,248,112,163,123,156,124,146,
+129,25,247,31,247,203,6,105,154,108,150,96,145,203,247,135,24,14,251,198,
+250,91,251,209,21,212,77,203,70,30,251,93,251,95,5,75,243,146,247,161,139,
+26,248,99,247,74,29,252,99,7,251,181,247,23,251,172,247,218,247,2,234,194,
+240,30,14,252,61,249,87,248,158,10,161,164,31,249,132,247,74,29,253,238,7,
+114,117,119,114,137,30,74,133,5,42,7,14,251,144,250,61,248,84,10,251,185,
+108,247,77,247,214,251,183,192,8,211,148,247,52,179,247,57,26,247,67,251,
+84,168,40,30,252,78,77,6,210,247,80,10,68,132,5,77,248,31,201,7,65,248,79,
+10,247,157,166,7,247,152,251,46,252,17,247,235,27,172,180,153,145,197,31,
+252,3,248,233,21,251,32,251,6,116,55,133,125,140,140,116,30,247,207,7,162,
+140,158,138,139,26,247,21,209,88,36,31,14,103,28,4,129,22,237,7,251,72,119,
+110,219,106,235,247,134,29,252,181,247,125,29,248,136,247,183,29,251,7,184,
+198,251,11,247,107,27,192,203,160,143,192,31,252,101,249,99,21,251,48,251,
+17,248,28,29,215,85,251,4,26,14,247,145,38,29,237,249,180,33,10,247,145,38,
+29,247,55,248,169,46,10,247,145,38,29,228,248,169,62,10,247,145,38,29,247,
+8,250,8,49,10,247,145,38,29,47,249,122,42,10,247,145,38,29,247,8,28,250,201,
+74,10,247,145,38,29,47,28,250,217,73,29,247,145,38,29,47,28,250,217,90,29,
+247,100,28,7,132,74,10,247,145,38,29,65,28,250,242,58,29,247,145,137,29,252,
+123,251,95,251,17,247,95,252,78,167,10,14,247,151,28,5,143,28,4,185,21,251,
+148,89,5,247,73,68,251,118,173,251,19,27,253,60,35,6,247,1,247,239,10,251,
+131,248,108,10,253,72,247,5,29,247,195,29,8,247,3,155,247,138,205,247,168,
+26,145,7,247,149,189,5,253,248,252,3,21,129,117,141,141,104,31,247,74,7,248,
+6,210,5,251,112,132,251,62,102,251,18,27,72,248,164,21,174,141,169,137,139,
+26,247,44,238,89,39,176,31,251,245,70,5,14,247,145,137,29,28,251,17,7,251,
+199,247,68,251,9,247,46,247,107,247,29,172,247,45,248,32,10,249,140,247,248,
+29,252,201,250,119,248,34,10,117,141,141,104,247,80,29,14,74,247,16,248,147,
+21,247,196,145,158,251,38,197,251,30,8,251,26,196,182,251,24,247,193,27,190,
+211,162,149,229,31,243,7,251,135,110,102,241,85,247,29,97,243,90,221,62,185,
+8,247,159,211,247,42,247,54,247,103,26,247,118,251,63,248,4,10,213,247,17,
+247,13,177,247,58,27,247,88,247,1,251,21,251,45,251,109,251,103,251,4,251,
+162,31,94,80,137,131,27,14,247,138,223,22,249,172,144,10,252,192,6,248,157,
+248,91,247,35,247,84,247,115,26,247,118,251,53,248,4,10,210,247,17,247,3,
+180,247,48,27,247,95,231,251,10,251,66,251,69,57,251,48,252,157,252,113,31,
+14,248,91,250,158,248,39,21,251,87,192,251,133,248,36,247,23,225,190,213,
+208,73,203,43,174,30,251,72,251,15,5,111,199,130,225,234,247,95,182,247,138,
+247,21,26,247,77,29,28,250,24,247,121,10,28,5,107,248,2,29,251,89,98,251,
+95,251,35,26,14,251,24,159,29,14,251,24,159,29,249,10,247,208,7,139,140,247,
+23,137,30,251,207,137,5,14,247,32,248,210,250,159,21,247,47,247,7,112,251,
+36,251,5,33,68,251,6,85,106,141,141,114,31,247,243,7,247,66,254,55,21,251,
+19,150,5,109,142,122,158,159,26,248,37,155,7,247,15,206,251,49,251,60,218,
+31,251,82,228,244,251,94,247,110,27,210,197,150,155,184,31,247,2,7,134,119,
+105,139,124,27,251,23,89,247,83,247,62,54,31,87,242,74,234,36,178,8,247,87,
+175,247,14,232,247,70,26,247,118,251,111,193,251,211,30,44,195,6,248,30,10,
+247,12,130,5,169,137,161,127,101,26,254,173,7,111,119,124,114,137,30,251,
+19,128,5,35,249,19,7,14,250,56,28,5,14,22,243,7,252,42,86,247,148,248,173,
+252,40,227,8,239,155,247,114,205,247,168,26,247,183,251,158,188,251,29,30,
+252,248,35,6,237,129,5,161,136,160,123,112,26,254,178,7,112,118,123,117,137,
+30,41,128,5,35,248,183,243,7,37,150,5,116,141,121,155,166,26,248,78,176,7,
+247,253,251,105,253,15,248,111,27,185,195,162,149,220,31,252,145,250,119,
+21,251,125,251,49,100,251,8,130,119,141,141,107,30,248,160,7,171,141,166,
+137,139,26,247,71,235,55,251,64,31,28,4,250,253,56,247,53,29,251,2,194,251,
+75,247,6,10,251,203,6,139,247,39,83,247,73,247,75,247,85,225,247,150,30,14,
+152,250,231,250,133,21,247,17,251,214,7,126,185,115,177,110,170,8,248,24,
+247,17,254,109,251,17,247,6,6,247,0,130,214,101,179,71,8,251,229,251,17,248,
+6,125,6,251,125,251,67,100,251,21,129,117,141,141,104,30,251,17,247,248,29,
+247,195,29,246,154,247,126,202,154,247,147,8,14,247,176,28,5,193,248,106,
+10,241,110,248,72,29,251,52,96,43,82,251,32,30,251,21,251,213,100,247,5,76,
+245,251,71,174,25,247,77,10,254,178,247,84,10,247,195,77,252,7,251,64,247,
+73,31,251,89,252,117,5,247,19,6,247,60,248,54,5,120,186,194,129,209,27,190,
+201,164,149,229,31,241,7,251,70,119,75,209,100,237,247,87,248,123,24,194,
+247,32,201,247,78,247,97,26,252,232,251,167,248,34,10,82,143,139,247,80,29,
+14,103,250,123,4,41,7,247,72,159,168,59,172,43,176,251,5,171,57,247,19,99,
+8,43,116,251,31,78,251,64,26,251,112,247,135,105,247,9,30,248,181,235,6,43,
+147,5,122,141,129,143,158,26,249,123,7,151,147,152,158,30,139,206,143,168,
+141,30,235,252,136,43,7,240,133,5,157,145,126,127,31,251,193,88,7,251,15,
+112,245,247,5,96,31,247,7,94,80,247,11,251,107,27,86,75,118,135,86,31,248,
+101,253,99,21,247,48,247,17,165,239,30,147,154,137,159,27,251,242,98,7,251,
+43,143,63,193,247,4,26,14,103,28,4,129,250,25,21,235,7,146,86,75,159,86,27,
+251,107,80,251,11,251,6,94,31,251,5,96,112,32,251,15,27,88,247,193,6,152,
+145,149,157,141,30,240,145,5,235,252,136,43,7,168,137,206,135,139,26,158,
+137,147,129,126,26,253,123,7,121,129,132,122,30,43,131,5,43,248,181,7,247,
+9,247,135,172,247,113,247,62,251,31,202,43,162,31,247,19,180,171,221,176,
+247,4,172,236,168,217,247,72,120,8,252,101,253,0,21,251,5,63,86,251,43,135,
+30,139,120,137,117,141,30,247,242,7,159,154,141,147,27,239,247,17,112,251,
+47,31,14,252,76,249,129,28,5,46,21,196,7,143,105,97,151,105,27,251,32,101,
+68,71,110,31,71,111,121,75,59,27,106,247,72,6,147,143,145,151,140,30,204,
+143,5,196,251,217,82,7,158,138,183,136,139,26,151,138,144,133,131,26,252,
+82,7,129,133,134,128,30,76,135,5,81,247,246,7,216,247,49,159,247,24,241,49,
+177,77,153,31,221,164,160,188,163,206,161,197,157,186,247,9,128,8,251,194,
+252,8,21,71,90,107,41,137,30,139,126,137,125,141,30,247,102,7,152,149,140,
+144,27,204,220,123,46,31,14,103,250,231,249,201,21,251,83,252,218,137,144,
+137,144,138,144,25,247,134,29,252,201,247,125,29,248,156,247,183,29,171,55,
+179,54,240,99,251,23,252,37,24,247,26,6,247,15,248,12,5,159,6,192,203,160,
+143,192,31,237,7,73,131,93,145,106,155,247,125,249,89,24,252,209,37,21,251,
+48,34,248,28,29,195,85,251,4,26,14,247,145,28,5,104,22,243,7,251,0,150,5,
+114,141,117,247,117,29,163,155,162,142,30,247,0,149,5,243,253,59,7,251,44,
+251,187,90,251,183,251,168,247,138,73,247,2,123,31,251,187,81,162,251,143,
+247,76,29,247,238,247,189,27,180,252,78,6,112,118,123,115,137,30,251,5,128,
+5,35,7,247,50,249,107,21,137,104,117,137,128,27,251,21,251,66,178,247,125,
+247,64,246,223,247,90,31,139,170,141,174,137,30,14,108,99,29,108,99,29,248,
+127,28,6,81,235,21,247,56,7,139,251,22,251,7,251,98,251,93,48,247,19,247,
+103,30,249,8,188,6,247,142,42,247,134,251,213,57,68,113,111,78,30,183,252,
+63,7,251,9,251,135,89,251,76,251,51,247,31,85,235,116,31,90,128,107,105,110,
+111,63,66,136,251,69,87,72,8,90,101,83,132,36,27,41,7,247,233,10,247,6,231,
+27,190,6,251,214,151,247,23,251,78,247,226,27,247,152,247,44,247,13,139,31,
+251,165,248,138,21,251,246,6,247,42,174,247,47,247,43,247,13,186,251,1,251,
+43,30,254,8,247,3,21,224,215,204,247,43,30,180,251,198,96,6,39,251,17,162,
+247,25,31,14,249,139,28,7,94,22,248,17,10,252,55,6,124,133,159,156,31,248,
+97,247,129,7,247,108,10,251,129,248,100,6,159,151,160,156,30,247,238,248,
+18,29,254,240,6,251,44,251,187,100,251,183,251,168,247,138,86,247,2,123,31,
+251,187,81,162,251,166,247,76,29,248,1,247,189,27,180,252,97,6,111,114,124,
+117,137,30,251,3,128,5,137,35,6,247,52,249,130,21,137,104,117,141,128,27,
+251,21,251,66,161,247,125,247,64,246,213,247,90,31,139,158,140,163,154,147,
+118,122,30,14,251,170,249,195,250,93,164,29,196,40,191,248,11,29,247,19,6,
+14,252,213,248,169,247,13,21,139,59,172,251,24,251,48,251,3,67,251,6,58,204,
+97,213,105,30,228,98,241,112,72,26,111,115,89,48,97,61,166,146,135,30,139,
+128,219,135,172,30,55,251,78,6,139,245,105,247,22,247,24,247,32,191,247,46,
+222,40,183,50,180,30,69,172,75,171,188,26,182,176,164,202,187,177,127,120,
+157,30,153,41,5,222,6,14,252,231,248,166,28,5,86,21,139,60,172,251,26,251,
+47,251,3,65,251,5,57,203,99,214,104,30,228,98,241,112,74,26,110,114,88,49,
+96,61,165,148,137,30,139,127,218,135,172,30,55,251,78,6,139,243,106,247,24,
+247,25,247,31,190,247,46,221,41,184,51,180,30,67,172,75,171,188,26,182,176,
+164,201,188,178,127,120,155,30,153,41,5,223,6,14,251,170,39,29,134,249,89,
+33,10,251,170,39,29,134,249,89,112,29,251,82,247,234,42,10,251,170,39,29,
+152,248,78,48,29,251,170,39,29,152,249,173,204,10,158,248,245,42,10,251,170,
+39,29,251,87,249,31,42,10,251,170,39,29,251,107,254,134,73,29,251,170,39,
+29,251,107,254,134,90,29,159,28,6,125,42,10,251,170,39,29,251,89,254,109,
+58,29,251,170,39,29,38,254,78,59,10,251,170,249,228,247,211,21,247,140,252,
+132,174,247,81,26,208,197,180,235,208,205,115,108,166,30,159,251,52,5,247,
+21,247,177,6,139,251,17,192,251,95,251,131,251,64,251,9,251,84,30,251,193,
+248,144,155,248,158,29,152,186,71,30,115,247,78,5,251,21,252,197,6,248,121,
+29,237,247,1,88,182,71,176,30,251,87,251,79,5,60,96,158,227,31,247,125,7,
+119,216,217,124,219,27,248,133,10,31,14,252,233,248,187,250,100,21,247,41,
+251,214,160,247,6,26,180,176,164,202,184,182,124,121,156,30,152,43,5,223,
+247,63,6,139,58,170,251,24,251,48,251,3,69,251,7,30,251,73,247,222,149,251,
+14,26,111,115,89,48,93,106,146,168,94,30,124,247,3,5,55,251,228,6,251,0,247,
+10,94,223,204,239,165,198,204,106,165,95,161,30,251,19,251,4,5,88,111,150,
+192,31,247,32,7,127,189,189,130,191,27,247,24,247,32,191,247,46,31,14,251,
+170,249,228,251,111,21,248,174,7,247,140,252,134,182,247,77,26,210,199,174,
+235,208,205,119,108,166,30,157,251,50,5,247,21,247,175,6,139,251,15,188,251,
+95,251,131,247,182,29,152,186,69,30,117,247,78,5,251,21,251,201,6,139,247,
+53,81,247,93,243,246,152,194,219,30,251,158,7,51,96,120,59,30,251,89,247,
+139,29,251,170,249,189,249,17,21,251,3,6,86,133,58,96,96,251,13,176,235,251,
+0,27,251,29,251,6,248,116,29,218,182,184,247,13,102,41,245,27,247,31,247,
+6,247,5,247,33,174,31,145,247,224,129,10,14,251,153,250,39,249,44,21,251,
+244,71,5,137,138,140,140,138,31,247,188,29,247,19,247,175,6,133,153,251,29,
+200,251,95,27,251,131,251,64,251,13,251,82,53,179,80,198,92,31,251,74,104,
+161,251,9,247,211,200,5,247,17,81,247,17,93,40,247,178,29,251,203,6,139,247,
+55,83,247,93,248,133,10,219,88,197,70,187,30,247,102,179,5,14,251,170,249,
+228,247,211,21,247,30,251,44,212,251,29,208,30,251,0,193,247,199,29,247,175,
+6,221,29,247,52,247,149,252,140,247,146,247,229,10,106,251,61,247,140,190,
+55,31,132,165,146,139,158,27,247,92,247,110,225,247,150,31,14,251,144,249,
+99,247,234,21,133,84,115,251,25,139,26,126,133,251,13,94,73,27,251,24,101,
+206,203,247,5,247,52,164,247,31,225,31,247,53,239,223,199,247,36,26,247,64,
+251,59,236,251,126,251,75,36,101,122,97,30,129,251,175,5,247,19,6,167,247,
+56,5,170,168,198,159,213,27,233,195,80,69,64,251,12,94,251,5,85,31,251,81,
+48,251,4,45,251,39,26,251,120,247,101,76,247,91,247,73,247,17,172,162,199,
+30,149,247,203,5,14,252,22,249,193,28,5,63,152,10,253,48,248,164,28,6,55,
+21,181,73,201,57,251,66,37,251,0,251,34,158,30,238,253,87,157,251,7,121,116,
+109,125,25,251,8,247,5,5,139,57,113,72,26,97,205,76,221,247,65,242,247,0,
+247,34,119,30,139,38,249,74,142,151,30,122,247,8,156,162,170,152,247,7,251,
+4,24,139,221,166,206,26,14,252,22,249,193,28,5,63,247,27,29,251,191,248,85,
+10,237,248,12,29,247,43,7,125,170,171,131,176,27,248,38,29,31,247,88,10,141,
+28,4,147,247,23,10,251,250,28,5,159,152,10,252,22,249,193,28,5,63,21,209,
+37,242,251,19,251,159,251,47,251,71,251,129,167,30,247,38,28,251,117,5,143,
+110,100,151,107,27,251,1,251,31,47,251,7,251,80,247,39,108,247,21,247,19,
+237,194,223,197,31,172,100,167,96,164,96,247,4,168,24,107,209,96,225,69,210,
+149,184,141,188,133,189,251,37,28,4,155,24,114,247,85,164,178,188,161,247,
+68,251,80,24,139,247,19,184,247,4,26,252,103,28,250,11,21,251,15,143,111,
+79,67,27,251,3,137,217,166,198,203,172,176,173,182,133,131,170,31,14,251,
+95,248,153,28,5,236,21,251,95,251,67,38,251,125,251,68,247,27,251,29,247,
+24,251,19,31,116,106,116,106,117,106,251,13,251,72,251,12,251,73,61,251,53,
+8,251,111,251,13,247,60,6,115,71,124,76,82,26,251,56,224,59,247,34,247,6,
+236,222,233,164,132,165,124,164,30,251,71,95,5,105,155,107,175,175,26,179,
+147,184,156,189,30,248,26,6,247,126,247,84,247,47,247,148,247,60,251,42,247,
+35,251,32,247,31,31,233,247,31,208,247,20,247,12,26,247,80,251,63,219,251,
+18,30,247,29,28,251,146,21,251,38,66,251,7,251,77,30,251,113,6,197,247,13,
+233,247,42,247,26,247,88,180,199,24,224,52,206,53,46,26,251,128,249,221,21,
+247,0,187,208,210,182,211,97,251,12,55,98,46,81,41,30,62,224,81,224,229,26,
+14,48,40,29,14,251,172,249,226,247,189,21,247,62,251,54,204,251,23,197,30,
+251,9,192,43,184,233,26,215,221,182,247,0,203,166,119,139,30,200,104,106,
+98,158,39,8,247,39,247,148,6,143,133,251,35,198,251,64,27,251,105,251,85,
+251,1,251,90,251,79,247,80,76,247,30,71,31,212,105,234,89,47,26,53,36,100,
+43,78,73,164,139,30,135,135,145,145,137,31,108,247,79,5,251,41,251,177,6,
+139,247,49,77,247,66,247,124,247,109,244,247,109,30,14,48,40,29,251,5,28,
+5,114,33,10,48,40,29,251,5,28,5,114,112,29,251,82,247,234,42,10,48,40,29,
+44,250,251,48,29,48,40,29,44,28,5,198,204,10,158,248,245,42,10,48,40,29,251,
+195,28,5,56,42,10,48,40,29,251,216,253,105,73,29,48,40,29,251,216,253,105,
+90,29,160,28,8,13,42,10,48,40,29,251,198,253,80,58,29,48,40,29,251,102,253,
+49,59,10,48,250,198,249,246,21,252,24,64,133,142,131,142,133,143,25,238,29,
+251,24,202,53,226,73,30,251,151,89,160,251,11,248,28,214,5,247,46,57,247,
+51,68,251,53,247,131,29,252,11,6,139,247,78,61,247,105,248,78,29,247,35,64,
+227,41,206,30,247,141,187,5,14,48,250,129,251,209,21,236,251,19,177,139,30,
+251,36,251,27,5,52,251,13,247,109,208,251,3,31,138,158,159,138,160,27,248,
+78,29,247,118,251,78,227,251,62,225,31,143,29,252,25,6,74,247,181,238,252,
+75,247,225,27,203,247,36,168,247,19,31,14,66,250,151,248,56,21,251,54,6,97,
+251,140,5,123,135,120,124,133,27,139,57,104,61,251,11,251,29,213,247,25,247,
+56,247,83,185,247,49,243,30,247,48,243,247,49,247,7,247,95,26,247,145,251,
+104,244,251,150,251,101,251,72,57,139,30,127,251,228,5,247,50,6,181,247,111,
+5,141,150,166,157,139,26,139,176,172,227,247,23,242,79,251,7,251,45,251,45,
+83,251,46,54,30,251,63,43,251,93,251,28,251,136,26,251,167,247,143,56,247,
+176,247,105,247,80,217,139,30,14,152,250,216,248,166,21,247,17,251,231,7,
+190,176,193,176,185,180,8,247,90,247,17,44,6,163,183,153,189,199,26,247,145,
+251,83,244,251,124,251,80,251,54,57,139,30,128,251,208,5,247,34,6,177,247,
+91,5,141,150,163,157,139,26,139,173,172,218,247,10,231,79,251,7,53,102,77,
+82,87,30,252,223,251,17,248,43,6,84,105,80,102,86,95,8,251,142,251,17,247,
+29,6,104,82,117,72,58,26,251,167,247,118,56,247,148,247,83,247,62,217,139,
+30,151,247,247,5,251,38,6,102,251,120,5,123,135,122,124,134,27,139,65,104,
+69,251,0,251,15,213,247,25,236,193,202,212,196,30,14,152,247,113,248,81,21,
+251,1,107,44,93,77,155,53,247,19,87,31,35,7,138,242,140,139,30,214,7,170,
+133,173,134,178,136,8,78,7,138,243,140,139,30,196,150,7,170,170,140,142,170,
+31,78,242,216,7,247,88,182,247,49,247,8,247,111,26,247,101,251,56,247,3,251,
+73,192,30,251,98,199,251,52,144,247,85,26,247,6,210,219,247,38,247,32,239,
+91,139,139,141,134,141,128,30,176,251,106,5,247,33,247,234,6,139,251,100,
+202,251,101,251,156,251,110,251,13,251,158,251,126,247,52,33,247,107,81,30,
+247,81,88,247,49,119,251,62,26,42,103,77,72,104,30,247,18,7,202,106,208,61,
+100,98,113,110,112,30,170,125,98,163,97,27,100,109,122,108,108,31,187,103,
+97,139,112,27,247,205,251,192,21,247,78,7,156,163,153,148,155,27,188,140,
+102,82,31,251,1,7,107,134,105,136,101,138,8,251,100,152,21,247,65,7,155,159,
+156,149,154,27,185,145,103,87,31,251,14,7,101,141,104,142,108,145,8,251,70,
+247,36,21,181,170,152,153,164,144,117,105,30,251,3,7,91,164,113,176,138,189,
+8,14,253,75,248,127,252,69,21,200,247,49,29,247,0,244,181,139,30,14,253,69,
+248,130,249,191,247,1,10,252,3,28,4,162,247,1,10,252,57,50,29,128,28,6,21,
+37,10,252,57,50,29,251,120,28,6,19,42,10,252,57,50,29,131,252,185,48,29,252,
+57,50,29,51,252,21,248,16,10,252,57,50,29,251,108,252,5,73,29,252,57,50,29,
+251,90,251,236,58,29,252,57,50,29,232,28,5,64,79,10,252,57,50,29,37,251,205,
+59,10,252,57,249,140,251,111,21,248,2,248,45,10,247,30,10,247,196,10,186,
+247,1,162,147,182,30,251,121,247,175,10,242,247,18,247,77,211,247,74,30,14,
+253,70,248,130,249,34,21,247,111,247,49,29,169,210,153,144,167,30,251,30,
+248,61,29,106,113,74,26,80,237,113,206,221,247,12,182,247,2,30,14,252,57,
+249,140,184,21,247,69,10,247,36,247,176,247,13,251,176,247,184,247,30,10,
+251,184,251,27,251,13,247,27,251,120,248,13,29,252,57,50,29,60,248,198,38,
+10,252,57,249,196,28,5,12,21,251,59,251,185,5,251,82,247,155,251,34,6,247,
+219,10,253,21,7,124,139,125,140,125,30,251,63,251,193,243,78,247,14,247,106,
+5,98,178,201,119,230,27,248,104,29,31,247,69,10,247,1,7,248,99,249,193,5,
+252,99,252,1,21,247,7,6,251,7,251,95,5,14,252,57,249,214,28,5,80,21,247,9,
+251,7,178,59,251,177,251,51,251,124,251,154,30,251,38,67,5,57,247,27,247,
+196,10,248,104,29,30,241,247,198,29,242,7,247,78,163,194,180,201,30,247,75,
+251,72,5,206,161,199,188,203,26,14,252,57,249,140,252,39,21,247,69,10,250,
+129,247,30,10,254,213,248,13,29,252,57,249,207,247,113,21,247,29,251,2,215,
+251,13,90,94,121,122,96,30,248,105,247,30,10,253,53,7,251,0,251,17,63,251,
+44,100,45,241,92,24,176,208,197,247,3,217,239,8,70,196,241,126,247,5,27,247,
+21,247,82,246,247,31,31,251,57,143,21,84,83,86,88,53,129,200,209,30,161,184,
+176,164,192,27,180,166,108,100,31,14,108,249,180,28,4,238,21,70,251,155,5,
+251,164,247,0,29,247,129,7,251,56,253,7,5,247,22,6,247,56,249,7,5,247,49,
+247,23,251,14,6,208,247,155,5,14,249,241,28,5,156,215,29,253,162,28,250,108,
+222,10,28,4,213,94,21,134,10,14,247,255,28,5,221,247,148,21,243,59,228,251,
+15,251,55,51,44,251,62,96,30,44,248,124,29,247,30,247,17,153,164,137,139,
+30,251,122,7,121,168,161,114,223,27,215,211,201,231,247,23,251,32,233,251,
+109,251,183,251,127,251,111,251,214,51,163,61,178,74,31,104,115,88,82,96,
+27,91,111,174,248,72,10,251,34,247,186,29,247,5,247,4,234,225,209,30,211,
+67,231,80,231,112,8,125,49,130,43,63,26,247,1,6,215,147,223,154,220,30,155,
+168,137,157,27,247,76,247,56,247,1,247,64,31,251,64,145,21,61,96,86,51,108,
+127,139,145,110,30,244,166,178,210,209,27,180,165,125,102,31,14,247,192,28,
+5,143,247,211,21,247,140,252,131,182,247,77,26,210,198,174,233,209,207,115,
+108,163,30,160,251,52,5,247,21,247,177,6,139,251,15,192,251,97,251,132,247,
+182,29,149,187,72,30,114,247,80,5,251,21,251,87,123,6,32,78,187,248,72,10,
+251,32,247,186,29,223,223,172,156,200,30,124,187,247,29,104,247,54,27,247,
+94,247,107,225,247,150,31,14,247,10,28,5,37,28,5,63,21,209,36,242,251,19,
+251,156,251,51,251,71,251,129,169,30,154,38,5,251,142,247,0,29,247,158,7,
+247,15,254,70,163,251,84,113,248,6,29,69,241,35,247,19,248,38,29,30,248,8,
+10,247,70,251,80,24,139,247,17,184,247,4,26,14,247,40,28,4,247,247,81,10,
+253,135,247,155,251,34,7,247,31,10,248,91,248,102,247,99,10,154,151,96,30,
+71,247,101,247,98,29,251,3,248,74,10,251,32,250,47,249,158,21,247,101,253,
+221,251,101,247,111,7,251,19,46,40,251,26,251,54,26,251,160,247,68,251,38,
+247,201,247,99,247,29,223,170,209,30,247,50,7,101,81,251,6,76,251,17,27,251,
+85,251,10,239,247,94,247,38,189,247,7,204,207,31,14,252,57,249,99,188,21,
+221,251,27,249,19,7,247,66,73,219,251,72,251,58,251,54,69,139,30,37,7,139,
+207,153,204,246,200,92,251,25,30,252,191,251,176,251,23,247,176,251,154,247,
+32,7,247,2,247,109,5,14,251,46,247,40,10,248,189,235,7,247,129,29,251,46,
+247,40,10,247,92,248,45,29,247,129,29,247,91,249,35,250,5,21,247,63,6,248,
+53,10,254,109,247,111,29,247,63,252,247,6,235,29,79,189,247,2,30,14,247,222,
+249,66,247,244,29,253,225,247,111,29,240,253,111,6,114,119,118,114,137,30,
+251,6,133,5,43,250,73,7,247,62,218,73,251,141,31,247,17,248,47,6,247,19,10,
+252,24,6,106,127,161,164,31,249,95,7,14,197,65,29,14,252,15,249,169,28,5,
+104,21,247,117,253,148,251,117,235,7,163,247,29,5,149,140,147,144,150,27,
+247,41,253,35,6,123,125,129,122,138,30,62,132,5,77,248,42,201,7,61,146,5,
+123,140,125,149,155,26,249,35,247,41,7,150,146,134,129,140,31,163,251,29,
+5,14,251,73,250,111,249,91,21,247,180,254,91,251,180,247,32,7,169,247,62,
+5,143,142,143,149,30,247,64,253,142,6,108,57,143,88,135,30,43,248,160,235,
+7,251,1,147,5,125,141,129,148,151,26,249,142,247,64,7,248,128,10,197,65,29,
+45,250,4,49,10,152,28,4,138,249,139,247,176,29,253,231,6,247,135,29,249,231,
+248,66,29,247,33,248,126,21,247,17,254,246,251,17,7,14,197,65,29,251,194,
+249,118,42,10,197,65,29,45,28,250,33,48,29,197,65,29,45,28,250,197,74,10,
+197,65,29,251,194,28,250,213,73,29,197,65,29,251,176,28,250,238,58,29,197,
+65,29,251,80,28,251,13,59,10,197,28,4,190,250,123,21,248,11,248,42,29,7,247,
+90,29,252,96,251,138,251,21,247,138,252,138,247,117,10,248,138,247,138,247,
+21,251,138,248,96,247,173,29,14,152,28,4,138,250,123,247,176,29,252,173,6,
+251,115,251,42,197,45,247,57,247,3,5,42,7,251,109,251,38,194,44,247,54,247,
+1,5,251,84,7,247,135,29,248,16,7,247,108,247,39,80,230,251,49,33,5,237,7,
+247,105,247,36,77,229,251,43,37,5,247,241,248,66,29,14,197,250,160,215,29,
+211,252,110,201,29,14,197,28,4,190,250,123,21,248,11,254,6,7,251,48,251,58,
+98,251,127,251,11,211,45,247,7,192,206,182,233,31,251,27,247,15,5,161,7,195,
+190,167,185,30,247,90,254,215,6,112,117,123,116,137,30,251,13,128,5,35,249,
+5,243,7,251,11,150,5,115,141,116,155,166,26,250,215,247,121,7,156,151,131,
+123,141,31,176,251,120,5,14,197,28,4,135,251,179,21,248,32,10,28,5,129,187,
+29,28,250,236,6,251,199,247,68,251,9,247,105,247,48,247,29,198,247,19,30,
+14,248,94,28,6,45,247,81,10,253,134,247,144,247,121,7,156,149,131,123,141,
+31,176,251,40,5,247,41,247,187,248,42,29,6,247,33,29,248,242,248,101,247,
+99,10,149,156,96,30,71,247,111,247,98,29,251,13,248,74,10,247,29,28,4,222,
+28,4,141,21,247,101,28,251,124,251,101,247,228,7,251,107,251,33,251,10,251,
+92,251,158,26,251,214,247,181,251,161,248,16,247,148,245,195,205,247,14,30,
+247,51,7,59,251,22,35,108,251,69,27,251,167,251,38,247,168,247,113,247,160,
+226,247,63,236,231,31,14,197,171,248,11,21,252,11,28,4,157,248,11,251,39,
+7,102,251,120,5,123,137,127,131,122,27,251,121,250,215,6,166,161,155,164,
+141,30,247,11,150,5,243,253,5,35,7,247,13,128,5,163,137,160,123,112,26,254,
+215,251,121,7,122,129,147,155,137,31,102,247,120,5,14,197,248,83,22,247,139,
+10,247,255,29,250,215,187,29,254,215,247,192,10,7,14,248,35,248,113,247,187,
+21,247,248,10,247,223,7,200,10,250,95,187,29,6,14,249,50,250,23,28,4,227,
+21,248,52,10,254,205,252,11,247,39,6,248,0,29,247,71,254,215,6,112,119,123,
+114,137,30,251,17,128,5,35,250,173,7,247,139,10,247,18,10,252,179,6,114,119,
+157,166,31,250,207,7,14,248,42,28,6,6,22,243,7,251,7,248,80,10,248,84,7,247,
+115,251,60,232,251,82,63,251,21,94,91,37,30,248,56,247,78,7,168,145,127,110,
+143,31,168,251,70,5,247,41,247,234,254,224,251,234,247,42,6,168,247,70,5,
+170,143,145,149,168,27,247,78,254,215,6,112,118,123,115,137,30,251,7,128,
+5,35,248,238,247,61,29,248,129,7,150,155,247,15,214,186,27,246,219,102,251,
+25,31,252,45,7,112,116,123,116,137,30,33,128,5,35,7,14,248,10,28,5,207,248,
+74,21,247,181,251,115,247,85,251,157,62,251,38,118,76,49,30,248,51,247,48,
+7,155,149,131,123,141,31,176,251,120,5,247,42,248,11,254,156,252,11,247,39,
+6,248,0,29,247,45,254,215,6,112,117,123,114,137,30,41,128,5,35,248,222,243,
+7,36,150,5,117,141,116,155,166,26,248,133,7,205,203,225,151,200,27,247,54,
+247,29,251,0,251,81,251,84,123,251,66,251,73,31,34,7,247,159,247,113,247,
+5,247,250,31,14,252,0,249,175,248,85,29,80,248,78,10,248,160,72,7,251,87,
+78,5,89,223,252,21,7,139,88,118,84,251,6,130,215,199,30,248,17,70,7,251,88,
+78,5,89,226,251,210,7,251,17,184,64,247,44,236,247,5,222,139,30,71,7,14,251,
+252,249,175,249,164,209,29,251,110,28,4,135,209,29,220,36,29,248,33,28,5,
+115,63,29,220,36,29,247,113,250,252,46,10,220,36,29,247,39,250,252,62,10,
+220,36,29,247,39,28,5,182,58,10,220,36,29,247,66,28,5,199,49,10,220,36,29,
+247,78,28,5,172,38,10,220,36,29,247,78,28,5,172,60,29,109,247,235,33,10,220,
+36,29,247,66,28,4,176,74,10,220,36,29,247,66,28,4,176,228,29,249,85,248,145,
+37,10,220,36,29,247,75,28,5,59,56,10,248,39,248,92,33,10,220,36,29,247,75,
+28,5,59,56,10,247,166,247,81,52,29,220,36,29,247,75,28,5,59,248,197,10,220,
+36,29,247,75,28,5,59,56,10,248,57,247,153,74,10,220,36,29,224,28,5,106,85,
+29,14,220,36,29,131,28,5,131,43,29,220,36,29,247,66,252,140,48,29,220,36,
+29,247,78,74,29,220,36,29,247,75,247,24,10,220,36,29,105,70,29,220,36,29,
+247,150,251,254,67,29,220,28,6,123,87,10,252,72,247,220,21,198,29,14,220,
+28,4,219,248,80,21,247,23,251,50,248,85,248,41,29,247,21,251,155,251,244,
+248,85,248,35,10,251,155,251,49,251,23,247,49,251,27,7,251,101,209,251,17,
+247,125,248,129,29,30,251,5,248,48,247,115,10,247,186,7,251,166,251,139,21,
+248,119,10,194,247,244,7,14,252,0,249,189,250,175,21,218,35,247,161,71,7,
+251,85,77,5,88,223,251,48,251,121,247,161,69,7,251,86,77,5,88,225,251,48,
+36,60,242,57,248,44,10,247,159,197,7,79,143,5,123,125,151,155,31,247,69,7,
+251,69,251,42,21,248,153,10,172,247,121,7,14,247,120,46,29,14,247,120,46,
+29,252,35,247,120,33,10,247,120,46,29,252,164,100,52,29,247,120,46,29,252,
+5,247,177,38,10,247,120,46,29,252,199,247,136,43,29,247,120,46,29,252,225,
+28,250,45,73,29,249,11,28,6,221,235,21,247,75,29,51,60,121,106,72,30,190,
+248,41,29,247,21,253,17,7,139,61,100,247,93,10,247,18,247,128,247,22,179,
+210,30,34,223,247,26,74,247,79,27,248,135,29,31,247,177,29,14,226,28,4,112,
+184,10,14,251,252,249,118,28,5,156,21,77,6,135,85,5,124,138,125,125,123,27,
+252,204,77,6,205,251,72,5,194,217,248,52,6,139,162,92,87,26,35,57,131,74,
+30,252,49,74,6,205,251,72,5,194,219,247,236,6,247,27,221,181,247,31,229,49,
+244,139,31,212,6,14,248,89,28,5,222,184,10,28,251,40,247,55,21,61,75,75,61,
+62,203,75,217,216,203,203,216,217,75,203,62,31,252,66,4,61,75,75,61,61,203,
+76,217,216,203,202,217,217,75,203,62,31,14,85,250,193,248,173,21,247,98,251,
+11,247,173,251,94,77,63,73,76,96,172,84,139,30,247,89,6,206,94,160,38,47,
+26,251,140,53,251,76,251,52,251,29,53,186,247,50,30,249,72,248,35,10,252,
+97,7,251,203,247,32,48,247,166,247,189,247,66,247,153,247,193,30,14,252,88,
+249,75,250,231,21,247,16,61,247,60,251,23,99,89,100,101,113,161,106,139,30,
+247,20,6,183,112,152,79,83,26,251,40,83,251,3,35,50,83,167,234,30,248,51,
+70,7,251,88,78,5,89,226,251,169,7,251,78,230,84,247,70,247,85,247,5,247,49,
+247,72,30,14,177,247,12,247,199,21,252,211,138,114,251,21,26,247,199,219,
+6,126,179,63,247,34,92,247,45,8,127,176,183,133,191,27,248,129,29,31,251,
+5,248,48,247,115,10,249,254,251,166,253,207,7,248,119,10,249,15,251,167,253,
+95,7,14,177,28,4,137,248,99,21,247,62,251,58,247,43,74,217,30,248,152,29,
+235,251,201,7,247,8,251,68,133,251,49,251,50,26,251,203,251,47,251,13,48,
+49,251,47,247,13,247,203,247,58,135,247,41,247,6,247,68,30,248,48,10,71,61,
+251,57,251,43,251,62,26,251,152,247,51,251,120,248,25,248,32,247,43,247,120,
+247,152,30,14,252,28,249,136,250,187,21,241,251,1,227,96,186,30,131,148,145,
+149,149,141,215,143,24,196,251,93,7,215,35,135,45,45,26,251,79,37,65,81,82,
+37,213,247,79,237,135,229,214,243,30,251,92,82,6,214,135,150,137,145,129,
+131,130,25,94,92,32,51,37,26,251,50,243,251,27,247,144,247,148,240,247,27,
+247,50,30,14,177,250,183,250,123,21,251,201,6,238,251,43,149,251,29,140,251,
+27,8,252,127,6,140,247,31,150,247,24,237,247,44,8,248,48,10,86,79,251,2,35,
+92,251,14,8,50,251,13,205,6,251,149,142,247,52,251,115,248,21,27,248,28,247,
+44,247,115,247,149,142,31,205,247,13,50,6,91,247,14,251,2,243,89,199,248,
+152,29,252,81,253,207,21,54,251,34,246,247,164,122,31,248,124,6,251,164,123,
+251,35,32,54,27,14,251,111,250,60,248,139,29,251,198,77,7,214,248,77,29,252,
+62,7,251,24,82,51,251,31,251,39,70,206,247,45,30,248,62,7,156,154,148,154,
+141,30,210,145,5,201,252,30,77,7,211,133,5,155,137,154,130,122,26,252,52,
+7,251,108,247,2,251,8,247,121,247,141,247,8,229,247,134,30,248,52,7,156,154,
+148,153,141,30,14,144,247,247,10,252,141,7,251,46,71,43,251,55,251,67,60,
+213,247,68,30,248,141,247,224,29,252,129,247,224,10,248,129,7,150,150,147,
+155,141,30,14,252,49,249,136,28,5,47,21,196,251,151,82,7,170,136,191,144,
+119,26,251,195,7,47,95,81,33,251,5,87,184,244,30,247,195,7,158,191,135,168,
+142,30,196,251,222,82,7,171,136,190,143,120,26,251,187,7,251,51,229,54,247,
+81,247,93,236,206,247,69,30,247,187,7,146,146,144,150,140,30,14,247,196,33,
+29,248,171,4,209,10,247,196,33,29,251,68,247,160,46,10,247,196,33,29,251,
+142,247,160,62,10,247,196,33,29,251,142,248,238,58,10,247,196,33,29,251,115,
+248,255,49,10,247,196,33,29,251,103,248,228,38,10,247,196,33,29,251,103,248,
+228,60,29,109,247,235,33,10,247,196,33,29,251,115,247,232,74,10,247,196,33,
+29,251,115,247,232,228,29,249,85,248,145,37,10,247,196,33,29,251,106,248,
+115,56,10,248,39,248,92,33,10,247,196,33,29,251,106,248,115,56,10,247,166,
+247,81,52,29,247,196,33,29,251,106,248,115,248,197,10,247,196,33,29,251,106,
+248,115,56,10,248,57,247,153,74,10,247,196,33,29,251,204,248,162,85,29,14,
+247,196,33,29,252,41,248,187,43,29,247,196,33,29,251,115,28,249,28,48,29,
+247,196,33,29,251,103,28,250,102,134,29,247,196,33,29,251,106,28,249,217,
+247,36,10,247,196,33,29,252,67,28,249,208,73,29,247,196,33,29,251,186,28,
+249,160,67,29,247,196,28,5,180,249,33,21,247,25,251,66,248,64,248,131,10,
+247,1,149,5,243,252,107,35,7,247,8,228,10,252,64,253,14,248,64,247,119,10,
+252,64,251,64,251,25,247,64,251,25,247,225,29,247,25,7,251,48,251,41,21,251,
+113,51,251,38,251,107,251,117,33,247,3,247,148,30,247,41,249,14,7,14,144,
+247,247,10,251,186,252,121,247,186,247,224,29,251,186,251,36,251,21,247,36,
+69,247,224,10,209,247,36,247,21,251,36,247,186,7,150,150,147,155,141,30,252,
+41,253,156,21,251,67,60,213,247,68,31,221,248,121,57,7,251,46,71,43,251,55,
+30,14,248,173,41,29,14,248,173,41,29,252,254,247,196,33,10,248,173,41,29,
+253,127,176,52,29,248,173,41,29,252,224,247,253,38,10,248,173,41,29,253,162,
+247,212,43,29,248,173,41,29,253,188,28,248,233,73,29,247,167,28,5,111,249,
+130,21,247,182,251,101,248,3,251,111,251,19,73,86,47,59,221,77,139,30,247,
+109,6,213,76,239,251,29,251,85,26,252,21,251,131,251,89,251,126,251,80,55,
+219,247,136,30,250,29,252,89,55,7,247,7,129,5,167,137,154,116,121,26,253,
+191,7,251,226,247,160,251,17,247,128,248,105,247,107,247,244,248,67,30,14,
+247,149,249,181,28,5,251,21,251,113,253,7,251,3,247,198,247,58,10,247,173,
+253,146,251,110,253,0,247,6,97,247,62,248,118,247,16,251,230,5,247,105,6,
+248,96,28,5,6,247,59,29,251,205,254,17,251,39,248,40,247,162,249,148,5,14,
+249,169,178,10,247,234,28,251,142,114,61,111,95,100,99,25,251,116,247,3,5,
+53,75,100,65,98,26,82,235,59,247,33,247,93,245,247,54,247,115,195,30,247,
+227,28,5,61,5,14,181,248,24,29,247,106,7,248,240,28,5,55,247,59,29,252,50,
+254,28,5,250,190,247,152,10,14,247,198,28,5,145,249,21,21,247,132,251,31,
+247,141,35,228,30,114,159,141,162,172,141,247,54,147,24,241,252,91,7,247,
+21,251,138,203,251,37,251,175,26,252,31,251,36,251,97,251,92,251,91,251,35,
+247,97,248,31,247,187,202,247,25,247,21,247,138,30,252,93,37,6,247,56,131,
+172,137,141,116,114,119,25,35,50,251,33,251,141,251,132,26,251,226,247,133,
+251,232,248,73,248,74,247,131,247,232,247,226,30,14,109,79,29,14,252,72,249,
+122,221,21,196,251,151,82,7,195,135,154,138,149,125,134,127,25,251,37,251,
+232,251,23,247,232,134,152,147,248,52,29,247,105,252,171,5,247,24,6,247,121,
+248,169,5,14,252,71,249,121,28,5,45,221,10,251,125,28,6,164,221,10,109,79,
+29,55,248,199,38,10,109,79,29,251,196,28,251,67,73,29,109,250,171,251,107,
+21,247,217,252,87,251,2,247,214,247,72,29,233,250,242,222,29,14,247,96,28,
+4,156,28,4,119,21,251,142,65,251,52,251,179,40,31,251,22,252,17,247,87,29,
+247,149,249,113,247,109,10,248,136,249,216,106,21,247,242,250,174,5,247,99,
+208,183,212,247,236,29,251,142,62,251,51,251,180,43,30,251,113,253,41,251,
+216,250,15,247,58,10,248,107,28,250,252,5,14,78,250,232,248,139,10,252,33,
+43,7,225,133,161,137,158,116,128,119,25,251,146,252,203,251,21,247,176,5,
+234,195,214,206,247,29,26,236,35,237,251,7,251,39,251,27,61,251,33,69,137,
+145,159,76,30,168,55,102,133,104,135,104,135,25,86,251,11,200,147,209,145,
+207,151,25,247,101,252,123,5,247,92,6,248,19,250,13,5,252,135,65,21,69,100,
+111,92,104,30,130,166,96,221,137,188,8,167,152,172,173,191,180,100,92,30,
+14,109,249,49,28,4,148,21,251,65,252,127,79,247,63,247,232,10,247,111,252,
+232,251,43,252,67,244,101,246,247,196,187,251,22,5,247,95,6,247,244,250,13,
+247,9,153,5,247,141,10,251,115,252,203,58,247,121,247,111,249,2,5,14,248,
+169,28,6,168,250,123,21,252,29,43,6,214,10,247,149,253,210,101,42,106,84,
+102,103,247,151,10,247,1,242,208,247,70,175,247,8,247,162,249,255,24,247,
+7,153,5,14,134,248,95,250,148,21,32,6,251,195,35,5,55,247,27,28,251,145,155,
+29,247,114,7,248,178,250,90,247,9,153,5,235,252,34,43,7,225,133,162,137,158,
+115,128,120,25,252,14,253,24,5,14,249,32,79,29,249,21,248,105,69,10,14,28,
+5,54,79,29,249,21,248,105,248,202,10,28,7,224,79,29,249,21,248,105,248,203,
+29,109,28,4,117,22,235,7,251,13,152,251,222,250,14,5,251,93,6,251,246,254,
+12,251,7,124,5,43,248,34,235,7,53,145,116,141,121,162,147,159,25,247,117,
+248,204,247,93,252,204,145,117,127,118,116,137,25,43,248,17,29,252,72,249,
+122,249,165,21,197,7,60,146,251,107,248,170,5,251,22,6,251,122,252,168,64,
+130,5,81,247,151,197,7,83,142,124,140,127,153,144,151,25,247,39,247,233,247,
+22,251,233,143,126,131,126,124,138,25,77,248,106,29,134,28,4,139,249,181,
+21,247,4,76,247,3,251,11,41,51,251,13,55,81,30,251,11,251,68,251,21,247,101,
+5,215,92,64,235,251,56,27,34,61,251,5,251,2,31,65,144,71,105,26,237,6,139,
+147,247,70,221,215,176,55,90,167,30,139,205,251,5,206,251,7,30,88,66,5,102,
+83,96,74,77,26,251,60,247,25,96,247,5,247,13,247,0,247,1,241,223,105,215,
+108,190,30,65,247,11,5,211,241,200,232,139,26,184,170,190,186,199,27,210,
+164,251,70,139,31,229,6,186,149,204,203,26,252,170,253,9,21,94,118,98,92,
+94,108,166,190,163,170,199,182,210,30,180,68,168,81,121,26,14,154,28,4,162,
+250,27,21,237,252,11,41,7,227,129,155,137,150,127,131,120,25,251,144,252,
+172,251,144,248,172,131,158,149,151,151,141,25,241,149,5,237,252,146,41,7,
+247,9,127,248,29,253,228,64,251,50,5,116,96,123,78,104,26,251,27,192,55,247,
+85,247,37,215,247,27,247,13,184,130,182,121,178,30,133,153,251,9,247,142,
+139,26,247,232,249,97,5,252,41,28,251,110,21,92,110,121,98,114,103,168,188,
+153,143,155,147,156,30,141,147,186,244,139,26,139,188,32,143,133,30,150,116,
+145,119,122,26,14,252,43,249,150,28,5,45,21,198,251,136,80,7,197,135,149,
+137,147,131,135,128,25,251,58,251,213,251,56,247,213,135,150,145,147,148,
+141,25,204,143,5,198,251,224,80,7,215,133,247,148,252,144,90,43,5,125,112,
+128,104,119,26,57,174,88,247,17,233,188,221,210,166,133,166,127,161,30,59,
+247,52,247,115,248,66,5,251,156,253,83,21,113,121,127,112,123,114,155,170,
+147,141,149,145,149,30,141,143,170,203,139,26,139,172,75,141,135,30,145,125,
+143,127,128,26,14,251,72,248,188,247,83,21,248,156,36,251,5,247,123,251,19,
+27,58,81,251,71,91,91,139,108,174,31,173,157,247,17,193,27,230,247,88,252,
+95,251,86,149,31,139,57,251,88,251,24,26,251,24,181,47,196,196,171,247,15,
+244,244,102,247,97,139,30,198,247,76,247,185,248,75,247,90,26,251,50,6,251,
+115,251,37,251,171,65,251,114,30,14,252,170,247,251,251,237,177,10,252,170,
+247,251,250,24,177,10,247,149,76,29,14,251,141,250,55,248,139,29,251,189,
+77,7,210,130,159,137,140,125,137,129,25,251,96,252,172,251,102,248,171,135,
+149,140,154,155,141,25,214,148,5,201,252,16,77,7,225,128,247,203,253,151,
+5,247,18,6,247,198,249,152,5,14,138,28,4,143,248,139,10,252,27,43,7,237,129,
+160,141,133,121,251,134,252,245,24,251,138,248,242,135,150,143,145,146,141,
+25,241,149,5,235,252,126,43,7,247,1,127,248,19,254,40,5,247,64,6,248,13,250,
+40,5,14,247,149,76,29,251,81,248,235,38,10,247,149,76,29,252,45,28,249,215,
+73,29,247,149,28,5,145,248,106,10,247,112,10,251,205,254,17,40,247,163,227,
+247,111,5,195,247,33,173,247,7,247,97,26,241,111,248,72,29,251,21,111,51,
+98,34,30,110,65,251,62,248,103,247,58,10,247,223,254,13,251,203,253,143,5,
+247,19,6,247,136,248,242,219,251,130,5,247,105,6,248,96,28,5,6,5,14,247,96,
+28,4,113,250,148,21,251,142,62,251,51,251,180,43,31,52,251,154,247,87,29,
+247,106,248,250,247,109,10,250,116,76,29,249,216,28,251,27,21,248,194,29,
+28,6,191,76,29,249,216,28,251,27,21,248,202,29,28,9,158,76,29,249,216,28,
+251,27,21,71,10,28,5,94,22,248,202,29,247,149,28,5,145,22,243,7,251,23,158,
+252,117,28,5,4,5,251,87,6,252,104,28,250,250,251,22,122,5,35,248,95,243,7,
+251,2,154,108,143,135,161,145,156,25,247,205,250,17,247,216,254,15,145,122,
+137,115,114,135,25,251,6,124,5,35,7,14,194,28,4,212,233,21,70,151,118,144,
+137,141,135,155,25,252,57,249,250,5,251,90,6,252,57,254,14,248,5,29,247,186,
+249,10,247,196,253,16,5,137,141,135,133,137,27,42,126,5,43,248,103,7,14,247,
+128,28,5,125,248,106,10,243,252,95,35,7,247,3,124,169,135,146,115,130,124,
+25,251,229,252,139,251,171,248,137,131,156,143,248,9,10,248,66,253,172,251,
+5,251,58,5,123,114,114,84,76,26,251,42,247,42,106,247,21,247,70,247,4,240,
+247,4,203,131,167,117,178,30,251,28,247,136,248,81,249,78,5,252,185,254,215,
+21,98,139,108,86,86,120,155,199,166,149,157,150,155,30,184,209,178,69,5,153,
+113,145,120,119,26,14,248,169,45,10,14,69,250,232,28,5,47,21,196,251,148,
+82,7,198,135,153,138,147,125,135,127,25,251,2,251,232,251,35,248,146,10,35,
+247,230,135,152,148,152,154,140,25,196,143,5,196,251,233,82,7,218,132,247,
+64,252,171,5,247,37,6,247,45,248,72,247,37,252,72,5,247,40,6,247,70,248,169,
+5,14,248,169,45,10,252,3,248,142,33,10,248,169,45,10,252,132,247,131,52,29,
+248,169,45,10,251,241,247,131,48,29,248,169,45,10,251,232,248,86,37,10,248,
+169,45,10,252,193,248,84,42,10,248,169,45,10,252,74,248,133,85,29,14,248,
+169,45,10,252,223,28,251,67,73,29,249,243,250,164,250,123,21,247,28,10,247,
+115,253,107,5,247,120,6,247,120,249,115,226,247,173,183,225,225,171,25,247,
+45,251,33,5,204,171,198,191,196,26,221,55,236,251,4,251,4,70,101,72,76,30,
+97,94,75,251,0,78,251,95,251,62,252,203,24,14,70,250,232,248,178,21,197,251,
+148,81,7,196,135,156,138,147,126,135,127,247,187,29,151,148,151,155,141,25,
+196,143,5,197,251,234,81,7,219,131,247,62,252,170,5,247,38,6,247,45,248,72,
+247,38,252,72,5,247,39,6,247,70,248,168,5,215,249,165,21,196,251,148,82,7,
+196,137,156,137,147,127,135,124,247,187,29,154,148,151,155,141,25,196,141,
+5,196,251,234,82,7,219,133,247,62,252,171,5,247,38,6,247,45,248,73,247,38,
+252,73,5,247,39,6,247,70,248,169,5,14,248,169,28,6,168,22,235,7,251,15,152,
+251,154,250,14,5,251,115,6,251,130,253,107,251,113,249,107,5,251,119,6,251,
+169,254,12,251,5,124,5,43,248,30,235,7,49,145,116,141,125,160,147,161,25,
+247,62,248,204,247,109,253,95,5,247,117,6,247,124,249,91,247,49,252,200,146,
+117,126,118,117,137,25,51,248,17,29,248,70,249,62,249,70,21,251,133,7,251,
+82,125,251,53,251,32,251,22,110,247,47,247,113,247,105,173,247,74,247,63,
+191,30,230,7,251,156,140,251,136,251,104,251,219,26,251,118,240,251,165,247,
+213,247,122,220,247,40,217,159,30,61,156,220,251,40,247,122,27,247,213,227,
+247,165,247,118,142,31,143,247,219,251,130,247,104,251,156,138,8,48,7,247,
+63,87,173,251,74,251,105,26,251,113,110,251,47,251,22,251,32,126,247,53,247,
+82,30,247,133,7,14,247,202,28,5,154,248,46,21,247,221,251,81,247,177,252,
+125,252,136,251,82,251,177,251,221,251,152,247,43,251,67,247,124,247,49,246,
+182,247,69,178,30,251,67,173,246,94,247,52,27,247,123,247,42,247,64,247,155,
+31,251,183,128,21,251,74,100,251,11,251,15,251,74,159,247,54,190,30,247,73,
+201,93,247,26,26,247,2,71,215,80,79,70,55,41,30,251,38,198,190,251,72,26,
+86,151,251,50,251,64,251,19,104,247,7,247,78,247,169,215,247,121,247,206,
+247,209,213,251,119,251,171,30,14,249,169,48,10,14,235,28,4,249,248,139,29,
+251,187,77,7,224,131,158,137,142,126,136,128,25,251,25,252,135,251,85,248,
+231,5,251,36,6,251,78,252,218,251,33,248,122,136,150,138,153,155,140,25,218,
+147,5,201,251,255,77,7,220,129,247,115,253,152,5,247,20,6,247,95,249,19,247,
+100,253,19,5,247,18,6,247,101,249,152,5,14,248,61,28,6,57,248,139,10,252,
+21,43,7,247,7,129,153,137,139,133,137,131,25,251,45,252,191,251,120,249,57,
+5,251,86,6,251,111,253,43,251,56,248,177,5,145,137,137,149,147,27,245,149,
+5,235,252,103,43,7,242,127,247,164,254,40,5,247,68,6,247,134,249,114,247,
+138,253,114,5,247,66,6,247,150,250,40,5,14,249,169,48,10,252,119,248,178,
+33,10,249,169,48,10,252,248,247,167,52,29,249,169,48,10,252,101,247,167,48,
+29,249,169,48,10,252,92,248,122,37,10,249,169,48,10,253,53,248,120,42,10,
+249,169,48,10,253,64,28,249,215,73,29,250,176,28,4,139,248,58,29,248,55,29,
+162,164,142,247,124,29,247,212,254,189,5,247,86,6,247,93,249,188,213,247,
+190,166,247,93,247,6,182,25,247,76,251,31,5,225,166,168,199,190,26,241,49,
+200,44,44,44,112,61,65,30,59,54,91,251,19,82,251,127,251,24,252,182,24,14,
+152,28,4,158,248,106,10,243,251,164,35,7,218,126,156,135,141,117,137,122,
+25,112,251,74,5,251,105,6,78,247,234,5,251,25,6,78,251,234,5,251,104,6,110,
+247,74,136,156,138,163,154,141,25,212,152,5,243,251,227,35,7,214,122,174,
+251,113,5,251,2,251,17,247,22,6,157,251,7,5,251,40,251,17,247,60,6,247,4,
+253,80,5,247,10,6,247,80,250,189,247,84,254,189,5,247,9,6,244,249,80,5,247,
+55,247,17,251,36,6,156,247,7,5,247,19,247,17,251,0,6,172,247,113,5,251,210,
+251,238,21,247,63,6,122,251,7,5,251,26,6,252,126,247,7,21,247,62,6,119,251,
+7,5,251,24,6,248,131,251,17,21,232,6,97,251,178,5,252,162,247,178,21,229,
+6,92,251,156,5,14,68,61,10,14,68,61,10,14,252,97,249,95,248,85,29,68,149,
+251,97,247,156,247,69,247,93,214,148,5,196,251,140,82,7,182,135,152,138,142,
+126,132,131,25,33,251,11,46,247,11,130,147,142,152,154,140,25,177,248,136,
+29,209,130,247,89,251,145,251,82,251,104,59,129,5,81,247,152,197,7,92,143,
+126,141,135,150,147,147,25,247,9,247,25,244,251,25,146,130,248,103,29,252,
+98,249,95,249,164,130,10,251,138,28,4,135,130,10,68,61,10,247,229,28,5,59,
+37,10,68,61,10,247,12,28,5,57,42,10,68,250,224,251,111,21,247,207,73,10,248,
+27,251,115,247,175,10,241,247,19,247,77,211,247,74,30,14,68,250,57,248,91,
+21,247,13,251,131,7,247,146,247,205,247,14,10,247,116,251,205,5,251,100,251,
+13,247,169,6,251,175,251,234,247,49,10,248,156,235,7,251,1,156,251,137,247,
+234,5,14,68,248,150,247,252,21,247,89,251,159,5,221,251,3,182,34,80,26,87,
+116,60,251,5,93,82,142,143,94,30,154,51,5,132,188,222,131,187,27,247,197,
+187,247,59,243,223,75,247,1,251,18,247,66,31,251,126,247,216,247,164,247,
+228,247,14,10,247,195,252,58,251,185,251,246,247,232,29,14,68,250,224,251,
+211,21,248,51,73,10,247,45,7,247,62,211,69,251,141,31,14,248,247,61,10,250,
+168,67,10,14,28,5,13,61,10,250,168,28,5,78,248,202,10,247,110,28,5,106,251,
+166,21,200,37,188,45,30,251,19,251,82,104,153,100,192,92,247,44,25,251,7,
+247,252,248,118,249,154,5,251,193,6,251,175,252,88,73,247,101,5,247,58,86,
+43,241,251,37,27,251,116,251,13,33,36,78,244,90,233,31,247,17,247,90,174,
+127,178,86,186,251,44,25,247,11,252,7,252,114,253,144,5,247,194,6,247,168,
+248,83,203,251,95,5,251,54,190,239,33,247,37,27,247,116,247,10,233,244,31,
+14,251,167,250,25,253,4,136,10,251,167,250,25,249,1,136,10,247,77,59,29,14,
+247,77,59,29,14,247,77,59,29,247,197,28,6,203,37,10,247,77,59,29,227,28,6,
+201,42,10,247,77,28,4,163,249,23,21,247,13,251,253,7,248,12,248,123,247,41,
+29,252,236,35,7,247,21,120,247,205,252,123,5,251,191,251,13,247,252,6,252,
+34,252,158,247,39,29,248,251,243,7,251,21,156,251,227,248,158,5,14,247,77,
+249,199,249,134,21,248,19,248,133,247,141,29,151,113,115,121,248,146,29,165,
+122,152,163,154,27,247,0,149,5,243,252,236,35,7,247,21,120,248,19,252,232,
+252,43,252,170,248,49,29,121,160,159,165,25,247,168,247,250,247,174,252,65,
+5,215,251,8,174,59,80,26,87,92,67,44,93,52,145,143,94,30,154,251,7,5,132,
+188,247,5,128,187,27,247,229,185,247,79,243,223,40,247,44,68,247,3,31,14,
+247,77,28,5,74,248,0,10,124,10,247,17,247,205,29,250,44,59,29,28,5,41,70,
+10,14,28,6,119,59,29,28,5,41,22,248,202,29,109,34,10,14,252,72,249,122,28,
+5,47,21,196,251,152,82,7,197,135,154,138,149,125,134,127,25,251,33,251,207,
+251,29,247,207,134,152,148,248,52,29,247,129,252,182,127,97,100,59,91,97,
+25,251,5,219,5,101,124,100,109,94,26,79,137,206,100,191,27,191,183,160,172,
+176,31,211,202,185,245,172,212,247,122,248,157,24,14,109,34,10,247,31,248,
+142,63,29,109,34,10,251,123,247,131,52,29,109,34,10,55,247,131,48,29,109,
+34,10,60,248,119,83,10,109,34,10,67,248,199,38,10,109,34,10,55,247,203,74,
+10,109,34,10,55,247,203,74,10,109,34,10,64,248,86,37,10,109,34,10,251,184,
+248,84,42,10,109,34,10,251,65,248,133,85,29,14,109,34,10,251,158,248,158,
+43,29,109,34,10,251,204,28,249,179,73,29,109,28,4,117,247,245,29,96,35,5,
+251,236,6,98,243,247,233,29,196,251,35,5,251,20,251,13,247,69,6,247,151,253,
+25,120,69,80,251,25,247,57,29,247,139,248,243,24,247,58,247,13,251,9,6,197,
+247,33,5,252,144,251,154,21,247,137,6,251,16,251,193,5,14,247,31,28,5,188,
+28,4,111,21,237,39,204,59,251,131,251,13,251,178,251,77,63,30,251,99,252,
+137,251,103,248,162,247,233,29,248,1,254,33,120,69,80,251,25,65,69,25,251,
+66,247,25,5,80,111,79,92,63,26,38,240,76,219,247,129,247,15,247,199,247,78,
+215,30,247,185,249,97,192,247,27,182,247,34,247,1,239,25,247,66,251,25,5,
+198,168,198,186,217,26,14,109,248,70,29,161,138,157,117,130,117,248,143,10,
+162,155,160,162,140,248,3,10,135,131,136,131,136,131,25,160,79,82,150,87,
+27,251,106,54,251,8,251,24,251,30,231,62,247,24,247,24,231,220,247,73,235,
+31,178,118,181,114,186,108,195,247,3,24,97,168,95,165,96,162,248,41,250,112,
+24,253,151,28,251,46,21,78,140,103,182,193,26,200,181,193,239,181,185,132,
+122,191,30,68,251,44,90,101,74,140,8,14,193,247,0,10,247,228,254,1,5,251,
+193,7,247,167,29,247,236,7,247,254,249,218,5,14,193,247,0,10,247,189,253,
+157,5,251,193,251,10,247,232,251,175,6,247,167,29,247,175,247,231,247,10,
+251,207,7,247,230,249,161,5,14,109,28,4,117,22,233,7,251,13,151,252,1,250,
+34,156,208,159,209,213,209,25,247,66,251,25,5,198,165,199,188,215,26,237,
+38,205,60,40,61,90,69,76,30,49,41,118,36,94,251,0,251,248,253,250,24,32,124,
+5,45,248,36,233,7,49,145,116,141,121,162,149,159,25,247,107,248,163,247,103,
+252,163,149,119,123,116,116,137,25,43,133,5,45,7,14,247,128,28,5,127,247,
+72,21,221,32,199,43,30,247,243,10,251,248,249,246,5,247,52,73,35,229,251,
+38,247,178,10,182,137,91,251,10,205,31,210,251,25,247,74,10,31,14,247,128,
+249,140,28,4,244,21,247,55,7,251,73,251,52,5,232,75,52,190,251,1,247,178,
+10,176,142,102,52,183,31,251,111,251,86,5,251,64,7,247,172,247,144,172,78,
+247,74,10,221,32,199,43,31,247,243,10,251,245,249,239,5,14,156,116,29,14,
+156,116,29,247,221,28,5,59,37,10,167,28,4,127,22,235,7,65,247,173,10,249,
+80,247,59,10,252,138,43,7,205,247,22,29,251,214,7,108,125,108,127,109,133,
+8,247,137,251,9,251,144,7,67,150,119,174,206,26,247,76,10,247,73,75,247,51,
+30,166,251,84,247,9,247,107,6,169,147,172,151,168,150,8,251,148,248,40,29,
+63,248,17,29,156,28,4,117,251,211,21,248,51,124,29,43,247,37,248,161,10,156,
+117,10,252,51,247,17,7,247,108,246,237,247,17,144,30,14,146,28,4,117,251,
+192,21,247,221,7,59,147,5,110,141,129,148,167,26,249,173,247,59,10,252,140,
+43,7,181,131,164,137,138,124,126,115,25,62,251,38,71,251,9,72,37,8,124,158,
+135,166,176,26,247,170,247,147,29,251,197,7,251,3,221,74,243,110,30,47,251,
+10,40,39,251,14,251,4,248,47,29,247,244,248,59,29,252,74,6,189,192,194,205,
+199,224,8,138,151,152,139,151,27,198,242,162,170,213,31,247,14,4,115,87,82,
+122,94,27,111,6,194,227,200,243,205,247,16,8,14,247,61,43,10,14,66,250,220,
+248,139,10,252,21,43,7,247,2,133,5,147,135,131,129,133,31,251,103,251,222,
+251,88,247,220,5,149,133,136,147,146,27,237,147,5,235,252,124,43,7,247,1,
+127,247,203,252,138,5,251,156,7,108,55,145,86,135,30,43,248,167,235,7,251,
+3,147,5,123,130,150,149,31,247,197,7,247,189,248,97,5,14,247,61,43,10,251,
+232,247,169,52,29,247,61,43,10,251,85,247,169,48,29,247,61,43,10,251,73,248,
+237,38,10,247,61,43,10,251,85,247,241,74,10,247,61,43,10,252,37,248,122,42,
+10,247,61,43,10,252,11,248,196,43,29,247,61,43,10,252,37,28,249,217,73,29,
+247,61,247,180,10,74,251,6,5,252,49,6,80,247,4,247,205,10,223,251,45,5,251,
+28,251,13,247,95,6,247,136,252,76,247,70,10,247,113,248,19,5,247,88,247,13,
+251,19,6,228,247,45,5,252,248,251,166,21,247,170,6,251,36,251,144,5,14,247,
+61,237,10,247,219,252,230,5,251,211,251,17,248,23,252,8,6,247,134,10,248,
+8,248,21,247,17,251,243,7,247,237,248,230,5,14,247,69,28,5,68,248,106,10,
+243,252,89,35,7,247,17,131,5,155,145,116,112,125,31,251,125,252,90,251,132,
+248,121,5,247,17,80,49,178,251,26,27,251,144,251,21,32,251,6,49,180,71,234,
+141,31,218,156,151,191,190,31,55,247,37,5,178,164,157,147,186,27,174,160,
+125,79,167,31,247,224,253,55,5,252,13,7,112,116,123,115,248,28,10,116,141,
+117,155,166,26,248,70,7,247,232,249,37,5,14,247,61,28,4,195,28,4,227,21,247,
+10,158,5,243,252,88,35,7,247,17,130,159,138,140,111,128,119,25,251,157,252,
+150,251,164,248,148,130,155,136,171,162,141,25,248,100,10,248,96,253,212,
+135,133,5,159,76,80,152,90,27,251,128,56,251,22,251,20,251,11,218,37,247,
+46,247,28,232,237,247,78,247,0,31,184,120,184,117,181,117,195,247,3,24,97,
+160,96,160,96,158,8,252,23,251,141,21,82,99,185,191,202,183,191,247,0,175,
+185,130,125,189,31,251,38,59,97,95,74,27,14,247,194,55,10,14,247,194,55,10,
+176,248,174,63,29,247,194,55,10,251,73,248,155,83,29,247,194,55,10,251,78,
+247,235,74,10,247,194,55,10,251,69,248,118,37,10,247,127,110,10,247,127,111,
+10,247,192,28,6,203,37,10,247,147,249,179,247,91,21,247,236,7,191,156,188,
+159,177,157,8,248,99,10,35,248,227,247,33,10,101,112,88,116,89,122,8,248,
+19,251,41,252,50,7,63,71,169,247,24,247,71,29,247,60,53,247,80,162,167,142,
+145,169,30,251,196,7,14,247,127,28,5,80,248,0,10,247,37,10,83,60,251,22,207,
+10,35,241,247,205,29,247,127,115,10,252,160,247,42,7,247,188,247,66,247,11,
+247,2,144,30,14,247,127,28,5,80,247,95,10,252,240,35,7,186,129,161,136,153,
+121,128,114,25,38,251,116,51,251,66,55,251,38,8,109,161,120,181,215,26,248,
+40,247,147,10,252,77,7,251,64,233,48,247,21,107,30,251,13,251,74,251,11,251,
+28,251,35,251,44,8,248,54,10,248,58,248,43,10,252,225,6,217,237,213,239,228,
+247,39,238,143,247,48,194,232,184,8,247,70,4,71,92,37,101,69,129,207,247,
+14,217,247,41,233,247,82,8,14,248,171,28,4,128,22,177,90,7,92,77,165,160,
+126,31,124,163,131,183,227,26,247,50,7,248,44,155,247,70,247,18,247,208,26,
+247,85,7,247,70,174,206,247,17,30,164,49,7,251,78,70,92,251,208,252,14,46,
+47,251,200,126,31,249,23,7,220,149,189,154,162,30,172,166,179,155,192,27,
+188,175,252,217,103,188,6,186,189,120,107,164,31,161,115,139,104,46,26,253,
+23,7,251,199,153,47,231,248,13,26,247,208,70,186,251,78,30,49,114,6,247,17,
+174,72,251,70,31,251,85,7,251,207,247,69,251,18,248,43,122,30,251,50,7,55,
+131,88,123,120,30,104,112,102,125,83,27,90,101,6,14,247,129,248,211,248,48,
+21,251,17,65,204,247,120,247,104,251,27,194,251,40,31,67,51,6,199,167,99,
+58,31,251,34,7,251,103,247,33,251,15,247,217,30,251,44,247,149,29,247,44,
+7,247,217,247,34,247,14,247,104,31,247,34,7,220,167,179,199,30,227,67,7,251,
+40,251,27,84,251,104,251,121,64,75,251,17,31,248,86,247,146,10,14,252,186,
+248,240,249,164,21,247,97,47,7,123,37,5,126,137,124,121,127,27,251,123,6,
+247,242,248,95,5,206,252,177,251,80,235,7,148,233,5,149,141,149,156,151,27,
+247,95,6,251,234,252,87,5,59,7,14,251,75,84,10,249,157,28,5,115,33,10,251,
+75,84,10,249,175,250,252,48,29,251,75,84,10,248,223,28,5,57,42,10,251,75,
+84,10,249,175,251,232,74,10,251,75,84,10,248,223,70,29,251,75,28,5,51,251,
+197,21,208,90,195,74,176,30,251,108,251,79,5,109,108,197,212,31,248,179,251,
+33,7,248,150,29,251,244,206,29,249,113,251,130,7,251,41,223,53,247,105,239,
+247,27,209,237,30,14,252,172,249,245,248,238,21,180,107,173,97,161,30,251,
+32,251,4,5,119,119,174,183,31,247,217,47,7,122,35,5,127,136,124,122,128,27,
+251,121,247,82,10,248,112,251,35,7,50,194,87,247,30,204,227,181,198,30,14,
+251,75,250,64,251,130,21,248,218,251,33,7,248,150,29,251,244,206,29,249,113,
+251,91,7,66,108,81,108,30,251,107,247,79,5,74,102,90,83,70,26,41,247,27,69,
+239,247,105,223,225,247,41,30,14,251,75,250,64,22,247,236,248,7,29,247,126,
+247,226,5,247,86,247,13,251,1,6,247,109,247,201,5,247,190,10,251,107,251,
+199,5,251,98,251,13,247,14,6,251,117,251,214,5,251,25,7,14,251,75,250,64,
+22,247,195,251,23,7,102,251,25,5,119,133,118,110,121,27,251,244,6,247,66,
+247,140,5,132,165,219,121,168,27,247,31,213,247,7,247,33,174,31,251,3,6,84,
+133,98,96,94,27,108,111,143,151,120,31,247,152,248,3,5,247,6,253,209,251,
+189,247,27,7,164,247,30,5,157,141,155,164,160,27,247,201,6,251,97,251,185,
+5,145,112,60,155,110,27,251,31,63,251,4,251,34,104,31,247,3,6,195,145,182,
+182,182,27,172,165,135,126,158,31,251,107,251,199,5,251,25,7,14,251,53,250,
+150,247,95,21,247,6,251,0,201,251,1,251,70,67,251,7,251,35,90,30,251,27,206,
+29,248,45,7,125,63,131,63,130,74,247,28,110,24,147,199,151,233,164,231,8,
+243,6,247,23,247,58,151,247,83,31,251,62,143,21,100,133,92,251,31,30,94,6,
+217,173,170,198,217,27,164,161,110,117,31,14,252,157,249,47,250,31,21,207,
+69,176,68,251,8,92,70,54,107,30,52,247,82,10,247,158,7,130,93,133,94,134,
+100,227,121,24,144,175,147,196,155,194,8,207,6,224,247,0,146,247,7,31,251,
+3,141,21,116,135,111,49,30,110,6,185,161,159,175,190,27,155,153,121,126,31,
+14,251,75,247,66,10,249,101,7,151,121,147,115,90,26,62,107,63,94,89,30,225,
+6,239,217,215,247,26,221,26,187,133,187,117,164,30,252,225,6,14,251,75,248,
+182,22,248,35,29,248,76,252,172,206,29,7,14,251,75,247,66,10,205,7,247,89,
+247,52,252,109,247,220,247,208,29,251,54,248,14,199,251,11,31,14,251,187,
+247,186,252,145,21,248,6,247,17,247,72,247,38,247,62,26,247,11,74,247,11,
+251,123,100,103,137,135,105,30,247,241,248,77,5,247,33,7,102,64,251,6,109,
+67,27,251,27,78,247,16,247,5,247,5,207,243,247,9,151,168,137,138,147,31,251,
+101,7,119,168,177,129,176,27,218,217,183,226,247,35,251,36,211,251,101,251,
+114,251,93,251,32,251,116,251,130,247,51,55,247,107,130,31,251,229,252,66,
+5,251,36,7,138,7,158,218,234,166,247,14,27,244,214,90,58,39,39,62,251,61,
+63,31,14,251,96,250,44,22,247,201,251,34,7,104,251,80,5,135,137,139,135,127,
+27,252,5,6,248,185,249,164,5,241,253,197,251,180,247,33,7,170,247,62,5,143,
+141,143,149,30,247,232,6,252,186,253,169,5,39,7,14,140,84,29,249,250,28,7,
+3,33,10,140,84,29,250,12,28,5,248,48,29,140,84,29,249,60,28,6,201,42,10,140,
+84,29,250,12,251,232,74,10,140,84,29,249,60,70,29,140,250,83,249,37,21,247,
+23,251,37,7,247,182,248,101,247,21,10,251,179,252,97,5,251,126,251,23,247,
+44,6,251,225,252,172,5,251,13,250,162,247,230,10,247,222,248,166,5,14,140,
+247,56,29,250,5,7,152,119,146,120,87,26,58,111,38,93,85,30,225,6,247,1,227,
+223,247,44,233,26,205,133,170,117,162,30,253,131,6,14,140,247,56,29,248,170,
+7,247,97,247,18,251,17,251,187,153,31,247,41,248,183,253,81,6,14,140,215,
+247,13,21,251,13,215,7,247,149,247,113,252,109,247,216,247,208,29,251,154,
+248,37,199,251,11,31,249,72,250,233,247,21,10,14,32,250,97,250,188,21,57,
+251,112,40,128,251,44,27,251,28,94,224,227,247,1,209,179,186,185,177,125,
+91,171,31,160,251,13,5,247,50,247,132,6,171,47,48,164,251,1,27,251,95,251,
+70,251,6,251,81,251,52,232,251,24,247,158,186,185,143,146,184,31,252,90,252,
+183,5,251,22,7,222,247,66,247,97,212,247,21,27,247,2,169,101,88,73,65,61,
+39,90,31,251,39,7,247,131,224,247,118,247,26,247,63,26,237,59,244,251,109,
+69,78,130,127,87,30,248,47,248,123,5,14,140,203,29,97,126,10,97,126,10,252,
+80,249,83,249,194,21,245,251,8,247,4,251,56,30,247,135,247,188,5,195,252,
+230,251,166,233,7,148,247,1,5,150,141,151,154,152,27,247,168,6,251,94,251,
+143,174,107,5,139,145,149,185,242,180,74,45,43,73,251,29,39,103,82,160,146,
+111,30,94,247,29,5,146,125,120,147,115,27,98,83,121,70,58,247,27,48,247,65,
+247,97,247,61,247,48,247,49,31,14,97,129,29,251,68,28,5,150,49,10,97,212,
+29,251,98,251,46,84,51,151,151,96,30,71,247,121,5,150,117,110,153,102,27,
+76,51,108,251,6,31,252,46,248,85,10,239,248,12,29,247,123,7,90,239,246,106,
+247,31,27,247,207,247,152,247,128,247,154,31,14,97,217,10,39,115,51,92,75,
+30,247,11,46,251,2,243,251,101,27,251,7,251,41,39,251,7,251,82,247,39,55,
+247,158,217,221,164,165,219,31,160,106,159,107,160,110,247,16,209,24,121,
+167,121,166,120,166,8,247,44,222,247,4,247,32,247,80,26,252,119,251,234,21,
+123,98,92,116,84,27,42,251,37,172,217,190,194,188,190,247,17,225,53,53,207,
+31,14,251,39,250,103,250,29,21,233,254,37,252,94,247,37,7,151,247,74,5,157,
+141,160,164,157,27,248,60,6,251,226,252,15,191,76,5,190,202,209,180,184,27,
+208,201,96,79,31,251,64,252,142,41,251,121,26,251,105,247,41,65,247,71,247,
+172,247,40,241,247,23,211,94,190,69,120,74,117,133,127,30,79,251,58,5,106,
+113,92,121,73,27,45,116,214,184,31,247,79,248,154,180,247,168,26,247,64,45,
+211,251,72,155,30,14,97,250,160,250,123,21,254,37,45,6,248,9,252,129,5,251,
+144,251,70,251,121,251,68,251,154,247,152,251,110,247,207,247,158,247,99,
+247,43,247,28,247,6,53,170,76,102,110,125,128,117,31,71,251,121,5,127,96,
+51,104,84,27,251,46,37,247,101,247,52,247,48,202,247,20,247,50,211,147,123,
+139,31,194,192,251,203,248,54,5,248,60,6,159,159,114,121,140,31,153,251,74,
+5,247,37,6,14,62,250,203,251,200,21,216,95,193,51,30,251,41,251,38,5,127,
+93,96,134,85,27,251,29,251,42,247,42,247,39,247,35,247,8,247,27,247,132,31,
+246,241,252,80,247,204,247,159,247,131,5,170,200,137,248,69,10,217,185,247,
+3,247,48,251,100,207,251,135,31,252,117,252,81,248,32,251,165,5,251,167,251,
+50,251,80,251,75,251,172,247,190,251,22,247,167,247,165,247,59,188,247,10,
+31,14,251,102,250,10,249,153,21,247,73,251,83,209,251,114,251,14,251,13,126,
+77,251,51,30,251,187,247,19,7,165,247,65,5,176,177,206,153,220,27,221,229,
+96,45,251,26,76,251,22,251,174,251,20,31,251,19,7,222,165,221,169,215,174,
+8,232,129,173,71,251,1,26,251,24,251,33,251,73,252,0,251,62,30,251,20,7,248,
+14,247,0,248,67,247,121,247,188,26,247,37,251,11,214,251,50,165,30,247,44,
+235,241,247,15,247,52,26,14,252,216,251,154,249,77,21,201,236,225,183,242,
+27,229,207,103,43,251,30,251,29,251,8,251,199,56,31,251,7,7,247,19,168,247,
+25,177,247,10,188,8,213,120,184,93,45,26,251,48,251,37,251,0,252,6,51,30,
+251,4,7,247,225,186,248,112,247,25,247,188,26,247,18,33,228,251,25,162,30,
+247,4,213,213,233,247,11,26,247,39,251,32,214,251,86,251,22,251,48,106,74,
+251,10,30,14,247,34,122,10,14,241,28,4,128,248,58,29,254,133,248,26,10,248,
+114,6,251,232,251,241,210,72,5,150,151,167,148,193,27,247,24,246,61,251,90,
+251,109,51,251,9,251,86,137,31,43,138,46,172,85,172,94,247,175,24,114,154,
+102,157,98,137,8,248,26,29,247,151,247,53,247,216,247,115,251,77,247,64,251,
+183,31,248,47,248,55,5,14,251,18,250,121,247,5,21,247,58,251,54,247,95,251,
+125,30,247,235,248,97,5,220,253,220,252,63,247,11,7,152,247,84,5,156,140,
+158,163,156,27,248,51,6,251,188,252,45,187,89,5,144,143,157,149,193,27,247,
+38,216,251,17,251,40,251,43,251,23,251,103,251,35,88,76,168,151,99,31,79,
+247,110,119,151,109,152,106,138,25,81,61,109,251,0,251,20,247,81,251,12,247,
+138,247,181,247,132,247,108,247,141,31,14,247,34,122,10,251,81,248,249,49,
+10,247,26,28,4,156,248,58,29,254,173,251,0,6,248,64,252,255,5,251,183,251,
+94,251,184,251,115,251,226,247,191,251,163,247,254,247,199,247,128,247,54,
+247,64,247,37,42,178,63,96,107,123,124,114,31,64,251,185,5,123,89,60,100,
+75,27,251,70,251,56,247,165,247,95,247,90,235,247,70,247,75,198,164,128,131,
+150,31,199,205,252,6,248,185,5,248,154,6,161,163,106,117,140,31,155,251,150,
+5,247,40,6,14,145,250,253,247,136,21,216,55,216,251,10,136,30,251,21,251,
+158,5,127,93,96,134,85,27,251,51,251,10,247,22,247,39,247,35,245,247,7,247,
+132,31,246,247,14,252,40,247,194,247,109,247,92,5,170,247,3,127,248,69,10,
+227,195,247,3,247,48,251,150,207,251,135,31,252,117,252,42,247,248,251,155,
+5,251,136,251,41,251,80,251,75,251,172,247,190,251,12,247,167,247,180,247,
+94,247,43,247,18,31,14,72,250,127,250,189,21,247,101,251,109,247,25,251,143,
+251,32,251,30,123,53,251,75,30,251,204,247,41,7,172,247,79,5,206,191,200,
+155,247,9,27,246,234,58,251,38,251,61,251,61,251,62,251,149,48,31,251,33,
+7,244,175,233,176,223,177,8,247,25,132,181,251,25,251,8,26,251,82,251,143,
+251,104,251,240,33,248,145,10,247,141,247,195,26,247,61,251,28,247,12,251,
+78,178,30,247,78,247,4,237,247,18,247,52,26,14,72,247,13,250,220,21,217,247,
+30,247,8,186,247,5,27,247,27,204,78,251,16,251,96,251,107,251,38,251,224,
+251,5,31,251,49,7,247,39,189,247,17,187,245,187,8,247,24,132,208,47,251,35,
+26,251,50,251,40,251,95,252,87,251,29,248,145,10,247,135,247,231,26,247,86,
+251,30,225,251,67,153,30,247,59,247,2,217,247,13,247,53,26,247,113,251,90,
+236,251,117,251,42,251,57,97,63,251,9,30,14,251,98,223,10,252,95,241,29,248,
+64,248,161,29,252,186,248,226,28,5,115,21,247,35,251,21,229,251,64,251,1,
+251,23,108,33,86,184,126,168,170,165,150,139,30,186,243,5,153,160,153,139,
+166,27,223,174,51,70,251,68,251,122,75,139,31,251,168,7,122,127,131,123,137,
+30,52,133,5,75,248,44,203,7,53,145,5,123,141,126,147,156,26,247,150,7,139,
+247,126,184,247,103,26,14,251,213,249,185,249,89,21,247,60,251,15,247,39,
+251,195,251,83,251,14,35,42,45,206,86,221,172,176,155,139,30,216,247,99,5,
+151,152,157,148,168,27,206,170,69,251,33,251,40,251,2,67,251,28,107,31,251,
+222,7,123,131,130,123,30,139,75,135,88,137,30,43,248,187,235,7,92,141,73,
+143,139,26,121,133,148,155,31,247,191,7,247,29,186,247,11,205,247,62,26,14,
+251,39,250,91,250,142,21,247,105,251,77,247,68,251,187,251,127,251,68,251,
+29,38,74,200,39,229,203,208,177,139,30,195,247,107,5,166,174,171,141,150,
+27,243,141,207,39,251,62,26,251,91,251,83,35,251,21,96,30,252,158,7,116,131,
+129,112,248,118,10,251,9,150,5,112,141,131,147,164,26,248,119,7,247,70,219,
+247,42,221,247,115,26,14,251,98,223,10,38,251,103,251,21,247,103,251,121,
+241,29,247,121,247,105,247,21,251,105,209,248,161,29,251,98,250,31,28,4,154,
+21,247,179,29,252,64,241,29,248,95,247,62,29,30,14,252,176,153,29,252,186,
+153,29,251,98,250,44,248,27,21,247,21,251,103,240,247,62,29,247,179,29,69,
+251,105,251,21,247,105,251,121,241,29,247,121,7,14,251,98,248,93,10,248,55,
+7,166,157,155,166,141,30,247,23,150,5,245,253,7,33,7,247,23,128,5,166,137,
+157,123,112,26,252,86,227,29,251,98,248,93,10,208,247,105,247,21,251,105,
+247,122,7,165,157,156,166,141,30,247,23,151,5,243,253,7,35,7,247,23,127,5,
+166,137,157,122,113,26,251,122,251,103,251,21,247,103,39,227,29,251,51,250,
+99,247,100,21,243,68,201,61,117,116,140,129,121,30,251,3,251,152,5,251,41,
+103,251,23,247,11,247,32,26,247,19,223,158,247,12,214,30,247,1,207,105,247,
+34,211,194,8,244,220,247,21,159,247,100,26,247,33,251,86,247,35,251,146,251,
+126,251,63,53,251,36,38,196,92,217,165,179,141,148,157,30,224,247,116,5,246,
+170,247,36,83,251,26,26,251,49,251,13,134,62,81,30,70,87,168,251,37,49,91,
+8,251,40,60,251,0,82,251,84,26,251,114,247,159,251,15,247,112,247,117,247,
+80,225,247,47,30,14,247,18,249,52,250,71,21,251,39,251,133,251,69,251,29,
+34,247,32,251,65,247,61,251,31,31,50,251,12,251,11,78,104,43,189,247,69,32,
+27,61,96,99,78,47,231,66,244,231,247,55,221,247,3,247,47,31,251,4,247,41,
+247,52,56,235,27,247,40,200,247,4,199,195,110,179,59,31,251,16,212,251,39,
+38,27,98,40,208,228,36,31,247,57,247,28,247,26,247,30,244,26,247,29,251,134,
+247,69,251,39,30,14,251,182,248,97,28,5,65,21,38,251,58,38,61,79,236,40,247,
+8,60,31,88,56,58,104,115,73,173,240,66,27,85,110,116,104,87,202,97,211,202,
+247,4,186,202,245,31,75,241,247,2,92,205,27,241,180,203,173,171,119,162,84,
+31,54,189,55,70,27,111,71,178,190,69,31,247,5,217,230,218,199,26,217,251,
+57,240,38,30,14,248,197,28,6,119,243,21,251,2,48,180,204,76,31,182,225,163,
+239,226,26,247,21,78,184,71,75,75,90,251,17,46,154,35,184,54,30,96,94,85,
+113,78,27,72,79,167,187,97,31,183,223,167,239,230,26,247,21,76,184,75,71,
+74,84,251,11,46,155,35,174,54,30,96,94,86,113,89,27,76,81,173,191,93,31,187,
+223,163,237,222,26,247,4,84,201,66,66,80,80,251,14,55,159,41,178,53,30,78,
+76,52,96,33,27,153,251,2,5,247,17,236,190,211,211,31,65,194,213,88,234,27,
+228,217,182,205,200,31,73,192,215,96,244,27,233,219,186,211,201,31,67,205,
+239,92,247,36,27,251,171,248,86,21,89,129,91,122,99,30,119,182,130,186,187,
+26,223,154,158,153,153,152,120,55,30,252,90,138,21,90,128,94,119,98,30,125,
+180,130,184,188,26,217,148,165,157,158,147,111,63,30,252,90,133,21,98,130,
+96,121,98,30,121,178,130,182,182,26,210,152,178,156,156,146,103,65,30,14,
+251,56,248,80,247,25,21,248,152,251,25,253,29,248,133,7,247,11,187,186,247,
+11,31,249,129,251,25,253,102,7,99,119,119,99,30,251,98,247,10,21,247,25,6,
+138,248,133,5,247,11,93,187,251,11,30,252,134,254,39,247,25,249,162,247,230,
+6,179,159,119,99,31,14,248,4,28,4,126,247,115,21,91,67,66,108,43,27,251,132,
+32,247,35,247,103,98,31,164,194,181,157,142,147,246,251,67,145,27,145,247,
+171,247,26,139,31,244,251,26,5,247,118,212,247,20,247,84,247,109,26,247,87,
+251,42,247,34,251,199,150,30,251,95,146,251,60,141,251,25,142,8,158,140,157,
+158,26,247,95,251,17,185,251,9,251,55,251,22,63,251,48,251,76,213,62,247,
+139,112,30,129,43,130,37,36,26,90,140,90,141,91,30,72,104,85,110,119,127,
+202,35,24,151,143,174,154,184,159,8,251,141,176,247,3,251,85,247,206,27,247,
+96,247,52,240,247,4,178,31,253,57,248,247,21,202,144,205,144,204,30,138,179,
+181,139,185,27,248,230,225,62,251,26,40,82,68,124,124,48,247,33,139,31,251,
+153,251,33,5,105,177,41,247,43,136,26,137,251,6,79,251,21,71,30,136,181,138,
+183,185,26,251,201,248,173,21,169,164,171,179,188,168,115,40,30,124,138,124,
+124,26,36,152,100,169,202,26,14,249,16,204,22,247,168,6,249,100,247,27,248,
+94,247,252,195,30,109,254,242,247,115,247,7,110,250,125,5,247,244,75,247,
+25,252,92,253,92,26,247,167,6,249,197,251,198,248,143,252,94,185,30,135,247,
+60,251,41,93,135,251,16,5,252,86,81,251,216,252,141,253,185,26,14,252,45,
+249,113,110,21,247,124,39,247,88,251,134,251,133,36,251,88,251,124,251,121,
+248,160,29,247,121,248,4,29,247,1,145,247,140,247,35,247,36,145,251,140,251,
+1,30,14,252,53,249,109,28,4,172,213,29,252,45,248,254,252,76,21,202,7,33,
+143,5,125,141,124,150,155,26,249,127,41,7,251,179,43,5,76,7,247,91,163,5,
+252,248,7,123,127,128,122,137,30,251,6,135,5,76,7,14,252,45,249,103,252,76,
+21,247,133,53,7,114,251,0,5,252,15,6,247,157,247,52,247,88,247,25,247,68,
+26,247,39,251,25,233,251,60,251,9,251,100,98,251,47,86,173,102,205,180,188,
+161,139,30,247,58,7,147,170,149,148,176,27,237,205,63,43,251,108,251,228,
+251,82,32,57,31,37,7,14,152,28,4,143,248,185,21,247,23,251,119,7,221,239,
+186,244,247,8,26,247,138,251,97,247,44,251,152,251,70,251,214,77,247,253,
+29,144,194,27,247,48,237,251,9,251,54,33,94,36,71,45,31,252,162,251,23,248,
+54,6,251,54,251,60,251,97,251,25,47,61,8,251,62,250,148,248,90,29,247,67,
+247,7,247,47,245,247,13,246,8,14,249,49,28,6,229,115,29,251,214,28,4,159,
+247,68,10,247,133,250,140,213,29,252,45,249,103,251,97,21,247,74,251,117,
+158,106,137,30,176,143,247,80,174,247,47,26,247,40,251,50,206,251,37,251,
+58,251,33,66,36,80,186,110,194,162,165,141,154,164,30,247,43,7,139,184,154,
+164,237,211,69,61,251,9,251,5,105,41,126,129,139,141,125,30,46,7,139,192,
+146,180,247,15,202,67,61,43,55,61,47,104,107,153,148,110,30,96,247,31,5,145,
+125,118,143,117,27,98,81,123,71,248,13,10,252,45,249,113,251,103,21,241,33,
+248,148,251,38,7,252,70,252,143,5,32,248,112,29,241,21,251,173,6,247,173,
+247,214,5,14,252,45,249,113,250,138,21,239,33,248,150,251,38,7,252,70,252,
+144,5,33,248,112,29,239,21,251,173,6,247,173,247,216,5,14,152,172,10,14,152,
+172,10,247,161,251,71,247,42,29,152,249,82,247,48,248,33,10,248,64,253,75,
+21,247,48,251,59,220,10,14,152,249,82,247,48,248,33,10,248,94,253,75,21,247,
+48,251,89,220,10,247,161,251,76,247,42,29,252,45,249,107,251,54,21,247,36,
+251,27,237,248,122,29,247,29,252,210,252,66,7,139,246,157,229,247,23,246,
+74,251,3,82,79,251,17,251,47,126,84,147,139,30,96,247,40,5,147,114,119,141,
+123,27,75,104,96,102,35,247,34,81,248,75,29,252,45,249,107,250,187,21,247,
+35,251,27,238,248,122,29,247,27,252,210,252,66,7,139,246,159,229,247,23,246,
+71,251,0,80,79,251,15,251,47,126,84,147,139,30,96,247,39,5,145,114,119,144,
+123,27,75,104,96,102,32,247,34,84,248,75,29,144,250,179,250,162,21,247,228,
+254,134,35,7,247,16,129,5,169,135,154,116,123,26,252,59,7,248,79,247,51,251,
+97,251,76,251,37,57,251,59,251,75,89,72,140,151,103,31,58,247,114,5,147,125,
+87,151,112,27,51,78,79,60,251,38,247,84,43,247,140,248,32,247,93,247,101,
+247,170,247,194,251,189,247,76,251,201,31,247,166,7,155,154,166,169,30,247,
+179,6,158,162,115,118,142,31,164,251,66,5,14,251,74,250,2,249,96,21,247,175,
+253,208,43,7,233,133,5,160,163,118,113,31,251,199,7,247,151,247,96,84,251,
+93,251,45,251,13,92,67,108,100,145,150,111,31,251,3,247,50,5,141,132,97,146,
+121,27,78,86,82,72,251,9,247,62,85,247,110,247,166,247,105,247,36,247,95,
+247,133,251,161,247,2,251,158,31,247,67,7,152,151,158,162,30,247,157,6,165,
+150,121,118,142,31,165,251,18,5,14,252,45,249,113,251,35,78,10,252,45,249,
+113,250,203,21,247,9,47,247,25,251,78,251,5,47,78,139,30,165,247,51,232,238,
+247,86,151,197,135,24,233,7,251,237,143,251,121,251,60,251,213,248,63,29,
+247,17,247,82,30,251,80,102,21,35,92,45,44,251,8,92,247,29,247,7,139,135,
+188,248,154,10,63,251,1,30,14,138,248,243,227,21,251,44,51,247,74,247,209,
+247,180,183,247,230,248,30,247,61,31,109,247,19,5,252,56,251,8,251,181,252,
+29,252,8,26,252,44,247,99,251,137,247,216,247,199,247,113,247,137,247,171,
+247,104,251,55,247,91,251,205,182,30,130,115,125,44,130,125,8,247,30,95,210,
+251,24,251,64,26,251,96,87,251,72,251,59,30,14,238,250,50,248,88,21,251,66,
+57,251,78,251,69,251,89,39,247,132,247,117,136,30,136,247,141,200,247,200,
+248,45,247,58,119,247,19,24,252,170,251,12,251,96,251,229,252,8,26,252,4,
+247,120,251,135,247,235,248,2,247,94,247,135,247,161,247,104,251,32,247,50,
+251,218,203,30,130,115,125,44,130,125,8,247,51,78,189,44,251,64,26,14,252,
+45,249,111,247,189,21,227,253,62,251,154,231,7,160,247,7,5,248,21,6,252,68,
+253,79,5,247,60,176,6,14,252,45,249,111,28,5,242,21,225,253,62,251,152,231,
+7,160,247,4,5,248,21,6,252,68,253,76,5,247,60,176,6,14,252,45,249,113,251,
+105,21,247,50,251,56,182,105,151,30,204,168,237,182,247,8,26,247,38,248,152,
+10,251,78,38,235,74,192,120,30,74,121,251,13,102,251,25,26,251,31,247,33,
+34,247,87,247,70,247,64,219,247,60,30,251,90,248,27,21,67,102,86,110,115,
+30,41,180,34,180,237,26,204,197,193,208,225,195,65,63,30,157,252,70,21,59,
+61,94,57,43,59,219,235,221,203,182,155,160,30,221,104,247,66,96,251,11,26,
+14,252,45,249,113,250,134,21,247,51,251,56,180,105,152,30,204,169,237,182,
+247,7,26,247,40,248,152,10,251,79,37,235,75,192,121,30,74,121,251,13,102,
+251,25,26,251,32,247,33,35,247,87,247,70,247,64,219,247,58,30,251,90,248,
+29,21,65,102,88,110,112,30,41,180,34,182,238,26,204,197,190,208,225,195,68,
+63,30,157,252,72,21,59,61,96,57,43,59,219,235,221,203,182,155,159,30,221,
+102,247,66,98,251,12,26,14,252,45,249,113,166,21,247,135,251,23,247,25,251,
+115,251,72,251,44,251,16,251,85,251,7,231,251,27,247,81,247,6,229,203,139,
+30,113,251,52,45,43,251,85,124,248,93,29,247,216,26,251,82,184,21,139,143,
+90,133,83,30,139,85,115,64,251,11,84,212,247,1,243,186,234,233,247,7,188,
+251,30,251,6,30,14,252,45,249,113,28,4,225,151,29,238,248,1,250,46,21,247,
+66,221,247,78,247,69,247,89,239,251,132,251,117,142,30,142,251,141,38,251,
+200,252,45,251,58,159,251,19,24,248,170,247,12,247,136,247,229,248,8,26,248,
+4,251,120,247,135,251,235,252,2,251,94,251,135,251,161,251,160,247,115,251,
+121,248,39,247,33,30,148,163,161,242,148,153,8,251,173,89,43,247,12,247,64,
+26,14,138,248,220,250,36,21,247,44,227,251,54,251,209,251,180,65,251,214,
+252,30,251,61,31,169,251,19,5,248,56,247,8,247,211,248,13,248,8,26,248,44,
+251,99,247,117,251,216,251,199,251,113,251,137,251,171,251,172,247,112,251,
+136,247,251,247,27,30,148,163,153,234,148,153,8,251,116,92,51,247,50,247,
+64,26,247,96,191,247,72,247,59,30,14,252,36,248,21,28,5,52,21,237,197,42,
+251,82,251,65,90,251,85,251,148,37,31,159,63,5,247,165,209,247,99,247,118,
+247,115,26,247,137,251,26,247,27,251,103,251,91,251,36,251,39,251,59,251,
+60,247,35,251,39,247,125,220,30,145,154,148,196,145,147,8,251,38,111,82,234,
+242,26,247,14,173,247,0,247,1,30,14,249,49,105,10,14,250,63,28,4,219,28,5,
+143,21,251,41,6,253,205,28,250,113,5,247,41,6,247,44,165,10,28,7,180,251,
+77,216,10,252,116,252,55,247,38,29,14,249,49,105,10,28,6,86,251,217,89,29,
+249,49,105,10,28,6,20,251,193,78,10,249,49,28,5,105,247,99,29,247,26,165,
+10,28,6,78,247,39,247,149,10,14,249,49,28,5,154,247,99,29,224,165,10,28,6,
+78,251,26,151,29,249,49,28,5,203,28,5,143,150,29,28,6,178,251,217,89,29,249,
+49,28,5,169,28,5,143,247,68,10,247,71,116,10,250,173,252,199,89,29,249,49,
+28,5,147,247,99,29,247,109,249,208,247,151,29,251,62,239,21,251,175,6,247,
+175,247,226,5,28,5,72,254,107,89,29,249,49,28,5,147,247,99,29,247,99,177,
+29,250,101,252,195,78,10,253,145,248,15,243,10,253,117,247,227,28,5,250,21,
+209,91,168,79,80,89,109,70,30,213,252,125,5,211,6,209,251,62,21,199,82,176,
+89,90,81,106,75,67,203,110,182,197,188,183,196,30,14,253,117,247,225,193,
+247,21,29,253,117,247,225,28,5,19,247,21,29,158,250,150,247,4,10,252,144,
+250,222,247,17,29,14,252,221,248,113,28,5,245,21,231,78,229,251,7,251,7,80,
+49,47,30,247,25,253,148,5,223,6,14,252,221,248,103,28,4,201,21,231,88,229,
+251,7,251,7,90,49,47,30,247,15,253,48,5,223,6,14,252,174,248,107,249,31,247,
+35,10,253,7,248,88,247,137,247,67,10,248,143,247,203,10,253,6,239,10,253,
+135,28,5,19,247,51,29,253,6,247,15,10,253,6,247,15,10,252,51,250,186,247,
+35,29,253,6,242,10,251,53,248,82,249,242,21,35,197,43,210,247,42,26,153,141,
+147,139,30,247,15,6,139,180,174,219,26,229,75,194,53,251,11,72,39,251,3,251,
+227,247,228,48,139,30,248,131,215,21,139,251,88,211,247,86,26,174,247,15,
+7,139,179,190,193,26,235,72,198,55,251,17,80,251,2,251,7,251,209,247,227,
+42,139,30,14,251,53,145,10,252,245,248,8,29,247,13,253,9,21,251,13,248,21,
+5,251,78,6,251,13,252,21,5,14,252,245,248,8,29,14,253,184,208,29,253,184,
+208,29,253,184,208,29,253,48,248,112,252,191,247,8,29,253,48,248,112,249,
+30,247,8,29,253,48,248,79,113,247,7,10,253,48,248,79,28,4,155,247,7,10,251,
+179,249,207,252,42,21,218,251,183,28,6,102,247,183,216,253,41,28,248,254,
+7,247,12,28,6,181,21,247,22,28,249,154,251,22,6,14,251,179,249,117,252,44,
+21,28,7,4,253,40,62,247,182,28,249,154,251,182,58,7,248,176,28,6,183,21,28,
+249,154,251,22,28,6,102,7,14,252,25,247,92,28,5,120,21,254,224,226,250,137,
+247,205,226,7,14,252,194,248,14,10,252,25,247,92,28,5,120,21,52,247,205,254,
+137,226,250,224,7,14,252,194,248,15,29,252,25,248,236,251,114,21,226,251,
+205,28,4,213,52,28,250,212,7,14,252,194,248,16,29,252,25,248,236,251,114,
+21,28,5,44,52,28,251,43,251,205,52,7,14,252,194,248,15,10,251,151,248,66,
+239,21,248,236,164,249,40,248,56,248,136,30,64,229,5,252,117,252,92,251,31,
+252,230,253,130,26,254,224,247,142,7,14,251,151,248,14,29,251,151,248,66,
+28,9,196,21,251,142,28,251,80,6,253,130,247,31,252,230,248,117,252,92,30,
+214,229,5,252,56,248,136,114,249,40,248,236,26,14,251,151,248,136,254,74,
+21,247,142,250,224,6,249,130,251,31,248,230,252,117,248,92,30,64,49,5,248,
+56,252,136,164,253,40,252,236,26,14,251,151,247,104,10,251,151,248,136,28,
+5,70,21,252,236,114,253,40,252,56,252,136,30,214,49,5,248,117,248,92,247,
+31,248,230,249,130,26,28,4,176,251,142,7,14,251,151,248,66,254,74,21,28,10,
+160,247,212,247,22,252,206,28,244,222,7,14,251,151,248,14,29,251,151,249,
+130,252,86,21,247,22,251,212,28,11,4,251,142,28,244,122,7,14,251,151,249,
+130,254,74,21,28,11,34,252,206,251,22,247,212,28,245,96,7,14,251,151,247,
+104,10,251,151,249,130,252,86,21,28,11,134,251,142,28,244,252,251,212,251,
+22,7,14,200,249,130,249,80,21,249,130,174,247,192,247,222,30,219,247,42,49,
+6,252,126,251,7,252,36,253,130,31,28,249,92,247,142,7,14,200,248,136,28,7,
+68,21,253,130,114,251,207,251,222,30,49,251,42,229,6,247,222,164,251,207,
+253,130,31,252,166,247,142,248,206,7,248,202,73,248,17,251,135,247,45,30,
+247,135,247,44,205,248,17,248,203,26,249,160,251,142,7,14,200,247,104,10,
+200,249,130,28,9,196,21,251,142,28,248,248,6,253,130,247,7,252,36,248,126,
+30,229,247,42,59,6,251,222,104,247,192,249,130,31,14,200,248,136,254,74,21,
+247,142,28,6,164,6,249,130,251,7,248,36,252,126,30,49,251,42,219,6,247,222,
+174,251,192,253,130,31,14,200,249,130,28,10,40,21,251,142,253,160,6,252,203,
+205,252,17,247,135,251,44,30,251,135,251,45,73,252,17,252,202,26,252,206,
+247,142,248,166,7,249,130,164,247,207,247,222,30,229,247,42,49,6,251,222,
+114,247,207,249,130,31,14,200,248,136,249,130,21,253,130,104,251,192,251,
+222,30,59,251,42,229,6,248,126,247,7,248,36,249,130,31,28,7,8,251,142,7,14,
+253,116,247,201,248,100,29,14,252,72,248,245,248,100,29,251,27,22,28,7,155,
+251,57,28,248,101,7,14,251,228,189,248,235,21,249,133,247,36,253,133,6,252,
+56,4,249,133,247,36,253,133,6,248,95,254,31,248,143,29,14,251,26,247,104,
+29,251,26,247,104,29,251,26,118,224,21,221,57,247,51,247,50,5,253,69,247,
+67,249,244,7,247,156,247,155,5,254,251,247,67,28,5,22,7,247,133,247,133,57,
+221,251,51,251,51,5,249,72,251,67,253,247,7,251,156,251,155,5,250,254,251,
+67,28,250,231,7,14,249,239,28,4,139,249,254,247,228,10,251,241,252,237,247,
+228,29,249,74,22,247,250,29,14,249,239,28,4,139,247,165,247,228,29,251,241,
+248,237,247,228,10,249,74,22,247,251,29,14,249,239,248,114,247,44,21,221,
+57,247,105,247,105,5,249,245,247,19,253,118,6,247,36,247,35,5,248,230,247,
+19,252,103,6,247,35,247,35,5,247,216,247,19,251,89,6,247,25,247,24,57,221,
+251,107,251,106,5,253,247,251,19,249,120,6,251,35,251,35,5,252,233,251,19,
+248,106,6,251,36,251,35,5,251,218,251,19,247,91,6,14,249,239,28,6,82,22,243,
+29,249,239,248,96,10,28,4,164,247,162,21,243,29,249,239,249,8,251,4,21,237,
+83,245,247,80,5,126,189,194,132,199,27,249,1,247,5,252,252,6,99,102,143,146,
+105,31,248,147,250,32,5,247,108,247,5,251,45,6,205,247,8,39,192,44,251,61,
+5,251,231,6,252,21,251,74,251,185,251,172,251,95,234,251,101,247,92,39,31,
+251,61,248,148,21,247,154,247,58,247,90,247,172,30,247,162,6,252,126,253,
+250,5,251,37,213,58,247,43,247,77,26,14,249,239,250,175,22,242,29,249,239,
+248,96,10,249,1,247,162,21,242,29,249,239,248,158,251,4,21,237,83,233,247,
+60,5,247,229,6,248,21,247,74,247,185,247,171,247,94,44,247,101,251,90,240,
+31,239,247,69,39,192,32,251,82,5,153,88,83,146,79,27,253,1,251,5,248,252,
+6,179,177,135,131,174,31,252,147,254,31,5,251,110,251,5,247,47,6,250,31,248,
+208,21,251,155,251,58,251,88,251,172,30,251,160,6,248,125,249,248,5,247,36,
+64,220,251,43,251,75,26,14,253,132,247,163,252,226,21,249,72,34,253,72,7,
+14,253,132,247,163,250,46,21,249,72,34,253,72,7,14,251,93,250,248,247,185,
+29,251,93,28,4,250,21,49,191,253,101,28,249,203,229,82,5,14,251,183,251,212,
+21,229,196,253,101,28,6,53,49,87,5,14,251,243,249,142,250,111,21,251,36,6,
+252,254,28,250,133,5,247,36,6,247,77,248,55,247,87,252,55,5,247,36,6,251,
+161,248,215,5,14,252,153,247,16,29,252,153,247,16,29,252,153,247,16,29,28,
+11,91,28,16,0,248,84,29,28,240,0,251,95,7,14,28,19,91,28,24,0,248,84,29,28,
+232,0,251,95,7,14,249,181,28,7,203,248,84,29,28,248,48,251,95,7,14,252,153,
+247,16,29,253,104,248,58,49,248,163,29,253,104,248,58,250,254,248,163,29,
+252,4,251,130,21,247,5,252,95,251,5,7,14,251,142,248,81,21,247,22,253,77,
+251,22,7,14,248,81,4,247,22,28,251,43,251,22,7,14,253,43,248,162,247,65,29,
+251,227,247,65,29,253,41,248,164,28,5,115,33,10,251,160,28,5,115,33,10,252,
+243,248,218,28,5,37,21,123,10,14,252,243,248,218,28,5,37,21,123,10,14,251,
+79,248,218,28,5,37,21,111,29,14,251,114,250,91,28,5,115,63,29,251,114,250,
+91,250,30,63,29,112,28,5,115,63,29,247,125,248,218,28,5,37,21,248,201,29,
+249,33,248,218,28,5,37,21,123,10,248,56,22,248,201,29,253,43,248,162,247,
+78,29,251,227,247,78,29,252,59,248,162,249,19,52,29,253,43,248,162,250,252,
+52,29,252,33,250,252,52,29,252,243,184,28,5,37,21,167,29,14,251,79,184,28,
+5,37,21,248,195,10,251,114,250,91,249,19,46,10,251,95,250,252,46,10,247,125,
+184,28,5,37,21,167,29,248,56,22,248,195,10,253,40,248,165,251,156,21,251,
+96,247,185,5,251,13,6,251,96,251,185,5,247,14,6,247,34,247,99,247,35,251,
+99,5,14,251,142,252,140,48,29,252,129,249,76,252,140,48,29,251,142,250,252,
+48,29,251,169,252,95,62,10,251,169,250,252,62,10,251,169,28,4,186,21,247,
+76,33,247,42,251,108,251,107,35,251,42,251,76,30,245,6,247,15,166,235,184,
+229,27,232,233,94,251,15,165,31,66,72,42,10,252,184,249,21,250,252,62,10,
+250,50,28,6,105,21,247,68,251,4,251,214,235,252,121,27,252,124,251,215,47,
+251,72,251,13,31,213,71,5,247,25,237,247,250,168,248,28,27,248,25,248,6,110,
+251,25,234,31,14,28,6,199,4,247,70,7,252,144,251,201,41,251,66,251,7,31,215,
+73,5,247,25,237,248,3,166,248,27,27,14,28,6,105,4,247,66,251,7,251,201,237,
+252,144,27,251,70,7,248,25,248,5,112,251,25,237,31,14,230,28,4,225,248,69,
+21,247,64,251,69,251,129,212,251,87,27,251,86,251,129,66,251,64,251,70,31,
+238,251,5,5,247,7,247,68,247,118,167,247,0,27,247,0,247,118,111,251,7,247,
+69,31,14,251,169,251,17,58,10,251,169,28,5,182,58,10,251,169,28,5,182,66,
+10,251,74,194,42,10,251,142,28,5,85,21,253,44,6,36,113,45,91,46,27,49,43,
+187,242,112,31,33,6,251,56,243,251,45,247,107,247,31,232,202,228,188,30,248,
+232,6,14,252,184,249,21,251,60,58,10,250,50,252,76,247,1,29,250,50,28,7,65,
+247,1,29,250,72,28,6,12,21,253,207,248,87,5,251,134,6,253,207,252,87,5,247,
+112,6,249,108,247,187,249,108,251,187,5,14,252,129,249,76,247,103,10,251,
+142,247,103,10,251,142,28,5,199,49,10,251,68,28,5,119,21,247,58,252,111,7,
+46,123,120,55,72,31,251,85,251,226,5,239,6,247,177,247,163,5,14,251,68,28,
+6,29,21,36,6,251,176,251,163,5,252,93,251,58,248,109,6,231,156,158,223,206,
+31,14,28,250,61,28,4,176,21,248,232,6,50,188,232,76,247,31,27,247,107,243,
+247,45,247,56,31,33,6,36,112,43,91,49,27,46,45,187,242,113,31,253,44,6,14,
+251,68,250,252,21,247,58,252,95,7,251,177,247,163,5,39,6,247,85,251,226,5,
+55,206,155,120,232,27,14,251,68,250,252,21,251,87,247,226,5,223,72,122,158,
+47,27,252,109,251,58,248,93,6,247,176,251,163,5,14,251,3,28,5,246,21,251,
+21,6,251,111,251,97,251,87,247,54,5,163,108,102,168,99,27,104,98,123,100,
+114,31,251,113,251,247,5,247,21,6,247,113,247,97,247,87,251,54,5,113,169,
+182,114,172,27,168,186,154,177,164,31,14,251,3,250,252,21,251,113,247,247,
+5,178,114,92,153,110,27,106,96,114,113,109,31,251,87,251,54,251,115,247,97,
+5,251,19,6,247,113,251,246,5,100,164,180,122,174,27,179,176,168,163,170,31,
+247,87,247,54,247,111,251,97,5,14,252,56,249,149,147,38,10,251,130,74,29,
+251,135,249,10,21,251,3,6,83,133,98,96,96,251,13,96,238,251,0,27,251,29,65,
+251,7,247,188,10,247,4,247,36,174,31,14,251,130,28,5,172,38,10,253,79,250,
+230,21,241,247,25,5,117,185,187,120,206,27,247,31,233,247,5,247,33,174,31,
+251,3,6,86,133,68,96,96,27,101,108,144,147,110,31,222,247,1,55,201,38,251,
+24,5,162,90,92,160,73,27,251,29,45,248,116,29,208,182,184,27,178,171,133,
+130,168,31,52,251,5,5,14,249,239,199,29,249,239,199,29,251,17,28,5,167,90,
+10,251,17,251,145,90,10,253,15,28,4,191,247,229,29,247,122,248,29,247,229,
+29,247,59,67,38,10,250,163,28,7,46,21,248,148,10,252,125,251,54,247,30,252,
+120,247,187,10,248,124,247,54,251,30,248,117,248,144,29,14,28,7,26,4,174,
+251,55,251,54,174,251,135,247,187,10,27,247,141,247,55,103,104,247,57,31,
+14,254,163,28,6,131,21,105,247,51,247,51,106,247,128,248,144,29,248,148,10,
+27,251,135,251,55,173,173,251,53,31,14,252,107,28,7,3,21,251,33,104,251,5,
+65,251,31,33,237,96,251,13,26,94,96,100,84,133,30,251,3,7,247,33,174,247,
+5,213,247,29,247,0,43,182,247,13,26,182,182,180,192,145,30,14,253,68,28,5,
+243,21,40,251,172,5,247,87,6,83,251,52,5,247,32,6,238,247,172,5,251,87,6,
+195,247,52,5,14,251,208,251,174,21,34,181,251,44,251,4,149,118,247,76,137,
+5,251,39,247,111,21,67,224,68,54,198,251,72,5,163,6,247,60,251,60,21,251,
+46,247,4,122,122,196,251,70,247,1,110,5,251,93,247,155,21,251,45,247,5,36,
+97,201,46,247,78,141,5,165,103,21,121,156,251,45,251,4,143,251,4,247,2,168,
+5,14,252,98,252,226,247,34,10,253,71,248,21,247,175,247,34,10,251,193,250,
+252,21,251,97,247,93,247,93,247,95,5,251,76,6,251,3,251,3,251,1,247,3,5,251,
+78,6,247,95,251,95,251,93,251,93,5,247,74,6,247,3,247,1,247,3,251,1,5,14,
+251,147,251,66,21,71,6,61,121,78,110,79,27,80,118,156,188,119,31,71,6,90,
+117,116,122,82,27,80,77,168,217,121,31,69,6,251,9,207,45,247,33,209,179,166,
+173,164,30,105,162,180,112,210,27,247,31,207,233,247,9,31,14,251,147,252,
+21,21,247,9,71,233,251,31,68,98,112,102,116,30,176,114,99,166,69,27,251,33,
+71,45,251,9,31,209,6,217,157,201,165,198,27,196,162,125,90,161,31,207,6,188,
+159,160,153,198,27,199,200,113,61,157,31,14,252,129,249,76,251,232,74,10,
+251,142,251,232,74,10,252,129,249,76,28,4,176,74,10,251,142,28,4,176,74,10,
+249,76,253,95,247,142,10,249,76,28,6,114,247,142,10,237,251,232,247,142,10,
+137,28,5,185,21,247,57,28,251,88,251,57,7,14,247,95,28,5,112,247,110,29,237,
+247,110,29,251,94,251,232,21,247,57,253,172,251,57,7,249,172,251,157,21,247,
+57,253,172,251,57,7,14,237,28,4,176,248,34,29,28,5,112,247,157,247,142,10,
+251,141,250,14,249,175,21,247,57,253,220,251,57,7,249,220,247,167,21,247,
+57,253,220,251,57,7,14,252,153,248,240,248,224,21,247,109,252,172,251,109,
+7,248,172,252,42,248,162,10,252,240,248,178,157,247,238,10,252,240,248,178,
+28,4,214,247,238,10,249,239,28,6,102,249,117,247,116,29,28,4,204,252,8,247,
+116,29,249,179,250,92,21,223,55,187,57,74,85,112,70,103,30,188,108,170,196,
+173,139,181,141,25,187,140,183,115,99,34,251,26,103,85,26,45,198,221,7,196,
+247,40,182,245,26,251,33,252,46,21,209,66,69,7,14,249,239,28,6,102,249,203,
+247,116,29,28,4,204,251,162,247,116,29,28,4,204,251,162,247,116,29,14,249,
+162,248,30,248,113,21,251,15,248,166,251,247,247,13,247,247,248,166,247,15,
+252,166,247,246,251,13,251,246,7,252,166,249,85,21,251,14,28,4,157,247,14,
+7,14,251,133,247,24,10,251,133,28,5,59,37,10,252,94,70,29,252,94,28,5,57,
+42,10,253,240,247,171,28,5,59,42,10,252,76,251,191,58,29,252,76,28,5,119,
+79,10,253,254,247,207,28,6,63,79,10,254,166,251,95,249,152,21,247,97,200,
+247,17,247,73,247,27,26,247,212,10,37,57,32,98,30,14,252,207,247,200,251,
+17,119,29,252,235,251,17,119,29,251,231,28,5,106,85,29,14,252,41,251,17,21,
+63,70,105,85,91,31,193,92,69,173,62,27,248,6,10,216,209,173,192,186,31,86,
+187,208,105,215,27,248,83,10,31,247,34,138,251,8,247,8,251,35,27,251,150,
+251,155,21,69,136,83,85,69,27,69,80,196,211,209,198,198,209,211,196,80,67,
+31,247,23,22,146,139,145,138,145,30,202,148,194,188,203,27,211,195,81,68,
+140,31,67,82,82,67,75,84,187,202,130,30,140,144,139,145,144,26,14,252,110,
+252,203,247,97,29,253,10,248,105,22,247,48,29,253,12,248,103,249,88,21,247,
+48,29,252,110,28,4,140,247,97,29,252,110,251,238,220,29,253,10,248,105,248,
+5,247,36,29,253,10,248,105,250,201,247,36,29,252,110,28,5,105,220,29,252,
+180,231,28,4,133,21,251,93,247,28,251,28,247,199,56,30,247,1,7,251,88,214,
+90,232,203,26,195,158,196,185,151,30,247,63,6,139,166,176,176,26,209,71,199,
+251,15,251,28,251,26,42,251,45,30,14,253,6,229,249,200,21,251,48,247,12,50,
+247,130,89,30,226,7,251,52,191,119,202,174,26,171,156,170,174,149,30,247,
+14,6,139,160,173,182,26,189,99,189,251,8,251,4,34,59,251,4,30,14,252,192,
+248,189,28,4,163,21,247,3,29,253,150,4,247,3,29,14,253,17,248,99,249,230,
+21,247,14,29,252,186,4,247,14,29,14,252,68,28,5,131,43,29,252,170,252,138,
+248,162,29,252,170,250,252,248,162,29,252,31,252,138,247,204,29,252,31,250,
+252,247,204,29,252,241,248,177,55,247,128,29,253,167,251,160,21,251,5,247,
+25,251,35,247,5,247,35,247,25,247,5,251,25,247,35,251,5,251,35,7,14,253,71,
+248,134,248,79,247,241,10,251,85,247,9,247,85,7,14,252,241,248,177,28,4,112,
+247,128,29,252,44,251,130,21,247,5,252,15,251,5,247,25,251,53,247,5,247,53,
+7,14,251,231,249,119,248,250,21,247,36,253,10,251,36,247,137,252,43,247,34,
+248,43,7,14,252,44,252,35,21,247,2,251,25,247,56,251,5,251,56,251,25,251,
+2,7,14,251,231,249,119,247,99,21,247,31,251,135,248,48,251,34,252,48,251,
+137,251,31,7,14,252,90,252,158,21,248,33,251,5,251,35,251,66,251,5,247,66,
+251,33,7,14,252,90,252,17,21,247,5,251,66,247,35,251,5,252,33,247,5,247,33,
+7,14,252,98,248,254,248,52,21,247,33,252,2,247,140,251,35,253,13,247,35,247,
+136,7,14,251,171,248,184,247,87,21,218,251,247,248,107,61,252,186,7,14,252,
+25,252,198,248,73,10,252,213,248,150,250,105,248,73,10,253,15,247,227,250,
+107,21,247,68,249,67,251,68,6,251,81,252,82,21,193,184,184,195,193,96,188,
+83,83,94,90,85,83,186,94,193,31,14,252,140,177,28,4,114,21,247,16,251,16,
+248,121,248,123,251,17,247,14,5,252,83,251,71,21,176,99,205,139,178,179,176,
+178,144,204,99,180,100,177,71,137,102,100,98,101,141,74,178,100,8,14,252,
+50,184,28,4,213,21,251,67,249,67,247,67,7,252,82,247,81,21,85,184,94,195,
+193,188,182,195,196,90,184,85,83,94,94,82,30,14,251,237,184,250,186,21,249,
+132,248,104,251,63,251,188,252,217,6,14,114,250,238,28,5,20,21,247,12,254,
+188,252,66,247,10,247,202,247,174,251,202,247,10,247,202,7,14,114,248,204,
+250,234,21,247,202,251,10,251,202,251,174,247,202,251,10,252,66,250,188,247,
+12,7,14,114,248,62,29,247,11,7,14,114,248,62,29,247,198,251,10,251,79,7,14,
+251,115,250,69,250,79,248,23,29,247,1,254,79,248,23,29,14,251,236,89,10,251,
+191,251,254,67,29,252,41,251,148,21,196,133,213,251,56,251,1,72,78,49,100,
+30,223,6,147,182,247,50,179,47,70,251,58,147,251,7,39,247,7,172,55,49,251,
+7,184,251,1,26,53,247,60,110,247,19,30,164,7,251,21,164,110,175,180,223,247,
+9,123,237,247,13,251,9,112,203,207,247,56,126,247,11,26,14,251,238,252,70,
+247,237,10,251,238,250,182,247,237,10,251,238,252,70,21,247,201,251,5,251,
+89,251,170,247,89,251,5,251,201,7,14,253,98,248,107,251,158,21,247,158,57,
+251,76,251,199,247,76,57,251,158,7,14,252,9,252,209,21,248,84,252,85,252,
+84,7,247,242,237,21,251,144,247,144,247,144,6,14,253,192,248,13,249,117,21,
+61,182,5,57,121,124,37,49,27,74,126,207,218,31,247,87,7,59,180,251,154,251,
+64,182,53,247,93,247,27,5,251,60,7,49,209,43,237,247,48,173,247,33,233,158,
+30,14,252,66,247,87,28,5,10,224,10,28,251,67,77,29,252,66,247,87,250,93,224,
+10,254,16,77,29,252,66,247,87,249,26,224,10,252,205,77,29,252,66,247,87,247,
+215,224,10,251,138,77,29,252,66,247,87,22,247,211,10,247,89,29,251,223,247,
+49,28,5,46,172,29,28,251,31,77,29,251,223,247,49,250,120,172,29,254,43,77,
+29,251,223,247,49,249,44,172,29,252,223,77,29,251,223,247,49,247,224,172,
+29,251,147,77,29,251,223,247,49,22,247,126,10,247,89,29,252,66,103,10,28,
+4,189,191,10,252,66,103,10,250,16,191,10,252,66,103,10,248,205,191,10,252,
+66,103,10,247,138,191,10,252,66,103,10,62,191,10,251,223,106,10,28,4,225,
+132,29,251,223,106,10,250,43,132,29,251,223,106,10,248,223,132,29,251,223,
+106,10,247,147,132,29,251,223,106,10,62,132,29,248,195,250,95,28,5,122,21,
+139,44,136,42,252,29,251,209,251,210,252,27,252,29,247,209,251,209,248,29,
+228,240,136,142,30,248,28,247,209,247,209,248,29,248,27,251,207,247,213,252,
+28,31,248,74,253,92,21,251,242,251,174,251,173,251,240,251,242,251,173,247,
+173,247,242,247,240,247,173,247,174,247,242,247,240,247,174,251,174,251,240,
+30,14,251,96,250,25,248,150,21,253,188,248,40,5,253,188,7,14,251,57,248,102,
+10,28,6,33,251,18,28,249,223,247,89,10,247,109,249,228,248,58,29,251,184,
+254,79,6,251,150,248,81,5,251,149,6,248,205,254,21,5,247,88,6,248,195,250,
+21,5,251,153,6,251,148,252,93,5,14,252,125,249,9,250,87,21,251,109,248,152,
+251,15,252,152,251,109,6,247,170,251,171,5,14,251,57,249,220,249,216,21,247,
+213,29,28,249,223,247,18,28,6,33,7,247,62,252,58,5,14,252,125,249,9,28,4,
+176,21,251,171,247,171,251,170,251,171,5,247,109,252,152,247,15,248,152,6,
+14,252,65,251,207,21,251,61,247,61,251,60,251,61,5,247,9,251,148,242,247,
+148,6,14,251,57,248,102,10,28,5,76,247,123,29,28,250,180,247,89,10,251,57,
+250,128,252,107,21,247,19,254,108,251,19,7,249,200,249,236,21,44,176,251,
+62,252,58,5,28,4,197,247,123,29,28,251,59,247,89,10,249,239,28,7,123,248,
+187,21,247,19,28,249,223,7,247,132,10,14,251,168,251,66,21,252,146,211,6,
+248,150,10,248,146,7,14,251,168,251,66,21,253,73,6,247,75,251,45,5,213,248,
+146,7,14,85,28,4,111,251,250,21,247,15,254,54,7,247,132,29,14,249,239,247,
+203,29,28,249,223,251,19,28,6,33,248,160,10,248,30,29,252,146,60,248,146,
+7,14,252,45,251,217,21,247,72,247,43,5,253,70,60,248,146,6,14,250,61,253,
+223,21,248,56,29,28,249,124,251,15,28,6,132,6,252,42,251,55,174,48,5,14,249,
+239,247,203,29,28,250,180,6,247,132,10,28,5,76,248,160,10,248,30,29,252,13,
+211,7,248,150,10,248,13,7,14,249,162,28,4,254,250,104,21,251,57,251,219,5,
+253,160,6,247,132,29,249,98,248,59,10,249,35,247,15,252,229,6,247,29,247,
+164,5,14,249,162,250,44,250,104,21,251,57,251,219,5,253,7,251,15,248,201,
+248,59,10,249,188,6,252,42,251,55,174,48,248,212,247,141,5,248,56,29,253,
+126,6,247,29,247,164,5,14,251,57,248,96,29,28,5,97,42,28,250,8,7,251,35,251,
+103,251,35,247,103,5,28,5,248,42,28,250,159,248,44,29,14,251,57,250,87,249,
+220,21,247,234,10,28,250,159,236,28,5,248,248,140,10,28,250,8,236,28,5,97,
+7,247,8,251,77,5,14,251,57,248,96,29,249,249,7,247,8,251,77,234,197,247,234,
+10,253,249,248,44,29,239,247,249,21,251,35,251,103,251,35,247,103,5,28,4,
+147,248,140,10,14,249,212,28,7,174,248,11,21,235,28,250,8,7,251,103,247,35,
+247,103,247,36,5,28,5,248,235,28,250,160,247,129,10,14,249,212,247,207,10,
+28,250,160,43,28,5,248,6,247,103,251,36,251,103,251,35,5,28,250,8,43,28,5,
+96,6,251,76,251,9,196,45,5,14,249,239,247,207,10,253,248,247,129,10,249,248,
+6,251,76,251,9,196,45,5,248,126,248,86,21,251,103,251,35,5,28,251,108,6,251,
+103,247,35,247,103,247,36,5,28,4,148,6,14,249,239,28,6,166,168,21,254,234,
+250,234,248,54,251,70,180,231,252,241,247,131,41,41,247,132,252,240,231,180,
+251,70,248,54,250,234,254,234,5,14,249,239,28,6,164,176,21,251,132,248,240,
+47,98,247,70,252,54,254,234,250,234,49,49,250,234,254,234,252,54,247,70,98,
+47,248,241,251,131,5,14,249,239,28,6,164,28,4,170,21,41,237,252,241,251,131,
+180,47,248,54,247,70,254,234,254,234,229,49,250,234,250,234,251,70,252,54,
+231,98,5,14,249,239,28,6,166,28,4,178,21,49,229,254,234,254,234,247,70,248,
+54,47,180,251,132,252,240,237,41,248,241,247,131,98,231,252,54,251,70,5,14,
+248,219,28,5,215,28,6,205,21,253,186,253,162,251,57,253,195,125,59,146,194,
+175,248,9,251,173,247,186,251,52,251,52,24,247,123,252,24,200,251,91,171,
+251,143,230,101,24,139,248,30,250,63,249,14,248,109,30,251,48,247,151,235,
+247,212,139,26,14,251,106,249,252,28,6,51,21,47,6,251,185,253,39,251,184,
+249,39,5,46,6,247,232,253,117,5,229,6,14,253,82,248,72,251,24,21,93,6,251,
+39,251,221,251,38,247,221,5,93,6,247,62,252,4,5,184,6,14,251,106,249,252,
+249,230,247,128,10,253,82,248,72,252,136,21,251,62,248,4,5,94,6,251,62,252,
+4,5,185,6,247,38,247,221,247,39,251,221,5,14,40,250,111,250,9,247,171,29,
+254,175,28,6,24,21,61,7,250,9,251,175,5,217,7,253,171,247,136,249,171,247,
+135,5,217,7,14,251,47,253,151,247,171,29,253,24,248,129,252,119,21,178,7,
+252,31,247,14,248,31,247,14,5,178,7,252,78,251,34,5,100,7,14,251,57,250,74,
+251,183,21,247,74,7,253,74,249,77,249,74,249,74,5,247,76,7,254,0,254,2,5,
+14,40,250,111,28,4,143,247,25,29,251,58,28,5,201,247,25,29,251,47,247,170,
+29,14,253,24,248,129,251,234,21,178,7,252,78,247,34,5,100,7,248,31,251,14,
+252,31,251,14,5,100,7,14,251,57,250,74,248,224,21,254,0,250,2,5,251,76,7,
+249,74,253,74,253,74,253,77,5,251,74,7,14,252,179,247,170,29,28,6,94,87,247,
+128,10,252,204,98,21,247,232,253,117,5,229,6,247,232,249,117,5,46,6,251,184,
+253,39,251,185,249,39,5,72,252,39,247,25,29,249,162,28,5,147,248,56,21,247,
+139,247,138,139,248,34,251,139,247,141,251,138,247,138,252,35,141,251,140,
+251,140,251,140,251,141,141,252,34,247,138,251,138,247,3,251,0,247,29,77,
+247,32,128,8,251,229,251,242,32,247,242,251,161,247,5,247,161,247,243,246,
+251,243,247,227,7,247,34,150,247,32,201,247,2,247,2,8,70,208,21,251,101,251,
+101,251,229,141,251,99,247,99,251,100,247,101,139,247,229,247,100,247,98,
+247,101,247,101,247,227,139,247,101,251,101,247,99,251,98,139,251,231,251,
+99,251,99,8,14,249,162,28,7,15,250,76,21,122,247,83,141,194,152,247,135,251,
+134,125,84,137,251,83,157,133,80,24,109,247,75,74,122,247,86,27,252,57,252,
+57,5,233,251,2,251,34,193,251,48,27,251,240,251,174,251,174,251,240,251,241,
+247,174,251,174,247,240,247,241,247,174,247,174,247,241,247,45,83,247,33,
+49,246,31,248,58,248,59,5,251,86,157,205,169,251,76,30,252,59,252,148,21,
+251,186,251,130,251,130,251,186,251,186,251,130,247,130,247,186,247,186,247,
+130,247,130,247,186,247,186,247,130,251,130,251,186,30,14,252,25,249,104,
+247,253,21,247,14,251,25,239,251,8,52,54,109,81,56,30,250,42,35,28,249,176,
+7,243,184,247,23,222,247,34,247,10,8,247,18,244,244,222,247,22,26,251,112,
+135,21,141,72,102,69,88,77,78,62,56,68,85,88,8,248,44,7,212,183,193,174,203,
+27,210,188,91,69,141,31,14,251,206,249,129,247,189,21,247,114,7,251,24,101,
+5,247,244,7,247,24,177,5,247,113,7,251,24,102,5,248,71,48,252,99,7,251,73,
+88,5,248,73,46,252,99,7,251,20,103,5,251,112,7,247,20,174,5,251,243,7,251,
+20,102,5,251,111,7,247,20,175,5,252,74,232,248,99,7,247,73,191,5,252,74,230,
+248,99,7,48,247,87,21,251,73,88,5,247,244,7,247,73,191,5,14,253,119,248,53,
+250,251,191,29,253,119,248,53,251,83,191,29,253,119,247,69,250,251,125,10,
+253,119,247,69,251,83,125,10,253,119,248,53,250,50,21,209,251,253,69,7,247,
+253,247,93,191,29,253,119,248,53,251,83,21,208,251,43,7,251,23,104,166,232,
+232,174,168,247,23,31,247,43,210,251,36,6,251,57,56,87,251,33,251,33,222,
+89,247,57,31,247,36,251,91,21,208,252,8,68,7,14,253,119,248,41,250,49,21,
+209,252,8,69,7,247,36,247,94,125,10,253,119,248,36,252,28,21,208,252,3,70,
+7,247,36,247,93,125,10,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,249,162,14,249,239,14,253,76,14,252,174,14,253,241,14,252,
+168,14,251,96,14,251,57,14,253,76,14,76,14,253,57,14,28,251,132,14,249,162,
+28,5,88,250,196,21,251,44,44,251,2,78,70,30,251,34,251,52,72,64,131,251,78,
+8,96,6,147,247,51,178,247,24,228,247,39,8,180,209,193,247,16,244,26,247,93,
+251,20,213,34,251,20,77,67,79,30,84,203,68,94,26,82,94,109,103,111,56,167,
+247,22,247,41,247,20,247,31,247,125,247,109,247,50,251,11,251,89,30,251,169,
+254,111,21,66,81,99,88,81,82,180,211,204,194,186,199,194,193,94,72,30,249,
+250,249,47,21,254,100,250,100,254,99,254,100,250,99,254,99,5,14,252,194,248,
+14,10,252,194,248,16,29,252,194,248,15,29,252,194,248,15,10,196,248,135,249,
+154,21,120,125,162,153,137,31,120,247,31,5,251,19,252,137,247,19,6,158,247,
+31,5,154,141,153,161,158,27,247,140,6,248,98,29,248,137,248,68,10,253,37,
+248,236,21,252,23,247,40,7,171,247,62,5,159,144,153,157,157,27,249,12,248,
+58,10,248,23,6,253,239,28,251,88,21,248,151,10,251,41,252,70,250,210,248,
+70,251,41,6,248,149,10,14,106,172,250,123,164,247,242,172,6,252,109,163,7,
+30,163,99,99,89,135,4,63,12,9,247,7,10,247,164,11,247,7,155,12,12,247,164,
+160,12,13,140,12,14,28,4,165,21,187,19,2,162,2,0,1,0,8,0,11,0,41,0,49,0,101,
+0,104,0,107,0,125,0,133,0,163,0,166,0,181,0,188,0,214,1,8,1,74,1,91,1,94,
+1,101,1,114,1,122,1,130,1,135,1,230,2,13,2,22,2,25,2,28,2,33,2,41,2,74,2,
+81,2,227,2,234,3,14,3,20,3,23,3,35,3,39,3,52,3,75,3,92,3,95,3,113,3,214,3,
+223,4,37,4,73,4,131,4,149,4,152,4,208,4,214,4,222,4,241,4,254,5,10,5,14,5,
+59,5,68,5,105,5,120,5,145,5,153,5,171,5,244,6,30,6,44,6,168,7,36,7,79,7,85,
+7,205,7,214,7,219,7,249,8,28,8,143,8,146,8,151,8,182,8,195,8,211,8,225,8,
+236,8,244,9,4,9,10,9,17,9,23,9,105,9,134,9,149,9,185,9,188,9,206,9,209,9,
+217,10,52,10,90,10,112,10,210,10,215,10,219,11,56,11,59,11,67,11,77,11,156,
+11,165,11,191,11,224,11,237,12,69,12,77,12,95,12,182,12,211,13,43,13,78,13,
+93,13,109,13,128,13,195,13,214,13,219,14,20,14,36,14,44,14,57,14,65,14,145,
+14,161,14,167,14,177,14,195,14,218,15,34,15,56,15,128,15,167,15,244,15,247,
+15,255,16,25,16,99,16,139,16,214,16,231,17,14,17,48,17,122,17,195,17,240,
+17,248,18,18,18,86,18,111,18,173,18,178,18,183,18,215,19,29,19,97,19,119,
+19,132,19,199,20,11,20,20,20,79,20,88,20,97,20,122,20,140,20,151,20,178,20,
+230,21,28,21,61,21,82,21,127,21,132,21,154,21,164,21,203,21,232,22,6,22,11,
+22,35,22,89,22,103,22,158,22,163,22,217,22,255,23,9,23,15,23,20,23,29,23,
+81,23,94,23,145,23,162,23,188,23,204,23,219,23,254,24,46,24,55,24,66,24,99,
+24,103,24,121,24,132,24,141,24,188,24,234,24,241,25,32,25,39,25,49,25,95,
+25,139,25,151,25,156,25,168,25,174,25,184,25,229,25,240,25,247,26,35,26,53,
+26,78,26,98,26,104,26,117,26,139,26,153,26,158,26,175,26,187,26,195,26,237,
+26,247,27,6,27,13,27,31,27,36,27,75,27,83,27,122,27,142,27,155,27,170,27,
+196,27,205,27,219,27,228,27,236,27,251,28,22,28,46,28,55,28,70,28,93,28,97,
+28,102,28,139,28,158,28,194,28,216,28,233,28,240,28,248,29,4,29,24,29,59,
+29,94,29,106,29,120,29,129,29,134,29,141,29,146,29,157,29,166,29,184,29,216,
+29,248,30,24,30,35,30,62,30,66,30,76,30,94,30,104,30,135,30,166,30,192,30,
+198,30,209,30,227,30,243,31,3,31,10,31,18,31,48,31,72,31,83,31,105,31,130,
+31,158,31,175,31,189,31,196,31,225,31,236,32,7,32,12,32,17,32,26,32,37,32,
+46,32,57,32,73,32,89,32,105,32,113,32,118,32,130,32,138,32,149,32,154,32,
+167,32,189,32,216,32,234,33,5,33,32,33,59,33,65,33,69,33,94,33,120,33,135,
+33,161,33,187,33,198,33,212,33,233,33,242,34,2,34,8,34,15,34,30,34,45,34,
+49,34,67,34,92,34,102,34,115,34,134,34,155,34,180,34,188,34,213,34,238,35,
+7,35,32,35,43,35,68,35,73,35,84,35,92,35,102,35,126,35,135,35,140,35,152,
+35,176,35,189,35,213,35,237,36,5,36,27,36,32,36,46,36,55,36,60,36,67,36,90,
+36,113,36,136,36,155,36,177,36,200,36,223,36,246,36,250,37,16,37,38,37,60,
+37,75,37,91,37,113,37,120,37,133,37,141,37,154,37,164,37,174,37,179,37,188,
+37,205,37,226,37,231,37,240,37,244,38,7,38,18,38,38,38,58,38,71,38,81,38,
+97,38,103,38,123,38,143,38,161,38,169,38,177,38,185,38,197,38,209,38,220,
+38,227,38,235,38,254,39,17,39,22,39,41,39,60,39,65,39,84,39,93,39,112,39,
+119,39,138,39,157,39,176,39,195,39,212,39,229,39,238,40,0,40,18,40,36,40,
+54,40,72,40,78,40,96,40,113,40,131,40,149,40,167,40,185,40,203,40,214,40,
+225,40,236,40,242,41,3,41,20,41,28,41,45,41,62,41,79,41,92,41,109,41,126,
+41,138,41,143,41,160,41,175,41,190,41,205,41,214,41,223,41,239,41,251,42,
+0,42,16,42,22,42,38,42,54,42,70,42,86,42,94,42,110,42,119,42,127,42,143,42,
+159,42,169,42,179,42,189,42,195,42,205,42,215,42,222,42,230,42,238,42,246,
+43,5,43,20,43,26,43,41,43,56,43,71,43,86,43,101,43,116,43,124,43,132,43,147,
+43,162,43,175,43,188,43,202,43,216,43,230,43,244,44,2,44,16,44,22,44,36,44,
+50,44,64,44,78,44,92,44,106,44,120,44,134,44,146,44,150,44,159,44,168,44,
+177,44,186,44,195,44,204,44,213,44,222,44,231,44,237,44,242,44,255,45,12,
+45,17,45,30,45,43,45,56,45,69,45,82,45,95,45,108,45,121,45,134,45,147,45,
+156,45,169,45,182,45,195,45,206,45,213,45,220,45,225,45,233,45,245,46,1,46,
+13,46,25,46,37,46,49,46,61,46,73,46,85,46,97,46,109,46,121,46,133,46,145,
+46,157,46,169,46,181,46,193,46,205,46,215,46,225,46,233,46,241,46,249,47,
+1,47,9,47,17,47,25,47,33,47,41,47,49,47,54,47,65,47,76,47,87,47,98,47,109,
+47,120,47,131,47,142,47,153,47,164,47,175,47,186,47,197,47,208,47,219,47,
+230,47,241,47,252,48,7,48,18,48,27,48,36,48,45,48,54,48,63,48,68,48,73,48,
+78,48,83,48,87,48,90,48,96,48,103,48,114,48,120,48,129,48,140,48,149,48,159,
+48,165,48,172,48,178,48,188,48,191,48,200,48,204,48,207,48,215,48,233,48,
+239,48,242,49,1,49,5,49,11,49,20,49,28,49,34,49,42,49,55,49,65,49,72,49,84,
+49,91,28,4,139,22,131,10,11,112,29,14,28,4,117,247,245,29,251,109,252,162,
+251,103,248,162,247,233,29,248,1,254,33,120,69,80,251,25,247,31,29,11,176,
+29,251,222,131,103,29,11,250,242,249,220,21,247,13,251,158,7,247,111,10,251,
+105,247,73,61,210,122,31,234,29,8,247,85,127,247,189,217,247,166,26,223,98,
+211,139,30,251,121,251,44,247,92,29,223,253,209,247,75,10,11,56,10,14,60,
+29,14,28,5,184,248,106,10,180,10,247,142,28,4,190,6,248,105,29,11,175,10,
+251,198,141,154,10,11,28,4,182,22,235,7,76,145,5,114,141,117,160,164,26,248,
+154,75,29,252,117,247,44,10,63,133,5,43,7,11,245,10,14,237,10,248,31,253,
+94,247,70,10,248,15,249,37,5,11,28,4,205,22,134,10,11,28,6,168,248,139,10,
+252,29,43,7,214,10,247,115,253,107,5,247,120,6,247,166,250,13,5,11,21,251,
+173,247,202,5,190,94,110,153,84,27,51,110,80,90,112,162,96,170,123,31,247,
+221,251,73,5,251,189,22,251,170,247,202,5,190,92,110,153,84,27,51,110,80,
+90,112,164,248,128,29,28,5,72,250,140,21,247,25,55,245,38,68,55,107,38,82,
+184,82,139,30,247,66,6,44,65,47,49,92,30,247,46,59,251,50,235,251,115,27,
+247,98,10,248,82,29,212,128,209,119,200,31,247,37,203,244,247,11,247,27,26,
+252,161,252,156,154,10,11,178,10,247,212,254,189,5,247,86,6,247,214,28,5,
+6,5,11,204,10,14,28,4,242,22,108,29,11,28,5,117,22,243,7,251,38,152,127,10,
+7,11,28,6,57,22,235,71,29,11,28,5,127,249,82,159,10,11,248,142,67,10,11,28,
+5,201,248,106,10,243,252,183,35,7,194,135,203,135,139,26,188,134,141,123,
+127,117,251,165,252,200,24,251,187,248,200,129,159,147,157,182,144,25,139,
+199,143,198,143,30,243,253,54,35,7,247,54,126,248,134,254,47,110,86,114,85,
+88,88,25,251,111,246,5,53,75,96,65,98,26,82,225,59,247,33,247,75,247,13,247,
+13,247,44,214,30,248,142,250,141,5,11,21,217,75,203,61,62,75,75,61,62,203,
+75,216,217,203,203,216,30,252,66,22,217,75,203,61,61,76,75,61,62,202,75,217,
+217,203,203,216,30,11,28,4,170,22,235,81,10,7,11,66,10,14,139,29,14,28,5,
+78,168,10,250,224,22,235,73,10,7,11,21,247,77,33,247,41,251,108,251,107,35,
+251,41,251,77,30,245,6,247,15,166,235,182,229,27,232,233,96,251,15,165,31,
+14,28,7,6,22,88,10,11,28,7,131,22,248,11,251,41,7,106,251,105,5,124,137,122,
+115,123,27,252,68,248,158,247,119,6,156,157,119,124,141,31,157,251,33,5,247,
+19,248,117,251,19,6,121,251,31,5,125,137,123,116,120,27,251,119,248,117,248,
+9,6,159,149,121,119,143,31,168,251,62,5,247,40,247,219,28,251,79,35,6,240,
+129,157,136,162,119,126,119,25,253,31,254,222,251,17,124,5,35,248,83,243,
+7,251,9,150,121,141,130,157,152,162,25,247,94,247,234,5,248,89,251,234,6,
+120,114,115,111,137,30,32,130,5,35,7,247,52,249,7,21,252,13,6,248,13,249,
+10,5,11,68,29,162,248,36,52,29,21,251,1,6,251,15,113,45,94,46,27,49,43,184,
+247,15,112,31,33,6,251,76,243,251,42,247,107,247,108,245,247,42,247,76,30,
+11,28,5,78,69,10,11,69,29,14,247,226,10,247,9,28,250,178,21,194,29,11,22,
+71,10,11,247,194,10,250,178,240,10,254,178,247,171,10,11,28,4,154,250,82,
+21,214,29,247,154,247,167,243,247,242,31,251,198,129,247,93,29,11,236,10,
+252,139,43,7,247,0,125,247,195,252,58,247,27,10,11,228,29,14,168,249,33,21,
+249,163,247,25,253,163,6,28,5,98,55,159,10,14,28,7,168,28,5,0,21,226,10,252,
+119,7,71,158,49,225,125,159,34,247,50,188,247,54,251,47,247,47,8,186,90,63,
+168,32,27,33,32,80,71,92,170,92,215,77,31,247,99,223,221,37,139,251,33,194,
+251,7,25,176,57,188,67,200,105,55,122,74,98,110,94,251,172,252,80,24,251,
+26,128,5,35,248,50,213,7,247,197,248,105,156,161,204,156,160,149,25,252,68,
+7,247,46,10,11,108,10,247,133,28,6,240,83,29,21,247,6,47,247,27,251,78,251,
+5,47,76,139,30,165,247,52,232,239,247,86,151,197,133,24,233,7,251,237,144,
+251,121,251,60,251,214,248,63,29,247,19,247,83,30,251,80,102,21,34,92,43,
+44,251,8,92,247,31,247,7,139,135,186,248,154,10,65,251,0,30,14,21,235,68,
+215,34,68,71,102,57,106,153,106,166,115,30,247,21,6,73,73,76,60,116,30,57,
+7,247,49,170,247,25,237,247,34,26,14,35,7,247,31,124,5,172,135,147,129,112,
+26,251,254,100,252,62,82,251,25,30,116,88,127,71,112,123,251,68,247,25,24,
+47,61,47,71,63,244,51,216,247,99,244,213,247,76,227,31,202,247,27,184,247,
+253,248,166,26,11,7,251,13,149,251,207,248,167,248,198,10,247,117,252,15,
+5,55,11,160,29,14,21,205,69,200,61,69,66,74,79,30,247,0,55,5,125,127,67,80,
+53,27,39,86,190,161,122,31,247,1,221,5,203,61,202,71,68,65,82,67,251,19,247,
+52,251,7,247,84,247,87,247,50,247,15,247,13,30,14,250,64,22,87,29,11,28,4,
+135,248,197,179,29,11,247,230,10,249,81,250,250,247,21,10,253,82,254,252,
+5,251,13,7,11,247,58,29,247,141,251,21,251,137,247,55,29,11,235,7,65,247,
+173,10,248,197,98,29,7,11,251,160,59,10,21,231,10,227,178,118,226,27,154,
+156,140,140,157,31,233,145,225,196,182,178,8,251,110,4,231,10,229,175,116,
+229,27,153,154,140,140,155,31,233,146,228,196,182,179,8,14,28,6,229,22,235,
+97,10,7,14,5,251,125,6,252,95,28,250,250,251,7,122,5,35,248,77,243,7,251,
+7,154,125,141,116,159,147,160,25,247,5,247,209,5,248,74,6,11,162,10,252,228,
+35,7,244,228,10,254,178,175,29,7,11,250,42,247,171,21,112,10,90,247,35,235,
+120,247,19,27,247,242,247,28,247,13,247,75,31,11,28,4,168,22,235,99,10,11,
+248,42,10,247,115,29,30,247,45,10,248,132,10,30,166,37,5,11,7,247,30,29,252,
+166,43,7,213,247,22,29,253,64,7,108,122,123,111,30,251,114,6,109,124,155,
+170,31,249,64,247,59,10,252,148,43,7,215,133,5,164,137,157,118,115,26,253,
+64,7,108,125,123,110,30,251,113,6,108,125,155,170,31,249,64,247,215,10,252,
+169,247,10,10,11,28,5,233,248,0,10,7,33,247,70,29,250,178,247,174,10,245,
+149,5,114,10,161,136,162,123,112,26,254,178,247,2,29,248,131,248,199,227,
+10,245,247,205,29,105,29,247,195,247,8,10,253,80,7,181,29,7,11,28,4,109,248,
+130,21,247,96,57,247,56,251,44,229,30,235,247,64,49,191,37,251,75,5,160,81,
+74,149,65,27,251,209,251,115,251,85,251,227,251,91,218,251,42,247,28,51,31,
+42,251,64,229,82,240,247,74,5,115,204,211,126,219,27,248,82,29,31,252,42,
+247,254,21,251,220,252,218,5,119,211,133,223,213,26,247,68,180,247,119,247,
+76,194,180,121,106,172,30,239,251,252,21,251,75,98,251,115,251,78,76,94,166,
+180,104,30,247,223,248,232,5,168,59,149,43,57,26,11,21,247,219,251,46,247,
+202,252,60,251,251,251,142,251,128,251,235,80,30,52,6,81,99,163,178,117,31,
+247,36,247,187,5,190,88,96,152,65,27,47,46,52,251,71,251,57,247,18,251,8,
+247,62,31,247,0,6,138,128,139,128,127,26,252,26,247,122,251,204,248,95,247,
+235,247,119,247,57,139,30,247,117,7,139,251,90,251,70,251,164,251,208,251,
+38,247,110,247,198,30,250,56,6,251,233,247,17,21,252,213,6,247,69,247,3,247,
+128,247,91,247,52,246,251,63,251,72,30,14,7,247,148,247,19,247,1,247,4,172,
+186,124,139,30,221,251,86,5,139,172,116,174,198,186,215,206,247,17,251,95,
+230,251,70,251,230,251,23,251,148,251,128,30,11,247,85,10,247,157,11,21,138,
+247,52,251,5,189,251,35,158,8,224,158,231,209,247,3,26,247,17,45,223,251,
+59,251,131,42,251,76,251,61,30,253,113,7,128,129,122,123,138,30,77,132,5,
+81,248,1,197,7,60,146,5,130,128,150,157,31,249,161,7,247,15,171,246,239,198,
+179,79,65,251,3,119,72,251,26,140,30,137,119,139,114,123,26,247,76,142,181,
+56,251,33,26,251,52,76,112,74,115,95,148,160,96,30,64,7,122,175,191,131,181,
+27,247,38,247,55,204,247,114,137,31,14,28,5,147,28,5,143,120,10,11,247,85,
+10,63,11,28,7,4,22,243,7,251,9,248,80,10,250,178,7,155,10,254,199,7,112,117,
+123,116,137,30,39,128,5,35,11,247,157,10,252,230,35,7,243,228,10,78,7,252,
+160,253,9,5,249,70,133,29,235,7,248,160,249,9,5,253,105,247,216,10,7,11,28,
+5,215,249,230,21,247,248,251,158,247,128,252,83,252,82,251,158,251,128,251,
+248,251,222,247,172,251,86,247,140,124,30,251,19,251,211,7,89,51,176,242,
+31,96,251,216,248,212,247,252,6,251,124,211,251,41,247,64,247,136,26,247,
+162,247,84,247,163,247,189,247,187,247,87,251,163,251,162,251,136,251,42,
+251,64,251,123,67,30,251,252,248,211,247,216,96,7,36,53,102,88,30,251,211,
+247,19,6,247,139,154,247,173,247,86,247,222,26,14,111,10,14,115,10,35,7,11,
+156,29,251,30,43,80,251,1,121,251,13,155,156,104,30,121,149,114,149,133,172,
+112,247,35,24,251,12,251,162,6,11,28,4,119,241,21,143,10,247,55,248,45,29,
+14,243,252,231,35,7,245,228,10,252,64,252,199,247,42,10,11,28,5,80,22,247,
+33,10,83,58,251,20,207,10,11,126,29,247,89,247,70,229,247,52,31,11,28,4,117,
+22,235,124,29,11,7,44,247,173,10,249,80,7,247,82,29,252,177,157,10,11,22,
+243,124,10,7,11,247,172,10,231,165,10,11,43,7,247,57,10,11,28,4,168,248,58,
+29,254,173,248,26,10,248,154,6,252,6,252,185,200,72,5,148,147,167,150,197,
+27,247,75,235,251,60,251,90,251,95,251,56,251,175,251,70,75,60,178,155,89,
+31,64,247,185,114,154,102,157,98,137,25,248,26,29,247,191,247,183,247,226,
+247,115,251,94,247,164,251,183,31,248,64,248,255,5,11,186,77,182,55,53,61,
+67,139,30,251,119,252,137,5,247,60,6,247,240,248,64,5,149,151,150,157,164,
+26,11,230,29,252,236,35,7,247,21,120,248,19,247,5,10,11,21,247,85,194,205,
+247,17,247,17,84,205,251,85,31,251,36,70,247,49,6,247,23,168,100,56,56,110,
+100,251,23,31,251,49,70,6,14,129,29,14,252,66,249,66,139,10,248,152,6,247,
+2,10,254,178,248,187,29,11,130,29,14,164,29,194,247,199,29,6,11,21,197,7,
+69,149,251,99,247,156,247,70,247,93,213,147,5,196,251,138,82,7,180,137,154,
+137,143,127,131,130,25,251,1,251,10,47,247,10,133,148,141,151,151,141,25,
+180,141,5,196,251,220,82,7,209,131,247,91,251,144,251,83,251,105,57,129,5,
+81,247,152,197,7,94,143,125,141,135,149,145,147,25,247,13,247,25,241,251,
+25,147,131,248,103,29,248,17,10,252,82,248,158,247,135,6,247,108,10,251,135,
+248,117,248,17,248,18,29,254,169,35,6,247,5,247,247,29,251,5,128,5,35,7,11,
+250,214,250,148,21,247,242,254,165,247,193,10,254,178,247,120,10,248,90,246,
+10,11,28,4,205,249,66,21,248,58,251,191,247,191,252,56,251,105,251,62,78,
+118,88,30,251,250,247,52,7,186,247,133,141,152,159,161,149,143,25,149,162,
+186,156,188,27,247,236,247,19,251,189,251,179,251,246,251,66,251,122,251,
+170,87,66,162,149,116,31,127,145,125,160,145,26,93,247,121,5,251,49,251,240,
+6,78,247,80,225,114,247,50,27,248,41,247,208,247,183,248,64,31,11,235,136,
+29,7,11,247,150,29,14,21,175,73,169,77,30,57,251,6,116,147,114,171,108,230,
+25,65,247,108,247,205,248,100,5,251,88,6,251,76,251,163,96,247,18,5,238,105,
+76,200,45,27,251,37,60,76,77,102,207,110,200,31,221,247,11,161,132,165,107,
+169,48,25,217,251,115,251,203,252,94,5,247,88,6,247,72,247,160,180,251,14,
+5,42,172,204,75,234,27,247,37,216,196,202,31,14,141,10,14,188,10,123,247,
+5,247,238,29,247,123,10,252,77,252,173,5,82,11,247,113,29,252,157,43,7,211,
+247,48,10,253,40,7,139,251,3,113,58,251,44,119,247,27,207,30,247,53,7,247,
+189,251,42,247,91,251,199,47,251,17,92,32,72,165,49,247,11,30,247,64,247,
+94,5,201,150,159,34,251,29,26,252,23,7,251,15,178,251,91,247,134,247,53,247,
+89,247,19,139,30,11,21,247,251,164,10,248,76,29,11,247,30,29,28,251,117,121,
+10,249,64,7,163,151,162,172,30,247,140,248,19,10,65,133,5,43,11,114,141,119,
+160,164,26,248,188,247,25,10,248,255,32,7,247,223,29,28,251,101,114,29,252,
+119,247,44,10,74,133,5,43,11,6,247,50,29,251,26,6,251,122,253,80,5,11,250,
+76,28,4,188,21,247,3,72,239,251,11,53,75,84,49,59,180,104,139,30,247,15,6,
+139,141,131,125,26,251,42,43,68,35,81,30,173,63,5,139,247,228,230,247,227,
+26,252,99,125,21,247,7,80,247,2,251,17,55,72,80,43,85,180,88,139,30,247,14,
+104,6,251,86,251,88,67,139,30,172,61,5,139,247,227,236,247,209,26,14,7,139,
+251,5,157,241,10,11,247,76,251,41,247,17,251,105,168,183,10,211,247,95,104,
+251,109,11,28,5,215,22,170,7,49,251,13,165,246,31,250,179,7,247,8,225,182,
+247,17,30,170,28,250,72,108,7,247,19,221,96,251,8,31,254,179,7,251,5,251,
+11,119,49,30,108,249,8,170,7,49,251,10,161,247,3,31,250,179,7,247,8,241,150,
+235,30,247,120,6,235,241,128,251,8,31,254,179,7,32,251,11,113,49,30,108,7,
+14,248,153,34,7,251,211,36,5,55,247,41,251,222,7,139,251,2,247,201,10,247,
+64,247,36,139,30,251,11,11,28,5,35,249,60,21,248,7,251,148,247,246,252,89,
+251,232,251,54,251,107,139,30,251,105,7,229,211,247,76,247,85,247,163,27,
+247,150,235,251,181,251,183,31,254,33,75,6,251,203,247,41,251,230,248,54,
+248,42,247,158,247,206,248,35,30,251,234,251,42,21,251,57,137,38,251,136,
+251,90,27,251,48,37,247,45,247,64,31,223,7,11,247,227,10,251,47,32,251,21,
+63,139,30,248,7,248,134,29,235,253,87,7,123,125,127,122,248,64,29,125,248,
+138,29,213,247,184,29,247,27,29,69,241,35,247,19,248,38,29,30,247,88,10,247,
+60,10,28,251,145,155,29,247,187,7,139,217,118,220,11,21,251,75,98,251,115,
+251,78,251,82,102,247,130,247,68,247,110,10,11,166,160,155,163,142,30,247,
+9,149,5,243,252,218,82,7,251,178,254,1,251,181,250,1,5,196,252,224,35,7,247,
+7,247,247,29,251,7,128,5,35,248,109,243,7,251,2,247,105,29,250,191,7,248,
+39,28,251,53,5,247,50,6,248,47,28,4,211,5,11,235,7,53,246,29,28,5,86,161,
+10,251,11,7,247,95,247,144,29,11,43,7,160,10,11,5,55,247,23,253,66,247,148,
+29,249,33,7,139,192,172,247,4,247,19,189,46,39,30,252,129,7,114,118,118,114,
+137,30,76,133,5,43,248,128,235,7,75,246,29,249,33,7,139,215,172,227,247,27,
+182,46,39,30,11,247,207,29,136,162,123,247,4,29,28,4,110,247,221,29,11,195,
+29,251,207,247,217,10,11,247,44,29,251,222,7,139,251,5,164,241,10,11,196,
+10,248,123,247,60,29,11,21,247,162,251,69,247,128,251,213,251,97,251,21,55,
+106,72,30,251,47,7,159,163,247,27,219,247,19,27,247,83,247,13,251,44,251,
+131,251,146,251,28,251,19,251,17,123,133,139,141,123,31,247,119,7,160,108,
+116,161,55,27,64,67,80,47,251,23,247,31,44,247,109,247,183,247,130,247,114,
+247,213,31,14,226,29,247,240,6,200,251,83,53,164,251,47,247,242,29,11,248,
+240,247,38,29,11,247,180,29,251,166,251,220,5,94,11,247,5,29,252,201,250,
+119,248,34,10,117,141,141,104,247,80,29,11,247,227,29,118,28,251,18,247,17,
+10,240,213,30,216,247,0,174,247,38,247,41,26,14,21,247,177,251,66,247,119,
+251,240,251,154,251,62,251,13,139,30,248,155,29,247,91,247,6,251,31,251,115,
+30,253,49,89,6,251,131,247,6,251,120,247,216,247,203,247,97,247,120,247,201,
+30,251,187,251,27,21,251,21,90,251,46,251,44,251,13,92,244,247,25,30,184,
+7,11,247,218,29,251,85,251,10,247,44,247,132,248,76,10,31,247,136,10,247,
+152,29,11,21,197,7,84,248,137,29,249,200,72,7,251,99,77,5,88,235,251,87,7,
+139,67,152,90,251,95,251,37,251,11,251,103,251,64,237,251,19,247,54,235,234,
+213,149,157,30,69,7,247,13,4,139,84,117,92,251,7,82,225,247,21,247,19,196,
+239,247,17,178,192,121,139,30,14,249,82,248,187,248,33,10,248,94,253,75,21,
+247,48,251,89,248,22,29,251,105,89,32,251,36,85,84,155,169,80,247,164,29,
+247,131,247,81,30,11,205,229,21,108,209,247,19,55,247,99,27,247,211,247,68,
+247,128,247,160,247,216,251,127,247,113,251,185,251,107,251,31,45,251,23,
+47,210,77,213,225,162,164,157,167,31,247,122,7,156,147,141,153,27,247,17,
+247,27,251,19,251,146,251,132,251,10,251,44,251,85,251,17,251,27,219,160,
+112,31,11,179,29,14,247,86,29,248,82,29,30,11,249,240,28,5,72,21,247,112,
+29,82,48,107,44,32,247,100,10,250,68,7,247,78,161,232,10,11,21,247,204,72,
+65,247,30,57,27,86,101,32,110,110,139,121,162,31,161,151,214,174,27,198,247,
+20,251,168,251,8,145,31,139,86,251,10,60,26,60,166,84,176,176,160,212,202,
+202,115,247,15,139,30,177,247,3,247,83,247,155,247,11,26,36,6,251,26,45,251,
+59,91,251,25,30,14,28,7,166,248,106,10,243,252,89,35,7,247,23,126,168,135,
+143,117,135,122,25,251,97,253,213,251,189,250,117,5,248,55,29,163,164,141,
+247,124,29,11,250,107,250,113,21,251,37,247,19,251,175,251,0,5,94,7,247,175,
+40,5,251,89,248,81,21,251,21,247,49,251,27,251,49,247,4,251,173,5,185,6,73,
+74,21,184,7,251,183,247,0,251,29,251,19,247,29,251,17,5,248,107,251,174,21,
+251,6,247,252,5,93,6,251,6,251,252,11,247,47,10,254,178,247,122,10,250,47,
+7,249,70,254,207,5,11,251,27,150,251,173,248,80,112,184,74,180,55,156,25,
+198,173,189,211,177,221,193,247,7,139,247,33,223,241,247,96,55,24,217,201,
+168,186,186,26,11,7,247,181,29,252,17,249,5,21,251,37,78,251,5,251,126,131,
+96,141,139,30,248,123,7,248,50,10,213,253,19,248,62,10,11,30,247,115,217,
+225,247,29,247,11,26,247,95,251,91,247,37,251,182,251,52,38,108,51,251,72,
+30,251,209,247,50,7,180,247,84,141,147,166,182,147,148,25,159,157,172,178,
+245,27,223,247,54,74,251,79,251,72,251,43,61,251,17,124,115,141,143,84,31,
+251,45,7,139,237,157,194,11,250,209,21,43,6,133,49,5,114,137,118,116,114,
+27,253,254,35,6,241,251,191,5,223,247,21,249,21,6,139,174,61,53,26,251,66,
+251,19,125,39,30,253,15,32,6,241,251,193,5,223,247,25,248,165,6,247,101,247,
+17,209,247,125,247,42,251,30,247,66,139,31,247,5,6,11,21,247,21,251,52,248,
+87,35,7,251,206,37,5,55,247,38,251,157,251,70,251,21,247,70,252,90,247,91,
+29,240,213,30,216,247,0,174,247,38,247,41,26,247,240,7,14,205,29,248,228,
+247,61,29,11,247,82,29,252,177,43,7,223,247,22,29,251,52,7,251,13,87,100,
+57,57,76,189,247,2,30,11,248,132,29,127,151,155,31,247,208,7,247,68,34,172,
+251,45,251,34,251,47,83,49,88,198,145,139,30,247,29,247,9,6,139,162,143,174,
+247,0,158,72,91,137,30,92,7,252,3,66,98,83,251,2,26,40,217,80,233,247,11,
+247,7,215,139,30,155,77,5,11,247,202,29,247,246,247,60,29,252,228,205,29,
+248,151,7,248,102,247,38,247,31,247,171,31,11,21,193,94,248,122,10,184,182,
+192,30,126,253,137,21,248,193,70,7,251,95,77,5,88,233,252,144,7,139,143,251,
+54,98,78,30,251,23,247,13,5,94,135,98,104,96,26,77,203,107,210,238,210,176,
+196,186,30,195,204,163,230,231,26,14,21,247,249,29,14,250,128,196,29,11,247,
+218,206,247,103,247,181,247,232,26,248,33,251,173,247,222,252,62,248,81,10,
+252,41,247,119,251,144,247,222,80,30,11,21,248,76,251,251,247,248,252,70,
+252,74,251,246,251,250,252,74,252,77,247,248,251,248,248,68,248,76,247,249,
+247,248,248,77,30,40,22,252,19,251,203,251,210,252,21,252,19,251,201,247,
+208,248,17,248,31,247,207,247,201,248,15,248,19,247,203,251,205,252,23,30,
+11,21,231,7,127,122,51,91,57,27,251,17,62,230,247,37,247,44,227,214,221,149,
+143,139,137,149,31,251,29,7,129,158,153,124,194,27,188,186,176,195,216,49,
+197,251,33,251,80,251,46,251,25,251,87,251,54,247,7,251,31,247,99,247,25,
+223,188,160,184,31,14,7,251,45,150,251,224,248,101,108,182,80,165,63,152,
+25,202,173,205,211,239,29,11,247,91,10,253,69,204,29,248,210,247,216,29,11,
+21,237,7,139,42,71,251,27,251,21,65,221,247,28,30,248,71,167,6,247,36,65,
+247,29,251,101,251,95,251,25,251,29,251,77,251,64,247,5,251,27,247,119,247,
+62,247,1,211,139,30,251,81,247,207,21,251,132,6,217,170,229,240,216,170,78,
+61,30,14,247,60,7,149,148,208,149,174,27,217,182,41,57,251,31,86,87,251,44,
+31,41,7,194,137,5,247,50,135,170,80,63,26,51,100,45,251,15,251,1,251,8,184,
+247,33,251,46,30,251,54,7,251,19,247,27,247,23,106,247,3,27,247,154,247,54,
+240,247,107,11,247,86,10,35,75,208,235,30,11,249,218,250,13,21,190,98,223,
+251,56,251,144,251,89,251,48,251,131,30,252,118,7,121,111,119,122,136,30,
+47,129,5,43,248,191,235,7,37,149,5,122,142,113,159,157,26,248,118,7,247,115,
+165,192,217,137,30,248,109,10,11,247,63,10,251,88,141,247,97,10,247,114,29,
+248,202,247,221,10,11,21,251,62,6,251,70,251,85,251,70,247,85,5,251,62,6,
+247,119,251,243,5,247,134,6,11,21,243,253,13,248,90,10,253,92,247,45,29,249,
+98,248,39,10,11,247,56,10,248,249,243,7,247,133,10,11,97,72,27,62,80,168,
+247,25,247,71,29,247,50,53,247,80,237,247,57,197,185,235,30,248,99,10,11,
+247,181,251,29,7,112,251,54,5,133,127,127,135,30,251,228,247,242,247,70,6,
+166,143,251,9,131,141,31,247,11,248,0,251,11,6,125,137,133,251,3,114,27,251,
+70,247,210,247,177,248,20,29,11,188,110,198,51,84,110,125,88,94,30,251,173,
+251,202,5,247,36,6,247,221,247,73,5,170,155,162,182,166,26,252,77,22,188,
+248,117,29,251,202,5,247,35,6,247,222,247,73,5,170,155,161,182,166,26,14,
+248,106,10,247,112,10,251,205,254,17,251,216,250,15,247,58,10,248,115,28,
+250,252,5,247,86,6,248,107,28,5,6,5,11,7,151,148,157,160,30,247,204,248,19,
+29,254,148,35,6,247,17,129,5,164,11,247,241,29,247,81,247,12,247,171,31,251,
+199,125,21,251,97,251,17,72,251,126,30,117,116,141,123,27,248,162,7,143,165,
+180,144,160,27,247,62,247,54,101,251,119,31,14,218,29,247,136,11,229,133,
+161,137,152,116,133,119,25,251,62,252,203,251,112,249,94,5,247,28,10,11,247,
+240,29,60,198,79,248,105,10,11,21,247,121,39,247,89,251,134,251,133,36,251,
+89,251,121,251,123,248,160,29,247,123,248,4,29,246,145,247,141,247,35,247,
+36,145,251,141,32,30,11,250,205,247,81,10,254,37,252,94,247,37,7,153,247,
+74,5,157,141,158,164,159,27,248,60,6,247,231,10,11,247,226,29,215,253,195,
+21,197,7,75,248,137,29,248,161,70,7,251,87,77,5,88,225,252,48,248,141,10,
+7,14,250,27,222,29,11,248,22,29,251,147,56,251,2,251,3,108,56,158,166,85,
+247,164,29,247,152,247,105,30,11,21,196,251,150,82,7,195,137,153,137,151,
+125,133,126,25,251,37,251,232,251,23,247,232,135,154,147,151,153,141,25,200,
+141,5,196,251,242,82,7,219,133,247,105,252,171,5,247,23,6,247,122,248,169,
+5,14,21,241,247,198,29,247,155,251,34,7,247,107,10,11,250,31,250,142,21,247,
+129,251,90,247,44,251,159,251,58,251,92,88,251,70,51,206,118,184,187,182,
+157,139,30,210,247,67,5,159,172,159,141,180,27,247,21,195,251,39,251,7,251,
+185,251,247,251,0,139,31,11,21,247,211,10,11,7,153,153,152,154,140,30,198,
+143,5,196,252,15,82,7,224,135,5,155,138,151,126,125,26,251,235,7,139,103,
+117,90,85,117,172,155,128,30,47,251,79,6,128,155,176,128,170,27,201,224,230,
+179,172,31,11,207,32,198,33,32,64,110,92,92,30,251,50,251,47,188,251,54,35,
+251,50,124,119,51,53,72,120,8,248,119,247,113,10,252,230,247,218,10,11,252,
+131,247,116,10,33,128,5,35,11,129,5,247,90,10,11,143,158,233,10,11,27,247,
+115,29,31,247,45,10,11,247,1,7,70,62,70,91,37,27,98,93,146,156,85,31,164,
+60,36,189,33,27,130,130,139,138,130,31,251,43,128,88,84,100,99,8,251,0,7,
+212,215,199,186,241,27,196,209,124,106,232,31,108,11,205,180,200,30,247,95,
+251,82,5,248,43,29,11,27,247,62,247,33,251,45,252,25,251,248,251,70,251,30,
+251,213,91,88,142,145,85,31,119,150,52,133,26,127,201,212,132,216,27,247,
+216,248,36,247,25,248,170,248,45,251,123,247,91,251,249,11,159,166,31,247,
+187,7,248,95,10,30,251,195,109,247,100,29,11,7,247,116,163,196,230,176,30,
+247,80,251,113,5,139,247,5,206,235,26,253,68,28,251,140,244,29,7,251,1,156,
+251,207,248,76,247,164,247,228,247,50,10,11,247,180,10,251,171,252,123,251,
+150,248,121,247,205,10,11,150,147,147,156,141,30,233,147,5,235,252,128,43,
+7,234,131,5,155,247,234,29,248,128,235,7,45,147,5,122,141,131,148,149,26,
+11,248,78,28,5,66,21,109,216,5,139,251,228,47,251,226,26,251,10,208,44,247,
+7,221,207,193,233,200,98,190,139,30,251,13,6,139,137,152,149,26,247,82,247,
+60,219,167,148,30,14,7,248,30,10,247,19,228,10,11,247,209,29,247,36,247,19,
+156,170,30,11,248,123,28,4,186,21,247,13,64,231,251,1,37,92,76,53,75,180,
+90,248,120,29,38,90,49,251,52,51,170,61,248,163,10,247,4,10,14,21,139,56,
+98,65,251,70,51,247,39,248,147,10,220,102,139,30,14,21,247,240,29,59,198,
+80,248,105,10,11,247,71,10,248,140,248,73,29,11,28,4,205,248,139,10,252,138,
+43,7,247,7,133,167,137,150,118,126,113,25,251,117,252,160,251,93,248,160,
+129,165,143,160,170,141,25,245,145,5,235,252,195,43,7,247,17,115,11,21,200,
+7,139,96,131,96,69,100,166,219,30,247,226,247,76,216,251,76,247,50,47,7,67,
+251,23,37,84,5,90,227,252,19,7,34,182,92,247,9,247,0,244,180,139,30,14,248,
+166,10,247,189,10,11,21,138,148,150,139,152,27,247,6,247,9,215,247,117,247,
+81,65,224,251,27,119,121,138,137,122,31,219,7,247,205,141,163,251,70,251,
+94,26,251,116,61,251,6,251,151,128,30,11,28,4,217,247,17,29,11,252,232,252,
+43,252,170,247,39,29,11,251,107,251,47,251,13,251,82,251,27,229,69,243,82,
+30,247,15,71,247,32,94,251,3,26,92,106,55,251,17,80,251,0,184,152,134,30,
+139,123,247,25,133,194,30,251,8,11,21,247,212,251,29,247,92,251,153,146,30,
+73,7,247,78,115,182,251,77,251,144,26,251,144,96,251,79,251,78,116,30,72,
+7,247,153,145,247,29,247,94,247,213,26,14,247,113,29,252,179,43,7,233,247,
+48,10,11,7,247,169,29,11,43,7,233,247,48,10,253,80,247,114,10,11,129,5,248,
+29,10,11,35,7,251,206,36,5,55,247,38,11,247,82,251,89,172,41,30,252,91,71,
+6,211,131,5,153,137,155,129,122,26,253,68,7,121,123,127,125,30,67,132,5,72,
+248,41,206,7,64,146,5,122,125,151,157,31,11,247,50,10,252,139,43,7,247,0,
+125,11,248,78,249,242,247,35,29,7,137,109,122,144,125,27,251,136,251,27,247,
+45,247,138,247,95,241,247,86,247,163,153,188,131,123,186,31,149,135,152,126,
+141,133,170,251,60,24,247,39,247,165,6,11,21,250,52,35,7,251,206,37,5,55,
+247,38,253,228,247,91,29,11,247,29,10,252,228,35,7,244,129,5,163,136,160,
+123,112,26,254,170,7,112,118,121,115,30,11,247,30,29,252,166,43,7,213,247,
+22,29,253,64,7,114,120,117,113,30,11,247,29,29,248,115,11,5,248,55,10,141,
+149,147,156,27,248,88,6,11,248,109,29,248,24,201,7,69,248,79,10,247,189,248,
+2,251,189,248,109,29,7,11,43,21,247,217,253,1,251,2,248,128,247,72,29,11,
+251,207,247,36,10,7,247,13,100,247,93,251,134,251,52,251,90,251,19,139,30,
+11,247,216,29,247,31,247,203,6,247,137,29,11,251,185,251,246,247,49,10,11,
+251,117,6,251,121,253,90,251,52,248,199,133,161,153,160,162,141,25,227,145,
+5,235,252,161,43,7,247,13,127,247,157,254,15,5,247,115,6,247,127,249,107,
+11,35,247,105,29,250,178,247,60,29,11,247,176,247,23,251,176,247,155,251,
+34,7,247,219,10,11,247,107,10,247,69,10,11,249,133,251,140,21,247,23,251,
+182,247,5,7,248,95,10,188,29,11,243,247,37,10,11,21,222,222,251,27,247,27,
+247,25,247,25,56,222,251,25,251,25,251,26,247,26,56,56,247,27,251,26,251,
+29,251,28,222,56,247,28,247,28,5,14,247,67,10,249,87,247,203,10,21,216,75,
+203,61,62,75,75,62,61,203,75,216,217,203,203,217,30,252,66,22,216,75,203,
+61,61,76,75,62,61,202,75,217,217,203,203,217,30,14,247,161,29,252,209,35,
+7,225,129,5,162,134,161,125,112,26,252,74,7,11,247,58,29,248,5,251,21,252,
+1,247,55,29,11,125,248,38,10,139,251,85,219,251,160,247,182,10,30,11,250,
+134,249,76,21,247,195,254,109,251,195,247,7,7,248,157,29,247,63,253,111,6,
+247,159,29,11,247,142,29,252,35,247,162,29,11,248,64,7,247,220,10,252,234,
+35,7,246,129,5,11,247,195,247,222,10,223,145,5,11,7,114,119,118,114,137,30,
+11,248,37,29,248,61,10,252,199,251,17,76,248,113,10,11,247,158,10,248,230,
+243,7,35,247,70,29,248,68,7,159,129,203,122,155,117,247,197,252,105,24,65,
+11,243,252,111,247,193,10,253,199,7,252,226,250,48,5,194,252,142,35,7,247,
+3,228,10,11,133,5,164,137,159,118,115,26,11,247,232,29,247,72,247,113,247,
+54,251,113,247,220,29,11,247,235,10,251,56,251,90,251,35,247,90,126,153,143,
+160,162,141,25,198,145,5,235,11,248,60,29,14,7,247,55,10,11,250,103,21,247,
+158,251,9,247,54,251,125,251,126,251,11,251,54,251,158,251,158,247,11,251,
+56,247,126,247,125,247,9,247,56,247,158,30,11,21,207,86,192,72,71,86,86,71,
+72,192,85,207,206,192,193,206,30,14,251,168,47,41,251,50,99,105,141,144,93,
+30,144,114,146,69,144,118,193,128,189,135,181,140,8,247,132,145,247,152,247,
+53,248,0,26,11,250,240,250,105,21,248,29,254,187,35,7,247,7,247,11,10,251,
+7,128,5,35,11,233,247,48,10,253,80,247,114,10,248,169,235,7,65,246,29,11,
+133,156,141,248,9,10,11,247,174,29,213,145,5,235,11,247,21,32,7,251,195,35,
+5,55,247,27,11,7,251,7,247,105,29,248,131,247,179,247,15,251,179,248,109,
+247,172,29,11,7,112,118,123,117,137,30,38,128,5,35,248,200,243,7,251,8,150,
+5,116,141,121,155,166,26,247,240,7,133,189,176,141,174,27,11,21,247,81,251,
+13,247,23,251,111,251,99,251,37,251,9,251,93,251,86,247,31,251,9,247,95,247,
+113,247,21,247,19,247,74,30,11,249,251,247,12,10,252,7,7,247,201,29,11,5,
+113,141,120,158,166,26,28,5,86,247,165,29,11,250,35,250,9,21,247,102,10,11,
+21,247,252,10,11,247,254,10,247,42,6,11,241,248,86,10,11,5,252,13,7,247,134,
+10,248,70,7,11,247,146,7,247,108,29,251,146,11,247,7,228,10,252,72,251,105,
+251,15,247,105,252,131,247,193,29,11,7,34,102,62,45,30,251,19,247,111,5,59,
+70,65,47,251,46,247,39,82,247,107,247,85,247,37,247,82,247,99,31,11,252,138,
+254,87,5,247,177,6,247,236,249,42,247,68,252,67,5,251,51,205,213,42,247,37,
+27,247,119,209,199,247,37,11,21,251,25,251,15,53,251,1,251,0,251,11,241,247,
+23,141,30,215,176,184,165,178,30,242,129,247,183,118,251,35,26,11,247,140,
+247,147,29,251,167,7,251,51,11,247,3,155,247,138,205,247,168,26,247,183,251,
+187,188,251,44,30,253,60,35,6,247,1,247,239,10,11,247,92,10,14,21,139,39,
+94,51,248,114,29,30,11,133,5,154,137,154,130,122,26,253,12,7,123,124,129,
+124,138,30,11,188,21,247,68,251,70,248,112,10,11,6,247,240,248,94,5,207,252,
+175,251,82,234,7,148,234,5,150,151,154,153,30,247,92,6,251,232,252,86,5,59,
+11,7,235,105,247,109,251,140,251,52,251,97,251,31,139,30,184,102,84,233,251,
+48,27,251,51,251,68,251,17,139,31,11,7,112,116,123,115,137,30,251,1,128,5,
+35,248,243,243,7,251,5,247,70,29,248,78,180,7,11,247,151,247,103,29,11,247,
+169,29,251,238,7,37,64,76,55,11,233,247,48,10,251,181,251,76,251,11,247,76,
+251,184,247,114,10,11,248,8,10,247,68,251,80,24,139,247,19,184,247,4,26,14,
+7,251,62,248,58,44,102,247,150,252,234,5,247,32,6,14,164,136,159,123,112,
+26,11,21,247,203,7,247,137,29,11,21,251,183,251,25,43,251,119,30,126,133,
+141,115,27,249,107,7,139,198,151,188,247,85,241,251,25,251,113,30,11,53,251,
+66,125,247,19,239,30,249,15,248,35,10,252,165,7,251,101,209,251,17,247,125,
+11,139,251,77,164,251,31,247,181,10,30,11,252,56,21,248,56,7,37,153,5,102,
+145,129,164,172,26,28,4,112,247,113,10,11,235,7,65,247,173,10,247,137,7,174,
+204,104,125,150,31,139,247,31,251,99,186,68,30,71,11,21,251,0,112,251,27,
+251,13,251,17,115,247,35,243,246,165,247,29,247,13,247,13,168,251,35,34,30,
+14,251,209,251,115,251,85,251,227,251,216,247,107,251,89,247,203,11,7,247,
+231,10,251,52,37,251,121,251,46,84,51,11,26,253,228,247,130,10,11,28,4,115,
+248,146,21,247,185,251,103,247,88,252,7,30,252,138,43,6,238,131,5,155,137,
+149,131,128,26,11,247,190,10,252,160,253,130,5,251,25,11,251,17,21,251,62,
+6,251,70,251,84,251,70,247,84,5,251,62,6,247,119,251,242,5,247,134,6,14,249,
+130,248,57,29,21,247,124,10,11,248,3,29,248,222,248,36,10,11,247,219,10,247,
+196,10,248,104,29,30,11,248,98,29,248,117,248,68,10,11,5,247,98,211,180,213,
+247,236,29,30,14,247,68,180,247,119,247,76,247,80,180,251,129,251,66,30,11,
+161,71,43,180,251,21,27,251,142,251,95,251,5,251,137,11,243,252,94,35,7,247,
+2,124,170,135,141,117,135,122,25,11,248,39,10,243,149,5,243,11,7,247,159,
+29,11,235,7,49,145,5,114,141,116,160,164,26,11,7,112,119,123,114,137,30,11,
+247,192,10,249,5,243,7,247,255,29,11,7,247,138,29,11,248,86,29,252,242,35,
+7,247,3,247,239,10,11,7,112,116,123,115,137,30,251,3,128,5,35,249,9,243,7,
+251,25,247,70,29,11,7,112,116,113,117,137,30,251,5,128,5,35,248,247,243,7,
+251,5,162,5,116,143,115,151,166,26,11,247,116,10,251,5,128,5,35,248,109,243,
+7,251,6,247,105,29,11,248,17,248,90,5,205,146,217,145,139,26,243,252,105,
+35,7,247,8,129,5,154,141,122,131,133,31,11,39,125,42,251,71,30,125,94,141,
+129,27,248,42,7,159,197,141,153,27,247,25,176,51,251,17,31,11,89,7,251,135,
+251,21,5,207,53,251,25,200,53,27,251,228,251,168,251,195,252,91,252,9,247,
+105,11,247,153,10,248,192,11,247,144,29,14,21,251,232,249,117,5,49,6,251,
+232,253,117,5,232,6,247,184,249,39,247,185,253,39,5,14,6,247,76,247,9,82,
+233,253,15,252,44,5,53,7,249,15,252,43,196,233,251,76,247,9,5,11,7,116,119,
+120,116,138,248,48,29,140,121,161,164,26,11,27,251,228,251,139,251,91,251,
+215,251,210,247,137,251,101,247,220,247,107,247,52,209,141,147,31,11,248,
+58,247,62,102,233,252,234,251,150,5,251,31,7,248,234,251,150,176,233,252,
+58,247,62,5,11,251,7,247,105,29,250,215,247,172,29,11,112,114,123,117,248,
+28,10,114,141,119,155,166,26,11,112,116,123,115,137,30,251,5,128,5,35,249,
+7,243,7,251,21,247,70,29,11,153,147,137,156,27,247,202,10,11,248,166,10,142,
+30,247,17,149,5,243,253,13,248,90,10,11,250,111,247,163,29,11,248,110,10,
+248,160,6,11,251,254,21,139,247,25,75,201,247,21,237,203,247,0,11,235,252,
+34,43,7,225,133,162,137,155,116,131,119,25,11,248,34,29,14,248,106,10,243,
+252,107,35,7,247,8,228,10,253,90,7,251,113,11,5,35,249,19,7,248,70,247,173,
+247,125,248,105,31,251,222,117,21,252,74,251,117,251,5,11,7,248,155,10,252,
+24,247,219,29,11,248,130,10,241,147,5,235,252,187,248,113,29,11,7,166,161,
+153,162,144,30,225,149,5,243,252,210,35,7,244,228,10,11,247,44,10,53,133,
+5,43,248,169,235,7,57,145,5,112,141,121,160,164,26,11,21,225,253,46,251,152,
+229,7,160,247,5,5,248,11,6,252,58,253,70,5,247,56,176,6,11,21,247,200,29,
+108,139,30,11,25,251,66,247,25,5,80,113,79,90,63,26,40,137,242,74,219,27,
+219,206,174,194,196,31,11,35,7,251,206,35,5,55,247,38,28,250,54,7,112,119,
+122,114,135,30,38,133,5,43,7,11,248,114,6,181,174,174,181,181,104,174,97,
+31,252,114,6,97,104,104,97,97,174,104,181,31,11,150,147,147,156,141,30,237,
+147,5,235,252,144,43,7,247,1,131,5,155,137,147,131,128,26,11,247,220,10,252,
+234,35,7,246,228,10,11,248,220,21,251,144,83,57,66,63,69,221,247,144,247,
+144,209,219,215,212,195,59,251,144,30,11,243,247,160,29,11,112,116,123,117,
+137,30,32,128,5,35,11,248,105,29,243,149,5,243,11,7,65,246,29,249,80,247,
+215,10,11,7,129,129,130,123,137,30,40,131,5,43,248,148,7,247,238,247,118,
+247,62,247,232,31,11,247,217,29,248,198,248,159,10,11,22,247,175,29,11,247,
+70,251,128,248,138,10,30,248,124,10,11,88,88,8,251,33,7,247,45,247,41,246,
+203,247,228,251,11,247,25,92,186,110,247,54,11,114,118,118,114,137,248,48,
+29,121,162,164,31,11,251,35,251,85,46,180,251,9,247,21,247,3,174,245,178,
+153,31,251,46,247,16,5,193,11,152,133,149,118,133,26,178,251,121,5,247,28,
+247,240,6,200,251,55,66,164,251,24,27,11,251,98,251,93,251,7,247,32,247,115,
+30,249,52,188,6,247,130,251,9,247,121,251,213,11,21,61,127,104,39,43,27,77,
+88,182,178,210,227,182,225,168,167,127,133,164,31,14,248,88,29,7,11,21,251,
+41,6,254,29,28,250,113,5,247,41,6,11,145,5,115,141,118,160,164,26,11,7,248,
+105,29,11,247,206,29,247,43,96,11,21,251,119,86,251,99,251,68,251,74,90,247,
+89,247,92,247,114,212,247,101,247,91,11,26,247,109,251,132,159,251,2,30,252,
+165,43,6,236,131,5,155,137,147,131,128,26,11,27,251,119,72,82,251,40,55,245,
+82,233,31,233,247,72,5,147,148,147,144,147,27,11,37,147,5,120,141,121,152,
+157,26,249,107,248,130,10,241,147,5,235,11,28,5,57,248,106,10,243,252,88,
+35,7,247,17,131,5,157,145,114,114,125,31,11,252,23,251,166,251,60,252,23,
+251,156,247,47,251,122,247,138,247,58,247,35,244,139,11,252,60,251,201,251,
+166,252,79,252,72,247,199,251,179,248,46,247,166,247,93,235,139,11,243,7,
+251,45,150,251,224,248,101,108,182,80,165,63,152,25,202,173,205,211,178,221,
+11,247,216,29,14,7,145,111,108,141,108,27,251,48,251,51,65,251,48,45,243,
+39,247,9,247,58,11,21,217,7,254,9,247,175,5,61,7,249,171,251,136,253,171,
+251,135,5,61,7,11,27,251,168,251,23,251,34,251,6,76,31,194,66,5,221,189,247,
+7,236,247,133,11,248,151,29,182,184,247,13,182,41,245,27,247,31,213,11,142,
+30,247,0,149,5,243,252,236,35,7,247,1,228,10,11,247,6,253,209,251,209,247,
+37,7,154,247,50,5,157,157,164,160,30,247,201,6,11,247,237,29,213,251,43,11,
+6,112,117,123,114,137,30,251,11,128,5,35,11,35,7,247,9,247,239,10,11,243,
+7,251,19,150,5,117,141,114,155,166,26,11,21,251,240,6,247,64,248,128,5,11,
+253,21,7,251,64,205,59,247,74,11,5,247,209,10,11,27,248,138,10,31,248,124,
+10,11,247,113,247,23,251,115,247,11,7,248,41,10,247,95,251,82,11,153,137,
+31,119,247,32,5,251,19,252,120,247,19,6,159,247,32,5,153,141,11,164,247,209,
+29,11,248,32,29,251,31,233,251,107,11,4,247,215,29,251,9,155,86,170,247,11,
+26,196,176,166,178,171,185,128,64,155,30,14,5,166,125,149,162,154,27,248,
+100,10,11,21,251,70,44,50,51,30,129,248,174,6,247,11,126,213,37,251,48,26,
+11,28,7,174,248,207,21,225,7,253,15,248,44,82,45,247,76,251,9,5,11,248,144,
+10,247,1,7,118,49,79,135,99,27,11,77,96,35,47,251,13,248,63,10,11,121,133,
+139,141,108,31,248,254,247,7,7,248,129,10,31,11,247,249,29,248,55,11,247,
+25,67,207,39,67,53,106,39,82,184,81,139,30,247,56,6,251,11,11,251,152,133,
+34,251,189,251,160,27,251,134,251,2,247,171,247,170,128,31,11,251,70,85,130,
+99,30,129,248,14,6,208,126,174,117,251,48,26,14,247,222,10,213,145,5,235,
+11,247,116,10,35,128,5,35,11,248,40,29,55,133,5,43,11,35,7,246,129,5,161,
+136,162,123,112,26,11,251,2,251,110,251,50,45,5,57,247,27,11,248,166,10,142,
+30,247,0,149,5,243,11,235,7,36,248,79,29,11,7,163,159,160,164,141,30,11,7,
+129,131,130,123,137,30,42,131,5,43,248,196,7,247,49,247,116,11,7,251,156,
+247,31,251,34,247,183,247,201,247,41,247,3,247,187,30,11,21,247,246,10,11,
+21,227,67,209,51,51,69,69,51,51,209,67,227,227,211,211,227,30,11,21,197,7,
+81,143,5,123,127,151,155,31,247,222,7,213,114,247,13,11,21,247,251,29,11,
+27,203,247,26,168,247,19,236,251,19,177,139,31,251,36,251,27,5,11,248,65,
+29,123,27,252,126,6,11,251,203,252,54,194,86,5,139,147,155,211,247,50,202,
+251,0,251,48,11,131,161,151,248,29,29,11,133,165,230,120,192,27,247,78,229,
+239,247,26,182,31,247,52,191,188,11,252,44,249,15,5,53,6,252,44,253,15,234,
+81,247,8,247,77,5,11,247,7,153,5,235,252,17,43,7,205,133,159,137,143,118,
+129,125,25,11,235,251,3,205,139,30,251,82,251,113,5,48,175,115,203,247,115,
+26,11,21,247,201,252,140,251,201,247,5,247,88,247,170,251,88,7,14,21,245,
+252,135,33,7,248,135,251,85,21,245,252,135,33,7,14,129,5,163,136,162,123,
+112,26,11,6,159,161,187,195,165,190,209,247,25,235,247,232,141,248,166,8,
+11,21,247,9,251,83,247,80,251,9,251,80,251,82,251,9,247,82,11,248,44,251,
+53,7,110,251,128,5,123,137,125,108,108,27,251,249,11,47,251,73,5,133,131,
+133,135,128,27,99,134,184,247,15,88,31,11,68,82,81,67,69,80,197,210,211,198,
+197,209,211,196,81,67,30,11,251,254,248,22,10,11,252,5,6,247,21,189,247,43,
+247,43,247,13,186,35,251,23,30,11,28,4,139,248,139,10,252,35,43,7,188,135,
+219,147,106,26,11,251,99,247,84,251,13,247,140,247,115,247,142,247,13,247,
+99,30,11,211,80,204,67,30,251,92,251,94,5,77,241,143,247,162,139,26,11,214,
+203,168,159,234,26,204,65,219,251,31,33,65,110,92,90,30,11,216,203,160,186,
+186,26,206,55,209,251,1,62,46,96,76,99,30,11,234,65,216,43,45,61,62,44,45,
+217,63,233,235,213,215,233,30,11,5,114,141,119,160,164,26,248,162,7,11,21,
+251,42,6,254,29,28,250,113,5,11,114,118,118,115,137,30,45,133,5,43,11,252,
+56,21,248,160,11,7,251,111,247,27,81,247,11,246,247,54,213,247,101,212,30,
+11,251,174,247,68,251,124,248,6,247,183,247,107,247,91,247,255,11,248,89,
+10,248,1,254,33,11,247,82,251,248,251,56,251,79,109,45,251,48,30,251,44,7,
+11,94,30,251,105,247,97,5,59,90,57,74,34,247,21,84,231,11,251,33,251,9,251,
+9,251,35,251,33,247,9,251,7,247,33,11,248,135,10,129,130,122,137,30,41,131,
+5,43,11,139,251,47,28,4,133,143,159,30,114,247,85,164,178,188,161,11,163,
+163,143,25,247,7,154,5,243,252,220,35,7,247,24,120,11,248,81,10,252,101,247,
+193,251,156,248,45,11,235,248,21,29,11,246,88,184,74,176,30,251,89,251,79,
+5,59,96,156,229,31,11,57,247,1,57,247,66,247,91,247,76,235,247,52,31,14,189,
+28,4,216,21,253,34,226,248,203,248,80,226,7,14,248,220,251,196,21,249,34,
+52,252,203,252,80,52,7,14,21,247,57,252,172,251,57,7,14,248,11,251,41,7,248,
+149,10,11,6,163,160,121,112,31,254,170,7,112,118,123,115,137,30,11,6,165,
+158,116,115,31,253,64,248,40,29,11,7,248,52,10,11,7,251,181,47,5,75,7,247,
+91,164,5,252,247,7,123,11,21,248,66,10,219,11,247,64,251,66,233,252,85,176,
+30,115,197,169,171,188,172,11,55,251,68,31,65,249,19,21,251,37,78,251,5,251,
+126,11,65,7,44,82,5,174,92,80,161,90,27,251,80,251,27,11,252,209,247,40,6,
+155,247,150,5,161,141,162,172,161,27,11,249,76,7,248,119,29,30,11,137,30,
+251,17,128,5,35,249,15,243,7,251,17,150,5,11,247,90,10,254,178,247,116,10,
+11,166,164,155,161,248,120,10,11,251,91,247,47,43,247,144,247,135,247,65,
+228,247,98,30,11,233,88,211,61,30,251,19,251,111,5,43,102,217,243,31,11,21,
+252,66,6,248,66,248,175,5,11,21,251,125,251,67,100,251,21,129,11,32,7,251,
+193,37,5,55,247,25,11,34,7,248,133,29,11,248,93,7,166,161,155,164,141,30,
+11,180,251,113,24,247,52,247,246,6,11,7,248,166,10,142,30,11,7,124,126,126,
+123,138,30,11,247,78,163,205,180,200,30,11,247,187,251,52,192,251,128,11,
+6,245,247,79,251,3,251,195,31,251,185,248,175,21,11,7,251,17,184,65,247,43,
+236,247,6,221,139,30,71,11,248,86,10,248,193,11,7,251,181,247,23,251,173,
+247,218,247,2,233,195,239,11,27,252,153,35,6,246,129,5,161,136,160,123,112,
+26,11,251,201,43,6,247,11,129,153,137,145,125,129,124,25,11,251,41,6,59,100,
+82,139,124,27,125,92,139,235,31,11,144,211,136,139,154,27,247,111,182,251,
+7,251,13,31,11,251,62,143,5,251,68,143,251,117,247,5,248,74,26,11,248,156,
+29,247,41,248,11,11,248,156,10,247,7,247,195,11,252,64,247,42,7,247,195,247,
+76,247,3,247,1,30,11,247,13,254,117,252,9,247,41,7,176,247,116,5,155,11,6,
+162,153,141,158,27,247,55,168,63,57,31,14,30,247,236,182,7,247,23,211,84,
+251,4,31,14,6,157,153,121,119,144,31,171,251,62,5,247,40,11,6,251,34,251,
+173,247,1,83,247,62,247,229,5,11,7,51,96,120,59,30,251,89,247,79,5,74,102,
+11,247,56,169,251,4,61,137,30,139,137,90,108,26,11,21,251,89,251,7,68,251,
+101,127,55,143,139,30,11,26,251,0,237,75,247,21,201,247,25,203,139,30,11,
+248,111,10,207,6,11,69,176,59,200,78,30,59,100,74,69,251,4,26,11,75,245,5,
+131,127,88,96,112,27,72,104,186,198,11,251,13,247,140,247,115,247,128,247,
+13,247,99,30,11,251,19,6,120,251,31,5,125,137,125,116,120,27,11,116,180,31,
+251,94,7,132,154,193,128,168,27,211,11,247,172,251,113,247,60,251,249,107,
+98,135,137,106,11,251,122,7,121,167,162,114,225,27,213,210,201,231,11,247,
+23,31,248,178,247,76,247,23,251,76,247,155,11,21,248,74,252,54,37,247,210,
+251,228,7,14,248,117,10,14,251,193,251,66,251,161,251,164,11,247,146,247,
+27,247,19,247,17,11,135,5,155,138,152,126,125,26,11,142,5,123,140,124,152,
+154,26,11,146,5,123,140,126,149,155,26,11,150,5,115,141,118,155,166,26,11,
+252,72,251,148,251,199,252,40,11,247,253,251,173,194,251,168,30,11,247,35,
+247,9,247,7,247,35,11,249,165,21,201,7,11,7,248,121,29,11,7,139,71,125,74,
+251,1,80,186,247,23,30,11,7,112,118,123,114,137,30,251,4,128,5,35,11,7,248,
+110,10,11,25,233,145,5,235,252,175,43,7,247,13,127,11,35,7,247,19,129,5,161,
+136,162,123,112,26,11,252,164,21,28,8,110,251,67,28,247,146,7,11,62,70,102,
+88,69,26,112,147,94,157,102,30,11,250,31,248,1,21,247,246,251,250,213,139,
+30,11,121,123,126,121,137,30,46,131,5,45,248,177,11,139,217,118,220,247,230,
+247,107,247,114,247,223,11,28,6,82,22,247,5,28,251,92,251,5,7,11,157,166,
+31,250,172,7,166,161,153,162,144,30,11,251,74,247,74,67,247,22,239,247,45,
+182,237,11,252,74,247,116,10,35,128,5,11,247,0,149,5,243,252,218,35,7,247,
+24,120,11,247,32,251,10,247,94,247,113,247,22,247,20,11,249,220,247,142,21,
+44,176,251,62,252,58,5,11,159,30,219,102,247,62,98,251,13,26,14,142,30,243,
+149,5,243,11,219,219,199,203,214,30,11,28,4,246,21,11,247,44,10,66,133,5,
+43,11,7,251,126,94,160,251,11,247,105,180,5,11,247,60,251,60,5,139,247,1,
+205,227,26,11,247,62,247,62,251,7,251,197,31,247,41,11,31,55,247,37,5,178,
+161,164,147,182,27,11,247,79,251,144,30,248,9,248,129,5,233,11,49,251,76,
+26,251,54,247,12,36,247,40,11,247,109,253,13,7,127,251,15,123,139,31,11,86,
+195,79,247,21,62,200,8,169,223,154,11,96,251,1,26,41,247,46,96,239,247,21,
+11,247,158,247,207,247,152,247,152,247,154,31,11,137,30,251,6,128,5,35,248,
+230,243,7,11,139,61,104,53,251,66,125,247,19,239,30,11,142,30,247,19,149,
+5,243,253,19,35,7,11,164,141,153,163,30,247,44,7,139,176,149,11,180,81,82,
+94,98,85,86,184,96,196,197,11,209,51,51,67,69,51,51,211,67,227,227,11,247,
+17,32,7,251,201,35,5,55,247,33,11,235,252,144,43,7,247,11,130,5,155,149,11,
+235,7,40,145,5,115,141,116,160,164,26,11,21,247,5,28,251,52,251,5,7,14,147,
+141,137,133,31,172,251,62,5,14,247,43,239,251,2,251,83,11,7,160,157,149,158,
+141,30,11,7,166,162,155,161,142,30,11,247,72,247,68,247,19,139,11,247,95,
+247,107,225,247,150,11,96,65,73,73,35,127,8,11,131,128,26,253,129,7,129,11,
+143,5,122,127,151,155,31,11,251,57,251,56,251,21,139,11,251,68,251,74,251,
+17,139,11,250,27,21,235,11,7,247,35,247,103,247,35,251,103,5,11,7,123,127,
+127,122,30,78,135,5,81,11,249,236,251,114,7,253,47,253,228,5,11,25,251,109,
+252,162,251,103,248,162,131,11,27,247,3,247,3,154,171,247,33,31,11,30,251,
+33,7,248,90,247,8,248,102,11,248,64,5,251,38,6,251,41,252,62,11,247,107,247,
+103,229,247,58,247,82,201,11,82,214,5,61,100,251,44,54,251,116,11,108,251,
+105,5,124,137,121,115,122,27,11,251,25,251,4,247,25,251,5,5,213,11,122,121,
+163,154,137,31,108,247,105,5,11,251,41,208,251,31,251,48,251,62,78,11,139,
+88,119,84,251,7,131,214,201,30,11,143,194,30,139,194,166,215,247,10,195,11,
+156,152,148,155,141,30,209,145,5,201,11,167,144,130,109,145,31,169,251,38,
+5,11,178,221,192,247,7,147,247,33,223,241,11,252,85,21,236,7,55,145,5,114,
+119,11,236,7,55,145,5,114,119,159,166,31,11,6,252,58,251,62,176,45,5,14,7,
+247,62,209,69,251,141,31,14,21,247,109,252,172,251,109,7,14,24,139,247,227,
+229,247,228,26,14,247,199,229,247,19,186,243,30,14,51,251,136,31,14,166,159,
+155,164,11,247,216,10,7,14,247,219,29,70,11,247,69,29,14,232,10,14,247,55,
+29,252,72,11,131,5,155,248,50,29,11,247,60,29,252,228,35,7,244,129,5,11,247,
+3,247,11,10,11,248,134,10,248,123,247,60,29,11,7,53,246,29,28,5,86,247,44,
+29,11,247,11,10,251,5,128,5,35,11,7,247,158,29,248,228,247,61,29,11,22,243,
+247,161,29,11,248,178,10,248,72,7,11,248,64,247,130,29,11,28,5,221,22,243,
+7,247,29,10,11,154,10,14,139,251,5,164,241,10,251,11,11,103,29,117,11,194,
+29,14,247,63,29,251,198,141,21,11,22,235,7,247,30,29,252,166,43,7,213,247,
+22,29,253,64,7,11,114,10,247,90,10,11,246,10,14,87,10,252,72,247,220,21,235,
+7,49,145,5,114,141,11,21,87,29,14,162,29,247,43,10,11,7,181,29,248,19,248,
+11,10,11,167,29,248,56,22,167,29,14,21,188,29,153,10,11,56,10,248,57,248,
+176,49,10,166,10,250,108,247,196,29,28,251,101,166,29,11,21,87,29,249,175,
+28,5,199,49,10,60,29,136,247,179,37,10,247,25,10,247,19,102,10,253,254,114,
+29,11,69,10,250,246,67,10,14,};
+#endif
@@ -0,0 +1,6753 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_CharisSIL_BI_cff_size = 144784;
+asm(".section .rodata");
+asm(".global fz_font_CharisSIL_BI_cff");
+asm(".type fz_font_CharisSIL_BI_cff STT_OBJECT");
+asm(".size fz_font_CharisSIL_BI_cff, 144784");
+asm(".balign 64");
+asm("fz_font_CharisSIL_BI_cff:");
+asm(".incbin \"resources/fonts/sil/CharisSIL-BI.cff\"");
+#else
+const int fz_font_CharisSIL_BI_cff_size = 144784;
+const char fz_font_CharisSIL_BI_cff[] = {
+1,0,4,3,0,1,1,1,21,67,104,97,114,105,115,83,73,76,45,66,111,108,100,73,116,
+97,108,105,99,0,1,1,1,95,248,16,0,28,8,197,1,28,8,198,2,28,8,199,3,248,20,
+4,128,12,2,251,242,12,3,247,12,12,4,28,250,19,254,216,28,24,100,28,10,40,
+5,30,160,0,72,130,128,152,143,139,139,30,160,0,72,130,128,152,143,139,139,
+12,7,29,0,62,28,255,13,29,0,0,147,55,15,29,0,0,147,84,16,29,0,0,147,86,17,
+186,29,0,1,249,191,18,7,65,2,0,1,0,9,0,17,0,26,0,38,0,49,0,58,0,65,0,67,0,
+75,0,80,0,87,0,98,0,103,0,110,0,117,0,124,0,131,0,138,0,145,0,152,0,159,0,
+166,0,173,0,180,0,187,0,194,0,201,0,207,0,214,0,221,0,228,0,235,0,242,0,249,
+1,0,1,7,1,14,1,21,1,28,1,35,1,45,1,52,1,59,1,66,1,73,1,80,1,87,1,94,1,101,
+1,108,1,115,1,122,1,129,1,136,1,143,1,150,1,157,1,164,1,171,1,178,1,185,1,
+192,1,199,1,206,1,213,1,220,1,227,1,232,1,239,1,246,1,253,2,4,2,11,2,18,2,
+25,2,32,2,39,2,46,2,52,2,59,2,66,2,73,2,80,2,87,2,94,2,101,2,108,2,115,2,
+122,2,129,2,136,2,146,2,153,2,160,2,167,2,174,2,181,2,188,2,195,2,202,2,209,
+2,216,2,223,2,230,2,237,2,244,2,251,3,2,3,9,3,16,3,23,3,30,3,37,3,44,3,51,
+3,58,3,65,3,72,3,79,3,86,3,93,3,100,3,107,3,114,3,121,3,128,3,135,3,142,3,
+149,3,156,3,163,3,170,3,177,3,184,3,191,3,198,3,205,3,212,3,219,3,226,3,233,
+3,240,3,247,3,254,4,5,4,12,4,19,4,26,4,33,4,40,4,47,4,51,4,58,4,65,4,72,4,
+79,4,86,4,93,4,100,4,106,4,117,4,123,4,133,4,140,4,147,4,154,4,161,4,168,
+4,175,4,182,4,189,4,196,4,203,4,210,4,217,4,224,4,231,4,238,4,245,4,252,5,
+3,5,10,5,17,5,24,5,31,5,37,5,48,5,54,5,64,5,71,5,78,5,85,5,92,5,99,5,103,
+5,110,5,117,5,124,5,131,5,138,5,145,5,152,5,159,5,166,5,173,5,180,5,187,5,
+194,5,201,5,208,5,215,5,222,5,229,5,236,5,243,5,250,6,1,6,7,6,14,6,20,6,24,
+6,31,6,38,6,45,6,52,6,59,6,66,6,73,6,80,6,87,6,94,6,101,6,108,6,115,6,122,
+6,129,6,134,6,141,6,148,6,155,6,162,6,169,6,175,6,182,6,189,6,196,6,203,6,
+210,6,216,6,223,6,230,6,237,6,244,6,251,7,2,7,9,7,16,7,23,7,30,7,37,7,44,
+7,51,7,58,7,65,7,72,7,79,7,86,7,93,7,100,7,107,7,114,7,121,7,128,7,135,7,
+142,7,149,7,156,7,163,7,169,7,176,7,182,7,189,7,196,7,203,7,210,7,217,7,227,
+7,234,7,241,7,248,7,255,8,6,8,13,8,20,8,27,8,34,8,41,8,48,8,55,8,62,8,69,
+8,76,8,83,8,90,8,97,8,104,8,111,8,118,8,125,8,132,8,139,8,146,8,153,8,160,
+8,167,8,174,8,181,8,188,8,195,8,202,8,209,8,216,8,223,8,230,8,237,8,244,8,
+251,9,2,9,9,9,16,9,23,9,30,9,37,9,44,9,51,9,58,9,64,9,71,9,77,9,84,9,91,9,
+98,9,105,9,112,9,122,9,129,9,136,9,143,9,150,9,157,9,164,9,171,9,178,9,185,
+9,192,9,199,9,206,9,217,9,224,9,231,9,238,9,245,9,252,10,3,10,10,10,17,10,
+24,10,31,10,38,10,45,10,52,10,59,10,66,10,73,10,80,10,87,10,94,10,99,10,106,
+10,113,10,120,10,127,10,134,10,141,10,148,10,155,10,162,10,169,10,176,10,
+181,10,188,10,195,10,202,10,209,10,214,10,221,10,228,10,235,10,242,10,249,
+11,0,11,7,11,14,11,25,11,31,11,37,11,44,11,54,11,66,11,73,11,80,11,87,11,
+94,11,101,11,108,11,115,11,122,11,129,11,136,11,143,11,150,11,157,11,168,
+11,174,11,180,11,187,11,197,11,209,11,216,11,223,11,230,11,237,11,244,11,
+251,12,2,12,9,12,16,12,23,12,30,12,37,12,48,12,55,12,62,12,69,12,76,12,83,
+12,90,12,97,12,104,12,108,12,115,12,122,12,129,12,136,12,143,12,150,12,157,
+12,164,12,171,12,178,12,185,12,192,12,199,12,206,12,213,12,220,12,227,12,
+234,12,241,12,248,12,255,13,6,13,13,13,20,13,27,13,34,13,41,13,48,13,55,13,
+62,13,69,13,76,13,83,13,90,13,97,13,104,13,111,13,122,13,129,13,136,13,143,
+13,150,13,157,13,164,13,168,13,175,13,182,13,189,13,196,13,203,13,210,13,
+217,13,224,13,231,13,238,13,245,13,252,14,3,14,10,14,17,14,24,14,31,14,38,
+14,45,14,52,14,59,14,66,14,73,14,80,14,87,14,94,14,96,14,103,14,110,14,117,
+14,124,14,131,14,138,14,145,14,151,14,158,14,164,14,171,14,178,14,185,14,
+192,14,199,14,206,14,213,14,220,14,227,14,234,14,241,14,248,14,250,15,1,15,
+8,15,15,15,22,15,29,15,36,15,43,15,50,15,57,15,64,15,71,15,78,15,85,15,92,
+15,99,15,106,15,113,15,119,15,126,15,132,15,139,15,146,15,153,15,163,15,170,
+15,177,15,184,15,191,15,198,15,205,15,212,15,219,15,221,15,228,15,235,15,
+242,15,249,16,0,16,7,16,14,16,21,16,28,16,35,16,46,16,53,16,60,16,67,16,74,
+16,81,16,88,16,95,16,102,16,109,16,116,16,123,16,130,16,137,16,144,16,151,
+16,158,16,165,16,172,16,179,16,186,16,193,16,200,16,211,16,218,16,225,16,
+232,16,239,16,246,16,253,17,4,17,11,17,18,17,25,17,32,17,39,17,46,17,53,17,
+60,17,67,17,74,17,81,17,88,17,95,17,107,17,114,17,121,17,128,17,135,17,142,
+17,149,17,156,17,163,17,175,17,182,17,189,17,196,17,203,17,210,17,217,17,
+224,17,231,17,238,17,245,17,252,18,3,18,10,18,17,18,24,18,31,18,38,18,45,
+18,57,18,64,18,71,18,78,18,85,18,92,18,99,18,106,18,113,18,120,18,127,18,
+134,18,141,18,148,18,155,18,162,18,169,18,176,18,183,18,190,18,197,18,204,
+18,211,18,218,18,224,18,231,18,238,18,245,18,252,19,8,19,12,19,18,19,25,19,
+32,19,39,19,46,19,53,19,60,19,67,19,74,19,81,19,88,19,95,19,102,19,109,19,
+116,19,123,19,130,19,137,19,144,19,151,19,158,19,165,19,172,19,179,19,183,
+19,190,19,197,19,204,19,211,19,217,19,224,19,231,19,238,19,245,20,1,20,5,
+20,11,20,18,20,25,20,32,20,39,20,46,20,53,20,60,20,67,20,74,20,81,20,88,20,
+95,20,102,20,109,20,116,20,123,20,130,20,137,20,144,20,151,20,158,20,165,
+20,172,20,179,20,186,20,193,20,200,20,207,20,214,20,221,20,228,20,235,20,
+242,20,249,21,0,21,7,21,14,21,21,21,28,21,35,21,42,21,49,21,56,21,63,21,70,
+21,77,21,84,21,90,21,97,21,103,21,110,21,117,21,124,21,131,21,143,21,150,
+21,157,21,164,21,171,21,178,21,185,21,188,21,195,21,202,21,209,21,216,21,
+223,21,230,21,237,21,244,21,251,22,2,22,9,22,16,22,23,22,30,22,37,22,44,22,
+50,22,57,22,63,22,70,22,77,22,84,22,91,22,103,22,110,22,117,22,124,22,131,
+22,138,22,145,22,148,22,155,22,162,22,169,22,176,22,183,22,190,22,197,22,
+204,22,211,22,218,22,225,22,232,22,239,22,246,23,3,23,10,23,17,23,24,23,31,
+23,38,23,45,23,52,23,58,23,65,23,72,23,79,23,86,23,93,23,100,23,107,23,114,
+23,121,23,128,23,135,23,142,23,149,23,156,23,163,23,170,23,177,23,184,23,
+191,23,198,23,203,23,210,23,217,23,224,23,235,23,243,23,250,24,1,24,6,24,
+13,24,20,24,27,24,34,24,41,24,46,24,53,24,60,24,67,24,74,24,81,24,88,24,95,
+24,102,24,109,24,116,24,123,24,130,24,137,24,144,24,151,24,164,24,171,24,
+178,24,185,24,192,24,199,24,206,24,213,24,219,24,226,24,233,24,240,24,247,
+24,254,25,5,25,12,25,19,25,26,25,33,25,40,25,47,25,54,25,61,25,68,25,75,25,
+82,25,89,25,94,25,101,25,108,25,119,25,126,25,133,25,138,25,145,25,152,25,
+159,25,166,25,173,25,180,25,187,25,194,25,201,25,208,25,215,25,222,25,229,
+25,236,25,243,25,250,26,1,26,8,26,15,26,22,26,29,26,36,26,43,26,50,26,57,
+26,64,26,71,26,78,26,85,26,92,26,99,26,106,26,109,26,116,26,123,26,130,26,
+137,26,140,26,147,26,154,26,161,26,168,26,175,26,182,26,189,26,196,26,203,
+26,210,26,217,26,224,26,231,26,238,26,245,26,252,27,3,27,10,27,17,27,23,27,
+30,27,37,27,44,27,51,27,58,27,65,27,72,27,79,27,86,27,93,27,100,27,107,27,
+114,27,121,27,128,27,135,27,142,27,149,27,156,27,163,27,169,27,176,27,183,
+27,189,27,196,27,203,27,210,27,217,27,229,27,236,27,243,27,250,28,1,28,8,
+28,15,28,22,28,29,28,36,28,43,28,50,28,57,28,64,28,71,28,78,28,85,28,92,28,
+99,28,106,28,113,28,120,28,127,28,134,28,141,28,147,28,154,28,161,28,167,
+28,174,28,181,28,188,28,195,28,207,28,214,28,221,28,228,28,235,28,242,28,
+249,29,0,29,7,29,14,29,21,29,28,29,35,29,42,29,49,29,56,29,63,29,70,29,77,
+29,84,29,91,29,98,29,105,29,112,29,119,29,125,29,132,29,143,29,150,29,157,
+29,164,29,171,29,178,29,186,29,193,29,200,29,207,29,214,29,221,29,228,29,
+235,29,242,29,249,30,0,30,7,30,14,30,21,30,28,30,35,30,41,30,48,30,59,30,
+66,30,73,30,80,30,87,30,94,30,102,30,109,30,116,30,123,30,130,30,137,30,144,
+30,151,30,158,30,165,30,172,30,179,30,186,30,193,30,200,30,206,30,213,30,
+220,30,227,30,231,30,238,30,245,30,252,31,3,31,10,31,17,31,24,31,31,31,38,
+31,45,31,52,31,59,31,66,31,73,31,80,31,87,31,94,31,101,31,108,31,115,31,121,
+31,128,31,135,31,142,31,149,31,156,31,163,31,170,31,174,31,181,31,188,31,
+195,31,202,31,209,31,216,31,223,31,230,31,237,31,244,31,251,32,2,32,9,32,
+16,32,23,32,36,32,43,32,50,32,56,32,63,32,69,32,76,32,83,32,90,32,97,32,104,
+32,111,32,118,32,123,32,130,32,137,32,144,32,151,32,158,32,165,32,172,32,
+179,32,186,32,191,32,198,32,205,32,212,32,219,32,226,32,233,32,240,32,247,
+32,254,33,5,33,12,33,19,33,26,33,33,33,40,33,47,33,54,33,61,33,74,33,81,33,
+88,33,94,33,101,33,107,33,114,33,121,33,128,33,135,33,142,33,149,33,156,33,
+161,33,168,33,175,33,182,33,189,33,196,33,203,33,210,33,217,33,222,33,229,
+33,236,33,243,33,250,34,1,34,8,34,15,34,22,34,29,34,36,34,43,34,50,34,57,
+34,64,34,71,34,78,34,85,34,92,34,99,34,106,34,113,34,120,34,127,34,134,34,
+141,34,148,34,155,34,162,34,169,34,176,34,183,34,188,34,195,34,202,34,209,
+34,216,34,223,34,230,34,237,34,244,34,251,35,2,35,9,35,16,35,23,35,30,35,
+37,35,44,35,51,35,57,35,63,35,74,35,83,35,90,35,97,35,104,35,111,35,118,35,
+125,35,130,35,137,35,144,35,151,35,158,35,164,35,170,35,181,35,190,35,197,
+35,204,35,211,35,218,35,225,35,232,35,239,35,246,35,253,36,4,36,11,36,18,
+36,25,36,32,36,39,36,46,36,53,36,56,36,63,36,70,36,77,36,84,36,91,36,98,36,
+105,36,112,36,119,36,126,36,133,36,140,36,147,36,154,36,160,36,171,36,178,
+36,185,36,192,36,199,36,206,36,213,36,220,36,227,36,234,36,241,36,248,36,
+255,37,6,37,13,37,20,37,26,37,33,37,40,37,47,37,54,37,61,37,68,37,75,37,82,
+37,89,37,95,37,106,37,113,37,120,37,127,37,134,37,141,37,148,37,155,37,162,
+37,169,37,176,37,183,37,190,37,197,37,204,37,211,37,218,37,225,37,232,37,
+239,37,246,37,249,38,0,38,7,38,13,38,20,38,30,38,37,38,44,38,51,38,58,38,
+65,38,72,38,79,38,86,38,93,38,100,38,107,38,114,38,121,38,128,38,134,38,141,
+38,151,38,158,38,165,38,172,38,179,38,186,38,193,38,200,38,207,38,214,38,
+221,38,228,38,235,38,242,38,249,39,0,39,7,39,14,39,21,39,28,39,35,39,42,39,
+49,39,56,39,63,39,70,39,77,39,84,39,91,39,98,39,105,39,112,39,119,39,126,
+39,133,39,140,39,147,39,154,39,161,39,168,39,175,39,182,39,189,39,196,39,
+203,39,210,39,217,39,224,39,231,39,238,39,245,39,252,40,3,40,10,40,17,40,
+24,40,31,40,38,40,45,40,52,40,59,40,66,40,73,40,80,40,87,40,94,40,101,40,
+108,40,115,40,122,40,129,40,136,40,143,40,150,40,157,40,164,40,171,40,178,
+40,185,40,192,40,199,40,206,40,213,40,220,40,227,40,234,40,241,40,248,40,
+255,41,6,41,15,41,22,41,29,41,36,41,43,41,50,41,57,41,70,41,77,41,84,41,91,
+41,98,41,105,41,112,41,119,41,128,41,135,41,142,41,149,41,156,41,163,41,170,
+41,177,41,184,41,191,41,198,41,205,41,212,41,219,41,226,41,233,41,240,41,
+247,41,254,42,5,42,12,42,19,42,26,42,33,42,40,42,47,42,54,42,61,42,68,42,
+75,42,82,42,89,42,96,42,103,42,110,42,117,42,124,42,131,42,138,42,145,42,
+152,42,159,42,166,42,173,42,180,42,187,42,194,42,201,42,208,42,215,42,222,
+42,229,42,236,42,243,42,250,43,1,43,8,43,15,43,22,43,29,43,36,43,43,43,50,
+43,57,43,64,43,71,43,78,43,85,43,92,43,99,43,106,43,113,43,122,43,128,43,
+135,43,141,43,148,43,155,43,162,43,169,43,176,43,183,43,190,43,197,43,204,
+43,213,43,220,43,227,43,234,43,241,43,248,43,255,44,6,44,13,44,20,44,27,44,
+34,44,41,44,48,44,55,44,62,44,69,44,76,44,83,44,90,44,97,44,104,44,111,44,
+118,44,125,44,132,44,139,44,146,44,153,44,160,44,167,44,174,44,181,44,188,
+44,195,44,202,44,209,44,216,44,223,44,232,44,239,44,246,44,253,45,4,45,11,
+45,18,45,25,45,32,45,39,45,46,45,53,45,60,45,67,45,74,45,81,45,88,45,95,45,
+102,45,109,45,116,45,123,45,130,45,137,45,144,45,151,45,164,45,171,45,178,
+45,185,45,192,45,199,45,206,45,213,45,220,45,231,45,238,45,245,45,252,46,
+8,46,15,46,22,46,29,46,36,46,43,46,50,46,57,46,64,46,71,46,78,46,85,46,92,
+46,99,46,106,46,113,46,120,46,127,46,134,46,141,46,148,46,155,46,162,46,175,
+46,182,46,189,46,196,46,203,46,210,46,217,46,224,46,231,46,238,46,245,46,
+252,47,3,47,10,47,17,47,24,47,31,47,38,47,45,47,52,47,59,47,66,47,73,47,80,
+47,87,47,94,47,101,47,108,47,115,47,122,47,129,47,136,47,143,47,150,47,157,
+47,164,47,171,47,178,47,185,47,192,47,199,47,206,47,213,47,220,47,227,47,
+234,47,241,47,248,47,255,48,6,48,13,48,20,48,27,48,34,48,41,48,48,48,55,48,
+62,48,69,48,78,48,85,48,92,48,99,48,106,48,113,48,122,48,134,48,143,48,150,
+48,157,48,164,48,174,48,181,48,188,48,195,48,204,48,211,48,218,48,225,48,
+237,48,247,48,254,49,10,49,23,49,35,49,42,49,49,49,56,49,63,49,70,49,77,49,
+84,49,91,49,98,49,105,49,112,49,119,49,126,49,135,49,142,49,149,49,156,49,
+163,49,173,49,180,49,187,49,194,49,201,49,208,49,215,49,222,49,229,49,236,
+49,243,49,250,50,1,50,8,50,15,50,22,50,29,50,36,50,43,50,50,50,57,50,64,50,
+71,50,78,50,85,50,92,50,99,50,106,50,113,50,120,50,127,50,134,50,141,50,148,
+50,155,50,162,50,169,50,176,50,183,50,190,50,197,50,204,50,211,50,218,50,
+225,50,232,50,239,50,246,50,253,51,4,51,11,51,18,51,25,51,32,51,39,51,41,
+51,84,51,106,51,116,110,111,116,101,113,117,97,108,105,110,102,105,110,105,
+116,121,108,101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,
+113,117,97,108,112,97,114,116,105,97,108,100,105,102,102,115,117,109,109,
+97,116,105,111,110,112,114,111,100,117,99,116,112,105,105,110,116,101,103,
+114,97,108,79,109,101,103,97,114,97,100,105,99,97,108,97,112,112,114,111,
+120,101,113,117,97,108,68,101,108,116,97,117,110,105,48,48,65,48,108,111,
+122,101,110,103,101,117,110,105,50,53,67,67,117,110,105,48,52,51,48,117,110,
+105,50,48,57,48,117,110,105,49,68,52,51,117,110,105,48,51,54,51,117,110,105,
+48,50,48,49,117,110,105,49,69,65,68,117,110,105,49,69,65,53,117,110,105,49,
+69,65,55,117,110,105,49,69,65,66,117,110,105,49,69,65,57,117,110,105,48,50,
+48,51,97,98,114,101,118,101,117,110,105,49,69,66,55,117,110,105,49,69,65,
+70,117,110,105,49,69,66,49,117,110,105,49,69,66,53,117,110,105,49,69,66,51,
+117,110,105,48,52,68,49,117,110,105,48,49,67,69,97,109,97,99,114,111,110,
+117,110,105,48,52,68,51,117,110,105,48,49,68,70,117,110,105,48,50,50,55,117,
+110,105,48,49,69,49,97,114,105,110,103,97,99,117,116,101,117,110,105,49,69,
+57,65,117,110,105,49,69,65,51,117,110,105,49,69,65,49,117,110,105,49,69,48,
+49,97,111,103,111,110,101,107,117,110,105,49,68,56,70,117,110,105,50,67,54,
+53,117,110,105,65,55,51,51,117,110,105,65,55,51,53,117,110,105,65,55,51,55,
+117,110,105,65,55,51,57,117,110,105,65,55,51,66,117,110,105,65,55,51,68,117,
+110,105,48,50,53,48,117,110,105,49,68,52,52,117,110,105,48,50,53,49,117,110,
+105,49,68,52,53,117,110,105,49,68,57,48,117,110,105,65,66,54,52,117,110,105,
+48,50,53,50,117,110,105,49,68,57,66,117,110,105,48,52,68,53,97,101,97,99,
+117,116,101,117,110,105,48,49,69,51,117,110,105,49,68,48,50,117,110,105,49,
+68,52,54,97,108,112,104,97,117,110,105,48,52,49,48,117,110,105,49,68,50,67,
+117,110,105,49,68,48,48,117,110,105,48,50,48,48,117,110,105,49,69,65,52,117,
+110,105,49,69,65,54,117,110,105,49,69,65,65,117,110,105,49,69,65,56,117,110,
+105,49,69,65,67,117,110,105,48,50,48,50,65,98,114,101,118,101,117,110,105,
+49,69,65,69,117,110,105,49,69,66,48,117,110,105,49,69,66,52,117,110,105,49,
+69,66,50,117,110,105,49,69,66,54,117,110,105,48,52,68,48,117,110,105,48,49,
+67,68,65,109,97,99,114,111,110,117,110,105,48,52,68,50,117,110,105,48,49,
+68,69,117,110,105,48,50,50,54,117,110,105,48,49,69,48,65,114,105,110,103,
+97,99,117,116,101,117,110,105,49,69,65,50,117,110,105,49,69,65,48,117,110,
+105,49,69,48,48,65,111,103,111,110,101,107,117,110,105,48,50,51,65,117,110,
+105,50,67,54,70,117,110,105,65,55,51,52,117,110,105,65,55,51,50,117,110,105,
+65,55,51,54,117,110,105,65,55,51,56,117,110,105,65,55,51,65,117,110,105,65,
+55,51,67,117,110,105,50,48,66,51,117,110,105,50,67,54,68,117,110,105,50,67,
+55,48,117,110,105,48,52,68,52,117,110,105,49,68,50,68,117,110,105,49,68,48,
+49,65,69,97,99,117,116,101,117,110,105,48,49,69,50,117,110,105,49,68,52,55,
+117,110,105,49,69,48,51,117,110,105,49,69,48,55,117,110,105,49,69,48,53,117,
+110,105,49,68,56,48,117,110,105,48,49,56,48,117,110,105,49,68,54,67,117,110,
+105,48,50,53,51,117,110,105,65,55,57,55,117,110,105,48,49,56,53,117,110,105,
+48,49,56,51,117,110,105,48,52,51,49,117,110,105,48,52,52,67,117,110,105,48,
+52,56,68,117,110,105,48,52,52,65,117,110,105,48,52,54,51,117,110,105,48,52,
+52,66,117,110,105,48,52,70,57,117,110,105,48,52,51,50,117,110,105,48,52,49,
+50,117,110,105,49,68,50,69,117,110,105,48,50,57,57,117,110,105,49,69,48,50,
+117,110,105,49,69,48,54,117,110,105,49,69,48,52,117,110,105,48,50,52,51,117,
+110,105,49,68,50,70,117,110,105,49,68,48,51,117,110,105,48,49,56,49,117,110,
+105,65,55,57,54,117,110,105,48,49,56,52,117,110,105,48,49,56,50,117,110,105,
+48,52,49,49,117,110,105,48,52,50,67,117,110,105,48,52,56,67,117,110,105,48,
+52,50,65,117,110,105,48,52,54,50,117,110,105,48,52,50,66,117,110,105,48,52,
+70,56,98,101,116,97,117,110,105,49,68,54,54,117,110,105,49,68,53,68,117,110,
+105,49,69,57,69,117,110,105,48,52,52,49,117,110,105,50,49,55,68,117,110,105,
+49,68,57,67,117,110,105,48,51,54,56,99,97,99,117,116,101,99,99,105,114,99,
+117,109,102,108,101,120,99,99,97,114,111,110,99,100,111,116,97,99,99,101,
+110,116,117,110,105,49,69,48,57,117,110,105,48,52,65,66,117,110,105,65,55,
+57,52,117,110,105,65,55,57,51,117,110,105,48,50,51,67,117,110,105,48,50,57,
+55,117,110,105,48,49,56,56,117,110,105,48,50,53,53,117,110,105,49,68,57,68,
+117,110,105,48,50,53,52,117,110,105,49,68,53,51,117,110,105,49,68,57,55,117,
+110,105,50,67,55,65,117,110,105,50,49,56,52,117,110,105,65,55,51,70,117,110,
+105,49,68,49,50,117,110,105,48,52,53,52,117,110,105,48,52,52,68,117,110,105,
+48,52,69,68,117,110,105,48,52,50,49,117,110,105,50,49,54,68,117,110,105,49,
+68,48,52,67,97,99,117,116,101,67,99,105,114,99,117,109,102,108,101,120,67,
+99,97,114,111,110,67,100,111,116,97,99,99,101,110,116,117,110,105,49,69,48,
+56,117,110,105,48,52,65,65,117,110,105,65,55,57,50,117,110,105,48,50,51,66,
+117,110,105,48,49,56,55,69,117,114,111,117,110,105,50,48,65,48,117,110,105,
+50,48,65,50,117,110,105,50,48,66,53,117,110,105,50,49,56,53,117,110,105,50,
+49,50,68,117,110,105,50,67,56,56,117,110,105,48,49,56,54,117,110,105,49,68,
+49,48,117,110,105,50,49,56,51,117,110,105,65,55,51,69,117,110,105,48,52,48,
+52,117,110,105,48,52,50,68,117,110,105,48,52,69,67,117,110,105,48,53,48,49,
+117,110,105,50,49,55,69,117,110,105,49,68,52,56,117,110,105,48,51,54,57,117,
+110,105,49,69,48,66,117,110,105,49,69,49,51,117,110,105,49,69,48,70,117,110,
+105,49,69,48,68,117,110,105,49,69,49,49,100,99,97,114,111,110,117,110,105,
+49,68,56,49,100,99,114,111,97,116,100,111,110,103,117,110,105,49,68,54,68,
+117,110,105,65,55,55,49,117,110,105,48,50,53,55,117,110,105,48,50,53,54,117,
+110,105,49,68,57,49,117,110,105,48,50,50,49,117,110,105,48,49,56,67,117,110,
+105,48,50,51,56,117,110,105,48,49,70,51,117,110,105,48,49,67,54,117,110,105,
+48,50,65,51,117,110,105,48,50,65,53,117,110,105,48,50,65,52,117,110,105,48,
+53,48,51,117,110,105,49,69,57,70,100,101,108,116,97,117,110,105,49,68,53,
+70,117,110,105,49,68,57,69,117,110,105,50,49,54,69,117,110,105,49,68,51,48,
+117,110,105,49,68,48,53,68,99,97,114,111,110,117,110,105,49,69,48,65,117,
+110,105,49,69,49,50,117,110,105,49,69,48,69,117,110,105,49,69,48,67,117,110,
+105,49,69,49,48,68,99,114,111,97,116,117,110,105,48,49,56,57,117,110,105,
+49,68,48,54,117,110,105,48,49,56,65,117,110,105,48,49,56,66,117,110,105,48,
+49,70,50,117,110,105,48,49,67,53,117,110,105,48,49,70,49,117,110,105,48,49,
+67,52,117,110,105,48,53,48,48,117,110,105,48,53,48,50,117,110,105,48,51,57,
+52,117,110,105,50,49,56,49,117,110,105,50,49,56,48,117,110,105,50,49,56,50,
+117,110,105,50,49,56,55,117,110,105,50,49,56,56,117,110,105,50,48,65,70,117,
+110,105,48,52,51,53,117,110,105,50,48,57,49,117,110,105,49,68,52,57,117,110,
+105,48,51,54,52,117,110,105,48,52,53,48,117,110,105,48,50,48,53,117,110,105,
+49,69,66,70,117,110,105,49,69,67,49,117,110,105,49,69,67,53,117,110,105,49,
+69,67,51,117,110,105,49,69,67,55,117,110,105,48,50,48,55,101,98,114,101,118,
+101,117,110,105,48,52,68,55,101,99,97,114,111,110,117,110,105,49,69,66,68,
+101,109,97,99,114,111,110,117,110,105,49,69,49,55,117,110,105,49,69,49,53,
+117,110,105,48,52,53,49,101,100,111,116,97,99,99,101,110,116,117,110,105,
+49,69,66,66,117,110,105,49,69,49,57,117,110,105,49,69,49,66,117,110,105,49,
+69,66,57,117,110,105,50,67,55,56,117,110,105,48,50,50,57,117,110,105,49,69,
+49,68,101,111,103,111,110,101,107,117,110,105,49,68,57,50,117,110,105,48,
+50,52,55,117,110,105,48,52,66,68,117,110,105,48,52,66,70,117,110,105,48,49,
+68,68,117,110,105,48,50,53,57,117,110,105,48,52,68,57,117,110,105,50,48,57,
+52,117,110,105,49,68,52,65,117,110,105,48,52,68,66,117,110,105,49,68,57,53,
+117,110,105,48,50,53,65,117,110,105,48,50,53,56,117,110,105,48,50,53,66,117,
+110,105,49,68,52,66,117,110,105,49,68,57,51,117,110,105,48,50,53,67,117,110,
+105,49,68,57,70,117,110,105,49,68,57,52,117,110,105,48,50,53,68,117,110,105,
+49,68,48,56,117,110,105,49,68,52,67,117,110,105,48,50,57,65,117,110,105,48,
+50,53,69,117,110,105,48,53,49,49,117,110,105,48,52,51,55,117,110,105,48,52,
+68,70,117,110,105,48,52,57,57,117,110,105,48,53,48,55,117,110,105,48,53,48,
+53,117,110,105,48,52,49,53,117,110,105,49,68,51,49,117,110,105,49,68,48,55,
+117,110,105,48,52,48,48,117,110,105,48,50,48,52,117,110,105,49,69,66,69,117,
+110,105,49,69,67,48,117,110,105,49,69,67,52,117,110,105,49,69,67,50,117,110,
+105,49,69,67,54,117,110,105,48,50,48,54,69,98,114,101,118,101,117,110,105,
+48,52,68,54,69,99,97,114,111,110,117,110,105,49,69,66,67,69,109,97,99,114,
+111,110,117,110,105,49,69,49,54,117,110,105,49,69,49,52,117,110,105,48,52,
+48,49,69,100,111,116,97,99,99,101,110,116,117,110,105,49,69,66,65,117,110,
+105,49,69,49,56,117,110,105,49,69,49,65,117,110,105,49,69,66,56,117,110,105,
+48,50,50,56,117,110,105,49,69,49,67,69,111,103,111,110,101,107,117,110,105,
+48,50,52,54,117,110,105,50,67,55,66,117,110,105,48,52,66,67,117,110,105,48,
+52,66,69,117,110,105,48,49,56,69,101,120,105,115,116,101,110,116,105,97,108,
+117,110,105,50,50,48,52,117,110,105,49,68,51,50,117,110,105,48,49,56,70,117,
+110,105,48,52,68,56,117,110,105,48,52,68,65,117,110,105,48,49,57,48,117,110,
+105,65,55,65,66,117,110,105,48,53,49,48,117,110,105,48,52,49,55,117,110,105,
+48,52,68,69,117,110,105,48,52,57,56,117,110,105,48,53,48,54,117,110,105,48,
+53,48,52,117,110,105,49,68,65,48,117,110,105,49,69,49,70,117,110,105,49,68,
+56,50,117,110,105,49,68,54,69,117,110,105,65,55,57,57,117,110,105,48,50,65,
+57,108,111,110,103,115,117,110,105,49,69,57,66,117,110,105,49,69,57,68,117,
+110,105,49,69,57,67,117,110,105,48,52,51,51,117,110,105,48,52,53,51,117,110,
+105,48,52,57,49,117,110,105,48,52,70,55,117,110,105,48,52,57,51,117,110,105,
+48,52,70,66,117,110,105,65,55,51,48,117,110,105,49,69,49,69,102,114,97,110,
+99,117,110,105,48,49,57,49,117,110,105,65,55,57,56,117,110,105,65,55,70,66,
+117,110,105,48,52,49,51,71,97,109,109,97,117,110,105,49,68,50,54,117,110,
+105,48,52,48,51,117,110,105,48,52,57,48,117,110,105,48,52,70,54,117,110,105,
+48,52,57,50,117,110,105,48,52,70,65,117,110,105,49,68,52,68,117,110,105,48,
+49,70,53,103,99,105,114,99,117,109,102,108,101,120,103,98,114,101,118,101,
+103,99,97,114,111,110,117,110,105,49,69,50,49,103,100,111,116,97,99,99,101,
+110,116,103,99,111,109,109,97,97,99,99,101,110,116,117,110,105,48,49,69,53,
+117,110,105,65,55,65,49,117,110,105,48,50,54,49,117,110,105,49,68,65,50,117,
+110,105,49,68,56,51,117,110,105,48,50,54,48,117,110,105,49,68,55,55,117,110,
+105,49,68,55,57,117,110,105,65,55,55,70,117,110,105,48,53,48,68,117,110,105,
+49,68,51,51,117,110,105,48,50,54,50,117,110,105,48,49,70,52,71,99,105,114,
+99,117,109,102,108,101,120,71,98,114,101,118,101,71,99,97,114,111,110,117,
+110,105,49,69,50,48,71,100,111,116,97,99,99,101,110,116,71,99,111,109,109,
+97,97,99,99,101,110,116,117,110,105,48,49,69,52,117,110,105,65,55,65,48,117,
+110,105,48,49,57,51,117,110,105,48,50,57,66,117,110,105,65,55,65,67,117,110,
+105,50,48,66,50,117,110,105,65,55,55,68,117,110,105,65,55,55,69,117,110,105,
+48,53,48,67,117,110,105,50,48,57,53,117,110,105,48,50,66,48,117,110,105,48,
+51,54,65,104,99,105,114,99,117,109,102,108,101,120,117,110,105,48,50,49,70,
+117,110,105,49,69,50,55,117,110,105,49,69,50,51,117,110,105,49,69,50,66,117,
+110,105,49,69,57,54,117,110,105,49,69,50,53,117,110,105,49,69,50,57,117,110,
+105,65,55,57,53,104,98,97,114,117,110,105,48,52,53,66,117,110,105,48,52,53,
+50,117,110,105,48,50,54,54,117,110,105,48,50,66,49,117,110,105,65,55,50,55,
+117,110,105,48,50,54,55,117,110,105,50,67,54,56,117,110,105,48,49,57,53,117,
+110,105,50,67,55,54,117,110,105,48,50,54,53,117,110,105,49,68,65,51,117,110,
+105,48,50,65,69,117,110,105,48,50,65,70,117,110,105,48,52,66,66,117,110,105,
+48,52,57,53,117,110,105,48,53,50,55,117,110,105,48,52,51,68,117,110,105,48,
+52,65,53,117,110,105,48,52,65,51,117,110,105,48,52,67,65,117,110,105,48,52,
+53,65,117,110,105,48,52,67,56,117,110,105,48,53,50,57,117,110,105,48,53,48,
+66,117,110,105,48,53,50,51,117,110,105,48,52,51,70,117,110,105,48,53,50,53,
+117,110,105,48,52,65,55,117,110,105,48,52,53,70,117,110,105,48,52,52,54,117,
+110,105,48,52,52,56,117,110,105,48,52,52,57,117,110,105,49,68,50,56,117,110,
+105,48,52,49,68,117,110,105,49,68,51,52,117,110,105,49,68,55,56,117,110,105,
+48,50,57,67,72,99,105,114,99,117,109,102,108,101,120,117,110,105,48,50,49,
+69,117,110,105,49,69,50,54,117,110,105,49,69,50,50,117,110,105,49,69,50,65,
+117,110,105,49,69,50,52,117,110,105,49,69,50,56,72,98,97,114,117,110,105,
+65,55,70,56,117,110,105,65,55,65,65,117,110,105,65,55,50,54,117,110,105,50,
+67,54,55,117,110,105,48,49,70,54,117,110,105,50,67,55,53,117,110,105,50,49,
+48,67,117,110,105,48,53,50,56,117,110,105,65,55,56,68,117,110,105,48,52,66,
+65,117,110,105,48,52,57,52,117,110,105,48,53,50,54,117,110,105,48,52,65,52,
+117,110,105,48,52,65,50,117,110,105,48,52,67,57,117,110,105,48,52,48,65,117,
+110,105,48,52,67,55,117,110,105,48,53,48,65,117,110,105,48,53,50,50,117,110,
+105,48,52,49,70,117,110,105,48,53,50,52,117,110,105,48,52,65,54,117,110,105,
+48,52,48,70,117,110,105,48,52,50,54,117,110,105,48,52,50,56,117,110,105,48,
+52,50,57,80,105,117,110,105,48,52,53,54,117,110,105,50,49,55,48,117,110,105,
+49,68,54,50,117,110,105,50,48,55,49,117,110,105,48,51,54,53,117,110,105,48,
+50,48,57,117,110,105,48,50,48,66,105,98,114,101,118,101,117,110,105,48,49,
+68,48,105,116,105,108,100,101,105,109,97,99,114,111,110,117,110,105,48,52,
+53,55,117,110,105,49,69,50,70,117,110,105,49,69,67,57,117,110,105,49,69,50,
+68,117,110,105,49,69,67,66,105,111,103,111,110,101,107,117,110,105,49,68,
+57,54,117,110,105,48,50,54,56,117,110,105,49,68,65,52,117,110,105,49,68,48,
+57,117,110,105,49,68,52,69,105,106,117,110,105,50,49,55,49,117,110,105,50,
+49,55,50,117,110,105,50,49,55,51,117,110,105,50,49,55,56,117,110,105,48,50,
+54,57,117,110,105,49,68,65,53,117,110,105,49,68,55,67,117,110,105,48,52,52,
+69,117,110,105,48,52,48,54,117,110,105,48,52,67,48,117,110,105,48,52,67,70,
+117,110,105,50,49,54,48,117,110,105,49,68,51,53,117,110,105,48,50,54,65,117,
+110,105,49,68,65,54,117,110,105,48,50,48,56,117,110,105,48,50,48,65,73,98,
+114,101,118,101,117,110,105,48,49,67,70,73,116,105,108,100,101,73,109,97,
+99,114,111,110,117,110,105,48,52,48,55,117,110,105,49,69,50,69,73,100,111,
+116,97,99,99,101,110,116,117,110,105,49,69,67,56,117,110,105,49,69,50,67,
+117,110,105,49,69,67,65,73,111,103,111,110,101,107,117,110,105,48,49,57,55,
+117,110,105,49,68,55,66,117,110,105,49,68,65,55,117,110,105,65,55,70,69,73,
+74,117,110,105,50,49,54,49,117,110,105,50,49,54,50,117,110,105,50,49,54,51,
+117,110,105,50,49,54,56,117,110,105,48,49,57,54,117,110,105,48,52,50,69,117,
+110,105,65,55,70,55,117,110,105,48,52,53,56,117,110,105,50,67,55,67,117,110,
+105,48,50,66,50,106,99,105,114,99,117,109,102,108,101,120,117,110,105,48,
+49,70,48,117,110,105,48,50,52,57,117,110,105,48,50,57,68,117,110,105,49,68,
+65,56,117,110,105,48,50,51,55,117,110,105,48,50,53,70,117,110,105,49,68,65,
+49,117,110,105,48,50,56,52,117,110,105,65,55,54,68,117,110,105,48,52,51,66,
+117,110,105,48,53,50,70,117,110,105,48,52,67,54,117,110,105,48,52,53,57,117,
+110,105,48,53,49,51,117,110,105,48,53,48,57,117,110,105,48,53,50,49,117,110,
+105,48,52,51,52,117,110,105,48,53,50,66,117,110,105,48,53,49,53,117,110,105,
+48,52,48,56,117,110,105,49,68,51,54,117,110,105,49,68,48,65,74,99,105,114,
+99,117,109,102,108,101,120,117,110,105,48,50,52,56,117,110,105,65,55,66,50,
+117,110,105,65,55,54,67,117,110,105,48,52,49,66,117,110,105,49,68,50,66,117,
+110,105,48,53,50,69,117,110,105,48,52,67,53,117,110,105,48,52,48,57,117,110,
+105,48,53,49,50,117,110,105,48,53,48,56,117,110,105,48,53,50,48,117,110,105,
+48,53,49,52,117,110,105,48,52,49,52,117,110,105,48,53,50,65,117,110,105,50,
+48,57,54,117,110,105,49,68,52,70,117,110,105,49,69,51,49,117,110,105,48,49,
+69,57,117,110,105,49,69,51,53,117,110,105,49,69,51,51,107,99,111,109,109,
+97,97,99,99,101,110,116,117,110,105,49,68,56,52,117,110,105,65,55,52,49,117,
+110,105,65,55,52,53,117,110,105,65,55,52,51,117,110,105,65,55,65,51,117,110,
+105,48,49,57,57,117,110,105,50,67,54,65,117,110,105,48,50,57,69,107,103,114,
+101,101,110,108,97,110,100,105,99,117,110,105,48,52,51,65,117,110,105,48,
+52,53,67,117,110,105,48,52,57,66,117,110,105,48,52,65,49,117,110,105,48,52,
+57,70,117,110,105,48,52,57,68,117,110,105,48,52,67,52,117,110,105,48,53,49,
+70,117,110,105,48,52,51,54,117,110,105,48,52,67,50,117,110,105,48,52,68,68,
+117,110,105,48,52,57,55,117,110,105,49,68,51,55,117,110,105,49,68,48,66,117,
+110,105,49,69,51,48,117,110,105,48,49,69,56,117,110,105,49,69,51,52,117,110,
+105,49,69,51,50,75,99,111,109,109,97,97,99,99,101,110,116,117,110,105,65,
+55,52,48,117,110,105,65,55,52,52,117,110,105,65,55,52,50,117,110,105,65,55,
+65,50,117,110,105,48,49,57,56,117,110,105,50,67,54,57,117,110,105,65,55,66,
+48,117,110,105,50,48,65,68,117,110,105,48,52,49,65,117,110,105,48,52,48,67,
+117,110,105,48,52,57,65,117,110,105,48,52,65,48,117,110,105,48,52,57,69,117,
+110,105,48,52,57,67,117,110,105,48,52,67,51,117,110,105,48,53,49,69,117,110,
+105,48,52,49,54,117,110,105,48,52,67,49,117,110,105,48,52,68,67,117,110,105,
+48,52,57,54,117,110,105,50,49,55,67,117,110,105,50,48,57,55,117,110,105,48,
+50,69,49,108,97,99,117,116,101,117,110,105,49,69,51,68,117,110,105,49,69,
+51,66,117,110,105,49,69,51,55,117,110,105,49,69,51,57,108,99,111,109,109,
+97,97,99,99,101,110,116,108,100,111,116,108,99,97,114,111,110,117,110,105,
+49,68,56,53,117,110,105,49,68,65,65,117,110,105,48,49,57,65,117,110,105,65,
+55,52,57,117,110,105,50,67,54,49,117,110,105,48,50,54,66,117,110,105,48,50,
+54,68,117,110,105,49,68,65,57,117,110,105,48,50,51,52,117,110,105,48,50,54,
+67,117,110,105,65,55,56,69,117,110,105,65,55,52,55,117,110,105,65,55,56,49,
+117,110,105,65,55,55,50,117,110,105,48,49,67,57,117,110,105,49,69,70,66,117,
+110,105,48,50,65,65,117,110,105,50,48,66,54,117,110,105,50,48,66,65,117,110,
+105,48,50,65,66,117,110,105,48,50,54,69,117,110,105,50,49,49,51,117,110,105,
+50,48,66,48,108,105,114,97,117,110,105,50,49,54,67,117,110,105,49,68,51,56,
+117,110,105,48,50,57,70,117,110,105,49,68,65,66,76,97,99,117,116,101,117,
+110,105,49,69,51,67,117,110,105,49,69,51,65,117,110,105,49,69,51,54,117,110,
+105,49,69,51,56,76,99,111,109,109,97,97,99,99,101,110,116,76,100,111,116,
+76,99,97,114,111,110,117,110,105,48,50,51,68,117,110,105,65,55,52,56,117,
+110,105,50,67,54,48,117,110,105,50,67,54,50,117,110,105,49,68,48,67,117,110,
+105,65,55,65,68,117,110,105,65,55,52,54,117,110,105,65,55,56,48,117,110,105,
+48,49,67,56,117,110,105,48,49,67,55,117,110,105,49,69,70,65,117,110,105,50,
+49,55,70,117,110,105,50,48,57,56,117,110,105,49,68,53,48,117,110,105,48,51,
+54,66,117,110,105,49,69,51,70,117,110,105,49,69,52,49,117,110,105,49,69,52,
+51,117,110,105,49,68,56,54,117,110,105,49,68,54,70,117,110,105,50,48,65,53,
+117,110,105,65,55,55,51,117,110,105,48,50,55,49,117,110,105,49,68,65,67,117,
+110,105,48,50,54,70,117,110,105,49,68,53,65,117,110,105,48,50,55,48,117,110,
+105,49,68,65,68,117,110,105,49,68,49,70,117,110,105,48,52,51,67,117,110,105,
+48,52,67,69,117,110,105,48,52,49,67,117,110,105,50,49,54,70,117,110,105,49,
+68,51,57,117,110,105,49,68,48,68,117,110,105,49,69,51,69,117,110,105,49,69,
+52,48,117,110,105,49,69,52,50,117,110,105,50,67,54,69,117,110,105,65,55,70,
+65,117,110,105,48,49,57,67,117,110,105,65,55,70,68,117,110,105,65,55,70,70,
+117,110,105,48,52,67,68,117,110,105,50,49,51,53,117,110,105,50,48,57,57,117,
+110,105,50,48,55,70,110,97,99,117,116,101,117,110,105,48,49,70,57,110,99,
+97,114,111,110,117,110,105,49,69,52,53,117,110,105,49,69,52,66,117,110,105,
+49,69,52,57,117,110,105,49,69,52,55,110,99,111,109,109,97,97,99,99,101,110,
+116,117,110,105,49,68,56,55,117,110,105,49,68,55,48,117,110,105,65,55,65,
+53,117,110,105,65,55,55,52,117,110,105,48,50,55,50,117,110,105,49,68,65,69,
+101,110,103,117,110,105,49,68,53,49,117,110,105,48,50,55,51,117,110,105,49,
+68,65,70,117,110,105,48,50,51,53,117,110,105,65,55,57,49,117,110,105,48,49,
+57,69,117,110,105,48,49,67,67,117,110,105,48,52,51,56,117,110,105,48,52,53,
+68,117,110,105,48,52,51,57,117,110,105,48,52,56,66,117,110,105,48,52,69,51,
+117,110,105,48,52,69,53,117,110,105,49,68,51,65,117,110,105,48,50,55,52,117,
+110,105,49,68,66,48,78,97,99,117,116,101,117,110,105,48,49,70,56,78,99,97,
+114,111,110,117,110,105,49,69,52,52,117,110,105,49,69,52,65,117,110,105,49,
+69,52,56,117,110,105,49,69,52,54,78,99,111,109,109,97,97,99,99,101,110,116,
+117,110,105,50,48,65,54,117,110,105,65,55,65,52,117,110,105,48,49,57,68,117,
+110,105,65,55,57,48,117,110,105,49,68,48,69,117,110,105,49,68,51,66,69,110,
+103,117,110,105,48,50,50,48,117,110,105,48,49,67,66,117,110,105,48,49,67,
+65,117,110,105,50,49,49,54,117,110,105,48,52,49,56,117,110,105,48,52,48,68,
+117,110,105,48,52,49,57,117,110,105,48,52,56,65,117,110,105,48,52,69,52,117,
+110,105,48,52,69,50,117,110,105,48,52,51,69,117,110,105,50,48,57,50,117,110,
+105,49,68,53,50,117,110,105,48,51,54,54,111,104,117,110,103,97,114,117,109,
+108,97,117,116,117,110,105,48,50,48,68,117,110,105,49,69,68,49,117,110,105,
+49,69,68,51,117,110,105,49,69,68,55,117,110,105,49,69,68,53,117,110,105,49,
+69,68,57,117,110,105,48,50,48,70,111,98,114,101,118,101,117,110,105,48,49,
+68,50,117,110,105,49,69,52,68,117,110,105,48,50,50,68,117,110,105,49,69,52,
+70,111,109,97,99,114,111,110,117,110,105,49,69,53,51,117,110,105,49,69,53,
+49,117,110,105,48,52,69,55,117,110,105,48,50,50,66,117,110,105,48,50,50,70,
+117,110,105,48,50,51,49,117,110,105,49,69,67,70,117,110,105,49,69,67,68,117,
+110,105,48,49,69,66,117,110,105,48,49,69,68,117,110,105,48,49,56,68,117,110,
+105,48,50,55,53,117,110,105,48,52,69,57,117,110,105,49,68,66,49,117,110,105,
+48,52,69,66,116,104,101,116,97,117,110,105,65,55,52,66,117,110,105,49,68,
+66,70,117,110,105,48,52,55,51,111,115,108,97,115,104,97,99,117,116,101,101,
+109,112,116,121,115,101,116,117,110,105,65,55,52,68,117,110,105,65,55,55,
+65,111,104,111,114,110,117,110,105,49,69,68,66,117,110,105,49,69,68,68,117,
+110,105,49,69,69,49,117,110,105,49,69,68,70,117,110,105,49,69,69,51,115,105,
+103,109,97,117,110,105,48,52,65,57,117,110,105,49,68,49,49,117,110,105,49,
+68,49,51,117,110,105,65,55,70,57,117,110,105,49,68,49,52,117,110,105,48,49,
+65,51,117,110,105,65,55,52,70,117,110,105,48,50,50,51,117,110,105,49,68,49,
+55,117,110,105,49,68,53,53,117,110,105,49,68,49,54,117,110,105,49,68,53,52,
+117,110,105,48,52,49,69,117,110,105,49,68,51,67,117,110,105,49,68,48,70,79,
+104,117,110,103,97,114,117,109,108,97,117,116,117,110,105,48,50,48,67,117,
+110,105,49,69,68,48,117,110,105,49,69,68,50,117,110,105,49,69,68,54,117,110,
+105,49,69,68,52,117,110,105,49,69,68,56,117,110,105,48,50,48,69,79,98,114,
+101,118,101,117,110,105,48,49,68,49,117,110,105,49,69,52,67,117,110,105,48,
+50,50,67,117,110,105,49,69,52,69,79,109,97,99,114,111,110,117,110,105,49,
+69,53,50,117,110,105,49,69,53,48,117,110,105,48,52,69,54,117,110,105,48,50,
+50,65,117,110,105,48,50,50,69,117,110,105,48,50,51,48,117,110,105,49,69,67,
+69,117,110,105,49,69,67,67,117,110,105,48,49,69,65,117,110,105,48,49,69,67,
+117,110,105,48,49,57,70,117,110,105,48,52,69,56,117,110,105,48,52,69,65,84,
+104,101,116,97,117,110,105,65,55,52,65,117,110,105,48,52,55,50,79,115,108,
+97,115,104,97,99,117,116,101,117,110,105,65,55,52,67,117,110,105,65,55,55,
+57,79,104,111,114,110,117,110,105,49,69,68,65,117,110,105,49,69,68,67,117,
+110,105,49,69,69,48,117,110,105,49,69,68,69,117,110,105,49,69,69,50,117,110,
+105,48,52,65,56,117,110,105,48,50,55,54,117,110,105,48,49,65,50,117,110,105,
+65,55,52,69,117,110,105,48,50,50,50,117,110,105,49,68,51,68,117,110,105,49,
+68,49,53,117,110,105,48,51,65,57,117,110,105,65,66,54,53,117,110,105,48,50,
+57,56,117,110,105,48,52,52,48,117,110,105,50,48,57,65,117,110,105,49,68,53,
+54,117,110,105,49,69,53,53,117,110,105,49,69,53,55,117,110,105,49,68,56,56,
+117,110,105,49,68,55,68,117,110,105,65,55,53,49,117,110,105,48,52,56,70,117,
+110,105,49,68,55,49,117,110,105,48,49,65,53,117,110,105,65,55,54,53,117,110,
+105,65,55,54,55,117,110,105,65,55,53,53,117,110,105,65,55,53,51,117,110,105,
+48,53,49,55,117,110,105,48,49,66,70,114,104,111,117,110,105,49,68,54,56,117,
+110,105,48,50,55,56,117,110,105,49,68,66,50,117,110,105,48,52,52,52,112,104,
+105,117,110,105,49,68,54,57,117,110,105,49,68,54,48,117,110,105,50,67,55,
+55,117,110,105,48,52,50,48,117,110,105,49,68,51,69,117,110,105,49,68,49,56,
+117,110,105,49,68,50,57,117,110,105,49,69,53,52,117,110,105,49,69,53,54,117,
+110,105,50,67,54,51,117,110,105,65,55,53,48,117,110,105,48,52,56,69,117,110,
+105,48,49,65,52,117,110,105,65,55,53,52,117,110,105,65,55,53,50,117,110,105,
+50,49,49,55,117,110,105,48,53,49,54,117,110,105,50,48,66,68,117,110,105,50,
+48,66,49,112,101,115,101,116,97,117,110,105,65,55,54,52,117,110,105,65,55,
+54,54,117,110,105,48,49,70,55,117,110,105,65,55,70,67,117,110,105,48,52,50,
+52,117,110,105,48,53,49,66,117,110,105,65,55,53,55,117,110,105,65,55,53,57,
+117,110,105,48,50,65,48,117,110,105,48,50,52,66,117,110,105,48,49,65,65,117,
+110,105,48,50,51,57,117,110,105,48,53,49,65,117,110,105,48,50,52,65,117,110,
+105,65,55,53,54,117,110,105,65,55,53,56,117,110,105,49,68,54,51,117,110,105,
+49,68,67,65,117,110,105,48,50,66,51,117,110,105,48,51,54,67,114,97,99,117,
+116,101,117,110,105,48,50,49,49,117,110,105,48,50,49,51,114,99,97,114,111,
+110,117,110,105,49,69,53,57,117,110,105,49,69,53,70,117,110,105,49,69,53,
+66,117,110,105,49,69,53,68,114,99,111,109,109,97,97,99,99,101,110,116,117,
+110,105,49,68,56,57,117,110,105,48,50,52,68,117,110,105,49,68,55,50,117,110,
+105,65,55,65,55,117,110,105,48,50,55,68,117,110,105,48,50,55,67,117,110,105,
+65,55,53,66,117,110,105,65,55,53,68,117,110,105,65,55,56,51,117,110,105,65,
+55,56,53,117,110,105,65,55,55,67,117,110,105,48,50,55,57,117,110,105,48,50,
+66,52,117,110,105,48,50,55,66,117,110,105,48,50,66,53,117,110,105,48,50,55,
+65,117,110,105,50,67,55,57,117,110,105,48,50,55,69,117,110,105,49,68,55,51,
+117,110,105,65,55,55,53,117,110,105,48,50,56,53,117,110,105,48,50,55,70,117,
+110,105,49,68,51,70,117,110,105,48,50,56,48,82,97,99,117,116,101,117,110,
+105,48,50,49,48,117,110,105,48,50,49,50,82,99,97,114,111,110,117,110,105,
+49,69,53,56,117,110,105,49,69,53,69,117,110,105,49,69,53,65,117,110,105,49,
+69,53,67,82,99,111,109,109,97,97,99,99,101,110,116,117,110,105,48,50,52,67,
+117,110,105,65,55,65,54,117,110,105,50,67,54,52,117,110,105,65,55,53,65,117,
+110,105,65,55,53,67,117,110,105,65,55,56,50,117,110,105,65,55,56,52,117,110,
+105,65,55,55,66,117,110,105,48,49,65,54,117,110,105,50,48,65,56,117,110,105,
+50,48,66,57,117,110,105,50,49,49,70,117,110,105,49,68,49,65,117,110,105,48,
+50,56,49,117,110,105,48,50,66,54,117,110,105,65,55,55,54,117,110,105,48,52,
+50,70,117,110,105,49,68,49,57,117,110,105,48,52,52,70,117,110,105,48,53,49,
+57,117,110,105,48,53,49,56,117,110,105,48,52,53,53,117,110,105,50,48,57,66,
+117,110,105,48,50,69,50,115,97,99,117,116,101,117,110,105,49,69,54,53,115,
+99,105,114,99,117,109,102,108,101,120,117,110,105,49,69,54,55,117,110,105,
+49,69,54,49,117,110,105,49,69,54,51,117,110,105,49,69,54,57,117,110,105,48,
+50,49,57,115,99,101,100,105,108,108,97,117,110,105,48,50,56,50,117,110,105,
+49,68,66,51,117,110,105,49,68,56,65,117,110,105,49,68,55,52,117,110,105,65,
+55,65,57,117,110,105,48,50,51,70,117,110,105,48,49,65,56,117,110,105,48,50,
+56,51,117,110,105,49,68,66,52,117,110,105,49,68,57,56,117,110,105,49,68,56,
+66,117,110,105,48,50,56,54,117,110,105,65,55,55,56,117,110,105,48,52,48,53,
+117,110,105,65,55,51,49,83,97,99,117,116,101,117,110,105,49,69,54,52,83,99,
+105,114,99,117,109,102,108,101,120,117,110,105,49,69,54,54,117,110,105,49,
+69,54,48,117,110,105,49,69,54,50,117,110,105,49,69,54,56,117,110,105,48,50,
+49,56,83,99,101,100,105,108,108,97,117,110,105,65,55,65,56,117,110,105,50,
+67,55,69,117,110,105,48,49,65,55,117,110,105,50,48,66,52,117,110,105,50,48,
+66,55,117,110,105,50,48,57,67,117,110,105,49,68,53,55,117,110,105,48,51,54,
+68,117,110,105,49,69,57,55,117,110,105,49,69,54,66,117,110,105,49,69,55,49,
+117,110,105,49,69,54,70,117,110,105,49,69,54,68,117,110,105,48,50,49,66,116,
+99,97,114,111,110,117,110,105,48,49,54,51,117,110,105,48,49,65,66,117,110,
+105,49,68,66,53,116,98,97,114,117,110,105,49,68,55,53,117,110,105,50,67,54,
+54,117,110,105,48,49,65,68,117,110,105,48,50,56,56,117,110,105,48,50,51,54,
+117,110,105,65,55,55,55,117,110,105,49,68,55,65,117,110,105,48,50,65,56,117,
+110,105,48,50,65,54,117,110,105,48,50,65,55,117,110,105,65,55,50,57,117,110,
+105,65,55,56,55,117,110,105,48,50,56,55,117,110,105,48,52,52,50,117,110,105,
+48,52,65,68,117,110,105,48,53,48,70,117,110,105,48,52,66,53,117,110,105,48,
+52,50,50,117,110,105,49,68,52,48,117,110,105,49,68,49,66,84,99,97,114,111,
+110,117,110,105,50,48,66,56,117,110,105,49,69,54,65,117,110,105,49,69,55,
+48,117,110,105,49,69,54,69,117,110,105,49,69,54,67,117,110,105,48,50,49,65,
+117,110,105,48,49,54,50,84,98,97,114,117,110,105,50,48,65,69,117,110,105,
+48,50,51,69,117,110,105,48,49,65,67,117,110,105,48,49,65,69,117,110,105,65,
+55,50,56,117,110,105,65,55,56,54,117,110,105,65,55,66,49,117,110,105,48,52,
+65,67,117,110,105,48,53,48,69,117,110,105,48,52,66,52,117,110,105,48,52,48,
+66,117,110,105,48,52,48,50,117,110,105,49,68,54,52,117,110,105,49,68,53,56,
+117,110,105,48,51,54,55,117,104,117,110,103,97,114,117,109,108,97,117,116,
+117,110,105,48,50,49,53,117,110,105,48,50,49,55,117,98,114,101,118,101,117,
+110,105,48,49,68,52,117,116,105,108,100,101,117,110,105,49,69,55,57,117,109,
+97,99,114,111,110,117,110,105,49,69,55,66,117,110,105,48,49,68,56,117,110,
+105,48,49,68,67,117,110,105,48,49,68,65,117,110,105,48,49,68,54,117,114,105,
+110,103,117,110,105,49,69,69,55,117,110,105,49,69,55,55,117,110,105,49,69,
+55,53,117,110,105,49,69,55,51,117,110,105,49,69,69,53,117,111,103,111,110,
+101,107,117,110,105,49,68,57,57,117,110,105,48,50,56,57,117,110,105,49,68,
+66,54,117,104,111,114,110,117,110,105,49,69,69,57,117,110,105,49,69,69,66,
+117,110,105,49,69,69,70,117,110,105,49,69,69,68,117,110,105,49,69,70,49,117,
+110,105,49,68,54,66,117,110,105,49,68,49,68,117,110,105,49,68,53,57,117,110,
+105,49,68,49,69,117,110,105,48,50,56,66,117,110,105,49,68,66,57,117,110,105,
+48,51,66,67,117,110,105,48,50,56,65,117,110,105,49,68,66,55,117,110,105,49,
+68,55,70,117,110,105,49,68,52,49,117,110,105,49,68,49,67,117,110,105,49,68,
+66,56,85,104,117,110,103,97,114,117,109,108,97,117,116,117,110,105,48,50,
+49,52,117,110,105,48,50,49,54,85,98,114,101,118,101,117,110,105,48,49,68,
+51,85,116,105,108,100,101,117,110,105,49,69,55,56,85,109,97,99,114,111,110,
+117,110,105,49,69,55,65,117,110,105,48,49,68,55,117,110,105,48,49,68,66,117,
+110,105,48,49,68,57,117,110,105,48,49,68,53,85,114,105,110,103,117,110,105,
+49,69,69,54,117,110,105,49,69,55,54,117,110,105,49,69,55,52,117,110,105,49,
+69,55,50,117,110,105,49,69,69,52,85,111,103,111,110,101,107,117,110,105,48,
+50,52,52,117,110,105,49,68,55,69,85,104,111,114,110,117,110,105,49,69,69,
+56,117,110,105,49,69,69,65,117,110,105,49,69,69,69,117,110,105,49,69,69,67,
+117,110,105,49,69,70,48,117,110,105,48,49,66,50,117,110,105,65,55,53,69,117,
+110,105,65,55,54,48,117,110,105,65,55,54,56,117,110,105,48,49,66,49,117,110,
+105,50,49,55,52,117,110,105,49,68,54,53,117,110,105,49,68,53,66,117,110,105,
+48,51,54,69,117,110,105,49,69,55,68,117,110,105,49,69,55,70,117,110,105,49,
+68,56,67,117,110,105,50,67,55,49,117,110,105,48,52,55,52,117,110,105,50,67,
+55,52,117,110,105,65,55,53,70,117,110,105,65,55,54,49,117,110,105,65,55,54,
+57,117,110,105,50,49,55,53,117,110,105,50,49,55,54,117,110,105,50,49,55,55,
+117,110,105,48,50,56,67,117,110,105,49,68,66,65,117,110,105,48,50,54,52,117,
+110,105,48,50,54,51,117,110,105,48,50,69,48,103,97,109,109,97,117,110,105,
+49,68,54,55,117,110,105,49,68,53,69,117,110,105,50,49,54,52,117,110,105,50,
+67,55,68,117,110,105,49,68,50,48,117,110,105,49,69,55,67,117,110,105,49,69,
+55,69,117,110,105,50,49,50,51,117,110,105,48,52,55,53,117,110,105,50,49,54,
+53,117,110,105,50,49,54,54,117,110,105,50,49,54,55,117,110,105,48,50,52,53,
+117,110,105,49,68,50,55,117,110,105,48,49,57,52,117,110,105,48,53,49,68,117,
+110,105,48,50,66,55,119,97,99,117,116,101,119,103,114,97,118,101,119,99,105,
+114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,115,117,110,
+105,49,69,56,55,117,110,105,49,69,57,56,117,110,105,49,69,56,57,117,110,105,
+50,67,55,51,117,110,105,48,50,65,67,117,110,105,48,50,56,68,111,109,101,103,
+97,117,110,105,48,50,55,55,117,110,105,48,53,49,67,117,110,105,49,68,52,50,
+117,110,105,49,68,50,49,87,97,99,117,116,101,87,103,114,97,118,101,87,99,
+105,114,99,117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,117,
+110,105,49,69,56,54,117,110,105,49,69,56,56,117,110,105,50,67,55,50,117,110,
+105,50,48,65,57,117,110,105,48,52,52,53,117,110,105,50,49,55,57,117,110,105,
+50,48,57,51,117,110,105,48,50,69,51,117,110,105,48,51,54,70,117,110,105,49,
+69,56,68,117,110,105,49,69,56,66,117,110,105,49,68,56,68,117,110,105,48,52,
+70,70,117,110,105,48,52,70,68,117,110,105,48,52,66,51,117,110,105,50,49,55,
+65,117,110,105,50,49,55,66,99,104,105,117,110,105,49,68,54,65,117,110,105,
+49,68,54,49,117,110,105,48,52,50,53,117,110,105,50,49,54,57,117,110,105,49,
+69,56,67,117,110,105,49,69,56,65,117,110,105,48,52,70,69,117,110,105,48,52,
+70,67,117,110,105,48,52,66,50,117,110,105,50,49,54,65,117,110,105,50,49,54,
+66,117,110,105,48,52,52,51,117,110,105,48,50,66,56,117,110,105,48,52,70,51,
+121,103,114,97,118,101,121,99,105,114,99,117,109,102,108,101,120,117,110,
+105,48,52,53,69,117,110,105,49,69,70,57,117,110,105,48,50,51,51,117,110,105,
+48,52,69,70,117,110,105,48,52,70,49,117,110,105,49,69,56,70,117,110,105,49,
+69,57,57,117,110,105,49,69,70,55,117,110,105,49,69,70,53,117,110,105,48,50,
+52,70,117,110,105,48,49,66,52,117,110,105,49,69,70,70,117,110,105,48,52,65,
+70,117,110,105,48,52,66,49,117,110,105,48,50,56,69,108,97,109,98,100,97,117,
+110,105,48,49,57,66,117,110,105,48,52,52,55,117,110,105,48,52,70,53,117,110,
+105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,48,52,67,67,117,110,105,
+48,53,50,68,117,110,105,48,52,65,69,117,110,105,48,50,56,70,89,103,114,97,
+118,101,89,99,105,114,99,117,109,102,108,101,120,117,110,105,49,69,70,56,
+117,110,105,48,50,51,50,117,110,105,49,69,56,69,117,110,105,49,69,70,54,117,
+110,105,49,69,70,52,117,110,105,48,50,52,69,117,110,105,48,52,66,48,117,110,
+105,48,49,66,51,117,110,105,49,69,70,69,117,110,105,48,52,50,51,117,110,105,
+48,52,70,50,117,110,105,48,52,48,69,117,110,105,48,52,69,69,117,110,105,48,
+52,70,48,117,110,105,48,52,50,55,117,110,105,48,52,70,52,117,110,105,48,52,
+66,56,117,110,105,48,52,66,54,117,110,105,48,52,67,66,117,110,105,48,53,50,
+67,80,115,105,117,110,105,49,68,50,65,117,110,105,49,68,66,66,122,97,99,117,
+116,101,117,110,105,49,69,57,49,122,100,111,116,97,99,99,101,110,116,117,
+110,105,49,69,57,53,117,110,105,49,69,57,51,117,110,105,48,50,57,48,117,110,
+105,49,68,66,67,117,110,105,49,68,56,69,117,110,105,48,49,66,54,117,110,105,
+49,68,55,54,117,110,105,48,50,57,49,117,110,105,49,68,66,68,117,110,105,48,
+50,50,53,117,110,105,50,67,54,67,117,110,105,48,50,52,48,117,110,105,65,55,
+54,51,117,110,105,49,68,50,50,90,97,99,117,116,101,117,110,105,49,69,57,48,
+90,100,111,116,97,99,99,101,110,116,117,110,105,49,69,57,52,117,110,105,49,
+69,57,50,117,110,105,48,49,66,53,117,110,105,48,50,50,52,117,110,105,50,67,
+54,66,117,110,105,50,67,55,70,117,110,105,65,55,54,50,117,110,105,48,49,65,
+57,117,110,105,48,50,57,50,117,110,105,48,52,69,49,117,110,105,49,68,66,69,
+117,110,105,48,49,69,70,117,110,105,49,68,57,65,117,110,105,48,50,57,51,117,
+110,105,48,49,66,65,117,110,105,48,49,66,57,117,110,105,65,55,50,66,117,110,
+105,48,50,49,68,117,110,105,65,55,54,66,117,110,105,48,49,66,55,117,110,105,
+48,52,69,48,117,110,105,49,68,50,51,117,110,105,48,49,69,69,117,110,105,48,
+49,66,56,117,110,105,65,55,50,65,117,110,105,48,50,49,67,117,110,105,65,55,
+54,65,117,110,105,48,50,57,52,117,110,105,48,50,67,48,117,110,105,48,50,52,
+50,117,110,105,48,50,52,49,117,110,105,48,50,65,49,117,110,105,48,50,57,53,
+117,110,105,48,50,67,49,117,110,105,48,50,69,52,117,110,105,48,50,65,50,117,
+110,105,48,50,57,54,117,110,105,48,49,66,69,117,110,105,49,68,50,52,117,110,
+105,49,68,50,53,117,110,105,49,68,53,67,117,110,105,50,49,52,70,117,110,105,
+50,48,65,65,117,110,105,50,48,66,66,117,110,105,50,48,66,67,117,110,105,50,
+48,56,48,117,110,105,50,48,55,48,117,110,105,50,48,56,49,117,110,105,50,48,
+56,50,117,110,105,48,49,66,66,117,110,105,50,49,56,57,117,110,105,50,48,56,
+51,117,110,105,50,48,56,52,117,110,105,50,48,55,52,117,110,105,65,55,50,67,
+117,110,105,65,55,50,69,117,110,105,65,55,50,68,117,110,105,65,55,50,70,117,
+110,105,50,48,56,53,117,110,105,50,48,55,53,117,110,105,48,49,66,67,117,110,
+105,48,49,66,68,117,110,105,50,48,56,54,117,110,105,50,48,55,54,117,110,105,
+49,69,70,68,117,110,105,49,69,70,67,117,110,105,50,48,56,55,117,110,105,50,
+48,55,55,117,110,105,50,48,56,56,117,110,105,50,48,55,56,117,110,105,50,48,
+56,57,117,110,105,50,48,55,57,117,110,105,65,55,54,69,117,110,105,65,55,54,
+70,117,110,105,65,55,55,48,117,110,105,50,49,53,70,117,110,105,50,49,53,50,
+117,110,105,50,49,53,53,117,110,105,50,49,53,57,117,110,105,50,49,53,48,117,
+110,105,50,49,53,49,117,110,105,50,49,53,54,117,110,105,50,49,53,55,117,110,
+105,50,49,53,56,117,110,105,50,49,53,65,117,110,105,48,49,67,51,117,110,105,
+65,55,49,68,117,110,105,65,55,49,70,117,110,105,65,55,49,69,101,120,99,108,
+97,109,100,98,108,117,110,105,65,55,56,66,117,110,105,65,55,56,67,117,110,
+105,48,50,70,56,117,110,105,65,55,56,57,117,110,105,48,50,66,66,117,110,105,
+48,51,49,50,113,117,111,116,101,114,101,118,101,114,115,101,100,117,110,105,
+48,50,66,68,117,110,105,48,51,49,52,117,110,105,48,50,66,67,117,110,105,50,
+48,49,70,117,110,105,48,50,69,69,117,110,105,48,50,68,48,117,110,105,48,50,
+68,49,97,110,111,116,101,108,101,105,97,117,110,105,50,48,50,55,117,110,105,
+50,50,49,57,117,110,105,50,48,56,68,117,110,105,50,48,55,68,117,110,105,50,
+48,56,69,117,110,105,50,48,55,69,117,110,105,50,55,69,54,117,110,105,50,55,
+69,55,117,110,105,50,51,48,56,117,110,105,50,51,49,67,117,110,105,50,51,48,
+57,117,110,105,50,51,49,68,117,110,105,50,51,48,65,117,110,105,50,51,49,69,
+117,110,105,50,51,48,66,117,110,105,50,51,49,70,117,110,105,50,51,57,66,117,
+110,105,50,51,57,67,117,110,105,50,51,57,68,117,110,105,50,51,57,69,117,110,
+105,50,51,57,70,117,110,105,50,51,65,48,117,110,105,50,51,65,49,117,110,105,
+50,51,65,50,117,110,105,50,51,65,51,117,110,105,50,51,65,52,117,110,105,50,
+51,65,53,117,110,105,50,51,65,54,117,110,105,50,51,65,55,117,110,105,50,51,
+65,56,117,110,105,50,51,65,65,117,110,105,50,51,65,57,117,110,105,50,51,65,
+66,117,110,105,50,51,65,67,117,110,105,50,51,65,68,117,110,105,48,49,67,48,
+117,110,105,48,49,67,49,117,110,105,48,49,67,50,117,110,105,50,48,49,54,117,
+110,105,50,50,50,53,117,110,105,50,50,50,54,117,110,105,50,50,51,52,117,110,
+105,50,50,51,53,117,110,105,50,50,54,50,117,110,105,50,50,56,50,117,110,105,
+50,50,56,54,117,110,105,50,50,56,52,117,110,105,50,50,56,51,117,110,105,50,
+50,56,55,117,110,105,50,50,56,53,117,110,105,48,50,67,67,117,110,105,48,50,
+67,56,117,110,105,48,51,51,55,117,110,105,48,51,51,56,117,110,105,50,48,69,
+53,117,110,105,50,48,52,49,117,110,105,50,48,49,48,117,110,105,50,48,49,49,
+117,110,105,48,48,65,68,117,110,105,50,69,51,65,117,110,105,50,69,51,66,117,
+110,105,50,48,49,53,117,110,105,48,50,68,55,117,110,105,50,48,56,66,117,110,
+105,50,48,55,66,117,110,105,48,51,50,48,117,110,105,48,51,51,53,117,110,105,
+48,51,51,54,117,110,105,48,50,67,70,117,110,105,48,51,49,55,117,110,105,48,
+50,67,65,97,99,117,116,101,99,111,109,98,109,105,110,117,116,101,117,110,
+105,48,50,66,57,115,101,99,111,110,100,117,110,105,48,50,66,65,117,110,105,
+48,50,70,54,117,110,105,48,51,48,66,117,110,105,50,48,51,52,117,110,105,50,
+48,53,55,117,110,105,48,50,67,69,117,110,105,48,51,49,54,117,110,105,48,50,
+70,52,117,110,105,48,50,67,66,103,114,97,118,101,99,111,109,98,117,110,105,
+50,48,51,53,117,110,105,50,48,51,54,117,110,105,48,50,70,53,117,110,105,48,
+51,48,70,117,110,105,50,48,51,55,117,110,105,50,48,51,56,117,110,105,48,51,
+50,68,117,110,105,65,55,56,56,117,110,105,48,51,48,50,117,110,105,48,51,50,
+70,117,110,105,48,51,49,49,117,110,105,48,51,53,50,117,110,105,50,48,52,48,
+117,110,105,48,51,54,49,117,110,105,70,69,50,48,117,110,105,70,69,50,49,117,
+110,105,65,57,50,69,117,110,105,48,51,50,69,117,110,105,48,51,48,54,117,110,
+105,48,51,49,48,117,110,105,49,68,67,66,117,110,105,50,48,51,70,117,110,105,
+48,51,53,67,117,110,105,48,51,53,68,117,110,105,49,68,67,68,117,110,105,48,
+50,69,67,117,110,105,48,51,50,67,117,110,105,48,51,48,67,117,110,105,49,68,
+67,55,117,110,105,49,68,67,52,117,110,105,49,68,67,67,117,110,105,49,68,67,
+53,117,110,105,49,68,67,54,117,110,105,49,68,67,57,117,110,105,49,68,67,56,
+117,110,105,48,50,70,55,117,110,105,48,51,51,48,117,110,105,48,51,51,52,116,
+105,108,100,101,99,111,109,98,117,110,105,48,51,52,65,115,105,109,105,108,
+97,114,117,110,105,50,48,53,51,117,110,105,48,51,52,67,117,110,105,49,68,
+70,68,117,110,105,48,51,52,66,117,110,105,48,51,54,48,117,110,105,70,69,50,
+50,117,110,105,70,69,50,51,117,110,105,48,51,51,69,117,110,105,48,51,53,66,
+117,110,105,48,51,53,57,117,110,105,48,51,53,51,117,110,105,48,50,68,70,117,
+110,105,48,51,51,68,117,110,105,48,51,50,66,117,110,105,48,51,51,67,117,110,
+105,48,50,67,68,117,110,105,48,51,51,49,117,110,105,48,50,67,57,117,110,105,
+48,51,48,52,117,110,105,48,51,53,70,117,110,105,48,51,53,69,117,110,105,48,
+51,51,50,117,110,105,48,51,48,53,117,110,100,101,114,115,99,111,114,101,100,
+98,108,117,110,105,48,51,51,51,117,110,105,48,51,52,55,117,110,105,48,51,
+51,70,117,110,105,48,50,69,68,117,110,105,65,55,56,65,117,110,105,50,48,56,
+67,117,110,105,50,48,55,67,117,110,105,50,50,53,70,101,113,117,105,118,97,
+108,101,110,99,101,117,110,105,50,50,49,51,117,110,105,48,51,50,52,117,110,
+105,48,51,48,56,100,111,116,98,101,108,111,119,99,111,109,98,117,110,105,
+48,51,48,55,117,110,105,48,51,53,56,117,110,105,48,51,50,54,117,110,105,48,
+51,49,51,117,110,105,48,51,49,53,117,110,105,48,51,49,66,117,110,105,48,50,
+70,51,117,110,105,48,51,50,53,117,110,105,48,51,48,65,117,110,105,48,51,53,
+65,117,110,105,48,51,49,67,117,110,105,48,50,68,51,117,110,105,48,50,66,70,
+117,110,105,48,51,53,49,117,110,105,48,51,51,57,117,110,105,48,50,68,50,117,
+110,105,48,50,66,69,117,110,105,48,51,53,55,117,110,105,65,55,50,52,117,110,
+105,65,55,50,53,117,110,105,65,55,50,50,117,110,105,65,55,50,51,104,111,111,
+107,97,98,111,118,101,99,111,109,98,117,110,105,48,51,50,57,117,110,105,48,
+51,48,68,117,110,105,48,51,52,56,117,110,105,48,51,48,69,117,110,105,50,48,
+56,65,117,110,105,48,51,49,70,117,110,105,48,50,68,54,117,110,105,50,48,55,
+65,117,110,105,48,51,49,69,117,110,105,48,50,68,53,117,110,105,48,51,49,68,
+117,110,105,48,50,68,52,117,110,105,48,51,49,56,117,110,105,48,51,49,57,117,
+110,105,48,50,69,66,117,110,105,48,50,69,65,117,110,105,48,51,52,57,117,110,
+105,48,51,49,65,117,110,105,65,55,49,55,117,110,105,65,55,49,56,117,110,105,
+65,55,49,57,117,110,105,65,55,49,65,117,110,105,65,55,50,48,117,110,105,65,
+55,50,49,117,110,105,48,50,70,69,117,110,105,48,50,70,68,117,110,105,48,50,
+65,68,117,110,105,48,51,50,55,117,110,105,48,51,50,56,117,110,105,49,68,67,
+50,117,110,105,48,51,50,65,117,110,105,48,51,52,54,117,110,105,48,51,51,65,
+117,110,105,50,52,50,51,117,110,105,48,51,51,66,117,110,105,48,50,68,69,117,
+110,105,65,55,48,56,117,110,105,65,55,48,57,117,110,105,65,55,48,65,117,110,
+105,65,55,48,66,117,110,105,65,55,48,67,117,110,105,48,50,69,53,117,110,105,
+48,50,69,54,117,110,105,48,50,69,55,117,110,105,48,50,69,56,117,110,105,48,
+50,69,57,117,110,105,65,55,48,68,117,110,105,65,55,48,69,117,110,105,65,55,
+48,70,117,110,105,65,55,49,48,117,110,105,65,55,49,49,117,110,105,65,55,49,
+50,117,110,105,65,55,49,51,117,110,105,65,55,49,52,117,110,105,65,55,49,53,
+117,110,105,65,55,49,54,117,110,105,50,55,52,68,117,110,105,50,48,50,51,97,
+114,114,111,119,100,111,119,110,117,110,105,50,49,56,54,117,110,105,65,55,
+49,67,97,114,114,111,119,117,112,117,110,105,65,55,49,66,117,110,105,48,51,
+52,69,97,114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,
+98,115,101,97,114,114,111,119,108,101,102,116,117,110,105,50,48,69,69,117,
+110,105,50,48,69,68,117,110,105,48,50,70,70,97,114,114,111,119,114,105,103,
+104,116,117,110,105,50,48,69,70,117,110,105,50,48,69,67,117,110,105,48,51,
+54,50,97,114,114,111,119,98,111,116,104,117,110,105,48,51,52,68,117,110,105,
+50,49,57,65,117,110,105,50,49,57,66,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,117,110,105,50,49,68,53,97,
+114,114,111,119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,
+114,105,103,104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,
+105,50,49,57,54,117,110,105,50,49,57,56,117,110,105,50,49,57,55,117,110,105,
+50,49,57,57,117,110,105,50,55,49,51,117,110,105,48,50,67,53,117,110,105,48,
+50,69,70,117,110,105,48,50,67,52,117,110,105,48,50,70,48,117,110,105,48,50,
+67,50,117,110,105,49,68,70,69,117,110,105,48,51,53,52,117,110,105,48,50,70,
+49,97,110,103,108,101,108,101,102,116,117,110,105,48,50,67,51,117,110,105,
+48,51,53,48,117,110,105,48,51,53,53,117,110,105,48,50,70,50,97,110,103,108,
+101,114,105,103,104,116,117,110,105,48,51,53,54,117,110,105,49,68,70,70,117,
+110,105,50,54,52,48,117,110,105,50,54,52,50,117,110,105,50,54,54,68,117,110,
+105,50,54,54,70,117,110,105,65,55,48,50,117,110,105,65,55,48,48,117,110,105,
+65,55,48,52,117,110,105,65,55,48,54,117,110,105,65,55,48,51,117,110,105,65,
+55,48,49,117,110,105,65,55,48,53,117,110,105,65,55,48,55,117,110,105,48,51,
+52,70,117,110,105,50,48,54,49,117,110,105,50,48,54,51,117,110,105,50,48,54,
+50,117,110,105,50,48,50,65,117,110,105,50,48,48,69,117,110,105,50,48,50,68,
+117,110,105,50,48,50,67,117,110,105,50,48,50,66,117,110,105,50,48,48,70,117,
+110,105,50,48,50,69,117,110,105,50,48,54,48,117,110,105,50,48,48,68,117,110,
+105,50,48,48,67,117,110,105,50,48,48,66,117,110,105,50,48,54,68,117,110,105,
+50,48,54,66,117,110,105,50,48,54,67,117,110,105,50,48,54,65,117,110,105,50,
+48,50,56,117,110,105,50,48,54,69,117,110,105,50,48,54,70,117,110,105,50,48,
+50,57,117,110,105,50,48,48,49,117,110,105,50,48,48,51,117,110,105,50,48,50,
+70,117,110,105,50,48,48,56,117,110,105,50,48,48,54,117,110,105,50,48,48,52,
+117,110,105,50,48,48,48,117,110,105,50,48,48,50,117,110,105,50,48,48,53,117,
+110,105,50,48,48,55,117,110,105,50,48,48,57,117,110,105,50,48,48,65,117,110,
+105,70,70,70,68,117,110,105,48,50,70,57,117,110,105,48,50,70,66,117,110,105,
+48,50,70,65,117,110,105,48,50,70,67,88,105,67,111,112,121,114,105,103,104,
+116,32,40,99,41,32,83,73,76,32,73,110,116,101,114,110,97,116,105,111,110,
+97,108,44,32,49,57,57,55,45,50,48,49,52,46,67,104,97,114,105,115,32,83,73,
+76,32,66,111,108,100,32,73,116,97,108,105,99,67,104,97,114,105,115,32,83,
+73,76,2,180,2,0,1,0,94,0,101,0,104,0,160,0,201,0,209,0,236,1,57,1,122,1,175,
+1,250,2,94,2,97,2,138,2,170,2,174,2,199,2,240,3,15,3,101,3,118,3,220,3,223,
+3,236,4,1,4,38,4,61,4,68,4,97,4,139,4,178,4,200,5,36,5,55,5,97,5,128,5,138,
+5,153,5,219,5,246,5,249,6,2,6,10,6,52,6,243,6,250,7,11,7,60,7,72,7,118,7,
+121,7,181,7,247,8,24,8,128,9,12,9,66,9,104,9,173,9,204,10,84,10,190,11,62,
+11,196,11,247,12,14,12,114,12,242,12,254,13,88,13,159,13,213,14,19,14,136,
+14,254,15,13,15,132,15,247,16,107,16,222,16,246,17,43,17,155,18,10,18,119,
+18,152,18,200,18,228,19,11,19,101,19,104,19,209,19,238,20,10,20,46,20,73,
+20,93,20,120,20,173,21,17,21,35,21,99,21,110,21,182,22,25,22,34,22,102,22,
+183,22,234,22,246,22,251,23,88,23,131,23,179,23,242,24,72,24,163,24,210,24,
+235,25,15,25,24,25,112,25,144,25,233,26,64,26,83,26,127,26,140,26,151,26,
+228,27,15,27,100,27,185,27,248,28,23,28,29,28,113,28,170,28,220,29,45,29,
+63,29,80,29,109,29,138,29,166,29,245,30,30,30,67,30,106,30,180,30,250,31,
+34,31,46,31,120,31,177,31,243,32,41,32,103,32,157,32,215,33,32,33,103,33,
+173,33,211,34,13,34,39,34,107,34,176,34,211,34,238,35,16,35,72,35,81,35,87,
+35,93,35,137,35,157,35,221,35,240,36,19,36,50,36,111,36,172,36,232,37,7,37,
+20,37,55,37,114,37,171,37,195,37,226,37,248,38,7,38,64,38,104,38,131,38,161,
+38,216,38,243,38,252,39,51,39,65,39,117,39,146,39,199,39,252,40,49,40,91,
+40,110,40,162,40,180,40,189,40,205,41,0,41,15,41,65,41,96,41,136,41,149,41,
+160,41,207,41,242,42,25,42,72,42,91,42,137,42,163,42,179,42,194,42,222,43,
+8,43,54,43,70,43,114,43,132,43,163,43,206,43,250,44,38,44,80,44,94,44,104,
+44,145,44,186,44,190,44,197,44,239,45,21,45,61,45,101,45,117,45,158,45,191,
+45,203,45,214,45,254,46,5,46,43,46,82,46,91,46,130,46,169,46,206,46,217,46,
+249,47,31,47,57,47,93,47,114,47,135,47,156,47,193,47,221,47,240,47,255,48,
+6,48,42,48,78,48,112,48,132,48,144,48,179,48,214,48,249,49,26,49,30,49,64,
+49,98,49,132,49,166,49,177,49,182,49,201,49,220,49,239,50,16,50,49,50,82,
+50,99,50,112,50,130,50,151,50,183,50,215,50,247,51,23,51,53,51,83,51,101,
+51,132,51,147,51,171,51,202,51,233,52,8,52,19,52,48,52,79,52,101,52,130,52,
+146,52,159,52,189,52,219,52,249,53,7,53,30,53,58,53,75,53,82,53,111,53,125,
+53,146,53,175,53,204,53,224,53,251,54,0,54,28,54,56,54,68,54,96,54,124,54,
+150,54,166,54,182,54,198,54,208,54,235,54,246,55,17,55,44,55,51,55,78,55,
+89,55,114,55,128,55,154,55,180,55,206,55,232,55,250,56,20,56,46,56,70,56,
+96,56,102,56,117,56,142,56,167,56,176,56,201,56,226,56,251,57,20,57,43,57,
+56,57,67,57,80,57,91,57,115,57,125,57,145,57,163,57,187,57,193,57,215,57,
+229,57,243,58,1,58,10,58,20,58,43,58,66,58,89,58,112,58,128,58,151,58,174,
+58,187,58,205,58,227,58,249,59,15,59,37,59,59,59,81,59,95,59,117,59,124,59,
+144,59,150,59,163,59,176,59,186,59,196,59,201,59,222,59,243,60,8,60,29,60,
+50,60,71,60,92,60,113,60,134,60,153,60,172,60,192,60,212,60,232,60,252,61,
+16,61,36,61,56,61,76,61,96,61,116,61,136,61,156,61,168,61,180,61,188,61,207,
+61,226,61,234,61,253,62,16,62,35,62,40,62,59,62,78,62,84,62,103,62,122,62,
+141,62,147,62,166,62,185,62,194,62,203,62,221,62,239,63,1,63,19,63,33,63,
+51,63,69,63,87,63,98,63,116,63,124,63,135,63,153,63,171,63,189,63,207,63,
+225,63,243,63,254,64,9,64,20,64,31,64,42,64,53,64,59,64,76,64,93,64,110,64,
+127,64,144,64,161,64,178,64,195,64,212,64,229,64,246,65,7,65,24,65,39,65,
+54,65,70,65,86,65,93,65,109,65,125,65,141,65,157,65,173,65,188,65,204,65,
+220,65,227,65,241,65,251,66,5,66,15,66,25,66,35,66,45,66,53,66,61,66,69,66,
+75,66,90,66,105,66,120,66,135,66,150,66,165,66,180,66,195,66,210,66,225,66,
+240,66,255,67,14,67,29,67,42,67,55,67,69,67,83,67,97,67,111,67,125,67,139,
+67,145,67,159,67,173,67,187,67,201,67,215,67,229,67,243,68,1,68,13,68,17,
+68,26,68,35,68,44,68,53,68,58,68,64,68,77,68,90,68,103,68,116,68,129,68,142,
+68,155,68,168,68,181,68,194,68,207,68,220,68,233,68,246,69,3,69,16,69,29,
+69,42,69,47,69,54,69,61,69,73,69,85,69,97,69,109,69,121,69,133,69,145,69,
+157,69,169,69,181,69,193,69,205,69,217,69,229,69,241,69,253,70,9,70,21,70,
+33,70,45,70,52,70,64,70,74,70,82,70,90,70,98,70,106,70,114,70,122,70,130,
+70,136,70,147,70,158,70,169,70,180,70,191,70,202,70,213,70,224,70,235,70,
+246,71,1,71,12,71,23,71,34,71,45,71,56,71,67,71,78,71,89,71,100,71,111,71,
+122,71,133,71,144,71,153,71,162,71,167,71,180,71,187,71,194,71,201,71,218,
+71,225,71,242,72,0,72,5,72,15,72,38,72,45,72,70,72,86,72,90,72,99,72,110,
+72,121,72,129,72,142,72,157,72,163,72,175,72,182,72,202,72,207,72,215,72,
+253,73,10,73,31,73,47,73,52,73,81,73,127,73,144,73,172,73,189,73,212,73,231,
+73,238,73,248,74,19,74,37,74,83,74,163,74,184,74,246,74,254,75,45,75,81,28,
+4,252,28,5,94,21,254,203,37,6,247,198,29,248,112,29,113,129,135,108,137,8,
+139,78,135,77,132,30,37,250,232,247,186,29,241,248,164,5,247,128,6,157,170,
+127,123,135,31,119,251,46,5,247,43,6,233,248,117,5,251,41,6,96,251,35,5,118,
+133,108,129,118,27,251,123,6,231,248,111,5,247,244,6,162,164,133,119,31,251,
+66,247,55,7,11,28,4,133,200,113,29,11,112,29,14,250,72,249,189,21,200,49,
+247,46,251,93,251,242,251,131,251,248,251,204,251,195,247,84,61,247,70,248,
+88,29,30,247,87,247,85,29,251,158,141,21,251,17,251,60,41,251,33,106,30,247,
+42,176,212,248,9,29,11,28,5,221,249,234,21,248,89,29,252,142,251,191,252,
+78,252,62,251,224,247,111,251,132,248,17,248,173,247,158,248,103,248,56,30,
+251,211,22,247,72,29,11,249,195,28,4,248,67,29,11,28,5,66,145,21,247,79,29,
+8,247,67,29,251,101,254,210,24,133,113,123,133,114,137,8,152,29,11,250,216,
+249,234,21,247,11,251,191,7,155,100,49,174,36,27,251,209,251,36,251,117,251,
+83,251,21,219,63,247,1,88,31,237,29,248,23,29,251,152,251,9,247,154,29,162,
+254,31,21,76,89,251,13,251,78,251,60,92,247,31,227,215,170,208,229,174,30,
+247,121,39,5,215,104,164,98,92,26,11,250,193,249,1,21,247,158,251,54,247,
+29,251,144,252,15,251,102,251,224,251,213,251,120,247,21,251,60,247,172,247,
+244,29,30,251,187,147,21,251,144,251,23,251,181,251,35,92,44,219,247,103,
+247,168,247,42,247,152,247,17,190,229,53,251,92,30,11,28,6,6,28,4,248,21,
+241,252,215,37,7,247,12,131,170,137,141,120,131,129,25,251,230,252,83,251,
+33,248,81,247,94,29,247,121,253,60,24,247,49,29,248,156,249,42,145,147,156,
+154,153,141,25,11,28,4,115,28,5,45,21,247,127,29,247,76,67,251,25,247,178,
+29,68,251,228,5,116,176,247,66,47,247,117,27,248,109,247,35,247,163,247,78,
+247,70,251,35,223,251,39,213,31,32,190,251,70,207,247,35,26,247,58,247,50,
+237,245,215,247,7,86,125,30,130,251,105,5,247,48,6,11,249,187,249,246,21,
+191,59,245,251,62,251,111,251,87,251,15,251,84,36,223,49,225,74,30,240,63,
+206,81,55,26,43,98,78,57,84,55,161,180,110,30,176,247,13,5,168,113,98,159,
+79,27,84,80,72,67,41,235,42,247,107,247,199,247,42,247,62,247,50,239,51,219,
+46,211,31,51,207,45,216,223,26,191,143,214,221,170,161,131,139,30,244,251,
+70,5,247,17,147,186,180,231,26,11,71,29,14,28,4,143,28,5,229,21,251,31,6,
+251,238,74,5,65,7,247,76,123,78,251,247,248,196,29,245,247,27,184,180,209,
+248,32,29,251,54,249,3,159,29,11,28,5,143,249,228,203,29,251,236,251,253,
+135,30,35,6,247,113,250,248,5,168,6,247,103,133,247,121,98,251,230,26,11,
+247,9,29,14,21,251,62,6,251,107,251,85,251,34,247,85,5,251,62,6,247,50,251,
+243,5,247,134,6,14,21,251,173,247,202,5,190,94,110,153,84,27,51,110,80,90,
+112,162,96,168,123,31,247,223,251,73,5,251,189,22,251,170,247,202,5,190,92,
+110,247,212,29,249,11,205,247,248,29,247,50,249,201,5,251,36,6,251,230,71,
+5,68,7,247,68,120,251,21,253,60,247,246,29,11,28,8,86,28,4,248,21,241,252,
+150,35,7,180,137,190,139,139,26,170,137,159,137,127,112,251,238,253,121,24,
+248,20,29,137,157,143,156,27,139,190,141,186,141,30,243,252,195,35,7,178,
+137,186,137,139,26,174,137,151,137,141,112,244,28,251,12,24,247,115,6,248,
+82,250,64,244,254,64,5,247,101,6,248,252,28,5,13,5,11,250,226,192,21,247,
+1,7,144,29,84,176,227,81,247,200,29,11,28,5,39,250,128,21,243,59,221,43,43,
+79,65,49,82,176,92,139,30,247,23,6,135,91,98,68,82,96,8,247,66,92,251,38,
+229,251,97,27,252,15,251,102,251,224,251,213,251,120,247,21,251,60,247,172,
+247,244,29,31,145,7,247,50,206,231,247,60,247,34,26,252,181,252,11,21,251,
+144,251,23,251,181,251,35,92,44,219,247,103,247,168,247,42,247,152,247,17,
+190,229,53,251,92,30,11,130,29,14,21,184,29,165,247,7,53,247,31,247,35,29,
+11,249,3,198,21,244,29,247,144,28,5,20,221,29,245,247,15,172,190,238,30,11,
+21,225,75,190,55,57,57,86,49,114,147,117,158,120,30,247,21,6,123,63,48,82,
+70,121,122,57,24,247,38,165,247,95,246,247,64,26,14,21,247,56,35,247,182,
+29,245,211,82,251,1,31,247,1,6,145,166,143,168,167,26,14,250,46,249,252,195,
+29,11,28,6,150,198,21,234,7,110,81,55,116,111,27,87,127,184,197,151,31,248,
+220,29,244,233,170,192,242,31,11,21,33,6,35,96,49,75,251,5,27,33,67,197,247,
+2,137,31,32,6,133,111,135,110,110,26,251,54,244,53,247,51,247,95,247,37,247,
+32,247,86,176,30,14,21,217,76,203,61,61,78,75,61,62,200,75,217,217,202,203,
+216,30,252,66,22,217,76,203,61,61,76,75,61,62,202,75,217,217,202,203,216,
+30,11,95,29,251,93,247,33,251,42,247,93,247,78,203,201,247,48,247,23,30,183,
+29,11,28,6,88,248,14,29,252,183,35,7,195,135,200,135,139,26,188,134,137,123,
+125,117,252,19,252,200,24,251,77,248,200,131,159,152,157,184,144,25,247,10,
+147,5,243,253,53,35,7,247,53,126,247,206,254,47,100,86,102,85,80,88,25,251,
+89,246,5,39,75,73,65,98,26,80,198,61,247,32,247,76,247,37,247,13,247,44,244,
+30,249,86,250,141,5,11,21,223,77,205,59,57,84,71,57,60,198,79,219,219,199,
+203,214,30,14,21,251,3,6,86,123,90,96,96,251,15,117,235,251,1,27,251,29,43,
+248,122,29,186,182,182,247,15,162,41,247,0,27,247,31,236,247,5,247,33,200,
+31,11,248,110,29,247,198,29,248,112,29,111,127,135,108,137,8,247,167,29,247,
+105,250,210,24,143,157,145,152,160,141,8,11,247,232,29,65,251,226,247,1,29,
+14,250,150,249,17,247,96,29,251,131,28,251,4,233,29,11,250,166,249,17,21,
+247,78,41,247,93,251,107,251,0,44,88,114,96,30,154,215,247,172,29,251,124,
+28,251,101,135,120,129,125,118,137,25,139,59,133,96,135,30,46,248,239,232,
+7,248,181,29,248,25,247,135,247,226,247,220,31,251,178,131,247,66,29,11,21,
+251,50,247,243,5,251,133,6,251,189,251,243,5,247,62,6,247,109,247,87,247,
+29,251,87,5,11,171,29,14,28,6,16,28,4,248,191,29,11,250,111,28,5,92,125,29,
+11,180,249,37,21,249,139,247,21,253,139,6,28,5,102,201,203,29,251,236,251,
+253,135,30,35,6,247,113,250,248,5,168,6,247,103,133,247,121,98,251,230,26,
+14,28,8,59,28,5,0,21,207,57,198,33,251,1,60,110,92,81,30,251,80,251,47,157,
+251,54,251,27,251,50,121,119,32,53,67,120,236,248,119,24,143,166,163,155,
+164,142,247,9,149,24,243,252,228,35,7,231,129,162,134,157,125,135,112,25,
+43,252,119,75,158,67,225,129,159,25,65,247,50,221,247,54,251,19,247,47,8,
+186,100,70,168,32,27,33,251,23,80,71,92,149,92,203,77,31,247,115,223,202,
+37,111,251,33,169,251,7,25,162,57,174,67,194,105,51,122,65,98,102,94,252,
+4,252,80,24,251,40,128,5,35,248,56,213,7,248,33,248,105,160,161,178,160,192,
+145,25,53,252,68,248,137,29,251,11,128,5,35,248,230,243,7,47,150,114,141,
+123,155,143,166,25,225,248,68,176,135,182,116,149,117,25,247,105,252,105,
+5,65,11,250,42,249,21,143,29,14,21,248,129,29,113,170,215,155,31,247,60,249,
+174,5,189,29,11,28,5,101,250,116,21,247,92,200,247,44,247,73,166,247,27,8,
+247,25,166,87,207,47,27,72,53,106,39,119,31,128,82,169,81,139,26,247,43,6,
+114,251,11,251,2,57,32,98,8,11,21,253,76,6,106,251,57,5,249,78,6,14,21,34,
+6,75,113,75,47,41,27,108,109,147,150,124,31,104,247,41,5,151,119,90,148,120,
+27,70,96,71,82,251,21,247,31,85,247,7,247,70,241,247,5,247,54,209,31,14,159,
+29,14,28,5,240,251,166,21,204,106,176,86,172,30,251,126,251,79,5,88,86,143,
+205,221,183,247,45,156,221,31,251,21,6,120,55,95,251,45,53,26,251,33,247,
+35,73,247,15,247,17,247,56,184,247,42,30,251,255,247,227,113,29,14,28,5,176,
+205,21,247,0,7,110,94,251,5,100,117,27,90,139,183,188,149,31,247,50,249,193,
+5,251,34,6,251,227,71,5,67,7,247,66,123,251,21,253,54,5,41,120,190,251,1,
+247,42,27,247,15,217,172,197,247,2,31,252,185,247,184,133,29,11,5,49,120,
+92,122,59,27,251,51,247,79,5,65,102,59,94,32,26,39,247,17,98,239,247,21,247,
+89,211,247,74,176,30,11,28,6,121,248,14,29,252,255,35,7,247,11,129,162,136,
+157,123,135,112,25,55,252,64,5,252,191,6,223,248,64,145,166,164,155,161,142,
+25,247,13,149,5,243,252,254,35,7,247,6,243,29,251,7,128,5,35,248,255,243,
+7,251,13,247,175,29,237,248,131,5,248,191,6,41,252,131,248,137,29,251,13,
+128,5,35,235,7,248,74,29,241,248,160,37,150,114,141,121,248,163,29,164,155,
+163,142,25,14,28,6,125,198,21,236,7,130,108,251,2,96,110,27,92,127,182,195,
+151,31,247,60,249,176,5,251,167,6,251,33,253,55,5,59,90,45,251,1,51,27,55,
+159,246,219,158,31,247,33,249,57,5,251,165,6,251,35,253,60,5,62,98,59,32,
+251,10,27,89,127,203,247,17,166,31,247,37,249,80,248,145,29,247,62,122,251,
+21,253,6,5,251,54,104,247,1,34,247,35,27,245,247,26,189,245,247,2,31,74,170,
+200,48,247,5,27,235,247,7,180,240,243,31,126,143,125,146,129,30,75,165,213,
+98,231,27,247,3,247,21,203,159,190,31,14,21,128,29,247,137,252,179,24,252,
+144,252,197,247,82,29,247,50,251,253,151,113,115,247,226,29,248,251,241,7,
+79,146,84,141,139,26,123,141,128,141,129,159,251,160,248,236,24,248,84,248,
+138,248,141,29,11,6,227,248,85,143,163,151,248,127,29,252,254,37,7,196,133,
+198,135,139,26,168,137,153,134,135,115,248,112,29,115,127,133,110,137,8,242,
+29,11,28,5,23,28,4,205,21,251,77,6,188,247,172,5,251,31,6,251,238,74,5,65,
+7,247,76,123,119,251,17,5,251,197,6,112,251,27,5,247,199,6,123,44,248,196,
+29,245,247,27,184,180,209,248,32,29,247,54,250,34,5,247,76,6,252,144,251,
+179,159,29,11,118,29,59,70,50,251,43,247,70,57,247,132,247,218,247,195,247,
+91,247,189,247,105,251,36,247,23,251,119,165,31,14,21,247,219,202,44,247,
+202,252,60,27,251,251,251,187,251,128,251,235,251,17,31,52,6,81,104,163,178,
+124,31,247,93,247,187,5,190,97,99,152,65,27,47,251,2,52,251,71,105,31,251,
+57,108,243,251,8,247,62,27,247,0,6,136,128,136,128,137,127,8,252,26,65,247,
+62,251,204,248,95,27,247,235,247,151,247,57,139,31,182,247,117,5,139,251,
+124,251,70,251,164,251,208,34,247,110,247,198,198,30,250,56,6,251,210,247,
+17,21,252,213,6,247,69,173,247,48,247,128,247,91,27,247,52,214,251,63,251,
+72,104,31,14,28,4,147,196,21,248,129,29,113,170,215,155,31,247,60,249,174,
+5,248,30,29,110,196,203,152,31,247,60,249,164,5,251,34,6,251,230,71,5,70,
+7,247,64,120,251,25,253,8,5,251,3,115,212,251,46,247,95,27,247,25,242,174,
+201,229,31,143,114,159,90,223,123,8,107,106,75,69,123,106,174,82,106,26,108,
+69,86,139,30,176,248,75,29,152,166,192,151,168,30,247,1,149,247,10,180,186,
+165,8,11,28,4,113,250,240,21,247,64,251,58,247,11,251,156,251,50,32,108,51,
+251,90,30,75,251,209,5,247,50,6,219,247,84,5,219,172,245,178,219,27,213,247,
+21,86,251,36,251,70,251,52,251,27,251,66,125,114,141,143,84,31,108,251,45,
+5,139,241,157,195,204,247,56,110,251,57,251,83,251,72,251,66,251,83,80,251,
+23,178,209,137,30,135,247,84,5,251,50,6,76,251,222,5,68,247,43,223,122,247,
+48,27,247,193,248,21,247,5,248,5,247,43,251,13,239,251,74,164,31,248,8,29,
+11,28,7,127,249,254,21,246,251,21,182,57,251,144,251,70,251,97,251,121,59,
+30,57,6,221,248,33,5,251,125,6,57,252,33,5,63,6,141,167,141,166,168,26,247,
+92,251,31,247,42,251,93,251,80,75,90,251,50,251,23,30,251,103,7,247,36,233,
+242,247,14,247,17,27,247,4,147,251,78,57,251,25,103,251,205,251,50,98,31,
+41,247,47,5,53,129,32,115,251,5,26,32,247,21,96,221,247,156,247,77,247,120,
+247,135,210,30,217,6,47,252,82,5,247,123,6,231,248,82,5,215,6,133,99,135,
+98,100,26,11,250,222,250,42,21,200,71,184,57,55,98,116,105,96,30,41,57,114,
+42,92,56,92,50,80,78,51,125,235,248,119,24,251,15,6,251,234,69,5,76,7,247,
+50,112,251,64,253,244,248,216,29,14,186,29,251,33,182,231,251,93,247,25,27,
+247,11,221,156,194,233,31,247,41,29,31,11,21,251,87,251,117,57,74,51,27,251,
+7,100,243,247,34,161,143,176,141,164,31,247,165,161,247,209,247,15,247,107,
+26,226,49,247,20,251,93,251,176,251,103,251,117,251,147,70,30,75,89,163,174,
+112,31,247,13,247,114,5,199,108,86,161,79,27,62,50,55,251,22,251,50,247,39,
+46,247,52,131,31,136,115,137,109,115,26,251,195,247,87,61,247,70,248,88,29,
+30,251,111,247,120,29,21,232,84,220,251,58,251,111,59,252,26,251,37,110,30,
+69,178,122,200,214,26,219,176,247,99,205,160,156,119,111,157,30,182,151,5,
+154,138,233,39,251,70,33,251,129,251,40,251,33,238,66,247,42,110,30,109,251,
+56,5,57,125,201,118,224,27,213,213,160,178,196,31,208,7,119,99,90,118,97,
+27,112,132,153,169,145,31,163,247,27,5,247,131,185,247,50,247,93,247,99,26,
+251,62,22,251,26,51,251,63,251,12,80,30,175,247,66,5,247,70,175,189,247,5,
+169,27,189,145,68,109,31,14,134,29,5,35,248,240,243,7,247,53,29,14,28,4,129,
+196,21,137,242,5,248,103,29,247,7,248,178,5,247,64,173,74,247,9,251,97,27,
+251,13,251,0,96,88,57,31,169,247,33,5,247,126,247,19,251,99,6,205,247,203,
+5,251,34,247,48,29,107,251,48,5,251,83,251,19,247,56,6,251,115,254,195,223,
+29,251,15,252,232,5,32,117,247,8,102,236,27,247,0,244,172,188,241,31,14,21,
+248,66,29,127,78,253,27,253,9,247,27,249,70,247,106,29,252,230,35,7,231,129,
+164,134,157,125,247,59,29,251,11,128,5,35,248,230,243,7,47,247,175,29,160,
+235,249,29,249,9,251,36,253,105,247,238,29,117,141,120,155,145,166,25,247,
+99,250,178,248,140,29,11,35,7,247,19,124,171,135,144,129,134,112,25,68,251,
+254,251,15,252,62,57,251,25,106,88,113,71,110,123,251,44,247,25,24,47,251,
+0,47,71,61,210,53,215,248,76,29,247,9,247,253,243,248,166,8,11,21,247,78,
+41,247,93,251,107,251,0,44,88,114,96,30,154,215,247,172,29,251,124,28,251,
+101,135,120,129,125,118,137,25,139,59,133,96,135,30,46,248,239,232,7,248,
+181,29,248,25,247,135,247,226,247,220,31,251,178,131,247,66,29,14,21,197,
+7,120,102,84,127,121,27,106,131,165,174,147,31,215,247,222,5,237,161,68,203,
+44,27,70,49,102,92,69,31,180,119,98,182,65,27,77,68,108,98,75,31,156,211,
+5,46,248,49,29,247,5,129,251,11,252,159,5,247,70,6,234,248,52,5,178,173,199,
+203,194,27,196,125,73,90,129,31,47,252,40,5,247,68,6,235,248,54,5,166,157,
+199,213,217,27,174,145,100,63,122,31,66,251,220,5,80,126,207,108,219,27,208,
+199,155,172,206,31,14,37,150,116,141,121,155,145,166,25,246,248,185,5,247,
+115,184,251,42,231,251,82,27,61,251,27,92,94,251,5,31,194,247,174,145,166,
+164,155,164,248,138,29,253,3,35,7,247,5,129,161,136,158,123,132,112,25,251,
+98,254,178,132,112,115,123,114,137,25,251,19,128,5,35,248,238,243,7,47,150,
+117,141,120,155,145,166,25,247,9,248,230,5,149,158,247,29,215,186,27,245,
+213,102,251,25,113,31,36,252,146,135,112,114,123,115,137,25,41,128,5,35,11,
+21,251,24,6,251,0,78,5,175,86,63,164,77,121,29,28,5,57,249,246,21,247,212,
+251,82,247,113,252,52,251,39,251,25,112,90,251,71,30,76,251,215,5,247,50,
+6,204,247,72,147,159,158,160,153,145,25,151,170,243,172,238,27,247,107,247,
+12,251,17,251,185,108,135,109,135,104,31,252,174,6,112,251,23,5,248,175,6,
+252,5,42,251,107,251,64,251,144,27,64,44,160,141,133,31,123,147,129,151,156,
+26,135,247,117,5,251,46,6,73,251,226,5,139,247,97,61,247,118,248,150,248,
+10,248,38,248,133,30,11,28,5,215,249,230,21,247,248,251,158,247,128,252,83,
+252,82,251,158,251,128,251,248,251,222,247,172,251,86,247,140,124,30,251,
+19,251,211,7,89,51,176,242,31,96,251,216,248,212,247,252,6,251,124,211,251,
+41,247,64,247,136,26,247,162,247,84,247,163,247,189,247,187,247,87,251,163,
+251,162,251,136,251,42,251,64,251,123,67,30,251,252,248,211,247,216,96,7,
+36,53,102,88,30,251,211,247,19,6,247,139,154,247,173,247,86,247,222,26,14,
+28,4,229,28,5,94,21,254,182,37,6,194,133,200,135,139,26,166,137,155,134,135,
+115,251,105,254,210,24,133,113,125,135,108,137,8,139,78,135,83,132,30,37,
+249,13,241,7,72,146,73,143,139,26,112,141,123,143,143,163,235,248,124,24,
+247,111,6,160,168,129,120,137,31,116,251,45,5,247,46,6,233,248,119,5,251,
+44,6,98,251,40,5,119,133,108,131,119,27,251,109,6,235,248,131,5,247,218,6,
+161,164,133,119,31,251,89,247,58,7,11,250,80,248,252,21,247,126,251,43,247,
+66,251,205,251,5,41,119,102,251,23,30,89,251,136,5,247,40,6,186,247,23,145,
+155,151,152,150,143,25,149,161,209,160,192,27,247,13,225,57,251,81,113,135,
+112,135,108,31,252,13,6,114,251,9,5,248,13,6,251,145,74,251,11,251,1,251,
+56,27,92,73,149,141,135,31,129,145,133,148,151,26,135,247,54,5,251,36,6,90,
+251,142,5,139,247,46,79,247,60,248,2,247,195,247,165,248,4,30,11,21,248,13,
+29,251,173,251,202,5,247,36,6,247,221,247,73,5,170,155,162,182,166,26,11,
+21,238,7,135,119,251,40,100,129,247,250,29,251,111,247,11,29,237,235,184,
+187,211,31,79,165,199,106,225,27,243,247,5,189,175,233,31,252,25,249,126,
+21,43,252,138,159,246,109,251,56,247,115,29,11,21,184,84,172,83,45,51,251,
+3,53,78,30,247,11,100,94,217,55,27,120,251,29,100,129,106,31,100,7,247,25,
+124,158,137,202,251,68,152,92,25,98,43,71,67,92,102,88,211,24,38,125,82,102,
+90,201,114,200,247,9,237,247,66,170,159,31,53,168,199,251,11,225,27,216,193,
+147,174,200,31,211,7,100,80,108,141,125,27,108,129,180,188,114,31,117,188,
+108,221,129,170,180,229,216,211,180,169,199,74,24,229,143,200,172,31,14,21,
+207,51,245,251,66,30,77,6,251,137,251,103,251,27,251,62,36,194,78,219,96,
+31,251,31,110,251,32,66,251,81,26,251,62,247,34,63,247,168,247,89,247,90,
+247,19,162,168,30,247,74,7,45,251,7,251,31,251,7,251,48,27,78,55,170,247,
+1,247,29,231,196,225,141,31,190,178,139,137,195,31,247,11,7,69,141,251,5,
+141,247,27,26,247,11,215,239,239,30,168,100,197,41,186,76,8,247,96,165,121,
+201,192,26,14,250,128,249,123,21,247,32,34,247,8,251,203,30,252,89,47,6,192,
+135,178,137,139,26,166,145,129,118,135,31,251,56,253,121,5,121,135,131,126,
+118,27,139,90,137,84,135,30,47,248,150,231,7,84,143,100,141,139,26,114,141,
+133,152,141,155,190,247,121,24,162,163,137,156,27,247,222,247,105,247,46,
+247,125,31,251,153,117,21,251,70,251,57,61,251,48,30,231,248,66,5,147,158,
+141,145,27,247,21,206,69,33,31,14,28,5,223,28,4,248,21,241,252,232,37,7,186,
+135,199,135,139,26,167,137,150,128,118,121,252,97,252,85,24,248,215,29,11,
+207,29,252,203,252,136,247,56,251,29,235,247,19,5,233,108,247,3,35,251,19,
+26,251,87,251,72,251,68,251,36,123,80,131,190,106,30,88,247,84,5,154,102,
+92,155,106,27,55,11,28,7,143,28,4,248,21,168,29,251,45,253,171,5,115,135,
+120,131,117,27,139,75,135,78,132,30,37,11,27,247,60,173,251,58,251,140,92,
+248,99,29,71,145,151,91,31,142,56,5,122,209,202,248,125,29,209,31,247,221,
+202,251,74,247,58,251,175,27,11,27,252,55,251,152,251,220,251,240,251,82,
+220,251,75,247,163,237,241,176,188,230,31,251,129,91,71,251,70,251,115,27,
+102,84,163,247,220,29,247,145,99,247,27,247,243,247,100,247,104,247,163,194,
+31,251,3,249,191,21,251,19,253,4,5,106,80,81,110,72,27,251,46,100,247,7,247,
+33,247,140,247,56,247,152,247,109,191,179,100,100,170,31,14,233,29,14,21,
+198,7,137,126,43,115,132,27,107,136,151,176,31,225,248,41,142,151,160,178,
+148,163,25,251,34,6,129,129,5,154,109,98,149,100,27,251,178,251,21,251,113,
+251,75,47,197,251,25,247,56,203,201,166,168,186,31,103,156,178,119,195,27,
+206,213,169,161,200,31,251,145,248,83,21,77,251,193,152,203,119,41,8,123,
+120,93,83,81,27,59,142,214,204,247,33,216,247,77,247,63,154,148,87,132,136,
+31,14,5,251,5,198,195,92,247,58,27,214,225,156,161,213,31,242,7,133,37,130,
+118,27,76,141,130,158,92,229,11,21,192,61,223,251,43,251,224,251,7,251,244,
+251,95,98,30,211,29,247,163,247,13,251,142,247,185,29,11,21,251,142,251,9,
+251,152,251,35,102,34,211,247,113,247,132,247,3,247,182,247,82,170,153,127,
+127,154,30,165,57,154,59,251,19,26,14,230,29,251,53,247,17,42,247,97,247,
+113,247,21,238,247,25,247,9,30,251,19,196,5,247,110,29,11,247,51,29,252,254,
+37,7,188,135,192,135,139,26,170,137,147,139,150,116,11,21,247,15,47,225,251,
+13,248,61,29,247,53,247,46,247,35,247,56,30,251,23,115,21,247,251,29,14,21,
+220,76,176,57,118,131,141,139,30,172,247,53,5,34,6,84,251,171,5,139,172,143,
+153,180,174,122,100,70,59,124,86,88,63,156,139,30,118,36,5,139,217,117,223,
+247,36,247,45,221,247,52,30,11,21,49,6,251,117,100,5,94,7,247,13,128,98,251,
+103,5,144,122,113,145,106,27,251,162,251,25,251,107,251,81,35,202,251,9,247,
+46,196,202,164,171,187,31,105,153,180,116,204,27,209,225,166,163,184,31,199,
+7,126,110,82,117,102,27,129,121,147,180,147,31,32,248,9,21,78,251,210,5,90,
+94,92,94,94,27,89,113,182,239,247,87,247,17,247,25,233,170,165,88,131,137,
+31,14,160,29,5,32,117,247,8,102,236,27,247,0,244,172,188,241,31,11,21,248,
+73,29,221,248,39,248,145,29,247,64,122,251,9,252,232,247,176,29,30,251,172,
+141,21,251,47,94,251,19,38,133,251,2,153,247,13,162,139,163,145,166,30,139,
+176,247,70,145,170,30,151,157,172,155,159,27,247,21,152,86,251,3,31,11,247,
+149,29,90,50,251,8,110,197,29,11,28,5,221,249,234,21,248,89,29,252,142,251,
+191,252,78,252,62,251,224,247,111,251,132,248,17,248,173,247,158,248,103,
+248,56,30,251,211,22,110,137,113,137,110,30,253,112,6,247,171,211,247,70,
+247,127,247,81,27,247,33,247,48,251,48,251,166,31,116,251,91,247,142,29,11,
+28,5,64,249,60,21,248,7,210,251,80,247,246,252,89,27,251,232,251,95,251,107,
+139,31,98,251,105,5,229,228,247,113,247,85,247,163,27,247,150,180,251,181,
+251,183,83,31,254,33,6,127,75,5,251,203,80,223,251,230,248,54,27,248,42,247,
+218,247,206,248,35,215,31,252,6,251,42,21,251,57,105,251,39,251,136,251,90,
+27,251,48,66,247,45,247,64,172,31,155,223,5,11,249,74,28,5,37,21,148,29,11,
+28,6,96,28,4,248,21,248,6,29,251,42,253,134,24,252,35,249,214,247,228,29,
+251,103,254,210,24,133,113,123,135,110,137,8,139,80,135,81,132,30,37,248,
+197,241,7,80,146,80,143,139,26,110,141,127,143,143,163,247,50,249,189,24,
+248,94,254,76,5,11,111,135,127,135,116,27,139,76,135,73,132,30,37,248,240,
+7,248,30,247,146,247,29,247,218,247,54,34,214,251,70,172,31,248,152,29,251,
+206,248,124,29,118,139,141,117,30,235,248,132,5,158,161,141,162,27,247,15,
+247,4,96,251,23,31,102,253,30,21,251,111,251,55,251,2,251,134,118,107,139,
+141,110,30,11,250,111,28,5,92,21,248,39,29,67,252,36,126,251,127,104,251,
+80,107,251,66,97,222,29,174,247,38,207,248,146,157,247,6,173,247,111,156,
+247,105,247,5,238,247,19,251,13,24,247,227,29,11,21,190,251,54,251,15,174,
+251,49,166,29,14,21,247,156,29,11,21,247,197,251,85,217,251,70,251,91,251,
+76,251,23,59,59,30,251,84,7,247,86,247,117,221,205,227,27,247,5,180,34,251,
+33,116,135,102,137,115,31,251,165,114,251,209,251,12,251,108,26,76,229,251,
+44,247,93,247,242,247,132,247,247,247,203,30,251,198,251,89,21,251,41,102,
+66,251,99,251,19,27,77,129,192,186,247,17,247,60,238,247,33,171,31,11,92,
+251,7,88,128,137,27,69,96,240,245,80,31,79,247,3,88,247,48,102,208,154,29,
+247,64,249,221,5,251,31,247,48,29,251,166,28,250,182,5,247,93,29,11,251,125,
+115,53,251,89,40,251,107,45,251,74,25,100,248,254,251,39,164,251,167,65,5,
+74,7,247,48,122,194,253,217,117,83,5,247,103,6,237,247,42,247,21,247,117,
+245,247,103,11,28,5,5,248,44,21,170,247,51,5,251,108,6,247,56,249,220,5,251,
+124,6,253,213,253,232,112,251,39,5,248,252,6,251,103,97,79,251,7,247,83,29,
+247,90,247,86,247,139,190,31,251,136,247,51,21,251,213,6,248,39,248,50,5,
+11,250,193,249,1,21,247,158,251,54,247,29,251,144,252,15,251,102,251,224,
+251,213,251,120,247,21,251,60,247,172,247,244,29,30,251,187,147,21,120,139,
+119,137,120,30,252,25,6,247,87,184,247,3,247,41,233,27,190,229,53,251,92,
+31,121,251,72,21,251,85,96,36,251,60,251,2,27,92,44,219,247,103,161,141,164,
+141,162,31,11,186,80,182,55,53,61,67,139,30,251,119,252,137,5,247,60,6,247,
+242,248,64,5,147,151,147,157,164,26,248,56,22,186,80,182,55,53,61,67,139,
+30,251,119,252,137,5,247,60,6,247,242,248,64,5,147,151,147,157,164,26,248,
+56,22,186,80,182,55,53,61,67,139,30,251,119,252,137,5,247,60,6,247,242,248,
+64,5,147,151,147,157,164,26,11,21,137,201,5,118,98,108,127,100,27,125,114,
+151,180,148,31,212,247,220,5,241,164,94,205,251,23,27,59,69,116,108,86,31,
+219,247,241,248,94,29,251,76,253,191,247,56,29,14,28,251,60,6,69,251,250,
+5,247,52,6,217,247,109,5,157,145,171,150,158,27,247,103,6,11,21,247,174,29,
+86,251,21,49,34,39,251,27,25,83,248,164,129,242,61,188,251,33,247,207,29,
+182,251,1,182,252,207,122,247,97,29,11,224,29,252,24,250,154,228,29,11,21,
+251,85,6,251,138,251,165,123,247,20,5,237,127,89,201,43,27,251,33,40,100,
+60,104,164,95,220,31,228,247,18,5,188,163,113,48,150,31,167,251,115,252,52,
+252,100,5,247,87,6,247,137,247,165,156,251,20,5,41,150,190,79,235,27,247,
+33,239,176,219,175,112,181,58,31,51,251,16,5,87,120,164,229,126,31,110,247,
+116,5,14,191,184,227,231,204,195,221,251,25,24,247,50,192,151,235,188,26,
+195,65,202,39,59,67,106,51,56,30,251,122,251,127,11,30,168,247,44,5,145,162,
+159,143,162,27,208,209,102,61,251,43,251,38,104,251,14,147,31,120,47,5,231,
+151,247,42,141,251,21,26,35,38,49,35,110,111,147,147,110,30,123,247,31,5,
+147,122,121,144,120,27,78,86,100,73,251,2,247,53,110,221,247,60,247,152,221,
+247,99,247,8,251,21,180,43,31,247,17,152,247,37,223,247,31,26,11,28,5,215,
+22,170,7,49,251,13,165,246,31,250,179,7,247,8,225,182,247,17,30,170,28,250,
+72,108,7,247,19,221,96,251,8,31,254,179,7,251,5,251,11,119,49,30,108,249,
+8,170,7,49,251,10,161,247,3,31,250,179,7,247,8,241,150,235,30,247,120,6,235,
+241,128,251,8,31,254,179,7,32,251,11,113,49,30,108,7,14,247,152,29,251,115,
+28,4,238,24,232,29,7,190,249,15,247,199,29,11,21,247,92,200,247,44,247,73,
+166,247,27,8,247,25,166,87,207,47,27,72,53,106,39,119,31,128,82,169,81,139,
+26,247,43,6,114,251,11,251,2,57,32,98,8,14,21,45,252,167,5,60,69,68,63,247,
+189,29,11,21,137,242,5,104,78,89,116,179,29,11,21,188,91,170,78,98,96,126,
+119,116,30,176,251,48,107,62,79,77,74,57,25,104,247,210,131,200,89,168,45,
+141,25,251,49,248,157,29,163,137,139,137,148,120,167,74,166,251,234,141,128,
+8,113,131,108,116,98,30,247,21,6,227,225,247,54,247,62,247,13,247,93,8,147,
+153,160,176,180,26,14,21,251,1,6,37,96,51,73,251,4,27,32,67,196,247,3,137,
+31,33,6,133,110,135,111,110,26,251,54,243,53,247,52,247,95,247,35,247,32,
+247,86,178,30,14,247,85,249,252,21,90,125,148,251,0,247,46,27,247,55,247,
+51,247,107,88,60,251,244,113,55,25,251,17,99,85,251,27,251,24,27,37,55,188,
+247,113,251,7,31,76,251,96,5,251,24,209,247,5,53,247,87,27,247,142,247,52,
+247,48,247,126,213,31,247,246,247,4,251,21,247,197,252,27,27,251,54,37,53,
+73,117,31,11,208,108,73,209,251,4,27,45,251,1,90,71,41,31,163,247,9,5,251,
+33,6,251,230,71,5,70,7,247,64,122,251,72,253,250,5,247,164,6,247,38,249,74,
+5,203,192,231,245,225,27,227,117,251,2,59,122,31,251,33,253,54,5,247,162,
+6,247,40,249,78,5,184,167,229,247,13,247,13,27,193,151,74,251,19,112,31,11,
+28,6,201,250,87,21,251,118,247,6,84,251,21,5,129,131,123,137,120,112,251,
+6,227,251,31,27,120,123,137,137,122,31,225,248,125,5,251,31,6,251,238,74,
+5,65,7,247,76,123,78,251,247,248,183,29,197,219,202,31,117,251,5,5,11,27,
+252,179,251,216,252,72,252,58,251,171,247,44,251,195,248,97,247,84,247,58,
+190,176,244,31,202,248,7,226,29,11,28,5,129,171,29,11,241,252,195,63,7,252,
+117,253,232,251,48,249,241,5,206,252,180,37,7,196,133,200,135,139,26,166,
+137,153,134,135,115,251,103,254,210,24,133,113,121,135,110,137,8,139,80,135,
+83,132,30,37,248,191,241,7,76,146,77,143,139,26,121,141,123,145,145,161,247,
+37,249,159,24,247,58,254,46,5,247,93,6,248,168,250,60,11,247,119,29,251,87,
+251,72,251,68,251,36,123,74,138,163,102,30,88,247,84,5,154,102,92,155,106,
+27,55,59,70,50,251,43,247,80,77,247,132,247,218,247,195,247,91,247,189,247,
+105,251,36,247,23,251,119,165,31,14,28,6,121,248,14,29,252,240,247,65,29,
+251,99,254,170,5,112,133,114,121,117,27,252,99,6,114,121,157,166,145,31,247,
+99,250,170,145,166,164,155,161,142,25,247,11,149,5,248,186,29,11,21,252,193,
+6,53,252,66,5,149,202,205,147,204,27,228,247,2,100,35,251,13,251,27,49,251,
+3,117,116,141,141,117,31,126,247,40,5,145,121,121,143,118,27,82,83,98,77,
+251,0,247,52,114,221,247,81,247,154,247,7,247,113,247,40,251,44,190,251,17,
+78,75,127,120,80,31,178,247,91,5,248,84,6,11,250,230,249,232,21,143,161,149,
+148,154,141,247,14,145,24,204,29,11,247,117,29,180,131,182,122,155,111,25,
+247,134,252,105,5,65,11,114,147,121,147,127,30,247,242,252,64,5,247,60,6,
+251,119,248,137,5,139,61,211,53,55,80,96,92,30,11,247,23,151,5,241,252,255,
+37,7,193,133,200,137,139,26,172,137,154,132,134,115,81,251,198,24,251,56,
+108,11,250,148,205,21,243,7,108,88,32,113,111,27,104,129,151,194,149,31,247,
+50,249,199,229,29,90,251,144,11,251,166,6,251,42,253,96,5,53,56,42,71,78,
+27,96,90,196,238,159,31,215,248,0,5,247,97,182,69,247,62,251,193,27,251,19,
+37,67,66,55,168,112,202,116,31,247,56,247,21,5,225,102,251,16,251,36,110,
+31,68,251,236,5,251,64,102,206,251,7,247,95,27,247,13,247,0,182,191,221,31,
+11,248,17,247,109,206,248,9,247,109,26,247,195,251,97,247,144,252,25,252,
+146,251,193,252,103,252,46,251,240,247,136,251,111,247,246,164,161,141,141,
+158,30,11,80,27,116,101,162,207,153,31,247,7,248,178,5,247,64,173,74,247,
+9,247,148,29,247,72,123,251,174,28,250,182,223,29,251,15,252,232,11,21,216,
+75,203,61,62,75,75,62,61,203,75,216,217,203,203,217,30,252,68,22,216,75,203,
+61,61,78,75,62,61,200,75,217,217,203,203,217,30,14,28,4,248,248,110,29,196,
+133,203,135,139,26,165,137,154,134,135,115,251,28,253,101,24,251,173,88,68,
+251,27,251,11,27,108,80,158,161,31,247,150,251,60,7,69,251,248,5,125,168,
+241,83,247,74,27,248,40,229,247,128,247,215,198,31,247,23,249,83,5,157,144,
+145,152,157,27,11,251,74,164,8,248,8,29,247,64,251,58,247,11,251,156,251,
+50,32,108,51,251,90,30,75,251,209,5,247,50,6,219,247,84,5,219,172,245,178,
+219,27,213,247,21,86,251,36,251,70,251,52,251,27,251,66,125,114,141,143,84,
+31,108,251,45,5,139,241,157,195,204,11,247,102,7,251,33,47,34,251,27,251,
+15,27,251,6,133,247,78,219,247,27,175,247,206,247,50,180,31,237,251,48,5,
+223,149,247,1,164,247,4,26,11,201,29,215,247,23,5,151,147,155,139,158,11,
+21,247,204,72,65,247,30,57,27,86,101,32,110,110,139,121,162,31,161,151,214,
+174,27,198,247,20,251,168,251,8,145,31,139,86,251,10,60,26,60,166,84,176,
+176,160,212,202,202,115,247,15,139,30,177,247,3,247,83,247,155,247,11,26,
+36,6,251,26,45,251,59,91,251,25,30,14,21,215,55,192,55,251,35,251,31,251,
+74,251,36,44,30,247,91,80,69,247,19,251,19,27,111,251,105,248,44,29,170,135,
+237,251,183,158,59,25,75,251,52,33,251,12,67,77,248,33,29,247,43,247,183,
+190,170,31,11,28,6,154,249,97,21,248,76,251,251,247,248,252,68,252,74,251,
+249,251,250,252,74,252,77,247,249,251,248,248,70,248,76,247,247,247,248,248,
+77,30,40,22,252,19,251,201,251,210,252,21,252,21,248,100,29,248,17,248,19,
+247,201,251,205,252,23,30,11,21,247,29,251,62,7,217,248,91,5,251,27,6,251,
+232,71,5,66,7,247,68,120,88,251,187,5,251,101,251,29,247,76,6,64,252,80,247,
+181,29,247,177,247,74,248,70,247,99,176,30,184,247,152,5,14,248,30,29,110,
+196,203,152,31,247,60,249,164,5,251,34,6,251,230,71,5,70,7,247,64,120,251,
+25,253,8,5,251,3,115,212,251,46,247,95,27,247,25,242,174,201,229,31,110,145,
+166,71,247,33,27,247,9,247,43,191,169,194,31,11,247,25,29,213,248,1,24,137,
+167,176,139,162,27,248,45,247,150,247,107,247,211,31,251,191,107,21,251,48,
+62,37,40,81,30,55,88,45,127,59,141,247,17,249,6,24,174,6,247,72,233,51,251,
+53,31,11,247,233,29,252,91,253,234,24,251,25,249,234,5,164,135,157,145,162,
+27,139,188,139,182,141,30,243,252,187,35,7,174,137,184,137,139,26,161,160,
+135,112,143,31,247,93,28,251,12,5,247,127,6,249,87,28,5,13,5,11,251,21,6,
+102,251,25,5,119,135,116,128,117,27,251,255,6,217,247,245,5,247,93,6,149,
+158,131,128,137,31,120,251,0,5,247,13,6,217,247,242,5,251,13,6,108,47,5,122,
+135,119,133,118,27,251,78,6,206,247,220,5,247,195,6,158,149,129,128,31,251,
+25,247,13,7,11,21,247,125,251,3,247,48,251,144,251,84,251,36,53,251,23,251,
+2,30,251,97,7,247,113,247,76,235,186,244,27,247,23,149,251,25,251,17,55,106,
+251,246,251,121,90,31,251,7,247,52,5,251,45,98,251,1,90,73,210,53,247,54,
+248,29,247,120,247,198,247,246,31,14,250,119,22,215,248,39,5,251,41,6,50,
+251,145,5,124,132,127,131,121,27,252,133,6,248,142,248,224,251,136,248,170,
+5,248,79,6,155,147,131,123,31,130,251,116,5,247,44,6,211,248,9,5,254,107,
+6,116,251,13,247,144,252,174,252,145,252,230,116,251,13,5,14,21,205,65,225,
+251,54,252,27,251,119,251,197,251,246,247,58,29,223,172,247,244,247,123,190,
+31,247,5,251,51,5,247,46,182,247,0,188,31,11,28,4,154,205,21,248,25,29,247,
+48,249,180,5,251,164,6,53,252,76,5,251,226,6,227,248,101,5,251,33,6,251,218,
+71,5,68,7,247,56,122,251,60,253,248,5,247,166,6,223,248,80,5,247,228,6,88,
+251,154,11,72,27,62,86,168,247,25,166,31,247,37,29,235,247,43,177,185,246,
+31,57,252,54,248,161,29,11,21,193,92,180,81,82,94,98,85,86,184,96,196,197,
+186,182,192,30,153,253,156,21,207,7,114,92,65,123,123,27,108,139,166,167,
+145,31,242,248,130,5,47,6,251,114,98,5,96,7,247,7,129,55,252,46,5,80,127,
+174,73,235,27,217,206,153,178,217,31,14,21,199,7,135,125,43,116,132,27,107,
+135,151,176,31,225,248,42,143,149,159,178,149,163,25,251,35,6,131,129,5,153,
+108,98,152,100,27,251,178,251,21,251,113,251,77,49,196,251,25,247,58,200,
+203,166,167,186,31,102,155,178,121,196,27,207,213,168,161,200,31,11,21,251,
+255,251,126,252,35,251,129,251,50,251,35,247,60,247,154,248,23,247,129,248,
+11,247,140,247,33,247,38,251,58,251,156,30,14,247,209,29,251,83,251,56,251,
+52,251,23,84,178,43,227,247,138,29,253,56,253,158,247,99,251,5,11,21,247,
+17,39,180,251,3,30,125,57,5,206,201,123,59,251,13,71,78,251,9,31,123,57,5,
+247,58,247,23,239,247,68,31,14,21,248,13,251,164,247,41,252,60,30,252,168,
+37,6,196,133,200,135,139,26,164,137,155,134,135,115,251,105,254,210,24,133,
+111,133,135,106,137,8,139,76,137,79,132,30,37,248,161,7,248,213,248,81,29,
+251,117,11,235,254,100,215,29,247,142,6,11,247,162,29,231,29,11,247,205,249,
+76,240,29,250,248,247,166,29,251,96,251,9,251,50,251,33,71,217,76,212,189,
+214,176,182,166,31,35,247,19,5,165,155,153,164,172,196,205,92,243,27,182,
+217,131,141,194,31,11,139,78,135,77,248,79,29,104,141,133,143,143,163,239,
+248,150,248,198,29,11,232,252,148,46,7,192,135,188,137,139,26,156,137,143,
+123,137,127,79,251,155,24,133,108,86,127,100,27,66,251,93,203,247,119,247,
+222,247,158,247,96,247,89,188,198,121,133,160,31,161,131,152,116,131,26,126,
+251,54,5,247,50,6,200,247,173,11,21,191,182,182,191,191,96,182,87,87,96,96,
+87,87,182,96,191,31,11,251,68,78,135,43,247,48,155,100,251,152,116,251,126,
+105,251,80,25,106,251,66,98,222,29,174,247,38,209,248,146,155,247,6,8,11,
+252,188,248,57,29,251,107,254,210,24,133,113,123,135,112,137,8,247,25,29,
+213,248,1,24,137,167,176,139,162,27,11,28,6,238,249,52,21,247,19,251,30,184,
+35,251,56,251,99,57,251,87,72,188,79,203,115,30,251,9,108,35,76,251,28,26,
+251,39,247,51,90,247,13,247,62,247,115,219,247,94,240,68,180,57,167,30,241,
+184,238,195,247,21,26,11,143,165,217,144,160,27,247,48,247,12,251,67,252,
+22,69,31,59,252,82,251,173,52,252,0,233,8,133,124,136,51,139,26,248,67,251,
+45,248,146,247,48,232,248,228,8,248,26,200,251,78,247,126,251,232,27,108,
+59,135,137,106,31,11,43,7,182,135,188,137,139,26,165,137,150,128,132,111,
+86,251,152,59,251,171,76,45,8,131,133,106,77,114,27,251,0,229,5,32,90,58,
+75,53,209,114,200,247,7,247,7,164,247,25,243,31,221,244,223,247,148,215,248,
+10,8,11,247,95,29,251,85,143,21,251,43,53,251,64,45,108,80,186,247,19,247,
+58,235,247,47,219,174,198,88,251,13,30,14,250,58,250,3,21,248,47,29,30,247,
+114,29,11,247,103,6,251,103,254,241,248,60,29,248,254,241,7,84,146,76,143,
+139,26,114,141,121,143,143,163,247,103,250,243,24,247,30,29,11,143,171,203,
+143,158,27,247,48,247,12,251,67,252,22,69,31,59,252,82,251,173,52,252,0,233,
+8,133,124,136,51,139,26,248,67,251,45,248,146,247,48,232,248,228,8,248,26,
+200,251,78,247,126,251,232,27,111,72,136,137,11,247,19,215,247,37,217,223,
+27,188,158,106,67,149,31,247,31,6,184,247,142,5,192,105,65,166,43,27,44,251,
+12,57,251,11,36,31,174,247,60,5,252,101,33,6,137,168,159,139,168,27,211,137,
+130,92,135,126,8,14,5,251,27,247,48,29,251,115,28,251,131,5,133,112,137,115,
+116,26,45,219,77,247,27,11,251,50,75,49,251,76,247,9,24,84,100,100,80,85,
+26,90,192,45,247,9,247,148,247,78,247,193,247,109,192,30,11,5,247,164,6,247,
+42,249,97,5,225,223,237,204,200,27,180,189,84,41,118,31,11,247,32,29,251,
+107,184,198,251,11,247,144,248,136,29,11,252,98,251,112,31,90,248,98,129,
+242,63,188,251,33,141,25,251,132,65,5,68,7,203,137,208,136,139,26,174,137,
+149,137,152,107,8,180,32,184,252,211,122,26,141,96,124,88,104,69,8,247,136,
+6,247,249,249,153,11,5,251,46,6,41,251,162,133,124,129,123,118,137,25,127,
+115,51,120,81,27,251,68,251,93,247,15,247,203,248,111,247,206,247,173,247,
+152,247,222,29,11,164,247,15,245,247,12,247,21,248,128,29,248,47,29,31,247,
+114,29,251,171,28,250,201,5,211,6,14,21,251,125,251,96,65,251,48,133,30,139,
+104,137,123,30,239,248,166,190,143,5,203,144,247,88,114,251,91,26,11,5,251,
+165,6,47,252,127,5,114,84,108,127,104,27,49,149,180,225,156,31,223,248,62,
+5,251,34,6,251,207,71,5,68,7,247,46,122,81,251,187,5,251,45,108,234,63,247,
+74,27,194,209,157,162,202,31,11,250,64,249,197,21,247,89,29,49,251,11,43,
+251,89,63,31,251,64,71,251,56,251,19,251,19,26,11,247,3,29,247,21,249,13,
+5,11,251,134,6,253,138,28,250,244,251,11,126,5,37,248,163,241,7,88,143,83,
+146,139,26,113,141,126,147,152,159,247,94,248,11,24,248,23,6,199,252,11,143,
+115,123,135,112,137,25,139,88,132,96,135,30,37,11,5,75,237,247,17,100,248,
+113,29,31,247,60,29,11,21,176,109,190,69,74,71,102,94,92,30,157,221,5,45,
+6,251,111,98,5,96,7,247,5,129,251,11,252,157,5,247,70,6,213,247,218,155,213,
+209,208,223,178,25,173,74,5,230,173,165,197,31,14,204,94,219,251,31,33,57,
+110,92,81,30,251,62,251,33,135,251,50,251,15,251,45,82,65,59,73,33,127,11,
+21,56,252,74,251,139,251,5,251,69,135,251,62,135,24,154,221,247,220,154,247,
+88,247,15,206,247,243,25,200,247,216,39,247,60,251,255,146,151,203,24,247,
+21,6,247,103,247,103,35,252,107,49,31,11,86,84,104,251,1,149,76,8,251,46,
+86,251,12,44,251,31,26,251,39,247,8,251,52,247,216,247,201,247,148,247,60,
+247,64,247,11,53,190,251,23,196,30,251,164,247,15,135,162,147,182,153,178,
+25,11,251,64,229,24,86,105,114,94,83,26,100,170,57,247,5,247,123,192,247,
+28,247,156,219,30,211,247,121,235,252,246,5,247,42,6,248,12,249,54,5,101,
+251,95,81,251,189,98,26,57,197,69,247,27,11,251,96,27,32,251,15,88,71,39,
+31,164,247,11,5,251,34,6,251,228,71,5,70,7,247,64,122,251,72,253,250,5,247,
+165,6,247,37,249,74,248,53,29,11,21,207,86,192,72,71,86,86,71,72,192,85,207,
+206,192,193,206,30,14,247,1,7,70,62,70,91,37,27,98,93,146,156,85,31,164,60,
+36,189,33,27,130,130,139,138,130,31,251,43,128,88,84,100,99,8,251,0,7,212,
+215,199,186,241,27,196,209,124,106,232,31,108,11,139,78,135,77,248,79,29,
+104,141,133,143,143,163,239,248,150,24,11,129,164,136,157,123,247,59,29,11,
+247,3,7,96,42,59,121,107,27,87,129,192,186,147,31,11,21,191,67,245,251,45,
+251,89,251,67,251,15,251,84,36,214,49,217,74,30,230,63,199,81,55,26,43,102,
+78,65,90,63,161,180,113,30,172,247,13,5,168,116,102,159,85,27,89,86,72,67,
+11,247,244,251,111,247,253,251,54,247,91,30,247,40,29,11,21,251,26,6,91,120,
+80,99,87,251,40,113,227,251,23,27,251,57,251,8,36,251,21,62,31,247,26,6,189,
+160,196,178,191,247,40,166,50,247,22,27,247,60,247,9,242,247,21,212,31,11,
+21,251,27,6,251,232,71,5,66,7,247,68,120,251,43,254,0,247,181,29,247,175,
+247,76,248,70,247,99,176,30,11,35,7,241,129,161,136,158,123,135,112,25,90,
+251,133,251,44,252,87,251,45,251,111,8,251,38,251,99,251,121,51,139,26,55,
+252,64,5,248,69,29,11,248,188,29,247,97,219,160,184,30,248,26,29,11,135,113,
+131,135,100,135,25,248,12,29,14,248,21,247,74,247,185,247,171,247,172,251,
+74,247,185,252,21,31,253,1,251,5,248,252,6,247,172,247,58,251,90,251,154,
+251,155,251,58,251,88,251,172,31,252,252,251,5,6,14,21,153,208,5,251,37,6,
+251,12,119,178,222,155,31,222,155,173,248,38,29,76,73,251,17,115,31,251,17,
+115,177,73,247,69,27,14,248,115,29,162,101,205,251,69,27,251,25,6,126,70,
+5,247,37,6,247,12,158,100,56,124,31,56,123,104,100,251,12,27,251,37,6,127,
+70,5,14,247,5,252,252,7,251,172,251,58,247,88,247,155,247,154,247,58,247,
+90,247,172,31,248,252,247,5,253,1,6,252,21,251,74,251,185,251,172,251,171,
+247,74,251,185,248,21,31,14,21,223,80,205,59,57,84,71,57,59,198,80,219,217,
+198,203,214,30,11,21,77,204,5,251,25,251,12,251,219,110,251,181,27,251,184,
+251,192,168,247,25,65,31,53,74,5,251,73,223,247,148,45,248,23,27,248,21,247,
+182,238,247,68,247,40,31,14,6,124,121,5,164,92,76,157,80,27,252,77,251,90,
+252,5,251,197,251,45,229,251,114,247,144,11,106,171,82,106,26,108,70,86,139,
+30,178,248,75,29,150,11,49,21,247,40,32,250,226,28,6,121,251,56,242,5,11,
+243,7,251,5,247,175,29,237,248,131,5,247,179,6,164,247,15,5,251,179,6,233,
+248,109,247,19,29,11,27,72,59,108,98,73,31,156,211,5,47,248,49,29,247,4,129,
+251,9,252,159,5,247,69,6,235,248,52,5,192,194,209,189,180,27,167,158,118,
+80,124,31,11,247,102,21,253,20,6,194,251,2,5,248,76,6,103,251,67,5,49,120,
+123,122,118,27,45,247,54,5,67,109,92,97,47,26,53,213,84,220,247,21,216,211,
+247,74,176,30,11,247,192,29,252,130,252,68,251,238,252,146,248,40,29,31,11,
+21,194,93,187,76,81,95,95,85,86,182,92,196,198,191,180,193,30,37,251,59,21,
+68,6,78,251,63,251,11,251,200,108,26,84,178,115,191,199,205,170,208,143,30,
+14,5,248,19,6,166,147,131,106,137,31,129,251,121,5,247,41,6,11,233,248,113,
+144,158,145,149,157,141,25,247,31,149,5,248,7,29,59,252,41,24,129,102,65,
+120,86,27,45,251,152,11,21,247,81,54,247,39,251,115,145,30,125,73,5,247,23,
+123,169,35,33,26,251,107,48,252,86,251,161,107,30,126,72,5,248,11,150,247,
+51,248,48,247,183,26,14,113,76,87,128,118,27,105,133,171,167,144,31,247,56,
+249,160,5,51,6,251,117,100,5,95,7,247,9,129,251,37,253,69,5,135,123,138,124,
+126,26,82,191,102,227,11,254,207,35,6,247,4,129,164,136,157,123,133,112,25,
+53,252,72,5,251,105,6,115,251,15,5,247,105,6,40,252,131,135,112,115,123,114,
+137,25,251,19,128,5,35,11,27,247,199,247,42,247,62,247,50,239,51,219,46,211,
+31,51,207,45,216,223,26,191,143,214,221,170,161,131,139,30,244,251,70,5,247,
+17,147,186,180,231,26,14,139,78,135,81,248,79,29,110,141,127,143,143,163,
+11,150,29,251,103,254,241,248,60,29,11,21,162,247,9,5,251,68,6,178,247,80,
+5,251,0,6,100,251,80,5,251,66,6,116,251,9,5,247,66,6,100,251,83,5,247,0,6,
+178,247,83,5,14,21,247,87,251,32,214,251,70,30,113,251,29,5,247,0,227,108,
+251,17,251,82,43,251,11,251,84,31,112,251,29,5,247,168,247,79,247,82,247,
+171,31,14,247,187,29,14,247,115,6,248,80,29,11,21,49,6,251,224,55,5,69,7,
+247,97,166,251,23,253,3,5,131,136,129,129,127,27,251,27,131,5,71,248,109,
+207,7,39,147,124,141,127,145,141,147,25,11,248,50,29,248,255,241,7,77,143,
+76,146,139,26,112,141,129,145,143,161,225,248,89,24,162,165,141,156,27,247,
+47,168,251,70,251,11,166,31,11,21,252,12,129,251,51,252,47,251,185,26,251,
+80,223,251,41,247,116,134,30,154,206,5,251,24,155,109,243,246,26,247,108,
+228,248,84,247,162,171,30,14,231,94,209,41,45,48,59,42,111,148,108,153,115,
+30,247,15,6,112,251,36,45,251,2,251,31,91,159,62,24,247,97,196,247,109,247,
+87,247,117,26,14,27,247,83,247,56,247,50,248,167,29,125,31,247,193,29,11,
+247,169,247,27,247,62,247,50,239,59,219,56,211,31,59,207,55,216,223,26,191,
+142,214,213,167,159,131,139,30,233,251,70,5,247,5,147,181,180,231,26,11,212,
+248,10,143,166,164,153,164,144,25,237,149,5,243,252,220,248,119,29,58,252,
+47,5,251,115,96,247,31,53,247,82,27,11,21,252,142,6,106,251,57,5,248,144,
+6,14,247,116,29,247,43,249,85,248,51,29,11,251,230,89,131,70,247,54,98,219,
+40,206,251,12,191,251,15,25,141,124,105,147,126,27,251,219,251,114,251,220,
+251,215,251,126,247,32,251,56,247,160,11,247,11,7,247,57,29,11,21,251,32,
+210,251,37,184,171,247,50,8,247,69,175,247,29,207,230,27,247,39,247,18,251,
+19,251,28,111,31,118,34,45,53,251,33,74,8,14,21,247,145,28,5,46,147,181,111,
+179,97,147,25,97,147,99,111,131,97,251,145,28,250,210,24,131,97,167,99,181,
+131,181,131,179,167,147,181,8,11,26,247,71,29,144,124,132,104,11,28,5,27,
+28,5,94,21,254,150,6,65,252,9,5,247,64,6,204,247,110,5,159,147,168,147,160,
+27,248,62,6,254,75,28,251,133,119,39,5,11,197,89,251,112,74,251,47,251,4,
+104,251,64,8,251,86,100,247,28,251,70,247,223,27,247,219,247,147,247,61,247,
+157,194,31,210,247,239,252,226,11,21,53,202,88,223,219,223,190,229,164,131,
+164,120,157,30,251,21,6,156,215,231,196,206,158,156,221,24,251,38,112,251,
+94,32,251,64,26,14,6,251,238,74,5,65,7,247,72,123,11,55,252,50,133,113,120,
+135,113,137,25,139,77,135,84,248,46,29,80,143,139,26,110,141,125,143,145,
+163,225,248,68,24,11,251,29,6,251,236,74,5,65,7,247,70,123,71,251,247,5,144,
+121,116,143,125,27,251,86,51,251,9,251,25,251,3,239,61,247,41,115,31,11,247,
+131,29,251,172,251,205,251,31,247,205,5,163,128,160,146,157,27,139,209,141,
+204,145,30,241,11,21,251,168,251,79,251,84,251,169,251,86,247,32,63,247,70,
+31,165,247,29,5,251,2,53,170,247,17,247,80,235,247,13,247,85,31,14,36,150,
+117,141,120,155,144,166,25,247,100,250,178,144,166,163,155,164,142,25,11,
+251,41,150,251,132,248,101,117,182,83,165,68,152,25,208,173,219,211,192,221,
+11,251,66,70,5,55,7,247,39,155,251,17,252,246,5,133,110,137,112,113,26,11,
+5,247,68,6,237,248,66,5,191,193,202,176,180,27,166,171,108,79,125,31,59,251,
+250,5,76,125,215,118,200,27,211,206,157,168,207,31,11,248,101,29,102,223,
+92,247,27,125,188,202,247,46,247,11,247,11,205,188,229,32,24,247,31,143,242,
+192,11,251,126,247,2,251,48,247,190,29,37,27,251,24,127,247,27,247,17,11,
+133,112,25,251,101,254,178,135,112,115,123,114,137,25,11,251,177,131,247,
+81,29,11,27,252,33,251,244,251,150,252,5,251,47,225,251,159,248,60,247,25,
+247,25,172,170,247,21,31,213,247,215,5,160,145,151,151,147,27,11,251,76,251,
+34,59,251,47,77,188,53,223,197,167,149,191,199,31,90,247,37,5,172,165,160,
+151,184,27,194,6,162,157,131,114,135,31,11,21,251,97,96,251,39,75,251,128,
+119,116,141,123,27,246,248,167,5,143,165,180,144,160,27,247,62,247,59,88,
+251,114,92,31,14,5,133,112,137,115,116,26,45,219,77,247,27,245,247,15,172,
+190,238,30,11,35,7,241,129,164,136,157,123,133,112,25,11,21,251,132,251,27,
+251,197,251,64,102,83,174,159,107,30,247,17,249,11,5,176,179,225,213,197,
+27,247,0,154,251,30,251,6,31,11,247,124,207,247,70,247,27,247,107,26,247,
+119,251,105,219,251,167,30,252,227,37,6,196,133,200,135,139,26,166,137,153,
+132,133,117,11,139,90,137,96,135,30,41,248,66,7,248,101,247,175,247,154,247,
+244,31,251,177,154,21,251,169,251,60,251,127,251,158,30,86,6,11,21,251,12,
+96,86,57,74,30,58,75,251,32,130,84,151,245,248,165,24,141,149,182,139,149,
+27,247,30,233,68,251,53,31,14,247,81,29,14,247,97,251,78,247,50,251,130,251,
+66,251,33,69,37,251,7,30,168,247,31,5,252,113,37,6,194,135,200,135,139,26,
+176,135,11,251,248,251,120,252,40,251,133,251,27,251,54,247,38,247,174,248,
+5,247,117,248,29,247,136,247,33,247,48,251,48,251,166,30,11,115,86,118,88,
+125,85,79,90,8,109,117,38,153,139,26,123,59,5,139,194,108,211,180,247,29,
+150,192,201,30,247,25,247,7,11,148,112,98,155,88,27,252,50,251,98,252,1,251,
+205,251,68,237,251,87,247,129,227,236,182,195,212,31,77,162,198,102,242,27,
+11,247,155,29,148,142,148,143,148,143,8,14,6,248,0,29,11,21,233,64,217,44,
+45,61,61,45,45,217,63,233,234,214,215,233,30,11,37,7,193,133,200,137,139,
+26,172,137,153,132,135,115,51,252,87,24,11,235,7,251,99,120,215,247,36,102,
+31,100,247,45,119,242,251,50,210,11,5,247,66,172,87,233,251,96,27,32,251,
+15,88,71,39,31,164,247,11,5,251,34,6,251,228,71,5,70,7,247,64,122,11,21,251,
+146,251,47,251,177,251,27,75,100,176,174,117,30,247,6,248,248,5,192,201,215,
+180,196,27,186,198,72,251,64,31,11,119,117,129,139,104,137,25,139,94,134,
+100,135,30,37,248,199,241,7,251,21,148,117,141,136,157,150,149,25,247,221,
+247,253,11,251,66,27,120,80,141,247,220,29,247,131,121,247,27,247,207,11,
+21,53,252,128,5,37,78,51,47,247,189,29,14,248,179,29,176,141,164,31,247,165,
+161,247,209,247,15,247,107,26,11,24,248,59,29,248,236,241,7,82,143,96,146,
+139,26,110,141,126,153,144,166,11,51,129,73,24,148,112,100,155,88,27,252,
+52,251,96,252,1,251,205,251,68,235,251,87,247,129,229,234,182,195,214,31,
+11,251,0,251,44,83,61,49,88,251,41,157,8,35,7,114,221,192,131,188,27,247,
+31,234,182,203,210,31,247,74,247,93,11,247,1,251,19,237,251,54,251,68,251,
+9,88,251,5,51,30,244,49,5,247,5,247,4,178,161,211,27,215,131,94,96,11,28,
+4,227,21,247,218,6,161,164,133,119,31,251,89,247,58,7,206,247,238,5,254,182,
+37,6,194,133,200,135,139,26,11,252,138,21,251,173,247,204,5,190,92,112,153,
+84,27,51,110,80,87,115,162,96,168,123,31,247,223,251,75,5,14,21,251,60,251,
+21,37,251,68,251,15,237,98,247,3,31,155,221,5,72,75,155,219,247,11,209,202,
+247,8,31,14,247,164,6,225,248,56,182,178,190,251,3,225,251,82,184,69,25,11,
+5,165,128,160,146,162,27,139,204,143,200,143,30,241,252,252,37,7,186,135,
+194,135,139,26,164,137,159,139,146,116,11,21,247,52,32,247,223,29,247,38,
+247,87,247,84,30,11,21,247,64,35,247,107,251,112,68,57,112,100,65,30,246,
+248,187,5,251,32,247,48,29,11,26,141,94,124,88,105,69,8,247,92,6,247,25,247,
+38,247,144,247,174,247,77,247,228,8,153,164,170,198,209,26,11,28,4,123,248,
+250,21,247,171,251,117,245,251,232,30,252,71,41,6,209,133,172,139,139,26,
+151,137,145,129,137,130,11,251,46,251,21,41,251,50,80,217,77,203,184,180,
+166,188,196,31,82,247,36,5,147,145,161,159,162,27,235,6,149,11,135,115,129,
+133,112,137,25,247,168,29,11,143,163,154,146,163,141,25,139,203,143,202,145,
+30,248,143,29,194,133,198,135,139,26,168,137,155,134,135,115,11,251,69,6,
+66,251,216,121,66,70,66,55,101,25,103,204,5,50,103,112,83,103,170,87,208,
+207,205,176,185,187,31,11,28,4,238,250,230,21,248,92,29,200,133,200,135,139,
+26,164,137,151,132,135,117,11,21,251,48,62,37,40,81,30,55,88,45,127,59,141,
+247,17,249,6,24,174,6,247,72,233,51,251,53,31,14,7,251,62,248,58,44,102,247,
+150,252,234,5,247,32,6,14,145,166,164,155,161,142,25,247,11,149,5,243,11,
+6,158,149,131,125,135,31,123,34,5,247,12,6,215,247,232,5,251,13,6,111,55,
+5,125,135,130,133,119,27,11,21,170,87,202,251,3,251,34,251,19,66,251,8,78,
+194,85,194,100,30,205,93,183,104,89,26,81,112,103,86,11,33,77,106,112,90,
+27,121,118,155,160,129,31,251,9,247,119,127,162,100,165,104,156,25,178,163,
+176,180,170,184,11,247,217,29,247,166,247,3,247,62,229,247,33,26,11,248,13,
+29,251,172,251,202,5,247,35,6,247,224,247,73,5,168,155,161,182,166,26,11,
+28,250,136,6,106,251,57,5,28,5,120,6,112,39,21,28,250,136,6,106,251,57,5,
+28,5,120,6,14,251,254,21,116,183,225,98,191,27,227,247,12,174,243,179,31,
+11,165,247,29,248,71,29,11,8,112,110,67,47,51,27,251,15,143,247,17,247,0,
+247,126,247,11,247,201,247,154,162,153,53,127,135,31,11,24,248,111,29,8,248,
+35,29,124,147,146,167,25,11,135,112,115,123,114,137,25,251,11,128,5,35,248,
+240,248,133,29,225,248,72,11,28,5,139,250,123,21,251,205,6,251,236,252,246,
+43,248,246,5,252,105,53,6,247,35,131,5,149,145,125,11,243,27,182,217,131,
+141,194,31,252,203,252,136,247,56,251,29,235,247,19,5,233,108,247,3,35,251,
+19,26,11,249,7,21,251,17,251,60,41,251,33,106,30,247,42,176,212,248,9,29,
+14,248,217,21,251,6,80,252,42,251,50,55,127,239,205,247,13,198,248,15,247,
+60,215,149,53,79,30,14,249,130,248,67,29,5,164,135,157,145,162,27,139,178,
+139,182,141,30,243,252,177,35,7,219,135,5,161,160,135,112,143,31,11,31,132,
+102,159,102,139,26,247,63,6,183,127,149,92,128,83,127,75,62,35,251,94,65,
+118,251,1,24,11,112,251,25,86,251,54,57,247,218,29,215,11,146,162,141,25,
+139,200,143,205,145,30,241,252,250,37,7,194,133,198,135,139,26,174,137,149,
+134,135,115,11,176,57,251,17,184,251,76,27,251,251,251,109,251,82,251,155,
+251,55,247,33,57,247,38,65,31,239,88,11,21,252,140,6,77,251,201,5,247,5,6,
+178,247,88,5,247,171,6,100,251,88,5,247,4,6,14,5,131,166,177,130,189,27,248,
+25,247,135,247,226,247,220,11,6,251,234,69,5,76,7,247,50,112,251,64,253,244,
+5,11,241,252,185,37,7,247,2,129,166,137,131,122,128,129,25,11,21,247,19,28,
+251,52,251,19,7,11,6,251,223,251,44,58,251,75,104,31,115,251,21,243,61,247,
+31,98,88,125,90,115,114,116,78,86,11,7,247,62,252,58,234,176,247,224,29,11,
+119,39,5,250,224,6,221,248,60,5,251,64,6,65,251,158,5,120,133,108,127,119,
+27,252,140,6,11,139,26,119,57,90,82,87,131,251,35,247,21,24,67,122,59,82,
+59,26,61,195,80,247,31,247,148,11,160,241,5,247,165,29,11,207,215,196,162,
+151,31,251,13,247,21,5,169,158,223,168,167,27,186,180,112,100,211,31,247,
+21,166,11,248,148,29,248,56,251,85,248,148,29,14,21,251,232,249,117,5,49,
+6,251,232,253,117,5,232,6,247,184,249,39,247,185,253,39,5,14,21,28,250,138,
+6,106,251,57,5,28,5,120,6,14,21,251,182,78,251,79,251,163,251,90,27,251,27,
+251,54,247,38,247,174,184,141,184,145,182,31,11,248,42,247,55,104,230,252,
+212,251,141,5,251,25,7,248,212,251,141,174,230,252,42,247,55,5,11,248,58,
+247,62,102,233,252,234,251,150,5,251,31,7,248,234,251,150,176,233,252,58,
+247,62,5,11,251,13,251,21,76,25,84,247,0,5,251,29,84,94,45,79,186,53,245,
+244,241,201,215,213,31,11,251,54,247,193,248,118,29,195,247,159,143,157,147,
+149,164,142,25,11,156,133,150,114,137,123,137,251,121,24,247,21,6,193,247,
+252,5,190,251,30,35,174,251,26,27,11,251,97,27,251,13,251,0,96,88,57,31,247,
+15,248,215,5,251,34,6,251,238,74,5,65,7,11,28,5,185,248,14,29,252,207,35,
+7,211,129,161,134,158,125,135,112,25,48,252,94,5,11,249,222,21,247,11,76,
+202,251,60,34,251,15,88,71,37,30,163,247,11,5,251,31,6,251,230,11,41,7,248,
+108,29,11,241,7,94,143,90,144,139,26,108,143,133,143,135,165,11,5,123,74,
+133,81,111,26,251,81,247,51,59,247,134,247,199,247,42,247,30,247,98,186,30,
+11,21,251,17,90,251,82,251,27,71,131,206,234,247,92,247,29,247,26,184,217,
+139,55,42,30,11,30,251,19,196,5,247,217,29,11,248,114,6,181,174,174,181,181,
+104,174,97,31,252,114,6,97,104,104,97,97,174,104,181,31,11,121,47,130,59,
+100,26,251,146,247,81,251,3,247,195,248,13,247,74,247,81,247,176,194,30,11,
+143,160,147,153,166,141,25,241,145,5,231,252,152,47,7,229,133,164,137,145,
+125,135,118,25,11,241,252,232,37,7,186,135,199,135,139,26,167,137,150,128,
+118,121,252,97,252,85,24,123,6,11,21,53,104,94,251,21,49,27,94,119,184,170,
+225,225,206,218,156,163,135,129,168,31,14,21,251,7,205,253,189,28,251,4,244,
+69,5,14,182,247,123,5,251,97,6,35,251,103,11,5,151,141,153,157,159,27,247,
+204,248,54,29,11,248,19,29,30,251,172,141,21,251,47,11,254,150,6,65,252,9,
+5,247,64,6,204,247,110,5,159,146,169,147,160,27,248,62,6,11,247,252,29,251,
+35,243,251,50,27,11,248,50,29,249,1,241,7,73,146,76,143,139,26,112,141,131,
+145,143,161,11,139,76,135,75,248,46,29,78,143,139,26,114,141,121,143,143,
+163,11,254,222,6,76,251,250,5,247,36,6,209,247,109,5,157,145,168,150,156,
+27,247,82,6,11,252,80,247,187,29,11,21,96,251,109,5,73,157,80,178,186,26,
+217,190,188,219,155,150,133,131,149,30,14,5,251,30,6,251,229,71,5,70,7,247,
+62,120,11,135,120,129,127,118,137,25,139,51,129,102,137,30,11,219,65,190,
+43,75,76,119,106,104,30,196,251,152,11,150,116,141,121,155,143,166,25,11,
+5,137,119,137,123,120,248,19,29,11,21,69,252,11,5,80,6,38,51,182,247,52,170,
+31,247,21,164,227,182,247,23,27,11,26,251,83,251,57,45,251,15,69,251,66,203,
+155,141,30,162,247,136,5,251,67,6,11,37,7,194,133,201,135,139,26,172,137,
+149,134,135,115,251,36,253,99,24,251,117,94,11,67,108,25,251,89,241,5,39,
+75,83,65,98,26,80,194,61,247,66,247,106,247,33,11,120,38,96,251,12,102,81,
+25,251,86,190,5,248,156,29,11,225,251,52,251,95,251,37,251,31,251,87,102,
+30,245,6,242,182,229,202,247,5,27,11,241,252,121,35,7,186,137,176,139,139,
+26,155,137,164,137,127,112,252,91,253,234,24,11,164,247,15,245,247,12,247,
+21,248,128,29,31,14,6,155,237,153,247,105,247,5,238,247,19,251,13,24,247,
+227,29,11,7,211,247,248,5,251,54,6,74,251,96,5,122,132,109,127,118,27,252,
+72,6,11,21,217,7,254,9,247,175,5,61,7,249,171,251,136,253,171,251,135,5,61,
+7,11,27,251,168,251,23,251,34,251,6,76,31,194,66,5,221,189,247,7,236,247,
+133,11,69,27,63,98,211,247,57,247,218,247,83,247,115,247,35,188,180,49,129,
+137,31,11,247,142,247,87,247,33,225,247,24,247,5,30,247,96,7,251,113,251,
+77,41,90,11,251,35,45,251,3,251,31,92,159,62,24,247,97,196,247,109,247,86,
+247,118,26,11,137,115,248,123,29,190,251,58,37,164,251,48,27,11,247,15,251,
+23,5,108,121,55,111,110,27,92,98,165,178,65,31,251,21,112,5,11,247,243,29,
+213,251,43,11,238,159,247,19,251,14,24,203,145,235,167,238,26,198,96,221,
+251,34,30,14,27,75,248,158,29,11,113,78,73,120,96,27,119,98,152,206,151,31,
+11,194,133,200,135,139,26,166,137,155,134,133,115,11,21,251,189,6,247,121,
+248,33,5,11,213,27,233,247,25,182,174,207,31,11,5,247,215,29,11,21,251,141,
+251,12,247,98,247,124,248,87,247,212,247,127,247,233,31,168,6,11,247,85,81,
+84,147,47,27,96,251,93,80,122,92,31,76,7,247,109,122,5,11,60,69,68,63,69,
+27,61,98,211,247,57,247,218,247,83,247,115,247,37,186,11,96,135,25,251,2,
+247,45,5,87,251,2,66,47,69,174,55,247,23,247,154,11,117,106,137,25,251,15,
+132,5,33,249,15,245,7,251,13,146,98,141,123,159,11,141,25,251,136,67,5,66,
+7,209,137,210,134,139,26,176,141,135,109,152,31,11,196,27,247,68,247,93,251,
+15,251,203,252,111,251,205,251,173,251,150,75,35,11,251,117,247,6,83,251,
+21,5,129,129,125,137,120,113,251,7,227,251,31,27,11,28,7,123,248,181,21,247,
+31,7,252,234,247,150,102,45,248,58,251,62,5,11,6,166,161,196,195,176,190,
+235,247,25,247,56,247,232,245,248,166,8,14,153,84,27,51,110,80,90,112,162,
+96,167,123,31,247,224,251,73,5,14,21,253,70,6,92,251,111,5,245,6,182,247,
+0,5,247,255,6,252,230,11,27,247,45,247,91,227,158,176,31,247,21,7,77,251,
+27,67,105,67,27,11,43,80,251,15,251,1,251,13,26,35,246,104,227,192,241,180,
+162,191,30,11,57,132,25,251,11,247,52,5,43,69,49,65,66,213,71,247,19,247,
+240,11,251,21,251,15,59,96,39,27,63,125,215,204,232,231,243,247,5,184,31,
+11,127,251,36,247,21,24,68,122,59,82,59,26,61,192,80,247,31,247,177,11,143,
+110,106,145,117,27,251,99,251,52,251,3,251,70,35,240,63,247,2,11,157,116,
+31,104,247,76,5,150,117,110,145,100,27,51,68,63,57,251,52,11,251,79,251,11,
+27,251,21,247,32,5,33,106,110,61,86,26,65,205,90,11,200,244,106,127,161,31,
+160,133,151,114,137,123,137,251,121,24,247,43,6,11,221,251,56,251,137,251,
+30,251,93,251,84,251,28,221,39,247,77,247,133,11,251,150,248,234,5,251,32,
+6,251,150,252,234,234,102,247,62,248,58,5,11,6,28,251,94,28,250,113,5,247,
+42,6,11,137,108,137,25,139,76,134,85,135,30,37,11,247,37,159,170,201,200,
+26,11,5,202,252,117,37,7,196,133,198,135,139,26,166,137,155,134,133,115,11,
+6,164,155,121,112,135,31,251,101,254,170,135,112,114,123,115,137,25,11,248,
+54,29,205,247,228,5,11,21,220,176,46,51,251,15,55,251,107,251,51,131,31,243,
+248,162,5,11,21,227,65,209,51,51,69,69,51,51,209,67,227,227,213,211,227,30,
+11,21,241,252,139,35,7,186,137,194,139,139,26,155,137,164,137,127,112,11,
+21,248,3,29,11,21,215,76,201,63,63,78,77,63,64,200,77,215,215,202,201,214,
+30,11,25,192,247,246,5,251,22,6,55,251,149,134,125,131,123,121,137,25,11,
+247,87,248,16,29,11,133,112,115,123,114,137,25,251,9,128,5,35,248,228,243,
+7,47,150,11,144,251,129,21,177,247,79,5,251,0,6,78,251,198,5,250,101,6,11,
+175,136,178,136,139,26,157,138,149,136,135,125,251,30,253,32,24,136,11,252,
+76,248,17,29,11,209,112,196,51,174,30,251,50,251,36,5,92,154,139,225,200,
+26,190,11,247,33,7,251,33,251,17,251,9,67,251,139,215,251,5,174,251,38,11,
+248,9,247,113,247,216,247,214,11,182,251,87,176,251,92,145,106,11,5,39,119,
+192,251,3,247,42,27,247,10,244,164,205,247,15,31,11,6,251,110,254,215,135,
+112,115,123,114,137,25,251,11,128,5,35,11,21,247,4,7,98,63,251,7,111,117,
+27,90,139,184,188,149,31,11,26,251,76,247,41,251,33,247,251,247,93,247,41,
+212,183,212,30,11,27,90,133,159,201,31,247,25,249,55,248,139,29,11,57,61,
+67,57,80,94,182,198,221,214,213,221,199,186,96,78,30,11,250,39,21,251,78,
+247,34,47,251,19,5,137,133,106,131,131,42,11,247,164,6,225,248,56,158,135,
+173,131,148,124,25,247,64,251,226,11,135,133,110,30,221,248,39,248,145,29,
+11,135,123,127,126,117,137,25,139,98,137,81,135,30,47,250,27,7,11,248,80,
+29,213,247,250,5,11,251,95,100,235,42,247,139,248,149,29,11,200,252,37,78,
+7,176,136,177,136,139,26,158,138,148,136,136,125,11,214,76,201,63,63,78,77,
+64,63,200,77,215,215,202,201,215,30,11,231,252,93,47,7,193,135,182,137,139,
+26,151,137,153,127,137,126,11,236,61,214,47,47,61,62,44,47,211,61,237,231,
+217,211,237,30,11,241,252,197,37,7,194,133,201,135,139,26,163,137,160,134,
+133,115,11,244,252,250,34,7,194,135,199,135,139,26,171,137,150,133,135,114,
+11,247,64,194,247,103,247,23,247,97,26,11,247,96,247,19,27,201,149,88,92,
+31,11,92,56,27,38,74,217,247,25,163,31,11,247,152,247,17,190,219,53,251,92,
+30,11,139,78,137,83,132,30,37,250,154,7,11,188,110,198,51,84,110,125,88,94,
+30,11,28,4,246,21,243,11,5,38,119,225,251,9,247,92,27,247,75,247,54,203,247,
+27,11,7,251,87,251,117,57,74,51,27,251,7,100,243,247,34,161,11,21,248,7,28,
+7,155,5,251,47,6,252,7,28,248,101,5,11,26,247,91,251,77,225,251,148,251,79,
+251,10,97,100,36,30,11,26,251,48,247,58,53,247,72,247,148,247,105,247,15,
+247,152,11,49,250,2,5,251,138,6,252,48,253,240,80,249,103,5,164,11,28,5,55,
+249,205,21,247,169,251,41,247,197,252,99,251,85,11,117,116,141,123,27,247,
+17,249,2,5,143,165,180,144,160,27,11,247,189,141,247,50,247,88,247,95,26,
+188,128,186,127,170,30,11,251,78,251,113,78,251,69,78,196,96,186,221,180,
+180,149,149,11,247,0,7,133,116,251,27,77,116,27,90,139,183,188,149,31,11,
+247,4,7,117,73,251,19,90,76,27,75,108,182,202,154,31,11,246,248,197,5,251,
+29,6,251,230,74,5,67,7,247,62,121,11,189,28,4,216,21,253,34,226,248,203,248,
+80,226,7,14,248,219,251,196,21,226,252,80,248,203,52,253,34,7,14,251,164,
+6,251,52,253,137,5,71,65,59,84,47,27,88,11,5,143,178,178,141,174,27,247,35,
+247,19,94,251,60,31,11,31,240,7,248,104,29,11,61,247,13,24,251,45,116,43,
+75,59,233,96,234,247,72,11,247,136,186,247,6,227,247,77,27,160,179,134,135,
+164,31,11,118,113,135,135,100,31,43,248,193,235,7,53,147,98,146,11,251,42,
+104,5,139,82,59,78,73,35,217,139,30,32,112,11,165,141,130,109,31,136,251,
+38,5,245,6,201,247,195,5,11,178,247,12,27,247,37,6,152,208,248,170,29,251,
+69,11,192,61,223,251,43,251,224,251,11,251,243,251,96,102,30,11,251,109,242,
+252,3,248,158,247,66,247,87,192,172,247,6,11,247,11,7,248,101,29,11,8,87,
+119,92,111,91,27,112,104,174,155,120,31,14,5,251,0,117,247,31,118,229,27,
+11,76,120,90,31,76,7,247,94,114,11,248,109,247,230,247,175,247,143,203,11,
+132,30,37,248,255,241,7,81,146,11,198,90,225,32,37,36,78,63,66,11,249,201,
+21,251,246,253,93,102,151,11,6,251,111,98,5,98,7,11,139,78,134,79,135,30,
+37,11,145,166,152,149,157,141,25,11,28,6,12,21,200,11,5,227,225,247,1,219,
+202,27,182,166,106,39,118,31,11,6,168,147,127,106,137,31,135,251,66,5,247,
+39,6,11,7,251,8,247,77,44,81,248,44,253,15,5,225,6,11,21,251,42,6,28,251,
+95,28,250,113,5,247,41,6,11,37,6,194,133,200,135,139,26,164,137,157,134,135,
+115,11,66,251,48,87,121,52,24,247,101,199,247,47,247,1,11,134,112,132,125,
+100,135,8,139,78,134,81,135,30,37,11,135,113,116,133,111,137,25,139,79,134,
+86,135,30,37,11,251,54,251,45,251,39,251,54,251,15,231,55,247,13,11,145,163,
+154,146,157,141,25,139,205,143,206,145,30,241,11,209,7,98,57,123,135,125,
+27,112,121,157,184,151,31,11,231,252,95,47,7,231,133,162,137,147,125,135,
+118,25,11,251,148,21,123,114,90,104,112,27,90,102,167,191,237,11,243,252,
+230,35,7,233,129,162,134,157,125,133,112,25,11,254,74,21,28,13,122,251,142,
+28,242,134,7,14,30,247,236,182,7,247,23,211,84,251,4,31,14,247,41,6,247,195,
+201,247,97,247,3,247,0,27,11,5,161,140,247,4,189,233,27,231,215,86,251,6,
+11,5,251,33,6,251,232,71,5,68,7,247,64,120,11,6,251,34,251,173,247,1,83,247,
+62,247,229,5,11,247,60,251,29,244,251,150,119,112,135,133,110,30,11,247,64,
+247,38,251,7,251,197,79,31,247,42,6,11,55,5,248,126,29,11,247,99,247,13,213,
+247,76,247,17,31,229,247,27,11,98,245,5,123,114,90,104,112,27,90,102,167,
+191,11,251,33,77,31,247,3,6,194,155,186,182,184,27,11,132,30,37,248,255,241,
+7,79,146,78,143,139,26,11,159,166,130,121,137,31,129,251,111,5,247,51,6,11,
+247,244,247,252,248,124,31,251,199,157,21,252,27,11,251,144,251,13,251,181,
+251,35,92,54,219,247,103,11,243,251,78,251,199,251,34,251,191,251,162,251,
+76,11,6,247,238,205,5,210,7,251,72,158,5,14,248,114,29,14,5,139,247,52,138,
+140,26,140,11,247,75,251,14,247,43,252,24,11,247,91,247,76,247,23,217,219,
+11,247,183,251,95,247,154,252,31,11,248,142,29,8,11,6,98,251,95,5,11,247,
+41,38,247,11,251,240,30,252,254,37,6,11,5,133,110,137,112,113,26,32,215,61,
+247,50,11,5,49,6,251,117,100,5,94,7,247,8,128,11,247,50,27,248,179,247,215,
+248,72,248,58,31,11,21,247,45,168,251,13,206,251,28,27,251,15,11,27,125,112,
+145,180,147,31,211,247,236,5,243,11,27,51,88,76,55,251,52,247,99,108,247,
+13,11,31,251,196,81,251,39,251,2,251,71,27,107,11,251,201,247,208,248,17,
+248,31,247,207,247,201,11,77,49,92,139,117,27,91,123,209,221,102,31,11,251,
+7,251,197,80,31,247,41,6,242,248,160,11,104,78,89,116,80,27,116,101,162,207,
+153,31,11,116,94,51,100,82,27,122,111,156,206,151,31,11,133,30,43,248,177,
+235,7,251,3,149,119,142,11,250,87,247,117,21,44,197,251,8,251,77,5,11,28,
+6,82,22,247,5,28,251,92,251,5,7,11,175,137,189,135,139,26,180,135,153,127,
+133,112,11,249,220,247,142,21,44,176,251,62,252,58,5,11,21,248,143,29,11,
+135,111,127,129,94,134,11,251,105,254,210,24,135,11,247,40,27,248,105,247,
+41,248,54,247,136,11,21,252,173,6,96,251,109,5,248,173,6,11,21,247,69,203,
+205,247,17,163,31,247,17,11,249,1,21,247,158,251,44,247,29,251,144,11,26,
+251,9,236,49,247,107,247,133,247,48,11,27,247,243,247,73,247,92,247,93,181,
+31,11,35,7,242,129,163,136,156,123,134,112,25,11,43,49,187,247,6,164,143,
+186,151,192,31,11,69,88,96,30,73,170,39,180,225,26,217,11,251,5,251,33,75,
+31,247,3,6,194,157,11,120,251,124,24,247,66,6,215,248,9,5,11,125,21,251,81,
+251,33,251,29,251,95,131,11,126,208,27,247,142,247,185,247,60,248,7,11,139,
+247,107,247,37,184,223,94,154,163,26,11,146,166,141,25,139,203,143,202,145,
+30,241,11,203,25,194,251,3,5,247,32,194,186,234,11,247,7,7,73,251,16,112,
+131,118,27,96,11,247,11,30,102,247,66,5,149,113,108,145,11,247,15,247,152,
+30,251,173,141,21,251,47,11,247,27,247,9,8,151,156,151,157,196,27,11,243,
+7,37,247,175,29,11,243,7,47,150,117,141,120,155,143,166,25,11,247,107,31,
+139,169,141,174,137,30,14,27,213,196,152,165,201,31,11,133,112,114,123,117,
+137,25,11,142,25,247,19,149,5,243,11,143,158,172,204,153,180,25,11,145,166,
+164,155,163,142,25,11,146,147,151,154,168,141,25,11,176,223,237,247,46,172,
+170,11,241,252,254,37,7,11,5,251,232,6,247,62,247,1,248,13,11,5,251,33,6,
+251,228,71,5,68,7,11,6,251,228,71,5,68,7,247,64,122,11,7,247,35,247,103,247,
+35,251,103,5,11,21,161,245,5,252,95,6,117,33,5,11,27,247,179,247,37,247,95,
+245,160,31,11,27,247,31,235,247,4,247,36,201,31,11,248,36,216,251,100,247,
+164,252,103,27,11,247,76,205,247,32,247,0,247,91,26,11,49,251,74,79,147,96,
+170,152,202,25,11,63,223,251,89,251,127,251,9,251,21,11,82,214,5,61,100,251,
+44,54,251,116,11,92,109,102,110,88,26,71,221,88,235,11,96,5,94,7,184,137,
+186,139,139,26,11,108,182,202,154,31,247,21,249,13,5,11,251,25,251,4,247,
+25,251,5,5,213,11,125,133,112,25,251,99,254,172,5,112,11,135,112,114,123,
+114,137,25,251,10,128,11,251,51,251,167,65,251,92,53,227,124,11,155,145,166,
+25,247,101,250,178,143,166,11,172,41,30,252,91,71,6,211,131,5,11,247,250,
+21,247,60,251,29,244,251,150,11,247,19,109,241,91,211,30,247,42,145,11,247,
+23,195,100,235,51,71,63,81,119,11,5,190,6,229,200,112,55,31,14,31,186,247,
+105,5,248,23,6,14,5,251,25,6,11,123,114,90,104,112,27,90,102,167,191,237,
+238,11,250,65,21,248,13,29,11,248,174,21,248,13,29,11,248,187,21,248,13,29,
+11,5,251,97,6,35,251,103,251,66,70,5,55,7,247,39,155,11,35,243,7,248,74,29,
+11,129,162,136,157,123,133,112,25,251,99,254,178,133,112,115,123,11,247,105,
+247,5,238,247,19,251,13,24,247,227,29,14,248,16,29,143,11,86,139,30,178,248,
+75,29,152,164,11,44,147,92,143,139,26,117,126,153,158,143,31,201,247,195,
+5,131,166,177,130,189,27,11,35,6,247,15,243,29,11,5,148,112,98,155,88,27,
+252,50,251,98,252,1,251,205,251,68,237,251,87,247,129,227,236,11,150,116,
+141,121,155,145,166,25,247,99,250,178,247,106,29,11,21,150,29,11,243,252,
+240,35,7,241,243,29,11,5,251,97,6,35,251,103,247,55,29,11,247,55,29,32,215,
+61,247,50,247,21,11,248,183,29,182,195,212,31,11,250,144,250,87,21,247,209,
+29,251,83,251,56,11,248,84,248,138,248,141,29,247,19,149,5,247,131,29,11,
+242,29,248,189,6,11,5,247,93,29,84,176,227,81,247,200,29,11,196,205,92,247,
+119,29,11,115,116,26,45,219,77,247,27,245,247,15,172,190,238,30,244,29,247,
+59,11,5,247,74,29,11,133,110,137,8,248,192,29,11,24,248,189,6,39,252,148,
+135,115,123,133,114,137,25,139,75,135,76,132,30,37,249,1,241,7,79,146,78,
+143,139,26,112,141,127,145,143,161,11,248,194,29,251,87,251,72,251,68,251,
+36,123,11,26,251,53,247,17,42,247,97,247,113,247,21,238,247,25,247,9,247,
+155,29,11,247,106,29,252,240,35,7,241,243,29,251,11,128,5,35,11,21,247,26,
+29,11,21,251,62,6,251,107,251,85,251,34,247,85,5,251,62,6,247,50,251,243,
+5,247,134,6,224,248,245,47,29,178,163,176,180,170,184,188,213,174,247,1,196,
+204,247,19,45,24,215,192,172,194,185,26,200,71,184,57,55,98,116,105,96,30,
+41,57,114,42,92,56,92,50,80,78,51,125,11,21,253,76,6,106,251,57,5,249,78,
+6,233,248,145,62,29,14,208,173,219,211,192,221,217,247,7,176,247,33,241,241,
+247,95,251,17,24,229,203,190,157,236,26,235,29,11,71,29,231,248,36,21,251,
+172,247,202,5,190,92,112,247,212,29,21,248,47,29,30,247,114,29,251,72,253,
+246,5,247,164,6,247,7,248,177,247,184,29,21,247,165,29,254,75,28,251,133,
+247,135,29,250,78,28,4,121,5,14,66,29,167,247,205,80,29,173,29,248,66,243,
+7,247,54,29,11,5,247,253,29,5,90,163,203,104,188,27,247,15,217,215,247,56,
+247,4,31,74,227,5,247,109,29,11,62,29,247,191,247,81,21,251,172,247,202,5,
+190,92,112,247,212,29,21,33,6,35,96,49,75,251,5,27,33,67,197,247,2,137,31,
+32,6,133,111,135,110,110,26,251,54,244,53,247,51,247,95,247,37,247,32,247,
+86,176,30,147,247,225,34,29,123,6,227,248,81,145,165,152,146,159,141,25,139,
+196,141,195,145,30,241,252,216,37,7,192,133,195,137,139,26,159,137,151,132,
+133,115,251,107,254,210,24,113,135,125,131,118,27,139,63,134,86,135,30,37,
+248,236,241,7,90,143,82,144,139,26,116,141,125,143,143,165,229,248,89,24,
+186,6,247,138,252,105,11,248,212,29,188,213,174,247,1,196,204,247,19,45,24,
+215,192,172,194,185,26,11,71,29,235,249,100,21,209,88,190,49,44,49,69,104,
+113,139,106,182,164,163,151,139,30,178,217,5,151,152,153,143,153,27,172,164,
+94,78,126,31,125,71,80,107,73,122,108,251,52,24,203,6,163,247,11,5,232,174,
+237,192,247,5,26,14,66,29,171,247,179,62,29,14,21,33,6,35,96,49,75,251,5,
+27,33,67,197,247,2,137,31,32,6,133,111,135,110,110,26,251,54,244,53,247,51,
+247,95,247,37,247,32,247,86,176,30,207,248,26,66,29,14,247,9,248,187,5,247,
+54,174,251,1,245,251,37,27,32,251,31,80,59,33,31,164,29,251,4,252,181,5,39,
+118,242,87,247,16,27,11,2,0,1,0,227,0,237,0,1,1,10,0,2,1,44,0,0,1,58,0,0,
+1,64,0,5,1,135,7,61,0,0,8,48,3,0,0,1,0,0,27,0,0,30,0,0,36,0,0,79,0,0,190,
+0,1,117,0,1,212,0,2,141,0,2,146,0,2,198,0,2,253,0,3,88,0,3,120,0,3,129,0,
+3,133,0,3,138,0,3,157,0,3,231,0,4,30,0,4,135,0,5,18,0,5,58,0,5,152,0,6,0,
+0,6,43,0,6,187,0,7,33,0,7,42,0,7,58,0,7,90,0,7,109,0,7,142,0,7,222,0,8,147,
+0,8,152,0,8,157,0,8,162,0,8,167,0,8,172,0,8,176,0,8,181,0,8,186,0,8,191,0,
+8,194,0,8,199,0,8,203,0,8,208,0,8,213,0,8,218,0,8,223,0,8,227,0,8,232,0,8,
+236,0,8,241,0,8,246,0,8,251,0,9,0,0,9,5,0,9,10,0,9,15,0,9,52,0,9,74,0,9,109,
+0,9,117,0,9,133,0,9,138,0,9,142,0,9,146,0,9,150,0,9,154,0,9,158,0,9,163,0,
+9,167,0,9,171,0,9,181,0,9,190,0,9,194,0,9,199,0,9,204,0,9,208,0,9,212,0,9,
+216,0,9,219,0,9,224,0,9,229,0,9,234,0,9,238,0,9,242,0,9,247,0,9,251,0,9,255,
+0,10,3,0,10,123,0,10,131,0,10,251,0,11,71,0,11,116,0,11,250,0,12,86,0,12,
+105,0,12,227,0,12,232,0,13,153,0,14,35,0,14,51,0,14,80,0,14,115,0,14,123,
+0,14,131,0,14,211,0,15,36,0,15,51,0,15,122,0,15,249,0,15,253,0,16,38,0,16,
+71,0,16,81,0,16,103,0,16,106,0,16,141,0,16,179,0,17,78,0,17,164,0,17,172,
+0,17,181,0,17,189,0,17,198,0,17,207,0,17,216,0,17,225,0,17,234,0,17,243,0,
+17,251,0,18,4,0,18,12,0,18,21,0,18,40,0,18,45,0,18,74,0,18,116,0,18,121,0,
+19,32,0,19,62,0,19,67,0,19,72,0,19,116,0,19,120,0,20,28,0,20,215,0,20,252,
+0,21,16,0,21,135,0,22,8,0,22,12,0,22,113,0,22,152,0,22,249,0,23,52,0,23,107,
+0,23,131,0,23,184,0,23,210,0,23,244,0,24,58,0,24,157,0,24,168,0,24,235,0,
+25,27,0,25,147,0,25,227,0,25,237,0,25,247,0,26,1,0,26,11,0,26,21,0,26,31,
+0,26,42,0,26,51,0,26,60,0,26,69,0,26,79,0,26,89,0,26,99,0,26,109,0,26,118,
+0,26,128,0,26,138,0,26,147,0,26,157,0,26,166,0,26,176,0,26,185,0,26,195,0,
+26,205,0,26,215,0,26,225,0,26,235,0,26,245,0,26,254,0,27,7,0,27,16,0,27,25,
+0,27,34,0,27,43,0,27,52,0,27,61,0,27,70,0,27,79,0,27,88,0,27,97,0,27,108,
+0,27,118,0,27,129,0,27,138,0,27,147,0,27,156,0,27,165,0,27,174,0,27,183,0,
+27,192,0,27,202,0,27,211,0,27,219,0,27,228,0,27,237,0,27,245,0,27,253,0,28,
+7,0,28,21,0,28,26,0,28,113,0,28,255,0,29,129,0,30,60,0,30,77,0,30,204,0,30,
+244,0,31,20,0,31,121,0,31,245,0,32,3,0,32,70,0,32,206,0,32,246,0,33,30,0,
+33,143,0,33,146,0,33,150,0,34,7,0,34,108,0,34,112,0,34,156,0,34,206,0,34,
+211,0,34,214,0,35,3,0,36,162,0,36,166,0,36,174,0,36,182,0,36,188,0,36,197,
+0,36,207,0,36,222,0,36,232,0,36,247,0,37,1,0,37,10,0,37,19,0,37,35,0,37,45,
+0,37,55,0,37,65,0,37,75,0,37,84,0,37,93,0,37,102,0,37,111,0,37,126,0,37,135,
+0,37,150,0,37,160,0,37,169,0,37,178,0,37,187,0,37,196,0,37,206,0,37,209,0,
+38,63,0,38,121,0,38,184,0,39,2,0,39,61,0,39,150,0,39,229,0,39,232,0,39,236,
+0,39,240,0,39,248,0,39,251,0,40,121,0,40,124,0,40,128,0,40,133,0,40,143,0,
+40,153,0,41,58,0,41,205,0,42,76,0,42,81,0,42,173,0,42,223,0,42,233,0,42,249,
+0,43,4,0,43,20,0,43,31,0,43,48,0,43,58,0,43,68,0,43,79,0,43,90,0,43,101,0,
+43,112,0,43,129,0,43,139,0,43,149,0,43,159,0,43,169,0,43,180,0,43,190,0,43,
+207,0,43,218,0,43,228,0,43,238,0,43,248,0,44,3,0,44,18,0,44,108,0,44,203,
+0,45,25,0,45,98,0,45,135,0,45,197,0,45,245,0,46,137,0,46,252,0,47,109,0,47,
+114,0,48,21,0,48,90,0,48,101,0,48,111,0,48,197,0,48,207,0,48,215,0,48,224,
+0,48,245,0,49,36,0,49,51,0,49,126,0,49,198,0,49,220,0,50,6,0,50,125,0,50,
+134,0,50,186,0,51,38,0,51,145,0,51,150,0,51,160,0,52,8,0,52,13,0,52,148,0,
+52,216,0,52,226,0,52,235,0,52,245,0,53,36,0,53,170,0,53,248,0,54,110,0,55,
+21,0,55,66,0,55,100,0,55,168,0,55,217,0,56,36,0,56,152,0,57,56,0,57,61,0,
+57,72,0,57,229,0,57,237,0,57,245,0,58,137,0,58,141,0,58,145,0,58,154,0,58,
+160,0,58,168,0,58,176,0,58,185,0,58,193,0,58,208,0,58,220,0,58,240,0,59,51,
+0,59,60,0,59,162,0,60,27,0,60,149,0,61,7,0,61,14,0,61,79,0,61,107,0,61,161,
+0,61,165,0,61,174,0,61,250,0,62,102,0,62,106,0,62,114,0,62,119,0,62,124,0,
+62,220,0,62,229,0,62,238,0,62,247,0,63,1,0,63,19,0,63,33,0,63,121,0,63,133,
+0,63,187,0,64,72,0,65,0,0,65,126,0,66,1,0,66,40,0,66,156,0,67,12,0,67,17,
+0,67,117,0,67,184,0,67,194,0,68,56,0,68,61,0,68,70,0,68,74,0,68,78,0,68,87,
+0,68,93,0,68,102,0,68,111,0,68,120,0,68,129,0,68,138,0,68,148,0,68,218,0,
+68,222,0,68,241,0,69,73,0,69,111,0,69,169,0,69,210,0,70,2,0,70,120,0,70,167,
+0,70,203,0,70,215,0,70,233,0,71,58,0,71,183,0,72,66,0,72,111,0,72,114,0,72,
+117,0,72,230,0,73,83,0,73,88,0,73,184,0,73,211,0,73,221,0,73,230,0,73,241,
+0,73,251,0,74,6,0,74,16,0,74,20,0,74,24,0,74,70,0,74,151,0,75,17,0,75,29,
+0,75,47,0,75,60,0,75,73,0,75,134,0,75,233,0,75,238,0,76,44,0,76,110,0,77,
+14,0,77,74,0,78,10,0,79,7,0,79,11,0,79,99,0,79,108,0,79,114,0,79,123,0,79,
+132,0,79,147,0,79,157,0,79,172,0,79,182,0,79,199,0,79,208,0,79,217,0,79,226,
+0,79,235,0,79,244,0,79,253,0,80,7,0,80,17,0,80,26,0,80,35,0,80,44,0,80,53,
+0,80,61,0,80,71,0,80,128,0,80,136,0,80,152,0,80,178,0,80,201,0,80,211,0,80,
+220,0,81,11,0,81,14,0,81,17,0,81,20,0,81,109,0,81,200,0,81,209,0,82,35,0,
+82,197,0,83,52,0,83,60,0,83,161,0,83,185,0,83,193,0,84,33,0,84,62,0,84,153,
+0,85,9,0,85,101,0,85,202,0,86,46,0,86,186,0,86,190,0,86,198,0,86,247,0,87,
+51,0,87,111,0,87,116,0,87,218,0,87,254,0,88,8,0,88,17,0,88,32,0,88,42,0,88,
+57,0,88,67,0,88,85,0,88,94,0,88,103,0,88,112,0,88,121,0,88,130,0,88,139,0,
+88,149,0,88,159,0,88,168,0,88,178,0,88,188,0,88,199,0,88,210,0,88,221,0,88,
+232,0,88,250,0,89,5,0,89,18,0,89,135,0,89,144,0,89,181,0,90,39,0,90,71,0,
+90,158,0,91,15,0,91,124,0,91,129,0,91,140,0,92,24,0,92,155,0,93,49,0,93,53,
+0,93,61,0,93,107,0,93,161,0,93,223,0,94,66,0,94,76,0,94,102,0,94,112,0,94,
+184,0,94,207,0,94,212,0,94,222,0,95,50,0,95,127,0,95,132,0,95,141,0,95,191,
+0,95,239,0,95,255,0,96,30,0,96,117,0,96,126,0,96,209,0,96,255,0,97,50,0,97,
+148,0,97,152,0,97,214,0,98,26,0,98,34,0,98,83,0,98,124,0,98,140,0,98,165,
+0,99,55,0,99,65,0,99,75,0,99,85,0,99,95,0,99,105,0,99,114,0,99,125,0,100,
+24,0,100,144,0,100,153,0,101,12,0,101,26,0,101,74,0,101,236,0,102,32,0,102,
+84,0,102,175,0,103,31,0,103,52,0,103,62,0,103,71,0,103,81,0,103,91,0,103,
+101,0,103,112,0,103,122,0,103,197,0,104,20,0,104,107,0,104,163,0,105,48,0,
+105,214,0,106,9,0,106,59,0,106,172,0,107,4,0,107,12,0,107,18,0,107,28,0,107,
+37,0,107,46,0,107,56,0,107,65,0,107,74,0,107,83,0,107,92,0,107,133,0,107,
+136,0,107,139,0,107,244,0,108,23,0,108,83,0,108,146,0,108,197,0,108,200,0,
+109,22,0,109,43,0,109,144,0,109,236,0,110,0,0,110,52,0,110,56,0,110,157,0,
+110,160,0,110,172,0,110,214,0,110,253,0,111,20,0,111,107,0,111,142,0,111,
+182,0,111,226,0,112,16,0,112,20,0,112,78,0,112,111,0,112,142,0,112,146,0,
+112,150,0,112,195,0,112,241,0,112,246,0,112,249,0,112,252,0,113,80,0,113,
+90,0,113,100,0,113,110,0,113,120,0,113,131,0,113,142,0,113,153,0,113,233,
+0,114,56,0,114,105,0,114,160,0,114,164,0,114,191,0,114,231,0,115,152,0,115,
+203,0,115,207,0,115,219,0,116,21,0,116,35,0,116,70,0,116,74,0,116,105,0,116,
+223,0,117,13,0,117,35,0,117,77,0,117,97,0,117,119,0,117,186,0,117,227,0,118,
+3,0,118,34,0,118,68,0,118,72,0,118,82,0,118,92,0,118,166,0,118,175,0,118,
+182,0,118,192,0,118,203,0,118,214,0,118,225,0,118,236,0,118,247,0,119,2,0,
+119,19,0,119,29,0,119,43,0,119,58,0,119,73,0,119,98,0,119,150,0,119,227,0,
+120,54,0,120,127,0,120,143,0,120,160,0,120,184,0,120,199,0,120,216,0,120,
+248,0,121,48,0,121,97,0,121,234,0,121,239,0,121,244,0,122,53,0,122,58,0,122,
+114,0,122,135,0,122,205,0,122,215,0,122,225,0,122,235,0,122,245,0,122,255,
+0,123,10,0,123,20,0,123,36,0,123,45,0,123,54,0,123,64,0,123,75,0,123,86,0,
+123,142,0,123,196,0,124,26,0,124,58,0,124,68,0,124,78,0,124,93,0,124,104,
+0,124,115,0,124,194,0,125,72,0,125,149,0,125,158,0,125,166,0,125,175,0,125,
+185,0,125,196,0,125,211,0,126,24,0,126,145,0,126,150,0,126,158,0,126,233,
+0,127,82,0,127,179,0,127,192,0,127,234,0,128,3,0,128,134,0,128,154,0,128,
+173,0,128,224,0,128,246,0,129,43,0,129,119,0,129,122,0,129,197,0,130,16,0,
+130,25,0,130,78,0,130,135,0,130,238,0,131,3,0,131,100,0,131,154,0,131,178,
+0,132,63,0,132,112,0,132,162,0,132,204,0,132,237,0,133,14,0,133,118,0,133,
+217,0,134,60,0,134,69,0,134,78,0,134,87,0,134,96,0,134,105,0,134,156,0,134,
+209,0,135,8,0,135,46,0,135,121,0,135,197,0,135,228,0,136,75,0,136,78,0,136,
+81,0,136,89,0,136,170,0,136,209,0,136,249,0,137,131,0,137,210,0,138,35,0,
+138,40,0,138,50,0,138,60,0,138,106,0,138,251,0,139,141,0,139,150,0,139,159,
+0,139,170,0,139,181,0,139,192,0,139,215,0,140,7,0,140,61,0,140,112,0,140,
+185,0,140,237,0,141,126,0,142,38,0,142,43,0,142,53,0,142,76,0,142,118,0,142,
+165,0,143,43,0,143,140,0,143,220,0,143,225,0,143,235,0,143,245,0,144,5,0,
+144,10,0,144,29,0,144,81,0,144,92,0,144,102,0,144,113,0,144,123,0,144,140,
+0,144,150,0,144,160,0,144,171,0,144,213,0,145,2,0,145,49,0,145,92,0,145,154,
+0,145,242,0,146,18,0,146,79,0,146,172,0,146,250,0,147,44,0,147,88,0,147,151,
+0,147,185,0,147,196,0,148,14,0,148,60,0,148,151,0,149,20,0,149,89,0,149,213,
+0,150,72,0,150,205,0,151,64,0,151,68,0,151,147,0,151,180,0,152,5,0,152,14,
+0,152,23,0,152,32,0,152,41,0,152,57,0,152,66,0,152,76,0,152,86,0,152,122,
+0,152,176,0,152,234,0,153,104,0,153,160,0,154,39,0,154,75,0,154,154,0,154,
+165,0,154,175,0,155,17,0,155,22,0,155,132,0,155,140,0,155,147,0,155,158,0,
+155,169,0,155,179,0,155,222,0,156,53,0,156,234,0,157,5,0,157,78,0,157,140,
+0,157,162,0,158,30,0,158,53,0,158,178,0,159,87,0,159,114,0,159,153,0,159,
+158,0,159,163,0,160,41,0,160,176,0,160,186,0,160,196,0,160,207,0,161,25,0,
+161,29,0,161,177,0,162,41,0,162,166,0,162,179,0,163,105,0,163,183,0,163,226,
+0,163,236,0,163,245,0,163,254,0,164,8,0,164,17,0,164,26,0,164,35,0,164,44,
+0,164,104,0,164,184,0,165,4,0,165,33,0,165,88,0,165,192,0,165,207,0,166,41,
+0,166,104,0,166,166,0,167,10,0,167,60,0,167,114,0,167,125,0,167,129,0,167,
+138,0,167,147,0,167,181,0,167,190,0,167,199,0,168,51,0,168,140,0,168,247,
+0,169,1,0,169,11,0,169,21,0,169,31,0,169,42,0,169,53,0,169,64,0,169,75,0,
+170,27,0,170,138,0,170,209,0,170,244,0,171,75,0,171,183,0,172,9,0,172,82,
+0,172,91,0,172,102,0,173,39,0,173,44,0,173,54,0,173,64,0,173,106,0,173,116,
+0,173,126,0,173,130,0,173,193,0,173,202,0,173,208,0,173,217,0,173,226,0,173,
+241,0,173,251,0,174,10,0,174,20,0,174,30,0,174,39,0,174,48,0,174,57,0,174,
+67,0,174,77,0,174,87,0,174,96,0,174,106,0,174,116,0,174,125,0,174,135,0,174,
+143,0,174,158,0,174,167,0,174,176,0,174,225,0,174,255,0,175,124,0,175,127,
+0,175,130,0,175,199,0,175,208,0,176,49,0,176,147,0,176,238,0,177,113,0,177,
+122,0,178,24,0,178,114,0,178,171,0,178,176,0,178,186,0,178,196,0,178,206,
+0,178,216,0,178,226,0,179,23,0,179,185,0,180,0,0,180,133,0,181,13,0,181,175,
+0,182,50,0,182,142,0,183,28,0,183,83,0,183,135,0,183,189,0,183,240,0,183,
+245,0,184,60,0,184,134,0,184,144,0,184,154,0,184,169,0,184,179,0,184,194,
+0,184,204,0,184,222,0,184,231,0,184,241,0,184,251,0,185,6,0,185,17,0,185,
+28,0,185,38,0,185,49,0,185,60,0,185,70,0,185,81,0,185,90,0,185,106,0,185,
+115,0,185,126,0,185,137,0,185,154,0,185,158,0,185,162,0,185,172,0,186,41,
+0,186,118,0,186,250,0,187,4,0,187,108,0,187,222,0,188,75,0,188,85,0,188,95,
+0,188,104,0,188,114,0,188,125,0,189,40,0,189,198,0,190,77,0,190,168,0,191,
+56,0,191,172,0,192,37,0,192,41,0,192,168,0,193,14,0,193,18,0,193,137,0,194,
+2,0,194,11,0,194,19,0,194,41,0,194,144,0,194,176,0,195,10,0,195,23,0,195,
+95,0,195,144,0,195,177,0,196,99,0,196,188,0,197,17,0,197,119,0,197,212,0,
+198,36,0,198,204,0,199,106,0,200,38,0,200,162,0,200,169,0,200,178,0,201,32,
+0,201,37,0,201,151,0,201,154,0,201,157,0,201,167,0,201,176,0,201,254,0,202,
+60,0,202,136,0,202,225,0,203,134,0,203,212,0,204,90,0,204,147,0,205,22,0,
+205,170,0,206,80,0,206,138,0,206,195,0,207,18,0,207,122,0,208,18,0,208,21,
+0,208,73,0,208,143,0,208,220,0,209,33,0,209,156,0,209,212,0,209,216,0,210,
+89,0,210,148,0,210,223,0,211,24,0,211,80,0,211,89,0,211,95,0,211,104,0,211,
+113,0,211,122,0,211,131,0,211,141,0,211,152,0,211,163,0,211,181,0,211,192,
+0,211,212,0,212,8,0,212,22,0,212,76,0,212,120,0,212,139,0,212,226,0,213,93,
+0,213,173,0,213,186,0,213,210,0,213,229,0,214,0,0,214,77,0,214,136,0,214,
+163,0,214,227,0,214,235,0,214,248,0,215,77,0,215,136,0,215,154,0,216,51,0,
+216,89,0,216,99,0,216,109,0,216,119,0,216,129,0,216,138,0,216,148,0,216,159,
+0,216,177,0,216,188,0,216,216,0,217,73,0,217,132,0,217,246,0,218,114,0,218,
+191,0,218,203,0,218,228,0,219,142,0,220,63,0,220,163,0,221,27,0,221,179,0,
+222,61,0,222,192,0,223,4,0,223,116,0,224,4,0,224,73,0,224,183,0,225,40,0,
+225,45,0,225,80,0,225,176,0,225,185,0,225,200,0,225,209,0,225,220,0,225,229,
+0,225,240,0,226,2,0,226,12,0,226,22,0,226,109,0,226,174,0,226,239,0,226,248,
+0,227,61,0,227,196,0,228,58,0,228,67,0,228,142,0,229,0,0,229,12,0,229,106,
+0,230,51,0,230,55,0,230,167,0,230,175,0,230,189,0,230,197,0,230,207,0,230,
+216,0,230,226,0,230,243,0,230,253,0,231,7,0,231,92,0,231,133,0,231,205,0,
+232,65,0,233,18,0,233,70,0,233,79,0,233,85,0,233,95,0,233,105,0,233,115,0,
+233,125,0,233,136,0,233,145,0,233,155,0,233,164,0,233,214,0,234,46,0,234,
+96,0,234,232,0,235,60,0,235,115,0,235,185,0,236,28,0,236,75,0,236,96,0,236,
+252,0,237,110,0,237,193,0,237,237,0,238,34,0,238,109,0,238,114,0,238,165,
+0,238,200,0,238,209,0,238,214,0,239,43,0,239,122,0,239,131,0,239,174,0,239,
+184,0,239,195,0,239,206,0,239,217,0,239,228,0,239,239,0,240,43,0,240,118,
+0,240,131,0,240,172,0,240,225,0,241,35,0,241,116,0,241,199,0,241,239,0,242,
+20,0,242,102,0,242,234,0,243,107,0,243,189,0,243,197,0,243,203,0,243,213,
+0,243,221,0,243,230,0,243,239,0,243,248,0,244,1,0,244,11,0,244,20,0,244,30,
+0,244,45,0,244,55,0,244,65,0,244,75,0,244,84,0,244,94,0,244,103,0,244,112,
+0,244,121,0,244,130,0,244,139,0,244,163,0,244,251,0,245,77,0,245,82,0,245,
+92,0,245,101,0,245,111,0,245,121,0,245,132,0,245,214,0,245,221,0,246,65,0,
+246,116,0,246,204,0,247,27,0,247,113,0,247,191,0,248,10,0,248,131,0,248,247,
+0,249,34,0,249,138,0,249,148,0,249,158,0,249,168,0,249,178,0,249,188,0,249,
+198,0,249,209,0,249,219,0,249,230,0,249,246,0,250,1,0,250,12,0,250,23,0,250,
+33,0,250,43,0,250,54,0,250,65,0,250,76,0,250,87,0,250,98,0,250,196,0,251,
+18,0,251,91,0,251,101,0,251,111,0,251,121,0,251,131,0,251,142,0,251,248,0,
+252,52,0,252,80,0,252,116,0,252,235,0,252,239,0,253,72,0,253,81,0,253,87,
+0,253,95,0,253,105,0,253,123,0,253,146,0,253,178,0,254,63,0,254,131,0,254,
+171,0,254,229,0,254,240,0,255,3,0,255,29,0,255,119,0,255,205,1,0,79,1,0,224,
+1,1,90,1,1,178,1,1,186,1,1,194,1,1,199,1,2,17,1,2,79,1,2,89,1,2,100,1,2,188,
+1,2,210,1,2,220,1,2,236,1,3,1,1,3,81,1,3,120,1,3,240,1,3,245,1,4,80,1,4,90,
+1,4,100,1,4,110,1,4,120,1,4,130,1,4,140,1,4,151,1,4,229,1,5,153,1,5,249,1,
+6,124,1,6,247,1,6,252,1,7,93,1,7,186,1,7,196,1,7,206,1,7,216,1,7,226,1,7,
+236,1,7,247,1,8,68,1,9,9,1,9,13,1,9,17,1,9,134,1,9,143,1,9,149,1,9,157,1,
+9,166,1,9,224,1,10,59,1,10,176,1,10,211,1,10,222,1,10,241,1,11,94,1,11,102,
+1,11,111,1,11,116,1,11,121,1,11,130,1,11,140,1,11,197,1,12,19,1,12,52,1,12,
+62,1,12,78,1,12,82,1,12,192,1,12,201,1,12,210,1,12,218,1,12,226,1,12,234,
+1,12,242,1,12,250,1,13,2,1,13,11,1,13,19,1,13,28,1,13,38,1,13,120,1,13,255,
+1,14,115,1,14,160,1,14,218,1,15,86,1,15,120,1,15,175,1,15,179,1,15,188,1,
+16,37,1,16,77,1,16,122,1,16,230,1,16,235,1,17,90,1,17,100,1,17,110,1,17,120,
+1,17,130,1,17,140,1,17,150,1,17,161,1,17,230,1,18,21,1,18,149,1,19,40,1,19,
+45,1,19,55,1,19,64,1,19,74,1,19,84,1,19,88,1,19,97,1,19,172,1,19,208,1,19,
+237,1,20,131,1,21,30,1,21,180,1,22,34,1,22,44,1,22,53,1,22,63,1,22,72,1,22,
+81,1,22,137,1,22,210,1,23,9,1,23,55,1,23,131,1,23,221,1,24,47,1,24,106,1,
+24,148,1,24,198,1,25,59,1,25,124,1,25,134,1,25,144,1,25,154,1,25,165,1,25,
+176,1,25,220,1,26,12,1,26,37,1,26,83,1,26,225,1,26,228,1,26,231,1,26,234,
+1,27,100,1,27,109,1,27,170,1,28,5,1,28,89,1,28,230,1,29,89,1,29,204,1,30,
+48,1,30,53,1,30,176,1,31,24,1,31,35,1,31,147,1,32,19,1,32,137,1,33,1,1,33,
+26,1,33,124,1,33,223,1,34,64,1,34,113,1,34,129,1,34,133,1,34,137,1,34,173,
+1,34,234,1,35,59,1,35,163,1,36,15,1,36,101,1,37,74,1,37,144,1,38,129,1,38,
+223,1,39,29,1,39,92,1,39,140,1,39,209,1,40,83,1,40,105,1,40,223,1,41,20,1,
+41,74,1,41,79,1,41,90,1,41,95,1,41,106,1,41,185,1,42,9,1,42,125,1,42,235,
+1,42,242,1,43,80,1,43,176,1,44,19,1,44,42,1,44,66,1,44,162,1,45,2,1,45,93,
+1,45,102,1,45,203,1,46,46,1,46,135,1,46,145,1,46,185,1,46,201,1,46,217,1,
+46,244,1,47,13,1,47,29,1,47,50,1,47,80,1,47,95,1,47,101,1,47,156,1,47,164,
+1,47,174,1,47,189,1,47,226,1,48,6,1,48,16,1,48,31,1,48,36,1,48,44,1,48,48,
+1,48,52,1,48,60,1,48,65,1,48,167,1,48,170,1,48,204,1,48,222,1,48,226,1,48,
+230,1,48,234,1,48,243,1,48,253,1,49,6,1,49,16,1,49,53,1,49,91,1,49,109,1,
+49,114,1,49,132,1,49,137,1,49,156,1,49,161,1,49,180,1,49,185,1,49,221,1,49,
+226,1,50,9,1,50,46,1,50,51,1,50,90,1,50,111,1,50,116,1,50,137,1,50,158,1,
+50,163,1,50,184,1,50,220,1,51,26,1,51,31,1,51,68,1,51,104,1,51,166,1,51,202,
+1,51,210,1,51,224,1,52,0,1,52,4,1,52,8,1,52,71,1,52,95,1,52,119,1,52,207,
+1,52,216,1,52,230,1,53,79,1,53,87,1,53,100,1,53,205,1,53,219,1,53,233,1,53,
+240,1,54,1,1,54,19,1,54,56,1,54,60,1,54,64,1,54,68,1,54,88,1,54,108,1,54,
+127,1,54,131,1,54,139,1,54,148,1,54,164,1,54,177,1,54,190,1,54,197,1,54,202,
+1,54,211,1,54,217,1,54,228,1,54,239,1,54,254,1,55,7,1,55,15,1,55,22,1,55,
+27,1,55,37,1,55,44,1,55,49,1,55,57,1,55,65,1,55,71,1,55,82,1,55,92,1,55,99,
+1,55,104,1,55,120,1,55,153,1,55,159,1,55,167,1,55,172,1,55,220,1,55,227,1,
+56,23,1,56,54,1,56,102,1,56,132,1,56,161,1,56,214,1,56,220,1,56,226,1,56,
+237,1,57,28,1,57,77,1,57,84,1,57,92,1,57,125,1,57,132,1,57,137,1,57,143,1,
+57,173,1,57,202,1,57,250,1,58,24,1,58,55,1,58,115,1,58,175,1,58,182,1,58,
+188,1,58,235,1,58,241,1,59,64,1,59,68,1,59,72,1,59,78,1,59,84,1,59,104,1,
+59,137,1,59,165,1,59,196,1,59,253,1,60,31,1,60,115,1,60,122,1,60,131,1,60,
+179,1,60,245,1,61,54,1,61,62,1,61,68,1,61,77,1,61,83,1,61,99,1,61,107,1,61,
+122,1,61,130,1,61,141,1,61,147,1,61,172,1,61,194,1,61,221,1,61,236,1,61,244,
+1,61,254,1,62,71,1,62,98,1,62,142,1,62,148,1,62,154,1,62,160,1,62,167,1,62,
+176,1,62,182,1,62,189,1,62,198,1,62,206,1,62,214,1,62,220,1,62,226,1,63,27,
+1,63,34,1,63,43,1,63,53,1,63,61,1,63,67,1,63,76,1,63,86,1,63,93,1,63,155,
+1,63,211,1,64,8,1,64,53,1,64,60,1,64,67,1,64,75,1,64,89,1,64,112,1,64,120,
+1,64,162,1,64,208,1,64,218,1,64,248,1,65,24,1,65,53,1,65,85,1,65,115,1,65,
+145,1,65,178,1,65,195,1,65,202,1,65,212,1,65,248,1,66,43,1,66,81,1,66,100,
+1,66,128,1,66,154,1,66,163,1,66,179,1,66,208,1,66,214,1,66,220,1,67,41,1,
+67,48,1,67,56,1,67,86,1,67,107,1,67,138,1,67,194,1,67,210,1,67,224,1,67,238,
+1,67,252,1,68,9,1,68,25,1,68,39,1,68,53,1,68,67,1,68,79,1,68,90,1,68,100,
+1,68,110,1,68,120,1,68,129,1,68,140,1,68,150,1,68,159,1,68,168,1,68,176,1,
+69,9,1,69,24,1,69,39,1,69,83,1,69,107,1,69,131,1,69,158,1,69,186,1,69,202,
+1,69,239,1,70,1,1,70,17,1,70,35,1,70,51,1,70,67,1,70,77,1,70,94,1,70,119,
+1,70,137,1,70,151,1,70,188,1,70,235,1,71,11,1,71,44,1,71,85,1,71,118,1,71,
+156,1,71,204,1,71,243,1,72,26,1,72,65,1,72,104,1,72,170,1,72,199,1,72,227,
+1,72,236,1,73,11,1,73,19,1,73,46,1,73,53,1,73,81,1,73,108,1,73,117,1,73,124,
+1,73,130,1,73,158,1,73,185,1,73,197,1,73,230,1,74,107,1,74,240,1,75,62,1,
+75,163,1,75,172,1,75,213,1,75,222,1,75,230,1,75,253,1,76,62,1,76,85,1,76,
+108,1,76,109,1,76,110,1,76,111,1,76,112,1,76,113,1,76,114,1,76,115,1,76,116,
+1,76,117,1,76,118,1,76,119,1,76,120,1,76,121,1,76,122,1,76,123,1,76,124,1,
+76,125,1,76,126,1,76,127,1,76,128,1,76,129,1,76,130,1,76,131,1,76,134,1,76,
+137,1,76,140,1,76,143,1,76,146,1,76,149,1,76,151,1,76,153,1,76,156,1,76,158,
+1,76,161,1,76,164,1,77,37,1,77,42,1,77,47,1,77,52,1,77,57,1,77,212,247,203,
+239,22,28,4,176,28,7,8,28,251,80,6,189,89,21,250,224,28,249,92,254,224,6,
+14,252,125,14,251,203,249,74,232,10,251,211,249,242,28,5,90,21,203,100,167,
+80,69,70,84,65,137,30,122,252,115,5,215,6,170,225,247,41,248,27,178,26,252,
+37,22,247,208,10,248,27,178,26,14,248,65,28,5,111,249,228,21,247,27,251,161,
+7,247,46,248,68,251,33,178,251,44,252,107,5,251,158,6,247,43,248,70,251,29,
+176,251,50,252,107,5,251,238,251,27,247,195,6,51,251,162,5,251,207,251,21,
+247,166,6,251,45,252,97,247,29,102,247,52,248,134,5,247,148,6,251,44,252,
+99,247,34,104,247,47,248,134,5,247,255,247,21,251,210,6,227,247,162,5,251,
+35,22,45,251,162,5,251,146,6,229,247,162,5,14,247,28,28,4,176,28,5,29,21,
+139,251,82,198,251,60,30,169,247,44,5,251,12,6,108,251,44,5,139,252,48,123,
+66,252,11,30,83,251,169,247,132,62,247,35,94,51,252,87,24,139,251,19,141,
+61,182,30,121,149,141,133,164,26,145,247,113,5,251,39,6,69,251,246,5,247,
+56,81,247,136,129,139,26,98,251,101,5,247,12,6,180,247,103,247,159,176,247,
+105,247,39,184,247,126,25,196,247,179,251,185,216,251,19,176,223,248,58,24,
+164,235,121,120,180,31,149,135,147,135,137,123,135,251,107,24,247,34,6,252,
+75,247,162,21,63,252,23,5,139,251,33,174,172,247,58,30,174,247,68,247,41,
+149,139,26,247,19,254,15,21,100,251,91,251,76,125,139,26,221,248,50,204,120,
+242,92,112,251,27,25,14,249,134,28,6,227,248,171,21,247,76,45,248,83,29,231,
+36,247,79,247,197,247,37,247,187,247,165,30,251,68,249,219,21,251,41,6,254,
+247,28,250,162,5,247,40,6,248,41,250,242,21,247,77,45,243,251,78,251,197,
+251,38,247,214,10,249,60,252,170,21,251,9,82,252,40,251,52,57,127,236,202,
+247,15,198,248,17,247,58,215,149,53,82,30,254,17,247,121,29,248,73,28,5,180,
+249,21,21,247,3,252,154,251,3,7,247,13,119,5,141,143,124,135,137,31,112,86,
+100,67,90,76,251,137,247,209,24,247,135,223,247,60,247,9,247,84,26,247,32,
+251,13,247,29,251,125,251,203,251,79,251,68,251,103,43,186,59,201,55,30,251,
+87,38,251,47,251,23,251,92,26,251,95,247,43,251,34,247,148,247,89,247,27,
+199,211,245,30,199,75,192,108,207,125,190,131,192,137,190,143,178,141,186,
+143,238,143,8,246,7,251,50,63,169,247,21,41,31,241,246,229,247,23,197,247,
+9,8,252,109,248,119,21,251,27,55,57,251,17,79,30,90,205,96,225,223,26,247,
+50,247,33,194,186,233,158,55,51,30,73,254,5,21,70,43,88,108,53,27,57,251,
+21,225,247,60,241,190,221,225,207,31,14,252,160,247,10,10,251,113,250,91,
+28,5,188,21,252,214,123,251,136,253,66,252,123,26,251,206,247,21,251,140,
+247,236,131,30,162,247,3,5,251,95,165,94,247,66,247,71,26,247,252,247,29,
+249,126,248,50,192,30,14,251,113,249,103,250,23,21,247,207,251,23,247,136,
+251,234,149,30,116,251,2,5,247,95,112,184,251,64,251,70,26,251,250,251,31,
+253,130,252,50,86,30,119,251,3,5,248,213,156,247,136,249,68,248,121,26,14,
+74,250,168,28,4,145,21,251,41,199,251,109,251,52,151,108,247,156,137,5,251,
+103,247,204,21,37,247,14,39,251,14,223,251,148,5,171,6,247,132,251,132,21,
+251,109,247,52,112,114,221,251,146,247,50,98,5,251,181,248,11,21,251,111,
+247,54,251,37,79,227,251,25,247,158,141,5,176,88,21,112,164,251,111,251,52,
+145,251,52,247,50,180,5,14,250,83,28,6,102,248,187,21,247,19,252,187,248,
+187,251,18,252,187,252,187,251,19,248,187,252,187,247,18,248,187,7,14,252,
+68,248,46,247,64,247,21,10,252,12,225,10,252,74,247,159,10,76,250,150,247,
+200,10,251,54,6,253,244,28,249,228,5,247,52,6,14,247,28,28,4,190,250,66,21,
+247,140,251,2,247,109,251,218,252,135,251,101,252,197,252,52,251,170,247,
+23,251,77,247,201,248,97,247,135,248,148,248,99,30,251,199,176,21,252,29,
+251,84,252,128,251,77,119,251,23,158,247,176,248,25,247,74,248,132,247,89,
+190,237,65,251,121,30,14,247,28,250,78,28,5,127,21,251,31,6,252,146,251,33,
+5,251,7,7,247,210,182,251,97,254,162,5,124,137,122,125,123,27,251,103,127,
+5,251,7,249,109,247,5,7,251,45,153,114,141,121,149,143,156,25,14,247,28,28,
+4,158,250,220,21,247,103,251,50,239,251,156,251,216,251,117,251,13,251,80,
+69,200,80,234,231,159,178,155,166,30,180,247,105,5,151,165,201,166,198,27,
+203,241,94,251,52,251,185,251,174,251,109,252,230,252,52,31,112,251,37,5,
+250,191,6,207,247,252,5,251,50,6,69,251,62,5,252,158,6,247,76,247,19,247,
+85,247,19,247,39,247,21,8,247,68,247,48,247,32,247,72,247,79,26,14,247,28,
+28,4,154,250,234,21,247,72,251,19,247,9,251,179,251,187,251,130,251,7,251,
+51,63,219,75,199,186,206,170,151,168,30,172,247,87,5,155,161,193,174,212,
+27,166,247,27,104,251,56,251,86,251,74,251,9,251,142,151,31,116,251,51,5,
+157,247,9,174,145,178,27,161,247,54,125,251,85,251,101,251,70,251,33,251,
+35,96,77,166,149,123,31,106,247,64,5,151,112,109,174,75,27,33,86,33,98,44,
+247,6,251,31,247,187,248,42,247,148,247,146,247,142,247,39,40,221,251,70,
+174,31,247,144,223,247,1,247,46,247,29,26,14,247,28,28,4,133,248,203,21,251,
+78,247,201,10,47,252,99,5,247,171,6,229,248,99,5,247,82,6,251,244,248,209,
+21,57,252,50,5,251,213,6,14,247,28,28,4,174,247,200,10,253,216,6,251,35,253,
+70,5,145,190,247,52,156,196,27,247,13,247,68,100,251,99,251,99,251,72,251,
+54,251,43,112,71,156,143,123,31,84,247,66,5,145,106,116,165,98,27,41,67,58,
+67,251,5,247,13,53,247,157,248,39,247,170,247,154,247,175,247,134,251,84,
+235,251,130,76,84,133,131,96,31,210,247,246,5,248,232,6,14,247,28,28,4,125,
+248,193,21,247,113,251,37,247,48,251,165,35,51,118,107,65,30,233,247,133,
+247,134,247,75,247,215,173,137,247,26,24,253,64,67,252,4,252,103,252,126,
+26,252,2,247,125,251,3,247,136,248,2,247,128,247,177,247,197,30,251,195,88,
+21,251,130,251,64,251,70,251,9,251,74,137,247,91,247,25,233,172,247,33,147,
+168,30,221,247,2,215,153,182,27,247,7,227,47,251,76,31,14,247,28,28,5,45,
+247,200,10,254,185,6,65,252,2,5,247,58,6,205,247,74,5,248,193,6,254,37,28,
+251,14,5,247,186,6,154,197,250,56,28,5,14,5,14,247,28,28,4,147,250,236,21,
+247,46,251,8,247,33,251,193,251,255,251,72,251,109,251,107,61,166,43,247,
+27,63,30,251,152,251,9,57,251,62,251,21,26,251,84,247,39,251,42,247,224,248,
+9,247,129,247,113,247,136,247,54,251,33,225,251,1,188,30,247,56,215,247,29,
+237,247,101,26,251,172,121,21,251,23,69,38,33,74,30,251,23,200,57,203,237,
+26,247,52,247,27,247,0,237,247,7,180,59,251,6,30,63,253,97,21,251,44,251,
+39,251,19,251,13,251,54,76,247,3,247,27,247,27,220,238,247,5,206,30,247,50,
+67,247,33,55,251,4,26,14,247,28,28,4,203,250,97,21,248,9,251,161,200,251,
+84,252,23,251,138,251,166,251,198,251,148,247,85,251,4,247,115,217,223,155,
+166,214,30,251,84,251,173,251,115,251,11,251,169,33,195,251,17,24,248,166,
+247,56,248,183,247,234,248,232,26,251,195,137,21,53,116,55,123,53,30,118,
+118,49,45,251,25,27,86,251,38,201,247,98,247,128,247,56,247,76,247,17,184,
+247,40,94,251,164,31,14,252,74,248,166,249,228,247,27,10,252,74,248,166,249,
+228,247,77,29,251,12,253,56,247,21,10,250,83,28,6,102,219,21,247,19,7,254,
+221,248,43,250,221,248,44,5,247,19,7,28,251,52,252,107,5,251,19,7,14,250,
+83,28,6,102,249,117,247,132,29,28,4,204,252,8,247,132,29,14,250,83,28,6,102,
+248,187,21,247,19,7,28,251,52,248,107,5,251,19,7,250,221,252,44,254,221,252,
+43,5,251,19,7,14,146,250,175,250,218,21,247,115,251,93,229,251,89,248,162,
+29,207,143,174,149,144,145,30,248,130,10,251,96,251,72,251,58,251,85,100,
+31,86,251,164,5,247,31,6,174,247,66,5,247,140,188,247,183,247,78,247,171,
+26,252,155,254,85,21,231,70,219,43,48,72,65,49,51,204,61,230,229,216,207,
+229,30,14,249,208,28,7,6,249,134,21,248,49,251,177,247,132,252,80,252,130,
+252,92,251,220,252,234,252,123,248,4,251,208,248,114,247,152,247,99,228,235,
+247,76,30,96,241,5,43,251,66,251,62,63,251,107,27,252,52,251,164,247,197,
+248,56,248,95,247,232,247,218,248,66,247,144,247,184,251,56,252,23,251,222,
+251,94,251,81,57,65,145,201,229,160,31,139,247,23,248,205,151,178,30,251,
+64,6,112,88,5,164,86,69,176,76,27,251,189,251,134,251,146,251,198,251,88,
+238,251,36,247,78,244,231,209,211,223,31,63,151,178,71,247,17,27,247,133,
+247,179,247,138,248,42,31,253,11,180,21,57,252,56,5,90,98,88,63,51,27,76,
+71,198,247,46,247,146,247,29,247,78,247,56,209,168,63,107,132,31,14,248,11,
+34,10,14,247,132,58,10,14,247,179,55,10,14,248,7,46,29,14,247,32,32,29,14,
+189,110,29,14,248,42,44,10,14,248,118,39,10,14,251,252,37,29,14,94,172,10,
+247,233,46,10,14,197,45,10,14,249,142,60,10,14,248,89,38,10,14,248,87,36,
+29,14,247,48,72,10,14,248,87,106,10,247,202,38,29,14,203,42,29,14,247,89,
+50,10,14,248,81,32,10,14,247,206,73,29,14,250,20,51,29,14,247,185,57,10,14,
+247,198,41,29,14,247,40,62,10,14,251,63,250,144,28,5,170,21,252,205,6,251,
+232,28,249,72,5,248,203,6,163,247,10,5,251,207,6,247,187,28,5,199,5,247,205,
+6,14,62,250,136,251,82,21,253,232,28,6,28,5,251,52,6,249,232,28,249,228,5,
+14,251,63,249,205,28,5,170,21,252,203,6,114,251,15,5,247,208,6,251,185,28,
+250,57,5,251,207,6,114,251,10,5,248,205,6,14,252,29,249,193,250,252,44,29,
+252,25,248,206,251,67,21,253,80,248,91,10,249,80,6,14,252,160,247,7,10,213,
+33,29,14,140,69,29,14,35,59,29,14,209,45,29,14,33,35,29,14,251,240,74,29,
+14,45,39,29,14,207,43,10,14,252,90,248,240,28,5,78,52,10,14,252,74,249,17,
+28,5,78,68,29,176,52,29,14,252,98,56,29,14,248,239,60,29,14,234,40,10,14,
+183,40,29,14,158,70,29,14,217,121,10,251,123,54,10,14,251,131,43,29,14,252,
+20,51,10,14,226,33,10,14,92,68,10,14,248,85,48,10,14,230,61,10,14,162,35,
+10,14,56,49,10,14,64,250,166,28,5,166,21,92,251,144,147,47,251,12,31,251,
+112,251,58,221,251,252,251,35,251,13,8,45,59,251,34,163,139,26,117,251,14,
+5,139,247,41,161,203,59,30,235,251,13,251,119,251,250,247,45,251,58,8,47,
+223,247,148,147,187,27,161,247,5,5,139,251,23,133,88,200,30,38,247,13,247,
+99,247,199,251,29,247,52,69,221,33,148,117,140,8,161,247,2,146,222,242,31,
+247,91,247,50,57,247,203,247,37,247,13,8,215,200,247,23,133,139,26,14,251,
+166,248,131,248,99,10,14,64,250,76,249,39,21,139,251,41,115,75,219,30,43,
+247,13,247,119,247,252,251,43,247,58,8,231,53,251,148,131,92,27,116,251,5,
+5,139,247,25,145,188,78,30,238,251,11,251,99,251,203,247,29,251,52,8,55,210,
+247,1,133,158,27,113,137,251,2,129,39,59,251,90,251,52,223,251,201,251,38,
+251,11,8,63,78,251,21,145,139,26,117,251,5,5,186,247,146,131,231,247,13,31,
+247,109,247,58,55,247,248,247,35,247,15,8,235,219,247,34,117,139,26,14,248,
+253,28,5,250,248,250,21,247,87,7,251,37,251,87,251,2,102,51,27,98,96,147,
+151,96,31,180,251,36,251,29,215,251,46,27,251,2,251,27,98,251,9,251,46,31,
+251,86,7,247,21,247,62,247,15,194,233,247,93,247,64,251,29,247,91,27,247,
+8,247,5,176,247,10,247,58,31,14,252,29,248,205,249,232,21,231,69,248,129,
+10,219,207,229,30,251,48,251,171,21,251,2,6,45,251,176,251,75,252,150,87,
+26,47,199,100,219,231,241,191,247,6,145,30,14,247,28,28,4,127,250,82,21,251,
+9,172,53,162,39,147,176,247,82,24,251,52,6,102,251,86,5,252,17,96,251,115,
+251,181,251,175,26,251,76,241,251,93,247,191,103,30,98,251,99,5,247,50,6,
+180,247,94,247,21,148,247,3,169,217,164,25,192,247,173,5,251,32,6,109,65,
+145,251,23,59,126,123,133,92,129,96,137,247,53,249,207,24,186,133,195,123,
+151,133,8,190,126,106,251,66,127,26,247,30,6,252,68,247,95,21,251,46,253,
+158,5,49,178,65,227,247,39,26,247,156,247,46,247,68,247,56,203,30,14,247,
+28,28,4,229,28,4,215,21,247,9,251,49,190,251,32,252,117,251,11,252,156,251,
+46,125,30,251,52,251,15,247,34,6,120,41,125,39,90,40,92,49,67,78,251,21,112,
+8,251,27,250,197,247,74,252,214,7,92,72,133,123,81,31,247,54,247,8,235,247,
+50,172,247,68,8,248,36,247,15,252,9,6,157,244,184,248,53,247,157,156,248,
+131,10,14,80,250,164,247,200,10,251,55,6,253,247,28,249,228,5,247,52,6,14,
+247,28,28,5,143,248,68,10,241,252,158,37,7,242,131,169,137,141,120,129,129,
+25,251,228,252,83,251,33,248,81,129,165,159,144,162,141,25,139,194,143,200,
+143,30,241,252,221,37,7,247,25,116,247,15,252,8,5,251,146,251,5,247,183,6,
+198,251,70,5,252,44,251,5,248,36,6,73,251,220,133,113,121,135,112,137,25,
+139,78,135,83,247,253,10,143,163,207,247,222,24,248,37,247,5,252,9,6,247,
+32,247,70,5,247,182,247,5,251,94,6,247,180,248,6,5,14,251,240,74,29,14,158,
+250,228,28,5,131,21,178,51,251,19,159,32,27,251,176,251,122,251,10,251,128,
+47,199,73,231,84,31,251,68,61,251,15,251,12,251,71,26,41,182,71,204,86,30,
+247,46,251,17,247,105,111,251,36,26,251,19,251,44,88,101,120,39,145,174,81,
+30,146,247,85,5,251,54,6,90,251,171,5,94,235,247,4,110,247,28,27,247,170,
+247,115,247,44,247,111,231,76,209,43,192,31,247,58,213,247,37,247,35,247,
+54,26,235,92,205,75,192,30,251,31,247,5,251,117,186,247,21,26,247,17,247,
+39,186,174,158,237,131,102,196,30,131,251,66,5,247,48,6,251,202,252,146,21,
+40,70,51,40,74,30,251,35,219,106,190,227,26,215,184,245,247,11,199,30,247,
+29,73,182,73,62,26,14,247,52,28,4,164,248,37,21,251,103,247,103,5,200,213,
+168,233,236,26,235,104,241,82,211,30,247,105,247,105,65,213,251,109,251,109,
+5,198,69,45,172,45,27,43,40,108,80,66,31,251,107,247,107,65,65,247,107,251,
+107,5,73,67,111,35,44,26,43,169,47,199,65,30,251,103,251,103,213,66,247,103,
+247,103,5,73,214,234,108,241,27,233,235,172,203,213,31,247,103,251,103,5,
+251,56,248,185,21,251,64,251,29,251,38,251,66,251,68,251,36,247,31,247,68,
+247,71,247,34,247,31,247,70,247,64,247,31,251,37,251,62,30,14,253,111,248,
+97,28,5,90,21,247,208,10,248,1,204,26,14,80,250,214,28,5,164,21,247,125,10,
+251,15,6,166,247,37,231,247,3,247,34,186,8,252,101,22,247,28,10,251,135,247,
+143,247,163,10,248,200,252,77,21,247,30,6,251,26,248,129,247,226,248,130,
+5,251,30,6,252,29,252,79,118,36,5,14,252,250,247,120,247,163,10,14,252,250,
+247,139,247,147,10,14,247,179,28,5,68,28,5,78,21,227,67,248,128,10,211,211,
+227,30,163,28,250,244,21,247,4,7,98,65,251,8,111,116,27,90,139,184,188,149,
+31,247,52,249,201,5,251,35,6,251,200,55,5,251,180,76,10,248,81,6,251,13,253,
+13,5,39,120,191,251,3,247,41,27,247,13,241,164,205,247,15,31,14,247,171,28,
+5,84,198,21,247,3,7,96,43,59,121,106,248,74,10,251,29,6,251,175,84,5,170,
+100,80,163,59,27,251,224,251,7,251,244,251,95,98,31,211,29,248,64,6,251,11,
+252,250,5,135,112,135,115,116,26,45,221,77,247,25,246,247,15,247,221,10,153,
+248,9,10,247,25,157,176,192,143,199,8,14,74,250,158,248,230,21,254,148,248,
+91,29,250,148,6,14,74,249,177,248,121,10,167,251,197,5,229,6,248,111,90,21,
+251,59,247,15,251,200,47,127,73,247,173,57,5,252,7,247,40,21,251,177,231,
+251,90,251,9,247,47,251,13,247,208,219,5,247,4,252,7,21,119,247,249,5,47,
+6,251,48,251,243,53,253,250,5,235,6,14,117,249,207,248,121,10,170,251,197,
+5,227,6,248,111,90,21,251,60,247,15,251,199,47,127,73,247,172,57,5,252,6,
+247,40,21,251,175,231,251,93,251,9,247,48,251,13,247,207,219,5,247,5,252,
+7,21,119,247,249,5,46,6,251,47,251,243,159,251,248,5,231,6,248,107,84,21,
+251,47,247,13,251,208,59,127,73,247,177,45,5,252,11,247,52,21,251,173,219,
+251,98,251,7,247,59,251,15,247,200,231,5,247,10,251,217,21,111,247,199,5,
+49,6,251,36,251,193,229,251,113,5,14,253,84,206,29,146,250,214,28,4,233,21,
+247,9,252,116,7,251,205,251,85,37,251,203,251,222,247,122,61,247,215,31,249,
+70,247,48,28,250,131,247,42,28,5,119,7,14,252,111,248,179,249,76,21,247,23,
+34,244,251,23,251,23,35,34,251,23,251,23,243,35,247,23,247,23,244,243,247,
+23,30,14,252,160,248,33,247,7,21,247,34,10,80,249,242,247,7,21,248,63,10,
+247,17,6,112,247,191,29,252,101,22,247,34,10,80,153,10,251,135,248,232,247,
+147,10,252,200,248,77,21,251,30,6,247,27,252,129,251,227,252,130,5,247,30,
+6,248,30,248,79,160,242,5,14,250,83,28,7,6,247,37,21,248,5,29,253,62,22,236,
+59,214,49,45,63,62,44,47,209,61,239,231,217,211,237,30,253,64,22,248,5,29,
+14,28,5,203,28,9,195,248,171,21,247,76,44,248,83,29,232,36,247,78,247,197,
+247,38,247,187,247,165,30,253,181,22,247,76,45,243,251,81,251,197,251,33,
+251,191,251,162,251,76,231,36,247,76,247,199,247,38,247,187,247,165,30,251,
+40,249,219,21,251,39,6,254,246,28,250,162,5,247,37,6,248,72,250,242,21,247,
+77,45,243,251,78,251,198,251,37,247,214,10,28,5,144,252,170,21,251,9,79,252,
+40,251,50,56,126,236,202,247,15,201,248,17,247,58,214,150,53,82,30,253,183,
+22,251,9,81,252,40,251,51,57,124,236,202,247,15,201,248,17,247,58,215,149,
+53,82,30,253,214,247,121,29,119,249,248,249,232,21,233,67,217,43,51,71,63,
+51,53,205,59,227,227,221,207,229,30,119,254,107,21,202,81,174,82,30,79,6,
+139,251,8,251,95,110,92,30,251,17,41,197,247,29,247,97,247,72,247,58,247,
+82,178,31,195,247,164,5,251,31,6,104,251,66,5,251,140,90,251,183,251,77,251,
+172,26,251,113,248,100,10,30,14,251,113,249,80,250,252,42,10,252,68,249,214,
+28,5,115,34,29,252,29,249,193,250,252,44,29,252,6,250,23,28,5,172,36,10,252,
+29,249,238,28,5,85,80,29,252,84,249,205,28,5,182,61,29,253,190,248,78,28,
+5,57,47,29,252,12,249,254,28,5,59,41,10,252,207,249,72,28,5,158,75,10,252,
+221,247,240,251,123,54,29,251,41,250,238,28,5,115,59,10,253,8,247,134,251,
+154,63,10,252,29,250,7,28,5,199,48,29,250,83,28,8,10,248,230,21,28,248,0,
+248,91,29,28,8,0,6,14,250,38,65,10,14,251,225,249,242,249,201,199,29,251,
+6,251,2,21,253,24,6,119,38,5,249,23,6,251,11,249,38,247,69,10,197,223,10,
+247,3,248,193,247,197,247,58,61,247,27,251,81,37,207,247,242,112,10,35,252,
+171,24,251,158,251,37,208,251,31,247,50,227,69,251,247,247,4,29,248,87,91,
+10,14,250,179,28,8,164,247,200,10,254,38,6,121,37,5,217,61,251,7,196,251,
+78,27,252,146,251,185,252,95,252,43,251,240,247,130,251,118,247,254,247,30,
+247,6,190,225,244,31,114,35,5,250,89,6,208,247,248,5,251,51,6,71,251,96,5,
+122,135,106,127,121,27,252,75,6,246,248,164,5,247,123,6,160,168,127,123,137,
+31,116,251,46,248,169,10,235,248,117,5,251,44,6,96,251,35,5,118,135,108,129,
+119,27,251,123,6,233,248,113,5,248,4,6,162,163,131,119,31,251,66,247,56,7,
+254,88,251,89,21,252,5,251,122,252,27,251,131,251,17,251,64,247,19,247,191,
+248,9,247,125,248,27,247,126,247,6,247,77,251,2,251,212,30,14,251,246,249,
+181,28,4,133,247,95,29,251,7,252,82,21,252,238,6,118,38,5,248,241,6,79,248,
+187,247,139,10,248,155,66,10,14,252,90,50,29,14,252,78,249,154,250,46,21,
+76,247,21,251,77,44,246,248,189,150,10,251,1,252,185,251,135,251,17,202,251,
+21,247,39,213,58,252,56,247,65,10,247,3,248,205,5,14,183,96,10,14,248,161,
+28,6,43,249,168,21,228,67,247,39,251,74,251,37,251,44,73,43,61,30,233,76,
+251,5,207,251,17,27,252,33,251,78,251,250,251,187,251,124,247,29,251,56,247,
+162,247,44,247,2,184,238,223,31,49,199,225,85,247,27,27,247,78,247,40,232,
+245,247,10,31,247,101,7,251,66,251,82,45,49,40,27,251,2,73,233,247,46,157,
+141,176,141,166,31,247,81,155,248,29,211,247,143,26,251,138,22,251,33,251,
+92,67,251,9,117,30,247,58,182,221,247,80,247,19,27,210,133,51,108,31,252,
+215,251,74,21,251,136,251,11,251,166,251,35,34,102,247,15,247,60,247,160,
+247,38,247,158,247,14,247,7,160,251,47,251,44,30,14,247,28,28,4,174,28,4,
+209,21,247,62,251,37,245,251,134,252,39,251,52,251,191,251,174,96,30,251,
+13,253,175,125,51,96,251,134,67,41,25,251,97,194,5,80,94,120,109,104,26,67,
+211,92,237,247,68,247,116,247,146,247,27,190,30,247,23,247,253,106,247,254,
+237,247,253,8,247,121,201,247,7,247,50,247,25,27,221,202,85,39,57,119,55,
+116,55,31,251,91,113,251,27,251,13,251,52,26,32,221,70,225,73,30,233,68,213,
+83,64,26,34,90,84,59,100,125,153,182,104,30,176,247,25,5,154,114,150,171,
+53,27,48,68,59,76,251,27,237,75,247,74,247,152,247,62,247,27,247,85,241,51,
+215,49,211,31,51,206,47,203,213,26,247,8,247,37,150,166,158,157,139,128,241,
+30,172,247,7,180,247,19,247,13,26,14,251,184,249,140,28,6,92,21,49,6,251,
+224,53,5,72,7,247,97,163,251,23,253,0,5,128,137,128,131,248,35,10,125,145,
+141,148,25,14,247,73,28,4,164,248,23,21,248,109,254,230,251,15,250,107,251,
+242,7,14,244,28,4,119,247,134,21,71,6,94,121,108,55,78,27,102,149,223,163,
+143,31,247,46,249,158,5,251,152,6,251,40,253,123,5,86,80,67,61,53,27,84,112,
+213,184,169,143,170,145,168,31,247,23,249,45,5,251,148,6,251,64,253,244,121,
+41,116,39,101,46,25,106,59,92,121,43,26,83,194,90,194,219,227,213,221,247,
+31,115,209,169,247,37,30,111,166,215,87,178,27,247,33,223,201,241,227,31,
+61,153,193,53,229,27,247,66,225,246,247,52,182,31,14,247,177,28,5,150,249,
+195,21,190,7,73,154,5,248,43,7,205,151,5,195,251,128,112,7,251,7,251,234,
+251,6,247,234,5,166,251,128,83,7,201,129,5,252,45,7,77,124,5,88,247,83,190,
+7,77,154,5,248,37,7,247,50,252,103,5,206,6,247,56,248,101,5,252,35,7,82,124,
+5,88,7,252,164,248,23,21,247,46,252,114,251,46,207,7,151,227,5,143,141,145,
+145,152,27,214,252,55,6,74,124,5,88,247,152,190,7,69,154,5,248,55,219,7,152,
+143,135,133,141,31,153,51,5,14,248,7,75,29,249,149,28,6,219,249,27,21,247,
+33,251,25,191,251,13,251,17,251,127,87,251,53,87,180,121,184,169,174,149,
+152,168,30,172,247,57,5,146,163,160,145,165,27,217,190,92,61,251,122,251,
+252,251,82,251,60,251,3,31,121,37,5,249,31,6,186,247,134,5,51,6,96,251,3,
+5,252,5,6,247,68,233,248,9,247,81,247,125,26,251,45,249,156,21,251,42,247,
+225,29,247,146,83,10,14,250,83,28,6,102,249,113,21,247,19,252,187,248,5,251,
+18,252,5,252,187,251,19,248,187,252,4,247,18,248,4,7,248,187,253,113,247,
+132,29,14,247,48,28,4,178,249,166,21,247,77,251,13,247,41,252,23,30,63,6,
+160,247,1,143,163,153,247,126,29,251,107,254,210,24,135,115,129,133,112,137,
+8,247,168,29,159,247,3,24,170,176,137,162,27,248,45,247,148,247,109,247,209,
+31,251,191,107,21,251,48,61,39,41,79,30,55,90,47,125,59,143,247,17,249,5,
+24,141,149,182,139,149,27,247,30,245,48,251,53,31,14,249,149,28,6,188,247,
+211,21,251,39,6,239,248,148,5,251,35,6,252,175,252,143,119,34,5,248,47,248,
+94,10,247,42,6,82,28,4,180,21,251,44,247,225,29,247,101,83,10,250,87,94,21,
+73,251,226,5,251,177,6,14,250,83,28,4,123,250,68,21,207,84,194,71,71,84,84,
+71,69,194,86,207,207,194,192,209,30,248,127,252,29,247,132,29,249,117,251,
+158,21,208,84,193,71,71,84,85,70,71,194,86,207,207,194,192,207,30,14,252,
+18,248,42,249,68,21,249,199,34,253,199,7,244,254,218,21,249,200,34,253,200,
+7,14,252,70,248,189,28,4,225,21,247,17,39,240,251,17,251,17,38,38,251,17,
+251,17,240,39,247,17,247,17,239,239,247,17,30,57,22,59,76,76,59,59,75,202,
+219,219,203,203,219,219,202,75,59,30,14,158,250,166,249,17,21,247,79,10,30,
+248,27,29,251,216,28,249,127,141,10,31,251,178,131,93,10,249,149,28,6,207,
+247,211,247,60,10,80,28,4,180,248,56,29,247,246,110,10,249,38,253,1,21,71,
+251,226,5,251,172,6,14,251,184,250,15,28,5,162,21,247,19,36,198,251,64,251,
+102,251,38,65,251,4,98,180,104,198,199,248,107,10,153,175,27,180,207,115,
+42,251,68,251,74,251,23,252,23,251,142,31,120,53,5,249,74,6,182,247,107,5,
+37,6,94,37,248,144,29,247,98,247,122,26,14,249,5,187,29,251,107,252,62,21,
+206,7,251,176,105,247,78,247,238,251,195,200,8,213,149,247,55,182,247,73,
+26,247,82,251,88,248,164,29,155,137,153,129,122,26,253,68,7,121,125,127,123,
+248,98,10,124,123,151,157,31,247,181,7,155,139,137,149,247,163,251,56,252,
+35,247,246,27,174,172,139,147,198,31,252,4,249,7,21,251,44,251,9,112,55,131,
+126,139,141,115,248,68,29,250,83,28,6,102,248,187,247,132,29,14,170,250,203,
+28,5,55,21,84,247,9,251,140,43,251,4,247,52,251,232,89,130,70,247,54,98,205,
+47,251,161,36,191,251,15,247,180,247,7,156,102,163,86,160,90,25,141,125,124,
+141,127,27,247,155,10,247,105,41,247,150,45,247,60,31,47,253,25,126,29,250,
+83,28,6,41,247,33,21,252,107,248,109,248,107,248,109,59,219,252,109,252,111,
+252,109,248,111,59,59,248,107,252,109,252,107,252,109,219,59,248,109,248,
+112,248,109,252,112,5,14,251,184,250,11,28,5,170,21,247,1,57,208,251,79,251,
+82,251,48,70,44,94,191,100,177,170,184,158,147,158,30,159,247,7,5,149,154,
+173,159,186,27,158,227,119,41,251,9,251,11,69,251,54,147,31,125,43,5,149,
+215,161,144,164,27,153,246,130,251,8,251,17,251,9,55,45,112,98,155,143,129,
+31,118,244,5,147,121,119,159,98,27,69,104,74,114,84,215,55,247,84,247,155,
+247,57,247,46,247,41,227,78,188,251,9,160,31,247,56,190,209,231,221,26,14,
+249,5,187,29,251,238,252,68,21,247,148,251,7,7,111,251,68,5,139,88,110,67,
+251,76,251,3,247,54,247,107,247,70,223,247,97,247,109,217,178,102,139,30,
+167,251,56,5,247,7,247,140,6,139,35,194,251,77,251,207,251,82,251,109,251,
+156,251,197,247,98,251,71,247,183,247,68,247,13,191,139,30,14,248,11,34,10,
+248,87,249,143,34,29,248,11,34,10,248,84,248,132,44,29,248,11,34,10,248,135,
+249,87,41,10,248,11,34,10,247,216,248,132,42,10,248,11,34,10,248,67,249,186,
+75,10,248,11,34,10,248,147,249,200,36,10,247,179,55,10,252,114,28,251,88,
+54,29,247,32,32,29,61,249,124,34,29,247,32,32,29,58,248,113,44,29,247,32,
+32,29,109,249,68,41,10,247,32,32,29,251,97,248,113,42,10,251,252,37,29,247,
+105,248,169,34,29,251,252,37,29,247,102,247,158,44,29,251,252,37,29,247,153,
+248,113,41,10,251,252,37,29,225,247,158,42,10,248,89,38,10,251,45,248,228,
+36,10,248,87,36,29,247,2,250,65,34,29,248,87,36,29,246,249,54,44,29,248,87,
+36,29,247,50,250,9,41,10,248,87,36,29,122,249,54,42,10,248,87,36,29,247,62,
+250,122,36,10,203,42,29,247,19,249,253,48,29,248,81,32,10,251,76,248,169,
+34,29,248,81,32,10,251,79,247,158,44,29,248,81,32,10,251,28,248,113,41,10,
+248,81,32,10,251,203,247,158,42,10,247,198,41,29,251,74,248,169,34,29,247,
+198,41,29,251,26,248,113,41,10,247,40,62,10,76,248,243,48,29,213,33,29,247,
+229,248,224,34,29,213,33,29,247,226,247,213,44,29,213,33,29,248,21,248,168,
+41,10,213,33,29,247,102,247,213,42,10,213,33,29,247,209,249,11,75,10,213,
+33,29,248,33,249,25,36,10,35,59,29,251,155,254,227,54,29,33,35,29,247,216,
+248,220,34,29,33,35,29,247,213,247,209,44,29,33,35,29,248,8,248,164,41,10,
+33,35,29,247,89,247,209,42,10,252,90,50,29,247,42,28,5,49,34,29,252,90,50,
+29,247,39,250,186,44,29,252,90,50,29,247,90,28,4,249,41,10,252,90,50,29,162,
+250,186,42,10,234,40,10,79,28,5,125,36,10,183,40,29,247,164,249,146,34,29,
+183,40,29,247,161,248,135,44,29,183,40,29,247,212,249,90,41,10,183,40,29,
+247,37,248,135,42,10,183,40,29,247,224,249,203,36,10,251,131,43,29,247,68,
+248,249,48,29,226,33,10,59,28,5,58,34,29,226,33,10,56,250,195,44,29,226,33,
+10,107,28,5,2,41,10,226,33,10,251,99,250,195,42,10,162,35,10,96,248,187,34,
+29,162,35,10,144,248,131,41,10,56,49,10,249,51,28,5,11,48,29,247,138,250,
+199,247,210,10,253,64,22,248,4,10,14,252,74,247,159,10,248,32,28,6,193,28,
+5,92,21,192,61,223,251,44,251,213,251,15,251,223,251,130,94,30,252,105,76,
+10,248,105,6,102,251,144,111,251,146,106,251,74,108,251,66,96,251,50,76,49,
+251,77,248,165,10,194,45,247,7,247,148,247,78,247,193,247,109,193,30,174,
+247,38,208,248,146,156,247,6,8,247,164,247,13,251,144,247,185,10,14,250,155,
+28,8,41,28,5,78,247,76,10,164,28,250,244,21,247,4,7,98,65,251,7,111,117,27,
+89,137,184,188,150,31,247,51,249,201,5,251,35,6,251,207,55,5,251,173,247,
+185,10,192,61,223,251,44,251,213,251,15,251,223,251,130,94,30,252,105,76,
+10,248,105,6,102,251,144,111,251,146,106,251,74,108,251,66,96,251,50,76,49,
+251,77,248,165,10,194,45,247,7,247,148,247,78,247,193,247,109,193,30,174,
+247,38,208,248,146,156,247,6,8,248,80,6,251,13,253,13,5,39,121,190,251,3,
+247,41,27,247,13,242,164,205,247,15,31,14,250,144,28,8,57,198,21,247,3,7,
+96,43,61,121,104,248,74,10,251,27,6,251,177,84,5,170,102,80,163,57,27,251,
+213,251,15,251,223,251,130,94,31,252,105,76,10,248,105,6,102,251,144,111,
+251,146,106,251,74,108,251,66,96,251,50,76,49,251,77,248,165,10,194,45,247,
+7,247,148,247,78,247,193,247,109,193,30,174,247,38,208,248,146,156,247,6,
+8,248,66,6,251,11,252,250,248,92,10,245,247,13,247,221,10,156,247,105,247,
+2,238,247,21,251,13,24,247,26,157,173,192,146,199,8,14,247,28,250,186,28,
+5,242,21,251,1,6,96,251,47,5,142,112,110,142,110,27,180,247,41,5,251,1,6,
+96,251,49,5,252,33,80,251,126,252,17,252,6,26,251,90,210,251,102,247,90,44,
+30,67,251,153,5,247,5,6,200,247,117,164,133,166,134,167,137,25,81,251,104,
+5,247,5,6,196,247,102,247,38,146,247,17,182,220,171,247,236,29,120,129,79,
+124,91,135,247,191,250,221,24,150,134,156,133,150,116,137,123,25,137,251,
+110,5,247,21,6,193,247,235,73,162,81,159,81,153,25,253,53,253,195,21,247,
+240,247,49,247,130,247,65,231,30,251,154,254,75,5,97,204,113,229,247,10,26,
+247,47,251,255,21,247,188,250,205,5,141,151,152,140,151,27,153,156,136,136,
+156,31,251,199,254,239,114,148,114,151,115,155,25,14,247,28,28,4,160,248,
+230,21,254,248,248,91,29,250,248,6,14,249,149,28,6,219,249,52,21,247,19,251,
+27,184,32,251,55,251,97,57,251,87,72,188,79,200,115,30,251,8,108,34,76,251,
+28,26,251,39,247,52,90,247,15,247,60,247,115,219,247,94,240,67,180,57,167,
+30,242,184,237,195,247,21,26,251,43,249,131,21,251,44,247,225,29,247,146,
+83,10,250,207,94,21,70,94,69,88,96,30,74,170,38,180,225,26,217,215,198,215,
+204,184,92,73,30,70,252,78,21,43,40,92,55,60,79,196,219,229,190,174,197,194,
+30,212,102,247,32,102,39,26,14,249,149,213,29,251,36,249,131,21,251,41,6,
+28,251,94,28,250,113,5,247,41,6,248,21,247,176,10,166,143,151,161,155,29,
+249,163,253,1,247,3,10,249,149,213,29,251,30,249,131,21,251,41,6,28,251,92,
+28,250,113,248,169,10,248,37,167,29,249,167,252,255,247,3,10,249,149,28,6,
+166,249,52,21,247,19,251,29,184,32,251,54,251,98,57,251,87,72,188,79,200,
+115,30,251,7,108,35,76,251,28,26,251,39,247,50,90,247,15,247,62,247,115,219,
+247,94,240,65,180,57,167,30,244,184,237,195,247,21,26,253,99,249,135,247,
+80,10,248,199,221,21,251,44,248,113,10,28,4,172,249,33,21,70,96,248,121,29,
+213,198,214,207,182,92,73,30,69,247,140,10,249,149,28,6,215,249,50,21,247,
+25,251,44,178,33,251,1,251,119,90,251,36,90,186,121,182,164,165,143,151,162,
+30,170,247,44,5,143,159,160,145,161,27,209,208,100,61,251,43,251,37,104,251,
+15,149,31,123,47,5,229,149,247,41,143,251,21,26,33,39,51,37,108,110,145,149,
+111,30,122,247,29,5,147,123,120,248,106,10,223,247,58,247,152,221,247,96,
+247,11,251,21,178,45,31,247,15,151,247,37,223,247,32,26,251,41,249,133,21,
+251,42,247,225,29,247,146,83,10,14,249,149,28,6,242,114,10,251,11,249,133,
+135,10,14,250,83,28,6,102,248,1,21,247,19,253,35,7,247,138,247,137,5,248,
+45,247,19,251,174,6,247,35,247,36,57,221,251,117,251,118,5,253,162,251,19,
+249,35,6,251,138,251,137,5,252,45,251,19,247,174,6,251,35,251,36,221,57,247,
+117,247,118,5,14,250,83,28,6,168,248,254,21,247,48,251,29,247,19,251,46,251,
+45,251,24,251,15,43,35,30,235,33,251,24,247,15,251,43,27,251,46,251,29,251,
+19,251,48,251,41,247,15,251,31,247,46,247,74,235,247,0,247,1,247,17,31,251,
+1,247,15,237,251,0,247,74,27,247,46,247,15,247,31,247,41,31,32,125,21,37,
+45,63,43,251,27,47,241,225,51,30,211,225,247,8,247,1,247,11,27,244,218,49,
+38,31,253,23,149,21,53,51,47,37,251,25,27,43,43,215,241,240,218,229,244,247,
+11,247,8,251,1,67,225,31,14,250,83,28,6,102,247,132,21,247,19,7,254,221,247,
+217,250,221,247,218,5,247,19,7,28,251,52,252,25,5,251,19,7,28,4,204,253,9,
+248,134,10,250,83,28,6,102,249,9,21,247,19,7,28,251,52,248,25,5,251,19,7,
+250,221,251,218,254,221,251,217,5,251,19,7,28,4,204,251,132,248,134,10,107,
+250,111,249,220,21,247,19,61,248,111,252,74,33,36,104,112,78,30,223,33,5,
+186,247,0,164,161,245,27,247,46,247,41,251,64,251,100,135,31,137,57,137,61,
+121,51,8,247,2,251,36,86,174,251,17,27,251,19,251,187,47,252,70,251,64,247,
+48,251,99,247,142,248,103,196,249,84,247,73,31,251,95,251,93,21,251,183,105,
+44,251,222,251,105,27,251,80,125,247,105,223,247,79,239,247,166,247,103,247,
+23,196,51,90,184,31,14,223,194,29,248,73,156,29,247,20,28,4,152,247,203,21,
+61,6,251,66,75,59,78,51,151,221,247,29,30,248,181,247,17,7,247,7,178,223,
+240,31,87,6,110,131,94,114,94,27,253,117,6,251,64,73,251,47,47,31,199,6,175,
+151,145,219,247,29,27,225,251,150,6,252,19,35,86,77,94,107,194,219,30,71,
+6,251,33,166,251,38,247,10,247,58,231,247,56,247,105,30,248,105,247,171,252,
+215,7,251,9,161,251,42,247,91,247,19,244,247,5,247,115,30,14,251,16,250,13,
+28,5,80,21,159,190,133,184,94,182,112,164,70,145,75,127,251,94,98,77,251,
+48,119,252,209,131,251,122,24,128,251,228,121,251,213,135,63,133,100,112,
+80,251,5,237,78,192,61,92,123,102,118,90,147,92,182,98,166,114,207,131,204,
+154,247,76,178,232,235,163,249,27,149,247,166,24,150,247,169,141,247,217,
+145,213,143,178,166,201,247,6,40,199,86,216,184,154,174,8,14,248,112,109,
+29,228,28,4,154,28,5,92,21,201,251,56,7,251,226,28,251,57,252,35,249,160,
+251,132,251,13,172,78,247,19,202,248,78,253,252,5,201,6,248,6,28,5,92,5,14,
+250,83,28,6,102,249,181,21,247,194,29,127,251,87,124,72,67,247,109,10,213,
+194,190,8,251,240,4,247,194,29,126,251,87,125,72,67,247,165,10,149,247,14,
+148,247,5,212,194,191,8,14,247,112,247,104,10,252,125,14,150,250,152,249,
+183,21,252,50,249,166,5,251,21,6,252,49,253,166,248,49,253,183,5,247,21,6,
+247,179,249,183,21,251,242,253,68,251,244,249,68,247,244,249,50,5,14,116,
+248,55,249,236,21,158,131,123,149,121,27,112,117,115,115,111,163,119,165,
+166,157,162,164,145,138,146,136,145,31,247,207,253,139,21,157,130,120,151,
+120,27,114,119,115,116,111,163,118,163,166,160,163,163,145,137,145,137,145,
+31,252,95,249,65,21,148,130,127,144,127,27,114,117,117,112,114,160,118,166,
+167,158,158,168,152,133,151,130,147,31,248,218,252,216,21,147,129,126,144,
+126,27,113,119,118,113,114,160,117,166,167,159,161,164,151,134,152,130,148,
+31,253,66,248,93,21,141,133,133,141,133,27,115,116,118,112,115,158,115,167,
+163,164,159,165,158,127,158,120,147,31,249,139,251,206,21,141,134,133,140,
+133,27,115,114,123,108,115,157,116,169,164,162,159,166,158,127,156,121,147,
+31,253,188,247,52,21,112,119,118,113,114,159,116,165,31,141,6,163,163,161,
+166,164,115,160,114,31,249,201,140,21,115,137,115,119,112,26,115,160,117,
+163,30,143,6,165,160,161,164,165,117,161,113,31,253,188,251,54,21,120,132,
+129,122,121,26,112,162,117,164,166,160,163,164,165,117,159,113,133,132,138,
+136,133,30,249,139,247,207,21,121,131,128,121,120,26,113,161,118,163,167,
+160,163,163,166,115,160,115,133,133,137,137,133,30,253,65,252,95,21,130,130,
+134,128,127,26,114,162,116,164,165,160,162,164,166,118,159,111,127,128,133,
+130,130,30,248,216,248,218,21,131,130,134,126,127,26,115,160,115,165,165,
+160,161,165,165,119,161,112,127,127,134,130,129,30,252,93,253,66,21,137,133,
+137,133,133,26,116,161,115,165,163,163,159,166,163,119,163,112,123,118,127,
+121,131,30,247,206,249,139,21,137,133,138,134,133,26,115,159,114,166,163,
+163,159,166,164,118,163,112,120,122,127,121,131,30,251,52,253,188,21,247,
+252,10,249,201,4,247,252,10,14,213,33,29,14,251,234,249,7,252,59,123,29,251,
+225,249,242,249,201,123,10,92,28,4,172,123,10,213,33,29,248,41,247,213,49,
+29,213,33,29,251,61,254,255,248,204,10,213,33,29,247,226,247,213,71,29,247,
+111,249,47,34,29,213,33,29,247,226,247,213,248,207,29,213,33,29,247,226,247,
+213,71,29,247,171,249,104,36,10,213,33,29,247,226,247,213,248,217,29,213,
+33,29,247,208,248,41,58,29,213,33,29,248,9,249,35,61,29,213,33,29,251,61,
+254,255,71,10,248,178,28,6,250,61,29,213,33,29,248,9,249,35,248,214,29,213,
+33,29,248,9,249,35,248,213,10,213,33,29,248,9,249,35,248,219,29,213,33,29,
+248,9,249,35,248,219,10,213,33,29,247,220,248,232,81,29,213,33,29,248,42,
+249,52,48,29,213,33,29,248,17,248,194,80,29,213,33,29,248,13,248,168,41,10,
+213,33,29,248,21,248,168,62,29,248,146,248,62,80,29,213,33,29,247,42,248,
+166,47,29,213,33,29,248,101,250,82,131,10,251,176,251,155,47,29,213,33,29,
+247,209,249,11,248,216,10,213,33,29,247,62,249,24,202,29,213,33,29,247,106,
+249,21,37,10,213,33,29,251,61,254,255,65,29,213,33,29,82,28,251,139,129,29,
+213,33,29,247,169,28,251,111,63,10,213,83,29,213,250,123,250,211,21,251,7,
+205,49,251,33,5,146,110,108,144,110,27,252,77,251,90,252,5,251,197,44,173,
+251,14,226,60,31,251,4,251,69,244,69,247,10,247,77,5,128,171,176,133,180,
+27,247,223,10,247,149,10,251,58,6,252,224,253,17,21,247,123,247,8,247,197,
+247,148,146,30,252,8,252,224,5,247,200,70,21,112,110,67,47,51,27,107,115,
+147,154,122,31,247,238,248,176,68,252,5,153,214,112,251,42,25,14,249,74,28,
+6,241,200,247,43,10,36,50,119,104,62,31,144,149,143,150,142,148,8,251,71,
+247,11,29,230,247,28,187,238,247,14,31,56,189,225,75,247,27,27,247,223,10,
+252,25,249,126,193,10,253,0,22,247,56,10,14,249,27,28,6,136,248,116,29,47,
+58,119,105,70,30,150,168,5,251,40,247,11,29,247,7,247,4,190,239,247,17,31,
+45,198,244,82,247,56,247,123,10,247,168,247,32,248,11,29,252,245,247,70,21,
+66,251,255,124,40,121,42,247,115,29,14,249,31,28,6,199,196,21,228,10,247,
+60,249,174,5,248,30,29,109,203,242,161,31,247,8,248,224,248,139,29,251,111,
+247,11,29,237,235,184,201,226,31,79,177,212,92,247,4,247,164,10,254,91,249,
+130,21,47,252,119,153,218,114,251,30,135,121,24,93,99,66,67,64,247,178,10,
+14,248,152,28,6,35,249,119,21,153,164,170,198,209,26,247,174,29,91,251,11,
+251,70,251,129,251,73,251,113,25,131,152,137,159,171,26,247,25,249,55,237,
+10,247,162,247,183,247,73,247,174,222,247,43,8,253,183,207,193,10,14,248,
+173,28,6,60,248,87,21,247,16,251,16,7,180,203,172,194,164,184,8,153,164,170,
+198,209,26,247,174,29,124,103,113,92,104,86,25,251,159,6,198,247,191,237,
+10,247,35,247,46,247,10,247,43,230,247,23,8,253,1,247,248,193,10,247,58,253,
+53,21,131,152,137,159,171,26,188,247,144,5,247,99,6,67,39,52,251,2,52,32,
+8,14,248,232,28,6,208,250,33,21,193,7,251,86,200,5,41,6,251,54,251,250,251,
+18,251,192,251,26,251,130,8,132,112,118,135,136,247,250,29,251,111,247,11,
+29,237,235,184,187,211,31,79,165,199,106,225,27,171,173,144,147,172,31,251,
+1,251,62,47,40,56,121,247,15,10,253,250,102,21,247,56,10,14,213,107,10,251,
+226,115,10,213,33,29,14,251,226,249,247,249,202,123,29,213,83,29,202,248,
+141,250,143,21,251,167,251,56,251,157,251,165,251,186,247,45,251,104,247,
+140,222,225,168,170,205,31,159,104,5,247,102,6,126,170,117,207,135,160,8,
+247,14,224,247,246,180,247,73,30,196,152,188,147,163,27,167,228,120,135,160,
+31,148,239,5,153,106,251,96,205,80,27,66,96,119,54,100,31,234,251,10,46,169,
+54,27,170,254,39,21,61,251,8,213,247,148,247,130,247,13,247,53,247,11,203,
+200,104,104,189,31,107,251,13,104,251,73,87,251,161,8,91,125,97,99,93,27,
+14,213,107,10,251,226,115,10,248,155,66,10,14,248,155,66,10,249,19,248,122,
+34,29,248,155,66,10,249,63,248,92,80,29,248,155,174,247,80,21,78,178,251,
+44,247,91,214,247,24,166,216,231,30,110,60,5,247,107,6,160,182,5,108,169,
+184,102,195,27,248,72,247,88,248,5,247,197,247,45,51,247,114,251,141,251,
+13,251,7,91,56,51,31,243,90,47,166,251,64,27,251,89,251,72,251,13,59,61,31,
+251,89,7,247,85,247,111,209,204,229,27,247,52,165,33,51,88,137,106,123,81,
+31,251,167,117,251,242,251,17,251,105,26,247,152,22,247,19,247,95,237,247,
+39,172,30,251,74,123,251,46,251,60,33,27,75,129,182,188,31,248,187,143,21,
+244,248,195,5,184,173,219,215,213,27,247,23,129,251,35,47,251,116,32,251,
+189,251,131,113,31,14,95,247,30,250,22,21,102,164,48,247,21,188,225,155,185,
+199,30,120,92,5,247,32,6,152,165,5,120,159,168,117,175,27,247,176,247,19,
+247,113,247,75,231,82,247,25,251,54,61,64,111,89,82,31,201,107,79,155,251,
+4,27,251,20,251,9,67,91,88,31,251,10,7,247,7,247,35,184,178,198,27,243,156,
+76,86,108,137,120,129,104,31,251,71,126,251,119,64,251,20,26,247,61,22,215,
+247,24,198,234,159,30,251,2,129,39,39,70,27,97,133,164,169,31,247,250,141,
+21,207,247,228,5,166,161,191,184,187,27,224,133,53,84,251,26,69,251,70,251,
+47,123,31,14,247,11,28,4,213,247,140,21,251,23,6,96,123,102,90,112,27,106,
+111,147,184,31,247,127,7,225,247,19,247,70,248,64,139,26,251,103,6,139,86,
+33,112,71,30,247,30,104,55,200,251,52,27,252,51,251,70,252,1,251,201,251,
+31,218,251,128,247,128,247,68,231,191,247,0,227,31,65,160,176,53,241,27,247,
+50,229,247,5,247,52,231,31,252,148,247,56,21,251,32,63,94,251,25,251,41,27,
+251,23,149,247,44,231,247,95,247,21,247,201,247,74,247,13,135,251,189,251,
+78,102,31,14,248,11,34,10,14,251,30,250,128,249,165,21,200,7,110,142,107,
+142,139,26,119,141,135,141,136,155,251,37,249,137,24,251,49,6,252,129,253,
+155,62,131,5,78,247,235,200,7,106,142,102,143,139,26,122,140,131,144,147,
+151,247,24,247,117,24,247,143,6,178,251,117,142,124,128,137,122,138,25,139,
+106,135,111,136,30,78,7,172,248,17,21,251,85,6,247,41,247,130,5,14,244,250,
+234,22,235,7,248,102,10,251,66,250,15,5,251,107,6,252,234,247,182,10,247,
+39,247,138,24,247,191,6,180,251,128,248,126,10,7,176,248,113,21,251,99,6,
+247,51,247,142,5,14,248,11,34,10,248,155,248,132,49,29,248,11,34,10,248,84,
+248,132,71,29,247,111,249,47,34,29,248,11,34,10,248,84,248,132,248,207,29,
+248,11,34,10,248,84,248,132,71,29,247,171,249,104,36,10,248,11,34,10,248,
+84,248,132,248,217,29,248,11,34,10,40,28,250,180,71,10,248,183,28,7,60,44,
+29,248,11,34,10,248,66,248,216,58,29,248,11,34,10,248,123,249,210,61,29,248,
+11,34,10,248,123,249,210,248,214,29,248,11,34,10,248,123,249,210,248,213,
+10,248,11,34,10,248,123,249,210,248,219,29,248,11,34,10,248,123,249,210,248,
+219,10,248,11,34,10,40,28,250,180,71,10,248,222,28,8,138,61,29,248,11,34,
+10,248,150,249,212,77,10,248,11,34,10,248,156,249,227,48,29,248,11,34,10,
+248,131,249,113,80,29,248,11,34,10,248,135,249,87,41,10,248,11,34,10,248,
+135,249,87,248,205,10,248,11,34,10,247,156,249,85,47,29,248,11,34,10,248,
+175,28,4,109,131,10,251,136,251,155,47,29,248,11,34,10,248,67,249,186,248,
+216,10,248,11,34,10,247,220,249,196,37,10,248,11,34,10,40,28,250,180,65,29,
+248,11,34,10,152,28,250,170,129,29,248,11,34,10,248,82,28,250,142,63,10,248,
+11,247,75,247,13,29,238,28,249,229,21,157,29,14,247,180,247,64,247,200,10,
+119,35,212,124,167,133,143,131,143,114,25,247,100,28,251,31,5,247,121,6,249,
+75,28,5,6,247,8,156,159,243,5,252,68,6,119,35,247,2,124,152,137,158,119,127,
+118,25,251,64,251,209,5,252,65,6,92,247,217,136,154,155,157,152,141,25,247,
+13,154,159,243,5,46,252,236,21,247,233,6,251,154,252,128,5,14,28,4,150,28,
+8,176,249,234,21,247,183,251,65,247,154,252,31,251,164,251,73,251,20,251,
+75,251,30,30,84,247,203,116,10,252,106,195,247,183,58,247,122,27,248,173,
+247,128,248,103,248,56,31,251,211,22,251,248,251,90,252,40,251,133,251,27,
+251,24,247,38,247,174,248,5,247,87,248,29,247,136,247,33,247,18,251,48,251,
+166,30,254,177,251,111,247,199,29,14,28,5,35,28,9,4,22,247,152,29,251,115,
+28,4,238,24,251,134,6,252,173,254,39,251,53,250,39,5,232,29,248,203,247,152,
+29,137,148,24,247,88,248,0,5,248,23,6,199,252,11,143,115,123,135,112,137,
+25,139,88,132,96,135,30,37,7,190,249,15,247,199,29,253,252,252,33,247,199,
+29,14,250,180,28,8,246,248,68,10,241,252,185,247,179,29,57,251,58,251,95,
+27,251,15,60,206,247,86,105,31,251,73,250,149,116,10,161,251,27,5,251,240,
+196,247,30,71,247,175,27,248,3,247,64,247,81,247,176,194,31,247,50,249,169,
+248,138,10,28,250,229,253,7,247,199,29,14,249,189,247,156,10,252,121,253,
+233,24,251,72,250,147,116,10,228,252,187,5,247,127,6,249,117,28,5,13,5,254,
+207,253,5,247,199,29,14,249,189,247,156,10,251,235,252,238,24,251,78,6,251,
+28,249,152,116,10,228,252,187,5,247,127,6,247,206,248,187,5,247,208,247,9,
+251,141,6,247,248,249,5,5,254,207,253,5,247,199,29,248,18,252,150,21,239,
+6,63,251,26,5,14,249,189,247,156,10,252,121,253,233,24,251,72,250,147,116,
+10,229,252,193,121,106,111,88,77,38,247,180,29,247,9,247,48,228,30,249,211,
+28,5,176,5,254,207,253,5,247,199,29,14,247,28,28,4,172,248,211,21,247,17,
+251,91,7,33,249,87,5,251,97,6,251,245,253,87,5,251,218,251,17,247,156,6,81,
+251,7,5,251,98,251,17,247,36,6,251,2,251,112,38,126,5,37,248,84,241,7,96,
+143,91,146,139,26,117,141,128,147,150,159,230,247,84,24,248,69,6,167,251,
+84,142,115,126,135,116,137,25,139,95,132,103,135,30,37,248,118,241,7,101,
+143,97,144,139,26,113,143,133,143,136,165,110,247,82,24,247,36,247,17,251,
+55,6,122,247,7,5,252,171,22,247,176,6,155,251,7,5,251,247,6,247,165,248,208,
+21,187,251,224,5,251,99,6,14,248,11,28,5,135,28,5,127,21,89,6,251,151,37,
+5,208,73,51,172,82,27,252,158,251,167,252,154,252,54,251,117,247,30,251,171,
+247,158,247,23,247,16,200,237,247,6,31,116,251,18,5,248,113,241,6,78,143,
+77,146,139,26,111,141,132,155,143,164,8,247,107,250,215,168,247,52,139,26,
+251,236,251,171,21,251,53,253,187,5,68,81,251,5,65,53,27,251,21,35,247,31,
+247,130,247,195,247,78,248,33,247,173,200,233,64,89,168,31,14,248,11,244,
+106,21,189,6,247,151,241,5,70,205,247,10,106,196,27,248,158,247,137,248,154,
+248,54,247,117,251,30,247,171,251,158,251,23,251,16,78,41,251,6,31,162,247,
+18,5,252,113,37,6,200,135,201,132,139,26,167,137,146,123,135,114,8,251,107,
+254,215,110,251,52,139,26,247,236,247,171,21,247,53,249,187,5,210,197,247,
+5,213,225,27,247,21,243,251,31,251,130,251,195,251,48,252,33,251,173,78,251,
+16,214,189,110,31,14,250,38,65,10,14,247,104,28,5,186,28,6,73,21,253,199,
+78,6,166,137,173,136,139,26,158,138,148,130,130,130,252,221,253,31,24,122,
+121,137,137,123,138,8,139,107,136,108,136,30,78,247,252,200,7,63,146,5,137,
+115,150,148,146,31,247,91,247,111,5,247,153,6,91,251,112,134,116,168,146,
+251,23,129,25,78,249,85,7,185,247,106,5,35,6,97,251,15,5,129,135,117,132,
+127,27,251,164,6,206,247,209,5,247,35,6,152,159,131,130,136,31,124,46,5,235,
+6,202,247,181,5,41,6,112,53,5,127,135,119,133,126,27,251,31,6,201,247,177,
+5,247,124,6,154,155,135,127,31,35,247,0,7,252,214,186,21,76,251,187,5,251,
+100,6,14,248,205,28,6,30,247,162,21,192,29,192,247,150,5,254,230,47,6,194,
+135,182,137,139,26,165,138,149,123,128,126,253,51,253,145,24,248,19,10,104,
+146,150,151,247,119,247,152,24,247,215,6,83,251,146,247,255,29,252,236,250,
+3,21,52,252,24,5,251,144,6,14,250,38,65,10,250,89,28,4,132,34,29,250,38,65,
+10,250,133,250,250,80,29,252,16,249,152,28,4,141,21,244,74,247,21,251,36,
+94,84,122,117,92,30,206,247,222,5,51,6,251,117,100,5,94,7,247,9,128,251,50,
+253,146,5,103,205,220,116,234,27,247,197,235,247,142,247,37,31,251,76,135,
+21,251,43,38,251,64,51,98,115,161,160,122,30,215,248,4,5,170,178,188,164,
+176,27,172,176,98,36,31,14,140,69,29,247,28,28,4,124,47,29,140,69,29,150,
+253,184,95,10,140,69,29,251,147,254,77,65,29,140,249,240,248,130,21,251,21,
+6,251,33,253,93,85,29,247,199,249,232,149,10,140,247,78,10,166,247,28,5,247,
+154,6,166,247,27,5,251,157,6,195,247,172,5,251,32,247,48,29,117,251,17,5,
+251,46,6,113,251,27,5,247,45,6,251,82,254,140,122,29,212,250,21,28,5,19,247,
+0,29,247,93,253,42,149,10,140,247,78,10,139,168,247,32,165,217,30,172,225,
+186,220,213,164,239,251,25,24,203,151,247,17,168,157,233,8,207,152,71,210,
+251,31,27,251,91,251,74,82,251,64,36,31,86,49,119,92,120,45,251,76,254,95,
+24,139,247,115,36,247,40,248,105,247,41,248,54,247,136,30,247,60,29,14,247,
+113,28,4,222,249,17,247,96,29,251,0,252,210,5,251,176,251,107,251,116,251,
+197,251,177,26,251,78,247,39,251,88,247,189,247,19,243,159,174,221,30,247,
+19,7,116,82,61,128,84,27,251,124,67,247,62,247,35,247,40,222,247,102,247,
+16,247,57,31,46,252,135,122,29,140,247,78,10,247,9,248,232,252,225,252,108,
+247,84,251,50,251,50,253,226,122,29,207,248,189,28,5,82,21,151,141,153,157,
+159,27,247,152,247,230,29,253,168,6,251,160,28,250,105,5,75,237,247,17,100,
+247,152,10,247,158,251,221,247,70,29,203,28,4,213,28,5,166,21,55,6,82,108,
+251,33,134,90,27,252,142,251,128,251,139,252,122,41,31,121,51,114,47,49,26,
+251,148,247,56,251,42,247,146,247,252,247,159,247,185,247,249,247,150,251,
+56,247,33,251,146,251,21,251,19,84,69,34,30,247,17,247,162,247,95,139,247,
+83,158,247,53,153,247,46,164,227,247,111,8,252,56,253,185,21,251,64,33,252,
+21,251,116,251,21,107,247,58,239,247,64,247,0,248,29,247,111,247,23,172,251,
+66,39,30,14,251,10,250,31,247,250,133,29,14,251,10,176,250,24,21,247,77,6,
+251,18,253,8,247,176,29,248,73,29,196,247,171,5,247,119,247,16,251,93,6,168,
+247,34,5,251,164,6,110,251,34,5,251,102,6,248,226,253,44,247,38,10,14,205,
+250,216,247,250,21,247,60,251,30,244,251,150,121,110,135,130,113,30,214,248,
+17,5,253,2,6,83,251,160,5,247,32,6,188,247,29,5,166,147,151,143,160,27,247,
+50,6,251,17,253,7,5,135,119,136,120,123,26,251,50,247,60,55,247,71,247,148,
+247,105,248,131,29,94,251,19,41,130,251,2,153,247,13,151,137,154,141,155,
+30,139,182,247,97,145,174,30,151,157,172,155,160,27,247,23,149,84,251,1,31,
+14,248,15,28,5,125,248,165,29,118,113,135,133,110,30,209,247,227,5,252,134,
+6,149,207,5,251,31,248,146,29,251,54,253,248,5,247,167,6,247,53,249,238,5,
+247,116,6,251,9,252,222,5,135,119,139,123,120,26,251,48,247,58,53,247,72,
+247,146,247,107,248,131,29,92,251,19,41,133,251,5,153,247,13,155,139,160,
+143,159,30,139,178,247,85,145,172,30,151,158,174,155,157,27,247,23,151,86,
+251,3,31,14,247,245,84,29,14,247,245,84,29,249,26,250,103,41,10,178,250,205,
+249,214,21,237,51,231,251,131,252,75,251,148,252,31,251,161,251,74,247,5,
+251,95,247,224,247,146,247,172,247,11,247,140,246,51,208,251,15,164,30,247,
+26,184,247,12,233,247,44,26,251,160,128,21,251,90,251,33,83,251,54,30,88,
+37,5,141,196,207,143,163,27,238,202,96,43,251,72,251,54,63,251,6,46,100,247,
+4,247,48,247,105,247,56,248,3,247,66,247,1,143,87,88,31,14,247,132,58,10,
+14,251,118,250,59,28,5,169,21,228,74,210,251,119,30,252,37,78,6,178,136,179,
+136,139,26,155,138,147,135,136,126,251,30,253,32,24,122,136,132,137,124,27,
+139,98,136,96,135,30,78,248,28,7,247,149,247,57,221,247,88,236,70,184,251,
+7,159,31,247,11,178,230,204,247,12,26,251,96,130,21,251,5,48,57,251,24,133,
+126,139,140,124,30,202,247,189,5,151,153,141,154,27,219,212,113,60,31,115,
+252,26,21,251,23,33,73,251,49,125,118,139,140,121,30,206,247,212,5,142,165,
+164,140,162,27,232,221,112,38,31,14,125,247,118,10,251,52,253,119,24,137,
+123,125,132,112,137,8,248,105,10,247,72,239,247,134,247,1,67,198,251,8,166,
+31,247,17,188,233,217,247,25,248,17,10,247,249,5,162,180,141,161,27,244,202,
+112,248,155,10,51,251,39,30,96,6,207,247,218,248,168,29,247,132,58,10,203,
+28,5,15,47,29,247,132,58,10,106,252,253,95,10,247,132,58,10,251,191,253,146,
+65,29,247,132,247,103,29,251,37,253,124,24,251,70,6,110,251,29,5,247,72,6,
+98,251,97,5,139,29,184,247,127,5,247,207,6,168,247,29,5,251,207,6,169,247,
+54,248,31,29,14,251,97,250,62,28,5,163,21,234,71,210,251,89,30,252,68,78,
+6,172,138,180,135,139,26,162,138,144,132,136,123,84,251,151,24,251,28,39,
+247,7,6,78,251,182,137,126,128,133,117,137,25,139,106,138,104,137,30,78,248,
+42,7,247,138,247,51,228,247,52,190,95,182,82,171,31,247,38,239,251,71,6,221,
+183,218,202,215,26,251,125,252,33,21,251,14,38,67,251,36,30,70,6,203,247,
+200,5,225,6,222,220,115,49,31,165,248,22,21,34,64,72,251,23,30,91,6,199,247,
+175,5,192,6,235,184,97,70,31,14,125,247,118,10,76,251,182,24,251,61,251,13,
+247,35,6,68,251,220,137,123,125,132,112,137,25,248,105,10,247,70,247,0,247,
+86,202,88,190,70,178,31,247,80,247,13,251,119,6,238,193,232,214,231,248,17,
+10,247,241,5,225,6,244,202,122,248,155,10,58,251,39,30,96,6,207,247,211,248,
+168,29,247,208,28,5,55,250,230,21,247,41,39,247,11,251,238,30,252,191,6,247,
+62,29,251,101,254,189,5,111,133,127,135,118,248,117,10,248,29,247,146,247,
+29,247,218,247,54,35,214,251,70,172,31,247,74,205,247,31,247,0,247,91,26,
+251,203,248,124,29,116,139,141,119,30,235,248,132,5,157,162,141,159,27,247,
+17,247,5,248,156,10,251,58,251,2,251,131,118,106,139,141,111,30,243,248,170,
+5,143,176,180,141,174,27,247,33,247,21,94,251,60,31,14,248,75,28,5,141,248,
+99,21,247,54,32,214,251,69,172,30,248,152,29,248,92,29,247,14,129,170,136,
+144,126,136,124,25,48,252,101,5,251,149,132,251,93,251,19,251,106,26,66,174,
+55,243,229,203,214,209,169,30,251,23,247,16,5,247,9,159,247,11,146,244,27,
+39,252,145,5,111,135,127,135,116,27,114,137,101,137,73,132,8,37,248,240,7,
+248,30,247,147,247,29,247,218,31,253,96,251,243,21,101,94,140,139,31,247,
+0,248,177,5,247,34,6,245,247,23,95,251,60,251,111,251,54,251,3,251,134,31,
+237,249,34,21,117,110,142,139,31,235,248,131,5,152,148,141,181,27,247,15,
+247,4,96,251,23,251,82,251,33,251,28,251,95,31,14,247,92,242,250,111,21,247,
+54,251,71,251,20,253,28,247,254,10,247,112,228,247,171,194,31,247,191,198,
+251,150,243,248,44,10,247,20,249,21,5,247,120,254,148,247,63,29,247,103,247,
+26,10,247,112,228,247,171,194,31,247,191,198,251,150,243,248,44,10,229,248,
+98,247,163,29,251,152,253,36,247,63,29,247,103,247,26,10,247,64,247,31,247,
+171,194,31,247,172,195,251,81,247,60,248,44,10,211,248,3,247,163,29,251,189,
+253,0,21,251,97,98,251,4,39,251,128,119,116,141,123,27,247,17,249,6,5,143,
+165,180,144,160,27,247,62,247,5,51,251,136,91,31,14,247,46,28,4,152,248,156,
+21,247,111,251,81,247,19,251,203,108,96,135,137,106,30,209,247,246,128,10,
+251,19,128,5,35,248,150,7,248,5,247,228,233,248,62,31,251,206,131,247,62,
+10,247,46,247,49,28,4,213,21,247,84,6,251,104,254,201,135,247,225,10,248,
+150,7,248,5,247,228,233,248,62,247,111,251,81,247,19,251,203,108,96,135,137,
+106,31,213,248,13,5,247,120,247,29,251,93,6,170,247,52,5,251,185,6,107,251,
+52,5,251,111,6,249,85,253,242,247,62,10,247,249,28,5,78,248,152,21,247,109,
+251,81,247,25,251,205,108,98,135,137,105,30,208,247,246,248,140,29,247,30,
+149,5,243,253,218,7,61,252,29,248,169,10,221,247,121,5,172,149,151,147,164,
+27,247,11,6,167,147,129,108,133,31,251,99,254,174,133,247,225,10,248,150,
+7,248,1,247,234,231,248,60,31,251,206,155,21,251,143,33,251,56,251,166,30,
+118,117,141,120,27,247,17,249,2,5,143,166,182,144,157,27,247,31,229,79,251,
+50,31,14,248,17,28,5,102,248,152,21,247,111,251,82,240,251,207,106,98,137,
+134,104,30,186,247,128,5,247,60,6,170,139,127,110,141,31,141,251,21,5,247,
+41,6,197,247,175,5,252,23,6,153,208,145,166,164,155,161,141,25,247,19,150,
+5,243,252,248,35,7,241,128,164,137,157,123,133,112,25,125,70,5,252,21,6,81,
+251,175,248,169,10,192,247,21,5,168,154,143,151,169,27,247,58,6,251,70,254,
+29,248,137,29,251,21,128,5,35,248,152,7,247,244,247,244,239,248,52,31,251,
+205,149,21,251,135,251,13,251,58,251,152,30,119,116,141,123,27,247,8,248,
+230,5,141,166,182,143,160,27,247,33,231,104,251,50,31,14,249,163,79,10,14,
+249,163,79,10,249,35,28,4,191,41,10,221,250,204,248,39,21,179,247,141,251,
+11,247,47,251,109,167,247,19,170,247,55,236,177,247,78,8,247,99,181,251,7,
+247,52,251,127,27,251,231,251,92,251,198,251,174,81,31,251,140,28,251,59,
+135,120,120,111,116,137,25,251,1,128,5,42,248,232,236,7,251,41,150,5,125,
+128,157,170,145,31,247,157,28,5,21,5,247,98,180,200,247,69,247,34,27,223,
+175,251,11,251,15,114,31,101,251,78,88,48,251,81,141,129,105,131,98,133,111,
+247,153,144,168,251,98,93,251,99,8,251,133,86,50,109,47,27,105,70,154,174,
+86,31,114,251,18,5,112,184,230,125,198,27,247,99,247,149,209,247,250,197,
+31,14,251,181,248,213,251,110,90,10,251,181,249,197,250,151,90,10,248,116,
+247,30,247,50,21,135,119,118,116,111,137,34,131,24,119,34,5,248,176,6,159,
+244,74,147,111,141,130,162,143,159,25,242,248,178,5,248,96,227,247,86,247,
+4,247,33,27,235,216,108,54,223,31,252,83,252,88,247,247,251,54,213,50,112,
+251,31,25,251,19,115,53,57,251,17,27,96,88,159,163,106,31,127,148,125,159,
+141,155,146,247,74,24,251,57,6,78,251,215,5,139,247,54,53,247,60,247,240,
+247,88,247,105,247,97,178,30,183,247,124,53,230,251,217,247,43,248,65,248,
+67,24,223,251,96,251,29,172,251,78,27,252,38,251,157,251,100,252,115,48,31,
+14,35,59,29,14,35,59,29,14,252,94,249,89,28,5,29,212,10,38,28,6,148,212,10,
+35,59,29,243,248,159,34,29,35,59,29,240,247,148,44,29,35,59,29,247,65,248,
+243,48,29,35,59,29,56,248,101,47,29,35,59,29,243,248,159,112,29,252,3,28,
+249,166,54,29,35,247,34,247,9,10,249,77,250,252,192,10,35,250,1,247,89,21,
+251,21,6,56,252,52,85,29,247,20,250,211,192,10,35,109,248,211,21,251,16,241,
+7,136,110,138,111,110,26,247,58,29,153,140,161,142,167,31,247,110,247,16,
+251,89,6,170,247,17,206,247,35,247,33,170,247,5,251,51,24,247,46,182,247,
+0,188,205,65,225,251,54,251,203,251,99,251,85,251,148,67,31,14,35,59,29,204,
+247,107,247,161,29,251,6,250,101,249,250,21,205,67,227,251,52,251,211,251,
+111,251,130,251,180,77,30,47,252,83,5,131,96,135,94,92,26,251,127,247,3,251,
+48,247,137,247,85,247,56,233,247,40,229,30,137,247,74,5,251,101,251,72,38,
+77,39,27,251,21,126,247,26,247,19,206,146,199,151,192,31,229,248,80,147,178,
+166,239,196,209,25,180,190,203,186,198,166,247,3,251,68,24,247,17,196,202,
+225,31,14,251,6,28,4,115,28,4,119,21,202,79,184,251,4,251,77,88,37,251,23,
+92,30,133,96,143,141,133,31,251,167,149,251,180,251,203,251,248,26,251,128,
+247,2,251,48,247,138,247,84,247,15,215,247,56,247,21,30,137,247,76,5,251,
+115,251,74,43,92,36,27,251,19,127,247,25,247,19,192,147,247,48,201,247,17,
+31,204,171,207,228,229,27,242,251,44,5,247,88,145,237,190,166,123,201,82,
+157,31,227,155,180,223,174,27,235,251,15,5,198,151,195,164,215,26,14,251,
+6,250,44,249,240,21,231,75,211,251,80,251,255,251,131,251,197,251,249,251,
+70,202,251,8,247,11,83,30,108,53,110,39,121,45,8,247,64,6,153,225,166,223,
+157,212,8,211,6,247,105,247,74,247,17,247,83,235,39,198,47,251,31,34,51,251,
+4,72,31,124,182,133,186,188,26,221,184,248,9,247,117,171,30,247,5,251,51,
+5,247,68,157,156,217,190,26,251,118,252,224,21,57,39,70,63,30,133,88,147,
+135,27,217,171,205,247,11,241,27,166,149,106,118,31,14,252,92,249,93,28,5,
+21,21,194,97,182,251,14,251,128,251,47,251,75,251,106,32,180,70,216,105,30,
+119,88,120,79,127,82,8,247,4,6,148,191,157,189,151,183,8,185,6,247,31,247,
+10,214,247,7,196,74,175,79,49,71,86,72,95,31,129,164,136,168,168,26,188,168,
+247,116,247,38,158,30,213,44,5,247,6,150,150,185,170,26,251,39,251,245,21,
+90,74,98,90,30,135,106,143,136,27,186,160,182,211,205,27,157,145,119,126,
+31,14,35,250,46,249,15,193,29,252,85,249,94,28,4,142,21,247,32,67,232,251,
+56,251,16,45,88,60,67,30,251,15,7,247,25,247,12,201,167,208,27,224,145,59,
+64,89,118,251,105,251,41,110,31,64,235,5,40,112,74,109,100,185,87,245,247,
+147,247,40,247,76,247,104,31,14,35,248,177,242,10,213,247,168,156,221,31,
+251,27,116,5,120,55,71,251,145,180,10,248,17,250,33,193,29,183,250,193,249,
+1,247,11,10,247,244,29,30,251,187,147,21,69,129,67,122,71,30,186,101,79,168,
+70,27,56,59,101,80,80,31,247,161,146,247,38,247,140,247,14,248,135,10,251,
+6,252,4,247,234,10,14,35,163,29,14,35,163,29,247,222,252,0,240,29,239,248,
+95,250,80,21,251,125,251,48,251,3,251,144,251,84,225,251,36,247,23,251,2,
+31,247,97,6,251,113,247,76,92,235,244,26,247,23,247,25,149,247,17,223,247,
+246,106,251,121,188,30,251,52,251,7,5,251,45,247,1,98,188,205,225,210,247,
+54,248,29,251,198,247,120,251,246,30,14,68,250,171,250,91,21,176,251,9,49,
+159,251,7,27,251,246,251,208,251,154,252,3,251,107,247,15,251,97,247,232,
+247,58,247,70,199,139,31,188,247,142,5,251,35,6,71,251,54,135,127,129,130,
+127,133,25,137,133,69,129,92,27,251,56,63,247,1,247,145,174,31,248,15,6,162,
+247,9,5,252,13,6,247,142,202,247,27,244,247,30,27,192,202,118,129,160,31,
+145,135,147,126,137,123,137,251,23,24,247,37,6,14,68,111,29,14,68,111,29,
+174,249,103,41,10,247,179,55,10,14,247,179,55,10,14,174,250,218,250,82,21,
+178,251,25,44,166,251,15,27,252,60,251,145,251,216,251,195,251,92,247,10,
+251,114,247,255,247,41,247,23,178,166,225,31,191,247,170,5,251,30,6,62,251,
+88,134,131,133,130,127,137,25,133,121,73,125,94,27,251,21,251,42,223,247,
+105,247,224,247,130,247,94,247,85,186,216,117,131,158,31,149,135,145,126,
+129,26,137,251,62,5,247,27,6,14,247,179,55,10,104,249,214,34,29,247,179,55,
+10,101,248,203,44,29,247,179,55,10,173,250,42,48,29,247,179,55,10,251,114,
+249,156,47,29,247,179,55,10,252,114,28,251,88,130,29,248,79,28,7,234,34,29,
+247,179,247,234,247,9,10,250,106,28,6,41,141,29,247,179,249,37,4,244,6,134,
+103,137,103,103,26,251,171,247,44,251,195,248,97,247,84,247,58,190,176,244,
+30,202,248,7,247,114,10,184,142,183,144,181,31,247,192,247,21,251,166,6,247,
+208,227,247,136,247,72,247,100,27,247,222,29,203,247,252,5,190,251,54,251,
+15,174,251,49,27,252,77,251,188,251,179,251,226,43,31,251,24,6,14,247,179,
+192,247,13,29,247,160,251,134,141,29,247,179,28,7,55,28,6,41,21,213,45,231,
+59,251,109,251,95,34,251,156,103,30,172,251,38,112,139,60,166,29,203,247,
+252,5,247,39,164,180,247,42,206,27,247,68,251,91,5,199,160,210,200,215,26,
+14,247,28,249,161,248,178,21,165,247,17,5,252,34,6,143,179,146,177,147,176,
+8,248,29,6,160,247,17,5,252,13,6,247,132,230,247,62,247,27,247,45,27,191,
+228,106,127,158,31,247,147,29,251,220,251,127,251,113,251,171,251,0,31,251,
+106,6,118,251,17,5,247,89,6,130,101,131,100,135,101,8,251,45,6,112,251,17,
+5,247,65,6,251,169,141,247,22,251,190,248,25,27,247,56,247,33,190,176,228,
+31,192,248,7,5,251,22,6,55,251,162,134,124,131,123,121,137,25,127,118,65,
+120,89,27,251,41,251,53,247,15,247,203,31,155,7,14,247,28,28,4,145,250,73,
+21,253,132,52,6,186,135,176,137,139,26,156,144,129,128,137,31,81,251,183,
+5,47,164,55,216,247,52,26,247,207,247,106,247,74,247,66,181,209,118,132,156,
+30,148,135,144,127,129,26,143,251,9,5,247,14,6,180,247,104,5,176,251,12,53,
+165,251,2,27,252,18,251,120,251,190,251,180,251,72,234,251,81,247,179,119,
+31,78,251,201,136,123,128,127,121,137,25,139,104,137,90,135,30,52,249,147,
+7,194,247,148,5,251,2,6,107,251,18,5,120,136,120,129,120,27,251,201,6,206,
+247,227,5,247,42,6,148,155,131,129,137,31,123,36,5,242,6,205,247,225,5,37,
+6,112,51,5,123,136,122,134,121,27,251,30,6,196,247,203,5,247,149,6,155,148,
+130,128,31,251,18,242,7,14,247,28,250,219,249,24,21,181,105,199,64,67,67,
+96,86,88,30,157,235,5,40,6,251,129,91,5,90,7,247,12,125,38,252,122,5,53,203,
+74,247,12,247,85,26,248,111,247,159,247,173,247,113,191,228,106,127,158,30,
+247,147,29,252,97,251,168,252,72,252,58,251,171,247,21,251,195,248,28,247,
+56,247,33,190,176,228,31,180,247,205,5,251,22,6,67,251,104,134,124,131,123,
+121,137,25,119,127,73,122,89,137,207,247,208,24,156,225,214,223,229,184,177,
+61,24,237,178,172,205,31,14,247,28,250,36,28,5,242,21,251,12,6,109,251,44,
+5,252,62,106,251,145,252,33,252,21,26,251,131,242,251,149,247,196,89,30,96,
+251,110,5,247,12,6,180,247,101,247,54,140,247,32,186,227,174,247,236,29,128,
+118,65,121,89,27,129,130,139,140,129,31,247,118,250,255,190,132,203,116,155,
+129,25,156,133,150,116,137,123,137,251,110,24,247,21,6,193,247,235,251,8,
+180,47,169,33,147,25,252,177,253,217,21,248,26,247,90,247,145,247,88,201,
+30,251,108,254,206,5,41,194,59,247,10,247,96,26,14,247,179,28,5,127,28,5,
+41,21,190,251,54,251,15,174,251,49,247,249,10,221,219,149,153,209,31,62,252,
+96,247,122,189,247,33,249,225,226,29,14,247,132,250,254,247,235,21,57,36,
+79,94,251,106,27,103,104,141,143,108,31,247,20,247,179,174,214,145,174,91,
+232,25,251,82,247,253,5,248,112,6,247,54,247,65,115,200,5,252,222,6,251,218,
+251,193,5,251,12,251,5,55,251,37,251,82,26,251,87,247,52,252,25,248,170,247,
+14,247,76,176,139,30,247,61,247,164,5,253,88,101,21,251,100,208,53,247,59,
+247,62,26,247,65,157,172,229,237,30,247,128,252,96,166,85,127,94,128,111,
+25,14,248,24,250,236,248,86,21,251,58,111,45,251,113,251,99,27,251,78,251,
+56,247,69,248,74,31,141,247,221,7,247,171,247,17,251,27,222,27,236,6,163,
+168,161,186,205,34,197,251,113,31,253,18,6,247,255,158,247,83,247,26,247,
+54,27,247,59,247,13,251,119,251,9,156,31,247,179,6,247,124,114,251,216,247,
+93,251,151,27,251,172,252,67,251,37,252,188,252,66,247,231,251,115,247,231,
+248,57,247,85,247,124,247,138,166,31,14,247,179,129,10,14,94,248,121,250,
+31,21,247,50,228,251,12,251,65,251,131,251,34,251,175,251,173,105,108,151,
+146,125,31,136,141,128,153,138,143,142,247,74,24,251,25,6,83,251,166,5,120,
+181,247,4,94,247,47,27,247,236,247,192,247,168,247,248,247,138,251,67,247,
+63,251,149,251,5,41,119,102,251,23,31,84,251,162,5,247,21,6,200,247,49,145,
+155,161,153,150,142,25,151,179,169,147,172,27,14,247,179,248,21,29,251,25,
+102,90,251,29,30,96,251,242,5,247,46,6,217,247,140,145,155,149,153,159,143,
+25,150,166,225,157,247,208,29,182,151,116,31,119,146,127,163,141,158,161,
+247,129,24,251,43,6,57,252,4,5,87,247,53,247,13,92,248,95,29,14,247,179,129,
+10,252,238,251,21,240,29,247,173,28,5,133,28,5,51,21,188,251,52,251,12,166,
+251,42,27,252,154,252,3,252,19,252,142,251,183,247,52,251,152,248,74,247,
+118,247,129,217,139,31,205,247,226,5,251,46,6,45,251,117,133,122,124,125,
+119,133,25,135,133,38,120,62,27,251,109,251,36,247,23,247,169,180,143,182,
+145,188,31,248,175,6,168,247,23,5,252,177,6,248,3,233,247,118,247,39,247,
+102,27,238,231,106,127,164,31,155,131,145,116,123,26,135,251,72,5,247,50,
+6,14,247,177,108,29,14,247,177,108,29,32,249,253,41,10,209,45,29,14,209,45,
+29,14,251,215,249,244,28,6,154,131,29,98,28,8,17,131,29,209,45,29,247,148,
+250,94,47,29,209,45,29,174,28,250,225,44,29,209,45,29,247,23,254,106,95,10,
+209,45,29,251,27,254,255,65,29,209,45,29,251,0,254,193,57,29,248,75,45,29,
+249,178,249,7,81,10,209,28,4,143,28,5,229,21,188,10,236,182,195,212,31,77,
+162,198,102,242,27,172,204,148,155,176,31,112,251,25,86,251,54,57,127,251,
+35,247,21,24,67,247,245,10,195,80,247,29,247,178,213,247,121,247,124,186,
+30,172,247,62,5,248,104,29,251,54,249,3,82,29,209,90,29,14,209,90,29,218,
+254,210,21,160,247,24,5,253,123,6,116,251,24,5,14,247,68,28,5,135,28,5,18,
+21,251,23,6,90,119,79,100,86,27,127,126,139,141,127,31,192,247,189,5,247,
+197,10,129,83,5,123,124,139,137,123,31,251,33,125,36,51,68,251,17,8,247,23,
+6,188,159,196,178,193,27,167,164,135,135,159,31,115,251,42,226,10,247,50,
+250,9,247,41,151,246,236,208,247,12,25,253,25,252,127,82,29,247,199,28,5,
+62,248,48,29,111,170,151,193,25,247,124,28,5,24,182,10,236,182,195,212,31,
+72,156,219,107,237,247,39,10,253,76,125,82,29,246,28,5,246,28,5,86,21,248,
+2,10,120,47,123,247,87,29,77,162,198,102,242,27,245,247,25,184,180,211,248,
+32,29,247,43,249,234,5,247,209,10,253,138,252,195,21,47,252,167,5,247,204,
+29,182,49,129,135,31,14,209,28,4,184,251,207,21,248,26,10,160,213,153,213,
+31,247,162,28,5,241,182,10,209,164,192,213,31,139,112,251,45,248,58,10,30,
+252,74,250,246,82,29,246,250,207,250,162,21,247,209,10,248,2,10,117,47,126,
+247,87,29,119,81,126,251,8,248,58,10,248,26,10,142,213,152,213,31,251,114,
+247,180,21,247,204,29,179,50,128,138,31,14,247,63,28,5,12,247,164,21,215,
+57,221,39,69,141,133,118,70,30,247,86,250,230,5,247,197,10,78,251,247,5,248,
+62,10,251,50,218,251,66,247,81,107,31,134,159,162,137,163,27,100,86,107,82,
+108,79,247,33,86,24,209,247,15,213,247,5,214,225,8,71,166,225,108,247,25,
+27,247,107,247,64,247,9,247,72,31,251,74,121,21,55,84,67,59,110,131,166,202,
+148,141,169,147,186,30,152,166,206,176,166,27,188,131,102,106,31,251,232,
+248,189,82,29,209,249,185,250,123,21,230,10,247,127,28,5,45,5,253,168,6,74,
+251,227,248,169,10,204,247,71,5,162,148,158,155,164,27,247,145,6,167,146,
+125,108,133,31,43,252,176,82,29,248,221,28,4,143,28,5,229,21,188,10,236,182,
+195,212,31,75,237,226,104,247,152,10,251,181,251,43,159,29,248,191,251,70,
+247,70,29,250,200,45,29,28,5,129,247,48,248,220,10,250,200,45,29,28,5,129,
+247,48,55,29,249,89,28,5,11,48,29,249,5,165,29,247,111,6,139,190,202,207,
+30,165,247,52,51,247,31,27,247,83,247,56,247,52,248,167,29,127,31,247,13,
+251,23,5,108,120,55,111,111,27,92,98,165,178,67,31,251,21,112,5,247,191,249,
+3,21,252,35,252,95,227,248,132,5,147,145,141,145,27,186,180,112,100,213,31,
+252,99,162,247,84,29,249,5,165,29,247,127,6,201,205,184,169,192,135,219,113,
+25,94,251,1,110,49,117,251,21,8,247,64,6,155,219,162,223,173,235,8,125,180,
+164,130,182,27,247,115,247,19,247,9,247,58,213,33,225,61,251,40,251,17,49,
+251,7,57,31,251,23,123,5,247,214,248,250,21,252,29,252,66,221,248,103,5,145,
+155,151,145,160,27,247,25,63,5,247,185,252,199,21,70,124,115,106,73,27,107,
+110,159,176,116,31,209,172,184,186,203,27,165,170,112,94,129,31,253,136,248,
+222,247,84,29,248,218,28,6,197,250,50,21,251,40,247,49,5,51,72,75,98,45,27,
+41,57,195,147,40,31,225,248,127,182,10,217,174,203,209,31,125,65,5,247,53,
+6,159,150,247,35,247,167,235,27,247,40,212,251,19,251,31,251,87,251,80,251,
+70,251,37,94,104,149,172,96,31,79,247,60,5,157,111,126,154,84,27,55,72,73,
+49,251,54,247,70,88,247,121,247,216,247,215,247,87,247,195,247,109,251,29,
+247,37,251,119,166,31,247,49,248,9,21,251,248,251,204,207,247,255,5,112,212,
+170,110,227,27,176,170,139,144,167,31,252,205,155,82,29,248,113,28,4,143,
+28,5,229,21,188,10,247,4,186,212,226,31,47,206,239,111,247,16,248,149,29,
+193,247,167,5,247,128,10,103,180,247,8,162,31,251,67,248,180,82,29,199,101,
+10,199,101,10,251,186,249,149,28,5,191,21,199,192,180,197,198,62,200,251,
+60,251,4,251,54,69,251,6,72,224,87,216,72,31,251,71,87,251,80,38,251,90,26,
+251,36,247,39,84,247,30,247,50,247,135,247,8,247,117,30,247,148,251,232,209,
+234,26,200,205,154,188,170,159,134,114,168,30,159,42,5,132,149,167,136,151,
+27,251,7,252,6,21,251,34,56,251,14,251,17,78,101,186,233,247,39,247,3,244,
+247,4,188,30,186,90,176,83,66,26,14,251,253,249,196,28,6,50,21,104,209,251,
+54,82,67,235,251,113,109,133,97,244,115,182,83,251,67,78,173,65,247,79,208,
+150,117,155,107,152,109,25,141,130,130,140,131,27,251,128,251,26,251,85,251,
+86,251,33,229,41,247,66,247,183,218,247,131,247,30,247,20,76,247,47,77,240,
+31,80,252,23,21,251,42,63,251,48,46,115,70,182,247,25,247,36,212,247,66,247,
+15,159,148,131,132,149,30,156,90,149,91,63,26,14,248,7,46,29,14,251,32,250,
+164,28,5,14,21,247,118,251,69,228,251,167,30,251,238,78,6,176,136,178,136,
+139,26,156,138,149,136,136,125,251,30,253,32,24,135,122,135,137,118,138,8,
+139,98,137,100,135,30,78,247,233,7,248,11,247,121,247,108,247,185,31,251,
+92,150,21,251,127,251,38,251,98,251,127,136,30,72,6,247,36,249,55,5,157,6,
+247,30,135,247,40,114,251,94,26,14,247,15,247,98,29,251,54,253,123,24,135,
+119,129,134,110,137,8,247,68,29,247,56,249,150,248,83,10,248,7,46,29,247,
+58,250,137,48,29,248,7,46,29,49,249,251,47,29,248,7,46,29,251,175,28,250,
+166,44,29,248,7,46,29,251,79,254,165,95,10,248,7,46,29,252,89,28,251,90,65,
+29,248,7,46,29,252,62,254,252,57,29,248,7,75,29,248,7,75,29,247,15,247,98,
+29,76,251,180,24,251,56,251,21,247,28,6,68,251,218,135,119,129,134,110,137,
+25,247,68,29,211,247,232,5,247,112,247,21,251,84,6,203,247,193,248,83,10,
+248,69,28,5,205,249,228,21,248,13,251,167,247,41,252,58,30,252,131,6,247,
+99,29,158,135,127,137,31,251,105,254,208,133,111,126,135,106,137,25,139,78,
+134,84,135,30,37,248,160,7,248,214,248,81,29,251,120,251,236,251,250,135,
+30,34,6,247,116,250,248,5,165,6,247,103,133,247,122,98,251,230,26,14,247,
+134,249,116,247,16,21,135,98,111,137,97,27,251,51,251,2,221,247,34,247,75,
+239,247,22,247,113,194,205,135,133,182,31,247,244,252,179,21,251,22,150,112,
+141,130,142,145,170,25,247,104,250,204,143,161,151,149,154,140,25,247,33,
+149,5,241,254,150,7,73,251,228,248,169,10,207,247,77,5,159,147,158,156,160,
+27,247,218,6,168,146,109,121,134,31,51,252,85,5,146,87,92,142,76,27,251,208,
+251,219,47,251,219,251,100,247,9,251,38,248,98,31,248,193,6,14,28,5,97,46,
+29,28,5,84,236,248,220,10,28,5,97,46,29,28,5,84,236,55,29,249,51,28,5,11,
+48,29,28,6,72,46,29,28,6,115,248,144,248,209,29,28,6,72,46,29,28,6,115,248,
+144,248,217,10,247,87,194,248,54,21,251,171,86,247,51,251,31,248,63,27,248,
+170,243,6,36,150,115,141,122,155,144,166,25,247,98,250,178,247,17,10,247,
+208,22,248,34,29,251,13,253,2,5,123,116,137,117,27,251,84,42,235,247,97,178,
+31,14,249,220,249,168,211,21,89,181,247,27,84,247,31,248,118,29,153,207,143,
+157,150,149,164,142,25,247,23,151,5,247,174,10,154,132,134,115,120,32,24,
+251,56,108,251,4,248,10,29,247,66,250,7,247,17,10,251,171,86,247,35,251,41,
+247,255,27,227,247,0,170,190,223,31,252,53,247,238,21,248,34,29,251,9,252,
+235,5,121,114,81,122,107,27,251,56,64,245,247,97,178,31,14,247,112,247,104,
+10,248,7,28,5,143,249,228,203,29,251,239,251,253,138,30,35,6,177,247,84,5,
+145,6,247,177,247,71,247,107,247,140,247,55,32,247,1,251,69,124,125,138,138,
+126,31,178,247,91,247,195,10,252,144,219,247,231,29,146,146,140,146,27,14,
+250,180,249,98,247,19,247,202,29,251,112,254,248,5,247,252,251,19,21,248,
+213,247,244,247,252,248,124,248,86,10,31,252,41,6,252,168,252,74,251,150,
+252,188,251,207,247,121,251,141,248,76,31,250,219,249,246,248,73,10,247,113,
+250,248,247,195,10,14,250,180,28,4,155,22,248,213,247,244,247,252,248,124,
+248,86,10,31,252,41,6,252,168,252,74,251,150,252,188,251,207,247,121,251,
+141,248,76,31,250,219,249,246,248,73,10,177,247,84,5,145,6,247,177,247,71,
+247,107,247,140,247,55,32,247,1,251,69,124,125,138,138,126,31,178,247,91,
+247,195,10,254,207,253,119,247,202,29,100,251,90,5,140,126,125,139,124,27,
+251,136,251,73,251,77,251,128,251,56,247,0,251,42,247,105,31,141,6,102,251,
+84,5,62,248,152,21,247,14,218,247,73,247,29,146,146,139,138,146,30,36,252,
+162,5,40,147,104,247,11,236,26,248,187,247,195,247,231,29,140,146,146,139,
+146,27,14,248,56,28,5,176,249,82,21,248,151,29,253,7,6,119,35,247,3,129,162,
+137,159,122,248,125,10,114,137,25,251,7,128,120,35,5,249,19,6,248,153,10,
+251,226,117,236,29,253,5,251,175,235,10,247,60,247,228,21,247,183,10,250,
+239,28,5,23,22,248,153,10,248,151,29,253,21,6,252,103,251,204,251,164,252,
+36,62,31,252,105,50,247,129,251,125,248,70,27,28,4,155,249,60,236,29,28,250,
+101,22,248,107,229,247,143,243,247,103,27,247,21,6,127,75,252,3,132,251,56,
+251,60,78,251,216,25,72,251,243,247,40,251,15,247,214,124,124,57,24,251,62,
+143,251,67,143,251,95,247,5,222,248,74,25,248,208,247,183,21,251,27,49,54,
+251,81,102,31,251,117,97,241,63,247,6,27,152,150,139,140,148,31,125,63,251,
+150,150,84,247,6,181,247,116,25,178,247,94,196,247,70,247,205,137,124,59,
+24,141,123,121,140,119,27,247,130,252,210,235,10,251,225,247,228,21,169,247,
+48,178,161,210,152,67,252,14,24,129,6,99,87,148,247,70,173,31,248,137,22,
+247,183,10,248,104,247,87,249,82,21,218,230,247,39,189,247,37,27,151,150,
+138,138,150,31,82,66,92,54,97,46,92,36,112,251,10,111,38,8,171,104,100,162,
+91,27,251,12,67,67,40,40,220,85,203,229,197,172,218,192,31,77,186,201,84,
+237,27,247,214,247,25,247,103,247,208,247,79,251,17,247,14,251,58,188,31,
+202,208,214,193,231,174,102,186,24,251,13,104,43,75,59,54,8,142,114,114,141,
+113,27,251,60,251,34,84,45,251,8,31,248,48,251,113,21,177,246,185,235,199,
+220,8,247,27,86,196,251,22,251,12,26,251,165,71,251,94,251,114,67,90,203,
+206,87,30,130,151,179,222,181,247,7,193,247,45,25,248,82,253,212,21,208,247,
+59,149,212,175,247,6,8,103,155,218,121,202,27,247,25,221,206,247,5,247,2,
+40,197,41,251,41,73,85,41,107,31,83,251,64,118,251,49,66,251,55,8,247,140,
+248,106,21,202,196,191,209,209,196,87,76,76,82,87,69,69,82,191,202,30,254,
+53,245,21,181,171,98,89,173,31,48,108,101,77,73,27,91,101,189,196,220,178,
+195,213,31,14,33,35,29,14,252,54,248,127,164,21,176,81,231,251,23,251,119,
+251,48,251,105,251,79,251,74,247,17,92,247,8,247,21,247,12,218,185,191,30,
+247,9,7,251,9,251,39,86,100,82,27,64,114,202,224,152,141,161,141,154,31,247,
+69,153,247,98,212,247,21,26,251,65,141,21,64,251,1,80,47,119,30,229,163,187,
+247,14,221,27,180,145,109,111,31,14,252,84,249,101,28,4,246,168,10,45,28,
+6,109,168,10,33,35,29,247,89,247,209,42,10,33,35,29,248,28,247,209,49,29,
+33,35,29,247,213,247,209,71,29,247,111,249,47,34,29,33,35,29,247,213,247,
+209,248,207,29,33,35,29,247,213,247,209,71,29,247,171,249,104,36,10,33,35,
+29,247,213,247,209,248,217,29,33,35,29,251,70,28,251,145,71,10,248,135,28,
+5,172,44,29,33,35,29,247,195,248,37,58,29,33,35,29,247,252,249,31,61,29,33,
+35,29,247,215,248,228,81,29,33,35,29,248,29,249,48,48,29,33,35,29,248,20,
+249,21,36,10,33,35,29,248,4,248,190,80,29,33,35,29,248,4,248,190,248,202,
+10,33,35,29,248,4,248,190,248,199,10,33,35,29,248,8,248,164,41,10,33,35,29,
+247,29,248,162,47,29,33,35,29,247,93,249,17,37,10,33,35,29,131,28,250,221,
+44,29,33,35,29,209,254,109,70,10,33,35,29,251,70,28,251,145,65,29,247,141,
+28,5,43,248,15,21,251,84,251,44,67,71,68,27,93,62,171,247,25,135,31,234,247,
+85,29,247,192,10,247,45,247,36,217,210,234,30,49,167,200,80,220,27,238,232,
+214,247,26,247,23,31,253,21,247,120,29,33,35,29,83,254,166,54,29,33,35,29,
+247,252,249,31,67,10,252,52,28,249,99,54,29,33,249,39,248,65,29,239,234,247,
+76,247,0,31,251,131,67,247,201,29,247,140,28,4,147,142,10,33,28,4,210,242,
+10,213,247,168,248,89,10,65,251,168,180,10,251,178,250,207,142,10,33,35,29,
+247,217,247,168,247,161,29,247,63,28,4,154,248,15,98,29,247,63,248,212,252,
+64,21,248,126,29,152,190,241,236,215,30,104,137,114,133,98,144,8,251,1,62,
+251,2,251,9,123,106,174,82,106,26,108,67,86,139,30,249,21,249,103,98,29,33,
+77,29,33,77,29,33,77,29,252,73,248,108,64,21,247,75,251,18,185,251,7,251,
+22,251,11,61,91,87,30,251,7,7,247,8,247,38,192,179,196,27,213,165,76,54,125,
+137,117,138,125,31,251,70,124,251,98,67,251,22,26,101,198,48,247,22,247,120,
+247,48,247,105,247,79,30,251,91,251,11,21,50,115,91,251,16,57,27,98,133,171,
+167,214,247,1,198,231,158,31,14,252,84,249,91,28,4,145,21,247,75,251,17,186,
+251,9,251,21,251,11,59,92,88,30,251,7,7,247,9,247,37,191,178,198,27,213,163,
+75,53,127,137,118,137,123,31,251,68,125,251,99,67,251,21,26,100,199,49,247,
+23,247,119,247,48,247,105,247,78,30,251,91,251,10,21,49,114,92,251,15,57,
+27,98,133,169,168,215,247,1,196,231,160,31,14,33,137,10,247,240,250,19,41,
+10,247,5,28,5,113,251,171,21,200,107,189,78,168,30,251,86,251,71,5,79,102,
+163,194,247,60,247,34,247,130,150,247,46,31,247,67,151,49,195,251,136,27,
+94,41,247,66,151,175,67,130,33,25,124,251,72,251,21,251,101,251,63,26,251,
+5,234,57,247,36,247,58,247,28,216,247,3,30,252,111,250,44,143,29,14,242,28,
+5,53,249,162,21,45,209,106,59,125,123,133,124,25,121,129,81,88,119,27,83,
+141,196,194,162,31,205,247,52,59,196,63,94,43,84,69,100,25,247,15,61,251,
+23,178,49,27,251,78,251,23,76,251,13,251,3,31,251,66,7,247,10,245,247,48,
+236,242,27,208,166,81,53,167,31,251,182,251,39,251,138,251,120,251,57,26,
+34,221,251,9,247,82,248,3,247,86,247,230,247,204,184,135,180,129,180,30,157,
+149,209,180,156,147,8,132,112,123,98,109,26,63,137,196,71,240,27,247,39,198,
+247,23,221,172,31,253,123,251,74,21,251,70,135,98,251,222,251,85,27,78,135,
+209,182,247,33,247,27,247,40,247,60,245,31,14,154,250,164,248,248,21,247,
+107,251,17,247,89,251,178,251,208,251,103,251,48,251,148,251,8,247,5,65,247,
+52,143,30,247,45,141,213,162,247,21,208,8,251,76,104,68,251,124,251,93,27,
+45,251,29,195,247,70,251,34,31,98,251,83,5,251,6,219,247,19,81,247,70,27,
+248,32,247,141,247,212,247,209,31,251,187,203,21,55,251,39,63,116,76,27,112,
+90,158,204,247,27,223,247,17,247,27,247,19,147,251,39,49,147,31,14,251,39,
+250,62,249,230,115,29,252,113,249,103,28,5,14,21,180,82,203,251,5,30,98,6,
+251,52,251,29,57,36,78,176,104,190,113,31,49,122,49,94,251,4,26,36,229,94,
+247,72,247,21,247,21,213,153,158,30,247,3,7,81,65,47,72,38,27,101,83,157,
+203,223,199,171,194,141,31,172,165,139,137,174,31,211,7,96,141,65,141,219,
+26,211,189,198,202,30,160,115,175,81,170,100,8,247,25,156,127,176,171,26,
+14,251,39,28,4,179,242,10,199,247,109,248,89,10,79,251,109,180,10,251,157,
+250,248,115,29,251,39,250,1,249,171,122,10,252,77,249,65,28,4,236,21,211,
+64,206,251,44,251,13,251,35,103,33,102,176,113,169,193,165,164,145,146,30,
+151,226,5,144,143,180,161,164,27,187,163,108,89,251,1,35,102,61,137,31,78,
+199,7,160,201,138,73,37,55,98,86,93,79,162,247,0,34,31,251,16,7,88,191,203,
+114,219,27,247,68,247,52,196,247,41,198,101,176,51,157,31,231,173,211,202,
+212,26,14,251,39,248,69,242,10,213,247,168,156,221,31,39,247,16,5,120,55,
+36,252,36,180,10,248,80,250,189,122,10,242,28,5,63,249,185,21,45,206,5,94,
+119,81,251,25,76,27,82,143,197,194,161,31,205,247,52,59,196,90,108,34,82,
+74,102,25,211,88,36,192,251,54,27,248,24,29,31,247,74,10,251,24,71,60,247,
+81,10,247,27,194,247,2,240,146,247,8,175,160,187,165,149,146,8,133,112,120,
+98,106,26,65,197,72,239,247,39,199,247,21,223,171,30,14,251,39,249,184,247,
+172,21,247,5,74,210,49,172,30,247,31,168,247,12,202,247,81,26,247,42,251,
+54,235,251,148,251,69,251,60,32,116,110,30,251,74,7,233,247,7,247,21,234,
+247,8,27,220,203,108,251,1,251,29,47,92,53,31,251,18,251,11,6,209,137,247,
+25,127,251,27,26,251,11,43,39,251,12,30,110,178,81,237,92,202,8,251,55,116,
+51,86,71,247,0,33,247,66,31,201,6,247,137,247,123,247,27,247,62,31,14,252,
+113,249,18,250,77,21,207,96,181,81,159,30,229,157,217,176,247,6,26,229,34,
+196,251,59,251,7,251,1,75,125,120,30,251,1,7,196,214,223,196,214,27,192,181,
+120,74,56,79,111,83,31,57,68,6,185,138,225,131,58,26,68,77,79,61,30,120,162,
+101,198,108,177,8,34,124,86,107,99,209,75,247,5,31,179,6,247,51,247,43,220,
+241,31,14,160,250,168,249,54,21,247,82,45,247,52,251,234,251,115,251,119,
+251,25,251,68,67,171,59,247,7,84,30,251,84,102,40,35,251,44,26,251,33,247,
+3,40,247,199,248,48,247,92,248,30,247,197,30,251,98,118,21,251,142,251,85,
+251,205,251,88,59,81,194,244,247,54,247,17,167,207,30,247,15,240,6,251,1,
+141,63,169,247,5,26,247,27,201,242,247,9,216,247,32,75,251,99,30,14,166,250,
+175,249,160,21,247,48,251,48,227,251,78,252,34,251,137,251,201,251,247,251,
+105,241,251,64,247,177,247,150,247,164,236,247,148,247,0,61,188,251,0,162,
+30,247,6,186,247,32,237,247,19,26,251,175,145,21,251,49,251,35,53,251,34,
+137,30,36,7,231,247,19,164,251,25,251,34,251,33,41,57,251,49,87,247,52,247,
+27,247,128,247,68,247,195,247,105,223,164,85,55,31,14,33,247,63,249,183,21,
+81,251,33,230,36,247,1,102,251,39,117,44,65,99,39,8,251,177,251,7,247,194,
+73,247,111,27,247,19,244,158,188,247,44,31,194,247,162,5,251,12,6,83,251,
+35,5,69,111,251,58,123,94,27,251,33,68,241,247,34,197,31,247,4,185,247,7,
+150,182,27,180,227,122,139,31,166,247,31,5,135,80,122,137,131,27,251,13,77,
+238,247,14,189,31,246,183,225,159,190,27,176,247,30,88,102,139,132,251,29,
+141,123,31,247,8,6,188,247,142,5,202,251,25,55,176,251,23,27,251,116,251,
+61,51,251,25,85,31,14,33,100,10,14,33,100,10,203,248,172,41,10,33,171,247,
+113,29,179,245,83,235,75,201,8,247,107,150,247,167,217,247,152,26,239,74,
+213,251,29,161,30,248,47,10,152,10,246,99,223,120,234,133,25,188,89,182,67,
+107,56,248,42,29,124,248,198,247,11,21,120,47,221,99,224,130,8,104,102,83,
+75,125,247,12,29,161,190,156,173,30,220,150,218,166,217,177,137,242,24,248,
+103,29,159,234,166,247,20,50,223,251,29,161,25,197,10,182,247,33,126,251,
+54,107,30,14,248,13,248,230,247,181,21,251,110,100,226,43,247,139,27,247,
+179,247,27,247,95,245,160,31,193,247,167,5,248,143,10,97,100,83,27,75,112,
+179,247,42,166,31,157,237,85,241,251,54,165,8,197,10,238,212,87,251,2,119,
+30,14,247,32,32,29,14,251,183,250,68,28,6,73,21,253,81,78,6,247,240,29,123,
+133,137,119,138,8,139,99,136,99,135,30,78,249,100,7,186,247,106,5,34,6,96,
+251,15,5,129,135,119,132,126,27,251,176,6,205,247,209,5,247,46,6,151,159,
+131,130,136,31,126,46,5,237,6,200,247,181,5,43,6,111,53,5,127,135,119,133,
+125,27,251,42,6,199,247,177,5,247,120,6,154,156,135,127,31,35,244,7,14,78,
+250,158,250,123,21,254,8,47,6,194,135,182,137,139,26,159,145,129,127,137,
+31,251,58,253,130,247,255,29,203,247,162,5,192,29,14,247,32,32,29,251,97,
+248,113,42,10,247,32,32,29,129,248,113,49,29,247,32,32,29,58,248,113,71,29,
+247,111,249,47,34,29,247,32,32,29,58,248,113,248,207,29,247,32,32,29,58,248,
+113,71,29,247,171,249,104,36,10,247,32,32,29,58,248,113,248,217,29,247,32,
+32,29,253,8,28,250,161,71,10,248,183,28,7,60,44,29,247,32,32,29,40,248,197,
+58,29,247,32,32,29,97,249,191,61,29,247,32,32,29,124,249,193,77,10,247,32,
+32,29,130,249,208,48,29,247,32,32,29,121,249,181,36,10,247,32,32,29,105,249,
+94,80,29,247,32,32,29,105,249,94,248,202,10,247,32,32,29,105,249,94,248,199,
+10,247,32,32,29,109,249,68,41,10,247,32,32,29,251,157,249,66,47,29,247,32,
+32,29,251,93,249,177,37,10,247,32,32,29,252,94,28,249,237,44,29,247,32,32,
+29,252,16,28,251,55,70,10,247,32,32,29,253,8,28,250,161,65,29,247,32,32,29,
+252,135,28,250,254,54,29,247,32,32,29,252,135,28,250,254,130,29,248,93,28,
+8,45,61,29,247,32,32,29,251,206,28,250,123,63,10,247,32,142,247,13,29,247,
+79,251,81,108,10,14,78,108,22,250,8,231,6,84,143,96,141,139,26,119,133,149,
+151,141,31,247,58,249,130,143,155,151,152,161,141,25,139,180,141,197,143,
+30,231,254,27,7,75,251,162,5,247,21,6,176,247,25,5,159,143,162,150,161,27,
+247,255,6,61,251,245,5,251,93,6,129,120,147,150,141,31,158,247,0,5,251,13,
+6,61,251,242,5,247,13,6,170,231,5,156,143,159,145,160,27,247,78,6,72,251,
+220,5,251,195,6,120,129,149,150,31,247,25,251,13,7,14,248,232,28,6,132,249,
+150,92,29,248,232,249,46,247,20,21,193,51,241,89,174,56,62,251,219,25,247,
+52,6,201,247,220,181,215,247,64,195,189,227,24,248,38,249,22,92,29,247,22,
+247,181,247,200,10,76,251,220,5,247,39,6,204,247,62,5,160,147,158,157,157,
+27,248,17,6,47,252,117,5,251,136,6,121,129,161,154,31,148,247,31,5,251,19,
+6,47,252,117,5,247,19,6,183,247,31,5,153,145,160,162,155,27,247,136,6,39,
+252,158,5,252,82,6,122,126,163,154,31,149,247,105,5,251,42,6,68,252,11,5,
+250,253,243,6,251,2,149,117,142,118,248,12,10,166,155,163,141,25,247,6,150,
+5,243,7,14,200,247,42,28,5,80,21,251,32,249,70,252,106,253,50,251,32,249,
+50,252,106,253,70,251,32,249,230,28,5,80,7,14,200,247,89,251,77,21,242,98,
+224,247,118,5,248,251,28,5,80,40,6,214,247,88,33,178,50,251,127,5,253,11,
+251,32,248,214,6,251,70,252,106,5,252,16,251,32,247,219,6,251,69,252,106,
+5,251,62,251,32,247,9,6,248,209,248,246,21,252,106,252,38,7,247,71,248,106,
+5,192,247,32,21,247,62,248,84,5,252,84,7,14,251,189,247,195,28,6,73,21,98,
+251,88,5,234,6,182,241,5,151,144,151,150,151,27,247,140,6,79,251,181,5,251,
+51,6,127,133,153,148,31,145,222,5,56,6,79,251,181,5,222,6,168,223,5,147,143,
+152,153,150,27,247,50,6,74,251,205,5,251,182,6,128,131,153,148,31,145,247,
+20,5,42,6,93,251,117,5,249,113,201,6,68,145,125,141,125,149,142,155,25,247,
+23,249,12,142,156,157,148,154,140,25,213,146,5,201,7,14,247,120,28,5,0,250,
+3,21,248,14,251,218,247,42,251,96,251,157,251,39,84,251,40,251,60,30,251,
+117,7,247,41,247,31,247,103,247,36,247,64,27,247,31,247,30,251,79,251,111,
+111,137,112,137,112,31,253,38,129,251,156,251,78,251,204,26,60,246,251,122,
+247,219,248,208,247,123,248,99,248,85,30,251,228,251,124,21,251,199,61,251,
+74,251,138,251,58,27,59,78,242,216,247,95,247,47,247,50,248,48,151,31,14,
+247,194,136,29,14,247,194,136,29,249,191,28,4,185,41,10,247,3,28,4,207,28,
+4,135,21,247,76,251,81,203,251,148,251,209,251,109,251,74,251,134,251,11,
+219,61,247,21,82,30,251,72,106,251,132,41,251,185,26,251,127,247,97,36,247,
+209,247,152,247,148,247,31,247,34,200,92,190,53,108,78,127,131,114,30,64,
+251,74,5,90,81,90,122,78,27,53,251,36,219,247,58,247,103,247,58,231,247,34,
+163,182,135,129,229,31,170,247,49,5,137,57,121,137,126,27,82,251,13,164,247,
+48,247,70,247,27,247,27,247,7,151,162,135,133,153,31,223,251,118,5,139,186,
+111,186,247,5,219,206,221,30,14,247,3,247,129,248,50,21,51,64,63,43,251,64,
+247,173,36,247,129,247,247,247,80,247,127,247,157,247,24,38,247,17,251,83,
+146,31,247,79,193,247,86,241,247,147,26,247,99,251,67,197,251,175,251,226,
+251,75,251,5,251,56,61,200,113,206,163,227,157,139,30,174,247,95,5,180,205,
+199,145,180,27,247,56,202,69,251,6,251,58,44,251,55,251,168,31,64,143,108,
+251,40,5,139,247,18,149,150,247,84,190,32,33,251,74,119,251,50,251,171,65,
+84,156,169,115,30,90,247,154,5,139,103,150,92,30,14,205,247,130,250,240,21,
+61,251,97,247,53,251,23,247,44,84,251,84,114,251,51,39,81,251,43,8,252,5,
+251,31,247,232,251,5,247,193,27,247,48,229,156,210,247,70,31,202,247,222,
+5,251,49,6,61,251,84,5,69,111,251,37,100,80,27,251,83,251,6,247,66,247,83,
+211,31,247,57,203,247,66,168,204,27,195,235,121,139,31,166,247,45,5,135,82,
+114,137,125,27,251,66,251,0,247,27,247,70,205,31,247,36,195,247,41,192,213,
+27,219,231,100,59,140,31,147,251,84,5,247,49,6,195,247,209,5,227,251,55,44,
+170,251,50,27,251,156,251,104,251,11,251,64,73,31,14,205,94,29,14,205,94,
+29,107,249,3,41,10,205,247,34,247,113,29,178,243,85,234,77,201,8,247,165,
+167,247,181,247,19,247,212,26,247,43,251,13,239,251,74,164,30,248,8,29,130,
+10,184,90,174,72,109,61,248,42,29,247,13,250,180,248,30,21,175,247,83,251,
+48,247,7,182,29,247,91,99,251,98,100,30,112,251,36,121,48,109,251,54,8,149,
+6,247,26,247,76,248,10,10,248,158,5,115,6,84,146,56,248,46,10,8,14,249,237,
+249,144,248,21,21,251,158,106,238,251,44,247,193,27,247,243,247,63,247,92,
+247,93,181,31,195,247,159,247,175,10,175,29,37,92,56,27,38,96,203,247,116,
+154,31,151,247,66,251,23,247,10,182,29,247,79,102,251,113,112,30,14,252,244,
+249,142,28,6,72,21,169,88,191,40,251,107,64,251,103,251,15,114,30,251,9,104,
+137,80,242,149,112,251,48,125,251,33,116,251,5,25,119,35,110,45,98,83,251,
+11,211,24,102,114,115,105,108,26,108,174,82,214,247,58,247,13,247,72,247,
+23,174,30,161,227,187,247,197,149,209,8,247,68,213,251,56,6,149,196,150,247,
+19,212,198,221,68,24,233,151,160,176,176,26,14,251,240,74,29,251,75,247,237,
+47,29,176,250,150,244,21,253,35,6,103,34,5,248,179,6,96,251,111,85,29,162,
+28,6,51,125,29,14,251,240,74,29,251,160,253,130,36,10,251,240,250,111,28,
+5,92,21,248,39,10,137,125,5,251,90,251,25,247,69,6,135,113,136,113,135,115,
+8,251,109,251,27,247,90,6,112,251,89,121,251,37,117,251,15,106,251,66,98,
+222,29,226,248,183,5,247,146,247,27,251,125,6,151,215,5,247,164,247,25,247,
+170,10,14,249,102,28,6,193,247,150,29,55,5,251,66,76,10,247,248,6,251,61,
+253,199,187,10,251,240,140,29,14,251,240,140,29,251,190,248,41,47,29,251,
+240,249,151,250,195,21,247,19,251,71,7,160,201,168,192,181,176,247,19,251,
+13,24,247,227,29,192,61,223,251,43,251,109,251,19,251,42,251,53,68,30,251,
+136,251,19,247,90,6,127,97,130,99,133,104,67,252,36,126,251,127,104,251,80,
+107,251,66,97,248,195,10,207,248,146,157,247,6,152,226,150,225,155,218,8,
+14,251,240,249,174,250,46,21,76,247,21,251,83,42,164,247,59,168,247,42,229,
+218,25,247,19,251,13,5,247,227,29,248,39,29,129,86,131,89,131,92,251,136,
+251,16,24,202,251,21,247,47,217,109,251,106,125,251,46,115,251,22,25,107,
+251,66,97,222,29,171,247,25,198,248,72,163,247,54,8,14,251,27,127,29,14,251,
+27,127,29,149,248,214,34,29,251,161,249,250,28,4,172,21,251,8,6,73,251,74,
+5,133,137,98,130,133,27,251,140,6,251,228,74,5,65,7,247,66,123,251,59,253,
+224,5,247,167,6,247,67,250,7,5,247,189,6,14,251,27,230,29,251,35,236,49,247,
+55,119,30,107,106,79,71,123,106,172,82,106,26,108,69,248,180,29,192,151,165,
+30,247,85,154,247,13,229,245,247,17,251,19,196,24,247,110,29,14,251,27,186,
+10,247,113,247,21,238,247,25,247,9,247,75,29,251,27,186,10,247,7,228,165,
+184,216,30,107,251,26,50,251,99,61,247,218,29,247,2,247,172,248,32,232,247,
+75,29,39,250,142,250,123,21,253,251,47,6,195,135,182,137,139,26,159,137,147,
+131,133,118,251,56,253,117,24,137,129,129,116,115,137,8,139,89,137,86,135,
+30,47,248,163,231,7,77,143,94,141,139,26,121,141,126,152,143,155,209,247,
+207,24,247,80,247,107,29,251,78,6,214,247,234,5,247,165,6,151,153,137,131,
+31,251,42,247,23,7,14,189,110,29,251,179,249,89,47,29,247,28,249,37,247,90,
+29,166,137,155,134,135,115,71,251,239,24,251,94,6,113,251,17,5,247,95,6,117,
+251,7,5,251,91,6,114,251,17,5,247,91,6,66,252,10,133,113,125,135,108,137,
+25,247,166,10,212,248,12,24,248,6,6,164,247,17,5,252,6,6,161,247,7,5,248,
+2,6,165,247,17,5,252,3,6,14,189,28,4,229,247,200,10,248,176,10,251,144,28,
+250,254,24,115,251,21,102,51,102,108,247,110,10,247,29,249,72,5,247,111,216,
+10,251,109,6,235,248,131,5,248,80,10,14,189,249,27,247,90,29,164,137,157,
+134,135,115,45,252,111,24,251,96,251,17,247,72,6,251,26,253,62,115,251,21,
+102,51,102,108,25,247,110,10,247,28,249,72,5,247,112,216,10,251,111,6,14,
+172,247,185,250,148,21,202,247,78,5,160,147,157,157,157,27,247,255,6,43,252,
+140,5,251,141,6,122,128,162,153,140,31,145,247,32,5,251,16,6,47,252,120,5,
+247,16,6,186,247,32,5,153,143,161,161,154,27,247,141,6,52,252,90,134,112,
+117,123,113,137,25,251,24,128,120,35,5,248,252,6,158,243,32,247,219,10,247,
+9,149,159,243,5,254,144,6,72,251,242,5,14,211,191,10,14,180,250,205,250,181,
+21,98,247,244,5,254,127,108,6,247,19,221,96,251,8,31,254,169,7,47,251,11,
+88,49,30,108,248,252,170,7,49,251,11,190,231,31,250,191,7,207,180,169,191,
+30,247,150,6,247,60,186,251,17,251,49,182,31,14,99,248,138,235,21,53,147,
+98,146,125,147,145,167,25,247,43,249,85,248,51,29,247,216,6,159,146,127,131,
+138,31,133,251,80,5,247,29,6,201,247,208,5,254,111,41,6,248,108,29,251,46,
+253,85,24,248,111,29,8,118,113,135,135,100,31,43,248,193,7,14,211,191,10,
+37,249,194,34,29,111,28,4,211,28,6,106,21,251,44,6,60,251,121,5,108,126,129,
+131,112,27,253,148,248,182,29,251,19,128,5,35,249,3,243,7,251,5,247,175,29,
+247,109,250,215,5,248,146,6,14,211,28,5,0,247,200,10,254,218,248,182,29,251,
+19,128,5,35,247,5,7,247,62,247,39,248,10,10,248,160,251,5,247,175,29,247,
+109,250,215,248,177,10,211,28,5,0,247,200,10,247,23,29,249,3,247,14,29,14,
+211,248,73,22,247,125,29,247,132,247,121,186,30,247,14,29,217,248,29,5,247,
+23,29,7,14,252,76,249,191,28,5,16,21,209,251,87,7,151,115,79,160,74,27,251,
+99,47,251,27,251,7,61,190,94,211,108,31,104,107,116,73,146,100,8,38,108,61,
+82,55,26,51,215,43,247,101,247,95,247,60,241,242,210,81,168,53,176,30,251,
+70,213,137,151,145,165,150,162,25,149,149,139,141,149,31,247,64,151,232,247,
+5,247,7,26,167,132,168,131,157,30,251,62,70,21,65,106,251,9,51,96,135,182,
+195,247,12,227,219,168,190,139,88,82,30,154,252,181,21,100,108,67,251,13,
+251,3,111,223,193,184,157,180,199,159,30,247,39,80,5,190,118,154,115,110,
+26,14,45,39,29,247,182,28,6,29,34,29,45,39,29,247,179,28,5,18,44,29,45,39,
+29,247,218,28,6,96,61,29,45,39,29,247,251,28,6,113,48,29,45,39,29,247,226,
+28,5,255,80,29,45,39,29,242,28,5,227,47,29,45,39,29,251,79,28,5,154,247,47,
+29,160,250,223,251,100,21,247,3,59,7,125,236,57,185,251,10,191,251,164,247,
+15,24,135,162,147,182,153,178,8,248,23,29,247,81,247,11,251,191,6,155,100,
+49,174,36,27,251,209,251,36,251,117,251,83,251,21,219,63,247,1,88,31,86,84,
+104,251,1,149,76,251,21,94,34,66,108,35,8,61,251,3,212,6,251,24,161,247,15,
+251,21,247,183,27,247,153,247,115,247,12,247,33,202,31,251,173,250,69,247,
+154,29,251,105,254,215,21,251,13,80,212,212,116,31,248,70,6,75,122,78,57,
+251,45,27,45,248,43,21,247,121,39,172,124,163,122,155,121,25,252,58,6,147,
+203,173,194,217,170,8,14,70,28,4,111,249,77,21,109,247,21,251,65,107,135,
+162,133,159,133,156,25,247,81,247,11,251,191,6,155,100,49,174,36,27,251,190,
+251,37,251,91,251,74,122,31,251,31,113,159,251,16,247,25,163,168,63,203,87,
+220,102,25,237,29,247,156,141,247,47,247,47,169,247,70,8,251,146,253,211,
+247,107,10,38,250,212,21,215,141,58,45,31,251,137,94,5,247,27,176,233,224,
+175,27,33,252,132,21,75,128,197,224,138,31,247,136,182,5,43,116,86,49,47,
+27,14,247,34,28,4,152,250,148,107,29,251,181,250,3,28,5,119,21,54,6,68,103,
+5,160,105,90,154,98,27,251,164,251,61,251,88,251,101,251,6,192,251,2,247,
+68,202,206,161,169,198,31,251,35,108,94,33,251,37,27,115,104,153,150,124,
+31,116,247,2,5,146,125,120,142,113,27,82,93,94,90,43,247,57,115,226,247,120,
+247,28,247,19,247,54,174,31,67,248,123,21,57,252,10,5,119,100,102,121,95,
+27,39,114,208,224,247,41,245,247,48,247,33,173,165,115,116,159,31,14,248,
+134,28,5,207,247,16,29,251,151,250,219,107,29,247,34,28,4,166,250,214,21,
+168,247,41,194,223,188,182,247,44,251,17,24,208,160,242,159,231,26,213,73,
+200,251,21,251,179,251,86,251,98,251,212,63,30,168,88,81,151,98,121,29,45,
+251,16,251,192,21,251,11,247,191,7,123,178,229,104,242,27,247,209,247,36,
+247,117,247,83,247,21,59,215,251,1,190,31,192,194,174,247,1,129,202,8,247,
+46,192,247,12,234,247,31,26,247,39,251,8,247,52,251,216,251,201,251,148,251,
+60,251,64,251,11,225,88,247,23,82,30,247,164,251,15,143,116,131,96,125,100,
+25,251,189,137,251,50,251,88,251,95,26,90,150,92,151,108,30,247,152,247,9,
+21,247,17,188,247,82,247,27,207,147,72,44,251,92,251,29,251,26,94,61,139,
+223,236,30,116,250,31,21,202,189,247,13,247,78,247,60,186,251,31,51,63,108,
+70,49,104,30,251,121,239,5,63,174,114,180,186,26,14,167,247,75,249,170,21,
+248,247,6,251,232,56,251,10,251,5,113,251,21,118,35,177,76,247,46,29,150,
+183,247,106,157,226,247,106,245,247,184,203,8,161,247,101,254,52,6,247,207,
+253,201,247,47,10,242,250,77,251,129,21,253,11,6,247,232,222,247,20,247,5,
+165,247,21,160,243,101,200,247,45,10,130,95,251,106,121,52,251,106,33,251,
+184,75,8,117,251,101,250,62,6,251,217,249,199,247,42,29,246,250,89,249,95,
+21,247,41,140,187,242,192,26,239,50,190,251,183,251,242,252,2,251,141,252,
+15,251,56,219,251,148,248,70,247,122,247,47,239,247,48,188,30,184,247,34,
+182,159,221,149,8,232,252,148,46,7,243,137,184,88,117,251,2,8,251,10,115,
+60,103,56,27,43,251,73,202,247,120,247,219,247,149,247,97,247,71,162,161,
+137,134,157,31,14,251,10,250,193,250,252,21,202,252,35,76,7,175,136,178,137,
+139,26,160,138,146,135,136,124,87,251,135,24,133,115,91,128,105,27,77,251,
+61,194,247,91,247,176,247,112,247,62,247,55,181,187,121,133,156,31,157,133,
+157,131,138,125,127,251,31,24,247,5,6,188,247,116,5,169,251,0,73,154,38,27,
+251,214,251,172,251,99,251,198,251,23,206,251,112,247,231,247,5,247,19,171,
+159,213,31,200,247,178,142,150,143,145,151,141,25,14,246,28,4,160,248,39,
+21,209,29,5,178,251,33,55,157,251,19,247,61,29,14,248,42,44,10,144,28,4,210,
+34,29,248,42,44,10,141,250,91,44,29,248,42,44,10,180,28,5,21,61,29,248,42,
+44,10,213,28,5,38,48,29,248,42,44,10,188,28,4,180,80,29,248,42,44,10,251,
+74,28,4,152,47,29,248,42,44,10,252,154,253,203,57,29,248,42,28,5,159,247,
+206,21,247,7,251,51,7,159,240,144,158,145,149,157,141,25,247,31,149,5,248,
+7,29,119,38,24,251,179,251,7,247,156,6,102,251,81,5,129,102,65,120,86,27,
+45,251,152,231,247,224,248,45,29,215,114,125,163,31,168,135,166,120,247,17,
+29,190,247,153,5,14,248,133,28,6,116,249,212,21,111,247,23,28,251,148,251,
+95,5,247,219,229,247,155,247,81,247,97,27,203,213,109,130,165,31,167,129,
+167,126,247,192,29,252,80,252,30,251,172,252,63,64,31,251,51,111,158,251,
+16,247,19,161,5,120,7,248,40,29,30,247,20,29,231,247,224,175,141,174,143,
+173,31,14,248,42,28,7,94,28,6,41,21,213,45,231,59,251,107,251,95,43,251,157,
+100,30,164,251,4,81,139,60,27,252,101,252,79,247,53,10,247,20,29,229,247,
+226,248,45,29,241,106,127,162,31,161,133,148,114,137,123,118,251,115,24,247,
+68,6,213,247,252,5,247,39,170,173,247,42,207,27,247,70,251,91,5,199,160,208,
+200,215,26,14,247,50,28,6,0,28,4,227,21,211,73,202,33,251,156,94,251,35,251,
+125,73,30,147,86,84,145,75,247,61,29,247,3,147,5,209,29,180,247,82,162,227,
+170,154,25,247,43,251,32,5,207,160,192,159,229,26,14,248,11,28,4,169,184,
+21,247,87,250,225,185,247,153,139,26,89,6,251,158,251,21,5,207,65,251,14,
+200,53,27,252,18,252,15,252,56,252,135,251,184,247,46,251,101,247,138,247,
+111,247,120,247,70,139,31,118,251,7,5,251,74,106,251,33,251,89,251,118,27,
+36,68,154,175,96,31,172,247,79,5,193,111,96,173,65,27,33,47,62,251,11,251,
+21,247,35,251,32,247,252,247,252,247,196,247,108,247,189,191,31,251,142,247,
+131,21,139,251,31,63,37,251,68,251,3,247,53,247,111,247,202,247,91,247,245,
+247,139,209,247,26,45,78,160,30,14,247,28,28,4,188,248,181,21,239,252,58,
+39,7,161,137,145,138,139,26,166,137,148,128,136,116,71,252,23,24,130,107,
+76,121,94,27,132,132,140,140,131,31,247,116,250,247,193,138,202,116,160,126,
+25,163,135,162,121,137,116,123,251,113,24,247,40,6,204,247,248,251,31,186,
+52,163,251,21,140,25,175,247,72,5,251,17,6,101,251,81,5,252,3,82,251,191,
+251,203,252,75,26,251,76,208,251,189,247,220,76,30,101,251,83,5,247,17,6,
+174,247,70,5,152,6,247,39,247,58,189,171,236,31,219,248,91,143,157,144,148,
+155,141,25,253,162,100,21,248,0,247,80,247,138,247,76,220,30,251,101,254,
+171,5,57,194,58,247,0,247,85,26,14,167,247,106,28,4,141,21,248,217,6,251,
+227,71,39,251,5,120,40,119,35,176,96,247,46,29,130,183,247,106,157,226,247,
+80,186,247,210,217,8,161,247,101,254,52,6,247,207,253,136,247,47,10,232,250,
+127,247,101,21,252,237,6,247,227,207,239,247,5,158,238,159,243,102,182,247,
+45,10,148,95,251,106,121,52,251,70,92,251,210,61,8,117,251,101,250,62,6,251,
+227,249,136,247,42,29,248,42,28,5,188,249,56,21,252,250,34,6,247,58,127,131,
+251,29,118,49,8,251,10,112,45,55,251,21,27,251,75,251,103,247,46,248,50,218,
+31,248,17,211,247,183,247,89,247,102,27,186,211,120,124,175,31,181,122,161,
+125,138,118,248,123,29,189,251,26,251,28,165,251,46,27,252,95,252,8,251,179,
+252,66,57,31,252,92,52,247,188,251,159,247,250,27,247,209,247,61,247,53,247,
+75,201,31,205,247,88,179,193,247,28,149,8,14,251,227,249,4,252,62,21,138,
+201,5,118,99,107,125,101,27,124,114,153,180,148,31,214,247,217,5,242,161,
+97,209,251,26,27,61,69,114,108,85,31,219,247,239,5,47,248,7,10,251,75,253,
+192,5,247,69,6,236,248,66,5,191,194,202,178,179,27,166,171,106,80,125,31,
+60,251,250,5,75,124,215,117,202,27,209,207,159,168,205,31,14,251,225,249,
+234,249,197,149,29,128,28,4,168,149,29,207,43,10,251,193,28,5,231,44,29,207,
+43,10,200,28,7,70,48,29,207,43,10,179,28,6,186,41,10,207,43,10,251,87,28,
+6,184,47,29,207,43,10,252,2,251,74,162,29,207,43,10,251,212,251,124,95,10,
+207,43,10,252,222,252,17,65,29,207,43,10,253,159,251,180,54,29,207,28,4,127,
+247,32,21,114,89,78,126,179,29,5,32,117,247,8,102,236,27,182,183,144,149,
+181,31,127,79,112,49,247,136,29,233,247,105,231,160,30,14,207,101,29,207,
+101,29,247,13,28,4,121,249,5,21,247,127,251,17,247,31,251,117,63,251,15,101,
+91,32,30,174,247,71,5,247,236,247,23,251,209,6,196,247,185,5,35,6,251,244,
+36,5,55,247,39,7,119,33,5,251,103,251,23,247,76,6,251,107,254,216,248,112,
+10,247,46,249,154,5,178,215,200,170,201,27,225,247,12,81,251,88,251,240,251,
+162,252,118,252,11,103,31,121,42,5,248,181,248,31,248,107,248,163,31,14,207,
+247,4,10,251,15,252,232,5,32,117,247,8,102,236,27,247,0,244,172,188,241,31,
+137,242,5,248,103,29,247,7,248,178,241,10,251,229,249,254,28,6,41,21,211,
+74,180,251,62,251,144,39,251,95,73,124,30,251,37,253,17,247,56,29,247,82,
+10,158,215,5,247,31,169,223,197,209,27,151,180,135,131,149,31,164,34,5,139,
+166,129,169,192,182,180,188,30,14,207,247,209,28,5,74,21,251,174,28,250,182,
+223,29,145,126,251,66,253,182,139,26,115,251,13,93,38,43,121,251,17,247,72,
+24,51,129,49,94,49,26,59,201,55,247,43,247,191,247,85,247,74,247,148,192,
+30,247,50,249,146,248,194,10,14,207,247,4,10,145,126,251,66,253,182,139,26,
+115,251,13,93,38,43,121,251,17,247,72,24,51,129,49,94,49,26,59,201,55,247,
+43,247,191,247,85,247,74,247,148,192,30,247,50,249,146,241,10,207,89,10,249,
+104,249,74,247,244,21,251,115,92,217,251,54,247,163,27,247,212,247,89,247,
+92,247,93,181,31,247,25,249,11,5,251,164,6,251,33,253,48,5,251,55,105,251,
+21,91,76,27,58,105,218,247,24,167,31,226,248,40,5,247,63,176,71,247,10,247,
+148,29,247,72,123,251,174,28,250,182,223,29,14,251,85,248,36,248,97,21,247,
+150,247,107,29,251,148,6,203,247,182,224,10,14,207,250,226,250,123,21,251,
+167,6,251,41,253,96,5,53,55,43,71,75,27,98,90,196,238,160,31,247,14,248,232,
+5,245,162,251,9,176,45,27,251,3,37,106,90,35,31,143,37,5,173,198,190,162,
+199,27,159,178,116,72,125,31,251,7,252,181,5,251,64,104,205,251,7,247,97,
+27,247,12,247,1,182,191,221,31,251,3,252,175,5,247,32,6,247,238,205,5,210,
+7,251,73,158,5,14,251,229,249,211,28,5,104,21,251,70,6,42,252,65,5,87,84,
+77,98,97,27,112,108,174,198,152,31,219,247,250,5,202,153,63,161,78,27,67,
+73,120,109,71,31,142,78,5,159,177,172,153,178,27,152,165,125,99,130,31,64,
+251,219,5,36,116,182,70,247,25,27,217,210,165,170,192,31,67,251,215,5,230,
+6,247,117,178,5,182,7,251,9,150,5,14,247,28,28,4,145,250,123,21,177,29,251,
+2,252,175,5,247,31,248,84,29,247,30,28,5,23,251,224,21,231,71,166,88,157,
+30,251,95,251,27,90,182,127,223,177,247,81,25,247,103,250,137,5,177,29,123,
+57,5,251,126,92,245,251,115,247,193,27,247,65,225,207,208,31,14,207,43,10,
+14,74,250,90,249,76,21,197,247,195,5,254,31,43,6,232,133,163,137,155,118,
+135,115,25,251,31,253,105,117,251,17,139,26,247,163,6,139,156,222,221,248,
+62,30,141,160,162,141,158,27,247,60,174,251,58,251,140,91,248,99,29,72,145,
+151,91,31,142,56,5,122,209,201,248,125,29,210,248,118,10,112,109,137,137,
+115,31,189,247,153,5,247,183,6,167,144,130,109,137,31,141,251,38,5,14,207,
+89,10,228,175,10,247,11,225,184,185,247,1,31,14,247,225,28,4,205,250,5,21,
+248,37,29,252,216,248,201,10,5,41,121,192,251,1,247,39,27,247,11,225,184,
+185,247,1,31,248,25,29,247,25,249,62,5,14,228,196,29,125,55,176,47,243,115,
+25,108,106,76,69,123,106,172,82,106,26,108,69,247,19,10,152,165,194,152,166,
+30,229,151,210,176,230,176,8,14,228,175,10,173,170,143,145,169,31,251,112,
+251,187,248,86,29,247,171,248,11,139,30,14,248,65,28,5,174,248,165,29,118,
+113,247,254,29,247,66,122,77,251,201,5,251,164,6,229,248,101,248,145,29,247,
+64,122,251,58,253,248,5,247,167,6,225,248,80,5,247,162,6,123,57,116,251,2,
+104,247,164,29,93,251,19,39,133,251,3,153,247,13,211,180,247,62,148,180,30,
+151,157,172,155,159,27,247,23,150,86,251,3,31,14,213,250,238,250,123,21,251,
+164,6,53,252,76,5,251,226,227,10,247,228,6,70,251,248,247,122,10,247,53,247,
+53,209,248,0,8,14,228,238,10,251,45,253,160,5,251,169,85,70,251,16,247,205,
+10,247,52,247,55,210,247,254,202,247,214,24,248,38,10,247,11,225,184,185,
+247,1,31,14,248,138,28,5,231,248,195,21,247,128,10,103,180,247,8,162,31,247,
+36,249,116,5,251,164,6,53,252,76,5,251,226,227,10,247,228,6,106,251,61,5,
+248,1,29,14,248,174,250,218,250,123,21,251,164,6,53,252,76,5,251,206,227,
+10,247,208,6,54,252,80,5,247,163,6,238,248,143,5,142,161,185,144,171,120,
+29,96,88,134,136,115,31,14,234,40,10,14,234,28,4,152,186,21,134,237,5,247,
+197,29,247,3,248,212,73,10,251,17,253,5,121,51,227,109,221,131,25,106,103,
+86,75,124,106,172,82,106,26,108,69,247,19,10,151,162,193,152,168,30,228,150,
+246,167,196,167,8,14,248,202,250,42,22,236,248,141,5,141,150,200,147,178,
+120,29,87,75,131,137,126,31,166,247,32,73,10,251,40,253,109,5,14,226,248,
+248,22,50,75,68,78,127,106,174,82,106,26,108,67,247,19,10,148,163,206,167,
+178,30,248,131,196,78,29,14,226,93,29,14,248,218,87,29,248,218,136,10,246,
+34,247,37,247,108,10,157,92,186,106,199,123,8,108,106,71,69,121,106,172,82,
+106,26,108,69,248,180,29,192,153,168,30,237,151,244,188,182,157,8,14,247,
+138,250,37,249,253,21,180,135,153,131,133,112,251,40,253,67,247,39,29,247,
+5,149,5,237,28,250,242,247,151,29,251,46,253,85,247,116,29,247,37,249,67,
+248,51,29,14,248,118,39,10,14,71,84,10,71,84,10,247,38,28,5,10,250,27,21,
+235,252,176,43,7,190,133,192,135,139,26,164,135,151,135,135,116,77,251,174,
+24,252,33,6,200,247,172,224,10,208,247,222,5,248,34,6,67,251,222,135,119,
+121,131,124,136,25,139,92,135,88,248,105,29,128,145,143,161,25,247,48,249,
+103,143,164,149,145,168,141,25,139,188,143,184,145,30,14,248,118,39,10,251,
+114,247,160,44,29,248,118,39,10,251,42,248,255,48,29,248,118,39,10,251,63,
+248,115,41,10,248,118,39,10,252,42,248,113,47,29,248,118,39,10,252,185,28,
+250,151,162,29,248,118,39,10,253,149,28,249,208,65,29,248,118,39,10,254,196,
+28,250,45,54,29,248,118,28,6,121,247,184,10,113,251,25,24,252,189,6,165,247,
+23,247,100,10,113,251,25,24,251,49,251,13,247,25,6,251,55,253,212,135,115,
+127,133,110,137,25,208,29,247,55,249,214,24,247,72,247,13,251,48,6,165,247,
+23,247,175,10,254,95,252,116,21,177,247,89,5,248,189,6,101,251,89,5,14,71,
+247,158,10,122,59,24,251,251,6,156,217,142,154,146,143,157,140,25,221,145,
+5,248,2,29,122,59,24,38,66,224,6,34,252,135,136,125,132,135,120,138,25,208,
+10,246,248,136,24,247,8,212,38,6,156,217,141,150,145,145,155,141,25,253,11,
+251,180,21,164,247,10,5,247,251,6,114,251,10,5,14,249,36,247,92,247,37,21,
+134,115,128,248,212,10,247,105,250,210,24,143,157,147,149,164,142,247,23,
+151,24,247,174,10,153,132,135,248,185,10,252,219,7,247,99,29,159,135,127,
+137,31,14,248,118,28,6,121,248,68,10,247,174,10,154,132,134,115,51,252,87,
+24,252,189,89,29,248,189,6,251,39,253,123,104,251,69,119,85,247,216,29,247,
+14,247,57,247,153,191,31,247,144,28,4,248,247,175,10,14,248,118,86,29,28,
+4,118,28,7,8,250,123,21,251,33,253,48,5,251,56,108,251,19,87,10,247,25,249,
+11,5,14,138,248,162,249,25,21,247,211,216,10,251,209,6,231,248,95,144,163,
+150,247,126,10,248,112,29,115,127,133,110,137,8,247,218,10,132,143,144,163,
+8,14,247,255,248,151,250,166,21,169,141,155,159,163,30,225,102,170,95,247,
+31,127,179,136,247,28,247,43,210,236,79,168,24,123,122,118,121,100,27,251,
+103,205,5,83,126,252,35,251,186,43,26,76,247,166,251,228,155,117,30,153,120,
+117,117,131,131,8,124,39,232,141,251,3,31,121,121,136,131,125,31,251,47,251,
+173,202,112,5,156,153,152,147,157,27,176,159,136,71,247,42,31,248,53,248,
+94,36,247,31,247,10,207,247,74,115,221,251,23,138,251,58,25,38,112,251,8,
+82,57,30,84,251,72,175,251,8,27,251,78,251,157,209,114,5,160,156,150,147,
+165,27,247,203,109,5,247,90,247,70,247,162,247,169,247,107,26,247,65,76,247,
+126,251,232,30,97,113,251,34,44,251,23,64,8,14,248,118,28,6,121,248,68,10,
+247,174,10,153,132,135,248,200,10,251,117,28,251,137,24,251,142,90,58,251,
+12,247,117,10,244,248,171,248,198,29,247,105,250,210,24,143,157,147,149,164,
+142,8,14,247,183,100,29,247,171,28,4,223,22,243,7,106,29,7,14,247,120,247,
+29,247,52,21,135,112,115,123,114,137,251,19,128,24,35,248,249,243,7,36,247,
+175,29,247,9,248,217,5,214,29,211,248,3,5,151,143,121,157,159,27,247,234,
+247,230,29,254,171,35,6,247,15,248,88,10,14,247,171,28,4,223,243,21,106,29,
+212,247,150,10,14,249,97,250,162,247,200,10,247,78,29,252,189,89,29,248,189,
+247,8,10,249,1,247,59,10,247,110,250,243,24,247,67,247,76,29,14,248,118,86,
+29,248,19,28,6,121,247,184,10,51,252,87,24,252,189,89,29,248,189,247,8,10,
+248,87,247,58,10,247,12,10,8,14,250,7,28,7,90,248,150,21,247,115,251,56,247,
+21,251,205,106,98,135,137,104,30,209,247,246,247,146,10,55,252,64,5,252,70,
+248,15,10,252,234,35,7,233,129,164,134,157,125,248,180,10,248,228,243,7,45,
+247,175,29,237,248,129,5,248,71,6,42,252,129,248,104,10,248,140,7,248,3,247,
+209,233,248,56,31,251,201,174,21,251,138,55,251,78,251,171,30,119,116,141,
+123,27,247,15,249,2,5,143,165,182,144,160,27,247,25,215,83,251,37,31,14,248,
+118,28,6,121,247,184,10,51,252,87,24,252,189,89,29,248,189,6,251,4,252,205,
+5,251,143,90,58,251,11,247,117,10,247,110,250,231,24,143,157,147,149,164,
+142,8,14,28,4,111,28,8,18,249,46,21,175,29,251,4,87,10,195,247,159,247,175,
+10,14,250,95,28,6,71,247,184,10,51,252,87,24,252,139,89,29,248,139,247,8,
+10,249,1,247,59,10,247,9,248,235,24,219,29,101,31,212,248,4,247,175,10,14,
+248,112,28,6,121,28,4,246,21,170,10,248,250,243,7,251,4,243,10,14,248,112,
+28,5,145,243,21,251,4,243,10,247,11,149,5,170,10,243,247,150,10,14,250,35,
+28,4,249,249,121,21,214,29,209,247,246,247,106,29,28,250,206,35,7,241,243,
+29,251,11,128,5,35,248,231,243,7,46,247,175,29,247,101,250,170,5,166,143,
+164,157,163,27,247,235,247,229,29,40,128,5,35,248,230,243,7,251,4,247,244,
+10,14,248,112,170,29,251,11,128,5,35,248,52,7,247,60,159,251,5,251,199,78,
+31,247,62,6,247,199,200,203,247,5,247,60,27,248,70,243,6,47,243,10,14,248,
+112,170,29,251,19,128,5,35,250,72,7,247,62,247,40,251,7,251,197,77,31,247,
+44,6,241,248,160,37,243,10,14,250,97,125,10,252,220,35,7,231,129,164,134,
+157,125,247,59,29,251,11,128,5,35,28,7,146,243,7,46,247,194,10,250,97,125,
+10,252,230,35,7,241,129,164,247,255,10,251,21,128,5,35,28,5,166,7,247,62,
+247,39,248,102,29,36,247,194,10,248,73,156,29,252,90,248,240,28,5,78,52,10,
+14,252,90,248,240,28,5,78,52,10,14,253,57,247,160,247,247,21,192,92,181,82,
+81,95,97,86,86,183,96,197,196,186,182,192,30,156,253,155,21,206,7,114,90,
+64,122,125,27,107,139,166,169,145,31,242,248,128,5,45,6,251,111,99,5,96,7,
+247,6,128,55,252,44,5,79,126,174,72,236,27,216,207,154,179,219,31,14,253,
+57,248,142,28,6,63,198,29,251,89,28,7,182,198,29,252,90,50,29,247,110,250,
+186,49,29,252,90,50,29,247,21,28,4,122,58,29,252,90,50,29,247,78,28,5,116,
+61,29,252,90,50,29,247,111,28,5,133,48,29,252,90,50,29,247,102,28,5,106,36,
+10,252,90,50,29,238,28,5,19,247,38,29,252,90,50,29,247,90,28,4,249,41,10,
+252,90,50,29,247,90,28,4,249,62,29,248,62,248,92,34,29,252,90,50,29,166,28,
+5,102,37,10,252,90,248,240,28,5,78,52,10,76,251,132,70,10,252,90,248,240,
+28,5,78,52,10,251,203,252,26,65,29,252,90,248,240,28,5,78,52,10,251,65,252,
+64,63,10,252,90,250,117,242,10,184,247,50,248,89,10,94,251,50,180,10,252,
+25,28,6,96,52,10,14,252,90,248,240,28,5,78,247,76,10,166,28,250,244,247,248,
+29,186,247,140,5,247,78,247,16,251,53,6,225,248,85,248,69,10,84,251,183,5,
+251,56,251,16,247,34,6,87,251,157,247,246,29,14,253,55,248,142,28,6,63,247,
+231,10,155,253,156,21,207,7,114,90,65,123,125,27,106,139,166,167,145,31,170,
+247,42,5,247,15,214,33,6,196,247,161,5,45,6,251,111,98,5,96,7,247,6,129,102,
+251,67,5,33,64,231,6,104,251,52,5,80,127,174,73,237,27,217,204,153,178,219,
+31,14,252,94,101,251,251,21,51,211,69,227,227,208,209,227,227,70,211,51,51,
+67,67,51,30,112,28,5,12,21,251,4,7,180,215,247,7,167,161,27,188,139,94,90,
+129,31,251,50,253,201,5,247,36,6,247,230,207,5,210,7,251,68,158,247,21,249,
+60,5,239,159,86,247,3,251,42,27,251,10,34,114,73,251,15,31,14,253,59,229,
+248,206,21,86,186,97,196,196,184,181,192,191,94,183,82,82,92,95,87,30,122,
+249,155,21,72,7,163,188,214,156,153,27,171,139,112,110,133,31,36,252,129,
+5,232,6,247,112,180,5,181,7,251,6,151,223,248,44,5,199,152,104,205,42,27,
+62,71,124,100,59,31,14,247,89,248,240,28,5,78,52,10,249,21,28,5,12,68,29,
+247,73,248,240,28,5,78,52,10,248,244,28,5,12,52,10,14,249,196,248,240,28,
+5,78,52,10,248,244,28,5,12,52,10,248,244,28,5,12,52,10,14,248,224,248,240,
+28,5,78,52,10,250,181,249,207,146,10,249,106,248,240,28,5,78,52,10,28,4,180,
+249,209,97,29,14,252,10,249,85,247,66,21,194,87,199,37,147,30,248,153,29,
+247,49,249,187,248,71,10,251,21,253,51,248,15,29,31,14,253,5,248,209,250,
+13,21,172,105,175,73,144,30,81,251,1,100,144,111,157,147,177,25,241,248,120,
+5,48,6,251,110,99,5,95,7,247,3,127,55,252,38,5,78,126,195,69,247,22,27,247,
+11,244,177,220,31,14,252,10,248,217,248,91,21,247,13,251,32,7,226,248,84,
+248,71,10,83,251,180,5,251,29,251,13,247,6,6,89,251,154,248,15,29,194,87,
+199,37,147,31,248,153,29,185,247,130,5,14,248,146,28,5,254,249,1,21,247,158,
+251,46,247,29,251,144,251,193,251,80,251,103,251,138,73,30,251,4,6,231,248,
+93,5,251,35,6,251,198,55,5,57,247,34,7,251,34,253,88,133,108,125,124,104,
+137,25,139,82,135,88,137,30,43,248,189,235,7,106,141,98,143,139,26,110,141,
+119,156,145,168,8,139,176,247,80,159,243,30,247,11,6,135,115,139,116,115,
+26,251,120,247,11,251,60,247,172,248,9,247,105,247,216,247,214,30,251,189,
+147,21,251,144,251,13,251,181,251,35,92,55,219,247,103,247,168,247,31,248,
+11,29,14,251,252,37,29,14,251,252,37,29,14,252,33,249,32,28,5,40,21,166,144,
+160,160,168,27,247,11,145,5,235,252,230,43,7,247,2,133,5,166,152,118,112,
+134,31,251,124,28,251,110,5,112,134,118,118,110,27,251,11,133,5,43,248,230,
+235,7,251,2,145,5,112,125,160,166,145,31,14,251,252,37,29,14,252,252,249,
+25,248,52,29,252,38,78,7,247,240,29,122,132,137,118,138,8,139,100,136,100,
+136,30,78,248,39,200,7,97,143,98,142,139,26,121,140,134,143,141,152,247,31,
+249,31,24,142,150,142,147,153,140,8,14,252,113,249,48,250,25,21,237,252,193,
+247,151,29,251,46,253,85,247,39,29,14,253,72,248,185,28,5,45,21,196,251,255,
+82,7,164,137,170,137,139,26,165,135,150,133,134,122,39,252,58,24,123,137,
+131,131,108,27,127,137,122,137,115,137,8,81,247,252,197,7,115,141,120,141,
+125,141,114,141,129,143,143,157,238,248,58,24,156,143,147,147,151,27,14,251,
+252,37,29,247,173,247,158,49,29,251,252,37,29,247,84,247,242,58,29,251,252,
+37,29,247,141,248,236,61,29,251,252,37,29,247,174,248,253,48,29,251,252,37,
+29,247,165,248,226,36,10,251,252,37,29,247,54,248,139,247,38,29,251,252,37,
+29,247,153,248,113,41,10,251,252,37,29,247,153,248,113,62,29,248,62,248,92,
+34,29,251,252,37,29,165,248,111,47,29,251,252,37,29,229,248,222,37,10,251,
+252,37,29,50,28,250,100,70,10,251,252,37,29,251,229,28,249,206,65,29,251,
+252,37,29,251,138,28,249,168,63,10,251,252,249,195,28,4,248,247,77,10,55,
+252,72,24,251,95,251,13,247,71,6,34,252,165,135,111,127,135,108,137,25,247,
+167,29,244,248,167,24,247,113,247,13,251,89,6,223,248,70,143,157,145,152,
+160,141,25,14,252,113,248,217,248,93,21,247,21,251,12,7,196,247,158,248,51,
+29,247,5,149,5,237,252,193,247,151,29,80,251,158,24,251,40,251,21,247,12,
+6,72,251,202,248,111,29,25,247,206,10,205,247,202,5,14,253,90,248,145,28,
+5,58,21,184,251,214,94,7,168,137,171,137,139,26,153,138,147,137,136,128,95,
+251,81,24,34,86,232,6,84,251,122,137,127,133,137,123,138,25,139,107,137,108,
+137,30,95,247,215,183,7,104,142,107,141,139,26,125,140,135,142,141,148,193,
+247,123,24,247,7,192,37,6,182,247,81,141,146,143,145,149,140,25,14,251,252,
+249,255,28,6,36,247,77,10,251,165,28,250,150,247,86,10,247,165,28,5,106,24,
+143,157,145,152,160,141,8,14,249,64,37,29,28,4,155,149,185,10,248,5,37,29,
+249,250,149,248,210,10,250,222,37,29,249,250,149,67,29,249,250,149,248,210,
+10,250,167,37,29,28,6,71,149,191,29,14,250,146,37,29,28,5,250,149,88,29,14,
+251,59,250,29,247,95,21,210,82,230,251,15,149,30,251,21,251,150,5,71,151,
+72,188,221,26,164,143,163,143,164,30,247,97,250,164,5,252,113,37,6,196,133,
+190,137,139,26,174,135,151,120,135,119,251,72,254,54,24,133,108,135,108,109,
+26,251,56,247,25,71,247,97,247,55,247,138,225,247,42,30,14,250,124,28,8,2,
+249,234,21,247,183,251,64,247,154,252,31,252,48,251,148,251,187,251,232,57,
+30,251,70,6,225,248,78,248,140,29,247,9,149,5,243,252,238,35,7,241,129,162,
+136,157,123,133,112,25,251,99,254,178,247,238,29,116,141,121,155,145,166,
+25,229,248,99,5,247,79,6,137,110,137,110,113,26,251,224,247,82,251,132,248,
+17,248,170,247,130,248,103,248,56,30,251,211,22,251,248,251,89,252,40,251,
+134,251,27,251,25,247,38,247,174,248,5,247,89,248,29,247,135,247,34,247,17,
+251,48,251,166,30,14,248,58,247,28,248,160,21,145,159,153,142,158,140,8,250,
+230,6,162,143,130,112,136,31,139,132,76,133,73,30,239,120,247,11,248,245,
+38,159,5,124,81,122,80,139,26,131,109,134,128,111,141,254,231,138,24,114,
+138,136,156,143,166,8,139,147,199,143,194,30,39,158,251,10,252,242,239,119,
+5,14,252,74,249,17,28,5,78,68,29,253,41,247,170,247,246,198,10,253,41,248,
+154,28,6,63,198,10,252,74,127,10,248,88,250,80,44,29,252,74,127,10,248,160,
+28,5,27,48,29,252,74,249,17,28,5,78,247,232,29,157,254,50,188,29,252,2,249,
+82,28,5,78,21,227,68,248,128,10,210,211,227,30,68,251,226,21,251,29,6,251,
+230,71,5,66,7,247,66,120,251,11,253,74,123,49,122,86,127,102,25,247,219,29,
+247,62,247,13,247,193,10,8,186,242,178,247,72,139,26,251,242,251,193,247,
+160,29,253,0,248,207,28,6,64,21,192,93,181,82,82,92,97,86,86,186,96,196,196,
+185,182,192,30,93,251,93,21,50,6,251,112,99,5,95,7,247,5,127,62,252,52,129,
+85,128,107,131,117,25,141,120,118,143,124,27,251,26,35,72,33,76,204,94,211,
+247,2,218,193,206,195,31,167,105,162,97,160,85,237,199,24,113,200,105,199,
+90,180,8,170,201,164,247,0,139,26,251,120,251,73,21,88,117,109,61,81,27,110,
+126,166,158,191,195,179,190,150,155,136,133,157,31,14,252,74,127,10,14,252,
+74,249,35,248,68,188,29,253,46,248,177,250,168,21,221,251,3,7,190,247,165,
+5,51,6,251,113,99,5,95,7,247,7,127,105,251,69,5,251,27,57,247,11,6,90,251,
+158,127,78,111,67,115,104,25,251,18,170,5,108,121,115,122,108,26,98,193,109,
+201,247,77,247,11,247,152,247,16,163,30,168,247,48,5,14,252,16,250,97,28,
+5,78,21,225,38,204,251,10,251,204,49,251,90,251,197,82,30,139,118,36,92,251,
+156,30,251,131,251,27,247,107,6,114,251,31,108,251,64,103,251,103,122,40,
+96,251,8,102,81,251,86,190,24,248,156,29,247,173,247,62,247,232,247,189,190,
+30,196,247,228,5,247,128,247,27,251,103,6,204,248,21,5,247,82,174,149,247,
+32,223,27,247,23,251,29,5,247,21,155,160,200,203,26,14,251,128,248,147,250,
+93,21,164,247,31,175,247,78,168,202,193,183,25,144,157,155,142,154,27,213,
+171,74,59,251,10,60,251,69,251,17,31,251,12,251,5,21,199,6,247,93,247,196,
+247,8,247,210,247,51,251,10,206,251,27,251,154,251,110,251,145,251,186,82,
+31,251,104,251,5,247,82,6,251,72,254,47,112,251,14,82,251,2,247,205,29,247,
+61,247,71,247,187,201,31,14,247,71,167,10,247,17,247,91,217,139,31,246,10,
+247,71,184,10,123,62,210,87,239,126,25,107,103,85,74,124,106,172,82,106,26,
+108,69,247,19,10,152,162,194,153,167,30,247,10,158,247,29,192,139,26,246,
+10,247,71,167,10,174,181,146,148,181,31,251,116,251,193,248,86,29,247,161,
+247,254,139,30,246,10,247,249,28,5,102,247,250,21,248,73,29,213,248,8,5,139,
+251,5,170,78,251,54,251,9,71,55,58,30,251,71,251,68,125,251,101,67,251,113,
+8,78,119,110,51,113,27,40,247,6,5,53,92,55,86,78,199,81,239,247,66,211,213,
+247,58,196,31,209,247,105,165,247,123,247,58,247,64,168,168,170,164,171,155,
+251,17,253,9,24,135,119,139,123,120,247,164,29,92,251,19,40,133,251,2,153,
+247,13,157,139,160,143,159,30,139,176,247,83,147,172,30,151,157,172,155,160,
+27,247,21,151,86,251,3,31,14,247,71,172,29,251,46,253,160,247,122,10,247,
+51,247,54,211,247,255,8,14,248,154,172,29,251,12,252,229,5,247,57,10,103,
+180,247,8,162,31,14,248,192,250,210,249,232,21,143,161,149,148,154,141,247,
+14,145,24,235,254,80,215,29,247,122,6,251,66,253,248,5,247,166,6,240,248,
+143,5,142,161,185,144,170,120,29,97,90,134,136,114,31,14,146,250,160,248,
+240,21,246,29,248,82,247,15,248,34,247,123,31,251,176,133,126,29,250,239,
+250,226,248,82,21,247,215,10,251,93,247,33,251,42,247,93,247,78,203,201,247,
+48,247,23,30,183,29,247,119,10,44,153,6,246,29,247,246,247,43,247,144,247,
+111,185,31,251,158,247,44,126,29,249,21,250,230,249,232,21,251,29,253,60,
+5,92,128,158,112,186,27,176,215,164,166,221,31,42,7,248,167,249,222,247,154,
+10,122,59,121,120,66,31,252,134,43,6,220,10,247,167,6,170,135,237,251,197,
+158,59,75,251,52,33,251,12,67,77,247,87,10,247,11,221,156,194,233,31,178,
+10,14,94,172,10,252,47,249,226,248,52,29,252,38,78,7,176,136,181,136,139,
+26,155,138,149,136,137,125,50,252,69,24,251,61,106,93,58,62,27,118,101,151,
+152,31,247,47,251,1,7,93,251,106,5,131,158,205,105,247,11,27,247,154,198,
+247,34,247,86,177,31,224,248,57,5,150,143,143,147,150,27,14,251,141,250,23,
+250,31,21,231,252,150,47,7,194,135,188,137,139,26,154,147,125,126,137,31,
+32,252,139,5,251,93,96,84,55,53,27,119,98,143,153,31,247,85,251,46,7,82,251,
+158,5,98,223,223,124,233,27,247,222,212,247,64,247,124,189,31,241,248,131,
+5,156,143,143,147,155,27,14,94,177,10,247,132,247,160,44,29,94,250,248,28,
+4,248,247,233,10,57,252,81,24,251,144,251,21,247,119,6,110,251,39,5,251,173,
+86,70,247,61,10,164,247,23,5,247,140,247,21,251,116,6,221,248,79,5,157,144,
+145,152,157,27,14,251,24,249,249,28,4,205,21,157,144,145,152,157,27,247,31,
+151,5,248,5,10,251,9,253,5,24,123,49,122,86,127,102,8,247,219,29,247,89,247,
+6,247,193,10,186,242,152,189,157,234,8,251,254,251,158,247,160,29,188,249,
+24,250,14,21,161,247,1,175,247,78,171,216,196,183,25,228,247,165,53,252,141,
+251,123,27,251,22,251,21,21,204,6,247,88,247,170,173,247,192,197,31,247,105,
+181,251,35,238,251,61,27,251,177,251,147,251,131,251,156,87,31,136,125,5,
+251,122,251,21,247,99,6,251,45,253,171,128,90,138,132,109,251,71,114,87,57,
+132,251,11,247,52,24,248,119,10,247,13,247,56,247,154,190,31,14,248,44,28,
+6,51,28,4,246,21,98,10,247,214,247,247,29,248,230,247,160,10,247,64,250,20,
+249,253,21,251,48,253,106,248,111,29,25,248,35,29,125,147,145,167,25,247,
+43,249,85,248,51,29,247,5,149,5,237,254,158,251,0,7,182,135,218,132,139,26,
+165,137,149,128,133,111,80,251,151,65,251,167,76,45,8,131,133,106,77,114,
+27,251,7,236,5,32,97,51,89,49,229,104,200,247,7,234,164,247,25,243,31,221,
+244,223,247,153,215,248,10,8,14,248,44,250,38,247,52,21,134,112,115,123,115,
+137,251,11,128,24,248,176,29,241,248,160,251,4,150,116,141,122,155,144,166,
+25,247,100,250,178,144,166,165,155,161,142,25,247,9,149,5,98,10,247,214,6,
+14,248,44,28,6,51,28,4,246,21,98,10,247,214,247,247,29,248,60,247,58,10,247,
+160,10,249,241,28,7,74,248,148,21,247,103,251,50,247,35,251,205,108,98,135,
+137,104,30,209,247,246,145,166,164,155,161,248,138,29,254,244,35,7,247,29,
+124,172,135,143,129,135,112,25,65,251,254,251,13,252,62,55,251,25,109,88,
+112,71,108,123,251,41,247,25,24,47,251,1,79,39,61,211,53,214,248,76,29,247,
+7,247,253,245,248,166,8,247,183,6,251,109,254,215,135,112,114,123,115,137,
+25,251,19,128,5,35,248,150,7,247,238,247,222,247,11,248,29,31,251,208,145,
+21,251,101,251,8,251,84,251,124,247,250,10,233,241,75,251,60,31,14,248,44,
+28,4,109,28,4,227,21,251,124,28,251,117,5,251,143,89,59,251,11,247,191,10,
+247,124,247,51,211,248,0,247,107,250,216,24,143,166,166,155,161,142,247,9,
+149,24,98,10,14,250,192,250,76,247,244,21,251,115,94,247,16,247,146,29,175,
+29,251,4,92,56,27,38,72,217,247,25,165,31,247,66,250,7,144,166,165,155,161,
+142,25,247,9,149,5,98,10,247,214,6,14,250,55,28,6,31,248,14,29,254,234,103,
+29,247,194,247,247,29,248,230,248,134,29,247,7,248,218,5,219,29,102,31,209,
+247,245,143,166,166,155,161,142,25,14,250,117,28,8,127,248,68,10,247,51,29,
+254,155,103,29,247,96,6,146,127,247,137,252,179,229,10,248,251,241,7,173,
+10,14,248,63,28,6,75,248,14,29,254,241,247,2,29,248,193,247,42,10,251,230,
+130,21,251,117,28,251,148,5,252,220,247,211,29,28,6,149,28,6,30,247,52,21,
+133,112,114,123,117,137,251,1,128,24,35,248,220,247,127,10,248,46,243,7,251,
+13,196,10,247,23,10,252,218,35,7,221,129,162,134,157,125,135,112,25,42,252,
+126,5,251,252,6,237,248,126,143,166,163,155,164,142,25,247,4,149,5,243,254,
+211,247,2,29,248,173,247,133,10,243,248,159,5,247,251,6,252,158,249,30,21,
+251,117,28,251,148,5,252,200,247,211,29,252,14,248,227,252,64,21,204,7,111,
+65,105,132,138,27,94,111,200,203,100,31,100,205,106,233,115,180,173,166,196,
+194,181,173,193,59,24,241,171,147,197,168,26,173,91,176,74,87,92,120,86,85,
+30,251,41,251,33,247,4,248,140,5,48,248,7,10,251,70,253,192,5,247,69,6,195,
+247,144,167,162,172,73,195,251,6,168,97,25,106,163,196,104,188,27,200,225,
+165,160,183,31,14,251,248,249,216,249,195,21,205,7,110,65,104,135,137,27,
+96,110,198,203,100,31,100,204,107,233,116,180,172,168,196,194,182,170,193,
+61,24,239,170,147,198,168,26,172,141,90,178,73,27,88,92,118,86,86,31,251,
+42,251,33,247,3,248,142,248,94,29,251,70,253,191,5,247,70,6,195,247,142,167,
+164,172,73,194,251,6,170,98,25,106,164,194,104,186,27,203,225,164,159,182,
+31,14,176,52,29,148,28,6,246,34,29,176,52,29,217,28,7,74,48,29,176,52,29,
+251,195,251,120,95,10,176,52,29,252,205,252,13,65,29,176,52,29,252,178,251,
+207,57,29,176,250,226,247,54,21,144,29,84,176,227,81,213,27,166,190,139,164,
+180,31,110,251,25,88,251,54,57,127,251,35,247,21,24,67,247,245,10,192,80,
+247,32,247,176,215,247,121,247,124,184,30,14,176,249,191,250,195,21,247,19,
+251,163,7,203,247,203,5,251,31,247,48,29,107,251,48,5,251,80,251,19,247,54,
+6,251,108,254,195,248,193,29,248,25,10,79,247,3,88,247,48,102,208,248,197,
+10,14,176,250,48,248,130,21,58,229,251,39,251,22,107,216,111,213,117,181,
+25,248,197,10,247,189,247,19,251,163,6,203,247,203,5,251,31,247,48,29,107,
+251,48,5,251,80,251,19,247,54,6,251,108,254,195,201,10,176,250,48,248,130,
+21,58,229,251,39,251,22,107,216,111,213,117,181,25,154,29,247,64,249,221,
+5,251,31,247,48,29,251,166,28,250,182,201,10,236,28,4,167,248,180,21,109,
+247,21,252,118,51,129,163,129,160,131,156,25,154,29,247,64,249,221,5,251,
+31,247,48,29,251,67,253,244,251,103,101,159,251,16,247,56,168,67,251,249,
+248,112,10,222,248,43,203,150,191,251,4,211,251,48,179,77,247,96,10,114,185,
+116,192,117,191,8,14,176,250,226,192,21,248,25,10,79,247,3,88,247,48,102,
+208,154,29,225,248,58,5,247,57,174,221,247,5,243,27,240,251,25,5,202,151,
+242,166,235,26,211,96,206,251,34,251,140,251,41,33,251,9,57,30,76,51,108,
+41,118,34,251,94,254,119,24,247,93,29,84,176,227,81,247,200,29,14,176,133,
+10,169,93,205,92,203,124,8,103,103,81,73,124,247,12,29,162,192,156,173,30,
+218,153,225,169,190,165,8,14,176,250,226,250,123,21,251,165,6,53,252,55,94,
+100,88,247,2,55,247,83,92,208,25,193,104,51,198,65,27,45,251,25,96,102,72,
+31,33,7,186,247,4,192,149,142,27,208,182,39,251,1,199,31,198,251,0,190,251,
+50,176,71,88,94,51,45,71,86,57,247,25,24,251,47,86,126,40,92,26,84,137,213,
+75,241,27,219,211,172,225,223,31,247,119,247,130,251,54,253,181,5,247,32,
+248,84,29,154,96,29,154,96,29,154,97,10,63,248,113,34,29,154,250,222,250,
+42,21,247,93,10,41,57,114,42,92,56,247,72,10,158,135,173,131,148,124,25,247,
+64,251,226,153,111,168,114,169,125,25,113,112,61,55,121,106,172,82,106,26,
+108,69,248,180,29,192,153,168,30,237,155,213,215,237,247,35,74,227,24,247,
+109,29,188,213,174,247,1,196,248,142,10,248,51,10,14,247,107,249,87,250,123,
+21,252,217,247,247,10,247,29,6,251,67,254,5,248,216,29,247,93,10,41,57,114,
+42,92,56,92,50,80,78,51,125,8,14,154,172,22,99,10,188,213,174,247,1,196,248,
+142,10,248,51,10,247,93,10,41,57,114,42,92,56,92,50,80,78,51,125,245,248,
+166,24,247,67,10,14,247,1,28,4,174,250,42,21,200,71,184,58,55,98,116,105,
+96,30,38,57,127,42,92,56,104,75,100,100,98,115,186,247,125,24,251,25,6,84,
+251,162,5,69,6,236,248,119,5,36,247,130,29,247,146,6,225,248,56,5,206,6,84,
+251,165,5,247,25,6,184,247,116,247,54,251,204,5,90,164,202,104,186,27,247,
+17,217,215,247,56,247,5,31,73,227,5,33,78,106,112,90,27,120,119,155,160,129,
+31,251,9,247,119,126,162,101,165,104,156,25,178,163,184,180,169,184,189,213,
+165,247,1,197,248,142,10,214,192,172,194,185,26,14,154,248,250,248,136,21,
+247,169,10,247,93,10,41,57,114,42,92,56,247,72,10,247,148,251,50,200,251,
+88,94,251,86,25,251,5,113,45,67,42,27,88,98,147,147,105,31,138,111,140,106,
+119,26,124,185,213,124,194,27,247,158,247,23,247,74,247,41,172,31,178,247,
+69,53,247,116,251,156,247,68,8,14,154,250,58,248,126,21,217,238,251,108,247,
+55,159,179,159,176,165,168,25,247,19,45,5,215,192,172,194,185,26,200,71,184,
+57,55,98,116,105,96,30,92,99,108,96,115,96,48,209,24,60,39,247,5,53,136,132,
+135,133,135,132,25,92,50,80,78,51,125,235,248,119,24,251,15,247,130,29,99,
+10,156,166,24,14,249,253,63,29,14,249,253,63,29,252,98,248,165,81,29,249,
+253,63,29,252,49,248,101,41,10,249,253,95,29,251,68,247,1,251,30,247,55,109,
+30,107,106,75,69,123,106,174,82,106,26,108,67,248,180,29,190,151,167,30,247,
+46,148,204,202,247,11,247,36,8,183,29,14,251,52,250,216,248,52,29,252,23,
+78,7,169,137,178,136,139,26,157,138,146,133,126,128,251,192,251,162,24,129,
+6,196,247,159,143,155,147,143,152,140,25,139,176,141,176,142,30,200,252,13,
+78,7,173,136,176,137,139,26,152,138,146,135,135,125,251,31,253,32,24,123,
+136,130,135,125,27,139,90,136,105,136,30,78,248,26,200,7,107,142,102,142,
+139,26,124,140,130,141,141,155,198,247,164,24,169,6,247,52,251,174,5,71,177,
+176,111,247,0,27,188,194,149,153,188,31,200,7,135,72,134,126,27,98,140,133,
+151,108,193,251,76,247,216,24,247,235,247,194,5,14,197,28,4,172,250,31,21,
+231,252,121,47,7,188,135,176,139,139,26,149,143,129,129,129,31,251,224,251,
+181,5,125,6,202,247,172,5,156,143,147,149,152,27,139,184,141,192,143,30,231,
+252,119,47,7,190,135,178,137,139,26,149,147,129,129,137,31,251,62,253,138,
+135,125,125,128,126,137,25,139,84,137,88,135,30,49,248,136,229,7,90,143,100,
+143,139,26,122,141,133,148,141,149,207,247,193,24,161,6,247,89,251,218,5,
+57,188,186,102,247,27,27,201,210,152,157,205,31,229,7,125,55,133,124,27,84,
+141,133,166,112,184,251,115,248,11,24,248,54,247,250,5,14,247,233,46,10,77,
+248,176,34,29,247,233,46,10,146,249,4,48,29,247,233,46,10,251,238,28,250,
+106,95,10,247,233,46,10,252,248,28,249,213,65,29,247,233,46,10,252,221,28,
+250,19,57,29,247,233,139,10,247,138,252,105,124,29,251,176,248,177,24,247,
+83,10,177,247,85,5,14,247,233,139,10,247,36,251,167,251,56,251,36,219,48,
+247,34,247,17,183,55,124,29,40,247,79,24,247,75,247,53,58,229,251,52,251,
+32,251,19,247,135,247,83,10,177,247,85,5,14,247,233,28,4,139,248,195,21,58,
+229,251,52,251,32,251,19,247,135,248,164,248,139,211,10,251,107,254,210,24,
+94,10,247,36,251,167,251,56,251,36,219,48,247,34,247,17,183,55,124,29,40,
+247,79,24,14,248,13,28,5,203,249,166,21,111,247,23,252,204,35,248,100,248,
+78,211,10,34,252,166,24,251,162,90,158,251,16,247,116,178,56,252,58,5,94,
+10,247,138,252,105,124,29,251,137,248,101,24,14,247,233,28,6,72,28,4,168,
+21,247,13,251,50,233,251,50,251,2,251,5,96,65,76,30,252,71,252,142,5,248,
+215,29,124,29,251,176,248,177,24,248,62,248,119,5,174,169,162,161,168,27,
+157,161,131,131,148,31,251,103,7,163,125,154,114,208,141,8,221,141,205,231,
+209,26,14,247,233,117,29,188,44,186,92,247,3,125,25,247,4,115,138,58,107,
+251,178,8,247,42,6,242,248,167,115,137,5,131,39,130,119,27,76,141,130,158,
+92,229,251,176,248,177,24,248,164,248,139,5,14,247,233,106,241,21,37,248,
+232,241,7,92,143,79,143,139,26,111,141,128,150,160,157,248,97,248,85,24,155,
+6,51,252,81,133,113,126,132,119,137,25,139,82,137,83,133,30,37,248,216,241,
+7,86,145,83,141,139,26,119,141,127,146,145,163,247,107,250,210,24,165,143,
+153,147,160,27,139,215,144,192,143,30,241,252,236,37,7,188,135,196,134,139,
+26,162,137,153,135,135,113,49,252,89,24,92,6,251,138,248,105,5,247,5,80,83,
+186,251,58,27,64,53,122,117,65,31,36,7,145,241,148,160,27,202,137,148,120,
+186,49,247,176,252,177,24,252,164,252,139,5,14,247,28,28,4,165,248,232,21,
+247,14,252,134,7,124,173,248,85,248,139,247,45,156,5,241,252,143,37,7,179,
+135,190,135,139,26,163,137,148,128,121,121,252,28,252,85,24,126,6,214,248,
+81,144,165,150,146,156,141,25,139,187,141,187,145,30,241,252,129,37,7,184,
+133,186,137,139,26,156,137,150,132,133,115,53,252,149,24,251,73,251,14,247,
+52,6,64,252,87,5,113,135,127,131,122,27,139,74,134,94,135,30,37,248,146,241,
+7,97,143,91,144,139,26,119,141,127,143,143,165,215,248,89,24,179,6,247,101,
+252,105,5,251,5,189,187,92,247,33,27,203,212,156,161,202,31,242,7,134,52,
+130,121,27,86,141,131,158,99,229,251,64,248,21,24,14,247,189,85,10,14,247,
+189,85,10,251,164,248,169,34,29,247,189,117,10,7,247,89,153,251,17,251,187,
+106,31,247,42,6,241,248,160,183,10,14,248,163,28,6,207,28,4,238,21,235,29,
+235,248,123,24,145,166,164,155,161,142,247,11,149,24,243,253,224,7,247,251,
+10,247,57,6,251,112,254,226,163,10,14,247,189,249,149,250,101,21,247,13,251,
+45,7,162,247,8,247,106,29,252,240,247,65,29,116,251,8,5,251,68,251,13,247,
+44,6,251,54,253,197,163,10,235,29,188,247,142,24,14,248,34,28,6,78,28,4,238,
+21,204,94,219,251,31,32,67,110,92,82,30,251,62,251,33,133,248,111,10,131,
+126,108,113,110,120,209,247,242,24,251,41,6,55,252,51,100,124,92,129,104,
+135,25,235,248,123,128,10,251,19,128,5,35,248,238,248,133,10,225,248,72,162,
+135,192,133,176,128,25,63,252,25,5,247,41,6,189,247,138,5,139,163,135,145,
+127,30,247,68,251,234,5,65,248,56,243,7,251,33,150,251,130,248,101,117,182,
+63,165,67,152,25,209,173,239,211,193,221,216,247,7,174,247,33,244,247,198,
+10,14,247,189,249,130,249,42,21,248,206,29,235,248,123,24,145,166,164,155,
+161,142,247,11,149,24,248,192,10,248,240,248,133,29,225,248,72,247,199,251,
+90,247,54,251,117,81,251,141,25,251,3,113,36,41,251,31,27,105,94,147,146,
+105,31,137,111,138,76,137,119,8,126,174,200,123,210,27,247,150,247,108,247,
+67,247,97,183,31,195,247,154,251,107,247,126,251,209,247,88,8,14,247,189,
+28,4,204,249,127,21,200,243,251,146,247,42,175,212,177,213,199,199,25,247,
+95,251,17,5,229,203,190,157,236,26,247,131,10,43,59,95,54,98,52,251,25,218,
+24,77,35,247,33,56,121,108,119,108,115,109,25,247,189,10,252,240,247,65,29,
+251,101,254,178,248,211,29,148,153,149,153,147,154,8,14,250,9,56,10,14,250,
+9,56,10,252,172,248,220,77,10,250,9,56,10,252,187,248,95,41,10,250,9,76,29,
+7,247,89,169,248,102,29,251,23,196,10,14,252,98,56,29,14,253,69,247,172,252,
+61,21,206,7,247,22,29,208,219,159,169,203,30,14,253,63,248,152,249,199,21,
+207,7,114,78,87,127,117,27,106,133,170,167,145,31,247,56,249,161,5,51,248,
+146,10,251,37,253,68,5,135,123,139,125,124,26,84,190,102,227,209,217,157,
+170,202,30,14,252,98,56,29,247,153,28,7,24,34,29,252,98,56,29,251,47,252,
+199,44,29,252,98,56,29,251,75,251,126,247,38,29,252,98,56,29,251,217,252,
+19,65,29,252,98,56,29,251,217,252,19,71,10,249,10,28,8,121,80,29,252,98,56,
+29,251,190,251,213,57,29,251,81,56,29,247,159,249,17,240,29,251,7,56,29,248,
+27,28,5,95,81,10,252,98,249,3,247,62,21,96,42,59,121,107,27,87,129,192,186,
+147,31,247,144,28,5,20,221,29,178,208,146,157,185,30,247,125,29,247,148,247,
+121,186,30,14,253,62,248,156,250,11,21,247,22,29,164,184,143,150,169,30,121,
+59,105,42,86,132,45,216,24,93,129,87,105,91,26,92,173,104,230,247,77,188,
+247,45,247,30,170,30,14,252,98,249,76,249,39,21,247,28,251,115,7,247,31,249,
+94,150,10,251,0,252,195,5,251,120,251,28,247,93,6,51,252,90,5,135,112,135,
+248,34,10,244,29,228,248,86,5,14,252,98,249,94,250,194,21,247,18,251,55,7,
+200,247,205,150,10,108,251,50,5,251,79,251,18,247,55,6,251,60,253,245,5,135,
+112,135,248,195,29,249,241,5,14,252,98,249,107,249,146,21,247,25,251,123,
+7,247,8,248,246,150,10,51,252,91,5,251,109,251,25,247,83,6,124,63,5,251,119,
+251,27,247,93,6,71,251,242,247,64,29,244,29,207,247,238,5,247,140,247,27,
+251,113,6,153,215,5,14,252,39,249,216,249,254,21,251,3,6,84,123,89,96,96,
+27,113,110,145,145,113,31,247,31,249,101,150,10,45,252,118,5,141,126,129,
+139,127,27,251,30,41,251,4,251,33,78,31,247,2,6,194,156,188,182,182,27,166,
+165,133,133,166,31,43,252,138,247,65,10,219,248,50,5,137,151,151,139,152,
+27,247,31,235,247,4,247,33,201,31,14,252,98,249,5,251,236,21,247,242,29,143,
+191,145,173,30,247,189,28,6,0,150,10,251,127,28,251,69,247,228,10,30,14,253,
+62,248,157,248,215,21,181,122,173,81,160,30,37,52,5,108,148,139,191,176,26,
+169,142,170,143,160,30,247,85,250,45,5,51,248,7,10,251,45,253,106,5,130,94,
+132,90,93,26,251,8,187,251,3,247,88,199,208,161,192,30,14,251,252,249,119,
+247,152,21,247,1,59,208,35,80,87,121,122,94,30,247,105,250,230,150,10,251,
+109,254,240,251,15,251,11,127,126,251,13,251,49,25,246,63,208,241,158,164,
+215,221,25,32,192,247,9,139,216,27,247,114,247,53,247,21,247,48,31,251,66,
+121,21,63,74,71,69,80,116,191,184,149,30,156,214,5,162,174,190,172,180,27,
+190,151,89,105,31,14,252,23,249,136,249,66,21,53,227,63,65,100,131,110,125,
+25,247,54,249,211,5,247,50,29,74,251,228,5,133,112,137,115,116,26,43,219,
+75,247,27,245,233,164,198,247,17,30,247,5,7,96,47,53,119,113,27,85,127,190,
+192,149,31,205,247,224,231,159,221,188,219,211,25,252,97,247,87,247,171,29,
+252,23,248,138,248,181,21,231,159,221,188,219,211,53,227,24,63,65,100,131,
+110,125,247,54,249,211,24,247,50,29,61,252,38,247,228,10,247,242,29,145,205,
+143,159,30,44,250,32,247,171,29,251,12,250,89,198,21,244,29,247,33,249,108,
+252,2,251,29,247,27,249,89,5,251,27,248,49,10,247,71,123,251,40,253,144,248,
+6,247,34,37,252,163,247,64,29,14,252,98,98,250,64,21,251,3,7,182,236,219,
+157,171,27,191,149,86,92,131,31,251,136,28,251,21,5,247,27,6,247,238,204,
+5,213,7,251,72,155,247,107,250,232,5,145,166,141,163,162,26,233,59,201,251,
+27,33,251,15,106,88,40,30,14,251,160,249,147,248,48,29,111,170,150,193,25,
+247,145,28,5,24,150,10,251,121,28,251,104,134,111,135,116,25,39,120,240,162,
+10,247,81,56,29,249,21,28,5,19,68,29,247,57,28,4,226,198,21,244,29,247,59,
+249,242,5,247,109,247,19,251,85,6,200,247,203,150,10,108,251,48,5,251,248,
+6,200,247,203,150,10,108,251,48,5,251,103,251,19,247,79,6,251,60,253,246,
+5,133,112,137,248,195,29,249,242,5,247,248,6,251,60,253,246,247,64,29,14,
+247,93,28,4,223,236,10,119,143,119,147,120,31,137,129,131,139,133,27,87,129,
+192,186,147,31,247,144,28,5,20,221,29,213,221,156,165,216,30,113,189,208,
+122,229,247,24,29,247,28,248,59,22,247,61,249,250,5,247,10,6,251,13,253,8,
+248,93,29,234,247,27,182,170,222,30,140,247,8,5,116,74,59,114,93,27,75,108,
+182,202,154,31,247,21,249,31,5,247,152,247,5,251,132,6,220,248,56,251,180,
+59,73,251,232,5,251,11,6,221,248,56,251,180,59,73,251,232,5,251,88,251,9,
+247,65,6,251,60,253,250,5,14,247,28,250,37,249,245,21,247,11,7,251,203,251,
+14,154,226,247,222,247,21,5,247,11,7,251,199,251,12,163,247,29,140,145,145,
+162,160,153,163,142,25,247,6,149,5,243,252,221,35,7,247,1,129,162,136,155,
+124,136,114,25,136,7,94,251,145,251,178,251,4,5,251,11,7,247,156,242,124,
+53,251,175,251,3,5,251,11,7,247,152,241,251,0,252,255,5,247,218,6,248,33,
+247,91,247,212,247,192,192,31,251,144,6,251,118,99,40,251,161,251,117,27,
+75,6,246,248,245,5,14,247,159,28,5,90,250,87,21,247,209,29,32,41,89,72,73,
+31,247,9,248,238,221,29,237,247,42,183,187,239,30,115,190,247,6,73,247,7,
+247,35,29,251,226,160,21,221,248,62,5,109,160,170,116,183,27,247,138,29,252,
+241,253,77,109,154,134,181,146,177,25,14,247,116,28,5,92,250,39,21,251,76,
+248,132,10,40,251,35,243,251,48,27,92,92,129,122,96,31,237,248,148,221,29,
+245,247,15,172,190,238,30,244,29,247,11,248,242,5,166,164,200,149,166,196,
+203,92,245,27,182,215,131,141,194,31,252,162,252,99,247,31,251,11,197,217,
+5,247,8,116,247,5,251,10,251,19,26,251,87,251,72,251,68,251,36,123,80,131,
+190,104,30,90,248,32,10,247,70,57,247,132,247,215,247,196,247,91,247,189,
+247,105,251,34,247,23,251,121,165,31,14,251,168,248,0,248,36,21,136,195,135,
+205,217,26,248,59,221,247,150,220,188,163,100,251,115,251,110,39,251,118,
+251,21,251,67,30,247,188,68,21,251,91,65,75,106,95,27,102,101,180,247,17,
+116,31,247,79,247,114,247,42,247,212,247,199,26,247,154,75,170,251,0,251,
+16,251,103,251,183,253,79,75,143,78,150,89,30,80,83,79,95,82,110,189,50,24,
+190,166,192,176,189,185,8,251,0,182,209,84,233,27,222,208,170,247,176,247,
+15,31,14,251,71,247,76,247,248,21,239,247,89,216,251,89,171,247,13,181,247,
+13,178,247,12,25,213,251,17,205,251,29,251,64,26,38,95,59,45,105,30,149,103,
+5,247,55,163,237,209,247,36,26,247,111,251,26,247,66,42,247,80,30,179,247,
+28,169,247,26,247,21,26,244,91,175,67,251,25,85,251,9,46,251,37,217,251,16,
+220,251,25,30,118,68,116,68,117,72,66,247,76,24,251,99,252,35,5,248,70,250,
+15,21,140,46,120,251,3,110,251,7,8,101,225,113,230,239,26,208,152,188,182,
+174,158,127,75,140,30,14,247,28,250,132,248,161,21,247,17,252,25,7,146,176,
+146,177,145,179,8,248,5,247,17,251,237,6,176,247,52,215,247,102,247,79,151,
+248,131,10,247,9,251,49,190,251,32,252,4,251,47,251,197,251,104,78,30,251,
+82,251,17,247,54,138,6,125,251,6,5,251,40,251,17,247,23,6,127,63,121,66,108,
+76,92,49,55,43,251,19,114,8,37,250,197,247,74,252,103,7,92,251,1,133,113,
+37,31,247,35,247,1,205,247,13,179,247,37,8,14,197,45,10,14,251,236,249,198,
+250,157,21,39,6,85,251,49,5,129,135,119,132,125,27,251,126,6,247,33,249,43,
+143,154,149,143,150,140,25,139,182,142,183,142,30,200,252,38,78,7,177,136,
+179,136,139,26,154,138,149,135,135,126,251,30,253,32,24,136,123,134,137,114,
+137,8,139,99,137,103,135,30,78,249,49,7,14,251,57,249,250,247,203,21,247,
+217,10,247,62,249,148,247,94,10,251,58,253,129,24,135,125,133,128,114,137,
+8,248,161,10,14,252,125,249,60,250,96,21,47,6,137,136,106,37,139,26,126,135,
+127,134,122,27,251,72,6,247,2,248,96,5,146,141,144,147,149,27,139,172,142,
+180,141,30,194,251,228,84,7,177,137,168,138,139,26,151,137,142,137,136,126,
+251,0,252,85,24,136,131,136,132,122,138,8,139,107,138,105,136,30,84,248,185,
+7,14,197,45,10,233,28,7,3,34,29,197,45,10,251,178,252,140,44,29,197,45,10,
+251,82,251,67,95,10,197,45,10,252,92,251,216,65,29,197,45,10,252,92,251,216,
+71,10,248,230,28,8,41,80,29,197,45,10,252,65,251,154,57,29,247,223,45,10,
+248,47,249,76,240,29,197,45,10,247,129,28,5,64,81,10,197,223,10,243,248,164,
+5,247,161,247,25,251,134,6,225,248,81,112,10,53,252,83,24,251,146,251,25,
+247,120,6,38,252,142,247,4,29,197,250,15,250,93,21,247,21,251,166,7,165,247,
+23,112,10,113,251,25,24,251,114,251,21,247,88,6,251,53,253,204,135,113,131,
+135,100,135,25,248,12,29,221,248,50,5,248,22,10,247,58,249,226,5,14,197,223,
+10,209,247,242,5,247,137,247,19,251,113,6,170,247,46,5,247,138,247,17,251,
+114,6,207,247,242,112,10,72,251,244,24,251,132,251,17,247,105,6,110,251,46,
+5,251,131,251,19,247,107,6,73,251,220,247,4,29,197,250,205,248,52,21,251,
+45,6,55,251,154,5,120,133,108,129,118,27,251,252,6,243,248,164,5,135,168,
+164,135,159,248,150,10,251,0,6,86,120,92,96,94,27,106,98,145,149,94,31,219,
+248,48,5,161,145,154,148,157,27,139,205,143,206,145,30,248,143,29,198,135,
+200,135,139,26,162,137,155,132,133,115,74,251,230,24,143,112,114,141,121,
+27,251,31,43,251,5,248,78,29,170,180,131,129,182,31,251,7,252,216,135,113,
+131,135,100,137,25,139,78,135,83,134,30,35,250,154,7,14,251,57,249,67,248,
+250,21,76,247,21,251,47,60,186,247,102,247,94,10,60,251,249,24,251,103,32,
+202,251,21,246,194,93,251,103,135,125,133,128,114,137,25,248,161,10,208,247,
+203,5,247,217,10,222,248,13,5,14,247,60,250,234,22,220,248,51,5,251,43,6,
+59,251,135,5,123,134,120,108,108,27,252,3,6,205,247,232,231,159,220,188,219,
+211,25,53,227,66,68,100,128,110,126,25,247,15,249,10,144,165,160,145,152,
+140,25,247,25,149,5,248,143,29,247,12,129,177,136,136,125,135,117,25,80,251,
+193,5,143,116,115,141,125,27,251,81,51,251,9,251,25,251,3,239,61,247,40,115,
+31,77,251,211,134,112,132,134,100,136,25,251,9,130,5,37,7,247,146,248,220,
+21,73,157,80,178,186,26,217,189,188,220,155,151,131,133,147,30,14,248,58,
+28,5,165,247,64,10,247,43,249,152,252,28,251,36,233,248,114,112,10,251,30,
+253,77,24,248,30,247,38,34,252,171,247,4,29,197,247,5,250,84,21,247,45,6,
+223,247,154,5,156,145,170,151,160,27,247,252,6,251,109,254,230,133,115,124,
+132,121,137,25,139,73,135,72,133,30,37,248,254,241,7,80,145,78,143,139,26,
+116,141,123,146,145,161,247,105,250,210,24,143,165,147,143,178,143,8,139,
+200,141,195,146,30,241,254,154,7,14,249,89,45,10,249,165,28,5,78,68,29,250,
+226,45,10,28,4,248,181,29,14,248,194,28,6,45,247,64,10,247,109,250,230,248,
+62,29,254,242,37,7,247,198,29,248,112,29,111,127,135,108,137,8,248,50,29,
+28,5,250,7,253,62,28,4,238,21,162,137,155,132,133,117,248,112,29,113,131,
+135,100,135,8,139,114,138,107,137,30,101,142,109,141,139,26,112,141,131,145,
+143,161,247,105,250,210,24,143,157,145,152,160,141,212,144,24,177,135,171,
+138,139,26,14,248,239,60,29,14,141,250,95,252,61,21,196,7,122,101,85,125,
+120,27,106,131,166,174,147,31,215,247,223,5,236,161,69,202,44,27,70,48,104,
+91,70,31,180,119,96,181,67,27,78,68,110,98,75,31,155,209,5,47,6,251,112,247,
+216,10,178,173,199,202,195,27,196,125,73,91,128,31,47,252,40,5,247,68,6,235,
+248,55,5,166,157,197,211,218,27,174,147,100,63,121,31,67,251,219,5,79,125,
+206,108,220,27,207,200,158,170,206,31,14,150,28,4,184,249,199,105,29,247,
+56,28,4,170,105,29,248,239,60,29,251,236,28,5,56,34,29,248,239,60,29,252,
+167,28,4,254,47,29,248,239,60,29,253,230,252,19,65,29,249,77,28,6,149,201,
+21,251,21,6,83,251,173,85,29,196,247,166,21,234,7,110,81,55,116,111,27,87,
+127,184,197,151,31,248,220,29,244,233,170,192,242,31,14,248,239,28,6,179,
+249,2,21,251,13,6,66,113,66,105,251,30,251,175,252,41,246,251,142,27,251,
+207,45,58,251,67,76,31,247,13,6,218,161,221,169,247,35,247,176,248,32,251,
+1,247,141,27,247,210,245,230,247,57,186,31,110,252,199,21,234,7,110,81,55,
+116,111,27,87,127,184,197,151,31,248,220,29,244,233,170,192,242,31,14,247,
+28,28,4,239,28,4,149,21,251,1,6,251,28,251,61,5,152,118,115,146,113,27,65,
+41,80,59,65,31,208,117,93,209,61,27,73,63,90,71,70,31,156,247,9,5,40,6,251,
+128,71,5,70,7,247,12,122,251,18,253,250,5,247,82,6,242,249,74,5,203,176,203,
+245,199,27,201,123,251,2,59,127,31,85,252,8,251,253,252,85,5,247,5,6,247,
+115,247,170,120,251,23,5,247,81,6,201,248,57,247,134,247,195,138,123,137,
+122,136,120,25,61,252,181,5,39,124,211,87,226,27,212,205,170,192,211,31,234,
+7,110,99,80,116,119,27,103,130,184,197,148,31,221,248,187,150,214,129,203,
+114,185,25,252,11,251,135,21,184,159,202,247,13,224,27,149,147,134,130,145,
+31,251,100,251,151,5,14,249,217,28,7,80,249,201,21,251,246,253,93,102,151,
+110,170,151,193,25,74,10,5,39,118,242,162,10,248,235,28,6,51,249,191,21,247,
+23,43,221,251,21,32,251,31,80,59,33,30,164,29,251,31,253,64,110,251,25,102,
+251,13,82,79,25,251,52,247,9,5,45,106,70,105,65,26,51,220,102,232,248,31,
+247,19,248,11,247,158,194,30,247,17,248,226,5,143,159,141,156,157,26,14,133,
+28,4,121,248,68,10,217,73,188,57,70,49,102,92,69,30,190,10,47,252,48,123,
+59,114,68,102,102,25,37,210,5,75,119,94,116,96,26,88,193,115,198,247,150,
+221,247,119,247,52,176,30,221,247,244,5,141,151,141,150,151,26,14,248,239,
+103,10,115,251,9,5,247,33,6,247,228,207,5,209,7,251,64,155,5,14,150,28,4,
+145,28,5,102,21,251,70,6,45,252,51,5,100,104,78,75,83,27,82,156,207,188,149,
+31,231,248,37,5,251,68,6,43,252,53,5,112,120,80,65,61,27,104,133,180,215,
+155,31,211,247,220,5,198,153,74,170,57,27,71,76,120,107,73,31,83,7,156,176,
+194,153,160,27,172,145,110,105,131,31,65,251,222,5,40,116,209,78,233,27,209,
+229,174,188,209,31,96,157,182,98,213,27,200,211,168,180,202,31,123,69,5,229,
+6,247,111,178,5,182,7,251,2,147,5,14,248,239,103,10,251,13,252,197,5,247,
+34,6,247,230,205,5,208,7,251,64,156,5,14,149,28,4,148,28,5,104,21,251,69,
+6,44,252,52,5,101,105,78,75,84,27,81,153,206,187,151,31,231,248,39,5,251,
+69,6,43,252,56,5,114,121,79,66,61,27,104,133,179,215,156,31,212,247,218,5,
+200,153,72,169,58,27,70,78,121,106,72,31,84,7,155,176,194,153,159,27,171,
+147,111,106,131,31,64,251,223,5,41,117,209,76,232,27,210,228,175,187,208,
+31,97,159,182,97,212,27,200,211,169,179,203,31,60,251,228,5,232,6,247,111,
+178,5,181,7,251,4,149,5,14,247,197,247,166,251,45,21,234,6,110,197,116,223,
+167,26,179,165,155,178,151,152,138,136,152,30,248,187,251,9,5,135,160,158,
+136,158,27,247,20,220,239,247,18,246,80,247,31,59,245,31,208,170,209,205,
+247,4,26,233,90,247,1,71,237,30,247,9,115,5,247,33,7,71,247,230,5,70,6,122,
+251,64,253,250,247,72,5,251,164,7,249,74,251,38,5,203,86,245,47,53,26,89,
+104,124,93,107,102,147,146,106,30,137,136,140,247,33,253,56,31,251,162,7,
+249,78,251,40,5,184,111,247,13,49,251,13,26,103,110,122,84,110,103,144,148,
+96,30,252,181,247,4,5,141,130,131,140,131,27,56,95,43,251,5,34,170,45,192,
+36,31,14,248,54,247,118,29,102,131,31,106,251,45,251,10,252,93,77,36,238,
+29,247,27,247,86,223,247,224,10,248,54,247,118,29,99,130,31,92,251,99,56,
+251,239,57,251,48,238,29,176,180,146,148,180,30,251,116,251,193,248,86,29,
+247,166,248,4,247,224,10,249,142,60,10,14,249,142,60,10,14,247,6,28,5,93,
+248,52,29,252,0,94,7,251,204,252,147,37,248,152,5,179,251,245,78,7,176,136,
+178,136,139,26,157,138,148,136,136,125,251,29,253,32,24,135,123,128,137,120,
+138,8,139,101,136,102,135,30,78,247,253,200,7,98,143,99,142,139,26,127,140,
+129,143,142,152,234,248,103,24,247,0,252,189,5,247,22,6,247,238,248,198,40,
+252,111,5,125,136,127,134,124,27,139,98,136,99,135,30,78,248,38,200,7,102,
+143,98,142,139,26,123,140,129,141,141,154,247,30,249,31,24,142,150,143,144,
+150,140,8,14,248,26,28,5,244,250,31,21,231,252,103,78,7,252,11,252,224,251,
+9,248,228,5,196,252,90,47,7,194,135,178,137,139,26,161,137,145,127,137,126,
+251,55,253,125,24,137,129,128,120,117,137,8,139,90,137,85,135,30,47,248,101,
+231,7,78,143,100,141,139,26,123,141,130,150,143,157,244,248,119,24,247,15,
+252,248,5,247,66,6,248,35,248,254,33,252,125,137,129,128,120,121,137,25,139,
+88,137,79,135,30,47,248,152,231,7,84,143,98,141,139,26,119,141,131,152,143,
+155,247,55,249,125,24,150,142,143,151,157,27,14,249,142,60,10,251,241,248,
+174,34,29,249,142,60,10,252,172,248,116,47,29,249,142,60,10,254,23,28,249,
+211,65,29,249,142,28,6,231,28,4,205,21,144,157,145,147,157,141,247,31,154,
+24,168,29,251,74,254,64,5,251,124,94,251,28,251,0,66,27,104,124,159,156,125,
+31,104,247,64,5,139,92,155,94,69,37,82,71,125,30,251,39,110,247,13,57,247,
+160,27,247,253,247,74,247,254,246,159,31,14,248,218,87,29,28,4,156,249,32,
+28,4,190,21,247,157,10,251,53,253,185,5,133,107,135,106,108,26,251,105,247,
+52,251,25,247,137,247,54,247,19,205,214,247,17,30,59,190,231,78,247,50,27,
+247,72,188,186,239,247,36,31,114,251,6,5,248,111,243,6,84,143,61,145,139,
+26,121,142,133,145,143,159,247,105,250,195,24,247,157,10,251,76,254,47,5,
+77,46,51,65,33,27,251,19,71,246,247,80,176,31,247,44,249,144,143,166,163,
+155,164,141,25,247,3,150,5,248,66,10,251,52,253,185,127,78,135,82,145,89,
+25,103,61,43,89,65,27,251,19,251,13,247,1,247,78,176,31,14,249,103,28,5,54,
+247,200,10,119,35,235,128,161,137,157,123,134,112,25,251,97,254,199,251,59,
+28,4,211,5,251,46,6,253,9,28,251,53,247,95,250,191,144,166,163,155,163,141,
+25,247,2,150,159,243,5,252,100,6,119,35,247,3,128,161,137,159,123,248,125,
+10,115,136,25,251,7,129,120,35,5,248,212,6,149,196,248,87,250,1,247,5,254,
+1,129,82,5,248,206,6,158,243,251,5,149,117,142,121,248,12,10,163,155,163,
+141,25,247,9,150,159,243,5,14,28,5,232,28,6,243,28,5,127,21,251,82,6,252,
+131,254,51,251,40,250,51,5,251,82,6,253,67,28,250,250,251,22,122,120,35,5,
+248,84,6,158,243,35,154,109,143,141,161,146,156,25,248,90,249,253,247,24,
+253,251,142,122,132,115,115,135,25,251,8,124,120,35,5,248,208,6,158,243,251,
+17,158,121,247,3,248,52,249,181,247,59,254,192,5,247,82,6,249,68,28,5,6,247,
+21,156,159,243,5,252,85,6,119,35,244,124,169,135,137,117,132,122,25,252,90,
+253,253,5,14,249,114,119,29,248,84,247,58,10,247,138,10,14,212,250,212,247,
+95,21,247,24,92,202,33,245,30,251,131,247,134,247,34,247,70,5,55,236,116,
+94,182,27,177,214,184,247,34,211,121,217,34,215,31,67,192,108,168,178,162,
+149,131,151,26,151,140,145,120,106,251,18,57,251,33,79,146,91,242,61,30,251,
+28,251,63,251,177,247,176,5,251,31,247,32,119,163,189,162,164,161,148,26,
+154,141,152,119,106,251,4,43,251,30,251,24,181,76,246,32,30,186,92,5,251,
+30,251,44,96,34,47,251,10,247,5,251,8,63,26,87,74,115,79,132,30,129,90,5,
+247,146,6,236,219,206,230,31,247,58,251,126,247,7,247,57,26,173,145,176,186,
+208,30,248,113,252,113,5,247,35,251,34,156,113,92,115,114,119,127,26,128,
+137,123,158,172,247,8,235,247,30,30,14,251,222,249,19,252,68,21,136,198,5,
+123,99,97,128,111,27,126,112,147,179,147,31,211,247,238,5,243,160,106,195,
+251,25,27,69,59,109,98,74,31,156,210,5,46,6,251,110,247,216,10,192,194,210,
+187,180,27,167,157,119,79,125,31,58,252,11,5,75,125,229,126,197,27,200,240,
+161,160,185,31,14,251,213,250,1,249,191,21,136,198,5,125,101,96,129,110,248,
+97,29,161,105,197,251,26,247,15,29,58,252,13,5,73,124,229,129,199,27,200,
+239,162,157,185,31,14,234,40,10,251,12,28,5,68,34,29,234,40,10,251,139,250,
+205,42,10,234,40,10,88,28,5,152,48,29,234,40,10,251,199,28,5,10,47,29,234,
+40,10,252,93,252,187,44,29,234,40,10,251,253,251,114,95,10,234,40,10,253,
+7,252,7,65,29,234,40,10,252,236,251,201,57,29,234,28,4,147,247,37,21,247,
+197,29,247,3,248,212,73,10,251,17,253,5,248,43,29,172,204,139,164,182,31,
+113,251,25,88,251,54,55,127,251,36,247,21,24,68,247,245,10,194,80,247,29,
+247,179,215,247,121,247,124,184,30,14,234,28,4,185,249,2,21,251,14,6,73,111,
+89,98,41,251,94,251,88,246,251,70,27,251,116,43,55,251,64,73,31,247,14,6,
+211,164,188,176,241,247,94,247,89,251,1,247,69,27,247,119,239,240,247,47,
+198,31,106,252,211,21,134,237,5,247,197,29,247,3,248,212,73,10,251,17,253,
+5,247,29,10,14,247,1,28,4,224,248,189,21,109,247,21,251,63,108,160,244,247,
+80,29,60,252,19,251,87,104,159,251,16,247,39,165,66,251,246,5,247,165,6,223,
+248,40,247,206,195,68,251,248,247,29,10,134,237,5,247,197,29,203,247,224,
+5,252,185,247,74,21,248,81,10,112,251,24,251,205,81,5,14,247,222,28,5,85,
+248,48,29,110,170,151,193,25,245,248,187,73,10,251,15,252,238,5,39,118,247,
+15,162,10,234,28,4,152,186,21,134,237,5,247,197,29,247,3,248,212,247,80,29,
+251,84,254,62,112,251,14,94,251,1,247,205,29,247,74,247,62,247,187,201,31,
+247,37,249,78,248,186,10,233,247,46,176,174,211,31,14,251,213,250,1,249,191,
+21,136,198,5,125,99,96,129,112,248,97,29,159,107,197,251,26,27,70,59,108,
+98,73,31,156,211,5,49,248,49,29,247,2,129,251,17,252,200,123,66,108,73,112,
+137,25,68,231,5,104,69,94,84,98,162,88,223,247,62,247,11,241,247,68,180,31,
+233,248,56,5,192,194,209,189,182,27,167,156,118,80,126,31,58,252,13,5,73,
+124,229,129,199,27,198,239,162,157,187,31,14,201,250,193,247,150,29,248,136,
+10,251,72,253,250,187,10,251,242,249,179,28,5,8,21,211,98,178,251,1,70,59,
+108,98,73,30,156,211,5,46,248,49,29,247,5,129,251,9,248,151,10,192,194,208,
+189,182,27,168,156,118,80,124,31,43,252,81,116,35,119,83,98,113,25,41,206,
+5,104,129,61,117,81,26,102,188,105,219,247,87,247,25,247,31,247,29,165,30,
+236,248,99,5,143,157,139,158,153,26,14,234,28,4,190,251,189,21,215,64,157,
+81,149,30,251,21,251,23,5,107,144,93,169,176,26,176,164,247,9,155,223,30,
+247,40,249,150,73,10,251,39,253,117,5,126,77,129,59,107,26,251,64,247,17,
+251,7,247,150,247,19,239,205,245,30,14,251,219,250,27,248,242,21,184,88,150,
+102,147,30,55,59,5,119,141,110,157,162,26,161,155,209,150,188,30,233,248,
+99,5,243,161,107,197,251,28,247,15,29,43,252,81,5,131,102,133,92,119,26,36,
+219,70,247,62,221,204,178,204,30,14,247,67,28,5,12,247,152,21,244,57,182,
+41,98,98,124,127,100,30,211,248,11,73,10,143,133,35,252,134,139,26,251,52,
+251,39,100,88,65,251,9,236,69,24,194,240,198,216,223,213,8,72,178,215,89,
+247,25,27,247,101,247,31,247,21,247,48,31,251,37,98,21,76,131,81,69,62,27,
+102,116,174,180,145,31,139,154,215,143,159,30,157,169,193,166,173,27,176,
+168,104,90,133,31,14,234,28,4,152,186,21,134,237,5,247,197,29,247,3,248,212,
+73,10,251,17,253,5,121,50,230,109,222,132,25,104,102,83,75,125,247,12,29,
+161,189,155,173,30,228,150,245,167,196,167,8,14,234,250,211,252,35,21,135,
+237,5,112,80,71,123,96,27,119,98,149,209,151,31,247,91,250,144,5,247,64,172,
+87,235,239,29,251,105,254,195,5,251,1,117,247,31,121,229,27,233,247,46,176,
+172,210,31,14,249,126,40,10,249,25,28,5,31,68,29,226,33,10,14,226,33,10,251,
+99,250,195,42,10,226,33,10,58,28,5,66,81,29,226,250,95,191,21,87,7,251,123,
+251,202,248,86,29,247,163,248,3,139,30,99,183,5,179,94,78,29,251,19,28,5,
+66,81,29,226,33,10,103,28,5,28,80,29,226,33,10,107,28,5,2,41,10,52,28,4,152,
+248,52,29,252,1,78,7,175,136,179,136,139,26,155,138,152,136,136,125,41,252,
+89,24,251,151,248,137,5,176,251,205,78,7,176,136,177,136,139,26,157,138,149,
+136,135,125,251,29,253,32,24,135,123,129,137,120,138,8,139,101,136,101,135,
+30,78,248,1,200,7,100,143,101,142,139,26,120,140,131,141,142,154,242,248,
+121,24,247,189,252,207,5,247,41,6,247,50,249,117,141,150,148,145,150,141,
+25,14,247,46,28,5,8,250,31,21,248,4,29,251,6,252,148,24,251,206,248,220,5,
+192,252,39,47,7,192,135,184,137,139,26,151,137,152,127,137,126,251,58,253,
+125,24,137,129,128,120,119,137,8,139,90,137,84,135,30,47,248,94,231,7,248,
+101,10,247,13,248,183,24,247,255,253,56,5,247,88,6,247,89,249,254,5,148,141,
+151,155,152,27,14,251,172,250,70,28,5,49,21,192,251,189,86,7,174,137,168,
+137,139,26,147,147,131,131,137,31,65,251,200,251,94,247,243,5,169,251,157,
+86,7,176,137,168,137,139,26,147,147,129,133,137,31,251,0,252,85,5,133,137,
+133,129,124,27,139,108,137,105,137,30,83,247,189,195,7,104,141,112,141,139,
+26,129,131,149,145,141,31,219,247,222,247,125,252,42,5,247,19,6,247,21,248,
+161,5,145,141,147,147,145,27,14,248,89,38,10,251,105,248,171,34,29,248,89,
+38,10,251,232,247,160,42,10,248,89,38,10,251,36,248,255,48,29,248,89,38,10,
+252,36,248,113,47,29,248,89,38,10,252,229,28,249,28,44,29,248,89,38,10,252,
+133,28,250,101,95,10,248,89,38,10,253,143,28,249,208,65,29,248,89,38,10,253,
+116,28,250,14,57,29,247,28,28,4,235,249,157,21,247,17,251,67,7,188,247,219,
+142,157,149,149,152,142,25,239,151,5,241,252,57,37,7,180,133,186,135,139,
+26,157,137,155,134,134,115,90,251,221,24,251,138,6,251,39,248,45,5,202,252,
+26,37,7,181,133,184,135,139,26,159,137,151,134,134,115,91,251,221,24,251,
+62,251,17,247,44,6,122,251,7,5,251,27,251,17,247,9,6,82,252,28,135,113,127,
+135,117,137,25,139,95,135,95,132,30,37,248,57,241,7,95,146,94,143,139,26,
+118,141,130,143,142,163,196,248,30,24,247,132,6,247,87,252,173,5,247,93,6,
+218,248,173,5,247,121,247,17,251,102,6,156,247,7,5,251,253,22,247,75,6,122,
+251,7,5,251,16,6,252,33,247,7,21,247,11,6,180,251,7,5,251,69,6,248,95,251,
+17,21,199,6,122,251,12,5,252,87,248,231,21,179,251,2,5,83,6,14,248,118,28,
+6,110,249,215,21,112,247,23,251,87,104,198,247,190,248,50,10,247,25,151,5,
+248,6,29,70,251,236,24,251,148,93,251,116,248,106,247,228,29,41,252,143,24,
+251,164,91,157,251,16,247,120,178,52,252,82,133,113,123,135,110,137,25,247,
+167,10,235,248,127,24,247,90,174,247,214,253,49,5,247,120,6,247,48,249,171,
+5,252,52,67,21,247,62,169,85,251,164,5,252,178,248,111,21,217,251,55,251,
+6,119,5,14,248,106,248,188,250,76,21,248,94,254,76,5,247,120,6,247,135,28,
+4,205,248,50,10,247,25,151,5,247,20,10,251,131,28,251,49,24,113,251,25,89,
+251,54,55,127,251,35,247,41,24,67,123,60,71,59,26,62,214,69,247,30,247,178,
+247,37,247,132,247,121,184,30,14,248,129,138,29,147,6,247,1,134,247,35,251,
+9,81,251,190,8,247,42,6,241,248,160,5,251,98,6,247,115,250,249,248,50,10,
+14,218,250,184,231,21,248,101,10,247,61,249,125,24,137,152,152,151,151,141,
+8,139,184,141,192,143,30,231,252,39,86,7,252,175,252,214,247,3,248,142,5,
+148,141,151,155,152,27,247,0,147,5,248,4,29,251,89,253,254,24,247,98,6,249,
+40,249,56,251,19,252,183,137,129,128,120,119,137,25,139,90,137,84,135,30,
+47,248,94,7,14,32,250,87,249,242,21,95,142,106,141,139,26,130,140,127,155,
+140,148,247,27,249,2,24,138,150,149,149,149,140,8,139,175,141,181,142,30,
+216,251,214,95,7,252,67,252,119,227,248,59,5,146,141,149,153,149,27,225,145,
+5,216,252,1,62,7,182,136,173,137,139,26,149,138,150,129,138,128,251,50,253,
+110,24,247,57,6,248,164,248,200,37,252,92,138,130,130,123,123,138,25,139,
+100,137,95,136,30,62,248,2,7,14,248,118,28,5,217,250,168,21,247,71,29,143,
+124,133,104,251,99,254,178,24,135,112,131,248,124,10,248,236,248,167,10,127,
+153,143,166,247,46,249,158,248,115,10,239,247,38,45,251,60,106,31,251,91,
+254,185,107,251,70,116,86,247,216,29,247,17,247,56,247,154,188,31,247,85,
+250,142,5,143,161,141,164,161,26,14,248,118,28,5,211,250,99,21,143,161,141,
+164,161,247,44,29,251,99,254,178,247,86,29,247,46,249,158,247,248,10,124,
+137,124,136,123,31,251,134,28,251,12,133,112,131,125,100,135,25,139,80,134,
+81,135,30,37,248,234,241,7,82,143,98,146,139,26,110,141,127,153,143,166,8,
+14,250,228,38,10,249,60,237,68,29,28,5,217,38,10,28,4,143,151,185,10,28,4,
+117,28,8,141,249,95,21,247,105,251,39,243,251,97,251,183,251,115,251,111,
+251,185,251,107,247,39,39,247,95,247,179,247,121,247,111,247,183,30,251,76,
+253,95,21,247,7,253,99,251,7,7,248,15,28,5,12,21,217,73,176,53,251,197,61,
+251,185,251,132,92,30,70,251,242,251,146,249,171,149,198,5,252,89,35,6,242,
+129,161,136,158,123,135,112,25,251,68,254,14,114,251,17,110,92,109,116,25,
+251,19,247,13,5,44,94,74,86,69,26,59,204,104,223,247,200,216,247,185,247,
+132,187,30,231,248,97,247,199,254,85,5,247,88,6,247,99,250,175,164,247,17,
+166,186,169,161,25,247,21,251,13,5,233,182,205,195,208,26,247,175,252,166,
+21,251,42,79,251,201,251,86,34,115,223,227,247,42,198,247,201,247,87,243,
+164,55,51,30,14,248,83,53,10,14,248,83,53,10,251,240,247,160,42,10,248,83,
+53,10,251,50,248,240,77,10,248,83,28,4,182,241,21,37,7,251,123,251,232,5,
+139,247,62,138,140,26,140,247,123,247,231,139,30,241,7,247,144,28,4,144,102,
+29,251,69,248,240,77,10,248,83,53,10,251,65,248,115,41,10,248,83,53,10,251,
+69,248,141,80,29,183,40,29,14,251,231,249,80,52,21,247,51,34,221,251,56,251,
+139,251,28,251,91,251,84,251,29,223,38,247,74,247,134,247,36,247,86,247,86,
+30,251,84,143,21,251,43,54,251,65,46,108,78,187,247,18,247,58,236,247,48,
+220,173,197,87,251,12,30,14,251,246,249,181,28,4,133,216,29,95,28,5,252,216,
+29,183,40,29,248,202,249,146,59,10,183,40,29,247,232,248,135,49,29,183,40,
+29,247,161,248,135,71,29,247,111,249,47,34,29,183,40,29,247,161,248,135,248,
+207,29,183,40,29,247,161,248,135,71,29,247,171,249,104,36,10,183,40,29,247,
+161,248,135,248,217,29,183,40,29,251,126,254,77,248,204,10,183,40,29,247,
+143,248,219,58,29,183,40,29,247,200,249,213,61,29,183,40,29,247,233,249,230,
+48,29,183,40,29,247,224,249,203,248,215,10,183,40,29,247,224,249,203,248,
+210,29,183,40,29,247,224,249,203,248,218,29,183,40,29,247,208,249,116,80,
+29,183,40,29,247,208,249,116,248,202,10,183,40,29,247,208,249,116,248,199,
+10,183,40,29,247,212,249,90,41,10,183,40,29,247,212,249,90,248,205,10,183,
+40,29,224,249,88,47,29,183,40,29,224,249,88,247,9,29,247,167,248,64,80,29,
+183,40,29,247,41,249,199,37,10,183,40,29,251,126,254,77,65,29,183,250,193,
+249,1,247,11,10,154,155,140,140,154,30,51,77,46,43,33,248,116,10,248,77,29,
+229,222,228,247,29,222,31,247,106,247,0,247,13,247,132,247,130,26,251,187,
+147,124,10,14,183,249,81,248,65,29,238,237,247,53,228,31,251,107,83,247,201,
+29,248,93,250,107,203,10,247,78,249,116,80,29,223,247,61,251,37,21,47,57,
+72,41,41,247,10,37,247,151,247,64,247,141,247,10,247,82,247,3,251,22,226,
+251,11,247,3,31,247,168,226,247,181,247,61,247,221,26,247,133,251,118,230,
+251,105,251,134,252,10,251,86,252,11,30,252,62,248,159,251,8,251,51,26,37,
+37,114,63,92,108,148,181,95,30,107,247,53,5,151,125,95,143,121,27,247,69,
+248,254,21,247,128,247,20,247,95,247,83,233,198,61,251,48,251,137,251,62,
+251,67,251,65,57,30,67,220,82,233,247,14,26,14,183,144,10,183,144,10,251,
+246,249,179,28,4,133,21,247,52,34,247,223,29,247,36,247,87,247,84,30,251,
+83,143,21,127,137,129,126,26,251,146,6,247,9,170,211,229,198,27,174,198,88,
+251,13,31,125,251,0,21,251,7,112,72,39,67,27,108,80,186,247,19,151,139,153,
+141,154,31,14,183,147,29,249,112,250,14,41,10,247,22,28,4,170,250,39,21,247,
+148,67,247,128,251,236,252,150,251,70,252,216,252,10,251,152,221,251,110,
+247,226,248,146,247,74,248,206,248,6,30,251,187,236,21,63,131,53,131,61,30,
+252,91,6,247,113,200,238,247,179,247,64,27,247,25,145,251,17,251,35,31,102,
+251,249,21,251,131,88,251,5,251,208,251,70,27,251,52,156,247,89,247,3,225,
+153,229,151,210,31,14,247,58,166,248,85,21,241,6,136,113,138,113,113,26,251,
+120,247,21,251,60,247,172,247,198,247,95,247,110,247,148,203,30,247,13,247,
+14,37,6,140,155,140,156,156,26,247,158,251,54,247,29,251,144,251,192,251,
+86,251,100,251,137,71,30,251,17,6,249,168,251,14,247,186,10,248,48,247,72,
+21,120,139,119,137,120,30,252,25,6,247,87,184,247,3,247,41,233,248,135,10,
+14,251,189,250,15,28,5,54,21,247,46,92,247,33,251,115,251,226,251,8,251,240,
+251,116,251,48,192,251,23,247,109,247,224,247,10,247,234,247,114,30,251,84,
+197,21,94,134,87,134,92,30,251,188,6,247,25,179,203,247,64,247,4,27,225,143,
+64,53,31,115,251,106,21,251,35,106,66,251,82,251,8,27,35,150,247,10,206,190,
+148,193,147,182,31,14,246,28,4,113,249,7,21,247,158,251,73,247,23,251,146,
+252,8,251,179,251,168,252,13,251,157,247,80,251,23,247,140,248,11,247,175,
+247,165,248,15,30,251,191,192,21,110,137,109,137,112,30,90,104,110,90,74,
+48,152,247,4,251,3,27,82,98,127,100,98,31,247,40,174,219,247,94,247,72,27,
+247,27,170,251,8,251,3,31,108,251,128,21,251,39,104,61,251,99,251,74,27,251,
+27,104,247,7,247,6,172,143,172,143,172,31,182,168,174,170,194,247,3,118,251,
+15,247,5,27,194,186,176,177,172,31,14,183,96,10,247,164,249,146,34,29,250,
+83,28,7,20,249,136,21,247,115,47,247,91,251,39,247,35,30,247,27,247,54,57,
+204,251,25,251,51,5,237,251,23,251,54,196,251,68,27,252,72,251,244,251,244,
+252,72,251,120,235,251,96,247,43,251,36,31,251,60,251,95,223,78,247,56,247,
+91,5,47,247,23,247,50,83,247,64,27,248,72,247,244,247,244,248,73,31,41,137,
+21,252,15,251,201,251,201,252,15,251,39,251,30,186,219,251,4,30,250,2,250,
+174,5,247,21,251,17,217,251,66,251,82,26,251,179,248,193,21,254,2,254,177,
+5,251,21,247,17,57,247,68,247,87,26,248,15,247,201,247,201,248,15,247,44,
+247,29,90,57,247,4,30,14,247,170,28,5,104,249,185,21,247,9,72,241,251,72,
+53,57,102,94,80,30,193,69,44,167,251,5,27,247,113,10,247,190,247,93,247,99,
+247,140,208,31,247,110,151,247,38,247,44,247,103,26,253,13,251,68,124,10,
+247,187,131,21,240,116,221,96,203,30,163,171,179,159,182,27,206,185,96,55,
+251,24,61,38,50,122,31,142,168,141,167,168,26,14,183,249,15,250,142,21,247,
+155,10,249,140,253,186,247,37,139,31,251,35,7,247,77,80,247,33,251,22,228,
+251,53,8,140,133,134,140,134,27,247,15,252,56,247,177,10,160,153,136,134,
+150,30,175,42,158,35,35,26,14,247,132,53,29,14,247,132,53,29,247,143,249,
+146,34,29,247,132,53,29,247,16,248,135,42,10,247,132,53,29,247,203,249,203,
+36,10,247,132,53,29,247,20,249,199,37,10,247,132,53,29,251,147,254,77,65,
+29,185,28,4,250,250,187,21,32,6,80,123,106,128,68,251,60,42,170,251,19,27,
+247,113,10,247,244,29,225,123,216,104,203,31,129,163,172,139,156,27,202,237,
+221,247,35,160,31,252,136,252,70,124,10,14,247,158,248,215,229,21,251,56,
+38,247,63,247,131,184,31,185,247,129,240,247,81,247,73,146,136,229,24,251,
+198,251,138,251,125,251,182,83,31,251,192,82,247,128,251,117,247,201,27,204,
+225,150,159,202,31,119,193,220,128,203,27,240,224,170,212,212,31,114,216,
+5,88,79,68,124,85,27,123,123,141,144,125,31,247,41,224,236,247,47,170,247,
+53,8,247,200,198,251,48,247,31,251,78,27,251,71,251,111,251,38,251,215,78,
+31,108,251,55,184,251,34,228,62,8,136,126,126,138,126,27,248,31,248,43,21,
+118,251,0,88,36,73,82,102,194,122,247,5,157,232,8,247,146,188,192,247,2,194,
+27,189,153,251,0,251,141,92,31,14,229,248,105,250,102,21,251,158,251,29,251,
+54,251,144,252,15,247,224,251,102,247,213,247,120,247,60,247,21,247,172,248,
+9,251,216,247,113,251,214,31,131,251,187,21,247,144,247,181,251,23,251,35,
+92,59,44,251,103,251,168,251,152,247,42,247,17,190,225,229,247,92,31,14,247,
+79,248,133,250,102,21,251,43,251,1,90,49,74,31,251,33,229,73,251,7,247,41,
+45,5,127,92,131,88,81,26,252,15,247,224,251,102,247,213,247,27,247,5,184,
+235,211,30,247,66,251,3,209,244,251,81,247,13,5,151,184,148,190,196,26,248,
+9,251,216,247,113,251,214,30,251,127,251,244,21,248,193,251,244,5,134,114,
+113,137,110,27,251,168,251,152,247,42,247,17,163,157,170,180,168,31,247,119,
+196,21,247,144,247,181,251,23,251,35,116,121,106,98,113,31,252,187,247,244,
+5,143,159,164,139,163,27,14,99,28,4,117,28,4,234,21,192,93,227,251,11,45,
+40,100,81,88,30,196,99,65,179,58,27,251,150,251,13,251,106,251,69,251,32,
+228,41,247,67,238,211,166,198,193,31,85,178,195,107,227,27,247,13,235,195,
+202,216,31,247,18,7,34,251,16,78,85,75,27,67,96,196,231,150,141,161,140,155,
+31,247,15,149,247,147,182,247,43,26,251,52,22,54,251,22,96,63,126,30,238,
+167,193,247,5,221,27,185,135,86,121,31,252,12,251,1,21,251,39,62,251,56,46,
+71,114,213,239,247,53,234,247,52,219,213,153,46,48,30,14,248,161,174,247,
+103,21,50,211,251,39,247,74,247,37,247,44,205,235,217,30,45,202,247,5,71,
+247,17,27,248,33,247,78,247,250,247,187,247,124,251,29,247,56,251,162,251,
+44,251,2,94,40,55,31,229,79,53,193,251,27,27,251,78,251,40,46,33,251,10,31,
+251,101,7,247,66,247,82,233,229,238,27,247,2,205,45,251,46,121,137,102,137,
+112,31,251,81,123,252,29,67,251,143,26,247,138,22,247,33,247,92,211,247,9,
+161,30,251,58,96,57,251,80,251,19,27,68,145,227,170,31,248,215,247,74,21,
+247,136,247,11,247,166,247,35,244,176,251,15,251,60,251,160,251,38,251,158,
+251,14,251,7,118,247,47,247,44,30,14,249,23,249,79,247,182,21,251,35,110,
+88,80,251,0,27,74,51,219,247,103,247,135,247,25,247,185,247,41,209,183,134,
+102,205,31,251,232,254,22,21,247,78,247,152,216,247,118,186,31,247,1,248,
+163,198,118,247,34,132,210,161,25,251,112,254,219,134,114,115,117,113,138,
+25,251,12,130,5,43,248,233,235,7,251,1,148,110,141,127,156,145,168,25,247,
+147,28,5,15,5,251,46,6,100,42,251,42,129,72,251,19,251,48,213,251,119,27,
+252,69,251,82,251,223,251,214,251,118,247,11,251,62,247,187,31,14,249,76,
+28,6,185,248,116,29,251,36,251,11,90,62,48,30,222,70,251,1,182,251,32,27,
+252,15,251,92,251,224,251,213,251,120,247,11,251,60,247,172,247,36,247,11,
+187,217,232,31,60,203,242,92,247,41,247,123,10,179,142,180,147,195,30,247,
+110,172,247,9,247,73,243,27,190,219,53,251,92,31,253,52,22,248,82,29,247,
+168,247,32,248,11,29,14,247,12,249,155,28,5,229,21,251,148,251,157,251,50,
+251,176,251,60,247,27,43,247,8,121,31,251,118,102,251,105,251,61,251,147,
+26,251,99,247,60,251,34,247,140,247,183,247,175,247,82,247,181,247,70,251,
+27,247,9,251,46,175,30,247,63,163,247,99,247,38,247,125,26,247,83,251,54,
+247,22,251,100,30,222,251,220,21,251,83,41,251,41,34,61,103,247,7,247,10,
+247,79,224,247,33,241,229,179,47,251,21,30,251,238,254,221,21,53,77,247,9,
+247,31,247,118,247,11,247,55,247,22,224,199,32,251,49,251,128,251,6,251,37,
+251,24,31,14,167,249,147,248,160,21,251,113,110,251,7,251,107,251,15,27,92,
+44,219,247,103,189,144,188,148,186,31,251,182,6,128,88,134,87,88,26,251,120,
+247,21,251,60,247,172,247,232,247,106,247,150,247,184,174,30,14,251,255,248,
+250,250,223,21,251,24,120,64,251,21,59,27,108,78,187,247,18,169,142,169,145,
+167,31,251,81,6,132,108,136,108,109,26,251,29,223,38,247,74,247,113,247,31,
+247,47,247,67,162,30,14,183,250,188,248,161,21,142,167,141,179,167,26,247,
+158,251,54,247,29,251,144,251,210,251,91,251,126,251,157,83,30,247,182,6,
+247,107,179,247,11,247,67,241,27,190,229,53,251,92,105,137,103,134,104,31,
+14,251,245,249,187,250,224,21,141,156,140,163,156,26,247,51,34,221,251,56,
+251,99,251,21,251,32,251,51,102,30,247,81,6,247,21,165,216,244,205,27,173,
+197,87,251,12,119,138,117,136,118,31,14,248,87,36,29,14,51,250,215,28,5,17,
+21,247,67,251,24,247,49,251,149,251,221,251,86,251,157,251,148,251,91,247,
+34,251,36,247,140,247,241,247,65,247,172,247,144,30,251,100,22,251,105,251,
+40,251,135,251,49,52,33,227,247,61,247,114,247,39,247,127,247,50,231,240,
+46,251,57,30,14,247,67,28,4,174,248,252,21,247,103,251,56,247,89,251,213,
+252,46,251,132,251,218,251,195,251,129,247,69,251,75,247,203,248,72,247,103,
+247,239,247,186,30,251,175,22,251,141,251,70,251,171,251,66,47,251,19,239,
+247,89,247,150,247,70,247,162,247,68,236,247,12,35,251,85,30,14,248,87,36,
+29,248,40,250,65,59,10,248,87,36,29,247,70,249,54,49,29,248,87,36,29,246,
+249,54,71,29,247,111,249,47,34,29,248,87,36,29,246,249,54,248,207,29,248,
+87,36,29,246,249,54,71,29,247,171,249,104,36,10,248,87,36,29,246,249,54,248,
+217,29,248,87,36,29,252,76,28,251,102,71,10,248,183,28,7,60,44,29,248,87,
+36,29,228,249,138,58,29,248,87,36,29,247,38,250,132,61,29,248,87,36,29,247,
+71,250,149,48,29,248,87,36,29,247,62,250,122,248,215,10,248,87,36,29,247,
+62,250,122,248,210,29,248,87,36,29,247,62,250,122,248,218,29,248,87,36,29,
+247,46,250,35,80,29,248,87,36,29,247,46,250,35,248,202,10,248,87,36,29,247,
+46,250,35,248,199,10,248,87,36,29,247,50,250,9,41,10,248,87,36,29,247,50,
+250,9,248,205,10,248,87,36,29,62,250,7,47,29,248,87,36,29,62,250,7,247,9,
+29,247,167,248,64,80,29,248,87,36,29,126,250,118,37,10,248,87,36,29,252,76,
+28,251,102,65,29,248,87,36,29,251,167,28,251,64,63,10,248,87,36,29,247,46,
+250,35,131,10,252,34,28,248,86,63,10,248,87,132,10,248,87,132,10,248,87,135,
+29,250,40,250,208,41,10,248,27,250,151,248,176,21,247,172,79,7,99,119,119,
+99,30,251,232,6,99,119,159,179,31,79,251,172,199,6,179,159,159,179,30,247,
+232,6,179,159,119,99,31,248,68,247,38,21,248,41,251,185,247,189,251,247,252,
+22,251,186,251,192,252,42,252,63,247,186,251,179,248,4,248,15,247,179,247,
+200,248,46,30,251,118,113,21,252,63,136,251,71,251,86,251,152,27,251,172,
+142,251,42,247,154,248,20,26,248,25,247,48,247,132,247,164,30,247,192,136,
+247,39,251,132,136,252,50,8,14,248,107,152,249,35,21,241,6,134,100,137,100,
+101,26,251,224,247,111,251,132,248,17,248,89,247,151,247,224,247,248,210,
+30,247,12,247,6,35,6,142,167,140,168,167,26,248,89,29,252,51,251,167,251,
+189,251,233,53,30,251,16,6,28,4,132,251,6,247,142,29,249,138,247,91,21,247,
+116,10,14,248,114,28,5,250,249,218,21,247,238,251,128,247,115,251,236,252,
+131,251,249,252,46,252,121,251,248,247,134,251,81,247,234,248,101,248,19,
+248,50,248,93,30,251,216,180,21,137,100,5,83,102,57,45,68,77,251,25,247,46,
+251,47,27,63,69,102,98,80,31,247,123,202,247,38,247,165,247,168,27,247,105,
+192,251,111,251,64,135,31,98,251,153,21,251,102,98,251,66,251,206,251,140,
+27,251,113,80,247,101,247,76,160,139,161,141,160,31,204,174,231,197,215,231,
+229,251,46,247,54,27,215,204,186,190,192,31,14,248,87,91,10,247,2,250,65,
+34,29,250,66,28,5,170,248,166,21,247,147,247,173,247,47,247,192,197,31,247,
+101,180,49,247,105,251,234,27,251,35,251,12,81,70,54,31,217,41,251,26,188,
+251,62,27,248,16,10,248,35,247,141,247,150,247,197,241,31,251,158,247,216,
+21,247,72,29,247,211,22,247,6,108,247,1,77,230,30,190,185,209,190,225,27,
+247,18,208,47,251,97,100,31,251,89,100,41,34,251,37,27,150,200,145,200,200,
+26,14,248,146,247,43,248,143,21,251,194,247,111,251,130,248,17,248,173,247,
+158,248,81,248,46,248,89,29,30,252,194,6,118,110,149,158,141,31,162,247,45,
+5,251,46,6,45,252,119,248,169,10,180,247,40,5,159,145,170,147,159,27,247,
+102,6,251,165,251,54,251,53,251,176,251,189,26,249,168,249,123,21,247,33,
+247,47,251,46,251,166,252,12,251,120,251,244,251,133,251,27,251,54,247,46,
+247,134,247,196,247,22,247,209,247,105,247,31,31,14,248,200,28,6,227,28,5,
+195,21,247,25,251,0,219,251,9,33,42,63,251,7,80,182,77,139,30,247,81,6,120,
+41,96,69,55,82,8,247,52,41,251,62,237,251,142,27,248,95,10,251,134,248,17,
+248,173,247,158,248,105,248,54,200,131,197,123,192,31,247,62,233,247,8,247,
+68,247,71,26,252,217,253,1,21,251,246,251,120,252,42,251,133,251,27,251,54,
+247,40,248,59,10,251,45,251,171,30,247,91,247,30,158,29,248,200,79,29,251,
+34,249,95,34,29,248,200,79,29,251,161,248,84,42,10,248,200,79,29,57,249,152,
+36,10,248,200,79,29,251,157,249,148,37,10,248,200,79,29,253,72,28,250,132,
+65,29,248,125,249,113,234,21,251,182,59,247,157,247,220,202,31,201,247,218,
+247,51,247,181,247,197,150,134,232,24,252,44,251,249,251,212,252,35,63,31,
+252,48,60,247,176,251,201,248,38,27,226,245,154,167,221,31,111,202,228,124,
+209,27,247,31,247,2,181,240,239,31,104,214,5,69,57,49,119,64,27,112,115,143,
+146,117,31,247,101,247,12,247,36,247,114,184,247,130,8,248,59,220,251,57,
+247,83,251,148,27,251,138,251,144,251,93,252,79,55,31,93,251,133,195,251,
+89,247,30,251,5,8,133,109,108,135,105,27,248,185,248,225,21,102,251,86,57,
+251,68,35,46,69,245,122,247,76,170,247,56,8,247,241,206,232,247,43,215,27,
+207,179,251,41,251,234,74,31,14,249,1,28,6,182,250,123,21,253,90,6,124,74,
+5,192,66,50,176,251,27,27,252,56,251,105,251,220,251,197,251,142,247,67,251,
+58,247,191,241,190,150,202,247,31,31,127,90,5,249,117,6,201,247,166,5,251,
+31,6,89,251,23,5,115,131,121,131,116,27,251,223,6,214,247,238,5,247,64,6,
+170,147,124,117,135,31,123,47,5,247,25,6,221,248,0,248,170,29,110,47,5,117,
+131,122,132,115,27,251,62,6,209,247,200,5,247,154,6,169,150,116,125,31,34,
+247,31,7,253,162,251,13,21,251,150,251,56,251,162,251,62,53,251,5,231,247,
+93,247,173,247,56,247,143,247,66,207,247,19,64,251,114,30,14,250,185,28,7,
+104,251,236,21,251,16,150,113,141,123,141,145,165,25,247,223,28,6,174,5,251,
+72,6,79,58,251,20,114,251,0,251,99,77,224,252,14,27,252,136,251,217,252,58,
+252,82,251,224,247,112,251,132,248,16,247,195,247,120,247,58,247,88,176,31,
+247,41,249,169,213,130,247,29,129,239,163,25,251,175,28,250,108,135,119,127,
+131,108,137,25,251,13,130,5,37,249,1,7,254,47,249,190,21,251,113,98,78,90,
+251,50,27,251,47,251,34,247,60,247,152,247,231,247,80,248,55,247,182,209,
+229,119,84,216,31,14,28,5,151,28,9,177,249,234,21,247,183,251,75,247,154,
+252,31,251,118,251,73,50,251,27,251,23,30,247,25,48,251,51,230,251,124,27,
+252,142,251,171,252,78,252,62,251,224,247,91,251,132,248,17,247,125,247,70,
+227,247,25,247,19,31,251,29,233,247,54,55,247,118,27,248,173,247,138,248,
+103,248,56,31,251,211,247,66,10,254,144,247,66,10,14,247,124,250,17,249,112,
+21,247,66,164,247,107,243,247,117,26,247,87,251,94,247,18,251,121,251,156,
+251,194,251,9,251,166,251,75,247,31,56,247,20,121,30,251,123,111,251,115,
+251,25,251,138,26,251,112,247,100,251,30,247,165,247,196,247,219,247,55,247,
+168,247,81,251,38,247,4,251,63,164,30,226,247,246,21,251,45,251,5,251,39,
+251,33,43,88,247,3,247,11,247,73,247,16,244,247,8,234,205,42,251,11,30,252,
+7,254,129,21,251,6,57,241,247,36,247,79,247,7,247,56,247,56,247,11,222,251,
+9,251,35,251,82,251,22,251,39,251,47,31,14,251,123,249,75,28,4,200,21,247,
+6,154,247,31,202,247,27,26,247,9,251,23,214,251,41,251,63,251,89,69,251,56,
+251,2,230,89,222,128,30,251,42,122,251,37,60,251,40,26,251,24,247,27,56,247,
+69,247,90,247,104,237,247,58,247,5,45,206,251,4,154,30,196,247,105,21,47,
+66,51,47,76,106,205,211,247,0,220,202,214,201,182,81,68,30,251,133,252,239,
+21,65,85,200,225,247,4,214,238,246,216,193,69,53,251,6,55,51,38,31,14,128,
+250,136,249,178,21,247,35,251,86,222,251,45,251,79,251,170,49,251,108,251,
+22,244,96,220,126,30,251,45,121,251,62,40,251,80,26,251,67,247,89,62,247,
+73,247,104,247,180,247,12,247,108,247,30,33,208,251,3,153,30,247,6,157,247,
+66,214,247,65,26,252,83,251,113,21,69,116,219,198,247,22,207,234,247,0,209,
+160,63,72,251,5,66,251,0,38,31,121,49,21,235,151,42,65,251,1,63,251,36,251,
+12,50,118,220,215,247,4,200,247,47,247,29,31,14,248,112,109,29,158,249,7,
+250,14,21,247,0,198,46,251,34,251,51,37,251,55,251,21,99,31,83,251,185,5,
+248,54,6,189,247,150,5,56,6,251,5,117,79,119,107,27,251,16,6,151,203,5,247,
+126,195,247,60,247,104,247,98,26,247,95,251,17,247,38,251,184,251,247,251,
+94,251,131,251,136,251,45,224,251,37,247,49,97,30,127,75,5,251,16,6,112,99,
+153,209,153,140,155,143,158,31,56,6,89,251,150,5,248,54,6,195,247,185,5,67,
+176,95,218,245,26,247,79,247,20,247,80,247,28,30,14,248,136,28,6,57,249,205,
+21,247,220,251,131,247,146,252,23,252,132,252,52,252,58,252,72,251,220,247,
+132,251,146,248,21,248,132,248,53,248,58,248,72,30,251,117,113,21,252,1,251,
+242,251,199,251,201,251,112,251,102,247,68,247,164,247,255,247,244,247,201,
+247,201,247,113,247,99,251,66,251,166,30,251,246,69,21,213,47,180,71,41,251,
+7,57,43,65,219,84,215,243,247,5,231,239,30,14,158,70,29,14,252,53,248,188,
+61,21,247,4,76,247,12,251,32,69,77,109,124,111,30,149,184,5,49,6,251,111,
+99,5,97,7,247,2,128,251,42,253,88,136,128,133,131,125,137,25,139,87,136,111,
+136,30,84,248,28,194,7,77,144,109,142,139,26,124,131,147,150,141,31,180,247,
+74,5,134,156,164,134,171,27,247,145,247,50,247,92,247,89,31,251,78,134,21,
+251,36,52,251,75,251,4,115,102,160,151,119,30,220,248,15,5,161,165,195,184,
+176,27,210,148,56,70,31,14,252,6,249,164,28,4,141,21,247,5,76,247,13,251,
+31,67,78,108,125,112,30,147,184,5,51,6,251,113,98,5,98,7,247,2,127,251,41,
+253,87,137,127,133,131,124,136,25,139,88,137,111,135,30,84,248,27,194,7,77,
+143,109,144,139,26,124,131,147,151,141,31,180,247,72,5,135,157,164,135,170,
+27,247,146,247,49,247,93,247,86,31,251,78,135,21,251,35,51,251,76,251,3,115,
+102,159,151,118,30,219,248,15,5,162,168,194,184,176,27,211,147,57,69,31,14,
+158,70,29,247,94,249,146,34,29,158,70,29,154,249,88,47,29,158,250,134,248,
+130,21,251,21,6,251,33,253,93,247,106,10,247,65,249,232,104,29,158,28,4,133,
+248,74,21,247,15,251,11,7,141,166,141,163,164,26,247,79,10,30,247,130,10,
+79,251,199,5,251,50,251,15,247,26,6,251,40,253,129,159,10,201,247,195,248,
+48,10,247,201,247,109,247,103,247,144,215,31,251,148,247,83,21,116,137,117,
+137,116,30,251,236,6,180,247,101,247,129,10,112,251,83,21,251,76,94,251,1,
+251,62,251,18,27,102,83,174,159,107,31,198,247,191,5,14,158,247,32,10,247,
+130,10,251,82,254,90,5,251,82,251,27,247,56,6,123,61,159,10,155,217,5,248,
+143,249,242,93,10,158,248,229,251,75,21,243,192,78,247,39,5,247,147,238,247,
+43,247,154,247,151,26,247,79,10,30,247,130,10,251,124,28,251,101,159,10,201,
+247,195,248,48,10,178,177,143,145,175,31,247,125,249,24,21,251,65,69,251,
+99,35,37,30,85,247,24,35,86,196,251,31,5,137,128,129,138,128,27,102,83,174,
+159,107,31,247,17,249,11,247,129,10,14,158,248,227,73,247,0,29,248,87,249,
+83,104,29,158,250,252,28,5,20,21,247,30,251,6,210,251,120,251,221,251,77,
+251,111,251,78,103,30,251,167,28,250,121,141,10,247,79,10,31,162,247,5,5,
+247,121,182,247,39,231,219,27,158,165,137,123,156,31,175,251,64,5,139,180,
+121,185,208,237,196,208,30,252,8,253,51,93,10,158,249,243,250,218,21,247,
+27,251,219,7,193,247,172,248,70,10,114,251,17,5,251,78,251,27,247,52,6,251,
+165,28,250,131,141,10,247,79,10,31,167,247,38,5,247,137,252,101,93,10,158,
+247,32,10,248,27,29,251,175,28,250,84,5,251,81,251,27,247,55,6,124,61,159,
+10,155,217,5,248,143,249,242,93,10,248,156,247,192,248,60,21,130,248,200,
+248,210,203,248,29,26,247,25,55,234,251,17,251,6,37,49,251,1,107,147,107,
+155,111,30,247,78,206,5,184,127,150,108,107,251,133,253,45,251,85,252,166,
+26,134,251,162,247,142,251,20,247,158,111,81,251,185,24,134,112,128,131,120,
+137,251,15,129,24,46,248,239,232,7,251,34,151,115,141,128,151,143,158,25,
+197,247,182,5,248,70,179,247,192,247,152,248,59,26,247,68,251,11,247,38,251,
+69,52,42,101,101,77,30,154,215,5,251,30,6,251,158,85,5,48,7,238,128,251,43,
+253,144,251,52,175,251,5,247,0,137,247,68,25,249,62,247,238,21,139,247,5,
+246,210,143,30,214,143,188,51,251,9,26,251,156,251,27,251,158,251,200,85,
+30,14,247,132,28,4,245,249,17,21,247,79,10,30,247,130,10,251,23,253,47,5,
+152,100,96,148,99,27,251,110,251,80,251,61,251,62,69,184,56,229,141,31,219,
+200,187,205,168,31,251,9,247,16,150,193,206,222,247,28,141,25,180,170,125,
+120,168,31,63,252,24,141,10,31,251,178,131,248,147,10,81,159,159,107,30,247,
+19,249,26,247,129,10,14,248,97,249,109,250,148,21,251,0,44,88,114,96,31,247,
+130,10,251,124,28,251,101,159,10,201,247,195,248,48,10,247,112,247,65,246,
+247,44,247,1,31,251,38,196,226,251,5,235,27,247,11,221,156,194,233,31,247,
+41,29,215,55,192,55,36,251,14,41,251,101,251,33,31,247,51,114,41,247,40,251,
+76,27,166,252,31,93,10,207,248,42,251,248,21,251,34,151,111,141,133,154,142,
+155,25,163,247,10,5,248,11,247,84,248,105,247,218,248,65,26,247,44,52,247,
+10,251,99,251,20,251,19,77,76,60,30,164,247,17,247,172,29,251,124,28,251,
+101,135,120,129,125,118,137,25,251,15,129,5,46,248,239,7,173,28,4,149,21,
+220,219,247,2,195,204,27,198,193,88,42,31,138,251,185,251,102,251,150,251,
+202,251,95,8,14,251,32,248,129,250,69,21,251,158,251,49,251,39,251,167,127,
+31,139,161,253,155,74,251,90,30,247,63,6,182,247,15,133,247,254,139,26,106,
+176,247,18,96,232,27,247,125,247,69,247,36,248,38,247,176,251,66,247,48,251,
+114,31,87,39,21,247,50,247,22,251,53,251,180,251,180,251,27,69,40,251,78,
+55,247,46,247,144,247,135,189,247,50,247,58,31,14,252,109,247,87,246,21,251,
+64,36,51,251,57,132,31,139,153,252,101,97,251,11,30,247,3,6,167,213,135,247,
+109,139,26,119,163,221,113,199,27,247,44,247,7,226,247,133,247,62,251,5,233,
+251,37,31,106,79,21,241,224,42,251,64,251,65,51,97,75,251,13,84,231,247,43,
+247,38,172,234,247,0,31,14,247,118,28,4,225,248,236,21,247,105,251,54,247,
+33,251,84,189,30,184,247,111,149,180,162,141,174,141,25,139,190,143,180,143,
+30,237,252,212,41,7,180,135,190,135,139,26,170,137,170,135,131,100,96,251,
+99,24,252,23,92,251,66,251,177,251,187,26,251,76,247,35,251,50,247,97,88,
+30,77,251,187,131,98,117,139,102,137,25,49,131,5,40,248,211,238,7,47,147,
+106,141,110,139,148,180,25,196,247,175,5,248,21,186,247,74,247,168,247,185,
+26,251,176,147,21,251,92,34,251,103,251,41,61,30,247,45,249,115,5,195,88,
+184,57,251,5,26,252,3,247,169,21,251,46,253,115,5,84,190,98,221,247,8,26,
+247,109,246,247,89,247,35,211,30,14,251,127,250,51,28,4,121,21,247,20,34,
+223,251,17,169,30,168,247,24,145,163,154,141,162,140,25,139,172,141,166,142,
+30,197,252,10,81,7,165,136,172,137,139,26,160,138,159,136,133,116,112,251,
+16,24,251,144,110,251,5,251,63,251,69,26,251,2,232,44,247,25,109,30,99,251,
+69,134,114,124,139,115,138,25,81,134,5,80,248,9,198,7,80,144,117,140,120,
+139,145,164,25,176,247,61,5,247,143,168,247,10,247,57,247,68,26,251,77,144,
+21,251,12,71,251,19,42,92,30,239,248,77,5,175,109,168,90,71,26,251,130,247,
+58,21,39,252,77,5,103,170,112,188,208,26,247,23,209,247,10,232,182,30,14,
+248,124,28,5,238,249,3,21,247,117,251,11,247,60,251,158,102,102,135,133,106,
+30,239,248,139,5,251,35,6,251,209,53,5,59,247,47,7,72,251,229,5,145,110,102,
+143,102,27,252,6,251,114,251,224,251,234,251,107,247,21,251,48,247,148,176,
+176,143,146,172,31,84,251,173,5,114,135,114,117,112,27,45,133,5,42,248,179,
+236,7,55,145,5,114,123,161,164,143,31,194,247,173,5,132,170,174,135,178,27,
+247,246,247,128,247,212,247,224,31,251,183,126,21,251,39,251,27,252,13,251,
+48,92,108,162,145,133,30,247,41,249,137,5,146,150,178,159,184,27,204,205,
+251,15,251,58,31,252,136,247,154,21,251,41,253,137,5,133,128,100,116,92,27,
+74,75,247,15,247,54,247,41,247,23,248,15,247,52,186,170,119,132,145,31,14,
+248,120,247,252,248,141,21,173,247,71,217,247,68,247,80,212,8,230,7,251,217,
+97,251,98,251,109,89,251,152,87,251,160,235,251,112,248,55,103,55,252,73,
+24,247,144,6,223,248,72,248,63,174,247,109,247,114,191,247,160,25,247,180,
+195,82,247,123,251,244,27,251,166,251,42,251,62,251,213,76,31,55,252,68,251,
+119,182,123,247,62,176,247,83,25,248,184,198,21,247,68,173,181,247,69,247,
+33,27,247,16,135,251,114,251,82,102,31,101,251,86,32,251,61,251,137,97,8,
+14,251,94,249,108,119,99,29,251,94,250,92,28,4,201,99,29,247,169,248,222,
+114,21,248,91,247,164,248,50,247,236,247,48,53,247,27,251,146,251,230,251,
+15,253,31,251,134,94,31,32,205,113,241,247,17,26,247,25,196,247,236,240,171,
+166,106,92,166,30,206,160,5,163,137,247,50,251,46,251,166,251,54,252,31,251,
+140,251,126,247,59,251,64,248,2,30,248,101,249,138,21,251,115,251,28,251,
+177,251,76,41,30,194,247,181,5,247,189,195,215,247,80,186,27,216,148,251,
+9,88,31,14,247,48,72,10,14,251,172,250,55,28,5,129,21,247,2,59,229,251,144,
+30,251,251,78,6,175,136,179,136,139,26,155,138,151,136,136,125,251,32,253,
+32,24,136,123,128,137,122,138,8,139,99,136,101,135,30,78,248,39,200,7,100,
+143,99,142,139,26,120,140,131,141,142,154,187,247,111,24,138,157,163,139,
+154,27,247,158,247,60,247,21,247,83,31,251,87,120,21,45,89,78,75,104,30,84,
+109,78,131,87,141,221,248,11,24,161,6,247,9,200,86,43,31,14,74,116,29,74,
+116,29,247,48,72,10,247,59,249,167,34,29,247,48,72,10,119,249,109,47,29,247,
+48,247,90,10,95,251,113,24,251,55,251,14,247,31,6,251,39,253,123,133,113,
+123,135,112,137,25,247,25,29,213,248,1,24,247,151,10,31,252,127,251,44,21,
+247,14,251,58,7,188,247,139,5,174,6,247,72,233,51,251,53,251,48,62,37,40,
+81,31,55,88,45,127,59,141,190,247,149,24,14,247,48,99,247,145,21,247,86,6,
+118,251,0,133,113,123,135,112,137,25,247,25,29,161,247,2,24,247,163,247,21,
+251,137,6,165,247,18,5,247,151,10,248,87,29,31,247,112,10,251,60,253,229,
+24,251,112,6,250,120,249,6,247,104,29,189,249,213,248,1,21,243,194,80,247,
+21,5,247,129,217,247,32,247,70,247,127,26,248,87,29,30,212,29,200,197,143,
+149,194,31,247,86,248,124,21,251,34,75,41,52,79,30,76,247,32,35,84,201,251,
+30,78,119,77,133,84,141,25,247,17,249,6,5,174,6,247,72,233,51,251,53,31,14,
+247,155,28,5,53,250,164,21,247,75,251,15,247,43,252,23,30,127,147,252,113,
+131,139,26,247,62,29,251,103,254,189,135,248,45,10,82,248,46,29,76,143,139,
+26,112,141,125,143,143,163,213,248,1,24,247,151,10,31,251,191,107,21,251,
+48,61,37,41,81,30,55,88,45,127,59,141,247,17,249,6,24,174,6,247,74,231,51,
+251,53,31,14,248,212,248,21,250,127,21,248,51,248,159,194,247,182,26,247,
+13,50,247,17,251,49,44,40,71,33,95,153,99,165,108,30,247,87,215,203,126,128,
+57,119,110,25,251,24,251,85,252,125,57,252,86,26,251,181,247,154,251,4,247,
+151,107,30,66,252,5,134,112,119,136,115,137,25,251,11,128,5,37,248,255,241,
+7,251,13,150,122,141,114,140,144,163,25,211,248,1,5,247,241,153,248,44,239,
+248,57,26,247,120,251,74,245,251,220,30,252,130,251,0,6,197,135,162,137,160,
+133,134,116,25,251,7,252,217,5,251,46,182,251,16,247,2,247,92,26,249,72,247,
+146,21,174,6,247,41,247,17,81,251,87,251,168,251,73,54,251,144,126,31,14,
+248,88,28,6,15,250,164,21,248,87,29,30,247,112,10,32,252,172,24,145,110,106,
+144,102,27,251,134,251,78,251,26,251,111,130,31,65,136,177,55,243,27,229,
+203,214,209,169,31,251,23,247,16,5,193,148,185,214,247,49,27,179,173,130,
+128,173,31,55,252,64,133,113,123,135,112,137,25,190,29,14,249,5,28,6,155,
+249,97,21,248,76,251,251,247,248,252,70,252,74,251,246,251,250,252,74,252,
+77,247,248,251,248,248,68,248,76,247,249,247,248,248,77,30,40,22,252,19,251,
+203,251,210,252,21,252,19,248,100,29,248,15,248,19,247,203,251,205,252,23,
+30,251,190,247,140,21,247,82,251,89,248,164,29,153,137,155,129,122,26,253,
+68,7,121,123,127,125,248,98,10,122,125,151,157,31,247,161,7,134,165,173,139,
+156,27,247,104,247,54,224,247,113,31,251,97,92,21,251,15,85,80,32,109,107,
+138,145,116,248,68,29,249,23,249,125,247,200,10,212,29,247,42,247,22,168,
+192,243,31,247,87,252,83,150,113,116,248,187,10,251,160,248,236,24,248,191,
+29,251,33,251,50,5,247,59,124,251,23,247,24,251,254,27,247,103,252,2,247,
+104,29,247,28,187,248,142,21,247,55,6,116,251,7,5,251,73,251,7,247,49,6,115,
+251,11,136,119,119,116,109,137,25,251,10,131,5,35,248,251,7,137,243,251,36,
+147,111,141,129,162,142,159,25,163,247,11,5,248,24,247,7,252,1,6,163,247,
+7,5,169,6,247,254,248,19,247,51,248,16,247,131,251,105,229,251,241,31,252,
+105,36,6,241,131,168,137,151,116,135,119,25,251,14,252,231,5,251,79,6,248,
+213,249,4,21,139,130,141,177,247,116,234,52,251,37,251,143,251,99,251,35,
+251,134,30,113,6,14,247,28,28,5,25,249,142,21,247,17,251,56,7,149,175,145,
+178,142,179,8,247,37,247,17,251,46,6,247,33,106,251,16,245,251,184,27,248,
+14,10,120,35,24,251,153,251,17,247,131,6,119,251,7,5,251,111,251,17,247,88,
+6,251,1,252,253,133,113,125,135,115,137,25,247,73,10,247,138,247,78,235,247,
+52,235,31,251,105,247,17,21,251,220,6,159,247,7,5,247,216,6,138,96,133,101,
+130,105,8,251,34,251,87,21,63,88,55,127,67,141,162,247,23,24,247,179,6,116,
+111,112,115,111,121,8,251,12,248,201,21,171,6,247,8,215,94,54,173,31,251,
+173,6,14,28,4,193,28,8,224,249,246,245,29,132,139,132,140,132,31,122,91,90,
+124,107,27,81,111,182,202,153,31,247,8,249,13,5,247,126,247,5,251,108,6,178,
+247,123,5,251,77,6,46,251,103,32,92,5,144,170,142,172,173,26,247,75,251,1,
+247,43,251,242,30,248,14,10,251,85,254,210,24,133,113,125,135,115,137,8,247,
+73,10,247,176,247,95,247,20,247,97,217,31,247,1,152,251,4,252,246,5,133,110,
+138,112,113,26,32,207,61,247,34,226,247,19,184,171,213,30,93,184,215,108,
+247,2,27,247,36,29,28,250,124,247,34,21,251,48,70,37,50,81,30,63,88,55,127,
+67,141,247,4,249,6,24,171,6,247,54,223,51,251,53,31,14,247,48,247,11,250,
+176,21,247,85,6,251,71,254,31,247,100,29,149,193,24,168,176,248,79,10,251,
+26,247,53,251,251,31,62,6,155,224,5,248,160,10,149,192,247,101,10,128,84,
+24,251,110,6,249,121,252,191,247,69,29,247,48,92,247,106,21,247,85,6,126,
+70,247,100,29,152,210,24,248,160,10,154,216,5,168,178,248,79,10,251,29,247,
+53,251,251,31,62,6,148,183,247,101,10,251,69,254,17,24,251,110,6,250,75,248,
+137,247,69,29,247,72,250,93,28,5,127,21,251,75,251,31,65,73,57,31,161,247,
+12,5,247,22,10,204,247,213,5,247,238,247,89,248,236,248,94,248,79,26,247,
+67,251,53,247,6,251,41,30,251,23,251,79,21,224,184,72,36,251,185,251,199,
+251,214,251,184,251,106,31,247,60,249,249,5,223,240,238,185,240,27,14,247,
+31,247,48,250,82,21,251,242,72,247,142,35,247,149,27,177,178,137,145,194,
+31,73,251,240,134,112,116,123,114,137,25,251,20,128,120,35,5,248,250,6,158,
+243,251,1,247,219,10,247,11,149,159,243,5,252,199,6,251,162,251,178,84,251,
+253,70,31,247,189,129,21,247,83,176,247,11,247,2,247,40,27,247,5,6,251,10,
+252,254,5,137,108,133,139,121,27,251,76,141,35,223,183,247,125,8,14,249,44,
+28,6,182,249,177,21,247,137,251,78,247,38,251,130,78,92,129,128,100,30,147,
+186,247,146,10,131,92,5,150,104,96,149,78,27,251,218,251,187,251,160,251,
+224,251,130,247,74,251,56,247,132,201,188,152,149,176,31,130,90,247,145,10,
+147,188,5,129,174,182,126,203,27,247,215,247,189,247,177,247,218,31,251,203,
+173,21,251,66,32,252,2,251,94,73,127,155,168,100,30,247,33,249,82,5,168,188,
+158,155,204,27,247,9,174,251,10,251,26,31,252,214,247,99,21,251,33,253,82,
+5,110,90,121,123,73,27,53,73,223,247,58,247,68,240,248,2,247,103,202,152,
+123,110,177,31,14,217,121,10,217,250,158,251,125,21,247,27,251,48,7,247,116,
+250,246,5,251,91,6,106,102,5,160,92,76,155,247,24,10,110,251,35,5,251,253,
+251,27,247,226,6,123,61,221,10,154,217,5,72,250,156,104,10,248,39,250,226,
+250,148,21,251,91,6,106,102,5,160,92,76,155,247,24,10,121,50,252,45,251,144,
+5,251,2,7,248,18,247,124,112,251,29,221,10,197,247,183,178,162,5,247,193,
+247,74,247,113,247,2,247,97,10,86,67,70,251,181,251,72,30,251,28,249,66,104,
+10,217,28,6,8,28,5,86,21,203,86,218,251,33,251,52,251,64,88,251,54,251,7,
+30,102,88,104,251,35,125,43,8,153,104,117,143,247,24,10,67,251,248,221,10,
+247,158,28,5,55,5,247,7,161,145,247,107,247,36,27,247,37,251,32,5,199,150,
+204,182,237,26,253,140,252,203,247,85,10,14,217,28,4,231,251,209,21,208,139,
+229,251,10,30,251,91,251,96,69,126,131,247,79,168,247,35,25,247,105,250,193,
+5,251,91,6,106,102,5,160,92,76,155,247,24,10,118,49,5,251,218,74,247,80,41,
+247,163,27,229,247,49,182,247,1,31,252,107,250,240,104,10,37,250,201,251,
+193,21,229,84,188,53,30,251,46,251,21,5,111,96,190,186,182,143,201,153,215,
+31,247,93,250,152,5,145,163,141,166,164,26,247,60,41,247,41,251,150,251,236,
+251,50,251,162,251,97,251,64,247,2,251,29,247,138,197,190,147,151,184,30,
+251,17,253,31,5,133,106,135,106,109,26,251,75,245,251,53,247,156,247,28,247,
+8,190,233,30,252,41,28,5,123,21,251,46,83,251,90,251,55,61,108,194,247,17,
+247,37,194,247,101,247,58,225,160,80,251,15,30,14,248,255,249,164,249,179,
+247,85,10,252,17,28,251,32,21,248,239,232,6,248,181,29,248,25,247,135,247,
+226,247,220,247,79,10,31,156,215,5,251,89,6,106,102,5,160,92,76,155,248,198,
+10,250,77,250,109,93,10,248,87,106,10,248,85,28,6,59,251,140,21,223,57,180,
+76,153,30,251,101,251,113,98,160,123,196,155,227,25,247,197,28,6,35,5,251,
+88,6,77,63,5,182,80,43,172,42,27,252,168,252,3,252,42,252,133,252,40,247,
+177,251,25,247,205,244,214,152,165,203,31,127,80,131,77,98,26,251,92,247,
+12,251,5,247,111,247,50,247,72,196,247,56,30,252,76,28,5,84,21,251,72,254,
+41,5,87,65,90,94,251,23,27,251,58,251,33,247,21,247,183,248,25,247,135,247,
+255,248,11,176,231,251,13,102,133,31,14,248,87,28,5,116,163,21,58,229,251,
+97,251,71,121,171,121,176,116,180,25,178,29,176,59,182,62,207,84,251,20,251,
+5,24,219,48,247,55,247,35,5,125,183,190,131,199,247,214,29,97,108,149,157,
+113,31,134,250,136,200,29,249,226,248,141,251,151,21,251,2,7,247,255,247,
+51,5,69,205,233,91,247,40,247,214,29,61,97,174,197,101,31,247,117,237,5,247,
+214,247,33,247,92,247,43,247,97,10,84,86,251,10,251,234,251,42,30,251,119,
+40,111,191,5,178,29,154,107,154,107,157,109,8,248,12,250,103,200,29,252,168,
+248,118,206,21,175,107,190,70,72,72,103,93,92,30,156,221,5,47,6,251,113,99,
+5,96,7,247,4,128,251,9,252,156,5,247,69,6,214,247,217,155,212,208,211,223,
+178,25,174,72,5,230,175,167,196,31,14,252,95,251,118,21,172,107,186,70,72,
+72,105,98,92,30,156,214,5,47,6,251,113,102,5,100,7,247,4,128,251,9,252,112,
+5,247,69,6,214,247,189,155,207,208,205,223,174,25,174,78,5,230,175,165,191,
+31,14,252,166,249,123,28,5,31,234,29,105,28,6,150,234,29,251,123,54,10,111,
+248,152,34,29,251,123,54,10,179,247,141,49,29,251,123,54,10,90,247,225,58,
+29,251,123,54,10,180,248,236,48,29,251,123,54,10,251,107,248,94,47,29,251,
+123,54,10,252,203,254,178,247,38,29,251,123,54,10,253,89,28,251,77,65,29,
+251,123,54,10,253,89,28,251,77,71,10,249,105,28,6,153,80,29,251,123,54,10,
+253,62,28,251,139,57,29,251,123,249,6,244,248,148,10,96,251,111,85,29,248,
+6,250,218,248,208,29,251,123,217,29,78,251,193,5,251,46,251,15,247,19,6,47,
+252,78,248,112,10,231,248,78,5,247,109,247,15,251,82,6,174,247,7,241,247,
+0,247,11,199,194,251,3,24,247,32,194,186,234,31,14,251,94,250,87,250,3,109,
+10,251,165,251,149,36,10,251,90,250,15,248,126,21,109,247,21,252,39,64,165,
+247,14,244,247,10,247,20,248,128,29,248,47,29,31,247,114,29,61,252,10,251,
+109,99,159,251,16,247,61,169,65,251,250,248,112,10,226,248,44,5,14,251,123,
+217,29,251,72,253,254,5,125,77,130,59,107,26,251,64,247,1,251,7,247,152,247,
+17,239,247,241,10,26,176,164,247,9,155,223,30,247,7,248,191,247,184,29,251,
+123,217,29,251,166,28,250,224,248,112,10,247,101,250,111,247,184,29,251,192,
+247,7,248,12,21,189,251,0,197,251,15,175,82,8,66,185,218,99,247,200,29,248,
+25,10,126,162,127,164,127,165,8,247,104,179,247,69,247,14,247,115,26,247,
+44,251,14,229,251,77,251,59,251,27,72,65,251,3,30,251,17,7,187,206,246,212,
+247,10,27,229,192,81,59,251,62,251,47,53,251,26,31,109,100,141,133,27,14,
+82,139,4,123,247,21,247,91,130,247,7,27,177,179,141,141,179,31,251,80,252,
+16,5,247,15,6,247,87,248,29,246,153,235,163,193,168,25,234,7,78,117,71,122,
+67,128,247,247,249,97,24,251,15,6,251,255,253,111,5,136,99,98,138,98,27,251,
+2,50,151,157,61,31,248,28,247,183,247,71,247,57,247,93,26,247,16,51,247,7,
+251,140,251,58,251,46,48,86,72,30,251,24,7,208,216,247,17,197,226,27,242,
+184,81,63,251,45,251,5,251,27,252,25,251,192,31,14,247,91,249,67,247,112,
+21,251,38,247,27,40,247,130,247,17,247,5,247,241,10,197,247,7,248,141,227,
+26,247,10,73,202,251,59,32,251,15,88,71,39,30,248,23,10,251,170,28,250,197,
+5,211,6,247,135,247,90,247,93,250,89,5,227,225,247,1,219,202,27,172,162,120,
+85,31,92,45,252,100,81,26,14,251,123,247,145,251,163,21,247,63,249,192,227,
+29,251,123,247,145,251,163,21,233,248,82,247,186,138,5,247,18,251,160,7,190,
+247,133,227,29,251,150,249,171,250,123,21,251,165,6,251,4,252,176,247,16,
+10,5,14,252,185,249,9,28,5,104,21,247,102,29,121,56,5,230,6,247,113,180,5,
+182,7,251,4,149,5,14,251,150,250,19,251,218,21,209,102,184,51,174,30,251,
+29,251,46,5,86,137,112,209,188,26,190,147,199,153,202,30,247,108,250,162,
+5,251,165,6,251,4,252,176,112,251,15,32,247,145,29,126,83,117,251,8,139,26,
+133,110,139,112,111,26,251,62,247,15,251,48,247,176,247,19,211,207,214,30,
+14,252,5,249,77,248,225,21,181,115,166,81,160,30,50,47,5,105,138,121,181,
+168,26,170,145,175,148,177,30,247,32,249,2,5,247,102,29,131,105,125,70,139,
+26,135,121,139,123,122,26,37,219,46,247,76,222,186,179,184,30,14,251,150,
+250,15,28,5,229,21,251,31,247,48,29,251,72,254,19,114,251,15,251,1,247,31,
+10,5,14,251,141,249,193,28,4,158,21,247,64,33,247,6,251,153,251,19,39,74,
+251,1,66,215,120,196,129,30,247,21,247,23,5,172,135,184,108,100,26,104,117,
+251,8,120,55,30,251,4,252,191,247,16,10,247,75,250,1,5,151,200,147,219,172,
+26,14,251,221,249,224,247,2,10,14,251,167,250,22,247,2,10,251,100,251,153,
+36,10,74,250,5,28,4,238,21,251,4,251,149,251,16,110,57,78,67,75,25,174,247,
+65,248,71,29,251,72,253,246,248,112,10,247,1,248,147,171,247,42,240,247,10,
+247,31,186,25,251,147,252,221,5,247,12,6,247,157,248,243,5,163,6,194,251,
+3,5,247,32,194,201,219,198,90,225,32,31,124,126,138,125,27,244,247,131,5,
+14,252,39,249,101,251,195,21,184,116,192,47,172,30,251,45,251,35,5,87,125,
+190,165,203,151,198,152,201,31,241,248,142,247,30,10,37,252,142,5,125,70,
+128,67,69,26,251,78,201,251,64,247,162,247,23,247,5,202,242,30,14,251,190,
+247,56,252,82,21,247,165,6,247,74,250,23,247,30,10,14,251,72,250,114,249,
+169,21,196,7,251,27,127,185,225,115,31,114,231,126,201,36,181,8,247,43,180,
+247,7,220,247,21,26,247,28,251,30,187,251,71,30,252,20,78,6,176,136,179,136,
+139,26,156,138,148,135,135,126,251,27,253,32,24,135,123,128,136,123,138,8,
+139,99,136,100,136,30,78,248,39,200,7,98,142,99,143,139,26,121,140,132,143,
+142,152,195,247,164,24,154,156,140,150,27,240,157,32,68,157,31,251,21,168,
+178,67,247,55,27,188,176,147,155,179,31,251,144,248,254,21,251,32,251,25,
+94,38,136,30,139,116,138,129,30,204,247,210,172,141,5,180,142,247,20,124,
+251,11,26,14,170,250,201,147,21,223,7,251,31,106,156,247,23,102,31,147,10,
+251,45,176,191,48,247,98,27,201,186,150,161,194,31,251,219,249,113,247,91,
+10,247,202,38,29,247,91,249,139,34,29,247,202,38,29,247,159,248,128,49,29,
+247,202,38,29,247,70,248,212,58,29,247,202,38,29,247,160,249,223,48,29,247,
+202,38,29,151,249,81,47,29,247,202,38,29,54,28,251,69,95,10,247,202,38,29,
+251,243,28,250,176,65,29,247,202,38,29,251,243,28,250,176,71,10,248,230,28,
+8,41,80,29,247,202,38,29,251,216,28,250,238,57,29,247,202,111,10,43,252,142,
+24,251,123,251,23,247,96,6,53,252,85,133,113,123,133,114,137,25,152,29,14,
+247,230,28,5,241,250,178,21,111,247,23,251,107,99,5,247,60,95,251,86,200,
+251,132,27,248,21,10,88,251,156,24,251,189,84,158,251,16,247,144,184,251,
+24,253,68,133,113,123,133,114,137,25,224,29,247,79,29,247,103,201,247,59,
+247,9,167,247,75,8,253,54,251,180,21,139,104,137,123,30,170,247,58,248,6,
+205,97,251,60,251,64,82,251,28,134,25,188,248,164,21,190,143,197,143,247,
+58,119,170,251,43,25,251,241,74,5,14,247,202,111,10,251,113,28,251,141,24,
+248,78,10,231,247,2,178,223,156,30,153,209,100,173,49,174,251,97,251,15,24,
+110,197,152,247,0,163,247,19,247,13,249,13,24,162,165,141,156,27,247,153,
+10,252,24,250,154,228,29,14,174,247,25,248,147,21,247,197,145,120,251,38,
+170,251,30,8,251,26,170,156,251,24,247,193,27,190,216,162,149,231,31,159,
+243,251,141,110,122,241,112,247,29,25,117,243,106,221,71,185,247,173,211,
+247,73,247,54,180,247,103,8,247,118,183,251,26,247,82,251,248,27,251,56,251,
+157,82,35,251,54,31,251,27,7,213,247,32,247,50,197,247,58,27,247,88,223,251,
+21,251,45,109,31,251,109,97,251,125,251,4,251,162,94,67,137,131,27,14,247,
+119,139,4,249,148,6,251,94,252,37,5,247,26,6,247,94,248,37,5,247,232,6,199,
+247,236,5,251,33,6,81,251,66,5,119,132,111,110,121,27,52,6,247,245,249,80,
+5,251,26,6,251,245,253,80,5,252,192,6,248,237,248,92,247,68,247,83,179,247,
+115,8,247,118,179,251,19,247,82,251,248,27,251,56,251,148,92,251,9,251,78,
+31,251,34,7,228,247,49,247,41,192,247,48,27,247,95,210,251,10,251,66,108,
+31,110,251,55,251,48,251,82,252,197,252,93,8,14,248,245,250,171,247,190,21,
+251,126,114,247,20,42,247,189,27,247,19,247,16,200,234,186,115,219,43,178,
+31,251,56,251,44,5,98,91,170,206,143,31,150,247,82,247,49,248,17,247,130,
+247,44,29,251,187,28,250,36,247,86,29,247,134,28,4,200,247,248,10,251,33,
+251,35,252,118,128,39,31,14,66,247,68,10,247,150,28,4,244,24,220,29,66,247,
+68,10,247,15,248,244,24,247,241,138,5,247,18,251,215,7,247,1,248,171,5,220,
+29,247,172,248,236,249,77,21,85,158,141,141,114,31,213,248,25,5,207,6,247,
+40,227,89,251,17,251,63,251,69,92,251,33,31,92,251,7,21,247,31,179,251,95,
+251,44,192,31,251,81,205,166,251,69,247,157,27,216,187,154,155,187,31,243,
+7,137,128,117,136,116,27,251,18,119,220,247,60,91,31,85,247,81,72,247,20,
+251,19,183,8,247,72,175,247,125,229,247,82,26,247,82,251,74,226,251,172,30,
+251,26,6,146,182,145,172,149,145,166,141,25,247,30,149,5,225,253,10,37,7,
+247,10,129,166,137,149,134,134,115,25,251,101,254,210,134,114,125,132,114,
+137,25,251,13,130,5,37,248,255,241,7,251,17,150,110,142,134,146,143,159,25,
+223,248,75,5,14,250,83,28,4,187,145,21,235,7,251,78,122,215,247,36,106,31,
+104,247,45,121,242,251,35,210,8,247,101,207,247,52,247,27,247,107,26,247,
+119,251,83,219,251,140,30,252,168,37,6,191,133,193,135,139,26,164,137,151,
+132,134,117,251,80,254,210,24,133,113,125,133,117,137,8,139,84,134,85,135,
+30,37,248,193,241,7,83,143,82,146,139,26,115,141,130,145,143,161,216,248,
+89,24,160,162,141,154,27,247,32,165,251,70,251,11,163,31,251,107,180,192,
+251,11,247,119,27,205,191,152,165,194,31,251,241,250,154,21,251,125,251,75,
+65,251,33,133,30,139,108,137,124,30,229,248,166,185,143,5,197,144,247,68,
+114,251,91,26,28,4,123,251,67,245,29,41,226,42,247,85,247,36,29,14,247,28,
+28,4,183,250,135,21,156,247,17,5,251,167,6,128,185,118,176,109,171,8,247,
+242,6,156,247,17,5,254,40,6,138,137,5,137,122,6,125,33,5,247,16,6,199,128,
+214,109,175,65,8,251,217,6,122,251,17,5,247,255,6,125,251,106,251,87,71,251,
+42,133,8,139,91,137,123,30,120,251,15,5,210,6,247,153,10,247,79,29,247,103,
+201,247,59,247,9,167,247,75,8,14,247,243,28,6,51,28,5,6,21,205,90,243,51,
+84,87,67,96,30,82,205,86,79,26,251,16,78,251,11,81,251,1,30,251,117,252,54,
+108,247,3,100,217,251,21,198,25,247,67,29,251,101,254,210,24,133,113,123,
+133,114,137,8,247,32,29,159,41,162,61,184,84,251,148,252,107,24,247,56,6,
+247,100,248,25,5,124,180,189,133,200,248,136,29,235,7,251,36,86,176,207,108,
+31,247,222,248,248,5,211,247,25,206,247,75,247,43,26,253,9,251,142,228,29,
+14,113,250,115,4,55,7,247,31,172,122,251,23,176,31,167,39,156,65,247,0,88,
+8,251,64,88,251,27,45,251,44,26,251,64,247,70,74,247,111,30,248,120,231,6,
+83,143,100,141,139,26,113,141,137,157,143,150,247,54,249,121,24,141,155,151,
+152,166,141,8,139,180,143,196,143,30,229,252,152,49,7,196,135,172,135,139,
+26,170,137,143,120,137,129,73,251,185,24,96,6,251,9,119,247,9,225,119,31,
+247,45,102,87,230,251,98,27,77,92,128,117,84,31,247,219,253,113,21,247,47,
+247,48,186,247,17,148,30,139,153,141,154,30,59,252,3,5,104,6,88,135,251,36,
+166,247,23,26,14,134,28,4,171,250,35,21,227,7,144,88,112,159,80,27,251,9,
+83,98,82,82,31,251,9,251,9,74,251,138,251,72,27,110,6,205,247,197,143,164,
+143,145,171,141,25,139,185,141,186,143,30,231,252,134,47,7,219,132,168,137,
+142,128,136,124,25,251,56,253,129,135,122,132,131,115,137,25,36,133,5,49,
+248,101,7,247,157,247,152,196,247,148,236,34,210,39,172,31,225,172,196,210,
+186,213,8,247,34,227,138,216,247,80,27,252,171,252,230,21,251,70,251,72,102,
+251,13,30,113,6,218,247,251,5,166,6,243,247,9,84,50,31,14,252,21,250,16,28,
+5,52,21,191,7,142,106,121,151,101,27,63,102,115,105,102,31,68,63,97,251,39,
+251,9,27,120,6,182,247,75,142,154,141,142,160,141,25,139,169,140,169,141,
+30,194,251,215,84,7,191,135,158,138,140,132,138,130,25,32,252,85,136,129,
+135,134,123,138,25,72,135,5,85,247,194,7,247,65,247,61,173,247,46,197,70,
+182,74,158,31,195,159,176,182,170,183,8,224,196,139,186,247,14,27,251,240,
+251,249,21,32,251,9,117,60,30,122,6,191,247,108,5,156,6,207,215,106,85,31,
+14,247,44,28,4,163,249,201,21,251,199,252,255,135,150,135,152,135,153,25,
+147,10,166,251,4,174,61,236,105,251,88,252,32,24,247,16,6,247,78,248,12,5,
+161,6,201,186,150,161,194,31,223,7,85,101,141,150,110,31,247,247,249,96,5,
+252,197,59,247,91,10,247,245,28,6,2,248,14,29,253,48,7,251,152,251,154,251,
+23,251,187,251,97,247,91,86,233,125,31,251,197,81,110,251,143,247,88,29,155,
+247,238,247,189,27,180,6,51,252,78,135,112,114,123,115,137,25,251,17,128,
+5,35,248,252,243,7,33,150,116,141,119,155,143,166,25,247,101,250,178,145,
+166,166,155,161,142,25,251,232,130,21,35,252,160,5,137,104,116,137,127,27,
+251,4,251,36,170,247,58,247,117,247,42,245,248,135,29,105,250,56,22,229,7,
+49,147,113,141,134,153,141,154,25,247,49,249,121,141,153,152,154,166,141,
+25,237,146,5,230,252,102,7,251,190,251,57,251,23,251,33,251,32,196,64,247,
+21,110,31,79,127,61,110,109,114,251,26,251,3,164,251,21,36,52,8,117,121,81,
+155,139,26,121,51,5,124,183,155,129,191,27,185,247,9,152,188,197,31,247,16,
+245,142,247,20,240,239,8,184,184,168,152,189,27,166,145,138,138,152,31,76,
+251,190,137,124,122,125,117,137,25,63,131,5,49,7,247,94,248,166,21,94,6,48,
+61,214,239,247,15,213,204,247,42,31,205,6,14,107,250,177,196,21,247,1,7,104,
+85,70,112,98,27,106,121,156,188,149,31,247,45,249,209,5,251,240,247,133,29,
+110,67,247,73,29,120,247,27,248,132,29,189,6,139,85,251,166,100,26,59,195,
+71,247,25,247,27,219,180,180,217,30,251,234,249,228,247,177,29,14,248,76,
+28,5,214,249,189,21,200,49,247,46,251,93,51,59,116,101,68,30,148,185,5,251,
+210,247,133,29,108,57,247,73,29,122,247,37,248,132,29,187,6,135,109,137,108,
+110,26,251,195,247,79,61,247,70,248,88,29,30,247,237,29,143,173,141,164,31,
+247,165,161,247,209,247,18,247,107,26,253,161,245,247,177,29,248,194,35,21,
+251,17,251,60,35,251,33,106,30,247,42,176,212,247,102,247,19,27,201,149,88,
+92,31,14,249,242,28,7,206,247,200,10,254,252,6,251,152,251,154,251,38,251,
+152,251,97,247,95,93,233,125,31,251,197,81,106,251,170,247,88,29,159,248,
+5,247,189,27,180,6,47,252,101,134,112,115,123,115,137,25,251,17,128,5,35,
+250,241,247,186,29,237,248,138,5,247,127,247,84,10,251,122,6,235,248,137,
+248,53,10,253,235,247,92,21,39,252,137,5,137,104,116,141,127,27,251,4,251,
+40,163,247,58,247,89,247,42,247,6,248,135,29,251,131,43,29,14,252,185,248,
+36,199,247,108,29,103,84,152,163,120,30,164,212,5,156,122,112,151,100,27,
+103,101,99,96,80,201,81,247,32,247,52,10,252,172,249,9,28,5,25,21,169,85,
+203,251,2,251,35,251,17,65,251,9,78,192,86,194,100,30,205,92,184,106,88,26,
+81,112,102,86,102,86,154,163,118,30,166,211,5,155,120,113,154,102,27,100,
+102,98,96,79,201,82,247,33,247,91,235,239,236,198,82,186,79,182,31,82,180,
+77,186,190,26,170,143,184,193,159,154,133,139,30,206,33,5,221,143,170,165,
+195,26,14,251,131,43,29,246,248,165,34,29,251,131,43,29,246,248,165,112,29,
+251,35,247,234,47,29,251,131,43,29,243,247,154,44,29,251,131,43,29,247,68,
+248,249,248,203,29,251,131,43,29,59,248,107,47,29,251,131,43,29,252,45,28,
+251,90,65,29,251,131,43,29,252,45,28,251,90,71,10,247,221,28,6,125,47,29,
+251,131,43,29,252,18,254,252,57,29,251,131,43,29,251,172,254,221,54,29,251,
+131,249,187,249,246,21,247,173,10,36,223,49,225,74,30,240,63,206,81,55,26,
+43,98,78,57,251,55,132,208,247,30,86,30,251,21,6,43,252,142,5,131,104,139,
+129,122,26,251,6,239,67,247,89,247,19,233,190,244,210,79,178,82,151,30,251,
+52,251,64,5,78,96,195,208,151,31,188,247,144,5,117,189,202,124,223,247,24,
+29,252,173,249,20,28,5,25,247,108,29,33,134,180,222,105,30,55,6,77,251,196,
+5,133,118,139,133,129,26,71,204,95,247,20,222,200,170,202,182,100,162,102,
+146,30,35,36,5,99,111,173,180,147,31,171,247,43,5,126,171,180,130,194,27,
+247,52,10,251,131,215,10,243,227,160,172,207,31,131,100,118,63,139,26,113,
+251,9,88,45,75,129,251,33,247,21,24,65,247,245,10,194,80,247,32,247,176,215,
+247,128,247,123,186,30,190,247,134,5,144,161,143,160,159,26,239,51,219,46,
+211,30,247,134,10,14,251,131,43,29,121,251,126,36,10,251,105,250,0,248,170,
+21,109,247,21,251,223,77,5,72,195,82,200,205,247,187,10,247,173,10,79,167,
+83,180,90,30,251,99,101,159,251,16,247,199,194,5,229,70,198,82,61,247,142,
+10,41,235,42,247,107,247,199,247,42,247,62,247,50,211,93,201,78,195,31,14,
+251,131,249,187,249,246,21,205,39,231,251,33,251,138,251,69,251,25,251,74,
+69,176,73,206,73,30,223,56,247,42,72,251,16,26,78,125,43,251,17,251,31,92,
+237,247,60,30,251,10,6,77,251,203,5,247,38,247,76,252,140,247,106,27,226,
+226,208,226,202,115,185,92,155,31,251,35,251,30,58,218,102,240,251,2,247,
+24,25,132,161,145,139,157,27,247,127,247,113,247,9,247,103,247,6,251,16,226,
+46,219,31,68,200,64,204,223,26,211,162,184,202,164,154,136,134,152,30,244,
+251,70,5,247,2,146,201,171,241,26,14,251,124,248,104,250,46,21,193,193,100,
+75,81,251,9,32,251,21,61,31,251,23,59,251,58,32,251,67,26,251,44,247,45,52,
+247,106,247,72,247,89,225,247,24,207,88,176,89,89,82,127,130,126,30,102,251,
+35,5,99,98,107,124,79,27,78,104,206,179,234,247,4,218,247,18,229,31,247,20,
+229,247,64,222,247,64,26,247,32,251,24,226,251,96,251,62,251,80,77,251,10,
+81,180,84,209,170,184,154,144,156,30,198,247,49,5,145,148,173,149,167,27,
+14,252,84,250,39,28,5,106,176,10,253,53,249,90,28,6,81,21,183,96,168,76,251,
+113,35,251,9,251,30,128,30,86,253,70,5,98,135,128,251,4,62,27,55,223,5,70,
+119,120,92,107,26,95,182,110,203,247,113,243,247,10,247,28,149,30,192,249,
+69,5,181,142,149,247,5,217,27,224,55,5,209,159,157,185,172,26,14,252,31,250,
+93,247,238,10,57,28,251,131,5,70,133,122,251,79,251,10,27,251,21,247,32,52,
+112,105,88,128,84,25,80,251,193,5,133,104,137,128,123,26,251,7,241,68,247,
+89,247,19,231,190,243,211,82,178,81,151,30,251,51,251,64,5,77,96,195,208,
+151,31,172,247,58,5,137,151,154,139,153,27,247,234,247,52,247,89,247,119,
+155,31,221,28,4,125,5,209,143,156,247,80,247,10,27,247,24,251,33,5,245,173,
+168,215,194,26,14,127,250,101,247,16,29,129,28,5,177,176,10,252,80,250,44,
+247,238,10,59,254,244,5,166,106,90,133,104,27,251,52,251,27,251,26,251,37,
+33,247,7,71,241,247,36,245,176,215,215,31,159,106,160,98,159,90,247,38,192,
+24,104,225,120,172,88,215,180,237,141,247,9,145,218,211,250,165,24,247,222,
+10,253,159,28,249,232,21,49,137,98,51,51,27,94,113,165,182,213,184,215,210,
+168,161,127,110,174,31,14,131,248,60,250,228,21,251,42,220,251,4,219,251,
+1,30,113,109,113,109,115,109,251,35,251,69,251,45,251,79,33,251,61,103,152,
+102,154,89,155,8,44,7,161,128,162,127,166,127,8,84,39,105,47,62,26,251,17,
+232,77,247,6,247,16,209,224,236,162,135,164,131,162,30,251,65,95,110,155,
+117,175,146,175,25,146,176,153,179,161,184,8,129,191,201,132,217,27,248,110,
+247,67,247,140,247,133,247,33,48,247,24,50,247,18,31,247,19,247,43,237,247,
+31,247,30,26,244,78,247,17,251,70,251,127,251,62,251,81,251,115,30,247,211,
+253,91,21,251,128,251,95,49,251,68,84,96,142,145,103,30,215,247,20,247,17,
+247,55,247,73,247,113,180,189,24,190,63,178,61,48,26,69,249,205,21,224,186,
+236,229,193,201,107,52,38,74,251,1,52,251,5,30,82,227,95,225,225,26,14,203,
+42,29,14,251,37,250,58,250,87,21,165,65,37,174,251,42,27,251,181,251,72,251,
+39,251,85,251,15,247,11,78,247,9,88,31,208,108,247,44,88,48,26,251,18,251,
+17,75,43,86,251,24,174,149,30,160,247,74,5,251,50,6,78,251,144,5,121,176,
+247,33,71,247,74,27,248,19,247,11,247,87,247,31,247,25,251,13,201,251,9,190,
+31,66,170,251,42,188,235,26,247,3,247,13,215,221,194,227,112,129,30,131,251,
+64,5,247,35,6,14,203,42,29,197,249,169,34,29,203,42,29,197,249,169,112,29,
+251,35,247,234,47,29,203,42,29,194,248,158,44,29,203,42,29,247,19,249,253,
+248,203,29,203,42,29,251,21,249,111,47,29,203,42,29,252,150,28,250,206,65,
+29,203,42,29,252,150,28,250,206,71,10,248,21,28,8,13,47,29,203,42,29,252,
+123,28,251,12,57,29,203,42,29,252,21,28,251,43,54,29,225,28,4,209,249,132,
+21,111,247,23,252,150,49,5,39,187,251,6,205,247,7,247,202,10,209,247,211,
+5,248,24,10,38,193,68,215,83,31,251,204,85,158,251,16,248,102,217,5,242,89,
+247,57,68,251,18,247,178,29,68,251,228,5,116,176,247,66,47,247,117,27,248,
+109,247,35,247,163,247,78,247,19,65,219,43,201,31,14,229,28,4,141,218,10,
+59,252,23,5,74,247,170,160,252,75,247,225,27,203,247,41,248,0,10,48,54,247,
+126,198,34,31,133,179,183,136,184,247,14,10,14,217,250,147,248,59,21,251,
+65,6,70,251,125,248,52,10,247,80,247,92,187,247,71,238,31,247,92,247,3,247,
+103,247,46,247,132,248,18,29,82,251,212,5,247,47,6,218,247,100,248,70,29,
+251,29,60,64,251,108,36,31,251,183,251,31,251,91,251,20,251,137,247,249,29,
+14,247,28,28,4,147,248,178,21,156,247,17,5,252,29,6,198,173,196,177,191,182,
+8,247,130,6,156,247,17,5,251,31,6,181,201,165,210,221,248,18,29,91,251,182,
+5,247,47,6,209,247,70,248,70,29,54,112,74,67,77,31,253,76,6,122,251,17,5,
+248,138,6,59,100,65,102,76,100,8,251,190,6,122,251,17,5,247,48,6,76,70,103,
+59,38,247,249,29,200,247,219,5,251,65,6,70,251,113,248,52,10,247,22,230,207,
+247,7,201,31,14,247,28,247,10,22,244,6,158,234,174,128,177,132,177,134,25,
+125,67,5,247,2,6,152,202,5,176,6,166,165,140,141,164,31,126,73,5,247,3,6,
+155,221,5,247,142,190,247,51,247,40,247,35,26,247,70,251,35,223,251,39,213,
+30,247,124,10,209,247,211,5,247,127,29,247,106,67,251,25,26,48,90,85,73,107,
+30,163,247,12,5,212,153,94,180,80,27,95,85,119,96,93,31,171,126,102,170,93,
+27,101,85,120,95,99,31,163,128,107,178,93,27,94,65,133,44,121,31,121,46,180,
+75,208,97,8,247,252,247,23,21,171,149,166,183,189,27,184,131,109,82,128,31,
+120,50,98,132,98,136,104,138,25,251,97,247,3,21,174,150,177,180,174,27,190,
+125,89,102,132,31,120,43,100,143,100,146,105,149,25,251,32,247,33,21,174,
+146,160,141,146,27,167,139,112,99,132,31,126,73,105,164,122,171,147,178,25,
+14,252,207,248,34,193,21,206,251,77,247,212,10,57,252,2,5,135,122,138,123,
+123,26,75,188,92,242,223,247,25,187,152,169,30,206,7,126,96,56,109,98,27,
+98,118,165,177,149,31,223,248,16,5,14,253,10,249,7,28,5,18,205,10,37,28,6,
+137,205,10,252,20,51,10,248,60,249,126,41,10,252,20,51,10,247,81,249,124,
+47,29,252,20,51,10,175,28,250,176,44,29,252,20,51,10,147,254,155,247,38,29,
+252,20,51,10,251,26,28,251,100,65,29,252,20,51,10,32,254,242,57,29,252,20,
+51,10,248,140,248,214,81,10,252,20,51,10,134,254,211,54,29,252,20,249,181,
+249,236,21,247,5,251,177,7,200,10,196,213,150,163,204,30,131,82,104,251,5,
+247,136,29,235,247,105,231,158,30,214,247,244,5,117,74,251,19,90,75,27,76,
+248,158,29,14,253,11,249,16,28,5,19,21,206,251,78,247,212,10,58,252,2,5,135,
+122,137,123,123,26,75,189,92,242,176,187,146,153,181,30,134,105,116,71,139,
+26,126,90,107,105,105,134,46,216,24,93,129,87,105,91,26,92,175,104,229,247,
+59,201,247,19,195,152,30,187,247,103,5,126,97,56,109,98,27,98,119,165,177,
+149,31,222,248,16,5,14,252,20,249,114,248,91,21,247,13,251,183,7,196,247,
+172,5,247,197,247,5,251,177,6,182,247,123,248,175,29,82,251,168,5,251,22,
+251,13,244,6,96,251,105,247,55,10,186,247,124,5,14,252,4,249,225,249,236,
+21,247,5,251,174,7,247,162,29,251,69,70,5,55,7,247,42,155,112,251,17,5,141,
+131,129,139,131,27,251,32,43,251,5,251,33,78,31,247,0,6,194,158,186,182,184,
+27,161,164,135,133,164,31,73,251,213,5,133,110,137,112,113,26,32,213,61,247,
+51,247,19,247,99,219,160,182,30,247,4,7,117,76,251,19,90,75,27,74,110,182,
+202,151,31,193,247,148,5,137,153,155,137,154,27,247,31,235,247,5,247,33,201,
+31,251,1,6,86,121,89,96,96,27,111,108,143,147,108,31,182,247,103,5,14,252,
+20,250,60,28,4,153,21,251,7,205,251,65,251,166,5,251,20,6,182,247,123,248,
+187,29,118,141,119,145,120,30,251,32,251,115,244,69,247,16,247,87,5,122,174,
+185,129,195,27,247,21,247,97,219,160,184,31,248,26,29,158,231,247,234,248,
+177,5,212,247,5,138,6,251,196,251,5,21,216,6,251,6,251,75,5,14,252,20,250,
+42,28,5,92,21,190,85,225,251,35,251,167,251,33,251,178,251,126,88,30,231,
+29,247,197,247,5,251,177,6,172,247,45,153,209,168,247,0,202,209,25,247,34,
+251,33,5,210,172,185,165,223,26,14,252,20,249,207,249,236,21,247,5,251,156,
+7,247,162,29,251,87,70,5,55,7,247,60,155,251,115,254,181,5,133,111,137,112,
+112,26,33,213,63,247,51,247,19,247,99,217,159,182,30,247,5,7,116,76,251,19,
+90,75,27,74,110,182,205,151,31,247,122,250,201,5,14,252,20,249,185,249,236,
+21,247,5,251,177,7,247,162,29,247,199,10,98,251,97,88,251,103,113,251,101,
+25,42,57,66,41,69,43,243,59,24,201,227,188,196,188,195,8,77,182,221,104,229,
+27,247,144,247,23,247,21,247,44,245,47,211,37,91,103,133,125,96,31,229,248,
+78,5,221,252,254,21,51,51,71,59,55,180,247,7,196,147,30,184,200,150,157,196,
+27,192,160,113,86,31,14,251,50,250,5,28,4,238,21,251,20,251,185,5,251,125,
+6,205,29,247,95,6,251,160,252,251,5,247,12,6,247,160,248,251,5,247,52,247,
+5,251,2,6,247,20,247,185,5,14,249,153,247,235,247,13,29,253,4,253,87,195,
+10,28,5,78,253,179,132,29,14,248,11,28,5,129,249,240,21,231,76,211,251,81,
+251,252,251,134,251,197,251,249,56,153,67,168,82,30,120,86,81,125,103,247,
+196,29,247,97,247,5,251,77,6,200,10,243,247,50,193,169,217,30,159,121,162,
+123,165,126,111,53,108,39,120,45,8,247,64,6,154,225,165,223,160,212,8,211,
+6,247,103,247,74,247,17,247,83,235,38,198,47,251,31,37,51,251,4,69,31,125,
+182,135,186,188,26,188,155,247,50,202,247,15,30,180,219,199,204,229,151,247,
+3,251,51,24,247,70,157,153,217,190,26,251,117,252,224,21,57,40,70,64,30,130,
+88,147,135,27,217,172,204,247,11,244,27,164,149,106,118,31,14,247,187,28,
+5,61,249,246,21,191,60,245,251,62,251,112,251,86,251,15,251,84,36,221,49,
+227,74,30,237,63,209,81,55,248,18,10,112,98,159,80,27,82,81,72,67,125,141,
+124,143,125,31,133,115,112,135,115,247,196,29,247,74,247,5,251,54,6,200,10,
+219,247,0,170,168,221,30,102,190,215,116,245,27,247,200,247,39,247,62,247,
+50,239,51,219,49,211,31,51,207,45,216,223,26,191,143,214,221,169,162,131,
+139,30,243,248,163,10,14,207,28,5,152,28,5,106,21,213,71,188,43,251,232,251,
+54,251,88,251,122,125,30,130,251,6,5,251,115,6,200,10,247,21,247,13,195,176,
+198,30,247,4,7,98,73,82,117,76,247,196,29,247,127,6,74,254,46,5,70,133,122,
+247,221,29,235,247,234,247,52,247,89,247,119,155,30,221,28,4,125,5,247,222,
+10,14,247,92,28,5,78,247,252,29,251,75,243,251,50,27,115,117,137,135,119,
+31,173,247,74,247,226,10,247,3,29,247,22,249,17,5,140,150,157,139,153,196,
+237,83,169,29,73,250,157,249,170,21,247,101,254,52,251,101,247,195,7,251,
+95,251,6,251,17,251,56,251,89,26,251,86,247,2,251,38,247,190,29,47,27,251,
+4,97,247,7,244,185,133,247,143,247,99,247,38,31,14,252,10,249,5,188,21,221,
+7,251,42,125,247,23,249,21,5,145,167,141,166,166,26,245,66,217,251,52,251,
+21,251,97,59,119,94,30,251,5,7,162,205,247,19,188,202,27,205,167,96,73,127,
+31,251,27,253,41,5,251,197,251,5,247,174,6,96,251,125,5,247,97,6,244,247,
+102,5,14,248,239,60,29,14,248,239,28,6,150,198,21,234,7,110,81,55,116,111,
+27,87,127,184,197,151,31,74,10,121,55,209,89,236,125,25,103,102,82,75,124,
+247,12,29,160,188,155,173,30,221,148,217,167,222,182,8,14,236,247,187,247,
+167,21,247,57,10,104,180,247,8,162,31,247,18,248,254,5,247,39,6,248,37,29,
+254,30,247,247,10,247,40,6,14,226,93,29,103,28,5,28,80,29,247,89,50,10,14,
+251,146,250,160,28,6,73,21,253,173,6,94,251,106,5,243,6,189,247,22,5,150,
+143,160,145,151,27,247,29,6,251,29,253,50,137,123,124,136,121,138,25,139,
+100,136,104,136,30,78,248,38,200,7,103,143,98,142,139,26,123,140,127,141,
+142,154,247,29,249,51,24,247,37,6,152,156,134,128,138,31,133,251,23,5,242,
+6,14,109,250,232,250,123,21,254,121,6,77,251,166,5,247,40,6,157,145,157,247,
+50,215,27,247,50,6,251,60,253,166,137,126,128,137,117,137,25,139,90,137,88,
+135,30,47,248,150,231,7,34,145,127,141,127,137,143,150,25,247,60,249,172,
+5,247,62,6,149,157,137,131,137,31,129,251,58,5,247,39,6,14,247,89,50,10,33,
+249,243,48,29,247,28,28,4,210,28,4,110,21,247,169,29,251,41,254,1,247,99,
+10,247,41,250,3,24,248,20,10,225,248,109,21,156,247,17,5,254,229,6,122,251,
+17,5,14,247,89,50,10,251,254,249,101,47,29,247,89,50,10,252,191,28,250,16,
+44,29,247,89,50,10,252,95,28,251,89,95,10,247,89,50,10,253,105,28,250,196,
+65,29,247,89,50,10,253,78,28,251,2,57,29,247,89,50,10,252,232,28,251,33,54,
+29,247,89,28,5,137,28,5,94,248,185,29,49,252,120,5,251,189,251,15,247,164,
+6,43,252,146,248,60,29,248,254,241,7,251,10,150,114,141,121,143,143,163,25,
+235,248,148,5,247,189,247,15,251,164,6,229,248,120,5,248,174,10,247,28,250,
+111,249,27,21,84,245,251,93,49,161,247,19,247,142,247,5,84,245,251,63,62,
+195,247,222,5,248,20,10,205,247,250,5,247,169,29,61,252,93,251,170,251,16,
+190,251,2,247,95,230,117,251,18,251,141,251,3,190,251,2,247,66,217,97,251,
+140,247,99,10,203,248,14,24,14,247,89,182,247,13,29,247,180,251,81,171,10,
+14,247,89,28,5,137,247,200,10,254,82,6,251,89,251,27,43,251,72,45,200,69,
+238,192,213,182,217,155,31,251,19,247,31,5,184,172,162,225,30,218,29,14,247,
+89,248,45,231,21,248,78,10,241,247,12,186,241,192,99,169,61,169,30,251,97,
+251,15,5,127,163,134,170,177,26,195,150,208,153,214,30,247,139,28,5,19,5,
+247,30,29,213,247,250,248,184,10,14,248,176,28,6,162,247,166,29,104,107,134,
+131,109,31,187,247,143,5,247,115,6,159,166,130,121,137,31,131,251,91,5,247,
+51,6,211,247,230,5,247,26,29,248,254,241,7,84,146,76,248,46,10,247,19,249,
+53,24,159,158,168,155,165,196,205,92,169,29,247,196,28,5,139,28,4,141,21,
+247,101,28,251,72,251,101,248,6,7,251,153,251,43,251,97,251,117,251,162,26,
+251,141,247,44,251,195,248,97,247,101,247,93,228,247,19,247,7,30,140,247,
+95,5,251,81,251,49,251,70,58,251,26,27,251,58,251,93,238,247,173,247,190,
+247,20,247,118,247,75,247,37,31,14,247,89,251,23,22,28,4,196,6,209,247,250,
+5,251,52,6,61,251,109,5,121,133,107,128,120,27,251,103,6,247,103,250,241,
+143,165,162,145,167,141,25,139,199,144,192,143,30,248,143,29,194,132,202,
+135,139,26,164,137,157,135,135,115,251,103,254,243,24,251,115,6,119,112,148,
+157,141,31,149,247,111,5,251,51,6,14,247,89,28,5,137,28,5,94,248,202,29,247,
+24,7,247,59,247,42,248,10,10,248,158,5,115,6,84,146,76,248,46,10,247,103,
+250,243,24,248,174,10,248,210,248,94,247,244,21,251,115,93,247,17,247,146,
+29,175,29,251,4,248,10,29,247,69,250,55,5,247,30,29,213,247,250,248,184,10,
+14,249,152,250,123,28,4,238,21,248,0,29,254,194,209,10,247,31,6,251,110,254,
+226,248,137,10,251,39,128,5,35,250,182,7,247,62,247,40,251,7,251,197,77,31,
+247,44,6,241,248,160,37,248,184,29,252,240,248,171,10,254,170,5,112,133,114,
+121,117,27,252,189,6,114,121,157,166,145,31,247,108,250,218,5,14,248,87,28,
+5,139,22,248,133,29,227,248,84,5,247,115,184,251,39,232,251,83,27,61,251,
+29,94,91,251,4,31,222,248,56,5,247,79,6,168,143,127,110,31,130,251,70,5,247,
+42,6,207,247,234,5,254,224,6,69,251,234,248,169,10,202,247,70,5,170,149,148,
+149,167,27,247,79,6,251,107,254,215,132,248,122,10,248,248,243,7,47,150,117,
+141,120,155,145,166,25,236,248,129,5,150,157,247,29,214,186,27,247,1,211,
+102,251,25,112,31,57,252,45,135,112,114,123,115,137,25,251,11,128,5,35,7,
+14,248,83,28,5,172,248,177,21,247,123,251,64,247,40,251,123,61,251,40,118,
+76,37,30,221,248,51,5,247,45,6,156,147,131,123,31,131,251,120,5,247,41,6,
+213,248,11,5,254,154,6,63,252,11,5,247,40,6,220,247,120,5,155,146,153,147,
+155,27,247,46,6,251,107,254,215,133,112,112,123,115,137,25,251,13,128,5,35,
+248,240,243,7,41,247,244,10,235,248,133,5,205,217,225,151,202,27,247,34,243,
+55,251,39,251,54,59,251,162,251,88,31,34,7,247,238,247,117,247,122,247,236,
+31,14,251,217,249,16,252,62,21,208,7,100,59,121,134,125,27,111,122,157,185,
+150,31,247,1,248,112,5,251,69,6,35,252,90,5,98,91,87,106,79,27,106,120,174,
+177,148,31,247,1,248,106,248,93,10,52,252,13,5,72,124,186,47,247,24,27,226,
+206,160,176,197,31,122,143,157,98,230,27,215,237,170,157,175,31,14,251,217,
+249,244,249,199,158,10,131,28,4,170,158,10,226,33,10,247,106,28,5,58,59,10,
+226,33,10,127,250,195,49,29,226,33,10,38,28,4,131,58,29,226,33,10,95,28,5,
+125,61,29,226,33,10,128,28,5,142,48,29,226,33,10,119,28,5,115,36,10,226,33,
+10,119,28,5,115,248,215,10,226,33,10,103,28,5,28,80,29,226,33,10,103,28,5,
+28,248,205,29,226,33,10,107,28,5,2,62,29,248,62,248,92,34,29,226,33,10,107,
+28,5,2,248,213,29,226,33,10,107,28,5,2,248,211,10,226,33,10,107,28,5,2,248,
+205,10,226,33,10,39,28,5,101,75,10,226,33,10,251,95,28,5,111,37,10,226,33,
+10,252,52,252,197,44,29,226,33,10,251,230,251,123,70,10,226,33,10,252,4,252,
+8,180,29,226,33,10,252,222,252,17,65,29,226,33,10,251,26,252,55,63,10,226,
+28,5,254,242,10,183,247,41,248,89,10,95,251,41,180,10,251,255,247,223,78,
+29,14,226,28,4,176,248,72,21,247,21,251,68,7,229,248,70,5,251,164,6,47,252,
+70,5,251,204,6,238,248,95,247,172,10,76,251,195,5,251,81,251,21,247,52,6,
+98,251,88,5,251,3,115,212,251,46,247,95,247,164,10,228,10,188,247,123,5,251,
+164,22,98,251,86,5,71,65,59,84,47,27,88,110,196,203,152,31,182,247,88,5,14,
+251,221,250,11,250,171,21,216,251,9,7,198,247,150,5,251,70,6,80,251,150,5,
+251,95,6,203,247,167,5,48,248,49,29,247,3,127,98,251,73,5,251,15,62,244,6,
+112,251,11,247,132,10,248,63,29,170,247,32,5,251,69,22,113,251,9,5,98,92,
+86,104,77,27,108,119,176,176,147,31,168,247,11,5,14,247,241,47,10,14,247,
+241,47,10,252,20,247,138,34,29,247,241,47,10,252,147,118,42,10,247,241,47,
+10,251,216,247,195,36,10,247,241,47,10,252,143,247,191,37,10,247,241,47,10,
+254,14,28,250,63,65,29,248,170,28,6,52,249,189,21,200,49,247,46,251,93,72,
+77,125,114,82,30,142,153,5,240,10,247,9,247,55,171,247,15,247,27,31,251,19,
+200,247,18,111,247,20,27,248,88,29,31,247,237,29,144,176,141,164,31,247,165,
+161,247,208,247,15,247,107,26,251,158,141,21,251,17,251,50,248,87,10,202,
+248,9,29,14,247,57,250,201,118,10,14,251,166,249,195,28,5,137,21,64,6,182,
+65,144,123,126,26,119,127,124,108,132,130,141,140,129,30,252,152,240,5,251,
+55,7,248,128,43,5,183,95,175,91,83,26,114,113,122,106,132,133,140,140,132,
+30,252,146,240,5,54,7,184,251,95,5,184,6,151,242,248,44,59,5,138,148,148,
+138,148,27,207,216,186,246,218,117,201,98,193,31,158,143,183,155,224,26,209,
+106,229,119,172,30,14,248,145,28,5,141,118,10,28,251,111,251,31,21,61,75,
+76,61,61,203,78,217,216,203,200,217,217,75,202,62,31,252,46,4,61,75,76,61,
+61,203,76,217,216,203,202,217,217,75,202,62,31,14,226,250,234,249,44,21,247,
+125,251,3,247,19,251,70,33,94,47,96,96,194,86,139,30,247,41,6,193,100,147,
+32,100,26,251,11,251,50,251,244,251,95,141,30,76,251,15,182,247,11,153,141,
+170,147,180,31,247,30,249,17,247,172,10,37,252,117,5,125,76,132,85,113,26,
+251,54,247,36,32,247,131,248,110,247,39,248,144,247,73,30,14,251,217,249,
+216,28,4,159,21,247,32,67,215,251,7,70,109,84,113,114,175,107,139,30,236,
+6,174,115,144,75,116,26,67,37,251,103,251,24,140,30,98,59,165,211,147,140,
+158,144,163,31,229,248,18,248,93,10,73,251,181,5,129,101,135,107,123,26,42,
+232,75,247,48,247,200,234,247,197,247,0,30,14,170,45,252,58,21,247,175,6,
+155,219,135,180,95,247,38,127,247,48,25,122,175,185,130,196,27,247,8,247,
+45,237,178,194,31,86,140,180,55,247,43,248,43,10,248,129,29,114,170,215,154,
+31,247,47,249,174,5,251,165,6,251,50,253,183,5,128,110,71,116,80,27,251,52,
+151,247,19,239,158,31,247,12,248,246,5,251,165,6,14,247,22,28,4,184,250,123,
+21,248,164,10,251,187,251,29,251,236,251,89,251,43,130,247,32,247,16,247,
+130,247,26,247,154,247,4,247,29,30,252,58,6,123,43,247,31,129,5,251,15,251,
+29,251,8,251,83,251,88,26,251,132,247,33,251,46,247,185,248,8,247,140,247,
+196,247,205,248,166,29,5,14,251,188,250,21,28,5,102,21,251,162,6,139,178,
+60,63,26,251,68,51,251,99,251,19,40,133,221,214,247,36,225,247,47,213,221,
+30,251,167,6,127,82,231,135,5,59,55,64,251,5,251,10,26,251,36,231,47,247,
+80,247,136,247,54,247,72,247,81,214,118,201,109,182,30,235,143,5,14,247,22,
+28,4,161,248,91,21,247,13,73,7,144,140,144,145,26,248,166,29,155,239,5,248,
+164,10,86,135,84,130,86,30,252,86,6,186,247,60,228,247,50,218,236,8,252,58,
+6,123,43,247,31,129,60,51,63,251,2,95,251,11,25,44,251,13,201,6,134,110,137,
+111,110,26,251,132,247,33,251,46,247,185,247,209,247,119,247,113,247,151,
+199,30,252,222,251,249,21,251,43,130,247,32,247,16,169,141,171,143,170,31,
+248,85,6,251,88,85,32,251,53,251,26,27,14,47,28,4,144,248,52,29,251,249,78,
+7,175,136,179,136,139,26,161,138,145,136,137,125,45,252,68,24,251,27,110,
+79,40,251,31,27,59,60,179,243,161,143,179,149,186,31,231,248,47,142,154,148,
+143,155,140,25,139,181,142,180,142,30,200,252,38,78,7,175,136,177,136,139,
+26,158,138,149,136,137,125,46,252,49,24,127,84,133,91,115,26,251,44,247,15,
+72,247,89,247,137,247,10,247,6,247,62,175,30,242,248,109,141,150,146,147,
+151,140,25,14,247,50,28,4,254,250,31,21,248,64,29,251,5,252,127,248,144,10,
+248,120,29,247,5,248,111,247,158,29,251,1,252,105,247,153,29,247,17,248,181,
+248,139,10,14,251,171,250,70,28,5,49,21,194,251,191,84,7,199,136,154,137,
+144,131,137,126,25,65,251,186,5,44,117,94,71,32,27,77,80,168,207,154,142,
+168,147,170,31,212,247,177,142,152,144,147,156,141,25,206,142,5,194,251,228,
+84,7,198,136,155,137,143,131,136,126,25,68,251,173,5,129,100,135,104,122,
+26,251,5,242,91,247,50,247,91,237,222,247,15,169,30,221,247,219,141,152,144,
+147,157,141,25,14,248,81,32,10,247,2,248,169,59,10,248,81,32,10,251,8,247,
+158,49,29,248,81,32,10,251,97,247,242,58,29,248,81,32,10,251,40,248,236,61,
+29,248,81,32,10,251,7,248,253,48,29,248,81,32,10,251,16,248,226,36,10,248,
+81,32,10,251,16,248,226,248,215,10,248,81,32,10,251,32,248,139,80,29,248,
+81,32,10,251,32,248,139,248,205,29,248,81,32,10,251,28,248,113,62,29,248,
+62,248,92,34,29,248,81,32,10,251,28,248,113,248,213,29,248,81,32,10,251,28,
+248,113,248,211,10,248,81,32,10,251,28,248,113,248,205,10,248,81,32,10,251,
+96,248,212,75,10,248,81,32,10,251,199,248,222,37,10,248,81,32,10,252,200,
+28,249,26,44,29,248,81,32,10,252,122,28,250,100,70,10,248,81,32,10,252,152,
+28,249,215,180,29,248,81,32,10,253,114,28,249,206,65,29,248,81,32,10,252,
+238,28,249,168,63,10,248,81,28,6,84,248,68,10,241,252,185,248,57,10,49,252,
+83,24,252,214,6,231,248,81,247,101,29,47,252,83,24,251,107,251,25,247,81,
+6,114,251,0,5,247,157,29,182,247,103,5,247,109,247,25,251,82,6,227,248,81,
+248,138,10,252,11,252,247,21,112,251,31,5,251,117,94,47,251,58,251,105,27,
+251,15,251,15,206,247,66,176,146,205,155,217,31,161,247,0,5,14,247,50,28,
+4,164,248,93,21,247,21,251,3,7,203,247,170,248,139,10,237,145,5,248,64,29,
+75,251,170,5,252,77,6,206,247,170,247,158,29,74,251,170,5,251,30,251,21,247,
+0,6,125,77,247,153,29,170,247,30,5,252,126,251,247,21,248,120,29,155,207,
+5,248,77,6,120,55,248,144,10,14,249,86,28,7,133,28,6,37,21,247,25,251,15,
+219,251,11,33,51,63,251,7,80,180,78,139,30,247,84,6,251,52,45,251,36,251,
+93,70,30,164,247,19,248,138,10,247,6,149,5,241,252,164,126,10,244,248,154,
+5,247,219,189,247,91,247,127,247,222,26,252,50,252,117,158,29,249,86,78,10,
+251,127,248,251,34,29,249,86,78,10,251,254,247,240,42,10,249,86,78,10,251,
+67,249,52,36,10,249,86,78,10,251,250,249,48,37,10,249,86,78,10,253,165,28,
+250,32,65,29,248,73,28,5,199,250,44,21,247,86,251,19,247,185,251,105,251,
+5,57,71,43,86,201,65,139,30,247,103,6,169,102,156,49,251,35,26,251,234,251,
+157,251,240,251,184,36,251,29,196,247,82,139,145,207,155,211,30,247,65,249,
+211,5,252,116,37,6,190,135,197,135,139,26,184,135,145,128,131,100,251,29,
+253,45,24,116,32,127,55,119,26,251,124,247,72,251,23,247,162,248,185,247,
+210,248,71,248,150,30,14,247,206,250,190,28,5,230,21,251,12,196,251,205,252,
+230,98,247,156,247,123,29,247,1,253,71,251,248,253,56,247,2,78,247,172,248,
+162,197,252,2,5,247,127,6,249,87,28,5,13,247,4,151,5,247,183,29,80,248,12,
+5,14,250,20,160,10,241,254,42,112,78,118,91,82,35,247,180,29,245,247,59,219,
+30,249,74,28,5,176,5,14,247,31,248,223,28,5,107,21,247,22,10,176,247,89,250,
+84,28,5,84,247,4,151,5,248,82,10,169,134,122,115,252,252,254,20,24,14,248,
+83,28,6,0,247,200,10,252,82,6,186,251,15,169,251,37,251,11,26,251,203,251,
+39,252,187,251,230,251,99,104,247,80,247,66,247,183,247,42,247,247,247,84,
+247,133,30,252,84,6,110,251,15,247,9,129,166,137,145,119,124,118,25,139,251,
+19,251,56,121,113,30,37,251,46,44,251,74,251,77,26,251,186,247,79,251,118,
+248,8,248,116,247,225,248,50,248,29,246,105,247,0,106,240,30,133,151,102,
+235,139,26,131,160,147,155,168,141,247,16,153,24,14,92,68,10,14,252,48,248,
+195,215,21,187,91,169,77,97,98,127,120,117,30,176,251,48,104,61,81,76,74,
+58,25,102,247,209,133,201,88,168,47,140,25,251,50,96,5,95,7,184,138,186,136,
+139,26,163,140,137,121,147,31,167,73,167,251,234,129,26,141,112,129,108,117,
+97,8,247,22,6,225,227,247,56,247,61,247,12,247,93,8,148,154,159,175,181,26,
+14,252,68,249,171,28,5,39,161,29,158,28,6,158,161,29,92,68,10,71,248,195,
+36,10,92,68,10,253,14,28,251,63,65,29,92,249,199,219,248,148,10,103,251,86,
+85,29,247,181,250,232,146,10,80,28,4,175,28,4,120,21,251,146,251,97,251,166,
+225,29,247,56,247,116,247,195,29,248,46,249,113,106,21,248,46,250,174,247,
+104,247,130,247,242,10,251,146,251,84,251,31,254,29,252,21,30,247,35,10,14,
+64,250,150,250,17,21,219,67,190,43,78,96,119,106,104,30,206,251,138,86,251,
+23,251,31,251,87,251,33,251,47,25,81,247,226,5,236,192,247,16,213,247,51,
+26,223,49,215,251,39,251,13,251,35,251,3,251,4,120,145,105,141,134,30,143,
+111,153,57,139,26,123,141,108,145,80,153,122,49,24,123,191,178,131,188,27,
+206,252,36,147,94,139,82,109,75,25,247,90,6,247,26,247,36,247,156,247,185,
+247,74,247,221,8,153,164,170,198,207,26,252,166,108,21,59,120,94,41,82,30,
+110,247,50,5,175,133,168,193,182,27,167,191,118,94,31,14,92,249,119,250,220,
+21,251,12,196,251,35,251,159,123,231,62,183,251,25,247,207,29,159,86,160,
+251,51,155,251,45,251,214,252,240,24,247,2,77,247,125,248,69,5,144,83,142,
+100,135,247,97,29,247,174,29,86,251,21,49,34,39,251,27,25,105,247,206,5,14,
+248,113,28,6,89,250,33,21,248,90,10,251,47,251,232,49,251,91,91,38,80,248,
+251,24,145,29,211,252,220,24,40,251,59,49,48,57,247,13,10,14,52,250,137,250,
+17,21,247,174,29,71,251,32,251,58,251,133,251,75,251,90,25,247,69,250,16,
+247,172,29,251,124,28,251,101,159,10,178,247,91,247,118,247,82,247,189,247,
+238,247,65,247,207,25,153,164,170,198,209,26,14,248,224,68,10,248,229,248,
+101,52,10,14,28,4,199,68,10,248,229,248,101,52,10,248,244,28,5,12,52,10,14,
+28,7,66,68,10,248,229,248,101,52,10,248,244,28,5,12,52,10,248,244,28,5,12,
+52,10,14,92,250,175,186,21,213,7,69,141,67,143,139,26,102,137,143,170,127,
+31,96,247,0,96,248,208,155,26,137,184,153,190,174,209,8,251,93,6,251,25,251,
+37,251,144,251,175,251,76,251,228,8,125,115,108,79,69,26,60,213,87,235,203,
+202,158,174,174,30,82,247,152,192,247,21,229,243,239,247,27,25,195,252,164,
+149,37,217,89,247,35,137,25,14,252,48,249,178,249,193,21,184,7,94,140,92,
+141,139,26,115,137,142,157,132,31,111,204,111,247,235,149,26,137,166,149,
+169,161,181,8,251,22,6,52,52,251,56,251,61,251,11,251,94,8,130,125,119,103,
+97,26,91,187,108,201,181,180,150,160,161,30,102,247,48,174,217,197,201,204,
+220,25,176,251,209,145,78,190,109,232,138,25,14,203,28,4,186,249,236,21,231,
+90,215,43,251,35,251,114,251,189,55,68,30,247,72,63,104,247,93,251,123,27,
+251,97,114,251,148,251,35,111,31,237,6,194,153,184,247,15,209,27,233,217,
+251,175,61,170,31,63,55,251,5,39,251,15,26,251,13,244,100,243,247,38,247,
+25,247,21,247,38,235,94,223,102,225,30,217,206,247,44,247,101,247,5,27,202,
+135,251,29,98,31,229,6,156,216,175,213,219,26,253,45,253,58,21,94,100,92,
+94,102,112,157,178,191,215,225,172,177,30,149,105,168,67,104,26,14,80,250,
+173,250,17,21,219,67,190,45,75,76,119,104,104,30,237,251,136,88,251,23,47,
+251,3,251,40,251,41,25,82,248,172,129,242,63,188,251,33,141,25,251,134,65,
+5,68,7,198,137,207,136,139,26,184,137,149,139,150,107,186,251,66,161,251,
+234,160,251,89,8,38,61,251,45,251,70,251,15,26,251,15,229,45,247,62,247,31,
+247,44,247,31,247,17,166,110,247,189,135,176,30,247,107,247,86,247,7,247,
+52,247,19,247,121,8,151,166,170,196,209,26,253,110,254,203,21,251,7,113,110,
+98,104,104,162,196,184,211,246,192,178,30,143,112,147,47,131,26,14,252,47,
+249,177,28,5,39,21,186,92,172,75,100,98,124,121,117,30,202,251,39,104,61,
+80,71,43,49,25,102,247,216,133,200,90,168,46,141,25,251,47,248,157,29,157,
+137,148,137,143,120,169,35,156,251,97,151,251,9,8,76,92,36,33,65,26,65,199,
+82,247,0,231,238,223,215,153,120,247,70,135,162,30,247,33,247,10,213,234,
+223,247,31,8,147,153,160,174,180,26,252,111,253,27,21,71,122,121,113,116,
+116,153,174,166,185,202,173,164,30,141,122,146,84,133,26,14,59,248,188,247,
+83,21,248,156,36,251,5,247,123,251,19,27,58,81,251,71,91,91,139,108,174,31,
+173,157,247,17,193,27,230,247,88,252,95,251,86,149,31,139,57,251,88,251,24,
+26,251,24,181,47,196,196,171,247,15,244,244,102,247,97,139,30,198,247,76,
+247,185,248,75,247,90,26,251,50,6,251,115,251,37,251,171,65,251,114,30,14,
+252,70,247,126,251,237,185,29,252,70,248,110,250,24,185,29,247,206,73,29,
+14,251,69,250,248,248,52,29,251,219,77,7,169,138,175,139,139,26,150,138,155,
+137,131,123,251,188,252,148,24,53,248,148,5,154,136,151,143,154,27,139,171,
+139,167,140,30,201,251,251,77,7,162,138,168,138,139,26,154,152,136,123,142,
+31,247,23,253,141,248,169,10,248,96,249,156,5,14,203,28,4,203,250,33,21,229,
+252,42,45,7,186,182,135,139,31,158,145,131,120,129,31,251,253,252,244,37,
+248,234,135,160,147,151,157,141,25,225,145,5,233,252,119,45,7,247,5,129,247,
+56,254,44,5,247,92,6,248,199,250,46,5,14,247,206,73,29,251,15,248,228,36,
+10,247,206,73,29,253,113,28,249,208,65,29,247,206,28,6,16,248,68,10,247,183,
+29,104,247,115,247,21,247,105,5,219,247,25,247,5,247,111,247,50,26,209,83,
+196,72,79,80,57,90,30,94,196,102,92,26,35,72,251,19,79,42,30,98,74,72,248,
+70,247,123,29,247,21,253,197,252,132,253,199,5,247,46,6,248,11,249,0,178,
+251,144,5,247,127,6,249,87,28,5,13,5,14,247,35,28,4,125,250,148,21,251,146,
+251,47,251,46,225,29,247,6,243,247,195,29,250,167,73,29,249,158,151,248,210,
+10,28,6,236,73,29,249,158,151,67,29,249,250,149,248,210,10,28,9,197,73,29,
+249,158,151,67,29,249,250,149,67,29,249,250,149,248,210,10,247,206,28,5,20,
+22,243,7,105,141,94,142,139,26,114,121,143,165,135,31,251,93,28,4,244,5,251,
+128,6,253,86,28,250,244,251,5,126,5,37,248,140,243,7,92,141,83,139,139,26,
+121,142,114,141,154,165,248,88,249,234,24,247,28,253,234,5,113,143,118,134,
+119,27,139,90,139,96,137,30,35,7,14,247,57,28,4,146,235,21,248,102,10,251,
+96,250,15,5,251,107,6,253,8,247,182,10,248,42,248,250,24,247,33,252,240,248,
+126,10,248,117,7,14,247,228,28,6,23,248,14,29,252,124,35,7,223,131,184,132,
+153,113,117,110,25,139,252,5,252,78,96,90,30,125,178,251,52,248,84,139,26,
+127,180,161,157,164,141,247,19,152,24,243,252,240,35,7,247,21,120,247,156,
+253,154,5,63,51,251,27,251,23,251,27,26,251,19,247,42,110,235,247,62,247,
+64,233,247,79,229,69,247,25,111,223,30,248,217,249,78,5,253,142,254,199,21,
+90,121,92,86,106,102,153,176,209,196,204,180,186,30,152,109,169,69,102,26,
+14,248,85,48,10,14,49,250,244,28,5,42,21,160,103,195,67,84,113,112,130,131,
+30,190,251,23,94,51,56,251,3,77,58,25,108,248,68,251,44,125,83,251,10,75,
+251,21,78,251,1,25,113,248,6,44,154,251,71,95,5,100,7,241,129,174,252,138,
+125,105,5,247,29,6,203,229,223,247,27,208,247,19,165,251,244,24,247,24,6,
+172,176,247,224,248,15,247,28,26,14,248,85,48,10,251,240,248,136,34,29,248,
+85,48,10,252,111,247,125,42,10,248,85,48,10,251,243,247,125,44,29,248,85,
+48,10,251,192,248,80,41,10,248,85,48,10,252,171,248,78,47,29,248,85,48,10,
+252,4,248,179,75,10,248,85,48,10,254,5,28,251,61,65,29,250,13,250,105,250,
+123,21,145,29,190,252,222,24,247,105,6,223,247,5,247,100,248,21,226,247,43,
+8,247,79,247,0,247,80,247,209,211,27,247,65,251,16,5,201,167,191,194,206,
+26,225,251,26,186,55,251,3,51,108,47,56,30,59,51,77,37,47,251,46,60,251,24,
+251,35,251,178,84,32,8,14,162,28,4,133,28,5,41,21,159,105,197,67,84,112,110,
+131,131,30,188,251,21,98,49,53,251,3,78,57,25,108,248,68,251,44,125,84,251,
+9,73,251,21,78,251,0,25,114,248,4,43,156,251,70,94,5,100,7,239,129,176,252,
+138,125,106,5,247,29,6,203,229,223,247,25,208,247,19,166,251,242,24,247,23,
+6,172,176,247,223,248,13,247,29,26,251,49,253,150,21,160,102,196,67,86,112,
+112,129,131,30,188,251,21,96,51,55,251,3,78,58,25,108,248,68,251,43,122,81,
+251,8,76,251,19,77,251,3,25,115,248,7,43,153,251,71,96,5,98,7,240,131,176,
+252,140,122,106,5,247,32,6,202,229,223,247,28,209,247,19,165,251,245,24,247,
+23,6,172,176,247,224,248,15,247,27,26,14,248,81,28,5,244,188,21,205,7,251,
+48,153,82,249,220,163,194,5,251,103,6,39,251,44,251,21,251,115,32,251,105,
+99,248,224,24,251,93,6,86,76,252,144,253,9,251,120,26,105,194,44,247,3,223,
+177,184,156,154,30,61,247,109,204,247,37,247,24,247,77,233,247,29,25,188,
+253,101,247,123,164,225,247,88,240,247,107,233,247,74,25,176,252,254,247,
+41,114,5,14,248,81,249,70,249,70,21,92,251,133,5,251,82,102,96,251,53,251,
+21,27,251,12,142,247,47,247,113,182,31,180,247,105,206,247,74,247,60,191,
+8,230,7,251,112,135,251,163,251,99,76,251,219,8,251,118,95,179,251,165,247,
+187,27,247,104,241,247,40,217,173,31,61,186,251,40,247,103,247,188,247,26,
+247,165,247,118,185,30,206,247,219,251,67,247,111,251,155,131,8,48,7,247,
+38,87,136,251,74,98,251,105,8,251,113,96,82,251,47,251,12,27,251,20,158,247,
+53,247,82,176,31,186,247,133,5,14,247,251,28,5,96,248,179,21,247,185,251,
+90,247,80,251,239,252,90,251,226,251,228,252,31,251,50,237,251,52,247,77,
+247,35,247,1,191,218,208,30,58,178,233,89,247,32,27,247,213,247,27,247,247,
+247,105,31,251,178,131,21,251,15,104,251,189,251,56,47,94,194,225,30,247,
+46,247,19,208,247,19,26,195,106,212,75,37,71,251,6,55,30,96,154,77,96,26,
+251,0,61,251,58,251,25,75,104,217,235,247,174,247,132,247,232,247,144,247,
+62,247,1,251,64,251,96,30,14,250,20,51,29,14,247,93,28,5,222,248,52,29,251,
+226,77,7,166,138,172,139,139,26,159,138,152,137,131,123,251,117,252,80,24,
+81,248,162,5,251,52,6,251,160,252,152,101,248,70,5,154,137,151,142,150,27,
+139,172,140,170,140,30,201,252,0,77,7,165,138,169,138,139,26,162,137,147,
+138,140,123,207,253,141,24,247,37,6,247,182,248,200,208,252,200,5,247,27,
+6,248,37,249,156,5,14,248,155,28,6,139,250,33,21,229,252,66,47,7,182,137,
+180,137,139,26,156,153,145,127,133,31,251,156,252,142,71,248,244,5,251,103,
+6,251,209,252,229,94,248,123,5,149,147,139,147,30,139,180,141,188,141,30,
+231,252,105,47,7,219,135,5,157,137,150,141,127,26,223,254,40,5,247,84,6,247,
+238,249,23,219,253,23,5,247,74,6,248,132,250,48,5,14,250,20,51,29,252,90,
+248,171,34,29,250,20,51,29,252,217,247,160,42,10,250,20,51,29,252,93,247,
+160,44,29,250,20,51,29,252,42,248,115,41,10,250,20,51,29,253,21,248,113,47,
+29,250,20,51,29,254,139,28,249,208,65,29,28,4,221,28,9,84,28,5,85,21,239,
+52,216,251,16,251,110,251,6,251,7,251,161,251,19,30,251,205,253,42,248,20,
+29,155,142,156,140,30,237,143,5,247,111,10,244,254,64,5,247,101,6,248,6,249,
+154,5,247,206,247,42,239,247,191,212,27,247,80,251,35,5,139,247,6,204,228,
+26,14,247,28,28,4,210,249,47,21,247,17,251,60,7,174,247,7,5,247,25,247,17,
+45,6,210,247,120,220,151,5,241,251,226,35,7,166,137,172,139,139,26,159,137,
+152,137,131,112,77,251,97,24,251,91,6,117,247,234,5,251,52,6,32,251,234,5,
+251,80,6,128,247,97,5,164,137,151,143,150,27,139,172,141,170,141,30,243,252,
+0,35,7,165,137,169,137,139,26,162,137,147,137,140,112,150,251,95,24,251,21,
+251,17,247,27,6,145,251,7,5,251,33,251,17,247,40,6,177,253,80,5,247,37,6,
+247,182,250,64,208,254,64,5,247,27,6,247,109,249,80,5,251,128,247,132,21,
+247,44,6,104,251,7,5,251,2,6,252,123,247,7,21,247,35,6,103,251,7,5,38,6,248,
+125,251,17,21,203,6,87,251,63,5,252,130,247,63,21,194,6,92,251,45,5,14,230,
+61,10,14,230,61,10,14,251,196,249,35,216,21,185,84,170,85,46,48,251,1,53,
+78,30,247,11,100,94,215,56,27,121,251,30,102,127,107,31,101,7,247,23,124,
+159,137,203,251,67,151,91,25,98,43,70,67,92,102,88,212,24,40,124,81,101,91,
+200,113,201,247,9,237,247,67,169,159,31,55,167,199,251,13,225,27,217,192,
+149,172,200,31,211,7,101,81,108,139,125,27,107,129,181,189,115,31,115,189,
+108,220,130,168,180,232,217,210,182,169,197,74,24,229,142,201,171,31,14,251,
+215,250,17,28,5,41,114,29,163,28,6,160,114,29,230,61,10,60,248,80,41,10,230,
+61,10,251,206,248,78,47,29,230,28,4,176,250,19,165,10,182,176,141,144,174,
+31,125,77,108,251,9,139,26,123,76,94,88,96,133,251,44,247,31,24,65,247,245,
+10,195,80,247,31,247,84,247,11,237,247,38,174,30,233,248,27,5,247,57,29,31,
+14,230,250,107,248,91,21,247,13,251,132,7,205,247,20,238,237,198,183,248,
+108,10,251,35,251,31,251,74,251,36,44,31,247,91,80,69,247,19,251,19,27,111,
+251,105,248,44,29,162,136,198,251,52,176,251,7,25,251,143,251,13,247,162,
+6,74,251,40,40,251,3,71,80,247,87,10,247,11,221,156,194,233,31,248,41,29,
+114,196,109,220,118,200,8,14,230,249,117,248,203,21,207,247,43,235,218,205,
+188,248,108,10,251,35,251,41,251,64,251,36,44,31,247,69,37,251,8,247,31,59,
+27,111,251,115,248,44,29,186,95,243,251,46,212,251,34,25,75,251,52,251,12,
+251,47,67,77,248,33,29,247,87,247,225,194,166,31,247,72,251,218,166,70,36,
+26,38,56,63,39,95,88,148,158,75,30,118,140,110,138,105,30,114,200,206,122,
+198,27,247,137,247,45,247,83,247,28,247,35,115,241,251,135,248,41,31,14,230,
+28,4,176,250,19,186,29,180,251,21,217,251,68,247,7,109,8,108,104,75,71,247,
+88,10,217,145,203,159,210,180,8,178,10,14,249,106,61,10,248,220,248,99,52,
+10,14,28,5,81,61,10,248,220,248,99,52,10,248,244,28,5,12,52,10,14,247,173,
+28,5,139,250,111,21,251,189,6,252,15,252,91,115,247,105,5,247,56,120,62,242,
+251,40,27,251,109,251,44,73,251,23,80,178,67,247,17,31,247,28,247,101,5,214,
+176,96,251,44,156,31,182,252,8,253,19,253,152,5,247,191,6,248,14,248,90,164,
+251,105,5,251,56,157,217,39,247,40,27,247,109,247,45,202,247,24,200,98,209,
+251,16,31,251,28,251,99,5,59,109,180,247,43,120,31,94,248,9,5,14,251,91,249,
+177,247,24,153,29,251,91,250,161,28,5,97,153,29,247,185,57,10,14,247,185,
+57,10,14,247,185,57,10,45,248,113,41,10,247,185,57,10,251,221,248,111,47,
+29,247,185,28,4,134,249,37,21,247,23,251,151,7,248,37,248,85,248,141,29,247,
+19,149,5,128,29,247,95,252,87,24,251,161,251,23,247,167,6,252,108,252,158,
+245,10,248,251,241,7,247,196,10,251,125,248,158,24,14,247,185,249,232,249,
+115,21,248,84,248,138,248,141,29,247,19,149,5,128,29,247,137,252,179,24,252,
+144,252,197,247,82,29,247,62,252,30,5,174,57,171,45,66,26,59,75,74,35,77,
+85,149,156,72,30,133,32,5,115,200,222,121,212,27,247,175,247,26,247,77,247,
+34,211,99,247,8,97,231,31,14,247,185,28,5,195,28,4,248,113,10,244,7,247,62,
+137,247,37,251,7,80,251,197,8,247,41,6,244,248,160,5,173,10,14,250,146,57,
+10,249,229,149,248,210,10,28,6,215,57,10,249,229,149,67,29,249,250,149,248,
+210,10,162,35,10,14,252,3,250,0,28,5,50,21,172,7,251,18,175,5,75,6,251,74,
+252,6,117,234,116,237,121,196,25,247,8,102,103,143,79,27,111,251,23,104,129,
+109,31,101,7,247,33,129,5,151,157,251,18,251,4,166,31,167,251,9,163,251,12,
+143,119,65,251,18,72,72,79,127,82,232,24,56,137,114,79,99,26,104,171,81,247,
+0,247,53,247,3,247,13,247,35,228,30,222,247,25,208,247,42,177,218,163,189,
+203,232,160,157,8,14,162,35,10,247,143,248,187,59,10,162,35,10,251,62,247,
+176,42,10,162,35,10,93,247,176,44,29,162,35,10,95,248,195,81,29,162,35,10,
+156,248,244,36,10,162,35,10,140,248,157,80,29,162,35,10,140,248,157,80,29,
+162,35,10,144,248,131,41,10,162,35,10,251,122,248,129,47,29,162,35,10,76,
+248,230,75,10,162,35,10,251,58,248,240,37,10,162,35,10,253,47,28,249,224,
+65,29,162,28,4,127,249,51,21,240,251,33,7,162,173,159,166,151,150,245,204,
+24,248,90,10,251,7,251,144,5,251,140,6,125,190,5,247,203,29,147,149,101,81,
+150,31,251,54,38,247,73,6,151,77,152,68,154,72,231,10,151,166,157,173,159,
+174,8,252,42,22,247,69,6,251,12,251,157,120,230,119,232,121,220,25,14,246,
+28,5,156,28,4,111,21,200,55,217,44,251,129,251,7,32,251,182,251,9,30,139,
+251,21,251,210,78,251,45,30,108,247,51,104,247,56,111,233,8,247,83,81,82,
+149,47,27,98,251,93,80,122,90,31,76,7,247,109,122,5,158,169,251,101,251,80,
+180,31,247,245,29,251,8,251,101,38,251,5,47,119,51,247,48,24,251,21,135,102,
+40,72,26,81,188,41,247,58,247,138,247,64,247,95,247,129,247,29,30,217,247,
+27,247,207,249,128,139,26,247,54,211,158,231,223,27,247,18,251,35,5,225,198,
+189,190,199,26,14,162,248,239,110,21,247,19,247,115,246,247,142,198,247,23,
+248,142,29,245,204,24,248,207,10,125,114,126,116,126,118,8,157,87,85,147,
+87,27,251,104,251,24,251,9,251,44,55,197,251,8,247,66,247,30,247,17,226,247,
+33,247,5,31,162,117,163,114,164,108,223,225,24,114,176,113,171,109,167,162,
+173,160,175,161,176,8,252,164,251,194,21,98,101,166,184,140,31,222,141,208,
+193,247,3,27,175,176,136,128,176,31,251,64,251,1,94,116,79,27,14,162,28,4,
+147,250,33,21,138,10,173,251,47,170,251,50,153,64,34,252,168,24,248,108,232,
+6,247,105,10,219,248,27,240,247,83,221,247,86,189,247,2,25,248,90,29,14,162,
+212,123,21,247,189,6,54,252,69,5,248,108,232,6,247,105,10,200,247,187,5,247,
+226,247,10,251,195,6,235,247,75,216,247,76,187,245,248,142,29,245,204,24,
+138,10,170,251,36,168,251,37,154,59,8,251,205,6,14,164,28,4,172,28,5,74,21,
+196,78,237,251,58,251,179,73,251,135,251,130,251,29,30,251,21,251,115,35,
+251,142,79,251,23,103,55,42,251,46,106,109,251,0,71,24,88,7,247,86,77,5,238,
+6,247,174,248,255,170,251,52,174,251,56,168,43,25,251,82,196,194,130,233,
+27,180,247,93,199,155,186,31,203,7,251,109,153,121,141,110,247,101,98,247,
+80,25,96,247,87,102,247,91,133,173,8,247,101,247,9,155,247,64,247,15,27,227,
+251,47,5,247,21,145,176,237,207,26,14,247,83,247,143,10,251,105,250,78,5,
+247,35,106,61,247,15,251,51,247,236,10,246,161,251,3,55,160,31,194,251,136,
+247,63,10,247,83,247,143,10,251,102,250,62,247,32,247,16,5,247,45,7,251,70,
+251,48,5,232,95,66,207,251,10,247,236,10,239,165,41,58,159,31,251,132,251,
+102,5,251,54,7,247,162,247,132,168,251,20,247,63,10,74,140,10,14,74,140,10,
+134,28,4,249,41,10,174,250,248,205,21,243,7,108,86,35,113,110,248,97,10,251,
+154,6,49,252,111,114,127,106,129,106,131,25,191,247,139,5,251,42,6,86,251,
+162,57,143,139,180,155,221,25,223,248,62,5,251,23,248,54,10,251,29,113,247,
+12,47,247,44,27,151,162,141,141,163,31,100,251,82,5,247,42,6,182,247,109,
+174,147,172,149,161,149,25,86,251,162,5,69,124,211,51,247,31,27,247,3,233,
+170,199,231,31,14,74,176,29,127,78,200,65,247,1,121,25,106,106,78,71,123,
+106,171,82,106,26,108,70,247,19,10,152,163,194,154,166,30,221,149,212,167,
+213,187,8,14,74,248,17,251,207,21,247,195,201,247,123,151,241,27,247,54,6,
+136,235,36,150,117,141,120,152,148,189,25,247,53,249,207,229,29,93,251,125,
+248,161,29,60,252,47,5,14,250,49,28,7,222,205,21,243,7,108,88,32,113,111,
+248,97,10,251,165,6,70,252,12,5,114,84,117,132,115,27,71,147,180,225,156,
+31,200,247,198,5,251,34,6,252,48,71,62,247,117,251,25,247,95,32,247,24,25,
+247,40,29,248,82,247,15,248,34,247,123,232,124,234,113,230,31,247,120,124,
+104,251,67,5,251,45,108,229,63,247,59,27,194,189,152,162,202,31,67,252,3,
+248,30,10,28,251,18,248,168,126,29,247,198,41,29,14,185,28,4,170,250,31,21,
+231,252,119,47,7,225,133,159,137,141,125,129,124,25,251,132,251,176,39,247,
+176,5,158,133,147,151,157,27,139,182,143,197,141,30,231,252,148,47,7,186,
+137,184,135,139,26,155,154,127,120,147,31,247,66,252,103,78,251,166,134,123,
+129,126,117,137,25,139,90,137,85,135,30,47,248,152,231,7,84,143,100,141,139,
+26,115,141,134,150,144,157,200,247,175,24,248,37,248,94,5,160,158,147,147,
+160,27,14,247,198,41,29,251,201,247,158,42,10,247,198,41,29,251,77,247,158,
+44,29,247,198,41,29,251,14,248,226,36,10,247,198,41,29,251,30,248,139,80,
+29,247,198,41,29,252,5,248,111,47,29,247,198,41,29,251,197,248,222,37,10,
+247,198,41,29,253,112,28,249,206,65,29,247,198,247,180,10,37,251,27,5,251,
+227,6,97,247,25,247,94,29,186,251,33,24,251,13,251,3,247,51,6,247,36,252,
+64,247,49,29,247,216,248,48,5,247,87,247,3,251,0,6,247,1,247,31,248,140,10,
+253,85,251,167,21,247,108,6,251,44,251,93,5,14,247,198,213,10,247,86,252,
+218,24,251,230,6,115,251,17,5,248,27,6,61,252,23,247,98,10,217,248,25,24,
+248,13,6,163,247,17,5,251,221,6,248,92,248,216,248,140,10,14,247,198,28,6,
+6,248,68,10,241,252,189,37,7,247,13,131,170,137,141,120,131,129,25,251,220,
+252,72,251,19,248,70,5,247,35,98,251,62,172,43,27,251,44,251,97,90,251,79,
+78,189,53,223,196,168,149,190,198,31,90,247,38,5,172,165,160,151,184,27,157,
+160,123,110,149,31,247,89,253,52,57,252,50,133,248,45,10,84,132,30,37,248,
+254,241,7,82,146,78,143,139,26,112,141,125,143,143,163,227,248,68,24,247,
+23,247,60,247,136,247,224,247,6,247,54,145,147,156,154,153,141,8,14,247,170,
+28,5,53,28,4,227,21,247,11,158,159,243,5,252,79,6,119,35,247,13,130,158,138,
+135,111,125,119,25,251,250,252,150,251,62,248,148,134,155,142,171,162,141,
+25,247,0,149,159,243,5,252,206,6,119,35,247,17,120,247,184,253,212,134,133,
+5,159,81,84,152,91,27,251,123,33,251,22,251,20,114,31,251,11,117,196,37,247,
+43,27,247,25,247,2,237,247,78,247,33,31,180,120,179,117,176,117,215,247,3,
+24,102,160,101,160,100,158,8,252,62,251,141,21,83,108,185,191,149,31,202,
+151,192,191,245,27,174,183,130,125,185,31,251,38,33,89,95,76,27,14,248,38,
+64,29,14,248,38,64,29,247,27,248,174,59,10,248,38,64,29,43,248,243,77,10,
+248,38,64,29,251,7,248,144,80,29,248,38,64,29,251,3,248,118,41,10,247,183,
+100,29,247,183,102,10,34,248,115,41,10,247,203,249,71,247,91,21,204,247,224,
+190,152,188,156,179,156,25,248,75,10,5,35,248,240,243,7,247,53,29,247,8,149,
+5,248,6,10,98,116,88,120,89,126,25,216,248,27,5,251,42,6,56,252,50,65,140,
+89,170,166,247,22,25,247,37,29,161,165,141,142,168,31,79,251,192,5,14,247,
+183,247,149,29,98,79,251,37,102,197,29,5,35,233,7,247,62,247,37,251,7,251,
+197,80,31,247,41,6,244,248,160,247,53,29,14,247,183,134,29,37,252,160,5,247,
+41,6,199,247,188,247,94,247,11,244,144,8,247,82,243,6,247,53,29,14,248,13,
+28,6,25,248,14,29,253,8,35,7,182,129,151,136,149,119,124,116,25,251,32,251,
+101,251,7,251,56,34,251,29,131,163,138,173,149,187,218,248,40,24,143,166,
+164,153,164,144,225,149,24,243,252,208,248,119,29,52,252,77,109,251,45,195,
+51,238,98,25,251,53,251,73,251,52,251,29,251,115,251,57,55,252,64,24,248,
+69,29,248,143,247,42,10,28,251,83,28,251,139,21,245,235,245,241,247,18,247,
+39,8,168,6,234,247,42,176,185,246,31,54,252,64,5,247,94,250,142,21,57,252,
+49,5,92,51,251,5,110,73,27,239,247,21,247,6,247,51,247,27,247,93,8,14,249,
+15,28,4,128,22,177,90,7,92,77,165,160,126,31,124,163,131,183,227,26,247,50,
+7,248,44,155,247,70,247,18,247,208,26,247,85,7,247,70,174,206,247,17,30,164,
+49,7,251,78,70,92,251,208,252,14,46,47,251,200,126,31,249,23,7,220,149,189,
+154,162,30,172,166,179,155,192,27,188,175,252,217,103,188,6,186,189,120,107,
+164,31,161,115,139,104,46,26,253,23,7,251,199,153,47,231,248,13,26,247,208,
+70,186,251,78,30,49,114,6,247,17,174,72,251,70,31,251,85,7,251,207,247,69,
+251,18,248,43,122,30,251,50,7,55,131,88,123,120,30,104,112,102,125,83,27,
+90,101,6,14,247,116,248,142,248,48,21,50,86,178,247,15,31,207,161,220,200,
+26,247,39,38,180,251,9,30,56,51,6,182,160,114,90,31,68,99,251,0,50,26,251,
+55,247,36,47,247,122,30,111,251,44,136,121,122,125,121,138,25,251,5,131,5,
+45,248,143,233,7,63,147,123,141,125,152,142,157,25,167,247,44,5,247,221,247,
+16,247,14,247,104,179,31,165,247,34,5,220,154,172,179,194,27,227,90,7,251,
+29,251,35,84,251,104,99,31,251,121,96,67,75,251,7,27,224,248,86,143,160,157,
+149,157,141,25,234,147,5,235,7,252,143,138,5,44,7,233,131,155,138,152,128,
+135,118,25,14,252,70,249,152,28,5,82,21,251,37,207,104,63,5,131,131,130,139,
+127,121,65,192,49,27,251,17,33,43,61,104,163,82,196,184,189,173,154,147,31,
+61,217,5,155,151,193,157,157,27,170,165,123,114,186,31,223,158,252,76,252,
+105,247,27,71,188,219,5,145,146,149,139,149,157,213,88,231,27,247,15,246,
+235,217,172,114,196,82,96,90,104,127,128,31,217,61,5,121,129,86,122,118,27,
+109,112,156,161,92,31,55,123,5,14,56,49,10,248,238,28,4,183,34,29,56,49,10,
+248,235,250,64,44,29,56,49,10,248,51,28,4,125,47,29,56,49,10,248,36,251,255,
+95,10,56,49,10,247,26,252,148,65,29,74,28,4,137,251,207,21,212,82,178,82,
+152,30,251,52,251,64,5,75,96,192,210,154,31,233,248,126,248,36,29,249,56,
+249,155,155,10,121,45,106,251,46,106,26,251,6,241,67,247,87,247,21,231,188,
+244,30,14,252,60,249,250,248,232,21,183,102,162,102,147,30,35,36,5,97,111,
+171,181,149,31,200,247,186,41,118,5,139,102,91,100,96,71,186,139,30,70,123,
+248,75,248,101,207,10,156,214,87,229,27,169,165,145,146,162,31,127,82,118,
+47,119,26,71,205,96,247,19,223,199,168,202,30,14,60,250,144,250,87,21,155,
+10,129,84,112,251,7,139,26,251,5,113,116,107,74,27,251,36,247,29,5,68,122,
+59,84,59,26,61,194,80,247,29,247,179,180,247,1,247,78,176,30,223,248,62,248,
+36,29,5,14,56,248,209,114,21,247,44,10,247,125,247,159,5,247,118,247,13,251,
+13,6,247,230,248,23,219,10,251,97,251,127,5,251,161,251,13,247,56,6,252,2,
+252,58,247,203,10,14,56,250,144,250,87,21,219,10,251,74,251,103,5,153,98,
+102,150,104,27,251,31,43,251,7,248,78,29,162,161,135,135,162,31,252,7,252,
+62,247,203,10,247,44,10,247,70,247,97,5,125,178,176,129,174,248,150,29,251,
+3,6,83,123,90,96,96,27,116,119,141,146,116,31,247,121,226,36,10,56,250,144,
+250,87,181,10,27,165,170,121,139,31,92,251,0,112,251,7,119,32,8,247,27,6,
+162,242,167,241,174,227,8,115,184,213,130,188,27,247,58,247,33,247,11,247,
+46,247,6,251,6,183,92,251,46,251,17,65,251,54,39,31,71,157,5,248,101,187,
+21,50,65,96,72,118,90,146,161,84,30,225,194,211,213,212,27,172,172,114,107,
+31,14,252,72,249,158,28,5,83,21,207,10,27,156,159,128,139,31,109,74,121,70,
+126,75,8,227,6,154,201,157,200,162,192,8,124,168,187,134,171,27,247,0,231,
+210,232,207,65,166,108,39,58,94,42,74,31,95,150,5,247,194,168,21,85,91,113,
+95,126,107,144,152,103,30,190,175,185,184,187,27,160,161,124,120,31,14,56,
+156,10,195,190,157,165,187,31,144,124,145,120,117,26,70,95,38,43,50,30,243,
+6,247,52,247,12,204,247,55,237,26,207,125,203,114,172,30,251,42,104,5,108,
+121,86,107,94,27,92,110,161,178,65,31,251,21,112,5,14,56,156,10,151,151,140,
+140,151,31,95,91,88,82,128,247,12,29,179,220,163,185,30,244,195,212,238,227,
+26,195,100,235,51,71,63,81,119,125,30,247,193,29,14,56,250,144,250,87,21,
+201,29,192,240,5,247,84,241,252,126,247,111,27,247,30,204,233,210,195,93,
+190,101,31,251,39,251,13,66,247,86,117,247,14,251,10,239,25,195,72,79,148,
+91,27,14,251,159,237,252,145,21,247,197,247,7,247,157,247,66,247,105,26,189,
+111,247,19,251,125,114,116,138,137,117,30,248,41,248,74,5,247,29,7,102,62,
+56,113,73,27,251,16,123,247,9,193,247,50,240,247,0,217,149,31,247,45,251,
+97,5,212,220,175,242,242,251,7,213,251,63,251,97,251,147,251,40,251,181,251,
+56,228,55,247,82,129,31,252,30,252,66,137,251,37,5,158,216,184,166,247,24,
+27,226,197,99,74,251,7,251,22,52,251,62,63,31,14,58,250,189,250,123,21,253,
+222,6,74,251,174,5,247,49,6,195,247,52,5,145,141,157,147,156,27,247,209,6,
+253,119,253,185,118,53,5,250,25,6,209,247,211,5,251,50,6,78,251,86,5,131,
+137,122,133,123,27,252,19,6,249,125,249,182,5,14,247,40,62,10,251,24,248,
+159,34,29,247,40,62,10,251,27,247,148,44,29,247,40,62,10,251,211,248,101,
+47,29,247,40,62,10,252,52,28,250,89,95,10,247,40,62,10,253,62,28,249,196,
+65,29,247,40,250,152,249,37,21,247,23,251,38,7,248,40,248,120,247,137,29,
+252,17,252,95,5,251,173,251,23,247,65,6,252,98,252,193,247,135,29,248,77,
+248,166,5,14,247,40,247,45,29,250,88,6,147,129,142,117,117,26,45,60,251,10,
+92,79,30,240,6,229,210,247,34,247,44,247,28,26,189,122,170,127,152,30,253,
+158,6,250,78,28,4,121,5,14,247,40,247,45,29,249,50,6,248,74,29,245,248,183,
+5,253,189,6,250,78,28,4,121,5,14,247,40,28,5,6,248,68,10,247,137,29,254,70,
+254,250,114,251,13,5,235,6,247,217,247,71,252,109,247,216,27,203,247,31,248,
+0,10,51,251,185,248,38,199,251,0,31,14,132,250,184,250,188,21,57,251,126,
+38,128,251,44,27,251,28,109,224,227,154,31,247,1,158,216,179,186,27,185,175,
+125,91,163,31,138,251,13,5,247,50,6,182,247,132,5,171,52,53,164,251,1,27,
+251,95,251,91,251,6,251,81,106,31,251,52,111,209,251,24,247,158,27,185,187,
+143,146,184,31,252,186,252,183,116,251,22,5,222,247,81,247,110,212,247,21,
+27,247,2,162,101,88,130,31,127,73,52,61,251,1,90,113,251,39,24,247,146,224,
+247,142,247,26,169,247,63,8,237,156,78,244,251,109,27,69,77,131,127,85,31,
+248,132,248,122,5,14,223,194,29,105,91,29,105,91,29,252,40,249,226,28,5,54,
+21,251,13,224,79,63,5,138,135,118,134,133,76,46,201,37,27,251,25,63,45,54,
+98,190,101,186,172,187,162,164,157,31,71,216,5,154,150,148,154,160,176,182,
+111,207,27,167,189,134,140,175,31,252,4,251,192,245,57,202,215,5,200,121,
+211,76,63,26,251,9,251,9,34,45,129,101,134,169,117,30,106,247,8,5,148,115,
+108,148,118,27,84,87,98,85,49,247,8,90,247,48,247,104,247,89,247,11,247,70,
+247,20,45,218,251,39,154,31,14,105,92,10,248,161,250,206,48,29,105,118,29,
+78,76,44,120,31,65,252,16,5,133,104,137,128,123,26,251,7,242,68,247,88,247,
+21,229,190,243,211,82,178,82,151,30,251,50,251,64,5,76,96,195,208,153,31,
+180,247,119,5,99,215,245,116,247,15,27,247,240,10,14,105,166,10,65,114,67,
+96,82,30,231,62,251,9,209,251,42,27,251,55,251,32,59,251,13,251,29,188,251,
+9,247,214,223,219,147,188,213,31,180,251,0,247,35,215,98,235,5,247,39,227,
+238,247,0,247,71,26,247,105,251,36,247,23,251,119,165,30,53,253,70,21,96,
+84,96,110,92,27,102,251,62,170,240,188,194,176,188,237,232,81,51,196,31,14,
+105,207,29,252,74,252,25,229,61,5,182,186,197,176,167,27,205,225,81,82,31,
+251,83,252,240,160,251,226,26,251,41,247,50,251,5,247,88,247,119,247,81,247,
+44,220,201,106,219,59,86,108,114,106,115,30,251,55,7,96,81,70,128,61,27,77,
+78,209,196,31,247,138,248,244,88,248,5,26,247,31,33,190,251,13,30,14,120,
+249,197,247,192,21,252,52,248,135,5,137,174,202,133,217,222,247,0,204,228,
+27,184,156,125,108,156,31,251,41,251,15,5,104,145,199,84,208,27,238,227,239,
+247,1,247,24,38,224,251,79,31,251,47,251,2,36,251,42,27,117,128,147,143,111,
+31,96,247,15,251,119,251,11,248,59,252,168,5,251,172,251,140,251,77,251,184,
+251,156,247,115,251,25,247,144,247,108,247,192,233,247,97,192,100,192,54,
+91,94,121,121,102,31,91,251,79,5,94,79,84,131,77,27,251,42,45,247,53,247,
+39,247,99,247,23,232,247,103,155,31,211,251,13,5,14,225,250,145,249,59,21,
+246,215,194,229,247,33,251,37,198,251,183,31,252,149,252,71,247,219,251,167,
+5,251,145,251,130,251,96,251,122,251,133,247,116,251,6,247,167,247,62,247,
+99,200,247,51,186,108,191,71,106,110,128,128,119,31,72,251,48,5,129,103,98,
+133,98,27,251,9,36,220,247,72,247,76,247,24,247,32,247,168,31,247,0,247,3,
+251,254,247,194,247,193,247,141,5,191,221,134,98,177,31,65,251,39,5,123,160,
+175,130,169,27,14,251,110,249,233,249,153,21,247,65,251,114,217,251,56,251,
+0,69,126,77,251,47,30,93,251,117,5,247,13,6,186,247,8,5,176,179,208,155,174,
+27,218,198,110,251,4,251,40,61,251,35,251,192,251,7,31,115,251,25,220,163,
+222,169,219,174,25,188,113,161,63,65,26,251,54,251,29,251,60,251,243,251,
+24,30,111,251,25,5,248,33,247,15,248,69,247,131,247,147,26,247,22,44,217,
+251,10,173,30,247,66,243,247,19,247,23,247,40,26,14,252,116,251,97,249,77,
+21,201,240,226,173,234,27,211,190,120,71,251,36,251,67,251,43,251,216,52,
+31,34,7,247,8,167,247,23,177,247,12,190,8,193,124,171,106,75,26,251,80,251,
+80,251,21,252,16,54,30,251,2,7,248,2,196,248,111,247,44,247,204,26,242,62,
+210,34,158,30,247,29,224,236,247,0,247,29,26,247,10,251,0,200,251,52,251,
+12,251,40,116,53,251,41,30,14,247,63,120,10,14,247,63,28,5,34,247,200,10,
+254,133,6,251,2,252,209,5,247,40,6,205,247,150,5,161,145,168,172,161,27,248,
+114,6,252,43,251,241,198,72,5,146,145,165,152,204,27,247,24,232,61,251,90,
+101,31,97,251,109,251,2,251,9,251,86,137,43,138,52,172,91,172,148,247,175,
+24,117,154,105,157,98,137,8,66,35,100,251,37,111,31,251,64,106,247,97,251,
+54,247,199,27,247,254,247,182,247,53,247,216,201,31,247,115,181,251,44,247,
+64,251,183,27,248,127,248,55,5,14,43,250,117,250,2,21,247,1,253,208,7,67,
+251,232,5,247,20,6,201,247,49,5,159,146,162,149,152,27,248,36,6,252,141,252,
+82,211,47,5,177,195,145,146,164,27,188,247,78,77,251,42,251,98,251,64,251,
+46,251,42,109,77,145,169,95,31,117,247,76,5,157,119,67,141,120,27,51,82,52,
+70,71,247,3,251,14,247,161,248,3,247,152,247,115,247,137,247,47,251,69,247,
+27,251,102,153,31,14,247,63,120,10,248,186,28,4,249,48,29,247,248,28,5,145,
+247,200,10,254,159,6,81,251,43,248,12,252,241,5,251,239,103,251,213,251,119,
+251,225,26,251,145,247,86,251,130,248,6,248,12,247,107,247,76,247,57,209,
+84,201,60,116,38,128,113,103,30,56,251,140,5,98,68,56,131,102,27,251,43,38,
+247,66,247,74,247,166,247,167,247,71,247,49,170,143,129,86,189,31,247,2,247,
+21,252,26,248,244,5,248,166,6,155,159,125,112,140,31,133,251,111,5,247,52,
+6,14,226,250,176,247,136,21,154,216,71,216,251,8,136,251,69,251,158,24,127,
+92,96,134,86,27,251,48,48,247,22,247,39,167,31,247,35,166,247,18,247,7,247,
+128,27,247,19,247,14,251,230,247,194,247,143,247,92,5,170,245,127,116,174,
+31,101,251,94,5,132,152,190,128,168,27,209,236,195,247,3,160,31,247,48,169,
+251,132,207,251,130,27,252,185,252,42,247,191,251,155,5,251,131,251,74,251,
+80,251,75,105,31,251,172,85,247,161,251,12,247,161,27,247,174,247,119,247,
+43,247,18,163,31,14,194,250,229,250,211,21,247,112,251,89,239,251,102,251,
+33,251,61,123,53,251,93,30,81,251,191,5,247,48,6,215,247,88,5,189,234,199,
+160,247,5,27,210,231,91,251,48,251,127,251,132,251,40,251,170,58,31,110,251,
+32,247,8,172,246,175,236,179,25,201,122,196,59,251,25,26,251,148,251,227,
+251,71,252,4,43,30,113,251,34,5,248,115,235,248,219,247,156,247,232,26,247,
+49,251,7,236,251,38,177,30,247,111,247,11,247,22,247,33,247,56,26,14,172,
+247,126,250,220,21,217,247,45,247,17,186,247,5,27,247,27,192,78,251,16,115,
+31,99,251,96,251,166,251,48,251,246,251,5,8,251,39,7,247,48,189,247,27,187,
+247,8,187,247,23,132,190,47,111,251,35,108,251,50,251,107,251,98,252,114,
+251,29,8,251,30,7,248,113,247,8,248,149,247,135,205,247,231,177,247,86,251,
+14,225,251,64,153,247,81,247,2,240,247,13,171,247,53,8,247,113,181,251,71,
+236,251,117,27,251,42,251,94,90,63,251,24,31,14,33,233,10,49,252,93,133,112,
+112,247,206,29,143,168,25,139,207,247,232,155,225,30,248,109,10,252,86,249,
+136,28,5,160,21,247,25,251,21,194,251,19,38,251,62,104,251,10,104,168,124,
+172,159,162,144,145,157,30,209,243,5,151,159,158,141,163,27,207,161,82,86,
+251,36,251,39,33,251,31,102,31,79,251,166,137,122,121,127,118,137,25,60,135,
+5,75,248,47,203,7,61,143,113,141,126,149,144,158,25,139,184,247,94,149,193,
+30,247,43,165,247,34,247,19,247,40,26,14,251,113,249,224,249,164,21,247,26,
+251,5,245,251,150,251,138,33,251,19,55,55,190,76,209,171,178,165,139,30,240,
+247,99,5,151,153,180,148,166,27,188,161,102,67,251,95,251,0,33,251,93,94,
+31,74,251,222,5,123,136,129,130,123,27,139,65,135,88,137,30,43,248,195,235,
+7,94,141,71,143,139,26,123,133,148,155,143,31,196,247,191,5,247,68,196,247,
+36,236,247,96,26,14,92,250,191,250,220,21,247,68,251,41,247,27,251,153,251,
+168,251,74,251,29,38,74,169,39,229,203,215,177,139,30,237,247,107,5,166,180,
+172,141,149,27,219,188,82,38,251,143,251,62,251,26,251,119,68,31,34,252,158,
+135,116,129,129,112,137,25,251,31,128,5,35,248,253,243,7,251,7,150,112,141,
+133,147,143,164,25,235,248,119,5,247,109,229,247,85,245,247,159,26,14,33,
+233,10,118,38,5,251,119,251,21,247,95,6,102,251,119,133,112,112,248,77,10,
+251,12,146,98,141,122,159,143,168,25,176,247,119,5,247,126,247,21,251,99,
+6,151,209,5,248,109,10,33,247,89,10,55,252,62,247,135,10,229,248,93,247,41,
+10,252,76,161,10,252,86,161,10,33,247,89,10,125,69,5,251,129,251,21,247,105,
+6,93,251,119,247,135,10,184,247,119,5,247,121,247,21,251,96,6,159,240,247,
+41,10,33,250,7,248,91,21,247,60,251,15,247,27,251,54,174,30,223,248,53,247,
+136,10,50,252,84,5,247,36,92,247,29,251,19,251,52,26,251,62,251,68,251,146,
+251,48,248,130,29,108,248,98,29,247,172,247,163,247,71,247,193,31,14,33,250,
+7,248,91,21,247,60,251,17,247,27,251,52,174,30,151,208,5,247,132,247,21,251,
+105,6,184,247,111,247,136,10,93,251,111,5,251,123,251,21,247,99,6,118,39,
+5,247,38,92,247,27,251,19,251,52,26,251,62,251,66,251,146,251,50,248,130,
+29,110,248,98,29,247,170,247,165,247,71,247,193,31,14,76,249,33,28,5,127,
+21,248,162,29,195,163,166,149,144,145,31,248,130,10,251,12,251,39,106,66,
+84,31,65,84,145,251,51,53,69,8,251,22,33,251,64,100,251,79,26,251,87,248,
+100,10,202,81,179,82,121,124,139,134,112,30,251,37,251,142,5,251,17,41,197,
+247,29,237,247,38,151,212,196,31,209,193,137,247,70,225,203,8,247,26,239,
+247,61,226,247,64,26,247,92,251,93,229,251,89,30,14,247,118,249,52,250,71,
+21,251,39,251,133,251,69,251,29,34,247,32,251,65,247,61,251,31,31,50,251,
+12,251,11,78,104,43,189,247,69,32,27,61,96,99,78,47,231,66,244,231,247,55,
+221,247,3,247,47,31,251,4,247,41,247,52,56,235,27,247,40,200,247,4,199,195,
+110,179,59,31,251,16,212,251,39,38,27,98,40,208,228,36,31,247,57,247,28,247,
+26,247,30,244,26,247,29,251,134,247,69,251,39,30,14,251,82,248,97,28,5,65,
+21,38,251,58,38,61,79,236,40,247,8,60,31,88,56,58,104,115,73,173,240,66,27,
+85,110,116,104,87,202,97,211,202,247,4,186,202,245,31,75,241,247,2,92,205,
+27,241,180,203,173,171,119,162,84,31,54,189,55,70,27,111,71,178,190,69,31,
+247,5,217,230,218,199,26,217,251,57,240,38,30,14,249,41,28,6,119,243,21,251,
+2,48,180,204,76,31,182,225,163,239,226,26,247,21,78,184,71,75,75,90,251,17,
+46,154,35,184,54,30,96,94,85,113,78,27,72,79,167,187,97,31,183,223,167,239,
+230,26,247,21,76,184,75,71,74,84,251,11,46,155,35,174,54,30,96,94,86,113,
+89,27,76,81,173,191,93,31,187,223,163,237,222,26,247,4,84,201,66,66,80,80,
+251,14,55,159,41,178,53,30,78,76,52,96,33,27,153,251,2,5,247,17,236,190,211,
+211,31,65,194,213,88,234,27,228,217,182,205,200,31,73,192,215,96,244,27,233,
+219,186,211,201,31,67,205,239,92,247,36,27,251,171,248,86,21,89,129,91,122,
+99,30,119,182,130,186,187,26,223,154,158,153,153,152,120,55,30,252,90,138,
+21,90,128,94,119,98,30,125,180,130,184,188,26,217,148,165,157,158,147,111,
+63,30,252,90,133,21,98,130,96,121,98,30,121,178,130,182,182,26,210,152,178,
+156,156,146,103,65,30,14,75,248,80,247,25,21,248,152,251,25,253,29,248,133,
+7,247,11,187,186,247,11,31,249,129,251,25,253,102,7,99,119,119,99,30,251,
+98,247,10,21,247,25,6,138,248,133,5,247,11,93,187,251,11,30,252,134,254,39,
+247,25,249,162,247,230,6,179,159,119,99,31,14,248,104,250,213,247,115,21,
+91,58,61,108,53,27,251,142,57,247,34,247,104,135,31,164,199,184,157,142,147,
+215,251,67,145,27,145,247,195,247,26,139,31,220,251,26,5,247,141,220,247,
+87,247,88,247,147,26,247,65,251,20,247,7,251,165,149,30,251,91,146,251,57,
+141,251,24,142,8,146,181,144,181,180,26,247,37,36,174,251,4,251,106,251,10,
+251,7,251,80,251,13,216,73,247,101,111,30,109,42,107,37,121,35,130,90,131,
+90,134,91,66,104,79,109,117,128,184,35,24,151,143,177,154,188,159,8,138,129,
+140,129,129,26,251,126,222,251,70,247,203,247,86,247,70,240,247,4,198,30,
+252,206,248,247,21,150,201,158,205,158,206,8,138,177,180,138,183,27,248,170,
+247,5,77,251,12,54,57,251,6,115,124,73,247,33,139,31,251,178,251,33,5,112,
+177,67,247,43,136,26,138,137,251,17,79,251,33,71,144,181,146,183,147,185,
+8,251,108,248,162,21,178,156,173,190,177,173,124,86,106,135,106,134,105,30,
+46,152,101,171,189,26,14,249,116,104,22,247,168,6,247,18,249,100,247,108,
+248,95,248,6,194,251,119,254,242,24,247,135,247,7,247,40,250,125,5,247,123,
+95,238,251,116,251,255,26,251,63,117,251,94,99,251,120,30,247,167,6,169,247,
+61,153,247,48,247,33,26,248,177,251,102,247,219,251,248,175,30,164,247,60,
+251,49,93,114,251,16,252,97,81,252,49,252,141,251,34,253,185,25,14,251,184,
+249,29,247,17,21,247,41,68,247,21,251,103,251,218,251,27,251,227,251,142,
+251,58,223,251,5,248,120,10,251,90,161,21,251,127,251,19,251,189,251,11,124,
+55,153,247,62,247,126,247,11,247,189,247,19,174,203,94,251,30,30,14,251,184,
+250,29,28,5,70,21,247,39,65,247,23,251,102,251,216,251,29,251,228,251,142,
+251,60,225,251,2,248,120,10,251,92,159,21,251,127,251,17,251,187,251,13,126,
+53,151,247,64,247,123,247,11,247,189,247,21,172,203,96,251,31,30,14,251,184,
+248,138,248,39,21,49,6,251,224,55,5,72,7,247,97,163,251,23,253,2,137,131,
+128,131,127,136,25,251,27,131,5,72,248,109,206,7,39,147,124,142,127,145,141,
+149,25,14,251,184,249,21,247,109,21,247,19,37,198,251,64,251,103,251,38,68,
+251,7,98,180,104,199,198,248,107,10,156,176,27,180,206,112,43,251,66,251,
+74,251,25,252,23,251,140,31,120,51,5,249,75,6,182,247,109,5,36,6,94,36,248,
+144,29,247,97,247,121,26,14,247,5,28,4,170,249,60,21,251,117,6,241,239,207,
+244,161,247,8,8,247,138,188,251,68,247,44,251,152,27,251,70,251,226,77,251,
+150,88,31,49,121,182,78,239,27,202,221,178,139,31,195,247,168,5,153,188,155,
+144,194,27,247,46,215,251,9,251,54,106,31,119,33,73,36,53,45,8,252,160,6,
+112,251,23,5,248,54,6,251,87,251,60,251,123,251,25,32,61,105,251,62,24,250,
+148,6,218,248,37,248,170,29,68,251,72,5,252,220,6,247,89,247,7,247,70,245,
+247,33,246,8,247,248,6,14,249,149,28,6,192,114,10,251,2,249,133,248,55,10,
+248,106,28,4,130,206,10,14,251,184,249,15,247,119,21,246,55,208,251,78,251,
+83,251,48,72,43,94,193,100,176,169,184,159,145,160,30,157,247,9,5,147,156,
+173,162,187,27,155,227,118,41,251,9,251,9,68,251,54,147,31,123,42,5,152,215,
+161,141,164,27,155,244,131,251,7,251,19,251,9,55,47,110,100,155,146,127,31,
+121,243,5,145,120,119,160,98,27,69,104,75,115,81,215,55,247,83,247,154,247,
+60,247,46,247,41,229,75,187,251,7,159,31,247,54,190,211,231,223,26,14,251,
+184,248,252,39,21,251,12,6,245,248,139,5,251,41,6,252,179,252,148,120,51,
+5,248,40,6,77,251,168,5,247,75,6,196,247,168,5,247,17,6,251,121,247,236,21,
+85,251,139,5,251,103,6,14,251,184,249,254,250,248,21,251,12,6,245,248,140,
+5,251,41,6,252,179,252,148,121,51,5,248,39,6,78,251,168,5,247,74,6,196,247,
+168,5,247,15,6,251,119,247,236,21,85,251,140,5,251,103,6,14,247,28,146,29,
+14,247,28,146,29,248,40,253,106,247,46,10,247,28,148,10,14,247,28,148,10,
+248,44,253,129,247,46,10,251,184,249,31,248,21,21,252,178,6,46,252,50,5,141,
+172,242,150,177,27,217,247,7,116,251,17,251,15,251,9,41,41,121,95,149,141,
+127,31,104,244,5,143,119,123,153,114,27,73,94,92,94,73,217,86,247,64,247,
+154,247,73,247,50,247,64,247,35,251,17,197,251,46,98,102,135,134,111,248,
+169,29,251,184,250,17,28,6,72,21,252,179,6,45,252,50,5,143,172,243,149,176,
+27,219,247,7,117,251,17,251,17,251,9,43,39,122,94,147,143,129,31,102,243,
+5,141,121,122,156,113,27,75,92,90,96,71,217,88,247,66,247,154,247,72,247,
+50,247,62,247,37,251,17,194,251,45,96,104,137,133,110,248,169,29,247,135,
+248,200,28,4,177,21,155,142,159,166,170,27,248,86,6,158,152,121,118,138,31,
+136,251,82,5,247,42,6,200,247,251,5,254,222,6,116,251,14,247,5,131,169,135,
+150,116,135,123,25,57,252,63,5,247,218,247,149,251,15,251,118,251,79,251,
+43,251,30,251,88,57,52,176,170,110,31,102,247,69,5,141,131,103,147,116,27,
+60,50,80,33,251,14,247,74,38,247,126,248,36,247,183,247,76,247,215,247,219,
+251,254,247,9,251,144,162,31,14,251,72,249,177,249,118,21,187,247,141,5,253,
+133,6,119,251,3,229,133,157,136,145,123,136,127,25,80,251,175,5,247,118,247,
+22,251,12,251,24,251,36,65,57,37,108,99,162,161,121,31,111,247,78,5,145,128,
+112,142,124,27,49,70,82,43,251,10,247,43,68,247,37,247,118,247,159,242,247,
+152,247,87,251,97,247,17,251,107,156,31,174,247,55,5,151,142,153,158,157,
+27,247,137,6,152,145,126,124,138,31,135,35,5,14,251,184,248,252,33,82,10,
+251,184,249,254,250,242,21,247,25,45,231,251,70,72,83,127,121,90,30,201,247,
+35,247,47,247,3,247,103,159,137,219,24,252,78,98,251,134,251,175,251,184,
+26,251,114,247,44,74,247,51,247,130,247,45,247,64,247,74,30,251,88,108,21,
+251,33,251,5,251,0,66,251,11,137,247,12,217,197,159,223,145,157,30,188,211,
+188,147,168,27,213,196,84,251,3,31,14,143,248,121,227,21,251,25,79,247,74,
+247,209,204,31,198,247,180,247,0,247,230,248,34,247,61,137,247,19,24,252,
+46,251,8,251,238,252,29,63,252,8,8,252,44,56,247,57,251,137,247,175,27,247,
+148,247,152,247,97,247,171,196,31,182,247,104,40,247,131,251,172,182,127,
+115,106,44,128,125,247,10,95,168,251,64,104,251,64,8,251,96,97,52,251,32,
+251,24,27,14,247,91,250,26,248,58,21,251,66,106,251,1,251,48,251,58,27,251,
+83,69,247,132,247,117,179,31,183,247,141,247,12,247,200,248,77,247,58,143,
+247,19,24,252,193,251,12,251,160,251,229,68,252,8,8,252,4,69,247,109,251,
+135,247,209,27,247,245,247,134,247,105,247,161,190,31,179,247,104,39,247,
+80,251,205,203,125,115,107,44,127,125,247,40,78,161,251,17,106,251,64,8,14,
+251,184,249,113,248,21,247,213,29,253,139,5,247,84,6,148,173,248,242,249,
+157,5,14,251,184,250,97,28,6,72,247,213,29,253,140,5,247,84,6,147,174,248,
+243,249,156,5,14,251,184,249,11,247,119,21,231,248,154,29,251,21,92,158,82,
+227,94,30,251,60,67,83,39,61,248,117,29,247,27,247,38,235,47,192,67,168,30,
+247,1,184,227,196,247,19,26,251,74,127,21,61,93,80,72,100,30,53,174,86,178,
+198,26,235,225,205,204,213,166,90,69,30,89,252,64,21,47,45,63,59,35,98,205,
+221,218,192,199,211,182,30,241,94,231,90,71,26,14,251,184,250,5,28,5,170,
+21,233,248,154,29,251,23,92,155,82,227,94,30,251,59,69,85,37,63,248,117,29,
+247,25,247,39,236,47,190,67,170,30,246,184,229,196,247,17,26,251,77,129,21,
+59,96,82,70,98,30,53,175,85,178,199,26,235,227,202,205,213,163,92,70,30,92,
+252,66,21,49,43,63,59,35,98,204,219,221,192,198,213,180,30,241,96,231,88,
+72,26,14,251,184,249,33,247,35,21,247,118,251,66,173,251,17,251,144,251,51,
+251,55,251,77,251,45,247,17,71,247,37,188,194,151,154,189,30,251,17,251,60,
+251,38,67,251,72,76,176,65,24,247,236,237,247,248,247,97,247,248,26,251,88,
+22,88,122,88,129,88,30,126,127,79,82,53,27,105,44,176,247,17,247,33,246,247,
+3,221,167,236,112,251,56,31,14,251,184,250,35,28,5,88,157,10,247,91,248,76,
+250,46,21,247,66,173,247,9,247,78,247,69,27,247,89,193,251,132,251,117,99,
+31,95,251,141,251,52,251,200,252,77,251,58,135,251,19,24,248,193,247,12,247,
+200,247,229,210,248,8,8,248,4,210,251,74,247,135,251,235,27,252,2,251,140,
+251,135,251,161,87,31,88,251,160,247,71,251,121,248,66,247,33,153,163,181,
+242,150,153,251,182,89,66,247,12,171,247,64,8,14,56,249,2,250,36,21,247,32,
+187,251,54,251,209,75,31,80,251,180,251,26,251,214,252,32,251,61,140,251,
+19,24,248,47,247,8,248,6,248,13,214,248,8,8,248,44,222,251,36,247,117,251,
+191,27,251,174,251,145,251,137,251,171,82,31,82,251,172,247,45,251,136,247,
+249,247,27,153,163,171,234,150,153,251,107,92,90,247,50,174,247,64,8,247,
+96,180,224,247,72,247,45,27,14,252,47,248,133,28,5,52,21,230,170,42,251,82,
+98,31,101,251,65,51,251,85,251,149,37,140,63,24,247,159,209,247,132,247,118,
+188,247,115,8,247,137,193,45,247,27,251,86,27,251,75,251,57,251,39,251,59,
+102,31,102,251,60,239,251,39,247,124,220,148,154,160,196,146,147,251,32,111,
+107,234,162,242,8,247,14,166,194,247,0,238,27,14,249,149,247,54,10,247,146,
+83,10,14,250,117,28,5,70,28,5,143,21,251,42,6,254,250,28,250,113,5,247,42,
+6,247,216,83,10,28,6,118,251,26,206,10,252,182,247,152,247,31,29,14,249,149,
+247,54,10,247,146,83,10,28,5,15,247,21,72,29,249,149,247,54,10,247,146,83,
+10,28,4,123,251,250,82,10,249,149,28,5,217,28,5,143,21,251,42,247,225,29,
+247,174,83,10,28,5,60,247,31,247,80,10,14,249,149,28,6,15,28,5,143,21,251,
+42,247,225,29,247,174,83,10,28,4,208,251,1,157,10,249,149,28,6,123,28,5,143,
+135,10,250,100,252,60,72,29,249,149,28,6,87,28,5,143,248,56,29,248,30,110,
+10,250,98,252,83,72,29,249,149,247,54,10,248,6,250,52,247,60,10,251,125,248,
+70,21,71,251,226,5,251,172,6,28,6,85,38,72,29,249,149,247,54,10,248,72,167,
+29,249,212,254,56,82,10,252,176,248,215,232,10,252,220,248,202,28,6,6,21,
+199,114,166,74,72,75,92,70,30,109,252,108,5,211,6,201,247,63,247,9,247,222,
+139,26,251,23,253,57,21,194,95,187,75,82,94,95,85,86,182,92,197,197,190,180,
+193,30,14,253,17,247,137,190,247,18,29,253,17,248,121,28,5,16,247,18,29,247,
+101,28,4,190,239,10,251,210,250,253,247,0,10,14,252,121,249,51,28,6,36,21,
+213,90,200,43,251,7,64,49,47,120,30,122,253,148,5,223,6,247,175,249,148,5,
+141,155,141,153,156,26,14,252,121,248,242,248,68,10,213,100,200,43,251,7,
+74,49,47,120,30,129,253,48,5,223,6,247,148,249,48,5,141,155,141,153,156,26,
+14,252,74,249,10,28,5,74,247,27,10,252,175,248,146,249,128,247,77,29,40,252,
+139,247,211,10,252,160,247,7,10,252,200,28,4,240,247,47,29,252,162,234,10,
+252,162,234,10,251,110,28,5,235,247,5,10,252,160,247,10,10,78,250,146,28,
+5,25,21,212,86,184,67,251,50,59,251,60,251,31,251,47,247,9,251,26,247,38,
+96,30,190,217,5,51,172,75,227,231,26,170,145,168,146,167,30,247,14,6,176,
+176,168,188,195,26,252,99,147,21,210,86,178,71,251,51,59,251,49,251,34,251,
+49,247,2,251,30,247,44,96,30,188,215,5,55,190,71,201,245,26,164,141,174,150,
+161,30,247,15,6,180,170,163,209,188,26,14,80,153,10,252,225,248,193,250,140,
+21,252,66,6,184,252,23,5,247,78,6,137,253,9,21,92,248,21,5,251,76,6,251,91,
+252,21,5,14,252,240,248,179,250,140,21,252,64,6,184,252,23,5,247,76,6,14,
+253,84,206,29,253,84,206,29,253,84,206,29,252,161,248,140,248,137,247,33,
+29,252,161,249,124,28,6,170,247,33,29,252,161,247,237,247,51,247,21,29,252,
+161,248,221,28,5,84,247,21,29,251,79,249,207,252,42,21,218,251,183,28,6,102,
+247,183,216,253,41,28,248,254,7,247,12,28,6,181,21,247,22,28,249,154,251,
+22,6,14,251,79,249,117,252,44,21,28,7,4,253,40,62,247,182,28,249,154,251,
+182,58,7,248,176,28,6,183,21,28,249,154,251,22,28,6,102,7,14,251,181,247,
+92,28,5,120,21,254,224,226,250,137,247,205,226,7,14,252,94,248,28,29,251,
+181,247,92,28,5,120,21,52,247,205,254,137,226,250,224,7,14,252,94,248,28,
+10,251,181,248,236,251,114,21,226,251,205,28,4,213,52,28,250,212,7,14,252,
+94,248,29,29,251,181,248,236,251,114,21,28,5,44,52,28,251,43,251,205,52,7,
+14,252,94,248,29,10,251,51,248,66,239,21,248,236,164,249,40,248,56,248,136,
+30,64,229,5,252,117,252,92,251,31,252,230,253,130,26,254,224,247,142,7,14,
+251,51,248,27,10,251,51,248,66,28,9,196,21,251,142,28,251,80,6,253,130,247,
+31,252,230,248,117,252,92,30,214,229,5,252,56,248,136,114,249,40,248,236,
+26,14,251,51,248,136,254,74,21,247,142,250,224,6,249,130,251,31,248,230,252,
+117,248,92,30,64,49,5,248,56,252,136,164,253,40,252,236,26,14,251,51,247,
+122,29,251,51,248,136,28,5,70,21,252,236,114,253,40,252,56,252,136,30,214,
+49,5,248,117,248,92,247,31,248,230,249,130,26,28,4,176,251,142,7,14,251,51,
+248,66,254,74,21,28,10,160,247,212,247,22,252,206,28,244,222,7,14,251,51,
+248,27,10,251,51,249,130,252,86,21,247,22,251,212,28,11,4,251,142,28,244,
+122,7,14,251,51,249,130,254,74,21,28,11,34,252,206,251,22,247,212,28,245,
+96,7,14,251,51,247,122,29,251,51,249,130,252,86,21,28,11,134,251,142,28,244,
+252,251,212,251,22,7,14,247,53,249,130,249,80,21,249,130,174,247,192,247,
+222,30,219,247,42,49,6,252,126,251,7,252,36,253,130,31,28,249,92,247,142,
+7,14,247,53,248,136,28,7,68,21,253,130,114,251,207,251,222,30,49,251,42,229,
+6,247,222,164,251,207,253,130,31,252,166,247,142,248,206,7,248,202,73,248,
+17,251,135,247,45,30,247,135,247,44,205,248,17,248,203,26,249,160,251,142,
+7,14,247,53,247,122,29,247,53,249,130,28,9,196,21,251,142,28,248,248,6,253,
+130,247,7,252,36,248,126,30,229,247,42,59,6,251,222,104,247,192,249,130,31,
+14,247,53,248,136,254,74,21,247,142,28,6,164,6,249,130,251,7,248,36,252,126,
+30,49,251,42,219,6,247,222,174,251,192,253,130,31,14,247,53,249,130,28,10,
+40,21,251,142,253,160,6,252,203,205,252,17,247,135,251,44,30,251,135,251,
+45,73,252,17,252,202,26,252,206,247,142,248,166,7,249,130,164,247,207,247,
+222,30,229,247,42,49,6,251,222,114,247,207,249,130,31,14,247,53,248,136,249,
+130,21,253,130,104,251,192,251,222,30,59,251,42,229,6,248,126,247,7,248,36,
+249,130,31,28,7,8,251,142,7,14,253,6,247,37,247,241,29,14,251,228,248,71,
+247,241,29,251,27,22,248,41,10,14,251,118,239,248,245,21,249,133,247,26,253,
+133,6,79,252,56,21,249,133,247,26,253,133,6,247,197,254,21,248,17,29,14,105,
+247,121,10,105,247,121,10,105,118,224,21,221,57,247,51,247,50,5,253,69,247,
+67,249,244,7,247,156,247,155,5,254,251,247,67,28,5,22,7,247,133,247,133,57,
+221,251,51,251,51,5,249,72,251,67,253,247,7,251,156,251,155,5,250,254,251,
+67,28,250,231,7,14,250,83,28,4,139,249,254,247,235,29,251,241,252,237,247,
+234,29,249,74,22,248,3,29,14,250,83,28,4,139,247,165,247,234,29,251,241,248,
+237,247,235,29,249,74,22,248,3,10,14,250,83,248,114,247,44,21,221,57,247,
+105,247,105,5,249,245,247,19,253,118,6,247,36,247,35,5,248,230,247,19,252,
+103,6,247,35,247,35,5,247,216,247,19,251,89,6,247,25,247,24,57,221,251,107,
+251,106,5,253,247,251,19,249,120,6,251,35,251,35,5,252,233,251,19,248,106,
+6,251,36,251,35,5,251,218,251,19,247,91,6,14,250,83,28,6,82,22,247,8,29,250,
+83,248,107,29,28,4,164,247,162,21,247,8,29,250,83,249,8,251,4,21,237,83,245,
+247,80,5,126,189,194,132,199,27,249,1,247,5,252,252,6,99,102,143,146,105,
+31,248,147,250,32,5,247,108,247,5,251,45,6,205,247,8,39,192,44,251,61,5,251,
+231,6,252,21,251,74,251,185,251,172,251,95,234,251,101,247,92,39,31,251,61,
+248,148,21,247,154,247,58,247,90,247,172,30,247,162,6,252,126,253,250,5,251,
+37,213,58,247,43,247,77,26,14,250,83,250,175,22,247,5,29,250,83,248,107,29,
+249,1,247,162,21,247,5,29,250,83,248,158,251,4,21,237,83,233,247,60,5,247,
+229,6,248,21,247,74,247,185,247,171,247,94,44,247,101,251,90,240,31,239,247,
+69,39,192,32,251,82,5,153,88,83,146,79,27,253,1,251,5,248,252,6,179,177,135,
+131,174,31,252,147,254,31,5,251,110,251,5,247,47,6,250,31,248,208,21,251,
+155,251,58,251,88,251,172,30,251,160,6,248,125,249,248,5,247,36,64,220,251,
+43,251,75,26,14,253,32,247,163,252,226,21,249,72,34,253,72,7,14,253,32,247,
+163,250,46,21,249,72,34,253,72,7,14,251,5,250,211,247,161,29,86,28,4,213,
+21,251,7,205,254,53,28,249,216,244,69,5,14,252,24,251,235,21,247,15,209,252,
+121,28,6,40,251,25,73,5,14,251,6,250,23,250,111,21,251,16,6,252,254,28,250,
+133,5,247,16,6,247,77,248,55,247,87,252,55,5,247,16,6,251,151,248,192,5,14,
+252,12,225,10,252,12,225,10,252,12,225,10,28,11,228,28,16,47,248,230,21,28,
+239,219,248,91,29,28,16,37,6,14,28,20,25,28,24,100,248,230,21,28,231,166,
+248,91,29,28,24,90,6,14,250,25,28,7,252,248,230,21,28,247,250,248,91,29,28,
+8,6,6,14,252,12,225,10,253,41,247,149,49,248,67,10,253,41,248,153,250,254,
+248,67,10,252,99,251,17,21,252,95,6,116,251,5,5,248,95,6,14,251,110,248,86,
+21,247,13,253,65,251,13,7,14,181,248,86,21,247,13,28,251,65,251,13,7,14,252,
+250,247,209,247,70,10,252,116,247,70,10,252,225,249,7,28,5,115,34,29,52,28,
+5,115,34,29,252,31,249,74,28,5,37,21,174,10,14,252,31,249,74,28,5,37,21,174,
+10,14,164,250,238,28,5,37,21,174,10,252,56,22,248,188,10,251,41,250,238,28,
+5,115,59,10,251,41,250,128,250,30,59,10,247,99,28,5,115,59,10,248,81,137,
+29,14,249,245,137,29,248,56,22,248,188,10,252,141,248,9,247,91,29,252,114,
+247,91,29,251,113,248,226,249,19,42,10,252,225,249,56,250,252,42,10,251,106,
+250,252,42,10,252,31,247,52,28,5,37,21,174,29,14,164,247,52,28,5,37,21,248,
+208,10,70,250,155,249,19,49,29,120,250,252,49,29,248,81,247,52,28,5,37,21,
+174,29,248,56,22,248,208,10,252,196,248,165,251,156,21,251,96,247,185,5,251,
+13,6,251,96,251,185,5,247,14,6,247,34,247,99,247,35,251,99,5,14,252,59,252,
+140,44,29,252,29,248,51,252,140,44,29,49,250,252,44,29,252,67,252,11,21,247,
+56,34,225,251,50,251,96,251,36,251,31,251,87,100,30,247,1,6,242,182,229,202,
+247,5,27,243,211,82,251,1,141,31,247,0,6,146,168,141,166,167,26,14,251,0,
+28,4,188,58,29,46,28,5,16,21,247,54,34,225,251,49,251,97,251,36,251,32,251,
+86,101,30,245,6,243,182,231,203,247,5,27,243,211,81,251,2,141,31,247,1,6,
+143,167,143,168,168,26,251,76,251,64,47,29,252,76,249,148,28,4,188,21,247,
+56,37,247,182,29,244,210,82,251,1,141,31,247,1,6,145,166,141,168,167,26,14,
+250,113,28,6,85,21,247,68,59,251,143,235,252,21,27,252,24,251,184,47,251,
+72,251,47,31,200,71,5,247,25,247,17,247,204,168,247,184,27,247,181,247,206,
+110,251,25,209,31,14,247,164,28,7,101,21,252,144,251,222,41,251,66,251,39,
+31,200,73,5,247,25,247,17,248,9,166,248,27,27,14,247,98,28,6,85,21,247,66,
+59,251,182,237,252,142,27,104,251,70,5,248,25,247,253,112,251,25,212,31,14,
+247,36,28,4,164,248,33,21,247,62,41,251,47,247,3,251,130,27,251,116,251,116,
+50,251,84,251,96,31,234,251,3,5,247,37,247,105,247,65,172,247,23,27,247,58,
+247,14,106,251,37,247,35,31,14,252,9,251,17,162,29,88,28,5,182,61,29,88,28,
+5,182,67,10,251,73,207,47,29,96,28,5,85,21,253,46,6,50,89,56,77,251,5,27,
+33,66,202,227,138,31,32,6,133,111,135,127,110,26,251,54,244,53,247,51,247,
+24,247,0,200,230,208,30,248,241,6,14,252,76,248,144,251,66,21,251,1,6,34,
+96,49,76,251,4,27,34,65,196,247,3,137,31,33,6,133,110,137,111,110,26,251,
+54,241,51,247,52,247,95,247,37,247,31,247,89,178,30,14,248,216,252,76,247,
+10,29,250,199,28,7,75,247,10,29,28,4,109,28,5,248,21,253,118,248,87,5,251,
+133,6,254,41,252,87,5,247,112,6,249,167,247,187,249,47,251,187,5,14,252,29,
+248,201,247,120,10,251,237,247,120,10,121,28,5,199,48,29,210,28,6,29,21,252,
+112,6,47,119,120,55,57,31,251,152,251,226,5,239,6,247,230,247,163,5,248,95,
+6,14,211,28,6,29,21,36,6,251,230,251,163,5,252,92,6,106,251,58,5,248,109,
+6,231,159,158,223,223,31,14,68,28,5,55,21,33,6,65,96,49,92,251,5,27,33,77,
+180,219,127,31,252,190,6,110,251,27,5,248,113,6,50,169,233,76,247,21,27,247,
+95,247,37,247,35,247,36,176,31,14,156,28,5,14,21,252,92,6,251,124,247,163,
+5,39,6,247,19,251,226,5,55,190,151,120,231,27,248,109,6,14,123,250,252,21,
+251,19,247,226,5,223,90,125,158,49,27,252,111,6,106,251,58,5,248,93,6,247,
+123,251,163,5,14,247,20,28,5,246,21,251,21,6,251,152,251,97,251,54,247,54,
+5,163,113,108,168,98,27,106,92,123,100,109,31,251,183,251,247,5,247,19,6,
+247,156,247,97,247,54,251,54,5,113,165,174,114,174,27,166,190,154,177,172,
+31,14,188,250,252,21,251,41,247,247,5,178,123,94,153,112,27,104,92,114,113,
+102,31,251,117,251,54,251,74,247,97,5,251,21,6,247,43,251,246,5,100,155,178,
+122,172,27,180,182,168,163,176,31,247,117,247,54,247,73,251,97,5,14,251,212,
+250,73,147,36,10,251,237,251,66,70,10,251,71,249,18,21,251,3,6,83,123,89,
+96,96,251,12,116,238,251,0,27,251,32,43,251,7,251,33,78,31,247,0,6,194,158,
+188,182,182,247,13,161,41,247,1,248,150,29,14,112,28,5,172,36,10,252,166,
+250,221,21,247,14,247,29,5,120,176,176,122,183,27,247,31,247,9,247,5,247,
+33,200,31,251,3,6,86,123,70,96,96,27,111,114,144,147,116,31,242,247,9,65,
+206,251,15,251,32,5,160,101,100,157,92,27,251,29,251,8,248,122,29,206,182,
+182,27,170,167,133,129,164,31,35,251,8,5,14,250,83,199,10,250,83,199,10,215,
+28,5,167,88,10,251,154,251,145,88,10,252,68,28,4,191,247,235,10,247,152,248,
+29,247,235,10,247,72,69,36,10,28,4,235,28,7,26,21,248,155,29,252,125,251,
+14,247,30,252,160,247,188,29,248,124,247,44,251,30,248,127,248,149,10,14,
+247,129,28,7,6,21,174,251,51,251,53,174,251,157,247,188,29,27,247,145,247,
+54,102,103,247,58,31,14,253,198,28,6,109,21,106,247,47,247,50,107,247,129,
+248,149,10,248,155,29,27,251,134,251,45,173,173,251,47,31,14,251,72,28,7,
+3,21,251,40,104,251,19,65,113,251,31,118,33,229,96,116,251,13,131,94,88,100,
+83,133,118,251,3,24,247,39,174,247,20,213,165,247,29,159,247,0,51,182,163,
+247,13,147,182,190,180,193,145,8,14,252,77,28,5,243,21,251,40,251,172,5,247,
+71,6,56,251,52,5,247,21,6,247,40,247,172,5,251,72,6,223,247,52,5,14,252,78,
+251,174,21,34,181,251,43,251,4,147,118,247,77,137,5,251,40,247,111,21,68,
+224,69,54,197,251,72,5,162,6,247,60,251,60,21,251,44,247,4,120,122,196,251,
+70,247,3,110,5,251,94,247,155,21,251,46,247,5,38,97,201,46,247,78,141,5,165,
+103,21,120,156,251,46,251,4,144,251,4,247,2,168,5,14,252,245,252,227,247,
+37,10,252,227,248,23,247,189,247,37,10,73,28,5,252,21,251,76,6,251,23,251,
+3,53,247,3,5,251,78,6,247,53,251,95,251,131,251,93,5,247,74,6,247,23,247,
+1,229,251,1,5,247,79,6,251,56,247,93,5,14,251,252,251,66,21,69,6,71,113,77,
+100,67,27,88,115,152,192,126,31,74,6,90,108,110,122,82,27,71,92,174,211,137,
+31,70,6,135,120,137,123,121,26,34,210,86,240,196,192,157,182,176,30,92,162,
+192,125,188,27,247,21,233,223,247,19,164,31,14,252,33,251,226,21,246,67,192,
+39,82,85,120,94,102,30,189,117,86,153,90,27,251,21,44,53,251,17,115,31,208,
+6,205,166,198,177,211,27,190,168,129,86,149,31,207,6,186,169,164,155,196,
+27,207,190,107,67,31,209,6,143,155,141,158,155,26,14,252,29,248,191,251,67,
+95,10,251,219,251,67,95,10,252,29,249,238,28,5,85,80,29,96,28,5,85,80,29,
+248,116,252,182,21,28,250,136,248,91,10,28,5,120,6,14,250,75,28,7,3,247,141,
+29,136,251,67,21,28,250,136,248,91,10,28,5,120,6,14,247,254,28,6,94,247,141,
+29,247,203,28,4,246,251,67,21,247,112,29,251,67,4,247,112,29,251,192,251,
+67,21,253,180,248,91,10,249,180,6,112,39,21,253,180,248,91,10,249,180,6,14,
+247,197,28,5,85,21,28,250,138,248,91,10,28,5,120,6,230,248,66,247,141,29,
+60,250,73,250,84,21,253,206,248,91,10,249,208,6,231,248,76,21,253,206,248,
+91,10,249,208,6,14,251,213,249,85,249,185,248,114,29,102,251,81,248,85,29,
+252,187,248,26,157,247,139,29,252,187,249,30,28,4,214,247,139,29,250,83,28,
+6,102,249,117,247,132,29,28,4,204,252,8,247,132,29,249,179,250,92,21,223,
+55,187,57,74,85,112,70,103,30,188,108,170,196,173,139,181,141,25,187,140,
+183,115,99,34,251,26,103,85,26,45,198,221,7,196,247,40,182,245,26,251,33,
+252,46,21,209,66,69,7,14,250,83,28,6,102,249,203,247,132,29,28,4,204,251,
+162,247,132,29,28,4,204,251,162,247,132,29,14,250,6,248,30,248,113,21,251,
+15,248,166,251,247,247,13,247,247,248,166,247,15,252,166,247,246,251,13,251,
+246,7,252,166,249,85,21,251,14,28,4,157,247,14,7,14,252,11,251,207,180,29,
+100,28,5,59,41,10,252,229,251,216,65,29,251,166,28,5,57,47,29,253,140,248,
+28,28,5,59,47,29,252,202,251,154,57,29,251,113,28,5,154,81,10,253,154,248,
+125,28,6,98,81,10,253,231,251,31,249,122,158,29,252,107,248,26,251,226,129,
+29,252,117,251,226,129,29,32,28,5,158,75,10,251,178,251,226,21,247,15,47,
+225,251,13,61,62,105,85,81,30,194,102,75,172,63,27,248,61,29,217,216,173,
+192,197,31,85,177,203,106,214,27,247,53,247,46,247,35,247,56,31,247,190,10,
+252,26,22,247,251,29,14,252,206,251,17,247,92,29,252,137,248,156,249,119,
+247,52,29,252,139,249,26,28,5,167,247,52,29,251,107,28,6,81,247,92,29,252,
+244,251,183,202,29,252,137,248,95,248,105,247,28,29,252,137,248,223,28,4,
+153,247,28,29,251,146,28,5,171,202,29,252,80,247,104,28,4,133,21,101,251,
+93,247,2,251,28,247,183,56,160,247,1,24,251,74,214,108,232,151,203,150,195,
+169,196,187,151,8,247,63,6,139,173,176,146,176,30,209,152,83,199,251,15,27,
+251,28,251,45,42,251,45,110,31,14,252,207,247,41,249,200,21,108,251,48,230,
+50,247,101,89,157,226,24,251,28,191,133,202,147,174,145,171,160,170,173,149,
+8,247,5,6,139,165,173,148,182,30,189,149,112,189,32,27,36,251,4,59,251,4,
+116,31,14,252,92,248,168,248,53,248,96,29,60,79,69,125,247,124,29,247,196,
+230,247,79,247,50,177,247,93,8,247,39,249,150,248,96,29,59,79,69,126,247,
+124,29,247,195,230,247,80,247,50,177,247,93,8,14,252,217,248,23,247,192,21,
+247,4,161,247,144,10,132,104,104,248,58,29,171,247,48,8,247,3,248,186,21,
+247,4,162,247,144,10,131,104,105,248,58,29,170,247,48,8,14,251,102,28,5,168,
+37,10,253,10,251,17,248,84,10,251,190,28,5,225,248,85,10,252,127,251,17,248,
+114,10,251,97,248,13,248,84,10,251,49,28,5,225,21,251,19,6,63,252,13,5,247,
+19,6,251,97,248,13,248,85,10,252,188,248,5,55,247,27,29,254,60,252,17,21,
+247,25,6,112,251,33,5,247,3,6,168,247,33,5,247,25,6,160,247,5,248,170,29,
+166,247,35,5,251,3,6,110,251,35,248,170,29,14,252,227,248,151,248,207,21,
+251,85,6,176,247,80,5,251,7,6,103,251,80,5,251,85,6,116,251,9,5,247,85,6,
+100,251,85,5,247,9,6,176,247,85,5,247,82,6,14,252,188,249,9,28,4,112,247,
+27,29,252,139,251,17,21,252,15,6,116,251,5,5,247,25,6,109,251,53,5,247,2,
+6,172,247,53,5,247,25,6,14,251,131,249,162,249,138,21,253,10,6,112,251,36,
+5,247,138,6,57,252,43,5,247,33,6,221,248,43,5,247,136,6,14,252,172,251,181,
+21,251,25,6,170,247,56,5,251,3,6,106,251,56,248,170,29,117,251,2,5,248,14,
+6,14,251,131,249,82,247,238,21,251,135,6,219,248,48,5,251,34,6,59,252,48,
+5,251,137,6,110,251,31,5,249,11,6,14,252,188,251,17,21,251,3,6,110,251,35,
+5,251,66,6,117,251,5,5,247,66,6,110,251,33,5,247,5,6,14,252,214,251,160,21,
+251,66,6,165,247,35,5,251,2,6,59,252,33,5,247,5,6,167,247,33,5,247,66,6,14,
+251,254,249,21,248,193,21,252,5,6,189,247,140,5,251,36,6,251,17,253,13,5,
+247,36,6,186,247,136,5,248,4,6,14,251,71,248,184,247,87,21,218,251,247,248,
+107,61,252,186,7,14,252,122,251,17,247,243,10,252,160,249,25,28,5,139,247,
+243,10,252,171,248,147,250,107,21,249,67,251,68,253,67,7,49,247,234,21,193,
+96,188,83,83,94,90,85,83,186,94,193,193,184,184,195,30,14,252,40,247,111,
+28,6,53,21,100,177,71,137,102,100,98,101,141,74,178,100,176,99,205,139,178,
+179,176,178,144,204,99,180,8,248,64,51,21,251,17,247,14,252,120,252,121,247,
+16,251,16,5,14,251,206,248,126,28,5,146,21,196,90,184,85,83,94,94,82,85,184,
+94,195,193,188,182,195,30,247,134,252,0,21,247,67,253,67,251,67,7,14,251,
+137,249,177,250,186,21,248,104,251,63,251,188,252,217,251,64,7,14,214,28,
+4,190,28,5,20,21,247,12,254,188,252,66,247,10,247,202,247,174,251,202,247,
+10,247,202,7,14,214,249,48,250,234,21,247,202,251,10,251,202,251,174,247,
+202,251,10,252,66,250,188,247,12,7,14,120,247,239,29,163,247,11,5,14,120,
+247,239,29,201,247,198,5,251,0,6,101,251,79,5,14,135,250,168,250,79,21,234,
+248,91,5,253,194,247,230,10,50,254,79,21,234,248,91,5,253,195,247,230,10,
+14,252,100,251,123,54,29,252,100,251,254,63,10,252,159,251,105,21,219,53,
+147,78,251,1,58,76,51,83,30,223,6,169,151,207,156,168,27,167,166,128,107,
+31,49,251,95,157,251,29,69,229,151,80,39,251,41,169,33,26,41,247,99,130,204,
+30,145,164,5,94,147,45,160,198,243,247,46,111,247,27,219,51,131,186,223,247,
+94,104,247,68,26,14,252,77,251,17,247,128,29,251,30,28,5,86,247,128,29,252,
+77,251,17,21,251,5,6,100,251,89,5,251,170,6,178,247,89,5,251,5,6,77,251,201,
+5,248,140,6,14,252,254,248,107,251,158,21,247,158,57,251,76,251,199,247,76,
+57,251,158,7,14,252,105,251,17,21,252,84,6,49,252,84,5,248,84,6,113,247,242,
+21,88,251,144,5,251,144,6,188,247,144,5,14,253,92,248,82,249,117,21,70,182,
+5,57,104,104,37,49,27,74,139,207,218,155,31,178,247,87,67,180,251,189,251,
+64,166,53,247,119,247,27,106,251,60,5,49,121,188,43,237,27,247,50,201,247,
+33,233,177,31,14,251,222,248,15,28,5,10,210,29,247,61,28,251,53,69,10,251,
+222,247,210,250,93,210,29,247,122,254,30,69,10,251,222,247,148,249,26,210,
+29,247,184,252,219,69,10,251,222,247,87,247,215,210,29,247,245,251,152,69,
+10,251,222,247,25,22,248,1,10,248,51,247,33,10,251,123,247,237,28,5,46,142,
+29,247,194,28,251,17,69,10,251,123,247,174,250,120,142,29,248,1,254,57,69,
+10,251,123,247,110,249,44,142,29,248,65,252,237,69,10,251,123,247,47,247,
+224,142,29,248,128,251,161,69,10,251,123,231,22,247,156,29,248,191,247,33,
+10,251,222,64,10,248,151,28,4,203,194,10,251,222,64,10,248,90,250,30,194,
+10,251,222,64,10,248,28,248,219,194,10,251,222,64,10,247,223,247,152,194,
+10,251,222,64,10,247,161,76,194,10,251,123,64,10,247,70,28,4,239,134,10,251,
+123,64,10,247,7,250,57,134,10,251,123,64,10,190,248,237,134,10,251,123,64,
+10,127,247,161,134,10,251,123,64,10,64,76,134,10,249,39,250,95,28,5,122,21,
+139,44,136,42,252,29,251,209,251,210,252,27,252,29,247,209,251,209,248,29,
+228,240,136,142,30,248,28,247,209,247,209,248,29,248,27,251,207,247,213,252,
+28,31,248,74,253,92,21,251,242,251,174,251,173,251,240,251,242,251,173,247,
+173,247,242,247,240,247,173,247,174,247,242,247,240,247,174,251,174,251,240,
+30,14,35,250,25,248,150,21,253,188,248,40,5,253,188,7,14,74,248,109,29,28,
+6,33,251,18,28,249,223,247,105,29,247,181,250,97,247,200,10,251,178,6,251,
+75,254,80,251,60,248,82,5,251,144,6,248,23,254,21,5,247,84,6,249,99,250,21,
+5,251,148,6,251,230,252,93,5,14,252,25,249,9,250,87,21,251,109,248,152,251,
+15,252,152,251,109,6,247,170,251,171,5,14,74,249,220,249,216,21,247,224,29,
+28,249,223,247,18,28,6,33,7,247,62,252,58,5,14,252,25,249,9,28,4,176,21,251,
+171,247,171,251,170,251,171,5,247,109,252,152,247,15,248,152,6,14,252,199,
+251,207,21,251,28,247,61,251,92,251,61,5,247,8,6,91,251,148,5,242,6,187,247,
+148,5,14,74,248,109,29,28,5,76,247,134,29,28,250,180,247,105,29,74,250,128,
+252,107,21,247,19,254,108,251,19,7,249,200,249,236,21,44,176,251,62,252,58,
+5,28,4,197,247,134,29,28,251,59,247,105,29,250,83,28,7,123,248,187,21,247,
+19,28,249,223,7,247,144,29,14,252,25,251,66,21,252,146,211,6,248,159,29,248,
+146,7,14,252,25,251,66,21,253,73,6,247,75,251,45,5,213,248,146,7,14,185,28,
+4,111,251,250,21,247,15,254,54,7,247,143,29,14,250,83,247,210,29,28,249,223,
+251,19,28,6,33,248,168,10,248,31,10,252,146,60,248,146,7,14,252,158,251,217,
+21,247,72,247,43,5,253,70,60,248,146,6,14,249,55,253,223,21,248,64,10,28,
+249,124,251,15,28,6,132,6,252,42,251,55,174,48,5,14,250,83,247,210,29,28,
+250,180,6,247,144,29,28,5,76,248,168,10,248,31,10,252,13,211,7,248,159,29,
+248,13,7,14,250,6,28,4,254,250,104,21,251,57,251,219,5,253,160,6,247,143,
+29,249,98,248,72,29,249,35,247,15,252,229,6,247,29,247,164,5,14,250,6,250,
+44,250,104,21,251,57,251,219,5,253,7,251,15,248,201,248,72,29,249,188,6,252,
+42,251,55,174,48,248,212,247,141,5,248,64,10,253,126,6,247,29,247,164,5,14,
+74,248,106,29,28,5,97,42,28,250,8,7,251,35,251,103,251,35,247,103,5,28,5,
+248,42,28,250,159,248,55,29,14,74,250,87,249,220,21,247,239,10,28,250,159,
+236,28,5,248,248,147,29,28,250,8,236,28,5,97,7,247,8,251,77,5,14,74,248,106,
+29,249,249,7,247,8,251,77,234,197,247,239,10,253,249,248,55,29,239,247,249,
+21,251,35,251,103,251,35,247,103,5,28,4,147,248,147,29,14,250,56,28,7,174,
+248,11,21,235,28,250,8,7,251,103,247,35,247,103,247,36,5,28,5,248,235,28,
+250,160,247,141,10,14,250,56,247,213,10,28,250,160,43,28,5,248,6,247,103,
+251,36,251,103,251,35,5,28,250,8,43,28,5,96,6,251,76,251,9,196,45,5,14,250,
+83,247,213,10,253,248,247,141,10,249,248,6,251,76,251,9,196,45,5,248,126,
+248,86,21,251,103,251,35,5,28,251,108,6,251,103,247,35,247,103,247,36,5,28,
+4,148,6,14,250,83,28,6,166,168,21,254,234,250,234,248,54,251,70,180,231,252,
+241,247,131,41,41,247,132,252,240,231,180,251,70,248,54,250,234,254,234,5,
+14,250,83,28,6,164,176,21,251,132,248,240,47,98,247,70,252,54,254,234,250,
+234,49,49,250,234,254,234,252,54,247,70,98,47,248,241,251,131,5,14,250,83,
+28,6,164,28,4,170,21,41,237,252,241,251,131,180,47,248,54,247,70,254,234,
+254,234,229,49,250,234,250,234,251,70,252,54,231,98,5,14,250,83,28,6,166,
+28,4,178,21,49,229,254,234,254,234,247,70,248,54,47,180,251,132,252,240,237,
+41,248,241,247,131,98,231,252,54,251,70,5,14,249,63,28,5,215,28,6,205,21,
+253,186,253,162,251,57,253,195,125,59,146,194,175,248,9,251,173,247,186,251,
+52,251,52,24,247,123,252,24,200,251,91,171,251,143,230,101,24,139,248,30,
+250,63,249,14,248,109,30,251,48,247,151,235,247,212,139,26,14,251,6,249,252,
+28,6,51,21,47,6,251,185,253,39,251,184,249,39,5,46,6,247,232,253,117,5,229,
+6,14,252,238,248,2,251,24,21,93,6,251,39,251,221,251,38,247,221,5,93,6,247,
+62,252,4,5,184,6,14,251,6,249,252,249,230,247,140,29,252,238,248,2,252,136,
+21,251,62,248,4,5,94,6,251,62,252,4,5,185,6,247,38,247,221,247,39,251,221,
+5,14,140,250,111,250,9,247,171,10,253,224,28,6,24,21,61,7,250,9,251,175,5,
+217,7,253,171,247,136,249,171,247,135,5,217,7,14,251,236,253,151,247,171,
+10,252,180,248,59,252,119,21,178,7,252,31,247,14,248,31,247,14,5,178,7,252,
+78,251,34,5,100,7,14,74,250,74,251,183,21,247,74,7,253,74,249,77,249,74,249,
+74,5,247,76,7,254,0,254,2,5,14,140,250,111,28,4,143,247,29,29,240,28,5,201,
+247,29,29,251,170,247,170,29,14,252,180,248,59,251,234,21,178,7,252,78,247,
+34,5,100,7,248,31,251,14,252,31,251,14,5,100,7,14,74,250,74,248,224,21,254,
+0,250,2,5,251,76,7,249,74,253,74,253,74,253,77,5,251,74,7,14,253,12,247,170,
+29,28,6,94,87,247,140,29,253,37,98,21,247,232,253,117,5,229,6,247,232,249,
+117,5,46,6,251,184,253,39,251,185,249,39,5,72,252,39,247,29,29,250,6,28,5,
+147,248,56,21,247,139,247,138,139,248,34,251,139,247,141,251,138,247,138,
+252,35,141,251,140,251,140,251,140,251,141,141,252,34,247,138,251,138,247,
+3,251,0,247,29,77,247,32,128,8,251,229,251,242,32,247,242,251,161,247,5,247,
+161,247,243,246,251,243,247,227,7,247,34,150,247,32,201,247,2,247,2,8,70,
+208,21,251,101,251,101,251,229,141,251,99,247,99,251,100,247,101,139,247,
+229,247,100,247,98,247,101,247,101,247,227,139,247,101,251,101,247,99,251,
+98,139,251,231,251,99,251,99,8,14,250,6,28,7,15,250,76,21,122,247,83,141,
+194,152,247,135,251,134,125,84,137,251,83,157,133,80,24,109,247,75,74,122,
+247,86,27,252,57,252,57,5,233,251,2,251,34,193,251,48,27,251,240,251,174,
+251,174,251,240,251,241,247,174,251,174,247,240,247,241,247,174,247,174,247,
+241,247,45,83,247,33,49,246,31,248,58,248,59,5,251,86,157,205,169,251,76,
+30,252,59,252,148,21,251,186,251,130,251,130,251,186,251,186,251,130,247,
+130,247,186,247,186,247,130,247,130,247,186,247,186,247,130,251,130,251,186,
+30,14,251,181,249,104,247,253,21,247,14,251,25,239,251,8,52,54,109,81,56,
+30,250,42,35,28,249,176,7,243,184,247,23,222,247,34,247,10,8,247,18,244,244,
+222,247,22,26,251,112,135,21,141,72,102,69,88,77,78,62,56,68,85,88,8,248,
+44,7,212,183,193,174,203,27,210,188,91,69,141,31,14,251,106,249,129,247,189,
+21,247,114,7,251,24,101,5,247,244,7,247,24,177,5,247,113,7,251,24,102,5,248,
+71,48,252,99,7,251,73,88,5,248,73,46,252,99,7,251,20,103,5,251,112,7,247,
+20,174,5,251,243,7,251,20,102,5,251,111,7,247,20,175,5,252,74,232,248,99,
+7,247,73,191,5,252,74,230,248,99,7,48,247,87,21,251,73,88,5,247,244,7,247,
+73,191,5,14,253,55,248,134,250,251,247,6,29,253,55,247,139,251,83,21,152,
+208,5,251,37,6,251,12,120,178,222,155,31,222,154,174,248,38,29,75,73,251,
+17,116,31,251,17,116,176,73,247,69,27,14,253,55,247,169,250,251,247,6,10,
+253,55,165,251,83,247,7,29,253,55,248,96,250,50,21,152,209,5,251,224,6,126,
+69,5,248,6,247,93,247,6,29,253,55,247,139,251,83,21,152,208,5,251,31,6,251,
+13,112,166,232,157,31,232,157,176,168,247,13,27,247,31,6,153,210,248,170,
+29,251,44,53,87,251,33,112,31,251,33,113,205,89,247,44,27,234,251,91,21,152,
+208,5,251,234,6,125,68,5,14,253,55,248,85,250,49,21,152,209,5,251,235,6,126,
+69,5,247,63,247,94,247,6,10,253,55,247,85,252,28,21,152,208,5,251,229,6,126,
+70,5,247,62,247,93,247,7,29,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,250,6,14,250,83,14,252,232,14,252,74,14,253,141,14,
+252,68,14,35,14,74,14,252,232,14,176,14,252,213,14,254,172,14,250,6,28,5,
+88,250,196,21,251,44,44,251,2,78,70,30,251,34,251,52,72,64,131,251,78,8,96,
+6,147,247,51,178,247,24,228,247,39,8,180,209,193,247,16,244,26,247,93,251,
+20,213,34,251,20,77,67,79,30,84,203,68,94,26,82,94,109,103,111,56,167,247,
+22,247,41,247,20,247,31,247,125,247,109,247,50,251,11,251,89,30,251,169,254,
+111,21,66,81,99,88,81,82,180,211,204,194,186,199,194,193,94,72,30,249,250,
+249,47,21,254,100,250,100,254,99,254,100,250,99,254,99,5,14,252,94,248,28,
+29,252,94,248,29,29,252,94,248,28,10,252,94,248,29,10,247,31,248,171,249,
+154,21,120,129,162,153,140,31,144,247,31,5,251,19,6,51,252,137,5,247,19,6,
+182,247,31,5,154,144,157,161,158,27,247,140,6,158,149,117,124,138,31,134,
+251,31,5,247,19,6,227,248,137,5,251,19,6,96,251,31,5,125,134,121,116,120,
+27,252,187,248,236,21,71,252,23,5,247,40,6,201,247,62,5,159,147,156,157,157,
+27,249,12,6,157,150,121,119,141,31,141,251,62,5,247,40,6,207,248,23,5,254,
+193,28,251,88,21,122,125,163,154,31,146,247,105,5,251,41,6,63,252,70,5,250,
+210,6,215,248,70,5,251,41,6,70,251,105,5,124,135,117,115,122,27,14,106,172,
+250,123,164,247,242,172,6,252,109,163,7,30,163,99,99,89,135,4,63,12,9,247,
+7,10,247,164,11,247,7,155,12,12,247,164,160,12,13,140,12,14,250,213,21,186,
+19,2,180,2,0,1,0,20,0,27,0,34,0,48,0,51,0,108,0,122,0,148,0,173,0,176,0,188,
+0,195,0,226,0,247,1,6,1,61,1,114,1,121,1,130,1,137,1,147,1,156,1,163,1,172,
+1,183,1,192,1,209,1,220,1,228,1,236,1,245,2,6,2,12,2,180,3,85,3,127,3,134,
+3,138,3,188,3,207,3,221,3,230,4,2,4,5,4,11,4,60,4,68,4,182,4,201,4,238,5,
+69,5,76,5,132,5,141,5,178,5,216,6,5,6,39,6,176,7,58,7,72,7,76,7,112,7,122,
+7,248,8,36,8,42,8,68,8,102,8,227,8,239,9,107,9,111,9,134,9,176,10,38,10,86,
+10,109,10,119,10,132,10,152,10,163,11,11,11,122,11,127,11,163,12,16,12,34,
+12,142,12,172,12,205,12,214,12,243,13,47,13,85,13,93,13,104,13,168,13,210,
+13,220,13,223,13,233,13,236,14,68,14,160,14,167,14,195,14,229,14,235,14,244,
+14,247,15,3,15,6,15,35,15,38,15,129,15,150,15,153,15,160,15,187,15,219,15,
+240,15,251,16,4,16,12,16,98,16,145,16,167,16,213,17,41,17,48,17,57,17,101,
+17,113,17,136,17,147,17,229,17,239,18,28,18,37,18,40,18,56,18,85,18,97,18,
+152,18,157,18,162,18,168,18,186,18,190,18,194,18,208,18,221,18,224,19,15,
+19,88,19,98,19,125,19,188,19,224,19,227,19,232,19,235,19,244,20,25,20,31,
+20,99,20,125,20,137,20,169,20,194,20,207,20,215,21,21,21,85,21,149,21,213,
+21,218,22,25,22,38,22,98,22,113,22,174,22,184,22,216,22,226,22,242,23,24,
+23,82,23,103,23,134,23,140,23,188,23,195,23,199,23,215,23,224,23,231,23,244,
+24,4,24,7,24,61,24,69,24,122,24,143,24,170,24,196,24,203,24,226,25,5,25,25,
+25,40,25,45,25,59,25,85,25,127,25,177,25,227,25,245,26,19,26,66,26,93,26,
+102,26,121,26,146,26,155,26,168,26,183,26,188,26,210,26,217,26,225,27,11,
+27,19,27,27,27,43,27,86,27,123,27,167,27,191,27,216,27,238,27,248,28,9,28,
+20,28,62,28,82,28,102,28,105,28,116,28,157,28,175,28,214,28,254,29,38,29,
+43,29,81,29,97,29,107,29,146,29,185,29,222,30,3,30,41,30,55,30,93,30,106,
+30,142,30,151,30,164,30,179,30,191,30,202,30,217,30,232,31,3,31,39,31,59,
+31,93,31,100,31,128,31,163,31,191,31,204,31,237,32,14,32,48,32,67,32,101,
+32,135,32,146,32,165,32,172,32,180,32,194,32,227,33,4,33,37,33,49,33,81,33,
+113,33,125,33,138,33,160,33,192,33,206,33,236,33,254,34,9,34,40,34,54,34,
+66,34,97,34,108,34,139,34,146,34,153,34,172,34,189,34,218,34,231,35,5,35,
+35,35,65,35,75,35,105,35,135,35,141,35,158,35,187,35,216,35,245,36,0,36,29,
+36,58,36,85,36,103,36,114,36,132,36,143,36,171,36,191,36,219,36,228,36,244,
+36,250,37,6,37,33,37,60,37,69,37,79,37,106,37,120,37,147,37,172,37,197,37,
+223,37,236,38,6,38,32,38,43,38,54,38,80,38,97,38,109,38,114,38,129,38,137,
+38,158,38,183,38,208,38,218,38,232,38,255,39,5,39,20,39,31,39,36,39,60,39,
+78,39,102,39,126,39,150,39,155,39,174,39,180,39,202,39,216,39,230,39,237,
+39,245,40,12,40,35,40,58,40,69,40,91,40,103,40,113,40,134,40,145,40,167,40,
+189,40,204,40,215,40,237,40,245,41,11,41,33,41,55,41,75,41,88,41,101,41,110,
+41,123,41,133,41,138,41,159,41,180,41,201,41,207,41,228,41,237,41,242,42,
+7,42,28,42,34,42,38,42,57,42,77,42,97,42,117,42,137,42,157,42,167,42,180,
+42,192,42,212,42,232,42,252,43,14,43,26,43,34,43,42,43,61,43,72,43,91,43,
+110,43,115,43,120,43,139,43,158,43,177,43,196,43,208,43,227,43,246,44,9,44,
+28,44,45,44,54,44,61,44,79,44,97,44,107,44,125,44,130,44,148,44,166,44,178,
+44,188,44,195,44,213,44,231,44,249,45,11,45,29,45,45,45,63,45,74,45,85,45,
+96,45,107,45,118,45,129,45,140,45,157,45,174,45,182,45,199,45,216,45,233,
+45,250,46,11,46,28,46,41,46,58,46,65,46,82,46,87,46,102,46,117,46,133,46,
+149,46,158,46,174,46,190,46,206,46,214,46,230,46,246,47,6,47,22,47,38,47,
+45,47,55,47,65,47,75,47,85,47,95,47,103,47,111,47,119,47,126,47,141,47,156,
+47,171,47,186,47,192,47,207,47,222,47,237,47,252,48,6,48,21,48,36,48,51,48,
+59,48,74,48,87,48,92,48,106,48,120,48,134,48,148,48,162,48,176,48,183,48,
+197,48,211,48,225,48,239,48,253,49,11,49,25,49,37,49,49,49,53,49,62,49,71,
+49,80,49,89,49,98,49,104,49,110,49,123,49,136,49,149,49,162,49,175,49,188,
+49,201,49,214,49,227,49,240,49,253,50,10,50,23,50,36,50,49,50,62,50,73,50,
+80,50,87,50,92,50,104,50,116,50,128,50,140,50,152,50,164,50,176,50,188,50,
+200,50,212,50,217,50,229,50,241,50,253,51,9,51,21,51,33,51,45,51,57,51,69,
+51,76,51,86,51,94,51,102,51,110,51,118,51,126,51,134,51,142,51,148,51,159,
+51,170,51,181,51,192,51,203,51,214,51,225,51,236,51,247,52,2,52,13,52,24,
+52,35,52,46,52,57,52,68,52,79,52,90,52,101,52,112,52,123,52,134,52,145,52,
+156,52,167,52,176,52,181,52,185,52,191,52,196,52,201,52,205,52,211,52,217,
+52,221,52,225,52,230,52,239,52,246,53,1,53,12,53,16,53,27,53,34,53,45,53,
+48,53,57,53,62,53,69,53,78,53,91,53,102,53,108,53,115,53,122,53,132,53,139,
+53,149,53,165,53,172,53,176,53,185,53,193,53,196,53,202,53,210,53,231,53,
+234,53,242,53,249,54,0,54,18,54,25,54,33,54,40,54,43,54,51,54,54,28,6,84,
+248,68,10,241,252,185,126,10,247,50,249,169,248,138,10,11,28,4,147,196,78,
+29,11,28,5,88,22,157,29,11,28,4,147,250,33,21,138,10,231,10,248,90,29,11,
+66,29,14,21,209,88,190,49,44,49,69,104,113,139,106,182,164,163,151,139,30,
+178,217,5,151,152,153,143,153,27,172,164,94,78,126,31,125,71,80,107,73,122,
+108,251,52,24,203,6,163,247,11,5,232,174,237,192,247,5,26,14,138,29,247,120,
+6,247,135,28,4,205,248,50,10,11,28,6,121,247,184,10,51,252,87,24,252,189,
+89,29,248,189,247,8,10,249,1,247,12,10,8,11,28,4,152,186,21,134,237,5,247,
+197,29,247,3,248,212,73,10,251,17,253,5,247,29,10,11,62,29,14,21,251,172,
+247,202,5,190,92,112,247,212,29,28,4,129,196,132,29,11,28,5,188,248,207,21,
+247,103,10,231,247,224,248,45,29,213,109,130,165,31,167,129,167,126,247,17,
+29,248,13,10,11,223,10,247,109,250,230,112,10,248,112,29,113,131,135,100,
+135,8,248,12,29,11,117,29,124,29,251,176,248,177,24,248,164,248,139,5,11,
+28,5,168,28,4,125,21,247,7,53,208,39,55,71,80,47,90,172,83,139,30,247,35,
+6,125,84,251,15,45,82,100,161,247,2,24,189,29,228,10,247,9,248,181,5,247,
+74,200,247,95,247,66,247,56,26,11,28,6,10,250,19,21,174,84,233,251,3,55,98,
+94,123,127,30,217,251,110,71,251,39,251,21,251,76,45,251,27,25,90,249,100,
+145,29,180,252,222,24,247,95,6,190,201,248,146,249,11,247,119,26,11,250,144,
+250,87,55,29,11,28,5,137,28,5,94,171,10,11,249,185,249,236,195,10,11,247,
+76,10,166,28,250,244,119,10,11,28,6,92,28,4,246,102,29,11,250,58,250,3,109,
+10,11,28,5,127,28,5,41,143,10,11,76,29,248,46,243,7,251,13,196,10,11,28,5,
+195,28,4,248,88,29,11,247,103,29,251,105,254,210,24,139,29,243,248,170,248,
+31,29,11,21,247,111,29,252,105,22,247,111,29,14,119,29,248,254,247,138,10,
+11,28,4,176,250,19,97,29,11,28,5,27,28,5,94,80,10,11,21,248,77,29,237,238,
+221,214,188,31,251,21,6,247,215,29,14,247,85,247,40,10,11,28,8,31,247,200,
+10,28,251,20,37,6,180,135,192,135,139,26,168,137,153,124,125,123,254,25,254,
+208,24,114,109,135,135,115,137,8,139,90,134,91,135,30,37,248,189,241,7,251,
+8,150,5,135,102,157,155,151,31,247,197,248,1,5,248,38,6,65,252,3,131,100,
+184,152,251,93,122,25,37,250,209,7,209,247,248,5,251,52,6,74,251,96,5,122,
+133,106,127,120,27,252,55,6,243,248,164,5,247,111,6,160,169,127,123,135,31,
+115,251,46,5,247,41,6,235,248,117,5,251,43,6,98,251,35,5,118,133,108,129,
+119,27,251,105,6,233,248,111,5,247,250,6,162,163,133,119,31,251,66,247,58,
+7,254,13,218,21,43,252,127,5,251,213,6,11,28,6,37,249,191,21,200,100,247,
+44,251,91,64,251,24,112,62,47,30,168,218,5,251,107,6,118,96,5,170,109,94,
+176,83,27,252,72,251,88,252,5,251,197,251,45,227,251,114,247,141,247,13,247,
+7,187,222,227,31,35,188,231,112,247,64,27,247,89,247,72,247,13,219,217,31,
+247,89,7,251,85,251,111,69,74,49,27,251,52,113,245,227,190,141,172,155,197,
+31,247,167,161,247,242,247,17,247,105,26,251,152,22,251,19,251,95,41,251,
+39,106,30,247,74,155,247,46,247,60,245,27,203,149,96,90,31,252,187,135,21,
+34,252,195,5,94,105,59,63,65,27,251,23,149,247,35,231,247,116,246,247,189,
+247,131,165,31,11,21,33,6,35,96,49,75,251,5,27,33,67,197,247,2,137,31,32,
+6,133,111,135,110,110,26,251,54,244,53,247,51,247,95,247,37,247,32,247,86,
+176,30,11,250,177,250,17,151,29,11,247,43,29,14,21,251,0,6,84,121,91,96,94,
+251,12,116,237,251,1,27,251,31,45,251,5,251,33,75,31,247,3,6,192,158,186,
+182,182,247,12,164,43,247,1,27,247,29,235,247,3,247,35,200,31,14,21,223,77,
+205,59,57,84,71,57,60,198,79,219,219,199,203,214,30,11,247,90,10,251,107,
+248,141,10,112,137,8,190,29,11,5,247,66,172,87,233,239,29,11,247,9,248,187,
+5,247,54,174,251,1,245,251,37,27,32,251,31,80,59,33,31,164,29,251,4,252,181,
+11,86,10,14,247,185,29,179,10,11,21,251,2,6,69,108,71,39,251,2,27,104,106,
+147,151,123,31,102,247,56,5,153,116,84,148,119,27,65,92,65,77,251,33,247,
+43,80,247,17,247,87,247,5,247,15,247,68,214,31,14,28,5,231,250,216,164,10,
+11,28,4,152,248,148,21,247,115,251,77,247,23,251,207,108,96,135,137,106,30,
+209,247,246,248,201,29,248,142,7,248,103,247,64,247,31,247,171,194,31,148,
+172,141,169,170,26,249,191,249,138,21,243,253,30,35,7,247,17,129,162,247,
+255,10,251,33,128,5,35,249,29,243,7,251,15,150,114,141,119,248,163,29,166,
+155,163,142,25,254,109,253,116,21,107,135,104,131,100,30,251,97,98,47,43,
+251,126,248,22,29,247,33,225,77,251,56,31,11,21,247,165,29,254,75,28,251,
+133,247,135,29,250,78,28,4,121,5,11,21,225,76,190,55,59,55,88,49,114,147,
+114,158,121,30,247,21,6,122,63,47,82,72,120,122,57,24,247,38,166,247,94,246,
+247,64,26,14,21,247,25,45,233,251,70,71,84,127,118,90,30,200,247,37,247,48,
+247,1,247,103,159,137,221,24,252,78,96,251,134,251,172,251,185,26,251,113,
+247,44,71,247,51,247,130,247,45,247,64,247,75,30,251,88,108,21,251,34,251,
+3,33,63,251,10,137,247,11,219,196,159,223,145,155,30,188,211,188,148,168,
+27,212,197,83,251,2,31,14,28,5,170,247,31,29,11,247,158,10,82,251,163,24,
+251,251,6,196,247,161,142,154,146,143,157,140,25,139,180,142,180,142,30,248,
+2,29,251,30,253,32,24,136,125,132,135,120,138,8,208,10,247,31,249,31,24,141,
+150,145,145,155,141,8,14,117,10,248,66,243,7,183,10,11,21,247,13,49,225,251,
+13,251,54,251,45,251,38,251,56,251,15,231,55,247,13,247,52,247,45,247,38,
+247,56,30,251,23,112,247,234,10,11,248,10,29,247,71,250,22,248,183,10,153,
+132,135,115,51,252,87,24,252,189,89,29,248,189,6,75,251,197,5,251,115,93,
+247,17,248,36,10,11,21,241,29,227,178,118,226,27,154,156,140,140,157,31,233,
+145,225,196,182,178,8,251,110,4,241,29,229,175,116,229,27,153,154,140,140,
+155,31,233,146,228,196,182,179,8,14,28,4,129,196,160,29,120,47,221,99,224,
+130,25,104,102,83,75,125,247,12,29,161,190,156,173,30,220,150,218,166,217,
+177,8,14,21,165,247,41,62,232,251,33,156,221,158,245,197,164,247,3,8,247,
+17,166,64,235,251,44,27,251,113,251,22,251,76,251,61,102,31,251,54,253,113,
+137,128,126,122,124,138,25,69,132,5,81,248,23,197,7,42,146,5,130,132,150,
+157,143,31,247,64,249,161,5,247,15,166,178,246,232,27,193,163,67,65,122,31,
+115,251,3,106,84,251,15,140,132,119,134,114,135,123,247,62,142,158,251,16,
+109,251,16,8,251,37,104,81,121,80,27,116,95,148,160,104,31,123,64,5,122,168,
+198,131,178,27,247,26,247,59,181,247,107,177,31,14,28,5,221,249,234,21,247,
+66,68,247,58,251,38,241,30,247,1,247,56,251,56,242,251,13,251,75,5,156,78,
+71,149,63,27,252,142,251,191,252,78,252,62,251,69,201,251,41,247,6,37,31,
+251,23,251,93,247,40,32,247,31,247,103,5,109,217,229,122,239,27,248,173,247,
+158,248,103,248,56,31,252,121,248,21,21,252,216,254,7,5,127,189,131,194,200,
+26,248,5,247,117,248,29,247,136,184,184,125,108,180,30,247,58,252,21,21,251,
+248,251,120,252,40,251,133,81,76,166,192,86,30,248,238,250,29,5,165,78,154,
+63,51,26,11,118,29,59,70,50,251,43,247,70,57,247,204,10,11,247,66,29,14,113,
+135,125,131,118,27,139,63,134,86,135,30,37,248,236,241,7,90,143,82,144,139,
+26,116,141,125,143,143,165,229,248,89,24,186,6,11,21,253,76,248,91,10,249,
+76,6,14,250,193,249,1,21,247,43,90,247,1,49,204,30,229,247,33,251,7,205,45,
+251,41,5,151,92,88,147,81,27,252,15,251,102,251,224,251,213,251,27,184,251,
+5,235,67,31,251,3,251,66,244,69,247,13,247,81,5,127,184,190,130,196,27,247,
+244,29,31,251,244,247,127,21,251,244,252,193,5,134,164,137,165,168,26,247,
+168,247,42,247,152,247,17,163,170,121,98,168,30,196,251,119,21,251,144,251,
+23,251,181,251,35,116,106,157,180,113,30,247,244,248,187,5,143,119,139,114,
+115,26,11,250,222,250,42,21,247,93,10,41,57,114,42,92,56,92,50,80,78,51,125,
+235,248,119,24,251,15,6,251,234,69,5,76,7,247,50,112,251,64,253,244,248,216,
+29,11,243,254,254,103,29,11,247,253,29,5,90,163,203,104,188,27,247,15,217,
+215,247,56,247,4,31,74,227,5,247,109,29,11,250,50,249,183,21,152,10,5,90,
+247,25,236,120,247,19,27,247,111,247,223,205,247,177,239,74,213,251,29,161,
+31,248,47,10,11,250,130,28,4,120,21,231,221,206,237,237,251,10,241,251,151,
+251,64,251,141,251,10,251,82,251,3,247,22,52,247,11,251,3,31,251,168,52,251,
+181,251,61,251,221,26,251,133,247,118,48,247,105,247,134,248,10,247,86,248,
+11,30,248,62,252,159,247,8,247,51,26,241,241,164,215,186,170,130,97,183,30,
+171,251,53,5,127,153,183,135,157,27,251,69,252,254,21,251,128,251,20,251,
+95,251,83,45,80,217,247,48,247,137,247,62,247,67,247,65,221,30,211,58,196,
+45,251,14,26,14,134,29,5,35,248,240,243,7,247,53,29,11,28,6,90,250,123,21,
+251,164,6,251,38,253,74,5,76,86,45,32,55,27,49,161,247,3,219,158,31,247,33,
+249,53,5,251,164,6,251,40,253,80,5,96,111,48,251,13,251,12,27,85,129,205,
+247,19,166,31,247,4,248,180,5,240,160,36,190,251,16,27,32,45,108,84,36,31,
+47,7,167,197,223,162,169,27,189,151,92,84,127,31,251,7,252,187,5,251,56,104,
+247,1,34,247,35,27,247,1,247,29,199,219,245,31,69,170,205,69,247,4,27,233,
+247,3,189,206,237,31,11,247,85,10,14,21,247,79,10,30,247,130,10,251,124,28,
+251,101,141,10,31,251,178,131,247,66,29,11,28,6,29,251,113,21,248,166,10,
+251,21,110,233,247,31,62,31,178,29,251,47,210,232,251,32,247,146,27,247,45,
+247,91,227,158,176,31,252,19,250,197,200,29,250,222,249,29,21,247,44,49,247,
+115,251,144,40,43,94,92,67,30,198,113,79,172,53,27,35,251,5,90,102,43,31,
+41,7,143,160,247,41,178,149,27,188,146,118,78,31,251,26,253,56,135,118,107,
+76,124,98,25,247,111,6,154,155,5,117,186,202,120,199,27,248,76,247,91,248,
+5,247,197,31,251,181,127,21,251,126,251,11,251,203,251,154,117,124,227,152,
+141,30,238,248,135,118,35,170,247,56,8,165,167,211,229,225,27,247,17,135,
+251,17,33,31,14,21,254,203,37,6,247,198,29,248,112,29,113,129,135,108,137,
+8,139,78,135,77,132,30,37,250,232,247,186,29,241,248,164,5,247,128,247,84,
+10,251,123,6,231,248,111,248,53,10,11,21,248,47,29,30,247,114,29,251,72,253,
+246,248,112,10,247,7,248,177,247,207,10,11,247,176,10,164,143,151,163,155,
+29,11,28,5,66,145,21,247,79,29,8,247,67,29,11,248,62,29,252,254,37,7,198,
+133,200,135,139,26,162,137,155,132,133,117,11,21,128,29,247,137,252,179,24,
+229,10,11,249,50,21,247,25,251,46,178,33,32,251,119,90,251,36,90,184,121,
+184,163,164,143,151,164,30,167,247,44,5,143,160,161,145,162,27,208,207,100,
+61,251,43,251,37,104,251,13,149,31,120,47,5,231,149,247,42,143,251,21,26,
+33,39,51,34,111,110,145,149,110,30,123,247,29,5,147,122,121,248,106,10,221,
+247,57,247,155,221,247,96,247,11,251,21,178,42,31,247,17,151,247,38,223,247,
+32,26,11,249,209,28,4,150,21,231,80,247,25,251,56,75,77,112,111,92,30,175,
+122,100,158,83,27,71,66,110,117,77,31,80,7,141,152,236,163,146,27,170,144,
+126,103,31,52,252,42,136,126,118,102,130,114,25,247,34,6,149,149,5,125,169,
+180,128,178,27,247,178,247,22,247,113,247,75,31,251,80,132,21,251,32,61,251,
+79,251,62,125,129,192,147,140,30,204,247,191,125,77,159,237,8,155,157,186,
+193,195,27,220,137,64,75,31,14,5,247,50,10,11,28,5,233,28,4,238,21,235,29,
+235,248,123,24,145,166,164,155,161,142,247,11,149,24,243,252,240,247,65,29,
+251,101,254,178,173,29,11,250,178,21,251,7,6,205,251,16,147,112,118,26,105,
+120,115,92,127,125,141,142,124,30,253,174,247,60,5,251,164,7,249,137,251,
+52,5,207,65,194,59,47,26,96,99,112,88,129,129,140,141,129,30,253,164,247,
+60,5,251,34,7,207,251,230,5,208,6,158,247,64,249,8,251,25,5,136,152,154,138,
+153,27,243,247,11,217,247,70,247,25,104,242,77,229,31,168,145,207,166,247,
+33,26,247,9,87,247,43,109,194,30,11,247,248,29,247,50,249,201,248,69,10,251,
+21,253,60,247,246,29,11,28,4,236,28,4,199,21,247,43,254,159,7,49,252,109,
+5,247,52,6,217,247,111,5,166,147,168,153,155,27,248,136,6,253,11,253,0,229,
+251,21,5,192,209,147,149,170,27,200,247,125,67,251,102,251,151,251,107,251,
+148,251,80,102,61,148,180,84,31,112,247,148,5,165,113,49,141,116,27,251,2,
+67,251,13,43,45,247,31,251,62,247,228,248,95,247,217,247,244,247,206,247,
+107,251,113,247,66,251,154,159,31,11,250,226,250,148,21,251,91,6,106,102,
+5,160,92,76,155,247,24,10,67,251,248,221,10,87,250,234,247,85,10,14,21,247,
+12,251,7,247,5,251,126,248,24,29,30,247,74,10,251,21,71,57,247,81,10,247,
+33,196,247,3,244,247,13,26,14,199,29,251,146,248,83,247,69,10,21,251,144,
+251,23,251,181,251,35,92,44,219,247,103,247,168,247,42,247,152,247,17,190,
+229,53,251,92,30,11,28,8,106,248,14,29,252,219,35,7,223,129,161,134,158,248,
+160,29,135,112,247,237,10,163,155,164,142,25,246,149,5,243,252,210,35,7,221,
+129,164,134,157,248,160,29,133,114,247,237,10,164,155,161,142,25,247,1,149,
+5,243,11,247,179,29,47,251,58,251,105,27,251,15,251,15,206,247,66,176,146,
+205,155,217,31,247,33,249,66,247,101,29,251,35,253,68,24,247,157,29,11,248,
+199,250,148,247,1,29,11,247,106,29,252,240,35,7,241,243,29,11,248,21,29,251,
+57,86,104,34,30,78,252,7,5,247,43,6,238,247,163,145,153,149,155,159,141,25,
+150,166,225,159,247,208,29,172,151,116,31,119,145,129,162,157,26,141,247,
+122,5,251,44,6,78,251,253,5,88,247,53,247,13,104,248,95,29,11,210,10,247,
+56,110,251,57,251,83,251,72,251,66,251,83,80,251,23,178,209,137,30,135,247,
+84,5,251,50,6,76,251,222,5,68,247,43,223,122,247,48,27,11,21,253,76,248,91,
+10,249,78,6,11,135,29,14,250,226,192,21,247,1,7,144,29,11,142,29,14,248,55,
+10,247,250,28,4,227,21,247,32,251,25,192,251,13,251,16,251,128,88,251,54,
+88,180,120,184,170,172,149,152,167,30,172,247,58,5,147,164,163,143,166,27,
+217,188,94,59,251,121,251,253,251,81,251,60,251,4,31,119,36,5,249,31,6,186,
+247,132,5,53,6,92,251,1,5,251,254,6,247,66,233,248,8,247,79,247,127,26,11,
+28,6,125,198,21,236,7,130,108,251,2,96,110,27,92,127,182,195,151,31,247,60,
+249,176,5,251,167,6,251,33,253,55,5,59,90,45,251,1,51,27,55,159,246,219,158,
+31,247,33,249,57,5,251,165,6,251,35,253,60,5,62,98,59,32,251,10,27,89,127,
+203,247,17,166,31,247,37,249,80,248,145,29,247,62,122,251,21,253,6,5,251,
+54,104,11,250,42,249,21,143,29,11,248,90,10,251,173,252,254,106,247,51,104,
+247,56,111,233,25,247,203,29,158,167,251,101,251,80,180,31,11,249,119,250,
+101,21,247,13,251,14,7,165,247,23,222,10,112,251,25,24,251,58,251,13,247,
+34,6,251,56,253,212,5,94,10,11,176,29,248,30,10,11,159,10,201,247,195,247,
+129,29,11,145,10,14,21,190,251,54,251,15,174,251,49,166,29,11,147,29,14,21,
+247,192,10,248,88,29,30,247,87,247,85,29,251,158,141,21,251,17,251,60,248,
+87,10,212,248,9,29,11,151,29,14,111,239,122,213,251,0,190,8,247,64,190,247,
+27,233,247,44,26,247,64,251,70,204,251,111,30,252,120,47,6,195,135,178,137,
+139,26,165,137,141,121,135,128,251,54,253,121,24,137,123,127,126,112,137,
+8,139,98,135,82,135,30,49,248,152,229,7,82,143,106,143,139,26,108,141,135,
+158,141,149,205,247,185,24,182,6,247,9,159,251,9,53,159,31,11,28,4,187,164,
+247,95,10,69,251,60,247,83,29,247,100,247,139,247,92,10,11,154,10,14,5,251,
+27,247,48,29,11,203,29,251,236,251,253,135,30,35,6,247,113,250,248,5,168,
+6,247,103,133,247,121,98,251,230,26,11,214,10,182,247,3,128,251,4,251,34,
+251,3,37,251,33,94,251,52,155,209,30,141,247,35,5,251,13,6,84,251,162,11,
+250,234,28,5,78,21,231,94,209,41,44,49,247,71,10,252,101,22,247,34,29,247,
+96,29,251,131,28,251,4,233,29,11,169,10,184,180,148,151,174,31,11,250,144,
+250,87,21,169,10,11,21,247,115,251,66,176,251,17,251,144,251,51,251,56,251,
+76,251,46,247,17,72,247,37,188,194,149,155,189,30,251,17,251,62,251,38,70,
+251,72,75,176,64,24,247,236,237,247,248,247,97,247,250,26,251,88,137,21,88,
+122,88,129,87,30,127,127,79,84,53,27,105,44,176,247,15,247,33,246,247,2,221,
+167,236,113,251,56,31,14,21,248,63,29,247,0,248,111,5,251,70,6,37,252,88,
+5,98,92,85,104,78,27,108,119,176,176,147,31,247,1,248,107,5,48,248,49,29,
+247,3,127,53,252,13,247,132,10,14,135,120,129,125,118,137,25,139,59,133,96,
+135,30,46,248,239,232,7,247,105,10,11,28,8,86,248,68,10,241,252,150,35,7,
+180,137,190,139,139,26,170,137,159,137,127,112,251,238,253,121,24,248,20,
+29,137,157,143,156,27,139,190,141,186,141,30,247,111,10,11,249,166,28,5,236,
+21,233,251,25,157,59,251,72,251,70,33,251,73,39,221,57,243,119,30,84,251,
+148,135,122,123,127,116,137,25,59,135,5,75,248,50,203,7,61,143,112,141,127,
+149,143,158,25,199,247,166,5,44,168,49,215,235,26,239,247,7,247,46,241,67,
+30,164,35,5,133,155,160,134,157,27,197,171,178,191,31,14,87,247,16,247,39,
+10,14,173,29,248,66,243,7,183,10,11,21,247,92,200,247,44,247,73,166,247,27,
+8,247,25,166,87,207,47,27,72,53,106,39,119,31,128,82,169,81,139,26,247,43,
+6,114,251,11,251,2,57,32,98,8,11,186,29,251,33,182,231,251,93,247,25,27,11,
+207,29,252,203,252,136,247,56,251,29,235,247,19,5,233,108,247,3,35,251,19,
+26,11,184,10,5,49,121,239,83,247,19,27,11,21,176,82,231,251,24,251,119,251,
+47,251,105,251,81,251,74,247,16,94,247,7,247,23,247,11,217,186,190,30,247,
+9,7,251,9,251,37,86,98,81,27,65,113,203,225,151,141,161,141,154,31,247,70,
+153,247,97,213,247,21,26,251,64,22,65,251,3,80,47,118,30,229,164,188,247,
+15,221,27,178,147,108,111,31,14,184,29,165,247,7,53,247,31,27,11,243,28,250,
+86,35,7,241,243,29,251,11,128,5,35,248,251,243,7,251,5,247,175,29,247,101,
+250,170,5,166,143,164,157,163,27,248,99,247,229,29,251,11,128,5,35,11,21,
+28,251,60,209,10,218,29,11,177,10,14,247,196,10,251,160,248,236,24,248,84,
+248,138,248,141,29,11,186,80,182,55,53,61,67,139,30,251,119,252,137,5,247,
+60,6,247,242,248,64,5,147,151,147,157,164,26,11,196,29,5,41,121,192,251,1,
+247,39,27,11,21,213,74,188,41,248,154,10,57,28,251,131,5,70,132,123,247,221,
+29,237,247,232,247,52,247,89,247,119,155,30,221,28,4,125,5,209,143,155,247,
+80,247,11,27,247,23,251,33,5,246,173,167,215,194,26,14,250,248,181,29,11,
+247,41,29,31,11,248,39,10,211,29,11,53,26,251,33,247,35,73,247,15,247,17,
+247,56,184,247,42,30,11,21,184,29,11,5,188,10,11,247,54,29,217,247,7,176,
+247,33,241,247,198,10,11,28,4,233,250,15,21,204,29,251,42,253,127,11,189,
+10,14,250,74,248,122,21,244,251,93,7,247,13,206,209,208,229,26,247,89,29,
+62,53,59,251,38,70,31,252,30,34,247,64,6,251,5,69,54,47,48,26,251,53,247,
+17,42,247,97,11,5,247,167,6,247,37,249,74,5,227,223,247,0,219,205,27,182,
+166,106,39,118,31,251,41,253,117,104,251,68,108,47,76,93,25,251,46,247,5,
+5,88,125,251,11,100,43,26,77,213,84,247,17,247,191,247,94,247,123,247,122,
+182,30,247,38,249,150,5,145,169,141,168,166,26,14,247,197,10,78,251,247,247,
+162,10,11,247,233,10,251,28,253,101,24,251,173,88,68,247,61,10,247,23,249,
+83,5,157,144,145,152,157,27,11,180,119,98,182,65,27,77,68,108,98,75,31,156,
+211,5,46,248,49,29,247,5,129,251,11,248,151,10,178,173,199,203,194,27,196,
+125,73,90,129,31,47,252,40,5,247,68,6,235,248,54,5,166,157,199,213,217,27,
+174,145,100,63,122,31,11,28,5,0,247,200,10,254,207,35,6,247,4,243,29,251,
+19,128,5,35,249,3,243,7,251,5,247,175,29,247,109,250,215,247,19,29,11,195,
+29,14,21,247,56,10,11,210,29,14,21,247,5,251,177,7,205,29,11,150,251,85,248,
+80,121,184,81,180,57,156,25,207,173,203,211,194,221,215,247,7,167,247,33,
+242,241,247,80,55,24,229,201,188,186,186,26,11,248,47,10,214,10,11,21,193,
+92,180,82,81,94,98,85,86,184,96,197,196,186,182,192,30,92,251,92,21,51,6,
+251,111,98,5,96,7,247,4,127,39,252,167,129,80,110,67,117,104,25,251,19,172,
+5,108,121,114,120,106,26,100,193,109,202,247,76,247,11,247,152,247,17,162,
+30,14,28,6,102,249,7,21,247,243,29,211,251,43,128,251,87,123,72,69,247,109,
+10,212,194,191,8,14,247,162,29,247,55,29,32,215,61,247,50,11,248,42,10,219,
+251,66,251,32,251,16,219,48,247,7,241,157,105,155,109,152,119,247,96,10,134,
+148,134,147,135,149,8,14,21,251,62,6,251,107,251,85,251,34,247,85,5,251,62,
+6,247,50,251,243,5,247,134,6,11,247,11,10,247,244,29,30,251,187,147,124,10,
+11,6,227,248,85,247,100,10,11,21,207,251,77,7,166,247,31,248,170,29,71,251,
+19,251,6,96,5,90,7,237,147,57,252,0,5,135,120,137,123,125,26,73,188,94,241,
+223,247,25,186,151,168,30,207,7,125,98,57,110,96,27,98,119,164,178,147,31,
+223,248,16,5,14,21,247,39,55,247,33,251,102,251,216,251,19,251,218,251,142,
+251,60,235,251,12,247,92,247,191,247,42,247,189,247,171,30,251,92,159,21,
+251,127,251,7,251,177,251,13,126,43,161,247,64,247,123,247,1,247,179,247,
+21,172,213,86,251,31,30,11,251,38,207,102,62,5,133,133,130,138,126,122,65,
+191,48,27,251,16,33,43,61,106,164,81,196,183,189,173,153,147,31,60,217,5,
+157,151,194,156,157,27,170,165,123,115,186,31,223,156,252,75,252,103,247,
+26,71,188,218,5,146,145,149,139,151,11,139,99,136,99,135,30,78,248,38,200,
+7,100,143,100,142,139,26,116,140,135,141,141,154,204,247,200,24,247,252,6,
+74,251,199,136,125,129,135,123,138,25,139,97,136,98,135,30,78,248,40,200,
+7,100,143,99,142,139,26,122,140,131,143,141,152,11,6,247,251,10,11,247,64,
+251,58,247,11,251,156,251,50,32,108,51,251,90,30,75,251,209,5,247,50,6,219,
+247,84,5,219,172,245,178,219,27,213,247,21,86,251,36,251,70,251,52,251,27,
+251,66,125,114,141,143,84,31,108,251,45,5,139,241,157,195,204,11,247,72,156,
+5,247,159,29,227,248,81,222,10,11,21,178,92,190,34,251,148,251,39,251,74,
+251,105,251,34,210,47,247,54,247,19,246,217,190,198,30,247,15,7,251,5,251,
+19,82,90,71,27,55,133,219,215,188,159,247,105,247,42,170,31,213,42,5,247,
+29,154,129,190,170,26,14,247,180,10,251,230,252,83,251,33,248,81,247,94,29,
+11,247,25,251,25,227,251,116,251,23,39,102,76,251,52,30,88,251,142,5,247,
+9,6,147,155,188,247,29,139,26,176,153,247,52,190,176,27,190,217,119,32,251,
+14,37,40,251,13,131,122,141,143,82,31,110,251,31,5,139,233,156,180,11,249,
+187,236,10,41,235,42,247,107,11,6,160,168,129,120,137,31,116,251,45,5,247,
+46,6,233,248,119,5,251,44,6,98,251,40,5,119,133,108,131,119,27,11,240,10,
+247,25,242,174,201,229,31,11,28,5,45,21,247,127,29,247,76,67,251,25,247,178,
+29,11,247,18,10,251,13,251,21,84,178,53,227,207,215,196,160,151,31,251,13,
+247,2,5,168,158,223,159,167,27,186,180,103,100,211,31,247,21,155,11,182,135,
+188,137,139,26,165,137,150,128,132,111,86,251,152,59,251,171,76,45,8,131,
+133,106,77,114,27,251,0,229,5,32,90,58,75,53,209,114,200,247,7,247,7,164,
+247,25,243,31,221,244,223,247,148,215,248,10,8,11,247,173,29,46,248,239,232,
+7,46,147,84,143,139,26,117,134,153,158,144,31,11,145,165,152,146,159,141,
+25,139,196,141,195,145,30,241,252,216,37,7,192,133,195,137,139,26,159,137,
+151,132,133,115,11,250,205,247,64,10,11,144,162,147,145,165,143,25,238,149,
+5,235,252,177,43,7,246,129,163,135,149,133,133,118,25,251,47,253,105,134,
+117,127,133,119,136,25,139,90,135,89,248,105,29,127,145,145,161,25,11,249,
+21,248,238,248,85,29,5,230,10,11,247,246,10,251,60,253,248,5,247,166,6,223,
+248,80,5,11,248,129,29,113,170,215,155,31,11,252,144,252,197,245,10,11,247,
+74,29,245,247,27,184,180,209,248,32,29,11,247,245,29,251,6,251,101,36,251,
+5,47,119,247,48,10,11,239,10,14,250,134,250,218,21,247,115,251,93,229,251,
+87,251,45,251,154,80,251,89,82,184,114,190,170,171,145,151,168,30,246,247,
+67,5,157,173,166,143,176,27,243,174,41,51,251,130,251,119,251,70,251,105,
+78,31,11,248,193,28,5,35,247,5,10,21,138,148,150,139,152,27,247,6,247,24,
+215,247,117,181,31,247,81,176,81,224,251,27,27,119,121,138,137,121,31,154,
+219,247,206,141,129,251,70,100,251,94,25,97,251,116,39,251,6,251,153,128,
+8,11,249,246,21,247,173,10,36,223,49,225,74,30,240,63,206,81,55,247,142,10,
+11,248,139,29,251,111,247,11,29,237,235,184,187,211,31,89,160,194,96,232,
+27,189,204,151,167,218,31,11,28,4,154,205,21,248,25,29,247,48,249,180,5,251,
+164,6,53,252,76,5,251,226,247,246,10,11,28,4,238,247,0,10,11,248,30,29,110,
+196,203,152,31,247,60,249,164,247,172,10,251,25,253,8,248,145,10,11,247,75,
+10,167,247,19,5,247,121,189,247,21,233,243,27,160,200,135,125,155,31,176,
+251,64,5,139,182,120,184,223,205,207,221,30,14,251,166,21,204,106,176,86,
+172,30,251,126,251,79,5,88,86,143,205,221,11,247,244,10,247,99,250,178,145,
+166,164,155,161,142,25,11,21,248,13,29,11,247,82,29,247,50,251,253,151,113,
+115,247,226,29,11,236,7,112,57,63,114,102,27,92,120,166,186,150,31,247,29,
+249,60,143,161,149,148,154,141,25,14,21,239,100,184,39,37,40,61,251,7,30,
+92,253,168,5,247,3,6,235,247,177,247,72,248,187,139,26,251,94,254,253,21,
+231,71,248,129,10,217,207,229,30,11,27,247,48,247,12,251,67,252,22,69,31,
+59,252,82,251,173,52,252,0,233,8,133,124,136,51,139,26,248,67,251,45,248,
+146,247,48,232,248,228,8,248,26,200,251,78,247,126,251,232,27,11,250,7,21,
+198,96,221,251,34,251,211,251,44,251,68,251,115,94,30,251,19,253,5,5,247,
+167,6,247,17,248,254,5,247,42,169,170,243,219,27,247,19,251,14,5,203,145,
+235,167,238,26,11,21,70,94,248,121,29,212,198,215,207,184,92,73,30,67,247,
+140,10,28,4,162,28,5,41,21,247,11,36,208,251,152,252,25,251,45,251,230,251,
+0,116,30,251,115,254,187,223,29,11,21,215,88,171,67,251,50,62,251,55,251,
+30,251,49,247,2,251,30,247,42,96,30,188,217,5,63,186,59,207,235,26,170,149,
+168,148,167,30,247,13,6,177,178,166,196,197,26,14,248,115,29,163,100,248,
+40,10,159,100,56,123,31,56,123,105,100,251,12,27,251,37,6,125,70,5,14,249,
+5,28,5,164,21,247,28,10,6,39,252,148,135,115,123,133,114,137,25,139,75,135,
+76,132,30,37,11,247,113,29,185,247,13,58,247,1,66,198,8,251,21,6,196,90,206,
+57,101,41,248,72,10,11,249,25,28,5,78,21,247,34,29,21,247,158,251,54,247,
+29,251,144,247,113,10,11,247,59,10,247,105,250,210,24,143,157,147,149,164,
+142,11,121,247,15,10,11,27,248,109,247,35,247,163,247,78,247,70,251,35,223,
+251,39,213,31,247,124,10,11,247,48,10,248,90,29,11,112,251,15,32,247,31,10,
+11,144,166,162,155,165,248,138,29,252,250,35,7,241,129,161,136,158,123,134,
+112,25,71,251,246,5,141,106,99,143,107,27,252,27,251,113,251,60,251,172,85,
+31,11,247,209,29,251,83,251,56,11,86,139,30,178,248,75,29,11,248,6,29,251,
+42,253,134,24,252,35,249,214,247,228,29,11,21,237,73,186,47,251,3,39,43,251,
+2,102,153,104,166,114,30,247,17,6,114,251,49,251,17,44,251,43,117,120,39,
+24,247,124,155,247,183,247,170,247,130,26,14,251,27,247,48,29,251,189,28,
+250,2,133,115,131,135,113,137,25,251,13,128,5,36,248,246,241,7,251,23,151,
+103,142,133,151,142,155,25,11,207,57,198,33,251,1,60,110,92,81,30,251,80,
+251,47,157,251,54,251,27,251,50,121,119,32,53,67,120,236,248,119,24,143,166,
+163,155,164,142,247,9,149,24,243,11,71,27,252,37,251,113,252,3,251,199,251,
+127,245,251,36,247,111,213,223,166,186,221,31,11,28,5,221,249,234,21,248,
+89,29,248,16,10,248,173,247,158,248,103,248,56,30,251,211,22,11,28,4,209,
+247,200,10,254,171,248,182,29,251,29,128,5,35,248,160,7,248,103,11,247,77,
+29,251,31,253,83,247,211,10,247,125,10,251,14,6,163,247,37,233,247,3,247,
+34,186,8,14,248,43,29,233,247,46,176,174,211,31,11,5,153,208,150,211,209,
+26,247,78,77,247,66,251,162,251,23,251,5,73,37,94,162,86,231,106,30,247,45,
+247,35,5,191,153,88,113,77,127,78,126,77,31,11,247,145,29,110,251,30,5,247,
+33,6,247,232,207,5,211,7,251,64,155,11,248,238,251,125,21,247,27,251,218,
+7,158,229,247,129,29,247,79,10,31,11,202,69,10,248,63,10,247,15,6,114,247,
+191,29,14,251,25,249,234,5,164,135,157,145,162,27,139,188,139,182,141,30,
+243,252,187,35,7,174,137,184,137,139,26,161,160,135,112,143,31,247,93,28,
+251,12,5,11,247,199,247,42,247,62,247,50,239,51,219,46,211,31,247,134,10,
+11,21,222,222,251,27,247,27,247,25,247,25,56,222,251,25,251,25,251,26,247,
+26,56,56,247,27,251,26,251,29,251,28,222,56,247,28,247,28,5,14,21,251,47,
+94,251,19,38,133,251,2,153,247,13,162,139,163,145,166,30,139,176,247,70,145,
+170,30,151,157,172,155,159,27,247,21,152,86,251,3,31,11,27,162,162,140,140,
+162,31,251,79,252,14,5,247,16,6,247,84,248,24,245,153,226,164,203,172,25,
+234,7,84,117,71,121,64,131,247,247,249,95,24,11,202,247,43,29,11,5,251,37,
+186,251,30,247,19,247,51,26,247,62,247,68,247,148,247,48,251,10,30,176,251,
+67,5,127,168,169,133,168,27,227,190,203,225,31,14,247,133,10,247,118,28,4,
+112,143,166,163,155,164,142,25,11,21,247,149,10,251,111,247,161,10,11,247,
+83,247,56,247,11,247,23,195,100,225,51,71,63,81,119,125,31,247,15,251,3,5,
+108,121,55,121,110,27,92,98,176,178,65,31,251,21,122,11,81,189,247,112,204,
+247,67,247,4,174,247,64,8,247,86,178,251,48,247,70,251,223,27,251,219,251,
+137,251,61,251,157,84,31,68,251,239,248,216,11,21,202,92,166,82,71,71,86,
+69,116,150,117,155,125,30,221,6,125,40,53,86,46,127,127,77,24,247,36,150,
+247,84,247,49,247,42,26,14,21,247,32,68,247,47,94,107,251,50,8,251,69,103,
+251,39,71,48,27,251,39,33,247,19,247,28,167,31,160,244,213,225,247,33,204,
+8,14,51,247,48,24,251,19,135,100,40,72,26,81,188,41,247,58,247,140,247,62,
+247,95,247,129,247,29,30,247,21,247,114,244,247,143,198,247,23,11,247,188,
+10,248,254,241,7,84,146,76,248,46,10,11,251,134,6,253,138,28,250,244,251,
+11,126,5,37,248,163,241,7,88,143,83,146,139,26,113,141,126,147,152,159,247,
+94,248,11,24,248,23,6,11,247,119,29,251,87,251,72,251,68,251,36,123,11,247,
+92,236,241,234,199,82,187,78,182,31,82,180,78,185,189,26,171,142,184,192,
+159,153,134,139,30,208,32,5,220,144,170,163,195,26,14,251,238,252,146,248,
+40,29,31,11,28,6,66,28,5,143,21,251,42,247,225,29,11,248,93,29,247,21,247,
+97,219,160,184,30,248,26,29,11,43,252,138,159,246,109,251,56,247,115,29,11,
+248,1,29,193,247,167,5,247,128,10,11,7,251,123,251,232,5,247,62,6,247,123,
+247,232,5,11,241,7,79,146,78,143,139,26,112,141,127,145,143,161,11,21,251,
+44,6,242,248,148,5,251,36,6,252,172,252,143,118,34,5,248,46,248,94,10,247,
+41,6,11,251,27,251,11,27,108,80,158,161,31,247,150,251,60,7,69,251,248,5,
+125,168,241,83,247,74,27,248,40,229,247,128,247,215,198,31,11,21,251,136,
+251,15,251,43,251,148,247,250,10,247,37,221,73,251,64,31,14,252,214,254,76,
+5,247,185,6,247,255,248,234,219,251,248,5,251,36,171,217,251,15,247,54,27,
+247,5,247,133,160,247,52,31,14,248,50,21,248,22,10,11,5,132,248,158,10,246,
+247,15,172,190,235,30,247,3,7,96,45,59,121,104,27,90,129,192,186,147,31,11,
+22,251,248,251,100,252,40,251,133,251,27,251,34,247,38,247,174,248,5,247,
+97,248,29,247,136,247,33,247,28,251,48,251,166,30,11,247,126,247,19,251,99,
+6,205,247,203,5,251,34,247,48,29,107,251,48,5,251,83,251,19,247,56,6,11,154,
+251,183,21,248,59,29,248,234,248,65,10,11,21,78,251,193,151,202,119,43,8,
+123,120,92,83,84,27,57,143,213,204,247,34,215,247,76,247,64,153,147,88,131,
+137,31,14,251,128,21,191,111,198,51,83,111,125,88,94,30,251,173,251,204,5,
+247,35,6,247,222,247,75,5,170,155,161,182,163,26,14,59,42,111,148,108,153,
+115,30,247,15,6,112,251,36,45,251,2,251,31,91,159,62,24,247,97,196,247,109,
+247,87,247,117,26,11,92,50,80,78,51,125,235,248,119,24,251,15,247,130,29,
+248,110,10,11,139,84,135,86,132,30,37,248,194,241,7,85,146,84,143,139,26,
+113,141,128,143,142,163,206,248,1,24,137,164,172,139,160,27,11,158,247,38,
+5,147,145,202,176,178,27,213,176,87,55,251,74,251,52,78,251,13,135,31,38,
+232,7,171,234,137,251,2,251,62,11,5,247,64,173,74,247,9,248,127,10,11,21,
+227,67,209,51,51,70,69,51,51,208,67,227,227,211,211,227,30,11,248,110,29,
+247,198,29,11,250,150,249,17,248,56,10,11,247,78,41,247,93,251,107,251,0,
+44,88,114,96,11,21,253,44,6,88,251,152,5,229,6,182,247,5,5,248,9,6,252,195,
+253,70,5,247,58,6,145,176,248,216,249,94,5,11,69,47,178,247,72,251,54,31,
+251,99,7,53,219,237,98,247,15,27,247,164,247,138,234,247,141,236,80,202,251,
+27,168,31,11,137,201,5,118,98,108,127,100,27,125,114,151,180,148,31,212,247,
+220,5,241,164,94,205,251,23,27,59,69,116,108,86,31,11,248,164,248,139,247,
+72,156,5,247,159,29,11,6,157,170,127,123,135,31,119,251,46,5,247,43,6,233,
+248,117,5,251,41,6,96,251,35,5,118,133,108,129,118,27,11,21,251,4,252,199,
+5,89,83,82,68,57,27,39,112,235,247,39,247,220,247,87,247,117,247,66,168,182,
+55,111,132,31,11,24,135,111,127,135,108,137,8,247,167,29,11,247,179,10,251,
+33,182,231,251,93,247,25,27,11,123,106,174,82,106,26,108,69,86,139,30,176,
+248,75,29,152,166,192,151,168,30,11,250,162,28,4,195,21,247,51,251,99,168,
+251,12,251,171,251,164,251,70,251,193,251,60,247,17,251,27,247,51,104,30,
+11,28,4,231,250,164,21,248,87,29,30,247,112,10,11,21,251,47,251,48,92,251,
+17,130,30,139,125,137,124,30,219,248,3,5,174,6,190,143,247,36,112,251,23,
+26,14,247,139,190,31,251,136,247,51,21,251,213,6,248,39,248,50,5,11,200,71,
+184,57,55,98,116,105,96,30,11,5,150,141,147,153,154,27,139,190,143,202,143,
+30,231,252,152,47,7,197,135,184,137,139,26,157,137,143,135,135,118,11,21,
+170,247,51,5,251,108,247,201,10,251,103,97,11,25,84,176,227,81,247,200,29,
+248,25,10,11,247,81,26,247,4,72,225,251,15,251,7,56,57,41,119,143,119,146,
+118,30,247,82,153,5,148,130,143,126,121,26,11,133,248,45,10,84,247,253,10,
+145,163,11,135,113,118,133,114,137,25,139,85,134,92,135,30,37,248,192,241,
+7,89,146,83,143,139,26,116,141,123,143,142,163,11,143,163,151,247,126,10,
+11,144,163,152,247,126,29,11,248,37,10,143,176,141,164,31,247,165,161,247,
+209,247,15,247,107,26,11,248,7,29,59,252,41,24,129,102,65,120,86,27,45,251,
+152,11,28,5,20,22,252,240,28,5,190,253,64,28,250,66,5,250,134,247,7,21,253,
+236,6,248,91,250,94,5,14,44,147,92,143,139,26,117,126,153,158,143,31,11,5,
+49,120,123,122,118,27,45,247,54,5,67,109,92,97,47,26,53,213,84,220,247,21,
+216,211,247,74,176,30,11,21,76,89,251,13,251,78,251,60,92,247,31,227,215,
+170,208,229,174,30,247,121,39,5,215,104,164,98,92,26,11,27,245,247,26,189,
+245,247,2,31,74,170,200,48,247,5,27,235,247,7,180,240,243,31,126,143,125,
+146,129,30,11,247,165,10,150,247,14,147,247,5,11,125,125,83,130,125,135,251,
+23,247,75,24,41,61,61,45,55,223,69,245,247,240,247,83,247,35,247,157,190,
+31,11,243,252,195,35,7,178,137,186,137,139,26,174,137,151,137,141,112,244,
+28,251,12,24,247,115,6,248,82,250,64,11,252,188,248,57,29,11,252,15,251,102,
+251,224,251,213,251,120,247,21,251,60,247,172,11,5,251,46,6,41,251,162,133,
+124,129,123,118,137,25,127,115,51,120,81,27,251,68,251,93,247,15,247,203,
+11,21,251,48,62,37,40,81,30,55,88,45,127,59,141,247,17,249,6,24,174,6,247,
+72,233,51,251,53,31,11,110,137,113,137,110,30,253,112,6,247,171,211,247,70,
+247,127,247,81,27,247,33,247,48,251,48,251,166,31,11,247,191,10,247,123,247,
+51,211,248,0,11,250,140,249,177,21,247,8,100,225,251,171,30,252,189,41,6,
+180,137,184,135,139,26,168,137,145,131,135,120,11,246,251,21,182,57,251,144,
+251,70,251,97,251,121,59,30,57,6,221,248,33,5,251,125,6,57,252,33,5,11,251,
+17,21,251,64,6,251,107,251,84,251,31,247,84,5,251,62,6,247,50,251,242,5,247,
+133,6,14,249,214,248,99,10,251,156,22,28,8,110,251,67,28,247,146,7,14,5,251,
+168,85,70,251,17,247,205,10,11,27,248,9,247,103,247,216,247,214,31,251,187,
+147,21,248,82,29,11,32,190,251,70,207,247,35,247,202,10,11,116,215,5,251,
+95,83,251,111,251,88,251,116,26,47,186,68,238,233,229,219,237,165,131,170,
+124,164,30,11,248,127,29,252,254,37,7,196,133,198,135,139,26,168,137,153,
+134,135,115,11,243,7,47,150,114,141,123,155,143,166,25,225,248,68,176,135,
+182,116,149,117,25,247,105,252,105,5,65,11,248,143,10,87,100,83,27,75,11,
+5,176,179,225,213,197,27,247,0,154,251,30,251,6,31,11,154,215,247,172,29,
+11,204,94,219,251,31,33,57,110,92,81,30,11,5,73,123,186,47,247,25,27,225,
+204,160,175,199,31,123,143,157,98,229,27,217,235,170,157,176,31,11,6,247,
+1,247,56,251,3,251,195,79,31,247,42,6,223,248,56,36,153,104,145,133,164,145,
+172,25,11,51,207,45,216,223,247,187,10,11,133,112,113,247,206,29,145,168,
+25,11,143,166,166,162,171,141,25,247,15,145,5,245,253,15,33,7,247,13,133,
+180,137,156,116,135,112,25,11,251,96,27,32,251,15,88,71,39,31,248,23,10,11,
+241,7,82,146,77,143,139,26,113,141,124,143,143,163,247,103,250,210,24,144,
+157,145,147,157,141,8,11,21,251,43,53,251,64,45,108,80,186,247,19,247,58,
+235,247,47,219,174,198,88,251,13,30,14,252,78,21,43,43,92,55,59,80,196,219,
+229,190,174,194,194,30,213,102,247,31,102,39,26,14,6,247,76,247,9,82,233,
+253,15,252,44,5,53,7,249,15,252,43,196,233,251,76,247,9,5,11,248,18,10,113,
+98,159,79,27,84,80,72,67,11,28,5,12,247,48,21,239,57,186,47,137,30,251,6,
+251,99,5,251,1,118,247,1,225,119,31,11,52,189,36,27,33,92,89,89,129,31,130,
+96,151,105,139,26,247,4,6,170,129,150,118,133,107,11,247,238,29,117,141,120,
+155,145,166,25,11,248,140,29,247,9,149,5,248,66,29,11,250,111,21,251,30,6,
+247,26,252,129,251,226,252,130,5,247,30,6,248,29,248,79,160,242,5,11,208,
+173,219,211,192,221,217,247,7,176,247,33,241,247,198,10,11,238,7,135,119,
+251,40,100,129,247,250,29,11,7,248,74,29,11,137,167,176,139,162,27,248,45,
+247,150,247,107,247,211,11,248,113,29,248,96,10,31,11,247,47,168,251,70,251,
+11,166,31,251,107,184,198,251,11,247,144,248,136,29,11,21,215,55,192,55,251,
+35,251,31,251,74,251,36,44,30,247,91,80,69,247,19,251,19,27,11,251,255,251,
+98,251,214,251,215,251,126,247,31,251,56,247,160,248,83,247,14,248,34,247,
+123,11,28,7,255,28,4,248,247,233,29,11,143,166,163,155,164,141,247,3,150,
+24,248,66,10,11,28,4,168,248,52,29,252,38,78,7,174,136,178,137,139,26,161,
+138,148,135,136,125,11,248,27,247,210,10,14,248,134,29,247,101,250,178,143,
+166,166,155,161,142,25,14,6,124,121,5,164,92,76,157,80,27,11,5,247,181,10,
+11,22,247,30,6,251,27,248,129,247,227,248,130,5,251,30,6,252,30,252,79,118,
+36,5,11,27,247,25,242,174,201,229,31,110,145,166,71,247,33,248,43,10,11,88,
+88,8,251,33,7,247,45,247,41,246,203,247,228,251,11,247,25,92,186,110,247,
+54,11,139,78,135,83,132,30,37,249,13,241,7,72,146,73,143,139,26,112,141,123,
+143,143,163,11,139,80,135,81,132,30,37,248,197,241,7,80,146,80,143,139,26,
+110,141,127,143,143,163,11,247,181,10,236,11,178,163,176,180,170,184,188,
+213,174,247,1,196,248,142,10,248,51,10,11,251,142,247,185,29,11,21,217,7,
+253,170,247,135,249,170,247,136,5,217,7,254,9,251,175,5,61,7,14,5,251,34,
+6,251,230,71,5,70,7,247,64,120,11,191,59,245,251,62,251,111,251,87,251,15,
+251,84,11,241,252,255,248,8,10,11,143,157,147,149,164,142,25,11,28,4,250,
+21,247,25,251,43,176,251,1,33,251,119,90,251,34,88,184,121,184,163,11,21,
+251,142,251,9,251,152,251,35,102,34,211,247,113,247,132,247,3,247,182,247,
+82,11,27,251,15,143,247,17,247,0,247,126,247,11,247,201,247,154,162,153,53,
+127,135,31,11,248,33,29,247,43,247,183,190,170,31,11,28,6,6,248,68,10,241,
+252,215,37,7,247,12,131,170,137,141,120,131,129,25,11,248,62,10,251,68,237,
+251,87,247,129,227,11,254,42,248,19,10,106,144,148,153,11,251,70,105,83,130,
+99,27,129,6,211,248,14,206,126,170,117,109,251,48,25,14,248,68,10,247,174,
+10,153,132,135,115,11,6,155,237,156,247,105,247,2,238,247,21,251,13,24,247,
+36,159,170,201,200,26,11,21,251,85,96,36,251,60,251,2,27,92,44,219,247,103,
+161,141,164,141,162,31,11,26,191,143,214,221,170,161,131,139,30,244,248,163,
+10,11,247,103,6,251,103,254,241,248,60,29,11,82,65,59,73,33,127,235,248,123,
+24,145,166,164,155,161,142,247,11,149,24,243,11,251,23,115,21,247,251,29,
+11,251,47,27,99,109,144,146,93,31,251,8,7,180,127,199,128,180,140,247,148,
+146,11,200,49,247,46,251,93,251,242,251,131,251,248,251,204,251,195,247,84,
+61,247,70,11,229,247,5,225,31,182,81,174,70,172,49,247,43,239,24,98,241,88,
+238,63,208,11,150,117,141,120,155,146,166,25,247,98,250,178,146,166,163,155,
+164,142,25,14,5,168,6,247,103,137,247,121,94,251,230,26,11,79,146,84,141,
+139,26,123,141,128,141,129,159,11,251,31,248,49,10,247,76,123,11,241,247,
+95,251,17,24,229,203,190,157,236,26,11,251,66,70,5,55,7,247,39,155,11,28,
+5,94,21,11,6,247,56,249,220,5,251,124,6,253,213,253,232,112,251,39,5,248,
+252,6,11,26,247,58,247,50,237,245,215,247,7,86,125,30,130,251,105,5,247,48,
+6,11,247,99,251,5,215,247,23,5,151,147,155,139,158,165,247,7,51,247,31,27,
+11,247,132,247,240,10,11,251,24,27,99,103,145,147,107,31,49,7,174,130,197,
+126,180,140,247,170,146,11,248,35,29,124,147,146,167,25,11,247,220,10,31,
+11,203,100,167,79,70,69,84,65,135,30,125,252,115,5,215,6,169,225,247,42,11,
+247,9,160,147,247,91,247,35,27,247,38,251,32,5,196,150,207,182,237,26,11,
+247,37,247,232,10,11,247,232,10,14,7,167,247,31,248,170,29,71,251,19,251,
+5,98,5,89,7,235,148,11,28,7,174,248,207,21,225,7,253,15,248,44,82,45,247,
+76,251,9,5,11,251,189,251,162,251,77,233,33,247,81,247,197,247,35,247,191,
+247,162,30,11,47,252,82,5,247,123,6,231,248,82,5,215,6,133,99,135,98,100,
+26,11,99,5,97,7,247,4,129,251,9,252,158,5,247,69,6,234,248,52,5,11,251,35,
+6,137,135,88,251,62,139,26,117,133,120,130,113,27,251,169,6,11,139,78,135,
+77,248,79,29,104,141,11,150,117,141,119,248,12,10,165,155,163,142,25,11,164,
+247,15,245,247,12,247,21,248,128,29,11,172,190,237,30,251,203,28,5,15,21,
+59,252,50,5,252,68,6,155,237,11,209,143,156,247,80,247,10,27,247,23,251,33,
+5,246,173,168,215,194,26,11,237,235,184,187,211,31,79,165,199,106,225,27,
+243,247,5,189,175,233,31,11,139,30,247,1,7,106,41,76,113,96,27,106,120,155,
+186,148,31,14,112,115,123,114,137,25,251,19,128,5,35,11,5,251,97,6,35,251,
+103,11,248,53,29,251,17,253,5,11,5,124,64,129,57,63,26,251,85,213,251,78,
+247,193,231,246,176,227,11,6,227,248,85,143,163,151,248,127,29,11,6,44,252,
+91,5,232,6,195,247,169,5,249,9,6,83,251,169,5,11,21,193,92,180,81,82,94,98,
+85,86,184,96,196,197,186,182,192,30,11,21,248,4,10,11,21,248,5,10,11,21,59,
+63,65,57,80,92,182,201,219,217,213,219,200,184,96,77,30,11,21,185,112,167,
+93,95,109,109,95,94,169,110,183,185,166,166,186,30,11,27,251,7,251,134,119,
+251,52,39,221,94,231,31,247,7,247,99,5,11,121,117,27,251,181,6,114,121,157,
+166,145,31,247,99,250,172,145,166,11,28,5,106,21,213,71,188,43,248,154,10,
+11,252,44,249,15,5,53,6,252,44,253,15,234,81,247,8,247,77,5,11,247,218,247,
+195,247,91,247,189,247,105,251,36,247,23,251,119,165,31,11,205,245,215,63,
+157,82,149,30,251,21,251,23,5,106,144,94,169,176,11,238,159,247,19,251,14,
+24,203,145,235,167,238,26,198,96,221,251,34,11,21,252,54,6,121,37,5,247,207,
+6,72,251,228,5,241,6,14,150,116,141,121,155,145,166,25,11,122,59,82,59,26,
+61,11,6,227,248,101,5,251,33,6,251,218,71,5,68,7,247,56,122,11,6,77,251,195,
+5,245,6,196,247,38,5,169,151,146,148,164,27,11,248,115,10,229,247,20,62,251,
+31,11,27,252,179,251,216,252,72,252,58,251,171,247,44,251,195,248,97,11,30,
+248,22,29,11,69,251,250,5,247,52,6,217,247,109,5,157,145,171,150,158,27,11,
+113,160,118,165,165,161,160,165,165,117,161,113,113,118,117,113,30,11,248,
+46,29,80,143,139,26,110,141,125,143,11,135,248,122,10,248,160,7,248,103,11,
+248,60,10,116,137,25,11,168,247,19,162,31,156,236,251,13,177,139,26,251,59,
+251,27,5,11,191,182,182,191,191,96,182,87,87,96,96,87,87,182,96,191,31,11,
+203,86,218,251,36,251,50,251,64,88,251,54,251,6,30,102,88,11,215,76,201,63,
+63,78,77,63,64,200,77,215,215,202,201,214,30,11,234,63,216,45,45,61,62,44,
+45,217,63,233,233,215,215,233,30,11,248,143,29,196,133,203,135,139,26,165,
+137,154,134,135,115,11,243,252,207,35,7,211,129,161,134,158,125,135,112,25,
+48,252,94,11,6,251,117,100,5,95,7,247,9,129,11,37,7,193,133,200,137,139,26,
+172,137,11,247,105,247,5,238,247,19,251,13,24,11,251,7,251,197,78,31,247,
+41,6,244,11,254,182,37,6,194,133,200,135,139,26,11,155,144,166,25,247,93,
+250,178,144,166,11,233,248,113,144,158,145,149,157,141,25,11,252,132,37,6,
+188,133,194,135,139,26,162,137,155,134,135,115,11,6,223,248,64,145,166,164,
+155,161,142,25,247,13,149,5,243,11,248,95,10,251,132,248,17,11,26,251,208,
+252,105,21,251,40,55,65,251,72,30,74,6,214,11,26,43,98,78,57,84,55,161,180,
+110,30,176,247,13,5,168,11,43,129,5,43,248,82,235,7,105,143,98,141,139,26,
+120,141,11,247,93,6,157,163,130,121,138,31,130,251,111,5,247,35,6,11,252,
+227,37,6,196,133,200,135,139,26,166,137,153,132,133,117,11,251,45,6,55,251,
+154,5,122,133,108,127,118,27,251,252,6,11,164,247,11,5,251,34,6,251,228,248,
+136,10,11,176,57,251,17,184,251,76,27,251,251,251,109,251,82,251,155,11,247,
+1,7,248,76,10,11,239,66,168,77,149,30,251,21,251,31,5,92,104,196,192,184,
+11,248,66,248,67,29,190,28,4,216,21,52,248,80,252,203,226,249,34,7,14,248,
+220,251,196,21,249,34,52,252,203,252,80,52,7,14,5,69,125,223,51,247,29,27,
+247,3,233,170,199,231,31,11,252,158,251,217,21,247,25,247,4,251,25,247,5,
+5,65,11,248,152,10,59,70,50,251,43,11,254,150,6,65,252,9,5,247,64,6,204,247,
+110,5,159,11,115,116,26,45,219,77,247,27,245,247,15,172,190,238,30,11,127,
+27,251,27,131,5,71,248,109,207,7,39,147,124,141,11,251,54,247,193,248,118,
+29,11,251,87,251,117,57,74,51,27,251,7,100,243,247,34,161,11,247,228,6,88,
+251,154,5,41,121,192,251,1,247,39,27,11,192,61,223,251,43,251,224,251,7,251,
+244,251,95,98,30,11,205,251,69,27,251,25,6,126,70,5,247,37,6,247,12,11,248,
+7,28,7,155,5,251,47,6,252,7,28,248,101,5,11,5,248,110,10,182,178,11,27,247,
+9,247,43,191,169,194,31,11,251,248,27,108,96,135,137,106,31,11,113,120,135,
+113,137,25,139,77,135,11,143,139,26,114,141,121,143,143,163,11,247,15,176,
+247,25,242,247,33,26,11,5,131,166,177,130,189,27,11,6,251,238,74,5,65,7,11,
+143,157,152,149,157,142,25,11,215,192,172,194,185,26,11,5,96,126,251,18,86,
+251,9,27,36,40,199,247,20,11,5,247,244,6,162,164,133,119,31,251,66,247,55,
+7,11,6,251,207,71,5,68,7,247,46,122,81,251,187,5,11,21,251,42,6,28,251,93,
+28,250,113,5,247,41,6,11,21,248,96,10,30,11,37,7,194,133,201,135,139,26,172,
+137,149,134,135,115,11,110,26,251,72,235,251,52,247,155,247,29,245,227,205,
+11,247,174,248,5,247,117,248,29,247,136,247,33,247,48,11,136,157,123,133,
+112,25,251,99,254,178,133,112,115,123,11,254,207,35,6,247,4,248,88,10,11,
+148,112,98,155,88,27,252,50,251,98,252,1,251,205,11,231,94,208,41,45,49,60,
+42,111,147,108,151,114,30,11,247,25,7,252,212,247,141,104,48,248,42,251,55,
+5,11,248,167,10,126,153,144,166,11,243,252,234,35,7,243,128,162,137,157,123,
+135,112,25,11,21,166,247,22,5,251,240,6,112,251,22,5,14,28,4,248,21,11,5,
+251,36,6,251,230,71,5,68,7,247,68,120,11,5,251,29,6,251,230,74,5,67,7,247,
+62,121,11,5,251,33,6,251,226,71,5,66,7,247,62,120,11,8,87,119,92,111,91,27,
+112,104,174,155,120,31,11,21,252,27,251,117,251,239,251,253,138,30,35,6,11,
+27,90,127,192,186,149,31,247,144,28,5,20,5,11,57,252,54,248,161,29,11,92,
+251,7,88,128,137,27,69,96,240,245,80,31,11,117,106,137,25,251,15,132,5,33,
+249,15,245,7,11,127,70,128,71,73,26,251,76,213,251,66,247,204,11,137,162,
+27,247,209,247,209,247,33,247,209,247,45,11,247,218,6,161,164,133,119,31,
+251,89,247,58,7,11,227,225,247,1,219,202,27,182,166,106,39,118,31,11,241,
+252,139,35,7,186,137,194,139,139,26,155,137,11,5,167,6,247,17,247,62,112,
+251,123,31,14,21,251,17,6,63,252,13,5,247,17,6,14,248,114,10,14,248,13,251,
+164,247,41,252,60,11,41,251,33,106,30,247,42,176,11,129,164,136,157,123,133,
+112,25,11,156,221,31,251,21,6,120,55,11,193,7,251,86,200,5,41,6,11,6,106,
+251,57,5,11,5,133,248,158,10,11,5,47,6,251,112,99,5,97,7,247,4,128,11,6,88,
+251,148,5,247,62,6,190,247,148,5,11,252,142,251,191,252,78,252,62,251,224,
+247,111,11,247,64,35,247,107,251,112,68,57,112,100,65,11,27,104,129,151,194,
+149,31,247,50,249,199,5,11,30,67,132,5,72,248,41,206,7,64,146,5,11,252,164,
+21,28,8,110,251,67,28,247,146,7,11,247,93,46,247,86,247,52,247,167,213,247,
+95,11,84,143,98,141,139,26,127,141,124,158,141,149,11,98,143,94,143,139,26,
+127,128,154,153,135,31,11,251,27,6,251,232,71,5,66,7,247,68,120,11,133,112,
+115,123,114,137,25,251,9,128,5,35,11,139,92,137,96,137,30,41,248,156,7,247,
+208,11,145,121,27,77,86,99,73,251,3,247,54,113,11,153,162,149,156,30,167,
+247,19,5,147,156,180,11,229,32,24,247,31,143,242,192,215,55,192,55,11,247,
+126,186,247,111,247,103,247,138,26,14,247,164,6,225,248,56,11,251,50,251,
+15,251,45,11,5,247,164,6,11,6,28,251,95,28,250,113,5,247,41,6,11,21,251,19,
+6,66,252,13,5,247,17,6,11,24,247,27,221,247,55,247,60,247,44,27,11,26,35,
+246,104,227,192,241,180,162,191,30,11,27,139,76,135,73,132,30,37,248,240,
+7,11,31,247,221,202,251,74,247,58,251,175,27,11,43,69,49,65,66,213,71,247,
+19,247,240,11,247,92,247,191,247,52,247,199,247,171,30,11,28,5,45,21,49,247,
+113,251,64,251,109,11,112,115,123,114,137,25,251,29,128,5,35,11,248,159,10,
+237,11,125,100,135,8,139,78,134,81,135,30,37,11,134,112,25,251,93,254,178,
+134,112,113,123,11,143,127,133,124,127,137,25,53,131,5,43,11,251,97,27,251,
+13,251,0,96,88,57,31,11,209,51,51,67,69,51,51,211,67,227,227,11,219,41,51,
+71,65,49,51,205,61,227,229,11,247,13,247,127,5,247,17,237,82,251,30,11,227,
+251,97,24,247,21,157,212,189,243,26,11,247,34,47,251,19,5,137,133,106,131,
+131,11,243,7,47,247,175,29,11,21,247,5,28,251,52,251,5,7,14,27,190,229,53,
+251,92,31,11,71,5,70,7,247,64,122,11,135,112,115,123,114,137,25,11,143,157,
+149,152,158,141,25,11,143,160,147,153,166,141,25,11,145,147,156,154,153,141,
+25,11,254,210,24,133,113,123,135,11,204,247,19,45,24,11,251,164,6,81,251,
+187,5,251,11,113,11,5,251,50,105,69,251,5,251,56,27,11,5,251,3,115,212,251,
+46,247,95,27,11,6,251,117,100,5,94,7,247,8,128,11,21,251,132,251,27,251,197,
+251,64,102,11,21,252,21,6,103,34,5,247,165,6,11,27,247,155,247,57,247,23,
+246,196,31,11,27,247,31,236,247,5,247,33,200,31,11,252,159,5,247,70,6,234,
+248,52,5,11,247,84,5,154,102,92,155,106,27,55,11,248,70,247,217,247,125,248,
+105,228,31,11,251,232,251,52,251,88,251,122,123,30,11,251,2,31,178,248,92,
+21,251,19,59,11,96,251,23,31,102,253,30,21,251,111,11,98,211,247,57,247,218,
+247,83,247,115,11,112,137,115,116,26,45,219,77,247,27,11,123,114,90,104,112,
+27,90,102,167,191,11,247,165,6,144,247,16,5,251,146,6,11,139,90,137,86,135,
+30,47,249,224,7,11,153,84,27,51,110,80,90,112,162,96,11,251,70,5,247,17,147,
+186,180,231,26,11,252,56,6,139,203,251,27,251,19,26,11,247,9,24,84,100,100,
+80,85,26,90,11,247,21,7,77,251,27,67,105,67,27,11,241,7,82,143,96,146,139,
+26,110,141,11,6,252,58,251,62,176,45,5,14,5,247,44,6,11,248,12,29,14,247,
+65,29,251,99,11,248,169,244,10,11,249,146,244,10,11,247,30,29,14,247,58,10,
+241,7,11,254,182,248,57,29,11,247,19,29,14,247,92,10,14,5,247,253,29,11,247,
+59,29,251,7,128,5,35,11,31,252,222,252,17,65,29,5,247,93,29,84,176,227,81,
+213,27,11,247,175,10,247,23,151,5,247,174,10,11,5,150,29,11,115,51,252,87,
+24,252,189,247,229,10,11,247,227,10,248,43,29,11,247,226,29,248,251,241,7,
+247,196,10,11,174,10,14,247,250,29,251,111,247,161,10,11,124,10,247,143,11,
+247,53,10,248,13,10,11,248,186,29,251,11,128,5,35,11,250,3,21,248,47,29,30,
+247,114,29,251,72,11,5,247,64,173,74,247,9,247,148,29,11,222,29,174,247,38,
+11,247,226,10,248,188,29,11,154,29,221,248,39,5,11,247,24,10,67,251,248,247,
+173,29,11,131,10,58,247,190,42,10,115,51,252,87,24,252,189,204,10,11,6,53,
+252,76,5,251,226,227,10,247,228,6,88,251,154,11,131,10,185,248,201,34,29,
+247,15,10,14,71,10,248,139,28,5,172,44,29,62,29,248,106,248,62,80,29,119,
+10,14,138,10,247,245,29,11,174,29,248,56,22,174,29,14,154,29,247,64,249,221,
+5,251,31,247,48,29,251,166,28,250,182,248,42,10,11,67,29,14,62,29,248,131,
+248,176,48,29,133,110,137,8,208,29,11,67,10,251,11,205,42,10,94,10,247,138,
+252,105,124,29,251,176,248,177,24,248,164,248,139,11,66,29,123,247,235,34,
+29,86,10,247,117,248,180,34,29,80,10,76,248,243,48,29,148,29,14,67,10,251,
+7,248,22,37,10,55,29,14,};
+#endif
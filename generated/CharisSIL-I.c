@@ -0,0 +1,6698 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_CharisSIL_I_cff_size = 143716;
+asm(".section .rodata");
+asm(".global fz_font_CharisSIL_I_cff");
+asm(".type fz_font_CharisSIL_I_cff STT_OBJECT");
+asm(".size fz_font_CharisSIL_I_cff, 143716");
+asm(".balign 64");
+asm("fz_font_CharisSIL_I_cff:");
+asm(".incbin \"resources/fonts/sil/CharisSIL-I.cff\"");
+#else
+const int fz_font_CharisSIL_I_cff_size = 143716;
+const char fz_font_CharisSIL_I_cff[] = {
+1,0,4,3,0,1,1,1,17,67,104,97,114,105,115,83,73,76,45,73,116,97,108,105,99,
+0,1,1,1,96,248,16,0,28,8,197,1,28,8,198,2,28,8,199,3,28,8,200,4,128,12,2,
+251,242,12,3,247,12,12,4,28,250,69,254,216,28,24,118,28,10,40,5,30,160,0,
+72,130,128,152,143,139,139,30,160,0,72,130,128,152,143,139,139,12,7,29,0,
+62,28,255,13,29,0,0,144,22,15,29,0,0,144,51,16,29,0,0,144,53,17,181,29,0,
+1,245,251,18,7,66,2,0,1,0,9,0,17,0,26,0,38,0,49,0,58,0,65,0,67,0,75,0,80,
+0,87,0,98,0,103,0,110,0,117,0,124,0,131,0,138,0,145,0,152,0,159,0,166,0,173,
+0,180,0,187,0,194,0,201,0,207,0,214,0,221,0,228,0,235,0,242,0,249,1,0,1,7,
+1,14,1,21,1,28,1,35,1,45,1,52,1,59,1,66,1,73,1,80,1,87,1,94,1,101,1,108,1,
+115,1,122,1,129,1,136,1,143,1,150,1,157,1,164,1,171,1,178,1,185,1,192,1,199,
+1,206,1,213,1,220,1,227,1,232,1,239,1,246,1,253,2,4,2,11,2,18,2,25,2,32,2,
+39,2,46,2,52,2,59,2,66,2,73,2,80,2,87,2,94,2,101,2,108,2,115,2,122,2,129,
+2,136,2,146,2,153,2,160,2,167,2,174,2,181,2,188,2,195,2,202,2,209,2,216,2,
+223,2,230,2,237,2,244,2,251,3,2,3,9,3,16,3,23,3,30,3,37,3,44,3,51,3,58,3,
+65,3,72,3,79,3,86,3,93,3,100,3,107,3,114,3,121,3,128,3,135,3,142,3,149,3,
+156,3,163,3,170,3,177,3,184,3,191,3,198,3,205,3,212,3,219,3,226,3,233,3,240,
+3,247,3,254,4,5,4,12,4,19,4,26,4,33,4,40,4,47,4,51,4,58,4,65,4,72,4,79,4,
+86,4,93,4,100,4,106,4,117,4,123,4,133,4,140,4,147,4,154,4,161,4,168,4,175,
+4,182,4,189,4,196,4,203,4,210,4,217,4,224,4,231,4,238,4,245,4,252,5,3,5,10,
+5,17,5,24,5,31,5,37,5,48,5,54,5,64,5,71,5,78,5,85,5,92,5,99,5,103,5,110,5,
+117,5,124,5,131,5,138,5,145,5,152,5,159,5,166,5,173,5,180,5,187,5,194,5,201,
+5,208,5,215,5,222,5,229,5,236,5,243,5,250,6,1,6,7,6,14,6,20,6,24,6,31,6,38,
+6,45,6,52,6,59,6,66,6,73,6,80,6,87,6,94,6,101,6,108,6,115,6,122,6,129,6,134,
+6,141,6,148,6,155,6,162,6,169,6,175,6,182,6,189,6,196,6,203,6,210,6,216,6,
+223,6,230,6,237,6,244,6,251,7,2,7,9,7,16,7,23,7,30,7,37,7,44,7,51,7,58,7,
+65,7,72,7,79,7,86,7,93,7,100,7,107,7,114,7,121,7,128,7,135,7,142,7,149,7,
+156,7,163,7,169,7,176,7,182,7,189,7,196,7,203,7,210,7,217,7,227,7,234,7,241,
+7,248,7,255,8,6,8,13,8,20,8,27,8,34,8,41,8,48,8,55,8,62,8,69,8,76,8,83,8,
+90,8,97,8,104,8,111,8,118,8,125,8,132,8,139,8,146,8,153,8,160,8,167,8,174,
+8,181,8,188,8,195,8,202,8,209,8,216,8,223,8,230,8,237,8,244,8,251,9,2,9,9,
+9,16,9,23,9,30,9,37,9,44,9,51,9,58,9,64,9,71,9,77,9,84,9,91,9,98,9,105,9,
+112,9,122,9,129,9,136,9,143,9,150,9,157,9,164,9,171,9,178,9,185,9,192,9,199,
+9,206,9,217,9,224,9,231,9,238,9,245,9,252,10,3,10,10,10,17,10,24,10,31,10,
+38,10,45,10,52,10,59,10,66,10,73,10,80,10,87,10,94,10,99,10,106,10,113,10,
+120,10,127,10,134,10,141,10,148,10,155,10,162,10,169,10,176,10,181,10,188,
+10,195,10,202,10,209,10,214,10,221,10,228,10,235,10,242,10,249,11,0,11,7,
+11,14,11,25,11,31,11,37,11,44,11,54,11,66,11,73,11,80,11,87,11,94,11,101,
+11,108,11,115,11,122,11,129,11,136,11,143,11,150,11,157,11,168,11,174,11,
+180,11,187,11,197,11,209,11,216,11,223,11,230,11,237,11,244,11,251,12,2,12,
+9,12,16,12,23,12,30,12,37,12,48,12,55,12,62,12,69,12,76,12,83,12,90,12,97,
+12,104,12,108,12,115,12,122,12,129,12,136,12,143,12,150,12,157,12,164,12,
+171,12,178,12,185,12,192,12,199,12,206,12,213,12,220,12,227,12,234,12,241,
+12,248,12,255,13,6,13,13,13,20,13,27,13,34,13,41,13,48,13,55,13,62,13,69,
+13,76,13,83,13,90,13,97,13,104,13,111,13,122,13,129,13,136,13,143,13,150,
+13,157,13,164,13,168,13,175,13,182,13,189,13,196,13,203,13,210,13,217,13,
+224,13,231,13,238,13,245,13,252,14,3,14,10,14,17,14,24,14,31,14,38,14,45,
+14,52,14,59,14,66,14,73,14,80,14,87,14,94,14,96,14,103,14,110,14,117,14,124,
+14,131,14,138,14,145,14,151,14,158,14,164,14,171,14,178,14,185,14,192,14,
+199,14,206,14,213,14,220,14,227,14,234,14,241,14,248,14,250,15,1,15,8,15,
+15,15,22,15,29,15,36,15,43,15,50,15,57,15,64,15,71,15,78,15,85,15,92,15,99,
+15,106,15,113,15,119,15,126,15,132,15,139,15,146,15,153,15,163,15,170,15,
+177,15,184,15,191,15,198,15,205,15,212,15,219,15,221,15,228,15,235,15,242,
+15,249,16,0,16,7,16,14,16,21,16,28,16,35,16,46,16,53,16,60,16,67,16,74,16,
+81,16,88,16,95,16,102,16,109,16,116,16,123,16,130,16,137,16,144,16,151,16,
+158,16,165,16,172,16,179,16,186,16,193,16,200,16,211,16,218,16,225,16,232,
+16,239,16,246,16,253,17,4,17,11,17,18,17,25,17,32,17,39,17,46,17,53,17,60,
+17,67,17,74,17,81,17,88,17,95,17,107,17,114,17,121,17,128,17,135,17,142,17,
+149,17,156,17,163,17,175,17,182,17,189,17,196,17,203,17,210,17,217,17,224,
+17,231,17,238,17,245,17,252,18,3,18,10,18,17,18,24,18,31,18,38,18,45,18,57,
+18,64,18,71,18,78,18,85,18,92,18,99,18,106,18,113,18,120,18,127,18,134,18,
+141,18,148,18,155,18,162,18,169,18,176,18,183,18,190,18,197,18,204,18,211,
+18,218,18,224,18,231,18,238,18,245,18,252,19,8,19,12,19,18,19,25,19,32,19,
+39,19,46,19,53,19,60,19,67,19,74,19,81,19,88,19,95,19,102,19,109,19,116,19,
+123,19,130,19,137,19,144,19,151,19,158,19,165,19,172,19,179,19,183,19,190,
+19,197,19,204,19,211,19,217,19,224,19,231,19,238,19,245,20,1,20,5,20,11,20,
+18,20,25,20,32,20,39,20,46,20,53,20,60,20,67,20,74,20,81,20,88,20,95,20,102,
+20,109,20,116,20,123,20,130,20,137,20,144,20,151,20,158,20,165,20,172,20,
+179,20,186,20,193,20,200,20,207,20,214,20,221,20,228,20,235,20,242,20,249,
+21,0,21,7,21,14,21,21,21,28,21,35,21,42,21,49,21,56,21,63,21,70,21,77,21,
+84,21,90,21,97,21,103,21,110,21,117,21,124,21,131,21,143,21,150,21,157,21,
+164,21,171,21,178,21,185,21,188,21,195,21,202,21,209,21,216,21,223,21,230,
+21,237,21,244,21,251,22,2,22,9,22,16,22,23,22,30,22,37,22,44,22,50,22,57,
+22,63,22,70,22,77,22,84,22,91,22,103,22,110,22,117,22,124,22,131,22,138,22,
+145,22,148,22,155,22,162,22,169,22,176,22,183,22,190,22,197,22,204,22,211,
+22,218,22,225,22,232,22,239,22,246,23,3,23,10,23,17,23,24,23,31,23,38,23,
+45,23,52,23,58,23,65,23,72,23,79,23,86,23,93,23,100,23,107,23,114,23,121,
+23,128,23,135,23,142,23,149,23,156,23,163,23,170,23,177,23,184,23,191,23,
+198,23,203,23,210,23,217,23,224,23,235,23,243,23,250,24,1,24,6,24,13,24,20,
+24,27,24,34,24,41,24,46,24,53,24,60,24,67,24,74,24,81,24,88,24,95,24,102,
+24,109,24,116,24,123,24,130,24,137,24,144,24,151,24,164,24,171,24,178,24,
+185,24,192,24,199,24,206,24,213,24,219,24,226,24,233,24,240,24,247,24,254,
+25,5,25,12,25,19,25,26,25,33,25,40,25,47,25,54,25,61,25,68,25,75,25,82,25,
+89,25,94,25,101,25,108,25,119,25,126,25,133,25,138,25,145,25,152,25,159,25,
+166,25,173,25,180,25,187,25,194,25,201,25,208,25,215,25,222,25,229,25,236,
+25,243,25,250,26,1,26,8,26,15,26,22,26,29,26,36,26,43,26,50,26,57,26,64,26,
+71,26,78,26,85,26,92,26,99,26,106,26,109,26,116,26,123,26,130,26,137,26,140,
+26,147,26,154,26,161,26,168,26,175,26,182,26,189,26,196,26,203,26,210,26,
+217,26,224,26,231,26,238,26,245,26,252,27,3,27,10,27,17,27,23,27,30,27,37,
+27,44,27,51,27,58,27,65,27,72,27,79,27,86,27,93,27,100,27,107,27,114,27,121,
+27,128,27,135,27,142,27,149,27,156,27,163,27,169,27,176,27,183,27,189,27,
+196,27,203,27,210,27,217,27,229,27,236,27,243,27,250,28,1,28,8,28,15,28,22,
+28,29,28,36,28,43,28,50,28,57,28,64,28,71,28,78,28,85,28,92,28,99,28,106,
+28,113,28,120,28,127,28,134,28,141,28,147,28,154,28,161,28,167,28,174,28,
+181,28,188,28,195,28,207,28,214,28,221,28,228,28,235,28,242,28,249,29,0,29,
+7,29,14,29,21,29,28,29,35,29,42,29,49,29,56,29,63,29,70,29,77,29,84,29,91,
+29,98,29,105,29,112,29,119,29,125,29,132,29,143,29,150,29,157,29,164,29,171,
+29,178,29,186,29,193,29,200,29,207,29,214,29,221,29,228,29,235,29,242,29,
+249,30,0,30,7,30,14,30,21,30,28,30,35,30,41,30,48,30,59,30,66,30,73,30,80,
+30,87,30,94,30,102,30,109,30,116,30,123,30,130,30,137,30,144,30,151,30,158,
+30,165,30,172,30,179,30,186,30,193,30,200,30,206,30,213,30,220,30,227,30,
+231,30,238,30,245,30,252,31,3,31,10,31,17,31,24,31,31,31,38,31,45,31,52,31,
+59,31,66,31,73,31,80,31,87,31,94,31,101,31,108,31,115,31,121,31,128,31,135,
+31,142,31,149,31,156,31,163,31,170,31,174,31,181,31,188,31,195,31,202,31,
+209,31,216,31,223,31,230,31,237,31,244,31,251,32,2,32,9,32,16,32,23,32,36,
+32,43,32,50,32,56,32,63,32,69,32,76,32,83,32,90,32,97,32,104,32,111,32,118,
+32,123,32,130,32,137,32,144,32,151,32,158,32,165,32,172,32,179,32,186,32,
+191,32,198,32,205,32,212,32,219,32,226,32,233,32,240,32,247,32,254,33,5,33,
+12,33,19,33,26,33,33,33,40,33,47,33,54,33,61,33,74,33,81,33,88,33,94,33,101,
+33,107,33,114,33,121,33,128,33,135,33,142,33,149,33,156,33,161,33,168,33,
+175,33,182,33,189,33,196,33,203,33,210,33,217,33,222,33,229,33,236,33,243,
+33,250,34,1,34,8,34,15,34,22,34,29,34,36,34,43,34,50,34,57,34,64,34,71,34,
+78,34,85,34,92,34,99,34,106,34,113,34,120,34,127,34,134,34,141,34,148,34,
+155,34,162,34,169,34,176,34,183,34,188,34,195,34,202,34,209,34,216,34,223,
+34,230,34,237,34,244,34,251,35,2,35,9,35,16,35,23,35,30,35,37,35,44,35,51,
+35,57,35,63,35,74,35,83,35,90,35,97,35,104,35,111,35,118,35,125,35,130,35,
+137,35,144,35,151,35,158,35,164,35,170,35,181,35,190,35,197,35,204,35,211,
+35,218,35,225,35,232,35,239,35,246,35,253,36,4,36,11,36,18,36,25,36,32,36,
+39,36,46,36,53,36,56,36,63,36,70,36,77,36,84,36,91,36,98,36,105,36,112,36,
+119,36,126,36,133,36,140,36,147,36,154,36,160,36,171,36,178,36,185,36,192,
+36,199,36,206,36,213,36,220,36,227,36,234,36,241,36,248,36,255,37,6,37,13,
+37,20,37,26,37,33,37,40,37,47,37,54,37,61,37,68,37,75,37,82,37,89,37,95,37,
+106,37,113,37,120,37,127,37,134,37,141,37,148,37,155,37,162,37,169,37,176,
+37,183,37,190,37,197,37,204,37,211,37,218,37,225,37,232,37,239,37,246,37,
+249,38,0,38,7,38,13,38,20,38,30,38,37,38,44,38,51,38,58,38,65,38,72,38,79,
+38,86,38,93,38,100,38,107,38,114,38,121,38,128,38,134,38,141,38,151,38,158,
+38,165,38,172,38,179,38,186,38,193,38,200,38,207,38,214,38,221,38,228,38,
+235,38,242,38,249,39,0,39,7,39,14,39,21,39,28,39,35,39,42,39,49,39,56,39,
+63,39,70,39,77,39,84,39,91,39,98,39,105,39,112,39,119,39,126,39,133,39,140,
+39,147,39,154,39,161,39,168,39,175,39,182,39,189,39,196,39,203,39,210,39,
+217,39,224,39,231,39,238,39,245,39,252,40,3,40,10,40,17,40,24,40,31,40,38,
+40,45,40,52,40,59,40,66,40,73,40,80,40,87,40,94,40,101,40,108,40,115,40,122,
+40,129,40,136,40,143,40,150,40,157,40,164,40,171,40,178,40,185,40,192,40,
+199,40,206,40,213,40,220,40,227,40,234,40,241,40,248,40,255,41,6,41,15,41,
+22,41,29,41,36,41,43,41,50,41,57,41,70,41,77,41,84,41,91,41,98,41,105,41,
+112,41,119,41,128,41,135,41,142,41,149,41,156,41,163,41,170,41,177,41,184,
+41,191,41,198,41,205,41,212,41,219,41,226,41,233,41,240,41,247,41,254,42,
+5,42,12,42,19,42,26,42,33,42,40,42,47,42,54,42,61,42,68,42,75,42,82,42,89,
+42,96,42,103,42,110,42,117,42,124,42,131,42,138,42,145,42,152,42,159,42,166,
+42,173,42,180,42,187,42,194,42,201,42,208,42,215,42,222,42,229,42,236,42,
+243,42,250,43,1,43,8,43,15,43,22,43,29,43,36,43,43,43,50,43,57,43,64,43,71,
+43,78,43,85,43,92,43,99,43,106,43,113,43,122,43,128,43,135,43,141,43,148,
+43,155,43,162,43,169,43,176,43,183,43,190,43,197,43,204,43,213,43,220,43,
+227,43,234,43,241,43,248,43,255,44,6,44,13,44,20,44,27,44,34,44,41,44,48,
+44,55,44,62,44,69,44,76,44,83,44,90,44,97,44,104,44,111,44,118,44,125,44,
+132,44,139,44,146,44,153,44,160,44,167,44,174,44,181,44,188,44,195,44,202,
+44,209,44,216,44,223,44,232,44,239,44,246,44,253,45,4,45,11,45,18,45,25,45,
+32,45,39,45,46,45,53,45,60,45,67,45,74,45,81,45,88,45,95,45,102,45,109,45,
+116,45,123,45,130,45,137,45,144,45,151,45,164,45,171,45,178,45,185,45,192,
+45,199,45,206,45,213,45,220,45,231,45,238,45,245,45,252,46,8,46,15,46,22,
+46,29,46,36,46,43,46,50,46,57,46,64,46,71,46,78,46,85,46,92,46,99,46,106,
+46,113,46,120,46,127,46,134,46,141,46,148,46,155,46,162,46,175,46,182,46,
+189,46,196,46,203,46,210,46,217,46,224,46,231,46,238,46,245,46,252,47,3,47,
+10,47,17,47,24,47,31,47,38,47,45,47,52,47,59,47,66,47,73,47,80,47,87,47,94,
+47,101,47,108,47,115,47,122,47,129,47,136,47,143,47,150,47,157,47,164,47,
+171,47,178,47,185,47,192,47,199,47,206,47,213,47,220,47,227,47,234,47,241,
+47,248,47,255,48,6,48,13,48,20,48,27,48,34,48,41,48,48,48,55,48,62,48,69,
+48,78,48,85,48,92,48,99,48,106,48,113,48,122,48,134,48,143,48,150,48,157,
+48,164,48,174,48,181,48,188,48,195,48,204,48,211,48,218,48,225,48,237,48,
+247,48,254,49,10,49,23,49,35,49,42,49,49,49,56,49,63,49,70,49,77,49,84,49,
+91,49,98,49,105,49,112,49,119,49,126,49,135,49,142,49,149,49,156,49,163,49,
+173,49,180,49,187,49,194,49,201,49,208,49,215,49,222,49,229,49,236,49,243,
+49,250,50,1,50,8,50,15,50,22,50,29,50,36,50,43,50,50,50,57,50,64,50,71,50,
+78,50,85,50,92,50,99,50,106,50,113,50,120,50,127,50,134,50,141,50,148,50,
+155,50,162,50,169,50,176,50,183,50,190,50,197,50,204,50,211,50,218,50,225,
+50,232,50,239,50,246,50,253,51,4,51,11,51,18,51,25,51,32,51,39,51,41,51,84,
+51,101,51,111,51,117,110,111,116,101,113,117,97,108,105,110,102,105,110,105,
+116,121,108,101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,
+113,117,97,108,112,97,114,116,105,97,108,100,105,102,102,115,117,109,109,
+97,116,105,111,110,112,114,111,100,117,99,116,112,105,105,110,116,101,103,
+114,97,108,79,109,101,103,97,114,97,100,105,99,97,108,97,112,112,114,111,
+120,101,113,117,97,108,68,101,108,116,97,117,110,105,48,48,65,48,108,111,
+122,101,110,103,101,117,110,105,50,53,67,67,117,110,105,48,52,51,48,117,110,
+105,50,48,57,48,117,110,105,49,68,52,51,117,110,105,48,51,54,51,117,110,105,
+48,50,48,49,117,110,105,49,69,65,68,117,110,105,49,69,65,53,117,110,105,49,
+69,65,55,117,110,105,49,69,65,66,117,110,105,49,69,65,57,117,110,105,48,50,
+48,51,97,98,114,101,118,101,117,110,105,49,69,66,55,117,110,105,49,69,65,
+70,117,110,105,49,69,66,49,117,110,105,49,69,66,53,117,110,105,49,69,66,51,
+117,110,105,48,52,68,49,117,110,105,48,49,67,69,97,109,97,99,114,111,110,
+117,110,105,48,52,68,51,117,110,105,48,49,68,70,117,110,105,48,50,50,55,117,
+110,105,48,49,69,49,97,114,105,110,103,97,99,117,116,101,117,110,105,49,69,
+57,65,117,110,105,49,69,65,51,117,110,105,49,69,65,49,117,110,105,49,69,48,
+49,97,111,103,111,110,101,107,117,110,105,49,68,56,70,117,110,105,50,67,54,
+53,117,110,105,65,55,51,51,117,110,105,65,55,51,53,117,110,105,65,55,51,55,
+117,110,105,65,55,51,57,117,110,105,65,55,51,66,117,110,105,65,55,51,68,117,
+110,105,48,50,53,48,117,110,105,49,68,52,52,117,110,105,48,50,53,49,117,110,
+105,49,68,52,53,117,110,105,49,68,57,48,117,110,105,65,66,54,52,117,110,105,
+48,50,53,50,117,110,105,49,68,57,66,117,110,105,48,52,68,53,97,101,97,99,
+117,116,101,117,110,105,48,49,69,51,117,110,105,49,68,48,50,117,110,105,49,
+68,52,54,97,108,112,104,97,117,110,105,48,52,49,48,117,110,105,49,68,50,67,
+117,110,105,49,68,48,48,117,110,105,48,50,48,48,117,110,105,49,69,65,52,117,
+110,105,49,69,65,54,117,110,105,49,69,65,65,117,110,105,49,69,65,56,117,110,
+105,49,69,65,67,117,110,105,48,50,48,50,65,98,114,101,118,101,117,110,105,
+49,69,65,69,117,110,105,49,69,66,48,117,110,105,49,69,66,52,117,110,105,49,
+69,66,50,117,110,105,49,69,66,54,117,110,105,48,52,68,48,117,110,105,48,49,
+67,68,65,109,97,99,114,111,110,117,110,105,48,52,68,50,117,110,105,48,49,
+68,69,117,110,105,48,50,50,54,117,110,105,48,49,69,48,65,114,105,110,103,
+97,99,117,116,101,117,110,105,49,69,65,50,117,110,105,49,69,65,48,117,110,
+105,49,69,48,48,65,111,103,111,110,101,107,117,110,105,48,50,51,65,117,110,
+105,50,67,54,70,117,110,105,65,55,51,52,117,110,105,65,55,51,50,117,110,105,
+65,55,51,54,117,110,105,65,55,51,56,117,110,105,65,55,51,65,117,110,105,65,
+55,51,67,117,110,105,50,48,66,51,117,110,105,50,67,54,68,117,110,105,50,67,
+55,48,117,110,105,48,52,68,52,117,110,105,49,68,50,68,117,110,105,49,68,48,
+49,65,69,97,99,117,116,101,117,110,105,48,49,69,50,117,110,105,49,68,52,55,
+117,110,105,49,69,48,51,117,110,105,49,69,48,55,117,110,105,49,69,48,53,117,
+110,105,49,68,56,48,117,110,105,48,49,56,48,117,110,105,49,68,54,67,117,110,
+105,48,50,53,51,117,110,105,65,55,57,55,117,110,105,48,49,56,53,117,110,105,
+48,49,56,51,117,110,105,48,52,51,49,117,110,105,48,52,52,67,117,110,105,48,
+52,56,68,117,110,105,48,52,52,65,117,110,105,48,52,54,51,117,110,105,48,52,
+52,66,117,110,105,48,52,70,57,117,110,105,48,52,51,50,117,110,105,48,52,49,
+50,117,110,105,49,68,50,69,117,110,105,48,50,57,57,117,110,105,49,69,48,50,
+117,110,105,49,69,48,54,117,110,105,49,69,48,52,117,110,105,48,50,52,51,117,
+110,105,49,68,50,70,117,110,105,49,68,48,51,117,110,105,48,49,56,49,117,110,
+105,65,55,57,54,117,110,105,48,49,56,52,117,110,105,48,49,56,50,117,110,105,
+48,52,49,49,117,110,105,48,52,50,67,117,110,105,48,52,56,67,117,110,105,48,
+52,50,65,117,110,105,48,52,54,50,117,110,105,48,52,50,66,117,110,105,48,52,
+70,56,98,101,116,97,117,110,105,49,68,54,54,117,110,105,49,68,53,68,117,110,
+105,49,69,57,69,117,110,105,48,52,52,49,117,110,105,50,49,55,68,117,110,105,
+49,68,57,67,117,110,105,48,51,54,56,99,97,99,117,116,101,99,99,105,114,99,
+117,109,102,108,101,120,99,99,97,114,111,110,99,100,111,116,97,99,99,101,
+110,116,117,110,105,49,69,48,57,117,110,105,48,52,65,66,117,110,105,65,55,
+57,52,117,110,105,65,55,57,51,117,110,105,48,50,51,67,117,110,105,48,50,57,
+55,117,110,105,48,49,56,56,117,110,105,48,50,53,53,117,110,105,49,68,57,68,
+117,110,105,48,50,53,52,117,110,105,49,68,53,51,117,110,105,49,68,57,55,117,
+110,105,50,67,55,65,117,110,105,50,49,56,52,117,110,105,65,55,51,70,117,110,
+105,49,68,49,50,117,110,105,48,52,53,52,117,110,105,48,52,52,68,117,110,105,
+48,52,69,68,117,110,105,48,52,50,49,117,110,105,50,49,54,68,117,110,105,49,
+68,48,52,67,97,99,117,116,101,67,99,105,114,99,117,109,102,108,101,120,67,
+99,97,114,111,110,67,100,111,116,97,99,99,101,110,116,117,110,105,49,69,48,
+56,117,110,105,48,52,65,65,117,110,105,65,55,57,50,117,110,105,48,50,51,66,
+117,110,105,48,49,56,55,69,117,114,111,117,110,105,50,48,65,48,117,110,105,
+50,48,65,50,117,110,105,50,48,66,53,117,110,105,50,49,56,53,117,110,105,50,
+49,50,68,117,110,105,50,67,56,56,117,110,105,48,49,56,54,117,110,105,49,68,
+49,48,117,110,105,50,49,56,51,117,110,105,65,55,51,69,117,110,105,48,52,48,
+52,117,110,105,48,52,50,68,117,110,105,48,52,69,67,117,110,105,48,53,48,49,
+117,110,105,50,49,55,69,117,110,105,49,68,52,56,117,110,105,48,51,54,57,117,
+110,105,49,69,48,66,117,110,105,49,69,49,51,117,110,105,49,69,48,70,117,110,
+105,49,69,48,68,117,110,105,49,69,49,49,100,99,97,114,111,110,117,110,105,
+49,68,56,49,100,99,114,111,97,116,100,111,110,103,117,110,105,49,68,54,68,
+117,110,105,65,55,55,49,117,110,105,48,50,53,55,117,110,105,48,50,53,54,117,
+110,105,49,68,57,49,117,110,105,48,50,50,49,117,110,105,48,49,56,67,117,110,
+105,48,50,51,56,117,110,105,48,49,70,51,117,110,105,48,49,67,54,117,110,105,
+48,50,65,51,117,110,105,48,50,65,53,117,110,105,48,50,65,52,117,110,105,48,
+53,48,51,117,110,105,49,69,57,70,100,101,108,116,97,117,110,105,49,68,53,
+70,117,110,105,49,68,57,69,117,110,105,50,49,54,69,117,110,105,49,68,51,48,
+117,110,105,49,68,48,53,68,99,97,114,111,110,117,110,105,49,69,48,65,117,
+110,105,49,69,49,50,117,110,105,49,69,48,69,117,110,105,49,69,48,67,117,110,
+105,49,69,49,48,68,99,114,111,97,116,117,110,105,48,49,56,57,117,110,105,
+49,68,48,54,117,110,105,48,49,56,65,117,110,105,48,49,56,66,117,110,105,48,
+49,70,50,117,110,105,48,49,67,53,117,110,105,48,49,70,49,117,110,105,48,49,
+67,52,117,110,105,48,53,48,48,117,110,105,48,53,48,50,117,110,105,48,51,57,
+52,117,110,105,50,49,56,49,117,110,105,50,49,56,48,117,110,105,50,49,56,50,
+117,110,105,50,49,56,55,117,110,105,50,49,56,56,117,110,105,50,48,65,70,117,
+110,105,48,52,51,53,117,110,105,50,48,57,49,117,110,105,49,68,52,57,117,110,
+105,48,51,54,52,117,110,105,48,52,53,48,117,110,105,48,50,48,53,117,110,105,
+49,69,66,70,117,110,105,49,69,67,49,117,110,105,49,69,67,53,117,110,105,49,
+69,67,51,117,110,105,49,69,67,55,117,110,105,48,50,48,55,101,98,114,101,118,
+101,117,110,105,48,52,68,55,101,99,97,114,111,110,117,110,105,49,69,66,68,
+101,109,97,99,114,111,110,117,110,105,49,69,49,55,117,110,105,49,69,49,53,
+117,110,105,48,52,53,49,101,100,111,116,97,99,99,101,110,116,117,110,105,
+49,69,66,66,117,110,105,49,69,49,57,117,110,105,49,69,49,66,117,110,105,49,
+69,66,57,117,110,105,50,67,55,56,117,110,105,48,50,50,57,117,110,105,49,69,
+49,68,101,111,103,111,110,101,107,117,110,105,49,68,57,50,117,110,105,48,
+50,52,55,117,110,105,48,52,66,68,117,110,105,48,52,66,70,117,110,105,48,49,
+68,68,117,110,105,48,50,53,57,117,110,105,48,52,68,57,117,110,105,50,48,57,
+52,117,110,105,49,68,52,65,117,110,105,48,52,68,66,117,110,105,49,68,57,53,
+117,110,105,48,50,53,65,117,110,105,48,50,53,56,117,110,105,48,50,53,66,117,
+110,105,49,68,52,66,117,110,105,49,68,57,51,117,110,105,48,50,53,67,117,110,
+105,49,68,57,70,117,110,105,49,68,57,52,117,110,105,48,50,53,68,117,110,105,
+49,68,48,56,117,110,105,49,68,52,67,117,110,105,48,50,57,65,117,110,105,48,
+50,53,69,117,110,105,48,53,49,49,117,110,105,48,52,51,55,117,110,105,48,52,
+68,70,117,110,105,48,52,57,57,117,110,105,48,53,48,55,117,110,105,48,53,48,
+53,117,110,105,48,52,49,53,117,110,105,49,68,51,49,117,110,105,49,68,48,55,
+117,110,105,48,52,48,48,117,110,105,48,50,48,52,117,110,105,49,69,66,69,117,
+110,105,49,69,67,48,117,110,105,49,69,67,52,117,110,105,49,69,67,50,117,110,
+105,49,69,67,54,117,110,105,48,50,48,54,69,98,114,101,118,101,117,110,105,
+48,52,68,54,69,99,97,114,111,110,117,110,105,49,69,66,67,69,109,97,99,114,
+111,110,117,110,105,49,69,49,54,117,110,105,49,69,49,52,117,110,105,48,52,
+48,49,69,100,111,116,97,99,99,101,110,116,117,110,105,49,69,66,65,117,110,
+105,49,69,49,56,117,110,105,49,69,49,65,117,110,105,49,69,66,56,117,110,105,
+48,50,50,56,117,110,105,49,69,49,67,69,111,103,111,110,101,107,117,110,105,
+48,50,52,54,117,110,105,50,67,55,66,117,110,105,48,52,66,67,117,110,105,48,
+52,66,69,117,110,105,48,49,56,69,101,120,105,115,116,101,110,116,105,97,108,
+117,110,105,50,50,48,52,117,110,105,49,68,51,50,117,110,105,48,49,56,70,117,
+110,105,48,52,68,56,117,110,105,48,52,68,65,117,110,105,48,49,57,48,117,110,
+105,65,55,65,66,117,110,105,48,53,49,48,117,110,105,48,52,49,55,117,110,105,
+48,52,68,69,117,110,105,48,52,57,56,117,110,105,48,53,48,54,117,110,105,48,
+53,48,52,117,110,105,49,68,65,48,117,110,105,49,69,49,70,117,110,105,49,68,
+56,50,117,110,105,49,68,54,69,117,110,105,65,55,57,57,117,110,105,48,50,65,
+57,108,111,110,103,115,117,110,105,49,69,57,66,117,110,105,49,69,57,68,117,
+110,105,49,69,57,67,117,110,105,48,52,51,51,117,110,105,48,52,53,51,117,110,
+105,48,52,57,49,117,110,105,48,52,70,55,117,110,105,48,52,57,51,117,110,105,
+48,52,70,66,117,110,105,65,55,51,48,117,110,105,49,69,49,69,102,114,97,110,
+99,117,110,105,48,49,57,49,117,110,105,65,55,57,56,117,110,105,65,55,70,66,
+117,110,105,48,52,49,51,71,97,109,109,97,117,110,105,49,68,50,54,117,110,
+105,48,52,48,51,117,110,105,48,52,57,48,117,110,105,48,52,70,54,117,110,105,
+48,52,57,50,117,110,105,48,52,70,65,117,110,105,49,68,52,68,117,110,105,48,
+49,70,53,103,99,105,114,99,117,109,102,108,101,120,103,98,114,101,118,101,
+103,99,97,114,111,110,117,110,105,49,69,50,49,103,100,111,116,97,99,99,101,
+110,116,103,99,111,109,109,97,97,99,99,101,110,116,117,110,105,48,49,69,53,
+117,110,105,65,55,65,49,117,110,105,48,50,54,49,117,110,105,49,68,65,50,117,
+110,105,49,68,56,51,117,110,105,48,50,54,48,117,110,105,49,68,55,55,117,110,
+105,49,68,55,57,117,110,105,65,55,55,70,117,110,105,48,53,48,68,117,110,105,
+49,68,51,51,117,110,105,48,50,54,50,117,110,105,48,49,70,52,71,99,105,114,
+99,117,109,102,108,101,120,71,98,114,101,118,101,71,99,97,114,111,110,117,
+110,105,49,69,50,48,71,100,111,116,97,99,99,101,110,116,71,99,111,109,109,
+97,97,99,99,101,110,116,117,110,105,48,49,69,52,117,110,105,65,55,65,48,117,
+110,105,48,49,57,51,117,110,105,48,50,57,66,117,110,105,65,55,65,67,117,110,
+105,50,48,66,50,117,110,105,65,55,55,68,117,110,105,65,55,55,69,117,110,105,
+48,53,48,67,117,110,105,50,48,57,53,117,110,105,48,50,66,48,117,110,105,48,
+51,54,65,104,99,105,114,99,117,109,102,108,101,120,117,110,105,48,50,49,70,
+117,110,105,49,69,50,55,117,110,105,49,69,50,51,117,110,105,49,69,50,66,117,
+110,105,49,69,57,54,117,110,105,49,69,50,53,117,110,105,49,69,50,57,117,110,
+105,65,55,57,53,104,98,97,114,117,110,105,48,52,53,66,117,110,105,48,52,53,
+50,117,110,105,48,50,54,54,117,110,105,48,50,66,49,117,110,105,65,55,50,55,
+117,110,105,48,50,54,55,117,110,105,50,67,54,56,117,110,105,48,49,57,53,117,
+110,105,50,67,55,54,117,110,105,48,50,54,53,117,110,105,49,68,65,51,117,110,
+105,48,50,65,69,117,110,105,48,50,65,70,117,110,105,48,52,66,66,117,110,105,
+48,52,57,53,117,110,105,48,53,50,55,117,110,105,48,52,51,68,117,110,105,48,
+52,65,53,117,110,105,48,52,65,51,117,110,105,48,52,67,65,117,110,105,48,52,
+53,65,117,110,105,48,52,67,56,117,110,105,48,53,50,57,117,110,105,48,53,48,
+66,117,110,105,48,53,50,51,117,110,105,48,52,51,70,117,110,105,48,53,50,53,
+117,110,105,48,52,65,55,117,110,105,48,52,53,70,117,110,105,48,52,52,54,117,
+110,105,48,52,52,56,117,110,105,48,52,52,57,117,110,105,49,68,50,56,117,110,
+105,48,52,49,68,117,110,105,49,68,51,52,117,110,105,49,68,55,56,117,110,105,
+48,50,57,67,72,99,105,114,99,117,109,102,108,101,120,117,110,105,48,50,49,
+69,117,110,105,49,69,50,54,117,110,105,49,69,50,50,117,110,105,49,69,50,65,
+117,110,105,49,69,50,52,117,110,105,49,69,50,56,72,98,97,114,117,110,105,
+65,55,70,56,117,110,105,65,55,65,65,117,110,105,65,55,50,54,117,110,105,50,
+67,54,55,117,110,105,48,49,70,54,117,110,105,50,67,55,53,117,110,105,50,49,
+48,67,117,110,105,48,53,50,56,117,110,105,65,55,56,68,117,110,105,48,52,66,
+65,117,110,105,48,52,57,52,117,110,105,48,53,50,54,117,110,105,48,52,65,52,
+117,110,105,48,52,65,50,117,110,105,48,52,67,57,117,110,105,48,52,48,65,117,
+110,105,48,52,67,55,117,110,105,48,53,48,65,117,110,105,48,53,50,50,117,110,
+105,48,52,49,70,117,110,105,48,53,50,52,117,110,105,48,52,65,54,117,110,105,
+48,52,48,70,117,110,105,48,52,50,54,117,110,105,48,52,50,56,117,110,105,48,
+52,50,57,80,105,117,110,105,48,52,53,54,117,110,105,50,49,55,48,117,110,105,
+49,68,54,50,117,110,105,50,48,55,49,117,110,105,48,51,54,53,117,110,105,48,
+50,48,57,117,110,105,48,50,48,66,105,98,114,101,118,101,117,110,105,48,49,
+68,48,105,116,105,108,100,101,105,109,97,99,114,111,110,117,110,105,48,52,
+53,55,117,110,105,49,69,50,70,117,110,105,49,69,67,57,117,110,105,49,69,50,
+68,117,110,105,49,69,67,66,105,111,103,111,110,101,107,117,110,105,49,68,
+57,54,117,110,105,48,50,54,56,117,110,105,49,68,65,52,117,110,105,49,68,48,
+57,117,110,105,49,68,52,69,105,106,117,110,105,50,49,55,49,117,110,105,50,
+49,55,50,117,110,105,50,49,55,51,117,110,105,50,49,55,56,117,110,105,48,50,
+54,57,117,110,105,49,68,65,53,117,110,105,49,68,55,67,117,110,105,48,52,52,
+69,117,110,105,48,52,48,54,117,110,105,48,52,67,48,117,110,105,48,52,67,70,
+117,110,105,50,49,54,48,117,110,105,49,68,51,53,117,110,105,48,50,54,65,117,
+110,105,49,68,65,54,117,110,105,48,50,48,56,117,110,105,48,50,48,65,73,98,
+114,101,118,101,117,110,105,48,49,67,70,73,116,105,108,100,101,73,109,97,
+99,114,111,110,117,110,105,48,52,48,55,117,110,105,49,69,50,69,73,100,111,
+116,97,99,99,101,110,116,117,110,105,49,69,67,56,117,110,105,49,69,50,67,
+117,110,105,49,69,67,65,73,111,103,111,110,101,107,117,110,105,48,49,57,55,
+117,110,105,49,68,55,66,117,110,105,49,68,65,55,117,110,105,65,55,70,69,73,
+74,117,110,105,50,49,54,49,117,110,105,50,49,54,50,117,110,105,50,49,54,51,
+117,110,105,50,49,54,56,117,110,105,48,49,57,54,117,110,105,48,52,50,69,117,
+110,105,65,55,70,55,117,110,105,48,52,53,56,117,110,105,50,67,55,67,117,110,
+105,48,50,66,50,106,99,105,114,99,117,109,102,108,101,120,117,110,105,48,
+49,70,48,117,110,105,48,50,52,57,117,110,105,48,50,57,68,117,110,105,49,68,
+65,56,117,110,105,48,50,51,55,117,110,105,48,50,53,70,117,110,105,49,68,65,
+49,117,110,105,48,50,56,52,117,110,105,65,55,54,68,117,110,105,48,52,51,66,
+117,110,105,48,53,50,70,117,110,105,48,52,67,54,117,110,105,48,52,53,57,117,
+110,105,48,53,49,51,117,110,105,48,53,48,57,117,110,105,48,53,50,49,117,110,
+105,48,52,51,52,117,110,105,48,53,50,66,117,110,105,48,53,49,53,117,110,105,
+48,52,48,56,117,110,105,49,68,51,54,117,110,105,49,68,48,65,74,99,105,114,
+99,117,109,102,108,101,120,117,110,105,48,50,52,56,117,110,105,65,55,66,50,
+117,110,105,65,55,54,67,117,110,105,48,52,49,66,117,110,105,49,68,50,66,117,
+110,105,48,53,50,69,117,110,105,48,52,67,53,117,110,105,48,52,48,57,117,110,
+105,48,53,49,50,117,110,105,48,53,48,56,117,110,105,48,53,50,48,117,110,105,
+48,53,49,52,117,110,105,48,52,49,52,117,110,105,48,53,50,65,117,110,105,50,
+48,57,54,117,110,105,49,68,52,70,117,110,105,49,69,51,49,117,110,105,48,49,
+69,57,117,110,105,49,69,51,53,117,110,105,49,69,51,51,107,99,111,109,109,
+97,97,99,99,101,110,116,117,110,105,49,68,56,52,117,110,105,65,55,52,49,117,
+110,105,65,55,52,53,117,110,105,65,55,52,51,117,110,105,65,55,65,51,117,110,
+105,48,49,57,57,117,110,105,50,67,54,65,117,110,105,48,50,57,69,107,103,114,
+101,101,110,108,97,110,100,105,99,117,110,105,48,52,51,65,117,110,105,48,
+52,53,67,117,110,105,48,52,57,66,117,110,105,48,52,65,49,117,110,105,48,52,
+57,70,117,110,105,48,52,57,68,117,110,105,48,52,67,52,117,110,105,48,53,49,
+70,117,110,105,48,52,51,54,117,110,105,48,52,67,50,117,110,105,48,52,68,68,
+117,110,105,48,52,57,55,117,110,105,49,68,51,55,117,110,105,49,68,48,66,117,
+110,105,49,69,51,48,117,110,105,48,49,69,56,117,110,105,49,69,51,52,117,110,
+105,49,69,51,50,75,99,111,109,109,97,97,99,99,101,110,116,117,110,105,65,
+55,52,48,117,110,105,65,55,52,52,117,110,105,65,55,52,50,117,110,105,65,55,
+65,50,117,110,105,48,49,57,56,117,110,105,50,67,54,57,117,110,105,65,55,66,
+48,117,110,105,50,48,65,68,117,110,105,48,52,49,65,117,110,105,48,52,48,67,
+117,110,105,48,52,57,65,117,110,105,48,52,65,48,117,110,105,48,52,57,69,117,
+110,105,48,52,57,67,117,110,105,48,52,67,51,117,110,105,48,53,49,69,117,110,
+105,48,52,49,54,117,110,105,48,52,67,49,117,110,105,48,52,68,67,117,110,105,
+48,52,57,54,117,110,105,50,49,55,67,117,110,105,50,48,57,55,117,110,105,48,
+50,69,49,108,97,99,117,116,101,117,110,105,49,69,51,68,117,110,105,49,69,
+51,66,117,110,105,49,69,51,55,117,110,105,49,69,51,57,108,99,111,109,109,
+97,97,99,99,101,110,116,108,100,111,116,108,99,97,114,111,110,117,110,105,
+49,68,56,53,117,110,105,49,68,65,65,117,110,105,48,49,57,65,117,110,105,65,
+55,52,57,117,110,105,50,67,54,49,117,110,105,48,50,54,66,117,110,105,48,50,
+54,68,117,110,105,49,68,65,57,117,110,105,48,50,51,52,117,110,105,48,50,54,
+67,117,110,105,65,55,56,69,117,110,105,65,55,52,55,117,110,105,65,55,56,49,
+117,110,105,65,55,55,50,117,110,105,48,49,67,57,117,110,105,49,69,70,66,117,
+110,105,48,50,65,65,117,110,105,50,48,66,54,117,110,105,50,48,66,65,117,110,
+105,48,50,65,66,117,110,105,48,50,54,69,117,110,105,50,49,49,51,117,110,105,
+50,48,66,48,108,105,114,97,117,110,105,50,49,54,67,117,110,105,49,68,51,56,
+117,110,105,48,50,57,70,117,110,105,49,68,65,66,76,97,99,117,116,101,117,
+110,105,49,69,51,67,117,110,105,49,69,51,65,117,110,105,49,69,51,54,117,110,
+105,49,69,51,56,76,99,111,109,109,97,97,99,99,101,110,116,76,100,111,116,
+76,99,97,114,111,110,117,110,105,48,50,51,68,117,110,105,65,55,52,56,117,
+110,105,50,67,54,48,117,110,105,50,67,54,50,117,110,105,49,68,48,67,117,110,
+105,65,55,65,68,117,110,105,65,55,52,54,117,110,105,65,55,56,48,117,110,105,
+48,49,67,56,117,110,105,48,49,67,55,117,110,105,49,69,70,65,117,110,105,50,
+49,55,70,117,110,105,50,48,57,56,117,110,105,49,68,53,48,117,110,105,48,51,
+54,66,117,110,105,49,69,51,70,117,110,105,49,69,52,49,117,110,105,49,69,52,
+51,117,110,105,49,68,56,54,117,110,105,49,68,54,70,117,110,105,50,48,65,53,
+117,110,105,65,55,55,51,117,110,105,48,50,55,49,117,110,105,49,68,65,67,117,
+110,105,48,50,54,70,117,110,105,49,68,53,65,117,110,105,48,50,55,48,117,110,
+105,49,68,65,68,117,110,105,49,68,49,70,117,110,105,48,52,51,67,117,110,105,
+48,52,67,69,117,110,105,48,52,49,67,117,110,105,50,49,54,70,117,110,105,49,
+68,51,57,117,110,105,49,68,48,68,117,110,105,49,69,51,69,117,110,105,49,69,
+52,48,117,110,105,49,69,52,50,117,110,105,50,67,54,69,117,110,105,65,55,70,
+65,117,110,105,48,49,57,67,117,110,105,65,55,70,68,117,110,105,65,55,70,70,
+117,110,105,48,52,67,68,117,110,105,50,49,51,53,117,110,105,50,48,57,57,117,
+110,105,50,48,55,70,110,97,99,117,116,101,117,110,105,48,49,70,57,110,99,
+97,114,111,110,117,110,105,49,69,52,53,117,110,105,49,69,52,66,117,110,105,
+49,69,52,57,117,110,105,49,69,52,55,110,99,111,109,109,97,97,99,99,101,110,
+116,117,110,105,49,68,56,55,117,110,105,49,68,55,48,117,110,105,65,55,65,
+53,117,110,105,65,55,55,52,117,110,105,48,50,55,50,117,110,105,49,68,65,69,
+101,110,103,117,110,105,49,68,53,49,117,110,105,48,50,55,51,117,110,105,49,
+68,65,70,117,110,105,48,50,51,53,117,110,105,65,55,57,49,117,110,105,48,49,
+57,69,117,110,105,48,49,67,67,117,110,105,48,52,51,56,117,110,105,48,52,53,
+68,117,110,105,48,52,51,57,117,110,105,48,52,56,66,117,110,105,48,52,69,51,
+117,110,105,48,52,69,53,117,110,105,49,68,51,65,117,110,105,48,50,55,52,117,
+110,105,49,68,66,48,78,97,99,117,116,101,117,110,105,48,49,70,56,78,99,97,
+114,111,110,117,110,105,49,69,52,52,117,110,105,49,69,52,65,117,110,105,49,
+69,52,56,117,110,105,49,69,52,54,78,99,111,109,109,97,97,99,99,101,110,116,
+117,110,105,50,48,65,54,117,110,105,65,55,65,52,117,110,105,48,49,57,68,117,
+110,105,65,55,57,48,117,110,105,49,68,48,69,117,110,105,49,68,51,66,69,110,
+103,117,110,105,48,50,50,48,117,110,105,48,49,67,66,117,110,105,48,49,67,
+65,117,110,105,50,49,49,54,117,110,105,48,52,49,56,117,110,105,48,52,48,68,
+117,110,105,48,52,49,57,117,110,105,48,52,56,65,117,110,105,48,52,69,52,117,
+110,105,48,52,69,50,117,110,105,48,52,51,69,117,110,105,50,48,57,50,117,110,
+105,49,68,53,50,117,110,105,48,51,54,54,111,104,117,110,103,97,114,117,109,
+108,97,117,116,117,110,105,48,50,48,68,117,110,105,49,69,68,49,117,110,105,
+49,69,68,51,117,110,105,49,69,68,55,117,110,105,49,69,68,53,117,110,105,49,
+69,68,57,117,110,105,48,50,48,70,111,98,114,101,118,101,117,110,105,48,49,
+68,50,117,110,105,49,69,52,68,117,110,105,48,50,50,68,117,110,105,49,69,52,
+70,111,109,97,99,114,111,110,117,110,105,49,69,53,51,117,110,105,49,69,53,
+49,117,110,105,48,52,69,55,117,110,105,48,50,50,66,117,110,105,48,50,50,70,
+117,110,105,48,50,51,49,117,110,105,49,69,67,70,117,110,105,49,69,67,68,117,
+110,105,48,49,69,66,117,110,105,48,49,69,68,117,110,105,48,49,56,68,117,110,
+105,48,50,55,53,117,110,105,48,52,69,57,117,110,105,49,68,66,49,117,110,105,
+48,52,69,66,116,104,101,116,97,117,110,105,65,55,52,66,117,110,105,49,68,
+66,70,117,110,105,48,52,55,51,111,115,108,97,115,104,97,99,117,116,101,101,
+109,112,116,121,115,101,116,117,110,105,65,55,52,68,117,110,105,65,55,55,
+65,111,104,111,114,110,117,110,105,49,69,68,66,117,110,105,49,69,68,68,117,
+110,105,49,69,69,49,117,110,105,49,69,68,70,117,110,105,49,69,69,51,115,105,
+103,109,97,117,110,105,48,52,65,57,117,110,105,49,68,49,49,117,110,105,49,
+68,49,51,117,110,105,65,55,70,57,117,110,105,49,68,49,52,117,110,105,48,49,
+65,51,117,110,105,65,55,52,70,117,110,105,48,50,50,51,117,110,105,49,68,49,
+55,117,110,105,49,68,53,53,117,110,105,49,68,49,54,117,110,105,49,68,53,52,
+117,110,105,48,52,49,69,117,110,105,49,68,51,67,117,110,105,49,68,48,70,79,
+104,117,110,103,97,114,117,109,108,97,117,116,117,110,105,48,50,48,67,117,
+110,105,49,69,68,48,117,110,105,49,69,68,50,117,110,105,49,69,68,54,117,110,
+105,49,69,68,52,117,110,105,49,69,68,56,117,110,105,48,50,48,69,79,98,114,
+101,118,101,117,110,105,48,49,68,49,117,110,105,49,69,52,67,117,110,105,48,
+50,50,67,117,110,105,49,69,52,69,79,109,97,99,114,111,110,117,110,105,49,
+69,53,50,117,110,105,49,69,53,48,117,110,105,48,52,69,54,117,110,105,48,50,
+50,65,117,110,105,48,50,50,69,117,110,105,48,50,51,48,117,110,105,49,69,67,
+69,117,110,105,49,69,67,67,117,110,105,48,49,69,65,117,110,105,48,49,69,67,
+117,110,105,48,49,57,70,117,110,105,48,52,69,56,117,110,105,48,52,69,65,84,
+104,101,116,97,117,110,105,65,55,52,65,117,110,105,48,52,55,50,79,115,108,
+97,115,104,97,99,117,116,101,117,110,105,65,55,52,67,117,110,105,65,55,55,
+57,79,104,111,114,110,117,110,105,49,69,68,65,117,110,105,49,69,68,67,117,
+110,105,49,69,69,48,117,110,105,49,69,68,69,117,110,105,49,69,69,50,117,110,
+105,48,52,65,56,117,110,105,48,50,55,54,117,110,105,48,49,65,50,117,110,105,
+65,55,52,69,117,110,105,48,50,50,50,117,110,105,49,68,51,68,117,110,105,49,
+68,49,53,117,110,105,48,51,65,57,117,110,105,65,66,54,53,117,110,105,48,50,
+57,56,117,110,105,48,52,52,48,117,110,105,50,48,57,65,117,110,105,49,68,53,
+54,117,110,105,49,69,53,53,117,110,105,49,69,53,55,117,110,105,49,68,56,56,
+117,110,105,49,68,55,68,117,110,105,65,55,53,49,117,110,105,48,52,56,70,117,
+110,105,49,68,55,49,117,110,105,48,49,65,53,117,110,105,65,55,54,53,117,110,
+105,65,55,54,55,117,110,105,65,55,53,53,117,110,105,65,55,53,51,117,110,105,
+48,53,49,55,117,110,105,48,49,66,70,114,104,111,117,110,105,49,68,54,56,117,
+110,105,48,50,55,56,117,110,105,49,68,66,50,117,110,105,48,52,52,52,112,104,
+105,117,110,105,49,68,54,57,117,110,105,49,68,54,48,117,110,105,50,67,55,
+55,117,110,105,48,52,50,48,117,110,105,49,68,51,69,117,110,105,49,68,49,56,
+117,110,105,49,68,50,57,117,110,105,49,69,53,52,117,110,105,49,69,53,54,117,
+110,105,50,67,54,51,117,110,105,65,55,53,48,117,110,105,48,52,56,69,117,110,
+105,48,49,65,52,117,110,105,65,55,53,52,117,110,105,65,55,53,50,117,110,105,
+50,49,49,55,117,110,105,48,53,49,54,117,110,105,50,48,66,68,117,110,105,50,
+48,66,49,112,101,115,101,116,97,117,110,105,65,55,54,52,117,110,105,65,55,
+54,54,117,110,105,48,49,70,55,117,110,105,65,55,70,67,117,110,105,48,52,50,
+52,117,110,105,48,53,49,66,117,110,105,65,55,53,55,117,110,105,65,55,53,57,
+117,110,105,48,50,65,48,117,110,105,48,50,52,66,117,110,105,48,49,65,65,117,
+110,105,48,50,51,57,117,110,105,48,53,49,65,117,110,105,48,50,52,65,117,110,
+105,65,55,53,54,117,110,105,65,55,53,56,117,110,105,49,68,54,51,117,110,105,
+49,68,67,65,117,110,105,48,50,66,51,117,110,105,48,51,54,67,114,97,99,117,
+116,101,117,110,105,48,50,49,49,117,110,105,48,50,49,51,114,99,97,114,111,
+110,117,110,105,49,69,53,57,117,110,105,49,69,53,70,117,110,105,49,69,53,
+66,117,110,105,49,69,53,68,114,99,111,109,109,97,97,99,99,101,110,116,117,
+110,105,49,68,56,57,117,110,105,48,50,52,68,117,110,105,49,68,55,50,117,110,
+105,65,55,65,55,117,110,105,48,50,55,68,117,110,105,48,50,55,67,117,110,105,
+65,55,53,66,117,110,105,65,55,53,68,117,110,105,65,55,56,51,117,110,105,65,
+55,56,53,117,110,105,65,55,55,67,117,110,105,48,50,55,57,117,110,105,48,50,
+66,52,117,110,105,48,50,55,66,117,110,105,48,50,66,53,117,110,105,48,50,55,
+65,117,110,105,50,67,55,57,117,110,105,48,50,55,69,117,110,105,49,68,55,51,
+117,110,105,65,55,55,53,117,110,105,48,50,56,53,117,110,105,48,50,55,70,117,
+110,105,49,68,51,70,117,110,105,48,50,56,48,82,97,99,117,116,101,117,110,
+105,48,50,49,48,117,110,105,48,50,49,50,82,99,97,114,111,110,117,110,105,
+49,69,53,56,117,110,105,49,69,53,69,117,110,105,49,69,53,65,117,110,105,49,
+69,53,67,82,99,111,109,109,97,97,99,99,101,110,116,117,110,105,48,50,52,67,
+117,110,105,65,55,65,54,117,110,105,50,67,54,52,117,110,105,65,55,53,65,117,
+110,105,65,55,53,67,117,110,105,65,55,56,50,117,110,105,65,55,56,52,117,110,
+105,65,55,55,66,117,110,105,48,49,65,54,117,110,105,50,48,65,56,117,110,105,
+50,48,66,57,117,110,105,50,49,49,70,117,110,105,49,68,49,65,117,110,105,48,
+50,56,49,117,110,105,48,50,66,54,117,110,105,65,55,55,54,117,110,105,48,52,
+50,70,117,110,105,49,68,49,57,117,110,105,48,52,52,70,117,110,105,48,53,49,
+57,117,110,105,48,53,49,56,117,110,105,48,52,53,53,117,110,105,50,48,57,66,
+117,110,105,48,50,69,50,115,97,99,117,116,101,117,110,105,49,69,54,53,115,
+99,105,114,99,117,109,102,108,101,120,117,110,105,49,69,54,55,117,110,105,
+49,69,54,49,117,110,105,49,69,54,51,117,110,105,49,69,54,57,117,110,105,48,
+50,49,57,115,99,101,100,105,108,108,97,117,110,105,48,50,56,50,117,110,105,
+49,68,66,51,117,110,105,49,68,56,65,117,110,105,49,68,55,52,117,110,105,65,
+55,65,57,117,110,105,48,50,51,70,117,110,105,48,49,65,56,117,110,105,48,50,
+56,51,117,110,105,49,68,66,52,117,110,105,49,68,57,56,117,110,105,49,68,56,
+66,117,110,105,48,50,56,54,117,110,105,65,55,55,56,117,110,105,48,52,48,53,
+117,110,105,65,55,51,49,83,97,99,117,116,101,117,110,105,49,69,54,52,83,99,
+105,114,99,117,109,102,108,101,120,117,110,105,49,69,54,54,117,110,105,49,
+69,54,48,117,110,105,49,69,54,50,117,110,105,49,69,54,56,117,110,105,48,50,
+49,56,83,99,101,100,105,108,108,97,117,110,105,65,55,65,56,117,110,105,50,
+67,55,69,117,110,105,48,49,65,55,117,110,105,50,48,66,52,117,110,105,50,48,
+66,55,117,110,105,50,48,57,67,117,110,105,49,68,53,55,117,110,105,48,51,54,
+68,117,110,105,49,69,57,55,117,110,105,49,69,54,66,117,110,105,49,69,55,49,
+117,110,105,49,69,54,70,117,110,105,49,69,54,68,117,110,105,48,50,49,66,116,
+99,97,114,111,110,117,110,105,48,49,54,51,117,110,105,48,49,65,66,117,110,
+105,49,68,66,53,116,98,97,114,117,110,105,49,68,55,53,117,110,105,50,67,54,
+54,117,110,105,48,49,65,68,117,110,105,48,50,56,56,117,110,105,48,50,51,54,
+117,110,105,65,55,55,55,117,110,105,49,68,55,65,117,110,105,48,50,65,56,117,
+110,105,48,50,65,54,117,110,105,48,50,65,55,117,110,105,65,55,50,57,117,110,
+105,65,55,56,55,117,110,105,48,50,56,55,117,110,105,48,52,52,50,117,110,105,
+48,52,65,68,117,110,105,48,53,48,70,117,110,105,48,52,66,53,117,110,105,48,
+52,50,50,117,110,105,49,68,52,48,117,110,105,49,68,49,66,84,99,97,114,111,
+110,117,110,105,50,48,66,56,117,110,105,49,69,54,65,117,110,105,49,69,55,
+48,117,110,105,49,69,54,69,117,110,105,49,69,54,67,117,110,105,48,50,49,65,
+117,110,105,48,49,54,50,84,98,97,114,117,110,105,50,48,65,69,117,110,105,
+48,50,51,69,117,110,105,48,49,65,67,117,110,105,48,49,65,69,117,110,105,65,
+55,50,56,117,110,105,65,55,56,54,117,110,105,65,55,66,49,117,110,105,48,52,
+65,67,117,110,105,48,53,48,69,117,110,105,48,52,66,52,117,110,105,48,52,48,
+66,117,110,105,48,52,48,50,117,110,105,49,68,54,52,117,110,105,49,68,53,56,
+117,110,105,48,51,54,55,117,104,117,110,103,97,114,117,109,108,97,117,116,
+117,110,105,48,50,49,53,117,110,105,48,50,49,55,117,98,114,101,118,101,117,
+110,105,48,49,68,52,117,116,105,108,100,101,117,110,105,49,69,55,57,117,109,
+97,99,114,111,110,117,110,105,49,69,55,66,117,110,105,48,49,68,56,117,110,
+105,48,49,68,67,117,110,105,48,49,68,65,117,110,105,48,49,68,54,117,114,105,
+110,103,117,110,105,49,69,69,55,117,110,105,49,69,55,55,117,110,105,49,69,
+55,53,117,110,105,49,69,55,51,117,110,105,49,69,69,53,117,111,103,111,110,
+101,107,117,110,105,49,68,57,57,117,110,105,48,50,56,57,117,110,105,49,68,
+66,54,117,104,111,114,110,117,110,105,49,69,69,57,117,110,105,49,69,69,66,
+117,110,105,49,69,69,70,117,110,105,49,69,69,68,117,110,105,49,69,70,49,117,
+110,105,49,68,54,66,117,110,105,49,68,49,68,117,110,105,49,68,53,57,117,110,
+105,49,68,49,69,117,110,105,48,50,56,66,117,110,105,49,68,66,57,117,110,105,
+48,51,66,67,117,110,105,48,50,56,65,117,110,105,49,68,66,55,117,110,105,49,
+68,55,70,117,110,105,49,68,52,49,117,110,105,49,68,49,67,117,110,105,49,68,
+66,56,85,104,117,110,103,97,114,117,109,108,97,117,116,117,110,105,48,50,
+49,52,117,110,105,48,50,49,54,85,98,114,101,118,101,117,110,105,48,49,68,
+51,85,116,105,108,100,101,117,110,105,49,69,55,56,85,109,97,99,114,111,110,
+117,110,105,49,69,55,65,117,110,105,48,49,68,55,117,110,105,48,49,68,66,117,
+110,105,48,49,68,57,117,110,105,48,49,68,53,85,114,105,110,103,117,110,105,
+49,69,69,54,117,110,105,49,69,55,54,117,110,105,49,69,55,52,117,110,105,49,
+69,55,50,117,110,105,49,69,69,52,85,111,103,111,110,101,107,117,110,105,48,
+50,52,52,117,110,105,49,68,55,69,85,104,111,114,110,117,110,105,49,69,69,
+56,117,110,105,49,69,69,65,117,110,105,49,69,69,69,117,110,105,49,69,69,67,
+117,110,105,49,69,70,48,117,110,105,48,49,66,50,117,110,105,65,55,53,69,117,
+110,105,65,55,54,48,117,110,105,65,55,54,56,117,110,105,48,49,66,49,117,110,
+105,50,49,55,52,117,110,105,49,68,54,53,117,110,105,49,68,53,66,117,110,105,
+48,51,54,69,117,110,105,49,69,55,68,117,110,105,49,69,55,70,117,110,105,49,
+68,56,67,117,110,105,50,67,55,49,117,110,105,48,52,55,52,117,110,105,50,67,
+55,52,117,110,105,65,55,53,70,117,110,105,65,55,54,49,117,110,105,65,55,54,
+57,117,110,105,50,49,55,53,117,110,105,50,49,55,54,117,110,105,50,49,55,55,
+117,110,105,48,50,56,67,117,110,105,49,68,66,65,117,110,105,48,50,54,52,117,
+110,105,48,50,54,51,117,110,105,48,50,69,48,103,97,109,109,97,117,110,105,
+49,68,54,55,117,110,105,49,68,53,69,117,110,105,50,49,54,52,117,110,105,50,
+67,55,68,117,110,105,49,68,50,48,117,110,105,49,69,55,67,117,110,105,49,69,
+55,69,117,110,105,50,49,50,51,117,110,105,48,52,55,53,117,110,105,50,49,54,
+53,117,110,105,50,49,54,54,117,110,105,50,49,54,55,117,110,105,48,50,52,53,
+117,110,105,49,68,50,55,117,110,105,48,49,57,52,117,110,105,48,53,49,68,117,
+110,105,48,50,66,55,119,97,99,117,116,101,119,103,114,97,118,101,119,99,105,
+114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,115,117,110,
+105,49,69,56,55,117,110,105,49,69,57,56,117,110,105,49,69,56,57,117,110,105,
+50,67,55,51,117,110,105,48,50,65,67,117,110,105,48,50,56,68,111,109,101,103,
+97,117,110,105,48,50,55,55,117,110,105,48,53,49,67,117,110,105,49,68,52,50,
+117,110,105,49,68,50,49,87,97,99,117,116,101,87,103,114,97,118,101,87,99,
+105,114,99,117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,117,
+110,105,49,69,56,54,117,110,105,49,69,56,56,117,110,105,50,67,55,50,117,110,
+105,50,48,65,57,117,110,105,48,52,52,53,117,110,105,50,49,55,57,117,110,105,
+50,48,57,51,117,110,105,48,50,69,51,117,110,105,48,51,54,70,117,110,105,49,
+69,56,68,117,110,105,49,69,56,66,117,110,105,49,68,56,68,117,110,105,48,52,
+70,70,117,110,105,48,52,70,68,117,110,105,48,52,66,51,117,110,105,50,49,55,
+65,117,110,105,50,49,55,66,99,104,105,117,110,105,49,68,54,65,117,110,105,
+49,68,54,49,117,110,105,48,52,50,53,117,110,105,50,49,54,57,117,110,105,49,
+69,56,67,117,110,105,49,69,56,65,117,110,105,48,52,70,69,117,110,105,48,52,
+70,67,117,110,105,48,52,66,50,117,110,105,50,49,54,65,117,110,105,50,49,54,
+66,117,110,105,48,52,52,51,117,110,105,48,50,66,56,117,110,105,48,52,70,51,
+121,103,114,97,118,101,121,99,105,114,99,117,109,102,108,101,120,117,110,
+105,48,52,53,69,117,110,105,49,69,70,57,117,110,105,48,50,51,51,117,110,105,
+48,52,69,70,117,110,105,48,52,70,49,117,110,105,49,69,56,70,117,110,105,49,
+69,57,57,117,110,105,49,69,70,55,117,110,105,49,69,70,53,117,110,105,48,50,
+52,70,117,110,105,48,49,66,52,117,110,105,49,69,70,70,117,110,105,48,52,65,
+70,117,110,105,48,52,66,49,117,110,105,48,50,56,69,108,97,109,98,100,97,117,
+110,105,48,49,57,66,117,110,105,48,52,52,55,117,110,105,48,52,70,53,117,110,
+105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,48,52,67,67,117,110,105,
+48,53,50,68,117,110,105,48,52,65,69,117,110,105,48,50,56,70,89,103,114,97,
+118,101,89,99,105,114,99,117,109,102,108,101,120,117,110,105,49,69,70,56,
+117,110,105,48,50,51,50,117,110,105,49,69,56,69,117,110,105,49,69,70,54,117,
+110,105,49,69,70,52,117,110,105,48,50,52,69,117,110,105,48,52,66,48,117,110,
+105,48,49,66,51,117,110,105,49,69,70,69,117,110,105,48,52,50,51,117,110,105,
+48,52,70,50,117,110,105,48,52,48,69,117,110,105,48,52,69,69,117,110,105,48,
+52,70,48,117,110,105,48,52,50,55,117,110,105,48,52,70,52,117,110,105,48,52,
+66,56,117,110,105,48,52,66,54,117,110,105,48,52,67,66,117,110,105,48,53,50,
+67,80,115,105,117,110,105,49,68,50,65,117,110,105,49,68,66,66,122,97,99,117,
+116,101,117,110,105,49,69,57,49,122,100,111,116,97,99,99,101,110,116,117,
+110,105,49,69,57,53,117,110,105,49,69,57,51,117,110,105,48,50,57,48,117,110,
+105,49,68,66,67,117,110,105,49,68,56,69,117,110,105,48,49,66,54,117,110,105,
+49,68,55,54,117,110,105,48,50,57,49,117,110,105,49,68,66,68,117,110,105,48,
+50,50,53,117,110,105,50,67,54,67,117,110,105,48,50,52,48,117,110,105,65,55,
+54,51,117,110,105,49,68,50,50,90,97,99,117,116,101,117,110,105,49,69,57,48,
+90,100,111,116,97,99,99,101,110,116,117,110,105,49,69,57,52,117,110,105,49,
+69,57,50,117,110,105,48,49,66,53,117,110,105,48,50,50,52,117,110,105,50,67,
+54,66,117,110,105,50,67,55,70,117,110,105,65,55,54,50,117,110,105,48,49,65,
+57,117,110,105,48,50,57,50,117,110,105,48,52,69,49,117,110,105,49,68,66,69,
+117,110,105,48,49,69,70,117,110,105,49,68,57,65,117,110,105,48,50,57,51,117,
+110,105,48,49,66,65,117,110,105,48,49,66,57,117,110,105,65,55,50,66,117,110,
+105,48,50,49,68,117,110,105,65,55,54,66,117,110,105,48,49,66,55,117,110,105,
+48,52,69,48,117,110,105,49,68,50,51,117,110,105,48,49,69,69,117,110,105,48,
+49,66,56,117,110,105,65,55,50,65,117,110,105,48,50,49,67,117,110,105,65,55,
+54,65,117,110,105,48,50,57,52,117,110,105,48,50,67,48,117,110,105,48,50,52,
+50,117,110,105,48,50,52,49,117,110,105,48,50,65,49,117,110,105,48,50,57,53,
+117,110,105,48,50,67,49,117,110,105,48,50,69,52,117,110,105,48,50,65,50,117,
+110,105,48,50,57,54,117,110,105,48,49,66,69,117,110,105,49,68,50,52,117,110,
+105,49,68,50,53,117,110,105,49,68,53,67,117,110,105,50,49,52,70,117,110,105,
+50,48,65,65,117,110,105,50,48,66,66,117,110,105,50,48,66,67,117,110,105,50,
+48,56,48,117,110,105,50,48,55,48,117,110,105,50,48,56,49,117,110,105,50,48,
+56,50,117,110,105,48,49,66,66,117,110,105,50,49,56,57,117,110,105,50,48,56,
+51,117,110,105,50,48,56,52,117,110,105,50,48,55,52,117,110,105,65,55,50,67,
+117,110,105,65,55,50,69,117,110,105,65,55,50,68,117,110,105,65,55,50,70,117,
+110,105,50,48,56,53,117,110,105,50,48,55,53,117,110,105,48,49,66,67,117,110,
+105,48,49,66,68,117,110,105,50,48,56,54,117,110,105,50,48,55,54,117,110,105,
+49,69,70,68,117,110,105,49,69,70,67,117,110,105,50,48,56,55,117,110,105,50,
+48,55,55,117,110,105,50,48,56,56,117,110,105,50,48,55,56,117,110,105,50,48,
+56,57,117,110,105,50,48,55,57,117,110,105,65,55,54,69,117,110,105,65,55,54,
+70,117,110,105,65,55,55,48,117,110,105,50,49,53,70,117,110,105,50,49,53,50,
+117,110,105,50,49,53,53,117,110,105,50,49,53,57,117,110,105,50,49,53,48,117,
+110,105,50,49,53,49,117,110,105,50,49,53,54,117,110,105,50,49,53,55,117,110,
+105,50,49,53,56,117,110,105,50,49,53,65,117,110,105,48,49,67,51,117,110,105,
+65,55,49,68,117,110,105,65,55,49,70,117,110,105,65,55,49,69,101,120,99,108,
+97,109,100,98,108,117,110,105,65,55,56,66,117,110,105,65,55,56,67,117,110,
+105,48,50,70,56,117,110,105,65,55,56,57,117,110,105,48,50,66,66,117,110,105,
+48,51,49,50,113,117,111,116,101,114,101,118,101,114,115,101,100,117,110,105,
+48,50,66,68,117,110,105,48,51,49,52,117,110,105,48,50,66,67,117,110,105,50,
+48,49,70,117,110,105,48,50,69,69,117,110,105,48,50,68,48,117,110,105,48,50,
+68,49,97,110,111,116,101,108,101,105,97,117,110,105,50,48,50,55,117,110,105,
+50,50,49,57,117,110,105,50,48,56,68,117,110,105,50,48,55,68,117,110,105,50,
+48,56,69,117,110,105,50,48,55,69,117,110,105,50,55,69,54,117,110,105,50,55,
+69,55,117,110,105,50,51,48,56,117,110,105,50,51,49,67,117,110,105,50,51,48,
+57,117,110,105,50,51,49,68,117,110,105,50,51,48,65,117,110,105,50,51,49,69,
+117,110,105,50,51,48,66,117,110,105,50,51,49,70,117,110,105,50,51,57,66,117,
+110,105,50,51,57,67,117,110,105,50,51,57,68,117,110,105,50,51,57,69,117,110,
+105,50,51,57,70,117,110,105,50,51,65,48,117,110,105,50,51,65,49,117,110,105,
+50,51,65,50,117,110,105,50,51,65,51,117,110,105,50,51,65,52,117,110,105,50,
+51,65,53,117,110,105,50,51,65,54,117,110,105,50,51,65,55,117,110,105,50,51,
+65,56,117,110,105,50,51,65,65,117,110,105,50,51,65,57,117,110,105,50,51,65,
+66,117,110,105,50,51,65,67,117,110,105,50,51,65,68,117,110,105,48,49,67,48,
+117,110,105,48,49,67,49,117,110,105,48,49,67,50,117,110,105,50,48,49,54,117,
+110,105,50,50,50,53,117,110,105,50,50,50,54,117,110,105,50,50,51,52,117,110,
+105,50,50,51,53,117,110,105,50,50,54,50,117,110,105,50,50,56,50,117,110,105,
+50,50,56,54,117,110,105,50,50,56,52,117,110,105,50,50,56,51,117,110,105,50,
+50,56,55,117,110,105,50,50,56,53,117,110,105,48,50,67,67,117,110,105,48,50,
+67,56,117,110,105,48,51,51,55,117,110,105,48,51,51,56,117,110,105,50,48,69,
+53,117,110,105,50,48,52,49,117,110,105,50,48,49,48,117,110,105,50,48,49,49,
+117,110,105,48,48,65,68,117,110,105,50,69,51,65,117,110,105,50,69,51,66,117,
+110,105,50,48,49,53,117,110,105,48,50,68,55,117,110,105,50,48,56,66,117,110,
+105,50,48,55,66,117,110,105,48,51,50,48,117,110,105,48,51,51,53,117,110,105,
+48,51,51,54,117,110,105,48,50,67,70,117,110,105,48,51,49,55,117,110,105,48,
+50,67,65,97,99,117,116,101,99,111,109,98,109,105,110,117,116,101,117,110,
+105,48,50,66,57,115,101,99,111,110,100,117,110,105,48,50,66,65,117,110,105,
+48,50,70,54,117,110,105,48,51,48,66,117,110,105,50,48,51,52,117,110,105,50,
+48,53,55,117,110,105,48,50,67,69,117,110,105,48,51,49,54,117,110,105,48,50,
+70,52,117,110,105,48,50,67,66,103,114,97,118,101,99,111,109,98,117,110,105,
+50,48,51,53,117,110,105,50,48,51,54,117,110,105,48,50,70,53,117,110,105,48,
+51,48,70,117,110,105,50,48,51,55,117,110,105,50,48,51,56,117,110,105,48,51,
+50,68,117,110,105,65,55,56,56,117,110,105,48,51,48,50,117,110,105,48,51,50,
+70,117,110,105,48,51,49,49,117,110,105,48,51,53,50,117,110,105,50,48,52,48,
+117,110,105,48,51,54,49,117,110,105,70,69,50,48,117,110,105,70,69,50,49,117,
+110,105,65,57,50,69,117,110,105,48,51,50,69,117,110,105,48,51,48,54,117,110,
+105,48,51,49,48,117,110,105,49,68,67,66,117,110,105,50,48,51,70,117,110,105,
+48,51,53,67,117,110,105,48,51,53,68,117,110,105,49,68,67,68,117,110,105,48,
+50,69,67,117,110,105,48,51,50,67,117,110,105,48,51,48,67,117,110,105,49,68,
+67,55,117,110,105,49,68,67,52,117,110,105,49,68,67,67,117,110,105,49,68,67,
+53,117,110,105,49,68,67,54,117,110,105,49,68,67,57,117,110,105,49,68,67,56,
+117,110,105,48,50,70,55,117,110,105,48,51,51,48,117,110,105,48,51,51,52,116,
+105,108,100,101,99,111,109,98,117,110,105,48,51,52,65,115,105,109,105,108,
+97,114,117,110,105,50,48,53,51,117,110,105,48,51,52,67,117,110,105,49,68,
+70,68,117,110,105,48,51,52,66,117,110,105,48,51,54,48,117,110,105,70,69,50,
+50,117,110,105,70,69,50,51,117,110,105,48,51,51,69,117,110,105,48,51,53,66,
+117,110,105,48,51,53,57,117,110,105,48,51,53,51,117,110,105,48,50,68,70,117,
+110,105,48,51,51,68,117,110,105,48,51,50,66,117,110,105,48,51,51,67,117,110,
+105,48,50,67,68,117,110,105,48,51,51,49,117,110,105,48,50,67,57,117,110,105,
+48,51,48,52,117,110,105,48,51,53,70,117,110,105,48,51,53,69,117,110,105,48,
+51,51,50,117,110,105,48,51,48,53,117,110,100,101,114,115,99,111,114,101,100,
+98,108,117,110,105,48,51,51,51,117,110,105,48,51,52,55,117,110,105,48,51,
+51,70,117,110,105,48,50,69,68,117,110,105,65,55,56,65,117,110,105,50,48,56,
+67,117,110,105,50,48,55,67,117,110,105,50,50,53,70,101,113,117,105,118,97,
+108,101,110,99,101,117,110,105,50,50,49,51,117,110,105,48,51,50,52,117,110,
+105,48,51,48,56,100,111,116,98,101,108,111,119,99,111,109,98,117,110,105,
+48,51,48,55,117,110,105,48,51,53,56,117,110,105,48,51,50,54,117,110,105,48,
+51,49,51,117,110,105,48,51,49,53,117,110,105,48,51,49,66,117,110,105,48,50,
+70,51,117,110,105,48,51,50,53,117,110,105,48,51,48,65,117,110,105,48,51,53,
+65,117,110,105,48,51,49,67,117,110,105,48,50,68,51,117,110,105,48,50,66,70,
+117,110,105,48,51,53,49,117,110,105,48,51,51,57,117,110,105,48,50,68,50,117,
+110,105,48,50,66,69,117,110,105,48,51,53,55,117,110,105,65,55,50,52,117,110,
+105,65,55,50,53,117,110,105,65,55,50,50,117,110,105,65,55,50,51,104,111,111,
+107,97,98,111,118,101,99,111,109,98,117,110,105,48,51,50,57,117,110,105,48,
+51,48,68,117,110,105,48,51,52,56,117,110,105,48,51,48,69,117,110,105,50,48,
+56,65,117,110,105,48,51,49,70,117,110,105,48,50,68,54,117,110,105,50,48,55,
+65,117,110,105,48,51,49,69,117,110,105,48,50,68,53,117,110,105,48,51,49,68,
+117,110,105,48,50,68,52,117,110,105,48,51,49,56,117,110,105,48,51,49,57,117,
+110,105,48,50,69,66,117,110,105,48,50,69,65,117,110,105,48,51,52,57,117,110,
+105,48,51,49,65,117,110,105,65,55,49,55,117,110,105,65,55,49,56,117,110,105,
+65,55,49,57,117,110,105,65,55,49,65,117,110,105,65,55,50,48,117,110,105,65,
+55,50,49,117,110,105,48,50,70,69,117,110,105,48,50,70,68,117,110,105,48,50,
+65,68,117,110,105,48,51,50,55,117,110,105,48,51,50,56,117,110,105,49,68,67,
+50,117,110,105,48,51,50,65,117,110,105,48,51,52,54,117,110,105,48,51,51,65,
+117,110,105,50,52,50,51,117,110,105,48,51,51,66,117,110,105,48,50,68,69,117,
+110,105,65,55,48,56,117,110,105,65,55,48,57,117,110,105,65,55,48,65,117,110,
+105,65,55,48,66,117,110,105,65,55,48,67,117,110,105,48,50,69,53,117,110,105,
+48,50,69,54,117,110,105,48,50,69,55,117,110,105,48,50,69,56,117,110,105,48,
+50,69,57,117,110,105,65,55,48,68,117,110,105,65,55,48,69,117,110,105,65,55,
+48,70,117,110,105,65,55,49,48,117,110,105,65,55,49,49,117,110,105,65,55,49,
+50,117,110,105,65,55,49,51,117,110,105,65,55,49,52,117,110,105,65,55,49,53,
+117,110,105,65,55,49,54,117,110,105,50,55,52,68,117,110,105,50,48,50,51,97,
+114,114,111,119,100,111,119,110,117,110,105,50,49,56,54,117,110,105,65,55,
+49,67,97,114,114,111,119,117,112,117,110,105,65,55,49,66,117,110,105,48,51,
+52,69,97,114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,
+98,115,101,97,114,114,111,119,108,101,102,116,117,110,105,50,48,69,69,117,
+110,105,50,48,69,68,117,110,105,48,50,70,70,97,114,114,111,119,114,105,103,
+104,116,117,110,105,50,48,69,70,117,110,105,50,48,69,67,117,110,105,48,51,
+54,50,97,114,114,111,119,98,111,116,104,117,110,105,48,51,52,68,117,110,105,
+50,49,57,65,117,110,105,50,49,57,66,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,117,110,105,50,49,68,53,97,
+114,114,111,119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,
+114,105,103,104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,
+105,50,49,57,54,117,110,105,50,49,57,56,117,110,105,50,49,57,55,117,110,105,
+50,49,57,57,117,110,105,50,55,49,51,117,110,105,48,50,67,53,117,110,105,48,
+50,69,70,117,110,105,48,50,67,52,117,110,105,48,50,70,48,117,110,105,48,50,
+67,50,117,110,105,49,68,70,69,117,110,105,48,51,53,52,117,110,105,48,50,70,
+49,97,110,103,108,101,108,101,102,116,117,110,105,48,50,67,51,117,110,105,
+48,51,53,48,117,110,105,48,51,53,53,117,110,105,48,50,70,50,97,110,103,108,
+101,114,105,103,104,116,117,110,105,48,51,53,54,117,110,105,49,68,70,70,117,
+110,105,50,54,52,48,117,110,105,50,54,52,50,117,110,105,50,54,54,68,117,110,
+105,50,54,54,70,117,110,105,65,55,48,50,117,110,105,65,55,48,48,117,110,105,
+65,55,48,52,117,110,105,65,55,48,54,117,110,105,65,55,48,51,117,110,105,65,
+55,48,49,117,110,105,65,55,48,53,117,110,105,65,55,48,55,117,110,105,48,51,
+52,70,117,110,105,50,48,54,49,117,110,105,50,48,54,51,117,110,105,50,48,54,
+50,117,110,105,50,48,50,65,117,110,105,50,48,48,69,117,110,105,50,48,50,68,
+117,110,105,50,48,50,67,117,110,105,50,48,50,66,117,110,105,50,48,48,70,117,
+110,105,50,48,50,69,117,110,105,50,48,54,48,117,110,105,50,48,48,68,117,110,
+105,50,48,48,67,117,110,105,50,48,48,66,117,110,105,50,48,54,68,117,110,105,
+50,48,54,66,117,110,105,50,48,54,67,117,110,105,50,48,54,65,117,110,105,50,
+48,50,56,117,110,105,50,48,54,69,117,110,105,50,48,54,70,117,110,105,50,48,
+50,57,117,110,105,50,48,48,49,117,110,105,50,48,48,51,117,110,105,50,48,50,
+70,117,110,105,50,48,48,56,117,110,105,50,48,48,54,117,110,105,50,48,48,52,
+117,110,105,50,48,48,48,117,110,105,50,48,48,50,117,110,105,50,48,48,53,117,
+110,105,50,48,48,55,117,110,105,50,48,48,57,117,110,105,50,48,48,65,117,110,
+105,70,70,70,68,117,110,105,48,50,70,57,117,110,105,48,50,70,66,117,110,105,
+48,50,70,65,117,110,105,48,50,70,67,88,105,67,111,112,121,114,105,103,104,
+116,32,40,99,41,32,83,73,76,32,73,110,116,101,114,110,97,116,105,111,110,
+97,108,44,32,49,57,57,55,45,50,48,49,52,46,67,104,97,114,105,115,32,83,73,
+76,32,73,116,97,108,105,99,67,104,97,114,105,115,32,83,73,76,78,111,114,109,
+97,108,2,177,2,0,1,0,49,0,55,0,95,0,98,0,111,0,144,1,27,1,66,1,157,1,209,
+1,223,1,229,1,232,1,252,2,15,2,36,2,135,2,192,2,211,2,217,3,3,3,135,3,167,
+3,187,3,196,3,240,4,28,4,49,4,173,4,236,5,20,5,50,5,189,6,24,6,43,6,202,6,
+214,6,250,7,4,7,11,7,38,7,83,7,183,7,236,7,245,8,122,8,171,9,85,9,127,9,157,
+9,245,9,252,10,32,10,87,10,191,10,200,11,87,11,228,12,10,12,148,13,30,13,
+39,13,74,13,77,13,160,13,204,14,48,14,81,14,196,15,68,15,94,15,223,15,255,
+16,55,16,87,16,109,16,128,16,164,17,26,17,58,17,126,17,241,18,44,18,49,18,
+160,18,222,18,240,18,249,19,103,19,143,19,206,20,17,20,123,20,145,20,241,
+20,249,21,95,21,147,21,170,21,233,22,14,22,115,22,214,22,250,23,8,23,11,23,
+27,23,103,23,187,23,223,24,13,24,23,24,37,24,71,24,76,24,168,24,174,24,209,
+25,30,25,95,25,185,25,231,26,26,26,37,26,79,26,129,26,135,26,143,26,199,27,
+30,27,68,27,93,27,126,27,210,27,247,28,37,28,67,28,127,28,195,28,244,29,0,
+29,79,29,97,29,126,29,205,29,253,30,76,30,126,30,203,30,231,31,43,31,71,31,
+79,31,84,31,118,31,194,32,0,32,68,32,143,32,147,32,156,32,178,32,239,33,0,
+33,5,33,76,33,145,33,169,33,177,33,203,33,214,34,26,34,32,34,81,34,97,34,
+118,34,147,34,157,34,182,34,203,34,223,34,253,35,58,35,63,35,104,35,135,35,
+168,35,202,35,241,36,43,36,75,36,84,36,98,36,124,36,181,36,212,36,221,36,
+233,36,240,37,40,37,56,37,81,37,111,37,141,37,196,37,251,38,25,38,30,38,84,
+38,113,38,126,38,148,38,201,38,228,38,246,39,4,39,19,39,32,39,49,39,65,39,
+115,39,142,39,157,39,165,39,200,39,247,40,26,40,73,40,77,40,125,40,154,40,
+200,40,208,40,234,40,249,41,8,41,30,41,63,41,108,41,125,41,171,41,196,41,
+203,41,248,42,34,42,79,42,115,42,124,42,145,42,164,42,188,42,212,42,255,43,
+42,43,83,43,93,43,110,43,152,43,194,43,236,44,20,44,33,44,74,44,98,44,117,
+44,156,44,168,44,185,44,216,45,0,45,16,45,29,45,42,45,55,45,94,45,108,45,
+147,45,184,45,192,45,230,45,245,45,253,46,12,46,23,46,60,46,97,46,134,46,
+149,46,185,46,221,46,236,47,4,47,11,47,46,47,81,47,104,47,137,47,148,47,165,
+47,184,47,192,47,203,47,228,47,246,48,13,48,43,48,76,48,109,48,129,48,161,
+48,188,48,220,48,244,49,18,49,36,49,54,49,69,49,82,49,105,49,134,49,147,49,
+152,49,165,49,195,49,225,49,255,50,29,50,59,50,89,50,119,50,136,50,142,50,
+171,50,176,50,201,50,230,51,3,51,32,51,59,51,86,51,106,51,134,51,153,51,181,
+51,209,51,237,51,253,52,13,52,29,52,45,52,55,52,82,52,91,52,118,52,142,52,
+169,52,196,52,221,52,247,53,17,53,43,53,60,53,69,53,95,53,119,53,134,53,149,
+53,174,53,199,53,224,53,249,54,18,54,43,54,63,54,78,54,103,54,128,54,153,
+54,175,54,188,54,199,54,206,54,211,54,235,55,3,55,27,55,39,55,63,55,87,55,
+109,55,123,55,137,55,151,55,160,55,183,55,206,55,229,55,252,56,19,56,23,56,
+29,56,51,56,73,56,95,56,117,56,136,56,155,56,174,56,196,56,218,56,231,56,
+236,56,249,57,6,57,19,57,32,57,45,57,55,57,62,57,83,57,104,57,125,57,142,
+57,159,57,172,57,193,57,214,57,233,57,253,58,17,58,27,58,47,58,67,58,87,58,
+107,58,127,58,147,58,159,58,171,58,179,58,198,58,203,58,222,58,241,59,4,59,
+23,59,42,59,61,59,80,59,99,59,118,59,137,59,156,59,175,59,194,59,211,59,219,
+59,228,59,237,59,246,60,8,60,26,60,44,60,62,60,80,60,98,60,116,60,134,60,
+152,60,170,60,188,60,206,60,224,60,242,61,4,61,15,61,26,61,37,61,48,61,59,
+61,76,61,93,61,110,61,127,61,144,61,161,61,178,61,185,61,202,61,219,61,234,
+61,249,62,9,62,25,62,41,62,57,62,63,62,79,62,95,62,111,62,127,62,143,62,159,
+62,175,62,191,62,207,62,223,62,237,62,251,63,5,63,15,63,25,63,35,63,45,63,
+55,63,63,63,71,63,78,63,93,63,108,63,123,63,138,63,143,63,158,63,173,63,188,
+63,203,63,218,63,223,63,238,63,253,64,12,64,27,64,32,64,46,64,60,64,74,64,
+88,64,102,64,116,64,130,64,144,64,158,64,172,64,186,64,200,64,207,64,221,
+64,235,64,249,65,7,65,19,65,31,65,40,65,49,65,58,65,64,65,77,65,83,65,96,
+65,109,65,122,65,135,65,148,65,161,65,174,65,187,65,200,65,213,65,226,65,
+239,65,252,66,9,66,22,66,33,66,40,66,47,66,54,66,66,66,78,66,90,66,102,66,
+114,66,126,66,138,66,150,66,162,66,174,66,186,66,198,66,210,66,222,66,234,
+66,246,67,2,67,12,67,22,67,32,67,40,67,48,67,56,67,64,67,72,67,80,67,88,67,
+96,67,104,67,110,67,121,67,132,67,143,67,154,67,165,67,176,67,187,67,198,
+67,209,67,220,67,231,67,242,67,253,68,8,68,19,68,30,68,41,68,52,68,63,68,
+74,68,85,68,96,68,107,68,116,68,125,68,130,68,134,68,149,68,155,68,159,68,
+176,68,193,68,199,68,207,68,218,68,231,68,235,68,243,68,251,69,16,69,25,69,
+36,69,63,69,90,69,117,69,136,69,164,69,169,69,172,69,190,69,193,69,196,69,
+211,69,228,69,252,70,3,70,18,70,27,70,34,70,70,70,77,70,109,70,130,70,135,
+70,172,70,190,70,220,70,233,71,1,71,4,71,48,71,53,71,84,71,90,71,146,71,150,
+71,157,71,203,72,5,72,12,72,54,250,185,194,21,213,7,135,118,53,110,111,248,
+190,29,252,19,251,98,251,245,251,209,251,39,194,251,112,247,133,248,78,29,
+218,247,46,205,153,172,31,251,193,249,128,21,247,102,29,11,250,197,188,81,
+29,11,249,234,249,185,21,198,80,247,38,251,81,251,185,251,139,251,230,251,
+216,251,203,247,92,77,247,17,247,79,247,45,247,11,213,215,30,247,21,216,29,
+11,115,29,14,121,29,238,29,176,225,237,247,48,172,170,8,11,28,4,236,22,223,
+7,251,67,90,217,247,45,100,31,100,247,48,121,246,251,60,210,8,247,90,29,251,
+101,254,226,150,29,11,250,117,249,242,21,235,251,170,7,154,114,59,178,41,
+27,251,152,251,46,251,99,251,91,251,23,221,63,247,1,92,31,83,84,103,251,13,
+151,76,8,251,42,89,251,14,45,251,31,26,251,48,247,16,251,35,247,161,247,152,
+247,150,247,46,247,68,247,11,55,188,251,17,196,30,251,166,247,17,132,161,
+150,199,157,180,25,247,130,247,98,247,23,247,152,194,125,190,127,170,31,251,
+62,251,19,247,154,29,161,254,39,21,71,62,251,19,251,89,251,66,59,247,38,233,
+221,176,223,247,23,171,30,247,148,251,8,5,219,102,163,98,90,26,11,21,200,
+90,190,77,82,84,84,82,77,190,86,200,201,188,192,201,30,252,60,22,200,88,190,
+77,80,88,84,80,79,190,86,198,201,190,192,201,30,14,250,175,28,5,53,21,152,
+112,251,27,200,251,76,27,251,198,251,119,251,68,251,165,251,55,247,31,57,
+247,36,65,31,241,86,247,78,65,251,31,26,251,79,251,47,251,4,251,68,112,251,
+105,184,188,143,30,247,129,29,247,70,251,33,223,251,37,213,31,251,1,192,251,
+72,209,247,39,26,247,54,247,41,247,11,247,50,237,225,85,113,247,241,29,11,
+28,5,176,248,69,29,137,133,118,247,65,29,247,121,253,72,55,252,58,133,115,
+120,126,115,248,117,29,251,7,149,104,141,129,156,145,159,25,225,248,76,248,
+156,249,54,149,150,162,157,159,141,25,11,168,29,247,207,247,122,247,200,247,
+223,30,158,29,11,250,193,190,130,29,11,72,29,14,224,29,247,146,247,30,247,
+46,247,60,239,52,217,49,211,31,247,137,29,11,21,204,88,191,75,74,90,85,76,
+75,190,88,202,203,190,190,203,30,14,250,113,247,77,29,247,109,28,4,111,87,
+29,251,105,248,165,29,250,70,7,11,28,5,166,250,15,21,172,114,227,41,69,96,
+98,129,129,30,180,251,132,57,251,81,47,251,62,251,19,251,55,25,88,249,160,
+251,46,121,33,251,136,251,25,251,173,32,251,88,25,94,249,146,47,145,251,140,
+69,5,82,7,247,46,122,196,253,225,119,91,5,247,43,6,247,7,247,69,247,35,247,
+156,247,13,247,150,184,253,79,24,247,19,6,180,189,248,144,249,17,247,121,
+26,11,21,251,105,247,210,5,174,116,121,159,84,27,75,88,92,76,112,151,116,
+160,125,31,247,164,251,91,5,251,154,22,251,105,247,210,5,174,116,123,159,
+84,27,73,90,92,76,110,151,118,160,125,31,247,164,251,91,5,14,200,29,190,235,
+5,157,157,164,141,149,239,238,51,247,17,247,48,29,11,248,175,198,135,29,11,
+249,95,249,238,248,176,29,251,17,253,2,247,105,29,247,10,247,73,217,154,173,
+30,221,7,124,96,47,104,61,27,70,75,182,211,154,31,247,21,249,23,5,11,28,6,
+6,28,5,6,21,227,252,156,51,7,247,9,131,167,135,148,116,134,123,25,127,73,
+253,138,253,123,247,52,249,189,143,155,158,164,169,141,25,247,23,147,5,227,
+252,168,51,7,245,131,168,135,149,116,135,123,25,251,109,254,220,137,123,119,
+114,110,137,25,251,19,131,5,51,248,177,227,7,251,11,147,110,141,129,164,141,
+155,25,160,242,249,137,249,121,251,58,253,224,135,123,121,114,108,137,25,
+251,9,131,5,51,248,167,227,7,251,13,147,112,248,105,29,247,107,250,220,143,
+155,158,162,170,143,25,11,28,8,0,28,5,8,21,248,60,29,252,52,254,27,247,3,
+29,247,11,254,218,5,247,23,6,248,250,28,5,29,5,11,21,196,94,196,62,248,83,
+29,218,184,194,199,30,148,28,251,26,135,29,11,77,29,247,236,227,7,181,29,
+11,21,35,6,251,10,86,251,3,98,55,27,59,49,178,247,12,133,31,32,6,137,119,
+137,120,123,26,251,9,211,251,15,247,87,247,107,247,16,247,48,247,31,172,30,
+14,248,175,192,21,217,7,133,116,35,104,100,27,81,92,196,195,150,31,247,141,
+28,5,26,5,60,6,251,212,78,5,77,7,247,74,121,251,117,28,251,109,247,2,29,11,
+248,208,29,247,56,209,247,230,247,113,149,31,247,9,251,50,5,248,135,29,11,
+247,235,29,247,63,29,248,62,29,135,115,129,126,114,137,25,251,21,129,5,53,
+248,197,7,247,236,247,153,247,15,247,228,247,70,251,15,209,251,70,163,31,
+247,80,201,247,46,247,0,247,103,26,251,120,125,21,251,77,251,23,251,49,251,
+148,121,92,141,141,108,30,239,248,156,5,141,162,178,143,182,27,247,66,243,
+80,251,21,31,102,253,40,21,251,109,251,47,251,21,251,185,104,80,143,141,106,
+30,247,0,248,193,5,146,184,197,143,190,27,247,85,247,12,79,251,60,31,11,21,
+180,106,186,68,77,111,119,108,112,30,251,171,251,212,5,247,36,6,247,199,247,
+91,5,168,160,159,163,178,26,252,52,22,180,107,186,67,78,108,119,108,112,30,
+251,168,251,212,5,247,33,6,247,201,247,91,5,168,160,159,163,178,26,14,21,
+251,1,6,84,116,84,100,102,27,76,106,164,159,104,31,168,96,100,159,84,247,
+248,29,27,203,172,115,116,173,31,113,182,176,118,195,248,39,29,11,21,225,
+252,168,247,119,29,248,171,225,7,251,11,149,102,247,203,29,247,105,250,226,
+145,166,147,151,166,141,25,11,28,7,23,249,248,21,247,122,29,65,6,141,164,
+141,163,166,26,247,135,251,27,247,30,251,54,251,74,251,6,251,11,57,55,30,
+251,21,7,247,7,247,8,233,221,247,1,27,243,197,251,32,251,25,251,58,55,251,
+238,251,76,31,40,248,22,29,247,73,247,125,247,93,247,169,213,30,213,6,46,
+252,89,5,247,83,6,229,248,89,5,217,6,133,108,137,106,106,26,251,135,247,27,
+251,30,247,54,247,74,247,7,247,11,221,223,30,247,21,7,251,7,251,9,45,58,251,
+1,27,35,81,247,31,247,25,247,56,223,247,240,247,150,29,11,28,6,27,28,5,6,
+21,227,252,118,51,7,247,15,133,168,137,153,116,127,119,25,252,87,253,48,251,
+107,249,48,131,161,164,160,169,141,25,247,32,145,5,227,252,234,51,7,247,47,
+127,247,208,254,70,83,67,84,65,80,100,25,251,95,227,5,73,98,78,86,98,26,86,
+170,63,247,19,247,68,247,25,247,13,247,37,239,30,249,93,250,163,5,11,21,205,
+88,192,76,73,90,84,75,76,190,87,203,202,190,191,202,30,14,28,7,170,247,167,
+29,28,251,137,53,6,247,7,129,155,137,143,116,125,123,25,254,23,254,226,121,
+119,124,122,121,137,25,40,129,5,53,248,103,225,7,51,149,105,143,120,158,153,
+155,25,247,208,248,19,5,248,97,6,63,252,19,137,125,127,116,114,137,25,251,
+17,129,5,53,250,125,7,205,248,120,29,130,125,122,112,27,252,98,6,247,0,248,
+196,5,247,146,6,168,153,124,113,135,31,121,251,38,5,247,6,6,231,248,105,5,
+251,8,6,100,251,29,5,110,131,126,129,111,27,251,148,6,237,248,140,5,248,5,
+6,169,147,129,110,31,251,58,247,24,7,253,132,247,78,21,251,13,253,6,5,252,
+31,6,11,21,252,253,6,110,251,27,5,249,0,6,14,21,251,2,6,44,71,41,251,10,251,
+13,26,38,219,105,227,176,178,145,147,174,30,157,247,9,5,248,154,29,244,227,
+227,215,198,31,14,247,228,29,67,251,193,247,4,29,14,250,80,250,13,156,29,
+11,21,251,93,247,239,5,251,53,6,251,230,251,239,5,247,35,6,247,138,247,81,
+247,60,251,81,5,11,28,4,145,250,171,21,217,29,247,250,247,158,247,97,247,
+222,30,251,105,104,21,251,52,62,37,36,77,30,43,80,251,19,122,251,11,150,247,
+19,249,31,24,248,57,29,11,28,4,242,21,247,12,43,199,251,33,251,40,251,64,
+67,33,90,180,120,164,165,185,158,139,30,157,247,8,5,147,149,184,166,205,27,
+200,213,106,51,35,37,57,251,69,149,31,125,51,5,235,151,247,38,146,251,30,
+26,251,6,38,46,251,29,90,98,160,145,127,30,118,244,5,139,113,151,110,71,127,
+86,114,76,213,63,247,62,247,107,247,72,248,158,29,247,32,182,214,228,229,
+26,11,250,27,28,5,102,21,248,30,29,251,70,80,137,59,247,50,155,98,251,160,
+114,251,136,104,251,84,25,107,251,82,92,248,189,29,213,248,180,151,232,8,
+247,161,241,251,142,6,153,243,196,247,55,29,11,28,5,186,28,5,8,212,29,11,
+28,7,147,28,5,8,21,247,29,29,252,164,51,7,247,2,129,168,137,149,116,135,121,
+25,37,252,152,5,251,25,133,196,223,100,31,71,247,42,209,247,76,251,11,247,
+37,8,188,100,73,160,70,27,43,40,84,75,92,152,92,177,100,31,247,122,227,227,
+251,0,98,251,38,176,251,29,25,161,49,170,84,190,98,57,124,72,98,94,84,252,
+11,252,93,24,251,60,129,5,51,247,252,205,7,248,38,248,111,178,186,186,159,
+202,143,25,45,252,107,137,121,119,116,110,137,25,251,23,129,5,51,248,164,
+247,130,29,11,21,61,6,80,113,65,251,3,251,13,27,102,101,149,158,118,31,102,
+247,53,5,148,125,88,149,120,27,76,96,73,82,251,17,247,29,80,247,17,247,78,
+247,1,247,8,247,44,204,31,14,28,7,25,28,5,4,21,229,252,185,49,7,247,13,131,
+167,137,147,118,135,119,25,251,107,254,216,135,119,121,116,108,137,25,251,
+21,131,5,51,248,175,227,7,251,7,147,110,141,129,162,143,159,25,247,107,250,
+216,143,159,160,160,167,141,25,252,242,253,142,21,247,117,141,251,64,247,
+11,251,158,27,80,46,129,139,31,247,194,29,167,135,149,116,135,123,25,251,
+109,254,220,137,123,119,114,110,137,25,251,25,131,5,51,248,115,7,248,52,247,
+50,247,19,247,179,196,31,145,176,143,171,170,26,251,117,178,21,98,135,94,
+129,86,30,251,93,98,75,251,7,251,181,27,88,88,143,139,31,247,19,249,28,5,
+139,229,149,182,247,66,213,73,251,33,141,30,11,21,247,35,29,254,85,28,251,
+102,121,49,5,250,138,6,210,248,15,5,251,31,6,78,251,121,5,110,131,124,127,
+111,27,252,193,6,250,88,28,4,149,5,11,21,211,7,106,82,94,135,112,27,94,76,
+170,223,157,31,247,56,249,168,5,142,29,247,29,247,9,247,100,29,11,21,247,
+35,35,221,251,23,61,67,114,100,80,30,180,247,42,247,49,247,25,247,124,161,
+135,219,24,251,255,107,251,136,251,167,251,193,26,251,125,247,54,85,247,3,
+247,82,247,54,247,46,247,87,30,251,25,108,21,251,23,45,251,5,251,9,251,17,
+117,247,11,219,194,159,219,143,155,30,184,205,192,154,196,27,247,7,182,73,
+39,31,14,28,5,156,247,42,29,11,28,5,156,28,5,8,21,205,87,192,132,29,5,73,
+247,228,227,7,251,31,149,251,134,248,113,119,180,106,170,67,158,25,247,8,
+29,11,28,5,74,198,21,217,7,131,112,45,98,92,27,83,103,188,195,151,31,247,
+46,249,199,5,57,6,251,202,75,5,80,7,247,66,120,251,23,253,74,5,45,123,157,
+248,147,29,172,31,252,167,247,187,145,29,11,28,6,35,28,5,4,21,229,252,163,
+49,7,247,9,131,168,137,147,118,135,119,25,49,252,97,5,253,15,6,231,248,97,
+143,159,158,160,167,141,25,247,21,147,5,229,252,164,247,43,29,246,248,165,
+5,249,12,6,35,252,165,135,119,120,116,111,137,25,251,19,131,5,51,178,7,247,
+117,247,5,248,84,29,237,248,144,37,147,110,141,127,162,143,159,25,247,109,
+250,216,143,159,159,160,168,141,25,14,143,159,156,158,169,247,192,29,11,21,
+247,1,7,70,62,70,91,37,27,98,93,146,156,85,31,164,60,36,189,33,27,130,130,
+139,138,130,31,251,43,128,88,84,100,99,8,251,0,7,212,215,199,186,241,27,196,
+209,124,106,232,31,108,227,178,118,226,27,154,156,140,140,157,31,233,145,
+225,196,182,178,8,251,110,4,247,1,7,70,62,70,91,37,27,98,93,146,156,85,31,
+164,60,36,189,33,27,130,130,139,138,130,31,251,43,128,88,84,100,99,8,251,
+0,7,212,215,199,186,241,27,196,209,124,106,232,31,108,229,175,116,229,27,
+153,154,140,140,155,31,233,146,228,196,182,179,8,14,21,170,247,56,5,251,36,
+251,93,251,10,93,251,38,27,251,178,251,48,247,103,248,29,214,31,250,59,6,
+139,154,198,143,160,30,248,35,216,251,31,247,98,252,7,27,251,200,251,187,
+251,114,251,250,251,13,31,33,6,58,111,171,186,135,31,247,62,247,138,5,176,
+111,99,153,108,27,61,40,46,251,10,117,31,251,40,111,201,251,14,247,66,27,
+247,1,6,252,153,41,247,129,251,130,247,238,27,247,76,247,97,206,247,2,247,
+52,31,253,155,249,63,21,247,86,190,247,74,247,161,247,113,27,247,112,228,
+251,65,251,119,95,31,127,76,5,14,250,193,190,21,137,211,5,171,29,121,50,213,
+107,195,130,25,102,106,76,69,118,202,29,155,166,196,151,165,30,226,150,247,
+18,190,170,150,8,14,21,158,247,48,49,211,251,8,158,222,158,227,197,164,247,
+3,8,247,17,166,77,230,251,33,27,251,108,52,251,71,251,61,101,31,251,49,253,
+121,137,127,126,123,124,137,25,69,133,5,91,247,221,7,140,187,45,145,5,130,
+132,150,158,143,31,247,51,249,133,5,226,159,147,247,81,247,43,27,224,162,
+57,65,123,31,114,251,3,70,81,251,15,140,132,119,136,120,135,123,247,76,143,
+193,251,16,113,251,14,8,251,25,111,57,97,60,27,105,87,148,160,104,31,124,
+70,5,122,169,205,131,176,27,247,27,247,55,215,247,85,163,31,14,28,5,135,249,
+234,21,247,78,59,247,56,251,31,240,30,247,3,247,57,34,203,251,2,251,62,5,
+166,71,61,155,53,27,252,86,251,204,252,66,252,76,251,77,205,251,41,247,2,
+38,31,251,21,251,92,227,73,247,26,247,95,5,92,221,237,114,247,0,27,248,118,
+247,170,248,91,248,68,31,252,33,248,29,21,253,15,254,105,5,104,209,121,225,
+237,26,247,255,247,105,248,58,247,191,204,199,118,102,190,30,247,56,252,29,
+21,251,242,251,105,252,66,251,191,55,63,171,201,80,30,249,31,250,115,5,190,
+61,168,37,251,17,26,11,227,254,216,105,29,248,44,6,11,21,251,120,251,10,251,
+217,251,116,68,71,186,153,115,30,247,14,249,15,5,155,160,243,242,238,27,247,
+2,188,251,34,251,12,31,14,98,29,14,28,5,126,28,5,6,21,227,252,150,51,7,238,
+131,163,135,153,122,135,117,25,43,252,115,5,96,53,251,20,94,47,27,251,19,
+98,247,49,29,247,44,70,247,29,27,247,6,247,64,202,199,247,2,31,43,252,122,
+248,131,29,251,1,131,5,51,248,148,227,7,248,151,29,247,109,250,220,143,161,
+162,158,163,141,25,14,21,247,244,29,137,137,116,124,123,248,143,29,160,156,
+157,161,141,25,247,25,147,5,225,252,168,53,7,247,5,131,153,137,153,135,150,
+114,25,247,137,252,189,177,29,11,250,140,250,39,21,248,7,29,48,63,113,55,
+88,43,8,251,1,79,80,67,251,25,247,118,29,211,162,131,106,155,31,247,66,251,
+232,5,98,159,170,104,182,27,247,11,247,46,247,87,180,169,31,109,192,5,102,
+108,36,41,86,27,115,116,160,165,127,31,251,21,247,146,126,164,101,169,110,
+154,25,178,163,178,180,171,188,195,225,163,244,217,208,247,46,70,24,184,170,
+180,175,182,26,11,163,29,227,213,164,180,217,31,213,7,248,95,29,102,225,108,
+247,2,123,189,219,247,82,247,0,247,19,211,168,248,43,29,11,21,136,111,135,
+96,111,26,251,203,247,92,77,247,17,247,78,247,45,247,11,213,215,30,247,21,
+7,251,23,251,42,33,71,48,27,251,10,62,245,247,44,164,143,182,143,166,31,247,
+135,153,247,229,247,9,247,115,26,198,81,247,38,251,81,251,127,251,102,251,
+112,251,157,70,30,71,81,163,174,120,31,240,247,58,5,182,113,103,154,95,27,
+50,90,51,58,32,241,54,247,60,31,248,234,247,252,21,251,37,251,108,248,40,
+29,247,0,248,103,29,21,237,97,209,251,24,251,79,53,251,253,251,80,103,30,
+51,181,119,196,234,26,220,188,247,90,207,167,160,135,112,157,30,160,141,5,
+139,155,244,41,251,68,57,251,117,251,48,251,36,221,69,247,38,115,30,108,251,
+64,5,55,125,208,126,192,27,208,247,3,183,139,31,197,7,135,124,74,116,114,
+27,107,114,155,174,144,31,164,247,35,5,247,124,178,247,33,247,92,247,104,
+26,251,21,143,21,251,45,64,251,76,251,46,89,30,175,247,84,5,247,75,174,202,
+237,171,27,181,160,118,74,31,14,21,209,7,122,88,94,119,106,27,86,92,186,205,
+151,31,247,7,248,189,124,29,251,5,252,183,11,250,97,248,250,21,247,34,94,
+239,69,205,30,239,247,49,58,190,40,251,47,5,163,88,80,152,77,27,251,213,251,
+114,251,210,251,224,251,33,189,251,0,225,73,31,251,1,251,64,215,88,247,5,
+247,70,5,123,184,188,128,194,27,247,207,247,122,247,200,247,223,31,251,158,
+247,136,21,252,46,253,35,5,123,184,128,194,209,26,247,158,247,28,247,177,
+247,70,186,182,116,96,172,30,198,251,127,21,251,134,251,11,251,205,251,86,
+100,104,153,170,108,30,248,40,249,19,5,147,102,145,96,90,26,11,248,198,29,
+187,247,119,218,29,251,113,254,199,248,183,29,5,251,3,117,247,14,116,189,
+27,225,247,45,203,151,174,31,14,248,111,29,135,123,67,252,7,251,19,252,78,
+57,251,27,8,73,98,72,53,100,27,251,66,207,5,77,76,92,75,70,182,83,209,247,
+51,247,32,199,247,86,247,21,31,231,247,29,247,9,248,5,245,248,179,8,11,21,
+251,2,252,200,5,76,67,63,71,55,27,37,75,238,247,47,247,212,247,72,247,136,
+247,116,169,219,46,109,133,31,14,28,5,135,249,234,21,247,197,251,107,247,
+140,251,232,247,162,29,30,251,125,22,11,21,77,6,251,35,59,5,186,92,69,172,
+73,27,252,2,251,162,128,29,161,29,5,108,244,241,118,247,1,27,247,115,247,
+174,217,247,167,247,23,251,2,192,251,9,145,31,247,31,174,247,36,229,247,52,
+26,11,28,5,199,251,119,21,225,7,110,75,47,100,59,27,251,27,78,237,247,44,
+57,31,248,14,247,109,209,248,13,247,113,26,247,205,251,109,247,130,251,226,
+252,90,251,206,252,89,252,60,251,250,247,146,251,97,247,193,172,178,145,141,
+170,30,251,64,214,234,251,23,247,103,27,247,35,247,64,223,156,170,31,251,
+189,250,207,21,251,248,251,113,252,60,251,185,251,105,251,23,247,80,247,148,
+248,19,247,115,248,36,247,197,247,89,247,25,251,81,251,150,30,14,5,51,121,
+89,107,68,27,251,30,247,35,5,84,112,82,109,65,26,81,211,78,247,6,247,68,242,
+221,247,48,167,30,11,21,247,19,29,30,247,208,29,135,112,121,127,112,248,73,
+29,103,143,130,153,144,162,25,204,247,221,247,131,29,31,251,95,131,21,251,
+120,251,10,251,217,251,116,68,71,186,153,115,30,247,14,249,15,5,155,160,243,
+242,238,27,247,2,188,251,34,251,12,31,11,28,5,215,249,230,21,247,248,251,
+158,247,128,252,83,252,82,251,158,251,128,251,248,251,222,247,172,251,86,
+247,140,124,30,251,19,251,211,7,89,51,176,242,31,96,251,216,248,212,247,252,
+6,251,124,211,251,41,247,64,247,136,26,247,162,247,84,247,163,247,189,247,
+187,247,87,251,163,251,162,251,136,251,42,251,64,251,123,67,30,251,252,248,
+211,247,216,96,7,36,53,102,88,30,251,211,247,19,6,247,139,154,247,173,247,
+86,247,222,26,14,21,212,92,174,49,128,129,137,137,129,30,171,247,67,5,33,
+6,82,251,190,5,160,182,149,145,151,27,170,176,124,99,59,41,122,102,94,81,
+154,147,109,31,120,57,5,131,168,213,122,200,27,247,48,247,25,225,247,34,31,
+11,21,247,113,29,11,21,203,69,221,251,51,30,77,6,251,84,251,105,251,15,251,
+66,251,1,202,76,223,100,31,251,21,116,251,54,74,251,95,26,251,64,247,38,73,
+247,123,247,76,247,65,247,15,158,165,30,247,23,7,96,86,251,31,251,21,251,
+68,27,251,1,59,186,243,247,27,223,215,247,25,141,190,141,137,193,31,236,7,
+69,141,251,3,153,247,27,26,247,31,223,232,247,13,147,30,162,110,208,43,182,
+79,8,247,21,158,164,192,192,26,14,21,254,115,53,6,247,6,129,174,247,166,29,
+251,105,248,165,29,250,148,7,207,247,232,5,251,17,6,75,251,89,5,115,131,125,
+122,110,27,252,117,6,245,248,196,5,247,169,247,94,29,251,166,6,233,248,140,
+5,248,29,248,108,29,11,143,29,37,252,169,135,115,118,126,115,137,25,251,15,
+129,5,53,11,5,251,11,202,195,247,157,29,11,28,5,180,192,21,215,7,129,111,
+57,110,85,27,100,86,158,196,149,31,247,42,249,201,5,251,134,6,252,31,253,
+99,251,3,249,99,5,252,16,72,6,241,132,153,137,145,127,135,125,25,139,251,
+4,253,23,51,251,11,30,251,97,192,5,110,121,115,116,84,26,118,161,55,239,247,
+116,208,247,42,247,140,190,30,236,248,97,247,23,253,220,5,233,6,248,105,249,
+232,5,102,251,72,45,252,122,78,26,63,166,71,247,14,11,250,197,250,33,21,186,
+7,251,62,195,5,80,6,251,204,253,126,99,247,111,102,247,77,104,247,13,25,247,
+221,29,158,136,194,251,104,182,251,85,25,11,250,164,250,50,21,251,23,237,
+74,47,5,135,110,110,131,111,251,27,251,15,231,251,32,27,251,45,251,19,251,
+34,251,43,75,182,82,206,182,185,172,174,159,31,35,247,23,248,204,29,190,106,
+30,90,247,105,5,147,115,102,154,114,27,61,11,247,80,6,225,248,68,5,211,162,
+131,106,155,31,247,66,251,232,5,98,159,170,104,182,27,247,11,247,46,247,87,
+180,169,31,109,192,5,102,108,36,41,86,27,115,116,160,165,127,31,251,21,247,
+146,126,164,101,169,110,154,25,178,163,178,180,248,201,29,11,5,247,49,171,
+68,242,251,29,27,251,17,251,42,49,40,41,31,213,129,104,247,7,251,29,27,251,
+13,251,25,47,42,38,31,178,247,81,5,55,6,251,199,75,5,80,7,247,62,120,251,
+68,253,250,5,247,80,6,247,36,249,68,5,190,180,247,23,247,21,235,27,227,155,
+251,4,51,121,31,251,29,253,48,5,247,82,6,247,36,249,72,5,186,167,247,13,247,
+21,247,17,27,192,192,74,251,29,111,31,11,248,23,29,251,41,251,31,251,25,251,
+42,251,6,225,57,247,6,31,247,180,29,14,21,182,7,137,124,84,123,120,27,103,
+248,153,29,143,151,156,178,145,157,8,49,6,118,111,5,159,115,93,162,90,27,
+251,142,251,27,251,103,251,83,51,176,251,23,247,50,219,206,186,176,180,31,
+84,143,164,110,202,27,193,239,178,147,160,31,251,89,248,85,21,69,251,230,
+5,120,121,73,80,78,27,55,118,217,208,247,28,207,247,90,247,95,155,174,82,
+131,137,31,14,248,109,250,136,247,4,29,11,251,212,251,246,251,91,233,251,
+56,247,109,247,17,247,8,205,207,242,31,251,125,93,68,251,135,251,167,27,104,
+69,174,163,113,31,104,247,64,5,147,125,120,141,123,27,57,82,59,64,251,46,
+247,127,105,247,0,247,181,247,117,247,77,247,180,198,31,110,249,201,21,251,
+19,253,19,5,100,72,59,109,61,27,251,54,67,247,11,247,41,247,132,247,42,247,
+180,247,162,199,210,96,94,174,31,14,21,55,74,70,71,98,30,251,8,182,69,184,
+212,26,232,235,204,225,219,196,96,57,30,80,252,58,21,251,2,251,9,71,39,251,
+5,84,192,221,246,205,202,231,182,30,247,33,84,225,106,57,26,14,21,137,211,
+5,171,29,5,251,3,117,247,14,116,189,27,225,247,45,203,151,174,31,11,249,244,
+249,191,21,243,45,236,251,44,251,29,251,4,98,251,7,51,30,206,78,5,221,221,
+194,173,217,27,227,162,88,90,45,251,13,51,251,91,61,31,251,58,71,251,55,251,
+21,251,19,248,199,29,247,166,247,3,247,54,219,247,31,26,11,43,70,67,118,90,
+79,30,251,68,251,37,127,248,106,29,8,55,69,251,0,82,251,25,208,29,203,135,
+235,119,161,92,25,247,134,252,111,11,250,144,21,67,6,172,82,143,94,112,26,
+99,115,86,76,130,130,140,247,58,253,178,30,251,83,7,249,134,251,47,5,210,
+61,199,32,41,26,91,90,79,79,109,41,164,247,32,253,53,30,55,7,203,251,201,
+5,198,6,158,247,64,5,251,14,248,221,203,122,178,27,240,245,194,247,52,247,
+29,87,247,9,37,246,31,138,146,151,139,152,27,186,214,152,247,13,227,94,247,
+31,110,190,31,11,21,86,6,251,101,102,5,102,7,247,11,129,92,251,128,5,147,
+116,108,152,98,27,251,127,251,33,251,99,251,87,35,179,251,7,247,42,213,208,
+184,184,184,31,86,158,102,221,194,237,174,145,162,30,184,7,137,127,67,119,
+125,27,126,94,149,186,149,31,80,248,13,21,80,251,216,5,88,92,75,92,92,27,
+86,88,184,243,247,85,247,6,247,39,247,21,174,184,80,131,137,31,14,21,217,
+7,131,112,45,98,92,27,83,105,188,195,149,31,247,47,249,199,247,195,29,251,
+23,253,74,5,45,121,159,248,147,29,170,31,11,144,166,158,151,164,141,25,247,
+11,149,5,159,29,11,146,29,14,133,115,121,126,114,248,117,29,251,9,149,102,
+247,203,29,11,248,50,29,248,5,28,4,236,21,247,33,251,15,186,251,13,34,251,
+109,71,251,23,98,172,123,176,161,170,145,155,158,30,165,247,19,5,156,174,
+178,149,178,27,219,198,104,51,251,129,252,23,251,91,251,70,251,9,31,118,248,
+53,29,251,252,6,247,62,247,2,248,5,247,95,247,122,26,11,53,7,247,7,129,176,
+247,166,29,251,36,253,107,5,251,111,96,55,251,83,251,158,27,251,68,251,5,
+225,247,64,176,146,205,155,219,31,247,33,249,76,248,133,29,247,13,149,5,225,
+252,168,53,7,247,63,29,251,35,253,76,5,121,44,130,60,98,26,251,152,247,89,
+40,247,144,247,218,247,80,247,66,247,189,196,30,11,21,198,80,247,38,251,81,
+251,185,251,139,251,230,251,216,251,203,247,92,77,247,17,247,79,247,45,247,
+11,213,215,30,247,21,216,29,14,251,83,6,251,47,253,134,5,68,61,32,79,41,27,
+86,71,199,208,154,31,247,55,249,161,5,55,6,251,201,248,44,29,251,25,253,19,
+5,33,117,180,251,42,247,82,27,11,28,6,35,28,5,8,21,159,29,11,248,174,29,35,
+104,100,27,81,92,196,195,150,31,11,21,248,67,29,221,248,60,5,57,6,251,201,
+75,5,80,7,247,66,120,251,9,252,240,247,179,29,30,251,88,143,247,74,29,11,
+21,247,156,29,11,21,137,182,5,131,108,110,123,115,27,122,90,153,186,147,31,
+207,247,224,5,247,0,161,94,195,43,27,49,47,96,83,84,31,147,152,217,248,21,
+139,26,85,6,251,98,102,5,102,7,247,8,129,251,74,253,202,5,247,15,6,237,248,
+66,5,195,197,220,180,182,27,168,184,104,75,125,31,61,251,254,5,71,123,231,
+127,172,27,194,239,176,147,162,31,14,28,5,45,155,29,11,249,15,247,95,29,251,
+134,28,250,238,5,77,235,247,9,106,247,7,27,248,51,247,54,248,42,247,146,31,
+251,95,131,247,88,29,11,133,115,121,126,112,137,25,251,9,129,5,53,248,169,
+225,7,251,11,149,104,247,203,29,227,248,105,5,139,211,248,118,29,251,44,169,
+174,251,70,247,140,248,129,29,251,194,250,166,21,251,152,251,125,68,251,113,
+30,94,6,243,248,195,5,151,162,141,149,27,247,50,145,247,84,102,251,91,26,
+11,168,29,247,207,247,122,247,200,247,223,30,251,99,148,21,116,137,117,137,
+116,30,252,107,6,247,93,184,247,2,247,60,247,30,27,243,217,32,251,86,31,121,
+251,62,21,251,91,98,36,251,78,251,43,27,36,59,241,247,95,165,141,166,141,
+166,31,11,21,251,30,6,251,174,251,211,116,247,76,5,235,127,104,193,49,27,
+251,5,37,107,58,106,170,98,192,31,228,247,21,5,204,159,123,251,9,153,31,168,
+251,119,252,39,252,93,5,247,31,6,247,175,247,212,161,251,77,5,43,150,175,
+87,230,27,247,5,239,169,220,173,108,179,86,31,50,251,21,5,75,119,155,247,
+9,124,31,110,247,119,5,14,21,194,100,180,75,251,37,71,251,23,251,21,251,54,
+247,11,251,0,178,98,30,219,155,5,82,211,77,223,243,26,172,149,163,145,170,
+30,247,22,6,169,166,160,182,180,26,14,250,125,28,5,12,21,246,74,186,51,47,
+75,59,71,103,152,122,147,131,30,247,17,6,135,251,31,251,30,251,21,47,51,8,
+247,11,6,227,206,247,82,247,66,247,62,26,252,49,143,247,39,29,21,190,251,
+50,33,170,251,25,170,29,11,247,14,29,151,126,111,152,31,180,251,3,182,252,
+214,123,26,141,94,124,88,111,79,8,247,10,6,247,17,247,32,247,140,247,176,
+247,74,247,228,248,128,29,11,250,27,28,5,102,21,187,90,218,251,31,251,173,
+251,18,251,229,251,110,101,30,71,252,26,118,251,137,105,251,84,106,251,82,
+93,248,189,29,212,248,180,152,232,169,247,98,199,247,55,29,11,251,99,148,
+174,29,11,225,252,169,53,7,166,29,11,28,6,53,28,5,6,21,227,252,176,51,7,247,
+8,131,168,135,147,116,135,123,25,251,107,254,212,5,121,137,119,114,110,27,
+252,189,6,110,131,164,157,141,31,247,107,250,212,143,248,119,29,252,166,247,
+127,29,11,249,224,249,183,21,247,47,251,81,193,251,19,251,23,251,2,114,90,
+251,13,30,94,251,115,5,237,6,186,247,11,5,194,162,247,27,172,188,27,227,223,
+108,36,251,49,251,15,59,251,35,145,31,98,141,118,33,5,145,164,170,141,172,
+27,231,239,106,35,251,62,251,29,51,251,50,104,251,47,165,190,31,247,7,40,
+7,92,251,123,11,247,111,29,203,135,235,119,161,92,25,247,134,252,111,5,73,
+247,228,227,7,251,31,149,251,134,248,113,119,180,106,170,67,158,25,247,8,
+29,11,21,206,29,167,135,247,3,251,168,157,57,25,64,251,87,251,1,251,17,57,
+88,247,89,29,11,250,46,250,82,21,247,198,29,63,251,3,242,251,12,247,52,29,
+253,75,253,193,248,123,29,247,1,216,51,247,1,27,184,11,21,247,127,251,74,
+162,59,251,94,251,62,251,44,251,86,251,58,247,29,84,237,209,219,167,162,186,
+30,251,11,251,74,251,42,63,251,82,71,170,74,24,247,166,219,247,248,247,96,
+248,1,26,251,25,22,100,121,43,135,120,30,127,125,61,80,47,27,61,61,188,247,
+4,247,24,229,247,12,247,13,210,219,103,251,44,31,14,247,22,29,248,62,29,133,
+115,121,126,112,137,25,251,9,129,5,53,248,169,225,7,251,11,149,104,247,203,
+29,241,248,169,5,249,19,6,11,247,54,29,160,96,30,90,247,105,5,147,115,102,
+154,114,27,61,84,71,57,251,50,247,115,71,247,56,247,168,247,202,247,78,247,
+198,247,125,251,58,247,17,251,105,149,31,14,250,97,248,250,21,247,169,251,
+62,247,13,251,89,251,213,251,114,251,210,251,224,251,129,247,32,251,42,247,
+117,11,21,182,7,121,100,110,135,123,27,110,96,157,190,152,31,245,248,109,
+5,251,15,6,37,252,88,5,96,90,69,104,75,27,105,94,174,182,149,31,245,248,103,
+5,84,6,251,93,102,5,102,7,247,5,129,53,252,19,247,152,29,14,247,249,29,247,
+90,247,85,211,149,170,31,194,247,224,5,251,13,6,51,251,126,131,121,116,119,
+123,136,25,135,129,83,109,51,27,251,121,251,83,247,35,247,201,248,109,247,
+195,247,198,247,206,237,205,93,133,149,31,157,133,158,111,118,26,251,82,247,
+13,7,11,247,197,29,247,5,248,187,5,247,77,178,55,231,251,42,27,251,29,251,
+40,67,47,55,31,247,30,249,41,5,57,6,251,212,78,5,77,7,247,74,121,251,174,
+28,250,168,248,183,29,11,227,28,250,170,243,29,248,189,247,168,29,11,21,176,
+102,227,251,15,251,82,251,54,251,97,251,85,251,80,247,23,104,221,247,13,239,
+209,184,189,30,217,7,59,42,68,100,79,27,63,90,202,229,154,141,165,141,156,
+31,247,52,147,247,109,209,247,25,26,251,9,141,21,53,251,33,67,251,4,131,30,
+231,161,211,247,31,227,27,182,167,106,107,31,14,21,251,134,251,11,251,205,
+251,86,36,59,241,247,95,248,55,29,11,182,110,180,68,65,92,73,139,30,251,136,
+252,143,5,247,17,6,247,213,248,70,5,148,151,149,159,162,26,11,28,6,184,249,
+46,21,241,39,211,251,39,251,46,251,70,53,251,68,63,200,88,199,114,30,251,
+13,100,251,5,67,251,33,26,251,5,244,64,247,66,247,43,247,111,229,247,72,241,
+51,189,68,163,30,233,178,247,0,221,247,5,26,251,8,249,144,21,251,38,6,28,
+251,90,28,250,106,5,247,38,6,11,252,146,252,207,131,129,121,120,116,137,25,
+41,131,5,53,248,113,225,7,251,15,147,104,141,139,162,156,155,25,248,23,248,
+66,247,76,252,66,247,201,29,248,165,225,7,247,18,29,11,251,80,6,251,42,253,
+97,5,45,49,251,19,74,73,27,94,64,194,247,0,161,31,217,248,9,5,247,107,184,
+63,247,42,251,137,27,251,9,57,81,74,55,196,114,151,135,31,247,87,247,27,192,
+109,137,53,100,251,85,25,66,251,242,5,251,76,100,208,46,247,42,27,247,29,
+247,39,211,231,223,31,11,225,7,45,149,110,141,131,150,135,165,25,251,113,
+28,4,248,5,251,56,6,253,136,28,250,227,247,233,29,247,101,248,27,5,248,100,
+6,201,252,27,247,223,29,7,192,249,3,247,202,29,11,21,215,33,169,86,251,136,
+251,70,251,74,251,129,122,30,60,28,251,118,128,251,19,133,35,251,21,84,25,
+251,52,245,5,88,123,90,96,83,26,66,247,1,110,192,247,134,247,70,247,72,247,
+130,155,30,221,28,4,137,149,247,21,145,237,247,21,197,25,247,48,34,5,192,
+156,188,180,194,26,14,251,31,149,251,87,248,93,117,190,79,180,70,158,25,200,
+171,199,203,198,229,229,247,29,155,248,18,29,11,225,252,109,72,7,252,183,
+254,105,251,68,250,115,5,196,252,94,53,7,247,63,29,251,103,254,226,133,115,
+121,126,112,137,25,251,9,129,5,53,248,105,225,7,251,6,149,104,247,203,29,
+247,82,250,152,247,97,28,251,117,5,247,15,6,249,37,28,4,150,11,251,191,251,
+83,251,41,247,62,247,168,247,255,247,105,248,58,247,191,247,88,247,36,251,
+71,251,164,30,11,250,162,28,5,8,194,29,11,5,247,60,29,11,225,252,111,53,7,
+247,9,129,174,247,166,29,251,66,254,17,252,97,250,101,5,192,252,31,53,7,247,
+6,129,174,247,166,29,11,21,252,150,6,57,252,62,5,139,247,25,180,225,247,7,
+217,90,35,251,31,251,19,36,251,25,106,92,154,157,123,30,110,247,5,5,141,133,
+124,141,123,27,94,88,110,86,79,235,72,247,21,247,99,247,121,241,247,128,247,
+17,43,208,251,54,51,43,109,139,31,184,247,125,5,248,56,6,11,21,247,135,251,
+12,247,30,251,87,251,74,251,27,251,11,57,55,30,251,21,7,247,7,247,8,247,7,
+221,247,1,27,247,27,186,251,32,251,25,251,58,69,251,228,251,111,129,31,251,
+11,248,22,29,247,171,247,164,247,181,248,3,30,14,8,248,5,29,247,97,251,105,
+219,251,66,251,60,251,27,106,70,251,46,30,77,251,204,5,247,15,6,207,247,79,
+5,212,166,247,57,189,207,27,247,19,247,9,67,251,29,251,101,251,81,251,19,
+251,82,145,31,77,141,117,251,13,5,147,174,188,139,176,27,11,28,6,150,249,
+97,21,248,74,251,249,247,246,252,66,252,72,251,244,251,248,252,72,252,72,
+247,246,251,247,248,66,248,74,247,245,247,247,248,72,30,50,22,252,21,251,
+205,251,212,252,23,252,23,251,203,247,210,248,19,248,35,247,209,247,203,248,
+19,248,21,247,205,251,207,252,27,30,11,149,194,29,14,145,166,158,151,165,
+247,192,29,11,247,56,29,49,252,103,5,253,19,6,229,248,103,248,133,29,247,
+13,149,5,225,11,21,225,252,168,53,7,247,11,129,173,137,148,123,135,116,25,
+251,28,253,111,5,251,167,90,78,251,49,251,66,27,96,100,159,248,58,29,88,247,
+53,27,247,243,237,247,111,247,230,200,31,247,23,249,93,146,166,157,151,166,
+141,25,11,251,46,71,5,72,7,247,21,151,251,17,253,2,247,105,29,11,21,248,1,
+29,14,155,247,40,5,143,143,178,190,217,27,221,208,84,44,251,70,251,33,61,
+251,21,135,31,59,190,7,215,231,127,251,5,251,55,251,13,53,251,23,251,2,44,
+194,247,13,33,31,251,23,7,49,221,225,89,247,15,27,247,117,247,142,221,247,
+146,246,67,200,251,33,160,31,11,250,101,22,211,248,15,5,251,11,6,59,251,130,
+5,119,132,123,122,121,27,252,227,6,248,179,248,245,251,163,248,195,5,248,
+140,6,157,148,122,121,140,31,132,251,82,5,247,10,6,202,247,219,5,254,59,6,
+121,45,247,175,252,203,252,186,253,3,122,49,5,14,247,69,29,241,248,128,5,
+84,6,251,93,102,5,102,7,247,5,129,51,252,52,248,36,29,250,46,250,82,21,209,
+29,11,28,6,102,249,7,21,247,239,29,211,251,43,128,251,87,123,72,69,247,110,
+29,212,194,191,8,14,108,174,82,104,26,104,69,247,254,29,11,247,31,174,247,
+36,229,247,52,26,247,47,251,81,193,251,19,251,23,251,2,114,90,251,13,30,94,
+251,115,5,237,6,186,247,11,5,194,162,247,27,172,188,27,227,223,108,36,251,
+49,251,15,59,251,35,145,31,98,141,118,33,5,145,164,170,141,172,27,231,11,
+209,29,190,235,5,11,248,38,29,232,251,97,251,54,251,37,201,70,247,34,247,
+17,166,83,165,90,158,110,25,247,86,29,209,7,122,104,76,125,110,27,67,61,243,
+247,7,78,31,134,147,135,147,135,147,8,14,247,183,29,113,251,75,77,127,102,
+31,84,7,247,71,116,11,248,26,29,200,247,206,145,166,157,151,164,141,25,247,
+11,149,5,247,76,29,11,27,239,248,152,247,107,29,252,175,51,7,247,2,129,168,
+137,147,116,135,121,25,251,107,254,216,247,111,29,11,229,29,253,75,253,193,
+247,34,63,11,247,58,29,248,171,225,7,251,11,149,104,141,129,156,143,159,25,
+231,248,105,5,247,17,6,11,225,7,251,7,149,102,247,203,29,247,105,250,226,
+145,166,157,151,164,141,25,11,21,247,85,29,251,45,250,115,247,26,29,247,91,
+28,251,4,248,137,29,11,133,115,121,126,112,137,25,251,9,129,5,53,248,169,
+225,7,251,11,149,104,247,203,29,241,248,169,248,192,29,11,21,197,251,77,7,
+166,247,31,5,59,6,74,251,15,38,98,5,98,7,223,147,57,252,8,5,135,120,137,123,
+122,26,80,170,94,233,217,247,11,184,149,159,30,188,7,129,113,79,119,90,27,
+92,98,165,182,147,31,223,248,21,5,14,21,247,102,29,14,247,227,29,182,143,
+166,31,247,136,153,247,230,247,9,247,115,26,251,74,141,21,251,37,251,109,
+248,40,29,247,1,247,123,247,27,27,207,182,84,86,31,11,247,82,251,23,247,29,
+251,228,30,252,145,53,6,247,63,29,251,107,254,226,138,29,215,248,17,5,139,
+227,135,180,11,5,247,125,242,251,105,6,209,247,223,5,57,6,251,212,78,5,77,
+7,247,74,121,101,251,82,5,251,79,36,247,56,6,11,248,4,29,252,125,53,6,247,
+63,29,248,62,29,133,115,131,126,112,137,25,251,19,129,5,53,248,118,7,248,
+160,248,32,29,11,5,247,74,174,71,219,251,42,27,248,130,29,31,177,247,83,5,
+57,6,251,201,248,44,29,251,70,253,250,248,9,29,184,204,107,251,1,119,31,11,
+5,221,203,247,23,243,247,0,27,197,171,113,89,166,31,237,6,182,247,105,5,191,
+105,69,157,82,27,251,28,251,53,251,35,36,67,31,180,247,105,5,252,13,51,6,
+157,137,209,133,139,26,172,135,163,118,133,109,8,14,21,247,58,251,0,211,251,
+21,251,101,251,35,251,83,251,91,251,35,229,51,247,37,247,99,247,39,247,76,
+247,91,30,11,234,29,55,252,62,247,6,29,11,249,95,247,46,29,247,114,29,45,
+227,44,247,90,11,135,112,121,127,112,248,73,29,103,143,130,153,144,162,25,
+204,247,221,247,131,29,247,19,29,31,11,21,175,98,189,43,251,72,251,70,251,
+66,251,112,251,37,218,57,247,19,247,11,225,209,190,195,30,217,7,69,63,65,
+90,67,27,51,111,223,217,247,0,186,247,85,247,31,145,31,217,45,5,223,149,157,
+178,170,26,14,247,132,188,31,247,112,6,166,247,33,5,251,108,6,247,56,249,
+232,5,251,44,6,253,205,253,236,112,251,29,5,11,5,151,104,82,166,247,0,29,
+11,247,198,29,57,37,242,251,15,247,52,29,11,247,58,29,250,70,7,14,27,247,
+71,181,251,110,251,111,95,31,251,196,77,251,69,251,2,251,69,27,109,78,145,
+151,95,31,141,66,5,122,203,196,126,203,27,247,122,247,152,247,57,248,20,218,
+31,247,147,191,251,31,247,115,251,152,27,11,28,251,146,247,226,29,247,148,
+6,248,136,29,247,7,29,11,5,77,235,247,9,106,247,7,27,248,51,247,54,248,42,
+247,146,31,251,95,131,247,88,29,14,5,168,102,69,170,53,27,251,234,251,125,
+251,242,251,208,251,136,247,10,251,19,247,56,235,240,195,217,233,31,11,8,
+90,122,94,118,94,27,112,117,144,145,116,31,113,251,9,5,131,170,176,133,176,
+27,226,232,173,240,177,31,11,5,251,82,6,48,252,117,5,106,72,88,127,98,27,
+40,115,184,235,157,31,217,248,46,5,57,6,251,201,75,5,80,7,247,66,120,84,251,
+187,5,251,55,106,247,0,79,247,19,27,213,231,176,176,213,31,11,252,186,251,
+126,30,79,248,219,129,236,92,186,251,3,141,25,251,111,71,5,80,7,247,38,131,
+5,161,151,126,111,152,31,180,251,3,182,252,214,123,26,141,94,124,88,111,79,
+8,247,51,6,248,32,249,251,11,182,251,89,176,251,94,145,106,251,31,251,144,
+67,251,1,53,247,120,29,247,23,247,113,239,247,146,197,247,23,11,249,248,246,
+29,11,28,4,225,249,207,21,247,183,251,56,247,181,252,41,251,91,251,86,67,
+129,110,30,84,251,224,5,247,11,6,229,247,126,147,157,161,160,156,141,25,143,
+149,194,170,227,27,247,122,247,80,251,38,251,199,11,6,225,248,97,5,57,6,251,
+201,75,5,80,7,247,66,120,251,56,253,250,5,247,83,6,225,248,89,5,11,151,104,
+82,166,247,216,29,244,217,215,210,31,11,247,127,29,248,166,227,7,251,0,147,
+110,248,105,29,247,107,250,212,248,127,29,11,251,83,6,251,33,253,68,5,88,
+98,251,25,251,21,45,27,51,122,247,4,227,158,31,247,29,249,48,5,251,83,6,251,
+35,253,72,5,92,108,251,10,251,21,251,19,27,85,88,204,247,30,168,31,11,249,
+195,249,189,21,137,182,5,129,108,111,133,114,27,125,88,145,186,149,31,208,
+247,236,247,109,29,11,21,201,78,221,251,40,251,170,251,164,251,181,252,3,
+247,66,29,11,247,216,29,244,217,215,210,31,49,168,247,146,29,11,247,248,251,
+109,248,1,251,41,247,78,30,247,47,29,11,5,135,248,6,29,235,247,48,205,151,
+172,30,11,35,250,158,5,251,58,6,252,117,247,64,29,248,148,250,218,11,21,63,
+6,251,201,248,44,29,251,46,254,19,247,83,29,11,108,51,110,47,123,55,8,237,
+6,154,219,167,225,168,217,8,136,151,166,137,151,27,247,56,247,119,247,9,247,
+87,227,76,194,53,251,54,53,251,19,251,31,76,31,94,190,120,223,221,26,11,133,
+112,120,127,113,137,25,251,1,128,5,62,248,152,216,7,251,19,150,103,143,130,
+153,143,162,25,11,247,199,29,248,168,225,7,251,8,149,102,247,203,29,11,209,
+167,210,207,247,182,29,11,250,224,28,5,51,21,247,13,34,196,251,107,251,240,
+251,45,251,223,32,116,30,251,113,254,195,247,245,29,228,83,251,0,116,31,11,
+248,21,247,74,247,185,247,171,247,172,251,74,247,185,252,21,31,253,1,251,
+5,248,252,6,247,172,247,58,251,90,251,154,251,155,251,58,251,88,251,172,31,
+252,252,251,5,6,14,21,247,69,203,205,247,17,163,31,247,17,163,100,248,31,
+29,159,100,56,123,31,56,123,105,100,251,12,27,251,37,6,125,70,5,14,247,5,
+252,252,7,251,172,251,58,247,88,247,155,247,154,247,58,247,90,247,172,31,
+248,252,247,5,253,1,6,252,21,251,74,251,185,251,172,251,171,247,74,251,185,
+248,21,31,14,247,175,29,14,21,213,101,188,52,88,98,120,113,113,30,178,251,
+140,75,251,54,45,251,31,251,31,251,74,25,75,249,10,129,236,92,186,251,3,141,
+25,251,111,71,5,80,7,247,38,131,5,161,11,248,8,29,247,8,150,5,247,134,29,
+59,252,53,5,130,106,47,113,57,27,251,40,251,141,247,2,247,222,11,21,96,184,
+5,251,25,251,17,251,227,102,251,183,27,251,181,251,202,176,247,25,65,31,77,
+94,5,251,66,217,247,147,51,248,22,27,248,21,247,172,227,247,66,247,37,31,
+14,248,224,28,5,16,247,39,29,251,3,147,125,141,125,143,126,164,25,251,160,
+248,248,248,87,248,148,147,150,159,157,160,141,25,11,247,74,78,247,89,251,
+99,251,7,251,2,57,94,69,11,28,5,190,21,34,203,254,181,28,249,160,227,73,5,
+11,247,120,29,247,23,247,113,239,247,146,197,247,23,176,225,237,247,48,172,
+170,8,11,247,9,129,176,247,166,29,49,252,103,5,253,19,6,229,248,103,248,133,
+29,247,13,149,5,225,252,168,53,7,247,63,29,11,122,57,5,52,121,199,82,247,
+33,27,156,6,251,79,252,12,5,231,6,247,84,248,21,247,12,157,234,181,165,148,
+25,217,7,117,133,41,106,71,137,248,0,249,111,24,14,5,45,123,157,32,247,31,
+27,247,5,247,48,209,153,172,31,14,184,131,118,207,49,27,61,53,83,82,76,31,
+161,247,5,5,86,6,251,93,102,5,102,7,247,5,129,251,9,252,159,5,247,25,6,225,
+248,48,5,170,166,221,217,200,27,11,135,168,153,149,170,141,25,227,143,5,225,
+252,101,53,7,217,135,165,137,158,127,143,112,25,11,28,5,150,247,72,29,11,
+142,155,157,162,168,143,25,247,17,147,5,227,252,166,51,7,247,8,131,167,137,
+148,114,136,123,25,62,252,23,5,139,46,149,83,251,220,251,118,251,45,251,183,
+83,30,11,203,88,194,43,69,68,118,90,79,30,251,68,251,37,137,248,106,29,8,
+55,69,111,82,251,27,27,241,248,152,143,157,158,162,167,141,25,247,17,149,
+5,227,11,227,7,251,3,147,110,141,131,164,141,155,25,244,248,165,5,247,203,
+6,159,241,5,251,203,6,237,248,136,5,248,60,6,156,163,124,121,137,31,127,251,
+132,5,245,6,11,22,251,2,6,44,71,41,251,10,251,13,26,38,219,105,227,176,178,
+145,147,174,30,157,247,9,5,248,154,29,244,227,227,215,198,31,14,247,60,29,
+244,217,215,210,31,11,248,129,251,116,21,247,4,251,195,7,164,247,16,247,131,
+29,247,19,29,31,11,27,247,146,247,30,247,46,247,60,239,52,217,49,211,31,247,
+137,29,14,254,64,6,73,251,217,5,247,33,6,195,247,72,5,165,147,151,152,168,
+27,248,115,6,11,5,155,143,158,166,167,27,247,236,6,160,147,118,121,137,31,
+131,251,76,5,247,4,6,11,5,153,208,148,209,211,26,247,86,67,247,46,251,109,
+51,251,7,96,34,96,172,98,180,127,30,247,105,247,25,5,178,117,147,91,96,26,
+78,127,76,126,77,30,11,113,251,23,104,48,100,107,25,104,108,104,133,96,131,
+251,31,247,66,24,82,57,55,69,61,221,84,217,247,189,247,78,247,23,247,164,
+192,31,247,29,249,87,5,11,21,247,11,55,170,73,47,72,55,71,113,151,118,145,
+129,30,247,19,6,251,31,251,33,251,21,46,51,30,247,15,6,227,206,247,79,247,
+66,247,66,26,14,247,84,29,251,42,253,141,247,212,29,5,251,2,116,247,32,128,
+188,27,225,247,45,193,151,174,31,11,21,96,6,251,197,59,5,73,7,247,89,162,
+251,13,252,240,5,116,133,127,127,110,27,251,5,133,5,69,248,36,207,7,51,147,
+5,116,129,151,162,143,31,11,49,7,243,131,168,137,151,118,135,119,25,251,109,
+254,216,135,119,119,116,110,137,25,251,7,131,5,51,248,154,227,7,251,0,147,
+110,141,129,162,143,159,25,11,251,78,39,96,25,90,237,5,251,5,70,127,43,83,
+171,57,238,247,15,247,0,217,247,21,223,31,96,251,99,5,221,6,247,199,203,5,
+198,7,251,64,158,11,251,11,6,51,71,251,83,251,66,251,62,26,33,205,92,229,
+229,203,219,206,176,126,155,131,150,30,251,17,6,143,247,29,247,29,247,21,
+232,227,8,14,250,7,21,248,77,29,37,221,49,223,73,30,11,251,160,100,130,78,
+247,52,98,227,251,3,215,251,29,190,251,31,25,157,108,107,152,106,27,251,201,
+251,112,251,199,251,230,251,136,247,44,251,40,247,107,11,27,247,25,247,56,
+247,15,247,58,199,96,206,65,102,88,110,90,112,31,247,209,29,5,11,184,247,
+21,163,31,217,248,29,247,148,29,53,252,66,5,251,126,94,11,21,194,114,182,
+78,84,91,82,86,124,144,123,149,127,30,223,6,118,251,1,84,84,251,1,116,129,
+90,24,247,38,153,247,31,247,17,247,44,26,14,21,252,53,6,110,251,27,5,248,
+56,6,14,27,251,73,251,0,251,60,251,17,88,174,69,217,247,141,29,11,113,27,
+102,108,173,173,146,31,247,54,249,163,248,87,29,251,38,253,83,5,136,123,138,
+124,127,26,86,171,102,220,11,214,27,209,247,56,147,139,31,252,218,252,156,
+247,5,45,215,239,5,247,29,131,247,29,251,21,251,37,26,251,81,251,60,251,88,
+251,88,83,96,151,11,247,181,225,211,247,52,251,21,24,215,149,192,174,204,
+26,11,225,252,169,53,7,247,9,129,176,247,166,29,11,251,32,6,109,90,5,176,
+102,67,176,63,27,11,135,115,121,126,112,137,25,251,11,129,5,53,11,21,247,
+152,28,5,86,145,170,119,169,108,145,25,108,145,109,119,133,108,251,152,28,
+250,170,24,133,108,159,109,170,133,170,133,169,159,145,170,8,11,247,196,29,
+252,31,5,151,104,82,166,247,216,29,11,251,82,6,32,252,152,115,251,11,251,
+38,251,78,39,96,25,90,237,5,251,5,70,127,43,83,171,57,238,247,15,247,0,217,
+247,21,223,31,96,11,247,58,228,231,240,199,83,186,80,182,31,82,181,78,187,
+183,26,171,159,192,198,155,151,133,135,144,30,199,64,5,172,141,202,148,196,
+26,14,247,6,129,176,247,166,29,11,254,144,67,250,13,5,164,149,153,170,141,
+30,229,143,5,225,252,109,53,7,225,135,174,137,151,127,141,112,25,242,28,251,
+4,5,247,35,6,11,127,121,25,252,31,252,168,251,60,248,168,247,138,29,11,248,
+17,29,30,247,211,29,11,251,62,67,50,251,101,193,24,108,248,41,29,247,95,11,
+247,108,29,247,126,247,49,210,248,0,11,21,174,110,173,88,86,108,103,106,102,
+166,108,194,190,170,172,174,30,143,253,132,21,186,7,135,122,78,115,108,27,
+102,117,167,172,145,31,11,59,6,251,209,78,5,77,7,247,72,121,63,252,35,5,139,
+78,157,110,251,15,251,10,251,5,251,18,251,9,247,2,65,247,29,123,30,11,145,
+129,31,120,145,121,166,161,26,247,83,251,13,7,84,251,214,5,90,247,47,247,
+1,108,247,25,27,248,123,247,228,248,60,248,72,31,11,21,251,37,6,28,251,90,
+28,250,106,5,247,37,6,11,21,195,251,76,7,165,247,33,5,58,6,74,251,15,39,98,
+5,99,7,223,146,58,252,9,5,135,121,137,122,123,26,79,169,93,235,11,21,251,
+57,55,251,26,36,84,35,168,247,13,155,141,156,143,159,30,184,247,128,5,153,
+161,203,162,165,27,247,32,182,81,251,11,31,11,247,159,29,247,47,249,109,145,
+166,158,151,165,141,25,11,247,56,29,74,251,228,5,251,7,117,251,0,57,46,27,
+251,31,97,215,247,30,165,31,11,248,15,21,248,14,29,11,21,251,39,6,245,248,
+144,5,47,6,252,195,252,148,121,49,5,248,60,6,81,251,173,5,247,11,6,197,247,
+173,5,247,39,6,11,22,251,240,251,85,252,68,251,191,251,83,251,21,247,62,247,
+168,247,255,247,85,248,58,247,191,247,88,247,16,251,71,251,164,30,11,247,
+132,29,248,6,247,225,194,248,40,247,119,251,142,217,251,160,80,46,129,139,
+31,11,251,107,21,180,119,188,67,81,117,117,110,114,30,251,166,251,212,5,247,
+19,6,247,189,247,87,5,168,157,157,166,180,26,14,248,144,29,195,247,189,5,
+247,220,29,11,247,206,29,190,92,225,247,166,247,38,248,64,247,97,174,30,11,
+21,215,75,201,64,63,77,77,63,64,201,77,215,214,203,201,214,30,11,247,151,
+29,252,157,254,115,11,248,104,29,204,247,13,176,174,207,31,11,5,247,76,171,
+74,217,251,42,27,248,130,29,31,177,247,83,5,57,6,251,201,248,44,29,11,248,
+109,29,180,178,113,30,247,6,249,0,5,198,209,248,159,29,11,248,70,29,247,81,
+247,15,247,128,247,35,215,30,251,33,173,217,251,130,247,27,27,11,247,121,
+203,247,81,247,29,247,113,26,247,128,251,109,206,251,120,30,252,184,53,6,
+247,6,129,174,247,166,29,11,114,84,119,90,122,77,82,92,8,92,102,32,153,139,
+26,127,78,5,139,190,114,192,162,247,15,146,190,194,30,247,11,243,11,251,61,
+27,104,79,144,163,113,31,104,247,64,5,147,125,120,141,123,27,57,82,59,64,
+251,46,247,117,135,247,0,247,144,11,21,251,174,251,17,251,44,251,193,248,
+54,29,247,74,225,67,251,48,30,14,6,168,153,124,113,135,31,118,251,38,5,247,
+9,6,229,248,105,5,251,6,6,100,251,29,5,110,130,125,129,110,27,11,21,247,178,
+29,251,0,83,72,65,30,247,9,249,0,5,59,6,251,212,78,5,77,7,247,75,121,11,252,
+193,254,58,5,247,91,6,248,46,249,70,235,252,101,5,251,49,170,180,46,247,31,
+27,247,66,247,48,193,247,27,11,238,200,100,135,149,31,164,133,155,119,137,
+108,248,115,29,188,251,50,49,160,251,25,27,11,5,251,11,182,251,35,227,247,
+74,26,247,125,247,39,227,247,105,30,180,251,92,5,188,6,223,203,200,221,31,
+14,247,80,6,223,248,52,233,223,182,49,247,1,251,146,194,55,25,11,191,241,
+246,31,106,118,251,13,247,46,227,247,31,184,168,190,30,11,247,115,29,248,
+171,225,7,251,7,149,102,247,203,29,11,32,252,201,5,110,111,36,41,43,247,188,
+29,11,247,177,247,121,194,30,176,247,44,211,248,180,151,232,8,248,111,6,98,
+248,107,29,11,28,5,20,22,252,240,28,5,190,253,64,28,250,66,5,250,134,247,
+7,21,253,236,6,248,91,250,94,5,14,5,133,110,137,110,113,26,38,184,63,247,
+40,11,5,248,112,29,11,143,157,160,162,167,141,25,247,28,149,5,227,11,5,251,
+168,85,251,38,251,16,251,47,27,99,106,146,144,94,31,142,53,190,128,188,130,
+180,140,25,247,128,145,11,5,247,2,162,96,187,43,27,49,40,81,84,82,31,161,
+247,5,5,84,6,251,93,102,5,102,7,247,5,129,11,88,88,8,251,33,7,247,45,247,
+41,246,203,247,228,251,11,247,25,92,186,110,247,54,150,247,14,147,247,5,11,
+135,121,121,116,110,137,25,251,9,129,5,51,248,169,227,7,251,15,149,110,141,
+129,162,143,157,25,231,248,107,11,159,143,132,127,137,31,123,251,5,5,247,
+0,6,215,247,243,5,251,1,6,107,34,5,123,133,132,133,121,27,11,180,106,186,
+68,77,111,119,108,112,30,251,171,251,212,5,247,36,6,247,199,247,91,5,170,
+160,157,163,178,26,11,237,64,209,81,55,26,35,63,73,55,70,98,172,180,110,30,
+178,239,5,152,125,96,169,89,27,56,100,94,74,11,6,37,252,169,135,115,118,126,
+115,137,25,251,15,129,5,53,11,248,163,248,48,29,11,251,175,36,251,127,251,
+142,91,31,126,67,5,251,79,6,248,41,247,42,21,244,159,176,247,115,247,22,27,
+11,247,126,29,5,11,53,7,247,6,129,174,247,166,29,248,62,29,135,115,129,126,
+114,137,25,251,21,129,5,53,11,131,251,11,247,11,24,58,135,79,84,77,26,88,
+180,55,247,42,247,88,247,56,247,111,247,109,247,19,30,11,250,95,28,4,215,
+21,219,73,227,251,90,251,157,251,178,251,5,251,201,251,164,247,27,83,247,
+29,70,30,11,201,77,221,251,39,251,68,251,120,251,83,251,158,59,30,64,6,225,
+248,68,5,251,83,6,53,252,68,5,11,21,251,37,63,251,79,251,19,74,88,199,247,
+15,247,51,227,247,62,247,6,207,188,76,251,9,30,14,21,251,66,251,66,90,251,
+66,30,116,6,221,248,11,161,141,5,247,17,149,247,34,106,251,23,26,14,249,164,
+252,164,21,28,8,110,251,17,28,247,146,7,251,156,22,248,126,29,27,233,248,
+122,5,77,6,251,209,73,5,86,7,247,52,110,251,60,253,244,5,247,80,6,225,248,
+68,11,51,7,245,131,168,135,147,116,135,123,25,251,107,254,220,247,200,29,
+11,111,5,248,66,249,45,21,252,144,252,197,242,248,220,5,143,153,190,151,151,
+27,195,184,100,109,196,31,11,162,247,127,5,251,32,6,70,251,221,5,122,169,
+247,46,49,247,103,27,248,54,247,45,247,148,247,89,11,227,7,35,149,110,141,
+131,162,143,157,25,231,248,107,201,135,177,119,162,92,25,247,105,252,111,
+5,73,11,5,125,172,190,116,200,27,247,226,247,144,247,214,247,228,11,137,123,
+119,114,110,137,25,251,35,131,5,51,248,125,7,11,251,122,247,7,251,244,248,
+103,247,62,247,123,209,149,180,11,225,252,164,53,7,247,5,128,176,137,147,
+125,135,116,25,11,21,247,19,28,251,52,251,19,7,11,7,247,62,252,58,234,176,
+251,150,248,234,5,251,32,6,251,150,252,234,234,102,247,62,248,58,5,11,51,
+208,45,219,213,247,187,29,11,131,162,153,155,161,141,25,247,23,147,5,225,
+252,166,53,7,247,7,131,153,137,155,137,148,112,25,11,135,115,129,126,114,
+137,25,251,21,129,5,53,248,171,225,7,251,11,149,102,247,203,29,11,143,159,
+157,162,168,141,25,247,17,147,5,227,252,173,51,7,247,11,131,168,137,149,116,
+135,119,25,11,196,184,190,156,149,31,251,0,247,23,5,176,161,192,161,174,27,
+194,203,110,109,194,31,247,73,178,11,21,251,232,249,117,5,49,6,251,232,253,
+117,5,232,6,247,184,249,39,247,185,253,39,5,14,6,247,76,247,9,82,233,253,
+15,252,44,5,53,7,249,15,252,43,196,233,251,76,247,9,5,11,21,247,45,168,251,
+3,206,251,22,27,57,45,99,69,126,31,132,102,160,112,139,26,247,80,6,11,248,
+42,247,55,104,230,252,212,251,141,5,251,25,7,248,212,251,141,174,230,252,
+42,247,55,5,11,75,247,17,223,247,43,197,151,248,98,29,70,157,215,153,31,11,
+247,206,29,180,92,225,247,166,11,143,161,162,158,163,141,25,247,5,147,5,227,
+252,148,51,7,245,131,164,137,153,120,135,117,25,11,21,252,56,6,88,251,150,
+5,233,6,172,247,58,5,247,125,6,106,251,58,5,231,6,14,247,77,31,237,251,50,
+5,247,23,156,166,202,192,26,11,225,252,53,53,7,239,135,178,137,141,121,129,
+118,25,11,5,73,123,165,51,247,17,27,227,215,170,198,209,31,121,126,67,240,
+196,229,166,155,172,30,11,6,211,247,101,251,21,251,183,82,31,243,6,221,248,
+56,53,147,111,143,104,190,143,158,25,11,21,251,21,53,251,88,251,29,67,94,
+210,238,247,84,247,15,247,46,237,221,176,49,38,30,11,30,43,182,5,251,5,35,
+51,84,251,1,27,57,90,223,208,236,233,247,0,247,9,188,31,11,248,84,6,170,165,
+165,170,170,113,165,108,31,252,84,6,108,113,113,108,108,165,113,170,31,11,
+106,247,11,27,192,215,154,157,202,31,225,7,137,106,111,137,114,27,67,100,
+159,240,88,31,11,133,114,120,127,115,137,25,43,129,5,61,248,64,217,7,32,247,
+243,29,11,247,177,29,217,7,43,149,102,143,130,153,144,162,25,11,141,151,149,
+145,158,141,25,241,147,5,217,252,72,61,7,237,131,164,137,139,131,137,133,
+25,11,143,157,168,160,157,141,25,246,149,5,233,252,130,45,7,246,129,157,137,
+164,118,135,121,25,11,252,86,251,204,252,66,252,76,251,236,247,122,251,118,
+247,219,248,118,247,170,248,91,248,68,11,213,133,162,248,46,29,251,30,253,
+41,136,125,128,131,121,138,25,62,133,5,87,11,254,74,21,28,13,122,251,72,28,
+242,134,7,14,21,213,7,135,118,53,110,111,27,83,11,137,147,123,135,116,25,
+11,28,5,94,21,11,6,168,149,114,121,135,31,251,107,254,212,135,123,121,114,
+110,137,25,251,31,131,5,51,11,254,145,6,85,251,205,5,247,9,6,196,247,72,5,
+166,146,156,153,161,27,247,122,6,11,135,118,131,127,117,137,25,38,131,5,61,
+248,25,7,248,52,247,183,247,140,247,252,31,11,248,172,248,154,247,64,155,
+5,248,34,29,11,188,247,224,5,251,0,6,59,251,126,132,121,118,119,125,136,25,
+135,130,89,109,59,27,11,225,7,251,7,149,103,141,130,156,143,159,25,247,103,
+250,226,146,166,157,151,166,141,25,11,21,47,6,247,26,252,129,251,226,252,
+130,5,231,6,248,29,248,79,160,242,5,14,21,28,251,43,6,110,251,27,5,28,4,216,
+6,11,43,149,102,143,130,153,144,162,25,247,47,249,109,11,135,114,121,127,
+112,137,25,43,129,5,61,248,109,11,247,62,67,247,99,251,103,41,11,5,137,121,
+137,120,123,26,251,56,247,66,65,247,23,247,97,247,113,247,1,247,162,11,247,
+75,247,158,21,55,55,61,55,77,92,182,203,223,221,217,223,200,189,96,75,30,
+11,83,119,33,44,37,251,90,65,120,40,24,247,145,227,247,91,247,53,177,247,
+93,8,11,199,229,229,247,29,166,247,38,247,23,247,0,247,86,51,24,195,178,186,
+186,186,26,11,211,88,188,65,251,64,251,35,251,126,251,47,59,30,247,139,75,
+68,247,34,42,27,11,247,204,29,14,247,214,29,225,7,11,21,217,7,254,9,247,175,
+5,61,7,249,171,251,136,253,171,251,135,5,61,7,11,26,192,170,227,229,164,157,
+129,133,147,30,231,251,17,5,190,143,236,153,234,26,11,27,251,19,108,247,21,
+247,6,247,118,242,247,225,247,205,164,192,43,125,137,31,11,42,251,37,113,
+25,251,44,247,66,5,82,80,51,69,61,247,2,86,217,247,189,11,28,4,112,28,6,22,
+21,190,251,238,88,7,215,133,163,248,46,29,11,248,46,29,251,29,253,41,135,
+125,128,131,121,138,25,63,133,5,87,11,141,25,247,13,149,5,225,252,168,53,
+7,247,6,129,174,247,166,29,11,151,104,82,164,77,27,251,254,251,109,251,236,
+251,218,251,64,202,251,87,247,121,11,215,248,23,143,155,158,164,167,141,25,
+247,34,147,5,227,252,177,51,7,246,131,11,5,55,6,251,201,75,5,80,7,247,68,
+120,11,248,112,29,70,11,125,92,94,114,102,27,114,62,161,217,155,31,11,251,
+46,219,94,251,6,5,126,114,125,137,131,11,135,115,118,126,115,137,25,251,11,
+129,5,53,11,135,123,121,114,110,137,25,251,21,131,5,51,11,149,119,123,120,
+116,137,25,251,23,131,5,53,11,21,252,27,6,247,195,248,168,5,11,141,131,156,
+143,159,25,11,33,147,110,143,129,162,143,155,25,247,109,250,220,141,155,160,
+164,167,141,25,11,80,100,25,251,98,227,5,73,98,88,86,98,26,86,179,63,247,
+19,247,94,11,119,251,4,90,251,36,100,96,25,251,97,195,5,119,126,102,111,88,
+26,77,11,248,152,254,211,5,247,40,6,247,133,28,4,213,248,45,29,11,164,247,
+19,5,59,6,251,202,248,44,29,251,123,28,251,93,11,247,5,251,17,5,111,116,111,
+100,248,113,29,11,28,7,123,248,181,21,247,31,7,252,234,247,150,102,45,248,
+58,251,62,5,11,247,21,7,251,7,251,8,251,7,58,251,1,27,251,27,92,247,31,247,
+25,11,21,214,76,201,63,63,78,77,64,63,200,77,215,215,202,201,215,30,14,5,
+235,229,247,31,221,205,27,184,204,107,251,1,119,31,251,17,253,9,11,7,251,
+123,251,232,5,139,247,22,138,140,26,140,247,123,247,231,139,30,11,248,69,
+29,137,133,118,127,121,25,11,77,27,251,254,251,109,251,236,251,218,251,64,
+202,251,87,247,121,247,7,11,118,133,107,125,73,70,69,251,41,85,123,62,24,
+247,81,203,247,40,244,11,137,176,247,212,247,194,247,75,247,187,247,66,251,
+57,247,13,251,192,30,11,147,110,143,129,162,143,155,25,247,109,250,220,141,
+155,160,162,167,143,25,11,251,80,6,77,251,213,5,42,122,75,94,56,27,83,102,
+181,241,159,31,11,247,27,98,98,225,51,27,102,251,64,81,127,102,31,88,7,247,
+78,125,11,61,7,235,129,174,135,149,125,135,116,25,11,143,117,127,126,108,
+135,25,45,129,5,53,11,5,251,17,6,39,251,97,11,6,73,251,217,5,247,7,6,200,
+247,76,5,159,147,156,156,157,27,11,6,247,253,29,11,7,251,23,251,42,33,71,
+47,27,251,11,63,247,1,247,41,164,143,11,21,200,94,195,57,53,98,83,78,73,192,
+90,213,215,190,205,188,30,11,21,55,59,61,55,78,89,182,202,225,221,213,223,
+201,186,98,76,30,11,21,185,112,167,93,95,109,109,95,94,169,110,183,185,166,
+166,186,30,11,31,51,252,38,5,247,23,6,229,248,52,5,166,159,211,217,221,27,
+11,82,104,26,104,70,88,139,30,159,94,5,139,247,81,247,0,184,223,11,251,7,
+127,5,53,248,77,225,7,45,149,100,143,124,148,154,165,25,11,251,52,247,23,
+24,139,251,3,112,51,26,67,164,84,247,19,247,140,11,28,4,152,250,236,21,247,
+50,251,1,243,251,189,30,252,211,53,6,11,252,44,249,15,5,53,6,252,44,253,15,
+234,81,247,8,247,77,5,11,184,194,199,30,148,28,251,26,21,217,7,131,112,45,
+98,92,27,83,11,208,112,172,100,153,30,251,86,251,29,5,87,172,131,223,221,
+26,190,11,247,33,7,251,33,251,17,251,9,67,251,139,215,251,5,174,251,38,11,
+130,111,80,118,88,27,94,97,165,182,149,31,223,248,22,5,14,30,131,251,99,248,
+162,29,11,129,176,135,147,125,135,116,25,11,149,104,143,129,153,143,162,25,
+11,225,252,99,53,7,237,131,174,11,5,247,82,6,247,40,249,97,5,233,229,247,
+19,205,206,27,184,11,5,247,129,6,165,150,127,110,137,31,132,251,72,5,247,
+8,6,11,6,150,156,129,124,137,31,136,251,38,5,216,6,194,247,161,5,11,27,251,
+39,48,41,251,11,82,31,247,1,6,194,161,196,178,174,11,27,252,124,251,228,252,
+60,252,72,251,183,247,54,251,181,248,44,11,47,131,5,61,248,1,217,7,57,147,
+116,141,137,153,145,152,25,11,57,65,27,59,59,217,247,68,247,212,247,70,247,
+138,247,91,192,11,64,202,77,215,215,200,201,214,215,78,201,63,63,76,77,63,
+30,11,79,251,205,5,247,21,6,203,247,72,5,166,147,157,153,164,27,11,88,139,
+30,160,94,5,139,247,80,247,0,184,223,94,156,163,26,11,113,160,118,165,165,
+161,160,165,165,117,161,113,113,118,117,113,30,11,168,151,127,110,137,31,
+131,251,72,5,247,21,6,202,247,205,5,11,186,177,177,186,186,101,177,92,92,
+101,101,92,92,177,101,186,31,11,214,76,201,63,63,80,77,64,63,198,77,215,215,
+202,201,215,30,11,237,66,151,139,30,251,79,251,12,5,84,163,116,178,215,26,
+184,11,21,248,25,251,172,247,27,252,9,30,11,247,76,190,247,118,247,23,247,
+109,26,11,112,137,114,119,26,51,188,77,247,17,11,195,94,182,65,88,86,124,
+103,96,30,11,231,248,117,146,166,157,149,166,141,25,11,5,247,83,6,247,33,
+249,68,5,235,229,247,31,221,205,27,11,5,124,137,123,123,123,27,40,131,5,61,
+248,85,7,247,162,11,21,248,7,28,7,155,5,251,7,6,252,7,28,248,101,5,11,251,
+226,21,231,83,158,127,145,30,251,82,251,35,5,79,102,11,84,251,161,5,216,6,
+196,247,38,5,154,144,159,149,150,27,11,251,13,6,66,251,128,5,115,130,123,
+122,112,27,252,39,6,11,147,108,86,151,104,27,251,50,251,58,45,251,72,43,207,
+65,11,247,246,21,248,67,29,11,251,135,247,12,251,30,247,87,247,74,247,27,
+247,11,221,223,11,247,38,247,23,247,0,247,87,51,24,194,178,186,186,186,26,
+11,190,28,4,216,21,52,248,80,252,203,226,249,34,7,14,248,220,251,196,21,249,
+34,52,252,203,252,80,52,7,14,5,47,121,217,34,247,29,27,247,33,247,64,184,
+247,28,11,247,50,5,251,23,123,113,75,86,26,77,200,57,247,39,11,21,247,42,
+247,29,247,23,247,43,247,7,53,221,251,5,11,247,66,251,52,252,66,57,31,252,
+58,59,251,127,251,58,11,57,88,248,70,29,11,251,31,247,139,27,247,80,247,144,
+247,40,247,96,178,31,11,247,177,247,121,195,30,176,247,44,210,248,180,152,
+232,8,11,153,210,24,141,6,247,97,247,57,247,9,247,135,186,31,11,178,247,12,
+27,247,37,6,152,208,5,251,25,6,251,69,11,187,90,218,251,31,251,173,251,15,
+251,230,251,109,98,30,11,205,251,69,27,251,25,6,126,70,5,247,37,6,247,12,
+11,247,254,247,238,248,140,31,251,113,157,21,252,25,251,107,11,217,252,142,
+61,7,247,19,129,174,137,149,123,133,116,25,11,225,252,166,53,7,247,23,129,
+168,137,141,116,122,123,25,11,252,108,251,217,21,247,25,247,4,251,25,247,
+5,5,65,11,5,82,129,155,75,229,27,213,239,180,147,160,31,14,135,27,248,4,209,
+7,247,76,211,72,251,5,31,14,5,247,80,6,223,248,52,233,223,11,27,247,39,231,
+237,247,11,197,31,11,251,9,251,66,122,30,247,48,175,11,116,117,115,87,26,
+119,163,57,244,11,127,102,27,115,61,147,217,153,31,11,229,59,24,219,165,172,
+193,192,26,11,75,5,80,7,247,64,120,11,145,166,158,151,166,141,25,11,138,144,
+129,136,125,25,11,5,135,121,139,120,123,26,251,56,247,64,65,247,25,11,5,248,
+3,6,170,149,129,110,31,251,81,247,23,7,11,7,251,8,247,77,44,81,248,44,253,
+15,5,225,6,11,21,251,38,6,28,251,91,28,250,106,5,247,37,6,11,21,248,74,29,
+11,249,0,5,198,207,239,185,205,27,188,237,73,251,76,11,49,5,249,9,6,184,247,
+107,5,63,6,94,39,5,11,88,88,143,139,30,247,19,249,28,5,139,229,149,182,11,
+247,158,247,28,247,177,247,70,243,217,32,251,86,30,11,133,114,120,127,112,
+137,25,33,129,5,61,249,154,7,11,248,75,29,31,11,174,31,247,142,251,27,7,71,
+251,242,5,128,160,227,11,217,252,19,61,7,237,131,5,166,137,137,131,133,26,
+11,225,252,64,53,7,231,135,176,137,153,125,127,114,25,11,247,25,7,252,212,
+247,141,104,48,248,42,251,55,5,11,251,105,254,226,11,5,196,197,227,191,184,
+27,168,182,118,74,124,31,11,5,141,157,164,139,165,27,247,30,204,98,57,31,
+11,6,251,34,251,173,247,1,83,247,62,247,229,5,11,7,247,117,231,251,21,251,
+183,82,31,241,6,239,11,247,68,251,35,232,251,101,104,86,120,123,104,30,11,
+30,253,62,22,214,78,201,63,63,78,77,64,63,11,28,5,8,21,225,252,129,53,7,247,
+19,131,173,11,53,221,24,57,125,94,98,73,26,67,199,98,222,11,86,143,139,30,
+247,17,249,7,5,139,229,149,182,11,247,131,185,238,246,247,130,27,181,228,
+129,139,31,11,137,25,32,128,5,62,248,152,216,7,251,21,150,11,139,247,5,154,
+235,26,194,124,207,251,21,251,138,11,141,160,171,248,155,29,11,251,60,103,
+124,65,24,247,116,159,247,107,247,85,11,188,86,219,251,46,251,60,251,93,251,
+1,251,93,11,247,15,246,221,197,200,31,49,148,173,89,238,27,11,247,26,6,112,
+251,35,5,221,6,166,247,35,5,11,5,247,91,221,247,96,247,51,247,130,26,14,156,
+133,156,111,118,26,251,82,247,1,7,14,5,139,247,12,138,140,26,140,11,57,92,
+78,86,75,182,88,223,11,251,21,251,183,81,31,244,6,11,6,114,251,17,5,11,5,
+86,6,251,93,102,5,102,7,247,2,129,11,5,88,248,139,29,11,5,59,6,251,201,78,
+5,77,7,247,64,121,11,25,247,52,251,13,5,139,247,2,158,233,26,11,31,131,251,
+76,5,247,5,6,202,247,217,5,11,51,6,247,11,131,167,135,149,116,135,123,25,
+11,251,222,6,125,59,5,186,135,233,127,139,26,11,247,119,251,81,247,13,251,
+160,80,46,129,139,11,28,5,45,21,190,251,34,43,170,251,11,27,11,112,84,108,
+137,108,27,90,88,211,227,100,31,11,251,30,251,107,5,41,125,167,247,85,98,
+31,11,250,87,247,117,21,44,197,251,8,251,77,5,11,172,30,215,7,135,121,251,
+1,104,119,27,120,11,216,7,251,21,150,103,143,130,153,144,162,25,11,227,252,
+167,51,7,247,9,131,168,135,147,116,11,231,251,42,27,251,29,251,40,67,47,53,
+31,11,249,220,247,142,21,44,176,251,62,252,58,5,11,247,123,247,27,27,207,
+182,84,86,31,14,90,172,204,91,205,27,11,141,129,164,143,155,25,11,251,76,
+251,21,251,42,11,251,163,115,251,136,104,251,84,104,251,82,11,6,170,147,129,
+110,31,251,58,247,23,7,11,21,251,138,251,33,251,201,251,80,65,71,11,25,70,
+133,5,92,247,227,186,7,55,145,11,51,7,194,215,131,139,31,168,137,151,114,
+11,55,6,251,209,78,5,77,7,247,78,121,11,81,27,84,43,188,159,83,31,251,64,
+94,11,252,240,5,251,3,117,247,14,116,189,27,11,133,251,80,24,247,31,6,203,
+247,221,5,11,135,114,119,127,114,137,25,53,129,5,61,11,137,25,251,11,129,
+5,53,248,169,225,7,11,141,174,247,84,168,251,49,251,44,172,30,11,155,160,
+164,167,141,25,247,23,147,5,227,11,247,232,5,251,17,6,76,251,89,5,115,11,
+251,130,252,15,251,56,231,251,148,248,8,11,247,31,104,84,127,79,110,113,117,
+77,81,11,247,34,63,190,235,5,157,157,164,141,149,11,21,45,6,71,251,243,5,
+233,6,14,31,227,6,143,158,139,159,158,26,14,28,8,110,251,16,28,247,146,7,
+14,5,157,143,158,164,167,27,11,8,152,166,169,198,207,26,11,27,186,186,147,
+164,195,31,11,251,29,251,45,40,47,49,11,135,117,117,120,114,137,25,11,141,
+151,149,145,157,141,25,11,143,166,160,151,163,141,25,11,145,166,158,151,163,
+141,25,11,247,23,156,165,202,192,26,11,251,105,28,251,133,11,5,247,47,6,249,
+87,28,5,29,5,11,5,213,6,247,146,247,117,77,251,234,11,6,251,100,103,5,102,
+7,247,10,128,11,7,247,35,247,103,247,35,251,103,5,11,21,251,166,247,212,5,
+168,114,117,161,11,21,183,7,137,125,83,122,121,27,102,11,25,251,227,252,19,
+251,60,248,19,130,11,27,247,41,247,102,208,247,102,180,31,11,27,247,207,247,
+112,247,200,247,223,31,11,27,247,155,247,57,247,3,246,196,31,11,32,247,32,
+27,247,4,247,48,209,153,11,49,251,64,5,34,102,174,223,156,31,11,247,107,251,
+89,247,35,251,76,251,84,11,82,214,5,61,100,251,44,40,251,116,11,251,2,147,
+114,141,125,158,143,161,25,11,251,25,251,4,247,25,251,5,5,213,11,116,153,
+180,194,209,247,181,155,205,31,11,133,114,115,134,112,27,94,102,160,188,11,
+141,164,27,247,127,221,251,1,251,49,11,147,5,227,252,185,51,7,247,13,131,
+11,221,233,174,219,208,102,172,102,153,30,11,247,27,247,56,239,63,184,53,
+153,30,11,239,185,205,27,188,237,73,251,76,31,11,6,252,58,251,62,176,45,5,
+14,177,5,175,7,251,4,150,5,14,5,247,13,6,11,248,159,29,14,247,78,239,182,
+25,188,41,5,247,3,211,151,235,31,14,254,226,247,58,29,11,247,55,29,14,5,248,
+60,6,156,163,124,121,137,31,127,251,132,5,245,6,14,114,27,67,100,159,240,
+88,31,251,176,248,187,248,172,248,154,11,254,220,247,132,29,11,6,248,136,
+29,247,199,29,11,143,160,161,204,152,170,8,247,57,29,11,21,247,198,29,57,
+37,242,251,15,27,251,73,11,247,173,29,14,247,2,29,217,7,133,116,11,141,25,
+252,22,248,71,46,29,21,233,251,175,7,180,247,126,247,224,29,251,46,71,5,72,
+7,247,21,151,11,141,25,253,137,28,249,221,66,29,21,28,251,146,247,226,29,
+247,148,6,11,250,81,21,180,106,186,68,77,111,119,108,112,30,251,171,251,212,
+5,247,36,6,247,199,247,91,5,11,248,169,21,180,106,186,68,77,111,119,108,112,
+30,251,171,251,212,5,247,36,6,247,199,247,91,5,11,249,168,21,180,106,186,
+68,77,111,119,108,112,30,251,171,251,212,5,247,36,6,247,199,247,91,5,11,247,
+63,29,248,62,29,133,115,121,126,112,137,25,251,9,129,5,53,11,5,247,80,6,247,
+42,249,97,5,233,229,247,19,205,204,27,184,230,83,251,0,116,31,251,17,252,
+240,11,195,29,247,10,11,175,29,14,248,165,29,248,171,225,7,251,11,149,104,
+141,129,156,143,159,25,11,227,29,14,158,29,14,247,67,29,247,86,247,177,247,
+121,194,30,176,247,44,11,27,83,107,162,210,230,243,248,117,168,247,0,31,248,
+171,29,11,21,204,88,191,75,74,90,85,76,75,190,88,202,203,190,190,203,30,247,
+134,248,58,68,29,5,249,19,247,101,29,11,247,171,29,252,181,252,173,5,105,
+6,192,247,169,5,14,5,242,29,49,168,75,247,17,11,222,29,251,27,143,21,11,202,
+196,244,231,214,197,209,65,24,235,172,180,194,186,26,190,141,96,199,47,27,
+67,94,106,59,61,31,251,223,251,234,242,248,154,5,11,40,74,184,247,71,29,14,
+250,193,190,21,137,211,5,247,197,29,247,5,248,187,5,247,77,178,55,231,251,
+42,27,251,29,251,40,67,47,55,31,11,26,251,62,247,25,57,247,47,247,71,247,
+29,225,247,30,247,8,247,155,29,11,247,44,29,5,14,171,188,195,225,163,244,
+217,208,247,46,70,24,184,170,180,175,182,26,248,7,29,48,63,113,55,88,43,8,
+251,1,79,80,67,251,25,27,11,234,29,55,252,62,133,112,120,127,113,137,25,251,
+1,128,5,62,11,21,251,38,6,251,135,251,81,251,62,247,81,5,251,36,6,247,93,
+251,239,5,247,54,6,247,6,248,221,46,29,5,171,159,184,166,180,219,211,94,247,
+54,29,11,6,55,252,72,5,252,54,241,29,248,53,6,86,251,169,5,45,123,157,32,
+247,31,27,11,135,29,14,21,200,90,190,77,82,84,84,82,77,190,86,200,201,188,
+192,201,30,252,60,22,200,88,190,77,80,88,84,80,79,190,86,198,201,190,192,
+201,30,248,94,248,58,68,29,249,205,239,29,11,247,8,29,205,87,192,43,70,67,
+118,90,79,30,251,68,251,37,127,248,106,29,8,55,69,251,0,82,251,25,27,11,28,
+5,8,63,29,14,202,196,244,231,214,197,209,65,24,235,172,180,194,186,26,190,
+141,96,199,47,27,67,94,106,59,61,31,251,223,251,234,247,82,250,76,5,57,6,
+251,209,78,5,77,7,247,72,121,251,164,28,250,168,248,38,29,11,21,204,29,11,
+183,29,216,249,239,39,29,248,71,21,200,90,190,77,82,84,84,82,77,190,86,200,
+201,188,192,201,30,252,60,22,200,88,190,77,80,88,84,80,79,190,86,198,201,
+190,192,201,30,248,76,248,134,35,29,72,29,190,249,77,21,217,81,184,63,84,
+251,11,96,68,112,154,118,167,156,153,146,147,151,30,172,158,155,190,184,27,
+176,149,100,110,57,78,102,67,121,31,108,251,44,5,209,6,162,247,7,5,219,168,
+225,196,235,26,14,62,29,86,248,32,35,29,21,213,7,135,118,53,110,111,248,190,
+29,252,19,251,98,251,245,251,209,251,39,194,251,112,247,133,248,78,29,218,
+247,46,205,153,172,31,251,193,249,128,215,29,2,0,1,0,227,0,237,0,1,1,10,0,
+2,1,44,0,0,1,58,0,0,1,64,0,5,1,135,7,61,0,0,8,48,3,0,0,1,0,0,27,0,0,30,0,
+0,36,0,0,96,0,0,199,0,1,122,0,2,15,0,2,202,0,2,207,0,3,2,0,3,54,0,3,145,0,
+3,177,0,3,212,0,3,216,0,3,221,0,3,240,0,4,56,0,4,106,0,4,210,0,5,89,0,5,131,
+0,5,223,0,6,71,0,6,113,0,7,3,0,7,106,0,7,115,0,7,158,0,7,190,0,7,209,0,7,
+242,0,8,78,0,9,3,0,9,8,0,9,13,0,9,18,0,9,23,0,9,27,0,9,31,0,9,36,0,9,41,0,
+9,46,0,9,50,0,9,55,0,9,59,0,9,64,0,9,69,0,9,74,0,9,78,0,9,82,0,9,87,0,9,91,
+0,9,95,0,9,100,0,9,105,0,9,110,0,9,115,0,9,120,0,9,124,0,9,155,0,9,177,0,
+9,204,0,9,212,0,9,228,0,9,233,0,9,237,0,9,241,0,9,246,0,9,250,0,9,255,0,10,
+4,0,10,9,0,10,13,0,10,23,0,10,32,0,10,36,0,10,41,0,10,46,0,10,50,0,10,54,
+0,10,58,0,10,61,0,10,66,0,10,71,0,10,76,0,10,80,0,10,85,0,10,90,0,10,94,0,
+10,98,0,10,103,0,10,220,0,10,230,0,11,90,0,11,157,0,11,207,0,12,83,0,12,179,
+0,12,198,0,13,71,0,13,76,0,13,252,0,14,134,0,14,167,0,14,220,0,14,253,0,15,
+5,0,15,14,0,15,105,0,15,232,0,15,247,0,16,66,0,16,193,0,16,197,0,16,236,0,
+17,13,0,17,54,0,17,145,0,17,149,0,17,183,0,17,229,0,18,163,0,18,255,0,19,
+7,0,19,16,0,19,24,0,19,33,0,19,42,0,19,51,0,19,60,0,19,69,0,19,77,0,19,85,
+0,19,94,0,19,101,0,19,110,0,19,129,0,19,134,0,19,236,0,20,19,0,20,24,0,20,
+182,0,20,210,0,20,215,0,20,220,0,21,38,0,21,42,0,21,209,0,22,139,0,22,188,
+0,22,208,0,23,76,0,23,210,0,23,214,0,24,43,0,24,82,0,24,161,0,24,225,0,25,
+24,0,25,48,0,25,101,0,25,122,0,25,156,0,25,241,0,26,71,0,26,82,0,26,162,0,
+26,210,0,27,65,0,27,222,0,27,232,0,27,242,0,27,252,0,28,6,0,28,15,0,28,25,
+0,28,36,0,28,44,0,28,52,0,28,60,0,28,69,0,28,79,0,28,89,0,28,99,0,28,108,
+0,28,118,0,28,127,0,28,136,0,28,145,0,28,154,0,28,164,0,28,173,0,28,183,0,
+28,193,0,28,203,0,28,213,0,28,223,0,28,233,0,28,241,0,28,250,0,29,3,0,29,
+12,0,29,21,0,29,29,0,29,38,0,29,48,0,29,58,0,29,68,0,29,78,0,29,88,0,29,99,
+0,29,109,0,29,120,0,29,129,0,29,138,0,29,147,0,29,156,0,29,165,0,29,173,0,
+29,182,0,29,192,0,29,201,0,29,209,0,29,218,0,29,227,0,29,235,0,29,243,0,29,
+254,0,30,12,0,30,17,0,30,110,0,31,31,0,31,167,0,32,119,0,32,134,0,32,253,
+0,33,11,0,33,25,0,33,49,0,33,158,0,33,172,0,33,239,0,34,119,0,34,159,0,34,
+199,0,35,56,0,35,59,0,35,63,0,35,176,0,36,21,0,36,25,0,36,69,0,36,119,0,36,
+124,0,36,127,0,36,171,0,38,74,0,38,78,0,38,94,0,38,102,0,38,108,0,38,117,
+0,38,127,0,38,142,0,38,152,0,38,167,0,38,177,0,38,186,0,38,195,0,38,211,0,
+38,225,0,38,239,0,38,253,0,39,12,0,39,21,0,39,30,0,39,39,0,39,48,0,39,63,
+0,39,71,0,39,86,0,39,100,0,39,108,0,39,117,0,39,126,0,39,136,0,39,145,0,39,
+169,0,40,39,0,40,99,0,40,156,0,40,246,0,41,61,0,41,167,0,41,236,0,41,239,
+0,41,243,0,42,1,0,42,17,0,42,48,0,42,174,0,42,177,0,42,181,0,42,186,0,42,
+196,0,42,206,0,43,121,0,44,13,0,44,136,0,44,141,0,44,223,0,45,33,0,45,43,
+0,45,59,0,45,70,0,45,86,0,45,97,0,45,115,0,45,125,0,45,135,0,45,150,0,45,
+165,0,45,180,0,45,196,0,45,214,0,45,224,0,45,234,0,45,244,0,45,254,0,46,9,
+0,46,19,0,46,35,0,46,50,0,46,60,0,46,71,0,46,82,0,46,93,0,46,109,0,46,199,
+0,47,41,0,47,112,0,47,199,0,47,242,0,48,55,0,48,116,0,48,223,0,49,80,0,49,
+192,0,49,197,0,50,99,0,50,165,0,50,176,0,50,186,0,51,18,0,51,26,0,51,34,0,
+51,43,0,51,64,0,51,148,0,51,158,0,52,3,0,52,71,0,52,104,0,52,155,0,53,19,
+0,53,28,0,53,79,0,53,184,0,53,249,0,53,254,0,54,8,0,54,113,0,54,118,0,54,
+232,0,55,53,0,55,63,0,55,73,0,55,83,0,55,154,0,56,37,0,56,123,0,57,17,0,57,
+196,0,57,225,0,57,253,0,58,53,0,58,92,0,58,141,0,58,247,0,59,140,0,59,145,
+0,59,156,0,60,61,0,60,69,0,60,77,0,60,227,0,60,233,0,60,238,0,60,247,0,60,
+253,0,61,7,0,61,17,0,61,27,0,61,36,0,61,53,0,61,79,0,61,100,0,61,161,0,61,
+171,0,62,18,0,62,98,0,62,144,0,63,2,0,63,10,0,63,74,0,63,96,0,63,143,0,63,
+148,0,63,158,0,63,237,0,64,87,0,64,92,0,64,101,0,64,106,0,64,111,0,64,205,
+0,64,214,0,64,223,0,64,232,0,64,242,0,65,4,0,65,31,0,65,115,0,65,132,0,65,
+186,0,66,34,0,66,208,0,67,55,0,67,198,0,67,247,0,68,107,0,68,219,0,68,224,
+0,69,56,0,69,87,0,69,97,0,69,143,0,69,148,0,69,157,0,69,161,0,69,165,0,69,
+174,0,69,180,0,69,189,0,69,198,0,69,206,0,69,215,0,69,224,0,69,234,0,70,36,
+0,70,40,0,70,59,0,70,156,0,70,232,0,71,63,0,71,112,0,71,186,0,72,57,0,72,
+110,0,72,159,0,72,171,0,72,189,0,72,250,0,73,91,0,73,227,0,74,7,0,74,10,0,
+74,13,0,74,123,0,74,233,0,74,238,0,75,66,0,75,101,0,75,111,0,75,121,0,75,
+132,0,75,142,0,75,153,0,75,163,0,75,167,0,75,171,0,75,224,0,76,36,0,76,153,
+0,76,165,0,76,183,0,76,196,0,76,213,0,77,18,0,77,126,0,77,131,0,77,183,0,
+77,208,0,78,65,0,78,203,0,79,212,0,80,209,0,80,214,0,81,42,0,81,51,0,81,57,
+0,81,67,0,81,77,0,81,93,0,81,104,0,81,120,0,81,131,0,81,148,0,81,158,0,81,
+168,0,81,178,0,81,188,0,81,198,0,81,208,0,81,219,0,81,230,0,81,240,0,81,249,
+0,82,3,0,82,13,0,82,22,0,82,32,0,82,83,0,82,92,0,82,109,0,82,141,0,82,165,
+0,82,176,0,82,183,0,82,223,0,82,227,0,82,231,0,82,235,0,83,64,0,83,150,0,
+83,160,0,83,220,0,84,119,0,84,232,0,84,240,0,85,81,0,85,105,0,85,113,0,85,
+206,0,85,229,0,86,51,0,86,160,0,86,246,0,87,95,0,87,198,0,88,78,0,88,83,0,
+88,92,0,88,141,0,88,202,0,89,11,0,89,15,0,89,104,0,89,132,0,89,141,0,89,149,
+0,89,163,0,89,172,0,89,186,0,89,195,0,89,212,0,89,220,0,89,228,0,89,236,0,
+89,244,0,89,252,0,90,4,0,90,13,0,90,22,0,90,30,0,90,39,0,90,48,0,90,58,0,
+90,68,0,90,78,0,90,88,0,90,105,0,90,114,0,90,129,0,90,240,0,90,249,0,91,28,
+0,91,137,0,91,169,0,92,0,0,92,115,0,92,224,0,92,229,0,92,240,0,93,125,0,94,
+30,0,94,181,0,94,185,0,94,193,0,94,244,0,95,55,0,95,134,0,95,234,0,95,244,
+0,96,16,0,96,26,0,96,104,0,96,138,0,96,143,0,96,153,0,96,234,0,97,53,0,97,
+58,0,97,67,0,97,116,0,97,166,0,97,182,0,97,214,0,98,27,0,98,36,0,98,121,0,
+98,160,0,98,199,0,99,48,0,99,52,0,99,114,0,99,171,0,99,179,0,99,235,0,100,
+5,0,100,21,0,100,54,0,100,195,0,100,206,0,100,217,0,100,228,0,100,239,0,100,
+250,0,101,4,0,101,16,0,101,170,0,102,34,0,102,41,0,102,155,0,102,169,0,102,
+220,0,103,126,0,103,249,0,104,105,0,104,179,0,105,31,0,105,53,0,105,63,0,
+105,72,0,105,82,0,105,92,0,105,102,0,105,113,0,105,123,0,105,172,0,105,241,
+0,106,79,0,106,138,0,107,19,0,107,175,0,108,33,0,108,146,0,109,4,0,109,92,
+0,109,100,0,109,106,0,109,116,0,109,125,0,109,134,0,109,144,0,109,153,0,109,
+162,0,109,171,0,109,180,0,109,201,0,109,204,0,109,207,0,110,26,0,110,68,0,
+110,129,0,110,187,0,110,223,0,110,226,0,110,246,0,111,28,0,111,121,0,111,
+213,0,111,230,0,112,26,0,112,30,0,112,155,0,112,158,0,112,164,0,112,193,0,
+112,226,0,112,252,0,113,80,0,113,111,0,113,146,0,113,191,0,113,223,0,113,
+227,0,114,24,0,114,57,0,114,80,0,114,84,0,114,88,0,114,129,0,114,178,0,114,
+183,0,114,187,0,114,191,0,115,8,0,115,18,0,115,28,0,115,38,0,115,48,0,115,
+59,0,115,70,0,115,81,0,115,154,0,115,216,0,115,243,0,116,23,0,116,27,0,116,
+49,0,116,94,0,117,15,0,117,59,0,117,63,0,117,75,0,117,132,0,117,145,0,117,
+177,0,117,181,0,117,202,0,118,81,0,118,105,0,118,145,0,118,208,0,118,228,
+0,118,250,0,119,59,0,119,94,0,119,114,0,119,145,0,119,198,0,119,202,0,119,
+212,0,119,222,0,120,40,0,120,49,0,120,56,0,120,66,0,120,76,0,120,87,0,120,
+98,0,120,109,0,120,120,0,120,131,0,120,148,0,120,158,0,120,172,0,120,187,
+0,120,201,0,120,226,0,121,27,0,121,66,0,121,145,0,121,218,0,121,233,0,121,
+249,0,122,17,0,122,32,0,122,48,0,122,80,0,122,134,0,122,183,0,123,58,0,123,
+63,0,123,68,0,123,123,0,123,130,0,123,161,0,123,182,0,123,242,0,123,252,0,
+124,6,0,124,16,0,124,26,0,124,36,0,124,47,0,124,57,0,124,66,0,124,75,0,124,
+85,0,124,95,0,124,106,0,124,117,0,124,167,0,124,216,0,125,37,0,125,72,0,125,
+85,0,125,100,0,125,120,0,125,136,0,125,152,0,125,219,0,126,105,0,126,169,
+0,126,178,0,126,186,0,126,195,0,126,205,0,126,216,0,126,231,0,127,35,0,127,
+157,0,127,162,0,127,170,0,127,237,0,128,63,0,128,126,0,128,157,0,128,201,
+0,128,244,0,129,101,0,129,131,0,129,161,0,129,196,0,129,219,0,130,31,0,130,
+77,0,130,81,0,130,148,0,130,219,0,130,229,0,131,44,0,131,90,0,131,183,0,131,
+206,0,132,23,0,132,81,0,132,107,0,132,205,0,132,243,0,133,21,0,133,86,0,133,
+118,0,133,153,0,133,251,0,134,103,0,134,211,0,134,220,0,134,230,0,134,239,
+0,134,248,0,135,1,0,135,35,0,135,85,0,135,135,0,135,170,0,135,249,0,136,73,
+0,136,104,0,136,203,0,136,206,0,136,209,0,136,217,0,137,27,0,137,51,0,137,
+63,0,137,189,0,138,13,0,138,97,0,138,102,0,138,112,0,138,122,0,138,170,0,
+139,30,0,139,159,0,139,168,0,139,177,0,139,188,0,139,199,0,139,210,0,139,
+227,0,140,14,0,140,63,0,140,131,0,140,215,0,141,5,0,141,112,0,142,6,0,142,
+11,0,142,21,0,142,73,0,142,107,0,142,148,0,143,4,0,143,75,0,143,160,0,143,
+165,0,143,175,0,143,185,0,143,207,0,143,212,0,143,235,0,144,38,0,144,49,0,
+144,59,0,144,70,0,144,80,0,144,97,0,144,107,0,144,117,0,144,128,0,144,186,
+0,144,238,0,145,26,0,145,66,0,145,135,0,145,226,0,146,2,0,146,61,0,146,157,
+0,146,227,0,147,21,0,147,57,0,147,118,0,147,147,0,147,157,0,147,225,0,148,
+13,0,148,96,0,148,231,0,149,48,0,149,190,0,150,49,0,150,182,0,151,51,0,151,
+55,0,151,101,0,151,136,0,151,202,0,151,212,0,151,221,0,151,230,0,151,239,
+0,151,255,0,152,8,0,152,18,0,152,28,0,152,69,0,152,119,0,152,172,0,152,243,
+0,153,48,0,153,191,0,153,225,0,154,13,0,154,24,0,154,34,0,154,114,0,154,119,
+0,154,246,0,154,254,0,155,5,0,155,16,0,155,27,0,155,37,0,155,56,0,155,138,
+0,156,62,0,156,93,0,156,183,0,157,5,0,157,20,0,157,144,0,157,166,0,158,28,
+0,158,186,0,158,198,0,158,222,0,158,227,0,158,232,0,159,75,0,159,175,0,159,
+185,0,159,195,0,159,206,0,160,23,0,160,27,0,160,175,0,161,29,0,161,157,0,
+161,181,0,162,107,0,162,195,0,162,213,0,162,222,0,162,231,0,162,240,0,162,
+250,0,163,3,0,163,12,0,163,21,0,163,30,0,163,95,0,163,188,0,164,9,0,164,40,
+0,164,112,0,164,153,0,164,171,0,165,12,0,165,73,0,165,142,0,165,237,0,166,
+34,0,166,82,0,166,93,0,166,97,0,166,106,0,166,115,0,166,148,0,166,157,0,166,
+166,0,166,242,0,167,52,0,167,145,0,167,155,0,167,165,0,167,175,0,167,185,
+0,167,196,0,167,207,0,167,218,0,167,229,0,168,173,0,169,34,0,169,91,0,169,
+147,0,169,216,0,170,55,0,170,144,0,170,227,0,170,236,0,170,245,0,171,188,
+0,171,193,0,171,203,0,171,213,0,171,237,0,171,247,0,172,1,0,172,5,0,172,71,
+0,172,80,0,172,86,0,172,95,0,172,104,0,172,119,0,172,129,0,172,144,0,172,
+154,0,172,164,0,172,173,0,172,182,0,172,191,0,172,201,0,172,211,0,172,221,
+0,172,225,0,172,233,0,172,241,0,172,250,0,173,4,0,173,12,0,173,21,0,173,29,
+0,173,38,0,173,42,0,173,51,0,173,174,0,173,177,0,173,180,0,173,235,0,173,
+244,0,174,82,0,174,184,0,175,18,0,175,140,0,175,149,0,176,51,0,176,141,0,
+176,201,0,176,206,0,176,216,0,176,225,0,176,235,0,176,244,0,176,254,0,177,
+54,0,177,219,0,178,34,0,178,162,0,179,42,0,179,207,0,180,77,0,180,206,0,181,
+89,0,181,144,0,181,197,0,181,252,0,182,49,0,182,56,0,182,130,0,182,206,0,
+182,216,0,182,225,0,182,240,0,182,250,0,183,9,0,183,19,0,183,37,0,183,46,
+0,183,55,0,183,65,0,183,76,0,183,87,0,183,98,0,183,107,0,183,117,0,183,127,
+0,183,140,0,183,150,0,183,160,0,183,171,0,183,180,0,183,191,0,183,201,0,183,
+217,0,183,221,0,183,225,0,183,235,0,184,104,0,184,185,0,185,16,0,185,25,0,
+185,190,0,186,54,0,186,59,0,186,68,0,186,78,0,186,88,0,186,97,0,186,108,0,
+187,29,0,187,193,0,188,63,0,188,157,0,189,48,0,189,165,0,190,32,0,190,36,
+0,190,166,0,191,10,0,191,14,0,191,119,0,191,217,0,191,226,0,191,234,0,192,
+0,0,192,154,0,192,175,0,193,1,0,193,10,0,193,80,0,193,125,0,193,139,0,194,
+39,0,194,187,0,195,12,0,195,102,0,195,195,0,196,19,0,196,169,0,197,67,0,197,
+244,0,198,113,0,198,120,0,198,129,0,198,242,0,198,246,0,199,91,0,199,95,0,
+199,99,0,199,107,0,199,115,0,199,194,0,199,253,0,200,63,0,200,203,0,201,137,
+0,202,41,0,202,100,0,202,162,0,203,31,0,203,217,0,204,240,0,205,51,0,205,
+118,0,205,202,0,206,53,0,206,238,0,206,241,0,207,32,0,207,122,0,207,180,0,
+207,246,0,208,117,0,208,161,0,208,165,0,209,41,0,209,100,0,209,206,0,210,
+2,0,210,59,0,210,68,0,210,74,0,210,85,0,210,94,0,210,103,0,210,112,0,210,
+122,0,210,133,0,210,144,0,210,162,0,210,172,0,210,199,0,210,249,0,211,5,0,
+211,57,0,211,111,0,211,136,0,211,233,0,212,98,0,212,176,0,212,199,0,212,235,
+0,212,255,0,213,20,0,213,81,0,213,139,0,213,167,0,213,228,0,213,236,0,213,
+249,0,214,71,0,214,131,0,214,149,0,215,25,0,215,62,0,215,72,0,215,82,0,215,
+92,0,215,102,0,215,111,0,215,122,0,215,133,0,215,151,0,215,162,0,215,186,
+0,216,46,0,216,66,0,216,169,0,217,31,0,217,136,0,217,148,0,217,176,0,218,
+69,0,219,58,0,219,165,0,220,29,0,220,164,0,221,48,0,221,178,0,221,248,0,222,
+104,0,222,244,0,223,102,0,224,13,0,224,123,0,224,128,0,224,163,0,225,3,0,
+225,13,0,225,29,0,225,39,0,225,50,0,225,59,0,225,70,0,225,88,0,225,98,0,225,
+108,0,225,178,0,225,242,0,226,45,0,226,54,0,226,117,0,226,196,0,227,62,0,
+227,71,0,227,146,0,228,6,0,228,19,0,228,128,0,229,73,0,229,108,0,229,227,
+0,229,235,0,229,249,0,230,1,0,230,11,0,230,19,0,230,29,0,230,46,0,230,56,
+0,230,66,0,230,158,0,231,36,0,231,157,0,232,58,0,233,8,0,233,28,0,233,37,
+0,233,43,0,233,53,0,233,63,0,233,73,0,233,83,0,233,93,0,233,102,0,233,112,
+0,233,121,0,233,157,0,233,210,0,234,4,0,234,122,0,234,216,0,235,14,0,235,
+76,0,235,166,0,235,214,0,235,239,0,236,75,0,236,209,0,237,68,0,237,106,0,
+237,154,0,237,230,0,237,235,0,238,15,0,238,46,0,238,55,0,238,59,0,238,131,
+0,238,191,0,238,199,0,238,237,0,238,246,0,239,0,0,239,10,0,239,20,0,239,30,
+0,239,40,0,239,83,0,239,154,0,239,170,0,239,226,0,239,255,0,240,55,0,240,
+135,0,240,213,0,240,248,0,241,20,0,241,77,0,241,202,0,242,59,0,242,139,0,
+242,147,0,242,153,0,242,163,0,242,171,0,242,180,0,242,189,0,242,198,0,242,
+207,0,242,217,0,242,226,0,242,236,0,242,251,0,243,10,0,243,25,0,243,35,0,
+243,44,0,243,54,0,243,63,0,243,72,0,243,81,0,243,90,0,243,98,0,243,122,0,
+243,203,0,244,37,0,244,108,0,244,117,0,244,127,0,244,137,0,244,146,0,244,
+156,0,244,222,0,244,228,0,245,67,0,245,118,0,245,207,0,246,28,0,246,132,0,
+246,200,0,247,31,0,247,146,0,247,236,0,248,22,0,248,127,0,248,136,0,248,146,
+0,248,156,0,248,166,0,248,175,0,248,184,0,248,194,0,248,204,0,248,215,0,248,
+224,0,248,240,0,249,0,0,249,11,0,249,21,0,249,31,0,249,42,0,249,53,0,249,
+64,0,249,75,0,249,86,0,249,174,0,249,250,0,249,255,0,250,9,0,250,18,0,250,
+28,0,250,38,0,250,49,0,250,150,0,250,208,0,250,254,0,251,47,0,251,166,0,251,
+171,0,252,1,0,252,10,0,252,16,0,252,25,0,252,36,0,252,62,0,252,85,0,252,145,
+0,253,35,0,253,90,0,253,122,0,253,186,0,253,197,0,253,215,0,253,241,0,254,
+76,0,254,159,0,255,34,0,255,131,1,0,2,1,0,90,1,0,98,1,0,106,1,0,111,1,0,175,
+1,0,234,1,0,243,1,0,254,1,1,79,1,1,99,1,1,109,1,1,125,1,1,146,1,1,216,1,2,
+12,1,2,134,1,2,139,1,2,228,1,2,238,1,2,248,1,3,2,1,3,12,1,3,22,1,3,32,1,3,
+43,1,3,121,1,4,39,1,4,136,1,5,12,1,5,136,1,5,141,1,5,226,1,6,58,1,6,68,1,
+6,78,1,6,88,1,6,98,1,6,108,1,6,119,1,6,197,1,7,153,1,7,157,1,7,161,1,8,28,
+1,8,37,1,8,43,1,8,51,1,8,60,1,8,114,1,8,179,1,9,41,1,9,113,1,9,124,1,9,142,
+1,9,249,1,10,1,1,10,10,1,10,15,1,10,20,1,10,29,1,10,39,1,10,99,1,10,204,1,
+10,241,1,10,251,1,11,11,1,11,15,1,11,124,1,11,133,1,11,142,1,11,150,1,11,
+158,1,11,166,1,11,174,1,11,182,1,11,190,1,11,199,1,11,208,1,11,217,1,11,227,
+1,12,54,1,12,127,1,12,237,1,13,16,1,13,95,1,13,217,1,14,6,1,14,70,1,14,75,
+1,14,85,1,14,197,1,14,237,1,15,29,1,15,143,1,15,148,1,15,240,1,15,250,1,16,
+4,1,16,13,1,16,23,1,16,33,1,16,43,1,16,54,1,16,125,1,16,177,1,17,21,1,17,
+168,1,17,173,1,17,182,1,17,191,1,17,201,1,17,211,1,17,215,1,17,224,1,18,47,
+1,18,195,1,18,223,1,19,121,1,20,20,1,20,175,1,21,28,1,21,39,1,21,49,1,21,
+60,1,21,70,1,21,80,1,21,148,1,21,227,1,22,22,1,22,71,1,22,213,1,23,52,1,23,
+141,1,23,200,1,24,0,1,24,46,1,24,168,1,24,234,1,24,243,1,24,251,1,25,4,1,
+25,14,1,25,24,1,25,68,1,25,127,1,25,172,1,25,228,1,26,109,1,26,112,1,26,116,
+1,26,120,1,26,242,1,26,252,1,27,60,1,27,159,1,27,241,1,28,126,1,28,241,1,
+29,103,1,29,203,1,29,207,1,30,73,1,30,174,1,30,184,1,31,37,1,31,161,1,32,
+22,1,32,133,1,32,156,1,32,247,1,33,85,1,33,187,1,33,230,1,33,247,1,33,251,
+1,33,255,1,34,35,1,34,65,1,34,111,1,34,232,1,35,84,1,35,170,1,36,143,1,36,
+213,1,37,190,1,38,30,1,38,98,1,38,107,1,38,155,1,38,239,1,39,117,1,39,138,
+1,39,248,1,40,45,1,40,98,1,40,102,1,40,112,1,40,116,1,40,126,1,40,206,1,41,
+31,1,41,144,1,41,253,1,42,4,1,42,98,1,42,195,1,43,35,1,43,74,1,43,114,1,43,
+229,1,44,89,1,44,179,1,44,188,1,45,32,1,45,131,1,45,224,1,45,237,1,46,80,
+1,46,99,1,46,118,1,46,139,1,46,158,1,46,174,1,46,192,1,46,225,1,46,243,1,
+46,249,1,47,48,1,47,56,1,47,66,1,47,79,1,47,116,1,47,153,1,47,163,1,47,178,
+1,47,183,1,47,191,1,47,200,1,47,209,1,47,216,1,47,221,1,48,23,1,48,27,1,48,
+61,1,48,79,1,48,83,1,48,87,1,48,91,1,48,100,1,48,110,1,48,119,1,48,129,1,
+48,166,1,48,204,1,48,222,1,48,227,1,48,245,1,48,250,1,49,13,1,49,18,1,49,
+37,1,49,42,1,49,77,1,49,84,1,49,122,1,49,158,1,49,165,1,49,203,1,49,224,1,
+49,231,1,49,252,1,50,17,1,50,24,1,50,45,1,50,79,1,50,140,1,50,146,1,50,181,
+1,50,215,1,51,20,1,51,54,1,51,61,1,51,75,1,51,105,1,51,109,1,51,113,1,51,
+177,1,51,216,1,51,255,1,52,87,1,52,96,1,52,110,1,52,215,1,52,223,1,52,236,
+1,53,85,1,53,99,1,53,113,1,53,119,1,53,138,1,53,157,1,53,194,1,53,198,1,53,
+202,1,53,206,1,53,226,1,53,246,1,54,9,1,54,13,1,54,21,1,54,31,1,54,46,1,54,
+57,1,54,66,1,54,73,1,54,78,1,54,87,1,54,93,1,54,104,1,54,115,1,54,129,1,54,
+138,1,54,146,1,54,153,1,54,172,1,54,195,1,54,202,1,54,207,1,54,215,1,54,223,
+1,54,229,1,54,240,1,54,250,1,55,2,1,55,7,1,55,23,1,55,56,1,55,62,1,55,70,
+1,55,75,1,55,105,1,55,111,1,55,153,1,55,203,1,55,251,1,56,25,1,56,54,1,56,
+103,1,56,109,1,56,116,1,56,127,1,56,176,1,56,225,1,56,232,1,56,240,1,57,16,
+1,57,23,1,57,28,1,57,34,1,57,64,1,57,93,1,57,141,1,57,171,1,57,202,1,58,4,
+1,58,64,1,58,71,1,58,77,1,58,135,1,58,141,1,58,217,1,58,221,1,58,225,1,58,
+232,1,58,238,1,59,24,1,59,57,1,59,85,1,59,116,1,59,173,1,59,206,1,60,28,1,
+60,35,1,60,44,1,60,94,1,60,160,1,60,225,1,60,233,1,60,239,1,60,248,1,60,254,
+1,61,5,1,61,13,1,61,19,1,61,27,1,61,41,1,61,52,1,61,77,1,61,91,1,61,119,1,
+61,151,1,61,159,1,61,169,1,61,242,1,62,13,1,62,57,1,62,63,1,62,69,1,62,75,
+1,62,82,1,62,91,1,62,97,1,62,104,1,62,113,1,62,121,1,62,128,1,62,134,1,62,
+140,1,62,184,1,62,191,1,62,200,1,62,210,1,62,218,1,62,224,1,62,233,1,62,243,
+1,62,250,1,63,55,1,63,111,1,63,145,1,63,204,1,63,211,1,63,217,1,63,225,1,
+63,244,1,64,9,1,64,17,1,64,48,1,64,91,1,64,101,1,64,119,1,64,149,1,64,177,
+1,64,207,1,64,234,1,65,6,1,65,37,1,65,54,1,65,61,1,65,71,1,65,107,1,65,146,
+1,65,184,1,65,203,1,65,231,1,66,1,1,66,10,1,66,26,1,66,56,1,66,62,1,66,67,
+1,66,138,1,66,145,1,66,153,1,66,181,1,66,202,1,66,233,1,67,41,1,67,57,1,67,
+71,1,67,85,1,67,99,1,67,112,1,67,128,1,67,142,1,67,156,1,67,170,1,67,182,
+1,67,193,1,67,203,1,67,213,1,67,223,1,67,232,1,67,243,1,67,253,1,68,6,1,68,
+15,1,68,23,1,68,112,1,68,128,1,68,143,1,68,187,1,68,211,1,68,235,1,69,6,1,
+69,34,1,69,50,1,69,87,1,69,105,1,69,121,1,69,139,1,69,155,1,69,171,1,69,181,
+1,69,198,1,69,223,1,69,241,1,69,255,1,70,36,1,70,83,1,70,115,1,70,148,1,70,
+189,1,70,222,1,71,4,1,71,52,1,71,91,1,71,130,1,71,169,1,71,208,1,72,18,1,
+72,47,1,72,75,1,72,84,1,72,115,1,72,123,1,72,150,1,72,157,1,72,185,1,72,212,
+1,72,221,1,72,229,1,72,235,1,73,7,1,73,34,1,73,46,1,73,79,1,73,212,1,74,89,
+1,74,167,1,75,12,1,75,21,1,75,62,1,75,71,1,75,79,1,75,102,1,75,168,1,75,191,
+1,75,214,1,75,215,1,75,216,1,75,217,1,75,218,1,75,219,1,75,220,1,75,221,1,
+75,222,1,75,223,1,75,224,1,75,225,1,75,226,1,75,227,1,75,228,1,75,229,1,75,
+230,1,75,231,1,75,232,1,75,233,1,75,234,1,75,235,1,75,236,1,75,237,1,75,240,
+1,75,243,1,75,246,1,75,249,1,75,252,1,75,255,1,76,2,1,76,4,1,76,7,1,76,9,
+1,76,12,1,76,15,1,76,144,1,76,149,1,76,154,1,76,159,1,76,164,1,77,49,247,
+195,239,22,28,4,176,28,7,8,28,251,80,6,189,89,21,250,224,28,249,92,254,224,
+6,14,252,133,14,252,41,248,244,229,10,252,55,249,150,28,5,104,21,189,102,
+167,90,47,110,80,57,133,30,114,252,93,5,205,6,159,195,247,44,248,57,182,26,
+251,222,22,189,102,167,92,47,111,80,57,134,30,113,252,93,5,204,6,160,195,
+247,41,248,57,182,26,14,248,61,28,5,145,249,242,21,244,251,178,7,247,47,248,
+86,33,172,251,54,252,119,5,251,191,6,247,48,248,86,34,172,251,56,252,119,
+5,252,0,34,247,222,6,38,251,185,5,251,215,37,247,182,6,251,55,252,115,241,
+104,247,66,248,150,5,247,189,6,251,54,252,117,242,106,247,66,248,150,5,248,
+0,241,251,221,6,237,247,185,5,251,7,22,41,251,185,5,251,189,6,237,247,185,
+5,14,181,250,191,28,5,35,21,106,149,251,25,184,251,25,143,164,247,40,24,251,
+9,6,110,251,46,5,251,125,117,251,101,251,40,251,125,26,251,52,247,19,34,247,
+64,66,30,38,252,159,55,146,58,182,128,143,25,133,141,131,145,149,26,157,247,
+128,5,251,29,6,74,251,214,247,0,86,238,110,247,37,131,25,100,251,101,248,
+162,29,178,247,103,5,247,29,149,247,230,236,247,209,26,247,66,251,38,247,
+1,251,74,198,30,235,248,144,205,133,190,114,145,135,25,148,135,153,121,130,
+26,129,251,92,5,247,12,6,252,10,247,150,21,53,252,81,5,55,182,92,201,231,
+26,247,13,225,227,247,23,178,30,247,27,254,21,21,251,19,55,45,251,44,102,
+30,229,248,98,5,240,92,184,70,51,26,14,249,44,28,6,145,248,179,21,247,49,
+72,247,19,251,66,251,175,251,25,251,225,251,132,251,50,207,251,21,247,66,
+247,174,247,25,247,228,247,132,30,251,27,249,211,21,251,19,6,28,251,133,28,
+250,162,248,136,10,248,32,250,246,21,247,50,71,247,19,251,66,251,175,251,
+27,251,226,251,131,251,50,209,251,21,247,66,247,175,247,25,247,228,247,131,
+30,249,115,252,176,21,251,28,71,252,39,251,74,45,122,243,213,247,29,207,248,
+28,247,76,232,155,42,68,30,254,11,248,215,21,251,27,74,252,37,251,75,45,121,
+241,213,247,29,206,248,27,247,79,231,153,43,67,30,14,247,237,28,5,98,249,
+27,21,233,252,72,45,7,244,121,5,141,159,116,133,137,31,106,69,84,41,69,61,
+251,180,248,17,24,247,135,221,247,64,247,9,247,88,26,247,28,49,247,27,251,
+115,251,152,251,89,251,54,251,113,41,188,57,201,53,30,251,87,40,251,49,251,
+25,251,95,26,251,105,247,53,251,19,247,97,247,83,247,29,209,229,247,13,30,
+212,49,195,104,206,127,176,131,180,139,182,141,178,141,184,143,205,141,8,
+229,7,251,50,141,61,182,45,247,19,243,247,3,232,247,27,196,247,13,8,252,31,
+248,117,21,251,48,251,3,51,251,52,76,30,82,208,82,240,237,26,247,46,247,25,
+212,237,239,193,47,43,30,75,254,17,21,61,33,65,104,43,27,251,26,251,12,246,
+247,56,247,17,212,233,247,9,215,31,14,252,213,247,17,29,251,131,250,80,28,
+5,190,21,252,186,90,251,153,253,27,252,125,26,251,226,247,89,251,119,247,
+168,122,30,158,233,5,251,54,174,251,21,246,247,195,26,247,203,247,31,249,
+138,248,89,200,30,14,251,133,249,91,250,33,21,247,1,106,248,39,252,74,188,
+30,120,45,5,247,146,98,174,251,162,251,15,26,251,154,251,7,253,193,252,111,
+75,30,121,41,5,248,92,194,247,245,248,107,249,58,26,14,66,250,168,28,4,143,
+21,251,37,182,251,111,251,37,147,110,247,156,154,5,251,117,247,182,21,53,
+247,17,55,251,17,211,251,148,5,165,6,247,128,252,31,21,135,247,44,251,99,
+247,58,112,120,234,251,138,5,251,36,247,214,21,251,113,247,37,251,35,96,231,
+251,8,247,158,124,5,172,92,21,112,158,251,99,251,58,135,251,44,247,36,192,
+5,14,250,75,28,6,102,248,187,21,247,19,252,187,248,187,251,18,252,187,252,
+187,251,19,248,187,252,187,247,18,248,187,7,14,252,160,247,218,235,21,227,
+102,205,43,55,65,51,57,116,145,115,153,120,30,247,21,6,109,251,60,55,55,248,
+76,29,247,123,26,14,252,80,230,10,252,160,247,163,10,46,250,128,247,167,29,
+251,24,6,253,252,28,249,228,5,247,23,6,14,181,250,252,250,70,21,247,152,251,
+14,247,93,251,163,252,78,251,115,252,185,252,68,251,183,247,35,251,60,247,
+146,248,39,247,150,248,136,248,115,30,251,113,174,21,252,21,251,70,252,158,
+251,134,64,251,11,178,247,172,248,19,247,60,248,163,247,146,245,225,40,251,
+115,30,14,181,249,246,28,5,127,21,64,6,252,122,251,29,5,47,7,247,214,180,
+251,101,254,196,135,119,126,121,117,136,25,251,99,129,5,43,249,23,235,7,251,
+45,149,106,142,128,155,144,161,25,14,181,250,220,250,226,21,247,111,251,58,
+225,251,105,251,167,251,123,251,64,251,44,66,207,122,184,202,176,166,149,
+153,30,182,247,109,5,154,170,205,171,212,27,247,9,231,78,251,48,251,191,251,
+177,251,115,252,227,252,58,31,112,251,25,5,250,107,6,203,247,236,5,251,15,
+6,69,251,66,5,252,209,6,247,78,247,23,247,80,247,15,247,62,247,43,8,247,68,
+247,48,247,30,247,76,247,79,26,14,181,250,220,250,240,21,247,81,251,27,241,
+251,128,251,138,251,146,251,17,251,56,72,195,106,190,176,196,159,145,157,
+30,170,247,87,5,160,166,206,182,227,27,219,247,19,85,251,51,251,81,251,64,
+251,33,251,154,151,31,121,251,19,5,147,186,184,145,190,27,213,247,47,111,
+251,85,251,97,251,60,251,53,251,90,63,80,173,152,120,31,108,247,66,5,149,
+115,108,147,104,27,43,108,59,101,48,240,251,27,247,170,247,242,247,159,247,
+134,247,152,247,54,251,7,215,251,70,165,31,247,152,219,247,9,247,50,247,37,
+26,14,181,250,193,248,191,21,251,78,247,246,10,248,255,6,46,252,105,5,247,
+85,6,229,248,105,5,247,82,6,251,135,249,64,21,251,1,252,179,5,252,54,6,14,
+181,250,234,247,167,29,253,130,6,251,29,253,54,5,146,195,247,0,151,196,27,
+247,62,247,62,84,251,97,251,95,251,60,251,76,251,98,89,98,153,153,96,31,84,
+247,66,5,144,123,114,143,117,27,49,91,79,74,251,9,247,17,65,247,109,247,245,
+247,178,247,142,247,187,247,140,251,92,221,251,79,49,68,122,125,89,31,219,
+248,33,5,248,232,6,14,181,250,187,248,191,21,247,123,251,48,247,32,251,111,
+251,15,251,0,100,73,40,30,215,247,165,247,142,247,115,247,246,178,137,247,
+4,24,252,228,76,252,10,252,101,252,136,26,252,15,247,133,45,247,85,247,203,
+247,140,247,163,247,209,30,251,109,86,21,251,122,251,52,251,94,251,64,251,
+80,100,247,101,247,31,237,174,247,38,145,165,30,221,247,0,221,164,221,27,
+247,62,215,251,7,251,70,31,14,181,28,4,213,247,167,29,254,99,6,70,251,242,
+5,247,23,6,204,247,76,5,248,232,6,254,35,28,250,252,5,247,94,6,152,186,250,
+56,28,5,35,5,14,181,250,209,250,242,21,247,54,251,19,247,19,251,139,251,202,
+251,82,251,95,251,117,57,166,41,247,31,65,30,251,154,251,7,55,251,66,251,
+25,26,251,93,247,47,251,27,247,173,247,211,247,140,247,101,247,144,247,60,
+251,41,227,32,186,30,247,58,215,247,33,233,247,109,26,251,86,121,21,251,42,
+53,251,0,251,19,71,30,251,52,207,37,208,247,5,26,247,48,247,15,247,21,247,
+45,247,15,215,55,251,17,30,63,253,107,21,251,40,251,29,251,39,251,66,251,
+62,41,247,11,247,35,247,41,239,247,1,247,25,211,30,247,66,59,247,64,49,251,
+19,26,14,181,28,4,117,250,103,21,248,17,251,169,186,251,33,251,226,251,148,
+251,150,251,212,251,156,247,95,41,247,62,247,2,247,7,182,184,229,30,251,92,
+251,220,251,128,251,23,251,183,251,4,182,42,24,248,93,247,36,248,183,247,
+236,248,240,26,251,109,137,21,53,114,47,125,55,30,118,120,251,13,35,251,39,
+27,33,251,28,217,247,94,247,124,247,44,247,99,247,72,237,247,30,75,251,160,
+31,14,252,160,248,97,249,254,247,40,29,252,160,248,97,249,254,247,84,29,251,
+27,253,156,21,225,100,205,45,57,63,53,59,116,145,111,153,120,30,247,21,6,
+109,251,62,55,57,248,76,29,247,125,26,14,250,75,28,6,102,219,21,247,19,7,
+254,221,248,43,250,221,248,44,5,247,19,7,28,251,52,252,107,5,251,19,7,14,
+250,75,28,6,102,249,117,247,135,29,28,4,204,252,8,247,135,29,14,250,75,28,
+6,102,248,187,21,247,19,7,28,251,52,248,107,5,251,19,7,250,221,252,44,254,
+221,252,43,5,251,19,7,14,37,250,72,250,236,21,247,74,251,25,247,5,251,134,
+251,164,53,251,33,59,86,182,108,209,30,198,6,247,17,247,95,5,247,23,221,65,
+251,31,251,122,251,78,251,43,251,79,79,31,84,251,197,5,247,29,6,186,247,136,
+5,247,116,231,247,135,247,48,247,166,26,252,119,254,146,21,203,92,198,55,
+53,88,78,75,76,190,81,225,223,186,199,202,30,14,249,200,28,6,254,249,144,
+21,248,58,251,187,247,121,252,41,252,93,252,99,251,211,252,243,252,133,248,
+11,251,197,248,74,247,130,247,90,221,237,247,77,30,110,213,5,69,251,17,251,
+70,57,251,132,27,252,88,251,157,247,212,248,53,248,93,247,224,247,234,248,
+103,247,181,247,179,251,70,252,21,251,218,251,87,251,97,251,13,61,121,205,
+233,159,31,139,247,24,248,212,149,171,30,251,9,6,102,92,5,172,80,57,162,79,
+27,251,150,251,141,251,136,251,205,251,97,245,251,21,247,42,235,231,200,246,
+245,31,251,5,187,82,247,4,247,97,247,189,247,125,248,52,30,252,209,180,21,
+57,252,60,5,86,96,65,59,47,27,36,82,213,247,39,247,142,247,19,247,95,247,
+95,212,195,57,104,131,31,14,247,173,34,10,14,247,38,60,29,14,247,85,56,10,
+14,247,169,46,10,14,185,32,10,14,95,120,10,14,247,204,44,10,14,248,24,40,
+10,14,252,90,41,10,14,251,31,180,10,247,138,47,10,14,103,47,29,14,249,48,
+63,10,14,247,251,38,10,14,247,249,36,10,14,201,73,29,14,247,249,110,29,247,
+108,37,29,14,109,40,29,14,242,50,10,14,247,243,33,10,14,247,112,76,29,14,
+249,181,54,29,14,247,91,61,10,14,247,104,41,29,14,195,67,10,14,251,127,250,
+89,28,5,74,21,235,252,146,7,251,236,28,249,72,5,248,164,235,251,205,6,247,
+197,28,5,248,5,14,43,250,125,251,82,21,253,250,28,6,28,5,251,23,6,249,250,
+28,249,228,5,14,251,127,249,150,28,5,170,21,252,164,45,247,205,6,251,195,
+28,250,8,5,251,228,41,248,146,6,14,252,31,249,199,250,252,44,29,252,111,248,
+124,251,72,21,252,255,248,84,10,249,2,6,14,252,213,247,16,10,109,32,29,14,
+50,70,10,14,251,98,59,29,14,119,45,10,14,251,100,34,29,14,252,74,75,29,14,
+251,88,38,29,14,115,43,29,14,252,188,248,166,28,5,33,55,29,14,252,174,248,
+181,28,5,33,70,29,84,52,10,14,252,190,58,29,14,248,128,59,10,14,127,39,10,
+14,78,42,29,14,54,64,10,14,111,126,10,251,223,55,10,14,251,231,45,29,14,252,
+119,52,29,14,121,33,29,14,251,43,71,29,14,247,233,48,29,14,123,62,10,14,60,
+36,29,14,251,78,50,29,14,37,250,171,28,5,160,21,251,58,251,11,122,82,55,31,
+251,115,251,41,231,252,5,251,44,251,38,8,80,80,53,137,251,5,27,121,45,5,219,
+227,145,94,188,31,247,33,251,17,251,152,252,19,247,46,251,60,8,65,208,247,
+21,129,247,42,27,155,225,5,74,67,143,176,96,31,251,29,247,9,247,152,248,6,
+251,62,247,52,106,170,94,161,78,160,243,166,205,178,184,182,247,47,247,47,
+66,247,181,247,33,247,25,8,182,184,209,168,247,2,27,14,252,9,248,60,252,164,
+21,248,126,29,37,250,21,249,21,21,59,51,133,184,90,31,251,33,247,17,247,152,
+248,19,251,46,247,60,8,213,69,251,21,149,251,39,27,121,53,5,204,211,135,102,
+184,31,247,27,251,7,251,152,252,9,247,64,251,51,170,108,184,116,200,121,35,
+110,73,102,94,94,251,48,251,45,213,251,183,251,31,251,25,8,96,92,69,110,251,
+2,27,124,53,5,247,58,247,11,155,197,225,31,247,113,247,41,47,248,5,247,44,
+247,37,8,199,198,225,141,247,5,27,14,248,245,28,6,8,249,7,21,247,25,7,251,
+11,251,56,251,12,100,40,251,70,251,95,247,29,251,90,27,251,3,251,25,98,35,
+251,37,31,251,25,7,239,247,29,247,25,199,243,247,103,247,79,251,30,247,86,
+27,247,9,247,2,174,247,1,247,50,31,14,252,41,248,184,250,21,21,215,68,178,
+79,60,83,86,69,73,201,86,212,215,194,194,211,30,39,251,142,21,251,23,6,139,
+251,136,254,27,92,26,78,170,98,217,223,200,184,247,6,154,30,14,181,250,187,
+250,80,21,51,174,71,158,251,25,141,178,247,92,24,251,17,6,98,251,96,5,251,
+238,89,251,80,251,207,251,183,26,251,60,247,2,251,58,247,122,103,30,98,251,
+99,5,247,19,6,178,247,92,5,247,29,231,154,186,221,31,182,247,193,5,251,15,
+6,135,106,116,251,82,66,122,132,137,92,125,80,133,247,52,249,217,24,198,133,
+176,117,147,135,197,122,122,251,72,135,106,8,247,15,6,252,29,247,136,21,251,
+44,253,185,5,41,180,81,233,247,46,26,247,131,247,22,247,99,247,70,209,30,
+14,181,28,4,166,28,4,233,21,247,9,251,68,172,38,252,119,61,252,181,251,31,
+127,30,251,52,34,247,38,6,118,37,127,33,86,36,94,49,65,69,251,21,115,8,251,
+15,250,115,247,58,252,236,7,106,90,135,133,82,31,247,74,247,17,205,247,37,
+173,247,84,8,248,34,244,252,9,6,174,247,97,184,247,246,247,164,153,227,251,
+78,24,197,147,247,33,174,243,26,14,46,250,138,247,167,29,251,23,6,253,253,
+28,249,228,5,247,23,6,14,181,28,5,29,28,4,248,21,227,252,46,51,7,229,118,
+172,133,129,121,128,124,25,252,14,252,127,251,52,248,138,133,157,147,155,
+157,142,25,247,11,149,5,229,252,111,53,7,247,3,114,247,14,252,21,5,251,135,
+47,247,174,6,205,251,91,5,252,44,45,248,28,6,75,251,234,135,108,98,131,108,
+135,25,104,135,94,141,100,137,8,49,248,191,229,7,251,29,149,109,143,141,160,
+141,151,25,202,247,234,5,248,60,233,252,43,6,247,41,247,91,5,247,209,231,
+251,127,6,247,183,248,17,5,14,252,74,75,29,14,66,250,144,28,5,139,21,174,
+61,251,7,155,53,27,251,129,251,128,35,251,136,45,201,74,233,81,31,251,70,
+63,251,19,251,14,251,75,26,41,184,73,202,86,30,242,55,247,158,59,251,31,26,
+251,17,251,37,74,50,90,78,153,176,84,30,145,247,74,5,251,23,6,92,251,158,
+5,94,229,241,116,247,1,27,247,123,247,121,247,29,247,120,235,72,207,41,194,
+31,247,57,209,247,44,247,37,247,60,26,233,94,207,75,192,30,251,37,247,11,
+251,113,178,247,27,26,247,15,247,33,200,221,192,197,123,102,196,30,131,251,
+60,5,247,15,6,251,120,252,162,21,251,5,51,39,251,10,71,30,251,73,233,98,195,
+237,26,223,195,247,17,247,45,196,30,247,60,63,190,70,51,26,14,247,44,28,4,
+164,248,37,21,251,103,247,103,5,200,213,168,233,236,26,235,104,241,82,211,
+30,247,105,247,105,65,213,251,109,251,109,5,198,69,45,172,45,27,43,40,108,
+80,66,31,251,107,247,107,65,65,247,107,251,107,5,73,67,111,35,44,26,43,169,
+47,199,65,30,251,103,251,103,213,66,247,103,247,103,5,73,214,234,108,241,
+27,233,235,172,203,213,31,247,103,251,103,5,251,56,248,185,21,251,64,251,
+29,251,38,251,66,251,68,251,36,247,31,247,68,247,71,247,34,247,31,247,70,
+247,64,247,31,251,37,251,62,30,14,253,129,248,87,28,5,104,21,189,102,167,
+87,45,109,80,57,132,30,113,252,93,5,206,6,160,195,247,50,248,57,182,26,14,
+251,53,250,119,28,5,166,21,251,15,6,51,71,251,78,251,66,251,66,26,251,11,
+223,109,205,231,206,223,206,166,127,159,133,152,30,251,19,6,247,29,247,35,
+247,21,229,227,30,252,49,22,247,45,29,251,156,247,146,247,186,10,248,200,
+252,77,21,231,6,251,27,248,129,247,227,248,130,5,47,6,252,30,252,79,118,36,
+5,14,253,17,247,132,247,186,10,14,253,17,247,112,250,111,247,174,29,244,28,
+4,166,28,5,33,21,196,94,196,61,248,83,29,219,184,194,199,30,147,248,101,10,
+84,104,188,195,149,31,247,48,249,199,5,55,6,251,144,63,5,251,211,6,155,243,
+200,247,55,29,248,197,10,69,50,251,101,247,201,10,247,97,247,80,247,132,10,
+248,85,6,251,15,253,38,5,45,120,160,32,247,29,27,247,7,247,45,209,153,172,
+31,14,244,28,4,176,192,21,217,7,133,119,32,104,100,27,80,96,192,199,149,31,
+247,142,28,5,26,5,59,6,251,142,90,5,166,111,91,161,68,27,251,173,251,15,251,
+230,251,109,98,31,247,193,10,90,251,62,69,50,251,101,247,201,10,247,97,247,
+82,247,132,10,248,76,6,251,14,253,17,5,134,112,135,114,119,26,51,189,77,247,
+14,238,247,49,205,151,170,30,251,117,28,5,35,21,57,252,68,5,252,78,6,155,
+243,200,247,181,225,211,247,52,251,21,24,211,149,192,172,143,198,8,14,66,
+250,166,248,191,21,254,176,248,85,29,250,179,6,14,66,249,152,28,5,31,21,65,
+247,78,251,37,251,78,166,251,181,5,198,6,248,111,102,21,251,33,239,251,220,
+51,133,105,247,187,63,5,252,7,247,4,21,251,191,225,251,68,39,247,27,41,247,
+224,215,5,229,251,255,21,119,247,234,5,77,6,251,39,251,234,55,253,244,5,198,
+6,14,66,249,150,28,5,31,21,65,247,74,251,35,251,72,161,251,183,5,201,6,248,
+113,102,21,251,35,239,251,220,51,135,105,247,185,63,5,252,9,247,4,21,251,
+187,225,251,70,39,247,27,41,247,226,215,5,237,251,255,21,109,247,234,5,79,
+6,251,66,251,232,178,251,236,5,198,6,248,116,98,21,251,38,241,251,219,51,
+132,103,247,191,63,5,252,8,247,4,21,251,195,227,251,66,39,247,29,39,247,228,
+217,5,225,251,202,21,118,247,183,5,80,6,251,29,251,181,208,251,78,5,14,253,
+92,207,10,37,250,113,28,5,20,21,213,252,39,7,251,197,251,69,39,251,193,251,
+210,247,99,59,247,187,31,249,95,247,50,28,250,84,237,28,5,162,7,14,252,119,
+248,179,249,76,21,247,23,34,244,251,23,251,23,35,34,251,23,251,23,243,35,
+247,23,247,23,244,243,247,23,30,14,252,213,247,232,221,21,200,96,213,35,48,
+70,80,57,108,151,121,145,128,248,67,10,40,39,251,0,34,8,247,12,6,230,207,
+247,78,247,62,247,72,26,14,251,53,249,136,215,21,208,106,211,251,9,41,77,
+74,61,114,150,119,145,126,30,247,19,6,125,139,127,137,131,30,116,251,5,45,
+39,251,7,32,8,247,11,6,229,207,247,83,247,64,247,66,26,252,50,141,21,202,
+114,215,251,12,46,68,74,67,102,151,121,147,130,248,67,10,38,37,251,0,34,8,
+247,15,6,229,207,247,78,247,70,247,62,26,14,251,53,154,29,251,156,248,214,
+250,111,21,47,6,247,27,252,129,251,227,252,130,5,231,6,248,30,248,79,160,
+242,5,252,200,248,77,247,174,29,250,75,28,6,227,247,5,21,212,76,203,63,63,
+80,77,64,63,200,77,215,217,198,201,215,248,68,29,198,77,217,215,200,199,217,
+248,68,29,200,77,215,215,200,201,215,30,14,28,4,203,28,8,197,248,179,21,247,
+49,71,247,19,251,66,251,175,251,27,251,225,251,132,251,50,209,251,21,247,
+66,247,174,247,26,247,228,247,132,30,253,101,22,247,49,69,247,19,251,66,251,
+173,251,27,251,225,251,132,248,73,10,247,132,30,83,249,211,21,251,19,6,28,
+251,134,28,250,162,248,136,10,248,111,250,246,21,247,50,69,247,19,251,66,
+251,173,251,27,251,226,251,131,248,73,10,247,131,30,28,5,14,252,176,21,251,
+28,74,252,39,251,75,45,123,243,213,247,29,204,248,28,247,79,231,153,42,68,
+30,253,101,22,251,28,74,252,39,251,77,45,123,243,213,247,29,206,248,28,247,
+79,229,155,42,68,30,253,105,248,215,21,251,27,74,252,37,251,77,45,123,241,
+213,247,29,206,248,27,247,79,229,155,43,67,30,14,37,249,158,250,15,21,203,
+88,196,55,53,94,80,75,76,184,77,225,223,190,203,202,30,121,254,222,21,193,
+96,169,69,30,80,6,251,15,251,94,5,251,25,57,212,247,32,247,121,247,78,247,
+44,247,78,198,31,197,247,197,5,251,31,6,91,251,136,5,251,115,47,251,136,251,
+47,251,169,26,251,72,247,26,251,5,247,133,247,165,225,247,34,218,30,14,251,
+184,249,33,250,252,42,10,252,135,249,154,28,5,131,35,29,252,31,249,199,250,
+252,44,29,251,250,250,42,28,5,135,35,10,252,108,249,166,28,5,55,68,29,252,
+92,249,201,28,5,143,57,29,253,246,248,27,28,5,33,46,29,252,84,249,185,28,
+5,33,39,29,252,254,248,3,250,252,74,10,252,246,247,228,251,121,51,10,251,
+133,250,156,28,5,131,61,29,253,100,247,27,247,31,29,252,31,250,15,28,5,195,
+48,10,250,75,28,8,16,248,191,21,28,247,230,248,85,29,28,8,27,6,14,249,200,
+67,29,14,252,41,249,187,249,197,21,182,7,137,125,83,123,121,27,102,248,153,
+29,144,151,153,178,147,157,8,49,6,119,111,5,159,114,94,248,28,10,247,47,219,
+209,186,176,180,31,84,143,161,110,205,27,190,239,178,147,162,31,47,251,9,
+21,252,249,6,123,66,5,248,250,6,49,249,19,21,70,251,230,5,120,118,76,80,75,
+27,55,121,217,208,247,28,204,247,90,247,97,156,173,82,131,137,31,14,103,181,
+10,247,3,248,216,247,195,247,60,83,237,251,113,251,15,219,248,48,87,29,35,
+252,179,251,156,251,39,188,38,247,78,246,59,252,54,230,29,247,249,92,29,14,
+250,85,28,8,55,247,167,29,253,187,6,105,251,82,5,247,23,65,251,13,231,251,
+101,27,252,91,251,197,252,82,252,58,251,253,247,140,251,103,247,201,247,40,
+247,23,195,247,6,247,19,31,110,251,29,5,250,3,6,204,248,120,29,131,124,122,
+113,27,252,120,6,247,3,248,196,5,247,164,248,107,10,247,7,6,231,248,105,5,
+251,9,6,100,251,29,5,110,131,127,129,110,27,251,169,6,238,248,140,5,248,25,
+6,170,149,129,110,31,251,58,247,23,7,253,242,251,105,21,251,254,251,109,252,
+54,251,187,251,70,251,54,247,39,247,187,248,7,247,113,248,54,247,181,247,
+62,247,64,251,23,251,212,30,14,252,59,249,119,28,4,129,222,29,74,252,97,21,
+252,224,6,125,74,5,248,223,6,84,248,166,247,123,29,248,65,66,10,14,252,188,
+51,29,14,252,170,249,52,250,39,21,92,230,251,83,42,247,7,248,236,248,87,10,
+251,1,252,203,251,154,251,25,184,49,247,85,237,46,252,115,5,135,112,135,114,
+119,26,51,191,77,247,14,238,247,47,205,151,170,30,217,7,133,119,32,104,100,
+27,84,92,196,195,149,31,247,3,248,215,5,14,78,103,29,14,248,69,28,5,213,249,
+164,21,225,92,247,34,251,64,251,27,251,68,51,251,32,79,30,247,17,96,35,242,
+251,42,27,251,234,251,90,251,234,251,197,251,134,247,39,251,40,247,109,247,
+33,247,11,191,247,41,231,31,251,31,201,235,77,247,9,27,247,70,247,15,230,
+241,247,2,31,247,21,7,32,251,6,251,13,47,32,27,251,6,57,240,247,51,162,141,
+182,143,166,31,247,39,149,248,46,198,247,156,26,251,72,22,251,60,251,115,
+62,251,36,128,30,247,73,184,238,247,98,247,27,27,219,147,43,104,31,252,195,
+251,76,21,251,125,32,251,191,251,88,251,3,75,247,21,247,68,247,152,247,15,
+247,183,247,71,247,8,199,251,56,251,52,30,14,181,250,209,28,4,215,21,247,
+70,251,16,231,251,85,251,244,251,60,251,174,251,187,94,30,251,11,253,183,
+125,45,89,251,169,56,57,25,251,103,195,5,104,112,120,108,107,26,73,180,94,
+225,247,64,247,81,247,144,247,25,188,30,247,21,247,246,110,248,15,236,247,
+253,8,247,113,198,245,247,70,247,77,27,229,206,86,251,5,55,119,51,114,53,
+31,251,72,123,251,43,251,9,251,62,26,32,220,70,223,73,30,234,68,214,83,57,
+26,251,4,55,79,53,92,98,156,192,96,30,176,241,5,164,102,115,153,94,27,57,
+98,92,82,251,31,247,43,87,247,32,247,103,247,70,247,13,247,95,239,51,215,
+49,209,31,49,210,48,203,215,26,247,8,247,38,162,206,166,166,137,135,188,30,
+172,247,4,175,247,11,247,11,26,14,251,250,249,48,28,6,86,21,96,6,251,198,
+59,5,74,7,247,89,161,251,15,252,240,135,116,127,127,110,137,25,251,4,135,
+5,69,248,35,207,7,51,145,114,141,131,151,143,162,25,14,247,65,28,4,164,248,
+23,21,248,109,254,230,251,15,250,107,251,242,7,14,162,250,193,247,113,21,
+98,6,92,121,108,57,75,27,58,179,247,33,187,150,31,247,31,249,86,5,251,82,
+6,251,40,253,121,5,75,71,56,61,40,27,65,101,193,206,201,151,198,151,196,31,
+247,7,248,220,5,251,83,6,251,45,253,160,118,251,1,113,33,102,34,25,110,66,
+76,34,61,26,96,161,96,186,247,11,147,247,42,225,237,145,229,158,236,30,71,
+165,211,116,205,27,247,27,247,11,247,5,225,231,31,37,133,163,42,247,13,27,
+247,35,219,247,13,247,17,172,31,14,247,159,28,5,154,249,197,21,184,7,73,149,
+5,248,60,7,205,152,5,186,251,103,112,7,251,28,251,252,251,27,247,252,5,166,
+251,105,92,7,203,126,5,252,60,7,75,129,5,94,247,79,184,7,77,149,5,248,64,
+7,247,66,252,119,5,188,6,247,77,248,119,5,252,64,7,77,129,5,94,7,252,164,
+248,31,21,247,36,252,107,251,36,196,7,152,225,5,146,143,143,143,30,247,0,
+252,73,6,139,86,131,114,137,30,94,247,144,184,7,115,141,88,147,139,26,248,
+73,245,7,143,143,135,132,31,154,53,5,14,247,169,75,10,249,83,28,6,133,249,
+37,21,247,32,251,9,188,251,19,251,55,251,50,41,38,88,188,133,160,184,165,
+161,139,30,166,247,19,5,145,151,184,160,194,27,223,195,102,53,251,134,252,
+25,251,88,251,69,251,7,31,119,248,53,29,251,253,6,247,60,247,0,248,7,247,
+97,247,121,26,251,21,249,153,247,72,29,247,113,83,29,14,250,75,28,6,102,249,
+113,21,247,19,252,187,248,5,251,18,252,5,252,187,251,19,248,187,252,4,247,
+18,248,4,7,248,187,253,113,247,135,29,14,201,250,240,249,168,21,247,85,251,
+23,247,27,251,226,30,251,13,6,162,247,13,247,140,10,251,107,254,226,138,29,
+161,247,15,5,139,230,137,180,247,248,247,158,247,95,247,221,30,251,105,107,
+21,251,52,61,35,39,77,30,41,82,251,17,120,251,11,150,247,19,249,33,24,141,
+157,172,248,155,29,31,14,249,83,28,6,82,247,224,21,251,40,6,246,248,144,5,
+45,6,252,193,252,148,120,49,5,248,58,6,82,251,173,5,247,11,6,198,247,173,
+5,247,39,6,82,28,4,168,247,72,29,247,113,83,29,250,123,104,21,70,251,234,
+5,251,189,6,14,250,75,28,4,123,250,68,21,207,84,194,71,71,84,84,71,69,194,
+86,207,207,194,192,209,30,248,127,252,29,247,135,29,249,117,251,158,21,208,
+84,193,71,71,84,85,70,71,194,86,207,207,194,192,207,30,14,252,26,248,42,249,
+68,21,249,199,34,253,199,7,244,254,218,21,249,200,34,253,200,7,14,252,78,
+248,189,28,4,225,21,247,17,39,240,251,17,251,17,38,38,251,17,251,17,240,39,
+247,17,247,17,239,239,247,17,30,57,22,59,76,76,59,59,75,202,219,219,203,203,
+219,219,202,75,59,30,14,54,250,70,249,13,21,247,19,29,30,248,17,10,251,222,
+28,249,107,171,10,14,249,83,28,6,147,247,224,247,78,29,110,28,4,168,247,72,
+29,247,232,74,29,249,85,252,228,21,67,251,234,5,251,189,6,14,251,250,249,
+195,28,5,156,21,247,31,251,7,186,251,17,251,53,251,48,41,40,88,192,133,156,
+182,167,162,139,30,166,247,19,5,145,151,182,159,195,27,223,190,100,55,251,
+64,251,70,251,17,252,15,251,142,31,120,49,5,249,1,6,182,247,107,5,63,6,96,
+37,5,251,248,6,247,60,247,3,247,254,247,92,247,120,26,14,248,253,190,29,251,
+82,252,62,21,194,7,251,252,247,152,247,201,211,251,216,31,247,17,166,247,
+7,196,247,31,26,247,68,251,28,201,251,115,247,79,10,116,141,131,154,151,26,
+247,197,7,143,172,141,170,247,252,251,133,252,45,248,0,27,182,203,147,141,
+151,31,251,236,249,33,21,251,35,51,92,251,54,30,117,89,141,248,37,29,250,
+75,28,6,102,248,187,247,135,29,14,78,250,117,28,5,66,21,100,225,251,133,42,
+251,15,247,66,251,158,100,130,78,247,50,98,211,39,251,161,36,176,47,247,177,
+247,9,157,100,185,43,167,65,25,157,108,107,152,104,27,247,155,10,247,109,
+41,247,156,43,247,62,31,133,253,37,247,203,10,187,171,124,121,162,30,163,
+55,156,57,251,21,26,14,250,75,28,6,41,247,33,21,252,107,248,109,248,107,248,
+109,59,219,252,109,252,111,252,109,248,111,59,59,248,107,252,109,252,107,
+252,109,219,59,248,109,248,112,248,109,252,112,5,14,251,250,249,199,28,5,
+166,21,247,11,45,196,251,31,251,38,251,62,69,33,92,182,120,162,165,183,158,
+139,30,157,247,6,5,148,149,184,167,203,27,198,213,107,51,34,36,57,251,64,
+149,31,127,53,5,139,180,146,186,199,229,120,35,251,7,38,47,251,27,90,100,
+159,145,127,30,118,244,5,139,115,149,110,74,124,88,114,78,213,61,247,58,247,
+105,247,70,247,27,247,54,237,63,186,53,154,30,247,29,182,215,225,229,26,14,
+248,253,28,6,150,249,99,21,248,64,251,239,247,254,252,76,252,72,251,244,251,
+248,252,72,252,70,247,246,251,249,248,68,248,72,247,245,247,249,248,72,30,
+50,137,21,252,23,251,207,251,210,252,21,252,21,251,205,247,210,248,23,248,
+25,247,205,247,209,248,23,248,23,247,203,251,211,252,23,30,252,12,252,70,
+21,247,150,48,7,111,251,66,5,122,104,71,117,72,27,251,52,251,48,247,35,247,
+142,247,134,247,54,247,31,247,66,197,196,116,119,170,31,169,251,48,5,232,
+247,136,6,166,48,47,163,33,27,251,197,251,91,251,91,251,174,251,150,247,72,
+251,118,247,214,247,43,247,25,187,141,146,31,14,247,173,34,10,248,47,249,
+36,35,29,247,173,34,10,248,64,248,9,44,29,247,173,34,10,248,75,248,194,39,
+29,247,173,34,10,247,173,248,9,42,10,247,173,34,10,223,248,9,74,10,247,173,
+34,10,248,144,249,40,35,10,247,85,56,10,252,83,28,251,45,51,10,185,32,10,
+85,249,124,35,29,185,32,10,102,248,97,44,29,185,32,10,113,249,26,39,29,185,
+32,10,251,76,248,97,42,10,252,90,41,10,247,120,248,169,35,29,252,90,41,10,
+247,137,247,142,44,29,252,90,41,10,247,148,248,71,39,29,252,90,41,10,237,
+247,142,42,10,247,251,38,10,251,1,248,173,35,10,247,249,36,10,188,250,81,
+35,29,247,249,36,10,205,249,54,44,29,247,249,36,10,216,249,239,39,29,247,
+249,36,10,58,249,54,42,10,247,249,36,10,247,38,250,85,35,10,109,40,29,247,
+62,249,235,48,10,247,243,33,10,251,69,248,169,35,29,247,243,33,10,251,52,
+247,142,44,29,247,243,33,10,251,41,248,71,39,29,247,243,33,10,251,199,247,
+142,42,10,247,104,41,29,251,67,248,167,35,29,247,104,41,29,251,39,248,69,
+39,29,195,67,10,121,248,229,48,10,109,32,29,247,175,248,244,35,29,109,32,
+29,247,192,247,217,44,29,109,32,29,247,203,248,146,39,29,109,32,29,247,45,
+247,217,42,10,109,32,29,95,247,217,74,10,109,32,29,248,16,248,248,35,10,251,
+98,59,29,251,109,254,221,51,10,251,100,34,29,247,158,248,240,35,29,251,100,
+34,29,247,175,247,213,44,29,251,100,34,29,247,186,248,142,39,29,251,100,34,
+29,247,28,247,213,42,10,252,188,51,29,247,71,28,5,72,35,29,252,188,51,29,
+247,88,250,193,44,29,252,188,51,29,247,99,28,4,230,39,29,252,188,51,29,188,
+250,193,42,10,127,39,10,145,28,5,94,35,10,78,42,29,247,107,249,168,35,29,
+78,42,29,247,124,248,141,44,29,78,42,29,247,135,249,70,39,29,78,42,29,224,
+248,141,42,10,78,42,29,247,204,249,172,35,10,251,231,45,29,247,116,248,228,
+48,10,121,33,29,60,28,5,82,35,29,121,33,29,77,250,203,44,29,121,33,29,88,
+28,4,240,39,29,121,33,29,251,101,250,203,42,10,60,36,29,120,248,201,35,29,
+60,36,29,148,248,103,39,29,251,78,50,29,249,141,28,5,50,48,10,247,50,250,
+117,247,209,10,253,62,22,248,2,29,14,252,160,247,163,10,247,114,28,6,27,28,
+5,102,21,187,89,218,251,31,251,170,251,25,251,238,251,119,102,30,252,111,
+6,155,243,200,247,55,29,198,10,94,251,62,69,50,251,101,247,201,10,247,97,
+247,78,247,103,29,96,251,62,67,50,251,98,193,24,106,116,116,115,87,26,119,
+164,57,243,247,97,247,78,248,27,29,247,166,241,251,148,248,65,10,214,149,
+193,174,204,26,14,249,145,28,7,57,28,5,33,21,196,94,196,59,60,89,78,86,75,
+184,88,221,221,247,237,29,102,188,195,152,31,247,45,249,199,5,57,6,251,139,
+63,5,251,214,6,155,243,201,247,181,227,211,247,50,251,21,24,214,149,193,174,
+204,26,187,90,218,251,32,251,170,251,25,251,238,251,119,104,30,252,111,6,
+153,243,200,247,181,227,211,247,50,251,21,24,248,106,10,187,90,218,251,29,
+251,173,251,15,251,230,251,109,96,30,251,68,248,93,10,105,251,84,25,104,251,
+82,88,251,62,67,50,251,99,247,201,10,247,94,247,87,248,42,10,213,248,180,
+151,232,8,248,109,6,100,248,107,29,88,247,207,10,247,87,248,42,10,210,248,
+180,154,232,8,248,80,6,251,17,253,38,247,24,29,249,145,28,7,63,192,21,217,
+7,133,119,35,104,100,27,79,94,192,199,151,31,247,142,28,5,26,5,57,6,251,137,
+90,5,166,110,92,161,67,27,251,170,251,25,251,238,251,119,102,31,252,111,6,
+155,243,200,247,55,29,248,197,10,67,50,251,101,193,24,108,248,41,29,247,95,
+247,82,247,103,29,94,247,207,10,247,82,248,27,29,248,74,6,251,15,253,17,5,
+135,112,137,114,119,26,51,186,77,247,15,237,247,46,205,151,171,30,251,113,
+28,5,35,21,55,252,68,5,252,76,248,65,10,210,149,193,172,143,198,8,14,181,
+28,4,201,28,5,15,21,51,167,68,162,70,152,184,247,55,24,40,6,97,251,42,5,140,
+122,120,140,121,128,128,138,129,27,180,247,41,5,40,6,95,251,52,5,252,29,70,
+251,152,252,1,252,11,26,251,99,225,251,98,247,97,48,30,68,251,150,5,242,6,
+201,247,118,164,133,165,135,167,136,25,81,251,105,5,242,6,196,247,101,247,
+73,144,247,63,202,168,149,25,191,247,208,5,251,7,6,55,251,115,131,122,117,
+120,124,136,25,135,130,85,111,55,27,124,6,247,207,28,4,128,169,127,158,126,
+144,136,25,156,134,157,112,119,26,251,73,247,8,7,254,29,252,96,21,247,252,
+247,76,247,151,247,119,228,30,251,179,254,164,5,63,210,91,247,1,247,44,26,
+247,102,252,26,21,247,200,250,251,5,143,162,162,141,163,27,145,145,139,138,
+145,31,251,212,28,251,120,113,146,113,148,115,151,25,14,181,250,231,248,191,
+21,254,191,248,85,29,250,194,6,14,249,83,28,6,154,249,46,21,241,38,211,251,
+37,251,46,251,72,53,251,68,63,200,88,201,114,30,251,15,100,251,5,67,251,33,
+26,251,5,246,64,247,66,247,44,247,111,229,247,72,241,49,189,67,163,30,235,
+178,246,221,247,5,26,251,42,249,144,247,72,29,247,113,83,29,28,4,121,81,21,
+55,73,70,72,98,30,251,7,182,67,184,212,26,232,235,204,228,216,197,96,57,30,
+79,252,58,21,251,2,251,8,71,38,251,2,83,192,221,246,203,248,81,10,249,83,
+176,29,248,6,74,29,249,193,252,251,129,29,249,83,176,29,248,0,178,10,249,
+217,253,52,129,29,249,83,218,10,253,125,249,148,247,88,10,248,219,203,247,
+72,29,28,4,219,249,31,129,29,249,83,28,6,129,249,46,21,247,12,43,199,251,
+34,251,39,251,64,67,33,89,180,121,164,165,184,157,139,30,158,247,9,5,147,
+149,184,166,204,27,201,213,106,51,35,34,57,251,68,149,31,127,51,5,233,151,
+247,39,145,251,29,26,251,6,39,46,251,29,90,98,160,145,126,30,119,243,5,139,
+112,152,111,71,127,86,114,75,213,64,248,11,10,247,31,182,215,227,230,26,251,
+17,249,144,247,72,29,247,113,83,29,14,249,83,28,6,147,124,10,251,4,249,144,
+139,29,14,250,75,28,6,102,248,1,21,247,19,253,35,7,247,138,247,137,5,248,
+45,247,19,251,174,6,247,35,247,36,57,221,251,117,251,118,5,253,162,251,19,
+249,35,6,251,138,251,137,5,252,45,251,19,247,174,6,251,35,251,36,221,57,247,
+117,247,118,5,14,250,75,28,6,168,248,254,21,247,48,251,29,247,19,251,46,251,
+45,251,24,251,15,43,35,30,235,33,251,24,247,15,251,43,27,251,46,251,29,251,
+19,251,48,251,41,247,15,251,31,247,46,247,74,235,247,0,247,1,247,17,31,251,
+1,247,15,237,251,0,247,74,27,247,46,247,15,247,31,247,41,31,32,125,21,37,
+45,63,43,251,27,47,241,225,51,30,211,225,247,8,247,1,247,11,27,244,218,49,
+38,31,253,23,149,21,53,51,47,37,251,25,27,43,43,215,241,240,218,229,244,247,
+11,247,8,251,1,67,225,31,14,250,75,28,6,102,247,132,21,247,19,7,254,221,247,
+217,250,221,247,218,5,247,19,7,28,251,52,252,25,5,251,19,7,28,4,204,253,9,
+248,124,10,250,75,28,6,102,249,9,21,247,19,7,28,251,52,248,25,5,251,19,7,
+250,221,251,218,254,221,251,217,5,251,19,7,28,4,204,251,132,248,124,10,99,
+250,111,249,220,21,247,19,61,248,111,252,74,33,36,104,112,78,30,223,33,5,
+186,247,0,164,161,245,27,247,46,247,41,251,64,251,100,135,31,137,57,137,61,
+121,51,8,247,2,251,36,86,174,251,17,27,251,19,251,187,47,252,70,251,64,247,
+48,251,99,247,142,248,103,196,249,84,247,73,31,251,95,251,93,21,251,183,105,
+44,251,222,251,105,27,251,80,125,247,105,223,247,79,239,247,166,247,103,247,
+23,196,51,90,184,31,14,195,198,29,248,65,159,10,247,12,28,4,152,247,203,21,
+61,6,251,66,75,59,78,51,151,221,247,29,30,248,181,247,17,7,247,7,178,223,
+240,31,87,6,110,131,94,114,94,27,253,117,6,251,64,73,251,47,47,31,199,6,175,
+151,145,219,247,29,27,225,251,150,6,252,19,35,86,77,94,107,194,219,30,71,
+6,251,33,166,251,38,247,10,247,58,231,247,56,247,105,30,248,105,247,171,252,
+215,7,251,9,161,251,42,247,91,247,19,244,247,5,247,115,30,14,251,24,250,13,
+28,5,80,21,159,190,133,184,94,182,112,164,70,145,75,127,251,94,98,77,251,
+48,119,252,209,131,251,122,24,128,251,228,121,251,213,135,63,133,100,112,
+80,251,5,237,78,192,61,92,123,102,118,90,147,92,182,98,166,114,207,131,204,
+154,247,76,178,232,235,163,249,27,149,247,166,24,150,247,169,141,247,217,
+145,213,143,178,166,201,247,6,40,199,86,216,184,154,174,8,14,248,104,113,
+29,220,28,4,154,28,5,92,21,201,251,56,7,251,226,28,251,57,252,35,249,160,
+251,132,251,13,172,78,247,19,202,248,78,253,252,5,201,6,248,6,28,5,92,5,14,
+250,75,28,6,102,249,181,21,247,194,10,127,251,87,124,72,67,247,110,29,213,
+194,190,8,251,240,4,247,194,10,126,251,87,125,72,67,247,169,10,149,247,14,
+148,247,5,212,194,191,8,14,247,104,247,104,29,252,133,14,142,250,152,249,
+183,21,252,50,249,166,5,251,21,6,252,49,253,166,248,49,253,183,248,136,10,
+247,179,249,183,21,251,242,253,68,251,244,249,68,247,244,249,50,5,14,108,
+248,55,249,236,21,158,131,123,149,121,27,112,117,115,115,111,163,119,165,
+166,157,162,164,145,138,146,136,145,31,247,207,253,139,21,157,130,120,151,
+120,27,114,119,115,116,111,163,118,163,166,160,163,163,145,137,145,137,145,
+31,252,95,249,65,21,148,130,127,144,127,27,114,117,117,112,114,160,118,166,
+167,158,158,168,152,133,151,130,147,31,248,218,252,216,21,147,129,126,144,
+126,27,113,119,118,113,114,160,117,166,167,159,161,164,151,134,152,130,148,
+31,253,66,248,93,21,141,133,133,141,133,27,115,116,118,112,115,158,115,167,
+163,164,159,165,158,127,158,120,147,31,249,139,251,206,21,141,134,133,140,
+133,27,115,114,123,108,115,157,116,169,164,162,159,166,158,127,156,121,147,
+31,253,188,247,52,21,112,119,118,113,114,159,116,165,31,141,6,163,163,161,
+166,164,115,160,114,31,249,201,140,21,115,137,115,119,112,26,115,160,117,
+163,30,143,6,165,160,161,164,165,117,161,113,31,253,188,251,54,21,120,132,
+129,122,121,26,112,162,117,164,166,160,163,164,165,117,159,113,133,132,138,
+136,133,30,249,139,247,207,21,121,131,128,121,120,26,113,161,118,163,167,
+160,163,163,166,115,160,115,133,133,137,137,133,30,253,65,252,95,21,130,130,
+134,128,127,26,114,162,116,164,165,160,162,164,166,118,159,111,127,128,133,
+130,130,30,248,216,248,218,21,131,130,134,126,127,26,115,160,115,165,165,
+160,161,165,165,119,161,112,127,127,134,130,129,30,252,93,253,66,21,137,133,
+137,133,133,26,116,161,115,165,163,163,159,166,163,119,163,112,123,118,127,
+121,131,30,247,206,249,139,21,137,133,138,134,133,26,115,159,114,166,163,
+163,159,166,164,118,163,112,120,122,127,121,131,30,251,52,253,188,21,247,
+255,29,249,201,4,247,255,29,14,109,32,29,14,252,39,248,201,252,63,248,142,
+29,119,152,182,194,206,157,10,252,41,249,171,249,197,126,29,121,28,4,168,
+126,29,109,32,29,247,194,247,217,49,29,109,32,29,251,116,254,220,248,204,
+10,109,32,29,247,192,247,217,72,29,247,62,249,63,35,29,109,32,29,247,192,
+247,217,248,208,10,109,32,29,247,192,247,217,72,29,247,159,249,67,35,10,109,
+32,29,247,192,247,217,248,215,29,109,32,29,247,148,248,19,58,10,109,32,29,
+247,220,249,0,57,29,109,32,29,251,116,254,220,72,10,248,188,28,6,180,57,29,
+109,32,29,247,220,249,0,69,10,138,248,24,35,29,109,32,29,247,220,249,0,69,
+10,251,23,244,42,10,109,32,29,247,220,249,0,69,10,235,248,28,35,10,109,32,
+29,247,220,249,0,69,10,251,12,248,38,37,10,109,32,29,247,162,248,205,80,10,
+109,32,29,248,9,249,52,48,10,109,32,29,247,193,248,168,68,29,109,32,29,247,
+197,248,146,39,29,109,32,29,247,203,248,146,60,10,248,134,248,58,68,29,109,
+32,29,242,248,146,46,29,109,32,29,248,21,250,56,130,10,251,148,251,179,46,
+29,109,32,29,95,247,217,85,10,247,113,248,210,35,29,109,32,29,243,248,243,
+219,10,109,32,29,247,56,249,2,37,10,109,32,29,251,116,254,220,66,29,109,32,
+29,252,33,28,250,129,125,29,109,32,29,247,35,253,183,69,29,109,28,5,73,154,
+10,197,247,189,5,34,6,83,251,178,148,10,251,184,248,25,248,217,29,109,250,
+59,250,203,21,58,190,49,251,34,5,153,107,101,149,100,27,252,19,251,98,251,
+245,251,209,43,162,251,19,222,63,31,34,251,60,215,88,246,247,62,5,127,171,
+176,132,182,27,247,210,10,213,7,135,118,53,110,111,27,83,107,162,210,230,
+243,247,86,10,251,25,6,252,245,253,13,21,247,118,242,247,225,247,205,145,
+148,132,130,147,30,252,58,253,53,5,126,179,135,185,183,26,247,50,251,135,
+21,104,111,149,156,117,31,248,54,249,43,33,252,199,5,110,111,36,41,43,27,
+14,248,218,28,6,135,194,21,213,7,135,118,53,110,111,248,190,29,32,48,111,
+93,63,31,158,188,5,183,10,247,48,247,22,247,7,210,212,31,39,170,208,53,247,
+43,27,247,210,10,251,193,249,128,221,10,252,246,22,247,102,29,14,248,184,
+28,6,46,248,122,10,38,48,107,86,63,30,147,161,147,162,146,154,8,251,2,247,
+143,10,247,45,247,38,247,14,208,207,31,251,13,193,247,2,69,247,46,248,145,
+29,251,99,247,111,10,252,251,247,72,215,29,248,170,28,6,89,188,21,247,19,
+10,247,56,249,168,5,251,83,6,251,47,253,134,5,68,61,35,79,41,27,86,76,191,
+246,156,31,212,248,55,178,247,27,153,194,144,160,160,204,152,170,8,183,10,
+247,15,246,221,200,203,31,63,158,200,72,247,19,27,247,29,246,247,100,29,253,
+245,249,134,21,32,252,201,5,98,105,34,53,51,247,188,29,14,248,12,28,5,203,
+250,13,21,247,177,10,69,251,69,251,39,251,102,251,78,251,119,25,116,153,124,
+157,192,26,230,243,248,117,168,247,0,30,248,132,10,183,10,248,78,29,167,185,
+151,152,178,31,247,105,247,134,247,69,247,127,247,34,247,150,248,128,29,253,
+103,53,215,29,248,37,28,5,193,248,89,21,241,251,32,7,176,198,175,199,173,
+200,248,128,29,247,177,10,118,87,112,84,106,82,25,251,190,6,167,247,26,168,
+247,23,153,189,248,132,10,183,10,248,78,29,167,185,151,152,178,31,247,25,
+247,43,247,11,247,41,244,247,45,8,252,141,247,242,221,10,247,8,253,78,21,
+116,153,124,157,192,26,177,157,245,162,247,11,30,247,148,6,68,251,2,51,251,
+8,39,251,14,8,14,248,94,28,6,74,247,222,10,251,22,251,203,251,40,251,234,
+251,19,251,146,8,134,118,120,135,129,248,190,29,252,19,251,98,251,245,251,
+209,251,39,194,251,112,247,133,248,78,29,173,186,151,154,185,31,42,251,73,
+251,3,251,37,58,247,21,29,253,128,96,215,29,109,110,10,252,40,118,10,109,
+250,185,194,247,165,29,105,162,210,230,245,77,10,252,40,249,185,249,198,248,
+142,29,117,152,182,194,208,157,10,109,28,5,73,154,10,197,247,189,5,34,6,83,
+251,178,148,10,251,184,248,25,247,165,29,105,162,210,230,245,77,10,99,248,
+134,250,136,21,251,177,251,45,251,180,251,165,251,136,247,15,251,124,247,
+140,235,237,184,176,197,31,172,82,5,247,22,6,126,170,117,207,135,160,8,247,
+14,232,248,19,180,247,73,30,196,152,188,147,163,27,167,225,110,135,160,31,
+213,7,153,106,251,16,205,60,27,66,100,130,251,12,97,31,200,78,56,227,251,
+22,27,111,254,62,21,251,45,68,247,54,247,70,247,111,246,247,135,247,91,215,
+208,79,91,185,31,107,251,10,103,251,72,85,251,166,8,87,106,42,69,118,27,14,
+109,110,10,252,40,118,10,248,65,66,10,14,248,65,66,10,248,225,248,134,35,
+29,248,65,66,10,248,243,248,58,68,29,248,65,176,247,74,21,80,196,251,38,247,
+81,245,242,193,210,227,30,129,111,124,87,131,117,8,247,29,6,172,188,5,102,
+176,180,102,215,27,248,19,247,98,247,245,247,209,247,39,84,247,112,251,133,
+251,3,251,31,75,251,19,49,31,247,60,98,44,162,251,51,27,251,79,251,45,251,
+11,65,65,31,251,21,7,247,23,247,39,246,207,231,27,247,70,156,61,251,72,114,
+124,96,135,112,31,251,136,125,251,248,251,9,251,115,26,247,72,137,21,247,
+37,247,130,247,9,247,66,156,30,251,48,104,251,23,251,113,251,25,27,69,96,
+184,192,31,248,185,145,21,244,248,197,5,189,176,247,4,218,219,27,247,19,170,
+251,21,251,6,251,118,36,251,225,251,205,31,14,33,247,31,250,18,21,104,176,
+51,247,15,208,206,172,181,196,30,132,122,130,108,134,126,8,228,6,160,168,
+5,117,163,166,117,188,27,247,141,247,26,247,104,247,82,227,103,247,24,251,
+48,66,49,101,63,81,31,239,112,77,153,36,27,251,14,40,68,94,91,31,62,7,218,
+234,209,179,199,27,247,7,150,93,251,0,124,130,113,136,123,31,251,51,130,251,
+123,69,251,26,26,247,9,138,21,226,247,47,209,247,5,149,30,46,116,54,251,25,
+52,27,94,111,166,171,31,247,249,143,21,207,247,228,5,169,163,212,187,191,
+27,222,159,61,71,251,28,72,251,92,251,96,31,14,168,28,4,117,250,111,21,251,
+58,6,139,71,251,84,92,51,30,247,88,76,247,1,251,71,251,254,251,82,251,240,
+251,212,251,29,186,251,124,247,119,247,76,217,201,247,41,247,5,30,33,143,
+145,34,247,23,27,247,42,231,247,144,139,31,71,6,139,94,45,90,112,119,158,
+186,200,124,241,148,215,30,210,242,247,79,248,82,139,26,252,52,252,209,21,
+32,82,77,251,82,251,84,27,251,30,113,247,49,242,247,86,247,9,247,224,247,
+139,247,7,196,251,74,251,199,78,31,14,247,173,34,10,14,251,94,250,72,249,
+165,21,191,7,78,145,120,140,134,145,137,155,25,251,36,249,143,5,32,6,252,
+127,253,165,64,132,5,87,247,179,191,7,78,145,113,141,130,144,148,155,25,247,
+28,247,127,5,247,194,6,179,251,127,142,126,131,131,119,137,25,78,133,5,87,
+7,173,248,10,21,251,146,6,247,89,247,211,5,14,154,250,150,22,217,7,55,147,
+123,141,135,149,135,156,25,251,67,250,21,5,251,33,6,252,232,254,50,247,250,
+29,247,48,247,150,5,247,244,6,184,251,150,141,128,139,123,117,137,25,57,131,
+5,61,7,178,248,95,21,251,173,6,247,109,247,234,5,14,247,173,34,10,248,66,
+248,9,49,29,247,173,34,10,248,64,248,9,72,29,247,62,249,63,35,29,247,173,
+34,10,248,64,248,9,248,208,10,247,173,34,10,248,64,248,9,72,29,247,159,249,
+67,35,10,247,173,34,10,248,64,248,9,248,215,29,247,173,34,10,251,32,28,250,
+88,72,10,248,204,28,7,29,44,29,247,173,34,10,248,20,248,67,58,10,247,173,
+34,10,248,92,249,48,57,29,247,173,34,10,248,92,249,48,69,10,138,248,24,35,
+29,247,173,34,10,248,92,249,48,69,10,251,23,244,42,10,247,173,34,10,248,92,
+249,48,69,10,235,248,28,35,10,247,173,34,10,248,92,249,48,69,10,251,12,248,
+38,37,10,247,173,34,10,251,32,28,250,88,72,10,248,232,28,8,68,57,29,247,173,
+34,10,248,95,249,17,78,29,247,173,34,10,248,137,249,100,48,10,247,173,34,
+10,248,65,248,216,68,29,247,173,34,10,248,75,248,194,39,29,247,173,34,10,
+248,75,248,194,248,207,29,247,173,34,10,247,123,248,194,46,29,247,173,34,
+10,248,109,250,104,130,10,251,108,251,179,46,29,247,173,34,10,223,248,9,85,
+10,247,113,248,210,35,29,247,173,34,10,247,184,249,50,37,10,247,173,34,10,
+251,32,28,250,88,66,29,247,173,34,10,251,205,28,249,33,125,29,247,173,34,
+10,248,18,28,251,125,69,29,247,173,28,5,7,247,20,29,250,193,247,56,21,179,
+29,14,247,147,247,64,247,167,29,122,51,226,123,168,134,140,133,143,111,25,
+247,117,28,251,16,5,247,43,6,249,94,28,5,14,247,14,164,156,227,5,252,40,6,
+122,51,247,8,129,5,153,155,114,123,130,31,251,95,252,5,5,252,100,6,72,248,
+11,5,149,137,156,164,151,27,247,10,149,156,227,5,61,252,242,21,248,28,6,251,
+189,252,173,5,14,250,202,28,8,88,249,234,21,247,197,251,77,247,140,251,232,
+251,177,251,91,251,64,251,130,251,22,30,68,248,46,94,10,153,51,5,251,217,
+191,247,92,251,38,247,160,27,248,118,247,140,248,91,248,68,31,251,125,22,
+251,240,251,75,252,68,251,191,251,83,251,11,247,62,247,168,247,255,247,75,
+248,58,247,191,247,88,247,6,251,71,251,164,30,254,173,251,123,247,202,29,
+14,28,4,197,28,8,174,22,247,134,10,251,113,28,4,248,5,251,56,6,252,233,254,
+157,251,71,250,157,94,10,201,252,27,247,223,29,248,117,247,134,10,137,150,
+247,95,248,16,5,248,100,6,201,252,27,247,223,29,7,192,249,3,247,202,29,253,
+232,252,168,247,202,29,14,250,113,28,8,124,247,166,10,225,252,99,53,7,247,
+7,129,176,247,166,29,251,36,253,107,5,251,111,96,58,251,83,251,131,27,251,
+54,82,223,247,79,106,31,251,72,250,160,94,10,173,251,108,5,251,183,185,247,
+26,87,247,121,27,247,182,247,76,247,66,247,189,196,31,247,50,249,179,248,
+133,29,28,251,81,253,35,247,202,29,14,249,86,28,7,160,28,5,8,248,166,10,252,
+176,254,113,251,92,28,4,129,94,10,229,252,195,5,247,47,6,249,107,28,5,29,
+5,254,114,253,33,247,202,29,14,249,86,28,7,160,28,5,8,248,166,10,251,231,
+253,0,5,251,157,6,251,28,249,164,94,10,229,252,195,5,247,47,6,247,202,248,
+195,5,247,216,236,251,162,6,247,255,249,33,5,254,114,253,33,247,202,29,247,
+205,253,9,21,247,87,6,251,40,251,164,5,14,249,86,28,7,160,28,5,8,248,166,
+10,252,176,254,113,251,92,28,4,129,94,10,230,252,202,66,251,27,61,60,247,
+205,29,247,37,247,20,247,137,247,29,30,174,202,5,140,6,249,107,28,5,29,5,
+254,114,253,33,247,202,29,14,247,173,28,4,238,248,43,21,239,251,72,7,119,
+247,7,5,247,92,239,251,109,6,251,11,249,65,5,251,56,6,252,32,253,65,5,251,
+248,39,247,191,6,72,251,7,5,251,124,39,247,66,6,251,70,251,201,247,233,29,
+247,43,247,164,5,248,175,6,184,251,164,247,223,29,248,117,247,134,10,92,247,
+164,5,251,226,249,128,21,210,252,69,5,251,204,6,83,39,21,248,21,6,158,251,
+7,5,252,104,6,14,247,173,28,5,49,28,5,127,21,89,6,251,71,251,15,5,201,88,
+251,13,200,63,27,252,101,251,181,252,142,252,68,251,132,247,42,251,154,247,
+103,247,31,247,54,216,247,25,247,18,31,103,251,69,5,248,25,225,6,251,7,149,
+102,247,203,29,247,112,250,253,165,247,35,139,26,251,152,251,162,21,251,49,
+253,204,5,60,65,251,25,63,44,27,251,76,47,247,53,247,124,247,191,247,66,248,
+58,247,228,206,247,19,59,84,170,31,14,247,173,244,106,21,189,6,247,71,247,
+15,5,77,190,247,43,78,215,27,248,101,247,151,248,142,248,68,247,132,251,42,
+247,154,251,103,251,31,251,54,62,251,25,251,18,31,175,247,69,5,252,25,53,
+6,247,7,129,176,137,147,122,135,119,25,251,112,254,253,113,251,35,139,26,
+247,152,247,162,21,247,49,249,204,5,218,213,247,25,215,234,27,247,76,231,
+251,53,251,124,251,191,251,36,252,58,251,228,72,251,49,219,194,108,31,14,
+249,200,67,29,14,247,41,28,5,110,28,6,73,21,253,123,88,6,214,133,149,138,
+142,125,130,129,25,252,220,253,41,127,127,129,129,128,138,25,74,133,5,87,
+247,196,191,7,81,145,117,141,127,150,148,149,25,247,98,247,122,5,247,191,
+6,90,251,122,137,131,132,125,122,138,25,58,133,5,87,249,31,7,182,247,96,5,
+57,6,99,251,10,5,124,133,130,129,121,27,251,192,6,209,247,228,5,247,57,6,
+158,148,130,124,136,31,128,51,5,213,6,199,247,173,5,63,6,114,57,5,122,134,
+130,133,121,27,251,58,6,202,247,194,5,247,132,6,159,144,133,122,31,39,225,
+7,252,125,247,4,21,60,252,12,5,251,149,6,14,248,47,28,5,78,22,187,10,190,
+247,127,5,254,73,61,6,217,129,159,135,144,125,130,129,25,253,33,253,165,47,
+131,5,61,248,11,248,120,10,247,107,247,150,5,247,217,6,85,251,138,248,116,
+29,7,247,196,250,24,21,43,252,77,5,251,164,6,14,249,200,67,29,250,98,28,4,
+160,35,29,249,200,67,29,250,116,250,232,68,29,252,80,249,99,28,4,141,21,242,
+94,247,15,251,29,73,74,106,98,89,30,213,248,9,5,86,6,251,99,102,5,102,7,247,
+9,129,251,50,253,161,5,102,203,214,121,215,27,247,162,244,247,134,247,45,
+31,251,23,133,21,251,39,47,251,77,251,15,90,98,164,161,122,30,215,248,9,5,
+174,184,201,168,182,27,171,203,98,251,3,31,14,50,70,10,220,250,250,46,29,
+50,70,10,37,253,187,68,29,50,70,10,251,210,254,44,66,29,50,249,220,248,157,
+21,35,6,251,35,253,141,111,29,247,137,249,244,155,10,14,50,250,66,249,15,
+21,247,178,29,33,83,72,65,30,176,247,99,5,247,156,6,164,247,4,5,251,161,6,
+199,247,193,5,57,248,127,10,247,75,121,110,251,52,5,251,44,6,119,251,4,5,
+247,41,6,251,82,254,150,5,77,235,247,9,106,247,223,10,31,251,95,131,248,109,
+29,178,180,113,30,247,8,248,52,29,31,14,71,250,87,149,29,136,249,48,35,10,
+50,176,209,21,77,235,247,9,106,248,171,10,33,83,72,63,31,140,164,247,33,209,
+156,31,183,247,78,229,247,1,247,12,141,235,251,23,24,139,247,32,170,247,2,
+26,191,96,189,251,3,251,52,251,56,82,251,56,251,7,30,89,67,103,57,118,251,
+14,116,251,23,251,14,253,31,109,251,52,8,247,95,221,21,247,10,248,52,29,251,
+138,251,33,251,201,251,80,65,69,178,180,113,31,14,101,250,198,249,15,247,
+95,29,251,10,253,13,5,251,144,251,103,251,73,251,176,251,157,26,251,78,247,
+19,251,88,247,189,226,236,156,167,217,30,246,7,116,82,72,130,84,27,251,124,
+57,247,60,247,65,247,32,221,247,128,247,25,247,66,31,40,252,170,233,29,50,
+250,66,249,15,21,247,178,29,251,0,83,72,65,30,247,19,249,57,252,105,252,81,
+247,56,251,62,251,56,254,5,233,29,109,247,198,28,5,229,21,251,161,28,250,
+97,5,77,235,247,9,106,247,148,10,230,248,117,5,155,143,158,166,167,27,247,
+177,248,48,10,203,247,211,253,75,140,5,248,69,254,7,247,88,29,14,136,28,4,
+135,28,5,166,21,108,6,139,105,75,251,118,251,252,251,189,251,35,252,224,251,
+11,30,121,51,114,49,49,26,251,111,247,23,251,81,247,146,247,232,247,144,247,
+210,247,215,247,118,251,27,247,62,251,144,251,97,251,47,251,13,34,63,30,247,
+93,208,225,247,107,248,44,27,247,168,209,247,19,247,9,186,31,251,215,253,
+191,21,251,111,251,17,251,245,251,150,251,38,70,247,13,247,60,247,111,247,
+19,247,245,247,150,247,37,207,251,15,251,58,30,14,251,100,249,203,247,246,
+145,29,14,251,100,177,250,9,21,247,73,6,251,15,252,255,247,179,29,248,67,
+29,198,247,189,5,247,106,241,251,86,6,168,247,36,5,251,80,6,110,251,36,5,
+251,93,6,248,225,253,9,247,74,29,14,115,250,134,247,246,21,247,68,251,38,
+232,251,101,105,85,120,123,104,30,219,248,35,5,252,176,6,90,251,144,5,245,
+6,190,247,44,5,151,143,152,147,149,27,247,93,6,251,17,253,21,5,135,121,136,
+120,123,26,251,56,247,67,65,247,23,247,98,247,114,247,1,247,162,30,251,91,
+143,21,251,57,57,251,26,37,83,35,168,247,13,155,141,156,141,159,30,184,247,
+128,5,153,162,202,162,166,248,160,10,247,179,28,5,41,248,16,29,208,247,248,
+5,252,131,6,149,207,247,106,10,251,52,253,250,5,247,83,6,247,51,249,244,5,
+247,202,6,251,11,252,234,248,47,29,247,97,247,113,248,31,10,84,34,248,0,10,
+166,27,247,33,182,81,251,11,31,14,247,153,85,29,14,247,153,85,29,248,193,
+250,79,39,29,93,250,123,249,209,21,232,78,229,251,115,252,21,251,159,252,
+9,251,173,251,86,247,17,251,81,247,171,247,99,247,176,246,247,150,247,15,
+251,2,204,251,11,154,30,247,27,178,247,27,221,247,57,26,251,76,127,21,251,
+91,251,86,80,251,64,30,100,57,5,139,247,4,145,168,247,39,215,80,45,251,70,
+251,43,46,251,58,42,64,247,9,247,60,247,97,247,39,248,19,247,122,247,12,172,
+81,82,30,14,247,38,60,29,14,251,182,250,3,28,5,172,21,234,69,201,251,86,30,
+252,9,88,6,213,133,163,247,191,10,248,0,7,247,116,247,62,213,247,93,246,59,
+181,251,8,154,31,247,14,176,239,204,247,18,26,251,40,131,21,251,3,54,45,251,
+58,127,108,140,140,119,30,204,247,204,5,140,154,165,142,166,27,247,6,206,
+103,62,31,115,252,32,21,251,22,38,61,251,82,116,101,142,140,117,30,210,247,
+226,5,143,168,177,142,172,27,247,17,217,103,38,31,14,35,247,146,10,251,52,
+253,127,248,10,29,247,105,227,247,138,247,13,55,192,251,13,159,31,247,23,
+186,246,215,247,36,26,251,97,126,21,251,17,49,35,251,89,127,115,139,141,116,
+30,213,247,240,248,64,29,110,252,99,248,22,10,248,15,5,141,171,174,141,176,
+27,247,42,218,98,251,1,31,14,247,38,60,29,150,28,4,251,46,29,247,38,60,29,
+251,36,252,254,68,29,247,38,60,29,251,252,253,111,66,29,247,38,247,235,29,
+247,4,247,242,29,251,37,253,146,5,251,70,6,116,251,5,5,247,70,6,96,251,115,
+232,10,90,141,141,110,30,237,248,156,5,141,162,180,247,170,10,82,143,141,
+106,30,188,247,152,5,247,205,6,162,247,5,5,251,205,6,173,247,76,248,21,10,
+14,251,162,250,1,28,5,169,21,237,63,201,251,80,30,252,7,89,6,215,132,158,
+138,146,127,134,121,25,86,251,154,5,251,34,45,247,15,6,79,251,189,5,126,138,
+126,126,126,27,59,132,5,89,247,253,7,247,110,247,63,220,247,67,195,100,179,
+88,167,31,247,31,233,251,57,6,215,183,206,203,221,26,251,60,252,34,21,251,
+13,57,49,251,110,30,120,102,141,119,27,209,247,215,5,247,1,6,247,4,136,224,
+114,53,26,162,248,23,21,35,36,64,251,50,30,89,6,199,247,187,5,141,153,162,
+139,159,27,247,48,177,89,71,31,14,35,247,146,10,75,251,188,5,251,67,251,5,
+247,43,6,67,251,230,248,10,29,247,104,236,247,101,206,91,187,76,173,31,247,
+64,247,5,251,97,6,233,192,223,215,237,26,251,126,252,112,248,22,10,248,5,
+5,243,6,247,42,218,112,251,1,31,168,248,99,21,251,17,49,50,251,89,30,129,
+6,90,6,213,247,227,248,64,29,14,247,81,28,4,195,250,236,21,247,50,251,1,243,
+251,187,30,252,162,6,36,251,70,55,251,56,84,180,82,196,178,193,163,182,186,
+31,83,247,36,5,139,162,180,211,30,202,6,176,147,118,119,135,31,251,99,254,
+214,133,115,131,248,41,10,248,197,7,247,235,247,154,247,15,247,228,247,70,
+251,17,209,251,68,163,31,247,78,201,247,46,247,0,247,103,26,251,118,125,21,
+251,77,251,23,251,49,251,150,123,90,141,141,110,30,237,248,156,5,141,162,
+180,143,180,27,247,66,245,247,253,10,80,143,141,108,30,245,248,193,5,146,
+185,194,143,190,27,247,85,247,14,77,251,58,31,14,247,241,28,5,58,248,95,21,
+247,80,251,21,200,251,64,162,30,247,104,206,247,22,247,18,247,80,26,247,55,
+251,10,238,251,179,30,252,212,53,6,247,6,129,166,137,159,131,132,104,25,46,
+252,115,5,114,6,251,137,251,36,251,52,251,75,60,187,75,219,203,201,179,199,
+156,31,251,25,247,15,5,247,13,160,228,186,246,27,179,6,38,252,160,136,119,
+133,123,110,137,25,251,20,130,138,51,5,248,197,6,248,4,247,129,247,36,247,
+207,31,253,52,252,3,21,101,50,145,139,31,247,0,248,197,5,247,72,6,247,77,
+241,57,251,31,251,126,251,68,251,4,251,164,31,208,249,42,21,71,6,240,248,
+163,5,152,189,144,181,27,247,74,234,76,251,17,251,91,251,30,251,37,251,169,
+31,14,244,247,20,250,83,21,247,28,251,58,251,19,253,34,247,80,29,247,16,249,
+27,5,247,214,254,87,247,92,10,247,9,28,4,123,247,255,10,251,105,254,220,247,
+80,29,231,248,117,247,36,29,251,64,252,253,247,92,10,247,13,28,4,127,247,
+255,10,251,109,254,220,247,75,10,215,248,23,247,36,29,251,94,252,171,21,251,
+176,251,46,251,34,251,185,88,88,143,139,30,247,21,249,32,5,139,229,149,182,
+247,78,240,65,251,58,30,14,205,250,220,248,146,21,248,93,29,30,247,194,29,
+163,137,153,120,135,117,25,251,109,248,169,29,247,242,247,204,245,248,40,
+31,251,120,161,247,93,29,205,247,67,28,4,247,21,247,80,6,251,116,28,251,148,
+247,75,10,222,248,59,5,247,108,242,251,87,6,167,247,34,5,251,99,6,111,251,
+34,5,251,101,6,249,73,253,222,247,93,29,247,165,28,4,254,248,152,21,247,115,
+251,64,247,11,251,158,79,47,129,139,30,215,248,23,143,155,157,164,168,141,
+25,247,44,147,5,227,253,173,7,248,92,10,147,155,156,158,27,247,82,6,170,147,
+114,121,135,31,251,105,254,212,135,123,118,114,111,137,25,251,36,131,5,51,
+248,126,7,247,254,247,173,247,7,248,37,31,251,119,172,21,251,171,40,251,64,
+251,201,248,54,29,247,68,213,73,251,37,30,14,247,186,28,5,14,248,142,21,247,
+117,251,82,246,251,162,81,45,128,139,30,190,247,144,5,247,101,6,160,147,123,
+118,31,251,35,247,4,7,193,247,167,5,252,21,6,157,233,143,155,158,164,167,
+141,25,247,32,147,5,227,252,206,51,7,247,29,131,168,137,149,114,135,123,25,
+121,45,5,252,23,6,85,251,167,5,247,5,6,194,247,35,5,160,148,155,155,157,27,
+247,103,6,251,78,254,64,135,123,120,114,111,137,25,251,38,131,5,51,248,128,
+7,247,238,247,205,245,248,36,31,251,119,161,21,251,172,251,21,251,42,251,
+189,90,248,71,29,247,74,227,82,251,46,30,14,248,249,79,29,14,248,249,79,29,
+248,176,28,4,136,39,29,100,250,108,248,59,21,169,247,152,251,31,247,13,251,
+70,170,247,20,170,247,27,236,177,247,78,8,247,99,181,44,247,45,251,110,27,
+251,223,251,27,251,191,251,174,81,31,251,133,28,251,45,135,120,120,111,116,
+137,25,251,1,128,5,60,248,143,7,140,218,251,36,150,5,125,128,157,170,145,
+31,247,137,28,4,231,5,247,38,169,152,247,207,247,125,27,247,22,175,251,29,
+251,15,114,31,101,251,78,32,43,251,81,141,129,105,133,108,133,111,247,176,
+147,221,251,99,99,251,96,8,251,114,96,251,17,70,251,14,27,87,59,154,174,85,
+31,116,251,8,5,112,185,240,125,197,27,247,99,247,142,247,18,247,214,176,31,
+14,251,239,248,151,251,98,91,29,251,239,249,135,250,163,91,29,248,16,247,
+31,247,33,21,136,119,118,116,111,137,33,131,24,123,51,5,248,104,6,155,227,
+66,147,110,141,131,162,142,159,25,246,248,195,5,248,96,227,247,109,247,24,
+247,101,27,237,225,92,93,180,31,252,114,252,131,248,70,251,43,174,36,115,
+251,18,25,251,44,110,251,14,49,251,33,27,63,78,161,164,111,31,127,149,126,
+158,140,155,145,247,64,24,251,18,6,81,251,195,5,139,247,37,63,247,59,247,
+240,247,67,247,103,247,99,179,30,177,247,94,251,0,238,251,214,247,19,248,
+102,248,123,24,205,251,24,251,47,180,251,55,27,252,16,251,166,251,100,252,
+115,48,31,14,251,98,249,205,184,10,251,98,59,29,14,252,162,249,29,28,5,25,
+226,29,66,28,6,144,226,29,251,98,59,29,247,20,248,179,35,29,251,98,59,29,
+247,37,247,152,44,29,251,98,59,29,247,110,248,243,48,10,251,98,59,29,87,248,
+81,46,29,251,98,59,29,247,20,248,179,115,29,251,237,28,249,152,51,10,251,
+98,247,182,22,193,80,191,51,100,34,235,29,185,247,13,87,247,10,70,207,8,248,
+61,184,10,251,98,249,162,247,72,21,35,6,60,252,56,111,29,247,14,250,221,192,
+10,14,251,98,98,248,89,21,247,5,6,135,107,137,107,106,26,247,66,29,160,140,
+164,142,165,31,247,136,241,251,121,6,173,247,50,220,247,65,247,49,146,248,
+99,10,201,78,221,251,40,251,117,251,114,251,82,251,159,63,30,251,26,6,14,
+251,98,59,29,212,247,103,247,184,10,251,98,250,19,249,248,21,201,75,221,251,
+39,251,134,251,127,251,113,251,189,77,30,47,252,83,5,131,96,135,92,94,26,
+251,136,247,13,251,29,247,86,247,75,247,27,247,9,221,223,30,247,23,7,251,
+9,251,7,251,9,57,33,27,251,29,94,247,31,247,25,205,145,200,151,195,31,229,
+248,80,160,229,171,215,178,192,25,199,219,210,170,188,141,247,9,251,50,24,
+247,23,156,168,202,192,26,14,251,98,250,209,250,250,21,197,101,182,36,251,
+33,57,67,251,39,92,30,141,120,121,141,118,27,251,170,251,164,251,181,252,
+3,248,17,29,31,247,211,29,247,72,186,247,29,203,221,31,198,219,211,170,188,
+141,248,99,10,166,129,168,115,163,30,167,247,34,158,177,192,156,243,251,3,
+24,139,229,160,210,26,14,251,98,249,205,249,248,248,50,10,251,74,206,251,
+15,247,7,88,30,247,5,29,247,56,209,247,230,247,113,149,30,247,9,251,50,5,
+247,122,10,245,27,176,158,116,109,31,14,252,154,249,31,28,5,26,21,176,100,
+188,42,251,72,251,69,251,65,251,112,251,2,182,66,214,108,30,119,86,120,84,
+129,89,8,202,6,149,187,157,190,158,186,8,137,147,157,138,146,27,246,247,40,
+209,247,9,192,98,172,83,33,84,63,55,98,31,109,170,127,189,189,26,237,184,
+247,95,247,36,145,30,215,44,5,224,149,156,177,171,26,40,251,246,21,86,65,
+87,86,122,119,144,141,124,30,200,168,183,208,208,27,163,152,125,121,31,14,
+251,98,249,205,249,11,188,29,252,154,249,31,28,4,140,21,247,37,61,222,251,
+19,251,10,51,68,90,85,30,61,7,208,214,214,188,210,27,227,169,55,60,39,94,
+251,94,251,35,133,31,62,234,5,54,130,122,100,107,26,102,179,90,234,247,73,
+247,69,247,65,247,113,30,14,251,98,248,82,154,10,210,247,240,42,177,62,252,
+11,148,10,248,15,250,89,188,29,78,168,29,247,178,10,30,251,99,148,21,38,118,
+251,5,101,41,30,227,118,62,198,43,27,41,48,82,57,87,31,137,156,139,157,158,
+26,248,55,29,251,51,252,12,247,229,29,14,251,98,139,10,14,251,98,139,10,247,
+197,251,248,245,10,199,248,77,250,17,21,251,135,251,30,251,12,251,87,251,
+74,247,11,251,27,221,55,31,247,21,6,251,7,247,8,57,247,7,247,1,26,247,27,
+247,32,186,247,25,247,58,247,228,69,251,111,149,30,251,50,251,11,5,251,23,
+155,203,113,192,27,201,221,200,247,39,247,171,251,181,247,164,252,3,31,14,
+251,47,250,103,250,85,21,167,49,47,162,42,27,251,240,251,181,251,171,251,
+242,251,146,247,71,251,46,247,144,235,247,4,160,172,232,31,188,247,133,5,
+49,6,108,66,114,65,139,26,131,118,115,123,116,131,8,131,112,101,135,85,27,
+251,78,53,237,247,74,178,143,176,143,178,31,248,17,6,155,225,5,252,14,6,247,
+99,188,247,19,247,62,247,121,27,178,247,17,124,80,137,31,133,251,17,5,231,
+6,14,251,47,119,10,14,251,47,119,10,184,249,75,39,29,247,85,56,10,14,247,
+85,56,10,14,115,250,168,250,74,21,178,251,23,51,162,35,27,252,25,251,158,
+251,195,251,206,251,101,247,23,251,103,247,217,247,7,247,7,166,174,247,0,
+31,186,247,142,5,251,2,6,65,251,62,135,128,122,127,129,137,25,125,100,102,
+131,98,27,251,68,251,29,237,247,103,247,222,247,117,247,101,247,132,190,180,
+126,117,182,31,151,137,150,122,129,26,251,37,247,4,7,14,247,85,56,10,115,
+249,185,35,29,247,85,56,10,132,248,158,44,29,247,85,56,10,205,249,249,48,
+10,247,85,56,10,251,96,249,87,46,29,247,85,56,10,252,83,28,251,45,114,29,
+248,59,28,7,248,35,29,247,85,248,169,22,193,80,191,51,100,34,235,29,185,247,
+13,87,247,10,70,207,8,249,56,148,29,14,247,85,248,230,249,39,21,247,4,251,
+141,7,247,221,223,247,140,247,95,247,147,27,222,10,194,247,211,5,190,251,
+50,33,170,251,25,27,252,39,251,192,251,182,251,238,47,31,251,19,251,4,244,
+6,134,102,137,101,102,26,251,183,247,54,251,181,248,44,247,90,247,85,211,
+149,170,30,247,96,10,185,142,185,145,182,31,14,247,85,28,4,213,247,20,29,
+28,4,132,28,5,209,155,29,14,247,85,28,6,203,28,6,86,21,198,83,187,251,6,251,
+115,251,19,251,42,251,97,81,30,160,57,66,151,55,170,29,194,247,211,176,247,
+101,151,196,239,174,25,247,50,251,31,5,196,153,195,199,200,26,14,181,28,4,
+213,248,94,29,251,223,251,146,251,133,251,197,34,31,251,102,6,119,45,5,247,
+96,6,130,101,132,101,135,100,8,251,55,6,118,39,5,247,70,134,6,248,23,10,30,
+247,172,29,251,98,251,54,247,35,247,201,31,167,248,74,7,159,239,5,252,88,
+6,144,179,145,177,147,176,8,248,85,6,159,233,5,252,80,6,247,168,229,247,89,
+247,58,247,101,27,227,198,93,133,148,31,248,81,29,181,250,222,250,62,21,253,
+59,65,6,206,129,170,135,146,126,135,117,25,84,251,169,5,251,16,163,50,232,
+247,63,26,247,206,247,94,247,70,247,108,185,176,127,118,178,30,150,137,148,
+123,129,26,140,251,8,5,240,6,181,247,100,5,176,251,10,59,160,46,27,251,242,
+251,132,251,159,251,191,251,81,246,251,86,247,156,121,31,77,251,211,136,115,
+122,127,118,138,25,66,129,5,65,249,76,7,188,247,137,5,40,6,95,251,30,5,125,
+134,132,131,125,27,251,203,6,208,247,251,5,247,66,6,157,142,131,130,31,123,
+251,0,5,232,6,203,247,225,5,47,6,111,40,5,123,133,134,133,124,27,251,66,6,
+202,247,213,5,247,144,6,154,141,135,126,31,251,13,242,7,14,181,28,4,163,248,
+94,29,252,75,251,195,252,60,252,72,248,23,10,31,247,172,29,122,123,140,141,
+124,31,208,247,224,157,228,247,1,247,32,214,171,25,176,65,5,222,193,148,211,
+181,115,201,65,47,57,80,43,76,31,171,247,47,5,78,6,251,124,91,5,95,7,247,
+21,124,251,5,252,191,5,251,3,204,65,247,25,247,101,26,248,109,247,155,247,
+198,247,175,227,198,93,133,148,30,248,81,29,181,250,229,28,5,15,21,251,3,
+179,59,166,50,147,170,247,44,24,251,12,6,108,251,44,5,252,17,101,251,149,
+252,20,252,31,26,251,137,245,251,133,247,154,84,30,95,251,113,5,247,12,6,
+180,247,101,5,247,60,247,56,207,149,165,31,186,247,208,5,36,6,65,251,115,
+132,122,119,120,126,136,25,135,130,92,111,64,27,127,127,140,140,127,31,247,
+125,28,4,146,205,130,184,105,146,134,25,154,134,156,112,119,26,251,73,241,
+7,253,176,252,96,21,248,34,247,85,247,166,247,121,198,30,251,117,254,254,
+5,251,10,195,60,247,21,247,106,26,14,247,85,28,5,39,28,5,45,21,190,251,50,
+33,170,251,25,247,249,29,225,224,153,155,211,31,64,252,102,247,72,189,247,
+21,249,180,247,116,10,248,109,247,195,247,198,247,206,248,168,10,247,124,
+250,254,247,235,21,57,36,79,94,251,106,27,103,104,141,143,108,31,247,20,247,
+179,174,214,145,174,91,232,25,251,82,247,253,5,248,112,6,247,54,247,65,115,
+200,5,252,222,6,251,218,251,193,5,251,12,251,5,55,251,37,251,82,26,251,87,
+247,52,252,25,248,170,247,14,247,76,176,139,30,247,61,247,164,5,253,88,101,
+21,251,100,208,53,247,59,247,62,26,247,65,157,172,229,237,30,247,128,252,
+96,166,85,127,94,128,111,25,14,248,16,250,236,248,86,21,251,58,111,45,251,
+113,251,99,27,251,78,251,56,247,69,248,74,31,141,247,221,7,247,171,247,17,
+251,27,222,27,236,6,163,168,161,186,205,34,197,251,113,31,253,18,6,247,255,
+158,247,83,247,26,247,54,27,247,59,247,13,251,119,251,9,156,31,247,179,6,
+247,124,114,251,216,247,93,251,151,27,251,172,252,67,251,37,252,188,252,66,
+247,231,251,115,247,231,248,57,247,85,247,124,247,138,166,31,14,247,85,133,
+10,14,86,248,136,250,40,21,247,60,247,13,251,38,251,84,251,199,251,91,251,
+87,251,164,96,103,147,153,103,31,128,145,132,148,147,26,135,247,58,5,38,6,
+88,251,142,5,133,151,247,22,83,247,46,27,248,21,247,160,247,167,247,216,247,
+132,251,76,247,90,251,167,46,55,122,105,251,14,31,91,251,128,5,232,6,184,
+247,9,248,75,10,14,247,85,247,38,10,159,227,27,247,122,247,80,251,27,251,
+199,252,109,251,193,251,187,251,205,40,74,174,247,71,29,14,247,85,133,10,
+252,172,251,23,245,10,247,71,28,5,39,28,5,45,21,190,251,50,33,170,251,25,
+228,10,184,143,182,144,180,31,248,197,6,159,244,5,252,199,6,247,236,217,247,
+142,247,93,247,154,27,248,168,10,247,85,112,10,14,247,85,112,10,42,250,10,
+39,29,119,45,10,14,119,45,10,14,252,22,249,191,28,6,154,134,29,129,28,8,17,
+134,29,119,45,10,247,97,250,70,46,29,119,45,10,138,28,250,232,44,29,119,45,
+10,161,254,111,68,29,119,45,10,251,86,254,224,66,29,119,45,10,251,73,254,
+179,54,10,247,181,45,10,249,31,248,254,78,10,119,250,207,28,5,229,21,247,
+32,29,49,168,75,247,17,184,182,148,163,194,30,137,125,90,251,117,96,51,247,
+180,10,247,113,247,134,184,30,164,247,27,5,102,98,92,129,92,27,120,70,157,
+215,153,31,59,249,11,81,10,119,89,10,14,119,89,10,153,254,190,21,160,247,
+4,5,253,58,6,116,251,4,5,14,140,28,5,53,28,5,39,21,51,6,88,121,92,85,73,27,
+112,113,146,147,110,31,190,247,172,247,106,29,125,63,5,143,121,116,141,123,
+27,251,54,59,251,2,251,19,76,31,227,6,190,157,184,192,205,27,171,184,127,
+127,180,31,111,251,56,5,151,104,82,162,247,0,29,247,50,250,29,247,55,121,
+236,247,19,204,247,21,25,252,201,252,148,21,47,247,136,10,135,31,14,247,170,
+28,4,249,249,201,21,251,252,253,101,77,161,138,194,145,168,25,247,119,28,
+5,23,5,247,32,29,51,189,73,247,17,148,148,139,140,148,30,251,79,252,13,5,
+231,6,247,84,248,23,247,8,157,229,179,164,148,25,217,7,118,133,49,109,72,
+134,248,0,249,111,24,252,231,125,81,10,154,28,5,176,28,5,121,21,196,117,205,
+251,21,251,13,251,72,98,251,56,251,7,30,102,90,112,251,29,119,251,15,133,
+104,24,247,193,29,247,7,246,217,215,210,31,49,166,247,146,29,247,37,249,216,
+166,247,43,161,247,85,247,34,192,248,89,29,253,70,252,244,21,49,252,161,5,
+53,63,37,247,251,29,215,251,1,121,135,31,14,119,250,250,251,238,21,248,3,
+29,152,219,151,213,30,247,162,28,5,247,5,247,32,29,139,98,251,99,76,26,251,
+79,246,251,33,247,103,247,17,214,202,199,30,251,248,28,4,129,81,10,154,248,
+192,10,139,98,251,99,76,26,251,79,246,251,33,247,103,247,17,214,202,199,248,
+3,29,151,219,152,213,30,247,74,250,154,177,247,106,160,247,18,247,24,196,
+248,89,29,196,117,205,251,21,251,13,251,69,96,251,13,51,30,73,48,111,251,
+28,119,251,15,8,104,251,95,81,10,220,28,4,186,247,152,21,209,90,217,47,71,
+84,122,119,76,30,143,164,169,247,64,247,58,250,65,8,247,196,29,252,29,5,247,
+193,29,146,165,139,146,162,31,96,79,100,76,108,77,225,111,24,211,247,21,243,
+247,43,242,225,8,251,13,210,100,247,19,247,58,247,72,240,247,76,30,252,78,
+248,171,21,45,252,165,5,53,65,37,59,248,25,10,193,212,251,2,124,31,247,234,
+252,189,21,49,51,63,51,104,94,169,209,147,143,172,147,188,30,164,195,186,
+172,198,27,194,166,102,94,31,14,119,248,192,10,49,168,75,247,17,223,247,43,
+196,152,248,98,29,71,157,215,152,31,247,125,28,5,53,5,253,79,6,248,92,10,
+146,156,156,158,27,247,185,6,170,146,114,121,136,31,41,252,191,81,10,248,
+144,249,150,249,187,114,10,251,6,253,72,21,61,223,246,77,247,148,10,246,249,
+0,185,29,241,213,205,220,31,249,60,248,148,248,141,10,81,205,178,113,30,243,
+248,231,248,63,10,14,250,15,45,10,28,4,205,247,43,248,217,10,250,15,45,10,
+28,4,205,247,43,57,10,249,173,28,5,50,48,10,248,169,165,10,187,191,220,179,
+180,240,247,0,51,247,17,27,247,25,247,66,247,26,247,57,199,96,206,64,104,
+86,111,90,114,31,247,3,251,17,5,110,118,100,90,82,27,82,73,151,196,63,31,
+251,68,247,128,29,252,68,149,81,10,248,169,165,10,191,187,182,163,139,26,
+214,180,207,139,196,106,92,251,2,110,47,119,251,9,8,227,6,155,217,166,235,
+184,247,2,8,117,182,182,114,188,27,247,66,247,25,240,247,64,204,68,219,69,
+251,35,43,51,251,5,63,31,251,50,247,128,29,247,126,252,193,21,51,118,79,35,
+98,96,168,180,96,30,219,192,192,196,227,27,172,164,110,109,31,253,46,248,
+203,81,10,248,126,28,6,113,250,44,21,38,245,5,94,102,53,94,33,251,56,131,
+202,251,44,27,227,248,146,185,29,247,68,247,46,139,31,115,251,21,5,221,6,
+139,247,35,247,191,247,35,247,48,245,251,23,251,37,251,81,251,70,251,95,251,
+88,83,105,152,180,85,30,82,247,60,5,155,112,104,145,115,27,61,84,78,57,251,
+50,247,97,96,247,84,247,167,247,223,247,78,247,198,247,125,251,53,247,29,
+251,105,149,31,247,193,248,56,21,252,138,252,74,223,248,105,5,231,190,76,
+227,27,209,182,145,165,213,31,253,1,123,81,10,247,240,249,150,249,187,114,
+10,251,6,253,52,21,38,143,204,80,247,56,247,82,29,247,117,28,4,253,185,29,
+247,4,223,215,210,31,14,86,104,10,86,104,10,252,27,249,115,250,241,21,247,
+124,251,179,237,245,26,195,202,153,186,181,161,131,108,168,30,144,41,5,129,
+150,165,134,153,27,193,178,185,181,194,58,217,251,36,39,251,23,79,32,72,219,
+79,210,64,31,251,58,83,251,65,34,251,90,26,251,31,247,3,84,247,17,247,35,
+247,92,247,17,247,114,30,251,26,128,21,251,35,47,251,30,251,5,72,100,186,
+240,247,38,247,18,247,9,247,4,187,30,180,89,171,81,69,26,14,252,60,249,140,
+28,6,57,21,114,190,251,49,81,59,243,251,64,116,133,102,241,115,186,79,251,
+67,77,163,84,247,78,209,150,116,169,81,157,95,25,149,119,119,147,116,27,251,
+93,251,33,251,76,251,95,251,38,236,50,247,31,247,148,227,247,122,247,38,247,
+22,75,247,51,77,241,31,135,252,30,21,251,38,70,251,62,251,20,80,79,194,247,
+20,247,32,203,247,81,247,50,170,160,130,129,154,30,155,88,150,90,62,26,14,
+247,169,46,10,14,251,96,250,108,28,5,15,21,247,125,251,74,220,251,134,30,
+251,210,88,6,213,247,242,10,251,30,253,41,135,125,134,131,121,138,25,57,133,
+5,87,247,205,7,247,233,247,127,247,100,247,194,31,251,36,150,21,251,126,251,
+31,251,112,251,161,136,30,42,6,247,38,249,79,5,187,6,247,57,134,247,38,107,
+251,97,26,14,170,247,141,10,251,54,253,129,247,170,29,251,95,154,21,251,163,
+251,49,251,150,251,210,30,41,6,247,62,249,183,248,138,10,31,14,247,169,46,
+10,247,19,250,131,48,10,247,169,46,10,251,35,249,225,46,29,247,169,46,10,
+251,213,28,250,171,44,29,247,169,46,10,251,190,254,172,68,29,247,169,46,10,
+252,150,28,251,119,66,29,247,169,46,10,252,137,254,240,54,10,247,169,75,10,
+247,169,75,10,170,247,141,10,71,251,206,5,251,61,251,0,247,37,6,69,251,219,
+247,170,29,252,110,251,52,21,247,0,251,96,7,211,247,233,248,138,10,251,163,
+251,49,251,150,251,210,31,41,6,214,247,246,5,14,247,200,28,5,88,249,230,21,
+248,25,251,173,247,27,252,8,30,252,60,6,247,82,10,251,107,254,226,135,115,
+129,248,41,10,248,117,7,248,161,248,32,29,252,4,252,50,134,30,251,41,6,247,
+119,28,4,142,5,211,6,247,146,131,247,117,85,251,234,26,14,247,58,249,90,249,
+46,21,197,192,136,132,175,31,33,252,190,5,137,113,73,135,69,27,251,72,251,
+8,233,247,38,247,149,247,56,212,247,145,31,247,57,218,21,144,75,106,144,57,
+27,251,204,251,215,35,251,217,251,59,247,20,251,51,248,56,31,248,151,225,
+6,248,151,10,247,105,250,226,144,166,148,151,166,141,25,247,23,149,5,225,
+254,89,7,76,251,211,5,247,4,6,211,247,78,5,159,147,154,156,153,27,248,29,
+6,170,147,114,121,135,31,14,28,4,164,46,10,28,4,156,229,248,217,10,28,4,164,
+46,10,28,4,156,229,57,10,249,141,28,5,50,48,10,28,5,150,46,10,28,5,197,248,
+142,248,210,10,28,5,150,46,10,28,5,197,248,142,80,29,121,248,229,48,10,158,
+195,248,50,21,251,167,87,247,64,251,31,247,252,27,248,135,227,6,251,12,147,
+110,141,131,164,142,155,25,247,108,250,220,247,28,29,247,117,22,248,72,29,
+251,19,253,28,5,139,86,135,89,251,142,69,247,18,247,82,175,30,14,249,45,249,
+150,213,21,78,192,228,103,247,7,27,247,80,247,144,247,30,247,96,178,31,164,
+247,16,248,133,10,247,11,149,5,247,56,29,110,251,38,5,251,7,117,251,0,67,
+46,27,251,31,97,205,247,30,165,31,247,72,250,45,247,28,29,251,167,87,247,
+60,251,41,247,226,27,228,237,163,199,216,31,252,125,247,232,21,248,72,29,
+251,15,253,6,5,121,106,85,121,89,27,251,113,70,247,28,247,82,175,31,14,247,
+104,247,104,29,247,169,28,5,57,249,230,219,29,252,9,252,50,30,251,41,6,247,
+161,10,117,119,137,134,118,31,175,247,76,248,138,29,31,252,207,247,19,247,
+228,10,247,3,248,210,5,142,150,152,140,151,27,14,250,90,249,201,245,21,247,
+181,10,250,104,252,58,247,13,10,247,117,28,4,142,247,213,10,14,250,90,28,
+7,234,249,230,247,13,10,247,161,10,113,119,136,134,122,31,175,247,77,247,
+213,10,251,247,22,247,181,10,103,251,77,5,144,123,120,142,113,27,251,138,
+251,42,251,152,251,109,251,70,247,5,251,15,247,50,153,151,139,140,151,31,
+112,236,21,49,107,223,236,247,31,218,247,152,247,56,151,151,138,136,150,31,
+251,2,252,210,5,138,123,123,138,125,27,248,35,248,216,247,228,10,247,2,248,
+209,5,143,154,152,140,148,27,14,247,204,28,5,74,249,70,21,248,109,229,251,
+166,247,103,252,58,27,252,153,6,122,51,243,131,167,137,151,248,152,10,118,
+116,111,137,25,251,0,131,123,51,5,248,193,6,248,140,247,148,247,224,247,250,
+207,31,253,170,248,222,21,247,45,6,247,209,248,24,29,251,201,247,118,10,247,
+142,252,165,21,247,98,178,62,247,36,251,116,27,131,248,153,10,138,251,98,
+98,251,107,25,93,251,133,251,28,251,73,251,223,132,248,28,29,251,60,117,21,
+110,251,49,72,251,1,251,34,136,241,248,170,24,247,37,118,157,32,112,251,29,
+8,14,250,142,28,4,209,22,248,139,247,148,247,224,247,250,207,31,248,109,229,
+251,166,247,103,252,57,27,252,169,6,252,57,251,249,251,103,252,109,49,31,
+251,250,71,247,22,251,224,248,140,27,199,237,21,251,200,251,63,247,58,248,
+58,219,31,248,66,221,247,128,247,52,247,208,27,247,45,6,124,64,252,75,149,
+251,79,251,70,75,251,233,25,67,252,8,247,63,251,38,248,31,137,125,65,24,248,
+64,28,4,154,21,247,45,6,247,208,248,24,29,251,200,247,118,10,253,33,252,165,
+21,251,135,92,247,13,251,9,247,97,27,141,6,125,68,251,219,146,72,247,73,185,
+247,133,25,180,247,107,216,247,98,248,29,143,125,65,24,140,132,132,139,131,
+27,251,116,251,23,251,36,251,98,100,31,250,27,22,247,98,178,62,247,36,251,
+117,27,132,248,153,10,137,251,98,98,251,107,25,93,251,132,251,28,251,73,251,
+222,131,248,28,29,251,61,117,21,110,251,49,72,251,1,251,33,136,241,248,170,
+24,247,37,118,156,32,112,251,29,8,252,211,22,166,247,29,196,246,247,45,160,
+37,252,170,24,251,31,142,114,247,1,168,247,49,8,14,248,96,247,87,249,82,21,
+218,230,247,39,189,247,37,27,151,150,138,138,150,31,82,66,92,54,97,46,92,
+36,112,251,10,111,38,8,171,104,100,162,91,27,251,12,67,67,40,40,220,85,203,
+229,197,172,218,192,31,77,186,201,84,237,27,247,214,247,25,247,103,247,208,
+247,79,251,17,247,14,251,58,188,31,202,208,214,193,231,174,102,186,24,251,
+13,104,43,75,59,54,8,142,114,114,141,113,27,251,60,251,34,84,45,251,8,31,
+248,48,251,113,21,177,246,185,235,199,220,8,247,27,86,196,251,22,251,12,26,
+251,165,71,251,94,251,114,67,90,203,206,87,30,130,151,179,222,181,247,7,193,
+247,45,25,248,82,253,212,21,208,247,59,149,212,175,247,6,8,103,155,218,121,
+202,27,247,25,221,206,247,5,247,2,40,197,41,251,41,73,85,41,107,31,83,251,
+64,118,251,49,66,251,55,8,247,140,248,106,21,202,196,191,209,209,196,87,76,
+76,82,87,69,69,82,191,202,30,254,53,245,21,181,171,98,89,173,31,48,108,101,
+77,73,27,91,101,189,196,220,178,195,213,31,14,251,100,34,29,14,252,103,248,
+66,162,21,174,101,227,251,15,251,83,251,52,251,95,251,86,251,79,247,22,102,
+220,247,14,238,210,184,189,30,216,7,61,41,70,98,79,27,62,90,204,229,154,141,
+164,142,156,31,247,50,147,247,112,209,247,26,26,251,10,140,21,52,251,33,69,
+251,5,129,30,232,162,210,247,31,227,27,183,167,106,107,31,14,252,155,249,
+29,28,4,242,173,29,73,28,6,105,173,29,251,100,34,29,247,68,247,213,42,10,
+251,100,34,29,247,177,247,213,49,29,251,100,34,29,247,175,247,213,72,29,247,
+62,249,63,35,29,251,100,34,29,247,175,247,213,248,208,10,251,100,34,29,247,
+175,247,213,72,29,247,159,249,67,35,10,251,100,34,29,247,175,247,213,248,
+215,29,251,100,34,29,251,93,254,224,72,10,248,120,28,5,141,44,29,251,100,
+34,29,247,131,248,15,58,10,251,100,34,29,247,203,248,252,57,29,251,100,34,
+29,247,191,248,201,80,10,251,100,34,29,247,248,249,48,48,10,251,100,34,29,
+247,255,248,244,35,10,251,100,34,29,247,176,248,164,68,29,251,100,34,29,247,
+176,248,164,248,201,10,251,100,34,29,247,176,248,164,248,198,10,251,100,34,
+29,247,226,248,142,39,29,251,100,34,29,225,248,142,46,29,251,100,34,29,247,
+39,248,254,37,10,251,100,34,29,131,28,250,232,44,29,251,100,34,29,218,254,
+105,68,10,251,100,34,29,251,93,254,224,66,29,234,249,234,249,185,247,179,
+10,247,39,247,19,213,206,223,30,67,149,175,70,235,27,237,247,22,247,9,215,
+197,31,247,21,7,251,29,251,4,48,77,84,27,72,94,194,247,16,31,159,216,29,14,
+251,100,34,29,46,254,160,51,10,251,100,34,29,247,203,248,252,69,10,252,40,
+28,249,140,51,10,251,100,248,205,251,203,21,248,115,10,247,4,247,19,247,31,
+215,31,251,89,83,5,247,231,10,247,195,28,4,209,141,29,251,100,250,197,154,
+10,223,248,44,5,34,6,57,252,33,148,10,251,111,28,4,115,141,29,251,100,34,
+29,247,162,247,164,247,184,10,176,247,212,248,83,100,29,176,248,155,252,35,
+21,248,117,10,156,163,208,214,231,30,127,138,110,123,121,136,8,55,70,54,48,
+117,248,104,10,69,88,139,30,251,70,249,181,100,29,251,100,76,10,251,100,76,
+10,251,100,76,10,252,173,248,46,61,21,247,79,251,22,176,58,251,14,40,69,93,
+91,30,63,7,218,234,209,179,198,27,217,188,73,49,124,137,114,135,124,31,251,
+50,130,251,110,70,251,27,26,104,176,50,247,15,247,82,247,53,247,96,247,85,
+30,251,32,251,0,21,46,116,68,251,31,51,27,95,111,172,172,227,247,33,207,247,
+5,149,31,14,252,155,249,31,28,4,141,21,247,81,251,23,176,57,251,13,39,67,
+96,92,30,61,7,217,235,209,180,198,27,215,188,73,49,125,137,114,137,123,31,
+251,50,131,251,113,67,251,25,26,102,178,53,247,15,247,80,247,56,247,95,247,
+84,30,251,33,33,21,45,116,68,251,32,51,27,96,110,174,172,225,247,33,209,247,
+5,149,31,14,251,100,136,10,247,162,249,236,39,29,112,28,4,163,248,12,29,163,
+194,247,60,247,39,247,134,152,247,80,31,247,67,151,48,185,251,95,27,114,61,
+247,66,151,155,67,130,33,25,123,251,83,251,34,251,119,251,63,26,251,5,233,
+248,149,10,252,0,250,95,142,10,14,150,28,4,205,249,121,21,75,184,113,78,5,
+90,116,117,84,79,27,78,147,204,201,151,31,170,247,51,84,176,92,113,65,100,
+41,81,25,247,46,63,251,38,176,82,27,251,68,251,23,251,9,59,59,31,251,21,7,
+247,25,247,39,227,209,228,27,214,201,75,43,169,31,251,182,251,39,251,140,
+251,122,251,56,26,39,190,251,5,247,72,247,208,247,96,247,214,247,213,187,
+133,180,131,182,30,196,171,189,166,182,164,8,135,126,114,68,71,26,69,164,
+76,231,247,29,188,247,9,214,170,30,253,19,45,21,251,52,145,73,252,51,251,
+111,27,74,106,208,195,247,57,247,62,247,67,247,99,247,2,31,14,64,250,80,248,
+250,21,247,118,251,27,247,64,251,125,251,158,251,112,251,23,251,159,251,17,
+247,13,82,247,1,141,30,247,45,141,197,164,247,90,247,6,8,251,88,109,36,251,
+185,251,117,27,251,27,251,23,211,247,0,59,31,114,251,17,5,251,10,219,247,
+17,91,247,29,27,247,234,247,152,247,202,247,221,31,251,103,203,21,55,251,
+33,49,104,43,27,108,53,162,214,247,36,247,11,247,11,247,33,247,25,182,251,
+38,43,147,31,14,251,131,249,234,249,246,116,29,252,176,249,46,28,5,25,21,
+175,94,189,34,30,98,6,251,17,251,29,65,34,74,180,102,194,114,31,55,127,35,
+100,251,15,26,35,231,102,247,44,247,12,247,3,211,151,155,30,219,7,112,105,
+48,61,251,6,27,69,88,168,203,218,194,185,225,31,139,174,141,174,137,30,198,
+7,92,67,147,221,223,194,194,217,143,31,154,123,184,82,167,102,8,223,149,156,
+172,172,26,14,251,131,250,175,154,10,212,247,249,5,34,6,68,251,238,148,10,
+251,89,28,4,176,116,29,251,110,249,193,249,168,123,10,252,164,249,23,28,4,
+234,21,214,61,198,251,12,42,251,46,109,251,0,109,170,113,167,182,165,160,
+144,144,30,149,227,5,142,142,164,169,190,27,192,184,106,82,33,47,92,56,136,
+31,91,172,7,188,199,132,71,42,60,87,54,68,77,172,212,70,31,60,7,85,192,195,
+109,219,27,247,38,247,55,188,247,45,203,92,175,47,152,31,235,171,212,202,
+217,26,14,251,110,247,249,154,10,210,247,240,62,247,29,42,252,110,148,10,
+248,92,250,246,123,10,127,28,4,211,249,171,21,88,177,5,72,108,106,51,66,27,
+83,131,196,205,151,31,170,247,53,88,172,251,79,251,4,5,218,96,37,193,251,
+27,27,248,14,10,31,197,29,247,19,184,247,41,247,2,121,247,48,247,21,217,24,
+112,251,29,5,63,125,180,57,221,27,247,21,192,247,11,217,170,31,14,251,131,
+249,100,247,164,21,247,1,56,202,55,178,30,247,21,162,247,34,204,247,95,26,
+247,64,251,38,205,251,124,251,35,251,55,36,120,113,30,251,23,7,182,192,247,
+19,242,247,30,27,246,221,78,55,251,27,45,63,251,15,31,52,42,6,209,137,247,
+23,125,251,27,26,251,31,45,46,251,33,131,30,251,27,247,77,5,251,17,140,110,
+66,86,26,75,219,57,247,51,30,201,6,247,104,247,105,247,15,247,66,31,14,252,
+176,248,219,250,72,21,205,85,176,84,163,30,223,153,232,178,247,13,26,243,
+44,178,251,43,46,33,77,128,122,30,60,7,165,174,221,201,229,27,208,193,102,
+89,58,78,93,59,31,82,81,6,185,138,224,131,58,26,55,78,83,47,135,30,51,247,
+3,5,58,120,95,108,100,191,90,242,31,180,6,247,30,247,30,213,243,31,14,68,
+250,85,249,48,21,247,90,36,247,38,251,183,251,68,251,125,251,13,251,72,63,
+178,53,247,19,88,30,251,87,112,251,7,39,251,56,26,251,38,247,7,53,247,154,
+247,251,247,103,248,13,247,208,30,251,36,118,21,251,133,251,52,251,228,251,
+141,50,49,196,247,7,247,51,247,11,182,247,7,30,219,219,6,251,7,141,71,184,
+247,3,26,247,35,234,247,1,247,17,247,21,247,0,55,251,95,30,14,74,250,93,249,
+158,21,247,52,251,54,213,251,31,252,19,251,111,251,185,252,3,251,113,247,
+4,251,48,247,126,247,105,247,166,223,247,152,247,15,45,180,251,1,154,30,247,
+5,180,247,52,243,247,27,26,251,93,145,21,251,47,251,29,36,251,40,137,30,57,
+7,236,247,14,150,251,23,251,30,251,23,251,6,251,25,251,58,66,247,60,247,33,
+247,121,247,45,247,218,247,158,232,196,82,46,31,14,251,82,247,67,249,183,
+21,73,251,52,247,0,49,247,17,104,251,11,133,251,24,86,85,251,23,8,251,167,
+251,3,247,141,61,247,115,27,247,1,247,4,160,170,247,8,31,186,247,123,5,41,
+6,93,251,7,5,88,117,251,57,113,104,27,251,50,38,227,247,62,207,31,243,183,
+247,4,172,231,27,172,170,137,133,162,31,160,245,98,137,251,37,133,48,219,
+203,247,49,25,242,181,235,170,227,27,188,247,13,106,84,140,31,138,251,11,
+5,236,6,184,247,115,5,188,39,39,164,251,23,27,251,19,251,103,85,251,47,77,
+31,14,251,82,109,29,14,251,82,109,29,191,248,146,39,29,251,82,161,29,238,
+110,235,119,241,136,25,184,82,174,60,105,48,235,29,180,247,2,101,246,80,209,
+8,247,94,158,247,106,228,247,132,26,247,23,251,2,192,251,9,145,30,248,43,
+10,14,32,248,196,247,1,21,121,50,213,107,195,130,8,102,106,76,69,118,202,
+29,155,166,196,151,165,30,226,150,247,18,190,170,150,137,211,24,247,197,29,
+159,239,172,247,56,251,34,203,251,9,145,25,203,29,247,19,98,251,31,110,31,
+14,247,139,28,4,220,248,187,21,251,80,6,77,251,213,5,42,122,95,94,56,27,66,
+117,172,247,69,171,31,168,247,52,251,30,193,251,9,145,8,203,29,247,21,116,
+251,85,99,31,251,85,99,196,62,247,96,27,247,41,247,82,208,247,102,180,31,
+14,185,32,10,14,251,247,250,11,28,6,73,21,253,24,88,6,247,163,29,249,45,7,
+184,247,96,5,57,6,98,251,10,5,124,134,129,129,121,27,251,205,6,208,247,228,
+5,247,72,6,158,148,130,124,136,31,126,51,5,215,6,197,247,173,5,65,6,114,57,
+5,122,133,130,133,120,27,251,70,6,200,247,194,5,247,147,6,160,144,133,122,
+31,39,224,7,14,251,51,250,68,250,111,21,253,179,61,6,217,247,242,29,251,52,
+253,111,248,116,29,249,199,7,187,10,14,185,32,10,251,76,248,97,42,10,185,
+32,10,104,248,97,49,29,185,32,10,102,248,97,72,29,247,62,249,63,35,29,185,
+32,10,102,248,97,248,208,10,185,32,10,102,248,97,72,29,247,159,249,67,35,
+10,185,32,10,102,248,97,248,215,29,185,32,10,252,241,28,250,176,72,10,248,
+204,28,7,29,44,29,185,32,10,58,248,155,58,10,185,32,10,130,249,136,57,29,
+185,32,10,133,249,105,78,29,185,32,10,175,249,188,48,10,185,32,10,182,249,
+128,35,10,185,32,10,103,249,48,68,29,185,32,10,103,249,48,248,201,10,185,
+32,10,103,249,48,248,198,10,185,32,10,113,249,26,39,29,185,32,10,251,126,
+249,26,46,29,185,32,10,251,65,249,138,37,10,185,32,10,252,48,28,249,228,44,
+29,185,32,10,251,217,28,251,39,68,10,185,32,10,252,241,28,250,176,66,29,185,
+32,10,252,94,28,250,240,51,10,185,32,10,252,94,28,250,240,114,29,248,85,28,
+8,4,57,29,185,32,10,251,197,254,191,69,29,185,28,4,143,247,20,29,250,219,
+28,6,2,117,29,14,251,51,108,22,249,179,217,6,61,149,102,143,131,153,143,162,
+25,247,52,249,111,143,164,159,151,164,141,25,225,149,5,217,253,199,7,81,251,
+150,5,247,9,6,190,247,37,5,154,145,147,147,156,27,248,2,6,58,252,13,5,251,
+97,6,118,135,147,149,31,158,247,5,5,251,1,6,63,251,242,5,247,1,6,172,243,
+5,156,145,145,145,157,27,247,97,6,65,251,230,5,251,189,6,121,137,143,153,
+31,247,19,251,13,7,14,248,130,28,5,131,247,36,89,29,248,130,248,229,237,21,
+193,81,241,89,174,56,62,251,219,25,247,36,6,201,247,220,181,215,247,64,195,
+189,197,24,247,126,185,89,29,200,247,184,247,167,29,80,251,197,248,162,29,
+201,247,60,5,159,145,159,158,158,27,248,71,6,42,252,146,5,251,193,6,120,125,
+159,154,142,31,145,247,33,5,37,6,52,252,93,5,241,6,187,247,33,5,154,142,162,
+161,156,27,247,193,6,32,252,199,5,252,144,6,122,126,164,153,140,31,141,247,
+95,5,32,6,74,251,234,5,250,180,227,6,38,147,110,141,128,248,6,10,159,162,
+168,141,25,244,147,5,227,7,14,192,247,42,28,5,80,21,251,32,249,70,252,106,
+253,50,251,32,249,50,252,106,253,70,251,32,249,230,28,5,80,7,14,192,247,89,
+251,77,21,242,98,224,247,118,5,248,251,28,5,80,40,6,214,247,88,33,178,50,
+251,127,5,253,11,251,32,248,214,6,251,70,252,106,5,252,16,251,32,247,219,
+6,251,69,252,106,5,251,62,251,32,247,9,6,248,209,248,246,21,252,106,252,38,
+7,247,71,248,106,5,192,247,32,21,247,62,248,84,5,252,84,7,14,251,241,247,
+197,28,6,73,21,100,251,75,5,218,6,179,240,5,151,143,152,151,152,27,247,174,
+6,76,251,198,5,251,87,6,126,130,151,148,141,31,143,223,5,73,6,82,251,166,
+5,206,6,170,224,5,148,141,154,152,150,27,247,87,6,70,251,230,5,251,222,6,
+128,130,154,147,140,31,140,247,14,5,69,6,97,251,97,5,249,67,192,6,73,144,
+120,140,132,153,141,151,25,247,28,249,35,141,151,152,153,158,140,25,207,144,
+5,191,7,14,247,26,28,4,170,250,5,21,248,27,251,214,247,27,251,78,251,138,
+39,69,251,47,251,62,30,251,50,7,247,5,247,29,247,44,247,45,247,82,27,247,
+87,247,17,251,101,251,103,105,137,110,135,106,31,253,21,137,251,171,251,68,
+251,218,26,62,217,251,118,247,205,248,152,247,136,248,87,248,99,30,251,140,
+251,114,21,251,201,67,251,70,251,166,251,113,27,53,41,247,0,223,247,101,247,
+52,247,70,248,131,143,31,14,247,124,122,10,14,247,124,122,10,249,210,28,4,
+130,39,29,156,28,4,121,28,4,141,21,247,81,251,83,192,251,103,251,156,251,
+119,251,62,251,142,251,19,227,61,247,27,84,30,251,52,117,251,166,50,251,209,
+26,251,136,247,103,51,247,160,247,107,247,140,247,1,247,37,194,104,178,63,
+117,100,127,135,125,30,44,251,64,5,100,84,84,125,90,27,251,29,251,28,235,
+247,54,247,101,247,50,247,2,247,85,165,192,133,135,178,31,164,247,25,5,137,
+106,117,139,126,27,251,0,251,5,180,247,44,247,64,247,15,247,47,247,62,145,
+151,137,129,160,31,227,251,125,5,139,166,96,202,244,194,225,214,30,14,164,
+160,247,107,21,251,3,120,247,42,251,29,247,159,27,247,255,247,92,247,58,247,
+152,185,31,176,247,105,251,49,247,1,251,92,149,247,123,207,239,247,14,164,
+247,32,8,247,115,178,251,51,247,21,251,143,27,251,179,251,63,251,1,251,57,
+110,31,50,124,210,105,185,27,187,178,169,141,145,31,174,247,87,5,147,153,
+210,194,247,1,27,247,36,235,43,251,68,108,31,251,62,109,251,9,45,251,79,27,
+108,117,141,139,31,117,251,13,5,145,186,145,199,27,247,33,247,53,86,251,101,
+102,31,251,66,108,251,37,251,37,251,113,27,69,98,163,172,95,31,104,247,80,
+5,154,122,110,137,121,27,57,95,79,86,129,31,14,160,247,139,250,246,21,55,
+251,109,247,68,251,23,247,56,88,251,56,129,251,92,53,71,251,73,8,251,244,
+251,27,247,189,251,19,247,187,27,247,34,247,20,168,182,247,40,31,200,247,
+213,5,251,16,6,77,251,78,5,65,113,251,94,102,90,27,251,103,251,37,247,56,
+247,111,223,31,247,46,197,247,51,192,247,23,27,176,188,139,131,172,31,163,
+247,13,75,137,251,84,133,251,33,247,19,219,247,101,25,247,29,191,247,37,211,
+247,19,27,207,247,39,89,66,138,31,135,251,79,5,247,15,6,195,247,204,5,208,
+251,18,251,15,172,251,60,27,251,66,251,135,59,251,97,61,31,14,160,91,10,14,
+160,91,10,94,248,227,39,29,160,131,10,247,21,98,247,5,110,247,28,137,25,181,
+82,169,64,107,52,235,29,179,245,105,242,83,209,8,247,161,164,247,169,247,
+26,247,207,26,247,73,251,58,225,251,54,149,30,248,5,29,14,180,250,140,248,
+46,21,173,247,70,251,72,247,16,251,76,150,189,29,247,53,247,36,47,251,43,
+106,31,112,251,15,121,53,129,91,129,91,127,88,126,85,8,247,68,247,1,251,21,
+251,183,82,31,241,6,239,248,144,251,48,147,110,143,131,162,141,155,25,14,
+249,111,28,5,146,249,13,21,74,251,228,5,251,7,117,41,57,46,27,251,31,115,
+200,247,110,163,31,166,247,138,251,80,227,251,54,149,189,29,247,23,247,54,
+87,251,124,108,31,251,203,98,231,48,247,139,27,247,80,247,134,247,40,247,
+96,178,31,200,247,206,248,133,10,247,11,149,5,247,56,29,14,253,49,249,82,
+28,6,78,21,167,107,187,49,251,75,59,251,95,251,21,113,30,251,7,102,137,92,
+241,147,113,251,52,125,251,37,116,251,9,25,116,251,7,111,51,92,88,251,27,
+172,24,118,125,125,124,107,26,126,155,90,207,247,25,247,13,247,50,247,29,
+173,30,164,229,186,247,220,147,194,8,247,70,201,251,57,6,149,202,178,247,
+64,194,182,243,61,24,189,147,173,160,178,26,14,252,74,75,29,251,51,247,203,
+46,29,251,126,249,154,224,21,252,161,6,126,54,5,248,52,6,92,251,132,111,29,
+247,86,28,6,75,135,10,14,252,74,75,29,251,100,253,162,35,10,252,74,250,27,
+28,5,102,21,248,30,29,136,121,5,251,95,251,5,247,75,6,124,41,5,251,101,251,
+5,247,85,6,115,251,74,119,251,57,114,251,30,107,251,82,92,241,10,163,238,
+179,247,161,167,247,91,8,247,141,247,5,251,125,6,152,237,5,247,153,247,5,
+251,132,6,153,243,196,248,166,29,248,236,250,27,28,5,102,186,10,248,55,6,
+251,62,253,214,193,10,247,14,247,204,10,63,5,251,128,6,153,243,196,248,166,
+29,252,74,157,29,14,252,74,157,29,251,153,248,7,46,29,252,74,249,122,250,
+199,21,242,251,126,7,168,241,174,225,181,174,247,52,251,21,24,248,106,10,
+187,90,218,251,31,251,86,251,12,251,52,251,63,71,30,251,131,36,247,96,6,127,
+96,129,98,133,102,71,252,26,118,251,137,105,251,84,106,251,82,93,248,189,
+29,212,248,180,152,232,150,213,153,224,158,221,8,14,252,74,249,74,250,39,
+21,92,230,251,90,38,171,247,88,195,247,128,216,203,25,247,52,251,21,5,248,
+106,10,248,29,10,129,85,131,88,131,91,251,153,251,25,24,184,49,247,89,239,
+104,251,130,121,251,63,114,251,34,25,106,251,82,93,241,10,171,247,26,200,
+248,72,162,247,59,8,14,251,98,131,29,14,251,98,131,29,177,248,236,35,29,251,
+226,249,193,28,4,164,21,55,6,76,251,68,5,124,135,114,129,127,27,251,155,6,
+251,201,78,5,77,7,247,68,121,251,58,253,226,5,247,84,6,247,65,250,13,5,247,
+220,6,14,251,98,247,2,10,251,41,241,59,247,21,121,30,102,108,76,67,117,108,
+173,247,232,29,94,156,163,26,156,163,192,154,165,30,247,64,144,247,27,225,
+247,6,247,25,43,182,24,247,102,10,14,251,98,247,183,10,247,71,247,29,225,
+247,30,247,8,173,10,251,98,247,183,10,247,18,245,182,213,231,30,88,251,108,
+32,251,88,56,101,247,234,29,247,21,247,187,248,9,230,173,10,251,63,250,76,
+250,111,21,253,217,61,6,247,19,129,173,137,148,123,135,116,25,251,48,253,
+111,248,130,10,32,129,5,61,248,150,217,248,108,10,207,247,214,5,247,85,6,
+247,112,29,251,82,6,212,247,246,5,247,161,6,159,149,125,124,31,251,25,247,
+11,7,14,95,120,10,251,150,249,49,46,29,181,249,228,248,184,21,159,239,5,252,
+61,6,161,247,7,5,248,59,6,159,239,5,252,60,6,218,248,45,247,135,10,136,147,
+124,135,116,25,67,252,10,5,251,94,6,119,39,5,247,94,6,117,251,7,5,251,92,
+6,119,39,5,247,93,6,59,252,49,247,57,10,248,183,225,7,251,25,149,104,247,
+203,29,218,248,49,5,14,95,28,4,141,28,5,94,21,254,94,53,6,247,6,129,176,247,
+166,29,251,142,28,250,242,247,38,29,247,152,111,10,251,154,6,239,247,116,
+29,14,95,194,249,21,21,247,72,6,251,27,253,78,247,38,29,247,172,111,10,251,
+175,6,240,248,163,247,135,10,247,166,29,44,252,128,5,251,92,6,14,128,247,
+170,250,173,21,203,247,80,5,159,147,154,156,158,27,248,63,6,37,252,169,5,
+251,198,6,120,127,162,153,140,31,148,247,36,5,39,6,51,252,97,5,239,6,185,
+247,35,5,153,143,162,162,156,27,247,198,6,43,252,136,136,119,121,116,110,
+137,25,251,28,131,123,51,5,248,163,6,155,227,35,147,111,141,130,248,6,10,
+157,162,167,141,25,247,17,147,156,227,5,254,100,6,77,251,217,5,14,123,194,
+10,14,172,250,205,250,181,21,98,247,244,5,254,127,108,6,247,19,221,96,251,
+8,31,254,169,7,47,251,11,88,49,30,108,248,252,170,7,49,251,11,190,231,31,
+250,191,7,207,180,169,191,30,247,150,6,247,60,186,251,17,251,49,182,31,14,
+251,28,248,54,217,21,247,176,29,5,166,145,158,157,165,27,247,226,248,64,10,
+195,247,131,5,254,23,61,6,235,129,174,135,150,125,134,116,25,251,50,253,111,
+135,114,121,128,112,136,25,43,129,5,61,248,109,7,14,123,194,10,54,249,194,
+35,29,251,8,28,4,131,28,6,111,21,33,6,57,251,132,5,121,133,110,124,122,27,
+253,92,248,91,29,251,109,254,220,247,200,10,248,199,227,7,251,23,147,110,
+141,131,164,141,155,25,247,115,250,255,5,248,146,6,14,123,247,65,10,215,248,
+66,29,248,144,33,147,110,143,131,162,141,155,25,247,115,250,255,248,167,29,
+123,28,4,176,247,167,29,247,37,10,248,179,247,30,29,14,123,248,40,22,90,251,
+117,86,45,53,100,247,234,29,243,247,119,247,134,182,30,247,30,29,213,248,
+13,5,247,37,10,7,14,252,147,249,130,28,5,23,21,196,251,75,7,145,123,88,164,
+73,27,251,60,39,251,15,251,11,59,194,94,209,110,31,102,107,114,65,148,102,
+8,42,108,59,84,55,26,45,223,67,247,66,247,60,247,58,219,243,211,84,170,57,
+172,30,251,68,212,135,154,145,176,151,161,25,162,6,247,50,247,0,247,1,247,
+19,171,129,172,131,158,31,44,253,7,21,98,90,77,251,19,251,4,83,211,196,189,
+164,190,223,157,30,247,60,70,5,190,118,155,113,110,26,123,248,185,21,61,86,
+251,11,49,92,110,184,199,247,6,219,231,202,193,161,86,78,30,14,251,88,38,
+29,247,148,28,6,55,35,29,251,88,38,29,247,165,28,5,28,44,29,251,88,38,29,
+247,193,28,6,67,57,29,251,88,38,29,247,238,28,6,119,48,10,251,88,38,29,247,
+166,28,5,235,68,29,251,88,38,29,215,28,5,213,46,29,251,88,38,29,251,61,28,
+5,151,247,49,10,89,250,166,251,105,21,242,59,7,126,238,59,184,251,6,191,251,
+166,247,17,24,132,161,150,199,157,180,8,248,54,10,247,80,235,251,170,6,154,
+114,59,178,41,27,251,152,251,46,251,99,251,91,251,23,221,63,247,1,92,31,83,
+84,103,251,13,151,76,251,20,96,32,66,110,32,8,46,36,227,6,251,30,160,247,
+17,251,10,247,136,27,247,115,247,113,247,5,247,35,198,31,251,90,250,72,247,
+154,29,251,144,254,234,21,251,22,61,221,219,108,31,248,144,6,70,119,58,46,
+251,60,27,53,248,74,21,247,148,251,8,178,121,164,121,155,118,25,252,139,6,
+146,213,181,209,247,10,168,8,14,251,77,250,136,249,89,21,122,233,251,60,109,
+134,175,130,170,131,161,25,247,80,235,251,170,6,154,114,59,178,41,27,251,
+134,251,43,251,72,251,77,120,31,251,6,119,153,48,241,156,158,40,213,77,233,
+99,25,243,10,247,115,247,87,247,7,247,120,162,31,251,63,253,237,247,94,10,
+251,33,250,230,21,219,177,52,40,140,31,251,220,82,5,247,33,172,235,241,219,
+27,35,252,152,21,67,94,210,238,31,145,7,247,220,195,5,251,5,111,63,251,11,
+32,27,14,189,250,214,250,136,108,29,251,244,249,163,28,5,112,21,99,6,46,91,
+5,167,109,93,159,96,27,251,130,251,67,251,84,251,104,251,12,200,41,247,33,
+220,215,179,179,206,31,251,31,109,93,251,38,251,71,27,116,94,160,153,122,
+31,116,242,5,144,130,126,140,129,27,86,102,91,94,47,247,44,119,210,247,80,
+247,38,247,3,247,64,177,31,120,248,129,21,57,252,19,5,115,95,87,121,88,27,
+34,92,211,228,247,36,237,247,65,247,67,178,186,113,112,161,31,14,248,13,28,
+5,94,247,32,10,251,160,250,185,108,29,189,250,234,250,240,21,177,247,85,216,
+223,204,171,247,54,251,27,24,153,143,240,162,223,26,204,104,197,251,11,251,
+148,251,103,251,120,252,0,78,30,186,92,69,172,73,27,252,4,251,160,128,29,
+251,88,251,15,251,212,21,43,247,170,7,124,164,219,100,237,27,247,152,247,
+46,247,99,247,91,247,23,57,215,251,1,186,31,195,194,175,247,13,127,202,8,
+247,42,189,247,14,233,247,31,26,247,48,251,16,247,35,251,161,251,152,251,
+150,251,46,251,68,251,11,223,90,247,17,82,30,247,166,251,17,146,117,128,79,
+121,98,25,251,130,251,98,251,23,251,152,84,153,88,151,108,31,247,62,247,19,
+21,247,21,225,247,88,247,29,211,184,68,40,251,84,251,15,251,46,41,57,102,
+229,240,30,117,250,39,21,207,216,247,19,247,89,247,66,219,251,38,45,57,102,
+55,251,23,107,30,251,148,247,8,5,59,176,115,180,188,26,14,251,155,247,71,
+249,220,21,248,102,6,251,101,65,251,47,251,22,110,251,34,113,251,17,183,66,
+191,87,251,89,73,251,42,251,13,103,251,70,8,251,86,100,247,25,251,46,247,
+128,27,247,114,247,122,247,108,247,120,164,31,178,247,244,252,60,160,183,
+247,106,155,219,247,16,239,247,153,237,8,175,247,39,253,43,6,247,90,253,171,
+21,243,58,247,13,82,122,251,52,8,251,43,123,45,51,251,26,27,251,50,56,247,
+9,247,28,167,31,165,247,24,225,231,247,29,199,8,14,251,89,249,28,251,189,
+21,252,122,6,247,84,208,247,101,247,27,247,104,26,223,102,194,98,180,30,247,
+110,210,247,73,247,41,247,99,26,247,56,251,28,247,14,251,102,251,129,251,
+125,251,137,251,137,30,251,184,247,229,98,251,69,26,251,2,251,27,38,251,151,
+41,30,103,251,39,249,53,6,251,110,249,171,21,42,214,36,194,247,28,26,247,
+39,223,247,16,247,44,247,31,228,49,251,7,251,42,251,8,251,12,251,40,77,30,
+14,117,250,12,249,115,21,248,135,29,201,100,221,251,170,251,242,251,204,248,
+121,29,247,89,247,50,239,247,48,188,30,184,247,34,159,166,221,149,8,216,252,
+68,62,7,243,137,177,81,117,251,2,8,251,10,115,71,89,251,6,248,146,10,247,
+96,247,103,247,128,151,164,137,137,157,31,14,251,74,250,137,28,4,108,21,190,
+251,235,88,7,213,132,163,138,144,131,136,125,25,87,251,142,5,133,118,79,124,
+86,27,42,251,53,205,247,90,247,175,247,103,247,77,247,91,204,178,115,137,
+146,31,155,135,150,127,137,121,135,251,5,24,230,6,180,247,89,5,169,37,80,
+151,53,27,251,178,251,180,251,92,251,207,251,30,213,251,103,247,196,247,2,
+247,43,181,145,165,31,199,247,181,144,155,150,145,157,140,25,14,117,250,205,
+248,46,21,225,10,192,247,139,5,176,251,25,67,156,35,247,74,10,14,247,204,
+44,10,143,28,4,220,35,29,247,204,44,10,160,250,85,44,29,247,204,44,10,188,
+28,4,232,57,29,247,204,44,10,233,28,5,28,48,10,247,204,44,10,161,28,4,144,
+68,29,247,204,44,10,251,68,28,4,122,46,29,247,204,44,10,252,170,253,195,54,
+10,247,204,28,5,92,247,207,21,241,251,71,7,160,247,3,146,166,157,149,166,
+141,25,247,8,150,5,247,134,29,117,251,3,5,251,169,37,247,150,6,100,251,96,
+176,10,190,247,160,5,14,247,241,28,5,239,249,211,21,113,247,13,254,227,251,
+92,5,247,228,225,247,156,247,100,247,145,27,247,97,29,252,30,252,32,251,159,
+252,68,60,31,251,33,114,151,251,0,247,8,159,5,138,124,139,123,124,26,247,
+133,29,30,247,15,29,180,142,178,143,177,31,14,247,204,247,216,248,152,21,
+248,109,247,217,247,199,247,199,238,204,100,133,149,30,158,133,157,104,119,
+26,131,251,74,5,247,31,6,199,247,211,178,247,99,149,198,239,174,25,247,50,
+251,31,5,198,153,193,199,198,26,200,83,187,251,6,251,116,251,16,251,38,251,
+97,81,30,160,57,82,145,57,27,252,76,252,79,251,226,252,160,247,133,29,31,
+247,15,29,31,14,166,28,5,213,28,4,221,21,205,104,198,251,9,251,96,251,36,
+251,15,251,144,76,30,148,92,75,147,88,247,74,10,229,148,5,225,10,190,247,
+135,180,247,85,174,233,205,170,25,247,55,251,27,5,154,143,237,159,223,26,
+14,247,98,28,5,73,28,5,127,21,70,6,251,46,251,11,5,201,67,51,196,251,6,27,
+252,98,251,188,252,114,252,67,251,193,247,46,251,122,247,116,247,66,247,39,
+233,247,11,247,29,31,127,67,5,251,160,91,251,82,251,82,251,102,27,251,23,
+50,176,182,98,31,175,247,97,5,171,122,107,167,90,27,62,65,69,40,251,40,247,
+62,251,39,247,175,247,204,247,189,247,119,247,190,191,31,251,53,247,120,21,
+60,48,251,31,65,251,11,27,251,39,251,15,247,60,247,128,247,254,247,139,248,
+21,247,180,226,231,71,75,196,31,14,181,28,4,108,248,218,21,221,252,5,57,7,
+175,134,170,135,146,123,136,117,25,71,252,34,5,130,111,61,115,69,27,127,6,
+247,124,28,4,138,211,134,183,107,147,136,25,160,134,153,120,137,109,134,251,
+71,24,247,10,6,194,247,205,251,19,183,64,159,37,142,25,169,247,41,5,251,12,
+6,107,251,49,5,251,230,87,251,203,251,196,252,90,26,251,89,217,251,181,247,
+194,80,30,95,251,111,5,247,12,6,180,247,101,5,247,36,247,87,205,149,174,31,
+217,248,95,145,164,154,149,162,141,25,253,181,90,21,248,28,247,101,247,164,
+247,118,204,30,251,115,254,243,5,33,189,33,247,9,247,115,26,14,251,72,247,
+141,28,4,203,21,248,112,6,251,93,64,251,92,62,251,107,26,55,176,84,180,98,
+30,251,82,79,251,101,251,45,251,103,26,251,57,247,27,251,16,247,103,247,135,
+247,149,247,143,247,130,30,247,188,252,2,168,247,66,26,247,11,247,83,213,
+247,124,218,30,175,247,39,253,73,6,247,100,253,122,21,237,63,247,23,84,251,
+32,26,251,50,251,11,251,0,251,38,251,33,52,232,247,8,247,42,247,17,247,12,
+247,31,197,30,14,251,89,249,98,247,39,21,252,122,6,247,93,214,247,92,216,
+247,107,26,223,102,194,98,180,30,247,82,199,247,111,247,45,247,103,26,247,
+57,251,37,247,16,251,103,251,135,251,139,251,143,251,130,30,251,188,247,248,
+110,251,66,26,251,11,251,83,65,251,124,60,30,103,251,39,249,83,6,251,110,
+249,122,21,41,215,251,13,194,247,32,26,247,50,247,1,247,0,247,38,247,33,236,
+46,251,8,251,42,251,27,251,12,251,31,81,30,14,247,204,28,5,102,249,44,21,
+252,164,53,6,247,72,126,153,60,108,251,56,8,251,34,108,251,6,41,251,57,27,
+251,167,251,52,247,152,247,250,207,31,248,17,212,247,177,247,107,247,150,
+27,233,180,112,123,174,31,155,131,163,114,138,115,248,115,29,172,251,9,251,
+5,176,251,43,27,252,50,252,12,251,179,252,66,57,31,252,16,66,247,110,251,
+235,248,44,27,247,233,247,24,247,79,247,72,188,31,193,247,89,150,176,247,
+25,149,8,14,252,13,248,227,252,65,21,138,182,5,130,108,110,124,115,27,122,
+89,153,185,150,31,212,247,223,5,247,3,165,84,194,41,27,50,43,96,84,85,31,
+228,248,32,5,86,248,139,29,251,75,253,201,5,247,14,6,237,248,66,5,196,197,
+222,178,181,27,168,198,106,74,124,31,58,251,255,5,73,125,218,125,172,27,195,
+238,177,147,162,31,14,252,33,249,179,249,195,147,29,162,28,4,166,147,29,115,
+43,29,251,162,28,5,237,44,29,115,43,29,245,28,7,72,48,10,115,43,29,183,28,
+6,166,39,29,115,43,29,251,56,28,6,166,46,29,115,43,29,251,218,251,68,160,
+10,115,43,29,251,239,251,123,68,29,115,43,29,252,199,251,236,66,29,115,43,
+29,253,116,251,172,51,10,115,250,191,247,15,21,153,10,179,195,153,155,189,
+31,93,251,141,247,93,10,14,115,104,29,115,104,29,144,250,162,249,33,21,247,
+120,251,4,247,23,251,73,45,251,33,63,51,251,1,30,187,247,119,218,29,251,113,
+254,199,5,247,80,6,247,42,249,97,5,225,229,221,210,208,27,247,21,240,80,251,
+76,251,226,251,128,252,164,252,8,102,31,122,59,5,248,124,247,221,248,199,
+248,74,31,14,115,247,9,29,251,15,248,114,29,223,247,47,203,151,172,31,211,
+7,125,90,94,114,104,27,114,60,161,217,155,31,247,7,248,187,5,247,77,175,58,
+247,17,10,252,35,249,197,28,6,47,21,211,72,174,251,32,251,119,39,251,91,75,
+124,30,251,33,253,23,247,67,10,247,91,10,169,247,25,5,247,26,170,229,206,
+223,27,170,168,135,127,153,31,161,34,5,139,154,133,155,190,176,178,184,30,
+14,47,248,177,28,5,229,21,57,247,164,10,251,176,28,250,168,247,245,29,227,
+83,251,0,117,31,251,58,253,206,5,251,31,111,79,247,156,10,247,94,247,56,247,
+154,191,30,247,46,249,158,5,247,77,176,57,248,101,29,14,115,247,9,29,251,
+58,253,206,5,251,31,112,78,247,156,10,247,95,247,56,247,154,190,30,247,46,
+249,158,5,247,77,173,60,247,17,10,115,90,29,248,249,249,63,247,192,21,251,
+126,91,242,247,31,10,228,248,63,215,10,14,251,179,249,1,248,96,21,247,112,
+29,251,162,6,202,247,187,139,150,139,26,145,166,158,151,163,141,225,149,24,
+247,29,10,120,215,247,242,30,14,115,250,140,250,111,21,251,83,6,251,39,253,
+97,5,45,49,251,21,74,73,27,94,49,194,247,0,162,31,247,17,248,241,5,247,2,
+161,251,15,162,90,27,53,251,46,75,127,105,31,141,67,5,154,186,184,163,176,
+27,163,219,117,61,123,31,251,7,252,187,5,251,76,102,221,248,90,10,251,19,
+252,244,5,221,6,247,212,200,5,201,7,251,75,155,5,14,252,36,249,155,28,5,97,
+21,251,16,6,44,252,66,5,83,80,55,100,96,27,110,81,172,203,154,31,220,247,
+255,5,205,153,59,153,107,27,83,39,101,132,117,31,141,95,5,148,169,168,154,
+163,27,155,191,126,92,129,31,64,251,223,5,251,2,115,192,83,237,27,228,234,
+182,194,194,31,56,252,0,5,193,6,247,100,175,5,176,7,251,11,149,5,14,168,250,
+191,250,111,21,178,29,251,19,252,244,5,221,248,80,10,168,28,4,180,251,234,
+21,227,74,164,139,30,251,103,251,34,49,176,114,229,186,247,118,25,247,99,
+250,129,5,178,29,105,251,49,5,251,132,85,247,19,251,103,247,140,27,247,17,
+229,194,211,31,14,115,43,29,14,50,250,1,249,106,21,192,247,151,5,253,138,
+59,6,225,133,5,162,145,123,124,136,31,251,38,253,144,114,35,139,26,247,79,
+6,139,155,211,228,248,83,30,142,162,173,143,163,27,247,72,193,251,93,251,
+128,92,31,251,196,77,251,78,251,2,251,70,27,110,77,145,151,95,31,142,66,5,
+122,203,196,126,202,27,247,122,247,165,247,70,248,7,215,31,247,138,189,251,
+39,247,124,251,152,27,105,100,135,136,114,31,194,247,169,5,247,189,6,150,
+155,129,124,138,31,138,251,28,5,14,115,90,29,179,96,10,247,24,29,247,94,247,
+216,10,247,22,249,76,5,247,21,247,247,29,252,89,248,205,29,247,5,247,48,209,
+153,172,31,14,179,96,10,123,53,155,45,244,123,25,102,106,75,69,117,202,29,
+156,166,194,151,165,30,247,1,150,247,25,198,168,151,8,14,179,96,10,247,240,
+10,184,191,150,153,187,31,251,113,251,202,248,82,29,247,150,248,4,139,30,
+14,247,231,28,5,90,248,16,29,223,248,60,247,195,29,75,251,211,5,251,246,241,
+29,247,246,6,133,108,104,251,31,69,26,251,56,247,66,65,247,23,247,99,247,
+111,247,1,247,162,30,251,88,143,21,251,57,57,251,26,34,84,34,168,247,13,174,
+172,247,49,158,236,30,153,161,203,162,165,27,247,31,183,81,251,11,31,14,127,
+250,158,250,111,21,251,80,6,55,252,72,5,252,54,241,29,248,53,6,68,252,1,247,
+87,10,208,248,0,8,14,179,247,5,10,251,41,253,162,5,251,163,87,251,0,251,34,
+247,147,10,208,248,0,203,247,223,24,248,53,6,86,251,169,247,24,29,248,18,
+28,5,99,248,187,21,247,220,29,247,34,249,135,5,251,80,6,55,252,72,5,252,54,
+241,29,248,53,6,93,251,130,5,251,34,111,189,41,247,96,248,144,29,14,248,28,
+249,195,250,111,21,55,252,72,5,252,23,241,29,248,22,6,47,252,89,5,247,88,
+6,197,10,212,248,17,5,14,127,39,10,14,127,250,203,180,21,137,211,5,124,92,
+94,248,42,29,247,1,248,214,82,10,251,17,253,9,121,55,216,113,198,131,25,102,
+104,83,72,118,202,29,155,162,193,152,167,30,227,147,247,22,184,171,150,8,
+14,248,58,249,206,22,236,248,148,5,145,177,201,147,166,231,29,102,71,131,
+133,100,31,167,247,39,82,10,251,36,253,105,5,14,121,248,209,22,72,78,80,73,
+121,202,29,152,153,184,181,202,30,248,77,188,81,29,14,121,98,10,14,248,128,
+86,10,248,128,97,10,131,57,184,92,223,129,25,108,112,70,65,115,248,104,10,
+69,248,71,10,94,156,163,26,158,169,200,150,157,30,212,148,225,180,205,165,
+8,14,247,26,250,63,249,224,21,251,49,253,97,247,75,29,236,149,5,217,28,251,
+125,247,222,29,251,50,253,111,247,159,29,247,46,249,95,248,44,10,248,38,6,
+172,137,151,123,135,116,8,14,248,24,40,10,14,251,24,100,10,251,24,100,10,
+230,28,4,209,250,33,21,217,252,95,61,7,235,247,242,29,78,251,187,5,252,117,
+6,202,247,187,248,134,29,225,149,5,247,29,10,131,215,247,242,30,248,115,6,
+64,251,242,141,147,139,26,133,112,120,127,115,137,52,129,24,61,248,93,217,
+7,43,247,243,29,247,50,248,125,10,248,24,40,10,251,81,247,142,44,29,248,24,
+40,10,251,8,248,233,48,10,248,24,40,10,251,70,248,71,39,29,248,24,40,10,252,
+22,248,71,46,29,248,24,40,10,252,156,28,250,133,160,10,248,24,40,10,253,137,
+28,249,221,66,29,248,24,40,10,254,165,28,250,29,51,10,248,24,28,6,35,247,
+166,10,247,56,29,109,251,49,5,253,19,6,169,247,49,191,10,108,251,49,5,251,
+45,36,247,25,6,251,54,253,222,213,29,247,54,249,222,5,247,49,242,251,29,6,
+170,247,49,248,133,10,254,109,252,144,21,179,247,99,5,249,19,6,99,251,99,
+5,14,251,24,247,190,29,119,45,5,252,51,6,159,233,247,160,10,119,45,5,40,77,
+225,6,34,252,141,224,10,245,248,141,5,241,201,50,6,159,233,143,155,151,147,
+155,140,25,253,20,251,197,21,164,247,16,5,248,51,6,114,251,16,5,14,248,166,
+247,181,247,167,29,247,82,10,248,62,29,213,29,247,105,250,226,145,166,157,
+248,202,10,7,14,248,24,143,29,251,39,253,138,112,251,33,119,247,189,29,247,
+21,247,0,247,163,192,31,247,150,28,5,47,144,166,158,151,164,141,25,14,248,
+24,86,29,250,84,250,138,247,192,21,251,126,91,247,11,247,31,10,247,72,250,
+53,136,29,14,52,248,79,249,35,21,247,232,111,10,251,234,6,232,248,114,144,
+166,159,151,163,141,25,247,13,149,5,248,46,10,248,182,29,248,169,225,7,251,
+11,149,104,247,203,29,14,247,247,248,151,250,166,21,169,141,155,159,163,30,
+225,102,170,95,247,31,127,179,136,247,28,247,43,210,236,79,168,24,123,122,
+118,121,100,27,251,103,205,5,83,126,252,35,251,186,43,26,76,247,166,251,228,
+155,117,30,153,120,117,117,131,131,8,124,39,232,141,251,3,31,121,121,136,
+131,125,31,251,47,251,173,202,112,5,156,153,152,147,157,27,176,159,136,71,
+247,42,31,248,53,248,94,36,247,31,247,10,207,247,74,115,221,251,23,138,251,
+58,25,38,112,251,8,82,57,30,84,251,72,175,251,8,27,251,78,251,157,209,114,
+5,160,156,150,147,165,27,247,203,109,5,247,90,247,70,247,162,247,169,247,
+107,26,247,65,76,247,126,251,232,30,97,113,251,34,44,251,23,64,8,14,248,24,
+28,6,35,247,166,10,225,252,169,53,7,247,22,29,251,49,253,191,73,251,230,247,
+68,29,171,247,58,24,214,248,16,248,192,29,247,105,250,226,248,133,10,14,247,
+115,96,29,247,71,28,4,131,22,227,7,103,10,7,14,247,26,247,36,251,245,21,247,
+189,10,47,68,125,139,31,216,248,27,247,36,29,203,247,211,5,248,79,10,251,
+107,254,220,247,200,10,248,179,248,100,10,247,10,248,243,5,139,200,153,222,
+248,83,10,30,247,251,10,14,247,71,28,4,131,227,21,103,10,158,248,36,10,249,
+16,250,162,28,5,8,21,247,22,29,248,62,29,213,29,247,112,28,4,123,5,247,78,
+6,248,0,29,253,161,6,14,248,24,86,29,248,11,118,29,248,41,247,153,10,102,
+247,203,29,247,105,250,226,248,133,10,14,249,173,28,7,14,248,150,21,247,113,
+251,66,242,251,158,80,46,128,139,30,219,248,42,143,157,158,162,168,141,25,
+247,31,147,5,229,252,175,49,7,246,131,167,137,150,118,134,119,25,51,252,76,
+5,252,162,6,227,248,76,143,159,158,160,167,141,25,247,11,147,5,229,252,154,
+247,43,29,247,3,248,185,5,248,162,6,251,3,252,185,135,119,121,116,110,137,
+25,251,19,131,5,51,248,109,7,247,236,247,189,247,23,248,19,31,251,117,166,
+21,251,150,251,19,251,77,251,172,87,248,71,29,247,70,215,84,251,35,30,14,
+248,24,143,29,251,5,252,216,247,68,29,247,111,250,239,24,145,166,157,151,
+164,141,8,14,250,97,28,7,83,249,13,21,145,166,157,151,164,141,247,11,149,
+24,247,76,29,247,70,250,47,136,29,77,251,216,5,251,130,93,247,3,248,26,29,
+14,250,22,28,5,231,247,166,10,247,56,29,49,252,103,5,252,215,6,229,248,103,
+191,10,248,62,29,138,10,241,248,169,5,248,215,247,101,29,247,11,248,252,5,
+143,164,180,144,187,247,8,10,80,92,133,135,111,31,214,248,25,248,133,10,14,
+248,26,28,6,43,28,5,6,21,172,29,248,166,227,7,41,247,219,29,14,248,26,28,
+5,53,227,21,251,0,247,219,29,247,13,147,5,172,29,186,248,36,10,250,22,28,
+5,37,28,4,211,21,141,155,160,162,167,143,247,13,147,24,227,28,251,4,243,29,
+248,99,247,168,29,248,166,227,7,41,147,110,143,129,162,143,155,25,247,12,
+248,243,5,139,199,153,222,248,83,10,30,247,60,10,47,69,125,139,31,14,248,
+26,160,29,247,246,7,247,118,141,251,21,251,183,81,31,247,36,6,247,183,196,
+192,247,21,247,118,27,248,6,227,6,247,184,29,248,26,160,29,249,250,7,247,
+118,247,23,248,84,29,239,248,144,247,184,29,250,12,107,10,251,107,254,220,
+247,200,29,28,7,84,225,7,251,3,248,156,10,250,222,141,155,159,162,168,143,
+25,14,250,9,107,10,251,109,254,220,137,121,121,116,110,137,25,251,21,129,
+5,53,28,5,88,7,247,117,247,23,251,21,251,183,82,31,244,6,239,248,144,32,248,
+156,10,250,220,141,155,159,162,168,143,25,14,248,65,159,10,252,188,248,166,
+28,5,33,55,29,14,252,188,248,166,28,5,33,55,29,14,253,123,247,111,247,220,
+21,173,110,173,89,86,108,103,107,100,167,109,194,190,168,172,175,30,145,253,
+133,21,186,7,134,122,78,115,108,27,103,117,168,173,145,31,240,248,127,5,84,
+6,251,93,101,5,103,7,247,7,128,54,252,52,5,82,127,152,75,230,27,212,240,181,
+147,159,31,14,253,123,248,95,28,6,35,199,29,251,48,28,7,154,199,29,252,188,
+51,29,247,90,250,193,49,29,252,188,51,29,247,44,250,251,58,10,252,188,51,
+29,247,116,28,5,84,57,29,252,188,51,29,247,161,28,5,136,48,10,252,188,51,
+29,247,168,28,5,76,35,10,252,188,51,29,236,28,4,252,247,51,29,252,188,51,
+29,247,99,28,4,230,39,29,252,188,51,29,247,99,28,4,230,60,10,248,76,248,134,
+35,29,252,188,51,29,199,28,5,86,37,10,252,188,248,166,28,5,33,55,29,136,251,
+125,68,10,252,188,248,166,28,5,33,55,29,251,175,251,244,66,29,252,188,248,
+166,28,5,33,55,29,251,50,80,69,29,252,188,249,210,154,10,198,247,191,5,34,
+6,82,251,180,148,10,251,192,28,6,111,55,29,14,252,188,248,166,28,5,33,21,
+196,94,196,62,248,83,29,218,247,237,29,105,188,195,149,31,188,247,152,5,247,
+62,241,251,42,6,225,248,93,247,195,29,80,251,207,5,251,50,37,247,30,6,87,
+251,169,248,9,10,14,253,123,248,95,28,6,35,247,69,29,172,247,50,5,247,2,198,
+41,6,196,247,167,247,105,10,100,251,83,5,39,80,227,6,102,251,58,248,36,29,
+252,205,99,251,218,21,82,184,82,216,221,186,200,192,203,96,190,55,60,94,84,
+79,30,120,28,4,230,21,61,7,147,166,233,180,186,27,195,173,90,83,129,31,251,
+47,253,199,5,223,6,247,201,203,5,198,7,251,68,158,247,23,249,74,5,233,157,
+119,246,251,32,27,251,4,251,48,69,125,108,31,14,253,134,228,248,225,21,105,
+168,105,189,193,169,176,170,178,111,169,85,87,110,106,103,30,127,249,133,
+21,92,7,144,156,200,163,170,27,175,161,110,105,133,31,38,252,127,5,194,6,
+247,93,177,5,175,7,251,7,150,224,248,53,5,195,151,126,203,48,27,66,38,97,
+131,119,31,14,146,248,166,28,5,33,55,29,248,187,28,4,230,70,29,132,248,166,
+28,5,33,55,29,248,172,28,4,230,55,29,14,248,174,248,166,28,5,33,55,29,248,
+172,28,4,230,55,29,248,172,28,4,230,55,29,14,248,30,248,166,28,5,33,55,29,
+250,86,249,210,152,10,248,165,248,166,28,5,33,55,29,250,234,249,212,99,29,
+14,252,100,248,238,247,48,21,188,92,192,88,143,30,248,148,29,247,47,249,183,
+248,86,10,251,25,253,78,248,21,29,31,14,253,66,248,142,250,3,21,168,109,171,
+106,141,30,80,36,5,71,115,160,189,150,31,240,248,118,5,84,6,251,92,101,5,
+103,7,247,4,128,53,252,55,5,84,127,190,76,228,27,230,247,4,166,221,31,14,
+252,100,248,170,248,91,21,247,5,251,68,7,225,248,80,248,86,10,81,251,194,
+5,251,56,251,5,247,35,6,85,251,175,248,21,29,188,92,192,88,143,31,248,148,
+29,186,247,138,5,14,248,55,28,5,170,249,21,21,247,105,35,247,50,251,134,251,
+183,251,70,251,118,251,127,82,30,251,95,6,231,248,97,5,57,6,251,171,61,5,
+67,247,34,7,251,38,253,111,133,114,119,121,112,137,25,33,133,5,59,248,117,
+219,7,41,145,114,141,125,157,145,164,25,200,247,214,5,247,93,6,135,102,137,
+102,104,26,251,99,241,251,54,247,138,247,244,247,93,247,243,247,207,30,251,
+85,192,21,251,103,56,252,56,251,151,251,19,94,234,247,29,247,103,223,248,
+54,247,150,247,19,184,44,251,27,30,14,252,90,41,10,14,252,90,41,10,14,252,
+141,248,190,28,5,51,21,144,164,159,151,163,141,246,149,24,219,252,148,59,
+7,247,19,129,173,137,143,123,140,116,25,251,129,28,251,80,135,114,118,127,
+115,137,25,32,129,5,59,248,148,219,248,108,10,14,252,90,249,78,248,210,29,
+253,60,248,194,248,39,10,213,133,162,247,191,10,247,240,191,7,61,248,155,
+10,249,41,143,155,144,147,157,140,25,14,252,205,248,220,250,33,21,217,252,
+109,247,222,29,251,50,253,111,247,75,29,14,253,137,248,125,28,5,49,21,186,
+251,195,92,7,203,133,161,137,146,131,134,124,25,39,252,74,5,125,135,127,131,
+122,27,78,132,5,92,247,195,186,7,75,146,117,141,133,147,143,151,25,239,248,
+74,143,156,152,145,155,141,25,14,252,90,41,10,247,139,247,142,49,29,252,90,
+41,10,247,93,247,200,58,10,252,90,41,10,247,165,248,181,57,29,252,90,41,10,
+247,210,248,233,48,10,252,90,41,10,247,217,248,173,35,10,252,90,41,10,247,
+38,248,93,247,51,29,252,90,41,10,247,148,248,71,39,29,252,90,41,10,247,148,
+248,214,29,252,90,41,10,187,248,71,46,29,252,90,41,10,247,1,248,183,37,10,
+252,90,41,10,96,28,250,84,68,10,252,90,41,10,251,215,28,249,221,66,29,252,
+90,41,10,251,133,28,251,2,69,29,252,90,249,109,247,166,10,248,46,10,248,7,
+10,53,252,87,5,251,93,37,247,73,6,32,252,185,247,139,29,246,248,185,5,247,
+111,241,251,91,6,225,248,87,145,166,147,151,166,141,25,14,252,205,248,137,
+248,84,21,247,0,251,21,7,203,247,194,248,44,10,236,149,5,217,252,109,247,
+222,29,74,251,194,5,251,46,251,0,247,22,6,70,251,213,247,159,29,207,247,211,
+5,14,253,143,248,105,28,5,59,21,176,251,169,102,7,199,135,157,138,143,132,
+137,129,25,94,251,86,5,35,95,233,6,83,251,128,137,129,134,133,126,138,25,
+72,135,5,102,247,170,176,7,77,143,120,140,135,146,141,148,25,195,247,128,
+5,247,5,183,36,6,184,247,86,142,151,143,144,153,140,25,14,252,90,249,169,
+28,6,52,21,248,46,10,248,7,10,251,165,28,250,134,247,139,29,247,165,28,5,
+122,145,166,147,151,166,141,25,14,248,140,249,78,28,5,8,63,29,250,238,191,
+29,247,81,249,78,28,5,8,63,29,249,154,149,63,29,14,249,212,249,78,28,5,8,
+63,29,249,154,149,63,29,249,154,149,63,29,14,249,243,249,78,28,5,8,63,29,
+28,6,6,149,212,29,14,249,222,249,78,28,5,8,63,29,28,5,185,149,97,29,14,251,
+153,249,181,247,78,21,207,73,215,72,145,30,251,21,251,134,5,32,82,195,243,
+164,143,165,143,164,31,247,95,250,168,5,252,25,53,6,248,7,10,251,74,254,76,
+5,133,108,135,108,109,26,251,65,247,13,86,247,45,247,13,247,140,205,247,45,
+30,14,250,9,28,7,152,250,9,21,247,201,251,40,247,105,251,213,252,24,251,131,
+251,193,251,244,47,30,251,156,6,233,248,117,143,155,157,164,170,141,25,247,
+25,248,156,29,168,137,149,114,135,123,25,251,107,254,220,135,123,118,114,
+111,137,25,251,34,131,5,51,248,195,227,7,251,17,147,113,248,105,29,237,248,
+138,5,247,156,6,131,90,135,88,87,26,251,201,247,37,251,105,247,216,248,117,
+247,165,248,111,248,79,30,251,116,208,21,251,207,33,252,199,252,40,251,109,
+88,247,39,247,89,247,209,246,248,195,248,39,247,109,190,251,37,251,89,30,
+14,248,33,247,11,248,194,21,146,165,153,145,166,140,8,250,247,6,159,154,128,
+102,134,31,126,251,11,224,123,241,248,161,54,155,105,251,16,132,114,125,132,
+114,140,25,254,246,6,116,124,150,174,144,31,151,247,6,55,155,37,252,158,224,
+123,5,14,252,174,248,181,28,5,33,70,29,253,112,247,107,247,220,200,10,253,
+112,248,91,28,6,37,200,10,252,174,127,29,248,63,250,88,44,29,252,174,127,
+29,248,136,28,5,31,48,10,252,174,248,181,28,5,33,247,228,29,169,253,251,190,
+10,252,131,248,218,28,5,33,248,66,10,214,191,205,188,30,100,251,193,21,63,
+6,251,201,77,5,78,7,247,64,120,251,11,253,74,118,251,0,119,53,127,112,25,
+248,15,29,241,247,77,241,247,113,10,251,156,251,195,247,154,10,14,253,86,
+248,129,28,6,37,21,175,110,173,86,83,112,105,103,99,174,110,187,187,173,178,
+169,30,114,251,73,21,90,6,251,93,102,5,102,7,247,3,128,62,252,52,125,74,126,
+87,132,123,25,144,119,104,146,116,27,37,251,0,83,251,0,81,183,95,205,247,
+12,206,208,216,195,31,180,99,170,90,156,94,193,172,24,114,199,106,198,89,
+181,8,170,199,163,247,5,139,26,251,64,251,73,21,72,111,93,66,66,27,107,120,
+164,170,194,208,181,195,166,163,134,131,161,31,14,252,174,127,29,14,252,174,
+248,211,248,78,190,10,253,114,248,125,250,174,21,207,251,9,7,189,247,166,
+5,90,248,3,10,105,251,81,5,251,22,71,247,8,6,87,251,172,126,72,107,52,114,
+114,25,251,26,172,5,126,131,115,123,108,26,102,173,111,194,247,71,233,247,
+148,247,15,162,30,171,247,59,5,14,252,96,250,25,28,5,98,21,227,35,182,65,
+251,152,251,17,251,86,251,212,84,30,73,252,10,5,251,119,251,5,247,101,6,46,
+252,169,247,147,29,247,60,248,64,247,97,174,30,196,247,236,5,247,124,247,
+5,251,105,6,202,248,27,180,247,129,168,247,11,217,170,25,247,53,251,25,5,
+199,145,192,182,202,26,14,251,76,211,249,238,21,247,83,6,251,46,254,7,247,
+147,29,247,62,248,64,247,97,172,30,247,6,249,74,5,161,6,247,227,247,29,247,
+147,247,53,247,3,71,247,16,251,49,247,117,29,191,160,89,71,44,92,251,157,
+251,107,31,116,6,14,246,28,4,170,250,31,21,108,10,251,43,253,154,5,44,120,
+247,1,96,216,27,247,5,247,60,211,139,31,247,23,10,246,28,4,170,250,31,21,
+108,10,251,43,253,154,123,58,215,96,209,128,25,102,104,83,72,118,202,29,155,
+162,193,152,167,30,247,2,151,247,28,197,139,26,247,23,10,246,28,4,170,250,
+31,21,108,10,251,43,253,154,5,44,120,247,1,96,216,27,178,185,148,151,182,
+31,251,109,251,198,248,82,29,247,142,247,248,139,30,247,23,10,247,167,28,
+5,29,247,246,21,247,68,251,36,232,251,101,105,85,120,123,105,30,214,248,35,
+5,139,57,164,90,57,251,0,114,33,251,9,30,251,87,251,71,99,251,207,100,251,
+17,106,41,114,92,104,110,251,16,246,24,89,88,71,90,81,199,94,227,247,19,216,
+197,247,70,197,31,184,247,25,190,247,214,247,56,247,55,8,204,205,232,153,
+139,26,251,17,253,23,248,47,29,247,96,247,114,248,31,10,83,35,248,0,10,168,
+248,160,10,226,250,168,249,250,21,142,152,153,155,163,141,247,1,145,24,108,
+10,251,48,253,179,247,87,10,209,248,0,8,14,248,45,249,106,247,107,21,251,
+34,111,187,247,59,10,249,18,142,152,153,155,163,141,25,247,1,145,5,108,10,
+14,248,48,249,216,22,197,10,190,247,156,142,153,153,155,163,140,25,247,1,
+145,5,219,253,230,231,10,247,170,6,251,67,254,11,5,14,64,250,80,248,238,21,
+247,1,29,248,29,247,25,248,19,247,136,31,251,92,133,203,10,250,93,250,146,
+248,89,21,247,215,10,251,135,247,27,251,30,247,54,247,74,247,7,247,11,221,
+223,30,247,85,10,247,56,223,247,240,247,150,29,247,122,29,51,6,140,155,140,
+155,154,26,247,1,29,247,211,247,39,247,144,247,118,184,31,251,77,247,35,203,
+10,248,150,28,6,58,250,15,21,247,183,29,126,92,127,126,88,31,252,66,59,6,
+240,10,247,113,6,167,135,247,20,251,195,157,57,247,43,10,227,213,164,180,
+217,31,115,10,14,251,31,180,10,252,111,249,170,248,39,10,216,133,161,138,
+145,129,137,125,25,50,252,74,5,251,57,107,100,44,251,5,27,111,113,151,160,
+31,247,42,52,7,94,251,102,5,133,153,196,108,244,27,247,120,203,247,24,247,
+94,178,31,224,248,64,144,155,151,147,156,140,25,14,251,241,249,207,250,33,
+21,217,252,129,61,7,247,9,129,173,135,150,125,132,116,25,33,252,125,5,251,
+87,98,104,41,251,19,27,111,112,143,157,31,247,79,251,15,7,84,251,152,5,126,
+163,209,109,247,21,27,247,173,223,247,47,247,134,188,31,237,248,115,248,134,
+29,14,251,31,184,29,247,135,247,142,44,29,251,31,250,162,247,166,10,247,133,
+10,55,252,97,5,251,142,251,0,247,121,6,108,251,54,5,251,167,88,80,251,41,
+251,66,27,96,100,151,248,58,29,96,247,53,27,247,243,237,247,103,247,230,200,
+31,166,247,36,5,247,127,247,0,251,107,6,223,248,97,248,45,10,14,251,124,248,
+13,247,189,247,154,10,248,36,250,64,21,248,105,10,247,8,149,24,247,133,10,
+251,29,253,113,119,53,127,112,8,248,15,29,247,4,247,77,247,1,247,113,10,14,
+251,31,216,249,136,21,247,83,6,251,40,253,226,113,251,33,120,42,251,37,113,
+25,251,42,247,66,5,82,78,51,69,61,247,2,86,217,247,189,247,1,246,247,164,
+190,31,247,43,249,226,5,185,6,247,203,247,12,247,122,247,28,165,31,247,12,
+163,66,247,57,251,73,27,247,117,29,214,151,34,251,4,113,31,251,18,109,90,
+251,27,251,80,27,131,6,14,247,222,28,5,242,28,5,6,21,93,29,251,116,254,255,
+247,199,10,248,195,247,149,10,193,250,154,217,21,247,176,29,248,44,10,236,
+149,5,217,254,19,59,7,237,133,162,138,147,122,135,126,25,88,251,156,47,251,
+195,81,41,8,107,120,105,87,110,27,251,50,201,5,77,95,93,80,61,194,114,194,
+217,247,7,248,57,10,247,223,6,251,58,253,140,247,177,29,7,14,247,222,250,
+38,247,31,21,136,123,120,114,110,137,251,31,131,24,51,186,7,247,117,247,15,
+248,84,29,237,248,144,251,0,147,110,143,130,162,142,155,25,247,104,250,220,
+142,155,161,164,167,141,25,247,28,147,5,93,29,14,247,222,28,5,242,28,5,6,
+21,93,29,251,116,254,255,247,199,10,248,65,247,214,29,247,149,10,249,159,
+28,7,0,248,152,21,247,115,251,66,247,11,251,156,79,57,129,139,30,248,32,10,
+254,175,247,69,10,90,77,67,182,86,247,182,10,247,252,6,251,115,254,255,248,
+131,10,251,25,131,5,51,248,105,7,247,236,247,191,247,23,248,21,31,251,123,
+141,21,251,146,251,28,251,58,251,160,88,98,143,139,30,247,19,249,28,5,139,
+219,149,182,247,39,238,63,251,58,30,14,247,222,28,5,53,28,4,211,21,143,155,
+160,164,167,141,247,28,147,24,93,29,251,125,28,251,98,247,108,29,247,125,
+247,49,211,248,0,8,14,250,25,28,5,53,28,4,211,21,142,155,161,164,167,141,
+247,28,147,24,93,29,251,76,254,50,5,251,130,93,247,3,207,29,14,249,238,28,
+5,202,28,5,6,21,227,254,176,105,29,248,4,6,251,116,254,255,247,199,10,248,
+195,227,7,251,17,147,112,248,105,29,247,12,248,246,5,143,162,184,146,196,
+247,8,10,72,86,132,135,114,31,215,248,24,143,155,160,164,167,141,25,14,249,
+249,28,8,11,28,5,8,248,194,10,254,66,105,29,247,143,6,144,134,143,132,144,
+130,247,137,252,189,24,177,29,14,247,247,28,6,15,28,5,10,21,223,254,206,247,
+9,10,248,203,247,68,10,251,143,129,21,251,124,28,251,114,5,253,60,247,211,
+10,28,5,238,28,5,239,247,33,21,137,121,119,116,110,137,251,13,129,24,51,248,
+154,247,130,29,247,236,227,7,181,29,247,29,29,252,154,51,7,239,129,168,137,
+149,116,135,121,25,36,252,154,5,252,29,6,243,248,158,248,127,29,247,8,149,
+5,223,254,166,247,9,10,248,173,247,153,29,244,248,167,5,248,29,6,252,105,
+249,37,21,251,124,28,251,114,5,253,30,247,211,10,252,49,248,200,252,68,21,
+181,7,129,116,98,131,120,27,92,89,201,208,99,31,99,206,109,227,116,181,180,
+173,207,194,188,174,184,95,24,202,158,166,172,168,26,169,140,111,175,79,27,
+92,110,119,91,88,31,251,107,251,97,247,16,248,207,5,85,6,251,98,103,5,102,
+7,247,9,128,251,68,253,201,5,247,14,6,193,247,142,200,189,167,85,210,251,
+44,175,88,25,110,160,182,110,182,27,181,217,161,160,184,31,14,252,55,249,
+150,249,191,21,182,7,131,117,98,129,120,27,92,88,202,207,100,31,98,206,110,
+227,117,180,178,174,208,194,188,174,185,94,24,200,160,166,171,141,168,8,170,
+112,174,80,91,111,118,92,86,30,91,96,33,37,73,77,247,21,248,210,24,86,6,251,
+99,102,5,102,7,247,9,129,251,68,253,202,248,136,10,186,247,140,201,190,167,
+84,209,251,43,176,89,25,109,159,182,112,182,27,182,217,160,159,182,31,14,
+84,52,10,172,28,7,12,35,29,84,52,10,247,15,28,7,76,48,10,84,52,10,251,222,
+251,119,68,29,84,52,10,252,182,251,232,66,29,84,52,10,252,169,251,187,54,
+10,84,250,142,247,9,21,149,10,248,104,29,174,194,152,153,190,31,137,119,106,
+251,120,80,66,247,180,10,247,103,247,132,184,30,14,84,249,82,250,199,21,242,
+251,142,7,205,247,223,247,56,10,101,251,82,5,251,79,36,247,58,6,251,105,254,
+199,248,188,10,209,7,248,72,10,77,247,3,94,247,39,103,209,248,196,29,14,84,
+249,246,248,140,21,75,211,251,69,251,49,104,222,110,222,115,187,25,248,196,
+29,247,163,242,251,142,6,205,247,223,247,56,10,101,251,82,5,251,79,36,247,
+58,6,251,105,254,199,205,29,84,249,246,248,140,21,75,211,251,69,251,49,104,
+222,110,222,115,187,25,158,10,247,82,250,76,247,56,10,251,164,28,250,168,
+205,29,128,250,225,248,189,21,122,233,252,108,54,128,167,128,163,130,158,
+25,158,10,247,82,250,76,247,56,10,251,68,254,10,251,89,104,153,48,247,55,
+168,63,252,21,5,247,80,6,223,248,52,144,143,247,8,160,191,251,5,221,251,78,
+185,69,25,247,86,29,209,7,248,72,10,110,191,113,198,117,196,8,14,84,250,142,
+186,21,209,7,248,72,10,77,247,3,94,247,39,103,209,158,10,247,2,248,179,178,
+247,80,231,246,247,13,141,25,237,251,23,5,139,247,13,165,156,231,30,199,151,
+100,204,251,19,27,251,52,251,53,82,251,56,251,7,31,79,53,113,59,114,251,8,
+251,90,254,130,24,247,99,29,247,86,29,14,84,140,10,167,97,191,98,195,128,
+8,101,106,78,70,118,202,29,155,167,197,150,165,30,206,149,229,168,195,168,
+8,14,84,250,142,250,111,21,251,83,6,55,252,52,45,55,96,230,251,0,247,145,
+83,223,25,189,107,73,186,74,27,73,251,13,102,104,72,31,69,7,156,173,203,153,
+168,27,212,215,35,251,7,203,31,200,251,3,182,251,39,176,69,77,82,33,47,63,
+81,70,213,24,44,106,96,84,92,26,88,137,182,79,231,27,211,184,172,219,219,
+31,247,224,247,234,251,74,254,23,5,218,248,80,10,62,95,29,62,95,29,62,98,
+29,87,248,132,35,29,62,250,140,250,39,21,247,0,10,5,211,162,131,106,155,31,
+247,66,251,232,155,108,160,111,168,129,25,102,108,71,65,117,202,29,156,170,
+202,149,162,30,247,5,171,247,17,247,52,167,176,109,192,24,235,10,195,225,
+163,244,217,208,247,46,247,241,10,14,247,9,228,250,109,21,248,13,29,247,23,
+6,251,66,254,11,5,123,29,228,248,95,5,14,62,176,22,123,29,247,1,248,185,218,
+29,14,132,250,209,250,39,21,195,94,182,66,87,86,124,103,96,30,49,63,110,55,
+88,43,115,94,102,98,94,110,182,247,109,24,38,6,86,251,160,5,130,106,105,133,
+104,247,118,29,172,174,137,135,170,31,85,251,164,5,240,6,182,247,115,247,
+58,251,218,5,98,159,172,104,180,27,247,11,247,45,247,87,180,170,31,108,192,
+5,102,108,37,41,86,27,114,117,160,165,126,31,251,21,247,146,127,164,110,167,
+101,156,25,179,163,170,186,178,182,168,170,167,235,242,247,25,247,43,247,
+241,10,14,62,248,124,248,126,21,178,163,198,190,171,188,195,225,163,244,217,
+208,247,46,247,241,10,247,0,10,247,169,251,38,247,36,251,137,100,251,61,25,
+42,117,60,39,251,78,248,144,10,115,137,119,8,126,174,200,123,210,27,247,144,
+247,14,247,51,247,50,175,31,179,247,69,251,32,247,133,251,169,247,58,8,14,
+62,249,244,248,196,21,181,233,251,109,236,161,184,165,182,178,174,25,247,
+46,70,5,184,170,180,175,182,26,248,7,29,72,83,107,80,107,73,251,26,200,24,
+96,45,247,22,80,5,40,82,80,74,251,18,27,233,248,122,5,77,6,251,209,73,5,86,
+7,247,52,110,251,60,253,244,248,211,10,148,153,148,154,147,154,8,14,249,163,
+64,29,14,249,163,64,29,252,55,248,140,80,10,249,163,64,29,252,20,248,81,39,
+29,249,163,95,10,251,115,247,4,251,25,247,36,119,30,102,106,75,69,117,202,
+29,156,166,194,151,165,30,247,60,150,246,247,2,219,217,8,247,85,10,247,58,
+223,247,238,247,150,29,14,251,117,250,160,248,85,10,251,236,88,7,224,133,
+158,138,140,125,128,129,25,251,246,251,214,5,116,6,207,247,214,143,155,151,
+147,156,140,25,218,145,5,248,135,10,213,133,162,248,46,29,251,31,253,41,136,
+125,127,131,122,138,25,62,248,114,10,133,149,141,151,25,199,247,173,5,220,
+6,247,56,251,183,5,68,180,175,119,217,27,173,189,148,150,180,31,191,7,137,
+117,121,138,123,27,92,114,151,200,105,31,251,76,247,222,247,240,247,203,5,
+14,115,250,248,250,31,21,219,252,72,59,7,221,131,162,137,147,127,112,116,
+25,252,31,251,240,5,129,6,214,247,236,146,166,157,151,164,141,25,235,149,
+5,217,252,113,61,7,245,129,174,135,149,125,133,116,25,251,48,253,111,135,
+114,119,127,114,137,25,43,129,5,61,248,113,217,7,33,149,102,143,131,153,143,
+162,25,202,247,189,5,215,6,247,89,251,230,5,51,188,196,114,233,27,184,199,
+150,155,196,31,217,7,137,102,119,137,118,27,88,112,151,209,98,31,251,113,
+248,17,248,52,247,250,5,14,247,138,47,10,88,248,175,35,29,247,138,47,10,178,
+248,239,48,10,247,138,47,10,252,22,28,250,84,68,29,247,138,47,10,252,238,
+28,249,227,66,29,247,138,47,10,252,225,28,250,16,54,10,247,138,163,10,247,
+144,252,121,119,29,251,176,248,187,248,193,29,247,138,163,10,247,20,251,138,
+251,80,251,59,205,63,247,62,247,42,215,251,38,119,29,36,247,90,247,105,247,
+80,71,218,251,85,251,64,251,25,247,150,248,193,29,247,138,250,227,248,225,
+21,71,218,251,85,251,64,251,25,247,150,162,10,243,106,10,247,17,6,247,20,
+251,138,251,80,251,59,205,63,247,62,247,42,215,251,38,119,29,36,247,90,5,
+14,247,161,28,5,110,249,124,21,113,247,13,253,10,251,8,137,144,247,171,29,
+252,172,252,164,96,131,243,248,172,192,29,251,4,252,212,251,142,93,151,251,
+0,247,107,176,59,252,45,247,6,10,226,248,82,247,22,161,247,144,252,120,119,
+29,251,117,248,73,5,14,247,138,28,5,242,28,4,186,21,247,17,251,64,211,251,
+3,69,41,106,63,74,30,252,155,252,234,5,107,6,241,106,10,247,9,6,247,144,252,
+121,5,251,11,200,205,247,157,29,251,176,248,187,248,62,248,125,5,182,175,
+172,166,174,27,172,163,124,125,154,31,251,95,7,147,135,182,115,182,141,8,
+213,182,229,204,31,14,247,138,28,4,236,227,21,137,106,92,135,247,196,10,162,
+10,243,106,10,247,17,6,247,144,252,121,202,251,11,196,113,195,135,25,213,
+134,191,251,0,83,251,169,8,244,6,14,247,138,105,225,21,53,248,166,225,7,251,
+23,149,110,141,137,162,156,155,25,248,181,248,173,5,173,6,35,252,173,133,
+112,120,127,113,247,190,10,247,107,248,52,10,252,171,53,7,247,11,129,174,
+137,149,122,135,119,25,47,252,105,5,251,17,6,251,144,248,121,5,247,11,76,
+83,172,251,11,27,86,63,124,121,76,31,53,7,141,172,167,141,164,27,211,178,
+119,38,190,31,247,176,252,187,252,172,252,154,5,14,181,250,216,248,240,21,
+239,252,103,7,117,189,248,91,248,154,247,38,155,5,225,252,86,53,7,247,3,129,
+164,137,141,116,124,123,25,252,96,252,169,5,107,6,227,248,169,145,166,155,
+151,161,141,25,242,149,5,225,252,89,53,7,236,129,169,137,146,123,135,116,
+25,51,252,169,5,251,71,39,247,54,6,62,252,105,135,115,124,126,116,137,25,
+38,129,5,53,248,91,225,7,38,149,109,141,130,156,143,159,25,217,248,105,5,
+245,6,247,106,252,121,5,251,11,193,186,106,241,27,184,203,154,157,193,31,
+225,7,137,111,115,137,118,27,78,105,159,240,96,31,251,68,248,37,5,14,247,
+104,84,29,14,247,104,84,29,251,150,248,159,35,29,247,104,28,5,156,247,166,
+10,225,87,172,132,29,127,73,5,247,31,207,251,35,251,169,83,31,244,6,237,248,
+144,251,37,149,251,134,248,113,115,193,93,161,66,143,25,208,168,229,217,247,
+182,29,14,248,48,28,6,100,247,166,10,247,103,10,239,248,152,247,107,29,253,
+133,7,247,253,29,247,77,6,251,119,28,251,139,162,29,14,247,104,249,99,250,
+101,21,242,251,82,7,169,247,45,247,7,10,109,251,45,5,251,68,36,247,47,6,251,
+56,253,216,162,29,247,103,10,189,247,152,5,14,247,204,28,6,0,247,166,10,205,
+88,192,43,69,67,118,90,80,30,251,68,251,37,126,248,106,29,113,108,94,111,
+85,116,217,248,29,24,251,17,6,55,252,70,5,127,84,84,133,94,208,29,170,137,
+200,133,197,129,25,59,252,40,5,247,17,6,210,248,3,146,135,145,133,143,133,
+25,247,134,252,111,5,73,247,227,227,7,251,33,149,251,132,248,113,119,180,
+106,170,68,158,25,208,167,211,207,198,229,229,247,29,166,248,18,29,14,247,
+104,249,70,249,46,21,247,8,29,205,87,192,156,10,247,175,251,30,247,160,251,
+191,89,251,143,25,251,17,114,58,251,4,251,87,248,144,10,103,137,119,8,126,
+174,200,123,210,27,247,150,247,66,247,72,247,93,178,31,190,247,155,251,121,
+247,166,251,180,247,51,8,14,247,104,28,4,154,249,200,21,180,233,251,131,244,
+178,220,181,217,217,204,25,247,86,51,5,195,178,186,186,186,26,205,87,192,
+43,70,67,118,90,79,30,36,54,92,41,92,43,251,95,228,24,99,44,247,89,53,118,
+101,115,103,110,105,25,248,82,10,239,248,152,247,7,10,251,107,254,216,204,
+10,155,163,153,164,152,164,8,14,249,108,56,29,14,249,108,56,29,252,118,248,
+140,78,29,249,108,56,29,252,138,248,61,39,29,249,108,77,29,7,247,80,131,251,
+105,251,99,98,31,244,6,239,248,144,181,29,14,252,190,58,29,14,253,130,247,
+110,252,64,21,186,7,135,124,72,118,247,53,29,201,241,179,146,160,30,14,253,
+125,248,101,249,195,21,186,7,135,125,71,119,112,27,100,111,171,174,147,31,
+247,56,249,165,5,84,6,251,99,102,5,102,7,247,10,129,251,39,253,85,5,137,125,
+137,122,127,26,86,170,104,221,202,239,178,145,162,30,14,252,190,58,29,247,
+177,28,7,46,35,29,252,190,58,29,251,1,252,186,44,29,252,190,58,29,251,60,
+251,125,247,51,29,252,190,58,29,251,194,251,238,66,29,252,190,58,29,251,194,
+251,238,72,10,248,241,28,8,60,68,29,252,190,58,29,251,181,251,193,54,10,251,
+173,58,29,247,159,249,23,245,10,251,150,58,29,247,227,28,5,92,78,10,252,190,
+248,175,247,23,21,121,102,49,116,100,27,81,92,196,195,150,31,247,141,28,5,
+26,234,10,188,211,152,163,190,30,137,125,90,251,117,96,47,53,100,25,251,52,
+247,23,5,248,74,10,233,247,117,247,134,182,30,14,253,125,248,101,249,244,
+21,128,115,81,125,247,53,29,171,186,147,153,172,30,138,131,107,251,27,111,
+84,83,115,25,35,218,5,139,67,123,86,26,96,155,106,222,247,53,200,247,27,247,
+37,167,30,14,252,190,249,9,249,154,21,251,134,6,247,33,249,115,227,10,251,
+4,252,230,5,251,95,6,116,251,4,5,247,95,6,49,252,101,144,29,227,248,95,5,
+247,131,6,14,252,190,248,252,250,196,21,247,4,251,42,7,201,247,217,227,10,
+103,251,76,5,251,79,251,4,247,58,6,251,60,253,255,144,29,247,57,249,249,5,
+14,252,190,249,29,250,5,21,251,133,6,247,12,249,8,227,10,45,252,123,5,251,
+93,6,117,251,5,5,247,95,6,120,41,5,251,97,6,119,251,5,5,247,95,6,69,251,252,
+144,29,206,247,246,5,247,132,6,159,247,5,5,251,129,6,157,237,5,247,132,6,
+14,252,149,249,113,249,232,21,251,0,6,82,116,84,102,104,27,108,113,143,147,
+120,31,247,34,249,119,5,61,247,164,10,39,252,154,5,133,133,141,133,27,251,
+40,248,69,10,174,27,168,159,135,133,158,31,38,252,156,5,133,248,6,29,237,
+247,46,205,151,172,30,217,7,133,118,35,104,100,27,80,91,192,199,152,31,221,
+248,68,5,163,6,248,159,10,252,190,248,179,251,246,21,247,238,29,143,190,145,
+174,30,247,187,28,6,12,227,10,251,129,28,251,43,247,224,10,30,14,253,125,
+248,104,248,209,21,180,121,159,114,147,30,251,18,57,5,105,159,134,189,188,
+26,170,142,170,142,160,30,247,84,250,52,248,87,29,251,46,253,122,5,129,92,
+133,91,94,26,251,12,201,39,247,55,193,181,160,187,30,14,252,65,249,58,247,
+144,21,239,92,197,45,67,75,118,104,70,30,247,111,28,4,131,248,87,10,251,111,
+28,251,139,251,32,251,23,119,117,45,251,21,25,208,90,195,225,167,167,231,
+235,25,251,31,156,247,48,147,196,27,247,66,247,60,247,9,247,52,31,251,15,
+118,21,58,63,87,59,70,112,172,194,150,143,163,143,174,30,178,207,176,163,
+204,27,199,153,115,75,31,14,252,115,249,52,249,58,21,83,204,78,80,94,112,
+67,123,25,247,58,249,248,5,247,70,29,76,251,236,5,133,248,6,29,235,247,48,
+205,151,171,30,217,7,133,117,36,104,101,27,77,94,192,199,149,31,205,247,230,
+225,155,225,186,219,213,25,252,17,247,78,247,173,10,252,115,248,56,248,177,
+21,225,155,225,186,219,213,83,204,24,78,80,94,112,67,123,247,58,249,248,24,
+247,70,29,62,252,46,247,224,10,247,238,29,145,202,143,162,30,121,250,27,247,
+173,10,251,234,249,131,192,21,247,150,10,247,26,249,81,251,173,35,247,27,
+249,89,227,10,251,35,253,125,247,173,246,37,252,169,247,2,29,14,252,190,77,
+250,58,21,61,7,145,162,243,174,178,27,197,186,82,83,128,31,251,131,28,251,
+27,5,218,6,247,212,200,5,201,7,251,74,157,247,107,250,242,5,143,166,141,164,
+159,26,227,90,201,251,17,43,251,48,73,127,106,30,14,251,194,249,73,249,201,
+21,251,250,253,98,82,162,135,188,144,167,25,247,141,28,5,26,234,10,30,247,
+71,10,144,58,29,248,185,28,4,236,70,29,128,250,206,192,21,247,150,10,247,
+58,249,252,5,247,106,242,251,86,6,202,247,223,227,10,102,251,82,5,251,244,
+6,202,247,223,227,10,102,251,82,5,251,92,36,247,72,6,251,60,254,2,144,29,
+247,58,249,252,5,247,244,6,251,60,254,2,247,2,29,14,180,250,219,247,46,29,
+247,114,29,114,145,114,152,115,31,129,6,81,92,196,195,150,31,247,141,28,5,
+26,234,10,197,218,163,160,201,30,112,185,204,121,225,247,34,29,181,247,251,
+22,247,56,249,238,5,247,39,6,251,10,253,2,247,105,29,224,247,9,179,167,211,
+30,138,225,5,125,94,82,124,88,248,128,10,247,17,249,23,5,247,149,233,251,
+131,6,224,248,91,251,95,82,62,252,34,5,251,38,6,227,248,91,251,93,82,62,252,
+34,5,251,95,45,247,77,6,251,56,253,238,5,14,181,250,19,249,226,21,138,244,
+252,3,251,35,155,232,248,24,247,43,5,244,7,252,4,251,35,179,247,115,5,138,
+138,138,138,141,140,141,141,26,136,7,143,7,144,156,153,157,162,141,247,2,
+147,24,227,252,98,51,7,247,0,131,161,137,146,118,137,120,25,140,143,139,144,
+141,144,85,251,200,24,251,177,251,2,140,34,247,156,241,123,46,251,177,251,
+2,5,34,7,247,157,242,251,1,253,4,5,247,120,6,248,32,247,92,247,212,247,192,
+192,31,251,46,6,251,68,108,53,251,235,251,253,27,84,6,244,248,231,5,14,233,
+28,4,178,250,82,21,247,198,29,57,37,242,251,15,27,251,3,55,76,61,91,31,247,
+14,249,18,234,10,225,247,48,197,160,195,30,116,220,222,83,240,247,48,29,251,
+120,197,21,228,248,106,5,100,154,173,103,195,27,247,141,29,253,3,253,109,
+109,160,121,177,147,176,25,14,209,28,4,205,250,50,21,251,23,237,71,47,5,135,
+113,108,131,112,251,27,251,15,218,251,31,27,96,96,129,119,102,31,241,248,
+176,234,10,235,247,48,205,151,172,30,217,7,133,116,37,104,100,27,77,94,192,
+199,150,31,247,6,248,236,5,163,164,178,158,171,219,211,92,215,27,208,247,
+56,159,139,31,252,217,252,156,247,4,247,72,10,251,81,251,80,251,88,251,89,
+84,82,147,204,100,30,120,247,75,5,147,115,102,153,114,27,62,65,71,60,251,
+52,247,84,61,247,85,247,168,247,232,247,78,247,198,247,125,251,68,247,17,
+251,105,149,31,14,251,176,248,0,248,36,21,136,195,135,205,217,26,248,59,221,
+247,150,220,188,163,100,251,115,251,110,39,251,118,251,21,251,67,30,247,188,
+68,21,251,91,65,75,106,95,27,102,101,180,247,17,116,31,247,79,247,114,247,
+42,247,212,247,199,26,247,154,75,170,251,0,251,16,251,103,251,183,253,79,
+75,143,78,150,89,30,80,83,79,95,82,110,189,50,24,190,166,192,176,189,185,
+8,251,0,182,209,84,233,27,222,208,170,247,176,247,15,31,14,251,79,247,76,
+247,248,21,239,247,89,216,251,89,171,247,13,181,247,13,178,247,12,25,213,
+251,17,205,251,29,251,64,26,38,95,59,45,105,30,149,103,5,247,55,163,237,209,
+247,36,26,247,111,251,26,247,66,42,247,80,30,179,247,28,169,247,26,247,21,
+26,244,91,175,67,251,25,85,251,9,46,251,37,217,251,16,220,251,25,30,118,68,
+116,68,117,72,66,247,76,24,251,99,252,35,5,248,70,250,15,21,140,46,120,251,
+3,110,251,7,8,101,225,113,230,239,26,208,152,188,182,174,158,127,75,140,30,
+14,181,250,48,248,184,21,239,252,25,7,144,164,143,165,144,163,141,151,141,
+153,142,153,8,248,4,239,251,242,6,178,247,87,210,247,119,247,109,150,229,
+251,78,24,195,147,247,35,174,243,26,247,9,251,68,172,38,251,244,251,22,251,
+151,251,177,75,30,251,79,39,247,59,6,132,100,133,101,133,101,8,251,40,39,
+247,25,6,125,58,119,59,100,59,92,49,65,33,251,19,114,8,53,250,115,247,58,
+252,78,7,65,251,25,133,106,47,31,247,61,247,1,206,247,51,175,247,45,8,14,
+103,47,29,14,252,44,249,138,250,136,21,60,6,92,251,33,5,124,133,128,129,122,
+27,251,154,6,247,33,249,61,142,151,150,151,158,140,25,218,145,5,248,135,10,
+247,163,29,248,251,7,14,251,141,249,175,247,179,21,248,13,10,247,54,249,148,
+143,166,159,151,164,141,25,245,149,5,248,33,29,251,43,253,111,248,56,29,14,
+252,182,249,12,250,81,21,65,6,100,35,5,130,135,133,134,128,27,251,87,6,244,
+248,97,142,155,152,146,155,140,25,208,145,5,186,251,221,92,7,222,133,161,
+138,146,130,135,125,25,41,252,75,135,124,126,132,122,138,25,70,133,5,92,248,
+139,7,14,103,47,29,247,9,28,7,19,35,29,103,47,29,251,133,252,133,44,29,103,
+47,29,251,110,251,72,68,29,103,47,29,252,70,251,185,66,29,103,47,29,252,70,
+251,185,72,10,248,205,28,7,236,68,29,103,47,29,252,57,251,140,54,10,247,129,
+47,29,248,45,249,76,245,10,103,47,29,247,64,28,5,55,78,10,103,181,10,245,
+248,196,5,247,140,6,164,247,6,5,251,142,6,227,248,97,87,29,51,252,97,5,251,
+119,6,116,251,6,5,247,120,6,36,252,163,230,29,103,249,203,250,128,21,247,
+6,251,181,7,162,247,11,87,29,116,251,11,5,251,103,251,6,247,81,6,251,60,253,
+249,247,58,29,250,70,7,213,248,15,5,248,14,29,247,64,250,26,5,14,103,181,
+10,209,248,7,5,247,162,246,251,142,6,172,247,55,5,247,158,246,251,138,6,213,
+248,23,87,29,65,252,23,5,251,137,32,247,117,6,106,251,55,5,251,135,32,247,
+115,6,73,251,230,230,29,103,181,10,235,248,136,5,154,6,247,39,229,244,247,
+10,196,31,33,6,84,116,82,106,104,27,115,118,143,146,123,31,233,248,125,87,
+29,61,252,42,5,123,6,251,39,46,35,251,11,82,31,247,1,6,195,161,196,171,176,
+27,164,157,137,133,158,31,251,1,252,189,230,29,251,141,123,248,15,21,184,
+49,247,25,206,92,251,121,248,56,29,203,247,179,5,248,13,10,216,248,5,247,
+167,247,31,92,230,251,93,37,5,204,247,200,132,102,139,26,143,166,159,151,
+164,141,245,149,24,248,33,29,61,252,11,5,14,214,250,148,22,211,248,17,5,251,
+12,6,64,251,138,5,121,134,111,122,122,27,252,41,6,212,248,16,226,158,224,
+189,213,203,25,101,200,83,87,87,106,56,119,25,247,19,249,44,142,159,157,162,
+168,141,25,247,16,147,5,227,252,168,51,7,247,13,131,166,137,146,116,136,119,
+25,75,251,226,5,153,113,113,144,108,27,53,251,11,71,251,23,116,31,114,251,
+35,247,7,56,247,32,125,74,251,230,24,136,119,121,116,110,137,251,13,131,24,
+51,7,245,249,103,21,197,149,181,188,204,27,167,168,132,117,157,31,94,251,
+126,47,155,66,179,157,239,25,14,247,133,28,4,242,247,77,29,247,37,249,138,
+251,190,251,1,232,248,122,87,29,251,21,253,47,247,190,247,1,34,252,180,230,
+29,103,247,11,250,119,21,247,13,6,212,247,128,5,163,148,155,156,166,27,248,
+39,6,251,109,28,251,145,135,119,122,120,109,247,190,10,247,105,248,52,10,
+254,70,7,14,248,159,47,29,249,71,28,5,33,70,29,250,46,47,29,28,4,160,189,
+10,14,248,0,28,5,109,247,77,29,247,109,28,4,111,143,159,156,158,169,141,25,
+247,13,149,5,225,254,56,247,119,29,28,5,66,7,252,240,28,4,254,21,174,137,
+147,123,135,116,248,62,29,24,135,115,121,126,112,137,87,134,24,88,144,102,
+247,203,29,247,105,250,226,145,166,147,151,166,141,25,199,143,5,14,248,128,
+59,10,14,85,250,38,252,64,21,181,7,129,106,110,127,117,27,105,108,167,178,
+147,31,214,247,224,5,233,159,93,201,50,27,58,41,85,80,76,31,183,132,117,208,
+49,27,61,52,84,81,74,31,164,247,5,5,84,6,251,91,101,5,103,7,247,2,128,251,
+6,252,158,5,247,14,6,233,248,49,5,169,165,225,217,201,27,196,150,72,86,127,
+31,50,252,37,5,247,15,6,233,248,51,5,167,157,218,217,220,27,174,173,100,57,
+121,31,65,251,221,5,83,128,186,109,211,27,191,209,169,156,185,31,14,80,28,
+4,125,249,195,105,10,247,86,28,4,166,105,10,248,128,59,10,251,201,28,5,78,
+35,29,248,128,59,10,252,125,28,4,236,46,29,248,128,59,10,253,196,251,238,
+66,29,248,223,28,6,48,197,21,35,6,84,251,190,111,29,193,247,174,87,10,248,
+128,28,6,120,248,236,21,35,6,77,101,51,97,251,31,27,251,4,251,82,160,163,
+251,20,31,171,251,65,251,99,166,61,27,251,190,61,73,251,43,47,31,242,6,203,
+182,224,179,247,28,27,247,22,247,48,115,116,247,25,31,117,247,22,247,110,
+104,247,9,27,247,212,203,215,247,33,229,31,66,252,183,87,10,181,250,243,192,
+21,209,7,122,103,108,119,116,27,102,106,186,205,147,31,220,248,189,151,223,
+130,208,113,184,25,247,65,247,115,5,251,1,6,251,22,251,58,5,142,129,127,141,
+127,27,51,34,49,40,70,31,213,132,115,247,7,43,27,54,46,47,42,68,31,167,247,
+81,5,80,6,251,107,75,5,80,7,247,11,120,251,15,253,250,5,247,24,6,239,249,
+68,5,190,168,231,247,21,206,27,201,150,251,4,51,126,31,99,251,173,252,53,
+252,170,5,247,5,6,247,170,247,250,109,251,103,5,247,25,6,200,248,59,247,179,
+248,5,145,107,139,97,132,87,25,60,252,183,5,45,127,190,89,217,27,195,214,
+189,167,188,31,252,100,249,19,21,186,159,223,247,21,227,27,143,6,251,102,
+251,162,5,14,249,166,28,6,245,249,201,21,251,252,253,102,81,156,132,178,150,
+189,25,247,6,248,183,124,29,43,252,101,247,23,29,248,128,28,5,209,249,201,
+21,247,9,69,213,251,6,251,17,251,42,49,40,41,30,244,10,235,143,251,21,68,
+125,247,168,10,231,137,251,29,74,127,31,251,29,253,64,106,251,48,92,251,37,
+55,93,25,251,64,247,19,5,96,125,71,106,68,26,63,188,102,223,247,238,247,34,
+247,248,247,169,194,30,247,9,248,224,5,145,163,141,164,159,26,14,62,250,203,
+28,4,252,21,209,94,184,63,58,42,85,80,76,30,247,25,29,201,143,63,96,131,247,
+231,29,196,137,57,100,131,31,49,252,48,118,45,109,53,83,112,25,251,2,215,
+5,110,131,94,118,96,26,94,172,117,192,247,117,244,247,105,247,60,172,30,210,
+247,244,5,141,153,141,152,153,26,14,248,128,102,10,102,251,81,5,221,6,247,
+202,248,161,10,80,250,234,28,5,96,21,251,25,6,53,252,49,5,110,112,55,59,78,
+27,82,130,207,192,150,31,227,248,37,5,251,26,6,51,252,51,5,110,119,67,61,
+57,27,105,110,180,221,155,31,211,247,220,5,196,149,94,168,65,27,90,57,110,
+120,94,31,99,7,149,172,170,149,159,27,174,170,112,100,131,31,71,251,223,5,
+42,121,184,80,229,27,221,235,192,199,202,31,94,148,157,71,229,27,219,223,
+194,197,204,31,115,251,5,5,192,6,247,95,176,5,176,7,251,5,149,5,14,248,128,
+102,10,251,17,252,246,5,223,6,247,202,202,5,198,7,251,64,158,5,14,74,250,
+230,28,5,97,21,251,17,6,48,252,49,5,109,112,53,61,78,27,81,128,207,191,152,
+31,228,248,37,5,251,16,6,46,252,51,5,111,118,63,61,56,27,104,106,178,222,
+158,31,210,247,220,5,196,153,91,168,65,27,89,69,110,121,92,31,97,7,148,174,
+168,151,159,27,174,171,112,100,129,31,66,251,223,5,44,118,185,77,228,27,221,
+235,194,197,204,31,95,145,162,70,228,27,218,225,195,196,203,31,58,252,2,5,
+193,6,247,94,248,161,29,247,162,247,105,251,11,21,209,6,122,190,119,184,172,
+26,186,177,182,194,146,145,138,138,146,30,251,12,248,214,163,136,161,27,247,
+8,212,208,247,7,247,17,49,247,42,40,237,31,213,149,247,7,174,247,29,26,247,
+13,47,247,25,42,240,30,247,81,100,5,223,7,75,247,199,5,80,6,120,251,62,253,
+250,247,68,5,251,80,7,249,68,251,36,5,190,98,247,21,251,23,43,26,72,73,113,
+69,118,117,142,247,33,253,69,30,251,82,7,249,72,251,36,5,186,111,247,21,251,
+13,251,17,26,96,97,96,50,118,115,142,247,10,252,209,30,141,129,130,140,130,
+27,63,99,69,40,59,189,251,0,167,69,31,14,248,3,120,29,247,15,247,58,217,139,
+30,14,248,3,120,29,181,186,149,151,183,30,251,111,251,199,248,82,29,247,147,
+247,254,139,30,14,249,48,63,10,14,249,48,63,10,14,189,28,5,37,248,85,10,251,
+200,99,7,251,247,252,224,251,7,248,230,5,173,251,189,88,7,213,133,163,247,
+191,29,247,197,191,7,65,145,116,140,134,149,142,151,25,247,15,248,253,247,
+25,253,78,5,219,6,248,63,249,84,251,20,253,3,136,125,125,131,123,138,25,61,
+133,5,87,247,238,191,7,64,145,116,140,133,149,141,151,25,247,30,249,41,143,
+155,151,147,156,140,25,14,247,208,28,5,176,250,33,21,217,252,33,86,7,252,
+56,253,50,251,27,249,54,5,188,252,48,61,7,246,247,242,29,251,46,253,111,248,
+130,10,32,129,5,61,248,62,217,7,43,247,243,29,247,29,249,35,247,46,253,164,
+5,247,0,6,248,130,249,166,251,31,253,39,133,114,120,127,113,137,25,42,129,
+5,61,248,116,217,7,251,1,149,104,143,131,153,143,162,25,247,46,248,125,10,
+249,48,63,10,251,239,248,169,35,29,249,48,63,10,252,163,248,71,46,29,249,
+48,63,10,254,22,28,249,221,66,29,249,48,28,6,145,28,4,213,21,248,105,10,247,
+8,149,24,182,29,251,125,28,251,96,5,251,118,95,251,18,251,16,251,23,27,94,
+100,161,160,118,31,104,247,64,5,139,115,149,112,78,71,84,77,127,30,251,43,
+108,247,23,73,247,111,27,247,245,247,39,247,246,244,159,31,14,248,128,86,
+10,250,226,248,205,28,4,209,21,143,159,157,162,168,141,247,17,147,24,248,
+34,10,251,56,253,208,5,131,104,137,109,108,26,251,111,247,54,251,15,247,92,
+247,42,247,19,203,241,247,45,30,251,1,184,242,82,247,29,27,247,56,223,215,
+247,15,247,70,31,104,251,58,5,248,21,227,6,251,9,149,113,141,129,160,143,
+155,25,247,109,250,220,247,140,29,251,80,254,75,5,55,251,17,67,78,251,29,
+27,251,75,88,247,19,247,74,174,31,247,50,249,167,247,140,29,251,58,253,208,
+127,74,137,81,145,88,25,98,53,251,17,86,57,27,251,74,32,247,19,247,74,174,
+31,14,249,41,28,5,72,247,167,29,122,51,244,131,167,137,151,116,135,119,25,
+251,108,254,253,251,111,28,4,246,5,39,6,253,65,28,251,29,247,104,250,234,
+143,159,159,162,167,141,25,247,9,147,156,227,5,252,70,6,122,51,247,4,131,
+168,137,149,248,152,10,120,116,110,137,25,251,8,131,123,51,5,248,86,6,149,
+194,248,191,250,130,247,65,254,124,128,78,5,248,97,6,155,227,33,247,218,10,
+247,2,147,156,227,5,14,28,5,175,28,6,21,250,251,21,247,62,28,251,120,5,247,
+44,6,249,59,28,5,17,247,11,161,156,227,5,252,35,6,122,51,247,1,129,157,137,
+150,116,130,123,25,252,144,254,112,251,62,28,4,136,5,251,45,6,252,174,254,
+154,251,44,250,154,5,251,45,6,253,58,28,250,239,251,11,117,123,51,5,248,34,
+6,155,227,251,0,149,122,141,127,162,148,155,25,248,144,250,112,247,36,254,
+116,141,127,127,116,124,137,25,251,12,129,123,51,5,248,116,6,155,227,251,
+7,159,129,207,5,14,249,106,132,10,248,38,247,153,10,103,141,130,156,143,159,
+25,247,103,250,226,248,45,10,14,204,250,212,247,95,21,247,24,92,202,33,245,
+30,251,131,247,134,247,34,247,70,5,55,236,116,94,182,27,177,214,184,247,34,
+211,121,217,34,215,31,67,192,108,168,178,162,149,131,151,26,151,140,145,120,
+106,251,18,57,251,33,79,146,91,242,61,30,251,28,251,63,251,177,247,176,5,
+251,31,247,32,119,163,189,162,164,161,148,26,154,141,152,119,106,251,4,43,
+251,30,251,24,181,76,246,32,30,186,92,5,251,30,251,44,96,34,47,251,10,247,
+5,251,8,63,26,87,74,115,79,132,30,129,90,5,247,146,6,236,219,206,230,31,247,
+58,251,126,247,7,247,57,26,173,145,176,186,208,30,248,113,252,113,5,247,35,
+251,34,156,113,92,115,114,119,127,26,128,137,123,158,172,247,8,235,247,30,
+30,14,252,25,248,215,252,71,21,138,182,5,130,108,110,132,115,27,124,88,143,
+186,148,31,210,247,239,5,247,2,160,96,186,42,27,50,39,80,84,81,31,164,247,
+6,5,85,248,3,10,251,7,252,158,5,247,16,6,230,248,49,5,196,198,229,189,182,
+27,168,182,119,74,126,31,57,252,13,5,73,124,230,132,171,27,195,239,171,147,
+161,31,14,252,26,245,29,251,7,252,159,5,247,28,6,220,248,48,247,98,10,127,
+39,10,48,28,5,90,35,29,127,39,10,251,113,250,211,42,10,127,39,10,138,28,5,
+154,48,10,127,39,10,251,163,28,4,248,46,29,127,39,10,252,37,252,174,44,29,
+127,39,10,252,14,251,113,68,29,127,39,10,252,230,251,226,66,29,127,39,10,
+252,217,251,181,54,10,127,250,203,247,5,21,124,92,92,248,42,29,247,1,248,
+214,82,10,251,17,253,9,248,38,10,184,200,154,153,195,31,106,251,66,86,251,
+39,55,108,251,50,247,13,24,139,251,5,112,51,26,67,166,84,247,17,247,140,221,
+247,103,247,132,186,30,14,127,28,4,116,248,236,21,251,0,6,84,104,86,90,41,
+27,61,55,159,164,49,31,165,47,251,45,172,84,27,251,101,63,52,251,22,61,31,
+246,6,194,173,195,188,234,27,230,234,111,120,205,31,113,229,247,18,108,221,
+27,247,116,201,225,247,23,220,31,78,252,195,21,137,211,5,124,92,94,248,42,
+29,247,1,248,214,82,10,251,17,253,9,247,41,29,14,143,28,4,117,248,197,21,
+122,233,251,71,106,163,247,20,247,87,29,58,252,29,251,60,109,153,48,247,26,
+163,62,252,16,5,247,83,6,224,248,51,248,29,209,62,252,25,247,41,29,137,211,
+5,124,92,94,248,42,29,205,247,243,5,252,183,247,57,21,248,61,10,111,251,33,
+252,29,68,5,14,247,161,28,4,240,249,201,21,251,252,253,102,86,156,138,178,
+149,189,25,247,1,248,181,82,10,34,252,160,247,23,29,127,250,203,180,21,137,
+211,5,124,92,94,248,42,29,247,1,248,214,247,87,29,251,82,254,66,102,251,68,
+100,57,78,121,25,251,26,247,64,5,123,39,88,55,75,155,68,247,11,247,105,247,
+74,247,27,247,195,201,31,247,31,249,76,248,185,10,225,247,45,193,151,174,
+31,14,252,26,245,29,251,17,252,202,117,33,114,90,98,128,25,53,242,5,129,73,
+108,90,100,150,96,216,247,32,247,23,219,247,74,176,31,220,248,54,247,98,10,
+99,250,101,249,216,21,247,14,247,127,10,251,70,253,250,193,10,14,252,53,249,
+119,28,5,6,21,213,96,170,59,49,43,81,84,80,30,161,247,5,5,86,6,251,95,248,
+129,10,251,7,252,159,5,247,27,6,221,248,48,5,196,199,227,191,182,27,190,155,
+96,96,129,31,43,252,79,112,251,17,117,82,71,114,25,37,213,5,139,65,119,81,
+26,109,168,106,210,247,56,247,27,247,21,247,33,168,30,233,248,97,5,143,157,
+141,158,155,26,14,127,28,4,109,251,193,21,211,65,153,139,30,251,87,251,13,
+5,96,156,111,161,200,26,176,153,236,155,223,30,247,38,249,148,220,29,251,
+40,253,119,5,127,77,129,59,107,26,251,69,247,5,58,247,103,222,247,24,175,
+247,1,30,14,252,26,249,228,248,238,21,182,92,149,139,30,251,19,66,5,110,149,
+121,151,176,26,162,151,198,149,188,30,233,248,97,247,109,29,251,7,252,159,
+5,247,28,6,220,248,48,248,63,29,43,252,79,5,131,102,133,90,121,26,32,210,
+90,247,30,194,223,162,202,30,14,209,28,4,174,247,144,21,231,90,180,49,69,
+108,123,108,72,30,217,248,48,82,10,32,252,164,251,53,251,30,251,17,251,70,
+98,55,25,223,104,174,197,233,247,29,247,13,247,13,25,86,161,217,89,247,19,
+27,247,52,247,39,247,5,247,56,31,45,110,21,70,71,65,51,63,119,184,186,147,
+30,139,147,180,141,159,30,176,203,170,162,202,27,184,170,114,94,31,14,127,
+250,203,180,21,137,211,5,124,92,94,248,42,29,247,1,248,214,82,10,251,17,253,
+9,119,46,235,117,199,134,25,101,106,79,72,118,202,29,155,167,197,150,164,
+30,226,151,247,9,179,169,150,8,14,127,250,115,252,42,21,137,211,5,125,92,
+94,127,102,27,115,61,147,219,153,31,247,89,250,146,220,29,251,105,254,199,
+5,251,3,116,247,32,131,188,27,225,247,45,190,151,174,31,14,248,183,39,10,
+248,187,28,4,248,70,29,121,33,29,14,121,33,29,251,71,250,203,42,10,121,33,
+29,83,28,5,43,80,10,121,250,46,185,21,93,7,251,113,251,202,248,82,29,247,
+144,247,250,139,30,108,176,5,170,102,81,29,40,28,5,43,80,10,121,33,29,108,
+28,5,6,68,29,121,33,29,118,28,4,240,39,29,251,43,250,244,248,85,10,251,201,
+88,7,215,133,162,138,144,129,137,125,25,251,6,252,172,251,191,248,223,5,170,
+251,149,88,7,213,133,162,247,191,29,247,201,191,7,65,145,115,140,134,149,
+141,151,25,247,10,248,207,247,228,253,32,5,235,6,247,49,249,122,143,155,151,
+147,156,140,25,14,207,28,4,186,250,33,21,217,252,64,61,7,247,1,129,174,135,
+147,125,135,116,25,251,17,252,218,251,246,249,48,5,182,251,251,61,7,246,247,
+242,29,251,48,253,111,247,158,29,247,29,249,1,248,34,253,130,248,136,10,247,
+74,249,238,248,134,29,14,251,231,250,21,28,5,49,21,186,251,171,92,7,207,133,
+164,137,145,131,135,124,25,59,251,240,251,124,248,36,5,165,251,123,92,7,207,
+133,161,137,145,131,137,124,25,39,252,74,5,125,135,126,131,123,27,78,132,
+5,92,247,170,186,7,70,146,114,141,135,147,141,151,25,227,248,11,247,150,252,
+87,5,223,6,247,11,248,150,143,156,151,145,156,141,25,14,247,251,38,10,251,
+98,248,169,35,29,247,251,38,10,251,228,247,142,42,10,247,251,38,10,251,8,
+248,233,48,10,247,251,38,10,252,22,248,71,46,29,247,251,38,10,252,200,28,
+249,17,44,29,247,251,38,10,252,177,28,250,78,68,29,247,251,38,10,253,137,
+28,249,221,66,29,247,251,38,10,253,124,28,250,10,54,10,181,250,196,249,30,
+21,251,51,6,155,247,7,5,247,47,6,153,239,5,251,47,6,190,248,8,143,166,152,
+151,158,141,25,220,149,5,225,251,224,53,7,221,129,163,137,145,123,136,116,
+25,88,252,8,5,251,135,6,251,43,248,92,5,192,251,168,53,7,219,129,163,137,
+145,123,136,116,25,89,252,8,5,251,67,248,162,10,247,67,6,124,251,7,5,251,
+64,248,162,10,247,64,6,84,252,51,135,115,127,126,120,137,25,57,129,5,53,247,
+224,225,7,59,149,114,141,133,156,142,159,25,194,248,51,5,247,142,6,247,75,
+252,186,5,243,6,214,248,186,5,247,50,6,253,121,247,107,21,247,41,6,178,251,
+7,5,251,95,6,247,217,247,7,21,247,88,6,123,251,7,5,251,34,6,251,197,248,73,
+21,212,251,114,5,36,6,248,4,251,207,21,235,6,111,251,98,5,14,248,5,28,6,42,
+249,220,21,113,247,13,251,123,96,201,247,211,248,45,29,247,8,149,5,248,33,
+10,71,251,240,251,226,77,251,125,248,130,5,192,252,31,53,7,248,7,10,40,252,
+153,251,159,90,151,251,0,247,125,180,49,248,165,10,248,111,225,7,251,6,149,
+102,247,203,29,234,248,132,247,172,188,247,215,253,60,5,247,40,6,247,46,249,
+170,5,252,51,66,21,247,150,185,58,252,55,5,252,216,249,123,21,247,34,251,
+191,251,99,100,5,14,248,115,248,229,250,211,21,247,207,29,247,8,149,5,186,
+29,251,128,28,251,45,101,251,92,96,251,7,37,100,25,251,31,247,28,5,76,128,
+81,75,78,26,85,167,76,247,44,247,104,247,44,247,91,247,133,185,30,14,247,
+251,250,113,22,242,126,247,12,251,8,81,251,183,8,244,6,237,248,144,5,251,
+95,6,247,116,28,4,125,248,205,10,251,103,254,226,247,57,10,248,111,225,7,
+251,6,149,102,247,203,29,247,74,250,76,5,14,133,249,233,249,149,21,251,29,
+253,22,247,158,29,247,48,249,109,145,166,152,151,158,141,25,246,149,5,217,
+251,251,91,7,252,237,253,48,247,17,248,223,248,134,29,235,149,5,217,252,54,
+61,7,238,129,174,135,147,125,135,116,25,251,74,253,238,5,247,42,6,14,251,
+96,249,177,28,5,147,21,251,1,252,172,134,118,124,129,120,137,25,62,131,5,
+74,247,234,204,7,54,147,111,143,131,151,142,158,25,247,17,248,244,143,162,
+150,149,154,141,25,225,147,5,204,251,180,99,7,252,116,252,194,239,248,126,
+143,162,155,149,158,141,25,216,147,5,204,251,227,74,7,218,131,167,135,146,
+128,136,119,25,251,38,253,96,5,247,12,6,14,248,24,28,5,131,250,173,21,248,
+149,29,251,62,41,251,73,251,23,30,186,247,138,5,252,25,53,6,247,63,29,251,
+105,248,186,29,247,50,249,193,5,229,190,247,121,247,111,247,50,27,247,48,
+247,23,251,6,251,56,108,31,251,91,254,193,113,251,33,118,247,189,29,247,25,
+246,247,164,188,31,247,93,250,193,5,143,164,141,161,162,26,14,248,23,248,
+140,250,72,21,229,190,247,119,247,111,247,50,27,247,48,247,23,251,6,251,56,
+108,31,251,139,28,250,219,247,58,29,248,167,225,7,251,7,149,104,142,129,155,
+143,159,25,247,141,28,5,37,5,143,164,141,161,162,26,247,70,10,251,105,248,
+165,29,248,171,225,7,251,11,149,104,142,130,155,143,159,25,14,250,42,38,10,
+248,207,174,70,29,28,5,37,38,10,250,188,191,29,250,136,28,8,16,249,95,21,
+247,70,251,0,247,25,251,95,251,166,251,89,251,140,251,152,251,72,247,1,251,
+21,247,92,247,163,247,94,247,138,247,152,30,251,86,253,95,21,235,253,3,43,
+7,248,11,28,5,25,21,194,96,186,71,251,193,80,251,185,251,129,92,30,34,252,
+159,251,197,250,93,150,190,5,252,38,55,6,247,15,129,5,164,153,121,114,135,
+31,251,74,254,42,100,251,86,89,123,84,122,25,251,17,247,13,5,86,114,88,82,
+78,26,83,184,92,204,247,193,199,247,183,247,132,188,30,247,17,249,15,247,
+246,28,251,147,5,247,27,6,247,101,250,179,178,247,86,190,156,193,153,25,247,
+17,251,13,5,194,166,188,196,201,26,247,175,252,214,21,251,62,42,251,162,251,
+92,251,3,84,229,247,23,247,62,235,247,162,247,93,247,2,195,49,251,23,30,14,
+247,253,53,29,14,247,253,53,29,251,218,247,142,42,10,247,253,53,29,251,40,
+248,150,78,29,247,253,28,4,163,225,21,53,247,185,29,247,117,28,4,176,101,
+10,251,56,248,150,78,29,247,253,53,29,251,60,248,71,39,29,247,253,53,29,251,
+70,248,93,68,29,78,42,29,14,252,76,248,86,47,21,247,59,251,2,211,251,20,251,
+101,251,36,251,83,251,91,251,34,230,49,247,38,247,97,247,41,247,77,247,90,
+30,251,26,145,21,251,37,62,251,80,251,19,72,87,200,247,14,247,51,228,247,
+63,247,8,206,190,75,251,8,30,14,252,59,249,119,28,4,129,214,10,121,28,5,248,
+214,10,78,42,29,248,81,249,168,61,29,78,42,29,247,126,248,141,49,29,78,42,
+29,247,124,248,141,72,29,247,62,249,63,35,29,78,42,29,247,124,248,141,248,
+208,10,78,42,29,247,124,248,141,72,29,247,159,249,67,35,10,78,42,29,247,124,
+248,141,248,215,29,78,42,29,251,184,254,40,248,204,10,78,42,29,247,80,248,
+199,58,10,78,42,29,247,152,249,180,57,29,78,42,29,247,197,249,232,48,10,78,
+42,29,247,204,249,172,248,216,29,78,42,29,247,204,249,172,248,213,10,78,42,
+29,247,204,249,172,248,216,10,78,83,10,14,78,83,10,206,248,217,35,29,78,83,
+10,76,247,190,42,10,78,42,29,247,135,249,70,39,29,78,42,29,247,135,249,70,
+248,207,29,78,42,29,174,249,70,46,29,78,42,29,174,249,70,248,191,29,78,42,
+29,235,249,182,37,10,78,42,29,251,184,254,40,66,29,78,113,10,14,78,113,10,
+247,125,249,92,68,29,71,214,248,70,21,252,23,248,77,251,55,251,69,26,46,43,
+116,67,74,105,152,191,94,30,132,247,55,5,156,122,98,147,118,27,56,79,62,69,
+47,247,17,251,22,247,114,247,45,247,94,239,247,71,247,4,251,15,239,251,1,
+247,17,31,247,145,231,247,160,247,68,247,221,26,247,125,251,63,230,251,84,
+251,112,251,200,251,100,252,6,30,247,99,157,21,247,131,247,33,247,121,247,
+66,241,199,61,251,61,251,134,251,86,251,88,251,64,58,30,76,223,91,235,247,
+10,26,14,78,147,10,78,147,10,252,59,249,119,28,4,129,248,195,29,127,139,124,
+137,125,30,251,197,6,247,13,168,212,239,227,27,207,188,76,251,9,31,129,37,
+21,251,11,114,70,251,3,40,27,74,88,199,247,15,153,139,155,141,156,31,14,78,
+151,29,249,115,249,240,39,29,179,250,236,250,44,21,247,160,55,247,111,251,
+183,252,94,251,85,252,205,252,25,251,165,233,251,93,247,173,248,90,247,89,
+248,193,248,24,30,251,105,237,21,57,131,49,129,55,30,252,175,6,247,107,196,
+234,247,215,247,117,27,247,31,180,251,25,251,41,31,106,251,242,21,251,128,
+90,35,251,244,251,126,27,251,41,104,247,48,247,57,234,153,235,154,215,31,
+14,141,129,248,89,21,247,1,6,136,109,137,108,109,26,251,129,247,32,251,42,
+247,117,247,155,247,95,247,106,247,156,199,30,247,26,241,251,10,6,141,158,
+140,159,159,26,247,169,251,62,247,13,251,89,251,150,251,86,251,97,251,144,
+73,30,251,21,6,249,169,37,247,185,10,248,128,247,62,21,116,137,117,137,116,
+30,252,107,6,247,93,184,247,2,247,60,247,30,27,243,217,32,251,86,31,14,251,
+250,249,218,28,5,57,21,247,53,84,247,23,251,81,251,190,251,17,251,233,251,
+126,251,55,200,251,13,247,75,247,187,247,20,247,226,247,125,30,251,31,198,
+21,90,134,85,133,88,30,251,243,6,247,21,176,201,247,86,247,38,27,230,165,
+59,50,31,118,251,102,21,251,34,107,71,251,103,251,44,27,42,117,233,238,196,
+148,196,149,185,31,14,99,250,117,248,250,21,247,169,251,72,247,13,251,89,
+251,213,251,124,251,210,251,224,251,129,247,42,251,42,247,117,247,208,247,
+131,247,200,247,223,30,251,101,148,21,96,7,100,105,98,94,69,47,155,231,251,
+2,27,57,96,124,107,100,31,247,96,184,247,11,247,71,247,33,27,243,225,32,251,
+86,31,123,251,52,21,251,93,98,251,3,251,86,251,45,27,36,49,241,247,95,31,
+157,141,158,157,26,168,166,180,163,205,247,4,115,45,247,8,27,205,200,186,
+168,170,31,14,78,103,29,247,107,249,168,35,29,250,75,28,7,20,249,136,21,247,
+115,47,247,91,251,39,247,35,30,247,27,247,54,57,204,251,25,251,51,5,237,251,
+23,251,54,196,251,68,27,252,72,251,244,251,244,252,72,251,120,235,251,96,
+247,43,251,36,31,251,60,251,95,223,78,247,56,247,91,5,47,247,23,247,50,83,
+247,64,27,248,72,247,244,247,244,248,73,31,41,137,21,252,15,251,201,251,201,
+252,15,251,39,251,30,186,219,251,4,30,250,2,250,174,5,247,21,251,17,217,251,
+66,251,82,26,251,179,248,193,21,254,2,254,177,5,251,21,247,17,57,247,68,247,
+87,26,248,15,247,201,247,201,248,15,247,44,247,29,90,57,247,4,30,14,247,88,
+248,242,250,136,21,247,115,10,247,150,247,93,247,99,247,149,203,31,247,99,
+150,247,32,247,58,247,86,26,247,16,62,217,251,47,57,60,102,95,81,30,194,74,
+54,165,48,27,247,52,252,25,174,29,247,99,130,21,247,1,112,224,95,202,30,168,
+181,187,158,176,27,219,179,87,61,251,23,61,251,9,35,120,31,143,169,141,170,
+170,26,14,78,248,228,250,136,21,247,155,10,248,130,251,167,247,135,252,71,
+247,62,31,141,251,29,247,96,45,247,22,251,20,217,251,37,25,143,113,111,142,
+123,27,247,58,252,52,247,203,10,169,175,133,129,164,30,176,39,155,33,33,26,
+14,247,28,53,10,14,247,28,53,10,247,92,249,168,35,29,247,28,53,10,209,248,
+141,42,10,247,28,53,10,247,189,249,172,35,10,247,28,53,10,220,249,182,37,
+10,247,28,53,10,251,199,254,40,66,29,78,28,4,154,250,175,21,75,6,94,127,118,
+114,43,27,251,39,42,168,141,251,27,31,247,115,10,247,178,10,244,114,219,100,
+200,31,131,164,170,133,165,27,247,21,184,247,56,180,152,31,252,48,252,64,
+174,29,14,247,50,248,163,209,21,251,69,34,247,80,247,128,184,31,184,247,127,
+247,25,247,89,247,95,147,134,217,24,251,179,251,142,251,122,251,180,84,31,
+251,188,82,247,106,251,115,247,176,27,204,223,151,161,200,31,117,187,211,
+127,191,27,237,234,176,212,211,31,113,200,5,89,80,57,113,87,27,117,119,143,
+146,121,31,247,37,227,237,247,48,171,247,60,8,247,196,197,251,47,247,30,251,
+38,27,251,28,251,113,251,37,251,211,79,31,106,251,60,183,251,34,232,60,8,
+131,114,114,135,114,27,248,60,248,57,21,113,251,25,65,251,18,54,78,81,214,
+116,247,18,160,247,5,8,247,143,187,217,247,12,208,27,204,171,251,10,251,139,
+92,31,14,199,248,94,250,72,21,251,169,251,13,251,62,251,89,251,213,247,210,
+251,114,247,224,247,129,247,42,247,32,247,117,247,207,251,200,247,122,251,
+223,31,130,251,99,21,247,134,247,205,251,11,251,86,36,37,59,251,95,251,158,
+251,177,247,28,247,70,243,246,217,247,86,31,14,210,248,84,250,72,21,251,34,
+39,94,69,73,31,251,16,219,88,58,247,14,60,5,115,88,126,80,77,26,251,213,247,
+210,251,114,247,224,247,33,247,0,189,225,205,30,247,29,54,190,215,251,35,
+228,5,155,184,150,188,194,26,247,207,251,200,247,122,251,223,30,251,136,251,
+158,21,249,35,252,46,5,123,94,84,128,69,27,251,158,251,177,247,28,247,70,
+186,162,182,182,172,31,247,127,198,21,247,134,247,205,251,11,251,86,100,125,
+104,108,108,31,253,19,248,40,5,147,176,182,145,188,27,14,36,250,209,28,4,
+231,21,191,109,224,251,4,51,251,6,86,55,100,30,214,111,71,201,42,27,251,114,
+251,21,251,97,251,75,251,37,234,50,247,33,231,216,170,229,199,31,55,180,201,
+102,215,27,247,8,219,194,200,210,31,216,7,75,65,60,84,70,27,65,85,199,235,
+153,141,164,141,156,31,235,145,247,158,174,247,50,26,251,9,22,39,251,37,92,
+46,133,30,247,0,168,203,247,16,227,27,191,144,81,118,31,251,255,251,2,21,
+251,32,70,251,71,251,20,67,97,216,245,247,48,219,247,66,247,9,214,178,41,
+43,30,14,248,69,176,247,94,21,53,186,251,34,247,64,247,27,247,68,227,247,
+32,199,30,251,17,182,243,36,247,42,27,247,234,247,90,247,234,247,197,247,
+134,251,39,247,40,251,109,251,33,251,11,87,251,41,47,31,247,31,77,43,201,
+251,9,27,251,70,251,15,48,37,251,2,31,251,21,7,246,247,6,247,13,231,246,27,
+247,6,221,38,251,51,116,137,96,135,112,31,251,39,129,252,46,80,251,156,26,
+247,72,22,247,60,247,115,216,247,36,150,30,251,73,94,40,251,98,251,27,27,
+59,131,235,174,31,248,195,247,76,21,247,125,246,247,191,247,88,247,3,203,
+251,21,251,68,251,152,251,15,251,183,251,71,251,8,79,247,56,247,52,30,14,
+247,239,249,39,247,179,21,251,34,110,85,62,251,9,27,251,9,67,243,247,93,247,
+134,247,13,247,197,247,116,199,175,135,93,208,31,200,253,20,21,247,12,248,
+213,187,129,230,129,190,149,25,251,113,254,240,134,114,119,127,115,137,25,
+32,129,5,61,248,154,217,7,251,19,149,113,141,120,149,145,168,25,247,147,28,
+5,24,5,55,6,101,51,67,129,78,251,6,251,15,212,251,96,27,251,242,251,114,251,
+210,251,224,251,129,247,23,251,42,247,154,247,59,247,79,240,247,46,170,31,
+14,248,219,28,6,81,248,122,10,251,37,251,15,74,37,48,30,247,7,77,251,6,191,
+251,21,27,251,213,251,104,251,210,251,224,251,129,247,22,251,42,247,117,247,
+35,247,16,203,240,231,31,34,197,243,79,247,35,248,145,29,253,251,247,111,
+10,249,44,22,248,77,10,174,141,176,144,174,30,147,183,143,184,184,26,234,
+120,216,106,198,30,251,2,251,15,75,251,70,251,74,26,52,156,64,172,79,30,222,
+229,196,247,12,163,247,22,8,247,122,167,247,7,247,106,247,46,27,243,207,32,
+251,86,31,14,148,249,99,28,5,229,21,251,125,251,128,251,73,251,169,251,64,
+247,1,63,242,121,31,251,97,102,251,86,251,85,251,140,26,251,102,247,33,251,
+14,247,116,247,157,247,150,247,107,247,175,247,71,251,6,236,251,31,175,30,
+247,48,163,247,81,247,61,247,117,26,247,88,251,29,247,2,251,79,30,117,37,
+21,233,191,52,251,12,251,76,37,251,67,251,43,41,97,244,247,3,247,51,215,247,
+83,247,63,31,251,140,28,250,213,21,33,66,246,247,22,247,91,247,7,247,101,
+247,76,241,212,32,251,30,251,91,251,4,251,93,251,75,31,14,67,249,139,248,
+154,21,251,111,111,251,3,251,123,251,59,27,36,59,241,247,95,188,143,189,148,
+187,31,251,95,6,128,88,133,85,86,26,251,129,247,32,251,42,247,117,247,176,
+247,108,247,144,247,184,178,30,14,252,67,248,244,250,220,21,251,24,121,67,
+251,30,251,1,27,72,87,200,247,14,168,142,169,145,168,31,251,24,6,132,108,
+135,107,107,26,251,34,230,49,247,38,247,77,247,32,247,43,247,67,165,30,14,
+78,250,91,248,155,21,143,170,141,171,171,26,247,169,251,62,247,13,251,89,
+251,161,251,92,251,116,251,160,82,30,247,95,6,247,106,177,247,10,247,82,247,
+37,27,243,217,32,251,86,105,137,104,134,103,31,14,252,60,249,124,250,220,
+21,141,158,140,158,158,26,247,59,251,2,211,251,20,251,67,251,22,251,26,251,
+53,102,30,247,24,6,247,20,164,215,247,6,234,27,206,190,75,251,8,118,138,118,
+135,118,31,14,247,249,107,29,248,191,10,251,44,250,159,28,5,17,21,247,75,
+251,32,247,41,251,113,251,185,251,94,251,150,251,156,251,98,247,41,251,28,
+247,105,247,205,247,73,247,165,247,151,30,251,44,22,251,100,251,30,251,152,
+251,87,251,16,42,241,247,58,247,110,247,31,247,145,247,86,247,20,232,32,251,
+56,30,14,228,250,244,248,248,21,247,114,251,66,247,70,251,164,251,251,251,
+141,251,199,251,210,251,140,247,78,251,56,247,152,248,21,247,115,247,220,
+247,201,30,251,94,22,251,137,251,60,251,187,251,118,251,35,251,7,247,4,247,
+85,247,148,247,58,247,179,247,119,247,40,247,3,251,11,251,81,30,14,247,249,
+36,10,247,171,250,81,61,29,247,249,36,10,207,249,54,49,29,247,249,36,10,205,
+249,54,72,29,247,62,249,63,35,29,247,249,36,10,205,249,54,248,208,10,247,
+249,36,10,205,249,54,72,29,247,159,249,67,35,10,247,249,36,10,205,249,54,
+248,215,29,247,249,36,10,252,138,28,251,133,72,10,248,204,28,7,29,44,29,247,
+249,36,10,161,249,112,58,10,247,249,36,10,233,250,93,57,29,247,249,36,10,
+247,31,250,145,48,10,247,249,36,10,247,38,250,85,248,216,29,247,249,36,10,
+247,38,250,85,248,213,10,247,249,36,10,247,38,250,85,248,216,10,247,249,36,
+10,206,250,5,68,29,247,249,36,10,206,250,5,248,201,10,247,249,36,10,206,250,
+5,248,198,10,247,249,107,29,251,242,251,105,252,66,248,213,29,247,249,36,
+10,216,249,239,248,207,29,247,249,36,10,251,23,249,239,46,29,247,249,36,10,
+251,23,249,239,248,191,29,247,249,36,10,69,250,95,37,10,247,249,36,10,252,
+138,28,251,133,66,29,247,249,36,10,251,228,253,234,69,29,247,249,36,10,206,
+250,5,130,10,252,13,28,249,192,69,29,247,249,134,10,247,249,134,10,247,249,
+137,10,250,43,250,171,39,29,248,19,250,151,248,176,21,247,172,79,7,99,119,
+119,99,30,251,232,6,99,119,159,179,31,79,251,172,199,6,179,159,159,179,30,
+247,232,6,179,159,119,99,31,248,68,247,38,21,248,41,251,185,247,189,251,247,
+252,22,251,186,251,192,252,42,252,63,247,186,251,179,248,4,248,15,247,179,
+247,200,248,46,30,251,118,113,21,252,63,136,251,71,251,86,251,152,27,251,
+172,142,251,42,247,154,248,20,26,248,25,247,48,247,132,247,164,30,247,192,
+136,247,39,251,132,136,252,50,8,14,248,26,249,46,4,247,6,6,133,96,137,96,
+96,26,251,236,247,122,251,118,247,219,248,48,247,155,247,224,248,3,206,30,
+247,24,235,251,10,6,142,169,140,170,170,26,247,197,251,107,247,140,251,232,
+252,9,251,169,251,186,251,243,54,30,251,25,6,28,4,147,43,247,144,10,249,222,
+247,80,21,247,119,10,14,247,249,107,29,108,7,80,85,66,55,42,251,6,251,3,247,
+48,251,31,27,32,47,79,108,98,31,247,183,205,247,74,247,161,247,132,248,145,
+10,118,251,84,21,251,192,80,251,81,251,180,251,135,27,251,83,251,41,247,62,
+247,168,162,139,159,141,162,31,186,180,210,192,225,247,36,239,251,50,247,
+38,27,247,4,207,203,209,200,31,14,247,249,92,29,188,250,81,35,29,249,151,
+250,5,28,5,127,21,252,36,251,204,251,212,252,35,69,31,252,48,66,247,101,251,
+201,248,30,27,247,232,247,175,247,133,247,214,247,8,31,182,6,247,142,247,
+109,247,64,247,175,189,31,247,94,175,74,247,112,251,193,27,251,36,251,12,
+78,67,56,31,222,48,251,16,189,251,47,27,247,187,253,103,21,251,216,82,251,
+78,251,172,251,181,27,251,176,51,247,172,247,220,197,31,247,218,196,247,76,
+247,168,247,183,27,247,172,232,251,164,251,226,80,31,247,125,141,21,173,247,
+86,108,247,68,53,247,22,8,197,193,225,186,231,27,247,28,215,251,5,251,97,
+103,31,251,89,104,251,11,251,22,251,35,27,126,127,139,140,128,31,14,248,37,
+247,28,248,141,21,251,206,247,122,251,116,247,219,248,118,247,150,248,99,
+248,18,247,227,251,97,247,120,251,182,30,252,231,6,110,122,153,166,144,31,
+159,247,29,5,251,9,6,49,252,96,5,247,9,6,178,247,31,5,167,145,153,153,168,
+27,247,166,6,251,190,251,60,251,52,251,173,251,212,26,249,83,249,149,21,247,
+128,247,17,251,62,251,184,252,34,251,85,251,232,251,191,251,83,251,41,247,
+70,247,128,247,172,247,22,247,247,247,144,247,43,31,14,248,106,49,10,14,248,
+106,49,10,157,250,81,35,29,248,106,49,10,251,4,249,54,42,10,248,106,49,10,
+247,7,250,85,35,10,248,106,49,10,38,250,95,37,10,248,106,49,10,252,169,28,
+251,133,66,29,248,87,249,85,219,21,251,176,251,26,247,172,247,220,202,31,
+201,247,218,247,129,247,191,247,191,150,132,222,24,252,35,251,239,251,212,
+252,35,63,31,252,48,60,247,146,251,201,248,30,27,226,243,155,168,219,31,110,
+199,226,123,209,27,247,28,247,2,191,240,238,31,103,204,5,69,58,47,104,66,
+27,106,110,145,151,112,31,247,88,247,22,247,38,247,107,185,247,135,8,248,
+59,220,251,72,247,83,251,95,27,251,81,251,163,251,93,252,79,55,31,92,251,
+139,200,251,87,247,10,251,11,8,129,101,99,134,98,27,248,237,248,240,21,99,
+251,100,251,4,251,70,251,23,251,0,56,247,10,92,247,85,172,247,66,8,247,241,
+206,247,10,247,58,244,27,244,189,251,56,251,234,74,31,14,248,204,28,6,135,
+250,113,21,253,37,6,114,251,11,5,225,80,40,197,251,47,27,252,3,251,135,251,
+214,251,195,251,152,247,94,251,46,247,140,247,3,239,174,211,233,31,121,57,
+5,249,93,6,196,247,150,5,251,11,6,88,251,37,5,124,133,131,131,120,27,252,
+5,6,221,248,13,5,247,101,6,160,143,131,129,137,31,120,251,5,5,247,3,6,215,
+247,242,5,251,3,6,106,35,5,122,135,133,135,121,27,251,99,6,213,247,230,5,
+247,191,6,159,141,135,125,31,251,19,247,13,7,253,78,251,34,21,251,146,251,
+62,251,178,251,118,251,27,251,17,237,247,97,247,150,247,68,247,181,247,112,
+247,21,247,23,51,251,114,30,14,249,172,28,6,99,251,252,21,248,151,10,247,
+223,28,6,182,5,32,6,79,63,72,114,39,251,83,129,224,251,242,27,252,86,251,
+249,252,46,252,96,251,224,247,112,251,130,247,230,247,172,247,85,247,58,247,
+88,176,31,247,51,249,211,191,130,247,10,143,193,151,25,251,178,28,250,58,
+135,119,133,122,111,137,25,251,22,129,5,53,248,176,7,253,54,249,190,21,251,
+113,97,36,70,251,38,27,251,84,251,40,247,63,247,167,248,0,247,99,248,42,247,
+240,247,3,170,128,79,236,31,14,28,5,57,28,9,91,249,234,21,247,197,251,87,
+247,140,251,232,251,121,251,80,251,4,251,59,251,21,30,247,59,56,251,54,247,
+4,251,121,27,252,86,251,184,252,66,252,76,251,236,247,102,251,118,247,219,
+247,130,247,76,247,3,247,56,247,16,31,251,64,225,247,59,36,247,113,27,248,
+118,247,150,248,91,248,68,31,251,125,247,79,29,254,144,247,79,29,14,247,22,
+28,4,164,250,236,21,247,81,251,65,245,251,104,251,138,251,167,251,42,251,
+159,251,59,247,15,66,247,10,121,30,251,108,111,251,101,251,58,251,131,26,
+251,96,247,69,251,20,247,145,247,176,247,190,247,88,247,160,247,66,251,20,
+241,251,51,164,30,247,56,164,247,93,247,29,247,110,26,252,41,247,83,21,247,
+0,218,71,251,10,251,56,251,7,251,61,251,64,251,16,75,235,247,1,247,84,247,
+17,247,14,247,55,31,251,126,28,251,55,21,251,42,71,243,247,16,247,88,247,
+24,247,70,247,92,247,19,227,42,251,28,251,86,251,26,251,67,251,87,31,14,251,
+192,250,11,28,5,172,21,247,6,251,4,202,251,30,251,52,251,71,49,251,52,39,
+219,95,216,128,30,251,32,122,251,28,40,251,36,26,251,14,247,7,62,247,56,247,
+77,247,85,247,10,247,53,243,56,200,36,154,30,246,154,247,22,221,247,23,26,
+251,155,247,7,21,209,190,98,68,41,65,37,251,4,58,98,197,204,247,8,220,212,
+245,31,251,44,253,115,21,41,95,201,214,247,9,225,246,247,22,221,197,81,57,
+251,8,52,34,251,19,31,14,251,27,248,234,250,136,21,251,87,251,92,39,251,91,
+251,19,242,91,232,126,31,251,62,121,251,55,251,4,251,72,26,251,45,247,22,
+52,247,96,247,118,247,117,247,15,247,101,247,23,251,7,211,251,20,154,30,247,
+20,158,247,52,227,247,56,26,247,24,251,20,223,251,62,30,122,62,21,212,181,
+71,58,251,5,66,39,251,1,53,114,212,210,247,6,215,243,241,31,54,252,92,21,
+231,196,64,50,251,15,42,251,19,251,23,43,90,223,221,247,16,235,247,16,247,
+20,31,14,248,104,113,29,72,248,229,250,44,21,247,43,196,251,1,251,28,251,
+70,251,12,251,88,251,38,91,31,90,251,145,5,248,8,6,183,247,120,5,74,6,251,
+5,117,79,119,107,27,251,26,6,157,233,5,247,103,200,247,74,247,82,247,123,
+26,247,86,251,20,247,39,251,153,251,206,251,109,251,135,251,148,251,64,241,
+251,2,247,25,97,30,121,45,5,251,25,6,111,99,153,209,153,140,155,143,158,31,
+75,6,95,251,120,5,248,7,6,188,247,145,5,63,188,81,219,247,28,26,247,86,247,
+33,247,100,247,65,30,14,248,128,28,6,16,249,207,21,247,232,251,139,247,132,
+251,230,252,83,252,62,252,48,252,84,251,232,247,142,251,132,247,228,248,82,
+248,62,248,48,248,84,30,251,35,113,21,251,255,251,234,251,221,251,250,251,
+161,251,94,247,86,247,162,247,255,247,236,247,222,247,250,247,162,247,91,
+251,87,251,162,30,252,72,69,21,205,81,178,78,47,59,61,47,71,184,86,209,237,
+217,229,235,30,14,54,64,10,14,252,57,248,162,59,21,247,1,99,247,10,251,26,
+64,67,90,112,94,30,155,215,5,87,6,251,93,101,5,103,7,247,3,128,251,42,253,
+92,137,123,127,131,121,138,248,110,29,116,142,133,147,142,153,25,182,247,
+89,5,131,160,172,125,179,27,247,109,247,56,247,85,247,94,31,251,24,134,21,
+251,29,62,251,87,251,37,92,95,167,148,124,30,218,248,17,5,148,153,206,201,
+204,27,210,171,54,67,31,14,252,76,249,103,28,4,139,21,247,1,98,247,11,251,
+25,63,69,89,113,94,30,156,215,248,86,29,251,41,253,93,135,123,127,132,122,
+137,248,110,29,117,141,133,148,143,153,25,180,247,89,5,130,161,170,127,180,
+27,247,109,247,56,247,85,247,92,31,251,23,135,21,251,29,61,251,87,251,37,
+92,96,166,149,124,30,219,248,15,5,149,153,205,203,200,27,213,172,53,67,31,
+14,54,64,10,247,40,249,166,35,29,54,64,10,107,249,68,46,29,54,250,35,248,
+157,21,35,6,251,35,253,141,247,108,10,247,70,249,242,112,29,14,84,250,197,
+248,89,21,241,39,7,141,166,141,163,166,26,247,74,77,247,89,251,98,251,7,251,
+3,57,94,70,30,163,247,19,5,59,247,100,10,78,251,207,5,251,36,37,247,15,6,
+251,41,253,150,135,112,118,127,115,137,25,32,128,5,62,248,150,216,7,251,21,
+150,104,143,131,153,143,162,25,205,247,221,5,125,172,188,116,202,27,247,165,
+247,111,247,107,247,155,208,31,251,70,247,64,21,116,139,117,135,114,30,252,
+56,6,180,247,105,5,155,158,245,242,235,27,247,5,188,251,34,251,12,31,119,
+251,64,21,251,83,96,251,1,251,82,251,62,27,65,72,186,153,116,31,201,247,212,
+5,14,54,247,33,29,164,247,19,5,59,6,251,202,248,44,29,251,83,254,106,179,
+10,54,248,214,251,69,21,233,182,63,247,58,5,247,102,247,0,247,32,247,134,
+247,143,26,247,19,29,247,188,10,195,10,204,247,221,248,126,10,187,186,146,
+152,184,31,247,135,249,10,21,251,62,73,251,115,251,17,36,30,59,247,67,45,
+96,221,251,73,5,134,120,120,136,118,27,68,71,186,153,115,31,247,220,10,14,
+54,64,10,251,158,253,84,35,10,54,250,166,28,5,31,21,247,31,251,10,198,251,
+73,251,174,251,77,251,96,251,87,101,30,251,171,28,250,109,225,29,176,247,
+74,5,247,117,184,247,29,247,5,247,23,27,184,176,131,118,160,31,173,251,64,
+5,139,158,129,168,200,202,192,203,30,251,191,253,66,94,29,54,249,129,250,
+220,21,247,4,251,195,7,199,247,193,248,88,29,107,251,52,5,251,102,251,4,247,
+80,6,251,168,28,250,123,225,29,180,247,103,5,247,211,252,107,94,29,54,247,
+33,29,248,17,10,251,182,28,250,56,179,10,247,193,28,5,87,249,92,21,247,98,
+251,24,233,251,58,33,40,58,93,89,30,162,241,5,65,6,251,149,64,5,69,247,2,
+7,251,39,253,135,5,251,42,175,53,247,4,247,65,248,220,249,11,174,248,27,26,
+247,23,32,247,10,251,5,44,43,72,32,117,144,118,152,121,30,247,96,198,5,182,
+122,157,100,95,251,196,253,63,46,253,0,26,251,156,247,86,36,247,94,117,30,
+80,251,194,133,110,119,129,116,248,73,29,115,141,117,147,145,170,25,198,247,
+198,5,248,39,179,247,216,247,216,247,251,26,252,212,195,21,139,241,247,11,
+234,247,27,187,44,251,10,251,130,251,56,251,211,251,241,105,30,14,247,49,
+247,117,247,128,21,251,115,251,43,251,68,251,76,63,178,89,211,198,207,182,
+196,153,31,251,13,247,15,5,247,10,149,247,9,193,202,27,186,174,124,118,169,
+31,56,252,62,134,114,124,126,110,136,248,88,10,96,143,138,157,144,164,25,
+202,247,218,5,116,179,191,122,227,27,247,147,247,189,247,188,247,254,247,
+62,80,247,101,251,86,251,18,59,78,73,36,31,163,247,19,5,59,6,251,202,248,
+44,29,251,19,253,31,5,150,115,113,145,109,27,248,13,248,168,21,139,247,17,
+247,11,234,196,245,90,251,105,251,206,251,60,251,133,251,73,65,95,165,173,
+99,30,14,247,230,249,58,250,136,21,251,7,251,2,57,94,69,31,247,208,29,195,
+10,204,247,221,248,126,10,247,111,247,75,247,30,247,82,240,31,251,62,181,
+222,251,50,246,27,227,213,164,180,217,31,115,10,211,88,188,65,251,29,251,
+9,251,25,251,128,251,25,30,247,71,137,76,247,82,251,95,27,204,252,23,94,29,
+51,247,211,252,5,21,251,21,150,103,142,130,154,144,162,25,167,247,31,5,247,
+227,247,52,248,66,247,231,248,60,26,247,42,61,247,9,251,79,251,7,251,1,75,
+76,68,247,188,10,134,112,122,128,112,136,25,32,128,5,62,248,152,7,180,28,
+4,190,21,207,224,219,190,198,27,213,214,67,251,1,251,213,251,169,251,198,
+251,147,251,28,31,14,251,40,248,129,250,69,21,251,158,251,49,251,39,251,167,
+127,31,139,161,253,155,74,251,90,30,247,63,6,182,247,15,133,247,254,139,26,
+106,176,247,18,96,232,27,247,125,247,69,247,36,248,38,247,176,251,66,247,
+48,251,114,31,87,39,21,247,50,247,22,251,53,251,180,251,180,251,27,69,40,
+251,78,55,247,46,247,144,247,135,189,247,50,247,58,31,14,252,117,247,87,246,
+21,251,64,36,51,251,57,132,31,139,153,252,101,97,251,11,30,247,3,6,167,213,
+135,247,109,139,26,119,163,221,113,199,27,247,44,247,7,226,247,133,247,62,
+251,5,233,251,37,31,106,79,21,241,224,42,251,64,251,65,51,97,75,251,13,84,
+231,247,43,247,38,172,234,247,0,31,14,201,250,218,248,250,21,247,118,251,
+46,247,15,251,56,175,30,190,247,138,248,45,10,243,149,5,217,252,127,248,112,
+10,88,251,131,5,251,179,91,251,127,251,182,251,198,26,251,88,247,27,251,27,
+247,68,98,30,75,251,199,133,112,121,127,112,137,25,35,128,5,62,248,127,216,
+7,33,150,104,143,129,153,145,162,25,200,247,191,5,247,177,184,247,136,247,
+174,247,197,26,251,99,148,21,251,103,251,27,251,159,251,58,76,30,247,60,249,
+187,5,210,92,201,49,251,21,26,251,212,247,174,21,251,58,253,181,5,70,187,
+79,227,247,25,26,247,121,247,34,247,132,247,45,202,30,14,251,236,249,206,
+28,4,129,21,247,28,39,213,32,160,30,173,247,40,143,155,151,146,156,141,25,
+207,145,5,185,251,211,93,7,208,133,161,136,146,131,136,125,25,106,251,35,
+5,251,78,110,251,45,251,66,251,76,26,251,9,227,58,247,6,114,30,97,251,76,
+136,123,127,131,121,138,25,72,133,5,92,247,211,186,7,70,145,116,142,133,147,
+143,153,25,178,247,71,5,247,77,166,247,51,247,61,247,75,26,251,26,145,21,
+251,19,51,251,52,251,0,101,30,247,1,248,120,5,185,111,180,85,62,26,251,100,
+247,61,21,251,0,252,117,5,94,168,100,192,219,26,247,29,231,247,36,239,177,
+30,14,248,40,28,5,158,249,9,21,247,119,251,15,247,48,251,111,63,63,114,139,
+30,242,248,158,5,57,6,251,185,60,5,71,247,47,7,66,252,11,5,139,73,164,63,
+251,230,251,103,251,245,251,197,251,121,247,19,251,42,247,108,214,217,164,
+139,30,76,251,209,135,120,110,117,120,137,25,251,19,130,5,62,248,144,216,
+7,39,148,121,141,114,161,143,158,25,203,247,209,5,139,206,114,215,247,226,
+247,103,247,243,247,195,30,251,95,137,21,251,75,251,25,252,8,251,97,49,102,
+176,139,30,247,46,249,150,5,139,188,175,229,247,0,203,251,23,251,49,30,252,
+138,247,144,21,251,45,253,150,5,139,87,102,49,33,75,247,21,247,51,247,75,
+247,23,248,8,247,99,229,176,103,139,30,14,247,169,247,150,248,135,21,174,
+247,69,219,247,97,247,114,212,8,197,7,251,182,101,251,87,251,110,89,251,149,
+86,251,163,232,251,114,248,22,111,56,252,65,24,247,66,6,222,248,65,248,36,
+167,247,85,247,114,192,247,163,25,247,177,195,101,247,120,251,214,27,251,
+130,251,1,251,60,251,209,77,31,49,252,99,251,160,173,123,247,93,178,247,92,
+25,248,151,197,21,247,66,173,189,247,97,247,30,27,247,31,165,251,62,251,159,
+87,31,93,251,129,251,2,251,62,251,167,110,8,14,251,195,249,15,118,101,29,
+251,195,249,255,28,4,200,101,29,247,18,248,129,114,21,248,78,140,247,126,
+248,39,247,244,26,247,56,74,247,9,251,95,251,179,251,25,252,238,251,206,84,
+30,251,27,209,108,235,247,50,26,247,27,215,247,222,243,182,172,133,94,166,
+30,171,141,5,139,164,247,68,251,43,251,163,251,17,252,11,251,152,251,132,
+247,33,251,55,247,191,140,30,248,114,249,144,21,251,148,251,7,251,199,251,
+130,57,30,195,247,212,5,247,197,192,237,247,54,188,27,203,172,104,32,31,14,
+201,73,29,14,251,236,249,255,28,5,133,21,247,6,54,221,251,111,30,251,223,
+88,6,214,247,242,10,251,32,253,41,136,125,127,131,123,138,25,61,133,5,87,
+247,239,191,7,63,145,115,140,133,149,142,151,25,188,247,121,5,139,197,136,
+165,247,125,247,65,247,15,247,90,30,251,31,118,21,43,89,78,72,102,30,77,103,
+56,129,62,146,222,248,26,24,141,152,160,140,155,27,247,45,192,73,45,31,14,
+251,51,128,10,251,51,128,10,201,73,29,245,249,179,35,29,201,73,29,65,249,
+81,46,29,201,28,4,145,250,171,21,247,36,10,95,251,119,5,251,65,37,247,45,
+6,251,43,253,153,138,29,215,248,17,5,139,227,135,180,247,250,247,158,247,
+97,247,222,30,252,111,251,31,21,241,251,77,7,191,247,156,5,248,75,29,251,
+52,62,37,36,77,31,43,80,251,19,122,251,11,150,194,247,177,24,14,201,249,166,
+247,147,21,247,4,251,148,7,169,247,41,5,139,227,135,180,247,250,247,158,247,
+97,247,222,247,36,10,251,62,253,250,5,251,102,251,4,247,80,6,116,251,12,138,
+29,163,247,12,5,248,228,249,137,247,73,10,14,201,249,218,248,3,21,233,182,
+64,247,55,5,247,82,223,247,14,247,58,247,116,26,217,29,215,211,148,157,205,
+30,247,89,248,109,21,251,40,73,40,47,76,30,73,247,38,45,96,208,251,43,55,
+108,42,130,47,148,25,247,19,249,31,5,248,57,29,14,247,40,28,4,205,250,171,
+21,247,82,251,25,247,29,251,226,30,252,29,6,251,48,251,87,86,251,85,82,176,
+90,193,188,184,157,182,188,31,82,247,38,5,172,167,170,155,211,27,186,6,165,
+152,123,112,133,31,132,102,251,98,254,187,132,115,121,126,112,137,25,251,
+8,129,5,53,248,168,225,7,251,11,149,104,247,203,29,213,248,17,5,139,229,135,
+180,247,249,247,160,247,97,247,222,30,251,105,104,21,251,52,59,37,39,77,30,
+40,80,251,17,122,251,10,150,247,19,249,31,24,141,157,174,141,161,27,247,128,
+223,251,1,251,49,31,14,248,34,28,5,230,250,85,21,145,175,142,172,170,26,247,
+120,251,63,224,251,211,30,252,74,50,6,214,132,177,135,146,125,135,116,25,
+251,12,252,253,5,251,72,172,251,3,247,0,247,68,26,166,142,167,144,169,30,
+219,248,89,248,143,140,247,203,26,247,29,251,23,228,251,7,43,48,66,34,117,
+145,120,151,125,30,247,117,195,166,136,200,121,123,61,25,94,251,113,252,166,
+78,62,252,73,8,132,100,136,103,105,26,251,175,247,121,51,247,119,120,30,64,
+252,20,135,119,122,122,111,248,26,10,142,131,155,143,159,25,215,248,17,5,
+179,6,247,239,247,177,231,247,245,202,31,251,102,136,21,251,166,91,251,72,
+69,251,122,27,122,123,139,140,122,31,247,20,249,39,5,139,180,143,176,247,
+110,231,51,251,41,113,136,111,134,110,30,14,247,225,249,229,248,148,21,247,
+184,247,230,247,42,248,21,247,79,251,9,247,32,252,15,31,252,116,53,6,247,
+10,129,167,137,153,123,135,119,25,251,3,252,205,5,147,103,101,145,99,27,251,
+126,251,47,251,62,251,74,57,184,87,217,202,208,181,197,155,31,251,25,247,
+15,5,247,10,146,247,14,193,207,27,201,182,135,123,183,31,54,252,69,135,119,
+126,116,109,137,25,251,14,129,5,53,248,169,225,7,251,9,149,104,142,129,155,
+143,159,25,213,248,19,5,135,174,180,137,188,27,161,249,142,21,139,180,143,
+176,247,148,201,251,23,251,27,138,30,138,251,135,251,96,251,42,251,103,141,
+8,99,105,140,142,108,31,14,248,253,190,29,251,196,247,125,21,247,68,251,27,
+201,251,116,247,79,10,119,141,128,154,151,26,247,197,7,143,199,134,163,27,
+247,148,247,34,247,6,247,45,31,251,52,133,21,251,35,59,85,251,42,30,117,69,
+148,248,37,29,248,176,202,10,247,49,247,31,178,212,246,30,247,102,252,125,
+248,179,10,251,160,248,248,248,87,248,148,147,150,159,157,160,141,25,247,
+15,147,5,247,244,29,137,137,116,124,123,25,251,109,251,139,5,141,157,140,
+157,158,26,247,61,10,14,181,211,248,150,21,247,31,6,119,34,5,251,47,39,247,
+27,6,107,251,60,136,119,119,116,110,137,25,40,131,5,51,248,138,227,7,251,
+23,147,112,141,129,162,142,159,25,171,247,60,5,248,69,239,252,49,6,159,244,
+5,190,6,248,94,247,109,247,136,247,181,247,82,251,27,247,29,251,217,31,252,
+69,51,6,223,131,166,137,151,116,136,119,25,251,11,252,253,5,251,51,6,248,
+107,249,36,21,139,193,141,176,247,103,207,34,251,49,251,52,251,3,251,128,
+251,235,30,96,6,14,181,250,237,250,20,21,251,69,6,148,178,145,181,140,183,
+8,247,65,6,153,239,5,251,84,6,247,42,113,251,2,242,251,123,27,252,44,53,6,
+231,129,168,137,146,123,135,116,25,120,251,8,5,251,79,248,162,10,247,78,6,
+119,251,17,5,251,70,248,162,10,247,69,6,36,253,41,135,115,124,126,119,137,
+25,44,129,5,53,248,62,225,7,46,149,109,141,133,156,142,159,25,200,248,17,
+5,139,209,135,172,247,96,247,58,243,247,72,218,30,247,88,6,252,96,251,0,21,
+62,80,37,122,44,150,166,247,65,24,247,233,6,114,94,106,103,103,112,8,247,
+36,247,216,21,96,134,101,131,104,30,251,255,6,159,247,17,5,247,248,6,251,
+208,247,145,21,141,156,164,141,159,27,247,32,212,78,43,166,31,251,218,6,14,
+249,217,28,7,106,250,7,21,188,94,219,251,23,251,35,251,63,251,1,251,93,37,
+209,49,210,73,30,223,64,198,81,55,26,35,74,73,68,80,105,172,180,114,30,172,
+239,5,152,127,103,169,96,27,69,105,94,74,121,141,121,145,122,31,132,114,112,
+135,115,27,80,84,182,211,152,31,247,2,249,23,5,247,98,233,251,83,6,174,247,
+126,5,33,6,54,251,97,41,88,5,146,176,143,178,180,26,247,82,251,4,247,29,251,
+177,30,252,69,53,6,236,129,170,137,146,123,136,116,25,251,75,254,226,134,
+115,124,126,117,137,25,38,129,5,53,248,89,225,7,40,149,107,141,133,156,142,
+159,25,204,248,17,5,139,213,135,174,247,129,247,82,247,16,247,103,211,30,
+237,150,32,253,2,5,134,110,137,110,113,26,38,178,63,247,18,207,232,175,167,
+201,30,101,178,202,113,227,27,247,108,247,10,247,46,247,60,239,65,217,62,
+211,31,64,208,60,219,213,26,192,165,227,215,161,154,129,133,146,30,217,251,
+17,5,182,143,222,153,234,26,254,214,247,21,21,251,52,73,37,52,77,30,57,80,
+251,0,122,38,150,247,0,249,31,24,141,157,166,141,160,27,247,92,209,251,1,
+251,49,31,14,201,249,178,250,194,21,246,251,149,7,151,199,247,140,10,127,
+79,5,251,104,32,247,83,6,251,74,254,59,138,29,151,207,5,139,244,247,218,29,
+251,41,6,157,235,5,248,19,252,55,248,140,10,251,51,122,32,149,247,5,248,223,
+24,141,155,203,248,103,10,201,249,10,247,91,21,246,251,150,7,158,241,5,139,
+205,247,218,29,251,1,6,150,197,247,140,10,251,74,254,55,5,251,102,32,247,
+81,6,127,75,138,29,151,203,5,248,187,249,37,248,140,10,251,12,122,32,149,
+247,6,248,223,24,141,155,163,248,103,10,173,28,4,127,250,141,21,247,92,38,
+247,69,251,125,56,251,21,65,73,62,30,161,247,12,5,46,247,164,10,251,193,28,
+249,248,138,29,211,247,253,5,247,225,247,42,248,157,248,52,248,37,26,251,
+115,104,21,251,192,251,228,251,221,251,160,251,50,30,247,67,250,26,5,223,
+233,232,185,207,27,231,221,61,251,59,31,14,204,247,54,250,85,21,81,251,194,
+247,98,251,39,247,184,141,8,191,220,145,141,149,31,66,252,17,136,119,120,
+116,111,137,25,251,27,131,123,51,5,248,164,6,155,227,35,247,218,10,247,14,
+147,156,227,5,252,116,6,252,15,251,88,251,2,251,195,81,31,247,100,136,21,
+247,91,177,247,15,247,9,247,148,27,176,203,137,139,31,251,15,253,25,5,133,
+68,128,101,27,251,103,137,251,6,246,184,247,129,8,14,248,212,28,6,100,249,
+179,21,247,144,251,82,247,25,251,83,66,83,118,119,74,30,155,231,143,155,160,
+164,167,141,25,247,28,248,156,29,161,137,153,120,135,117,25,123,47,5,159,
+82,90,160,65,27,251,201,251,159,251,187,251,195,251,136,247,81,251,44,247,
+82,215,196,162,157,203,31,120,47,247,199,10,248,205,227,7,251,27,147,116,
+141,125,158,143,161,25,158,231,5,121,192,190,116,213,27,247,199,247,162,247,
+202,247,191,31,251,121,145,21,251,93,251,7,251,222,251,129,61,108,158,174,
+92,30,247,33,249,99,5,173,203,176,158,217,27,247,23,196,251,36,251,43,31,
+252,209,247,134,21,251,34,253,99,5,104,78,102,120,59,27,251,19,74,234,247,
+51,247,91,247,19,248,9,247,121,219,167,120,105,187,31,14,111,126,10,111,250,
+96,251,116,21,247,4,251,81,7,247,115,250,248,5,251,15,6,90,79,234,29,95,251,
+113,5,251,217,251,4,247,195,6,121,46,247,6,29,157,232,5,150,250,143,106,29,
+247,83,250,130,250,136,21,251,15,6,90,79,234,29,111,251,32,252,4,251,139,
+5,42,7,247,238,247,122,105,251,64,247,6,29,196,247,182,5,248,76,247,209,186,
+193,247,37,26,245,52,180,67,138,30,46,138,78,65,57,26,121,142,121,145,121,
+30,247,48,153,146,130,142,126,134,121,25,102,40,251,36,251,7,251,32,41,8,
+88,249,89,106,29,111,28,5,150,28,5,106,21,197,114,204,251,21,251,140,251,
+11,251,58,251,127,92,30,111,251,48,223,29,247,167,28,5,129,182,247,113,135,
+176,237,173,25,247,54,251,2,5,139,247,5,157,233,26,253,38,252,227,106,29,
+111,250,228,251,216,21,182,106,176,98,147,30,251,86,251,12,5,89,157,115,168,
+192,26,198,157,203,150,196,30,247,107,250,212,5,251,15,6,90,79,234,29,139,
+84,251,128,53,26,251,91,247,35,82,247,70,229,247,1,180,243,30,251,224,250,
+243,106,29,251,86,250,119,251,203,21,210,102,197,76,30,251,82,251,42,5,85,
+164,115,174,210,26,184,145,199,153,217,30,247,93,250,164,5,145,166,141,165,
+164,26,247,68,251,0,247,25,251,99,251,185,251,60,251,146,251,107,251,72,247,
+13,251,13,247,86,213,207,155,170,200,30,251,25,253,80,5,133,106,135,108,108,
+26,251,84,247,8,251,37,247,105,247,17,225,214,199,30,251,215,28,5,141,21,
+251,52,49,251,101,251,62,55,73,199,247,27,247,43,229,247,112,247,64,231,195,
+73,251,23,30,14,248,149,250,130,250,136,21,251,15,6,90,79,248,202,29,248,
+158,248,172,10,247,226,247,144,247,214,247,228,247,19,29,31,251,101,49,247,
+95,10,248,205,251,62,94,29,247,249,110,29,247,247,28,5,223,251,181,21,221,
+39,164,139,30,251,70,251,66,71,141,76,204,159,247,11,25,247,195,28,6,43,5,
+251,11,6,68,69,5,152,112,251,15,192,251,17,27,252,113,252,15,252,27,252,146,
+252,50,247,185,251,9,247,154,247,23,221,160,211,227,31,121,61,123,45,81,26,
+251,101,247,23,43,247,57,247,7,247,66,178,247,33,30,251,240,28,5,133,21,251,
+72,254,55,5,81,57,69,92,251,37,27,251,113,251,21,247,42,247,178,248,19,247,
+123,248,21,248,66,180,247,25,251,21,100,131,31,14,247,249,28,5,81,188,21,
+71,218,251,141,251,113,113,177,113,184,112,190,247,42,10,175,56,180,66,195,
+85,251,20,251,6,24,205,63,247,40,247,23,5,117,184,192,127,203,247,248,10,
+87,98,154,165,103,31,207,250,148,199,10,249,22,248,198,251,234,21,247,180,
+247,37,5,59,204,225,88,247,24,247,248,10,51,83,180,209,88,31,247,58,222,247,
+229,247,61,247,79,247,30,140,247,56,25,228,79,212,46,30,47,142,67,87,48,26,
+123,141,121,144,120,30,247,49,6,143,132,142,131,130,26,83,81,251,5,251,216,
+251,51,30,251,99,37,126,161,126,162,126,164,247,42,10,155,103,155,105,158,
+107,251,133,251,11,24,249,0,250,226,199,10,252,236,248,56,203,21,173,117,
+188,76,59,68,92,62,84,30,167,247,16,5,86,248,3,10,251,7,252,158,5,247,16,
+6,208,247,202,155,210,234,247,4,204,164,25,171,81,5,211,186,146,196,31,14,
+252,71,251,113,21,170,118,184,75,59,68,96,68,84,30,167,247,6,5,86,6,251,93,
+104,5,106,7,247,4,129,251,7,252,115,5,247,16,6,209,247,176,154,205,234,241,
+204,163,25,171,85,5,212,185,145,192,31,14,252,235,249,62,28,5,29,233,10,136,
+28,6,148,233,10,251,223,55,10,248,173,4,247,113,29,14,251,223,55,10,158,247,
+146,49,29,251,223,55,10,112,247,204,58,10,251,223,55,10,229,248,237,48,10,
+251,223,55,10,251,72,248,75,46,29,251,223,55,10,252,164,254,178,247,51,29,
+251,223,55,10,253,42,28,251,113,66,29,251,223,55,10,253,42,28,251,113,72,
+10,249,60,28,6,92,68,29,251,223,55,10,253,29,254,246,54,10,251,223,248,187,
+224,21,252,1,6,126,54,5,247,148,6,95,251,132,111,29,247,241,250,227,220,10,
+14,251,223,210,10,76,251,207,5,251,42,37,247,21,6,47,252,89,5,247,82,6,232,
+248,89,5,247,107,241,251,83,6,182,247,9,247,19,247,45,229,178,188,41,24,247,
+3,211,151,235,31,14,251,144,250,41,216,10,251,102,251,166,35,10,251,184,249,
+166,248,129,21,122,233,252,30,70,165,247,11,247,36,247,76,248,121,10,247,
+107,10,31,247,55,10,61,252,23,251,103,103,153,48,247,69,169,61,252,22,5,247,
+82,6,226,248,56,5,14,251,223,210,10,251,48,253,150,5,125,66,129,67,71,26,
+251,94,217,251,46,247,150,248,157,29,251,109,251,29,5,96,168,129,209,214,
+26,190,147,191,149,184,30,247,7,248,205,161,247,11,247,40,248,164,29,251,
+223,210,10,251,156,28,250,220,5,247,80,6,247,89,250,86,161,247,11,247,40,
+248,164,29,251,236,246,248,6,21,188,251,0,200,251,26,176,83,8,247,86,29,209,
+7,122,104,76,125,110,27,67,74,243,247,7,78,31,125,163,126,166,127,166,8,247,
+124,173,247,90,247,0,247,124,26,247,42,251,12,244,251,86,251,48,251,3,66,
+93,67,30,33,7,206,226,237,178,219,27,247,3,208,85,39,251,82,251,65,55,251,
+51,31,48,44,146,6,138,136,137,140,137,27,14,84,139,4,127,225,247,0,126,247,
+34,27,201,204,144,146,199,31,251,85,252,24,5,231,6,247,92,248,37,229,155,
+211,159,172,156,25,217,7,89,126,91,128,92,132,247,252,249,101,24,47,6,252,
+2,253,114,75,133,81,137,92,140,25,251,2,141,70,148,91,149,8,247,178,247,107,
+247,170,247,126,247,125,26,247,16,35,244,251,90,251,48,251,35,47,100,74,30,
+251,7,7,204,226,247,8,201,236,27,247,0,186,73,61,251,55,251,26,251,57,252,
+33,251,204,31,14,205,250,101,249,213,21,247,17,247,127,10,251,162,28,250,
+197,5,206,6,247,51,247,78,247,90,250,95,5,235,229,247,31,221,205,27,178,194,
+115,62,31,38,251,8,251,230,251,50,26,251,30,219,84,247,157,248,157,29,251,
+89,251,29,5,105,162,115,189,196,26,238,247,28,248,39,136,247,24,30,14,251,
+223,247,63,251,175,21,247,57,249,179,247,21,10,251,162,28,250,197,5,206,6,
+14,251,223,85,252,105,21,206,6,247,51,247,78,237,248,115,5,247,190,6,139,
+141,241,137,141,30,251,168,6,183,247,108,247,21,10,5,14,251,254,249,74,250,
+111,21,247,61,29,251,99,5,221,6,247,199,248,161,10,253,0,248,202,28,5,97,
+21,247,90,10,251,16,5,193,6,247,91,248,161,29,251,254,249,179,251,246,21,
+208,102,172,102,153,30,251,99,251,29,5,100,164,125,194,213,26,192,147,201,
+151,202,30,247,101,250,154,5,247,61,29,251,94,5,131,93,135,96,98,26,251,72,
+247,2,251,31,247,128,221,223,174,219,30,14,252,81,249,14,248,209,21,180,115,
+159,115,147,30,251,26,57,5,113,154,130,172,183,26,171,144,176,147,177,30,
+247,28,248,254,5,247,90,10,251,13,5,134,111,137,114,114,26,251,0,210,56,247,
+45,193,193,160,187,30,14,251,254,249,173,28,5,229,21,55,6,251,208,78,5,77,
+7,247,74,121,251,70,254,21,247,20,10,5,14,251,254,249,89,28,4,127,21,247,
+95,61,247,47,251,150,57,45,103,61,69,173,106,178,125,30,247,107,247,27,5,
+184,112,150,68,63,26,90,128,86,131,94,30,251,17,253,1,247,20,10,247,58,249,
+201,5,155,213,150,210,207,26,14,252,57,249,130,247,4,10,14,251,215,249,228,
+247,4,10,251,33,251,181,35,10,40,249,186,28,4,211,21,34,251,129,42,114,39,
+81,251,5,251,2,25,247,55,10,251,68,253,250,5,247,82,6,246,248,152,175,247,
+68,247,25,247,24,247,27,174,25,251,175,253,25,5,231,6,247,179,249,33,159,
+136,188,41,5,247,3,211,179,207,240,62,177,37,138,31,130,6,237,247,115,5,14,
+252,131,249,19,251,216,21,182,106,180,98,154,30,251,107,251,27,5,100,161,
+133,188,180,26,201,151,202,152,201,30,241,248,150,247,37,29,37,252,150,5,
+125,71,128,68,67,26,251,84,213,251,46,247,109,225,247,9,180,243,30,14,252,
+44,247,40,252,82,21,247,83,6,247,72,250,23,247,37,29,14,251,136,250,58,249,
+165,21,189,7,251,6,107,186,231,114,31,114,233,127,203,251,1,181,8,247,41,
+178,247,14,221,247,25,26,247,33,251,33,179,251,40,30,251,248,88,6,213,133,
+162,248,46,29,251,27,253,41,135,125,127,131,121,138,25,63,248,114,10,134,
+149,141,151,25,196,247,173,5,139,186,141,162,247,17,158,44,48,160,30,48,159,
+161,32,247,53,27,170,170,144,154,175,31,251,88,249,5,21,251,48,251,44,97,
+251,35,30,109,6,207,247,227,5,147,154,140,145,27,242,143,247,17,117,251,12,
+26,14,93,250,132,141,21,215,7,251,34,104,190,243,111,31,164,10,251,2,176,
+213,91,247,15,27,178,177,148,157,189,31,251,146,249,121,247,124,29,247,108,
+37,29,247,38,249,149,35,29,247,108,37,29,247,57,248,122,49,29,247,108,37,
+29,247,11,248,180,58,10,247,108,37,29,247,128,249,213,48,10,247,108,37,29,
+105,249,51,46,29,247,108,37,29,251,81,28,251,58,68,29,247,108,37,29,252,41,
+28,250,201,66,29,247,108,37,29,252,41,28,250,201,72,10,248,205,28,7,236,68,
+29,247,108,37,29,252,28,28,250,246,54,10,247,108,121,10,41,252,158,5,251,
+101,6,121,251,3,5,247,96,6,51,252,105,150,29,14,247,108,28,5,101,250,181,
+21,113,247,13,251,66,107,5,247,67,98,251,85,192,251,94,27,252,184,53,6,248,
+7,10,90,251,147,251,168,88,151,251,0,247,134,181,251,30,253,110,138,10,227,
+248,105,5,247,120,10,247,84,10,247,104,198,247,70,247,14,164,247,85,8,253,
+63,251,204,21,94,6,174,247,83,248,95,219,5,251,103,106,251,105,79,251,95,
+27,198,248,195,21,151,162,141,149,27,247,32,144,247,59,111,175,251,38,252,
+70,58,24,14,247,108,121,10,251,111,28,251,129,247,51,10,247,13,249,27,24,
+217,10,14,104,244,28,4,129,21,196,235,247,17,204,247,65,27,247,81,247,35,
+40,251,107,101,31,251,104,102,251,118,251,34,251,184,95,105,142,131,27,40,
+7,138,138,139,139,30,109,248,107,252,13,252,149,248,182,27,190,171,151,154,
+193,31,156,231,252,60,109,247,111,248,0,251,120,241,25,247,175,195,247,83,
+247,59,178,247,110,8,247,245,202,251,154,230,251,142,27,251,36,251,88,87,
+63,251,23,31,14,235,172,22,249,69,6,251,93,252,37,5,237,6,247,93,248,37,5,
+247,153,6,182,247,141,5,60,6,101,37,5,119,132,112,110,121,27,53,6,247,254,
+249,103,5,41,6,251,254,253,103,5,252,163,6,248,153,248,45,247,142,247,153,
+182,247,137,181,247,131,251,71,247,52,251,213,134,251,48,137,251,114,80,251,
+10,53,8,251,14,7,228,247,35,247,17,187,247,43,27,247,121,227,251,32,251,41,
+113,31,91,251,165,251,106,251,109,252,151,252,22,8,14,248,148,28,5,131,250,
+173,21,247,70,10,251,191,28,249,244,247,58,29,248,171,225,7,251,11,149,104,
+142,130,155,143,159,25,247,137,28,4,235,5,229,190,247,119,247,111,247,50,
+27,247,32,247,13,46,251,28,31,251,42,251,54,252,76,251,68,26,251,113,247,
+19,65,247,101,221,247,9,178,237,188,106,195,92,157,30,251,117,251,27,5,104,
+161,133,185,177,26,137,247,104,247,77,248,82,247,85,26,14,251,34,247,112,
+10,247,156,28,5,45,221,29,251,34,247,112,10,247,21,249,29,5,247,220,6,139,
+141,241,137,141,30,251,199,6,247,6,248,208,221,29,247,9,248,174,249,71,21,
+89,126,141,141,116,31,216,248,31,5,205,6,247,58,244,90,251,13,251,67,251,
+41,85,251,71,31,79,36,21,247,114,103,253,107,247,228,27,210,184,150,155,184,
+31,229,7,136,124,124,137,125,27,251,122,180,248,131,247,25,251,99,31,247,
+75,167,247,79,247,17,247,75,26,247,81,251,50,201,251,150,30,251,19,6,148,
+188,145,172,152,145,164,141,25,247,20,149,5,248,46,10,247,14,128,168,136,
+145,122,135,119,25,248,62,29,135,119,131,122,110,137,25,251,19,129,5,53,248,
+171,227,7,251,21,149,112,141,131,154,143,159,25,227,248,89,5,14,249,136,28,
+4,110,22,223,7,251,50,95,217,247,45,104,31,104,247,48,123,246,251,43,210,
+8,247,98,203,247,62,247,29,247,113,26,247,128,251,87,206,251,98,30,252,129,
+53,6,242,129,170,247,166,29,251,80,254,226,133,115,123,126,115,137,25,34,
+129,5,53,248,115,225,7,32,149,108,141,132,156,142,159,25,218,248,105,5,139,
+204,141,171,247,64,166,251,49,251,44,168,30,251,44,166,171,251,70,247,115,
+27,181,182,147,164,189,31,249,60,250,7,21,188,92,219,251,31,251,43,251,73,
+251,1,251,93,37,213,49,214,73,30,228,64,202,81,55,26,35,70,73,64,77,102,172,
+180,113,30,174,239,5,152,126,100,169,94,27,65,104,94,74,45,218,44,247,70,
+247,121,247,16,247,46,247,60,239,60,217,58,211,31,60,208,55,219,213,26,192,
+167,227,220,161,155,129,133,146,30,222,251,17,5,185,143,226,153,234,26,254,
+76,247,51,21,251,152,251,102,68,251,90,30,98,6,233,248,195,5,149,160,141,
+148,27,247,34,145,247,65,102,251,91,26,14,181,28,4,122,28,4,125,21,251,148,
+6,126,191,113,180,103,171,8,247,245,6,153,239,5,253,90,6,122,6,251,55,248,
+162,10,147,6,138,135,5,140,151,153,140,146,27,247,16,143,247,37,118,195,33,
+8,252,32,248,162,10,248,71,132,6,251,152,251,125,68,251,113,30,91,6,124,32,
+5,139,206,248,56,10,180,251,70,247,134,248,129,29,247,84,10,247,113,201,247,
+76,247,22,151,247,100,8,247,125,6,14,247,108,28,5,180,28,5,14,21,203,129,
+237,55,90,127,72,102,30,79,171,86,78,26,251,19,76,251,11,86,251,3,30,251,
+126,252,103,106,247,27,111,234,251,46,204,25,247,90,29,251,101,254,226,138,
+10,227,248,105,5,139,211,248,118,29,153,69,153,66,174,79,251,138,252,131,
+24,246,6,247,97,248,55,5,107,182,198,120,221,248,129,29,223,7,251,28,80,186,
+231,100,31,247,189,248,238,5,205,247,28,210,247,74,247,43,26,252,138,251,
+144,247,109,10,14,46,250,109,4,63,7,247,34,174,88,35,167,31,170,32,153,65,
+247,7,86,8,251,62,92,251,31,45,251,50,26,251,68,247,72,94,247,68,30,248,109,
+217,6,33,149,104,143,129,153,145,162,25,247,43,249,111,145,164,158,151,165,
+141,25,246,149,5,217,252,123,248,112,10,76,251,189,5,137,122,104,139,119,
+27,251,74,149,247,62,247,17,98,31,247,2,102,65,187,251,15,27,100,101,130,
+121,89,31,247,146,253,121,21,247,66,247,66,188,247,66,30,162,6,57,252,11,
+117,137,5,251,17,129,251,34,172,247,23,26,14,251,4,250,218,250,42,21,214,
+7,150,106,116,147,94,27,251,13,66,81,49,73,31,251,35,37,88,251,58,251,112,
+125,129,141,135,27,200,247,203,5,154,143,158,159,161,27,225,145,5,217,252,
+58,61,7,211,135,166,137,153,119,135,124,25,251,42,253,121,135,123,115,114,
+112,137,25,67,133,5,61,248,50,7,247,115,247,140,188,247,154,242,251,4,210,
+42,168,31,247,7,178,190,229,199,235,8,234,196,194,223,247,38,27,252,114,252,
+241,21,251,70,251,53,92,251,48,30,73,6,217,248,15,5,152,167,141,158,27,247,
+33,243,71,51,31,14,252,93,249,206,28,5,56,21,184,7,145,118,124,144,109,27,
+61,91,104,85,96,31,54,73,106,39,251,35,130,132,140,137,27,178,247,79,5,148,
+142,151,151,154,27,195,142,5,186,251,167,92,7,186,137,157,138,148,127,136,
+130,25,42,252,81,136,130,123,124,122,137,25,92,136,5,92,247,161,7,247,37,
+247,53,168,247,50,200,67,182,75,156,31,214,163,172,193,178,196,8,196,176,
+175,190,234,27,251,203,251,255,21,32,35,111,37,30,96,6,190,247,119,5,148,
+157,140,151,27,231,206,99,86,31,14,247,61,28,4,140,249,201,21,251,224,253,
+46,127,160,130,165,131,170,25,164,10,161,73,174,96,189,115,251,91,252,37,
+24,231,6,247,80,248,15,5,137,154,154,138,155,27,178,177,148,157,189,31,215,
+7,90,102,145,151,112,31,247,253,249,105,5,252,138,61,247,124,29,247,38,28,
+5,86,28,5,6,21,227,252,142,7,251,183,251,217,47,251,240,251,46,247,25,64,
+247,52,100,31,251,247,61,223,251,193,247,121,10,65,247,242,248,13,27,196,
+188,135,139,31,45,252,107,137,123,119,248,40,10,248,166,227,7,251,0,147,110,
+143,131,162,141,155,25,247,109,250,220,143,155,158,162,167,143,25,251,141,
+137,21,251,3,252,193,5,139,67,137,96,251,97,251,2,186,247,27,247,167,247,
+68,241,247,152,30,14,37,249,220,22,219,7,68,145,116,141,134,155,142,154,25,
+247,45,249,131,142,152,150,155,163,141,25,228,145,5,219,252,37,7,251,163,
+251,42,251,24,251,33,251,26,223,65,247,8,110,31,85,127,68,111,112,114,251,
+15,251,2,154,251,22,52,66,115,119,49,134,135,145,122,59,24,139,195,114,186,
+181,212,148,188,192,30,247,5,243,143,247,26,214,213,8,196,197,168,161,220,
+27,183,173,137,139,31,78,251,195,136,124,124,122,119,138,25,32,133,5,59,7,
+247,119,248,160,21,54,6,251,21,83,206,244,247,13,225,209,247,73,31,216,6,
+14,74,250,152,190,21,215,7,129,112,56,108,87,27,100,86,157,199,149,31,247,
+42,249,203,5,251,197,6,251,181,251,44,67,251,80,103,31,112,251,31,247,15,
+61,248,122,29,113,82,247,91,29,143,247,19,233,240,8,182,182,164,165,247,0,
+27,209,6,133,108,96,251,135,96,26,63,163,73,247,13,247,15,247,60,215,139,
+30,251,189,249,242,21,63,252,39,5,139,86,137,115,251,73,72,200,247,50,167,
+30,247,17,164,221,200,247,91,27,14,247,232,28,5,122,249,175,21,212,80,247,
+34,251,81,44,50,103,81,60,30,145,164,144,163,141,161,8,251,187,6,251,181,
+251,25,64,251,67,106,31,114,251,26,247,13,56,248,122,29,111,72,247,91,29,
+145,247,29,233,240,8,182,182,144,165,247,0,27,207,6,136,110,137,110,111,26,
+251,203,247,90,67,247,17,247,79,247,45,247,11,213,215,30,247,21,247,227,29,
+180,143,166,31,247,136,153,247,230,247,1,247,115,26,253,71,247,10,21,65,252,
+29,5,62,6,251,73,90,204,247,44,169,31,247,4,161,202,203,247,91,27,248,212,
+251,8,21,251,37,251,109,251,2,251,66,122,30,247,48,175,247,1,247,126,247,
+27,27,207,182,84,76,31,14,249,70,28,7,40,247,167,29,254,96,6,251,183,251,
+217,37,251,210,251,46,247,30,74,247,52,100,31,251,247,61,218,251,223,247,
+121,10,69,248,11,248,13,27,245,6,41,252,136,137,123,119,248,40,10,250,161,
+247,227,10,252,121,6,245,248,173,5,247,173,247,94,29,251,170,6,240,248,163,
+5,248,26,248,108,29,253,144,247,101,21,32,252,167,5,251,7,6,251,97,251,6,
+178,247,27,247,142,247,68,246,247,152,31,14,251,231,45,29,14,252,243,247,
+232,209,247,117,10,95,112,159,164,120,30,164,199,5,146,130,111,157,107,27,
+85,114,112,100,83,196,82,247,20,247,62,29,252,241,248,205,28,5,35,21,167,
+105,187,38,251,0,251,23,73,251,11,78,192,84,192,100,30,205,94,184,104,88,
+26,77,89,100,84,94,113,160,161,120,30,164,201,5,145,130,111,157,108,27,84,
+114,113,100,81,195,84,247,23,247,55,230,231,240,198,81,186,82,182,31,81,180,
+78,188,182,26,172,160,192,198,153,152,133,137,145,30,198,61,5,172,141,202,
+149,197,26,14,251,231,45,29,247,26,248,164,35,29,251,231,45,29,247,26,248,
+164,115,29,251,28,247,194,46,29,251,231,45,29,247,43,247,137,44,29,251,231,
+45,29,247,116,248,228,248,203,29,251,231,45,29,93,248,66,46,29,251,231,45,
+29,252,18,28,251,104,66,29,251,231,45,29,252,18,28,251,104,72,10,247,228,
+28,6,70,46,29,251,231,45,29,252,5,254,255,54,10,251,231,45,29,251,127,254,
+236,51,10,251,231,249,95,247,46,29,248,158,10,251,45,116,215,247,29,121,30,
+251,7,6,43,252,135,5,133,104,137,129,122,26,251,13,206,82,247,81,221,227,
+176,247,0,211,53,176,139,30,251,38,251,44,5,84,104,178,221,153,31,191,247,
+161,5,110,186,204,120,227,247,34,29,252,241,248,216,28,5,35,247,117,10,40,
+124,185,221,127,30,65,6,76,251,191,5,135,118,138,133,128,26,67,183,105,247,
+14,193,196,161,204,182,83,161,139,30,44,48,5,103,117,162,188,148,31,172,247,
+54,5,121,170,181,128,196,27,247,62,29,251,231,224,29,242,223,166,180,202,
+31,102,251,78,109,251,50,79,96,53,114,25,251,52,247,34,5,121,130,49,107,55,
+26,65,180,96,247,25,247,91,247,19,237,247,97,178,30,220,248,52,5,142,153,
+139,156,155,26,247,81,10,251,231,45,29,191,251,175,35,10,251,231,249,156,
+248,178,21,122,233,251,209,84,5,66,200,73,205,201,247,187,29,248,77,29,80,
+165,85,178,90,30,251,110,102,153,48,247,177,187,145,133,146,134,146,134,25,
+247,80,10,247,146,247,30,247,46,247,60,219,83,204,71,199,31,14,251,231,249,
+95,247,46,29,236,64,210,81,55,26,46,75,62,32,65,59,180,247,93,119,30,43,6,
+85,251,164,5,247,79,112,252,136,247,195,27,241,217,209,225,184,112,178,114,
+31,251,67,251,19,5,68,43,247,195,177,93,31,135,151,222,137,155,27,247,67,
+140,247,86,247,3,140,247,102,8,247,81,10,251,235,248,72,250,45,21,207,206,
+90,78,251,13,81,127,251,81,251,5,31,251,56,41,251,24,43,251,69,26,251,42,
+247,5,70,247,87,247,55,247,83,225,247,20,206,92,177,93,94,98,128,130,127,
+30,108,251,34,5,100,103,101,114,85,27,46,83,196,208,247,34,247,11,156,247,
+52,241,31,247,70,247,6,228,207,247,58,26,247,29,251,2,209,251,80,251,46,251,
+31,77,251,6,82,173,118,181,133,30,167,135,179,158,153,144,190,247,17,24,145,
+147,187,159,164,27,14,252,176,249,211,28,5,123,180,29,253,115,249,35,28,6,
+91,21,184,70,157,105,251,51,251,8,251,1,251,34,128,30,88,253,77,132,63,135,
+76,55,106,25,35,203,5,106,129,107,113,106,26,95,210,122,174,247,49,247,7,
+247,0,247,34,150,30,192,249,77,146,216,143,198,222,174,25,241,76,5,173,149,
+171,164,172,26,14,252,127,250,3,247,235,10,59,28,251,143,131,251,21,130,39,
+251,21,81,25,251,49,246,71,120,121,109,122,59,25,139,109,251,52,126,86,30,
+135,118,137,117,116,26,251,27,244,102,247,8,227,247,46,188,247,1,190,110,
+159,98,160,30,251,84,251,35,5,81,101,159,201,198,159,202,149,197,31,133,164,
+165,137,164,27,247,136,247,68,247,72,247,131,155,31,221,28,4,113,147,247,
+21,146,237,247,21,197,25,247,49,34,5,192,154,187,182,194,26,14,251,15,249,
+254,247,32,10,152,28,5,172,180,29,252,168,249,218,247,235,10,55,28,251,114,
+5,174,98,67,147,94,27,251,44,39,251,23,251,31,39,221,73,233,247,27,247,11,
+184,247,7,217,31,172,92,167,87,162,86,247,1,180,24,104,223,102,201,84,212,
+165,219,145,237,145,221,215,250,175,24,147,247,21,146,237,247,21,197,247,
+49,34,24,193,154,186,182,194,26,253,81,28,249,192,21,60,123,84,42,42,27,88,
+106,170,190,219,191,209,216,182,178,120,102,180,31,14,251,6,249,153,28,5,
+221,21,251,79,251,64,251,68,251,97,251,36,220,251,17,220,251,10,31,251,59,
+251,101,251,95,251,115,251,26,251,92,112,148,113,149,112,150,8,132,112,130,
+88,139,26,152,132,156,131,160,132,8,78,36,100,45,57,26,251,16,226,79,231,
+241,211,198,228,162,135,165,128,165,30,251,70,75,5,115,153,121,166,174,26,
+195,166,207,184,216,30,123,205,219,126,224,27,247,110,247,251,247,28,247,
+219,247,29,51,247,19,55,247,14,31,247,26,247,74,238,247,64,247,26,26,247,
+31,251,0,189,34,30,102,254,229,21,251,125,251,131,251,0,251,61,92,82,146,
+153,78,30,247,8,247,65,247,75,247,99,247,56,247,96,8,199,50,189,52,51,26,
+251,33,249,151,21,247,10,220,247,7,227,211,171,73,77,35,71,251,21,41,251,
+32,30,80,229,91,227,229,26,14,109,247,15,10,34,47,196,143,131,30,129,143,
+118,160,147,26,237,10,201,89,139,30,151,131,151,127,129,26,131,251,99,248,
+162,29,14,251,135,249,222,250,78,21,176,47,51,160,38,27,251,134,251,76,251,
+19,251,93,251,15,247,7,82,247,2,88,31,211,106,247,42,86,44,26,251,17,251,
+7,64,251,27,81,90,157,164,88,30,84,155,192,247,44,141,159,8,251,17,6,82,251,
+140,5,123,167,247,15,75,247,58,27,247,226,247,15,247,77,247,37,247,25,251,
+9,201,251,4,190,31,65,174,251,40,186,237,26,247,1,247,3,221,247,13,157,247,
+11,118,112,137,30,133,251,47,5,247,2,6,14,109,40,29,219,249,171,35,29,109,
+40,29,219,249,171,115,29,251,28,247,194,46,29,109,40,29,236,248,144,44,29,
+109,40,29,247,62,249,235,248,203,29,109,40,29,39,249,73,46,29,109,40,29,252,
+127,28,250,223,66,29,109,40,29,252,127,28,250,223,72,10,248,27,28,7,214,46,
+29,109,40,29,252,114,28,251,12,54,10,109,40,29,251,236,28,251,31,51,10,109,
+250,238,249,135,21,113,247,13,252,118,49,5,35,189,251,13,208,247,13,248,143,
+10,225,85,113,247,241,29,205,247,205,5,248,15,10,37,193,69,214,82,31,251,
+191,84,151,251,0,248,73,214,5,138,140,140,138,141,27,241,86,247,78,65,251,
+31,26,251,79,251,47,251,4,251,68,112,251,105,184,188,143,30,247,129,29,247,
+25,60,220,39,202,31,14,88,122,182,21,251,19,247,203,133,252,8,247,188,27,
+235,243,248,30,10,251,19,80,247,119,227,52,31,136,171,172,137,173,27,248,
+13,247,86,247,116,247,121,223,115,247,21,251,154,247,15,31,251,115,244,73,
+201,242,26,247,33,247,21,247,32,247,70,219,244,95,103,138,247,241,29,205,
+247,205,5,173,63,251,3,179,251,45,27,251,165,251,158,251,34,251,199,251,34,
+243,56,247,43,59,31,247,25,67,247,75,64,251,25,26,251,79,251,52,251,4,251,
+63,251,12,251,11,185,189,142,30,162,247,125,5,251,32,6,14,135,250,107,248,
+39,21,251,33,6,62,251,132,5,118,132,52,71,251,46,27,251,43,41,219,247,15,
+247,84,247,129,220,247,68,226,31,247,92,238,247,89,247,41,247,136,26,247,
+84,251,59,225,251,129,251,65,251,1,104,100,43,30,80,251,205,5,247,17,6,210,
+247,86,5,181,153,218,189,247,16,27,247,33,216,66,251,2,251,32,251,16,33,251,
+103,46,31,251,174,251,16,251,81,251,18,251,143,26,251,67,247,25,251,33,247,
+225,247,78,247,31,202,183,207,30,14,181,250,244,249,245,21,251,55,6,190,212,
+171,226,243,26,247,84,251,42,225,251,105,251,48,41,104,100,52,30,86,251,205,
+5,247,5,6,203,247,86,5,181,151,210,189,247,4,27,247,19,208,66,251,2,38,81,
+55,35,66,31,252,254,248,162,10,248,90,6,67,102,75,102,85,98,8,251,168,248,
+162,10,247,77,6,81,67,107,53,251,1,26,251,67,247,11,251,33,247,192,247,60,
+247,17,202,183,200,30,195,247,221,5,251,19,6,69,251,132,5,118,133,61,71,251,
+31,27,251,28,51,219,247,15,247,21,236,218,247,4,204,31,248,196,6,153,239,
+5,252,24,6,196,171,194,177,188,184,8,247,131,6,14,181,247,30,22,224,6,156,
+230,175,127,181,130,186,135,25,127,73,5,224,6,151,201,5,186,183,142,145,181,
+31,126,68,5,225,6,156,227,5,247,99,193,247,14,247,20,247,42,26,247,70,251,
+33,223,251,37,213,30,247,232,10,225,85,113,247,241,29,205,247,205,5,247,128,
+10,247,82,65,251,31,26,60,104,83,76,103,30,160,246,5,216,152,95,189,85,27,
+90,96,114,90,101,31,175,135,110,177,85,27,91,99,113,91,99,31,182,138,109,
+170,91,27,51,86,71,56,31,137,75,173,83,203,100,8,247,219,247,26,21,162,150,
+180,201,188,27,160,160,128,72,128,31,120,39,99,130,94,134,89,137,25,251,87,
+246,21,164,151,178,201,187,27,174,144,105,96,132,31,117,251,8,88,142,97,145,
+105,149,25,251,16,247,13,21,175,155,166,166,169,135,104,98,131,30,125,65,
+5,106,163,125,169,172,26,14,253,64,247,232,194,247,73,29,216,247,9,186,148,
+161,30,188,7,247,240,29,253,39,248,220,28,5,18,214,29,62,28,6,137,214,29,
+252,119,52,29,248,75,249,98,39,29,252,119,52,29,247,123,249,98,46,29,252,
+119,52,29,229,28,250,181,44,29,252,119,52,29,170,254,162,247,51,29,252,119,
+52,29,36,28,251,129,66,29,252,119,52,29,49,254,230,54,10,252,119,52,29,248,
+102,248,193,78,10,252,119,52,29,183,254,211,51,10,252,119,249,95,249,238,
+247,131,10,195,29,198,211,150,171,212,30,90,251,154,247,93,10,210,248,19,
+5,124,96,47,104,61,247,195,10,14,253,78,248,216,28,5,20,247,73,29,177,186,
+146,158,187,30,107,251,49,5,86,128,107,119,91,27,52,225,5,129,136,74,125,
+84,26,102,182,100,217,247,7,205,187,232,159,30,185,247,122,5,247,240,29,252,
+119,249,14,248,91,21,247,5,251,171,7,198,247,182,5,247,193,233,251,175,6,
+180,247,126,248,167,10,80,251,182,5,251,41,251,5,247,19,6,95,251,111,247,
+77,10,187,247,132,5,14,252,76,249,139,249,238,21,233,251,174,7,247,165,10,
+247,202,10,106,251,52,5,119,6,251,40,49,41,251,11,82,31,245,6,197,162,198,
+175,174,27,166,159,135,133,158,31,73,251,221,5,133,110,137,110,113,26,38,
+182,63,247,39,247,11,247,74,217,154,172,30,221,7,124,98,45,104,63,27,70,75,
+182,211,153,31,193,247,160,5,147,147,137,149,27,247,40,229,240,247,8,196,
+31,33,6,84,116,82,100,104,27,108,117,145,147,118,31,188,247,132,5,14,252,
+119,249,202,28,4,135,21,58,190,251,54,251,150,5,251,39,6,247,165,10,247,176,
+10,134,117,137,117,138,119,25,251,78,251,189,215,88,247,30,247,110,5,98,166,
+190,113,226,27,247,10,247,73,217,154,173,31,221,7,124,96,47,104,61,27,70,
+75,182,211,154,31,166,247,27,247,212,248,144,5,222,233,115,6,251,169,45,21,
+245,6,251,48,251,142,5,14,252,80,249,244,28,5,100,21,186,106,221,251,25,251,
+148,251,33,251,174,251,138,86,30,129,10,247,193,233,251,175,6,178,247,68,
+182,247,83,186,178,182,178,25,247,54,251,21,5,153,143,223,165,221,26,14,252,
+59,249,95,249,238,247,131,10,251,64,71,5,72,7,247,39,151,251,107,254,193,
+5,133,110,137,111,112,26,39,182,65,247,39,247,11,247,75,215,153,171,30,221,
+7,125,98,45,104,63,27,70,75,184,211,154,31,247,111,250,211,5,14,252,98,249,
+95,249,238,248,176,29,5,139,45,252,62,112,251,103,30,41,55,61,43,72,43,204,
+90,24,184,202,207,223,208,209,8,55,160,207,94,245,27,247,95,247,41,247,0,
+247,52,239,82,211,43,67,88,118,101,77,31,238,248,129,5,247,33,253,7,21,70,
+47,57,53,49,141,247,7,200,149,30,192,209,186,160,204,27,199,153,104,75,31,
+14,251,81,249,186,28,4,211,21,251,17,251,175,5,251,141,6,247,165,10,129,10,
+247,118,6,251,175,253,24,5,231,6,247,175,249,24,5,247,45,233,251,4,6,247,
+17,247,175,5,14,248,226,28,5,137,247,20,29,248,8,250,146,247,131,10,129,10,
+28,4,245,253,187,130,29,14,247,116,28,4,231,249,248,21,201,78,221,251,39,
+251,171,251,164,251,181,252,3,47,155,61,172,80,30,125,96,88,126,91,247,195,
+10,247,92,233,251,74,6,247,165,10,195,29,241,247,39,197,165,201,30,163,115,
+168,118,170,125,247,5,29,247,72,186,247,29,203,221,30,198,219,211,170,188,
+141,247,9,251,50,24,247,122,10,246,27,175,158,116,109,31,14,247,3,28,4,141,
+250,7,21,188,86,219,251,46,251,59,251,91,251,1,251,93,37,219,49,223,73,30,
+239,64,209,81,55,26,35,61,73,55,69,98,172,180,113,30,176,239,5,152,126,94,
+169,90,27,55,100,94,74,118,145,119,148,120,31,137,124,123,137,124,247,195,
+10,247,68,233,251,50,6,247,165,10,195,29,208,231,166,164,209,30,108,186,207,
+118,233,27,247,144,247,29,247,46,247,60,239,53,217,49,211,31,53,208,45,219,
+213,26,192,167,227,229,164,158,129,133,147,30,233,251,17,5,188,143,235,153,
+234,26,14,170,28,5,20,28,5,123,21,215,35,169,84,251,134,251,72,251,74,251,
+129,125,30,128,251,30,5,251,154,6,180,247,126,248,193,10,247,36,205,166,169,
+30,221,7,114,99,85,114,61,247,195,10,247,166,6,74,254,54,130,251,19,131,35,
+251,21,84,25,251,50,245,5,86,123,90,96,83,26,66,247,1,110,194,247,134,247,
+68,247,72,247,130,155,30,223,28,4,137,147,247,21,145,237,247,21,197,25,247,
+50,34,5,192,156,186,180,194,26,14,233,28,4,236,247,46,10,90,91,137,131,97,
+31,171,247,76,247,224,29,247,14,10,247,19,249,30,5,138,148,159,142,148,219,
+247,35,83,167,29,251,65,250,93,249,220,21,247,39,253,194,251,39,247,143,7,
+251,67,42,251,48,251,62,251,129,26,251,115,248,59,10,30,247,238,10,247,5,
+247,7,194,247,133,247,104,247,15,31,14,252,112,248,166,249,216,21,239,96,
+215,251,39,251,11,251,74,61,125,104,30,57,7,153,182,233,174,215,27,209,202,
+96,65,125,31,251,27,253,56,5,251,193,45,247,174,6,96,251,125,5,247,17,6,242,
+247,96,247,43,209,5,207,7,251,21,124,247,25,249,38,5,145,167,141,168,166,
+26,14,248,128,59,10,14,248,128,28,6,47,192,102,29,123,59,190,91,223,127,25,
+101,106,76,70,117,202,29,155,165,194,151,165,30,217,146,235,183,204,165,8,
+14,131,247,199,247,107,21,251,34,111,189,247,59,10,249,35,5,247,69,247,247,
+29,253,194,6,248,13,29,247,69,6,14,121,98,10,78,28,5,6,68,29,242,50,10,14,
+251,209,250,103,28,6,73,21,253,117,6,100,251,79,5,223,6,180,247,0,5,155,144,
+151,147,155,27,247,59,6,251,31,253,68,137,125,125,131,123,138,25,62,133,5,
+87,247,238,191,7,63,248,155,10,249,68,5,247,64,6,158,147,132,122,137,31,134,
+251,0,5,223,6,14,251,28,250,134,250,111,21,254,34,6,88,251,131,248,162,29,
+188,247,25,5,153,145,152,147,153,27,247,80,6,251,56,253,177,248,116,10,248,
+75,219,7,36,145,115,141,139,147,141,147,25,247,58,249,179,5,247,90,248,64,
+10,14,242,50,10,69,249,194,48,10,181,28,4,133,28,4,126,21,247,169,29,251,
+44,254,47,247,159,10,247,45,250,47,247,246,29,220,248,174,21,254,143,248,
+162,10,250,143,6,14,242,50,10,251,232,249,32,46,29,242,50,10,252,154,28,249,
+234,44,29,242,50,10,252,131,28,251,39,68,29,242,50,10,253,91,28,250,182,66,
+29,242,50,10,253,78,28,250,227,54,10,242,50,10,252,200,28,250,246,51,10,242,
+28,5,49,28,5,94,248,178,29,45,252,148,5,251,187,35,247,166,6,41,252,167,247,
+7,29,237,248,167,5,247,187,243,251,166,6,233,248,148,247,26,10,14,181,250,
+32,249,40,21,91,224,251,100,46,160,247,19,247,151,247,8,91,224,251,83,53,
+204,248,24,247,246,29,196,247,205,5,247,169,29,60,252,113,251,163,251,13,
+183,50,247,99,232,118,251,18,251,146,251,5,183,50,247,83,225,87,251,203,247,
+159,10,206,248,37,5,14,242,28,4,183,247,20,29,28,4,172,28,6,2,177,10,14,242,
+28,5,49,247,167,29,254,37,6,251,48,251,17,76,251,60,251,15,205,98,198,188,
+197,168,182,186,31,251,42,247,31,5,206,186,164,238,30,247,117,6,248,136,29,
+247,7,29,247,105,28,4,123,247,26,10,14,242,249,222,28,5,2,21,247,156,6,248,
+76,10,202,247,205,248,177,10,251,115,28,251,80,247,51,10,8,14,248,90,28,6,
+84,247,46,10,80,85,118,105,93,31,200,247,217,5,247,156,6,168,151,127,110,
+137,31,135,251,32,248,136,10,198,247,165,5,232,29,247,6,248,253,171,184,5,
+171,159,184,166,180,219,211,94,167,29,247,92,28,5,78,28,4,204,21,247,39,28,
+251,144,251,39,247,249,7,251,143,251,51,251,115,251,164,251,182,26,251,143,
+247,54,251,181,248,44,247,90,247,90,247,16,205,208,30,247,48,7,251,19,251,
+2,251,77,35,251,45,27,251,81,251,73,247,35,247,151,247,210,247,69,247,169,
+247,120,247,41,31,14,242,251,21,22,28,4,110,6,199,247,205,5,251,21,6,75,251,
+72,5,112,131,121,125,114,27,251,148,6,247,105,28,4,123,143,163,160,152,163,
+141,25,247,11,149,5,248,46,10,247,8,129,176,137,147,122,135,119,25,248,136,
+29,5,251,156,6,110,127,151,168,141,31,147,247,72,5,251,21,6,14,242,28,5,49,
+28,5,94,248,200,10,231,248,66,29,248,142,5,117,6,251,8,149,102,247,203,29,
+247,105,28,4,123,247,26,10,14,248,45,248,95,247,236,21,251,130,94,247,2,207,
+29,247,73,250,92,247,26,10,202,247,205,248,177,10,14,248,219,250,70,28,5,
+2,21,248,0,29,254,98,247,226,29,247,68,6,251,117,28,251,137,247,200,29,249,
+250,7,247,118,247,23,248,84,29,239,248,144,247,204,29,247,23,147,5,247,76,
+10,247,117,28,4,111,5,14,247,218,28,5,23,22,227,7,36,147,115,141,126,158,
+143,161,25,223,248,66,5,247,126,186,251,53,208,251,32,27,45,251,41,76,80,
+251,5,31,243,248,156,5,247,120,6,157,152,122,119,136,248,90,29,254,137,247,
+225,29,247,122,6,251,116,254,255,133,117,119,120,112,137,25,251,11,131,5,
+51,248,161,227,7,251,5,147,116,141,125,158,143,161,25,233,248,115,5,183,228,
+227,184,208,27,247,52,180,94,251,22,112,31,64,252,29,132,117,119,120,112,
+137,25,41,131,5,51,7,14,247,233,28,5,70,248,187,21,247,127,251,71,247,30,
+251,76,47,251,54,73,80,251,2,30,231,248,107,5,247,90,6,158,149,122,119,248,
+90,29,254,78,247,225,29,247,91,6,251,115,254,255,135,117,116,120,114,137,
+25,251,10,131,5,51,248,148,227,7,38,147,115,141,124,158,144,161,25,243,248,
+167,5,182,227,237,184,211,27,247,80,238,40,251,41,251,87,42,251,133,251,113,
+120,31,121,51,5,247,232,247,97,247,148,247,220,31,14,252,32,248,208,252,67,
+21,183,7,119,102,110,136,122,27,109,98,158,189,151,31,246,248,109,5,251,16,
+6,38,252,88,5,96,88,70,103,75,27,104,95,175,181,149,31,245,248,104,5,84,248,
+3,10,53,252,19,5,75,124,166,49,247,16,27,228,215,170,200,208,31,120,126,66,
+239,196,229,166,156,172,30,14,252,33,249,185,249,193,169,29,160,28,4,164,
+169,29,121,33,29,247,43,28,5,82,61,29,121,33,29,79,250,203,49,29,121,33,29,
+33,28,4,113,58,10,121,33,29,105,28,5,94,57,29,121,33,29,150,28,5,146,48,10,
+121,33,29,157,28,5,86,35,10,121,33,29,157,28,5,86,248,216,29,121,33,29,78,
+28,5,6,68,29,121,33,29,78,28,5,6,248,206,10,121,33,29,88,28,4,240,60,10,248,
+76,248,134,35,29,121,33,29,88,28,4,240,60,10,247,202,247,107,42,10,121,33,
+29,88,28,4,240,60,10,248,166,248,198,48,10,121,33,29,88,28,4,240,248,207,
+29,121,33,29,252,42,250,203,74,10,121,33,29,251,90,28,5,96,37,10,121,33,29,
+251,255,252,182,44,29,121,33,29,251,168,251,115,68,10,121,33,29,251,238,251,
+228,182,10,121,33,29,252,192,251,234,66,29,121,33,29,251,83,90,69,29,121,
+28,5,85,154,10,197,247,183,5,34,6,83,251,172,148,10,251,184,248,19,81,29,
+14,121,250,228,248,193,21,251,68,6,229,248,66,5,251,83,6,49,252,66,5,252,
+23,6,235,248,91,5,55,248,163,10,251,205,5,251,60,6,116,251,3,5,247,58,6,94,
+251,107,248,37,10,247,29,247,9,247,100,29,247,19,10,190,247,139,5,247,68,
+6,252,2,22,96,251,105,248,62,10,184,247,107,5,14,252,33,249,203,250,242,21,
+251,6,6,198,247,150,5,251,17,6,82,251,150,5,251,144,6,200,247,165,5,86,6,
+251,95,248,129,10,96,251,81,5,251,1,6,125,74,5,247,1,6,110,251,21,247,152,
+29,248,98,10,151,31,172,247,42,5,247,9,6,251,132,22,111,251,21,5,96,90,69,
+104,75,27,105,96,174,182,147,31,167,247,21,5,14,247,118,28,5,43,250,250,21,
+247,1,82,207,44,62,55,81,53,90,165,94,139,30,247,36,6,116,41,82,55,251,5,
+94,170,247,41,24,142,29,247,29,247,9,247,100,29,247,19,10,247,5,248,176,5,
+247,72,193,247,68,247,53,247,64,26,251,246,251,199,247,27,10,14,247,118,79,
+10,161,248,228,35,29,247,118,79,10,251,0,247,201,42,10,247,118,79,10,247,
+11,248,232,35,10,247,118,79,10,42,248,242,37,10,247,118,79,10,252,121,254,
+236,66,29,248,70,28,5,216,249,185,21,198,80,247,38,251,81,51,57,108,89,67,
+30,151,197,5,142,29,247,18,247,56,195,247,44,247,42,31,251,61,194,247,30,
+100,238,27,247,79,247,45,247,11,213,215,31,247,21,247,58,10,251,107,248,40,
+29,246,248,103,29,234,250,147,133,29,14,251,215,249,160,28,5,117,21,92,6,
+161,105,141,112,123,26,115,124,107,98,133,133,139,239,252,155,30,251,7,7,
+248,126,46,5,185,93,178,74,81,26,110,108,103,100,119,75,154,223,252,73,30,
+88,7,181,251,77,5,177,6,151,242,5,66,248,17,180,129,164,27,205,208,172,235,
+221,105,209,73,203,31,143,147,139,148,27,169,188,147,211,192,110,222,120,
+170,31,14,248,64,28,5,76,133,29,28,251,146,251,27,21,78,88,90,77,82,194,84,
+196,201,192,190,200,201,86,188,77,31,252,0,4,78,88,88,77,80,194,88,198,199,
+192,190,198,201,86,190,77,31,14,121,250,140,249,35,21,247,138,251,15,247,
+3,251,17,43,94,51,98,98,165,114,139,30,247,70,6,195,82,155,77,59,26,251,14,
+251,33,252,11,251,111,251,5,251,19,198,247,9,153,143,172,147,180,30,247,23,
+249,7,5,55,247,100,10,39,252,121,5,125,73,132,86,111,26,251,62,247,52,46,
+247,54,248,101,247,17,248,173,247,35,30,14,252,32,249,155,28,4,154,21,247,
+40,59,205,58,77,110,86,115,114,155,124,139,30,247,8,6,176,105,149,102,91,
+26,66,47,251,117,251,34,65,57,174,209,148,142,158,144,164,30,224,248,12,5,
+84,248,3,10,74,251,183,5,130,99,135,108,122,26,37,243,83,244,247,194,220,
+247,214,225,30,14,52,216,248,33,21,251,4,252,211,117,251,7,113,251,21,8,247,
+85,6,157,219,135,245,123,247,43,154,247,56,25,69,179,194,105,177,27,247,6,
+247,34,220,193,216,31,87,141,156,56,247,13,27,227,247,31,184,168,190,31,247,
+19,10,247,56,249,168,5,251,83,6,251,55,253,180,5,111,86,45,95,68,27,251,25,
+107,225,247,37,167,31,247,21,249,21,5,251,68,6,251,5,252,196,133,107,5,14,
+179,250,248,250,111,21,248,148,10,251,183,251,15,251,252,251,144,251,50,96,
+247,39,247,25,247,136,247,26,247,148,241,247,19,30,248,92,29,251,19,251,35,
+251,8,251,73,251,92,26,251,144,247,45,251,32,247,132,247,213,247,150,247,
+171,247,220,248,78,10,14,251,252,249,224,28,5,96,21,251,107,6,139,176,63,
+62,26,251,66,59,251,110,251,54,34,113,228,218,247,40,225,247,45,206,215,30,
+251,107,6,129,90,227,135,5,141,137,141,139,137,26,57,53,64,251,1,251,12,26,
+251,44,239,57,247,48,247,101,247,59,247,58,247,89,218,117,203,108,182,30,
+137,143,143,137,143,141,232,143,24,14,179,250,229,248,91,21,247,5,71,7,143,
+140,144,144,26,248,78,10,153,221,5,248,148,10,86,134,84,131,84,30,252,171,
+6,184,247,63,229,247,49,212,230,8,248,92,29,56,46,61,251,2,94,251,12,8,36,
+251,5,212,6,134,110,137,110,109,26,251,144,247,45,251,32,247,132,247,170,
+247,124,247,102,247,162,195,30,252,184,252,11,21,251,50,96,247,39,247,25,
+170,141,171,143,171,31,248,170,6,251,95,86,251,4,251,64,251,66,27,14,251,
+48,250,236,248,85,10,251,193,88,7,214,133,163,138,144,129,137,125,25,45,252,
+72,5,251,23,111,84,251,7,251,65,27,251,6,66,191,242,161,143,179,150,187,31,
+230,248,53,247,192,10,137,125,25,46,252,53,5,127,82,133,91,115,26,251,48,
+247,20,79,247,56,247,104,247,14,244,247,70,176,30,242,248,115,141,155,153,
+147,155,140,25,14,199,28,4,164,250,33,21,248,59,29,251,7,252,150,248,137,
+10,248,95,10,247,5,248,128,247,160,29,251,3,252,128,247,151,10,247,15,248,
+202,248,132,29,14,251,237,250,11,28,5,50,21,186,251,141,92,7,203,135,5,156,
+137,138,135,135,26,64,251,200,5,46,118,98,63,251,24,27,51,86,175,206,154,
+142,167,146,172,31,213,247,188,140,146,146,142,151,141,25,205,143,5,186,251,
+175,92,7,203,135,155,137,139,135,138,135,25,66,251,187,5,130,99,134,104,122,
+26,251,9,244,97,247,21,247,62,238,215,247,20,170,30,219,247,232,140,146,146,
+142,150,141,25,14,247,243,33,10,192,248,169,61,29,247,243,33,10,251,50,247,
+142,49,29,247,243,33,10,251,96,247,200,58,10,247,243,33,10,251,24,248,181,
+57,29,247,243,33,10,52,248,233,48,10,247,243,33,10,59,248,173,35,10,247,243,
+33,10,59,248,173,248,216,29,247,243,33,10,251,51,248,93,68,29,247,243,33,
+10,251,51,248,93,248,206,10,247,243,33,10,251,41,248,214,29,247,243,33,10,
+251,41,248,71,60,10,247,202,247,107,42,10,247,243,33,10,251,41,248,71,60,
+10,248,166,248,198,48,10,247,243,33,10,251,41,248,71,248,207,29,247,243,33,
+10,252,140,247,142,74,10,247,243,33,10,251,188,248,183,37,10,247,243,33,10,
+252,171,28,249,17,44,29,247,243,33,10,252,84,28,250,84,68,10,247,243,33,10,
+252,154,28,249,227,182,10,247,243,33,10,253,108,28,249,221,66,29,247,243,
+33,10,253,21,28,251,2,69,29,247,243,28,5,254,247,166,10,225,252,99,53,7,247,
+7,129,176,247,166,29,47,252,97,5,253,44,6,233,248,97,191,10,45,252,97,5,251,
+78,6,114,251,6,5,247,81,6,112,251,13,247,152,10,184,247,116,5,247,69,6,163,
+247,6,5,251,70,6,229,248,97,248,133,29,251,195,252,252,21,110,251,44,247,
+167,10,164,247,13,5,14,199,250,223,248,84,21,247,0,251,7,7,210,247,217,248,
+132,29,242,147,5,248,59,29,65,251,221,5,252,139,6,214,247,217,247,160,29,
+65,251,221,5,251,33,251,0,247,8,6,127,84,247,151,10,168,247,25,5,252,83,251,
+250,21,248,95,10,152,198,5,248,140,6,122,62,248,137,10,14,248,199,43,10,14,
+248,199,43,10,252,211,247,122,35,29,248,199,43,10,253,85,86,42,10,248,199,
+43,10,252,114,247,126,35,10,248,199,43,10,253,74,247,136,37,10,248,199,43,
+10,254,250,28,248,174,66,29,247,235,28,5,113,250,46,21,247,84,51,247,185,
+251,101,36,41,73,49,86,182,94,139,30,247,103,6,168,110,204,251,10,251,50,
+26,251,152,251,148,252,107,251,215,251,48,251,19,235,247,78,154,145,192,155,
+213,30,247,62,249,213,5,252,27,53,6,247,9,129,174,247,166,29,251,33,253,76,
+5,116,32,127,55,117,26,251,132,247,82,251,9,247,109,248,130,247,222,248,56,
+248,167,30,14,247,112,250,114,28,5,202,21,251,4,191,251,210,253,26,85,247,
+247,247,26,29,244,253,56,251,224,253,56,234,84,247,160,248,171,202,252,40,
+5,247,47,6,249,87,28,5,29,247,0,151,5,247,85,29,71,248,71,5,14,249,181,28,
+5,55,247,232,21,247,3,29,247,7,254,185,101,55,103,57,71,51,247,205,29,247,
+34,247,10,247,147,247,9,30,249,25,28,5,92,247,13,151,5,248,60,29,14,165,248,
+186,247,167,29,46,247,164,10,251,193,28,249,248,138,29,183,247,122,250,19,
+28,5,77,247,0,151,5,225,252,53,53,7,239,135,178,137,144,119,126,120,25,253,
+29,254,94,5,14,247,245,28,5,170,247,167,29,251,248,6,182,251,6,169,251,38,
+251,13,26,251,199,251,27,252,216,252,29,251,105,67,247,87,247,76,247,187,
+247,42,247,253,247,74,247,125,30,251,246,6,114,33,247,9,128,172,137,139,115,
+124,118,25,139,251,29,251,74,129,121,30,37,251,48,44,251,74,251,79,26,251,
+201,247,91,251,101,247,209,248,60,247,238,248,38,248,43,247,1,105,247,0,106,
+242,30,133,153,100,239,139,26,129,162,153,157,166,141,247,16,154,24,14,251,
+43,71,29,14,252,119,248,132,212,21,184,115,168,82,106,112,128,123,122,30,
+165,251,41,97,42,78,56,49,251,1,25,97,248,14,133,197,108,167,67,140,25,251,
+34,98,5,104,7,233,134,5,154,147,131,123,147,31,166,72,167,251,239,130,26,
+140,112,129,108,121,103,8,216,6,220,223,247,53,247,62,247,10,247,94,8,148,
+155,158,175,179,26,14,252,117,249,130,28,5,37,172,10,187,28,6,156,172,10,
+251,43,71,29,138,248,162,35,10,251,43,71,29,252,241,28,251,98,66,29,251,43,
+249,106,199,21,252,31,6,126,54,5,247,178,6,100,251,107,111,29,247,179,250,
+242,152,10,251,43,28,4,123,249,238,248,51,29,251,77,251,151,237,29,247,16,
+243,228,166,8,14,248,1,249,52,106,21,248,100,28,4,119,247,75,247,67,228,166,
+247,31,251,11,24,248,74,29,251,60,251,61,254,130,252,58,30,251,66,250,115,
+135,168,151,149,172,248,96,10,172,137,151,127,143,112,25,247,111,28,251,4,
+5,14,251,57,250,64,250,13,21,213,100,188,53,88,98,120,113,112,30,188,251,
+140,76,251,54,251,39,251,62,251,32,251,72,25,80,247,252,233,190,247,7,247,
+19,131,247,15,25,229,132,49,193,39,27,251,7,33,251,1,251,0,137,31,120,147,
+100,139,30,145,100,155,43,139,26,103,135,108,141,94,151,127,76,24,192,118,
+169,137,193,143,204,252,33,24,147,94,139,80,115,85,8,247,11,6,247,17,247,
+32,247,154,247,176,247,74,247,228,8,153,166,168,198,207,26,252,138,108,21,
+145,61,76,45,77,112,113,247,50,24,182,131,184,199,188,27,174,161,110,106,
+141,31,14,251,43,249,97,250,210,21,54,184,251,117,252,57,123,247,48,247,157,
+10,160,81,161,251,76,155,251,57,251,191,252,195,24,218,93,247,127,248,72,
+5,145,67,143,86,135,247,101,10,247,162,10,108,247,198,5,14,247,240,28,5,220,
+247,222,10,251,222,253,162,87,249,129,141,10,205,253,98,24,251,9,251,96,66,
+63,61,247,21,29,14,251,133,249,246,250,13,21,247,177,10,63,251,92,251,62,
+251,116,251,75,251,76,25,247,67,250,25,5,59,6,251,202,248,44,29,251,123,28,
+251,93,195,10,188,247,144,247,132,247,127,247,116,247,143,247,52,247,206,
+25,152,166,169,198,207,26,14,248,30,71,29,248,156,248,60,55,29,14,250,63,
+71,29,248,156,248,60,55,29,248,172,28,4,230,55,29,14,28,5,204,71,29,248,156,
+248,60,55,29,248,172,28,4,230,55,29,248,172,28,4,230,55,29,14,251,43,250,
+80,182,21,198,7,251,37,148,5,116,127,151,168,129,31,96,247,2,96,248,214,153,
+26,137,186,153,190,168,199,8,251,11,6,251,17,251,32,251,138,251,176,251,76,
+251,228,8,127,112,108,80,71,26,66,178,89,225,190,180,158,165,168,30,100,247,
+140,202,247,54,232,247,31,247,31,247,75,25,202,253,11,150,43,186,91,247,2,
+137,25,14,252,119,249,116,249,191,21,174,7,45,145,5,124,131,146,156,133,31,
+111,205,111,247,239,147,26,138,168,148,169,158,175,8,61,6,58,55,251,52,251,
+62,251,11,251,94,8,131,123,119,104,98,26,95,164,109,195,172,166,150,155,157,
+30,114,247,41,180,236,200,222,229,247,2,25,180,252,14,146,81,170,110,210,
+138,25,14,179,28,4,170,249,228,21,233,84,209,40,251,4,251,163,251,226,65,
+76,30,247,31,82,67,247,161,251,87,27,251,74,90,251,122,251,33,129,31,202,
+6,211,168,145,233,241,27,247,15,215,251,187,71,166,31,67,55,251,5,251,4,251,
+13,26,251,3,236,98,235,247,47,244,247,23,247,42,207,80,247,4,114,201,30,219,
+209,247,60,247,121,247,8,27,227,131,34,78,143,31,207,6,157,203,170,214,207,
+26,253,29,253,44,21,88,90,92,87,103,120,176,172,196,215,217,174,182,30,155,
+94,168,81,92,26,14,251,43,250,80,250,13,247,14,29,155,126,111,148,31,186,
+251,71,161,252,6,160,251,91,8,40,61,251,49,251,58,251,17,26,251,21,239,80,
+247,11,247,25,247,9,247,29,247,11,166,112,247,146,135,171,30,247,76,247,111,
+247,25,247,77,247,19,247,123,248,128,29,253,27,254,206,21,53,86,88,94,98,
+119,182,170,178,247,2,247,33,172,170,30,143,100,151,49,120,26,14,252,117,
+249,113,28,5,37,21,184,115,168,83,107,112,128,123,120,30,164,251,42,98,43,
+80,55,49,251,0,25,96,248,15,5,196,132,109,168,67,27,251,33,100,5,102,7,233,
+135,153,137,150,133,143,120,25,169,35,156,251,116,151,251,10,8,76,92,36,38,
+65,26,62,205,102,214,227,213,221,212,156,123,247,43,137,158,30,247,11,247,
+25,227,247,0,221,247,34,8,147,153,157,174,180,26,252,54,253,29,21,87,103,
+111,110,112,127,163,158,161,211,223,159,158,30,143,116,147,86,127,26,14,51,
+248,188,247,83,21,248,156,36,251,5,247,123,251,19,27,58,81,251,71,91,91,139,
+108,174,31,173,157,247,17,193,27,230,247,88,252,95,251,86,149,31,139,57,251,
+88,251,24,26,251,24,181,47,196,196,171,247,15,244,244,102,247,97,139,30,198,
+247,76,247,185,248,75,247,90,26,251,50,6,251,115,251,37,251,171,65,251,114,
+30,14,252,78,247,126,251,237,188,10,252,78,248,110,250,24,188,10,247,112,
+76,29,14,251,133,250,192,248,85,10,251,163,88,7,204,136,164,138,140,128,133,
+127,25,251,231,252,231,40,248,231,136,156,148,145,160,140,25,196,142,5,190,
+251,195,88,7,190,136,156,138,151,132,142,123,25,247,21,253,146,5,240,6,248,
+96,249,166,5,14,97,250,250,250,35,21,217,251,238,59,7,227,137,5,156,143,133,
+131,135,31,252,32,253,60,251,8,249,58,137,149,141,143,161,141,25,217,141,
+5,219,252,21,59,7,239,131,247,52,254,50,5,247,27,6,248,189,250,50,5,14,247,
+112,76,29,71,248,175,35,10,247,112,76,29,253,96,28,249,223,66,29,247,112,
+28,5,186,247,166,10,247,85,29,82,248,5,247,15,247,96,5,217,247,25,247,4,247,
+114,247,49,26,203,121,194,78,85,117,61,96,30,92,157,102,92,26,251,17,43,251,
+45,78,34,30,100,74,63,248,123,247,26,29,247,11,253,144,252,165,254,4,5,246,
+6,248,78,249,125,199,252,13,248,137,29,14,189,250,241,249,158,248,51,29,251,
+47,251,71,237,29,233,163,228,166,8,14,249,243,76,29,249,37,151,63,29,14,28,
+5,226,76,29,249,37,151,63,29,249,154,149,63,29,14,28,8,101,76,29,249,37,151,
+63,29,249,154,149,63,29,249,154,149,63,29,14,247,112,28,4,180,22,225,7,61,
+143,113,141,120,151,135,164,25,251,90,28,4,254,5,251,48,6,253,87,28,250,227,
+251,0,127,5,53,248,54,225,7,38,143,100,141,137,158,150,157,25,248,156,250,
+117,247,45,254,117,143,112,125,129,108,137,25,51,135,5,53,7,14,214,250,210,
+217,21,55,147,123,141,135,149,135,156,25,251,97,249,254,5,251,33,6,253,6,
+254,27,247,250,29,248,92,249,48,247,49,253,48,142,128,138,123,117,137,25,
+57,131,5,61,248,33,7,14,247,161,28,5,215,28,5,14,21,219,252,66,59,7,229,133,
+184,135,147,121,123,116,25,139,252,40,252,160,99,84,30,122,188,251,64,248,
+160,139,26,131,168,153,159,176,141,247,1,145,24,219,252,177,59,7,247,33,129,
+247,167,253,213,5,112,106,251,76,251,103,65,26,251,11,247,4,92,244,247,25,
+247,46,247,1,247,35,211,65,247,82,120,195,30,248,204,249,125,5,253,62,254,
+240,21,88,94,110,92,102,106,159,178,184,227,240,168,174,30,149,106,174,43,
+108,26,14,247,233,48,29,14,251,55,250,179,28,5,40,21,158,123,192,75,93,111,
+115,133,133,30,166,251,36,85,251,6,80,37,56,41,25,106,248,104,39,129,70,251,
+39,52,251,60,70,251,10,25,110,248,96,79,142,251,53,97,5,105,7,239,129,176,
+252,143,126,110,5,237,6,214,245,232,247,51,217,247,46,168,252,55,24,222,6,
+166,169,247,222,248,18,247,30,26,14,247,233,48,29,251,209,248,156,35,29,247,
+233,48,29,252,83,247,129,42,10,247,233,48,29,251,192,247,129,44,29,247,233,
+48,29,251,181,248,58,39,29,247,233,48,29,252,133,248,58,46,29,247,233,48,
+29,253,24,247,129,74,10,247,233,48,29,253,230,28,251,96,66,29,249,128,250,
+13,250,103,21,141,10,204,253,79,24,247,29,6,164,170,247,50,247,179,247,23,
+247,135,8,247,206,247,61,247,26,247,161,227,27,247,37,251,7,5,194,162,193,
+204,185,26,215,80,198,45,69,251,9,121,251,0,51,30,75,61,79,37,44,251,70,40,
+251,77,251,39,251,163,93,34,8,14,251,12,250,196,28,5,39,21,157,123,193,73,
+94,112,114,133,133,30,166,251,35,86,251,5,77,36,57,41,25,107,248,103,38,131,
+70,251,40,53,251,62,69,251,8,25,110,248,97,78,141,251,52,98,5,104,7,239,129,
+176,252,144,127,112,5,235,6,215,246,233,247,47,217,247,48,168,252,54,24,223,
+6,165,168,247,222,248,19,247,29,26,251,44,253,150,21,160,123,192,76,93,111,
+114,131,135,30,163,251,35,86,251,5,80,39,57,38,25,106,248,105,39,129,69,251,
+39,53,251,60,69,251,11,25,111,248,97,77,143,251,52,98,5,102,7,240,131,176,
+252,144,124,110,5,238,6,214,246,234,247,50,214,247,45,170,252,54,24,221,6,
+166,170,247,221,248,17,247,29,26,14,247,233,28,5,145,182,21,198,7,251,43,
+156,82,249,226,159,186,5,251,44,6,251,6,251,68,251,38,251,157,251,10,251,
+150,91,249,79,24,251,19,6,99,90,252,142,253,17,251,122,26,106,163,51,238,
+208,182,180,150,147,30,98,247,131,221,247,81,234,247,62,247,16,247,55,25,
+193,253,160,247,45,158,246,247,135,247,25,247,173,245,247,89,25,184,253,146,
+232,132,5,14,247,199,249,28,249,70,21,92,251,133,5,251,82,102,90,251,83,251,
+40,27,251,30,121,247,77,247,113,182,31,180,247,105,247,12,247,111,247,74,
+171,8,213,7,251,115,140,251,147,251,104,76,251,219,8,251,118,95,163,251,165,
+247,187,27,247,76,231,247,40,217,174,31,61,175,251,40,247,76,247,187,247,
+19,247,165,247,118,186,30,205,247,219,251,62,247,108,251,149,134,8,65,7,247,
+62,107,173,251,111,98,251,105,8,251,113,96,49,251,77,251,30,27,251,40,164,
+247,83,247,82,176,31,186,247,133,5,14,247,161,28,5,12,248,179,21,247,199,
+251,99,247,54,251,186,252,40,251,236,251,206,252,45,251,46,205,251,52,247,
+68,247,43,247,23,223,247,34,199,30,251,42,247,4,63,247,32,247,158,247,39,
+247,232,247,120,30,251,94,131,21,251,21,67,251,202,251,60,39,89,199,233,30,
+247,50,247,9,220,247,21,26,189,113,200,81,41,88,251,23,57,30,96,153,98,94,
+26,251,29,63,251,46,251,47,40,117,247,3,217,247,170,247,111,247,247,247,197,
+247,115,236,251,73,251,94,30,14,249,181,54,29,14,247,28,28,5,166,248,85,10,
+251,170,88,7,199,136,163,138,148,131,131,124,25,251,162,252,178,71,249,0,
+5,251,0,6,251,204,252,248,92,248,170,5,154,145,147,159,140,30,198,142,5,190,
+251,200,88,7,195,136,162,138,147,132,140,123,25,206,253,146,5,232,6,247,225,
+249,37,216,253,37,5,224,6,248,36,249,166,5,14,248,59,28,6,51,250,33,21,217,
+251,246,59,7,219,137,169,137,135,131,137,135,25,251,207,252,246,57,249,86,
+5,251,35,6,252,5,253,74,88,248,230,5,149,137,141,147,159,27,221,141,5,219,
+252,29,59,7,217,137,5,163,137,144,133,127,26,220,254,34,5,247,19,6,248,30,
+249,130,231,253,130,5,247,9,6,248,121,250,48,5,14,249,181,54,29,252,72,248,
+171,35,29,249,181,54,29,252,202,247,144,42,10,249,181,54,29,252,55,247,144,
+44,29,249,181,54,29,252,44,248,73,39,29,249,181,54,29,252,252,248,73,46,29,
+249,181,54,29,254,121,28,249,223,66,29,250,161,28,4,177,247,167,29,251,58,
+6,252,87,247,64,29,248,118,250,218,247,11,254,218,5,247,23,6,248,25,249,255,
+5,247,215,247,30,247,11,247,125,225,27,247,62,32,5,195,174,174,204,173,26,
+195,95,201,251,25,57,46,101,88,81,30,45,56,55,251,29,46,251,120,251,182,253,
+46,24,14,201,28,4,136,249,33,21,251,91,6,171,247,7,5,247,59,239,251,31,6,
+247,7,248,44,212,151,5,225,251,149,53,7,194,135,161,137,148,125,132,114,25,
+35,252,11,5,251,70,6,109,248,142,5,39,6,251,35,252,142,5,251,63,6,121,248,
+11,5,164,145,153,158,141,30,193,143,5,225,251,206,53,7,201,135,160,137,146,
+127,140,112,25,157,252,11,5,251,11,39,247,16,6,144,251,7,5,251,21,39,247,
+26,6,168,252,222,5,245,6,247,57,248,222,5,247,46,6,177,252,222,5,239,6,247,
+57,248,222,5,247,119,6,252,41,247,107,21,247,36,6,107,251,7,5,34,6,252,88,
+247,7,21,247,29,6,107,251,7,5,39,6,247,113,247,7,21,219,6,146,251,7,5,251,
+11,6,247,156,39,21,211,6,80,251,105,5,252,97,247,105,21,205,6,83,251,91,5,
+247,163,249,24,21,147,251,22,5,94,6,14,123,62,10,14,123,62,10,14,251,246,
+248,229,214,21,182,105,168,91,251,3,46,251,32,46,87,30,247,40,97,93,224,76,
+27,122,251,11,102,132,115,31,106,7,247,8,125,157,137,212,251,58,150,90,25,
+91,251,9,68,64,85,108,83,188,24,86,131,110,114,100,26,96,178,114,193,247,
+15,219,247,34,224,188,30,55,161,190,251,35,227,27,196,187,154,164,190,31,
+183,7,123,103,119,138,119,27,107,106,182,192,113,31,115,190,119,205,129,169,
+191,247,6,209,215,186,157,197,91,24,191,154,161,172,171,26,14,252,31,249,
+209,28,5,39,109,10,189,28,6,158,109,10,123,62,10,69,248,58,39,29,123,62,10,
+251,170,248,58,46,29,123,250,228,250,15,163,29,174,174,144,147,170,31,98,
+251,120,5,45,120,105,108,96,27,251,58,247,28,5,124,132,41,117,55,26,78,194,
+73,246,247,84,238,198,247,42,167,30,213,248,11,5,247,64,10,14,123,250,17,
+248,91,21,242,251,114,7,214,247,45,230,240,203,165,248,43,29,206,29,162,135,
+218,251,78,176,251,4,25,251,131,36,247,131,6,65,251,63,41,251,2,63,92,247,
+89,29,227,213,164,180,217,31,248,58,10,109,208,114,222,121,196,8,14,123,249,
+130,251,34,21,55,75,53,251,20,95,84,248,118,10,198,27,247,162,198,247,99,
+247,9,247,12,76,247,48,251,78,247,221,31,206,247,87,235,234,211,168,248,43,
+29,211,88,188,65,251,64,251,26,251,104,251,51,66,30,247,80,47,35,247,75,67,
+27,113,251,85,77,127,102,31,84,7,247,71,116,169,114,238,251,70,214,251,22,
+25,64,251,87,251,18,251,46,248,25,29,247,81,247,64,247,150,247,50,201,30,
+247,61,251,206,191,251,8,36,26,14,123,250,228,250,15,21,206,29,167,135,247,
+3,251,168,157,57,25,64,251,87,251,1,251,17,248,25,29,246,211,205,217,200,
+30,196,208,189,227,180,217,171,251,29,215,251,121,247,21,126,8,102,107,80,
+73,117,202,29,156,168,198,151,164,30,200,147,197,161,196,170,8,115,10,14,
+248,165,62,10,248,143,248,58,55,29,14,250,198,62,10,248,143,248,58,55,29,
+248,172,28,4,230,55,29,14,247,63,28,5,39,250,111,21,251,105,6,252,70,252,
+168,104,247,199,5,247,52,120,86,229,251,31,27,251,66,251,48,85,251,27,84,
+186,71,221,31,247,29,247,107,5,238,170,113,251,87,161,31,184,252,15,253,0,
+253,141,5,247,105,6,248,72,248,168,172,251,199,5,251,52,157,194,51,247,32,
+27,247,66,247,45,190,247,27,195,92,206,57,31,251,29,251,107,5,41,108,166,
+247,86,116,31,94,248,15,5,14,251,165,249,112,247,24,152,29,251,165,250,96,
+28,5,97,152,29,247,91,61,10,14,247,91,61,10,14,247,91,61,10,47,248,69,39,
+29,247,91,61,10,251,192,248,69,46,29,247,91,28,4,111,249,47,21,242,251,232,
+7,248,58,248,115,147,150,159,157,160,141,25,247,15,147,5,145,10,247,104,252,
+115,5,251,214,36,247,221,6,252,120,252,178,247,24,10,248,165,225,7,248,5,
+10,251,130,248,178,5,14,247,91,28,5,109,247,166,10,247,244,29,136,136,118,
+125,122,248,143,29,159,157,159,160,140,25,247,25,147,5,248,46,10,247,5,131,
+153,137,153,135,150,114,25,247,137,252,189,252,146,252,207,247,110,10,247,
+93,252,128,5,173,57,157,80,66,26,73,96,41,251,37,77,82,248,118,10,218,27,
+247,138,246,247,58,247,34,211,105,242,103,223,31,251,135,248,209,248,87,248,
+148,147,150,159,158,160,140,25,14,247,91,28,5,109,247,166,10,145,10,247,137,
+252,189,247,3,10,213,7,247,117,221,251,23,251,183,82,31,243,6,240,248,144,
+247,18,29,14,249,222,61,10,249,108,147,63,29,14,28,5,205,61,10,249,108,147,
+63,29,249,154,149,63,29,14,60,36,29,14,252,72,249,192,28,5,50,21,168,7,251,
+2,172,5,101,6,251,95,252,83,113,247,23,115,247,3,116,212,25,220,112,113,190,
+81,27,115,251,3,104,132,115,31,109,7,247,12,130,152,137,175,251,19,167,251,
+8,25,166,251,10,164,251,13,142,119,49,251,43,92,74,83,134,62,210,24,86,137,
+100,106,102,26,108,166,89,237,247,19,246,247,23,247,22,221,30,224,247,25,
+204,247,44,177,218,163,190,203,233,160,158,8,14,60,36,29,247,103,248,201,
+61,29,60,36,29,251,41,247,174,42,10,60,36,29,137,247,174,44,29,60,36,29,113,
+248,162,80,10,60,36,29,217,248,205,35,10,60,36,29,138,248,125,68,29,60,36,
+29,138,248,125,68,29,60,36,29,148,248,103,39,29,60,36,29,251,91,248,103,46,
+29,60,36,29,251,238,247,174,74,10,60,36,29,251,30,248,215,37,10,60,36,29,
+253,21,28,249,253,66,29,60,250,197,247,222,10,251,9,251,171,5,251,183,6,123,
+197,5,247,221,29,149,137,158,80,162,56,25,251,116,37,247,143,6,152,87,152,
+83,151,85,238,29,146,156,149,159,150,160,8,247,72,241,251,13,6,172,191,171,
+185,155,154,8,252,147,251,107,21,247,116,6,251,44,252,1,114,247,29,115,247,
+16,116,243,25,14,123,28,5,51,28,4,129,21,194,88,205,53,251,80,32,47,251,193,
+251,13,30,139,251,2,251,181,251,28,251,218,30,99,247,111,102,247,77,104,247,
+13,8,242,10,247,28,10,209,247,9,247,213,249,156,139,26,247,103,231,180,178,
+182,27,247,48,39,5,186,171,186,191,198,26,14,60,121,29,182,251,89,178,251,
+105,145,106,95,61,24,157,91,88,148,86,27,251,78,251,20,37,251,54,55,190,43,
+247,33,245,247,5,240,247,56,247,4,31,174,110,174,102,176,90,223,195,24,98,
+200,95,188,90,176,155,166,156,166,155,168,247,17,247,116,245,247,143,197,
+247,23,247,243,10,254,19,28,251,73,21,98,101,166,194,140,31,141,222,208,211,
+247,3,136,182,138,177,134,174,128,8,251,77,251,6,94,107,78,27,14,60,121,29,
+173,251,47,169,251,50,153,62,36,252,161,24,248,49,10,217,248,32,239,247,82,
+216,247,87,188,247,1,25,247,243,10,14,60,228,129,21,247,170,6,54,252,72,5,
+248,49,10,199,247,199,5,247,206,239,251,183,6,237,247,78,214,247,82,187,246,
+176,225,237,247,48,172,170,241,202,24,186,7,251,62,195,5,80,6,251,204,253,
+126,99,247,111,102,247,77,104,247,13,25,242,10,171,251,41,168,251,43,154,
+60,8,251,186,6,14,60,250,224,28,5,92,21,192,98,223,251,42,251,68,251,45,251,
+154,251,119,251,1,30,139,251,27,251,128,251,46,252,6,30,104,53,39,251,48,
+108,108,35,76,24,92,7,247,64,83,5,196,6,247,210,249,110,5,139,210,252,24,
+176,251,12,30,251,28,178,182,53,225,27,178,247,64,197,151,174,31,190,7,251,
+76,154,120,141,82,247,105,98,247,84,25,96,247,89,100,247,95,135,171,8,247,
+175,247,19,198,247,29,199,27,247,10,251,9,5,221,141,199,195,200,26,14,203,
+28,4,152,247,56,21,194,89,207,60,30,248,96,29,251,93,250,91,5,247,49,104,
+100,231,251,31,247,230,10,237,151,108,251,82,180,31,196,251,150,247,96,29,
+31,14,203,249,124,28,5,81,21,247,39,7,251,98,251,72,5,247,7,106,93,205,251,
+9,247,230,10,230,156,111,251,51,174,31,251,112,251,85,5,251,39,7,247,139,
+247,109,177,251,61,247,96,29,194,89,207,60,31,248,96,29,251,82,250,36,5,14,
+251,2,146,10,14,251,2,146,10,122,28,4,230,39,29,91,250,166,198,21,213,7,115,
+64,94,124,96,27,98,92,151,207,151,31,247,45,249,193,5,251,80,6,49,252,117,
+98,120,96,125,100,133,25,192,247,162,5,251,6,6,83,251,164,72,151,104,184,
+155,219,25,217,248,46,247,106,10,84,251,187,5,251,39,110,247,19,61,247,1,
+157,155,141,158,27,100,251,82,5,247,7,6,182,247,109,184,151,184,156,174,157,
+25,79,251,193,5,73,127,190,55,247,19,27,239,246,187,175,206,31,14,251,2,175,
+10,126,82,178,67,236,123,25,102,108,75,67,117,108,172,82,104,26,104,71,247,
+254,29,156,164,194,151,165,30,233,146,234,180,202,173,8,14,251,2,248,18,219,
+21,58,252,35,5,236,6,194,247,169,247,80,178,217,142,8,247,57,219,6,251,2,
+147,114,141,122,166,148,188,25,247,48,249,201,236,29,81,251,187,248,131,29,
+14,249,140,28,7,61,198,21,213,7,115,61,94,124,96,27,100,92,151,207,151,31,
+247,46,249,193,5,251,82,6,68,252,2,5,103,76,94,134,98,27,92,116,154,215,154,
+31,207,247,233,5,57,6,252,29,77,64,247,121,251,22,247,97,39,247,17,25,247,
+47,29,248,29,247,25,248,19,247,136,235,123,235,113,233,31,247,131,121,94,
+251,118,5,251,21,119,222,95,228,27,213,215,164,184,219,31,62,252,52,248,47,
+10,254,221,248,173,203,10,247,104,41,29,14,89,250,230,250,33,21,217,252,44,
+59,7,247,1,133,5,153,141,139,127,129,31,251,193,251,255,251,19,247,253,5,
+145,137,143,147,153,27,247,3,145,5,219,252,70,61,7,237,131,5,149,148,137,
+127,143,31,247,70,252,122,75,251,187,248,116,10,248,74,219,7,39,145,115,141,
+139,147,141,145,25,206,247,202,248,44,248,109,5,145,145,155,149,154,27,14,
+247,104,41,29,251,197,247,140,42,10,247,104,41,29,251,50,247,140,44,29,247,
+104,41,29,61,248,171,35,10,247,104,41,29,251,49,248,91,68,29,247,104,41,29,
+251,247,248,69,46,29,247,104,41,29,251,186,248,181,37,10,247,104,41,29,253,
+106,28,249,219,66,29,247,173,28,5,192,247,215,29,251,10,251,51,5,252,31,6,
+89,247,51,247,138,29,195,251,61,5,251,58,36,247,92,6,247,31,252,56,247,89,
+10,247,202,248,38,5,247,103,242,251,24,6,247,23,247,61,248,134,10,253,96,
+251,195,21,247,178,6,251,92,251,162,5,14,247,104,248,16,10,135,133,120,247,
+65,29,247,90,252,240,5,251,242,6,119,35,5,248,33,6,59,252,42,247,138,10,219,
+248,42,5,247,248,6,160,243,5,251,208,6,248,101,248,240,248,134,10,14,247,
+104,28,5,176,247,215,29,251,255,252,136,251,45,248,169,5,94,247,52,251,95,
+114,139,26,45,251,83,71,251,72,84,180,82,197,178,192,163,182,186,31,84,247,
+35,5,139,161,191,211,151,164,124,127,143,30,247,101,253,105,57,252,58,133,
+115,120,126,113,137,25,251,9,129,5,53,248,168,225,7,251,6,149,102,247,203,
+29,227,248,76,248,125,249,54,149,152,162,155,159,141,25,14,247,51,28,4,245,
+28,4,242,21,247,5,159,156,227,5,252,44,6,122,51,247,2,125,158,137,150,118,
+124,119,25,252,30,252,216,251,91,248,222,134,155,144,160,171,143,25,242,149,
+156,227,5,252,112,6,122,51,247,3,115,247,181,253,200,114,101,5,159,85,87,
+151,87,27,251,102,251,9,251,14,251,18,115,31,251,18,115,197,44,247,25,27,
+247,28,238,242,247,86,247,33,31,169,121,171,117,175,113,202,230,24,107,163,
+107,161,106,159,8,252,44,251,166,21,68,114,185,211,152,31,210,153,203,203,
+247,8,27,182,183,133,122,185,31,251,56,251,7,75,73,74,27,14,247,220,65,29,
+14,247,220,65,29,221,248,175,61,29,247,220,65,29,39,248,156,78,29,247,220,
+65,29,251,22,248,99,68,29,247,220,65,29,251,12,248,77,39,29,247,115,96,29,
+247,115,99,10,44,248,71,39,29,247,145,249,43,247,93,21,206,247,234,210,162,
+209,169,192,168,25,248,68,10,5,51,248,148,227,7,247,54,10,247,15,147,5,248,
+2,10,87,113,68,112,71,122,25,218,248,37,5,251,12,6,56,252,55,5,138,6,251,
+19,88,247,49,29,247,54,70,247,29,27,164,168,142,145,170,31,78,251,202,5,14,
+247,115,28,5,127,247,167,29,252,148,51,6,237,131,163,137,152,120,135,117,
+25,44,252,115,5,96,51,251,20,94,50,27,251,22,100,184,247,21,164,31,214,248,
+29,143,161,162,158,166,141,25,247,2,147,5,227,252,148,51,7,247,1,131,163,
+137,151,121,135,116,25,56,252,66,5,251,126,91,247,44,70,247,31,27,247,7,247,
+61,202,199,247,5,31,43,252,122,135,116,116,121,112,137,25,251,0,131,5,51,
+200,7,247,117,219,251,21,251,183,82,31,243,6,240,248,144,251,5,147,115,141,
+126,158,143,161,25,247,107,250,220,143,162,162,157,166,141,25,247,13,147,
+5,14,247,115,127,10,35,252,144,5,243,6,195,247,176,247,143,247,22,215,145,
+8,247,21,227,6,247,54,10,14,247,137,28,5,161,28,5,10,21,223,252,188,51,7,
+171,135,177,134,139,26,163,137,144,113,130,125,251,41,251,129,251,26,251,
+82,251,21,251,53,75,158,121,188,157,236,224,248,59,24,143,161,162,158,163,
+141,247,5,147,24,248,60,10,46,252,96,105,251,69,217,57,238,109,25,251,67,
+251,88,251,61,251,41,251,75,251,33,55,252,56,24,248,123,10,248,93,247,68,
+10,254,247,28,251,104,21,228,218,247,15,247,10,247,37,247,63,247,5,145,247,
+55,198,243,196,42,252,126,24,247,103,250,184,21,51,252,74,64,101,251,0,100,
+51,130,25,247,3,247,36,247,13,247,65,247,19,247,99,8,14,249,7,28,4,128,22,
+177,90,7,92,77,165,160,126,31,124,163,131,183,227,26,247,50,7,248,44,155,
+247,70,247,18,247,208,26,247,85,7,247,70,174,206,247,17,30,164,49,7,251,78,
+70,92,251,208,252,14,46,47,251,200,126,31,249,23,7,220,149,189,154,162,30,
+172,166,179,155,192,27,188,175,252,217,103,188,6,186,189,120,107,164,31,161,
+115,139,104,46,26,253,23,7,251,199,153,47,231,248,13,26,247,208,70,186,251,
+78,30,49,114,6,247,17,174,72,251,70,31,251,85,7,251,207,247,69,251,18,248,
+43,122,30,251,50,7,55,131,88,123,120,30,104,112,102,125,83,27,90,101,6,14,
+247,8,249,83,22,219,7,64,145,5,121,141,130,149,152,26,140,145,172,247,66,
+5,247,191,247,5,242,247,121,183,31,166,247,33,5,239,158,170,167,231,27,151,
+208,5,73,6,251,28,43,94,251,111,97,31,251,148,91,112,69,251,99,27,231,248,
+133,142,154,153,153,160,141,25,231,147,5,219,252,58,59,7,228,131,5,157,137,
+149,128,126,26,134,7,46,252,133,5,251,37,100,174,247,0,31,217,175,247,26,
+218,26,247,19,62,168,251,2,30,73,6,126,70,5,211,167,122,84,31,68,95,251,12,
+251,4,26,251,47,234,68,247,140,30,106,251,66,136,124,124,124,118,138,25,33,
+133,5,59,7,14,252,141,249,89,28,5,80,21,40,186,109,69,5,133,124,129,137,133,
+84,71,201,61,27,251,9,70,38,63,109,161,98,191,175,170,170,149,145,31,68,217,
+5,161,153,174,153,161,27,174,182,121,121,176,31,247,9,161,252,89,252,121,
+231,92,172,196,5,149,151,156,141,147,204,205,88,217,27,225,245,211,239,176,
+113,180,89,115,106,120,111,123,31,210,63,5,123,125,123,114,100,27,100,82,
+170,151,100,31,251,3,112,5,14,251,78,50,29,249,51,28,4,242,35,29,251,78,50,
+29,249,68,250,107,44,29,251,78,50,29,248,127,28,4,144,46,29,251,78,50,29,
+248,48,251,217,68,29,251,78,50,29,247,88,252,74,66,29,251,78,250,173,251,
+205,21,188,67,170,139,30,251,103,251,15,5,90,122,149,178,31,240,248,160,247,
+254,10,249,75,249,193,90,10,247,1,216,51,247,1,27,184,186,154,163,184,31,
+125,78,96,251,101,78,26,251,15,247,35,110,242,233,247,13,168,247,19,30,14,
+252,141,249,177,248,233,21,169,92,157,139,30,251,29,65,5,107,128,145,163,
+31,205,247,206,63,122,5,139,107,99,100,103,97,168,151,102,30,251,3,112,248,
+87,248,124,226,10,150,151,155,140,145,210,189,86,210,27,168,170,148,153,168,
+31,130,103,111,251,18,103,26,65,232,122,206,200,218,156,215,30,14,251,78,
+164,29,186,154,163,184,31,88,251,146,5,47,120,105,106,98,27,251,58,247,28,
+5,122,132,53,117,55,26,75,168,76,247,13,247,86,244,198,247,42,168,30,231,
+248,113,247,254,10,5,14,251,78,249,113,248,91,21,242,251,45,7,247,234,248,
+36,229,29,251,130,251,170,5,251,131,36,247,43,6,252,5,252,68,248,123,29,239,
+238,51,247,17,247,52,10,247,157,247,202,5,14,251,78,250,46,250,82,248,172,
+29,251,10,251,30,251,16,87,173,68,217,197,184,192,155,151,31,251,3,247,21,
+5,166,172,192,143,248,119,10,251,114,251,150,5,151,113,112,147,104,27,251,
+39,49,39,251,9,81,31,247,1,6,194,159,199,176,174,27,165,158,137,133,157,31,
+252,13,252,78,248,123,29,239,238,51,247,17,27,247,25,247,66,232,247,57,201,
+96,206,63,104,88,109,92,112,31,247,5,251,17,5,106,108,109,133,248,113,29,
+247,114,247,153,5,122,169,168,131,178,248,39,29,251,1,6,82,117,83,102,103,
+27,108,114,143,147,119,31,14,251,78,200,29,190,235,5,153,155,158,139,161,
+27,166,167,131,133,162,31,90,251,5,110,251,12,123,40,8,227,6,159,244,166,
+239,180,237,8,119,192,211,120,192,27,247,7,247,41,244,247,54,247,0,63,180,
+94,251,37,32,51,251,11,62,31,251,34,100,5,248,128,234,21,49,82,106,67,30,
+92,137,85,153,92,157,8,228,195,210,202,232,27,173,162,114,105,31,14,252,141,
+249,94,28,5,80,21,226,10,147,149,152,139,153,27,157,157,134,136,154,31,107,
+71,120,67,129,80,8,196,6,152,202,156,199,166,197,8,127,173,186,128,174,27,
+213,236,202,236,204,90,164,110,44,70,86,67,89,31,47,116,5,247,211,196,21,
+85,102,119,92,30,109,138,104,147,108,150,8,193,176,185,176,199,27,161,154,
+124,119,31,14,251,78,164,29,199,161,163,184,31,144,120,142,120,121,26,47,
+72,41,74,73,30,224,6,241,221,247,9,247,44,247,35,26,183,128,183,113,182,30,
+251,9,110,5,97,110,91,114,107,27,84,74,188,159,83,31,251,64,94,5,14,251,78,
+250,46,250,82,21,90,10,239,238,51,247,17,27,153,153,141,141,153,31,96,91,
+90,78,124,202,29,153,172,215,157,179,30,230,187,215,232,247,6,26,199,96,206,
+65,102,88,110,90,112,30,247,209,29,5,14,251,78,200,29,194,200,5,247,26,247,
+20,252,113,247,126,27,226,229,200,233,176,122,176,103,150,31,251,49,251,8,
+58,199,251,1,247,193,48,221,25,86,187,73,138,139,26,14,251,202,247,12,252,
+134,21,247,141,247,8,247,145,247,51,247,92,26,224,89,227,251,76,83,100,134,
+132,106,30,248,91,248,159,5,232,7,82,43,58,121,71,27,251,16,101,225,237,247,
+68,247,27,241,224,31,247,22,251,62,5,186,204,179,210,151,31,222,153,64,211,
+251,57,27,251,129,251,95,251,95,251,126,251,0,183,251,44,247,121,146,146,
+139,140,147,31,252,45,252,101,5,251,1,7,173,246,221,150,222,27,247,15,165,
+91,81,34,251,3,48,251,84,251,2,31,14,251,67,250,103,250,113,21,253,140,6,
+86,251,142,5,247,19,6,186,247,27,5,156,143,145,145,158,27,247,248,6,253,121,
+253,199,120,61,5,249,195,6,201,247,179,5,251,21,6,88,251,62,5,124,134,131,
+133,121,27,252,54,6,249,125,249,195,5,14,195,67,10,251,0,248,165,35,29,195,
+67,10,48,247,138,44,29,195,67,10,251,180,248,67,46,29,195,67,10,252,79,28,
+250,74,68,29,195,67,10,253,39,28,249,217,66,29,195,250,108,249,68,21,241,
+251,81,7,248,41,248,128,158,231,5,247,35,29,252,26,252,114,5,251,159,37,247,
+76,6,252,124,252,234,247,137,10,248,111,248,215,5,14,195,247,128,247,1,21,
+250,88,28,4,149,158,231,5,247,35,29,254,85,28,251,102,121,49,5,250,28,6,146,
+126,142,120,117,26,44,89,34,68,67,30,214,6,247,34,247,15,225,247,6,247,24,
+26,163,136,162,133,158,30,14,195,247,128,247,1,21,250,88,28,4,149,158,231,
+5,247,35,29,254,85,28,251,102,121,49,5,248,253,6,247,106,133,245,251,22,83,
+251,176,8,244,6,240,248,165,5,14,172,28,4,176,28,5,2,21,158,231,5,248,8,10,
+153,152,164,27,248,117,6,254,85,28,251,102,120,49,5,247,0,6,247,94,247,123,
+252,82,247,162,27,235,213,248,30,10,64,251,181,248,71,146,251,6,31,14,53,
+248,82,32,21,247,145,244,247,65,247,6,166,247,43,8,227,154,85,224,251,85,
+27,47,64,120,118,79,31,248,181,248,212,155,231,5,57,251,121,46,108,251,41,
+27,251,26,102,234,237,156,31,247,11,160,217,189,195,27,184,184,125,91,161,
+31,141,251,3,5,247,8,6,177,247,112,5,171,54,60,154,52,27,251,42,251,81,45,
+251,81,106,31,251,52,110,217,251,24,247,124,27,203,200,146,149,194,31,252,
+209,252,239,121,39,5,222,247,57,247,106,212,247,19,27,247,9,172,101,88,130,
+31,127,73,51,51,251,20,80,8,14,195,198,29,251,18,92,10,251,18,92,10,252,102,
+249,171,28,5,61,21,54,197,97,84,5,137,120,120,134,121,51,59,194,48,27,40,
+56,54,48,101,167,105,182,167,169,159,160,152,31,72,217,5,158,152,168,156,
+166,191,185,112,188,27,185,245,143,139,31,252,14,251,204,212,83,189,199,5,
+228,134,228,62,52,26,251,6,251,1,251,9,251,20,103,111,146,170,118,30,107,
+247,19,5,144,123,115,148,123,27,88,103,98,90,44,247,12,81,247,17,247,72,247,
+93,247,3,247,76,247,32,251,0,214,251,30,145,31,14,251,18,93,10,248,210,250,
+208,48,10,251,18,122,29,99,69,59,124,31,59,252,50,5,135,117,135,120,121,26,
+251,11,211,80,247,43,247,13,244,206,201,151,30,155,231,68,159,126,148,251,
+84,251,36,24,67,102,172,227,158,31,192,247,160,5,74,209,247,6,104,247,9,27,
+247,212,10,251,18,168,10,40,98,47,67,71,30,247,5,68,36,233,251,58,27,251,
+10,251,56,82,251,19,251,37,219,251,3,247,162,219,211,151,197,233,31,153,108,
+149,110,148,113,233,190,24,126,163,129,166,127,168,8,247,41,227,236,247,0,
+247,73,26,247,125,251,58,247,17,251,105,149,30,122,253,88,21,98,86,86,112,
+82,27,57,251,30,182,239,197,209,180,196,246,227,59,45,200,31,14,251,18,213,
+10,252,85,252,39,186,98,5,139,199,188,208,211,240,86,75,30,251,109,252,220,
+168,251,224,26,251,50,247,58,41,247,19,247,107,247,62,247,42,227,194,112,
+184,84,96,94,116,115,118,30,251,29,7,100,115,36,116,72,27,71,63,205,202,31,
+247,156,248,234,70,248,21,26,247,78,251,88,127,98,30,14,99,250,181,249,177,
+21,247,23,40,223,251,40,30,251,1,251,80,47,62,27,111,114,147,143,110,31,110,
+231,251,61,41,248,9,252,171,5,251,146,251,187,251,88,251,185,251,107,247,
+113,251,48,247,119,247,88,247,185,239,247,93,191,105,192,62,114,98,124,131,
+111,31,80,251,95,5,88,88,38,117,83,27,251,43,251,1,247,38,247,32,247,99,247,
+106,247,51,247,84,154,31,177,39,247,22,230,252,11,248,159,5,139,247,42,131,
+209,30,214,229,184,219,27,180,194,112,107,147,31,251,28,251,10,5,104,145,
+173,106,201,27,229,187,237,227,31,14,116,250,198,249,198,21,247,8,33,217,
+251,155,30,252,108,252,66,247,187,251,169,5,251,122,251,136,251,91,251,122,
+251,125,247,88,251,4,247,139,247,37,247,91,200,247,31,183,112,190,78,109,
+113,128,128,121,31,76,251,46,5,127,99,91,136,94,27,251,2,251,3,247,8,247,
+49,247,76,247,69,247,32,247,143,31,219,229,251,213,247,191,247,196,247,167,
+5,186,203,134,99,172,31,78,251,39,5,123,158,171,130,166,27,200,238,187,230,
+31,14,251,195,249,147,249,144,21,247,63,251,25,216,251,40,42,40,126,78,251,
+33,30,94,251,115,5,230,6,186,247,11,143,153,158,151,149,147,25,160,163,199,
+172,214,27,210,207,91,251,23,251,38,251,34,251,40,251,164,251,16,31,117,33,
+211,165,211,169,209,172,25,201,130,202,89,251,16,26,251,53,251,107,251,78,
+251,212,251,33,30,117,33,5,247,254,247,23,248,24,247,124,247,144,26,247,27,
+65,215,36,168,30,247,51,239,247,8,247,19,247,43,26,14,252,193,251,219,251,
+90,21,247,229,203,248,34,247,77,247,160,26,230,80,208,251,7,170,30,247,23,
+219,234,243,247,25,26,247,19,251,9,199,251,37,137,30,40,138,251,3,108,45,
+80,123,50,24,225,187,226,175,207,140,8,222,140,194,102,59,26,251,49,251,40,
+251,20,251,197,38,30,125,56,233,165,243,172,235,181,25,214,128,186,103,59,
+26,251,84,251,103,251,45,251,201,58,30,14,216,125,10,14,193,250,191,248,47,
+21,247,168,192,251,33,247,29,251,174,27,248,100,248,39,167,247,39,5,254,21,
+6,53,252,86,5,247,7,6,199,247,92,5,162,145,168,172,161,27,248,147,6,252,120,
+252,51,189,67,5,150,153,186,157,181,27,247,28,247,24,90,251,152,89,31,251,
+101,99,251,54,251,14,251,80,27,46,64,164,185,88,31,142,247,134,5,153,124,
+102,146,118,27,47,79,57,67,125,31,251,19,115,247,7,251,60,247,203,27,247,
+207,247,191,247,20,247,208,199,31,14,251,65,250,48,250,9,21,241,253,141,7,
+72,251,206,5,239,6,195,247,41,5,155,144,162,148,150,27,248,80,6,252,150,252,
+95,186,78,5,152,159,161,149,175,27,227,247,73,74,251,52,251,102,251,55,251,
+45,251,85,81,95,152,169,95,31,117,247,56,5,152,125,88,139,128,27,55,87,69,
+74,73,229,251,10,247,147,247,217,247,160,247,95,247,155,247,72,251,100,247,
+14,251,78,31,14,216,125,10,248,243,28,4,251,48,10,247,0,28,4,247,247,167,
+29,254,80,6,111,251,39,247,251,252,249,5,251,207,251,223,251,130,251,231,
+251,161,247,121,251,129,247,193,247,203,247,137,247,62,247,32,239,87,178,
+49,101,110,133,115,103,31,84,251,110,5,95,86,251,2,119,66,27,251,83,251,17,
+247,96,247,84,247,208,247,186,247,24,247,58,191,161,121,128,149,31,214,211,
+252,8,249,5,5,248,207,6,158,155,113,117,31,122,251,86,5,247,7,6,14,134,250,
+239,28,4,166,21,247,50,169,251,83,198,251,109,27,252,169,252,74,247,231,251,
+129,5,251,137,251,100,251,34,251,109,98,31,251,169,86,247,104,251,20,247,
+187,27,247,119,247,89,247,5,247,4,160,31,155,220,92,186,66,141,251,53,251,
+112,24,120,94,66,127,91,27,251,63,251,5,247,22,247,85,176,31,247,74,174,247,
+88,211,247,106,27,237,247,3,251,224,247,150,247,221,247,175,5,182,175,121,
+115,171,31,101,251,87,5,139,182,129,168,203,222,208,206,152,30,14,101,250,
+175,250,189,21,247,142,251,70,231,251,86,251,23,251,24,123,53,251,80,30,80,
+251,177,248,162,29,216,247,77,5,203,198,236,173,229,27,247,4,247,1,81,251,
+68,251,127,251,201,251,59,251,150,58,31,116,251,13,247,3,173,243,175,232,
+178,25,236,125,213,58,251,27,26,251,148,252,30,251,92,251,236,43,30,116,251,
+13,5,248,81,235,248,176,247,156,247,200,26,247,69,46,241,251,18,180,30,247,
+94,247,4,247,13,247,24,247,54,26,14,80,247,91,250,226,21,234,247,30,247,40,
+193,247,3,27,244,211,90,32,251,122,251,81,251,61,252,75,251,51,31,121,36,
+247,15,178,247,24,186,247,15,197,25,247,2,123,222,86,251,19,26,251,163,251,
+228,251,124,252,62,251,4,30,123,44,5,248,104,229,248,165,247,159,248,29,26,
+247,23,64,228,251,51,173,30,247,67,247,5,247,19,247,40,247,93,26,247,60,251,
+24,216,251,61,251,40,251,67,80,251,1,251,31,30,14,251,90,247,206,10,94,164,
+100,247,83,10,36,252,148,247,139,10,237,248,130,248,80,29,252,153,249,87,
+28,5,166,21,247,0,46,213,251,35,53,251,74,92,35,110,153,116,182,178,176,158,
+139,30,184,245,5,156,166,167,145,166,27,202,184,88,53,251,17,251,21,32,251,
+10,104,31,73,251,199,137,129,119,127,126,137,25,66,132,5,92,247,217,186,7,
+70,146,126,141,125,151,141,149,25,202,247,187,5,247,21,190,247,26,234,247,
+35,26,14,251,196,249,144,249,158,21,247,34,37,231,251,110,37,251,109,81,251,
+25,88,186,100,192,141,166,141,139,30,239,247,68,5,154,162,172,141,157,27,
+231,186,83,45,251,72,251,21,35,251,58,100,31,74,251,226,5,116,135,116,129,
+125,27,251,15,133,5,59,248,144,219,7,251,19,145,5,125,120,149,162,143,31,
+201,247,199,5,247,68,198,247,23,232,247,92,26,14,251,24,250,113,250,220,21,
+247,76,251,45,247,19,251,107,251,26,251,176,69,251,70,86,161,82,207,188,205,
+169,139,30,208,247,81,5,165,182,182,150,180,27,235,141,215,63,137,251,25,
+137,251,122,251,86,251,27,251,93,76,32,252,169,24,137,121,107,118,120,137,
+251,15,131,24,51,248,185,227,7,251,21,147,123,141,116,160,141,157,25,240,
+248,136,5,247,100,227,247,95,247,1,247,154,26,14,251,90,247,206,10,92,164,
+102,247,83,10,108,251,43,5,251,169,34,247,148,6,88,251,148,247,139,10,190,
+247,148,5,247,164,244,251,144,6,166,247,25,248,80,29,251,90,247,121,29,51,
+252,79,247,158,10,246,248,153,247,98,29,252,137,166,10,252,147,166,10,251,
+90,247,121,29,121,43,5,251,161,34,247,138,6,92,251,134,247,158,10,189,247,
+134,5,247,176,244,251,156,6,176,247,62,247,98,29,251,90,249,211,248,33,21,
+247,165,251,25,196,251,31,207,30,227,248,70,247,161,29,36,252,144,247,41,
+10,31,14,251,90,249,226,250,15,21,243,251,138,7,186,247,126,247,161,29,92,
+251,126,5,251,175,35,247,154,6,104,251,62,247,41,10,247,165,251,25,196,251,
+31,207,31,160,235,5,14,251,169,249,237,250,236,21,247,74,251,15,247,5,251,
+134,251,164,50,251,20,74,71,185,95,208,30,199,6,247,15,247,95,5,247,25,241,
+65,251,31,251,11,251,59,116,83,85,31,62,65,151,251,54,59,90,8,251,36,52,251,
+1,35,251,42,26,251,74,247,5,251,5,247,134,247,162,225,247,16,203,210,98,186,
+70,30,79,6,251,17,251,93,5,251,23,45,211,247,33,247,7,247,52,188,215,193,
+31,209,189,126,247,57,210,179,8,223,187,247,67,232,247,97,26,14,247,110,249,
+52,250,71,21,251,39,251,133,251,69,251,29,34,247,32,251,65,247,61,251,31,
+31,50,251,12,251,11,78,104,43,189,247,69,32,27,61,96,99,78,47,231,66,244,
+231,247,55,221,247,3,247,47,31,251,4,247,41,247,52,56,235,27,247,40,200,247,
+4,199,195,110,179,59,31,251,16,212,251,39,38,27,98,40,208,228,36,31,247,57,
+247,28,247,26,247,30,244,26,247,29,251,134,247,69,251,39,30,14,251,90,248,
+97,28,5,65,21,38,251,58,38,61,79,236,40,247,8,60,31,88,56,58,104,115,73,173,
+240,66,27,85,110,116,104,87,202,97,211,202,247,4,186,202,245,31,75,241,247,
+2,92,205,27,241,180,203,173,171,119,162,84,31,54,189,55,70,27,111,71,178,
+190,69,31,247,5,217,230,218,199,26,217,251,57,240,38,30,14,249,33,28,6,119,
+243,21,251,2,48,180,204,76,31,182,225,163,239,226,26,247,21,78,184,71,75,
+75,90,251,17,46,154,35,184,54,30,96,94,85,113,78,27,72,79,167,187,97,31,183,
+223,167,239,230,26,247,21,76,184,75,71,74,84,251,11,46,155,35,174,54,30,96,
+94,86,113,89,27,76,81,173,191,93,31,187,223,163,237,222,26,247,4,84,201,66,
+66,80,80,251,14,55,159,41,178,53,30,78,76,52,96,33,27,153,251,2,5,247,17,
+236,190,211,211,31,65,194,213,88,234,27,228,217,182,205,200,31,73,192,215,
+96,244,27,233,219,186,211,201,31,67,205,239,92,247,36,27,251,171,248,86,21,
+89,129,91,122,99,30,119,182,130,186,187,26,223,154,158,153,153,152,120,55,
+30,252,90,138,21,90,128,94,119,98,30,125,180,130,184,188,26,217,148,165,157,
+158,147,111,63,30,252,90,133,21,98,130,96,121,98,30,121,178,130,182,182,26,
+210,152,178,156,156,146,103,65,30,14,67,248,80,247,25,21,248,152,251,25,253,
+29,248,133,7,247,11,187,186,247,11,31,249,129,251,25,253,102,7,99,119,119,
+99,30,251,98,247,10,21,247,25,6,138,248,133,5,247,11,93,187,251,11,30,252,
+134,254,39,247,25,249,162,247,230,6,179,159,119,99,31,14,247,221,250,94,247,
+75,21,101,51,84,118,64,27,251,133,39,247,53,247,119,138,31,172,213,201,165,
+142,146,212,251,77,145,27,145,247,190,247,36,139,31,217,251,36,5,247,116,
+228,247,63,247,102,247,117,26,247,54,251,25,247,6,251,123,149,30,251,102,
+147,251,58,141,251,24,142,8,149,188,145,187,182,26,247,23,54,172,42,251,45,
+251,4,251,12,251,40,251,8,209,78,247,81,114,30,108,251,3,102,251,9,118,251,
+15,129,87,132,88,133,88,251,55,61,24,175,65,247,12,193,5,99,7,251,138,244,
+251,83,247,177,247,58,247,38,241,230,167,30,252,178,249,11,21,153,215,162,
+224,162,223,8,137,181,184,139,189,27,248,160,247,15,85,251,35,60,71,251,52,
+75,125,84,247,8,139,31,251,173,251,33,5,113,177,69,247,43,136,26,138,137,
+251,33,71,251,39,68,143,194,147,197,150,199,8,251,88,248,165,21,184,174,194,
+197,189,175,112,87,99,134,98,132,97,30,251,16,150,96,172,197,26,14,249,130,
+152,22,247,94,6,247,23,249,125,247,203,248,130,248,0,168,251,134,28,251,128,
+24,247,91,247,7,247,69,250,152,5,247,136,83,247,15,251,164,252,54,26,251,
+45,123,251,64,106,251,80,30,247,93,6,169,247,61,153,247,47,247,33,26,248,
+170,251,96,247,217,251,232,183,30,168,247,62,251,27,93,113,251,12,252,94,
+105,252,61,252,147,251,38,253,207,25,14,251,250,248,230,247,13,21,247,50,
+55,247,12,251,56,251,168,251,36,251,209,251,150,251,70,233,38,247,46,247,
+142,247,62,247,181,247,179,30,251,29,159,21,251,119,251,1,251,187,251,50,
+84,67,164,247,51,247,118,244,247,189,247,58,213,188,83,251,21,30,14,251,250,
+249,209,28,5,63,209,10,251,250,248,68,248,33,21,96,6,251,197,59,5,76,7,247,
+89,159,251,15,252,240,5,117,135,124,126,113,27,251,5,133,5,70,248,35,206,
+7,49,147,117,142,128,149,146,161,25,14,251,250,248,226,247,103,21,247,31,
+251,9,188,251,17,251,54,251,47,41,41,88,192,130,155,182,168,164,139,30,166,
+247,17,5,145,151,182,159,194,27,223,190,103,55,251,64,251,70,251,19,252,15,
+251,142,31,121,49,5,249,0,6,182,247,107,5,64,6,96,36,5,251,249,6,247,58,247,
+1,248,3,247,95,247,119,26,14,181,250,181,250,214,21,247,119,251,66,221,251,
+87,251,144,251,127,251,58,251,52,57,212,129,166,205,178,174,141,143,30,178,
+247,105,5,147,155,213,178,227,27,247,23,223,75,251,39,251,39,67,251,19,251,
+35,251,36,31,252,195,6,116,251,6,5,248,91,6,251,25,251,5,251,66,251,17,251,
+110,251,48,113,251,33,24,250,76,6,205,247,242,5,251,1,6,72,251,64,5,252,208,
+6,247,64,247,15,247,62,247,7,247,33,247,11,8,247,200,6,159,247,6,5,251,93,
+6,247,30,247,29,229,247,36,247,52,26,14,249,83,28,6,127,124,10,251,14,249,
+144,248,50,29,248,54,28,4,145,209,10,251,250,248,218,247,113,21,247,11,44,
+198,251,31,251,37,251,62,68,32,92,182,123,161,166,182,155,139,30,157,247,
+9,5,147,150,184,166,202,27,199,212,106,51,34,37,57,251,64,150,31,127,53,5,
+139,182,145,186,198,227,120,35,251,7,39,47,251,27,89,101,162,145,126,30,121,
+241,5,139,112,149,111,73,127,88,115,77,210,61,247,58,247,105,247,70,247,28,
+247,53,238,66,186,53,153,30,247,29,182,213,225,229,26,14,251,250,248,226,
+251,5,21,251,38,6,244,248,140,5,49,6,252,189,252,144,120,47,5,248,54,6,84,
+251,168,5,247,9,6,196,247,168,5,247,37,6,251,66,248,72,21,70,251,232,5,251,
+183,6,14,251,250,249,205,250,236,21,251,35,6,241,248,140,5,49,6,252,187,252,
+144,121,47,5,248,54,6,81,251,171,5,247,11,6,197,247,171,5,247,37,6,251,66,
+248,70,21,69,251,230,5,251,185,6,14,221,151,10,14,221,151,10,250,145,251,
+78,247,50,29,221,150,10,14,221,150,10,250,135,251,80,247,50,29,251,250,248,
+230,248,21,21,252,109,6,49,252,46,5,139,233,148,184,247,13,237,104,251,5,
+251,4,39,32,251,31,108,108,147,147,112,30,105,244,5,139,116,145,125,90,102,
+100,94,61,231,100,247,17,247,105,247,80,247,34,247,74,247,48,251,29,186,33,
+77,90,126,133,116,30,189,247,115,5,248,12,6,14,251,250,249,209,28,6,72,21,
+252,107,6,49,252,46,5,139,233,149,185,247,12,238,105,251,5,251,5,36,33,251,
+31,108,111,147,147,112,30,104,242,5,139,117,145,124,90,102,102,94,61,229,
+100,247,17,247,105,247,83,247,33,247,75,247,47,251,29,184,32,78,90,129,133,
+116,30,186,247,115,5,248,15,6,14,158,248,144,28,4,201,21,155,142,158,166,
+168,27,248,80,6,157,150,121,118,138,31,129,251,66,5,247,3,6,200,247,211,5,
+254,113,6,122,41,243,131,167,135,148,116,136,123,25,51,252,87,5,247,221,247,
+134,251,5,251,118,251,79,251,74,251,70,251,74,63,59,166,170,113,31,107,247,
+79,5,141,132,106,147,117,27,66,73,90,72,251,23,247,29,251,3,247,100,248,6,
+247,170,247,86,247,215,247,219,251,221,247,22,251,133,31,14,251,156,248,47,
+249,232,21,151,142,153,158,157,27,247,157,6,152,145,126,124,138,31,132,32,
+5,223,6,187,247,131,5,253,93,6,122,41,229,133,157,136,145,123,136,127,25,
+77,251,188,5,247,118,247,52,251,2,251,24,251,66,251,36,67,37,108,86,155,161,
+121,31,114,247,65,5,141,134,106,146,124,27,89,70,82,73,251,10,247,13,68,247,
+37,247,118,247,139,247,25,247,132,247,97,251,89,247,8,251,73,155,31,14,251,
+250,248,193,33,82,29,251,250,249,175,250,242,21,247,36,34,220,251,23,61,68,
+115,100,79,30,180,247,42,247,50,247,25,247,123,161,135,219,24,251,254,106,
+251,136,251,166,251,193,26,251,126,247,52,84,247,2,247,83,247,56,247,48,247,
+86,30,251,28,106,21,251,23,45,251,2,251,8,251,17,118,247,11,218,195,160,219,
+143,155,30,184,204,192,153,197,27,247,6,180,72,38,31,14,71,248,56,114,21,
+247,148,247,111,247,87,247,191,200,31,182,247,104,251,15,247,114,251,102,
+189,127,115,110,64,128,125,247,35,89,166,251,68,104,251,64,8,251,96,97,251,
+4,251,62,251,39,27,251,54,87,247,146,247,157,193,31,198,247,180,247,31,247,
+250,248,33,247,61,143,246,24,252,47,251,8,251,201,252,29,63,252,8,52,252,
+64,247,65,251,122,247,135,144,8,14,197,248,149,217,21,251,76,74,247,126,247,
+117,182,31,194,247,180,247,32,247,198,248,54,247,61,141,246,24,252,70,251,
+8,251,221,251,233,68,252,8,8,252,24,65,247,102,251,107,247,152,27,247,192,
+247,115,247,97,247,161,190,31,179,247,104,251,9,247,80,251,139,203,125,115,
+111,64,127,125,247,56,78,157,251,37,106,251,64,8,251,66,106,33,251,62,251,
+69,27,14,251,250,249,46,248,21,21,252,253,6,92,251,111,5,219,6,182,247,0,
+5,248,13,6,252,218,253,139,5,247,25,6,145,169,248,230,249,159,5,14,251,250,
+250,27,28,6,72,21,252,252,6,92,251,109,5,216,6,182,247,0,5,248,15,6,252,217,
+253,142,5,247,25,6,145,170,248,230,249,158,5,14,251,250,248,214,247,115,21,
+244,53,212,251,42,251,78,251,21,251,10,251,34,88,157,80,217,98,30,251,46,
+73,84,35,59,26,251,19,247,1,65,247,57,247,85,247,58,247,9,247,50,241,45,192,
+81,164,30,231,180,230,196,247,23,26,251,11,129,21,53,83,73,58,101,30,32,179,
+78,182,201,26,225,210,215,246,225,180,90,71,30,92,252,68,21,59,59,55,251,
+13,251,9,86,205,216,227,200,203,225,180,30,247,7,92,247,1,86,67,26,14,251,
+250,249,185,28,5,168,21,243,53,211,251,42,251,78,251,21,251,9,251,33,88,157,
+79,217,98,30,251,45,74,83,34,60,26,251,19,247,1,65,247,58,247,84,247,56,247,
+9,247,49,242,47,192,82,164,30,231,180,229,196,247,23,26,251,13,127,21,53,
+86,75,57,100,30,32,180,78,182,201,26,225,209,214,245,225,180,88,72,30,94,
+252,68,21,59,59,55,251,13,251,8,85,204,217,227,201,205,225,180,30,247,6,91,
+247,1,84,68,26,14,251,250,248,240,247,31,21,247,128,251,74,163,59,251,95,
+251,62,251,45,251,87,251,58,247,29,84,238,208,219,168,161,186,30,251,10,251,
+74,251,40,63,251,82,72,167,73,24,247,167,219,247,248,247,97,248,0,26,251,
+25,22,100,121,45,135,121,30,126,124,61,78,47,27,61,62,188,247,5,247,23,229,
+247,13,247,12,211,219,102,251,44,31,14,251,250,249,211,28,5,84,165,29,174,
+249,94,28,5,24,21,247,93,179,251,126,251,117,96,31,76,251,219,251,55,251,
+159,252,54,251,61,138,32,24,248,70,247,8,247,242,247,194,218,248,47,8,248,
+24,213,251,65,247,107,251,179,27,251,201,251,126,251,127,251,161,88,31,88,
+251,160,247,64,251,131,248,3,247,37,152,163,168,214,149,153,251,210,58,114,
+247,77,172,247,64,8,247,66,172,247,0,247,92,247,85,27,14,251,42,248,254,250,
+136,21,251,146,251,132,251,117,251,191,78,31,82,251,172,247,21,251,116,247,
+240,247,21,152,163,168,214,150,153,251,139,78,71,247,42,179,247,92,8,247,
+96,181,245,247,92,247,73,27,247,81,172,251,116,251,157,85,31,80,251,180,251,
+37,251,227,252,33,251,61,136,32,24,248,46,247,8,247,196,248,6,215,248,8,8,
+248,64,226,251,34,247,87,251,163,27,14,252,104,248,96,28,5,112,21,251,57,
+251,48,251,27,251,71,99,31,102,251,60,223,251,27,247,118,217,147,153,158,
+184,146,148,251,52,102,95,229,165,247,12,8,247,14,166,208,247,12,247,9,27,
+247,15,161,251,26,251,51,104,31,100,251,65,45,251,93,251,150,38,137,75,24,
+247,159,208,247,89,247,114,189,247,115,8,247,149,195,47,247,9,251,68,27,14,
+249,83,28,6,4,247,27,29,247,113,83,29,14,249,186,28,5,30,28,5,150,21,251,
+32,6,254,244,28,250,106,5,247,32,6,247,198,83,29,28,5,226,251,49,21,247,50,
+48,247,23,251,56,251,169,251,25,251,199,251,150,251,71,243,251,2,247,46,247,
+142,247,49,247,171,247,178,30,251,29,162,21,251,119,41,251,177,251,50,84,
+57,171,247,52,247,117,233,247,181,247,58,213,198,74,251,21,30,252,173,247,
+155,247,42,29,14,249,83,28,6,4,247,27,29,247,113,83,29,28,4,248,247,8,73,
+10,249,83,28,6,4,247,27,29,247,113,83,29,28,4,147,252,10,82,29,249,83,28,
+5,170,247,27,29,247,164,83,29,28,5,37,247,21,247,88,10,14,249,83,28,6,0,247,
+27,29,247,117,83,29,28,4,215,251,19,165,29,249,83,28,6,35,28,5,150,139,29,
+250,68,252,71,73,10,249,83,28,6,48,247,27,29,248,26,74,29,250,34,252,77,73,
+10,249,83,28,6,4,247,27,29,248,0,250,52,247,78,29,251,66,248,72,21,67,251,
+234,5,251,189,6,28,6,7,36,73,10,249,83,28,6,4,247,27,29,248,64,178,10,249,
+213,254,112,82,29,252,201,248,164,229,10,253,28,248,146,28,6,25,21,181,118,
+160,94,65,115,101,77,130,30,72,252,167,5,223,6,162,226,247,25,248,117,139,
+26,251,26,253,96,21,183,98,169,92,91,102,108,96,93,186,114,177,192,174,171,
+178,30,14,253,28,247,123,217,247,33,10,253,28,248,107,28,5,43,247,33,10,194,
+250,192,236,10,251,145,28,4,170,246,10,14,252,186,249,1,28,6,122,21,211,80,
+171,75,59,74,94,251,9,131,30,81,253,168,5,227,6,247,130,249,166,5,143,164,
+143,155,158,26,14,252,186,248,189,28,5,78,21,211,90,171,75,59,84,94,251,9,
+131,30,90,253,68,5,227,6,247,101,249,66,5,143,164,143,155,158,26,14,252,160,
+248,197,28,5,100,247,40,29,252,232,248,67,249,124,247,84,29,49,252,137,247,
+212,29,252,213,247,16,10,252,106,28,4,227,247,49,10,253,37,248,136,28,5,76,
+153,29,253,37,248,136,28,5,76,153,29,251,46,28,6,20,153,29,252,213,247,17,
+29,251,127,250,44,28,5,74,21,196,100,180,73,251,35,73,251,27,251,19,251,50,
+247,11,251,2,178,98,30,219,155,5,100,198,61,225,247,3,26,180,147,155,145,
+174,30,247,21,6,168,166,160,180,180,26,252,56,141,153,29,251,53,154,29,253,
+76,248,97,250,109,21,251,234,6,170,251,230,5,247,41,6,108,253,27,21,109,247,
+230,5,251,40,6,251,56,251,230,5,14,253,80,248,93,250,109,21,251,234,6,169,
+251,230,5,247,42,6,14,253,92,207,10,253,92,207,10,253,92,207,10,252,176,248,
+132,248,138,247,39,10,252,176,249,116,28,6,171,247,39,10,252,177,247,229,
+247,57,247,30,10,252,177,248,213,28,5,90,247,30,10,251,87,249,207,252,42,
+21,218,251,183,28,6,102,247,183,216,253,41,28,248,254,7,247,12,28,6,181,21,
+247,22,28,249,154,251,22,6,14,251,87,249,117,252,44,21,28,7,4,253,40,62,247,
+182,28,249,154,251,182,58,7,248,176,28,6,183,21,28,249,154,251,22,28,6,102,
+7,14,251,189,247,92,28,5,120,21,254,224,226,250,137,247,205,226,7,14,252,
+102,248,18,10,251,189,247,92,28,5,120,21,52,247,205,254,137,226,250,224,7,
+14,252,102,248,19,29,251,189,248,236,251,114,21,226,251,205,28,4,213,52,28,
+250,212,7,14,252,102,248,19,10,251,189,248,236,251,114,21,28,5,44,52,28,251,
+43,251,205,52,7,14,252,102,248,20,29,251,89,248,16,239,21,248,236,159,249,
+60,248,56,248,136,30,69,209,5,252,117,252,92,70,252,230,253,130,26,254,224,
+247,72,7,14,251,89,248,16,247,164,29,251,89,248,16,28,9,196,21,251,72,28,
+251,80,6,253,130,208,252,230,248,117,252,92,30,209,209,5,252,56,248,136,119,
+249,60,248,236,26,14,251,89,248,156,254,74,21,247,72,250,224,6,249,130,70,
+248,230,252,117,248,92,30,69,69,5,248,56,252,136,159,253,60,252,236,26,14,
+251,89,249,80,247,164,29,251,89,248,156,28,5,70,21,252,236,119,253,60,252,
+56,252,136,30,209,69,5,248,117,248,92,208,248,230,249,130,26,28,4,176,251,
+72,7,14,251,89,248,16,254,74,21,28,10,180,247,212,247,2,252,136,28,244,222,
+7,14,251,89,248,16,247,164,29,251,89,249,80,252,86,21,247,2,251,212,28,11,
+24,251,72,28,244,122,7,14,251,89,249,80,254,74,21,28,11,34,252,136,251,2,
+247,212,28,245,76,7,14,251,89,249,80,247,164,29,251,89,249,80,252,86,21,28,
+11,134,251,72,28,244,232,251,212,251,2,7,14,242,249,70,249,110,21,249,130,
+189,247,192,247,222,30,219,247,12,49,6,252,126,79,252,36,253,130,31,28,249,
+92,247,72,7,14,242,248,146,28,7,38,21,253,130,99,251,192,251,222,30,49,251,
+12,229,6,247,222,179,251,192,253,130,31,252,196,247,72,248,206,7,248,219,
+102,248,14,251,139,247,31,30,247,139,247,31,176,248,13,248,220,26,249,160,
+251,72,7,14,242,249,70,247,164,29,242,249,70,28,9,196,21,251,72,28,248,248,
+6,253,130,199,252,36,248,126,30,229,247,12,59,6,251,222,89,247,192,249,130,
+31,14,242,248,146,254,74,21,247,72,28,6,164,6,249,130,79,248,36,252,126,30,
+49,251,12,219,6,247,222,189,251,192,253,130,31,14,242,249,70,28,10,40,21,
+251,72,253,160,6,252,220,175,252,13,247,139,251,31,30,251,139,251,31,103,
+252,14,252,219,26,252,206,247,72,248,196,7,249,130,179,247,192,247,222,30,
+229,247,12,49,6,251,222,99,247,192,249,130,31,14,242,248,146,249,100,21,253,
+130,89,251,192,251,222,30,59,251,12,229,6,248,126,199,248,36,249,130,31,28,
+7,8,251,72,7,14,253,24,244,247,237,10,14,252,20,248,1,247,237,10,251,37,22,
+248,35,10,14,251,96,239,248,255,21,249,133,243,253,133,6,79,252,16,21,249,
+133,243,253,133,6,247,157,254,11,248,11,29,14,97,247,125,29,97,247,125,29,
+97,191,247,50,21,221,57,247,29,247,29,5,253,121,247,16,249,245,7,247,156,
+247,156,5,254,253,247,17,28,4,230,7,247,110,247,111,57,221,251,28,251,28,
+5,249,119,251,17,253,244,7,251,156,251,157,5,250,253,251,16,28,251,27,7,14,
+250,75,28,4,139,249,254,21,215,76,201,63,63,78,77,63,64,200,77,215,215,202,
+201,214,30,251,241,252,237,247,229,10,249,74,22,248,1,10,14,250,75,250,7,
+247,165,21,63,202,77,215,215,200,201,215,214,78,201,63,63,76,77,64,30,247,
+241,248,237,21,247,252,29,253,74,22,247,252,29,14,250,75,248,114,247,44,21,
+221,57,247,105,247,105,5,249,245,247,19,253,118,6,247,36,247,35,5,248,230,
+247,19,252,103,6,247,35,247,35,5,247,216,247,19,251,89,6,247,25,247,24,57,
+221,251,107,251,106,5,253,247,251,19,249,120,6,251,35,251,35,5,252,233,251,
+19,248,106,6,251,36,251,35,5,251,218,251,19,247,91,6,14,250,75,28,6,82,22,
+247,12,29,250,75,248,97,10,28,4,164,247,162,21,247,12,29,250,75,249,8,251,
+4,21,237,83,245,247,80,5,126,189,194,132,199,27,249,1,247,5,252,252,6,99,
+102,143,146,105,31,248,147,250,32,5,247,108,247,5,251,45,6,205,247,8,39,192,
+44,251,61,5,251,231,6,252,21,251,74,251,185,251,172,251,95,234,251,101,247,
+92,39,31,251,61,248,148,21,247,154,247,58,247,90,247,172,30,247,162,6,252,
+126,253,250,5,251,37,213,58,247,43,247,77,26,14,250,75,250,175,22,247,10,
+29,250,75,248,97,10,249,1,247,162,21,247,10,29,250,75,248,158,251,4,21,237,
+83,233,247,60,5,247,229,6,248,21,247,74,247,185,247,171,247,94,44,247,101,
+251,90,240,31,239,247,69,39,192,32,251,82,5,153,88,83,146,79,27,253,1,251,
+5,248,252,6,179,177,135,131,174,31,252,147,254,31,5,251,110,251,5,247,47,
+6,250,31,248,208,21,251,155,251,58,251,88,251,172,30,251,160,6,248,125,249,
+248,5,247,36,64,220,251,43,251,75,26,14,253,40,247,163,252,226,21,249,72,
+34,253,72,7,14,253,40,247,163,250,46,21,249,72,34,253,72,7,14,61,250,203,
+247,184,10,254,84,251,218,21,250,36,28,5,225,58,190,254,31,28,250,31,5,14,
+251,143,251,167,21,252,119,28,5,225,42,88,248,126,28,250,31,5,14,251,181,
+249,112,250,111,21,251,16,6,252,254,28,250,133,5,247,16,6,247,77,248,55,247,
+87,252,55,5,247,16,6,251,151,248,192,5,14,252,80,230,10,252,80,230,10,252,
+80,230,10,28,11,234,28,16,67,248,191,21,28,239,179,248,85,29,28,16,78,6,14,
+28,20,29,28,24,118,248,191,21,28,231,128,248,85,29,28,24,129,6,14,250,17,
+28,7,240,248,191,21,28,247,252,248,85,29,28,8,7,6,14,252,80,230,10,253,86,
+247,116,68,248,102,10,253,86,248,120,28,4,125,248,102,10,252,65,251,17,21,
+252,64,6,122,57,5,248,65,6,14,251,82,248,89,21,241,253,37,37,7,14,248,89,
+4,241,254,228,37,7,14,253,67,247,148,247,81,29,252,91,247,81,29,252,213,249,
+0,28,5,131,35,29,94,28,5,131,35,29,252,98,249,15,28,5,43,21,175,29,14,252,
+98,249,15,28,5,43,21,175,29,14,57,250,139,28,5,43,21,175,29,252,16,167,10,
+14,251,133,250,156,28,5,131,61,29,251,133,250,46,250,46,61,29,247,77,28,5,
+131,61,29,247,190,250,139,28,5,43,21,175,29,252,16,167,10,249,140,167,10,
+14,249,58,249,15,28,5,43,21,175,29,248,16,167,10,248,16,167,10,248,16,167,
+10,14,252,203,247,209,247,97,10,252,88,247,97,10,251,184,248,179,249,19,42,
+10,252,213,249,33,250,252,42,10,251,67,250,252,42,10,252,98,247,62,28,5,43,
+21,174,10,14,57,247,62,28,5,43,21,248,209,10,251,135,249,249,249,19,49,29,
+113,250,252,49,29,247,190,247,62,28,5,43,21,174,10,248,16,22,248,209,10,252,
+204,248,165,251,156,21,251,96,247,185,5,251,13,6,251,96,251,185,5,247,14,
+6,247,34,247,99,247,35,251,99,5,14,252,5,252,133,44,29,252,31,248,21,252,
+133,44,29,111,250,252,44,29,252,32,251,254,21,247,12,248,70,10,110,30,228,
+6,247,3,186,243,184,235,27,236,220,94,251,3,142,248,125,29,67,28,4,162,58,
+10,83,28,4,243,21,247,13,248,70,10,111,30,227,6,247,2,186,243,184,236,27,
+235,221,94,251,2,141,31,227,6,143,157,139,160,157,26,251,74,251,10,46,29,
+252,123,249,109,28,4,170,21,247,11,63,247,2,251,60,251,58,251,61,251,21,251,
+58,110,30,227,6,247,3,184,239,182,236,27,235,225,96,251,3,143,31,227,6,143,
+162,139,162,159,26,14,250,77,28,6,68,21,247,68,59,251,135,227,252,24,27,252,
+21,251,180,51,251,68,251,39,31,184,94,5,247,25,247,17,247,216,176,247,181,
+27,247,184,247,212,102,251,25,211,31,14,247,160,28,7,76,21,252,122,251,230,
+51,251,68,251,39,31,182,94,5,247,25,247,17,248,2,176,248,46,27,14,247,97,
+28,6,68,21,247,66,59,251,172,229,252,144,27,112,251,31,5,248,25,248,7,102,
+251,25,213,31,14,127,250,192,248,8,21,247,48,49,251,40,240,251,110,27,251,
+97,251,90,58,251,68,251,79,31,194,74,5,247,25,247,87,247,66,174,247,21,27,
+247,44,247,62,104,251,25,247,4,31,14,251,217,251,17,160,10,28,5,143,4,169,
+10,14,28,5,143,4,169,10,251,99,179,46,29,112,28,5,55,21,252,218,6,251,0,86,
+251,0,96,55,27,59,46,180,247,2,133,31,32,6,137,119,140,128,123,26,251,9,211,
+251,15,247,87,247,33,240,207,223,201,30,248,153,6,14,252,125,248,103,251,
+66,21,51,6,251,3,92,32,94,43,27,43,59,184,247,3,137,31,51,6,135,120,139,119,
+121,26,251,13,214,251,9,247,67,247,92,247,21,247,48,247,31,168,30,14,248,
+195,252,64,247,16,29,250,188,28,7,47,247,16,29,250,223,28,5,248,21,253,161,
+248,83,5,251,53,6,254,82,252,83,5,247,85,6,249,196,247,181,249,78,251,181,
+5,14,252,35,248,203,247,124,10,251,185,247,124,10,184,28,5,195,48,10,208,
+28,5,225,21,252,56,6,64,122,133,70,72,31,251,132,251,194,5,223,6,247,195,
+247,138,5,248,44,6,14,209,28,5,225,21,55,6,251,195,251,140,5,252,41,6,112,
+251,21,5,248,56,6,217,153,146,208,209,31,14,119,28,5,55,21,35,6,251,0,86,
+251,3,96,55,27,59,49,180,247,2,133,31,252,220,248,84,10,248,153,6,55,168,
+216,71,247,38,27,247,107,247,16,247,50,247,21,172,31,14,162,28,4,233,21,252,
+44,6,251,98,247,140,5,55,6,247,12,251,193,5,70,180,152,132,217,27,248,55,
+6,14,135,250,252,21,251,12,247,194,5,208,96,126,145,64,27,252,56,6,112,251,
+23,5,248,42,6,247,101,251,138,5,14,247,22,28,5,209,21,53,6,251,152,251,105,
+251,56,247,66,5,166,114,107,157,110,27,116,96,129,106,115,31,251,148,251,
+216,5,223,6,247,152,247,103,247,56,251,64,5,113,163,174,116,166,27,161,184,
+154,169,164,31,14,200,28,4,115,21,251,21,247,215,5,172,127,102,149,115,27,
+112,98,119,112,102,31,251,121,251,64,251,72,247,103,5,55,6,247,21,251,215,
+5,108,151,178,124,161,27,168,182,162,166,174,31,247,121,247,64,247,70,251,
+103,5,14,251,200,250,92,110,35,10,251,174,251,66,68,10,251,17,248,250,21,
+251,0,6,81,116,84,103,104,27,75,105,161,162,106,31,167,94,102,160,84,27,251,
+40,47,38,251,8,82,31,247,0,6,194,162,196,178,176,27,202,170,114,117,174,31,
+110,182,178,121,192,27,248,159,10,191,28,5,135,35,10,252,97,250,237,21,247,
+1,247,8,5,120,177,184,127,183,27,247,39,247,4,237,247,11,197,31,251,1,6,84,
+116,54,100,102,27,105,110,146,149,115,31,236,243,82,192,251,3,251,11,5,163,
+98,88,154,91,27,251,39,251,3,248,147,10,226,178,174,27,181,171,129,125,166,
+31,42,36,5,14,250,75,201,29,250,75,201,29,247,28,28,5,167,88,29,251,114,251,
+145,88,29,252,8,28,4,191,247,230,29,247,152,248,9,247,230,29,247,85,60,21,
+251,1,6,84,116,84,100,102,35,75,233,39,247,248,29,243,202,45,239,248,39,29,
+14,28,5,19,28,7,16,21,248,150,29,252,125,251,14,247,44,252,160,247,187,10,
+248,124,247,44,251,40,248,127,248,146,29,14,247,172,28,6,244,21,178,251,51,
+251,55,178,251,158,247,187,10,27,247,144,247,55,99,101,247,58,31,14,253,158,
+28,6,124,21,103,247,47,247,50,105,247,129,248,146,29,248,150,29,27,251,133,
+251,43,176,176,251,47,31,14,251,22,28,7,24,21,251,18,108,251,11,65,114,251,
+25,118,251,0,229,96,113,251,26,129,84,81,94,89,133,123,57,24,247,19,170,247,
+10,212,165,247,26,159,247,0,49,180,165,247,25,149,194,197,187,189,145,8,14,
+251,255,28,5,243,21,251,34,251,162,5,247,71,6,50,251,62,5,231,6,247,35,247,
+162,5,251,72,6,228,247,62,5,14,252,28,251,175,21,37,169,251,45,37,145,119,
+247,76,150,5,251,49,247,95,21,79,226,80,52,189,251,72,5,157,6,247,58,251,
+168,21,136,245,251,37,247,9,120,125,206,251,64,5,38,247,117,21,251,47,241,
+39,109,203,58,247,79,128,5,162,106,21,120,153,251,37,251,9,136,33,240,176,
+5,14,252,214,252,173,247,50,10,253,2,248,33,247,206,247,50,10,115,28,5,223,
+21,251,32,6,251,55,251,19,251,7,247,19,5,251,31,6,247,64,251,80,251,138,251,
+79,5,247,29,6,247,58,247,19,247,7,251,19,5,247,31,6,251,64,247,79,5,14,251,
+214,251,17,21,92,6,59,108,71,104,80,27,92,96,162,190,131,31,92,6,88,108,86,
+116,92,27,79,86,174,219,141,31,90,6,135,121,139,120,123,26,57,184,63,239,
+209,190,176,190,174,30,88,153,176,102,211,27,247,13,218,247,3,239,160,31,
+14,252,7,251,224,21,221,92,215,40,70,87,102,88,105,30,190,122,102,176,70,
+27,251,13,59,251,3,39,119,31,188,6,219,169,203,174,198,27,188,182,116,88,
+150,31,186,6,190,168,190,162,188,27,198,193,104,59,31,186,6,141,157,141,158,
+155,26,14,252,108,248,122,251,72,68,29,251,238,251,72,68,29,252,108,249,166,
+28,5,55,68,29,112,28,5,55,68,29,248,42,252,186,247,13,29,249,246,28,6,199,
+247,13,29,103,251,72,247,13,29,247,221,28,6,29,247,13,29,247,35,250,230,251,
+72,247,175,29,114,39,247,13,29,105,251,72,247,175,29,114,39,247,13,29,251,
+225,251,72,21,253,17,248,84,10,249,20,6,114,39,21,253,17,248,84,10,249,20,
+6,14,247,176,28,5,55,247,175,29,210,248,1,247,13,29,251,159,249,197,250,84,
+21,253,68,248,84,10,249,71,6,218,248,16,21,253,68,248,84,10,249,71,6,14,252,
+80,248,226,249,78,21,252,99,6,108,251,39,5,248,99,6,119,251,9,21,252,101,
+6,110,251,39,5,248,101,6,14,252,195,248,32,187,247,142,10,252,195,249,36,
+28,4,244,247,142,10,250,75,28,6,102,249,117,247,135,29,28,4,204,252,8,247,
+135,29,249,179,250,92,21,223,55,187,57,74,85,112,70,103,30,188,108,170,196,
+173,139,181,141,25,187,140,183,115,99,34,251,26,103,85,26,45,198,221,7,196,
+247,40,182,245,26,251,33,252,46,21,209,66,69,7,14,250,75,28,6,102,249,203,
+247,135,29,28,4,204,251,162,247,135,29,28,4,204,251,162,247,135,29,14,249,
+254,248,30,248,113,21,251,15,248,166,251,247,247,13,247,247,248,166,247,15,
+252,166,247,246,251,13,251,246,7,252,166,249,85,21,251,14,28,4,157,247,14,
+7,14,251,244,251,179,182,10,122,28,5,33,39,29,252,198,251,185,66,29,251,117,
+28,5,33,46,29,253,196,247,203,28,5,33,46,29,252,185,251,140,54,10,251,91,
+28,5,145,78,10,253,227,248,62,28,6,89,78,10,253,230,251,2,247,22,10,14,252,
+154,203,252,240,125,29,253,115,252,240,125,29,252,8,250,252,74,10,252,182,
+252,240,248,23,29,61,64,103,83,85,31,196,105,77,174,64,27,248,55,10,217,214,
+175,194,193,31,83,173,202,104,213,27,247,180,29,252,14,22,247,250,10,14,252,
+178,251,17,247,123,10,252,170,248,132,249,97,247,66,10,252,172,249,2,28,5,
+145,247,66,10,251,82,28,6,22,247,123,10,252,214,251,175,219,10,252,170,248,
+70,248,78,247,44,10,252,170,248,198,28,4,126,247,44,10,251,116,28,5,130,219,
+10,252,122,247,112,28,4,133,21,101,251,93,247,18,251,38,247,129,66,158,238,
+24,251,63,213,86,247,7,155,222,150,195,168,196,187,151,8,247,79,6,139,170,
+166,146,176,30,209,152,61,179,58,27,251,23,251,35,42,251,45,110,31,14,252,
+244,247,50,249,200,21,108,251,48,238,64,247,66,75,155,216,24,251,28,190,105,
+202,153,205,145,171,160,170,173,149,8,247,32,6,139,164,163,148,182,30,189,
+149,96,179,64,27,42,251,1,59,251,4,116,31,14,252,122,249,28,28,4,163,247,
+144,29,181,127,148,92,129,247,181,29,251,39,253,150,247,144,29,182,127,148,
+92,128,247,181,29,14,252,244,248,5,247,192,21,247,4,161,248,91,10,154,115,
+139,26,247,32,6,169,129,150,247,217,29,171,247,48,8,247,3,248,186,21,247,
+4,162,248,91,10,153,115,139,26,247,32,6,169,129,151,247,217,29,170,247,48,
+8,14,251,56,28,5,145,37,10,252,232,248,113,10,14,251,153,28,5,199,248,124,
+29,252,107,248,113,10,251,72,247,242,21,45,6,69,251,242,5,233,6,14,251,28,
+28,5,199,21,44,6,72,251,243,5,233,6,251,74,247,243,248,124,29,253,21,247,
+182,67,247,62,10,253,243,251,242,21,248,79,29,247,26,6,156,221,5,251,26,6,
+166,247,35,5,57,6,112,251,35,5,251,26,6,14,253,2,248,114,248,182,21,251,82,
+6,175,247,82,5,45,6,102,251,82,5,251,82,6,120,44,5,247,85,6,100,251,82,5,
+233,6,176,247,82,5,247,83,6,14,253,21,248,186,28,4,124,247,62,10,252,105,
+251,17,21,251,240,6,122,57,5,248,79,29,247,25,6,14,251,213,249,91,249,107,
+21,252,208,6,125,57,5,247,138,6,59,252,45,5,219,6,219,248,45,5,247,135,6,
+14,252,144,251,209,21,251,25,6,168,247,35,5,57,6,110,251,35,5,251,25,6,123,
+57,5,247,240,6,14,251,213,249,11,247,209,21,251,138,6,221,248,46,5,57,6,59,
+252,46,5,251,138,6,123,58,5,248,207,6,14,252,152,251,17,21,57,6,110,251,35,
+5,251,66,6,125,57,5,247,66,6,110,251,36,5,221,6,14,252,180,251,160,21,251,
+66,6,168,247,35,5,57,6,65,252,5,5,221,6,168,247,36,5,247,66,6,14,252,78,248,
+203,248,164,21,252,4,6,186,247,138,5,57,6,251,3,252,207,5,221,6,186,247,135,
+5,248,5,6,14,251,79,248,184,247,87,21,218,251,247,248,107,61,252,186,7,14,
+252,76,251,17,247,239,10,252,180,249,13,28,5,129,247,239,10,253,11,248,181,
+250,129,21,249,22,251,23,253,22,7,49,247,212,21,182,103,177,96,96,104,101,
+96,96,174,104,182,182,175,174,182,30,14,252,112,248,32,28,5,195,21,182,104,
+175,96,96,102,103,96,97,176,103,182,182,174,175,181,30,247,244,165,21,49,
+229,252,92,252,92,232,49,5,14,252,3,248,199,28,5,103,21,182,105,175,96,96,
+104,103,96,97,174,103,182,182,173,175,181,30,247,137,251,191,21,247,20,253,
+21,251,20,7,14,251,189,250,3,250,208,21,248,59,251,20,251,187,252,217,251,
+20,7,14,206,28,5,34,28,5,20,21,247,12,254,188,252,66,247,10,247,202,247,174,
+251,202,247,10,247,202,7,14,206,249,48,250,234,21,247,202,251,10,251,202,
+251,174,247,202,251,10,252,66,250,188,247,12,7,14,112,247,234,10,163,247,
+11,5,14,112,247,234,10,201,247,198,5,251,0,6,101,251,79,5,14,128,250,181,
+250,129,21,221,248,41,5,253,194,247,226,10,251,14,254,129,21,221,248,41,5,
+253,195,247,226,10,14,252,51,251,121,51,10,252,73,247,31,29,252,136,251,93,
+21,178,118,176,37,47,71,88,63,92,30,211,6,151,174,247,17,172,75,65,251,62,
+154,251,7,78,215,153,88,55,251,15,168,50,26,53,247,64,133,194,30,143,160,
+5,47,157,117,166,170,225,247,17,114,247,3,202,65,141,174,207,247,62,114,247,
+35,26,14,252,69,251,17,247,149,29,251,17,28,5,56,247,149,29,252,69,251,17,
+21,47,6,106,251,56,5,251,126,6,172,247,56,5,45,6,88,251,150,5,248,55,6,14,
+253,6,248,107,251,158,21,247,158,57,251,76,251,199,247,76,57,251,158,7,14,
+252,92,251,17,21,252,11,6,65,252,11,5,248,11,6,129,247,197,21,92,251,125,
+5,251,126,6,184,247,125,5,14,253,115,248,27,249,132,21,96,163,5,33,96,102,
+75,57,27,82,127,174,180,155,141,158,143,155,31,174,247,72,96,164,251,171,
+251,60,158,78,247,109,247,21,110,251,42,5,137,127,137,127,128,26,70,182,94,
+229,247,9,212,247,2,242,168,30,14,252,4,248,17,28,5,30,211,10,247,15,28,251,
+16,71,10,252,4,247,211,250,108,211,10,247,77,254,62,71,10,252,4,247,148,249,
+36,211,10,247,140,252,246,71,10,252,4,247,86,247,220,211,10,247,202,251,174,
+71,10,252,4,247,23,22,248,1,29,248,9,247,45,10,251,181,247,230,28,5,86,146,
+29,247,137,28,250,216,71,10,251,181,247,166,250,150,146,29,247,201,254,104,
+71,10,251,181,247,100,249,64,146,29,248,11,253,18,71,10,251,181,247,35,247,
+234,146,29,248,76,251,188,71,10,251,181,217,22,247,156,29,248,141,247,45,
+10,252,4,65,10,248,157,28,4,240,196,29,252,4,65,10,248,95,250,62,196,29,252,
+4,65,10,248,32,248,246,196,29,252,4,65,10,247,226,247,174,196,29,252,4,65,
+10,247,163,93,196,29,251,181,65,10,247,97,28,5,40,137,29,251,181,65,10,247,
+33,250,104,137,29,251,181,65,10,214,249,18,137,29,251,181,65,10,149,247,188,
+137,29,251,181,65,10,84,93,137,29,249,31,250,95,28,5,122,21,139,44,136,42,
+252,29,251,209,251,210,252,27,252,29,247,209,251,209,248,29,228,240,136,142,
+30,248,28,247,209,247,209,248,29,248,27,251,207,247,213,252,28,31,248,74,
+253,92,21,251,242,251,174,251,173,251,240,251,242,251,173,247,173,247,242,
+247,240,247,173,247,174,247,242,247,240,247,174,251,174,251,240,30,14,251,
+4,250,25,248,150,21,253,188,248,40,5,253,188,7,14,66,248,102,29,28,6,33,251,
+18,28,249,223,247,104,10,247,132,250,39,247,167,29,251,92,6,251,93,254,174,
+251,110,248,176,5,251,105,6,248,23,254,21,5,247,45,6,249,99,250,21,5,251,
+109,6,252,46,252,170,5,14,252,33,249,9,250,87,21,251,109,248,152,251,15,252,
+152,251,109,6,247,170,251,171,5,14,66,249,220,249,216,21,247,221,10,28,249,
+223,247,18,28,6,33,7,247,62,252,58,5,14,252,33,249,9,28,4,176,21,251,171,
+247,171,251,170,251,171,5,247,109,252,152,247,15,248,152,6,14,252,149,251,
+207,21,251,28,247,61,251,92,251,61,5,247,8,6,91,251,148,5,242,6,187,247,148,
+5,14,66,248,102,29,28,5,76,247,136,29,28,250,180,247,104,10,66,250,128,252,
+107,21,247,19,254,108,251,19,7,249,200,249,236,21,44,176,251,62,252,58,5,
+28,4,197,247,136,29,28,251,59,247,104,10,250,75,28,7,123,248,187,21,247,19,
+28,249,223,7,247,145,10,14,251,231,251,66,21,252,146,211,6,248,152,29,248,
+146,7,14,251,231,251,66,21,253,73,6,247,75,251,45,5,213,248,146,7,14,177,
+28,4,111,251,250,21,247,15,254,54,7,247,145,29,14,250,75,247,210,29,28,249,
+223,251,19,28,6,33,248,160,29,248,35,29,252,146,60,248,146,7,14,252,108,251,
+217,21,247,72,247,43,5,253,70,60,248,146,6,14,249,45,253,223,21,248,61,29,
+28,249,124,251,15,28,6,132,6,252,42,251,55,174,48,5,14,250,75,247,210,29,
+28,250,180,6,247,145,10,28,5,76,248,160,29,248,35,29,252,13,211,7,248,152,
+29,248,13,7,14,249,254,28,4,254,250,104,21,251,57,251,219,5,253,160,6,247,
+145,29,249,98,248,65,29,249,35,247,15,252,229,6,247,29,247,164,5,14,249,254,
+250,44,250,104,21,251,57,251,219,5,253,7,251,15,248,201,248,65,29,249,188,
+6,252,42,251,55,174,48,248,212,247,141,5,248,61,29,253,126,6,247,29,247,164,
+5,14,66,248,97,29,28,5,97,42,28,250,8,7,251,35,251,103,251,35,247,103,5,28,
+5,248,42,28,250,159,248,49,29,14,66,250,87,249,220,21,247,236,29,28,250,159,
+236,28,5,248,248,140,29,28,250,8,236,28,5,97,7,247,8,251,77,5,14,66,248,97,
+29,249,249,7,247,8,251,77,234,197,247,236,29,253,249,248,49,29,239,247,249,
+21,251,35,251,103,251,35,247,103,5,28,4,147,248,140,29,14,250,48,28,7,174,
+248,11,21,235,28,250,8,7,251,103,247,35,247,103,247,36,5,28,5,248,235,28,
+250,160,247,143,29,14,250,48,247,214,10,28,250,160,43,28,5,248,6,247,103,
+251,36,251,103,251,35,5,28,250,8,43,28,5,96,6,251,76,251,9,196,45,5,14,250,
+75,247,214,10,253,248,247,143,29,249,248,6,251,76,251,9,196,45,5,248,126,
+248,86,21,251,103,251,35,5,28,251,108,6,251,103,247,35,247,103,247,36,5,28,
+4,148,6,14,250,75,28,6,166,168,21,254,234,250,234,248,54,251,70,180,231,252,
+241,247,131,41,41,247,132,252,240,231,180,251,70,248,54,250,234,254,234,5,
+14,250,75,28,6,164,176,21,251,132,248,240,47,98,247,70,252,54,254,234,250,
+234,49,49,250,234,254,234,252,54,247,70,98,47,248,241,251,131,5,14,250,75,
+28,6,164,28,4,170,21,41,237,252,241,251,131,180,47,248,54,247,70,254,234,
+254,234,229,49,250,234,250,234,251,70,252,54,231,98,5,14,250,75,28,6,166,
+28,4,178,21,49,229,254,234,254,234,247,70,248,54,47,180,251,132,252,240,237,
+41,248,241,247,131,98,231,252,54,251,70,5,14,249,55,28,5,215,28,6,205,21,
+253,186,253,162,251,57,253,195,125,59,146,194,175,248,9,251,173,247,186,251,
+52,251,52,24,247,123,252,24,200,251,91,171,251,143,230,101,24,139,248,30,
+250,63,249,14,248,109,30,251,48,247,151,235,247,212,139,26,14,251,14,249,
+252,28,6,51,21,47,6,251,185,253,39,251,184,249,39,5,46,6,247,232,253,117,
+5,229,6,14,252,246,248,2,251,24,21,93,6,251,39,251,221,251,38,247,221,5,93,
+6,247,62,252,4,5,184,6,14,251,14,249,252,249,230,247,142,29,252,246,248,2,
+252,136,21,251,62,248,4,5,94,6,251,62,252,4,5,185,6,247,38,247,221,247,39,
+251,221,5,14,132,250,111,250,9,247,174,10,253,164,28,6,24,21,61,7,250,9,251,
+175,5,217,7,253,171,247,136,249,171,247,135,5,217,7,14,251,186,253,151,247,
+174,10,252,188,248,59,252,119,21,178,7,252,31,247,14,248,31,247,14,5,178,
+7,252,78,251,34,5,100,7,14,66,250,74,251,183,21,247,74,7,253,74,249,77,249,
+74,249,74,5,247,76,7,254,0,254,2,5,14,132,250,111,28,4,143,247,40,10,247,
+53,28,5,201,247,40,10,251,120,247,172,10,14,252,188,248,59,251,234,21,178,
+7,252,78,247,34,5,100,7,248,31,251,14,252,31,251,14,5,100,7,14,66,250,74,
+248,224,21,254,0,250,2,5,251,76,7,249,74,253,74,253,74,253,77,5,251,74,7,
+14,252,218,247,172,10,28,6,94,87,247,142,29,252,243,98,21,247,232,253,117,
+5,229,6,247,232,249,117,5,46,6,251,184,253,39,251,185,249,39,5,72,252,39,
+247,40,10,249,254,28,5,147,248,56,21,247,139,247,138,139,248,34,251,139,247,
+141,251,138,247,138,252,35,141,251,140,251,140,251,140,251,141,141,252,34,
+247,138,251,138,247,3,251,0,247,29,77,247,32,128,8,251,229,251,242,32,247,
+242,251,161,247,5,247,161,247,243,246,251,243,247,227,7,247,34,150,247,32,
+201,247,2,247,2,8,70,208,21,251,101,251,101,251,229,141,251,99,247,99,251,
+100,247,101,139,247,229,247,100,247,98,247,101,247,101,247,227,139,247,101,
+251,101,247,99,251,98,139,251,231,251,99,251,99,8,14,249,254,28,7,15,250,
+76,21,122,247,83,141,194,152,247,135,251,134,125,84,137,251,83,157,133,80,
+24,109,247,75,74,122,247,86,27,252,57,252,57,5,233,251,2,251,34,193,251,48,
+27,251,240,251,174,251,174,251,240,251,241,247,174,251,174,247,240,247,241,
+247,174,247,174,247,241,247,45,83,247,33,49,246,31,248,58,248,59,5,251,86,
+157,205,169,251,76,30,252,59,252,148,21,251,186,251,130,251,130,251,186,251,
+186,251,130,247,130,247,186,247,186,247,130,247,130,247,186,247,186,247,130,
+251,130,251,186,30,14,251,189,249,104,247,253,21,247,14,251,25,239,251,8,
+52,54,109,81,56,30,250,42,35,28,249,176,7,243,184,247,23,222,247,34,247,10,
+8,247,18,244,244,222,247,22,26,251,112,135,21,141,72,102,69,88,77,78,62,56,
+68,85,88,8,248,44,7,212,183,193,174,203,27,210,188,91,69,141,31,14,251,114,
+249,129,247,189,21,247,114,7,251,24,101,5,247,244,7,247,24,177,5,247,113,
+7,251,24,102,5,248,71,48,252,99,7,251,73,88,5,248,73,46,252,99,7,251,20,103,
+5,251,112,7,247,20,174,5,251,243,7,251,20,102,5,251,111,7,247,20,175,5,252,
+74,232,248,99,7,247,73,191,5,252,74,230,248,99,7,48,247,87,21,251,73,88,5,
+247,244,7,247,73,191,5,14,253,63,248,134,250,251,247,10,10,253,63,247,139,
+251,83,21,152,208,5,251,37,6,251,12,120,178,222,155,31,222,154,174,248,29,
+29,75,73,251,17,116,31,251,17,116,176,73,247,69,27,14,253,63,247,169,250,
+251,247,11,29,253,63,165,251,83,247,11,10,253,63,248,96,250,50,21,152,209,
+5,251,224,6,126,69,5,248,6,247,93,247,10,10,253,63,247,139,251,83,21,152,
+208,5,251,31,6,251,13,112,166,232,157,31,232,157,176,168,247,13,27,247,31,
+6,153,210,5,251,25,6,251,44,53,87,251,33,112,31,251,33,113,205,89,247,44,
+27,234,251,91,21,152,208,5,251,234,6,125,68,5,14,253,63,248,85,250,49,21,
+152,209,5,251,235,6,126,69,5,247,63,247,94,247,11,29,253,63,247,85,252,28,
+21,152,208,5,251,229,6,126,70,5,247,62,247,93,247,11,10,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,249,254,14,250,75,14,252,
+240,14,252,160,14,253,149,14,252,76,14,251,4,14,66,14,252,240,14,168,14,252,
+221,14,254,180,14,249,254,28,5,88,250,196,21,251,44,44,251,2,78,70,30,251,
+34,251,52,72,64,131,251,78,8,96,6,147,247,51,178,247,24,228,247,39,8,180,
+209,193,247,16,244,26,247,93,251,20,213,34,251,20,77,67,79,30,84,203,68,94,
+26,82,94,109,103,111,56,167,247,22,247,41,247,20,247,31,247,125,247,109,247,
+50,251,11,251,89,30,251,169,254,111,21,66,81,99,88,81,82,180,211,204,194,
+186,199,194,193,94,72,30,249,250,249,47,21,254,100,250,100,254,99,254,100,
+250,99,254,99,5,14,252,102,248,18,10,252,102,248,19,10,252,102,248,19,29,
+252,102,248,20,29,247,92,247,124,247,27,21,122,126,164,153,31,247,95,251,
+0,7,73,252,13,5,250,153,6,205,248,13,5,32,6,66,251,95,5,125,135,117,114,122,
+27,252,11,249,21,21,120,126,159,154,142,31,247,13,37,7,62,252,73,5,241,6,
+181,247,14,5,153,142,162,162,156,27,247,200,6,155,155,116,125,136,31,251,
+14,240,7,216,248,73,5,38,6,97,251,13,5,124,136,117,119,121,27,252,179,248,
+234,21,79,251,232,248,162,29,198,247,60,5,159,145,158,158,157,27,248,252,
+6,157,152,120,119,137,31,140,251,60,248,162,29,199,247,232,5,14,106,172,250,
+111,164,247,254,172,6,252,105,162,7,30,163,99,99,89,135,4,63,12,9,237,10,
+247,76,11,237,145,12,12,247,76,170,12,13,250,221,21,181,19,2,177,2,0,1,0,
+10,0,29,0,36,0,39,0,50,0,103,0,137,0,164,0,171,0,179,0,200,1,12,1,30,1,49,
+1,57,1,87,1,90,1,167,1,176,1,179,1,185,1,249,2,32,2,37,2,43,2,55,2,91,2,98,
+2,137,2,146,2,153,2,161,2,168,2,174,3,62,3,71,3,121,3,125,3,130,3,134,3,153,
+3,156,3,159,3,177,3,180,3,183,3,222,3,228,4,18,4,21,4,30,4,39,4,44,4,82,4,
+99,4,102,4,120,4,170,4,178,4,211,4,214,4,230,4,251,5,66,5,88,5,139,5,197,
+5,209,5,243,6,99,6,154,6,246,7,113,7,178,7,192,8,24,8,33,8,151,9,12,9,44,
+9,74,9,118,9,126,9,132,9,142,9,153,10,6,10,106,10,146,10,158,11,9,11,33,11,
+132,11,237,11,254,12,41,12,143,12,152,12,162,12,202,12,227,12,240,12,243,
+13,2,13,9,13,21,13,36,13,134,13,143,13,193,14,33,14,48,14,65,14,82,14,88,
+14,91,14,105,14,129,14,150,14,171,14,174,14,186,14,198,14,209,14,226,15,58,
+15,90,15,177,15,221,15,250,16,5,16,36,16,117,16,175,17,1,17,5,17,17,17,60,
+17,74,17,90,17,170,17,204,17,233,18,5,18,32,18,44,18,50,18,71,18,74,18,80,
+18,119,18,125,18,136,18,143,18,157,18,233,19,51,19,57,19,93,19,107,19,118,
+19,177,19,193,19,209,19,219,19,237,19,244,20,23,20,90,20,115,20,124,20,158,
+20,199,20,224,20,247,20,253,21,61,21,123,21,136,21,141,21,160,21,190,21,198,
+21,219,21,224,21,235,22,40,22,71,22,100,22,105,22,123,22,182,22,241,23,37,
+23,95,23,101,23,116,23,119,23,135,23,140,23,187,23,232,23,245,24,19,24,25,
+24,41,24,58,24,88,24,131,24,143,24,156,24,209,25,6,25,25,25,76,25,97,25,149,
+25,176,25,184,25,234,26,3,26,21,26,39,26,48,26,81,26,116,26,143,26,162,26,
+203,26,210,26,234,26,243,27,24,27,43,27,58,27,67,27,83,27,89,27,113,27,124,
+27,133,27,141,27,186,27,206,27,243,28,30,28,74,28,92,28,134,28,153,28,177,
+28,194,28,217,29,4,29,45,29,49,29,91,29,96,29,109,29,149,29,152,29,175,29,
+216,29,234,30,17,30,56,30,96,30,119,30,124,30,139,30,148,30,154,30,167,30,
+191,30,200,30,207,30,214,30,251,31,10,31,33,31,51,31,87,31,124,31,136,31,
+165,31,188,31,223,31,238,32,7,32,31,32,46,32,82,32,102,32,121,32,156,32,165,
+32,175,32,209,32,243,33,6,33,25,33,35,33,46,33,79,33,89,33,122,33,155,33,
+186,33,218,33,250,34,26,34,33,34,56,34,76,34,90,34,97,34,124,34,138,34,145,
+34,161,34,170,34,183,34,196,34,226,35,0,35,30,35,50,35,80,35,110,35,127,35,
+144,35,173,35,202,35,231,35,253,36,11,36,40,36,65,36,92,36,119,36,147,36,
+167,36,174,36,189,36,217,36,245,36,254,37,8,37,22,37,34,37,50,37,63,37,90,
+37,109,37,136,37,152,37,179,37,190,37,201,37,227,37,253,38,23,38,49,38,59,
+38,80,38,95,38,120,38,145,38,152,38,177,38,202,38,227,38,236,39,5,39,27,39,
+34,39,59,39,74,39,80,39,87,39,94,39,99,39,123,39,147,39,171,39,181,39,205,
+39,211,39,233,39,255,40,5,40,13,40,27,40,36,40,59,40,82,40,105,40,128,40,
+151,40,163,40,185,40,207,40,229,40,234,41,0,41,22,41,41,41,61,41,74,41,81,
+41,90,41,103,41,116,41,129,41,142,41,151,41,158,41,168,41,189,41,206,41,227,
+41,248,42,13,42,18,42,25,42,36,42,55,42,59,42,72,42,92,42,112,42,125,42,145,
+42,158,42,178,42,198,42,218,42,230,42,242,43,5,43,10,43,29,43,48,43,67,43,
+72,43,91,43,102,43,114,43,133,43,152,43,171,43,190,43,196,43,215,43,232,43,
+241,43,250,44,0,44,9,44,20,44,38,44,56,44,74,44,92,44,110,44,128,44,146,44,
+164,44,182,44,200,44,207,44,225,44,243,45,5,45,16,45,27,45,38,45,49,45,57,
+45,74,45,84,45,97,45,107,45,120,45,137,45,154,45,171,45,178,45,186,45,201,
+45,216,45,232,45,248,46,8,46,24,46,40,46,56,46,64,46,80,46,96,46,112,46,128,
+46,144,46,160,46,173,46,189,46,205,46,214,46,224,46,234,46,242,46,252,47,
+6,47,16,47,26,47,34,47,39,47,45,47,60,47,75,47,90,47,105,47,110,47,125,47,
+131,47,146,47,161,47,168,47,183,47,189,47,204,47,219,47,234,47,248,47,255,
+48,13,48,27,48,41,48,55,48,65,48,79,48,93,48,107,48,121,48,135,48,149,48,
+163,48,176,48,190,48,204,48,218,48,230,48,242,48,251,49,4,49,10,49,16,49,
+25,49,38,49,51,49,64,49,77,49,90,49,103,49,116,49,129,49,142,49,155,49,168,
+49,181,49,190,49,203,49,216,49,227,49,238,49,245,49,252,50,3,50,15,50,27,
+50,39,50,51,50,63,50,75,50,87,50,99,50,104,50,116,50,128,50,140,50,152,50,
+164,50,176,50,188,50,200,50,210,50,220,50,228,50,236,50,244,50,252,51,4,51,
+12,51,20,51,28,51,36,51,42,51,47,51,58,51,69,51,80,51,91,51,102,51,113,51,
+124,51,135,51,146,51,157,51,168,51,179,51,190,51,201,51,212,51,223,51,234,
+51,245,52,0,52,11,52,22,52,33,52,42,52,51,52,60,52,65,52,70,52,76,52,82,52,
+87,52,94,52,97,52,102,52,108,52,115,52,125,52,128,52,138,52,146,52,154,52,
+158,52,165,52,176,52,181,52,186,52,189,52,195,52,201,52,208,52,212,52,220,
+52,228,52,234,52,246,52,255,53,7,53,14,53,18,53,35,53,48,53,54,53,61,53,64,
+53,74,53,81,53,92,53,100,53,109,53,119,53,126,53,139,53,146,53,154,53,157,
+53,161,53,169,53,176,53,193,53,207,53,214,53,217,28,4,164,28,5,94,117,29,
+11,28,5,254,247,166,10,225,252,99,140,29,247,50,249,179,248,133,29,11,28,
+5,2,22,179,29,11,62,29,14,107,29,251,240,251,105,252,68,183,29,11,21,217,
+81,184,63,84,251,11,96,68,112,154,118,167,156,153,146,147,151,30,172,158,
+155,190,184,27,176,149,100,110,57,78,102,67,121,31,108,251,44,5,209,6,162,
+247,7,5,219,168,225,196,235,26,14,28,6,10,247,166,10,186,29,251,103,254,226,
+247,57,10,248,111,225,7,251,6,149,102,247,203,29,247,74,250,76,247,207,29,
+11,250,203,180,21,137,211,5,124,92,94,248,42,29,247,1,248,214,82,10,251,17,
+253,9,247,41,29,11,118,29,248,171,211,29,11,249,109,28,5,8,63,29,11,248,141,
+29,81,27,68,118,90,98,98,158,112,167,121,31,247,189,251,87,5,14,28,6,254,
+28,6,45,21,247,19,61,217,251,2,38,37,65,251,0,79,174,88,139,30,247,72,6,251,
+64,75,251,33,251,96,94,30,159,241,143,166,160,149,163,143,25,217,149,5,225,
+252,58,140,29,247,7,248,220,5,247,166,188,247,85,247,126,247,168,26,11,28,
+5,102,248,214,21,247,134,29,59,252,53,176,10,248,8,29,11,250,207,28,5,229,
+21,247,196,29,252,31,228,29,59,249,11,114,10,11,28,5,57,249,230,161,10,11,
+28,5,137,247,166,10,248,34,29,252,181,252,173,5,105,6,243,248,173,192,29,
+251,107,254,226,248,214,10,5,11,201,10,14,28,6,141,28,5,203,21,247,19,57,
+217,251,2,38,41,65,251,1,80,174,88,139,30,247,70,6,117,251,5,102,37,53,81,
+8,247,62,53,251,68,247,7,251,124,27,247,162,29,200,131,199,123,194,31,247,
+60,231,247,10,247,73,247,72,26,252,131,253,9,21,251,242,251,105,252,66,183,
+29,11,28,5,49,28,5,94,177,10,11,114,29,14,140,10,247,86,29,11,28,4,199,250,
+134,21,237,73,207,49,51,63,77,57,84,172,100,139,30,247,31,6,127,57,102,65,
+76,80,8,247,91,100,251,40,229,251,62,27,247,115,10,247,178,10,31,166,7,247,
+27,207,247,7,247,45,247,40,26,252,93,252,23,174,29,11,21,213,100,188,63,74,
+79,92,69,121,143,116,152,125,30,247,0,6,117,251,9,98,111,251,3,106,127,69,
+24,247,46,168,247,39,237,247,62,26,14,249,218,216,10,11,28,5,39,148,29,11,
+21,90,10,239,238,51,247,17,247,48,29,11,21,247,13,63,247,8,251,66,251,92,
+251,21,251,47,251,32,110,30,227,6,247,3,186,243,182,236,27,235,221,96,251,
+3,141,248,125,29,28,6,47,192,88,10,11,21,200,90,190,77,82,84,84,82,77,190,
+86,200,201,188,192,201,30,252,60,22,200,88,190,77,80,88,84,80,79,190,86,198,
+201,190,192,201,30,11,28,5,109,28,5,8,97,29,11,250,228,250,15,99,29,11,132,
+10,248,168,247,173,29,11,250,70,249,13,112,29,11,247,51,247,53,10,11,28,5,
+209,249,185,21,198,82,247,38,251,81,33,36,85,68,51,30,149,167,154,191,147,
+161,8,251,29,6,106,90,5,176,102,98,247,236,10,247,3,247,31,203,247,19,229,
+31,251,60,180,234,116,247,51,27,247,79,247,45,247,11,213,213,31,247,21,7,
+251,23,251,39,32,71,47,27,251,70,122,217,247,72,164,154,182,143,166,31,247,
+136,153,247,248,247,9,247,115,26,251,72,141,21,251,37,251,130,251,9,251,66,
+122,30,247,48,174,247,23,247,113,247,25,27,209,182,94,86,31,252,185,133,21,
+34,252,197,5,89,102,251,4,60,59,248,24,10,31,11,28,4,195,28,5,94,80,29,11,
+21,251,1,6,82,117,84,102,104,27,75,104,161,162,107,31,167,94,102,160,83,27,
+251,39,248,69,10,176,27,202,172,116,117,172,31,110,182,178,121,192,27,247,
+39,232,237,247,11,196,31,14,21,169,10,11,250,66,149,29,11,247,59,29,14,21,
+205,88,192,76,73,90,84,75,76,190,87,203,202,190,191,202,30,11,187,29,14,85,
+10,14,198,249,48,21,249,32,247,0,253,32,6,28,4,254,213,161,10,14,136,10,14,
+143,10,14,21,213,102,188,63,74,79,90,72,120,144,117,151,124,30,247,0,6,117,
+251,8,98,110,251,3,104,127,71,24,247,46,168,247,37,235,247,64,26,14,250,93,
+247,22,10,11,21,69,6,84,115,73,39,251,2,27,106,102,149,155,121,31,106,247,
+40,5,147,127,91,147,121,27,82,100,80,87,251,6,247,17,85,247,4,247,62,238,
+246,247,29,198,31,14,114,10,14,5,247,76,171,74,217,239,10,11,42,29,247,125,
+249,92,130,10,11,21,247,171,10,11,21,247,41,247,29,247,24,247,43,247,7,53,
+221,251,6,251,42,251,27,251,27,251,42,251,5,223,57,247,7,31,247,72,247,161,
+247,229,29,11,97,10,5,43,129,203,91,247,4,27,217,239,189,167,211,31,14,88,
+10,14,102,29,5,45,121,212,89,247,3,27,219,247,0,189,167,209,31,11,28,4,193,
+28,4,184,21,251,79,6,192,247,193,247,106,29,111,251,52,5,251,193,6,116,251,
+4,5,247,195,6,119,251,15,228,29,247,52,250,44,5,247,78,6,252,62,251,181,114,
+10,11,204,29,157,157,164,141,149,11,131,10,5,96,247,25,247,8,110,247,34,27,
+247,187,247,238,247,19,247,244,247,73,251,58,225,251,54,149,31,248,5,29,11,
+93,10,14,122,29,84,71,57,251,50,247,76,41,247,85,247,233,10,11,5,251,56,6,
+253,136,28,250,227,247,233,29,247,101,248,27,5,248,100,6,11,28,7,23,249,248,
+21,247,122,29,65,6,141,164,141,163,166,26,247,135,251,27,247,30,251,54,251,
+74,251,6,248,94,10,233,221,247,1,27,243,197,251,32,251,25,251,58,55,251,238,
+251,76,31,40,248,22,29,247,73,247,125,247,93,247,169,213,30,213,6,247,215,
+10,11,247,5,10,251,56,253,250,5,247,83,6,225,248,89,5,248,53,6,86,251,169,
+11,28,6,43,192,21,209,7,122,86,96,119,106,27,86,92,186,205,151,31,247,54,
+249,168,5,244,29,247,31,249,70,5,57,247,100,10,251,21,253,14,247,125,10,247,
+29,232,235,239,31,133,94,11,250,197,188,21,247,19,10,247,56,249,168,5,142,
+29,247,29,247,9,191,241,246,31,108,120,37,247,9,120,30,100,107,77,71,117,
+108,174,247,232,29,93,156,163,26,156,166,196,151,163,30,225,148,247,7,176,
+184,165,8,11,127,10,5,51,248,148,227,7,247,54,10,11,247,190,29,81,251,172,
+5,252,51,6,197,247,172,247,160,10,251,30,253,41,224,10,247,31,249,41,143,
+155,151,147,155,140,25,14,21,227,252,156,51,7,247,9,131,167,135,148,116,134,
+123,25,127,73,253,138,253,123,247,52,249,189,143,155,158,164,169,141,25,247,
+23,147,5,227,252,168,51,7,245,131,168,247,99,10,251,19,131,5,51,248,177,227,
+7,251,11,147,110,141,129,164,141,155,25,160,242,249,137,249,121,251,58,253,
+224,135,123,121,114,108,137,25,251,9,131,5,51,248,167,227,7,251,13,147,112,
+248,105,29,247,107,250,220,143,155,158,162,170,143,25,11,28,5,244,250,111,
+21,244,29,247,2,248,182,5,234,160,65,188,251,5,27,62,251,1,90,110,67,31,69,
+7,154,193,184,159,169,27,193,188,94,73,125,31,251,5,252,188,247,125,10,247,
+25,232,235,237,31,11,251,3,147,115,141,125,158,143,161,25,247,4,248,206,5,
+247,123,184,251,53,211,251,30,27,45,251,62,73,80,251,2,31,206,247,240,247,
+148,29,251,109,254,220,248,131,29,251,9,131,5,51,248,156,227,7,248,151,29,
+247,15,248,255,5,182,227,227,184,209,27,247,51,201,92,251,21,112,31,35,252,
+167,135,117,116,120,115,137,25,251,3,131,5,51,11,250,78,248,189,21,248,23,
+252,77,247,55,247,69,26,232,235,162,211,204,173,126,87,184,30,146,251,55,
+5,122,156,180,131,160,27,222,199,216,209,231,251,17,247,22,251,114,251,45,
+251,94,39,251,71,251,4,247,15,39,247,1,251,17,31,251,146,46,251,159,251,67,
+251,221,26,251,125,247,63,48,247,84,247,112,247,200,247,100,248,6,30,251,
+99,121,21,251,131,251,33,251,121,251,66,37,79,217,247,61,247,134,247,85,247,
+88,247,64,219,30,202,55,188,43,251,9,26,14,21,180,7,131,104,110,127,119,27,
+104,108,167,178,148,31,206,247,224,5,233,158,94,201,48,27,58,42,85,80,76,
+31,247,25,29,199,147,71,88,129,247,231,29,174,167,100,57,123,31,67,251,222,
+5,84,127,186,110,213,27,188,219,168,155,186,31,14,248,173,192,29,251,107,
+248,186,29,231,248,105,5,11,28,8,29,28,5,6,21,248,100,29,137,123,25,251,107,
+254,212,5,121,135,118,114,111,27,252,15,6,110,131,166,158,143,31,247,107,
+250,209,141,155,159,162,168,143,25,247,13,147,5,248,100,29,135,123,25,251,
+105,254,209,5,120,135,118,112,111,27,252,15,6,110,131,166,158,141,31,247,
+107,250,209,143,248,119,29,252,166,248,111,10,11,219,254,17,231,10,247,213,
+6,11,21,182,107,168,92,251,5,47,251,32,45,86,30,247,42,98,94,223,75,27,123,
+251,11,102,131,114,31,106,7,247,9,126,157,137,211,251,57,149,89,25,92,251,
+8,68,63,85,108,84,188,24,86,131,108,115,100,26,96,180,114,192,247,15,215,
+247,27,231,190,30,53,162,190,251,33,229,27,194,188,153,164,191,31,184,7,123,
+102,118,137,121,27,106,104,182,192,115,31,114,190,121,205,128,169,191,247,
+7,208,215,186,155,199,92,24,190,155,159,170,172,26,14,250,125,249,23,21,247,
+42,84,247,111,251,133,251,15,32,57,81,78,30,230,131,104,188,38,27,59,251,
+45,71,127,106,31,65,7,143,162,223,168,167,27,195,173,116,68,49,33,252,118,
+112,251,0,31,133,118,117,74,128,108,8,247,30,6,171,186,5,104,176,209,102,
+215,27,248,19,247,100,247,245,247,207,31,251,94,129,21,251,117,34,251,226,
+251,205,114,86,235,153,141,30,247,1,248,202,5,167,167,242,238,233,27,247,
+21,170,251,21,251,7,31,14,6,168,156,125,112,134,31,119,251,35,5,247,9,6,229,
+248,103,5,251,9,6,100,251,32,5,111,133,125,128,110,27,11,240,29,104,139,104,
+135,107,31,252,207,6,120,44,5,248,214,6,251,250,69,251,152,251,115,251,160,
+27,185,10,11,168,29,152,153,140,140,152,30,54,69,58,34,251,1,248,110,10,157,
+247,9,5,248,154,29,246,237,245,247,43,232,31,247,72,247,3,242,247,131,247,
+102,26,158,29,11,21,45,247,136,10,137,31,11,213,7,247,64,10,11,28,251,146,
+247,226,29,247,148,6,11,247,165,29,107,162,210,230,243,143,10,11,249,146,
+28,4,147,21,229,103,247,23,251,49,59,70,90,104,99,30,194,134,116,168,73,27,
+87,40,98,132,118,31,95,7,141,154,193,157,157,27,176,161,125,96,85,70,251,
+181,121,74,31,135,127,125,100,132,120,8,229,6,160,167,5,118,163,184,117,188,
+27,247,141,247,28,247,104,247,81,31,251,24,133,21,251,27,71,251,93,251,95,
+122,105,197,147,140,30,210,247,232,5,156,157,206,198,200,27,223,159,62,70,
+31,14,249,254,248,254,21,247,128,251,47,247,50,251,158,46,55,122,105,251,
+14,30,91,251,128,5,232,6,184,247,17,248,75,10,247,54,225,57,251,68,106,135,
+102,133,98,31,252,15,6,118,39,5,248,15,6,251,150,76,251,5,251,23,251,113,
+27,61,94,157,139,31,125,147,131,149,152,26,136,247,47,5,49,6,90,251,133,5,
+139,247,23,85,247,42,247,242,247,168,247,193,247,234,30,11,28,4,141,247,167,
+29,254,94,53,6,248,182,29,248,183,225,7,251,25,149,104,247,203,29,237,248,
+142,5,247,152,111,10,251,154,6,239,247,116,29,11,28,4,236,22,247,84,10,8,
+247,90,29,11,28,5,0,249,66,21,248,130,234,251,197,247,119,251,200,27,251,
+76,251,60,84,251,11,251,41,31,106,251,64,5,247,54,247,78,247,74,196,247,38,
+27,247,117,247,52,251,70,252,52,59,31,254,59,6,139,124,80,135,118,30,252,
+35,63,247,45,251,132,248,25,27,247,235,247,191,247,197,248,50,218,31,251,
+155,251,19,21,251,86,89,251,57,251,177,251,113,27,251,116,43,247,76,247,124,
+183,31,151,202,5,11,21,247,17,251,13,238,251,76,248,14,10,30,197,29,247,39,
+192,247,5,245,247,21,26,14,249,46,21,247,12,45,199,251,33,251,40,251,66,67,
+33,89,182,121,164,166,184,157,139,30,155,247,9,5,147,149,186,166,205,27,200,
+211,106,51,35,37,57,251,68,149,31,124,51,5,235,151,247,40,145,251,29,26,251,
+6,36,46,251,29,90,100,160,145,127,30,116,243,5,139,113,152,110,72,126,86,
+114,75,215,64,247,62,247,107,247,70,248,158,29,247,32,182,214,227,230,26,
+11,28,4,150,28,4,209,21,247,33,254,75,7,55,252,72,5,247,17,6,209,247,99,5,
+161,145,168,152,153,27,248,191,6,253,23,253,19,198,53,5,157,164,166,153,184,
+27,247,2,247,119,49,251,101,251,143,251,96,251,161,251,134,67,84,158,180,
+84,31,112,247,121,5,157,121,75,139,125,27,34,74,41,49,47,247,5,251,56,247,
+211,248,42,247,227,247,230,247,216,247,129,251,152,247,62,251,125,31,11,250,
+130,250,136,21,251,15,6,90,79,223,29,168,250,236,106,29,28,5,126,28,5,6,21,
+248,2,10,5,96,53,251,20,94,47,27,251,19,98,247,49,29,247,44,70,247,29,27,
+247,6,247,64,202,199,247,2,31,248,68,10,11,250,42,249,128,21,247,35,251,3,
+237,251,156,30,252,46,61,6,239,131,164,137,139,131,137,133,25,251,62,253,
+161,137,127,129,133,120,137,25,39,133,5,59,248,72,219,7,41,145,114,141,139,
+147,141,145,25,197,247,155,5,157,186,136,166,27,247,174,247,108,247,38,247,
+132,31,251,85,116,21,251,109,251,95,77,251,68,150,30,235,248,80,5,141,154,
+157,139,156,27,247,74,190,65,35,31,14,247,14,10,247,21,249,23,5,11,21,252,
+253,248,84,10,249,0,6,11,250,220,250,246,21,208,10,247,23,247,31,86,251,46,
+251,111,251,99,251,56,251,103,90,251,80,176,213,141,31,147,247,78,5,251,17,
+6,78,251,213,11,28,7,57,247,166,10,182,29,251,90,254,163,135,115,118,126,
+114,137,25,251,12,129,5,53,11,240,29,252,109,251,193,251,197,251,205,185,
+10,11,137,10,14,186,10,247,161,241,251,142,6,153,243,196,247,55,29,11,249,
+203,249,17,142,10,11,107,29,247,119,10,120,251,80,247,144,10,11,247,57,10,
+248,169,225,7,251,11,149,104,247,203,29,11,247,77,249,248,21,134,126,136,
+125,125,26,98,167,101,234,126,30,247,59,247,50,5,247,21,133,178,251,14,251,
+24,26,49,121,43,118,73,30,251,25,97,48,251,31,251,27,27,251,1,48,220,247,
+7,61,31,98,251,21,5,57,196,236,251,11,247,74,27,247,87,247,56,247,30,247,
+135,217,31,164,216,150,213,208,26,247,148,251,51,247,72,251,111,251,40,52,
+57,77,119,30,11,250,142,186,21,209,7,149,10,11,251,46,121,33,251,136,251,
+25,251,173,32,251,88,25,94,249,146,47,145,251,140,69,5,82,7,247,46,122,196,
+253,225,119,91,5,247,43,6,247,7,247,69,247,35,247,156,247,13,247,150,11,21,
+247,203,251,92,201,251,17,251,79,251,45,251,9,63,65,30,251,19,7,247,23,247,
+39,246,207,231,27,247,11,215,251,3,251,41,114,135,96,134,115,31,251,135,124,
+251,228,251,8,251,116,26,80,196,251,40,247,81,247,184,247,140,247,232,247,
+214,30,251,107,251,72,21,251,48,104,251,2,251,123,251,27,27,71,96,194,194,
+247,38,247,109,247,6,247,66,156,31,11,247,86,10,183,10,247,210,10,251,193,
+249,128,221,10,11,247,179,10,247,79,247,45,247,11,213,215,30,247,21,216,29,
+11,206,10,252,168,53,7,247,5,131,153,137,153,135,150,114,25,11,175,10,248,
+47,10,11,151,29,14,5,135,116,137,117,118,26,251,5,213,248,149,10,11,248,72,
+10,77,247,3,94,247,39,103,209,248,211,29,182,49,247,1,251,146,194,55,25,11,
+249,110,247,39,247,247,10,251,21,251,92,247,92,29,247,125,247,131,227,29,
+11,249,190,248,191,247,247,10,251,11,251,60,247,92,29,247,115,247,99,227,
+29,11,156,29,14,171,29,5,251,3,117,247,14,116,189,27,11,248,12,29,161,196,
+152,142,153,141,153,31,11,247,95,29,251,134,28,250,238,238,10,11,247,126,
+10,239,248,152,247,7,10,251,107,254,216,247,111,29,11,247,180,158,204,31,
+142,152,153,178,147,157,8,48,6,120,110,5,161,115,92,161,90,27,251,141,251,
+26,251,104,251,82,51,175,251,24,247,48,219,209,188,174,178,31,85,145,161,
+109,204,27,190,239,179,147,161,31,251,88,248,85,21,69,251,231,5,121,121,72,
+81,77,27,56,119,216,207,247,28,206,247,92,247,96,155,173,81,131,138,31,14,
+202,196,244,231,214,197,209,65,24,235,172,180,194,186,26,190,141,96,199,47,
+27,67,94,106,59,61,31,251,223,251,234,11,28,5,215,22,170,7,49,251,13,165,
+246,31,250,179,7,247,8,225,182,247,17,30,170,28,250,72,108,7,247,19,221,96,
+251,8,31,254,179,7,251,5,251,11,119,49,30,108,249,8,170,7,49,251,10,161,247,
+3,31,250,179,7,247,8,241,150,235,30,247,120,6,235,241,128,251,8,31,254,179,
+7,32,251,11,113,49,30,108,7,14,21,32,6,251,11,86,251,2,98,57,27,59,47,178,
+247,13,132,31,35,6,135,119,139,120,123,26,251,9,209,251,15,247,86,247,107,
+247,17,247,48,247,31,174,30,14,219,29,252,4,252,50,134,30,251,41,6,247,117,
+28,4,142,5,213,6,247,146,131,247,117,85,251,234,26,11,247,171,29,252,181,
+252,173,5,105,6,11,249,59,250,101,21,242,251,45,7,170,247,49,192,29,108,251,
+49,5,251,45,36,247,25,6,251,56,253,222,210,29,11,108,246,125,213,251,7,192,
+8,247,62,186,247,31,233,247,50,26,247,68,251,72,184,251,68,30,252,109,61,
+6,245,129,174,135,149,125,133,116,25,251,43,253,111,133,114,120,127,113,137,
+25,32,129,5,61,248,123,217,7,33,247,243,29,202,247,189,5,141,156,174,139,
+159,27,247,74,129,251,62,251,17,180,31,11,28,6,117,250,82,21,251,17,219,79,
+68,5,126,117,92,125,131,63,251,17,211,251,15,27,114,115,135,132,114,31,229,
+248,144,247,106,29,72,252,31,5,151,104,80,247,208,10,237,211,215,211,31,114,
+251,40,248,162,29,11,249,109,28,5,244,21,186,98,190,251,21,251,64,251,78,
+71,251,76,251,56,227,111,229,98,30,79,251,157,5,127,137,121,127,127,27,69,
+133,5,81,247,212,197,7,71,145,5,127,122,151,151,141,31,209,247,202,5,61,163,
+47,188,247,1,26,247,33,233,190,247,31,30,166,251,12,5,172,6,192,180,176,190,
+31,14,22,175,29,11,213,10,252,218,252,156,247,5,247,72,10,11,35,6,251,10,
+86,251,3,98,55,27,59,49,178,247,12,133,31,32,6,137,119,137,120,123,26,251,
+9,211,251,15,247,87,247,107,247,16,247,48,247,31,172,30,11,205,10,195,225,
+163,244,217,208,247,46,247,241,10,11,195,10,204,247,221,247,131,29,31,251,
+95,131,247,78,10,11,21,184,114,168,82,106,112,128,123,123,30,163,251,42,98,
+43,78,55,49,251,0,25,98,248,15,5,196,131,110,168,65,27,251,33,100,5,102,7,
+233,135,154,137,147,133,147,120,25,166,74,167,251,239,129,26,113,131,108,
+121,104,30,214,6,221,221,247,52,247,64,247,11,247,95,8,147,153,160,174,180,
+26,14,247,155,29,152,144,152,144,152,145,8,248,16,223,251,84,6,247,26,207,
+214,206,234,26,247,130,10,57,47,61,251,48,69,31,14,116,149,119,148,127,30,
+247,213,252,70,5,247,17,6,251,136,248,143,5,139,92,205,65,68,110,98,96,30,
+11,250,107,198,21,213,7,115,61,94,124,96,27,100,92,151,207,151,31,247,46,
+249,193,236,29,82,251,193,11,248,20,10,248,109,247,217,247,199,247,199,247,
+97,29,252,76,252,79,251,226,252,160,247,133,29,31,11,21,232,29,247,105,28,
+4,123,247,26,10,11,28,5,147,187,29,11,5,251,100,251,4,247,78,6,121,46,195,
+10,157,232,5,248,211,249,229,94,29,184,29,14,250,113,247,77,29,11,21,201,
+92,190,78,81,82,84,81,78,192,86,201,200,186,192,200,30,252,60,22,201,90,190,
+78,79,86,84,79,80,192,86,199,200,188,192,200,30,14,251,32,247,143,10,11,239,
+29,247,58,209,247,228,248,12,10,14,40,74,184,247,71,29,11,21,198,10,92,248,
+189,29,213,248,180,151,232,8,11,197,247,150,5,251,9,6,88,251,37,5,124,133,
+131,131,122,27,252,2,6,220,248,13,5,247,97,6,160,143,131,129,31,120,251,5,
+5,247,1,6,215,247,242,5,251,1,6,106,35,5,122,133,133,133,121,27,251,97,6,
+213,247,230,5,247,189,6,157,141,135,125,31,251,19,247,13,7,11,21,247,204,
+72,65,247,30,57,27,86,101,32,110,110,139,121,162,31,161,151,214,174,27,198,
+247,20,251,168,251,8,145,31,139,86,251,10,60,26,60,166,84,176,176,160,212,
+202,202,115,247,15,139,30,177,247,3,247,83,247,155,247,11,26,36,6,251,26,
+45,251,59,91,251,25,30,14,28,5,8,194,29,11,21,247,5,251,72,7,217,248,93,5,
+63,247,100,10,86,251,207,5,251,91,251,5,247,70,6,59,252,103,247,83,29,188,
+247,170,5,14,248,133,29,247,13,149,5,248,46,10,247,63,29,11,246,29,247,56,
+209,247,230,248,12,10,11,248,9,29,221,159,64,73,127,31,251,42,253,119,98,
+251,99,105,43,36,100,25,251,52,247,12,5,139,251,4,105,44,26,86,182,88,247,
+4,247,142,247,103,247,107,247,128,182,30,247,38,249,148,5,145,169,141,170,
+164,26,11,247,65,10,248,179,248,100,10,247,115,250,255,247,114,10,11,135,
+112,121,127,112,248,73,29,103,143,130,153,144,162,25,11,55,69,251,0,82,251,
+25,208,29,11,236,248,151,5,144,176,186,145,162,231,29,107,86,133,134,99,31,
+11,248,30,29,247,193,10,11,21,251,248,251,113,252,60,251,185,251,105,251,
+23,247,80,247,148,248,19,247,115,248,36,247,197,247,89,247,25,251,81,251,
+150,30,14,21,174,110,171,86,81,113,109,100,100,174,110,188,186,174,178,170,
+30,96,251,74,21,85,6,251,92,102,5,102,7,247,2,129,41,252,173,125,71,110,66,
+112,114,25,251,23,174,5,125,131,116,120,109,26,102,164,110,196,247,71,245,
+247,136,247,15,162,30,14,21,251,38,6,251,135,251,81,251,62,247,81,5,251,36,
+6,247,93,251,239,5,247,54,6,11,28,4,145,250,171,21,217,29,11,21,251,134,34,
+251,176,251,88,49,44,231,247,105,247,125,240,247,208,247,135,184,174,124,
+121,160,30,165,55,154,57,251,21,26,14,247,111,29,203,135,235,119,161,92,25,
+247,134,252,111,5,73,247,228,227,7,251,31,149,251,134,248,113,119,180,106,
+170,67,158,25,209,167,210,207,199,229,11,247,249,10,5,98,159,170,104,182,
+27,247,11,247,46,247,87,180,169,31,109,192,5,235,10,11,247,244,29,137,137,
+116,124,123,248,143,29,160,156,157,161,141,25,247,25,147,5,225,11,247,205,
+249,76,245,10,247,97,251,105,219,251,66,251,60,251,27,106,70,251,46,30,77,
+251,204,5,247,15,6,207,247,79,5,212,166,247,57,189,207,27,247,19,247,9,67,
+251,29,251,101,251,81,251,19,251,82,145,31,77,141,117,251,13,5,147,174,188,
+139,176,27,11,21,247,50,58,247,13,251,56,251,169,251,35,251,209,251,150,251,
+71,233,39,247,46,247,142,247,59,247,181,247,178,30,251,29,162,21,251,119,
+251,0,251,187,251,50,84,67,161,247,52,247,117,243,247,191,247,58,213,188,
+84,251,21,30,14,249,218,249,254,21,247,107,10,30,247,55,10,11,21,248,1,29,
+11,247,52,29,253,75,253,193,248,123,29,247,1,216,51,247,1,27,184,11,250,164,
+247,46,10,251,45,251,19,251,34,251,43,75,182,82,206,182,185,172,174,159,31,
+35,247,23,247,245,10,11,222,29,251,27,143,247,123,29,247,244,10,247,30,249,
+41,5,57,247,164,10,251,174,28,250,168,247,35,10,11,249,254,220,10,11,247,
+120,10,251,194,250,166,247,109,10,11,28,6,184,249,46,21,241,39,211,251,39,
+251,46,251,70,53,251,68,63,200,88,199,114,30,251,13,100,251,5,67,251,33,26,
+251,5,244,64,247,66,247,43,247,111,229,247,72,241,51,189,68,163,30,233,178,
+247,0,221,247,5,26,11,21,234,65,202,47,30,124,67,5,199,186,100,78,55,65,69,
+57,31,125,66,5,247,15,247,13,247,8,247,17,31,14,21,247,107,10,30,247,55,10,
+251,68,253,250,5,247,82,6,246,248,152,163,247,11,247,38,247,175,10,31,11,
+21,247,102,29,11,237,205,93,133,149,31,157,133,158,111,118,26,251,82,247,
+13,7,11,247,47,251,81,193,251,19,251,23,251,2,114,90,251,13,30,94,251,115,
+5,237,6,186,247,11,5,194,162,247,27,172,188,27,227,223,108,36,251,49,251,
+15,59,251,35,145,31,98,141,118,33,5,145,164,170,141,172,27,231,11,135,125,
+127,131,122,138,25,63,133,5,87,247,238,191,7,62,145,116,140,134,149,142,151,
+25,205,247,212,5,248,51,6,73,251,212,136,125,126,131,123,138,25,59,133,5,
+87,247,240,191,7,64,145,115,140,134,149,141,151,25,11,216,252,58,62,7,228,
+130,163,137,139,131,137,131,25,82,251,181,5,129,90,89,127,88,248,146,10,247,
+136,247,103,247,128,188,176,131,119,184,31,155,135,147,128,123,26,133,251,
+35,5,247,19,6,11,39,187,110,70,5,132,123,130,137,133,86,73,201,59,27,251,
+10,69,38,64,109,162,97,189,176,169,169,150,145,31,69,217,5,161,153,174,153,
+162,27,174,181,121,121,175,31,247,9,163,252,87,252,124,231,93,172,197,5,11,
+5,60,247,164,10,11,247,249,29,247,90,247,85,211,149,170,31,247,96,10,11,236,
+10,14,248,216,248,199,21,252,128,6,112,251,31,5,248,128,6,14,59,7,240,10,
+11,247,198,10,248,197,7,247,236,247,153,247,15,247,228,247,70,251,15,209,
+251,70,163,31,247,80,201,247,46,247,0,247,103,26,251,120,125,21,251,77,251,
+23,251,49,251,148,121,11,21,171,116,189,78,57,69,91,62,84,30,168,247,17,248,
+86,29,251,6,252,159,5,247,17,6,206,247,202,156,210,233,247,5,206,164,25,170,
+79,5,211,186,147,197,31,14,227,10,251,117,28,251,109,5,135,248,6,29,11,102,
+108,36,41,86,27,115,116,160,165,127,31,251,21,247,146,126,164,101,169,110,
+154,25,178,163,178,180,171,188,11,28,5,14,246,10,11,247,129,29,247,70,251,
+33,223,251,37,213,31,247,232,10,11,5,77,235,247,9,106,247,223,10,31,251,95,
+131,247,88,29,11,251,42,27,248,130,29,31,177,247,83,5,57,247,100,10,251,70,
+253,250,248,9,29,184,204,107,251,1,119,31,11,237,133,162,137,147,123,135,
+126,25,88,251,156,55,251,197,73,43,8,106,119,106,88,110,27,251,29,213,5,67,
+84,81,80,61,174,114,194,217,247,27,248,57,10,11,247,67,29,247,86,247,177,
+247,121,194,30,11,247,221,29,158,136,194,251,104,182,251,85,25,11,83,84,103,
+251,13,151,76,8,251,42,89,251,14,45,251,31,26,251,48,247,16,251,35,247,161,
+247,152,247,150,247,46,247,68,247,11,55,188,251,17,196,30,251,166,247,17,
+132,161,150,199,157,180,25,11,213,129,104,247,7,251,29,27,251,13,251,25,47,
+42,38,31,178,247,81,5,55,6,251,199,75,5,80,7,247,62,120,251,68,253,250,5,
+247,80,6,247,36,249,68,5,190,180,247,23,247,21,235,27,11,21,207,86,192,72,
+71,86,86,71,72,192,85,207,206,192,193,206,30,14,21,209,106,174,70,251,5,102,
+75,35,125,30,35,254,9,248,136,10,175,247,38,247,97,249,182,139,26,251,99,
+28,251,86,21,213,76,188,67,66,81,88,67,62,211,98,198,221,192,192,204,30,11,
+248,7,29,48,63,113,55,88,43,8,251,1,79,80,67,251,25,247,126,29,11,247,1,7,
+70,62,70,91,37,27,98,93,146,156,85,31,164,60,36,189,33,27,130,130,139,138,
+130,31,251,43,128,88,84,100,99,8,251,0,7,212,215,199,186,241,27,196,209,124,
+106,232,31,108,11,249,244,249,191,21,247,130,10,45,251,13,51,251,91,61,31,
+251,58,71,251,55,251,21,251,19,26,11,252,146,252,207,247,24,10,11,250,13,
+21,194,124,207,251,21,251,138,251,64,251,54,251,128,92,30,251,13,252,250,
+5,247,83,6,247,13,248,246,176,247,79,165,206,242,172,25,247,31,251,11,5,139,
+247,5,154,235,26,11,247,216,10,247,41,249,174,5,251,80,6,55,252,72,5,252,
+54,6,225,248,97,247,106,10,11,247,58,29,248,171,225,7,251,11,149,104,141,
+129,156,143,159,25,11,247,107,29,252,175,51,7,247,2,129,168,137,147,116,135,
+121,25,11,27,248,83,10,31,247,60,10,11,248,111,29,137,123,65,252,7,251,68,
+252,68,49,251,23,8,251,41,251,107,251,138,53,139,26,55,252,56,5,248,123,10,
+11,21,153,208,5,251,37,6,251,12,119,178,222,155,31,222,155,173,248,29,29,
+76,73,251,17,115,31,251,17,115,177,73,247,69,27,14,248,109,10,162,101,248,
+31,29,158,100,56,124,31,56,123,104,100,251,12,27,251,37,6,127,70,5,14,21,
+204,88,191,75,74,90,85,76,75,190,88,202,203,190,190,203,30,11,248,4,29,252,
+44,6,252,161,252,39,251,213,252,144,251,208,247,146,251,121,248,3,31,248,
+118,6,248,160,247,254,247,238,248,140,31,254,123,253,124,21,11,247,176,10,
+247,77,10,11,250,175,28,5,53,21,247,128,10,247,78,65,251,31,26,251,79,251,
+47,251,4,251,68,11,248,218,28,5,166,21,247,45,29,248,101,29,186,247,111,5,
+247,117,187,247,37,247,5,247,23,27,184,184,131,118,160,31,173,251,64,5,139,
+160,129,168,214,199,202,213,30,14,248,7,29,48,63,113,55,88,43,8,251,1,79,
+80,67,251,25,27,11,211,7,106,82,94,135,112,27,94,76,170,223,157,31,11,117,
+251,11,251,40,247,44,29,11,161,247,11,247,40,247,175,10,247,107,10,31,247,
+55,10,11,249,199,247,27,10,11,203,7,139,51,108,76,83,86,168,196,149,30,247,
+31,249,84,142,152,153,155,163,141,25,14,247,110,10,247,76,252,66,247,201,
+29,11,247,216,29,244,217,215,210,31,11,5,247,156,6,248,76,10,11,21,124,63,
+247,54,207,247,57,247,23,165,247,23,25,247,25,167,92,225,46,27,74,65,94,68,
+124,31,128,81,170,86,139,26,247,25,6,117,33,46,58,251,2,80,8,11,182,251,89,
+176,251,94,145,106,251,31,251,144,67,251,1,53,247,120,29,11,217,252,92,247,
+222,29,251,50,253,111,135,114,121,127,112,137,25,53,129,5,61,248,95,217,7,
+40,149,105,143,128,153,145,162,25,139,135,11,21,205,118,247,134,251,177,168,
+30,127,83,5,247,57,114,161,251,54,65,26,251,49,65,252,124,251,201,101,30,
+127,80,5,247,189,172,247,121,247,175,248,42,26,14,48,247,82,27,247,115,247,
+145,247,35,247,116,186,31,247,26,249,25,5,251,83,6,251,32,253,61,5,251,46,
+108,251,21,89,41,27,86,251,1,145,247,92,181,31,11,247,127,21,252,252,6,125,
+54,248,148,141,97,251,104,247,108,10,11,21,185,93,162,100,88,102,107,97,100,
+180,107,186,188,175,172,182,30,74,251,42,21,54,6,139,251,51,252,178,111,26,
+103,160,114,189,194,179,166,207,148,30,14,251,2,6,247,231,10,157,247,9,5,
+248,115,10,227,227,215,198,31,14,5,247,80,6,247,42,249,97,5,233,229,247,19,
+205,204,27,184,230,83,251,0,116,31,11,247,82,251,23,247,29,251,228,30,252,
+145,53,6,247,63,29,11,248,53,10,47,252,101,5,251,80,6,118,37,5,247,81,6,34,
+252,165,247,200,10,11,28,4,225,249,207,21,247,183,251,56,247,181,252,41,251,
+91,251,86,67,129,110,30,84,251,224,5,247,11,6,229,247,126,147,157,161,160,
+156,141,25,143,149,194,11,21,251,249,110,251,62,252,25,251,185,26,251,92,
+247,20,251,29,247,72,129,30,151,196,5,34,160,55,203,247,74,26,247,78,229,
+248,91,247,187,176,30,14,247,186,29,14,5,247,11,96,247,33,53,251,74,26,251,
+126,251,37,49,251,107,30,98,247,95,5,92,6,53,77,75,57,59,203,51,247,91,247,
+158,247,176,247,5,247,201,11,25,247,47,10,11,64,251,87,251,1,251,17,57,88,
+247,89,29,11,21,247,73,251,15,233,251,66,30,119,34,5,247,13,231,78,251,21,
+251,76,251,21,251,28,251,79,31,121,37,5,247,142,247,80,247,85,247,141,31,
+14,185,71,10,250,50,21,251,23,237,74,47,5,135,110,110,131,111,251,27,251,
+15,231,251,32,27,11,248,14,247,109,209,248,13,247,113,26,247,205,251,109,
+247,130,251,226,252,90,251,206,252,89,252,60,251,250,247,146,251,97,247,193,
+172,178,145,141,170,30,11,247,146,247,30,247,46,247,60,239,52,217,49,211,
+31,247,137,29,11,21,65,176,90,215,204,199,188,206,158,134,161,127,154,30,
+251,0,6,161,247,8,180,168,247,3,174,151,207,24,251,46,110,251,37,43,251,64,
+26,14,21,205,205,251,4,247,4,247,4,247,4,73,205,251,4,251,4,251,4,247,4,73,
+73,247,4,251,4,251,4,251,4,205,73,247,4,247,4,5,14,5,127,69,129,70,73,26,
+251,86,223,251,48,247,150,220,217,176,217,156,30,151,208,100,172,100,153,
+251,115,251,29,24,71,182,154,247,25,169,247,48,11,27,247,25,247,56,247,15,
+247,58,199,96,206,65,102,88,110,90,112,31,247,209,29,11,185,247,59,29,11,
+248,151,29,247,109,250,220,143,161,162,158,163,141,25,11,182,247,99,5,57,
+247,100,10,11,5,57,248,139,10,11,133,115,121,126,112,137,25,251,9,129,5,53,
+11,247,227,29,182,143,166,31,247,136,153,247,230,247,9,247,115,26,251,74,
+141,21,251,37,11,41,247,96,247,82,29,247,17,11,247,251,10,247,189,10,11,251,
+105,104,247,73,10,11,21,158,233,5,251,38,6,171,247,50,5,53,6,107,251,50,5,
+251,37,6,120,45,5,247,37,6,107,251,50,5,225,6,171,247,50,5,14,21,137,211,
+5,247,197,29,247,5,248,187,247,244,10,11,248,95,29,102,225,108,247,2,123,
+189,219,247,82,247,0,247,19,211,168,248,43,29,11,28,4,176,28,5,94,21,248,
+53,10,251,109,254,220,247,200,10,11,21,251,142,251,81,251,91,251,140,251,
+74,247,15,51,247,66,31,160,241,5,251,15,49,195,247,23,247,76,247,19,247,31,
+247,78,31,14,5,247,15,6,237,248,66,5,195,197,220,180,182,27,168,184,104,75,
+125,31,61,251,254,5,71,123,231,127,172,27,194,239,176,147,162,31,11,247,153,
+29,247,121,28,4,131,248,127,29,11,248,111,29,135,123,67,252,7,251,19,252,
+78,57,251,27,8,73,98,72,53,100,27,251,66,207,5,77,76,11,248,149,29,251,60,
+41,251,73,251,25,30,186,247,138,5,252,25,53,6,247,63,29,11,156,6,251,79,252,
+12,5,231,6,247,84,248,21,247,12,157,234,181,165,148,25,217,7,117,133,41,106,
+71,137,248,0,249,111,24,14,45,215,239,5,247,29,131,247,29,251,21,251,37,26,
+11,21,251,52,62,37,36,77,30,43,80,251,19,122,251,11,150,247,19,249,31,24,
+248,57,29,11,27,251,242,251,244,248,121,29,247,9,247,17,170,168,247,7,31,
+213,247,238,248,132,29,11,247,132,29,247,242,247,204,245,248,40,248,93,29,
+31,11,227,252,176,51,7,247,8,131,168,135,147,116,135,123,25,251,107,254,212,
+5,121,137,119,114,110,27,252,189,6,110,131,164,157,141,31,11,248,164,10,247,
+73,217,154,173,30,221,7,124,96,47,104,61,248,128,10,11,21,251,120,251,10,
+251,217,251,116,68,71,186,153,115,30,247,220,10,11,30,252,17,81,6,217,133,
+5,160,137,149,125,127,26,253,93,7,127,129,124,118,137,30,61,133,5,82,247,
+255,196,7,61,145,5,11,247,114,29,45,227,44,247,90,11,239,52,217,49,211,30,
+247,137,29,14,36,251,70,55,251,56,84,180,82,197,177,193,163,182,186,31,84,
+247,36,5,139,161,180,211,30,202,6,160,155,130,119,135,31,11,204,199,196,170,
+139,30,209,247,70,5,166,182,182,149,180,27,235,141,208,51,251,36,26,251,98,
+251,90,251,71,251,74,82,30,11,223,7,251,67,90,217,247,45,100,31,100,247,48,
+121,246,251,60,210,11,247,21,7,251,7,251,9,45,58,251,1,27,35,81,247,31,247,
+25,11,248,117,168,247,0,31,248,132,10,11,5,251,168,85,33,251,29,247,147,10,
+11,21,253,19,6,98,251,107,5,206,6,183,247,4,5,248,45,6,252,218,253,115,5,
+247,34,6,147,180,248,214,249,109,5,11,55,252,58,247,138,10,225,248,76,11,
+251,15,6,69,251,201,123,67,45,251,3,74,113,25,107,198,5,65,94,131,82,105,
+160,90,204,218,210,186,216,193,31,111,11,137,182,5,131,108,110,123,115,27,
+122,90,153,186,147,31,207,247,224,5,247,0,161,94,195,43,27,49,47,96,83,84,
+31,11,21,251,136,251,72,39,251,185,88,88,143,139,30,247,1,248,194,5,139,229,
+149,182,247,107,247,10,77,251,58,30,14,5,51,123,90,106,65,27,251,27,247,36,
+5,125,133,38,116,47,26,78,205,73,247,13,247,68,241,219,247,48,170,30,11,21,
+71,62,251,19,251,89,251,66,59,247,38,233,221,176,223,247,23,171,30,247,148,
+251,8,5,219,102,163,98,90,26,11,21,251,2,252,200,5,76,67,63,71,55,27,37,75,
+238,247,47,247,212,247,72,247,136,247,116,169,219,46,109,133,31,11,194,247,
+224,247,116,10,11,252,132,248,141,29,82,27,67,118,90,98,98,158,112,168,121,
+31,247,188,251,87,5,14,248,63,29,57,252,13,5,73,125,231,133,170,27,194,240,
+170,147,161,31,14,135,149,116,135,123,25,251,109,254,220,248,131,10,11,6,
+251,201,248,44,29,11,26,141,94,124,88,111,79,8,247,10,6,247,17,247,32,247,
+140,247,176,247,74,247,228,248,128,29,11,247,205,10,247,166,247,3,247,54,
+219,247,31,26,11,205,87,192,247,126,10,11,7,251,62,248,58,44,102,247,150,
+252,234,5,247,32,6,14,5,84,6,251,93,248,129,10,11,5,57,6,251,201,75,5,80,
+7,247,66,120,11,195,106,221,41,251,15,251,1,61,251,21,55,11,5,51,121,127,
+107,80,27,61,247,35,5,84,112,82,109,65,26,81,191,78,213,247,54,206,221,247,
+48,167,30,11,21,251,152,251,125,68,251,113,30,94,6,243,248,195,5,151,162,
+141,149,27,247,50,145,247,84,102,251,91,26,11,131,129,121,120,116,137,25,
+41,131,5,53,248,113,225,7,251,15,147,104,141,139,162,156,155,25,248,23,248,
+66,11,148,21,248,77,10,247,158,247,18,247,177,247,70,243,207,32,251,86,30,
+11,167,251,203,21,135,115,121,126,112,137,251,11,129,24,53,248,167,225,7,
+251,7,149,104,142,129,155,143,159,25,11,247,7,247,21,225,31,203,73,186,57,
+165,63,223,195,24,100,239,88,237,63,209,8,186,239,176,247,81,139,26,11,5,
+248,60,6,156,163,124,121,137,31,127,251,132,5,245,6,11,251,213,251,114,251,
+210,251,224,251,129,247,32,251,42,247,117,11,5,251,13,6,51,251,126,131,121,
+116,119,123,136,25,135,129,83,109,51,27,251,121,251,83,247,35,247,201,11,
+21,168,104,187,39,251,1,251,23,74,251,13,78,193,85,193,99,30,203,94,184,105,
+88,26,77,90,99,84,11,27,251,55,6,153,213,248,32,141,247,118,247,38,211,248,
+8,25,203,247,233,251,10,247,71,252,80,128,8,11,110,137,107,137,108,30,253,
+200,6,247,177,207,247,74,247,150,247,126,248,145,10,11,139,211,248,56,10,
+174,251,70,247,140,248,129,29,11,251,72,251,50,8,73,84,33,153,139,26,53,7,
+139,182,121,200,162,247,19,139,206,209,30,247,105,247,119,11,248,135,29,251,
+45,252,225,21,50,251,5,53,57,113,108,146,143,116,30,241,184,207,247,7,11,
+21,251,19,251,9,251,3,251,18,46,211,70,231,31,153,212,5,82,90,178,201,221,
+214,210,221,31,14,251,17,21,251,35,6,251,138,251,80,251,60,247,80,5,251,35,
+6,247,93,251,238,5,247,53,6,14,5,251,50,106,211,36,247,29,27,247,17,247,41,
+230,237,238,31,65,149,174,251,7,247,29,27,247,13,11,43,70,67,118,90,79,30,
+251,68,251,37,127,248,106,29,8,248,82,10,11,247,204,10,248,44,29,11,248,15,
+10,251,55,247,31,57,247,36,65,31,241,86,11,251,78,39,96,25,90,237,5,251,5,
+70,127,43,83,171,57,238,247,15,247,0,217,247,21,223,31,96,11,243,45,236,251,
+44,251,29,251,4,98,251,7,51,30,206,78,5,221,221,194,173,217,27,227,162,88,
+90,11,21,233,251,175,7,247,165,10,11,248,42,10,211,248,180,151,232,8,11,248,
+46,10,247,11,129,173,137,148,123,135,116,25,11,225,7,45,149,110,141,131,150,
+135,165,25,11,248,48,29,202,247,222,5,254,94,53,6,247,6,129,176,11,252,175,
+5,53,65,35,247,251,29,217,38,127,11,121,49,5,250,138,6,210,248,15,5,251,31,
+6,78,251,121,5,110,131,124,127,111,27,252,193,6,11,133,115,120,126,115,248,
+117,29,251,7,149,104,141,129,156,145,159,25,11,137,121,106,118,121,137,25,
+251,5,129,5,59,248,138,219,7,251,1,149,121,141,117,160,143,157,25,11,248,
+133,29,247,11,149,5,225,252,164,53,7,247,63,29,11,250,189,248,244,21,247,
+177,251,121,233,251,187,30,252,30,61,6,228,131,165,137,147,129,135,120,25,
+11,248,142,10,248,50,251,115,248,142,10,14,6,109,90,5,176,102,67,247,236,
+10,11,21,251,191,80,251,81,251,185,251,137,27,251,83,251,41,247,62,247,168,
+188,143,186,145,189,31,11,248,58,247,62,102,233,252,234,251,150,5,251,31,
+7,248,234,251,150,176,233,252,58,247,62,5,11,250,58,249,175,21,247,10,45,
+213,251,126,30,252,97,61,6,230,131,163,137,147,125,133,118,25,11,251,47,27,
+99,116,143,147,94,31,142,61,190,128,178,130,180,140,25,247,128,145,247,74,
+247,54,11,248,171,10,251,0,83,72,65,31,11,227,7,251,17,147,112,248,105,29,
+247,107,250,220,143,155,160,164,167,141,25,14,217,7,133,116,35,104,100,27,
+81,92,196,195,150,31,11,5,125,72,131,81,111,26,251,87,247,53,69,247,91,247,
+154,247,44,247,19,247,105,186,30,11,5,121,44,130,60,98,26,251,152,247,89,
+40,247,144,247,218,247,80,247,66,247,189,196,30,11,247,185,29,251,7,149,11,
+21,251,3,96,67,251,13,251,4,27,90,110,180,190,232,245,208,225,180,176,131,
+125,174,31,11,251,201,251,109,251,199,251,230,251,136,247,41,251,40,247,107,
+248,29,247,27,248,19,247,136,11,251,7,251,23,27,251,15,247,71,5,123,137,251,
+1,102,49,26,65,170,61,247,33,247,142,11,247,217,10,151,126,111,152,31,11,
+135,121,110,118,119,137,25,34,129,5,45,248,128,233,7,32,149,121,141,114,160,
+143,157,25,11,135,115,120,126,118,137,25,32,129,5,53,248,114,225,7,35,149,
+106,247,203,29,11,247,192,10,136,125,25,11,180,247,105,5,137,149,150,139,
+152,27,247,102,247,106,247,109,247,167,247,74,39,243,251,39,11,247,177,10,
+75,251,54,45,251,31,251,31,251,74,25,11,247,203,247,209,10,14,248,127,10,
+247,74,121,11,180,247,126,247,224,29,11,28,5,8,21,11,5,251,111,96,55,251,
+83,251,158,27,251,68,251,5,225,247,64,176,146,205,155,219,31,11,31,251,29,
+253,48,5,247,82,6,247,36,249,72,5,186,167,247,13,247,21,247,17,27,11,88,88,
+8,251,33,7,247,45,247,41,246,203,247,228,251,11,247,25,92,186,110,247,54,
+11,143,182,27,247,66,243,247,253,10,11,180,106,186,68,77,111,119,108,112,
+30,251,171,251,212,5,247,36,6,247,199,247,91,5,11,252,80,247,186,29,11,21,
+96,251,115,5,57,153,67,172,211,26,206,192,199,207,168,167,131,124,158,30,
+14,21,217,7,253,170,247,135,249,170,247,136,5,217,7,254,9,251,175,5,61,7,
+14,247,78,248,121,10,11,247,202,10,251,17,253,2,11,213,101,188,52,88,98,120,
+113,113,30,178,251,140,11,247,207,247,122,247,200,247,223,11,21,198,80,247,
+38,251,81,251,185,251,139,251,230,251,216,251,203,247,92,77,247,17,11,53,
+100,25,251,50,247,23,5,139,251,4,112,51,26,67,165,84,247,17,247,140,233,11,
+251,45,6,251,146,251,44,247,97,247,108,248,108,247,218,247,165,248,20,31,
+213,6,11,209,247,51,247,32,199,247,86,247,21,31,231,247,29,247,9,248,5,245,
+248,179,8,11,220,248,217,21,55,247,56,7,251,14,67,41,39,41,26,251,62,247,
+25,57,247,47,11,21,58,190,253,167,28,251,25,215,88,5,14,21,251,91,98,36,251,
+78,251,43,27,36,59,241,247,95,165,141,166,141,166,31,11,22,231,6,251,26,248,
+129,247,226,248,130,5,47,6,252,29,252,79,118,36,5,11,27,251,168,251,23,251,
+14,251,6,76,31,194,66,5,221,189,247,7,246,247,133,11,30,247,208,29,11,247,
+154,251,6,248,185,173,247,19,249,49,8,247,167,192,91,247,239,252,76,27,11,
+137,25,251,13,129,5,53,248,168,225,7,251,6,149,104,141,131,155,143,162,25,
+11,248,46,29,251,30,253,41,136,125,133,131,123,138,25,55,133,5,87,11,142,
+155,152,147,155,140,25,218,145,5,248,135,10,213,133,163,138,144,129,11,251,
+70,248,93,10,104,251,84,25,107,251,82,11,247,239,29,213,251,43,11,248,128,
+10,247,21,249,23,5,11,114,27,67,100,159,240,88,31,251,176,248,187,11,133,
+112,120,127,113,137,25,251,1,128,5,62,11,135,115,129,126,114,137,25,251,21,
+129,5,53,11,135,123,121,114,108,137,25,251,33,131,5,51,11,248,131,10,251,
+31,131,5,51,11,193,24,106,248,41,29,11,251,46,71,5,72,7,247,21,151,11,21,
+251,134,34,251,176,251,90,49,46,231,247,105,247,125,238,247,208,247,135,11,
+73,193,251,17,248,130,29,30,177,247,83,5,57,6,251,201,11,251,5,35,51,84,251,
+1,27,57,90,223,208,236,233,247,0,247,9,188,31,11,250,78,250,228,21,247,74,
+251,35,247,13,251,109,251,27,251,175,59,251,66,11,251,62,67,50,251,101,193,
+24,109,116,114,115,87,26,119,166,57,241,247,97,11,166,247,216,29,11,247,5,
+21,248,2,29,11,248,78,29,218,247,46,205,153,172,31,11,6,139,225,213,186,207,
+30,238,247,29,247,57,247,236,246,248,179,8,14,247,233,10,14,248,138,29,252,
+25,251,107,252,9,252,50,31,11,28,7,174,248,207,21,225,7,253,15,248,44,82,
+45,247,76,251,9,5,11,46,252,89,5,247,83,6,229,248,89,5,217,6,133,108,137,
+106,106,26,11,28,4,109,198,248,4,10,102,188,195,152,31,11,129,236,92,186,
+251,3,141,25,251,111,71,5,80,7,247,38,131,5,161,11,147,110,141,129,248,6,
+10,158,162,168,141,25,11,163,113,31,104,247,64,5,147,125,120,141,123,27,57,
+82,59,64,251,46,11,247,14,249,15,5,155,160,243,242,238,27,247,2,188,251,34,
+251,12,31,11,251,150,248,234,5,251,32,6,251,150,252,234,234,102,247,62,248,
+58,5,11,250,33,21,186,7,251,62,195,5,80,6,11,247,7,27,248,51,247,54,248,42,
+247,146,11,5,124,61,129,59,64,26,251,91,235,251,60,247,142,223,203,174,219,
+11,6,248,0,29,11,6,57,252,41,5,212,6,197,247,179,5,249,49,6,81,251,179,5,
+11,7,207,247,232,5,251,17,6,75,251,89,5,115,131,125,122,110,27,11,21,240,
+164,34,39,251,30,59,251,129,251,43,123,125,140,140,127,31,11,21,248,1,10,
+11,27,251,66,251,48,86,251,27,84,186,71,221,31,247,30,247,107,5,11,44,71,
+41,251,10,251,13,248,110,10,11,251,1,192,251,72,209,247,39,248,143,10,11,
+247,168,247,202,247,78,247,198,247,125,251,58,247,17,251,105,149,31,11,144,
+251,129,21,177,247,79,5,251,0,6,78,251,198,5,250,101,6,11,28,5,123,21,215,
+34,169,84,251,136,251,68,251,74,251,129,123,30,11,176,63,27,252,19,251,98,
+251,245,251,209,251,39,194,251,112,247,133,11,252,76,248,11,29,11,247,21,
+7,251,7,251,8,251,7,58,251,1,27,251,27,92,247,31,11,21,252,46,6,125,57,5,
+247,218,6,71,251,238,5,221,6,14,5,45,123,157,32,247,31,27,11,70,24,184,170,
+180,175,182,26,11,133,163,248,46,29,11,176,225,237,247,48,172,170,8,11,5,
+247,77,178,55,248,157,10,55,31,11,5,171,159,184,166,180,219,211,94,214,27,
+209,247,56,147,139,31,11,6,247,56,249,232,5,251,44,6,253,205,253,236,112,
+251,29,5,11,21,252,54,6,248,163,248,179,5,251,29,253,64,21,251,69,104,11,
+27,247,35,247,64,223,156,170,31,225,7,110,75,47,100,59,27,11,247,80,6,225,
+248,68,5,211,162,131,106,155,31,247,66,251,232,11,55,55,61,55,77,92,182,203,
+223,221,217,223,200,189,96,75,30,11,64,252,66,251,208,251,25,251,206,247,
+8,8,134,133,56,139,30,11,77,27,251,254,251,109,251,236,251,218,251,64,202,
+251,87,247,121,11,80,251,21,31,102,253,40,21,251,109,251,47,251,21,251,185,
+104,11,251,9,110,5,139,90,72,79,84,74,188,159,83,30,251,64,94,11,247,167,
+29,248,79,10,11,168,247,13,155,141,156,143,159,30,182,247,128,5,153,164,200,
+162,11,214,76,201,63,63,78,77,64,63,200,77,215,215,202,201,215,30,11,227,
+252,150,51,7,238,131,163,135,153,122,135,117,25,43,252,115,11,6,251,93,101,
+5,103,7,247,4,128,11,21,217,7,131,112,45,98,92,27,83,11,251,3,147,125,141,
+125,143,126,164,25,11,162,142,159,25,247,101,250,216,143,159,11,247,6,129,
+174,247,166,29,11,254,64,6,73,251,217,5,247,33,6,195,247,72,5,165,147,11,
+5,45,121,159,248,147,29,170,31,11,6,229,248,103,248,133,29,247,13,149,5,225,
+11,247,62,247,107,247,72,248,158,29,11,247,113,149,31,247,9,251,50,5,248,
+135,29,11,251,5,6,78,251,66,5,124,134,129,131,123,27,251,193,6,11,251,42,
+251,129,88,251,71,88,188,96,182,205,179,174,147,146,11,152,112,251,27,200,
+251,76,27,251,198,251,119,251,68,251,165,11,28,5,176,248,69,29,11,247,15,
+249,4,248,88,29,11,189,28,4,216,21,253,34,226,248,203,248,80,226,7,14,248,
+219,251,196,21,226,252,80,248,203,52,253,34,7,14,5,130,106,47,113,57,27,251,
+40,251,141,247,2,247,222,11,5,146,184,197,143,190,27,247,85,247,12,79,251,
+60,31,11,21,251,37,251,0,49,251,119,30,116,106,141,115,27,221,11,251,183,
+247,38,251,181,248,3,247,70,247,66,211,149,167,11,27,251,19,108,247,21,247,
+6,247,118,242,247,225,247,205,11,65,27,59,59,217,247,68,247,212,247,70,247,
+138,247,91,11,248,117,29,251,9,149,102,11,147,110,143,129,162,143,155,25,
+247,109,250,220,141,155,160,11,162,90,27,251,142,251,27,251,103,251,83,51,
+176,251,23,11,187,90,218,251,31,251,173,251,18,251,229,251,110,101,30,11,
+196,209,151,31,155,229,67,162,139,26,251,73,251,19,5,11,247,1,247,162,30,
+251,89,143,21,251,57,55,251,26,37,11,215,248,23,143,155,158,164,167,141,25,
+247,34,147,5,227,11,225,252,111,53,7,247,9,129,174,247,166,29,11,227,252,
+173,51,7,247,11,131,168,137,149,116,135,119,25,11,248,7,28,7,155,5,251,7,
+6,252,7,28,248,101,5,11,7,247,117,247,15,248,84,29,14,5,33,117,180,251,42,
+247,82,27,11,5,251,2,116,247,32,128,188,27,11,248,85,10,251,238,88,7,11,114,
+110,137,25,251,21,131,5,51,11,126,112,137,25,251,19,129,5,53,11,247,177,247,
+121,194,30,176,247,44,11,247,31,174,247,36,229,247,52,26,11,145,166,158,151,
+165,141,25,11,248,105,10,25,11,225,252,168,53,7,11,5,73,124,193,55,247,19,
+27,239,243,187,175,209,31,11,6,160,147,118,121,137,31,131,251,76,5,247,4,
+6,11,248,22,216,6,251,21,150,103,143,130,153,144,162,25,11,21,201,78,221,
+251,40,251,170,251,164,251,181,252,3,11,21,248,67,29,11,250,226,143,163,157,
+152,166,141,25,247,11,149,5,225,11,254,121,248,91,29,11,247,130,247,98,247,
+23,247,152,194,125,190,127,170,31,11,251,41,251,31,251,25,251,42,251,6,225,
+57,247,6,11,248,118,29,251,44,169,11,156,247,29,244,31,223,246,227,247,154,
+217,248,25,8,11,213,7,248,95,29,11,247,12,251,30,247,87,247,74,247,27,247,
+11,221,223,11,227,252,148,51,7,245,131,164,137,153,120,135,117,25,11,235,
+229,247,31,221,205,27,184,204,107,251,1,119,31,11,5,68,61,32,79,41,27,86,
+71,199,208,154,31,11,5,198,209,248,159,29,11,6,158,143,133,127,31,131,251,
+29,5,247,10,6,11,6,155,243,199,247,181,227,211,247,52,251,21,24,11,21,200,
+94,195,57,53,98,83,78,73,192,90,213,11,30,247,15,6,125,139,127,137,131,30,
+117,251,5,11,43,252,122,248,131,29,251,1,131,11,47,39,251,9,82,31,247,0,6,
+194,162,196,176,11,63,247,9,251,66,251,93,251,21,251,48,251,31,11,88,139,
+30,159,94,5,139,247,81,247,0,184,223,11,122,104,76,125,110,27,67,61,243,247,
+7,78,31,11,251,50,207,251,21,247,68,247,175,247,25,247,228,11,139,251,3,112,
+51,26,67,164,84,247,19,247,140,11,143,153,153,156,153,145,25,149,166,188,
+166,221,27,11,168,151,127,110,137,31,131,251,72,248,136,10,11,251,134,251,
+1,251,205,251,86,36,69,241,247,95,11,247,23,107,245,91,211,30,139,240,149,
+190,143,30,11,254,62,51,6,245,131,164,137,153,120,135,117,25,11,6,247,212,
+200,5,201,7,251,74,155,5,14,202,231,182,30,247,33,84,225,106,57,26,14,55,
+69,251,0,82,251,25,27,11,247,145,191,251,134,251,228,81,11,6,110,251,27,5,
+11,28,6,22,21,190,11,5,55,6,251,199,248,44,29,11,5,59,6,251,211,78,5,77,7,
+247,74,121,11,25,32,128,5,62,248,152,216,7,251,21,150,11,30,90,247,105,5,
+147,115,102,154,114,27,61,11,46,247,42,27,247,29,247,39,211,231,223,31,11,
+56,189,41,27,65,80,99,89,129,31,130,96,11,76,251,217,5,247,4,6,203,247,76,
+5,159,11,80,137,59,247,50,155,98,251,160,114,251,136,11,251,11,57,55,30,251,
+21,7,247,7,247,8,11,251,27,57,199,247,4,164,143,186,151,194,31,11,141,25,
+227,143,5,225,252,101,53,7,217,135,11,28,6,82,22,247,5,28,251,92,251,5,7,
+11,182,7,121,100,110,135,123,27,110,96,157,190,11,247,9,251,50,24,248,135,
+29,11,227,7,251,3,147,110,141,131,164,141,155,25,11,28,251,26,21,217,7,131,
+112,45,98,92,27,11,21,158,230,5,251,203,6,120,48,5,14,141,161,27,247,104,
+244,41,251,33,31,14,108,174,82,104,26,104,11,146,166,157,151,166,141,11,215,
+149,192,174,204,26,11,6,168,153,124,113,135,31,121,251,38,5,11,7,251,19,149,
+105,141,130,155,143,162,25,11,21,247,69,203,205,247,17,163,31,247,17,11,26,
+38,219,105,227,176,178,145,147,174,30,11,51,7,245,131,168,135,147,116,135,
+123,25,11,61,7,245,129,174,135,149,125,135,116,25,11,251,17,21,45,6,69,251,
+242,5,233,6,11,133,5,87,247,239,191,7,62,145,116,140,11,248,154,29,244,11,
+135,127,131,133,121,137,25,36,133,5,59,11,139,247,80,247,0,184,223,94,156,
+163,26,11,148,162,75,30,133,51,5,113,200,216,123,11,174,27,194,203,110,109,
+194,31,247,73,178,11,217,7,57,147,116,141,137,153,145,152,25,11,239,182,25,
+188,41,5,247,3,211,151,235,11,248,250,21,247,169,251,52,247,13,251,89,11,
+243,6,247,183,197,247,154,247,21,208,27,11,21,247,5,28,251,52,251,5,7,14,
+249,109,145,166,157,151,166,141,25,14,5,125,172,190,116,200,27,11,6,251,212,
+78,5,77,7,11,27,70,75,182,211,154,31,11,102,5,102,7,247,5,129,11,133,114,
+120,127,115,137,25,11,137,123,119,114,110,137,25,11,143,160,161,204,152,170,
+8,11,145,166,157,151,164,141,25,11,149,150,162,157,159,141,25,11,190,251,
+238,88,7,11,5,247,21,6,11,5,251,46,106,76,251,19,251,95,27,11,5,184,6,247,
+90,247,52,98,251,125,11,6,251,209,78,5,77,7,247,72,121,11,21,251,36,51,45,
+49,83,30,51,88,11,21,251,138,251,33,251,201,251,80,65,11,21,155,215,5,252,
+95,6,123,63,5,11,26,247,54,247,41,247,11,247,50,237,11,27,105,94,147,146,
+105,31,137,111,138,11,27,247,88,247,36,251,71,251,164,31,11,27,251,4,251,
+75,214,247,120,247,219,11,41,251,11,82,31,247,1,6,194,161,11,251,221,6,139,
+196,251,19,251,21,26,11,80,247,41,247,13,247,7,194,217,30,11,247,123,247,
+27,27,207,182,84,86,31,11,251,11,149,102,142,131,155,143,159,25,11,116,135,
+119,25,251,101,254,216,136,119,11,132,139,138,132,31,153,213,248,28,135,11,
+137,153,120,135,117,25,251,109,254,220,11,145,115,140,134,149,142,151,25,
+247,30,11,147,111,143,128,162,144,155,25,247,109,11,231,251,42,27,251,29,
+251,40,67,47,11,237,64,209,81,55,26,35,63,73,55,11,247,40,231,237,247,11,
+196,31,14,27,247,31,182,81,251,11,31,14,203,5,198,7,251,64,158,5,14,6,125,
+39,5,11,247,100,10,76,11,247,105,29,247,10,11,252,105,247,57,10,11,21,247,
+151,29,11,247,224,29,247,202,10,11,222,10,14,5,247,249,10,11,131,167,247,
+99,10,11,247,223,10,247,178,29,11,248,99,29,204,247,221,248,126,10,11,211,
+29,14,248,82,10,239,248,152,247,107,29,11,5,247,99,29,248,104,29,11,107,251,
+82,92,247,67,29,11,5,116,10,11,247,86,10,247,57,29,11,247,201,29,248,165,
+225,7,248,5,10,11,248,175,84,10,11,248,201,84,10,11,183,29,14,28,5,82,84,
+10,11,28,5,131,84,10,11,247,213,29,248,38,10,11,5,242,29,11,141,25,251,8,
+248,233,48,10,5,247,99,29,247,86,29,11,242,10,182,251,89,11,247,25,10,49,
+168,75,247,17,223,247,43,11,251,242,251,105,252,66,183,29,14,249,179,250,
+97,21,242,29,11,247,224,29,248,184,29,11,21,206,10,11,27,252,76,252,79,251,
+226,252,160,247,133,29,31,248,8,29,11,247,245,10,252,218,252,156,247,5,247,
+72,10,11,198,10,92,251,62,11,130,10,76,247,190,42,10,169,10,14,248,178,29,
+248,136,29,247,199,29,11,130,10,206,248,217,35,29,151,164,141,25,247,11,149,
+5,193,29,11,158,29,247,125,249,92,68,29,72,10,248,160,28,5,141,44,29,248,
+45,29,247,8,149,5,186,29,11,130,10,234,248,119,39,29,5,247,152,111,10,251,
+154,6,239,247,116,29,14,72,29,179,248,36,42,10,174,10,248,16,22,174,10,14,
+80,29,14,5,205,10,11,212,10,186,154,163,184,31,11,62,29,104,247,212,68,29,
+210,29,247,144,252,121,119,29,251,176,248,187,248,172,248,154,11,196,10,203,
+135,235,119,161,92,25,247,134,252,111,11,62,29,114,247,190,39,29,57,10,14,
+};
+#endif
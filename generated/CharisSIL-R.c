@@ -0,0 +1,6268 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_CharisSIL_R_cff_size = 134924;
+asm(".section .rodata");
+asm(".global fz_font_CharisSIL_R_cff");
+asm(".type fz_font_CharisSIL_R_cff STT_OBJECT");
+asm(".size fz_font_CharisSIL_R_cff, 134924");
+asm(".balign 64");
+asm("fz_font_CharisSIL_R_cff:");
+asm(".incbin \"resources/fonts/sil/CharisSIL-R.cff\"");
+#else
+const int fz_font_CharisSIL_R_cff_size = 134924;
+const char fz_font_CharisSIL_R_cff[] = {
+1,0,4,3,0,1,1,1,10,67,104,97,114,105,115,83,73,76,0,1,1,1,92,248,16,0,28,
+8,197,1,28,8,198,2,28,8,198,3,248,24,4,251,242,12,3,247,12,12,4,28,250,118,
+254,216,28,24,0,28,10,40,5,30,160,0,72,130,128,152,143,139,139,30,160,0,72,
+130,128,152,143,139,139,12,7,29,0,61,57,118,13,29,0,0,138,117,15,29,0,0,138,
+146,16,29,0,0,138,148,17,181,29,0,1,211,186,18,7,64,2,0,1,0,9,0,17,0,26,0,
+38,0,49,0,58,0,65,0,67,0,75,0,80,0,87,0,98,0,103,0,110,0,117,0,124,0,131,
+0,138,0,145,0,152,0,159,0,166,0,173,0,180,0,187,0,194,0,201,0,207,0,214,0,
+221,0,228,0,235,0,242,0,249,1,0,1,7,1,14,1,21,1,28,1,35,1,45,1,52,1,59,1,
+66,1,73,1,80,1,87,1,94,1,101,1,108,1,115,1,122,1,129,1,136,1,143,1,150,1,
+157,1,164,1,171,1,178,1,185,1,192,1,199,1,206,1,213,1,220,1,227,1,232,1,239,
+1,246,1,253,2,4,2,11,2,18,2,25,2,32,2,39,2,46,2,52,2,59,2,66,2,73,2,80,2,
+87,2,94,2,101,2,108,2,115,2,122,2,129,2,136,2,146,2,153,2,160,2,167,2,174,
+2,181,2,188,2,195,2,202,2,209,2,216,2,223,2,230,2,237,2,244,2,251,3,2,3,9,
+3,16,3,23,3,30,3,37,3,44,3,51,3,58,3,65,3,72,3,79,3,86,3,93,3,100,3,107,3,
+114,3,121,3,128,3,135,3,142,3,149,3,156,3,163,3,170,3,177,3,184,3,191,3,198,
+3,205,3,212,3,219,3,226,3,233,3,240,3,247,3,254,4,5,4,12,4,19,4,26,4,33,4,
+40,4,47,4,51,4,58,4,65,4,72,4,79,4,86,4,93,4,100,4,106,4,117,4,123,4,133,
+4,140,4,147,4,154,4,161,4,168,4,175,4,182,4,189,4,196,4,203,4,210,4,217,4,
+224,4,231,4,238,4,245,4,252,5,3,5,10,5,17,5,24,5,31,5,37,5,48,5,54,5,64,5,
+71,5,78,5,85,5,92,5,99,5,103,5,110,5,117,5,124,5,131,5,138,5,145,5,152,5,
+159,5,166,5,173,5,180,5,187,5,194,5,201,5,208,5,215,5,222,5,229,5,236,5,243,
+5,250,6,1,6,7,6,14,6,20,6,24,6,31,6,38,6,45,6,52,6,59,6,66,6,73,6,80,6,87,
+6,94,6,101,6,108,6,115,6,122,6,129,6,134,6,141,6,148,6,155,6,162,6,169,6,
+175,6,182,6,189,6,196,6,203,6,210,6,216,6,223,6,230,6,237,6,244,6,251,7,2,
+7,9,7,16,7,23,7,30,7,37,7,44,7,51,7,58,7,65,7,72,7,79,7,86,7,93,7,100,7,107,
+7,114,7,121,7,128,7,135,7,142,7,149,7,156,7,163,7,169,7,176,7,182,7,189,7,
+196,7,203,7,210,7,217,7,227,7,234,7,241,7,248,7,255,8,6,8,13,8,20,8,27,8,
+34,8,41,8,48,8,55,8,62,8,69,8,76,8,83,8,90,8,97,8,104,8,111,8,118,8,125,8,
+132,8,139,8,146,8,153,8,160,8,167,8,174,8,181,8,188,8,195,8,202,8,209,8,216,
+8,223,8,230,8,237,8,244,8,251,9,2,9,9,9,16,9,23,9,30,9,37,9,44,9,51,9,58,
+9,64,9,71,9,77,9,84,9,91,9,98,9,105,9,112,9,122,9,129,9,136,9,143,9,150,9,
+157,9,164,9,171,9,178,9,185,9,192,9,199,9,206,9,217,9,224,9,231,9,238,9,245,
+9,252,10,3,10,10,10,17,10,24,10,31,10,38,10,45,10,52,10,59,10,66,10,73,10,
+80,10,87,10,94,10,99,10,106,10,113,10,120,10,127,10,134,10,141,10,148,10,
+155,10,162,10,169,10,176,10,181,10,188,10,195,10,202,10,209,10,214,10,221,
+10,228,10,235,10,242,10,249,11,0,11,7,11,14,11,25,11,31,11,37,11,44,11,54,
+11,66,11,73,11,80,11,87,11,94,11,101,11,108,11,115,11,122,11,129,11,136,11,
+143,11,150,11,157,11,168,11,174,11,180,11,187,11,197,11,209,11,216,11,223,
+11,230,11,237,11,244,11,251,12,2,12,9,12,16,12,23,12,30,12,37,12,48,12,55,
+12,62,12,69,12,76,12,83,12,90,12,97,12,104,12,108,12,115,12,122,12,129,12,
+136,12,143,12,150,12,157,12,164,12,171,12,178,12,185,12,192,12,199,12,206,
+12,213,12,220,12,227,12,234,12,241,12,248,12,255,13,6,13,13,13,20,13,27,13,
+34,13,41,13,48,13,55,13,62,13,69,13,76,13,83,13,90,13,97,13,104,13,111,13,
+122,13,129,13,136,13,143,13,150,13,157,13,164,13,168,13,175,13,182,13,189,
+13,196,13,203,13,210,13,217,13,224,13,231,13,238,13,245,13,252,14,3,14,10,
+14,17,14,24,14,31,14,38,14,45,14,52,14,59,14,66,14,73,14,80,14,87,14,94,14,
+96,14,103,14,110,14,117,14,124,14,131,14,138,14,145,14,151,14,158,14,164,
+14,171,14,178,14,185,14,192,14,199,14,206,14,213,14,220,14,227,14,234,14,
+241,14,248,14,250,15,1,15,8,15,15,15,22,15,29,15,36,15,43,15,50,15,57,15,
+64,15,71,15,78,15,85,15,92,15,99,15,106,15,113,15,119,15,126,15,132,15,139,
+15,146,15,153,15,163,15,170,15,177,15,184,15,191,15,198,15,205,15,212,15,
+219,15,221,15,228,15,235,15,242,15,249,16,0,16,7,16,14,16,21,16,28,16,35,
+16,46,16,53,16,60,16,67,16,74,16,81,16,88,16,95,16,102,16,109,16,116,16,123,
+16,130,16,137,16,144,16,151,16,158,16,165,16,172,16,179,16,186,16,193,16,
+200,16,211,16,218,16,225,16,232,16,239,16,246,16,253,17,4,17,11,17,18,17,
+25,17,32,17,39,17,46,17,53,17,60,17,67,17,74,17,81,17,88,17,95,17,107,17,
+114,17,121,17,128,17,135,17,142,17,149,17,156,17,163,17,175,17,182,17,189,
+17,196,17,203,17,210,17,217,17,224,17,231,17,238,17,245,17,252,18,3,18,10,
+18,17,18,24,18,31,18,38,18,45,18,57,18,64,18,71,18,78,18,85,18,92,18,99,18,
+106,18,113,18,120,18,127,18,134,18,141,18,148,18,155,18,162,18,169,18,176,
+18,183,18,190,18,197,18,204,18,211,18,218,18,224,18,231,18,238,18,245,18,
+252,19,8,19,12,19,18,19,25,19,32,19,39,19,46,19,53,19,60,19,67,19,74,19,81,
+19,88,19,95,19,102,19,109,19,116,19,123,19,130,19,137,19,144,19,151,19,158,
+19,165,19,172,19,179,19,183,19,190,19,197,19,204,19,211,19,217,19,224,19,
+231,19,238,19,245,20,1,20,5,20,11,20,18,20,25,20,32,20,39,20,46,20,53,20,
+60,20,67,20,74,20,81,20,88,20,95,20,102,20,109,20,116,20,123,20,130,20,137,
+20,144,20,151,20,158,20,165,20,172,20,179,20,186,20,193,20,200,20,207,20,
+214,20,221,20,228,20,235,20,242,20,249,21,0,21,7,21,14,21,21,21,28,21,35,
+21,42,21,49,21,56,21,63,21,70,21,77,21,84,21,90,21,97,21,103,21,110,21,117,
+21,124,21,131,21,143,21,150,21,157,21,164,21,171,21,178,21,185,21,188,21,
+195,21,202,21,209,21,216,21,223,21,230,21,237,21,244,21,251,22,2,22,9,22,
+16,22,23,22,30,22,37,22,44,22,50,22,57,22,63,22,70,22,77,22,84,22,91,22,103,
+22,110,22,117,22,124,22,131,22,138,22,145,22,148,22,155,22,162,22,169,22,
+176,22,183,22,190,22,197,22,204,22,211,22,218,22,225,22,232,22,239,22,246,
+23,3,23,10,23,17,23,24,23,31,23,38,23,45,23,52,23,58,23,65,23,72,23,79,23,
+86,23,93,23,100,23,107,23,114,23,121,23,128,23,135,23,142,23,149,23,156,23,
+163,23,170,23,177,23,184,23,191,23,198,23,203,23,210,23,217,23,224,23,235,
+23,243,23,250,24,1,24,6,24,13,24,20,24,27,24,34,24,41,24,46,24,53,24,60,24,
+67,24,74,24,81,24,88,24,95,24,102,24,109,24,116,24,123,24,130,24,137,24,144,
+24,151,24,164,24,171,24,178,24,185,24,192,24,199,24,206,24,213,24,219,24,
+226,24,233,24,240,24,247,24,254,25,5,25,12,25,19,25,26,25,33,25,40,25,47,
+25,54,25,61,25,68,25,75,25,82,25,89,25,94,25,101,25,108,25,119,25,126,25,
+133,25,138,25,145,25,152,25,159,25,166,25,173,25,180,25,187,25,194,25,201,
+25,208,25,215,25,222,25,229,25,236,25,243,25,250,26,1,26,8,26,15,26,22,26,
+29,26,36,26,43,26,50,26,57,26,64,26,71,26,78,26,85,26,92,26,99,26,106,26,
+109,26,116,26,123,26,130,26,137,26,140,26,147,26,154,26,161,26,168,26,175,
+26,182,26,189,26,196,26,203,26,210,26,217,26,224,26,231,26,238,26,245,26,
+252,27,3,27,10,27,17,27,23,27,30,27,37,27,44,27,51,27,58,27,65,27,72,27,79,
+27,86,27,93,27,100,27,107,27,114,27,121,27,128,27,135,27,142,27,149,27,156,
+27,163,27,169,27,176,27,183,27,189,27,196,27,203,27,210,27,217,27,229,27,
+236,27,243,27,250,28,1,28,8,28,15,28,22,28,29,28,36,28,43,28,50,28,57,28,
+64,28,71,28,78,28,85,28,92,28,99,28,106,28,113,28,120,28,127,28,134,28,141,
+28,147,28,154,28,161,28,167,28,174,28,181,28,188,28,195,28,207,28,214,28,
+221,28,228,28,235,28,242,28,249,29,0,29,7,29,14,29,21,29,28,29,35,29,42,29,
+49,29,56,29,63,29,70,29,77,29,84,29,91,29,98,29,105,29,112,29,119,29,125,
+29,132,29,143,29,150,29,157,29,164,29,171,29,178,29,186,29,193,29,200,29,
+207,29,214,29,221,29,228,29,235,29,242,29,249,30,0,30,7,30,14,30,21,30,28,
+30,35,30,41,30,48,30,59,30,66,30,73,30,80,30,87,30,94,30,102,30,109,30,116,
+30,123,30,130,30,137,30,144,30,151,30,158,30,165,30,172,30,179,30,186,30,
+193,30,200,30,206,30,213,30,220,30,227,30,231,30,238,30,245,30,252,31,3,31,
+10,31,17,31,24,31,31,31,38,31,45,31,52,31,59,31,66,31,73,31,80,31,87,31,94,
+31,101,31,108,31,115,31,121,31,128,31,135,31,142,31,149,31,156,31,163,31,
+170,31,174,31,181,31,188,31,195,31,202,31,209,31,216,31,223,31,230,31,237,
+31,244,31,251,32,2,32,9,32,16,32,23,32,36,32,43,32,50,32,56,32,63,32,69,32,
+76,32,83,32,90,32,97,32,104,32,111,32,118,32,123,32,130,32,137,32,144,32,
+151,32,158,32,165,32,172,32,179,32,186,32,191,32,198,32,205,32,212,32,219,
+32,226,32,233,32,240,32,247,32,254,33,5,33,12,33,19,33,26,33,33,33,40,33,
+47,33,54,33,61,33,74,33,81,33,88,33,94,33,101,33,107,33,114,33,121,33,128,
+33,135,33,142,33,149,33,156,33,161,33,168,33,175,33,182,33,189,33,196,33,
+203,33,210,33,217,33,222,33,229,33,236,33,243,33,250,34,1,34,8,34,15,34,22,
+34,29,34,36,34,43,34,50,34,57,34,64,34,71,34,78,34,85,34,92,34,99,34,106,
+34,113,34,120,34,127,34,134,34,141,34,148,34,155,34,162,34,169,34,176,34,
+183,34,188,34,195,34,202,34,209,34,216,34,223,34,230,34,237,34,244,34,251,
+35,2,35,9,35,16,35,23,35,30,35,37,35,44,35,51,35,57,35,63,35,74,35,83,35,
+90,35,97,35,104,35,111,35,118,35,125,35,130,35,137,35,144,35,151,35,158,35,
+164,35,170,35,181,35,190,35,197,35,204,35,211,35,218,35,225,35,232,35,239,
+35,246,35,253,36,4,36,11,36,18,36,25,36,32,36,39,36,46,36,53,36,56,36,63,
+36,70,36,77,36,84,36,91,36,98,36,105,36,112,36,119,36,126,36,133,36,140,36,
+147,36,154,36,160,36,171,36,178,36,185,36,192,36,199,36,206,36,213,36,220,
+36,227,36,234,36,241,36,248,36,255,37,6,37,13,37,20,37,26,37,33,37,40,37,
+47,37,54,37,61,37,68,37,75,37,82,37,89,37,95,37,106,37,113,37,120,37,127,
+37,134,37,141,37,148,37,155,37,162,37,169,37,176,37,183,37,190,37,197,37,
+204,37,211,37,218,37,225,37,232,37,239,37,246,37,249,38,0,38,7,38,13,38,20,
+38,30,38,37,38,44,38,51,38,58,38,65,38,72,38,79,38,86,38,93,38,100,38,107,
+38,114,38,121,38,128,38,134,38,141,38,151,38,158,38,165,38,172,38,179,38,
+186,38,193,38,200,38,207,38,214,38,221,38,228,38,235,38,242,38,249,39,0,39,
+7,39,14,39,21,39,28,39,35,39,42,39,49,39,56,39,63,39,70,39,77,39,84,39,91,
+39,98,39,105,39,112,39,119,39,126,39,133,39,140,39,147,39,154,39,161,39,168,
+39,175,39,182,39,189,39,196,39,203,39,210,39,217,39,224,39,231,39,238,39,
+245,39,252,40,3,40,10,40,17,40,24,40,31,40,38,40,45,40,52,40,59,40,66,40,
+73,40,80,40,87,40,94,40,101,40,108,40,115,40,122,40,129,40,136,40,143,40,
+150,40,157,40,164,40,171,40,178,40,185,40,192,40,199,40,206,40,213,40,220,
+40,227,40,234,40,241,40,248,40,255,41,6,41,15,41,22,41,29,41,36,41,43,41,
+50,41,57,41,70,41,77,41,84,41,91,41,98,41,105,41,112,41,119,41,128,41,135,
+41,142,41,149,41,156,41,163,41,170,41,177,41,184,41,191,41,198,41,205,41,
+212,41,219,41,226,41,233,41,240,41,247,41,254,42,5,42,12,42,19,42,26,42,33,
+42,40,42,47,42,54,42,61,42,68,42,75,42,82,42,89,42,96,42,103,42,110,42,117,
+42,124,42,131,42,138,42,145,42,152,42,159,42,166,42,173,42,180,42,187,42,
+194,42,201,42,208,42,215,42,222,42,229,42,236,42,243,42,250,43,1,43,8,43,
+15,43,22,43,29,43,36,43,43,43,50,43,57,43,64,43,71,43,78,43,85,43,92,43,99,
+43,106,43,113,43,122,43,128,43,135,43,141,43,148,43,155,43,162,43,169,43,
+176,43,183,43,190,43,197,43,204,43,213,43,220,43,227,43,234,43,241,43,248,
+43,255,44,6,44,13,44,20,44,27,44,34,44,41,44,48,44,55,44,62,44,69,44,76,44,
+83,44,90,44,97,44,104,44,111,44,118,44,125,44,132,44,139,44,146,44,153,44,
+160,44,167,44,174,44,181,44,188,44,195,44,202,44,209,44,216,44,223,44,232,
+44,239,44,246,44,253,45,4,45,11,45,18,45,25,45,32,45,39,45,46,45,53,45,60,
+45,67,45,74,45,81,45,88,45,95,45,102,45,109,45,116,45,123,45,130,45,137,45,
+144,45,151,45,164,45,171,45,178,45,185,45,192,45,199,45,206,45,213,45,220,
+45,231,45,238,45,245,45,252,46,8,46,15,46,22,46,29,46,36,46,43,46,50,46,57,
+46,64,46,71,46,78,46,85,46,92,46,99,46,106,46,113,46,120,46,127,46,134,46,
+141,46,148,46,155,46,162,46,175,46,182,46,189,46,196,46,203,46,210,46,217,
+46,224,46,231,46,238,46,245,46,252,47,3,47,10,47,17,47,24,47,31,47,38,47,
+45,47,52,47,59,47,66,47,73,47,80,47,87,47,94,47,101,47,108,47,115,47,122,
+47,129,47,136,47,143,47,150,47,157,47,164,47,171,47,178,47,185,47,192,47,
+199,47,206,47,213,47,220,47,227,47,234,47,241,47,248,47,255,48,6,48,13,48,
+20,48,27,48,34,48,41,48,48,48,55,48,62,48,69,48,78,48,85,48,92,48,99,48,106,
+48,113,48,122,48,134,48,143,48,150,48,157,48,164,48,174,48,181,48,188,48,
+195,48,204,48,211,48,218,48,225,48,237,48,247,48,254,49,10,49,23,49,35,49,
+42,49,49,49,56,49,63,49,70,49,77,49,84,49,91,49,98,49,105,49,112,49,119,49,
+126,49,135,49,142,49,149,49,156,49,163,49,173,49,180,49,187,49,194,49,201,
+49,208,49,215,49,222,49,229,49,236,49,243,49,250,50,1,50,8,50,15,50,22,50,
+29,50,36,50,43,50,50,50,57,50,64,50,71,50,78,50,85,50,92,50,99,50,106,50,
+113,50,120,50,127,50,134,50,141,50,148,50,155,50,162,50,169,50,176,50,183,
+50,190,50,197,50,204,50,211,50,218,50,225,50,232,50,239,50,246,50,253,51,
+4,51,11,51,18,51,25,51,32,51,39,51,41,51,84,51,94,110,111,116,101,113,117,
+97,108,105,110,102,105,110,105,116,121,108,101,115,115,101,113,117,97,108,
+103,114,101,97,116,101,114,101,113,117,97,108,112,97,114,116,105,97,108,100,
+105,102,102,115,117,109,109,97,116,105,111,110,112,114,111,100,117,99,116,
+112,105,105,110,116,101,103,114,97,108,79,109,101,103,97,114,97,100,105,99,
+97,108,97,112,112,114,111,120,101,113,117,97,108,68,101,108,116,97,117,110,
+105,48,48,65,48,108,111,122,101,110,103,101,117,110,105,50,53,67,67,117,110,
+105,48,52,51,48,117,110,105,50,48,57,48,117,110,105,49,68,52,51,117,110,105,
+48,51,54,51,117,110,105,48,50,48,49,117,110,105,49,69,65,68,117,110,105,49,
+69,65,53,117,110,105,49,69,65,55,117,110,105,49,69,65,66,117,110,105,49,69,
+65,57,117,110,105,48,50,48,51,97,98,114,101,118,101,117,110,105,49,69,66,
+55,117,110,105,49,69,65,70,117,110,105,49,69,66,49,117,110,105,49,69,66,53,
+117,110,105,49,69,66,51,117,110,105,48,52,68,49,117,110,105,48,49,67,69,97,
+109,97,99,114,111,110,117,110,105,48,52,68,51,117,110,105,48,49,68,70,117,
+110,105,48,50,50,55,117,110,105,48,49,69,49,97,114,105,110,103,97,99,117,
+116,101,117,110,105,49,69,57,65,117,110,105,49,69,65,51,117,110,105,49,69,
+65,49,117,110,105,49,69,48,49,97,111,103,111,110,101,107,117,110,105,49,68,
+56,70,117,110,105,50,67,54,53,117,110,105,65,55,51,51,117,110,105,65,55,51,
+53,117,110,105,65,55,51,55,117,110,105,65,55,51,57,117,110,105,65,55,51,66,
+117,110,105,65,55,51,68,117,110,105,48,50,53,48,117,110,105,49,68,52,52,117,
+110,105,48,50,53,49,117,110,105,49,68,52,53,117,110,105,49,68,57,48,117,110,
+105,65,66,54,52,117,110,105,48,50,53,50,117,110,105,49,68,57,66,117,110,105,
+48,52,68,53,97,101,97,99,117,116,101,117,110,105,48,49,69,51,117,110,105,
+49,68,48,50,117,110,105,49,68,52,54,97,108,112,104,97,117,110,105,48,52,49,
+48,117,110,105,49,68,50,67,117,110,105,49,68,48,48,117,110,105,48,50,48,48,
+117,110,105,49,69,65,52,117,110,105,49,69,65,54,117,110,105,49,69,65,65,117,
+110,105,49,69,65,56,117,110,105,49,69,65,67,117,110,105,48,50,48,50,65,98,
+114,101,118,101,117,110,105,49,69,65,69,117,110,105,49,69,66,48,117,110,105,
+49,69,66,52,117,110,105,49,69,66,50,117,110,105,49,69,66,54,117,110,105,48,
+52,68,48,117,110,105,48,49,67,68,65,109,97,99,114,111,110,117,110,105,48,
+52,68,50,117,110,105,48,49,68,69,117,110,105,48,50,50,54,117,110,105,48,49,
+69,48,65,114,105,110,103,97,99,117,116,101,117,110,105,49,69,65,50,117,110,
+105,49,69,65,48,117,110,105,49,69,48,48,65,111,103,111,110,101,107,117,110,
+105,48,50,51,65,117,110,105,50,67,54,70,117,110,105,65,55,51,52,117,110,105,
+65,55,51,50,117,110,105,65,55,51,54,117,110,105,65,55,51,56,117,110,105,65,
+55,51,65,117,110,105,65,55,51,67,117,110,105,50,48,66,51,117,110,105,50,67,
+54,68,117,110,105,50,67,55,48,117,110,105,48,52,68,52,117,110,105,49,68,50,
+68,117,110,105,49,68,48,49,65,69,97,99,117,116,101,117,110,105,48,49,69,50,
+117,110,105,49,68,52,55,117,110,105,49,69,48,51,117,110,105,49,69,48,55,117,
+110,105,49,69,48,53,117,110,105,49,68,56,48,117,110,105,48,49,56,48,117,110,
+105,49,68,54,67,117,110,105,48,50,53,51,117,110,105,65,55,57,55,117,110,105,
+48,49,56,53,117,110,105,48,49,56,51,117,110,105,48,52,51,49,117,110,105,48,
+52,52,67,117,110,105,48,52,56,68,117,110,105,48,52,52,65,117,110,105,48,52,
+54,51,117,110,105,48,52,52,66,117,110,105,48,52,70,57,117,110,105,48,52,51,
+50,117,110,105,48,52,49,50,117,110,105,49,68,50,69,117,110,105,48,50,57,57,
+117,110,105,49,69,48,50,117,110,105,49,69,48,54,117,110,105,49,69,48,52,117,
+110,105,48,50,52,51,117,110,105,49,68,50,70,117,110,105,49,68,48,51,117,110,
+105,48,49,56,49,117,110,105,65,55,57,54,117,110,105,48,49,56,52,117,110,105,
+48,49,56,50,117,110,105,48,52,49,49,117,110,105,48,52,50,67,117,110,105,48,
+52,56,67,117,110,105,48,52,50,65,117,110,105,48,52,54,50,117,110,105,48,52,
+50,66,117,110,105,48,52,70,56,98,101,116,97,117,110,105,49,68,54,54,117,110,
+105,49,68,53,68,117,110,105,49,69,57,69,117,110,105,48,52,52,49,117,110,105,
+50,49,55,68,117,110,105,49,68,57,67,117,110,105,48,51,54,56,99,97,99,117,
+116,101,99,99,105,114,99,117,109,102,108,101,120,99,99,97,114,111,110,99,
+100,111,116,97,99,99,101,110,116,117,110,105,49,69,48,57,117,110,105,48,52,
+65,66,117,110,105,65,55,57,52,117,110,105,65,55,57,51,117,110,105,48,50,51,
+67,117,110,105,48,50,57,55,117,110,105,48,49,56,56,117,110,105,48,50,53,53,
+117,110,105,49,68,57,68,117,110,105,48,50,53,52,117,110,105,49,68,53,51,117,
+110,105,49,68,57,55,117,110,105,50,67,55,65,117,110,105,50,49,56,52,117,110,
+105,65,55,51,70,117,110,105,49,68,49,50,117,110,105,48,52,53,52,117,110,105,
+48,52,52,68,117,110,105,48,52,69,68,117,110,105,48,52,50,49,117,110,105,50,
+49,54,68,117,110,105,49,68,48,52,67,97,99,117,116,101,67,99,105,114,99,117,
+109,102,108,101,120,67,99,97,114,111,110,67,100,111,116,97,99,99,101,110,
+116,117,110,105,49,69,48,56,117,110,105,48,52,65,65,117,110,105,65,55,57,
+50,117,110,105,48,50,51,66,117,110,105,48,49,56,55,69,117,114,111,117,110,
+105,50,48,65,48,117,110,105,50,48,65,50,117,110,105,50,48,66,53,117,110,105,
+50,49,56,53,117,110,105,50,49,50,68,117,110,105,50,67,56,56,117,110,105,48,
+49,56,54,117,110,105,49,68,49,48,117,110,105,50,49,56,51,117,110,105,65,55,
+51,69,117,110,105,48,52,48,52,117,110,105,48,52,50,68,117,110,105,48,52,69,
+67,117,110,105,48,53,48,49,117,110,105,50,49,55,69,117,110,105,49,68,52,56,
+117,110,105,48,51,54,57,117,110,105,49,69,48,66,117,110,105,49,69,49,51,117,
+110,105,49,69,48,70,117,110,105,49,69,48,68,117,110,105,49,69,49,49,100,99,
+97,114,111,110,117,110,105,49,68,56,49,100,99,114,111,97,116,100,111,110,
+103,117,110,105,49,68,54,68,117,110,105,65,55,55,49,117,110,105,48,50,53,
+55,117,110,105,48,50,53,54,117,110,105,49,68,57,49,117,110,105,48,50,50,49,
+117,110,105,48,49,56,67,117,110,105,48,50,51,56,117,110,105,48,49,70,51,117,
+110,105,48,49,67,54,117,110,105,48,50,65,51,117,110,105,48,50,65,53,117,110,
+105,48,50,65,52,117,110,105,48,53,48,51,117,110,105,49,69,57,70,100,101,108,
+116,97,117,110,105,49,68,53,70,117,110,105,49,68,57,69,117,110,105,50,49,
+54,69,117,110,105,49,68,51,48,117,110,105,49,68,48,53,68,99,97,114,111,110,
+117,110,105,49,69,48,65,117,110,105,49,69,49,50,117,110,105,49,69,48,69,117,
+110,105,49,69,48,67,117,110,105,49,69,49,48,68,99,114,111,97,116,117,110,
+105,48,49,56,57,117,110,105,49,68,48,54,117,110,105,48,49,56,65,117,110,105,
+48,49,56,66,117,110,105,48,49,70,50,117,110,105,48,49,67,53,117,110,105,48,
+49,70,49,117,110,105,48,49,67,52,117,110,105,48,53,48,48,117,110,105,48,53,
+48,50,117,110,105,48,51,57,52,117,110,105,50,49,56,49,117,110,105,50,49,56,
+48,117,110,105,50,49,56,50,117,110,105,50,49,56,55,117,110,105,50,49,56,56,
+117,110,105,50,48,65,70,117,110,105,48,52,51,53,117,110,105,50,48,57,49,117,
+110,105,49,68,52,57,117,110,105,48,51,54,52,117,110,105,48,52,53,48,117,110,
+105,48,50,48,53,117,110,105,49,69,66,70,117,110,105,49,69,67,49,117,110,105,
+49,69,67,53,117,110,105,49,69,67,51,117,110,105,49,69,67,55,117,110,105,48,
+50,48,55,101,98,114,101,118,101,117,110,105,48,52,68,55,101,99,97,114,111,
+110,117,110,105,49,69,66,68,101,109,97,99,114,111,110,117,110,105,49,69,49,
+55,117,110,105,49,69,49,53,117,110,105,48,52,53,49,101,100,111,116,97,99,
+99,101,110,116,117,110,105,49,69,66,66,117,110,105,49,69,49,57,117,110,105,
+49,69,49,66,117,110,105,49,69,66,57,117,110,105,50,67,55,56,117,110,105,48,
+50,50,57,117,110,105,49,69,49,68,101,111,103,111,110,101,107,117,110,105,
+49,68,57,50,117,110,105,48,50,52,55,117,110,105,48,52,66,68,117,110,105,48,
+52,66,70,117,110,105,48,49,68,68,117,110,105,48,50,53,57,117,110,105,48,52,
+68,57,117,110,105,50,48,57,52,117,110,105,49,68,52,65,117,110,105,48,52,68,
+66,117,110,105,49,68,57,53,117,110,105,48,50,53,65,117,110,105,48,50,53,56,
+117,110,105,48,50,53,66,117,110,105,49,68,52,66,117,110,105,49,68,57,51,117,
+110,105,48,50,53,67,117,110,105,49,68,57,70,117,110,105,49,68,57,52,117,110,
+105,48,50,53,68,117,110,105,49,68,48,56,117,110,105,49,68,52,67,117,110,105,
+48,50,57,65,117,110,105,48,50,53,69,117,110,105,48,53,49,49,117,110,105,48,
+52,51,55,117,110,105,48,52,68,70,117,110,105,48,52,57,57,117,110,105,48,53,
+48,55,117,110,105,48,53,48,53,117,110,105,48,52,49,53,117,110,105,49,68,51,
+49,117,110,105,49,68,48,55,117,110,105,48,52,48,48,117,110,105,48,50,48,52,
+117,110,105,49,69,66,69,117,110,105,49,69,67,48,117,110,105,49,69,67,52,117,
+110,105,49,69,67,50,117,110,105,49,69,67,54,117,110,105,48,50,48,54,69,98,
+114,101,118,101,117,110,105,48,52,68,54,69,99,97,114,111,110,117,110,105,
+49,69,66,67,69,109,97,99,114,111,110,117,110,105,49,69,49,54,117,110,105,
+49,69,49,52,117,110,105,48,52,48,49,69,100,111,116,97,99,99,101,110,116,117,
+110,105,49,69,66,65,117,110,105,49,69,49,56,117,110,105,49,69,49,65,117,110,
+105,49,69,66,56,117,110,105,48,50,50,56,117,110,105,49,69,49,67,69,111,103,
+111,110,101,107,117,110,105,48,50,52,54,117,110,105,50,67,55,66,117,110,105,
+48,52,66,67,117,110,105,48,52,66,69,117,110,105,48,49,56,69,101,120,105,115,
+116,101,110,116,105,97,108,117,110,105,50,50,48,52,117,110,105,49,68,51,50,
+117,110,105,48,49,56,70,117,110,105,48,52,68,56,117,110,105,48,52,68,65,117,
+110,105,48,49,57,48,117,110,105,65,55,65,66,117,110,105,48,53,49,48,117,110,
+105,48,52,49,55,117,110,105,48,52,68,69,117,110,105,48,52,57,56,117,110,105,
+48,53,48,54,117,110,105,48,53,48,52,117,110,105,49,68,65,48,117,110,105,49,
+69,49,70,117,110,105,49,68,56,50,117,110,105,49,68,54,69,117,110,105,65,55,
+57,57,117,110,105,48,50,65,57,108,111,110,103,115,117,110,105,49,69,57,66,
+117,110,105,49,69,57,68,117,110,105,49,69,57,67,117,110,105,48,52,51,51,117,
+110,105,48,52,53,51,117,110,105,48,52,57,49,117,110,105,48,52,70,55,117,110,
+105,48,52,57,51,117,110,105,48,52,70,66,117,110,105,65,55,51,48,117,110,105,
+49,69,49,69,102,114,97,110,99,117,110,105,48,49,57,49,117,110,105,65,55,57,
+56,117,110,105,65,55,70,66,117,110,105,48,52,49,51,71,97,109,109,97,117,110,
+105,49,68,50,54,117,110,105,48,52,48,51,117,110,105,48,52,57,48,117,110,105,
+48,52,70,54,117,110,105,48,52,57,50,117,110,105,48,52,70,65,117,110,105,49,
+68,52,68,117,110,105,48,49,70,53,103,99,105,114,99,117,109,102,108,101,120,
+103,98,114,101,118,101,103,99,97,114,111,110,117,110,105,49,69,50,49,103,
+100,111,116,97,99,99,101,110,116,103,99,111,109,109,97,97,99,99,101,110,116,
+117,110,105,48,49,69,53,117,110,105,65,55,65,49,117,110,105,48,50,54,49,117,
+110,105,49,68,65,50,117,110,105,49,68,56,51,117,110,105,48,50,54,48,117,110,
+105,49,68,55,55,117,110,105,49,68,55,57,117,110,105,65,55,55,70,117,110,105,
+48,53,48,68,117,110,105,49,68,51,51,117,110,105,48,50,54,50,117,110,105,48,
+49,70,52,71,99,105,114,99,117,109,102,108,101,120,71,98,114,101,118,101,71,
+99,97,114,111,110,117,110,105,49,69,50,48,71,100,111,116,97,99,99,101,110,
+116,71,99,111,109,109,97,97,99,99,101,110,116,117,110,105,48,49,69,52,117,
+110,105,65,55,65,48,117,110,105,48,49,57,51,117,110,105,48,50,57,66,117,110,
+105,65,55,65,67,117,110,105,50,48,66,50,117,110,105,65,55,55,68,117,110,105,
+65,55,55,69,117,110,105,48,53,48,67,117,110,105,50,48,57,53,117,110,105,48,
+50,66,48,117,110,105,48,51,54,65,104,99,105,114,99,117,109,102,108,101,120,
+117,110,105,48,50,49,70,117,110,105,49,69,50,55,117,110,105,49,69,50,51,117,
+110,105,49,69,50,66,117,110,105,49,69,57,54,117,110,105,49,69,50,53,117,110,
+105,49,69,50,57,117,110,105,65,55,57,53,104,98,97,114,117,110,105,48,52,53,
+66,117,110,105,48,52,53,50,117,110,105,48,50,54,54,117,110,105,48,50,66,49,
+117,110,105,65,55,50,55,117,110,105,48,50,54,55,117,110,105,50,67,54,56,117,
+110,105,48,49,57,53,117,110,105,50,67,55,54,117,110,105,48,50,54,53,117,110,
+105,49,68,65,51,117,110,105,48,50,65,69,117,110,105,48,50,65,70,117,110,105,
+48,52,66,66,117,110,105,48,52,57,53,117,110,105,48,53,50,55,117,110,105,48,
+52,51,68,117,110,105,48,52,65,53,117,110,105,48,52,65,51,117,110,105,48,52,
+67,65,117,110,105,48,52,53,65,117,110,105,48,52,67,56,117,110,105,48,53,50,
+57,117,110,105,48,53,48,66,117,110,105,48,53,50,51,117,110,105,48,52,51,70,
+117,110,105,48,53,50,53,117,110,105,48,52,65,55,117,110,105,48,52,53,70,117,
+110,105,48,52,52,54,117,110,105,48,52,52,56,117,110,105,48,52,52,57,117,110,
+105,49,68,50,56,117,110,105,48,52,49,68,117,110,105,49,68,51,52,117,110,105,
+49,68,55,56,117,110,105,48,50,57,67,72,99,105,114,99,117,109,102,108,101,
+120,117,110,105,48,50,49,69,117,110,105,49,69,50,54,117,110,105,49,69,50,
+50,117,110,105,49,69,50,65,117,110,105,49,69,50,52,117,110,105,49,69,50,56,
+72,98,97,114,117,110,105,65,55,70,56,117,110,105,65,55,65,65,117,110,105,
+65,55,50,54,117,110,105,50,67,54,55,117,110,105,48,49,70,54,117,110,105,50,
+67,55,53,117,110,105,50,49,48,67,117,110,105,48,53,50,56,117,110,105,65,55,
+56,68,117,110,105,48,52,66,65,117,110,105,48,52,57,52,117,110,105,48,53,50,
+54,117,110,105,48,52,65,52,117,110,105,48,52,65,50,117,110,105,48,52,67,57,
+117,110,105,48,52,48,65,117,110,105,48,52,67,55,117,110,105,48,53,48,65,117,
+110,105,48,53,50,50,117,110,105,48,52,49,70,117,110,105,48,53,50,52,117,110,
+105,48,52,65,54,117,110,105,48,52,48,70,117,110,105,48,52,50,54,117,110,105,
+48,52,50,56,117,110,105,48,52,50,57,80,105,117,110,105,48,52,53,54,117,110,
+105,50,49,55,48,117,110,105,49,68,54,50,117,110,105,50,48,55,49,117,110,105,
+48,51,54,53,117,110,105,48,50,48,57,117,110,105,48,50,48,66,105,98,114,101,
+118,101,117,110,105,48,49,68,48,105,116,105,108,100,101,105,109,97,99,114,
+111,110,117,110,105,48,52,53,55,117,110,105,49,69,50,70,117,110,105,49,69,
+67,57,117,110,105,49,69,50,68,117,110,105,49,69,67,66,105,111,103,111,110,
+101,107,117,110,105,49,68,57,54,117,110,105,48,50,54,56,117,110,105,49,68,
+65,52,117,110,105,49,68,48,57,117,110,105,49,68,52,69,105,106,117,110,105,
+50,49,55,49,117,110,105,50,49,55,50,117,110,105,50,49,55,51,117,110,105,50,
+49,55,56,117,110,105,48,50,54,57,117,110,105,49,68,65,53,117,110,105,49,68,
+55,67,117,110,105,48,52,52,69,117,110,105,48,52,48,54,117,110,105,48,52,67,
+48,117,110,105,48,52,67,70,117,110,105,50,49,54,48,117,110,105,49,68,51,53,
+117,110,105,48,50,54,65,117,110,105,49,68,65,54,117,110,105,48,50,48,56,117,
+110,105,48,50,48,65,73,98,114,101,118,101,117,110,105,48,49,67,70,73,116,
+105,108,100,101,73,109,97,99,114,111,110,117,110,105,48,52,48,55,117,110,
+105,49,69,50,69,73,100,111,116,97,99,99,101,110,116,117,110,105,49,69,67,
+56,117,110,105,49,69,50,67,117,110,105,49,69,67,65,73,111,103,111,110,101,
+107,117,110,105,48,49,57,55,117,110,105,49,68,55,66,117,110,105,49,68,65,
+55,117,110,105,65,55,70,69,73,74,117,110,105,50,49,54,49,117,110,105,50,49,
+54,50,117,110,105,50,49,54,51,117,110,105,50,49,54,56,117,110,105,48,49,57,
+54,117,110,105,48,52,50,69,117,110,105,65,55,70,55,117,110,105,48,52,53,56,
+117,110,105,50,67,55,67,117,110,105,48,50,66,50,106,99,105,114,99,117,109,
+102,108,101,120,117,110,105,48,49,70,48,117,110,105,48,50,52,57,117,110,105,
+48,50,57,68,117,110,105,49,68,65,56,117,110,105,48,50,51,55,117,110,105,48,
+50,53,70,117,110,105,49,68,65,49,117,110,105,48,50,56,52,117,110,105,65,55,
+54,68,117,110,105,48,52,51,66,117,110,105,48,53,50,70,117,110,105,48,52,67,
+54,117,110,105,48,52,53,57,117,110,105,48,53,49,51,117,110,105,48,53,48,57,
+117,110,105,48,53,50,49,117,110,105,48,52,51,52,117,110,105,48,53,50,66,117,
+110,105,48,53,49,53,117,110,105,48,52,48,56,117,110,105,49,68,51,54,117,110,
+105,49,68,48,65,74,99,105,114,99,117,109,102,108,101,120,117,110,105,48,50,
+52,56,117,110,105,65,55,66,50,117,110,105,65,55,54,67,117,110,105,48,52,49,
+66,117,110,105,49,68,50,66,117,110,105,48,53,50,69,117,110,105,48,52,67,53,
+117,110,105,48,52,48,57,117,110,105,48,53,49,50,117,110,105,48,53,48,56,117,
+110,105,48,53,50,48,117,110,105,48,53,49,52,117,110,105,48,52,49,52,117,110,
+105,48,53,50,65,117,110,105,50,48,57,54,117,110,105,49,68,52,70,117,110,105,
+49,69,51,49,117,110,105,48,49,69,57,117,110,105,49,69,51,53,117,110,105,49,
+69,51,51,107,99,111,109,109,97,97,99,99,101,110,116,117,110,105,49,68,56,
+52,117,110,105,65,55,52,49,117,110,105,65,55,52,53,117,110,105,65,55,52,51,
+117,110,105,65,55,65,51,117,110,105,48,49,57,57,117,110,105,50,67,54,65,117,
+110,105,48,50,57,69,107,103,114,101,101,110,108,97,110,100,105,99,117,110,
+105,48,52,51,65,117,110,105,48,52,53,67,117,110,105,48,52,57,66,117,110,105,
+48,52,65,49,117,110,105,48,52,57,70,117,110,105,48,52,57,68,117,110,105,48,
+52,67,52,117,110,105,48,53,49,70,117,110,105,48,52,51,54,117,110,105,48,52,
+67,50,117,110,105,48,52,68,68,117,110,105,48,52,57,55,117,110,105,49,68,51,
+55,117,110,105,49,68,48,66,117,110,105,49,69,51,48,117,110,105,48,49,69,56,
+117,110,105,49,69,51,52,117,110,105,49,69,51,50,75,99,111,109,109,97,97,99,
+99,101,110,116,117,110,105,65,55,52,48,117,110,105,65,55,52,52,117,110,105,
+65,55,52,50,117,110,105,65,55,65,50,117,110,105,48,49,57,56,117,110,105,50,
+67,54,57,117,110,105,65,55,66,48,117,110,105,50,48,65,68,117,110,105,48,52,
+49,65,117,110,105,48,52,48,67,117,110,105,48,52,57,65,117,110,105,48,52,65,
+48,117,110,105,48,52,57,69,117,110,105,48,52,57,67,117,110,105,48,52,67,51,
+117,110,105,48,53,49,69,117,110,105,48,52,49,54,117,110,105,48,52,67,49,117,
+110,105,48,52,68,67,117,110,105,48,52,57,54,117,110,105,50,49,55,67,117,110,
+105,50,48,57,55,117,110,105,48,50,69,49,108,97,99,117,116,101,117,110,105,
+49,69,51,68,117,110,105,49,69,51,66,117,110,105,49,69,51,55,117,110,105,49,
+69,51,57,108,99,111,109,109,97,97,99,99,101,110,116,108,100,111,116,108,99,
+97,114,111,110,117,110,105,49,68,56,53,117,110,105,49,68,65,65,117,110,105,
+48,49,57,65,117,110,105,65,55,52,57,117,110,105,50,67,54,49,117,110,105,48,
+50,54,66,117,110,105,48,50,54,68,117,110,105,49,68,65,57,117,110,105,48,50,
+51,52,117,110,105,48,50,54,67,117,110,105,65,55,56,69,117,110,105,65,55,52,
+55,117,110,105,65,55,56,49,117,110,105,65,55,55,50,117,110,105,48,49,67,57,
+117,110,105,49,69,70,66,117,110,105,48,50,65,65,117,110,105,50,48,66,54,117,
+110,105,50,48,66,65,117,110,105,48,50,65,66,117,110,105,48,50,54,69,117,110,
+105,50,49,49,51,117,110,105,50,48,66,48,108,105,114,97,117,110,105,50,49,
+54,67,117,110,105,49,68,51,56,117,110,105,48,50,57,70,117,110,105,49,68,65,
+66,76,97,99,117,116,101,117,110,105,49,69,51,67,117,110,105,49,69,51,65,117,
+110,105,49,69,51,54,117,110,105,49,69,51,56,76,99,111,109,109,97,97,99,99,
+101,110,116,76,100,111,116,76,99,97,114,111,110,117,110,105,48,50,51,68,117,
+110,105,65,55,52,56,117,110,105,50,67,54,48,117,110,105,50,67,54,50,117,110,
+105,49,68,48,67,117,110,105,65,55,65,68,117,110,105,65,55,52,54,117,110,105,
+65,55,56,48,117,110,105,48,49,67,56,117,110,105,48,49,67,55,117,110,105,49,
+69,70,65,117,110,105,50,49,55,70,117,110,105,50,48,57,56,117,110,105,49,68,
+53,48,117,110,105,48,51,54,66,117,110,105,49,69,51,70,117,110,105,49,69,52,
+49,117,110,105,49,69,52,51,117,110,105,49,68,56,54,117,110,105,49,68,54,70,
+117,110,105,50,48,65,53,117,110,105,65,55,55,51,117,110,105,48,50,55,49,117,
+110,105,49,68,65,67,117,110,105,48,50,54,70,117,110,105,49,68,53,65,117,110,
+105,48,50,55,48,117,110,105,49,68,65,68,117,110,105,49,68,49,70,117,110,105,
+48,52,51,67,117,110,105,48,52,67,69,117,110,105,48,52,49,67,117,110,105,50,
+49,54,70,117,110,105,49,68,51,57,117,110,105,49,68,48,68,117,110,105,49,69,
+51,69,117,110,105,49,69,52,48,117,110,105,49,69,52,50,117,110,105,50,67,54,
+69,117,110,105,65,55,70,65,117,110,105,48,49,57,67,117,110,105,65,55,70,68,
+117,110,105,65,55,70,70,117,110,105,48,52,67,68,117,110,105,50,49,51,53,117,
+110,105,50,48,57,57,117,110,105,50,48,55,70,110,97,99,117,116,101,117,110,
+105,48,49,70,57,110,99,97,114,111,110,117,110,105,49,69,52,53,117,110,105,
+49,69,52,66,117,110,105,49,69,52,57,117,110,105,49,69,52,55,110,99,111,109,
+109,97,97,99,99,101,110,116,117,110,105,49,68,56,55,117,110,105,49,68,55,
+48,117,110,105,65,55,65,53,117,110,105,65,55,55,52,117,110,105,48,50,55,50,
+117,110,105,49,68,65,69,101,110,103,117,110,105,49,68,53,49,117,110,105,48,
+50,55,51,117,110,105,49,68,65,70,117,110,105,48,50,51,53,117,110,105,65,55,
+57,49,117,110,105,48,49,57,69,117,110,105,48,49,67,67,117,110,105,48,52,51,
+56,117,110,105,48,52,53,68,117,110,105,48,52,51,57,117,110,105,48,52,56,66,
+117,110,105,48,52,69,51,117,110,105,48,52,69,53,117,110,105,49,68,51,65,117,
+110,105,48,50,55,52,117,110,105,49,68,66,48,78,97,99,117,116,101,117,110,
+105,48,49,70,56,78,99,97,114,111,110,117,110,105,49,69,52,52,117,110,105,
+49,69,52,65,117,110,105,49,69,52,56,117,110,105,49,69,52,54,78,99,111,109,
+109,97,97,99,99,101,110,116,117,110,105,50,48,65,54,117,110,105,65,55,65,
+52,117,110,105,48,49,57,68,117,110,105,65,55,57,48,117,110,105,49,68,48,69,
+117,110,105,49,68,51,66,69,110,103,117,110,105,48,50,50,48,117,110,105,48,
+49,67,66,117,110,105,48,49,67,65,117,110,105,50,49,49,54,117,110,105,48,52,
+49,56,117,110,105,48,52,48,68,117,110,105,48,52,49,57,117,110,105,48,52,56,
+65,117,110,105,48,52,69,52,117,110,105,48,52,69,50,117,110,105,48,52,51,69,
+117,110,105,50,48,57,50,117,110,105,49,68,53,50,117,110,105,48,51,54,54,111,
+104,117,110,103,97,114,117,109,108,97,117,116,117,110,105,48,50,48,68,117,
+110,105,49,69,68,49,117,110,105,49,69,68,51,117,110,105,49,69,68,55,117,110,
+105,49,69,68,53,117,110,105,49,69,68,57,117,110,105,48,50,48,70,111,98,114,
+101,118,101,117,110,105,48,49,68,50,117,110,105,49,69,52,68,117,110,105,48,
+50,50,68,117,110,105,49,69,52,70,111,109,97,99,114,111,110,117,110,105,49,
+69,53,51,117,110,105,49,69,53,49,117,110,105,48,52,69,55,117,110,105,48,50,
+50,66,117,110,105,48,50,50,70,117,110,105,48,50,51,49,117,110,105,49,69,67,
+70,117,110,105,49,69,67,68,117,110,105,48,49,69,66,117,110,105,48,49,69,68,
+117,110,105,48,49,56,68,117,110,105,48,50,55,53,117,110,105,48,52,69,57,117,
+110,105,49,68,66,49,117,110,105,48,52,69,66,116,104,101,116,97,117,110,105,
+65,55,52,66,117,110,105,49,68,66,70,117,110,105,48,52,55,51,111,115,108,97,
+115,104,97,99,117,116,101,101,109,112,116,121,115,101,116,117,110,105,65,
+55,52,68,117,110,105,65,55,55,65,111,104,111,114,110,117,110,105,49,69,68,
+66,117,110,105,49,69,68,68,117,110,105,49,69,69,49,117,110,105,49,69,68,70,
+117,110,105,49,69,69,51,115,105,103,109,97,117,110,105,48,52,65,57,117,110,
+105,49,68,49,49,117,110,105,49,68,49,51,117,110,105,65,55,70,57,117,110,105,
+49,68,49,52,117,110,105,48,49,65,51,117,110,105,65,55,52,70,117,110,105,48,
+50,50,51,117,110,105,49,68,49,55,117,110,105,49,68,53,53,117,110,105,49,68,
+49,54,117,110,105,49,68,53,52,117,110,105,48,52,49,69,117,110,105,49,68,51,
+67,117,110,105,49,68,48,70,79,104,117,110,103,97,114,117,109,108,97,117,116,
+117,110,105,48,50,48,67,117,110,105,49,69,68,48,117,110,105,49,69,68,50,117,
+110,105,49,69,68,54,117,110,105,49,69,68,52,117,110,105,49,69,68,56,117,110,
+105,48,50,48,69,79,98,114,101,118,101,117,110,105,48,49,68,49,117,110,105,
+49,69,52,67,117,110,105,48,50,50,67,117,110,105,49,69,52,69,79,109,97,99,
+114,111,110,117,110,105,49,69,53,50,117,110,105,49,69,53,48,117,110,105,48,
+52,69,54,117,110,105,48,50,50,65,117,110,105,48,50,50,69,117,110,105,48,50,
+51,48,117,110,105,49,69,67,69,117,110,105,49,69,67,67,117,110,105,48,49,69,
+65,117,110,105,48,49,69,67,117,110,105,48,49,57,70,117,110,105,48,52,69,56,
+117,110,105,48,52,69,65,84,104,101,116,97,117,110,105,65,55,52,65,117,110,
+105,48,52,55,50,79,115,108,97,115,104,97,99,117,116,101,117,110,105,65,55,
+52,67,117,110,105,65,55,55,57,79,104,111,114,110,117,110,105,49,69,68,65,
+117,110,105,49,69,68,67,117,110,105,49,69,69,48,117,110,105,49,69,68,69,117,
+110,105,49,69,69,50,117,110,105,48,52,65,56,117,110,105,48,50,55,54,117,110,
+105,48,49,65,50,117,110,105,65,55,52,69,117,110,105,48,50,50,50,117,110,105,
+49,68,51,68,117,110,105,49,68,49,53,117,110,105,48,51,65,57,117,110,105,65,
+66,54,53,117,110,105,48,50,57,56,117,110,105,48,52,52,48,117,110,105,50,48,
+57,65,117,110,105,49,68,53,54,117,110,105,49,69,53,53,117,110,105,49,69,53,
+55,117,110,105,49,68,56,56,117,110,105,49,68,55,68,117,110,105,65,55,53,49,
+117,110,105,48,52,56,70,117,110,105,49,68,55,49,117,110,105,48,49,65,53,117,
+110,105,65,55,54,53,117,110,105,65,55,54,55,117,110,105,65,55,53,53,117,110,
+105,65,55,53,51,117,110,105,48,53,49,55,117,110,105,48,49,66,70,114,104,111,
+117,110,105,49,68,54,56,117,110,105,48,50,55,56,117,110,105,49,68,66,50,117,
+110,105,48,52,52,52,112,104,105,117,110,105,49,68,54,57,117,110,105,49,68,
+54,48,117,110,105,50,67,55,55,117,110,105,48,52,50,48,117,110,105,49,68,51,
+69,117,110,105,49,68,49,56,117,110,105,49,68,50,57,117,110,105,49,69,53,52,
+117,110,105,49,69,53,54,117,110,105,50,67,54,51,117,110,105,65,55,53,48,117,
+110,105,48,52,56,69,117,110,105,48,49,65,52,117,110,105,65,55,53,52,117,110,
+105,65,55,53,50,117,110,105,50,49,49,55,117,110,105,48,53,49,54,117,110,105,
+50,48,66,68,117,110,105,50,48,66,49,112,101,115,101,116,97,117,110,105,65,
+55,54,52,117,110,105,65,55,54,54,117,110,105,48,49,70,55,117,110,105,65,55,
+70,67,117,110,105,48,52,50,52,117,110,105,48,53,49,66,117,110,105,65,55,53,
+55,117,110,105,65,55,53,57,117,110,105,48,50,65,48,117,110,105,48,50,52,66,
+117,110,105,48,49,65,65,117,110,105,48,50,51,57,117,110,105,48,53,49,65,117,
+110,105,48,50,52,65,117,110,105,65,55,53,54,117,110,105,65,55,53,56,117,110,
+105,49,68,54,51,117,110,105,49,68,67,65,117,110,105,48,50,66,51,117,110,105,
+48,51,54,67,114,97,99,117,116,101,117,110,105,48,50,49,49,117,110,105,48,
+50,49,51,114,99,97,114,111,110,117,110,105,49,69,53,57,117,110,105,49,69,
+53,70,117,110,105,49,69,53,66,117,110,105,49,69,53,68,114,99,111,109,109,
+97,97,99,99,101,110,116,117,110,105,49,68,56,57,117,110,105,48,50,52,68,117,
+110,105,49,68,55,50,117,110,105,65,55,65,55,117,110,105,48,50,55,68,117,110,
+105,48,50,55,67,117,110,105,65,55,53,66,117,110,105,65,55,53,68,117,110,105,
+65,55,56,51,117,110,105,65,55,56,53,117,110,105,65,55,55,67,117,110,105,48,
+50,55,57,117,110,105,48,50,66,52,117,110,105,48,50,55,66,117,110,105,48,50,
+66,53,117,110,105,48,50,55,65,117,110,105,50,67,55,57,117,110,105,48,50,55,
+69,117,110,105,49,68,55,51,117,110,105,65,55,55,53,117,110,105,48,50,56,53,
+117,110,105,48,50,55,70,117,110,105,49,68,51,70,117,110,105,48,50,56,48,82,
+97,99,117,116,101,117,110,105,48,50,49,48,117,110,105,48,50,49,50,82,99,97,
+114,111,110,117,110,105,49,69,53,56,117,110,105,49,69,53,69,117,110,105,49,
+69,53,65,117,110,105,49,69,53,67,82,99,111,109,109,97,97,99,99,101,110,116,
+117,110,105,48,50,52,67,117,110,105,65,55,65,54,117,110,105,50,67,54,52,117,
+110,105,65,55,53,65,117,110,105,65,55,53,67,117,110,105,65,55,56,50,117,110,
+105,65,55,56,52,117,110,105,65,55,55,66,117,110,105,48,49,65,54,117,110,105,
+50,48,65,56,117,110,105,50,48,66,57,117,110,105,50,49,49,70,117,110,105,49,
+68,49,65,117,110,105,48,50,56,49,117,110,105,48,50,66,54,117,110,105,65,55,
+55,54,117,110,105,48,52,50,70,117,110,105,49,68,49,57,117,110,105,48,52,52,
+70,117,110,105,48,53,49,57,117,110,105,48,53,49,56,117,110,105,48,52,53,53,
+117,110,105,50,48,57,66,117,110,105,48,50,69,50,115,97,99,117,116,101,117,
+110,105,49,69,54,53,115,99,105,114,99,117,109,102,108,101,120,117,110,105,
+49,69,54,55,117,110,105,49,69,54,49,117,110,105,49,69,54,51,117,110,105,49,
+69,54,57,117,110,105,48,50,49,57,115,99,101,100,105,108,108,97,117,110,105,
+48,50,56,50,117,110,105,49,68,66,51,117,110,105,49,68,56,65,117,110,105,49,
+68,55,52,117,110,105,65,55,65,57,117,110,105,48,50,51,70,117,110,105,48,49,
+65,56,117,110,105,48,50,56,51,117,110,105,49,68,66,52,117,110,105,49,68,57,
+56,117,110,105,49,68,56,66,117,110,105,48,50,56,54,117,110,105,65,55,55,56,
+117,110,105,48,52,48,53,117,110,105,65,55,51,49,83,97,99,117,116,101,117,
+110,105,49,69,54,52,83,99,105,114,99,117,109,102,108,101,120,117,110,105,
+49,69,54,54,117,110,105,49,69,54,48,117,110,105,49,69,54,50,117,110,105,49,
+69,54,56,117,110,105,48,50,49,56,83,99,101,100,105,108,108,97,117,110,105,
+65,55,65,56,117,110,105,50,67,55,69,117,110,105,48,49,65,55,117,110,105,50,
+48,66,52,117,110,105,50,48,66,55,117,110,105,50,48,57,67,117,110,105,49,68,
+53,55,117,110,105,48,51,54,68,117,110,105,49,69,57,55,117,110,105,49,69,54,
+66,117,110,105,49,69,55,49,117,110,105,49,69,54,70,117,110,105,49,69,54,68,
+117,110,105,48,50,49,66,116,99,97,114,111,110,117,110,105,48,49,54,51,117,
+110,105,48,49,65,66,117,110,105,49,68,66,53,116,98,97,114,117,110,105,49,
+68,55,53,117,110,105,50,67,54,54,117,110,105,48,49,65,68,117,110,105,48,50,
+56,56,117,110,105,48,50,51,54,117,110,105,65,55,55,55,117,110,105,49,68,55,
+65,117,110,105,48,50,65,56,117,110,105,48,50,65,54,117,110,105,48,50,65,55,
+117,110,105,65,55,50,57,117,110,105,65,55,56,55,117,110,105,48,50,56,55,117,
+110,105,48,52,52,50,117,110,105,48,52,65,68,117,110,105,48,53,48,70,117,110,
+105,48,52,66,53,117,110,105,48,52,50,50,117,110,105,49,68,52,48,117,110,105,
+49,68,49,66,84,99,97,114,111,110,117,110,105,50,48,66,56,117,110,105,49,69,
+54,65,117,110,105,49,69,55,48,117,110,105,49,69,54,69,117,110,105,49,69,54,
+67,117,110,105,48,50,49,65,117,110,105,48,49,54,50,84,98,97,114,117,110,105,
+50,48,65,69,117,110,105,48,50,51,69,117,110,105,48,49,65,67,117,110,105,48,
+49,65,69,117,110,105,65,55,50,56,117,110,105,65,55,56,54,117,110,105,65,55,
+66,49,117,110,105,48,52,65,67,117,110,105,48,53,48,69,117,110,105,48,52,66,
+52,117,110,105,48,52,48,66,117,110,105,48,52,48,50,117,110,105,49,68,54,52,
+117,110,105,49,68,53,56,117,110,105,48,51,54,55,117,104,117,110,103,97,114,
+117,109,108,97,117,116,117,110,105,48,50,49,53,117,110,105,48,50,49,55,117,
+98,114,101,118,101,117,110,105,48,49,68,52,117,116,105,108,100,101,117,110,
+105,49,69,55,57,117,109,97,99,114,111,110,117,110,105,49,69,55,66,117,110,
+105,48,49,68,56,117,110,105,48,49,68,67,117,110,105,48,49,68,65,117,110,105,
+48,49,68,54,117,114,105,110,103,117,110,105,49,69,69,55,117,110,105,49,69,
+55,55,117,110,105,49,69,55,53,117,110,105,49,69,55,51,117,110,105,49,69,69,
+53,117,111,103,111,110,101,107,117,110,105,49,68,57,57,117,110,105,48,50,
+56,57,117,110,105,49,68,66,54,117,104,111,114,110,117,110,105,49,69,69,57,
+117,110,105,49,69,69,66,117,110,105,49,69,69,70,117,110,105,49,69,69,68,117,
+110,105,49,69,70,49,117,110,105,49,68,54,66,117,110,105,49,68,49,68,117,110,
+105,49,68,53,57,117,110,105,49,68,49,69,117,110,105,48,50,56,66,117,110,105,
+49,68,66,57,117,110,105,48,51,66,67,117,110,105,48,50,56,65,117,110,105,49,
+68,66,55,117,110,105,49,68,55,70,117,110,105,49,68,52,49,117,110,105,49,68,
+49,67,117,110,105,49,68,66,56,85,104,117,110,103,97,114,117,109,108,97,117,
+116,117,110,105,48,50,49,52,117,110,105,48,50,49,54,85,98,114,101,118,101,
+117,110,105,48,49,68,51,85,116,105,108,100,101,117,110,105,49,69,55,56,85,
+109,97,99,114,111,110,117,110,105,49,69,55,65,117,110,105,48,49,68,55,117,
+110,105,48,49,68,66,117,110,105,48,49,68,57,117,110,105,48,49,68,53,85,114,
+105,110,103,117,110,105,49,69,69,54,117,110,105,49,69,55,54,117,110,105,49,
+69,55,52,117,110,105,49,69,55,50,117,110,105,49,69,69,52,85,111,103,111,110,
+101,107,117,110,105,48,50,52,52,117,110,105,49,68,55,69,85,104,111,114,110,
+117,110,105,49,69,69,56,117,110,105,49,69,69,65,117,110,105,49,69,69,69,117,
+110,105,49,69,69,67,117,110,105,49,69,70,48,117,110,105,48,49,66,50,117,110,
+105,65,55,53,69,117,110,105,65,55,54,48,117,110,105,65,55,54,56,117,110,105,
+48,49,66,49,117,110,105,50,49,55,52,117,110,105,49,68,54,53,117,110,105,49,
+68,53,66,117,110,105,48,51,54,69,117,110,105,49,69,55,68,117,110,105,49,69,
+55,70,117,110,105,49,68,56,67,117,110,105,50,67,55,49,117,110,105,48,52,55,
+52,117,110,105,50,67,55,52,117,110,105,65,55,53,70,117,110,105,65,55,54,49,
+117,110,105,65,55,54,57,117,110,105,50,49,55,53,117,110,105,50,49,55,54,117,
+110,105,50,49,55,55,117,110,105,48,50,56,67,117,110,105,49,68,66,65,117,110,
+105,48,50,54,52,117,110,105,48,50,54,51,117,110,105,48,50,69,48,103,97,109,
+109,97,117,110,105,49,68,54,55,117,110,105,49,68,53,69,117,110,105,50,49,
+54,52,117,110,105,50,67,55,68,117,110,105,49,68,50,48,117,110,105,49,69,55,
+67,117,110,105,49,69,55,69,117,110,105,50,49,50,51,117,110,105,48,52,55,53,
+117,110,105,50,49,54,53,117,110,105,50,49,54,54,117,110,105,50,49,54,55,117,
+110,105,48,50,52,53,117,110,105,49,68,50,55,117,110,105,48,49,57,52,117,110,
+105,48,53,49,68,117,110,105,48,50,66,55,119,97,99,117,116,101,119,103,114,
+97,118,101,119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,
+101,115,105,115,117,110,105,49,69,56,55,117,110,105,49,69,57,56,117,110,105,
+49,69,56,57,117,110,105,50,67,55,51,117,110,105,48,50,65,67,117,110,105,48,
+50,56,68,111,109,101,103,97,117,110,105,48,50,55,55,117,110,105,48,53,49,
+67,117,110,105,49,68,52,50,117,110,105,49,68,50,49,87,97,99,117,116,101,87,
+103,114,97,118,101,87,99,105,114,99,117,109,102,108,101,120,87,100,105,101,
+114,101,115,105,115,117,110,105,49,69,56,54,117,110,105,49,69,56,56,117,110,
+105,50,67,55,50,117,110,105,50,48,65,57,117,110,105,48,52,52,53,117,110,105,
+50,49,55,57,117,110,105,50,48,57,51,117,110,105,48,50,69,51,117,110,105,48,
+51,54,70,117,110,105,49,69,56,68,117,110,105,49,69,56,66,117,110,105,49,68,
+56,68,117,110,105,48,52,70,70,117,110,105,48,52,70,68,117,110,105,48,52,66,
+51,117,110,105,50,49,55,65,117,110,105,50,49,55,66,99,104,105,117,110,105,
+49,68,54,65,117,110,105,49,68,54,49,117,110,105,48,52,50,53,117,110,105,50,
+49,54,57,117,110,105,49,69,56,67,117,110,105,49,69,56,65,117,110,105,48,52,
+70,69,117,110,105,48,52,70,67,117,110,105,48,52,66,50,117,110,105,50,49,54,
+65,117,110,105,50,49,54,66,117,110,105,48,52,52,51,117,110,105,48,50,66,56,
+117,110,105,48,52,70,51,121,103,114,97,118,101,121,99,105,114,99,117,109,
+102,108,101,120,117,110,105,48,52,53,69,117,110,105,49,69,70,57,117,110,105,
+48,50,51,51,117,110,105,48,52,69,70,117,110,105,48,52,70,49,117,110,105,49,
+69,56,70,117,110,105,49,69,57,57,117,110,105,49,69,70,55,117,110,105,49,69,
+70,53,117,110,105,48,50,52,70,117,110,105,48,49,66,52,117,110,105,49,69,70,
+70,117,110,105,48,52,65,70,117,110,105,48,52,66,49,117,110,105,48,50,56,69,
+108,97,109,98,100,97,117,110,105,48,49,57,66,117,110,105,48,52,52,55,117,
+110,105,48,52,70,53,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,
+105,48,52,67,67,117,110,105,48,53,50,68,117,110,105,48,52,65,69,117,110,105,
+48,50,56,70,89,103,114,97,118,101,89,99,105,114,99,117,109,102,108,101,120,
+117,110,105,49,69,70,56,117,110,105,48,50,51,50,117,110,105,49,69,56,69,117,
+110,105,49,69,70,54,117,110,105,49,69,70,52,117,110,105,48,50,52,69,117,110,
+105,48,52,66,48,117,110,105,48,49,66,51,117,110,105,49,69,70,69,117,110,105,
+48,52,50,51,117,110,105,48,52,70,50,117,110,105,48,52,48,69,117,110,105,48,
+52,69,69,117,110,105,48,52,70,48,117,110,105,48,52,50,55,117,110,105,48,52,
+70,52,117,110,105,48,52,66,56,117,110,105,48,52,66,54,117,110,105,48,52,67,
+66,117,110,105,48,53,50,67,80,115,105,117,110,105,49,68,50,65,117,110,105,
+49,68,66,66,122,97,99,117,116,101,117,110,105,49,69,57,49,122,100,111,116,
+97,99,99,101,110,116,117,110,105,49,69,57,53,117,110,105,49,69,57,51,117,
+110,105,48,50,57,48,117,110,105,49,68,66,67,117,110,105,49,68,56,69,117,110,
+105,48,49,66,54,117,110,105,49,68,55,54,117,110,105,48,50,57,49,117,110,105,
+49,68,66,68,117,110,105,48,50,50,53,117,110,105,50,67,54,67,117,110,105,48,
+50,52,48,117,110,105,65,55,54,51,117,110,105,49,68,50,50,90,97,99,117,116,
+101,117,110,105,49,69,57,48,90,100,111,116,97,99,99,101,110,116,117,110,105,
+49,69,57,52,117,110,105,49,69,57,50,117,110,105,48,49,66,53,117,110,105,48,
+50,50,52,117,110,105,50,67,54,66,117,110,105,50,67,55,70,117,110,105,65,55,
+54,50,117,110,105,48,49,65,57,117,110,105,48,50,57,50,117,110,105,48,52,69,
+49,117,110,105,49,68,66,69,117,110,105,48,49,69,70,117,110,105,49,68,57,65,
+117,110,105,48,50,57,51,117,110,105,48,49,66,65,117,110,105,48,49,66,57,117,
+110,105,65,55,50,66,117,110,105,48,50,49,68,117,110,105,65,55,54,66,117,110,
+105,48,49,66,55,117,110,105,48,52,69,48,117,110,105,49,68,50,51,117,110,105,
+48,49,69,69,117,110,105,48,49,66,56,117,110,105,65,55,50,65,117,110,105,48,
+50,49,67,117,110,105,65,55,54,65,117,110,105,48,50,57,52,117,110,105,48,50,
+67,48,117,110,105,48,50,52,50,117,110,105,48,50,52,49,117,110,105,48,50,65,
+49,117,110,105,48,50,57,53,117,110,105,48,50,67,49,117,110,105,48,50,69,52,
+117,110,105,48,50,65,50,117,110,105,48,50,57,54,117,110,105,48,49,66,69,117,
+110,105,49,68,50,52,117,110,105,49,68,50,53,117,110,105,49,68,53,67,117,110,
+105,50,49,52,70,117,110,105,50,48,65,65,117,110,105,50,48,66,66,117,110,105,
+50,48,66,67,117,110,105,50,48,56,48,117,110,105,50,48,55,48,117,110,105,50,
+48,56,49,117,110,105,50,48,56,50,117,110,105,48,49,66,66,117,110,105,50,49,
+56,57,117,110,105,50,48,56,51,117,110,105,50,48,56,52,117,110,105,50,48,55,
+52,117,110,105,65,55,50,67,117,110,105,65,55,50,69,117,110,105,65,55,50,68,
+117,110,105,65,55,50,70,117,110,105,50,48,56,53,117,110,105,50,48,55,53,117,
+110,105,48,49,66,67,117,110,105,48,49,66,68,117,110,105,50,48,56,54,117,110,
+105,50,48,55,54,117,110,105,49,69,70,68,117,110,105,49,69,70,67,117,110,105,
+50,48,56,55,117,110,105,50,48,55,55,117,110,105,50,48,56,56,117,110,105,50,
+48,55,56,117,110,105,50,48,56,57,117,110,105,50,48,55,57,117,110,105,65,55,
+54,69,117,110,105,65,55,54,70,117,110,105,65,55,55,48,117,110,105,50,49,53,
+70,117,110,105,50,49,53,50,117,110,105,50,49,53,53,117,110,105,50,49,53,57,
+117,110,105,50,49,53,48,117,110,105,50,49,53,49,117,110,105,50,49,53,54,117,
+110,105,50,49,53,55,117,110,105,50,49,53,56,117,110,105,50,49,53,65,117,110,
+105,48,49,67,51,117,110,105,65,55,49,68,117,110,105,65,55,49,70,117,110,105,
+65,55,49,69,101,120,99,108,97,109,100,98,108,117,110,105,65,55,56,66,117,
+110,105,65,55,56,67,117,110,105,48,50,70,56,117,110,105,65,55,56,57,117,110,
+105,48,50,66,66,117,110,105,48,51,49,50,113,117,111,116,101,114,101,118,101,
+114,115,101,100,117,110,105,48,50,66,68,117,110,105,48,51,49,52,117,110,105,
+48,50,66,67,117,110,105,50,48,49,70,117,110,105,48,50,69,69,117,110,105,48,
+50,68,48,117,110,105,48,50,68,49,97,110,111,116,101,108,101,105,97,117,110,
+105,50,48,50,55,117,110,105,50,50,49,57,117,110,105,50,48,56,68,117,110,105,
+50,48,55,68,117,110,105,50,48,56,69,117,110,105,50,48,55,69,117,110,105,50,
+55,69,54,117,110,105,50,55,69,55,117,110,105,50,51,48,56,117,110,105,50,51,
+49,67,117,110,105,50,51,48,57,117,110,105,50,51,49,68,117,110,105,50,51,48,
+65,117,110,105,50,51,49,69,117,110,105,50,51,48,66,117,110,105,50,51,49,70,
+117,110,105,50,51,57,66,117,110,105,50,51,57,67,117,110,105,50,51,57,68,117,
+110,105,50,51,57,69,117,110,105,50,51,57,70,117,110,105,50,51,65,48,117,110,
+105,50,51,65,49,117,110,105,50,51,65,50,117,110,105,50,51,65,51,117,110,105,
+50,51,65,52,117,110,105,50,51,65,53,117,110,105,50,51,65,54,117,110,105,50,
+51,65,55,117,110,105,50,51,65,56,117,110,105,50,51,65,65,117,110,105,50,51,
+65,57,117,110,105,50,51,65,66,117,110,105,50,51,65,67,117,110,105,50,51,65,
+68,117,110,105,48,49,67,48,117,110,105,48,49,67,49,117,110,105,48,49,67,50,
+117,110,105,50,48,49,54,117,110,105,50,50,50,53,117,110,105,50,50,50,54,117,
+110,105,50,50,51,52,117,110,105,50,50,51,53,117,110,105,50,50,54,50,117,110,
+105,50,50,56,50,117,110,105,50,50,56,54,117,110,105,50,50,56,52,117,110,105,
+50,50,56,51,117,110,105,50,50,56,55,117,110,105,50,50,56,53,117,110,105,48,
+50,67,67,117,110,105,48,50,67,56,117,110,105,48,51,51,55,117,110,105,48,51,
+51,56,117,110,105,50,48,69,53,117,110,105,50,48,52,49,117,110,105,50,48,49,
+48,117,110,105,50,48,49,49,117,110,105,48,48,65,68,117,110,105,50,69,51,65,
+117,110,105,50,69,51,66,117,110,105,50,48,49,53,117,110,105,48,50,68,55,117,
+110,105,50,48,56,66,117,110,105,50,48,55,66,117,110,105,48,51,50,48,117,110,
+105,48,51,51,53,117,110,105,48,51,51,54,117,110,105,48,50,67,70,117,110,105,
+48,51,49,55,117,110,105,48,50,67,65,97,99,117,116,101,99,111,109,98,109,105,
+110,117,116,101,117,110,105,48,50,66,57,115,101,99,111,110,100,117,110,105,
+48,50,66,65,117,110,105,48,50,70,54,117,110,105,48,51,48,66,117,110,105,50,
+48,51,52,117,110,105,50,48,53,55,117,110,105,48,50,67,69,117,110,105,48,51,
+49,54,117,110,105,48,50,70,52,117,110,105,48,50,67,66,103,114,97,118,101,
+99,111,109,98,117,110,105,50,48,51,53,117,110,105,50,48,51,54,117,110,105,
+48,50,70,53,117,110,105,48,51,48,70,117,110,105,50,48,51,55,117,110,105,50,
+48,51,56,117,110,105,48,51,50,68,117,110,105,65,55,56,56,117,110,105,48,51,
+48,50,117,110,105,48,51,50,70,117,110,105,48,51,49,49,117,110,105,48,51,53,
+50,117,110,105,50,48,52,48,117,110,105,48,51,54,49,117,110,105,70,69,50,48,
+117,110,105,70,69,50,49,117,110,105,65,57,50,69,117,110,105,48,51,50,69,117,
+110,105,48,51,48,54,117,110,105,48,51,49,48,117,110,105,49,68,67,66,117,110,
+105,50,48,51,70,117,110,105,48,51,53,67,117,110,105,48,51,53,68,117,110,105,
+49,68,67,68,117,110,105,48,50,69,67,117,110,105,48,51,50,67,117,110,105,48,
+51,48,67,117,110,105,49,68,67,55,117,110,105,49,68,67,52,117,110,105,49,68,
+67,67,117,110,105,49,68,67,53,117,110,105,49,68,67,54,117,110,105,49,68,67,
+57,117,110,105,49,68,67,56,117,110,105,48,50,70,55,117,110,105,48,51,51,48,
+117,110,105,48,51,51,52,116,105,108,100,101,99,111,109,98,117,110,105,48,
+51,52,65,115,105,109,105,108,97,114,117,110,105,50,48,53,51,117,110,105,48,
+51,52,67,117,110,105,49,68,70,68,117,110,105,48,51,52,66,117,110,105,48,51,
+54,48,117,110,105,70,69,50,50,117,110,105,70,69,50,51,117,110,105,48,51,51,
+69,117,110,105,48,51,53,66,117,110,105,48,51,53,57,117,110,105,48,51,53,51,
+117,110,105,48,50,68,70,117,110,105,48,51,51,68,117,110,105,48,51,50,66,117,
+110,105,48,51,51,67,117,110,105,48,50,67,68,117,110,105,48,51,51,49,117,110,
+105,48,50,67,57,117,110,105,48,51,48,52,117,110,105,48,51,53,70,117,110,105,
+48,51,53,69,117,110,105,48,51,51,50,117,110,105,48,51,48,53,117,110,100,101,
+114,115,99,111,114,101,100,98,108,117,110,105,48,51,51,51,117,110,105,48,
+51,52,55,117,110,105,48,51,51,70,117,110,105,48,50,69,68,117,110,105,65,55,
+56,65,117,110,105,50,48,56,67,117,110,105,50,48,55,67,117,110,105,50,50,53,
+70,101,113,117,105,118,97,108,101,110,99,101,117,110,105,50,50,49,51,117,
+110,105,48,51,50,52,117,110,105,48,51,48,56,100,111,116,98,101,108,111,119,
+99,111,109,98,117,110,105,48,51,48,55,117,110,105,48,51,53,56,117,110,105,
+48,51,50,54,117,110,105,48,51,49,51,117,110,105,48,51,49,53,117,110,105,48,
+51,49,66,117,110,105,48,50,70,51,117,110,105,48,51,50,53,117,110,105,48,51,
+48,65,117,110,105,48,51,53,65,117,110,105,48,51,49,67,117,110,105,48,50,68,
+51,117,110,105,48,50,66,70,117,110,105,48,51,53,49,117,110,105,48,51,51,57,
+117,110,105,48,50,68,50,117,110,105,48,50,66,69,117,110,105,48,51,53,55,117,
+110,105,65,55,50,52,117,110,105,65,55,50,53,117,110,105,65,55,50,50,117,110,
+105,65,55,50,51,104,111,111,107,97,98,111,118,101,99,111,109,98,117,110,105,
+48,51,50,57,117,110,105,48,51,48,68,117,110,105,48,51,52,56,117,110,105,48,
+51,48,69,117,110,105,50,48,56,65,117,110,105,48,51,49,70,117,110,105,48,50,
+68,54,117,110,105,50,48,55,65,117,110,105,48,51,49,69,117,110,105,48,50,68,
+53,117,110,105,48,51,49,68,117,110,105,48,50,68,52,117,110,105,48,51,49,56,
+117,110,105,48,51,49,57,117,110,105,48,50,69,66,117,110,105,48,50,69,65,117,
+110,105,48,51,52,57,117,110,105,48,51,49,65,117,110,105,65,55,49,55,117,110,
+105,65,55,49,56,117,110,105,65,55,49,57,117,110,105,65,55,49,65,117,110,105,
+65,55,50,48,117,110,105,65,55,50,49,117,110,105,48,50,70,69,117,110,105,48,
+50,70,68,117,110,105,48,50,65,68,117,110,105,48,51,50,55,117,110,105,48,51,
+50,56,117,110,105,49,68,67,50,117,110,105,48,51,50,65,117,110,105,48,51,52,
+54,117,110,105,48,51,51,65,117,110,105,50,52,50,51,117,110,105,48,51,51,66,
+117,110,105,48,50,68,69,117,110,105,65,55,48,56,117,110,105,65,55,48,57,117,
+110,105,65,55,48,65,117,110,105,65,55,48,66,117,110,105,65,55,48,67,117,110,
+105,48,50,69,53,117,110,105,48,50,69,54,117,110,105,48,50,69,55,117,110,105,
+48,50,69,56,117,110,105,48,50,69,57,117,110,105,65,55,48,68,117,110,105,65,
+55,48,69,117,110,105,65,55,48,70,117,110,105,65,55,49,48,117,110,105,65,55,
+49,49,117,110,105,65,55,49,50,117,110,105,65,55,49,51,117,110,105,65,55,49,
+52,117,110,105,65,55,49,53,117,110,105,65,55,49,54,117,110,105,50,55,52,68,
+117,110,105,50,48,50,51,97,114,114,111,119,100,111,119,110,117,110,105,50,
+49,56,54,117,110,105,65,55,49,67,97,114,114,111,119,117,112,117,110,105,65,
+55,49,66,117,110,105,48,51,52,69,97,114,114,111,119,117,112,100,110,97,114,
+114,111,119,117,112,100,110,98,115,101,97,114,114,111,119,108,101,102,116,
+117,110,105,50,48,69,69,117,110,105,50,48,69,68,117,110,105,48,50,70,70,97,
+114,114,111,119,114,105,103,104,116,117,110,105,50,48,69,70,117,110,105,50,
+48,69,67,117,110,105,48,51,54,50,97,114,114,111,119,98,111,116,104,117,110,
+105,48,51,52,68,117,110,105,50,49,57,65,117,110,105,50,49,57,66,97,114,114,
+111,119,100,98,108,100,111,119,110,97,114,114,111,119,100,98,108,117,112,
+117,110,105,50,49,68,53,97,114,114,111,119,100,98,108,108,101,102,116,97,
+114,114,111,119,100,98,108,114,105,103,104,116,97,114,114,111,119,100,98,
+108,98,111,116,104,117,110,105,50,49,57,54,117,110,105,50,49,57,56,117,110,
+105,50,49,57,55,117,110,105,50,49,57,57,117,110,105,50,55,49,51,117,110,105,
+48,50,67,53,117,110,105,48,50,69,70,117,110,105,48,50,67,52,117,110,105,48,
+50,70,48,117,110,105,48,50,67,50,117,110,105,49,68,70,69,117,110,105,48,51,
+53,52,117,110,105,48,50,70,49,97,110,103,108,101,108,101,102,116,117,110,
+105,48,50,67,51,117,110,105,48,51,53,48,117,110,105,48,51,53,53,117,110,105,
+48,50,70,50,97,110,103,108,101,114,105,103,104,116,117,110,105,48,51,53,54,
+117,110,105,49,68,70,70,117,110,105,50,54,52,48,117,110,105,50,54,52,50,117,
+110,105,50,54,54,68,117,110,105,50,54,54,70,117,110,105,65,55,48,50,117,110,
+105,65,55,48,48,117,110,105,65,55,48,52,117,110,105,65,55,48,54,117,110,105,
+65,55,48,51,117,110,105,65,55,48,49,117,110,105,65,55,48,53,117,110,105,65,
+55,48,55,117,110,105,48,51,52,70,117,110,105,50,48,54,49,117,110,105,50,48,
+54,51,117,110,105,50,48,54,50,117,110,105,50,48,50,65,117,110,105,50,48,48,
+69,117,110,105,50,48,50,68,117,110,105,50,48,50,67,117,110,105,50,48,50,66,
+117,110,105,50,48,48,70,117,110,105,50,48,50,69,117,110,105,50,48,54,48,117,
+110,105,50,48,48,68,117,110,105,50,48,48,67,117,110,105,50,48,48,66,117,110,
+105,50,48,54,68,117,110,105,50,48,54,66,117,110,105,50,48,54,67,117,110,105,
+50,48,54,65,117,110,105,50,48,50,56,117,110,105,50,48,54,69,117,110,105,50,
+48,54,70,117,110,105,50,48,50,57,117,110,105,50,48,48,49,117,110,105,50,48,
+48,51,117,110,105,50,48,50,70,117,110,105,50,48,48,56,117,110,105,50,48,48,
+54,117,110,105,50,48,48,52,117,110,105,50,48,48,48,117,110,105,50,48,48,50,
+117,110,105,50,48,48,53,117,110,105,50,48,48,55,117,110,105,50,48,48,57,117,
+110,105,50,48,48,65,117,110,105,70,70,70,68,117,110,105,48,50,70,57,117,110,
+105,48,50,70,66,117,110,105,48,50,70,65,117,110,105,48,50,70,67,88,105,67,
+111,112,121,114,105,103,104,116,32,40,99,41,32,83,73,76,32,73,110,116,101,
+114,110,97,116,105,111,110,97,108,44,32,49,57,57,55,45,50,48,49,52,46,67,
+104,97,114,105,115,32,83,73,76,2,208,2,0,1,0,37,0,40,0,47,0,66,0,81,0,162,
+0,230,1,13,1,18,1,56,1,126,1,166,1,226,2,20,2,125,2,169,2,178,3,1,3,17,3,
+132,3,155,3,162,3,167,3,174,3,180,3,218,3,229,4,16,4,20,4,57,4,65,4,72,4,
+217,4,223,4,230,5,48,5,83,5,110,5,228,5,246,6,9,6,29,6,103,6,110,6,133,7,
+73,7,99,7,136,7,153,7,191,7,194,7,203,7,208,7,213,8,13,8,18,8,172,8,212,8,
+215,8,228,9,22,9,67,9,173,9,195,10,75,10,204,10,207,10,214,11,82,11,89,11,
+108,11,195,12,65,12,181,12,201,12,213,12,222,12,227,12,232,12,255,13,6,13,
+54,13,148,14,7,14,55,14,86,14,189,14,245,15,47,15,139,15,157,15,162,15,200,
+16,22,16,109,16,145,16,228,16,240,17,84,17,87,17,113,17,212,17,240,18,82,
+18,129,18,147,18,229,19,27,19,120,19,130,19,155,19,246,20,0,20,7,20,41,20,
+48,20,99,20,123,20,158,20,245,21,9,21,97,21,184,21,188,21,215,21,232,22,53,
+22,77,22,113,22,190,22,194,22,206,23,18,23,73,23,102,23,131,23,142,23,168,
+23,214,24,26,24,78,24,111,24,185,24,253,25,50,25,111,25,186,25,190,25,206,
+25,212,25,242,26,4,26,25,26,31,26,36,26,85,26,121,26,147,26,151,26,222,27,
+27,27,59,27,102,27,170,27,201,27,210,27,236,28,16,28,27,28,57,28,121,28,139,
+28,192,28,236,29,12,29,46,29,100,29,163,29,195,29,228,30,9,30,63,30,113,30,
+161,30,176,30,216,30,241,31,15,31,71,31,109,31,133,31,169,31,195,31,248,32,
+21,32,35,32,65,32,92,32,144,32,196,32,199,32,233,33,27,33,45,33,52,33,79,
+33,126,33,173,33,192,33,211,34,1,34,27,34,49,34,96,34,125,34,170,34,216,35,
+6,35,26,35,51,35,69,35,114,35,127,35,155,35,173,35,183,35,225,35,249,36,12,
+36,36,36,79,36,118,36,141,36,182,36,186,36,203,36,245,37,24,37,53,37,93,37,
+111,37,152,37,193,37,204,37,243,38,8,38,48,38,88,38,104,38,117,38,124,38,
+129,38,168,38,207,38,229,39,10,39,48,39,73,39,111,39,119,39,137,39,151,39,
+188,39,204,39,208,39,227,39,235,40,15,40,51,40,80,40,114,40,134,40,142,40,
+170,40,205,40,240,41,6,41,39,41,71,41,84,41,107,41,130,41,149,41,168,41,174,
+41,179,41,188,41,214,41,222,41,246,41,250,42,26,42,58,42,66,42,98,42,130,
+42,162,42,192,42,210,42,221,42,252,43,27,43,58,43,89,43,118,43,134,43,146,
+43,159,43,189,43,219,43,249,44,23,44,33,44,40,44,49,44,75,44,105,44,134,44,
+149,44,155,44,164,44,193,44,222,44,235,44,255,45,8,45,31,45,51,45,76,45,84,
+45,110,45,116,45,132,45,144,45,156,45,168,45,178,45,200,45,227,45,250,46,
+16,46,21,46,40,46,59,46,86,46,113,46,128,46,155,46,161,46,188,46,215,46,240,
+46,244,46,249,47,10,47,36,47,62,47,88,47,114,47,140,47,166,47,192,47,205,
+47,229,47,239,47,254,48,13,48,31,48,56,48,61,48,86,48,111,48,136,48,161,48,
+186,48,211,48,236,48,252,49,12,49,37,49,50,49,56,49,80,49,95,49,119,49,130,
+49,154,49,164,49,183,49,207,49,231,49,255,50,5,50,27,50,33,50,47,50,61,50,
+70,50,79,50,84,50,107,50,130,50,153,50,176,50,195,50,210,50,233,51,0,51,5,
+51,26,51,38,51,53,51,75,51,97,51,119,51,141,51,149,51,171,51,178,51,191,51,
+197,51,210,51,220,51,230,51,236,51,243,52,8,52,29,52,50,52,71,52,92,52,113,
+52,132,52,151,52,171,52,191,52,211,52,220,52,240,53,4,53,24,53,30,53,49,53,
+67,53,79,53,91,53,97,53,109,53,116,53,128,53,136,53,142,53,161,53,170,53,
+189,53,208,53,227,53,239,54,2,54,21,54,28,54,47,54,54,54,73,54,92,54,109,
+54,118,54,127,54,136,54,141,54,148,54,157,54,175,54,187,54,205,54,223,54,
+241,55,3,55,21,55,39,55,54,55,72,55,80,55,98,55,116,55,127,55,138,55,149,
+55,160,55,177,55,194,55,199,55,216,55,233,55,250,56,11,56,28,56,45,56,62,
+56,77,56,92,56,108,56,124,56,140,56,156,56,172,56,188,56,196,56,212,56,228,
+56,244,57,4,57,13,57,26,57,35,57,51,57,64,57,78,57,84,57,94,57,104,57,114,
+57,124,57,134,57,142,57,150,57,158,57,166,57,173,57,188,57,203,57,218,57,
+233,57,248,58,7,58,22,58,37,58,52,58,67,58,82,58,97,58,112,58,125,58,139,
+58,153,58,167,58,181,58,195,58,209,58,223,58,237,58,251,59,9,59,23,59,37,
+59,51,59,65,59,77,59,86,59,95,59,104,59,113,59,122,59,131,59,140,59,149,59,
+155,59,161,59,174,59,187,59,200,59,213,59,226,59,239,59,252,60,9,60,22,60,
+35,60,48,60,61,60,74,60,87,60,100,60,105,60,118,60,131,60,144,60,157,60,170,
+60,183,60,196,60,207,60,218,60,225,60,232,60,239,60,246,60,253,61,9,61,21,
+61,33,61,45,61,57,61,69,61,81,61,93,61,105,61,117,61,129,61,141,61,153,61,
+165,61,177,61,189,61,201,61,213,61,225,61,237,61,249,62,5,62,17,62,29,62,
+41,62,53,62,65,62,77,62,89,62,101,62,111,62,121,62,131,62,139,62,147,62,155,
+62,163,62,171,62,179,62,187,62,195,62,203,62,209,62,215,62,221,62,227,62,
+233,62,244,62,255,63,10,63,21,63,32,63,43,63,54,63,65,63,76,63,87,63,98,63,
+109,63,120,63,131,63,142,63,153,63,164,63,175,63,186,63,197,63,208,63,219,
+63,230,63,241,63,252,64,7,64,18,64,29,64,40,64,49,64,58,64,63,64,68,64,80,
+64,93,64,101,64,105,64,111,64,117,64,121,64,128,64,138,64,146,64,151,64,159,
+64,168,64,187,64,198,64,214,64,225,64,230,64,233,64,236,64,247,64,250,65,
+3,65,17,65,23,65,48,65,60,65,103,65,148,65,161,65,176,65,197,65,216,65,236,
+66,7,66,11,66,43,66,70,66,99,66,102,66,115,66,125,250,132,22,219,7,40,247,
+254,29,248,210,248,242,29,112,247,85,21,139,251,35,42,251,1,41,83,225,223,
+240,176,227,248,5,231,30,11,117,29,14,28,5,90,22,164,29,11,247,23,29,137,
+21,251,216,251,32,251,172,251,187,251,182,247,13,29,11,247,240,29,35,251,
+13,247,224,29,244,247,12,170,31,14,28,5,49,133,21,247,202,29,247,162,251,
+83,233,251,203,30,252,170,51,6,245,247,182,29,254,216,7,119,123,116,110,137,
+30,33,131,5,51,248,145,227,7,251,0,147,5,110,141,125,162,159,26,248,103,7,
+143,184,143,182,248,138,251,205,253,25,248,125,27,200,195,164,141,157,31,
+252,86,250,131,247,140,29,11,249,125,247,189,21,247,25,35,211,251,35,202,
+30,251,64,219,83,178,231,199,29,251,15,221,73,247,41,68,31,247,50,63,231,
+102,251,7,26,57,72,62,251,9,59,78,169,166,98,30,114,247,66,5,35,251,164,6,
+122,180,247,10,104,247,17,248,48,29,31,11,250,168,248,128,21,247,180,251,
+70,247,124,251,197,251,195,251,80,251,120,251,184,251,187,247,78,251,114,
+247,191,247,183,29,30,251,105,141,156,29,11,248,244,73,29,11,28,4,238,28,
+5,6,21,248,200,29,155,118,127,119,25,251,209,252,165,251,181,248,171,247,
+243,29,248,29,253,89,211,29,248,48,249,62,5,11,247,78,29,249,4,57,7,251,154,
+60,5,71,247,45,28,251,49,7,114,121,121,114,137,30,41,133,5,59,248,97,219,
+7,51,145,5,114,141,123,157,248,172,29,172,198,231,165,211,27,247,50,184,53,
+251,9,31,252,164,7,114,118,121,115,137,30,55,133,5,59,7,11,249,160,249,158,
+21,247,95,7,247,144,29,253,91,248,161,29,38,131,5,61,248,148,219,7,251,27,
+145,5,114,141,121,157,164,26,248,212,248,73,29,11,28,5,92,248,211,21,228,
+252,170,50,7,247,29,129,5,168,137,153,119,118,26,252,45,7,129,59,108,49,27,
+251,212,251,97,247,117,248,29,245,29,252,15,247,150,251,236,248,93,247,113,
+247,101,221,139,31,248,109,248,54,29,11,21,221,80,204,39,46,80,80,104,117,
+149,112,174,160,155,149,139,30,161,205,5,155,154,155,143,158,27,178,173,98,
+74,63,80,106,84,123,31,251,34,194,247,9,7,186,158,235,182,233,26,14,28,6,
+86,28,5,201,21,247,66,47,241,251,31,51,59,78,53,67,198,74,139,30,247,78,6,
+251,19,39,38,251,7,70,30,247,37,251,12,251,71,225,251,96,27,252,44,251,154,
+251,212,252,35,252,48,247,162,251,201,248,38,248,37,247,158,247,214,248,33,
+247,48,98,247,37,68,247,7,31,247,41,211,247,58,247,45,247,46,26,252,76,253,
+177,21,251,216,251,32,251,172,251,186,251,183,247,13,29,11,28,6,47,248,206,
+29,251,250,59,7,233,133,161,137,152,117,133,118,25,251,81,253,17,251,129,
+249,148,247,15,29,247,134,253,146,5,247,37,6,247,173,250,19,5,11,28,5,27,
+22,227,122,29,7,11,28,4,227,250,119,21,247,25,70,225,38,68,69,94,68,81,184,
+86,139,30,247,37,6,33,56,69,75,94,30,247,39,63,251,37,238,251,93,27,251,195,
+251,80,251,120,251,184,251,187,247,78,251,114,247,191,247,183,29,212,127,
+209,119,202,31,235,195,247,35,247,2,247,23,26,252,56,252,137,156,29,11,248,
+34,29,96,102,157,113,168,120,31,247,203,251,91,5,14,28,5,115,22,227,7,251,
+3,248,93,29,250,220,7,155,153,162,168,143,30,247,3,147,5,227,252,159,51,7,
+247,11,247,251,29,73,7,252,246,253,123,5,249,189,7,155,153,162,170,143,30,
+247,11,147,5,227,252,158,51,7,247,0,247,251,29,254,220,7,123,125,116,110,
+135,30,251,0,131,5,51,248,158,227,7,251,11,147,5,108,141,125,164,155,26,242,
+7,248,246,249,121,5,253,224,7,123,125,114,110,137,30,251,11,131,5,51,7,11,
+249,62,182,21,247,70,29,248,208,247,225,29,247,208,29,247,39,247,21,207,139,
+30,11,250,9,215,21,175,29,11,21,247,172,29,14,28,4,180,186,142,29,11,248,
+187,22,193,29,11,21,244,80,200,53,79,86,100,82,96,164,112,145,133,30,247,
+13,6,251,11,100,102,251,1,105,30,77,7,247,38,168,247,0,227,247,33,26,14,28,
+4,170,250,171,247,168,29,152,29,11,137,29,109,49,75,251,29,71,71,25,251,84,
+227,5,92,100,120,102,92,26,78,193,82,235,209,198,169,188,188,30,225,225,203,
+247,44,165,205,248,29,250,82,24,11,21,124,29,11,28,4,254,22,227,7,251,19,
+164,252,39,249,10,248,16,248,159,247,24,159,5,247,28,29,248,9,252,220,252,
+48,252,201,247,32,29,7,11,250,148,22,219,78,29,7,11,28,6,160,22,91,29,11,
+28,7,53,22,247,234,251,8,7,108,251,95,5,125,137,120,114,123,27,252,105,248,
+200,247,150,6,155,158,118,125,141,31,157,251,36,5,240,248,93,38,6,121,251,
+33,5,124,137,122,117,121,27,251,150,141,5,248,146,248,33,7,158,151,120,119,
+143,31,168,251,60,5,247,11,247,197,254,210,53,6,239,129,158,137,161,118,127,
+119,25,253,76,254,255,251,1,123,5,51,248,40,227,7,251,9,149,121,141,128,158,
+154,161,25,247,121,248,7,5,248,109,252,7,6,121,115,114,110,137,30,38,131,
+5,51,7,247,46,248,248,21,252,52,6,248,52,249,48,5,11,28,6,177,60,29,14,69,
+29,108,248,36,50,29,250,58,248,45,29,61,247,114,247,100,31,249,44,6,141,158,
+139,163,154,26,247,135,251,21,247,73,251,146,251,171,251,94,251,105,251,212,
+251,234,247,119,251,54,247,140,248,0,29,30,251,97,248,157,21,252,86,6,247,
+68,149,245,247,4,247,27,27,247,28,202,251,0,251,27,31,11,21,57,6,251,9,115,
+41,90,38,27,39,38,188,247,9,115,31,59,6,251,36,239,251,52,247,97,247,95,241,
+247,52,247,36,30,11,21,251,150,247,239,5,251,46,6,251,150,251,239,5,247,15,
+6,247,105,247,95,247,103,251,95,5,11,28,6,158,247,128,21,247,27,251,19,196,
+251,5,143,30,247,23,174,213,211,231,26,247,23,251,5,217,251,45,251,52,251,
+19,65,45,88,184,120,172,172,159,153,144,143,30,247,12,7,139,182,170,211,229,
+217,86,36,251,0,51,90,251,5,30,127,120,141,135,27,61,7,139,168,145,186,227,
+243,104,251,10,40,62,49,251,15,96,108,149,158,104,30,98,247,0,5,145,129,117,
+142,126,27,86,114,104,106,80,227,59,247,73,247,84,247,42,239,247,42,31,11,
+21,209,84,248,152,29,194,196,209,30,244,28,250,211,21,193,29,11,21,205,88,
+192,76,75,88,86,73,76,190,87,203,202,190,191,202,30,11,22,227,7,251,17,147,
+248,18,29,247,17,147,5,229,252,176,247,113,29,11,250,230,250,85,21,247,195,
+251,70,247,2,252,23,30,252,126,51,6,247,15,247,182,29,254,216,7,119,123,248,
+50,29,248,174,227,7,251,27,147,5,110,141,125,162,159,26,248,17,248,1,29,251,
+105,136,21,251,129,251,29,32,251,107,141,30,100,69,150,133,27,249,25,247,
+179,29,11,250,199,248,144,129,29,11,250,1,22,247,68,29,248,197,249,185,5,
+247,215,29,252,178,253,162,5,251,1,7,11,7,251,11,145,251,131,247,246,110,
+182,117,158,89,149,25,186,174,168,192,160,174,190,219,135,235,186,186,247,
+84,51,24,186,178,158,176,186,26,200,67,197,41,69,74,98,79,104,30,86,55,147,
+62,69,36,88,63,125,125,67,108,8,247,236,7,152,149,155,164,141,30,225,145,
+5,219,252,68,59,7,225,248,192,29,7,65,170,124,153,88,215,70,242,147,216,88,
+223,8,199,102,73,180,70,27,40,68,81,78,92,157,102,186,100,31,247,85,227,186,
+92,135,43,190,59,25,159,104,168,86,186,104,90,129,116,120,111,96,251,132,
+251,246,24,251,11,133,5,59,247,191,198,7,247,105,247,218,5,182,168,155,149,
+187,27,251,213,7,126,126,123,117,137,30,53,133,5,59,248,68,248,126,29,248,
+171,29,247,213,7,184,155,129,96,168,31,247,105,251,218,5,80,7,11,7,251,3,
+155,251,195,248,79,171,29,247,68,251,154,147,125,131,118,120,137,25,70,131,
+5,59,11,28,5,63,28,5,6,21,247,117,29,251,238,254,132,251,252,250,136,247,
+56,29,248,105,28,250,237,5,247,48,6,248,95,28,5,17,5,11,251,66,247,240,29,
+34,251,12,247,224,29,243,247,13,170,31,14,21,246,80,198,53,79,86,102,80,96,
+164,112,145,135,30,247,13,6,251,10,100,100,251,1,104,30,79,7,247,38,166,247,
+0,227,247,33,26,14,147,29,14,21,247,22,253,66,251,22,7,14,28,6,211,119,29,
+250,187,219,29,11,21,196,104,184,71,78,98,92,88,30,247,2,67,5,117,121,88,
+73,251,17,27,251,11,82,205,161,120,31,247,3,209,5,194,98,184,77,76,100,100,
+74,251,25,247,39,50,247,34,247,35,247,38,236,247,19,30,14,250,191,168,29,
+11,28,5,137,249,66,21,247,136,41,247,107,251,62,247,23,30,182,211,180,206,
+174,199,42,196,24,251,8,251,89,5,184,51,34,166,251,6,27,252,44,251,152,251,
+212,252,35,251,131,231,251,99,247,48,251,21,31,251,21,251,109,233,81,182,
+209,180,208,182,211,25,86,233,247,5,110,247,15,27,248,37,247,158,247,214,
+248,33,31,251,129,137,21,251,216,251,32,251,172,251,187,37,57,174,198,74,
+30,247,94,247,234,247,93,247,228,247,56,247,168,8,217,251,2,178,251,50,251,
+68,26,251,91,248,164,21,252,197,254,70,5,69,247,3,104,247,41,247,54,26,248,
+94,29,231,217,111,89,200,30,11,21,247,27,251,0,247,3,251,27,251,27,251,1,
+251,3,251,27,251,25,247,1,251,1,247,27,247,27,247,0,247,1,247,25,30,39,22,
+248,6,29,11,91,29,14,219,7,40,247,254,29,248,203,97,29,59,7,11,251,158,21,
+243,74,180,57,116,129,133,137,124,30,247,73,58,251,173,7,139,167,151,158,
+194,180,114,88,76,73,118,74,88,65,156,139,30,59,7,139,219,118,210,247,30,
+239,207,247,19,30,14,21,231,29,227,178,118,226,27,154,156,140,140,157,31,
+233,145,225,196,182,178,8,251,110,4,231,29,229,175,116,229,27,153,154,140,
+140,155,31,233,146,228,196,182,179,8,14,21,186,7,75,248,145,29,223,106,244,
+251,31,67,33,85,109,85,30,180,117,92,182,63,27,69,51,96,106,80,31,200,84,
+7,251,54,92,5,98,231,252,62,7,125,127,129,122,248,193,29,81,144,5,123,141,
+129,149,153,26,248,40,7,155,170,198,160,190,27,225,172,89,70,31,251,214,248,
+53,29,84,134,5,92,247,183,248,26,29,196,156,182,27,229,168,87,64,31,251,206,
+248,53,29,86,134,5,92,7,14,160,29,252,154,51,7,247,4,129,5,168,137,153,116,
+121,26,254,216,110,29,7,11,28,6,49,22,219,7,51,145,5,117,141,128,155,152,
+26,249,133,7,154,150,153,161,141,30,227,145,5,219,252,76,59,7,233,133,5,162,
+137,151,125,124,26,253,119,7,127,127,120,116,30,251,181,6,117,129,158,151,
+31,249,119,7,154,149,155,161,30,227,145,5,219,252,76,59,7,233,133,5,162,151,
+123,124,31,253,119,7,127,127,120,116,30,251,181,6,117,129,158,151,31,249,
+119,7,154,149,155,161,30,236,145,5,219,252,77,59,7,225,133,5,164,149,123,
+124,31,253,133,7,126,129,123,114,137,30,53,133,5,59,7,14,7,247,32,90,247,
+66,251,107,251,0,251,58,49,87,57,30,207,104,67,213,251,10,27,32,251,27,67,
+84,47,31,241,55,7,251,140,61,5,72,247,33,253,91,7,114,121,121,114,137,30,
+39,133,5,59,248,99,248,126,29,141,121,157,248,172,29,165,186,233,172,217,
+27,247,23,188,59,251,8,31,252,171,7,114,121,121,114,137,30,53,133,5,59,248,
+85,248,126,29,141,121,157,164,26,249,54,7,172,202,227,163,207,27,247,29,184,
+57,251,19,31,252,158,7,114,121,121,114,137,30,53,133,5,11,99,29,14,250,193,
+22,219,102,29,11,250,168,248,128,21,247,78,66,247,52,251,25,231,30,241,247,
+70,65,180,37,251,70,5,165,80,71,154,63,27,251,195,251,80,251,120,251,184,
+251,67,204,251,41,247,9,47,31,251,7,251,93,211,96,247,5,247,91,5,104,206,
+217,118,227,27,247,183,29,31,251,231,248,10,21,252,3,253,21,5,104,215,121,
+233,238,26,248,166,29,196,189,118,106,178,30,247,18,252,8,21,251,116,53,251,
+94,251,80,69,84,169,186,96,30,248,9,249,32,5,186,59,161,251,1,251,6,26,11,
+205,29,166,251,13,5,11,111,29,222,29,247,2,150,127,98,169,31,247,134,251,
+214,5,76,7,11,247,97,251,76,247,13,251,95,151,30,247,130,209,235,247,37,247,
+19,26,247,2,29,251,70,251,33,45,251,70,118,109,141,139,31,251,13,7,139,173,
+147,215,247,15,247,87,88,251,107,251,78,251,38,251,30,251,95,37,51,189,153,
+108,30,127,145,119,162,136,157,109,247,78,24,251,15,251,213,6,88,247,58,247,
+0,118,247,25,27,11,21,247,27,251,17,196,251,4,143,30,247,23,174,212,209,231,
+26,247,23,251,6,217,251,46,251,52,251,19,67,45,86,186,122,170,172,161,154,
+141,144,30,247,15,7,139,182,167,210,229,217,86,37,251,1,51,92,251,5,30,105,
+63,6,139,167,143,186,227,244,107,251,11,40,61,49,251,15,96,108,148,157,105,
+30,98,247,1,5,145,128,115,143,129,27,85,115,102,106,80,227,61,247,72,247,
+85,247,39,239,247,42,31,249,130,248,222,21,251,21,6,254,34,28,250,106,5,247,
+21,6,11,21,252,86,6,247,68,149,245,247,0,247,27,27,247,28,202,35,251,27,31,
+247,97,252,206,248,122,29,251,7,73,251,9,27,251,156,61,247,118,247,101,31,
+249,44,6,141,157,139,164,153,26,247,136,251,21,247,68,251,146,251,127,251,
+70,251,40,251,129,88,30,251,10,97,156,183,124,31,246,247,96,5,171,102,98,
+148,106,27,74,61,80,251,4,251,44,220,64,247,118,31,138,123,138,120,122,26,
+251,234,247,119,251,58,247,140,248,0,29,30,14,128,29,248,170,29,247,23,7,
+247,84,200,223,199,170,30,247,80,251,25,11,6,247,60,29,39,6,251,132,253,103,
+5,11,247,42,29,252,7,247,230,21,11,113,29,51,7,14,7,247,27,29,11,247,196,
+29,190,219,145,235,187,186,247,82,51,24,186,178,160,176,186,26,247,14,29,
+11,247,121,247,106,29,83,11,28,5,3,22,227,247,21,29,96,59,251,52,74,50,27,
+251,2,80,184,247,21,31,248,29,243,29,252,66,7,251,126,247,48,70,247,49,247,
+7,247,71,222,199,237,30,248,101,29,11,21,250,132,77,7,251,19,59,5,184,86,
+59,174,74,27,251,240,251,60,251,159,251,170,251,123,247,12,251,153,247,167,
+247,11,243,201,211,233,31,34,7,251,117,251,19,251,38,251,23,94,80,148,159,
+116,30,72,247,64,5,139,114,149,113,77,90,84,78,251,44,247,37,94,247,114,247,
+207,247,15,248,196,29,107,86,61,102,248,105,29,247,17,247,55,248,204,29,28,
+5,215,249,230,21,247,248,251,158,247,128,252,83,252,82,251,158,251,128,251,
+248,251,222,247,172,251,86,247,140,124,30,251,19,251,211,7,89,51,176,242,
+31,96,251,216,248,212,247,252,6,251,124,211,251,41,247,64,247,136,26,247,
+162,247,84,247,163,247,189,247,187,247,87,251,163,251,162,251,136,251,42,
+251,64,251,123,67,30,251,252,248,211,247,216,96,7,36,53,102,88,30,251,211,
+247,19,6,247,139,154,247,173,247,86,247,222,26,14,250,111,248,21,21,247,97,
+251,33,239,251,140,233,30,251,76,209,38,215,247,17,26,247,31,240,241,247,
+58,29,251,95,251,50,251,135,251,101,247,40,59,247,60,59,31,247,31,29,11,21,
+182,116,188,68,81,119,119,104,108,30,251,164,251,210,5,247,8,6,247,204,247,
+91,5,165,158,160,165,176,26,11,21,247,34,251,10,208,251,15,154,30,247,21,
+184,200,247,2,225,26,247,48,251,56,247,5,251,80,251,107,251,42,63,251,23,
+75,195,82,192,213,174,182,139,30,247,37,7,141,141,169,193,225,27,240,229,
+75,251,13,251,37,53,71,251,36,31,51,7,146,194,141,137,143,31,245,242,115,
+251,31,251,17,63,61,251,41,251,26,248,188,29,244,247,31,79,247,5,27,247,174,
+247,33,244,247,88,31,14,21,198,104,182,71,78,98,94,86,30,247,2,69,5,115,121,
+88,75,251,17,27,251,11,82,203,163,120,31,247,3,207,5,194,98,184,77,76,100,
+100,74,251,25,247,39,51,247,34,247,35,247,38,235,247,19,30,14,28,4,131,250,
+230,21,241,251,76,247,193,57,7,251,156,60,5,71,247,47,251,46,251,189,37,247,
+189,251,11,7,247,99,29,251,1,247,214,219,7,51,145,5,114,141,121,157,164,26,
+250,99,7,251,83,254,44,162,29,11,21,247,11,7,47,43,251,21,61,251,25,27,251,
+42,65,217,247,17,247,31,242,163,245,31,141,143,193,137,145,27,227,7,251,36,
+55,207,247,37,247,13,227,203,240,225,169,85,137,142,31,251,37,7,139,173,96,
+213,192,195,196,203,247,23,251,42,215,251,107,251,80,251,56,248,107,29,251,
+15,124,251,12,70,248,190,29,247,4,247,31,199,231,244,30,14,7,251,40,149,252,
+95,249,52,248,247,29,248,17,252,183,5,76,11,126,29,59,7,11,198,90,192,78,
+79,86,84,82,77,190,86,201,200,188,192,201,30,252,60,22,200,88,190,78,79,88,
+84,80,79,190,86,199,200,190,192,201,30,11,250,123,247,242,29,253,203,252,
+11,245,7,160,247,48,5,157,141,155,164,160,27,248,113,6,252,46,252,87,195,
+82,5,147,149,159,154,186,27,247,21,247,64,251,25,251,97,251,56,251,14,251,
+91,251,85,74,81,160,169,86,248,35,29,39,247,39,251,23,247,169,247,189,247,
+127,247,99,247,140,31,14,250,146,22,219,7,47,145,5,118,141,125,151,158,26,
+249,129,7,158,153,151,160,30,231,147,5,219,252,70,59,7,221,131,5,159,154,
+127,120,31,251,234,7,109,75,86,120,81,27,251,19,111,174,231,31,247,156,247,
+186,29,251,182,7,251,60,247,48,87,247,3,212,242,187,182,217,30,251,222,7,
+120,124,127,119,137,30,57,133,5,11,21,247,85,194,205,247,17,247,17,84,205,
+251,85,31,251,36,70,247,49,6,247,23,168,100,56,56,110,100,251,23,31,251,49,
+70,6,14,252,113,247,23,6,247,84,201,223,198,170,30,247,80,251,25,5,152,143,
+221,162,222,26,203,79,198,251,8,251,198,251,4,251,174,251,148,30,251,23,106,
+5,67,247,23,253,115,247,139,29,249,115,248,113,253,115,7,114,121,121,114,
+137,30,39,133,5,59,248,134,219,7,251,13,145,5,114,141,121,157,164,26,249,
+115,11,21,186,29,247,84,29,28,251,127,182,29,11,21,186,7,67,150,251,89,247,
+158,247,70,247,101,211,149,5,188,251,131,90,7,196,135,149,137,145,125,131,
+132,25,251,9,251,29,37,247,29,133,148,145,151,151,141,25,186,143,5,188,251,
+187,90,7,219,129,247,75,251,140,251,83,251,119,61,128,5,92,247,146,186,7,
+74,146,5,126,135,153,145,145,31,247,24,247,50,247,6,251,50,5,131,145,133,
+127,129,27,92,132,5,92,7,14,135,29,14,21,248,84,6,170,165,165,170,170,113,
+165,108,31,252,84,6,108,113,113,108,108,165,113,170,31,14,28,4,180,249,64,
+21,248,13,251,148,247,238,252,95,251,100,251,83,63,135,129,30,251,224,247,
+13,7,186,247,116,143,155,153,155,160,148,25,141,143,204,169,236,27,247,215,
+247,87,251,125,252,17,252,29,251,107,251,95,251,171,37,65,178,153,108,31,
+127,145,121,162,135,157,106,247,79,24,251,15,251,214,6,88,247,60,247,0,110,
+247,23,27,248,64,247,181,247,185,248,60,31,11,7,152,149,155,164,141,30,235,
+145,5,219,252,87,248,223,29,248,87,219,7,43,145,5,114,248,171,29,11,28,4,
+252,249,66,21,248,130,251,248,247,119,251,206,251,80,251,52,84,251,11,251,
+21,30,251,64,7,247,54,247,50,247,66,196,247,41,27,247,122,247,90,251,70,252,
+52,31,254,78,6,139,135,80,118,26,252,35,247,95,251,132,248,33,247,242,247,
+138,247,197,248,50,30,251,136,251,19,21,251,86,125,251,5,251,177,251,117,
+27,251,121,251,26,247,76,247,124,31,202,7,11,250,171,250,173,21,247,217,254,
+120,51,7,247,17,247,71,29,254,216,247,128,29,248,136,247,205,7,247,145,29,
+251,205,248,169,248,72,6,158,151,122,119,143,31,168,251,80,5,11,247,227,29,
+251,135,252,240,251,130,248,240,241,29,247,240,254,17,11,21,247,48,6,248,
+12,29,251,58,213,6,248,39,141,247,95,247,38,248,8,26,247,233,251,48,247,71,
+252,86,128,30,247,249,252,165,21,247,98,33,247,36,251,121,131,132,139,138,
+132,30,213,7,248,36,135,178,251,98,251,107,26,251,133,35,251,73,251,227,132,
+30,210,141,7,247,101,247,38,247,9,247,135,31,11,200,29,28,250,181,51,7,245,
+131,5,170,135,151,116,123,26,254,220,7,248,124,29,33,131,5,51,248,156,227,
+7,251,11,147,5,108,141,127,164,155,26,250,212,7,157,151,164,170,30,248,189,
+247,219,29,11,250,37,249,68,21,247,115,251,43,215,251,203,30,252,38,59,6,
+192,135,221,149,105,26,253,150,7,106,64,147,91,135,30,59,248,87,219,7,86,
+141,49,129,176,26,247,152,7,137,161,188,134,174,27,247,132,137,247,90,246,
+247,113,26,251,80,137,21,251,54,35,70,251,62,114,100,143,141,121,30,248,72,
+7,155,174,141,161,27,247,99,215,59,251,25,31,14,7,49,247,254,29,248,201,163,
+29,11,21,247,224,251,11,7,191,29,252,11,247,148,251,240,248,95,247,101,247,
+82,215,143,149,31,11,21,186,7,78,144,5,125,141,124,149,153,26,247,234,7,247,
+19,61,199,37,69,37,89,113,92,30,248,11,86,7,251,62,91,5,99,237,253,120,7,
+125,129,129,122,137,30,76,134,5,92,247,191,186,7,82,144,5,122,141,129,149,
+153,26,248,40,7,159,178,198,153,186,27,242,167,88,70,31,251,210,7,125,125,
+129,125,137,30,83,134,5,92,7,14,247,130,29,252,82,252,181,5,65,11,249,46,
+249,164,153,29,11,247,25,29,254,155,247,4,29,248,77,219,7,43,247,255,29,249,
+119,7,151,149,158,162,30,247,232,248,30,29,42,133,5,59,11,250,58,248,140,
+154,29,11,247,23,29,192,21,253,243,6,247,195,154,247,29,247,140,247,173,27,
+247,162,247,35,251,133,251,202,156,31,35,4,251,195,124,251,31,251,144,251,
+173,27,251,166,251,31,247,142,247,197,124,31,14,7,247,231,29,248,156,227,
+7,251,9,147,5,110,141,123,162,159,26,248,105,247,35,7,11,21,205,79,196,251,
+8,251,26,251,27,66,251,46,59,30,247,9,29,248,170,29,247,23,7,247,84,201,223,
+198,170,30,247,33,29,11,28,5,215,22,170,7,49,251,13,165,246,31,250,179,7,
+247,8,225,182,247,17,30,170,28,250,72,108,7,247,19,221,96,251,8,31,254,179,
+7,251,5,251,11,119,49,30,108,249,8,170,7,49,251,10,161,247,3,31,250,179,7,
+247,8,241,150,235,30,247,120,6,235,241,128,251,8,31,254,179,7,32,251,11,113,
+49,30,108,7,14,247,98,29,28,4,109,247,185,7,157,151,125,118,143,31,168,251,
+84,5,11,21,186,7,73,144,5,125,141,126,149,153,26,247,236,7,247,1,94,215,251,
+58,251,23,251,37,96,36,108,164,135,163,30,235,246,6,143,154,174,151,186,27,
+223,178,100,57,31,86,7,251,243,70,94,75,49,26,34,217,78,233,244,247,11,225,
+139,30,157,67,5,121,247,7,21,139,46,82,68,75,102,190,190,199,164,192,247,
+132,194,30,11,21,247,234,251,119,247,58,251,140,251,32,251,27,83,68,251,6,
+30,251,17,7,200,231,247,6,205,247,9,27,247,156,217,251,117,251,101,31,253,
+43,6,137,120,139,115,124,26,251,135,247,21,251,69,247,146,247,170,247,95,
+247,101,247,212,30,251,101,251,36,21,251,68,129,32,251,0,251,27,27,251,27,
+75,243,247,27,31,184,7,11,157,29,7,11,21,251,116,53,251,94,251,80,251,76,
+51,247,96,247,114,248,166,29,247,76,227,251,95,251,115,30,11,187,29,254,253,
+7,119,123,116,110,137,30,251,1,131,5,51,11,217,7,53,147,5,120,141,113,162,
+157,26,250,7,77,7,251,17,61,5,184,86,59,172,74,27,251,240,251,62,251,163,
+251,170,251,124,247,12,251,148,247,167,247,11,243,201,211,233,31,251,1,7,
+247,78,4,107,86,63,104,57,27,251,80,251,3,247,47,247,116,247,139,247,17,247,
+62,248,204,29,249,97,28,4,250,21,247,185,6,247,150,29,28,251,119,251,219,
+247,11,6,247,205,29,11,7,251,41,149,251,228,248,113,104,193,88,161,65,143,
+25,247,135,29,248,198,29,251,40,251,37,162,251,76,41,251,42,8,248,219,29,
+11,21,186,7,82,247,253,29,249,208,88,7,251,64,91,5,99,239,251,118,7,143,119,
+81,150,96,27,251,121,251,3,251,52,251,58,251,31,217,251,48,247,70,217,207,
+176,182,198,31,73,7,247,5,4,119,106,90,116,86,27,251,15,67,235,247,27,247,
+40,225,237,247,23,178,191,129,133,161,31,14,21,226,29,11,196,29,252,169,248,
+161,29,53,133,5,59,11,247,234,29,252,111,28,4,240,5,251,46,6,252,113,28,250,
+242,251,11,114,5,51,248,48,227,7,251,13,149,5,125,118,164,155,145,31,247,
+28,248,5,5,248,109,6,247,33,252,11,5,129,143,127,114,126,27,251,10,129,5,
+51,7,100,248,242,247,207,29,11,247,239,29,117,28,251,86,21,250,5,55,7,251,
+144,61,5,71,247,37,254,33,7,251,50,117,251,23,63,96,248,103,29,61,211,104,
+223,247,21,247,19,200,247,21,223,30,208,247,1,150,247,70,247,15,26,14,247,
+163,247,181,247,23,153,5,219,252,34,59,7,223,131,158,137,147,119,129,126,
+25,251,193,251,232,5,98,11,182,112,180,66,65,92,73,139,30,251,134,252,143,
+5,247,15,6,247,214,248,70,5,149,151,147,159,162,26,11,248,177,247,103,29,
+28,250,174,246,29,11,249,177,28,5,106,248,220,29,253,224,244,29,250,95,7,
+247,84,201,223,198,170,30,247,33,29,11,21,247,180,251,70,247,124,251,197,
+251,195,251,80,251,120,251,184,251,187,247,78,251,114,247,191,247,183,29,
+30,251,105,141,156,29,208,249,86,21,247,22,253,66,251,22,7,11,247,167,247,
+242,248,69,29,116,129,127,25,251,70,251,121,251,54,247,121,131,153,149,160,
+158,141,25,210,149,5,219,252,86,59,7,247,13,121,247,170,252,48,251,185,252,
+17,251,9,123,5,59,248,26,219,7,36,147,121,141,135,162,149,151,25,247,93,247,
+154,11,248,19,29,247,41,28,251,118,164,251,84,116,88,49,96,25,251,72,245,
+5,139,63,112,47,26,84,192,96,247,19,247,140,247,27,247,76,247,126,108,30,
+251,39,28,4,137,116,247,85,160,248,47,29,248,15,29,248,77,219,7,53,145,5,
+116,141,127,155,152,26,247,213,7,247,2,150,127,98,169,31,247,134,251,214,
+5,76,11,28,7,94,248,95,29,252,54,51,7,247,21,127,160,137,151,118,135,121,
+25,251,119,254,81,251,222,250,222,5,251,50,6,251,213,254,189,251,136,250,
+48,135,157,145,160,158,141,25,247,14,151,5,227,252,105,51,7,247,11,115,247,
+226,28,250,241,5,247,40,6,247,227,28,4,111,11,247,9,7,81,51,55,108,44,27,
+251,117,251,6,247,75,247,119,247,130,247,2,247,66,247,74,166,170,128,123,
+167,31,251,70,248,132,29,247,25,251,30,211,251,72,251,154,251,123,251,73,
+251,236,251,186,247,74,251,110,247,179,247,31,247,7,191,188,231,31,11,247,
+23,215,247,17,194,204,27,190,176,121,81,180,31,240,247,105,6,197,89,57,151,
+96,27,43,251,37,47,251,46,59,31,247,105,251,250,51,7,245,131,5,168,135,155,
+118,119,26,28,249,254,189,29,11,247,182,29,253,105,7,251,119,72,251,69,251,
+175,251,177,78,247,56,247,132,30,249,105,247,184,29,247,9,147,5,227,252,157,
+51,7,247,1,247,71,29,253,158,7,251,214,247,54,251,58,247,230,247,234,247,
+76,247,44,247,228,30,11,28,6,109,249,97,21,248,74,251,249,247,246,252,66,
+252,72,251,244,251,248,252,72,252,72,247,246,251,247,248,66,248,74,247,245,
+247,247,248,72,30,50,22,252,21,251,205,251,212,252,23,252,23,251,203,247,
+210,248,19,248,35,247,209,247,203,248,19,248,21,247,205,251,207,252,27,30,
+11,250,64,185,29,247,84,29,28,251,127,7,114,121,123,114,137,247,222,29,11,
+247,241,29,247,186,11,7,114,121,123,114,137,247,222,29,247,197,7,248,81,29,
+30,251,97,110,21,251,105,35,248,51,29,248,38,29,11,251,17,21,57,6,251,9,115,
+41,88,38,27,39,38,190,247,178,29,247,33,29,205,79,196,251,8,251,26,251,27,
+66,251,46,59,30,247,9,29,11,28,5,6,198,29,14,248,41,29,30,11,78,7,252,7,254,
+124,252,7,250,130,5,194,252,95,247,131,29,248,79,227,7,251,9,147,5,110,141,
+123,162,159,26,250,234,7,248,91,28,251,29,5,241,6,248,107,28,4,246,5,11,21,
+208,251,49,7,251,23,110,178,222,222,168,178,247,23,31,247,49,208,251,36,6,
+251,85,84,73,251,17,251,17,194,73,247,85,31,14,7,119,125,116,110,137,30,35,
+131,5,51,248,160,227,7,251,19,147,5,110,141,125,162,159,26,11,22,194,29,11,
+92,251,115,135,122,125,123,118,131,25,137,135,74,106,43,27,251,216,251,87,
+247,121,248,17,248,29,247,105,247,101,247,171,241,215,100,125,170,31,151,
+133,160,116,141,121,169,251,78,24,247,15,247,213,6,190,251,58,251,0,168,251,
+25,27,252,64,251,181,251,185,252,60,11,21,180,104,248,149,29,174,174,180,
+30,124,253,80,21,248,148,84,7,251,54,91,5,101,233,252,169,7,45,125,61,90,
+112,30,251,21,221,5,112,131,109,119,98,26,92,184,116,194,223,221,178,217,
+194,30,184,202,145,247,1,213,26,14,219,7,34,247,254,29,250,5,58,7,251,142,
+61,5,67,247,33,253,111,7,114,121,121,114,137,30,39,133,5,59,7,11,247,233,
+29,250,5,248,64,29,50,102,248,138,29,57,7,251,144,59,5,69,247,35,252,191,
+7,251,123,246,38,247,68,247,13,247,29,227,193,209,30,251,9,7,11,21,209,7,
+106,81,86,121,78,27,251,40,65,247,0,247,28,247,35,211,243,247,11,157,158,
+133,129,157,31,33,7,128,156,159,129,170,27,178,178,164,186,219,48,182,251,
+8,251,62,251,44,251,1,251,99,251,68,247,11,251,21,247,78,231,213,170,167,
+199,31,14,247,126,29,253,91,7,114,121,121,114,137,30,39,133,5,59,248,99,248,
+126,29,141,121,157,248,172,29,247,181,29,11,247,59,29,251,29,22,247,82,29,
+21,227,252,177,51,7,247,21,247,71,29,253,109,247,26,29,249,95,7,159,154,162,
+167,141,30,11,26,219,193,196,247,4,203,202,115,116,168,30,155,251,35,5,246,
+247,134,6,157,98,38,168,251,12,27,251,128,251,25,251,7,251,74,11,251,0,248,
+93,29,250,220,247,92,29,11,7,248,39,29,100,51,26,67,195,59,247,35,247,142,
+247,68,248,169,29,249,64,247,207,7,247,145,29,251,207,11,21,186,7,82,144,
+5,123,141,126,149,153,26,248,165,86,7,251,56,91,5,96,233,252,27,7,125,107,
+81,98,84,27,45,106,190,225,31,248,36,84,7,251,56,91,5,96,233,251,223,7,251,
+32,207,80,247,6,219,229,190,172,184,30,69,7,14,247,54,29,248,159,227,7,251,
+1,248,93,29,250,255,247,180,29,11,250,242,22,248,74,29,121,27,252,240,6,248,
+71,248,245,252,20,248,195,5,248,150,6,157,151,122,121,144,31,169,251,82,5,
+247,13,247,219,254,79,45,6,248,35,252,203,252,75,253,3,5,49,7,14,248,164,
+29,247,232,29,30,248,127,29,247,23,199,74,251,29,31,51,7,252,173,251,9,68,
+34,251,43,26,251,64,247,10,34,247,40,247,52,247,74,247,38,139,30,11,6,251,
+158,247,18,251,9,247,142,247,180,247,38,247,21,247,146,30,247,173,7,247,64,
+29,251,28,67,210,247,110,30,14,190,28,5,43,21,116,147,119,149,127,30,247,
+214,252,70,5,247,15,6,251,134,248,143,5,139,92,205,65,66,112,98,96,30,11,
+248,50,247,23,21,250,5,55,7,251,144,61,5,71,247,37,254,33,7,251,50,117,251,
+23,63,96,248,103,29,61,211,104,223,247,21,247,19,200,247,21,223,30,208,247,
+1,150,247,70,247,15,26,247,137,11,28,6,166,247,115,21,247,17,251,7,197,55,
+165,30,207,170,233,204,244,26,247,11,251,15,227,251,54,251,62,251,6,53,251,
+34,43,219,78,212,110,30,41,106,47,80,251,5,26,251,31,247,17,43,247,88,247,
+75,247,31,237,247,31,30,11,251,132,7,51,96,107,67,30,251,56,247,35,5,125,
+133,63,116,47,26,80,229,69,247,13,247,68,225,221,247,48,30,14,5,252,48,7,
+119,123,116,110,137,30,251,19,131,5,51,248,189,227,7,251,23,147,5,111,141,
+124,162,159,26,248,79,7,11,27,248,152,235,29,254,216,7,121,125,116,110,137,
+30,251,4,129,5,51,248,154,227,7,251,5,149,5,110,141,125,162,157,26,248,107,
+7,11,250,123,149,21,247,109,251,94,247,71,248,201,29,253,203,252,11,245,7,
+160,247,48,5,157,141,155,164,160,27,248,113,6,252,46,252,87,195,82,5,147,
+149,159,154,186,27,247,21,247,64,251,3,251,95,11,21,180,104,174,92,94,102,
+104,98,98,176,104,184,186,174,174,180,30,206,253,175,21,186,7,72,144,5,123,
+141,126,149,153,26,248,165,86,7,251,54,91,5,96,231,252,74,248,129,29,7,14,
+249,254,250,166,21,247,116,251,76,247,33,251,133,251,116,251,37,251,17,248,
+63,29,166,176,180,149,180,27,247,2,141,246,251,7,251,72,26,251,95,251,62,
+251,25,251,21,96,30,11,252,165,7,119,124,116,111,137,30,251,9,131,5,51,11,
+7,247,119,29,248,126,7,248,51,247,97,247,0,247,179,31,251,115,133,21,251,
+93,251,11,45,248,163,29,248,188,247,235,29,247,50,107,251,131,30,14,7,247,
+163,29,252,97,253,54,248,65,29,252,154,49,7,245,131,5,168,137,155,118,119,
+26,11,250,31,21,247,151,29,251,144,253,21,251,121,249,21,241,29,247,222,254,
+19,5,247,25,6,247,250,250,19,5,11,7,154,151,149,155,141,30,204,143,5,186,
+251,224,91,7,226,136,5,155,137,151,129,124,26,251,237,7,91,94,93,110,97,27,
+106,118,154,157,121,31,87,251,13,6,130,157,174,129,167,27,202,213,224,178,
+178,31,11,28,5,66,249,70,248,179,29,252,164,51,6,247,0,247,182,29,254,216,
+7,119,123,248,50,29,248,205,7,248,150,247,89,247,224,247,250,31,11,227,29,
+252,77,248,223,29,248,77,219,7,53,145,5,116,141,127,155,152,26,247,213,7,
+11,6,248,199,249,185,5,221,252,221,248,160,57,7,251,156,60,5,71,247,47,252,
+11,7,247,192,29,247,11,241,201,211,233,31,251,1,11,200,29,252,158,51,7,247,
+166,29,254,212,7,121,123,114,112,30,252,189,6,108,127,164,157,31,11,21,188,
+251,123,90,7,198,137,5,153,148,125,126,135,31,251,56,252,21,251,42,248,21,
+5,152,135,149,153,154,27,202,141,5,188,251,187,90,7,213,133,247,107,252,173,
+5,225,6,247,126,248,173,5,14,107,86,63,100,57,27,251,80,251,1,247,56,247,
+115,247,140,247,23,247,55,247,95,199,218,121,127,174,31,11,247,236,7,152,
+151,155,162,141,30,225,145,5,219,11,7,159,153,160,168,141,30,247,9,147,5,
+248,173,29,245,131,5,168,137,155,118,119,26,254,216,7,247,161,29,11,21,247,
+11,44,219,33,30,67,7,209,198,88,63,60,76,91,73,31,66,7,237,242,221,247,10,
+31,14,247,68,251,27,201,251,116,30,252,17,81,6,217,133,5,160,137,149,125,
+127,26,253,93,7,127,129,124,118,137,30,61,133,5,82,247,255,196,7,61,145,5,
+119,141,128,154,151,26,247,197,7,143,11,247,1,7,70,62,70,91,37,27,98,93,146,
+156,85,31,164,60,36,189,33,27,130,130,139,138,130,31,251,43,128,88,84,100,
+99,8,251,0,7,212,215,199,186,241,27,196,209,124,106,232,31,108,11,236,29,
+14,27,247,232,29,31,248,127,29,247,23,199,74,251,29,31,51,7,252,173,251,9,
+68,34,251,43,26,251,64,247,10,34,247,40,11,154,152,153,161,141,30,240,145,
+5,219,252,87,59,7,239,133,5,162,137,147,125,124,26,253,133,7,124,131,125,
+116,137,30,39,133,5,59,248,87,219,7,38,145,5,117,141,126,153,154,26,11,247,
+34,29,252,154,51,7,247,4,129,5,168,137,153,116,121,26,11,28,4,250,247,1,29,
+11,27,247,115,247,35,251,48,252,41,252,4,251,110,251,49,251,207,103,81,141,
+143,100,31,247,146,29,11,248,21,247,74,247,185,247,171,247,172,251,74,247,
+185,252,21,31,253,1,251,5,248,252,6,247,172,247,58,251,90,251,154,251,155,
+251,58,251,88,251,172,31,252,252,251,5,6,14,247,5,252,252,7,251,172,251,58,
+247,88,247,155,247,154,247,58,247,90,247,172,31,248,252,247,5,253,1,6,252,
+21,251,74,251,185,251,172,251,171,247,74,251,185,248,21,31,14,21,204,88,191,
+76,75,88,87,74,75,190,88,203,202,190,190,203,30,11,131,162,155,159,162,141,
+25,237,145,5,219,252,89,59,7,247,5,127,11,21,86,184,5,251,25,38,251,209,102,
+251,243,27,251,241,251,200,176,247,25,40,31,86,94,5,251,66,247,5,247,153,
+51,248,82,27,248,83,247,141,227,247,66,247,7,31,14,7,161,157,156,164,143,
+30,239,147,5,227,252,140,51,7,247,3,131,5,164,137,157,120,117,26,11,248,161,
+29,38,133,5,59,248,134,219,7,251,13,145,5,115,140,120,158,164,26,11,248,17,
+247,97,247,103,247,187,235,217,102,123,178,31,157,131,158,122,143,115,172,
+251,76,24,247,15,247,223,6,172,251,17,251,15,176,251,46,27,252,95,251,174,
+251,179,252,66,11,248,112,29,251,101,98,21,251,191,251,33,34,248,117,29,223,
+158,184,27,247,90,247,7,251,25,251,150,31,11,21,181,103,173,94,93,102,105,
+97,97,176,106,185,184,175,172,181,30,138,253,68,21,91,248,163,5,75,6,90,252,
+163,5,69,132,175,114,191,27,191,173,164,209,133,31,14,21,221,100,190,53,53,
+100,88,57,106,215,253,250,139,30,239,6,139,213,249,250,172,26,141,28,251,
+108,21,209,82,194,69,69,84,84,69,72,194,79,209,209,196,199,206,30,11,247,
+101,251,99,247,25,251,131,251,25,251,24,123,53,251,66,30,251,204,247,15,7,
+170,247,79,141,157,162,158,149,149,25,169,169,209,185,242,27,247,27,247,45,
+55,251,75,11,247,99,29,251,44,7,251,134,247,7,251,76,247,140,247,19,204,196,
+209,11,59,7,226,133,5,163,137,149,123,126,26,253,133,7,126,129,123,115,137,
+30,52,133,5,59,11,147,5,110,141,123,162,159,26,250,216,7,159,155,162,168,
+141,30,11,251,9,27,251,156,61,247,118,247,101,31,249,44,6,141,157,139,164,
+153,26,247,136,251,21,247,68,251,146,251,171,251,94,251,101,251,212,251,234,
+247,119,251,58,247,140,11,248,201,248,52,21,247,45,252,111,251,45,7,14,248,
+62,29,247,66,219,247,96,26,247,97,251,27,247,17,251,218,30,252,184,51,6,247,
+0,247,71,29,11,248,56,29,251,23,102,5,67,247,23,253,115,247,139,29,249,115,
+11,249,170,22,249,5,6,247,43,29,11,21,247,24,86,237,251,9,65,86,69,68,83,
+170,106,145,133,30,247,21,6,141,251,78,57,69,251,37,107,8,65,7,247,78,155,
+247,62,247,40,247,96,26,14,6,247,54,247,17,251,5,251,98,31,237,247,215,6,
+66,145,5,116,141,104,164,163,26,11,251,32,247,172,247,220,248,94,29,247,178,
+247,36,251,164,251,226,30,11,200,67,197,41,69,73,98,79,103,30,87,55,137,62,
+70,36,87,63,82,100,39,133,8,11,5,251,38,6,251,156,253,148,251,62,249,17,133,
+162,153,159,162,141,25,235,145,5,219,252,85,59,7,247,5,127,247,154,254,19,
+5,247,38,6,247,162,249,146,11,21,194,7,251,17,144,5,122,141,125,149,153,26,
+249,134,90,7,251,181,57,5,84,7,247,99,171,5,253,29,248,53,29,251,27,134,5,
+84,7,11,247,170,29,79,5,251,211,7,251,48,225,57,247,68,247,13,229,209,198,
+30,252,7,11,21,47,229,59,242,141,247,10,8,150,141,155,149,26,247,21,6,139,
+170,174,186,26,209,94,194,61,36,72,67,251,10,251,93,247,64,251,25,192,92,
+30,14,247,198,29,14,28,4,183,21,251,21,6,254,33,28,250,106,5,247,23,6,11,
+7,251,3,147,5,114,141,121,158,161,26,250,220,7,161,157,158,164,141,30,247,
+3,147,5,227,252,140,51,7,239,131,5,164,135,157,122,117,26,252,95,7,11,78,
+7,247,0,133,5,164,139,116,131,149,31,251,156,85,251,204,85,45,30,55,251,45,
+251,10,91,83,125,8,251,215,248,202,29,11,28,5,137,249,66,21,248,33,251,156,
+247,216,252,41,248,25,29,248,37,247,158,247,214,248,33,30,251,129,11,7,251,
+21,182,251,62,247,25,247,95,26,247,72,245,247,7,247,3,137,30,180,180,129,
+112,176,31,194,251,70,5,139,180,108,188,221,165,196,199,30,14,51,247,255,
+29,249,133,7,152,149,155,162,141,30,227,145,5,219,11,7,251,179,68,251,37,
+251,79,98,94,151,180,131,30,94,247,142,5,251,15,251,242,6,134,151,247,24,
+86,247,25,27,247,223,247,11,247,103,247,232,31,11,121,125,116,110,137,30,
+251,4,129,5,51,248,154,227,7,251,5,149,5,110,141,125,162,157,26,248,107,7,
+203,135,239,119,170,92,247,230,252,111,24,73,11,247,65,29,252,150,51,7,247,
+27,115,11,21,201,90,192,78,79,86,84,79,78,190,88,201,200,188,190,200,30,252,
+60,22,201,88,192,78,79,88,84,79,80,190,86,199,200,190,192,198,30,14,21,233,
+251,50,247,50,45,251,50,251,50,45,247,50,251,50,233,247,50,7,14,247,41,67,
+247,103,63,251,57,26,251,44,251,19,49,251,66,251,19,65,184,141,133,30,125,
+145,121,162,137,155,112,247,124,24,251,21,251,255,6,139,11,251,15,114,5,51,
+248,71,227,7,251,15,149,106,141,137,162,149,153,25,247,208,248,70,247,164,
+252,64,151,119,123,118,118,137,25,251,10,127,5,51,11,143,135,247,68,251,13,
+147,131,8,154,143,219,162,222,26,11,7,157,153,162,168,141,30,247,5,149,5,
+227,11,247,51,29,254,218,7,11,7,247,41,29,11,251,179,5,167,6,248,105,96,21,
+251,45,235,251,179,57,5,111,7,247,179,59,5,252,7,219,21,167,7,251,181,221,
+251,45,43,247,45,45,5,11,251,28,251,11,5,201,54,39,196,251,8,27,252,52,251,
+99,252,1,252,16,252,14,247,118,251,209,247,160,247,70,247,26,233,247,11,247,
+10,31,11,248,44,29,254,64,7,253,62,250,154,5,190,252,42,51,7,247,13,247,182,
+29,11,21,247,91,251,17,247,52,251,126,30,34,7,247,52,235,41,251,48,251,55,
+43,46,251,52,31,37,7,247,126,247,17,247,46,247,96,31,14,251,168,251,17,251,
+31,251,50,99,105,141,144,93,30,144,114,146,109,144,118,193,128,189,135,181,
+140,8,247,132,145,247,99,247,54,248,0,26,11,251,230,21,248,27,29,247,172,
+37,251,161,7,251,48,225,57,247,68,247,13,229,209,198,30,11,248,150,247,89,
+247,224,247,250,248,109,251,214,247,103,252,66,31,252,179,6,252,66,251,214,
+251,103,252,109,251,250,247,89,251,224,248,150,31,11,247,77,29,251,74,223,
+7,14,251,60,7,249,234,248,237,21,251,105,35,248,51,29,248,38,29,14,7,119,
+125,116,110,137,30,251,11,131,5,51,7,14,7,139,100,118,87,68,103,175,237,30,
+247,235,247,80,200,251,80,247,41,81,7,79,251,22,48,99,5,99,224,252,44,7,42,
+182,98,239,11,57,7,251,156,60,5,71,247,47,252,11,7,247,162,29,11,21,247,55,
+29,21,207,86,192,72,71,86,86,71,72,192,85,207,206,192,193,206,30,14,6,247,
+79,29,123,112,31,11,250,0,57,7,251,157,60,5,71,247,48,252,37,7,155,108,109,
+145,106,27,51,251,1,71,251,23,251,39,247,32,55,247,43,129,31,11,109,49,65,
+251,54,71,72,25,251,84,227,5,92,100,120,102,92,26,77,192,84,236,208,199,168,
+188,188,30,225,225,213,247,68,165,205,11,250,160,250,121,21,248,13,254,105,
+51,7,247,166,29,254,220,7,123,125,114,110,137,30,251,13,131,5,51,11,251,213,
+251,33,251,177,251,187,251,185,251,36,247,181,247,213,247,218,247,30,247,
+168,247,191,247,193,247,27,251,176,251,214,30,14,135,151,147,162,153,141,
+25,247,13,149,5,227,252,126,51,7,247,13,119,11,247,10,161,5,247,117,29,11,
+247,56,247,16,189,96,135,145,30,151,133,155,123,141,126,170,248,197,29,251,
+7,180,251,48,27,251,162,11,21,247,64,251,7,247,32,251,90,251,91,251,15,251,
+28,251,68,251,70,247,15,251,23,247,87,247,86,247,15,247,27,247,66,30,11,251,
+25,252,37,5,239,6,247,25,248,37,5,247,158,247,141,59,6,118,37,5,119,135,117,
+110,120,27,51,6,247,132,249,103,5,11,235,133,5,164,149,123,124,31,253,131,
+247,118,29,248,79,248,126,29,248,171,29,11,248,216,21,251,107,94,251,29,251,
+3,251,3,88,247,29,247,107,247,107,190,247,29,247,3,247,3,184,251,29,251,107,
+30,14,7,251,31,106,34,251,21,30,251,52,247,71,5,123,137,57,100,51,26,67,194,
+59,247,36,247,141,247,71,248,169,29,11,247,163,29,251,163,7,251,96,61,68,
+251,2,11,248,70,29,251,168,252,15,251,142,248,21,129,155,141,162,172,141,
+25,243,149,5,227,11,21,251,191,251,33,34,248,117,29,223,158,184,27,247,90,
+247,7,251,25,251,150,31,14,21,214,76,201,63,63,78,77,64,63,200,77,215,215,
+202,201,215,30,11,247,201,251,3,7,118,251,54,5,119,137,115,110,120,27,252,
+49,6,11,251,248,248,130,29,11,221,248,99,29,11,131,5,168,137,153,116,119,
+26,11,7,53,145,5,114,248,171,29,247,228,247,119,239,251,119,247,226,247,230,
+248,87,29,251,68,5,11,247,105,29,95,63,36,34,11,247,19,247,74,31,249,167,
+247,184,29,243,147,5,227,252,160,51,7,247,19,247,71,29,11,247,207,29,14,7,
+251,168,251,17,251,31,251,50,119,98,142,143,120,30,144,114,146,105,144,118,
+171,133,181,134,171,140,8,247,132,143,11,7,59,69,69,92,74,27,88,106,163,170,
+112,31,59,251,95,6,125,166,194,122,182,27,236,247,6,247,34,204,199,31,11,
+250,252,22,219,247,111,29,11,251,107,251,11,70,251,44,73,192,74,199,188,182,
+157,182,178,31,53,247,38,5,172,161,166,155,211,27,217,6,165,156,11,251,132,
+7,51,95,107,88,30,251,16,247,35,5,125,133,63,116,47,26,80,209,69,247,13,247,
+27,226,221,247,48,30,11,252,118,254,58,5,247,89,6,248,9,249,103,247,93,252,
+134,5,251,47,200,209,44,247,31,27,247,66,207,193,247,47,11,251,25,81,251,
+13,251,14,251,11,81,247,15,247,23,247,27,195,247,13,247,15,247,12,197,251,
+13,251,27,30,14,134,5,158,138,149,125,127,26,253,35,7,127,129,125,120,138,
+30,11,241,59,7,251,144,61,5,72,247,33,11,26,187,175,173,211,181,180,124,126,
+158,30,149,53,5,209,247,37,6,150,112,73,156,61,27,251,45,53,70,251,1,11,59,
+6,168,137,198,133,139,26,166,137,147,131,118,26,253,129,7,126,123,121,120,
+137,30,139,80,135,110,137,30,59,11,251,111,248,240,5,162,131,155,159,162,
+27,237,147,5,219,252,89,59,7,247,5,127,247,222,254,19,5,247,25,6,11,247,38,
+247,0,247,0,247,105,51,24,186,178,168,186,186,26,201,65,196,43,69,70,118,
+90,90,30,251,40,251,37,11,21,251,105,35,251,89,251,117,55,57,172,139,30,249,
+66,7,139,245,200,242,247,80,237,251,51,251,103,30,14,33,145,5,114,248,171,
+29,249,150,247,92,247,149,29,6,14,252,227,6,248,197,249,185,5,247,215,29,
+14,7,155,153,162,168,143,30,247,0,147,5,227,11,7,139,225,128,194,30,247,199,
+137,247,109,247,34,247,153,26,247,156,251,56,241,252,2,145,30,251,27,141,
+5,11,21,40,45,251,31,251,87,251,76,55,247,31,238,206,176,221,247,11,182,30,
+247,14,115,247,171,141,251,62,26,11,21,251,31,72,251,5,251,15,251,21,73,247,
+5,247,29,247,50,219,233,247,7,247,15,206,251,13,251,21,30,11,247,101,251,
+142,248,6,247,70,247,62,201,141,146,31,247,226,7,149,145,149,153,141,30,139,
+207,154,167,141,30,11,247,171,29,150,247,14,147,247,5,11,28,251,147,247,123,
+29,11,247,162,29,243,201,211,233,31,11,252,62,248,162,29,74,135,5,91,247,
+193,187,7,83,143,5,122,140,128,150,154,26,248,39,7,11,251,116,73,251,94,251,
+80,251,76,71,247,96,247,114,247,115,203,247,95,247,82,247,76,207,251,95,251,
+115,30,11,7,155,151,162,170,143,30,247,11,147,5,227,252,156,51,7,245,131,
+5,170,135,151,116,123,26,254,220,7,11,248,3,29,248,209,57,7,251,156,60,5,
+71,247,47,11,247,133,29,249,54,11,247,175,29,251,51,7,251,21,11,196,21,28,
+5,86,7,170,113,165,108,108,113,113,108,30,28,250,170,7,108,165,113,170,170,
+165,165,170,30,11,233,254,88,251,219,247,13,7,169,247,82,5,159,144,151,154,
+157,27,248,169,6,253,142,28,251,98,5,49,11,251,17,21,248,7,29,251,238,5,247,
+46,6,14,249,164,252,164,21,28,8,110,251,17,28,247,146,7,251,156,22,248,159,
+29,21,247,22,252,122,251,22,7,14,7,47,248,92,29,248,207,7,247,103,251,13,
+238,251,49,32,251,49,57,94,65,30,11,22,251,93,98,251,7,248,163,29,249,28,
+247,235,29,219,32,251,131,30,11,49,7,247,14,131,5,168,137,153,118,248,123,
+29,125,116,110,137,30,251,14,131,5,51,7,11,251,116,251,4,247,174,29,11,21,
+212,7,73,76,187,218,215,198,190,209,31,211,7,32,45,59,251,11,251,10,241,57,
+238,31,14,248,72,29,247,197,11,227,252,43,51,7,247,5,129,157,137,155,116,
+133,123,25,11,7,126,129,123,114,137,30,43,133,5,59,11,123,125,114,110,137,
+30,251,17,131,5,51,11,250,109,55,6,251,154,60,5,71,247,47,11,21,247,19,28,
+251,52,251,19,7,11,6,159,155,162,168,141,30,247,1,147,5,227,252,159,51,7,
+247,11,247,71,29,11,6,119,125,116,110,137,30,251,23,131,5,51,248,191,227,
+7,251,23,147,5,110,141,125,162,159,26,11,247,184,29,247,2,147,5,227,252,158,
+51,7,247,11,131,5,167,137,156,116,119,26,11,7,159,154,162,167,141,30,247,
+11,147,5,227,252,177,51,7,247,21,247,71,29,11,7,247,142,29,11,7,248,142,29,
+248,79,227,7,251,9,147,5,110,141,125,162,159,26,11,7,247,231,29,248,174,227,
+7,251,29,147,5,110,141,125,162,159,26,11,248,40,251,157,247,209,252,51,252,
+46,251,156,251,212,252,37,252,37,247,134,251,157,247,219,92,30,11,248,54,
+248,136,5,151,141,247,19,153,139,26,227,252,70,51,7,244,129,153,137,151,118,
+129,127,25,11,51,7,247,9,131,5,248,42,29,251,9,131,5,51,11,251,3,7,116,251,
+54,5,119,137,117,110,120,27,252,49,6,248,197,249,185,5,223,253,138,251,183,
+11,247,161,29,248,165,11,158,147,130,123,141,31,153,37,5,240,247,234,38,6,
+135,114,129,61,139,26,123,135,133,135,120,27,11,203,168,215,217,180,229,202,
+247,29,137,247,38,247,3,247,0,247,103,51,24,186,178,167,186,186,26,11,21,
+251,232,249,117,5,49,6,251,232,253,117,5,232,6,247,184,249,39,247,185,253,
+39,5,14,248,73,29,14,6,247,160,29,11,248,161,29,38,133,5,59,248,134,219,7,
+251,13,247,254,29,11,21,251,111,251,17,68,251,120,30,107,75,141,133,27,248,
+197,233,7,247,150,242,41,251,67,31,11,248,42,247,55,104,230,252,212,251,141,
+5,251,25,7,248,212,251,141,174,230,252,42,247,55,5,11,247,91,43,247,9,251,
+70,44,251,21,77,74,251,6,30,241,55,7,251,142,61,5,72,247,35,11,119,128,116,
+114,137,30,251,3,131,5,51,248,107,227,7,251,3,147,5,114,141,127,162,159,26,
+11,153,113,83,156,96,27,43,251,7,251,34,74,80,31,247,74,55,7,251,146,61,5,
+72,247,40,11,156,157,116,125,141,31,158,251,35,5,241,248,97,37,6,120,251,
+36,5,125,137,123,116,120,27,11,158,66,5,128,203,222,133,200,27,248,12,247,
+176,247,106,248,91,248,66,251,157,247,61,251,196,11,248,148,29,252,156,51,
+7,247,0,247,71,29,11,88,27,251,113,50,247,87,247,103,247,142,247,13,247,58,
+247,116,194,188,124,131,176,31,14,248,87,29,251,38,5,223,247,161,11,157,151,
+125,118,143,31,168,251,84,5,247,13,247,219,11,219,251,250,59,7,231,133,161,
+137,154,117,130,118,25,11,7,125,127,129,122,248,193,29,82,144,5,122,141,129,
+149,153,26,11,7,151,148,151,158,141,30,215,143,5,193,251,229,85,7,208,135,
+5,158,137,149,127,127,26,11,7,247,175,29,11,7,121,113,118,120,137,30,33,129,
+5,59,248,127,219,7,37,149,5,120,141,111,160,157,26,11,7,124,125,125,117,137,
+30,40,133,5,59,248,95,219,7,41,145,5,116,141,127,153,154,26,11,21,207,253,
+19,251,107,208,7,160,247,4,5,248,46,6,252,75,253,115,5,247,34,180,6,11,21,
+55,67,69,251,7,251,21,72,213,243,227,190,189,207,171,30,247,58,78,237,106,
+39,26,11,38,7,251,154,60,5,71,247,48,28,249,248,7,121,112,114,121,30,251,
+1,133,5,59,7,11,115,119,120,114,137,30,35,131,5,51,248,158,227,7,251,11,147,
+5,114,141,119,158,163,26,11,119,123,116,110,137,30,33,131,5,51,248,154,227,
+7,251,9,147,5,110,141,125,162,159,26,11,147,107,48,156,74,27,251,244,251,
+62,248,119,29,247,11,11,159,155,160,168,141,30,245,147,5,248,173,29,248,17,
+29,11,247,35,251,134,251,115,36,35,42,61,199,107,213,143,169,141,139,30,223,
+247,101,5,247,79,11,254,74,21,28,13,122,251,72,28,242,134,7,14,247,13,247,
+251,29,11,21,63,96,86,86,102,30,251,29,186,57,190,225,26,213,200,200,231,
+228,212,86,39,30,11,21,247,219,28,251,119,251,219,247,11,7,247,205,29,11,
+27,251,80,251,3,247,56,247,115,247,140,247,26,247,55,247,94,199,216,121,127,
+174,31,11,251,230,21,248,27,29,248,26,7,37,11,88,88,8,251,33,7,247,45,247,
+41,246,203,247,228,251,11,247,25,92,186,110,247,54,11,248,7,29,251,239,5,
+247,46,6,11,114,121,121,114,137,30,39,133,5,59,248,117,219,7,34,247,254,29,
+11,251,36,251,49,137,31,34,138,190,59,237,27,204,206,179,199,146,31,251,50,
+247,15,5,11,152,152,155,161,141,30,235,145,5,219,252,86,59,7,235,133,5,162,
+137,151,123,126,26,11,156,159,116,125,31,160,251,34,5,243,248,93,35,6,118,
+251,33,5,124,121,119,120,30,11,252,80,247,198,29,11,247,9,115,31,59,6,251,
+35,239,251,52,247,97,247,95,241,247,52,247,35,30,14,7,248,144,29,30,11,248,
+60,7,155,166,124,121,141,31,174,251,132,5,11,174,208,217,163,217,27,247,35,
+193,70,251,21,31,11,131,5,168,137,155,116,119,26,11,247,191,247,82,247,118,
+247,183,11,7,248,57,29,11,5,233,254,88,251,219,247,13,7,169,247,82,5,159,
+144,151,154,157,27,248,169,6,11,7,158,153,151,160,30,221,147,5,219,252,69,
+59,7,230,131,5,159,153,127,120,31,11,21,251,79,52,251,31,251,35,136,30,249,
+34,7,247,44,118,217,251,29,251,59,26,11,27,251,66,72,86,251,48,84,206,73,
+190,31,230,247,66,5,152,159,157,147,158,27,11,41,145,5,116,141,127,153,154,
+26,249,131,248,55,29,237,147,5,219,11,247,231,29,248,209,7,247,107,247,197,
+213,247,224,31,11,135,31,251,15,252,19,251,48,248,97,5,45,6,251,62,252,97,
+251,5,248,19,5,11,147,107,50,156,74,27,251,244,251,64,251,159,251,170,251,
+123,247,12,251,153,247,167,11,219,247,196,29,11,251,49,92,251,1,251,35,136,
+30,248,170,7,247,44,118,177,32,251,29,26,14,21,65,180,253,109,28,251,6,211,
+96,5,14,248,175,29,119,160,90,149,25,186,174,168,192,159,174,11,21,39,6,247,
+147,252,129,251,147,252,130,5,239,6,247,222,248,79,5,242,7,11,21,217,7,254,
+9,247,175,5,61,7,249,171,251,136,253,171,251,135,5,61,7,11,27,251,168,251,
+23,251,14,251,6,76,31,194,66,5,221,189,247,7,246,247,133,11,247,125,248,54,
+242,252,150,252,62,7,139,247,19,182,225,247,21,237,73,251,29,11,227,7,251,
+0,248,11,29,11,231,7,252,84,247,221,248,111,246,252,80,31,247,66,178,247,
+54,227,247,107,26,11,247,248,29,213,251,43,11,7,247,118,206,55,251,127,31,
+244,248,35,6,11,248,16,29,247,187,11,227,7,251,17,147,5,111,141,124,162,159,
+26,11,21,252,36,6,247,91,248,173,5,11,253,60,7,251,54,205,71,247,46,11,252,
+56,21,248,144,11,247,48,7,248,12,29,11,247,72,31,251,27,123,21,251,15,78,
+45,251,19,251,19,83,247,2,247,60,11,90,251,72,121,102,139,141,120,30,248,
+11,7,160,141,186,137,139,26,247,97,11,126,129,123,117,137,30,38,133,5,59,
+248,52,7,247,224,247,4,229,247,99,11,219,252,78,59,7,176,137,221,124,139,
+26,153,137,147,129,129,26,251,167,7,11,223,253,138,251,183,244,7,159,247,
+44,5,157,143,156,164,159,27,247,248,6,11,239,6,251,147,248,129,247,147,248,
+130,5,39,6,251,222,252,79,5,36,7,11,22,214,76,201,63,63,78,77,64,63,200,77,
+215,215,202,201,215,30,14,250,128,28,5,94,21,251,24,6,253,252,28,249,228,
+5,247,23,6,14,6,166,155,114,121,31,254,212,7,123,125,114,110,137,30,251,13,
+131,5,11,7,251,93,251,232,5,139,247,22,138,140,26,140,247,93,247,231,139,
+30,11,21,251,99,129,51,251,70,251,68,27,251,64,51,247,72,247,97,129,31,11,
+248,61,29,141,119,155,164,26,11,57,57,30,215,123,5,192,186,247,64,247,25,
+247,93,26,252,58,137,21,11,108,31,221,6,188,145,184,188,194,247,26,182,41,
+247,0,27,247,25,213,11,247,181,241,251,181,247,140,49,7,47,251,109,251,32,
+73,5,72,247,23,11,248,177,248,3,29,11,250,189,248,206,29,252,1,59,7,236,133,
+161,137,154,117,130,118,25,11,251,4,27,83,107,211,196,225,225,217,216,180,
+178,141,125,176,31,14,7,152,152,155,161,141,30,235,145,5,219,11,7,124,131,
+125,117,137,30,46,133,5,59,11,119,125,248,50,29,11,251,95,251,115,65,251,
+60,88,178,131,176,11,219,7,49,248,92,29,11,227,7,47,155,108,144,137,145,129,
+167,25,11,7,139,227,149,182,247,115,11,247,19,247,179,31,11,7,171,219,131,
+188,143,30,219,252,80,59,7,184,135,214,145,109,26,11,248,74,29,120,27,252,
+219,6,11,21,209,84,194,69,70,81,84,69,69,197,82,208,209,194,196,209,30,11,
+21,57,6,90,133,91,90,84,251,25,98,237,251,0,27,251,26,66,11,21,186,101,177,
+92,92,101,101,92,92,177,101,186,186,177,177,186,30,11,125,21,247,109,251,
+94,247,95,248,201,29,11,131,155,139,160,171,143,25,242,149,5,227,252,122,
+51,7,247,11,115,11,137,162,165,116,188,27,247,43,238,215,247,58,172,31,247,
+3,161,191,11,162,167,84,248,35,29,11,252,44,249,15,5,53,6,252,44,253,15,234,
+81,247,8,247,77,5,11,199,250,111,248,33,29,11,247,33,7,251,33,251,17,251,
+9,67,251,139,215,251,5,174,251,38,11,246,7,247,174,217,247,96,247,28,247,
+12,89,247,57,251,76,251,187,11,59,36,47,49,215,123,24,192,186,247,64,247,
+25,247,93,26,14,131,5,168,135,153,116,123,26,11,143,5,123,140,127,150,154,
+26,11,144,5,122,141,127,149,153,26,11,145,248,160,29,11,145,5,116,248,171,
+29,11,247,31,247,27,195,210,247,7,11,7,137,149,221,133,192,27,247,189,137,
+247,130,247,39,247,194,26,11,248,17,251,9,7,107,248,52,29,252,66,11,21,247,
+144,251,33,247,111,251,161,251,12,251,7,85,117,92,30,11,25,251,122,229,5,
+91,100,91,91,83,26,77,223,84,247,8,242,11,37,251,123,98,98,143,139,30,248,
+64,7,139,208,147,174,247,70,11,61,76,74,59,59,75,204,217,219,203,205,219,
+219,202,73,59,30,11,251,15,6,251,103,251,95,251,105,247,95,5,251,15,6,247,
+150,11,113,160,118,165,165,161,160,165,165,117,161,113,113,118,117,113,30,
+11,131,5,165,137,153,116,248,123,29,125,116,113,137,30,11,133,5,161,137,149,
+123,126,26,253,133,7,126,129,123,117,137,30,11,248,82,29,162,168,141,30,11,
+247,215,247,101,251,52,252,66,252,58,251,99,251,58,251,207,31,11,215,76,201,
+63,63,78,77,63,64,200,77,215,215,202,201,214,30,11,7,43,145,5,117,141,126,
+155,152,26,11,126,129,123,117,137,30,42,133,5,59,11,167,247,84,5,160,141,
+154,153,157,27,11,247,9,131,5,167,137,154,118,119,26,11,5,111,141,124,162,
+159,26,250,216,7,159,154,160,167,141,30,11,21,194,88,186,251,19,251,140,251,
+27,251,78,251,125,168,30,11,22,248,43,29,11,37,153,51,178,243,26,197,173,
+188,205,172,174,131,110,161,30,11,51,6,112,79,109,107,96,141,8,94,141,91,
+169,247,11,26,11,251,27,251,1,251,0,251,28,251,27,247,1,251,0,247,27,11,157,
+104,30,98,247,3,5,145,129,115,141,128,27,86,114,104,11,252,44,251,152,251,
+212,252,35,252,48,247,160,251,201,248,38,11,186,7,81,144,5,123,141,129,149,
+153,26,248,40,7,159,180,11,231,61,162,127,145,30,251,56,251,35,5,65,96,171,
+227,31,11,189,28,4,216,21,253,34,226,248,203,248,80,226,7,14,248,219,251,
+196,21,226,252,80,248,203,52,253,34,7,14,6,161,151,120,127,31,253,119,7,126,
+127,123,117,137,30,11,6,139,162,164,165,186,30,197,237,199,247,120,248,25,
+26,11,6,147,145,133,127,141,31,166,251,19,5,247,8,247,125,11,21,251,161,223,
+7,168,247,38,5,154,141,159,149,151,27,11,21,251,166,247,210,5,174,110,119,
+159,81,27,70,114,90,11,31,75,247,83,5,151,123,104,143,123,27,57,98,74,83,
+11,251,226,21,248,140,29,225,11,247,134,5,153,121,100,146,118,27,45,94,57,
+67,251,19,11,249,85,7,139,245,200,242,247,80,237,251,70,251,103,30,11,251,
+31,106,34,251,21,30,251,49,247,71,5,122,137,55,11,139,141,247,140,31,247,
+117,141,247,50,251,25,251,183,26,11,248,195,29,251,41,251,19,139,11,168,137,
+153,116,248,123,29,125,116,110,137,30,11,247,234,251,2,7,248,187,29,11,227,
+252,74,51,7,247,9,131,5,167,137,154,116,119,26,11,241,248,122,29,251,7,73,
+251,9,27,251,156,11,124,125,124,117,138,30,40,133,5,59,248,95,7,14,188,229,
+182,248,121,29,27,247,136,247,39,247,13,247,93,11,59,7,251,144,62,5,71,247,
+33,11,116,110,137,30,251,0,131,5,51,11,251,88,251,117,55,57,171,139,30,11,
+251,138,5,121,137,114,122,121,27,11,7,125,127,129,122,137,30,11,7,160,153,
+159,168,141,30,11,7,154,151,153,162,141,30,11,88,41,121,65,251,27,26,11,159,
+153,162,168,141,30,11,247,45,251,196,82,47,129,139,30,248,23,7,155,153,11,
+7,251,107,243,89,236,227,247,23,211,247,48,190,30,11,7,151,244,151,206,27,
+247,109,247,5,55,251,78,31,11,30,41,126,5,60,248,134,218,7,251,13,152,5,114,
+11,248,42,21,247,133,251,88,221,251,75,30,247,13,170,11,43,79,165,82,221,
+189,180,170,139,30,194,247,70,5,11,55,7,251,142,59,5,69,247,36,253,66,7,115,
+90,11,248,97,7,159,153,160,168,141,30,247,9,147,5,229,11,126,154,148,155,
+155,141,247,17,150,24,208,251,201,7,11,247,179,251,2,7,108,133,149,251,58,
+79,27,251,223,11,254,255,6,123,125,114,110,137,30,251,15,131,5,51,11,247,
+2,157,5,219,252,4,59,7,227,129,157,137,145,11,227,252,65,51,7,244,125,159,
+137,156,118,124,119,25,11,148,117,122,118,117,137,25,40,133,5,59,7,14,6,158,
+155,120,119,141,31,170,251,60,5,247,15,11,7,218,209,208,187,205,27,190,172,
+114,108,165,31,11,248,15,251,13,7,104,251,130,5,119,135,127,122,11,247,60,
+251,129,21,247,79,251,10,251,198,250,188,11,27,247,52,247,74,247,38,139,31,
+166,251,13,5,11,253,150,6,126,127,123,117,137,30,40,133,5,59,11,247,128,251,
+38,247,66,251,121,131,132,139,138,132,11,247,141,7,155,149,125,118,142,31,
+164,251,84,5,11,28,5,82,21,202,108,176,82,84,108,102,76,30,11,139,247,0,120,
+213,247,216,247,86,247,103,247,214,11,147,5,110,141,125,162,159,26,250,216,
+7,159,153,11,247,223,55,7,251,154,60,5,71,247,48,251,76,11,211,92,170,100,
+155,30,251,62,251,54,5,46,192,11,247,15,7,170,247,60,5,159,141,155,158,158,
+27,11,247,31,247,136,247,23,247,7,247,60,31,14,7,151,159,129,124,141,31,168,
+11,21,158,251,0,247,109,180,5,11,129,5,168,137,153,118,119,26,11,133,5,161,
+137,147,125,124,26,11,134,5,158,138,148,125,127,26,11,145,5,115,141,118,157,
+164,26,11,147,5,110,143,125,162,155,26,11,247,218,247,30,247,168,247,189,
+11,28,5,6,21,227,11,248,58,21,247,33,11,247,42,247,21,200,31,215,75,211,35,
+182,63,11,6,157,174,141,168,27,247,57,217,78,32,31,11,7,139,78,104,59,251,
+1,84,199,247,55,30,11,7,114,120,123,115,137,30,251,13,128,5,62,11,252,142,
+7,117,121,120,114,137,30,39,131,5,11,26,41,217,88,247,19,200,247,7,196,139,
+30,11,30,251,91,247,29,5,98,125,92,104,70,26,11,51,251,68,251,5,31,192,94,
+5,247,25,238,11,57,27,251,80,251,1,247,54,247,115,247,140,11,67,66,108,73,
+86,26,94,145,133,154,96,30,11,251,5,251,48,53,202,251,2,247,21,94,30,11,122,
+121,164,153,137,31,102,247,95,5,251,2,11,129,139,30,248,23,7,155,153,164,
+168,141,30,11,250,87,247,117,21,44,197,251,8,251,77,5,11,144,166,30,176,192,
+208,163,197,27,247,8,211,11,248,146,29,31,11,28,6,82,22,247,5,28,251,92,251,
+5,7,11,154,152,27,247,124,6,251,245,252,104,5,74,11,250,136,21,55,6,251,142,
+59,5,69,247,36,11,251,127,251,142,31,102,251,116,36,247,116,7,11,251,134,
+100,78,141,139,30,249,140,7,153,180,11,247,33,47,247,83,94,31,251,230,61,
+247,15,11,251,159,251,170,251,123,247,10,251,153,247,167,11,7,247,5,190,247,
+92,245,247,152,26,14,25,247,70,34,5,139,215,164,231,26,14,21,247,17,7,78,
+47,11,119,26,254,216,7,119,11,123,127,116,108,135,30,11,247,172,247,220,247,
+218,11,219,7,53,145,5,114,11,247,41,247,70,6,147,159,193,157,210,27,11,6,
+166,247,76,5,159,143,151,156,160,27,11,7,125,127,129,123,137,30,73,134,5,
+92,11,7,126,127,123,116,137,30,43,133,5,59,11,7,114,121,123,114,135,30,53,
+133,5,59,11,7,123,164,172,120,184,27,200,199,180,219,11,22,59,76,76,59,59,
+75,202,219,219,203,11,26,247,0,100,201,83,196,30,247,75,195,11,26,247,99,
+251,15,247,25,251,128,251,252,11,30,247,76,251,33,5,139,227,163,229,26,11,
+247,78,251,103,251,103,35,251,78,251,136,11,55,27,251,37,86,225,247,37,31,
+249,46,11,75,251,13,251,39,55,73,251,35,30,51,11,90,221,5,139,86,102,108,
+65,94,172,207,11,96,55,26,251,27,102,57,90,251,13,30,11,119,123,116,110,137,
+30,251,9,131,5,51,11,124,51,8,251,33,115,78,104,251,14,27,11,139,205,141,
+177,247,153,241,251,9,251,91,11,144,5,123,141,127,149,153,26,247,232,7,11,
+247,187,7,248,48,247,68,247,125,247,200,11,155,154,164,167,141,30,247,15,
+147,5,227,11,159,155,162,168,141,30,247,9,147,5,227,11,174,94,94,102,104,
+98,98,176,104,184,184,11,251,93,251,91,62,247,105,247,109,247,129,11,192,
+7,70,144,5,121,140,128,153,151,26,11,194,70,69,82,84,69,69,196,82,209,208,
+11,251,128,251,50,191,55,247,76,247,16,5,11,219,6,145,225,5,164,141,157,157,
+164,27,11,223,247,0,247,3,200,247,29,27,247,77,11,235,133,5,162,137,151,123,
+126,26,251,201,11,21,251,212,6,247,212,248,7,5,14,247,189,247,127,247,123,
+247,140,31,14,28,8,110,251,16,28,247,146,7,14,5,115,141,120,157,164,26,11,
+7,114,120,121,115,137,30,11,7,124,127,128,123,138,30,11,251,181,88,86,143,
+139,30,11,247,70,70,247,21,251,146,11,55,85,41,82,251,25,27,11,247,115,223,
+247,95,247,82,11,251,52,251,41,251,19,139,11,162,155,26,250,220,7,155,11,
+247,56,247,154,30,11,247,146,244,251,146,11,141,129,155,152,26,11,164,26,
+249,52,7,11,229,252,154,49,7,11,5,252,31,6,247,131,247,66,247,120,11,7,251,
+11,145,251,152,247,246,108,180,11,7,251,143,37,5,34,7,247,143,241,11,7,247,
+35,247,103,247,35,251,103,5,11,247,56,251,35,5,139,227,172,227,26,11,21,248,
+109,251,214,247,103,252,66,30,11,21,251,80,70,251,22,251,44,90,31,11,27,247,
+155,247,57,247,3,246,196,31,11,37,247,52,251,95,251,97,39,251,52,11,61,71,
+251,117,30,114,92,143,121,27,11,68,131,139,30,247,154,7,152,149,155,11,82,
+214,5,61,100,251,44,40,251,116,11,88,247,31,247,107,247,107,190,247,30,11,
+102,251,95,5,125,137,121,114,122,27,11,251,21,217,231,43,31,251,11,7,47,11,
+251,25,251,4,247,25,251,5,5,213,11,251,34,26,251,88,247,33,34,247,175,11,
+130,115,125,64,130,125,8,247,71,78,11,133,5,161,137,152,123,126,26,251,236,
+11,137,30,76,134,5,92,247,193,186,7,11,149,148,131,128,141,31,163,251,35,
+5,11,247,197,251,72,247,91,251,103,251,52,11,247,205,247,52,30,251,83,247,
+74,21,11,251,88,24,247,9,247,211,6,168,49,11,201,66,196,42,70,71,118,90,90,
+30,11,219,7,35,147,5,129,133,151,143,31,11,227,252,52,51,7,247,7,125,159,
+137,11,251,142,30,248,33,248,80,5,247,29,11,240,7,247,98,239,247,5,247,76,
+30,11,6,252,58,251,62,176,45,5,14,247,95,198,221,94,96,180,31,14,45,251,27,
+30,14,250,31,21,219,11,6,158,151,122,119,143,31,168,251,80,5,14,7,114,121,
+121,114,137,30,39,133,5,59,7,14,21,219,7,40,247,254,29,11,247,180,29,14,59,
+7,248,156,29,11,82,47,248,109,29,11,247,33,29,14,27,248,152,247,34,29,11,
+248,160,29,248,210,7,248,164,29,11,248,167,29,31,247,84,29,11,72,29,247,82,
+11,250,199,248,144,21,186,29,11,248,165,29,248,152,247,34,29,11,21,205,79,
+196,251,8,251,26,251,27,66,251,46,59,30,248,56,29,11,7,247,84,201,223,198,
+170,30,248,213,29,59,7,235,133,5,164,149,123,124,31,253,131,247,118,29,11,
+59,7,236,248,10,29,42,133,5,59,11,7,247,133,29,11,226,29,14,167,29,14,248,
+220,29,251,23,102,5,67,247,23,11,156,29,14,28,5,141,22,227,7,200,29,11,248,
+173,29,248,17,29,252,97,253,54,248,65,29,11,247,14,29,227,29,11,80,251,5,
+26,251,31,247,17,43,247,88,247,75,247,31,237,247,31,30,251,185,247,20,29,
+11,247,102,29,248,124,29,33,131,5,51,7,11,7,251,51,251,23,44,251,5,94,80,
+148,159,116,30,69,247,64,5,139,117,149,112,78,88,84,78,251,44,247,39,94,247,
+113,247,171,247,39,247,125,247,85,30,14,7,251,51,251,23,44,251,5,94,80,148,
+159,116,30,69,247,64,5,139,117,149,112,78,88,84,78,251,44,247,39,94,247,113,
+247,171,247,39,247,125,247,85,30,247,136,11,165,205,248,29,250,82,24,66,248,
+54,60,29,14,21,247,22,253,66,251,22,7,249,47,248,119,60,29,14,21,247,68,29,
+248,197,249,185,5,247,215,29,252,178,253,162,5,251,1,7,14,227,7,251,17,147,
+248,18,29,247,17,147,5,229,252,176,247,113,29,14,21,251,21,6,254,34,28,250,
+106,5,247,21,6,238,248,240,247,16,29,14,110,29,247,229,227,7,251,41,149,251,
+228,248,113,104,193,88,161,65,143,25,203,168,215,217,180,229,11,7,101,29,
+11,247,116,29,254,119,51,6,245,247,182,29,254,216,7,119,123,116,110,137,30,
+33,131,5,51,7,249,92,28,5,248,50,29,21,247,68,29,248,197,249,185,5,247,215,
+29,252,178,253,162,5,251,1,7,249,128,28,5,195,54,29,247,116,29,254,119,51,
+6,245,247,182,29,254,216,7,119,123,116,110,137,30,33,131,5,51,7,249,235,65,
+29,155,29,14,144,29,248,173,6,247,147,29,254,216,149,29,11,71,29,250,121,
+28,5,45,71,29,14,2,0,1,0,227,0,237,0,1,1,10,0,2,1,44,0,0,1,58,0,0,1,64,0,
+5,1,135,7,61,0,0,8,48,3,0,0,1,0,0,27,0,0,30,0,0,36,0,0,70,0,0,174,0,1,72,
+0,1,155,0,2,79,0,2,104,0,2,154,0,2,204,0,3,39,0,3,71,0,3,79,0,3,84,0,3,94,
+0,3,98,0,3,170,0,3,216,0,4,30,0,4,168,0,4,213,0,5,42,0,5,147,0,5,180,0,6,
+70,0,6,175,0,6,188,0,6,218,0,6,250,0,7,13,0,7,46,0,7,113,0,8,38,0,8,43,0,
+8,48,0,8,53,0,8,58,0,8,62,0,8,66,0,8,71,0,8,76,0,8,81,0,8,84,0,8,89,0,8,93,
+0,8,98,0,8,103,0,8,108,0,8,112,0,8,116,0,8,121,0,8,125,0,8,130,0,8,135,0,
+8,140,0,8,145,0,8,150,0,8,155,0,8,159,0,8,182,0,8,204,0,8,227,0,8,235,0,8,
+243,0,8,247,0,8,251,0,8,255,0,9,4,0,9,8,0,9,12,0,9,17,0,9,21,0,9,25,0,9,30,
+0,9,36,0,9,40,0,9,45,0,9,50,0,9,54,0,9,58,0,9,62,0,9,65,0,9,70,0,9,75,0,9,
+80,0,9,84,0,9,88,0,9,93,0,9,97,0,9,101,0,9,106,0,9,236,0,9,246,0,10,120,0,
+10,187,0,10,241,0,11,102,0,11,193,0,11,197,0,12,64,0,12,129,0,13,38,0,13,
+176,0,13,190,0,14,14,0,14,30,0,14,38,0,14,46,0,14,118,0,14,189,0,14,201,0,
+14,239,0,15,74,0,15,78,0,15,117,0,15,150,0,15,184,0,15,246,0,16,21,0,16,36,
+0,16,82,0,16,142,0,16,221,0,16,229,0,16,238,0,16,246,0,16,255,0,17,8,0,17,
+17,0,17,26,0,17,32,0,17,42,0,17,48,0,17,57,0,17,65,0,17,74,0,17,89,0,17,94,
+0,17,109,0,17,197,0,17,202,0,18,74,0,18,96,0,18,101,0,18,106,0,18,172,0,18,
+176,0,19,78,0,19,217,0,20,8,0,20,28,0,20,136,0,21,14,0,21,18,0,21,94,0,21,
+133,0,21,217,0,22,14,0,22,69,0,22,93,0,22,138,0,22,153,0,22,176,0,22,247,
+0,23,59,0,23,70,0,23,190,0,23,238,0,24,80,0,24,237,0,24,247,0,25,1,0,25,11,
+0,25,21,0,25,32,0,25,42,0,25,52,0,25,62,0,25,72,0,25,79,0,25,89,0,25,100,
+0,25,111,0,25,119,0,25,130,0,25,140,0,25,150,0,25,159,0,25,169,0,25,179,0,
+25,189,0,25,198,0,25,208,0,25,218,0,25,228,0,25,238,0,25,248,0,26,2,0,26,
+9,0,26,18,0,26,27,0,26,36,0,26,44,0,26,53,0,26,62,0,26,72,0,26,80,0,26,89,
+0,26,98,0,26,106,0,26,117,0,26,127,0,26,135,0,26,145,0,26,155,0,26,163,0,
+26,171,0,26,179,0,26,187,0,26,195,0,26,205,0,26,214,0,26,223,0,26,230,0,26,
+238,0,26,246,0,26,254,0,27,9,0,27,23,0,27,33,0,27,58,0,27,132,0,27,201,0,
+28,159,0,28,171,0,28,189,0,29,70,0,29,99,0,29,122,0,29,134,0,29,146,0,29,
+213,0,30,93,0,30,133,0,30,173,0,31,30,0,31,33,0,31,37,0,31,150,0,31,251,0,
+31,255,0,32,43,0,32,93,0,32,98,0,32,101,0,32,146,0,34,49,0,34,53,0,34,139,
+0,34,144,0,34,152,0,34,161,0,34,176,0,34,190,0,34,199,0,34,214,0,34,228,0,
+34,237,0,34,246,0,35,4,0,35,18,0,35,32,0,35,46,0,35,61,0,35,70,0,35,79,0,
+35,88,0,35,97,0,35,107,0,35,115,0,35,130,0,35,144,0,35,152,0,35,160,0,35,
+169,0,35,177,0,35,186,0,35,209,0,36,81,0,36,181,0,36,232,0,37,52,0,37,89,
+0,37,150,0,37,203,0,38,62,0,38,163,0,38,169,0,38,245,0,38,253,0,39,88,0,39,
+184,0,40,17,0,40,22,0,40,32,0,40,41,0,40,209,0,41,97,0,41,216,0,41,221,0,
+42,46,0,42,104,0,42,114,0,42,129,0,42,139,0,42,155,0,42,170,0,42,188,0,42,
+198,0,42,208,0,42,223,0,42,238,0,42,253,0,43,13,0,43,30,0,43,40,0,43,50,0,
+43,60,0,43,70,0,43,81,0,43,91,0,43,107,0,43,123,0,43,133,0,43,145,0,43,156,
+0,43,167,0,43,183,0,44,15,0,44,108,0,44,197,0,45,17,0,45,61,0,45,126,0,45,
+183,0,46,61,0,46,95,0,46,194,0,46,199,0,47,84,0,47,165,0,47,175,0,47,185,
+0,48,5,0,48,15,0,48,23,0,48,33,0,48,56,0,48,143,0,48,154,0,49,11,0,49,78,
+0,49,100,0,49,137,0,49,247,0,50,33,0,50,88,0,50,160,0,50,244,0,50,249,0,51,
+3,0,51,130,0,51,135,0,51,248,0,52,86,0,52,97,0,52,106,0,52,117,0,52,215,0,
+53,85,0,53,183,0,54,51,0,54,121,0,54,157,0,54,203,0,54,255,0,55,20,0,55,74,
+0,55,139,0,56,7,0,56,12,0,56,23,0,56,160,0,56,168,0,56,176,0,57,47,0,57,105,
+0,57,110,0,57,118,0,57,125,0,57,135,0,57,146,0,57,158,0,57,169,0,57,185,0,
+57,226,0,57,249,0,58,69,0,58,79,0,58,152,0,58,255,0,59,70,0,59,191,0,59,199,
+0,60,19,0,60,32,0,60,79,0,60,84,0,60,95,0,60,178,0,61,22,0,61,27,0,61,37,
+0,61,42,0,61,47,0,61,141,0,61,152,0,61,163,0,61,174,0,61,185,0,61,201,0,61,
+248,0,62,10,0,62,23,0,62,101,0,63,7,0,63,166,0,64,65,0,64,193,0,64,220,0,
+65,80,0,65,192,0,65,197,0,66,32,0,66,133,0,66,143,0,66,251,0,67,0,0,67,10,
+0,67,14,0,67,18,0,67,26,0,67,33,0,67,41,0,67,51,0,67,61,0,67,71,0,67,80,0,
+67,90,0,67,149,0,67,153,0,67,168,0,67,177,0,67,213,0,68,38,0,68,74,0,68,114,
+0,68,215,0,69,1,0,69,29,0,69,41,0,69,53,0,69,94,0,69,193,0,70,69,0,70,112,
+0,70,115,0,70,118,0,70,227,0,71,88,0,71,93,0,71,164,0,71,203,0,71,213,0,71,
+223,0,71,233,0,71,242,0,71,253,0,72,7,0,72,11,0,72,15,0,72,66,0,72,140,0,
+72,241,0,72,254,0,73,11,0,73,25,0,73,39,0,73,96,0,73,183,0,73,188,0,73,225,
+0,73,248,0,74,87,0,74,104,0,74,229,0,75,226,0,75,230,0,76,53,0,76,61,0,76,
+68,0,76,76,0,76,85,0,76,99,0,76,108,0,76,123,0,76,137,0,76,152,0,76,161,0,
+76,170,0,76,178,0,76,187,0,76,196,0,76,205,0,76,220,0,76,235,0,76,244,0,76,
+252,0,77,4,0,77,14,0,77,23,0,77,32,0,77,95,0,77,103,0,77,118,0,77,147,0,77,
+158,0,77,168,0,77,176,0,77,212,0,77,215,0,77,218,0,77,221,0,78,43,0,78,116,
+0,78,125,0,78,153,0,79,41,0,79,136,0,79,144,0,79,235,0,79,247,0,79,255,0,
+80,92,0,80,105,0,80,246,0,81,97,0,81,186,0,82,16,0,82,111,0,82,238,0,82,243,
+0,82,252,0,83,36,0,83,65,0,83,109,0,83,113,0,83,195,0,83,235,0,83,245,0,83,
+255,0,84,14,0,84,24,0,84,40,0,84,55,0,84,71,0,84,81,0,84,91,0,84,98,0,84,
+108,0,84,118,0,84,128,0,84,144,0,84,160,0,84,167,0,84,177,0,84,187,0,84,196,
+0,84,203,0,84,210,0,84,217,0,84,232,0,84,241,0,84,255,0,85,93,0,85,102,0,
+85,140,0,85,207,0,85,239,0,86,70,0,86,152,0,86,156,0,86,160,0,86,171,0,87,
+55,0,87,194,0,88,80,0,88,84,0,88,94,0,88,128,0,88,155,0,88,209,0,89,28,0,
+89,38,0,89,52,0,89,62,0,89,109,0,89,136,0,89,141,0,89,151,0,89,202,0,89,253,
+0,90,2,0,90,11,0,90,43,0,90,70,0,90,93,0,90,119,0,90,183,0,90,192,0,90,239,
+0,90,255,0,91,24,0,91,104,0,91,108,0,91,170,0,91,197,0,91,205,0,92,1,0,92,
+22,0,92,44,0,92,69,0,92,207,0,92,216,0,92,225,0,92,234,0,92,243,0,92,252,
+0,93,6,0,93,17,0,93,150,0,93,253,0,94,3,0,94,104,0,94,118,0,94,229,0,95,141,
+0,95,243,0,96,88,0,96,184,0,97,32,0,97,106,0,97,117,0,97,127,0,97,138,0,97,
+149,0,97,159,0,97,170,0,97,180,0,97,217,0,98,46,0,98,168,0,99,19,0,99,88,
+0,99,227,0,100,77,0,100,182,0,100,247,0,101,82,0,101,90,0,101,97,0,101,106,
+0,101,116,0,101,126,0,101,135,0,101,142,0,101,151,0,101,157,0,101,164,0,101,
+178,0,101,181,0,101,184,0,102,38,0,102,104,0,102,196,0,102,255,0,103,89,0,
+103,104,0,103,183,0,103,204,0,104,45,0,104,135,0,104,156,0,104,202,0,104,
+206,0,104,246,0,105,5,0,105,40,0,105,74,0,105,117,0,105,147,0,106,3,0,106,
+48,0,106,101,0,106,141,0,106,188,0,106,198,0,106,217,0,107,33,0,107,61,0,
+107,80,0,107,84,0,107,106,0,107,140,0,107,145,0,107,148,0,107,151,0,107,213,
+0,107,224,0,107,235,0,107,243,0,107,253,0,108,5,0,108,12,0,108,20,0,108,79,
+0,108,129,0,108,166,0,108,199,0,108,203,0,108,241,0,109,6,0,109,183,0,109,
+212,0,109,216,0,109,228,0,110,55,0,110,76,0,110,113,0,110,117,0,110,131,0,
+110,228,0,111,4,0,111,36,0,111,79,0,111,92,0,111,113,0,111,165,0,111,195,
+0,111,214,0,111,237,0,112,18,0,112,22,0,112,27,0,112,32,0,112,91,0,112,100,
+0,112,107,0,112,117,0,112,127,0,112,138,0,112,149,0,112,160,0,112,172,0,112,
+180,0,112,197,0,112,208,0,112,216,0,112,224,0,112,234,0,112,249,0,113,39,
+0,113,102,0,113,164,0,113,219,0,113,227,0,113,236,0,113,246,0,114,0,0,114,
+13,0,114,40,0,114,87,0,114,127,0,115,4,0,115,9,0,115,14,0,115,59,0,115,64,
+0,115,113,0,115,144,0,115,199,0,115,210,0,115,221,0,115,232,0,115,243,0,115,
+254,0,116,10,0,116,18,0,116,35,0,116,46,0,116,57,0,116,65,0,116,73,0,116,
+83,0,116,124,0,116,155,0,116,228,0,116,255,0,117,8,0,117,16,0,117,27,0,117,
+37,0,117,47,0,117,101,0,117,197,0,118,5,0,118,11,0,118,19,0,118,28,0,118,
+36,0,118,45,0,118,61,0,118,131,0,118,247,0,118,252,0,119,4,0,119,69,0,119,
+159,0,119,186,0,119,222,0,120,21,0,120,60,0,120,152,0,120,195,0,120,225,0,
+121,20,0,121,59,0,121,138,0,121,180,0,121,183,0,121,245,0,122,54,0,122,63,
+0,122,93,0,122,143,0,122,183,0,122,218,0,123,33,0,123,76,0,123,113,0,123,
+185,0,123,211,0,123,233,0,124,28,0,124,53,0,124,82,0,124,142,0,124,226,0,
+125,37,0,125,46,0,125,56,0,125,65,0,125,71,0,125,79,0,125,123,0,125,166,0,
+125,233,0,126,21,0,126,90,0,126,178,0,126,199,0,127,25,0,127,28,0,127,31,
+0,127,40,0,127,58,0,127,77,0,127,112,0,127,205,0,128,35,0,128,107,0,128,112,
+0,128,123,0,128,130,0,128,148,0,128,236,0,129,73,0,129,83,0,129,93,0,129,
+102,0,129,110,0,129,120,0,129,170,0,129,245,0,130,42,0,130,110,0,130,225,
+0,130,246,0,131,71,0,131,198,0,131,203,0,131,213,0,131,232,0,132,6,0,132,
+40,0,132,124,0,132,210,0,133,36,0,133,41,0,133,49,0,133,57,0,133,76,0,133,
+81,0,133,94,0,133,135,0,133,146,0,133,156,0,133,167,0,133,175,0,133,189,0,
+133,199,0,133,208,0,133,219,0,134,9,0,134,53,0,134,89,0,134,125,0,134,175,
+0,135,22,0,135,52,0,135,102,0,135,192,0,135,249,0,136,25,0,136,59,0,136,104,
+0,136,133,0,136,141,0,136,191,0,136,224,0,137,37,0,137,140,0,137,184,0,138,
+29,0,138,144,0,139,21,0,139,125,0,139,129,0,139,179,0,139,200,0,140,4,0,140,
+14,0,140,23,0,140,32,0,140,39,0,140,52,0,140,61,0,140,71,0,140,81,0,140,115,
+0,140,149,0,140,193,0,141,21,0,141,68,0,141,103,0,141,136,0,141,186,0,141,
+195,0,141,204,0,141,249,0,141,254,0,142,94,0,142,101,0,142,107,0,142,117,
+0,142,128,0,142,136,0,142,148,0,142,216,0,143,140,0,143,163,0,144,20,0,144,
+129,0,144,149,0,145,13,0,145,35,0,145,165,0,146,34,0,146,49,0,146,64,0,146,
+70,0,146,75,0,146,152,0,146,237,0,146,247,0,147,2,0,147,10,0,147,75,0,147,
+79,0,147,196,0,148,13,0,148,119,0,148,128,0,149,54,0,149,113,0,149,168,0,
+149,178,0,149,186,0,149,196,0,149,205,0,149,214,0,149,223,0,149,229,0,149,
+237,0,150,53,0,150,113,0,150,195,0,150,226,0,151,32,0,151,120,0,151,137,0,
+151,230,0,152,86,0,152,186,0,153,18,0,153,33,0,153,61,0,153,71,0,153,76,0,
+153,85,0,153,93,0,153,107,0,153,118,0,153,126,0,153,189,0,154,2,0,154,88,
+0,154,98,0,154,108,0,154,118,0,154,128,0,154,139,0,154,150,0,154,162,0,154,
+173,0,155,86,0,155,186,0,155,250,0,156,26,0,156,114,0,156,204,0,157,23,0,
+157,80,0,157,89,0,157,100,0,158,35,0,158,40,0,158,50,0,158,58,0,158,79,0,
+158,87,0,158,98,0,158,102,0,158,169,0,158,177,0,158,184,0,158,193,0,158,201,
+0,158,214,0,158,222,0,158,236,0,158,249,0,159,9,0,159,17,0,159,25,0,159,33,
+0,159,46,0,159,55,0,159,64,0,159,72,0,159,85,0,159,98,0,159,106,0,159,115,
+0,159,124,0,159,134,0,159,143,0,159,153,0,159,208,0,159,240,0,160,115,0,160,
+118,0,160,121,0,160,168,0,160,177,0,161,2,0,161,72,0,161,155,0,162,21,0,162,
+29,0,162,187,0,163,17,0,163,107,0,163,112,0,163,121,0,163,130,0,163,139,0,
+163,149,0,163,160,0,164,0,0,164,150,0,164,224,0,165,88,0,165,228,0,166,128,
+0,166,209,0,167,18,0,167,164,0,167,206,0,167,242,0,168,34,0,168,83,0,168,
+88,0,168,163,0,168,241,0,168,250,0,169,3,0,169,17,0,169,26,0,169,41,0,169,
+55,0,169,72,0,169,82,0,169,93,0,169,103,0,169,118,0,169,129,0,169,140,0,169,
+149,0,169,164,0,169,179,0,169,189,0,169,200,0,169,210,0,169,221,0,169,231,
+0,169,242,0,169,252,0,170,12,0,170,16,0,170,20,0,170,30,0,170,155,0,170,227,
+0,171,105,0,171,114,0,171,233,0,172,94,0,172,99,0,172,109,0,172,119,0,172,
+129,0,172,139,0,172,150,0,173,45,0,173,190,0,174,44,0,174,198,0,175,84,0,
+175,199,0,176,66,0,176,70,0,176,182,0,177,30,0,177,70,0,177,172,0,178,18,
+0,178,26,0,178,35,0,178,76,0,178,209,0,178,220,0,179,41,0,179,96,0,179,201,
+0,179,246,0,180,4,0,180,140,0,180,226,0,181,52,0,181,142,0,181,235,0,182,
+59,0,182,215,0,183,93,0,183,255,0,184,110,0,184,118,0,184,126,0,184,232,0,
+184,236,0,185,66,0,185,70,0,185,74,0,185,82,0,185,91,0,185,141,0,185,205,
+0,186,30,0,186,112,0,186,249,0,187,74,0,187,115,0,187,207,0,188,50,0,188,
+226,0,189,128,0,189,164,0,189,200,0,190,26,0,190,117,0,191,4,0,191,7,0,191,
+46,0,191,146,0,192,12,0,192,63,0,192,173,0,192,212,0,192,216,0,193,72,0,193,
+131,0,193,237,0,194,49,0,194,120,0,194,129,0,194,136,0,194,145,0,194,154,
+0,194,163,0,194,172,0,194,182,0,194,193,0,194,204,0,194,221,0,194,231,0,194,
+244,0,195,15,0,195,24,0,195,61,0,195,103,0,195,135,0,195,231,0,196,39,0,196,
+106,0,196,124,0,196,154,0,196,168,0,196,186,0,196,232,0,197,19,0,197,35,0,
+197,78,0,197,85,0,197,97,0,197,166,0,197,213,0,197,248,0,198,97,0,198,160,
+0,198,169,0,198,178,0,198,187,0,198,196,0,198,206,0,198,216,0,198,228,0,198,
+246,0,199,1,0,199,98,0,199,206,0,200,40,0,200,143,0,200,218,0,201,45,0,201,
+54,0,201,73,0,201,200,0,202,75,0,202,138,0,202,231,0,203,124,0,204,4,0,204,
+134,0,204,228,0,205,66,0,205,71,0,205,76,0,205,230,0,206,80,0,206,181,0,206,
+228,0,207,64,0,207,73,0,207,88,0,207,97,0,207,112,0,207,122,0,207,133,0,207,
+149,0,207,159,0,207,169,0,207,237,0,208,46,0,208,154,0,208,163,0,208,228,
+0,209,41,0,209,148,0,209,157,0,209,232,0,210,78,0,210,91,0,210,202,0,211,
+136,0,211,247,0,212,114,0,212,124,0,212,140,0,212,149,0,212,163,0,212,173,
+0,212,183,0,212,198,0,212,207,0,212,216,0,213,20,0,213,62,0,213,189,0,214,
+80,0,215,45,0,215,62,0,215,71,0,215,79,0,215,90,0,215,101,0,215,110,0,215,
+120,0,215,131,0,215,141,0,215,151,0,215,160,0,215,213,0,216,3,0,216,45,0,
+216,54,0,216,121,0,216,182,0,216,240,0,217,71,0,217,114,0,217,138,0,217,242,
+0,218,102,0,218,177,0,218,200,0,219,14,0,219,68,0,219,79,0,219,90,0,219,121,
+0,219,166,0,219,171,0,219,236,0,220,36,0,220,46,0,220,75,0,220,85,0,220,96,
+0,220,107,0,220,119,0,220,130,0,220,141,0,220,171,0,220,211,0,220,227,0,221,
+19,0,221,37,0,221,82,0,221,158,0,221,224,0,222,6,0,222,14,0,222,67,0,222,
+157,0,223,18,0,223,86,0,223,94,0,223,101,0,223,111,0,223,120,0,223,128,0,
+223,137,0,223,147,0,223,157,0,223,172,0,223,182,0,223,193,0,223,209,0,223,
+225,0,223,241,0,223,252,0,224,6,0,224,15,0,224,24,0,224,31,0,224,39,0,224,
+45,0,224,56,0,224,65,0,224,161,0,224,245,0,224,250,0,225,4,0,225,13,0,225,
+23,0,225,33,0,225,45,0,225,120,0,225,126,0,225,196,0,225,246,0,226,70,0,226,
+143,0,226,214,0,227,36,0,227,122,0,227,228,0,228,56,0,228,101,0,228,179,0,
+228,188,0,228,198,0,228,208,0,228,218,0,228,228,0,228,238,0,228,253,0,229,
+7,0,229,18,0,229,34,0,229,50,0,229,66,0,229,77,0,229,88,0,229,98,0,229,109,
+0,229,120,0,229,132,0,229,144,0,229,155,0,229,231,0,230,49,0,230,54,0,230,
+64,0,230,73,0,230,83,0,230,93,0,230,105,0,230,190,0,230,250,0,231,33,0,231,
+73,0,231,181,0,231,185,0,231,229,0,231,238,0,231,245,0,231,253,0,232,8,0,
+232,32,0,232,59,0,232,108,0,232,220,0,233,22,0,233,63,0,233,107,0,233,118,
+0,233,130,0,233,142,0,233,192,0,233,252,0,234,148,0,235,25,0,235,150,0,235,
+238,0,235,246,0,235,254,0,236,3,0,236,61,0,236,119,0,236,129,0,236,141,0,
+236,221,0,236,248,0,237,5,0,237,19,0,237,39,0,237,105,0,237,150,0,238,29,
+0,238,34,0,238,115,0,238,125,0,238,135,0,238,145,0,238,155,0,238,165,0,238,
+176,0,238,188,0,238,240,0,239,104,0,239,189,0,240,51,0,240,181,0,240,186,
+0,241,11,0,241,96,0,241,106,0,241,116,0,241,126,0,241,136,0,241,146,0,241,
+158,0,241,225,0,242,170,0,242,174,0,242,178,0,243,26,0,243,34,0,243,41,0,
+243,48,0,243,57,0,243,100,0,243,148,0,243,201,0,243,219,0,243,228,0,243,241,
+0,244,99,0,244,107,0,244,115,0,244,120,0,244,125,0,244,133,0,244,143,0,244,
+196,0,245,20,0,245,39,0,245,49,0,245,61,0,245,65,0,245,141,0,245,150,0,245,
+159,0,245,167,0,245,176,0,245,184,0,245,192,0,245,200,0,245,208,0,245,217,
+0,245,227,0,245,236,0,245,247,0,246,53,0,246,148,0,246,235,0,247,34,0,247,
+99,0,247,180,0,247,229,0,248,41,0,248,45,0,248,52,0,248,148,0,248,167,0,248,
+176,0,249,40,0,249,45,0,249,129,0,249,139,0,249,149,0,249,159,0,249,169,0,
+249,179,0,249,189,0,249,201,0,250,14,0,250,48,0,250,120,0,250,229,0,250,234,
+0,250,243,0,250,253,0,251,7,0,251,17,0,251,21,0,251,29,0,251,96,0,251,129,
+0,251,139,0,252,13,0,252,168,0,253,11,0,253,66,0,253,77,0,253,87,0,253,98,
+0,253,108,0,253,116,0,253,175,0,253,250,0,254,62,0,254,108,0,254,218,0,255,
+64,0,255,153,0,255,194,0,255,218,0,255,248,1,0,125,1,0,182,1,0,192,1,0,202,
+1,0,212,1,0,221,1,0,228,1,1,17,1,1,58,1,1,83,1,1,113,1,1,234,1,1,237,1,1,
+240,1,1,243,1,2,87,1,2,97,1,2,157,1,2,249,1,3,88,1,3,194,1,4,38,1,4,117,1,
+4,221,1,4,226,1,5,54,1,5,158,1,5,169,1,6,23,1,6,135,1,6,218,1,7,71,1,7,85,
+1,7,177,1,8,11,1,8,99,1,8,126,1,8,141,1,8,229,1,9,64,1,9,92,1,9,106,1,9,133,
+1,9,224,1,10,76,1,10,162,1,11,135,1,11,205,1,12,178,1,12,251,1,13,63,1,13,
+72,1,13,112,1,13,175,1,14,21,1,14,39,1,14,142,1,14,177,1,14,212,1,14,224,
+1,14,241,1,14,254,1,15,16,1,15,68,1,15,111,1,15,207,1,16,52,1,16,60,1,16,
+131,1,16,211,1,17,35,1,17,66,1,17,98,1,17,201,1,18,48,1,18,136,1,18,145,1,
+18,236,1,19,70,1,19,157,1,19,162,1,19,202,1,19,214,1,19,225,1,19,249,1,20,
+4,1,20,22,1,20,38,1,20,69,1,20,92,1,20,98,1,20,150,1,20,158,1,20,168,1,20,
+182,1,20,213,1,20,244,1,21,2,1,21,15,1,21,19,1,21,27,1,21,31,1,21,35,1,21,
+42,1,21,70,1,21,150,1,21,185,1,21,206,1,21,212,1,21,216,1,21,220,1,21,224,
+1,21,233,1,21,242,1,21,250,1,22,4,1,22,41,1,22,79,1,22,97,1,22,102,1,22,120,
+1,22,125,1,22,144,1,22,149,1,22,168,1,22,173,1,22,208,1,22,215,1,22,253,1,
+23,33,1,23,40,1,23,78,1,23,99,1,23,106,1,23,127,1,23,148,1,23,155,1,23,176,
+1,23,210,1,24,15,1,24,21,1,24,56,1,24,90,1,24,151,1,24,185,1,24,193,1,24,
+212,1,24,247,1,24,251,1,24,255,1,25,63,1,25,84,1,25,107,1,25,195,1,25,203,
+1,25,216,1,26,65,1,26,72,1,26,84,1,26,189,1,26,203,1,26,217,1,26,224,1,26,
+241,1,27,1,1,27,38,1,27,43,1,27,48,1,27,53,1,27,69,1,27,85,1,27,100,1,27,
+105,1,27,117,1,27,131,1,27,142,1,27,153,1,27,163,1,27,170,1,27,175,1,27,184,
+1,27,191,1,27,202,1,27,213,1,27,229,1,27,238,1,27,246,1,27,252,1,28,1,1,28,
+11,1,28,18,1,28,23,1,28,31,1,28,39,1,28,45,1,28,50,1,28,60,1,28,68,1,28,74,
+1,28,89,1,28,122,1,28,128,1,28,136,1,28,142,1,28,172,1,28,178,1,28,220,1,
+28,246,1,29,29,1,29,50,1,29,77,1,29,123,1,29,127,1,29,134,1,29,146,1,29,186,
+1,29,208,1,29,214,1,29,221,1,29,252,1,30,3,1,30,8,1,30,15,1,30,44,1,30,71,
+1,30,112,1,30,141,1,30,170,1,30,228,1,31,32,1,31,39,1,31,43,1,31,49,1,31,
+56,1,31,139,1,31,143,1,31,147,1,31,153,1,31,158,1,31,178,1,31,210,1,31,236,
+1,32,11,1,32,60,1,32,91,1,32,169,1,32,176,1,32,185,1,32,236,1,33,41,1,33,
+100,1,33,108,1,33,114,1,33,123,1,33,130,1,33,137,1,33,145,1,33,151,1,33,166,
+1,33,174,1,33,179,1,33,204,1,33,233,1,34,4,1,34,31,1,34,39,1,34,49,1,34,122,
+1,34,149,1,34,193,1,34,198,1,34,202,1,34,206,1,34,213,1,34,222,1,34,228,1,
+34,235,1,34,244,1,35,16,1,35,24,1,35,30,1,35,38,1,35,140,1,35,147,1,35,155,
+1,35,165,1,35,173,1,35,179,1,35,188,1,35,197,1,35,204,1,36,2,1,36,51,1,36,
+69,1,36,86,1,36,93,1,36,105,1,36,117,1,36,138,1,36,159,1,36,167,1,36,192,
+1,36,201,1,36,211,1,36,229,1,36,249,1,37,11,1,37,31,1,37,50,1,37,68,1,37,
+88,1,37,105,1,37,112,1,37,121,1,37,157,1,37,196,1,37,234,1,37,253,1,38,24,
+1,38,50,1,38,58,1,38,70,1,38,85,1,38,89,1,38,95,1,38,161,1,38,168,1,38,175,
+1,38,194,1,38,215,1,38,239,1,39,36,1,39,50,1,39,62,1,39,74,1,39,86,1,39,96,
+1,39,110,1,39,122,1,39,134,1,39,146,1,39,158,1,39,167,1,39,175,1,39,183,1,
+39,191,1,39,198,1,39,207,1,39,215,1,39,223,1,39,231,1,39,238,1,40,71,1,40,
+87,1,40,102,1,40,144,1,40,168,1,40,192,1,40,219,1,40,242,1,41,2,1,41,39,1,
+41,57,1,41,73,1,41,91,1,41,107,1,41,123,1,41,133,1,41,150,1,41,174,1,41,192,
+1,41,206,1,41,243,1,42,33,1,42,65,1,42,98,1,42,139,1,42,172,1,42,210,1,43,
+2,1,43,41,1,43,80,1,43,119,1,43,158,1,43,224,1,43,253,1,44,25,1,44,34,1,44,
+65,1,44,73,1,44,100,1,44,107,1,44,135,1,44,162,1,44,171,1,44,179,1,44,185,
+1,44,213,1,44,240,1,44,252,1,45,29,1,45,162,1,46,39,1,46,117,1,46,218,1,46,
+226,1,46,234,1,46,242,1,46,250,1,47,12,1,47,64,1,47,82,1,47,100,1,47,101,
+1,47,102,1,47,103,1,47,104,1,47,105,1,47,106,1,47,107,1,47,108,1,47,109,1,
+47,110,1,47,111,1,47,112,1,47,113,1,47,114,1,47,115,1,47,116,1,47,117,1,47,
+118,1,47,119,1,47,120,1,47,121,1,47,122,1,47,123,1,47,126,1,47,129,1,47,132,
+1,47,135,1,47,138,1,47,141,1,47,144,1,47,146,1,47,149,1,47,151,1,47,154,1,
+47,157,1,48,30,1,48,35,1,48,40,1,48,45,1,48,50,1,48,145,247,196,239,22,28,
+4,176,28,7,8,28,251,80,6,189,89,21,250,224,28,249,92,254,224,6,14,252,132,
+14,252,40,248,107,232,29,252,50,248,230,248,80,29,208,252,136,5,172,6,251,
+152,248,136,21,202,110,176,82,84,106,102,76,30,211,252,136,5,172,6,14,248,
+62,28,5,117,249,242,21,244,251,179,7,247,48,248,86,251,1,172,251,54,252,119,
+5,251,191,6,247,50,248,86,35,172,251,56,252,119,5,252,3,34,247,224,6,39,251,
+185,5,251,216,37,247,183,6,251,56,252,115,239,104,247,66,248,150,5,247,189,
+6,251,51,252,117,241,106,247,64,248,150,5,248,3,241,251,222,6,235,247,185,
+5,251,4,22,38,251,185,5,251,189,6,240,247,185,5,14,196,250,158,248,25,21,
+247,173,251,119,202,251,70,192,30,248,124,7,247,0,211,120,105,170,31,169,
+251,109,5,246,247,215,6,139,251,64,186,251,68,30,247,40,45,251,46,7,251,54,
+114,251,113,35,251,140,26,251,127,247,94,42,247,70,98,30,252,154,7,251,4,
+251,17,166,184,102,31,102,247,121,5,37,251,240,6,247,31,98,247,64,133,241,
+133,8,251,103,234,247,103,7,247,27,147,247,164,247,21,247,144,26,252,135,
+248,60,21,55,170,251,1,194,247,25,26,247,27,223,215,247,1,162,30,247,205,
+254,40,21,251,39,34,65,251,8,119,30,248,121,7,247,8,102,244,82,251,42,26,
+14,249,45,28,6,160,248,33,21,247,136,36,248,137,29,251,135,243,251,79,247,
+103,247,103,242,247,79,247,135,30,251,208,250,101,21,251,19,6,253,250,28,
+250,162,5,247,21,6,247,74,247,73,10,249,224,252,216,21,251,107,94,251,31,
+251,3,251,2,248,186,29,247,2,247,3,184,251,30,251,107,30,254,125,247,62,29,
+247,228,28,5,111,22,227,7,251,75,149,251,58,247,83,199,221,215,247,17,178,
+247,31,25,247,39,161,5,225,252,56,53,7,247,3,123,157,137,158,114,137,127,
+25,128,59,78,35,96,83,251,236,248,7,24,247,41,207,247,44,229,247,93,26,247,
+70,251,46,247,23,251,99,251,113,251,60,251,33,251,97,251,46,247,19,251,7,
+184,94,30,251,53,72,251,5,251,5,251,72,26,251,126,247,84,251,64,247,126,247,
+84,247,9,232,223,246,30,231,36,5,90,7,251,163,250,203,21,251,29,72,59,251,
+11,80,30,65,210,251,8,236,247,29,26,245,212,225,247,3,247,23,200,35,251,9,
+30,247,5,253,236,21,80,69,62,84,251,17,27,251,58,251,23,247,27,247,76,247,
+15,204,213,221,196,31,14,252,226,248,62,28,4,238,21,247,10,71,211,37,61,94,
+84,69,92,170,248,65,10,247,250,29,251,218,249,82,251,183,21,229,7,251,180,
+186,36,247,181,248,91,26,248,90,242,247,179,247,180,186,30,229,7,252,64,92,
+251,45,252,21,252,82,26,252,83,247,45,252,23,248,64,92,30,14,251,218,249,
+31,248,226,21,248,82,251,45,248,21,252,64,186,30,49,7,247,180,92,240,251,
+179,252,90,26,252,91,38,251,181,251,180,92,30,49,7,248,64,186,247,45,248,
+23,248,83,26,14,67,250,39,28,4,143,21,251,37,182,251,113,251,37,149,110,247,
+156,154,5,251,117,247,182,21,53,247,17,55,251,17,209,251,148,5,167,6,247,
+126,252,31,21,135,247,44,251,99,247,58,114,120,233,251,138,5,251,35,247,214,
+21,251,113,247,37,251,37,96,231,251,8,247,158,124,5,172,92,21,114,158,251,
+99,251,58,135,251,44,247,34,192,5,14,250,76,28,6,102,248,187,21,247,19,252,
+187,248,187,251,18,252,187,252,187,251,19,248,187,252,187,247,18,248,187,
+7,14,252,159,248,58,159,247,11,29,252,77,247,7,29,252,159,248,37,247,5,247,
+67,29,14,47,247,218,29,196,250,195,249,66,21,248,27,251,54,247,222,251,226,
+251,225,251,52,251,222,252,27,252,27,247,52,251,220,247,225,247,226,247,54,
+247,220,248,27,30,251,109,22,251,199,78,251,201,251,110,251,109,78,247,201,
+247,199,247,199,200,247,204,247,109,247,110,200,251,204,251,199,30,14,196,
+250,37,22,231,7,251,84,147,5,114,119,160,163,31,28,4,238,61,7,252,78,251,
+29,5,47,7,247,209,194,5,254,212,7,115,119,118,114,30,251,99,131,5,47,7,14,
+196,250,181,22,247,240,38,7,103,251,68,5,252,243,6,248,5,247,183,247,242,
+247,148,247,181,26,247,129,251,82,247,54,251,159,251,131,251,103,251,25,248,
+23,10,203,190,235,27,247,52,247,25,251,4,251,89,251,179,251,191,251,111,252,
+52,251,236,31,251,29,7,14,196,250,181,248,27,21,247,117,251,89,238,251,64,
+147,30,247,95,196,247,5,247,11,247,46,26,247,109,251,75,247,29,251,129,251,
+138,251,99,251,23,251,48,51,209,113,188,190,172,161,143,147,30,247,97,7,139,
+215,196,247,0,247,32,247,21,43,251,64,251,72,251,48,59,251,64,30,118,111,
+141,135,27,251,19,7,139,192,147,211,247,27,247,64,80,251,91,251,56,251,21,
+251,49,251,83,74,79,161,170,86,30,78,247,74,5,151,122,102,141,123,27,57,100,
+84,84,39,247,40,251,34,247,168,247,187,247,134,247,68,247,140,31,14,196,250,
+195,248,44,21,247,31,251,66,249,240,251,35,7,253,52,253,238,5,251,33,249,
+3,252,77,247,84,248,77,7,251,84,247,31,21,252,97,6,248,97,248,234,5,14,196,
+250,183,248,80,21,247,157,251,70,247,47,251,177,30,251,29,251,27,86,134,27,
+248,25,249,26,247,66,253,171,253,90,7,139,247,85,208,247,25,247,90,247,44,
+251,0,251,122,251,37,251,13,251,74,251,109,92,61,167,170,106,30,61,247,80,
+5,141,131,115,146,116,27,65,84,98,65,32,247,68,251,27,248,183,10,31,14,196,
+250,195,248,105,21,247,136,251,60,247,74,251,150,251,7,251,6,108,41,251,5,
+30,182,247,218,247,117,247,90,247,152,131,209,137,24,247,19,7,252,156,251,
+191,251,222,252,125,252,85,247,107,251,64,247,168,247,169,247,113,247,95,
+247,191,31,251,101,112,21,251,96,47,251,56,251,89,251,88,55,247,86,247,171,
+170,139,177,143,182,30,201,219,247,0,180,227,27,247,73,247,0,251,11,251,93,
+31,14,196,250,191,28,4,236,21,247,6,254,105,251,252,243,7,172,247,78,5,249,
+11,6,253,56,28,251,47,5,247,109,207,6,14,196,250,193,248,9,21,247,99,251,
+66,235,251,23,186,30,243,190,247,38,246,247,66,26,247,90,251,81,247,46,251,
+142,251,154,251,68,251,42,251,127,251,54,247,17,35,247,5,94,30,251,44,81,
+251,33,41,251,78,26,251,124,247,84,251,62,247,193,247,175,247,103,247,64,
+247,126,30,251,136,249,43,21,251,17,74,51,55,78,30,251,103,217,251,17,225,
+247,35,26,247,15,235,247,3,247,31,247,28,247,6,40,251,60,30,176,253,76,21,
+251,29,251,2,251,17,251,69,251,90,34,247,23,247,68,247,39,221,217,242,195,
+30,247,150,36,247,39,86,251,62,26,14,196,250,195,249,166,21,248,85,251,109,
+247,64,251,168,251,169,251,111,251,97,251,191,251,136,247,60,251,72,247,150,
+247,7,247,6,170,237,247,5,30,96,251,217,251,119,251,91,251,153,147,70,141,
+24,251,19,7,248,156,247,193,247,222,248,125,31,251,105,180,21,109,139,100,
+135,96,30,77,59,251,0,98,51,27,251,73,251,0,247,11,247,93,247,97,231,247,
+55,247,89,247,88,223,251,86,251,171,31,14,252,159,248,37,249,254,240,10,253,
+141,247,216,10,252,159,248,35,249,254,21,215,80,201,63,63,76,77,63,64,200,
+77,215,215,200,201,214,30,162,253,234,247,11,29,250,76,28,6,102,219,21,247,
+19,7,254,221,248,43,250,221,248,44,5,247,19,7,28,251,52,252,107,5,251,19,
+7,14,250,76,28,6,102,249,117,247,121,29,28,4,204,252,8,247,121,29,14,250,
+76,28,6,102,248,187,21,247,19,7,28,251,52,248,107,5,251,19,7,250,221,252,
+44,254,221,252,43,5,251,19,7,14,38,249,234,250,164,21,247,116,251,76,247,
+164,29,245,46,251,82,251,95,251,60,251,4,251,21,96,31,251,189,247,7,247,119,
+7,247,50,209,247,123,247,6,247,152,26,251,209,254,64,21,209,83,196,68,69,
+84,84,69,70,194,81,209,208,197,195,208,30,14,249,201,28,6,233,249,144,21,
+248,58,251,186,247,121,252,42,252,93,252,98,251,211,252,243,252,133,248,12,
+251,197,248,75,247,129,247,89,221,237,247,76,30,110,213,5,69,251,16,251,69,
+57,251,131,27,252,89,251,156,247,212,248,53,248,93,247,224,247,234,248,103,
+247,180,247,177,251,70,252,21,251,218,251,84,251,97,251,13,61,118,205,233,
+162,31,139,247,21,248,212,149,171,30,251,6,6,102,92,5,172,79,57,162,80,27,
+251,150,251,144,251,136,251,205,251,97,246,251,21,247,41,235,234,200,246,
+245,31,251,5,186,82,247,5,247,97,247,186,247,125,248,52,30,252,209,180,21,
+57,252,60,5,86,96,65,59,47,27,37,81,213,247,39,247,142,247,19,247,95,247,
+95,213,194,57,104,131,31,14,247,176,34,29,14,247,35,67,10,14,247,80,55,29,
+14,247,221,50,10,14,237,33,10,14,151,136,29,14,247,219,44,29,14,248,62,46,
+10,14,252,56,40,29,14,36,179,29,247,103,48,29,14,130,45,10,14,249,78,69,10,
+14,248,17,38,10,14,248,37,35,29,14,229,74,29,14,248,53,118,10,247,125,37,
+29,14,110,40,10,14,247,23,58,29,14,247,254,32,10,14,247,160,79,29,14,249,
+191,49,10,14,247,94,61,29,14,247,78,41,29,14,221,73,10,14,251,122,249,156,
+251,162,21,233,251,211,28,5,254,247,211,231,252,133,28,249,72,7,14,44,250,
+125,251,82,21,253,250,28,6,28,5,251,23,6,249,250,28,249,228,5,14,251,122,
+248,226,251,162,21,28,6,184,252,136,47,247,214,28,250,2,251,214,45,7,14,252,
+62,249,50,250,252,51,10,252,46,249,66,251,197,83,29,252,226,234,10,85,32,
+29,14,180,87,29,14,251,34,53,29,14,198,44,10,14,47,34,10,14,252,64,81,10,
+14,118,35,10,14,219,42,29,14,252,111,55,10,14,252,134,248,72,61,10,137,53,
+10,14,252,124,62,10,14,249,25,63,29,14,204,42,10,14,157,39,29,14,188,75,29,
+14,167,131,10,251,187,43,29,14,251,173,38,29,14,252,36,52,29,14,208,37,10,
+14,126,85,29,14,248,144,47,29,14,87,62,29,14,128,36,10,14,251,42,76,29,14,
+42,249,238,251,144,21,223,7,104,251,15,145,195,88,31,82,200,147,247,19,247,
+7,26,233,135,247,9,84,208,30,85,209,60,170,55,157,223,157,218,168,193,209,
+8,194,208,143,247,9,233,26,247,7,131,247,19,196,200,30,195,190,247,15,145,
+174,27,223,7,251,37,251,36,120,68,72,31,47,42,147,251,25,251,27,26,49,145,
+251,31,75,77,30,92,90,70,131,251,11,27,47,7,247,11,208,131,92,188,31,203,
+77,133,251,31,49,26,251,27,131,251,26,231,43,30,68,206,247,36,120,247,37,
+27,14,252,8,248,60,252,164,21,248,159,29,42,250,1,248,185,21,231,7,251,11,
+69,147,186,90,31,75,201,146,247,31,229,26,247,27,147,247,25,47,236,30,210,
+71,251,35,158,251,38,27,55,7,174,247,15,133,83,190,31,197,78,130,251,19,251,
+7,26,45,143,251,9,195,70,30,192,69,219,110,223,121,55,121,59,108,86,69,8,
+83,70,135,251,9,45,26,251,7,148,251,19,81,78,30,83,88,251,15,133,104,27,55,
+7,247,38,247,35,158,210,207,31,231,235,131,247,26,247,27,26,229,132,247,31,
+203,201,30,186,188,209,147,247,11,27,14,248,246,28,5,250,249,7,21,247,25,
+7,251,11,251,56,251,13,100,41,251,70,251,97,247,29,251,91,27,251,2,251,25,
+98,35,251,38,31,251,25,7,239,247,29,247,28,199,243,247,103,247,78,251,30,
+247,87,27,247,9,247,2,174,247,1,247,50,31,14,252,40,248,107,250,9,21,209,
+84,196,69,69,82,82,69,69,196,84,209,209,194,194,209,30,137,28,251,133,21,
+65,250,3,5,41,6,63,254,3,5,251,9,129,194,98,219,27,219,192,180,247,9,129,
+31,14,196,250,121,186,21,247,201,39,7,112,251,88,135,129,131,122,127,133,
+25,139,81,112,53,137,30,249,218,7,223,137,170,127,168,122,155,133,143,119,
+143,122,168,251,70,24,237,247,193,6,174,33,53,155,36,27,247,93,41,251,101,
+7,251,160,102,251,72,251,95,251,164,26,251,170,247,62,251,95,247,170,108,
+30,251,99,237,247,95,7,247,85,235,180,145,145,31,252,29,196,21,251,29,172,
+251,7,247,34,247,135,26,247,150,247,38,247,17,245,164,30,14,196,250,189,28,
+5,12,21,247,50,251,89,198,251,19,251,191,251,29,251,119,251,175,78,141,251,
+56,139,30,251,33,39,247,35,6,139,145,251,34,135,131,30,141,251,111,82,251,
+29,251,60,96,8,251,17,250,97,247,60,252,242,7,98,251,21,127,139,31,247,72,
+247,8,176,247,32,247,154,26,248,17,239,252,17,6,139,135,247,29,229,26,247,
+136,10,47,247,218,29,247,17,28,4,176,28,5,8,21,225,252,27,53,7,237,123,176,
+133,137,112,131,127,25,251,189,252,163,251,162,248,165,128,159,152,160,161,
+143,25,227,153,5,225,252,95,53,7,247,13,115,247,95,252,26,5,251,170,49,247,
+219,6,247,3,251,101,5,252,74,49,248,78,251,236,6,125,125,110,102,137,30,251,
+13,129,5,53,248,170,225,7,251,10,149,5,102,141,122,168,153,26,247,236,248,
+93,229,252,95,7,247,11,247,101,5,247,232,229,251,181,6,247,111,248,24,5,14,
+252,64,249,177,28,5,106,248,227,29,254,53,7,251,85,79,53,80,108,30,139,251,
+74,247,19,131,147,30,139,46,115,55,26,73,199,82,247,8,247,26,247,27,209,247,
+45,219,30,190,238,155,239,247,27,26,249,158,248,223,10,8,154,248,171,10,14,
+67,250,27,249,46,21,247,248,252,213,157,247,99,26,238,221,212,247,14,221,
+205,104,115,184,30,159,251,58,5,236,247,158,6,158,98,251,17,169,251,11,27,
+251,158,251,23,251,6,251,79,251,13,221,60,247,14,77,31,251,25,78,251,0,61,
+251,74,252,19,248,220,149,251,132,26,37,48,75,251,12,79,55,160,172,90,30,
+119,247,35,143,104,126,215,8,37,251,160,6,116,190,247,15,96,247,33,27,247,
+114,247,51,247,21,247,76,247,24,47,223,251,11,194,31,247,17,188,247,15,247,
+15,247,52,26,251,52,87,21,33,251,4,37,79,108,30,251,92,233,44,217,247,17,
+26,229,199,237,247,17,182,30,247,70,65,243,47,251,15,26,14,247,45,28,4,164,
+248,37,21,251,103,247,103,5,200,213,168,233,236,26,235,104,241,82,211,30,
+247,105,247,105,65,213,251,109,251,109,5,198,69,45,172,45,27,43,40,108,80,
+66,31,251,107,247,107,65,65,247,107,251,107,5,73,67,111,35,44,26,43,169,47,
+199,65,30,251,103,251,103,213,66,247,103,247,103,5,73,214,234,108,241,27,
+233,235,172,203,213,31,247,103,251,103,5,251,56,248,185,21,251,64,251,29,
+251,38,251,66,251,68,251,36,247,31,247,68,247,71,247,34,247,31,247,70,247,
+64,247,31,251,37,251,62,30,14,253,126,247,154,248,80,29,211,252,136,5,172,
+6,14,251,60,249,183,248,151,10,251,25,251,89,26,251,9,202,62,246,212,189,
+196,209,184,248,187,10,153,26,247,30,247,4,243,197,207,30,252,58,22,63,153,
+5,86,92,251,64,251,25,251,93,26,251,9,204,66,244,213,188,194,209,190,108,
+169,139,30,251,21,6,150,137,153,153,26,247,19,227,242,221,221,30,14,251,83,
+248,21,247,198,10,249,90,252,77,21,247,216,29,14,252,232,248,6,247,198,10,
+14,252,232,247,22,247,176,10,14,247,84,250,240,28,5,45,21,209,82,194,69,70,
+83,84,69,69,195,82,208,209,196,196,209,30,242,28,250,211,21,219,7,36,247,
+254,29,250,3,55,7,251,45,100,5,252,79,6,141,247,23,141,247,84,197,223,198,
+170,25,184,29,248,126,253,115,247,250,10,133,5,59,7,14,247,72,28,4,197,22,
+219,7,251,1,145,5,121,114,164,157,31,28,5,100,55,7,251,93,66,5,182,117,84,
+169,53,27,251,26,251,27,66,251,46,59,31,247,9,29,248,223,10,150,143,198,153,
+158,193,8,227,28,251,61,6,121,112,114,121,30,251,1,133,5,59,7,14,67,250,148,
+248,96,29,254,148,251,33,7,14,67,248,244,28,5,35,21,43,247,47,43,251,47,221,
+247,37,29,248,70,251,181,21,49,247,232,5,111,6,49,251,232,229,253,246,5,167,
+6,14,67,248,244,28,5,35,21,43,247,47,45,251,47,219,247,37,29,248,87,251,183,
+21,32,247,234,5,111,6,251,1,251,232,247,1,251,234,5,167,6,248,105,96,21,251,
+45,233,251,179,59,5,109,7,247,179,59,5,252,7,219,21,169,7,251,181,219,251,
+45,45,247,45,43,5,248,62,251,126,21,57,247,179,5,111,6,59,251,179,233,251,
+47,5,14,253,91,204,10,38,250,64,28,5,20,21,213,252,41,7,251,198,251,66,39,
+251,193,251,210,247,99,59,247,187,31,249,95,247,48,28,250,84,239,28,5,162,
+7,14,252,118,248,179,249,76,21,247,23,34,244,251,23,251,23,35,34,251,23,251,
+23,243,35,247,23,247,23,244,243,247,23,30,14,252,226,248,62,178,21,247,11,
+71,210,37,61,94,84,69,92,170,105,139,30,247,21,6,128,141,123,129,26,141,251,
+11,247,250,29,251,60,249,228,178,21,247,9,73,212,35,65,90,86,69,88,170,107,
+139,30,247,21,6,128,143,127,125,26,251,19,49,36,247,223,29,247,9,78,214,32,
+65,88,84,69,94,170,103,139,30,247,21,6,128,141,123,125,26,251,30,247,217,
+10,251,60,249,228,28,4,238,21,247,8,73,213,35,65,90,247,17,10,32,65,88,84,
+69,94,170,248,79,10,247,217,10,251,83,248,156,247,176,10,253,90,248,77,247,
+197,29,14,250,76,28,7,51,247,5,21,212,76,203,63,63,80,77,64,63,200,77,215,
+217,198,201,215,248,76,10,198,77,217,215,200,199,217,248,76,10,200,77,215,
+215,200,201,215,30,14,28,4,204,28,8,211,248,33,21,247,97,10,253,103,22,247,
+97,10,251,128,250,101,21,251,18,6,253,251,28,250,162,5,247,21,6,247,154,247,
+73,10,28,5,127,252,216,21,247,100,10,253,103,22,247,100,10,253,221,247,62,
+29,38,249,91,250,9,21,209,83,196,70,69,82,84,69,69,194,82,211,208,195,194,
+209,30,247,74,254,228,21,248,84,10,251,78,32,229,247,82,247,95,247,60,247,
+7,247,21,182,31,247,189,251,7,251,122,7,251,49,70,251,124,251,7,251,152,26,
+251,115,247,77,251,36,247,133,247,116,241,244,235,30,14,252,15,248,111,250,
+252,50,29,252,15,249,97,28,5,129,33,29,252,62,249,50,250,252,51,10,252,21,
+249,91,28,5,143,36,29,252,46,249,66,28,4,176,83,29,252,122,248,246,28,5,152,
+66,10,253,247,247,121,28,5,33,43,10,252,85,249,27,77,10,252,245,248,123,28,
+5,90,89,29,14,253,5,248,107,92,29,251,114,249,254,28,5,129,56,10,253,95,248,
+243,251,126,72,10,252,62,249,50,28,5,195,54,29,250,76,28,8,0,248,96,29,28,
+248,0,251,33,7,14,249,195,64,29,14,252,34,145,29,247,100,252,125,21,200,252,
+232,78,7,14,130,250,175,22,248,17,251,9,7,104,251,130,5,119,135,121,116,108,
+27,252,58,249,5,6,247,142,247,60,83,219,251,86,251,21,5,248,25,248,160,10,
+247,13,149,5,227,252,173,51,7,247,13,129,5,170,137,151,118,119,26,252,162,
+7,251,89,251,28,191,55,247,37,238,5,252,81,7,117,125,118,110,137,30,251,13,
+131,5,51,7,14,248,37,88,29,14,250,74,28,7,188,22,247,234,251,2,7,104,251,
+95,5,125,135,120,114,123,27,252,154,248,200,247,199,6,156,159,116,125,31,
+159,251,34,5,244,248,93,34,6,119,251,33,5,124,121,119,120,30,251,199,248,
+146,248,80,247,116,29,253,224,251,4,6,231,45,251,23,192,251,58,27,252,44,
+251,82,248,122,10,247,91,251,201,248,37,247,56,247,23,192,232,233,31,251,
+5,7,110,249,64,21,251,216,70,251,172,251,187,251,183,69,248,125,29,207,247,
+168,247,189,247,179,212,251,164,251,226,30,14,251,255,247,37,10,135,252,92,
+21,200,253,5,78,7,248,128,248,92,21,247,82,29,248,17,59,10,14,252,111,56,
+29,14,252,124,249,9,250,27,21,83,223,251,68,251,11,5,249,21,61,7,251,160,
+60,5,71,247,50,253,3,7,251,119,251,49,190,55,247,68,247,15,5,252,126,248,
+161,29,251,5,133,5,59,248,134,219,7,32,145,5,115,141,116,157,164,26,248,255,
+7,14,157,100,29,14,248,219,28,6,74,248,228,21,247,138,251,15,247,66,251,130,
+251,31,251,23,63,251,11,67,30,233,88,251,19,240,251,82,27,251,189,251,64,
+251,126,251,176,251,173,247,62,251,130,247,187,247,70,245,242,239,215,31,
+41,207,247,2,34,247,76,27,247,40,247,9,205,200,225,31,247,17,7,86,67,41,78,
+251,5,27,251,142,55,247,109,247,97,31,248,253,6,141,157,139,164,153,26,251,
+99,174,21,252,38,6,247,51,154,221,247,19,247,23,27,247,6,199,251,0,251,25,
+31,252,242,251,75,21,251,111,57,251,92,251,66,251,64,53,247,94,247,120,247,
+109,218,247,88,247,71,247,68,219,251,82,251,126,30,14,247,82,28,4,193,247,
+197,21,247,187,252,65,143,247,93,26,221,191,213,247,31,30,168,151,134,143,
+27,141,150,172,241,239,248,135,29,251,48,251,191,251,174,30,253,173,7,121,
+123,112,114,137,30,41,129,5,61,248,101,217,7,35,147,5,124,141,123,155,170,
+26,249,193,7,247,38,174,247,205,247,146,247,33,204,251,7,251,15,84,121,47,
+139,30,251,33,108,32,37,251,40,251,154,248,74,133,251,119,26,49,70,55,36,
+82,96,169,160,117,30,120,247,70,5,251,3,251,166,6,139,247,40,87,233,247,87,
+247,54,247,21,247,93,30,14,251,238,248,230,249,164,21,195,7,251,17,143,5,
+123,124,151,153,31,249,132,90,7,251,181,57,5,86,7,247,99,172,5,253,30,7,125,
+127,127,123,30,251,28,135,5,83,7,14,247,66,28,4,164,248,23,21,248,109,254,
+230,251,15,250,107,251,242,7,14,163,28,4,109,247,113,21,98,6,39,118,117,110,
+96,27,100,108,143,247,77,31,249,86,251,83,253,121,7,47,58,77,89,59,27,74,
+92,185,190,122,31,127,176,133,202,241,26,248,220,251,83,253,160,7,252,29,
+74,112,251,21,26,73,182,92,186,190,186,188,207,30,223,90,247,31,247,23,26,
+189,7,53,190,240,134,169,27,247,1,219,203,247,27,247,8,31,251,46,160,217,
+94,221,27,245,227,209,247,68,152,31,14,247,160,28,5,14,249,197,21,184,7,74,
+149,5,248,60,7,204,152,5,186,251,103,112,7,251,27,251,252,251,27,247,252,
+5,166,251,105,92,7,203,126,5,252,60,7,75,129,5,94,247,78,184,7,78,149,5,248,
+64,7,247,66,252,119,5,188,6,247,77,248,119,5,252,64,7,77,129,5,94,7,252,166,
+248,31,21,247,36,252,107,251,36,198,7,151,225,5,146,143,143,144,30,247,0,
+252,73,6,139,86,131,114,137,30,94,247,144,184,7,115,141,87,147,139,26,248,
+73,246,7,143,143,135,132,31,153,53,5,14,247,221,78,10,249,76,28,6,164,22,
+247,103,71,7,117,32,5,252,29,6,247,131,247,67,247,105,247,43,247,66,26,247,
+36,251,0,231,251,64,251,48,251,25,65,35,89,248,149,10,142,145,180,163,201,
+27,241,211,80,251,11,251,64,251,74,251,25,251,163,251,99,31,57,7,247,216,
+28,5,150,248,240,29,250,76,28,6,102,249,113,21,247,19,252,187,248,5,251,18,
+252,5,252,187,251,19,248,187,252,4,247,18,248,4,7,248,187,253,113,247,121,
+29,14,227,250,228,249,89,21,247,180,251,60,247,5,252,9,145,30,251,31,141,
+5,247,7,243,10,254,216,7,247,160,29,247,32,7,139,227,128,196,30,247,206,137,
+247,113,247,48,247,177,26,251,126,22,251,124,251,0,35,251,111,141,30,100,
+59,147,139,31,249,13,7,139,229,147,145,135,30,247,156,149,225,251,9,251,96,
+26,14,249,76,28,6,158,247,125,21,223,251,44,247,225,10,251,21,28,4,173,247,
+179,10,225,248,240,21,194,7,251,17,144,5,123,141,124,247,72,10,28,5,6,251,
+179,21,251,211,6,247,211,248,7,5,14,250,76,28,4,123,250,68,21,207,84,194,
+71,71,84,84,71,69,194,86,207,207,194,192,209,30,248,127,252,29,247,121,29,
+249,117,251,158,21,208,84,193,71,71,84,85,70,71,194,86,207,207,194,192,207,
+30,14,252,25,248,42,249,68,21,249,199,34,253,199,7,244,254,218,21,249,200,
+34,253,200,7,14,252,77,248,189,28,4,225,21,247,17,39,240,251,17,251,17,38,
+38,251,17,251,17,240,39,247,17,247,17,239,239,247,17,30,57,248,133,29,203,
+219,219,202,75,59,30,14,188,248,218,29,249,4,248,49,29,28,249,117,182,29,
+14,249,76,28,6,180,247,125,247,167,10,254,3,248,247,104,29,250,48,247,209,
+248,157,29,251,238,249,66,249,164,21,247,101,74,7,116,35,248,174,29,247,43,
+247,67,26,247,35,251,17,229,251,64,251,48,251,29,67,35,90,178,114,180,180,
+163,162,139,30,247,27,7,141,145,182,163,201,27,241,227,78,251,11,251,64,251,
+84,251,23,251,163,251,99,31,57,7,14,248,254,178,29,251,82,252,62,21,194,7,
+251,250,247,152,247,201,211,251,218,31,247,17,166,247,7,196,247,31,26,230,
+29,172,141,170,247,254,251,133,252,45,247,254,27,182,203,147,141,151,31,251,
+236,249,33,21,251,35,51,92,251,54,30,117,89,141,248,46,10,250,76,28,6,102,
+248,187,247,121,29,14,147,250,158,248,191,21,247,232,251,162,247,197,67,221,
+30,247,101,247,19,92,221,251,115,251,25,251,40,247,43,251,144,64,5,81,7,247,
+64,117,211,57,251,127,251,34,184,58,247,152,247,47,145,133,247,3,251,35,179,
+67,25,137,62,168,81,27,251,174,251,105,251,101,251,195,251,197,247,84,251,
+112,247,183,247,173,247,92,247,120,247,244,31,251,90,98,21,251,109,63,251,
+121,248,150,29,239,247,79,247,109,203,231,98,139,30,190,55,168,251,11,251,
+56,26,14,250,76,28,6,41,247,33,21,252,107,248,109,248,107,248,109,59,219,
+252,109,252,111,252,109,248,111,59,59,248,107,252,109,252,107,252,109,219,
+59,248,109,248,112,248,109,252,112,5,14,251,238,249,66,250,144,21,247,27,
+251,17,196,251,4,144,30,247,23,173,210,211,231,26,247,23,251,11,215,251,45,
+251,52,251,25,67,45,86,184,122,170,172,161,156,141,143,30,247,13,7,139,188,
+169,211,229,223,86,37,251,1,39,248,106,10,172,146,186,227,247,5,104,251,11,
+41,55,48,251,15,96,102,148,248,24,29,106,80,234,57,247,72,247,84,247,48,241,
+247,42,31,14,248,254,28,6,109,249,99,21,248,64,251,239,247,254,252,76,252,
+72,251,244,251,248,252,72,252,70,247,246,251,249,248,68,248,72,247,245,247,
+249,248,72,30,50,137,21,252,23,251,207,251,210,252,21,252,21,251,205,247,
+210,248,23,248,25,247,205,247,209,248,23,248,23,247,203,251,211,252,23,30,
+252,12,252,70,21,247,150,49,7,110,251,66,5,122,104,71,117,72,27,251,52,251,
+48,247,35,247,142,247,134,247,54,247,31,247,66,197,196,116,119,170,31,169,
+251,48,5,232,247,136,6,166,49,46,163,33,27,251,197,251,91,251,91,251,174,
+251,150,247,72,251,118,247,214,247,43,247,26,187,141,145,31,14,247,176,34,
+29,247,228,249,46,33,29,247,176,34,29,248,11,248,21,51,10,247,176,34,29,248,
+0,248,206,39,10,247,176,34,29,247,113,248,21,50,29,247,176,34,29,247,176,
+249,7,89,29,14,247,176,34,29,248,32,249,60,36,29,247,80,55,29,251,130,251,
+205,60,10,237,33,10,249,207,28,7,17,33,29,237,33,10,249,246,28,5,248,51,10,
+237,33,10,249,235,65,29,237,33,10,249,92,28,5,248,50,29,252,56,40,29,248,
+202,28,7,17,33,29,252,56,40,29,248,241,28,5,248,51,10,252,56,40,29,248,230,
+65,29,252,56,40,29,248,87,28,5,248,50,29,248,17,38,10,251,105,248,181,36,
+29,248,37,35,29,251,28,250,249,33,29,248,37,35,29,42,249,224,51,10,248,37,
+35,29,251,0,250,153,39,10,248,37,35,29,251,143,249,224,50,29,248,37,35,29,
+63,28,4,115,36,29,110,40,10,50,28,5,210,54,29,247,254,32,10,251,130,248,167,
+33,29,247,254,32,10,251,91,247,142,51,10,247,254,32,10,251,102,248,71,39,
+10,247,254,32,10,251,245,247,142,50,29,247,78,41,29,251,106,248,179,33,29,
+247,78,41,29,251,78,248,83,39,10,221,250,222,22,248,244,10,85,32,29,247,20,
+249,242,33,29,85,32,29,247,59,248,217,51,10,85,32,29,247,48,249,146,39,10,
+85,32,29,152,248,217,50,29,85,32,29,215,249,203,89,29,14,85,32,29,247,80,
+250,0,36,29,251,34,53,29,251,16,251,234,60,10,47,34,10,241,249,117,33,29,
+47,34,10,247,33,248,92,51,10,47,34,10,247,22,249,21,39,10,47,34,10,126,248,
+92,50,29,252,111,56,29,248,172,28,5,129,33,29,252,111,56,29,248,211,250,252,
+51,10,252,111,56,29,248,200,77,10,252,111,56,29,248,57,250,252,50,29,204,
+42,10,247,160,28,5,143,36,29,157,39,29,161,250,39,33,29,157,39,29,200,249,
+14,51,10,157,39,29,189,249,199,39,10,157,39,29,46,249,14,50,29,157,39,29,
+221,250,53,36,29,251,173,38,29,156,28,4,154,54,29,208,37,10,220,28,5,129,
+33,29,208,37,10,247,12,250,252,51,10,208,37,10,247,1,77,10,208,37,10,105,
+250,252,50,29,128,36,10,38,248,150,33,29,128,36,10,66,248,54,39,10,251,42,
+76,29,249,128,28,5,195,54,29,247,72,250,207,247,5,247,67,29,253,62,247,217,
+29,252,138,248,37,247,5,247,67,29,14,247,131,28,5,184,28,5,106,21,248,51,
+10,251,174,251,148,30,106,29,5,153,248,171,10,14,249,242,28,6,248,28,5,45,
+21,209,81,194,70,69,84,84,69,69,194,82,209,208,197,196,209,30,241,28,250,
+211,21,219,7,37,247,110,10,250,3,55,7,251,46,100,5,252,78,247,23,6,248,103,
+10,153,248,171,10,248,51,10,251,174,251,148,30,128,29,248,125,253,115,248,
+208,29,249,228,28,7,96,22,219,7,251,0,145,5,120,141,113,162,157,26,28,5,100,
+57,7,251,93,64,5,182,117,85,171,51,27,251,197,251,5,251,174,251,148,31,106,
+29,151,141,195,155,159,193,25,227,28,251,61,6,121,115,116,118,137,30,251,
+0,133,5,59,7,14,196,250,207,215,21,247,209,251,0,7,97,251,105,136,123,126,
+123,120,132,25,137,135,81,107,53,27,65,72,153,166,81,31,247,189,250,218,168,
+128,162,128,152,133,25,150,133,158,117,141,122,166,251,70,24,247,3,247,198,
+6,60,164,75,160,78,152,189,247,73,24,45,6,93,251,59,5,142,115,115,140,114,
+27,137,6,184,247,55,5,45,6,92,251,61,5,251,222,95,251,109,251,157,252,5,26,
+251,97,214,251,87,247,33,251,23,30,54,251,200,5,237,6,206,247,138,159,126,
+160,127,161,129,25,81,251,103,5,237,6,187,247,69,5,121,199,204,129,210,27,
+247,81,247,63,211,143,148,31,253,181,248,250,21,247,192,247,15,247,80,247,
+70,202,30,251,132,254,0,5,99,228,118,247,1,247,19,26,247,20,252,69,21,247,
+166,250,129,5,140,152,153,140,153,27,151,150,138,138,150,31,251,183,254,186,
+118,156,120,158,121,160,25,14,196,250,227,248,96,29,254,177,251,33,7,14,249,
+76,209,29,251,185,247,20,29,225,85,10,28,5,125,158,228,10,249,76,209,10,254,
+142,249,1,21,247,27,251,19,194,251,2,145,30,247,23,174,210,211,229,26,247,
+23,251,4,217,251,46,251,52,251,19,65,47,86,186,122,170,172,159,154,141,144,
+30,247,15,7,139,184,167,208,229,217,88,35,251,1,51,92,251,5,30,107,63,6,139,
+165,143,186,227,244,107,251,11,38,63,51,251,17,98,106,148,157,105,30,98,247,
+1,5,147,128,117,141,129,27,85,113,104,104,80,229,61,247,70,247,85,247,41,
+239,247,42,31,249,107,248,222,247,179,10,250,187,247,97,247,158,29,114,248,
+54,247,167,29,14,249,76,209,10,251,185,247,20,29,247,74,250,1,93,10,249,238,
+251,146,247,167,29,164,252,54,247,158,29,14,249,76,209,29,252,19,247,20,29,
+247,240,28,5,86,247,157,29,28,4,194,125,228,10,249,76,70,29,251,187,28,4,
+170,248,240,29,249,76,70,29,251,187,28,4,170,149,10,14,250,76,28,6,102,248,
+1,21,247,19,253,35,7,247,138,247,137,5,248,45,247,19,251,174,6,247,35,247,
+36,57,221,251,117,251,118,5,253,162,251,19,249,35,6,251,138,251,137,5,252,
+45,251,19,247,174,6,251,35,251,36,221,57,247,117,247,118,5,14,250,76,28,6,
+168,248,254,21,247,48,251,29,247,19,251,46,251,45,251,24,251,15,43,35,30,
+235,33,251,24,247,15,251,43,27,251,46,251,29,251,19,251,48,251,41,247,15,
+251,31,247,46,247,74,235,247,0,247,1,247,17,31,251,1,247,15,237,251,0,247,
+74,27,247,46,247,15,247,31,247,41,31,32,125,21,37,45,63,43,251,27,47,241,
+225,51,30,211,225,247,8,247,1,247,11,27,244,218,49,38,31,253,23,149,21,53,
+51,47,37,251,25,27,43,43,215,241,240,218,229,244,247,11,247,8,251,1,67,225,
+31,14,250,76,28,6,102,247,132,21,247,19,7,254,221,247,217,250,221,247,218,
+5,247,19,7,28,251,52,252,25,5,251,19,7,28,4,204,253,9,248,157,10,250,76,28,
+6,102,249,9,21,247,19,7,28,251,52,248,25,5,251,19,7,250,221,251,218,254,221,
+251,217,5,251,19,7,28,4,204,251,132,248,157,10,100,250,111,249,220,21,247,
+19,61,248,111,252,74,33,36,104,112,78,30,223,33,5,186,247,0,164,161,245,27,
+247,46,247,41,251,64,251,100,135,31,137,57,137,61,121,51,8,247,2,251,36,86,
+174,251,17,27,251,19,251,187,47,252,70,251,64,247,48,251,99,247,142,248,103,
+196,249,84,247,73,31,251,95,251,93,21,251,183,105,44,251,222,251,105,27,251,
+80,125,247,105,223,247,79,239,247,166,247,103,247,23,196,51,90,184,31,14,
+241,204,29,248,66,151,29,247,13,28,4,152,247,203,21,61,6,251,66,75,59,78,
+51,151,221,247,29,30,248,181,247,17,7,247,7,178,223,240,31,87,6,110,131,94,
+114,94,27,253,117,6,251,64,73,251,47,47,31,199,6,175,151,145,219,247,29,27,
+225,251,150,6,252,19,35,86,77,94,107,194,219,30,71,6,251,33,166,251,38,247,
+10,247,58,231,247,56,247,105,30,248,105,247,171,252,215,7,251,9,161,251,42,
+247,91,247,19,244,247,5,247,115,30,14,251,23,250,13,28,5,80,21,159,190,133,
+184,94,182,112,164,70,145,75,127,251,94,98,77,251,48,119,252,209,131,251,
+122,24,128,251,228,121,251,213,135,63,133,100,112,80,251,5,237,78,192,61,
+92,123,102,118,90,149,92,180,98,166,114,207,131,204,154,247,76,178,232,235,
+163,249,27,149,247,166,24,150,247,169,141,247,217,145,213,143,178,166,201,
+247,6,40,199,86,216,184,154,174,8,14,248,105,115,29,221,28,4,154,28,5,92,
+21,201,251,56,7,251,226,28,251,57,252,35,249,160,251,132,251,13,172,78,247,
+19,202,248,78,253,252,5,201,6,248,6,28,5,92,5,14,250,76,28,6,102,249,181,
+21,247,203,29,127,251,87,124,72,67,247,97,29,213,194,190,8,251,240,4,247,
+203,29,126,251,87,125,72,67,247,171,29,149,247,14,148,247,5,212,194,191,8,
+14,247,105,247,90,10,252,132,14,143,250,152,249,183,21,252,50,249,166,5,251,
+21,6,252,49,253,166,248,49,253,183,5,247,21,6,247,179,249,183,21,251,242,
+253,68,251,244,249,68,247,244,249,50,5,14,109,248,55,249,236,21,158,131,123,
+149,121,27,112,117,115,115,111,163,119,165,166,157,162,164,145,138,146,136,
+145,31,247,207,253,139,21,157,130,120,151,120,27,114,119,115,116,111,163,
+118,163,166,160,163,163,145,137,145,137,145,31,252,95,249,65,21,148,130,127,
+144,127,27,114,117,117,112,114,160,118,166,167,158,158,168,152,133,151,130,
+147,31,248,218,252,216,21,147,129,126,144,126,27,113,119,118,113,114,160,
+117,166,167,159,161,164,151,134,152,130,148,31,253,66,248,93,21,141,133,133,
+141,133,27,115,116,118,112,115,158,115,167,163,164,159,165,158,127,158,120,
+147,31,249,139,251,206,21,141,134,133,140,133,27,115,114,123,108,115,157,
+116,169,164,162,159,166,158,127,156,121,147,31,253,188,247,52,21,112,119,
+118,113,114,159,116,165,31,141,6,163,163,161,166,164,115,160,114,31,249,201,
+140,21,115,137,115,119,112,26,115,160,117,163,30,143,6,165,160,161,164,165,
+117,161,113,31,253,188,251,54,21,120,132,129,122,121,26,112,162,117,164,166,
+160,163,164,165,117,159,113,133,132,138,136,133,30,249,139,247,207,21,121,
+131,128,121,120,26,113,161,118,163,167,160,163,163,166,115,160,115,133,133,
+137,137,133,30,253,65,252,95,21,130,130,134,128,127,26,114,162,116,164,165,
+160,162,164,166,118,159,111,127,128,133,130,130,30,248,216,248,218,21,131,
+130,134,126,127,26,115,160,115,165,165,160,161,165,165,119,161,112,127,127,
+134,130,129,30,252,93,253,66,21,137,133,137,133,133,26,116,161,115,165,163,
+163,159,166,163,119,163,112,123,118,127,121,131,30,247,206,249,139,21,137,
+133,138,134,133,26,115,159,114,166,163,163,159,166,164,118,163,112,120,122,
+127,121,131,30,251,52,253,188,21,248,8,29,249,201,4,248,8,29,14,92,76,10,
+14,252,49,249,40,248,172,10,75,247,252,29,247,236,7,246,94,216,251,57,251,
+24,251,37,95,38,108,164,135,163,30,236,245,6,144,152,174,150,186,27,224,178,
+100,57,31,86,7,251,241,69,92,76,48,26,36,216,76,235,243,247,11,227,139,30,
+156,66,5,122,247,8,21,139,46,81,68,75,103,190,190,199,163,192,247,132,194,
+30,14,252,34,145,29,14,251,143,28,4,135,153,29,14,85,32,29,247,81,248,217,
+48,10,85,32,29,86,253,220,72,29,247,112,28,5,141,51,10,85,32,29,247,59,248,
+217,69,29,223,249,61,33,29,85,32,29,247,59,248,217,66,29,85,32,29,247,59,
+248,217,69,29,247,36,249,75,36,29,85,32,29,247,59,248,217,69,29,83,249,53,
+45,29,85,32,29,247,29,248,217,65,10,85,32,29,247,29,250,9,66,10,85,32,29,
+86,253,220,248,217,29,28,6,189,66,10,85,32,29,247,29,250,9,68,29,130,248,
+13,33,29,85,32,29,247,29,250,9,68,29,251,16,235,50,29,85,32,29,247,29,250,
+9,68,29,190,248,27,36,29,85,32,29,247,29,250,9,68,29,251,41,248,5,45,29,92,
+76,10,247,11,249,185,86,29,85,32,29,247,59,250,52,54,29,85,32,29,247,67,249,
+33,83,29,92,76,10,247,46,249,146,39,10,85,32,29,247,48,249,146,248,236,10,
+85,32,29,86,249,146,43,10,85,32,29,247,67,250,177,227,10,248,94,251,179,43,
+10,85,32,29,215,249,203,89,29,247,44,248,235,33,29,85,32,29,72,249,201,229,
+29,85,32,29,127,249,234,45,29,85,32,29,86,253,220,72,29,14,85,32,29,215,254,
+40,123,10,85,32,29,247,162,254,5,72,10,85,28,5,99,248,235,10,40,247,254,29,
+248,210,248,242,29,112,247,85,247,66,10,14,85,247,34,35,21,223,81,221,247,
+31,5,138,148,149,138,148,248,76,29,247,195,219,6,40,145,247,165,10,198,131,
+193,119,184,30,247,25,247,114,52,196,251,6,251,82,5,177,89,66,161,35,27,247,
+232,29,31,248,127,29,244,199,97,51,158,31,251,4,251,80,5,252,65,33,79,39,
+251,31,26,251,10,194,53,221,96,30,248,107,247,80,248,162,10,123,125,141,143,
+126,30,247,153,248,72,173,148,5,252,42,251,173,21,220,163,212,247,93,212,
+30,251,88,251,221,5,120,169,129,175,175,26,14,248,182,28,6,66,22,219,7,40,
+145,248,215,29,251,10,251,27,114,85,47,30,189,89,60,168,251,12,233,29,247,
+32,247,55,247,7,183,197,30,38,175,225,81,247,3,248,76,29,253,1,247,85,247,
+66,10,248,230,251,246,248,162,10,43,81,220,228,240,176,227,248,5,231,30,217,
+4,251,80,98,251,22,99,51,99,8,248,1,7,147,159,235,177,238,27,247,23,199,74,
+251,29,31,14,248,212,28,6,66,248,142,10,251,26,33,94,65,63,30,213,94,54,184,
+251,42,233,29,247,33,247,126,247,43,175,192,30,251,8,214,247,16,68,247,62,
+247,7,10,253,91,251,193,247,66,10,14,248,177,28,6,58,22,247,233,29,250,5,
+248,64,29,60,102,55,27,251,37,93,225,247,37,31,247,251,7,205,29,165,157,5,
+251,5,180,220,88,247,17,27,247,13,247,19,227,193,209,31,251,9,7,253,223,235,
+21,248,182,10,31,251,132,7,99,142,103,145,107,30,90,66,32,85,58,27,14,247,
+221,28,5,125,250,31,21,247,151,29,251,193,253,145,5,248,250,248,242,29,247,
+125,6,247,250,250,19,5,252,254,253,82,247,66,10,14,247,241,28,5,105,248,159,
+21,241,251,89,7,247,0,247,162,247,1,151,5,247,151,29,48,251,123,5,251,102,
+219,6,101,29,247,125,6,247,101,248,159,5,252,105,251,222,247,66,10,247,80,
+115,21,247,62,6,251,62,252,68,5,14,248,87,28,5,247,248,6,10,251,204,253,154,
+73,143,248,160,29,248,210,248,242,29,247,129,6,109,49,65,251,52,72,72,251,
+84,227,24,247,241,10,213,247,68,248,56,10,253,122,253,82,247,66,10,14,85,
+250,97,249,115,21,247,64,251,11,244,251,39,251,52,251,72,251,38,139,30,112,
+247,13,5,251,197,59,6,237,133,5,164,137,157,121,114,26,252,209,7,251,71,209,
+251,21,247,146,247,94,247,116,213,247,60,190,100,147,102,30,251,42,251,70,
+6,131,119,86,121,67,27,251,23,82,204,247,29,31,227,7,248,172,247,9,209,244,
+247,43,26,251,95,125,21,39,104,50,252,4,47,30,247,247,7,139,247,33,235,247,
+0,238,194,53,55,30,14,252,55,249,17,28,4,202,21,242,62,202,44,35,251,9,52,
+139,30,121,211,5,251,90,91,6,202,136,5,156,137,150,129,124,26,251,236,7,251,
+0,185,62,247,57,247,23,247,38,183,240,170,114,144,114,30,42,32,6,134,126,
+105,128,92,27,54,102,178,221,31,192,7,247,240,209,184,202,230,26,251,24,131,
+21,79,117,85,251,131,84,30,247,105,7,139,230,197,209,204,174,87,89,30,14,
+198,250,228,22,158,29,251,238,249,103,249,165,21,186,7,83,144,5,126,140,122,
+153,149,26,248,166,99,7,58,92,5,166,104,87,159,97,27,251,118,251,3,251,54,
+251,59,251,31,217,251,46,247,71,217,206,176,182,200,31,74,7,247,4,4,119,105,
+89,118,86,27,251,14,67,232,247,27,247,40,220,241,248,204,10,198,28,5,195,
+108,29,158,29,198,249,162,250,111,21,251,1,7,211,45,35,201,251,11,27,251,
+167,251,12,251,148,251,124,251,170,247,62,251,163,247,240,204,219,172,184,
+192,31,247,17,61,5,201,250,7,6,157,165,162,158,141,30,225,147,5,217,7,251,
+214,253,207,21,96,98,57,94,80,27,251,95,251,17,247,62,247,139,247,116,247,
+3,247,47,247,80,221,215,104,107,192,31,14,198,250,209,248,160,21,247,124,
+251,12,247,148,251,167,251,11,35,77,68,45,30,247,0,251,214,61,7,225,131,5,
+158,137,165,117,120,26,254,7,201,7,247,17,217,5,94,192,219,106,204,27,247,
+240,247,62,247,163,247,170,31,251,94,104,21,251,139,251,17,251,62,251,95,
+80,57,184,182,98,30,249,21,7,172,192,215,173,221,27,247,80,247,3,251,47,251,
+116,31,14,251,238,249,90,250,223,21,247,32,61,247,45,251,71,62,72,102,96,
+77,30,204,251,101,92,7,195,135,5,151,137,156,126,128,26,252,166,180,7,220,
+186,5,112,173,191,119,182,27,247,118,247,2,247,55,247,58,31,251,23,118,21,
+251,40,58,37,251,24,100,86,166,165,112,30,248,21,7,158,174,188,160,193,27,
+247,14,211,46,251,27,31,14,248,17,59,10,14,248,17,59,10,251,30,249,115,33,
+29,248,17,59,10,48,248,162,83,29,248,17,209,250,9,21,251,15,7,200,213,217,
+190,247,14,27,247,38,231,59,80,198,31,251,164,252,203,7,139,135,90,116,26,
+251,111,235,251,89,247,136,247,50,225,221,178,171,30,94,170,188,63,247,85,
+27,247,78,247,107,213,247,60,186,115,151,85,31,251,35,251,70,6,131,119,96,
+121,73,27,251,29,98,210,247,27,31,223,7,248,52,246,247,51,196,247,109,26,
+247,44,47,247,9,251,64,251,72,251,72,251,48,139,139,251,27,247,48,251,130,
+251,56,251,9,55,96,80,30,249,142,48,21,139,247,19,234,235,246,188,57,47,251,
+15,61,69,251,193,57,30,252,195,74,21,248,4,6,251,40,96,251,47,251,43,251,
+13,86,247,10,247,15,30,14,251,28,189,28,5,36,21,65,7,176,188,189,169,219,
+27,233,199,91,104,178,31,251,55,252,5,7,139,136,109,126,26,251,24,202,251,
+10,247,50,242,195,188,163,160,30,112,159,171,93,247,17,27,247,13,247,32,183,
+240,167,123,147,104,31,46,32,6,134,126,111,128,96,27,50,113,182,220,31,189,
+7,247,162,203,243,174,247,22,26,230,79,209,251,4,251,9,251,9,46,139,139,51,
+232,251,47,33,63,89,113,100,30,248,132,84,21,139,221,196,202,208,171,90,84,
+65,88,97,251,87,90,30,252,0,100,21,247,132,6,50,111,46,41,60,104,210,213,
+30,14,247,125,28,5,10,247,119,21,78,6,139,96,47,94,88,120,247,13,247,42,108,
+30,178,220,170,223,159,227,8,139,199,247,95,153,233,30,251,80,6,122,74,123,
+51,119,41,8,247,59,75,33,247,32,251,99,27,251,240,251,60,248,119,29,247,84,
+247,40,232,247,23,247,0,31,251,28,166,186,51,247,17,27,247,17,194,247,144,
+139,31,252,41,247,85,21,251,56,77,45,251,31,251,52,248,135,10,247,15,247,
+55,247,95,247,125,170,251,141,251,136,162,31,14,247,176,34,29,14,251,91,250,
+19,249,165,21,192,7,80,148,119,142,137,143,133,156,25,251,201,249,138,5,39,
+6,251,202,253,156,61,124,5,86,247,160,192,7,61,145,5,130,125,154,148,143,
+31,227,247,114,5,247,200,6,230,251,117,5,133,142,131,124,131,27,62,133,5,
+86,7,114,248,0,21,251,152,6,247,21,247,214,5,14,165,250,238,22,219,7,57,151,
+119,141,141,141,131,158,25,252,19,250,21,5,251,28,6,252,19,254,40,248,21,
+10,245,247,146,5,248,3,6,247,0,251,150,248,127,10,7,102,248,82,21,251,183,
+6,247,35,247,239,5,14,247,176,34,29,248,33,248,21,48,10,247,176,34,29,248,
+11,248,21,69,29,223,249,61,33,29,247,176,34,29,248,11,248,21,66,29,247,176,
+34,29,248,11,248,21,69,29,247,36,249,75,36,29,247,176,34,29,248,11,248,21,
+69,29,83,249,53,45,29,247,176,34,29,247,47,28,250,100,72,29,247,112,28,7,
+29,51,10,247,176,34,29,247,237,248,21,65,10,247,176,34,29,247,237,249,69,
+66,10,247,176,34,29,247,237,249,69,68,29,130,248,13,33,29,247,176,34,29,247,
+237,249,69,68,29,251,16,235,50,29,247,176,34,29,247,237,249,69,68,29,190,
+248,27,36,29,247,176,34,29,247,237,249,69,68,29,251,41,248,5,45,29,247,176,
+34,29,247,47,28,250,100,248,217,29,28,8,77,66,10,247,176,34,29,247,221,248,
+240,119,29,247,176,34,29,248,11,249,112,54,29,247,176,34,29,248,19,248,93,
+83,29,247,176,34,29,248,0,248,206,39,10,247,176,34,29,248,0,248,206,248,236,
+10,247,176,34,29,247,47,248,206,43,10,247,176,34,29,248,19,249,237,227,10,
+248,94,251,179,43,10,247,176,34,29,247,176,249,7,89,29,247,44,248,235,33,
+29,247,176,34,29,247,88,249,38,45,29,247,176,34,29,247,47,28,250,100,72,29,
+14,247,176,34,29,247,176,28,250,24,123,10,247,176,34,29,249,48,28,250,59,
+72,10,247,176,247,54,247,34,10,247,128,28,250,4,21,164,29,14,247,176,149,
+248,206,10,51,7,231,123,170,134,141,133,149,111,25,248,111,28,251,16,5,247,
+46,6,248,113,28,5,14,247,11,164,5,227,252,48,51,7,247,13,129,5,153,160,114,
+123,133,31,251,28,252,5,5,252,109,6,251,33,248,11,5,149,135,151,164,152,27,
+247,10,149,5,227,7,178,252,242,21,248,36,6,251,91,252,173,5,14,28,4,110,28,
+8,102,249,66,21,248,33,251,125,247,216,252,41,251,196,251,84,251,70,251,148,
+46,30,251,55,248,70,95,10,252,54,247,34,247,86,251,15,247,189,27,248,37,247,
+127,247,214,248,33,31,251,129,137,21,251,216,251,1,251,172,251,187,251,182,
+251,2,248,125,29,247,0,247,168,247,189,247,178,247,5,251,164,251,226,30,254,
+193,61,247,75,29,28,4,160,28,8,222,22,247,234,29,252,111,28,4,240,5,251,46,
+6,252,5,254,127,252,13,250,127,95,10,247,33,252,11,5,129,143,127,114,126,
+27,251,10,129,5,51,248,123,247,234,29,108,222,243,247,174,5,248,109,6,247,
+33,252,11,5,129,143,127,114,126,27,251,10,129,5,51,7,100,248,242,247,207,
+29,253,79,252,173,247,75,29,250,96,28,7,201,248,95,29,252,81,248,104,10,253,
+105,7,251,119,72,251,69,251,115,251,11,72,174,247,46,81,30,252,52,250,238,
+95,10,247,9,251,212,99,244,181,42,8,251,45,206,247,11,63,247,71,27,247,174,
+247,76,247,44,247,228,31,249,158,247,184,29,254,154,253,52,247,75,29,249,
+145,28,7,48,28,5,6,21,247,117,29,252,3,254,132,252,83,28,4,156,95,10,247,
+98,252,177,5,247,48,6,248,115,28,5,17,5,254,2,253,38,247,75,29,249,145,28,
+6,224,248,144,21,237,251,173,7,247,135,249,38,247,57,29,251,121,253,9,5,251,
+174,6,251,195,249,181,95,10,247,98,252,177,5,247,48,6,247,92,248,177,5,252,
+235,237,247,207,29,248,93,253,15,21,247,101,6,37,251,173,5,14,249,145,28,
+4,179,247,128,21,252,79,28,4,147,95,10,247,105,252,201,91,251,17,81,57,105,
+104,248,4,29,201,168,188,188,30,225,225,183,230,195,247,43,248,130,28,5,47,
+24,247,57,29,253,110,253,9,247,75,29,196,250,181,248,43,21,239,251,36,7,105,
+247,7,5,247,70,239,251,100,6,251,98,249,65,5,251,15,6,251,94,253,65,5,251,
+100,39,247,70,6,105,251,7,5,251,36,39,247,7,6,52,251,186,44,114,5,51,247,
+222,227,7,42,149,5,128,122,164,155,144,31,218,247,160,5,248,74,6,222,251,
+166,5,129,142,129,114,129,27,44,129,5,51,248,26,227,7,65,155,115,144,137,
+145,131,167,25,59,247,156,5,252,30,249,116,21,247,18,252,57,5,251,142,6,109,
+39,21,247,202,6,174,251,7,5,252,15,6,14,247,223,28,5,82,22,245,7,39,150,5,
+116,141,110,159,176,26,28,4,207,69,7,247,38,29,251,72,7,247,176,4,247,74,
+10,247,223,204,248,206,10,33,7,239,128,5,162,137,168,119,102,26,28,251,49,
+209,7,247,28,247,11,5,77,224,247,12,82,247,8,27,248,52,247,79,248,1,248,16,
+248,14,251,118,247,209,251,160,251,70,251,26,45,251,11,251,10,31,247,72,7,
+251,176,4,218,217,247,21,213,247,13,27,247,68,247,75,251,123,251,192,251,
+231,251,28,251,173,251,158,50,251,18,207,203,69,31,14,249,195,64,29,14,247,
+38,28,4,180,249,165,21,247,97,64,7,119,251,14,5,131,137,127,124,129,27,251,
+197,247,230,247,59,6,150,151,127,130,141,31,150,53,5,205,247,166,73,6,128,
+55,5,130,137,128,125,127,27,251,59,141,5,247,198,247,150,7,151,147,127,127,
+142,31,157,38,5,217,247,75,253,86,88,6,204,133,151,138,154,126,131,127,25,
+252,89,253,59,68,130,5,86,247,155,192,7,63,145,127,140,132,150,149,153,25,
+247,41,247,114,5,247,199,251,114,6,128,124,124,120,138,30,73,134,5,86,7,239,
+248,3,21,251,162,6,247,162,248,37,5,14,248,106,247,6,235,21,33,123,5,59,247,
+250,248,199,29,247,62,247,146,5,248,1,251,133,6,124,131,125,116,137,30,47,
+133,5,59,249,233,248,38,10,252,26,248,15,247,112,247,236,10,251,112,247,232,
+247,223,248,32,29,254,51,59,6,231,133,151,138,143,122,130,126,25,247,46,172,
+21,252,93,251,198,7,14,249,195,64,29,248,47,248,165,33,29,249,195,64,29,248,
+94,247,212,83,29,251,224,249,89,250,234,21,247,42,48,247,23,251,66,60,65,
+106,127,108,30,247,236,86,7,251,64,91,5,99,239,253,198,247,85,7,247,160,247,
+5,247,34,247,76,31,251,28,112,21,251,70,47,76,251,47,112,100,141,139,30,248,
+90,7,148,166,192,151,170,27,247,21,212,59,251,48,31,14,180,87,29,251,35,28,
+4,229,43,10,180,87,29,224,253,185,83,29,180,87,29,251,35,253,173,72,29,14,
+180,250,86,251,121,21,249,61,7,35,251,82,5,252,138,222,10,244,249,150,171,
+10,14,180,250,191,248,175,21,247,144,251,31,247,111,251,161,251,12,251,9,
+85,117,92,30,247,62,247,140,243,251,140,247,193,59,7,251,158,60,5,71,247,
+47,251,46,251,62,35,247,62,254,228,247,187,7,248,48,247,68,247,123,247,200,
+31,251,101,98,21,251,191,251,33,36,248,117,29,221,156,184,27,247,90,247,9,
+251,25,251,150,31,14,227,250,238,168,29,251,116,249,163,36,29,153,250,164,
+248,175,21,247,144,251,29,247,111,251,160,251,13,251,9,83,117,92,30,247,47,
+7,247,99,238,247,5,247,21,30,247,27,251,37,5,139,247,0,161,235,26,207,72,
+200,251,30,251,41,251,40,80,251,35,56,30,73,251,5,129,51,251,54,26,254,68,
+247,181,7,248,55,247,64,247,121,247,202,31,251,98,98,21,251,181,251,28,251,
+3,251,135,30,34,249,140,6,153,180,221,154,184,27,247,91,247,9,251,23,251,
+150,31,14,247,98,28,4,208,248,177,247,103,29,252,148,7,251,170,251,65,38,
+251,155,251,149,26,251,191,247,72,251,157,248,21,233,230,156,167,218,30,246,
+7,116,82,79,128,79,27,251,200,251,43,247,146,247,166,247,70,196,247,100,247,
+21,247,20,31,253,133,238,10,180,250,191,247,226,29,248,249,7,251,238,251,
+241,247,47,251,30,5,254,186,238,10,180,247,76,28,5,229,21,28,250,27,248,146,
+29,248,37,10,31,248,70,7,155,153,166,168,30,247,255,247,115,10,6,42,254,133,
+247,66,29,137,250,148,248,130,21,247,174,251,72,247,128,251,189,251,99,251,
+23,251,13,34,84,30,247,93,167,184,247,107,248,44,27,247,168,184,247,19,247,
+9,164,31,108,6,139,115,75,251,118,251,252,251,162,251,35,252,224,30,251,49,
+7,251,155,247,74,251,148,247,187,247,179,247,82,247,122,247,181,30,251,85,
+22,251,128,45,251,87,251,82,251,74,36,247,87,247,128,247,125,233,247,89,247,
+83,247,74,241,251,89,251,125,30,14,251,7,250,35,247,189,21,248,105,10,30,
+247,154,7,152,151,155,247,245,10,123,126,26,253,133,7,247,53,10,248,64,7,
+139,210,147,172,247,70,193,248,205,29,251,7,150,250,16,21,247,65,253,155,
+6,247,213,29,248,105,10,31,247,176,247,65,241,251,65,247,48,251,83,251,48,
+251,65,7,249,80,253,77,21,248,139,10,248,64,7,139,210,147,172,247,70,193,
+248,205,29,190,250,201,247,189,21,247,101,251,66,247,2,251,136,92,248,184,
+29,163,141,30,247,1,145,5,219,253,41,251,129,229,7,161,247,23,5,153,141,152,
+151,153,27,247,43,6,164,149,121,127,31,253,140,248,53,10,39,248,66,10,251,
+95,22,251,1,119,248,5,29,190,248,205,29,110,250,119,247,189,21,247,66,251,
+66,243,251,135,93,66,131,139,30,247,83,241,7,156,149,126,123,143,31,159,39,
+5,229,247,88,251,135,209,6,151,151,156,247,245,10,122,127,26,69,251,135,251,
+88,231,7,159,239,5,155,141,152,152,153,27,241,253,21,6,247,53,10,248,23,7,
+139,210,147,172,247,72,191,39,51,30,14,247,203,90,10,14,247,203,90,10,247,
+209,250,140,39,10,71,250,82,247,189,21,247,46,251,16,204,251,21,153,30,227,
+168,237,201,247,16,26,247,44,251,9,229,251,154,30,252,85,59,6,236,133,5,157,
+137,145,127,131,26,253,150,7,128,133,129,121,137,30,42,133,5,59,248,105,7,
+247,62,247,148,192,247,136,31,251,90,125,21,251,21,67,73,251,119,30,114,98,
+143,119,27,248,1,7,141,165,199,145,184,27,247,64,221,80,251,15,31,73,248,
+88,21,251,9,74,72,251,103,30,96,247,238,6,141,157,170,141,168,27,247,57,215,
+78,34,31,14,247,35,67,10,14,251,183,249,138,250,153,21,247,36,251,19,188,
+251,11,30,218,158,247,5,187,247,14,26,247,15,51,214,251,104,30,251,248,87,
+6,209,247,83,10,69,134,5,86,248,8,7,247,32,247,90,183,247,92,31,251,90,248,
+10,21,33,79,79,251,65,124,106,141,139,30,247,202,7,148,178,143,167,27,247,
+29,207,85,43,31,192,252,21,21,251,8,74,82,251,78,113,82,143,139,30,247,216,
+7,147,207,146,183,27,247,33,212,89,251,4,31,14,71,250,82,247,187,21,247,48,
+251,19,202,251,21,153,30,228,170,239,201,247,16,26,247,44,251,11,229,251,
+152,30,252,87,247,230,10,253,133,247,230,29,248,107,7,247,65,247,145,190,
+247,136,31,251,156,248,74,21,251,7,70,72,251,101,30,92,247,240,248,98,29,
+207,252,84,21,251,21,248,183,29,248,3,7,163,205,143,186,27,247,62,225,84,
+251,15,31,14,247,35,67,10,251,101,28,5,44,43,10,247,35,67,10,158,253,74,83,
+29,247,35,67,10,251,101,253,62,72,29,14,247,35,28,4,135,248,62,29,247,68,
+219,247,96,26,247,97,251,29,248,155,10,248,89,29,253,144,251,74,35,247,74,
+251,116,247,139,10,249,6,21,251,68,47,35,251,158,141,30,116,88,141,139,31,
+248,154,7,153,199,145,182,27,247,103,141,243,49,251,52,26,221,253,23,21,251,
+86,37,42,251,179,141,30,100,53,145,139,31,247,151,247,197,243,251,197,247,
+70,248,60,29,14,251,171,249,150,28,4,151,21,205,251,84,7,217,173,188,201,
+209,26,247,19,49,214,251,98,30,251,250,87,6,213,134,5,156,138,145,127,126,
+26,251,177,34,73,244,251,199,7,126,133,127,122,138,30,65,134,5,87,248,10,
+7,247,29,247,89,182,247,87,213,85,187,67,169,31,117,251,52,21,39,89,67,251,
+101,30,119,102,143,125,27,247,220,247,27,7,247,34,136,192,81,40,26,86,248,
+18,21,45,94,80,251,73,136,30,88,247,204,6,153,166,140,162,27,247,54,190,71,
+50,31,14,71,250,92,248,91,21,242,251,107,7,224,181,192,207,216,26,247,44,
+251,11,229,251,152,30,252,87,247,230,10,251,204,251,25,36,247,25,251,230,
+247,230,29,248,107,7,247,65,247,145,190,247,126,218,84,194,61,175,31,76,251,
+72,21,251,11,248,183,29,247,255,247,41,7,247,54,136,221,82,251,12,26,71,248,
+94,21,251,4,73,79,251,89,136,30,77,247,233,248,98,29,14,247,182,28,5,27,248,
+42,21,247,133,251,89,221,251,74,30,247,13,170,247,68,219,247,96,26,247,97,
+251,30,247,17,251,217,30,252,97,247,35,29,119,116,116,110,137,30,37,131,5,
+51,248,209,7,247,107,247,198,213,247,224,31,251,198,249,6,21,251,68,47,37,
+251,158,117,87,141,139,30,248,154,7,154,241,145,139,31,247,103,149,243,41,
+251,52,26,223,253,23,21,251,86,37,44,251,179,100,51,145,139,30,248,177,7,
+152,243,151,207,27,247,109,247,6,55,251,78,31,14,247,185,28,5,29,247,8,29,
+252,115,111,7,251,128,39,247,174,29,247,13,220,186,247,1,30,186,252,154,6,
+247,190,29,251,115,122,248,101,10,248,189,247,76,7,247,109,247,5,55,251,78,
+31,57,249,21,21,251,68,47,39,251,158,30,65,248,156,6,248,113,10,14,247,35,
+28,4,135,248,31,21,247,183,251,174,211,251,196,82,47,129,139,30,249,39,7,
+251,250,251,242,247,43,251,81,5,253,109,217,29,247,35,28,4,135,248,31,21,
+247,183,251,174,211,251,196,82,47,129,139,30,248,123,7,155,153,166,168,30,
+247,236,247,115,10,254,43,51,6,247,0,247,251,29,254,220,217,29,231,250,232,
+248,50,21,248,109,10,30,248,23,244,10,251,17,131,5,51,248,126,7,248,51,247,
+46,247,236,29,251,103,22,251,93,59,251,11,248,163,29,249,32,247,235,29,247,
+11,32,251,131,30,14,233,250,234,248,95,10,251,123,217,10,247,46,247,236,29,
+251,121,22,247,108,10,233,158,28,4,247,21,247,92,28,251,148,6,247,119,29,
+248,126,7,248,51,247,46,247,19,247,179,248,109,10,31,248,59,247,92,242,251,
+92,247,23,251,99,251,23,251,92,7,249,242,254,84,21,247,108,10,247,166,28,
+5,10,248,95,10,251,101,247,45,251,197,82,47,248,8,10,253,179,251,217,247,
+5,7,166,247,76,5,159,143,153,156,157,27,247,83,6,168,153,114,121,31,254,212,
+248,208,10,248,125,7,248,52,247,25,247,236,29,251,121,247,112,29,14,247,187,
+28,5,31,248,95,10,251,124,247,25,251,197,82,49,128,139,30,247,144,247,101,
+7,157,153,123,118,143,31,166,251,35,5,247,5,247,167,252,21,233,6,155,153,
+164,168,141,30,247,29,147,5,227,252,175,51,7,247,1,247,251,29,45,252,23,251,
+167,247,4,7,166,247,35,5,160,143,153,155,158,27,247,103,254,64,6,247,119,
+29,248,125,7,248,50,247,48,247,236,29,251,124,22,251,93,78,251,7,251,181,
+90,86,143,139,30,249,7,247,235,29,237,53,251,131,30,14,248,250,87,10,14,248,
+250,87,10,247,212,28,5,19,39,10,236,250,246,248,89,21,137,247,159,251,75,
+223,251,92,170,8,247,23,170,247,3,247,9,247,78,248,135,29,63,251,191,251,
+174,30,28,251,45,7,120,125,111,114,137,30,39,128,5,60,248,113,218,7,251,8,
+150,5,124,123,157,170,31,28,4,231,7,247,38,94,247,207,247,146,247,33,204,
+251,9,251,15,251,78,48,251,8,251,98,141,30,136,105,139,108,111,26,247,199,
+147,247,22,251,38,251,127,26,251,159,251,36,85,251,25,82,82,154,174,73,30,
+251,8,7,112,195,219,125,203,27,247,117,247,122,247,1,248,5,136,31,14,251,
+198,249,114,251,80,106,10,251,198,249,114,250,181,106,10,248,47,247,109,247,
+33,21,248,0,10,33,131,5,51,248,114,227,7,62,241,10,248,195,7,248,96,247,88,
+247,24,247,106,239,236,92,93,190,30,252,28,252,131,5,248,108,251,43,195,36,
+251,18,26,251,44,32,49,251,36,62,72,161,164,106,30,125,149,121,158,137,155,
+112,247,64,24,251,21,251,195,6,139,247,55,63,247,63,247,247,247,30,247,103,
+247,99,247,94,251,22,238,251,246,247,19,30,248,17,248,123,5,205,251,39,251,
+59,180,251,58,27,252,24,251,131,251,100,252,115,31,14,251,25,250,15,215,21,
+247,9,7,81,51,55,108,45,27,251,118,248,107,10,247,75,165,170,128,123,168,
+31,251,70,7,123,163,172,120,184,27,200,199,180,219,247,25,251,29,211,251,
+73,247,248,10,247,7,191,188,231,31,14,251,34,53,29,14,252,101,248,216,249,
+209,195,29,251,183,28,4,180,195,29,251,34,53,29,100,28,5,53,33,29,251,34,
+53,29,250,176,4,247,147,10,14,251,34,53,29,28,5,119,4,247,172,29,14,251,34,
+53,29,251,112,28,4,213,43,10,251,34,53,29,100,28,5,53,117,29,54,28,249,117,
+60,10,251,34,247,202,247,68,10,234,81,216,86,186,30,247,13,148,240,185,222,
+183,8,213,10,251,165,247,49,251,100,247,144,111,31,180,101,181,81,69,247,
+109,10,251,34,250,9,251,121,21,248,27,7,35,39,5,251,194,222,10,247,197,4,
+175,29,14,74,248,89,4,247,40,6,251,169,152,247,71,251,93,247,168,27,247,31,
+247,7,191,188,231,31,247,9,7,81,51,55,108,44,27,251,97,251,4,247,43,247,90,
+120,31,247,146,242,251,148,6,247,108,152,246,247,46,247,63,27,247,134,10,
+251,136,251,109,251,49,251,191,110,31,251,42,6,14,251,34,53,29,130,250,156,
+247,195,29,251,34,250,9,252,7,21,247,9,7,84,51,57,106,42,27,251,117,251,6,
+247,66,247,119,31,248,91,7,247,130,247,4,247,66,247,72,248,25,10,199,178,
+219,247,25,251,30,213,251,72,248,94,10,31,252,88,7,251,187,247,74,251,101,
+247,179,247,31,247,9,188,188,229,30,14,251,13,28,4,121,250,224,21,194,79,
+184,39,251,41,46,53,251,15,103,30,152,96,89,147,88,27,247,248,10,247,9,199,
+188,229,31,247,9,7,81,51,57,100,42,27,251,117,251,6,247,75,247,119,247,130,
+247,4,247,66,247,72,166,170,128,123,167,31,251,72,7,122,164,172,123,184,27,
+200,199,178,219,182,135,172,114,169,31,247,30,143,182,209,165,30,247,39,251,
+2,5,139,211,159,211,26,14,251,34,250,23,247,138,21,243,61,217,37,251,56,59,
+251,25,251,44,102,30,251,4,205,92,247,35,247,52,26,247,130,247,2,247,140,
+10,251,30,213,251,72,251,154,251,121,251,73,251,236,251,141,247,31,251,81,
+247,93,84,31,124,49,129,47,63,26,227,6,215,149,239,10,252,112,248,225,250,
+57,21,201,89,186,72,33,87,59,48,115,30,66,178,108,225,235,26,247,35,211,245,
+247,10,157,159,132,129,157,30,251,0,7,129,155,161,130,168,27,179,176,162,
+187,219,50,183,251,9,251,63,251,41,251,0,251,99,251,41,230,251,6,247,22,106,
+31,130,85,132,84,94,26,196,6,184,146,190,150,187,30,138,149,150,139,150,27,
+247,18,240,212,229,31,67,142,21,92,83,95,83,119,122,141,144,120,30,201,157,
+168,210,210,27,171,157,117,112,31,14,251,34,250,9,248,136,169,10,252,112,
+248,216,250,209,21,247,69,251,11,247,22,251,78,48,65,109,109,79,30,69,7,173,
+197,193,158,200,27,247,39,213,251,2,251,28,251,34,67,34,251,10,121,120,144,
+149,120,31,247,0,7,149,123,118,148,110,27,98,101,116,91,59,228,96,247,9,247,
+62,247,43,247,1,247,98,31,14,251,34,248,183,247,26,10,247,230,249,218,169,
+10,157,179,10,251,105,141,21,57,127,60,115,72,30,247,5,118,41,226,251,11,
+27,251,9,41,55,251,2,115,31,117,205,128,216,218,26,248,36,10,251,23,251,166,
+21,248,6,29,14,251,34,174,10,14,251,34,174,10,248,79,247,205,247,50,29,220,
+248,218,250,22,21,251,187,251,109,251,75,251,178,251,32,190,251,6,189,47,
+31,247,8,6,82,227,108,223,233,26,247,117,247,75,247,7,247,119,247,129,247,
+67,251,3,251,74,112,130,109,123,110,30,251,72,6,122,114,123,107,94,26,77,
+178,80,219,247,25,211,247,29,247,72,247,154,251,73,247,124,251,236,30,14,
+251,56,249,246,168,21,247,133,51,7,104,251,47,137,126,131,129,123,131,25,
+139,88,121,63,251,113,32,247,29,247,150,125,30,248,15,225,252,15,6,247,146,
+151,247,19,247,15,247,85,27,221,184,112,129,161,31,151,133,150,122,143,125,
+157,251,17,24,231,247,128,6,173,251,6,55,156,49,27,251,204,251,92,251,103,
+251,195,251,154,247,66,251,153,247,230,247,41,247,31,193,139,31,14,251,46,
+132,10,14,251,46,132,10,251,0,249,195,39,10,247,80,55,29,14,247,80,55,29,
+14,102,250,111,176,21,247,142,251,2,7,98,251,58,137,131,130,130,125,133,25,
+125,98,98,131,92,27,251,146,251,44,247,45,247,159,247,164,247,60,247,35,247,
+110,198,188,125,116,192,31,182,121,143,251,25,141,125,8,247,7,247,135,6,176,
+251,31,53,162,251,1,27,251,238,251,129,251,103,251,197,251,163,247,101,251,
+142,248,8,247,60,247,46,195,145,153,31,14,247,80,55,29,251,50,28,6,226,33,
+29,247,80,55,29,251,11,28,5,201,51,10,247,80,55,29,251,11,28,7,36,54,29,247,
+80,55,29,251,231,28,6,130,43,10,247,80,55,29,251,130,251,205,143,10,219,28,
+8,27,33,29,247,80,248,156,247,68,10,228,88,212,90,186,30,247,98,141,247,79,
+213,149,143,8,247,224,251,11,7,191,29,251,239,247,111,251,216,248,32,93,31,
+178,100,177,83,73,247,109,10,247,146,249,48,4,249,72,242,253,72,6,28,4,246,
+253,104,139,10,247,80,247,34,247,34,10,229,28,250,51,139,10,247,80,28,6,33,
+28,6,66,21,208,71,197,251,19,251,113,41,251,42,251,97,120,30,162,55,68,149,
+55,27,252,64,251,181,251,185,252,60,252,11,247,148,251,240,248,95,247,101,
+247,82,215,143,149,31,247,224,251,11,7,225,10,247,99,137,198,231,174,30,247,
+79,251,33,5,139,227,163,230,26,14,196,250,197,186,21,247,224,38,7,99,251,
+115,136,122,127,123,121,131,25,137,136,83,106,58,27,251,133,251,48,247,66,
+247,190,103,31,248,51,6,158,232,5,252,77,6,138,153,139,155,154,26,155,139,
+154,140,155,30,248,94,6,159,233,5,252,107,6,247,193,178,247,56,247,52,247,
+99,27,226,203,100,125,166,31,149,133,157,116,140,121,165,251,78,24,243,247,
+213,6,190,251,33,47,168,251,5,27,251,213,251,122,251,122,251,238,91,31,251,
+40,6,119,45,5,247,51,6,138,123,139,124,123,26,124,139,124,140,124,30,251,
+31,6,119,46,5,247,60,6,251,210,186,247,101,251,159,247,234,27,247,69,247,
+54,215,143,147,31,14,196,250,190,22,247,114,68,7,115,251,24,5,130,137,128,
+123,128,27,251,209,248,3,247,71,6,150,152,124,130,31,153,46,5,207,247,189,
+71,6,125,48,5,129,128,126,126,30,251,71,247,223,247,160,6,152,149,127,126,
+141,31,159,251,1,5,219,247,90,253,7,82,6,208,134,5,158,137,149,124,126,26,
+251,188,7,251,53,178,46,247,47,247,105,26,247,148,247,30,247,56,247,74,205,
+188,113,130,159,30,147,135,153,124,140,128,159,251,13,24,219,247,101,6,172,
+251,0,68,158,53,27,251,170,251,80,251,111,251,168,251,119,247,36,251,121,
+247,155,109,31,251,226,7,126,129,124,120,137,30,70,134,5,82,7,14,196,250,
+202,186,21,247,224,251,0,7,97,251,115,136,122,126,123,120,131,25,135,137,
+85,108,58,137,8,121,141,127,152,158,26,248,57,7,198,191,191,175,188,27,178,
+163,121,115,159,31,199,247,45,6,149,119,97,152,107,27,67,53,32,91,95,31,247,
+28,76,7,251,83,81,5,88,247,3,252,118,7,121,126,126,122,136,30,251,66,220,
+39,247,93,247,180,26,248,29,247,84,247,101,247,143,231,207,100,125,167,30,
+150,133,158,116,141,121,166,251,78,24,247,3,247,213,6,190,251,42,42,168,251,
+12,27,252,21,251,152,251,185,252,60,252,11,247,122,251,240,248,49,247,81,
+247,63,215,143,148,31,14,196,250,136,215,21,247,209,38,7,99,251,105,136,123,
+127,123,121,132,25,137,136,83,107,58,27,119,28,4,133,6,224,138,202,102,166,
+126,149,133,157,117,140,122,165,251,69,24,243,247,198,6,251,28,186,48,166,
+32,141,8,247,41,42,251,46,7,251,208,98,251,100,251,158,252,8,26,251,223,247,
+78,251,201,247,230,95,30,251,108,236,247,103,7,247,64,142,247,46,208,147,
+143,8,253,135,248,249,21,247,215,247,27,247,85,247,81,186,30,254,255,7,251,
+97,194,251,11,247,96,247,201,26,14,247,80,28,4,180,248,15,21,251,11,6,170,
+10,221,219,151,154,206,31,252,99,7,247,72,189,5,14,247,125,250,254,247,235,
+21,57,36,79,94,251,106,27,103,104,141,143,108,31,247,20,247,179,174,214,145,
+174,91,232,25,251,82,247,253,5,248,112,6,247,54,247,65,115,200,5,252,222,
+6,251,218,251,193,5,251,12,251,5,55,251,37,251,82,26,251,87,247,52,252,25,
+248,170,247,14,247,76,176,139,30,247,61,247,164,5,253,88,101,21,251,100,208,
+53,247,59,247,62,26,247,65,157,172,229,237,30,247,128,252,96,166,85,127,94,
+128,111,25,14,248,17,250,236,248,86,21,251,58,111,45,251,113,251,99,27,251,
+78,251,56,247,69,248,74,31,141,247,221,7,247,171,247,17,251,27,222,27,236,
+6,163,168,161,186,205,34,197,251,113,31,253,18,6,247,255,158,247,83,247,26,
+247,54,27,247,59,247,13,251,119,251,9,156,31,247,179,6,247,124,114,251,216,
+247,93,251,151,27,251,172,252,67,251,37,252,188,252,66,247,231,251,115,247,
+231,248,57,247,85,247,124,247,138,166,31,14,247,80,133,29,14,102,211,176,
+21,133,153,247,46,83,247,60,27,248,8,247,101,247,142,247,163,247,197,251,
+129,247,103,251,238,251,1,53,116,102,251,31,31,251,135,247,7,7,141,153,143,
+247,25,182,157,8,162,192,188,153,198,27,247,110,247,60,251,35,251,164,251,
+159,251,44,251,45,251,146,92,98,147,153,98,31,125,145,130,148,137,147,98,
+247,58,24,251,2,6,14,247,80,28,4,180,249,70,21,248,58,251,181,247,187,252,
+64,251,23,251,0,110,88,251,60,30,251,213,247,15,7,172,247,78,143,157,155,
+162,153,145,25,153,168,215,178,241,27,247,171,247,107,251,94,252,30,252,17,
+251,87,251,125,251,215,42,76,170,141,133,31,118,147,125,155,135,156,92,247,
+115,24,251,13,251,224,6,135,149,247,83,63,247,100,27,248,95,247,148,247,238,
+248,13,31,14,247,80,133,29,252,187,151,247,50,29,247,72,28,4,172,178,21,247,
+215,251,3,7,92,251,109,137,123,125,123,116,128,25,139,70,113,251,1,251,199,
+251,95,247,99,248,6,121,30,248,205,234,252,205,6,248,6,155,247,109,247,72,
+247,161,27,247,6,215,105,122,172,31,155,131,154,117,143,118,167,251,66,24,
+247,7,247,207,6,186,251,54,251,6,162,251,17,27,252,71,251,172,251,187,252,
+58,251,254,247,136,251,253,248,105,247,98,247,89,211,139,31,14,247,72,122,
+10,14,247,72,122,10,251,164,250,147,39,10,198,44,10,14,198,44,10,14,251,228,
+249,105,249,164,161,29,251,114,28,4,135,161,29,198,44,10,60,249,250,43,10,
+198,44,10,247,33,28,250,151,51,10,198,44,10,247,41,28,251,92,83,29,198,44,
+10,60,28,251,104,72,29,14,198,44,10,74,28,251,106,57,29,247,197,44,10,248,
+187,248,127,81,29,198,250,226,251,23,21,247,103,7,51,247,110,10,28,5,98,158,
+10,247,107,251,23,7,251,58,74,78,92,128,30,251,79,247,34,5,139,49,124,49,
+26,70,209,71,247,19,247,131,199,247,82,247,40,30,251,214,247,209,153,10,198,
+120,29,14,198,120,29,247,83,28,251,147,21,242,253,163,36,7,14,243,44,10,248,
+86,248,42,36,29,248,27,28,5,12,249,201,21,251,132,253,103,5,101,6,114,121,
+159,164,31,28,5,86,158,10,247,132,247,51,10,252,248,253,15,153,10,231,28,
+5,55,28,5,102,21,248,68,10,45,7,147,107,51,156,73,27,251,244,251,66,247,206,
+10,247,13,243,201,211,231,31,251,1,247,216,217,7,51,247,255,10,250,76,7,247,
+120,133,202,235,176,248,136,29,252,189,28,251,84,21,105,88,61,104,248,105,
+29,247,24,247,55,247,94,199,219,121,127,173,31,14,231,28,5,55,251,234,21,
+248,200,10,43,176,143,203,247,119,26,28,6,16,247,70,10,252,11,7,247,3,29,
+30,252,191,248,164,153,10,231,249,160,250,111,21,247,3,29,248,200,10,48,177,
+138,189,247,132,26,250,248,7,247,156,147,167,221,175,248,136,29,248,68,10,
+254,19,4,248,225,29,247,80,28,5,47,247,125,21,223,88,230,32,70,73,102,108,
+76,30,28,4,145,247,59,10,202,201,156,167,196,31,102,82,88,45,119,73,221,111,
+24,180,231,198,247,13,221,243,8,61,176,219,105,247,6,27,247,44,247,33,210,
+247,74,31,252,183,105,21,77,76,92,117,40,247,169,29,248,93,253,42,21,57,69,
+57,59,45,119,244,229,137,30,174,194,198,161,203,27,202,164,113,77,31,14,198,
+250,95,28,5,229,21,253,151,251,211,247,5,6,167,247,85,5,153,141,155,155,153,
+27,248,0,6,167,154,112,123,31,252,19,247,0,10,251,83,194,153,10,249,17,28,
+6,127,247,226,29,248,209,158,10,248,112,29,254,7,251,247,162,29,249,54,252,
+19,247,66,29,250,129,44,10,28,4,228,254,7,248,238,29,250,129,44,10,28,4,228,
+254,7,248,244,29,248,197,28,6,49,22,247,201,251,2,248,161,10,116,110,119,
+27,252,50,223,29,7,248,177,250,15,21,251,242,252,144,5,248,144,7,251,83,253,
+85,215,10,248,197,28,6,72,247,160,21,219,71,205,59,251,60,49,251,13,251,87,
+88,30,251,50,223,29,247,240,7,127,59,133,51,141,43,8,227,6,141,208,147,238,
+156,235,8,247,8,6,247,26,247,23,247,7,247,45,31,251,179,249,3,21,251,242,
+252,144,5,248,144,7,248,174,253,7,21,51,76,61,251,11,30,65,6,247,15,174,199,
+240,233,27,174,171,116,104,31,253,109,61,215,10,248,252,28,6,106,149,21,247,
+109,251,74,247,71,251,142,30,248,34,248,80,5,247,29,253,17,248,158,57,7,251,
+156,60,5,71,247,45,7,141,252,11,5,247,192,29,247,11,241,201,211,233,31,251,
+1,207,7,237,184,247,64,247,109,247,25,27,247,23,242,39,251,95,251,58,36,251,
+113,251,84,73,82,162,167,86,31,73,247,83,5,151,121,108,143,122,27,58,98,74,
+83,41,247,39,251,25,247,168,247,189,247,107,247,123,247,140,31,251,107,249,
+181,21,252,92,252,138,5,248,138,7,251,83,253,5,215,10,248,180,249,160,247,
+78,162,29,161,253,144,21,45,184,190,90,247,118,27,247,124,242,247,10,247,
+99,31,247,28,10,28,4,198,247,48,29,247,18,211,211,233,31,14,106,100,10,106,
+100,10,252,31,248,245,28,6,14,21,199,50,219,251,72,251,5,37,76,33,65,245,
+83,241,66,30,251,33,90,251,34,57,251,44,26,251,84,247,41,66,247,48,247,34,
+247,45,237,247,84,30,247,176,252,61,229,247,1,26,195,202,166,187,182,176,
+122,114,174,30,167,42,5,132,150,167,136,151,27,192,165,178,173,31,45,252,
+135,21,251,26,81,47,251,3,50,67,211,247,29,247,27,246,211,229,180,30,212,
+79,199,67,40,26,14,252,15,248,227,28,6,94,21,108,189,251,37,59,43,229,251,
+56,94,5,105,7,247,4,125,186,90,251,45,54,168,90,247,61,232,143,136,211,53,
+165,96,25,138,89,156,101,27,251,75,251,31,251,17,251,74,251,75,247,17,251,
+24,247,81,247,75,247,22,247,29,247,103,247,96,251,67,247,75,92,188,31,232,
+252,97,21,251,22,90,251,29,251,23,251,21,89,247,20,247,22,247,34,204,247,
+4,247,33,173,182,125,129,163,30,173,88,157,68,40,26,14,247,221,50,10,14,251,
+62,250,4,28,4,175,21,247,176,251,101,247,18,251,172,30,251,235,87,6,209,247,
+83,29,69,134,5,86,248,6,7,247,226,247,20,247,91,247,107,31,251,43,137,21,
+251,146,251,26,43,251,97,137,30,251,0,138,5,249,87,240,7,247,102,247,28,43,
+251,150,31,14,214,247,112,10,253,133,247,166,10,251,97,137,21,251,183,251,
+56,251,7,251,138,30,251,14,249,191,247,8,6,247,148,247,52,251,0,251,189,31,
+14,247,221,50,10,50,28,4,165,54,29,247,221,50,10,251,201,250,151,43,10,247,
+221,50,10,50,28,251,92,51,10,247,221,50,10,58,254,115,83,29,247,221,50,10,
+251,201,254,103,72,29,14,247,221,50,10,251,187,254,101,57,29,247,221,78,10,
+247,221,78,10,215,247,112,10,251,210,251,46,45,247,46,251,233,247,166,10,
+252,126,101,21,233,251,139,247,239,247,8,7,247,148,247,52,251,0,251,189,251,
+183,251,56,251,7,251,138,31,251,14,248,6,6,14,248,113,28,5,213,249,70,248,
+179,29,252,76,247,51,29,254,220,7,123,118,114,112,137,30,33,131,5,51,248,
+203,7,248,150,247,91,247,224,247,250,31,251,123,135,21,252,58,251,99,251,
+52,251,208,135,30,251,60,137,5,28,4,154,247,50,7,247,216,247,101,251,52,252,
+66,31,14,247,51,28,4,165,227,21,251,17,147,5,110,141,125,164,155,26,250,220,
+247,92,29,254,43,251,211,247,5,7,165,247,76,5,160,142,153,157,157,27,247,
+236,6,168,153,112,123,31,252,123,7,139,40,149,89,251,203,251,166,251,11,251,
+153,251,192,247,114,61,248,33,30,248,126,6,252,11,237,21,139,86,135,88,251,
+174,251,19,205,247,101,247,99,247,12,223,247,154,186,223,129,139,30,14,28,
+4,251,50,10,28,4,164,253,66,248,238,29,28,4,251,50,10,28,4,164,253,66,248,
+244,29,28,5,227,50,10,28,5,129,253,66,21,248,238,10,28,5,227,50,10,28,5,129,
+253,66,21,248,244,10,247,1,219,248,50,21,251,179,247,46,251,19,248,51,30,
+248,126,227,6,251,17,147,5,110,141,125,164,155,26,250,220,247,21,10,30,247,
+121,22,248,140,10,253,28,7,139,86,135,88,251,181,77,247,7,247,93,30,14,249,
+60,249,227,214,21,76,211,236,104,247,16,27,247,180,247,38,247,11,247,146,
+31,247,1,242,10,40,7,251,96,61,78,251,2,251,17,56,200,247,96,30,249,255,247,
+21,10,251,179,247,77,251,29,247,196,247,2,224,167,196,222,30,252,174,247,
+231,21,248,140,10,253,0,7,118,102,65,118,88,27,251,99,53,247,17,247,93,31,
+14,247,105,247,90,10,247,221,221,29,252,159,141,21,248,78,29,30,247,188,10,
+251,58,247,66,141,6,247,101,247,78,247,37,247,167,31,251,59,117,247,187,29,
+14,250,233,247,10,29,248,52,237,21,28,4,154,247,210,29,252,9,22,247,191,10,
+6,14,250,233,247,10,29,247,101,237,21,247,191,10,251,67,6,140,132,131,139,
+132,27,251,121,251,38,251,66,251,128,251,167,247,78,251,37,247,101,31,141,
+6,247,99,251,66,21,247,66,141,7,247,101,247,78,247,37,247,167,248,78,29,31,
+247,188,10,203,248,208,247,187,29,253,47,22,247,59,216,247,29,247,45,160,
+30,253,34,7,251,35,142,52,247,31,247,79,26,14,247,221,221,29,254,44,248,222,
+138,29,251,59,117,21,247,194,29,250,233,28,5,135,22,247,43,29,182,237,21,
+247,222,10,64,6,252,87,150,251,47,251,71,251,233,26,252,8,247,94,251,38,248,
+40,137,30,65,7,247,99,28,4,154,138,29,254,45,22,251,135,247,38,251,9,247,
+101,30,141,68,6,251,227,146,35,247,73,247,133,26,247,107,177,247,98,248,37,
+143,30,65,7,140,132,132,139,131,27,251,121,33,251,36,251,98,31,247,59,117,
+21,247,29,177,246,247,44,160,30,252,170,7,251,35,142,92,247,1,247,49,26,248,
+223,22,247,194,29,248,97,247,87,249,82,21,218,230,247,39,189,247,37,27,151,
+150,138,138,150,31,82,66,92,54,97,46,92,36,112,251,10,111,38,8,171,104,100,
+162,91,27,251,12,67,67,40,40,220,85,203,229,197,172,218,192,31,77,186,201,
+84,237,27,247,214,247,25,247,103,247,208,247,79,251,17,247,14,251,58,188,
+31,202,208,214,193,231,174,102,186,24,251,13,104,43,75,59,54,8,142,114,114,
+141,113,27,251,60,251,34,84,45,251,8,31,248,48,251,113,21,177,246,185,235,
+199,220,8,247,27,86,196,251,22,251,12,26,251,165,71,251,94,251,114,67,90,
+203,206,87,30,130,151,179,222,181,247,7,193,247,45,25,248,82,253,212,21,208,
+247,59,149,212,175,247,6,8,103,155,218,121,202,27,247,25,221,206,247,5,247,
+2,40,197,41,251,41,73,85,41,107,31,83,251,64,118,251,49,66,251,55,8,247,140,
+248,106,21,202,196,191,209,209,196,87,76,76,82,87,69,69,82,191,202,30,254,
+53,245,21,181,171,98,89,173,31,48,108,101,77,73,27,91,101,189,196,220,178,
+195,213,31,14,47,67,29,14,252,69,248,248,252,35,21,214,7,103,79,65,99,62,
+27,251,63,88,247,28,247,17,31,248,68,6,140,150,139,154,147,26,247,39,55,244,
+251,57,251,73,251,24,251,17,251,84,251,97,247,40,39,247,53,230,226,173,181,
+214,30,251,25,247,207,21,251,185,6,245,146,208,204,226,27,228,180,76,58,31,
+14,252,60,248,252,249,226,195,10,251,168,28,4,197,195,10,47,67,29,126,248,
+96,50,29,47,34,10,247,55,248,92,48,10,47,34,10,247,33,248,92,69,29,223,249,
+61,33,29,47,34,10,247,33,248,92,66,29,47,34,10,247,33,248,92,69,29,247,36,
+249,75,36,29,47,34,10,247,33,248,92,69,29,83,249,53,45,29,47,34,10,60,254,
+89,72,29,247,112,28,5,141,51,10,47,34,10,247,3,248,92,65,10,47,34,10,247,
+3,249,140,66,10,47,67,29,234,249,64,86,29,47,34,10,247,33,249,183,54,29,47,
+34,10,247,54,249,131,36,29,47,34,10,247,41,248,164,83,29,47,34,10,247,41,
+248,164,227,10,249,19,248,215,33,29,47,34,10,247,41,248,164,227,10,248,160,
+247,190,50,29,47,67,29,247,22,249,25,39,10,47,34,10,60,249,21,43,10,47,34,
+10,101,249,109,45,29,47,34,10,247,33,28,251,106,51,10,47,34,10,247,54,253,
+226,145,10,47,34,10,60,254,89,72,29,14,247,200,250,58,247,209,21,251,19,46,
+251,6,49,247,6,29,247,15,247,27,189,247,11,235,30,36,168,232,73,223,27,234,
+221,188,247,60,221,31,247,17,7,251,45,52,65,75,66,27,251,21,72,247,22,226,
+31,251,97,247,202,247,45,10,14,47,34,10,148,254,62,60,10,47,34,10,247,3,249,
+140,68,29,37,28,249,94,60,10,47,249,241,248,36,29,205,214,247,10,195,30,251,
+30,122,5,79,107,251,7,32,247,149,10,212,248,72,151,10,47,28,5,25,247,17,29,
+248,76,151,10,47,34,10,247,66,248,72,247,195,29,247,35,250,88,249,7,105,29,
+247,35,248,153,227,21,171,91,5,247,35,100,150,109,251,183,26,247,17,6,247,
+183,143,169,247,50,178,30,163,187,5,89,248,175,105,29,47,82,29,47,82,29,47,
+82,29,252,69,248,248,251,50,21,247,98,251,39,238,251,54,48,52,106,96,64,30,
+64,7,176,199,213,178,215,27,247,64,190,251,27,251,17,31,252,67,6,137,127,
+139,125,130,26,251,38,223,33,247,57,247,73,247,24,247,17,247,84,30,251,28,
+53,21,33,133,69,75,51,27,52,97,201,220,31,166,7,14,252,60,248,252,250,211,
+21,247,97,251,39,238,251,54,49,51,108,96,65,30,63,7,176,199,214,178,215,27,
+247,64,188,251,27,251,17,31,252,68,104,6,251,37,223,32,247,56,247,74,247,
+23,247,17,247,84,30,251,27,53,21,33,133,70,73,50,27,51,98,203,221,31,165,
+7,14,47,147,29,248,166,250,77,39,10,173,248,224,247,252,21,248,76,252,225,
+6,247,231,10,248,27,29,249,73,252,178,7,247,238,190,154,29,14,247,51,28,5,
+0,249,99,21,80,176,5,71,122,143,51,66,27,102,118,196,205,31,247,33,7,86,193,
+251,60,251,3,5,247,29,51,251,39,207,251,52,27,251,31,251,30,90,67,251,6,31,
+251,17,7,200,231,247,6,199,247,9,27,247,52,231,55,251,1,186,31,252,250,252,
+51,5,46,204,251,103,247,202,247,170,247,95,247,107,247,212,227,125,213,112,
+204,30,247,7,217,5,251,29,7,63,184,59,212,247,21,154,247,1,227,149,30,252,
+181,251,152,21,251,58,82,251,111,251,97,251,27,53,233,247,27,30,248,103,247,
+210,5,151,87,143,84,84,26,14,77,250,89,248,119,21,247,212,251,99,247,101,
+251,146,251,126,251,92,251,68,251,136,125,139,114,141,121,30,249,56,6,251,
+101,85,251,132,251,105,251,8,251,42,194,247,17,251,7,30,251,17,7,251,10,244,
+247,23,91,247,31,27,247,140,247,134,247,81,247,211,31,251,120,247,36,21,252,
+119,6,247,74,172,243,247,3,244,27,247,8,240,251,15,251,62,163,31,14,251,89,
+249,230,247,19,121,29,252,134,248,193,249,240,21,211,7,84,76,57,91,53,27,
+40,90,187,212,223,207,154,208,31,141,141,174,137,143,27,192,7,47,84,180,227,
+211,196,175,205,194,160,109,137,141,31,53,7,139,159,112,188,174,176,174,178,
+217,41,184,251,34,251,13,33,71,47,86,180,73,223,112,30,59,131,59,96,55,26,
+251,11,231,78,247,77,212,229,174,194,207,30,14,251,89,28,4,197,247,17,29,
+248,101,121,29,251,89,249,209,247,168,118,29,252,130,248,180,250,75,21,224,
+62,180,59,148,30,223,166,179,205,191,26,232,32,207,251,14,251,32,42,94,60,
+101,175,104,173,188,161,165,139,30,226,7,140,141,158,172,195,27,205,197,100,
+67,52,83,98,46,31,86,7,143,175,140,138,142,31,207,206,125,55,64,90,93,42,
+52,55,185,195,77,31,67,7,84,207,229,103,213,27,247,75,231,202,247,10,31,14,
+251,89,248,158,247,26,10,247,199,248,250,118,29,198,28,4,156,249,132,21,79,
+178,5,57,131,121,65,77,27,96,129,196,205,31,247,54,7,80,171,251,42,37,5,237,
+84,251,17,203,251,36,27,251,107,251,41,63,251,23,75,194,82,192,213,174,182,
+139,31,247,37,7,139,174,195,223,239,227,248,139,29,202,7,246,241,117,251,
+33,251,17,66,61,251,42,251,25,248,188,29,243,247,31,79,247,5,27,247,175,247,
+33,244,247,88,247,34,251,13,210,251,15,152,31,247,21,184,203,247,2,225,26,
+150,139,149,137,149,30,247,0,215,5,251,29,7,63,178,57,219,247,21,157,247,
+5,223,148,30,14,251,89,243,250,31,21,251,11,7,218,233,235,183,247,5,27,229,
+233,71,34,251,11,56,75,53,31,75,51,6,247,36,243,71,251,37,251,13,251,0,65,
+38,73,67,186,148,128,31,247,37,7,159,125,99,162,85,27,86,83,82,75,251,23,
+247,72,63,247,107,247,80,247,76,247,15,247,48,247,8,56,219,251,21,184,31,
+247,15,154,219,247,1,247,14,26,247,68,251,33,234,251,135,47,251,4,101,72,
+42,30,14,252,148,212,28,5,49,21,68,7,186,200,201,166,213,27,197,200,98,76,
+67,85,101,83,31,98,86,6,232,207,98,52,67,69,94,73,96,92,168,144,132,31,226,
+7,151,130,113,153,104,27,105,102,105,100,61,247,9,93,247,32,247,14,247,12,
+213,232,209,85,187,55,166,31,219,148,191,204,213,26,244,47,196,251,50,79,
+67,116,99,76,30,14,59,250,70,248,152,21,247,173,251,72,247,107,251,164,251,
+93,251,64,248,107,29,251,17,126,251,10,68,248,190,29,247,164,247,72,247,155,
+247,170,30,251,19,22,251,179,251,70,251,45,251,41,251,9,32,217,247,17,247,
+33,242,161,245,30,203,227,6,251,36,55,205,247,39,247,13,232,203,225,247,41,
+247,70,251,15,251,181,31,14,59,250,70,247,168,21,247,34,251,11,210,251,17,
+152,30,247,24,184,200,247,2,225,26,247,48,251,62,247,5,251,95,251,164,251,
+72,251,107,251,173,251,170,247,72,251,155,247,164,247,175,247,33,244,247,
+88,30,251,90,142,21,251,17,32,61,251,9,251,41,251,70,247,45,247,179,247,181,
+247,70,247,15,247,41,225,231,248,139,29,203,7,245,242,117,251,33,31,14,251,
+81,209,247,166,21,251,82,247,36,251,1,247,191,245,225,154,176,247,25,30,247,
+123,41,7,114,251,7,137,127,123,123,131,135,25,128,114,68,105,57,27,251,54,
+53,216,247,25,247,48,247,17,166,237,199,167,133,139,31,245,7,139,115,137,
+122,251,33,55,198,247,19,247,23,231,187,247,1,221,196,106,118,161,30,148,
+131,157,127,141,125,164,251,11,24,237,247,115,6,200,251,31,34,152,33,27,251,
+85,251,58,42,251,43,49,176,34,247,83,88,31,251,54,131,251,1,53,251,42,26,
+14,251,81,103,10,14,251,81,103,10,60,250,163,39,10,251,81,247,102,247,68,
+10,235,80,217,86,185,30,247,134,158,247,9,245,247,63,26,125,10,247,20,104,
+223,123,240,138,8,178,101,179,82,71,247,109,10,251,11,249,218,247,166,21,
+167,10,30,251,168,7,247,68,190,55,251,127,31,244,248,35,6,35,247,253,10,14,
+248,27,249,215,247,179,21,247,22,33,232,177,10,251,79,205,251,5,247,162,247,
+124,232,247,10,247,99,30,247,35,7,247,105,29,105,63,36,34,98,215,247,23,30,
+14,237,64,10,14,251,212,249,118,249,165,21,247,97,68,7,115,251,14,5,131,137,
+128,124,128,27,251,229,247,230,247,91,6,150,152,126,130,31,153,54,5,207,247,
+166,71,6,125,55,5,130,128,127,126,30,251,91,247,198,247,180,6,152,149,127,
+127,141,31,159,38,5,219,247,75,253,27,87,6,208,247,83,29,70,134,5,86,7,14,
+251,7,250,50,22,248,38,10,252,46,248,15,247,132,247,236,10,251,132,247,232,
+247,243,248,32,29,253,197,59,6,231,247,4,10,47,133,5,59,7,14,237,64,10,249,
+92,28,5,248,50,29,237,33,10,250,12,28,5,248,48,10,237,33,10,249,246,28,5,
+248,69,29,223,249,61,33,29,237,33,10,249,246,28,5,248,66,29,237,33,10,249,
+246,28,5,248,69,29,247,36,249,75,36,29,237,33,10,249,246,28,5,248,69,29,83,
+249,53,45,29,237,33,10,249,26,251,185,72,29,247,112,28,7,29,51,10,237,33,
+10,249,216,28,5,248,65,10,237,33,10,249,216,28,7,40,66,10,237,64,10,249,200,
+84,29,237,33,10,249,246,28,7,83,54,29,237,33,10,250,11,28,7,31,36,29,237,
+33,10,249,254,28,6,64,83,29,237,33,10,249,254,28,6,64,227,10,249,19,248,215,
+33,29,237,33,10,249,254,28,6,64,227,10,248,160,247,190,50,29,237,64,10,249,
+235,65,29,237,33,10,249,26,28,6,177,43,10,237,33,10,249,67,28,7,9,45,29,237,
+33,10,249,246,252,138,51,10,237,33,10,250,11,80,29,237,33,10,249,26,70,10,
+237,33,10,249,147,92,29,237,33,10,249,147,251,158,143,10,208,28,8,50,66,10,
+237,33,10,250,82,251,226,72,10,237,171,247,34,10,247,16,28,250,4,21,141,10,
+14,251,7,192,250,111,21,251,154,247,1,7,168,247,43,5,148,141,149,151,145,
+27,248,46,252,15,251,132,6,108,137,237,168,135,31,39,251,234,239,6,166,143,
+141,237,170,27,247,132,251,232,251,243,6,131,133,145,151,137,31,112,247,19,
+5,251,8,251,125,249,197,219,6,47,145,5,116,141,131,153,154,26,249,133,7,154,
+147,153,162,141,30,231,145,5,219,7,14,248,163,28,5,234,247,36,101,10,248,
+163,249,106,227,21,171,91,5,247,35,100,150,251,22,251,183,26,247,55,6,247,
+183,143,247,22,247,50,178,30,163,187,5,247,145,195,101,10,237,247,25,248,
+206,10,251,197,248,85,29,248,80,252,146,251,199,6,120,121,159,154,31,118,
+247,33,5,35,252,93,243,6,160,247,33,5,154,159,161,156,30,247,199,252,199,
+252,154,6,248,108,29,251,234,250,186,227,6,33,247,5,29,245,147,5,227,7,14,
+193,247,42,28,5,80,21,251,32,249,70,252,106,253,50,251,32,249,50,252,106,
+253,70,251,32,249,230,28,5,80,7,14,193,247,89,251,77,21,242,98,224,247,118,
+5,248,251,28,5,80,40,6,214,247,88,33,178,50,251,127,5,253,11,251,32,248,214,
+6,251,70,252,106,5,252,16,251,32,247,219,6,251,69,252,106,5,251,62,251,32,
+247,9,6,248,209,248,246,21,252,106,252,38,7,247,71,248,106,5,192,247,32,21,
+247,62,248,84,5,252,84,7,14,251,212,230,28,6,73,21,251,75,219,7,160,240,5,
+151,140,149,151,152,27,247,180,251,198,251,91,6,126,128,151,148,31,125,223,
+5,71,251,166,207,6,153,224,5,148,152,152,150,30,247,91,251,230,251,229,6,
+128,128,154,147,137,31,115,247,14,5,68,251,97,249,70,192,6,70,248,10,10,208,
+144,5,191,7,14,247,152,131,29,247,152,131,29,247,152,135,29,249,65,28,4,130,
+39,10,188,250,199,247,107,21,192,104,199,55,121,110,141,124,119,30,69,251,
+80,5,106,88,94,115,67,27,251,117,251,15,247,37,247,66,247,101,247,66,192,
+247,36,31,200,186,133,145,27,247,13,7,139,115,137,108,251,83,37,233,247,62,
+247,68,247,7,235,247,39,247,3,202,84,131,152,30,251,87,7,137,145,174,109,
+188,27,186,217,173,228,247,57,251,46,247,1,251,185,251,148,251,78,251,21,
+251,115,251,32,219,251,14,247,115,71,31,251,97,129,251,72,251,1,251,105,26,
+251,152,247,66,251,58,248,7,247,164,247,70,247,29,247,3,30,14,188,209,247,
+107,21,251,3,247,70,251,29,247,164,248,7,247,66,247,58,247,152,247,105,251,
+72,247,1,251,97,149,30,247,115,207,219,247,14,247,32,26,247,115,251,78,247,
+21,251,148,251,185,251,46,251,1,251,57,50,217,105,186,188,174,169,141,145,
+30,247,87,7,147,152,202,194,247,3,27,247,39,247,7,43,251,68,251,62,37,45,
+251,83,108,115,141,139,31,251,13,7,145,186,145,200,27,247,36,247,66,86,251,
+101,251,66,251,15,251,37,251,117,67,94,163,172,88,31,69,247,80,5,154,119,
+110,137,121,27,55,104,79,86,31,14,161,219,248,21,21,251,160,247,70,251,42,
+248,9,247,25,247,0,160,190,247,58,30,247,213,251,15,7,109,251,78,136,121,
+119,116,127,133,25,125,108,51,89,37,27,251,95,251,38,247,30,247,78,247,107,
+247,87,190,247,15,215,173,131,139,31,247,13,7,139,109,137,118,251,70,251,
+33,233,247,70,247,75,247,45,223,247,27,242,209,93,109,169,30,149,129,162,
+120,141,121,170,251,79,24,247,15,247,204,6,225,251,66,251,24,155,251,25,27,
+251,131,251,99,251,25,251,101,251,19,235,251,37,247,130,69,31,251,95,127,
+251,76,251,13,251,97,26,14,161,94,10,14,161,94,10,251,86,28,5,48,39,10,161,
+247,212,247,68,10,231,85,215,88,185,30,247,190,167,247,36,247,36,247,133,
+26,103,29,152,6,176,101,174,85,76,247,109,10,247,45,249,218,22,247,106,231,
+248,170,10,244,248,144,6,251,86,146,122,140,247,181,26,146,10,30,14,249,87,
+249,215,248,0,21,251,168,247,23,251,13,247,103,247,180,247,28,247,21,247,
+146,30,247,173,7,247,99,10,71,68,251,2,45,55,202,247,114,247,119,251,76,247,
+6,168,10,247,84,71,251,113,30,14,253,36,248,160,28,6,88,21,180,102,172,64,
+51,51,96,47,87,30,107,79,126,80,59,26,53,116,5,96,225,252,72,248,129,29,247,
+216,186,7,61,247,253,29,248,72,247,58,203,251,58,7,141,231,141,247,7,176,
+190,178,157,25,141,137,247,5,66,145,135,8,149,141,190,153,188,26,14,252,64,
+81,10,251,68,247,199,43,10,252,64,248,193,185,10,247,132,28,6,79,150,29,14,
+252,64,81,10,251,36,253,163,36,29,252,64,249,177,28,5,106,248,220,29,135,
+251,73,37,247,73,251,17,251,73,37,247,73,252,147,247,139,29,248,147,247,146,
+241,251,146,247,17,247,146,241,251,146,247,23,248,221,29,249,116,28,6,145,
+247,172,10,87,123,5,252,153,247,23,6,248,164,10,184,29,248,98,253,117,178,
+10,252,64,169,29,14,252,64,169,29,251,170,248,3,43,10,252,64,249,10,250,199,
+21,242,251,126,7,153,247,31,192,204,190,166,247,33,29,247,50,10,120,102,124,
+106,129,105,8,251,98,36,247,77,6,136,109,138,106,102,26,253,224,244,29,250,
+68,7,14,252,64,249,3,250,27,21,83,223,251,66,251,12,5,247,127,7,248,164,10,
+247,33,29,247,50,10,248,56,29,251,130,7,251,119,251,47,190,55,247,68,247,
+11,5,252,122,244,29,248,251,7,14,251,89,211,10,14,251,89,211,10,115,249,103,
+33,29,251,169,249,158,250,11,21,247,191,55,7,111,251,68,5,126,137,118,127,
+127,27,252,216,59,6,247,61,29,249,150,7,14,251,89,249,238,249,66,21,247,191,
+253,187,248,222,29,184,247,204,29,53,247,253,10,249,150,248,210,10,251,89,
+249,238,249,66,21,247,191,253,187,59,7,247,107,10,248,79,219,247,72,29,14,
+251,89,248,130,251,121,21,247,201,247,72,29,223,247,191,253,187,59,6,247,
+107,10,247,231,210,29,251,73,249,250,249,119,21,247,140,253,197,59,7,242,
+248,90,29,253,133,7,124,131,125,117,137,30,36,133,5,59,248,89,219,7,39,247,
+254,10,247,228,247,127,7,247,134,29,251,127,247,246,247,232,6,147,147,131,
+127,141,31,166,251,32,5,14,151,136,29,251,154,249,44,43,10,196,248,89,28,
+4,250,21,248,72,247,92,10,252,17,251,60,39,247,60,251,7,251,60,39,247,60,
+252,32,247,128,29,248,32,248,45,239,252,45,247,7,248,45,239,252,45,7,14,151,
+247,201,10,28,250,180,201,29,248,169,248,74,248,207,29,151,248,60,28,4,250,
+21,248,74,247,92,10,252,128,251,73,39,247,73,253,144,201,29,6,14,151,247,
+74,250,173,21,168,247,80,5,159,143,151,156,158,27,248,72,252,169,251,205,
+6,120,123,162,153,137,31,120,247,36,5,37,252,97,241,6,158,247,35,5,153,141,
+157,162,156,27,247,205,252,136,6,119,125,116,110,137,30,251,29,131,5,51,248,
+174,247,201,29,247,17,147,5,227,254,120,251,217,7,14,124,203,29,14,173,250,
+205,250,181,21,98,247,244,5,254,127,108,6,247,19,221,96,251,8,31,254,169,
+7,47,251,11,88,49,30,108,248,252,170,7,49,251,11,190,231,31,250,191,7,207,
+180,169,191,30,247,150,6,247,60,186,251,17,251,49,182,31,14,251,51,249,133,
+250,9,21,248,194,29,247,7,247,156,253,250,59,6,247,54,10,249,117,248,55,29,
+14,124,203,29,50,249,192,33,29,251,7,250,60,28,4,246,21,248,13,32,7,105,251,
+132,5,121,137,112,124,123,27,253,75,51,6,247,166,29,254,220,247,204,10,248,
+159,227,7,251,1,147,5,110,143,125,162,155,26,250,255,7,14,124,247,54,29,215,
+7,247,117,247,9,248,170,10,244,248,144,6,247,142,10,14,124,250,160,250,121,
+21,248,13,254,105,51,7,247,80,10,248,159,227,247,63,10,14,124,248,214,251,
+121,21,247,209,247,63,10,245,248,13,254,105,51,6,247,80,10,248,55,210,29,
+252,25,249,62,28,5,14,21,199,251,72,7,153,104,82,162,75,27,251,52,33,59,251,
+21,40,215,72,227,120,31,92,96,118,98,109,26,110,145,137,147,112,30,43,125,
+94,76,69,26,39,231,79,247,50,247,87,247,43,239,247,9,247,40,251,140,153,251,
+4,149,30,143,128,184,162,172,30,247,39,129,247,32,215,247,21,26,188,122,170,
+121,169,30,49,37,21,55,94,71,59,55,96,207,221,233,190,194,215,219,184,68,
+63,30,212,252,126,21,80,78,71,251,19,251,13,86,207,198,180,164,187,214,165,
+30,213,125,247,80,139,38,26,14,118,35,10,129,28,6,10,33,29,118,35,10,168,
+28,4,241,51,10,118,35,10,138,28,6,33,66,10,118,35,10,168,28,6,76,54,29,118,
+35,10,176,28,5,57,83,29,118,35,10,251,83,28,5,170,43,10,118,35,10,252,71,
+28,5,151,247,32,10,118,250,201,251,105,21,242,72,7,140,149,140,148,148,26,
+247,132,10,218,114,195,109,188,30,247,96,239,251,168,6,247,150,10,251,58,
+247,10,251,3,247,28,108,31,248,106,29,251,11,117,71,70,117,50,8,51,36,221,
+6,251,40,158,247,29,251,0,247,119,27,247,121,247,84,247,7,247,33,215,31,251,
+148,250,15,247,95,29,251,178,253,3,21,247,7,116,247,147,139,167,251,34,8,
+252,188,6,148,200,180,205,243,177,8,247,4,252,66,21,251,32,57,219,221,108,
+31,248,161,6,57,105,49,59,251,40,27,14,118,135,248,250,21,158,36,247,18,163,
+182,45,227,76,236,117,25,208,10,152,7,247,62,172,118,243,251,62,106,129,163,
+127,161,127,160,25,247,96,239,251,168,6,247,150,10,130,139,130,140,130,31,
+249,75,253,154,247,94,29,252,136,249,193,21,247,50,219,233,247,7,239,202,
+58,40,159,30,252,14,66,5,247,87,251,141,21,45,79,199,224,113,31,248,4,209,
+5,251,14,128,74,46,251,4,27,14,176,250,97,143,114,29,251,252,249,17,249,167,
+21,248,241,99,7,57,91,5,166,104,87,160,97,27,251,118,251,2,251,52,251,59,
+251,30,217,251,49,247,71,217,206,176,182,200,31,76,7,251,27,57,52,54,109,
+101,144,151,124,30,95,242,5,139,123,145,122,99,107,106,103,48,233,112,247,
+37,247,96,219,247,79,235,30,251,16,247,2,21,119,105,88,117,86,27,251,14,68,
+236,247,26,247,41,220,237,248,204,10,248,12,28,5,172,247,22,10,252,115,247,
+15,114,29,176,250,97,250,224,21,247,17,172,192,198,170,30,247,78,251,27,5,
+152,143,218,161,223,26,205,80,196,251,9,251,115,251,52,251,44,251,215,30,
+194,76,69,164,247,96,10,251,4,251,38,251,78,94,100,158,159,116,30,72,247,
+64,5,139,104,149,113,53,104,84,78,251,15,247,37,55,247,114,248,19,234,248,
+196,29,105,86,61,106,57,27,251,80,251,1,247,52,247,115,247,140,247,15,247,
+53,247,95,198,223,96,96,180,31,14,118,169,251,200,21,39,247,168,7,114,192,
+227,102,236,27,247,137,247,58,247,25,247,107,247,58,251,10,247,3,251,28,170,
+31,211,212,170,205,192,26,184,133,145,124,182,30,247,40,166,208,241,247,11,
+26,247,58,251,33,247,17,251,136,251,189,251,127,251,85,251,86,251,136,248,
+7,115,247,76,120,30,141,133,153,61,106,86,8,251,121,155,251,105,251,15,251,
+109,26,60,164,83,169,90,30,247,32,247,64,21,247,31,206,247,5,247,15,247,21,
+205,251,5,251,29,251,50,59,45,251,7,251,15,72,247,13,247,21,30,251,7,249,
+195,21,238,233,247,31,247,87,247,76,223,251,31,40,72,102,57,251,11,96,30,
+251,14,163,251,171,137,247,62,26,14,251,1,247,10,249,220,21,248,136,6,251,
+95,69,38,251,18,251,51,248,134,10,251,48,34,251,110,26,251,86,247,38,251,
+46,247,149,247,133,247,93,247,95,247,111,30,247,239,252,97,178,247,106,26,
+247,1,215,230,247,160,226,30,180,247,39,253,101,6,247,240,253,159,21,247,
+22,34,247,54,91,251,71,26,251,35,50,65,251,38,251,64,45,247,9,247,28,247,
+78,247,9,211,231,177,30,14,53,249,242,251,191,21,252,126,6,247,95,209,240,
+247,18,247,51,248,134,29,247,58,244,247,110,26,247,86,251,38,247,46,251,149,
+251,133,251,93,251,95,251,111,30,251,239,248,87,100,251,106,26,251,1,43,48,
+251,160,52,30,98,251,39,249,111,6,251,230,249,159,21,251,22,244,251,44,187,
+247,71,26,247,35,228,213,247,38,247,64,233,251,9,251,28,251,78,251,19,67,
+47,101,30,14,194,249,16,250,35,21,166,225,133,123,167,31,251,60,248,132,29,
+247,65,251,82,171,251,61,251,233,251,123,251,95,251,203,251,165,247,95,251,
+142,247,218,247,194,228,247,47,247,1,153,31,159,247,48,151,145,213,150,8,
+219,252,78,59,7,247,39,133,165,93,133,40,8,251,10,132,89,74,251,38,27,251,
+103,251,37,247,47,247,165,247,156,247,65,247,33,247,79,31,14,251,64,250,21,
+250,254,21,192,251,239,86,7,228,133,5,158,138,148,127,126,26,251,137,7,132,
+87,120,81,27,251,100,251,26,247,27,247,128,247,121,247,26,247,18,247,83,202,
+190,117,129,164,31,151,135,151,128,142,125,160,251,2,24,219,247,90,6,159,
+58,59,161,39,27,251,191,251,75,251,64,251,150,251,119,247,60,251,99,247,189,
+247,35,247,28,188,139,31,247,176,7,152,148,151,158,140,30,14,204,250,244,
+248,48,21,247,214,29,127,94,96,131,90,27,251,140,251,50,247,47,247,165,247,
+156,247,50,247,33,247,124,214,199,119,127,169,31,152,134,151,127,141,125,
+166,251,27,24,247,11,247,144,6,163,251,1,41,162,251,17,27,252,9,251,121,251,
+95,251,203,251,165,247,96,29,14,247,219,44,29,251,98,28,4,220,33,29,247,219,
+44,29,251,59,250,87,51,10,247,219,44,29,251,89,28,4,243,66,10,247,219,44,
+29,251,59,28,5,30,54,29,247,219,44,29,251,51,250,159,83,29,247,219,44,29,
+252,23,28,4,124,43,10,247,219,44,29,252,9,253,236,57,29,247,219,28,5,107,
+247,187,21,237,251,54,247,21,248,54,29,243,149,5,247,33,10,251,21,251,172,
+41,247,172,251,74,173,10,247,138,7,14,248,3,104,249,39,21,158,251,0,247,23,
+164,5,251,224,186,247,142,251,169,248,47,27,248,165,10,248,109,248,54,29,
+243,149,5,247,33,10,252,45,7,129,59,108,49,27,251,190,251,90,247,86,247,236,
+113,31,28,4,115,247,110,118,247,1,254,245,251,108,5,247,253,150,247,94,247,
+92,247,179,27,247,39,10,31,135,7,14,247,219,28,6,51,28,6,66,21,208,72,197,
+251,19,251,114,41,251,38,251,97,123,30,160,55,65,147,55,27,252,84,251,179,
+251,179,252,66,252,15,247,150,251,236,248,93,248,165,10,248,109,248,54,29,
+243,149,5,247,33,10,252,45,7,129,59,108,49,27,251,212,251,97,247,117,248,
+29,248,17,247,91,247,103,247,201,225,233,98,125,170,31,151,133,158,116,143,
+121,172,251,76,24,247,15,247,213,6,247,99,137,198,231,174,30,247,78,251,33,
+5,139,227,163,230,26,14,204,28,5,76,28,4,213,21,209,73,200,251,13,251,100,
+251,3,251,52,251,113,137,30,149,79,80,154,82,27,252,9,251,121,251,93,251,
+203,251,167,247,96,29,247,214,29,131,94,94,127,92,27,251,140,251,50,247,47,
+247,167,247,158,247,50,247,29,247,124,214,199,119,127,169,31,152,132,151,
+127,141,127,166,251,29,24,247,11,247,139,6,247,79,149,217,188,167,30,247,
+80,251,25,5,197,158,186,169,209,26,14,247,186,28,4,186,28,5,127,21,69,6,247,
+38,29,67,7,251,160,251,52,251,82,251,106,251,26,42,176,182,89,30,247,97,7,
+171,116,101,167,89,27,68,84,84,57,251,49,247,100,251,62,247,202,247,210,247,
+154,247,119,247,190,31,251,98,247,120,21,247,74,10,196,250,218,248,185,21,
+223,252,4,55,7,189,131,5,162,135,150,120,119,26,252,26,7,131,75,109,67,27,
+120,28,4,131,6,215,138,202,104,170,124,153,131,154,123,143,116,165,251,67,
+24,237,247,207,6,173,39,41,172,251,15,27,133,247,72,42,251,80,6,251,198,92,
+251,76,251,151,252,6,26,251,225,247,67,251,197,247,207,94,30,251,78,236,247,
+72,7,247,63,143,247,50,213,139,26,248,87,7,159,150,158,162,141,30,253,144,
+247,21,21,247,203,247,12,247,85,247,76,187,30,254,250,7,251,81,196,251,7,
+247,94,247,207,26,14,68,247,10,28,4,204,21,248,146,6,251,70,81,251,8,251,
+14,251,19,248,134,10,251,68,34,251,110,26,251,86,247,58,251,46,247,149,247,
+125,247,141,247,95,247,111,30,247,239,252,127,171,247,93,26,247,1,247,56,
+245,247,92,183,30,180,247,39,253,151,6,248,4,253,111,21,247,22,34,247,94,
+82,251,62,26,251,35,251,52,65,251,7,251,64,251,6,247,9,247,28,247,78,247,
+29,211,231,177,30,14,73,250,31,247,39,21,252,136,6,247,70,197,247,8,247,14,
+247,19,248,134,29,247,78,244,247,110,26,247,86,251,68,247,45,251,149,251,
+125,251,131,251,94,251,111,30,251,239,248,117,107,251,93,26,251,1,251,76,
+33,251,92,95,30,98,251,39,249,161,6,251,250,249,111,21,251,22,244,251,84,
+196,247,62,26,247,35,247,42,213,247,7,247,64,247,16,251,9,251,28,251,78,251,
+39,67,47,101,30,14,247,219,28,5,122,249,44,21,252,190,50,6,247,78,126,193,
+63,251,56,26,251,34,135,32,41,251,61,27,251,172,251,107,247,96,248,50,245,
+29,252,92,247,180,251,159,248,53,247,240,237,247,79,247,72,154,31,155,247,
+89,145,173,247,26,149,8,14,251,196,249,124,248,172,10,79,143,5,124,140,125,
+150,154,26,247,234,7,247,19,60,198,37,70,37,90,112,91,30,248,10,85,7,251,
+62,92,5,98,239,253,118,248,162,29,75,135,5,91,247,192,187,7,81,143,5,123,
+140,129,150,154,26,248,39,7,159,177,199,154,186,27,241,169,88,68,31,251,208,
+7,124,125,128,123,138,30,85,135,5,91,7,14,251,214,249,123,249,164,143,29,
+251,93,28,4,135,143,29,219,42,29,71,28,6,32,51,10,219,42,29,247,134,28,7,
+123,54,29,219,42,29,247,123,28,6,217,39,10,219,42,29,161,28,6,217,43,10,219,
+42,29,247,104,183,29,219,42,29,247,142,251,197,83,29,219,42,29,161,70,10,
+219,42,29,251,48,92,29,219,250,252,251,121,21,247,201,80,10,247,244,210,29,
+219,116,10,219,116,10,219,250,230,248,109,21,247,248,251,68,247,75,251,113,
+44,251,31,73,80,41,30,247,123,248,19,240,252,19,247,182,41,7,251,142,66,5,
+75,247,49,251,45,251,49,38,247,49,254,111,7,117,121,122,114,135,30,37,131,
+5,59,248,105,219,7,49,147,5,114,143,121,156,161,26,249,46,7,182,219,219,173,
+208,27,247,52,247,41,49,251,203,252,27,251,90,251,214,251,177,111,31,59,7,
+247,165,248,37,247,115,248,234,31,14,219,247,78,29,247,66,7,247,117,247,11,
+247,13,247,21,184,188,120,119,161,30,209,251,64,5,139,159,129,168,201,190,
+194,200,247,44,251,29,196,251,114,251,244,63,251,238,35,30,254,52,115,10,
+252,164,7,114,118,121,115,137,30,55,133,5,59,7,14,251,214,249,119,248,96,
+10,78,144,5,123,141,126,248,112,10,39,89,113,90,30,247,11,7,247,27,215,204,
+225,167,170,135,129,155,30,184,35,5,139,154,132,155,180,172,172,176,229,49,
+168,251,36,251,119,90,251,93,76,30,252,208,247,152,29,248,40,7,159,176,198,
+156,186,27,242,167,85,70,31,251,210,7,125,127,129,123,137,30,83,134,5,92,
+7,14,179,248,9,28,5,229,21,59,6,251,154,60,5,71,247,45,28,251,49,115,10,253,
+152,7,251,31,98,251,7,251,21,30,251,50,247,71,5,123,137,55,102,49,26,67,196,
+59,247,35,247,142,247,60,248,169,29,247,244,10,14,179,250,115,96,21,247,244,
+10,247,66,7,247,117,247,13,247,13,247,21,184,188,120,119,161,30,209,251,64,
+5,139,159,129,168,201,190,194,200,247,44,251,29,196,251,114,251,244,63,251,
+238,35,30,254,52,115,10,253,152,7,251,31,98,251,7,251,21,30,251,50,247,71,
+5,123,137,55,102,49,26,67,196,59,247,35,247,142,247,60,248,169,29,14,219,
+250,252,251,211,21,248,35,80,10,247,56,248,156,10,249,64,28,6,66,248,115,
+29,252,162,7,251,61,62,77,251,16,251,37,64,208,247,64,30,247,248,7,247,103,
+138,251,12,238,251,49,27,32,251,49,57,94,65,31,249,4,57,7,251,154,60,5,71,
+247,45,28,251,49,115,10,251,214,7,251,81,243,251,65,247,178,247,168,247,27,
+247,65,247,95,30,14,251,181,247,250,248,99,21,247,167,6,247,134,29,251,167,
+247,207,6,234,29,14,219,28,4,121,252,27,21,206,251,46,28,4,156,248,54,10,
+238,145,5,219,252,97,59,7,227,133,5,163,137,156,121,114,26,253,52,7,107,79,
+47,112,68,27,251,50,94,225,247,9,31,248,164,7,164,159,157,164,141,30,223,
+145,5,219,252,93,59,7,231,133,5,164,137,159,121,114,26,252,207,7,251,103,
+247,13,40,247,50,245,247,50,221,184,213,30,252,207,221,7,14,251,224,249,129,
+248,186,21,180,39,249,88,248,55,10,203,142,5,187,251,191,91,7,196,136,5,155,
+137,150,129,124,26,252,40,7,120,100,79,123,93,27,36,110,191,209,31,247,209,
+7,154,152,149,155,141,30,194,142,5,187,251,189,91,7,198,136,5,156,137,152,
+129,124,26,251,235,7,251,19,217,80,242,208,242,188,166,187,30,251,234,192,
+7,14,247,117,28,5,10,252,25,21,206,251,47,28,4,154,148,10,252,205,221,7,14,
+247,119,28,5,207,251,234,21,227,51,164,139,30,251,77,251,34,5,78,164,121,
+180,247,68,26,250,109,148,10,251,72,7,251,123,244,251,50,247,137,247,19,205,
+196,209,30,14,219,42,29,14,109,250,26,249,106,21,247,151,253,177,247,48,10,
+248,37,7,142,162,180,144,169,96,10,98,92,134,136,115,31,247,170,247,220,248,
+87,29,251,28,5,14,219,250,252,251,211,21,248,35,80,10,247,56,248,156,10,247,
+17,28,4,143,22,219,248,14,29,249,133,247,229,29,252,88,248,211,29,252,107,
+247,201,134,29,247,248,248,107,247,69,29,7,14,247,201,247,116,10,249,152,
+247,56,247,149,29,253,10,59,6,248,156,29,252,107,247,201,134,29,247,248,248,
+107,247,69,29,7,14,247,17,28,4,141,251,211,21,248,35,248,14,29,249,133,247,
+154,29,251,211,252,107,247,211,134,29,248,2,248,107,252,2,248,130,29,196,
+7,247,117,203,248,205,10,247,17,247,116,10,249,133,247,154,29,251,201,252,
+107,247,201,134,29,247,248,248,107,247,69,29,247,220,247,203,10,248,131,28,
+5,242,247,189,21,247,101,251,66,239,251,136,92,67,131,139,30,247,164,7,152,
+151,155,162,141,30,247,2,145,5,219,252,100,59,7,233,133,5,161,137,152,123,
+126,26,251,180,252,56,247,180,134,29,248,13,248,56,252,13,7,126,126,123,117,
+137,30,45,133,5,59,248,47,7,247,224,247,5,229,247,99,31,251,93,22,251,1,116,
+37,251,123,100,96,143,139,30,248,54,7,139,209,147,174,247,70,192,55,251,27,
+30,14,247,17,28,4,143,248,206,29,252,88,248,211,29,252,107,247,201,134,29,
+247,248,248,107,252,21,247,76,29,247,82,247,56,248,0,26,249,128,7,152,152,
+155,161,141,30,14,247,17,247,116,10,249,133,247,154,29,251,201,252,107,247,
+201,7,152,149,155,164,141,30,235,145,5,219,252,87,247,118,10,253,162,247,
+76,29,247,83,247,56,248,0,26,247,243,248,107,247,69,29,7,14,248,246,28,5,
+245,248,80,21,247,73,29,88,215,247,23,30,248,219,247,154,29,251,201,252,107,
+247,201,134,29,247,248,248,107,251,61,7,248,42,10,14,248,180,250,249,22,219,
+248,14,29,248,36,7,142,159,187,145,172,96,10,94,86,133,136,118,31,247,154,
+247,154,29,251,201,252,67,247,201,134,29,247,248,248,67,247,69,29,7,14,200,
+250,218,22,219,7,146,29,7,14,200,250,218,219,21,146,29,189,7,247,117,203,
+55,251,127,31,243,6,14,248,110,250,178,22,219,7,51,247,255,29,248,37,7,142,
+162,179,144,168,96,10,99,94,135,136,114,31,247,152,7,152,149,155,162,141,
+30,227,145,5,219,254,115,247,4,29,248,67,219,7,53,247,255,29,249,119,7,151,
+149,158,162,30,247,192,248,30,29,62,133,5,59,7,14,200,250,218,22,219,144,
+10,247,124,7,247,86,166,55,251,127,31,247,17,6,247,127,168,223,247,86,30,
+14,200,250,218,251,211,21,248,35,144,10,249,13,7,247,118,206,248,205,10,248,
+185,96,29,248,185,28,6,49,251,211,21,248,35,102,10,28,4,115,7,247,117,197,
+248,205,10,237,28,4,125,247,163,10,254,220,59,7,247,54,10,249,121,248,55,
+29,248,11,6,161,137,153,125,124,26,253,121,7,248,46,29,248,62,46,10,14,32,
+110,10,32,110,10,247,33,28,4,174,22,219,7,41,247,254,10,249,133,248,55,29,
+237,145,5,219,252,86,59,7,239,133,5,161,137,150,125,124,26,251,199,252,159,
+247,199,7,234,29,247,248,248,159,251,248,7,124,128,125,117,137,30,39,133,
+5,59,7,14,248,62,46,10,247,50,28,5,248,51,10,248,62,46,10,247,50,28,7,83,
+54,29,248,62,46,10,247,39,65,29,248,62,46,10,77,28,6,177,43,10,248,62,46,
+10,247,20,183,29,248,62,46,10,77,70,10,248,62,46,10,252,18,92,29,248,62,28,
+5,176,250,101,21,242,251,43,247,45,242,10,251,45,253,54,247,45,247,138,10,
+251,45,251,43,36,247,43,253,216,248,234,10,248,154,227,7,247,207,10,249,216,
+7,254,5,251,97,21,247,97,249,54,251,97,7,14,32,250,75,28,5,91,21,201,41,231,
+247,153,10,47,252,74,231,247,153,29,47,41,77,237,252,137,247,20,10,247,228,
+248,151,29,248,137,7,252,208,251,15,21,247,15,248,74,251,15,7,14,248,212,
+248,3,247,33,21,162,10,248,154,227,7,247,207,10,250,216,248,160,10,245,147,
+5,248,230,29,252,69,7,247,79,29,121,112,31,14,248,62,28,5,176,28,5,4,21,248,
+173,29,247,205,10,253,54,120,10,249,54,253,173,247,63,29,28,4,252,248,160,
+10,14,248,62,98,10,250,100,28,7,122,248,115,29,252,138,7,251,96,48,68,251,
+2,251,17,46,133,10,247,28,251,9,247,142,247,180,247,34,247,22,247,146,30,
+14,251,3,248,60,249,40,21,247,255,6,247,145,29,251,255,248,109,6,230,10,14,
+247,248,248,151,250,166,21,169,141,155,159,163,30,225,102,170,95,247,31,127,
+179,136,247,28,247,43,210,236,79,168,24,123,122,118,121,100,27,251,103,205,
+5,83,126,252,35,251,186,43,26,76,247,166,251,228,155,117,30,153,120,117,117,
+131,131,8,124,39,232,141,251,3,31,121,121,136,131,125,31,251,47,251,173,202,
+112,5,156,153,152,147,157,27,176,159,136,71,247,42,31,248,53,248,94,36,247,
+31,247,10,207,247,74,115,221,251,23,138,251,58,25,38,112,251,8,82,57,30,84,
+251,72,175,251,8,27,251,78,251,157,209,114,5,160,156,150,147,165,27,247,203,
+109,5,247,90,247,70,247,162,247,169,247,107,26,247,65,76,247,126,251,232,
+30,97,113,251,34,44,251,23,64,8,14,248,62,28,5,176,22,227,7,247,207,10,250,
+216,218,29,28,251,135,247,36,29,248,184,249,54,216,29,7,14,247,142,109,29,
+247,103,28,4,217,22,227,7,119,10,7,14,247,38,248,60,249,130,21,139,247,0,
+149,182,247,115,247,35,251,48,252,41,251,248,251,98,251,60,251,191,94,72,
+142,144,90,30,158,66,5,126,214,232,132,208,27,247,253,247,162,247,118,248,
+79,248,66,251,157,247,61,251,196,82,251,4,129,139,31,248,23,244,10,251,13,
+131,5,51,248,149,227,7,40,248,93,29,14,247,103,28,4,217,227,21,119,10,174,
+7,247,117,247,30,248,170,10,243,6,14,249,11,28,5,176,22,227,7,247,207,10,
+28,4,109,247,97,7,247,150,29,253,136,49,6,247,205,10,253,54,120,10,249,54,
+216,29,7,14,248,62,98,10,248,62,28,5,176,227,21,117,10,248,24,247,40,10,249,
+185,28,7,29,248,95,10,251,103,247,25,251,195,79,49,128,139,30,248,42,247,
+234,10,247,29,147,5,229,252,182,49,7,247,8,131,248,159,10,252,76,252,162,
+248,76,228,29,248,185,248,162,252,185,247,235,10,251,8,131,5,51,248,117,7,
+248,0,247,77,247,236,29,251,122,22,251,93,47,251,7,251,129,87,86,143,139,
+30,249,7,247,235,29,219,53,251,131,30,14,248,62,28,5,176,28,5,4,21,248,173,
+29,247,205,10,253,54,120,10,249,54,252,218,247,36,29,250,235,248,160,10,14,
+250,138,28,7,116,249,11,21,247,64,29,251,17,56,133,10,247,18,251,9,247,142,
+247,180,247,38,247,21,247,146,30,14,250,28,28,5,96,22,227,7,247,207,10,248,
+249,7,142,174,187,142,164,237,29,104,86,135,136,101,31,248,18,242,10,252,
+97,252,230,120,10,248,230,216,29,7,14,248,27,28,5,141,22,227,7,139,29,51,
+7,14,248,27,250,23,22,194,6,247,117,247,30,248,170,10,243,248,144,6,139,29,
+14,250,28,28,4,156,249,130,21,139,247,2,149,182,247,199,10,30,247,146,29,
+82,251,6,129,139,31,248,23,247,92,29,28,251,15,245,10,248,99,247,219,29,51,
+248,158,227,7,251,0,248,93,29,14,248,27,28,5,141,22,227,137,10,247,234,7,
+247,117,168,248,170,10,247,55,6,247,183,168,247,21,247,115,30,14,248,27,28,
+5,141,247,209,29,137,10,7,249,164,251,56,248,40,29,14,250,13,28,7,127,22,
+225,248,131,10,250,222,114,10,248,124,29,33,131,5,51,7,14,250,10,28,7,127,
+247,209,29,248,131,10,250,220,114,10,121,127,116,108,137,30,33,129,5,53,28,
+5,86,7,247,117,247,50,248,170,10,14,248,66,151,29,252,111,55,10,14,252,111,
+55,10,14,253,73,247,187,247,227,21,181,103,172,94,94,102,106,97,97,176,105,
+184,184,175,173,181,30,207,253,175,21,187,7,71,247,252,29,248,164,86,7,251,
+54,92,5,96,230,252,74,7,124,128,128,122,138,30,74,135,5,91,7,14,253,62,247,
+187,28,6,43,214,29,252,103,28,7,162,214,29,252,111,56,29,248,233,250,252,
+48,10,252,111,56,29,248,181,250,252,65,10,252,111,56,29,248,181,28,5,152,
+66,10,252,111,56,29,248,211,28,5,195,54,29,252,111,56,29,248,232,28,5,143,
+36,29,252,111,56,29,248,119,28,4,176,247,110,29,252,111,56,29,248,200,77,
+10,252,111,56,29,248,200,28,5,33,60,29,248,32,248,132,33,29,252,111,56,29,
+248,32,28,5,121,45,29,252,111,55,10,248,238,80,29,252,111,55,10,247,253,70,
+10,252,111,55,10,248,76,251,226,72,10,252,111,250,46,247,42,29,252,112,28,
+6,127,71,29,14,252,111,248,82,28,5,45,247,239,10,247,11,253,252,21,241,251,
+54,248,93,58,7,251,142,61,5,67,247,33,251,199,251,50,37,247,50,251,214,7,
+247,173,29,247,214,7,14,253,73,247,183,28,6,43,21,180,102,248,149,29,176,
+174,180,30,215,252,158,21,198,34,247,167,86,7,251,54,91,5,99,229,251,79,39,
+80,239,251,87,7,125,129,129,123,137,30,73,134,5,92,247,205,186,7,72,247,253,
+29,247,87,7,14,252,111,247,102,251,230,21,69,194,84,208,209,196,194,209,209,
+82,196,69,70,84,82,69,30,251,47,28,5,45,21,59,7,244,248,90,10,254,5,220,7,
+247,142,217,5,211,251,33,249,111,7,164,157,157,164,141,30,239,145,5,219,7,
+14,253,73,247,33,248,218,21,97,175,106,184,185,176,172,181,181,102,173,93,
+94,103,105,97,30,39,249,175,21,91,7,207,247,251,10,252,165,192,7,247,54,186,
+5,182,47,248,75,248,55,10,204,142,5,187,7,14,247,15,55,10,250,111,61,10,247,
+38,55,10,250,121,68,10,14,249,147,248,82,28,5,45,248,248,10,248,244,55,10,
+28,6,78,219,29,14,248,205,55,10,28,6,39,22,219,78,29,7,14,252,58,249,64,247,
+95,21,248,22,29,249,128,55,7,251,141,61,5,71,247,35,253,6,248,59,29,14,253,
+38,248,86,250,31,21,81,6,122,103,119,120,111,140,8,110,140,108,157,210,26,
+248,85,84,7,251,54,92,5,99,232,252,12,7,251,21,207,109,202,196,224,182,233,
+173,30,14,252,58,248,208,248,91,21,242,251,61,248,90,55,7,251,141,61,5,71,
+247,35,251,200,251,35,36,247,35,251,107,248,59,29,248,22,29,247,83,7,14,248,
+56,28,5,166,248,130,21,247,174,251,31,247,128,251,189,251,181,251,25,251,
+113,251,144,126,30,251,96,247,219,6,154,149,155,161,30,240,147,5,219,252,
+93,59,7,237,131,5,162,151,123,124,31,253,129,7,126,127,123,116,137,30,41,
+133,5,59,248,93,219,7,38,145,5,117,248,171,29,247,228,247,94,7,251,150,152,
+247,29,251,112,247,179,27,247,178,247,42,247,122,247,181,31,251,95,22,251,
+128,96,251,87,251,82,251,75,88,247,87,247,128,247,125,182,247,89,247,83,247,
+76,188,251,89,251,125,30,14,252,56,40,29,14,252,56,40,29,14,252,124,248,35,
+28,5,51,21,156,145,160,165,157,27,247,1,145,5,219,252,134,59,7,247,3,133,
+5,157,170,113,122,133,31,28,251,78,247,229,10,248,134,247,120,10,14,252,56,
+40,29,14,253,37,248,36,249,165,21,192,7,58,144,5,121,248,193,10,151,157,141,
+30,220,143,5,193,251,243,85,7,218,135,5,158,137,148,127,248,124,10,130,125,
+120,138,30,60,134,5,86,7,14,252,163,248,150,22,219,7,41,247,254,10,249,131,
+247,155,10,253,131,7,124,125,125,117,137,30,40,133,5,59,7,14,253,109,247,
+222,248,96,10,73,144,5,125,141,131,147,147,26,248,89,7,147,147,149,153,30,
+205,141,5,188,251,185,90,7,202,137,5,154,147,129,131,31,252,89,7,131,131,
+131,124,137,30,76,134,5,92,7,14,252,56,40,29,249,7,28,5,248,48,10,252,56,
+40,29,248,211,28,5,248,65,10,252,56,40,29,248,211,28,7,40,66,10,252,56,40,
+29,248,241,28,7,83,54,29,252,56,40,29,249,6,28,7,31,36,29,252,56,40,29,248,
+149,28,6,64,247,110,29,252,56,40,29,248,230,65,29,252,56,40,29,248,230,28,
+6,177,60,29,248,32,248,132,33,29,252,56,40,29,248,21,28,6,177,43,10,252,56,
+40,29,248,62,28,7,9,45,29,252,56,40,29,249,6,80,29,252,56,40,29,248,21,70,
+10,252,56,40,29,248,106,251,226,72,10,252,56,249,44,249,48,21,243,251,116,
+248,97,247,125,10,252,97,251,113,35,247,113,252,163,247,235,10,251,14,131,
+5,51,248,176,247,206,29,248,163,7,14,252,163,248,179,248,94,21,233,251,54,
+247,208,247,155,10,251,208,251,56,45,247,56,251,233,247,156,29,247,233,7,
+14,253,125,247,242,250,196,21,184,251,8,247,90,7,148,147,148,153,140,30,204,
+142,5,178,251,173,100,7,203,136,5,154,138,146,130,130,26,251,90,251,7,94,
+247,7,251,118,7,130,132,129,124,138,30,75,136,5,101,247,173,177,7,74,142,
+5,125,140,131,149,148,26,247,118,7,14,252,56,248,244,22,247,206,29,28,5,112,
+247,125,10,28,250,144,247,235,10,251,14,131,5,51,7,14,248,209,40,29,28,6,
+12,185,29,247,148,248,244,22,248,247,10,250,56,40,29,28,4,192,22,248,247,
+10,250,68,40,29,28,7,159,210,10,14,250,2,40,29,28,7,94,124,10,14,251,148,
+249,220,247,162,21,251,3,6,106,55,92,82,86,141,8,73,141,55,135,247,42,26,
+250,219,252,25,51,7,247,21,248,89,29,254,74,7,251,177,247,34,108,247,17,245,
+247,70,231,247,103,199,30,14,250,29,28,7,129,249,66,21,248,35,251,105,247,
+214,252,35,252,17,251,97,251,183,251,254,114,30,251,166,248,117,6,247,144,
+10,254,220,247,128,10,248,138,247,166,7,252,5,154,247,99,251,197,248,25,27,
+248,35,247,105,247,214,248,33,31,251,127,22,251,228,61,251,166,251,191,251,
+193,61,247,166,247,228,247,230,217,247,164,247,193,247,191,217,251,164,251,
+230,30,14,248,14,28,5,144,250,81,21,51,6,131,251,17,5,111,137,116,124,119,
+27,254,216,6,119,118,154,167,137,31,131,247,17,5,49,252,176,229,6,147,247,
+14,5,168,141,160,153,159,27,250,216,6,159,162,125,110,141,31,147,251,14,5,
+227,6,14,252,134,248,72,61,10,253,66,247,175,247,226,192,29,253,66,247,175,
+28,6,43,192,29,252,134,208,29,250,121,51,10,252,134,208,29,28,5,64,54,29,
+252,134,248,72,28,5,45,247,239,29,247,29,253,248,187,10,252,91,248,87,28,
+5,45,21,209,83,248,152,29,195,196,209,30,247,66,28,249,88,21,248,64,10,249,
+202,55,7,251,144,61,5,71,247,38,253,230,7,131,247,224,10,209,251,9,237,247,
+76,247,1,248,97,29,8,251,220,247,222,21,251,3,117,81,251,62,247,228,29,253,
+60,247,190,28,6,44,21,181,103,172,94,93,102,106,97,97,176,105,185,184,175,
+173,181,30,247,5,254,146,21,100,199,87,210,81,181,8,155,193,144,198,194,26,
+248,129,85,7,251,56,92,5,99,234,252,146,7,134,139,134,137,133,30,144,119,
+118,140,116,27,45,39,83,40,83,184,69,203,247,11,210,229,216,179,31,188,101,
+186,76,167,94,8,251,105,247,90,21,72,125,101,37,66,27,103,118,182,173,191,
+195,186,189,166,164,140,131,163,31,14,252,134,212,10,14,252,134,248,209,248,
+93,187,10,253,88,248,13,250,183,21,200,36,247,164,84,7,251,55,92,5,99,233,
+251,77,251,21,78,247,21,251,192,7,44,125,61,89,113,30,251,21,221,5,112,131,
+109,118,97,26,93,186,118,193,223,221,175,217,194,30,184,204,146,246,213,26,
+247,87,7,14,252,64,249,193,28,5,106,21,203,82,198,251,9,251,187,251,17,251,
+127,251,142,30,251,246,251,56,36,247,56,253,10,7,251,85,80,55,79,106,30,251,
+80,247,27,5,139,45,115,55,26,73,198,82,247,9,247,131,247,65,247,105,247,101,
+30,248,250,247,59,242,251,55,248,68,7,247,72,200,235,198,170,30,247,81,251,
+25,5,153,248,171,10,14,252,64,247,16,43,21,251,68,53,247,129,10,250,41,247,
+249,29,251,17,248,116,29,247,83,247,164,10,247,0,28,4,129,22,219,7,39,247,
+255,29,249,133,7,152,149,155,162,141,30,239,145,5,219,254,9,89,10,247,215,
+248,77,29,7,14,247,12,249,209,247,9,21,126,127,123,117,137,30,42,133,5,59,
+201,7,247,117,203,55,251,127,31,243,248,35,6,39,247,255,29,249,133,7,152,
+149,155,162,141,30,239,145,5,219,254,9,89,10,247,215,6,14,247,0,28,4,129,
+22,219,7,39,247,255,29,249,133,7,152,149,155,162,141,30,239,145,5,219,254,
+9,89,10,247,215,248,77,29,247,229,247,203,10,248,103,28,5,213,247,189,21,
+247,101,251,68,247,2,251,136,94,65,131,139,30,247,154,7,152,152,155,161,141,
+30,247,3,145,5,219,253,212,89,10,247,152,253,150,6,126,127,123,116,137,30,
+39,133,5,59,248,52,7,247,223,247,7,229,247,99,31,251,95,22,251,1,119,37,251,
+124,98,96,143,139,30,248,64,7,139,211,147,174,247,70,190,248,205,29,247,5,
+250,144,249,250,21,152,149,155,162,141,30,239,145,5,219,254,9,89,10,247,215,
+253,189,6,251,168,251,17,251,21,247,161,10,247,83,247,56,247,246,26,14,248,
+229,249,209,247,196,21,221,10,248,219,7,152,149,155,162,141,30,239,145,5,
+219,254,9,89,10,247,215,6,14,248,170,250,237,22,219,7,39,247,255,29,248,36,
+7,141,156,192,146,174,96,10,91,82,132,137,121,31,247,154,7,152,149,155,162,
+141,30,239,145,5,219,253,225,89,10,247,175,248,77,29,7,14,217,250,244,250,
+50,21,200,254,11,247,22,29,247,232,247,12,29,249,208,7,151,149,158,164,30,
+251,117,253,200,21,252,126,248,31,29,247,215,6,14,250,98,28,4,237,247,9,21,
+126,126,123,117,137,30,63,133,5,59,248,58,247,135,10,247,191,219,181,10,252,
+58,59,7,215,248,192,29,251,184,247,255,7,151,149,158,164,30,225,145,5,200,
+253,237,247,22,29,247,212,247,12,29,248,13,247,184,7,252,118,251,230,21,252,
+106,248,31,29,247,195,6,14,248,144,28,6,48,22,219,7,251,3,155,251,195,248,
+79,247,167,247,242,247,43,10,253,153,89,10,247,99,6,247,169,252,46,251,185,
+252,17,247,42,10,7,14,36,179,29,252,87,248,252,248,169,10,251,244,87,7,223,
+248,91,29,252,74,7,251,64,93,52,251,14,113,110,146,164,133,30,110,247,42,
+5,59,251,102,6,136,147,225,107,225,27,247,107,217,247,19,247,96,31,248,65,
+7,151,148,153,158,140,30,14,251,161,249,152,248,206,29,252,86,59,7,190,135,
+225,145,109,26,252,148,7,251,93,79,39,251,31,110,107,147,163,133,30,102,247,
+77,5,251,7,251,155,6,133,155,246,100,245,27,247,165,239,247,50,247,136,31,
+248,138,7,147,147,149,158,141,30,14,36,183,10,247,81,247,142,51,10,36,250,
+117,249,48,21,243,251,107,248,97,247,125,29,252,97,251,189,35,247,189,251,
+56,247,26,29,247,42,7,14,251,133,249,20,249,6,21,248,243,247,125,29,253,160,
+7,130,247,224,10,196,251,9,247,20,247,87,237,248,97,29,213,194,24,248,64,
+10,251,114,251,186,21,251,63,119,79,251,2,247,228,29,251,51,247,182,251,15,
+21,248,39,29,102,49,26,67,195,59,247,37,247,140,247,70,248,169,29,250,51,
+247,249,29,251,37,248,116,29,247,103,247,164,10,248,19,28,5,133,22,227,7,
+251,15,147,5,111,141,124,164,155,26,250,220,7,248,147,29,254,205,84,10,248,
+43,248,68,29,7,14,247,6,28,4,147,247,163,10,254,19,59,7,228,131,5,161,137,
+153,125,124,26,251,156,115,251,195,94,43,30,106,124,109,102,118,27,251,55,
+199,5,87,98,79,93,73,205,91,210,201,247,22,157,247,28,218,31,201,246,176,
+247,154,248,25,26,247,222,253,150,6,248,46,29,248,19,250,164,247,31,21,248,
+190,10,51,209,7,247,117,247,30,248,170,10,243,248,144,6,251,15,248,93,29,
+250,220,7,248,147,29,254,205,84,10,248,43,6,14,248,19,28,5,133,227,21,251,
+15,147,5,111,141,124,164,155,26,250,220,7,248,147,29,254,205,84,10,248,43,
+248,68,29,248,45,247,40,10,249,219,28,7,63,248,95,10,251,105,247,45,251,195,
+82,57,248,8,10,254,174,84,10,247,252,254,255,6,247,119,29,248,118,7,248,0,
+247,76,247,236,29,251,123,22,251,93,51,251,7,251,134,88,96,143,139,30,249,
+28,7,139,219,149,182,247,66,247,19,32,251,131,30,14,248,19,28,4,223,28,4,
+211,21,248,147,29,254,205,84,10,248,43,28,251,98,6,247,41,29,14,250,80,28,
+4,223,28,4,211,21,248,147,29,254,205,84,10,248,43,254,44,206,29,250,38,28,
+5,103,22,227,7,251,15,147,5,111,141,124,164,155,26,248,249,7,142,174,200,
+144,169,237,29,98,72,134,136,103,31,248,21,7,248,147,29,254,175,84,10,248,
+13,248,68,29,7,14,250,56,28,7,216,22,227,232,10,254,83,84,10,247,166,6,248,
+14,252,228,247,9,10,7,14,247,248,28,5,119,28,5,10,21,223,254,201,247,16,10,
+248,203,247,35,10,253,58,248,18,10,248,41,6,14,28,5,251,28,6,75,247,33,21,
+247,27,10,247,240,227,134,10,252,153,252,60,248,157,247,234,10,247,11,149,
+5,223,254,151,247,16,10,248,153,247,185,10,248,167,248,60,7,253,13,252,145,
+21,253,8,248,18,10,247,247,6,14,252,4,249,87,248,172,10,69,146,251,121,247,
+199,247,68,247,66,224,147,5,187,251,151,91,7,194,134,151,138,145,127,132,
+131,25,251,88,251,96,5,113,248,227,84,6,251,62,92,5,98,240,253,118,248,162,
+29,74,135,5,91,247,194,187,7,82,143,5,122,140,128,150,154,26,247,92,213,7,
+247,58,251,123,5,91,7,14,252,9,249,89,248,96,10,69,148,251,121,247,199,247,
+68,247,66,223,147,5,186,251,150,92,7,194,135,5,151,143,125,133,133,31,251,
+88,251,99,5,114,248,228,84,6,251,62,91,5,99,239,253,120,247,152,29,247,93,
+213,7,247,64,251,128,5,96,7,14,137,53,10,241,28,7,57,33,29,137,53,10,247,
+33,28,7,123,54,29,137,53,10,247,41,251,197,83,29,137,53,10,60,70,10,137,53,
+10,74,251,183,57,29,137,250,197,108,21,247,3,156,10,247,116,108,7,251,117,
+104,57,57,108,30,251,78,247,46,5,139,53,112,49,26,72,204,69,247,19,247,140,
+192,247,89,247,133,30,14,137,249,40,250,199,21,242,251,177,247,223,55,7,251,
+154,60,5,71,247,47,248,168,10,254,68,161,10,247,148,252,21,248,47,10,251,
+245,248,148,248,228,10,6,14,137,250,114,248,187,21,75,211,251,95,251,73,251,
+3,247,54,248,228,10,247,177,242,251,177,247,223,55,6,251,154,60,5,71,247,
+47,248,168,10,254,68,161,10,235,251,38,251,29,251,14,197,66,247,24,247,8,
+246,251,52,248,47,10,251,80,247,164,5,14,137,250,114,248,187,21,75,211,251,
+95,251,73,251,3,247,54,248,242,10,235,251,38,251,29,251,14,201,70,247,20,
+247,5,246,251,53,248,47,10,251,80,247,164,5,14,142,119,248,82,21,158,36,247,
+82,175,5,251,140,247,57,10,248,101,219,7,51,247,110,10,247,177,7,247,22,164,
+247,132,251,253,248,47,10,251,158,248,22,248,31,215,118,243,252,76,54,118,
+170,247,190,10,251,186,251,224,94,131,5,136,247,120,29,254,0,7,14,139,250,
+199,22,219,7,251,0,151,251,245,248,148,247,163,247,179,247,23,155,248,173,
+10,149,116,129,127,25,251,195,251,230,5,96,248,214,6,248,103,10,151,143,221,
+162,222,26,248,51,10,251,195,251,148,30,253,199,7,117,123,120,114,137,30,
+39,131,5,59,248,101,219,7,49,247,182,10,247,226,247,9,7,247,158,252,21,5,
+59,7,14,137,250,89,231,21,163,10,166,7,247,21,207,65,251,137,31,243,248,35,
+6,14,137,250,189,252,27,21,206,251,50,28,4,156,248,54,10,242,145,5,219,252,
+101,59,7,227,248,90,10,251,226,251,9,7,251,148,248,21,5,219,251,218,59,7,
+247,1,127,247,242,252,148,251,160,251,181,251,23,125,5,59,248,31,219,7,55,
+147,121,141,131,160,151,151,25,247,193,247,232,5,180,254,56,223,6,14,128,
+98,29,128,98,29,128,99,29,229,28,5,129,33,29,128,250,193,251,211,21,248,35,
+102,29,247,21,207,65,251,137,31,14,247,51,247,247,29,247,39,253,152,6,173,
+29,247,193,248,243,10,7,14,128,247,76,247,9,21,248,240,10,190,219,145,235,
+187,186,247,82,51,24,186,178,160,176,186,26,247,14,29,248,185,247,170,10,
+7,14,149,250,214,22,219,248,175,29,118,160,90,149,25,184,174,168,192,162,
+174,190,219,143,235,188,186,247,82,51,24,187,178,157,176,186,26,200,67,197,
+41,69,76,98,79,102,30,88,55,135,62,71,36,133,129,131,129,133,130,8,247,83,
+38,251,152,7,107,127,104,130,98,137,8,222,29,190,172,137,131,163,31,251,166,
+240,247,76,7,247,96,251,167,5,76,7,14,128,250,173,250,17,21,247,14,29,222,
+29,247,207,251,66,247,61,251,77,251,69,26,251,2,67,251,11,251,48,93,98,142,
+143,96,30,157,66,5,133,181,218,128,201,27,247,62,247,59,247,21,247,106,247,
+108,251,20,247,26,251,250,247,100,31,214,175,177,212,159,174,190,219,145,
+235,187,186,247,82,51,24,186,178,160,176,186,26,14,128,250,6,248,190,21,183,
+230,251,87,229,156,188,153,185,168,167,25,247,82,51,5,186,178,160,176,186,
+26,248,197,10,111,93,125,95,121,93,251,31,204,24,92,52,247,38,70,116,102,
+87,63,82,100,39,133,25,227,29,252,77,247,118,10,253,133,7,248,240,10,144,
+148,24,14,247,226,54,10,14,247,226,54,10,251,3,28,5,72,86,29,247,226,54,10,
+63,77,10,247,226,28,5,133,251,211,21,248,35,77,29,247,33,195,248,205,10,251,
+139,249,235,249,165,21,192,7,42,145,251,190,248,39,247,164,247,192,5,146,
+140,222,148,139,26,191,251,174,87,7,207,133,148,137,147,127,133,132,25,251,
+182,251,219,5,91,247,214,6,151,149,153,158,140,30,215,144,5,191,251,230,87,
+7,209,247,83,10,69,134,5,86,247,230,248,150,10,247,173,232,7,247,139,251,
+220,5,101,7,14,133,250,193,22,219,7,251,17,147,251,250,248,101,247,217,247,
+234,5,162,141,235,149,139,26,219,252,2,59,7,231,131,5,145,139,131,139,31,
+251,246,252,15,5,91,247,250,6,154,152,153,161,141,30,233,145,5,219,252,70,
+59,7,227,247,4,10,51,133,5,59,248,70,219,7,45,145,5,117,141,126,153,154,26,
+247,207,242,7,247,193,252,17,5,88,7,14,247,103,48,29,173,28,7,17,33,29,247,
+103,48,29,212,28,7,83,54,29,247,103,48,29,220,251,197,83,29,247,103,48,29,
+251,39,70,10,247,103,48,29,251,25,251,183,57,29,247,103,248,222,250,101,21,
+242,251,54,247,45,7,247,147,29,251,45,251,43,36,247,43,253,216,149,29,248,
+17,252,183,5,76,247,251,227,7,251,40,149,252,95,249,52,144,29,247,173,6,14,
+247,103,250,240,249,11,21,75,208,251,77,251,67,251,59,247,137,144,29,247,
+173,247,54,242,251,54,247,45,247,122,10,251,45,251,43,36,247,43,253,216,149,
+29,247,47,251,115,251,80,251,70,201,71,247,71,247,61,247,65,251,139,5,76,
+247,251,227,7,251,40,149,251,131,247,241,5,14,247,103,250,240,249,11,21,75,
+208,251,77,251,67,251,59,247,137,248,247,29,247,47,251,115,251,80,251,70,
+201,71,247,71,247,61,247,65,251,139,5,76,247,251,227,7,251,40,149,251,131,
+247,241,5,14,247,109,120,248,246,248,88,29,252,38,247,127,10,248,78,7,247,
+33,166,5,141,6,248,17,252,183,5,76,247,251,227,7,251,40,149,252,14,248,189,
+248,181,244,118,247,1,252,228,251,6,126,158,247,130,29,252,69,252,165,55,
+123,5,136,166,10,252,214,7,14,247,103,28,5,147,28,4,242,21,202,80,217,251,
+9,251,74,47,251,19,63,77,30,252,53,252,144,5,65,248,173,6,159,153,160,168,
+143,30,247,9,147,5,227,252,154,51,7,247,0,131,5,168,135,153,118,119,26,254,
+216,7,247,231,29,248,154,227,7,251,9,241,10,248,105,247,35,7,248,15,252,183,
+5,76,247,253,227,7,251,42,149,252,93,249,52,247,236,248,58,185,192,177,174,
+156,147,25,247,78,251,27,5,154,145,220,162,223,26,14,247,103,28,5,27,247,
+209,29,122,29,161,7,247,31,233,251,35,251,169,31,14,247,103,204,248,206,10,
+51,7,247,40,129,248,95,253,52,252,54,252,136,5,127,137,251,19,125,139,26,
+51,248,70,227,7,34,149,125,141,127,160,149,151,25,248,82,248,181,5,213,252,
+173,6,248,142,29,248,156,247,201,29,247,0,147,5,227,252,156,248,104,10,252,
+105,251,35,7,252,17,248,183,5,202,7,14,196,250,185,248,246,21,239,252,74,
+7,104,199,247,247,248,136,5,149,141,247,0,153,139,26,227,252,4,51,7,228,129,
+151,137,149,118,130,127,25,252,6,252,167,5,67,248,159,6,159,153,162,164,141,
+30,238,147,5,227,252,78,51,7,231,131,5,164,137,150,116,119,26,252,159,251,
+20,39,247,20,252,105,7,119,128,116,114,137,30,47,131,5,51,248,78,227,7,40,
+147,5,114,141,125,162,159,26,248,105,247,14,7,247,216,252,183,5,76,247,197,
+227,7,251,18,149,251,189,248,148,5,14,247,105,92,10,14,247,105,92,10,156,
+28,7,17,33,29,247,115,28,5,18,247,209,29,95,29,247,31,233,251,35,251,169,
+31,14,248,59,28,5,228,22,227,160,29,253,141,251,219,247,11,7,248,16,29,247,
+108,28,251,147,6,247,27,29,7,14,247,105,248,252,250,101,21,242,251,80,247,
+45,235,29,251,45,251,47,36,247,47,253,216,110,29,247,229,227,193,10,247,152,
+7,14,247,133,28,5,47,22,227,7,251,39,149,251,228,248,113,104,189,96,167,71,
+145,25,201,172,204,215,178,223,201,247,29,139,247,88,29,164,251,76,40,251,
+42,127,121,125,122,120,125,8,247,252,251,15,252,64,7,119,88,102,135,80,212,
+29,180,137,192,135,192,119,8,252,32,247,15,247,177,7,247,183,252,45,5,73,
+7,14,247,105,28,5,12,28,5,8,21,248,198,29,251,40,251,37,162,251,76,41,251,
+42,8,248,241,10,247,208,251,77,247,185,251,114,251,143,26,251,29,63,251,36,
+251,103,104,100,143,142,97,30,144,116,147,110,144,118,8,133,174,220,128,198,
+27,247,138,247,60,247,89,247,105,247,155,251,173,247,102,251,199,247,74,31,
+247,135,29,14,247,105,250,192,249,243,21,177,234,251,101,224,161,212,166,
+208,199,197,25,247,103,51,5,186,178,167,186,186,26,248,198,29,60,61,108,51,
+113,50,251,67,211,24,100,44,247,77,63,124,96,122,97,113,99,25,248,241,10,
+203,135,239,119,170,92,247,230,252,111,24,73,247,229,247,193,10,153,169,150,
+170,148,170,8,14,249,109,52,10,14,249,109,52,10,251,149,84,29,249,109,52,
+10,251,114,65,29,249,109,28,7,14,247,209,29,71,10,247,91,186,251,105,251,
+99,31,14,252,124,62,10,14,253,43,248,14,252,96,21,187,247,75,10,7,14,253,
+60,248,7,248,96,10,67,144,5,127,141,122,151,149,26,249,210,84,7,251,62,91,
+5,99,241,253,122,7,129,121,127,129,137,30,67,134,5,92,7,14,252,124,62,10,
+248,180,28,7,97,33,29,252,124,62,10,248,219,252,138,51,10,252,124,62,10,248,
+127,251,197,247,110,29,252,124,62,10,247,255,70,10,252,124,62,10,247,255,
+248,220,10,28,7,181,83,29,252,124,62,10,248,13,251,183,57,29,251,97,62,10,
+249,196,247,30,10,251,153,62,10,249,90,28,5,94,81,29,252,124,248,189,108,
+21,247,3,247,47,10,248,30,108,7,251,119,100,55,63,112,30,251,79,247,46,5,
+139,51,112,49,26,72,207,69,247,19,247,140,190,247,89,247,133,30,14,253,81,
+248,0,249,146,21,206,247,75,10,247,148,120,7,251,28,113,89,90,123,30,251,
+13,231,5,139,81,123,85,26,99,184,97,221,247,53,172,247,10,247,36,30,14,252,
+124,248,244,249,48,21,241,251,101,249,119,55,7,251,154,60,5,71,247,50,252,
+228,251,103,37,247,103,252,173,235,10,248,173,7,14,252,87,248,225,250,200,
+21,241,251,63,247,223,55,7,251,154,60,5,71,247,50,251,76,251,67,37,247,67,
+254,69,235,10,250,69,7,14,252,124,248,244,248,191,21,241,251,101,247,15,247,
+101,242,251,101,249,6,55,7,251,154,60,5,71,247,50,252,115,251,103,36,247,
+103,251,15,251,103,37,247,103,252,60,235,10,248,60,7,14,251,243,249,125,250,
+33,21,53,6,90,133,90,90,82,27,108,115,143,147,116,31,249,66,247,121,10,252,
+91,7,141,130,121,139,131,27,251,34,68,35,251,13,108,31,227,6,188,145,186,
+188,197,27,169,166,135,131,162,31,253,19,7,121,112,116,120,137,30,251,2,131,
+5,59,248,134,219,7,251,1,147,5,121,141,114,162,157,26,248,191,7,137,147,156,
+137,147,27,247,33,211,245,247,13,169,31,14,252,124,249,132,251,224,21,248,
+84,29,133,247,110,229,26,28,5,243,57,248,86,10,28,250,178,248,73,10,30,14,
+253,81,248,130,248,222,21,182,108,158,114,148,30,251,3,42,5,79,171,135,247,
+23,193,26,250,37,86,7,251,63,92,5,98,241,253,195,7,251,57,188,251,10,247,
+69,194,211,175,185,30,14,251,224,249,144,247,144,21,239,63,197,43,71,76,118,
+108,77,30,28,4,127,247,121,10,28,251,129,7,251,5,251,11,51,251,43,90,251,
+15,225,102,24,182,241,205,247,11,218,237,8,59,178,221,103,247,3,27,247,66,
+247,17,247,2,247,50,31,45,118,21,72,61,55,55,71,111,206,247,5,128,30,176,
+197,198,161,201,27,198,170,115,75,31,14,252,50,249,62,249,58,21,90,200,90,
+86,92,106,55,119,25,247,52,29,252,48,7,121,115,116,120,137,30,251,2,131,5,
+59,248,131,219,7,33,247,255,10,248,50,7,225,157,218,190,203,203,8,252,56,
+92,247,227,10,252,50,248,89,248,181,248,2,10,247,52,29,252,175,248,73,10,
+248,84,29,136,247,110,229,26,251,83,249,25,247,227,10,251,120,249,193,22,
+247,120,10,249,142,7,251,152,43,5,249,94,247,121,10,253,109,7,247,152,237,
+5,252,238,247,229,10,7,14,252,124,192,250,111,21,59,7,247,3,133,5,157,164,
+114,121,31,28,250,209,223,7,247,154,218,5,207,251,48,28,4,156,7,157,166,164,
+157,30,247,1,145,5,219,7,14,251,73,194,22,248,29,107,29,98,6,122,141,116,
+163,156,26,28,5,88,247,121,10,28,251,47,248,177,10,14,247,2,62,10,250,113,
+61,10,247,11,28,4,137,22,247,120,10,250,70,247,78,242,251,78,248,83,29,252,
+54,248,83,29,251,79,36,247,79,254,70,247,229,10,248,134,247,120,10,250,70,
+248,54,254,70,247,229,10,7,14,247,21,248,189,22,125,195,215,128,218,248,48,
+29,247,25,35,211,251,35,202,31,182,10,251,107,6,101,141,247,71,10,7,14,196,
+248,102,22,250,9,247,27,247,208,29,209,208,158,157,188,30,140,225,5,134,119,
+115,136,114,27,251,1,84,199,247,55,31,248,208,247,125,241,251,125,248,23,
+7,251,68,84,5,251,224,251,27,248,23,7,251,67,84,5,251,224,251,53,37,247,53,
+254,9,7,14,196,249,213,249,226,21,244,7,252,5,251,43,5,240,7,248,5,247,43,
+5,244,7,252,5,251,43,5,247,123,7,140,158,151,159,162,141,247,3,147,24,227,
+252,107,51,7,247,3,131,5,164,137,150,116,119,26,143,138,144,140,144,30,251,
+205,248,176,29,5,38,248,176,29,140,253,3,5,247,124,6,248,41,247,38,247,212,
+247,192,31,251,49,6,251,68,114,251,235,252,5,30,83,248,230,6,14,231,250,243,
+22,247,68,29,248,197,249,185,5,223,253,71,248,158,247,169,10,7,248,20,249,
+228,21,157,143,156,164,159,27,248,10,6,252,91,253,37,5,248,98,7,14,247,31,
+28,4,141,149,21,247,109,251,94,247,71,248,201,29,253,115,248,158,247,70,10,
+28,251,47,7,121,115,118,118,137,30,251,0,131,5,59,248,133,219,7,251,0,147,
+5,118,141,115,160,157,26,249,62,248,191,7,252,46,252,87,194,82,5,147,150,
+159,154,186,27,247,21,247,64,251,3,251,95,251,58,251,15,251,113,251,84,73,
+84,247,245,29,41,247,39,251,25,247,169,248,158,29,251,175,248,0,248,36,21,
+136,195,135,205,217,26,248,59,221,247,150,220,188,163,100,251,115,251,110,
+39,251,118,251,21,251,67,30,247,188,68,21,251,91,65,75,106,95,27,102,101,
+180,247,17,116,31,247,79,247,114,247,42,247,212,247,199,26,247,154,75,170,
+251,0,251,16,251,103,251,183,253,79,75,143,78,150,89,30,80,83,79,95,82,110,
+189,50,24,190,166,192,176,189,185,8,251,0,182,209,84,233,27,222,208,170,247,
+176,247,15,31,14,251,78,247,76,247,248,21,239,247,89,216,251,89,171,247,13,
+181,247,13,178,247,12,25,213,251,17,205,251,29,251,64,26,38,95,59,45,105,
+30,149,103,5,247,55,163,237,209,247,36,26,247,111,251,26,247,66,42,247,80,
+30,179,247,28,169,247,26,247,21,26,244,91,175,67,251,25,85,251,9,46,251,37,
+217,251,16,220,251,25,30,118,68,116,68,117,72,66,247,76,24,251,99,252,35,
+5,248,70,250,15,21,140,46,120,251,3,110,251,7,8,101,225,113,230,239,26,208,
+152,188,182,174,158,127,75,140,30,14,196,250,189,28,4,166,21,247,50,251,87,
+198,251,21,251,191,251,29,251,119,251,175,30,94,251,79,39,247,79,7,140,96,
+140,100,106,26,251,81,39,247,84,6,119,140,127,138,26,251,99,79,251,22,251,
+55,97,30,251,17,250,99,247,60,252,244,7,98,251,21,127,139,31,247,55,244,186,
+247,22,149,247,38,8,247,222,239,251,220,6,138,176,137,178,137,178,8,247,225,
+239,251,229,186,6,247,136,10,130,45,10,14,252,26,249,68,249,165,21,247,121,
+62,7,117,251,40,5,128,138,123,129,127,27,251,171,249,60,6,151,149,153,158,
+140,30,210,144,5,191,251,232,87,7,216,247,83,10,62,134,5,86,7,14,251,85,249,
+248,22,248,67,29,249,160,6,247,175,10,253,123,248,129,10,7,14,252,146,248,
+205,249,165,21,247,64,68,7,121,135,145,39,100,27,251,107,248,104,6,148,147,
+147,154,141,30,195,142,5,187,251,178,91,7,205,136,5,153,137,145,131,130,26,
+252,82,7,131,133,124,125,138,30,73,135,5,91,7,14,130,45,10,249,174,28,7,17,
+33,29,130,45,10,249,213,252,138,51,10,130,45,10,249,221,251,197,83,29,130,
+45,10,248,249,70,10,130,45,10,248,249,248,220,10,28,7,101,83,29,130,45,10,
+249,7,251,183,57,29,247,166,45,10,28,5,15,247,30,10,130,45,10,250,34,28,5,
+14,81,29,130,247,215,10,248,204,247,179,243,251,179,248,97,6,159,153,160,
+168,141,247,210,10,252,97,251,109,35,247,109,252,163,247,46,29,130,247,215,
+10,250,0,247,185,243,251,185,247,45,6,159,153,159,168,142,247,210,10,251,
+45,251,85,35,247,85,253,215,247,46,29,130,250,175,247,67,10,248,9,247,148,
+246,251,148,247,55,247,148,246,251,148,248,19,247,122,29,252,19,251,109,32,
+247,109,251,55,251,109,32,247,109,251,224,247,46,29,239,28,4,137,22,248,2,
+29,248,179,6,135,153,155,139,156,27,247,53,225,247,13,247,29,176,31,39,6,
+84,131,86,79,73,27,98,106,148,149,109,31,248,68,247,124,29,251,234,7,143,
+124,123,141,123,27,251,54,53,251,13,251,29,102,31,237,6,194,147,195,197,204,
+27,180,172,130,129,170,31,252,228,248,100,10,7,14,251,85,248,216,249,23,21,
+89,214,251,51,251,1,5,247,153,7,247,175,10,252,26,7,251,62,251,8,185,63,247,
+16,223,5,251,137,248,129,10,249,195,248,67,29,248,46,6,14,239,248,173,248,
+116,248,2,10,249,45,247,124,29,253,47,7,248,21,29,242,247,186,10,251,229,
+248,100,10,250,117,248,2,29,6,14,247,160,28,5,48,247,67,10,249,127,6,251,
+169,37,5,248,124,7,247,146,10,253,36,7,247,169,242,5,252,175,247,46,29,130,
+194,248,206,10,252,17,247,11,7,172,247,138,5,157,141,164,156,157,27,248,66,
+28,251,147,6,248,0,10,251,1,131,5,51,248,159,227,7,251,11,248,11,29,247,11,
+147,5,227,7,14,248,225,45,10,28,5,188,61,10,250,108,45,10,28,7,180,185,29,
+248,27,28,5,171,247,67,10,28,4,109,6,248,125,10,247,1,147,5,227,254,44,247,
+113,29,248,152,28,4,254,21,248,42,29,89,135,88,143,248,18,29,206,143,5,14,
+249,25,63,29,14,204,250,240,248,172,10,75,247,252,29,247,232,7,223,107,243,
+251,32,69,251,0,85,108,86,30,180,116,93,183,62,27,69,52,96,106,79,31,200,
+84,7,251,53,92,5,99,231,247,100,29,154,169,200,159,190,27,224,171,91,70,31,
+251,213,248,162,29,83,135,5,91,247,184,187,7,83,247,252,29,248,40,7,159,180,
+196,153,184,27,228,168,90,63,31,251,205,248,70,10,178,250,230,249,164,94,
+29,120,28,4,135,94,29,249,25,63,29,66,28,5,129,33,29,249,25,63,29,251,146,
+28,5,33,43,10,249,25,63,29,251,146,70,10,249,25,28,6,160,185,10,247,121,4,
+90,29,249,25,28,6,182,248,229,21,53,6,79,125,251,35,81,251,24,252,4,251,117,
+247,10,251,100,27,251,211,251,15,33,251,37,65,31,225,6,198,153,247,28,198,
+247,25,248,4,247,92,251,10,247,131,27,247,208,247,18,246,247,36,213,31,117,
+252,229,21,90,29,196,250,145,28,4,149,21,45,6,49,251,54,69,129,41,57,89,90,
+25,207,116,93,213,62,27,69,52,67,84,79,31,241,84,7,251,53,61,5,72,231,253,
+91,7,114,127,121,123,137,30,74,133,5,59,247,130,7,57,251,41,5,237,6,247,114,
+248,39,5,251,15,248,130,10,247,144,219,7,103,145,5,123,141,127,157,164,26,
+247,240,7,247,93,248,2,5,183,109,155,70,46,26,252,158,248,130,10,247,170,
+219,7,75,145,5,123,141,127,157,164,26,248,203,7,247,4,118,247,26,59,188,30,
+252,237,254,37,21,103,145,5,122,141,128,157,248,172,29,165,169,200,172,190,
+27,224,171,59,251,8,31,251,129,7,251,87,251,244,5,247,211,249,108,21,171,
+165,182,159,178,147,251,6,251,98,24,14,250,97,28,4,213,22,248,1,107,29,100,
+6,116,141,121,157,164,26,248,191,97,29,14,248,254,28,6,18,247,23,21,248,203,
+7,247,30,86,247,68,251,107,251,0,251,54,49,87,57,30,207,104,65,213,251,10,
+27,32,251,25,247,52,10,143,121,155,248,172,29,165,188,231,172,217,27,247,
+25,186,55,251,6,31,252,169,248,131,29,248,85,248,126,29,143,121,155,248,172,
+29,172,204,221,165,209,27,247,27,186,55,251,17,31,253,76,7,251,48,116,251,
+23,64,94,248,103,29,63,213,102,221,247,238,212,247,216,247,168,30,14,167,
+250,138,250,3,21,247,215,7,223,104,244,251,31,67,35,85,109,85,30,180,117,
+92,182,61,27,69,53,96,106,80,31,247,192,10,247,191,186,7,83,248,145,10,155,
+170,198,160,190,27,225,170,87,70,31,251,212,248,53,29,84,134,5,92,247,185,
+248,26,29,194,156,182,27,229,170,87,64,31,252,40,7,45,122,61,90,112,30,251,
+21,221,5,113,131,108,119,98,26,92,186,116,194,247,116,188,247,89,247,58,30,
+14,249,25,97,10,37,223,7,247,140,217,5,206,251,36,249,91,248,54,10,14,178,
+250,230,28,5,47,21,188,251,193,248,78,10,123,108,78,118,87,27,56,106,188,
+209,31,247,213,7,154,151,151,153,30,197,141,5,188,251,183,248,78,10,118,96,
+84,123,93,27,51,111,188,215,31,247,207,7,154,149,151,155,30,195,141,5,188,
+251,189,90,7,200,137,5,156,151,127,124,31,251,234,7,55,172,37,247,31,211,
+245,192,170,192,30,98,162,186,96,217,27,206,227,180,174,201,31,77,192,7,247,
+54,184,5,180,47,248,64,7,154,151,151,155,30,14,249,25,97,10,252,207,223,7,
+247,140,215,5,206,251,36,28,4,158,248,54,10,14,174,250,234,28,5,49,21,187,
+251,193,91,7,195,136,5,154,137,152,129,124,26,252,40,7,124,108,78,119,89,
+27,53,106,187,209,31,247,213,248,55,10,195,142,5,187,251,184,91,7,195,247,
+251,10,252,41,7,120,98,83,124,95,27,50,110,188,215,31,247,206,7,154,150,149,
+156,141,30,193,142,5,187,251,190,91,7,203,247,251,10,251,233,7,56,172,34,
+247,32,209,247,0,194,169,193,30,98,161,184,95,216,27,209,228,182,172,199,
+31,251,234,193,7,247,54,184,5,179,45,249,90,248,55,10,14,220,209,251,34,21,
+219,6,145,238,5,163,141,157,158,164,27,248,203,6,247,32,247,66,188,247,107,
+247,0,49,247,58,87,221,31,207,174,213,211,247,10,26,246,67,247,27,84,231,
+30,241,223,6,61,247,140,5,72,251,33,253,91,6,114,121,157,164,137,31,133,239,
+5,59,252,99,248,154,29,249,52,6,165,92,172,45,61,26,251,23,59,90,251,8,30,
+252,171,248,128,10,252,85,248,154,29,249,54,6,172,76,163,51,71,26,251,29,
+57,94,251,19,30,252,158,248,128,10,6,14,247,248,28,5,119,22,219,7,49,145,
+5,130,10,7,14,247,248,28,5,29,225,21,130,10,247,210,247,196,10,14,249,70,
+112,10,7,14,249,78,69,10,14,209,250,254,249,165,21,192,7,67,248,10,10,211,
+144,5,191,251,198,103,7,251,133,252,236,251,133,248,239,5,172,251,191,87,
+7,215,247,83,10,63,134,5,86,247,180,248,150,10,249,46,7,247,188,253,131,5,
+205,6,247,198,249,142,5,253,57,7,127,129,125,120,138,30,68,134,5,86,7,14,
+247,238,28,5,117,22,219,7,49,247,254,10,249,133,248,55,29,229,145,5,219,252,
+25,88,7,251,181,253,60,251,177,249,62,5,188,252,25,59,7,237,247,4,10,41,133,
+5,59,248,11,219,7,45,247,254,10,249,105,7,247,238,253,222,5,235,6,247,255,
+249,236,5,253,119,7,124,128,125,117,137,30,49,133,5,59,7,14,249,78,69,10,
+116,28,7,17,33,29,249,78,69,10,251,96,28,6,177,43,10,249,78,69,10,251,96,
+70,10,249,78,28,6,39,28,4,209,21,248,125,10,247,3,147,5,227,252,107,187,29,
+28,251,0,7,251,118,39,251,16,251,23,94,96,161,160,114,30,72,247,64,5,139,
+112,149,110,78,84,84,77,251,43,247,33,73,247,113,247,244,215,247,246,244,
+30,14,248,185,96,29,250,234,247,125,248,41,21,251,170,247,103,251,52,247,
+121,247,40,247,6,203,241,247,28,30,251,1,206,247,3,82,247,31,27,247,56,206,
+215,247,15,247,46,31,251,58,248,3,227,7,251,11,149,5,112,141,125,160,155,
+26,250,220,247,184,29,243,147,5,227,252,160,51,7,247,19,247,71,29,254,75,
+7,55,251,0,79,78,251,29,27,251,74,63,247,74,29,253,208,7,74,147,81,156,88,
+30,98,61,251,7,86,57,27,251,74,251,23,247,74,29,14,249,78,28,4,190,248,206,
+10,51,7,247,1,247,182,29,254,253,7,252,107,28,4,246,5,37,6,252,91,28,251,
+29,5,250,234,7,248,148,29,252,79,247,131,29,248,95,194,7,248,7,250,130,248,
+7,254,124,5,78,248,107,227,7,251,3,247,5,29,247,3,147,5,227,7,14,28,5,228,
+28,5,192,250,251,21,248,35,28,251,120,5,247,48,6,248,75,28,5,17,247,57,29,
+251,218,254,112,252,35,28,4,136,5,251,48,6,251,240,254,154,251,248,250,154,
+5,251,48,6,252,75,28,250,239,251,10,117,5,51,248,43,227,7,251,5,149,121,141,
+123,162,145,155,25,247,218,250,112,247,232,254,116,143,127,131,116,125,137,
+25,251,13,129,5,51,248,126,227,7,251,13,159,115,207,5,14,249,70,112,10,248,
+14,247,40,10,205,250,212,247,95,21,247,24,92,202,33,245,30,251,131,247,134,
+247,34,247,70,5,55,236,116,94,182,27,177,214,184,247,34,211,121,217,34,215,
+31,67,192,108,168,178,162,149,131,151,26,151,140,145,120,106,251,18,57,251,
+33,79,146,91,242,61,30,251,28,251,63,251,177,247,176,5,251,31,247,32,119,
+163,189,162,164,161,148,26,154,141,152,119,106,251,4,43,251,30,251,24,181,
+76,246,32,30,186,92,5,251,30,251,44,96,34,47,251,10,247,5,251,8,63,26,87,
+74,115,79,132,30,129,90,5,247,146,6,236,219,206,230,31,247,58,251,126,247,
+7,247,57,26,173,145,176,186,208,30,248,113,252,113,5,247,35,251,34,156,113,
+92,115,114,119,127,26,128,137,123,158,172,247,8,235,247,30,30,14,251,205,
+249,122,248,172,10,80,143,5,124,140,127,150,154,26,247,231,7,247,11,76,209,
+251,8,78,55,102,100,65,30,200,84,7,251,54,92,5,99,232,247,100,29,160,184,
+189,153,190,27,232,174,98,61,31,251,211,248,70,10,251,226,249,111,248,96,
+10,80,248,91,10,247,232,7,247,11,76,209,251,7,78,55,102,100,65,30,247,38,
+10,159,184,188,156,190,27,231,174,96,61,31,251,212,7,125,129,129,123,137,
+30,81,134,5,92,7,14,204,42,10,247,100,28,5,129,33,29,204,42,10,232,250,252,
+50,29,204,42,10,247,139,28,5,195,54,29,204,42,10,166,28,5,33,43,10,204,42,
+10,247,139,252,138,51,10,204,42,10,247,147,251,197,83,29,204,42,10,166,70,
+10,204,42,10,180,251,183,57,29,204,250,244,251,23,21,247,103,7,49,145,5,115,
+143,120,155,164,26,248,201,7,198,10,252,167,7,114,120,123,115,135,30,53,133,
+5,59,247,240,251,23,7,251,52,100,104,61,107,30,251,78,247,33,5,139,53,114,
+49,26,70,206,81,247,17,247,140,192,247,44,247,68,30,14,204,28,4,127,248,234,
+21,48,6,85,129,43,86,51,251,104,53,246,251,65,27,251,106,251,8,35,251,24,
+89,31,230,6,193,149,230,192,228,247,105,229,32,247,64,27,247,104,247,10,244,
+247,23,189,31,65,252,234,21,140,10,14,204,114,248,82,21,158,36,247,82,175,
+5,251,140,247,57,10,248,99,219,7,53,247,110,10,247,177,7,248,58,220,5,252,
+2,248,161,29,53,133,5,59,248,88,219,7,49,247,254,29,248,38,7,247,97,179,118,
+243,251,76,103,5,194,247,126,29,251,248,7,247,83,247,209,21,247,181,29,80,
+7,252,58,57,5,14,248,42,28,5,27,249,201,21,251,132,253,103,5,102,6,115,141,
+120,157,164,26,248,189,163,29,248,3,247,51,10,14,235,28,4,127,22,219,7,49,
+145,5,114,143,121,155,164,26,248,201,7,247,91,43,247,9,251,71,45,248,7,10,
+254,62,7,251,68,57,247,129,10,249,216,7,174,208,217,165,217,27,247,33,194,
+66,251,21,31,252,167,248,131,29,7,14,251,208,249,132,248,96,10,81,248,145,
+29,247,11,77,209,251,9,78,55,102,100,63,30,208,86,7,251,56,92,5,98,233,252,
+191,7,33,86,79,98,30,33,242,5,128,90,108,90,100,168,96,217,247,29,247,31,
+221,247,72,31,248,124,7,159,186,188,156,191,27,231,176,96,61,31,251,212,7,
+125,126,129,123,137,30,84,134,5,92,7,14,204,250,134,247,172,10,251,144,61,
+5,72,247,37,253,93,178,10,251,226,249,42,249,158,21,248,60,7,247,11,71,209,
+251,9,78,47,102,100,65,30,206,84,7,251,56,94,5,98,233,252,72,7,129,123,127,
+126,248,193,29,84,144,5,126,141,123,151,149,26,248,42,7,159,184,198,153,191,
+27,231,180,96,64,31,252,77,7,33,85,79,98,30,251,0,242,5,129,92,108,90,100,
+165,96,217,247,31,247,32,221,247,72,31,14,204,28,5,74,251,232,21,209,92,200,
+71,30,251,60,251,56,5,43,170,137,219,247,91,26,249,139,7,247,91,49,247,9,
+251,70,44,251,13,77,74,251,6,30,241,55,7,251,144,61,5,72,247,37,253,97,7,
+123,115,120,122,137,30,37,129,5,61,248,99,217,7,51,149,5,122,141,115,158,
+155,26,249,58,7,174,208,209,163,217,27,247,35,186,68,251,21,31,253,75,7,251,
+138,247,7,251,82,247,169,247,10,201,205,202,30,14,251,226,250,9,248,232,21,
+180,108,176,96,30,251,1,40,5,76,158,137,186,247,13,26,248,76,7,247,11,82,
+209,251,9,77,62,102,100,65,30,200,84,7,251,56,92,5,98,233,252,66,7,131,125,
+127,126,30,74,132,5,92,247,193,186,7,79,146,5,129,125,151,147,31,248,44,7,
+159,184,184,156,188,27,233,170,93,64,31,252,40,7,251,49,223,34,247,62,215,
+180,180,178,30,14,247,125,28,5,70,247,117,21,233,77,205,35,67,74,123,108,
+77,30,141,247,250,5,198,10,252,101,7,251,27,251,30,48,251,70,115,55,229,104,
+24,164,197,206,247,29,235,247,13,8,86,172,207,98,247,19,27,247,45,247,36,
+229,247,43,31,49,119,21,53,61,88,53,69,112,225,218,129,30,176,197,200,162,
+202,27,189,178,106,84,31,14,204,250,244,251,211,21,248,35,141,29,247,52,248,
+156,10,204,250,244,252,82,21,218,7,49,146,248,160,29,250,135,196,29,254,103,
+248,161,29,53,132,5,60,7,14,249,43,250,201,138,10,250,96,61,10,247,33,57,
+10,14,247,33,57,10,207,250,252,50,29,247,33,28,4,147,22,82,10,247,33,250,
+175,219,21,59,247,196,10,59,4,82,10,247,33,57,10,247,122,28,4,176,83,29,247,
+33,57,10,247,103,77,10,251,28,250,50,248,169,10,251,177,87,7,215,248,91,29,
+252,200,7,252,79,248,254,5,169,251,156,87,7,218,247,83,29,63,134,5,86,247,
+180,192,7,63,247,252,10,248,239,7,248,131,253,68,5,243,249,120,6,151,148,
+153,158,140,30,14,245,28,4,131,248,206,29,252,5,59,7,234,133,5,161,137,149,
+125,124,26,253,2,7,252,162,249,74,5,184,251,236,59,7,239,247,4,10,45,133,
+5,59,248,7,219,7,45,247,254,10,249,51,7,248,232,253,168,5,247,33,249,250,
+6,154,151,153,162,141,30,14,251,206,249,132,28,5,47,21,188,251,132,90,7,200,
+137,5,154,145,129,131,31,252,11,7,251,232,248,54,5,165,251,115,90,7,202,137,
+5,154,145,129,131,31,252,89,7,131,133,131,124,137,30,78,134,5,92,247,133,
+186,7,78,144,5,125,141,130,147,147,26,248,39,7,248,24,252,109,5,231,248,159,
+6,147,147,149,153,30,14,248,17,38,10,251,165,248,167,33,29,248,17,38,10,252,
+24,247,142,50,29,248,17,38,10,251,126,248,233,54,29,248,17,38,10,252,90,248,
+71,43,10,248,17,38,10,251,126,28,249,12,51,10,248,17,38,10,251,118,28,249,
+209,83,29,248,17,38,10,252,90,28,249,221,72,29,14,248,17,38,10,252,76,28,
+249,223,57,29,196,250,179,248,95,29,251,199,51,7,221,131,5,159,137,149,116,
+119,26,252,4,251,157,7,251,104,248,94,5,190,251,176,51,7,223,131,5,160,137,
+150,116,119,26,252,4,251,8,39,247,8,251,7,251,8,39,247,8,252,45,7,119,128,
+116,118,137,30,58,131,5,51,247,202,227,7,57,147,5,118,141,130,162,159,26,
+248,45,247,169,7,247,148,252,186,5,247,4,248,186,247,2,239,251,2,247,7,247,
+2,239,251,2,248,4,6,159,149,162,159,141,30,253,55,252,149,21,247,69,6,193,
+251,7,5,251,123,6,247,233,247,7,21,247,111,251,7,251,58,6,252,30,248,133,
+21,247,23,251,174,5,251,23,6,248,77,251,207,21,247,11,251,149,6,14,248,17,
+120,249,39,248,88,29,252,87,247,127,29,248,110,7,247,205,199,248,85,253,55,
+5,247,52,249,172,6,247,131,185,118,247,1,251,110,97,5,247,220,247,184,29,
+247,6,147,5,248,44,29,251,243,7,251,238,72,251,228,248,144,5,190,252,42,51,
+7,247,13,247,182,29,252,165,7,249,22,150,21,247,172,193,5,252,112,7,253,181,
+249,234,21,247,139,252,8,251,139,92,5,14,248,17,247,230,28,4,123,21,249,142,
+28,251,133,5,247,52,28,4,209,6,248,57,29,247,6,147,5,247,39,29,28,250,207,
+7,251,68,59,38,75,30,251,62,247,72,5,123,61,84,55,76,190,65,247,11,247,99,
+247,44,247,11,247,193,31,14,248,57,28,5,177,247,209,29,251,89,28,4,121,247,
+184,29,247,6,147,5,175,10,247,18,116,247,19,33,251,183,26,14,245,247,31,250,
+25,21,162,137,151,125,124,26,253,250,247,33,7,248,232,249,168,5,253,51,7,
+124,127,125,116,137,30,45,133,5,59,248,7,219,7,45,145,5,116,141,131,153,154,
+26,249,133,7,154,147,153,162,141,30,239,145,5,219,251,236,94,7,252,162,253,
+74,5,249,2,7,154,149,153,161,141,30,234,145,5,219,252,5,59,7,14,251,30,247,
+2,28,6,1,21,157,138,148,127,126,26,253,106,247,4,7,248,107,249,38,5,252,196,
+7,126,129,127,121,138,30,65,134,5,72,247,185,206,7,65,144,5,120,140,133,151,
+152,26,249,8,7,152,145,151,158,140,30,218,144,5,206,251,164,101,7,252,52,
+252,215,5,248,155,7,152,147,151,157,140,30,214,144,5,206,251,184,72,7,14,
+248,29,28,5,25,96,21,250,136,7,247,170,251,103,247,52,251,122,251,56,251,
+14,63,251,15,251,46,30,247,58,252,3,51,7,247,11,129,5,166,137,153,118,123,
+26,254,220,189,29,250,75,7,223,247,0,247,7,200,247,29,27,247,75,247,23,251,
+19,251,74,31,254,175,247,63,29,14,248,24,248,60,250,216,21,248,155,29,247,
+25,251,7,251,76,31,28,251,39,7,119,122,119,111,136,30,32,127,5,51,248,150,
+227,7,251,2,147,5,112,141,121,162,159,26,28,5,12,7,247,60,10,254,220,189,
+29,14,250,103,38,10,248,246,186,165,29,28,5,94,38,10,250,238,147,198,29,14,
+250,137,28,7,248,248,252,21,247,120,251,38,247,74,251,127,251,134,251,31,
+251,74,251,120,251,121,247,35,251,70,247,128,247,123,247,44,247,70,247,121,
+30,65,252,252,21,235,252,248,43,7,247,8,28,5,20,21,211,84,174,63,251,191,
+135,251,185,251,129,30,252,159,7,252,131,250,93,5,190,252,21,55,7,247,17,
+129,5,167,137,154,116,121,26,254,42,7,251,86,91,123,88,122,30,251,41,247,
+13,5,106,123,96,83,72,26,67,194,104,215,247,191,143,247,183,247,132,30,249,
+15,7,248,214,28,251,147,5,247,29,250,179,6,247,86,184,156,190,153,30,247,
+42,251,13,5,171,158,182,192,208,26,248,44,253,64,21,251,76,63,251,37,251,
+37,251,31,61,247,37,247,76,247,77,210,247,39,247,40,247,31,219,251,39,251,
+77,30,14,247,254,51,29,14,247,254,51,29,178,28,5,248,50,29,247,254,51,29,
+247,39,84,29,247,254,28,4,241,225,21,53,247,220,29,225,7,53,4,104,10,247,
+38,84,29,247,254,51,29,247,74,65,29,247,254,51,29,247,93,28,6,64,83,29,157,
+39,29,14,251,253,249,64,251,57,21,247,65,251,8,247,31,251,90,251,89,251,15,
+251,29,251,67,251,69,247,13,251,25,247,87,247,86,247,16,247,28,247,66,30,
+251,31,140,21,251,26,248,185,10,247,25,247,26,194,247,14,247,15,247,12,196,
+251,14,251,26,30,14,251,255,249,64,250,203,197,29,251,131,28,5,174,197,29,
+157,39,29,247,134,250,39,56,10,157,39,29,222,249,14,48,10,157,39,29,200,249,
+14,69,29,223,249,61,33,29,157,39,29,200,249,14,66,29,157,39,29,200,249,14,
+69,29,247,36,249,75,36,29,157,39,29,200,249,14,69,29,83,249,53,45,29,157,
+39,29,251,51,253,167,72,29,247,112,28,5,141,51,10,157,39,29,170,249,14,65,
+10,157,39,29,170,250,62,66,10,157,39,29,200,250,105,54,29,157,39,29,221,250,
+53,63,10,79,248,22,33,29,157,39,29,221,250,53,248,239,10,157,39,29,221,250,
+53,248,245,10,157,250,168,248,128,170,29,14,157,250,168,248,128,170,29,249,
+19,248,215,33,29,157,250,168,248,128,170,29,248,160,247,190,50,29,157,39,
+29,189,249,199,39,10,157,39,29,189,249,199,248,236,10,157,39,29,251,51,249,
+199,43,10,157,39,29,251,51,249,199,248,227,10,157,39,29,251,10,250,31,45,
+29,157,39,29,251,51,253,167,72,29,14,157,250,168,248,128,21,247,180,251,70,
+247,124,251,197,247,19,10,158,157,140,141,157,30,81,87,77,54,56,248,102,29,
+248,140,29,217,195,211,234,197,30,247,64,219,241,247,71,247,105,26,251,105,
+141,248,228,29,157,249,251,248,36,29,211,217,247,4,201,30,251,24,122,5,78,
+109,251,12,251,10,247,149,10,247,65,249,206,170,29,14,106,247,25,251,180,
+21,39,247,30,251,26,247,168,247,67,247,49,244,247,70,247,15,251,56,232,251,
+49,247,12,30,247,105,222,247,114,247,29,247,145,26,247,212,251,120,247,14,
+251,132,251,111,251,128,251,55,251,212,30,252,110,249,35,251,41,251,74,26,
+46,41,93,65,74,81,168,181,86,30,96,247,53,5,151,122,95,143,122,27,57,98,74,
+83,31,247,37,249,211,21,247,116,229,247,45,247,63,247,29,247,2,251,11,251,
+121,251,117,251,59,251,12,251,28,71,30,251,5,238,47,247,11,247,58,26,14,157,
+155,10,157,155,10,251,255,247,37,10,251,31,176,21,251,244,6,247,11,147,194,
+239,247,5,27,247,0,197,39,251,11,149,31,78,4,251,15,133,81,32,251,6,27,251,
+5,84,246,247,15,130,31,14,157,157,10,248,230,249,240,39,10,116,250,128,249,
+66,21,247,242,32,248,7,251,252,251,253,33,252,7,251,242,251,240,245,252,7,
+247,253,247,252,246,248,7,247,240,30,251,89,188,21,252,177,6,247,99,149,180,
+248,9,247,112,27,247,111,182,252,9,251,99,147,31,43,4,251,99,131,96,252,9,
+251,111,27,251,112,98,248,9,247,99,129,31,14,247,26,248,89,4,247,22,6,251,
+168,155,247,74,251,94,247,178,27,247,177,247,78,247,98,247,164,155,31,247,
+21,242,251,22,6,247,149,114,251,65,247,91,251,174,27,251,173,251,74,251,88,
+251,152,114,31,251,24,6,250,24,36,247,221,29,248,178,241,247,187,10,14,252,
+35,249,38,28,4,173,21,247,102,69,247,114,251,126,251,127,70,251,114,251,102,
+251,101,208,251,115,247,127,247,126,209,247,115,247,101,30,251,20,168,21,
+251,244,6,247,16,145,166,247,116,247,35,27,247,34,167,251,116,251,16,145,
+31,81,4,251,16,133,111,251,116,251,34,27,251,35,112,247,116,247,16,133,31,
+14,135,250,146,248,130,21,247,174,251,72,247,128,251,187,251,193,251,68,251,
+128,251,174,251,181,247,72,251,122,247,187,247,181,247,80,247,122,247,181,
+30,251,93,247,0,21,100,111,110,61,55,47,94,247,5,251,5,27,47,102,108,96,102,
+31,247,111,147,232,247,73,247,74,27,247,45,234,251,32,251,74,165,31,147,251,
+11,21,251,121,137,45,251,83,251,80,27,251,48,43,247,38,247,80,114,31,174,
+156,171,199,228,247,4,178,251,5,247,9,27,229,163,190,192,180,31,14,157,100,
+29,161,250,39,33,29,250,76,28,7,20,249,136,21,247,115,47,247,91,251,39,247,
+35,30,247,27,247,54,57,204,251,25,251,51,5,237,251,23,251,54,196,251,68,27,
+252,72,251,244,251,244,252,72,251,120,235,251,96,247,43,251,36,31,251,60,
+251,95,223,78,247,56,247,91,5,47,247,23,247,50,83,247,64,27,248,72,247,244,
+247,244,248,73,31,41,137,21,252,15,251,201,251,201,252,15,251,39,251,30,186,
+219,251,4,30,250,2,250,174,5,247,21,251,17,217,251,66,251,82,26,251,179,248,
+193,21,254,2,254,177,5,251,21,247,17,57,247,68,247,87,26,248,15,247,201,247,
+201,248,15,247,44,247,29,90,57,247,4,30,14,247,147,248,197,250,136,21,247,
+19,10,247,172,247,76,247,90,247,157,161,31,247,53,144,247,45,229,247,101,
+26,247,55,36,246,251,90,51,62,103,95,85,30,190,65,47,168,251,0,27,247,162,
+252,154,156,29,214,248,13,21,168,178,188,158,179,27,245,196,62,251,0,251,
+11,83,56,41,127,31,133,247,31,92,247,16,55,227,8,14,207,239,248,136,21,251,
+237,247,84,251,72,247,183,247,173,247,92,247,112,247,212,248,129,252,147,
+247,154,252,144,247,1,30,140,251,17,247,113,82,247,80,60,247,31,251,0,25,
+251,157,120,251,121,251,95,251,180,26,249,136,133,21,251,106,73,251,104,248,
+150,29,247,32,247,79,247,109,146,147,138,138,147,30,243,251,6,198,251,32,
+251,64,26,14,247,87,49,29,14,247,87,49,29,158,250,39,33,29,247,87,49,29,43,
+249,14,50,29,247,87,49,29,218,250,53,36,29,247,87,49,29,251,13,250,31,45,
+29,247,87,49,29,251,54,253,167,72,29,14,178,28,4,174,250,171,21,78,6,93,135,
+122,115,45,251,68,251,1,174,251,70,27,251,195,251,78,251,118,251,186,251,
+187,247,78,251,114,247,191,247,183,29,247,43,90,247,29,47,233,31,139,221,
+107,194,247,21,164,247,56,180,143,30,252,3,252,189,21,251,116,53,251,92,251,
+80,251,76,51,247,94,247,114,247,115,223,247,93,247,80,247,76,229,251,95,251,
+113,30,14,247,34,248,227,205,21,251,83,251,27,247,83,247,128,247,126,247,
+15,247,101,247,88,145,31,123,209,5,251,185,251,121,251,125,251,178,251,188,
+247,152,251,114,247,180,201,219,150,159,194,31,119,188,211,128,189,27,239,
+218,176,212,197,31,103,196,5,88,91,70,114,86,27,120,121,142,144,122,31,247,
+20,233,220,247,44,247,63,26,247,196,251,79,247,29,251,41,251,30,251,90,251,
+36,251,210,251,65,215,251,30,245,53,30,134,118,117,137,115,27,247,228,248,
+60,21,251,33,88,251,11,74,64,30,76,221,86,247,19,247,11,26,247,143,190,247,
+1,205,203,190,251,0,251,137,30,14,220,250,231,248,126,21,247,189,251,115,
+247,85,251,193,251,180,251,117,251,73,251,197,251,185,247,113,251,87,247,
+192,247,174,247,126,247,65,247,203,30,252,144,251,163,21,251,129,251,91,231,
+247,77,247,76,247,92,224,247,108,247,128,247,92,49,251,79,251,76,251,91,54,
+251,109,31,14,226,28,4,146,247,2,21,182,212,251,46,231,5,166,197,157,207,
+225,26,247,189,251,115,247,85,251,192,251,62,251,38,77,251,5,47,30,251,50,
+234,95,68,247,48,46,5,103,73,115,61,51,26,251,195,247,113,251,87,247,191,
+247,72,247,50,209,247,21,231,30,77,247,26,21,253,14,248,14,5,170,211,228,
+156,232,27,247,129,247,92,49,251,79,78,116,89,105,101,31,69,83,21,95,63,34,
+119,251,0,27,251,129,251,91,232,247,77,213,171,193,187,181,31,14,134,250,
+175,28,4,116,21,247,40,60,243,251,47,48,54,94,67,93,30,196,105,57,199,251,
+16,27,251,85,251,4,251,32,251,63,251,60,247,3,251,35,247,84,247,7,208,201,
+199,189,31,80,183,210,76,247,12,27,235,215,179,175,195,31,214,7,107,92,76,
+103,65,27,251,54,84,247,22,247,15,31,248,37,6,140,150,139,154,147,26,251,
+26,160,21,251,153,6,235,148,193,215,224,27,213,178,74,59,31,252,30,251,2,
+21,251,23,86,251,12,251,5,251,4,83,247,13,247,29,247,22,190,247,10,247,9,
+247,6,191,251,6,251,33,30,14,248,219,208,248,31,21,251,138,247,15,251,66,
+247,130,247,31,247,23,215,247,11,211,30,45,190,247,19,38,247,82,27,247,189,
+247,64,247,126,247,176,247,173,251,62,247,130,251,187,251,70,33,36,39,63,
+31,237,71,251,2,244,251,76,27,251,40,251,9,73,78,53,31,251,17,7,192,211,237,
+200,247,5,27,247,142,223,251,109,251,97,31,252,253,6,137,121,139,114,125,
+26,247,99,104,21,248,38,6,251,51,124,57,251,19,251,23,27,251,6,79,247,0,247,
+25,31,248,242,247,75,21,247,111,221,247,92,247,66,247,64,225,251,94,251,120,
+251,109,60,251,88,251,71,251,68,59,247,82,247,126,30,14,248,56,247,177,248,
+130,21,248,166,29,226,178,129,100,223,30,252,220,7,251,34,86,62,251,51,251,
+76,51,247,96,247,114,30,249,243,253,189,21,247,173,29,28,5,22,58,7,101,51,
+76,129,73,251,16,251,25,212,251,114,27,247,19,10,247,125,247,62,240,247,46,
+31,248,223,7,193,129,222,139,192,149,8,14,249,79,28,6,189,248,142,10,251,
+53,251,14,75,35,59,30,242,61,251,12,204,251,52,27,251,195,251,60,251,120,
+251,184,251,187,247,58,251,114,247,191,247,50,247,15,202,243,219,31,35,218,
+247,13,76,247,52,247,7,10,253,101,22,247,101,29,14,94,250,105,248,32,21,247,
+90,251,39,247,41,251,73,181,30,247,27,166,247,34,247,1,247,98,26,247,135,
+251,65,247,31,251,122,251,116,251,74,251,31,251,135,251,98,247,38,251,7,247,
+24,118,30,251,72,103,251,41,251,46,251,91,26,251,124,247,72,251,81,247,169,
+247,152,247,86,247,82,247,123,30,252,90,250,135,21,247,17,215,33,251,62,251,
+52,70,251,22,251,25,251,40,84,247,29,247,45,247,29,199,247,31,247,36,31,28,
+250,213,4,251,63,63,247,32,247,81,247,69,230,247,31,247,47,247,39,237,251,
+7,251,93,251,73,58,251,40,251,55,31,14,157,249,211,248,142,21,251,128,53,
+251,94,251,80,251,77,52,247,95,247,127,30,251,107,6,251,208,247,78,251,107,
+247,191,247,191,247,82,247,115,247,200,30,14,252,8,248,181,250,213,21,251,
+34,248,185,10,247,33,30,251,32,6,251,82,247,13,251,21,247,87,247,86,247,16,
+247,26,247,77,30,14,157,250,168,248,142,21,247,173,133,251,69,247,117,251,
+192,27,251,190,251,79,251,113,251,177,133,31,247,107,6,247,110,142,223,247,
+88,247,79,27,247,73,227,251,88,251,110,142,31,14,252,8,249,64,250,213,21,
+247,60,135,251,7,247,27,251,87,27,251,86,251,14,251,24,251,63,135,31,247,
+32,6,247,22,141,194,247,10,247,13,27,247,10,196,251,10,251,22,141,31,14,248,
+37,35,29,14,251,15,250,50,28,4,173,21,247,130,251,64,247,86,251,155,251,157,
+251,61,251,84,251,131,251,139,247,66,251,78,247,153,247,153,247,65,247,85,
+247,131,30,251,46,137,21,251,86,48,251,60,251,84,251,80,48,247,60,247,89,
+247,87,228,247,58,247,85,247,78,233,251,55,251,93,30,14,247,25,28,4,133,248,
+136,21,247,178,251,105,247,126,251,222,251,223,251,105,251,124,251,178,251,
+189,247,111,251,113,247,219,247,218,247,107,247,123,247,177,30,251,99,22,
+251,118,251,2,251,86,251,120,251,117,251,0,247,84,247,122,247,119,247,0,247,
+83,247,121,247,114,247,4,251,79,251,125,30,14,248,37,35,29,223,250,249,56,
+10,248,37,35,29,64,249,224,48,10,248,37,35,29,42,249,224,69,29,223,249,61,
+33,29,248,37,35,29,42,249,224,66,29,248,37,35,29,42,249,224,69,29,247,36,
+249,75,36,29,248,37,35,29,42,249,224,69,29,83,249,53,45,29,248,37,35,29,251,
+209,254,101,72,29,247,112,28,7,29,51,10,248,37,35,29,251,19,249,224,65,10,
+248,37,35,29,251,19,28,4,124,66,10,248,37,35,29,42,28,4,167,54,29,248,37,
+35,29,63,28,4,115,63,10,79,248,22,33,29,248,37,35,29,63,28,4,115,248,239,
+10,248,37,35,29,63,28,4,115,248,245,10,248,37,35,29,50,250,40,83,29,248,37,
+35,29,50,250,40,227,10,249,19,248,215,33,29,248,37,35,29,50,250,40,227,10,
+248,160,247,190,50,29,248,37,35,29,251,0,250,153,39,10,248,37,35,29,251,0,
+250,153,248,236,10,248,37,35,29,251,209,250,153,43,10,248,37,35,29,251,209,
+250,153,248,227,10,248,37,35,29,251,168,250,241,45,29,248,37,35,29,251,209,
+254,101,72,29,14,248,37,35,29,251,23,254,142,72,10,248,37,35,29,50,250,40,
+227,10,249,24,28,248,114,72,10,248,37,148,29,248,37,148,29,248,37,150,10,
+249,135,250,202,39,10,248,20,250,151,248,176,21,247,172,79,7,99,119,119,99,
+30,251,232,6,99,119,159,179,31,79,251,172,199,6,179,159,159,179,30,247,232,
+6,179,159,119,99,31,248,68,247,38,21,248,41,251,185,247,189,251,247,252,22,
+251,186,251,192,252,42,252,63,247,186,251,179,248,4,248,15,247,179,247,200,
+248,46,30,251,118,113,21,252,63,136,251,71,251,86,251,152,27,251,172,142,
+251,42,247,154,248,20,26,248,25,247,48,247,132,247,164,30,247,192,136,247,
+39,251,132,136,252,50,8,14,248,137,249,17,4,247,22,6,252,22,160,247,155,251,
+176,248,21,27,248,20,247,152,247,188,248,10,160,31,247,25,243,251,25,6,248,
+7,116,251,150,247,187,252,22,27,252,26,251,147,251,184,252,10,117,31,251,
+22,6,28,4,205,33,21,247,211,10,249,243,243,247,157,10,14,248,23,28,5,123,
+249,66,21,248,35,251,154,247,214,252,36,252,35,251,154,251,214,252,35,252,
+33,247,154,251,214,248,35,248,36,247,154,247,214,248,33,30,251,117,247,48,
+21,79,98,77,37,35,251,7,251,72,247,48,251,33,27,251,36,98,96,71,84,31,247,
+211,149,247,40,247,144,247,180,27,247,144,247,38,251,84,251,154,178,31,149,
+251,58,21,251,224,137,251,40,251,160,251,189,27,251,150,251,37,247,95,247,
+162,102,31,188,160,208,227,247,3,247,35,247,64,251,50,247,38,27,247,12,193,
+211,215,190,31,14,248,37,88,29,202,248,233,33,29,249,141,249,128,28,5,127,
+21,248,25,29,247,239,247,138,247,133,247,214,199,31,183,6,247,147,247,83,
+247,64,247,175,247,94,33,247,112,251,199,251,39,251,4,77,67,68,31,223,251,
+0,251,28,189,251,50,27,248,68,253,103,21,251,216,251,32,251,172,251,187,251,
+182,247,13,29,247,129,141,21,247,86,76,247,68,251,4,247,22,30,197,183,218,
+186,234,27,247,31,237,251,5,251,97,251,89,41,251,22,251,38,126,127,139,140,
+127,31,152,140,152,152,26,14,248,81,247,21,249,24,21,252,18,247,130,251,187,
+248,58,248,37,247,158,247,234,248,3,248,33,251,156,247,193,252,41,30,252,
+205,6,122,121,162,153,137,31,120,247,35,5,37,252,97,241,6,158,247,36,5,153,
+141,155,162,158,27,247,181,6,251,103,251,15,251,59,251,115,251,176,26,249,
+40,249,10,21,247,135,138,247,79,251,157,251,226,26,251,186,251,32,251,192,
+251,187,251,162,251,42,247,160,247,190,247,166,247,21,247,138,247,90,247,
+0,30,14,248,202,46,29,14,248,202,46,29,251,30,250,249,33,29,248,202,46,29,
+251,145,249,224,50,29,248,202,46,29,61,28,4,115,36,29,248,202,46,29,251,170,
+250,241,45,29,248,202,46,29,251,211,254,101,72,29,14,248,171,249,175,219,
+21,251,182,251,82,248,125,29,247,76,247,191,247,195,150,31,116,222,5,252,
+44,251,183,248,122,10,247,210,251,201,248,38,228,242,155,168,215,31,110,205,
+230,123,211,27,247,31,221,191,240,220,31,89,204,5,69,71,72,104,64,27,106,
+108,145,151,109,31,247,67,247,22,246,247,107,247,135,26,248,59,251,112,247,
+83,251,99,251,85,251,129,251,93,252,79,251,139,239,251,87,247,35,251,11,30,
+129,103,99,134,97,27,248,131,248,240,21,251,100,60,251,70,251,5,251,0,30,
+32,247,10,53,247,85,247,66,26,247,241,227,247,58,246,246,222,251,56,251,234,
+30,14,248,219,28,6,74,22,247,152,251,1,7,137,113,251,33,139,30,120,137,128,
+129,121,27,252,33,248,17,247,129,6,145,152,127,133,141,31,155,251,1,5,239,
+247,234,39,6,123,33,5,132,137,128,127,131,27,251,129,247,232,247,238,6,149,
+147,131,129,141,31,164,251,17,5,247,8,247,123,253,72,72,6,196,61,37,174,251,
+17,27,251,226,251,45,251,124,251,176,251,187,247,53,251,118,247,220,247,17,
+239,174,197,217,31,71,7,115,248,128,21,251,122,83,251,78,251,119,251,113,
+84,247,78,247,126,247,121,192,247,76,247,119,247,111,199,251,72,251,129,30,
+14,249,122,28,7,22,251,250,21,251,17,248,93,10,28,6,176,46,7,79,73,85,114,
+37,251,87,108,224,251,249,27,252,44,251,152,251,212,252,35,252,15,247,150,
+251,234,248,73,247,177,247,57,247,58,247,88,31,249,211,7,194,130,245,143,
+192,151,8,28,250,64,247,235,10,251,14,131,5,51,248,176,7,253,176,249,190,
+21,251,113,49,78,251,41,251,153,251,95,247,105,248,29,248,94,29,247,5,184,
+128,79,247,2,30,14,28,5,141,28,9,133,249,66,21,248,33,251,136,247,216,252,
+41,251,132,251,74,251,3,251,64,251,1,30,247,64,251,2,251,74,247,3,251,129,
+27,252,44,251,132,248,122,10,247,140,251,201,248,38,247,127,247,74,247,3,
+247,64,247,2,31,251,67,247,2,247,76,251,0,247,131,27,248,37,247,138,247,214,
+248,33,31,28,250,239,137,21,251,216,251,12,251,172,251,187,251,182,251,12,
+248,125,29,247,10,247,168,247,189,247,178,247,16,251,164,251,226,30,250,184,
+22,251,216,251,12,251,172,251,187,251,188,251,4,247,182,247,208,247,165,224,
+247,223,247,220,247,178,247,16,251,164,251,226,30,14,240,250,193,250,175,
+21,247,147,251,119,240,251,134,251,127,251,128,38,251,147,251,84,247,60,32,
+247,31,119,30,251,81,115,251,64,36,251,128,26,251,138,247,126,251,48,247,
+183,247,165,247,141,247,49,247,137,247,128,251,61,227,251,83,178,30,247,34,
+164,247,57,239,247,86,26,252,105,247,144,21,247,23,247,12,58,251,59,251,35,
+39,251,16,251,44,251,47,40,247,16,247,35,247,60,247,5,219,247,34,31,28,251,
+55,4,251,83,40,247,23,247,68,247,57,247,18,247,19,247,55,247,46,247,26,34,
+251,79,251,61,251,8,251,30,251,63,31,14,251,210,249,80,28,5,136,21,247,45,
+251,40,199,251,49,251,45,251,45,79,251,45,251,8,247,1,75,229,127,30,251,14,
+125,251,4,77,251,34,26,251,39,247,44,45,247,81,247,69,247,54,233,247,39,247,
+34,251,2,192,251,16,162,30,232,154,246,199,247,9,26,251,197,247,43,21,224,
+217,90,39,53,74,65,40,39,74,213,225,240,213,187,231,31,253,115,4,251,16,74,
+217,245,238,221,215,245,239,227,76,251,4,38,63,56,251,3,31,14,251,63,248,
+98,250,136,21,251,80,251,53,57,251,67,251,43,247,2,75,247,3,124,31,251,43,
+125,251,5,46,251,46,26,251,67,247,51,251,6,247,125,247,110,247,65,247,7,247,
+66,247,45,251,5,229,251,45,157,30,247,6,157,247,2,206,247,37,26,247,54,251,
+48,234,251,85,30,57,4,227,206,67,251,1,41,79,61,44,251,0,94,236,227,237,208,
+213,223,31,252,87,4,247,3,222,47,251,6,33,61,37,251,8,251,12,65,247,0,240,
+247,0,222,236,247,3,31,14,248,105,115,29,163,248,196,250,44,21,247,80,225,
+251,57,251,51,251,64,42,251,15,251,3,91,31,251,145,248,40,247,120,69,7,251,
+5,78,119,104,30,251,37,233,6,247,86,189,247,29,247,38,247,105,26,247,112,
+251,69,247,86,251,205,251,205,251,69,251,86,251,112,251,105,247,29,251,38,
+247,86,89,30,45,251,37,7,104,78,159,247,5,31,69,251,120,248,40,247,145,6,
+251,3,187,42,247,15,247,64,26,247,51,225,247,57,247,80,30,14,248,129,28,5,
+229,249,68,21,248,25,251,205,247,222,252,35,252,34,251,211,251,216,252,33,
+252,31,247,211,251,216,248,32,248,33,247,209,247,216,248,33,30,251,33,137,
+21,251,209,251,148,251,152,251,209,251,208,251,150,247,152,247,209,247,212,
+247,148,247,152,247,212,247,209,247,148,251,154,251,210,137,30,252,66,149,
+21,219,145,72,199,57,27,59,77,79,59,57,201,70,219,221,206,208,221,133,31,
+14,188,250,199,248,162,21,247,197,251,72,247,73,248,16,10,180,29,247,215,
+7,139,247,0,121,213,247,216,247,86,247,103,247,213,30,251,97,111,247,89,29,
+251,204,249,94,251,47,21,247,75,251,9,247,11,251,29,35,42,63,139,30,200,87,
+7,251,56,92,5,99,231,253,72,7,124,127,130,123,138,30,75,131,5,91,247,216,
+187,7,60,147,5,123,140,126,148,154,26,247,75,7,139,209,128,187,247,103,247,
+18,247,19,247,85,30,251,26,121,21,251,19,72,251,10,251,38,84,86,158,139,30,
+248,59,7,139,208,176,206,247,14,202,32,251,19,30,14,251,228,249,85,250,214,
+21,247,76,251,9,247,9,251,29,36,41,63,139,30,200,86,7,251,54,92,5,98,231,
+253,70,7,125,127,128,122,137,30,76,131,5,92,247,215,186,7,60,147,5,122,141,
+127,150,153,26,247,74,7,139,211,129,186,247,103,247,17,247,19,247,85,30,251,
+26,120,21,251,19,74,251,11,251,40,86,84,160,139,30,248,58,7,139,206,176,207,
+247,15,202,32,251,19,30,14,188,75,29,124,250,54,33,29,188,75,29,251,88,249,
+214,43,10,188,250,147,251,121,21,249,91,7,35,39,5,253,2,7,51,126,107,67,30,
+251,26,248,17,10,199,69,247,13,247,68,195,221,247,48,30,191,249,117,126,10,
+188,28,4,121,248,89,21,241,251,7,7,247,171,125,251,48,247,70,251,90,27,251,
+52,251,32,251,19,139,31,241,58,7,251,142,61,5,72,247,33,251,179,251,64,37,
+247,64,253,144,7,114,121,123,114,137,30,41,126,5,60,248,133,218,7,251,12,
+152,5,114,141,118,155,164,26,247,197,7,139,238,120,213,247,195,247,64,247,
+79,247,183,159,30,251,99,241,21,252,97,247,144,6,139,236,200,241,247,58,219,
+251,29,251,68,155,30,143,37,21,251,95,131,53,251,72,251,107,27,55,67,171,
+139,31,247,243,7,14,188,191,10,247,84,29,254,88,247,45,29,188,249,186,251,
+59,21,222,199,46,247,21,5,247,70,219,240,247,66,247,124,26,186,29,180,29,
+247,197,7,139,247,0,120,213,187,185,144,148,182,30,247,68,248,126,21,251,
+36,91,251,28,39,66,30,251,6,247,53,55,77,242,251,36,5,132,113,110,135,108,
+27,55,57,171,139,31,248,38,29,14,188,249,13,53,21,57,6,90,133,91,110,84,251,
+25,98,217,251,0,27,251,26,66,75,251,13,108,31,221,6,188,145,184,168,194,247,
+26,182,61,247,0,27,247,25,213,204,247,12,170,31,248,78,248,230,126,10,188,
+250,197,248,144,21,248,195,29,251,39,251,19,139,30,247,74,7,247,117,247,13,
+247,5,247,21,184,186,131,118,163,30,209,251,64,5,139,157,129,168,201,192,
+194,201,247,43,251,31,186,251,112,251,244,61,251,230,35,30,28,250,158,7,114,
+121,125,114,135,247,222,29,247,197,7,139,245,248,189,10,30,251,97,110,21,
+251,105,37,248,51,29,249,85,7,139,245,200,242,247,80,235,251,70,251,103,30,
+14,188,155,250,211,21,247,60,28,250,138,6,200,10,247,197,7,248,81,29,186,
+29,247,94,247,190,242,251,190,247,211,248,49,29,251,66,251,60,7,249,234,253,
+91,247,89,10,188,191,10,249,4,248,49,29,28,250,50,247,45,29,248,39,28,5,149,
+248,234,21,247,177,251,42,247,21,248,16,10,241,59,7,251,122,69,5,64,247,11,
+253,134,7,251,101,186,251,13,247,55,247,142,248,100,248,114,155,247,238,26,
+247,47,37,247,30,251,34,52,33,93,39,93,169,85,172,127,30,247,74,221,5,203,
+118,154,80,83,251,183,252,189,73,252,121,26,252,3,247,153,251,24,247,149,
+111,30,251,189,7,200,10,247,190,7,248,38,166,247,160,247,161,247,207,26,253,
+50,247,101,21,139,245,200,242,247,80,207,251,30,251,53,251,97,251,7,251,155,
+251,242,119,30,14,247,93,247,121,247,128,21,247,114,29,247,10,135,234,193,
+218,27,198,183,120,112,182,31,252,46,7,200,10,247,221,7,114,197,213,121,239,
+27,247,146,247,106,247,103,247,214,247,197,251,72,247,91,251,103,248,216,
+29,253,9,7,153,106,104,148,100,27,247,190,248,207,21,248,80,10,251,17,251,
+88,251,57,56,74,166,175,82,30,14,248,94,249,64,250,136,21,248,167,29,31,180,
+29,247,215,7,139,247,0,121,213,247,142,247,65,247,18,247,98,205,30,247,28,
+251,93,247,119,10,248,76,219,7,251,3,155,251,195,248,79,247,167,247,242,248,
+69,29,117,129,126,25,251,65,251,114,5,247,129,101,251,53,247,29,251,75,27,
+247,78,252,150,247,89,29,128,250,139,249,32,21,247,82,65,247,62,251,129,251,
+52,251,61,251,69,139,30,247,44,248,48,10,28,251,127,7,114,121,124,114,136,
+248,61,29,142,119,154,164,26,247,27,7,247,199,247,80,247,225,247,164,248,
+4,26,253,20,253,100,21,249,175,7,139,247,18,247,33,242,247,80,157,251,0,251,
+59,251,135,251,38,251,109,251,181,251,93,30,14,251,39,248,129,250,69,21,251,
+158,251,49,251,39,251,167,127,31,139,161,253,155,74,251,90,30,247,63,6,182,
+247,15,133,247,254,139,26,106,176,247,18,96,232,27,247,125,247,69,247,36,
+248,38,247,176,251,66,247,48,251,114,31,87,39,21,247,50,247,22,251,53,251,
+180,251,180,251,27,69,40,251,78,55,247,46,247,144,247,135,189,247,50,247,
+58,31,14,252,116,247,217,246,21,251,64,36,51,251,57,132,31,139,153,252,101,
+97,251,11,30,247,3,6,167,213,135,247,109,139,26,119,163,221,113,199,27,247,
+44,247,7,226,247,133,247,62,251,5,233,251,37,31,106,79,21,241,224,42,251,
+64,251,65,51,97,75,251,13,84,231,247,43,247,38,172,234,247,0,31,14,167,250,
+179,248,132,21,247,150,251,42,247,96,251,140,182,30,247,136,7,158,166,159,
+157,141,30,247,1,149,5,217,252,134,61,7,247,3,129,5,157,137,164,119,120,26,
+251,133,7,251,140,98,251,41,251,97,251,154,26,251,155,247,45,251,94,247,136,
+98,30,251,199,7,120,114,117,121,137,30,251,3,130,5,62,248,134,216,7,251,1,
+148,5,121,141,112,161,158,26,247,199,7,247,136,180,247,46,247,99,247,150,
+26,251,99,22,251,75,75,251,53,251,19,83,30,249,179,7,247,15,84,207,251,56,
+251,72,26,252,17,252,36,21,251,15,195,71,247,55,247,73,26,247,74,203,247,
+58,247,19,192,30,14,252,2,249,71,250,207,21,247,46,41,247,15,251,53,165,30,
+247,38,7,150,157,151,150,141,30,210,145,5,185,251,216,93,7,212,133,5,150,
+137,156,127,128,26,251,37,7,251,54,115,42,251,15,251,49,26,251,50,239,251,
+13,247,51,114,30,251,76,7,127,122,126,128,138,30,66,248,192,10,128,140,121,
+152,151,26,247,76,7,247,51,164,239,247,16,247,47,26,251,27,22,251,2,98,42,
+56,106,30,248,115,7,219,106,183,41,251,0,26,251,139,251,132,21,59,172,94,
+237,247,1,26,247,1,181,238,222,171,30,14,248,27,28,5,135,248,130,21,247,191,
+251,64,247,111,251,150,63,68,114,139,30,248,56,57,7,251,156,59,5,72,247,47,
+251,165,7,139,70,164,63,251,152,251,64,251,111,251,191,251,193,247,64,251,
+110,247,150,214,211,164,139,30,251,209,7,120,115,117,120,137,30,251,2,130,
+5,62,248,133,216,7,33,148,5,120,141,111,161,158,26,247,209,7,139,210,114,
+215,247,150,247,64,247,110,247,193,30,251,95,22,251,105,35,251,101,251,27,
+49,94,176,139,30,249,150,7,139,182,175,229,247,29,243,251,100,251,105,30,
+252,201,252,21,21,139,96,102,49,251,27,32,247,101,247,105,247,105,246,247,
+100,247,27,229,182,103,139,30,14,248,34,247,177,248,135,21,247,69,180,247,
+95,247,117,212,30,130,199,5,251,199,101,251,57,251,110,251,149,26,251,163,
+247,38,251,114,248,62,111,30,252,65,247,82,248,65,7,248,64,167,247,56,247,
+114,247,163,26,247,177,50,247,120,251,242,251,151,55,251,60,251,209,30,252,
+99,7,251,189,174,79,247,92,247,92,26,248,183,197,21,247,66,150,247,97,247,
+42,247,44,203,251,62,251,159,251,129,54,251,62,251,184,110,30,14,251,175,
+249,153,251,19,105,10,251,175,249,153,250,242,105,10,247,47,249,2,114,21,
+247,237,247,107,247,183,247,181,247,150,59,247,91,251,140,251,80,251,26,251,
+183,251,195,31,251,214,7,251,37,195,251,3,247,45,247,142,26,247,185,246,172,
+170,200,168,130,76,180,30,139,149,247,91,251,50,251,119,39,251,95,251,142,
+251,254,247,94,251,110,247,242,30,247,245,248,216,21,251,111,53,251,64,251,
+72,71,30,247,214,7,247,185,198,247,62,211,227,186,63,251,142,30,14,219,74,
+29,14,251,218,249,104,28,5,82,21,247,73,251,8,205,251,143,30,251,211,87,6,
+219,247,83,29,69,134,5,86,247,242,192,7,51,247,252,10,247,120,7,138,145,193,
+135,173,27,247,85,138,247,47,227,247,74,26,251,31,137,21,251,34,50,74,251,
+31,141,30,113,94,145,135,27,248,23,7,139,182,140,163,247,62,205,69,251,11,
+30,14,251,5,140,29,251,5,140,29,229,74,29,120,249,231,33,29,229,74,29,251,
+92,249,135,43,10,229,250,230,250,85,21,247,13,10,251,114,251,60,36,247,60,
+253,147,180,10,248,17,248,1,29,252,90,86,21,242,251,118,247,153,7,248,144,
+29,247,208,10,100,69,150,133,27,247,173,7,14,229,174,247,152,21,247,76,251,
+11,6,119,123,248,50,29,248,174,227,7,251,27,241,10,247,11,247,193,242,251,
+193,247,51,7,137,149,221,133,192,27,247,189,137,247,130,247,39,247,194,248,
+222,10,253,250,251,76,7,249,238,248,231,247,84,10,14,229,250,10,248,19,21,
+222,199,44,247,25,5,247,32,209,231,247,19,247,80,248,222,10,254,216,180,10,
+248,17,7,137,149,221,133,192,27,211,138,207,148,202,156,8,247,11,248,55,21,
+251,15,102,52,74,83,30,36,247,37,55,77,236,251,27,92,122,86,131,79,140,25,
+100,69,150,133,27,249,25,247,179,29,14,247,129,28,4,229,250,85,21,248,50,
+10,252,23,247,35,29,123,118,112,112,137,30,33,131,5,51,248,175,227,7,251,
+28,248,93,10,248,17,7,137,150,221,133,192,27,247,189,137,247,129,247,39,247,
+194,26,251,105,136,21,247,208,10,100,70,150,132,27,249,25,7,139,205,141,178,
+247,152,241,251,9,251,91,30,14,248,127,28,5,227,250,85,21,248,50,10,252,83,
+48,6,219,134,5,168,137,155,116,119,26,252,247,7,251,107,179,251,31,247,28,
+247,116,26,248,83,248,95,119,144,247,196,30,247,66,142,251,4,225,251,27,27,
+52,46,84,42,114,144,116,151,121,31,157,116,158,128,139,26,247,87,214,5,167,
+136,172,97,85,251,114,252,172,79,252,73,26,252,4,247,171,251,1,247,153,117,
+30,252,14,180,10,248,5,174,7,247,218,247,211,237,247,245,31,251,105,136,21,
+251,166,251,71,69,251,128,122,122,139,140,121,30,249,37,247,179,29,14,247,
+216,249,185,248,150,21,247,189,247,130,247,37,247,194,247,195,251,70,247,
+2,252,23,31,247,151,10,252,197,7,147,103,100,144,100,27,247,114,29,247,13,
+219,190,229,201,184,135,124,185,30,252,70,180,10,248,15,7,135,180,187,137,
+195,27,251,37,249,138,21,248,144,29,247,208,10,96,101,141,144,105,31,14,248,
+254,178,29,251,196,247,125,21,230,29,199,134,163,27,247,148,247,34,247,6,
+247,45,31,251,52,133,21,251,35,59,85,251,42,30,117,69,148,248,46,10,248,178,
+248,177,248,206,10,247,151,10,254,216,180,10,248,17,7,137,149,221,133,192,
+27,247,33,138,247,20,171,235,207,247,191,252,106,24,152,119,122,118,118,137,
+251,10,127,24,51,248,162,227,7,251,19,164,252,39,249,10,248,16,248,159,247,
+24,159,5,248,70,29,251,84,251,154,5,247,190,136,251,70,247,1,252,20,27,247,
+244,252,52,247,84,10,14,196,219,248,150,21,247,46,34,251,46,39,247,46,251,
+60,6,248,0,10,40,131,5,51,248,148,227,7,251,27,241,10,247,60,248,80,239,252,
+80,244,231,7,247,226,247,115,247,31,247,200,247,195,251,62,247,2,252,23,31,
+252,72,51,6,247,1,247,182,29,252,253,251,46,7,247,236,249,36,21,139,182,141,
+177,247,153,241,251,9,251,91,251,129,251,25,34,251,111,30,47,6,14,196,250,
+213,249,162,21,239,251,24,7,142,164,141,165,167,151,138,151,151,26,247,20,
+239,251,32,6,247,92,96,251,42,216,251,166,27,252,53,51,6,244,131,5,164,137,
+152,116,119,26,251,28,251,35,39,247,35,251,7,251,35,39,247,35,253,21,7,119,
+126,116,114,137,30,47,131,5,51,248,93,227,7,251,6,147,5,114,141,127,162,159,
+26,248,17,7,137,148,208,133,184,27,247,88,137,247,58,228,203,247,73,8,252,
+185,248,126,21,139,195,141,171,247,56,229,75,251,5,175,30,252,14,6,237,252,
+117,21,106,79,150,134,27,247,47,248,4,7,94,251,7,43,86,251,21,141,8,247,191,
+247,234,21,112,137,113,136,116,30,252,28,247,7,248,32,6,140,126,139,126,126,
+26,14,250,174,28,8,35,247,189,164,10,251,91,6,133,119,115,135,114,27,41,89,
+199,247,55,31,248,208,247,152,241,251,152,247,140,58,7,56,251,109,39,86,5,
+247,192,137,251,52,247,1,251,238,27,252,77,51,6,247,3,248,9,29,41,131,5,51,
+248,121,227,7,251,14,147,5,113,141,126,162,159,26,248,17,7,137,148,213,133,
+187,27,247,135,137,247,92,247,14,172,247,143,8,236,253,60,6,251,54,199,71,
+247,30,223,214,165,159,184,30,121,185,234,111,241,248,180,10,28,251,1,249,
+41,21,251,129,251,16,32,251,85,141,30,104,76,150,133,27,249,25,7,139,199,
+141,173,247,127,231,251,9,251,91,30,14,227,174,250,199,21,247,72,254,58,247,
+138,29,221,247,93,29,227,247,176,237,251,176,199,243,10,79,251,72,7,249,205,
+252,196,247,65,10,227,174,247,95,21,247,72,77,247,138,29,201,247,176,237,
+251,176,233,247,93,29,213,243,10,254,56,251,72,7,249,205,248,120,247,65,10,
+237,248,206,252,82,21,247,120,10,248,3,7,247,208,247,133,248,34,247,215,248,
+61,26,247,73,48,247,79,251,121,251,52,251,32,46,34,45,30,247,57,247,159,29,
+249,223,28,5,166,21,251,174,251,92,251,156,251,174,251,155,30,249,230,7,247,
+13,227,247,18,247,2,247,10,27,247,22,159,251,52,251,4,31,14,229,220,250,85,
+21,251,194,247,130,251,39,247,189,141,30,192,221,145,141,149,31,252,17,247,
+235,10,251,27,131,5,51,248,174,227,7,251,0,247,5,29,247,15,147,5,227,252,
+126,7,252,23,251,70,251,2,251,195,31,247,105,136,21,247,91,241,247,9,247,
+153,177,205,137,139,30,253,25,7,133,69,128,100,27,251,107,137,251,29,246,
+247,129,26,14,248,217,28,6,61,249,66,21,247,218,251,143,247,64,251,110,66,
+88,118,119,77,30,231,7,247,144,10,47,7,159,78,88,160,65,27,251,109,251,144,
+251,64,251,218,251,193,247,144,251,87,247,109,213,194,162,157,196,31,47,247,
+128,10,231,7,121,196,195,116,212,27,247,110,247,143,247,87,247,193,31,251,
+123,22,251,146,47,251,50,251,56,59,106,158,174,84,30,249,99,7,173,194,172,
+158,219,27,247,56,231,251,122,251,76,31,253,11,251,250,21,104,84,106,120,
+59,27,251,56,45,247,50,247,146,247,76,233,247,122,247,56,219,172,120,105,
+194,31,14,167,131,10,167,248,100,251,117,21,247,190,49,6,248,141,10,248,132,
+247,232,10,229,247,61,242,251,61,250,225,111,10,251,69,251,190,7,247,190,
+247,139,159,10,247,103,250,218,252,82,21,247,232,10,247,150,7,247,254,247,
+191,167,244,225,26,247,29,52,191,51,138,30,45,138,66,87,60,26,115,146,112,
+154,111,30,247,80,153,149,130,144,126,138,121,25,58,251,12,251,17,251,44,
+251,22,30,250,55,111,10,251,29,7,251,19,45,251,40,41,57,83,8,251,2,7,247,
+9,224,247,27,233,244,216,8,251,23,248,100,29,7,247,56,248,207,159,10,212,
+28,5,74,28,5,119,21,204,79,199,251,8,251,136,251,64,251,81,251,127,30,251,
+5,7,143,100,108,160,98,27,252,2,135,251,107,251,103,251,222,26,251,164,247,
+47,251,112,247,144,231,247,9,191,175,215,30,252,18,7,118,122,123,117,137,
+30,251,17,130,5,60,248,132,216,7,38,150,5,117,141,120,153,162,26,28,5,139,
+7,247,86,172,225,227,184,30,143,135,247,68,251,15,148,131,8,153,143,217,160,
+223,26,252,228,28,251,16,21,125,94,59,114,247,148,29,194,28,5,63,251,232,
+21,209,94,200,72,30,251,58,251,56,5,59,176,106,217,247,72,26,250,181,111,
+10,251,25,7,251,166,247,33,251,9,247,152,247,11,200,205,202,30,252,217,248,
+101,159,10,90,28,4,199,251,232,21,209,94,200,71,30,251,58,251,56,5,49,170,
+129,231,247,99,26,250,195,7,247,105,251,42,247,60,251,129,251,132,251,39,
+251,60,251,105,251,107,247,41,251,56,247,128,214,207,158,169,194,30,253,121,
+7,251,136,247,30,251,74,247,143,247,11,201,205,202,30,252,206,28,5,88,21,
+251,52,80,251,27,251,31,251,25,77,247,27,247,52,247,52,196,247,29,247,32,
+247,27,200,251,29,251,52,30,14,249,6,250,76,133,21,248,81,29,186,29,233,111,
+10,252,6,248,100,29,248,132,247,232,10,250,246,4,248,80,10,35,248,51,29,251,
+82,162,159,10,248,53,118,10,247,248,28,6,137,251,205,21,227,51,176,123,141,
+30,251,50,251,68,5,251,3,84,247,31,247,47,31,28,5,107,7,194,35,251,15,176,
+251,119,27,252,126,251,113,252,3,251,246,252,115,247,170,251,128,248,66,230,
+227,168,209,210,31,251,34,7,251,141,247,36,251,44,247,99,247,96,219,223,211,
+30,253,15,248,127,21,80,72,57,96,47,27,251,171,251,91,247,80,248,58,248,64,
+247,110,247,89,247,191,241,194,104,96,184,31,14,248,53,28,4,201,63,21,94,
+222,251,174,251,51,5,119,175,129,183,188,247,41,10,47,159,62,186,81,30,251,
+50,49,183,58,247,82,246,5,105,200,222,120,247,0,248,4,10,59,77,156,170,93,
+31,247,121,250,32,247,49,29,248,254,248,55,252,21,21,247,207,247,3,5,77,202,
+239,104,247,39,248,4,10,44,68,163,183,92,31,247,131,222,5,248,18,247,26,247,
+50,247,22,247,18,26,228,100,212,251,6,30,47,142,67,87,48,26,123,141,121,144,
+120,30,247,39,6,143,132,142,131,130,26,69,62,62,251,243,251,13,30,251,134,
+56,5,124,171,131,177,181,247,41,10,70,150,79,165,89,30,251,159,46,5,249,153,
+250,109,247,49,29,252,212,248,148,146,21,247,14,7,147,122,103,149,111,27,
+76,65,54,100,100,31,247,1,85,7,251,57,92,5,99,235,252,62,7,124,126,128,124,
+138,30,73,134,5,92,247,225,187,7,51,247,252,29,247,237,7,187,185,184,167,
+181,27,173,160,124,121,156,31,14,251,243,251,155,21,247,4,7,146,122,103,149,
+111,27,76,65,61,103,100,31,239,85,7,251,57,96,5,102,235,252,27,7,125,126,
+129,124,138,30,73,135,5,96,247,225,183,7,51,142,5,123,140,127,149,153,26,
+247,209,7,182,185,184,166,182,27,172,160,125,122,156,31,14,252,206,248,148,
+28,4,227,194,10,251,210,28,6,90,194,10,251,187,43,29,178,249,11,33,29,251,
+187,43,29,239,247,242,48,10,251,187,43,29,187,247,242,65,10,251,187,43,29,
+217,249,77,54,29,251,187,43,29,251,34,248,171,43,10,251,187,43,29,251,59,
+254,207,247,110,29,251,187,43,29,251,187,254,195,72,29,14,251,187,43,29,251,
+187,254,195,72,29,248,17,28,5,213,83,29,251,187,43,29,251,173,254,193,57,
+29,251,187,248,199,185,10,247,109,250,131,186,10,14,251,187,206,10,251,179,
+251,64,37,247,64,251,214,188,10,247,214,247,93,241,251,93,247,44,247,137,
+29,251,187,43,29,85,251,67,36,29,251,187,129,248,85,21,158,36,247,78,174,
+5,251,142,188,10,247,179,7,248,72,223,118,243,252,51,58,5,247,74,7,165,10,
+251,246,7,14,251,187,206,10,253,218,7,251,168,216,251,89,247,167,221,247,
+2,200,215,211,94,170,98,155,30,251,62,251,54,5,47,192,133,247,110,229,26,
+249,101,247,137,29,251,187,206,10,28,251,123,247,250,10,130,5,62,248,148,
+218,7,251,27,146,5,114,141,121,157,164,26,250,146,247,137,29,251,172,249,
+181,215,21,251,62,107,172,247,15,98,31,107,234,66,178,73,158,8,247,104,171,
+247,38,224,247,88,26,247,72,251,55,247,26,251,131,251,61,34,66,93,70,30,251,
+19,7,219,223,247,0,186,235,27,247,31,234,67,251,24,251,55,251,12,58,251,77,
+31,57,64,151,6,219,130,246,89,185,251,10,8,251,14,186,204,43,247,92,27,181,
+162,149,154,183,31,14,120,194,22,248,236,107,29,252,77,6,247,153,247,103,
+247,110,247,96,247,117,26,247,35,251,33,247,23,251,133,251,61,251,4,60,100,
+77,30,251,20,7,207,207,247,7,198,244,27,247,62,183,49,45,251,109,251,43,251,
+36,251,188,251,131,31,14,240,249,177,249,44,21,251,56,130,251,22,38,26,251,
+102,179,55,247,143,221,247,3,200,215,211,93,170,98,155,30,251,57,251,54,5,
+105,166,131,201,239,243,148,247,37,247,81,26,247,142,29,28,250,225,206,7,
+247,15,247,52,140,250,236,5,247,181,29,14,251,165,248,19,251,201,21,250,140,
+7,165,10,28,250,225,206,7,14,251,165,249,27,247,192,21,251,156,248,43,6,165,
+10,28,250,225,206,7,247,15,247,52,5,248,145,247,156,7,14,251,187,248,167,
+10,249,91,214,10,251,74,223,7,14,252,212,248,131,249,212,21,179,43,248,63,
+220,29,251,1,194,7,14,251,187,250,85,251,224,21,211,93,170,98,155,30,251,
+61,251,54,5,46,192,133,247,110,229,26,249,250,214,10,251,70,7,251,168,217,
+251,89,247,166,221,247,3,200,215,30,14,252,46,249,10,248,222,21,182,109,158,
+112,148,30,251,2,42,5,79,171,135,247,23,193,26,248,158,220,29,32,7,251,57,
+190,251,10,247,70,192,212,175,185,30,14,251,187,248,167,10,28,5,84,247,121,
+10,254,205,247,44,29,251,187,248,167,10,250,13,7,247,169,61,247,90,251,164,
+55,251,3,78,61,69,184,107,180,124,30,247,62,247,52,5,232,86,145,251,107,47,
+26,253,152,247,44,29,251,193,249,130,205,10,14,251,146,249,177,205,10,251,
+8,251,180,36,29,251,28,249,104,28,4,211,21,76,251,128,251,7,103,251,5,34,
+91,86,25,248,136,10,253,91,188,10,248,212,7,201,209,233,201,220,152,251,62,
+253,18,24,239,6,247,60,249,11,190,125,159,108,158,117,25,219,247,95,6,116,
+151,95,153,80,143,199,247,116,24,14,251,179,249,242,251,238,21,221,59,174,
+125,143,30,251,80,251,27,5,79,169,119,215,247,85,26,248,150,247,76,10,252,
+150,7,251,148,211,251,193,247,197,247,11,196,196,205,30,14,252,34,249,23,
+252,82,21,218,7,39,146,5,114,141,121,157,164,26,249,148,247,76,10,254,41,
+247,184,10,251,13,132,5,60,7,14,251,125,249,249,249,161,21,195,7,251,183,
+247,105,247,177,203,251,180,31,247,5,162,244,192,247,21,26,247,54,251,16,
+195,251,94,30,251,239,87,6,208,247,83,29,70,134,5,86,247,223,192,7,69,247,
+252,10,247,172,7,141,168,141,167,247,219,251,96,252,23,247,210,27,179,175,
+154,140,151,31,251,185,248,241,21,251,24,58,97,251,40,30,118,97,140,136,27,
+247,228,200,7,247,59,206,81,34,31,14,114,250,185,22,215,7,251,70,135,221,
+233,114,31,108,247,7,104,214,247,200,10,252,74,247,86,29,248,64,247,79,10,
+251,5,174,174,251,21,247,105,27,188,165,162,141,162,31,251,253,249,97,21,
+251,40,47,247,212,29,212,73,251,6,31,14,247,125,37,29,159,249,188,33,29,247,
+125,37,29,220,248,163,48,10,247,125,37,29,168,248,163,65,10,247,125,37,29,
+198,249,254,54,29,247,125,37,29,251,53,249,92,43,10,247,125,37,29,206,28,
+250,230,83,29,247,125,37,29,251,53,28,250,242,72,29,14,247,125,37,29,251,
+53,28,250,242,72,29,247,120,28,7,101,83,29,247,125,37,29,251,39,28,250,244,
+57,29,247,125,247,113,10,251,83,235,251,203,30,252,170,51,6,245,131,5,168,
+135,155,118,119,26,252,154,251,99,32,247,99,252,103,7,248,0,10,33,131,5,51,
+248,148,227,7,251,3,241,10,248,103,231,7,248,148,251,244,253,21,248,154,27,
+200,195,170,141,157,31,252,86,250,125,21,251,111,251,17,72,251,120,30,37,
+248,193,6,233,141,5,247,150,145,242,33,251,65,26,14,247,125,120,250,33,248,
+88,29,253,81,7,248,0,10,33,131,5,51,248,145,248,117,10,248,103,247,209,10,
+247,202,29,141,7,247,118,182,118,247,1,251,110,97,5,247,76,91,251,70,207,
+251,155,27,252,170,51,6,245,247,182,29,251,171,7,247,99,247,212,21,233,6,
+247,108,246,70,251,17,168,31,252,82,53,5,241,251,175,21,107,75,141,133,27,
+247,61,7,248,90,226,5,251,86,127,251,16,75,251,108,27,14,247,125,247,113,
+10,251,85,235,251,201,30,252,173,51,6,247,1,131,5,168,135,153,118,119,26,
+28,251,133,7,247,156,10,133,247,25,247,48,26,249,31,7,139,186,143,182,30,
+248,144,251,236,253,25,248,152,27,198,197,170,141,157,31,252,88,250,125,21,
+251,111,251,17,68,251,118,107,69,141,139,30,248,197,233,7,247,150,240,39,
+251,65,31,14,114,28,4,114,4,198,229,247,12,217,247,85,27,247,85,247,55,40,
+251,107,251,104,251,95,251,44,251,190,31,94,120,142,131,27,50,140,7,138,138,
+139,139,30,109,248,121,251,184,252,149,248,193,27,191,169,151,154,192,31,
+231,7,138,122,123,138,124,27,252,2,247,28,247,233,237,251,134,31,247,172,
+194,247,57,247,59,247,110,26,247,245,251,176,230,251,147,251,39,251,82,87,
+63,251,12,30,14,247,13,247,8,22,249,103,107,29,252,173,6,248,89,248,45,247,
+101,247,153,247,137,26,247,131,251,103,247,52,251,220,134,30,251,50,137,251,
+64,89,251,19,63,8,251,33,7,228,247,22,247,11,187,247,46,27,247,96,247,44,
+251,7,251,41,251,165,251,79,251,134,252,92,252,22,31,14,248,76,250,211,248,
+103,21,251,155,180,251,129,248,5,223,229,176,217,208,73,201,98,153,30,251,
+90,251,27,5,77,175,124,247,14,247,42,247,54,157,247,86,247,44,26,167,138,
+165,138,164,30,247,60,10,28,249,250,189,29,28,5,117,7,248,155,29,247,29,251,
+7,251,76,135,31,135,251,71,132,251,62,251,14,26,14,32,248,64,250,138,21,176,
+29,14,32,249,133,248,78,21,251,217,248,208,6,176,29,249,27,247,217,7,14,247,
+60,249,210,250,32,21,251,13,62,43,251,101,88,106,141,141,116,30,248,31,237,
+7,247,94,232,72,251,7,31,251,116,254,32,21,247,206,29,248,83,173,7,247,10,
+247,13,251,21,251,78,218,31,251,138,244,213,251,62,247,84,27,201,187,157,
+152,173,31,229,7,134,120,107,139,124,27,251,9,82,247,85,247,65,65,31,86,247,
+15,62,247,5,251,15,165,8,247,43,247,62,239,247,99,247,113,251,62,198,251,
+215,31,251,21,184,6,141,167,157,152,163,141,247,17,147,24,247,87,10,14,249,
+169,28,4,172,133,21,231,7,252,39,247,188,248,111,246,252,36,31,247,49,178,
+247,38,227,247,107,26,247,162,251,64,233,251,172,30,252,117,51,6,235,248,
+9,29,43,131,5,51,248,94,227,7,42,147,5,113,141,127,162,159,26,248,103,7,142,
+180,143,177,248,88,251,174,253,25,248,77,27,193,190,164,141,155,31,249,6,
+247,195,164,10,251,164,6,122,176,245,104,247,5,248,180,10,254,155,249,84,
+21,251,111,251,4,68,251,98,30,111,81,141,134,27,248,197,223,7,247,124,232,
+41,251,67,31,14,196,250,185,250,184,21,239,251,175,7,121,186,110,177,102,
+169,8,248,3,239,254,59,39,201,138,171,6,247,56,241,99,65,191,31,252,48,39,
+248,86,6,142,120,141,120,118,26,248,83,10,34,247,209,10,247,202,29,156,138,
+156,137,155,30,14,247,195,28,5,119,28,4,244,21,223,114,243,55,98,127,90,98,
+30,59,188,248,141,29,251,62,252,54,110,247,3,90,247,1,251,78,184,25,202,10,
+27,247,232,104,251,189,251,82,236,31,251,105,252,162,5,245,6,247,66,248,70,
+5,98,186,205,114,235,248,163,10,231,7,251,62,82,207,231,106,31,247,126,248,
+215,248,174,10,252,156,251,159,247,140,29,14,114,149,250,111,21,63,7,207,
+182,127,119,167,31,184,107,147,85,154,81,170,251,7,174,64,247,21,100,8,251,
+17,108,251,7,71,251,35,26,251,91,247,54,74,247,142,30,248,74,219,6,51,147,
+5,112,141,131,147,160,26,249,129,7,152,155,158,158,140,30,227,145,5,219,252,
+64,59,7,227,133,5,159,138,154,122,124,26,251,203,7,137,124,113,139,114,27,
+251,62,94,206,247,40,94,31,116,213,116,220,65,186,8,163,101,87,155,66,27,
+90,113,116,137,116,31,247,253,253,97,21,247,40,231,188,247,72,157,176,139,
+137,158,30,252,11,71,7,251,97,66,205,247,6,31,14,114,250,185,250,35,21,215,
+7,141,116,113,162,90,27,251,105,104,251,23,251,3,104,31,123,88,124,82,100,
+98,8,100,104,84,112,39,27,73,247,216,6,171,217,131,184,143,30,219,252,64,
+59,7,186,135,215,147,107,26,253,150,7,106,63,147,92,135,30,59,248,74,7,247,
+142,247,54,205,247,90,247,36,251,7,206,251,17,170,31,230,165,192,189,170,
+223,147,161,145,164,145,161,8,233,164,143,221,247,70,27,251,253,253,45,21,
+251,7,66,74,251,97,30,71,248,10,6,141,158,176,139,157,27,247,72,231,90,251,
+39,31,14,252,36,249,75,28,5,52,21,184,7,140,124,122,153,107,27,251,31,117,
+61,72,116,31,129,108,129,105,113,115,8,115,117,103,123,74,27,96,247,86,6,
+159,190,134,168,141,30,187,251,170,91,7,169,137,189,144,119,26,252,98,7,120,
+89,143,109,137,30,91,247,177,7,247,54,244,179,247,10,226,65,179,57,158,31,
+198,154,174,169,159,190,144,152,143,154,143,152,8,195,155,142,189,247,8,27,
+251,127,252,35,21,70,92,100,251,26,30,95,247,116,6,140,151,163,139,151,27,
+247,9,199,110,51,31,14,114,250,211,249,201,21,251,94,252,245,133,153,133,
+155,133,157,25,101,247,5,105,208,247,200,10,252,88,247,86,29,248,71,247,79,
+10,163,59,164,51,226,95,251,26,252,42,24,239,6,247,17,248,15,5,137,156,158,
+138,159,27,188,206,161,162,168,31,215,7,72,133,91,142,100,165,247,125,249,
+82,24,252,125,35,21,251,40,49,247,212,29,210,73,251,6,31,14,247,119,28,4,
+233,22,227,7,33,147,5,108,143,127,248,168,29,151,162,170,143,30,245,147,5,
+227,252,158,7,251,242,251,58,251,0,251,157,251,90,248,118,29,251,193,247,
+78,10,247,242,248,11,27,196,188,135,139,31,252,107,7,248,124,29,251,0,131,
+5,51,7,247,43,249,99,21,139,69,137,96,251,143,48,208,247,107,247,67,217,239,
+247,167,30,241,6,14,89,134,22,99,10,94,139,4,99,10,248,104,28,5,214,241,248,
+122,29,44,73,251,9,27,251,156,81,247,118,247,71,31,249,4,6,141,158,139,163,
+154,26,247,165,251,1,247,73,251,146,35,50,99,85,69,30,223,251,186,7,251,142,
+251,54,74,251,71,251,24,247,7,90,247,17,108,31,251,21,105,88,251,69,248,143,
+29,63,7,247,244,29,247,69,247,78,27,183,6,252,11,149,247,79,251,47,247,135,
+27,247,31,247,7,195,210,247,7,31,251,97,248,132,21,252,51,6,247,88,149,230,
+247,14,247,27,27,247,28,182,251,10,251,47,31,254,52,247,6,21,233,212,205,
+247,97,30,187,251,211,85,6,251,72,47,170,247,20,31,14,249,160,28,7,18,248,
+20,29,252,127,6,118,133,165,152,31,248,135,247,199,7,247,145,10,248,131,6,
+153,147,166,164,30,248,47,247,116,29,254,132,6,251,242,251,58,251,3,251,144,
+251,77,248,118,29,251,216,247,78,10,248,10,248,11,27,245,252,133,6,111,116,
+122,117,30,33,131,5,51,7,247,43,249,120,21,251,5,6,251,143,48,208,247,94,
+247,56,217,240,247,167,31,208,6,160,151,115,123,31,14,251,152,249,136,247,
+189,21,247,25,34,211,251,35,204,30,251,64,217,84,180,231,26,219,192,196,247,
+4,203,202,115,116,168,30,155,251,37,5,246,247,134,6,157,98,39,168,251,13,
+27,251,128,251,25,251,7,251,74,251,15,221,73,247,42,68,31,247,49,63,231,104,
+251,7,26,57,72,66,251,9,59,78,163,248,148,10,122,180,247,11,111,247,17,27,
+247,135,247,40,247,6,247,93,31,14,252,153,248,145,251,174,21,219,72,182,46,
+177,30,251,4,187,102,162,195,247,85,29,65,192,100,236,96,31,241,93,199,117,
+70,248,34,10,251,55,6,129,166,216,118,220,248,203,10,252,191,248,125,250,
+87,21,218,72,182,47,178,30,251,5,186,102,162,194,26,188,174,172,213,180,180,
+125,127,157,30,151,51,5,207,247,37,6,149,112,74,158,61,27,251,46,53,69,251,
+1,66,193,100,237,96,31,241,92,199,118,72,26,89,96,92,63,86,98,156,155,112,
+30,125,246,5,69,251,56,6,129,166,219,118,219,27,247,51,233,211,247,13,31,
+14,251,173,38,29,117,250,236,33,29,251,173,38,29,117,250,236,117,29,251,73,
+247,196,43,10,251,173,38,29,156,249,211,51,10,251,173,38,29,156,28,4,154,
+199,10,177,248,221,43,10,251,173,38,29,251,95,250,140,43,10,251,173,38,29,
+251,115,252,226,72,29,14,251,173,38,29,251,115,252,226,248,216,10,28,6,70,
+43,10,251,173,38,29,251,101,252,224,57,29,251,173,38,29,251,22,252,199,60,
+10,251,173,249,125,247,189,21,247,183,252,111,100,247,119,199,29,31,251,183,
+248,117,178,251,128,247,82,10,252,168,6,251,48,227,59,247,68,247,13,229,205,
+200,231,61,160,127,147,30,251,56,251,36,5,67,94,172,227,31,247,146,7,123,
+180,180,120,237,247,218,10,252,203,248,125,250,87,21,247,67,251,201,115,247,
+29,247,85,29,31,251,67,247,204,163,251,34,248,34,10,251,211,6,46,197,91,247,
+6,218,197,178,176,194,89,152,131,143,30,32,53,5,92,110,159,192,31,247,44,
+7,129,166,165,128,203,248,203,10,251,173,249,125,251,125,21,248,166,7,247,
+179,252,111,98,247,127,26,219,195,196,247,2,205,200,117,114,168,30,155,251,
+37,248,57,10,251,23,251,9,251,72,31,251,185,248,115,180,251,126,26,57,72,
+62,251,9,59,78,167,248,148,10,120,180,247,10,106,247,17,27,247,15,235,174,
+192,207,31,251,199,7,51,96,106,67,30,251,56,247,36,5,125,133,63,116,47,26,
+80,229,71,247,13,247,68,225,219,247,48,30,14,251,173,38,29,155,247,198,36,
+29,251,173,135,248,119,21,158,36,247,218,201,5,247,33,71,222,100,251,0,247,
+82,10,251,164,6,122,180,247,10,104,247,17,248,48,29,227,92,201,66,189,31,
+247,94,178,118,243,251,223,74,5,251,46,212,88,179,227,199,29,54,178,81,212,
+88,31,14,251,173,249,125,247,189,21,247,25,34,210,251,34,203,30,251,65,217,
+84,180,231,199,29,251,15,221,78,247,41,63,31,247,49,59,232,106,251,7,247,
+82,10,251,164,6,247,96,187,252,132,247,221,248,20,10,251,30,247,191,177,80,
+31,135,153,161,137,156,247,218,10,251,170,249,128,247,191,21,35,6,108,251,
+66,5,112,96,78,109,59,27,251,7,74,213,220,247,11,245,161,247,44,230,31,247,
+45,230,218,205,247,29,26,247,65,251,22,229,251,122,251,12,48,110,121,96,30,
+131,251,134,5,246,6,161,247,35,5,162,168,192,163,203,27,247,2,191,84,61,51,
+96,116,251,33,59,31,251,37,57,251,46,51,251,56,26,251,85,247,34,52,247,131,
+247,17,247,12,174,156,180,30,14,252,5,249,107,28,5,127,172,29,253,4,248,114,
+28,6,93,21,172,105,167,57,251,53,51,251,3,251,32,158,30,236,253,77,155,251,
+7,124,108,80,113,25,251,9,203,5,139,90,123,83,26,106,173,114,222,247,53,227,
+247,2,247,32,119,30,43,249,77,124,247,8,153,168,197,165,25,247,8,76,5,139,
+189,154,194,26,14,252,1,249,111,28,5,127,21,194,86,186,251,17,251,142,251,
+27,251,78,251,125,170,30,247,37,28,251,143,164,251,85,116,88,49,96,25,251,
+72,246,5,139,63,112,47,26,251,115,7,247,231,10,231,61,160,127,147,30,251,
+56,251,35,5,67,96,171,227,31,137,247,34,5,133,162,166,137,167,27,247,140,
+247,27,247,78,247,125,108,31,251,35,28,4,113,115,247,85,161,186,229,184,248,
+121,29,95,250,156,247,22,10,251,197,28,5,246,172,29,252,5,249,107,28,5,127,
+248,19,29,247,39,28,251,114,5,154,98,96,147,92,27,251,15,251,3,38,251,14,
+34,223,51,247,17,247,54,231,202,236,184,31,209,63,184,63,139,26,239,180,103,
+203,91,233,55,217,25,150,212,122,236,131,212,251,25,250,175,24,116,247,85,
+162,186,227,184,247,70,34,24,139,215,164,231,26,252,17,28,249,192,21,251,
+6,131,90,73,63,27,73,103,184,211,202,188,176,202,180,182,125,116,178,31,14,
+251,7,248,143,28,5,236,21,251,69,251,33,251,23,251,70,251,66,247,24,251,42,
+247,22,251,32,31,251,35,251,115,251,72,251,127,38,251,97,8,251,39,59,247,
+3,6,113,72,123,76,81,26,251,56,230,59,247,8,231,228,202,224,163,133,164,123,
+165,30,251,71,75,5,105,155,107,175,175,26,197,154,201,164,204,30,248,1,6,
+247,126,247,84,247,39,247,126,247,55,251,33,247,37,251,28,247,32,31,232,247,
+47,206,247,41,247,22,26,247,80,251,39,204,251,22,30,247,89,28,251,116,21,
+251,38,251,5,251,18,251,77,30,251,153,6,228,247,75,247,45,247,96,247,26,247,
+93,8,239,251,0,222,35,35,26,251,218,249,241,21,247,1,197,232,220,233,190,
+46,70,30,140,36,93,251,10,71,251,17,8,45,241,62,239,243,26,14,120,250,115,
+248,32,10,40,215,247,17,26,247,31,240,233,247,56,247,17,188,104,135,145,30,
+151,133,156,123,141,126,167,248,197,29,251,5,172,251,47,27,251,163,251,94,
+251,42,251,135,251,101,247,39,59,247,60,59,31,247,41,67,247,101,63,251,57,
+26,251,44,251,19,57,251,66,251,19,68,176,141,132,30,125,145,121,162,137,155,
+110,247,124,24,251,19,251,255,6,139,247,35,71,247,114,248,21,247,47,247,95,
+247,99,30,14,251,103,249,195,247,175,21,247,96,251,117,187,251,42,198,30,
+68,168,44,180,231,26,229,215,208,247,19,188,174,129,133,162,30,133,161,149,
+131,141,27,185,116,137,251,25,141,129,8,247,2,247,136,6,161,61,45,166,251,
+19,27,251,109,251,62,251,5,251,70,251,91,247,123,82,247,36,75,31,208,111,
+236,94,51,26,40,47,74,251,32,41,80,169,142,135,30,87,159,145,247,64,143,26,
+251,12,251,164,6,137,145,247,9,83,247,70,27,247,203,247,25,247,46,247,46,
+31,14,110,40,10,251,20,28,5,144,33,29,110,40,10,251,20,28,5,144,117,29,251,
+73,247,196,43,10,110,40,10,50,28,4,119,51,10,110,40,10,50,28,5,210,199,10,
+177,248,221,43,10,110,40,10,251,201,28,5,48,43,10,110,40,10,251,221,253,58,
+72,29,14,110,40,10,251,221,253,58,248,216,10,28,7,214,43,10,110,40,10,251,
+207,253,56,57,29,110,40,10,251,150,253,31,60,10,110,249,53,4,158,251,0,248,
+28,214,146,136,5,247,31,29,247,35,63,247,113,248,87,10,247,44,61,233,251,
+33,216,30,247,190,196,118,247,1,252,90,51,5,251,72,209,41,214,247,16,247,
+1,10,251,31,204,57,232,77,31,14,110,116,29,157,129,172,127,30,251,35,247,
+187,208,251,226,247,178,27,237,235,248,115,10,251,20,40,247,111,231,36,31,
+138,151,152,139,153,27,248,87,10,31,14,114,250,114,248,42,21,251,21,6,104,
+251,124,135,123,121,116,125,133,25,137,133,63,94,251,19,27,251,63,251,14,
+225,247,39,247,56,247,114,219,247,42,217,31,247,62,229,247,52,247,12,247,
+117,26,247,124,251,89,242,251,156,251,48,251,7,108,100,47,30,127,251,211,
+5,247,9,6,178,247,88,5,181,145,208,179,247,29,27,247,52,236,61,251,25,251,
+27,251,1,59,251,78,53,31,251,139,251,7,251,48,251,1,251,111,26,251,93,247,
+44,251,65,248,13,247,113,247,37,215,139,30,14,196,250,114,248,32,21,251,8,
+6,107,251,114,136,123,123,116,126,133,25,137,134,70,94,251,6,27,251,46,251,
+2,225,247,39,246,224,210,236,198,31,248,116,239,251,194,6,193,172,190,176,
+182,184,8,247,56,239,50,6,169,196,158,206,220,26,247,124,251,69,242,251,130,
+251,32,35,108,100,56,30,129,251,211,5,244,6,174,247,88,5,181,144,201,179,
+247,16,27,247,36,226,61,251,25,47,94,73,57,79,31,252,177,39,248,6,6,70,102,
+79,102,89,98,8,251,93,39,247,1,6,101,80,118,71,55,26,251,93,247,29,251,65,
+247,231,247,91,247,22,215,139,30,14,196,247,209,22,216,7,177,130,183,133,
+190,136,8,80,7,138,231,140,139,30,196,7,187,183,143,146,180,31,71,230,230,
+7,247,77,200,227,247,25,247,19,26,247,97,251,9,247,20,251,170,209,30,251,
+83,187,36,205,247,17,26,247,31,247,2,242,247,58,29,251,100,251,50,251,135,
+251,101,247,73,251,5,247,54,103,31,247,144,83,247,7,75,251,57,26,82,115,72,
+76,91,30,247,14,7,202,103,208,55,97,94,113,110,110,30,170,124,95,163,93,27,
+97,107,122,108,105,31,175,123,90,151,110,27,49,97,75,62,66,167,63,246,90,
+31,33,7,138,230,140,139,30,247,117,247,223,21,154,164,150,150,166,27,193,
+155,102,82,31,251,10,7,128,102,95,132,87,27,251,117,247,96,21,150,157,154,
+154,170,27,189,158,103,87,31,251,32,7,87,143,95,146,102,148,8,251,60,247,
+44,21,181,158,153,154,166,155,117,105,30,251,9,7,82,172,119,182,180,26,14,
+253,0,248,98,252,70,21,188,247,47,29,234,223,180,139,30,14,253,17,248,85,
+249,191,247,3,10,251,245,28,4,162,247,3,10,252,36,52,29,28,5,253,4,124,29,
+14,252,36,52,29,251,101,28,5,253,43,10,252,36,52,29,160,252,181,51,10,252,
+36,52,29,68,251,240,247,110,29,252,36,52,29,251,91,251,228,72,29,14,252,36,
+52,29,251,77,251,226,57,29,252,36,52,29,181,28,5,51,81,29,252,36,52,29,61,
+251,201,60,10,252,36,249,62,251,125,21,247,250,247,219,10,247,12,10,247,2,
+201,168,139,30,251,140,7,51,98,106,67,30,251,58,247,36,5,127,133,63,116,47,
+26,80,227,71,247,15,247,68,223,219,247,48,30,14,253,24,248,84,249,25,21,247,
+107,247,47,29,210,180,156,139,30,251,40,7,86,112,119,92,30,251,0,225,5,132,
+136,89,125,84,26,103,196,99,219,247,7,193,187,232,30,14,252,36,249,62,182,
+21,247,70,29,247,34,247,181,242,251,181,247,219,247,225,29,251,219,251,23,
+36,247,23,251,142,7,251,54,205,71,247,46,248,126,10,30,14,252,36,52,29,95,
+248,196,36,29,252,36,71,35,21,223,81,247,67,247,186,5,251,2,158,206,92,247,
+21,27,248,126,10,31,247,70,29,247,22,7,248,90,249,142,52,196,251,56,251,167,
+5,251,95,247,140,49,6,248,14,10,252,198,7,247,83,248,198,21,247,35,6,251,
+35,251,133,5,14,252,36,249,125,28,5,104,21,205,80,198,251,9,251,199,63,251,
+127,251,148,30,251,23,73,5,72,247,23,247,208,29,248,126,10,30,221,247,219,
+10,247,58,7,247,17,165,241,199,170,30,247,80,251,27,5,154,143,218,162,220,
+26,14,252,36,249,21,252,33,21,221,7,139,76,100,59,251,1,84,202,247,56,30,
+250,136,247,181,241,251,181,247,140,51,7,47,251,109,251,34,73,5,72,247,23,
+254,245,7,251,53,205,67,247,45,247,40,247,23,211,139,30,14,252,36,249,103,
+247,136,21,239,61,196,45,71,92,121,106,80,30,248,171,247,225,29,253,62,7,
+251,4,251,11,51,251,44,90,251,12,225,100,24,182,243,204,247,9,219,237,8,61,
+178,221,100,247,2,27,247,66,246,247,5,247,48,31,45,120,21,70,81,57,53,72,
+106,206,247,5,131,30,176,194,184,159,199,27,198,172,115,77,31,14,251,72,249,
+104,28,4,211,21,73,251,140,5,251,173,247,2,10,247,146,7,251,71,253,51,5,239,
+6,247,71,249,51,5,247,27,241,251,0,6,205,247,140,5,14,249,156,248,8,247,34,
+10,253,42,28,250,47,229,10,28,4,118,96,21,219,80,10,7,14,247,217,28,5,86,
+247,138,21,243,61,217,37,251,56,57,251,25,251,44,102,30,251,4,205,93,247,
+35,247,52,26,247,130,247,3,247,140,10,251,32,213,251,72,251,154,251,119,251,
+73,251,236,41,159,51,178,65,31,78,100,94,100,78,27,116,88,162,247,55,31,248,
+208,247,140,241,251,140,247,12,10,247,4,225,217,219,192,30,197,72,215,91,
+225,115,8,124,49,129,47,63,26,225,6,215,151,239,10,247,117,28,4,225,247,189,
+21,247,183,252,111,100,247,119,26,219,192,196,247,5,203,202,115,116,168,30,
+155,251,35,5,246,247,134,6,157,98,38,168,251,13,27,251,127,251,25,251,7,251,
+74,31,251,183,248,117,178,251,128,26,57,71,62,251,8,59,77,169,166,98,30,115,
+247,66,5,34,251,97,6,131,123,119,135,112,27,251,1,115,207,247,55,31,248,208,
+247,90,241,251,90,247,12,10,208,205,162,161,188,30,121,190,246,112,247,2,
+247,218,10,221,28,4,154,28,5,127,21,194,87,186,251,19,251,139,251,30,251,
+78,251,125,170,30,151,36,5,251,172,247,2,10,247,187,7,247,15,254,81,163,251,
+82,117,86,49,96,25,251,73,245,5,139,64,248,188,10,247,25,247,76,247,126,110,
+30,251,39,28,4,137,114,247,85,162,248,47,29,247,25,28,4,135,247,242,29,253,
+107,247,140,49,7,247,31,10,248,134,248,183,196,10,251,19,250,13,249,220,21,
+247,39,253,194,251,39,247,170,7,251,40,251,18,251,3,251,45,251,66,26,251,
+116,247,24,251,80,247,209,247,31,247,7,191,188,231,30,247,9,7,81,51,45,108,
+44,27,251,121,59,247,35,247,79,247,26,181,247,33,247,8,247,23,31,14,252,36,
+249,21,174,21,206,251,23,249,60,7,247,54,73,207,251,45,251,40,251,23,71,139,
+30,57,7,139,203,174,219,247,0,194,80,251,56,30,252,208,251,180,37,247,180,
+251,140,230,7,231,247,109,5,14,48,247,64,10,248,109,219,7,247,90,29,48,247,
+64,10,214,247,204,29,247,90,29,247,63,248,234,247,179,21,248,236,247,92,247,
+149,29,254,9,251,161,223,6,248,196,10,247,92,252,219,6,221,10,14,247,116,
+247,247,29,247,2,253,152,6,126,129,123,115,137,30,52,133,5,59,249,43,247,
+204,29,247,8,10,252,6,6,116,129,158,151,31,249,138,247,2,247,149,29,6,14,
+247,23,58,29,14,251,191,249,161,28,5,133,21,247,88,253,135,251,88,217,7,157,
+247,7,5,152,140,149,147,151,27,247,83,253,59,6,127,130,125,121,138,30,53,
+134,5,86,247,253,192,7,54,247,252,10,249,59,247,82,7,151,147,131,126,142,
+31,157,251,7,5,14,42,250,99,249,103,21,247,156,254,74,251,156,247,4,7,164,
+247,35,5,150,141,147,147,147,27,247,120,253,132,6,119,124,116,111,137,30,
+42,131,5,59,248,97,219,7,45,241,10,249,132,247,115,7,248,194,29,14,247,23,
+58,29,251,17,249,208,54,29,196,250,194,249,213,247,197,10,254,43,6,247,143,
+29,250,43,248,79,29,243,248,78,21,239,254,112,39,7,14,247,23,58,29,251,237,
+249,46,43,10,247,23,58,29,251,17,28,249,243,51,10,247,23,58,29,251,9,28,250,
+184,83,29,247,23,58,29,251,237,28,250,196,72,29,14,247,23,58,29,251,223,28,
+250,198,57,29,247,23,58,29,251,116,28,250,223,60,10,247,23,247,105,10,252,
+138,251,179,35,247,179,252,163,247,123,29,248,163,247,179,243,251,179,248,
+138,248,81,10,14,196,250,194,250,171,247,197,10,252,181,6,248,153,29,41,7,
+248,153,29,251,146,7,247,143,29,248,8,248,98,10,236,248,98,10,248,62,248,
+79,29,14,247,23,221,247,34,10,247,32,252,121,247,168,29,152,29,14,247,23,
+28,4,170,250,171,21,247,219,254,37,7,251,46,251,3,251,4,251,60,251,13,215,
+90,199,188,190,184,182,178,31,251,31,247,8,151,234,180,184,210,145,25,247,
+126,152,29,14,247,23,159,29,28,251,92,6,247,156,10,131,247,25,247,48,26,14,
+248,79,28,5,189,247,242,29,253,77,247,179,247,185,7,157,151,125,118,143,31,
+168,251,44,5,247,13,247,179,248,166,10,6,247,205,29,247,98,29,249,50,248,
+153,196,10,247,92,28,4,187,28,4,204,21,247,39,28,251,144,251,39,247,253,7,
+251,88,251,45,251,15,251,90,251,189,26,251,167,247,108,251,230,248,95,247,
+101,247,30,204,184,211,30,247,24,7,83,62,251,32,76,251,55,27,251,166,251,
+97,247,141,247,193,247,121,195,247,100,247,49,247,43,31,14,247,23,171,247,
+219,21,251,219,28,4,137,247,219,251,11,7,111,251,84,5,118,137,124,125,121,
+27,251,187,28,4,109,6,248,57,29,247,23,147,5,227,252,191,51,7,247,23,247,
+71,29,28,251,147,251,185,7,121,127,153,160,135,31,110,247,84,5,14,247,23,
+159,29,28,251,145,6,117,121,120,114,137,30,251,22,131,5,51,247,9,7,247,118,
+245,248,170,10,244,248,144,6,251,23,247,182,10,14,248,62,159,29,254,48,206,
+29,248,222,249,190,28,4,250,21,247,150,29,254,85,251,219,247,11,6,248,16,
+29,247,87,28,251,145,6,248,124,29,251,28,131,5,51,7,249,164,251,26,248,40,
+29,243,248,144,6,224,29,250,251,7,14,248,33,28,5,150,22,227,7,251,3,247,182,
+10,248,66,7,247,126,251,68,208,251,29,44,251,31,76,80,41,30,248,156,247,119,
+7,160,153,122,119,141,31,166,251,76,5,247,4,247,217,254,138,251,217,247,5,
+248,128,29,247,119,254,255,6,247,160,10,248,115,7,183,219,219,184,208,27,
+247,52,188,94,251,22,31,252,29,248,176,10,51,7,14,248,17,28,5,117,248,80,
+21,247,193,251,128,247,71,251,101,45,251,39,73,80,38,30,248,107,247,91,7,
+157,154,122,119,143,31,165,251,76,5,247,5,247,217,254,78,251,217,247,4,248,
+128,29,247,88,254,255,6,117,121,120,114,137,30,251,0,131,5,51,248,138,227,
+7,38,147,5,115,141,120,158,161,26,248,167,7,182,219,229,184,209,27,247,109,
+247,17,251,21,251,77,251,80,100,251,64,251,109,121,31,50,7,247,134,247,111,
+238,248,4,31,14,251,231,249,115,248,172,10,80,143,5,124,140,125,150,154,26,
+248,164,85,7,251,55,91,5,97,233,252,47,7,124,107,81,117,84,27,45,105,191,
+226,31,248,35,85,7,251,55,91,5,97,232,251,225,7,251,30,208,78,247,7,217,228,
+192,171,185,30,69,7,14,251,218,249,115,249,164,202,29,251,99,28,4,135,202,
+29,208,37,10,247,193,28,5,129,56,10,208,37,10,247,34,250,252,48,10,208,37,
+10,229,250,252,65,10,208,37,10,229,28,5,152,66,10,208,37,10,247,12,28,5,195,
+54,29,208,37,10,247,33,28,5,143,36,29,208,37,10,247,33,28,5,143,63,10,79,
+248,22,33,29,208,37,10,247,20,28,4,176,83,29,208,37,10,247,20,28,4,176,248,
+237,29,208,37,10,247,1,28,5,33,60,29,248,32,248,132,33,29,208,37,10,247,1,
+28,5,33,60,29,247,173,247,107,50,29,208,37,10,247,1,28,5,33,60,29,248,71,
+248,198,54,29,208,37,10,247,1,28,5,33,248,236,10,208,37,10,168,28,5,90,89,
+29,14,208,37,10,80,28,5,121,45,29,208,37,10,247,12,252,138,51,10,208,37,10,
+247,33,80,29,208,37,10,247,1,247,18,10,208,37,10,39,70,10,208,250,246,190,
+29,247,133,251,226,72,10,208,28,5,213,108,29,194,29,14,208,250,246,22,219,
+7,49,147,5,115,141,118,158,163,26,247,212,247,27,241,251,27,248,93,57,7,251,
+142,61,5,69,247,34,251,201,252,56,248,93,57,7,251,144,61,5,69,247,35,251,
+201,251,35,37,247,35,251,38,7,251,123,244,38,247,68,247,13,247,31,225,193,
+209,30,251,7,7,247,68,4,115,90,50,104,55,27,251,37,86,223,247,37,31,246,248,
+56,7,14,251,218,249,115,248,96,10,82,146,5,123,126,151,153,31,247,83,225,
+200,53,247,167,86,7,251,56,91,5,99,231,251,79,251,164,247,167,86,7,251,56,
+91,5,99,233,251,79,45,78,233,53,7,251,32,207,80,247,6,217,229,190,172,184,
+30,69,7,247,17,4,125,109,81,98,84,27,45,104,190,225,31,203,247,164,7,14,247,
+122,47,10,14,247,122,47,10,252,18,247,211,33,29,247,122,47,10,252,133,177,
+50,29,247,122,47,10,251,214,247,225,36,29,247,122,47,10,252,158,247,203,45,
+29,247,122,47,10,252,199,28,250,153,72,29,14,249,8,28,6,118,248,45,29,60,
+247,118,247,101,31,249,45,248,31,10,251,2,42,103,76,62,30,238,55,7,251,142,
+59,5,69,247,36,253,56,7,115,90,50,92,247,95,10,246,247,52,216,234,247,44,
+30,251,11,226,247,32,86,247,42,27,248,0,29,31,251,97,248,161,247,45,10,14,
+226,250,187,184,10,14,251,220,249,76,28,5,123,21,87,6,135,85,5,125,138,127,
+126,123,27,252,209,89,6,191,251,42,5,185,225,248,82,6,154,110,163,85,89,26,
+52,83,107,45,30,252,69,90,6,191,251,43,5,185,224,247,252,6,247,43,204,204,
+244,212,82,221,104,181,31,215,6,14,248,85,28,5,135,184,10,28,251,87,199,21,
+80,86,90,78,79,194,86,196,201,192,190,201,200,86,188,77,31,252,0,4,78,88,
+88,78,79,194,88,198,199,192,190,199,200,86,190,77,31,14,153,250,164,248,175,
+21,247,101,251,8,247,156,251,95,77,82,94,73,96,172,104,139,30,247,76,6,209,
+94,190,251,17,49,26,251,142,251,7,251,94,251,53,251,30,251,41,204,247,50,
+30,249,58,55,7,251,142,61,5,69,247,35,252,181,7,251,143,247,89,46,247,78,
+247,189,247,66,247,155,247,193,30,14,252,11,249,61,250,232,21,247,18,64,247,
+50,251,24,98,102,112,100,113,161,118,139,30,247,11,6,185,112,172,64,85,26,
+251,42,64,251,13,35,49,42,178,233,30,248,43,84,7,251,54,92,5,97,232,251,219,
+7,251,42,247,20,83,247,13,247,85,247,5,247,50,247,72,30,14,141,247,1,248,
+33,21,253,199,247,104,219,7,112,245,89,247,43,120,247,56,8,69,198,205,105,
+181,27,247,13,247,29,227,193,209,31,251,9,247,227,219,7,39,248,92,29,250,
+5,251,82,253,216,7,115,90,50,102,248,138,29,251,83,252,221,7,128,139,129,
+140,128,30,14,163,250,175,248,99,21,247,62,42,247,56,72,216,30,248,66,29,
+190,47,207,251,3,251,168,26,251,203,251,34,251,23,251,25,251,19,251,39,247,
+23,247,203,247,142,206,247,29,190,231,30,248,62,10,72,62,43,251,56,251,62,
+26,251,140,247,45,251,132,247,228,247,214,247,62,247,132,247,140,30,14,251,
+251,249,68,250,187,21,239,78,238,94,186,30,147,130,144,149,151,27,221,147,
+5,180,251,95,7,174,84,182,73,251,57,26,251,79,47,59,53,55,44,219,247,79,247,
+41,185,221,171,194,30,251,92,98,6,221,131,5,149,145,129,131,131,31,94,92,
+75,40,39,26,251,42,240,251,35,247,111,247,101,247,2,247,35,247,42,30,14,163,
+28,4,122,248,91,21,242,34,7,113,247,26,65,247,11,85,202,248,66,29,187,53,
+201,36,147,251,132,8,252,183,6,147,247,110,200,247,17,187,225,8,248,62,10,
+84,76,66,251,11,113,251,26,8,35,36,234,6,251,137,142,247,45,251,127,247,225,
+27,247,210,247,62,247,127,247,137,143,31,252,128,252,25,21,251,12,251,29,
+247,8,247,165,123,31,248,182,6,251,165,124,251,25,251,8,251,17,27,14,251,
+41,250,41,248,169,10,251,181,87,7,215,134,5,158,138,149,125,127,26,252,71,
+7,251,28,95,32,251,76,251,77,100,238,247,36,30,248,71,7,151,148,153,158,140,
+30,215,144,5,191,251,231,87,7,210,248,91,29,252,103,7,251,85,244,39,247,112,
+247,114,247,12,230,247,94,30,248,103,7,151,148,153,158,140,30,14,196,250,
+248,250,31,21,248,153,10,252,155,7,251,49,87,251,5,251,111,251,113,90,244,
+247,57,30,248,155,247,237,29,252,191,248,1,10,248,191,7,147,148,151,157,30,
+14,251,239,249,116,28,5,49,21,187,251,133,91,7,171,137,191,142,121,26,251,
+203,7,45,105,71,251,34,251,36,107,202,238,30,247,203,7,159,191,134,171,141,
+30,187,251,180,91,7,168,137,188,142,121,26,251,225,7,251,32,233,70,247,69,
+247,74,238,202,247,38,30,247,225,7,144,145,146,151,30,14,247,254,32,10,121,
+248,167,56,10,247,254,32,10,251,69,247,142,48,10,247,254,32,10,251,121,247,
+142,65,10,247,254,32,10,251,121,248,190,66,10,247,254,32,10,251,91,248,233,
+54,29,247,254,32,10,251,70,248,181,36,29,247,254,32,10,251,70,248,181,63,
+10,79,248,22,33,29,247,254,32,10,251,83,247,214,83,29,247,254,32,10,251,83,
+247,214,248,237,29,247,254,32,10,251,102,248,71,60,29,248,32,248,132,33,29,
+247,254,32,10,251,102,248,71,60,29,247,173,247,107,50,29,247,254,32,10,251,
+102,248,71,60,29,248,71,248,198,54,29,247,254,32,10,251,102,248,71,248,236,
+10,247,254,32,10,251,182,248,128,89,29,14,247,254,32,10,252,14,248,159,45,
+29,247,254,32,10,251,91,28,249,12,51,10,247,254,32,10,251,70,28,250,84,145,
+10,247,254,32,10,251,102,28,249,225,247,29,29,247,254,32,10,252,55,28,249,
+221,72,29,14,247,254,32,10,251,180,28,249,180,72,10,247,254,28,5,129,249,
+48,21,243,251,60,248,97,247,184,29,247,11,147,5,227,252,81,248,104,10,252,
+97,253,76,248,97,247,124,10,252,97,251,58,35,247,58,251,105,247,237,10,247,
+105,7,251,13,251,52,21,251,119,72,251,69,251,175,251,177,78,247,56,247,132,
+30,247,52,249,76,7,14,196,28,4,111,248,94,21,233,251,30,247,219,7,147,148,
+151,157,30,239,147,5,248,153,10,251,219,252,177,247,219,247,237,29,251,219,
+251,23,45,247,23,251,26,248,1,10,247,26,7,252,21,252,4,21,251,113,90,244,
+247,57,31,237,248,177,41,7,251,49,87,251,5,251,111,30,14,248,233,41,10,14,
+248,233,41,10,252,253,247,190,33,29,248,233,41,10,253,112,156,50,29,248,233,
+41,10,252,193,247,204,36,29,248,233,41,10,253,137,247,182,45,29,248,233,41,
+10,253,178,28,248,244,72,29,14,247,242,28,5,86,249,134,21,247,182,251,80,
+247,255,251,112,60,46,86,47,75,201,92,139,30,247,109,6,213,75,239,251,37,
+251,113,26,252,11,251,121,251,134,251,126,251,80,251,56,247,13,247,136,30,
+250,29,252,1,55,7,247,7,247,181,10,253,191,7,251,226,247,167,251,17,247,82,
+248,105,247,107,247,249,248,66,30,14,247,160,247,112,251,17,21,243,103,247,
+49,248,120,247,21,251,248,5,247,48,6,248,95,28,5,17,247,57,29,251,238,254,
+132,251,39,248,49,247,171,249,239,32,172,251,125,253,101,251,44,248,64,247,
+56,29,247,171,253,153,5,14,249,191,174,29,247,248,28,251,106,106,251,2,82,
+51,111,110,248,4,29,200,169,187,189,30,177,176,215,247,9,204,247,158,247,
+192,28,4,209,24,14,177,248,206,252,82,21,247,120,10,247,146,7,248,215,28,
+5,47,247,10,161,5,248,199,10,156,116,132,123,25,252,67,254,110,5,250,249,
+247,159,29,14,247,195,28,5,39,249,19,21,247,132,251,21,247,133,59,244,30,
+125,159,145,162,159,141,247,38,151,24,231,251,253,7,195,251,21,247,12,251,
+33,252,38,26,252,64,251,76,251,74,251,93,251,92,251,75,247,74,248,64,247,
+255,247,11,247,72,194,247,21,30,251,250,47,6,247,35,127,160,137,145,116,125,
+119,25,59,34,251,19,251,133,251,132,26,251,232,247,103,251,224,248,43,248,
+44,247,105,247,224,247,232,30,14,126,85,29,14,252,29,249,76,223,21,187,251,
+125,91,7,199,136,153,137,149,126,133,127,25,251,56,252,21,251,40,248,21,248,
+9,10,247,107,252,173,5,225,6,247,125,248,173,5,14,252,27,249,70,28,5,47,225,
+29,251,110,28,6,166,225,29,126,85,29,82,248,164,36,29,126,85,29,251,190,28,
+251,92,72,29,14,126,250,76,251,121,21,247,211,252,38,49,247,190,247,80,29,
+247,3,28,4,112,223,10,14,247,56,250,177,250,226,248,180,29,251,76,252,204,
+247,87,29,247,154,249,188,180,247,17,169,247,194,10,248,140,249,166,106,21,
+248,38,28,4,141,183,247,16,166,207,247,246,10,251,80,72,251,23,251,43,88,
+30,251,215,254,90,252,19,250,185,133,151,149,248,24,10,248,113,28,250,237,
+5,14,251,5,250,87,248,206,29,251,251,59,7,231,131,5,162,153,117,118,131,31,
+251,144,253,21,251,23,248,1,5,223,182,205,214,247,28,26,247,4,251,5,205,251,
+5,251,0,47,47,48,107,147,122,145,121,30,196,251,52,5,135,98,111,139,112,27,
+110,80,164,135,196,132,209,146,25,247,90,252,171,5,247,26,6,247,250,250,17,
+5,252,95,80,21,50,104,84,92,104,30,139,70,247,58,170,26,182,167,164,189,179,
+172,93,99,30,14,126,247,81,251,13,21,234,101,247,3,247,234,207,251,75,5,247,
+25,6,247,250,250,19,247,1,151,5,247,151,29,251,144,253,21,51,247,137,247,
+102,249,25,42,175,251,62,252,158,55,247,129,241,29,247,97,252,192,5,14,248,
+144,247,212,10,251,82,253,15,251,128,249,146,247,15,29,247,147,253,186,66,
+251,88,104,94,103,103,247,168,10,217,247,66,161,207,247,193,250,82,24,14,
+251,13,248,11,247,69,21,249,190,248,48,10,28,251,127,7,200,10,247,137,7,248,
+107,250,85,247,1,151,5,219,251,250,59,7,231,133,161,137,155,116,129,119,25,
+14,248,244,85,29,248,211,248,66,71,29,14,28,4,205,85,29,248,211,248,66,248,
+248,29,28,7,58,85,29,248,211,248,66,248,248,10,126,250,187,22,219,7,251,5,
+151,251,221,250,19,5,251,26,6,251,250,254,19,251,1,127,5,59,247,251,219,7,
+47,145,116,141,125,162,147,159,25,247,144,249,21,247,121,253,21,248,71,29,
+252,29,249,76,249,165,21,187,7,65,146,251,105,248,173,5,52,6,251,125,252,
+173,68,132,5,91,247,125,187,7,80,143,124,140,129,153,145,151,25,247,55,248,
+20,247,41,252,20,145,125,128,127,125,138,25,74,135,5,91,7,14,221,28,4,133,
+249,173,21,247,8,72,242,251,15,69,33,251,19,251,46,34,30,53,251,19,35,247,
+64,5,247,15,65,41,247,5,251,19,27,251,23,93,251,25,251,23,104,148,67,139,
+31,202,6,182,149,125,247,15,247,1,27,216,191,57,82,173,31,247,26,251,116,
+67,251,0,5,92,69,133,59,117,26,38,214,51,247,44,247,27,215,247,1,231,30,137,
+247,5,118,157,80,235,82,234,24,196,225,5,245,211,206,247,9,236,27,233,151,
+251,21,102,149,31,207,6,139,151,247,5,178,26,252,156,253,3,21,98,110,96,86,
+96,110,184,182,184,195,219,161,174,30,160,102,194,55,96,26,14,231,28,4,143,
+248,206,29,252,8,59,7,241,131,162,137,145,119,131,124,25,251,181,252,234,
+251,161,248,234,133,154,147,159,166,141,25,239,147,5,219,252,105,59,7,247,
+17,127,248,15,253,228,251,0,251,117,5,126,114,133,109,110,26,47,199,251,7,
+247,47,247,48,207,247,35,232,161,134,157,131,158,30,121,180,251,13,247,160,
+139,26,247,255,249,138,5,252,34,28,251,135,21,100,117,80,94,96,110,200,176,
+153,141,154,145,151,30,149,162,193,247,0,139,26,139,188,251,5,147,121,30,
+145,127,143,124,125,26,14,251,216,249,140,28,5,47,21,188,251,136,90,7,207,
+135,153,137,143,127,135,130,25,251,80,251,250,251,69,247,250,135,148,146,
+151,157,141,25,202,143,5,188,251,197,90,7,221,133,247,140,252,146,67,251,
+25,5,131,123,135,122,121,26,83,178,70,239,242,182,225,194,153,137,152,133,
+149,30,126,164,61,247,51,139,26,247,130,248,93,5,251,152,253,68,21,116,125,
+102,110,110,121,176,162,147,141,147,143,147,30,145,152,174,204,139,26,139,
+170,72,145,128,30,141,131,143,131,131,26,14,52,248,188,247,83,21,248,156,
+36,251,5,247,123,251,19,27,58,81,251,71,91,91,139,108,174,31,173,157,247,
+17,193,27,230,247,88,252,95,251,86,149,31,139,57,251,88,251,24,26,251,24,
+181,47,196,196,171,247,15,244,244,102,247,97,139,30,198,247,76,247,185,248,
+75,247,90,26,251,50,6,251,115,251,37,251,171,65,251,114,30,14,252,77,248,
+0,251,237,176,10,252,77,248,0,250,24,176,10,247,160,79,29,14,251,101,250,
+2,248,169,10,251,157,87,7,213,133,151,137,149,126,135,129,25,251,117,252,
+241,251,126,248,243,137,147,144,152,148,141,25,217,145,5,191,251,210,87,7,
+218,127,247,196,253,160,5,241,6,247,190,249,158,5,14,159,250,222,248,206,
+29,251,236,59,7,237,131,5,149,145,127,135,137,31,251,160,253,68,251,171,249,
+72,5,143,137,146,147,141,27,243,147,5,219,252,46,59,7,238,127,248,13,254,
+44,5,247,29,6,248,2,250,42,5,14,247,160,79,29,251,56,248,195,36,29,247,160,
+79,29,252,41,28,249,235,72,29,14,247,160,28,5,63,28,5,6,21,247,117,29,251,
+238,254,132,251,17,247,243,240,247,139,248,174,10,223,114,243,55,98,125,90,
+98,30,59,190,248,141,29,94,251,2,251,80,248,164,247,56,29,247,195,253,220,
+251,227,253,207,5,245,6,247,171,249,74,247,8,251,218,5,247,48,6,248,95,28,
+5,17,5,14,247,32,250,147,250,136,248,180,29,251,46,252,114,247,87,29,247,
+124,249,98,179,247,17,170,247,194,10,250,68,79,29,249,127,28,251,16,21,248,
+239,29,28,6,84,79,29,249,127,28,251,16,21,248,247,10,28,8,248,79,29,249,127,
+28,251,16,21,74,10,28,4,192,22,248,247,10,247,160,28,5,63,22,227,7,251,12,
+160,252,105,28,5,18,5,251,48,6,252,97,28,250,240,251,9,116,5,51,248,42,227,
+7,251,5,149,121,141,125,162,145,155,25,247,238,250,132,247,250,254,136,5,
+127,143,133,114,125,27,251,13,129,5,51,7,14,233,28,4,154,219,21,57,151,119,
+141,141,141,131,158,25,252,49,249,252,5,251,28,6,252,49,254,15,248,21,10,
+247,208,249,44,247,217,253,48,248,127,10,248,43,7,14,247,162,28,5,66,28,5,
+14,21,219,252,67,59,7,247,11,133,164,137,145,117,131,126,25,251,226,252,223,
+251,201,248,223,131,154,149,159,169,141,25,247,7,145,5,219,252,177,59,7,247,
+38,129,248,72,253,213,251,17,251,114,5,125,115,133,110,110,26,49,206,49,247,
+73,247,72,217,247,11,229,160,134,159,129,155,30,119,180,251,32,247,155,139,
+26,248,54,249,125,5,252,94,254,248,21,100,112,106,88,87,107,176,174,153,143,
+153,145,152,30,151,159,201,246,139,26,139,194,251,1,149,121,30,145,124,146,
+127,125,26,14,248,144,47,29,14,85,250,158,28,5,49,21,187,251,125,91,7,200,
+136,154,137,147,126,135,127,25,251,15,252,19,251,46,248,97,5,44,6,251,63,
+252,97,251,3,248,19,135,152,148,151,154,141,25,202,142,5,187,251,184,91,7,
+212,132,247,63,252,173,5,234,6,247,67,248,96,247,49,252,96,5,234,6,247,74,
+248,173,5,14,248,144,47,29,251,245,248,150,33,29,248,144,47,29,252,104,247,
+125,50,29,248,144,47,29,251,206,247,125,51,10,248,144,47,29,251,217,248,54,
+39,10,248,144,47,29,252,170,248,54,43,10,248,144,47,29,252,41,248,111,89,
+29,14,248,144,47,29,252,199,28,251,92,72,29,14,249,195,28,7,104,28,4,133,
+21,201,75,206,43,251,80,251,3,251,77,251,88,77,30,251,108,253,66,224,10,247,
+160,249,205,217,247,133,184,173,198,161,25,247,74,41,5,186,178,158,186,186,
+26,14,90,250,157,28,5,47,21,188,251,123,90,7,198,137,5,155,148,125,126,247,
+191,29,152,135,149,153,154,27,202,141,5,188,251,185,90,7,213,133,247,62,252,
+173,5,235,6,247,66,248,95,247,50,252,95,5,233,6,247,75,248,173,5,206,253,
+157,21,187,251,123,91,7,198,135,5,155,148,125,127,247,191,29,153,135,149,
+151,154,27,202,143,5,187,251,185,91,7,213,131,247,62,252,172,5,235,6,247,
+66,248,96,247,50,252,96,5,233,6,247,75,248,172,5,14,248,144,28,6,47,22,219,
+7,251,5,151,251,154,250,19,5,251,37,6,251,162,253,146,251,134,249,146,5,251,
+37,6,251,173,254,19,34,127,5,59,247,251,219,7,45,145,116,141,127,162,145,
+159,25,247,80,249,17,247,130,253,148,5,247,37,6,247,157,249,148,247,62,253,
+17,145,117,124,118,117,137,25,43,133,5,59,7,14,248,66,249,47,249,70,21,251,
+133,7,251,82,126,251,83,251,52,251,42,80,247,77,247,113,247,105,223,247,111,
+247,83,171,30,213,7,251,156,140,251,118,251,104,251,219,26,251,118,222,251,
+165,247,213,247,92,209,247,40,217,159,30,61,156,209,251,40,247,92,27,247,
+213,219,247,165,247,118,142,31,143,247,219,251,122,247,104,251,156,138,8,
+65,7,247,83,107,223,251,111,251,105,26,251,113,80,251,77,251,42,251,52,126,
+247,83,247,82,30,247,133,7,14,247,162,28,5,14,248,48,21,247,178,251,74,247,
+206,252,62,252,68,251,76,251,206,251,178,251,118,247,6,251,103,247,93,247,
+29,247,19,211,247,46,174,30,251,44,170,247,19,65,247,31,27,247,93,247,4,247,
+101,247,120,31,251,92,130,21,251,49,79,251,42,33,251,60,122,247,52,184,30,
+247,48,193,145,247,7,26,235,79,194,88,88,77,78,53,30,251,19,193,139,251,48,
+26,92,116,251,48,251,52,251,2,81,247,38,247,53,247,132,247,28,247,167,247,
+164,247,169,247,25,251,165,251,134,30,14,249,191,49,10,14,247,35,28,4,207,
+248,169,10,251,164,87,7,223,131,153,138,146,127,137,128,25,251,40,252,210,
+251,106,249,38,5,36,6,251,101,253,19,251,50,248,191,136,150,143,151,152,140,
+25,218,147,5,191,251,197,87,7,216,124,247,109,253,157,5,236,6,247,109,249,
+61,247,115,253,61,5,236,6,247,96,249,157,5,14,248,92,28,5,252,248,206,29,
+251,246,59,7,247,4,129,5,149,146,129,133,137,31,251,67,253,23,251,148,249,
+129,5,251,31,6,251,142,253,109,251,78,249,3,5,149,137,143,145,145,27,246,
+149,5,219,252,30,59,7,236,123,247,160,254,40,5,247,23,6,247,154,249,163,247,
+158,253,163,5,247,26,6,247,144,250,40,5,14,249,191,49,10,252,118,248,183,
+33,29,249,191,49,10,252,233,247,158,50,29,249,191,49,10,252,79,247,158,51,
+10,249,191,49,10,252,90,248,87,39,10,249,191,49,10,253,43,248,87,43,10,249,
+191,49,10,253,53,28,249,237,72,29,14,250,202,28,5,169,106,21,247,84,249,176,
+208,247,179,229,247,160,222,140,25,247,56,251,18,5,197,172,193,181,215,26,
+211,59,187,42,251,26,64,97,46,72,30,67,39,116,40,81,251,107,8,92,251,67,33,
+252,100,139,26,233,10,247,234,28,251,145,5,14,196,28,4,112,248,95,29,251,
+143,51,7,216,127,152,137,146,118,137,121,25,87,252,2,5,251,84,6,48,248,143,
+5,45,6,47,252,143,5,251,81,6,81,248,2,136,157,143,160,150,141,25,212,151,
+5,227,251,173,51,7,210,115,200,252,31,5,251,24,39,247,40,6,157,251,7,5,251,
+58,39,247,73,6,230,252,221,5,228,6,243,248,221,5,247,88,6,245,252,221,5,229,
+6,224,248,221,5,247,70,239,251,56,6,156,247,7,5,247,39,239,251,25,6,197,248,
+31,5,251,199,252,131,21,247,51,6,123,251,7,5,251,14,6,251,148,247,7,21,247,
+11,6,160,251,7,5,251,53,6,251,104,247,7,21,247,47,6,118,251,7,5,251,8,6,248,
+125,39,21,228,6,100,251,168,5,252,160,247,168,21,222,6,95,251,135,5,247,112,
+249,173,21,181,251,127,5,55,6,14,87,62,29,14,87,62,29,14,252,43,249,51,248,
+172,10,66,149,251,89,247,157,247,71,247,102,211,150,5,187,251,131,91,7,196,
+133,150,138,143,125,133,132,25,251,8,251,29,34,247,29,134,147,145,152,151,
+140,25,186,145,5,187,251,185,91,7,218,128,247,72,251,139,251,82,251,120,63,
+129,5,91,247,145,187,7,73,144,127,140,136,153,146,146,25,247,22,247,49,247,
+7,251,49,144,131,134,126,126,138,25,95,134,5,91,7,14,252,52,249,46,249,164,
+130,29,251,122,28,4,135,130,29,87,62,29,247,154,77,10,87,62,29,192,28,5,33,
+43,10,87,250,148,251,128,21,247,208,78,29,247,228,251,107,7,45,104,108,96,
+30,251,54,247,27,5,127,131,61,116,56,26,77,196,51,235,247,87,225,223,247,
+41,30,14,87,249,220,248,91,21,242,251,107,7,247,152,247,223,247,6,10,247,
+115,251,223,5,251,85,36,247,123,6,251,168,251,251,247,42,10,248,76,219,7,
+251,3,155,251,138,247,251,5,14,87,248,246,248,175,21,171,29,247,136,251,227,
+5,215,35,164,63,82,26,81,104,54,251,46,108,76,144,142,102,30,157,66,5,133,
+182,220,128,177,27,247,126,218,247,45,229,229,110,207,46,247,29,31,14,87,
+250,148,251,211,21,248,35,78,29,202,7,247,87,219,248,205,10,248,205,62,29,
+250,30,68,10,14,28,4,166,62,29,250,30,28,5,45,248,248,29,247,117,28,5,20,
+251,175,21,195,74,186,88,30,251,23,251,89,5,42,101,178,247,87,77,31,251,7,
+248,4,248,105,249,142,5,251,105,6,251,221,252,168,44,247,199,5,247,52,90,
+76,229,251,31,27,251,67,251,19,59,251,1,84,207,92,190,31,247,21,247,86,5,
+238,175,113,251,87,201,31,247,11,252,15,252,105,253,141,5,247,105,6,247,219,
+248,170,232,251,191,5,251,50,188,204,39,247,31,27,247,67,247,16,217,247,0,
+31,14,251,130,249,230,253,10,136,10,251,130,249,230,248,251,136,10,247,94,
+61,29,14,247,94,61,29,14,247,94,61,29,247,113,65,29,247,94,61,29,151,28,6,
+177,43,10,247,94,250,206,249,42,21,242,251,210,7,248,0,248,137,247,24,159,
+5,247,28,29,247,209,252,133,5,251,171,36,247,215,6,252,36,252,185,247,32,
+29,248,162,227,7,251,19,164,251,243,248,185,5,14,247,76,28,4,236,28,5,6,21,
+247,28,29,248,9,252,220,252,48,252,201,247,171,10,247,196,252,114,5,213,251,
+9,176,60,80,26,87,103,251,6,251,38,93,85,143,143,94,30,157,66,5,132,188,216,
+129,187,27,247,172,192,247,80,243,223,70,247,13,68,247,3,31,251,240,248,181,
+248,16,248,159,5,14,247,94,28,4,254,247,209,29,128,10,229,7,247,117,246,248,
+170,10,14,250,2,61,29,28,4,130,73,29,14,28,6,18,61,29,28,4,130,22,248,247,
+10,128,59,29,14,252,27,249,77,28,5,49,21,187,251,129,91,7,202,136,153,137,
+149,126,133,127,25,251,50,251,255,251,46,247,255,248,9,10,247,119,252,172,
+119,85,91,42,95,99,25,251,17,192,5,108,115,127,117,111,26,102,174,106,202,
+183,178,156,168,171,30,195,191,187,245,156,178,247,148,248,211,24,14,128,
+59,29,247,11,248,150,56,10,128,36,10,251,108,247,125,50,29,128,36,10,77,247,
+125,51,10,128,59,29,251,0,248,93,86,29,128,36,10,98,248,164,36,29,128,36,
+10,85,247,197,83,29,128,59,29,85,247,197,83,29,128,59,29,66,248,54,39,10,
+128,36,10,251,174,248,54,43,10,128,36,10,251,45,248,111,89,29,14,128,36,10,
+251,133,248,142,45,29,128,36,10,251,193,28,249,204,72,29,14,128,247,227,29,
+88,251,18,5,252,17,6,90,247,18,241,29,203,251,57,5,251,19,36,247,59,6,247,
+136,253,5,247,53,29,247,175,249,70,24,247,59,242,251,17,6,207,247,57,5,252,
+160,251,160,21,247,191,6,251,43,252,11,5,14,200,28,5,37,28,4,133,21,201,75,
+206,43,251,52,251,33,251,136,251,41,86,30,251,117,253,11,251,126,248,232,
+248,191,10,217,252,89,61,7,247,5,127,247,240,254,19,109,49,75,251,54,71,72,
+248,133,10,77,193,84,235,209,198,168,188,188,30,225,225,205,247,68,163,205,
+247,214,250,12,24,225,247,128,184,178,190,161,247,74,41,24,186,178,158,186,
+186,26,14,128,137,29,132,121,132,123,132,123,25,150,97,97,146,100,27,251,
+106,64,251,28,37,251,18,225,64,236,247,33,201,236,247,95,226,31,185,118,190,
+110,201,100,185,220,24,83,176,82,172,83,164,248,37,250,101,24,253,97,28,251,
+10,21,78,140,113,183,202,26,210,189,213,247,4,174,174,135,130,177,30,67,251,
+61,94,67,73,140,8,14,202,247,174,10,253,9,251,132,249,17,247,243,10,247,224,
+254,3,5,251,201,7,120,119,117,110,137,30,251,21,129,5,55,248,185,223,7,251,
+23,149,5,110,141,119,161,158,26,247,244,7,247,250,249,222,5,14,202,247,174,
+10,252,244,251,132,248,252,247,243,10,247,200,253,169,5,251,196,39,247,230,
+251,191,6,120,119,117,108,137,30,251,21,129,5,55,248,167,223,7,251,23,149,
+5,110,141,118,161,158,26,247,191,247,249,239,251,228,7,247,240,249,175,5,
+14,128,250,189,22,219,7,251,5,151,251,240,250,17,170,229,182,247,3,206,206,
+25,247,85,51,5,186,178,158,176,186,26,201,85,196,43,69,80,108,90,90,30,53,
+53,96,251,17,112,74,252,29,254,83,24,32,127,5,59,248,1,219,7,43,145,116,141,
+125,162,147,159,25,247,136,248,240,247,129,252,240,248,71,29,247,119,28,5,
+23,247,76,21,195,71,204,88,30,248,5,10,251,246,250,2,5,247,46,75,70,221,251,
+32,247,188,29,184,180,106,251,27,192,31,139,170,61,176,47,30,247,81,29,31,
+14,247,119,249,82,28,4,236,21,247,39,7,251,83,251,59,5,247,1,82,72,197,251,
+9,247,188,29,177,175,114,47,182,31,251,108,251,80,5,251,39,7,247,152,247,
+118,151,109,156,100,156,96,25,247,81,29,195,71,204,88,31,248,5,10,251,232,
+249,221,5,14,124,123,29,14,124,123,29,247,168,77,10,186,250,205,22,219,7,
+47,145,5,119,141,124,151,158,26,249,129,7,158,154,151,159,248,102,10,160,
+155,127,120,31,251,234,7,98,119,88,125,94,130,8,247,146,251,7,251,150,7,45,
+147,94,176,219,26,247,98,10,247,79,87,247,0,149,152,139,141,151,30,251,90,
+247,7,247,119,7,188,158,188,159,178,160,8,251,222,7,120,123,127,118,137,30,
+57,133,5,59,7,14,124,250,146,251,211,21,248,35,129,10,59,188,7,247,115,197,
+248,205,10,124,126,29,252,35,248,202,29,14,123,250,150,248,206,29,252,73,
+59,7,177,133,164,135,134,123,134,128,25,57,251,67,66,251,28,68,251,4,8,107,
+159,130,173,192,26,247,206,247,186,29,251,232,7,251,5,209,78,219,112,30,49,
+251,15,48,43,35,35,248,74,10,247,99,247,12,29,249,189,7,151,149,158,164,30,
+251,117,253,181,21,252,83,6,188,194,193,202,202,230,8,138,148,148,139,148,
+27,212,242,187,182,217,31,216,4,109,75,86,120,81,27,110,6,199,237,206,247,
+16,216,247,53,8,14,247,78,41,29,14,96,250,156,248,206,29,251,242,59,7,237,
+127,5,154,141,129,135,135,31,251,138,251,253,251,115,247,255,134,147,139,
+145,156,141,25,231,145,5,221,252,44,59,7,238,123,247,203,252,130,5,251,180,
+7,130,129,125,120,30,251,0,133,5,59,248,97,219,7,251,7,145,5,123,130,153,
+148,31,247,203,7,247,218,248,109,5,14,247,78,41,29,251,221,247,154,50,29,
+247,78,41,29,251,67,247,154,51,10,247,78,41,29,251,46,248,193,36,29,247,78,
+41,29,251,59,247,226,83,29,247,78,41,29,252,31,248,83,43,10,247,78,41,29,
+251,246,248,171,45,29,247,78,41,29,252,31,28,249,233,72,29,14,247,78,28,4,
+198,250,101,21,242,251,76,7,247,5,247,78,247,3,159,5,248,44,10,49,251,41,
+5,252,69,6,56,247,47,247,243,29,240,251,74,5,251,72,36,247,129,6,247,127,
+252,60,211,29,247,129,248,29,5,252,94,22,247,208,6,251,58,251,169,5,14,247,
+78,237,10,247,232,252,253,5,251,217,35,248,14,252,36,6,247,143,10,248,36,
+248,15,243,251,234,7,248,11,249,1,5,14,247,78,248,95,28,4,211,21,247,37,71,
+67,166,251,33,27,251,37,251,19,63,251,70,73,192,74,198,189,182,157,182,178,
+31,52,247,38,5,172,162,166,155,190,27,178,165,104,139,31,247,234,253,70,211,
+29,248,9,249,62,248,69,10,153,118,129,119,25,251,168,252,165,5,14,247,78,
+28,4,127,28,4,242,21,248,69,10,154,118,128,119,25,251,181,252,216,251,209,
+248,222,130,155,140,248,41,10,248,90,253,200,120,101,5,159,81,83,151,86,27,
+251,106,44,251,14,251,18,251,18,216,44,247,28,247,31,220,242,247,86,245,31,
+173,121,176,117,181,113,185,230,24,102,163,102,161,102,159,8,252,0,251,166,
+21,67,104,185,211,210,192,203,247,11,183,184,133,122,190,31,251,56,53,87,
+73,72,27,14,247,221,58,10,14,247,221,58,10,151,248,173,56,10,247,221,58,10,
+251,107,248,111,119,29,247,221,58,10,251,53,247,220,83,29,247,221,58,10,251,
+72,248,77,39,10,247,142,109,29,247,142,109,10,247,110,65,29,247,142,249,116,
+247,93,21,247,243,7,209,167,207,174,187,169,8,248,101,29,51,248,140,227,247,
+21,29,93,114,68,108,70,116,8,248,26,251,15,252,54,7,138,132,132,139,133,27,
+251,2,80,192,10,247,48,70,247,49,164,167,143,146,169,30,251,204,7,14,247,
+142,28,5,3,247,209,29,236,10,251,12,90,192,10,247,68,70,247,29,247,213,10,
+51,206,7,247,118,245,248,170,10,14,247,142,113,29,252,144,248,202,10,14,247,
+142,28,5,13,28,5,10,21,223,252,197,51,7,164,136,197,134,139,26,167,137,145,
+113,132,124,251,2,251,133,44,251,84,49,251,53,8,58,151,97,188,247,2,26,248,
+59,243,29,252,96,7,251,87,246,59,247,19,117,30,251,16,251,88,251,15,251,37,
+251,43,251,29,8,252,56,244,7,247,183,247,117,247,21,209,30,248,64,247,35,
+10,252,245,6,210,220,223,247,9,240,247,65,247,5,153,247,44,211,227,193,8,
+247,23,4,78,106,251,0,93,51,119,216,247,36,224,247,67,234,247,104,8,14,249,
+8,28,4,128,22,177,90,7,92,77,165,160,126,31,124,163,131,183,227,26,247,50,
+7,248,44,155,247,70,247,18,247,208,26,247,85,7,247,70,174,206,247,17,30,164,
+49,7,251,78,70,92,251,208,252,14,46,47,251,200,126,31,249,23,7,220,149,189,
+154,162,30,172,166,179,155,192,27,188,175,252,217,103,188,6,186,189,120,107,
+164,31,161,115,139,104,46,26,253,23,7,251,199,153,47,231,248,13,26,247,208,
+70,186,251,78,30,49,114,6,247,17,174,72,251,70,31,251,85,7,251,207,247,69,
+251,18,248,43,122,30,251,50,7,55,131,88,123,120,30,104,112,102,125,83,27,
+90,101,6,14,247,142,250,25,22,219,7,41,247,254,10,247,66,7,247,217,243,242,
+247,121,31,247,33,7,239,167,167,239,30,208,67,7,251,40,54,94,251,111,251,
+148,112,69,251,117,31,248,133,247,155,10,252,133,7,251,117,113,210,247,147,
+247,111,54,184,251,40,31,67,70,6,239,167,111,39,31,251,33,7,251,120,242,35,
+247,217,30,251,66,7,124,125,124,117,138,30,40,133,5,59,7,14,252,136,248,195,
+249,164,21,247,79,67,7,125,40,5,127,137,125,123,126,27,251,160,6,248,1,248,
+117,5,190,252,130,251,66,209,7,151,229,5,150,141,149,155,154,27,247,123,6,
+251,244,252,107,5,75,7,14,251,42,76,29,249,89,28,5,129,33,29,251,42,76,29,
+249,128,250,252,51,10,251,42,76,29,248,164,28,5,33,43,10,251,42,76,29,249,
+136,251,197,83,29,251,42,76,29,248,164,70,10,251,42,28,4,205,251,226,21,223,
+61,162,127,147,30,251,85,251,27,5,96,113,169,234,31,248,174,247,132,29,246,
+7,157,247,42,5,157,143,156,248,82,10,249,82,251,142,7,251,41,217,69,247,86,
+247,13,203,213,200,30,14,252,118,249,184,248,221,21,189,88,153,131,144,30,
+251,17,58,5,111,122,157,196,31,247,214,67,7,124,42,5,127,138,124,122,127,
+27,251,160,6,248,0,248,119,5,189,252,129,251,66,209,7,151,229,5,149,141,150,
+248,114,29,248,93,251,42,7,50,189,97,247,19,217,181,183,176,30,14,251,42,
+250,1,251,142,21,248,195,247,132,29,244,7,159,247,44,5,155,141,158,166,159,
+27,247,248,6,252,178,253,162,5,251,1,249,82,251,121,7,44,102,109,98,30,251,
+84,247,27,5,126,133,62,114,55,26,78,202,65,247,13,247,87,225,209,247,41,30,
+14,251,42,250,1,22,247,68,29,247,140,247,249,5,247,100,242,251,28,6,247,133,
+247,237,247,195,10,251,123,251,225,5,251,88,36,247,17,6,251,132,251,238,5,
+251,1,7,14,251,42,250,1,22,247,201,251,3,248,161,10,117,110,120,27,252,49,
+6,247,99,247,189,5,129,161,194,133,168,27,247,25,215,243,247,11,168,31,57,
+6,92,133,89,90,86,27,123,94,139,143,124,31,247,169,248,29,248,97,10,155,141,
+158,166,159,27,247,248,6,251,101,251,193,5,147,119,67,143,113,27,251,25,65,
+35,251,11,108,31,221,6,186,145,184,188,195,27,151,202,139,137,152,31,251,
+146,252,0,5,251,1,7,14,251,42,250,42,247,160,21,219,73,205,57,251,58,251,
+2,251,13,251,87,85,30,251,45,6,248,197,249,183,5,225,253,138,251,183,244,
+7,159,247,42,5,157,141,158,248,82,10,247,242,7,127,59,132,51,141,43,8,228,
+6,141,208,143,238,153,235,8,247,15,6,247,25,247,42,247,7,247,45,31,40,135,
+21,51,57,61,251,11,30,56,6,247,15,173,205,240,247,9,27,173,172,116,104,31,
+14,252,118,248,238,250,70,21,187,96,178,85,32,67,67,251,9,104,30,40,6,248,
+0,248,118,5,190,252,129,251,66,208,7,152,229,5,149,140,151,248,114,29,247,
+120,7,131,91,135,86,140,82,8,197,6,140,180,142,198,148,197,8,219,6,225,237,
+208,231,31,74,136,21,87,86,92,62,30,85,6,213,161,182,199,215,27,161,160,125,
+118,31,14,251,42,209,247,1,21,251,1,249,38,7,154,115,145,107,104,26,65,110,
+53,97,99,30,205,6,242,225,193,247,7,233,26,174,132,171,123,166,30,247,91,
+29,251,42,209,247,1,21,251,1,248,143,7,247,21,207,65,251,137,31,243,248,53,
+247,91,29,251,42,249,228,250,27,21,247,114,10,201,7,247,58,247,89,252,105,
+247,242,10,251,108,248,50,179,251,6,31,14,251,133,247,216,252,143,21,247,
+158,247,18,247,97,247,33,247,64,26,247,19,43,230,251,92,78,98,135,131,104,
+30,248,21,248,159,5,232,7,82,251,6,57,121,65,27,251,27,55,232,247,39,247,
+30,229,233,231,166,180,128,123,167,31,251,50,7,123,164,172,120,184,27,190,
+199,180,209,247,15,251,10,211,251,72,251,149,251,27,251,77,251,71,251,61,
+247,2,251,56,247,140,146,147,139,140,147,31,251,237,252,101,5,251,1,7,173,
+247,0,247,2,150,229,27,247,26,195,85,67,36,55,66,251,78,251,2,31,14,251,15,
+250,27,22,247,179,251,7,7,111,251,68,5,128,137,131,131,128,27,252,82,6,248,
+238,249,197,5,217,253,171,251,144,247,5,7,166,247,36,5,149,141,147,145,147,
+27,248,44,6,252,236,253,197,5,61,7,14,221,73,10,249,206,28,7,17,33,29,221,
+73,10,249,245,28,5,248,51,10,221,73,10,249,25,28,6,177,43,10,221,73,10,249,
+253,251,197,83,29,221,73,10,249,25,70,10,221,250,96,249,68,21,242,251,95,
+7,247,210,248,125,247,185,29,251,202,252,117,5,251,163,36,247,96,6,252,21,
+252,234,5,49,250,142,247,238,29,248,14,248,220,5,14,221,219,229,21,49,249,
+221,7,156,117,148,100,96,26,65,114,48,88,82,30,205,6,247,6,243,192,247,10,
+239,26,178,131,176,123,171,30,253,136,247,88,10,221,219,229,21,49,248,206,
+7,247,90,247,27,251,35,251,169,31,243,248,160,253,143,247,88,10,221,250,211,
+28,5,0,21,247,107,29,228,7,247,99,247,208,252,82,247,242,10,252,8,248,66,
+146,251,10,31,14,75,248,213,32,21,247,131,244,247,48,247,6,247,43,26,227,
+69,224,251,89,44,66,120,117,81,30,248,90,248,213,5,231,7,57,251,112,50,108,
+251,44,27,251,28,84,234,237,247,11,209,189,196,185,187,125,91,171,31,160,
+251,3,5,247,10,247,112,6,171,47,55,154,50,27,251,45,251,67,45,251,81,251,
+52,242,251,24,247,128,205,200,146,149,193,31,252,113,252,239,5,39,7,222,247,
+46,247,97,212,247,21,27,247,12,179,101,88,73,65,51,251,12,80,31,14,241,204,
+29,112,125,29,112,125,29,252,38,249,34,249,157,21,247,22,251,23,247,14,251,
+54,30,247,150,247,158,5,221,252,171,251,117,208,7,152,233,5,150,140,150,154,
+153,27,247,202,6,251,159,251,163,175,105,5,144,146,152,148,170,27,222,247,
+4,59,251,15,40,60,251,11,251,18,97,101,152,157,105,31,97,247,6,5,146,129,
+116,142,129,27,86,112,100,105,79,234,61,247,73,247,85,247,44,247,16,247,41,
+31,14,112,127,10,251,35,28,5,209,54,29,112,213,29,251,58,251,14,251,113,251,
+85,74,83,247,245,29,31,252,78,7,251,48,225,60,247,68,247,13,229,206,201,231,
+61,159,127,145,30,251,56,251,35,5,67,96,172,229,31,247,197,7,90,211,244,102,
+247,35,27,248,158,29,112,213,29,53,101,45,75,67,31,247,1,57,251,15,247,5,
+251,82,27,251,13,251,19,69,251,17,251,80,247,19,71,247,168,223,217,168,169,
+211,31,172,88,157,102,139,26,223,191,125,161,124,166,121,171,25,247,31,225,
+231,247,32,247,41,26,252,31,251,209,21,112,94,88,108,84,27,59,251,64,170,
+247,5,194,190,180,196,247,7,243,49,47,215,31,14,36,250,48,251,130,21,195,
+98,204,57,122,105,135,127,122,30,76,251,83,5,109,85,82,118,74,27,65,51,195,
+212,31,247,140,248,226,112,247,202,26,247,154,251,187,104,92,30,247,205,247,
+230,247,24,10,252,44,252,70,156,104,5,139,247,8,176,213,219,247,41,127,61,
+30,251,93,252,209,127,251,177,26,251,50,247,19,37,247,97,247,168,247,40,247,
+23,239,30,14,125,250,146,251,130,21,195,99,204,56,123,104,135,127,123,30,
+75,251,83,5,108,86,81,119,74,27,251,85,251,14,247,91,247,56,247,97,247,64,
+247,25,247,21,186,158,124,131,150,31,195,196,252,46,248,87,5,248,113,6,160,
+154,115,120,142,31,160,251,48,5,245,248,11,253,203,251,29,6,248,33,252,80,
+5,251,142,251,94,251,115,251,109,251,140,247,128,251,79,247,188,247,168,247,
+40,247,23,239,31,14,72,250,88,249,175,21,247,50,251,98,198,251,113,30,252,
+55,252,66,248,18,251,169,5,251,142,251,76,251,44,251,109,251,169,247,163,
+251,20,247,193,247,50,247,65,172,247,4,220,67,168,109,31,251,27,251,37,5,
+127,97,100,135,90,27,251,66,251,43,247,32,247,85,247,74,247,89,231,247,110,
+31,218,220,252,76,247,210,247,162,247,167,5,190,213,121,115,176,31,251,67,
+248,119,10,251,119,249,159,249,144,21,247,25,10,251,35,37,251,33,251,159,
+251,26,31,33,7,205,167,203,169,199,172,8,236,138,241,93,251,30,26,251,50,
+251,61,251,71,251,207,251,43,30,33,7,247,251,247,43,247,212,247,110,247,138,
+26,247,16,251,5,231,251,40,168,30,247,36,240,236,247,13,247,43,26,14,252,
+171,251,97,251,90,21,247,252,205,247,226,247,56,247,133,26,247,7,58,226,251,
+45,174,30,247,1,209,214,227,247,5,26,247,50,251,46,214,251,66,137,30,251,
+0,138,251,6,108,48,80,8,60,7,224,187,227,165,213,140,8,243,140,214,89,251,
+0,26,251,30,251,4,251,11,251,194,41,30,66,7,239,166,242,173,233,179,8,241,
+126,204,90,251,11,26,251,46,251,62,251,44,251,201,63,30,14,247,47,121,10,
+14,234,250,235,248,47,21,247,168,251,62,247,29,251,180,30,248,31,248,39,5,
+247,39,254,39,248,43,10,248,158,6,252,48,252,51,203,67,5,150,151,184,157,
+182,27,247,31,247,36,90,251,152,251,101,251,34,251,14,251,84,44,57,164,185,
+78,31,95,248,37,29,247,42,251,60,247,209,247,214,247,171,247,20,247,208,31,
+14,59,250,70,219,21,247,90,251,100,247,55,251,123,30,248,24,248,76,5,245,
+253,160,251,216,233,7,157,247,36,5,156,140,158,162,156,27,248,102,6,252,38,
+252,85,190,88,5,147,149,159,152,181,27,247,12,247,79,39,251,79,251,42,251,
+38,251,77,251,69,79,89,164,165,90,31,80,247,66,5,149,125,107,144,123,27,63,
+103,80,87,48,247,28,251,13,247,146,247,166,247,131,247,82,247,119,31,14,247,
+47,121,10,251,121,28,6,228,54,29,247,49,28,4,170,251,66,21,211,94,221,45,
+118,100,132,125,121,30,65,251,134,5,103,78,77,104,64,27,251,114,251,74,247,
+133,247,109,247,181,247,126,247,11,247,41,192,164,121,128,151,31,203,211,
+252,138,249,5,5,248,218,6,161,162,106,116,141,31,161,251,92,5,247,9,248,86,
+254,99,251,39,6,248,121,252,249,5,251,180,251,152,251,139,251,168,251,208,
+247,191,251,136,247,234,247,209,247,62,247,60,247,19,31,14,156,250,132,28,
+4,166,21,247,50,251,98,198,251,113,30,252,95,252,74,248,28,251,129,5,251,
+142,251,76,251,34,251,109,251,169,247,133,251,20,247,193,247,124,247,71,247,
+5,247,4,220,82,186,64,141,31,251,13,251,112,5,120,96,67,127,90,27,251,66,
+251,33,247,22,247,85,247,74,247,79,211,247,110,31,218,247,3,252,26,247,150,
+247,172,247,175,5,183,180,121,115,176,31,251,87,7,139,184,129,168,205,210,
+208,206,30,14,134,250,89,250,189,21,247,2,29,251,90,251,148,251,53,251,137,
+48,31,251,13,7,239,175,229,177,219,177,8,247,23,134,247,18,56,251,61,26,251,
+120,251,222,251,86,251,223,33,30,251,13,7,248,68,247,8,248,80,247,141,247,
+195,26,247,61,251,22,247,12,251,68,178,30,247,68,247,4,233,247,18,247,52,
+26,14,101,246,250,226,21,234,247,16,247,33,193,247,5,27,247,15,230,75,251,
+36,251,95,251,45,251,52,252,28,251,35,31,36,7,247,16,178,247,20,186,247,6,
+196,8,247,21,120,241,69,251,62,26,251,117,251,171,251,114,252,28,35,30,44,
+7,248,83,228,248,77,247,130,247,242,26,247,62,47,247,7,251,87,180,30,247,
+27,239,231,247,20,247,62,26,247,105,251,55,236,251,85,251,43,251,61,80,251,
+1,251,14,30,14,251,34,215,29,252,148,247,154,10,248,130,248,120,29,252,111,
+248,215,28,5,119,21,247,25,251,22,225,251,48,251,38,33,55,80,104,158,104,
+192,172,163,158,139,30,176,247,8,5,156,164,175,145,166,27,211,141,216,69,
+251,0,26,251,13,251,10,69,55,112,30,251,199,7,129,120,127,127,137,30,71,132,
+5,92,247,212,186,7,69,146,5,129,141,121,151,149,26,247,187,7,212,170,247,
+33,194,247,48,26,14,251,195,249,103,249,93,21,247,70,251,15,247,13,251,142,
+251,70,37,34,61,78,198,102,196,143,164,141,139,30,207,247,68,5,154,157,172,
+141,157,27,247,3,202,55,251,21,251,42,39,61,251,27,107,31,251,226,7,116,118,
+129,125,30,35,133,5,59,248,102,219,7,35,145,5,125,118,149,162,31,247,199,
+7,247,27,186,247,1,205,247,66,26,14,251,23,250,9,250,148,21,247,115,251,87,
+247,54,251,133,251,116,251,37,251,27,248,63,29,165,176,180,150,180,27,247,
+2,141,246,34,251,72,26,251,95,251,83,251,0,251,21,96,30,252,169,7,121,113,
+118,120,137,30,35,131,5,51,248,146,227,7,251,1,147,5,121,141,112,160,157,
+26,248,136,7,247,5,190,247,107,215,247,152,26,14,251,34,215,29,251,3,251,
+161,33,247,161,251,187,247,154,10,247,187,247,154,245,251,154,232,248,120,
+29,251,34,247,85,10,252,130,247,155,29,248,148,247,24,29,252,101,191,28,5,
+99,21,251,28,247,23,64,212,128,30,251,187,7,129,121,127,129,137,30,69,132,
+5,92,247,212,186,7,71,146,5,127,141,120,151,149,26,247,199,7,55,166,251,0,
+219,247,13,26,247,0,206,207,211,166,165,133,122,164,30,176,33,5,139,163,120,
+172,192,158,174,174,198,43,213,251,38,251,48,251,12,43,251,45,30,14,252,111,
+248,205,28,5,215,21,198,43,213,251,35,251,50,251,13,53,251,25,251,48,247,
+23,74,213,108,30,251,187,7,129,123,127,126,137,30,70,132,5,92,247,211,186,
+7,72,146,5,126,141,123,151,149,26,247,199,7,55,166,251,3,219,247,13,26,247,
+0,209,209,211,137,30,165,166,133,122,161,31,176,33,5,139,166,120,170,192,
+157,174,174,30,14,251,34,247,85,10,46,251,154,33,247,154,251,187,247,155,
+29,247,187,247,160,245,251,160,247,3,247,24,29,251,34,248,61,10,248,129,247,
+152,10,252,148,219,10,251,34,248,61,10,231,247,154,243,251,154,247,189,247,
+152,10,251,189,251,161,35,247,161,251,3,219,10,251,53,248,128,248,185,21,
+243,207,87,247,34,207,194,8,239,220,247,24,159,247,100,26,247,33,251,66,247,
+164,29,235,46,251,1,251,49,251,18,134,66,81,31,73,87,187,251,37,53,91,8,251,
+33,60,251,4,82,251,84,26,251,89,247,128,251,32,247,102,247,116,241,244,235,
+248,84,10,251,47,251,50,226,247,55,247,19,229,158,247,6,214,31,14,247,111,
+249,52,250,71,21,251,39,251,133,251,69,251,29,34,247,32,251,65,247,61,251,
+31,31,50,251,12,251,11,78,104,43,189,247,69,32,27,61,96,99,78,47,231,66,244,
+231,247,55,221,247,3,247,47,31,251,4,247,41,247,52,56,235,27,247,40,200,247,
+4,199,195,110,179,59,31,251,16,212,251,39,38,27,98,40,208,228,36,31,247,57,
+247,28,247,26,247,30,244,26,247,29,251,134,247,69,251,39,30,14,251,89,248,
+97,28,5,65,21,38,251,58,38,61,79,236,40,247,8,60,31,88,56,58,104,115,73,173,
+240,66,27,85,110,116,104,87,202,97,211,202,247,4,186,202,245,31,75,241,247,
+2,92,205,27,241,180,203,173,171,119,162,84,31,54,189,55,70,27,111,71,178,
+190,69,31,247,5,217,230,218,199,26,217,251,57,240,38,30,14,249,34,28,6,119,
+243,21,251,2,48,180,204,76,31,182,225,163,239,226,26,247,21,78,184,71,75,
+75,90,251,17,46,154,35,184,54,30,96,94,85,113,78,27,72,79,167,187,97,31,183,
+223,167,239,230,26,247,21,76,184,75,71,74,84,251,11,46,155,35,174,54,30,96,
+94,86,113,89,27,76,81,173,191,93,31,187,223,163,237,222,26,247,4,84,201,66,
+66,80,80,251,14,55,159,41,178,53,30,78,76,52,96,33,27,153,251,2,5,247,17,
+236,190,211,211,31,65,194,213,88,234,27,228,217,182,205,200,31,73,192,215,
+96,244,27,233,219,186,211,201,31,67,205,239,92,247,36,27,251,171,248,86,21,
+89,129,91,122,99,30,119,182,130,186,187,26,223,154,158,153,153,152,120,55,
+30,252,90,138,21,90,128,94,119,98,30,125,180,130,184,188,26,217,148,165,157,
+158,147,111,63,30,252,90,133,21,98,130,96,121,98,30,121,178,130,182,182,26,
+210,152,178,156,156,146,103,65,30,14,68,248,80,247,25,21,248,152,251,25,253,
+29,248,133,7,247,11,187,186,247,11,31,249,129,251,25,253,102,7,99,119,119,
+99,30,251,98,247,10,21,247,25,6,138,248,133,5,247,11,93,187,251,11,30,252,
+134,254,39,247,25,249,162,247,230,6,179,159,119,99,31,14,247,251,250,193,
+247,75,21,101,57,66,118,63,27,251,139,251,2,247,53,247,119,97,31,172,209,
+197,165,142,147,246,251,77,145,27,145,247,171,247,36,139,31,244,251,36,5,
+247,97,218,247,1,247,78,247,89,26,247,87,251,42,247,34,251,159,150,30,251,
+111,147,251,70,141,251,29,142,8,158,140,157,157,26,247,95,44,185,251,9,251,
+5,251,12,63,251,48,251,53,212,79,247,112,118,30,129,251,1,128,251,10,251,
+12,26,87,140,88,143,88,30,251,45,61,190,65,247,5,193,5,251,157,177,247,11,
+251,104,247,198,27,247,61,247,43,241,230,152,31,253,47,249,11,21,218,146,
+222,146,221,30,138,186,190,139,195,27,248,250,215,54,251,68,63,80,40,102,
+124,62,247,8,139,31,251,153,251,33,5,105,177,41,247,43,136,26,137,251,24,
+71,251,30,68,30,134,194,137,197,199,26,251,191,248,173,21,179,164,191,199,
+228,153,85,40,30,123,138,123,122,26,251,32,150,92,168,209,26,14,249,169,234,
+22,247,98,6,249,109,247,93,248,124,248,12,188,30,117,28,251,130,247,75,247,
+7,117,250,157,5,248,6,81,247,90,252,121,253,101,26,247,97,6,249,203,251,203,
+248,146,252,100,177,30,136,247,59,251,21,93,136,251,15,5,252,92,88,251,221,
+252,142,253,192,26,14,251,238,249,76,110,21,247,128,35,247,84,251,109,251,
+109,34,251,84,251,128,251,127,244,251,83,247,109,247,109,243,247,83,247,127,
+30,251,33,22,251,76,100,251,72,251,33,251,34,99,247,72,247,76,247,77,179,
+247,74,247,34,247,33,178,251,74,251,77,30,14,251,238,249,76,28,4,172,203,
+10,251,238,248,230,252,76,21,194,7,251,17,143,5,123,124,153,154,31,249,131,
+248,186,10,172,5,253,27,7,124,127,125,123,30,251,28,135,5,84,7,14,251,238,
+249,66,252,76,21,247,101,74,7,116,34,248,174,29,247,44,247,66,26,247,35,251,
+17,231,251,64,251,48,251,29,66,34,90,248,149,10,141,145,182,166,201,27,241,
+227,77,251,10,251,64,251,84,251,26,251,163,251,98,31,57,7,14,196,250,240,
+248,203,21,244,251,144,7,225,247,0,193,247,5,247,7,26,247,129,251,58,247,
+46,251,159,251,131,251,97,251,17,248,23,10,199,182,235,27,247,52,247,0,35,
+251,89,251,2,98,38,62,35,31,252,163,34,248,75,6,251,15,251,23,251,64,251,
+29,251,87,251,54,8,251,29,250,85,247,242,38,7,102,251,68,5,252,242,6,247,
+66,247,29,247,56,247,19,247,19,247,21,8,14,249,76,70,29,251,176,28,4,170,
+247,14,10,247,115,250,141,203,10,251,238,249,66,251,97,21,247,27,251,17,199,
+251,4,143,30,247,23,174,210,210,232,26,247,23,251,11,214,251,45,251,52,251,
+25,68,44,86,184,123,170,172,161,153,141,143,30,247,13,7,139,188,170,211,229,
+223,86,36,251,0,39,91,251,5,30,104,64,6,139,172,143,186,227,247,5,104,251,
+11,41,55,49,251,15,96,102,147,248,24,29,107,79,234,59,247,72,247,84,247,48,
+240,247,41,31,14,251,238,249,76,251,89,21,223,251,4,248,148,44,7,252,72,252,
+146,5,53,248,42,251,150,247,17,247,150,248,175,10,247,247,5,14,251,238,249,
+76,250,152,21,223,251,4,248,146,44,7,252,72,252,146,5,55,248,42,251,152,247,
+17,247,152,248,175,10,247,246,5,14,196,249,85,248,183,247,58,10,54,248,234,
+29,196,249,85,248,183,247,58,10,54,248,235,29,251,95,247,44,10,196,249,85,
+247,44,247,58,10,251,18,248,234,29,196,249,85,247,44,247,58,10,251,18,248,
+235,29,251,46,247,44,10,251,238,249,68,251,64,21,247,50,251,9,231,251,76,
+30,51,51,108,137,27,247,126,248,54,243,252,150,252,64,248,99,10,53,61,33,
+251,33,108,88,151,248,40,10,115,94,75,247,7,63,248,86,29,251,238,249,68,250,
+175,21,247,49,251,9,234,251,76,30,51,51,108,137,27,247,200,29,53,61,32,251,
+33,108,88,152,248,40,10,114,94,76,247,7,61,248,86,29,182,248,17,28,4,211,
+21,155,153,166,168,30,248,30,6,157,153,121,118,142,31,165,251,76,5,247,5,
+247,211,254,73,51,6,247,0,247,251,29,252,97,7,247,211,247,229,251,8,251,155,
+251,37,251,13,251,74,251,109,92,52,168,170,106,31,70,247,79,5,141,131,105,
+147,116,27,65,94,89,73,251,23,247,68,251,3,248,183,10,248,9,252,79,247,16,
+251,127,31,14,251,93,248,1,249,238,21,151,150,158,159,30,247,120,6,153,149,
+126,124,141,31,157,251,5,5,231,247,131,253,95,47,6,237,133,5,160,136,149,
+123,127,26,251,194,7,247,138,247,126,59,251,84,251,33,52,64,251,24,105,84,
+142,161,115,31,67,247,78,5,141,133,101,146,123,27,85,91,82,73,251,8,247,54,
+66,247,50,247,137,247,64,247,35,247,92,247,181,251,178,217,251,66,31,14,251,
+238,249,76,251,50,83,10,251,238,249,76,250,191,21,247,37,251,0,247,1,251,
+60,63,65,121,79,66,30,165,247,89,247,40,247,8,247,62,131,184,137,24,215,7,
+251,230,251,87,251,84,251,185,251,161,247,32,39,247,72,247,72,247,35,247,
+11,247,211,29,157,137,162,248,111,29,69,251,12,31,14,162,248,197,114,21,247,
+169,247,103,247,117,247,191,247,104,251,52,247,70,251,158,203,31,248,191,
+29,209,251,27,251,64,26,251,96,67,251,92,251,89,251,97,54,247,146,247,157,
+247,180,223,247,250,248,30,247,61,30,119,246,5,252,56,251,8,251,141,252,29,
+252,8,26,252,64,247,89,251,117,247,186,30,14,222,248,237,217,21,251,97,54,
+247,126,247,117,247,180,223,247,198,248,30,247,61,31,119,246,5,252,56,251,
+8,251,161,251,233,252,8,26,252,24,247,110,251,107,247,185,247,208,247,84,
+247,127,247,161,247,104,251,52,247,50,251,158,203,30,248,191,29,189,251,7,
+251,64,26,251,66,67,251,92,251,89,30,14,251,238,249,74,247,207,21,209,253,
+19,251,109,209,7,159,247,5,5,248,46,6,252,74,253,116,5,247,31,180,6,14,251,
+238,249,74,28,6,2,21,209,253,19,251,107,209,7,159,247,4,5,248,46,6,252,74,
+253,117,5,247,31,182,6,14,251,238,249,74,251,107,248,179,10,170,231,202,244,
+26,247,10,251,12,227,251,54,251,62,251,9,53,251,33,43,221,77,213,113,30,40,
+104,47,80,251,5,26,251,31,247,17,42,247,89,247,74,247,29,240,247,31,30,251,
+49,248,33,248,132,10,191,225,26,212,205,203,229,227,213,84,38,30,161,252,
+54,21,58,69,69,251,6,251,21,69,211,243,227,194,188,205,172,30,247,60,78,233,
+108,36,26,14,251,238,249,74,250,132,248,179,10,169,231,205,243,26,247,11,
+251,12,225,251,54,251,62,251,9,55,251,33,42,221,76,213,112,30,40,105,47,81,
+251,4,26,251,32,247,17,41,247,89,247,74,247,29,239,247,32,30,251,49,248,35,
+248,132,10,190,225,26,213,205,201,229,227,213,85,39,30,161,252,56,21,57,69,
+70,251,6,251,21,69,212,244,227,194,188,205,172,30,247,60,77,233,107,36,26,
+14,251,238,249,76,172,21,247,160,251,31,237,251,72,251,72,251,36,251,8,251,
+73,251,37,247,1,251,3,247,60,215,212,158,198,213,30,112,251,88,251,39,251,
+9,251,62,147,92,141,24,63,7,247,230,247,88,247,87,247,185,31,251,31,161,21,
+121,141,118,135,113,30,102,86,71,112,82,27,251,9,67,211,247,13,247,15,201,
+233,248,121,10,251,238,249,76,28,4,231,142,10,222,248,214,28,5,24,21,247,
+97,224,251,126,251,117,251,219,251,6,251,159,252,30,251,61,31,159,32,5,248,
+56,247,8,247,191,247,194,248,47,26,248,24,251,110,247,107,251,185,251,208,
+251,84,251,127,251,161,251,160,247,114,251,131,247,238,247,37,30,148,163,
+153,214,148,153,8,251,202,58,78,247,77,247,64,26,247,66,211,247,92,247,89,
+30,14,162,248,194,250,136,21,251,169,251,103,251,117,251,191,251,172,247,
+82,251,116,247,242,247,21,31,148,163,153,214,148,153,8,251,147,78,251,0,247,
+42,247,92,26,247,96,211,247,92,247,89,247,97,224,251,116,251,157,251,180,
+55,251,227,252,30,251,61,30,159,32,5,248,56,247,8,247,141,248,6,248,8,26,
+248,64,251,89,247,87,251,186,30,14,251,248,248,4,28,5,112,21,251,72,251,30,
+251,27,251,71,251,60,247,16,251,27,247,119,217,31,145,153,148,184,145,148,
+8,251,57,102,68,229,247,12,26,247,14,186,247,12,247,20,247,25,195,251,26,
+251,51,251,65,84,251,93,251,148,38,30,152,75,5,247,165,208,247,54,247,114,
+247,115,26,247,149,251,20,247,9,251,83,30,14,249,76,79,10,14,250,63,28,4,
+161,28,5,150,21,251,21,6,253,160,28,250,106,5,247,21,6,247,61,85,10,28,7,
+40,251,78,207,10,252,112,252,54,247,16,29,14,249,76,79,10,28,6,36,251,229,
+93,10,14,249,76,79,10,28,5,248,251,208,83,10,249,76,28,5,62,28,5,150,247,
+14,10,247,48,85,10,28,6,19,247,59,247,157,29,14,249,76,79,10,28,6,25,251,
+18,142,10,249,76,28,5,119,28,5,150,149,10,28,6,110,251,229,93,10,14,249,76,
+28,6,213,247,159,93,10,254,187,248,213,104,29,14,249,76,28,5,119,28,5,150,
+247,14,10,28,4,196,247,159,93,10,254,104,248,216,247,167,10,251,7,223,248,
+157,29,249,76,28,5,119,28,5,150,247,14,10,247,91,250,1,93,10,250,101,252,
+225,83,10,253,4,247,252,232,29,253,27,247,203,28,6,13,21,189,114,169,83,83,
+114,109,89,120,188,252,158,139,30,204,6,139,187,248,158,158,26,140,253,83,
+21,181,102,172,94,93,104,106,97,99,174,103,185,184,176,175,179,30,14,253,
+27,247,203,210,247,0,29,253,27,247,203,28,5,36,247,0,29,207,250,65,236,29,
+252,108,28,4,148,247,1,29,14,252,152,248,61,28,6,38,21,221,88,190,53,53,92,
+88,57,106,223,253,150,139,30,240,6,139,224,249,150,172,26,14,252,187,248,
+33,28,4,250,21,221,98,190,53,53,102,88,57,106,213,253,50,139,30,240,6,139,
+214,249,50,172,26,14,252,159,248,37,28,5,100,240,10,253,141,247,216,10,252,
+236,248,22,249,124,240,10,252,137,247,216,10,253,36,234,10,253,66,28,5,14,
+247,32,10,252,226,246,10,252,226,246,10,252,42,250,221,247,18,29,253,36,247,
+252,28,4,238,21,247,10,72,211,36,62,94,84,69,92,169,248,65,10,60,36,46,248,
+45,10,251,60,249,183,250,21,21,81,207,251,4,241,247,29,154,141,155,149,26,
+247,21,6,139,170,176,184,26,209,87,194,66,32,78,63,251,8,251,89,247,64,251,
+27,192,92,30,251,238,155,21,57,221,49,241,247,19,154,143,151,149,26,247,21,
+6,139,170,172,190,26,209,90,192,65,34,74,65,251,8,248,158,10,251,126,249,
+162,28,4,238,21,247,8,74,213,34,66,89,247,17,10,33,65,88,84,69,94,169,248,
+79,10,251,4,37,81,248,27,10,252,210,248,35,10,241,253,39,21,37,247,218,5,
+251,34,6,37,251,218,5,14,252,210,248,35,10,14,253,91,204,10,253,91,204,10,
+253,91,204,10,252,232,248,97,252,191,247,10,10,252,232,248,97,249,30,247,
+10,10,252,232,248,64,113,247,11,10,252,232,248,64,28,4,155,247,11,10,251,
+86,249,207,252,42,21,218,251,183,28,6,102,247,183,216,253,41,28,248,254,7,
+247,12,28,6,181,21,247,22,28,249,154,251,22,6,14,251,86,249,117,252,44,21,
+28,7,4,253,40,62,247,182,28,249,154,251,182,58,7,248,176,28,6,183,21,28,249,
+154,251,22,28,6,102,7,14,251,188,247,92,28,5,120,21,254,224,226,250,137,247,
+205,226,7,14,252,101,248,28,29,251,188,247,92,28,5,120,21,52,247,205,254,
+137,226,250,224,7,14,252,101,248,28,10,251,188,248,236,251,114,21,226,251,
+205,28,4,213,52,28,250,212,7,14,252,101,248,29,29,251,188,248,236,251,114,
+21,28,5,44,52,28,251,43,251,205,52,7,14,252,101,248,29,10,251,88,248,16,239,
+21,248,236,159,249,60,248,56,248,136,30,69,209,5,252,117,252,92,70,252,230,
+253,130,26,254,224,247,72,7,14,251,88,248,16,247,165,29,251,88,248,16,28,
+9,196,21,251,72,28,251,80,6,253,130,208,252,230,248,117,252,92,30,209,209,
+5,252,56,248,136,119,249,60,248,236,26,14,251,88,248,156,254,74,21,247,72,
+250,224,6,249,130,70,248,230,252,117,248,92,30,69,69,5,248,56,252,136,159,
+253,60,252,236,26,14,251,88,249,80,247,165,29,251,88,248,156,28,5,70,21,252,
+236,119,253,60,252,56,252,136,30,209,69,5,248,117,248,92,208,248,230,249,
+130,26,28,4,176,251,72,7,14,251,88,248,16,254,74,21,28,10,180,247,212,247,
+2,252,136,28,244,222,7,14,251,88,248,16,247,165,29,251,88,249,80,252,86,21,
+247,2,251,212,28,11,24,251,72,28,244,122,7,14,251,88,249,80,254,74,21,28,
+11,34,252,136,251,2,247,212,28,245,76,7,14,251,88,249,80,247,165,29,251,88,
+249,80,252,86,21,28,11,134,251,72,28,244,232,251,212,251,2,7,14,243,249,70,
+249,110,21,249,130,189,247,192,247,222,30,219,247,12,49,6,252,126,79,252,
+36,253,130,31,28,249,92,247,72,7,14,243,248,146,28,7,38,21,253,130,99,251,
+192,251,222,30,49,251,12,229,6,247,222,179,251,192,253,130,31,252,196,247,
+72,248,206,7,248,219,102,248,14,251,139,247,31,30,247,139,247,31,176,248,
+13,248,220,26,249,160,251,72,7,14,243,249,70,247,165,29,243,249,70,28,9,196,
+21,251,72,28,248,248,6,253,130,199,252,36,248,126,30,229,247,12,59,6,251,
+222,89,247,192,249,130,31,14,243,248,146,254,74,21,247,72,28,6,164,6,249,
+130,79,248,36,252,126,30,49,251,12,219,6,247,222,189,251,192,253,130,31,14,
+243,249,70,28,10,40,21,251,72,253,160,6,252,220,175,252,13,247,139,251,31,
+30,251,139,251,31,103,252,14,252,219,26,252,206,247,72,248,196,7,249,130,
+179,247,192,247,222,30,229,247,12,49,6,251,222,99,247,192,249,130,31,14,243,
+248,146,249,100,21,253,130,89,251,192,251,222,30,59,251,12,229,6,248,126,
+199,248,36,249,130,31,28,7,8,251,72,7,14,253,23,247,171,248,152,10,14,252,
+19,248,175,248,152,10,251,47,22,28,7,155,34,28,248,101,7,14,251,135,189,248,
+255,21,249,133,243,253,133,6,252,16,4,249,133,243,253,133,6,248,65,254,11,
+21,28,7,155,34,28,248,101,7,14,98,247,109,29,98,247,109,29,98,191,247,50,
+21,221,57,247,29,247,29,5,253,121,247,16,249,245,7,247,156,247,156,5,254,
+253,247,17,28,4,230,7,247,110,247,111,57,221,251,28,251,28,5,249,119,251,
+17,253,244,7,251,156,251,157,5,250,253,251,16,28,251,27,7,14,250,76,28,4,
+139,249,254,240,10,251,241,252,237,247,67,29,249,74,247,217,29,250,76,28,
+4,139,247,165,247,67,29,251,241,248,237,240,10,249,74,22,248,13,29,14,250,
+76,248,114,247,44,21,221,57,247,105,247,105,5,249,245,247,19,253,118,6,247,
+36,247,35,5,248,230,247,19,252,103,6,247,35,247,35,5,247,216,247,19,251,89,
+6,247,25,247,24,57,221,251,107,251,106,5,253,247,251,19,249,120,6,251,35,
+251,35,5,252,233,251,19,248,106,6,251,36,251,35,5,251,218,251,19,247,91,6,
+14,250,76,28,6,82,22,239,29,250,76,248,113,29,28,4,164,247,162,21,239,29,
+250,76,249,8,251,4,21,237,83,245,247,80,5,126,189,194,132,199,27,249,1,247,
+5,252,252,6,99,102,143,146,105,31,248,147,250,32,5,247,108,247,5,251,45,6,
+205,247,8,39,192,44,251,61,5,251,231,6,252,21,251,74,251,185,251,172,251,
+95,234,251,101,247,92,39,31,251,61,248,148,21,247,154,247,58,247,90,247,172,
+30,247,162,6,252,126,253,250,5,251,37,213,58,247,43,247,77,26,14,250,76,250,
+175,22,238,29,250,76,248,113,29,249,1,247,162,21,238,29,250,76,248,158,251,
+4,21,237,83,233,247,60,5,247,229,6,248,21,247,74,247,185,247,171,247,94,44,
+247,101,251,90,240,31,239,247,69,39,192,32,251,82,5,153,88,83,146,79,27,253,
+1,251,5,248,252,6,179,177,135,131,174,31,252,147,254,31,5,251,110,251,5,247,
+47,6,250,31,248,208,21,251,155,251,58,251,88,251,172,30,251,160,6,248,125,
+249,248,5,247,36,64,220,251,43,251,75,26,14,253,39,247,163,252,226,21,249,
+72,34,253,72,7,14,253,39,247,163,250,46,21,249,72,34,253,72,7,14,251,66,250,
+232,247,195,29,251,64,28,4,234,21,63,180,253,109,28,249,218,213,96,5,14,251,
+138,251,210,21,213,182,253,109,28,6,38,63,98,5,14,251,69,249,196,250,111,
+21,251,16,6,252,254,28,250,133,5,247,16,6,247,77,248,55,247,87,252,55,5,247,
+16,6,251,151,248,192,5,14,252,77,247,7,29,252,77,247,7,29,252,77,247,7,29,
+28,11,184,28,16,0,248,96,29,28,240,0,251,33,7,14,28,19,184,28,24,0,248,96,
+29,28,232,0,251,33,7,14,250,18,28,7,203,248,96,29,28,248,48,251,33,7,14,252,
+77,247,7,29,253,51,248,18,68,21,230,251,231,48,7,14,253,51,248,18,28,4,125,
+21,230,251,231,48,7,14,251,235,251,99,21,221,252,64,57,7,14,251,82,248,89,
+21,241,253,111,37,7,14,248,89,4,241,28,251,105,37,7,14,253,1,248,111,247,
+61,10,251,211,247,61,10,253,1,248,111,28,5,129,33,29,251,153,28,5,129,33,
+29,252,218,248,150,28,5,43,21,167,29,14,252,218,248,150,28,5,43,21,167,29,
+14,251,114,249,254,28,5,43,21,167,29,251,252,22,248,226,29,251,114,249,254,
+28,5,129,56,10,251,114,249,254,250,44,56,10,98,28,5,129,56,10,247,30,135,
+10,14,248,134,135,10,247,252,22,248,226,29,253,1,248,111,247,81,10,251,211,
+247,81,10,252,15,248,111,249,19,50,29,253,1,248,111,250,252,50,29,252,12,
+250,252,50,29,252,218,207,29,14,251,114,207,29,247,252,22,248,225,10,251,
+114,249,254,249,19,48,10,251,92,250,252,48,10,247,30,207,29,249,100,22,226,
+10,251,252,22,248,225,10,252,203,248,165,251,156,21,251,96,247,185,5,251,
+13,6,251,96,251,185,5,247,14,6,247,34,247,99,247,35,251,99,5,14,251,114,252,
+138,51,10,252,62,249,50,252,138,51,10,251,114,250,252,51,10,251,144,252,64,
+21,247,35,248,182,29,251,35,30,221,6,247,7,163,238,190,239,27,240,237,88,
+251,7,165,31,14,251,144,250,252,65,10,251,144,28,4,186,21,247,35,37,247,54,
+251,95,251,97,39,251,54,251,35,30,221,6,247,8,163,238,191,239,27,240,237,
+87,251,8,165,31,251,3,88,43,10,252,122,248,246,250,252,248,19,10,219,6,247,
+9,163,240,188,239,27,240,235,90,251,9,165,31,14,249,196,28,6,75,21,247,68,
+251,7,251,141,227,252,83,27,252,82,251,153,248,104,29,247,200,176,247,241,
+27,247,243,247,209,102,251,25,240,31,14,28,6,200,4,247,31,7,252,122,251,213,
+248,104,29,247,252,176,248,44,27,14,28,6,75,4,247,66,251,5,251,191,229,252,
+144,27,251,31,7,248,25,248,15,102,251,25,237,31,14,203,250,254,248,56,21,
+247,48,251,34,251,124,192,251,68,27,251,68,251,123,86,251,48,251,35,31,199,
+69,5,242,247,51,247,134,161,228,27,228,247,134,117,36,247,51,31,14,251,144,
+183,29,251,144,28,5,152,66,10,251,144,28,5,152,68,29,251,83,180,43,10,251,
+106,28,4,176,21,247,22,253,18,7,52,115,41,82,38,27,39,38,196,226,115,31,59,
+6,251,6,239,251,60,247,97,247,24,228,210,220,185,30,14,252,122,248,246,251,
+60,21,57,6,251,9,113,43,90,38,27,39,38,188,247,178,29,249,196,252,68,242,
+29,249,196,28,7,53,242,29,249,141,28,6,32,21,247,65,6,253,238,248,83,5,251,
+46,6,253,238,252,83,5,247,65,6,249,143,247,195,5,14,252,62,249,50,247,108,
+29,251,114,247,108,29,251,114,28,5,195,54,29,251,76,248,206,10,247,23,252,
+55,7,63,125,133,70,83,31,251,72,251,194,5,223,6,247,148,247,138,5,14,251,
+76,28,5,225,21,56,6,251,148,251,140,5,252,42,251,21,248,56,6,215,153,146,
+208,194,31,14,253,204,28,4,176,21,58,185,228,68,247,24,27,247,97,239,247,
+60,247,6,31,59,6,52,115,38,82,39,27,38,41,196,226,115,31,253,18,251,22,6,
+14,251,76,250,252,21,247,21,252,41,7,251,148,247,140,5,55,6,247,72,251,193,
+5,70,195,153,132,215,27,14,251,76,250,252,21,251,72,247,194,5,208,84,125,
+145,63,27,252,56,251,23,248,42,6,247,148,251,138,5,14,251,13,28,5,209,21,
+53,6,251,111,251,105,251,88,247,66,5,166,108,102,157,112,27,115,100,129,106,
+119,31,251,85,251,216,5,225,6,247,109,247,103,247,91,251,64,5,113,169,176,
+116,168,27,162,180,154,169,157,31,14,251,13,250,252,21,251,84,247,216,5,172,
+121,98,149,116,27,110,102,121,112,109,31,251,89,251,66,251,111,247,105,5,
+53,6,247,85,251,218,5,109,159,178,124,163,27,166,178,162,165,170,31,247,88,
+247,64,247,109,251,103,5,14,251,227,249,141,118,36,29,251,93,80,29,251,95,
+248,250,36,29,251,93,28,5,143,36,29,253,75,250,229,21,247,26,247,29,5,116,
+191,189,118,189,27,247,25,233,244,247,12,170,31,57,6,90,133,71,90,84,27,103,
+106,146,149,107,31,247,4,247,8,76,199,251,29,251,33,5,162,87,89,162,88,27,
+251,26,46,35,251,13,108,31,221,6,188,145,204,188,194,27,177,174,131,128,172,
+31,251,1,251,3,5,14,250,76,197,10,250,76,197,10,55,28,5,167,93,29,55,251,
+145,93,29,252,250,28,4,191,247,240,10,247,152,248,29,247,240,10,247,45,51,
+36,29,250,163,28,7,36,21,248,185,29,252,125,251,14,247,44,252,160,247,199,
+29,248,124,247,44,251,40,248,127,248,181,29,14,28,7,13,4,176,251,45,251,52,
+175,251,147,247,199,29,27,247,143,247,53,100,101,247,57,31,14,254,163,28,
+6,145,21,103,247,48,247,51,104,247,131,248,181,29,248,185,29,27,251,143,251,
+46,179,178,251,54,31,14,252,80,28,7,4,21,251,12,108,34,65,251,25,251,0,237,
+96,251,26,26,84,90,94,90,133,30,57,7,247,13,170,243,212,247,26,247,0,41,180,
+247,25,26,194,188,187,188,145,30,14,253,7,28,5,243,21,44,251,162,5,247,87,
+6,79,251,62,5,239,6,234,247,162,5,251,87,6,199,247,62,5,14,251,166,251,175,
+21,38,169,251,47,37,146,119,247,77,149,5,251,50,247,95,21,79,227,80,51,188,
+251,71,5,159,6,247,56,251,168,21,136,245,251,37,247,8,121,126,205,251,64,
+5,39,247,117,21,251,47,241,37,109,204,57,247,78,129,5,162,106,21,122,152,
+251,37,251,8,136,33,239,176,5,14,252,81,252,144,247,29,10,252,142,248,43,
+247,206,247,29,10,251,171,250,252,21,251,99,247,79,247,99,247,80,5,251,29,
+6,251,31,251,19,251,34,247,19,5,251,29,6,247,101,251,80,251,101,251,79,5,
+247,29,6,247,34,247,19,247,31,251,19,5,14,251,128,251,66,21,92,6,57,123,79,
+104,80,27,90,94,164,190,118,31,92,6,88,118,92,114,90,27,80,81,174,221,123,
+31,92,6,39,198,251,3,247,13,211,182,176,188,163,30,90,164,184,102,209,27,
+247,13,200,247,3,239,31,14,251,128,252,21,21,239,78,247,3,251,13,69,94,102,
+88,114,30,190,115,96,176,67,27,251,13,80,251,3,39,31,186,6,219,155,197,174,
+198,27,188,186,116,88,160,31,186,6,190,160,184,162,188,27,198,199,104,59,
+155,31,14,252,46,249,66,251,197,83,29,251,106,251,197,83,29,252,46,249,66,
+28,4,176,83,29,251,106,28,4,176,83,29,249,66,252,186,248,120,10,249,66,28,
+6,224,248,120,10,247,21,248,114,10,14,168,28,6,24,21,28,251,108,251,22,28,
+4,148,6,14,247,168,28,5,92,247,148,10,247,21,247,148,10,251,63,251,197,21,
+247,22,253,152,251,22,7,249,152,251,122,21,247,22,253,152,251,22,7,14,247,
+21,28,4,176,21,247,22,28,250,164,251,22,7,28,5,92,247,122,21,247,22,28,250,
+164,251,22,7,14,251,168,249,150,249,210,21,247,22,253,100,251,22,7,249,100,
+247,132,21,247,22,253,100,251,22,7,14,252,77,248,201,248,203,21,247,44,252,
+111,251,44,7,248,111,251,193,21,247,46,252,111,251,46,7,14,252,147,248,178,
+187,247,249,10,252,147,248,178,28,4,244,247,249,10,250,76,28,6,102,249,117,
+247,121,29,28,4,204,252,8,247,121,29,249,179,250,92,21,223,55,187,57,74,85,
+112,70,103,30,188,108,170,196,173,139,181,141,25,187,140,183,115,99,34,251,
+26,103,85,26,45,198,221,7,196,247,40,182,245,26,251,33,252,46,21,209,66,69,
+7,14,250,76,28,6,102,249,203,247,121,29,28,4,204,251,162,247,121,29,28,4,
+204,251,162,247,121,29,14,249,255,248,30,248,113,21,251,15,248,166,251,247,
+247,13,247,247,248,166,247,15,252,166,247,246,251,13,251,246,7,252,166,249,
+85,21,251,14,28,4,157,247,14,7,14,251,125,247,18,10,251,125,77,10,252,78,
+70,10,252,78,28,5,33,43,10,253,197,247,121,28,5,35,43,10,252,64,251,183,57,
+29,252,64,28,5,104,81,29,253,218,247,150,28,6,48,81,29,254,43,251,72,249,
+217,21,63,7,247,54,207,247,41,247,23,247,23,26,247,247,10,55,58,33,80,30,
+14,252,145,248,173,252,5,123,10,251,205,252,5,123,10,251,205,28,5,90,89,29,
+14,253,130,251,17,21,248,23,29,218,209,176,197,183,31,81,184,209,102,218,
+27,247,27,247,0,247,0,247,27,247,28,251,0,247,0,251,27,60,69,102,81,94,31,
+197,95,69,176,60,27,248,23,41,21,219,202,73,59,59,76,76,59,61,76,199,216,
+136,31,145,7,145,7,217,142,202,201,217,27,252,23,22,219,202,73,59,31,133,
+7,62,136,77,79,61,27,59,75,202,219,219,203,205,219,31,14,252,92,252,160,247,
+115,29,252,169,248,97,22,247,49,10,252,171,248,95,249,88,21,247,49,10,252,
+92,28,4,144,247,115,29,252,92,251,216,229,29,252,169,248,97,247,250,247,40,
+29,252,169,248,97,250,190,247,40,29,252,92,28,5,88,229,29,252,109,241,28,
+4,133,21,251,93,247,49,251,38,247,148,66,30,238,7,251,80,213,62,247,7,222,
+26,195,158,196,185,151,30,247,83,6,139,166,166,176,26,209,51,179,56,251,25,
+251,19,42,251,45,30,14,252,200,239,249,200,21,251,48,247,17,64,247,95,75,
+30,216,7,251,50,190,87,202,205,26,171,156,170,174,149,30,247,44,6,139,160,
+163,182,26,189,84,179,58,33,38,59,251,4,30,14,252,109,248,169,28,4,163,21,
+247,5,10,253,150,4,247,5,10,14,252,200,248,79,249,230,21,247,23,10,252,186,
+4,247,23,10,14,252,37,28,5,121,45,29,252,146,252,111,21,247,242,45,251,242,
+7,14,252,146,250,252,21,247,243,45,251,243,7,14,252,21,252,111,21,247,242,
+45,251,242,7,251,48,22,247,242,45,251,242,7,14,252,41,250,252,21,247,243,
+47,251,243,7,251,9,22,247,243,45,251,243,7,14,252,236,248,89,67,247,30,29,
+253,111,251,160,21,57,247,25,251,35,221,247,35,247,25,221,251,25,247,35,57,
+251,35,7,14,252,142,248,136,248,81,247,30,29,252,236,248,89,28,4,124,247,
+30,29,252,19,251,99,21,221,251,240,57,247,25,251,35,221,247,35,7,14,251,179,
+249,70,249,25,21,221,252,207,57,247,138,252,45,220,248,45,7,14,252,19,251,
+242,21,221,251,25,247,35,57,251,35,251,25,57,7,14,251,179,249,70,247,128,
+21,220,251,136,248,46,58,252,46,251,138,58,7,14,252,65,252,130,21,248,5,57,
+251,35,251,66,57,247,66,251,36,7,14,252,65,251,242,21,221,251,66,247,35,57,
+252,5,221,247,36,7,14,252,44,248,205,248,82,21,221,252,4,247,138,57,252,207,
+221,247,135,7,14,251,78,248,184,247,87,21,218,251,247,248,107,61,252,186,
+7,14,251,245,252,189,248,85,10,252,120,248,146,250,105,248,85,10,253,10,248,
+59,250,129,21,249,22,251,23,253,22,7,49,247,212,21,182,104,177,96,96,103,
+101,96,96,175,104,182,182,174,174,182,30,14,252,111,247,124,28,5,195,21,182,
+103,175,96,96,104,103,96,97,174,103,182,182,175,175,181,30,247,243,165,21,
+50,229,252,92,252,92,232,49,5,14,252,2,248,79,28,5,103,21,182,104,175,96,
+96,103,103,96,97,175,103,182,182,174,175,181,30,247,136,251,191,21,247,20,
+253,22,251,20,7,14,251,189,249,134,250,208,21,248,59,251,20,251,187,252,217,
+251,20,7,14,207,250,238,28,5,20,21,247,12,254,188,252,66,247,10,247,202,247,
+174,251,202,247,10,247,202,7,14,207,248,204,250,234,21,247,202,251,10,251,
+202,251,174,247,202,251,10,252,66,250,188,247,12,7,14,207,248,75,29,247,11,
+7,14,207,248,75,29,247,198,251,10,251,79,7,14,58,250,69,250,129,248,33,10,
+228,254,129,248,33,10,14,251,213,92,29,251,179,251,226,72,10,252,33,251,128,
+21,189,135,200,251,27,47,84,88,63,106,30,209,6,147,176,247,23,174,61,82,251,
+31,145,42,56,235,167,70,63,43,178,47,26,67,247,33,114,243,30,162,7,33,159,
+114,168,176,208,236,125,221,239,42,117,192,194,247,27,129,237,26,14,251,239,
+252,19,248,13,10,251,239,250,197,248,13,10,251,239,252,19,21,247,150,47,251,
+56,251,126,247,56,45,251,150,7,14,253,5,248,107,251,158,21,247,158,57,251,
+76,251,199,247,76,57,251,158,7,14,252,5,252,136,21,248,11,252,11,252,11,7,
+247,195,211,21,251,125,247,125,247,125,6,14,253,159,247,209,249,132,21,92,
+163,5,33,115,116,75,57,27,59,129,201,204,31,247,72,7,92,164,251,138,251,60,
+168,78,247,87,247,21,5,251,42,7,49,192,80,243,247,9,190,247,2,242,149,30,
+14,252,3,247,172,28,5,115,181,29,28,250,198,75,10,252,3,247,172,250,193,181,
+29,254,136,75,10,252,3,247,172,249,121,181,29,253,64,75,10,252,3,247,172,
+248,49,181,29,251,248,75,10,252,3,247,172,224,181,29,111,75,10,251,180,247,
+39,28,5,86,172,10,28,250,227,75,10,251,180,247,39,250,150,172,10,254,93,75,
+10,251,180,247,39,249,64,172,10,253,7,75,10,251,180,247,39,247,234,172,10,
+251,177,75,10,251,180,247,39,22,247,131,10,247,106,29,14,252,3,108,10,28,
+5,58,189,10,252,3,108,10,250,136,189,10,252,3,108,10,249,64,189,10,252,3,
+108,10,247,248,189,10,252,3,108,10,167,189,10,251,180,112,29,28,5,29,132,
+29,251,180,112,29,250,93,132,29,251,180,112,29,249,7,132,29,251,180,112,29,
+247,177,132,29,251,180,112,29,82,132,29,249,32,250,95,28,5,122,21,139,44,
+136,42,252,29,251,209,251,210,252,27,252,29,247,209,251,209,248,29,228,240,
+136,142,30,248,28,247,209,247,209,248,29,248,27,251,207,247,213,252,28,31,
+248,74,253,92,21,251,242,251,174,251,173,251,240,251,242,251,173,247,173,
+247,242,247,240,247,173,247,174,247,242,247,240,247,174,251,174,251,240,30,
+14,251,3,250,25,248,150,21,253,188,248,40,5,253,188,7,14,67,248,118,10,28,
+6,33,251,18,28,249,223,247,91,10,247,160,249,169,248,206,10,251,96,254,174,
+6,251,220,248,176,5,251,109,6,248,205,254,21,5,247,48,6,248,195,250,21,5,
+251,113,6,251,206,252,170,5,14,252,32,249,9,250,87,21,251,109,248,152,251,
+15,252,152,251,109,6,247,170,251,171,5,14,67,249,220,249,216,21,247,226,10,
+28,249,223,247,18,28,6,33,7,247,62,252,58,5,14,252,32,249,9,28,4,176,21,251,
+171,247,171,251,170,251,171,5,247,109,252,152,247,15,248,152,6,14,252,24,
+251,207,21,251,61,247,61,251,60,251,61,5,247,9,251,148,242,247,148,6,14,67,
+248,118,10,28,5,76,247,126,10,28,250,180,247,91,10,67,250,128,252,107,21,
+247,19,254,108,251,19,7,249,200,249,236,21,44,176,251,62,252,58,5,28,4,197,
+247,126,10,28,251,59,247,91,10,250,76,28,7,123,248,187,21,247,19,28,249,223,
+7,247,141,10,14,251,127,251,66,21,252,146,211,6,248,189,29,248,146,7,14,251,
+127,251,66,21,253,73,6,247,75,251,45,5,213,248,146,7,14,178,28,4,111,251,
+250,21,247,15,254,54,7,247,141,29,14,250,76,247,214,10,28,249,223,251,19,
+28,6,33,248,203,29,248,39,10,252,146,60,248,146,7,14,252,4,251,217,21,247,
+72,247,43,5,253,70,60,248,146,6,14,247,253,252,97,21,104,48,248,42,251,55,
+5,28,249,124,251,15,28,6,132,248,30,10,14,250,76,247,214,10,28,250,180,6,
+247,141,10,28,5,76,248,203,29,248,39,10,252,13,211,7,248,189,29,248,13,7,
+14,249,255,28,4,254,250,104,21,251,57,251,219,5,253,160,6,247,141,29,249,
+98,248,72,10,249,35,247,15,252,229,6,247,29,247,164,5,14,249,255,250,44,250,
+104,21,251,57,251,219,5,253,7,251,15,248,201,248,72,10,249,188,248,30,10,
+252,212,247,141,104,48,248,42,251,55,5,253,126,6,247,29,247,164,5,14,67,248,
+110,29,28,5,97,42,28,250,8,7,251,35,251,103,251,35,247,103,5,28,5,248,42,
+28,250,159,248,58,10,14,67,250,87,249,220,21,247,246,29,28,250,159,236,28,
+5,248,248,177,29,28,250,8,236,28,5,97,7,247,8,251,77,5,14,67,248,110,29,249,
+249,7,247,8,251,77,234,197,247,246,29,253,249,248,58,10,239,247,249,21,251,
+35,251,103,251,35,247,103,5,28,4,147,248,177,29,14,250,49,28,7,174,248,11,
+21,235,28,250,8,7,251,103,247,35,247,103,247,36,5,28,5,248,235,28,250,160,
+247,137,10,14,250,49,247,221,10,28,250,160,43,28,5,248,6,247,103,251,36,251,
+103,251,35,5,28,250,8,43,28,5,96,6,251,76,251,9,196,45,5,14,250,76,247,221,
+10,253,248,247,137,10,249,248,6,251,76,251,9,196,45,5,248,126,248,86,21,251,
+103,251,35,5,28,251,108,6,251,103,247,35,247,103,247,36,5,28,4,148,6,14,250,
+76,28,6,166,168,21,254,234,250,234,248,54,251,70,180,231,252,241,247,131,
+41,41,247,132,252,240,231,180,251,70,248,54,250,234,254,234,5,14,250,76,28,
+6,164,176,21,251,132,248,240,47,98,247,70,252,54,254,234,250,234,49,49,250,
+234,254,234,252,54,247,70,98,47,248,241,251,131,5,14,250,76,28,6,164,28,4,
+170,21,41,237,252,241,251,131,180,47,248,54,247,70,254,234,254,234,229,49,
+250,234,250,234,251,70,252,54,231,98,5,14,250,76,28,6,166,28,4,178,21,49,
+229,254,234,254,234,247,70,248,54,47,180,251,132,252,240,237,41,248,241,247,
+131,98,231,252,54,251,70,5,14,249,56,28,5,215,28,6,205,21,253,186,253,162,
+251,57,253,195,125,59,146,194,175,248,9,251,173,247,186,251,52,251,52,24,
+247,123,252,24,200,251,91,171,251,143,230,101,24,139,248,30,250,63,249,14,
+248,109,30,251,48,247,151,235,247,212,139,26,14,251,13,249,252,28,6,51,21,
+47,6,251,185,253,39,251,184,249,39,5,46,6,247,232,253,117,5,229,6,14,252,
+245,248,72,251,24,21,93,6,251,39,251,221,251,38,247,221,5,93,6,247,62,252,
+4,5,184,6,14,251,13,249,252,249,230,247,136,29,252,245,248,72,252,136,21,
+251,62,248,4,5,94,6,251,62,252,4,5,185,6,247,38,247,221,247,39,251,221,5,
+14,133,250,111,250,9,247,177,10,254,134,28,6,24,21,61,7,250,9,251,175,5,217,
+7,253,171,247,136,249,171,247,135,5,217,7,14,251,6,253,151,247,177,10,252,
+187,248,129,252,119,21,178,7,252,31,247,14,248,31,247,14,5,178,7,252,78,251,
+34,5,100,7,14,67,250,74,251,183,21,247,74,7,253,74,249,77,249,74,249,74,5,
+247,76,7,254,0,254,2,5,14,133,250,111,28,4,143,247,19,29,251,17,28,5,201,
+247,19,29,251,6,247,177,29,14,252,187,248,129,251,234,21,178,7,252,78,247,
+34,5,100,7,248,31,251,14,252,31,251,14,5,100,7,14,67,250,74,248,224,21,254,
+0,250,2,5,251,76,7,249,74,253,74,253,74,253,77,5,251,74,7,14,252,138,247,
+177,29,28,6,94,87,247,136,29,252,163,98,21,247,232,253,117,5,229,6,247,232,
+249,117,5,46,6,251,184,253,39,251,185,249,39,5,72,252,39,247,19,29,249,255,
+28,5,147,248,56,21,247,139,247,138,139,248,34,251,139,247,141,251,138,247,
+138,252,35,141,251,140,251,140,251,140,251,141,141,252,34,247,138,251,138,
+247,3,251,0,247,29,77,247,32,128,8,251,229,251,242,32,247,242,251,161,247,
+5,247,161,247,243,246,251,243,247,227,7,247,34,150,247,32,201,247,2,247,2,
+8,70,208,21,251,101,251,101,251,229,141,251,99,247,99,251,100,247,101,139,
+247,229,247,100,247,98,247,101,247,101,247,227,139,247,101,251,101,247,99,
+251,98,139,251,231,251,99,251,99,8,14,249,255,28,7,15,250,76,21,122,247,83,
+141,194,152,247,135,251,134,125,84,137,251,83,157,133,80,24,109,247,75,74,
+122,247,86,27,252,57,252,57,5,233,251,2,251,34,193,251,48,27,251,240,251,
+174,251,174,251,240,251,241,247,174,251,174,247,240,247,241,247,174,247,174,
+247,241,247,45,83,247,33,49,246,31,248,58,248,59,5,251,86,157,205,169,251,
+76,30,252,59,252,148,21,251,186,251,130,251,130,251,186,251,186,251,130,247,
+130,247,186,247,186,247,130,247,130,247,186,247,186,247,130,251,130,251,186,
+30,14,251,188,249,104,247,253,21,247,14,251,25,239,251,8,52,54,109,81,56,
+30,250,42,35,28,249,176,7,243,184,247,23,222,247,34,247,10,8,247,18,244,244,
+222,247,22,26,251,112,135,21,141,72,102,69,88,77,78,62,56,68,85,88,8,248,
+44,7,212,183,193,174,203,27,210,188,91,69,141,31,14,251,113,249,129,247,189,
+21,247,114,7,251,24,101,5,247,244,7,247,24,177,5,247,113,7,251,24,102,5,248,
+71,48,252,99,7,251,73,88,5,248,73,46,252,99,7,251,20,103,5,251,112,7,247,
+20,174,5,251,243,7,251,20,102,5,251,111,7,247,20,175,5,252,74,232,248,99,
+7,247,73,191,5,252,74,230,248,99,7,48,247,87,21,251,73,88,5,247,244,7,247,
+73,191,5,14,253,26,248,53,250,251,188,29,253,26,248,53,251,83,188,29,253,
+26,247,69,250,251,127,29,253,26,247,69,251,83,127,29,253,26,248,53,250,50,
+21,209,251,253,69,7,247,253,247,93,188,29,253,26,248,53,251,83,21,208,251,
+43,7,251,23,104,166,232,232,174,168,247,23,31,247,43,210,251,36,6,251,57,
+56,87,251,33,251,33,222,89,247,57,31,247,36,251,91,21,208,252,8,68,7,14,253,
+26,248,41,250,49,21,209,252,8,69,7,247,36,247,94,127,29,253,26,248,36,252,
+28,21,208,252,3,70,7,247,36,247,93,127,29,14,14,14,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,14,14,14,14,249,255,14,250,76,14,252,239,14,252,159,
+14,253,148,14,252,75,14,251,3,14,67,14,252,239,14,169,14,252,220,14,254,179,
+14,249,255,28,5,88,250,196,21,251,44,44,251,2,78,70,30,251,34,251,52,72,64,
+131,251,78,8,96,6,147,247,51,178,247,24,228,247,39,8,180,209,193,247,16,244,
+26,247,93,251,20,213,34,251,20,77,67,79,30,84,203,68,94,26,82,94,109,103,
+111,56,167,247,22,247,41,247,20,247,31,247,125,247,109,247,50,251,11,251,
+89,30,251,169,254,111,21,66,81,99,88,81,82,180,211,204,194,186,199,194,193,
+94,72,30,249,250,249,47,21,254,100,250,100,254,99,254,100,250,99,254,99,5,
+14,252,101,248,28,29,252,101,248,29,29,252,101,248,28,10,252,101,248,29,10,
+247,6,247,156,247,27,21,248,108,29,252,13,250,174,248,13,251,2,6,248,187,
+29,252,134,249,21,21,120,121,159,154,31,118,247,13,5,35,252,73,243,6,160,
+247,14,5,153,159,162,156,30,247,206,6,156,159,116,125,31,160,251,14,5,243,
+248,73,35,6,118,251,13,5,124,121,119,120,30,253,42,248,234,21,251,232,248,
+85,29,249,8,248,72,29,247,232,6,14,106,172,250,111,164,247,254,172,6,252,
+105,162,7,30,163,99,99,89,135,4,63,12,9,237,10,247,76,11,237,145,12,12,247,
+76,170,12,13,250,220,21,181,19,2,208,2,0,1,0,21,0,27,0,33,0,78,0,89,0,94,
+0,113,0,116,0,128,0,194,0,199,0,202,0,223,0,244,0,254,1,51,1,108,1,126,1,
+134,1,137,1,145,1,153,1,161,1,166,1,209,1,216,2,49,2,216,2,219,2,224,2,233,
+2,248,3,16,3,36,3,39,3,82,3,88,3,109,3,114,3,212,3,230,3,236,3,252,4,0,4,
+90,4,95,4,112,4,125,4,158,4,166,4,175,4,238,5,41,5,47,5,70,5,130,5,144,5,
+198,6,47,6,60,6,68,6,124,6,141,6,178,6,226,7,106,7,146,7,255,8,130,9,4,9,
+74,9,98,9,186,10,46,10,167,10,210,10,216,10,221,10,250,11,26,11,47,11,132,
+11,215,11,250,12,21,12,31,12,80,12,142,12,149,12,234,13,86,13,119,13,125,
+13,154,13,157,13,180,13,197,14,8,14,87,14,112,14,211,14,225,15,31,15,40,15,
+135,15,144,15,148,15,151,15,156,15,176,16,3,16,51,16,82,16,97,16,111,16,124,
+16,214,17,37,17,50,17,53,17,62,17,65,17,86,17,89,17,96,17,110,17,121,17,129,
+17,165,17,182,17,188,17,202,18,27,18,38,18,44,18,52,18,90,18,168,18,179,18,
+188,18,193,18,221,19,41,19,59,19,133,19,171,19,239,20,4,20,19,20,93,20,120,
+20,125,20,198,20,209,20,222,20,253,21,13,21,17,21,23,21,48,21,62,21,84,21,
+143,21,211,21,215,21,241,22,31,22,36,22,45,22,85,22,133,22,136,22,141,22,
+198,22,206,23,13,23,44,23,68,23,102,23,120,23,127,23,150,23,172,23,182,23,
+189,23,209,23,227,24,26,24,45,24,52,24,75,24,103,24,119,24,173,24,202,24,
+211,24,233,24,246,25,0,25,33,25,53,25,103,25,136,25,163,25,174,25,196,25,
+199,25,246,25,251,26,4,26,9,26,35,26,60,26,93,26,100,26,115,26,130,26,140,
+26,184,26,202,26,247,27,2,27,20,27,45,27,53,27,95,27,137,27,148,27,155,27,
+169,27,203,27,239,28,10,28,15,28,32,28,69,28,102,28,116,28,158,28,181,28,
+222,28,233,29,10,29,22,29,61,29,66,29,73,29,111,29,127,29,140,29,156,29,167,
+29,175,29,184,29,223,29,227,29,235,29,246,30,17,30,53,30,74,30,96,30,104,
+30,110,30,145,30,160,30,165,30,190,30,201,30,210,30,230,30,250,31,2,31,37,
+31,47,31,82,31,95,31,107,31,126,31,148,31,180,31,188,31,201,31,215,31,224,
+31,234,31,247,32,13,32,38,32,69,32,101,32,133,32,156,32,188,32,220,32,236,
+32,254,33,16,33,29,33,44,33,75,33,81,33,88,33,98,33,102,33,131,33,147,33,
+164,33,169,33,177,33,199,33,218,33,248,34,3,34,12,34,35,34,51,34,62,34,79,
+34,100,34,109,34,127,34,143,34,162,34,173,34,182,34,210,34,230,34,251,35,
+6,35,22,35,31,35,43,35,55,35,67,35,79,35,84,35,89,35,94,35,112,35,135,35,
+146,35,160,35,184,35,211,35,222,35,228,35,255,36,19,36,38,36,60,36,77,36,
+103,36,108,36,115,36,128,36,154,36,165,36,183,36,209,36,215,36,229,36,255,
+37,14,37,20,37,35,37,45,37,70,37,95,37,120,37,135,37,160,37,185,37,210,37,
+235,37,255,38,24,38,41,38,47,38,70,38,77,38,93,38,101,38,110,38,120,38,140,
+38,164,38,188,38,212,38,236,38,255,39,5,39,27,39,33,39,47,39,56,39,65,39,
+74,39,83,39,91,39,112,39,135,39,158,39,164,39,187,39,203,39,210,39,228,39,
+251,40,1,40,6,40,12,40,34,40,39,40,61,40,83,40,100,40,122,40,126,40,132,40,
+138,40,151,40,156,40,166,40,183,40,199,40,220,40,240,40,252,41,17,41,32,41,
+36,41,43,41,48,41,57,41,77,41,97,41,117,41,124,41,144,41,164,41,184,41,189,
+41,193,41,198,41,205,41,217,41,229,41,236,41,244,41,252,42,15,42,34,42,53,
+42,64,42,83,42,102,42,108,42,127,42,146,42,165,42,177,42,196,42,210,42,227,
+42,232,42,241,42,250,43,1,43,10,43,19,43,26,43,44,43,62,43,80,43,98,43,116,
+43,133,43,151,43,160,43,178,43,189,43,207,43,225,43,241,43,252,44,7,44,14,
+44,25,44,42,44,52,44,60,44,70,44,87,44,104,44,121,44,138,44,155,44,170,44,
+185,44,200,44,216,44,232,44,248,45,8,45,24,45,40,45,52,45,68,45,84,45,100,
+45,116,45,132,45,148,45,164,45,173,45,187,45,201,45,211,45,221,45,231,45,
+241,45,251,46,5,46,13,46,21,46,29,46,37,46,52,46,67,46,73,46,85,46,100,46,
+115,46,130,46,145,46,160,46,175,46,182,46,197,46,205,46,214,46,228,46,242,
+47,0,47,7,47,13,47,27,47,41,47,55,47,69,47,83,47,90,47,104,47,118,47,132,
+47,144,47,153,47,162,47,171,47,180,47,189,47,198,47,207,47,216,47,225,47,
+231,47,237,47,242,47,255,48,12,48,25,48,38,48,51,48,56,48,64,48,77,48,90,
+48,103,48,116,48,129,48,142,48,155,48,168,48,181,48,187,48,200,48,213,48,
+220,48,233,48,244,48,248,49,3,49,10,49,17,49,24,49,31,49,38,49,50,49,62,49,
+74,49,86,49,98,49,110,49,122,49,134,49,146,49,158,49,170,49,182,49,194,49,
+206,49,218,49,230,49,242,49,254,50,10,50,22,50,34,50,46,50,58,50,70,50,82,
+50,94,50,106,50,118,50,130,50,140,50,150,50,160,50,168,50,176,50,184,50,192,
+50,200,50,208,50,216,50,224,50,232,50,240,50,246,50,252,51,2,51,8,51,19,51,
+30,51,41,51,52,51,63,51,74,51,85,51,96,51,107,51,118,51,129,51,140,51,151,
+51,162,51,173,51,184,51,195,51,203,51,214,51,225,51,236,51,247,52,2,52,13,
+52,24,52,35,52,46,52,57,52,68,52,79,52,88,52,97,52,102,52,107,52,112,52,117,
+52,122,52,126,52,130,52,136,52,141,52,146,52,154,52,158,52,165,52,174,52,
+183,52,190,52,194,52,199,52,207,52,216,52,219,52,226,52,234,52,239,52,251,
+52,254,53,7,53,28,53,31,53,35,53,40,53,48,53,51,53,54,53,61,53,69,53,78,53,
+89,53,95,53,104,53,111,53,114,53,122,53,132,28,5,123,248,95,29,252,81,51,
+7,247,9,177,29,249,158,247,184,29,11,250,252,22,141,10,11,250,58,241,154,
+10,11,250,164,249,230,21,239,251,168,7,247,150,10,251,58,247,10,251,3,247,
+28,108,31,208,10,218,114,195,109,188,30,251,32,251,64,247,95,29,247,7,253,
+195,247,94,29,11,137,29,247,53,29,248,29,250,82,24,11,250,244,190,29,11,28,
+5,137,28,5,6,21,175,10,247,52,28,4,209,6,248,57,29,11,60,29,14,116,29,247,
+35,63,247,113,248,87,10,30,11,28,6,127,28,5,231,21,247,60,251,1,247,1,251,
+19,41,74,71,59,68,194,73,139,30,247,82,6,251,107,64,251,23,251,85,59,30,247,
+48,247,184,29,237,147,5,227,252,39,51,7,235,177,29,248,168,7,247,138,217,
+247,68,247,82,247,148,26,11,250,244,138,10,11,240,29,14,250,226,22,219,7,
+51,247,110,10,28,5,98,158,10,7,247,78,4,226,29,11,250,175,247,67,10,28,4,
+109,247,122,29,254,216,7,119,125,116,248,49,10,11,28,5,176,22,227,7,117,10,
+7,11,28,5,16,250,214,21,247,25,55,227,39,67,76,94,67,82,182,83,139,30,247,
+48,6,251,4,44,57,45,88,30,247,68,220,10,247,217,247,233,29,248,255,7,247,
+44,196,247,49,247,41,247,26,26,11,21,251,164,247,210,5,174,110,117,159,84,
+27,67,114,90,96,102,160,113,168,120,31,247,203,251,91,5,251,177,22,251,164,
+247,210,5,174,108,119,159,81,27,70,114,90,96,102,159,113,166,120,31,247,203,
+251,91,5,14,174,29,247,234,28,251,145,5,247,42,6,247,205,28,5,15,5,11,28,
+5,66,249,70,160,10,11,69,29,14,28,7,14,22,227,71,10,11,250,197,22,219,156,
+10,7,11,28,5,133,22,219,77,29,11,248,82,68,10,11,21,182,117,188,67,84,116,
+119,104,111,30,251,167,251,210,5,247,9,6,247,203,247,91,5,166,158,159,165,
+176,26,252,35,22,182,247,173,10,158,159,165,176,26,14,28,4,147,22,113,10,
+11,28,5,135,248,95,29,252,117,51,7,247,17,133,167,137,160,116,129,119,25,
+251,212,253,48,251,238,249,48,127,161,159,160,168,141,25,247,21,145,5,227,
+252,224,51,7,247,52,127,248,136,254,70,98,67,100,65,88,100,25,251,116,227,
+5,84,98,96,84,100,26,86,194,63,247,21,247,69,247,0,247,13,247,37,211,30,248,
+142,250,163,5,11,28,5,127,241,21,247,15,7,78,65,61,88,251,14,27,251,38,47,
+219,198,80,31,247,164,248,203,7,139,143,188,162,26,247,111,43,247,89,251,
+136,251,50,53,57,100,107,30,184,108,90,215,251,85,27,251,78,251,107,65,251,
+60,92,163,127,193,31,247,35,247,70,6,147,159,182,157,205,27,247,29,180,68,
+251,27,31,55,7,252,52,32,251,51,82,251,109,26,251,44,231,251,9,247,64,247,
+72,247,72,247,48,139,139,247,27,251,48,247,130,247,56,247,9,223,182,198,30,
+253,142,230,21,139,251,19,44,43,32,90,221,231,247,15,217,209,247,193,221,
+30,248,195,204,21,252,4,6,247,40,182,247,47,247,43,247,13,192,251,10,251,
+15,30,11,143,10,14,28,5,45,165,29,248,189,22,219,247,47,10,7,11,247,240,29,
+35,251,13,247,224,29,244,247,12,170,31,11,250,252,248,20,29,252,156,248,200,
+247,201,6,247,176,29,251,201,248,146,248,82,86,10,11,248,19,10,221,6,247,
+9,163,238,188,239,27,240,237,90,251,9,165,31,14,68,29,14,28,4,135,247,8,29,
+254,216,247,139,10,249,4,21,251,68,47,39,251,158,116,88,141,139,30,248,154,
+7,248,113,10,221,253,21,248,101,10,248,177,248,60,29,11,28,5,45,71,29,11,
+28,6,195,22,227,7,251,3,247,5,29,247,3,147,5,227,252,107,155,29,11,251,185,
+72,29,14,134,10,252,152,7,251,25,120,196,223,84,31,43,247,42,172,247,76,251,
+40,247,37,8,188,90,69,160,70,27,42,66,82,77,92,167,92,187,100,31,247,105,
+227,247,0,251,0,129,251,38,200,251,29,25,182,49,195,61,202,110,63,135,57,
+98,107,84,251,177,252,93,24,251,42,129,5,51,247,241,205,7,247,199,248,111,
+167,186,182,159,203,143,25,252,107,7,247,27,10,7,11,248,75,10,203,208,186,
+174,30,42,6,82,100,53,49,247,149,10,14,250,222,22,88,10,11,227,7,251,17,147,
+248,18,29,247,17,147,5,247,87,10,11,247,111,10,14,250,138,248,209,10,248,
+210,7,247,70,70,247,19,251,146,251,95,251,115,67,251,60,88,178,131,176,30,
+247,41,247,70,6,147,160,192,157,211,27,247,23,194,248,184,10,72,34,251,43,
+26,251,64,247,11,43,247,39,247,52,247,70,247,29,139,30,166,251,13,5,112,247,
+85,21,139,251,31,50,251,1,41,84,217,223,240,171,227,248,5,231,30,11,28,5,
+33,39,10,168,249,48,21,249,101,243,253,101,6,28,5,37,57,160,10,14,28,5,119,
+28,5,150,247,14,10,238,85,10,11,247,111,29,249,4,57,7,251,154,60,5,71,247,
+45,28,251,49,115,10,252,164,7,114,118,121,115,137,30,55,133,5,59,11,249,177,
+28,5,106,150,29,11,113,10,247,68,28,5,72,86,29,21,247,38,251,0,247,0,251,
+60,63,65,121,79,66,30,247,89,165,247,40,247,1,247,62,27,184,214,6,251,230,
+251,87,251,84,251,185,251,160,247,32,38,247,72,247,72,247,35,247,9,247,211,
+29,158,137,161,248,111,29,70,251,13,31,14,51,7,194,219,131,139,31,166,137,
+157,114,123,26,252,7,100,252,78,84,251,27,30,73,110,90,53,100,27,251,80,207,
+5,77,98,90,77,70,207,83,208,247,52,247,19,199,247,86,229,31,205,247,29,182,
+248,5,248,179,26,11,248,240,247,16,29,11,247,116,29,254,119,51,6,245,247,
+182,29,254,216,7,248,0,10,33,131,5,51,7,11,28,6,125,22,227,7,251,17,248,82,
+29,160,168,141,30,247,17,147,5,229,252,177,49,7,247,13,131,248,159,10,254,
+216,247,235,10,251,13,131,5,51,7,109,248,95,10,251,103,217,10,247,26,247,
+236,29,251,122,247,112,29,11,247,238,29,249,143,28,4,152,5,247,107,29,7,11,
+59,7,238,133,161,137,141,119,149,130,25,251,156,115,251,197,94,43,30,106,
+124,117,88,108,27,251,41,213,5,67,106,79,82,84,195,91,194,217,247,23,156,
+247,29,217,31,202,246,174,247,154,248,25,26,11,28,5,76,22,219,7,40,145,5,
+117,248,171,29,249,133,7,152,149,155,161,141,30,238,145,5,219,252,91,59,7,
+237,133,5,164,137,149,123,126,26,253,133,248,53,10,41,133,5,59,7,149,247,
+189,21,247,101,251,66,247,2,251,135,91,248,184,29,164,141,30,247,0,145,5,
+219,252,91,59,7,226,133,5,161,137,151,248,108,10,38,248,66,10,251,94,22,251,
+1,118,248,5,29,191,45,251,27,30,11,247,68,29,248,197,249,185,5,247,114,10,
+7,11,28,5,18,22,227,95,29,11,21,247,49,251,9,233,251,76,51,49,109,139,30,
+247,200,29,51,59,34,251,31,106,90,152,157,118,30,88,247,7,5,135,121,143,124,
+27,92,102,114,94,76,247,7,63,247,31,247,136,247,23,247,5,247,60,31,11,250,
+162,248,21,21,103,29,248,9,247,70,247,42,247,160,31,11,5,251,46,6,252,113,
+28,250,242,251,11,114,5,51,248,48,227,7,251,13,149,5,125,118,164,155,145,
+31,247,28,248,5,5,248,109,6,11,27,247,87,218,251,61,251,140,251,196,251,44,
+251,22,251,85,107,70,145,151,89,31,158,66,5,122,212,204,126,208,27,247,142,
+247,113,247,90,248,7,247,167,251,66,247,75,251,175,11,28,6,164,248,206,29,
+252,99,59,7,225,133,5,162,137,159,121,114,26,253,52,7,113,92,45,106,61,27,
+251,23,88,219,247,9,31,248,170,7,164,157,157,164,141,30,225,145,5,219,252,
+85,59,7,225,133,5,164,137,157,121,114,26,253,54,7,107,76,53,114,71,27,251,
+29,94,221,247,19,31,248,158,7,164,157,157,164,141,30,223,145,5,219,252,95,
+59,7,237,133,5,164,137,157,121,114,26,252,203,7,251,31,191,251,67,247,107,
+247,0,247,58,230,190,221,30,71,174,208,65,247,11,27,246,247,29,211,194,231,
+31,11,28,5,176,247,209,29,7,247,207,10,250,216,248,207,10,252,152,49,7,247,
+205,10,253,56,120,10,249,56,216,29,188,7,247,117,247,30,248,170,10,14,247,
+244,29,243,247,78,27,164,165,139,137,154,31,251,203,7,124,124,123,119,137,
+30,51,133,5,59,248,64,219,7,51,145,5,120,140,123,158,152,26,249,129,7,160,
+147,147,166,141,30,227,147,5,219,252,74,7,251,142,251,54,74,251,91,251,35,
+247,7,71,247,17,108,31,251,21,105,88,32,248,143,29,247,253,249,21,21,247,
+6,212,205,247,97,30,207,252,11,6,137,120,102,139,121,27,251,72,47,188,247,
+40,31,14,250,54,28,4,251,21,239,251,30,247,26,251,168,251,67,251,49,34,251,
+70,251,15,247,55,46,247,49,251,13,30,251,108,56,251,110,251,28,251,145,26,
+251,212,247,120,251,14,247,132,247,111,247,128,247,55,247,212,30,248,110,
+253,35,247,41,247,74,26,232,237,185,213,204,197,110,97,192,30,182,251,53,
+5,127,156,183,135,156,27,221,180,204,195,31,251,37,253,211,21,251,116,49,
+251,45,251,63,251,29,251,2,247,11,247,121,247,117,247,57,247,12,247,30,207,
+30,247,4,40,232,251,12,251,57,26,14,21,247,56,7,251,36,251,69,251,3,93,251,
+41,27,251,184,251,92,247,103,248,29,31,250,78,6,139,143,198,160,26,248,35,
+251,74,247,98,252,14,251,207,251,150,251,114,251,250,86,30,251,0,6,56,105,
+171,186,125,31,247,18,247,138,5,176,103,95,153,108,27,59,56,46,251,10,251,
+40,227,251,14,247,70,31,247,3,6,252,153,247,181,251,130,247,245,247,80,247,
+87,206,247,2,247,34,30,254,47,249,63,21,247,86,153,247,25,247,161,247,117,
+27,247,117,247,16,251,65,251,119,31,76,7,14,7,51,145,5,117,141,128,155,152,
+26,249,133,7,154,150,153,161,141,30,227,248,15,10,162,137,151,125,124,26,
+247,158,10,227,248,15,10,162,151,123,124,31,247,158,10,236,145,5,219,252,
+77,59,7,225,133,5,164,149,123,124,31,253,133,248,53,10,53,133,5,59,11,249,
+218,247,166,21,125,10,102,247,25,225,124,245,27,247,191,247,36,247,1,247,
+82,31,11,227,7,251,3,248,93,29,250,220,7,155,153,162,168,143,30,247,3,248,
+111,10,135,153,116,123,26,73,7,252,246,253,123,5,249,189,7,155,153,162,170,
+143,30,247,11,147,5,227,252,158,51,7,247,0,247,180,10,116,110,135,30,251,
+0,248,143,10,108,141,125,164,155,26,242,7,248,246,249,121,5,253,224,7,123,
+125,114,248,49,10,11,21,247,47,87,247,11,251,53,251,14,52,251,66,251,74,30,
+251,91,7,45,178,66,231,247,42,26,247,68,209,159,159,179,158,133,101,165,30,
+139,146,247,12,36,251,40,74,251,14,251,42,251,109,247,7,40,247,78,110,30,
+251,70,7,127,123,126,127,138,30,67,248,192,10,127,140,122,152,151,26,247,
+70,7,247,75,168,247,7,247,35,247,65,26,251,26,22,251,23,83,35,251,9,93,30,
+247,91,7,247,68,177,241,186,196,170,93,251,42,30,14,21,138,247,52,251,11,
+189,251,22,158,8,224,158,211,209,247,3,26,247,17,59,218,251,45,251,126,90,
+251,71,251,61,30,253,121,7,127,129,123,123,137,30,74,133,5,91,247,202,187,
+7,64,145,5,129,129,150,158,31,249,133,7,226,109,247,81,247,58,230,181,69,
+65,251,3,80,69,251,26,140,30,137,119,139,120,123,26,247,92,143,224,52,251,
+33,26,251,52,45,106,52,102,102,148,160,96,30,70,7,122,176,191,131,180,27,
+247,39,247,41,204,247,114,137,31,14,7,251,51,251,23,44,251,5,94,80,148,159,
+116,30,69,247,64,5,139,117,149,112,78,88,84,78,251,44,247,39,94,247,113,247,
+171,247,39,247,125,247,85,30,11,247,86,10,247,242,11,113,29,51,7,11,250,75,
+249,165,21,248,151,29,249,35,247,153,10,251,169,252,74,247,169,247,153,29,
+253,35,247,20,10,7,14,7,159,53,251,21,152,64,27,252,9,251,111,251,101,251,
+226,251,164,247,45,251,114,247,144,231,247,11,182,176,215,31,11,28,6,186,
+22,227,7,251,2,247,5,29,247,2,147,5,227,252,98,157,29,11,219,7,53,145,5,117,
+248,144,10,161,141,30,225,248,15,10,164,137,149,123,126,26,109,7,252,121,
+252,193,5,248,223,7,152,151,155,162,141,30,235,145,5,219,252,76,59,7,225,
+248,10,29,53,133,5,59,248,76,219,7,43,145,5,116,141,127,155,152,26,194,7,
+248,121,248,193,5,252,248,248,53,10,45,133,5,59,7,11,7,155,154,162,167,143,
+30,247,1,147,5,227,252,156,51,7,247,11,131,5,167,135,154,116,123,26,254,212,
+7,121,124,114,111,30,252,15,6,110,125,166,158,31,250,209,247,92,29,252,158,
+51,7,247,13,131,5,167,135,154,116,123,26,254,209,7,120,124,112,111,30,252,
+15,6,108,127,166,158,31,250,209,247,102,29,11,247,184,10,41,133,5,59,248,
+97,219,7,51,145,5,114,141,123,157,248,172,29,172,198,231,165,211,27,247,50,
+184,53,251,9,31,11,247,78,29,247,82,247,170,10,254,68,115,10,252,164,7,114,
+118,121,115,137,30,55,133,5,59,7,14,247,207,10,250,216,152,10,216,29,11,28,
+5,154,249,66,21,247,129,29,251,103,246,251,25,247,180,247,36,247,23,168,145,
+168,30,227,7,135,120,61,121,39,27,251,80,46,233,247,45,137,31,248,198,10,
+251,134,22,247,55,29,251,0,247,182,10,248,206,7,247,123,251,69,211,251,31,
+47,251,52,73,80,41,30,247,240,243,29,254,220,7,247,160,10,248,255,7,182,219,
+219,184,208,27,247,50,211,92,251,21,31,252,167,7,117,120,120,115,137,30,38,
+131,5,51,11,248,97,228,29,248,165,11,28,4,147,247,3,21,247,168,251,152,247,
+119,251,180,30,248,121,248,249,5,247,39,254,99,248,43,10,248,218,6,252,138,
+253,5,203,67,5,150,151,164,157,192,27,247,41,247,126,251,31,251,152,251,101,
+251,74,251,150,251,114,64,77,174,175,78,31,65,248,37,29,247,62,251,60,247,
+209,247,234,247,191,247,156,247,208,31,11,28,4,172,249,70,21,248,58,251,173,
+247,187,252,70,251,17,251,6,116,92,251,54,30,251,207,247,7,7,167,247,66,143,
+160,154,161,155,147,25,156,172,215,173,247,6,27,247,161,247,109,251,72,252,
+6,155,31,252,205,44,248,205,6,252,6,121,251,95,251,99,251,199,27,251,1,69,
+165,139,31,117,150,125,155,137,155,91,247,109,24,251,2,251,215,6,139,247,
+88,67,247,99,248,105,247,136,247,253,247,254,30,11,21,247,28,251,0,247,0,
+251,27,248,23,29,247,27,247,0,247,0,247,27,30,39,248,133,29,205,219,219,202,
+73,59,30,14,22,227,128,10,7,11,167,10,251,25,53,62,251,54,57,68,173,150,114,
+30,131,143,123,155,137,151,114,247,7,24,41,251,123,6,11,129,29,14,250,123,
+125,21,247,109,251,94,247,95,251,142,30,248,33,248,80,247,24,10,201,10,11,
+232,10,252,150,51,7,247,27,115,248,9,252,220,247,9,10,11,7,47,145,5,118,141,
+125,151,158,26,249,129,7,158,153,151,160,248,102,10,159,154,127,120,31,251,
+234,7,109,75,86,120,81,27,251,19,111,174,231,31,247,98,10,247,48,87,247,3,
+212,242,187,182,217,30,251,222,7,120,124,127,119,137,30,57,133,5,11,116,248,
+144,10,162,141,30,229,145,5,219,252,34,92,7,251,182,253,111,251,189,249,117,
+5,180,251,251,59,7,234,248,10,29,44,133,5,59,247,251,219,7,42,145,5,117,141,
+127,155,152,26,249,125,7,247,242,253,242,5,237,6,247,244,250,3,5,253,142,
+7,126,129,123,117,137,30,49,133,5,59,11,250,218,252,82,21,247,232,10,28,5,
+14,111,10,252,6,248,100,29,7,247,56,248,207,159,10,249,252,248,134,21,247,
+195,251,94,247,103,251,204,49,57,122,105,251,8,30,251,128,231,7,159,247,17,
+141,153,150,156,153,145,25,149,161,182,166,223,27,247,85,245,251,7,251,146,
+152,31,252,15,39,248,15,6,251,150,124,53,251,23,251,113,27,61,90,157,139,
+31,123,147,129,149,137,152,106,247,47,24,49,251,133,6,139,247,33,85,247,41,
+247,228,247,68,247,153,247,154,30,11,210,247,96,30,249,253,152,10,251,212,
+7,251,158,11,7,251,39,149,251,179,248,93,106,194,57,180,64,143,25,202,168,
+194,217,182,229,201,247,29,129,247,88,29,172,251,76,43,251,42,8,55,83,123,
+82,251,27,27,248,152,247,234,10,247,4,149,5,227,252,154,51,7,247,5,247,181,
+10,11,248,150,28,5,43,21,147,10,11,21,173,97,167,106,30,53,251,10,5,76,115,
+162,247,9,98,31,65,247,113,247,196,248,93,5,251,30,6,251,106,251,211,77,247,
+76,5,235,108,98,193,48,27,251,5,56,91,74,106,183,111,172,31,223,247,8,5,204,
+162,123,251,9,179,31,217,251,119,251,197,252,93,5,247,30,6,247,105,247,213,
+199,251,72,5,45,171,181,79,230,27,247,5,220,185,204,31,14,7,224,29,250,212,
+247,36,10,11,22,140,10,11,142,29,14,219,141,29,7,11,248,43,29,252,154,248,
+200,247,199,6,247,145,10,248,146,248,80,86,10,11,21,247,161,251,31,237,251,
+72,251,72,251,36,251,9,251,72,251,37,247,1,251,1,247,60,215,212,158,198,213,
+30,112,251,89,251,39,251,6,251,62,145,92,141,24,61,7,247,230,247,88,247,87,
+247,184,31,251,31,164,21,121,141,116,135,112,30,103,86,71,114,82,27,251,9,
+67,211,247,12,247,15,201,234,248,121,10,21,243,74,180,57,116,129,133,137,
+124,30,247,73,58,251,173,7,139,167,151,158,194,180,114,88,76,73,118,74,88,
+65,156,139,30,59,7,139,219,118,210,247,30,239,207,247,19,30,11,7,247,8,10,
+251,232,6,116,129,158,151,31,249,119,7,152,149,155,162,141,30,235,145,5,219,
+252,77,247,4,29,11,247,240,29,34,251,12,247,224,29,243,247,13,170,31,14,247,
+97,251,76,247,13,168,10,247,87,88,251,107,11,167,29,247,252,22,167,29,247,
+252,22,167,29,11,7,164,157,155,164,141,30,237,147,5,219,252,99,59,7,227,131,
+5,164,137,157,123,114,26,253,54,7,109,80,47,108,67,27,251,50,94,227,247,9,
+31,247,187,7,247,125,37,247,50,251,140,251,17,71,79,72,49,227,114,139,30,
+247,77,247,33,5,200,115,158,98,251,66,26,252,17,7,251,101,247,13,32,247,49,
+246,247,49,219,184,213,30,11,247,14,10,247,89,248,240,21,247,101,74,7,114,
+35,5,252,29,6,247,131,247,66,247,107,247,43,247,66,26,247,34,251,0,233,251,
+64,251,48,251,27,63,37,90,178,116,182,180,161,159,139,30,247,28,7,141,146,
+180,163,200,27,241,211,78,251,11,251,62,251,72,251,25,251,163,251,99,31,57,
+7,11,247,23,29,192,247,157,10,35,4,247,211,10,11,154,10,14,218,29,254,216,
+7,247,104,29,11,162,29,14,248,122,29,251,7,73,247,6,29,248,0,29,30,251,97,
+248,161,247,45,10,11,157,10,14,7,251,0,151,163,10,11,179,10,251,107,202,247,
+187,10,141,37,247,221,29,11,247,48,29,243,201,211,233,31,251,1,11,21,125,
+94,59,124,247,148,29,231,10,251,124,135,21,252,58,251,99,251,52,251,207,135,
+30,251,58,137,5,28,4,154,247,48,7,247,215,247,101,251,52,252,66,31,11,247,
+57,10,248,101,219,7,51,247,110,10,247,226,247,6,7,11,247,104,29,216,29,11,
+251,245,248,148,248,242,10,247,148,252,21,5,59,11,21,247,25,46,211,251,21,
+202,30,251,47,219,89,178,231,26,219,188,196,239,197,196,115,116,165,30,153,
+251,35,5,235,247,134,6,157,103,48,168,251,0,27,251,105,251,11,251,7,251,74,
+251,15,212,73,247,26,68,31,247,35,63,221,102,251,7,26,57,79,62,34,67,84,169,
+166,102,30,117,247,66,5,45,11,248,116,10,219,247,95,6,247,144,29,11,248,173,
+247,122,10,11,247,42,251,1,225,177,10,11,251,95,151,30,247,130,209,235,247,
+37,247,19,26,247,2,29,251,70,251,33,45,251,70,118,109,141,139,31,251,13,7,
+139,173,147,215,247,15,11,21,247,187,251,75,247,109,251,178,251,32,251,6,
+88,89,47,30,251,8,7,196,227,223,170,233,27,247,117,247,7,251,75,251,119,251,
+129,251,3,251,67,251,74,112,109,148,155,110,31,247,72,7,156,114,107,155,94,
+27,77,80,100,59,251,25,247,29,67,247,72,247,154,247,124,247,73,247,236,31,
+14,191,29,252,11,247,148,251,240,248,95,11,247,103,29,28,250,174,246,29,11,
+21,247,131,10,11,7,129,59,108,49,27,251,212,251,97,247,117,248,29,245,29,
+252,15,247,150,251,236,248,93,248,165,10,11,209,215,21,90,231,247,7,87,247,
+31,27,247,179,247,74,247,110,247,186,247,236,251,123,247,73,251,154,251,72,
+251,30,67,251,25,59,199,98,200,184,172,158,155,164,31,247,70,7,155,167,170,
+150,166,27,247,74,247,2,251,66,251,130,251,119,251,6,251,75,251,117,44,55,
+170,197,51,31,11,247,39,29,254,216,247,127,29,250,130,7,249,142,28,251,133,
+5,11,21,247,204,72,65,247,30,57,27,86,101,32,110,110,139,121,162,31,161,151,
+214,174,27,198,247,20,251,168,251,8,145,31,139,86,251,10,60,26,60,166,84,
+176,176,160,212,202,202,115,247,15,139,30,177,247,3,247,83,247,155,247,11,
+26,36,6,251,26,45,251,59,91,251,25,30,14,251,54,147,30,247,83,190,176,244,
+229,26,247,25,10,251,19,55,80,251,33,122,115,141,139,31,33,7,139,167,145,
+199,237,247,17,112,251,48,11,7,121,113,116,120,137,30,41,131,5,61,248,99,
+217,7,55,247,255,10,249,54,7,174,208,232,163,216,27,247,36,200,68,251,21,
+31,253,138,7,251,68,59,38,76,30,251,58,247,64,5,123,65,88,55,76,182,69,247,
+11,247,105,247,107,247,25,247,195,31,14,250,168,248,128,21,247,180,251,70,
+247,124,251,197,247,19,10,247,183,29,30,11,7,119,123,248,50,29,248,174,227,
+7,251,27,241,10,11,7,251,11,145,251,131,247,246,110,182,117,158,89,149,25,
+186,174,168,192,160,174,190,219,135,235,186,186,247,84,51,24,186,178,158,
+176,186,26,200,67,197,41,69,74,98,79,104,30,86,55,147,62,69,36,88,63,125,
+125,67,108,8,247,236,7,152,149,155,164,141,30,225,145,5,219,11,251,64,219,
+83,178,231,199,29,251,15,221,73,247,41,68,31,247,50,63,231,102,251,7,247,
+82,10,11,250,64,190,10,11,250,154,21,59,6,133,49,5,115,137,121,118,114,27,
+254,5,55,6,219,251,142,5,209,247,36,249,66,6,163,90,176,50,55,26,251,37,53,
+86,251,37,30,253,46,57,6,219,251,144,5,209,247,35,248,191,6,247,123,240,246,
+247,68,247,13,51,247,29,85,209,31,247,9,6,11,251,121,21,247,183,35,251,194,
+222,10,11,247,94,10,253,91,188,10,248,212,248,73,29,11,21,241,251,51,248,
+89,55,7,251,144,61,5,71,247,37,251,199,251,90,37,247,90,252,136,247,15,10,
+247,218,7,14,247,250,10,131,5,61,248,148,219,7,251,27,247,110,10,11,247,241,
+29,14,28,5,6,198,29,11,155,251,117,21,247,60,53,6,200,10,225,247,190,242,
+251,190,247,8,7,248,81,29,186,29,11,184,247,21,31,248,29,243,29,252,66,7,
+251,126,11,7,251,41,149,251,228,248,113,104,193,88,161,65,143,25,247,135,
+29,247,106,10,11,21,247,13,7,149,123,102,148,110,27,76,65,55,100,100,31,247,
+0,86,7,251,58,92,5,98,235,252,62,248,53,29,74,134,5,92,247,226,186,7,51,247,
+253,29,247,238,7,186,184,184,168,182,27,172,161,125,120,158,31,14,21,213,
+7,102,80,63,102,64,27,251,65,90,247,25,247,19,31,248,68,172,6,247,39,55,244,
+251,55,251,75,251,23,251,17,251,85,251,97,247,40,41,247,54,229,227,172,182,
+212,30,251,25,247,205,21,251,185,6,246,148,206,204,227,27,227,180,76,59,31,
+14,7,201,10,14,28,6,102,249,7,21,247,248,29,211,251,43,128,251,87,123,72,
+69,247,97,29,212,194,191,8,14,248,22,10,57,7,251,144,61,5,72,247,35,253,91,
+247,184,10,41,133,5,59,248,97,248,126,29,143,121,155,248,172,29,174,208,217,
+165,215,27,247,35,195,66,251,21,31,11,21,247,172,29,11,114,121,123,114,137,
+247,222,29,11,248,11,10,251,25,251,97,251,56,251,14,251,91,251,85,74,81,160,
+169,86,248,35,29,39,247,39,251,23,247,169,247,189,247,127,247,99,247,140,
+31,11,247,66,178,247,54,227,247,107,26,247,162,251,83,233,251,203,30,252,
+170,51,6,245,247,182,29,254,216,7,248,0,10,33,131,5,51,248,145,248,117,10,
+248,103,7,143,184,143,182,11,207,10,14,247,205,247,30,10,250,15,21,190,98,
+209,251,38,251,123,251,40,251,56,251,109,30,252,136,7,123,113,116,122,137,
+30,41,129,5,59,248,113,219,7,39,149,5,122,141,111,162,155,26,248,136,7,247,
+121,186,190,215,141,30,248,178,29,11,249,160,249,158,247,94,10,11,21,247,
+128,35,247,82,251,109,251,109,34,251,82,251,128,251,127,244,251,85,247,109,
+247,109,243,247,85,247,127,30,251,33,22,251,76,100,251,75,251,33,251,34,99,
+247,75,247,76,247,76,179,247,75,247,34,247,33,178,251,75,251,76,30,11,248,
+106,29,251,40,112,70,37,251,11,26,251,58,247,33,251,17,247,136,247,189,247,
+127,247,85,247,86,247,132,10,11,28,6,170,248,77,10,231,204,244,26,247,11,
+251,13,248,26,10,39,106,49,247,55,10,11,28,5,6,21,247,117,29,251,238,254,
+132,251,252,250,136,247,56,29,248,105,28,250,237,5,247,48,6,248,95,28,5,17,
+5,11,249,238,249,66,21,247,191,253,187,247,48,10,249,150,247,69,10,11,248,
+50,247,23,218,10,11,247,9,7,81,51,55,108,44,27,251,117,248,107,10,247,74,
+247,134,10,248,94,10,11,248,54,10,240,147,5,217,252,148,59,7,247,27,248,90,
+10,252,211,247,77,29,11,21,105,86,65,102,57,247,169,29,14,247,50,10,247,9,
+29,11,248,58,29,164,168,141,30,247,29,147,5,227,252,174,51,7,247,101,10,11,
+21,250,5,55,7,251,144,61,5,71,247,37,254,33,247,15,10,11,7,247,21,96,247,
+62,251,25,251,95,26,251,72,32,251,7,251,2,141,30,98,98,150,165,102,31,84,
+247,70,5,139,98,170,89,57,113,82,79,43,247,37,251,17,247,116,247,133,247,
+76,247,34,247,115,30,14,248,64,29,50,102,247,95,10,247,13,247,29,227,193,
+209,30,251,9,11,248,42,10,247,28,10,11,7,51,96,107,67,30,251,56,248,17,10,
+229,69,247,13,247,68,225,221,247,48,30,11,21,247,151,29,251,144,253,21,251,
+121,249,21,241,29,247,222,254,19,5,247,25,6,247,250,250,19,5,11,251,129,249,
+148,247,15,29,247,134,253,146,5,247,37,6,11,92,251,115,135,122,125,123,118,
+131,25,137,135,74,106,43,27,251,216,251,87,247,121,248,17,248,29,247,105,
+247,101,247,171,241,215,100,125,170,31,151,133,160,116,141,121,169,251,78,
+24,247,15,247,213,6,11,116,147,119,149,127,30,247,214,252,70,5,247,15,6,251,
+134,248,143,5,139,92,205,65,66,112,98,96,30,11,21,247,22,253,66,251,22,7,
+11,247,238,10,227,213,86,39,30,164,252,54,248,3,10,247,57,78,238,106,39,26,
+14,21,221,247,219,10,247,140,49,7,247,130,10,11,247,162,10,254,216,7,247,
+161,29,11,248,179,29,252,164,51,6,247,0,247,182,29,254,216,7,119,123,248,
+50,29,248,205,7,248,150,247,89,247,224,247,250,31,11,7,251,19,164,252,39,
+249,10,248,16,248,159,247,24,159,5,247,65,29,11,251,222,250,222,5,251,50,
+6,251,213,254,189,251,136,250,48,135,157,145,160,158,141,25,247,14,151,5,
+227,252,105,51,7,247,11,115,247,226,28,250,241,5,247,40,6,247,227,28,4,111,
+11,248,17,248,151,10,251,27,251,91,26,251,11,204,68,244,213,188,194,209,186,
+248,187,10,151,26,247,28,243,241,205,213,30,14,7,121,114,116,121,137,30,251,
+5,131,5,59,248,134,219,7,251,3,147,5,121,141,114,162,157,26,11,247,21,29,
+96,59,251,52,74,50,27,11,28,4,238,28,5,6,21,248,44,10,251,209,252,165,251,
+181,248,171,247,243,29,11,246,29,14,223,156,220,30,137,155,155,139,156,27,
+247,86,247,48,247,13,247,42,31,251,3,145,21,61,53,65,53,107,114,143,146,110,
+30,243,166,184,247,11,247,1,27,188,167,102,94,31,14,21,248,13,29,11,147,5,
+110,141,125,162,159,26,11,7,247,163,29,11,7,163,159,158,164,141,30,247,11,
+147,5,227,252,158,51,7,243,131,5,164,137,159,120,115,26,11,7,155,153,166,
+168,30,247,236,247,115,10,254,43,51,6,247,0,247,180,10,114,110,137,30,11,
+248,63,10,248,124,29,33,131,5,51,248,156,227,7,251,11,147,5,108,141,127,164,
+155,26,250,212,7,157,151,164,170,30,11,248,17,250,21,247,18,29,7,247,99,29,
+251,1,247,214,219,7,51,247,110,10,11,26,247,31,240,241,247,58,29,251,95,251,
+50,251,135,11,247,140,49,6,247,31,10,248,208,11,21,186,7,139,98,121,85,70,
+102,173,238,30,247,234,247,80,200,251,80,247,40,81,7,80,251,21,49,100,5,98,
+223,252,44,7,41,182,100,237,235,226,180,139,30,14,133,5,162,137,147,125,124,
+26,253,133,7,124,131,125,116,137,30,11,247,45,251,19,206,251,25,56,51,99,
+69,102,166,112,139,30,247,83,6,185,127,158,92,83,26,33,62,37,251,80,65,30,
+40,7,247,133,227,247,64,247,53,247,93,26,11,247,43,10,252,86,59,7,247,13,
+121,11,27,247,191,247,62,247,118,247,183,31,251,105,141,21,247,101,29,11,
+247,25,29,252,79,59,7,236,133,5,161,137,151,123,126,26,253,119,7,127,127,
+120,117,30,11,252,48,252,201,247,32,29,11,21,193,7,251,79,168,72,247,65,247,
+165,26,247,164,206,247,65,247,79,167,30,193,7,251,170,111,40,251,123,251,
+160,26,251,160,238,251,124,247,170,110,30,14,21,247,160,40,247,123,251,171,
+167,30,85,7,247,80,111,204,251,65,251,164,26,251,165,74,251,65,251,80,110,
+30,85,7,247,171,168,238,247,124,247,160,26,14,247,140,49,7,248,14,10,247,
+208,29,11,248,50,10,247,151,10,11,21,251,21,6,254,34,28,250,106,5,247,21,
+6,11,7,251,50,117,251,23,63,96,248,103,29,61,211,104,223,247,21,247,19,200,
+247,21,223,30,208,247,1,150,247,70,247,15,26,11,51,7,194,217,131,139,31,167,
+137,158,114,123,26,252,7,49,252,68,73,251,23,30,33,251,107,251,122,53,139,
+26,252,56,248,202,10,11,86,69,88,170,106,139,30,247,21,6,129,143,127,124,
+26,251,19,49,37,247,223,29,247,8,78,215,11,251,181,247,29,29,251,195,251,
+80,251,120,251,184,251,187,247,78,251,114,247,191,11,7,127,129,125,120,138,
+30,70,134,5,86,247,229,192,7,63,247,252,10,247,209,248,74,251,209,7,127,129,
+125,121,138,30,63,134,5,86,11,247,92,29,252,174,51,7,247,29,131,5,168,137,
+153,114,123,26,252,23,7,139,47,149,82,251,196,251,123,251,45,251,183,11,251,
+11,21,247,211,252,228,49,248,124,247,80,29,11,247,4,38,189,33,58,84,99,89,
+96,160,115,139,30,247,44,6,174,129,156,118,107,26,73,79,69,251,42,85,30,62,
+7,247,84,203,247,28,244,247,48,26,11,5,247,29,253,203,252,11,245,7,160,247,
+48,5,157,141,155,164,160,27,248,113,6,11,247,43,251,58,236,251,85,33,34,126,
+78,251,31,30,251,115,237,7,164,247,11,141,153,157,151,148,147,25,160,161,
+196,172,221,27,247,1,231,91,251,23,11,247,170,29,169,5,252,45,247,178,10,
+11,121,125,116,110,137,30,251,5,129,5,51,248,154,227,7,251,4,248,146,10,202,
+135,182,119,170,92,247,197,252,111,24,73,11,247,35,7,247,73,29,91,215,247,
+23,30,11,21,205,205,251,4,247,4,247,4,247,4,73,205,251,4,251,4,251,4,247,
+4,73,73,247,4,251,4,251,4,251,4,205,73,247,4,247,4,5,14,249,76,247,50,29,
+247,130,10,247,70,29,11,21,32,198,80,225,199,192,176,198,182,114,166,133,
+143,30,251,13,6,247,10,178,178,247,1,174,30,199,7,251,38,112,251,0,51,251,
+33,26,14,228,252,170,50,7,247,29,129,5,168,137,153,119,118,26,11,35,21,233,
+81,250,99,28,6,101,42,196,5,11,247,185,10,28,4,131,247,234,10,251,144,28,
+251,104,21,11,247,102,29,248,124,29,33,131,5,51,11,249,64,250,203,247,59,
+29,11,247,192,10,247,193,248,67,10,11,235,217,102,123,178,31,157,131,158,
+122,143,115,172,251,76,24,247,15,247,223,6,172,251,17,251,15,176,251,46,27,
+252,95,251,174,251,179,252,66,11,247,220,29,14,26,248,198,10,247,129,29,11,
+247,189,10,247,68,251,154,247,119,10,11,248,69,29,116,129,127,25,251,70,251,
+121,251,54,247,121,131,153,149,160,158,141,25,210,149,5,219,11,21,217,96,
+196,71,92,104,100,96,106,160,119,143,135,30,223,6,251,5,86,96,44,121,30,94,
+7,247,13,149,247,3,229,247,15,26,14,21,252,86,6,247,68,149,245,247,0,247,
+27,27,247,28,202,35,251,27,31,11,248,127,29,247,23,199,248,184,10,68,34,251,
+43,26,251,64,247,10,34,247,40,11,7,251,3,145,247,71,10,11,59,7,247,61,29,
+11,241,7,251,52,43,232,247,55,247,48,235,237,247,52,31,244,7,251,126,251,
+17,251,52,251,91,251,96,247,17,251,46,247,126,31,14,205,79,196,251,8,251,
+26,251,27,66,251,46,59,30,11,7,247,60,29,11,67,84,47,31,241,55,7,251,140,
+61,5,72,247,33,253,91,247,57,10,248,99,248,126,29,11,247,213,29,31,251,92,
+22,248,139,10,11,248,52,10,253,131,247,156,29,11,80,251,5,26,251,31,247,17,
+43,247,88,247,75,247,31,237,247,31,30,11,141,247,23,141,247,84,197,223,198,
+170,25,143,135,247,68,251,13,147,131,11,247,184,10,39,133,5,59,11,21,252,
+97,6,248,97,248,234,5,247,84,253,117,21,247,86,247,31,251,86,249,240,251,
+35,6,253,52,253,238,5,251,33,249,3,11,247,70,10,252,11,7,247,192,29,11,247,
+171,251,107,247,33,251,122,251,56,251,10,63,251,15,251,46,30,247,58,252,13,
+51,7,247,21,129,5,164,137,155,118,123,26,11,251,107,21,180,247,173,10,157,
+159,166,178,26,14,5,67,247,23,253,115,247,139,29,249,115,11,7,251,1,248,93,
+29,248,165,247,201,241,251,201,248,136,247,180,29,11,199,250,109,248,33,29,
+247,92,253,150,6,126,129,123,114,137,30,33,133,5,59,11,21,251,104,33,44,251,
+106,140,30,101,61,147,139,31,248,215,7,139,227,147,144,135,30,247,150,148,
+224,32,251,79,26,14,248,162,10,248,182,10,30,11,22,248,17,251,11,7,106,248,
+52,29,252,66,11,251,226,21,139,247,7,82,200,247,19,217,190,237,11,247,230,
+248,87,29,251,68,5,11,57,7,251,156,60,5,71,247,47,11,5,121,114,164,157,31,
+28,5,100,247,169,10,11,149,153,26,249,134,248,186,10,171,5,253,29,248,53,
+29,251,27,134,5,84,7,11,250,101,21,247,136,37,248,137,29,251,136,243,251,
+78,247,103,247,103,241,247,78,247,136,30,11,60,61,251,21,65,251,13,27,251,
+68,251,75,247,123,247,192,247,231,247,48,247,173,247,158,228,245,71,75,209,
+31,14,7,67,143,5,128,122,154,149,31,249,208,85,7,251,63,92,5,98,241,253,120,
+7,129,121,124,128,30,68,135,5,91,11,7,247,148,65,247,195,251,197,251,9,80,
+79,76,55,221,106,153,135,30,247,78,247,25,5,199,108,161,64,251,85,26,11,21,
+251,191,251,33,34,248,117,29,223,158,184,27,247,90,247,7,251,25,251,150,31,
+11,251,42,251,50,8,86,84,251,25,153,139,26,53,7,139,194,121,203,161,247,48,
+139,206,196,30,247,105,247,77,251,13,11,219,7,113,141,77,143,139,26,119,141,
+124,155,154,26,247,203,7,141,154,165,139,164,27,247,62,184,72,251,40,184,
+31,11,247,166,29,252,101,251,80,37,247,80,252,165,247,204,10,11,252,134,248,
+34,29,98,100,157,112,168,121,31,247,203,251,91,5,14,26,57,72,62,251,9,59,
+78,169,166,98,30,114,247,66,5,35,11,248,91,29,253,35,7,127,130,125,120,138,
+30,11,21,247,208,10,100,69,150,133,27,249,25,247,179,29,11,249,254,28,4,162,
+21,235,251,37,247,17,251,115,251,134,251,76,251,33,251,116,251,152,247,93,
+33,247,4,88,30,11,247,121,247,106,29,11,229,252,176,247,113,29,11,6,249,143,
+28,4,152,247,185,29,14,247,102,10,14,28,5,20,22,252,240,28,5,190,253,64,28,
+250,66,5,250,134,247,7,21,253,236,6,248,91,250,94,5,14,7,251,62,248,58,44,
+102,247,150,252,234,5,247,32,6,14,247,117,10,247,13,247,217,254,120,51,6,
+247,17,247,71,29,11,7,247,104,10,11,21,247,95,7,247,144,29,11,248,138,29,
+57,7,251,144,59,5,69,247,35,252,191,7,251,123,246,38,247,68,11,74,27,251,
+240,251,60,248,212,10,243,201,211,233,31,34,7,251,117,11,247,136,37,247,78,
+251,103,251,103,34,251,78,251,136,251,135,244,251,79,247,103,247,103,241,
+247,79,247,135,30,11,247,156,247,186,29,251,182,7,251,60,11,247,163,29,251,
+163,7,251,96,11,251,107,94,251,31,251,2,251,3,248,186,29,247,3,247,2,184,
+251,30,251,107,30,11,247,0,247,251,29,254,220,248,208,10,248,126,7,248,51,
+11,21,251,105,35,248,51,29,248,38,29,11,251,9,27,251,156,61,247,118,247,101,
+31,249,44,248,31,10,11,121,125,116,110,137,30,251,4,129,5,51,248,154,227,
+7,251,5,248,146,10,11,28,4,170,250,171,247,168,29,11,248,198,29,251,40,251,
+37,162,251,76,41,251,42,8,248,165,29,11,247,183,10,251,207,251,43,39,247,
+43,251,228,247,118,29,11,251,93,77,251,7,248,163,29,249,28,247,235,29,240,
+32,251,131,30,14,26,71,94,106,65,108,86,176,139,30,14,145,5,114,141,121,157,
+164,26,11,21,28,5,86,7,170,113,165,108,108,113,113,108,30,28,250,170,7,108,
+165,113,170,170,165,165,170,30,11,250,226,248,132,21,247,234,251,158,247,
+41,251,239,30,252,68,247,230,10,11,28,5,49,22,223,7,252,76,247,203,248,119,
+240,252,70,248,181,10,247,160,11,247,215,29,252,178,253,162,5,251,1,11,6,
+157,154,121,118,141,31,165,251,76,5,247,5,247,211,11,28,4,141,22,219,248,
+14,29,11,6,158,151,122,119,143,31,168,251,80,5,11,59,7,236,133,5,161,137,
+149,123,126,26,11,147,125,131,118,120,137,25,70,131,5,59,11,219,7,251,3,145,
+5,121,114,164,157,31,11,55,248,86,10,11,6,247,147,29,11,7,247,145,29,11,247,
+184,29,247,9,147,5,227,252,157,51,7,247,1,247,71,29,11,7,159,154,160,167,
+141,30,247,17,147,5,229,252,176,49,7,247,14,131,248,159,10,11,7,247,62,252,
+58,234,176,247,226,10,11,7,247,231,29,248,156,227,7,251,9,248,92,10,11,7,
+248,123,10,251,15,131,5,51,248,175,227,7,251,15,147,5,110,141,125,164,155,
+26,11,38,78,30,251,58,247,64,5,122,66,88,55,78,182,67,247,10,247,105,247,
+108,247,25,247,195,31,11,248,14,10,247,208,29,248,126,10,30,11,247,159,10,
+248,142,11,247,136,252,7,163,251,76,158,30,137,145,125,217,172,192,8,247,
+121,123,247,105,247,15,247,109,26,11,248,15,29,248,77,219,7,53,145,5,116,
+141,127,155,152,26,247,213,7,11,166,170,128,123,167,31,251,70,248,132,29,
+247,25,251,30,211,251,72,11,219,7,53,247,253,10,247,213,7,184,155,129,96,
+168,31,247,105,251,218,5,80,11,247,79,176,247,111,247,129,180,190,123,139,
+30,251,97,248,119,10,6,247,76,247,9,82,233,253,15,252,44,5,53,7,249,15,252,
+43,196,233,251,76,247,9,5,11,7,247,162,10,11,7,247,190,29,251,197,11,247,
+68,247,74,248,25,10,197,178,219,247,25,11,248,58,247,62,102,233,252,234,251,
+150,5,251,31,7,248,234,251,150,176,233,252,58,247,62,5,11,251,1,248,93,29,
+250,255,247,180,29,11,248,0,10,251,19,131,5,51,248,189,227,7,251,23,248,93,
+10,11,155,153,164,168,141,30,247,15,147,5,227,252,175,51,7,247,15,131,5,168,
+137,153,114,123,26,11,247,176,29,251,199,11,248,125,10,247,1,248,111,10,137,
+153,116,119,26,11,251,150,247,239,5,251,46,6,251,150,251,239,5,247,15,6,247,
+105,247,95,247,103,251,95,5,11,248,114,10,39,4,28,250,164,251,22,28,5,92,
+6,14,251,7,248,102,29,11,164,86,51,176,42,27,251,137,251,58,251,25,251,107,
+11,252,126,51,6,247,15,247,182,29,11,7,158,166,159,157,141,30,246,149,5,219,
+252,128,59,7,244,129,5,157,137,166,119,120,26,11,7,151,150,151,157,141,30,
+208,143,5,193,251,228,85,7,215,135,5,157,137,149,127,127,26,11,7,121,112,
+118,121,137,30,34,129,5,59,248,128,219,7,32,149,5,121,141,112,160,157,26,
+11,248,55,29,237,147,5,219,252,95,59,7,248,52,10,11,251,168,217,251,171,247,
+236,223,209,176,217,208,93,172,99,153,30,251,91,251,29,5,63,182,11,21,253,
+243,6,247,195,154,247,29,247,140,247,173,27,247,162,247,35,251,133,251,202,
+156,31,11,253,119,7,127,127,120,116,30,251,181,6,117,129,158,151,31,249,119,
+7,154,149,155,161,30,11,248,84,6,170,165,165,170,170,113,165,108,31,252,84,
+6,108,113,113,108,108,165,113,170,31,11,117,121,120,114,137,30,251,3,131,
+5,51,248,140,227,7,39,247,182,10,11,251,50,119,98,142,143,120,30,144,114,
+146,105,144,118,171,133,181,134,171,140,8,247,132,143,11,248,147,10,252,154,
+49,7,245,131,5,168,137,155,118,119,26,11,219,21,247,189,29,11,242,21,247,
+7,7,235,173,247,118,247,10,217,178,46,39,251,9,86,251,19,36,30,14,248,160,
+29,248,210,7,11,247,230,29,248,101,7,248,52,247,56,247,130,247,150,31,11,
+21,223,251,43,247,225,10,11,25,251,84,227,5,247,241,10,11,247,121,10,28,251,
+47,247,229,10,11,247,127,242,251,127,247,223,57,7,251,154,60,5,71,247,45,
+248,168,10,11,251,15,114,5,51,248,71,227,7,251,15,149,106,141,137,162,149,
+153,25,247,208,248,70,11,106,21,249,109,7,247,91,34,247,9,251,70,45,251,36,
+77,74,251,6,30,241,55,7,11,115,188,69,82,118,119,104,108,30,251,164,251,210,
+5,247,9,6,247,201,247,91,5,168,11,28,4,121,250,29,21,221,252,54,57,7,247,
+5,123,159,137,153,120,131,119,25,251,158,11,154,151,153,162,141,30,225,145,
+5,219,252,75,59,7,240,248,90,29,11,250,111,247,197,29,11,21,217,7,253,170,
+247,135,249,170,247,136,5,217,7,254,9,251,175,5,61,7,14,7,247,231,10,30,11,
+21,251,21,6,254,33,28,250,106,5,247,23,6,11,247,251,29,254,220,7,123,125,
+11,129,5,168,137,153,116,121,26,11,147,5,114,141,121,158,161,26,11,235,133,
+5,164,149,123,124,31,11,7,114,121,121,114,137,30,11,6,213,247,125,248,170,
+10,244,248,56,6,49,147,5,110,143,96,190,158,26,11,7,155,108,109,145,106,27,
+51,251,1,71,251,23,251,39,247,32,55,247,43,129,31,11,21,252,178,6,247,91,
+153,225,247,58,247,64,27,247,60,227,251,58,251,91,153,31,11,247,67,247,210,
+29,11,251,9,123,5,59,248,26,219,7,36,147,121,141,135,162,149,151,25,247,93,
+247,154,11,247,163,247,181,247,23,153,248,173,10,147,119,129,126,25,11,251,
+58,6,247,222,10,11,200,84,7,251,54,92,5,98,231,252,62,7,125,127,248,89,10,
+11,227,7,251,41,149,251,228,248,113,104,193,88,161,65,143,25,203,168,215,
+217,180,229,11,206,247,246,10,30,14,5,247,215,29,11,247,220,10,219,7,11,21,
+247,219,254,111,251,219,240,7,163,247,84,5,160,141,151,153,155,27,247,142,
+11,22,247,216,29,11,247,115,247,35,251,48,252,41,252,4,251,110,251,49,251,
+207,103,81,141,143,100,11,251,21,178,8,247,17,170,247,7,207,247,35,26,247,
+91,251,54,204,251,142,30,11,250,171,250,173,21,247,217,254,120,51,7,247,17,
+247,71,29,11,233,254,88,251,219,247,13,7,169,247,82,5,159,144,151,154,157,
+27,248,169,6,11,247,220,10,14,7,248,190,10,51,11,248,17,29,252,97,11,251,
+159,251,170,251,123,247,12,251,153,247,167,11,33,248,92,10,11,251,129,251,
+29,32,251,107,141,30,11,7,143,184,143,182,248,138,251,205,253,25,248,125,
+248,163,10,11,30,247,3,149,5,227,252,159,51,7,247,11,248,89,29,11,251,195,
+124,251,31,251,144,251,173,27,251,166,251,31,247,142,247,197,124,31,11,28,
+6,47,248,206,29,251,250,59,7,233,133,161,137,152,117,133,118,25,11,247,7,
+247,71,222,199,237,30,248,101,29,11,28,7,123,248,181,21,247,31,7,252,234,
+247,150,102,45,248,58,251,62,5,11,250,175,22,248,17,251,9,7,106,248,52,29,
+252,68,11,4,247,228,10,251,5,37,82,248,27,10,248,48,29,31,14,248,59,10,247,
+181,241,251,181,11,7,251,63,251,202,5,139,247,12,138,140,26,140,247,63,247,
+201,139,30,11,28,7,174,248,207,21,225,7,253,15,248,44,82,45,247,76,251,9,
+5,11,251,207,251,99,247,58,248,58,248,66,247,101,247,52,247,215,31,247,48,
+11,251,230,21,248,27,29,11,139,131,137,129,30,147,108,106,141,104,27,251,
+37,251,46,45,251,56,45,11,248,150,49,7,252,87,252,148,5,53,248,62,251,168,
+247,7,247,168,7,11,251,150,248,234,5,251,32,6,251,150,252,234,234,102,247,
+62,248,58,5,11,21,248,21,29,14,248,12,10,14,248,177,10,59,11,59,6,232,248,
+90,29,11,251,48,225,57,247,68,247,13,229,209,198,11,216,7,40,150,5,115,143,
+120,153,164,26,11,219,7,40,247,254,29,11,7,157,153,162,168,141,30,11,7,119,
+125,116,110,137,30,11,6,170,141,41,110,143,31,239,247,234,39,6,112,135,137,
+41,108,27,11,7,251,214,247,54,251,58,247,230,247,234,247,76,247,44,247,228,
+30,11,21,63,96,86,86,102,30,251,29,186,57,190,225,26,213,200,200,231,11,21,
+209,84,248,152,29,194,196,209,30,11,21,185,112,167,93,95,109,109,95,94,169,
+110,183,185,166,166,186,30,11,92,100,120,102,92,26,77,192,84,236,208,199,
+168,188,188,30,225,225,11,247,167,248,20,10,11,133,153,135,160,176,143,25,
+241,149,5,221,252,111,57,7,247,21,113,11,249,115,7,247,101,251,13,247,3,251,
+49,32,251,52,57,94,66,30,11,162,141,30,247,2,145,5,219,252,93,59,7,228,133,
+5,161,137,149,11,198,142,25,248,178,29,190,98,209,251,38,11,247,25,70,225,
+38,68,69,94,68,81,184,86,139,30,247,37,6,33,11,248,94,10,251,186,247,74,251,
+110,247,179,247,31,11,21,215,252,135,63,7,248,135,251,115,21,215,252,135,
+63,7,14,248,161,29,38,11,136,5,155,137,151,129,124,26,11,144,5,120,140,130,
+153,151,26,11,145,5,114,248,171,29,11,145,5,116,141,127,153,154,26,11,147,
+5,120,141,113,162,157,26,11,119,123,116,110,137,30,11,7,251,126,247,38,251,
+7,247,164,247,171,247,45,244,247,136,30,11,21,225,157,218,190,203,203,90,
+200,24,90,86,92,106,55,119,8,11,21,55,67,69,251,7,251,21,72,213,243,227,190,
+189,207,171,30,11,27,247,36,247,23,168,145,168,31,227,7,135,120,61,121,39,
+27,11,51,251,66,5,127,118,121,133,120,27,94,98,184,247,27,84,31,11,248,206,
+29,252,1,59,7,236,133,161,137,154,117,130,118,25,11,251,21,77,74,251,6,30,
+241,55,7,251,142,61,5,72,247,35,11,248,109,29,247,31,147,5,227,11,133,152,
+150,151,154,141,25,202,142,5,187,251,186,91,7,212,132,11,144,5,120,248,193,
+10,153,158,140,30,11,252,46,252,87,195,82,5,147,149,159,154,186,27,247,21,
+247,64,11,214,76,201,63,63,78,77,64,63,200,77,215,215,202,201,215,30,11,21,
+247,150,252,56,251,150,233,247,58,247,126,251,58,7,14,47,251,109,251,32,73,
+5,72,247,23,11,145,5,219,252,76,59,7,233,133,5,11,251,103,248,167,29,30,11,
+247,35,5,125,133,63,116,47,26,80,11,6,139,209,213,174,207,30,208,247,29,238,
+247,236,248,179,26,11,21,247,36,248,182,29,251,36,30,11,27,237,205,248,115,
+10,62,11,43,123,5,59,247,240,248,199,29,11,247,91,43,247,9,251,70,44,251,
+21,77,74,251,6,30,241,11,251,64,57,198,100,203,202,176,174,139,30,247,119,
+7,141,149,11,162,153,141,25,247,13,149,5,227,252,126,51,7,247,13,119,11,166,
+170,128,123,167,30,251,72,7,122,164,172,123,184,27,200,11,227,251,54,251,
+62,251,6,53,251,34,43,219,78,212,110,30,11,71,30,215,123,5,192,186,247,64,
+247,27,247,89,26,14,190,28,4,216,21,52,248,80,252,203,226,249,34,7,14,248,
+220,251,196,21,249,34,52,252,203,252,80,52,7,14,6,252,42,251,55,174,48,248,
+212,247,141,5,247,25,7,11,6,141,157,139,164,153,26,247,136,251,21,247,68,
+251,146,11,248,21,21,247,97,251,33,239,251,140,233,30,251,76,209,11,21,248,
+41,254,9,252,41,218,247,179,249,107,251,179,7,11,26,90,96,93,63,87,99,157,
+155,112,30,123,243,5,71,11,248,70,250,109,21,251,238,6,241,251,218,5,247,
+34,6,11,248,166,29,247,76,227,251,95,251,115,30,11,247,144,251,33,247,111,
+251,161,251,12,251,7,85,117,92,11,247,154,251,1,7,110,251,43,5,130,137,129,
+127,133,27,11,252,4,251,217,21,247,25,247,4,251,25,247,5,5,65,11,157,118,
+30,88,247,7,5,141,135,121,141,124,27,90,104,11,160,171,143,25,242,149,5,227,
+252,122,51,7,247,11,115,11,251,101,213,251,11,247,162,247,124,242,247,10,
+247,99,30,11,252,86,247,9,7,161,247,92,5,162,141,162,172,161,27,11,248,200,
+29,155,118,127,119,25,11,49,215,123,24,192,186,247,64,247,25,247,93,26,14,
+135,27,248,4,209,7,247,76,211,72,251,5,31,14,5,59,247,220,219,7,251,0,151,
+11,59,7,251,144,61,5,72,247,33,11,110,137,30,251,11,131,5,51,7,11,247,195,
+251,70,247,2,252,23,30,11,203,82,198,251,11,251,197,251,5,11,238,131,5,161,
+137,153,125,124,26,11,7,126,129,123,114,137,30,11,7,164,158,157,163,141,30,
+11,7,154,151,149,155,141,30,11,165,205,248,29,250,82,24,11,5,246,247,134,
+6,157,98,38,168,251,12,27,251,128,11,7,251,8,247,77,44,81,248,44,253,15,5,
+225,6,11,248,99,29,248,208,11,248,122,29,251,7,73,251,9,27,251,156,11,249,
+254,247,224,21,247,152,251,92,245,251,5,191,30,11,251,199,70,6,247,17,128,
+156,137,147,123,126,124,25,11,51,7,245,131,5,170,135,151,116,123,26,254,220,
+7,11,79,239,59,247,11,49,209,8,164,229,147,237,231,26,11,104,139,30,247,21,
+6,129,141,123,128,26,141,251,10,11,133,5,59,248,54,7,247,224,247,4,229,247,
+99,31,11,186,7,81,248,145,10,11,209,74,196,251,19,251,140,251,5,251,78,251,
+134,30,11,247,3,159,5,248,200,29,11,248,162,29,83,135,5,91,7,14,5,194,98,
+184,77,76,100,100,74,251,25,247,39,11,6,251,34,251,173,247,1,83,247,62,247,
+229,5,11,7,251,168,215,251,89,247,164,223,247,3,200,215,11,8,251,215,248,
+202,29,11,21,248,140,29,225,11,30,253,62,22,214,78,201,63,63,78,77,64,63,
+11,247,115,21,247,17,251,7,197,55,165,30,207,170,11,90,7,194,137,5,156,151,
+127,124,31,252,39,7,11,102,139,30,247,21,6,129,141,123,124,26,251,29,11,139,
+245,200,242,247,80,237,251,70,251,103,251,105,11,247,185,7,248,194,10,11,
+164,159,27,247,248,6,252,178,253,160,5,251,1,11,251,111,251,17,68,251,120,
+30,107,75,141,133,27,11,217,80,174,65,135,108,135,139,30,55,251,99,5,11,21,
+248,64,252,44,57,247,218,251,238,7,14,7,251,154,60,5,71,247,48,11,248,21,
+247,50,247,103,247,99,11,248,37,247,158,247,214,248,33,11,129,122,137,30,
+76,134,5,92,11,133,5,163,137,158,121,114,26,11,144,5,122,141,129,149,153,
+26,11,147,5,110,141,123,162,159,26,11,147,5,111,141,124,162,159,26,11,251,
+154,251,123,251,73,251,236,11,248,50,21,247,183,11,249,164,21,186,7,11,5,
+248,154,10,11,7,247,134,247,56,83,219,251,78,251,17,5,11,7,139,247,19,182,
+225,247,21,237,73,251,29,11,7,119,122,116,111,137,30,251,11,131,5,51,11,21,
+251,86,39,44,251,179,100,51,145,139,30,11,30,231,147,5,219,252,70,59,7,221,
+131,5,11,248,137,10,5,11,51,7,247,9,247,182,29,11,247,101,251,66,247,2,251,
+135,94,65,131,139,11,90,251,5,30,127,120,141,135,27,61,7,139,11,251,6,247,
+75,247,119,247,130,247,2,247,66,11,123,126,26,253,133,7,126,129,123,115,137,
+30,11,247,183,251,123,247,45,251,196,82,47,129,139,11,144,5,123,141,126,149,
+153,26,248,165,86,7,11,147,5,227,252,159,51,7,247,11,131,5,168,11,149,153,
+26,247,234,7,247,19,61,199,37,69,11,153,199,145,182,27,247,103,243,49,251,
+52,31,11,251,67,248,178,10,11,196,209,229,61,162,139,31,251,54,251,19,5,11,
+218,209,208,187,205,27,190,172,114,108,165,31,11,227,7,251,0,241,10,11,249,
+220,247,142,21,44,176,251,62,252,58,5,11,7,139,184,129,168,205,200,188,206,
+30,14,248,178,10,14,247,19,247,19,192,251,5,251,60,31,14,251,212,252,35,252,
+48,11,123,125,114,110,137,30,11,127,26,253,35,7,127,11,159,155,162,168,141,
+30,11,247,39,247,21,207,139,11,5,137,141,133,129,135,27,37,131,5,59,11,6,
+114,121,157,164,137,31,133,225,5,59,11,7,125,131,114,117,137,30,38,133,5,
+59,11,7,114,127,121,123,137,30,103,133,5,59,11,7,251,1,147,5,111,143,124,
+162,155,26,11,21,63,96,86,83,102,30,251,29,186,57,11,25,251,84,227,5,92,100,
+120,102,92,26,11,26,251,0,178,77,195,82,30,251,75,83,11,27,251,80,251,1,247,
+54,247,115,247,140,11,247,74,55,7,251,146,61,5,72,247,40,11,247,84,200,223,
+199,170,30,247,80,251,25,11,59,7,235,133,5,162,137,151,123,126,26,11,251,
+1,116,37,251,121,98,96,143,139,30,11,247,131,240,246,247,115,182,227,129,
+139,30,11,114,120,123,115,137,30,251,13,128,5,62,11,248,128,21,247,180,251,
+50,247,124,251,197,11,131,5,51,248,158,227,7,251,11,147,5,11,141,127,155,
+152,26,249,133,7,152,151,155,11,144,5,123,141,129,149,153,26,248,40,7,11,
+149,5,110,141,125,162,157,26,248,107,7,11,159,153,160,168,141,30,247,9,147,
+5,229,11,166,98,30,114,247,68,5,35,251,166,6,11,178,117,180,180,163,159,139,
+30,247,27,7,11,192,7,63,144,5,120,140,129,153,151,26,11,28,5,158,21,63,153,
+5,86,92,251,64,11,252,76,21,28,7,155,34,28,248,101,7,11,219,252,6,59,7,188,
+135,219,145,109,26,11,223,253,138,251,183,244,7,159,247,44,5,11,247,17,251,
+218,30,252,184,51,6,247,0,11,7,247,15,136,204,62,251,131,26,14,21,247,5,28,
+251,52,251,5,7,14,251,93,247,64,251,25,192,92,30,14,5,168,137,153,118,119,
+26,11,7,159,155,160,168,141,30,11,7,116,251,54,5,119,137,11,21,139,251,35,
+42,251,1,11,27,200,195,164,141,157,31,11,247,84,201,223,198,170,30,11,247,
+113,247,101,221,139,31,11,28,251,119,251,219,247,11,11,249,134,217,21,206,
+251,40,11,251,76,251,74,36,247,74,11,28,6,21,21,191,11,251,21,251,183,31,
+11,143,219,162,222,26,11,252,96,21,187,7,11,5,219,252,34,59,7,223,131,158,
+137,11,5,186,247,9,188,247,48,247,62,26,11,7,251,17,223,21,251,193,6,247,
+193,11,7,117,121,120,114,137,30,39,131,5,11,7,121,112,114,121,30,251,1,133,
+5,11,21,28,250,164,251,22,28,5,92,6,11,21,247,17,251,2,194,53,168,30,206,
+11,27,247,111,247,24,247,13,247,93,31,11,31,247,66,178,247,54,227,247,107,
+26,11,41,83,225,223,240,176,227,248,5,231,11,247,105,248,13,247,93,247,91,
+247,170,11,74,251,29,31,51,7,252,173,251,9,11,83,251,13,251,14,251,12,82,
+247,14,11,90,7,251,181,57,5,84,7,247,99,11,108,173,139,30,251,21,6,150,137,
+155,11,112,47,26,84,192,96,247,19,247,140,11,120,213,247,216,247,86,247,103,
+247,214,11,248,123,10,251,13,131,5,11,131,162,155,159,162,141,25,237,145,
+5,11,134,5,92,247,216,186,7,68,144,5,11,140,129,153,151,26,249,35,7,151,149,
+11,157,151,125,118,143,31,168,251,84,5,11,159,155,160,168,141,30,245,147,
+5,229,11,168,247,38,5,154,141,159,149,151,27,11,200,67,197,41,69,73,98,79,
+103,30,11,247,247,197,247,103,247,174,248,5,26,11,227,252,43,51,7,247,5,129,
+157,137,11,229,51,162,139,30,251,76,251,34,5,11,239,251,52,247,97,247,95,
+241,247,52,11,244,7,247,183,247,127,247,21,209,30,11,27,247,51,234,212,247,
+12,31,14,247,24,177,193,112,113,165,31,14,55,251,127,31,14,28,5,94,21,11,
+7,248,195,10,11,7,247,119,29,11,22,247,233,10,11,247,69,10,14,8,227,29,11,
+247,206,10,247,11,11,248,60,10,61,11,221,248,59,10,11,248,56,10,85,247,197,
+83,29,72,29,159,11,248,16,10,247,84,29,11,248,95,10,251,123,248,58,29,11,
+164,26,248,201,7,248,22,10,11,251,185,72,29,247,120,11,247,13,29,14,26,247,
+13,10,11,248,170,29,7,247,56,10,11,250,218,22,219,7,247,25,29,11,226,10,14,
+243,248,144,6,200,29,11,240,29,247,120,247,179,83,29,166,29,248,187,11,7,
+200,10,247,197,7,139,247,0,120,213,11,193,29,14,247,101,10,247,46,247,236,
+29,11,21,247,180,251,70,247,124,251,197,247,19,10,247,183,29,30,251,105,141,
+21,11,86,10,14,7,162,10,11,108,29,219,7,11,60,29,248,79,247,179,83,29,91,
+10,14,88,10,14,63,10,126,247,69,83,29,173,29,247,193,247,193,29,11,55,85,
+41,82,251,25,212,29,11,166,29,247,120,29,28,251,49,161,10,11,219,111,29,227,
+29,11,88,10,249,245,28,7,83,54,29,63,10,107,247,182,39,10,147,10,14,74,10,
+28,4,192,73,29,14,71,29,250,121,28,5,45,248,248,29,};
+#endif
@@ -0,0 +1,1221 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_Dingbats_cff_size = 24958;
+asm(".section .rodata");
+asm(".global fz_font_Dingbats_cff");
+asm(".type fz_font_Dingbats_cff STT_OBJECT");
+asm(".size fz_font_Dingbats_cff, 24958");
+asm(".balign 64");
+asm("fz_font_Dingbats_cff:");
+asm(".incbin \"resources/fonts/urw/Dingbats.cff\"");
+#else
+const int fz_font_Dingbats_cff_size = 24958;
+const char fz_font_Dingbats_cff[] = {
+1,0,4,2,0,1,1,1,9,68,48,53,48,48,48,48,76,0,1,1,1,57,248,228,0,248,229,1,
+248,230,12,0,248,231,2,248,231,3,248,24,4,67,12,3,175,12,4,138,251,36,250,
+105,249,199,5,29,0,76,154,4,13,28,5,42,15,28,5,49,16,28,5,59,17,159,28,95,
+250,18,0,205,2,0,1,0,3,0,5,0,9,0,11,0,13,0,15,0,19,0,23,0,27,0,30,0,33,0,
+36,0,39,0,42,0,45,0,49,0,52,0,55,0,58,0,61,0,64,0,67,0,70,0,73,0,76,0,79,
+0,82,0,85,0,87,0,89,0,91,0,93,0,96,0,99,0,102,0,105,0,108,0,111,0,114,0,117,
+0,120,0,123,0,126,0,129,0,132,0,135,0,138,0,141,0,144,0,147,0,150,0,153,0,
+156,0,159,0,162,0,165,0,168,0,171,0,174,0,177,0,180,0,183,0,186,0,189,0,192,
+0,195,0,198,0,201,0,204,0,207,0,210,0,213,0,216,0,219,0,222,0,225,0,228,0,
+231,0,234,0,238,0,241,0,245,0,248,0,251,0,254,1,1,1,4,1,7,1,10,1,13,1,16,
+1,19,1,22,1,26,1,29,1,32,1,35,1,38,1,41,1,44,1,48,1,51,1,55,1,58,1,61,1,64,
+1,67,1,70,1,74,1,78,1,82,1,86,1,90,1,94,1,98,1,102,1,106,1,110,1,114,1,118,
+1,122,1,126,1,130,1,134,1,138,1,142,1,146,1,150,1,154,1,158,1,162,1,166,1,
+170,1,174,1,178,1,182,1,186,1,190,1,194,1,198,1,202,1,206,1,210,1,214,1,218,
+1,222,1,226,1,230,1,234,1,238,1,242,1,246,1,250,1,254,2,2,2,6,2,10,2,14,2,
+18,2,22,2,26,2,30,2,34,2,38,2,42,2,46,2,50,2,54,2,58,2,62,2,66,2,70,2,74,
+2,78,2,82,2,86,2,90,2,94,2,98,2,102,2,106,2,110,2,114,2,118,2,122,2,126,2,
+130,2,134,2,138,2,142,2,146,2,150,2,154,2,158,2,162,2,166,2,170,2,174,2,178,
+2,182,2,186,2,190,2,244,3,52,3,60,97,49,97,50,97,50,48,50,97,51,97,52,97,
+53,97,49,49,57,97,49,49,56,97,49,49,55,97,49,49,97,49,50,97,49,51,97,49,52,
+97,49,53,97,49,54,97,49,48,53,97,49,55,97,49,56,97,49,57,97,50,48,97,50,49,
+97,50,50,97,50,51,97,50,52,97,50,53,97,50,54,97,50,55,97,50,56,97,54,97,55,
+97,56,97,57,97,49,48,97,50,57,97,51,48,97,51,49,97,51,50,97,51,51,97,51,52,
+97,51,53,97,51,54,97,51,55,97,51,56,97,51,57,97,52,48,97,52,49,97,52,50,97,
+52,51,97,52,52,97,52,53,97,52,54,97,52,55,97,52,56,97,52,57,97,53,48,97,53,
+49,97,53,50,97,53,51,97,53,52,97,53,53,97,53,54,97,53,55,97,53,56,97,53,57,
+97,54,48,97,54,49,97,54,50,97,54,51,97,54,52,97,54,53,97,54,54,97,54,55,97,
+54,56,97,54,57,97,55,48,97,55,49,97,55,50,97,55,51,97,55,52,97,50,48,51,97,
+55,53,97,50,48,52,97,55,54,97,55,55,97,55,56,97,55,57,97,56,49,97,56,50,97,
+56,51,97,56,52,97,57,55,97,57,56,97,57,57,97,49,48,48,97,56,57,97,57,48,97,
+57,51,97,57,52,97,57,49,97,57,50,97,50,48,53,97,56,53,97,50,48,54,97,56,54,
+97,56,55,97,56,56,97,57,53,97,57,54,97,49,48,49,97,49,48,50,97,49,48,51,97,
+49,48,52,97,49,48,54,97,49,48,55,97,49,48,56,97,49,49,50,97,49,49,49,97,49,
+49,48,97,49,48,57,97,49,50,48,97,49,50,49,97,49,50,50,97,49,50,51,97,49,50,
+52,97,49,50,53,97,49,50,54,97,49,50,55,97,49,50,56,97,49,50,57,97,49,51,48,
+97,49,51,49,97,49,51,50,97,49,51,51,97,49,51,52,97,49,51,53,97,49,51,54,97,
+49,51,55,97,49,51,56,97,49,51,57,97,49,52,48,97,49,52,49,97,49,52,50,97,49,
+52,51,97,49,52,52,97,49,52,53,97,49,52,54,97,49,52,55,97,49,52,56,97,49,52,
+57,97,49,53,48,97,49,53,49,97,49,53,50,97,49,53,51,97,49,53,52,97,49,53,53,
+97,49,53,54,97,49,53,55,97,49,53,56,97,49,53,57,97,49,54,48,97,49,54,49,97,
+49,54,51,97,49,54,52,97,49,57,54,97,49,54,53,97,49,57,50,97,49,54,54,97,49,
+54,55,97,49,54,56,97,49,54,57,97,49,55,48,97,49,55,49,97,49,55,50,97,49,55,
+51,97,49,54,50,97,49,55,52,97,49,55,53,97,49,55,54,97,49,55,55,97,49,55,56,
+97,49,55,57,97,49,57,51,97,49,56,48,97,49,57,57,97,49,56,49,97,50,48,48,97,
+49,56,50,97,50,48,49,97,49,56,51,97,49,56,52,97,49,57,55,97,49,56,53,97,49,
+57,52,97,49,57,56,97,49,56,54,97,49,57,53,97,49,56,55,97,49,56,56,97,49,56,
+57,97,49,57,48,97,49,57,49,50,46,48,48,40,85,82,87,41,43,43,44,67,111,112,
+121,114,105,103,104,116,32,50,48,49,51,32,98,121,32,40,85,82,87,41,43,43,
+32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,110,
+116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,111,
+112,121,114,105,103,104,116,32,50,48,49,51,32,98,121,32,40,85,82,87,41,43,
+43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,68,48,53,48,48,48,48,76,0,0,1,0,1,0,1,135,200,1,4,32,94,128,13,161,
+78,241,13,0,203,2,0,1,0,4,0,7,0,186,1,111,2,38,3,236,4,242,5,243,6,150,7,
+96,7,198,8,153,10,87,12,9,13,179,14,117,15,61,15,252,16,185,17,107,17,192,
+18,96,18,140,18,192,19,220,20,252,21,76,21,105,21,149,21,193,21,220,22,27,
+22,109,22,211,23,78,23,223,24,131,25,12,25,252,26,100,26,228,27,12,27,87,
+27,131,27,191,28,67,28,177,29,90,29,187,30,20,30,84,30,166,30,243,31,155,
+32,70,32,202,33,126,33,187,34,16,34,157,35,94,36,196,37,222,39,24,40,15,41,
+147,44,32,44,229,46,13,46,183,47,249,48,155,49,221,51,14,51,196,52,203,53,
+214,53,251,54,87,54,99,54,127,54,154,54,186,54,220,54,234,54,248,55,10,55,
+83,55,114,55,125,55,139,55,153,55,224,56,36,56,125,56,212,57,20,57,79,57,
+122,57,165,57,188,57,210,57,236,58,7,58,31,58,55,58,84,58,114,58,219,59,65,
+59,222,60,56,60,150,60,234,61,78,62,91,63,46,63,160,63,202,64,17,64,97,64,
+154,64,253,65,138,65,237,66,92,66,208,67,45,67,141,68,0,68,109,68,171,69,
+23,69,164,69,224,70,74,70,197,71,28,71,128,71,235,72,122,72,147,72,222,73,
+78,73,119,73,183,74,25,74,65,74,171,75,16,75,111,75,132,75,212,76,72,76,116,
+76,199,77,52,77,93,77,186,78,32,78,113,78,149,78,178,78,234,79,41,79,69,79,
+96,79,124,79,176,80,1,80,25,80,50,80,101,80,169,80,192,80,224,80,255,81,18,
+81,70,81,119,81,143,81,181,81,231,82,25,82,84,82,141,82,188,82,239,83,40,
+83,94,83,170,84,66,84,164,85,2,85,103,85,220,86,46,86,152,87,18,87,137,88,
+37,88,204,89,37,252,197,14,252,197,14,247,27,248,253,247,12,21,43,247,2,248,
+54,194,5,180,66,74,159,75,27,126,121,138,138,122,31,251,157,124,93,183,105,
+164,109,151,25,73,164,138,140,149,26,142,140,144,141,143,30,153,166,141,147,
+155,26,196,84,190,78,93,102,103,93,89,179,98,203,123,30,238,121,200,101,180,
+69,8,104,105,87,113,103,27,123,115,143,146,111,31,144,116,117,143,122,27,
+93,100,101,93,82,192,90,199,193,177,175,190,145,138,145,138,144,31,136,153,
+137,148,142,26,147,147,145,151,30,188,138,5,151,204,145,145,184,31,240,251,
+6,5,252,9,248,113,21,181,181,101,101,107,117,116,112,94,93,177,177,169,165,
+164,169,31,115,251,248,21,186,175,107,97,105,112,112,104,95,98,177,179,171,
+167,164,175,31,14,247,14,248,185,247,239,21,248,13,247,37,5,171,104,118,148,
+103,27,112,104,132,124,100,31,251,204,251,10,5,162,89,62,162,112,27,111,141,
+129,144,150,26,142,141,145,142,146,30,145,153,143,156,153,26,190,93,180,80,
+78,96,99,81,79,190,98,213,30,209,141,5,200,183,116,96,158,31,99,125,91,112,
+80,27,71,140,5,64,87,95,77,83,181,101,200,200,183,179,193,151,137,150,135,
+148,31,129,162,139,139,144,26,149,147,144,155,141,30,204,148,146,141,234,
+177,247,201,251,6,24,125,179,169,133,171,27,181,164,149,168,167,31,253,169,
+248,8,21,181,171,110,99,100,112,112,100,95,105,170,178,177,168,166,180,31,
+148,251,221,21,178,166,112,101,96,110,111,93,100,111,165,175,178,174,174,
+180,31,14,247,27,248,253,248,203,21,47,147,38,251,6,5,145,94,76,145,125,27,
+91,138,5,126,131,144,148,142,141,148,142,153,31,140,144,140,144,145,26,190,
+101,175,85,79,86,90,82,93,177,101,186,155,162,143,144,162,30,146,167,163,
+143,155,27,175,191,114,104,173,31,117,93,68,83,86,127,63,121,139,139,124,
+132,8,97,119,113,102,101,26,93,176,103,185,200,194,190,196,155,136,148,126,
+165,30,137,144,138,143,142,26,149,141,141,204,164,30,169,150,172,163,186,
+185,247,157,124,24,138,156,159,138,150,27,203,203,158,181,213,31,252,54,193,
+5,251,226,251,119,21,166,161,115,108,100,97,101,96,109,114,165,169,177,185,
+177,184,31,98,247,250,21,177,166,114,103,98,103,107,92,103,111,164,171,179,
+178,176,182,31,14,247,33,247,74,247,122,21,89,99,100,90,89,178,99,189,188,
+179,179,188,188,99,179,91,31,145,114,21,171,165,110,103,103,113,111,106,104,
+110,168,175,174,168,168,175,31,132,248,70,21,89,99,99,91,89,178,99,188,189,
+178,179,188,187,100,180,91,31,142,114,21,171,165,111,104,104,113,111,106,
+105,111,168,173,174,168,167,173,31,247,178,251,105,21,114,119,117,109,110,
+158,116,164,164,160,164,168,167,119,161,114,31,141,120,21,152,150,127,123,
+121,127,124,125,124,129,152,156,157,151,152,154,31,248,109,247,45,21,192,
+90,101,157,83,27,88,82,121,101,74,31,251,54,44,5,159,116,125,146,124,27,135,
+133,138,137,132,31,131,107,123,137,118,27,126,133,140,143,129,31,160,171,
+148,163,167,26,212,73,199,57,51,80,80,51,88,159,96,176,112,30,170,117,180,
+128,208,136,199,136,148,137,155,132,8,151,133,147,127,126,26,113,113,125,
+89,137,30,46,137,109,133,102,116,8,97,113,117,97,84,26,50,197,80,227,224,
+199,195,216,170,131,163,118,172,30,142,156,147,141,148,27,150,157,136,136,
+159,31,137,147,147,138,145,27,145,143,140,142,143,31,187,169,247,83,251,19,
+5,111,182,197,119,178,27,195,194,162,177,172,31,251,214,247,96,5,251,88,53,
+21,135,133,132,138,132,27,69,141,5,107,105,123,124,135,140,134,142,136,31,
+158,116,145,123,111,26,70,91,90,71,67,92,187,213,221,190,185,231,30,196,6,
+208,168,160,187,140,139,142,138,141,31,247,185,247,63,194,171,139,139,150,
+144,25,156,176,169,148,166,27,175,166,127,109,174,31,252,55,251,169,21,242,
+202,247,197,251,86,5,112,104,113,128,107,27,94,98,156,187,66,31,251,192,247,
+117,21,126,158,109,151,100,140,8,72,6,55,84,189,216,211,187,190,207,208,190,
+91,74,118,134,119,130,126,31,124,116,139,139,133,26,122,164,130,185,153,150,
+140,141,144,30,149,173,139,139,150,27,152,146,135,125,148,31,14,251,12,247,
+55,247,30,21,248,28,6,152,140,140,139,140,140,142,140,142,162,140,175,90,
+247,33,125,171,120,158,8,109,173,139,139,153,26,150,139,146,141,151,30,172,
+132,151,129,149,113,8,133,169,166,136,187,27,166,148,140,143,159,31,135,188,
+130,164,120,153,8,169,102,251,27,164,251,12,27,251,13,251,26,114,109,101,
+31,121,125,130,114,134,90,8,135,160,147,138,167,27,186,167,142,145,169,31,
+149,165,151,149,171,146,8,141,127,140,132,128,26,126,138,138,129,128,30,132,
+130,131,131,131,130,129,127,138,137,135,131,104,53,136,133,113,64,141,92,
+141,126,146,138,8,247,8,247,225,21,147,205,140,139,164,27,165,139,139,131,
+205,31,122,98,5,141,98,122,140,122,27,123,121,138,137,98,31,217,109,21,191,
+182,95,87,85,96,96,85,86,95,182,193,193,183,181,194,31,247,215,146,21,134,
+117,125,137,102,27,108,124,140,145,100,31,112,146,151,135,222,27,182,142,
+141,168,149,31,253,31,22,111,150,144,136,174,27,179,172,141,143,152,31,152,
+142,142,143,145,157,8,134,103,107,137,99,27,113,133,140,145,120,31,14,89,
+247,45,247,23,21,81,206,112,208,219,26,247,69,247,40,247,38,247,70,247,72,
+247,41,251,38,251,69,251,74,251,45,251,37,251,83,46,72,179,194,154,145,152,
+145,140,142,138,138,141,30,136,144,148,136,145,27,165,195,211,174,144,137,
+142,135,143,31,125,152,136,146,150,26,169,188,244,168,170,30,154,155,145,
+142,161,142,150,141,143,141,144,146,8,159,165,151,179,180,26,153,131,143,
+110,98,132,136,99,105,30,47,35,65,251,60,37,26,130,140,132,142,136,30,146,
+132,140,137,137,26,137,137,137,137,136,30,127,123,134,125,120,26,71,220,88,
+247,1,247,99,247,55,247,50,247,92,247,90,251,55,247,56,251,90,251,87,251,
+56,251,54,251,84,55,177,42,188,97,30,133,146,148,136,147,27,142,143,139,142,
+146,31,247,243,248,104,21,135,83,127,105,113,104,8,134,152,151,137,154,27,
+154,140,140,156,149,31,154,166,145,159,166,26,149,138,140,132,146,30,126,
+151,129,144,125,144,8,251,47,251,249,21,123,84,116,106,100,116,8,128,155,
+160,130,148,27,162,184,200,169,147,134,145,117,157,31,14,90,248,253,247,38,
+21,153,149,174,194,144,160,251,37,247,9,24,88,111,94,95,118,30,251,230,152,
+21,150,108,163,98,156,122,247,58,215,24,93,166,117,178,196,26,247,67,247,
+176,21,144,124,129,140,118,27,118,124,137,135,125,31,118,251,77,5,154,164,
+161,146,166,27,168,160,132,124,160,31,67,132,21,82,94,94,83,83,184,94,195,
+195,184,184,195,194,94,185,84,31,143,247,151,21,251,95,251,55,61,10,251,94,
+247,52,251,53,247,92,64,10,247,88,52,10,113,4,215,222,106,86,197,31,212,73,
+177,53,43,26,251,76,251,42,251,42,251,76,251,78,251,40,247,41,247,80,219,
+170,219,194,199,30,213,206,224,176,241,27,14,91,174,247,239,21,174,126,106,
+251,11,190,146,213,238,5,134,185,222,132,145,27,195,138,139,139,148,135,8,
+148,135,144,131,128,26,129,138,135,117,56,30,52,251,89,5,176,6,159,140,143,
+141,156,164,178,193,24,200,6,145,144,147,148,147,134,148,133,31,106,6,188,
+208,5,199,6,145,145,147,147,148,133,148,132,31,108,6,213,238,147,140,139,
+139,182,141,25,177,140,151,140,166,142,8,187,145,162,150,157,26,158,95,151,
+63,143,30,69,141,130,140,65,239,5,170,6,146,145,147,148,148,133,147,133,31,
+79,6,90,208,5,172,6,145,144,147,148,147,134,147,133,31,78,6,100,194,122,163,
+135,142,119,140,25,102,6,226,251,89,5,160,59,141,131,129,26,122,127,130,113,
+138,30,98,138,5,129,118,137,136,107,31,119,137,119,137,119,138,127,137,24,
+65,238,88,147,172,251,11,5,14,251,41,249,35,248,192,21,253,0,252,55,249,0,
+6,252,237,248,14,21,247,100,251,54,5,133,7,133,7,251,100,251,54,5,248,218,
+116,21,252,218,6,247,100,247,54,5,103,155,168,120,177,27,177,168,158,175,
+155,31,247,100,247,89,21,251,228,7,251,100,247,54,5,145,7,145,7,247,100,247,
+76,21,251,100,251,54,5,175,123,110,158,101,27,101,110,120,103,123,31,251,
+100,247,54,5,14,247,13,249,42,248,60,21,160,179,133,131,173,31,130,178,147,
+137,158,27,162,175,144,143,156,31,157,144,147,146,150,26,152,127,151,110,
+154,30,102,158,251,0,179,91,151,8,150,93,251,25,154,88,27,115,126,136,128,
+113,31,93,120,92,116,108,122,110,123,132,137,103,136,91,135,138,139,128,130,
+8,116,121,123,85,80,26,91,151,84,155,114,30,143,132,139,139,186,130,161,136,
+151,138,156,137,159,137,141,139,145,137,144,137,144,136,149,133,8,97,215,
+141,138,181,27,173,207,148,153,199,31,176,147,156,154,166,26,147,138,146,
+138,148,30,170,149,149,149,163,26,157,135,149,124,155,30,174,153,156,156,
+161,26,160,131,149,102,172,30,252,139,209,21,151,131,134,143,130,27,92,102,
+54,251,0,33,169,74,187,150,147,142,150,148,31,138,136,137,139,138,27,91,111,
+197,239,210,156,205,163,164,31,151,151,146,141,161,140,8,14,239,174,248,143,
+21,251,238,7,245,126,150,164,5,222,188,6,162,138,160,136,145,136,146,137,
+155,131,164,125,8,114,185,162,134,200,27,181,6,149,6,120,152,158,130,169,
+27,212,209,179,180,153,133,151,120,161,31,147,149,140,144,151,26,163,130,
+156,115,154,30,144,150,141,145,145,26,151,134,148,126,154,30,169,234,144,
+143,168,31,200,145,168,157,170,26,160,120,160,107,152,30,153,104,251,2,148,
+251,21,27,112,121,138,135,105,31,152,120,123,144,118,27,108,109,128,109,93,
+31,113,97,118,130,114,27,134,137,139,140,132,31,173,7,43,105,21,202,251,164,
+86,6,225,247,129,21,174,140,150,143,169,157,191,172,139,139,154,147,8,151,
+165,160,146,153,27,160,162,129,124,154,31,210,68,5,151,126,147,125,129,26,
+123,120,125,118,117,125,146,164,110,30,81,188,127,125,181,85,5,112,115,108,
+125,106,27,127,119,142,144,117,31,126,142,131,124,206,116,5,193,6,153,93,
+148,129,174,133,140,105,149,124,164,134,8,126,7,138,117,130,139,127,27,86,
+98,148,159,107,31,132,144,131,144,131,144,125,147,128,145,132,142,125,143,
+128,141,115,140,8,247,191,247,157,21,142,180,159,140,163,27,222,243,131,131,
+165,31,165,131,152,127,125,26,130,133,130,130,135,30,131,119,41,133,43,27,
+134,126,139,140,120,31,163,98,21,152,130,143,133,130,26,121,126,126,102,123,
+30,115,88,89,121,124,27,119,121,155,157,160,166,167,160,141,143,138,137,144,
+31,133,155,153,137,154,27,170,165,150,164,161,31,141,142,139,139,141,141,
+8,159,63,21,150,151,126,126,119,120,118,111,128,31,126,107,97,128,118,27,
+124,126,150,153,153,144,143,167,147,31,144,140,150,144,154,146,8,177,217,
+139,139,144,27,76,251,6,21,142,151,148,141,140,27,163,150,154,146,151,145,
+8,142,143,142,140,140,27,147,150,121,127,116,77,109,91,115,121,151,155,147,
+141,141,154,142,31,14,251,182,247,204,248,85,21,127,168,132,160,124,182,8,
+247,15,98,114,180,105,27,108,110,110,107,118,157,73,158,86,31,169,58,140,
+136,144,120,8,145,124,127,143,131,27,109,99,99,110,125,142,121,144,119,31,
+103,110,109,100,95,160,80,171,92,31,86,176,201,110,219,27,217,222,181,199,
+183,31,169,181,159,207,198,26,179,133,174,126,169,30,132,157,132,144,114,
+145,136,140,129,142,129,142,8,192,247,42,151,180,177,26,172,116,166,112,129,
+128,135,131,130,30,113,118,126,115,113,66,133,124,121,92,120,89,8,251,126,
+251,142,21,116,7,152,115,152,119,149,130,8,122,158,166,126,157,27,148,154,
+145,146,148,31,149,147,143,147,155,26,143,139,146,138,146,30,161,6,144,90,
+144,128,171,108,149,148,24,138,144,138,144,138,141,8,131,169,134,159,146,
+26,160,168,188,168,167,30,164,165,156,147,177,146,8,166,7,118,139,139,134,
+91,31,129,138,85,153,124,146,8,121,148,123,162,155,26,146,142,150,144,151,
+30,167,130,139,139,176,133,247,21,117,139,139,143,137,8,168,125,151,114,90,
+26,251,38,44,37,251,28,91,91,152,160,115,30,126,150,105,192,133,155,8,116,
+211,139,139,144,26,157,165,165,157,155,143,134,87,174,30,176,84,139,139,134,
+26,129,121,127,126,117,96,182,172,127,30,247,89,247,118,21,142,124,128,140,
+131,27,133,128,137,137,126,31,134,148,139,139,125,178,8,97,247,7,132,161,
+172,26,154,149,151,151,151,147,132,122,148,30,151,115,180,251,4,167,54,8,
+196,22,247,113,215,145,152,163,27,150,149,127,125,118,101,251,20,110,68,31,
+251,143,99,21,160,135,147,133,148,125,8,179,77,170,77,124,26,129,128,128,
+127,128,122,150,154,125,30,101,181,103,199,159,26,149,144,146,156,152,30,
+143,142,139,140,143,141,8,247,29,251,30,21,116,194,165,131,150,137,170,135,
+25,14,155,221,247,94,21,152,122,83,251,3,5,136,133,137,135,138,26,137,142,
+137,141,141,142,140,141,144,30,227,171,191,195,5,123,199,166,134,174,27,158,
+173,142,145,212,31,243,128,231,162,153,83,5,247,42,6,162,247,34,5,242,7,116,
+210,251,42,148,125,119,109,140,128,143,116,154,25,47,198,213,223,5,144,145,
+141,143,146,26,166,119,164,117,131,130,136,134,135,30,53,43,79,174,74,110,
+101,111,48,53,25,116,72,135,125,128,93,8,248,162,225,21,150,87,142,114,107,
+26,114,137,117,131,94,30,121,79,113,134,113,27,120,129,140,149,80,31,111,
+135,116,136,125,136,8,134,115,120,136,128,27,129,98,146,141,133,31,137,140,
+137,141,140,26,140,141,140,141,141,140,8,151,149,143,145,150,26,159,122,158,
+120,137,138,138,138,139,139,138,140,138,30,148,128,144,124,127,26,124,133,
+129,131,30,125,140,5,119,6,125,130,148,152,159,150,157,155,147,31,167,152,
+159,152,141,139,161,140,25,247,16,6,161,158,143,144,145,156,8,122,98,118,
+132,119,27,125,140,186,192,140,148,140,147,140,143,25,140,147,140,144,142,
+26,142,137,145,136,149,30,199,209,247,12,69,5,251,239,78,21,113,73,133,124,
+120,117,114,118,25,121,6,166,197,130,166,121,149,166,229,143,151,140,140,
+160,158,25,214,205,5,159,161,192,170,150,27,147,148,133,116,169,31,251,205,
+252,60,21,138,136,136,139,136,27,132,133,144,146,142,141,148,141,142,31,154,
+165,5,156,149,139,139,144,27,148,161,108,125,133,135,135,131,136,31,160,247,
+85,21,146,132,141,134,127,26,103,124,113,119,136,134,139,140,134,30,247,176,
+247,60,21,94,110,89,113,132,131,140,141,130,30,248,91,247,1,21,156,97,146,
+104,82,26,90,134,107,127,94,30,33,130,5,155,194,146,187,190,26,167,137,153,
+129,212,30,14,211,247,86,248,190,21,106,100,88,97,120,154,122,155,170,177,
+190,182,158,126,155,124,31,210,226,21,251,41,114,58,251,28,180,251,46,248,
+70,251,153,155,130,147,136,168,137,25,247,169,6,163,151,147,155,145,137,143,
+134,149,31,251,35,247,143,128,159,134,144,123,148,25,129,145,5,252,63,247,
+122,21,173,251,11,66,251,15,251,13,113,106,247,22,208,247,7,5,249,41,252,
+51,21,161,106,139,138,130,26,127,125,114,125,127,30,132,132,125,135,124,27,
+251,73,6,233,202,179,208,147,247,1,8,252,59,247,175,21,248,30,251,132,5,142,
+121,140,131,125,26,125,138,129,136,119,30,252,2,247,111,5,127,119,21,248,
+5,251,115,135,112,103,79,116,121,25,252,5,247,115,5,127,119,21,248,1,251,
+112,123,120,106,110,126,133,25,252,50,247,145,5,14,233,247,37,248,60,21,114,
+125,111,89,88,152,111,165,164,153,167,189,190,125,167,114,31,130,251,175,
+21,248,96,6,140,158,140,139,142,27,149,141,139,139,153,149,247,117,247,49,
+24,169,159,140,141,152,26,151,138,141,109,159,30,251,117,247,49,136,141,136,
+141,135,142,25,136,142,134,140,133,140,8,137,131,139,140,126,31,252,96,6,
+38,251,11,5,251,64,7,247,84,148,21,57,40,57,234,5,247,54,7,221,234,221,41,
+5,248,56,251,123,21,167,200,151,187,184,26,183,127,185,111,201,30,247,50,
+251,1,5,146,122,141,129,122,26,122,137,129,132,123,30,251,97,247,109,21,151,
+121,151,109,150,107,8,252,20,6,73,219,5,209,251,133,21,247,23,248,24,7,144,
+121,141,124,106,26,107,137,124,134,121,30,136,108,21,122,96,135,128,129,117,
+8,252,66,6,207,215,5,14,211,247,45,247,156,21,122,125,123,120,97,178,88,172,
+155,151,155,158,182,102,189,107,31,247,4,251,106,21,248,55,247,145,166,154,
+141,141,152,162,25,247,34,247,141,5,145,149,141,144,144,26,155,127,147,115,
+30,251,169,6,112,137,129,136,123,130,252,70,251,151,24,98,251,46,220,251,
+26,5,247,33,138,21,251,16,162,70,247,7,172,247,21,247,13,113,212,251,15,5,
+248,58,247,73,21,131,247,0,99,208,45,201,8,247,73,6,151,155,136,135,144,31,
+154,127,155,112,126,26,129,139,138,117,107,30,252,140,252,55,21,167,243,248,
+2,247,111,5,142,119,140,129,125,26,125,138,130,136,122,30,252,14,251,7,21,
+76,244,248,5,247,113,162,122,175,79,142,112,25,252,79,42,21,251,3,160,248,
+50,247,143,152,133,171,111,155,120,25,14,245,247,59,248,131,21,62,84,75,49,
+80,165,90,183,112,31,129,156,149,137,167,27,247,51,6,182,151,163,162,173,
+27,162,158,125,105,160,31,78,178,153,127,176,27,184,200,166,206,247,2,31,
+206,180,180,169,182,178,63,203,129,146,97,166,8,220,251,22,78,167,93,27,102,
+117,122,96,116,31,92,116,114,117,110,27,108,117,164,188,126,31,248,53,251,
+32,21,43,6,186,127,119,162,108,27,101,108,101,92,94,168,102,176,171,161,163,
+188,151,31,235,66,6,100,88,37,91,107,27,112,119,153,174,118,31,196,104,119,
+154,101,27,96,104,114,99,124,31,251,30,6,91,96,194,200,205,183,192,194,31,
+247,22,6,90,159,169,115,180,27,176,161,157,194,172,31,182,165,156,152,170,
+27,161,155,133,114,187,31,187,113,163,125,163,122,8,14,247,27,250,62,247,
+238,21,140,135,138,140,135,27,136,140,139,139,132,141,64,158,95,175,66,239,
+8,197,97,105,162,97,27,91,91,98,83,123,31,127,94,139,139,134,126,8,110,128,
+126,130,111,27,115,126,147,167,123,31,195,107,139,139,251,55,27,80,121,136,
+127,119,31,108,119,122,94,76,26,74,160,90,174,123,30,131,158,153,138,204,
+27,247,44,139,139,203,179,31,160,153,148,145,162,27,172,154,124,93,152,31,
+155,81,139,139,147,126,8,102,161,176,117,178,27,182,172,162,198,182,31,213,
+243,185,175,228,159,8,251,148,155,21,210,137,5,242,133,147,138,132,26,132,
+99,134,69,137,30,67,137,127,138,5,104,125,118,120,110,27,104,112,170,178,
+178,167,171,173,167,161,120,104,153,31,14,55,249,101,63,10,83,140,71,119,
+99,110,62,62,251,35,251,91,33,251,71,8,116,126,133,132,133,27,133,132,148,
+155,132,31,110,210,5,155,133,134,143,127,27,117,107,126,117,111,31,126,129,
+134,131,126,26,97,173,37,177,66,30,122,147,145,137,180,27,189,151,143,159,
+150,31,246,247,91,247,123,247,214,247,41,247,50,8,14,146,249,191,249,47,21,
+151,7,161,134,144,117,118,131,137,125,122,30,57,74,92,97,49,46,79,77,96,95,
+115,117,62,66,24,111,110,137,138,130,27,136,132,142,143,132,31,127,146,135,
+148,136,160,132,181,134,169,138,146,134,167,135,170,140,141,8,158,136,144,
+125,149,30,144,131,130,142,129,27,124,117,136,133,124,31,124,134,131,132,
+107,100,114,109,139,139,138,128,8,137,128,136,87,125,26,116,141,112,143,107,
+30,147,77,144,97,140,122,140,114,142,133,149,127,154,123,158,122,158,126,
+8,115,173,152,134,161,27,158,154,148,177,183,31,239,225,247,96,247,91,207,
+217,214,226,191,196,154,153,154,153,148,150,142,144,8,14,62,249,107,249,13,
+21,80,198,251,179,251,180,251,179,247,180,80,80,247,180,251,178,251,180,251,
+180,198,80,247,179,247,181,247,179,251,181,198,198,251,180,247,180,5,14,61,
+249,107,248,154,21,251,66,247,66,251,64,251,66,251,64,247,66,251,66,251,66,
+247,66,251,63,251,66,251,65,247,66,251,66,247,64,247,66,247,64,251,66,247,
+66,247,66,251,66,247,65,5,14,251,160,248,180,249,40,21,139,137,137,137,138,
+30,129,128,138,138,137,137,135,136,25,150,125,123,148,134,27,135,137,137,
+99,104,31,68,57,99,93,122,116,135,147,137,144,138,140,104,204,24,99,222,139,
+139,137,140,8,143,136,136,140,135,27,136,136,138,137,137,31,133,131,133,133,
+5,140,135,136,139,137,27,138,136,139,138,136,31,144,131,135,141,135,27,129,
+122,118,127,138,31,138,152,102,165,64,30,151,107,151,108,150,108,141,135,
+142,129,145,124,251,13,251,38,99,87,121,107,120,104,126,117,135,133,8,129,
+126,133,129,134,26,138,142,132,143,129,30,140,136,140,136,138,26,137,137,
+132,136,129,30,138,136,138,137,136,26,131,139,139,161,105,30,130,144,141,
+138,147,27,158,161,144,146,150,31,186,220,219,247,17,210,240,172,83,139,139,
+207,40,8,111,158,144,134,147,27,151,159,154,148,141,137,142,137,143,31,138,
+143,5,141,142,142,146,144,30,149,147,5,146,7,148,143,141,142,143,146,135,
+149,24,136,147,138,140,127,166,120,178,121,178,113,194,136,145,130,157,125,
+165,190,211,247,0,247,31,166,168,8,148,148,141,143,142,26,141,136,145,135,
+143,30,130,149,139,140,135,145,8,146,135,138,140,138,27,14,251,54,248,242,
+249,26,21,136,138,125,152,142,26,141,139,140,140,141,30,142,142,139,141,140,
+26,144,138,108,167,134,27,131,251,29,251,31,42,51,31,93,203,117,172,86,225,
+8,148,131,135,142,131,27,126,130,129,121,137,31,131,138,133,132,134,27,137,
+135,141,143,136,31,136,142,134,144,132,144,119,120,136,136,125,117,144,104,
+203,251,35,187,55,136,136,136,135,137,136,112,108,112,107,111,108,112,107,
+116,111,113,104,142,128,139,139,144,128,8,146,126,139,139,136,26,134,136,
+132,135,133,30,136,135,137,136,137,26,132,169,98,147,135,30,145,152,146,142,
+142,27,142,142,136,136,138,139,137,138,136,31,138,138,138,136,135,26,158,
+118,5,152,6,185,204,159,166,147,149,208,229,24,149,153,154,120,141,136,167,
+97,25,169,95,150,125,166,111,8,138,142,142,138,140,27,147,152,149,156,153,
+31,143,143,141,141,141,27,140,142,137,137,142,31,128,154,141,138,143,27,142,
+165,160,142,140,31,136,150,5,140,7,140,141,140,153,151,30,166,159,144,147,
+144,166,125,151,78,214,66,235,201,217,219,227,216,217,8,138,141,138,140,141,
+26,140,141,141,141,142,30,147,149,139,139,141,147,136,143,134,147,130,152,
+8,137,142,137,142,138,26,14,63,248,64,249,4,21,47,251,122,251,123,47,247,
+123,251,123,231,247,123,247,122,231,251,122,6,208,247,192,21,251,124,251,
+123,251,122,251,124,247,122,251,122,247,124,247,122,247,123,247,124,251,123,
+6,104,247,88,21,251,123,247,123,251,53,251,123,251,123,251,53,247,123,251,
+123,247,53,247,123,247,123,7,14,60,248,132,53,10,251,123,251,122,251,122,
+251,123,247,122,251,122,247,123,247,122,247,122,247,123,251,122,6,14,59,247,
+217,22,247,2,247,182,251,2,6,247,2,4,247,2,247,182,251,2,6,251,182,251,182,
+21,251,2,247,182,247,2,7,247,2,22,251,2,247,182,247,2,7,14,54,247,165,22,
+247,101,247,130,251,101,6,247,101,4,247,101,247,130,251,101,6,251,130,251,
+130,21,251,101,247,130,247,101,7,247,101,22,251,101,247,130,247,101,7,14,
+251,237,247,94,53,10,251,73,251,59,47,247,59,252,54,230,248,54,247,59,231,
+251,59,247,73,7,14,251,179,247,73,53,10,251,40,251,38,251,9,7,229,64,5,195,
+251,172,6,225,68,5,246,247,243,247,35,247,15,6,61,208,5,74,216,6,63,210,5,
+46,115,21,232,251,39,247,33,45,251,33,251,247,46,247,247,251,38,233,247,38,
+6,14,251,194,247,117,249,21,21,251,44,251,32,54,247,32,251,246,230,247,246,
+247,29,224,251,29,247,44,7,251,32,188,21,251,43,251,33,251,77,247,33,251,
+246,247,83,247,246,247,28,247,77,251,28,247,43,7,251,58,115,21,247,33,251,
+44,247,28,251,27,251,28,251,246,251,33,247,246,251,33,247,27,247,33,6,14,
+251,154,244,248,231,21,117,7,239,137,208,50,133,251,9,8,121,6,81,99,152,169,
+103,31,98,173,123,173,192,26,115,252,3,163,6,140,234,225,211,247,0,135,8,
+153,125,6,251,2,143,69,57,42,27,116,248,2,162,7,43,141,72,218,247,3,26,153,
+7,162,140,5,247,2,216,71,43,31,163,248,3,115,6,136,40,56,71,251,2,143,125,
+138,24,132,247,10,210,230,238,138,8,161,7,14,251,39,247,238,249,82,21,33,
+251,73,5,251,97,6,241,251,67,37,251,69,5,247,97,6,245,251,75,244,247,75,5,
+247,98,6,37,247,69,241,247,67,5,251,98,6,251,81,106,21,247,60,6,221,251,34,
+57,251,36,5,251,60,6,57,247,36,5,247,58,247,176,21,201,251,1,5,251,17,6,247,
+82,106,21,247,13,6,79,35,5,62,4,198,34,5,251,11,6,76,106,21,74,251,0,80,247,
+0,5,72,172,21,251,15,6,200,244,5,216,4,80,243,5,247,11,6,14,86,248,46,247,
+253,21,138,164,150,189,158,202,8,170,232,139,139,165,26,188,106,177,97,96,
+105,99,91,122,142,121,144,123,30,176,251,7,151,89,141,99,75,147,120,143,101,
+152,8,175,251,0,139,139,112,27,90,102,107,96,96,177,106,187,159,160,142,145,
+158,31,240,172,186,151,187,143,140,123,133,105,121,72,8,103,251,1,139,139,
+110,26,89,172,102,181,181,173,177,188,157,135,160,132,160,30,103,247,5,132,
+168,134,192,171,137,187,129,185,124,8,106,239,139,139,167,27,189,176,169,
+182,183,101,172,88,120,121,137,133,123,31,251,7,102,133,137,61,128,8,14,248,
+22,248,44,21,108,134,119,119,134,108,71,140,123,144,113,173,8,174,110,113,
+154,105,27,87,95,95,85,86,183,95,191,174,164,153,175,168,31,164,172,155,144,
+208,140,144,109,159,119,169,134,8,72,133,122,106,113,30,103,110,125,113,105,
+26,87,184,95,192,192,183,183,191,173,125,165,103,168,30,106,164,133,155,208,
+26,169,144,159,159,144,169,208,138,155,134,164,106,8,103,168,164,125,174,
+27,191,183,183,192,193,95,183,87,104,114,124,104,110,31,108,115,120,131,84,
+27,127,138,134,170,119,159,109,144,25,208,145,155,172,164,30,174,168,154,
+165,173,26,191,95,183,86,86,94,95,87,105,154,113,174,110,30,170,115,147,120,
+84,26,14,248,15,247,215,21,108,121,107,103,105,30,94,97,126,114,96,26,68,
+198,80,210,211,197,198,210,173,124,174,114,163,30,85,189,118,171,178,26,175,
+162,126,94,182,31,98,178,168,125,181,27,211,196,196,211,211,81,198,68,103,
+102,122,112,115,31,89,94,108,119,100,27,143,183,149,158,183,180,8,178,175,
+155,171,180,26,209,80,198,68,68,80,80,69,98,154,110,180,99,30,179,99,156,
+109,140,106,8,95,129,145,200,80,31,170,108,107,154,101,27,68,80,80,69,67,
+200,79,210,176,168,152,168,168,31,196,198,151,146,187,146,8,14,90,248,49,
+247,228,21,247,32,6,124,120,135,126,121,26,104,167,111,174,175,162,162,184,
+146,30,134,151,147,137,151,27,175,164,164,177,175,115,165,105,128,131,137,
+132,123,31,188,128,118,161,105,27,103,112,112,104,119,143,127,154,122,31,
+251,32,247,31,6,125,161,150,135,155,27,174,166,168,175,174,112,166,99,144,
+31,144,150,141,146,148,26,176,108,169,102,105,109,113,109,129,141,132,145,
+118,30,91,133,115,118,102,26,101,166,110,176,157,152,144,151,156,30,251,31,
+251,29,7,152,158,144,150,155,26,173,108,169,104,111,114,121,114,131,30,137,
+133,138,133,138,124,8,144,125,132,140,129,27,104,110,112,106,105,169,110,
+174,149,146,141,145,152,31,95,145,165,113,175,27,173,167,168,173,158,134,
+152,127,159,31,247,29,251,35,6,152,122,126,143,121,27,103,113,113,102,101,
+166,113,182,136,31,134,126,137,133,129,26,103,169,110,175,175,170,169,174,
+149,137,145,132,152,30,182,144,164,164,177,26,175,112,165,104,121,125,135,
+127,121,30,14,93,248,31,63,10,135,137,135,132,137,31,129,85,79,43,76,74,82,
+82,75,102,53,114,8,130,137,136,136,135,26,135,142,136,147,137,30,191,129,
+246,74,194,86,200,81,188,53,152,66,8,132,140,141,136,143,27,143,141,142,146,
+141,31,151,198,190,224,201,205,205,208,214,183,222,156,8,148,141,142,142,
+144,26,143,136,141,131,141,30,251,44,176,251,40,247,32,98,247,35,8,167,133,
+139,141,133,27,14,94,248,20,63,10,90,251,63,251,28,251,27,251,56,98,8,120,
+7,247,69,89,247,29,251,30,174,251,57,8,156,6,182,247,63,247,44,247,42,247,
+55,171,8,158,7,251,63,177,251,37,247,33,97,247,60,8,130,97,21,163,251,19,
+155,89,174,76,210,101,182,126,247,29,116,117,134,119,135,133,137,102,132,
+108,132,123,135,96,128,106,126,96,115,105,82,122,84,115,251,19,112,247,22,
+121,193,108,194,8,72,175,110,148,251,43,171,247,29,165,186,153,202,173,175,
+204,151,177,167,247,29,8,14,116,248,45,249,87,21,52,251,162,5,251,179,6,247,
+126,251,66,49,251,168,247,122,247,62,247,123,251,62,50,247,168,247,123,247,
+66,5,251,180,6,14,123,248,50,249,99,21,36,251,134,251,168,117,247,101,251,
+76,79,251,161,247,122,247,43,247,128,251,43,69,247,161,247,99,247,76,251,
+167,161,5,41,247,102,21,200,251,154,247,170,157,251,124,251,46,245,251,149,
+251,105,247,76,251,101,251,76,239,247,149,251,127,247,46,247,171,121,5,14,
+89,248,36,249,86,45,10,133,113,21,215,251,116,5,247,136,6,251,90,251,38,211,
+251,126,251,86,247,38,251,97,251,38,218,247,126,251,83,247,38,5,247,134,6,
+14,141,248,49,249,86,21,56,251,184,251,187,151,247,142,251,48,35,251,176,
+247,124,247,83,247,134,251,83,251,5,247,176,247,157,247,48,251,204,127,5,
+59,144,21,196,187,90,81,80,92,92,80,79,92,186,199,198,187,186,199,31,14,123,
+248,51,249,86,21,37,251,136,251,170,118,247,103,251,76,75,251,161,247,125,
+247,43,247,126,251,43,70,247,161,247,101,247,76,251,167,160,5,40,247,102,
+21,200,251,153,5,151,115,122,143,117,27,116,123,135,127,117,31,248,40,158,
+21,251,124,251,46,5,144,154,140,149,151,26,176,123,170,104,169,30,247,41,
+252,28,21,251,105,247,72,190,145,173,162,163,185,25,251,211,251,151,21,242,
+247,151,166,88,171,117,187,137,25,251,239,247,123,21,247,174,120,5,106,110,
+122,108,110,26,127,142,123,143,120,30,14,133,248,53,248,187,21,72,251,69,
+5,251,47,6,247,8,46,94,251,55,247,43,237,247,40,41,84,247,56,247,14,231,5,
+251,38,6,70,247,224,21,34,251,170,5,251,169,6,247,105,251,59,62,251,167,247,
+138,247,55,247,141,251,55,49,247,167,247,114,247,59,5,251,166,6,32,247,96,
+21,228,251,120,5,247,107,6,251,68,251,25,209,251,112,251,90,247,23,251,91,
+251,23,200,247,112,251,60,247,25,5,247,110,6,14,116,248,46,248,125,21,94,
+251,9,5,251,8,6,227,68,102,251,22,247,2,216,245,62,105,247,22,232,210,5,251,
+12,6,204,229,21,36,247,130,5,143,138,137,140,135,27,136,137,138,135,137,31,
+37,251,130,251,150,112,5,134,136,136,135,138,141,136,141,137,31,247,87,251,
+48,78,251,157,5,135,7,136,142,135,141,140,30,141,141,140,140,141,31,247,118,
+247,35,247,115,251,39,5,138,141,141,138,141,27,141,142,142,143,31,142,7,80,
+247,161,247,85,247,48,5,142,142,140,141,141,26,143,137,141,133,30,252,0,247,
+52,21,213,251,75,247,82,127,251,39,251,5,189,251,97,251,59,247,8,251,63,251,
+8,192,247,97,251,37,247,5,247,83,151,5,14,131,248,56,249,87,21,42,251,166,
+5,251,180,6,247,124,251,57,43,251,173,247,141,247,68,247,148,251,68,38,247,
+173,247,113,247,57,5,251,173,6,251,69,120,21,221,247,133,5,251,231,7,217,
+237,21,247,135,6,251,213,41,5,247,24,91,21,229,251,128,251,114,247,176,5,
+251,23,4,251,105,251,45,247,105,247,175,5,251,21,92,21,251,96,247,38,247,
+225,40,5,14,223,248,43,249,86,21,51,251,156,5,251,176,6,247,118,251,64,53,
+251,152,247,23,116,247,70,247,22,247,38,32,5,247,25,6,49,247,152,247,107,
+247,45,76,158,5,251,105,6,57,247,137,5,251,6,121,21,221,251,138,5,247,139,
+6,251,95,251,33,214,251,131,251,93,247,44,251,102,251,44,220,247,131,251,
+82,247,33,5,247,130,6,14,44,248,84,53,10,251,42,251,115,6,251,77,247,10,61,
+251,25,247,89,251,1,251,89,251,2,217,251,24,247,77,247,9,5,251,111,247,42,
+247,111,7,247,76,251,9,217,247,24,251,89,247,2,247,89,247,1,61,247,25,251,
+76,251,10,5,14,251,8,248,52,53,10,251,1,251,135,247,1,6,251,1,252,84,21,247,
+1,247,135,251,1,6,248,17,247,120,21,84,233,251,102,251,13,193,44,5,252,78,
+251,21,21,194,44,247,102,247,14,85,234,5,251,48,247,115,21,84,45,247,103,
+251,14,193,234,5,247,225,251,211,21,194,234,251,103,247,14,85,44,5,14,49,
+248,33,53,10,90,6,153,251,212,251,108,247,122,112,108,247,121,251,104,251,
+205,152,5,96,247,205,7,251,121,251,102,176,107,247,98,247,121,125,251,207,
+5,188,6,127,247,207,247,107,251,121,170,171,251,126,247,102,5,247,209,182,
+6,251,209,126,247,126,247,104,108,170,251,107,251,122,5,14,90,247,250,248,
+57,21,251,107,247,71,5,140,137,137,141,137,27,136,136,135,136,137,139,138,
+140,138,31,247,72,251,107,251,163,111,5,134,138,137,137,135,26,135,141,137,
+142,138,30,247,165,118,251,69,251,103,5,137,136,138,137,137,26,136,143,135,
+142,141,140,140,140,140,30,247,107,247,70,167,251,168,5,134,142,136,143,142,
+143,141,142,30,161,247,171,247,101,251,70,145,136,5,142,142,143,142,141,139,
+140,138,140,31,251,65,247,107,247,172,165,5,143,140,142,142,143,26,143,137,
+142,136,30,251,174,161,247,72,247,110,5,141,141,140,142,141,26,142,135,142,
+135,138,137,139,138,30,251,111,251,78,110,247,170,5,143,136,142,135,136,136,
+137,137,30,14,92,248,41,63,10,128,6,81,251,113,251,80,247,13,131,132,247,
+11,251,95,251,116,88,5,129,7,247,116,86,251,11,251,81,147,131,247,92,247,
+10,185,251,108,5,150,6,195,247,117,247,80,251,11,148,147,251,9,247,87,247,
+109,188,5,151,7,251,113,193,247,17,247,84,132,147,251,95,251,15,5,38,120,
+21,188,247,94,5,251,201,7,192,244,21,247,69,247,4,251,112,251,111,5,247,6,
+175,21,247,87,93,5,251,196,6,241,85,21,247,3,251,66,251,107,247,105,5,172,
+251,3,21,93,251,93,5,247,201,7,87,251,0,21,251,73,251,5,247,115,247,116,5,
+251,6,100,21,251,101,185,247,205,142,5,38,190,21,251,1,247,70,247,107,251,
+109,5,14,251,36,248,102,247,237,21,247,84,247,65,5,141,141,140,140,141,26,
+141,137,141,136,30,136,6,251,138,59,85,247,145,5,143,138,138,141,136,27,136,
+138,137,135,138,31,85,251,145,251,138,219,5,136,6,136,137,137,137,137,140,
+138,141,137,31,247,84,251,65,251,84,251,66,5,137,138,138,137,138,26,136,141,
+137,142,30,139,141,139,140,140,30,247,138,219,193,251,146,5,136,140,141,137,
+141,27,142,140,141,142,140,31,193,247,146,247,138,59,5,140,138,141,139,139,
+26,142,141,141,142,140,138,141,137,140,31,14,76,248,126,248,92,21,182,247,
+122,5,140,141,139,140,139,26,142,135,142,135,136,136,138,136,137,30,251,24,
+251,83,251,29,247,86,5,141,138,136,140,137,27,135,137,136,134,140,31,182,
+251,125,251,126,183,5,136,6,136,136,136,136,136,140,137,142,137,31,247,88,
+251,33,251,90,251,25,5,135,136,138,138,136,26,136,142,136,143,140,30,142,
+6,247,128,178,96,251,131,5,135,138,141,135,143,27,141,141,140,141,141,31,
+247,29,247,88,247,28,251,87,5,136,141,142,138,141,27,141,141,141,143,140,
+31,140,139,141,138,140,30,96,247,129,247,134,91,5,141,140,138,139,31,142,
+142,142,142,142,137,141,137,141,31,251,95,247,34,247,95,247,34,5,142,141,
+140,141,141,26,143,137,141,135,30,136,6,14,68,248,167,249,78,21,251,40,251,
+60,251,37,247,60,153,251,109,251,109,155,247,60,251,39,251,60,251,38,247,
+109,154,125,251,118,247,37,247,61,247,40,251,61,125,247,118,247,109,124,251,
+59,247,38,247,59,247,39,251,109,123,5,14,92,248,219,249,52,21,251,32,251,
+23,89,247,71,94,251,71,251,23,247,23,184,251,67,251,68,183,247,23,251,22,
+251,74,89,247,74,85,251,23,251,23,247,68,185,94,251,67,247,23,247,21,184,
+251,69,189,247,69,247,32,251,21,90,247,67,247,66,93,251,17,247,23,247,66,
+193,251,66,189,247,17,247,22,251,66,95,5,14,59,248,0,249,73,21,251,161,7,
+42,247,142,103,125,245,251,140,251,79,247,85,112,112,247,87,251,81,251,142,
+246,125,104,247,146,40,5,251,165,106,247,165,6,251,146,42,153,103,247,142,
+247,2,251,87,251,83,166,112,247,79,247,89,33,251,143,175,125,236,247,147,
+5,251,167,172,247,167,7,235,251,147,174,153,32,247,143,247,81,251,89,166,
+166,251,85,247,83,247,139,251,2,154,175,251,143,236,5,247,162,172,251,162,
+6,247,143,238,124,174,251,139,32,247,85,247,81,112,166,251,81,251,85,246,
+247,140,104,153,43,251,142,5,247,161,7,14,251,24,247,156,247,187,21,55,132,
+90,128,89,116,8,105,124,127,124,114,26,107,167,109,169,152,151,144,153,159,
+30,185,173,167,170,189,210,8,247,73,245,21,224,146,184,149,192,163,8,173,
+153,151,155,164,26,171,112,169,109,101,70,75,45,74,30,251,73,142,21,90,209,
+110,171,93,172,8,154,119,127,144,126,27,109,111,109,107,114,151,124,173,124,
+31,190,116,188,128,222,132,8,247,71,36,21,45,203,209,75,177,27,169,166,169,
+171,164,127,154,105,154,31,87,163,93,149,54,146,8,50,247,28,21,93,100,101,
+94,92,176,100,186,186,177,177,186,185,101,177,93,31,140,161,21,178,224,156,
+196,191,26,173,116,162,104,105,116,116,106,86,156,81,180,52,30,251,99,4,98,
+52,122,81,86,26,105,162,117,174,173,162,162,173,190,122,198,100,223,30,14,
+251,23,247,161,247,158,21,142,146,135,131,151,31,146,133,146,135,145,137,
+8,155,134,142,136,124,26,125,135,121,128,107,30,123,90,133,113,116,26,100,
+166,107,171,175,165,169,181,165,133,167,123,182,30,130,164,134,162,153,26,
+155,142,144,154,143,30,146,141,148,144,148,147,8,144,146,145,143,143,27,150,
+164,118,111,164,31,77,193,165,121,175,27,170,165,164,168,164,125,163,117,
+152,31,117,152,115,147,87,149,8,89,148,114,151,155,26,140,139,143,140,143,
+30,140,143,139,144,145,26,145,139,144,138,142,30,138,144,139,143,140,26,155,
+163,151,190,148,30,191,149,163,147,161,152,8,161,152,153,163,163,26,169,113,
+164,108,103,113,121,77,85,30,110,114,114,119,128,27,135,133,143,144,132,31,
+130,146,130,145,132,141,8,124,143,136,144,155,26,153,144,162,148,164,30,155,
+182,145,167,165,26,181,113,169,104,106,112,107,100,116,144,114,156,89,30,
+149,108,143,120,126,26,124,136,135,123,134,30,132,137,130,133,130,132,8,134,
+132,133,135,136,27,128,116,159,168,112,31,202,83,115,156,103,27,109,112,113,
+110,115,154,115,161,126,31,160,126,161,132,194,128,8,188,130,165,126,126,
+26,137,138,135,138,133,30,138,136,139,134,133,26,133,139,134,140,135,30,140,
+134,140,135,137,26,126,112,126,91,129,30,85,129,116,132,118,126,8,117,125,
+124,116,115,26,109,166,114,170,174,164,156,202,195,30,165,169,162,157,150,
+140,8,224,247,45,21,180,171,106,97,99,106,106,99,99,106,172,180,180,172,172,
+179,31,14,251,49,247,209,247,236,21,98,115,117,134,251,2,124,98,134,111,129,
+125,124,8,123,122,129,115,118,26,130,140,126,142,124,30,114,169,156,131,167,
+27,172,162,154,183,172,31,204,223,160,162,181,162,8,92,130,108,99,42,30,127,
+111,133,115,120,26,122,148,118,154,123,30,151,126,152,132,167,129,162,147,
+151,145,150,148,8,157,155,152,164,159,26,158,133,163,128,167,30,97,237,131,
+169,186,26,182,114,157,121,206,52,8,95,172,162,124,172,27,167,156,147,164,
+169,31,141,154,141,151,149,26,158,131,159,126,156,30,124,158,113,150,92,145,
+33,153,111,146,97,163,179,163,171,147,243,153,180,144,167,149,153,154,8,155,
+156,149,163,160,26,148,137,152,137,154,30,164,109,122,147,111,27,107,115,
+123,96,106,31,74,54,118,117,97,115,8,187,147,168,181,238,30,150,167,145,163,
+158,26,156,130,160,124,155,30,127,152,126,146,111,149,116,131,127,132,129,
+131,8,120,122,126,114,120,26,120,145,115,151,111,30,179,42,148,108,91,26,
+97,163,118,161,74,224,8,182,106,116,155,106,27,112,121,131,114,109,31,136,
+124,138,126,130,26,120,146,119,153,122,30,154,119,165,129,186,133,244,125,
+169,131,180,115,8,14,251,30,247,220,248,26,21,40,247,17,5,170,114,101,159,
+105,27,116,111,129,116,95,31,138,119,138,122,124,26,70,175,101,212,131,30,
+247,54,120,251,54,121,5,66,130,103,101,71,26,124,140,122,140,119,30,117,181,
+169,128,157,27,171,187,163,166,161,31,238,247,17,74,251,35,5,126,110,135,
+125,118,26,93,169,108,213,105,30,214,173,168,170,187,26,160,136,150,126,169,
+30,74,247,35,238,251,17,5,111,162,185,116,174,27,155,169,150,161,181,31,140,
+159,140,155,154,26,208,103,177,66,148,30,251,54,157,247,54,158,5,212,147,
+175,177,208,26,154,138,156,138,159,30,162,95,112,149,116,27,105,100,119,108,
+114,31,40,251,17,204,247,35,5,149,162,145,163,159,26,182,109,170,65,173,30,
+66,105,108,108,96,26,120,146,115,149,115,30,227,251,55,21,151,149,129,126,
+127,129,129,126,127,129,149,152,151,149,149,152,31,147,159,21,122,6,85,247,
+45,5,133,155,137,155,155,26,187,160,167,188,157,30,189,121,160,111,91,26,
+123,136,123,134,123,30,41,251,118,21,33,251,15,5,111,115,111,123,113,27,113,
+121,146,160,111,31,138,150,138,150,146,26,189,174,178,192,147,30,247,53,166,
+5,219,125,21,148,153,247,53,112,5,192,131,174,100,88,26,132,138,128,138,129,
+30,118,111,121,132,113,27,114,109,156,166,116,31,14,126,248,38,247,47,21,
+144,144,144,145,145,144,134,134,138,139,136,138,137,30,137,133,138,133,133,
+26,119,148,105,150,118,30,92,162,181,112,187,27,216,213,208,212,193,104,187,
+79,168,31,127,144,132,141,129,140,8,131,134,142,146,145,144,145,145,141,141,
+138,136,143,31,130,154,161,134,171,27,219,195,192,215,223,79,206,66,98,100,
+120,102,103,31,130,130,135,132,136,130,8,132,136,137,137,133,27,133,134,144,
+145,143,140,141,144,143,31,162,156,159,190,180,26,214,81,193,57,57,81,85,
+64,99,159,87,162,122,30,144,135,140,137,135,26,133,134,134,133,133,137,141,
+146,136,30,136,148,134,146,131,148,8,176,103,100,158,98,27,66,79,72,55,63,
+195,86,219,171,161,144,148,154,31,142,143,141,140,141,27,145,144,133,133,
+132,134,136,131,31,129,138,131,137,128,134,8,79,110,104,91,85,26,66,213,70,
+216,184,180,164,180,162,30,152,161,150,178,161,26,145,138,145,137,145,30,
+151,247,187,21,201,192,86,75,75,86,86,75,74,87,192,204,204,192,190,205,31,
+14,115,247,207,248,83,21,201,72,103,158,91,27,68,81,81,69,58,200,86,233,157,
+155,140,144,173,31,91,112,117,123,119,119,8,113,111,125,106,105,26,67,197,
+81,211,184,179,162,178,165,30,156,167,148,165,151,202,152,79,147,113,155,
+112,8,97,164,181,115,185,27,211,197,197,211,173,125,172,113,167,31,119,159,
+117,154,91,167,8,134,173,155,138,157,27,233,200,192,220,209,81,197,68,91,
+103,120,77,72,31,167,201,148,169,173,26,213,82,197,66,67,82,81,65,105,148,
+109,167,77,30,208,144,21,106,126,5,108,184,131,163,179,26,203,179,185,194,
+195,179,93,75,99,130,115,109,94,30,106,152,125,234,5,147,138,135,144,134,
+27,134,136,134,131,138,31,244,251,28,21,156,160,147,148,150,148,8,163,168,
+176,153,173,27,191,182,98,89,79,82,94,63,121,126,141,148,107,31,141,174,225,
+182,5,146,142,142,143,142,26,145,135,141,133,30,133,6,45,123,5,136,251,18,
+21,174,127,150,133,156,125,8,175,111,161,99,103,26,88,99,98,87,101,104,163,
+181,115,30,122,168,134,159,138,186,173,147,24,206,71,5,135,143,143,137,142,
+27,143,143,142,143,142,137,142,137,143,31,95,224,5,251,107,247,48,21,45,155,
+5,133,6,133,136,137,133,136,142,135,145,136,31,225,96,141,104,5,130,107,126,
+137,121,27,63,82,184,199,189,182,180,191,171,174,127,117,168,31,152,129,147,
+130,158,115,8,140,251,69,21,93,47,5,137,135,138,136,136,26,135,142,136,143,
+142,143,141,143,143,30,206,207,173,131,138,96,135,121,126,112,25,93,116,101,
+111,98,27,88,98,180,190,175,161,179,175,167,31,156,153,150,144,174,152,8,
+14,89,249,34,247,125,21,172,147,158,148,152,151,8,161,158,152,170,172,26,
+168,130,166,121,158,30,124,157,120,148,100,149,8,155,167,149,165,157,26,159,
+121,172,119,158,30,159,119,114,150,116,27,122,120,132,121,106,31,129,171,
+131,157,126,152,8,160,118,109,152,110,27,114,115,130,122,118,31,120,123,130,
+122,127,101,8,157,106,120,146,122,27,116,114,127,120,119,31,119,120,121,106,
+119,26,121,148,113,156,111,30,106,131,120,130,126,127,8,117,120,126,108,106,
+26,110,149,112,156,120,30,154,121,158,130,178,129,8,123,111,130,113,122,26,
+119,156,105,159,120,30,120,159,164,128,162,27,156,158,146,156,172,31,149,
+107,147,121,152,126,8,118,160,169,126,167,27,165,163,148,156,160,31,158,155,
+149,156,150,177,8,122,172,158,132,156,27,162,165,150,158,158,31,159,158,157,
+173,159,26,156,129,165,123,167,30,251,150,247,94,21,188,179,98,90,89,99,99,
+89,89,98,179,189,189,179,179,191,31,164,251,99,21,150,141,180,33,5,142,130,
+141,130,129,26,94,101,102,94,93,101,176,184,150,141,148,142,147,30,180,245,
+150,137,114,251,1,5,138,134,139,134,135,26,107,162,114,168,169,162,164,171,
+144,139,143,138,144,30,251,8,247,17,21,149,132,93,36,5,110,126,110,121,107,
+27,93,101,177,185,171,157,167,168,152,31,243,185,145,130,44,79,5,122,128,
+128,120,119,26,111,161,117,167,159,159,150,156,149,30,147,247,62,21,141,127,
+33,99,5,135,130,129,138,130,27,94,102,176,185,185,176,176,184,148,149,138,
+135,148,31,245,99,137,127,251,2,164,5,140,135,135,139,133,27,108,113,116,
+110,110,165,115,171,144,143,140,140,143,31,247,17,247,7,21,133,130,35,185,
+5,110,152,121,167,172,26,185,177,177,185,171,167,121,109,153,30,185,36,129,
+132,80,234,5,157,127,120,150,119,27,111,117,117,110,120,150,119,156,128,31,
+247,62,132,21,128,137,98,245,5,136,147,137,149,149,26,184,177,176,185,185,
+176,102,94,129,137,130,136,130,30,98,33,128,141,164,247,1,5,140,144,139,143,
+144,26,171,116,164,109,110,116,114,107,135,139,134,140,134,30,247,8,251,17,
+21,129,146,185,242,5,169,153,167,157,171,27,185,177,101,93,106,121,111,110,
+126,31,35,93,133,148,234,199,5,156,150,150,159,159,26,167,117,161,111,119,
+120,128,121,128,30,131,251,62,21,137,151,245,179,5,143,148,149,140,149,27,
+184,175,102,93,93,103,102,93,130,129,140,143,130,31,33,179,141,151,247,2,
+114,5,138,143,143,138,145,27,171,164,163,168,168,113,162,108,133,135,139,
+138,135,31,251,17,251,7,21,145,148,243,93,5,168,126,157,111,106,26,93,101,
+102,93,107,110,157,168,126,30,93,242,149,146,199,44,5,122,149,159,128,159,
+27,167,161,161,167,159,129,158,121,150,31,14,89,248,35,249,84,21,251,95,251,
+53,251,51,251,93,251,89,247,54,251,53,247,90,247,90,247,53,247,53,247,90,
+57,10,251,86,31,134,130,21,208,251,56,5,148,115,120,142,113,27,114,120,136,
+130,115,31,207,252,171,21,71,247,56,5,129,163,158,136,165,27,164,158,142,
+149,163,31,247,71,248,68,21,71,251,56,122,179,99,179,99,156,25,251,222,252,
+63,21,207,247,57,156,98,179,99,179,122,25,248,68,247,72,21,251,56,70,5,148,
+163,142,157,166,26,166,136,157,130,163,30,252,171,70,21,247,56,208,5,130,
+116,136,121,111,26,112,142,121,148,115,30,77,247,208,21,247,57,72,99,122,
+99,99,122,99,25,248,63,251,222,21,251,57,206,179,156,179,179,156,180,25,251,
+70,247,146,21,232,216,60,45,45,63,62,45,44,61,216,234,236,215,214,236,31,
+14,251,24,247,230,248,21,21,247,32,33,77,195,88,27,121,114,125,110,106,31,
+133,116,136,116,122,26,71,196,116,247,123,113,30,251,104,113,65,107,74,26,
+125,141,118,144,118,30,105,176,163,124,162,27,187,190,188,247,45,247,4,31,
+86,251,16,119,73,83,26,97,163,116,203,118,30,206,157,169,165,179,26,187,117,
+207,81,247,24,30,251,31,243,203,82,189,27,157,164,153,168,173,31,144,162,
+142,162,156,26,206,80,163,251,121,164,30,247,104,166,213,171,204,26,153,137,
+160,135,160,30,173,102,114,154,117,27,91,87,89,251,44,251,3,31,190,247,12,
+160,209,194,26,182,115,162,75,160,30,72,120,109,113,100,26,91,162,68,197,
+251,21,30,155,144,21,83,247,16,122,194,193,26,186,157,156,194,146,30,167,
+251,212,21,192,211,163,168,167,168,8,178,177,176,161,167,27,157,154,128,111,
+161,31,251,155,251,75,21,247,0,126,182,131,178,126,8,194,120,169,114,112,
+26,126,135,123,131,120,30,251,184,247,29,21,195,251,16,156,84,85,26,92,121,
+121,84,132,30,112,247,213,21,84,65,116,111,112,111,8,100,100,102,117,111,
+27,121,124,150,166,117,31,247,156,247,76,21,251,3,152,97,147,101,152,8,84,
+157,109,165,166,26,152,143,155,147,157,30,14,251,44,248,14,247,236,21,247,
+31,220,247,3,84,158,165,43,187,239,195,120,171,41,80,146,247,0,106,135,131,
+251,15,251,31,58,5,247,54,7,241,207,126,169,50,80,141,247,6,5,101,6,141,251,
+6,49,198,126,109,242,71,5,251,54,7,251,32,220,131,247,15,107,143,145,251,
+0,41,198,120,107,239,83,43,91,158,113,247,3,194,247,31,58,251,31,58,251,3,
+194,120,113,235,91,39,83,158,107,237,197,133,32,171,143,147,247,15,247,32,
+220,5,251,54,7,36,71,152,109,229,198,137,251,6,5,177,6,137,247,6,228,80,152,
+169,37,207,5,247,54,7,247,31,58,147,251,15,172,135,132,246,237,81,158,171,
+39,195,235,187,120,165,251,3,84,5,14,251,35,247,87,248,247,21,251,44,7,251,
+18,223,5,140,137,138,139,138,27,137,136,136,136,138,31,132,119,125,122,5,
+137,137,138,137,137,26,137,140,138,142,138,30,247,27,71,251,24,62,247,24,
+63,251,27,71,5,136,138,138,138,138,26,137,140,135,141,138,30,153,122,146,
+119,5,136,140,142,136,141,27,140,140,139,140,141,31,247,18,223,5,251,44,7,
+247,24,214,130,251,43,5,135,141,137,146,30,160,143,160,135,5,146,141,141,
+143,31,129,247,43,247,25,64,5,247,44,7,247,18,55,5,138,141,140,139,140,27,
+141,142,142,142,140,31,146,159,153,156,5,140,140,140,142,141,26,141,138,141,
+137,30,251,27,207,247,23,215,251,23,216,247,27,207,5,142,140,140,140,140,
+26,141,138,143,137,140,30,125,156,132,159,5,142,138,136,142,137,27,138,138,
+139,138,137,31,251,18,55,5,247,44,7,251,25,64,149,247,43,5,143,137,141,132,
+30,118,135,118,143,5,132,137,137,135,31,148,251,43,5,251,4,180,21,247,6,74,
+5,251,25,7,251,6,206,5,247,158,247,23,21,251,23,7,251,6,72,5,247,25,7,247,
+139,251,58,21,251,5,74,251,7,204,247,7,205,5,119,251,188,21,251,6,204,5,247,
+24,7,247,6,73,5,251,158,251,23,21,247,23,7,247,6,205,5,251,24,7,251,139,247,
+57,21,247,5,205,247,7,73,251,7,74,5,14,251,42,248,6,247,233,21,244,200,247,
+50,105,161,187,40,170,231,188,122,169,51,83,161,241,87,143,89,251,46,34,80,
+137,247,13,247,1,247,12,109,182,62,69,143,243,5,105,6,143,35,62,209,109,96,
+247,1,251,12,137,251,13,34,198,89,247,46,87,135,161,37,51,195,122,109,231,
+90,40,108,161,91,247,50,173,244,78,34,77,251,50,173,117,91,238,108,47,90,
+156,110,227,194,5,117,37,191,135,189,247,46,244,198,141,251,13,251,1,251,
+12,169,96,216,209,135,35,5,173,6,135,243,216,69,169,182,251,1,247,12,141,
+247,13,244,80,189,251,46,191,143,117,241,227,84,156,168,47,188,238,170,117,
+187,251,50,105,5,14,86,247,197,248,50,21,146,6,148,142,141,147,140,139,143,
+138,142,31,251,97,247,110,127,118,136,137,119,128,25,248,33,251,233,21,132,
+6,130,136,137,131,138,139,135,140,136,31,247,97,251,110,151,160,142,141,159,
+150,25,252,15,247,76,21,146,7,147,136,143,133,30,137,6,132,6,251,110,251,
+98,160,127,141,136,150,119,25,247,233,248,33,21,132,7,130,141,136,147,140,
+143,139,140,142,30,247,110,247,97,118,151,137,142,128,159,25,251,165,251,
+142,21,107,112,113,106,106,165,112,173,171,166,166,172,172,113,165,105,31,
+247,191,4,130,140,134,136,122,129,8,121,128,139,139,127,26,44,143,97,150,
+105,30,90,156,152,110,145,27,142,143,146,161,149,31,163,193,148,200,241,26,
+161,129,147,98,147,30,141,253,97,21,148,145,141,149,155,31,157,150,139,139,
+151,26,233,135,182,128,173,30,188,122,126,168,133,27,136,135,132,117,129,
+31,115,86,130,77,37,26,117,149,131,179,131,30,247,251,247,251,21,138,145,
+138,145,136,146,8,164,130,133,145,124,27,43,98,135,128,105,31,90,122,111,
+126,138,133,8,136,147,135,160,129,30,115,194,199,130,241,27,161,147,149,180,
+147,31,253,97,137,21,131,142,130,148,125,30,121,149,139,139,154,27,231,183,
+143,150,173,31,187,155,168,153,145,26,142,133,143,116,149,30,163,85,79,148,
+37,27,116,131,129,99,131,31,14,87,224,249,13,21,247,91,251,91,159,160,251,
+90,247,91,5,248,232,252,234,21,251,91,247,91,119,118,247,90,251,91,5,248,
+255,4,251,90,251,91,159,118,247,91,247,91,5,252,232,252,234,21,247,90,247,
+91,119,160,251,91,251,91,5,247,201,248,6,21,94,102,102,94,94,176,102,184,
+184,176,176,183,186,103,175,93,31,131,247,170,21,103,98,86,93,111,149,115,
+170,91,31,149,123,149,123,141,135,8,106,156,140,138,143,27,143,141,142,171,
+157,31,142,146,148,154,149,155,8,168,187,148,163,169,26,187,114,166,79,157,
+30,147,253,98,21,174,181,192,185,167,129,163,108,187,31,128,155,129,156,138,
+142,8,173,122,138,139,135,27,135,136,135,108,122,31,136,132,130,125,129,122,
+8,110,91,130,115,109,26,91,164,112,198,121,30,247,250,247,251,21,140,142,
+139,142,140,26,175,85,180,93,112,116,129,108,91,30,123,129,123,129,134,137,
+8,106,122,139,139,134,26,135,143,136,170,122,30,146,135,153,131,155,129,8,
+110,188,162,130,169,27,187,166,163,200,157,31,253,95,22,138,135,139,137,137,
+26,103,192,98,185,167,163,149,170,186,30,155,149,154,149,144,141,8,172,156,
+140,139,144,26,143,136,142,107,156,30,132,142,125,148,122,149,8,168,91,115,
+148,110,27,91,112,115,79,121,31,14,251,18,248,9,248,12,21,247,49,7,185,157,
+163,169,180,26,186,99,178,91,93,100,99,91,99,162,110,186,121,30,251,49,7,
+251,25,216,5,142,151,140,151,145,26,185,99,177,92,90,100,103,92,89,179,98,
+187,165,158,148,163,161,30,247,24,61,251,24,61,5,162,117,119,148,114,27,91,
+98,98,90,93,179,101,188,186,180,178,185,148,138,145,135,154,31,247,25,215,
+5,251,49,7,93,122,115,109,97,26,93,179,99,187,185,178,179,187,179,116,168,
+92,157,30,247,49,7,247,25,63,5,136,126,138,128,132,26,94,179,100,186,188,
+178,176,186,188,100,180,90,114,119,130,116,117,30,251,23,217,247,23,217,5,
+116,161,158,130,166,27,187,179,179,188,186,100,176,90,91,98,100,95,130,140,
+133,143,123,31,14,91,248,40,248,114,21,171,247,48,5,142,150,140,149,145,26,
+163,118,161,115,116,118,118,114,134,140,128,142,128,30,171,251,48,5,251,155,
+4,107,251,48,5,136,128,138,128,134,26,114,160,118,162,163,160,160,164,145,
+138,149,136,150,30,107,247,48,5,229,247,110,21,247,26,227,5,165,156,147,152,
+159,26,163,121,157,115,119,126,130,114,122,30,51,251,26,5,251,77,251,77,21,
+251,26,51,5,114,122,130,126,119,26,115,157,121,163,160,151,147,165,156,30,
+227,247,26,5,247,110,229,21,247,48,107,5,137,150,148,137,146,27,164,160,160,
+162,163,118,160,114,132,129,137,137,129,31,251,48,107,5,251,155,22,251,48,
+171,5,141,129,129,141,132,27,114,118,118,115,116,161,118,163,146,148,141,
+141,150,31,247,48,171,5,247,110,49,21,227,251,26,5,113,156,152,131,159,27,
+163,157,157,163,159,131,152,113,156,31,251,26,227,5,251,77,247,77,21,51,247,
+26,5,164,122,126,148,120,27,114,121,121,115,119,148,126,164,122,31,247,26,
+51,5,239,148,21,85,96,97,85,87,182,96,192,191,182,182,191,192,97,182,87,31,
+14,85,248,5,248,60,21,132,137,132,136,134,135,251,1,247,45,24,170,117,123,
+149,114,27,108,115,116,108,114,150,123,170,117,31,247,47,251,2,136,134,136,
+131,138,133,25,251,78,170,5,142,126,127,140,133,27,107,111,112,109,108,167,
+113,171,146,150,140,141,152,31,247,79,171,141,132,142,132,142,134,25,251,
+45,251,1,5,108,117,128,123,114,26,108,163,115,170,164,154,150,170,162,30,
+247,1,247,46,145,136,145,137,147,137,25,108,251,77,5,136,126,138,128,131,
+26,108,166,111,169,169,166,167,171,147,138,149,137,152,30,107,247,78,145,
+141,146,142,145,143,25,247,1,251,45,5,108,161,155,129,165,27,170,162,162,
+170,164,129,154,107,162,31,251,47,247,1,142,145,142,147,140,145,25,247,78,
+107,5,137,152,150,138,146,27,171,167,166,169,170,111,165,107,133,128,138,
+137,125,31,251,79,107,136,147,137,145,136,144,25,247,45,247,1,5,170,161,150,
+155,164,26,170,115,163,108,114,124,128,108,116,30,251,1,251,46,133,142,134,
+141,130,141,25,170,247,77,5,142,153,140,151,144,26,171,112,167,109,109,112,
+111,107,132,140,128,141,126,30,14,91,248,38,249,88,21,251,96,251,55,251,51,
+251,91,251,94,247,53,251,54,247,92,247,91,247,54,247,54,247,91,247,89,251,
+54,66,10,14,173,248,75,63,10,251,128,251,60,251,41,251,102,251,4,193,251,
+0,229,74,31,91,206,226,113,237,27,247,130,247,61,247,41,247,102,237,97,235,
+68,203,31,201,69,251,1,178,32,27,97,105,21,213,220,107,88,195,31,210,75,176,
+55,46,26,251,71,251,37,251,37,251,71,251,72,251,36,247,37,247,74,217,169,
+216,192,198,30,210,204,221,175,238,27,14,61,249,106,22,249,71,253,71,253,
+71,7,14,62,249,2,53,10,252,223,252,230,246,42,248,221,248,223,34,6,107,210,
+21,252,164,252,158,248,164,7,14,62,249,2,22,243,244,248,223,252,221,37,32,
+252,225,7,248,191,172,21,252,158,248,160,248,158,6,14,59,248,235,53,10,252,
+200,252,212,6,247,11,251,7,5,248,207,248,208,6,251,19,225,21,252,171,252,
+166,248,171,7,14,59,248,235,22,247,18,247,12,5,248,207,252,207,7,251,11,251,
+7,5,252,212,7,248,199,172,21,252,166,248,171,248,166,6,14,192,249,238,22,
+252,47,249,85,252,48,253,85,5,14,192,249,238,53,10,253,203,6,248,48,253,85,
+5,14,248,31,125,21,247,251,247,252,251,251,247,251,251,252,251,251,5,14,84,
+248,28,63,10,251,41,251,53,247,41,251,41,247,39,247,41,5,247,102,251,88,21,
+251,52,247,41,251,41,251,41,247,41,251,45,5,251,89,251,101,21,247,43,247,
+56,251,43,247,42,251,41,251,42,5,251,100,247,90,21,247,51,251,40,247,41,247,
+40,251,41,247,41,5,14,252,37,174,125,21,200,140,184,148,184,158,8,247,20,
+193,228,247,27,247,34,26,247,91,251,57,247,52,251,95,30,14,253,81,243,53,
+10,70,253,71,208,6,14,252,198,247,134,53,10,251,99,253,71,247,99,6,14,252,
+60,248,16,53,10,251,237,253,71,247,237,6,14,252,83,247,238,249,84,21,140,
+127,127,139,134,27,46,68,114,87,91,31,95,93,113,69,68,26,32,203,68,237,230,
+208,202,221,220,75,203,58,122,124,136,135,128,30,134,126,139,139,133,27,123,
+129,150,155,159,154,166,160,159,31,165,168,205,162,188,27,170,138,5,150,6,
+14,252,83,184,247,156,21,138,155,150,139,147,27,225,214,167,188,185,31,182,
+185,166,211,207,26,247,0,74,210,41,48,70,76,57,59,203,75,220,155,155,141,
+143,150,30,145,153,139,139,145,27,154,149,127,123,109,109,100,102,121,31,
+121,104,91,129,95,27,111,6,14,251,63,247,210,63,10,109,127,138,134,117,31,
+251,18,114,46,251,2,251,16,26,38,207,63,230,204,197,180,200,159,30,70,170,
+186,106,205,27,224,206,206,223,223,71,207,55,114,120,135,125,109,31,158,210,
+238,199,240,140,119,164,24,251,30,141,33,56,103,251,29,8,192,106,94,165,83,
+27,113,120,135,125,111,31,162,215,233,196,240,138,8,14,251,63,247,243,247,
+155,21,192,181,149,160,180,31,228,184,197,232,235,26,241,71,214,48,74,81,
+98,78,118,30,208,109,92,172,73,27,54,72,73,54,55,207,70,222,164,156,144,153,
+171,31,121,68,37,77,41,140,159,114,24,247,29,137,246,223,174,247,28,8,86,
+173,184,112,194,27,165,159,145,152,167,31,116,63,44,82,38,140,8,14,252,85,
+247,240,63,10,73,121,109,128,103,121,8,251,1,83,67,251,16,251,24,26,251,25,
+211,251,17,247,1,84,30,172,123,170,128,207,119,147,150,24,251,20,184,58,247,
+26,247,61,26,247,5,176,238,206,210,30,168,170,169,158,185,155,8,14,252,85,
+174,249,74,21,247,19,95,220,251,27,251,62,26,251,61,58,251,28,251,19,96,30,
+147,128,206,158,170,150,173,156,25,247,0,194,211,247,17,247,25,26,247,24,
+67,247,16,251,0,195,30,104,156,108,150,73,158,8,14,252,158,247,66,53,10,46,
+251,4,93,251,6,251,12,26,251,12,187,251,11,230,33,30,247,1,6,79,247,18,115,
+241,247,13,26,247,15,178,247,49,184,201,30,14,252,158,174,53,10,201,251,20,
+161,47,251,17,26,251,10,113,251,0,81,251,12,30,247,1,6,229,242,188,247,14,
+247,12,26,247,12,93,247,7,46,247,3,30,14,252,199,247,29,53,10,37,251,238,
+241,251,237,5,244,6,35,247,237,243,247,238,5,14,252,199,247,30,53,10,36,6,
+242,251,238,36,251,237,5,242,6,243,247,237,5,14,251,222,247,170,22,247,89,
+6,251,135,247,238,247,135,247,237,5,251,89,6,251,135,251,237,5,14,251,222,
+247,124,22,247,135,247,238,251,135,247,237,5,251,89,6,247,135,251,237,251,
+135,251,238,5,14,252,65,247,27,53,10,39,251,237,239,251,238,5,247,132,6,39,
+247,238,239,247,237,5,14,252,65,247,167,53,10,251,132,6,239,251,237,39,251,
+238,5,247,132,6,239,247,238,5,14,252,241,247,91,249,74,21,117,150,251,34,
+50,5,252,177,7,247,34,50,161,150,251,6,217,5,248,177,7,14,252,241,174,249,
+74,21,247,6,61,5,252,177,7,251,6,61,161,128,247,34,228,5,248,177,7,251,34,
+228,5,14,252,141,247,191,53,10,96,6,59,113,137,131,118,31,108,126,126,116,
+96,26,127,7,140,120,5,251,24,7,141,76,127,118,98,135,8,127,7,181,136,150,
+122,137,72,8,251,24,7,138,107,5,101,150,116,164,126,30,128,160,165,136,216,
+27,193,151,134,6,118,119,146,149,130,31,128,152,138,148,196,26,247,1,7,141,
+224,121,168,75,153,203,154,157,167,137,225,8,247,1,7,137,218,149,154,198,
+141,8,14,252,141,174,53,10,127,7,198,137,150,124,136,60,8,251,1,7,138,53,
+156,111,203,124,75,125,122,110,140,54,8,251,1,7,81,138,131,128,126,30,129,
+131,118,132,118,27,134,127,182,6,221,163,141,147,160,31,170,151,152,163,181,
+26,138,171,5,247,24,7,138,206,149,156,181,142,8,151,7,98,143,127,160,141,
+202,8,247,24,7,140,170,5,179,128,161,115,152,30,150,117,112,142,61,27,14,
+32,249,77,53,10,251,70,247,6,6,100,129,5,35,42,7,49,96,136,129,93,31,39,118,
+70,51,33,26,46,192,61,227,103,30,123,180,186,131,200,27,187,191,143,148,194,
+31,137,251,5,132,81,124,92,8,53,111,80,87,69,27,91,99,168,173,148,143,147,
+145,144,31,144,144,140,140,164,140,8,170,142,162,165,173,26,182,101,174,92,
+80,91,86,74,56,212,74,233,184,181,154,168,177,30,184,172,166,181,157,204,
+8,158,203,143,201,247,59,26,247,211,7,138,158,153,139,149,27,183,166,143,
+152,186,31,251,92,123,21,252,25,7,110,142,107,149,103,156,8,130,178,134,197,
+204,26,203,145,226,147,185,30,14,251,187,247,164,247,189,21,162,205,150,153,
+196,169,182,162,155,148,153,151,8,174,167,156,173,183,26,174,126,174,115,
+165,30,180,102,100,150,36,27,36,100,128,98,102,31,115,113,126,104,104,26,
+100,152,107,166,114,30,156,122,155,130,191,111,196,109,150,126,162,72,8,141,
+112,21,59,75,77,60,59,202,76,218,218,202,202,218,217,76,203,62,31,14,251,
+187,247,163,249,6,21,127,159,135,146,133,146,8,167,117,104,155,102,27,66,
+91,84,55,78,169,86,185,118,31,246,91,165,117,167,75,162,193,165,164,203,171,
+201,168,139,139,151,150,8,171,166,157,182,187,26,223,92,194,66,101,103,123,
+111,118,30,133,132,135,133,127,118,8,141,251,248,21,59,75,76,61,59,202,76,
+218,217,203,202,218,216,75,204,63,31,14,210,248,91,248,110,21,123,180,132,
+154,127,160,8,200,101,69,178,65,27,251,9,53,53,251,11,68,162,87,188,101,31,
+170,114,172,122,224,102,247,12,86,177,108,180,57,181,221,176,170,247,12,192,
+209,169,173,156,164,156,8,203,183,167,191,217,26,247,12,54,226,251,10,65,
+68,100,78,102,30,127,119,132,123,123,98,8,14,251,64,249,13,248,17,21,137,
+123,125,138,129,27,106,103,151,160,107,31,98,165,108,182,112,207,118,193,
+131,156,125,157,8,183,106,90,164,84,27,41,59,60,43,86,164,87,182,106,31,162,
+120,158,131,181,129,8,121,7,103,130,121,131,119,126,8,91,105,109,84,82,26,
+42,218,61,237,213,205,184,209,164,30,175,237,144,148,171,177,8,184,178,196,
+166,195,27,148,146,138,137,154,31,14,60,247,217,249,14,21,178,91,106,154,
+101,27,61,46,44,58,116,154,122,159,158,160,157,156,143,139,140,128,152,31,
+130,149,134,153,153,26,188,182,182,189,175,185,118,78,234,30,194,104,145,
+135,164,126,122,94,136,132,131,123,8,123,108,137,133,125,26,133,140,135,141,
+130,30,141,143,141,144,142,144,146,152,146,153,147,153,147,154,151,166,151,
+172,8,124,175,161,132,155,27,152,163,143,143,154,31,223,162,196,197,199,26,
+176,113,167,105,106,115,111,100,130,141,134,144,136,30,162,124,144,131,118,
+26,103,105,108,101,106,100,152,161,108,30,145,165,141,154,155,26,196,102,
+183,92,113,122,129,111,114,30,247,17,251,3,21,126,144,119,151,119,155,8,117,
+156,130,153,158,26,158,154,154,157,170,167,103,97,128,137,128,135,128,30,
+66,251,91,21,150,7,202,102,178,78,60,82,63,33,251,56,247,33,251,33,247,57,
+224,214,181,188,161,121,155,114,126,133,136,129,131,30,77,130,113,109,94,
+27,105,113,163,169,170,160,158,215,176,31,190,164,171,159,156,158,8,167,168,
+154,177,177,26,209,88,195,78,109,106,128,121,119,30,122,125,127,124,119,104,
+8,14,60,152,247,108,21,148,6,84,145,173,103,187,27,178,161,161,177,148,138,
+145,138,155,31,125,123,128,134,122,27,112,123,153,168,132,31,223,172,194,
+201,138,198,183,137,179,117,154,108,8,91,113,123,118,100,26,65,221,81,242,
+213,226,171,201,225,30,195,178,161,164,163,26,159,126,151,119,125,131,134,
+125,130,30,144,124,140,132,129,26,107,115,116,107,117,119,150,160,126,30,
+130,154,136,154,134,185,132,215,137,149,118,170,8,181,112,88,166,89,27,84,
+93,99,90,119,143,124,152,109,31,103,170,98,155,99,138,128,165,126,154,109,
+158,8,93,167,128,151,163,26,151,145,148,152,149,30,129,6,98,111,114,103,106,
+157,122,185,129,31,199,127,142,137,149,119,58,126,66,69,136,70,124,124,135,
+129,136,117,8,210,201,21,136,196,197,197,200,140,8,140,133,139,134,136,26,
+118,121,111,113,121,30,118,124,123,131,103,127,8,14,76,249,10,22,159,7,47,
+156,108,154,95,186,94,191,128,174,134,246,156,107,147,125,153,123,8,95,175,
+197,109,189,27,225,209,212,228,226,76,209,60,115,124,134,123,106,31,133,136,
+132,136,132,135,8,167,180,150,168,176,26,224,68,207,52,52,68,71,54,102,150,
+110,167,98,30,169,78,137,140,110,27,60,76,69,52,50,209,66,225,189,197,168,
+184,176,31,152,155,147,153,156,171,134,33,128,103,94,87,95,92,108,124,47,
+122,8,119,7,14,251,136,185,247,223,21,236,251,6,247,4,251,48,180,64,182,218,
+247,19,247,65,233,247,0,63,222,251,48,247,105,107,202,88,46,67,41,251,31,
+251,60,8,14,251,37,247,240,125,21,160,226,195,235,247,4,247,29,8,230,247,
+7,170,204,214,26,217,72,204,59,93,96,119,103,107,30,119,115,128,119,127,95,
+128,173,131,156,127,157,8,187,107,90,166,85,27,56,75,74,55,77,161,93,219,
+32,31,247,39,251,83,177,75,165,40,8,14,251,105,211,22,248,117,159,6,47,156,
+108,153,95,187,102,182,125,173,133,201,8,88,172,187,110,192,27,211,195,195,
+210,202,115,177,39,230,31,41,227,109,183,113,235,112,43,109,95,42,51,8,39,
+48,114,101,76,26,68,196,83,210,192,187,168,190,172,30,133,77,125,105,102,
+96,95,91,108,125,47,122,8,14,248,82,248,224,21,107,6,108,96,90,115,66,131,
+8,112,209,7,164,138,142,135,112,26,251,131,7,141,89,127,126,92,138,8,112,
+106,247,151,172,103,6,99,140,127,154,187,26,93,248,127,51,10,251,50,251,91,
+36,10,248,168,247,189,21,96,7,138,95,132,132,98,141,8,251,89,6,153,176,191,
+182,210,171,8,235,184,174,179,203,26,218,75,189,37,57,81,97,81,107,159,116,
+168,165,161,161,165,145,138,144,137,143,30,131,158,139,139,142,26,156,168,
+159,163,176,164,105,88,79,110,98,50,72,30,70,86,103,84,82,26,133,140,130,
+140,128,30,247,228,247,71,6,251,56,248,45,51,10,61,10,36,10,247,213,247,247,
+21,144,164,150,141,154,27,200,176,103,81,75,95,86,84,108,117,153,158,142,
+140,143,140,141,31,145,155,139,139,148,26,168,118,159,108,107,118,118,108,
+78,204,96,230,247,5,221,201,226,178,122,172,109,160,30,123,150,100,153,116,
+141,8,131,136,141,142,142,143,141,154,143,31,193,154,168,174,187,26,206,87,
+176,46,50,78,103,87,113,158,119,164,165,161,161,164,144,137,148,138,142,30,
+135,146,139,139,141,26,153,164,153,164,180,167,109,94,80,98,100,78,133,131,
+139,140,129,30,218,247,207,33,10,106,4,213,221,107,87,196,42,10,248,96,248,
+224,21,72,6,251,105,251,213,5,111,247,85,101,7,140,100,132,130,107,137,8,
+91,106,247,133,172,107,6,108,142,133,145,140,173,8,184,247,2,184,251,2,7,
+52,247,103,21,251,103,251,27,7,247,55,248,57,21,251,96,251,54,46,10,247,92,
+247,91,247,52,247,53,247,90,68,10,247,56,251,84,31,138,106,21,213,222,106,
+88,195,67,10,55,45,26,251,72,48,10,247,178,247,207,21,173,166,164,155,168,
+27,185,173,95,78,75,96,87,86,111,116,153,156,145,139,139,146,154,31,142,146,
+141,147,147,26,163,116,159,110,109,118,117,107,83,204,97,225,247,5,225,206,
+227,220,73,198,46,92,102,127,115,109,30,150,247,13,5,136,172,156,138,172,
+27,224,162,143,154,160,31,158,152,154,168,149,183,8,125,100,106,134,85,27,
+103,107,143,154,50,31,136,87,128,251,11,128,50,8,247,47,248,10,32,10,247,
+195,247,226,21,138,161,139,153,144,26,209,161,208,172,170,30,150,151,159,
+146,158,27,168,162,124,120,136,138,135,138,135,31,135,128,137,128,134,26,
+117,161,119,163,167,159,162,170,192,77,178,54,82,94,121,103,107,30,97,91,
+114,65,64,26,75,156,81,172,96,30,94,173,188,116,202,27,243,215,209,234,216,
+81,195,60,84,94,114,89,105,31,237,169,21,189,172,94,72,75,102,95,88,86,102,
+184,204,202,180,186,193,31,138,247,234,51,10,35,10,247,111,248,221,21,251,
+59,169,7,147,174,151,183,140,140,172,140,25,247,74,6,67,39,71,51,139,139,
+124,114,25,115,98,125,99,109,26,102,165,112,174,174,164,162,172,145,138,145,
+138,144,30,128,182,139,139,152,26,167,151,179,157,172,30,145,151,142,143,
+227,247,41,181,206,24,140,142,143,142,146,30,251,67,247,13,33,10,106,4,213,
+222,107,87,195,42,10,248,94,248,36,21,193,175,157,163,177,26,195,85,180,65,
+54,78,88,67,94,155,114,191,106,30,64,96,114,106,83,26,63,204,89,237,244,213,
+202,227,199,109,179,61,177,30,63,178,21,104,158,124,157,165,26,173,169,165,
+179,181,169,111,99,107,123,113,105,119,30,130,40,21,185,113,158,114,103,26,
+90,98,102,86,83,98,180,195,183,163,178,183,165,30,182,247,248,32,10,248,122,
+247,252,21,140,124,139,134,130,26,69,117,70,105,108,30,128,128,118,132,120,
+27,110,116,154,158,142,140,143,141,144,31,142,150,141,149,144,26,161,117,
+159,115,111,119,116,108,86,201,100,225,195,185,157,175,170,30,182,187,164,
+213,214,26,203,122,197,105,183,30,183,105,91,162,76,27,34,63,69,44,62,197,
+83,218,195,183,164,189,173,31,47,247,82,21,192,177,94,74,76,98,92,84,89,106,
+183,207,203,175,183,191,31,146,247,36,32,10,247,210,248,225,21,105,6,115,
+99,100,120,70,135,8,113,190,7,171,136,140,139,100,26,251,157,7,106,140,134,
+132,110,27,114,104,247,90,174,120,6,105,142,133,145,140,177,8,247,79,248,
+31,21,46,89,53,251,48,251,54,186,59,235,194,176,157,176,161,31,163,179,152,
+201,215,26,247,61,90,221,37,30,143,106,21,173,156,70,251,32,251,31,122,71,
+104,106,121,211,247,28,247,29,157,210,173,31,251,1,247,36,32,10,248,36,249,
+86,49,10,57,10,251,85,31,193,46,21,252,50,7,138,87,154,120,183,138,8,179,
+105,251,184,173,169,6,184,158,156,178,31,145,7,138,149,5,247,157,7,140,169,
+134,143,112,140,8,62,169,6,217,147,198,168,175,186,8,14,55,10,38,10,247,38,
+252,49,21,176,251,92,252,9,6,138,151,138,149,144,26,206,176,198,218,198,30,
+197,182,153,152,162,169,8,161,168,151,173,172,26,195,112,176,99,112,108,117,
+122,136,140,137,140,137,30,148,116,139,139,130,26,111,116,117,109,107,116,
+164,173,202,204,185,230,247,4,212,84,54,102,126,107,112,110,30,117,115,114,
+124,81,111,57,102,85,96,123,96,8,247,109,6,160,138,5,163,148,154,180,31,14,
+40,10,52,251,207,21,138,150,148,138,146,27,160,162,145,150,158,31,172,158,
+155,167,181,26,189,108,172,94,112,113,124,123,138,30,138,139,138,140,138,
+30,143,130,140,133,130,26,111,115,116,110,111,118,160,168,192,207,178,234,
+242,196,98,65,86,106,100,83,123,30,122,134,136,137,136,26,135,142,138,148,
+138,30,156,138,183,125,155,130,8,178,117,161,100,92,26,44,49,70,251,16,38,
+67,188,208,175,162,163,174,173,162,117,107,133,138,133,138,134,30,133,124,
+139,139,133,26,118,163,124,172,197,187,197,209,203,99,178,73,123,127,138,
+134,113,30,14,248,6,248,146,21,251,42,251,122,5,247,42,6,169,248,62,44,10,
+207,46,21,251,225,247,12,85,251,12,89,7,101,144,133,174,135,30,174,104,251,
+160,174,191,6,175,142,146,148,182,26,182,251,106,172,7,247,129,247,246,5,
+14,34,10,251,18,251,227,21,166,173,180,152,191,27,241,213,74,49,42,43,65,
+251,19,46,67,186,200,174,162,164,173,171,165,116,111,131,137,130,135,131,
+31,131,123,139,139,132,26,119,164,123,169,198,186,197,212,206,101,188,88,
+108,112,123,101,109,30,95,158,151,240,148,233,144,232,25,121,247,6,159,137,
+183,27,197,171,144,154,185,31,130,96,122,104,123,125,8,119,114,114,134,39,
+27,103,121,140,142,102,31,14,248,38,248,3,21,80,95,88,70,69,179,90,196,195,
+179,187,208,213,103,187,85,31,137,247,231,33,10,33,252,5,21,194,177,188,166,
+200,27,227,203,76,52,32,55,62,251,8,69,86,164,189,101,31,102,187,120,202,
+211,26,212,161,213,176,191,30,194,178,191,165,212,27,232,208,96,81,105,117,
+115,108,112,116,161,164,145,141,150,141,151,31,141,144,139,143,142,26,161,
+115,155,107,118,116,131,127,127,30,102,104,115,64,60,26,130,139,139,140,124,
+30,128,139,139,140,130,30,14,47,10,247,87,52,10,251,92,44,21,248,30,6,136,
+132,136,134,138,137,94,64,24,42,251,58,135,132,134,129,8,120,103,126,95,107,
+26,130,140,130,141,129,30,145,98,139,139,131,26,99,114,114,98,99,113,168,
+183,188,168,200,198,215,30,154,159,154,159,154,158,220,247,3,24,251,94,6,
+102,138,138,138,126,90,130,101,24,106,6,14,248,64,248,64,21,174,161,156,167,
+174,26,182,107,171,94,95,107,111,102,110,156,117,176,120,30,111,40,21,93,
+112,114,97,91,26,79,183,94,199,196,184,179,191,178,118,166,90,167,30,121,
+248,24,33,10,204,251,188,21,224,96,174,95,71,26,40,56,68,251,7,251,1,67,195,
+224,203,167,177,221,186,30,82,177,121,166,188,26,219,207,195,233,222,199,
+95,77,96,119,112,78,100,30,14,248,25,248,223,21,83,100,91,69,66,176,93,196,
+196,181,189,208,207,98,189,82,31,150,247,11,44,10,232,251,235,21,93,101,96,
+119,76,27,45,76,198,228,243,223,215,247,6,247,23,225,38,251,47,61,118,64,
+100,84,31,88,103,86,114,64,27,47,71,183,199,175,163,166,169,167,161,116,109,
+134,138,134,138,133,31,136,128,138,131,136,26,117,163,123,170,164,164,149,
+156,153,30,172,177,159,208,215,26,149,7,14,248,160,248,224,21,99,118,59,251,
+47,251,46,160,58,179,180,159,215,247,50,247,50,119,217,98,31,251,19,247,10,
+21,251,93,251,53,251,52,251,92,251,90,247,53,251,53,247,90,247,91,247,53,
+247,52,247,91,247,90,251,53,247,54,251,88,31,51,46,21,252,66,7,97,144,132,
+177,136,30,160,101,251,112,177,167,6,170,140,145,146,138,175,8,247,186,7,
+181,138,140,103,141,30,82,168,6,218,145,179,158,168,184,8,247,141,147,21,
+247,4,194,48,251,79,71,128,72,121,99,31,81,112,98,114,69,27,33,86,228,247,
+70,247,67,194,233,243,31,14,248,29,248,224,21,128,85,106,119,62,140,8,98,
+236,251,248,200,248,106,7,109,247,10,32,10,248,174,247,61,21,251,117,6,153,
+168,148,148,194,176,8,247,13,220,169,179,215,26,225,75,201,50,53,77,78,54,
+30,125,200,7,138,146,139,143,143,26,199,174,179,192,193,177,97,79,78,115,
+108,45,78,30,60,88,102,90,84,26,136,140,133,140,132,30,247,181,6,251,30,248,
+224,32,10,247,202,248,98,21,140,157,140,147,142,151,8,169,148,168,158,176,
+27,190,171,107,89,108,130,118,120,126,31,124,118,116,131,117,27,136,132,140,
+140,129,31,130,96,172,6,208,178,107,81,88,101,102,86,107,112,152,162,123,
+31,128,154,135,157,171,26,85,128,138,119,5,70,199,88,220,227,201,196,221,
+198,113,176,85,157,30,187,161,159,169,188,26,214,79,194,58,88,93,116,102,
+117,30,128,119,134,120,137,106,8,247,36,247,136,32,10,248,174,247,177,21,
+64,247,200,83,6,251,99,251,200,5,89,247,100,251,9,194,247,9,214,7,251,22,
+247,171,21,251,121,251,44,7,247,36,248,57,32,10,247,161,248,221,21,251,158,
+184,7,191,149,172,168,186,27,195,177,98,79,49,105,90,77,87,104,173,188,138,
+31,94,127,5,65,143,189,92,214,27,232,206,213,241,234,78,204,52,92,112,126,
+108,117,31,247,25,247,93,189,7,251,7,247,13,32,10,248,156,248,124,21,209,
+126,97,175,73,27,81,83,103,86,114,31,120,99,131,90,70,26,65,150,84,160,101,
+30,97,164,187,111,189,27,222,201,209,231,226,83,200,60,88,103,116,94,118,
+31,138,150,139,140,150,26,247,0,180,205,205,165,161,127,119,150,30,145,129,
+141,131,145,114,8,60,45,21,192,173,94,68,73,105,96,88,83,98,189,207,200,180,
+185,193,31,149,247,218,32,10,247,130,248,220,21,89,247,146,7,36,251,14,60,
+251,56,121,251,22,8,206,6,164,247,31,194,247,15,247,3,247,55,8,180,7,251,
+42,247,14,32,10,248,94,248,2,21,156,146,148,144,147,144,8,165,157,154,171,
+177,26,212,85,189,61,59,82,88,68,89,161,106,188,116,30,118,132,127,133,129,
+132,8,109,119,122,103,97,26,58,200,82,226,226,202,197,220,199,112,176,81,
+159,30,78,247,81,21,192,172,107,86,89,103,104,89,88,107,172,191,190,172,173,
+189,31,136,251,107,21,198,173,104,80,83,101,99,85,84,100,179,195,196,177,
+176,194,31,145,248,2,32,10,247,156,247,105,21,144,112,143,126,148,124,8,110,
+158,177,120,180,27,175,174,152,162,164,31,186,181,160,203,243,26,207,128,
+198,121,174,30,188,113,95,166,85,27,55,76,72,47,52,193,79,218,193,173,160,
+186,162,31,137,59,133,104,124,110,8,103,120,111,119,106,27,102,115,162,183,
+128,31,212,247,224,21,194,179,89,70,75,101,95,84,83,107,181,213,207,172,182,
+192,31,153,247,43,32,10,248,116,248,230,21,97,102,121,105,114,31,111,101,
+125,80,51,26,46,158,67,172,99,30,113,162,172,123,174,27,179,173,156,173,165,
+31,168,175,155,206,221,26,247,58,92,221,44,30,137,100,21,196,167,70,251,32,
+251,23,112,74,84,83,107,214,247,24,247,23,168,206,195,31,251,117,172,21,134,
+93,100,110,81,138,8,99,222,251,246,199,248,106,7,245,247,10,32,10,34,10,184,
+34,21,252,120,48,247,249,44,193,7,225,138,162,153,151,199,8,14,34,10,247,
+44,252,159,21,73,251,209,7,138,148,139,147,143,26,199,176,188,226,196,30,
+223,193,164,172,196,26,196,108,178,93,92,111,102,78,134,139,133,140,129,30,
+51,147,5,138,148,139,146,144,26,226,208,203,233,237,210,73,49,79,113,93,77,
+92,30,120,124,115,122,108,119,93,107,127,129,130,120,8,14,40,10,251,50,251,
+131,21,141,178,145,160,153,161,8,175,164,188,162,193,27,227,204,81,60,93,
+120,107,100,117,31,156,129,150,131,146,133,8,162,118,152,107,100,26,52,72,
+77,44,49,74,194,216,145,139,148,140,147,30,221,156,5,101,141,126,145,126,
+30,115,151,163,125,168,27,183,170,172,187,192,108,168,85,125,127,138,136,
+114,31,201,7,136,160,149,139,146,27,192,170,167,185,190,115,167,96,115,119,
+130,121,128,31,130,125,137,126,138,104,8,14,248,30,248,121,21,251,15,251,
+76,5,247,15,6,145,248,41,45,10,247,43,252,41,21,73,64,251,10,57,247,10,251,
+100,205,7,247,110,247,197,5,211,251,197,6,14,55,10,46,10,247,92,247,91,247,
+52,58,10,251,37,33,21,247,173,74,251,102,45,6,154,173,156,143,170,27,237,
+205,72,39,32,67,63,36,56,84,190,220,135,31,210,158,5,115,140,132,143,127,
+30,110,150,165,121,170,27,192,169,182,216,177,135,156,128,158,31,160,125,
+114,153,113,27,98,114,112,85,129,31,68,6,14,248,25,248,12,21,93,105,97,83,
+78,174,93,187,182,166,177,199,205,111,180,94,31,150,247,222,33,10,197,251,
+127,21,133,163,134,154,137,145,8,158,130,121,149,114,27,103,113,119,100,127,
+31,130,114,137,122,134,88,8,169,174,162,149,179,27,224,200,73,48,42,71,66,
+48,86,87,167,182,111,31,115,177,127,195,219,26,212,148,185,162,183,30,194,
+167,197,174,201,27,186,180,120,108,162,31,152,122,144,125,145,107,8,14,47,
+10,57,10,251,85,31,251,69,32,21,247,232,89,6,34,251,66,95,251,2,116,251,39,
+8,44,6,158,247,26,210,247,49,238,247,17,8,251,154,6,14,248,34,248,187,21,
+98,114,110,92,91,163,110,180,180,167,171,185,186,113,167,97,31,135,251,103,
+21,91,108,106,89,87,172,103,186,186,171,175,191,192,109,169,89,31,145,248,
+2,33,10,219,251,224,21,196,106,158,109,86,26,52,69,73,46,47,70,203,224,197,
+166,179,194,161,30,98,159,116,177,185,26,213,205,196,223,224,200,83,63,90,
+121,112,91,112,30,14,248,20,248,187,21,96,112,101,79,73,167,98,184,185,173,
+181,195,200,104,185,91,31,155,247,47,33,10,64,252,103,21,88,149,157,118,171,
+27,155,157,146,152,151,31,165,167,149,171,144,213,8,112,112,109,128,97,27,
+56,79,205,231,235,207,210,231,190,180,119,100,169,31,169,101,154,76,53,26,
+67,127,75,119,104,30,85,108,85,107,79,27,94,98,159,170,117,31,127,156,134,
+156,133,174,8,14,248,120,248,185,21,93,115,74,251,15,251,14,166,65,185,184,
+162,203,247,15,247,22,114,206,93,31,55,247,49,33,10,40,34,21,252,119,53,247,
+246,56,193,7,206,138,169,161,145,193,8,247,143,146,21,243,192,54,251,61,251,
+53,83,52,35,37,84,229,247,58,229,154,201,171,180,31,173,166,179,158,185,27,
+14,194,248,34,249,13,21,247,107,251,111,5,252,214,251,24,248,214,6,251,107,
+251,116,5,247,71,6,247,175,247,179,251,175,247,180,5,14,138,174,247,246,21,
+119,248,225,7,83,70,117,86,140,79,198,224,247,4,223,224,161,54,164,38,215,
+69,60,10,247,69,247,105,247,246,21,193,205,164,199,137,197,80,53,251,5,53,
+55,117,222,116,246,59,205,50,141,199,104,222,95,178,8,248,226,6,83,71,116,
+84,141,80,198,224,247,4,224,223,161,55,162,37,216,70,60,10,252,17,247,130,
+249,20,21,205,85,198,114,198,141,54,196,54,247,5,115,225,115,53,63,38,46,
+70,200,137,222,174,179,183,8,252,225,7,70,195,82,162,81,137,225,80,223,251,
+3,162,53,164,225,217,242,230,206,78,141,54,104,101,95,8,14,48,247,15,248,
+233,21,51,251,17,248,4,251,107,56,251,4,248,14,88,251,64,247,235,61,251,9,
+5,14,224,174,248,76,21,251,80,7,248,178,205,59,251,70,248,29,247,98,252,29,
+247,97,219,251,70,5,14,48,247,15,233,21,247,217,247,169,217,251,8,247,64,
+247,234,252,14,89,222,251,5,252,4,251,107,5,14,218,174,248,4,21,94,7,247,
+255,154,102,91,97,71,113,84,25,247,44,204,196,161,213,162,247,10,174,247,
+25,168,196,143,251,127,178,39,170,251,148,247,3,8,135,7,166,84,180,74,176,
+91,8,14,227,248,218,247,152,21,86,86,5,104,104,126,116,111,26,88,181,97,190,
+172,158,151,183,177,30,247,120,247,158,251,120,247,152,5,182,102,121,150,
+107,27,89,97,97,90,113,154,111,171,109,31,189,89,5,252,59,6,93,129,137,130,
+118,31,112,126,119,106,107,26,107,159,106,166,126,30,129,160,150,137,184,
+27,14,228,174,247,254,21,106,249,17,251,92,7,247,111,247,108,251,111,247,
+109,5,251,92,7,14,228,174,248,36,21,251,4,249,19,251,51,7,247,111,247,107,
+251,111,247,109,5,251,53,7,14,134,247,202,248,70,21,251,69,247,153,37,7,247,
+120,247,83,251,120,247,83,5,36,7,251,255,22,251,69,215,247,69,7,251,51,22,
+251,69,184,247,69,7,251,27,22,251,69,163,247,69,7,14,173,248,44,248,124,21,
+251,179,247,67,35,146,7,176,238,242,241,247,0,182,251,7,186,40,241,105,243,
+8,132,33,6,251,166,22,251,179,210,247,179,7,251,52,22,251,179,189,247,179,
+7,251,33,22,251,179,172,247,179,7,251,19,22,251,179,158,247,179,7,14,128,
+174,248,127,21,251,182,248,147,42,7,247,137,247,134,251,137,247,134,5,42,
+7,14,224,174,248,246,21,247,186,251,164,251,186,251,148,249,234,247,140,5,
+253,112,247,99,21,249,18,251,99,252,57,149,5,14,224,174,221,21,249,234,247,
+171,253,234,247,141,247,186,251,149,5,251,64,251,91,21,247,109,247,89,248,
+57,149,5,14,217,174,249,68,21,247,93,251,234,251,93,251,234,249,227,247,234,
+5,14,230,248,182,248,184,21,56,251,183,7,96,138,5,59,106,157,189,124,31,132,
+160,138,149,183,26,99,251,118,6,138,43,148,107,177,97,176,103,174,128,216,
+141,8,247,207,56,6,247,243,247,125,5,14,231,248,181,247,36,21,247,243,247,
+123,251,243,247,125,5,56,251,207,7,62,141,105,128,101,103,8,101,97,131,111,
+40,26,251,120,179,151,7,242,171,169,247,1,30,177,6,247,183,6,14,252,12,248,
+65,247,238,21,251,158,248,80,5,251,36,251,20,252,237,247,20,251,37,7,14,183,
+174,248,164,21,252,1,248,31,46,150,7,239,247,47,247,23,226,247,68,169,8,147,
+7,251,59,161,251,34,233,41,247,47,8,128,46,6,14,136,248,46,249,28,21,251,
+50,252,11,251,183,248,11,251,48,247,20,7,247,156,247,193,251,156,247,196,
+5,34,117,21,247,142,251,174,251,142,251,173,5,247,52,252,10,247,135,248,10,
+7,14,136,248,43,249,28,21,251,50,252,8,251,183,248,8,251,48,247,22,7,247,
+157,247,192,251,157,247,197,5,122,117,21,247,142,251,175,251,142,251,172,
+5,247,52,252,9,247,135,248,9,7,14,167,249,48,248,225,21,71,54,5,252,21,6,
+251,72,251,76,5,251,19,247,240,47,7,248,85,247,81,5,247,9,7,251,55,247,42,
+21,247,33,251,49,252,35,251,59,198,216,5,252,50,6,247,60,247,67,5,248,21,
+6,14,167,249,49,240,21,247,55,247,75,5,247,10,7,252,84,247,81,5,47,251,241,
+251,19,7,247,72,251,78,5,248,22,6,208,86,21,79,211,5,252,22,6,251,60,247,
+69,5,248,51,6,80,215,248,34,251,59,5,14,251,35,247,175,249,31,21,34,251,140,
+251,233,7,221,58,5,247,58,122,6,223,76,247,186,247,171,5,251,246,251,91,21,
+236,251,140,247,186,247,140,217,7,247,151,251,119,5,14,251,35,247,175,183,
+21,248,14,247,217,251,186,247,169,55,76,5,122,251,58,7,57,59,5,251,229,247,
+140,7,163,247,212,21,236,7,247,151,251,131,251,151,251,117,5,219,251,140,
+247,179,7,14,174,248,207,248,250,21,48,252,166,7,201,251,47,71,251,24,207,
+74,5,248,98,43,6,247,167,247,159,5,251,142,247,107,21,247,78,251,81,251,84,
+251,74,5,189,252,157,7,206,247,24,85,247,24,5,248,150,6,14,174,248,207,214,
+21,247,161,247,163,251,167,247,159,5,44,252,98,7,71,73,207,251,23,71,251,
+48,5,248,172,6,158,106,21,196,252,150,7,193,247,24,72,247,23,5,248,157,190,
+6,247,84,251,74,5,14,60,248,25,248,178,21,247,13,7,247,203,251,209,251,203,
+251,209,5,247,12,251,246,7,143,105,150,119,163,117,8,97,186,247,1,109,244,
+27,242,236,170,194,205,31,217,203,185,235,238,26,225,105,222,77,203,30,210,
+70,33,179,251,11,27,42,34,112,102,90,31,108,116,126,116,134,101,8,14,246,
+248,148,247,246,21,251,13,247,70,5,251,248,6,247,22,251,81,251,22,251,76,
+5,247,248,6,247,13,247,63,5,247,111,6,115,115,129,113,104,26,103,150,112,
+162,116,30,191,245,192,193,214,163,70,156,72,210,95,240,8,115,111,129,112,
+103,26,105,149,114,163,111,30,253,28,62,10,91,6,116,247,46,21,189,65,10,89,
+6,118,62,10,89,6,117,247,46,21,188,65,10,90,6,251,137,115,21,188,6,38,251,
+44,5,91,6,247,74,247,44,21,189,6,38,251,44,5,88,6,247,76,247,44,21,188,6,
+37,251,44,5,90,6,247,75,247,44,21,187,6,37,251,44,5,91,6,14,71,248,126,247,
+159,21,115,110,247,17,34,5,103,134,99,94,104,26,148,165,156,142,162,27,188,
+193,130,124,183,31,147,151,5,104,204,122,197,191,26,146,140,150,140,153,30,
+104,131,107,98,135,95,8,251,212,204,21,150,205,182,142,197,27,251,151,247,
+110,60,136,85,135,103,132,25,247,68,247,102,21,109,149,36,146,104,30,247,
+151,251,109,5,129,188,133,203,182,26,150,7,14,165,248,135,247,252,21,105,
+247,53,7,126,120,133,122,116,26,113,144,124,153,122,30,163,184,213,196,211,
+169,8,151,7,53,173,101,168,93,206,8,125,121,135,127,113,26,115,143,122,153,
+113,30,251,177,251,43,21,192,197,163,161,186,177,8,251,235,6,91,97,92,93,
+114,109,8,138,247,166,21,187,86,193,84,158,124,8,247,235,6,102,168,87,191,
+103,181,8,14,71,248,126,248,61,21,247,17,244,143,95,171,97,174,131,25,138,
+153,138,150,146,26,189,157,201,173,202,30,131,151,5,123,93,89,130,96,27,111,
+121,142,149,111,31,104,179,94,175,134,30,251,17,34,5,252,68,251,99,21,176,
+132,193,135,217,137,247,151,247,109,24,72,140,115,141,63,151,8,247,67,251,
+103,21,150,7,182,145,204,149,188,30,251,151,251,110,5,132,104,129,36,109,
+26,14,188,247,187,249,91,21,109,88,126,97,92,26,95,145,116,160,97,30,149,
+106,125,142,122,27,70,85,117,86,81,31,247,153,251,110,5,182,189,193,162,189,
+27,178,190,115,97,188,31,241,52,71,128,91,110,68,66,25,156,220,182,144,198,
+27,205,190,132,124,189,31,118,182,126,173,127,183,8,129,176,127,233,181,26,
+144,140,151,140,155,30,140,142,139,144,146,26,92,80,109,68,85,26,140,119,
+38,224,5,66,201,117,177,203,26,182,150,177,166,183,30,14,247,20,174,248,184,
+21,155,37,190,70,219,107,59,110,83,62,128,42,8,247,230,6,147,198,169,195,
+181,176,8,162,167,190,151,207,27,247,26,6,93,87,121,87,130,37,229,247,4,235,
+218,224,170,37,182,54,209,55,247,2,141,55,168,58,181,98,8,251,24,6,64,138,
+94,150,105,167,100,172,109,198,133,195,8,14,188,248,189,247,89,21,110,188,
+128,173,183,26,198,165,182,210,199,30,240,224,138,120,5,85,169,67,186,80,
+30,137,163,139,149,152,26,247,2,164,247,0,182,217,30,123,86,90,132,74,27,
+81,100,144,156,52,31,211,66,186,110,207,129,37,51,24,98,91,86,114,101,27,
+89,85,162,182,89,31,251,152,251,111,5,87,198,192,117,208,27,155,153,142,150,
+172,31,119,98,132,112,99,26,90,148,108,173,77,30,14,131,249,176,247,244,21,
+48,163,100,175,105,228,125,177,135,146,124,152,8,151,126,121,146,121,27,99,
+107,108,100,121,147,120,150,126,31,172,103,176,121,247,10,101,152,135,155,
+134,152,134,251,82,146,51,153,251,68,191,8,158,73,107,145,106,27,73,98,99,
+74,75,180,99,204,172,171,145,158,206,31,247,69,191,230,154,247,78,145,45,
+108,119,132,97,122,8,80,115,105,101,98,26,102,171,108,179,157,157,146,151,
+152,30,154,152,143,146,153,178,173,228,178,174,230,163,8,14,173,249,218,247,
+242,21,40,180,33,247,4,130,212,8,90,107,112,91,87,26,102,158,111,182,112,
+30,251,9,141,80,159,69,203,8,201,67,112,153,90,27,105,112,128,118,117,31,
+122,122,130,122,123,95,123,98,131,131,108,134,170,133,149,129,153,98,152,
+102,149,117,151,125,8,112,162,171,124,171,27,184,178,158,186,193,31,189,182,
+144,143,166,153,8,160,180,198,152,194,27,161,6,93,110,124,114,99,26,87,165,
+94,188,106,30,148,212,243,247,1,240,182,8,14,227,219,248,178,21,111,123,129,
+121,130,144,125,148,125,31,198,49,5,155,114,141,133,130,26,128,139,138,123,
+113,30,77,39,5,125,120,139,139,129,26,121,155,126,160,30,247,136,6,183,143,
+141,174,169,31,187,198,171,181,153,146,190,138,25,220,6,161,150,130,123,130,
+137,132,126,112,31,134,130,137,129,133,26,120,172,119,170,158,156,148,161,
+163,30,246,240,5,159,158,148,155,157,26,158,129,158,122,154,30,251,13,247,
+2,5,151,126,122,146,123,27,100,112,123,117,131,141,132,142,133,31,156,108,
+139,138,126,26,121,129,132,113,30,57,6,90,140,129,144,104,181,85,205,24,117,
+166,130,143,105,137,8,14,247,23,247,20,248,251,21,73,112,118,86,122,141,129,
+148,111,31,169,45,5,149,103,140,134,132,26,132,136,127,134,124,30,135,128,
+136,130,136,130,112,49,24,134,123,137,126,125,26,113,148,118,154,127,30,128,
+153,155,136,180,27,247,112,6,213,138,160,151,175,204,178,208,24,196,171,150,
+148,178,27,160,152,129,121,131,137,127,135,125,31,130,109,133,105,126,26,
+109,167,112,170,159,153,147,171,170,30,247,36,247,36,5,187,190,139,139,160,
+26,160,138,141,98,180,30,251,40,247,43,5,170,109,124,148,117,27,104,116,113,
+101,126,141,125,142,126,31,154,85,139,139,127,26,121,125,130,113,109,124,
+151,182,116,30,96,217,5,204,104,117,152,61,27,14,218,248,201,248,228,21,208,
+35,206,69,240,65,251,12,48,103,102,58,251,9,8,201,6,200,235,217,213,247,10,
+214,251,11,216,51,224,89,225,8,251,96,22,157,101,195,63,186,91,8,252,146,
+94,249,15,6,71,188,59,226,97,210,8,252,81,251,226,21,248,146,6,107,113,78,
+57,113,88,8,195,6,185,216,213,218,207,187,8,253,15,6,14,251,142,139,28,5,
+70,139,6,139,10,139,11,249,168,20,249,219,21,159,19,0,37,2,0,1,0,8,0,16,0,
+23,0,31,0,39,0,44,0,49,0,55,0,64,0,71,0,80,0,94,0,104,0,111,0,120,0,132,0,
+139,0,148,0,155,0,161,0,166,0,170,0,187,0,194,0,209,0,214,0,224,0,234,0,243,
+0,248,0,255,1,3,1,12,1,18,1,24,1,29,1,34,21,251,94,251,55,35,10,21,251,94,
+251,55,38,10,11,248,36,249,86,33,10,11,37,10,221,107,87,196,43,10,39,10,222,
+107,87,195,43,10,61,10,39,10,11,61,10,50,10,11,50,10,106,4,213,11,55,10,41,
+10,247,87,52,10,11,46,10,247,91,64,10,11,67,10,55,46,26,251,73,48,10,67,10,
+56,45,26,251,73,56,10,218,169,217,59,10,51,10,41,10,57,10,251,85,31,11,49,
+10,247,87,52,10,11,61,10,251,93,247,52,251,53,11,248,36,249,86,21,251,94,
+251,55,41,10,11,56,10,217,169,218,59,10,51,10,251,50,251,91,54,10,11,54,10,
+247,87,52,10,11,21,251,95,251,54,11,251,53,66,10,11,249,71,21,11,251,93,247,
+52,251,53,247,92,247,90,247,53,247,53,247,91,11,248,36,249,86,51,10,11,251,
+39,251,38,251,72,251,74,251,37,247,38,247,75,11,68,10,247,55,11,247,53,247,
+91,57,10,251,85,31,11,193,198,30,211,204,222,175,239,27,14,233,137,78,175,
+53,182,102,8,14,251,51,251,90,11,247,46,21,187,65,10,11,249,85,21,11,247,
+91,247,53,247,53,247,91,11,6,243,251,46,5,11,247,56,251,85,31,11,31,210,74,
+177,11,247,88,251,53,11,};
+#endif
@@ -0,0 +1,2952 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusMonoPS_Bold_cff_size = 60905;
+asm(".section .rodata");
+asm(".global fz_font_NimbusMonoPS_Bold_cff");
+asm(".type fz_font_NimbusMonoPS_Bold_cff STT_OBJECT");
+asm(".size fz_font_NimbusMonoPS_Bold_cff, 60905");
+asm(".balign 64");
+asm("fz_font_NimbusMonoPS_Bold_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusMonoPS-Bold.cff\"");
+#else
+const int fz_font_NimbusMonoPS_Bold_cff_size = 60905;
+const char fz_font_NimbusMonoPS_Bold_cff[] = {
+1,0,4,2,0,1,1,1,18,78,105,109,98,117,115,77,111,110,111,80,83,45,66,111,108,
+100,0,1,1,1,54,250,26,0,250,27,1,250,28,12,0,250,29,2,250,30,3,248,20,4,140,
+12,1,51,12,3,247,2,12,4,251,53,252,29,249,141,250,131,5,28,60,120,15,28,60,
+142,17,183,29,0,0,207,59,18,2,4,2,0,1,0,3,0,9,0,16,0,22,0,28,0,38,0,44,0,
+50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,0,123,0,136,0,142,0,148,
+0,154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,216,0,227,0,238,0,247,1,
+2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,1,103,1,115,1,126,1,138,
+1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,190,1,196,1,206,1,212,1,
+218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,2,38,2,44,2,50,2,61,2,
+73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,2,151,2,162,2,173,2,
+180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,3,20,3,27,3,34,3,40,
+3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,118,3,131,3,138,3,145,
+3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,3,216,3,222,3,234,3,
+246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,73,4,79,4,86,4,92,4,
+98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,163,4,168,4,175,4,179,
+4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,4,251,5,2,5,9,5,19,
+5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,5,127,5,136,5,141,
+5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,229,5,237,5,247,6,
+1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,112,6,121,6,128,6,
+137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,6,248,7,2,7,14,
+7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,115,7,122,7,134,
+7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,7,211,7,214,7,
+219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,1,8,4,8,11,8,
+14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,8,80,
+8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,8,127,8,132,
+8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,230,8,239,8,
+251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,134,9,154,9,
+163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,10,6,10,15,
+10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,114,10,123,
+10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,10,213,10,
+222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,46,11,53,
+11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,11,144,11,
+151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,214,11,221,
+11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,12,54,12,63,
+12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,153,12,162,
+12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,12,252,13,
+5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,102,13,111,
+13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,13,191,13,
+200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,14,18,14,
+25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,102,14,
+109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,14,179,
+14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,249,15,
+0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,15,84,
+15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,15,161,
+15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,77,16,91,73,74,65,98,114,
+101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,67,99,97,114,
+111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,99,114,
+111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,116,69,111,
+103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,99,99,101,110,
+116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,76,99,97,114,
+111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,110,103,97,114,
+117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,83,97,99,
+117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,114,105,
+110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,99,117,116,
+101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,117,110,
+105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,114,99,
+117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,114,
+99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,105,
+114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,73,
+109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,109,
+102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,109,
+97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,109,
+97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,114,
+99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,85,109,
+97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,73,98,
+114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,111,
+103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,111,
+116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,101,
+99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,110,
+101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,97,
+99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,77,111,110,111,32,80,83,32,66,111,108,100,
+78,105,109,98,117,115,32,77,111,110,111,32,80,83,1,159,2,0,1,0,103,0,208,
+0,228,1,118,1,125,1,230,2,14,2,21,2,118,2,220,3,9,3,27,3,63,3,85,3,123,3,
+174,3,210,4,9,4,72,4,128,5,27,5,222,5,235,5,244,6,83,6,197,6,203,7,70,7,150,
+8,1,8,29,8,52,8,119,8,162,8,213,9,18,9,101,9,176,10,9,10,60,10,78,10,179,
+10,244,11,47,11,87,11,117,11,208,12,58,12,112,12,201,12,253,13,66,13,104,
+13,163,13,222,13,226,14,12,14,19,14,27,14,36,14,84,14,95,14,161,14,169,14,
+236,15,31,15,69,15,85,15,92,15,126,15,195,15,207,15,212,16,19,16,82,16,91,
+16,153,16,187,16,222,16,255,17,6,17,36,17,89,17,124,17,132,17,140,17,177,
+17,197,17,234,18,4,18,55,18,65,18,74,18,98,18,124,18,160,18,201,18,211,18,
+215,19,4,19,33,19,76,19,94,19,114,19,126,19,139,19,173,19,213,19,218,19,249,
+20,23,20,61,20,64,20,88,20,107,20,146,20,185,20,224,20,245,20,252,21,16,21,
+39,21,72,21,109,21,115,21,132,21,151,21,161,21,171,21,204,21,212,21,231,21,
+242,21,248,22,22,22,34,22,58,22,89,22,122,22,133,22,157,22,165,22,193,22,
+214,22,239,23,14,23,24,23,44,23,70,23,82,23,87,23,94,23,103,23,132,23,152,
+23,181,23,186,23,193,23,212,23,229,24,1,24,29,24,38,24,65,24,85,24,100,24,
+111,24,122,24,127,24,134,24,143,24,147,24,162,24,180,24,184,24,203,24,214,
+24,235,25,4,25,29,25,54,25,72,25,93,25,112,25,128,25,135,25,149,25,157,25,
+181,25,205,25,225,25,237,25,250,26,16,26,26,26,38,26,61,26,73,26,96,26,110,
+26,133,26,145,26,160,26,171,26,182,26,195,26,212,26,234,27,0,27,9,27,18,27,
+37,27,58,27,79,27,100,27,116,27,124,27,145,27,166,27,171,27,179,27,191,27,
+203,27,223,27,243,28,7,28,16,28,32,28,44,28,52,28,64,28,72,28,87,28,106,28,
+125,28,144,28,163,28,182,28,187,28,205,28,220,28,229,28,247,29,9,29,27,29,
+45,29,63,29,79,29,90,29,97,29,108,29,114,29,131,29,148,29,165,29,182,29,191,
+29,208,29,225,29,240,29,249,30,9,30,25,30,41,30,57,30,73,30,89,30,105,30,
+121,30,126,30,142,30,149,30,163,30,177,30,187,30,197,30,205,30,215,30,223,
+30,231,30,239,30,246,30,253,31,12,31,27,31,42,31,51,31,66,31,74,31,85,31,
+100,31,111,31,125,31,135,31,149,31,163,31,173,31,187,31,201,31,208,31,222,
+31,236,31,250,32,6,32,15,32,24,32,33,32,42,32,51,32,57,32,70,32,83,32,96,
+32,109,32,122,32,135,32,148,32,158,32,171,32,184,32,197,32,204,32,211,32,
+218,32,230,32,242,32,254,33,10,33,22,33,27,33,39,33,51,33,63,33,75,33,87,
+33,99,33,111,33,116,33,128,33,140,33,152,33,162,33,170,33,178,33,186,33,194,
+33,202,33,210,33,216,33,222,33,228,33,239,33,250,34,5,34,16,34,27,34,38,34,
+49,34,60,34,71,34,82,34,93,34,104,34,115,34,126,34,137,34,148,34,159,34,170,
+34,181,34,186,34,197,34,204,34,210,34,219,34,232,34,245,34,249,34,254,35,
+7,35,16,35,30,35,36,35,40,35,47,35,52,35,57,35,66,35,73,35,80,35,93,35,99,
+35,104,35,109,35,115,35,121,35,126,35,131,35,150,35,166,35,186,35,200,35,
+216,35,226,35,236,35,252,36,0,36,3,36,18,36,45,36,56,36,68,36,74,36,118,36,
+123,248,50,247,43,21,180,29,247,31,6,160,154,141,144,147,31,155,148,149,157,
+157,26,155,131,155,125,149,30,128,146,130,141,112,140,251,91,248,96,24,251,
+111,6,112,247,169,29,154,129,30,131,149,150,137,166,27,196,6,251,44,251,249,
+5,95,115,121,105,104,162,122,186,31,247,25,6,160,154,247,38,29,147,128,130,
+141,111,27,122,6,159,186,5,247,80,242,21,251,37,6,212,247,61,5,11,247,90,
+247,124,21,216,136,6,115,140,130,145,130,30,124,149,157,129,247,122,29,147,
+166,26,247,0,7,159,138,145,136,149,30,157,132,118,153,117,27,122,123,131,
+126,129,31,131,128,137,129,113,26,136,62,247,19,247,118,95,7,116,141,128,
+145,130,30,124,149,157,129,157,165,29,148,166,26,247,39,252,89,7,112,132,
+247,127,29,123,121,191,29,123,121,151,29,248,111,247,41,6,163,137,149,209,
+29,7,11,248,150,248,61,21,251,31,6,200,29,122,247,16,29,132,149,152,83,29,
+11,248,190,247,65,21,166,147,154,157,164,247,118,29,111,27,251,67,6,113,131,
+247,180,29,131,149,151,137,164,27,235,79,6,125,104,100,132,91,27,77,91,153,
+166,105,31,110,163,125,175,192,26,200,7,186,158,186,172,170,30,168,169,183,
+154,193,27,211,188,119,107,148,31,148,108,139,139,145,132,8,129,148,153,133,
+154,165,29,147,166,26,213,7,164,138,147,133,149,30,154,130,122,149,121,27,
+119,128,131,118,128,31,158,96,91,149,86,27,55,75,115,88,85,31,84,87,108,68,
+65,26,72,7,71,165,72,180,99,30,90,189,225,111,239,27,218,189,153,186,232,
+31,11,247,192,248,214,108,29,11,248,146,248,6,21,247,104,29,123,130,133,122,
+130,31,154,102,97,147,91,27,251,14,51,83,60,62,199,99,247,34,124,31,193,134,
+160,135,155,133,8,159,131,151,128,128,26,119,86,122,80,86,97,151,162,111,
+30,169,130,122,153,111,27,120,124,132,125,128,31,131,128,137,130,113,26,107,
+7,93,157,118,176,152,148,142,147,150,30,121,178,190,130,197,27,247,23,234,
+197,219,185,112,181,94,163,31,128,29,11,247,152,179,29,251,106,6,247,74,29,
+123,153,130,30,131,150,150,137,165,27,192,251,250,86,247,163,29,104,163,122,
+185,30,248,112,187,29,251,99,7,11,247,246,247,128,67,29,11,248,41,247,122,
+21,251,19,128,7,132,29,247,250,6,173,143,157,157,169,26,155,131,154,125,150,
+30,146,247,6,29,122,147,123,153,129,30,132,150,149,137,166,27,150,251,20,
+251,98,247,20,150,6,164,149,140,145,247,52,29,247,6,29,109,157,121,173,135,
+30,251,250,137,247,78,29,123,147,123,153,129,30,132,149,152,136,164,27,247,
+13,6,186,162,197,29,128,247,19,6,14,247,90,247,124,21,216,136,6,115,140,130,
+145,130,30,124,149,157,129,247,122,29,147,166,26,247,0,7,159,138,145,136,
+149,30,157,132,118,153,117,27,122,123,131,126,129,31,131,128,137,129,113,
+26,136,62,247,19,247,118,95,7,116,141,128,145,130,30,124,149,157,129,157,
+165,29,148,166,26,247,39,252,89,7,247,157,29,122,191,29,122,122,151,29,248,
+111,247,41,6,164,137,148,209,29,7,11,247,43,29,101,90,148,84,27,251,45,32,
+42,251,31,80,160,88,180,100,31,92,189,202,119,237,27,213,203,150,159,180,
+31,183,160,162,165,166,26,167,115,163,109,110,29,11,21,247,1,49,5,130,151,
+148,135,149,27,160,157,156,159,154,171,29,247,246,248,239,21,251,74,6,113,
+130,137,134,129,247,135,29,121,26,122,147,124,154,129,30,131,149,151,137,
+165,27,213,252,32,136,29,11,21,149,247,9,29,131,127,134,127,130,26,119,157,
+122,162,155,149,146,159,152,30,14,21,157,153,145,149,152,26,161,121,156,116,
+127,133,136,126,123,30,251,26,33,5,122,125,132,128,126,26,119,158,121,161,
+149,149,143,151,153,30,14,248,42,248,31,21,167,102,90,154,88,27,251,29,36,
+42,251,21,251,20,243,41,247,28,189,184,153,169,181,31,94,7,92,103,108,85,
+30,251,1,6,247,131,29,130,129,121,121,26,123,97,29,11,131,29,93,27,251,8,
+63,199,232,31,200,7,239,211,210,239,173,173,131,124,166,30,167,124,149,128,
+143,117,8,101,146,154,123,65,29,11,247,102,242,21,247,190,247,255,5,237,252,
+52,251,58,7,115,141,130,247,7,29,166,26,202,247,58,7,251,189,251,253,5,39,
+248,98,247,60,7,164,138,147,132,149,30,153,130,121,149,120,247,81,29,74,7,
+11,247,245,248,97,21,240,55,6,115,141,129,145,130,30,123,149,156,130,158,
+165,29,147,167,26,247,79,252,160,251,79,7,115,141,129,247,7,29,167,26,223,
+238,251,250,78,7,113,131,138,133,243,29,247,123,6,185,247,166,29,112,27,77,
+6,11,247,146,242,21,247,148,247,131,5,222,252,53,32,7,116,141,128,145,130,
+30,123,149,156,130,158,165,29,148,166,26,143,247,26,7,251,146,251,130,5,55,
+248,78,227,7,247,151,29,120,27,108,120,121,105,136,31,11,189,242,21,135,247,
+33,29,123,121,26,104,163,122,185,30,234,6,177,162,159,173,165,125,156,113,
+144,31,154,188,5,225,91,135,6,108,116,117,112,106,163,118,175,31,247,245,
+247,13,6,164,138,147,132,173,29,128,114,26,121,251,31,247,21,150,7,106,141,
+160,119,170,247,36,29,148,166,26,213,7,165,138,146,132,148,30,155,129,122,
+148,120,247,128,29,133,130,137,134,137,121,8,128,247,19,247,10,81,6,116,141,
+129,145,130,30,123,149,156,130,158,165,29,147,166,26,247,53,252,79,7,112,
+132,247,14,29,148,123,152,130,30,131,150,150,137,165,27,147,6,240,251,98,
+21,85,6,193,247,65,5,11,248,251,247,56,21,187,7,204,122,194,107,177,30,182,
+103,93,163,90,27,96,107,124,102,102,31,175,106,102,155,93,27,114,81,128,127,
+101,31,110,130,124,122,114,26,110,162,115,168,146,147,140,142,148,30,157,
+204,146,141,156,27,165,157,121,114,31,124,7,142,116,121,141,124,27,91,76,
+121,115,98,31,95,112,123,113,94,26,44,209,77,245,182,170,148,161,174,30,128,
+150,150,134,154,27,155,151,144,149,149,31,117,174,163,132,180,27,187,201,
+154,160,175,31,156,150,149,155,158,26,170,118,162,110,125,124,135,126,110,
+30,127,111,122,135,117,27,101,117,161,193,123,31,251,6,105,21,106,98,117,
+129,110,27,98,113,159,170,150,143,147,147,145,31,154,158,178,149,176,27,156,
+152,137,134,161,31,247,8,212,21,192,148,161,166,173,27,174,161,112,86,147,
+31,11,248,103,21,247,1,6,155,29,252,0,64,29,14,104,29,247,100,22,247,29,29,
+14,209,242,21,99,138,119,122,106,26,105,162,121,181,30,239,6,247,119,247,
+164,5,251,60,132,7,93,115,121,105,105,163,121,185,31,247,3,6,186,163,157,
+172,173,117,156,94,140,31,247,110,149,7,186,163,157,173,173,115,157,92,31,
+251,7,6,251,119,251,163,5,247,59,152,7,192,163,155,175,175,115,155,86,31,
+251,3,6,92,115,121,105,106,159,122,180,138,31,11,248,202,248,117,21,177,137,
+151,132,150,30,155,128,121,145,105,27,78,101,119,89,105,31,68,36,115,105,
+133,135,247,124,29,178,26,177,117,152,75,247,82,29,251,248,7,79,138,118,125,
+101,26,102,162,125,202,30,237,6,202,247,92,29,134,6,134,247,36,162,6,169,
+141,173,109,171,83,197,251,0,233,29,153,74,31,124,6,83,244,114,184,115,170,
+108,164,25,143,247,20,29,141,142,163,175,24,140,141,144,247,145,29,176,153,
+161,198,31,11,247,90,247,124,59,29,21,216,136,6,115,140,130,145,130,30,124,
+149,157,129,247,122,29,147,166,26,247,0,7,159,138,145,136,149,30,157,132,
+118,153,117,27,122,123,131,126,129,31,131,128,137,129,113,26,136,62,247,19,
+247,118,95,7,116,141,128,145,130,30,124,149,157,129,247,122,29,148,166,26,
+247,39,252,89,7,112,132,247,127,29,123,121,191,29,123,121,151,29,248,111,
+247,41,6,163,137,149,133,148,30,155,129,121,148,121,27,121,124,131,126,128,
+31,131,128,137,130,112,26,93,251,140,7,14,247,130,145,21,86,40,5,41,6,114,
+130,137,134,129,160,29,131,149,152,137,164,27,247,107,6,162,151,241,29,155,
+125,148,30,147,128,130,141,113,27,247,118,248,51,5,173,143,158,157,168,202,
+29,128,129,141,112,27,47,6,215,29,251,4,251,94,24,251,1,247,94,5,175,141,
+160,158,169,202,29,99,29,11,247,111,247,51,21,153,149,236,57,5,129,126,135,
+130,126,151,29,247,10,6,186,247,123,29,129,140,111,27,107,6,251,47,247,23,
+247,6,227,5,165,6,163,150,140,145,148,31,155,149,149,155,157,202,29,128,130,
+141,111,27,251,4,6,114,128,201,29,122,26,125,143,129,149,127,30,70,87,5,247,
+209,251,12,7,120,131,139,136,129,31,121,133,124,118,118,247,16,29,131,150,
+149,137,166,27,151,252,32,227,29,11,247,42,29,247,19,34,232,251,35,79,97,
+125,102,92,31,178,251,12,7,114,129,229,29,151,252,51,85,29,163,29,247,100,
+22,104,110,111,106,105,168,111,174,174,168,167,172,174,111,166,103,31,14,
+137,6,77,29,191,195,159,149,185,27,169,158,134,127,154,31,155,126,143,128,
+108,26,251,51,137,7,113,130,247,180,29,132,149,152,136,164,27,247,4,6,161,
+153,141,144,147,31,155,148,149,157,157,26,155,131,155,125,149,30,247,39,29,
+92,120,105,103,30,11,170,247,36,29,150,164,26,219,7,164,138,147,132,149,30,
+154,129,122,148,120,27,121,127,133,123,126,31,169,70,113,145,83,27,251,49,
+251,11,251,10,251,47,31,11,248,16,247,113,21,247,19,240,156,141,144,140,146,
+143,25,247,71,29,128,141,112,27,48,6,119,132,114,29,158,122,174,174,29,114,
+151,31,204,192,205,87,5,117,130,126,121,118,26,103,162,122,11,21,247,54,247,
+117,5,183,162,157,172,156,168,29,251,13,50,247,13,5,163,150,151,155,161,202,
+29,247,133,29,50,247,190,29,148,137,164,138,247,55,251,117,24,251,25,78,247,
+164,29,105,163,121,186,30,247,122,247,26,29,78,6,11,209,247,124,21,251,21,
+7,101,138,116,120,108,151,29,247,97,138,29,152,130,30,149,132,146,137,161,
+138,8,251,18,136,247,164,29,104,163,122,185,30,247,4,22,209,6,185,163,156,
+174,155,131,154,125,149,31,147,128,130,141,111,27,69,247,18,245,6,231,143,
+207,70,141,40,8,95,7,43,77,81,40,143,30,32,6,14,248,83,247,207,21,109,146,
+156,125,169,27,177,154,162,198,191,119,159,87,87,95,122,106,109,31,74,69,
+5,115,116,134,136,117,27,129,182,6,193,141,115,29,168,119,171,98,189,72,24,
+173,95,143,137,177,138,8,247,93,29,151,71,140,31,88,207,118,168,117,160,116,
+154,25,205,205,5,11,247,110,247,214,21,247,69,247,25,29,251,69,219,6,164,
+138,147,132,173,29,129,113,26,59,108,7,112,132,138,133,129,160,29,132,149,
+152,136,164,27,170,251,94,6,56,211,87,247,9,193,217,155,161,188,30,179,157,
+152,152,164,26,168,116,162,110,127,133,137,130,120,30,118,95,91,128,87,27,
+102,112,145,151,128,31,134,144,137,148,158,26,11,248,42,248,31,21,166,104,
+88,155,88,27,251,29,36,42,251,21,251,20,243,41,247,28,189,184,153,169,181,
+31,94,7,92,103,108,85,30,251,1,6,247,131,29,130,129,121,122,26,122,97,29,
+11,21,115,124,123,115,63,224,71,233,233,224,247,90,29,129,107,236,29,153,
+129,30,132,149,153,136,163,27,247,22,247,134,29,156,131,154,125,149,31,129,
+146,132,141,117,140,8,247,249,7,173,144,157,156,169,247,118,29,112,27,251,
+4,6,251,25,251,170,251,28,247,170,5,251,3,6,119,132,138,136,130,31,119,133,
+125,118,119,26,109,157,122,173,134,30,251,249,7,101,138,116,120,107,26,105,
+163,121,186,30,247,21,6,185,247,123,29,130,141,111,27,108,6,14,248,169,248,
+97,21,178,140,161,157,171,202,29,128,130,141,111,27,251,22,6,112,132,138,
+133,129,247,188,29,251,162,6,83,83,94,70,70,83,184,195,30,247,162,235,29,
+131,141,110,27,251,22,6,200,29,121,26,108,161,120,178,138,30,251,153,7,11,
+247,152,248,97,21,247,99,55,6,114,141,130,145,130,30,123,149,156,130,158,
+27,157,154,146,153,150,247,129,29,247,79,252,112,7,93,115,121,105,123,147,
+124,153,129,31,131,151,147,137,167,27,192,251,250,86,6,118,29,6,14,7,140,
+152,148,140,143,27,171,156,129,121,126,128,132,118,123,117,145,148,122,31,
+150,119,137,140,130,27,118,121,122,118,122,148,126,160,128,31,126,165,11,
+114,129,138,133,130,247,186,29,247,4,6,161,153,241,29,154,124,150,30,147,
+129,129,140,111,27,137,247,61,6,11,168,165,153,194,171,181,135,133,176,30,
+137,152,149,138,146,27,167,161,162,169,163,123,156,110,147,31,147,106,77,
+146,96,27,251,13,63,83,48,31,108,97,7,112,131,138,133,129,31,123,130,129,
+122,121,26,104,163,122,185,30,182,251,111,85,6,113,131,138,133,129,247,186,
+29,247,189,6,185,163,156,174,155,131,154,125,149,31,147,128,130,141,111,27,
+11,21,120,126,125,120,121,151,128,158,137,31,163,138,146,138,149,134,8,163,
+128,155,118,119,26,106,112,122,85,104,125,142,148,125,30,146,131,135,140,
+132,27,123,126,125,120,108,185,118,209,185,170,147,158,163,31,165,159,155,
+173,172,26,175,119,172,104,159,30,169,161,153,163,171,26,200,90,183,72,78,
+84,107,103,121,152,124,155,147,147,142,146,144,30,159,156,153,145,167,27,
+173,161,123,115,116,117,119,114,31,11,247,91,243,21,247,110,149,7,186,164,
+156,247,73,29,160,124,190,138,31,251,111,142,29,247,111,7,191,140,159,154,
+174,26,173,115,157,93,30,251,12,6,93,115,121,105,105,163,122,185,31,149,251,
+110,6,14,174,111,98,163,107,27,111,116,115,110,118,146,130,166,123,31,150,
+132,142,137,143,136,8,170,115,157,85,65,26,87,123,106,114,111,122,176,208,
+247,47,29,115,122,129,119,131,31,135,129,139,135,137,108,8,69,135,123,103,
+110,27,114,123,172,193,193,153,197,158,162,31,147,148,147,146,153,147,8,169,
+157,147,149,159,26,169,116,163,110,105,96,11,21,251,12,106,5,112,132,131,
+131,121,26,120,153,124,155,146,146,140,142,147,30,175,151,5,251,121,93,7,
+110,125,128,118,118,154,127,167,31,247,55,6,164,152,150,161,160,127,150,113,
+31,89,6,11,136,164,27,170,251,60,6,88,88,116,127,90,27,81,113,159,184,31,
+247,161,251,12,7,200,29,122,247,16,29,132,149,150,136,166,27,151,251,62,6,
+82,159,97,179,110,30,115,173,181,127,185,27,193,171,152,179,186,31,98,238,
+7,247,1,29,131,141,118,140,8,11,247,70,29,118,127,143,132,152,129,31,147,
+132,247,47,251,16,247,46,247,16,5,163,158,140,141,155,26,159,121,156,119,
+128,130,135,130,128,30,14,127,6,114,129,137,134,130,31,123,130,129,121,122,
+158,29,247,133,29,85,6,247,37,248,63,21,223,199,93,74,108,121,106,111,119,
+31,121,114,106,130,99,27,98,106,148,157,114,31,112,159,120,172,169,26,205,
+198,185,225,30,14,8,210,176,173,186,200,26,241,48,210,251,25,30,251,115,6,
+112,132,247,14,29,148,123,152,130,30,131,150,150,137,165,27,150,251,249,128,
+6,114,130,137,133,129,31,123,130,129,122,121,151,29,247,42,6,160,154,231,
+29,108,11,248,167,88,29,21,125,126,129,119,123,31,111,119,135,136,126,247,
+53,29,124,109,113,31,121,118,129,120,125,26,120,154,125,159,150,148,144,150,
+148,30,175,167,147,145,155,172,29,21,115,153,29,118,27,14,122,29,140,247,
+8,113,29,11,247,134,29,173,115,157,93,31,11,248,61,21,41,6,215,29,8,251,111,
+137,247,78,29,123,147,123,153,129,30,132,149,152,136,164,27,247,4,247,134,
+29,155,131,154,125,150,31,146,128,130,141,111,27,137,247,60,6,11,248,20,247,
+214,175,29,149,152,135,29,11,21,154,155,145,149,151,26,159,121,157,119,127,
+131,135,127,128,30,37,34,5,117,116,138,138,126,26,119,158,120,159,149,150,
+145,150,150,30,247,158,243,21,155,155,144,149,151,26,159,121,157,119,127,
+131,135,127,127,30,37,34,5,118,116,138,138,247,160,29,247,182,29,247,97,247,
+4,29,247,110,7,187,140,161,156,174,26,175,115,153,76,30,64,6,76,115,125,103,
+104,161,122,188,138,31,76,7,111,89,107,129,98,27,98,124,149,166,31,203,7,
+198,141,158,151,176,247,67,29,58,6,77,115,247,136,29,53,192,93,239,188,183,
+149,160,180,30,11,247,107,29,149,152,137,164,27,247,4,6,247,4,223,218,241,
+138,31,247,229,151,7,163,150,137,29,251,12,6,251,27,49,21,214,199,85,72,69,
+80,85,63,65,79,194,207,207,199,193,213,31,11,21,75,87,89,77,77,191,89,203,
+202,192,189,200,202,88,189,74,31,83,4,171,165,114,109,107,113,114,107,107,
+113,164,170,170,165,164,171,31,11,247,133,29,49,6,119,132,138,136,130,31,
+119,247,112,29,11,116,29,156,174,189,29,11,178,140,161,157,171,202,29,128,
+129,141,112,27,251,22,204,29,170,251,154,6,251,144,248,1,5,251,9,6,200,29,
+121,26,123,11,6,115,107,118,97,124,26,131,146,132,148,146,143,141,146,145,
+30,173,178,163,159,188,168,153,148,24,145,142,143,141,140,140,8,153,147,142,
+142,147,26,146,135,143,120,149,30,79,173,110,162,108,174,8,152,128,135,142,
+132,27,130,131,133,131,124,155,107,168,95,31,11,168,6,162,151,247,191,29,
+173,6,149,29,11,21,247,29,29,11,122,26,122,148,123,152,130,30,131,150,150,
+137,165,27,150,6,247,0,251,19,21,247,19,247,21,7,200,175,117,104,97,91,111,
+70,31,251,1,251,123,21,247,20,247,23,7,180,170,132,125,164,31,163,125,156,
+115,118,26,107,106,123,74,30,14,247,191,248,137,21,251,27,251,5,251,4,251,
+27,251,34,247,2,251,4,247,31,247,29,247,2,247,4,247,31,247,31,251,2,247,3,
+251,30,31,251,86,251,143,21,246,226,225,246,247,0,225,53,33,33,53,52,34,251,
+1,51,224,243,30,11,7,104,135,122,122,109,151,29,11,21,72,74,113,90,83,31,
+78,85,105,60,52,26,251,56,247,19,251,24,247,48,247,47,247,20,247,24,247,51,
+232,107,214,76,196,30,188,85,73,165,71,27,36,4,234,219,52,36,251,0,61,52,
+42,43,60,226,245,244,218,226,235,31,11,247,156,243,21,247,109,247,94,56,7,
+247,62,29,247,79,252,106,7,93,114,247,132,29,191,251,109,87,164,29,247,105,
+91,29,11,126,129,135,131,129,30,106,99,107,130,59,27,251,7,82,177,214,220,
+199,191,232,182,174,131,123,164,31,151,132,145,131,142,196,29,11,248,199,
+247,110,21,162,151,141,144,148,247,83,29,247,66,29,252,162,6,114,129,137,
+134,130,219,29,131,149,151,137,165,27,14,247,0,247,214,117,29,11,21,108,85,
+85,123,85,27,100,107,154,157,153,151,154,159,152,31,156,166,167,146,179,27,
+172,169,136,132,182,31,11,138,136,129,31,120,133,125,118,118,26,122,146,126,
+155,127,30,85,96,85,181,5,154,151,147,154,156,26,155,131,154,125,149,30,147,
+247,133,29,47,6,119,132,138,136,129,31,120,133,125,118,118,26,109,11,160,
+153,175,247,67,29,54,6,75,116,125,102,102,160,124,194,138,31,251,109,7,84,
+138,118,124,103,26,101,162,125,203,247,0,29,11,125,29,247,236,6,185,163,11,
+21,214,29,248,20,126,29,11,116,127,137,134,130,247,61,29,124,153,128,30,132,
+150,147,137,168,27,247,106,6,164,149,247,63,29,155,157,202,29,128,128,141,
+113,27,86,11,148,30,146,107,139,139,147,131,8,130,148,154,133,154,27,156,
+247,119,29,11,31,228,7,163,137,148,133,173,29,128,114,26,251,50,7,147,136,
+5,97,229,204,121,195,27,199,195,158,175,182,31,188,178,156,176,203,26,11,
+247,201,247,96,21,178,170,169,176,176,108,169,100,31,121,6,100,108,109,102,
+102,170,109,178,31,14,162,116,168,149,153,141,143,157,30,150,187,173,144,
+173,27,200,166,126,110,31,121,7,145,104,106,142,106,27,50,70,114,90,92,31,
+114,113,124,104,108,26,66,222,80,242,194,197,151,161,186,30,11,6,113,247,
+23,29,122,122,151,29,11,114,163,107,31,247,97,247,4,29,247,246,248,61,21,
+251,74,6,112,183,29,104,163,122,186,30,213,251,111,251,10,123,29,11,6,161,
+152,141,144,148,31,155,148,149,157,157,26,155,131,155,125,148,30,147,128,
+130,141,111,27,11,247,49,29,119,127,136,138,126,123,30,251,145,251,70,247,
+145,251,71,5,126,155,142,138,151,27,159,155,153,158,149,134,146,127,150,31,
+11,109,155,97,150,65,148,75,148,133,140,126,143,8,124,145,130,146,146,26,
+153,187,154,186,180,172,130,121,165,30,108,157,151,131,164,247,36,29,149,
+165,26,11,113,247,23,29,122,122,247,80,29,11,248,197,134,29,168,247,133,21,
+251,39,247,18,32,247,64,212,208,157,169,183,30,175,164,158,164,162,26,167,
+114,163,110,125,126,134,127,127,30,113,114,139,139,129,133,8,125,113,101,
+131,11,114,130,138,133,129,247,65,29,122,147,123,153,130,30,132,149,153,136,
+163,27,247,13,6,185,163,197,29,137,11,248,179,248,21,21,168,157,147,149,160,
+26,164,116,163,113,126,132,136,125,117,30,252,67,251,161,5,109,121,132,129,
+119,26,113,162,115,164,151,154,145,149,155,30,14,21,115,124,123,115,63,223,
+71,234,234,223,247,90,29,130,106,236,29,247,48,29,251,198,7,247,174,29,124,
+153,129,30,132,150,151,136,164,27,11,251,10,123,29,247,236,247,134,29,189,
+29,11,241,29,155,125,149,30,146,128,130,141,111,27,11,6,247,50,135,247,3,
+241,140,247,44,8,183,7,247,45,251,7,247,11,251,39,137,30,251,104,6,112,131,
+247,14,29,148,123,11,249,70,21,152,123,133,142,127,27,116,121,122,117,126,
+146,129,156,125,31,247,26,32,5,126,155,146,136,150,27,161,158,157,160,152,
+132,150,122,153,31,14,249,47,163,29,14,21,142,145,143,155,144,26,155,123,
+154,123,125,129,132,121,130,30,251,125,252,71,5,135,130,135,128,132,247,15,
+29,14,107,29,247,28,99,6,95,158,116,174,175,158,162,183,30,179,247,27,7,185,
+163,157,173,170,122,155,104,143,31,11,21,157,154,145,148,152,26,161,121,156,
+116,127,132,136,126,123,30,251,25,33,5,123,126,131,127,126,26,119,158,121,
+161,149,148,143,151,154,30,14,152,29,14,21,152,123,133,247,181,29,127,153,
+149,135,149,27,161,158,157,159,152,132,150,122,153,31,14,239,29,127,155,147,
+135,149,27,162,158,157,160,153,133,148,120,154,31,14,247,111,247,13,21,52,
+185,90,222,191,173,162,175,167,115,163,111,132,130,137,137,131,30,137,133,
+133,138,135,27,128,135,145,154,31,247,139,7,184,11,21,143,147,143,153,144,
+26,155,123,154,122,125,130,132,121,129,30,251,125,252,71,5,135,130,135,128,
+132,26,123,155,124,156,153,149,147,156,148,30,11,161,155,157,158,149,151,
+136,134,155,30,134,156,143,138,149,27,169,162,162,168,157,131,153,124,149,
+31,152,118,95,149,102,27,61,77,76,59,31,105,11,138,135,27,128,135,145,154,
+31,247,139,7,184,120,162,104,104,120,116,94,30,11,26,105,163,121,185,30,11,
+245,29,174,170,112,107,106,109,112,103,103,109,166,172,171,169,166,175,31,
+11,124,123,115,63,224,71,233,233,224,247,90,29,130,106,132,31,97,129,99,247,
+86,29,11,154,128,30,132,150,152,136,165,27,248,180,6,162,152,141,145,149,
+31,156,149,150,157,158,26,157,130,156,124,149,247,64,29,11,170,155,152,164,
+164,123,152,108,31,251,1,6,188,137,124,159,102,27,102,123,119,90,138,31,95,
+6,108,123,126,114,114,155,126,170,31,183,11,163,191,247,31,29,11,129,125,
+144,124,247,81,29,247,96,29,114,190,189,128,193,27,11,247,16,29,131,149,151,
+137,165,27,247,66,6,162,152,247,38,29,146,11,247,127,29,123,121,26,122,147,
+124,11,247,65,29,122,147,124,153,129,30,11,112,27,110,6,94,246,78,218,80,
+169,247,62,247,34,24,181,162,157,172,156,131,154,125,149,31,147,247,133,29,
+39,6,118,11,248,130,179,29,251,168,6,11,21,104,110,111,106,105,168,111,174,
+174,168,167,172,174,111,166,103,31,11,6,93,114,121,105,105,164,121,185,31,
+11,247,91,29,150,141,11,21,247,1,48,5,130,151,147,135,150,27,159,157,156,
+160,154,136,143,117,156,31,251,45,247,130,29,115,121,137,11,26,161,121,156,
+116,127,133,136,126,123,225,29,131,154,125,149,31,247,66,29,47,6,115,127,
+201,29,122,26,116,151,122,164,129,30,52,11,147,247,133,29,47,6,119,132,138,
+136,130,31,119,133,125,118,118,26,109,158,121,175,136,30,224,251,214,5,239,
+6,11,247,38,247,250,21,247,4,251,118,5,234,6,244,247,117,5,251,145,108,7,
+113,131,137,133,129,31,123,130,129,122,121,26,11,136,143,116,157,31,251,45,
+247,17,224,29,27,153,146,136,122,166,31,112,184,172,125,163,27,169,163,153,
+172,167,31,161,166,247,126,29,149,30,154,129,122,242,29,11,135,30,247,16,
+38,251,33,251,10,5,103,136,119,121,109,151,29,247,3,6,186,162,156,175,162,
+130,151,11,21,251,229,7,92,103,108,85,30,251,3,6,113,131,138,133,129,160,
+29,131,11,247,59,29,59,247,18,21,167,159,120,112,110,120,120,109,111,119,
+158,167,167,159,158,168,31,11,138,132,139,128,130,26,108,160,118,169,165,
+156,155,176,148,30,193,154,162,153,216,27,191,179,126,121,122,95,126,78,11,
+95,158,116,174,174,158,162,183,30,11,248,97,21,192,6,162,151,241,29,154,125,
+149,30,147,128,130,141,111,27,11,158,92,5,122,6,113,131,137,133,129,31,123,
+130,129,122,121,247,16,29,132,149,153,136,163,27,11,163,169,170,114,163,107,
+31,251,170,247,4,29,247,34,29,149,11,247,23,29,123,121,26,11,159,152,175,
+247,67,29,55,6,11,21,153,151,146,150,151,26,157,122,155,120,130,129,135,129,
+127,30,251,0,56,5,125,128,132,128,126,26,121,11,27,121,121,131,125,128,31,
+131,128,136,128,113,26,251,83,7,247,105,29,11,247,79,6,164,137,148,133,148,
+30,155,129,122,148,120,27,121,124,132,125,128,31,131,128,137,130,112,26,55,
+11,142,127,218,29,11,247,102,29,251,10,6,11,6,203,162,153,177,175,117,154,
+87,140,31,247,249,7,193,141,184,29,11,247,16,29,131,150,150,137,165,27,150,
+251,250,128,247,33,29,11,30,105,6,76,116,125,102,110,154,122,172,133,31,43,
+7,76,247,2,5,205,101,108,162,88,27,95,129,11,248,228,21,251,37,6,247,40,251,
+122,5,120,151,147,133,155,27,158,155,153,156,144,138,147,136,146,31,11,128,
+6,114,130,137,134,243,29,11,156,174,167,120,158,108,142,31,233,245,232,34,
+5,107,135,120,120,111,26,104,163,122,185,30,247,3,11,123,144,117,142,133,
+147,132,8,131,148,155,133,153,247,36,29,149,165,26,11,156,174,155,131,154,
+125,150,31,146,128,130,141,111,27,11,248,135,21,251,18,251,0,247,18,6,11,
+6,93,115,121,105,105,163,121,185,31,11,114,129,201,29,11,137,134,130,247,
+135,29,11,26,156,131,154,125,149,30,147,11,6,214,29,11,6,114,129,137,134,
+130,219,29,132,150,150,137,165,27,11,6,116,141,129,145,130,30,124,148,158,
+129,247,122,29,147,166,26,11,131,211,29,11,70,251,92,5,136,132,138,132,133,
+26,123,155,125,158,154,147,226,29,11,127,26,121,156,123,158,148,150,247,155,
+29,133,148,30,155,129,122,148,120,247,128,29,131,128,137,130,112,26,93,251,
+140,11,140,31,154,7,163,140,152,151,159,26,158,125,151,116,140,30,72,22,60,
+6,218,247,16,5,11,248,155,21,168,126,155,115,115,126,124,109,30,251,24,7,
+110,152,123,163,163,152,155,168,30,11,26,170,168,162,178,165,158,132,122,
+155,30,114,162,145,136,159,27,169,162,162,169,190,58,190,11,30,131,150,150,
+137,165,27,150,251,250,128,247,33,29,122,122,26,11,247,131,29,130,129,121,
+122,26,122,147,123,153,130,30,132,150,151,136,164,27,11,118,132,138,136,130,
+31,120,247,60,29,129,30,149,133,146,137,161,138,11,136,166,27,247,136,6,174,
+247,150,29,131,126,142,115,27,14,21,112,131,247,143,29,11,27,116,121,122,
+117,126,145,129,157,125,31,247,26,11,247,61,29,123,153,129,30,11,141,251,
+46,247,17,24,251,47,251,17,5,117,121,136,135,125,26,118,157,122,160,149,147,
+11,21,162,162,151,166,170,26,201,89,187,74,73,89,91,76,109,151,112,162,116,
+30,114,118,11,30,146,128,130,141,111,27,251,23,6,247,131,29,130,129,121,122,
+26,122,11,248,111,247,51,29,151,135,147,126,149,31,11,251,47,251,17,5,115,
+120,137,136,125,247,88,29,30,251,26,33,5,122,125,132,128,126,26,118,158,121,
+161,150,146,142,152,155,30,14,145,157,151,30,247,37,247,118,5,11,127,247,
+138,29,122,121,151,29,247,12,6,11,7,116,141,128,145,130,30,124,149,157,129,
+157,27,156,155,147,153,150,31,147,149,141,11,137,134,130,219,29,132,150,149,
+137,166,27,11,138,132,128,31,123,130,129,122,122,26,123,148,123,152,129,30,
+131,151,148,137,166,27,11,247,161,29,155,125,149,30,147,128,130,141,111,27,
+11,21,153,151,146,150,151,26,157,122,155,120,130,129,135,129,127,30,251,0,
+56,5,124,11,24,152,114,153,118,144,137,8,247,68,29,11,31,251,193,237,247,
+159,29,129,145,132,141,118,140,8,11,170,7,163,150,140,145,148,247,54,29,11,
+132,31,97,130,98,247,86,29,118,27,14,6,159,247,101,29,131,154,125,149,30,
+147,128,11,247,89,29,201,68,112,153,94,27,95,105,121,95,99,31,109,11,21,152,
+123,133,142,127,27,116,121,122,117,126,146,128,156,126,31,247,26,32,5,11,
+248,190,247,56,21,180,7,247,26,251,3,237,251,44,251,41,251,5,40,251,21,11,
+247,63,29,156,157,26,155,131,11,148,120,247,128,29,131,129,137,11,129,247,
+135,29,122,26,123,148,122,152,130,30,132,149,154,136,162,27,11,6,83,91,5,
+64,7,247,192,247,141,251,192,247,142,5,63,7,195,92,5,11,21,70,81,85,74,74,
+197,85,208,208,197,193,203,205,82,193,69,31,80,4,11,148,152,143,149,148,26,
+159,121,157,117,122,129,133,118,125,30,57,251,11,5,11,30,224,6,203,247,92,
+29,137,6,137,209,163,6,165,140,11,160,154,247,38,29,129,145,11,165,138,146,
+133,149,30,154,130,121,148,120,27,119,128,131,117,129,31,158,106,11,174,251,
+139,5,112,142,149,128,161,27,160,150,150,166,142,31,171,247,139,5,11,22,247,
+30,29,14,32,5,126,156,146,247,57,29,128,130,141,111,27,38,6,200,29,122,26,
+11,145,130,30,123,149,157,130,157,165,29,147,11,27,141,6,103,251,22,82,247,
+35,5,45,6,83,251,34,105,247,21,5,11,153,143,149,147,26,160,121,156,117,121,
+130,133,119,125,30,57,251,12,5,11,159,152,176,26,178,116,152,74,30,50,6,75,
+116,125,101,104,159,125,192,11,114,129,137,134,247,168,29,131,11,119,132,
+139,136,129,31,120,132,125,119,118,247,16,29,131,11,125,102,104,163,121,187,
+31,143,251,23,6,11,247,127,29,122,122,26,122,11,26,123,155,124,156,152,149,
+147,156,149,30,11,26,122,147,124,153,129,30,11,251,46,247,130,29,116,121,
+137,135,125,26,118,157,122,11,138,247,47,251,65,24,251,55,251,77,5,101,116,
+119,108,104,163,122,11,21,103,109,109,104,102,168,110,176,175,168,168,175,
+176,110,168,103,31,11,146,146,148,152,158,159,167,25,142,145,141,141,142,
+143,144,147,143,145,11,27,181,171,157,182,177,31,174,178,147,153,160,26,170,
+113,164,107,30,11,161,198,31,148,7,177,137,151,132,150,30,155,128,121,145,
+105,27,78,11,131,247,127,29,11,6,103,118,123,113,130,144,127,146,131,31,129,
+149,147,136,166,27,11,6,185,163,156,174,247,108,29,146,128,130,141,111,27,
+11,6,186,163,247,103,29,111,27,11,21,116,124,124,117,77,213,85,226,225,213,
+193,201,161,124,154,117,11,164,126,30,53,43,51,235,5,164,152,149,152,162,
+26,155,131,154,11,104,110,112,105,106,168,111,174,174,168,167,171,174,111,
+166,103,31,11,107,114,115,109,108,164,115,171,171,164,163,169,170,114,163,
+107,31,11,114,31,141,231,21,185,155,197,171,207,27,207,196,107,93,156,31,
+11,121,93,27,94,104,158,167,131,31,165,132,130,148,119,27,14,6,114,130,137,
+134,129,31,123,129,129,11,6,92,115,247,132,29,11,7,92,115,121,105,105,164,
+121,185,31,11,247,91,29,149,141,11,136,136,125,27,128,127,144,158,106,31,
+168,89,121,146,115,27,11,141,144,147,31,155,149,149,156,157,26,155,131,155,
+125,149,30,11,146,128,130,141,111,27,137,247,64,6,236,66,204,251,0,89,11,
+152,26,162,122,154,111,97,128,126,72,127,30,103,251,95,5,11,247,120,29,128,
+31,131,128,137,11,247,70,198,21,104,187,185,124,197,27,247,33,243,227,247,
+12,11,248,180,248,6,21,185,123,160,103,117,128,131,120,132,30,157,11,247,
+18,247,17,7,230,186,116,93,101,106,120,74,31,14,6,173,247,150,29,131,126,
+142,11,6,162,152,141,145,149,31,156,148,150,158,158,26,157,130,11,135,30,
+138,165,138,145,136,147,8,162,132,122,151,113,27,11,137,164,27,247,6,6,247,
+3,224,218,241,138,31,248,76,11,21,247,40,247,23,5,151,150,144,146,149,26,
+158,123,153,11,21,247,1,49,5,130,151,148,135,149,27,160,157,156,160,11,21,
+247,2,48,5,130,151,147,135,149,27,160,157,156,160,11,148,31,155,149,149,155,
+158,26,155,131,154,125,149,30,147,11,27,128,128,144,158,105,31,169,89,120,
+146,116,27,108,110,11,31,247,71,29,11,124,142,135,161,121,31,247,47,251,16,
+247,46,247,16,5,11,247,137,29,247,49,7,14,136,150,27,161,158,157,160,152,
+133,149,120,154,31,14,99,31,122,6,100,108,109,102,102,170,109,178,31,14,187,
+182,205,172,125,170,113,160,30,11,133,124,118,118,26,123,147,123,153,11,247,
+135,29,121,26,123,147,11,94,158,116,174,174,158,162,184,30,11,141,144,148,
+31,155,149,149,11,30,147,127,130,141,110,27,11,31,123,130,129,121,122,26,
+11,147,128,129,141,112,27,11,26,177,116,153,75,30,11,134,144,163,136,173,
+27,150,6,203,162,153,176,178,117,11,21,251,43,101,134,113,94,31,70,98,97,
+63,55,26,11,21,251,3,229,5,149,127,131,142,129,27,118,121,122,11,155,148,
+149,156,157,202,29,128,11,32,5,122,126,132,128,125,26,119,158,121,161,150,
+146,11,173,173,114,247,149,29,105,11,112,132,247,127,29,123,121,26,122,147,
+11,184,176,8,146,145,142,143,146,26,148,132,146,131,124,11,126,26,121,156,
+123,158,148,149,247,155,29,6,51,102,132,113,100,31,71,94,104,64,39,26,11,
+7,114,129,138,133,130,247,65,29,11,21,102,107,109,104,101,170,109,178,177,
+170,169,176,11,26,122,147,123,153,130,30,131,150,150,137,165,27,11,247,128,
+29,132,129,136,128,114,26,11,30,41,6,76,116,126,101,102,164,122,195,140,31,
+11,31,155,149,149,156,157,26,156,131,154,125,149,30,11,161,128,247,142,29,
+66,11,164,27,174,152,160,195,31,152,7,206,128,155,95,11,112,86,27,86,98,166,
+181,130,31,171,132,130,149,11,118,123,111,130,144,126,146,130,31,129,148,
+148,136,11,26,118,157,122,160,149,148,143,148,151,30,14,131,27,133,127,146,
+152,124,31,11,207,215,163,124,155,116,117,130,11,27,156,155,147,152,150,31,
+147,11,162,153,176,174,115,157,92,31,11,183,6,181,160,157,174,177,117,11,
+147,142,149,151,30,14,247,47,247,33,21,247,182,247,177,251,182,6,11,76,7,
+94,157,117,175,156,148,144,156,155,30,11,82,247,111,196,6,242,4,82,173,6,
+161,155,11,21,103,118,124,112,130,144,127,146,131,31,129,11,147,26,160,121,
+157,117,121,130,133,118,125,30,11,152,132,136,142,130,27,132,135,135,121,
+129,31,11,155,142,143,147,31,155,149,149,156,157,26,155,11,155,131,154,125,
+149,31,247,66,29,11,157,173,155,131,154,125,149,31,147,128,129,141,11,158,
+138,146,136,148,30,158,134,119,152,117,27,11,116,141,128,145,129,30,123,150,
+158,129,159,27,11,190,114,168,89,150,31,14,147,124,153,129,30,131,11,155,
+131,155,125,149,31,11,129,6,92,115,120,104,104,163,120,186,31,11,6,93,115,
+121,104,105,160,124,190,137,31,11,7,196,119,181,98,168,30,163,106,97,151,
+11,133,125,118,118,26,111,157,121,171,134,30,11,135,136,126,27,128,127,144,
+158,106,31,168,11,143,247,145,29,11,21,70,251,128,5,136,129,138,135,134,26,
+11,149,151,26,157,122,155,120,129,129,135,130,11,26,168,117,162,110,128,128,
+137,136,126,30,11,26,155,131,154,125,149,30,147,128,129,141,11,154,147,152,
+150,31,147,150,141,147,166,26,11,30,154,130,121,149,120,27,122,123,131,126,
+11,156,147,152,149,31,147,150,141,147,166,26,11,157,247,146,29,11,163,156,
+174,156,131,154,125,149,31,147,128,11,116,138,25,131,247,0,6,201,141,158,
+151,11,184,26,234,52,207,251,14,91,98,130,119,11,147,154,154,26,155,122,154,
+120,30,14,138,133,129,31,123,129,129,11,27,122,123,131,126,128,31,11,31,147,
+150,141,148,166,26,11,247,17,251,47,251,17,5,11,113,131,138,133,129,31,123,
+11,121,105,105,163,121,186,31,11,129,128,141,112,27,11,6,185,163,157,173,
+11,31,123,129,129,122,11,125,103,104,161,122,185,138,31,75,7,11,6,94,157,
+116,175,174,158,162,184,30,11,6,114,129,137,133,130,31,123,130,129,11,6,116,
+127,128,120,119,151,128,162,31,11,6,92,115,121,105,105,164,121,185,31,11,
+132,126,123,111,26,102,162,126,203,30,11,8,159,129,152,121,121,26,100,83,
+109,11,138,132,128,31,122,129,128,121,120,26,11,138,117,122,106,26,105,164,
+121,185,30,11,145,145,146,8,95,143,156,121,173,27,11,27,156,156,147,152,149,
+31,147,150,141,11,31,120,6,75,116,125,101,100,163,126,11,251,6,5,132,129,
+136,130,131,26,120,11,157,92,31,251,12,6,93,115,121,104,11,161,155,165,148,
+133,153,133,146,31,148,11,164,138,147,132,148,30,155,130,121,148,11,104,26,
+106,158,122,173,30,206,6,207,11,176,175,168,168,176,175,110,168,103,31,11,
+117,157,95,30,61,6,97,117,121,105,11,144,148,151,30,14,132,136,126,123,30,
+251,26,33,5,122,11,112,132,247,127,29,122,11,6,115,128,201,29,11,7,185,163,
+156,174,247,108,29,11,126,26,119,158,120,159,149,150,145,150,150,30,14,142,
+143,147,31,155,149,149,156,157,26,155,131,11,184,29,75,11,6,113,183,29,11,
+7,112,247,23,29,122,122,26,11,247,5,247,134,29,247,108,29,11,163,156,174,
+155,131,154,125,149,31,147,128,129,141,11,247,102,29,42,6,14,130,160,29,11,
+131,247,14,29,147,124,11,107,29,248,25,11,247,80,29,192,11,247,135,29,122,
+247,16,29,150,11,112,132,247,14,29,147,11,113,131,247,14,29,147,11,121,137,
+135,125,26,118,157,122,160,149,247,94,29,242,29,128,114,26,11,218,29,33,5,
+11,219,29,131,150,11,129,219,29,132,150,11,159,29,154,129,30,11,188,29,33,
+5,11,21,247,30,29,11,173,173,115,157,93,31,44,6,93,115,121,105,109,156,122,
+174,135,31,11,6,247,131,29,130,129,121,122,26,122,147,123,153,130,30,11,6,
+86,248,247,21,247,1,49,5,130,151,148,135,149,27,160,157,156,159,11,247,135,
+29,122,247,16,29,132,149,153,136,163,27,11,247,65,29,122,148,123,152,130,
+30,131,150,150,137,165,27,11,219,29,132,150,150,137,165,27,170,11,113,131,
+138,133,129,160,29,131,150,11,6,118,132,138,136,130,31,120,247,60,29,129,
+30,149,133,11,137,29,110,11,99,29,14,6,113,131,138,133,129,160,29,131,149,
+152,137,164,27,11,138,132,128,31,122,130,128,120,120,26,121,148,123,154,128,
+30,132,150,152,136,165,27,248,180,6,162,11,247,0,29,168,119,171,98,189,72,
+24,11,6,240,249,10,21,156,153,146,149,152,167,29,133,8,54,76,29,11,91,108,
+118,105,94,26,84,176,105,200,167,170,146,151,165,30,165,150,151,153,159,26,
+161,120,157,116,131,133,137,134,128,30,125,110,131,136,127,27,126,132,144,
+149,168,11,65,29,247,164,11,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,1,135,255,
+2,135,254,2,243,2,0,1,0,2,0,3,0,58,0,72,1,21,1,219,2,88,2,221,2,236,3,47,
+3,112,3,217,4,12,4,14,4,16,4,23,4,66,4,146,4,188,5,26,5,154,5,219,6,60,6,
+165,6,220,7,56,7,161,7,192,7,216,8,34,8,61,8,135,8,241,9,117,9,120,9,127,
+9,130,9,133,9,136,9,185,9,188,9,190,9,193,9,218,9,221,9,224,9,231,9,234,9,
+237,9,248,10,143,10,146,10,149,10,151,10,154,10,197,10,200,10,202,10,205,
+10,208,10,242,11,29,11,67,11,119,11,134,11,139,11,142,11,244,11,247,12,8,
+12,11,12,31,12,34,12,69,12,75,12,86,12,89,12,92,12,190,12,193,12,196,12,198,
+13,45,13,48,13,51,13,54,13,57,13,128,13,131,13,147,13,150,13,153,13,247,14,
+4,14,96,14,142,14,196,15,79,15,193,15,195,16,90,16,185,17,107,18,11,18,30,
+18,56,18,68,18,96,18,99,18,199,19,59,19,61,19,68,19,116,19,118,19,229,19,
+252,19,254,20,10,20,22,20,30,20,47,20,105,20,196,20,200,20,211,20,217,20,
+223,20,229,20,235,20,242,20,248,20,254,21,22,21,28,21,53,21,59,21,61,21,64,
+21,174,21,254,22,1,22,121,22,163,22,166,22,169,23,4,23,7,23,133,24,19,24,
+75,24,100,24,224,25,138,25,140,25,234,26,41,26,128,26,166,26,211,27,9,27,
+51,27,84,27,101,27,184,28,47,28,50,28,209,29,41,29,151,29,254,30,12,30,47,
+30,55,30,62,30,68,30,99,30,154,30,179,30,205,30,212,30,226,30,233,31,5,31,
+13,31,21,31,86,31,94,31,105,31,112,31,119,31,150,31,183,31,190,31,218,31,
+226,31,234,32,1,32,9,32,65,32,96,32,117,32,139,32,169,32,194,32,245,33,86,
+33,120,33,158,33,176,33,214,33,221,33,238,33,246,33,254,34,92,34,100,34,134,
+34,141,34,148,34,206,34,252,35,30,35,46,35,54,35,82,35,90,35,98,35,135,35,
+234,36,60,36,125,36,188,37,0,37,37,37,182,37,246,38,70,38,97,38,186,39,23,
+39,44,39,131,39,224,40,90,40,98,40,148,40,156,40,164,40,173,40,178,40,180,
+40,185,40,190,40,243,40,251,41,4,41,9,41,17,41,45,41,53,41,59,41,66,41,74,
+41,81,41,88,41,232,41,237,41,246,41,254,42,5,42,11,42,19,42,26,42,34,42,51,
+42,58,42,65,42,178,42,185,42,193,42,200,42,208,42,241,42,249,43,1,43,8,43,
+16,43,24,43,31,43,39,43,47,43,55,43,110,43,117,43,125,43,189,43,199,43,207,
+44,10,44,17,44,25,44,34,44,78,44,176,44,184,44,193,44,240,44,248,45,9,45,
+16,45,42,45,50,45,57,45,64,45,72,45,79,45,87,45,95,45,138,45,146,45,154,45,
+161,45,170,45,174,45,176,45,211,45,218,45,226,45,234,45,247,45,255,46,6,46,
+12,46,20,46,31,46,39,46,46,46,54,46,62,46,69,46,79,46,87,46,119,46,126,46,
+228,47,7,47,186,48,111,48,215,49,103,49,105,49,107,49,109,49,111,50,76,50,
+173,50,175,50,181,50,199,50,210,50,218,50,255,51,16,51,24,51,56,51,61,51,
+66,51,74,51,82,51,90,51,97,51,99,51,107,51,131,51,138,51,146,51,192,51,243,
+52,53,52,146,52,188,52,233,52,240,52,247,52,254,53,5,53,13,53,18,53,26,53,
+32,53,40,53,41,53,42,53,182,53,255,54,53,54,89,54,197,55,11,55,133,55,203,
+56,13,56,135,56,167,56,218,57,27,57,37,57,49,57,71,57,85,57,97,57,167,57,
+246,58,62,58,132,58,175,58,227,59,14,59,28,59,67,59,139,59,191,59,243,60,
+32,60,211,60,237,61,188,62,181,62,210,62,237,63,20,63,60,63,168,63,205,64,
+3,64,52,64,67,64,113,64,219,65,62,65,160,65,192,66,33,66,130,66,193,66,209,
+67,60,67,156,67,233,68,23,68,110,68,236,69,138,69,237,70,99,71,7,71,159,71,
+181,71,208,71,236,72,28,72,88,72,225,72,247,73,13,73,43,73,77,73,89,73,210,
+73,223,73,227,73,243,74,0,74,5,74,24,74,60,74,191,74,241,75,55,75,140,75,
+154,75,167,76,44,76,47,76,49,76,51,76,80,76,82,76,85,76,87,76,147,76,150,
+76,179,76,241,76,243,76,251,77,94,77,97,77,120,77,122,77,189,77,191,77,194,
+78,71,78,73,78,187,79,53,79,156,79,252,80,78,80,180,81,35,81,133,81,136,81,
+202,81,209,82,41,82,104,82,193,83,5,83,136,83,139,84,18,84,87,84,168,85,4,
+85,7,85,110,85,197,86,29,86,81,86,195,87,104,87,172,88,67,88,78,88,86,88,
+120,88,131,88,220,88,228,88,238,89,12,89,77,89,170,89,179,89,185,90,24,90,
+135,91,30,91,43,91,65,91,137,91,211,91,246,92,8,92,42,92,45,92,70,92,72,92,
+74,92,193,92,195,93,57,93,143,93,146,93,149,93,253,93,255,94,1,94,4,94,21,
+94,23,94,26,94,28,94,31,94,163,94,165,94,219,95,19,95,92,95,166,95,185,96,
+39,96,108,96,227,97,99,97,198,97,227,98,118,98,237,98,240,98,243,98,246,98,
+249,98,252,99,121,99,240,100,118,100,160,100,236,101,99,101,102,101,180,102,
+34,102,210,103,2,103,71,103,167,103,202,104,13,104,19,104,55,104,76,104,84,
+104,91,104,211,105,72,105,125,105,191,106,58,106,117,106,122,106,139,106,
+232,107,113,107,209,108,54,108,158,108,190,108,241,109,28,109,150,109,235,
+109,238,110,78,110,81,110,233,111,87,111,90,111,93,111,195,112,11,112,42,
+112,45,112,128,112,130,112,138,112,174,112,177,113,73,113,88,113,139,113,
+198,114,8,114,121,114,180,115,35,115,91,115,171,115,200,116,6,116,110,116,
+113,116,119,116,126,117,0,117,112,117,116,117,118,117,120,117,151,117,231,
+118,125,118,227,119,48,119,80,119,119,119,188,120,25,120,48,120,63,120,108,
+120,123,121,10,121,18,121,26,121,126,121,193,121,236,122,35,122,135,122,158,
+122,198,122,224,123,58,123,174,124,19,124,151,124,228,125,35,125,140,126,
+64,126,135,127,64,127,67,127,202,128,131,129,121,130,22,130,176,131,23,131,
+104,131,204,132,56,132,150,133,3,133,99,133,184,134,13,134,107,134,197,135,
+63,135,74,135,98,135,121,135,151,136,32,136,61,136,138,136,248,137,90,137,
+189,138,74,138,115,138,178,138,202,138,217,138,235,138,253,139,37,139,67,
+139,117,139,158,139,197,139,223,139,248,140,18,140,44,140,62,140,98,140,141,
+140,168,140,195,14,14,248,19,248,140,21,140,152,140,152,147,26,183,102,174,
+92,91,102,104,95,131,140,126,140,126,30,168,251,175,5,108,142,159,120,170,
+27,169,159,158,170,142,31,94,251,127,21,179,170,168,177,176,108,169,247,58,
+29,247,23,248,219,21,247,3,29,202,22,247,3,29,14,248,87,248,68,21,150,247,
+41,141,162,5,162,141,111,165,111,27,123,123,132,126,128,31,130,129,137,132,
+138,112,128,251,49,24,75,6,150,247,41,140,158,5,169,116,162,108,123,123,132,
+126,128,30,130,128,137,132,138,113,128,251,49,24,116,6,112,131,138,133,129,
+247,65,29,122,147,124,154,129,30,131,149,149,137,167,27,154,6,132,46,5,110,
+6,247,174,29,124,153,129,30,131,150,150,137,165,27,161,6,128,251,41,5,138,
+132,139,132,135,26,108,162,116,170,174,158,162,181,30,151,247,48,5,203,6,
+128,251,41,137,118,5,114,137,166,113,167,27,155,155,146,152,149,31,145,145,
+146,161,140,155,150,247,49,24,162,6,162,151,247,63,29,156,156,202,29,128,
+128,141,112,27,125,6,146,232,5,167,6,164,247,79,10,155,125,148,30,247,66,
+29,251,28,36,21,132,46,5,75,6,146,232,5,14,247,247,248,230,21,247,151,29,
+121,27,121,123,131,126,129,31,131,128,137,130,113,26,117,7,54,124,79,76,64,
+26,60,193,86,241,119,30,212,125,5,194,129,161,122,109,26,99,93,110,76,86,
+87,162,166,131,30,132,165,139,139,131,147,8,149,129,124,144,125,247,128,29,
+131,128,137,130,113,26,80,7,114,141,130,145,130,30,123,150,155,130,159,27,
+154,148,143,152,155,31,168,126,146,137,177,131,8,63,7,115,141,130,145,130,
+30,124,148,157,129,158,27,155,247,121,29,215,7,242,159,202,203,223,26,181,
+123,177,112,166,30,111,165,103,154,76,152,74,151,24,91,149,116,155,164,26,
+172,176,161,197,178,177,124,123,143,30,111,144,159,123,169,165,29,146,167,
+26,169,7,184,121,161,103,129,132,137,135,128,30,140,135,136,140,138,27,116,
+147,131,141,130,141,124,141,25,14,247,120,248,232,21,62,77,79,64,65,202,78,
+216,215,202,199,213,215,78,199,60,31,76,4,180,173,107,100,98,106,107,97,99,
+105,172,178,179,172,171,180,31,247,155,251,106,21,161,146,147,147,154,26,
+156,125,153,124,134,133,138,136,130,30,251,254,251,5,5,116,132,132,132,123,
+26,122,152,125,155,144,147,141,141,146,30,247,131,188,21,62,77,79,65,64,201,
+79,217,215,202,199,212,215,78,199,60,31,140,76,21,179,173,107,100,99,106,
+107,97,99,105,171,179,178,172,171,181,31,14,247,255,247,93,21,44,247,24,5,
+122,163,129,159,149,26,162,161,159,166,159,150,133,111,170,30,183,162,5,172,
+156,149,151,162,26,167,114,163,111,134,131,137,135,125,30,150,113,119,144,
+116,27,55,66,71,59,109,146,120,164,98,31,79,105,105,83,75,26,45,212,79,247,
+6,190,171,146,158,167,30,149,126,5,202,6,185,163,197,29,138,6,149,157,145,
+154,149,175,8,165,143,157,159,166,26,156,132,154,124,149,30,147,202,10,83,
+6,60,251,67,21,131,122,130,137,117,27,85,114,155,174,169,155,161,171,155,
+31,14,247,108,248,238,247,115,29,122,247,120,10,247,153,5,14,248,73,248,247,
+21,115,127,130,104,114,31,66,34,96,251,15,36,26,33,175,251,2,211,251,1,30,
+93,169,152,128,166,27,169,163,161,168,152,137,144,129,155,31,69,245,108,231,
+235,26,235,170,228,209,247,0,30,149,155,141,144,152,26,168,116,161,107,30,
+14,247,60,248,247,21,108,115,117,110,126,141,134,149,123,31,209,33,170,47,
+43,26,43,108,48,69,33,30,129,123,137,134,126,26,110,163,117,170,163,151,148,
+174,164,30,212,244,182,247,15,242,26,245,103,247,2,67,247,1,30,185,110,125,
+150,113,27,14,247,104,247,249,21,91,76,5,123,117,135,131,126,26,110,163,116,
+169,161,150,146,166,159,30,188,203,188,75,5,112,159,150,132,161,27,169,163,
+162,168,152,135,147,123,161,31,91,202,219,164,5,177,150,154,154,166,26,167,
+115,163,111,129,136,138,133,118,30,58,114,5,218,7,163,137,148,133,149,30,
+154,130,121,247,176,29,60,7,58,164,5,145,118,135,140,130,27,111,115,115,112,
+111,154,124,177,128,31,14,247,246,247,111,21,247,29,6,162,247,182,10,127,
+131,141,110,27,251,29,247,44,6,165,138,146,132,173,29,129,113,26,251,44,251,
+30,7,247,10,10,149,152,136,164,27,247,30,251,44,205,29,14,170,10,75,10,247,
+201,125,21,247,187,10,248,145,248,220,21,149,158,141,147,150,26,165,114,162,
+111,113,126,129,105,122,30,251,213,253,27,5,130,121,136,129,128,26,113,165,
+116,167,165,152,149,173,156,30,14,248,157,247,238,21,227,110,218,89,190,30,
+174,103,91,157,81,27,81,91,121,104,103,31,89,88,110,60,51,26,49,7,52,168,
+59,189,89,30,104,175,187,121,197,27,197,187,157,174,175,31,189,189,168,219,
+226,26,251,226,236,21,237,183,202,208,208,183,76,41,30,36,7,42,94,75,71,71,
+94,203,236,30,14,247,246,248,253,21,251,109,86,5,97,129,125,125,110,26,109,
+161,115,167,149,142,140,144,159,30,221,160,5,252,17,42,7,213,10,247,194,247,
+134,29,247,167,29,247,110,243,21,247,152,247,101,168,172,222,26,246,46,220,
+251,16,78,83,119,104,98,30,104,109,112,92,107,26,112,164,116,168,162,159,
+151,157,145,30,150,170,140,141,148,149,8,163,161,172,153,178,27,202,187,104,
+92,108,123,120,39,52,31,98,103,69,82,251,8,49,133,134,24,32,248,98,227,7,
+163,137,148,133,149,30,154,247,133,10,107,122,123,104,135,31,14,247,168,248,
+9,21,107,115,117,110,110,159,122,174,137,31,184,137,150,137,159,131,8,185,
+121,167,107,105,26,118,128,116,123,126,30,116,113,103,130,71,27,75,110,144,
+155,115,31,149,122,134,141,126,27,108,116,116,110,88,222,106,247,18,227,192,
+152,172,184,31,186,173,168,194,196,26,199,102,189,68,173,30,199,174,165,177,
+190,26,181,120,181,107,170,30,176,100,87,158,71,27,251,3,40,87,81,110,163,
+116,168,154,153,145,149,148,31,172,171,165,149,193,27,206,181,113,97,100,
+99,105,92,31,14,248,87,248,237,21,251,29,6,251,135,252,21,5,55,247,164,110,
+105,7,247,30,10,247,24,247,134,10,155,131,155,125,148,31,129,146,247,94,10,
+168,7,178,140,161,158,171,247,63,10,129,145,247,94,10,251,0,22,251,30,6,247,
+30,247,106,5,14,247,115,248,134,21,247,90,6,161,153,141,144,147,247,83,29,
+146,128,129,141,112,27,251,198,251,167,6,106,162,115,170,150,143,140,146,
+153,30,159,180,185,152,170,27,205,182,94,71,65,93,105,38,73,111,146,162,109,
+31,152,124,131,142,124,27,110,114,116,111,83,231,97,247,16,235,197,158,186,
+184,31,175,177,159,190,195,26,247,17,48,230,251,16,110,108,134,129,104,30,
+14,247,106,247,218,21,247,0,166,228,216,238,27,148,143,138,135,150,31,133,
+156,149,137,148,27,169,164,163,168,179,91,165,66,46,55,98,60,72,31,87,78,
+113,65,54,26,69,157,63,166,93,30,73,177,201,106,224,27,207,189,157,178,176,
+31,173,176,158,188,195,26,247,2,52,228,251,0,91,101,122,98,95,30,147,251,
+16,21,185,165,188,172,181,27,190,180,97,86,79,102,102,79,76,104,174,217,125,
+31,14,248,33,248,134,21,251,39,252,52,5,133,124,137,129,130,26,113,164,116,
+168,168,154,152,176,152,30,247,51,248,89,5,238,252,77,52,7,115,141,129,145,
+130,30,123,149,156,130,158,27,171,156,156,174,143,31,14,248,63,247,200,21,
+195,175,168,184,188,26,239,46,218,251,11,251,11,46,60,39,89,168,96,195,102,
+30,77,102,107,88,80,26,35,228,68,247,23,247,24,229,210,243,198,107,190,77,
+176,30,251,19,247,98,21,200,182,107,93,90,97,107,77,78,96,172,186,186,181,
+171,201,31,251,155,4,201,190,103,94,91,93,106,72,73,92,172,186,185,190,175,
+201,31,14,248,68,247,169,21,251,1,112,51,63,38,27,130,136,140,142,129,31,
+145,122,129,141,129,27,109,114,116,109,100,187,113,211,234,221,179,219,207,
+31,191,200,165,213,225,26,208,121,215,112,185,30,205,100,78,172,54,27,71,
+89,120,100,102,31,105,103,120,89,84,26,251,3,226,50,247,0,187,177,156,181,
+183,30,131,247,15,21,94,113,90,106,98,27,87,98,181,192,200,175,175,199,203,
+173,104,60,154,31,14,247,201,125,21,113,10,157,247,196,21,178,170,169,176,
+177,108,168,100,31,121,6,100,108,109,102,102,171,109,177,31,14,176,10,58,
+247,180,21,91,107,113,98,98,171,113,187,185,171,166,178,180,108,166,92,31,
+14,247,170,247,163,21,247,140,247,10,5,165,152,152,154,156,26,147,137,147,
+135,147,30,138,141,5,156,131,116,150,114,27,124,125,136,133,126,31,252,81,
+251,99,248,81,251,104,5,133,152,153,136,154,27,164,162,150,156,147,31,140,
+141,5,143,147,141,147,146,26,158,128,151,110,154,30,14,247,0,248,47,21,156,
+10,150,151,136,164,27,248,20,6,161,247,182,10,202,10,252,20,251,68,115,10,
+247,205,247,163,21,251,139,251,13,5,110,124,128,127,120,26,132,141,131,143,
+131,30,140,137,5,122,147,162,128,164,27,154,153,142,145,152,31,248,81,247,
+104,252,81,247,99,5,145,126,125,142,124,27,114,116,128,122,131,31,138,137,
+5,135,131,137,131,131,26,122,152,124,165,126,30,14,239,248,157,21,61,7,116,
+141,128,145,130,30,125,148,157,129,158,165,29,146,167,26,150,7,154,173,169,
+146,176,27,201,181,108,93,101,98,111,251,15,95,31,83,7,117,141,128,145,130,
+30,124,149,156,129,158,27,169,158,157,173,143,31,247,12,189,184,187,217,26,
+247,2,53,214,251,19,75,94,127,97,48,30,247,95,252,175,21,178,170,168,177,
+176,108,169,100,31,122,6,100,107,109,102,102,171,109,178,31,14,248,39,248,
+23,21,251,3,130,61,71,48,26,58,212,70,224,148,146,140,140,154,30,137,190,
+7,178,159,153,168,156,131,151,124,146,31,247,157,7,247,1,60,217,251,1,251,
+26,43,251,13,251,59,30,251,53,7,69,156,69,170,87,30,67,182,194,107,222,27,
+238,222,178,186,163,120,158,113,128,131,135,126,125,31,121,121,101,128,95,
+27,95,111,152,172,115,31,106,183,122,198,210,26,247,41,7,247,12,200,229,222,
+198,180,97,77,30,251,150,4,138,128,134,139,133,27,93,105,167,176,182,180,
+172,200,145,31,14,32,29,14,104,10,130,129,121,105,29,48,10,14,82,10,14,33,
+29,14,247,90,247,124,21,216,136,6,116,141,128,144,130,30,124,149,157,129,
+158,10,128,137,129,113,26,137,62,247,19,247,140,94,7,141,10,148,165,26,247,
+40,123,10,247,107,106,10,43,6,14,35,29,14,40,29,34,10,14,162,29,112,132,184,
+10,137,132,118,120,30,119,117,104,126,106,27,104,107,147,159,91,120,29,14,
+53,10,14,38,29,14,170,29,123,147,123,73,29,35,10,14,36,29,14,247,90,247,83,
+21,233,6,233,190,74,10,247,166,133,21,233,140,182,152,196,183,8,215,199,178,
+218,233,26,247,53,251,19,247,24,251,48,251,48,251,19,251,24,251,55,50,174,
+57,200,88,30,154,126,162,125,180,115,81,85,24,122,124,135,131,123,26,110,
+162,115,167,146,150,141,142,151,30,150,186,195,148,162,27,160,151,136,126,
+175,31,131,159,154,136,159,27,172,166,147,161,176,31,168,155,150,153,161,
+26,169,116,161,108,125,134,137,124,115,30,128,121,131,136,124,27,128,132,
+140,145,117,31,148,106,115,142,110,27,125,128,138,136,119,31,167,248,131,
+21,234,219,52,36,251,1,61,52,42,43,60,227,244,245,218,226,235,31,14,37,10,
+14,40,10,14,49,10,32,10,14,100,10,247,97,248,97,5,159,146,139,142,148,31,
+159,146,153,159,160,202,29,129,127,141,113,27,251,24,6,114,129,137,134,130,
+247,178,29,149,138,166,27,157,6,14,45,10,14,41,10,39,29,14,49,29,14,247,246,
+248,139,21,193,6,186,162,156,174,155,131,155,125,148,31,147,202,10,251,54,
+253,127,247,55,6,162,151,137,29,84,6,14,247,80,249,7,21,173,122,126,149,113,
+27,111,114,116,113,128,141,131,149,120,31,247,212,253,28,5,105,156,152,129,
+165,27,167,165,163,164,150,136,149,130,157,31,14,247,138,101,21,85,6,116,
+126,137,134,131,247,61,29,124,153,129,30,131,150,148,137,167,27,247,54,249,
+127,251,55,6,115,128,229,29,194,6,14,247,191,248,98,21,247,5,251,17,5,114,
+162,149,133,161,27,171,165,164,169,156,134,148,120,161,31,251,94,247,118,
+251,92,251,118,5,120,117,134,129,124,26,108,165,114,171,161,149,145,165,162,
+30,14,167,106,21,113,130,247,194,29,153,141,145,148,247,183,10,248,22,193,
+29,14,33,10,14,247,70,105,10,127,6,247,131,10,130,129,122,121,247,16,29,132,
+149,152,136,164,27,247,12,169,6,108,188,179,127,197,27,247,39,242,232,247,
+25,202,115,195,92,182,31,182,92,82,159,63,27,82,89,124,110,100,31,247,35,
+80,21,188,170,128,113,167,31,163,116,153,108,108,26,108,125,107,115,116,30,
+114,112,106,127,93,27,92,106,151,164,112,31,115,162,125,170,169,26,212,198,
+190,223,30,14,42,29,14,248,171,248,239,21,251,12,6,85,10,6,251,145,247,124,
+133,10,44,10,14,247,195,247,214,21,247,39,247,25,29,251,39,170,6,78,29,251,
+27,6,14,47,29,14,247,91,105,10,137,6,77,29,191,195,159,149,247,15,10,129,
+107,169,10,186,162,156,174,247,108,29,247,39,29,92,120,105,103,30,14,36,10,
+125,198,29,14,157,10,150,151,135,29,247,140,247,5,10,61,29,14,44,29,14,247,
+37,248,61,21,42,6,242,10,123,147,123,153,129,30,148,133,146,137,161,138,8,
+251,111,7,102,116,119,108,105,163,121,186,31,227,181,10,129,145,247,94,10,
+247,83,7,170,168,156,148,166,27,161,147,130,115,234,29,247,83,7,171,171,154,
+147,165,27,162,146,131,114,234,29,247,98,7,213,82,193,60,99,106,125,108,109,
+30,168,111,104,155,100,27,109,120,132,115,107,31,14,38,10,14,39,10,14,62,
+29,248,63,46,21,85,247,138,10,123,121,158,29,128,129,141,112,27,127,248,51,
+151,247,46,10,247,91,10,111,27,251,12,100,6,176,92,97,153,78,27,251,35,34,
+46,251,19,251,12,243,51,247,34,197,185,154,174,187,31,251,37,247,167,21,180,
+171,130,121,165,31,166,120,158,105,109,26,73,80,93,52,99,106,148,157,114,
+30,111,159,121,172,170,26,170,157,172,167,159,30,157,164,171,148,181,27,14,
+42,10,14,37,29,14,70,29,14,34,29,14,247,194,247,21,21,36,247,85,5,163,149,
+140,145,148,31,155,149,149,156,156,202,29,247,133,29,251,24,203,10,150,6,
+247,60,251,214,5,247,0,6,247,59,247,214,5,153,6,164,148,140,145,149,31,155,
+149,149,155,157,202,29,128,128,141,113,27,251,27,203,10,143,6,14,46,10,14,
+66,29,187,30,247,4,181,10,130,145,132,141,120,140,8,14,43,10,14,51,29,14,
+247,244,248,103,21,163,140,146,146,163,27,170,141,161,160,168,26,170,115,
+160,103,67,78,80,70,30,251,49,7,115,134,133,115,137,30,105,135,121,121,109,
+26,108,157,121,173,135,30,163,137,144,133,115,26,251,57,7,69,200,80,212,174,
+163,160,170,168,117,160,108,141,30,114,140,133,145,138,164,8,247,41,7,190,
+134,155,116,166,30,161,163,144,157,140,181,8,14,247,250,249,205,21,251,8,
+254,199,247,8,6,14,247,140,129,21,114,138,132,132,115,27,108,138,117,117,
+110,26,108,163,118,174,212,200,198,209,30,247,48,7,164,144,144,163,142,30,
+173,142,157,157,170,26,169,121,157,105,143,30,115,141,134,145,163,26,247,
+58,7,208,78,198,66,104,115,118,108,110,161,118,170,137,30,164,145,132,115,
+140,31,251,42,7,88,144,124,162,112,30,118,114,133,121,138,97,8,14,248,124,
+248,11,21,117,126,131,111,117,31,110,117,127,128,238,29,106,128,120,215,10,
+86,200,178,119,181,27,181,171,157,182,177,31,174,179,147,152,160,26,170,113,
+164,107,30,14,247,110,35,21,138,126,138,126,131,26,94,176,105,186,187,176,
+174,183,147,138,152,138,152,30,110,247,175,5,170,136,119,158,108,27,109,119,
+120,108,136,31,184,247,128,21,100,108,109,102,101,170,110,247,58,10,247,247,
+234,21,228,154,198,177,180,26,167,114,164,110,125,130,136,130,125,30,116,
+106,107,128,102,27,69,86,184,198,202,195,184,216,183,160,128,112,146,31,146,
+110,139,138,148,131,8,131,147,155,133,152,247,146,29,148,165,26,179,7,164,
+138,146,132,149,30,155,247,133,10,132,133,138,136,132,31,121,150,115,146,
+111,144,8,199,7,165,138,146,132,149,30,155,247,133,10,122,123,132,125,128,
+31,131,128,137,129,113,26,69,7,41,116,69,56,46,26,40,205,59,241,115,30,65,
+7,116,141,128,145,131,30,123,149,157,130,247,161,10,165,26,14,247,206,247,
+124,21,163,151,247,63,29,155,157,202,29,128,129,141,111,27,74,6,137,147,5,
+122,198,139,139,159,212,29,58,36,65,71,45,111,143,118,151,106,31,100,6,113,
+247,23,29,123,120,26,123,247,107,29,150,150,137,165,27,204,6,140,133,139,
+132,137,26,106,133,110,127,116,30,130,122,128,132,116,135,8,102,131,123,124,
+247,73,10,174,117,161,106,110,121,124,110,134,31,251,86,6,155,178,144,165,
+180,26,142,139,148,138,149,30,14,133,29,247,193,247,235,21,52,247,10,5,161,
+146,153,158,162,26,155,247,62,10,131,141,109,27,47,6,247,174,29,124,153,129,
+30,150,132,148,137,165,138,247,24,251,74,24,75,6,116,127,129,119,119,152,
+128,161,31,232,114,46,247,139,29,232,113,97,6,247,173,10,123,153,130,30,132,
+149,154,136,162,27,247,86,6,185,163,156,174,155,131,155,125,148,31,147,127,
+131,141,111,27,96,165,232,247,33,10,46,164,232,6,161,152,150,159,158,127,
+150,116,31,75,6,247,25,247,74,5,183,162,157,173,155,131,155,125,148,31,147,
+202,10,48,6,112,247,23,29,122,121,26,117,154,120,162,132,30,14,247,250,248,
+29,21,184,7,181,170,172,177,157,154,136,134,154,30,134,151,145,138,146,27,
+168,162,163,169,179,93,162,61,41,59,61,42,31,91,86,7,112,131,244,10,166,27,
+192,251,115,6,91,109,106,95,122,127,141,145,121,30,143,124,137,140,132,27,
+111,115,115,111,99,186,115,218,240,217,219,243,31,247,115,192,7,163,151,141,
+144,247,52,29,127,131,141,110,27,14,248,63,248,106,21,108,7,101,155,120,171,
+155,154,146,151,148,30,146,148,140,145,162,26,247,17,251,121,7,85,102,125,
+106,107,31,111,111,124,103,101,26,130,140,134,142,128,30,76,122,102,97,82,
+26,83,174,101,240,83,30,245,81,5,208,102,173,109,116,26,115,109,117,106,30,
+251,33,172,6,177,123,157,107,107,123,120,102,30,251,17,247,127,7,193,174,
+153,172,170,31,165,166,152,170,174,26,150,138,146,136,154,30,203,153,176,
+182,198,26,201,107,172,251,10,202,30,47,188,5,69,177,104,168,161,26,165,168,
+160,176,30,221,251,158,21,198,107,175,107,118,26,120,122,131,100,30,122,153,
+124,149,86,170,36,195,24,81,171,113,164,161,26,158,157,149,175,30,179,110,
+146,134,172,121,8,14,247,18,248,9,21,121,106,133,116,105,26,105,145,116,157,
+105,30,109,109,5,116,116,135,132,121,26,110,164,115,169,158,146,143,162,163,
+30,169,167,5,122,175,163,133,175,27,174,163,145,156,174,31,171,110,5,117,
+162,147,135,157,27,170,164,163,168,156,134,148,117,161,31,108,168,5,158,174,
+145,162,173,26,172,133,162,121,173,30,168,168,5,162,160,143,147,157,26,168,
+115,162,108,120,132,135,117,115,30,111,113,5,158,102,115,145,103,27,103,115,
+133,120,103,31,108,167,5,161,116,131,143,121,27,109,114,116,110,125,150,120,
+155,123,31,247,96,108,21,189,179,100,92,90,99,99,89,90,98,179,187,187,179,
+178,189,31,14,247,123,248,219,21,247,152,10,161,149,150,166,142,31,171,247,
+139,5,14,247,125,193,29,247,25,247,96,247,114,10,148,133,154,27,158,155,153,
+156,145,138,146,136,146,31,14,247,73,247,104,127,29,220,247,24,127,29,14,
+247,73,247,104,247,49,29,118,128,247,47,10,156,141,138,150,27,160,155,153,
+158,149,134,146,127,150,31,14,120,10,14,247,91,247,214,21,103,29,105,7,112,
+131,138,133,129,160,29,131,150,150,137,166,27,173,251,111,101,6,112,150,10,
+105,163,121,186,30,247,67,237,29,130,141,111,27,110,6,247,214,247,214,21,
+251,16,247,13,10,121,26,123,147,124,153,128,30,132,150,149,137,166,27,155,
+251,111,105,6,112,150,10,105,163,121,186,30,247,66,95,10,107,6,122,248,136,
+21,251,18,251,0,247,18,6,14,247,88,247,214,21,168,6,163,150,247,191,29,172,
+6,164,153,155,161,150,145,138,132,163,30,135,152,148,137,147,27,156,153,147,
+155,150,31,148,132,148,137,155,138,8,169,252,32,105,6,112,183,29,105,163,
+121,186,30,247,67,172,10,106,248,135,251,26,6,114,124,132,121,129,31,155,
+110,102,148,98,27,62,78,75,58,31,107,106,7,112,131,138,133,129,160,29,131,
+150,150,137,166,27,172,251,111,100,123,29,247,68,237,29,129,141,112,27,110,
+6,14,75,10,86,10,251,234,205,10,14,86,10,101,53,6,115,128,137,134,130,159,
+10,131,150,148,137,167,27,225,251,94,6,116,141,128,145,131,247,41,10,147,
+166,26,247,94,224,7,165,247,79,10,154,124,201,10,54,6,14,121,29,248,111,248,
+118,21,169,6,178,158,153,166,166,120,153,100,31,251,89,6,251,35,140,251,11,
+60,141,46,8,95,7,136,55,238,62,247,17,128,8,251,153,64,7,118,132,138,134,
+131,31,126,131,131,126,125,26,112,158,125,177,30,247,29,6,163,149,145,159,
+148,31,121,147,153,131,157,27,232,6,178,158,152,167,166,120,153,100,31,107,
+6,55,248,202,21,252,204,7,130,134,136,135,134,131,134,148,135,142,129,145,
+8,248,203,7,14,247,188,248,89,21,56,73,73,55,56,205,72,221,220,205,206,222,
+221,73,207,59,31,14,170,10,247,48,247,28,21,207,29,197,22,207,29,14,247,48,
+248,219,21,206,10,197,22,206,10,14,120,10,57,251,24,127,10,14,247,1,125,21,
+113,10,247,110,22,113,10,247,110,22,247,187,10,248,105,248,0,21,160,146,147,
+147,154,26,156,126,153,123,134,137,139,135,127,30,252,1,251,5,5,118,133,131,
+130,124,26,122,152,124,154,145,141,139,144,151,30,151,247,238,98,29,237,251,
+209,98,29,247,162,195,98,29,14,248,136,251,51,21,217,7,162,137,150,133,147,
+247,41,29,132,111,26,128,7,124,105,109,132,103,27,76,97,170,185,178,174,163,
+247,21,186,31,195,7,162,137,149,133,148,30,154,129,121,149,121,27,109,120,
+121,105,135,31,251,13,88,95,92,61,26,251,2,225,64,247,19,202,185,151,181,
+230,30,251,95,248,175,21,100,108,110,101,102,170,109,247,58,10,247,88,139,
+10,248,91,248,232,165,10,144,150,153,30,14,247,193,248,214,67,10,248,89,249,
+14,88,29,247,70,248,241,65,10,247,52,249,44,72,29,247,192,249,12,104,29,14,
+247,88,249,12,55,29,247,192,249,82,144,29,247,150,147,21,33,76,29,179,129,
+167,27,204,185,179,195,189,114,169,89,150,31,179,7,14,247,186,248,231,62,
+10,247,220,147,21,79,102,117,108,89,98,10,154,151,161,155,155,31,156,156,
+152,148,190,172,8,14,247,193,248,204,56,10,111,29,52,29,14,247,242,247,163,
+21,228,6,174,158,154,165,167,121,153,102,31,137,247,10,6,205,86,177,48,103,
+90,131,127,106,30,121,133,130,127,121,26,116,158,120,161,146,150,141,142,
+151,30,147,174,158,142,164,27,177,154,133,123,31,135,7,143,113,126,140,120,
+27,70,92,123,103,106,31,121,120,128,115,117,26,86,197,96,213,177,167,144,
+154,177,30,230,4,122,110,101,128,108,27,116,123,146,149,159,175,157,177,159,
+152,138,134,169,31,14,161,10,129,29,192,251,44,6,37,83,5,106,121,130,128,
+116,26,111,164,114,166,152,150,143,150,159,30,187,166,5,52,86,7,113,150,10,
+105,163,121,185,30,248,112,247,78,227,10,129,113,26,56,251,99,247,23,7,247,
+27,215,5,171,157,148,150,163,26,166,115,163,112,127,125,134,130,122,30,57,
+93,5,14,70,10,14,248,6,247,124,21,150,6,105,141,160,119,170,27,155,155,147,
+152,150,31,147,150,141,148,165,26,213,7,165,138,146,132,149,30,155,247,133,
+10,108,121,121,104,135,31,128,247,19,247,11,81,205,10,247,53,251,230,7,251,
+57,251,10,251,9,251,57,251,56,247,10,251,10,247,57,31,247,249,247,12,6,165,
+138,146,133,173,29,130,112,26,122,251,31,7,251,0,22,96,115,145,155,112,31,
+89,169,105,202,203,26,197,169,200,182,170,30,168,159,168,147,186,140,8,14,
+247,193,248,212,21,44,60,66,51,53,216,71,236,235,217,207,223,230,62,211,42,
+31,57,4,186,179,103,97,99,99,106,92,93,98,173,176,183,178,175,187,31,14,53,
+29,14,36,10,14,247,246,248,239,21,251,71,6,113,130,137,134,129,247,178,29,
+151,137,165,27,210,251,43,6,58,96,5,109,123,128,124,117,26,111,163,114,167,
+151,149,143,149,159,30,167,155,5,251,18,251,10,7,113,183,29,105,163,121,185,
+30,247,236,106,10,251,10,247,60,6,222,185,5,170,155,149,152,162,26,168,115,
+164,111,125,132,136,127,117,30,110,122,5,14,72,10,14,248,252,247,55,21,186,
+7,209,119,198,103,178,30,178,103,96,159,94,27,86,92,113,92,106,31,187,103,
+93,164,88,27,35,58,38,251,22,251,15,222,41,242,189,186,163,182,174,31,95,
+172,185,116,194,27,181,203,152,155,174,31,168,153,149,153,163,26,169,115,
+163,110,130,131,137,136,131,30,115,83,128,136,111,27,99,113,164,189,126,31,
+251,84,247,62,21,182,175,84,73,69,104,85,94,96,103,194,206,207,175,194,183,
+31,247,87,59,21,195,152,159,163,172,27,171,160,114,84,151,31,14,230,247,176,
+21,251,73,127,247,78,29,123,148,122,152,130,247,64,10,247,12,248,80,6,175,
+163,158,184,183,169,116,105,124,130,124,125,130,30,128,132,132,138,113,136,
+8,103,135,119,121,109,26,109,158,122,179,135,30,190,134,169,127,165,115,8,
+165,116,153,108,105,26,95,122,111,113,125,130,147,155,136,30,172,131,125,
+151,110,27,106,118,116,102,74,191,92,210,185,177,154,166,165,31,170,173,157,
+188,190,26,220,98,207,65,182,30,163,168,147,160,175,26,232,61,209,35,35,66,
+80,56,30,67,127,247,158,10,121,26,123,148,123,152,129,247,64,10,14,247,226,
+248,252,21,251,24,106,5,114,133,130,130,121,26,120,153,124,156,145,141,139,
+143,151,30,187,151,5,251,121,82,7,109,125,128,118,118,154,127,168,31,247,
+73,6,167,154,151,160,160,125,150,110,31,82,6,14,248,118,248,25,21,251,85,
+7,119,148,128,156,156,148,150,159,30,247,136,252,70,7,247,126,10,247,95,130,
+21,134,160,149,138,158,27,189,188,149,161,189,31,122,242,7,161,154,141,145,
+148,31,157,149,149,157,158,26,172,117,159,100,141,30,247,210,251,35,7,113,
+129,137,133,129,31,122,129,128,121,120,26,122,148,122,154,129,30,131,150,
+152,136,165,27,166,251,67,6,104,78,99,126,97,27,98,124,152,175,31,247,176,
+251,16,7,123,6,107,113,115,108,122,148,122,154,129,31,131,150,152,136,165,
+27,147,252,28,6,247,105,29,158,156,147,154,150,31,148,150,141,149,165,26,
+14,247,55,248,129,21,176,90,6,111,150,125,160,160,150,153,167,30,247,6,251,
+157,251,6,7,111,150,125,160,160,149,153,167,30,188,176,251,104,116,7,111,
+126,128,118,117,153,128,165,31,247,3,6,166,153,150,161,160,126,150,111,31,
+116,6,247,103,247,36,21,199,251,22,5,153,6,195,247,21,5,251,35,7,122,138,
+139,137,133,31,128,135,131,126,126,26,117,153,128,165,30,199,6,165,153,150,
+161,158,128,150,117,141,31,247,105,7,159,142,148,150,157,26,161,126,149,111,
+30,71,6,90,251,19,89,247,19,5,73,6,111,126,129,117,121,149,128,158,136,31,
+251,105,7,116,137,128,128,120,26,117,153,128,166,30,198,6,165,153,150,161,
+161,127,149,108,31,14,68,29,247,54,249,16,82,29,247,189,247,78,148,29,247,
+109,104,21,247,25,247,14,158,164,188,26,206,86,188,66,104,106,127,118,116,
+30,118,120,124,110,119,26,122,154,125,156,152,150,147,150,143,30,146,158,
+139,139,144,145,8,154,151,158,147,160,27,174,166,118,111,113,119,118,251,
+51,251,33,31,129,130,5,73,247,149,194,7,166,129,153,118,121,129,128,119,136,
+30,14,247,246,247,207,21,247,29,6,162,152,141,144,148,247,178,10,130,141,
+110,27,251,29,247,10,6,164,138,147,132,173,29,128,114,26,251,10,251,30,7,
+113,131,138,133,129,160,29,132,150,151,136,164,27,247,30,48,205,29,251,138,
+251,13,115,10,247,91,247,26,21,233,6,243,191,155,182,181,31,162,163,152,172,
+172,26,172,126,171,116,163,30,182,97,87,155,35,27,45,169,234,6,164,149,247,
+63,29,155,157,26,174,115,156,93,30,251,106,6,118,124,137,134,131,247,61,29,
+123,153,130,30,131,150,148,137,167,119,10,247,26,4,230,247,19,7,203,166,126,
+106,107,112,126,75,31,14,248,181,247,233,111,10,251,208,248,29,82,29,247,
+202,247,78,21,143,146,143,154,241,10,251,124,252,71,5,133,128,136,130,247,
+141,10,149,30,14,112,29,251,84,251,53,21,92,107,112,99,98,171,112,185,187,
+171,165,180,181,108,165,91,31,247,247,4,92,107,112,99,98,171,112,186,186,
+171,165,180,181,108,165,91,31,14,247,250,248,168,21,159,138,145,136,149,30,
+158,131,116,154,116,186,29,173,163,163,175,31,149,7,251,116,4,163,137,149,
+133,149,30,155,128,120,149,119,186,29,158,156,147,154,150,31,147,149,142,
+150,165,26,14,247,192,248,213,21,40,59,62,44,44,219,61,236,240,219,215,236,
+234,59,216,40,31,73,4,200,188,92,79,82,89,90,80,77,90,186,199,198,188,186,
+200,31,14,247,42,29,247,18,33,233,251,34,79,97,125,103,92,31,247,108,251,
+12,7,247,12,29,150,149,137,166,27,151,252,229,85,29,247,10,248,121,79,29,
+248,42,251,36,111,10,133,247,158,141,29,247,145,247,195,21,247,43,247,15,
+160,163,189,26,204,83,189,64,102,105,127,118,114,30,118,120,123,110,119,26,
+122,154,125,157,153,152,147,150,143,30,145,158,140,139,144,145,8,154,152,
+159,147,162,27,176,167,118,111,113,117,118,251,68,251,33,31,128,130,5,73,
+247,172,194,7,166,128,153,116,120,128,128,119,136,30,14,247,165,247,126,21,
+149,6,168,126,174,86,152,91,8,182,6,169,157,153,163,160,126,153,114,142,31,
+119,172,132,148,118,157,8,176,159,160,169,174,26,200,86,182,61,30,46,6,107,
+122,126,114,116,154,126,167,137,31,251,65,7,112,138,123,125,116,26,115,157,
+125,170,30,207,6,169,157,153,163,162,124,152,112,141,31,247,5,4,199,160,7,
+169,159,128,123,121,117,124,111,31,144,247,162,247,27,10,247,67,247,31,247,
+23,247,58,247,55,251,31,247,25,167,10,112,29,14,248,55,248,192,21,155,147,
+148,151,152,26,159,124,154,119,129,126,136,133,127,30,64,101,92,159,115,149,
+137,140,25,147,114,123,142,125,27,116,119,121,118,124,149,127,157,133,31,
+145,138,145,137,144,137,8,140,146,136,135,149,31,152,133,96,116,5,117,127,
+135,134,124,26,117,154,122,158,149,143,140,149,159,30,229,186,178,118,187,
+100,171,102,25,167,86,113,146,93,27,251,31,251,2,39,251,17,251,15,247,9,41,
+247,37,210,209,164,183,189,31,188,181,161,192,217,26,247,19,82,236,251,17,
+224,30,59,251,94,21,223,207,83,68,105,128,117,110,115,31,113,108,101,126,
+95,27,56,71,192,204,211,206,195,224,31,14,247,192,247,90,21,239,44,5,117,
+162,148,134,156,27,170,163,162,168,156,133,149,117,160,31,40,234,238,235,
+5,161,159,145,149,156,26,168,115,162,108,122,130,134,118,116,30,39,43,39,
+235,5,159,117,129,145,122,27,108,115,116,110,121,144,131,162,118,31,239,43,
+39,44,5,117,118,133,129,122,26,110,163,116,170,156,148,144,161,162,30,14,
+247,178,248,103,21,120,124,126,120,121,152,127,160,138,31,166,138,146,138,
+150,134,8,166,128,156,118,119,26,106,108,122,78,100,122,142,148,124,30,146,
+129,135,140,131,27,120,125,125,120,107,189,119,217,189,173,147,158,166,31,
+167,159,157,172,172,26,176,116,171,98,160,30,175,161,154,163,170,26,200,86,
+183,65,72,79,107,104,121,154,124,157,148,148,143,145,145,30,159,158,154,145,
+172,27,177,164,123,115,115,115,119,112,31,14,247,23,247,152,21,54,212,76,
+237,214,205,175,179,160,121,156,117,129,130,135,131,130,30,117,117,128,135,
+100,27,82,103,168,183,31,172,7,188,173,173,188,171,167,125,123,142,30,113,
+144,151,127,161,27,165,153,155,169,31,190,7,171,127,154,114,125,129,134,127,
+133,30,151,112,117,144,111,27,48,70,71,49,31,247,60,247,176,247,27,10,247,
+68,247,30,247,23,247,58,247,56,251,31,247,24,167,10,32,29,247,8,247,202,238,
+10,123,126,131,247,55,10,32,29,126,247,183,247,50,10,152,135,146,123,151,
+31,134,143,251,46,247,130,29,117,121,136,135,125,26,118,157,122,159,150,247,
+94,29,32,29,251,10,247,239,63,29,32,29,54,248,6,146,29,32,29,125,142,10,14,
+32,29,247,31,247,239,21,127,123,129,124,128,31,107,115,247,37,29,107,109,
+122,108,113,31,121,119,131,122,126,125,10,247,233,126,21,204,142,187,151,
+76,10,140,251,19,232,40,247,32,116,8,49,7,141,158,143,139,145,27,168,156,
+128,122,126,128,132,118,122,118,145,148,122,31,150,119,247,17,10,176,27,201,
+185,180,194,247,106,29,33,29,247,115,249,10,238,10,121,125,132,128,126,26,
+118,158,121,161,150,146,142,152,156,30,14,41,29,233,248,247,247,50,10,151,
+135,146,126,149,31,136,142,137,141,136,220,29,143,148,151,30,14,41,29,128,
+249,47,63,29,41,29,154,249,70,21,152,123,133,188,29,247,5,29,34,10,240,249,
+10,50,10,34,10,86,248,247,188,10,152,135,147,126,148,31,135,142,135,142,138,
+247,160,10,120,137,137,124,247,88,29,34,10,251,50,249,47,63,29,34,10,251,
+24,249,70,146,29,35,10,247,166,249,47,21,124,138,127,131,125,119,8,111,118,
+247,113,29,88,121,146,115,27,109,109,123,110,113,31,121,117,130,122,125,26,
+120,154,125,158,151,148,144,149,147,30,176,169,145,144,156,246,10,166,147,
+153,154,26,156,125,151,116,141,30,14,36,29,247,18,247,150,143,10,36,29,140,
+247,131,247,50,29,153,171,29,36,29,35,247,187,63,29,36,29,64,247,210,146,
+10,36,29,247,52,247,187,21,126,125,129,119,124,31,112,118,247,37,29,108,110,
+124,110,114,31,120,117,129,121,125,125,10,247,206,249,85,247,70,29,119,247,
+55,29,163,159,140,140,154,26,160,121,156,118,129,130,135,130,128,30,236,251,
+176,58,10,14,32,10,32,248,169,143,10,32,10,251,124,248,150,247,50,29,151,
+135,146,126,149,31,136,142,136,141,136,141,251,45,247,17,24,224,29,32,10,
+251,229,248,206,63,29,32,10,251,200,248,229,146,10,39,29,214,249,10,21,158,
+154,145,147,153,26,161,121,156,116,126,134,136,126,122,225,29,39,29,251,50,
+249,47,63,29,49,29,251,14,248,238,21,251,3,229,5,148,127,130,143,129,27,118,
+121,122,118,127,143,131,155,128,31,140,137,141,138,142,137,247,47,251,16,
+24,247,45,247,16,5,165,160,139,139,247,128,10,129,135,130,128,30,14,33,10,
+176,248,55,21,158,247,177,10,251,26,33,5,122,125,132,129,125,26,118,158,122,
+161,150,149,144,150,152,30,14,33,10,45,248,37,166,29,136,124,26,118,157,122,
+160,149,147,142,149,152,30,14,168,10,71,128,122,88,30,115,131,127,125,117,
+26,109,90,29,251,92,248,91,55,29,33,10,251,69,248,115,21,152,124,132,247,
+181,29,128,153,149,134,150,27,161,158,157,159,153,133,149,120,153,31,14,33,
+10,43,248,161,245,29,175,169,112,107,106,109,112,103,104,109,166,172,171,
+169,166,174,31,14,33,10,200,248,93,21,127,123,129,124,128,31,106,115,136,
+136,126,27,127,127,144,158,106,31,168,90,119,147,116,27,109,109,124,111,114,
+31,120,117,129,120,124,247,116,10,179,171,145,144,156,172,29,247,238,124,
+21,194,141,176,145,178,151,8,194,157,176,173,172,26,167,114,163,110,110,29,
+212,7,165,138,148,133,148,30,153,131,120,148,119,27,119,128,131,120,132,31,
+157,101,90,247,60,10,251,11,223,57,247,26,126,31,54,7,141,156,139,139,144,
+27,174,156,130,120,126,128,132,118,123,117,145,148,122,31,150,120,247,17,
+10,175,27,201,185,180,194,189,114,169,90,150,31,14,78,10,93,27,55,90,156,
+29,247,232,4,247,148,10,128,247,156,29,126,132,127,126,26,119,158,121,161,
+149,149,144,150,153,30,14,78,10,94,27,54,90,162,192,247,31,29,251,20,247,
+214,247,49,10,153,136,144,117,156,31,251,45,247,130,29,116,247,124,10,142,
+149,152,30,14,122,10,117,49,112,134,94,27,55,90,156,29,251,126,248,12,55,
+29,78,10,93,27,55,90,156,29,251,106,248,36,21,152,123,132,142,128,247,177,
+29,128,153,149,134,149,27,161,158,157,159,152,132,151,122,152,31,14,36,10,
+198,248,129,143,29,36,10,69,223,29,136,141,136,141,137,220,29,142,149,151,
+30,14,36,10,251,67,248,165,55,29,36,10,251,37,248,189,144,10,247,91,92,29,
+190,190,162,151,188,27,197,112,10,247,139,247,142,21,125,137,126,131,128,
+124,8,106,115,136,136,125,247,118,10,115,27,109,109,123,110,114,31,120,117,
+130,121,125,26,120,154,125,159,150,148,144,149,147,30,176,168,146,145,155,
+27,154,147,136,122,165,31,112,183,173,125,163,27,169,163,153,172,167,31,161,
+166,147,153,155,26,156,125,150,116,142,30,14,39,10,247,27,247,154,143,29,
+39,10,142,247,136,21,247,1,48,247,136,10,160,151,135,147,126,148,31,135,142,
+136,142,137,247,160,10,121,137,135,125,247,88,29,39,10,37,247,190,55,29,39,
+10,60,247,214,144,10,39,10,247,54,247,192,21,126,124,129,120,125,31,110,118,
+136,136,125,247,53,29,123,110,113,31,120,118,130,120,125,26,121,154,124,158,
+151,148,144,149,147,30,176,168,147,145,154,27,154,146,136,122,166,31,112,
+183,173,235,10,247,203,248,204,247,51,10,127,143,131,152,129,31,148,132,247,
+47,251,16,247,45,247,16,5,162,157,142,143,154,26,160,121,156,118,129,130,
+135,129,127,30,229,251,180,61,10,14,34,29,46,248,129,21,159,154,144,147,153,
+26,161,121,156,116,127,132,183,10,128,126,26,119,158,121,161,149,149,144,
+150,153,30,14,34,29,251,110,223,29,131,145,247,17,29,159,150,247,94,29,34,
+29,251,215,248,165,55,29,118,10,149,152,83,29,251,189,248,189,21,152,123,
+133,188,29,247,149,10,156,160,153,133,148,120,154,31,14,43,10,248,24,247,
+166,46,29,43,10,247,21,247,202,55,29,51,29,251,5,248,101,247,51,10,124,142,
+135,162,121,31,247,47,251,16,247,45,247,16,5,164,159,140,141,247,128,10,130,
+135,129,127,30,14,247,112,248,152,21,72,6,106,123,127,115,122,154,123,157,
+137,31,144,251,11,6,111,122,126,116,116,156,126,171,31,209,6,171,156,151,
+163,162,124,151,109,140,31,231,7,165,167,154,147,165,27,173,153,129,116,31,
+46,7,116,137,124,125,119,26,115,156,127,171,30,195,6,171,156,151,163,157,
+124,155,121,140,31,134,140,5,234,7,202,92,179,68,112,112,131,126,122,30,133,
+134,5,14,248,116,22,159,155,231,29,110,247,110,103,29,251,41,173,7,149,29,
+125,7,247,189,29,150,137,165,27,153,251,110,121,6,113,131,137,247,106,10,
+122,121,151,29,247,28,6,174,151,144,156,152,31,122,153,151,134,174,27,251,
+23,243,21,247,110,247,41,251,110,121,7,106,125,134,122,125,31,156,126,125,
+144,106,27,14,248,159,242,21,247,214,251,65,173,7,161,155,157,159,149,151,
+137,133,155,30,134,156,143,138,149,27,168,163,247,72,10,111,118,134,125,116,
+31,152,108,110,145,105,27,61,77,75,60,101,10,251,186,22,247,97,29,157,158,
+147,147,138,136,150,247,4,10,248,159,242,21,248,135,251,26,7,105,120,135,
+124,114,31,152,108,110,145,105,27,61,77,76,59,101,10,251,13,247,214,21,74,
+173,6,161,155,158,158,148,145,138,135,154,30,251,65,252,28,21,247,97,29,158,
+158,147,146,138,135,151,247,4,10,248,186,247,52,21,163,161,151,167,170,26,
+201,88,187,74,74,88,91,76,109,151,112,163,116,30,113,247,11,10,59,247,18,
+21,168,159,120,112,110,119,120,110,110,119,158,167,167,159,158,168,31,251,
+51,4,247,29,10,251,197,248,145,82,29,247,196,247,78,141,29,248,92,248,145,
+220,10,131,135,126,133,247,15,29,34,248,47,79,29,248,47,251,217,221,29,125,
+247,130,10,211,176,29,251,51,4,247,12,10,248,91,248,145,21,142,145,144,155,
+241,10,251,124,252,71,5,135,131,135,126,133,247,15,29,247,220,225,221,29,
+124,247,130,10,212,176,29,138,251,51,21,168,164,114,110,113,118,123,106,108,
+117,156,163,169,163,164,168,31,252,3,248,71,21,234,6,168,154,150,161,160,
+125,150,109,31,251,54,251,60,6,119,152,124,156,144,142,140,143,147,30,151,
+161,162,146,156,27,173,161,112,98,94,117,121,85,105,124,143,153,124,31,146,
+130,136,141,130,27,123,126,125,121,105,189,113,207,191,174,151,166,161,31,
+158,161,150,172,174,26,215,90,194,73,124,123,136,134,121,30,14,247,122,248,
+196,21,51,251,143,5,137,130,137,132,134,26,122,155,125,195,10,247,245,88,
+148,29,247,220,225,21,163,162,151,166,170,26,201,89,187,74,73,89,91,76,109,
+151,112,162,116,30,113,247,11,10,60,247,1,10,138,251,51,21,247,12,10,248,
+69,248,90,21,186,120,188,108,171,30,161,117,112,150,104,27,105,112,128,117,
+117,31,108,107,120,90,92,26,76,7,92,158,90,170,107,30,118,160,168,127,172,
+27,173,168,151,160,160,31,170,171,158,188,186,26,251,92,202,21,194,168,180,
+176,178,167,98,84,30,76,7,84,110,98,102,101,110,180,194,30,14,248,28,248,
+241,247,38,10,129,117,118,154,128,167,31,218,6,168,154,150,160,158,125,151,
+116,210,29,14,247,147,248,176,21,247,10,6,167,154,150,161,161,125,149,110,
+31,251,77,251,59,6,118,153,124,159,145,142,140,143,148,30,152,168,160,145,
+159,27,178,164,113,97,94,114,121,77,100,122,143,153,121,31,146,129,135,141,
+130,27,120,124,125,121,105,195,113,212,199,177,151,166,164,31,160,162,151,
+171,174,26,215,84,194,64,122,119,136,134,120,30,14,247,141,248,83,21,150,
+174,150,156,163,159,8,159,163,169,150,168,27,145,141,139,136,145,31,135,148,
+146,137,145,27,157,154,154,157,164,110,155,95,91,99,123,106,101,31,92,97,
+118,94,74,26,251,11,188,74,230,215,187,184,210,210,86,196,72,112,118,132,
+119,112,30,146,41,21,175,155,166,163,163,27,168,164,110,105,107,118,120,104,
+101,123,153,179,128,31,14,247,249,248,176,21,51,251,143,5,137,131,137,131,
+134,26,123,155,124,195,10,14,248,25,248,61,21,164,161,153,167,169,26,201,
+83,187,67,66,83,91,77,108,153,112,164,117,30,111,117,123,108,106,26,74,192,
+95,219,220,192,182,205,172,123,170,111,161,30,49,247,17,21,176,164,120,112,
+110,114,120,102,103,114,159,166,167,164,158,175,31,251,51,4,175,170,114,110,
+113,113,123,98,100,112,156,163,169,169,164,175,31,14,248,14,248,34,21,128,
+104,129,123,114,118,8,119,115,110,128,109,27,133,137,139,142,134,31,144,128,
+134,140,133,27,120,124,124,121,114,168,123,184,186,179,155,172,177,31,186,
+181,160,185,204,26,247,10,89,204,49,63,91,94,69,68,192,82,205,167,160,146,
+158,166,30,133,237,21,104,123,111,115,115,27,110,114,168,172,172,160,157,
+175,176,155,126,98,151,31,14,247,106,248,97,21,169,6,163,150,247,63,29,155,
+157,202,29,202,10,251,60,6,112,132,138,133,247,179,29,150,137,165,27,169,
+251,250,109,247,13,10,122,151,29,247,60,181,10,147,128,130,140,111,27,109,
+6,247,155,247,250,21,252,42,7,95,136,132,119,120,30,119,118,103,125,107,27,
+110,106,146,154,99,31,144,126,127,142,132,27,114,114,114,112,122,147,124,
+153,129,31,119,170,216,120,195,27,193,196,159,174,180,31,188,179,156,176,
+203,26,248,156,251,53,7,129,29,14,32,29,251,30,248,14,89,10,247,249,248,200,
+21,96,10,247,125,6,180,29,193,6,247,198,29,177,180,193,168,31,176,159,149,
+152,163,247,63,10,128,146,130,141,112,140,8,251,79,247,42,21,251,37,6,212,
+247,61,5,14,48,10,248,62,248,64,50,10,48,10,247,164,248,36,84,29,48,29,247,
+163,248,101,163,29,14,82,10,155,63,10,68,29,33,29,242,63,10,33,29,241,140,
+29,248,168,248,200,21,252,89,6,128,10,247,251,6,92,107,118,106,94,98,10,154,
+151,161,155,155,31,156,155,150,147,182,168,8,247,39,7,193,10,247,21,216,136,
+7,66,10,155,147,152,150,247,129,29,14,35,29,252,18,249,133,89,10,35,29,251,
+146,249,102,163,29,14,34,10,85,140,29,38,29,247,7,249,10,50,10,38,29,247,
+193,248,41,21,148,247,9,29,130,126,135,128,130,26,119,158,122,160,156,149,
+146,158,152,30,14,35,10,247,170,249,10,50,10,35,10,247,16,63,10,36,29,173,
+247,148,94,29,37,10,247,77,248,54,50,10,37,10,170,248,26,84,29,40,10,73,247,
+199,50,10,247,228,127,21,247,23,150,214,201,235,26,191,119,179,98,170,30,
+107,163,100,152,52,155,62,153,136,140,119,148,8,119,149,125,160,158,26,177,
+187,169,200,200,185,114,103,147,30,146,107,139,139,148,131,8,130,148,154,
+133,153,27,157,247,119,29,224,7,247,2,29,93,150,89,27,251,18,45,65,40,83,
+171,87,191,111,31,171,121,171,130,205,128,207,127,154,136,247,84,29,75,78,
+166,171,129,30,131,166,139,139,131,146,8,149,130,125,144,124,27,103,121,117,
+94,31,247,96,29,168,124,184,125,169,135,8,51,76,29,178,129,167,27,205,185,
+179,195,247,106,29,50,29,87,63,10,32,10,251,125,249,19,151,10,14,32,10,251,
+91,248,167,94,29,49,29,171,249,10,50,10,49,29,251,15,140,29,32,29,251,11,
+247,211,77,10,50,29,127,251,114,45,29,48,29,247,164,248,45,43,29,212,10,155,
+125,149,222,29,148,123,152,91,10,228,249,94,43,29,45,10,123,249,150,63,29,
+39,29,86,248,247,43,29,230,248,72,21,134,6,136,6,101,113,123,115,113,164,
+125,186,31,251,145,194,10,247,13,6,186,162,197,29,128,247,19,247,98,251,19,
+128,6,132,29,247,145,6,187,163,153,165,163,114,155,100,31,136,6,134,165,6,
+173,143,157,156,169,247,63,10,146,202,10,38,6,247,11,29,150,149,137,166,27,
+150,114,251,98,164,150,6,164,149,141,145,148,31,155,148,149,156,157,191,10,
+110,157,121,173,135,30,247,206,33,21,104,251,98,174,7,14,33,29,119,249,19,
+77,10,35,29,251,145,249,46,43,29,51,10,241,248,120,43,29,34,10,251,68,249,
+19,77,10,92,10,247,111,6,91,107,118,106,94,98,10,167,176,179,193,170,31,176,
+160,148,151,162,202,29,128,129,141,112,27,42,6,14,69,10,251,85,248,168,43,
+29,53,10,247,35,251,114,45,29,38,29,220,251,114,45,29,35,10,247,56,251,114,
+45,29,36,29,251,14,247,159,77,10,37,10,210,252,70,45,29,57,10,251,112,247,
+180,43,29,35,29,251,105,251,59,45,29,32,10,251,247,248,178,77,10,74,29,60,
+177,77,212,97,30,121,171,188,126,178,27,145,148,140,140,151,31,100,105,126,
+115,100,26,83,223,10,129,30,126,113,128,135,126,27,126,133,144,148,175,168,
+183,195,190,31,204,195,161,182,141,214,8,14,33,29,100,249,78,89,10,34,10,
+251,86,249,78,89,29,247,144,248,61,21,251,67,6,112,183,29,104,163,122,186,
+30,206,251,111,71,123,29,247,132,247,26,29,75,6,132,198,29,247,131,251,64,
+175,29,150,151,247,48,29,251,106,7,112,132,138,133,129,160,29,132,149,152,
+136,164,27,247,48,247,5,10,247,195,242,21,247,245,7,78,29,14,33,10,251,117,
+248,123,72,29,248,129,242,21,247,81,7,230,64,193,251,18,88,66,127,123,90,
+30,117,131,128,124,117,26,110,122,29,120,187,7,90,10,162,160,166,180,169,
+31,199,184,144,144,165,26,155,131,154,125,150,30,146,202,10,251,12,171,113,
+29,14,42,29,50,247,191,46,29,42,29,251,115,247,163,56,10,42,29,251,116,247,
+227,104,29,14,248,171,248,125,21,247,6,251,12,7,85,10,247,191,6,137,145,145,
+138,142,27,154,150,147,158,152,31,221,247,12,5,149,154,143,147,247,99,29,
+251,214,251,146,133,10,248,171,248,127,21,247,4,251,12,7,113,131,247,179,
+10,132,150,149,136,166,27,151,36,6,166,93,94,152,84,27,251,35,251,1,37,251,
+24,251,21,243,50,247,42,192,184,150,163,185,31,119,247,12,7,163,150,137,29,
+127,247,177,151,6,186,162,157,173,156,131,154,125,149,31,146,202,10,251,157,
+251,49,21,220,203,82,65,67,84,96,48,51,83,183,209,214,202,196,221,31,14,44,
+10,251,25,247,204,56,10,44,10,251,26,248,12,104,29,14,240,29,251,24,247,3,
+47,247,51,151,141,139,140,154,30,105,110,124,110,101,98,10,179,195,187,228,
+173,31,171,152,152,153,162,247,117,29,116,49,113,135,93,27,56,89,156,29,14,
+47,29,251,3,247,221,72,29,71,29,168,247,189,21,247,151,10,166,172,174,111,
+166,103,31,14,44,29,240,249,10,50,10,44,29,247,59,248,79,21,246,29,130,126,
+135,128,129,26,119,158,122,161,155,148,145,160,153,30,14,38,10,247,148,247,
+104,46,29,38,10,241,247,76,56,10,39,10,175,247,153,62,10,42,10,247,65,247,
+120,46,29,37,29,84,247,153,46,29,37,29,251,101,247,135,67,10,37,29,251,61,
+252,90,45,29,247,110,248,61,21,219,7,80,10,247,75,247,69,7,185,163,156,174,
+159,127,157,120,147,31,226,247,18,5,246,29,129,125,136,130,128,26,135,139,
+137,141,134,30,14,34,29,251,106,248,235,144,29,34,29,251,92,248,128,62,10,
+51,29,178,248,129,46,29,51,29,251,8,248,165,104,29,14,247,91,54,29,59,10,
+247,53,10,174,143,157,166,10,130,30,131,150,149,137,166,247,8,29,179,161,
+157,172,156,131,154,125,149,31,169,29,204,248,214,67,10,46,10,99,249,12,55,
+29,33,10,251,99,248,64,65,10,60,29,247,126,247,148,67,10,247,43,29,100,91,
+54,10,251,135,247,173,67,10,44,10,251,148,247,241,65,10,71,29,169,247,135,
+67,10,100,29,251,86,130,29,36,10,251,68,248,138,65,10,93,29,247,21,247,148,
+166,29,247,56,10,61,29,247,14,251,11,45,29,44,29,126,251,114,45,29,38,10,
+247,34,252,139,45,29,39,10,251,12,247,163,65,10,42,10,198,252,123,45,29,118,
+10,150,151,83,29,251,246,130,29,34,29,251,228,248,138,65,10,118,10,149,152,
+99,10,155,7,247,198,29,184,186,192,168,31,170,156,147,150,162,247,63,10,129,
+145,131,141,118,140,8,14,42,10,178,247,92,56,10,247,228,125,21,247,12,150,
+214,191,213,26,185,112,180,94,164,30,128,29,174,7,247,104,29,122,131,133,
+122,129,31,154,102,98,147,91,27,251,15,52,207,10,79,86,97,151,162,112,30,
+169,130,121,153,111,27,121,247,93,10,132,111,26,107,7,113,140,132,146,129,
+30,124,149,156,130,159,27,152,147,142,147,150,31,166,126,171,131,182,135,
+8,54,76,29,178,129,168,27,204,185,179,195,247,106,29,47,29,247,2,247,183,
+21,149,152,143,149,247,99,29,57,251,12,5,130,126,135,129,129,26,119,157,122,
+162,154,150,146,159,152,30,14,247,70,247,242,21,219,157,186,184,205,27,168,
+170,131,124,163,31,164,124,148,128,143,117,8,100,145,153,124,167,27,155,153,
+147,152,149,31,146,149,141,150,164,26,219,7,164,138,147,133,148,30,155,130,
+123,148,122,27,123,128,133,123,127,31,168,80,113,146,88,27,251,18,42,50,251,
+31,117,31,112,6,118,128,128,120,119,150,128,160,31,163,108,115,6,118,128,
+128,119,119,150,128,160,31,166,6,251,21,164,241,59,247,31,27,204,201,157,
+169,179,31,171,164,156,164,162,26,167,117,163,112,126,128,134,127,128,30,
+115,114,139,139,130,133,8,126,117,104,131,100,27,62,86,176,207,120,31,247,
+54,6,159,151,150,159,159,128,150,118,31,251,59,170,247,86,6,159,151,150,159,
+158,128,150,118,31,14,248,80,247,73,21,211,6,166,153,153,163,164,125,152,
+112,31,67,178,6,170,128,155,117,117,128,123,108,30,100,133,7,113,125,126,
+114,115,153,125,165,31,145,251,1,6,86,176,105,197,165,176,149,152,163,30,
+160,151,146,149,157,26,160,125,156,121,132,135,138,133,129,30,127,119,119,
+133,117,27,114,135,142,157,31,251,170,247,0,21,206,142,164,145,168,158,8,
+191,172,173,202,205,26,246,58,216,251,5,30,35,6,117,130,137,134,131,31,125,
+129,130,122,121,26,123,147,123,150,129,30,132,149,147,137,160,27,251,250,
+7,101,119,121,106,105,160,121,180,31,247,65,6,180,160,157,173,155,132,154,
+127,149,31,147,129,130,141,115,27,57,6,247,249,4,153,6,196,174,108,87,87,
+104,107,82,31,125,6,14,247,54,247,75,21,131,87,122,116,106,135,8,102,132,
+123,123,247,73,10,173,118,161,105,110,121,124,111,134,31,251,86,6,151,169,
+143,154,143,173,8,247,3,247,33,10,251,6,6,135,165,5,247,10,247,33,10,251,
+26,6,136,152,5,123,192,138,145,158,212,29,57,36,66,71,44,112,142,124,153,
+96,31,88,6,116,127,129,119,119,151,128,162,31,207,6,141,130,140,136,141,125,
+8,66,247,139,29,14,247,23,247,124,21,182,136,6,116,141,128,145,130,30,123,
+149,157,130,158,10,129,136,128,113,26,137,96,247,19,247,140,7,118,141,131,
+145,130,30,123,148,157,130,158,27,156,156,147,152,149,31,147,149,141,148,
+166,26,238,123,10,247,73,172,10,77,6,247,229,247,157,21,36,247,24,10,129,
+30,149,132,149,137,163,138,8,251,53,120,7,156,10,149,153,136,163,27,247,88,
+106,10,69,6,140,217,5,200,179,173,173,161,27,150,150,134,128,151,31,124,158,
+147,135,156,27,168,162,162,168,157,130,154,118,156,31,162,109,103,153,109,
+27,103,125,130,84,88,31,14,121,29,121,29,75,10,111,29,242,207,21,133,128,
+135,128,130,26,116,162,119,164,157,154,148,157,150,30,238,247,48,5,137,124,
+138,132,129,26,50,204,75,231,229,205,203,227,227,73,203,49,100,113,131,117,
+106,30,247,43,247,132,5,146,149,142,149,150,26,162,117,159,114,120,125,130,
+121,128,30,251,8,251,75,5,161,133,124,150,118,27,127,134,137,126,120,31,125,
+120,119,132,122,27,103,113,168,181,180,166,167,178,165,152,130,119,143,31,
+117,142,156,125,161,27,140,141,139,140,142,31,141,6,160,142,154,154,159,26,
+138,149,5,135,157,139,139,145,26,144,140,147,141,146,30,141,147,139,140,143,
+26,159,125,155,118,142,30,129,141,5,140,133,134,140,137,27,132,131,136,135,
+133,31,136,134,139,139,138,27,138,135,140,142,130,31,141,130,125,141,127,
+27,53,73,73,53,53,204,73,225,174,170,149,161,176,31,247,67,36,21,180,165,
+111,97,97,112,111,100,100,113,167,181,181,165,167,177,31,14,248,104,247,93,
+21,137,140,139,140,138,140,123,156,131,148,119,155,86,29,247,0,231,6,158,
+131,157,125,166,111,136,138,24,110,129,127,126,117,26,118,159,118,159,144,
+151,142,143,152,30,171,150,144,132,170,97,151,121,148,120,25,142,133,5,186,
+10,132,148,137,142,130,153,155,145,24,168,149,151,152,161,26,159,120,160,
+120,130,128,137,135,126,30,251,204,238,21,247,75,10,14,133,29,247,70,248,
+241,65,10,33,10,46,248,161,152,29,191,247,48,21,157,153,145,148,153,167,29,
+247,91,105,10,64,29,241,247,222,43,29,44,10,251,166,248,44,72,29,125,29,247,
+156,6,90,10,149,145,153,148,152,31,149,154,185,177,165,154,8,168,156,147,
+150,162,247,118,29,112,27,251,10,6,125,198,29,14,44,29,247,68,247,62,21,179,
+170,169,176,177,108,168,247,58,29,39,10,251,30,247,222,134,29,72,10,225,247,
+161,21,157,153,145,149,153,26,160,121,156,116,127,132,136,127,124,30,251,
+26,247,72,29,143,151,155,30,14,36,10,197,87,29,34,29,78,87,29,38,29,247,13,
+247,6,224,10,36,29,251,32,247,218,89,29,40,10,251,72,252,181,45,29,50,29,
+127,251,114,45,29,59,10,32,10,252,9,248,237,89,29,32,29,147,142,10,189,247,
+43,247,68,10,127,123,30,251,25,247,72,29,142,152,155,30,14,70,10,213,247,
+173,50,10,52,29,247,84,247,197,50,10,248,64,142,21,125,68,116,117,77,136,
+8,104,6,113,131,138,133,129,247,186,10,177,6,247,7,224,222,247,9,143,31,138,
+248,93,5,101,29,148,123,152,137,10,247,156,6,14,247,245,247,234,21,247,11,
+240,112,228,29,147,167,26,247,22,252,160,251,22,228,29,148,166,26,166,238,
+251,11,88,7,156,10,149,154,136,162,27,190,251,28,78,6,131,10,247,28,191,95,
+10,14,247,91,247,163,21,189,189,164,152,186,27,196,167,118,95,31,251,176,
+7,138,90,107,111,82,138,8,95,6,113,131,138,133,129,247,186,10,186,6,247,7,
+140,221,216,137,242,8,247,180,247,111,29,93,27,85,106,126,99,93,31,180,41,
+7,97,10,6,14,247,110,247,164,21,189,247,69,247,159,29,146,202,10,251,69,219,
+6,117,10,89,118,6,112,132,138,133,129,160,29,132,149,152,136,164,27,160,90,
+6,56,211,87,247,9,192,218,155,161,188,30,177,155,154,155,163,26,167,116,163,
+110,128,132,137,130,121,30,117,91,95,129,87,27,101,112,145,151,128,31,134,
+144,137,148,157,26,170,247,29,7,162,151,137,29,14,124,10,226,5,165,6,163,
+150,141,129,10,247,31,251,12,7,115,128,137,134,130,247,65,29,122,147,123,
+153,129,30,132,150,150,137,165,27,151,251,110,227,29,14,247,115,64,10,86,
+247,68,21,147,152,144,150,147,26,160,121,156,117,122,129,133,119,125,30,57,
+251,12,5,130,126,135,128,130,26,119,157,122,162,155,149,146,158,153,30,14,
+32,10,66,248,206,88,10,53,29,97,247,234,46,29,34,10,238,249,47,88,10,45,10,
+123,249,173,145,10,45,10,247,135,249,113,50,10,46,10,99,139,10,46,10,247,
+111,248,232,46,29,39,29,251,50,139,29,43,10,247,21,247,226,145,29,14,14,247,
+109,248,35,21,117,121,122,117,118,156,121,161,161,156,156,161,160,122,157,
+118,31,247,65,140,21,117,121,121,118,117,157,121,161,160,157,157,160,161,
+121,157,118,31,233,55,21,130,100,131,123,119,115,8,97,102,92,119,77,27,76,
+93,159,181,102,31,119,163,131,155,130,178,144,72,147,108,162,104,8,91,172,
+189,114,203,27,198,186,160,180,171,31,168,176,150,174,144,211,8,251,71,247,
+139,160,10,131,102,21,247,29,247,3,251,0,251,27,251,29,251,1,251,1,251,28,
+251,27,251,1,247,1,247,28,247,25,247,2,247,3,247,23,31,14,247,197,248,199,
+160,10,48,251,52,247,18,10,247,162,52,21,134,72,130,108,116,105,8,90,106,
+90,114,75,27,79,94,160,180,106,31,110,176,128,173,133,212,149,99,147,122,
+158,117,8,97,174,188,118,202,27,201,188,160,181,174,31,158,161,147,156,149,
+179,8,41,226,247,18,10,14,247,192,117,21,155,210,186,219,227,247,2,8,213,
+233,164,191,201,26,202,85,192,74,75,93,98,63,118,30,217,114,95,178,75,27,
+74,88,86,71,87,155,104,204,51,31,247,9,251,48,169,86,160,59,8,14,246,247,
+162,21,225,32,220,251,9,175,71,186,224,227,247,15,219,235,77,209,251,16,247,
+68,110,196,96,58,83,60,251,6,251,35,8,14,248,130,22,155,7,251,21,158,80,206,
+247,24,26,156,110,145,129,148,128,8,104,169,186,115,181,27,209,194,196,212,
+209,89,194,76,120,128,136,126,112,31,137,138,130,134,134,137,8,161,170,147,
+163,168,26,208,83,193,68,68,84,85,69,112,144,125,165,97,30,156,104,120,145,
+118,27,79,88,82,70,67,195,83,210,202,192,177,210,173,31,140,120,5,133,7,138,
+83,110,76,98,106,114,120,121,132,66,124,8,123,7,14,247,34,22,248,9,157,6,
+251,17,145,81,205,141,247,23,8,74,173,175,114,195,27,193,184,186,197,192,
+119,170,56,215,31,55,216,124,161,109,229,127,68,92,71,58,74,8,77,88,112,95,
+90,26,81,186,91,196,195,179,168,200,168,30,251,20,144,71,64,251,14,27,14,
+247,228,248,48,21,146,117,119,142,118,27,251,11,44,44,251,10,251,10,234,44,
+247,10,247,10,234,234,247,10,219,94,212,69,176,31,227,247,83,5,97,170,170,
+109,149,27,146,143,143,144,143,137,143,133,149,31,117,173,120,192,136,175,
+8,158,138,138,142,133,27,135,135,137,131,129,31,120,122,74,115,103,136,8,
+121,136,135,137,131,26,128,163,132,178,30,159,6,159,140,5,141,6,251,49,251,
+121,21,234,216,64,47,45,64,63,45,46,63,214,232,231,215,216,229,31,14,247,
+214,247,172,21,246,148,224,233,247,1,26,247,10,43,234,251,10,251,10,44,44,
+251,10,251,1,224,45,245,130,30,50,251,41,100,247,41,251,44,183,247,44,247,
+40,178,251,40,7,114,248,105,21,235,216,64,47,45,63,63,45,46,63,214,233,230,
+215,216,229,31,14,247,166,247,40,21,144,126,122,143,125,27,87,93,94,89,110,
+161,120,173,211,190,194,218,31,247,139,7,186,132,179,75,70,26,96,131,105,
+119,94,30,162,6,169,176,155,185,188,26,202,115,199,89,199,30,97,190,138,140,
+134,144,133,148,25,188,102,7,14,247,35,248,42,21,115,110,125,104,134,101,
+8,44,94,235,6,143,100,153,104,162,110,72,72,24,171,107,206,207,169,115,171,
+126,180,133,25,44,184,234,7,180,145,173,153,167,162,206,71,24,171,171,72,
+207,161,164,154,175,144,180,25,235,184,43,6,134,179,124,175,117,166,206,206,
+24,107,171,72,72,112,161,100,155,102,143,25,234,94,45,7,103,135,98,121,114,
+117,71,207,24,107,107,5,247,114,93,21,220,204,75,61,58,75,75,59,60,75,203,
+218,218,203,204,216,31,14,200,22,248,115,248,115,252,115,6,247,130,251,33,
+21,195,183,95,83,86,94,95,86,84,95,183,193,193,183,184,192,31,14,247,189,
+248,92,21,236,218,62,43,41,62,61,42,44,61,217,236,233,217,219,232,31,145,
+179,21,251,13,42,45,251,11,251,12,234,43,247,12,247,10,235,235,247,11,247,
+9,43,236,251,7,31,14,247,195,248,92,21,41,60,62,43,41,216,61,237,235,217,
+217,236,234,61,218,45,31,247,171,252,92,21,248,199,252,199,252,199,7,247,
+170,248,132,21,247,13,236,45,251,11,251,12,44,43,251,11,251,11,43,235,247,
+11,247,8,235,237,247,7,31,14,158,22,248,199,247,174,252,199,6,14,199,248,
+117,21,252,117,248,115,248,117,7,14,156,22,248,203,248,203,252,203,6,248,
+146,252,146,21,252,89,248,89,248,89,6,14,248,167,190,21,251,123,248,70,251,
+124,252,70,5,14,163,247,107,21,248,60,102,29,252,60,6,14,248,221,247,159,
+21,252,60,6,163,171,160,181,154,26,147,132,146,130,132,135,137,132,133,30,
+100,94,120,124,65,96,8,125,131,136,136,131,26,132,143,135,158,129,30,198,
+106,170,115,169,104,8,127,149,144,135,145,27,149,147,145,147,154,123,171,
+110,183,31,248,60,6,14,247,53,247,158,21,169,184,154,170,154,26,147,131,145,
+130,132,135,136,126,128,30,108,104,110,116,79,105,8,120,129,135,135,132,26,
+133,143,133,146,135,30,145,136,140,138,143,137,145,136,25,153,130,188,110,
+163,119,173,100,25,132,145,143,137,146,27,148,146,146,147,154,118,181,115,
+171,31,247,179,102,29,14,247,208,127,21,248,52,7,117,170,184,117,154,27,147,
+146,146,148,146,137,143,131,145,31,99,172,121,160,108,189,136,143,136,143,
+136,145,136,144,136,144,138,140,8,247,100,29,105,81,116,110,102,108,8,126,
+129,136,134,133,26,129,145,132,147,154,169,153,169,187,30,252,52,7,14,247,
+155,248,174,21,252,52,7,162,108,94,161,124,27,131,132,132,130,132,141,135,
+147,133,31,184,101,154,121,184,65,8,126,146,142,136,148,27,146,143,144,156,
+149,31,171,195,165,171,175,169,8,152,150,142,144,145,26,148,133,147,131,124,
+107,124,110,93,30,248,51,7,14,247,166,247,2,247,19,10,110,165,107,247,104,
+10,147,143,31,183,212,158,164,247,75,29,95,117,116,107,30,247,174,7,116,171,
+183,118,108,10,171,154,168,185,30,14,247,87,99,21,95,247,106,183,7,251,24,
+247,81,247,19,10,112,165,106,247,104,10,146,143,31,182,213,159,163,247,75,
+29,94,117,117,108,30,247,173,7,117,170,184,117,108,10,172,154,168,184,30,
+14,247,161,249,27,21,251,137,251,234,247,140,251,236,195,140,247,138,247,
+235,251,136,247,233,5,247,60,251,231,21,251,90,251,174,251,89,247,174,247,
+89,247,171,5,14,198,248,101,21,247,133,252,77,247,132,248,77,5,14,247,197,
+248,202,21,251,55,251,23,251,17,251,48,251,50,247,20,251,19,247,53,247,52,
+247,21,247,19,247,48,247,46,251,22,247,21,251,46,31,14,248,147,247,56,21,
+248,32,93,251,237,251,143,7,168,183,154,171,154,26,146,131,146,132,132,134,
+136,126,128,30,110,104,106,114,81,107,8,123,130,133,134,133,26,132,142,134,
+147,135,30,216,94,161,123,178,94,8,132,145,143,136,145,27,147,147,146,147,
+153,118,180,114,173,31,14,247,79,247,152,21,247,81,251,254,5,124,147,149,
+131,149,27,146,142,142,147,144,138,143,135,151,31,251,36,247,245,247,36,247,
+246,5,142,146,141,148,146,26,145,136,142,132,129,134,135,120,126,30,14,248,
+50,247,152,21,251,81,247,255,5,157,127,133,144,129,27,132,136,136,133,132,
+141,130,142,132,31,247,36,251,246,251,36,251,245,5,135,127,138,135,134,26,
+131,142,136,146,149,149,147,154,147,30,14,247,225,22,247,103,248,235,5,85,
+6,76,251,55,5,251,151,6,77,247,55,5,88,6,247,95,252,235,5,247,42,248,21,21,
+251,3,251,226,5,132,6,36,247,226,5,14,247,245,247,220,21,251,172,247,239,
+5,123,108,134,120,113,26,116,147,123,163,109,30,213,48,79,251,1,5,119,104,
+128,107,117,26,117,148,114,163,101,30,166,94,139,139,128,26,123,128,131,117,
+30,114,63,234,6,186,169,143,147,154,31,161,150,151,165,174,26,184,129,160,
+79,219,30,102,187,126,167,169,26,158,143,150,155,171,30,247,218,252,38,5,
+156,169,144,157,163,26,164,131,156,109,176,30,96,192,5,98,190,130,158,174,
+26,157,143,154,152,172,30,185,247,2,5,159,6,161,148,130,115,143,31,137,141,
+129,141,129,30,156,199,142,155,178,26,197,118,163,89,30,64,6,100,127,149,
+170,31,155,7,140,153,5,94,93,125,110,90,26,108,148,112,155,124,30,127,152,
+155,135,174,27,175,6,14,248,48,247,158,21,251,107,251,185,88,247,237,248,
+198,251,237,88,247,185,251,86,251,185,88,7,14,248,160,248,235,21,63,123,101,
+105,126,132,149,199,113,30,117,190,121,166,117,158,8,167,106,93,154,90,27,
+251,20,34,42,251,10,68,174,81,204,101,31,170,121,155,134,195,130,146,186,
+24,104,145,129,142,122,146,8,80,162,104,190,198,26,218,206,206,217,191,171,
+111,53,182,30,73,172,172,114,192,27,214,184,198,237,31,152,7,150,7,165,251,
+233,21,133,168,137,145,133,155,8,198,119,100,169,85,27,64,71,77,69,114,146,
+107,151,112,31,183,43,139,139,114,26,108,106,112,100,102,112,155,181,109,
+30,97,196,128,154,123,154,118,153,25,160,107,97,151,100,27,133,6,130,6,138,
+95,177,127,151,131,158,111,25,196,49,139,139,166,111,8,104,173,180,119,180,
+27,189,202,162,173,185,31,183,172,160,174,176,26,156,135,156,128,163,30,88,
+247,5,137,146,163,26,165,158,158,166,177,158,116,71,156,30,14,144,150,21,
+161,152,144,144,151,27,148,148,136,134,146,31,104,191,139,139,170,27,183,
+186,171,193,176,31,171,187,156,203,214,26,195,152,7,190,144,133,70,157,31,
+185,251,71,5,89,151,158,113,161,27,164,183,161,167,168,31,148,147,146,148,
+158,162,120,160,24,133,124,134,137,133,27,119,129,152,177,129,31,108,247,
+11,125,192,120,171,115,153,25,237,174,182,180,197,26,228,67,206,43,78,91,
+118,93,92,30,187,101,97,160,82,27,251,2,52,47,251,7,72,160,105,206,103,31,
+180,116,157,119,113,26,133,138,134,135,122,30,159,133,5,180,188,151,161,170,
+26,164,122,159,104,157,30,79,170,139,139,131,145,8,117,157,128,161,166,26,
+193,180,181,193,209,171,86,251,8,30,251,51,7,80,136,112,128,109,30,119,132,
+126,122,129,27,136,134,142,144,131,31,160,110,125,145,116,27,109,112,122,
+109,119,31,128,123,135,129,126,102,8,247,235,247,247,21,247,21,138,140,125,
+188,30,158,169,157,145,171,27,196,180,103,88,106,119,108,108,123,31,108,123,
+120,133,77,124,8,14,143,248,199,21,247,150,252,199,5,215,6,247,150,248,199,
+5,252,90,52,21,247,208,6,251,50,251,230,5,14,143,22,248,228,6,251,150,248,
+199,5,63,6,251,12,252,112,21,247,50,247,230,247,50,251,230,5,14,247,193,227,
+21,63,224,5,248,167,89,252,110,7,85,200,5,71,6,247,140,251,173,247,139,247,
+173,5,71,6,85,78,5,248,110,89,252,167,7,14,247,193,249,9,21,214,54,5,252,
+167,189,248,110,7,193,78,5,207,6,251,139,247,173,251,140,251,173,5,207,6,
+193,200,5,252,110,189,248,167,7,14,248,84,248,50,21,146,151,5,145,150,142,
+148,149,26,169,113,164,108,120,119,125,119,127,30,103,76,5,251,104,6,112,
+131,247,143,29,121,148,123,121,10,247,41,6,103,75,5,251,5,6,113,130,136,10,
+189,6,124,113,5,133,129,135,125,129,26,113,165,116,169,161,158,151,159,151,
+30,183,216,5,247,98,247,46,29,156,124,149,30,147,127,129,141,111,27,251,35,
+6,175,203,5,246,6,162,153,141,145,148,247,183,10,247,0,247,219,114,10,251,
+66,217,29,121,148,123,121,10,248,20,6,162,153,141,145,148,155,10,252,20,247,
+239,217,29,121,148,123,153,10,14,247,46,247,209,21,34,6,121,140,128,130,138,
+122,8,138,7,140,122,150,130,157,140,8,199,6,228,251,176,247,133,249,47,5,
+247,59,6,156,152,150,154,155,128,148,120,31,251,102,6,251,85,252,204,5,14,
+247,167,92,21,68,132,111,123,132,136,141,153,131,30,154,128,124,148,122,27,
+113,121,122,114,109,165,118,176,167,167,152,163,162,31,169,171,147,169,228,
+26,248,138,7,202,146,166,157,162,10,247,166,251,74,21,191,249,53,6,202,147,
+166,156,162,10,247,218,249,14,21,87,253,53,6,75,131,112,122,134,135,143,148,
+133,30,160,125,129,146,119,27,114,120,122,114,110,164,117,174,163,164,148,
+154,159,31,176,168,153,182,228,26,14,248,118,248,75,21,116,128,132,110,116,
+31,111,117,127,127,238,29,107,128,119,215,10,87,199,180,118,180,247,21,29,
+141,251,74,21,117,127,132,111,116,31,110,117,127,128,247,89,29,200,68,112,
+153,94,27,95,105,121,96,99,31,109,106,128,120,247,92,10,145,171,166,30,167,
+163,149,148,146,27,145,151,131,123,158,31,87,200,178,119,181,27,181,171,156,
+183,177,31,174,178,147,153,160,26,169,113,164,107,30,14,247,125,247,247,21,
+247,177,247,11,5,166,151,151,153,161,26,146,137,146,136,146,30,138,141,5,
+154,132,120,152,122,27,130,128,136,134,126,31,252,128,251,101,248,128,251,
+107,5,134,151,151,136,147,27,156,159,152,155,146,31,140,140,5,142,146,141,
+147,145,26,161,127,153,112,151,30,108,251,123,21,176,162,157,169,169,117,
+157,101,31,252,29,6,101,116,121,109,109,162,121,177,31,14,248,238,247,248,
+21,252,129,247,101,5,144,126,128,142,130,27,123,120,127,123,131,31,138,137,
+5,136,133,137,132,131,26,117,151,125,166,127,30,247,178,251,11,251,178,251,
+15,5,112,127,127,125,117,26,133,141,131,142,132,30,140,138,5,122,147,158,
+127,156,27,147,151,142,144,151,31,127,95,21,101,116,121,109,109,162,121,177,
+31,248,30,6,176,162,157,169,169,116,157,102,31,14,247,11,248,25,21,248,18,
+6,161,150,148,155,156,128,148,117,31,252,70,251,136,6,119,148,128,156,156,
+148,150,159,30,14,202,247,231,21,251,43,144,104,166,95,30,71,181,216,98,225,
+27,191,187,154,166,180,31,190,174,168,185,149,202,8,144,172,140,161,237,26,
+247,81,7,159,128,153,123,123,130,127,117,30,251,84,7,251,16,134,98,120,106,
+30,87,109,74,104,73,27,99,98,152,162,106,31,98,168,120,172,133,187,135,169,
+139,139,138,247,1,8,247,84,7,160,129,152,123,122,130,127,117,30,14,248,173,
+247,116,21,247,42,134,174,112,184,30,206,97,62,180,53,27,87,91,124,112,98,
+31,88,104,110,93,129,77,8,134,105,138,117,42,26,251,82,7,117,148,127,156,
+155,149,152,160,30,247,85,7,140,227,139,139,149,26,142,191,146,169,154,161,
+8,189,173,200,171,203,27,200,198,110,94,171,31,166,102,145,102,251,28,26,
+251,85,7,117,148,127,155,155,150,153,159,30,14,248,217,247,123,21,190,252,
+141,7,143,247,16,205,199,247,21,136,8,247,198,190,251,186,247,77,29,73,153,
+80,164,101,30,162,104,174,108,172,126,8,124,175,167,135,212,27,247,186,190,
+251,198,6,251,20,136,74,197,133,247,12,8,144,7,14,182,203,21,75,248,151,203,
+251,117,248,77,74,252,77,7,14,247,192,247,138,21,82,186,200,105,191,27,167,
+165,147,152,159,31,170,161,162,186,178,26,208,80,195,67,84,79,104,84,97,30,
+198,89,86,169,85,27,67,80,82,68,71,196,82,209,199,184,164,202,193,31,174,
+178,21,185,171,189,169,182,27,186,170,109,94,94,108,107,97,119,118,145,151,
+117,31,122,148,139,139,92,185,8,71,143,21,92,102,88,109,97,27,94,110,170,
+186,182,170,169,184,180,179,116,88,186,31,14,248,101,247,71,21,85,144,119,
+150,84,197,137,140,24,179,191,174,160,194,143,136,189,24,69,134,100,118,87,
+76,8,194,95,79,173,87,27,64,84,85,66,66,192,86,212,197,184,162,196,188,31,
+142,142,142,143,141,142,200,74,173,120,208,132,8,251,89,247,20,21,90,97,93,
+112,98,27,97,109,170,184,183,169,170,183,178,176,118,89,187,31,140,137,139,
+139,141,137,8,14,248,124,248,200,21,116,127,131,111,117,31,111,117,127,127,
+247,89,29,199,69,111,154,94,27,95,105,121,95,99,31,109,107,128,120,247,92,
+10,146,170,166,30,168,164,148,147,146,27,145,151,131,123,158,31,87,200,178,
+119,181,247,21,29,252,16,251,112,114,10,251,52,247,193,10,248,20,247,192,
+10,242,247,25,21,102,107,109,103,102,170,109,178,177,170,169,175,176,108,
+169,100,31,247,88,248,58,247,79,29,176,108,168,100,31,247,88,252,58,247,79,
+29,175,108,169,100,31,14,248,147,248,174,21,146,6,174,138,163,159,171,26,
+147,7,138,172,116,159,102,137,8,252,68,6,102,141,116,119,138,106,8,131,7,
+140,106,162,119,176,141,8,152,252,155,126,6,102,141,116,119,138,106,8,237,
+10,170,116,160,106,138,30,136,248,155,247,74,252,155,131,6,104,141,115,119,
+106,26,237,10,171,115,159,104,138,30,132,6,14,248,55,248,171,21,145,66,140,
+109,162,117,170,138,25,144,6,172,140,161,163,138,171,8,247,15,7,173,140,114,
+162,103,27,251,235,6,103,140,114,116,107,26,126,7,123,142,130,149,126,30,
+247,57,251,115,251,61,251,186,5,132,127,137,132,126,26,124,7,106,164,116,
+175,140,30,247,242,6,175,163,162,173,31,247,16,7,171,117,163,106,140,30,134,
+6,108,138,116,116,138,108,136,67,24,251,98,6,247,42,247,147,5,145,151,142,
+147,149,26,151,136,148,130,151,30,251,26,247,76,5,14,247,80,247,34,21,141,
+69,142,118,149,118,8,114,152,159,125,163,27,168,163,153,171,168,31,157,159,
+155,160,150,158,144,148,24,141,142,140,143,143,26,146,133,144,132,132,134,
+135,130,132,30,128,123,5,108,117,122,125,124,27,121,132,158,192,151,139,164,
+140,160,31,158,7,175,7,247,30,247,68,190,236,225,26,193,110,174,95,95,90,
+106,82,100,30,96,75,116,251,1,136,251,61,138,78,24,116,111,134,133,121,118,
+136,136,25,118,117,5,133,133,137,134,134,26,135,7,132,143,142,136,145,27,
+150,139,139,185,183,31,236,247,61,21,141,177,5,247,109,149,158,208,188,27,
+162,154,118,107,68,100,47,69,43,31,14,247,43,248,188,21,125,140,149,130,154,
+27,172,140,5,187,196,119,108,181,31,168,118,158,118,167,96,8,167,94,103,150,
+87,27,251,22,36,40,251,17,251,17,242,39,247,23,247,21,243,238,247,16,233,
+100,247,0,78,209,31,203,85,51,176,41,27,112,136,138,132,132,31,135,135,137,
+132,132,26,247,39,251,64,21,243,219,64,40,43,59,62,38,38,58,216,236,234,219,
+217,238,31,14,247,173,248,136,21,251,30,251,7,251,3,251,26,251,34,247,6,251,
+5,247,36,247,31,247,5,247,3,247,28,247,31,251,8,247,6,251,33,31,143,251,190,
+21,245,35,5,114,103,104,128,97,27,96,110,148,163,108,31,93,184,21,112,175,
+130,166,180,26,182,150,175,163,172,30,247,2,251,0,5,232,22,247,2,246,5,161,
+109,148,114,102,26,90,128,102,115,106,30,251,44,247,41,21,251,3,247,0,5,163,
+172,174,150,181,27,183,170,129,114,174,31,14,247,164,248,43,21,251,20,64,
+75,62,56,26,113,146,109,154,102,30,88,66,125,106,98,26,83,178,98,192,196,
+184,193,207,179,125,183,98,223,30,176,185,177,177,194,183,8,190,201,174,157,
+174,27,169,159,112,99,87,115,65,107,91,31,102,114,104,116,107,27,111,114,
+157,159,149,144,144,151,140,31,163,141,156,156,160,26,158,124,153,119,107,
+113,106,99,91,177,105,193,190,198,172,194,187,30,180,186,162,195,195,26,209,
+97,187,78,59,72,94,251,51,251,46,30,132,160,137,149,156,26,202,174,193,205,
+181,30,148,145,145,143,159,150,8,251,64,251,226,21,176,74,156,96,109,26,112,
+120,120,112,105,114,167,178,174,147,157,182,203,30,14,248,85,248,100,21,56,
+6,251,46,104,247,142,10,46,185,65,222,96,30,94,73,5,132,130,137,133,133,26,
+127,148,130,151,151,147,144,154,149,30,189,213,5,135,175,172,136,150,27,138,
+148,171,139,187,27,247,86,6,161,152,148,155,155,126,149,117,31,251,88,6,98,
+112,139,140,127,31,131,117,141,141,114,31,247,135,247,249,5,227,6,162,151,
+148,155,155,125,149,118,31,85,6,192,217,5,146,150,141,143,146,26,151,130,
+148,126,127,132,134,124,129,30,36,251,44,21,251,127,251,239,110,150,127,147,
+121,156,25,105,174,118,187,186,26,197,170,198,187,171,30,165,178,179,145,
+247,33,27,14,248,93,248,92,21,252,115,252,89,5,249,20,190,252,147,6,248,17,
+247,254,5,14,247,116,22,247,45,176,147,10,247,22,179,134,120,175,31,194,111,
+177,74,229,10,124,153,128,160,31,14,247,233,248,100,247,69,29,62,173,70,200,
+95,30,103,189,174,133,247,57,175,10,199,186,170,247,0,10,14,247,116,247,33,
+21,247,47,174,147,10,247,23,178,134,120,175,31,194,110,177,75,229,10,123,
+153,129,160,31,248,115,251,33,21,161,150,148,155,156,128,148,117,31,252,115,
+6,247,126,10,247,233,248,241,247,69,29,88,154,91,167,100,30,175,89,186,110,
+202,130,8,134,173,160,138,240,175,10,198,186,171,247,0,10,252,115,252,190,
+21,117,128,130,122,123,150,130,161,31,248,115,6,160,150,148,155,156,128,148,
+118,31,14,247,218,247,124,21,247,147,189,251,121,6,236,247,73,5,247,24,190,
+34,6,151,169,150,161,150,154,8,143,144,141,143,142,26,150,126,150,127,126,
+133,135,123,131,30,96,58,5,251,26,247,77,29,251,16,183,59,230,99,30,110,85,
+5,135,131,137,133,134,26,127,151,128,152,151,146,144,154,147,30,172,202,5,
+135,172,143,139,184,27,247,186,190,251,198,6,115,132,139,141,126,31,178,247,
+71,21,49,251,60,74,161,104,195,135,224,25,144,7,247,210,247,123,21,42,251,
+73,5,251,113,144,6,145,247,12,204,198,247,20,136,8,14,247,213,4,223,210,5,
+248,242,195,252,176,6,247,6,10,248,176,195,252,242,6,14,248,235,247,213,21,
+55,69,5,252,242,83,248,176,244,29,252,176,83,248,242,6,14,222,248,84,21,247,
+6,10,248,70,244,29,252,136,83,21,248,202,6,222,69,56,68,5,252,202,6,55,210,
+5,14,167,251,175,247,78,10,121,148,123,154,29,252,180,247,47,217,29,122,148,
+122,121,10,248,180,247,46,29,155,124,150,247,64,29,14,167,249,108,247,78,
+10,122,148,122,154,29,14,248,101,248,94,21,142,145,141,146,143,26,151,127,
+149,126,128,133,135,124,132,30,99,67,5,149,104,123,142,112,27,251,24,36,44,
+251,14,66,174,76,205,95,31,103,72,5,136,134,137,131,135,26,128,151,128,151,
+151,144,143,154,147,30,175,204,5,127,174,158,136,170,27,247,23,242,235,247,
+13,215,102,203,69,183,31,116,97,21,191,106,168,88,81,26,43,58,65,35,116,127,
+141,147,112,30,96,161,21,87,178,115,182,195,26,234,220,214,242,159,150,137,
+133,165,30,14,247,178,248,138,107,10,247,187,248,152,107,10,14,247,95,29,
+14,247,95,29,247,115,251,111,21,251,48,247,45,247,48,6,14,207,142,21,248,
+102,236,252,2,247,245,39,6,14,247,181,192,10,14,247,95,192,10,247,96,22,228,
+247,88,5,151,165,142,149,247,40,29,14,209,22,248,97,247,203,6,251,123,247,
+146,251,122,251,146,5,189,251,153,21,247,133,7,247,72,247,90,247,73,251,90,
+5,251,133,7,14,247,159,239,21,134,141,105,154,128,145,125,150,25,100,171,
+115,206,214,26,247,10,195,203,243,243,195,76,251,11,54,110,70,90,109,30,128,
+132,128,133,112,128,8,39,247,95,7,165,148,140,146,150,31,156,149,150,158,
+157,26,156,130,156,124,149,30,148,127,129,141,112,27,94,6,200,172,174,213,
+235,26,217,110,215,93,182,30,182,93,59,165,52,27,52,59,113,96,93,31,93,96,
+110,63,61,26,43,174,65,200,106,30,94,6,114,130,247,143,29,122,148,122,154,
+128,30,131,151,149,137,167,27,247,95,6,14,247,150,247,156,21,251,6,97,180,
+68,231,219,118,251,13,5,227,6,118,247,13,231,59,180,210,251,6,181,247,6,180,
+98,210,47,59,160,247,13,5,51,6,160,251,13,47,219,98,68,5,14,159,247,123,21,
+248,141,134,6,133,251,12,74,81,251,20,142,8,251,198,88,247,186,6,247,1,181,
+152,188,187,31,186,187,160,201,228,26,233,109,209,78,186,30,172,97,101,148,
+43,27,251,186,88,247,198,6,247,19,142,204,82,146,251,11,8,136,7,134,252,141,
+7,14,248,113,247,84,21,138,207,135,168,125,170,8,204,110,71,178,53,27,251,
+20,59,55,251,26,251,26,216,60,247,21,235,206,180,215,165,31,140,142,141,143,
+5,94,6,138,137,139,138,136,135,8,90,114,90,112,74,27,65,105,161,200,119,31,
+214,7,247,150,180,21,251,148,211,6,197,169,171,160,200,27,203,189,109,90,
+158,31,14,248,177,247,152,21,252,88,247,46,5,251,200,7,14,197,247,152,21,
+248,88,251,46,5,247,200,7,14,247,216,248,113,21,161,112,162,119,162,126,200,
+106,150,132,144,130,8,146,127,143,120,116,26,251,137,7,146,121,113,144,118,
+27,63,72,83,76,102,170,116,189,195,192,163,180,172,31,162,167,146,162,142,
+190,8,248,20,7,140,216,103,216,89,169,52,193,24,128,148,5,125,154,132,158,
+163,26,153,91,252,155,7,146,121,115,143,118,27,65,73,83,76,102,170,116,187,
+194,191,163,180,172,31,161,167,146,162,142,191,8,247,44,247,64,21,251,13,
+202,112,179,136,247,13,142,137,24,247,13,76,165,100,144,251,14,8,14,32,29,
+14,68,10,75,29,248,232,22,251,130,248,200,5,251,8,6,251,130,252,200,5,248,
+68,243,21,251,163,6,247,27,247,211,5,14,58,29,49,29,14,40,29,247,130,247,
+203,21,152,7,163,125,153,115,116,125,125,115,30,39,7,115,153,125,162,163,
+153,153,163,30,154,247,18,124,7,115,153,125,163,162,153,153,163,30,239,7,
+163,125,153,116,115,125,125,115,30,126,7,75,247,159,108,29,14,34,10,14,247,
+3,10,157,173,247,108,29,146,128,129,141,161,29,132,138,136,130,73,10,147,
+128,130,140,111,27,108,6,14,248,73,243,21,123,247,34,29,247,24,6,184,164,
+157,172,170,115,161,105,31,128,6,251,87,248,96,5,251,108,247,140,29,196,6,
+251,42,251,248,5,129,6,103,115,118,107,106,164,121,185,31,247,24,91,29,122,
+6,247,28,247,210,5,14,60,10,87,10,147,123,153,134,10,14,248,78,248,96,21,
+94,164,10,247,41,252,135,251,41,164,10,184,7,247,77,251,118,21,108,145,154,
+124,166,27,173,154,160,189,31,185,7,188,124,161,105,112,124,124,108,133,30,
+50,6,171,133,125,153,111,27,106,124,117,90,31,93,7,90,155,117,173,165,154,
+154,170,144,30,43,251,22,21,184,7,184,247,108,10,94,30,251,41,248,135,247,
+41,7,184,247,108,10,94,30,94,7,14,36,29,14,248,36,247,7,10,184,164,157,172,
+162,123,160,119,144,31,142,131,128,139,122,27,109,10,71,10,248,178,248,200,
+21,252,75,53,6,247,60,251,82,251,60,251,89,5,48,248,81,247,51,7,176,123,157,
+107,106,123,122,101,137,30,136,83,5,251,105,6,247,56,247,79,251,47,247,67,
+5,247,87,6,144,71,5,101,142,155,122,170,27,172,156,157,176,31,14,49,10,39,
+29,14,247,244,248,173,21,152,6,162,145,140,143,146,31,152,145,147,151,152,
+26,163,121,150,100,30,251,24,6,100,121,128,115,115,158,127,177,31,150,118,
+6,84,133,105,129,101,118,8,64,98,91,60,56,26,251,21,243,40,247,38,130,30,
+118,128,7,127,140,5,113,120,124,119,115,158,127,177,31,247,24,6,163,144,140,
+143,146,31,152,145,147,151,151,26,151,132,149,128,146,30,145,130,134,139,
+114,27,126,159,6,247,36,146,247,2,242,247,21,26,229,81,225,53,177,30,106,
+153,107,146,94,143,8,251,0,252,27,177,10,41,10,247,139,247,139,21,72,149,
+122,166,137,244,8,247,67,47,7,93,114,121,106,108,160,120,173,137,31,67,7,
+251,49,200,62,247,25,127,30,99,7,99,138,119,122,106,151,29,227,247,134,29,
+172,119,156,99,140,31,179,7,247,25,150,204,222,135,247,44,8,211,7,175,141,
+158,156,171,247,66,10,47,251,67,6,137,34,123,112,71,129,8,247,106,7,180,140,
+158,156,174,26,175,116,153,75,30,85,6,75,116,125,102,105,159,122,179,138,
+31,14,247,155,233,21,105,154,125,146,125,152,8,99,172,114,208,215,26,247,
+15,196,205,247,0,245,196,72,251,14,63,114,70,99,106,30,125,126,125,132,105,
+124,8,45,247,91,7,164,147,247,96,10,154,126,149,30,147,127,130,141,113,27,
+77,6,168,153,150,147,153,155,8,173,177,160,205,206,26,217,110,215,94,182,
+30,182,94,60,165,53,27,53,60,113,96,94,31,94,96,110,63,61,26,78,157,76,168,
+101,30,156,118,151,129,172,123,8,77,6,114,132,230,29,247,91,6,14,248,90,247,
+226,21,208,97,78,173,61,27,251,23,35,39,251,18,251,21,243,42,247,31,223,190,
+168,204,170,31,159,75,5,122,145,156,128,160,27,169,158,157,166,147,138,143,
+138,144,31,85,247,55,215,247,45,5,143,147,141,148,148,26,162,115,159,110,
+119,130,133,118,128,30,50,251,88,21,51,111,102,104,74,27,67,83,193,208,208,
+195,193,211,172,169,127,117,161,31,158,119,149,118,155,91,8,14,247,111,153,
+21,118,173,168,131,181,27,247,3,223,223,247,3,221,106,188,63,169,31,177,170,
+156,173,185,26,227,67,202,39,76,84,114,94,108,30,115,106,130,91,53,26,252,
+194,247,0,7,168,248,112,21,150,6,196,138,148,138,165,129,8,184,123,154,118,
+90,26,81,106,100,88,94,104,156,175,111,30,247,136,7,226,156,165,197,179,162,
+119,105,88,99,108,70,137,30,14,247,190,247,29,21,251,29,247,180,5,70,6,92,
+115,121,105,105,160,123,188,138,31,247,43,251,210,5,129,93,135,111,104,26,
+72,163,103,184,184,163,175,206,174,135,173,129,179,30,247,30,247,175,5,151,
+145,147,153,140,27,141,141,143,140,147,140,8,183,146,157,155,172,26,173,117,
+157,96,79,107,111,50,96,30,14,247,135,248,65,21,107,132,120,132,114,127,8,
+61,101,88,63,60,26,251,18,247,7,40,247,39,247,40,247,6,238,247,20,218,100,
+195,39,206,30,251,31,232,125,151,160,26,160,158,147,188,30,217,6,174,157,
+155,168,166,121,153,104,31,77,6,93,95,133,129,114,31,93,121,107,96,96,26,
+107,155,116,187,102,30,212,39,21,228,206,84,65,68,72,84,52,52,72,194,210,
+211,206,196,224,31,14,248,28,247,162,21,136,118,128,139,117,27,81,96,158,
+163,158,169,151,182,156,166,136,136,157,31,135,162,139,139,148,27,163,158,
+159,164,158,129,153,121,147,31,150,113,90,148,101,27,34,66,89,66,106,151,
+122,185,102,31,91,114,111,100,94,26,62,220,83,247,5,184,203,152,154,170,30,
+157,149,147,152,161,26,164,121,160,116,132,129,138,137,129,30,129,93,120,
+136,110,27,88,100,157,162,166,190,160,207,158,155,138,137,159,31,14,247,216,
+248,135,21,251,15,251,17,87,41,35,26,81,166,82,181,105,30,165,119,171,125,
+203,121,8,198,122,143,137,119,26,117,123,127,107,137,30,89,135,120,124,105,
+26,105,162,122,183,231,205,198,221,208,101,179,50,164,30,86,153,116,147,126,
+147,8,115,154,125,168,171,26,172,147,170,153,166,30,173,205,191,204,206,199,
+154,153,146,145,164,160,145,145,24,240,251,100,199,10,14,84,10,14,247,192,
+248,239,21,251,28,43,251,19,251,74,251,75,234,251,18,247,29,247,29,234,247,
+19,247,74,247,75,44,247,18,251,29,31,251,12,251,150,21,237,154,183,195,200,
+27,200,182,84,40,155,31,35,4,41,123,96,84,78,27,78,96,194,237,123,31,14,209,
+10,133,133,150,29,14,247,133,247,214,21,175,142,157,156,170,26,173,115,157,
+93,30,45,247,110,29,251,109,7,88,137,118,124,104,151,29,247,4,6,185,163,157,
+174,173,118,154,88,141,31,201,7,194,134,186,94,202,32,141,135,24,142,134,
+5,221,91,29,120,6,104,194,99,183,103,162,247,5,234,24,184,141,160,155,173,
+247,66,10,101,6,251,84,251,56,5,14,230,242,21,94,247,144,29,233,247,134,10,
+169,123,155,106,144,31,226,247,62,236,251,62,5,106,133,124,123,110,26,105,
+164,121,185,30,236,6,185,164,157,173,173,117,155,93,140,31,251,176,248,136,
+5,35,247,34,10,180,6,204,251,8,5,14,247,97,132,21,133,161,157,136,159,27,
+169,186,147,148,160,31,182,157,5,120,237,7,185,164,157,173,170,117,158,100,
+140,31,247,214,251,31,7,93,114,121,105,106,164,120,185,31,170,251,75,6,103,
+78,97,125,98,27,99,122,155,176,31,247,176,251,12,7,94,114,121,105,106,164,
+120,184,31,151,252,85,6,95,158,115,174,174,158,163,183,30,14,247,63,248,61,
+21,40,6,103,115,120,110,109,163,120,175,31,162,6,247,66,251,226,5,216,6,247,
+20,247,11,202,238,221,26,179,122,189,114,170,30,154,127,124,146,121,27,109,
+114,116,111,132,141,131,142,133,31,159,99,142,129,113,26,89,108,85,73,72,
+30,14,248,68,247,225,21,34,142,95,163,193,26,163,153,164,160,154,30,153,148,
+161,145,168,142,8,203,143,161,153,176,26,173,114,157,94,30,251,69,6,94,113,
+121,106,107,161,123,188,135,31,106,114,125,113,99,26,92,159,98,176,106,30,
+76,106,109,91,68,26,85,163,91,182,110,30,162,123,173,128,205,124,8,195,126,
+147,134,120,26,119,127,132,105,136,30,90,135,118,123,106,26,105,162,122,185,
+233,200,192,220,183,120,176,104,163,30,119,152,104,151,92,149,8,61,154,119,
+154,180,26,199,203,171,247,13,30,14,39,10,14,247,107,247,214,21,247,62,251,
+110,138,6,112,131,137,133,129,247,65,29,123,148,123,152,129,30,131,150,148,
+137,168,27,247,4,6,166,146,140,146,149,31,155,150,149,155,156,26,155,131,
+153,124,150,30,148,127,132,141,111,27,136,247,110,147,6,165,146,247,96,10,
+247,91,10,112,27,252,38,6,114,131,230,29,147,251,110,136,6,113,132,137,133,
+128,31,122,128,130,123,122,26,123,147,124,154,128,30,131,151,146,137,167,
+27,247,4,6,166,147,140,146,149,247,129,10,155,130,155,126,149,30,147,128,
+130,141,110,27,138,6,14,247,83,163,21,113,181,180,126,186,27,247,16,242,243,
+247,18,247,19,42,234,251,23,61,72,109,83,95,31,101,93,129,102,50,26,251,212,
+164,10,247,20,248,110,21,210,189,90,69,71,85,82,74,103,100,157,168,112,31,
+120,160,130,165,170,26,208,192,189,214,30,14,247,232,248,73,21,53,89,130,
+114,91,31,68,102,92,63,60,26,251,19,247,4,40,247,36,247,34,247,5,238,247,
+17,184,123,180,107,178,30,185,6,165,148,247,63,29,155,157,26,160,125,160,
+120,145,30,142,129,132,140,119,27,251,147,36,21,224,203,86,69,70,75,85,56,
+55,75,193,208,208,203,193,221,31,14,247,237,247,215,21,215,6,167,146,140,
+145,148,31,156,149,148,155,157,26,165,121,159,113,142,30,142,116,139,139,
+136,27,251,159,6,113,131,138,132,129,31,123,129,129,123,122,26,122,148,122,
+153,130,30,132,150,149,137,165,27,222,251,138,6,83,179,108,210,209,187,166,
+178,163,122,160,120,132,129,137,135,129,30,130,117,130,137,126,27,128,136,
+143,153,31,14,47,10,14,247,125,251,33,21,178,29,247,18,7,196,147,173,152,
+174,165,8,195,180,172,204,210,26,247,5,44,242,34,98,101,120,108,117,30,123,
+118,133,109,90,26,251,78,7,83,154,114,176,207,26,188,154,175,174,178,30,153,
+154,144,150,154,26,166,115,163,112,77,75,251,2,32,57,167,77,194,100,30,168,
+118,163,130,192,129,8,247,0,247,182,21,179,141,145,151,186,185,83,81,78,98,
+93,73,128,30,14,247,191,247,116,21,251,22,247,93,5,72,247,34,29,145,6,247,
+18,251,87,251,47,251,132,5,127,120,134,127,127,26,113,165,114,168,158,157,
+152,163,155,30,247,20,247,90,247,40,251,115,5,206,247,134,10,173,114,157,
+93,31,132,6,251,36,247,112,247,34,247,107,5,151,157,144,151,152,26,166,113,
+163,110,120,121,126,115,124,30,14,247,138,251,33,21,178,29,247,21,7,247,3,
+145,201,206,137,247,2,8,247,43,7,180,141,159,155,172,247,66,10,41,251,152,
+6,91,124,120,91,129,30,248,83,7,183,120,163,104,104,120,116,94,30,252,83,
+7,91,150,126,156,138,188,8,247,152,41,7,92,115,121,105,107,159,122,180,137,
+31,251,43,7,136,251,1,205,69,246,135,8,14,247,192,186,21,96,167,170,120,184,
+27,181,178,158,170,166,31,166,173,153,188,207,26,217,118,208,103,184,30,81,
+29,112,98,110,30,106,94,121,74,66,26,251,18,194,64,232,185,169,157,183,168,
+30,14,248,169,248,15,21,173,117,163,107,118,125,131,121,128,30,157,112,107,
+147,92,27,60,80,116,92,95,31,98,94,117,80,71,26,62,167,79,192,101,30,167,
+119,172,125,199,120,8,205,117,139,139,129,26,123,122,131,96,135,30,101,135,
+120,123,107,26,105,161,122,183,230,207,197,216,173,125,167,113,161,30,120,
+155,114,149,81,156,8,36,169,116,163,214,26,232,191,192,230,197,163,121,85,
+152,30,101,149,154,124,168,27,170,158,163,177,140,31,14,248,42,247,100,21,
+93,133,114,123,121,30,117,120,107,126,107,27,110,109,148,153,117,31,124,150,
+133,152,164,26,247,120,247,165,10,122,247,16,29,150,131,148,138,167,138,8,
+151,251,21,6,82,158,98,180,109,30,112,176,180,129,207,27,212,188,154,173,
+178,31,182,177,152,178,227,26,247,49,7,178,149,148,144,190,170,147,144,24,
+104,227,131,134,129,134,132,135,125,132,135,137,25,123,130,138,139,122,132,
+8,166,7,238,125,192,99,189,30,185,101,79,167,76,27,251,6,53,63,40,55,197,
+73,247,13,85,31,185,118,162,134,203,134,8,141,223,21,71,148,95,155,92,174,
+8,101,168,121,167,172,26,186,177,174,189,225,180,71,251,37,30,14,247,244,
+177,21,247,36,146,247,2,242,247,22,26,247,21,251,1,242,251,37,147,30,170,
+7,174,117,163,108,107,116,114,105,30,107,7,251,39,129,36,40,251,22,26,251,
+23,242,40,247,39,130,30,107,7,105,162,114,171,170,161,163,174,30,251,0,247,
+10,177,10,248,148,247,252,21,170,160,159,168,168,118,159,108,31,251,238,6,
+67,100,119,78,93,31,129,126,136,131,127,26,117,153,123,159,149,146,142,148,
+148,30,141,141,149,148,149,148,8,116,88,130,97,79,26,251,17,195,64,231,185,
+170,157,183,167,30,95,167,170,121,185,27,180,179,158,170,165,31,166,173,153,
+188,207,26,208,126,192,108,191,30,251,49,22,164,123,157,125,151,127,8,162,
+113,154,83,77,26,87,123,106,114,111,122,175,209,247,47,29,105,121,120,101,
+137,31,136,87,135,115,132,121,8,120,130,126,128,125,27,113,124,172,195,196,
+152,192,160,161,31,151,153,158,155,168,159,8,14,209,10,134,132,150,29,102,
+247,132,94,10,47,10,251,185,248,46,94,10,248,11,248,201,21,154,151,146,150,
+150,26,158,122,155,120,130,128,200,10,125,128,132,128,127,26,120,156,123,
+157,149,149,247,155,29,248,23,248,225,247,35,10,120,123,102,10,248,52,247,
+43,21,158,92,5,123,6,92,115,247,54,10,118,155,91,141,31,251,87,248,96,5,251,
+81,199,29,169,6,251,42,251,248,5,134,6,97,116,247,54,10,115,157,93,31,122,
+6,159,186,5,247,79,242,21,251,35,6,211,247,60,5,251,120,236,21,168,126,155,
+115,116,126,123,110,30,251,24,7,110,152,123,162,163,152,155,168,30,14,206,
+29,247,98,251,47,59,29,152,211,29,248,28,251,49,52,10,14,248,15,248,96,21,
+234,91,29,251,189,199,29,233,251,248,45,199,29,247,189,91,29,44,6,251,198,
+248,51,130,10,247,223,248,214,21,251,33,251,3,251,23,251,58,251,56,247,4,
+251,23,247,32,247,33,247,3,247,22,247,57,225,114,208,89,196,31,196,89,79,
+167,72,27,35,4,219,203,53,33,33,74,53,60,60,74,225,244,246,203,225,219,31,
+251,150,184,130,10,247,39,236,21,159,136,128,150,121,27,116,128,119,98,31,
+72,247,125,247,56,7,52,161,103,182,224,26,231,198,207,219,219,197,71,46,57,
+98,89,57,122,30,251,56,247,124,206,7,179,127,160,117,121,129,129,118,135,
+30,81,6,222,183,179,210,241,26,247,40,251,0,247,8,251,32,251,29,251,1,251,
+9,251,40,37,179,69,223,95,30,251,25,248,58,130,10,206,29,247,254,251,43,67,
+29,14,110,10,249,6,95,29,247,246,247,128,21,247,51,247,116,5,184,141,161,
+156,172,26,173,115,156,92,140,30,47,6,94,113,121,105,116,151,124,165,128,
+31,55,251,12,54,247,12,5,165,152,149,153,162,26,172,114,156,94,140,30,50,
+6,93,114,121,105,107,160,122,183,136,31,247,52,251,116,5,251,24,78,7,94,114,
+121,105,105,164,121,184,31,247,122,198,10,78,6,251,49,249,6,94,10,248,160,
+247,227,21,150,167,145,159,148,26,165,118,158,108,108,129,129,86,118,30,122,
+95,5,218,82,95,167,69,27,251,6,53,42,251,21,251,19,228,40,247,8,206,191,169,
+206,186,31,170,57,5,203,6,185,164,157,173,171,120,156,99,141,31,137,146,136,
+146,133,154,131,162,125,173,130,158,8,251,9,135,21,55,98,107,108,96,27,86,
+97,193,209,207,178,191,191,179,173,102,47,185,31,167,247,253,232,10,128,132,
+128,247,76,29,248,20,247,161,21,87,6,67,97,152,162,155,167,152,177,190,176,
+122,100,173,31,120,156,152,132,156,27,169,166,166,166,136,31,142,7,137,183,
+140,163,5,142,7,171,142,116,164,107,27,117,125,132,120,126,31,157,102,104,
+147,95,27,37,62,84,66,107,154,114,171,114,31,102,112,120,105,99,26,100,158,
+105,174,112,30,111,177,187,126,206,27,188,183,146,153,182,31,180,153,161,
+159,163,26,167,112,162,107,129,127,137,135,126,30,124,92,110,134,103,27,88,
+98,156,159,163,190,156,212,31,190,6,156,248,34,21,155,151,145,150,151,26,
+157,122,155,120,130,128,200,10,125,128,132,127,208,29,84,10,247,58,247,57,
+232,29,127,132,128,208,29,147,29,121,162,103,104,120,115,95,30,247,59,247,
+100,232,10,127,132,129,247,76,29,247,193,248,73,21,251,34,251,9,35,251,19,
+251,15,247,7,41,247,36,247,36,247,7,236,247,14,247,21,251,8,243,251,35,31,
+35,4,222,207,81,69,77,69,85,58,57,70,193,202,209,207,196,222,31,244,247,124,
+232,29,128,133,128,126,26,121,156,123,157,149,149,247,154,10,247,192,168,
+21,109,167,170,125,181,27,236,194,212,247,19,217,118,209,103,184,31,81,29,
+111,99,110,30,106,94,121,74,66,26,251,20,194,66,236,182,168,152,170,168,30,
+240,248,172,21,155,151,145,149,152,26,157,122,155,120,130,128,134,130,127,
+30,251,0,56,5,125,128,132,127,208,29,47,10,54,248,14,21,154,151,146,150,151,
+26,157,122,155,120,130,128,200,10,124,127,133,129,126,26,121,156,123,158,
+148,149,247,154,10,147,29,247,108,10,94,30,247,51,247,147,247,35,10,119,124,
+102,10,47,10,35,248,61,247,35,10,120,123,127,131,122,129,30,67,247,148,29,
+156,124,158,154,151,147,156,149,247,81,10,170,165,181,29,32,29,14,248,187,
+248,200,21,252,102,138,10,247,18,247,132,122,247,137,29,251,240,251,231,21,
+247,44,29,68,10,75,29,248,105,22,143,94,5,82,144,153,119,175,27,178,153,161,
+199,31,199,7,141,205,125,155,79,141,8,247,248,7,188,140,162,157,174,26,175,
+115,153,76,30,251,217,6,74,116,126,101,104,164,121,190,31,145,6,141,6,141,
+251,75,6,71,128,94,116,113,30,116,118,110,127,104,27,131,6,128,140,5,137,
+6,138,6,133,251,36,6,78,153,118,178,175,153,159,198,143,30,141,182,5,247,
+38,248,96,21,247,18,251,248,6,251,53,141,161,177,151,201,140,210,25,14,58,
+29,247,138,242,21,101,134,122,123,108,26,102,247,150,10,169,122,155,103,145,
+31,247,36,7,149,129,161,98,150,109,180,33,24,160,89,149,130,180,138,8,171,
+6,170,161,159,169,170,120,157,100,143,31,100,243,122,183,116,172,106,167,
+247,145,10,111,148,153,127,247,85,29,74,120,119,251,70,41,30,234,7,172,146,
+155,155,167,26,177,116,153,77,192,29,123,72,233,10,106,108,115,104,124,98,
+100,36,24,100,135,121,123,107,247,20,10,175,156,170,153,153,8,14,247,79,248,
+198,21,166,140,114,162,111,27,109,132,10,64,247,147,29,207,31,171,6,228,175,
+119,91,86,92,111,49,68,89,153,175,80,31,162,102,124,145,123,27,111,114,113,
+111,118,149,122,161,125,31,87,216,225,113,234,27,230,199,155,175,185,31,180,
+171,162,186,191,26,196,115,182,89,172,30,175,172,156,175,247,125,29,98,30,
+14,55,10,14,57,29,14,248,144,248,96,21,190,141,160,154,174,26,177,116,153,
+76,30,251,216,6,75,116,125,102,104,163,122,187,138,31,144,6,146,251,148,6,
+63,122,103,105,137,30,138,6,135,149,6,187,121,164,103,100,124,116,84,30,82,
+7,106,175,119,201,202,181,157,179,167,30,167,176,153,194,208,26,247,148,247,
+16,251,249,7,88,138,118,124,104,26,100,162,126,203,30,218,6,202,162,153,177,
+174,118,154,88,140,31,14,60,10,40,29,36,29,14,248,38,247,7,10,185,163,157,
+173,174,118,154,88,140,31,109,10,71,10,48,29,14,49,10,81,10,14,247,246,248,
+105,21,162,6,181,161,155,170,170,116,156,94,31,251,36,6,94,116,123,108,108,
+161,122,179,31,162,112,6,67,137,99,133,113,128,8,84,117,108,88,75,26,34,207,
+82,247,16,30,171,110,116,6,98,117,122,108,108,161,123,180,31,247,46,6,181,
+162,156,170,170,118,155,98,31,113,168,153,6,247,31,210,194,247,1,197,111,
+187,92,163,31,110,154,94,146,64,141,8,251,0,45,21,251,22,124,7,72,105,162,
+183,181,169,160,199,31,247,26,22,162,6,201,170,118,97,94,103,117,67,31,131,
+6,14,41,10,248,131,248,96,21,192,142,159,152,175,247,66,10,251,12,182,29,
+251,249,251,92,247,249,149,247,139,10,251,12,6,93,115,121,104,104,158,126,
+192,136,31,251,249,247,170,29,85,247,140,10,247,49,40,7,14,248,32,243,21,
+85,6,75,116,125,100,102,162,125,203,31,247,41,190,29,76,115,247,13,29,98,
+80,99,123,97,27,95,126,157,198,31,247,4,7,202,140,247,10,29,137,31,251,8,
+7,251,9,194,78,247,132,10,14,247,138,243,21,63,248,96,251,2,6,93,115,121,
+104,105,158,125,192,137,31,251,250,107,29,248,95,6,175,163,160,170,172,118,
+156,99,141,31,247,249,7,191,141,159,153,174,247,66,10,251,1,252,96,63,247,
+249,6,172,142,156,156,170,26,173,247,154,29,110,156,122,172,134,31,14,247,
+127,242,21,63,248,97,251,2,6,93,115,121,104,104,158,126,192,136,31,251,249,
+247,169,10,85,247,32,10,247,49,41,247,249,7,192,142,158,153,247,65,10,251,
+2,252,97,63,247,250,6,170,142,158,158,169,26,172,116,157,96,30,61,6,97,117,
+121,105,109,156,122,172,135,31,14,247,95,248,96,21,163,91,29,251,34,138,10,
+6,251,122,4,247,44,29,202,243,21,129,6,100,118,121,107,103,163,121,186,31,
+247,32,6,247,30,211,194,245,244,50,207,251,29,31,122,247,18,179,91,29,251,
+50,182,29,6,247,0,251,248,21,247,19,161,7,214,177,116,93,100,111,120,82,31,
+247,125,22,99,137,117,120,107,26,105,163,122,185,30,237,6,185,164,157,172,
+173,116,156,93,140,31,247,250,7,180,140,159,156,173,26,172,116,157,96,30,
+38,6,98,117,121,106,105,159,122,180,138,31,14,124,248,200,21,251,13,7,94,
+158,116,174,175,157,162,184,30,156,247,6,251,248,129,247,35,29,247,80,6,247,
+33,212,192,242,189,119,184,103,170,31,174,99,76,156,47,27,106,247,18,178,
+163,10,100,252,96,21,247,18,177,7,228,187,114,93,103,106,120,75,31,14,247,
+127,247,227,21,95,116,121,105,105,162,121,183,31,247,117,6,50,131,68,87,251,
+8,27,83,100,151,167,110,31,163,114,128,145,121,27,111,114,114,113,110,163,
+109,184,115,31,111,189,190,127,205,27,247,68,247,15,244,247,42,31,202,7,247,
+49,251,10,247,9,251,50,85,93,128,113,93,30,156,126,126,145,120,27,105,120,
+115,96,31,59,7,96,158,115,173,169,156,156,175,147,30,143,158,145,148,155,
+151,8,157,164,185,152,178,27,223,207,83,56,153,31,14,247,91,247,121,21,251,
+50,152,213,54,247,15,27,189,182,154,167,173,31,189,182,169,237,247,14,26,
+238,120,212,101,186,30,183,103,87,162,78,27,251,16,60,47,251,45,131,31,103,
+247,19,144,6,185,163,157,247,183,29,251,250,7,88,138,118,124,104,151,29,247,
+7,247,134,29,173,115,156,93,31,134,247,18,6,247,135,247,137,21,161,158,132,
+126,154,31,167,116,157,69,55,26,251,19,107,79,70,109,113,153,162,122,30,120,
+168,129,188,211,26,229,151,192,166,167,30,156,156,160,148,163,27,14,248,32,
+247,104,21,251,0,109,7,247,61,10,247,40,6,185,164,157,173,172,114,158,93,
+31,129,247,248,149,198,10,251,114,6,69,85,122,105,99,31,101,107,118,96,93,
+26,79,173,92,209,100,30,92,98,113,107,92,70,116,138,128,138,130,135,8,121,
+132,127,121,118,151,29,198,6,217,247,8,210,215,186,159,8,230,243,21,67,6,
+61,70,175,181,177,186,167,203,31,247,0,6,14,247,44,248,97,21,251,250,86,7,
+118,29,247,250,247,207,187,29,252,4,7,113,183,29,105,163,121,185,30,14,247,
+62,248,96,21,251,247,7,78,137,119,126,101,26,105,163,119,179,141,30,162,140,
+225,138,5,203,138,163,154,177,26,175,119,154,87,141,30,216,7,179,203,179,
+156,170,27,177,166,107,93,95,128,125,95,125,31,105,128,126,124,110,26,109,
+160,121,175,223,208,224,243,239,74,207,44,92,96,126,106,81,30,247,55,194,
+7,140,102,140,128,143,130,8,119,146,159,126,162,27,172,157,159,175,142,139,
+157,138,146,31,138,169,136,212,134,144,59,141,25,251,145,6,63,137,133,134,
+130,66,135,105,24,137,121,139,133,132,26,105,159,119,173,174,152,157,194,
+146,30,142,161,5,14,247,34,247,227,21,222,154,205,195,224,27,174,181,128,
+124,164,31,160,126,147,128,144,118,8,103,147,156,122,169,27,173,158,163,182,
+31,219,7,182,120,163,106,119,125,132,123,127,30,164,94,93,151,84,27,251,50,
+251,10,251,9,251,49,31,76,7,251,42,247,15,34,247,68,205,190,151,167,189,30,
+184,163,163,169,168,26,166,114,163,111,124,124,131,122,121,30,105,103,106,
+128,78,27,251,8,68,191,228,131,31,247,117,6,183,162,157,173,173,116,157,95,
+31,14,57,10,14,34,10,14,34,10,14,34,10,14,69,10,14,247,161,248,96,21,178,
+251,249,6,104,134,122,122,110,26,104,163,122,187,30,210,6,208,188,156,174,
+173,31,170,170,156,182,184,26,192,115,187,96,170,30,108,162,106,150,87,144,
+8,247,10,7,203,140,160,152,177,247,67,29,251,136,6,75,116,125,102,104,163,
+121,187,31,145,251,148,6,60,137,125,104,110,27,137,6,135,140,5,153,7,189,
+125,157,99,100,124,119,86,30,97,7,90,173,115,210,245,195,214,247,36,30,247,
+39,172,21,188,129,161,119,101,26,102,117,120,90,132,30,14,248,17,247,225,
+21,247,20,240,10,63,6,97,116,121,106,110,159,118,170,136,31,251,19,251,1,
+247,19,7,171,142,159,160,168,26,172,116,157,96,30,63,182,10,251,249,7,88,
+138,118,124,104,26,104,163,121,185,30,235,6,182,162,157,172,169,119,159,107,
+142,31,247,18,247,1,251,18,7,108,136,119,118,110,26,106,162,121,181,30,247,
+26,6,247,19,211,195,239,247,3,53,205,251,36,31,130,251,121,21,247,18,157,
+7,205,186,110,97,103,108,120,80,31,14,247,170,248,96,21,196,130,6,121,7,99,
+159,116,174,172,157,160,178,30,164,7,137,169,136,208,126,150,66,138,25,251,
+146,6,68,142,125,126,135,70,138,109,24,138,122,139,139,133,26,99,157,117,
+173,179,153,162,206,140,30,197,251,249,6,79,118,125,101,102,162,125,202,31,
+226,6,202,163,153,176,173,116,156,91,140,31,225,7,179,182,168,154,171,27,
+175,157,113,89,31,74,7,90,138,117,122,104,26,103,163,125,202,30,202,6,202,
+162,153,176,171,121,155,100,143,31,206,7,244,75,210,46,103,104,128,117,101,
+30,14,247,91,243,21,247,248,149,7,186,164,157,247,73,29,158,125,192,137,31,
+251,250,142,29,247,250,7,192,141,158,153,247,65,10,251,12,199,29,149,251,
+248,6,14,247,192,248,214,21,251,48,251,19,251,25,251,55,251,55,247,19,251,
+24,247,48,247,46,247,21,247,24,247,51,232,107,213,76,197,31,188,85,73,165,
+71,27,247,63,251,231,21,50,118,70,79,58,27,58,70,199,228,118,31,223,4,227,
+158,209,202,221,27,221,209,77,50,158,31,251,234,6,14,248,173,243,21,100,241,
+122,184,118,170,105,169,247,145,10,110,148,153,128,247,85,29,101,111,125,
+110,116,30,122,118,105,82,96,61,8,235,7,173,146,155,155,167,26,177,116,153,
+76,192,29,122,73,233,10,105,107,116,105,124,98,100,36,24,100,135,121,122,
+108,247,20,10,174,156,170,153,153,8,251,35,7,101,134,122,123,107,26,103,247,
+150,10,168,122,156,103,145,31,247,35,7,149,130,161,97,150,110,181,33,24,159,
+89,150,130,180,138,8,158,86,247,56,29,39,29,14,157,247,180,21,150,48,147,
+110,161,99,8,53,188,234,84,236,27,247,48,247,19,247,24,247,55,247,56,251,
+18,247,24,251,49,251,2,38,71,34,92,31,246,111,5,198,169,198,177,201,27,191,
+190,112,93,173,31,163,106,149,111,143,87,8,124,55,21,67,106,81,97,70,27,70,
+77,184,208,110,31,14,247,91,248,96,21,193,6,203,162,153,177,177,116,153,75,
+31,251,41,6,75,116,125,101,103,160,125,192,137,31,251,249,7,85,138,119,124,
+104,26,101,162,125,203,30,223,6,202,163,153,176,174,115,157,91,31,135,247,
+23,6,180,198,179,155,181,27,183,152,121,80,31,251,4,7,77,138,118,126,102,
+26,100,162,126,204,30,228,6,203,162,153,177,174,118,154,87,140,31,247,8,7,
+247,9,84,200,32,88,95,127,110,90,30,14,248,37,248,97,21,173,145,156,156,168,
+26,176,116,153,75,30,82,6,76,115,125,103,104,162,122,188,138,31,251,81,7,
+46,247,122,115,195,133,144,95,140,25,93,6,98,115,120,106,112,156,121,171,
+133,31,251,250,7,106,132,123,123,111,26,101,162,125,203,30,194,6,204,162,
+153,177,174,118,154,87,141,31,247,87,7,230,251,117,5,79,163,154,125,173,27,
+163,159,150,158,151,31,146,150,141,153,183,26,168,247,95,21,85,168,111,193,
+193,167,167,193,30,241,7,187,107,169,89,89,106,108,92,30,216,133,21,146,140,
+143,142,144,141,136,131,30,45,7,131,138,136,135,135,137,142,147,30,132,251,
+0,21,87,118,125,104,110,164,123,184,31,165,6,182,164,155,168,174,119,153,
+88,31,14,247,90,247,124,21,244,241,34,247,19,247,140,94,6,141,10,148,165,
+26,247,40,252,111,7,112,132,247,190,10,251,19,80,37,198,251,21,128,6,247,
+30,10,247,107,95,10,43,6,14,247,246,247,106,21,161,7,247,54,247,117,5,183,
+162,157,173,155,168,29,251,12,50,247,13,5,163,149,185,10,119,247,16,29,149,
+132,148,137,164,138,247,55,251,117,24,117,70,7,247,123,10,149,148,136,165,
+27,208,112,78,6,152,10,166,207,247,45,29,116,27,14,247,96,247,123,21,216,
+6,116,140,130,143,131,30,120,147,158,128,161,27,175,157,161,185,31,247,0,
+7,182,120,163,104,118,120,128,122,131,30,134,131,138,129,116,26,62,247,17,
+247,111,95,6,96,158,115,174,174,158,162,183,30,247,40,252,81,7,247,61,10,
+149,251,248,129,164,29,248,103,247,42,6,182,120,163,104,104,120,115,96,30,
+93,251,133,7,132,249,19,95,29,55,10,247,6,247,199,21,116,124,124,117,77,214,
+85,225,224,214,193,201,161,124,154,117,120,129,130,117,132,31,106,130,108,
+247,32,29,247,156,243,21,247,248,247,94,55,7,96,158,116,174,174,158,162,182,
+30,247,80,252,106,247,35,29,191,251,248,87,164,29,247,105,91,29,199,248,243,
+21,153,151,146,247,116,29,128,30,251,0,55,5,125,129,132,128,126,26,121,155,
+123,159,149,148,247,154,10,110,10,249,19,95,29,57,29,251,64,247,131,21,155,
+151,145,247,116,29,127,30,251,0,55,5,125,128,132,128,128,26,120,156,123,159,
+148,148,143,149,152,30,14,81,10,251,12,248,125,247,27,29,120,130,131,116,
+132,31,106,128,109,247,32,29,32,29,251,30,248,14,89,10,33,29,100,249,78,89,
+10,247,221,247,87,21,159,108,197,251,0,152,114,153,118,144,137,25,247,68,
+29,153,74,31,124,6,83,244,115,184,114,170,109,164,25,142,247,20,29,142,142,
+146,151,147,151,147,151,141,141,247,114,29,177,152,222,10,102,85,5,154,132,
+124,149,121,27,130,126,134,132,131,31,128,131,136,130,114,26,80,127,247,0,
+7,202,141,158,151,178,26,177,117,152,74,179,10,203,162,152,177,174,115,157,
+92,31,134,6,133,247,36,151,68,6,106,156,118,166,168,154,157,175,30,14,248,
+2,247,209,21,144,146,152,157,161,170,140,140,141,143,144,146,144,146,143,
+145,141,143,163,175,24,140,140,143,145,146,147,8,96,143,156,120,173,27,176,
+153,247,22,29,101,119,89,105,31,68,36,114,105,133,135,117,138,25,130,247,
+0,6,201,141,158,151,177,26,178,117,152,75,247,82,29,251,249,7,178,10,174,
+109,170,82,198,32,24,155,108,152,122,145,137,146,136,149,138,174,137,8,85,
+164,10,247,50,37,7,80,244,110,190,119,164,109,164,25,14,248,147,242,21,247,
+250,7,79,10,137,133,130,247,135,10,122,26,122,147,123,153,130,247,64,10,247,
+13,95,10,128,247,19,247,98,251,19,128,6,114,130,137,247,106,10,122,122,247,
+90,10,85,247,56,29,248,168,243,21,251,54,247,76,247,45,247,65,5,176,174,10,
+117,149,126,247,28,29,125,149,30,147,128,128,141,113,27,48,6,242,10,123,148,
+123,153,130,30,147,132,147,137,160,247,18,29,186,31,247,2,6,186,162,195,29,
+85,6,178,29,247,50,7,14,247,225,247,72,21,163,146,154,146,163,153,8,35,84,
+7,75,116,125,100,102,162,125,203,31,247,42,190,29,75,115,125,102,104,164,
+121,187,31,143,251,23,6,118,124,132,135,104,121,8,190,7,173,123,159,111,129,
+127,134,132,131,30,128,130,136,131,114,26,69,7,102,144,130,152,138,197,8,
+247,4,7,201,140,159,152,176,26,177,116,153,75,247,119,10,137,31,251,8,7,142,
+251,12,185,87,245,133,8,133,7,106,156,118,166,148,154,144,145,146,30,148,
+147,143,151,162,26,14,248,140,243,21,247,248,7,193,142,184,29,76,115,247,
+13,29,98,79,100,123,154,10,251,9,194,78,247,132,10,35,85,7,75,116,125,101,
+101,162,126,203,138,31,247,29,86,6,95,158,115,174,174,158,162,184,30,247,
+49,7,14,33,29,137,139,29,55,10,247,48,247,224,21,153,122,134,141,127,218,
+10,247,5,29,247,95,248,99,21,158,163,7,185,163,158,175,174,116,157,92,31,
+251,34,6,92,115,121,104,103,163,120,186,31,149,120,106,6,103,247,87,29,166,
+27,172,251,159,247,109,29,247,167,6,208,205,157,167,171,31,169,165,156,182,
+189,26,247,13,52,203,251,55,30,251,13,164,242,247,23,10,36,251,247,21,247,
+26,247,17,7,230,186,114,90,99,107,119,73,31,14,247,192,248,241,21,251,48,
+251,19,251,31,251,62,251,64,247,19,251,30,247,48,247,47,247,20,247,30,247,
+59,236,107,217,76,200,31,190,85,73,166,71,27,247,60,252,3,21,50,112,75,84,
+62,27,57,68,205,233,121,31,145,174,166,141,164,27,165,151,136,123,168,31,
+123,167,160,134,172,27,164,163,143,151,193,31,251,235,209,21,143,183,146,
+163,158,170,8,195,172,194,173,196,27,191,191,110,91,172,31,165,102,150,104,
+140,86,8,133,109,136,139,119,27,116,122,143,148,122,31,170,79,135,140,101,
+27,107,100,132,120,72,31,14,247,195,247,50,21,251,30,247,217,5,152,6,164,
+149,141,145,148,31,155,148,149,157,158,26,156,131,156,125,149,30,147,129,
+127,141,113,27,251,25,247,45,10,122,153,129,30,131,150,149,137,165,27,247,
+95,252,119,5,242,6,247,65,248,37,5,186,157,145,149,148,27,143,145,137,134,
+146,31,126,159,160,132,155,27,176,170,172,178,189,95,174,77,65,94,102,43,
+97,31,14,247,206,125,21,197,142,184,149,169,154,8,201,170,176,196,205,26,
+196,115,182,89,172,30,176,173,156,174,247,125,29,97,30,140,152,5,166,140,
+114,162,110,27,110,132,10,63,247,147,29,208,31,171,6,227,175,119,91,86,92,
+111,50,67,90,153,175,79,31,162,102,125,145,123,27,111,114,113,111,111,153,
+123,188,112,31,197,107,198,120,199,247,197,29,179,129,167,27,204,185,179,
+195,247,106,29,239,248,96,21,142,6,146,6,145,6,144,251,249,6,178,10,173,109,
+171,82,197,32,233,29,152,74,31,124,6,83,245,115,183,114,171,108,164,25,143,
+146,146,148,152,157,159,168,25,141,143,142,143,142,143,144,146,143,145,141,
+143,148,151,146,150,147,151,141,142,247,114,29,176,153,222,10,68,36,115,104,
+133,136,247,124,29,177,26,173,124,152,92,143,30,140,140,5,251,156,251,13,
+247,32,10,156,7,14,247,233,126,21,199,141,192,152,76,10,251,18,234,38,247,
+31,117,30,247,195,10,178,129,167,27,205,185,179,195,247,106,29,248,32,243,
+21,251,33,251,50,6,178,29,193,247,30,7,203,162,153,177,177,118,152,76,140,
+31,247,248,7,193,142,247,162,29,116,247,13,29,97,78,101,124,154,10,251,10,
+194,79,247,132,10,14,168,10,66,127,123,90,30,117,131,128,124,117,26,110,180,
+10,69,114,90,93,31,114,113,124,104,109,26,65,221,80,243,194,198,151,161,185,
+30,140,247,8,113,29,14,247,236,248,79,21,201,178,149,160,160,31,156,158,150,
+169,170,26,175,117,163,105,121,124,131,125,128,30,134,133,132,115,140,130,
+8,128,7,127,136,138,98,138,30,54,6,69,91,121,98,104,31,104,98,125,81,35,26,
+32,154,86,184,94,30,91,185,204,114,214,27,247,35,244,231,247,16,247,19,42,
+228,251,28,82,97,128,113,99,31,149,187,153,149,199,141,8,181,251,14,21,217,
+195,90,71,71,83,90,60,61,83,188,206,169,151,168,160,161,31,165,165,168,150,
+186,27,14,234,243,21,129,247,34,29,247,163,6,206,187,151,162,170,31,168,161,
+156,172,173,26,185,113,170,83,161,30,169,166,153,168,172,26,165,130,162,122,
+157,30,167,112,73,157,61,27,251,120,182,29,6,247,0,84,21,194,245,7,198,173,
+129,123,117,113,132,52,31,53,251,54,21,197,247,19,7,229,159,134,118,118,108,
+128,80,31,14,109,29,14,248,95,22,104,7,88,157,114,176,178,153,161,199,30,
+189,7,141,203,125,156,83,141,8,247,109,7,186,141,160,155,174,26,176,115,153,
+76,30,251,194,6,76,116,125,102,103,163,122,187,31,142,6,144,251,4,6,137,52,
+123,124,53,136,8,105,251,25,6,75,150,121,180,181,153,159,197,30,172,7,247,
+30,247,213,21,247,3,251,109,251,29,6,155,164,149,176,182,26,14,44,10,14,247,
+245,247,159,21,195,7,164,155,148,154,160,26,171,113,157,93,30,107,6,94,113,
+121,107,118,148,125,164,122,31,83,7,70,245,5,173,116,105,247,42,10,148,162,
+149,30,151,105,156,118,163,125,122,126,119,115,125,114,102,74,24,93,138,118,
+122,247,152,29,247,10,155,167,160,159,153,142,25,71,7,115,123,129,124,119,
+247,39,10,155,31,208,7,153,136,160,118,156,111,207,251,10,24,205,6,174,158,
+156,171,175,118,156,93,140,31,102,204,123,165,122,160,120,154,25,164,153,
+154,159,152,174,8,117,149,153,129,163,27,170,156,159,177,31,179,7,179,117,
+159,95,98,105,121,105,116,30,14,247,198,247,59,21,218,186,127,118,116,88,
+121,74,75,78,155,171,78,31,149,120,129,142,126,27,112,113,114,113,107,171,
+112,203,116,31,116,204,197,129,203,27,247,31,226,194,226,180,121,169,101,
+166,31,163,166,150,163,168,26,214,59,193,251,2,88,98,128,115,99,30,193,129,
+128,153,106,27,111,115,118,114,132,141,128,141,128,31,142,125,140,124,110,
+26,121,139,118,138,131,30,177,29,103,127,138,137,130,31,112,247,141,29,14,
+56,29,14,69,29,14,248,130,247,213,21,186,140,160,156,173,247,67,29,251,208,
+6,75,116,125,101,100,160,127,206,138,31,251,56,7,116,135,121,132,130,30,131,
+131,125,133,129,140,8,136,6,133,140,5,178,136,122,158,106,27,103,125,118,
+85,31,92,7,112,173,123,197,247,5,197,196,247,4,30,247,56,247,10,251,110,7,
+94,138,117,122,104,26,103,162,125,203,30,208,6,202,163,153,175,174,117,156,
+93,140,31,14,247,63,247,157,21,232,251,45,5,215,6,228,247,44,5,251,52,108,
+199,10,247,21,6,185,164,157,173,172,119,156,98,141,31,247,110,240,10,251,
+1,6,251,2,251,75,251,4,247,75,5,32,182,10,251,110,136,7,105,115,118,108,105,
+164,121,185,31,247,20,163,10,109,6,14,248,38,247,56,21,79,134,199,10,247,
+7,6,185,163,157,174,173,118,155,88,140,31,247,110,240,10,44,103,10,6,14,39,
+10,14,248,35,247,213,21,251,110,129,7,92,115,122,105,105,163,121,186,31,247,
+12,247,134,29,174,118,154,88,140,31,247,110,7,174,144,156,155,169,26,174,
+115,157,93,30,252,16,6,93,115,121,105,108,156,122,174,135,31,251,110,7,88,
+138,118,124,104,151,29,247,12,6,185,164,157,173,173,115,156,92,31,129,247,
+110,6,14,62,29,247,43,29,100,91,247,199,10,247,244,247,213,21,238,55,6,178,
+29,247,80,252,155,251,80,164,10,223,235,251,109,79,7,92,115,247,132,29,247,
+122,163,10,77,6,14,60,29,14,247,245,248,142,21,138,203,128,155,97,141,8,90,
+80,130,129,127,31,128,130,133,123,121,26,107,158,125,184,30,158,93,6,141,
+121,134,140,130,27,45,66,41,251,17,251,21,207,45,234,148,146,139,141,159,
+31,118,125,7,75,116,126,101,100,161,126,204,31,247,29,6,203,163,153,176,178,
+117,152,73,31,124,160,6,137,162,144,139,148,27,236,206,230,247,23,247,18,
+66,237,46,130,133,138,137,119,31,251,0,251,229,21,138,130,133,138,132,27,
+97,112,185,212,207,169,190,179,144,146,138,137,148,31,247,0,22,141,151,147,
+140,141,27,182,167,92,68,66,112,91,98,132,133,140,141,127,31,14,66,29,186,
+30,247,165,29,130,145,132,141,120,140,8,14,248,131,247,213,21,191,141,160,
+154,174,247,66,10,251,12,182,29,251,110,251,92,247,110,149,247,134,10,173,
+115,247,121,10,160,124,190,137,31,251,110,247,170,29,96,247,140,10,247,38,
+40,7,14,247,127,242,21,63,247,214,251,2,247,110,29,251,110,247,169,10,96,
+247,32,10,247,38,41,247,110,7,190,141,160,154,247,65,10,251,2,251,214,63,
+247,111,6,173,143,155,155,169,26,174,247,154,29,109,155,122,173,135,31,14,
+247,135,247,213,21,251,109,129,7,92,115,247,132,29,247,58,6,247,19,205,183,
+223,177,124,174,112,163,31,167,108,89,152,62,27,98,194,162,91,29,252,4,251,
+80,6,247,156,10,7,247,129,251,109,21,198,162,7,225,163,133,117,119,107,128,
+81,31,14,247,76,247,213,21,156,91,29,251,24,247,34,10,146,251,109,132,247,
+140,29,247,30,6,247,11,206,185,221,178,123,174,112,163,31,166,107,92,152,
+68,27,123,6,251,54,4,197,149,7,206,163,132,118,119,109,129,85,31,247,133,
+247,109,21,251,109,134,7,109,116,116,109,106,161,121,180,31,224,6,186,163,
+156,173,170,121,157,104,142,31,247,111,7,174,144,157,156,169,26,173,115,156,
+92,30,54,6,98,117,121,106,109,162,116,169,31,14,247,95,247,213,21,158,247,
+139,10,251,29,182,29,251,109,129,247,34,29,247,163,6,247,18,205,183,222,177,
+123,175,113,163,31,167,108,89,152,62,27,251,37,6,251,54,4,197,247,19,7,226,
+162,133,117,120,107,128,81,31,14,247,159,247,157,21,95,116,122,105,104,162,
+121,183,31,247,54,6,89,121,87,116,47,27,74,93,151,164,108,31,152,123,129,
+143,125,27,111,114,115,111,78,240,95,247,31,224,199,155,173,185,31,192,179,
+167,197,207,26,247,31,33,236,251,45,87,96,130,120,97,30,150,125,129,143,124,
+27,105,121,115,96,31,79,7,94,158,116,175,168,156,153,169,146,30,142,152,140,
+142,143,145,8,163,154,179,154,192,27,209,181,118,91,166,31,14,247,110,247,
+56,21,32,151,218,67,243,27,247,14,215,226,247,31,247,31,63,226,251,13,35,
+66,75,34,122,31,86,116,10,6,247,138,247,62,21,193,175,90,66,66,102,89,86,
+86,102,189,212,211,176,189,192,31,14,248,26,243,21,120,247,34,10,247,29,163,
+10,129,247,109,149,163,10,251,163,6,251,19,74,95,54,72,179,94,214,121,31,
+114,117,126,126,117,112,8,86,138,118,124,103,26,105,163,121,186,30,198,6,
+143,145,196,213,201,189,210,168,25,179,6,247,54,4,81,251,18,7,52,115,145,
+160,159,170,150,198,31,14,247,48,247,213,21,251,109,211,10,247,109,247,202,
+247,80,6,183,247,108,10,95,30,55,251,254,247,35,29,14,235,242,21,137,6,77,
+29,191,195,159,149,247,15,10,128,108,26,251,169,7,92,140,104,109,83,27,251,
+0,164,29,247,3,6,247,5,140,221,216,242,26,247,182,7,236,66,204,251,0,89,92,
+120,105,103,30,222,247,1,7,155,29,6,14,247,71,247,157,21,187,166,181,160,
+209,27,205,179,120,102,148,31,103,148,153,126,170,27,175,158,162,184,31,199,
+7,182,121,163,105,124,129,135,128,125,30,158,96,97,148,87,27,251,45,33,42,
+251,31,71,167,81,192,99,31,105,185,199,123,224,27,247,31,240,183,200,167,
+114,163,111,125,129,135,126,123,31,114,108,94,127,74,27,46,87,162,189,121,
+31,247,54,6,183,162,157,174,173,116,156,95,31,14,37,29,14,100,29,125,198,
+29,14,93,29,247,140,247,5,10,248,47,247,213,21,182,140,161,157,172,247,67,
+29,251,126,6,76,116,125,102,104,163,121,187,31,142,6,143,251,56,6,138,88,
+131,128,101,138,8,134,6,179,136,122,158,107,27,105,125,118,85,31,92,7,125,
+143,130,148,135,30,130,159,174,132,169,27,237,196,201,246,31,247,56,193,251,
+110,7,106,133,122,122,111,26,105,165,121,188,30,181,6,218,180,146,157,169,
+31,178,163,163,179,183,26,182,118,179,103,164,30,111,158,105,148,86,140,8,
+35,4,185,137,153,131,117,26,119,121,128,104,30,132,6,14,248,23,247,160,21,
+193,240,10,63,6,97,116,121,107,109,159,119,170,136,31,85,251,8,193,7,170,
+141,160,160,169,26,171,116,157,96,30,63,182,10,251,110,7,88,138,118,123,105,
+26,104,163,121,185,30,235,6,182,162,157,172,169,119,159,107,142,31,199,247,
+8,79,7,108,135,119,119,110,26,106,162,121,181,30,247,23,6,247,19,204,183,
+225,230,71,186,251,23,31,109,251,56,21,199,150,7,227,161,133,116,119,108,
+128,80,31,14,247,96,54,29,80,29,80,29,248,22,243,21,94,6,75,116,125,101,101,
+162,125,203,31,247,28,6,202,163,153,176,174,117,156,91,140,31,96,29,14,247,
+138,243,21,63,247,213,251,2,6,93,115,121,104,105,160,124,190,138,31,251,111,
+107,29,248,76,6,194,163,154,175,173,119,156,98,141,31,247,110,7,190,140,160,
+154,174,247,66,10,251,1,251,213,63,247,110,6,172,142,156,156,170,26,173,116,
+157,96,30,61,6,97,117,121,106,107,156,121,172,137,31,14,248,162,244,21,102,
+202,123,166,122,160,120,153,25,164,153,155,160,152,174,8,117,148,154,129,
+162,27,170,156,159,176,31,179,7,179,117,159,96,97,105,121,105,117,30,69,33,
+5,196,7,165,155,148,153,160,26,171,113,157,92,30,107,6,94,113,121,107,118,
+148,126,164,122,31,82,7,70,245,5,173,117,104,247,42,10,149,161,149,30,151,
+105,156,118,163,125,122,127,119,114,125,114,102,75,24,94,138,117,121,247,
+152,29,247,11,155,166,160,160,153,142,25,71,7,115,122,129,125,118,247,39,
+10,156,31,207,7,153,136,160,118,156,112,207,251,11,24,183,97,247,137,10,247,
+39,7,14,247,247,142,21,247,66,247,211,5,173,143,158,157,168,202,29,128,129,
+141,112,27,47,6,242,10,123,147,123,153,130,30,149,132,146,137,161,138,251,
+4,251,93,24,251,0,247,93,5,175,141,160,158,169,202,29,128,129,141,112,27,
+49,6,119,132,138,136,129,31,120,247,164,10,251,211,5,39,137,7,114,129,138,
+133,247,168,29,132,149,153,136,163,27,247,10,243,10,129,130,140,110,27,137,
+6,14,168,247,150,21,98,7,251,26,247,3,41,247,44,247,41,247,5,238,247,21,247,
+24,251,2,231,251,50,67,37,122,120,93,30,114,128,127,124,118,26,110,161,116,
+168,150,150,141,142,152,30,162,232,162,143,184,27,223,189,115,87,164,31,137,
+47,21,89,118,87,111,70,27,70,88,167,189,117,31,14,247,97,248,175,21,190,123,
+161,101,101,123,117,88,30,252,72,137,7,77,29,190,194,160,150,93,10,91,120,
+105,104,30,14,247,48,247,74,21,61,211,10,217,189,6,174,247,150,29,130,126,
+142,116,27,89,194,247,94,55,6,178,29,247,80,247,85,10,84,101,247,24,29,14,
+247,133,136,21,78,247,24,29,200,129,137,6,114,129,138,133,130,247,185,10,
+247,11,243,10,128,131,140,110,27,137,149,208,247,45,29,115,27,71,145,6,247,
+66,247,211,126,10,251,93,24,251,1,247,93,5,175,141,160,158,169,202,29,99,
+29,247,66,251,212,5,14,248,187,247,52,21,184,7,201,111,202,93,181,30,178,
+97,64,165,70,27,251,39,251,4,41,251,20,251,27,247,0,48,247,52,213,237,157,
+161,188,31,158,147,150,156,158,26,167,117,162,110,129,124,136,133,111,30,
+122,64,109,134,96,27,66,89,163,186,114,31,143,243,21,187,170,182,161,202,
+27,201,183,117,91,170,31,251,124,247,225,247,98,10,170,169,124,29,56,29,247,
+0,247,192,247,27,29,119,131,131,112,130,31,111,130,105,120,97,247,57,10,109,
+29,199,248,97,185,29,155,123,159,148,149,247,154,10,247,245,248,61,21,251,
+74,164,29,213,251,109,251,5,6,94,114,121,105,105,164,121,184,31,247,226,6,
+184,164,157,173,173,114,157,94,31,251,5,6,251,88,248,129,95,29,69,29,82,247,
+154,185,29,156,123,157,149,149,247,155,29,247,104,247,215,21,171,146,153,
+155,167,26,176,116,153,75,30,76,6,75,116,125,102,104,160,123,186,138,31,247,
+48,251,160,121,108,123,112,122,122,129,141,25,138,6,138,6,198,137,127,157,
+99,27,98,125,119,79,31,89,7,122,143,128,148,135,30,128,163,182,129,167,27,
+194,186,172,205,178,31,247,95,247,240,5,185,140,159,155,174,26,176,115,153,
+76,30,78,6,76,116,125,102,111,153,123,171,132,31,43,251,55,5,251,21,248,98,
+21,116,124,124,117,77,213,85,225,226,213,193,201,161,124,154,117,120,130,
+131,116,131,31,106,129,108,121,94,247,57,10,33,10,251,117,248,123,72,29,44,
+10,251,166,248,44,72,29,248,4,247,6,21,189,72,173,95,143,137,177,138,25,247,
+74,10,101,190,136,143,110,164,25,208,189,153,152,236,10,92,89,5,151,132,129,
+145,126,27,137,137,139,138,135,31,145,148,142,149,152,26,176,115,153,76,135,
+10,6,175,138,5,134,7,107,154,119,162,156,152,150,157,144,30,66,247,30,21,
+136,132,133,137,126,27,129,182,6,162,140,145,140,153,143,8,133,131,138,134,
+116,26,14,248,121,244,21,89,207,118,167,116,161,116,153,25,205,205,153,151,
+5,109,146,156,125,168,27,177,154,162,198,191,119,159,87,88,95,122,106,109,
+31,73,69,116,115,134,137,117,138,25,129,183,6,193,140,115,29,169,247,87,10,
+146,100,6,178,29,247,36,7,14,248,146,243,21,247,110,7,175,143,156,156,169,
+26,173,115,157,93,30,43,103,10,247,92,79,134,199,29,241,99,6,93,156,117,175,
+175,158,162,184,30,247,35,7,14,248,162,242,21,251,38,247,10,247,19,240,155,
+141,145,140,146,143,25,155,148,149,156,157,26,156,131,154,124,201,10,48,6,
+118,133,114,29,157,122,175,174,29,113,151,31,205,247,76,10,186,30,247,8,247,
+43,10,247,191,247,21,21,176,145,161,146,167,154,8,85,132,7,80,116,124,102,
+102,163,124,197,31,237,140,5,203,140,162,152,176,26,173,117,156,91,140,30,
+247,111,208,10,75,7,103,119,118,131,109,133,8,152,7,173,125,158,114,129,130,
+135,133,132,30,127,129,137,131,114,26,130,7,130,144,136,148,138,155,8,190,
+10,140,60,178,97,220,129,8,114,7,106,154,119,164,165,152,156,175,30,14,248,
+130,243,21,96,29,86,94,7,75,116,125,101,101,162,125,203,31,247,20,247,43,
+10,100,10,247,65,248,19,5,183,157,145,149,148,27,143,145,137,135,146,31,125,
+160,158,133,157,27,175,170,171,176,186,95,173,77,65,94,104,47,97,31,14,56,
+29,247,42,247,226,21,152,123,132,142,128,218,10,247,149,10,157,159,153,133,
+149,120,153,31,14,247,94,248,55,21,172,158,7,186,163,157,175,175,115,157,
+92,31,251,29,6,92,115,120,104,103,163,121,186,31,149,106,107,6,104,247,87,
+29,165,27,171,251,115,247,109,29,247,163,6,247,18,205,185,226,179,124,176,
+112,164,31,168,108,89,153,62,27,251,37,192,244,247,23,10,34,251,203,21,201,
+247,19,7,227,161,133,116,117,108,128,80,31,14,247,195,248,94,21,251,42,251,
+7,36,251,26,251,25,247,7,35,247,39,247,39,247,7,243,247,25,247,24,251,7,244,
+251,36,31,247,30,251,182,21,87,108,94,115,74,27,63,84,176,204,120,31,143,
+169,154,140,158,27,167,151,136,122,168,31,123,167,160,134,171,27,161,161,
+142,146,172,31,251,183,222,21,202,160,194,175,213,27,224,200,90,66,147,31,
+137,125,132,138,130,27,114,122,143,148,122,31,171,79,135,140,101,27,109,114,
+135,123,81,31,14,247,194,247,27,21,36,247,94,5,164,148,141,145,148,31,155,
+149,149,157,157,26,156,131,155,125,150,30,147,247,133,29,251,24,247,45,10,
+123,153,128,30,131,150,150,137,165,27,150,6,247,60,251,229,5,247,0,6,247,
+15,247,147,5,194,165,141,141,148,27,142,145,137,134,146,31,127,160,162,131,
+155,27,176,170,172,177,189,95,174,75,96,110,128,110,109,31,114,116,137,136,
+106,72,8,14,247,224,127,21,189,141,182,147,167,152,8,196,164,172,182,190,
+26,180,122,169,101,166,30,163,166,149,163,168,26,214,59,193,251,1,87,98,128,
+115,100,30,193,128,128,153,107,27,111,115,118,114,132,141,126,140,130,31,
+142,126,140,123,110,26,138,92,5,177,29,31,103,138,127,139,130,137,8,113,247,
+141,29,149,6,217,186,127,118,116,88,121,74,75,79,154,172,78,31,149,120,128,
+142,127,27,112,113,114,113,101,181,109,231,113,31,171,130,163,134,168,136,
+8,247,195,10,179,129,167,27,204,185,179,195,247,106,29,244,247,213,21,172,
+251,109,6,83,138,118,124,103,26,100,162,126,204,247,195,29,174,95,142,137,
+177,138,8,247,93,29,152,71,31,88,208,118,166,117,162,116,153,25,205,205,152,
+151,236,10,74,69,116,115,134,137,117,138,25,129,183,6,193,140,160,153,175,
+247,67,29,251,129,251,79,247,32,10,14,247,244,124,21,247,19,144,229,183,195,
+26,167,114,163,110,247,44,10,176,215,247,103,10,144,131,143,196,29,212,7,
+247,125,10,101,90,247,60,10,65,173,77,201,99,31,173,117,175,129,197,247,197,
+29,178,129,168,27,204,185,179,195,247,106,29,248,22,242,21,90,6,56,138,5,
+251,35,7,95,158,116,174,175,157,162,183,30,180,247,20,7,203,162,153,177,176,
+118,152,77,140,31,247,110,7,187,141,161,156,173,26,176,115,153,76,30,64,6,
+75,116,125,102,104,161,123,188,137,31,76,7,111,88,107,129,99,27,98,124,149,
+167,31,202,7,198,142,157,151,176,26,177,116,153,76,30,58,6,76,116,247,136,
+29,52,192,93,238,189,182,149,161,181,30,14,248,47,146,21,90,116,5,125,132,
+131,127,124,26,122,152,124,153,145,146,141,142,145,30,193,165,142,134,5,112,
+152,153,128,159,27,163,161,161,163,149,135,151,129,155,31,183,161,5,154,147,
+146,150,154,26,157,126,154,124,134,133,137,136,132,30,90,114,58,247,53,5,
+208,167,187,209,212,26,245,49,215,251,19,30,251,125,6,113,132,247,144,10,
+123,147,124,152,130,30,132,148,150,137,164,27,154,252,5,124,6,115,130,247,
+144,10,124,147,124,152,129,30,133,147,153,136,162,27,247,66,6,183,161,155,
+172,154,132,153,126,149,31,146,128,131,141,112,27,80,235,237,6,147,147,139,
+140,149,31,141,132,140,139,146,125,8,251,26,247,185,21,247,10,6,208,181,106,
+84,84,97,106,70,31,251,10,6,14,247,189,248,137,21,251,27,234,10,247,31,251,
+3,247,3,251,30,31,112,251,173,21,251,54,7,53,148,62,214,135,217,8,194,4,145,
+222,213,213,226,150,8,251,60,7,194,84,21,247,59,6,136,66,59,61,55,128,8,247,
+109,4,247,60,7,223,130,215,63,146,56,8,14,248,61,149,21,127,155,150,135,156,
+27,210,186,229,247,30,247,25,90,229,67,57,97,51,251,63,31,251,209,7,113,156,
+121,164,163,156,157,165,30,247,230,4,158,7,208,161,211,160,161,158,71,63,
+47,123,81,113,117,124,175,195,136,30,252,4,247,192,21,251,208,7,138,103,129,
+111,124,134,8,124,131,130,124,122,26,137,7,140,115,158,122,165,141,8,238,
+6,247,6,202,236,247,67,247,6,109,225,85,180,31,109,162,115,147,91,140,141,
+147,140,142,142,142,8,144,146,141,145,147,26,150,133,150,128,145,30,137,140,
+5,143,133,131,141,132,27,113,113,108,100,133,31,134,6,111,121,123,115,116,
+157,123,167,31,225,22,219,138,166,87,251,40,26,42,121,80,105,119,30,131,124,
+122,136,97,27,149,157,148,178,169,26,14,106,29,14,226,22,197,6,163,220,165,
+226,167,201,174,188,25,201,182,214,190,187,27,153,151,130,128,128,132,110,
+128,99,31,76,251,103,5,135,124,137,125,123,26,109,157,119,166,170,162,155,
+197,192,30,124,168,5,98,100,127,129,128,27,133,135,143,144,143,140,145,141,
+146,31,212,247,164,5,142,148,140,150,148,26,190,112,167,88,82,87,111,71,69,
+30,173,240,247,40,206,159,184,251,47,71,182,247,40,251,30,117,124,110,5,145,
+155,147,141,149,27,167,150,131,120,127,136,122,133,120,31,120,82,251,20,84,
+132,100,247,18,193,5,14,248,141,243,21,85,101,110,119,97,27,109,118,145,158,
+102,31,180,195,155,192,222,26,247,11,178,202,215,242,26,208,102,186,84,66,
+79,51,251,9,133,30,135,65,71,150,99,153,114,159,25,110,163,123,172,175,26,
+197,173,170,214,151,30,119,178,92,130,110,128,118,121,25,110,115,122,101,
+96,26,93,159,97,178,103,30,175,106,193,118,221,125,133,57,127,105,102,89,
+8,174,78,99,152,93,27,76,93,109,97,99,182,112,203,188,201,151,153,168,31,
+145,149,145,141,141,27,141,143,137,133,148,31,124,159,181,128,171,27,208,
+191,168,200,176,31,251,205,114,21,116,83,121,134,104,27,101,113,151,157,159,
+166,154,174,171,162,131,110,195,31,247,43,247,242,21,216,144,169,190,181,
+27,171,160,109,97,77,102,96,40,87,31,14,248,6,248,81,21,205,251,38,5,149,
+6,201,247,38,5,251,60,133,7,132,6,121,127,127,122,120,151,129,164,31,198,
+6,163,151,149,158,158,130,147,115,141,31,247,114,7,161,143,146,147,157,26,
+158,128,148,113,30,74,6,87,251,28,86,247,28,5,76,6,113,128,130,120,121,147,
+131,160,135,31,251,114,7,114,137,130,131,120,26,120,152,129,163,30,197,6,
+164,151,149,158,157,127,150,121,31,132,6,133,6,251,1,247,145,21,166,131,150,
+119,128,134,135,124,133,30,152,119,114,145,109,27,69,86,95,81,106,157,108,
+168,122,31,157,129,157,133,177,132,177,132,148,137,152,132,8,151,133,147,
+127,127,26,114,106,120,96,102,103,156,159,133,30,161,133,133,145,123,27,119,
+130,127,113,31,101,7,113,148,127,159,148,144,142,149,148,30,125,166,170,131,
+170,27,216,192,180,199,169,128,163,117,157,31,121,154,116,147,90,148,96,147,
+137,140,127,145,8,127,146,130,152,151,26,164,167,158,175,175,166,124,115,
+144,30,114,145,144,133,157,27,158,148,151,165,31,14,247,66,247,23,21,186,
+185,177,158,188,27,220,204,78,62,69,84,81,73,105,101,157,169,112,31,105,176,
+5,168,112,105,157,110,27,98,107,110,102,116,148,122,159,122,31,146,157,5,
+128,157,135,148,151,26,165,160,159,166,163,168,119,107,163,30,167,100,5,99,
+169,183,116,189,27,186,184,158,172,168,31,172,178,157,183,182,26,215,83,202,
+46,167,30,228,165,178,185,219,26,234,75,205,47,85,99,122,84,71,30,176,110,
+5,186,201,166,152,179,27,199,177,93,67,62,91,82,74,122,127,141,148,114,31,
+145,153,140,145,148,26,167,126,159,121,120,121,117,116,106,169,120,201,133,
+30,75,127,115,128,84,98,8,14,248,141,247,37,21,73,101,78,103,62,27,251,16,
+51,247,4,247,51,247,15,200,241,213,154,149,135,127,157,31,120,114,132,123,
+120,26,115,153,102,160,107,30,176,83,5,165,100,154,97,107,26,109,115,119,
+103,106,115,159,166,149,142,147,149,154,30,98,163,5,125,116,135,129,121,26,
+85,190,98,205,194,184,179,188,171,125,179,115,178,30,107,191,110,190,5,125,
+162,131,163,154,26,175,186,173,190,169,162,131,116,177,30,180,185,120,153,
+129,132,5,151,104,120,142,111,27,96,115,131,110,100,31,166,108,116,149,107,
+27,39,60,251,21,251,54,251,69,247,1,251,19,247,44,237,215,186,227,186,31,
+14,248,19,247,100,21,221,168,189,189,194,26,200,75,181,47,251,53,251,22,251,
+13,251,41,251,9,221,69,247,28,199,208,155,164,186,30,171,156,152,153,157,
+26,149,138,147,133,162,30,89,85,67,113,58,27,44,81,177,212,122,31,202,140,
+221,152,197,159,8,251,87,160,21,149,181,151,165,163,167,8,191,183,214,172,
+213,27,192,176,117,108,116,119,116,102,121,31,98,119,36,109,90,134,67,131,
+24,14,247,4,22,247,233,6,168,194,5,96,6,156,205,5,154,193,150,219,184,26,
+247,1,89,194,40,30,251,16,6,73,138,136,140,127,185,8,142,137,147,137,147,
+30,135,114,138,126,121,26,90,155,124,191,30,247,7,6,192,155,137,127,158,31,
+162,125,154,107,101,26,96,132,86,126,82,30,115,36,5,251,135,6,14,247,59,22,
+247,59,6,175,184,154,116,147,130,159,126,25,146,167,141,155,140,171,140,217,
+24,141,226,5,168,139,159,140,146,30,147,247,0,139,139,149,26,186,120,157,
+80,147,30,81,147,100,146,130,144,128,161,25,122,119,134,129,128,26,115,168,
+119,177,137,30,154,138,157,138,156,138,8,146,146,136,137,143,31,151,131,143,
+121,140,87,8,55,7,138,37,133,82,124,83,8,251,44,6,14,248,149,211,21,251,195,
+247,196,145,140,5,142,6,144,140,167,143,156,144,176,156,25,146,142,142,142,
+145,26,145,133,144,132,30,134,6,136,118,133,139,126,27,103,92,147,155,86,
+31,140,137,137,139,138,27,133,135,135,135,134,140,136,142,126,31,152,95,146,
+93,105,26,129,139,132,138,127,30,128,7,129,143,133,146,145,142,142,151,144,
+30,149,160,152,185,141,156,8,142,7,139,139,142,140,141,30,247,196,251,195,
+5,14,246,211,21,168,111,247,195,247,195,5,81,148,157,90,153,27,146,143,145,
+149,142,139,142,138,144,31,138,168,5,173,146,185,152,183,30,142,152,140,142,
+144,26,143,135,143,133,138,137,139,138,137,30,125,90,87,130,103,27,130,129,
+139,140,130,31,140,125,139,139,137,27,132,133,134,133,133,142,136,146,136,
+31,176,122,156,134,167,135,144,138,24,142,6,146,138,5,14,246,248,56,21,247,
+196,251,196,5,132,6,136,138,134,138,111,136,123,134,101,122,25,132,136,136,
+135,134,26,133,145,134,146,30,144,6,141,161,143,139,153,27,173,193,130,125,
+187,31,138,141,141,139,140,27,145,143,143,143,144,138,142,136,152,31,126,
+183,132,184,173,26,140,168,5,140,144,139,142,143,26,148,135,145,132,133,136,
+136,127,133,30,130,118,125,92,137,123,8,136,7,139,139,136,138,137,30,251,
+195,247,196,5,14,248,149,248,56,21,111,168,251,196,251,196,5,198,130,122,
+187,125,27,132,135,133,130,31,127,7,140,127,139,133,128,26,105,132,94,126,
+95,30,136,126,138,136,134,26,135,143,135,145,140,141,139,140,141,30,153,188,
+191,148,175,27,148,149,139,138,148,31,138,153,139,139,141,27,146,145,144,
+145,144,136,143,132,142,31,102,155,123,144,110,143,134,140,24,136,140,5,133,
+6,14,166,219,21,211,104,180,110,187,88,8,167,6,119,186,125,160,97,180,8,248,
+67,171,252,68,6,179,178,156,163,159,185,8,111,6,93,91,93,107,70,104,8,247,
+115,4,248,67,6,100,100,122,115,119,93,8,167,6,187,189,185,171,206,171,8,160,
+7,70,172,93,172,94,187,8,111,6,159,91,154,118,180,99,8,252,68,6,14,168,213,
+21,248,68,6,99,101,122,115,119,92,8,167,6,184,186,185,172,209,174,8,160,7,
+68,174,94,171,94,186,8,112,6,158,93,158,112,177,103,8,252,68,6,247,115,4,
+207,106,185,106,186,90,8,167,6,121,182,118,170,102,174,8,248,67,170,252,68,
+6,179,177,156,163,159,186,8,111,6,95,92,91,105,70,106,8,14,247,96,247,15,
+21,100,158,126,145,79,166,8,122,6,220,81,241,45,182,81,182,199,247,1,239,
+213,188,140,140,24,128,6,128,94,119,107,76,31,248,17,7,178,119,151,133,199,
+112,8,159,6,54,197,48,223,87,207,85,72,66,72,39,63,8,138,143,143,139,141,
+27,151,178,156,175,208,31,182,252,39,21,248,62,7,193,180,192,99,5,252,65,
+7,86,100,5,14,247,37,22,130,185,161,136,165,27,191,194,162,175,175,31,186,
+185,169,222,221,26,199,122,188,107,171,30,168,110,92,159,100,27,100,108,132,
+117,79,31,156,95,5,153,180,159,143,164,27,183,186,120,113,160,31,155,118,
+146,114,140,98,8,251,68,6,102,137,137,110,119,144,135,164,31,247,72,6,251,
+0,123,82,84,42,27,123,133,139,142,93,31,14,247,246,247,180,21,230,7,165,138,
+146,132,149,247,41,29,129,113,26,48,251,30,7,117,126,137,134,130,247,61,29,
+123,153,130,30,131,151,147,137,167,27,247,30,251,10,6,116,141,128,145,131,
+30,123,149,156,130,158,165,29,147,166,26,247,10,247,29,7,166,147,140,145,
+149,247,54,29,127,141,113,27,252,19,247,207,21,117,126,201,29,122,26,122,
+147,123,153,129,30,132,151,147,137,167,27,248,20,6,165,147,140,145,149,31,
+155,148,149,157,157,26,173,115,156,93,30,14,247,153,251,37,21,180,250,106,
+98,6,14,247,81,251,138,21,177,6,138,250,251,5,102,6,247,38,254,251,21,177,
+250,251,101,6,14,230,22,190,6,247,52,248,25,247,53,252,25,5,190,6,251,66,
+248,71,5,64,6,14,230,248,70,21,247,66,252,70,5,214,6,247,66,248,71,5,88,6,
+251,53,252,25,251,52,248,25,5,88,6,14,247,172,248,68,21,47,126,72,58,40,26,
+46,209,56,228,126,30,36,7,61,131,110,118,130,136,142,154,129,30,154,129,126,
+147,124,27,115,124,124,116,112,162,120,174,165,166,152,162,161,31,168,170,
+146,170,227,26,206,7,236,150,210,221,241,26,239,69,217,41,148,30,203,7,208,
+148,167,161,145,145,135,128,146,30,120,151,149,133,156,27,162,155,154,161,
+166,116,158,107,116,115,131,124,121,31,103,111,126,96,50,26,180,77,21,213,
+129,191,77,61,26,61,87,76,65,128,30,98,22,70,151,91,202,217,26,216,189,202,
+206,148,30,14,243,248,209,21,103,109,110,103,102,168,110,247,153,29,247,88,
+252,78,247,19,29,247,88,248,78,247,19,29,14,241,247,23,21,104,108,109,107,
+100,167,109,177,175,168,168,175,176,110,168,103,31,248,78,4,104,108,110,106,
+100,168,109,247,153,29,247,218,252,145,21,104,169,110,174,176,168,168,175,
+175,110,169,103,102,110,110,103,30,248,76,4,105,169,109,174,176,168,168,175,
+176,110,168,103,102,110,111,102,30,14,247,158,247,214,21,251,50,203,29,238,
+6,97,67,5,82,6,247,174,29,124,153,129,30,131,150,148,137,165,27,135,132,5,
+134,130,135,125,129,26,115,163,117,167,159,156,150,159,151,30,170,194,5,247,
+159,6,161,247,182,10,202,10,251,99,6,180,211,5,247,58,126,29,32,6,181,212,
+5,204,126,29,133,6,145,148,5,144,149,142,148,149,26,167,115,162,110,121,121,
+126,120,128,30,106,82,5,251,151,203,29,247,92,6,14,146,247,99,21,248,154,
+251,144,5,134,149,148,137,148,27,159,157,159,162,158,130,152,116,150,31,251,
+237,247,65,247,237,247,61,5,162,150,148,151,159,26,162,121,159,120,130,130,
+136,134,128,30,251,144,251,139,21,247,151,251,7,5,134,150,149,136,147,27,
+160,157,160,163,160,128,154,114,149,31,59,171,219,171,5,164,149,150,153,160,
+26,164,121,160,117,131,130,137,134,128,30,14,248,236,247,99,21,252,154,247,
+139,5,144,128,130,142,131,27,119,121,119,116,119,148,127,162,128,31,247,237,
+251,61,251,237,251,65,5,116,128,130,126,120,26,116,157,119,159,148,148,141,
+144,149,30,247,144,247,144,21,251,151,247,8,5,144,129,129,141,131,27,117,
+121,118,114,118,150,125,164,129,31,219,107,59,107,5,114,129,128,125,117,26,
+115,157,118,161,146,149,142,144,150,30,14,247,56,174,21,224,6,247,46,172,
+144,165,184,31,206,180,180,214,224,26,233,85,225,62,170,30,187,212,5,144,
+147,142,145,143,26,149,132,146,130,129,133,135,125,130,30,86,60,5,147,97,
+120,140,251,2,27,251,86,6,120,129,132,126,126,150,131,157,31,247,89,6,217,
+169,138,134,174,31,251,141,252,11,5,48,6,120,129,132,126,126,151,131,157,
+31,202,6,81,51,5,133,130,136,133,135,26,130,146,132,149,149,145,143,153,148,
+30,236,247,38,21,247,135,248,3,5,208,118,191,62,60,26,78,107,77,89,105,30,
+112,99,100,133,251,34,27,14,148,10,247,86,251,173,21,40,118,64,76,40,27,83,
+87,162,180,102,31,113,167,128,163,128,185,8,194,4,242,160,215,204,238,27,
+236,214,73,37,159,31,14,247,186,248,137,21,251,28,234,10,247,30,251,3,247,
+4,251,29,31,251,49,252,3,21,111,174,129,169,184,26,247,5,224,225,247,5,180,
+160,132,108,190,30,178,100,21,170,100,147,116,94,26,251,8,55,54,251,8,93,
+110,148,167,101,30,14,106,29,247,88,183,21,118,120,121,119,115,156,121,162,
+161,157,157,161,161,121,157,117,31,14,185,22,194,247,117,248,85,194,252,85,
+247,116,84,6,14,188,247,117,21,248,86,251,117,194,248,140,84,251,116,252,
+86,6,14,188,248,85,21,247,117,252,85,194,248,85,247,117,194,252,141,6,14,
+230,251,52,21,248,57,194,252,57,6,140,248,178,21,247,65,252,70,5,214,6,247,
+64,248,71,5,85,6,251,47,252,25,251,50,248,25,5,85,6,14,247,228,251,138,21,
+135,247,254,203,247,3,247,101,131,8,202,7,78,138,251,90,133,61,251,44,145,
+252,5,25,14,247,111,4,188,153,138,137,157,31,190,131,183,113,166,100,8,184,
+75,163,251,13,251,55,26,98,201,193,7,200,137,185,135,187,30,131,232,109,235,
+103,184,8,191,98,66,171,61,27,77,6,14,247,111,4,201,140,238,141,224,194,178,
+227,25,172,214,155,247,0,247,42,26,190,76,7,251,67,131,77,105,39,30,104,45,
+80,102,251,6,140,8,118,6,14,247,165,249,129,21,134,252,39,222,251,26,247,
+145,146,8,202,7,251,72,133,73,223,118,247,154,8,136,164,138,149,162,26,155,
+140,166,140,165,30,14,233,173,21,248,49,6,251,98,248,78,5,251,19,252,24,21,
+247,19,247,164,247,19,251,164,5,14,233,178,21,248,78,247,99,252,78,247,98,
+5,193,251,225,21,247,146,7,247,164,251,19,5,14,234,248,112,21,247,98,252,
+78,247,99,248,78,5,251,225,85,21,247,145,6,251,19,251,164,5,14,209,247,138,
+21,248,78,251,99,5,248,49,7,251,218,251,98,21,247,164,247,19,5,251,146,7,
+14,183,247,223,21,247,155,251,182,247,151,247,179,251,157,247,184,5,14,132,
+247,220,21,247,200,251,232,247,200,247,232,251,200,247,233,5,251,157,251,
+232,21,247,157,247,179,247,157,251,179,251,157,251,180,5,14,247,194,248,53,
+21,70,84,84,69,69,193,82,207,206,194,195,209,208,85,196,73,31,137,79,21,174,
+168,109,103,103,110,109,105,103,110,168,176,175,167,169,175,31,14,247,8,251,
+42,21,247,138,165,51,249,238,227,165,251,138,6,174,254,8,21,249,238,227,253,
+238,7,14,247,8,251,42,21,247,138,250,34,251,138,113,227,253,238,51,6,247,
+15,22,249,238,227,253,238,7,14,126,152,248,237,155,6,242,10,247,0,11,175,
+156,144,143,143,147,143,142,142,151,146,146,12,12,186,143,142,143,144,142,
+152,147,160,144,144,170,12,13,248,236,20,183,19,1,159,2,0,1,0,17,0,34,0,43,
+0,51,0,58,0,92,0,97,0,152,0,159,0,218,1,41,1,65,1,74,1,87,1,126,1,196,1,212,
+1,215,1,223,1,230,2,12,2,38,2,72,2,152,2,179,2,246,3,56,3,64,3,71,3,144,3,
+187,3,191,3,203,3,210,4,13,4,30,4,37,4,62,4,188,4,199,5,66,5,123,5,177,5,
+206,6,1,6,8,6,15,6,66,6,117,6,215,7,19,7,52,7,132,7,192,7,242,8,3,8,49,8,
+56,8,64,8,138,8,165,8,190,8,197,8,204,8,250,9,17,9,34,9,88,9,133,9,155,9,
+179,9,196,9,233,9,251,10,2,10,64,10,117,10,144,10,171,10,194,10,234,10,255,
+11,9,11,12,11,42,11,69,11,85,11,98,11,105,11,115,11,139,11,155,11,192,11,
+202,11,222,12,14,12,25,12,56,12,59,12,67,12,112,12,154,12,158,12,188,12,204,
+12,239,13,9,13,13,13,46,13,60,13,65,13,85,13,112,13,147,13,155,13,194,13,
+224,13,254,14,5,14,21,14,36,14,49,14,70,14,86,14,95,14,102,14,122,14,130,
+14,165,14,173,14,206,14,215,14,219,14,237,14,251,15,27,15,46,15,64,15,67,
+15,73,15,81,15,94,15,110,15,142,15,157,15,186,15,211,15,231,16,5,16,12,16,
+24,16,29,16,38,16,59,16,74,16,90,16,95,16,100,16,118,16,130,16,145,16,151,
+16,164,16,191,16,196,16,211,16,222,16,233,16,242,16,249,16,255,17,3,17,15,
+17,34,17,53,17,79,17,104,17,114,17,121,17,132,17,157,17,164,17,169,17,189,
+17,195,17,202,17,213,17,219,17,243,17,250,18,3,18,27,18,41,18,51,18,57,18,
+73,18,82,18,105,18,110,18,133,18,150,18,173,18,187,18,201,18,206,18,228,18,
+243,19,2,19,15,19,28,19,33,19,45,19,53,19,60,19,81,19,102,19,123,19,144,19,
+165,19,184,19,195,19,215,19,231,19,251,20,2,20,7,20,17,20,21,20,29,20,38,
+20,50,20,69,20,88,20,107,20,126,20,145,20,151,20,166,20,184,20,196,20,208,
+20,226,20,244,21,6,21,24,21,36,21,49,21,54,21,65,21,72,21,83,21,91,21,108,
+21,125,21,142,21,154,21,163,21,180,21,188,21,204,21,213,21,229,21,245,21,
+253,22,13,22,29,22,41,22,57,22,73,22,83,22,97,22,108,22,122,22,136,22,146,
+22,156,22,166,22,174,22,182,22,190,22,198,22,205,22,210,22,216,22,224,22,
+229,22,235,22,250,23,9,23,19,23,34,23,48,23,62,23,76,23,90,23,100,23,114,
+23,124,23,129,23,136,23,146,23,160,23,174,23,183,23,188,23,197,23,206,23,
+215,23,224,23,230,23,243,23,252,24,9,24,22,24,29,24,42,24,48,24,61,24,74,
+24,87,24,98,24,105,24,112,24,119,24,131,24,140,24,152,24,164,24,176,24,188,
+24,200,24,212,24,224,24,236,24,248,25,4,25,9,25,21,25,33,25,45,25,57,25,67,
+25,75,25,83,25,91,25,99,25,107,25,115,25,121,25,127,25,133,25,144,25,155,
+25,166,25,177,25,188,25,199,25,210,25,221,25,232,25,243,25,254,26,9,26,20,
+26,31,26,42,26,53,26,64,26,73,26,78,26,81,26,85,26,90,26,95,26,99,26,104,
+26,109,26,112,26,117,26,123,26,129,26,134,26,139,26,143,26,148,26,152,26,
+157,26,162,26,168,26,173,26,178,26,184,26,191,26,197,26,203,26,211,26,216,
+26,223,26,226,26,231,26,240,26,249,26,252,27,3,27,12,27,19,27,26,27,35,27,
+41,27,44,27,48,27,51,27,58,27,61,27,64,74,29,251,13,240,47,247,24,247,24,
+240,231,247,13,30,11,168,10,66,127,123,90,30,117,131,128,124,117,26,110,90,
+29,11,92,10,247,194,106,10,42,6,11,87,10,148,123,152,134,10,11,116,29,157,
+173,189,29,11,247,90,247,104,21,231,6,179,125,226,40,191,46,142,133,24,186,
+10,101,197,99,186,96,176,86,29,6,247,103,4,247,75,10,11,247,91,64,10,11,247,
+195,248,73,21,251,42,251,7,41,251,20,251,19,247,7,40,247,39,247,39,247,7,
+238,247,19,247,18,251,7,239,251,36,31,134,36,21,228,206,86,69,70,72,85,52,
+52,72,193,208,208,206,193,224,31,11,248,157,248,147,58,10,11,248,6,247,180,
+21,247,44,247,65,5,177,174,10,118,149,125,247,28,29,124,201,10,48,6,119,247,
+111,10,123,148,123,152,130,30,148,132,146,137,161,247,18,29,185,31,247,3,
+6,185,163,195,29,6,247,1,29,247,94,10,14,247,174,248,62,21,251,31,6,121,120,
+136,134,132,247,135,10,121,151,29,170,251,111,85,247,13,10,122,151,29,247,
+189,172,10,251,27,247,27,6,211,230,179,163,169,27,152,148,135,127,153,31,
+125,155,150,134,154,27,168,164,163,168,157,131,152,118,156,31,164,107,106,
+151,103,27,89,104,124,85,61,31,11,247,8,10,121,26,123,83,10,176,141,159,158,
+169,26,156,131,155,125,149,30,146,99,29,11,78,10,93,27,56,89,156,29,11,212,
+10,154,125,150,222,29,147,123,153,91,10,11,247,53,10,173,143,158,166,10,129,
+30,132,150,150,137,165,247,8,29,159,147,141,144,148,31,154,148,149,157,156,
+26,156,131,154,125,149,30,169,29,11,248,127,247,213,21,141,91,29,251,4,6,
+92,115,121,104,105,160,124,191,137,31,251,25,7,69,116,110,82,114,118,145,
+150,124,30,123,152,131,166,181,26,247,129,251,2,7,247,147,10,251,26,7,251,
+22,207,67,247,14,196,186,155,171,173,30,174,172,157,190,209,26,11,131,29,
+94,27,251,10,64,228,10,100,146,154,124,65,29,11,50,29,14,21,156,153,146,149,
+152,167,29,248,41,247,122,52,10,11,21,251,19,128,7,132,29,247,250,6,79,10,
+138,133,130,247,65,29,123,147,123,153,129,247,64,10,247,13,6,186,162,197,
+29,128,247,19,6,11,247,3,10,156,174,247,108,29,147,128,129,140,161,29,133,
+138,136,129,73,10,146,202,10,108,6,11,247,60,10,80,160,88,180,100,31,92,189,
+202,119,237,27,213,203,150,159,180,31,183,160,162,165,166,26,167,115,163,
+109,110,29,11,203,242,21,95,247,144,29,240,6,247,135,248,2,5,251,154,120,
+199,10,247,21,6,185,163,157,174,173,118,154,88,141,31,247,248,150,7,185,163,
+157,173,173,115,157,93,31,251,9,6,251,135,252,0,5,247,152,170,7,186,163,157,
+173,173,114,157,93,31,251,21,6,92,115,121,106,105,159,122,180,138,31,11,247,
+127,10,132,142,129,27,118,121,122,118,247,55,29,162,158,141,142,247,128,10,
+131,135,129,127,30,14,248,157,248,147,221,10,89,27,251,19,45,65,40,247,97,
+10,206,128,154,135,247,84,29,76,77,166,171,129,30,131,166,139,139,132,146,
+8,149,157,29,247,32,232,207,242,190,119,179,99,170,31,107,164,100,152,51,
+154,65,153,134,247,37,10,115,102,119,29,11,221,10,88,27,251,18,45,65,41,247,
+97,10,205,127,155,135,161,129,247,142,29,67,75,77,166,171,129,30,131,165,
+139,139,132,147,8,148,157,29,247,31,233,208,241,190,119,179,99,170,31,107,
+163,100,153,51,154,63,153,136,247,37,10,114,103,119,29,11,70,29,247,15,251,
+150,45,29,170,29,122,147,124,73,29,21,247,104,29,123,130,133,122,130,31,154,
+102,97,147,91,27,251,14,51,207,10,80,86,97,151,162,111,30,169,130,122,153,
+111,27,120,247,93,10,130,113,26,107,7,93,157,118,176,152,148,142,147,150,
+30,121,178,190,130,197,27,247,23,234,197,219,185,112,181,94,163,31,128,29,
+11,21,154,154,247,48,10,35,5,118,117,137,136,247,167,10,244,21,160,162,139,
+139,153,26,159,121,157,119,127,130,135,127,128,30,37,35,5,119,117,137,136,
+247,160,29,248,238,84,29,92,29,186,184,170,155,184,27,199,112,10,11,247,98,
+29,149,147,216,29,115,140,130,145,130,30,124,149,157,129,247,122,29,147,166,
+26,247,0,7,159,138,145,136,149,30,157,132,118,153,117,27,122,123,131,126,
+129,31,131,128,137,129,113,26,136,62,247,19,247,118,95,7,116,141,128,145,
+247,59,10,11,247,51,29,154,136,142,117,157,31,247,17,29,160,149,247,94,29,
+104,10,129,129,122,105,29,162,29,113,131,184,10,136,131,119,120,30,119,117,
+104,126,106,27,104,109,147,160,89,120,29,11,247,51,165,21,111,188,181,128,
+189,27,247,48,247,19,247,24,247,55,210,121,194,97,196,31,189,199,5,156,159,
+143,147,153,26,167,116,161,110,119,130,133,114,118,30,95,86,5,170,90,92,153,
+87,27,251,49,251,19,251,24,251,56,65,159,81,185,81,31,84,72,5,121,118,135,
+131,125,26,112,163,117,168,159,148,144,164,160,30,247,236,248,51,21,153,111,
+148,103,105,26,36,59,52,44,113,117,144,152,114,30,65,208,21,119,172,130,173,
+178,26,244,218,226,235,168,165,132,123,166,30,11,247,90,247,83,21,233,6,234,
+189,74,10,248,187,248,21,21,160,159,144,147,156,26,166,116,161,111,120,130,
+134,119,118,30,94,94,5,156,102,86,150,94,27,251,36,251,7,39,251,18,90,157,
+92,174,97,31,93,94,5,118,119,134,130,123,26,111,162,117,168,156,147,144,160,
+162,30,192,192,5,120,182,178,131,186,27,247,38,247,7,239,247,18,187,122,184,
+106,181,31,62,64,21,152,120,145,119,118,26,69,72,86,50,124,130,140,143,120,
+30,51,194,21,125,160,132,159,161,26,208,206,193,226,155,150,138,134,161,30,
+11,31,120,133,125,118,117,26,118,149,124,156,131,30,251,58,251,28,5,247,22,
+235,29,129,141,112,27,251,42,204,29,150,251,250,128,6,114,130,138,247,106,
+10,122,121,247,16,29,132,149,154,136,162,27,247,42,181,10,11,156,186,184,
+31,171,173,158,185,184,26,247,0,47,215,251,21,30,251,125,6,113,131,247,190,
+10,251,250,194,29,247,106,106,10,44,6,247,250,4,247,6,6,206,179,108,87,86,
+99,108,72,31,251,6,6,14,248,128,247,110,21,162,152,141,144,147,247,9,10,252,
+20,6,200,29,121,247,16,29,131,149,151,137,165,27,14,178,160,8,185,163,168,
+172,167,247,52,10,128,133,8,125,114,101,131,93,27,251,9,64,247,26,10,148,
+128,143,117,8,100,147,154,124,149,10,82,27,251,48,251,11,251,10,251,47,31,
+75,7,11,247,98,29,148,148,216,29,122,10,116,49,113,135,11,173,143,157,157,
+169,191,10,122,147,123,153,129,30,132,150,149,137,166,27,150,251,20,251,98,
+247,20,150,6,164,149,140,145,247,52,29,247,6,29,109,157,121,173,135,30,251,
+250,137,7,114,129,11,117,10,251,94,6,56,211,87,247,9,193,217,155,161,188,
+30,179,157,152,152,164,26,168,116,162,110,127,133,137,130,120,30,118,95,91,
+128,87,27,102,112,145,151,128,31,134,144,137,148,158,26,11,247,93,248,98,
+21,171,146,153,155,167,26,177,116,152,75,30,72,6,76,115,125,103,103,161,123,
+188,137,31,247,61,251,179,118,104,120,107,121,122,126,141,25,138,6,135,145,
+6,193,123,161,101,100,125,118,80,30,90,7,102,179,117,209,203,177,166,216,
+184,30,247,110,248,7,5,186,141,161,156,172,247,67,29,75,6,75,116,125,102,
+111,153,123,171,132,31,251,0,251,75,5,11,209,242,21,101,138,116,120,108,26,
+122,148,123,152,130,30,132,149,154,136,163,27,247,96,138,29,153,130,30,148,
+132,146,137,161,138,8,247,0,251,250,21,247,250,245,7,231,143,207,70,141,40,
+8,94,7,44,77,81,40,143,30,11,247,14,10,247,107,6,162,151,196,10,148,30,147,
+128,130,141,113,27,247,118,248,51,126,10,251,94,24,251,1,247,94,5,11,247,
+127,248,61,21,251,2,247,110,29,251,109,126,7,104,115,118,108,105,163,121,
+185,31,247,4,6,185,164,157,172,162,123,160,119,144,31,141,131,127,141,122,
+27,240,7,184,145,160,157,160,30,167,163,165,153,167,27,183,158,108,70,31,
+252,11,164,10,248,10,7,247,20,76,215,33,96,110,129,112,107,30,11,113,131,
+247,179,10,132,150,149,136,166,27,151,33,6,168,100,89,154,82,27,62,82,119,
+96,92,31,92,96,115,83,76,26,75,163,83,186,96,30,96,186,196,119,215,27,197,
+179,151,170,188,31,109,247,12,7,163,150,137,29,127,11,247,246,247,214,21,
+224,6,163,247,171,10,124,150,30,146,129,129,141,111,27,54,247,1,6,165,138,
+146,132,149,30,154,130,121,247,176,10,251,1,53,7,247,11,29,150,150,137,165,
+27,225,11,247,69,248,3,21,247,145,252,3,5,244,248,97,6,101,29,11,21,125,126,
+129,119,123,31,112,119,247,113,29,89,121,146,114,27,109,110,124,110,113,31,
+121,117,129,121,125,26,120,154,125,158,151,148,143,151,148,30,175,168,146,
+144,155,171,10,21,116,153,29,117,27,14,91,108,118,105,94,98,10,11,130,30,
+131,150,150,137,165,27,188,6,106,251,130,67,247,95,5,251,0,6,67,251,95,106,
+247,130,5,182,6,163,150,141,144,149,31,155,149,149,156,157,247,118,29,111,
+27,251,23,6,112,132,138,133,129,31,122,129,130,123,119,26,111,155,122,169,
+135,30,201,252,98,5,247,10,6,11,247,246,248,97,21,236,204,10,251,194,6,129,
+29,236,251,250,42,6,113,150,10,104,163,122,185,30,11,247,15,10,128,108,169,
+10,161,153,141,144,147,31,155,148,149,157,157,247,63,10,247,39,29,11,247,
+98,10,169,170,124,29,216,10,130,141,111,27,11,251,111,6,112,247,169,29,154,
+129,30,131,149,150,137,166,27,196,6,251,44,251,249,5,95,115,121,105,104,162,
+122,186,31,247,25,247,184,10,147,202,10,122,6,159,186,5,11,215,29,8,251,111,
+194,10,247,4,247,134,29,155,131,154,125,150,31,146,202,10,137,11,26,84,223,
+10,128,30,125,110,131,136,127,27,126,132,144,149,11,136,164,27,170,251,60,
+6,88,88,116,127,90,27,81,113,159,184,31,247,161,251,12,7,247,189,10,150,136,
+166,27,151,251,62,6,82,159,97,179,110,30,115,173,181,127,185,27,193,171,152,
+179,186,31,98,11,247,195,247,43,21,251,30,247,202,5,152,247,46,10,154,125,
+149,30,147,129,127,141,113,27,251,25,6,114,130,137,134,129,247,181,10,165,
+27,247,95,252,97,5,242,6,11,31,105,132,7,247,189,29,150,137,165,27,146,251,
+111,128,123,29,248,106,95,10,11,127,131,122,128,30,68,247,148,29,155,124,
+159,153,151,147,156,150,247,81,10,171,164,181,29,6,93,115,121,105,105,163,
+122,185,31,144,85,251,92,116,10,11,229,242,21,194,29,247,187,6,247,13,219,
+201,234,198,105,186,71,171,31,180,170,157,172,183,26,232,54,207,251,7,30,
+251,145,247,88,10,11,248,239,21,251,12,6,247,12,29,149,150,137,166,27,151,
+252,33,11,216,10,129,141,112,27,11,21,140,152,140,151,147,26,185,100,175,
+90,89,100,103,93,132,140,126,140,126,30,168,251,172,5,106,142,161,119,172,
+27,171,161,159,172,142,31,90,251,128,21,181,172,170,178,178,106,170,97,31,
+122,6,98,106,108,100,100,172,108,180,31,11,154,27,147,146,146,148,146,136,
+143,132,145,31,99,172,120,161,109,188,136,143,136,144,136,144,8,136,144,135,
+145,139,26,247,100,29,106,82,114,107,103,111,8,126,128,136,134,133,26,129,
+146,132,147,153,11,247,250,240,10,252,16,182,10,251,250,7,88,138,118,124,
+104,151,29,247,12,163,10,129,247,248,6,14,247,246,248,96,21,233,198,10,251,
+188,164,29,233,251,248,45,164,29,247,188,198,10,45,6,251,49,11,247,38,10,
+128,118,117,154,128,167,31,218,6,168,154,150,161,158,126,151,115,210,29,11,
+165,119,94,31,251,58,7,101,116,120,107,104,163,122,186,31,228,6,247,36,10,
+129,145,247,94,10,247,62,247,111,29,92,27,86,106,126,99,93,31,11,178,170,
+168,177,176,108,169,100,31,121,6,101,107,109,102,102,170,109,178,31,11,217,
+29,122,148,122,153,10,252,20,11,117,29,14,193,144,6,185,163,156,247,183,29,
+251,110,7,88,138,118,123,105,26,104,163,121,185,30,247,7,91,29,134,199,11,
+164,138,147,132,173,29,129,113,26,59,108,7,112,132,138,133,129,160,29,132,
+149,152,136,164,27,170,11,248,150,248,61,21,251,31,6,200,29,122,247,16,29,
+132,11,27,150,251,250,194,29,247,106,106,10,44,6,11,248,60,247,103,127,10,
+11,154,128,30,132,150,152,136,165,27,11,240,29,251,23,247,2,46,247,50,211,
+242,156,159,184,30,164,149,151,154,160,247,117,29,11,252,111,7,113,131,247,
+190,10,251,250,128,6,247,30,10,11,247,111,247,51,21,153,149,236,57,5,129,
+126,135,130,126,151,29,247,10,6,186,247,123,29,129,140,111,27,107,6,251,47,
+247,23,247,6,11,247,116,10,178,171,145,144,156,171,10,5,173,143,158,157,168,
+202,29,128,129,141,112,27,47,6,215,29,251,4,11,21,251,40,251,23,5,127,129,
+134,130,130,26,120,155,125,159,151,142,140,152,155,30,247,144,247,70,251,
+144,247,71,5,152,122,137,140,127,27,119,123,125,120,129,144,132,151,128,31,
+11,226,10,123,121,191,29,123,121,151,29,11,145,148,31,155,149,149,155,157,
+202,29,202,10,251,4,6,114,128,201,29,122,26,125,143,129,149,127,30,70,87,
+5,11,231,10,14,213,10,247,123,106,10,77,11,116,117,110,31,128,7,140,99,5,
+96,138,128,135,112,30,134,114,136,116,134,26,113,163,118,168,166,153,152,
+173,149,30,210,159,176,166,213,27,204,182,113,101,97,92,114,11,21,187,170,
+128,113,167,31,163,117,153,107,109,26,65,80,89,52,93,106,151,164,112,30,115,
+162,125,170,171,26,170,153,170,163,162,30,165,166,171,150,187,27,14,137,10,
+6,11,30,54,6,75,116,125,102,102,160,124,194,138,31,251,109,7,84,138,118,124,
+103,26,101,162,125,203,247,40,10,11,138,132,128,31,122,130,128,120,120,26,
+121,148,123,121,10,11,129,30,132,150,150,137,165,27,150,251,250,6,101,116,
+120,107,105,163,121,186,31,247,21,6,247,36,10,147,128,130,140,111,27,108,
+11,182,29,251,248,129,247,34,29,247,167,6,247,33,212,192,243,247,7,52,201,
+251,55,31,251,13,11,249,36,145,29,88,27,251,29,36,42,251,21,251,20,243,41,
+247,28,189,184,153,169,181,31,94,7,92,103,108,85,30,251,1,247,13,10,11,116,
+141,129,145,130,30,123,149,156,130,158,165,29,11,248,52,151,10,11,21,159,
+154,144,147,153,26,161,121,156,115,127,133,225,10,126,132,247,55,10,21,152,
+122,134,142,127,218,10,33,5,128,153,150,134,149,27,161,158,156,160,153,132,
+149,122,153,31,14,21,152,123,133,142,127,247,107,10,146,129,156,125,31,247,
+26,32,5,126,155,146,136,150,27,161,158,157,160,152,132,150,122,153,31,14,
+239,29,126,155,147,247,57,29,144,165,184,31,208,180,181,215,223,26,216,104,
+208,79,183,30,175,89,103,145,251,57,27,251,85,6,117,126,130,123,123,152,129,
+161,31,247,88,6,11,247,191,248,137,21,251,27,247,102,10,247,31,247,29,247,
+2,247,4,247,31,247,31,251,2,247,3,251,30,31,11,170,247,36,29,150,164,26,219,
+7,164,138,147,132,149,30,154,247,133,10,121,127,133,123,126,31,169,70,113,
+145,11,247,23,29,122,122,26,11,210,10,105,109,112,103,103,109,167,171,172,
+169,166,175,31,11,112,150,10,105,163,121,186,30,247,122,247,26,29,78,11,121,
+10,248,20,6,162,152,141,145,149,155,10,11,97,27,95,126,157,198,31,247,3,7,
+202,141,247,10,29,136,31,251,7,7,11,31,156,149,150,157,158,26,157,130,155,
+124,150,247,64,29,11,247,174,29,124,153,129,30,132,11,248,20,247,214,175,
+29,11,247,159,10,148,166,26,246,7,164,138,147,132,149,247,120,29,129,31,131,
+11,247,135,29,122,247,16,29,11,21,251,51,251,19,251,16,251,47,251,50,247,
+17,251,18,247,49,247,47,247,18,247,18,247,48,247,45,251,18,247,20,251,43,
+31,11,247,152,179,29,251,106,6,11,144,143,135,130,145,30,119,153,149,133,
+159,27,165,157,156,163,169,114,160,104,115,114,130,124,119,31,102,110,125,
+96,50,26,14,247,134,10,173,115,157,92,31,11,7,178,29,11,21,247,148,10,127,
+133,183,10,128,126,26,119,158,121,161,149,149,11,157,168,202,29,128,129,141,
+112,27,46,247,24,10,11,251,64,31,140,61,21,247,18,242,41,251,12,251,12,36,
+40,251,16,251,22,37,236,247,14,247,12,242,237,247,19,31,14,248,20,22,247,
+13,247,25,10,127,247,81,6,230,64,193,251,18,88,11,26,251,51,137,7,113,130,
+159,29,154,129,247,64,10,247,4,6,11,176,10,14,246,10,165,247,126,29,6,186,
+247,166,29,111,27,11,126,26,119,158,120,159,149,150,145,150,150,30,11,140,
+161,158,170,202,29,128,129,141,112,27,49,6,242,10,11,27,247,86,6,160,153,
+149,155,155,127,148,116,31,251,88,6,251,20,96,144,158,104,31,84,168,101,203,
+203,26,197,171,11,247,108,247,28,247,115,29,121,247,120,10,247,154,5,11,21,
+57,146,79,203,220,26,221,196,200,224,148,30,247,0,22,227,131,197,78,56,26,
+57,79,76,53,132,30,14,79,138,118,126,101,26,102,162,125,202,30,237,6,202,
+247,92,29,129,247,36,162,6,169,141,11,247,82,29,251,248,7,79,138,118,125,
+101,26,102,162,125,202,30,237,6,11,162,116,168,149,153,141,143,157,30,150,
+187,173,144,173,27,200,166,126,110,31,121,7,145,104,106,142,106,27,50,11,
+247,134,29,247,108,29,11,6,93,115,121,105,109,156,122,174,135,31,11,225,10,
+125,132,11,230,10,247,7,251,160,6,96,11,151,155,161,202,29,247,133,29,50,
+6,118,132,138,136,130,31,120,133,124,118,11,220,247,67,10,130,156,126,148,
+30,247,66,29,128,6,11,6,162,152,141,145,149,31,156,149,150,157,158,26,157,
+130,11,247,69,10,159,11,219,29,132,150,11,203,7,198,141,158,151,176,247,67,
+29,58,6,77,115,247,136,29,11,26,155,131,154,125,150,30,146,247,6,29,11,247,
+196,21,228,247,88,5,151,166,142,148,247,40,29,11,163,137,149,209,29,11,137,
+247,78,29,123,147,123,153,129,247,64,10,11,157,156,148,147,162,147,30,235,
+247,167,5,201,251,159,84,7,112,150,125,162,158,150,150,159,142,30,11,241,
+29,155,125,11,122,26,122,148,123,152,130,30,131,150,150,137,165,27,11,6,185,
+164,157,173,173,114,157,93,31,11,7,93,115,121,105,105,163,121,185,31,11,135,
+129,127,30,251,0,56,5,11,149,30,147,247,133,29,11,128,130,141,111,27,11,6,
+214,10,11,6,162,247,171,10,125,149,30,147,202,10,11,6,116,141,128,145,130,
+30,124,149,157,130,157,247,36,29,148,166,26,11,70,251,92,5,136,133,138,131,
+133,26,123,155,125,158,153,148,226,29,11,83,60,62,199,99,247,34,124,31,193,
+134,160,135,155,133,8,159,131,151,128,128,26,119,86,122,11,7,187,140,161,
+156,174,26,175,115,153,76,30,64,6,76,115,125,103,104,161,122,188,138,31,11,
+247,16,10,129,137,137,132,30,137,11,245,29,174,170,112,107,11,87,7,247,61,
+10,247,105,91,29,86,11,247,192,247,149,21,230,251,149,5,247,8,6,199,248,98,
+5,169,144,156,158,166,26,155,131,11,113,131,138,133,243,29,11,114,129,229,
+29,11,247,92,10,145,172,166,30,168,164,148,147,146,27,144,153,130,124,157,
+31,11,6,185,247,122,10,11,247,36,29,149,165,26,11,247,107,10,146,128,156,
+126,31,247,25,11,112,132,247,14,29,11,21,142,145,143,155,144,26,155,123,154,
+123,125,129,132,121,130,30,251,125,252,71,5,135,11,21,247,2,29,94,150,11,
+247,22,29,102,119,89,104,31,11,176,105,200,167,170,146,151,165,30,165,150,
+151,153,159,26,161,120,157,116,131,133,137,134,11,21,178,170,169,176,176,
+108,169,100,31,121,247,105,10,136,126,123,30,251,26,33,5,122,11,112,132,247,
+127,29,11,6,164,137,148,133,148,30,155,247,133,10,121,247,93,10,11,247,26,
+10,149,128,143,117,8,11,75,26,81,107,80,91,107,30,113,101,99,133,251,33,27,
+251,88,6,116,127,130,123,11,244,10,165,27,11,21,168,126,155,115,115,126,124,
+109,30,251,24,7,110,152,123,163,163,152,155,168,30,11,21,154,151,146,150,
+151,26,157,122,155,120,130,128,200,10,125,11,31,126,7,83,152,118,174,164,
+152,150,167,148,30,192,45,142,133,142,135,149,126,25,11,247,102,10,247,32,
+247,28,247,3,247,4,247,31,11,125,163,27,169,163,153,172,167,31,161,166,247,
+126,29,5,247,2,10,11,131,7,140,106,162,119,176,141,8,247,19,6,176,137,162,
+159,140,172,8,147,7,11,21,247,148,10,127,133,136,126,122,30,251,25,33,5,11,
+30,131,150,150,137,165,27,150,251,250,128,247,33,29,11,7,174,143,156,156,
+169,26,173,115,157,93,30,11,144,26,155,123,154,122,125,130,132,121,129,30,
+11,118,247,111,10,11,6,160,247,101,29,131,154,124,150,30,147,11,247,89,10,
+122,247,117,10,11,247,70,10,147,202,10,11,27,153,146,136,123,166,31,111,185,
+171,126,162,27,170,163,153,172,167,31,161,11,30,166,179,176,144,247,35,27,
+247,88,6,161,152,149,155,155,126,148,117,31,11,247,18,21,167,159,120,112,
+110,120,120,109,111,119,158,167,167,159,158,168,31,11,109,146,156,125,169,
+27,177,154,162,198,191,119,159,87,87,95,122,106,109,31,11,247,90,247,92,21,
+195,185,197,123,207,40,182,251,23,25,247,5,6,185,163,11,30,135,123,138,133,
+125,26,247,0,251,248,21,247,111,204,251,111,7,14,247,172,21,251,19,251,0,
+247,19,6,14,195,186,5,215,7,251,192,251,142,247,192,251,141,5,214,7,83,187,
+5,11,248,96,21,251,248,129,7,92,115,247,132,29,247,12,6,11,247,130,145,21,
+86,40,5,41,6,114,130,137,134,129,31,123,130,129,121,11,31,155,149,247,180,
+10,11,247,22,10,132,11,118,125,247,130,10,211,247,59,29,11,247,29,10,14,6,
+247,131,29,130,129,121,11,247,107,29,149,152,137,164,27,11,185,27,169,158,
+134,127,154,31,155,126,143,11,247,111,247,13,21,52,185,90,222,191,173,162,
+175,167,115,163,111,132,11,137,140,130,27,118,121,122,118,125,146,126,152,
+131,31,122,167,181,127,11,21,163,158,120,116,115,120,120,116,115,120,158,
+163,161,158,159,162,31,11,21,167,95,105,155,124,27,132,132,131,130,133,143,
+134,151,128,31,174,11,26,109,161,118,169,30,172,6,178,140,150,148,159,189,
+180,245,24,153,11,160,154,247,38,29,11,247,131,29,130,129,121,122,26,122,
+147,123,153,130,30,11,6,174,161,156,166,148,133,154,133,146,31,148,131,126,
+143,115,27,11,6,119,132,138,136,129,31,121,247,60,29,11,6,186,162,156,174,
+247,108,29,146,202,10,11,199,232,31,200,7,239,211,210,239,173,173,131,124,
+166,30,167,124,11,21,251,63,251,31,251,25,251,55,251,54,247,31,251,27,247,
+60,11,104,110,111,106,105,168,111,174,174,168,167,172,174,111,166,103,31,
+11,167,164,114,110,113,118,123,107,107,118,156,163,169,163,164,168,31,11,
+114,130,137,134,129,247,135,29,122,151,29,11,124,123,115,63,224,71,233,233,
+224,247,90,29,11,6,247,62,29,11,6,162,151,150,159,158,127,150,116,31,11,6,
+93,114,247,132,29,11,21,146,151,142,147,147,26,157,123,155,11,185,163,156,
+174,247,108,29,11,140,119,149,8,119,148,125,160,158,26,177,187,169,200,200,
+184,11,21,55,6,251,38,251,126,5,86,247,55,124,120,7,110,125,11,26,107,165,
+121,184,30,171,6,186,165,157,172,160,130,152,113,11,30,224,6,203,247,92,29,
+137,6,137,209,11,30,123,149,157,130,247,159,10,11,157,98,27,95,118,119,99,
+31,99,7,101,156,119,170,162,153,11,98,247,137,10,247,36,7,14,126,129,135,
+131,129,30,106,99,107,130,59,27,251,7,82,11,247,138,29,121,120,26,122,147,
+11,6,164,149,140,145,148,31,155,148,149,157,156,26,156,131,11,136,138,126,
+123,30,251,145,251,70,247,145,251,71,5,126,11,145,247,115,10,128,30,37,11,
+21,247,1,48,5,130,151,147,135,150,27,159,157,156,160,11,21,247,2,49,5,130,
+150,148,135,150,27,159,157,156,160,11,247,127,10,131,142,129,27,118,121,122,
+118,11,26,167,114,163,110,125,126,134,127,127,30,113,114,139,139,11,247,193,
+247,57,21,208,251,57,5,236,6,223,247,214,5,11,247,132,29,247,24,247,134,29,
+173,11,127,126,26,118,157,121,162,150,145,142,152,156,30,14,135,125,26,118,
+157,122,160,149,247,94,29,27,94,104,158,167,131,31,166,131,131,147,119,27,
+14,178,31,156,6,178,171,169,176,176,107,169,100,31,14,130,30,124,149,157,
+129,157,27,156,11,148,84,27,251,45,32,42,251,31,11,93,114,121,105,105,164,
+121,185,31,11,131,154,125,149,30,147,128,11,26,155,131,155,125,149,30,11,
+30,132,149,152,136,164,27,11,174,26,173,115,157,93,30,11,26,173,115,157,92,
+30,11,6,247,83,10,11,21,157,247,100,10,11,21,247,1,49,247,136,10,11,147,247,
+82,10,11,247,102,29,251,10,11,162,168,157,131,153,124,149,31,152,118,95,149,
+102,27,11,111,26,104,163,121,185,30,247,213,6,212,178,171,198,11,247,93,29,
+151,71,140,31,88,207,11,247,38,247,0,7,200,184,111,100,93,79,106,57,31,11,
+192,205,87,5,117,130,126,121,118,26,103,162,122,11,131,126,128,31,131,128,
+137,130,112,26,93,251,140,11,21,112,131,138,132,128,31,122,130,128,120,120,
+26,11,148,141,144,149,31,155,149,149,156,156,26,156,131,11,247,16,29,132,
+149,153,136,163,27,11,30,247,14,223,21,107,114,115,109,108,164,115,171,11,
+31,155,149,149,156,157,247,63,10,11,159,247,101,29,11,247,150,29,131,126,
+142,11,252,106,7,93,114,247,132,29,191,11,177,137,151,132,150,30,155,128,
+121,145,105,27,78,11,119,171,98,189,72,24,173,95,143,137,177,138,8,11,6,114,
+129,137,134,130,31,123,11,247,127,29,122,11,26,104,163,122,185,30,247,3,11,
+155,125,148,30,147,128,130,141,11,119,26,109,166,113,171,160,149,11,124,132,
+125,128,31,131,128,137,11,132,141,117,140,8,11,138,135,27,128,135,145,154,
+31,247,139,7,184,11,140,146,150,247,129,10,155,130,11,83,171,87,191,111,31,
+172,121,170,130,206,128,11,21,107,114,115,109,108,165,115,170,171,164,163,
+11,149,156,157,202,29,128,11,154,145,148,152,26,161,121,156,116,127,132,136,
+11,247,146,10,111,27,11,251,5,251,4,251,27,251,34,247,2,251,4,11,220,199,
+191,232,182,174,131,123,164,31,151,132,11,172,82,8,121,149,143,135,146,27,
+146,144,142,11,6,100,108,109,102,102,170,109,178,31,14,133,129,31,123,130,
+129,11,27,116,121,122,117,126,11,120,162,104,104,120,116,11,6,119,132,138,
+136,130,31,119,133,125,118,11,131,154,125,149,31,247,66,29,11,132,138,136,
+130,31,120,133,124,118,118,26,11,251,45,247,17,24,251,47,251,17,5,115,11,
+142,143,147,31,155,149,149,156,157,26,155,11,21,251,37,6,247,40,251,122,5,
+120,151,11,149,151,26,159,121,157,119,127,131,135,127,11,26,120,154,125,159,
+149,149,144,147,145,30,11,26,122,147,123,153,130,30,131,150,150,137,11,27,
+128,128,144,158,105,31,169,89,120,146,11,30,50,6,75,116,125,101,104,159,125,
+192,11,155,125,158,153,151,148,155,148,30,247,37,11,247,149,29,105,11,163,
+156,174,155,131,154,125,149,31,147,128,11,103,118,124,112,130,144,127,146,
+131,31,129,11,121,136,135,125,26,118,157,122,160,149,147,11,185,123,160,103,
+117,128,131,120,132,30,157,11,117,128,130,122,123,150,130,161,31,14,21,251,
+3,229,5,150,126,11,154,26,160,121,156,119,128,11,31,155,148,149,156,157,26,
+11,108,106,26,74,187,95,211,11,114,129,138,133,130,31,123,11,246,190,183,
+151,168,188,30,11,129,122,148,120,27,11,6,186,163,157,173,11,31,123,130,129,
+122,11,5,130,151,148,135,149,27,160,157,156,11,6,95,157,116,175,174,158,162,
+183,30,11,6,115,128,137,134,130,31,123,129,129,11,6,185,164,157,173,173,115,
+157,92,31,11,6,93,156,117,176,174,158,162,184,30,11,132,26,123,155,124,156,
+153,149,147,156,11,134,113,94,31,70,98,97,63,55,26,11,138,136,129,31,120,
+133,125,118,118,26,11,138,133,130,31,124,130,130,123,123,26,11,25,143,143,
+148,152,144,148,191,232,24,11,155,131,154,125,149,31,147,128,129,141,11,93,
+115,121,104,105,160,124,190,137,31,11,157,153,145,149,152,26,161,121,156,
+116,11,33,5,128,153,149,134,150,27,161,158,11,162,125,203,30,182,6,201,163,
+153,176,11,104,110,112,105,106,168,111,174,174,168,11,174,251,139,5,112,142,
+149,128,161,27,11,114,129,137,133,130,247,135,10,11,143,149,151,30,14,226,
+29,14,178,29,223,11,247,33,29,122,11,7,247,153,10,11,157,165,29,11,140,247,
+112,10,11,247,122,29,148,11,217,10,14,181,10,146,128,11,247,112,29,247,66,
+11,251,12,7,200,29,11,163,247,103,29,11,173,10,247,158,11,6,219,10,11,107,
+29,248,84,11,7,219,10,11,151,241,29,154,11,247,83,10,131,11,112,150,10,122,
+147,11,122,247,80,29,11,6,247,74,29,11,242,29,129,113,26,11,247,100,10,126,
+123,30,11,247,82,10,146,128,11,159,29,153,129,30,11,247,99,10,129,141,112,
+27,11,189,10,149,137,11,152,196,10,148,30,147,11,155,10,14,6,247,21,10,11,
+159,10,132,149,154,136,162,27,11,160,29,131,149,151,137,165,27,11,113,10,
+14,247,135,29,197,10,150,11,200,29,122,247,16,29,132,149,11,138,133,129,247,
+188,10,11,30,137,133,133,150,29,11,187,10,156,124,149,247,64,29,14,21,112,
+131,136,10,11,119,29,14,49,76,29,11,136,29,14,6,251,50,249,47,63,29,65,29,
+14,54,10,14,};
+#endif
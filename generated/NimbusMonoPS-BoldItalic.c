@@ -0,0 +1,3267 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusMonoPS_BoldItalic_cff_size = 67304;
+asm(".section .rodata");
+asm(".global fz_font_NimbusMonoPS_BoldItalic_cff");
+asm(".type fz_font_NimbusMonoPS_BoldItalic_cff STT_OBJECT");
+asm(".size fz_font_NimbusMonoPS_BoldItalic_cff, 67304");
+asm(".balign 64");
+asm("fz_font_NimbusMonoPS_BoldItalic_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusMonoPS-BoldItalic.cff\"");
+#else
+const int fz_font_NimbusMonoPS_BoldItalic_cff_size = 67304;
+const char fz_font_NimbusMonoPS_BoldItalic_cff[] = {
+1,0,4,3,0,1,1,1,24,78,105,109,98,117,115,77,111,110,111,80,83,45,66,111,108,
+100,73,116,97,108,105,99,0,1,1,1,57,250,26,0,250,27,1,250,28,12,0,250,29,
+2,250,30,3,248,20,4,140,12,1,127,12,2,51,12,3,247,2,12,4,251,53,252,29,249,
+224,250,121,5,28,64,155,15,28,64,177,17,169,29,0,0,230,51,18,2,4,2,0,1,0,
+3,0,9,0,16,0,22,0,28,0,38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,
+111,0,117,0,123,0,136,0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,202,
+0,209,0,216,0,227,0,238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,
+1,84,1,96,1,103,1,115,1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,1,177,
+1,184,1,190,1,196,1,206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,
+2,19,2,25,2,38,2,44,2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,
+2,135,2,144,2,151,2,162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,239,2,
+251,3,2,3,14,3,20,3,27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,
+3,100,3,109,3,118,3,131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,189,3,
+200,3,206,3,212,3,216,3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,
+4,46,4,50,4,62,4,73,4,79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,135,
+4,142,4,151,4,163,4,168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,217,4,
+223,4,232,4,242,4,251,5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,
+5,94,5,108,5,117,5,127,5,136,5,141,5,152,5,160,5,168,5,176,5,181,5,193,5,
+203,5,211,5,222,5,229,5,237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,
+6,83,6,91,6,103,6,112,6,121,6,128,6,137,6,146,6,157,6,171,6,182,6,191,6,196,
+6,210,6,222,6,236,6,248,7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,
+7,98,7,104,7,110,7,115,7,122,7,134,7,142,7,151,7,158,7,165,7,179,7,184,7,
+188,7,193,7,200,7,207,7,211,7,214,7,219,7,223,7,228,7,234,7,236,7,238,7,240,
+7,247,7,249,7,252,8,1,8,4,8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,
+53,8,57,8,60,8,65,8,69,8,74,8,80,8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,
+111,8,118,8,121,8,124,8,127,8,132,8,139,8,145,8,149,8,155,8,167,8,182,8,187,
+8,200,8,210,8,222,8,230,8,239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,
+9,95,9,105,9,117,9,134,9,154,9,163,9,172,9,181,9,190,9,199,9,208,9,217,9,
+226,9,235,9,244,9,253,10,6,10,15,10,24,10,33,10,42,10,51,10,60,10,69,10,78,
+10,87,10,96,10,105,10,114,10,123,10,132,10,141,10,150,10,159,10,168,10,177,
+10,186,10,195,10,204,10,213,10,222,10,229,10,236,10,245,10,254,11,7,11,16,
+11,25,11,32,11,39,11,46,11,53,11,60,11,69,11,76,11,83,11,92,11,101,11,110,
+11,119,11,128,11,137,11,144,11,151,11,158,11,165,11,172,11,179,11,186,11,
+193,11,200,11,207,11,214,11,221,11,228,11,235,11,242,11,249,12,0,12,9,12,
+18,12,27,12,36,12,45,12,54,12,63,12,72,12,81,12,90,12,99,12,108,12,117,12,
+126,12,135,12,144,12,153,12,162,12,171,12,180,12,189,12,198,12,207,12,216,
+12,225,12,234,12,243,12,252,13,5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,
+13,77,13,86,13,95,13,102,13,111,13,120,13,127,13,134,13,143,13,150,13,157,
+13,164,13,173,13,182,13,191,13,200,13,209,13,218,13,225,13,232,13,239,13,
+246,13,253,14,4,14,11,14,18,14,25,14,32,14,39,14,46,14,53,14,60,14,67,14,
+74,14,81,14,88,14,95,14,102,14,109,14,116,14,123,14,130,14,137,14,144,14,
+151,14,158,14,165,14,172,14,179,14,186,14,193,14,200,14,207,14,214,14,221,
+14,228,14,235,14,242,14,249,15,0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,
+15,56,15,63,15,70,15,77,15,84,15,91,15,98,15,105,15,112,15,119,15,126,15,
+133,15,140,15,147,15,154,15,161,15,168,15,178,15,185,15,192,15,196,15,250,
+16,58,16,84,16,98,73,74,65,98,114,101,118,101,65,111,103,111,110,101,107,
+67,97,99,117,116,101,67,99,97,114,111,110,67,100,111,116,97,99,99,101,110,
+116,68,99,97,114,111,110,68,99,114,111,97,116,69,99,97,114,111,110,69,100,
+111,116,97,99,99,101,110,116,69,111,103,111,110,101,107,71,98,114,101,118,
+101,71,100,111,116,97,99,99,101,110,116,73,100,111,116,97,99,99,101,110,116,
+76,97,99,117,116,101,76,99,97,114,111,110,78,97,99,117,116,101,78,99,97,114,
+111,110,79,104,117,110,103,97,114,117,109,108,97,117,116,82,97,99,117,116,
+101,82,99,97,114,111,110,83,97,99,117,116,101,83,99,101,100,105,108,108,97,
+84,99,97,114,111,110,85,114,105,110,103,85,104,117,110,103,97,114,117,109,
+108,97,117,116,90,97,99,117,116,101,90,100,111,116,97,99,99,101,110,116,65,
+109,97,99,114,111,110,117,110,105,48,50,49,65,67,99,105,114,99,117,109,102,
+108,101,120,87,99,105,114,99,117,109,102,108,101,120,87,100,105,101,114,101,
+115,105,115,89,99,105,114,99,117,109,102,108,101,120,72,98,97,114,69,109,
+97,99,114,111,110,71,99,105,114,99,117,109,102,108,101,120,72,99,105,114,
+99,117,109,102,108,101,120,73,109,97,99,114,111,110,73,111,103,111,110,101,
+107,74,99,105,114,99,117,109,102,108,101,120,75,99,111,109,109,97,97,99,99,
+101,110,116,76,99,111,109,109,97,97,99,99,101,110,116,78,99,111,109,109,97,
+97,99,99,101,110,116,79,109,97,99,114,111,110,82,99,111,109,109,97,97,99,
+99,101,110,116,83,99,105,114,99,117,109,102,108,101,120,71,99,111,109,109,
+97,97,99,99,101,110,116,85,109,97,99,114,111,110,85,111,103,111,110,101,107,
+69,98,114,101,118,101,73,98,114,101,118,101,105,106,108,111,110,103,115,97,
+98,114,101,118,101,97,111,103,111,110,101,107,99,97,99,117,116,101,99,99,
+97,114,111,110,99,100,111,116,97,99,99,101,110,116,100,99,97,114,111,110,
+100,99,114,111,97,116,101,99,97,114,111,110,101,100,111,116,97,99,99,101,
+110,116,101,111,103,111,110,101,107,103,98,114,101,118,101,103,100,111,116,
+97,99,99,101,110,116,108,97,99,117,116,101,108,99,97,114,111,110,110,97,99,
+117,116,101,110,99,97,114,111,110,111,104,117,110,103,97,114,117,109,108,
+97,117,116,114,97,99,117,116,101,115,97,99,117,116,101,115,99,105,114,99,
+117,109,102,108,101,120,115,99,111,109,109,97,97,99,99,101,110,116,116,99,
+97,114,111,110,117,114,105,110,103,117,104,117,110,103,97,114,117,109,108,
+97,117,116,122,97,99,117,116,101,122,100,111,116,97,99,99,101,110,116,104,
+98,97,114,117,110,105,48,50,49,66,119,99,105,114,99,117,109,102,108,101,120,
+119,100,105,101,114,101,115,105,115,97,109,97,99,114,111,110,121,99,105,114,
+99,117,109,102,108,101,120,99,99,105,114,99,117,109,102,108,101,120,101,109,
+97,99,114,111,110,103,99,105,114,99,117,109,102,108,101,120,105,98,114,101,
+118,101,105,109,97,99,114,111,110,106,99,105,114,99,117,109,102,108,101,120,
+107,99,111,109,109,97,97,99,99,101,110,116,108,99,111,109,109,97,97,99,99,
+101,110,116,110,99,111,109,109,97,97,99,99,101,110,116,111,109,97,99,114,
+111,110,114,99,111,109,109,97,97,99,99,101,110,116,117,98,114,101,118,101,
+117,109,97,99,114,111,110,117,111,103,111,110,101,107,114,99,97,114,111,110,
+115,99,101,100,105,108,108,97,103,99,111,109,109,97,97,99,99,101,110,116,
+69,117,114,111,112,101,115,101,116,97,108,105,114,97,102,114,97,110,99,117,
+110,105,48,51,56,55,117,110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,
+105,105,48,48,50,48,56,97,102,105,105,54,49,50,52,56,113,117,111,116,101,
+114,101,118,101,114,115,101,100,117,110,105,50,50,49,53,117,110,105,48,50,
+67,57,97,114,105,110,103,97,99,117,116,101,104,99,105,114,99,117,109,102,
+108,101,120,101,98,114,101,118,101,105,111,103,111,110,101,107,108,100,111,
+116,111,98,114,101,118,101,111,115,108,97,115,104,97,99,117,116,101,105,116,
+105,108,100,101,117,116,105,108,100,101,76,100,111,116,79,98,114,101,118,
+101,83,99,111,109,109,97,97,99,99,101,110,116,84,99,111,109,109,97,97,99,
+99,101,110,116,116,99,111,109,109,97,97,99,99,101,110,116,85,98,114,101,118,
+101,65,114,105,110,103,97,99,117,116,101,79,115,108,97,115,104,97,99,117,
+116,101,65,69,97,99,117,116,101,69,110,103,84,98,97,114,101,110,103,116,98,
+97,114,107,103,114,101,101,110,108,97,110,100,105,99,110,97,112,111,115,116,
+114,111,112,104,101,85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,
+105,108,100,101,87,103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,
+118,101,119,97,99,117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,
+117,110,105,50,48,48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,
+99,101,105,110,118,115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,
+105,97,109,111,110,100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,
+101,109,97,108,101,109,117,115,105,99,97,108,110,111,116,101,115,117,110,
+105,110,118,98,117,108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,
+114,99,108,101,102,105,108,108,101,100,114,101,99,116,102,105,108,108,101,
+100,98,111,120,117,110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,
+114,111,119,114,105,103,104,116,97,114,114,111,119,108,101,102,116,97,114,
+114,111,119,98,111,116,104,97,114,114,111,119,117,112,97,114,114,111,119,
+100,111,119,110,97,114,114,111,119,117,112,100,110,97,114,114,111,119,117,
+112,100,110,98,115,101,108,111,122,101,110,103,101,116,114,105,97,103,100,
+110,72,49,56,53,51,51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,
+97,110,103,108,101,108,101,102,116,97,110,103,108,101,114,105,103,104,116,
+117,110,105,118,101,114,115,97,108,97,108,101,112,104,101,120,105,115,116,
+101,110,116,105,97,108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,
+117,114,103,114,97,100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,
+100,98,108,100,111,119,110,97,114,114,111,119,100,98,108,117,112,110,111,
+116,101,113,117,97,108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,
+105,99,97,108,105,110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,
+116,112,105,110,116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,
+113,117,97,108,108,101,115,115,101,113,117,97,108,103,114,101,97,116,101,
+114,101,113,117,97,108,114,101,118,108,111,103,105,99,97,108,110,111,116,
+117,110,105,111,110,105,110,116,101,114,115,101,99,116,105,111,110,101,108,
+101,109,101,110,116,112,101,114,112,101,110,100,105,99,117,108,97,114,105,
+110,102,105,110,105,116,121,112,114,111,112,111,114,116,105,111,110,97,108,
+99,111,110,103,114,117,101,110,116,116,104,101,114,101,102,111,114,101,112,
+114,111,100,117,99,116,115,117,109,109,97,116,105,111,110,97,102,105,105,
+54,49,50,56,57,112,97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,
+101,109,117,108,116,105,112,108,121,119,101,105,101,114,115,116,114,97,115,
+115,110,111,116,115,117,98,115,101,116,97,110,103,108,101,112,114,111,112,
+101,114,115,117,112,101,114,115,101,116,112,114,111,112,101,114,115,117,98,
+115,101,116,114,101,102,108,101,120,115,117,112,101,114,115,101,116,114,101,
+102,108,101,120,115,117,98,115,101,116,110,111,116,101,108,101,109,101,110,
+116,97,114,114,111,119,100,98,108,108,101,102,116,97,114,114,111,119,100,
+98,108,114,105,103,104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,
+110,100,101,114,115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,
+109,112,116,121,115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,
+52,51,72,49,56,53,53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,
+117,116,101,115,101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,
+50,54,97,115,116,101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,
+97,116,101,115,116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,
+114,105,97,103,108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,
+65,108,112,104,97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,
+69,112,115,105,108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,
+116,97,75,97,112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,
+99,114,111,110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,
+108,111,110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,
+112,104,97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,
+105,108,111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,
+97,107,97,112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,
+120,105,111,109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,
+116,97,117,117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,
+111,109,101,103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,
+105,49,111,109,101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,
+117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,
+115,100,105,101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,
+116,111,110,111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,
+97,116,111,110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,
+111,110,116,111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,
+115,105,108,111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,
+115,105,115,85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,
+108,112,104,97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,
+111,115,101,116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,
+111,109,105,99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,
+110,111,115,117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,
+100,105,101,114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,
+110,100,105,101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,
+48,48,49,55,97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,
+102,105,105,49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,
+48,48,50,50,97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,
+102,105,105,49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,
+48,48,50,57,97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,
+102,105,105,49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,
+48,48,51,52,97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,
+102,105,105,49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,
+48,48,51,57,97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,
+102,105,105,49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,
+48,48,52,54,97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,
+102,105,105,49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,
+48,48,52,57,97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,
+102,105,105,49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,
+48,48,53,53,117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,
+49,48,48,53,55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,
+97,102,105,105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,
+52,69,56,117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,
+68,56,117,110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,
+52,57,50,117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,
+105,49,48,48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,
+53,54,97,102,105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,
+105,48,52,69,50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,
+48,52,57,65,117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,
+52,66,56,117,110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,
+48,68,117,110,105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,
+52,117,110,105,48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,
+117,110,105,48,52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,
+48,54,54,97,102,105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,
+105,105,49,48,48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,
+48,55,50,97,102,105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,
+105,105,49,48,48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,
+48,55,56,97,102,105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,
+105,105,49,48,48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,
+48,56,51,97,102,105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,
+105,105,49,48,48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,
+48,56,56,97,102,105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,
+105,105,49,48,48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,
+48,57,53,97,102,105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,
+105,105,49,48,48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,
+49,48,49,97,102,105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,
+105,105,49,48,49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,
+49,48,55,97,102,105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,
+110,105,48,52,69,57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,
+57,48,117,110,105,48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,
+56,52,54,117,110,105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,
+66,49,97,102,105,105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,
+105,105,49,48,49,48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,
+49,48,57,97,102,105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,
+48,52,69,70,117,110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,
+52,65,51,117,110,105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,
+66,55,117,110,105,48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,
+51,117,110,105,48,52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,
+117,110,105,48,52,65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,
+110,105,50,49,49,69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,
+105,50,48,68,68,117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,
+50,49,50,48,117,110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,
+49,50,70,117,110,105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,
+57,54,117,110,105,50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,
+57,117,110,105,50,49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,
+117,110,105,50,50,48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,
+110,105,50,50,50,53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,
+105,50,50,50,69,117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,
+50,50,54,50,117,110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,
+50,56,53,117,110,105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,
+57,57,117,110,105,50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,
+52,117,110,105,50,50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,
+117,110,105,50,53,54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,
+110,105,50,53,66,57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,
+105,50,53,67,54,117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,
+116,117,110,105,51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,
+87,41,43,43,44,67,111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,
+32,40,85,82,87,41,43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,
+108,111,112,109,101,110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,
+87,41,43,43,44,67,111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,
+32,40,85,82,87,41,43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,
+108,111,112,109,101,110,116,78,105,109,98,117,115,32,77,111,110,111,32,80,
+83,32,66,111,108,100,32,73,116,97,108,105,99,78,105,109,98,117,115,32,77,
+111,110,111,32,80,83,1,162,2,0,1,0,37,0,130,0,152,1,23,1,102,1,173,1,232,
+1,239,2,69,2,74,2,102,2,205,2,225,3,59,3,107,3,197,3,253,4,31,4,46,4,250,
+5,71,5,226,5,230,5,238,6,0,6,37,6,195,7,51,7,167,7,203,8,60,8,64,8,142,8,
+186,9,55,9,151,9,200,9,214,9,230,10,33,10,69,10,157,11,10,11,126,11,146,11,
+244,12,21,12,142,12,156,12,217,13,43,13,81,13,168,14,0,14,106,14,210,15,6,
+15,79,15,153,15,195,15,202,15,255,16,65,16,154,16,234,17,9,17,87,17,170,17,
+218,17,245,18,30,18,76,18,89,18,152,18,162,18,213,19,1,19,36,19,41,19,95,
+19,118,19,132,19,140,19,204,20,2,20,64,20,91,20,94,20,147,20,190,20,249,21,
+17,21,47,21,86,21,126,21,148,21,152,21,188,21,230,22,13,22,62,22,92,22,105,
+22,138,22,153,22,193,22,240,23,14,23,24,23,69,23,84,23,128,23,165,23,201,
+23,232,23,255,24,3,24,8,24,38,24,77,24,92,24,120,24,140,24,179,24,218,24,
+226,24,236,24,240,24,244,25,25,25,45,25,76,25,111,25,131,25,151,25,174,25,
+206,25,215,25,242,26,21,26,37,26,70,26,77,26,83,26,117,26,151,26,185,26,209,
+26,222,26,255,27,10,27,23,27,54,27,86,27,110,27,141,27,161,27,179,27,186,
+27,193,27,197,27,203,27,223,27,252,28,23,28,39,28,67,28,95,28,104,28,121,
+28,136,28,164,28,191,28,218,28,243,29,2,29,9,29,20,29,31,29,42,29,51,29,77,
+29,98,29,122,29,128,29,153,29,178,29,203,29,228,29,242,29,253,30,14,30,30,
+30,52,30,62,30,85,30,97,30,120,30,143,30,166,30,174,30,183,30,205,30,222,
+30,237,31,3,31,21,31,42,31,52,31,58,31,79,31,92,31,110,31,130,31,150,31,170,
+31,188,31,208,31,215,31,227,31,239,31,251,32,9,32,22,32,27,32,46,32,65,32,
+84,32,94,32,99,32,108,32,117,32,126,32,144,32,153,32,160,32,166,32,184,32,
+199,32,217,32,235,32,251,33,6,33,17,33,34,33,41,33,58,33,65,33,82,33,92,33,
+109,33,124,33,141,33,158,33,175,33,192,33,208,33,224,33,230,33,246,34,6,34,
+15,34,31,34,47,34,63,34,79,34,89,34,99,34,107,34,115,34,123,34,131,34,139,
+34,145,34,156,34,171,34,186,34,194,34,205,34,220,34,231,34,246,35,5,35,20,
+35,34,35,48,35,58,35,72,35,86,35,100,35,114,35,128,35,142,35,150,35,164,35,
+178,35,192,35,206,35,215,35,224,35,233,35,242,35,251,36,4,36,10,36,16,36,
+29,36,42,36,55,36,68,36,81,36,94,36,107,36,120,36,133,36,146,36,159,36,172,
+36,185,36,198,36,211,36,224,36,237,36,242,36,249,37,5,37,13,37,25,37,37,37,
+49,37,61,37,73,37,85,37,97,37,109,37,121,37,133,37,145,37,157,37,167,37,175,
+37,183,37,191,37,199,37,207,37,215,37,223,37,229,37,235,37,246,38,1,38,12,
+38,23,38,34,38,45,38,56,38,67,38,78,38,89,38,100,38,111,38,122,38,133,38,
+144,38,155,38,166,38,177,38,188,38,199,38,210,38,221,38,232,38,243,38,254,
+39,9,39,20,39,26,39,31,39,37,39,49,39,53,39,61,39,65,39,70,39,75,39,79,39,
+89,39,95,39,100,39,114,39,128,39,134,39,140,39,150,39,160,39,168,39,173,39,
+184,39,189,39,197,39,204,39,218,39,225,39,239,39,244,39,252,39,255,40,14,
+40,34,40,43,40,51,40,60,40,66,40,79,40,97,40,130,40,133,40,136,248,83,170,
+29,154,151,149,157,156,26,166,121,154,107,30,130,6,43,248,96,5,103,29,247,
+103,242,21,251,37,6,247,3,247,61,5,11,249,15,248,97,21,183,140,169,164,174,
+26,156,128,155,125,212,29,251,21,113,29,169,6,80,251,161,5,83,126,73,93,69,
+247,11,29,151,142,150,153,31,154,151,149,158,155,26,156,128,155,125,144,30,
+143,130,135,139,117,27,251,22,110,29,111,155,126,174,138,30,81,251,152,5,
+135,122,137,124,126,26,41,220,68,247,3,247,23,247,14,231,247,12,165,30,11,
+248,92,248,97,21,237,6,169,151,247,55,29,157,156,26,155,128,155,125,61,29,
+11,247,185,248,61,21,40,175,29,121,123,26,122,247,90,29,144,137,146,138,152,
+138,90,251,111,24,137,6,107,129,137,127,124,31,123,126,247,126,29,182,30,
+247,4,169,29,156,129,156,124,144,30,142,131,132,139,119,27,138,6,176,247,
+60,5,186,195,174,155,183,27,188,164,124,111,133,138,132,137,131,31,102,251,
+59,5,96,109,114,104,108,157,127,182,31,228,169,29,157,129,154,124,145,30,
+141,134,132,140,125,27,177,247,61,5,142,154,141,154,154,26,211,78,187,49,
+85,103,126,100,85,30,11,247,137,247,104,21,231,6,177,126,209,251,3,166,51,
+8,238,29,115,196,109,187,104,176,8,233,183,186,198,212,26,227,67,193,251,
+9,30,251,115,113,29,149,6,59,251,249,5,128,6,107,129,136,127,124,31,123,126,
+247,53,29,182,30,247,41,6,168,154,143,150,152,247,194,29,186,247,103,247,
+22,29,11,247,253,247,6,29,155,151,247,182,29,251,105,6,106,130,137,126,247,
+83,29,109,156,127,183,30,190,6,60,251,250,5,85,191,29,122,26,109,157,127,
+182,30,248,111,6,181,247,78,5,142,155,140,144,147,26,162,120,156,114,103,
+117,117,94,129,30,120,54,5,251,99,6,11,248,35,248,73,21,46,47,101,77,80,31,
+92,89,111,78,84,26,251,3,226,64,247,22,247,57,247,43,247,19,247,31,247,2,
+52,215,251,19,30,112,36,21,217,192,99,80,61,53,70,40,64,86,180,197,217,225,
+208,235,31,11,247,150,248,3,76,29,11,249,13,248,146,21,144,158,139,141,147,
+26,162,121,155,114,118,127,131,117,124,30,158,110,96,150,89,27,251,36,251,
+10,46,251,6,100,162,98,174,118,31,167,121,168,130,205,128,204,127,153,135,
+158,129,8,154,131,148,125,125,26,96,73,103,58,76,84,165,171,136,30,137,165,
+123,29,108,147,85,102,29,150,149,143,148,145,165,8,11,248,228,58,29,11,248,
+124,248,239,21,251,75,6,107,128,227,29,213,6,50,252,32,5,251,10,6,107,129,
+137,126,142,29,11,248,12,248,62,21,251,32,6,113,122,135,128,126,31,123,126,
+130,122,123,26,109,157,126,181,30,169,6,90,251,111,5,84,6,108,129,136,127,
+123,31,124,127,247,53,29,181,30,247,190,6,167,154,247,16,29,155,247,17,29,
+130,133,140,118,27,251,26,6,169,247,27,5,209,242,189,165,169,27,152,146,135,
+127,151,31,125,152,149,134,154,27,172,172,170,170,177,82,177,83,89,100,124,
+85,50,31,11,21,163,155,148,151,156,26,157,247,59,29,124,129,125,247,134,29,
+154,30,14,146,21,64,39,5,41,6,108,128,247,43,29,247,106,240,29,131,133,140,
+121,27,247,210,248,51,5,178,143,165,163,172,247,17,29,130,133,140,118,27,
+47,6,108,127,136,127,125,247,130,29,111,154,127,174,137,30,251,49,251,94,
+76,247,94,5,180,141,167,164,173,26,157,129,154,125,144,30,142,130,132,247,
+44,29,122,26,115,152,126,167,135,30,11,247,249,166,29,170,26,156,111,29,129,
+155,124,144,30,142,130,247,162,29,251,23,6,106,130,137,126,123,31,123,127,
+130,120,120,26,118,150,127,165,135,30,98,252,98,5,247,10,6,11,248,128,247,
+77,29,251,21,251,38,35,219,66,247,8,189,187,153,168,187,31,129,96,130,92,
+94,106,85,140,25,251,1,174,29,247,3,6,247,4,241,217,241,160,31,214,247,230,
+5,152,6,170,151,142,151,154,31,154,151,148,156,156,26,157,247,112,29,251,
+12,6,251,45,49,21,203,184,99,81,64,59,67,55,73,94,178,198,215,219,210,225,
+31,11,159,29,123,26,119,147,127,158,131,30,251,7,251,14,78,247,13,5,170,151,
+156,160,166,26,156,129,155,124,143,30,142,131,247,162,29,49,175,29,121,123,
+26,110,156,126,177,30,247,5,251,116,109,251,26,133,29,11,21,228,247,49,29,
+122,156,31,251,18,247,17,251,75,251,17,5,110,120,134,132,122,26,121,153,126,
+157,149,149,143,148,152,30,14,248,45,247,122,65,29,123,26,113,151,126,168,
+121,29,11,249,31,247,56,21,149,186,5,144,163,142,162,163,26,229,81,204,59,
+96,102,123,103,95,30,175,114,106,155,92,27,112,64,125,128,108,31,109,128,
+121,117,112,26,115,157,121,163,146,148,140,142,148,30,157,208,146,141,157,
+27,159,153,126,122,132,139,138,138,135,31,136,123,5,143,114,123,140,124,27,
+76,57,112,103,90,31,105,113,121,101,91,26,62,193,94,230,183,170,147,161,180,
+30,129,147,150,134,154,27,155,152,144,149,151,31,117,169,161,132,179,27,192,
+217,159,160,171,31,160,153,149,157,162,26,162,122,156,116,125,124,135,126,
+105,30,127,109,121,135,117,27,101,123,161,193,135,31,251,14,105,21,108,95,
+109,127,111,27,104,118,154,164,151,143,149,147,147,31,156,156,188,153,181,
+27,155,151,137,134,160,31,247,25,212,21,192,160,167,165,175,27,168,156,116,
+100,136,139,133,138,131,31,11,247,139,248,96,21,167,6,184,171,164,175,168,
+119,153,98,31,251,40,209,29,156,6,58,251,248,247,60,29,247,180,247,253,80,
+251,149,5,114,6,89,107,114,100,114,161,124,179,31,247,45,6,184,171,164,174,
+168,119,154,98,31,123,6,217,247,248,5,151,247,139,29,36,6,251,175,251,253,
+5,11,211,242,21,135,6,108,128,136,127,190,29,182,30,233,6,183,169,166,179,
+157,129,151,118,144,31,165,188,5,225,6,128,91,5,134,6,104,109,111,107,111,
+157,124,172,31,247,243,6,166,247,12,5,142,150,140,149,146,26,162,120,156,
+114,103,117,117,95,129,30,135,120,5,251,30,6,167,247,21,5,150,6,138,133,139,
+136,136,26,115,247,48,29,155,213,24,144,158,139,140,147,26,162,120,156,114,
+107,117,121,104,128,30,128,247,58,29,247,10,6,126,82,5,136,127,138,129,132,
+26,117,158,122,163,176,161,160,184,149,30,175,247,54,5,252,79,113,29,146,
+6,194,251,98,21,85,6,231,247,63,5,11,249,10,83,29,248,22,235,29,131,132,62,
+29,21,48,229,5,150,128,133,142,128,27,115,116,117,116,128,187,29,14,58,106,
+77,78,31,88,86,108,68,74,26,88,162,93,179,108,30,113,175,194,125,214,27,239,
+213,156,175,193,31,167,157,154,161,160,125,29,11,247,65,21,172,148,160,163,
+167,26,156,128,154,125,144,30,142,130,247,162,29,251,67,191,29,122,26,122,
+150,123,153,134,30,136,147,150,138,156,27,233,6,126,80,5,124,99,99,132,91,
+27,39,82,176,205,155,141,156,143,156,31,152,200,5,241,162,227,207,247,0,27,
+210,183,120,107,141,31,141,108,139,139,144,131,8,129,145,153,133,154,247,
+151,29,148,145,165,156,214,24,143,157,139,140,148,26,163,123,155,114,119,
+126,131,118,123,30,158,101,93,149,86,27,56,68,115,88,75,31,72,88,93,68,123,
+65,124,71,24,134,120,137,119,119,26,72,164,87,186,109,30,111,183,204,123,
+211,27,219,190,152,186,244,31,11,184,29,181,5,160,152,152,159,159,247,17,
+29,130,133,140,119,27,46,6,108,129,136,127,124,31,124,127,129,121,123,26,
+122,149,123,247,152,29,39,24,251,60,251,11,116,137,131,137,127,129,25,123,
+126,247,53,29,182,30,247,2,6,169,153,143,150,153,31,155,152,148,157,157,26,
+156,133,148,120,149,247,153,29,113,26,109,157,127,182,30,247,4,6,168,153,
+143,150,153,247,57,29,156,129,155,124,145,30,135,140,133,140,127,140,8,14,
+247,13,247,124,21,111,251,21,5,95,138,109,114,104,26,110,157,126,182,30,247,
+97,6,247,48,134,247,26,243,173,247,42,149,184,24,144,159,141,160,163,29,111,
+251,18,24,135,191,29,122,26,109,157,127,182,30,247,2,22,210,6,168,153,143,
+150,153,31,154,151,149,156,156,247,17,29,130,247,162,29,70,6,167,247,18,5,
+246,6,176,169,131,123,158,31,165,118,156,100,99,26,126,138,126,136,125,30,
+129,96,118,43,62,80,41,143,25,34,6,14,212,29,251,193,113,29,235,6,59,251,
+250,247,195,29,168,153,143,150,153,31,155,151,148,157,155,247,17,29,130,133,
+140,118,27,44,6,11,140,118,27,49,110,29,121,145,129,158,129,30,251,0,42,73,
+235,5,171,154,154,157,164,26,156,247,111,29,48,6,107,129,136,127,157,29,144,
+137,146,138,152,138,247,8,251,64,24,251,97,251,78,5,96,138,109,114,104,26,
+109,157,127,182,30,247,2,169,29,164,126,152,113,142,30,247,9,245,209,34,5,
+101,135,113,114,107,26,109,157,127,182,30,247,2,6,169,152,143,150,153,31,
+155,151,148,157,155,247,17,29,134,132,140,125,27,14,248,238,88,29,21,165,
+163,143,144,155,26,157,126,152,120,128,129,135,128,126,30,251,18,34,5,111,
+115,136,134,124,26,121,153,124,157,149,151,144,151,152,30,247,182,243,21,
+166,163,142,144,155,26,157,126,152,121,127,130,135,128,125,30,251,18,34,5,
+112,115,135,134,124,26,121,153,124,157,149,151,145,150,152,30,14,21,111,251,
+19,247,173,29,123,26,108,156,127,183,30,247,13,6,168,152,247,16,29,155,26,
+156,129,156,124,144,30,142,131,132,139,119,27,138,6,219,247,250,93,29,11,
+248,5,21,142,155,140,145,148,26,161,122,154,115,122,129,133,122,126,30,154,
+106,247,106,29,247,16,247,110,29,75,86,100,151,162,117,30,169,136,124,153,
+111,27,102,117,117,95,129,31,132,107,5,136,123,138,135,131,26,115,157,123,
+166,153,147,142,147,152,30,121,175,187,130,197,27,247,38,247,5,210,230,176,
+121,170,106,159,31,114,155,98,150,68,148,78,147,132,141,127,143,247,95,29,
+168,131,121,162,30,107,150,149,131,165,27,155,157,147,152,153,31,149,149,
+143,147,145,166,8,11,175,29,121,122,26,109,157,127,182,30,247,21,6,168,153,
+247,16,29,156,26,156,129,154,124,145,30,134,141,132,140,126,140,219,247,249,
+24,178,144,164,163,171,247,17,29,130,133,140,118,27,251,3,6,251,87,251,170,
+65,247,170,5,247,181,29,114,152,126,167,136,30,60,251,250,5,95,138,109,114,
+103,26,109,157,127,182,30,247,21,6,168,153,143,150,153,247,194,29,14,21,109,
+120,116,104,66,203,86,225,204,203,168,189,184,31,161,163,154,170,159,26,157,
+127,151,120,117,129,130,107,125,30,96,119,93,112,85,27,84,107,166,185,31,
+166,140,130,150,119,27,14,249,49,248,239,21,90,29,251,94,247,124,177,29,11,
+247,181,247,214,21,247,70,240,29,130,247,162,29,85,29,11,5,109,29,104,251,
+52,5,136,6,107,128,247,175,29,182,30,247,4,6,169,153,143,150,153,31,154,151,
+148,157,155,26,169,122,151,96,30,138,6,177,247,63,5,142,153,140,150,155,26,
+212,79,188,49,89,88,120,106,96,30,14,21,228,49,5,129,149,147,135,149,27,163,
+247,80,29,251,75,251,16,5,110,119,134,132,122,26,121,153,126,157,149,148,
+143,148,153,30,14,248,61,21,251,32,114,29,169,6,101,251,60,5,88,77,112,127,
+90,27,93,114,154,167,145,140,146,141,147,31,199,247,162,247,177,29,122,26,
+122,247,90,29,136,147,148,138,157,27,247,150,29,123,26,66,200,91,229,193,
+172,151,179,196,30,130,99,5,238,6,169,152,247,55,29,157,156,26,156,129,154,
+124,145,30,141,133,132,140,126,27,11,204,242,21,128,6,108,128,136,127,190,
+29,182,30,247,187,6,212,199,159,180,183,31,176,172,163,188,181,26,185,114,
+176,89,166,30,197,175,168,186,193,26,172,125,172,114,162,30,169,108,98,152,
+81,27,251,144,247,142,29,122,122,26,109,156,127,182,30,149,6,219,251,19,21,
+167,247,19,5,247,22,6,193,170,122,110,93,81,104,62,31,251,51,251,123,21,167,
+247,20,5,247,24,6,213,185,113,96,101,101,118,67,31,14,247,197,22,247,39,6,
+189,171,163,176,164,126,152,111,143,31,186,247,111,5,164,152,141,143,148,
+31,160,148,156,163,161,26,166,118,154,99,30,251,13,6,89,107,116,102,110,159,
+125,180,31,148,6,92,251,110,5,251,112,6,186,247,110,5,151,6,189,171,162,175,
+168,118,154,99,31,251,13,247,114,29,92,251,110,5,99,133,114,116,107,26,111,
+159,124,180,30,247,37,6,129,97,5,136,126,137,127,133,26,118,162,122,170,172,
+154,155,190,150,30,14,21,247,63,252,3,5,244,6,241,248,97,5,94,29,155,151,
+148,182,29,11,248,82,247,77,29,251,20,251,39,35,219,66,247,8,189,187,153,
+168,187,31,129,96,130,92,94,106,85,140,25,251,1,174,29,247,3,6,247,4,241,
+217,241,160,31,214,247,230,5,152,6,170,151,142,151,154,31,154,151,148,156,
+156,26,157,129,155,125,143,30,142,129,133,140,119,27,251,12,6,251,45,49,21,
+203,184,99,81,64,58,67,56,73,94,179,197,215,219,210,225,31,11,143,157,139,
+140,148,26,162,121,156,113,121,126,133,123,122,30,169,76,115,145,82,27,251,
+48,251,37,251,10,251,46,105,31,11,142,151,140,148,146,26,167,115,161,107,
+101,101,118,96,101,30,66,58,146,181,5,167,147,153,156,165,26,173,114,157,
+90,30,101,6,92,113,120,106,115,149,125,164,127,31,131,95,101,211,5,195,109,
+115,157,94,27,108,120,129,115,127,31,129,119,133,113,114,26,109,158,120,169,
+162,153,150,166,148,30,159,98,145,129,155,119,115,129,121,126,125,121,61,
+46,24,126,6,105,114,117,109,110,163,116,170,31,166,6,165,140,140,140,175,
+181,218,236,24,153,156,154,154,154,150,11,247,86,247,83,21,234,6,245,202,
+163,201,196,84,29,248,214,21,251,74,251,66,251,69,251,77,251,23,234,41,247,
+20,247,78,247,65,247,67,247,80,247,24,43,235,251,22,31,117,36,21,219,196,
+78,54,251,11,251,3,251,12,251,2,57,82,199,225,247,13,247,2,247,10,247,5,31,
+11,5,169,146,168,153,195,27,171,178,135,133,177,31,137,151,149,138,146,27,
+170,170,170,170,159,127,152,115,146,31,147,108,78,146,97,27,251,14,51,83,
+49,119,31,132,107,5,96,6,107,247,14,29,121,123,26,109,157,127,182,30,180,
+6,91,251,111,5,84,6,107,129,136,127,247,171,29,247,190,247,185,29,212,29,
+11,21,167,158,144,146,157,26,157,124,152,119,128,128,135,128,125,30,251,43,
+33,5,115,122,131,127,124,26,120,153,126,159,148,154,145,149,152,30,14,31,
+177,180,161,189,187,26,230,68,196,251,6,30,251,125,6,107,130,137,126,247,
+83,29,109,156,127,182,30,149,6,59,251,250,5,128,6,108,128,136,127,190,29,
+182,30,247,105,6,167,154,247,16,29,156,26,155,129,155,124,144,30,142,130,
+247,162,29,46,6,218,247,250,21,247,7,6,196,172,116,99,78,86,96,63,31,251,
+5,6,14,251,68,6,157,218,5,143,157,139,141,247,98,29,121,58,5,107,6,106,130,
+137,126,247,69,29,169,6,94,251,93,5,137,130,138,131,127,26,107,153,111,164,
+123,30,119,169,183,128,184,27,210,235,161,168,195,31,164,152,151,156,161,
+26,165,122,156,114,127,132,137,130,119,30,118,90,88,128,88,27,91,113,148,
+157,146,140,146,141,148,31,11,21,118,121,120,118,125,148,130,156,138,31,162,
+138,146,138,149,134,8,157,130,151,122,122,26,101,106,118,79,105,125,142,148,
+127,30,146,132,136,140,132,27,120,121,120,118,112,181,121,203,196,177,152,
+168,170,31,165,164,156,175,169,26,167,124,165,114,155,30,181,166,158,170,
+178,26,191,102,172,80,72,75,102,101,125,149,128,152,148,147,142,146,145,30,
+159,160,154,145,167,27,170,157,127,117,115,111,114,111,31,11,143,7,171,121,
+156,107,102,127,121,76,132,30,137,114,133,117,129,112,8,132,118,135,123,131,
+26,115,161,119,166,161,152,149,168,153,30,199,168,168,155,225,27,189,172,
+129,123,119,103,125,85,138,31,96,138,139,139,130,137,8,113,133,125,122,114,
+26,114,150,124,163,131,30,152,135,146,138,176,138,8,182,138,169,128,126,26,
+114,80,116,73,71,86,153,171,83,30,153,113,124,145,126,27,112,113,113,111,
+11,21,46,229,5,148,129,131,143,130,27,116,114,116,118,129,143,132,153,126,
+31,247,23,251,17,247,67,247,16,153,149,146,145,141,140,25,145,145,144,152,
+148,26,155,124,153,122,129,126,134,131,129,30,14,248,106,243,21,218,247,248,
+5,197,141,226,29,57,247,4,29,111,251,21,5,96,67,94,122,97,27,112,126,148,
+157,150,142,160,142,152,31,165,247,8,5,204,140,160,152,177,26,178,116,152,
+75,30,247,24,29,117,136,115,124,26,68,197,89,221,187,185,151,163,186,30,117,
+40,5,11,251,13,6,107,129,136,127,124,247,36,29,139,158,27,150,6,115,32,5,
+169,104,95,153,82,27,48,66,111,79,78,31,87,89,108,69,74,26,85,163,88,179,
+106,30,113,172,189,125,200,27,196,180,150,171,196,31,132,109,5,247,13,6,170,
+151,142,151,153,31,155,247,23,29,128,6,11,248,177,247,110,21,169,151,142,
+151,154,31,155,151,148,157,156,26,156,128,155,125,144,30,142,131,130,140,
+120,27,252,19,175,29,121,123,26,108,156,127,183,30,14,247,85,29,225,238,151,
+29,5,178,143,164,163,172,247,78,29,39,6,107,129,136,127,157,29,136,148,145,
+138,159,27,149,6,111,251,20,5,251,98,6,167,247,20,5,151,6,170,150,142,151,
+154,31,155,151,247,182,29,39,159,29,11,183,140,169,164,174,247,17,29,130,
+133,140,118,27,251,22,6,107,247,188,29,81,251,155,251,63,248,2,5,251,9,247,
+142,29,121,123,26,109,156,127,182,30,149,6,59,251,250,5,96,109,114,103,109,
+157,127,182,31,247,21,6,168,153,143,150,153,31,11,21,144,136,145,135,147,
+134,8,122,164,153,133,158,27,167,167,155,180,182,31,164,162,146,150,155,26,
+158,125,154,121,128,128,133,128,129,30,104,108,126,129,124,27,131,139,139,
+165,99,31,170,92,129,144,115,27,103,104,119,96,101,31,122,121,133,127,125,
+26,121,153,126,158,149,148,143,147,147,30,180,182,149,147,151,27,146,144,
+136,125,160,31,14,5,165,151,141,143,149,31,159,148,156,164,160,26,167,118,
+153,99,30,251,12,247,93,29,60,251,248,5,251,92,6,218,247,249,5,166,151,141,
+143,149,31,160,148,156,163,160,26,168,119,153,98,30,251,12,6,88,108,116,101,
+108,153,129,187,138,31,66,251,249,5,99,133,114,116,107,26,111,159,124,180,
+30,11,247,40,29,137,129,137,127,133,26,117,158,121,163,157,157,147,152,152,
+30,149,149,143,148,145,165,153,203,24,145,29,14,247,214,21,64,251,228,129,
+91,95,107,84,140,25,251,2,6,107,129,136,127,124,31,124,127,129,121,123,26,
+109,156,127,183,30,247,5,6,247,4,240,217,241,161,31,237,248,77,5,251,199,
+6,107,130,137,126,123,247,87,29,157,127,182,30,247,202,247,172,21,251,20,
+6,115,251,0,5,247,19,6,14,247,56,21,148,179,5,142,154,141,155,155,26,247,
+5,54,212,251,24,251,61,251,40,251,19,251,37,251,3,224,70,247,31,220,247,7,
+159,161,183,30,162,150,152,158,162,26,162,122,156,115,128,127,137,136,126,
+30,116,41,114,135,93,27,55,96,163,191,125,31,163,231,21,189,172,196,167,209,
+27,207,189,107,93,144,31,11,248,201,247,28,29,124,129,129,135,130,126,30,
+251,19,56,5,121,127,130,127,125,26,124,150,128,155,148,149,143,148,153,30,
+251,16,230,21,104,108,110,106,115,157,121,165,174,195,29,11,247,124,247,40,
+29,137,129,137,127,133,26,117,158,121,163,176,161,160,184,149,30,153,203,
+5,145,29,11,149,61,154,131,141,125,150,8,128,148,132,153,151,26,181,198,176,
+207,199,179,115,103,107,139,139,146,130,30,130,146,153,133,154,27,156,156,
+147,152,152,31,11,251,112,247,7,29,195,6,251,123,251,249,107,138,129,137,
+125,127,25,123,126,247,53,29,182,30,247,24,6,169,152,143,150,153,158,29,130,
+133,140,118,27,124,6,169,186,5,11,200,29,123,150,129,155,148,148,143,148,
+153,30,14,247,124,21,216,6,138,137,5,135,121,139,138,130,26,116,247,120,29,
+142,147,145,166,163,247,0,24,144,157,139,142,147,26,162,120,156,114,122,122,
+131,126,126,30,128,128,136,132,132,111,138,135,24,63,247,58,29,247,118,6,
+129,96,5,136,11,21,247,170,29,168,117,159,109,31,14,121,31,131,105,5,132,
+191,29,122,26,109,157,127,182,30,144,6,91,251,111,247,173,29,122,26,110,157,
+126,182,30,248,106,6,167,154,143,150,152,31,155,151,148,157,156,26,168,122,
+151,96,30,11,199,29,174,162,162,183,149,30,140,144,5,247,25,6,251,198,251,
+129,120,54,5,248,78,6,159,226,5,142,155,140,143,147,26,162,120,156,114,107,
+118,122,104,128,30,11,136,233,29,168,153,247,8,29,130,141,111,27,138,6,176,
+247,61,5,190,204,165,150,185,27,183,166,123,113,132,138,129,136,127,31,11,
+159,29,122,26,11,247,112,29,251,23,6,106,130,137,126,247,83,29,109,156,127,
+183,30,186,6,53,251,130,113,247,95,5,251,1,6,251,9,251,94,159,247,129,5,184,
+6,169,152,142,151,153,31,154,151,149,157,155,26,156,11,21,99,113,119,110,
+114,153,129,174,31,247,136,6,178,166,159,168,164,126,149,103,31,14,6,106,
+130,137,126,247,83,29,109,156,127,182,30,11,110,29,109,157,127,182,30,11,
+5,176,141,167,165,172,26,166,117,154,99,30,39,6,89,107,114,101,113,161,124,
+178,31,149,6,127,84,5,251,112,6,151,194,5,147,6,189,171,163,176,168,119,153,
+98,31,39,6,89,107,114,100,116,154,126,168,136,31,92,251,111,5,115,125,11,
+247,191,248,137,21,251,27,247,105,29,247,31,247,29,247,2,247,4,247,31,247,
+31,251,2,247,3,251,30,31,251,86,251,143,21,246,226,225,246,247,0,225,53,33,
+33,53,52,34,251,1,51,224,243,30,11,21,140,152,140,151,147,26,185,100,175,
+90,89,100,103,93,132,140,126,140,126,30,168,251,172,5,106,142,161,119,172,
+27,171,161,159,172,142,31,90,251,128,21,181,172,170,178,178,106,170,97,31,
+122,6,98,106,108,100,100,172,108,180,31,11,156,157,147,152,152,30,149,149,
+143,149,145,165,172,247,40,24,252,89,247,199,29,110,157,126,182,30,11,122,
+29,14,248,45,248,96,21,234,6,191,169,162,178,168,120,152,97,31,251,188,247,
+140,29,231,6,60,251,248,5,44,6,88,108,116,100,110,158,126,181,31,247,189,
+6,191,169,162,178,168,121,152,96,31,46,6,11,135,30,59,251,250,5,137,191,29,
+123,26,108,156,127,182,30,247,13,6,169,152,247,16,29,155,26,156,129,156,124,
+144,30,142,131,132,139,118,27,130,247,58,29,11,247,245,248,73,21,46,47,101,
+77,80,31,92,89,111,78,84,26,251,3,226,64,247,22,247,57,247,43,247,19,247,
+31,247,2,52,215,251,19,30,112,36,21,217,192,99,80,60,53,71,40,64,86,180,197,
+216,225,209,235,31,11,161,29,114,185,186,128,193,27,247,49,247,9,227,247,
+11,187,111,180,93,159,31,113,151,11,21,108,79,80,123,85,27,104,111,152,155,
+148,147,150,153,151,31,164,171,179,152,188,27,172,169,136,132,179,31,11,245,
+29,167,197,171,153,175,163,168,31,181,175,188,160,202,27,182,173,131,124,
+160,31,149,131,143,131,124,26,104,152,124,170,175,162,161,183,149,30,11,81,
+6,76,116,125,101,101,161,125,203,31,247,40,6,202,163,153,176,173,117,157,
+94,140,31,218,247,249,5,197,140,226,29,57,247,4,29,111,251,21,11,140,153,
+148,140,144,27,167,153,132,124,122,125,130,178,29,178,123,158,98,148,31,11,
+248,197,132,29,157,155,26,156,128,156,125,143,30,142,130,247,162,29,251,168,
+247,7,29,247,6,6,79,251,159,130,96,134,131,114,120,25,118,112,101,11,248,
+248,247,110,21,169,151,142,151,154,31,155,151,148,157,156,26,156,128,155,
+125,144,30,142,131,130,140,120,27,252,161,175,29,121,123,26,108,156,127,183,
+30,14,138,152,138,251,49,251,93,24,76,247,93,5,180,141,167,164,173,26,157,
+129,154,124,144,30,142,130,133,247,44,29,123,26,114,151,127,167,134,30,11,
+21,109,120,116,104,66,203,86,225,204,204,168,189,183,31,161,164,154,169,159,
+26,157,127,151,120,117,129,130,107,125,30,96,119,93,112,85,27,85,106,166,
+184,31,167,140,130,150,119,27,14,5,77,191,29,122,26,109,157,127,182,30,247,
+123,6,167,154,247,16,29,156,26,155,129,155,124,212,29,79,6,11,248,61,21,251,
+75,6,106,129,136,127,152,29,11,142,151,153,31,154,151,148,157,155,26,157,
+247,112,29,47,175,29,121,123,26,113,152,126,171,136,30,152,251,214,5,239,
+6,11,6,168,153,247,16,29,156,26,155,129,155,124,212,29,11,26,177,116,153,
+75,30,44,6,75,116,126,102,103,163,121,187,31,141,6,60,251,248,5,77,116,125,
+100,102,162,125,203,31,247,122,29,170,247,36,5,11,21,61,63,68,67,86,184,97,
+195,181,180,157,171,172,31,167,168,151,166,177,26,193,96,179,79,30,127,79,
+21,172,159,121,109,104,99,103,100,107,117,158,167,176,178,174,180,31,11,103,
+30,58,65,125,127,128,130,136,247,96,29,5,191,141,158,154,176,26,177,119,151,
+77,30,62,247,4,29,90,11,219,29,90,235,189,124,247,50,29,14,247,2,6,173,160,
+157,168,158,126,149,112,31,251,0,6,141,152,140,145,147,26,167,125,153,111,
+102,119,119,90,126,30,94,6,105,118,121,110,119,152,130,166,31,182,6,11,190,
+29,182,30,247,235,247,185,29,212,29,251,8,6,11,26,164,120,157,113,125,126,
+134,128,125,30,107,113,139,139,127,133,8,125,111,98,131,93,27,39,78,184,212,
+150,140,151,142,150,31,153,200,5,239,161,227,211,240,27,11,30,85,247,18,21,
+163,155,125,117,107,113,113,105,115,123,153,161,172,165,164,173,31,105,251,
+51,21,166,156,121,112,109,247,159,29,170,31,11,247,57,6,252,12,251,252,116,
+38,5,248,98,6,177,247,59,5,143,158,139,140,147,26,162,247,160,29,130,134,
+128,134,114,124,73,24,11,116,27,108,107,124,110,107,31,111,113,126,120,122,
+26,124,151,128,156,150,149,144,150,150,30,175,175,148,145,207,29,11,138,132,
+128,31,122,130,128,120,120,26,121,148,123,154,128,30,132,150,152,136,165,
+27,11,249,42,160,29,149,151,156,29,11,21,105,108,110,107,114,157,121,165,
+174,170,168,172,164,247,108,29,157,121,165,174,170,168,173,163,121,156,112,
+31,14,245,219,213,157,127,151,122,116,127,128,109,127,31,97,123,92,110,86,
+27,114,117,146,154,120,31,123,151,136,146,136,168,8,172,136,132,148,117,27,
+14,190,29,183,30,212,6,90,251,111,5,251,10,114,29,11,5,179,144,164,162,172,
+247,17,29,130,247,162,29,47,6,108,127,136,127,125,247,130,29,122,247,90,29,
+11,21,152,125,133,247,147,29,150,129,31,247,2,247,66,29,148,127,151,31,14,
+21,64,70,74,69,88,178,101,193,213,209,204,209,191,100,176,85,31,126,83,21,
+166,159,120,114,104,104,106,102,112,119,158,165,173,174,172,176,31,11,26,
+155,126,150,121,130,131,136,132,129,30,133,135,251,184,251,70,247,105,251,
+71,5,126,153,142,138,150,27,161,161,157,158,146,135,148,131,147,31,11,247,
+83,29,122,247,90,29,11,31,154,151,149,157,156,247,17,29,11,175,29,122,11,
+247,9,29,14,139,139,133,147,8,148,132,125,145,124,27,103,117,118,94,129,31,
+125,76,5,136,126,138,130,132,26,117,158,122,164,156,148,143,157,160,30,11,
+154,128,30,132,150,152,136,165,27,248,20,6,162,152,141,145,149,165,29,11,
+159,26,247,17,55,223,251,17,30,251,105,6,106,130,247,54,29,122,123,26,121,
+247,90,29,144,137,146,138,152,138,11,34,238,251,38,31,123,61,21,246,216,67,
+39,251,27,251,30,251,22,251,35,251,3,62,209,241,247,29,247,30,247,20,247,
+39,31,14,31,156,149,150,157,158,26,157,130,155,124,150,30,147,127,130,141,
+110,27,11,247,149,21,173,251,149,5,247,8,6,247,55,248,98,5,174,145,163,163,
+11,21,251,5,251,91,5,133,129,136,129,132,247,34,29,195,22,251,5,251,91,5,
+133,11,166,123,113,132,138,129,136,127,31,103,251,52,5,137,6,107,128,137,
+127,124,31,123,126,247,53,29,182,30,247,4,6,11,6,168,153,247,16,29,155,26,
+11,247,43,21,148,92,5,121,175,29,121,122,26,109,157,127,181,30,247,31,6,168,
+153,143,150,153,31,11,21,251,69,251,23,5,122,126,132,129,127,26,123,152,128,
+157,148,147,142,146,149,30,145,143,247,183,247,70,251,104,247,71,5,152,11,
+237,29,163,25,175,177,212,221,144,145,144,144,151,151,25,11,144,143,135,130,
+145,30,119,153,149,133,159,27,165,157,156,163,169,114,160,104,115,114,130,
+124,119,31,102,110,125,96,50,26,14,6,107,129,247,43,29,11,6,107,129,232,29,
+11,129,155,124,144,30,142,131,132,139,118,27,138,6,178,247,63,5,142,153,140,
+152,152,26,213,80,188,48,89,88,120,106,96,30,11,21,216,183,103,77,110,126,
+107,116,113,31,99,104,93,119,81,27,63,94,175,201,168,152,171,162,165,31,179,
+175,184,159,197,27,11,115,123,119,145,148,123,31,150,121,138,140,130,27,114,
+116,117,116,125,146,129,155,129,31,126,161,178,129,167,27,213,199,192,205,
+11,247,121,29,125,137,135,131,26,126,153,127,154,153,153,147,156,152,30,247,
+95,247,154,5,14,21,152,125,134,142,127,27,112,231,29,163,148,11,251,19,30,
+163,235,5,143,6,174,162,161,171,175,115,153,76,31,95,6,79,116,125,102,113,
+153,123,169,130,31,120,41,100,11,157,247,163,29,132,139,119,27,109,6,11,126,
+26,118,154,124,159,148,156,147,148,149,30,11,144,30,142,130,247,162,29,47,
+6,108,128,136,127,124,31,124,127,129,121,122,26,126,143,130,150,129,30,75,
+96,95,11,27,247,86,6,160,153,149,155,155,127,148,116,31,251,88,6,251,20,96,
+144,158,104,31,84,168,101,203,203,26,197,171,11,129,31,119,130,122,115,117,
+26,112,160,124,179,30,247,13,6,188,247,157,29,152,198,5,11,140,138,156,121,
+31,247,20,251,16,247,73,247,16,5,167,158,145,146,157,26,157,126,152,120,129,
+130,135,129,125,30,11,247,70,29,117,125,129,124,124,26,120,153,126,159,149,
+150,144,149,155,30,11,21,98,208,29,109,31,247,99,22,99,101,104,102,110,161,
+118,169,11,247,83,29,109,157,127,11,6,107,247,14,29,122,11,98,211,29,11,214,
+29,131,132,140,11,27,121,121,131,125,128,31,131,128,136,128,113,26,251,83,
+7,247,107,29,11,170,168,172,164,121,156,113,31,247,215,22,104,108,110,106,
+115,157,121,165,174,170,168,172,164,121,156,113,31,11,247,203,248,241,21,
+99,113,119,110,114,153,129,174,31,247,136,6,178,166,160,167,164,126,149,103,
+31,14,120,156,113,104,117,117,94,129,30,128,92,5,251,139,6,11,128,26,116,
+161,119,164,162,154,150,173,158,30,216,183,192,172,219,27,192,173,120,109,
+93,80,102,66,31,11,247,169,242,21,247,200,247,130,158,223,5,252,53,6,115,
+33,5,137,129,137,126,132,26,117,158,122,164,11,236,29,121,127,130,127,125,
+26,11,26,151,134,151,129,146,30,147,130,130,141,111,27,39,110,29,11,247,196,
+21,228,247,88,5,151,166,142,148,247,35,29,11,248,219,21,119,251,138,5,138,
+133,139,134,137,26,124,151,128,155,161,151,149,166,148,30,227,247,140,5,11,
+130,148,158,135,180,27,200,165,155,175,172,114,158,95,31,125,6,138,6,135,
+6,96,218,129,157,124,11,251,213,5,64,6,189,247,110,5,174,148,157,159,169,
+26,169,119,153,98,30,95,6,81,108,118,100,11,135,130,126,30,251,18,56,5,120,
+127,130,127,125,26,123,150,129,155,148,149,143,148,153,30,14,156,27,153,145,
+136,122,162,31,112,177,170,125,162,27,11,211,29,177,167,117,160,11,6,89,107,
+115,103,110,159,124,180,31,11,142,151,154,31,155,151,148,156,156,26,11,101,
+104,102,110,161,118,169,180,177,174,11,144,30,142,130,133,140,118,27,11,6,
+113,131,138,133,129,31,123,130,129,121,122,26,122,147,123,153,130,30,132,
+150,151,136,164,27,11,21,247,105,247,118,5,161,149,141,144,150,31,160,150,
+154,161,161,247,86,29,11,151,31,131,122,137,133,136,125,8,168,251,248,21,
+188,247,111,5,203,6,90,251,111,5,14,247,154,29,123,30,14,5,182,145,161,159,
+172,26,169,119,153,97,30,72,6,82,108,118,100,112,153,126,169,136,31,11,21,
+165,157,145,147,157,26,157,124,152,119,128,128,135,128,125,30,251,43,33,5,
+116,122,130,11,31,159,228,5,141,150,141,150,146,26,161,120,156,114,103,117,
+117,95,129,30,104,251,50,5,11,247,17,24,251,74,251,16,5,111,120,133,131,122,
+26,121,153,126,157,149,147,142,149,154,30,11,248,135,21,251,19,6,115,251,
+0,5,247,19,6,11,129,135,130,126,30,251,19,247,37,29,11,21,146,149,145,153,
+147,26,154,128,150,124,124,247,135,29,129,11,100,251,65,5,137,126,137,129,
+133,247,118,29,155,210,5,11,251,74,251,17,5,110,120,134,132,122,26,121,153,
+126,157,149,148,143,148,153,30,14,159,153,175,26,177,116,153,75,30,11,136,
+127,124,31,124,127,129,121,122,26,122,150,123,153,134,30,136,147,150,138,
+156,27,11,142,151,154,247,79,29,142,130,247,162,29,11,75,26,81,107,80,91,
+107,30,113,101,99,133,251,33,27,251,88,6,116,127,130,123,11,98,5,137,129,
+137,129,130,26,112,156,126,172,180,152,155,209,156,30,170,247,20,5,11,116,
+117,114,131,145,128,150,129,31,247,2,33,5,126,152,147,135,149,27,165,163,
+161,11,136,127,124,31,123,127,130,11,247,30,29,181,30,247,5,6,11,131,7,140,
+106,162,119,176,141,8,247,19,6,176,137,162,159,140,172,8,147,7,11,247,179,
+21,247,84,247,66,5,181,140,169,165,173,247,17,29,11,247,28,29,123,130,128,
+135,130,126,30,251,18,56,5,11,158,6,202,162,153,176,178,117,153,75,31,124,
+6,105,247,1,128,176,121,168,116,11,220,6,168,154,143,150,152,247,57,29,170,
+123,151,94,30,129,6,11,6,83,91,5,64,7,247,192,247,141,251,192,247,142,5,63,
+7,195,92,5,11,6,169,152,142,151,153,247,65,29,11,247,8,29,131,141,11,30,166,
+179,176,144,247,35,27,247,88,6,161,152,149,155,155,126,148,117,31,11,225,
+247,113,29,154,210,5,162,6,178,138,147,11,135,136,125,27,129,128,144,158,
+110,31,169,247,133,29,108,106,124,11,26,164,120,157,114,126,129,135,131,127,
+30,106,91,105,130,59,27,38,91,11,31,123,127,130,121,122,26,127,144,128,149,
+131,30,131,148,147,137,168,27,11,195,186,5,215,7,251,192,251,142,247,192,
+251,141,5,214,7,83,187,5,11,97,138,117,121,105,26,102,162,125,202,30,187,
+247,132,29,168,124,11,248,6,21,143,157,139,140,147,26,164,123,154,113,117,
+126,131,120,128,30,11,247,83,29,110,157,126,11,6,76,115,125,103,104,161,122,
+185,138,31,11,158,122,164,156,157,147,152,152,30,149,149,11,248,97,21,193,
+6,169,151,142,151,154,31,11,6,106,131,137,126,123,247,87,29,156,127,183,30,
+11,143,150,153,247,52,29,150,129,148,30,146,130,11,21,247,25,29,11,21,167,
+95,105,155,124,27,132,132,131,130,133,143,134,151,128,31,174,11,27,79,95,
+174,186,143,140,147,140,146,31,200,247,162,5,170,6,170,11,157,127,182,30,
+247,25,6,188,171,162,175,170,120,153,97,31,124,6,11,247,102,29,148,136,144,
+130,148,31,11,129,247,54,29,11,6,108,128,136,127,124,31,123,11,143,150,153,
+31,154,151,149,157,11,26,156,129,155,124,144,30,142,11,124,130,118,119,31,
+110,111,136,137,125,27,128,129,144,158,110,31,11,5,135,121,139,136,247,94,
+29,11,247,61,29,120,153,126,11,143,150,247,46,29,11,21,171,247,38,5,247,1,
+6,194,175,117,104,90,66,99,51,31,11,151,148,157,155,26,157,129,247,109,29,
+132,139,119,27,11,51,6,76,115,125,103,104,160,122,184,138,31,114,251,4,5,
+134,11,101,100,102,102,112,163,115,167,180,176,174,178,168,117,161,108,31,
+11,115,161,105,31,122,6,95,97,101,98,107,163,116,173,31,14,6,169,152,142,
+151,153,31,155,151,148,11,21,158,151,147,151,153,26,154,128,149,11,6,94,251,
+111,5,129,6,85,110,119,103,108,161,124,181,31,11,6,107,129,247,175,29,11,
+137,135,130,30,136,131,134,138,135,27,131,136,142,146,142,139,11,143,26,161,
+247,72,29,11,146,27,145,151,131,123,158,31,87,200,178,119,181,27,181,171,
+11,26,126,153,128,154,154,247,149,29,11,152,26,162,122,154,111,97,128,126,
+72,127,30,103,251,95,5,11,31,123,127,130,122,123,26,121,247,90,29,136,147,
+148,11,56,5,121,127,130,127,125,26,123,150,129,155,148,148,143,148,11,75,
+251,21,113,247,34,5,45,6,51,251,34,134,247,21,5,11,251,18,247,17,251,74,251,
+17,5,110,120,134,132,122,26,121,11,242,21,248,15,247,255,161,237,5,252,52,
+6,102,251,57,5,11,5,144,158,139,140,148,26,161,120,156,114,103,116,117,95,
+11,6,107,129,137,126,124,31,124,127,129,121,123,26,109,157,11,136,127,247,
+69,29,11,140,119,27,49,6,107,129,136,127,124,31,124,127,129,121,11,26,88,
+178,106,200,220,203,197,212,163,130,162,123,155,30,11,153,31,154,151,149,
+247,155,29,11,31,167,162,158,168,161,26,156,128,149,121,122,128,131,120,11,
+158,122,164,156,157,147,152,152,30,149,148,143,149,145,165,11,49,5,130,148,
+148,135,149,27,163,162,161,161,151,138,140,11,199,27,199,200,158,174,189,
+31,196,179,164,176,154,202,8,11,148,134,149,27,165,163,161,162,149,11,31,
+155,151,148,157,156,26,151,134,11,130,122,122,26,109,157,127,11,137,126,124,
+31,123,127,130,11,142,151,154,31,154,151,149,11,31,154,151,149,157,156,26,
+11,31,155,151,148,157,155,26,11,6,167,247,19,5,11,247,125,29,120,30,251,49,
+33,5,116,11,5,125,6,102,107,110,106,111,160,125,179,31,244,6,11,136,126,120,
+30,251,50,33,5,117,124,129,125,123,26,11,21,251,43,101,247,143,29,11,150,
+142,151,154,247,57,29,169,121,151,11,31,173,247,45,147,128,146,125,142,125,
+25,173,251,37,11,247,57,29,157,129,154,124,144,30,142,11,33,5,128,150,149,
+134,149,27,165,163,161,162,149,134,11,184,176,8,146,145,142,143,146,26,148,
+132,146,131,124,11,120,26,122,148,122,154,128,30,132,150,152,136,165,27,11,
+124,31,124,127,129,121,123,26,109,157,127,182,30,11,125,152,119,127,131,136,
+126,121,30,251,50,33,5,11,126,130,123,123,26,126,247,128,29,11,129,150,121,
+121,127,126,115,133,30,106,251,43,5,11,6,51,102,132,113,100,31,71,94,104,
+64,39,26,11,247,57,21,171,251,57,5,236,6,247,47,247,214,11,21,112,131,138,
+132,128,31,122,129,128,121,120,26,11,21,102,107,109,104,101,170,109,178,177,
+170,169,176,11,248,30,21,167,109,93,155,88,27,251,50,251,30,11,26,157,129,
+154,124,212,29,11,31,155,151,148,156,156,26,157,129,154,124,144,30,11,162,
+161,162,150,138,140,122,156,31,251,18,247,17,11,247,250,21,200,251,118,5,
+235,6,247,46,247,116,11,105,108,110,107,114,157,122,166,173,170,168,172,163,
+11,124,31,123,127,130,122,122,26,11,131,27,133,127,146,152,124,31,11,21,112,
+119,116,107,67,207,82,11,26,155,128,155,125,144,30,142,11,31,123,127,130,
+122,122,26,109,11,119,26,109,166,113,171,160,149,11,6,90,251,110,5,11,149,
+123,154,134,30,11,128,27,115,116,117,117,129,142,134,150,129,31,11,5,177,
+141,166,165,172,26,167,118,153,99,30,11,6,89,107,116,102,110,159,124,180,
+31,148,6,11,131,26,117,158,122,164,156,157,147,152,152,30,11,8,128,144,131,
+145,145,26,155,191,155,189,181,11,138,25,137,135,132,138,130,27,128,6,147,
+182,11,21,152,126,133,142,127,27,112,116,117,115,130,11,147,26,162,120,156,
+114,103,116,117,95,130,30,11,152,132,136,142,130,27,132,135,135,121,129,31,
+11,31,129,138,5,137,6,135,6,46,248,96,5,11,158,122,164,156,156,147,152,153,
+30,149,149,143,11,49,5,129,148,148,135,149,27,163,162,161,162,11,196,27,247,
+53,247,27,247,7,247,28,247,0,11,251,4,6,108,127,136,127,124,31,124,126,130,
+11,251,5,251,4,251,27,251,34,247,2,251,4,11,99,147,91,27,251,29,34,70,49,
+76,191,108,11,116,141,128,145,129,30,123,150,158,129,159,27,11,247,123,29,
+114,11,155,125,144,30,142,130,11,125,31,225,130,165,129,117,26,117,82,120,
+11,128,247,109,29,247,162,29,11,129,154,124,144,30,142,130,133,140,119,27,
+11,6,202,163,153,175,174,117,156,93,140,31,11,6,89,107,114,100,111,155,129,
+185,138,31,11,134,150,129,147,30,147,130,130,141,111,27,11,21,152,125,134,
+142,127,27,112,116,117,114,11,24,144,158,139,140,148,26,162,120,156,114,11,
+26,117,158,122,165,173,163,162,182,148,30,11,26,123,151,129,158,162,156,153,
+162,144,30,11,158,122,164,156,156,147,152,152,30,150,149,11,247,136,247,28,
+21,251,13,251,128,5,132,11,234,6,202,163,153,176,175,116,156,88,31,11,121,
+156,112,31,247,97,22,105,108,110,107,11,120,156,112,105,115,115,95,129,30,
+14,125,152,119,127,132,136,126,11,130,122,123,26,108,156,127,11,142,146,150,
+26,157,125,152,11,144,128,149,130,30,131,149,11,150,128,155,153,151,147,156,
+11,31,123,127,130,121,123,26,11,118,101,109,160,124,182,31,11,6,203,162,153,
+176,11,95,122,146,116,27,11,124,26,120,153,126,159,149,151,144,149,11,129,
+132,121,125,30,251,212,252,71,5,11,6,95,97,100,98,107,163,117,173,31,11,6,
+190,170,162,177,170,122,151,95,31,11,6,114,123,125,117,122,148,131,159,31,
+11,6,177,170,167,173,167,118,153,98,31,11,6,87,109,116,100,110,158,126,181,
+31,11,6,89,107,115,102,108,157,127,182,31,11,6,107,128,136,127,125,31,123,
+127,130,11,134,113,94,31,70,98,97,63,55,26,11,134,30,136,147,148,138,158,
+27,150,6,11,138,133,130,31,124,130,130,123,123,26,11,140,116,125,100,26,102,
+162,125,203,30,11,142,127,27,113,116,117,115,130,145,128,11,21,251,36,6,235,
+251,120,5,120,147,11,149,145,157,155,30,247,88,247,118,5,11,150,6,102,251,
+61,5,135,124,138,126,11,27,156,157,147,152,152,31,149,149,143,11,154,134,
+30,143,137,144,138,149,138,240,11,30,216,192,194,87,5,110,130,120,115,11,
+31,160,161,148,153,152,26,153,125,151,11,157,155,26,156,128,155,125,144,30,
+142,11,164,115,172,31,148,6,148,6,182,182,11,171,162,176,168,119,153,98,31,
+130,6,11,248,84,248,61,21,251,75,6,106,129,11,113,118,103,111,121,152,159,
+170,172,171,11,120,156,114,122,121,131,126,126,30,129,11,134,148,127,151,
+31,14,132,140,119,27,11,156,247,17,29,131,11,6,170,150,142,151,154,31,155,
+151,148,157,11,210,29,156,11,247,16,29,155,26,156,128,11,22,192,29,11,247,
+5,29,143,11,169,151,210,29,11,192,29,177,11,124,247,130,29,109,157,127,181,
+30,11,247,3,29,181,30,11,5,127,191,29,11,132,26,117,158,122,164,156,157,147,
+152,152,30,149,11,137,127,124,31,123,126,130,122,122,26,110,157,126,11,248,
+185,247,6,29,11,5,251,13,159,29,11,30,247,68,6,168,153,247,16,29,11,26,156,
+129,155,124,212,29,111,6,11,157,155,26,156,247,111,29,11,251,3,110,29,11,
+148,156,156,26,156,129,155,124,212,29,11,247,46,29,130,11,109,31,247,100,
+247,167,29,11,169,29,156,129,155,124,11,247,57,29,157,129,155,124,144,30,
+142,131,132,139,11,22,99,208,29,108,31,14,130,137,126,247,83,29,109,156,127,
+182,30,169,6,11,247,21,29,130,11,72,251,194,5,238,169,29,11,165,29,14,247,
+16,29,155,26,157,129,155,124,144,30,142,131,132,11,154,128,30,132,150,152,
+136,165,27,248,180,6,162,152,141,145,149,31,156,11,158,29,131,247,162,29,
+109,6,11,5,42,114,29,247,193,6,11,120,26,122,148,122,247,193,29,11,21,112,
+131,147,29,11,6,168,153,143,150,153,31,154,151,149,182,29,14,113,29,149,6,
+59,251,250,5,128,247,15,29,127,130,122,122,26,11,183,29,247,169,240,21,152,
+151,146,145,139,26,147,148,142,146,150,26,157,124,153,120,125,131,135,127,
+125,30,251,8,38,5,11,81,29,14,57,29,14,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,
+6,1,135,255,2,135,254,2,243,2,0,1,0,2,0,3,0,57,0,75,1,12,1,225,2,77,2,215,
+2,247,3,63,3,134,3,243,4,38,4,40,4,42,4,49,4,92,4,189,4,236,5,87,5,208,6,
+25,6,135,6,255,7,55,7,160,8,24,8,42,8,80,8,154,8,185,9,3,9,108,10,16,10,19,
+10,23,10,26,10,29,10,32,10,86,10,89,10,104,10,107,10,127,10,130,10,133,10,
+145,10,148,10,151,10,165,11,69,11,72,11,75,11,78,11,81,11,171,11,192,11,200,
+11,212,11,216,12,9,12,52,12,109,12,161,12,176,12,194,12,197,13,53,13,56,13,
+59,13,62,13,86,13,89,13,109,13,115,13,119,13,122,13,125,14,22,14,25,14,28,
+14,32,14,156,14,159,14,162,14,165,14,168,14,249,14,252,15,10,15,13,15,33,
+15,154,15,167,16,31,16,91,16,162,17,41,17,170,17,172,18,88,18,203,19,123,
+20,27,20,32,20,67,20,91,20,102,20,113,20,218,21,102,21,104,21,179,22,19,22,
+21,22,136,22,159,22,161,22,175,22,195,22,234,22,250,23,55,23,164,23,188,23,
+194,23,200,23,233,23,235,23,241,23,247,23,253,24,3,24,15,24,21,24,53,24,59,
+24,61,24,64,24,191,25,42,25,45,25,173,25,218,25,221,25,224,26,47,26,50,26,
+180,27,61,27,118,27,150,28,18,28,211,28,213,29,92,29,151,29,254,30,63,30,
+109,30,163,30,209,31,13,31,71,31,163,32,34,32,37,32,198,33,33,33,143,34,10,
+34,54,34,70,34,77,34,92,34,136,34,212,35,61,35,94,35,114,35,144,35,180,35,
+186,35,222,35,229,35,242,36,71,36,115,36,122,36,153,36,166,36,242,37,89,37,
+118,37,147,37,161,37,180,37,218,37,248,38,80,38,210,38,234,39,57,39,64,39,
+108,39,225,40,105,40,154,40,207,40,248,41,30,41,77,41,98,41,149,41,167,41,
+241,42,19,42,44,42,61,42,91,42,133,42,220,42,239,43,7,43,32,43,61,43,69,43,
+86,43,157,44,15,44,129,44,175,44,244,45,67,45,139,46,31,46,134,46,214,47,
+38,47,151,48,9,48,65,48,163,49,22,49,158,49,165,49,226,49,234,49,242,49,250,
+49,255,50,1,50,7,50,13,50,46,50,54,50,61,50,66,50,72,50,104,50,110,50,116,
+50,137,50,145,50,152,50,159,51,28,51,33,51,41,51,62,51,68,51,73,51,80,51,
+87,51,95,51,137,51,153,51,169,52,70,52,77,52,84,52,92,52,99,52,147,52,206,
+52,213,52,220,52,228,52,235,52,242,52,250,53,2,53,10,53,49,53,56,53,74,53,
+166,53,176,53,184,53,234,53,241,53,249,54,1,54,9,54,57,54,64,54,71,54,122,
+54,129,54,136,54,142,54,150,54,158,54,166,54,173,54,181,54,188,54,196,54,
+204,54,252,55,3,55,11,55,19,55,26,55,30,55,32,55,77,55,84,55,92,55,102,55,
+122,55,130,55,137,55,144,55,151,55,173,55,180,55,187,55,194,55,201,55,208,
+55,216,55,224,56,8,56,15,56,63,56,112,57,27,57,225,58,123,59,117,59,119,59,
+121,59,123,59,125,60,45,60,134,60,136,60,138,60,175,60,209,60,217,61,2,61,
+27,61,34,61,42,61,101,61,244,62,13,62,22,62,30,62,37,62,39,62,67,62,115,62,
+137,62,151,62,192,63,45,63,175,64,108,64,204,65,90,65,198,65,205,65,254,66,
+36,66,80,66,100,66,146,66,160,66,189,66,190,66,191,67,75,67,148,67,202,67,
+238,68,90,68,160,69,26,69,96,69,162,70,28,70,60,70,111,70,176,70,186,70,198,
+70,220,70,234,70,246,71,60,71,139,71,211,72,25,72,68,72,120,72,163,72,177,
+72,216,73,32,73,84,73,136,73,181,74,104,74,130,75,81,76,74,76,103,76,130,
+76,169,76,209,77,70,77,111,77,165,77,214,77,229,78,19,78,123,78,222,79,64,
+79,96,79,193,80,34,80,97,80,113,80,220,81,60,81,139,81,185,82,16,82,142,83,
+44,83,143,84,5,84,169,85,65,85,87,85,114,85,141,85,196,85,255,86,136,86,158,
+86,180,86,210,86,253,87,10,87,131,87,144,87,148,87,164,87,177,87,182,87,201,
+87,237,88,112,88,162,88,232,89,61,89,75,89,88,89,221,89,223,89,225,89,229,
+90,2,90,4,90,8,90,10,90,146,90,148,90,172,90,217,90,219,90,231,91,138,91,
+143,91,145,91,147,91,229,91,231,91,243,92,144,92,146,93,42,93,176,94,24,94,
+136,94,220,95,70,95,181,96,38,96,41,96,131,96,134,96,250,97,66,97,174,97,
+248,98,139,98,141,99,14,99,104,99,171,100,10,100,19,100,137,100,229,101,121,
+101,158,102,27,102,208,103,64,103,220,104,40,104,48,104,62,104,67,104,147,
+105,27,105,54,105,89,105,170,106,33,106,125,106,135,106,248,107,104,107,254,
+108,13,108,27,108,103,108,163,108,170,108,216,109,16,109,18,109,114,109,116,
+109,120,109,232,109,234,110,89,110,132,110,135,110,138,110,245,110,247,110,
+249,110,254,111,0,111,2,111,5,111,7,111,10,111,159,111,161,111,195,111,231,
+112,37,112,123,112,195,113,67,113,154,114,32,114,162,115,49,115,93,115,243,
+116,116,116,119,116,121,116,123,116,125,116,143,117,20,117,179,118,87,118,
+131,118,211,119,78,119,90,119,199,120,63,121,10,121,41,121,134,122,7,122,
+50,122,122,122,133,122,153,122,196,122,204,122,211,123,49,123,172,124,8,124,
+61,124,150,124,182,124,187,124,231,125,93,125,232,126,63,126,128,126,222,
+127,16,127,59,127,71,127,180,128,4,128,7,128,127,128,132,128,179,128,217,
+128,220,128,223,129,68,129,169,129,205,129,207,130,18,130,22,130,37,130,102,
+130,107,131,41,131,55,131,119,131,163,131,229,132,108,132,180,133,43,133,
+174,134,37,134,82,134,144,135,5,135,10,135,18,135,22,135,148,136,41,136,45,
+136,47,136,49,136,78,136,111,136,151,136,200,137,28,137,54,137,97,137,192,
+138,26,138,58,138,66,138,135,138,143,139,21,139,29,139,37,139,152,139,231,
+140,4,140,107,141,40,141,79,141,157,141,164,142,24,142,146,142,241,143,38,
+143,189,143,247,144,50,144,230,145,45,145,230,145,233,146,112,147,41,148,
+31,148,188,149,86,149,189,150,14,150,114,150,222,151,60,151,169,152,9,152,
+94,152,179,153,15,153,105,154,2,154,13,154,37,154,60,154,90,154,227,155,0,
+155,77,155,205,156,47,156,146,157,31,157,72,157,135,157,159,157,174,157,192,
+157,210,157,250,158,24,158,74,158,115,158,154,158,180,158,205,158,231,159,
+1,159,19,159,55,159,98,159,125,159,152,14,14,248,130,248,139,21,148,168,141,
+149,152,26,175,110,165,98,111,110,126,118,119,30,121,120,133,123,134,96,105,
+251,175,24,138,136,139,136,137,26,112,155,123,167,169,163,158,170,149,30,
+42,251,127,21,247,193,10,247,152,203,29,201,22,247,40,10,150,165,148,30,227,
+247,140,5,14,248,183,248,68,21,183,247,40,5,146,164,139,139,145,26,163,120,
+157,114,122,123,132,127,125,30,128,129,136,132,131,111,93,251,49,24,75,6,
+183,247,40,5,144,157,141,146,147,26,161,120,157,114,104,116,118,96,129,30,
+92,251,49,5,115,6,107,129,137,126,247,181,10,146,138,159,27,153,6,112,46,
+5,109,6,107,129,136,127,247,181,10,148,138,157,27,159,6,95,251,40,5,135,123,
+137,130,132,26,116,158,121,164,174,163,161,181,148,30,186,247,49,5,202,6,
+95,251,40,5,135,124,137,130,131,26,116,158,121,162,155,156,146,151,153,30,
+145,146,151,161,144,154,185,247,50,24,162,6,170,151,142,151,153,31,155,151,
+148,247,155,29,130,131,140,120,27,125,6,167,232,5,168,6,170,150,228,29,251,
+50,36,21,111,46,5,76,6,167,232,5,14,248,123,248,229,21,247,147,10,122,122,
+131,126,126,30,129,129,134,130,134,112,134,117,24,36,122,59,59,53,26,75,181,
+98,223,122,30,210,125,5,185,130,158,126,116,26,94,82,103,70,85,93,161,166,
+137,30,138,166,139,139,132,147,8,148,131,125,145,125,27,122,121,131,126,126,
+31,129,129,134,130,134,113,125,80,24,136,122,138,135,131,26,116,158,122,165,
+154,149,143,152,158,30,165,126,146,137,174,131,122,64,24,136,127,138,129,
+132,26,117,158,122,164,155,156,147,152,153,30,149,149,143,147,145,166,156,
+216,24,247,16,162,223,220,238,26,208,99,175,40,160,30,77,151,5,99,148,118,
+153,158,26,176,185,166,203,174,176,124,125,109,155,123,170,156,156,146,153,
+153,30,149,149,142,146,146,167,146,170,24,142,153,140,145,147,26,161,120,
+156,114,129,131,137,135,127,30,140,136,136,140,138,27,118,147,132,141,130,
+141,125,141,25,14,247,253,248,232,21,49,56,60,55,77,186,94,204,228,223,217,
+224,247,103,10,93,95,97,90,104,114,163,173,183,184,181,187,31,247,107,251,
+106,21,165,147,150,149,157,26,154,130,149,126,133,133,138,136,129,30,252,
+23,251,5,5,112,131,129,129,121,26,124,148,129,152,144,148,141,141,146,30,
+247,144,188,21,49,56,61,55,77,186,94,204,228,223,217,223,247,103,10,94,95,
+97,91,104,114,163,172,183,184,181,186,31,14,248,43,247,93,21,74,247,24,5,
+129,157,132,159,146,26,166,168,164,171,158,149,133,111,165,30,187,162,5,181,
+158,153,155,167,26,162,119,158,115,133,131,137,134,125,30,150,116,119,144,
+116,27,45,41,51,56,120,143,120,151,110,31,56,98,89,66,62,26,67,200,94,235,
+190,173,147,157,171,30,146,126,5,202,169,29,156,128,156,125,143,30,143,130,
+133,139,119,27,152,156,149,155,157,175,8,170,143,164,166,170,247,86,29,131,
+132,140,118,27,84,6,251,10,251,66,21,130,121,129,137,116,27,93,117,151,164,
+173,163,168,181,158,31,14,247,240,248,238,21,251,13,251,127,5,131,125,138,
+134,131,26,126,153,128,155,152,153,147,155,152,30,247,95,247,154,5,14,248,
+208,248,247,21,109,119,123,72,85,31,251,8,251,35,87,251,15,251,25,26,55,168,
+251,4,176,80,30,126,148,151,132,157,27,174,170,168,172,145,138,144,134,151,
+31,107,214,126,197,204,26,247,22,193,247,12,247,14,247,30,30,155,158,144,
+149,155,26,163,120,156,113,30,14,247,194,248,247,21,104,108,110,106,133,140,
+134,144,127,31,171,65,152,80,74,26,251,21,84,251,13,251,13,251,30,30,123,
+121,134,127,124,26,115,158,122,165,169,160,155,206,192,30,247,9,247,37,190,
+247,13,247,25,26,223,110,247,4,101,198,30,152,131,126,146,122,27,14,247,183,
+247,250,21,76,75,5,115,114,133,129,121,26,114,157,122,165,161,151,146,165,
+165,30,203,204,173,75,5,112,153,149,132,162,27,171,172,169,168,150,137,144,
+129,158,31,105,203,226,164,5,184,151,159,159,170,26,162,121,158,115,129,135,
+138,133,117,30,54,115,156,216,5,142,154,140,145,147,26,161,120,156,114,104,
+116,117,95,129,30,121,59,63,164,5,145,119,136,140,130,27,106,108,109,107,
+117,150,128,171,129,31,14,248,39,247,111,21,247,30,136,10,251,28,6,172,247,
+43,247,41,29,130,30,104,251,45,5,251,30,174,29,247,28,6,106,251,43,5,137,
+129,137,128,131,26,117,247,120,29,143,148,145,165,8,14,179,29,91,29,247,197,
+125,21,247,193,10,249,19,248,219,21,156,163,143,148,152,26,164,120,156,114,
+113,124,129,106,115,30,252,101,253,28,5,124,118,133,126,126,26,116,159,121,
+163,166,153,149,173,163,30,14,248,233,247,238,21,145,166,142,166,167,26,247,
+12,78,208,251,0,79,87,121,104,96,30,77,87,94,62,119,51,119,49,24,133,112,
+136,111,112,26,251,13,200,71,247,0,199,191,157,174,182,30,201,190,184,217,
+159,226,8,251,205,236,21,238,161,198,202,208,27,192,169,102,74,120,137,119,
+134,120,31,117,35,5,42,117,79,75,71,27,86,109,176,203,159,141,158,143,159,
+31,14,248,127,248,254,21,251,122,85,5,91,128,119,120,104,26,114,155,122,163,
+149,143,140,144,160,30,224,159,54,252,16,247,195,29,167,154,247,16,29,156,
+26,155,247,111,29,43,6,14,247,133,243,21,167,159,247,30,232,193,179,195,185,
+25,199,189,168,191,201,26,227,65,201,33,78,78,119,104,91,30,90,104,101,87,
+107,26,117,159,121,164,161,162,151,157,149,30,156,169,141,141,150,150,8,163,
+167,175,153,179,27,193,178,112,100,100,123,122,251,25,42,31,91,104,80,98,
+251,52,32,132,135,24,115,251,0,5,248,98,6,159,226,5,143,157,139,140,148,26,
+162,120,156,114,107,118,122,105,128,30,14,247,249,248,9,21,104,107,111,107,
+115,155,125,169,138,31,181,137,152,137,157,131,8,172,125,162,112,113,26,113,
+123,109,114,121,30,116,107,101,130,71,27,75,112,144,155,118,31,149,124,134,
+141,126,27,105,108,110,105,95,215,110,247,7,245,206,159,189,196,31,185,180,
+171,200,187,26,186,112,179,87,167,30,219,181,176,188,203,26,225,71,194,32,
+251,13,251,7,80,77,116,158,121,164,154,154,145,148,150,30,173,178,168,149,
+193,27,198,174,119,104,96,87,96,86,31,14,248,220,248,237,21,251,30,6,251,
+220,252,20,120,54,5,247,164,6,133,110,5,104,132,10,247,24,6,168,154,210,10,
+156,129,155,124,144,30,133,141,132,140,126,140,145,168,24,184,140,168,164,
+174,247,129,10,133,141,133,140,125,140,8,251,0,22,251,29,6,247,76,247,105,
+5,14,247,226,248,134,21,247,90,6,169,152,247,15,10,156,26,169,122,150,95,
+30,251,197,6,78,251,166,5,138,133,138,132,136,26,115,158,121,164,150,144,
+140,146,154,30,159,184,188,152,172,27,191,172,108,90,107,128,107,121,115,
+31,102,110,95,123,65,27,74,112,146,162,115,31,152,126,132,142,124,27,105,
+107,109,107,89,222,102,247,4,247,3,211,166,203,197,31,181,187,164,201,199,
+26,239,71,205,35,109,105,134,129,104,30,14,247,178,247,219,21,247,0,190,246,
+215,238,27,147,144,138,136,148,31,132,156,148,137,148,27,174,171,169,172,
+173,97,161,73,251,11,251,24,64,251,5,59,31,88,67,112,51,46,26,251,19,198,
+76,247,11,219,203,166,194,188,30,179,184,163,201,195,26,226,71,205,50,91,
+101,124,97,83,30,119,251,17,21,186,176,195,171,181,27,181,170,108,97,116,
+129,110,122,117,31,109,117,108,124,97,27,110,114,148,153,128,31,127,153,129,
+173,168,26,141,139,144,140,145,30,14,248,142,248,134,21,251,131,252,51,5,
+128,119,134,127,127,26,117,160,121,163,167,156,151,176,160,30,247,153,248,
+89,161,239,5,252,77,6,119,52,5,136,125,138,133,131,26,117,158,122,165,170,
+160,156,173,150,30,14,248,131,247,200,21,217,183,178,193,204,26,225,66,199,
+35,74,72,115,97,91,30,95,101,109,84,95,26,98,158,106,179,108,30,56,94,92,
+74,67,26,52,210,85,247,6,220,219,168,186,184,30,174,175,162,191,181,26,185,
+117,179,97,169,30,58,247,98,21,192,173,115,101,84,85,97,68,86,105,163,178,
+193,193,181,210,31,81,251,155,21,194,179,110,99,89,79,96,68,77,103,164,180,
+190,202,184,210,31,14,248,128,247,168,21,251,0,88,33,63,38,27,131,135,140,
+142,130,31,145,123,130,141,129,27,104,107,109,107,105,182,117,204,247,11,
+247,23,213,247,6,220,31,190,211,166,227,232,26,247,19,80,202,251,10,58,75,
+112,84,90,30,99,93,115,78,82,26,52,207,73,228,187,177,154,182,195,30,159,
+247,17,21,92,102,83,107,97,27,97,108,170,180,163,149,168,156,161,31,170,162,
+169,153,181,27,169,163,131,124,151,31,151,124,148,106,109,26,137,139,134,
+138,134,30,14,247,197,125,21,124,10,224,247,196,21,184,180,178,181,170,247,
+26,29,247,121,29,126,137,134,131,26,126,153,127,155,152,247,151,10,122,247,
+181,21,85,97,104,93,105,163,119,181,193,180,174,184,174,115,159,98,31,14,
+247,170,247,163,21,247,140,247,10,5,165,152,152,154,156,26,147,137,147,135,
+147,30,138,141,5,156,131,116,150,114,27,124,125,136,133,126,31,252,81,251,
+99,248,81,251,104,5,133,152,153,136,154,27,164,162,150,156,147,31,140,141,
+5,143,147,141,147,146,26,158,128,151,110,154,30,14,247,90,248,47,21,107,129,
+137,126,247,2,10,182,30,248,19,136,10,252,58,251,68,21,247,25,10,248,19,136,
+10,14,247,205,247,163,21,251,139,251,13,5,110,124,128,127,120,26,132,141,
+131,143,131,30,140,137,5,122,147,162,128,164,27,154,153,142,145,152,31,248,
+81,247,104,252,81,247,99,5,145,126,125,142,124,27,114,116,128,122,131,31,
+138,137,5,135,131,137,131,131,26,122,152,124,165,126,30,14,247,89,248,80,
+21,136,125,138,131,247,174,29,149,143,146,145,167,142,150,24,155,174,173,
+146,177,27,195,170,116,98,93,96,112,251,39,90,31,127,83,5,134,120,139,138,
+130,26,117,158,122,163,171,160,156,174,152,30,209,166,180,161,173,168,8,178,
+171,163,191,192,26,230,72,194,251,1,79,84,126,105,57,30,128,134,130,136,134,
+136,8,233,252,171,21,183,180,177,181,170,115,162,106,31,121,247,136,29,14,
+248,124,248,23,21,251,19,129,36,52,40,26,66,195,90,221,30,212,6,165,149,141,
+149,151,31,153,150,146,153,153,26,153,134,147,128,145,30,198,247,156,5,142,
+154,141,153,153,26,228,80,195,45,251,25,251,14,251,12,251,59,101,30,103,251,
+53,5,132,108,136,108,109,26,83,151,92,162,102,30,95,168,183,118,205,27,247,
+0,233,183,189,160,124,153,117,127,132,136,125,122,31,121,116,99,128,94,27,
+108,120,145,154,123,31,114,161,124,184,192,26,161,142,166,146,168,30,172,
+247,41,5,247,13,166,221,229,222,27,188,169,110,91,130,138,131,137,130,31,
+82,251,151,21,138,127,134,139,133,27,99,112,160,169,186,193,181,207,146,31,
+14,32,29,14,247,3,75,10,46,10,14,84,10,14,32,10,14,247,141,247,124,21,216,
+6,138,137,5,137,129,137,127,131,26,117,158,122,164,155,247,119,10,163,246,
+24,142,150,140,149,147,26,162,121,156,113,104,116,116,95,130,30,138,136,5,
+63,119,10,59,251,250,129,10,41,29,14,248,91,247,122,65,29,122,26,114,152,
+126,167,121,29,14,34,29,14,248,231,247,6,29,154,151,149,129,29,127,103,27,
+107,110,146,159,95,140,29,52,10,14,37,29,14,247,117,247,81,29,83,251,144,
+5,107,67,29,39,29,14,36,10,14,247,132,247,83,21,234,6,245,203,163,201,195,
+84,29,247,164,133,21,217,140,178,147,187,163,8,247,24,207,223,247,18,247,
+22,26,247,23,43,235,251,22,251,74,251,66,251,69,251,77,78,159,83,174,102,
+30,151,125,159,124,174,117,69,85,24,116,121,131,126,118,26,117,158,120,161,
+147,150,141,142,151,30,149,185,202,149,162,27,159,150,136,126,172,31,131,
+158,153,136,159,27,177,186,155,165,180,31,158,151,150,158,158,26,164,121,
+156,112,126,134,137,124,111,30,128,118,130,136,125,27,127,133,140,145,118,
+31,148,108,115,142,111,27,124,128,138,137,120,31,247,30,248,130,21,218,197,
+78,54,251,12,251,3,251,12,251,3,58,81,199,225,247,14,247,2,247,10,247,6,31,
+14,36,29,14,40,29,14,47,10,14,33,29,14,247,227,247,43,21,70,247,202,5,153,
+6,171,150,141,151,154,31,154,152,148,156,156,26,169,122,151,96,30,251,25,
+175,29,121,123,26,109,156,127,181,30,239,252,97,5,243,6,247,199,248,97,5,
+164,149,140,145,150,31,160,150,154,161,160,26,169,122,151,95,30,251,23,175,
+29,121,123,26,121,149,124,154,133,30,136,148,145,139,159,27,156,6,14,247,
+249,166,29,170,26,156,111,29,128,155,125,235,10,121,26,117,247,98,10,14,248,
+68,235,29,130,133,62,29,248,42,247,127,193,29,119,27,46,247,202,10,247,124,
+97,29,248,101,248,139,21,194,247,27,29,157,156,26,156,247,112,29,251,54,6,
+251,58,253,127,5,247,56,6,169,151,247,54,10,157,155,26,157,128,155,125,143,
+30,142,130,247,162,29,85,6,14,247,218,249,7,21,172,130,128,150,114,27,104,
+108,110,108,132,140,134,143,125,31,247,68,253,28,5,105,148,150,128,166,27,
+172,171,168,170,146,137,148,136,150,31,14,247,129,101,21,84,6,109,126,136,
+127,125,247,130,10,122,149,124,154,134,30,136,148,145,138,159,27,247,54,6,
+247,58,249,127,5,251,56,6,109,127,247,27,10,121,149,124,154,134,30,136,148,
+146,138,159,27,193,6,14,247,191,248,98,21,247,5,251,17,5,114,162,149,133,
+161,27,171,165,164,169,156,134,148,120,161,31,251,94,247,118,251,92,251,118,
+5,120,117,134,129,124,26,108,165,114,171,161,149,145,165,162,30,14,167,106,
+21,113,130,247,197,10,153,141,145,148,247,191,29,248,152,247,38,10,162,160,
+159,161,137,31,140,139,142,138,143,30,14,33,10,14,247,204,248,239,21,251,
+13,6,108,128,247,27,10,122,149,123,154,247,144,29,50,252,33,5,127,6,107,128,
+137,127,247,69,10,247,12,6,145,170,5,107,181,177,127,196,27,228,212,168,198,
+200,31,191,189,170,209,204,26,194,115,190,99,171,30,165,106,89,153,78,27,
+83,89,125,110,91,31,247,23,79,21,215,183,103,77,110,126,108,116,112,31,99,
+104,93,119,83,27,62,95,175,201,168,152,171,162,165,31,179,174,184,159,197,
+27,14,41,10,14,69,29,14,34,10,14,248,9,247,214,21,247,40,232,10,133,140,118,
+27,251,37,6,145,169,82,29,251,26,6,14,47,29,14,247,225,94,10,187,27,182,168,
+29,169,152,247,16,29,156,26,156,176,29,14,48,10,236,221,29,14,248,91,98,29,
+59,10,14,42,29,14,247,131,248,61,21,41,6,107,129,211,10,123,26,122,247,90,
+29,144,137,145,138,152,138,91,251,111,24,97,108,113,105,108,157,127,182,31,
+227,247,185,29,145,30,141,134,132,140,126,27,181,247,82,5,170,174,160,149,
+166,27,155,147,133,129,135,138,133,137,133,31,247,190,29,157,129,154,124,
+145,30,141,134,132,140,127,27,181,247,82,5,173,180,154,146,165,27,155,146,
+134,129,140,31,133,139,134,137,133,30,247,190,29,156,129,155,124,145,30,141,
+134,132,140,126,27,185,247,97,5,141,149,140,146,152,26,197,94,180,73,99,103,
+125,108,102,30,170,116,109,153,101,27,108,120,132,116,101,31,14,35,29,14,
+38,29,14,247,82,62,10,248,41,46,21,84,6,108,127,136,127,125,247,130,10,123,
+247,4,10,247,66,243,10,142,130,133,140,118,27,128,6,232,248,51,5,151,6,171,
+149,247,165,29,247,52,10,133,140,119,27,251,12,6,131,100,5,176,100,100,153,
+78,27,251,56,251,30,251,14,251,36,44,224,72,247,13,196,189,154,173,194,31,
+57,247,168,21,214,185,105,83,101,112,97,99,114,31,121,109,105,130,96,27,99,
+107,148,157,119,31,122,154,127,165,160,26,178,166,181,180,164,30,158,169,
+172,147,182,27,14,43,29,14,35,10,14,70,29,14,38,10,14,247,221,247,21,21,80,
+247,85,5,164,148,140,145,150,31,161,151,153,160,160,26,156,129,247,109,29,
+130,140,121,27,251,24,233,10,146,139,159,27,149,6,235,251,214,5,247,0,6,247,
+131,247,214,5,153,6,170,150,247,165,29,129,155,124,144,30,142,131,130,140,
+120,27,251,26,233,10,145,139,160,27,141,6,14,40,10,14,248,64,247,37,10,156,
+156,26,156,129,155,124,59,29,44,10,14,199,29,156,156,146,153,152,30,150,150,
+142,146,146,167,140,144,24,181,10,14,248,91,248,102,21,164,146,147,146,164,
+27,175,141,168,167,171,26,165,121,155,108,66,65,81,69,124,30,104,251,48,133,
+114,132,133,115,137,25,100,135,114,114,104,26,114,153,126,168,136,30,156,
+137,145,136,129,26,136,138,133,137,132,30,103,251,57,5,137,130,138,131,130,
+26,80,185,94,201,180,170,166,175,163,122,155,112,140,30,118,140,134,142,152,
+26,142,140,145,140,144,30,172,247,41,5,144,161,142,158,150,26,152,135,152,
+128,155,30,166,163,149,157,149,181,8,14,247,250,249,205,21,251,8,254,199,
+247,8,6,14,247,137,130,21,113,133,130,132,114,27,103,137,110,111,107,26,113,
+157,123,170,212,213,197,209,154,30,174,247,49,144,163,147,145,163,142,25,
+178,143,164,164,173,26,164,125,152,110,142,30,122,141,133,143,148,26,142,
+140,146,141,145,30,175,247,58,5,141,147,140,147,148,26,199,93,183,77,99,107,
+112,104,115,156,123,166,137,30,160,138,144,136,126,26,136,138,134,138,134,
+30,106,251,42,5,134,117,136,120,128,26,126,143,127,150,122,30,112,116,129,
+120,129,97,8,14,248,124,248,11,21,117,126,131,111,117,31,110,117,127,128,
+247,84,29,201,68,112,153,94,27,95,105,121,95,99,31,109,106,128,120,220,10,
+86,200,178,119,181,27,181,171,157,182,177,31,174,179,147,152,160,26,170,113,
+164,107,30,14,247,86,36,21,129,110,137,129,126,26,103,168,113,180,167,168,
+152,160,159,30,157,159,145,154,144,182,173,247,175,24,140,142,139,142,141,
+26,166,123,155,111,109,115,120,109,129,30,236,247,127,21,94,98,100,98,107,
+163,117,172,31,157,6,183,181,177,180,171,115,162,105,31,14,248,11,234,21,
+241,156,207,180,185,26,163,120,158,114,125,129,136,130,124,30,115,100,104,
+129,102,27,79,98,173,188,209,213,198,225,183,157,128,113,140,31,140,111,139,
+136,146,131,8,131,146,154,133,152,27,156,157,147,152,152,31,149,148,143,149,
+145,165,148,179,24,142,155,140,144,146,26,162,120,156,113,133,134,138,136,
+130,30,122,150,119,146,112,143,152,199,247,117,29,103,116,117,94,129,30,123,
+68,5,251,15,111,45,34,251,3,26,60,186,81,220,118,30,123,66,5,134,120,139,
+138,130,231,10,149,144,148,144,165,8,14,248,2,247,124,21,169,151,228,29,74,
+6,136,186,139,139,153,26,186,173,172,190,164,156,132,123,151,30,113,158,143,
+136,160,27,172,171,170,170,188,71,183,65,251,14,44,48,251,10,127,140,132,
+141,123,31,100,6,107,128,211,10,123,26,121,149,124,154,134,30,136,148,148,
+138,157,27,203,6,124,61,106,92,98,136,8,96,131,117,118,107,26,108,157,127,
+182,30,247,213,6,185,168,149,163,164,31,158,157,153,170,164,26,163,120,155,
+113,110,117,124,110,128,30,251,85,6,165,181,151,170,150,194,8,14,141,10,248,
+12,247,235,21,79,247,10,5,167,147,159,163,165,26,156,129,155,124,144,30,143,
+130,135,139,116,27,47,110,29,118,151,124,160,135,30,137,145,142,139,155,27,
+230,251,74,5,74,247,138,29,231,6,134,114,5,45,6,114,122,125,117,121,147,132,
+161,31,231,6,133,113,5,96,114,29,247,85,190,10,156,26,156,129,154,124,144,
+30,143,129,135,139,117,27,98,6,144,165,5,233,6,164,156,154,161,155,130,147,
+118,31,47,6,144,164,5,233,6,164,156,154,160,157,130,146,118,31,76,6,247,66,
+247,74,5,167,151,142,151,153,247,57,29,156,129,155,124,144,30,143,129,135,
+139,117,27,48,6,107,129,136,127,123,31,124,127,130,121,123,26,120,149,125,
+157,133,30,14,248,81,248,29,21,149,184,5,180,148,178,173,178,27,156,154,136,
+134,153,31,134,150,144,138,147,27,172,170,170,173,171,97,159,71,39,42,62,
+42,118,31,128,90,5,85,6,106,130,247,43,10,192,6,89,251,114,5,90,128,102,106,
+94,27,122,127,141,145,123,31,143,126,136,140,133,27,106,107,109,107,106,182,
+118,207,242,235,218,243,162,31,189,247,116,5,193,6,170,151,247,55,29,157,
+156,26,156,128,154,125,144,30,143,129,135,139,116,27,14,248,167,248,106,21,
+132,109,5,138,132,137,127,134,26,120,156,124,161,172,157,157,177,148,30,167,
+247,18,5,251,122,6,77,92,119,96,97,31,111,109,118,97,110,26,129,7,62,119,
+87,84,76,26,95,169,103,216,91,30,232,82,5,192,106,169,109,119,26,112,102,
+112,101,30,251,32,6,146,171,5,143,155,139,140,145,26,158,122,154,116,107,
+119,121,102,131,30,111,251,18,5,247,128,6,237,133,237,226,135,230,8,216,156,
+192,196,206,26,188,114,168,46,195,30,58,188,5,84,172,109,169,159,26,166,177,
+165,179,30,162,251,158,21,186,110,167,109,118,26,117,118,129,97,30,127,152,
+121,152,96,168,49,195,24,92,169,119,160,161,26,161,162,152,178,30,171,111,
+146,133,168,121,8,14,247,100,248,10,21,107,98,122,94,99,26,127,142,123,145,
+111,30,102,109,5,108,114,131,127,118,26,114,158,121,165,158,147,143,161,167,
+30,177,168,5,122,171,162,133,174,27,174,165,145,156,178,31,164,111,5,117,
+157,146,134,157,27,173,174,170,169,152,135,147,124,157,31,116,169,5,172,181,
+156,183,180,26,150,136,155,133,166,30,174,168,5,170,163,147,151,160,26,164,
+120,157,113,120,131,135,118,111,30,104,112,5,158,106,117,145,101,27,104,114,
+133,120,99,31,115,167,5,161,121,131,143,121,27,107,104,109,110,130,149,116,
+146,130,31,247,91,107,21,181,169,111,100,84,84,86,82,96,109,167,180,194,193,
+190,198,31,14,247,252,203,29,14,248,202,247,38,10,163,159,159,162,137,31,
+141,139,141,138,142,30,251,120,247,96,247,148,29,147,132,154,27,165,158,162,
+166,136,31,14,247,158,10,156,152,146,149,29,247,3,247,23,21,247,69,247,23,
+5,157,152,145,149,29,14,247,158,10,157,153,145,147,152,156,29,14,248,106,
+247,104,171,29,124,137,247,50,10,247,162,247,214,21,169,6,169,151,247,54,
+10,157,155,247,179,29,147,172,5,161,144,177,10,104,247,42,29,127,182,30,172,
+247,88,10,100,72,10,247,67,136,29,112,6,248,29,247,214,21,251,16,6,106,130,
+137,126,157,29,135,148,145,139,159,27,154,247,88,10,104,72,10,247,67,6,167,
+153,247,15,10,156,26,156,129,154,125,247,16,10,108,6,233,248,136,21,251,18,
+6,115,251,0,5,247,18,6,14,247,158,247,213,21,169,6,170,150,142,151,154,31,
+155,152,247,182,29,111,6,146,171,5,165,145,157,155,162,27,149,147,137,133,
+160,31,135,151,147,137,147,27,157,154,147,155,153,31,133,147,149,135,153,
+27,169,6,51,252,32,5,104,6,106,129,137,126,247,172,10,247,68,136,29,107,6,
+247,3,248,135,5,251,27,6,114,123,132,121,124,31,155,113,104,148,101,27,60,
+64,76,58,121,31,132,106,5,105,247,42,29,126,182,30,171,6,91,251,110,5,99,
+110,29,109,157,127,181,30,247,68,6,168,153,247,21,29,131,130,140,120,27,112,
+6,14,91,29,248,61,247,214,21,224,6,171,150,247,165,29,129,155,124,247,16,
+10,55,6,163,247,0,5,142,156,140,143,146,26,162,120,156,114,122,122,131,126,
+125,30,129,130,134,128,134,114,114,251,2,24,53,222,10,157,27,224,6,63,251,
+233,5,135,120,139,137,131,247,175,10,144,150,144,164,8,14,248,60,247,214,
+21,225,6,170,151,247,165,29,128,247,109,29,132,140,118,27,55,6,163,247,0,
+247,41,29,129,30,115,251,2,5,52,222,10,158,27,224,6,129,95,5,52,6,109,128,
+136,127,247,181,10,145,138,159,27,224,6,96,251,86,5,137,129,137,127,132,26,
+117,247,66,10,165,183,247,88,24,225,6,170,150,142,151,154,247,64,10,130,130,
+140,121,27,55,6,14,130,10,248,214,248,118,21,171,247,60,10,124,149,104,30,
+251,89,6,251,35,140,251,28,61,120,45,130,96,24,137,130,138,131,129,26,64,
+213,80,247,3,127,30,81,251,153,5,64,6,117,132,138,134,130,31,122,130,127,
+121,124,26,115,153,129,175,30,247,29,6,162,151,146,158,152,31,122,143,151,
+130,158,27,232,247,60,10,125,149,104,30,107,6,181,248,202,21,251,18,252,203,
+129,134,134,134,132,131,25,136,148,137,142,130,144,247,18,248,204,24,14,247,
+188,248,89,21,56,73,73,55,56,205,72,221,220,205,206,222,221,73,207,59,31,
+14,179,29,247,76,247,28,167,29,128,136,131,131,247,34,29,14,247,176,248,219,
+167,29,129,136,129,132,26,126,153,128,155,153,247,149,29,14,248,106,247,104,
+21,251,70,251,23,5,123,197,10,124,137,140,128,27,117,117,121,120,132,144,
+130,146,131,31,251,4,251,23,171,29,125,136,247,50,10,244,125,21,124,10,247,
+109,22,124,10,247,109,22,247,193,10,248,185,248,0,21,164,147,150,150,156,
+26,154,130,149,126,133,137,139,135,126,30,252,25,251,5,5,113,132,128,127,
+121,26,125,148,128,152,145,141,139,144,152,30,228,247,238,21,65,69,168,10,
+168,251,209,155,29,247,175,195,155,29,14,248,100,251,51,21,156,216,5,142,
+153,140,146,147,26,161,247,160,29,129,136,132,132,111,137,128,24,124,104,
+103,131,103,27,82,108,162,179,185,177,164,247,36,189,31,147,141,151,195,5,
+144,158,139,140,212,10,108,117,121,105,127,30,70,113,98,116,104,110,8,100,
+106,115,88,85,26,50,206,83,247,1,204,186,151,181,240,30,54,248,175,21,95,
+98,101,97,108,163,116,172,31,157,6,183,181,178,180,171,115,161,105,31,14,
+247,233,249,36,21,152,126,132,142,128,247,34,10,150,149,247,84,10,134,149,
+127,150,31,14,248,223,248,232,44,29,248,66,248,214,72,29,248,228,249,14,21,
+126,247,18,29,169,95,122,146,146,29,173,169,156,182,181,31,160,160,148,154,
+152,26,153,124,151,123,30,14,196,29,247,198,249,44,68,29,248,76,249,12,106,
+29,247,227,249,12,102,10,248,90,249,82,150,10,247,151,147,21,115,33,126,10,
+148,180,5,14,248,62,248,230,64,29,247,220,147,21,105,121,129,132,122,124,
+8,108,110,121,104,103,105,10,149,148,154,154,156,31,158,160,159,152,211,180,
+8,14,248,62,248,204,56,29,130,29,53,29,14,248,45,247,163,21,230,6,177,164,
+158,169,163,126,149,104,31,138,6,165,247,9,5,141,148,140,147,146,26,190,93,
+169,62,98,74,128,128,114,30,122,131,128,123,121,26,119,153,125,159,146,150,
+141,142,152,30,147,174,160,142,164,27,173,154,134,127,138,31,138,139,137,
+138,138,30,138,134,5,143,113,127,140,120,27,61,80,117,94,100,31,120,118,129,
+116,119,26,91,187,105,205,176,169,144,154,178,30,160,231,21,121,107,97,128,
+107,27,120,124,145,147,159,182,160,181,157,152,138,134,168,31,14,247,254,
+248,97,21,192,6,170,151,142,151,154,245,10,251,105,113,29,191,6,105,251,43,
+251,7,82,5,99,120,126,123,110,26,117,159,120,161,152,149,142,151,163,30,192,
+166,119,52,5,86,72,10,248,110,6,181,247,77,5,142,156,140,143,147,26,162,121,
+156,113,103,117,117,94,129,30,120,55,5,251,98,6,168,247,23,247,44,215,5,179,
+159,152,154,168,26,160,120,158,117,127,124,134,130,119,30,48,93,5,14,70,10,
+14,248,57,247,124,21,149,6,138,125,5,116,247,101,29,149,145,164,155,213,247,
+117,29,107,118,121,104,127,30,129,247,58,29,247,11,6,126,82,5,137,128,137,
+128,132,26,117,247,48,29,175,247,54,24,251,231,6,251,84,251,53,251,52,251,
+82,251,22,230,55,247,30,31,247,248,6,166,247,11,5,142,153,140,146,147,26,
+162,121,155,114,103,116,117,95,130,30,135,121,5,251,31,6,251,0,22,106,123,
+142,147,118,31,94,157,111,187,199,26,201,174,209,193,182,30,178,171,177,152,
+196,140,8,14,248,65,248,212,21,251,1,34,46,42,67,199,86,221,247,5,239,226,
+237,214,80,194,57,31,121,57,21,180,168,112,102,94,88,97,84,101,106,165,170,
+187,192,185,193,31,14,51,29,14,48,10,14,248,124,248,239,21,251,72,6,106,129,
+227,29,210,6,105,251,42,48,95,5,99,120,125,122,111,26,116,158,120,162,151,
+152,143,149,160,30,169,154,111,251,17,5,251,10,113,10,247,235,136,29,251,
+9,6,177,247,60,233,185,5,178,157,153,157,167,26,162,120,158,116,124,132,137,
+126,114,30,108,123,5,14,76,10,14,249,32,247,55,21,149,185,5,144,163,142,164,
+162,26,230,81,204,59,86,88,114,91,94,30,186,113,99,165,90,27,75,76,104,78,
+92,31,95,81,113,69,75,26,43,198,71,225,188,191,163,182,183,30,95,163,180,
+116,195,27,187,213,156,158,177,31,163,151,152,160,163,26,163,120,157,116,
+130,129,137,136,131,30,115,77,127,136,111,27,100,119,163,190,138,31,251,46,
+247,61,21,173,160,108,88,59,83,57,84,103,119,168,194,218,196,220,194,31,247,
+69,60,21,195,165,164,162,173,27,170,154,113,86,31,14,247,48,247,190,21,96,
+251,87,5,126,6,107,128,137,126,125,247,36,29,138,157,27,247,13,137,237,248,
+81,5,176,147,167,158,186,27,177,161,122,110,124,132,125,126,128,31,124,125,
+127,135,106,136,8,98,135,112,114,106,26,114,154,127,174,135,30,219,131,180,
+104,79,26,89,108,91,106,126,132,147,154,30,152,7,158,122,153,114,99,110,104,
+92,84,178,104,201,198,186,161,184,177,30,177,183,161,197,193,26,200,112,189,
+88,173,30,177,175,156,175,185,26,218,79,191,49,36,52,80,57,121,30,126,79,
+5,125,247,29,10,183,30,14,248,105,248,252,21,251,31,106,5,109,132,126,127,
+117,26,124,149,128,153,146,141,139,143,152,30,189,151,89,251,121,5,82,6,107,
+119,124,115,121,151,131,164,31,247,74,6,170,159,155,162,158,129,146,112,31,
+82,6,14,248,118,248,25,21,251,85,7,119,148,128,156,156,148,150,159,30,247,
+136,252,70,7,117,128,130,123,122,150,130,161,31,14,247,95,130,21,134,160,
+149,138,158,27,189,188,149,161,189,31,122,242,7,161,154,141,145,148,31,157,
+149,149,157,158,26,172,117,159,100,141,30,247,210,251,35,7,113,129,137,133,
+129,31,122,129,128,121,120,26,122,148,122,154,129,30,131,150,152,136,165,
+27,166,251,67,6,104,78,99,126,97,27,98,124,152,175,31,247,176,251,16,7,123,
+6,107,113,115,108,122,148,122,154,129,31,131,150,152,136,165,27,147,252,28,
+6,247,107,29,158,156,147,154,150,31,148,150,141,149,165,26,14,247,164,248,
+129,21,176,6,128,91,5,136,128,139,136,135,26,125,151,128,154,160,152,152,
+167,145,30,165,247,7,5,251,158,6,114,251,5,5,136,126,139,138,135,26,125,150,
+128,154,160,152,153,166,145,30,150,189,5,176,6,92,251,104,5,115,6,109,121,
+125,114,121,150,131,163,31,247,2,6,168,158,154,163,157,129,147,114,31,117,
+6,247,135,247,37,21,170,251,23,5,154,6,223,247,20,107,251,34,5,134,6,111,
+121,123,116,121,150,131,163,31,198,6,168,158,154,163,155,131,147,120,141,
+31,186,247,104,5,162,143,153,154,159,26,158,129,146,114,30,72,6,62,251,19,
+116,247,19,5,72,6,109,121,125,115,123,146,131,154,137,31,92,251,105,5,113,
+137,124,124,118,26,120,150,131,162,30,199,6,168,158,154,163,157,128,147,117,
+31,135,6,14,60,29,247,183,249,16,88,10,247,226,247,78,21,146,150,145,152,
+147,26,154,128,150,124,124,128,132,121,126,30,251,212,252,71,5,130,126,134,
+129,131,26,123,247,129,29,151,30,247,102,104,21,247,64,247,25,161,164,201,
+26,193,96,177,78,94,95,120,106,109,30,121,120,127,117,126,26,124,150,128,
+154,152,152,147,150,145,30,149,158,140,139,145,145,8,154,155,159,147,160,
+27,171,160,122,115,110,119,121,251,90,251,41,31,127,130,126,73,5,247,149,
+6,150,194,5,140,144,140,147,143,26,152,128,150,125,121,127,129,118,132,30,
+14,248,60,247,207,21,247,30,136,10,251,28,6,165,247,9,5,142,155,140,144,247,
+97,10,113,251,11,5,251,31,174,29,247,29,6,118,49,247,19,29,149,149,143,148,
+145,165,8,251,165,251,12,21,247,25,10,248,19,136,10,14,247,119,247,26,21,
+234,6,243,196,155,182,189,31,176,170,161,185,180,26,176,118,174,106,159,30,
+159,106,96,147,64,27,46,6,145,169,5,235,173,10,251,105,6,110,125,135,128,
+125,247,130,29,122,247,90,29,135,148,143,139,161,27,247,108,10,128,132,10,
+247,105,6,168,154,143,150,152,247,56,29,155,247,3,10,46,6,169,247,26,21,159,
+230,5,247,19,6,198,162,129,113,102,105,121,69,31,14,248,250,247,233,200,10,
+219,6,170,159,154,163,155,128,148,118,140,31,142,154,5,166,141,157,154,161,
+26,155,128,148,118,140,30,72,22,60,6,244,247,16,5,251,129,248,29,88,10,247,
+239,247,78,223,29,125,135,130,131,26,123,247,129,29,152,30,14,133,10,251,
+120,251,53,21,87,97,103,94,105,163,119,180,194,180,174,185,174,115,158,96,
+31,218,247,247,21,87,97,103,95,104,163,119,180,194,180,174,184,175,116,158,
+95,31,14,247,250,248,168,21,159,138,145,136,149,30,158,131,116,154,116,194,
+29,173,163,163,175,31,149,7,251,116,4,163,137,149,133,149,30,155,128,120,
+149,119,194,29,158,156,147,154,150,31,147,149,142,150,165,26,14,248,63,248,
+213,21,251,6,32,39,32,59,199,81,223,247,7,246,239,247,0,219,79,196,54,31,
+126,73,21,190,176,105,90,73,72,75,70,85,103,173,189,205,206,202,210,31,14,
+247,82,199,21,103,179,183,124,247,103,29,59,208,251,16,79,94,125,103,84,31,
+188,247,108,5,251,13,6,108,127,136,127,124,31,124,127,130,122,122,26,122,
+149,123,153,134,30,136,148,148,138,157,27,150,6,251,24,252,229,93,10,247,
+107,248,121,86,29,248,13,251,36,200,10,218,6,170,159,154,163,155,129,148,
+118,140,31,142,154,5,166,141,156,154,161,26,156,128,147,119,140,30,72,22,
+60,6,243,247,16,5,187,247,158,223,29,126,135,247,71,10,14,247,213,247,195,
+21,247,85,247,25,163,164,201,26,194,95,176,75,92,94,120,106,106,30,121,120,
+126,117,125,26,125,150,128,155,153,153,147,150,146,30,150,158,139,139,146,
+145,8,154,155,161,147,162,27,171,162,122,116,109,120,123,251,114,251,43,31,
+127,130,124,73,5,247,172,6,151,194,5,140,144,140,147,143,26,152,127,150,125,
+119,126,129,118,132,30,14,247,216,247,126,21,150,6,159,131,166,85,141,102,
+140,131,24,140,132,5,183,6,172,162,157,166,158,130,147,118,143,31,126,171,
+134,149,123,157,8,187,161,169,179,181,26,191,97,172,70,30,46,6,105,116,121,
+112,119,150,130,163,137,31,101,251,65,5,107,138,118,120,114,26,118,153,129,
+167,30,208,6,172,162,157,166,159,128,148,116,141,31,164,247,5,21,152,199,
+5,161,6,167,155,131,125,119,111,121,109,31,205,247,162,21,251,90,251,78,251,
+65,251,76,247,107,10,247,76,247,30,164,29,133,10,14,248,179,248,192,21,160,
+149,151,153,155,26,155,127,151,122,129,125,136,133,126,30,55,101,97,159,117,
+149,137,140,25,147,116,124,142,125,27,113,113,117,116,127,147,130,154,134,
+31,154,133,145,137,144,136,144,137,25,141,138,143,137,144,137,91,115,24,112,
+126,133,132,119,26,120,150,127,155,149,142,140,149,162,30,240,186,173,118,
+178,99,163,102,25,168,91,114,146,94,27,54,56,104,78,80,31,91,88,110,76,83,
+26,34,230,64,247,19,225,231,176,198,200,30,192,191,171,222,225,26,233,102,
+211,54,207,30,251,16,251,94,21,212,191,96,79,109,126,109,118,117,31,101,100,
+85,116,87,27,65,83,181,193,216,229,212,233,31,14,247,235,247,90,21,218,44,
+5,117,157,147,134,157,27,172,173,169,169,152,135,147,124,157,31,60,235,247,
+14,234,5,169,163,148,152,160,26,163,120,157,113,121,129,134,118,113,30,251,
+14,43,60,234,5,160,122,129,145,122,27,106,105,109,109,125,143,132,154,121,
+31,218,44,251,14,43,5,108,115,131,127,118,26,114,157,121,166,156,149,144,
+160,167,30,14,248,25,248,103,21,117,119,121,119,123,148,131,158,138,31,163,
+138,148,137,149,135,8,158,130,153,121,123,26,101,102,118,72,100,123,142,148,
+126,30,146,130,136,140,131,27,117,120,120,118,112,185,121,210,200,181,152,
+168,173,31,167,163,158,175,168,26,169,123,164,109,156,30,187,165,161,170,
+178,26,192,99,172,74,65,69,103,100,125,151,128,154,148,148,143,145,147,30,
+159,162,156,145,172,27,173,160,126,119,113,108,114,108,31,14,247,80,247,153,
+21,137,129,138,131,127,26,68,196,92,224,219,217,179,181,157,125,152,120,129,
+129,135,132,129,30,117,111,127,135,101,27,90,113,158,175,136,31,145,139,144,
+140,145,30,147,172,5,187,149,182,174,188,27,168,166,126,126,108,147,128,163,
+164,156,155,169,145,31,151,189,5,142,153,139,139,144,26,156,126,151,122,124,
+129,134,127,130,30,151,114,119,144,110,27,48,56,72,49,119,31,247,124,247,
+175,21,251,91,251,77,251,64,251,77,247,107,10,247,77,247,29,164,29,32,29,
+247,77,247,201,21,163,156,148,151,155,26,158,125,152,119,127,133,137,125,
+119,30,251,50,33,5,117,124,129,125,123,26,120,153,126,159,150,145,142,152,
+159,30,14,32,29,191,247,183,21,229,49,5,130,148,247,10,10,225,29,32,29,97,
+247,238,102,10,32,29,136,248,6,21,152,125,199,10,162,150,247,161,29,32,29,
+217,248,52,21,60,63,70,67,83,182,98,198,219,215,207,211,197,96,179,79,31,
+128,80,21,170,160,119,110,104,98,103,100,107,117,159,166,177,179,174,181,
+31,14,32,29,247,108,247,239,21,127,120,129,125,126,31,106,108,134,136,125,
+27,129,127,145,157,111,31,168,247,133,29,107,105,123,108,106,31,113,114,128,
+121,124,26,124,152,128,155,149,150,143,147,147,30,179,179,147,144,157,27,
+152,145,136,123,162,31,111,178,169,126,162,27,173,170,156,181,180,216,29,
+247,229,126,21,218,143,195,154,187,168,8,187,167,163,167,165,143,29,204,196,
+108,105,137,31,138,120,5,115,138,157,122,165,27,175,161,161,183,149,31,157,
+219,5,78,29,125,75,5,135,122,137,122,122,26,60,181,74,209,106,30,162,129,
+156,134,171,132,119,49,24,141,162,141,139,146,27,163,153,131,125,247,123,
+10,122,136,140,131,27,114,116,117,116,108,192,113,200,211,198,193,204,178,
+123,158,98,148,31,14,32,10,247,255,249,9,21,161,155,149,152,155,26,158,125,
+152,119,127,133,247,61,29,121,153,125,159,150,145,142,152,159,30,14,42,10,
+247,122,248,247,247,76,10,162,148,136,144,130,147,31,132,146,203,10,42,10,
+247,28,249,46,21,247,17,10,179,177,174,177,168,117,159,109,31,247,100,22,
+247,17,10,179,247,87,10,14,42,10,247,60,249,70,247,116,29,130,144,130,151,
+128,31,247,2,33,5,126,153,146,135,149,27,165,163,161,163,148,133,150,128,
+150,31,14,34,29,247,86,54,29,34,29,222,248,247,21,228,49,5,130,149,247,10,
+10,251,75,251,17,5,111,120,134,132,122,26,121,152,126,157,150,148,142,149,
+153,30,14,34,29,128,249,46,102,10,34,29,160,249,70,180,29,133,150,128,150,
+31,14,248,16,249,76,21,153,146,136,123,162,31,112,176,171,125,162,27,173,
+169,156,181,181,247,154,29,122,126,123,129,120,120,30,111,112,135,136,125,
+27,128,128,145,157,111,31,168,94,123,146,115,27,108,106,124,109,107,31,111,
+114,127,120,122,26,125,152,128,155,150,149,144,148,149,30,176,176,148,145,
+156,27,251,14,251,221,76,29,14,36,10,247,76,247,149,21,163,156,148,151,156,
+26,157,125,152,119,127,133,137,125,119,30,251,49,33,5,116,124,129,125,123,
+26,120,153,126,159,150,146,142,152,158,30,14,36,10,194,247,131,49,29,36,10,
+99,247,186,21,99,211,29,177,168,117,159,108,31,247,101,22,247,17,10,179,177,
+174,177,168,117,159,109,31,14,36,10,135,247,210,180,29,134,150,127,150,31,
+14,36,10,247,117,247,187,21,125,123,129,120,120,31,111,112,135,136,125,27,
+129,127,144,158,111,31,168,247,133,29,108,107,124,110,107,31,111,114,126,
+119,123,26,124,152,128,155,149,150,144,146,147,30,178,178,148,145,156,27,
+153,145,136,123,162,31,112,178,169,125,162,27,173,170,156,181,180,216,29,
+248,105,249,85,21,48,229,5,148,130,131,143,247,91,29,144,134,247,19,251,17,
+247,73,247,17,5,169,159,143,144,157,26,157,126,152,121,128,129,135,130,126,
+30,173,251,177,21,144,158,139,140,148,26,162,121,155,113,119,247,187,10,99,
+162,99,174,118,31,167,121,168,130,205,128,205,127,152,234,10,166,139,139,
+133,146,179,10,115,184,187,127,182,10,109,147,84,102,29,149,149,144,148,145,
+165,8,14,33,29,151,248,169,21,165,156,147,150,156,26,158,125,152,119,127,
+132,247,20,29,158,150,146,142,152,159,30,14,33,29,251,9,248,151,247,76,10,
+161,149,137,144,130,147,31,135,142,136,142,138,140,251,18,247,17,24,225,29,
+33,29,251,103,248,206,176,10,167,117,160,108,31,14,33,29,251,68,248,230,21,
+152,126,199,10,163,149,134,147,127,152,31,14,248,228,249,112,21,164,156,148,
+151,155,26,158,125,152,119,126,133,247,20,29,159,149,146,142,152,159,30,110,
+252,27,193,29,119,27,46,247,202,10,248,2,249,149,21,99,208,29,108,31,247,
+100,22,99,208,29,108,31,251,60,252,170,193,29,119,27,46,247,202,10,247,124,
+247,40,29,134,120,139,138,131,26,117,158,121,164,175,162,160,184,149,30,153,
+203,5,247,74,10,176,247,59,5,144,158,139,140,247,98,29,124,73,5,150,248,238,
+21,48,229,5,149,129,132,142,247,91,29,141,137,140,137,141,138,247,19,251,
+17,24,247,73,247,17,5,167,157,145,147,156,26,157,125,152,121,129,129,135,
+130,126,30,14,248,20,22,247,14,6,168,152,143,150,154,31,154,247,23,29,128,
+6,181,247,80,5,141,151,140,147,153,26,208,73,182,33,83,43,123,123,103,30,
+117,130,126,119,116,26,115,156,122,164,247,149,10,172,27,195,159,130,115,
+142,31,130,7,135,121,5,145,101,110,142,107,27,36,52,105,78,86,247,23,10,166,
+247,8,21,108,78,81,123,84,27,104,111,152,155,149,146,149,154,247,63,10,247,
+23,248,55,21,163,155,148,151,155,26,158,247,125,29,121,30,251,50,33,5,116,
+123,129,126,247,134,29,155,30,14,33,10,134,248,37,21,229,247,48,10,131,147,
+31,136,142,138,140,135,142,251,18,220,29,14,248,19,164,10,247,124,10,119,
+27,127,6,181,247,80,5,142,151,140,149,151,26,208,73,182,33,83,48,124,123,
+100,30,115,130,125,119,116,26,114,156,122,164,247,33,10,134,139,138,111,10,
+166,247,8,124,29,39,248,91,21,99,211,29,176,169,117,159,108,31,247,101,247,
+167,29,176,169,117,159,109,31,14,33,10,69,248,115,154,29,33,10,159,248,161,
+21,60,63,70,67,83,182,98,199,219,215,208,210,196,96,180,78,31,129,80,21,170,
+160,119,111,104,98,103,100,107,117,158,167,176,179,174,181,31,14,248,19,22,
+247,14,239,10,131,132,139,118,27,128,6,181,247,80,5,141,151,141,151,149,159,
+10,136,139,136,111,10,166,247,8,21,108,79,80,123,84,27,104,111,152,155,148,
+147,151,153,150,31,164,171,179,152,188,27,173,168,136,132,179,31,247,55,248,
+93,21,127,120,129,124,126,31,106,107,135,136,125,27,129,127,145,157,111,31,
+169,247,133,29,109,106,124,111,108,31,110,113,126,119,122,26,124,152,128,
+155,150,149,143,148,147,30,179,179,147,144,178,10,247,233,124,21,211,142,
+189,148,182,158,8,192,162,169,169,169,245,29,166,198,247,156,10,201,27,183,
+172,131,124,161,31,149,131,143,131,138,123,8,105,153,124,170,175,161,161,
+183,149,30,155,213,5,144,158,139,141,148,26,161,121,154,113,119,126,131,120,
+127,30,156,106,91,149,85,27,45,247,169,10,183,80,211,117,30,158,133,153,136,
+166,136,120,54,24,141,156,140,139,144,27,171,153,132,124,247,123,10,121,137,
+140,131,27,114,116,117,116,128,144,129,148,133,31,121,162,180,127,175,27,
+211,198,193,204,179,123,157,98,148,31,14,248,226,115,10,162,192,116,10,215,
+247,232,21,163,154,148,152,156,26,157,125,152,119,127,133,136,126,120,30,
+251,50,33,5,115,123,130,127,123,26,120,153,126,159,149,152,144,149,154,30,
+14,120,10,113,135,94,27,54,96,162,192,116,10,83,247,214,247,85,10,150,247,
+86,10,131,147,31,131,146,251,18,247,17,251,74,251,16,5,110,119,134,132,122,
+26,121,152,126,158,149,147,142,149,154,30,14,120,10,112,135,94,27,55,96,163,
+191,116,10,251,42,248,12,21,247,17,10,179,177,174,176,169,118,159,108,31,
+247,100,247,167,29,176,169,117,159,109,31,14,34,10,251,17,248,36,21,152,126,
+133,142,127,27,112,116,117,114,131,144,130,151,127,31,247,3,33,5,128,150,
+247,51,29,134,149,127,150,31,14,248,84,248,61,21,251,76,114,29,212,6,91,251,
+111,5,251,11,72,10,247,235,6,168,154,143,150,153,245,10,251,9,6,247,61,248,
+129,21,164,155,147,151,156,26,157,188,29,14,48,10,175,248,111,21,228,247,
+13,29,133,145,247,39,10,152,126,158,149,169,10,247,158,29,137,126,152,29,
+247,235,6,168,153,247,189,29,133,140,118,27,251,9,6,82,248,165,21,99,101,
+104,101,111,161,118,169,179,177,174,177,167,117,160,247,184,29,177,167,117,
+160,109,31,14,48,10,116,248,189,247,116,29,131,145,129,150,247,18,10,247,
+161,29,247,238,248,196,21,153,146,136,122,161,31,113,176,172,124,161,27,173,
+169,156,180,180,31,160,161,149,155,152,26,153,125,151,122,128,120,128,125,
+126,30,106,107,244,29,109,107,31,111,113,127,120,123,26,124,152,128,155,150,
+149,144,149,149,30,176,176,148,145,156,27,86,251,27,63,10,14,38,29,247,85,
+247,154,21,165,156,147,149,156,26,158,247,70,29,118,125,128,124,124,26,120,
+153,126,158,150,149,143,150,156,30,14,38,29,197,247,136,247,32,10,141,122,
+155,31,247,39,10,153,126,157,149,148,142,149,153,30,14,38,29,103,247,190,
+189,29,180,177,174,177,167,117,160,108,31,14,38,29,131,247,214,21,152,125,
+134,142,127,247,34,10,151,148,134,150,27,165,163,161,162,149,135,147,125,
+152,31,14,38,29,247,120,247,192,21,125,123,129,120,121,31,110,111,244,29,
+110,108,31,111,113,126,120,122,26,124,152,128,155,150,149,143,150,149,30,
+176,177,147,145,178,10,248,72,248,204,221,10,117,127,187,29,165,251,181,21,
+142,152,140,149,147,26,161,122,154,115,122,129,133,122,127,30,154,105,247,
+106,29,247,17,247,110,29,74,180,10,148,142,147,151,30,121,175,188,247,41,
+10,113,155,99,150,67,148,78,147,132,141,127,143,247,95,29,169,131,121,161,
+30,107,150,149,131,165,247,151,29,147,145,166,8,14,248,189,248,232,21,165,
+156,147,150,155,26,158,188,29,247,104,75,39,10,248,60,248,214,21,229,247,
+13,29,136,141,137,142,138,140,251,19,220,29,247,207,77,39,10,247,223,249,
+12,21,192,29,176,169,117,159,247,184,29,176,169,117,159,109,31,208,251,99,
+39,10,247,254,249,36,21,152,125,134,247,147,29,149,129,31,247,3,247,66,29,
+147,126,152,31,247,28,251,17,39,10,44,10,248,84,247,166,44,29,247,228,249,
+12,189,29,179,247,87,10,251,197,253,5,69,10,14,247,169,242,21,247,201,247,
+130,157,247,13,10,174,162,162,183,149,30,140,144,5,247,26,6,251,199,247,104,
+10,153,140,145,212,10,108,117,122,104,128,30,129,248,101,221,10,116,128,140,
+137,156,122,247,154,10,168,158,144,146,157,26,157,126,152,121,128,130,135,
+129,125,30,14,247,249,248,152,21,72,6,103,117,123,113,124,151,127,154,137,
+31,143,6,113,251,11,5,106,118,122,114,118,152,130,169,31,208,6,174,161,156,
+165,158,127,148,114,140,31,159,230,5,166,173,157,147,164,27,167,153,132,124,
+137,138,135,138,135,31,119,45,5,111,137,120,122,116,26,118,152,130,169,30,
+194,6,174,161,155,166,154,128,151,123,140,31,136,140,160,233,5,141,149,140,
+149,147,26,185,99,169,80,111,113,131,126,117,30,133,135,5,14,248,115,22,168,
+153,247,15,10,156,247,78,10,112,6,187,247,110,5,168,6,170,151,247,54,10,157,
+155,247,78,10,111,6,146,172,5,161,145,177,10,251,40,188,10,74,58,64,77,58,
+121,31,131,105,5,125,72,10,151,6,91,251,110,5,120,6,107,129,136,247,59,10,
+247,27,6,176,140,149,142,157,157,8,122,150,149,134,175,27,251,1,243,21,187,
+247,110,5,247,41,247,89,29,121,6,105,126,135,121,121,31,157,128,127,143,106,
+27,14,248,182,242,21,210,247,214,5,251,64,188,10,72,111,118,134,125,112,31,
+152,111,111,145,108,27,58,64,77,58,107,29,251,185,22,247,0,10,157,159,27,
+146,144,138,137,215,29,248,181,242,21,247,3,248,135,5,251,27,6,108,140,115,
+133,112,125,8,152,112,110,145,108,27,58,64,78,57,107,29,90,247,214,21,75,
+6,146,172,5,162,144,160,158,159,27,146,146,138,135,152,31,251,152,252,28,
+21,247,0,10,158,159,27,146,144,138,136,215,29,248,219,247,52,21,173,167,158,
+176,176,26,192,101,175,82,247,80,10,98,96,228,10,117,107,247,106,10,106,240,
+10,251,93,248,145,88,10,247,232,247,78,21,147,150,145,152,147,26,154,128,
+150,123,125,128,132,121,126,30,251,213,252,71,5,131,127,134,127,132,26,123,
+150,128,155,152,151,147,156,152,30,14,248,194,248,145,21,146,150,145,152,
+147,26,154,128,150,123,125,247,135,29,130,126,134,247,71,10,117,248,47,86,
+29,247,238,251,217,21,173,167,158,176,176,26,192,100,175,83,247,80,10,97,
+97,228,10,118,106,247,106,10,107,251,51,21,164,157,121,113,108,247,159,29,
+171,31,14,248,194,248,145,21,146,149,145,153,147,26,154,128,150,124,125,216,
+10,152,30,247,237,247,121,10,83,65,72,77,70,116,146,120,154,121,30,101,112,
+117,99,247,105,10,163,123,154,144,29,251,171,248,71,21,235,6,170,158,154,
+163,158,128,146,113,31,251,55,6,105,251,60,138,129,5,125,149,128,152,145,
+142,140,143,147,30,151,165,162,146,157,27,166,156,121,110,120,133,119,130,
+125,31,117,126,116,130,99,27,106,124,143,153,127,31,146,132,136,141,131,27,
+120,121,120,119,108,184,117,199,202,179,156,177,169,31,162,169,152,178,176,
+26,199,103,178,84,124,127,137,133,115,30,14,247,236,248,196,21,251,31,251,
+143,5,133,128,136,130,132,26,125,152,128,154,157,149,147,162,152,30,247,43,
+247,167,151,201,5,251,159,6,128,84,5,138,131,138,135,135,26,125,151,128,154,
+159,152,149,160,146,30,247,235,88,21,146,149,145,153,147,26,154,128,150,123,
+126,216,10,151,30,247,238,247,121,10,82,66,72,77,70,116,146,120,154,121,30,
+102,113,116,98,247,105,10,162,123,155,144,29,14,247,144,248,27,21,136,127,
+138,124,122,26,65,176,96,204,214,213,209,230,159,30,153,202,5,141,148,140,
+153,159,26,214,102,182,74,63,68,71,46,118,30,247,78,76,21,86,127,100,96,102,
+27,110,119,165,178,148,140,149,142,151,31,153,202,5,194,151,177,180,176,27,
+169,158,113,96,130,138,130,137,130,31,14,248,161,248,241,21,55,6,251,83,251,
+127,128,87,5,247,48,6,136,124,5,120,6,116,135,138,130,129,31,131,132,132,
+127,130,26,121,150,131,165,30,218,6,170,160,155,162,153,126,150,122,31,142,
+154,5,155,147,143,149,148,31,144,144,146,154,145,26,152,126,149,121,141,30,
+72,22,69,6,236,247,15,5,14,248,10,248,176,21,247,8,6,171,158,155,164,157,
+130,145,111,31,251,75,6,102,251,60,5,138,136,139,136,136,26,124,149,128,154,
+145,149,142,145,153,30,147,159,167,146,156,27,156,153,135,131,148,31,146,
+133,146,120,126,26,124,130,112,129,127,30,122,126,108,129,98,27,109,113,144,
+146,132,31,153,124,135,141,129,27,117,119,120,118,109,188,116,202,212,183,
+155,178,174,31,163,166,156,181,174,26,200,97,179,76,123,120,137,134,116,30,
+14,247,238,248,83,21,158,175,153,155,169,159,8,158,166,172,151,166,27,144,
+146,138,137,142,31,133,150,140,139,146,27,160,161,159,157,162,115,152,97,
+104,109,131,121,106,31,98,117,98,104,117,107,8,112,100,123,78,79,26,66,176,
+102,211,186,175,154,171,169,30,161,162,156,182,170,26,159,130,167,128,155,
+30,160,125,107,154,111,27,111,114,131,120,109,31,124,41,21,174,163,173,164,
+162,27,162,158,118,115,96,112,113,95,104,122,156,176,31,14,248,111,248,176,
+21,251,35,251,143,5,134,130,134,125,134,26,127,153,127,152,156,153,149,161,
+151,30,247,48,247,167,153,200,5,251,158,6,127,85,5,136,128,139,139,136,26,
+122,150,128,156,157,151,149,160,148,30,14,248,117,248,61,21,176,164,161,176,
+177,26,194,98,174,75,99,96,123,115,112,30,113,116,119,99,112,26,118,147,119,
+155,120,30,92,105,121,107,91,26,90,183,107,207,228,209,195,210,169,128,165,
+122,151,30,80,247,17,21,170,159,125,116,107,107,114,99,107,116,155,162,169,
+173,164,181,31,157,251,106,21,119,101,118,102,104,114,152,158,170,180,172,
+179,166,166,119,120,30,131,7,14,248,100,248,34,21,121,104,126,123,108,118,
+8,120,112,106,127,112,27,134,132,140,141,136,31,144,128,137,140,134,27,118,
+116,120,122,124,140,138,145,133,31,128,153,157,134,166,27,195,196,164,187,
+191,31,190,185,168,208,211,26,171,137,158,134,152,30,179,125,104,160,87,27,
+52,73,76,56,82,179,98,194,165,167,148,157,166,31,155,237,21,105,115,105,113,
+115,27,115,120,160,165,178,169,167,181,157,154,134,129,147,31,146,132,140,
+135,142,118,8,14,247,209,248,97,21,169,6,170,151,142,150,154,31,154,152,149,
+247,47,10,251,60,6,106,130,137,126,247,171,29,168,6,60,251,250,5,108,247,
+30,29,182,30,247,60,190,10,156,26,151,134,150,129,148,30,147,130,130,140,
+111,27,110,6,247,234,247,250,21,49,252,42,129,96,135,131,114,120,25,118,112,
+101,126,104,27,112,111,146,154,99,31,144,126,129,142,132,27,109,107,107,109,
+125,144,129,149,131,31,119,164,213,120,191,27,197,199,159,174,190,31,196,
+178,164,176,153,203,247,8,248,157,24,251,53,157,10,157,127,181,30,14,32,29,
+37,248,14,92,29,248,118,248,200,21,103,29,247,125,6,148,92,5,121,175,29,121,
+122,26,109,157,127,181,30,207,6,63,145,10,184,182,201,166,31,180,157,155,
+157,167,26,166,121,154,107,30,130,6,251,45,247,42,21,251,37,6,247,3,247,61,
+5,14,46,10,248,151,248,63,83,29,46,10,247,247,248,35,88,29,45,10,248,4,248,
+95,160,29,84,10,244,63,29,60,29,32,10,247,102,63,29,32,10,247,115,148,29,
+67,10,248,4,6,64,100,113,149,10,183,182,200,164,31,144,141,146,142,172,247,
+39,5,142,155,140,145,147,26,161,247,178,10,41,29,251,127,249,134,92,29,56,
+10,39,249,98,160,29,34,29,226,148,29,37,29,247,141,54,29,37,29,248,16,248,
+41,21,140,140,140,139,140,141,143,247,20,10,124,131,123,126,30,35,251,14,
+5,123,122,134,130,215,10,39,29,248,8,54,29,39,29,247,124,63,29,36,10,226,
+247,146,128,10,110,114,136,135,247,200,29,110,114,136,135,247,165,10,36,29,
+247,124,248,54,83,29,36,29,211,248,26,88,29,40,29,95,247,200,83,29,247,231,
+127,21,247,33,150,239,224,247,2,26,186,111,181,93,159,30,113,151,108,147,
+85,102,29,150,149,143,148,145,165,157,224,24,144,158,139,141,147,26,162,121,
+155,114,118,147,10,125,26,96,73,103,58,76,84,166,170,136,30,137,166,161,29,
+165,123,183,125,170,135,118,46,24,140,156,149,140,141,27,166,154,130,123,
+126,128,131,120,122,116,146,149,123,31,150,121,136,140,127,27,115,121,122,
+114,130,143,130,144,133,31,120,158,186,124,180,27,212,191,186,205,177,121,
+161,100,148,31,14,47,10,205,63,29,33,29,49,249,20,138,29,14,33,29,54,248,
+166,128,10,111,115,135,134,247,200,29,111,115,135,134,247,165,10,101,29,247,
+38,54,29,101,29,148,148,29,32,29,44,247,217,112,10,47,10,88,251,114,37,10,
+45,10,248,0,248,44,49,29,247,202,166,29,169,26,157,85,10,247,140,249,94,21,
+228,49,5,130,149,247,128,10,161,151,138,140,121,247,100,10,119,134,133,247,
+6,10,149,143,148,153,30,14,46,29,247,15,249,145,247,9,29,247,100,22,247,25,
+29,14,247,252,247,127,193,29,118,27,47,48,29,222,248,247,49,29,247,33,248,
+72,21,132,6,137,6,97,108,120,112,117,160,128,182,138,31,82,251,145,247,173,
+10,122,26,110,157,126,181,30,247,13,6,169,152,241,29,110,27,130,247,58,29,
+247,98,6,110,251,19,5,128,113,10,247,13,6,168,152,247,15,10,155,26,152,134,
+151,130,147,30,146,130,130,141,111,27,138,6,195,247,145,5,157,148,140,141,
+149,31,164,144,158,158,158,26,160,118,152,104,30,136,6,135,6,144,165,5,179,
+143,164,163,172,201,29,110,157,126,181,30,149,6,134,114,5,251,98,6,144,164,
+5,151,247,164,29,156,201,29,115,153,125,166,136,30,247,183,33,21,131,104,
+5,251,98,6,147,174,5,14,32,10,234,249,25,112,10,56,10,35,249,47,49,29,50,
+29,247,103,248,120,49,29,34,29,98,249,25,112,10,248,92,207,10,157,156,247,
+86,29,130,133,140,118,27,251,193,113,29,235,6,59,251,250,5,42,114,29,247,
+119,6,64,145,10,187,185,200,164,31,180,156,155,156,167,101,10,44,6,14,247,
+176,29,154,151,149,156,156,26,156,128,247,109,29,133,140,118,201,10,129,96,
+135,131,114,120,25,118,112,101,126,103,27,107,111,147,159,94,219,29,91,233,
+191,123,247,50,29,65,248,169,21,229,247,49,29,121,156,31,203,10,52,10,243,
+251,114,37,10,37,29,181,251,114,37,10,39,29,247,17,251,114,37,10,36,10,70,
+247,165,112,10,36,29,124,252,70,37,10,58,10,251,47,247,181,49,29,41,29,251,
+132,251,58,37,10,33,29,251,133,248,185,112,10,73,10,44,220,65,242,152,150,
+139,140,154,30,83,107,116,106,90,26,94,185,10,130,135,142,147,165,157,160,
+225,212,31,225,210,164,175,161,217,8,14,32,10,227,249,78,92,29,248,46,207,
+10,156,156,26,156,129,155,124,61,29,71,249,78,92,10,247,238,248,61,21,251,
+68,6,106,247,14,29,121,122,26,111,158,126,182,30,205,247,88,10,71,110,29,
+110,157,126,182,30,247,132,6,167,154,143,150,153,165,10,76,6,243,221,29,247,
+92,251,64,21,64,251,228,129,91,95,107,85,140,25,251,3,114,29,247,5,6,247,
+4,241,217,241,160,31,237,248,77,5,251,107,72,10,247,110,247,172,247,116,10,
+14,247,217,242,21,217,247,244,82,29,14,33,10,251,10,248,123,68,29,248,151,
+242,21,98,10,135,120,5,183,6,75,103,107,95,87,105,10,147,144,149,148,151,
+31,157,163,157,152,209,181,8,173,160,152,156,163,247,17,29,131,132,139,119,
+27,251,5,171,124,29,14,41,10,116,247,192,44,29,41,10,251,66,247,164,56,29,
+41,10,251,42,247,228,106,29,69,29,248,102,247,104,127,10,249,25,248,131,21,
+163,247,0,5,90,29,203,247,181,5,151,6,170,151,141,151,153,31,153,149,150,
+161,156,26,149,132,154,130,145,30,146,130,129,141,113,27,251,191,251,52,177,
+29,14,34,10,75,247,204,56,29,34,10,89,248,12,106,29,248,226,204,10,251,2,
+225,69,247,26,150,151,139,140,156,30,89,101,117,103,95,105,10,174,217,199,
+228,171,31,179,154,155,157,167,26,163,247,160,10,41,114,135,93,27,55,96,163,
+191,116,10,14,47,29,99,247,221,68,29,77,29,233,247,189,106,29,42,29,247,86,
+54,29,42,29,247,197,248,80,127,10,35,29,247,195,247,103,44,29,35,29,247,34,
+247,75,56,29,38,29,193,247,152,64,29,43,29,247,116,247,120,44,29,35,10,142,
+247,154,44,29,35,10,251,46,247,136,72,29,35,10,251,152,252,89,37,10,248,129,
+248,61,21,134,6,85,29,180,247,76,5,247,70,247,163,10,157,26,145,138,143,135,
+147,30,151,142,139,139,162,160,242,247,13,24,161,10,129,127,26,137,139,137,
+140,136,30,14,38,10,57,248,235,150,10,38,10,251,2,248,127,64,29,108,29,247,
+41,248,129,44,29,108,29,141,248,165,106,29,247,148,55,10,53,10,247,184,247,
+74,29,161,141,146,142,151,149,25,155,151,148,156,156,218,10,122,122,26,122,
+247,90,29,135,148,145,139,160,27,247,38,29,165,150,135,29,247,86,248,214,
+137,10,40,10,219,249,12,102,10,33,10,251,5,248,64,112,29,247,84,45,29,247,
+183,247,148,72,29,248,216,247,2,29,157,105,92,148,85,27,45,57,29,251,72,247,
+174,72,29,34,10,251,71,247,241,112,29,77,29,223,247,135,137,10,248,38,64,
+10,68,128,29,48,10,73,248,138,112,29,248,45,110,10,247,71,247,148,247,85,
+10,150,27,162,189,10,149,143,148,152,30,14,59,10,245,251,11,37,10,42,29,86,
+251,114,37,10,35,29,179,252,140,37,10,38,29,78,247,163,112,29,43,29,100,252,
+123,37,10,248,198,73,29,251,122,128,29,38,10,251,117,248,138,112,29,248,244,
+248,61,90,10,167,6,76,103,107,95,87,105,10,161,166,167,193,174,31,203,181,
+154,156,166,26,156,129,154,124,145,30,141,133,132,140,126,27,14,43,29,202,
+247,92,56,29,247,224,125,21,247,25,149,234,206,223,26,176,121,170,106,159,
+30,114,155,98,150,68,148,78,147,132,140,127,144,166,10,147,174,24,99,10,162,
+127,169,131,181,134,120,54,24,127,29,14,47,29,247,86,247,183,21,143,143,142,
+143,142,142,140,140,25,147,149,247,127,29,120,123,124,131,123,125,30,35,251,
+14,5,123,121,134,130,125,26,123,154,125,157,154,155,148,156,153,30,14,247,
+147,247,242,21,220,176,196,183,206,27,193,189,109,107,31,138,114,5,116,154,
+124,162,171,160,161,183,149,30,157,219,5,142,154,140,145,147,26,162,123,155,
+116,122,127,133,123,124,30,168,87,114,146,88,27,251,17,251,15,45,251,26,92,
+31,111,6,117,123,124,117,122,147,132,157,31,162,6,132,108,5,114,6,117,123,
+124,117,122,147,131,157,31,166,126,6,251,10,227,61,247,23,221,212,164,184,
+192,30,164,161,151,158,159,26,163,122,157,116,126,127,134,128,126,30,109,
+113,139,139,129,134,8,125,114,101,131,100,27,62,95,176,207,136,31,247,54,
+6,162,155,155,161,156,131,146,120,31,251,58,6,146,170,5,247,87,6,162,155,
+155,160,156,131,146,120,31,14,247,146,247,111,21,152,6,247,4,224,224,247,
+3,235,85,192,41,31,53,6,116,133,138,133,127,31,120,128,126,118,117,26,111,
+153,125,171,30,60,251,250,115,140,130,135,124,127,25,125,126,131,124,121,
+26,127,143,129,147,130,30,129,148,144,138,165,27,247,24,6,170,247,63,29,97,
+30,111,6,218,247,249,21,176,135,151,126,105,26,113,130,115,122,123,30,127,
+126,127,135,109,136,8,247,163,68,21,144,155,140,142,150,26,162,121,154,112,
+104,113,114,98,132,30,136,123,5,118,131,138,132,129,31,122,129,126,116,119,
+26,110,153,126,170,138,30,133,111,138,128,125,26,83,189,99,208,187,171,162,
+176,161,125,157,120,135,136,139,138,136,30,136,127,139,139,132,27,123,130,
+149,157,145,140,144,141,153,31,169,147,141,145,152,31,160,150,154,161,159,
+26,171,122,150,93,30,14,247,47,247,75,21,120,88,116,115,105,135,8,96,131,
+117,118,106,26,110,157,126,182,30,247,212,6,185,169,149,163,164,31,159,157,
+152,169,164,26,163,121,155,112,110,117,124,111,128,30,251,85,6,156,166,150,
+162,149,168,8,247,4,6,163,156,154,161,156,130,146,119,31,251,6,6,140,165,
+5,247,12,6,163,156,154,160,157,130,146,119,31,251,26,6,137,175,138,160,145,
+26,189,172,171,190,165,156,132,123,151,30,113,157,145,136,159,27,173,170,
+169,172,187,71,183,65,251,12,42,48,251,6,129,140,132,141,113,31,87,247,138,
+29,207,6,138,113,5,65,6,114,123,125,117,121,148,132,159,31,14,247,80,247,
+124,21,168,137,6,138,138,135,137,134,30,138,134,138,134,134,26,113,157,121,
+165,156,157,147,152,152,30,146,146,148,158,143,159,163,247,1,24,141,149,141,
+152,145,26,160,120,156,115,108,110,115,108,133,30,138,133,138,136,138,26,
+138,135,5,110,6,167,247,18,5,247,60,6,136,128,5,137,128,137,126,133,26,118,
+159,123,164,154,156,146,153,154,30,151,150,142,146,144,165,165,247,8,24,252,
+16,6,110,125,136,128,247,70,10,60,251,250,5,113,247,131,10,122,126,130,123,
+122,26,127,247,128,29,145,137,168,27,247,55,6,170,152,143,150,154,31,152,
+150,149,158,154,26,170,123,151,95,30,80,6,247,214,22,153,201,146,146,5,228,
+220,139,139,156,27,147,148,134,128,148,31,125,152,146,135,153,27,169,163,
+166,172,180,97,176,93,103,117,126,91,96,31,150,187,5,35,6,110,125,135,129,
+247,70,10,107,251,38,5,113,130,138,132,128,31,115,126,126,120,118,26,127,
+247,128,29,146,137,167,27,247,64,6,170,150,142,151,155,247,56,10,169,121,
+151,97,30,14,130,10,130,10,91,29,130,29,248,13,248,9,21,114,186,131,134,128,
+132,5,105,87,122,132,113,27,110,122,157,172,188,177,179,185,162,151,131,124,
+134,138,115,137,121,31,231,150,5,138,155,139,153,152,26,163,140,143,158,178,
+30,144,148,142,146,142,144,52,156,24,134,123,5,146,114,130,141,123,27,39,
+50,52,40,68,187,92,211,174,172,148,161,180,31,251,103,251,140,5,128,126,132,
+125,127,26,120,157,123,161,157,155,148,156,154,30,247,25,247,48,5,129,113,
+135,121,117,26,67,188,93,217,243,229,225,238,211,89,186,63,101,111,131,119,
+102,30,247,96,247,130,5,150,152,145,153,151,26,158,121,155,117,121,123,131,
+121,124,30,91,251,232,21,172,158,121,107,90,101,98,93,107,120,157,171,188,
+177,180,184,31,14,248,146,247,95,21,124,159,134,146,124,155,96,10,163,247,
+0,5,231,6,157,130,154,125,159,112,137,138,24,108,129,124,121,113,26,120,155,
+119,154,140,30,145,149,142,143,152,31,172,150,163,91,146,123,145,116,25,238,
+29,135,147,138,142,133,152,145,140,24,168,148,156,159,165,26,158,124,157,
+124,134,127,136,135,126,30,251,169,240,247,22,29,14,141,10,196,29,33,10,169,
+248,161,155,10,209,247,37,21,163,155,148,152,155,26,158,247,59,29,123,129,
+126,123,26,120,153,126,159,150,147,142,152,157,30,14,247,179,94,10,186,27,
+183,168,29,168,154,143,150,152,247,57,29,157,176,29,247,68,247,221,187,10,
+119,134,133,247,6,10,169,10,34,10,251,76,248,44,68,29,248,84,134,29,247,156,
+6,76,103,107,95,87,105,10,161,171,172,187,169,31,206,180,139,139,149,153,
+8,145,147,143,151,149,101,10,251,8,6,236,221,29,14,42,29,247,115,247,192,
+21,96,96,100,100,107,247,156,29,179,178,171,115,162,105,31,130,6,14,122,29,
+73,247,222,132,29,76,10,247,30,247,160,44,29,247,158,29,137,126,124,247,130,
+10,111,158,126,182,30,212,247,88,10,251,10,6,107,129,136,127,247,184,10,154,
+143,150,152,165,10,251,8,6,247,65,248,167,21,125,247,18,29,168,95,122,147,
+146,29,174,168,156,182,181,216,29,248,244,248,61,21,251,32,110,29,110,157,
+126,182,30,168,6,102,251,60,5,88,77,112,127,89,27,95,113,154,166,147,140,
+145,140,147,31,200,247,162,5,251,13,247,113,10,118,247,57,10,247,150,29,121,
+26,68,199,91,230,193,172,151,179,196,30,130,99,5,238,6,168,153,142,151,153,
+247,52,29,151,129,147,30,131,145,132,141,119,140,8,187,248,167,21,125,123,
+129,119,120,31,111,111,136,247,42,10,103,99,117,99,102,31,123,121,132,126,
+127,26,123,247,150,10,176,147,145,207,29,174,168,156,182,181,31,161,161,147,
+153,153,26,152,124,151,124,30,14,37,29,247,109,247,191,21,96,96,100,99,108,
+247,156,29,178,179,171,115,162,105,31,130,6,14,248,17,81,29,43,247,218,92,
+10,40,29,251,183,252,180,37,10,47,10,88,251,114,37,10,53,10,248,224,134,10,
+72,93,70,247,11,29,150,142,150,154,131,10,41,220,68,247,5,10,251,160,248,
+238,92,10,32,29,185,248,52,138,29,192,247,34,21,165,157,145,148,156,26,157,
+124,153,119,127,133,136,127,121,30,251,43,32,5,116,123,130,127,123,26,120,
+153,126,161,146,154,146,148,152,30,14,70,10,247,11,247,172,218,29,128,123,
+26,120,153,126,159,149,153,145,149,152,30,14,53,29,247,149,247,199,218,29,
+247,110,10,153,30,14,248,64,143,21,118,72,106,111,76,137,8,237,10,200,203,
+164,182,185,31,165,159,160,180,161,211,243,248,92,24,94,29,155,151,148,182,
+29,198,247,156,5,14,248,65,247,235,21,165,247,10,5,240,6,127,87,247,19,29,
+150,149,142,148,145,166,174,247,48,24,252,160,6,105,251,47,5,134,120,139,
+138,131,26,116,247,168,10,149,144,165,151,192,24,238,6,113,251,10,5,86,6,
+107,131,137,126,122,31,123,247,71,29,145,137,168,27,191,6,108,251,29,5,78,
+247,188,10,247,123,6,167,155,143,150,152,246,10,79,6,169,247,29,5,188,6,192,
+167,161,181,166,121,151,98,31,14,247,152,247,163,21,148,146,139,139,147,145,
+167,162,139,139,146,143,8,156,166,161,145,176,27,185,162,124,108,133,138,
+133,138,133,31,75,251,176,129,92,94,106,86,140,25,237,10,247,7,141,235,212,
+163,244,203,247,180,24,142,154,141,155,154,26,211,79,186,47,88,92,123,108,
+97,30,147,174,5,40,6,87,110,117,97,114,153,127,174,137,31,91,251,111,5,136,
+6,107,131,137,126,123,31,122,126,130,123,122,26,127,144,129,149,129,30,131,
+149,145,137,168,27,247,4,6,171,247,63,29,96,30,138,6,14,247,171,247,165,21,
+150,188,5,247,70,6,170,150,142,151,155,247,56,10,169,122,151,96,30,251,68,
+6,156,218,5,143,155,140,142,150,26,162,121,154,112,121,126,133,125,123,30,
+130,130,131,122,135,119,121,58,24,108,6,108,128,136,128,124,31,123,127,129,
+121,122,26,127,144,128,149,130,30,130,149,146,138,168,27,169,6,128,90,5,114,
+130,138,133,127,31,117,128,124,117,118,26,127,144,129,149,129,30,130,149,
+145,138,168,27,129,90,5,137,130,138,131,128,26,111,147,117,156,123,30,114,
+164,195,122,192,27,210,240,162,167,189,31,162,152,153,159,160,26,161,119,
+158,115,131,131,137,135,130,30,113,80,92,128,82,27,90,114,148,157,146,140,
+146,141,148,31,146,171,5,247,29,6,171,150,247,54,10,156,155,26,170,122,151,
+95,30,14,247,146,247,50,21,155,150,218,57,5,123,124,132,126,122,26,110,157,
+126,181,30,247,11,190,10,156,26,151,134,151,129,147,30,147,130,130,140,111,
+223,10,157,26,168,122,151,95,30,247,104,29,123,121,26,129,140,134,145,130,
+30,58,86,170,247,31,5,251,13,6,109,127,136,128,247,69,10,150,247,89,29,127,
+6,107,247,131,10,124,126,247,53,10,181,30,247,12,6,14,247,209,248,61,21,40,
+247,113,10,117,26,127,144,127,149,132,30,147,132,146,137,159,138,90,251,111,
+24,137,233,29,167,153,241,29,111,27,138,6,176,247,60,5,186,195,174,155,184,
+27,186,165,124,113,131,138,132,138,131,31,102,251,59,5,95,109,113,104,110,
+157,126,182,31,228,247,177,10,124,151,104,141,30,176,247,61,5,143,154,140,
+153,156,26,210,78,187,49,85,103,126,100,85,30,118,247,67,21,154,155,145,150,
+151,26,157,125,152,120,122,128,133,119,121,30,251,1,251,12,5,124,122,133,
+128,127,26,122,154,126,158,155,151,146,158,156,30,14,249,15,248,97,21,183,
+140,168,164,175,26,151,134,150,130,147,30,147,129,130,141,111,27,251,21,157,
+10,157,127,182,30,168,6,80,251,161,5,83,126,73,93,69,27,79,95,174,186,144,
+140,146,247,145,10,151,142,150,153,31,155,152,148,156,157,26,151,134,150,
+130,147,30,147,129,132,141,110,27,251,22,110,29,112,155,125,173,138,30,81,
+251,152,5,136,122,137,123,123,26,44,220,69,247,5,10,251,24,248,107,95,29,
+51,29,173,247,234,44,29,248,92,248,97,21,237,6,169,151,142,151,154,165,10,
+251,193,157,10,157,127,181,30,235,6,59,251,250,5,42,113,10,247,193,6,168,
+153,247,127,10,247,47,10,44,6,186,248,203,95,29,46,29,247,0,249,174,21,151,
+126,135,141,127,27,116,117,119,118,128,145,129,152,127,247,153,10,146,27,
+163,160,159,162,151,135,144,124,154,31,14,46,29,248,22,249,113,21,165,157,
+145,147,157,26,157,124,152,119,128,129,135,128,124,30,251,43,33,5,115,122,
+131,127,124,26,120,153,126,159,149,153,145,149,153,30,14,40,10,224,249,36,
+247,97,29,144,129,151,247,18,10,133,149,128,150,31,14,40,10,247,221,248,226,
+21,165,157,145,148,156,26,158,124,152,119,128,131,136,127,122,30,251,43,32,
+5,116,122,130,128,123,26,120,152,127,160,138,30,148,153,145,149,154,31,14,
+248,42,247,127,193,29,119,27,46,48,29,81,146,10,44,10,247,75,247,226,247,
+97,29,145,129,150,128,31,247,3,33,5,128,150,247,51,29,133,149,128,150,31,
+14,14,14,247,109,248,35,21,117,121,122,117,118,156,121,161,161,156,156,161,
+160,122,157,118,31,247,65,140,21,117,121,121,118,117,157,121,161,160,157,
+157,160,161,121,157,118,31,233,55,21,130,100,131,123,119,115,8,97,102,92,
+119,77,27,76,93,159,181,102,31,119,163,131,155,130,178,144,72,147,108,162,
+104,8,91,172,189,114,203,27,198,186,160,180,171,31,168,176,150,174,144,211,
+8,251,71,247,139,171,10,131,102,21,247,29,247,3,251,0,251,27,251,29,251,1,
+251,1,251,28,251,27,251,1,247,1,247,28,247,25,247,2,247,3,247,23,31,14,247,
+197,248,199,171,10,48,251,52,247,8,10,247,162,52,21,134,72,130,108,116,105,
+8,90,106,90,114,75,27,79,94,160,180,106,31,110,176,128,173,133,212,149,99,
+147,122,158,117,8,97,174,188,118,202,27,201,188,160,181,174,31,158,161,147,
+156,149,179,8,41,226,247,8,10,14,247,192,117,21,155,210,186,219,227,247,2,
+8,213,233,164,191,201,26,202,85,192,74,75,93,98,63,118,30,217,114,95,178,
+75,27,74,88,86,71,87,155,104,204,51,31,247,9,251,48,169,86,160,59,8,14,246,
+247,162,21,225,32,220,251,9,175,71,186,224,227,247,15,219,235,77,209,251,
+16,247,68,110,196,96,58,83,60,251,6,251,35,8,14,248,130,22,155,7,251,21,158,
+80,206,247,24,26,156,110,145,129,148,128,8,104,169,186,115,181,27,209,194,
+196,212,209,89,194,76,120,128,136,126,112,31,137,138,130,134,134,137,8,161,
+170,147,163,168,26,208,83,193,68,68,84,85,69,112,144,125,165,97,30,156,104,
+120,145,118,27,79,88,82,70,67,195,83,210,202,192,177,210,173,31,140,120,5,
+133,7,138,83,110,76,98,106,114,120,121,132,66,124,8,123,7,14,247,34,22,248,
+9,157,6,251,17,145,81,205,141,247,23,8,74,173,175,114,195,27,193,184,186,
+197,192,119,170,56,215,31,55,216,124,161,109,229,127,68,92,71,58,74,8,77,
+88,112,95,90,26,81,186,91,196,195,179,168,200,168,30,251,20,144,71,64,251,
+14,27,14,247,228,248,49,21,145,117,119,142,118,27,251,11,44,44,251,10,251,
+10,234,44,247,10,247,10,234,234,247,10,219,94,212,69,176,31,227,247,83,5,
+97,170,170,109,149,27,146,143,143,144,143,137,143,133,149,31,117,173,120,
+192,136,175,8,158,138,138,142,133,27,135,135,137,131,129,31,120,122,74,115,
+103,136,8,121,136,135,137,131,26,128,163,132,178,30,159,6,159,140,5,141,6,
+251,49,251,121,21,234,216,64,47,45,64,63,45,46,63,214,232,231,215,216,229,
+31,14,247,214,247,172,21,246,148,224,233,247,1,26,247,10,43,234,251,10,251,
+10,44,44,251,10,251,1,224,45,245,130,30,50,251,41,100,247,41,251,44,183,247,
+44,247,40,178,251,40,7,114,248,105,21,235,216,64,47,45,63,63,45,46,63,214,
+233,230,215,216,229,31,14,247,166,247,40,21,144,126,122,143,125,27,87,93,
+94,89,110,161,120,173,211,190,194,218,31,247,139,7,186,132,179,75,70,26,96,
+131,105,119,94,30,162,6,169,176,155,185,188,26,202,115,199,89,199,30,97,190,
+138,140,134,144,133,148,25,188,102,7,14,247,35,248,42,21,115,110,125,104,
+134,101,8,44,94,235,6,143,100,153,104,162,110,72,72,24,171,107,206,207,169,
+115,171,126,180,133,25,44,184,234,7,180,145,173,153,167,162,206,71,24,171,
+171,72,207,161,164,154,175,144,180,25,235,184,43,6,134,179,124,175,117,166,
+206,206,24,107,171,72,72,113,161,98,156,103,142,25,234,94,45,7,104,135,97,
+121,114,117,71,207,24,107,107,5,247,114,93,21,220,204,75,61,58,75,75,59,60,
+75,203,218,218,203,204,216,31,14,200,22,248,115,248,115,252,115,6,247,130,
+251,33,21,195,183,95,83,86,94,95,86,84,95,183,193,193,183,184,192,31,14,247,
+189,248,92,21,236,218,62,43,41,62,61,42,44,61,217,236,233,217,219,232,31,
+145,179,21,251,13,42,45,251,11,251,12,234,43,247,12,247,10,235,235,247,11,
+247,9,43,236,251,7,31,14,247,195,248,92,21,41,60,62,43,41,216,61,237,235,
+217,217,236,234,61,218,45,31,247,171,252,92,21,248,199,252,199,252,199,7,
+247,170,248,132,21,247,13,236,45,251,11,251,12,44,43,251,11,251,11,43,235,
+247,11,247,8,235,237,247,7,31,14,158,22,248,199,247,174,252,199,6,14,199,
+248,117,21,252,117,248,115,248,117,7,14,156,22,248,203,248,203,252,203,6,
+248,146,252,146,21,252,89,248,89,248,89,6,14,248,167,190,21,251,123,248,70,
+251,124,252,70,5,14,163,247,107,21,248,60,108,10,252,60,6,14,248,221,247,
+159,21,252,60,6,163,171,160,181,154,26,147,132,146,130,132,135,137,132,133,
+30,100,94,120,124,65,96,8,125,131,136,136,131,26,132,143,135,158,129,30,198,
+106,170,115,169,104,8,127,149,144,135,145,27,149,147,145,147,154,123,171,
+110,183,31,248,60,6,14,247,53,247,158,21,169,184,154,170,154,26,147,131,145,
+130,132,135,136,126,128,30,108,104,110,116,79,105,8,120,129,135,135,132,26,
+133,143,133,146,135,30,145,136,140,138,143,137,145,136,25,153,130,188,110,
+163,119,173,100,25,132,145,143,137,146,27,148,146,146,147,154,118,181,115,
+171,31,247,179,108,10,14,247,208,127,21,248,52,7,117,170,184,117,154,27,147,
+146,146,148,146,137,143,131,145,31,99,172,121,160,108,189,136,143,136,143,
+136,145,136,144,136,144,138,140,8,247,99,29,105,81,116,110,102,108,8,126,
+129,136,134,133,26,129,145,132,147,154,169,153,169,187,30,252,52,7,14,247,
+155,248,174,21,252,52,7,162,108,94,161,124,27,131,132,132,130,132,141,135,
+147,133,31,184,101,154,121,184,65,8,126,146,142,136,148,27,146,143,144,156,
+149,31,171,195,165,171,175,169,8,152,150,142,144,145,26,148,133,147,131,124,
+107,124,110,93,30,248,51,7,14,247,166,247,2,247,10,29,110,165,107,247,101,
+10,147,143,31,183,212,158,164,247,67,29,95,117,116,107,30,247,174,7,116,171,
+183,118,117,10,171,154,168,185,30,14,247,87,99,21,95,247,106,183,7,251,24,
+247,81,247,10,29,112,165,106,247,101,10,146,143,31,182,213,159,163,247,67,
+29,94,117,117,108,30,247,173,7,117,170,184,117,117,10,172,154,168,184,30,
+14,247,161,249,27,21,251,137,251,234,247,140,251,236,195,140,247,138,247,
+235,251,136,247,233,5,247,60,251,231,21,251,90,251,174,251,89,247,174,247,
+89,247,171,5,14,198,248,101,21,247,133,252,77,247,132,248,77,5,14,247,197,
+248,202,21,251,55,251,23,251,17,251,48,251,50,247,20,251,19,247,53,247,52,
+247,21,247,19,247,48,247,46,251,22,247,21,251,46,31,14,248,147,247,56,21,
+248,32,93,251,237,251,143,7,168,183,154,171,154,26,146,131,146,132,132,134,
+136,126,128,30,110,104,106,114,81,107,8,123,130,133,134,133,26,132,142,134,
+147,135,30,216,94,161,123,178,94,8,132,145,143,136,145,27,147,147,146,147,
+153,118,180,114,173,31,14,247,79,247,152,21,247,81,251,254,5,124,147,149,
+131,149,27,146,142,142,147,144,138,143,135,151,31,251,36,247,245,247,36,247,
+246,5,142,146,141,148,146,26,145,136,142,132,129,134,135,120,126,30,14,248,
+50,247,152,21,251,81,247,255,5,157,127,133,144,129,27,132,136,136,133,132,
+141,130,142,132,31,247,36,251,246,251,36,251,245,5,135,127,138,135,134,26,
+131,142,136,146,149,149,147,154,147,30,14,247,225,22,247,103,248,235,5,85,
+6,76,251,55,5,251,151,6,77,247,55,5,88,6,247,95,252,235,5,247,42,248,21,21,
+251,3,251,226,5,132,6,36,247,226,5,14,247,245,247,220,21,251,172,247,239,
+5,123,108,134,120,113,26,116,147,123,163,109,30,213,48,79,251,1,5,119,104,
+128,107,117,26,117,148,114,163,101,30,166,94,139,139,128,26,123,128,131,117,
+30,114,63,234,6,186,169,143,147,154,31,161,150,151,165,174,26,184,129,160,
+79,219,30,102,187,126,167,169,26,158,143,150,155,171,30,247,218,252,38,5,
+156,169,144,157,163,26,164,131,156,109,176,30,96,192,5,98,190,130,158,174,
+26,157,143,154,152,172,30,185,247,2,5,159,6,161,148,130,115,143,31,137,141,
+129,141,129,30,156,199,142,155,178,26,197,118,163,89,30,64,6,100,127,149,
+170,31,155,7,140,153,5,94,93,125,110,90,26,108,148,112,155,124,30,127,152,
+155,135,174,27,175,6,14,248,48,247,158,21,251,107,251,185,88,247,237,248,
+198,251,237,88,247,185,251,86,251,185,88,7,14,248,160,248,235,21,63,123,101,
+105,126,132,149,199,113,30,117,190,121,166,117,158,8,167,106,93,154,90,27,
+251,20,34,42,251,10,68,174,81,204,101,31,170,121,155,134,195,130,146,186,
+24,104,145,129,142,122,146,8,80,162,104,190,199,26,217,206,206,217,191,171,
+111,53,182,30,73,172,172,114,192,27,214,184,198,237,31,152,7,150,7,165,251,
+233,21,133,168,137,145,133,155,8,198,119,100,169,85,27,64,71,77,69,114,146,
+107,151,112,31,183,43,139,139,114,26,108,106,112,100,102,112,155,181,109,
+30,97,196,128,154,123,154,118,153,25,160,107,97,151,100,27,133,6,130,6,138,
+95,177,127,151,131,158,111,25,196,49,139,139,166,111,8,104,173,180,119,180,
+27,189,202,162,173,185,31,183,172,160,174,176,26,156,135,156,128,163,30,88,
+247,5,137,146,163,26,165,158,158,166,177,158,116,71,156,30,14,144,150,21,
+161,152,144,144,151,27,148,148,136,134,146,31,104,191,139,139,170,27,183,
+186,171,193,176,31,171,187,156,203,214,26,195,152,7,190,144,133,70,157,31,
+185,251,71,5,89,151,158,113,161,27,164,183,161,167,168,31,148,147,146,148,
+158,162,120,160,24,133,124,134,137,133,27,119,129,152,177,129,31,108,247,
+11,125,192,120,171,115,153,25,237,174,182,180,197,26,228,67,206,43,78,91,
+118,93,92,30,187,101,97,160,82,27,251,2,52,47,251,7,72,160,105,206,103,31,
+180,116,157,119,113,26,133,138,134,135,122,30,159,133,5,180,188,151,161,170,
+26,164,122,159,104,157,30,79,170,139,139,131,145,8,117,157,128,161,166,26,
+193,180,181,193,209,171,86,251,8,30,251,51,7,80,136,112,128,109,30,119,132,
+126,122,129,27,136,134,142,144,131,31,160,110,125,145,116,27,109,112,122,
+109,119,31,128,123,135,129,126,102,8,247,235,247,247,21,247,21,138,140,125,
+188,30,158,169,157,145,171,27,196,180,103,88,106,119,108,108,123,31,108,123,
+120,133,77,124,8,14,143,248,199,21,247,150,252,199,5,215,6,247,150,248,199,
+5,252,90,52,21,247,208,6,251,50,251,230,5,14,143,22,248,228,6,251,150,248,
+199,5,63,6,251,12,252,112,21,247,50,247,230,247,50,251,230,5,14,247,193,227,
+21,63,224,5,248,167,89,252,110,7,85,200,5,71,6,247,140,251,173,247,139,247,
+173,5,71,6,85,78,5,248,110,89,252,167,7,14,247,193,249,9,21,214,54,5,252,
+167,189,248,110,7,193,78,5,207,6,251,139,247,173,251,140,251,173,5,207,6,
+193,200,5,252,110,189,248,167,7,14,248,84,248,50,21,146,151,5,145,150,142,
+148,149,26,169,113,164,108,120,119,125,119,127,30,103,76,5,251,104,6,112,
+131,138,132,128,31,122,129,128,121,158,10,247,41,6,103,75,5,251,5,6,113,130,
+147,29,189,6,124,113,5,133,129,135,125,129,26,113,165,116,169,161,158,151,
+159,151,30,183,216,5,247,98,247,14,10,148,150,158,158,26,157,130,156,124,
+149,30,147,127,129,141,111,27,251,35,6,175,203,5,246,6,162,153,141,145,148,
+247,191,29,247,0,247,219,125,10,251,66,21,112,131,138,132,128,31,122,129,
+128,121,247,190,10,153,141,145,148,165,29,252,20,247,239,247,75,29,121,148,
+123,162,29,14,247,46,247,209,21,34,6,121,140,128,130,138,122,8,138,7,140,
+122,150,130,157,140,8,199,6,228,251,176,247,133,249,47,5,247,59,6,156,152,
+150,154,155,128,148,120,31,251,102,6,251,85,252,204,5,14,247,167,92,21,68,
+132,111,123,132,136,141,153,131,30,154,128,124,148,122,27,113,121,122,114,
+109,165,118,176,167,167,152,163,162,31,169,171,147,169,228,26,248,138,7,202,
+146,166,157,173,29,247,166,251,74,21,191,249,53,6,202,147,166,156,173,29,
+247,218,249,14,21,87,253,53,6,75,131,112,122,134,135,143,148,133,30,160,125,
+129,146,119,27,114,120,122,114,110,164,117,174,163,164,148,154,159,31,176,
+168,153,182,228,26,14,248,118,248,75,21,116,127,132,111,117,31,111,117,127,
+127,247,19,10,95,99,31,109,107,128,119,220,10,87,199,179,119,181,27,181,171,
+156,183,177,31,174,178,147,153,159,26,170,113,164,107,30,141,251,74,21,117,
+127,132,111,116,31,110,117,127,128,247,19,10,96,99,31,109,106,128,120,247,
+88,29,145,171,166,30,167,163,149,148,247,33,29,156,183,177,31,174,178,147,
+153,160,26,169,113,164,107,30,14,247,125,247,247,21,247,177,247,11,5,166,
+151,151,153,161,26,146,137,146,136,146,30,138,141,5,154,132,120,152,122,27,
+130,128,136,134,126,31,252,128,251,101,248,128,251,107,5,134,151,151,136,
+147,27,156,159,152,155,146,31,140,140,5,142,146,141,147,145,26,161,127,153,
+112,151,30,108,251,123,21,176,162,157,169,169,117,157,101,31,252,29,6,101,
+116,121,109,109,162,121,177,31,14,248,238,247,248,21,252,129,247,101,5,144,
+126,128,142,130,27,123,120,127,123,131,31,138,137,5,136,133,137,132,131,26,
+117,151,125,166,127,30,247,178,251,11,251,178,251,15,5,112,127,127,125,117,
+26,133,141,131,142,132,30,140,138,5,122,147,158,127,156,27,147,151,142,144,
+151,31,127,95,21,101,116,121,109,109,162,121,177,31,248,30,6,176,162,157,
+169,169,116,157,102,31,14,247,11,248,25,21,248,18,6,161,150,148,156,155,128,
+148,117,31,252,70,251,136,6,119,148,128,156,156,148,150,159,30,14,202,247,
+231,21,251,43,144,104,166,95,30,71,181,216,98,225,27,191,187,154,166,180,
+31,190,174,168,185,149,202,8,144,172,140,161,237,26,247,81,7,159,128,153,
+123,123,130,127,117,30,251,84,7,251,16,134,98,120,106,30,87,109,74,104,73,
+27,99,98,152,162,106,31,98,168,120,172,133,187,135,169,139,139,138,247,1,
+8,247,84,7,160,129,152,123,122,130,127,117,30,14,248,173,247,116,21,247,42,
+134,174,112,184,30,206,97,62,180,53,27,87,91,124,112,98,31,88,104,110,93,
+129,77,8,134,105,138,117,42,26,251,82,7,117,148,127,156,155,149,152,160,30,
+247,85,7,140,227,139,139,149,26,142,191,146,169,154,161,8,189,173,200,171,
+203,27,200,198,110,94,171,31,166,102,145,102,251,28,26,251,85,7,117,148,127,
+155,155,150,153,159,30,14,248,217,247,123,21,190,252,141,7,143,247,16,205,
+199,247,21,136,8,247,198,190,251,186,247,73,29,73,153,80,164,101,30,162,104,
+174,108,172,126,8,124,175,167,135,212,27,247,186,190,251,198,6,251,20,136,
+74,197,133,247,12,8,144,7,14,182,203,21,75,248,151,203,251,117,248,77,74,
+252,77,7,14,247,192,247,138,21,82,186,200,105,191,27,167,165,147,152,159,
+31,170,161,162,186,178,26,208,80,195,67,84,79,104,84,97,30,198,89,86,169,
+85,27,67,80,82,68,71,196,82,209,199,184,164,202,193,31,174,178,21,185,171,
+189,169,182,27,186,170,109,94,94,108,107,97,119,118,145,151,117,31,122,148,
+139,139,92,185,8,71,143,21,92,102,88,109,97,27,94,110,170,186,182,170,169,
+184,180,179,116,88,186,31,14,248,101,247,71,21,85,144,119,150,84,197,137,
+140,24,179,191,174,160,194,143,136,189,24,69,134,100,118,87,76,8,194,95,79,
+173,87,27,64,84,85,66,66,192,86,212,197,184,162,196,188,31,142,142,142,143,
+141,142,200,74,173,120,208,132,8,251,89,247,20,21,90,97,93,112,98,27,97,109,
+170,184,183,169,170,183,178,176,118,89,187,31,140,137,139,139,141,137,8,14,
+248,124,248,200,21,116,127,131,111,117,31,111,117,127,127,247,84,29,199,69,
+111,154,94,27,95,105,121,95,99,31,109,107,128,120,247,88,29,146,170,166,30,
+168,164,148,147,247,33,29,157,182,177,31,174,178,147,153,160,26,170,113,164,
+107,30,252,16,251,112,125,10,251,52,247,197,29,248,20,247,196,10,242,247,
+25,21,102,107,109,103,102,170,109,178,177,170,169,175,176,108,169,100,31,
+247,88,248,58,247,76,29,176,108,168,100,31,247,88,252,58,247,76,29,175,108,
+169,100,31,14,248,147,248,174,21,146,6,174,138,163,159,171,26,147,7,138,172,
+116,159,102,137,8,252,68,6,102,141,116,119,138,106,8,131,7,140,106,162,119,
+176,141,8,152,252,155,126,6,102,141,116,119,138,106,8,234,29,170,116,160,
+106,138,30,136,248,155,247,74,252,155,131,6,104,141,115,119,106,26,234,29,
+171,115,159,104,138,30,132,6,14,248,55,248,171,21,145,66,140,109,162,117,
+170,138,25,144,6,172,140,161,163,138,171,8,247,15,7,173,140,114,162,103,27,
+251,235,6,103,140,114,116,107,26,126,7,123,142,130,149,126,30,247,57,251,
+115,251,61,251,186,5,132,127,137,132,126,26,124,7,106,164,116,175,140,30,
+247,242,6,175,163,162,173,31,247,16,7,171,117,163,106,140,30,134,6,108,138,
+116,116,138,108,136,67,24,251,98,6,247,42,247,147,5,145,151,142,147,149,26,
+151,136,148,130,151,30,251,26,247,76,5,14,247,80,247,34,21,141,69,142,118,
+149,118,8,114,152,159,125,163,27,168,163,153,171,168,31,157,159,155,160,150,
+158,144,148,24,141,142,140,143,143,26,146,133,144,132,132,134,135,130,132,
+30,128,123,5,108,117,122,125,124,27,121,132,158,192,151,139,164,140,160,31,
+158,7,175,7,247,30,247,68,190,236,225,26,193,110,174,95,95,90,106,82,100,
+30,96,75,116,251,1,136,251,61,138,78,24,116,111,134,133,121,118,136,136,25,
+118,117,5,133,133,137,134,134,26,135,7,132,143,142,136,145,27,150,139,139,
+185,183,31,236,247,61,21,141,177,5,247,109,149,158,208,188,27,162,154,118,
+107,68,100,47,69,43,31,14,247,43,248,188,21,125,140,149,130,154,27,172,140,
+5,187,196,119,108,181,31,168,118,158,118,167,96,8,167,95,102,150,87,27,251,
+22,36,40,251,17,251,17,242,39,247,23,247,21,243,238,247,16,233,100,247,0,
+78,209,31,203,85,51,176,41,27,112,136,138,132,132,31,135,135,137,132,132,
+26,247,39,251,64,21,243,219,64,40,43,59,62,38,38,58,216,236,234,219,217,238,
+31,14,247,173,248,136,21,251,30,251,7,251,3,251,26,251,34,247,6,251,5,247,
+36,247,31,247,5,247,3,247,28,247,31,251,8,247,6,251,33,31,143,251,190,21,
+245,35,5,114,103,104,128,97,27,96,110,148,163,108,31,93,184,21,112,175,130,
+166,180,26,183,150,174,163,172,30,247,2,251,0,5,232,22,247,2,246,5,161,109,
+148,114,102,26,90,128,102,115,106,30,251,44,247,41,21,251,3,247,0,5,163,172,
+174,150,181,27,183,170,129,114,174,31,14,247,164,248,43,21,251,20,64,75,62,
+56,26,113,146,109,154,102,30,88,66,125,106,98,26,83,178,98,192,196,184,193,
+207,179,125,183,98,223,30,176,185,177,177,194,183,8,190,201,174,157,174,27,
+169,159,112,99,87,115,65,107,91,31,102,114,104,116,107,27,111,114,157,159,
+149,144,144,151,140,31,163,141,156,156,160,26,158,124,153,119,107,113,106,
+99,91,177,105,193,190,198,172,194,187,30,180,186,162,195,195,26,209,97,187,
+78,59,72,94,251,51,251,46,30,132,160,137,149,156,26,202,174,193,205,181,30,
+148,145,145,143,159,150,8,251,64,251,226,21,176,74,156,96,109,26,112,120,
+120,112,105,114,167,178,174,147,157,182,203,30,14,248,85,248,100,21,56,6,
+251,46,104,247,143,29,46,185,65,222,96,30,94,73,5,132,130,137,133,133,26,
+127,148,130,151,151,147,144,154,149,30,189,213,5,135,175,172,136,150,27,138,
+148,171,139,187,27,247,86,6,161,152,148,155,155,126,149,117,31,251,88,6,98,
+112,139,140,127,31,131,117,141,141,114,31,247,135,247,249,5,227,6,162,151,
+148,155,155,125,149,118,31,85,6,192,217,5,146,150,141,143,146,26,151,130,
+148,126,127,132,134,124,129,30,36,251,44,21,251,127,251,239,110,150,127,147,
+121,156,25,105,174,118,187,186,26,197,170,198,187,171,30,165,178,179,145,
+247,33,27,14,248,93,248,92,21,252,115,252,89,5,249,20,190,252,147,6,248,17,
+247,254,5,14,247,116,22,247,45,176,154,10,247,22,179,134,120,175,31,194,111,
+177,74,229,29,124,153,128,160,31,14,247,233,248,100,247,62,29,62,173,70,200,
+95,30,103,189,174,133,247,57,185,29,199,186,170,242,29,14,247,116,247,33,
+21,247,47,174,154,10,247,23,178,134,120,175,31,194,110,177,75,229,29,123,
+153,129,160,31,248,115,251,33,21,161,150,148,155,156,128,148,117,31,252,115,
+6,117,128,130,122,123,150,130,161,31,14,247,233,248,241,247,62,29,88,154,
+91,167,100,30,175,89,186,110,202,130,8,134,173,160,138,240,185,29,198,186,
+171,242,29,252,115,252,190,21,117,128,130,122,123,150,130,161,31,248,115,
+6,160,150,148,155,156,128,148,118,31,14,247,218,247,124,21,247,147,189,251,
+121,6,236,247,73,5,247,24,190,34,6,151,169,150,161,150,154,8,143,144,141,
+143,142,26,150,126,150,127,126,133,135,123,131,30,96,58,5,251,26,247,73,29,
+251,16,183,59,230,99,30,110,85,5,135,131,137,133,134,26,127,151,128,152,151,
+146,144,154,147,30,172,202,5,135,172,143,139,184,27,247,186,190,251,198,6,
+115,132,139,141,126,31,178,247,71,21,49,251,60,74,161,104,195,135,224,25,
+144,7,247,210,247,123,21,42,251,73,5,251,113,144,6,145,247,12,204,198,247,
+20,136,8,14,247,213,4,223,210,5,248,242,195,252,176,6,247,0,29,248,176,195,
+252,242,6,14,248,235,247,213,21,55,69,5,252,242,83,248,176,239,29,252,176,
+83,248,242,6,14,222,248,84,21,247,0,29,248,70,239,29,252,136,83,21,248,202,
+6,222,69,56,68,5,252,202,6,55,210,5,14,167,251,175,247,75,10,121,148,123,
+162,10,252,180,247,47,21,112,131,138,132,128,31,122,129,128,121,247,196,29,
+148,150,158,158,26,157,130,155,124,150,247,55,10,14,247,80,249,108,247,75,
+10,122,148,122,162,10,14,248,102,248,107,21,142,144,141,148,143,26,152,127,
+150,125,127,134,135,123,131,30,100,66,5,149,104,123,142,112,27,251,25,36,
+41,251,18,63,173,76,206,92,31,103,72,5,136,134,137,130,135,26,126,151,128,
+153,151,144,143,155,147,30,175,205,5,126,176,156,136,169,27,247,25,242,237,
+247,19,217,102,204,69,185,31,115,94,21,191,103,166,90,80,26,41,59,63,35,119,
+126,141,147,112,30,93,162,21,89,179,116,183,196,26,236,219,215,242,158,150,
+137,134,163,30,14,247,178,248,138,117,29,247,187,248,152,117,29,14,247,94,
+10,14,247,94,10,247,115,251,111,21,251,48,247,45,247,48,6,14,207,142,21,248,
+102,236,252,2,247,245,39,6,14,247,181,202,29,14,247,95,202,29,247,96,22,228,
+247,88,5,151,165,142,149,247,35,29,14,209,22,248,97,247,203,6,251,123,247,
+146,251,122,251,146,5,189,251,153,21,247,133,7,247,72,247,90,247,73,251,90,
+5,251,133,7,14,247,159,239,21,134,141,105,154,128,145,125,150,25,100,171,
+115,206,214,26,247,10,195,203,243,243,195,76,251,11,54,110,70,90,109,30,128,
+132,128,133,112,128,8,39,247,95,7,165,148,140,146,150,31,156,149,150,158,
+157,26,156,130,156,124,149,30,148,127,129,141,112,27,94,6,200,172,174,213,
+235,26,217,110,215,93,182,30,182,93,59,165,52,27,52,59,113,96,93,31,93,96,
+110,63,61,26,43,174,65,200,106,30,94,6,114,130,247,144,10,122,148,122,154,
+128,30,131,151,149,137,167,27,247,95,6,14,247,150,247,156,21,251,6,97,180,
+68,231,219,118,251,13,5,227,6,118,247,13,231,59,180,210,251,6,181,247,6,180,
+98,210,47,59,160,247,13,5,51,6,160,251,13,47,219,98,68,5,14,159,247,123,21,
+248,141,134,6,133,251,12,74,81,251,20,142,8,251,198,88,247,186,6,247,1,181,
+152,188,187,31,186,187,160,201,228,26,233,109,209,78,186,30,172,97,101,148,
+43,27,251,186,88,247,198,6,247,19,142,204,82,146,251,11,8,136,7,134,252,141,
+7,14,248,113,247,84,21,138,207,135,168,125,170,8,204,110,70,178,54,27,251,
+20,59,55,251,26,251,26,216,60,247,21,235,206,180,215,165,31,140,142,141,143,
+5,94,6,138,137,139,138,136,135,8,90,114,90,112,74,27,65,105,161,200,119,31,
+214,7,247,150,180,21,251,148,211,6,197,169,171,160,200,27,203,189,109,90,
+158,31,14,248,177,247,152,21,252,88,247,46,5,251,200,7,14,197,247,152,21,
+248,88,251,46,5,247,200,7,14,247,216,248,113,21,161,112,162,119,162,126,200,
+106,150,132,144,130,8,146,127,143,120,116,26,251,137,7,146,121,113,144,118,
+27,63,72,83,76,102,170,116,189,195,192,163,180,172,31,162,167,146,162,142,
+190,8,248,20,7,140,216,103,216,89,169,52,193,24,128,148,5,125,154,132,158,
+163,26,153,91,252,155,7,146,121,115,143,118,27,65,73,83,76,102,170,116,187,
+194,191,163,180,172,31,161,167,146,162,142,191,8,247,44,247,64,21,251,13,
+202,112,179,136,247,13,142,137,24,247,13,76,165,100,144,251,14,8,14,68,10,
+74,29,247,253,80,10,248,185,22,251,6,248,200,5,251,8,6,251,255,252,200,5,
+248,98,243,21,251,161,6,247,97,247,210,5,14,57,10,247,78,97,29,49,10,247,
+198,247,203,21,142,151,140,152,5,155,127,149,120,116,122,125,116,134,30,117,
+39,5,138,134,138,134,136,247,119,29,143,155,5,247,18,6,136,125,5,138,135,
+139,135,134,247,119,29,161,239,5,140,142,139,143,145,26,155,127,149,120,116,
+123,125,116,134,30,135,125,5,134,247,159,21,55,45,96,70,70,31,70,71,99,45,
+48,26,251,20,235,41,247,19,247,78,247,65,247,68,247,79,247,24,43,235,251,
+22,30,118,36,21,218,196,78,55,251,13,251,2,251,11,251,3,57,82,199,225,247,
+14,247,2,247,9,247,6,31,14,43,10,247,87,89,10,151,142,150,154,109,10,154,
+143,150,152,158,29,130,133,139,119,27,109,6,14,247,243,248,58,21,204,251,
+210,238,10,121,158,113,247,100,29,251,108,247,26,10,195,6,251,122,251,249,
+5,114,128,137,134,128,31,118,128,125,117,117,26,110,247,12,29,14,60,10,247,
+104,248,3,86,10,154,151,149,182,29,14,248,134,248,96,21,129,95,5,135,122,
+138,132,134,26,117,158,122,165,174,163,162,182,148,30,173,247,42,5,252,135,
+6,106,251,40,5,137,127,137,128,134,26,116,158,122,165,173,163,162,182,148,
+30,149,185,5,247,28,251,118,21,107,138,151,125,165,27,174,158,160,188,150,
+31,149,185,5,142,151,141,152,149,26,163,125,152,115,112,121,125,107,126,30,
+51,141,6,141,7,142,7,164,126,153,115,105,118,116,92,129,30,129,93,5,134,119,
+138,131,131,26,117,153,125,164,166,157,153,171,152,30,251,17,251,22,21,148,
+183,5,142,153,141,149,247,96,10,106,251,42,5,248,135,6,171,247,40,5,143,154,
+140,148,247,96,10,129,93,5,14,248,17,247,201,29,87,10,80,29,249,47,248,200,
+21,252,75,6,120,53,247,18,251,81,251,105,251,90,119,48,5,248,81,6,174,247,
+50,5,141,146,140,147,146,26,160,124,152,115,106,121,123,101,128,30,123,82,
+5,251,104,6,247,97,247,78,251,8,247,68,5,247,87,6,129,71,5,138,132,139,139,
+128,26,115,153,126,165,172,158,157,175,148,30,14,77,10,247,252,247,127,193,
+29,118,27,47,247,202,10,248,107,248,173,21,152,6,167,145,140,148,152,31,150,
+147,146,151,150,26,161,125,147,102,30,251,23,6,97,116,124,113,118,154,130,
+175,31,149,6,134,118,61,130,86,120,86,101,25,63,84,90,53,59,26,32,218,65,
+247,16,130,30,134,119,5,128,6,127,6,110,115,120,117,118,155,130,174,31,247,
+23,6,167,145,140,148,151,31,151,147,146,150,151,26,161,125,147,102,30,127,
+6,144,159,5,247,61,146,247,35,247,25,247,42,26,206,97,205,78,168,30,109,153,
+109,146,96,143,8,251,87,252,27,21,71,145,95,185,204,26,233,218,221,239,150,
+30,247,1,22,213,132,181,97,71,26,45,56,55,38,131,30,14,55,29,247,148,247,
+139,21,94,145,118,159,177,26,154,143,168,147,172,30,178,247,68,5,46,6,87,
+108,116,100,113,153,126,170,137,31,123,69,5,132,107,134,105,119,26,57,193,
+83,236,116,30,130,99,5,95,137,110,114,104,26,110,158,126,181,30,227,6,190,
+170,162,176,167,124,152,104,141,31,148,179,5,200,191,155,168,178,31,199,190,
+145,151,170,247,29,155,212,24,180,142,166,163,173,26,167,118,153,98,30,48,
+6,100,251,65,113,33,118,112,69,128,25,186,247,105,5,185,142,165,162,177,26,
+170,121,148,80,30,84,6,100,122,136,132,126,31,122,128,127,118,119,26,112,
+154,127,174,137,30,14,247,175,233,21,116,150,135,141,130,145,8,104,162,122,
+178,197,26,205,161,210,173,188,30,190,177,192,165,208,27,225,182,98,58,60,
+104,48,88,86,31,115,114,120,129,86,117,117,45,24,247,92,6,170,150,247,55,
+29,157,155,26,168,121,152,97,30,79,6,193,163,162,159,170,188,8,174,195,159,
+206,202,26,208,116,193,97,168,30,167,98,77,155,74,27,251,0,42,101,75,83,31,
+83,75,105,51,56,26,89,153,98,164,114,30,145,133,148,132,156,130,8,76,6,108,
+247,131,10,124,127,247,126,29,182,30,247,90,6,14,248,163,247,227,21,205,113,
+84,175,65,27,251,45,251,32,251,22,251,33,251,3,216,69,247,13,223,196,167,
+204,185,31,145,77,5,122,140,155,127,160,27,174,164,163,172,31,143,7,121,247,
+56,247,2,247,44,5,148,151,143,150,149,26,161,121,154,112,119,129,133,118,
+123,30,251,24,251,87,21,50,91,94,104,74,27,77,98,178,197,216,216,211,222,
+171,167,126,118,155,31,154,118,144,120,144,91,8,14,247,67,154,21,119,171,
+178,129,184,27,205,193,162,187,184,31,178,181,161,192,194,26,205,116,179,
+85,167,30,195,174,166,182,193,26,218,77,191,46,77,84,115,94,99,30,110,106,
+123,98,118,45,251,16,252,194,24,247,0,6,247,27,248,112,21,152,6,155,138,5,
+217,138,177,115,89,26,73,93,86,81,93,103,152,165,117,30,196,247,149,5,236,
+160,161,166,196,27,173,158,122,107,107,117,108,103,119,31,118,128,122,135,
+106,138,8,14,247,169,247,35,21,66,247,174,5,77,6,88,107,115,101,109,154,129,
+184,138,31,220,251,208,5,108,86,126,98,92,26,92,162,110,177,198,166,200,247,
+37,145,30,247,77,247,181,5,158,151,156,158,144,27,140,6,138,142,139,143,138,
+30,141,6,138,141,141,139,142,27,167,163,163,166,173,113,160,97,83,105,112,
+52,83,31,14,247,231,248,65,21,77,127,98,121,96,107,8,69,88,96,63,69,26,251,
+2,226,64,247,22,229,231,177,201,198,30,186,189,167,201,194,26,200,112,183,
+67,196,30,251,3,226,125,153,157,26,164,162,150,192,30,217,6,178,164,161,172,
+160,124,149,107,31,77,6,72,89,128,117,104,31,100,115,110,95,104,26,115,152,
+117,172,109,30,190,39,21,217,190,98,75,60,52,68,40,63,88,180,201,217,228,
+213,234,31,14,248,88,247,162,21,137,117,127,138,117,27,85,102,155,162,159,
+174,154,185,157,165,137,135,156,31,135,161,140,139,146,27,168,165,165,167,
+153,132,150,125,146,31,150,116,92,148,100,27,251,6,47,76,62,115,148,124,170,
+108,31,75,110,100,89,87,26,72,206,95,240,189,213,155,155,168,30,157,149,150,
+160,161,26,158,124,154,121,132,129,138,137,129,30,129,92,118,136,110,27,91,
+107,154,161,167,199,163,210,158,155,138,137,157,31,14,247,250,248,135,21,
+85,96,86,85,97,85,8,80,63,114,80,75,26,95,153,98,164,110,30,162,113,172,121,
+212,115,161,132,139,139,142,138,8,153,133,146,131,127,26,116,118,127,90,134,
+30,96,135,117,117,100,26,113,160,126,179,246,214,199,225,175,124,172,114,
+162,30,124,153,114,150,94,154,8,64,164,125,152,180,26,200,184,210,240,236,
+30,188,187,191,181,184,169,148,145,24,161,241,5,251,112,6,89,107,114,99,113,
+159,126,180,31,14,81,10,14,248,7,248,239,21,44,54,81,41,89,31,103,69,116,
+43,62,26,68,157,86,177,100,30,102,174,185,120,192,27,218,219,184,211,187,
+31,188,212,171,247,6,239,26,247,20,63,225,251,5,30,251,45,251,150,21,238,
+169,193,194,208,27,192,167,100,65,127,138,131,137,118,31,115,35,21,40,107,
+85,85,71,27,86,111,178,210,153,140,147,141,160,31,14,114,10,14,247,156,247,
+214,21,180,144,164,161,172,26,170,122,151,95,30,38,6,89,107,114,101,111,158,
+126,181,31,144,6,91,251,109,5,90,137,110,116,102,26,110,157,126,182,30,247,
+5,6,189,171,163,176,169,121,152,96,31,132,6,154,205,197,138,181,89,173,251,
+1,25,135,140,136,140,136,30,218,6,189,171,162,177,169,121,152,96,31,117,6,
+124,180,112,181,106,168,247,41,244,24,188,140,170,162,176,26,169,121,152,
+96,30,80,6,251,120,251,58,5,14,205,242,21,96,138,108,115,105,26,109,158,125,
+181,30,240,6,189,171,163,176,163,127,152,112,144,31,247,15,247,59,200,251,
+59,5,100,133,115,116,107,26,109,156,127,184,30,231,6,189,171,162,176,169,
+122,152,97,31,251,71,248,136,5,38,247,141,29,184,6,177,251,0,5,14,247,49,
+137,21,129,162,157,135,165,27,184,181,149,163,190,31,135,121,5,238,6,190,
+170,162,178,166,122,152,106,140,31,211,247,214,5,251,32,6,87,108,116,100,
+110,158,126,182,31,168,6,98,251,75,5,103,70,92,124,94,27,114,122,150,155,
+144,141,148,141,151,31,203,247,177,5,251,14,6,88,109,116,100,110,158,126,
+181,31,149,6,39,252,84,5,136,126,138,129,133,26,116,158,122,164,174,163,162,
+183,148,30,14,247,127,248,61,21,40,6,98,109,114,106,115,158,124,171,31,162,
+6,238,251,226,5,217,6,171,164,150,148,178,173,8,247,19,247,4,190,217,219,
+26,169,132,170,127,160,30,154,130,126,147,120,27,106,106,110,108,134,139,
+136,140,135,31,147,109,140,136,123,26,82,96,77,44,60,30,14,248,72,247,132,
+21,162,247,0,135,140,5,134,6,132,140,136,139,131,140,8,55,148,112,154,174,
+26,163,154,164,162,155,30,156,150,165,146,173,142,171,141,152,141,150,142,
+8,163,148,158,163,164,26,168,121,152,96,30,251,92,6,90,106,115,104,110,159,
+125,183,137,31,108,109,127,113,101,26,103,153,106,165,112,30,46,95,98,80,
+52,26,87,159,97,178,112,30,162,123,176,126,205,123,8,165,133,145,134,127,
+26,116,121,130,87,134,30,97,135,116,116,101,26,114,160,125,179,247,3,210,
+197,229,202,109,169,55,162,30,48,163,127,148,177,26,209,214,182,247,19,142,
+30,14,119,29,247,177,247,214,21,247,63,247,89,29,137,6,107,128,136,126,124,
+31,123,127,130,122,123,26,108,157,127,183,30,247,4,6,170,147,141,152,156,
+31,155,152,148,156,155,26,151,134,150,129,148,30,148,129,132,141,111,27,137,
+6,188,247,110,5,148,6,169,150,142,151,155,247,56,10,168,121,152,97,30,252,
+39,6,109,128,247,27,10,109,156,127,182,30,146,247,89,29,136,6,107,131,136,
+126,123,31,122,247,71,29,146,137,167,27,247,4,6,172,149,142,151,155,247,56,
+10,169,121,152,96,30,138,6,14,247,48,168,21,109,180,180,125,186,27,203,202,
+166,190,191,31,193,192,166,200,209,26,247,5,60,216,251,9,67,63,107,88,90,
+30,104,103,114,83,122,60,72,251,203,24,134,113,137,129,131,26,114,156,125,
+168,159,157,147,154,153,30,146,147,142,148,147,174,8,247,124,248,105,21,194,
+171,108,84,59,64,61,61,86,99,180,193,218,213,209,224,31,14,248,72,248,73,
+21,251,7,69,119,89,75,31,74,89,97,61,69,26,251,2,224,65,247,18,227,229,177,
+201,197,30,185,189,166,198,192,26,171,131,166,122,167,30,186,173,10,251,168,
+36,21,214,188,100,78,62,54,70,45,66,90,179,199,215,224,209,231,31,14,248,
+53,247,215,21,215,6,173,146,141,151,155,31,155,152,148,156,156,26,161,126,
+153,117,142,30,142,117,138,139,137,27,251,159,6,107,130,136,127,123,31,123,
+126,130,123,122,247,57,10,221,6,85,251,137,5,137,132,139,135,129,26,95,172,
+116,200,217,194,171,184,159,127,153,123,131,129,137,135,129,30,130,116,128,
+137,126,27,132,136,141,144,142,139,142,140,143,31,14,139,10,142,154,146,171,
+138,10,14,247,191,124,21,204,146,187,153,177,164,8,209,184,185,224,224,26,
+246,64,223,45,104,104,125,114,114,30,120,121,128,114,128,94,90,251,111,24,
+94,151,118,168,188,26,201,163,186,199,193,30,160,159,147,152,158,26,164,122,
+155,111,99,99,112,85,101,30,100,84,120,83,78,26,42,196,65,233,114,30,111,
+251,23,5,137,130,137,126,133,26,115,157,123,167,174,163,162,182,148,30,239,
+248,86,21,158,143,148,148,152,27,172,167,99,92,60,88,82,55,120,31,14,247,
+190,247,120,21,57,247,89,5,76,6,89,107,116,101,109,156,126,183,31,149,6,216,
+251,79,251,98,251,138,5,121,117,131,122,122,26,114,160,121,167,161,159,151,
+163,159,30,247,60,247,92,231,251,113,5,203,6,189,170,162,177,169,121,152,
+96,31,128,6,53,247,103,247,77,247,112,5,156,159,148,158,155,26,164,118,157,
+109,115,127,132,111,115,30,14,247,63,251,20,21,134,120,137,124,130,26,115,
+157,123,167,158,157,147,154,153,30,146,147,144,153,146,169,166,247,12,24,
+247,32,143,186,180,164,247,30,173,247,47,24,185,142,165,162,173,26,170,121,
+151,96,30,41,6,78,251,166,128,91,125,127,89,136,25,236,248,68,5,144,162,141,
+152,147,26,164,122,153,111,119,121,131,123,125,30,131,131,136,129,131,106,
+40,252,79,24,103,140,124,148,159,26,147,141,154,145,163,30,198,247,155,5,
+38,6,89,107,115,103,111,154,125,173,138,31,107,251,38,5,133,110,136,118,124,
+26,105,154,106,167,114,30,161,119,163,130,186,132,8,14,247,170,175,21,104,
+165,170,123,179,27,246,213,247,2,247,50,82,10,92,152,105,166,112,30,116,163,
+173,125,171,27,176,172,154,175,179,31,14,248,183,247,195,21,145,168,5,147,
+172,141,149,151,26,167,116,161,109,118,124,131,122,128,30,156,110,103,147,
+94,27,57,68,109,81,86,31,90,86,110,67,71,26,40,189,80,247,5,104,30,193,123,
+143,136,127,26,121,113,122,105,136,30,119,137,135,138,129,136,8,114,130,124,
+119,112,26,109,158,126,180,242,218,201,221,199,107,174,57,166,30,54,168,121,
+156,192,26,243,215,222,234,183,177,119,115,137,139,136,138,134,30,138,135,
+139,134,134,26,107,161,117,173,171,153,155,188,148,30,14,247,231,247,101,
+21,130,95,126,112,121,122,8,116,114,104,125,105,27,91,100,161,167,145,140,
+146,141,147,31,190,247,121,5,251,13,247,142,29,121,123,26,109,156,128,182,
+138,30,151,6,110,251,20,5,136,124,137,125,124,26,107,153,107,162,118,30,113,
+169,180,128,204,27,213,192,154,173,186,31,190,177,160,177,159,227,174,247,
+50,24,181,149,150,144,204,175,123,227,24,130,134,128,134,128,134,130,134,
+131,136,25,121,130,138,139,120,132,8,145,200,142,177,155,26,196,111,199,96,
+175,30,167,106,101,152,93,27,251,20,45,55,251,6,68,177,75,202,103,31,188,
+110,177,129,226,132,8,147,218,21,59,148,109,147,106,162,8,114,157,124,168,
+173,26,203,181,189,194,197,173,94,63,106,137,101,135,96,30,14,247,251,177,
+21,247,62,147,247,35,247,26,247,42,26,242,53,217,251,12,145,30,146,170,5,
+140,145,140,146,143,26,165,122,156,113,108,111,115,105,131,30,132,106,5,251,
+63,128,251,30,251,21,251,40,26,251,0,218,65,247,15,131,30,132,107,5,138,134,
+139,139,130,26,112,157,121,166,169,165,162,174,147,30,57,247,11,21,71,145,
+95,184,205,26,233,218,221,240,150,30,247,0,22,213,132,181,96,72,26,45,56,
+55,39,130,30,14,248,228,247,252,21,174,168,166,171,164,123,153,111,31,251,
+238,6,66,92,116,75,80,31,129,128,133,126,127,26,122,150,127,155,149,147,142,
+147,149,30,142,142,150,147,151,148,8,91,68,113,58,62,26,63,182,92,209,186,
+173,157,183,177,30,96,157,166,120,183,27,189,189,164,181,175,31,178,186,168,
+232,217,26,174,135,163,128,170,30,251,49,22,189,101,149,122,89,26,48,107,
+64,101,121,128,158,169,155,141,159,142,159,30,144,162,139,143,147,26,166,
+124,153,110,105,118,121,101,129,30,124,86,130,116,127,121,8,119,126,123,128,
+125,27,122,130,152,163,197,163,211,173,181,31,152,156,163,156,185,167,8,14,
+247,164,248,228,21,105,108,110,106,115,242,10,158,121,164,174,170,169,171,
+164,121,156,112,31,251,153,252,103,21,134,116,137,124,126,26,86,182,103,204,
+198,181,168,180,164,120,158,115,132,131,137,135,129,247,152,10,147,141,139,
+139,141,149,31,194,247,147,5,141,148,141,153,146,26,162,247,124,29,54,10,
+251,105,248,45,150,29,248,99,248,201,247,28,29,123,130,222,29,154,30,14,248,
+98,100,29,14,248,40,247,43,21,147,92,238,10,120,159,114,138,247,100,29,251,
+72,247,26,10,159,6,251,122,251,248,115,138,128,138,128,134,25,118,128,124,
+116,118,26,109,247,12,29,170,186,5,247,102,242,21,251,36,6,247,1,247,60,5,
+251,96,234,21,141,149,139,139,247,32,29,137,132,139,136,247,143,10,144,30,
+14,208,248,153,21,141,150,139,139,143,26,160,247,72,29,138,135,138,132,133,
+26,121,149,128,157,157,151,152,164,144,30,247,74,251,28,21,216,6,138,137,
+5,135,120,139,138,131,247,22,10,164,247,0,24,142,155,140,144,212,10,122,122,
+131,126,126,30,128,128,136,132,133,111,138,135,24,62,247,58,29,247,118,6,
+129,96,5,136,123,138,134,131,26,116,159,122,163,156,247,119,10,172,247,40,
+24,252,89,113,29,149,6,60,251,250,5,127,132,10,248,109,6,173,247,40,5,142,
+153,140,147,146,26,162,120,156,114,103,247,122,10,14,219,248,153,21,141,147,
+139,141,247,32,29,138,134,138,134,247,143,10,145,30,247,254,251,30,50,10,
+14,248,80,248,96,21,234,247,137,29,251,188,247,26,10,232,247,89,10,44,247,
+141,29,247,189,247,137,29,46,6,251,109,248,49,107,10,248,40,248,214,21,60,
+70,103,66,76,31,81,70,106,49,44,26,251,32,216,50,247,14,233,225,192,237,202,
+30,178,201,160,213,216,26,247,31,60,228,251,13,30,35,4,197,173,95,63,68,119,
+78,98,85,31,87,99,94,113,91,27,80,106,183,219,206,159,200,180,192,31,192,
+180,182,165,188,27,251,158,182,107,10,247,53,236,21,142,7,142,7,154,129,149,
+125,117,129,124,94,129,30,124,71,5,247,88,6,174,247,56,127,143,131,141,136,
+141,25,96,156,118,175,196,26,242,211,228,222,199,178,90,65,52,90,68,61,113,
+30,132,136,104,251,56,5,247,108,6,153,205,5,141,149,141,152,148,26,159,130,
+149,123,122,128,129,118,133,30,102,6,228,196,189,230,244,26,247,26,53,233,
+251,13,65,77,109,78,87,30,91,82,112,66,65,26,56,169,78,200,97,30,67,248,56,
+107,10,196,248,153,170,10,247,229,251,25,214,29,130,133,140,118,27,47,6,106,
+129,232,29,122,123,26,119,147,127,159,131,30,251,7,251,14,77,247,13,5,171,
+151,156,160,166,26,156,128,155,125,143,30,142,130,133,140,118,27,50,6,106,
+129,136,127,247,83,29,110,156,126,178,30,247,5,251,116,109,251,26,5,77,72,
+10,247,123,206,10,247,111,29,78,6,14,120,29,106,163,10,120,156,113,31,14,
+247,252,247,128,21,247,101,247,117,5,160,148,141,143,150,31,162,149,154,161,
+162,26,168,120,152,97,30,47,6,114,124,136,132,127,31,121,128,127,119,119,
+26,122,147,127,158,129,30,251,3,251,12,81,247,11,5,172,153,154,158,165,26,
+168,121,152,96,30,50,6,88,140,108,115,101,26,111,156,126,177,138,30,247,2,
+251,116,109,251,25,5,77,174,10,247,122,6,191,170,162,178,168,120,152,96,31,
+80,6,94,163,10,121,156,112,31,14,248,111,247,79,21,228,247,31,5,158,170,147,
+157,156,26,167,121,156,108,109,129,131,84,105,30,107,88,5,219,102,91,173,
+65,27,251,17,251,5,251,18,251,31,251,1,213,61,240,203,202,170,195,187,31,
+150,67,5,199,6,189,171,163,175,166,124,153,106,141,31,251,24,244,21,112,101,
+132,131,123,122,8,99,101,111,123,108,27,99,111,172,188,221,204,219,204,179,
+159,109,44,164,31,210,247,249,236,29,120,127,130,126,126,247,82,10,248,38,
+247,161,21,101,6,63,95,151,160,158,175,152,192,189,155,131,108,156,31,107,
+155,152,129,164,27,168,157,157,175,146,31,142,160,141,147,145,157,8,144,157,
+141,149,148,26,166,117,158,108,118,126,133,123,127,30,155,106,107,145,93,
+27,251,11,62,87,58,116,144,121,154,116,31,79,106,113,101,88,26,60,213,85,
+247,1,195,209,150,154,177,30,177,153,155,157,166,26,167,117,162,112,129,125,
+136,133,119,30,120,76,116,135,102,27,95,106,153,156,165,204,164,207,156,163,
+138,138,153,31,143,6,142,6,145,138,5,247,0,248,33,21,157,150,147,152,247,
+132,10,124,129,129,206,29,81,10,247,117,247,57,200,29,124,150,128,155,148,
+169,10,114,10,247,64,247,88,21,157,151,148,193,10,169,10,247,243,248,73,21,
+62,50,105,87,82,31,83,87,103,66,77,26,35,229,64,247,19,247,57,247,37,247,
+16,247,33,247,0,50,218,251,15,30,118,35,21,211,190,95,78,67,53,72,46,67,84,
+181,194,169,155,171,168,167,31,178,179,183,157,193,27,247,25,247,124,247,
+28,29,123,130,128,206,29,247,169,167,21,110,166,170,125,177,27,247,1,213,
+247,1,247,51,82,10,54,193,79,216,175,171,152,169,179,30,247,102,248,173,247,
+28,29,124,129,129,135,130,125,30,251,18,56,5,121,127,130,127,125,26,124,150,
+128,155,148,169,10,54,10,130,248,18,104,29,248,66,100,29,251,210,252,83,21,
+135,119,137,123,124,26,85,181,104,203,198,181,168,180,164,121,158,115,131,
+131,247,31,29,142,141,146,31,194,247,147,247,125,10,163,247,124,29,54,10,
+110,248,18,21,157,151,148,151,247,132,10,123,130,129,135,130,126,30,251,19,
+56,5,121,128,130,126,125,26,123,150,129,155,148,148,143,148,154,30,251,16,
+230,21,104,108,110,106,115,157,121,166,173,195,29,14,68,10,248,243,248,200,
+21,252,122,6,102,107,111,105,112,160,124,180,31,175,247,89,10,128,209,29,
+247,180,6,247,34,235,213,247,0,193,119,177,97,164,31,162,99,86,151,80,27,
+251,14,6,169,247,18,5,247,110,6,126,90,5,137,130,137,127,131,26,116,158,122,
+165,173,161,161,183,150,30,252,28,251,196,21,167,247,18,5,247,18,6,219,180,
+118,96,98,102,118,64,31,14,74,29,247,207,80,10,248,52,22,134,103,5,137,122,
+138,126,134,26,109,161,118,170,171,150,153,195,152,30,153,201,5,145,164,141,
+150,147,26,171,117,156,96,140,30,219,247,248,5,195,141,226,29,251,216,247,
+58,10,102,162,123,195,31,99,251,70,112,251,13,93,86,58,135,25,115,6,107,251,
+27,5,135,119,136,123,132,26,112,162,118,169,168,153,154,190,153,30,155,195,
+5,247,132,248,96,21,247,16,247,89,10,251,48,6,165,166,166,205,157,215,8,14,
+57,10,247,109,243,21,247,1,29,154,105,147,247,64,29,140,132,139,139,142,128,
+25,135,140,136,140,137,30,105,147,158,128,188,27,183,163,158,173,167,122,
+155,105,145,31,107,247,30,133,163,128,159,120,156,25,153,146,191,202,177,
+194,192,10,108,251,61,181,29,247,8,130,162,247,7,10,135,123,136,123,130,26,
+114,161,119,167,163,151,150,170,152,30,148,92,154,102,163,106,110,125,117,
+120,121,113,33,251,44,24,96,137,118,123,230,10,14,247,173,247,235,21,135,
+10,112,163,113,190,109,31,104,199,201,124,220,27,241,206,158,183,191,31,184,
+178,165,190,191,143,10,101,117,95,8,125,110,134,126,198,29,14,52,29,14,65,
+10,14,248,191,248,96,21,195,141,160,153,176,26,176,116,153,75,30,251,215,
+247,58,10,104,164,121,187,31,144,6,83,251,144,121,64,114,101,103,134,25,144,
+159,141,148,147,26,169,119,155,103,105,125,123,88,127,30,125,81,5,137,129,
+138,133,135,26,117,193,118,197,240,207,212,247,33,171,30,197,247,153,5,247,
+15,6,60,251,249,5,84,118,124,103,100,162,126,203,31,216,6,202,163,153,176,
+173,117,156,96,140,31,14,60,10,49,10,248,17,247,201,29,87,10,80,29,45,10,
+14,77,10,83,10,14,248,48,248,105,21,162,6,186,167,161,175,166,123,149,96,
+31,251,37,6,89,111,120,103,112,157,126,176,31,159,6,133,112,5,104,6,63,83,
+121,104,100,31,103,106,118,91,88,26,53,196,92,242,30,171,6,133,110,5,116,
+6,94,109,117,105,113,157,126,177,31,247,45,6,184,170,162,172,165,121,152,
+103,31,115,6,145,168,5,162,6,219,198,158,178,179,31,177,175,160,190,192,26,
+220,87,178,34,30,106,6,251,21,40,21,110,251,13,5,121,6,80,110,157,175,181,
+179,164,207,31,247,27,22,162,6,193,165,125,110,117,124,114,116,125,31,127,
+121,114,134,95,27,132,6,14,55,29,248,64,22,130,90,5,136,128,138,126,131,26,
+113,156,124,168,173,160,160,185,149,30,177,247,51,5,41,6,218,247,249,96,29,
+14,247,252,243,21,126,29,5,96,68,93,122,97,27,112,126,148,157,150,142,160,
+142,152,31,167,10,68,197,89,221,187,183,150,164,188,30,14,248,135,243,21,
+216,247,248,5,162,6,177,170,168,172,167,118,153,99,31,251,10,6,40,252,96,
+5,64,6,218,247,249,217,29,60,251,249,5,63,6,238,248,96,5,251,6,6,88,108,116,
+101,108,153,129,187,138,31,66,251,249,247,195,10,247,99,242,21,63,6,238,248,
+97,5,251,6,6,88,108,116,101,108,153,129,187,137,31,66,251,248,183,10,248,
+90,6,126,86,5,137,129,138,129,130,26,113,156,125,170,180,162,167,198,147,
+30,158,247,30,5,41,6,217,247,249,5,162,6,176,171,168,172,166,118,154,99,31,
+251,9,6,39,252,97,5,64,6,218,247,250,217,29,14,247,160,248,96,21,188,6,176,
+171,168,172,167,118,153,99,31,251,45,209,29,148,247,89,10,128,209,29,247,
+170,6,247,45,232,210,247,9,175,127,171,117,163,31,172,108,67,160,54,27,251,
+4,6,90,251,122,21,167,247,18,5,247,7,6,235,173,123,95,92,104,120,54,31,14,
+247,101,248,96,21,187,6,175,171,168,172,167,118,153,99,31,251,43,247,93,29,
+59,251,248,5,93,137,115,120,102,26,108,157,124,177,30,247,35,6,247,27,227,
+212,247,4,234,71,193,251,12,31,133,6,90,251,122,21,167,247,19,5,149,6,206,
+166,122,96,94,107,117,75,31,247,129,138,21,100,136,116,115,104,26,112,160,
+125,178,30,228,6,191,170,162,177,170,124,150,92,140,31,218,247,249,5,176,
+145,158,159,171,26,170,120,153,97,30,48,6,86,110,117,101,109,159,125,180,
+31,148,6,14,247,21,248,96,21,247,17,6,60,251,248,5,128,6,89,107,116,102,109,
+159,125,180,31,247,116,6,204,203,157,169,181,31,179,168,165,194,192,26,238,
+67,189,251,34,30,82,6,168,247,18,5,189,247,139,29,252,11,6,97,251,78,5,136,
+125,247,61,10,247,66,251,163,21,167,247,18,5,200,6,226,173,122,95,96,102,
+117,64,31,14,247,188,247,220,21,99,117,121,105,105,160,121,180,31,247,28,
+6,47,96,80,97,50,27,90,94,155,173,89,31,155,115,125,145,124,27,113,113,114,
+114,112,165,111,188,111,31,109,194,190,126,202,27,240,217,173,212,202,31,
+197,206,170,225,231,26,247,37,55,234,251,22,92,105,130,115,99,30,140,144,
+139,141,142,26,171,120,157,105,106,125,122,92,133,30,135,98,129,104,121,99,
+8,125,109,135,126,128,26,117,162,118,164,161,155,152,170,155,30,210,178,186,
+170,209,27,178,172,126,116,159,31,157,119,146,109,142,79,8,14,247,104,247,
+122,21,138,122,139,136,134,26,251,27,206,55,247,0,217,199,177,222,190,30,
+186,214,163,225,228,26,247,33,76,219,251,3,58,80,101,54,86,30,113,98,123,
+100,130,98,8,92,6,167,247,18,5,193,142,167,159,176,26,169,119,153,98,30,50,
+6,89,107,115,103,113,152,126,168,135,31,59,251,250,5,95,138,110,114,105,26,
+110,160,125,179,30,247,1,6,189,247,157,29,167,247,19,5,247,194,247,137,21,
+191,165,96,52,251,30,76,251,9,64,85,112,182,224,247,40,199,247,1,220,31,14,
+248,166,248,96,21,195,141,160,153,175,26,177,116,153,75,30,251,49,6,49,75,
+123,105,100,31,103,109,118,93,93,26,75,170,100,208,115,30,122,125,116,115,
+122,116,135,134,24,135,133,135,133,134,133,122,117,123,118,122,118,129,126,
+24,110,6,97,116,121,105,119,149,123,155,131,31,133,151,158,137,182,27,184,
+143,141,202,186,31,247,21,247,65,143,143,174,141,8,164,6,105,251,32,5,121,
+6,98,115,119,106,102,162,125,203,31,222,6,202,163,153,176,173,118,156,95,
+140,31,112,247,249,21,114,251,4,5,61,6,62,118,149,174,183,172,162,204,31,
+14,248,181,248,200,21,252,4,100,10,218,247,250,5,247,207,6,181,247,78,5,142,
+151,140,149,146,26,162,121,156,113,122,122,132,125,125,30,129,129,135,130,
+133,112,8,14,247,157,247,81,21,178,214,181,154,173,27,172,154,121,100,107,
+128,105,125,125,31,132,132,127,135,116,135,8,93,130,120,123,109,26,106,163,
+121,181,237,216,228,247,5,243,89,195,46,99,99,128,111,79,30,173,247,46,5,
+192,6,134,118,138,130,130,26,106,158,121,174,174,154,159,194,146,30,143,167,
+5,144,171,139,139,144,26,178,118,152,73,30,251,142,6,69,138,134,135,120,78,
+129,104,24,131,110,137,129,132,26,114,162,118,168,168,151,152,188,155,30,
+148,168,5,195,6,60,251,251,5,77,140,116,125,101,26,100,161,126,204,30,226,
+6,202,162,153,177,173,119,155,94,140,31,14,247,62,247,227,21,226,176,213,
+191,228,27,200,194,109,105,31,119,7,113,154,125,166,174,163,162,182,148,30,
+157,219,5,141,148,141,152,146,26,161,120,156,115,120,125,133,122,122,30,164,
+100,95,151,84,27,251,49,251,34,251,8,251,49,103,31,125,76,5,135,122,137,122,
+123,26,81,161,88,181,101,30,99,183,198,120,221,27,247,22,247,25,206,204,162,
+119,158,115,124,123,132,122,117,31,104,95,104,128,76,27,39,77,183,209,149,
+139,146,140,149,31,247,115,6,188,165,158,173,170,115,159,102,31,14,58,10,
+14,43,10,43,10,43,10,247,176,29,155,151,148,129,29,126,103,27,107,111,147,
+159,94,140,29,247,201,248,96,21,182,6,60,251,249,5,101,135,121,122,109,26,
+105,165,121,188,30,182,6,220,199,157,176,181,31,179,175,161,188,195,26,228,
+94,183,37,151,30,167,247,11,247,91,10,251,143,6,74,117,126,99,105,159,122,
+177,31,160,6,82,251,144,123,65,107,92,106,141,25,143,165,140,146,146,26,167,
+119,155,103,104,125,124,91,130,30,128,85,5,137,128,138,133,134,26,123,146,
+128,156,132,30,130,157,176,133,172,27,243,202,206,247,39,172,31,247,52,178,
+21,182,136,157,124,106,26,90,109,112,78,132,30,14,247,188,247,122,21,110,
+251,19,5,100,132,120,119,106,26,107,154,128,182,30,247,1,6,215,209,162,176,
+177,31,171,170,158,190,192,26,188,121,173,102,163,30,159,106,98,151,100,27,
+121,6,169,247,18,5,187,208,10,251,22,6,90,107,115,103,111,154,126,172,136,
+31,111,251,18,5,251,13,247,58,29,174,145,163,164,169,26,166,120,154,103,30,
+68,6,88,107,114,100,117,153,126,167,135,31,59,251,250,5,138,137,139,139,136,
+27,98,133,118,119,106,26,110,159,125,180,30,225,6,186,171,164,177,164,123,
+152,105,141,31,167,247,19,5,247,99,251,19,21,167,247,19,5,149,6,195,166,119,
+99,95,108,116,76,31,14,247,217,248,96,21,194,6,137,126,5,137,126,137,125,
+133,26,115,163,119,167,169,155,156,179,146,30,140,146,140,147,145,170,5,142,
+154,141,152,150,26,178,118,152,74,30,251,144,6,100,114,134,132,134,31,133,
+135,128,115,131,113,124,91,24,132,115,136,127,133,26,116,159,122,165,173,
+154,155,191,158,30,148,163,5,195,6,61,251,249,5,76,247,146,29,215,247,132,
+29,170,122,155,101,144,31,160,228,5,181,197,173,155,170,27,162,152,127,118,
+128,137,129,135,121,31,122,64,5,87,138,118,124,104,26,101,162,125,203,30,
+198,247,132,29,168,122,156,105,145,31,156,207,5,143,159,141,150,152,26,219,
+83,198,64,103,109,131,117,97,30,14,247,195,22,247,27,6,190,171,164,178,161,
+124,153,112,142,31,218,247,250,96,29,247,30,6,124,86,5,137,131,137,127,130,
+26,115,158,123,169,175,154,155,190,151,30,14,248,64,248,214,21,251,76,251,
+65,251,68,251,79,251,23,235,42,247,22,247,72,247,68,247,69,247,74,247,27,
+45,236,251,23,31,231,251,237,21,116,95,122,117,107,114,8,106,98,93,121,95,
+27,98,101,157,171,114,31,120,162,132,160,134,187,8,155,223,21,235,180,221,
+201,224,27,222,193,76,44,138,31,14,248,145,247,0,21,108,247,25,133,164,128,
+158,120,156,25,153,147,191,202,177,193,192,10,107,251,60,181,29,247,6,130,
+164,247,7,10,134,122,137,125,129,26,114,161,120,167,163,151,149,171,152,30,
+148,91,154,103,163,105,110,125,117,121,121,113,33,251,45,24,96,138,118,122,
+230,10,100,251,42,5,247,1,29,155,105,146,247,64,29,141,132,139,136,141,131,
+25,147,98,151,129,188,136,128,90,24,136,130,138,127,132,26,114,156,124,169,
+181,162,167,197,147,30,158,247,31,5,14,248,42,247,127,193,29,119,27,46,247,
+202,10,248,180,247,209,21,252,95,6,133,106,136,109,110,26,54,169,67,190,102,
+30,111,178,190,123,189,27,247,75,247,65,247,69,247,79,247,23,43,235,251,23,
+51,35,89,67,76,31,237,99,140,141,141,140,141,141,25,140,140,139,140,140,27,
+175,187,178,155,181,27,183,178,120,108,163,31,158,113,153,100,112,26,114,
+39,21,104,86,125,121,116,118,8,109,106,85,118,96,27,97,98,158,170,117,31,
+126,156,130,166,128,188,8,14,247,227,248,96,21,197,6,203,162,153,177,177,
+116,153,75,31,251,40,247,58,10,105,161,121,184,138,31,60,251,249,5,82,138,
+118,125,103,26,101,162,125,203,30,222,6,202,163,153,175,174,117,156,92,140,
+31,167,247,21,5,182,212,184,156,181,27,166,152,130,121,128,137,123,135,121,
+31,112,251,9,5,75,117,126,101,100,162,126,203,31,228,6,201,163,153,175,174,
+117,156,95,140,31,164,247,4,5,145,165,142,160,153,26,210,81,189,57,90,95,
+128,114,90,30,14,168,242,21,105,133,123,122,110,26,102,162,125,203,30,193,
+6,202,162,153,175,174,117,156,94,140,31,182,247,90,178,251,104,5,70,152,154,
+119,182,27,180,154,157,207,154,31,222,248,11,5,174,145,155,156,167,26,178,
+116,152,75,30,85,247,4,29,97,251,83,98,247,112,5,208,127,133,144,66,27,123,
+6,75,116,125,102,110,154,123,172,132,31,247,224,251,98,21,113,154,162,127,
+172,27,192,174,173,203,152,31,158,228,5,140,145,140,146,146,26,179,110,167,
+96,85,104,106,73,125,30,120,59,5,136,126,138,130,133,26,136,142,122,140,133,
+30,140,138,5,226,183,21,130,137,136,135,135,27,136,138,140,141,141,139,139,
+141,145,31,165,247,1,5,146,141,141,142,143,27,144,139,139,124,135,31,72,251,
+105,21,88,118,125,105,109,160,122,176,31,166,6,189,161,153,172,171,117,155,
+97,31,14,247,141,247,124,21,247,11,6,162,241,5,251,11,119,10,111,251,19,5,
+83,6,116,37,5,195,6,110,251,21,129,10,248,38,247,110,21,143,157,247,105,247,
+117,5,161,149,141,144,150,31,161,151,153,161,160,247,86,29,131,247,162,29,
+46,159,29,123,26,119,147,128,158,130,30,251,7,251,13,78,247,12,186,10,122,
+122,26,110,156,127,177,138,30,247,5,251,116,135,120,5,39,6,100,112,119,110,
+114,153,129,174,31,237,6,132,108,133,29,145,170,5,234,6,178,166,247,68,10,
+247,100,247,123,21,215,6,136,125,138,129,133,26,116,158,122,164,175,161,160,
+185,149,30,163,247,0,247,125,10,161,120,156,115,117,118,128,123,127,30,134,
+131,136,129,133,115,8,63,6,167,247,17,5,247,110,6,130,96,5,135,126,138,129,
+133,26,117,158,122,165,174,162,161,183,148,30,173,247,41,5,252,83,247,140,
+29,148,247,89,10,128,174,10,248,103,6,172,247,41,5,141,151,141,150,145,26,
+161,119,156,114,105,116,116,96,129,30,128,92,5,251,132,6,247,26,247,35,10,
+121,156,112,224,10,52,29,236,248,196,21,114,121,119,111,82,197,96,214,189,
+190,156,169,175,247,47,29,130,30,104,122,100,118,91,27,95,107,159,166,138,
+31,166,138,132,148,120,27,14,247,57,248,96,21,60,251,248,104,10,219,247,248,
+5,247,139,6,121,57,5,136,128,138,128,132,26,116,158,122,165,173,162,162,182,
+149,30,181,247,81,5,252,152,247,139,10,247,212,247,143,21,157,151,148,151,
+247,132,10,123,130,129,135,130,125,30,251,18,247,37,29,153,30,14,120,29,120,
+247,35,10,120,156,113,224,10,65,10,85,247,157,21,157,150,148,152,247,132,
+10,124,129,222,29,153,30,14,83,10,93,248,119,21,113,122,119,111,82,197,96,
+215,188,190,156,169,176,247,47,29,129,30,103,122,101,119,90,27,95,108,158,
+167,137,31,166,138,132,148,120,27,14,32,29,251,9,248,14,92,29,32,10,207,249,
+78,92,29,247,207,247,91,21,152,107,171,39,161,76,142,137,208,137,25,172,29,
+132,7,151,10,101,121,90,94,30,88,83,5,153,133,123,149,123,27,165,145,151,
+153,166,137,29,150,6,122,63,5,137,132,138,131,133,26,117,158,119,160,166,
+151,151,173,147,30,96,247,90,21,138,135,137,139,137,27,136,6,163,247,0,154,
+140,145,139,152,141,25,119,132,133,132,133,109,8,14,248,93,245,21,106,246,
+127,176,122,168,116,162,25,175,178,212,221,145,146,144,143,150,151,25,132,
+7,151,10,101,121,89,94,30,45,36,113,112,115,124,126,140,25,136,6,163,247,
+0,5,203,140,160,152,177,241,10,251,249,5,77,116,125,101,101,162,126,203,31,
+234,6,202,163,153,175,176,116,155,88,31,170,247,37,5,166,6,169,140,164,112,
+158,84,171,38,24,161,77,141,138,202,136,127,89,24,136,125,138,131,132,26,
+114,156,124,170,181,162,167,198,147,30,158,247,30,5,14,248,126,246,21,219,
+247,246,93,29,123,26,113,151,126,168,135,30,59,251,249,5,137,247,83,10,126,
+247,126,29,182,30,247,13,6,169,152,247,192,29,140,118,27,130,6,167,247,18,
+5,247,98,6,111,251,18,5,127,175,29,121,123,26,108,156,127,183,30,229,6,128,
+89,5,136,128,138,129,132,26,113,156,124,170,180,162,167,198,147,30,159,247,
+31,5,14,248,144,242,21,251,14,247,76,247,84,247,66,5,181,140,169,165,173,
+247,17,29,131,132,71,10,145,6,140,6,126,84,5,136,127,138,130,132,26,113,156,
+125,170,180,162,166,198,148,30,158,247,31,5,14,247,205,247,68,21,170,148,
+152,144,164,152,117,40,24,126,29,113,123,131,135,100,121,25,147,174,5,140,
+146,140,146,147,26,163,121,157,116,114,126,126,106,131,30,123,65,5,114,142,
+131,145,156,26,150,142,159,142,153,30,167,10,101,158,104,171,116,30,158,125,
+155,134,175,134,8,137,129,138,131,135,26,118,159,119,160,165,152,152,172,
+146,30,14,89,29,81,6,76,116,125,101,101,161,126,203,138,31,247,30,6,127,84,
+5,136,129,138,128,247,93,10,158,247,33,5,14,32,10,237,146,10,52,29,188,248,
+227,21,151,127,134,141,127,27,116,117,119,118,128,145,130,152,126,31,247,
+12,251,0,5,131,149,151,132,146,27,163,160,159,162,150,135,146,124,153,31,
+14,247,156,248,101,21,143,156,5,188,6,176,171,169,174,167,118,154,99,31,251,
+45,6,88,108,115,101,108,159,124,180,31,148,6,135,122,5,112,6,100,113,118,
+109,112,152,129,174,31,164,6,82,251,161,5,128,6,89,107,114,101,109,159,124,
+180,31,247,170,6,247,46,231,213,247,15,178,127,172,117,163,31,174,108,67,
+161,54,27,251,4,6,145,166,5,247,5,247,138,10,251,77,251,249,21,167,247,26,
+5,247,7,6,235,173,122,92,89,104,119,54,31,14,248,63,248,241,21,55,44,94,67,
+70,31,72,68,98,39,46,26,251,27,235,36,247,19,247,78,247,65,247,76,247,89,
+247,29,43,240,251,22,30,247,2,251,200,21,137,138,135,139,133,138,8,134,115,
+128,138,120,27,117,124,143,148,124,31,169,86,134,141,102,27,107,109,134,121,
+68,31,152,182,151,161,164,170,8,195,184,201,173,196,27,219,196,75,48,125,
+138,129,135,118,31,251,247,97,21,144,166,171,142,161,27,165,150,135,123,165,
+31,123,163,159,134,172,27,165,188,147,149,179,31,49,93,63,83,62,27,59,82,
+203,228,31,143,7,14,247,121,247,51,21,70,247,216,5,154,6,170,150,142,152,
+154,31,154,151,148,158,157,26,169,122,152,96,30,251,25,247,15,29,126,130,
+121,121,26,108,157,126,180,30,239,252,119,5,243,6,247,135,248,37,5,175,161,
+156,156,152,27,142,143,138,137,141,31,121,170,141,138,157,27,183,181,181,
+183,182,104,166,84,64,80,97,49,85,31,14,247,151,124,21,207,141,198,151,178,
+161,8,208,177,181,203,206,143,10,102,117,94,8,125,111,134,125,198,29,97,6,
+135,10,87,247,0,74,247,0,127,31,119,52,5,142,159,139,139,147,27,167,153,131,
+124,123,125,129,178,29,179,123,157,98,149,31,14,247,21,248,96,21,194,6,60,
+251,249,5,77,247,146,29,247,122,29,171,247,36,5,165,6,169,141,164,111,158,
+84,171,39,24,161,76,142,137,208,137,8,237,29,162,25,175,178,212,221,144,145,
+144,144,151,151,25,132,7,151,10,102,121,89,93,30,45,36,113,112,115,124,126,
+140,25,136,6,163,247,0,247,91,10,251,140,6,97,251,79,5,136,126,247,61,10,
+14,247,232,126,21,209,142,202,155,186,168,8,187,167,163,167,165,121,10,175,
+161,161,183,149,31,157,219,5,78,29,125,75,5,135,122,137,122,122,26,34,210,
+63,247,8,121,30,119,49,126,10,14,89,29,251,15,6,98,251,45,5,136,127,137,125,
+129,26,113,156,126,170,178,156,157,190,149,30,150,194,5,247,71,6,184,140,
+165,159,175,26,170,116,155,95,30,14,247,229,164,10,125,144,30,142,130,78,
+10,14,248,26,248,76,21,212,182,152,171,167,31,160,162,156,181,170,26,167,
+114,162,109,110,121,121,100,130,30,136,125,136,130,135,133,8,136,138,121,
+136,111,27,55,6,42,71,98,53,92,31,99,65,115,51,66,26,251,6,229,61,247,22,
+247,50,247,17,247,1,247,30,247,0,59,215,251,8,94,102,130,117,92,30,159,182,
+155,149,192,140,8,156,251,19,21,214,175,111,80,61,66,81,41,66,97,173,197,
+217,210,192,243,31,14,213,241,21,247,111,10,247,163,6,247,44,226,184,218,
+182,112,165,76,156,31,204,158,175,178,189,26,206,75,179,34,30,251,160,6,85,
+110,247,131,29,148,6,236,82,21,151,196,5,247,39,6,193,168,131,124,115,102,
+129,43,31,251,35,251,54,21,151,197,5,247,24,6,227,171,131,117,118,112,132,
+61,31,14,103,10,14,248,39,22,134,113,5,136,127,138,128,129,26,109,161,117,
+168,168,157,158,180,148,30,153,202,5,143,156,141,153,149,26,170,121,155,102,
+143,30,187,247,109,5,193,141,159,153,174,26,178,116,153,75,30,251,192,6,76,
+116,125,101,104,159,124,191,137,31,115,32,120,57,98,110,40,140,25,110,251,
+18,5,134,119,137,125,131,26,112,161,118,168,168,153,155,189,153,30,152,185,
+5,247,99,247,213,21,247,1,6,91,251,109,5,251,21,6,158,168,153,171,148,178,
+8,14,248,180,99,29,14,247,116,242,21,195,10,131,147,119,25,168,63,161,82,
+145,134,179,137,25,159,6,171,163,161,170,168,122,155,103,144,31,116,200,129,
+165,123,165,125,236,10,146,170,5,79,29,8,14,247,130,248,44,21,87,29,115,154,
+120,176,119,31,103,207,210,121,218,27,221,197,153,171,186,31,180,167,163,
+177,178,26,177,122,163,247,1,10,14,51,10,14,61,10,14,248,150,247,213,21,191,
+140,160,154,175,26,177,116,153,76,30,251,182,6,75,116,125,102,104,164,121,
+187,31,143,6,142,6,104,251,49,129,94,117,116,105,138,25,180,137,125,156,106,
+27,106,126,124,86,128,31,129,97,5,138,133,138,133,136,26,116,182,122,196,
+240,204,196,246,164,30,176,247,61,5,231,247,89,29,88,117,123,104,101,161,
+125,203,31,207,247,132,29,171,120,156,99,142,31,14,247,66,247,149,21,203,
+251,31,5,226,6,247,23,247,24,99,251,38,5,107,6,89,107,115,102,110,159,125,
+180,31,247,21,6,189,171,162,176,167,124,152,104,141,31,186,247,111,247,92,
+29,54,6,251,83,251,88,43,247,88,5,55,6,89,107,115,102,114,152,126,168,135,
+31,91,251,110,5,136,6,100,108,111,105,112,160,124,179,31,247,21,6,189,171,
+164,177,165,117,154,100,31,110,6,14,248,30,247,54,21,247,134,10,160,125,180,
+31,247,12,6,189,171,164,177,165,117,153,100,31,132,6,187,247,111,115,29,137,
+135,186,29,14,119,29,248,48,247,213,21,92,251,110,5,127,6,89,107,115,100,
+113,161,125,178,247,99,10,31,187,247,110,5,178,144,164,163,172,26,167,118,
+153,99,30,252,24,6,85,110,118,99,110,154,125,169,31,145,6,92,251,110,5,115,
+125,138,134,198,10,187,247,110,5,14,247,35,62,10,248,216,247,2,29,157,105,
+92,148,85,27,45,247,202,29,248,0,247,213,21,236,6,120,56,5,137,127,137,128,
+247,95,10,181,247,81,5,252,154,6,97,251,79,5,136,126,138,129,133,26,117,159,
+122,164,173,163,162,182,148,30,158,224,5,235,6,92,251,109,5,77,247,141,10,
+247,122,247,136,10,79,6,14,247,83,45,29,14,247,199,137,21,135,160,154,138,
+154,27,202,188,168,199,178,31,174,194,158,205,208,26,244,95,197,60,127,131,
+138,137,126,30,152,203,5,144,160,141,153,146,26,167,116,160,107,30,106,138,
+116,137,5,77,133,119,127,104,26,107,161,119,175,141,144,139,140,146,30,129,
+90,5,143,118,127,140,127,27,89,88,111,89,97,31,93,85,117,74,63,26,81,151,
+100,165,108,30,112,162,171,124,172,27,150,147,140,142,154,31,132,114,5,119,
+6,75,116,126,101,100,161,126,204,31,247,27,6,204,162,152,177,178,117,152,
+73,31,133,6,56,247,18,21,135,125,130,137,130,27,113,126,161,184,224,192,227,
+190,145,143,139,137,148,31,247,4,22,141,153,145,139,147,27,167,155,116,98,
+103,130,98,122,102,31,95,118,116,121,102,27,134,137,139,141,131,31,14,248,
+18,247,37,10,157,155,26,156,128,155,125,59,29,248,215,243,21,44,6,186,247,
+110,247,112,10,160,26,167,118,154,99,30,251,13,6,90,106,114,101,113,161,125,
+178,31,149,6,91,251,110,5,251,99,140,10,248,29,6,129,97,5,136,125,137,128,
+134,26,117,161,122,167,172,159,160,185,149,30,14,247,99,243,21,172,10,248,
+79,6,127,97,5,136,129,137,129,247,92,10,170,247,21,5,40,6,188,247,102,10,
+99,31,251,9,6,68,205,29,116,150,125,161,134,31,14,189,248,61,21,224,29,241,
+247,29,29,247,41,6,225,198,151,164,172,31,170,161,156,175,179,26,221,73,185,
+251,9,30,118,6,151,197,5,192,6,177,170,167,173,166,118,154,98,31,33,251,215,
+21,151,197,5,173,6,194,168,129,120,120,112,129,88,31,14,247,80,247,213,21,
+194,6,177,170,167,173,167,118,153,99,31,251,51,6,86,109,247,131,29,145,6,
+93,251,111,5,127,6,100,110,115,106,109,161,124,181,31,247,11,6,223,195,151,
+164,173,31,169,161,156,175,180,26,217,73,188,35,30,128,6,105,251,53,21,150,
+197,5,150,6,157,181,132,133,151,31,147,136,144,132,132,26,121,107,129,83,
+30,247,138,140,21,91,134,117,119,103,26,108,154,128,184,30,237,6,190,171,
+164,178,167,122,150,94,140,31,189,247,110,247,92,29,47,6,89,107,114,100,111,
+154,129,185,138,31,14,247,121,247,213,21,195,6,177,170,167,173,166,118,154,
+99,31,251,55,6,85,110,247,131,29,148,247,29,29,247,150,6,237,201,151,165,
+173,31,168,162,155,174,179,26,223,71,183,251,20,30,251,22,6,105,251,54,21,
+151,197,5,247,11,6,228,170,131,117,118,112,132,61,31,14,247,186,247,154,21,
+92,114,120,104,106,161,122,178,31,247,16,6,92,110,94,116,74,27,79,83,161,
+183,86,31,161,113,123,147,122,27,112,113,114,113,113,163,113,198,100,31,98,
+202,189,123,207,27,247,59,247,23,247,4,247,35,247,9,54,219,251,16,87,96,128,
+116,103,31,184,136,127,153,105,27,104,128,124,73,128,31,133,108,133,112,133,
+118,8,128,108,137,130,130,26,117,161,118,163,162,154,151,172,156,30,194,168,
+183,163,210,27,205,184,112,94,148,31,14,247,108,247,54,21,251,1,144,208,70,
+245,27,213,192,167,198,180,31,176,192,159,205,210,26,202,123,182,104,168,
+30,166,108,96,153,92,27,41,56,76,251,0,98,31,98,6,150,195,163,140,149,141,
+151,147,25,156,150,150,160,158,26,165,117,154,100,30,56,6,89,107,114,101,
+115,154,126,168,136,31,91,251,111,5,97,137,117,119,103,26,108,159,125,181,
+30,238,6,190,170,162,178,166,124,153,110,31,113,6,152,198,5,247,169,247,64,
+21,184,165,106,81,55,87,68,78,89,109,173,194,222,196,213,204,31,14,248,142,
+247,213,21,162,6,180,163,158,173,176,115,153,76,31,251,67,6,49,80,125,111,
+103,31,107,114,120,101,100,26,88,166,104,194,118,30,122,130,129,132,121,122,
+95,95,24,114,6,79,117,126,104,107,160,122,179,31,203,6,176,140,139,139,183,
+186,222,226,158,152,184,141,8,164,6,129,92,5,114,6,96,117,122,104,101,162,
+126,203,31,232,6,202,162,153,175,174,117,156,93,140,31,78,247,110,21,124,
+71,5,73,6,56,110,146,161,167,171,150,219,31,14,248,136,248,61,21,252,25,247,
+140,10,175,6,92,251,109,104,10,187,247,109,5,247,228,6,181,247,79,5,141,151,
+141,150,146,26,161,120,156,113,105,116,116,95,129,30,14,212,242,21,109,29,
+77,251,169,5,92,130,96,108,83,27,32,6,87,108,115,99,112,159,126,180,31,247,
+3,6,247,5,140,237,215,162,242,204,247,182,24,142,153,140,150,154,26,214,80,
+187,48,89,88,120,106,96,30,158,221,5,141,29,14,247,83,247,157,21,186,172,
+186,160,210,27,176,177,130,126,156,31,149,131,143,130,124,26,103,152,125,
+171,174,162,161,184,149,30,153,199,5,142,152,140,149,145,26,160,119,157,115,
+126,127,135,128,124,30,158,101,98,148,86,27,48,66,111,79,77,31,80,83,108,
+70,69,26,251,2,220,80,247,44,247,35,247,10,191,202,162,119,158,115,127,127,
+135,129,126,30,110,94,98,128,66,27,49,94,162,189,132,31,247,53,6,186,165,
+159,176,170,119,155,98,31,14,248,182,66,29,14,248,38,64,10,236,221,29,14,
+248,45,98,29,248,79,247,213,21,192,140,160,154,175,26,177,116,153,75,30,251,
+129,247,58,10,105,160,122,183,137,31,104,251,52,128,95,119,117,107,137,25,
+141,146,139,142,143,26,169,120,156,107,107,120,118,97,131,30,130,95,5,137,
+129,139,135,136,26,113,175,123,197,247,3,193,186,247,9,165,30,177,247,61,
+5,200,247,89,29,104,134,122,122,109,26,103,165,123,197,236,189,146,158,172,
+30,185,166,168,188,192,26,213,96,174,38,146,30,116,36,21,187,138,147,136,
+122,26,114,117,126,91,135,30,14,247,180,247,52,21,127,81,5,102,135,120,121,
+106,26,105,158,126,185,30,222,6,224,185,147,158,170,31,177,161,159,178,188,
+26,221,84,184,36,30,127,6,150,196,5,196,6,176,170,167,173,166,118,154,99,
+31,251,31,6,86,109,118,100,111,154,125,174,137,31,128,82,5,251,12,6,151,197,
+5,176,146,158,159,171,26,169,119,153,98,30,74,6,89,107,114,100,116,154,126,
+168,135,31,91,251,109,5,97,137,117,119,102,26,108,158,125,182,30,221,6,190,
+170,162,178,167,124,153,109,31,131,6,152,195,5,247,108,81,21,151,197,5,162,
+6,179,159,129,120,117,125,132,96,31,14,247,154,55,10,75,29,75,29,247,244,
+243,21,84,6,75,116,125,101,101,161,125,204,31,247,30,247,132,29,172,120,156,
+97,142,31,95,10,14,248,135,243,21,187,247,102,10,98,31,251,9,6,69,205,29,
+117,149,126,162,132,31,89,251,111,5,172,10,248,120,208,10,14,248,239,247,
+239,21,79,29,124,58,24,195,10,130,147,120,25,168,63,161,84,144,134,172,135,
+25,126,230,29,38,6,113,199,125,172,126,158,126,236,10,14,247,83,150,21,117,
+35,5,136,113,10,247,4,6,169,152,247,55,29,157,156,26,151,134,150,129,148,
+30,146,130,130,141,110,27,138,6,159,231,247,150,247,215,153,29,144,137,146,
+131,29,14,177,247,150,21,130,99,5,136,124,137,123,123,26,251,6,223,67,247,
+25,247,61,247,40,247,19,247,37,247,3,54,208,251,31,58,251,7,119,117,95,30,
+116,128,126,120,116,26,116,156,122,163,150,151,141,142,152,30,162,237,164,
+143,184,27,223,183,115,87,153,31,115,47,21,89,106,82,111,69,27,71,89,171,
+185,134,31,14,247,169,248,174,21,142,153,140,147,150,26,167,125,152,110,102,
+119,118,88,127,30,42,252,73,71,29,247,130,247,162,21,150,190,152,10,175,6,
+128,88,5,107,6,99,113,119,110,114,153,129,174,31,170,6,121,57,104,10,157,
+221,5,206,6,177,166,160,167,247,161,10,247,81,140,21,71,6,100,112,119,109,
+131,143,128,144,133,31,131,146,148,137,163,27,206,6,137,129,5,136,6,107,129,
+137,127,247,2,10,182,30,247,4,6,169,152,247,55,29,156,156,26,151,134,151,
+129,147,30,147,130,130,140,110,27,138,6,141,149,5,209,6,177,166,160,168,164,
+126,149,104,31,72,6,247,148,247,213,153,29,145,137,145,131,29,238,251,204,
+5,14,248,176,247,52,21,149,183,5,142,152,141,155,156,26,247,5,55,213,251,
+20,251,61,251,39,251,19,251,38,251,2,224,70,247,28,214,247,0,157,160,189,
+30,164,149,155,161,163,26,162,121,156,116,128,122,136,133,110,30,122,66,101,
+134,96,27,66,95,163,186,126,31,167,243,21,186,180,188,162,202,27,200,179,
+116,92,158,31,251,53,247,220,150,29,51,10,202,248,75,21,114,214,10,131,120,
+130,30,104,122,100,118,92,27,94,108,158,167,137,31,166,137,133,148,120,27,
+14,103,10,247,210,247,136,104,29,248,37,248,61,21,251,75,174,10,211,6,91,
+251,109,5,251,6,174,10,247,226,247,137,10,251,4,6,50,248,124,21,105,107,110,
+107,114,158,121,164,175,170,168,172,164,121,156,112,31,247,97,22,104,108,
+110,107,114,158,121,165,174,170,168,172,164,121,156,112,31,14,61,10,251,42,
+247,142,104,29,247,115,247,214,21,176,145,155,155,169,26,176,116,153,76,30,
+84,247,58,10,107,158,122,179,136,31,234,251,152,110,102,5,116,121,115,118,
+128,27,142,157,139,143,146,26,170,120,156,107,105,124,122,87,128,30,128,92,
+5,138,133,138,133,134,26,110,180,118,197,197,191,170,205,193,30,247,175,247,
+242,5,189,140,161,155,174,26,176,115,153,76,30,64,247,58,10,111,153,123,170,
+132,31,251,23,251,54,5,91,248,92,21,115,214,10,130,120,130,30,105,123,99,
+118,92,27,94,108,158,167,137,31,167,137,133,147,119,27,14,33,10,251,10,248,
+123,68,29,34,10,251,94,248,44,68,29,248,2,247,123,21,213,204,184,10,96,94,
+111,128,105,95,30,150,132,125,148,129,27,126,124,127,125,134,31,178,121,150,
+75,140,30,62,247,4,29,90,251,110,5,80,116,124,102,101,162,125,202,31,247,
+24,10,155,138,143,139,152,135,129,91,24,137,131,138,132,132,26,119,158,118,
+157,153,152,151,159,146,30,157,105,152,115,148,125,145,134,25,204,29,154,
+124,149,25,81,221,21,135,134,124,127,128,130,137,247,96,29,175,140,157,147,
+149,155,25,14,248,84,243,21,96,218,129,157,125,154,120,150,25,217,208,184,
+10,95,94,101,124,106,139,29,251,111,5,80,140,116,124,102,26,101,162,125,202,
+30,243,29,133,162,99,178,68,24,162,93,146,133,169,136,127,97,24,135,126,138,
+132,130,26,112,156,126,172,175,151,150,180,153,30,149,173,154,199,154,207,
+8,14,248,125,243,21,187,247,110,115,29,138,134,186,29,247,112,6,247,134,10,
+159,125,181,31,236,6,127,230,29,14,248,137,241,21,251,11,247,10,247,42,241,
+162,141,146,142,151,148,25,155,152,148,157,155,26,156,128,155,125,184,29,
+180,5,160,153,194,10,122,26,122,149,124,247,152,29,38,24,251,60,251,10,116,
+137,131,136,127,129,25,123,126,130,123,122,175,10,247,2,6,169,153,247,15,
+10,157,26,157,133,148,120,148,247,153,29,114,175,10,247,6,6,127,96,5,137,
+131,137,127,247,92,10,169,247,20,5,14,247,190,247,15,21,164,144,155,144,161,
+147,130,102,24,132,6,128,119,133,133,128,31,127,132,132,125,120,26,120,146,
+124,152,132,30,133,149,159,134,150,27,229,247,132,29,172,120,155,97,142,31,
+188,247,110,5,194,141,226,29,66,247,58,10,105,159,122,182,138,31,126,78,117,
+129,132,136,106,127,25,144,158,5,141,146,140,146,146,26,164,122,157,115,132,
+129,137,135,133,30,126,132,136,134,132,111,125,84,24,133,141,133,141,134,
+140,8,129,143,137,141,145,26,141,140,142,142,156,30,154,203,5,201,140,161,
+152,177,26,177,116,153,74,30,61,6,75,116,125,102,106,158,123,180,136,31,126,
+80,5,135,120,137,125,126,26,90,174,103,198,127,30,150,137,146,137,132,113,
+5,137,131,138,130,134,26,117,158,119,161,165,151,150,174,148,30,14,248,97,
+243,21,95,10,130,101,5,84,6,75,116,125,101,101,161,126,204,138,31,247,9,6,
+127,84,5,136,128,138,129,247,93,10,159,247,33,5,14,247,121,247,44,21,70,247,
+201,5,153,6,171,150,142,151,153,247,57,29,169,121,151,97,30,251,25,6,108,
+128,247,174,10,180,30,239,252,97,5,243,6,247,135,248,19,5,171,160,157,157,
+151,27,143,142,138,137,142,31,122,170,141,138,157,27,183,181,179,181,180,
+104,165,84,64,80,99,53,85,31,14,51,10,181,248,114,154,29,247,129,248,55,21,
+144,172,5,195,6,176,170,168,174,168,118,154,99,31,251,55,6,86,109,117,100,
+108,160,123,182,31,149,6,133,106,5,110,6,100,112,118,109,112,152,129,175,
+31,170,6,102,251,117,5,129,6,85,110,118,101,108,161,123,181,31,247,150,6,
+237,202,152,166,172,31,168,163,155,175,180,26,228,72,185,251,21,30,251,22,
+6,147,194,5,239,247,138,10,251,51,251,205,21,151,201,5,247,11,6,228,170,131,
+115,117,113,131,60,31,14,248,35,248,94,21,46,46,99,74,81,31,91,87,112,75,
+81,26,251,9,226,61,247,22,247,58,247,42,247,25,247,38,247,8,52,218,251,19,
+30,242,251,117,21,136,120,130,138,125,27,116,123,143,148,124,31,169,87,134,
+141,102,27,110,117,136,126,85,31,197,173,202,173,210,27,215,191,96,77,136,
+139,136,138,133,31,251,204,104,21,142,160,165,141,154,27,164,150,135,123,
+164,31,123,164,159,134,172,27,161,160,142,148,184,31,84,98,87,112,71,27,62,
+88,181,203,31,14,247,189,247,27,21,80,247,94,5,170,150,142,152,154,31,154,
+152,148,157,156,26,170,122,152,96,30,251,24,247,15,29,126,130,120,122,26,
+108,157,126,182,30,149,6,235,251,229,5,247,1,6,247,59,247,139,5,190,174,145,
+146,147,27,143,144,136,135,145,31,126,158,160,131,155,27,181,181,182,182,
+183,104,166,82,96,107,127,111,104,31,110,117,128,125,100,83,8,14,247,170,
+127,21,196,191,148,156,176,31,201,167,177,187,188,26,176,122,164,247,1,10,
+143,7,87,29,110,161,118,196,113,31,177,121,184,126,176,134,119,48,24,140,
+152,149,142,10,179,123,157,98,148,31,14,247,68,247,213,21,91,251,110,5,79,
+140,116,124,102,26,101,162,125,203,30,224,247,113,29,155,209,5,161,6,178,
+147,133,99,162,31,179,68,152,115,148,125,144,134,25,130,148,159,135,179,27,
+200,165,155,175,172,114,158,96,31,125,6,137,6,135,6,96,218,129,157,124,154,
+122,150,25,216,208,148,146,144,143,148,145,25,106,142,154,124,169,27,166,
+154,154,174,147,31,146,170,5,143,155,140,146,145,26,171,114,157,95,94,100,
+123,107,103,30,58,65,126,127,127,130,136,138,25,137,136,131,138,130,27,128,
+6,148,182,5,190,141,158,154,176,26,177,120,151,77,30,251,115,6,224,29,14,
+247,243,124,21,247,25,145,244,189,197,125,29,155,213,5,247,31,10,156,106,
+91,149,84,27,46,247,169,10,186,77,208,120,30,160,133,159,135,166,137,121,
+54,24,140,152,148,140,144,27,168,153,10,178,123,158,97,148,31,14,248,97,243,
+21,118,10,75,116,226,10,178,147,156,187,30,130,102,5,251,10,6,95,251,42,5,
+135,127,137,125,130,26,111,154,125,169,179,159,158,188,149,30,151,194,5,247,
+44,6,194,140,162,154,177,26,174,119,154,92,30,14,248,47,146,21,90,116,5,125,
+132,131,127,124,26,122,152,124,153,145,146,141,142,145,30,193,165,142,134,
+5,112,152,153,128,159,27,163,161,161,163,149,135,151,129,155,31,183,161,5,
+154,147,146,150,154,26,157,126,154,124,134,133,137,136,132,30,90,114,58,247,
+53,5,208,167,187,209,212,26,245,49,215,251,19,30,251,125,6,113,132,247,145,
+29,123,147,124,152,130,30,132,148,150,137,164,27,154,252,5,124,6,115,130,
+247,145,29,124,147,124,152,129,30,133,147,153,136,162,27,247,66,6,183,161,
+155,172,154,132,153,126,149,31,146,128,131,141,112,27,80,235,237,6,147,147,
+139,140,149,31,141,132,140,139,146,125,8,251,26,247,185,21,247,10,6,208,181,
+106,84,84,97,106,70,31,251,10,6,14,247,189,248,137,21,251,27,229,10,247,31,
+251,3,247,3,251,30,31,112,251,173,21,251,54,7,53,148,62,214,135,217,8,194,
+4,145,222,213,213,226,150,8,251,60,7,194,84,21,247,59,6,136,66,59,61,55,128,
+8,247,109,4,247,60,7,223,130,215,63,146,56,8,14,248,61,149,21,127,155,150,
+135,156,27,210,186,229,247,30,247,25,90,229,67,57,97,51,251,63,31,251,209,
+7,113,156,121,164,163,156,157,165,30,247,230,4,158,7,208,161,211,160,161,
+158,71,63,47,123,81,113,117,124,175,195,136,30,252,4,247,192,21,251,208,7,
+138,103,129,111,124,134,8,124,131,130,124,122,26,137,7,140,115,158,122,165,
+141,8,238,6,247,6,202,236,247,67,247,6,109,225,85,180,31,109,162,115,147,
+91,140,141,147,140,142,142,142,8,144,146,141,145,147,26,150,133,150,128,145,
+30,137,140,5,143,133,131,141,132,27,113,113,108,100,133,31,134,6,111,121,
+123,115,116,157,123,167,31,225,22,219,138,166,87,251,40,26,42,121,80,105,
+119,30,131,124,122,136,97,27,149,157,148,178,169,26,14,116,29,14,226,22,197,
+6,163,220,165,226,167,201,174,188,25,201,182,214,190,187,27,153,151,130,128,
+128,132,110,128,99,31,76,251,103,5,135,124,137,125,123,26,109,157,119,166,
+170,162,155,197,192,30,124,168,5,98,100,126,129,129,27,133,135,143,144,143,
+140,145,141,146,31,212,247,164,5,142,148,140,150,148,26,191,112,166,88,82,
+87,111,71,69,30,173,240,247,40,206,159,184,251,47,71,182,247,40,251,30,117,
+124,110,5,145,155,147,141,149,27,167,150,131,120,127,136,121,133,121,31,120,
+82,251,20,84,132,100,247,18,193,5,14,248,141,243,21,85,101,110,119,97,27,
+109,118,145,158,102,31,180,195,155,192,222,26,247,11,178,202,215,242,26,208,
+102,186,84,66,79,51,251,9,133,30,135,65,71,150,99,153,114,159,25,110,163,
+123,172,175,26,197,173,170,214,151,30,119,178,92,130,110,128,118,121,25,110,
+115,122,101,96,26,93,159,97,178,103,30,175,106,193,118,221,125,133,57,127,
+105,102,89,8,174,78,99,152,93,27,76,93,109,97,99,182,112,203,188,201,151,
+153,168,31,145,149,145,141,141,27,141,143,137,133,148,31,124,159,181,128,
+171,27,208,191,168,200,176,31,251,205,114,21,116,83,121,134,104,27,101,113,
+151,157,159,166,154,174,171,162,131,110,195,31,247,43,247,242,21,216,144,
+169,190,181,27,171,160,109,97,77,102,96,40,87,31,14,248,6,248,81,21,205,251,
+38,5,149,6,201,247,38,5,251,60,133,7,132,6,121,127,127,122,120,151,129,164,
+31,198,6,163,151,149,158,158,130,147,115,141,31,247,114,7,161,143,146,147,
+157,26,158,128,148,113,30,74,6,87,251,28,86,247,28,5,76,6,113,128,130,120,
+121,147,131,160,135,31,251,114,7,114,137,130,131,120,26,120,152,129,163,30,
+197,6,164,151,149,158,157,127,150,121,31,132,6,133,6,251,1,247,145,21,166,
+131,150,119,128,134,135,124,133,30,152,119,114,145,109,27,69,86,95,81,106,
+157,108,168,122,31,157,129,157,133,177,132,177,132,148,137,152,132,8,151,
+133,147,127,127,26,114,106,120,96,102,103,156,159,133,30,161,133,133,145,
+123,27,119,130,127,113,31,101,7,113,148,127,159,148,144,142,149,148,30,125,
+167,169,131,170,27,216,192,180,199,169,128,163,117,157,31,121,154,116,147,
+90,148,96,148,137,139,127,145,8,127,146,130,152,151,26,164,167,158,175,175,
+166,124,115,144,30,114,145,144,133,157,27,158,148,151,166,31,14,247,66,247,
+23,21,186,185,177,158,188,27,220,204,78,62,69,84,81,73,105,101,157,169,112,
+31,105,176,5,168,112,105,157,110,27,98,107,110,102,116,148,122,159,122,31,
+146,157,5,128,157,135,148,151,26,165,160,159,166,163,168,119,107,163,30,167,
+100,5,99,169,183,116,189,27,186,184,158,172,168,31,172,178,157,183,182,26,
+215,83,202,46,167,30,228,165,178,185,219,26,234,75,205,47,85,99,122,84,71,
+30,176,110,5,186,201,166,152,179,27,199,177,93,67,62,91,82,74,122,127,141,
+148,114,31,145,153,140,145,148,26,167,126,159,121,120,121,117,116,106,169,
+120,201,133,30,75,127,115,128,84,98,8,14,248,141,247,37,21,73,101,78,103,
+62,27,251,16,51,247,4,247,51,247,15,200,241,213,154,149,135,127,157,31,120,
+114,132,123,120,26,115,153,102,160,107,30,176,83,5,165,100,154,97,107,26,
+109,115,119,103,106,115,159,166,149,142,147,149,154,30,98,163,5,125,116,135,
+129,121,26,85,190,98,205,194,184,179,188,171,125,179,115,178,30,107,191,110,
+190,5,125,162,131,163,154,26,175,186,173,190,169,162,131,116,177,30,180,185,
+120,153,129,132,5,151,104,120,142,111,27,96,115,131,110,100,31,166,108,116,
+149,107,27,39,60,251,21,251,54,251,69,247,1,251,19,247,44,237,215,186,227,
+186,31,14,248,19,247,100,21,221,168,189,189,194,26,200,75,181,47,251,53,251,
+22,251,13,251,41,251,9,221,69,247,28,200,207,155,164,186,30,171,156,152,153,
+157,26,149,138,147,133,162,30,89,85,67,113,58,27,44,81,177,212,122,31,202,
+140,221,152,197,159,8,251,87,160,21,149,181,151,165,163,167,8,191,183,214,
+172,213,27,192,176,117,108,116,119,116,102,121,31,98,119,36,109,90,134,67,
+131,24,14,247,4,22,247,233,6,168,194,5,96,6,156,205,5,154,193,150,219,184,
+26,247,1,89,194,40,30,251,16,6,73,138,136,140,127,185,8,142,137,147,137,147,
+30,135,114,138,126,121,26,90,155,124,191,30,247,7,6,192,155,137,127,158,31,
+162,125,154,107,101,26,96,132,86,126,82,30,115,36,5,251,135,6,14,247,59,22,
+247,59,6,175,184,154,116,147,130,159,126,25,146,167,141,155,140,171,140,217,
+24,141,226,5,168,139,159,140,146,30,147,247,0,139,139,149,26,186,120,157,
+80,147,30,81,147,100,146,130,144,128,161,25,122,119,134,129,128,26,115,168,
+119,177,137,30,154,138,157,138,156,138,8,146,146,136,137,143,31,151,131,143,
+121,140,87,8,55,7,138,37,133,82,124,83,8,251,44,6,14,248,149,211,21,251,195,
+247,196,145,140,5,142,6,144,140,167,143,156,144,176,156,25,146,142,142,142,
+145,26,145,133,144,132,30,134,6,137,117,135,139,125,27,105,85,148,153,91,
+31,140,137,137,139,138,27,133,135,135,135,134,140,136,142,126,31,152,95,146,
+93,105,26,129,139,132,138,127,30,128,7,129,143,133,146,145,142,142,151,144,
+30,149,160,152,186,141,156,8,141,7,139,139,142,140,141,30,247,196,251,195,
+5,14,246,211,21,168,111,247,195,247,195,5,81,148,157,90,153,27,146,143,145,
+149,142,139,142,138,144,31,138,168,5,173,146,185,152,183,30,142,152,140,142,
+144,26,143,135,143,133,138,137,139,138,137,30,125,90,87,130,103,27,130,129,
+139,140,130,31,140,125,139,139,137,27,132,133,134,133,133,142,136,146,136,
+31,176,122,156,134,167,135,144,138,24,142,6,146,138,5,14,246,248,56,21,247,
+196,251,196,5,132,6,136,138,134,138,111,136,122,134,102,122,25,132,135,136,
+136,134,26,133,145,134,146,30,144,6,141,161,143,139,153,27,173,193,130,125,
+187,31,138,141,141,139,140,27,145,143,143,143,144,138,142,136,152,31,126,
+183,132,184,173,26,140,168,5,140,144,139,142,143,26,148,135,145,132,133,136,
+136,127,133,30,130,118,125,92,137,123,8,136,7,139,139,136,138,137,30,251,
+195,247,196,5,14,248,149,248,56,21,111,168,251,196,251,196,5,198,130,122,
+187,125,27,132,135,133,130,31,127,7,140,127,139,133,128,26,105,132,94,126,
+95,30,136,126,138,136,134,26,135,143,135,145,140,141,139,140,141,30,153,188,
+191,148,175,27,148,149,139,138,148,31,138,153,139,139,141,27,146,145,144,
+145,144,136,142,132,143,31,102,155,123,145,110,142,134,140,24,136,140,5,133,
+6,14,166,219,21,211,104,180,110,187,88,8,167,6,119,186,125,160,97,180,8,248,
+67,171,252,68,6,179,178,156,163,159,185,8,111,6,93,91,93,107,70,104,8,247,
+115,4,248,67,6,100,100,122,115,119,93,8,167,6,187,189,185,171,206,171,8,160,
+7,70,172,93,172,94,187,8,111,6,159,91,154,118,180,99,8,252,68,6,14,168,213,
+21,248,68,6,99,101,122,115,119,92,8,167,6,184,186,185,172,209,174,8,160,7,
+68,174,94,171,94,186,8,112,6,158,93,158,112,177,103,8,252,68,6,247,115,4,
+207,106,185,106,186,90,8,167,6,121,182,118,170,102,174,8,248,67,170,252,68,
+6,179,177,156,163,159,186,8,111,6,95,92,91,105,70,106,8,14,247,96,247,15,
+21,100,158,126,145,79,166,8,122,6,220,81,241,45,182,81,182,199,247,1,239,
+213,188,140,140,24,140,135,134,139,137,27,128,93,119,106,77,31,248,17,7,178,
+119,151,133,199,112,8,159,6,54,198,48,222,87,207,85,72,66,72,39,63,157,137,
+157,146,233,186,8,182,252,39,21,248,63,7,193,179,192,99,5,252,65,7,86,100,
+5,14,247,37,22,130,185,161,136,165,27,191,194,162,175,175,31,186,185,169,
+222,221,26,199,122,188,107,171,30,168,110,92,159,100,27,101,107,132,117,79,
+31,156,96,5,152,179,159,143,165,27,183,186,120,113,160,31,155,118,146,114,
+140,98,8,251,68,6,102,137,137,110,119,144,135,164,31,247,72,6,251,0,123,82,
+84,42,27,123,133,139,142,93,31,14,247,246,247,180,21,230,7,165,138,146,132,
+149,30,154,130,121,149,120,27,122,123,131,126,128,31,131,128,137,129,113,
+26,48,251,30,7,247,159,10,121,26,123,147,123,153,130,30,131,151,147,137,167,
+27,247,30,251,10,6,116,141,128,145,131,30,123,149,156,130,158,27,156,155,
+147,152,150,31,147,150,141,147,166,26,247,10,247,29,7,166,147,140,145,149,
+31,155,148,149,156,157,26,156,131,154,125,149,30,147,128,127,141,113,27,252,
+19,247,207,21,247,159,10,122,26,122,147,123,153,129,30,132,151,147,137,167,
+27,248,20,6,165,147,140,145,149,31,155,148,149,157,157,26,173,115,156,93,
+30,14,247,153,251,37,21,180,250,106,98,6,14,247,81,251,138,21,177,6,138,250,
+251,5,102,6,247,38,254,251,21,177,250,251,101,6,14,230,22,190,6,247,52,248,
+25,247,53,252,25,5,190,6,251,66,248,71,5,64,6,14,230,248,70,21,247,66,252,
+70,5,214,6,247,66,248,71,5,88,6,251,53,252,25,251,52,248,25,5,88,6,14,247,
+172,248,68,21,47,126,72,58,40,26,46,209,56,228,126,30,36,7,61,131,110,118,
+130,136,142,154,129,30,154,129,126,147,124,27,115,124,124,116,112,162,120,
+174,165,166,152,162,161,31,168,170,146,170,227,26,206,7,236,150,210,221,241,
+26,239,69,217,41,148,30,203,7,208,148,167,161,145,145,135,128,146,30,120,
+151,149,133,156,27,162,155,154,161,166,116,158,107,116,115,131,124,121,31,
+103,111,126,96,50,26,180,77,21,213,129,191,77,61,26,61,87,76,65,128,30,98,
+22,70,151,91,202,217,26,216,189,202,206,148,30,14,243,248,210,21,103,109,
+110,103,102,168,110,247,157,10,247,88,252,79,247,9,10,247,88,248,79,247,9,
+10,14,241,247,23,21,104,108,109,107,100,167,109,177,175,168,168,175,176,110,
+168,103,31,248,79,4,104,108,110,106,100,168,109,247,157,10,247,218,252,146,
+21,104,169,110,174,176,168,168,175,175,110,169,103,102,110,110,103,30,248,
+76,4,105,169,110,174,176,168,168,175,175,110,168,103,102,110,111,102,30,14,
+247,158,247,214,21,251,50,213,29,238,6,97,67,5,82,6,113,131,138,133,129,31,
+123,129,129,122,122,26,122,147,124,153,129,30,131,150,148,137,165,27,135,
+132,5,134,130,135,125,129,26,115,163,117,167,159,156,150,159,151,30,170,194,
+5,247,159,6,161,152,141,144,148,31,155,149,149,156,247,65,10,251,99,6,180,
+211,5,247,58,213,10,32,6,181,212,5,204,213,10,133,6,145,148,5,144,149,142,
+148,149,26,167,115,162,110,121,121,126,120,128,30,106,82,5,251,151,213,29,
+247,92,6,14,146,247,99,21,248,154,251,144,5,134,149,148,137,148,27,159,157,
+159,162,158,130,152,116,150,31,251,237,247,65,247,237,247,61,5,162,150,148,
+151,159,26,162,121,159,120,130,130,136,134,128,30,251,144,251,139,21,247,
+151,251,7,5,134,150,149,136,147,27,160,157,160,163,160,128,154,114,149,31,
+59,171,219,171,5,164,149,150,153,160,26,164,121,160,117,131,130,137,134,128,
+30,14,248,236,247,99,21,252,154,247,139,5,144,128,130,142,131,27,119,121,
+119,116,119,148,127,162,128,31,247,237,251,61,251,237,251,65,5,116,128,130,
+126,120,26,116,157,119,159,148,148,141,144,149,30,247,144,247,144,21,251,
+151,247,8,5,144,129,129,141,131,27,117,121,118,114,118,150,125,164,129,31,
+219,107,59,107,5,114,129,128,125,117,26,115,157,118,161,146,149,142,144,150,
+30,14,247,56,174,21,224,6,247,46,172,144,165,184,31,206,180,180,214,224,26,
+233,85,225,62,170,30,187,212,5,144,147,142,145,143,26,149,132,146,130,129,
+133,135,125,130,30,86,60,5,147,97,120,140,251,2,27,251,86,6,120,129,132,126,
+126,150,131,157,31,247,89,6,217,169,138,134,174,31,251,141,252,11,5,48,6,
+120,129,132,126,126,151,131,157,31,202,6,81,51,5,133,130,136,133,135,26,130,
+146,132,149,149,145,143,153,148,30,236,247,38,21,247,135,248,3,5,208,118,
+191,62,60,26,78,107,77,89,105,30,112,99,100,133,251,34,27,14,156,10,247,86,
+251,173,21,40,118,64,76,40,27,83,87,162,180,102,31,113,167,128,163,128,185,
+8,194,4,242,160,215,204,238,27,236,214,73,37,159,31,14,247,186,248,137,21,
+251,28,229,10,247,30,251,3,247,4,251,29,31,251,49,252,3,21,111,174,129,169,
+184,26,247,5,224,225,247,5,179,161,132,108,190,30,178,100,21,170,100,147,
+116,94,26,251,8,55,54,251,8,93,110,148,167,101,30,14,116,29,247,88,183,21,
+118,120,121,119,115,156,121,162,161,157,157,161,161,121,157,117,31,14,185,
+22,194,247,117,248,85,194,252,85,247,116,84,6,14,188,247,117,21,248,86,251,
+117,194,248,140,84,251,116,252,86,6,14,188,248,85,21,247,117,252,85,194,248,
+85,247,117,194,252,141,6,14,230,251,52,21,248,57,194,252,57,6,140,248,178,
+21,247,65,252,70,5,214,6,247,64,248,71,5,85,6,251,47,252,25,251,50,248,25,
+5,85,6,14,247,228,251,138,21,135,247,254,203,247,3,247,101,131,8,202,7,78,
+138,251,90,133,61,251,44,145,252,5,25,14,247,111,4,188,153,138,137,157,31,
+190,131,183,113,166,100,8,184,75,163,251,13,251,55,26,98,201,193,7,200,137,
+185,135,187,30,131,232,109,235,103,184,8,191,98,66,171,61,27,77,6,14,247,
+111,4,201,140,238,141,224,194,178,227,25,172,214,155,247,0,247,42,26,190,
+76,7,251,67,131,77,105,39,30,104,45,80,102,251,6,140,8,118,6,14,247,165,249,
+129,21,134,252,39,222,251,26,247,145,146,8,202,7,251,72,133,73,223,118,247,
+154,8,136,164,138,149,162,26,155,140,166,140,165,30,14,233,173,21,248,49,
+6,251,98,248,78,5,251,19,252,24,21,247,19,247,164,247,19,251,164,5,14,233,
+178,21,248,78,247,99,252,78,247,99,5,193,251,226,21,247,146,7,247,164,251,
+19,5,14,234,248,112,21,247,98,252,78,247,99,248,78,5,251,225,85,21,247,145,
+6,251,19,251,164,5,14,209,247,138,21,248,78,251,99,5,248,50,7,251,218,251,
+99,21,247,164,247,19,5,251,146,7,14,183,247,223,21,247,155,251,182,247,151,
+247,179,251,157,247,184,5,14,132,247,220,21,247,200,251,232,247,200,247,232,
+251,200,247,233,5,251,157,251,232,21,247,157,247,179,247,157,251,179,251,
+157,251,180,5,14,247,194,248,53,21,70,84,84,69,69,193,82,207,206,194,195,
+209,208,85,196,73,31,137,79,21,174,168,109,103,103,110,109,105,103,110,168,
+176,175,167,169,175,31,14,247,8,251,42,21,247,138,165,51,249,238,227,165,
+251,138,6,174,254,8,21,249,238,227,253,238,7,14,247,8,251,42,21,247,138,250,
+34,251,138,113,227,253,238,51,6,247,15,22,249,238,227,253,238,7,14,126,152,
+248,237,155,6,242,10,247,4,11,175,156,143,144,143,146,143,143,143,150,146,
+146,12,12,248,236,20,169,19,1,162,2,0,1,0,17,0,29,0,34,0,39,0,44,0,70,0,75,
+0,78,0,107,0,122,0,138,0,152,0,157,0,178,0,193,0,198,0,203,0,206,0,217,1,
+38,1,55,1,62,1,71,1,81,1,86,1,118,1,177,2,10,2,22,2,81,2,124,2,232,2,245,
+3,44,3,50,3,66,3,80,3,156,4,38,4,122,4,128,4,145,4,170,5,9,5,134,5,139,5,
+153,5,222,6,6,6,124,6,236,7,87,7,140,7,154,7,169,8,6,8,59,8,140,8,204,8,229,
+8,236,9,62,9,118,9,130,9,175,9,204,9,221,10,0,10,30,10,36,10,44,10,60,10,
+72,10,110,10,165,10,168,10,237,11,9,11,66,11,87,11,105,11,114,11,167,11,177,
+11,195,11,248,12,44,12,86,12,92,12,110,12,119,12,145,12,159,12,170,12,174,
+12,180,12,208,12,222,12,235,13,19,13,29,13,42,13,70,13,119,13,128,13,153,
+13,200,13,246,14,17,14,60,14,67,14,111,14,155,14,160,14,194,14,223,14,239,
+14,251,14,254,15,20,15,53,15,62,15,101,15,140,15,170,15,177,15,185,15,210,
+15,220,15,253,16,14,16,31,16,46,16,54,16,81,16,103,16,139,16,145,16,180,16,
+215,16,232,16,243,16,254,17,5,17,23,17,49,17,58,17,91,17,124,17,144,17,162,
+17,175,17,190,17,222,17,244,17,254,18,20,18,36,18,43,18,55,18,84,18,111,18,
+129,18,158,18,169,18,197,18,218,18,226,18,254,19,11,19,35,19,44,19,71,19,
+85,19,95,19,102,19,113,19,119,19,125,19,134,19,141,19,156,19,182,19,195,19,
+216,19,229,19,235,19,245,20,9,20,23,20,39,20,63,20,75,20,80,20,103,20,110,
+20,121,20,135,20,158,20,163,20,167,20,184,20,206,20,223,20,245,21,11,21,32,
+21,39,21,53,21,74,21,86,21,94,21,114,21,122,21,130,21,150,21,170,21,178,21,
+184,21,196,21,208,21,216,21,235,21,254,22,17,22,26,22,38,22,57,22,76,22,85,
+22,94,22,102,22,111,22,123,22,136,22,150,22,157,22,167,22,185,22,195,22,201,
+22,212,22,218,22,224,22,234,22,251,23,12,23,20,23,30,23,47,23,54,23,71,23,
+88,23,98,23,115,23,132,23,148,23,162,23,173,23,189,23,198,23,203,23,211,23,
+218,23,234,23,248,24,2,24,10,24,18,24,26,24,34,24,42,24,49,24,55,24,61,24,
+76,24,83,24,94,24,109,24,117,24,132,24,138,24,153,24,158,24,169,24,183,24,
+197,24,211,24,217,24,231,24,245,24,255,25,5,25,11,25,18,25,32,25,46,25,58,
+25,63,25,72,25,81,25,90,25,99,25,105,25,111,25,120,25,133,25,146,25,159,25,
+172,25,177,25,190,25,203,25,216,25,229,25,242,25,255,26,12,26,25,26,38,26,
+43,26,56,26,69,26,76,26,83,26,95,26,107,26,119,26,131,26,143,26,155,26,167,
+26,179,26,191,26,203,26,215,26,227,26,239,26,251,27,3,27,11,27,19,27,27,27,
+35,27,43,27,51,27,57,27,63,27,74,27,85,27,96,27,107,27,118,27,129,27,140,
+27,151,27,162,27,169,27,180,27,191,27,202,27,213,27,224,27,235,27,246,28,
+1,28,12,28,23,28,34,28,45,28,56,28,67,28,78,28,89,28,100,28,111,28,117,28,
+121,28,126,28,130,28,133,28,138,28,143,28,148,28,152,28,158,28,163,28,169,
+28,174,28,180,28,184,28,189,28,195,28,198,28,203,28,209,28,214,28,220,28,
+225,28,232,28,238,28,244,28,250,29,2,29,8,29,15,29,21,29,29,29,32,29,39,29,
+46,29,55,29,62,29,65,29,70,29,73,29,76,29,79,66,10,173,247,40,5,142,155,140,
+145,147,26,161,197,29,11,248,19,164,10,124,144,30,142,131,78,10,11,248,226,
+99,29,11,248,228,66,29,11,248,63,81,29,11,21,140,140,140,140,141,140,142,
+247,20,10,125,131,123,125,30,35,251,14,5,122,121,135,131,215,10,248,244,73,
+29,11,74,10,14,247,230,247,74,29,5,179,143,165,163,172,218,10,121,123,26,
+109,156,127,183,30,247,38,29,166,149,135,29,11,249,6,247,2,29,156,106,91,
+149,84,27,46,57,29,11,66,10,172,247,40,5,144,158,139,141,147,26,162,197,29,
+11,248,46,207,10,156,156,26,156,129,155,124,247,201,10,247,130,45,29,11,175,
+97,10,156,157,147,152,152,31,149,149,143,149,145,164,157,219,24,78,29,11,
+221,97,10,175,161,161,183,149,31,157,219,5,78,29,11,248,91,79,10,11,248,84,
+64,10,11,50,29,14,65,29,123,26,113,151,126,168,121,29,11,247,125,247,213,
+21,167,6,185,170,164,177,166,117,153,100,31,251,40,209,29,155,6,91,251,109,
+247,60,29,247,136,247,139,106,251,35,5,115,247,141,10,247,45,6,185,171,164,
+174,168,119,154,98,31,122,6,186,247,109,5,150,6,177,171,167,173,166,118,154,
+98,31,36,6,251,133,251,139,5,11,247,133,89,10,152,142,150,153,109,10,153,
+247,127,10,182,29,11,70,29,215,251,149,37,10,139,10,141,153,147,172,138,10,
+11,248,103,21,141,29,59,252,0,71,29,248,182,58,29,11,247,95,105,29,126,138,
+130,132,26,116,159,122,163,118,29,248,109,6,173,247,40,5,142,155,140,145,
+146,26,162,247,178,10,248,223,248,146,21,143,156,140,144,147,26,161,121,155,
+113,119,147,10,126,26,95,73,103,58,76,84,166,170,136,30,137,166,123,29,109,
+147,84,149,62,154,130,247,146,10,182,198,175,208,198,247,49,10,174,162,161,
+183,149,31,11,247,145,247,50,21,156,150,217,57,5,123,124,132,126,122,175,
+10,247,10,239,10,130,133,139,118,223,10,156,247,78,29,247,104,29,122,122,
+26,129,141,134,144,130,30,59,86,209,247,209,5,251,13,6,115,128,138,133,128,
+31,118,128,124,117,118,247,45,10,51,252,32,5,126,6,107,128,136,127,125,31,
+123,126,247,53,29,181,30,247,12,6,11,247,70,247,81,29,82,251,144,5,108,67,
+29,248,204,247,239,21,142,150,140,149,146,26,171,114,157,95,94,101,123,107,
+139,29,251,110,5,80,116,124,102,101,162,125,202,31,243,29,134,162,98,178,
+68,24,152,115,148,125,145,134,8,204,29,155,121,149,25,217,208,244,10,11,198,
+21,105,179,183,123,247,103,29,60,208,251,17,79,94,125,103,84,31,148,177,5,
+251,13,6,107,129,136,127,247,181,10,145,138,159,27,151,6,46,252,51,93,10,
+21,40,175,29,121,123,26,122,247,90,29,144,137,146,138,152,138,90,251,111,
+24,137,247,114,10,123,26,108,156,127,182,30,247,4,6,168,153,217,10,176,247,
+60,5,186,195,174,155,183,27,188,164,124,111,133,138,132,137,131,31,102,251,
+59,5,96,109,114,104,108,157,127,182,31,228,169,29,157,129,154,124,145,30,
+141,134,132,140,125,27,177,247,61,5,142,154,141,154,154,26,211,78,187,49,
+85,103,126,100,85,30,11,134,29,247,235,247,185,29,212,29,251,8,6,11,248,139,
+248,75,21,151,10,101,121,90,94,30,45,36,113,112,115,123,126,140,25,136,6,
+163,247,0,5,203,140,160,152,177,137,29,166,6,169,141,164,112,158,83,171,39,
+24,161,76,142,137,208,137,8,172,29,11,67,10,248,109,6,11,247,141,105,29,125,
+138,132,131,26,116,158,122,164,118,29,11,248,36,170,29,155,151,148,157,155,
+26,167,91,10,14,21,64,39,5,41,6,108,128,247,43,29,247,106,240,29,131,133,
+140,121,27,247,210,248,51,5,178,143,165,163,172,101,10,47,6,108,127,136,127,
+125,247,130,29,111,154,127,174,137,30,251,49,251,94,76,247,94,247,135,10,
+125,144,30,142,130,132,247,44,29,122,26,115,152,126,167,135,30,11,247,58,
+165,21,112,181,178,127,190,27,223,231,181,209,209,31,209,208,178,231,232,
+26,182,133,163,118,183,30,203,199,5,164,164,145,148,158,26,162,121,156,114,
+119,129,134,113,113,30,83,86,5,169,98,94,154,86,27,251,75,251,65,251,69,251,
+79,92,148,104,162,100,31,68,71,5,112,114,134,130,120,26,117,158,122,164,159,
+149,144,164,165,30,248,72,248,51,21,144,120,140,129,121,26,251,16,251,1,251,
+9,251,8,115,122,143,152,114,30,80,209,21,131,163,137,151,160,26,247,15,247,
+2,247,10,247,5,168,162,132,124,163,30,11,140,118,27,49,110,29,121,145,129,
+158,129,30,251,0,42,73,235,5,171,154,154,157,164,247,77,10,48,6,107,129,136,
+127,157,29,144,137,146,138,152,138,247,8,251,64,24,251,97,251,78,5,96,138,
+109,114,104,175,10,247,2,169,29,164,126,152,113,142,30,247,9,245,209,34,5,
+101,135,113,114,107,175,10,247,2,6,11,191,29,122,175,10,11,249,15,134,10,
+73,93,69,247,11,29,151,142,150,153,131,10,11,90,10,238,6,169,152,247,55,29,
+157,156,26,156,129,154,124,145,30,141,133,132,140,126,27,11,242,21,128,132,
+10,247,187,6,212,199,159,180,183,31,176,172,163,188,181,26,185,114,176,89,
+166,30,197,175,168,186,193,26,172,125,172,114,162,30,169,108,98,152,81,27,
+251,144,247,29,10,182,30,149,6,219,251,19,21,167,247,19,5,247,22,6,193,170,
+122,110,93,81,104,62,31,251,51,251,123,21,167,247,20,5,247,24,6,213,185,113,
+96,101,101,118,67,31,14,249,16,248,21,21,167,160,148,152,159,26,162,121,156,
+114,122,128,134,119,114,30,83,94,5,156,104,91,150,93,27,251,54,251,43,251,
+20,251,30,102,148,108,157,110,31,83,93,5,110,117,131,126,119,26,116,157,122,
+164,156,148,143,161,166,30,205,192,5,121,176,179,130,185,27,247,56,247,43,
+247,20,247,31,174,131,168,122,169,31,46,64,21,145,124,141,131,125,26,60,52,
+72,38,124,131,140,143,122,30,63,195,21,133,151,135,153,151,26,218,225,207,
+238,155,149,138,134,160,30,11,248,45,79,10,14,132,139,119,27,127,6,98,10,
+166,247,8,124,29,11,248,97,21,240,6,120,55,5,136,127,138,129,133,26,116,247,
+168,29,147,145,167,181,247,80,24,252,160,6,97,251,79,5,136,126,138,131,132,
+26,116,247,66,10,166,158,224,24,238,6,59,251,250,5,78,247,188,10,247,123,
+6,167,154,143,150,153,246,10,78,6,11,248,97,21,247,99,6,121,56,5,134,119,
+139,138,131,26,116,158,122,164,157,156,146,153,152,30,150,150,142,146,145,
+167,181,247,80,24,252,112,100,10,14,247,183,248,61,21,251,6,6,88,108,115,
+102,107,153,130,187,138,31,91,251,110,5,124,6,100,108,111,105,109,156,127,
+182,31,247,9,6,189,170,162,177,170,124,150,92,140,31,161,239,149,184,150,
+162,164,161,25,165,168,169,153,166,27,167,159,120,112,131,136,122,133,112,
+31,55,252,0,5,134,116,137,127,132,26,114,157,123,166,159,157,147,154,152,
+30,147,147,142,150,147,172,223,248,0,24,145,165,142,165,161,26,221,86,192,
+57,98,107,128,113,103,30,11,202,127,181,113,172,31,168,116,107,156,110,27,
+108,115,115,110,122,144,132,164,123,31,171,119,146,125,88,26,82,132,99,122,
+108,30,112,124,121,124,121,27,122,130,154,165,155,142,158,143,160,31,145,
+163,140,146,151,26,166,124,153,111,104,117,119,93,126,30,56,115,117,107,107,
+27,123,131,152,167,190,161,212,165,174,31,152,156,155,151,167,152,8,173,154,
+153,156,163,26,165,114,163,111,97,81,104,90,102,30,97,83,110,48,63,26,11,
+247,140,248,97,21,178,142,158,157,170,26,176,116,153,75,30,76,6,76,115,125,
+103,105,159,123,180,136,31,243,251,173,106,100,119,114,110,115,129,138,25,
+143,155,140,149,148,26,168,119,157,107,103,124,122,87,127,30,126,81,5,137,
+127,138,135,136,26,118,193,118,192,198,192,171,208,195,30,247,195,248,10,
+5,190,141,162,155,175,26,175,115,153,76,30,61,247,58,10,111,153,123,171,132,
+31,251,40,251,74,5,11,232,242,21,247,67,10,247,47,134,247,27,243,173,247,
+42,149,184,24,144,160,141,159,163,29,8,168,251,250,21,218,247,250,247,72,
+10,100,26,125,138,126,136,125,30,129,95,118,44,62,80,41,143,25,11,111,29,
+129,155,124,235,10,120,26,118,247,98,10,11,21,247,63,252,3,5,244,6,241,248,
+97,5,94,29,11,248,93,248,96,21,60,251,248,5,127,6,90,106,115,103,109,158,
+125,181,247,99,10,140,31,219,247,249,5,178,144,164,162,172,26,169,122,151,
+95,30,252,24,6,86,110,118,99,110,154,125,168,31,145,6,60,251,249,5,115,125,
+138,134,129,31,118,130,123,115,116,26,110,157,127,182,30,247,13,6,189,170,
+162,177,169,122,152,95,31,130,6,218,247,248,5,14,21,251,19,106,5,108,131,
+128,128,118,26,123,149,128,153,145,147,140,142,147,30,178,151,93,251,121,
+5,93,6,107,120,125,115,120,151,131,165,31,247,55,6,166,157,155,163,157,130,
+146,116,31,89,6,11,247,92,21,207,185,192,123,185,40,153,251,23,25,247,5,6,
+168,154,143,150,152,158,29,130,133,139,119,27,110,6,118,245,95,219,88,169,
+247,94,247,34,24,185,170,164,175,157,129,154,124,144,31,142,130,133,140,119,
+27,38,175,29,120,121,26,123,144,130,153,132,30,251,88,251,28,167,247,21,5,
+171,6,169,11,21,251,32,114,29,169,6,101,251,60,5,88,77,112,127,90,27,93,114,
+154,167,145,140,146,141,147,31,199,247,162,247,177,29,122,26,122,247,90,29,
+136,147,148,138,157,27,247,150,29,123,26,66,200,91,229,193,172,151,179,196,
+30,130,99,5,11,121,154,107,30,130,6,43,248,96,5,103,29,247,103,242,21,251,
+37,6,247,3,247,61,5,11,247,85,29,224,239,151,29,5,127,6,107,129,211,10,123,
+247,57,10,247,66,6,170,151,142,151,153,247,57,29,157,129,155,124,143,30,142,
+131,130,140,121,27,86,6,247,133,248,63,21,179,170,130,121,159,31,156,124,
+151,113,118,26,101,112,96,99,114,30,121,109,105,130,98,27,64,93,174,194,177,
+166,181,179,164,31,158,169,172,147,182,27,14,248,239,21,251,13,6,108,128,
+211,10,123,247,45,10,50,252,33,5,137,247,73,10,109,157,127,181,30,247,4,6,
+169,153,247,166,29,156,125,144,30,142,130,132,139,119,27,138,6,176,247,61,
+5,190,205,163,150,11,118,10,76,115,226,10,179,147,157,186,30,11,8,233,183,
+186,198,212,26,227,67,193,251,9,30,251,115,6,106,247,191,10,251,249,5,128,
+247,83,10,126,247,53,29,182,30,247,41,6,168,154,143,150,152,247,194,29,11,
+247,134,21,135,122,137,122,122,26,251,16,237,59,247,42,230,218,163,185,198,
+30,165,160,152,158,159,121,10,11,181,247,80,5,142,151,140,149,151,159,10,
+134,139,138,111,10,11,142,155,140,145,148,26,161,122,154,115,122,129,133,
+122,126,30,154,106,247,106,29,247,16,247,110,29,75,180,10,147,142,147,152,
+30,11,6,110,125,135,128,125,246,29,190,6,60,251,250,5,85,6,108,128,136,127,
+124,246,29,247,105,173,10,88,6,11,26,156,247,3,10,11,176,10,168,117,159,108,
+31,14,247,32,247,213,21,92,251,109,104,10,187,247,109,152,10,11,5,120,209,
+29,247,102,247,136,10,56,6,11,26,97,169,114,190,176,186,151,156,167,30,154,
+149,150,156,154,26,159,125,152,118,131,133,137,134,128,30,126,108,128,135,
+127,27,128,134,142,146,11,35,219,66,247,8,189,187,153,168,187,31,129,96,130,
+92,94,106,85,140,25,251,1,174,29,247,3,6,247,4,241,217,241,160,31,214,247,
+230,5,152,6,170,151,142,151,154,31,154,151,148,156,156,26,157,129,11,170,
+10,14,6,115,107,118,97,124,26,131,146,132,148,146,143,141,146,145,30,173,
+178,163,159,188,168,153,148,24,145,142,143,141,140,140,8,153,147,142,142,
+147,26,146,135,143,120,149,30,79,173,110,162,108,174,8,152,128,135,142,132,
+27,130,131,133,131,124,155,107,168,95,31,11,31,155,152,247,182,29,251,41,
+6,106,130,137,126,124,247,11,10,128,6,108,247,28,10,247,41,6,168,11,247,214,
+21,64,251,228,129,91,95,107,84,140,25,251,2,6,107,129,211,10,123,26,109,156,
+127,183,30,247,5,6,247,4,240,217,241,161,31,237,248,77,5,251,199,6,107,130,
+137,126,123,247,87,29,157,127,182,30,11,138,136,31,135,121,5,145,102,109,
+142,107,27,36,53,105,78,85,247,23,10,11,21,100,113,119,110,114,152,129,174,
+31,247,137,6,177,167,247,68,10,6,107,129,137,126,247,172,10,11,247,110,247,
+17,21,134,118,137,123,126,26,85,181,103,204,198,181,168,180,164,121,158,114,
+132,130,247,31,29,139,141,149,31,194,247,147,5,143,156,140,145,145,26,163,
+120,156,112,104,115,115,95,129,30,11,123,10,41,114,135,93,27,55,96,11,125,
+31,163,231,21,189,172,196,167,209,27,207,189,107,93,144,31,11,154,27,147,
+146,146,148,146,136,143,132,145,31,99,172,120,161,109,188,136,143,136,144,
+136,144,8,136,144,135,145,139,26,247,99,29,106,82,114,107,103,111,8,126,128,
+136,134,133,26,129,146,132,147,153,11,188,247,110,5,194,247,162,10,66,247,
+58,10,106,160,122,181,137,31,126,78,5,111,77,95,127,92,27,120,127,144,148,
+141,140,142,142,156,31,154,204,5,201,161,152,177,177,116,153,74,31,61,6,11,
+247,58,29,247,140,6,129,95,5,137,129,137,127,132,26,117,158,122,164,156,156,
+146,153,153,30,149,149,143,148,145,166,172,247,40,24,252,111,113,29,149,6,
+11,248,226,123,10,42,11,143,29,203,197,108,106,137,31,138,118,5,116,138,157,
+122,165,27,11,130,209,10,109,156,127,182,30,11,204,10,251,3,224,70,247,31,
+220,247,7,159,161,183,30,162,150,152,158,162,26,162,247,160,10,11,184,180,
+177,181,170,115,162,105,31,122,247,136,29,11,247,75,29,122,148,122,162,29,
+252,20,11,5,127,29,11,21,161,10,130,215,10,21,152,151,146,145,139,26,147,
+148,142,146,150,26,157,124,153,120,125,131,135,127,125,30,251,8,38,5,11,5,
+128,132,10,247,106,247,185,29,212,29,45,6,14,247,246,247,96,21,184,180,178,
+180,171,247,26,29,31,154,151,149,158,155,26,156,128,155,125,144,30,143,130,
+135,139,117,27,251,22,110,29,111,155,126,174,138,30,81,251,152,5,135,122,
+137,124,126,26,11,6,108,128,136,127,190,29,182,30,11,247,71,247,214,21,247,
+25,10,248,19,136,10,11,248,97,21,183,140,169,164,174,26,156,128,155,125,212,
+29,251,21,113,29,169,6,80,251,161,5,83,126,11,89,115,123,104,119,149,122,
+157,130,31,134,149,150,137,177,27,231,176,124,103,116,125,114,115,121,31,
+118,111,99,129,84,27,69,87,154,177,81,31,160,108,123,146,125,27,111,112,112,
+112,11,243,10,143,129,135,139,117,27,11,247,32,10,140,122,156,31,251,19,247,
+17,251,74,251,16,5,110,119,134,132,247,6,10,169,10,31,192,247,125,5,251,11,
+6,88,109,116,100,110,157,126,181,31,144,6,110,251,21,5,135,119,136,115,123,
+26,52,208,79,240,201,191,160,180,181,30,169,169,157,177,154,207,8,11,248,
+153,247,213,21,146,6,178,169,166,174,169,122,151,96,31,251,4,6,89,108,115,
+102,109,157,126,181,31,144,6,111,251,20,5,69,124,103,105,79,27,99,118,155,
+168,150,11,6,186,247,110,5,151,6,189,171,162,175,168,118,154,99,31,251,13,
+247,114,29,92,251,110,183,10,11,248,169,247,220,21,176,158,151,154,165,26,
+159,121,157,119,125,131,136,126,114,30,252,32,251,105,5,102,120,127,124,114,
+26,118,157,121,160,150,153,144,150,160,30,14,140,144,27,167,153,10,11,26,
+183,123,173,106,166,30,196,177,165,182,196,26,226,65,197,251,3,83,98,128,
+115,103,30,140,149,139,141,143,26,166,117,160,108,110,123,122,99,133,30,130,
+87,127,11,248,73,21,46,47,101,77,80,31,92,89,111,78,84,26,251,3,226,64,247,
+22,247,57,247,43,247,19,247,31,247,2,52,215,251,19,30,112,36,21,217,192,99,
+80,11,100,114,149,10,11,249,71,21,151,127,135,141,127,27,116,117,119,118,
+129,145,127,152,128,247,153,10,145,27,163,160,159,162,150,134,147,125,152,
+31,14,148,10,45,251,6,100,162,99,174,117,31,167,121,168,131,205,127,205,127,
+152,136,158,128,8,154,131,148,125,11,127,131,117,124,30,158,110,96,150,89,
+27,251,36,251,10,11,107,85,26,93,185,10,129,136,142,147,173,11,155,10,14,
+112,162,118,169,157,156,148,152,145,30,150,161,154,199,159,26,171,114,156,
+93,81,11,5,247,120,6,121,56,5,135,124,138,131,133,26,117,158,122,165,173,
+163,162,182,149,30,181,247,81,5,252,134,247,140,10,11,153,132,124,122,125,
+130,178,29,11,144,165,184,31,208,180,181,215,223,26,216,104,208,79,183,30,
+175,89,103,145,251,57,27,251,85,6,117,126,130,123,123,152,129,161,31,247,
+88,6,11,21,60,63,70,68,82,182,98,199,219,215,208,211,195,96,180,78,31,128,
+80,21,170,161,119,111,103,98,104,98,108,117,159,167,175,180,174,180,31,11,
+247,191,248,137,21,251,27,247,105,29,247,31,247,29,247,2,247,4,247,31,247,
+31,251,2,247,3,251,30,31,11,6,106,130,209,10,109,11,120,26,121,148,123,160,
+10,11,26,208,73,182,33,83,42,123,123,103,30,118,130,125,119,116,26,115,157,
+122,163,247,33,10,11,154,128,30,132,150,152,136,165,27,11,140,140,140,140,
+140,141,143,143,142,141,140,141,8,147,149,247,127,29,119,123,125,131,122,
+125,30,35,251,14,5,123,122,134,11,247,193,29,149,150,157,158,26,157,130,156,
+124,149,247,55,10,11,249,13,21,247,81,10,121,156,112,31,247,97,22,247,81,
+10,11,22,247,14,6,169,152,247,15,10,155,26,157,129,155,11,31,155,151,148,
+247,47,10,11,247,95,29,168,131,121,162,30,107,150,149,131,165,27,155,157,
+147,152,153,31,149,149,143,147,145,166,11,165,247,9,5,204,160,152,177,178,
+116,152,75,31,247,24,29,116,136,116,124,26,11,74,69,88,178,101,193,213,209,
+204,209,191,100,176,85,31,126,83,21,166,159,120,114,104,104,106,102,112,119,
+158,165,173,174,172,176,31,11,148,143,148,153,30,14,21,140,155,5,159,129,
+150,121,121,128,126,115,133,30,106,251,43,5,138,135,138,133,133,26,120,149,
+128,157,157,150,151,165,145,30,11,21,251,51,251,19,251,16,251,47,251,50,247,
+17,251,18,247,49,247,47,247,18,247,18,247,48,247,45,251,18,247,20,251,43,
+31,11,63,6,209,247,213,5,251,6,247,114,29,95,251,110,183,10,11,6,171,149,
+210,29,169,121,151,96,30,11,6,88,108,116,100,110,158,126,181,31,11,26,109,
+157,127,182,30,11,21,99,211,29,177,168,117,159,108,31,247,100,22,99,211,29,
+177,11,159,158,159,27,149,150,137,133,154,31,134,154,247,115,10,74,59,64,
+77,58,121,31,131,105,5,11,207,29,174,168,156,182,181,216,29,8,148,132,125,
+145,124,27,103,117,118,94,129,31,125,76,5,136,126,138,130,132,26,117,158,
+122,164,156,148,143,157,160,30,11,86,100,151,162,117,30,169,136,124,153,111,
+27,102,117,117,95,129,31,132,107,5,136,123,138,135,131,26,115,157,123,166,
+153,11,247,25,6,251,198,247,104,10,155,140,143,212,10,107,118,122,104,128,
+30,11,193,27,247,49,247,9,227,247,11,187,111,180,93,159,31,113,151,11,5,99,
+133,114,116,107,26,111,159,124,180,30,11,244,10,146,171,5,142,150,140,149,
+146,26,171,114,157,11,170,111,189,173,187,152,155,165,30,154,149,149,155,
+154,26,159,125,153,119,131,131,137,135,130,30,124,103,135,138,127,27,11,5,
+170,151,156,160,166,26,156,129,155,124,143,30,142,131,132,140,119,247,167,
+10,11,21,228,247,49,29,122,247,100,10,11,6,146,172,5,161,144,160,158,159,
+27,148,151,137,133,153,31,134,155,247,115,10,11,247,80,29,251,75,251,16,5,
+110,119,134,132,247,6,10,11,6,168,153,247,16,29,11,58,106,77,78,31,88,86,
+108,68,74,26,11,8,113,145,153,128,166,27,164,154,154,169,146,31,149,181,5,
+142,152,141,156,150,26,168,119,156,104,81,105,11,151,247,132,10,124,129,129,
+135,130,126,30,251,19,56,5,121,127,130,127,125,26,124,150,128,155,148,11,
+152,159,159,247,17,29,130,133,140,119,27,46,6,108,129,211,10,11,111,130,126,
+123,113,26,105,164,121,188,30,176,6,186,165,157,173,163,129,153,115,151,31,
+153,222,149,122,143,11,247,14,10,149,150,157,158,26,157,130,11,126,132,129,
+127,26,123,152,128,157,148,147,142,146,149,30,145,143,247,183,247,70,251,
+104,247,71,5,152,11,129,31,119,130,122,115,117,26,112,160,124,179,30,247,
+13,6,188,247,157,29,11,134,142,126,27,113,231,29,11,21,55,6,251,85,251,126,
+128,86,5,247,55,6,136,124,5,120,6,108,120,124,115,121,151,131,164,31,11,27,
+251,168,247,7,29,247,6,6,79,251,159,11,247,110,21,169,151,247,54,10,157,156,
+26,156,128,155,125,144,30,142,131,130,140,120,27,11,247,39,29,152,126,158,
+149,169,10,247,56,21,148,179,5,142,154,141,155,155,26,247,5,54,212,251,24,
+251,61,251,40,251,19,251,37,11,247,40,29,137,129,137,127,133,26,117,158,121,
+163,11,6,167,154,247,16,29,156,26,155,11,247,120,10,154,151,149,11,6,176,
+171,168,172,167,118,153,98,31,11,137,126,247,83,29,11,247,16,29,155,26,11,
+136,127,124,31,124,127,129,121,11,147,26,162,120,156,114,11,6,161,152,141,
+144,148,31,155,148,149,157,247,65,10,11,121,119,111,82,197,96,215,189,188,
+156,169,176,31,167,162,158,168,161,26,155,128,150,121,122,128,11,125,26,123,
+154,125,157,154,155,148,155,153,30,14,128,132,121,125,30,251,212,252,71,5,
+129,125,135,130,130,26,124,247,129,29,11,210,10,156,129,156,247,124,10,119,
+27,138,6,11,101,10,47,175,29,11,226,29,57,247,4,29,111,251,21,11,247,88,29,
+145,172,166,30,168,164,148,147,146,27,144,153,130,124,157,31,11,21,48,229,
+5,150,128,133,142,128,27,115,116,117,11,6,107,129,211,10,123,26,122,247,90,
+29,136,147,148,138,11,27,107,6,251,17,247,22,247,26,228,5,165,6,170,150,141,
+151,154,31,155,152,148,156,11,31,247,97,22,247,82,29,121,156,112,31,14,156,
+247,17,29,11,125,102,107,158,122,180,136,31,126,80,5,135,120,137,126,125,
+26,78,194,99,222,180,11,247,165,29,247,3,10,11,247,45,29,84,247,18,21,163,
+155,125,11,247,105,29,247,32,247,28,247,3,247,4,247,31,11,105,26,104,162,
+122,188,180,146,144,185,169,30,239,247,43,151,157,148,149,165,163,25,11,247,
+117,10,149,11,240,29,130,11,247,15,29,127,130,121,122,26,122,149,124,154,
+134,30,135,148,11,135,158,129,8,154,131,148,125,125,26,96,73,103,58,76,84,
+165,171,136,30,137,11,247,16,10,251,23,6,106,130,137,126,123,31,123,127,130,
+120,11,149,25,157,152,163,162,165,169,8,111,145,153,127,167,27,170,150,153,
+189,151,31,11,41,6,106,131,137,126,123,31,122,126,130,123,123,26,108,156,
+127,183,30,240,6,11,5,121,6,89,107,115,102,108,156,127,183,31,247,24,6,190,
+171,163,175,165,11,6,168,153,247,21,10,11,251,51,21,166,156,121,112,109,247,
+159,29,170,31,11,26,177,116,153,75,30,44,6,75,116,126,102,103,163,121,187,
+31,141,6,60,11,157,121,165,174,170,168,172,164,247,108,29,11,247,163,10,156,
+247,129,10,11,148,147,144,142,148,145,25,106,142,153,124,169,27,166,155,154,
+174,147,31,11,31,154,151,149,247,180,29,11,247,65,29,130,247,162,29,11,82,
+6,188,247,111,5,195,6,163,242,21,82,6,146,172,5,162,144,160,11,101,157,30,
+188,159,163,171,184,26,210,66,189,35,90,99,129,116,101,30,11,124,247,130,
+29,109,157,127,11,129,155,124,212,29,11,150,123,153,134,30,136,147,150,138,
+156,27,11,247,3,247,23,247,14,231,247,12,165,30,11,122,26,121,153,126,157,
+149,11,134,149,25,173,121,108,156,94,27,102,122,126,101,129,31,130,102,5,
+11,21,163,158,120,116,115,120,120,116,115,120,158,163,161,158,159,162,31,
+11,21,103,109,109,104,102,168,110,176,175,168,168,175,176,110,168,103,31,
+11,147,135,150,27,162,247,80,29,11,247,130,29,109,156,127,182,30,247,108,
+10,11,159,26,157,127,151,120,117,129,130,107,125,30,96,119,93,112,85,27,11,
+223,5,252,53,6,115,33,5,137,129,137,126,132,26,117,158,122,164,11,6,162,152,
+141,145,149,31,156,11,143,150,153,31,155,151,148,157,11,144,30,142,130,247,
+162,29,11,99,101,104,102,110,161,118,169,11,128,31,247,2,33,5,128,151,247,
+51,29,11,247,84,29,200,68,112,153,94,27,95,105,121,11,143,142,142,140,141,
+8,147,148,247,127,29,120,122,11,247,127,10,247,155,10,11,26,116,247,120,29,
+142,147,145,166,11,31,112,109,125,107,110,26,75,206,91,230,195,199,151,161,
+191,30,11,225,247,113,29,154,210,5,162,6,11,107,129,247,43,29,11,6,88,108,
+116,101,109,157,126,182,31,11,232,29,121,123,26,11,128,137,247,59,10,11,247,
+142,29,122,122,26,109,156,127,11,133,140,119,27,251,12,6,251,45,49,21,203,
+184,99,81,64,11,143,157,139,140,147,26,164,123,154,113,117,126,131,120,128,
+30,11,21,228,247,102,29,150,138,11,247,149,10,173,27,194,163,129,116,11,27,
+112,116,117,115,130,145,129,150,128,31,247,2,33,5,128,11,249,4,21,247,82,
+29,11,157,26,157,124,152,119,128,128,135,128,125,30,251,43,33,5,11,247,112,
+21,247,42,241,162,142,146,141,151,149,25,155,151,148,11,248,228,247,148,29,
+148,132,154,27,11,251,18,247,17,251,75,251,16,5,110,118,134,134,121,26,121,
+11,119,251,138,5,138,133,139,134,137,26,124,151,128,155,161,151,11,130,197,
+27,247,38,247,5,210,230,176,121,170,106,159,31,11,136,125,27,129,128,144,
+158,110,31,169,247,133,29,11,137,126,123,247,87,29,156,127,183,30,11,21,99,
+113,119,110,114,153,129,174,31,247,136,6,178,166,11,26,122,150,123,153,247,
+144,29,11,153,247,65,29,11,157,156,26,151,247,115,29,11,247,102,29,148,136,
+144,11,179,115,103,107,139,139,146,130,30,130,146,153,133,154,27,11,140,128,
+27,117,117,121,120,132,143,130,147,131,31,14,153,31,154,151,149,157,155,26,
+156,11,129,155,124,144,30,142,130,11,130,122,122,26,110,157,126,11,142,151,
+154,31,155,151,148,11,30,147,127,130,141,110,27,11,31,154,151,148,157,155,
+26,11,26,109,156,127,182,30,11,6,76,115,125,102,11,247,90,10,182,30,11,6,
+160,146,140,144,148,31,157,148,150,156,156,26,162,11,138,130,132,247,118,
+29,11,148,156,156,247,129,10,142,130,133,140,11,151,31,164,171,179,152,188,
+27,172,169,136,132,179,31,11,31,154,151,149,247,155,29,11,157,26,155,131,
+155,125,148,30,147,128,130,141,111,27,11,247,101,29,148,145,11,95,138,109,
+114,104,26,110,157,126,182,30,247,97,6,11,159,168,247,161,10,124,31,124,126,
+130,122,122,247,57,10,11,126,31,124,128,129,119,123,26,111,156,125,176,30,
+11,129,130,26,124,150,128,155,153,150,147,156,152,30,11,5,246,6,176,169,131,
+123,158,31,165,118,156,100,11,247,114,10,122,26,11,247,57,6,252,12,251,252,
+116,38,5,248,98,6,11,21,112,131,138,132,128,31,122,130,128,120,120,26,11,
+21,229,49,5,130,148,247,128,10,11,26,156,247,111,29,11,26,152,247,115,29,
+11,247,155,10,131,132,139,11,65,73,77,70,116,146,119,153,122,30,102,113,117,
+11,105,108,110,107,115,157,121,165,174,170,168,172,163,11,26,123,150,129,
+155,148,149,143,148,153,30,14,247,126,10,123,11,134,149,27,165,163,161,162,
+149,11,21,228,49,5,129,149,147,135,11,27,163,162,161,162,148,136,144,11,177,
+174,177,167,117,160,109,31,11,6,90,251,111,5,11,6,59,251,248,5,11,127,124,
+31,123,126,247,53,10,11,5,203,140,160,152,177,26,177,116,153,75,30,11,130,
+26,112,156,126,172,180,152,154,210,156,30,11,131,26,114,156,124,169,181,162,
+167,198,147,30,11,247,47,247,33,21,247,182,247,177,251,182,6,11,133,247,118,
+29,11,144,26,161,120,156,113,104,116,116,96,129,30,11,146,26,162,120,156,
+114,103,117,117,95,129,30,11,150,127,165,135,30,98,252,98,5,247,10,6,11,31,
+247,13,6,190,170,162,177,170,124,150,92,11,156,31,251,18,247,17,251,75,251,
+17,5,110,11,172,82,8,121,149,143,135,146,27,146,144,142,11,247,110,5,162,
+6,176,171,167,172,167,118,153,11,202,93,183,73,31,125,76,21,174,164,115,107,
+11,251,129,120,54,5,248,78,6,159,226,5,142,11,96,247,118,10,11,113,113,106,
+115,123,153,161,172,165,164,172,31,11,251,28,244,39,247,36,247,92,247,78,
+247,64,11,149,6,59,251,250,5,11,182,30,247,235,6,168,11,127,124,26,120,153,
+126,159,148,154,145,149,11,129,6,85,110,119,103,108,161,124,181,31,11,5,164,
+152,141,143,148,31,160,148,156,163,11,6,113,130,138,133,128,31,117,127,125,
+118,11,6,107,129,137,127,124,31,123,126,130,122,11,143,138,149,27,173,170,
+169,172,171,94,161,11,21,251,19,6,115,251,0,5,247,19,6,11,26,117,158,122,
+164,156,157,147,152,152,30,11,26,88,178,106,200,220,203,197,212,163,130,11,
+157,147,152,152,30,149,149,143,149,145,165,11,248,97,21,237,6,169,151,142,
+151,154,31,11,225,21,174,167,158,176,176,26,192,100,175,11,117,117,94,129,
+30,128,92,5,251,139,6,11,123,125,129,115,123,119,145,148,124,31,150,11,124,
+144,30,142,131,132,139,11,5,141,150,141,150,146,26,11,6,107,129,136,127,124,
+31,11,143,150,153,31,154,151,149,11,147,135,150,27,163,162,161,11,26,157,
+129,154,124,144,30,11,31,124,127,129,121,122,26,11,128,136,127,124,31,11,
+153,26,154,128,149,11,124,31,124,127,129,121,123,26,109,157,11,126,80,5,133,
+6,89,107,116,102,110,11,5,180,141,167,164,173,26,157,129,154,11,6,189,171,
+163,175,169,119,153,98,31,11,6,191,169,162,178,168,120,152,97,31,11,6,177,
+167,161,168,166,126,149,103,31,11,6,102,107,110,106,111,160,125,179,31,11,
+6,103,107,110,106,112,160,124,179,31,11,6,89,107,114,100,114,161,124,178,
+31,11,6,170,150,247,54,10,11,134,26,119,149,128,157,157,151,152,164,11,138,
+132,128,31,122,129,128,121,120,26,11,140,146,31,200,247,162,5,170,6,170,11,
+141,125,150,8,128,148,132,153,151,26,11,143,157,139,140,148,26,162,121,156,
+113,11,21,109,120,116,104,66,203,86,225,204,11,149,154,141,143,157,30,150,
+187,177,144,11,151,128,156,150,149,144,150,150,30,175,11,153,147,156,152,
+30,247,95,247,154,5,11,30,136,131,134,138,135,27,131,136,142,11,31,247,12,
+251,0,5,130,149,151,133,11,31,247,20,251,16,247,73,247,16,5,11,157,155,26,
+157,129,155,124,144,30,142,11,171,153,175,163,168,31,181,175,188,160,11,176,
+175,168,168,176,175,110,168,103,31,11,247,120,247,103,21,247,69,247,23,5,
+11,117,126,137,134,130,31,123,129,129,122,11,122,156,115,128,127,137,136,
+126,30,116,11,164,126,149,103,31,14,140,226,29,11,247,27,29,156,11,209,10,
+122,11,183,29,14,210,10,157,129,11,27,49,175,29,11,247,5,29,144,11,191,10,
+66,11,247,84,10,247,161,29,190,29,181,30,11,247,3,29,182,30,11,5,137,191,
+29,11,136,127,247,2,10,11,231,10,148,11,247,108,29,157,11,190,10,156,26,166,
+11,197,29,14,151,247,62,10,11,247,79,10,118,27,11,157,29,136,148,11,247,62,
+10,118,27,11,247,46,10,130,11,247,3,29,247,109,10,11,27,251,193,157,10,11,
+98,96,247,45,29,11,148,10,46,251,6,11,110,29,110,157,126,181,30,11,156,31,
+247,39,29,11,158,10,248,20,6,162,11,122,10,149,6,59,11,27,251,105,157,10,
+156,127,11,124,10,14,182,10,109,147,84,149,11,183,10,248,120,208,10,14,196,
+10,156,124,149,247,55,10,14,147,29,248,180,6,162,11,78,29,14,6,247,86,54,
+29,142,29,14,61,29,14,48,29,14,};
+#endif
@@ -0,0 +1,2899 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusMonoPS_Italic_cff_size = 60201;
+asm(".section .rodata");
+asm(".global fz_font_NimbusMonoPS_Italic_cff");
+asm(".type fz_font_NimbusMonoPS_Italic_cff STT_OBJECT");
+asm(".size fz_font_NimbusMonoPS_Italic_cff, 60201");
+asm(".balign 64");
+asm("fz_font_NimbusMonoPS_Italic_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusMonoPS-Italic.cff\"");
+#else
+const int fz_font_NimbusMonoPS_Italic_cff_size = 60201;
+const char fz_font_NimbusMonoPS_Italic_cff[] = {
+1,0,4,2,0,1,1,1,20,78,105,109,98,117,115,77,111,110,111,80,83,45,73,116,97,
+108,105,99,0,1,1,1,56,250,26,0,250,27,1,250,28,12,0,250,29,2,250,30,3,248,
+24,4,140,12,1,127,12,2,48,12,3,190,12,4,251,53,251,209,249,172,250,57,5,28,
+57,161,15,28,57,183,17,173,29,0,0,205,134,18,2,4,2,0,1,0,3,0,9,0,16,0,22,
+0,28,0,38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,0,123,
+0,136,0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,216,0,
+227,0,238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,1,103,
+1,115,1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,190,1,
+196,1,206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,2,38,
+2,44,2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,2,
+151,2,162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,
+3,20,3,27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,
+118,3,131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,
+3,216,3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,
+73,4,79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,
+163,4,168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,
+4,251,5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,
+5,127,5,136,5,141,5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,
+229,5,237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,
+112,6,121,6,128,6,137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,
+6,248,7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,
+115,7,122,7,134,7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,
+7,211,7,214,7,219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,
+1,8,4,8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,
+69,8,74,8,80,8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,
+8,127,8,132,8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,
+230,8,239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,
+134,9,154,9,163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,
+10,6,10,15,10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,
+114,10,123,10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,
+10,213,10,222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,
+46,11,53,11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,
+11,144,11,151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,
+214,11,221,11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,
+12,54,12,63,12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,
+153,12,162,12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,
+12,252,13,5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,
+102,13,111,13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,
+13,191,13,200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,
+14,18,14,25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,
+102,14,109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,
+14,179,14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,
+249,15,0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,
+15,84,15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,
+15,161,15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,79,16,93,73,74,
+65,98,114,101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,67,
+99,97,114,111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,
+68,99,114,111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,
+116,69,111,103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,99,
+99,101,110,116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,76,
+99,97,114,111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,110,
+103,97,114,117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,
+83,97,99,117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,
+114,105,110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,99,
+117,116,101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,
+117,110,105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,
+114,99,117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,
+114,99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,
+105,114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,
+73,109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,
+109,102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,
+109,97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,
+109,97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,
+114,99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,
+85,109,97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,
+73,98,114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,
+111,103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,
+111,116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,
+101,99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,
+110,101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,
+97,99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,77,111,110,111,32,80,83,32,73,116,97,108,
+105,99,78,105,109,98,117,115,32,77,111,110,111,32,80,83,1,127,2,0,1,0,70,
+0,87,0,218,0,234,1,68,1,82,1,98,1,121,1,175,1,214,2,4,2,63,2,99,2,104,2,211,
+3,19,3,35,3,56,3,105,3,129,3,194,3,233,3,243,4,53,4,78,4,89,4,119,4,162,4,
+236,5,115,5,248,6,11,6,76,6,135,6,209,6,243,6,251,7,98,7,156,7,255,8,23,8,
+107,8,153,8,216,9,12,9,90,9,120,9,211,9,220,10,16,10,90,10,103,10,181,11,
+6,11,85,11,153,11,164,11,175,11,229,12,38,12,111,12,130,12,135,12,188,12,
+193,12,253,13,33,13,103,13,170,13,194,13,221,13,229,13,240,14,50,14,87,14,
+103,14,130,14,175,14,230,15,23,15,32,15,86,15,108,15,167,15,173,15,215,15,
+234,16,8,16,36,16,49,16,88,16,95,16,145,16,164,16,193,16,234,17,14,17,57,
+17,63,17,102,17,143,17,170,17,204,17,250,18,37,18,81,18,116,18,159,18,170,
+18,178,18,183,18,201,18,241,19,10,19,26,19,67,19,84,19,102,19,108,19,123,
+19,126,19,165,19,204,19,212,19,247,20,28,20,49,20,70,20,79,20,85,20,123,20,
+142,20,179,20,188,20,220,20,232,20,243,20,254,21,3,21,9,21,16,21,35,21,53,
+21,66,21,98,21,122,21,139,21,170,21,187,21,210,21,241,22,9,22,33,22,63,22,
+93,22,105,22,133,22,139,22,162,22,191,22,218,22,237,22,249,22,253,23,25,23,
+46,23,52,23,67,23,90,23,117,23,130,23,141,23,152,23,161,23,168,23,177,23,
+194,23,220,23,235,23,251,24,7,24,23,24,30,24,44,24,58,24,80,24,95,24,119,
+24,143,24,160,24,184,24,204,24,218,24,241,25,8,25,29,25,39,25,61,25,83,25,
+88,25,96,25,103,25,124,25,145,25,164,25,185,25,204,25,218,25,238,26,2,26,
+22,26,34,26,46,26,57,26,76,26,95,26,114,26,133,26,152,26,158,26,170,26,179,
+26,188,26,197,26,215,26,233,26,251,27,3,27,21,27,32,27,43,27,54,27,65,27,
+76,27,87,27,93,27,99,27,116,27,133,27,150,27,167,27,182,27,199,27,214,27,
+229,27,245,28,5,28,21,28,37,28,53,28,69,28,85,28,96,28,103,28,110,28,120,
+28,126,28,134,28,149,28,164,28,179,28,189,28,204,28,219,28,232,28,247,29,
+6,29,21,29,36,29,47,29,58,29,66,29,80,29,94,29,101,29,115,29,129,29,143,29,
+157,29,171,29,177,29,191,29,203,29,215,29,224,29,231,29,240,29,249,30,2,30,
+11,30,20,30,29,30,42,30,53,30,59,30,72,30,85,30,98,30,111,30,124,30,137,30,
+150,30,163,30,176,30,189,30,202,30,215,30,222,30,229,30,241,30,253,31,9,31,
+21,31,33,31,45,31,57,31,69,31,81,31,93,31,105,31,117,31,127,31,137,31,145,
+31,153,31,161,31,169,31,177,31,185,31,193,31,199,31,205,31,211,31,217,31,
+222,31,233,31,244,31,255,32,10,32,21,32,32,32,43,32,54,32,65,32,76,32,87,
+32,98,32,109,32,120,32,131,32,142,32,151,32,160,32,166,32,171,32,180,32,183,
+32,195,32,200,32,205,32,210,32,216,32,220,32,234,32,243,32,246,33,6,33,13,
+33,18,33,25,33,40,33,46,33,61,33,68,33,82,33,97,33,120,33,127,33,130,33,152,
+33,178,33,216,33,222,247,120,247,158,21,183,29,142,26,150,130,148,126,122,
+129,129,118,135,30,130,99,217,29,152,155,150,149,160,143,30,170,247,35,5,
+252,72,80,29,187,6,39,252,97,5,89,80,29,248,91,6,174,247,53,243,29,122,129,
+129,118,134,30,115,251,4,5,251,195,6,11,86,29,124,26,45,206,75,238,247,7,
+246,226,247,7,164,30,11,248,205,247,97,21,149,68,29,251,86,160,29,158,31,
+247,24,6,110,251,30,5,114,75,108,132,88,27,251,9,69,196,234,155,141,160,144,
+159,31,154,210,151,195,180,200,191,180,25,173,183,187,156,193,27,192,182,
+126,116,162,31,152,126,149,128,136,26,137,103,5,133,151,130,148,156,149,149,
+159,143,30,159,228,5,141,149,247,80,29,134,30,138,135,5,170,102,88,155,76,
+27,72,75,117,96,84,31,78,91,91,66,124,68,123,67,24,134,116,137,118,118,26,
+251,14,226,64,247,32,203,213,158,173,204,30,11,212,29,251,4,221,63,247,12,
+243,247,23,189,179,135,29,11,248,184,248,21,21,170,105,90,156,80,27,251,48,
+251,25,251,19,251,41,34,213,71,247,6,208,210,159,174,198,31,178,162,156,157,
+155,26,150,130,148,127,131,135,137,130,128,30,92,78,74,116,65,247,11,29,180,
+178,129,123,160,31,149,131,163,112,135,26,137,103,5,133,151,130,149,156,149,
+149,159,143,30,159,229,243,29,123,128,129,118,135,30,11,167,29,133,88,21,
+227,203,62,34,251,44,237,29,11,58,29,64,82,146,29,130,148,126,122,129,129,
+118,134,30,11,248,18,247,144,21,101,29,95,251,95,5,38,160,29,158,31,247,144,
+141,29,41,6,11,247,234,195,29,231,203,29,251,125,6,116,125,128,121,124,247,
+49,29,128,120,125,170,29,248,91,6,183,247,94,5,141,147,139,140,143,26,150,
+129,147,127,122,129,129,119,135,30,105,251,45,5,251,153,6,11,248,146,247,
+241,21,196,108,91,166,70,27,251,27,251,19,251,15,251,23,40,210,69,239,208,
+197,165,195,195,31,115,32,131,80,66,80,77,113,29,11,248,142,22,247,3,248,
+148,5,168,68,29,251,41,6,115,125,247,41,29,207,6,45,252,67,251,84,248,118,
+5,251,2,80,29,187,247,162,29,232,248,66,247,84,252,117,5,11,248,220,248,150,
+21,120,29,251,12,232,46,247,13,210,213,168,193,202,215,29,137,130,179,29,
+185,185,124,115,247,50,29,147,156,149,149,159,144,30,163,247,2,5,141,148,
+139,139,143,26,151,130,147,126,122,129,129,119,134,30,11,21,154,150,143,145,
+150,26,151,130,148,126,132,134,137,131,127,247,21,29,124,129,135,132,128,
+26,127,148,130,152,146,144,141,147,150,30,14,248,29,54,29,11,247,174,248,
+55,21,163,247,3,5,141,148,139,139,141,26,151,130,148,126,122,129,129,119,
+134,30,115,251,5,5,69,6,115,125,247,41,29,207,6,83,251,149,5,137,129,138,
+131,128,26,80,193,100,222,192,213,154,160,188,30,171,153,150,149,154,26,151,
+130,148,127,133,136,138,134,129,30,117,97,64,122,83,27,84,104,162,175,145,
+140,144,140,145,31,195,247,149,5,247,107,6,162,154,151,157,154,131,145,118,
+31,11,248,124,248,55,21,251,252,251,235,204,247,184,5,182,96,29,251,29,6,
+115,247,69,29,180,6,69,251,209,5,100,205,29,158,31,236,6,247,251,247,233,
+76,251,182,5,99,6,115,247,69,29,247,20,96,29,104,6,208,247,209,5,176,103,
+29,11,248,99,248,4,21,107,251,39,123,64,124,101,112,85,29,11,21,161,154,150,
+157,153,130,146,119,31,251,128,6,116,125,128,121,125,170,29,14,248,28,195,
+29,247,27,6,162,154,151,157,154,131,145,118,31,251,212,80,29,247,25,6,39,
+252,97,5,251,27,160,29,158,31,247,212,6,162,154,151,156,154,130,146,118,31,
+251,24,6,14,248,149,247,221,21,59,29,198,6,164,153,148,155,156,125,148,114,
+31,84,6,114,29,8,14,247,229,190,21,247,119,29,247,47,6,125,74,138,130,5,134,
+7,130,138,150,129,150,27,156,149,148,160,143,31,165,247,11,5,252,103,6,114,
+251,8,247,78,29,150,149,159,143,30,154,207,5,247,48,6,39,252,97,5,38,80,29,
+247,143,68,29,11,21,247,50,247,0,5,156,151,143,144,151,26,151,130,148,126,
+133,132,136,133,130,30,251,15,55,54,223,5,145,132,133,142,133,27,123,124,
+247,136,29,171,29,226,198,83,57,32,174,29,11,247,84,247,42,5,143,6,162,154,
+151,157,154,131,145,118,31,251,2,80,29,172,6,251,41,251,6,44,247,6,5,173,
+6,162,154,151,157,154,131,145,118,31,251,3,6,116,125,247,41,29,142,6,247,
+17,251,40,251,107,251,61,5,131,6,116,125,128,11,21,154,149,144,147,148,26,
+152,130,148,126,131,134,137,131,128,247,26,29,139,139,149,156,30,14,6,114,
+125,130,122,123,153,130,164,31,11,244,172,21,247,19,29,206,29,140,7,107,172,
+186,123,202,27,247,22,240,208,228,164,125,167,118,155,31,71,29,11,147,29,
+78,110,125,73,70,30,102,103,111,115,118,125,125,128,114,135,93,138,8,135,
+109,29,147,6,242,137,153,132,174,71,185,44,24,152,113,140,139,168,138,8,11,
+247,241,247,179,21,247,116,247,117,5,152,247,155,29,159,31,171,6,251,74,251,
+75,35,247,75,5,172,68,29,251,2,6,116,125,128,120,125,236,29,120,125,148,132,
+159,31,247,22,89,29,88,6,247,87,247,88,247,4,251,88,5,86,6,117,124,247,41,
+29,247,23,89,29,125,6,14,247,225,247,120,21,141,149,140,145,143,26,154,130,
+148,124,125,129,128,116,134,30,132,107,124,67,127,105,121,115,25,113,120,
+113,124,114,27,100,115,175,198,244,207,247,10,216,167,31,163,147,144,144,
+153,26,154,129,149,122,101,84,98,82,99,30,100,81,112,55,72,26,55,185,81,208,
+183,177,161,182,170,30,96,157,170,117,184,27,238,222,247,11,247,35,203,127,
+177,109,177,31,168,114,113,157,119,27,126,129,129,125,128,144,131,153,131,
+31,187,108,156,105,73,26,251,9,79,40,69,105,120,166,186,161,143,170,148,182,
+30,11,247,44,187,21,94,179,183,120,201,27,247,58,247,50,247,72,247,80,188,
+129,179,119,176,31,224,222,5,150,150,142,144,147,26,150,130,147,128,130,135,
+137,127,128,30,59,61,5,185,95,100,156,79,27,251,60,251,51,251,70,251,81,92,
+148,101,160,99,31,54,56,5,129,128,136,135,131,26,128,147,131,151,147,145,
+142,149,149,30,235,247,45,21,124,176,135,160,174,26,247,48,247,23,247,43,
+247,27,183,174,123,104,170,30,163,103,21,154,98,143,120,105,26,251,49,251,
+22,251,43,251,28,95,104,156,175,107,30,11,247,192,248,239,21,216,29,251,0,
+252,137,73,29,93,119,87,80,30,11,247,109,247,111,21,232,207,224,110,168,80,
+169,251,91,25,230,68,29,87,6,108,247,72,110,193,57,178,247,147,247,80,24,
+154,68,29,251,11,6,115,125,128,120,125,148,132,159,31,168,6,251,200,251,119,
+188,247,119,5,209,68,29,251,62,143,29,11,138,124,5,123,149,128,154,153,148,
+150,161,144,30,150,192,5,141,148,140,147,142,26,155,123,148,110,69,116,124,
+34,54,30,90,80,115,111,125,129,116,122,132,137,81,138,8,136,6,179,247,77,
+5,183,6,164,153,247,111,29,11,247,175,22,247,90,116,29,86,6,207,247,209,5,
+180,103,29,251,31,6,114,126,247,109,29,186,6,71,251,209,5,251,148,6,207,247,
+209,5,188,116,29,251,32,6,115,247,69,29,178,6,68,251,209,5,112,205,29,158,
+31,247,83,6,118,247,132,29,132,153,154,151,150,159,143,30,14,247,213,247,
+58,21,247,122,247,236,40,252,95,5,69,80,29,247,41,6,162,154,151,157,153,130,
+146,108,29,153,130,146,247,68,29,6,162,154,151,157,161,29,11,140,144,140,
+145,145,26,154,130,148,125,120,133,130,97,130,30,123,70,5,133,114,139,139,
+136,26,127,148,131,151,152,146,146,157,147,30,145,153,147,151,149,151,8,172,
+169,208,160,220,27,215,182,119,104,116,123,117,109,124,31,122,105,83,131,
+59,27,110,88,29,179,6,247,19,196,121,98,118,123,115,111,122,31,117,107,92,
+129,75,27,67,88,150,167,78,31,144,130,134,140,133,27,124,129,128,124,11,224,
+190,21,89,80,29,247,199,6,244,240,228,232,191,109,177,77,164,31,210,176,174,
+186,199,26,211,79,189,51,30,251,151,80,29,187,6,149,251,87,21,181,247,87,
+5,247,52,6,200,182,107,92,112,122,109,111,117,157,29,111,160,104,151,78,145,
+64,148,139,139,118,147,8,120,147,125,155,154,26,180,204,174,215,175,170,132,
+127,158,30,148,132,157,120,135,26,137,109,5,132,151,130,148,156,150,149,160,
+143,30,154,207,5,141,148,139,139,142,26,151,130,148,127,125,128,129,123,133,
+30,165,111,96,153,85,27,251,4,50,79,63,116,152,114,159,125,31,164,121,166,
+132,212,132,192,133,164,133,161,247,77,29,11,98,247,26,119,202,112,181,110,
+153,25,165,158,153,153,176,185,241,247,16,141,141,184,142,11,5,98,6,115,125,
+247,41,29,247,24,6,162,154,151,157,154,130,145,118,31,101,6,191,247,134,189,
+185,139,139,152,148,25,163,173,169,149,176,27,179,157,134,120,158,31,154,
+125,146,123,119,26,135,138,131,137,132,30,88,251,130,5,98,80,29,247,24,247,
+144,29,190,247,131,5,142,149,140,149,147,26,209,85,184,55,81,11,111,73,27,
+98,112,165,178,143,140,146,140,145,31,205,247,194,5,37,80,29,187,6,85,251,
+141,5,136,127,138,128,128,26,110,152,110,161,120,30,123,157,164,131,175,27,
+203,11,6,206,247,209,5,174,116,29,251,6,169,29,166,6,72,251,209,5,251,41,
+6,207,247,209,5,163,96,29,32,6,115,126,247,109,29,168,6,71,251,209,5,251,
+41,6,207,247,209,5,162,6,162,247,93,29,121,31,251,3,169,29,175,6,11,247,230,
+247,144,21,247,122,247,152,5,161,247,22,29,120,125,176,29,120,125,170,29,
+160,6,247,12,251,150,95,251,95,5,38,160,29,158,31,247,144,6,161,154,151,157,
+153,130,146,119,31,41,6,11,8,197,166,175,168,160,26,151,130,147,127,131,135,
+137,130,128,30,92,78,74,116,65,247,11,29,180,178,129,123,160,31,149,131,163,
+112,135,26,137,103,5,133,151,130,149,156,149,149,159,143,30,159,229,243,29,
+123,128,129,118,135,30,138,136,5,170,105,90,156,80,27,251,48,251,25,251,19,
+251,41,11,150,29,120,125,127,29,116,124,247,41,29,247,32,6,162,154,151,156,
+154,130,146,119,31,92,6,186,247,107,5,11,119,66,139,139,137,26,127,148,130,
+152,152,147,146,157,146,30,148,165,149,158,151,155,8,187,174,202,165,218,
+27,218,189,108,90,105,119,106,104,116,31,113,99,83,127,59,27,109,88,29,188,
+6,204,204,125,119,162,31,154,126,147,121,118,26,104,120,102,107,113,30,108,
+102,89,124,74,27,58,86,155,181,80,31,147,128,131,142,132,27,126,124,124,125,
+11,6,116,125,247,115,29,158,31,11,207,247,209,5,178,104,29,251,20,88,29,175,
+6,111,251,17,5,96,55,85,122,82,27,96,116,153,166,149,141,151,142,154,31,163,
+246,5,184,6,165,177,29,88,184,106,209,199,197,154,173,208,30,11,247,185,190,
+21,247,119,29,247,47,6,125,74,138,130,5,134,7,130,138,150,129,150,27,156,
+149,149,159,143,31,165,247,11,5,252,103,6,114,251,8,5,138,133,138,136,136,
+26,127,148,130,152,155,150,149,159,143,30,154,207,5,247,48,6,39,252,97,5,
+38,80,29,247,143,89,29,14,247,8,93,29,121,124,170,29,148,6,247,52,11,30,248,
+63,247,9,21,177,162,160,173,176,26,186,103,173,88,73,76,82,78,115,147,122,
+158,123,30,95,113,116,103,98,26,89,177,104,193,209,205,199,204,165,130,158,
+117,157,30,102,247,26,21,171,161,120,111,103,103,107,97,107,117,157,165,175,
+177,247,52,29,95,104,116,160,170,178,180,174,183,31,11,111,25,110,111,103,
+123,96,27,75,103,172,197,160,143,170,148,179,31,182,247,93,5,32,6,115,126,
+129,121,124,149,131,158,31,190,6,107,251,39,5,131,102,135,105,112,26,54,199,
+85,232,195,195,164,180,176,30,169,173,159,187,157,225,171,247,42,24,180,116,
+29,251,38,6,115,126,129,120,125,149,131,157,31,11,248,251,195,29,168,6,162,
+154,151,157,154,131,145,118,31,251,41,80,29,207,6,69,251,216,5,53,120,57,
+72,53,27,66,90,187,210,150,140,149,141,150,31,210,247,218,5,209,6,161,154,
+151,157,154,131,145,119,31,251,41,6,115,125,128,120,125,148,132,159,31,166,
+6,69,251,216,5,136,123,137,124,11,248,211,195,29,231,6,161,154,151,157,154,
+131,145,119,31,251,188,160,29,158,31,247,44,6,65,251,235,5,64,123,63,80,60,
+27,91,99,159,182,100,31,166,247,17,247,44,29,118,134,30,107,251,41,145,133,
+5,77,196,186,115,204,27,244,244,222,238,160,31,11,6,113,125,130,122,123,153,
+130,165,31,11,6,162,154,151,157,153,130,146,119,31,11,6,247,119,29,191,6,
+163,247,62,29,129,120,124,149,132,158,31,175,6,39,252,97,5,251,148,6,247,
+119,29,183,6,162,247,62,29,128,121,125,149,131,158,31,184,6,39,252,97,5,103,
+205,29,158,31,11,31,32,6,252,18,252,111,231,248,60,5,186,6,162,247,93,29,
+121,31,251,41,6,115,125,129,120,125,149,131,157,31,190,6,38,252,97,5,93,205,
+29,158,31,246,6,248,16,248,100,49,252,49,5,93,205,29,157,31,247,41,6,163,
+153,149,158,11,21,152,149,145,148,150,26,151,131,147,126,247,72,29,43,5,126,
+130,133,129,128,26,127,148,131,151,146,146,142,146,150,30,39,217,21,110,114,
+115,111,116,152,126,162,169,164,163,167,160,124,154,117,31,247,151,22,111,
+113,114,112,116,152,126,162,169,165,163,167,160,123,154,117,31,14,219,29,
+157,154,131,145,119,31,251,42,6,116,125,128,120,125,144,29,11,248,152,162,
+29,11,247,6,29,103,129,133,123,27,128,131,143,158,108,31,158,109,127,143,
+118,27,113,114,158,29,168,173,149,144,157,27,150,149,135,128,156,31,115,174,
+157,132,162,27,166,164,151,169,175,31,158,154,144,146,11,6,247,39,29,11,247,
+98,248,4,21,72,251,209,5,38,205,29,158,31,247,142,96,29,41,6,207,247,209,
+5,247,166,6,110,251,22,138,125,5,127,147,132,152,156,150,150,158,143,30,179,
+247,76,5,252,113,6,115,126,129,120,125,149,131,157,31,11,247,3,29,148,130,
+152,155,150,149,159,143,30,150,189,5,247,125,6,252,1,251,216,130,247,90,29,
+143,26,150,130,148,126,247,13,29,11,247,53,172,21,106,176,183,123,193,27,
+247,42,247,29,247,21,247,33,178,130,169,118,171,31,213,200,5,151,149,143,
+145,148,26,150,131,147,127,132,136,138,128,126,30,64,77,5,171,103,96,154,
+85,27,251,41,251,29,251,21,251,32,101,148,108,159,108,31,62,76,5,11,21,131,
+131,134,126,122,31,112,106,137,138,126,27,127,129,143,152,119,31,172,87,136,
+140,121,27,99,69,90,111,127,147,132,153,147,145,142,145,146,31,161,162,164,
+154,151,27,145,158,130,132,149,31,115,172,164,128,160,27,177,211,188,165,
+150,129,149,128,31,14,247,123,247,152,5,160,247,22,29,121,124,176,29,121,
+124,170,29,160,6,247,12,251,150,11,135,26,136,97,5,133,151,130,149,206,29,
+161,239,5,141,149,139,139,142,247,112,29,129,119,135,30,11,6,162,247,93,29,
+120,31,11,6,165,153,148,155,156,125,148,113,31,11,108,228,124,181,116,173,
+117,149,25,165,160,148,147,165,170,194,206,151,149,166,143,134,120,24,137,
+133,139,137,138,26,120,148,129,155,153,148,149,161,144,30,146,172,5,141,146,
+140,148,143,26,155,126,147,113,87,118,126,66,75,30,77,69,129,130,111,135,
+11,21,119,126,124,117,74,186,103,225,193,185,154,169,176,247,101,29,128,129,
+133,130,135,30,129,115,134,132,125,128,8,120,116,102,128,101,227,29,6,39,
+252,97,5,109,80,29,247,42,6,162,154,151,157,11,119,31,112,6,247,119,29,160,
+168,29,37,6,251,116,251,226,59,247,226,5,35,80,29,158,107,29,11,6,165,247,
+10,5,183,6,164,153,148,155,156,125,148,114,31,251,30,140,29,181,189,29,95,
+57,29,247,31,6,164,153,148,155,156,125,148,114,31,97,6,170,247,40,5,11,248,
+28,195,29,247,26,6,161,154,151,157,153,130,146,119,31,251,209,6,117,124,127,
+121,125,148,132,159,31,247,23,6,39,252,97,5,251,26,204,29,247,209,6,161,154,
+151,157,153,130,146,120,31,251,24,6,11,31,136,146,136,142,131,143,8,147,120,
+105,146,119,27,76,77,82,66,123,31,128,85,5,66,160,29,158,31,210,189,29,60,
+160,29,158,31,248,164,6,161,154,151,157,153,130,146,120,31,11,248,185,124,
+29,154,247,131,29,11,141,25,251,8,6,116,125,128,120,124,148,133,159,31,247,
+6,6,224,134,244,221,153,221,224,248,27,24,189,168,29,40,6,251,61,102,21,216,
+192,88,64,39,41,44,37,58,87,189,215,240,236,233,245,31,11,95,229,116,185,
+111,170,112,149,25,169,156,164,159,184,183,190,187,153,147,175,142,11,134,
+130,26,128,147,131,151,145,145,142,147,149,30,248,62,247,242,21,153,116,145,
+117,110,26,251,0,251,0,37,251,8,97,110,149,163,109,30,112,170,21,124,170,
+135,154,165,26,247,1,246,240,247,8,181,167,130,116,169,30,11,247,71,29,120,
+31,11,21,145,127,147,130,119,126,123,113,81,190,101,217,190,185,247,33,29,
+131,132,121,132,30,103,127,91,113,86,27,112,115,146,151,125,31,132,144,125,
+157,141,26,14,248,150,21,120,29,251,12,232,46,247,13,210,212,168,193,203,
+215,29,11,6,40,252,97,5,94,57,29,247,36,104,29,93,6,188,247,117,5,179,6,203,
+137,165,115,166,55,247,103,29,11,179,100,85,160,76,27,71,73,113,92,83,31,
+85,92,96,70,126,78,121,58,24,136,124,137,123,123,26,11,248,5,247,244,247,
+24,29,172,114,162,102,31,14,248,4,21,55,252,25,5,74,123,84,94,75,27,251,20,
+142,29,247,21,6,229,137,224,209,157,230,235,248,78,24,251,180,6,115,125,247,
+41,29,11,6,115,125,247,109,29,11,21,251,0,108,118,133,133,135,8,133,135,134,
+131,132,26,130,147,131,148,143,141,139,140,143,30,204,159,84,251,151,5,140,
+117,117,139,124,27,115,125,130,123,128,147,133,151,31,247,70,6,11,251,100,
+6,116,125,128,121,124,181,29,161,29,69,6,219,247,25,5,11,247,48,29,137,140,
+179,87,31,183,83,124,247,84,29,125,129,26,126,150,128,153,148,145,143,149,
+147,30,193,11,148,132,159,31,186,6,97,251,87,5,251,151,247,20,29,188,6,162,
+154,151,157,154,131,145,118,31,251,12,160,29,158,31,158,6,39,252,97,5,98,
+6,11,248,72,195,29,247,27,6,162,154,151,157,154,131,145,118,31,251,212,160,
+29,158,31,247,25,6,39,252,97,5,251,27,160,29,158,31,11,21,208,247,209,5,247,
+4,189,29,219,248,4,21,251,4,6,150,191,5,185,149,173,174,175,27,153,157,135,
+132,161,31,142,138,144,138,125,119,130,119,133,113,25,14,105,106,247,37,29,
+11,21,247,50,247,0,5,156,151,143,144,151,26,151,130,148,126,133,133,137,132,
+129,30,251,15,55,54,223,5,145,132,133,142,133,27,123,124,247,136,29,21,251,
+50,251,1,5,123,129,134,133,127,26,127,148,130,152,145,145,142,145,149,30,
+247,15,223,224,56,5,132,146,145,136,145,27,155,154,153,155,146,198,29,5,89,
+160,29,158,31,247,85,6,162,154,150,158,161,29,48,6,188,247,117,5,81,173,247,
+63,29,11,247,20,29,247,195,6,120,49,5,138,134,138,135,135,26,128,148,130,
+152,206,29,170,247,35,5,252,93,160,29,158,31,187,6,11,151,130,148,127,133,
+135,137,133,129,30,109,93,62,117,78,27,44,74,197,224,144,139,143,140,147,
+31,248,9,190,21,251,254,6,220,174,224,194,231,27,227,205,82,66,135,31,11,
+249,7,248,62,21,155,148,144,145,151,26,149,131,147,129,133,133,137,134,130,
+30,252,143,251,173,5,124,131,133,131,128,26,128,147,131,149,145,141,140,146,
+152,30,14,138,133,31,46,252,59,5,136,125,138,132,135,26,124,148,131,154,159,
+145,147,170,143,30,235,248,72,5,141,149,140,144,147,26,209,87,186,60,83,86,
+118,95,84,30,11,118,30,128,148,112,174,144,26,142,185,5,145,127,148,129,122,
+129,129,118,134,30,116,251,1,247,78,29,150,149,160,143,30,143,155,11,142,
+156,31,177,247,67,5,185,6,165,153,148,156,155,125,148,113,31,251,30,6,114,
+125,130,123,122,153,130,164,31,177,6,103,251,61,5,134,116,137,124,125,26,
+11,6,113,125,130,123,122,153,130,165,31,11,6,161,154,151,157,161,29,11,160,
+29,159,31,11,80,29,187,6,39,252,97,5,89,80,29,247,62,68,29,71,6,11,170,29,
+227,6,251,39,252,70,115,247,254,5,69,6,251,76,251,254,181,248,70,5,227,6,
+162,154,151,157,154,131,145,118,31,251,41,6,116,125,128,11,248,55,21,251,
+58,80,29,247,4,189,29,251,48,160,29,158,31,247,254,6,162,154,151,157,11,168,
+177,142,140,144,140,146,30,140,142,139,142,141,26,150,11,138,133,138,134,
+136,26,125,149,130,154,155,148,149,159,142,30,148,193,5,140,142,139,141,139,
+26,140,140,5,141,7,140,142,139,142,143,26,157,125,147,110,11,21,247,65,29,
+231,29,155,124,160,168,164,163,167,160,247,139,29,218,29,122,116,108,105,
+108,105,112,121,155,163,171,172,169,175,31,14,239,248,97,245,29,11,247,42,
+29,214,29,149,30,247,14,247,64,29,155,146,11,162,29,14,144,165,184,31,208,
+180,181,215,223,26,216,104,208,79,183,30,175,89,103,145,251,57,27,251,85,
+6,117,126,130,123,123,152,129,161,31,247,88,6,11,21,76,81,86,81,95,173,106,
+185,201,197,193,197,181,104,173,95,31,132,99,21,165,158,123,116,103,104,106,
+101,114,119,156,160,177,172,171,179,31,11,248,29,171,29,225,199,83,11,21,
+147,131,134,142,132,27,122,125,125,123,133,142,134,146,132,247,118,29,146,
+145,136,146,27,154,155,153,153,142,132,153,135,142,31,14,31,114,108,98,127,
+90,27,251,90,251,158,21,186,247,107,5,247,37,6,199,169,133,121,167,31,162,
+123,155,113,116,26,73,69,79,62,30,14,128,113,104,31,119,123,131,129,128,26,
+127,148,131,152,146,148,142,145,145,30,11,155,150,150,159,144,30,163,247,
+4,5,247,147,6,252,58,252,82,125,73,5,11,6,116,125,128,120,125,148,132,11,
+154,130,145,119,31,11,21,145,148,142,147,147,26,151,131,148,126,129,131,133,
+126,130,30,46,251,27,5,132,129,136,132,131,26,126,147,130,152,149,147,145,
+152,149,30,11,21,186,247,107,5,247,26,6,247,7,187,112,74,67,76,88,49,31,14,
+249,17,248,239,21,37,6,116,125,128,121,123,147,133,160,31,186,6,94,251,103,
+5,202,103,89,168,67,27,251,34,251,24,251,24,251,35,11,6,87,112,112,105,99,
+186,29,11,147,26,149,129,149,128,129,131,135,127,129,30,251,3,251,15,5,130,
+128,135,132,131,247,117,29,148,149,145,149,149,30,14,248,59,209,29,247,26,
+59,229,251,11,31,11,6,161,154,151,157,154,131,145,118,31,11,6,115,126,129,
+121,124,149,131,157,31,11,148,132,158,31,11,182,29,130,88,21,11,247,127,247,
+45,196,29,14,247,10,29,251,27,41,5,125,129,134,132,128,26,127,148,130,152,
+146,11,251,0,37,251,5,49,79,194,221,247,1,247,0,240,247,9,31,11,129,131,135,
+137,128,128,30,252,75,252,45,5,11,148,132,159,31,168,6,251,76,251,100,41,
+247,100,5,169,6,162,154,151,157,154,131,145,118,31,251,3,6,116,125,128,11,
+153,148,155,156,125,148,113,31,251,24,57,29,173,6,117,35,5,134,116,137,127,
+127,26,11,115,107,26,97,91,100,88,109,119,247,2,29,214,212,201,203,11,130,
+30,77,72,84,114,71,27,41,67,211,237,153,141,153,142,154,31,154,208,5,247,
+6,163,247,1,232,247,0,27,11,6,39,252,97,5,98,205,29,158,31,247,32,96,29,91,
+6,11,148,132,159,31,247,2,6,251,167,252,97,5,111,80,29,247,43,6,162,154,151,
+157,11,248,69,21,251,41,251,30,251,21,251,32,34,218,64,247,1,247,44,247,29,
+247,20,247,33,245,61,213,251,4,31,11,247,135,29,136,26,128,148,130,152,155,
+150,149,159,143,30,167,247,21,5,141,149,139,139,11,5,89,205,29,158,31,247,
+176,6,247,26,199,176,222,218,74,182,251,10,31,251,37,6,11,248,24,21,143,155,
+139,141,141,26,155,129,148,123,123,132,131,114,134,30,73,251,200,5,137,125,
+137,126,127,26,11,26,107,165,120,183,185,184,161,161,148,132,147,130,136,
+134,138,136,135,30,126,112,134,137,121,27,118,128,145,151,11,247,8,29,247,
+41,29,247,32,247,144,29,11,129,130,134,129,130,30,251,3,251,16,5,129,128,
+136,133,130,26,129,149,130,151,148,150,145,149,148,30,14,6,70,251,209,5,11,
+130,148,126,123,128,129,119,135,30,106,251,44,5,251,16,160,29,158,31,247,
+14,6,11,153,154,148,134,147,129,143,31,147,120,104,146,120,27,76,77,82,66,
+123,31,128,85,5,66,6,116,125,128,11,123,128,128,119,134,30,131,99,5,251,25,
+247,20,29,247,169,6,120,49,5,138,133,138,135,136,26,11,248,192,247,145,21,
+162,154,150,158,153,130,146,119,31,252,38,142,29,14,31,251,6,6,115,125,247,
+41,29,151,6,11,248,148,21,11,21,251,17,251,140,5,136,132,137,133,133,26,123,
+151,127,156,154,148,145,159,155,30,247,100,247,161,5,11,247,207,21,228,247,
+95,5,152,169,141,146,153,26,161,122,156,115,247,134,29,11,138,142,129,148,
+31,14,5,98,6,115,247,69,29,247,24,247,16,29,101,6,11,5,184,6,161,154,151,
+157,154,130,145,120,31,251,7,6,116,125,247,41,29,151,6,11,31,138,136,5,136,
+135,138,135,135,26,130,144,132,150,133,30,247,238,251,80,251,238,251,80,5,
+128,11,124,154,117,31,247,98,22,247,65,29,247,139,29,6,162,153,151,157,154,
+131,145,119,31,11,6,117,124,127,122,124,148,132,159,31,11,6,116,125,129,121,
+124,149,131,11,155,149,149,160,144,30,11,21,251,48,242,29,247,14,226,11,244,
+29,217,22,251,12,251,115,5,135,132,138,134,134,26,124,11,248,211,21,251,60,
+251,50,251,70,251,82,251,23,220,47,247,8,247,62,247,50,247,69,247,82,11,144,
+141,146,149,30,247,15,247,64,29,154,147,137,142,11,247,89,29,251,4,221,63,
+247,12,243,247,23,189,179,151,11,248,203,247,113,29,156,26,238,247,89,29,
+11,21,161,150,148,156,156,128,147,117,31,252,206,247,18,29,14,247,15,29,145,
+141,146,11,30,167,163,147,149,152,26,150,130,147,127,129,134,11,38,6,116,
+125,128,121,123,147,133,159,31,186,6,11,5,251,26,247,20,29,247,174,6,120,
+49,5,138,134,138,135,136,26,127,148,130,11,247,83,29,196,184,105,171,92,31,
+132,96,21,165,157,11,22,212,6,247,84,248,13,165,252,13,5,212,6,247,65,248,
+148,5,150,6,161,154,151,11,26,184,114,168,87,153,30,204,163,172,175,188,26,
+203,74,179,33,57,81,124,106,97,30,11,247,115,21,152,247,75,29,127,130,135,
+137,131,128,247,21,29,11,242,210,202,168,200,200,31,122,65,5,241,6,161,154,
+151,156,155,131,145,119,31,91,6,11,247,21,29,125,129,134,132,128,26,127,148,
+130,152,146,143,141,147,151,30,14,247,81,29,223,188,247,4,182,180,134,130,
+174,31,11,27,147,145,137,131,151,31,127,159,150,134,151,27,166,165,166,166,
+170,112,158,96,105,11,75,26,81,107,80,91,107,30,113,101,99,133,251,33,27,
+251,88,6,116,127,130,123,11,27,98,96,160,160,137,31,137,171,139,139,135,144,
+8,145,135,134,141,133,27,14,249,86,21,106,247,53,29,112,31,14,21,221,195,
+84,58,32,34,35,251,0,54,83,193,220,247,3,242,240,247,5,31,11,159,143,146,
+160,30,162,148,150,151,155,26,152,130,148,126,134,134,138,136,133,30,11,247,
+94,29,118,11,21,154,149,143,247,7,29,11,105,247,40,29,170,172,11,6,83,91,
+5,64,7,247,192,247,141,251,192,247,142,5,63,7,195,92,5,11,134,139,135,138,
+136,31,125,75,5,153,88,108,144,94,27,251,35,251,0,64,11,170,29,151,6,247,
+19,251,115,251,129,251,130,5,124,6,116,125,128,11,251,23,251,47,251,21,44,
+75,212,247,0,247,50,247,22,247,42,247,29,31,11,21,170,247,32,5,247,20,6,247,
+3,185,118,88,92,96,118,43,31,14,27,165,164,151,169,176,31,158,155,143,145,
+247,56,29,140,143,143,26,148,134,146,128,145,30,251,237,247,80,247,238,247,
+80,5,11,154,131,145,119,31,85,6,247,251,248,135,5,149,6,162,154,151,157,154,
+11,251,1,5,124,132,133,130,127,26,127,149,130,151,143,152,144,143,144,30,
+11,5,141,148,139,139,143,26,150,130,148,126,11,154,150,146,155,152,30,247,
+87,247,135,5,11,5,160,168,29,251,12,6,116,125,128,11,21,163,158,120,116,115,
+120,120,116,115,120,158,163,161,158,159,162,31,11,21,103,109,109,104,102,
+168,110,176,175,168,168,175,176,110,168,103,31,11,21,59,64,66,61,81,181,97,
+197,220,214,212,217,197,97,181,80,31,11,147,159,114,30,144,133,136,140,134,
+27,126,128,128,126,116,197,111,187,11,248,205,248,55,21,251,253,6,118,41,
+5,138,134,138,134,136,26,128,11,251,46,247,45,29,14,247,73,29,149,159,144,
+30,173,247,34,5,14,21,132,133,137,132,131,31,110,11,146,150,26,151,130,148,
+126,132,11,92,251,107,5,89,6,116,125,11,247,43,6,155,138,151,149,154,26,142,
+7,154,127,149,123,138,30,11,21,156,151,142,143,151,26,151,130,148,126,131,
+134,137,131,128,30,11,27,49,83,190,219,185,157,188,172,179,31,192,181,199,
+167,210,27,11,233,29,164,120,158,112,31,11,122,129,129,118,134,30,128,89,
+5,251,151,6,248,3,247,216,5,11,127,26,127,148,130,152,145,145,141,146,11,
+130,134,132,127,26,127,148,130,152,145,11,6,162,153,149,158,154,129,146,120,
+31,11,6,162,153,150,157,153,130,146,120,31,11,6,118,128,130,123,122,150,130,
+160,31,11,138,133,138,135,136,26,128,148,130,152,11,6,181,247,87,5,11,30,
+251,27,41,5,11,6,160,155,151,156,154,129,146,120,31,251,2,6,115,125,128,11,
+21,247,61,251,89,5,130,147,146,135,147,27,155,153,153,155,11,21,92,97,100,
+95,106,164,116,175,31,150,6,187,181,178,183,11,150,26,152,130,148,127,133,
+133,137,135,134,30,96,83,115,127,11,247,21,29,126,129,133,131,130,26,126,
+148,130,153,145,11,223,225,56,5,132,146,144,136,146,27,154,154,153,155,146,
+137,11,133,129,128,26,127,148,131,151,146,147,142,146,149,30,14,145,136,145,
+27,156,154,153,155,144,139,139,128,152,31,14,130,148,127,121,130,130,118,
+135,30,120,53,5,251,92,6,11,6,123,140,127,129,124,26,136,7,124,151,129,155,
+140,30,11,21,92,97,100,95,106,164,116,176,31,149,6,187,181,178,11,154,169,
+173,30,164,160,157,170,159,26,151,130,148,126,124,11,158,112,147,63,152,8,
+43,155,108,160,186,26,208,215,197,11,183,161,161,148,131,147,130,135,135,
+137,137,135,30,123,116,11,193,209,205,199,204,165,129,157,117,158,30,103,
+247,26,21,11,108,106,114,158,120,165,175,247,76,29,11,136,146,27,156,247,
+107,29,163,247,93,29,120,31,11,106,108,106,114,158,120,165,175,171,11,247,
+115,29,159,31,11,21,251,51,251,1,5,124,11,127,122,112,79,190,99,216,191,185,
+156,169,173,30,164,11,5,141,148,139,139,142,26,151,130,148,126,122,129,129,
+11,6,247,14,248,207,21,69,6,114,251,5,5,209,6,11,6,165,247,18,5,177,247,71,
+29,11,134,142,131,27,123,124,124,123,135,142,134,147,131,31,11,21,126,135,
+135,117,122,31,106,115,117,123,117,27,123,11,170,29,229,6,39,252,97,5,47,
+6,116,125,11,163,31,147,131,160,108,135,26,137,101,5,133,152,130,11,172,26,
+187,129,172,118,162,30,161,119,108,152,107,27,11,174,179,31,106,251,47,21,
+175,162,119,109,100,97,102,11,106,107,107,114,159,119,163,174,172,170,172,
+165,120,158,11,247,114,29,174,171,170,172,165,120,157,11,131,247,117,29,148,
+150,145,149,148,30,14,149,26,151,129,148,127,30,14,6,51,102,132,113,100,31,
+71,94,104,64,39,26,11,136,26,126,147,132,153,155,150,149,159,144,30,173,11,
+141,148,247,128,29,128,11,21,251,11,251,115,5,136,133,137,133,134,26,124,
+11,21,149,150,142,145,147,26,149,128,149,128,129,131,11,153,149,157,154,129,
+147,120,31,251,32,6,115,125,11,188,113,212,27,247,36,247,21,247,12,247,26,
+241,11,223,225,56,5,132,146,145,136,145,27,155,154,153,11,247,105,29,167,
+160,11,247,30,6,192,172,125,106,164,31,162,109,152,100,11,27,155,155,154,
+153,147,138,141,128,149,31,14,119,31,71,6,238,248,95,223,251,236,5,14,125,
+129,121,124,149,131,158,31,11,6,115,126,247,115,29,11,6,163,153,150,157,154,
+129,146,11,132,132,136,132,128,30,251,26,11,136,26,126,147,132,152,156,150,
+11,21,152,149,145,148,149,26,152,11,149,145,147,148,26,152,130,148,11,171,
+170,172,165,120,157,112,31,11,125,8,156,128,151,120,123,26,87,62,95,48,11,
+5,138,134,138,134,136,247,117,29,155,11,136,26,247,120,29,11,139,139,142,
+26,151,130,147,126,122,129,129,119,11,21,78,59,83,116,67,27,82,106,162,180,
+204,11,21,88,100,101,90,109,165,117,175,31,149,6,11,21,77,81,85,81,96,173,
+106,185,202,197,193,11,147,106,27,104,113,124,99,104,31,117,115,131,11,152,
+132,136,142,130,27,132,135,135,121,129,31,11,31,247,73,171,21,223,196,87,
+63,40,36,45,11,31,144,130,136,140,134,27,123,125,126,123,120,11,160,130,150,
+122,123,130,128,118,30,251,154,7,11,59,210,251,4,251,44,251,25,251,14,251,
+31,11,95,5,248,21,6,161,238,5,141,148,139,139,11,119,31,71,6,232,248,66,247,
+84,252,117,5,11,146,146,142,146,150,30,14,153,150,157,153,129,147,11,124,
+154,117,31,247,98,22,111,113,114,112,11,251,37,26,34,209,65,247,4,126,30,
+129,11,6,52,248,148,5,251,99,6,115,125,128,11,139,130,109,105,251,8,24,136,
+129,138,132,11,21,67,72,73,69,87,177,101,191,212,206,11,146,148,144,30,247,
+43,247,178,149,185,5,11,26,154,130,148,124,124,129,128,117,134,30,11,31,167,
+162,157,167,160,26,152,130,147,124,11,166,6,163,151,134,129,124,120,127,113,
+124,11,180,251,27,24,148,111,142,137,169,138,8,11,73,105,112,130,146,132,
+149,146,143,141,147,11,111,113,114,112,118,154,124,161,168,164,163,11,146,
+151,148,26,152,128,150,125,30,14,153,153,155,144,139,139,129,152,31,14,126,
+147,132,152,156,150,150,11,129,120,125,149,131,158,31,11,6,206,190,156,176,
+177,31,11,148,156,155,125,148,114,31,11,26,150,130,148,126,123,128,11,247,
+87,21,146,176,141,153,11,107,108,106,114,158,120,165,11,128,121,124,148,132,
+11,5,140,143,140,144,11,26,128,149,130,151,11,31,232,41,5,131,11,239,248,
+97,5,11,126,150,128,152,153,147,147,158,143,30,11,6,157,148,146,153,152,130,
+146,121,31,11,6,160,154,151,157,153,130,146,121,31,11,6,161,150,148,156,155,
+128,148,117,31,11,6,116,125,128,121,124,149,132,158,31,11,6,121,130,132,126,
+125,148,132,157,31,11,133,123,27,128,130,143,158,109,31,158,11,135,26,125,
+148,130,154,154,149,150,160,11,139,139,142,26,151,130,148,126,123,128,11,
+21,161,150,148,156,155,128,148,117,31,11,21,123,127,129,125,128,146,133,153,
+31,11,151,150,152,150,132,145,127,31,71,6,11,51,5,138,133,138,135,135,26,
+127,147,11,199,83,59,251,1,251,0,37,251,6,11,106,128,122,73,127,30,103,251,
+102,5,11,247,26,6,131,101,5,138,135,138,134,11,125,124,130,141,136,148,131,
+31,14,153,148,157,154,127,148,118,31,14,241,232,247,3,31,14,123,154,118,31,
+14,119,31,92,6,186,247,107,5,14,68,29,14,51,5,137,131,139,137,136,26,126,
+147,132,11,141,29,75,6,11,68,29,100,6,11,68,29,74,6,11,247,128,29,128,119,
+11,22,233,29,11,111,113,114,112,118,155,124,160,168,164,163,168,159,11,251,
+242,5,89,205,29,158,31,11,194,29,14,247,114,21,145,127,147,130,119,126,123,
+113,81,190,101,217,11,215,29,137,130,130,30,11,119,31,247,4,29,30,247,15,
+247,27,29,11,6,162,154,151,157,154,131,145,118,31,251,3,160,29,11,249,85,
+21,130,29,11,6,162,154,151,157,154,131,145,118,31,251,3,80,29,11,119,31,100,
+6,150,29,11,169,29,175,6,71,251,209,5,98,205,29,158,31,11,5,251,48,160,29,
+158,31,247,254,68,29,251,46,6,14,177,190,21,98,205,29,158,31,248,177,6,163,
+153,149,158,154,129,146,120,31,93,6,11,107,29,161,29,71,6,11,102,29,14,24,
+247,102,29,127,143,149,120,247,87,29,184,119,180,196,182,175,186,170,121,
+156,11,185,44,24,152,113,140,139,168,138,8,198,6,164,153,148,155,156,125,
+148,114,31,84,6,114,29,11,72,29,129,102,24,138,124,5,123,149,128,154,153,
+148,150,161,144,30,150,192,5,141,148,140,147,142,26,155,123,148,110,69,116,
+124,34,54,30,11,247,110,21,55,29,11,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,
+1,135,255,2,135,254,2,243,2,0,1,0,2,0,3,0,65,0,95,0,221,1,162,2,2,2,127,2,
+134,2,212,3,27,3,137,3,180,3,182,3,184,3,190,3,233,4,76,4,124,4,215,5,71,
+5,138,5,246,6,96,6,156,6,248,7,104,7,129,7,146,7,202,7,233,8,27,8,126,9,32,
+9,35,9,71,9,80,9,83,9,86,9,126,9,129,9,132,9,135,9,138,9,141,9,144,9,174,
+9,181,9,184,9,193,10,74,10,77,10,80,10,83,10,86,10,126,10,151,10,198,10,201,
+10,210,10,238,11,25,11,61,11,113,11,119,11,145,11,148,11,218,11,221,11,229,
+11,232,12,0,12,10,12,13,12,22,12,26,12,29,12,32,12,171,12,174,12,177,12,214,
+13,41,13,44,13,60,13,63,13,87,13,129,13,132,13,160,13,163,13,179,14,46,14,
+57,14,179,14,213,15,23,15,155,16,17,16,19,16,134,16,239,17,185,18,88,18,96,
+18,129,18,188,18,211,18,216,19,42,19,110,19,125,19,149,19,204,19,206,20,48,
+20,71,20,73,20,100,20,118,20,136,20,153,20,216,21,59,21,63,21,69,21,75,21,
+84,21,90,21,96,21,102,21,106,21,112,21,128,21,134,21,154,21,160,21,176,21,
+179,22,40,22,135,22,138,23,13,23,56,23,59,23,62,23,151,23,159,24,37,24,167,
+24,221,24,253,25,82,26,6,26,8,26,136,26,204,27,9,27,117,27,165,27,198,27,
+241,28,22,28,159,28,250,29,104,29,121,29,244,30,90,30,138,31,6,31,29,31,55,
+31,69,31,98,31,133,31,194,32,4,32,34,32,63,32,71,32,79,32,87,32,126,32,158,
+32,178,32,244,33,8,33,35,33,49,33,70,33,173,34,27,34,34,34,41,34,57,34,73,
+34,81,34,95,34,103,34,121,34,130,34,224,35,2,35,15,35,146,35,206,35,213,35,
+230,36,53,36,76,36,90,36,111,36,124,36,137,37,30,37,50,37,71,37,83,37,90,
+37,130,37,249,38,14,38,41,38,67,38,96,38,104,38,129,38,167,39,24,39,64,39,
+118,39,176,39,249,40,62,40,146,40,226,41,56,41,129,41,135,41,217,42,8,42,
+96,42,190,43,35,43,43,43,95,43,102,43,109,43,118,43,125,43,127,43,135,43,
+141,43,190,43,205,43,218,43,224,43,232,44,9,44,17,44,24,44,31,44,39,44,46,
+44,53,44,153,44,160,44,168,44,175,44,196,44,204,44,212,44,220,44,231,45,2,
+45,30,45,38,45,112,45,120,45,138,45,170,45,178,45,218,45,229,45,237,45,244,
+45,251,46,3,46,10,46,17,46,31,46,38,46,72,46,80,46,87,46,156,46,170,46,178,
+46,212,46,219,46,226,46,233,47,5,47,87,47,95,47,102,47,139,47,146,47,153,
+47,161,47,169,47,177,47,185,47,192,47,200,47,208,47,216,47,224,47,231,47,
+238,47,245,48,10,48,18,48,61,48,69,48,98,48,103,48,110,48,124,48,143,48,150,
+48,177,48,184,48,192,48,216,48,223,48,230,48,237,48,245,48,252,49,4,49,11,
+49,50,49,57,49,113,49,138,50,54,50,227,51,138,52,129,52,131,52,133,52,135,
+52,151,53,121,53,251,53,253,54,3,54,21,54,29,54,37,54,84,54,103,54,112,54,
+124,54,135,54,204,54,223,54,230,54,238,54,246,54,254,55,6,55,31,55,39,55,
+56,55,122,56,18,56,107,56,242,57,55,57,69,57,76,57,89,57,97,57,135,57,152,
+57,157,57,182,57,213,57,221,57,222,57,223,58,107,58,178,58,232,59,12,59,120,
+59,190,60,56,60,126,60,192,61,58,61,90,61,141,61,206,61,216,61,228,61,250,
+62,8,62,20,62,90,62,169,62,241,63,55,63,98,63,150,63,193,63,207,63,246,64,
+62,64,114,64,166,64,211,65,134,65,160,66,111,67,104,67,133,67,160,67,199,
+67,239,68,76,68,89,68,143,68,188,68,199,68,245,69,79,69,153,69,219,69,244,
+70,85,70,182,70,245,71,5,71,112,71,208,71,248,72,58,72,113,72,237,73,139,
+73,238,74,100,75,8,75,158,75,180,75,207,75,234,76,26,76,77,76,214,76,235,
+77,1,77,30,77,56,77,62,77,183,77,226,77,230,77,246,78,2,78,7,78,32,78,68,
+78,180,78,230,79,44,79,129,79,143,79,156,80,37,80,39,80,41,80,45,80,74,80,
+76,80,106,80,108,81,8,81,10,81,72,81,87,81,89,81,104,82,15,82,17,82,19,82,
+21,82,102,82,104,82,107,82,180,82,182,83,38,83,155,84,17,84,155,84,221,85,
+69,85,186,86,44,86,56,86,151,86,154,86,243,87,32,87,133,87,204,88,97,88,102,
+88,140,88,223,89,26,89,103,89,119,89,249,90,69,90,196,90,199,91,75,91,235,
+92,56,92,224,93,6,93,20,93,32,93,38,93,108,93,199,94,22,94,56,94,136,95,32,
+95,95,95,137,95,239,96,94,96,240,97,8,97,28,97,108,97,126,97,140,97,173,97,
+225,97,227,98,6,98,8,98,12,98,123,98,125,98,140,98,167,98,170,98,173,99,5,
+99,7,99,9,99,11,99,13,99,15,99,56,99,58,99,61,99,219,99,221,99,252,100,12,
+100,26,100,58,100,77,100,154,100,245,101,125,101,225,102,72,102,96,102,214,
+103,110,103,195,103,197,103,199,103,201,103,222,104,95,104,196,105,54,105,
+77,105,161,105,189,105,192,106,25,106,102,107,5,107,36,107,76,107,187,108,
+10,108,103,108,125,108,151,108,210,108,217,108,225,109,59,109,89,109,121,
+109,144,109,235,109,253,110,29,110,74,110,126,110,222,111,20,111,58,111,97,
+111,139,111,180,112,12,112,128,112,214,112,217,113,71,113,106,113,122,113,
+155,113,158,113,160,113,255,114,73,114,99,114,104,114,141,114,203,115,5,115,
+69,115,72,115,245,116,19,116,44,116,78,116,168,117,11,117,35,117,169,118,
+0,118,98,118,152,119,20,119,135,119,215,119,224,119,228,120,89,120,194,120,
+243,120,245,120,247,121,11,121,25,121,56,121,82,121,161,121,183,121,247,122,
+33,122,114,122,161,122,167,122,224,122,229,123,106,123,114,123,122,123,190,
+123,213,123,242,124,27,124,142,124,166,124,225,125,3,125,61,125,148,125,220,
+126,8,126,10,126,63,126,104,127,118,127,189,128,152,128,155,129,34,129,219,
+130,139,131,40,131,194,132,41,132,122,132,222,133,74,133,168,134,21,134,117,
+134,202,135,31,135,123,135,208,136,38,136,49,136,73,136,96,136,126,137,7,
+137,36,137,113,137,234,138,100,138,223,139,108,139,149,139,212,139,236,139,
+251,140,13,140,31,140,71,140,101,140,151,140,192,140,231,141,1,141,26,141,
+52,141,78,141,96,141,132,141,175,141,202,141,229,14,14,248,99,248,192,21,
+143,151,141,150,143,26,158,122,153,118,108,120,120,100,133,30,88,251,212,
+5,138,134,139,134,136,26,128,149,130,150,206,29,76,251,34,21,101,106,109,
+104,113,159,121,168,31,151,6,178,172,169,174,165,119,157,109,31,14,247,162,
+248,239,21,118,251,144,5,128,7,120,150,127,156,160,151,151,166,149,30,229,
+247,147,5,178,22,119,230,10,248,106,247,241,21,226,68,29,58,6,200,247,102,
+5,140,145,140,144,142,247,76,10,247,119,10,59,6,200,247,102,5,142,149,139,
+140,143,26,150,129,148,127,247,119,10,62,168,10,210,6,106,251,5,5,54,48,10,
+219,6,78,251,103,5,136,129,139,139,134,247,117,29,154,150,149,158,144,30,
+202,247,109,5,218,6,79,251,103,5,137,132,138,136,135,26,127,148,130,152,154,
+149,148,159,145,30,201,247,109,5,218,141,29,67,6,120,247,5,21,106,251,5,5,
+59,6,172,247,5,5,14,248,35,248,211,21,42,127,58,63,59,26,110,151,112,159,
+124,30,162,122,166,129,202,127,203,126,154,135,157,126,8,153,130,148,120,
+121,26,73,64,86,48,94,104,149,159,118,30,126,151,128,152,142,26,141,169,5,
+145,127,148,130,123,128,129,118,135,30,122,62,247,78,29,149,149,159,144,30,
+140,144,157,117,188,118,177,137,25,116,251,3,5,138,135,138,134,136,26,127,
+148,130,152,206,29,163,247,5,5,247,10,151,223,213,230,26,168,126,168,119,
+155,30,115,158,114,147,68,153,81,151,122,144,122,150,8,126,147,131,156,156,
+26,196,209,194,213,170,173,129,124,158,30,150,131,148,126,133,26,138,120,
+5,131,150,130,149,247,93,10,152,197,247,95,10,126,128,130,124,134,30,113,
+162,117,148,100,144,149,183,24,141,146,139,142,142,247,76,10,123,128,129,
+117,135,30,14,248,48,247,131,247,1,29,131,96,21,177,166,113,100,88,89,90,
+88,99,112,165,178,191,188,187,193,31,103,248,50,247,1,29,130,96,21,178,166,
+113,100,89,89,89,88,99,112,165,178,191,188,187,192,31,247,102,251,118,21,
+155,143,147,148,151,26,149,132,147,130,136,135,138,137,133,30,252,42,251,
+13,5,124,135,130,130,126,26,130,147,131,147,142,144,140,141,145,30,14,248,
+26,22,200,68,29,105,6,123,173,163,165,167,183,164,188,25,148,168,29,93,6,
+136,132,122,100,113,95,117,109,25,68,247,57,5,123,177,132,164,155,26,184,
+187,184,186,163,152,133,118,158,30,178,157,5,156,147,146,148,152,26,150,130,
+149,128,134,135,138,134,128,30,131,135,5,153,118,121,144,116,27,60,62,68,
+68,118,142,129,162,83,31,56,114,79,64,60,26,65,190,85,209,183,182,159,178,
+175,30,119,186,21,105,111,103,118,108,27,95,106,175,187,198,184,193,199,153,
+31,14,247,224,248,239,196,29,14,248,203,248,239,21,124,121,122,82,94,31,251,
+5,251,39,93,251,4,251,22,26,90,144,105,153,90,30,155,79,153,104,153,115,8,
+132,143,146,135,146,27,155,154,153,153,142,139,141,135,150,31,114,212,126,
+207,203,26,247,34,194,247,25,247,14,247,48,30,150,154,140,140,147,26,151,
+129,148,127,30,14,247,188,248,239,21,123,124,125,125,135,140,137,142,129,
+31,163,77,154,59,76,26,251,33,83,251,30,251,13,251,44,30,128,124,138,138,
+131,26,127,149,130,151,154,157,156,196,184,30,247,5,247,38,185,247,5,247,
+21,26,220,112,247,0,102,202,30,146,135,132,143,132,27,14,248,5,248,78,21,
+251,10,178,5,141,131,136,140,135,27,123,125,125,124,127,144,134,154,135,31,
+247,8,100,40,35,5,127,127,137,135,130,26,127,148,130,152,148,147,143,150,
+149,30,239,244,194,35,5,127,145,144,135,149,27,155,154,153,153,143,137,146,
+136,145,31,85,243,247,28,179,5,160,145,148,148,154,26,150,130,149,128,135,
+131,138,137,133,30,251,25,99,166,247,19,5,140,145,140,143,143,247,112,29,
+129,118,135,30,14,248,16,247,148,21,247,68,68,29,251,66,6,180,247,82,5,247,
+59,29,120,135,30,97,251,85,5,251,68,48,10,247,66,6,97,251,83,247,127,10,159,
+144,30,14,172,29,193,29,247,211,247,16,222,10,249,1,249,3,21,147,150,141,
+143,145,26,151,129,148,127,127,132,134,125,128,30,252,112,253,63,5,133,130,
+136,132,134,26,127,149,130,151,151,146,144,153,149,30,14,248,203,247,241,
+21,145,169,143,170,167,26,247,4,85,205,47,251,6,38,32,251,50,105,30,118,41,
+5,132,109,136,109,110,26,251,5,193,73,231,247,6,239,246,247,50,174,30,251,
+206,232,21,153,201,171,205,178,183,8,172,168,175,156,179,27,206,172,92,43,
+113,136,112,134,115,31,120,52,126,77,106,73,100,95,25,106,111,103,122,99,
+27,72,106,187,235,167,141,164,144,162,31,14,248,95,248,249,21,251,98,79,5,
+118,133,130,130,124,26,128,148,129,150,141,149,141,140,143,30,247,25,177,
+32,252,128,5,251,27,202,10,247,212,6,161,154,247,42,10,251,25,6,14,247,37,
+190,21,245,215,247,97,247,53,182,180,8,196,193,160,178,191,26,217,69,203,
+56,74,76,112,90,90,30,111,111,118,106,122,26,129,149,130,151,151,148,146,
+154,147,30,197,168,208,181,205,27,201,189,95,85,85,117,112,251,19,39,31,32,
+53,61,80,50,73,129,132,24,124,71,5,248,41,6,156,218,5,141,149,247,146,29,
+135,30,132,108,5,14,247,245,247,249,21,118,124,127,122,124,148,133,159,138,
+31,221,203,90,77,57,45,62,38,83,92,156,175,98,31,145,132,134,141,132,27,124,
+125,125,124,126,151,126,167,123,31,111,186,183,126,190,27,247,24,247,17,243,
+247,1,194,108,184,84,167,31,216,171,189,202,206,26,215,78,191,48,79,77,118,
+104,92,30,116,121,130,128,128,26,126,148,131,152,148,143,141,152,153,30,172,
+176,189,157,195,27,203,183,104,89,72,70,82,58,31,14,248,41,247,58,21,114,
+251,7,5,67,142,29,247,42,6,161,154,247,42,10,112,6,164,247,7,5,168,6,162,
+153,150,158,154,131,145,119,31,112,6,222,248,22,5,46,6,251,204,252,19,127,
+85,5,247,174,190,21,251,109,6,247,167,247,227,5,153,6,14,247,207,248,188,
+21,247,129,6,162,154,150,158,161,29,251,179,6,81,251,160,5,138,136,139,136,
+136,26,128,140,147,131,150,27,146,144,141,145,154,31,160,184,184,150,179,
+27,206,180,99,74,101,125,96,114,102,31,82,101,81,108,73,27,82,94,160,183,
+99,31,147,132,134,141,132,27,124,124,125,124,124,158,119,174,115,31,114,177,
+183,126,187,27,247,32,247,13,247,15,247,35,228,80,197,50,98,102,131,120,87,
+31,14,247,129,247,155,21,149,195,158,191,168,181,8,227,197,246,203,227,27,
+157,154,136,135,147,31,134,148,143,138,145,27,154,153,153,154,158,105,155,
+96,57,50,101,72,66,31,53,61,88,251,16,251,21,26,251,11,199,63,234,247,7,247,
+1,247,6,247,13,225,82,200,59,72,74,102,72,87,30,130,64,21,174,183,150,152,
+158,156,8,174,179,181,158,177,27,192,179,95,80,48,60,53,56,64,103,187,243,
+134,31,14,248,184,248,177,21,251,161,252,138,5,135,130,137,134,133,26,128,
+148,130,151,152,147,145,156,149,30,247,165,248,146,154,210,5,252,20,6,122,
+60,5,138,133,138,134,136,247,117,29,156,149,149,160,143,30,146,170,5,247,
+172,6,14,248,90,247,204,21,222,177,184,198,209,26,218,76,197,52,251,4,251,
+1,43,40,93,161,104,185,112,30,51,100,86,71,63,26,54,205,79,232,247,11,247,
+6,241,245,189,113,180,89,167,30,108,247,145,21,201,183,100,85,66,66,77,54,
+77,93,176,190,211,217,207,221,31,79,251,170,21,206,186,99,81,59,57,66,49,
+73,91,181,197,220,218,209,232,31,14,248,173,247,230,21,129,83,119,87,111,
+97,8,51,81,32,75,51,27,121,124,142,144,131,31,144,130,135,140,133,27,123,
+126,125,124,119,173,123,182,222,227,177,205,212,31,225,218,190,247,16,247,
+21,26,247,11,79,215,45,251,8,251,1,251,6,251,13,53,196,78,219,206,204,176,
+206,191,30,148,214,21,106,98,124,122,122,123,8,104,99,96,120,101,27,87,99,
+183,198,230,218,225,222,179,172,122,110,156,31,155,113,149,98,100,26,14,247,
+211,247,16,247,32,29,184,171,114,162,102,31,192,247,186,247,24,29,173,114,
+161,102,31,14,247,131,184,10,112,247,157,247,32,29,183,172,114,162,102,31,
+14,199,247,173,21,248,62,251,125,5,136,144,145,138,144,27,147,147,144,146,
+143,31,141,142,5,141,143,240,29,150,145,144,146,148,26,143,138,143,136,143,
+30,138,142,5,147,134,131,144,131,27,135,134,137,136,133,31,14,248,229,247,
+219,21,247,112,10,119,31,252,80,48,10,248,50,251,33,21,162,153,150,158,247,
+20,10,252,80,142,29,14,248,170,247,173,21,252,63,247,125,5,142,132,135,141,
+135,27,130,132,134,131,134,201,29,133,134,132,130,26,136,141,134,141,135,
+30,140,136,5,132,143,148,134,146,27,145,144,140,142,145,31,14,248,16,247,
+136,21,205,166,178,160,172,165,8,182,172,165,189,189,26,217,81,186,43,81,
+117,134,100,41,30,127,134,124,70,5,137,133,139,136,231,10,147,177,5,163,195,
+171,146,184,27,209,183,106,87,76,86,95,251,37,84,31,124,69,5,138,135,138,
+134,135,26,128,148,130,152,206,29,73,251,4,21,98,106,110,103,112,159,122,
+171,31,167,6,180,172,168,175,166,119,156,106,31,14,248,78,247,34,21,179,6,
+162,153,150,158,149,135,145,129,142,31,197,247,159,5,141,151,141,153,149,
+26,216,86,190,58,251,7,251,0,251,2,251,44,106,30,105,251,51,5,133,113,136,
+113,113,26,89,154,88,164,106,30,105,164,176,123,189,27,222,225,175,174,150,
+130,148,126,133,134,137,135,134,31,115,106,104,128,90,27,105,112,149,157,
+123,31,117,163,125,185,185,26,162,141,160,144,161,30,173,247,48,5,247,19,
+166,221,228,227,27,195,172,107,85,131,138,130,137,131,31,130,98,5,251,6,138,
+43,60,44,26,81,188,97,206,150,150,140,140,152,30,150,191,21,137,126,131,138,
+127,27,93,109,162,175,200,206,191,219,141,31,14,32,10,14,247,21,190,21,89,
+80,29,247,199,6,244,240,228,232,191,108,177,78,164,31,210,176,174,186,199,
+26,212,79,188,170,10,108,111,118,157,29,248,220,118,29,136,131,55,10,14,81,
+10,14,32,29,14,247,120,247,158,21,247,135,29,137,26,127,148,130,152,155,150,
+149,159,143,30,167,247,21,247,29,10,135,30,130,99,5,251,26,134,29,39,252,
+97,188,10,34,29,14,62,10,14,37,10,14,87,29,14,64,29,14,40,29,14,248,1,247,
+58,21,247,122,247,236,40,252,95,5,69,80,29,247,41,6,247,112,10,108,29,154,
+130,145,247,68,29,206,10,120,125,104,10,14,37,29,14,247,111,118,10,154,130,
+145,197,10,247,195,123,21,247,61,148,247,42,247,64,247,79,26,247,24,58,230,
+251,10,251,60,251,50,251,70,251,81,71,165,72,180,100,30,158,120,156,130,172,
+127,46,82,24,127,131,133,130,129,26,126,148,130,151,143,142,140,140,144,30,
+151,183,209,150,169,27,164,152,136,129,164,31,128,168,148,137,156,27,166,
+173,150,157,173,31,159,150,145,147,152,26,151,130,148,127,133,135,138,135,
+133,30,119,104,122,133,119,27,127,132,141,147,117,31,151,110,118,143,108,
+27,124,130,138,136,120,31,247,45,248,200,21,227,203,62,35,251,45,237,29,14,
+38,10,14,34,10,14,52,29,14,33,29,14,247,155,22,203,6,247,212,248,148,5,167,
+247,9,10,124,147,133,159,31,208,6,251,178,252,92,59,248,92,5,209,247,124,
+10,251,43,103,10,165,6,14,247,8,219,29,156,155,131,145,119,31,251,42,161,
+10,121,124,144,29,121,124,170,29,148,6,14,248,29,247,179,21,247,116,247,117,
+5,152,6,247,112,10,119,147,10,121,124,236,29,121,124,216,10,247,22,6,247,
+112,10,247,37,10,116,125,247,41,29,247,23,68,29,125,6,14,39,29,14,125,10,
+135,247,117,29,159,29,14,248,81,248,188,21,232,6,162,153,150,158,161,29,251,
+34,6,251,49,253,105,5,247,37,168,29,49,6,14,247,190,249,24,21,155,135,133,
+144,126,27,123,125,125,124,136,139,137,141,133,31,247,72,253,63,5,124,143,
+145,133,152,27,154,154,153,154,142,139,139,137,148,31,14,247,149,68,21,46,
+161,10,120,124,148,133,159,31,247,34,6,247,49,249,105,5,251,37,6,117,124,
+127,121,124,147,133,160,31,229,6,14,247,192,248,252,21,251,74,251,115,5,131,
+130,137,134,132,26,125,150,128,154,148,145,143,150,148,30,247,34,247,67,247,
+35,251,67,5,128,147,146,135,148,27,154,150,150,153,146,137,143,131,149,31,
+14,248,221,251,8,213,29,248,156,248,236,21,251,37,6,235,251,128,5,121,147,
+148,131,153,27,162,158,157,161,31,146,7,14,35,10,14,247,171,248,239,21,216,
+29,251,0,252,137,5,89,80,29,239,6,155,214,5,78,173,191,109,208,27,247,35,
+247,26,247,24,247,34,242,64,211,33,70,72,108,81,82,31,247,76,177,21,217,198,
+82,63,251,1,34,34,251,1,56,81,194,218,247,3,243,241,247,6,31,14,36,29,14,
+164,29,39,215,65,128,10,14,35,29,14,247,248,248,4,21,247,77,168,29,251,74,
+6,150,193,5,186,149,190,90,10,251,63,6,14,175,10,130,79,68,81,76,113,29,14,
+63,29,14,39,10,247,14,248,207,247,5,10,248,127,106,10,69,10,14,47,10,14,247,
+100,248,55,21,58,247,70,29,158,31,167,189,29,109,48,10,247,0,89,29,112,6,
+194,247,146,5,193,187,175,162,173,27,164,159,116,110,135,138,134,138,134,
+31,71,251,208,5,219,6,162,153,151,157,153,131,146,119,31,112,6,194,247,146,
+5,194,187,173,161,174,27,152,149,136,132,145,31,151,127,146,123,138,126,8,
+137,138,135,138,133,30,70,251,211,5,219,6,161,154,151,157,153,131,146,119,
+31,112,6,197,247,161,5,141,147,140,149,145,26,191,102,176,86,98,102,120,94,
+92,30,182,124,112,160,96,27,100,106,123,102,101,31,14,36,10,14,45,29,14,247,
+132,248,55,21,37,103,10,186,6,251,0,252,135,133,29,67,206,251,3,65,86,116,
+79,75,247,86,29,32,52,82,190,215,240,247,138,29,248,167,247,241,21,197,104,
+91,165,66,27,61,71,110,82,83,31,93,92,112,76,82,26,38,213,70,247,2,212,198,
+164,196,198,30,90,251,115,5,46,6,116,124,247,41,29,247,85,6,162,153,151,157,
+154,130,145,120,31,91,6,247,1,248,135,5,189,168,29,40,6,251,72,102,247,59,
+10,215,241,241,231,247,3,31,14,41,10,14,58,29,63,83,146,29,129,148,127,122,
+129,129,118,134,30,14,46,29,14,248,69,22,221,6,161,247,7,10,112,6,219,248,
+4,5,247,166,10,202,163,188,203,31,14,247,231,22,247,138,248,4,5,177,141,10,
+251,44,80,29,198,6,251,104,251,209,5,127,6,63,247,209,5,198,141,10,251,44,
+103,10,175,6,228,252,4,5,14,42,10,14,248,19,247,167,29,121,124,170,29,247,
+25,6,247,112,10,247,3,10,121,124,247,99,10,161,29,132,6,14,40,10,14,171,10,
+252,0,251,216,129,247,90,29,142,26,151,233,10,14,248,70,248,129,21,146,171,
+164,162,171,143,8,164,142,150,148,157,26,152,130,147,123,81,84,92,78,126,
+30,102,251,61,131,105,112,115,105,138,25,117,137,127,128,121,26,125,146,133,
+157,137,30,167,137,154,124,113,26,135,138,134,138,134,30,103,251,61,5,137,
+131,138,131,130,26,90,174,103,187,159,154,151,156,154,133,143,118,142,30,
+116,141,125,155,138,163,8,144,139,144,140,144,30,176,247,61,5,141,150,140,
+148,150,26,160,132,155,121,156,30,172,159,156,164,147,177,8,14,247,218,249,
+205,21,88,254,199,190,6,14,247,162,127,21,132,107,114,116,106,135,8,115,136,
+128,130,121,26,126,148,131,155,197,194,186,200,152,30,176,247,61,146,173,
+167,163,173,141,25,161,140,151,150,157,26,153,132,145,120,141,30,111,141,
+122,156,141,163,8,143,140,143,140,145,30,176,247,61,5,141,148,140,148,147,
+26,187,104,175,91,119,124,127,122,124,145,135,160,136,30,162,137,154,122,
+116,26,133,139,135,138,134,30,102,251,61,5,136,128,138,128,130,26,118,146,
+124,158,121,30,106,119,122,114,130,101,8,14,248,125,247,226,126,29,183,148,
+147,164,27,154,157,130,120,163,31,86,203,161,127,172,27,172,169,157,181,175,
+31,158,160,247,106,29,247,114,251,43,21,136,127,137,129,133,26,120,155,125,
+160,171,157,158,179,145,30,190,247,212,5,140,145,140,144,141,26,150,130,148,
+127,123,129,130,117,133,30,203,247,34,21,177,172,169,173,165,119,157,109,
+31,127,6,101,106,109,105,113,160,121,168,31,14,248,17,248,132,21,81,126,105,
+124,103,109,8,87,96,108,76,80,26,61,192,79,217,129,30,116,34,5,137,130,139,
+139,135,247,117,29,247,93,10,162,245,177,142,184,152,180,159,25,167,153,151,
+151,154,26,151,131,147,126,132,135,138,131,128,30,113,100,92,125,93,27,67,
+92,182,204,231,224,216,240,169,164,133,126,156,31,150,131,150,123,130,26,
+138,117,5,130,149,130,150,247,93,10,152,199,140,148,5,152,140,130,148,125,
+27,129,131,135,130,132,31,120,156,102,153,106,140,161,236,24,247,59,29,119,
+134,30,14,247,97,190,21,190,190,177,228,143,215,8,223,6,162,154,150,158,161,
+29,45,6,147,139,139,138,153,30,136,172,139,143,155,26,180,148,165,164,165,
+30,164,163,171,154,170,27,172,162,125,108,158,31,128,145,145,135,146,27,155,
+247,62,10,100,27,94,95,120,103,103,31,101,102,122,97,85,26,120,140,122,142,
+104,30,51,103,10,237,6,132,38,70,251,6,85,137,8,121,125,127,123,124,170,29,
+247,216,6,169,169,154,166,161,247,2,10,129,120,122,116,27,14,136,29,248,12,
+247,125,21,247,19,6,159,150,149,160,150,131,144,124,31,33,6,247,99,247,124,
+5,160,234,10,159,31,166,6,251,78,251,100,43,247,100,5,170,141,29,251,2,247,
+145,10,245,251,124,5,251,0,6,119,128,129,119,127,147,134,155,31,247,15,6,
+129,91,5,251,18,6,118,128,129,119,128,147,133,155,31,247,16,6,120,52,5,57,
+48,10,247,106,141,29,60,6,158,226,5,247,18,6,160,150,150,159,149,131,145,
+123,31,251,16,6,14,248,44,248,14,21,156,217,5,204,153,193,183,205,27,155,
+153,137,133,155,31,137,147,143,138,142,27,154,153,153,155,147,135,145,130,
+143,31,148,120,111,144,113,27,52,55,70,51,120,31,122,58,5,47,80,29,229,6,
+83,251,150,5,75,125,87,94,79,27,128,123,141,141,132,31,147,115,137,139,133,
+27,125,125,125,124,120,176,124,187,224,220,206,224,158,31,197,247,158,5,231,
+6,162,153,151,157,161,29,14,249,10,248,239,21,251,110,6,57,60,71,68,132,140,
+135,141,129,31,103,133,120,133,118,124,8,112,121,122,111,113,26,94,174,98,
+219,89,30,196,103,5,212,94,170,108,112,26,97,90,101,84,30,251,51,6,152,202,
+247,116,29,141,26,150,130,147,126,123,128,129,121,135,30,114,251,7,5,247,
+106,6,228,215,203,215,146,138,144,137,148,31,178,144,159,146,161,157,8,165,
+159,152,164,167,26,184,108,175,63,186,30,89,169,5,47,195,111,165,167,26,180,
+190,180,191,30,247,53,6,126,77,5,138,136,139,136,135,247,117,29,154,151,149,
+157,143,30,251,56,251,95,21,189,108,172,103,113,26,114,108,122,92,137,30,
+129,6,137,138,139,138,135,31,124,156,114,158,91,168,85,174,24,72,180,106,
+173,164,26,165,174,159,184,30,146,6,142,140,139,140,144,31,162,114,158,125,
+198,103,8,14,247,125,247,49,21,115,170,164,130,176,27,178,168,148,163,180,
+31,179,88,5,129,147,144,136,147,27,154,155,153,154,141,133,153,137,142,31,
+99,190,5,180,184,157,180,188,26,161,136,152,126,167,30,203,191,5,153,150,
+142,144,150,247,76,10,131,133,136,130,128,30,76,88,5,162,109,112,149,100,
+27,102,108,130,115,99,31,99,189,5,150,130,135,141,131,27,123,124,125,124,
+133,141,134,145,132,31,180,88,5,101,97,119,94,92,26,118,143,125,151,110,30,
+74,86,5,126,129,135,132,129,26,127,148,130,152,147,143,141,149,152,30,247,
+112,247,196,21,195,178,101,85,67,67,69,65,81,100,176,194,212,211,208,215,
+31,14,247,252,248,239,21,118,230,10,247,249,248,236,247,82,10,154,27,162,
+158,157,161,31,146,7,247,76,247,107,247,82,10,153,27,163,158,157,161,31,146,
+7,14,242,10,144,137,143,134,148,31,34,247,58,10,151,130,148,126,132,131,136,
+130,128,30,114,251,89,247,23,29,144,138,142,132,149,31,35,247,53,247,67,247,
+54,5,153,151,142,144,149,26,152,130,147,126,131,132,135,131,128,30,14,242,
+10,145,138,141,132,149,31,35,247,58,10,152,130,147,126,132,130,135,131,129,
+30,14,248,229,127,10,14,247,138,248,4,21,206,141,10,74,6,150,194,10,149,140,
+139,143,27,154,152,153,154,148,134,146,129,144,31,147,120,105,146,119,27,
+76,77,82,66,124,31,127,85,5,66,161,10,121,124,247,160,10,161,29,74,6,248,
+38,248,4,21,34,103,10,189,189,29,66,103,10,247,85,141,29,71,6,247,15,248,
+207,247,105,10,247,137,248,4,21,207,168,29,74,6,151,194,10,149,140,139,142,
+27,155,152,191,29,121,124,100,10,161,154,151,157,161,29,75,6,248,77,248,188,
+21,34,161,10,120,124,147,133,160,31,189,6,251,1,252,137,5,67,48,10,247,87,
+247,69,10,119,31,68,6,14,248,192,247,148,21,247,112,10,119,31,252,38,48,10,
+14,247,101,10,158,153,247,30,10,142,26,151,190,29,53,252,33,5,138,134,138,
+135,231,10,14,247,101,10,157,154,247,30,10,143,26,150,190,29,126,81,5,251,
+16,48,10,247,14,6,76,251,180,138,127,5,127,148,130,152,206,29,202,247,182,
+5,247,16,6,162,154,150,157,155,130,145,119,31,251,14,6,14,121,29,248,198,
+248,188,21,195,247,122,29,251,92,6,251,29,137,40,80,119,48,129,93,24,137,
+131,138,131,133,26,95,166,102,186,116,30,167,126,166,132,185,136,82,251,158,
+24,46,6,117,125,127,121,126,149,131,156,31,247,26,6,160,154,151,157,149,133,
+146,129,142,31,247,14,248,199,5,200,6,251,14,252,198,5,123,136,128,127,124,
+26,126,148,131,157,30,237,247,122,29,83,6,14,247,188,248,89,21,56,73,73,55,
+56,205,72,221,220,205,206,222,221,73,207,59,31,14,172,29,247,84,247,45,247,
+60,29,151,128,157,208,29,151,128,157,154,150,145,156,152,30,247,87,247,135,
+5,14,247,181,248,239,247,60,29,152,128,156,208,29,152,128,156,244,29,14,247,
+255,127,10,248,119,247,89,246,10,136,145,129,31,243,217,10,14,247,10,232,
+21,174,10,247,91,22,174,10,247,92,22,174,10,14,247,166,248,249,247,98,29,
+205,209,208,10,247,204,251,82,21,153,143,146,147,149,26,148,133,146,131,135,
+135,138,138,135,30,252,36,251,12,5,125,135,131,130,129,26,130,146,132,147,
+141,143,140,141,145,30,187,92,153,10,247,171,178,153,10,14,247,199,247,53,
+21,73,111,100,118,105,114,8,97,106,113,88,89,26,61,197,92,235,191,174,147,
+167,208,30,154,145,140,139,157,146,154,209,24,141,147,247,128,29,129,119,
+134,30,131,101,5,114,83,108,132,94,27,69,95,172,191,203,193,183,247,36,194,
+31,154,208,247,44,29,119,135,30,205,247,4,21,180,172,167,175,166,119,156,
+106,31,111,6,99,106,111,103,111,159,123,171,31,14,247,224,149,10,248,200,
+248,224,44,29,248,73,249,18,132,10,248,199,248,237,95,29,247,56,10,248,169,
+248,161,49,29,247,222,248,240,46,10,248,67,248,245,98,10,247,212,139,10,248,
+77,249,38,149,29,247,162,150,21,120,49,247,163,10,104,142,31,149,185,5,14,
+248,57,248,218,54,10,248,64,150,21,67,6,69,109,106,103,93,186,29,166,165,
+167,185,162,31,14,248,40,248,115,53,29,249,8,247,148,21,161,154,150,158,161,
+29,252,180,142,29,14,49,10,14,248,49,247,168,21,209,6,159,152,150,155,153,
+131,145,122,31,120,6,174,247,54,5,140,145,140,146,143,26,181,103,168,85,113,
+83,127,128,116,30,126,133,133,130,127,26,129,147,130,150,144,141,139,143,
+149,30,150,169,170,146,156,27,170,159,127,120,136,139,137,138,136,31,131,
+100,5,146,112,122,141,116,27,50,67,87,76,96,173,113,194,177,167,145,157,179,
+31,151,194,21,116,99,107,130,100,27,110,120,150,155,174,189,169,196,161,155,
+137,132,164,31,14,247,234,195,29,231,203,29,251,126,48,10,229,6,92,251,108,
+251,32,68,5,122,130,133,132,126,26,127,148,129,150,145,143,141,144,150,30,
+247,1,195,99,251,78,5,47,48,10,248,93,6,183,247,95,5,141,148,247,80,29,135,
+30,105,251,46,5,251,155,6,184,247,101,247,64,227,5,158,149,144,145,152,26,
+151,130,148,128,133,130,136,136,132,30,251,33,66,5,14,62,29,14,248,37,247,
+158,21,206,6,134,118,247,127,10,160,144,30,159,234,5,141,145,139,141,142,
+247,76,10,123,128,129,119,135,30,134,116,5,72,247,20,29,247,72,6,116,34,138,
+127,5,127,148,130,152,206,29,173,247,50,5,251,213,6,251,66,251,37,251,55,
+251,89,79,162,81,176,104,31,106,173,190,122,201,27,247,223,6,168,247,27,5,
+140,140,139,146,142,26,151,247,30,29,187,248,97,21,247,139,10,111,6,93,101,
+149,158,114,31,105,166,118,188,194,26,205,161,211,176,192,30,213,191,206,
+175,228,27,14,248,60,248,212,21,42,49,53,46,71,191,88,210,236,230,225,231,
+209,88,189,66,31,131,92,21,189,173,106,92,76,75,78,74,88,104,172,186,203,
+202,199,207,31,14,45,10,14,39,10,14,248,90,248,239,21,251,56,161,10,121,123,
+147,133,159,31,247,2,6,91,251,115,251,10,80,5,121,130,133,132,126,26,127,
+148,130,151,145,143,140,144,150,30,226,183,92,251,111,5,251,47,142,29,247,
+253,6,161,154,247,42,10,251,47,6,191,247,134,247,11,198,5,157,148,145,146,
+153,26,151,130,148,127,133,136,138,133,127,30,51,95,5,14,99,29,126,129,136,
+115,29,14,249,4,247,87,21,148,183,142,161,247,51,29,83,85,103,73,97,31,201,
+123,95,179,87,27,32,33,251,35,251,35,45,189,70,207,194,195,178,208,184,31,
+72,156,186,98,197,27,174,182,157,175,188,31,163,157,145,146,247,25,29,111,
+27,88,103,192,215,147,140,148,140,153,31,151,190,21,228,171,185,186,194,27,
+186,164,106,77,125,139,130,137,121,31,251,224,247,28,21,183,136,170,92,73,
+26,90,124,86,112,95,30,110,91,94,104,105,137,8,96,137,104,190,206,26,190,
+154,191,166,183,30,169,188,188,176,171,137,8,14,247,80,247,217,21,80,251,
+166,5,89,48,10,240,6,240,248,107,5,184,149,190,175,193,27,186,172,108,94,
+108,124,113,109,120,31,125,117,115,131,118,27,134,6,121,124,126,123,124,147,
+133,160,31,144,6,215,204,81,72,54,79,56,78,109,124,156,173,145,139,144,140,
+145,31,140,143,139,142,142,26,150,129,147,127,118,127,121,108,76,171,103,
+196,192,188,169,196,177,30,165,179,156,192,182,26,206,104,192,72,170,30,190,
+171,164,181,190,26,210,89,188,65,59,60,81,67,124,30,117,42,5,91,142,29,14,
+248,88,248,248,21,251,5,106,124,135,133,135,8,133,135,134,131,132,26,129,
+146,132,148,143,142,139,140,142,30,204,159,84,251,151,5,81,6,112,127,132,
+122,128,146,133,152,31,247,71,6,153,247,131,29,14,248,118,248,25,21,251,85,
+7,119,148,128,156,156,148,150,159,30,247,136,252,70,7,117,128,130,123,122,
+150,130,161,31,14,247,63,149,21,119,167,160,133,178,27,201,199,162,183,192,
+31,88,220,7,160,150,148,155,155,128,148,118,31,110,248,5,251,13,6,116,129,
+131,122,123,151,130,160,31,208,251,141,6,81,85,81,111,73,27,88,105,173,189,
+31,247,193,38,7,117,129,131,122,123,150,130,160,31,188,252,169,6,118,148,
+128,156,156,148,150,160,30,14,247,151,248,156,21,199,6,125,73,5,138,137,139,
+137,137,26,128,147,131,150,152,149,148,154,142,30,163,247,2,5,251,145,6,116,
+251,0,5,138,136,139,137,136,26,128,140,146,132,149,27,152,149,148,154,142,
+31,154,206,5,199,6,87,251,131,5,90,6,122,127,128,125,128,147,132,153,31,247,
+32,6,155,152,150,153,151,131,145,125,31,92,6,247,209,187,21,246,247,52,94,
+251,100,5,107,6,122,127,128,125,128,147,132,153,247,86,10,131,6,191,247,131,
+5,144,6,156,151,150,153,150,131,146,125,31,77,6,251,7,251,65,97,247,65,5,
+76,6,122,127,128,125,128,147,132,153,31,142,6,87,251,131,5,129,6,123,127,
+128,125,128,147,132,152,247,86,10,109,6,184,247,102,179,251,54,5,14,59,10,
+248,224,248,109,21,150,149,142,144,147,26,150,131,146,175,29,129,129,135,
+133,131,26,129,147,131,150,147,141,140,151,152,30,247,27,112,29,247,78,251,
+148,21,247,100,247,50,157,158,191,26,187,100,176,89,97,98,119,104,110,30,
+127,124,131,125,130,26,130,146,132,149,149,146,144,151,145,30,169,155,172,
+160,173,27,171,163,117,110,118,125,119,104,111,31,82,92,72,86,81,97,133,134,
+24,129,92,5,247,127,6,148,180,5,140,142,139,142,140,26,148,132,146,129,127,
+129,130,126,136,30,138,7,14,248,25,247,187,21,247,68,247,123,10,251,66,6,
+171,247,43,247,116,29,247,80,10,106,251,45,5,251,68,203,10,247,66,6,106,251,
+44,5,137,130,139,138,136,247,117,29,155,150,149,160,143,30,251,139,48,21,
+116,125,128,121,125,216,10,248,37,247,123,10,14,247,90,247,20,21,247,19,6,
+247,24,247,7,233,246,218,71,195,44,31,251,31,6,150,187,5,247,26,68,29,251,
+126,119,10,247,126,68,29,251,24,6,167,247,20,21,189,247,126,5,247,37,6,205,
+188,100,85,65,52,72,43,31,14,247,170,248,248,124,29,155,151,150,152,150,132,
+145,126,31,71,6,248,58,247,68,21,150,148,142,145,147,26,149,131,147,175,29,
+129,129,135,133,131,26,129,147,131,150,147,141,141,150,152,30,247,224,168,
+21,128,88,5,119,6,109,128,133,121,128,146,133,152,31,225,6,154,151,150,152,
+150,132,145,126,31,129,6,150,190,5,167,150,146,156,150,131,145,127,31,129,
+6,185,247,106,5,77,6,251,67,251,109,130,247,38,10,248,193,247,149,21,162,
+153,150,157,161,29,252,38,169,10,247,63,251,17,21,105,107,108,106,115,158,
+120,165,174,171,169,172,165,120,157,112,31,229,248,44,21,104,247,54,29,113,
+31,14,247,218,248,207,21,247,88,29,119,148,128,156,155,148,150,159,30,251,
+29,4,247,88,29,118,148,128,155,156,148,150,160,30,14,248,74,249,14,21,42,
+50,54,48,70,190,89,210,235,228,225,230,207,88,189,69,31,126,88,21,187,172,
+108,95,78,79,82,76,93,106,170,184,198,199,197,200,31,14,247,169,248,225,21,
+37,48,10,187,6,251,37,253,49,133,29,66,206,251,2,65,85,115,80,76,247,86,29,
+32,52,82,190,216,239,247,138,29,247,104,247,90,10,183,138,170,115,107,26,
+97,91,100,88,109,118,247,2,29,215,212,201,203,168,127,161,111,210,10,148,
+30,156,158,165,148,167,27,172,161,122,113,107,105,112,98,31,248,3,144,21,
+148,148,143,146,146,26,149,131,147,175,29,130,130,135,132,131,26,129,146,
+131,150,147,141,140,151,152,30,248,7,168,21,128,88,5,118,6,109,128,132,122,
+128,147,133,151,31,225,6,155,151,150,152,150,131,145,127,31,129,6,149,190,
+5,167,150,146,156,150,132,145,126,31,129,6,185,247,106,5,78,6,251,68,251,
+109,131,247,38,10,247,182,247,189,21,247,102,247,52,156,156,193,26,185,99,
+176,89,102,102,123,111,110,30,122,121,127,120,127,26,131,147,132,148,149,
+146,144,151,145,30,169,155,173,159,172,27,171,164,117,111,112,128,126,71,
+85,31,83,94,97,106,85,99,132,134,24,129,92,5,247,128,6,148,180,5,146,7,149,
+138,133,145,129,27,127,129,130,126,137,31,138,138,5,14,247,185,247,145,21,
+197,6,170,127,167,91,158,64,8,183,6,155,152,151,154,151,131,146,125,31,128,
+6,114,204,131,154,118,161,8,193,160,169,174,184,26,186,102,170,83,30,251,
+30,6,122,126,128,123,127,147,132,153,31,157,6,88,251,127,5,119,6,122,126,
+127,124,127,147,132,153,31,235,6,156,152,151,154,151,131,146,125,31,110,6,
+168,247,27,21,161,239,5,212,6,173,159,124,114,104,97,114,82,31,211,247,170,
+108,10,247,55,247,199,21,116,125,247,115,29,158,31,248,38,89,29,14,248,200,
+248,202,21,149,143,146,149,151,26,151,130,148,127,136,136,139,138,137,30,
+37,99,5,166,86,81,158,112,27,122,125,125,122,129,145,133,153,136,31,175,131,
+157,134,164,127,82,117,24,129,135,133,129,127,26,126,149,129,151,140,143,
+140,140,142,30,236,179,167,116,174,84,155,95,25,167,101,103,151,91,27,251,
+40,251,29,251,22,251,31,33,218,65,247,3,216,214,172,198,196,31,191,192,170,
+219,217,26,229,102,233,78,205,30,34,251,46,21,226,198,83,57,32,174,29,14,
+248,3,247,209,21,251,1,247,28,5,148,132,134,142,131,27,123,124,125,124,134,
+142,132,144,133,31,247,1,251,28,251,61,251,28,5,126,129,135,132,129,26,127,
+148,130,152,146,147,142,147,149,30,247,60,247,29,247,1,251,28,5,130,147,144,
+136,147,27,155,154,153,154,144,136,145,134,146,31,251,1,247,28,247,60,247,
+28,5,153,150,143,145,149,26,151,129,148,126,132,132,136,131,129,30,14,248,
+23,247,90,10,182,138,170,178,29,169,127,160,112,158,31,180,164,159,169,175,
+26,184,103,170,87,87,247,104,29,148,30,156,157,165,148,168,27,171,161,122,
+114,106,106,112,98,31,14,247,96,247,153,21,137,130,138,129,130,26,69,194,
+85,210,180,182,156,170,176,30,156,154,145,147,149,26,151,131,146,128,131,
+134,137,132,131,30,106,104,112,127,104,27,90,103,175,188,148,140,145,140,
+146,31,147,177,5,198,152,193,186,194,27,162,162,131,127,152,31,143,135,148,
+125,137,26,138,118,5,133,150,131,148,152,150,148,154,142,30,153,202,5,140,
+142,139,142,141,26,150,131,147,127,128,130,132,128,134,30,157,111,118,146,
+108,27,60,60,73,58,122,31,247,103,247,164,108,10,32,10,247,17,247,115,247,
+10,29,251,28,41,5,126,129,134,247,71,10,143,247,138,10,32,10,173,247,165,
+167,10,141,146,149,247,100,10,145,27,155,154,153,154,147,137,142,130,148,
+31,14,32,10,55,247,136,21,174,10,247,114,22,174,10,14,32,10,104,247,153,21,
+148,131,135,141,131,27,124,124,125,124,133,143,131,144,134,247,118,29,146,
+145,247,38,29,32,10,181,247,185,247,83,29,197,183,105,171,92,31,132,96,21,
+165,157,123,115,108,106,108,104,113,120,155,162,172,172,169,175,31,14,32,
+10,247,52,247,128,247,6,29,103,129,133,123,27,129,129,144,157,109,31,158,
+110,127,143,117,27,113,247,156,10,167,173,149,145,157,27,150,148,135,128,
+156,31,115,175,157,132,162,27,165,165,151,169,174,31,159,155,143,145,247,
+56,10,247,211,123,21,146,6,202,216,171,190,200,31,168,164,146,148,152,247,
+111,10,136,131,179,29,184,186,123,116,144,10,136,121,5,120,29,73,169,76,190,
+99,30,163,121,161,129,178,129,124,70,24,196,10,183,119,181,196,182,175,187,
+169,121,156,104,142,31,14,32,29,248,6,249,64,21,153,149,144,247,7,29,135,
+137,131,127,247,21,29,124,129,135,247,71,10,143,247,138,10,32,29,247,172,
+249,114,21,251,51,251,0,5,123,128,134,133,127,26,127,148,130,152,146,210,
+29,129,148,31,14,32,29,247,54,249,85,67,10,32,29,247,96,249,102,156,10,37,
+10,247,114,249,64,56,29,37,10,247,25,249,114,247,42,29,129,134,133,247,40,
+10,144,141,146,150,30,247,14,223,225,56,5,132,147,144,136,145,27,155,154,
+153,154,147,198,29,248,72,195,29,247,27,168,29,251,211,247,162,10,161,154,
+151,156,155,131,145,247,118,10,154,247,156,29,247,114,247,152,10,37,10,203,
+249,102,247,60,10,132,146,133,247,75,10,145,27,157,247,107,29,42,29,247,41,
+249,128,158,10,109,128,143,117,27,113,115,128,113,104,31,118,123,132,129,
+128,26,127,148,131,152,146,147,142,145,146,30,167,173,149,145,157,27,150,
+148,135,128,156,31,115,176,155,132,163,27,165,165,151,169,175,31,158,155,
+143,145,247,56,10,37,29,247,41,247,103,193,10,128,30,251,28,247,50,10,141,
+147,152,30,14,37,29,190,247,153,207,10,225,56,5,132,146,144,136,146,27,154,
+154,153,155,146,137,142,130,148,31,14,37,29,72,247,124,21,130,29,247,114,
+22,174,10,14,37,29,114,247,141,21,148,131,135,141,132,27,123,124,125,124,
+133,142,132,212,10,248,59,248,211,21,251,59,247,79,10,221,218,178,212,204,
+31,202,210,177,234,228,26,247,25,59,230,251,11,30,133,88,21,227,203,63,33,
+251,44,251,23,251,47,251,20,44,75,212,246,247,51,247,22,247,42,247,28,31,
+247,77,247,116,158,10,110,127,143,117,27,113,247,156,10,168,173,149,144,157,
+27,150,148,135,128,156,31,115,176,156,132,162,27,165,165,151,169,175,31,158,
+155,143,145,247,56,29,248,189,248,160,21,247,51,10,160,121,31,166,118,173,
+127,208,126,207,247,21,10,99,130,10,5,98,171,192,117,205,27,247,30,247,4,
+247,39,10,113,247,34,29,227,176,174,128,123,156,30,148,131,159,109,135,26,
+137,97,5,133,151,130,149,206,29,160,239,5,140,143,140,145,142,26,150,130,
+148,126,123,129,129,119,134,30,251,0,233,173,10,132,136,133,130,30,251,15,
+55,53,223,5,145,133,133,142,133,27,122,125,247,136,29,33,29,158,248,185,151,
+10,33,29,64,248,235,132,29,33,29,251,85,248,206,21,174,10,247,114,22,247,
+12,29,14,33,29,251,39,248,223,247,98,10,133,142,133,146,132,227,10,39,29,
+247,117,249,64,151,10,39,29,152,247,156,29,247,114,22,104,107,247,13,10,56,
+10,247,228,249,6,131,29,44,10,201,248,25,193,10,127,247,21,29,124,128,135,
+133,247,54,10,35,10,110,248,75,151,29,198,29,248,49,22,241,6,161,154,247,
+42,10,91,6,247,113,10,147,146,26,201,81,181,54,221,10,215,166,144,173,27,
+202,178,115,102,133,139,136,138,136,31,125,75,5,154,85,110,143,95,27,251,
+34,251,1,64,41,72,191,99,224,208,199,161,191,210,31,153,200,21,78,60,82,116,
+68,27,81,106,162,180,204,224,188,247,5,179,181,134,130,174,31,251,38,248,
+46,67,10,44,10,34,248,63,247,81,10,141,134,147,132,247,118,29,147,144,136,
+146,27,155,154,153,155,144,139,139,133,147,31,135,144,5,14,44,10,114,248,
+95,218,29,123,115,247,64,10,14,248,49,22,240,203,29,91,6,195,247,147,5,140,
+147,140,145,148,26,201,81,181,55,221,10,213,168,144,172,27,202,176,117,100,
+141,31,134,139,135,138,136,30,126,75,5,154,84,111,143,95,27,251,34,251,1,
+64,40,73,191,99,224,207,200,161,191,210,31,152,200,21,78,61,82,116,67,27,
+82,106,162,180,204,223,188,247,5,180,180,134,130,175,31,236,248,38,158,10,
+110,127,143,117,27,113,115,129,112,104,232,10,147,142,145,146,30,168,173,
+149,144,157,27,150,149,135,128,155,31,115,176,156,132,162,239,29,247,208,
+124,21,196,141,185,150,186,160,77,29,71,173,81,195,112,31,157,131,153,135,
+168,134,124,73,24,247,102,29,128,143,149,120,31,144,130,136,140,133,27,124,
+125,126,124,119,183,119,181,196,181,175,187,169,121,156,105,142,31,14,35,
+29,147,247,228,44,29,35,29,56,248,22,247,42,29,247,15,29,210,29,130,148,31,
+14,212,29,251,4,221,63,247,12,243,247,23,189,179,151,131,148,126,133,135,
+137,133,129,30,109,93,63,117,76,27,45,74,197,224,143,139,144,140,147,31,248,
+9,190,21,251,253,6,220,173,224,194,231,27,228,200,86,62,31,251,93,247,249,
+21,174,10,247,114,22,105,247,40,29,169,173,165,120,157,112,31,14,35,29,251,
+51,248,10,247,60,10,133,247,92,10,131,147,144,136,145,27,155,247,107,10,39,
+10,247,77,248,173,173,29,142,140,148,152,30,14,248,51,124,10,224,248,223,
+247,24,10,145,146,142,145,148,30,247,15,247,154,10,39,10,109,248,194,21,130,
+29,247,114,247,152,10,39,10,158,248,211,247,98,10,132,142,133,212,10,247,
+155,248,55,21,57,247,70,29,159,31,166,200,10,120,31,100,6,191,247,132,5,215,
+216,169,155,199,27,176,156,133,121,158,31,154,124,146,122,119,26,128,139,
+138,138,133,30,87,251,130,5,110,168,10,247,0,68,29,112,6,192,247,135,5,140,
+146,140,147,148,26,208,85,185,57,79,98,121,84,75,30,247,196,247,133,247,6,
+29,104,128,247,126,29,109,127,143,118,27,112,116,129,112,103,31,119,123,131,
+129,127,26,128,148,131,152,146,147,142,145,146,30,168,174,148,144,157,27,
+150,149,135,128,156,31,115,175,156,132,163,27,165,164,151,169,175,31,159,
+155,143,145,247,56,29,45,29,247,36,247,98,193,10,127,30,251,27,247,50,10,
+140,148,151,30,14,45,29,192,247,148,247,42,29,129,134,133,247,14,29,148,30,
+247,15,247,154,10,155,29,58,251,0,174,29,75,247,119,67,10,45,29,123,247,136,
+156,10,155,29,57,32,174,29,247,78,247,111,158,10,109,127,143,118,27,112,247,
+156,10,168,173,149,144,157,27,150,148,135,128,157,31,115,175,156,132,163,
+239,29,243,201,10,247,23,247,135,10,160,103,151,79,145,63,219,10,133,157,
+119,135,26,138,247,114,10,149,149,160,144,30,153,207,247,116,29,142,26,151,
+130,148,127,125,128,129,123,134,30,165,111,96,153,85,27,251,5,247,34,10,193,
+133,164,133,161,247,94,10,47,64,82,247,102,10,141,142,26,150,129,148,127,
+122,129,129,118,134,30,247,182,248,1,173,10,132,136,133,130,30,251,15,55,
+53,223,5,145,132,134,142,132,27,123,125,125,124,130,140,137,149,130,31,14,
+33,10,207,248,167,21,156,150,142,144,151,247,76,10,132,133,137,131,128,223,
+29,33,10,123,248,217,21,251,50,247,149,10,145,141,146,149,247,100,10,146,
+27,154,154,153,154,147,198,29,248,69,22,220,89,29,112,6,219,248,4,5,247,166,
+10,201,163,188,204,31,251,25,248,188,67,10,33,10,54,248,205,21,148,131,135,
+141,131,27,123,124,125,124,133,142,132,146,133,247,118,29,147,144,247,38,
+29,40,10,248,29,247,112,44,29,40,10,247,41,247,133,21,130,29,247,113,22,104,
+107,108,106,113,158,121,165,175,247,76,29,14,247,3,29,149,130,151,247,85,
+10,252,1,251,216,130,95,5,248,21,6,160,238,247,116,29,143,26,150,130,148,
+127,247,13,29,251,50,243,131,29,247,237,248,171,21,80,6,120,127,129,123,127,
+148,132,154,31,148,6,99,251,76,5,121,6,120,126,128,124,127,148,132,154,31,
+221,6,157,152,150,154,152,131,145,123,31,123,6,170,247,35,5,178,180,159,149,
+174,27,171,162,123,117,137,31,138,130,107,251,37,5,128,6,120,126,129,123,
+127,148,132,154,31,207,6,157,152,150,154,151,131,146,123,31,130,6,171,247,
+39,5,140,145,140,145,143,26,184,103,168,83,104,115,130,115,106,30,14,247,
+138,248,4,21,206,68,29,74,92,10,162,247,7,10,74,6,247,243,247,209,21,206,
+141,29,75,92,10,161,154,151,157,153,130,146,120,31,74,6,14,248,141,190,21,
+218,248,4,5,251,56,6,150,194,10,148,141,139,143,27,153,153,247,131,10,105,
+146,119,27,112,118,131,118,110,111,29,251,12,22,251,5,6,208,247,209,5,247,
+5,6,251,238,251,209,129,29,248,255,248,217,21,91,153,5,143,123,117,143,126,
+27,112,119,131,118,109,111,29,71,6,87,22,251,5,6,208,247,209,5,218,203,29,
+62,6,150,191,5,185,149,174,174,174,27,153,153,136,133,159,31,252,19,252,128,
+129,29,248,232,248,109,21,148,148,143,145,147,26,150,131,146,175,29,130,130,
+135,132,131,26,129,147,131,149,147,141,140,151,152,30,247,7,112,29,248,14,
+251,9,21,178,162,160,172,177,26,186,103,173,87,247,26,10,90,178,103,247,36,
+29,172,160,120,110,103,102,108,97,108,116,191,10,14,248,219,248,109,21,148,
+148,143,146,146,26,149,131,147,175,29,128,128,136,134,132,26,128,147,131,
+150,147,142,141,150,151,84,29,251,167,247,201,247,130,29,183,138,169,178,
+29,168,127,161,112,210,10,149,30,156,158,164,148,167,27,173,160,122,113,107,
+105,112,98,31,14,248,219,248,109,21,148,147,143,147,146,26,149,131,147,129,
+131,136,137,128,127,30,252,74,252,45,5,129,129,135,133,132,26,128,147,131,
+150,147,141,141,150,152,30,248,62,247,9,21,178,162,160,173,176,26,186,102,
+173,88,247,26,10,89,178,104,247,36,29,171,161,120,111,102,102,108,97,107,
+117,191,10,251,195,248,39,87,10,248,218,248,109,21,149,148,143,146,146,26,
+149,131,147,175,29,128,129,136,133,132,26,128,147,131,150,147,141,140,151,
+152,84,29,251,48,248,39,21,45,251,64,83,251,0,129,26,138,131,5,136,151,133,
+146,146,149,247,99,29,251,116,6,128,87,5,126,136,147,129,151,27,152,147,146,
+154,142,31,142,151,5,14,247,166,248,39,21,135,121,137,121,122,26,77,173,99,
+191,206,196,199,233,159,30,151,194,5,143,157,141,155,158,26,200,105,179,87,
+72,83,79,46,118,30,247,64,87,21,71,125,98,90,97,27,107,122,164,188,153,140,
+154,142,152,31,149,188,146,171,156,174,160,163,25,156,153,156,147,159,27,
+173,155,116,88,124,138,125,136,127,31,14,248,43,247,240,21,128,88,5,109,6,
+120,127,130,124,128,145,133,152,31,225,6,156,150,149,154,150,133,144,125,
+31,130,6,149,190,5,148,6,157,151,149,153,150,132,145,126,31,130,6,185,247,
+106,5,76,6,251,68,251,109,131,101,5,247,50,180,21,40,6,247,26,247,57,5,14,
+248,1,248,198,87,10,248,131,248,206,21,168,132,5,150,151,151,151,152,118,
+150,114,251,12,41,251,3,251,27,63,170,98,196,208,202,206,212,190,106,173,
+90,109,109,125,111,110,31,150,207,223,213,202,136,8,251,57,251,96,21,184,
+170,168,160,171,27,162,161,116,113,124,128,108,129,125,31,118,124,116,126,
+116,27,103,124,160,195,135,31,14,248,122,248,198,21,45,251,62,82,251,2,129,
+26,138,131,5,136,151,133,146,147,148,247,99,29,251,115,6,127,87,5,136,7,125,
+144,133,151,153,146,146,154,143,30,141,151,5,14,248,94,248,72,21,177,161,
+160,174,179,26,184,103,172,89,74,74,82,82,112,147,120,158,124,30,92,110,119,
+106,94,26,94,179,103,190,210,206,199,203,164,128,161,118,156,30,102,247,26,
+21,172,161,120,111,105,101,106,98,106,117,156,166,176,177,172,180,31,106,
+251,46,21,175,164,119,110,99,96,101,94,103,116,160,172,177,180,174,184,31,
+14,247,153,247,165,21,124,160,129,171,186,196,166,181,181,30,180,180,161,
+202,214,26,211,105,182,84,72,75,70,68,87,174,101,186,166,172,154,165,167,
+30,127,90,122,112,101,112,8,119,111,109,129,106,27,133,131,141,141,136,31,
+142,133,139,139,132,27,128,126,128,131,31,247,113,247,105,21,100,114,100,
+110,114,27,111,118,162,171,186,179,185,181,176,158,111,87,31,14,247,117,195,
+29,247,139,10,58,48,10,247,105,141,29,60,6,247,119,29,221,6,161,153,150,158,
+153,130,146,120,31,251,104,6,116,125,127,121,124,148,133,158,31,248,93,22,
+38,252,101,5,64,123,63,80,60,27,97,89,161,169,112,31,161,119,138,140,129,
+27,122,125,125,123,130,141,136,162,119,31,93,189,180,121,195,27,244,244,222,
+239,160,31,241,248,103,5,160,141,29,251,72,80,29,14,32,10,251,1,247,152,68,
+10,248,90,248,199,21,125,29,247,150,6,162,251,25,5,69,48,10,217,165,10,160,
+157,162,169,157,31,165,155,169,152,154,141,8,160,142,150,149,156,26,154,130,
+145,119,30,107,6,54,247,76,243,10,14,43,29,110,247,95,56,29,43,29,251,21,
+233,60,10,43,29,35,247,117,247,1,10,14,81,10,233,248,211,60,10,59,10,32,29,
+247,119,248,211,60,10,32,29,247,155,228,29,247,73,190,21,186,247,107,5,70,
+10,248,1,6,76,108,113,110,98,26,106,165,121,185,184,247,35,29,135,138,114,
+27,121,130,145,152,175,185,175,211,159,31,147,141,174,247,52,228,10,14,34,
+29,251,46,249,115,247,129,10,184,154,169,177,135,10,34,29,103,249,100,21,
+105,247,53,29,113,31,14,37,10,247,20,228,29,40,29,247,127,249,64,56,29,40,
+29,248,24,248,115,21,149,150,142,146,147,26,149,129,149,127,129,132,135,127,
+128,30,251,3,251,16,5,129,128,247,28,10,42,29,247,5,249,115,56,29,42,29,132,
+249,6,60,10,37,29,240,247,101,91,10,38,10,247,108,248,74,56,29,38,10,195,
+247,221,60,10,34,10,142,247,95,56,29,247,206,124,21,247,29,148,238,223,246,
+26,175,123,173,113,157,30,247,65,10,207,215,198,228,175,175,128,123,156,30,
+147,131,160,109,102,29,137,131,5,85,10,161,108,185,115,190,133,25,124,71,
+5,169,6,160,148,133,127,125,122,128,116,122,125,143,149,121,31,143,133,137,
+139,130,27,123,128,129,123,127,144,132,150,132,31,129,157,167,132,160,27,
+197,182,174,185,172,121,157,103,144,31,14,52,29,135,248,211,60,10,33,29,70,
+248,252,154,29,14,33,29,73,248,183,91,10,56,10,248,98,249,115,21,152,247,
+75,29,127,130,235,10,139,139,149,157,30,14,56,10,247,249,249,137,237,10,32,
+10,247,8,247,49,49,29,52,29,251,13,251,36,43,10,43,29,35,247,145,143,10,128,
+149,31,14,211,93,29,120,125,170,29,148,6,247,193,247,165,247,24,10,146,145,
+142,145,148,30,247,15,247,154,10,83,29,247,137,247,1,10,247,113,22,106,106,
+107,107,114,159,119,163,174,171,170,172,165,120,158,113,31,14,76,29,247,22,
+249,114,132,29,247,95,248,17,21,67,251,222,5,98,6,115,125,213,10,156,155,
+130,145,205,10,247,151,6,187,29,211,247,222,5,167,247,17,29,112,6,157,220,
+245,29,121,124,216,10,186,6,122,58,5,251,152,6,157,220,198,10,121,58,5,104,
+169,10,223,22,247,152,6,125,75,5,251,151,6,14,32,29,248,9,248,254,49,29,34,
+29,84,249,128,207,29,224,53,5,132,146,144,136,146,247,67,29,62,10,247,126,
+248,155,21,251,47,251,1,5,123,247,57,10,145,30,247,13,226,225,53,5,131,146,
+144,137,145,247,67,29,37,10,247,120,248,254,49,29,128,29,247,138,165,10,154,
+148,155,155,154,31,155,152,167,156,154,144,188,155,139,139,144,145,8,145,
+145,142,146,145,26,155,130,145,118,30,251,24,6,14,87,29,225,248,255,143,10,
+129,149,31,14,64,29,247,25,251,36,43,10,40,29,210,251,36,43,10,42,29,251,
+23,46,43,10,37,29,247,39,247,37,49,29,38,10,111,252,26,43,10,34,10,63,247,
+145,131,10,34,29,251,111,251,22,247,73,10,128,149,129,188,29,33,29,159,248,
+119,49,29,86,29,123,26,48,207,73,233,30,164,140,5,98,113,120,112,106,185,
+10,161,152,155,174,163,31,247,14,222,184,192,157,220,8,14,32,29,247,30,249,
+101,68,10,110,10,122,249,101,106,29,247,199,248,55,21,251,58,80,29,247,4,
+189,29,251,6,48,10,247,170,89,29,251,4,247,45,29,247,175,251,33,21,54,252,
+25,5,74,123,85,94,75,27,251,20,202,10,247,21,6,229,137,224,209,158,230,235,
+248,78,24,251,139,103,10,247,147,247,146,247,5,10,247,179,190,21,230,248,
+58,5,186,150,189,90,10,14,35,10,251,18,248,41,46,10,248,112,190,21,93,10,
+127,81,5,178,165,29,171,173,170,207,167,31,157,147,147,148,153,26,154,131,
+145,118,30,55,207,224,29,14,36,29,154,247,92,44,29,36,29,251,37,230,53,29,
+36,29,41,247,113,98,10,164,29,40,215,64,128,10,248,37,247,81,247,61,29,135,
+127,129,30,251,3,251,15,5,129,127,247,28,10,248,255,248,156,21,157,222,5,
+37,161,10,121,123,147,133,160,31,186,6,132,107,5,251,25,6,115,126,128,119,
+125,147,133,159,31,247,23,6,112,251,20,5,202,103,89,168,67,27,251,35,251,
+23,251,24,251,35,39,215,65,222,29,230,248,54,5,189,6,164,151,149,159,154,
+131,145,119,31,251,193,251,30,229,29,14,35,29,251,13,247,119,53,29,35,29,
+45,247,249,98,10,212,29,251,1,221,60,247,5,148,155,140,140,154,30,102,111,
+122,112,107,186,10,175,168,162,247,7,195,31,185,160,154,152,156,26,135,29,
+14,41,29,113,247,114,46,10,41,29,214,247,119,98,10,47,10,247,114,249,64,56,
+29,47,10,247,142,248,156,148,10,36,10,247,206,247,120,44,29,36,10,247,46,
+247,11,53,29,45,29,216,247,92,54,10,41,10,247,132,247,154,44,29,38,29,248,
+78,248,110,44,29,38,29,247,207,248,160,132,10,38,29,247,84,251,99,43,10,46,
+29,230,247,44,148,10,33,10,135,248,237,149,29,33,10,115,248,161,54,10,98,
+29,142,247,105,21,154,150,143,145,150,247,76,10,132,134,137,131,128,223,10,
+98,29,251,22,247,126,98,10,247,175,248,159,21,156,219,5,216,29,133,110,5,
+94,169,10,181,6,48,252,58,73,29,92,119,87,81,30,163,247,4,5,247,34,6,161,
+154,150,157,247,20,10,14,46,29,251,73,252,148,43,10,248,38,22,247,53,248,
+4,5,155,247,157,29,181,114,10,189,249,18,247,41,10,172,10,137,142,130,148,
+31,14,42,10,51,139,10,35,10,216,247,218,49,29,80,10,247,158,247,162,151,29,
+137,142,129,148,31,14,36,29,48,247,142,247,42,29,214,29,148,247,154,29,143,
+130,147,31,14,35,29,147,247,165,49,29,41,29,225,247,148,247,41,10,247,15,
+29,146,142,145,148,247,100,10,145,27,155,154,153,155,146,198,29,120,10,133,
+248,189,117,29,39,10,247,89,248,110,49,29,248,127,122,29,247,105,247,162,
+247,42,29,247,150,10,247,14,247,27,29,143,130,147,31,14,69,10,247,16,46,43,
+10,47,10,117,251,36,43,10,36,10,203,252,89,43,10,45,29,247,41,247,35,49,29,
+41,10,69,252,55,43,10,33,10,251,23,248,183,46,10,33,10,227,248,104,49,29,
+248,212,248,55,21,247,166,10,202,163,188,203,31,127,82,5,158,165,29,170,175,
+172,199,164,31,163,148,147,148,154,26,153,130,146,119,30,112,6,14,41,10,219,
+247,45,53,29,247,206,124,21,247,21,147,226,202,225,26,164,125,167,118,155,
+30,71,29,63,83,146,29,129,148,127,122,129,129,118,134,30,122,58,247,141,10,
+206,29,140,7,161,115,177,123,188,133,125,74,247,164,29,104,142,31,14,41,29,
+247,47,247,130,247,61,29,134,128,129,30,251,3,251,15,5,129,128,136,132,247,
+55,29,247,81,247,246,21,165,194,157,164,174,169,8,179,184,190,159,194,27,
+184,185,124,115,164,31,149,130,158,109,134,26,136,102,5,133,152,130,148,156,
+149,149,159,144,30,162,247,2,5,140,144,140,143,143,26,247,130,10,135,121,
+5,179,101,85,160,76,27,251,18,251,6,53,251,27,87,31,110,6,119,128,129,119,
+127,146,134,155,31,163,6,129,91,5,113,6,118,128,129,119,127,147,134,155,31,
+165,6,96,140,131,146,114,30,45,168,218,81,237,27,210,212,168,193,203,31,167,
+163,147,149,152,26,150,131,147,126,129,134,137,130,130,30,76,70,86,115,71,
+27,73,87,169,193,109,31,122,168,134,162,180,26,247,145,247,121,10,251,146,
+6,149,187,5,247,177,247,121,10,14,248,77,247,157,21,151,195,5,140,142,139,
+142,142,26,152,130,148,126,125,129,130,122,135,30,126,78,5,102,6,120,126,
+129,123,125,148,131,157,31,170,6,107,251,37,5,137,131,138,132,134,26,98,177,
+112,195,174,185,148,153,171,30,163,149,147,147,152,26,152,130,148,126,134,
+137,138,135,130,30,126,114,94,129,105,27,111,119,151,154,140,31,140,140,142,
+140,144,30,172,247,41,5,247,18,6,158,152,150,154,154,130,146,122,31,252,52,
+101,21,166,6,247,23,247,8,232,246,219,72,195,43,31,251,32,119,10,247,26,6,
+190,139,139,146,147,31,147,145,143,148,147,26,153,130,146,119,30,74,6,188,
+247,118,21,190,247,127,5,183,6,207,186,100,82,67,51,72,44,31,14,247,73,247,
+67,21,70,114,90,83,105,27,120,126,127,123,124,170,29,247,215,6,170,167,154,
+166,162,247,2,10,130,120,122,116,27,251,130,6,169,169,165,183,157,189,8,247,
+22,6,160,150,149,159,151,131,144,123,31,251,17,6,143,161,140,148,140,156,
+8,247,24,6,159,150,149,159,151,132,144,122,31,251,32,6,136,184,137,165,144,
+26,180,148,165,165,165,30,164,162,171,154,170,27,173,160,126,106,159,31,129,
+145,145,135,147,27,154,247,62,10,101,27,93,95,120,103,103,31,101,102,122,
+97,84,26,120,139,135,144,91,30,69,6,117,128,129,119,127,147,134,156,31,219,
+6,138,129,136,115,136,125,8,53,6,118,128,129,119,128,147,133,156,31,14,247,
+120,247,158,21,203,6,131,100,5,137,130,139,139,137,26,127,148,130,150,156,
+151,150,158,144,30,167,247,22,140,149,5,153,140,130,148,126,27,128,136,137,
+131,130,31,133,134,139,139,136,123,130,99,24,75,6,182,247,87,5,247,80,6,122,
+63,5,138,132,138,135,136,26,127,148,132,153,155,149,150,159,144,30,166,247,
+21,5,251,214,6,123,135,138,132,133,31,133,132,134,130,135,26,124,150,131,
+157,30,167,6,38,252,97,5,109,6,128,130,136,135,134,31,134,135,132,126,135,
+26,124,149,131,158,30,247,55,6,163,153,151,158,152,128,146,120,31,58,6,247,
+221,247,202,21,47,6,117,124,128,122,123,216,10,177,6,82,251,151,5,101,6,116,
+126,127,119,127,149,132,157,31,247,74,6,163,152,151,161,144,135,145,133,143,
+31,141,135,139,139,124,27,47,6,171,247,42,157,158,139,139,206,209,25,162,
+161,149,146,150,27,147,158,128,130,145,31,122,151,143,135,149,27,154,152,
+152,155,151,136,144,125,153,31,162,116,122,148,116,27,105,123,127,65,73,31,
+14,121,29,121,29,193,29,249,8,247,148,21,161,154,150,158,161,29,252,180,142,
+29,14,248,114,247,172,21,84,98,121,100,104,31,110,106,122,95,99,26,72,178,
+102,211,191,181,158,177,173,30,168,172,156,182,180,26,205,99,177,71,30,122,
+92,21,187,165,115,93,76,91,88,79,90,113,163,186,163,147,164,154,159,31,169,
+161,166,153,176,27,247,76,247,237,21,147,148,143,148,147,26,151,131,147,128,
+128,131,134,128,129,30,252,175,252,239,5,131,130,135,131,130,26,127,147,131,
+151,148,148,144,150,149,30,247,152,248,41,21,144,136,135,142,133,27,134,135,
+138,134,133,31,116,105,111,129,112,27,98,113,167,182,202,188,190,199,159,
+155,134,129,150,31,147,131,141,133,117,26,128,147,131,148,141,30,141,140,
+147,140,5,149,140,148,148,149,26,141,7,142,7,159,142,155,144,151,30,146,155,
+139,139,144,26,149,132,146,130,128,133,135,126,128,30,154,111,126,143,115,
+27,49,60,57,47,76,180,97,199,177,197,160,162,166,31,148,147,143,146,148,26,
+143,139,141,138,140,30,14,248,130,247,64,21,113,186,127,156,109,163,8,246,
+174,199,200,213,26,215,73,196,51,30,251,141,48,10,187,146,10,89,80,29,247,
+62,247,143,10,181,247,87,5,247,19,6,175,122,171,106,161,97,58,112,24,120,
+132,130,130,125,26,128,148,129,150,143,144,140,142,147,30,232,170,151,111,
+147,117,156,89,25,143,128,5,199,6,162,153,151,157,153,130,146,120,31,112,
+6,115,202,133,153,232,170,5,158,145,148,149,153,26,149,130,149,129,135,129,
+137,138,135,30,252,0,230,247,83,10,74,44,79,35,31,14,136,29,248,169,248,161,
+49,29,35,10,124,248,95,154,10,184,247,4,232,29,135,137,131,127,223,10,63,
+29,247,74,248,60,131,10,35,29,251,87,247,244,46,10,248,52,248,55,21,251,58,
+80,29,247,4,189,29,251,48,48,10,247,192,6,87,113,112,104,99,186,10,171,173,
+169,206,168,31,158,147,147,148,153,26,154,130,145,119,30,247,4,29,47,10,247,
+136,247,223,247,82,29,185,183,178,181,173,113,163,103,31,14,247,241,54,29,
+85,247,114,117,29,99,29,127,129,135,115,29,190,247,130,44,29,39,10,247,53,
+248,186,95,29,247,56,29,33,10,247,2,248,180,247,6,29,104,128,133,123,27,128,
+131,143,158,108,31,158,110,127,143,117,27,113,114,128,113,105,232,10,148,
+142,145,145,30,167,173,149,145,157,27,150,149,135,128,155,31,115,175,157,
+132,162,27,165,164,151,169,175,31,158,154,144,146,247,56,29,40,29,247,142,
+247,230,247,82,29,186,183,179,181,172,113,163,102,31,14,109,10,42,247,140,
+106,29,34,10,251,133,253,5,43,10,52,29,251,13,251,36,43,10,46,29,251,73,252,
+148,43,10,33,29,251,113,248,222,68,10,32,10,177,247,182,154,29,182,247,1,
+21,153,247,75,29,126,131,235,10,149,143,145,146,30,14,62,29,248,2,249,27,
+56,29,49,10,247,100,221,29,125,129,133,131,130,26,126,149,247,136,10,248,
+253,195,29,247,11,10,120,125,216,10,207,6,45,252,66,251,84,248,117,5,251,
+2,80,29,187,247,162,29,232,248,66,247,87,252,112,131,105,126,77,91,100,74,
+138,25,70,6,122,125,125,123,124,148,133,160,31,202,6,229,137,224,209,157,
+229,8,14,248,30,247,208,21,182,247,88,5,247,45,6,111,251,23,5,137,130,139,
+139,137,26,127,149,129,151,154,150,148,153,142,30,142,146,178,247,77,5,252,
+99,6,100,251,74,5,138,135,139,136,135,26,126,148,130,150,145,150,144,144,
+145,30,144,143,139,139,144,155,167,247,26,24,247,46,6,96,251,88,5,38,6,116,
+124,126,121,127,150,131,158,31,238,6,92,251,106,5,38,6,118,123,126,123,125,
+150,131,156,31,247,143,6,149,143,140,142,146,31,147,142,148,152,148,26,153,
+129,147,120,30,41,6,185,247,106,5,241,6,150,148,142,143,144,31,144,143,145,
+151,143,26,156,131,146,119,30,14,247,127,247,183,21,215,217,168,154,200,27,
+200,173,115,94,132,138,134,138,128,31,71,251,203,5,74,124,84,94,75,27,78,
+168,10,201,6,230,137,223,209,158,230,207,247,209,24,142,149,140,150,147,26,
+205,84,183,57,78,98,121,84,76,30,152,198,5,57,80,29,167,189,29,98,6,115,125,
+128,120,125,149,132,158,31,247,24,141,29,101,6,14,247,145,247,187,21,156,
+212,5,247,111,247,122,10,251,109,6,163,247,2,247,116,29,141,26,153,131,147,
+125,129,136,137,131,130,30,133,134,139,139,136,124,114,251,5,24,69,6,116,
+126,247,115,29,158,31,207,6,122,66,5,93,247,70,29,159,31,182,6,110,251,25,
+5,136,127,138,129,131,26,82,197,99,221,184,191,149,159,199,30,180,152,159,
+154,155,26,150,129,150,130,134,133,137,135,129,30,94,119,139,139,98,131,8,
+131,102,118,136,112,27,81,105,160,174,148,140,146,140,147,31,167,247,21,5,
+247,72,247,122,10,14,247,120,247,71,21,188,173,247,24,251,54,5,122,48,10,
+247,23,68,29,97,6,251,51,247,85,247,71,247,16,5,184,6,161,154,247,42,10,251,
+22,80,29,145,6,251,72,251,19,178,247,70,5,37,6,115,126,247,115,10,158,31,
+187,189,29,89,48,10,239,6,14,247,179,64,10,127,247,103,21,148,149,143,146,
+166,29,33,29,180,248,194,100,29,45,10,103,247,234,232,29,135,137,131,127,
+223,29,37,10,247,137,249,73,100,29,83,29,247,153,21,148,131,134,141,132,27,
+123,124,124,123,135,142,133,247,92,10,130,146,143,137,148,27,154,154,154,
+155,144,136,144,132,146,31,14,84,10,248,27,221,29,126,130,133,130,130,26,
+126,148,247,136,10,42,10,84,149,10,42,10,247,45,248,224,232,29,134,137,131,
+128,30,251,28,41,5,124,128,135,134,127,247,66,10,39,29,155,249,102,21,147,
+131,247,47,29,232,41,5,130,145,143,137,149,27,154,154,154,155,144,136,143,
+131,147,31,14,40,10,247,53,247,150,156,29,14,14,247,109,248,35,21,117,121,
+122,117,118,156,121,161,161,156,156,161,160,122,157,118,31,247,65,140,21,
+117,121,121,118,117,157,121,161,160,157,157,160,161,121,157,118,31,233,55,
+21,130,100,131,123,119,115,8,97,102,92,119,77,27,76,93,159,181,102,31,119,
+163,131,155,130,178,144,72,147,108,162,104,8,91,172,189,114,203,27,198,186,
+160,180,171,31,168,176,150,174,144,211,8,251,71,247,139,166,10,131,102,21,
+247,29,247,3,251,0,251,27,251,29,251,1,251,1,251,28,251,27,251,1,247,1,247,
+28,247,25,247,2,247,3,247,23,31,14,247,197,248,199,166,10,48,251,52,246,29,
+247,162,52,21,134,72,130,108,116,105,8,90,106,90,114,75,27,79,94,160,180,
+106,31,110,176,128,173,133,212,149,99,147,122,158,117,8,97,174,188,118,202,
+27,201,188,160,181,174,31,158,161,147,156,149,179,8,41,226,246,29,14,247,
+192,117,21,155,210,186,219,227,247,2,8,213,233,164,191,201,26,202,85,192,
+74,75,93,98,63,118,30,217,114,95,178,75,27,74,88,86,71,87,155,104,204,51,
+31,247,9,251,48,169,86,160,59,8,14,246,247,162,21,225,32,220,251,9,175,71,
+186,224,227,247,15,219,235,77,209,251,16,247,68,110,196,96,58,83,60,251,6,
+251,35,8,14,248,130,22,155,7,251,21,158,80,206,247,24,26,156,110,145,129,
+148,128,8,104,169,186,115,181,27,209,194,196,212,209,89,194,76,120,128,136,
+126,112,31,137,138,130,134,134,137,8,161,170,147,163,168,26,208,83,193,68,
+68,84,85,69,112,144,125,165,97,30,156,104,120,145,118,27,79,88,82,70,67,195,
+83,210,202,192,177,210,173,31,140,120,5,133,7,138,83,110,76,98,106,114,120,
+121,132,66,124,8,123,7,14,247,34,22,248,9,157,6,251,17,145,81,205,141,247,
+23,8,74,173,175,114,195,27,193,184,186,197,192,119,170,56,215,31,55,216,124,
+161,109,229,127,68,92,71,58,74,8,77,88,112,95,90,26,81,186,91,196,195,179,
+168,200,168,30,251,20,144,71,64,251,14,27,14,247,228,248,49,21,145,117,119,
+142,118,27,251,11,44,44,251,10,251,10,234,44,247,10,247,10,234,234,247,10,
+219,94,212,69,176,31,227,247,83,5,97,170,170,109,149,27,146,143,143,144,143,
+137,143,133,149,31,117,173,120,192,136,175,8,158,138,138,142,133,27,135,135,
+137,131,129,31,120,122,74,115,103,136,8,121,136,135,137,131,26,128,163,132,
+178,30,159,6,159,140,5,141,6,251,49,251,121,21,234,216,64,47,45,64,63,45,
+46,63,214,232,231,215,216,229,31,14,247,214,247,172,21,246,148,224,233,247,
+1,26,247,10,43,234,251,10,251,10,44,44,251,10,251,1,224,45,245,130,30,50,
+251,41,100,247,41,251,44,183,247,44,247,40,178,251,40,7,114,248,105,21,235,
+216,64,47,45,63,63,45,46,63,214,233,230,215,216,229,31,14,247,166,247,40,
+21,144,126,122,143,125,27,87,93,94,89,110,161,120,173,211,190,194,218,31,
+247,139,7,186,132,179,75,70,26,96,131,105,119,94,30,162,6,169,176,155,185,
+188,26,202,115,199,89,199,30,97,190,138,140,134,144,133,148,25,188,102,7,
+14,247,35,248,43,21,115,109,124,104,135,101,8,44,94,235,6,143,100,153,104,
+162,110,72,72,24,171,107,206,207,169,115,171,126,180,133,25,44,184,234,7,
+180,145,173,153,167,162,206,71,24,171,171,72,207,161,164,154,175,144,180,
+25,235,184,43,6,134,179,124,175,117,166,206,206,24,107,171,72,72,112,161,
+99,155,103,143,25,234,94,45,7,103,135,98,121,114,117,71,207,24,107,107,5,
+247,114,93,21,220,204,76,60,58,75,75,59,60,75,203,218,218,203,204,216,31,
+14,200,22,248,115,248,115,252,115,6,247,130,251,33,21,195,183,95,83,86,94,
+95,86,84,95,183,193,193,183,184,192,31,14,247,189,248,92,21,236,218,62,43,
+41,62,61,42,44,61,217,236,233,217,219,232,31,145,179,21,251,13,42,45,251,
+11,251,12,234,43,247,12,247,10,235,235,247,11,247,9,43,236,251,7,31,14,247,
+195,248,92,21,41,60,62,43,41,216,61,237,235,217,217,236,234,61,218,45,31,
+247,171,252,92,21,248,199,252,199,252,199,7,247,170,248,132,21,247,13,236,
+45,251,11,251,12,44,43,251,11,251,11,43,235,247,11,247,8,235,237,247,7,31,
+14,158,22,248,199,247,174,252,199,6,14,199,248,117,21,252,117,248,115,248,
+117,7,14,156,22,248,203,248,203,252,203,6,248,146,252,146,21,252,89,248,89,
+248,89,6,14,248,167,190,21,251,123,248,70,251,124,252,70,5,14,163,247,107,
+21,248,60,99,10,252,60,6,14,248,221,247,159,21,252,60,6,163,171,160,181,154,
+26,147,132,146,130,132,135,137,132,133,30,100,94,120,124,65,96,8,125,131,
+136,136,131,26,132,143,135,158,129,30,198,106,170,115,169,104,8,127,149,144,
+135,145,27,149,147,145,147,154,123,171,110,183,31,248,60,6,14,247,53,247,
+158,21,169,184,154,170,154,26,147,131,145,130,132,135,136,126,128,30,108,
+104,110,116,79,105,8,120,129,135,135,132,26,133,143,133,146,135,30,145,136,
+140,138,143,137,145,136,25,153,130,188,110,163,119,173,100,25,132,145,143,
+137,146,27,148,146,146,147,154,118,181,115,171,31,247,179,99,10,14,247,208,
+127,21,248,52,7,117,170,184,117,154,27,147,146,146,148,146,137,143,131,145,
+31,99,172,121,160,108,189,136,143,136,143,136,145,136,144,136,144,138,140,
+8,247,85,29,105,81,116,110,102,108,8,126,129,136,134,133,26,129,145,132,147,
+154,169,153,169,187,30,252,52,7,14,247,155,248,174,21,252,52,7,162,108,94,
+161,124,27,131,132,132,130,132,141,135,147,133,31,184,101,154,121,184,65,
+8,126,146,142,136,148,27,146,143,144,156,149,31,171,195,165,171,175,169,8,
+152,150,142,144,145,26,148,133,147,131,124,107,124,110,93,30,248,51,7,14,
+247,166,247,2,247,0,10,110,165,107,247,88,10,147,143,31,183,212,158,164,247,
+52,10,95,117,116,107,30,247,174,7,116,171,183,118,113,10,171,154,168,185,
+30,14,247,87,99,21,95,247,106,183,7,251,24,247,81,247,0,10,112,165,106,247,
+88,10,146,143,31,182,213,159,163,247,52,10,94,117,117,108,30,247,173,7,117,
+170,184,117,113,10,172,154,168,184,30,14,247,161,249,27,21,251,137,251,234,
+247,140,251,236,195,140,247,138,247,235,251,136,247,233,5,247,60,251,231,
+21,251,90,251,174,251,89,247,174,247,89,247,171,5,14,198,248,101,21,247,133,
+252,77,247,132,248,77,5,14,247,197,248,202,21,251,55,251,23,251,17,251,48,
+251,50,247,20,251,19,247,53,247,52,247,21,247,19,247,48,247,46,251,22,247,
+21,251,46,31,14,248,147,247,56,21,248,32,93,251,237,251,143,7,168,183,154,
+171,154,26,146,131,146,132,132,134,136,126,128,30,110,104,106,114,81,107,
+8,123,130,133,134,133,26,132,142,134,147,135,30,216,94,161,123,178,94,8,132,
+145,143,136,145,27,147,147,146,147,153,118,180,114,173,31,14,247,79,247,152,
+21,247,81,251,254,5,124,147,149,131,149,27,146,142,142,147,144,138,143,135,
+151,31,251,36,247,245,247,36,247,246,5,142,146,141,148,146,26,145,136,142,
+132,129,134,135,120,126,30,14,248,50,247,152,21,251,81,247,255,5,157,127,
+133,144,129,27,132,136,136,133,132,141,130,142,132,31,247,36,251,246,251,
+36,251,245,5,135,127,138,135,134,26,131,142,136,146,149,149,147,154,147,30,
+14,247,225,22,247,103,248,235,5,85,6,76,251,55,5,251,151,6,77,247,55,5,88,
+6,247,95,252,235,5,247,42,248,21,21,251,3,251,226,5,132,6,36,247,226,5,14,
+247,245,247,220,21,251,172,247,239,5,123,108,134,120,113,26,116,147,123,163,
+109,30,213,48,79,251,1,5,119,104,128,107,117,26,117,148,114,163,101,30,166,
+94,139,139,128,26,123,128,131,117,30,114,63,234,6,186,169,143,147,154,31,
+161,150,151,165,174,26,184,129,160,79,219,30,102,187,126,167,169,26,158,143,
+150,155,171,30,247,218,252,38,5,156,169,144,157,163,26,164,131,156,109,176,
+30,96,192,5,98,190,130,158,174,26,157,143,154,152,172,30,185,247,2,5,159,
+6,161,148,130,115,143,31,137,141,129,141,129,30,156,199,142,155,178,26,197,
+118,163,89,30,64,6,100,127,149,170,31,155,7,140,153,5,94,93,125,110,90,26,
+108,148,112,155,124,30,127,152,155,135,174,27,175,6,14,248,48,247,158,21,
+251,107,251,185,88,247,237,248,199,251,237,88,247,185,251,87,251,185,88,7,
+14,248,160,248,235,21,63,123,101,105,126,132,149,199,113,30,117,190,121,166,
+117,158,8,167,106,93,154,90,27,251,20,34,42,251,10,68,174,81,204,101,31,170,
+121,155,134,195,130,146,186,24,104,145,129,142,122,146,8,80,162,104,190,199,
+26,217,206,206,217,191,171,111,53,182,30,73,172,172,114,192,27,214,184,198,
+237,31,152,7,150,7,165,251,233,21,133,168,137,145,133,155,8,198,119,100,169,
+85,27,64,71,77,69,114,146,107,151,112,31,183,43,139,139,114,26,108,106,112,
+100,102,112,155,181,109,30,97,196,128,154,123,154,118,153,25,160,107,97,151,
+100,27,133,6,130,6,138,95,177,127,151,131,158,111,25,196,49,139,139,166,111,
+8,104,173,180,119,180,27,189,202,162,173,185,31,183,172,160,174,176,26,156,
+135,156,128,163,30,88,247,5,137,146,163,26,165,158,158,166,177,158,116,71,
+156,30,14,144,150,21,161,152,144,144,151,27,148,148,136,134,146,31,104,191,
+139,139,170,27,183,186,171,193,176,31,171,187,156,203,214,26,195,152,7,190,
+144,133,70,157,31,185,251,71,5,89,151,158,113,161,27,164,183,161,167,168,
+31,148,147,146,148,158,162,120,160,24,133,124,134,137,133,27,119,129,152,
+177,129,31,108,247,11,125,192,120,171,115,153,25,237,174,182,180,197,26,228,
+67,206,43,78,91,118,93,92,30,187,101,97,160,82,27,251,2,52,47,251,7,72,160,
+105,206,103,31,180,116,157,119,113,26,133,138,134,135,122,30,159,133,5,180,
+188,151,161,170,26,164,122,159,104,157,30,79,170,139,139,131,145,8,117,157,
+128,161,166,26,193,180,181,193,209,171,86,251,8,30,251,51,7,80,136,112,128,
+109,30,119,132,126,122,129,27,136,134,142,144,131,31,160,110,125,145,116,
+27,109,112,122,109,119,31,128,123,135,129,126,102,8,247,235,247,247,21,247,
+21,138,140,125,188,30,158,169,157,145,171,27,196,180,103,88,106,119,108,108,
+123,31,108,123,120,133,77,124,8,14,174,248,199,21,247,132,252,199,5,189,6,
+247,132,248,199,5,252,90,88,21,248,14,6,251,81,252,72,5,14,174,22,248,166,
+6,251,132,248,198,5,89,6,251,56,252,147,21,247,81,248,71,247,81,252,71,5,
+14,247,193,227,21,63,224,5,248,167,89,252,110,7,85,200,5,71,6,247,140,251,
+173,247,139,247,173,5,71,6,85,78,5,248,110,89,252,167,7,14,247,193,249,9,
+21,214,54,5,252,167,189,248,110,7,193,78,5,207,6,251,139,247,173,251,140,
+251,173,5,207,6,193,200,5,252,110,189,248,167,7,14,248,18,248,14,21,186,229,
+5,143,146,141,146,144,26,152,127,150,125,128,132,134,125,131,30,79,251,6,
+5,251,137,247,18,10,247,111,6,91,49,5,251,63,247,18,29,247,36,6,97,58,5,135,
+132,137,133,134,26,126,151,127,153,150,146,144,154,146,30,194,243,5,247,134,
+247,123,29,251,107,6,187,229,5,247,59,6,161,150,148,155,156,128,148,117,31,
+14,248,158,247,8,224,10,248,80,247,174,126,10,14,247,46,247,209,21,34,6,121,
+140,128,130,138,122,8,138,7,140,122,150,130,157,140,8,199,6,228,251,176,247,
+133,249,47,5,247,59,6,156,152,150,154,155,128,148,120,31,251,102,6,251,85,
+252,204,5,14,247,167,92,21,68,132,111,123,132,136,141,153,131,30,154,128,
+124,148,122,27,113,121,122,114,109,165,118,176,167,167,152,163,162,31,169,
+171,147,169,228,26,248,138,7,157,10,247,166,251,74,21,191,249,53,6,157,10,
+247,218,249,14,21,87,253,53,6,75,131,112,122,134,135,143,148,133,30,160,125,
+129,146,119,27,114,120,122,114,110,164,117,174,163,164,148,154,159,31,176,
+168,153,182,228,26,14,248,130,248,42,247,48,29,136,140,179,88,31,183,83,124,
+162,10,86,203,161,127,172,27,172,170,157,180,174,31,157,161,147,151,148,26,
+152,128,150,125,30,251,32,4,126,135,135,116,122,31,106,115,117,123,117,27,
+123,138,140,179,86,31,183,84,123,162,10,85,204,160,128,172,27,172,170,158,
+180,174,31,158,160,146,152,148,26,152,128,150,125,30,14,188,247,217,21,248,
+62,251,125,5,136,145,145,137,143,27,147,147,144,147,143,31,140,141,5,142,
+144,240,29,149,144,144,147,148,26,144,138,142,137,143,30,137,142,5,146,135,
+131,144,131,27,134,133,137,137,134,31,158,252,195,21,160,150,148,155,156,
+128,148,118,31,252,52,247,18,10,14,248,160,247,217,21,252,63,247,125,5,141,
+134,133,141,135,27,130,131,134,132,135,201,29,132,134,133,130,26,136,141,
+134,141,134,30,140,137,5,131,144,147,134,146,27,144,145,141,142,145,31,119,
+97,21,118,128,130,122,123,150,130,160,31,248,52,247,91,10,247,11,248,25,21,
+248,18,247,123,29,252,70,251,136,6,119,148,128,156,156,148,150,159,30,14,
+202,247,231,21,251,43,144,104,166,95,30,71,181,216,98,225,27,191,187,154,
+166,180,31,190,174,168,185,149,202,8,144,172,140,161,237,26,247,81,7,159,
+128,153,123,123,130,127,117,30,251,84,7,251,16,134,98,120,106,30,87,109,74,
+104,73,27,99,98,152,162,106,31,98,168,120,172,133,187,135,169,139,139,138,
+247,1,8,247,84,7,160,129,152,123,122,130,127,117,30,14,248,173,247,116,21,
+247,42,134,174,112,184,30,206,97,62,180,53,27,87,91,124,112,98,31,88,104,
+110,93,129,77,8,134,105,138,117,42,26,251,82,7,117,148,127,156,155,149,152,
+160,30,247,85,7,140,227,139,139,149,26,142,191,146,169,154,161,8,189,173,
+200,171,203,27,200,198,110,94,171,31,166,102,145,102,251,28,26,251,85,7,117,
+148,127,155,155,150,153,159,30,14,248,217,247,123,21,190,252,141,7,143,247,
+16,205,199,247,21,136,8,247,198,190,251,186,247,57,29,73,153,80,164,101,30,
+162,104,174,108,172,126,8,124,175,167,135,212,27,247,186,190,251,198,6,251,
+20,136,74,197,133,247,12,8,144,7,14,182,203,21,75,248,151,203,251,117,248,
+77,74,252,77,7,14,247,192,247,138,21,82,186,200,105,191,27,167,165,147,152,
+159,31,170,161,162,186,178,26,208,80,195,67,84,79,104,84,97,30,198,89,86,
+169,85,27,67,80,82,68,71,196,82,209,199,184,164,202,193,31,174,178,21,185,
+171,189,169,182,27,186,170,109,94,94,108,107,97,119,118,145,151,117,31,122,
+148,139,139,92,185,8,71,143,21,92,102,88,109,97,27,94,110,170,186,182,170,
+169,184,180,179,116,88,186,31,14,248,101,247,71,21,85,144,119,150,84,197,
+137,140,24,179,191,174,160,194,143,136,189,24,69,134,100,118,87,76,8,194,
+95,79,173,87,27,64,84,85,66,66,192,86,212,197,184,162,196,188,31,142,142,
+142,143,141,142,200,74,173,120,208,132,8,251,89,247,20,21,90,97,93,112,98,
+27,97,109,170,184,183,169,170,183,178,176,118,89,187,31,140,137,139,139,141,
+137,8,14,248,158,247,136,126,10,248,47,248,4,126,29,182,149,147,163,27,155,
+157,130,120,163,31,85,204,160,128,172,27,172,170,157,180,174,31,158,161,247,
+106,29,242,247,31,21,101,107,108,101,100,170,108,179,178,170,170,177,178,
+108,170,99,31,247,89,248,70,21,100,107,108,102,99,171,108,178,178,171,170,
+178,177,108,170,99,31,247,88,252,70,21,100,107,108,102,99,170,108,179,178,
+171,170,178,177,107,170,100,31,14,248,125,248,227,21,188,247,31,10,252,113,
+247,31,29,188,253,2,90,247,31,29,247,9,29,89,249,2,247,166,253,2,90,6,123,
+140,128,129,138,124,8,136,7,140,124,150,129,155,140,8,247,9,29,90,6,14,248,
+85,195,29,147,33,5,125,147,130,153,137,30,144,6,154,141,146,148,155,26,247,
+20,7,158,130,148,120,138,30,251,235,6,122,140,129,130,138,123,8,126,7,128,
+139,138,146,130,30,247,69,251,140,251,71,251,215,5,134,131,139,138,130,26,
+124,7,122,149,131,157,30,247,242,6,158,148,148,158,31,247,20,7,155,132,148,
+124,141,30,133,6,125,137,132,130,138,124,135,33,24,251,185,6,247,69,247,205,
+5,143,146,140,142,143,26,145,137,143,134,146,30,251,61,247,133,5,14,247,80,
+247,34,21,141,69,142,118,149,118,8,114,152,159,125,163,27,168,163,153,171,
+168,31,157,159,155,160,150,158,144,148,24,141,142,140,143,143,26,146,133,
+144,132,132,134,135,130,132,30,128,123,5,108,117,122,125,124,27,121,132,158,
+192,151,139,164,140,160,31,158,7,175,7,247,30,247,68,190,236,225,26,193,110,
+174,95,95,90,106,82,100,30,96,75,116,251,1,136,251,61,138,78,24,116,111,134,
+133,121,118,136,136,25,118,117,5,133,133,137,134,134,26,135,7,132,143,142,
+136,145,27,150,139,139,185,183,31,236,247,61,21,141,177,5,247,109,149,158,
+208,188,27,162,154,118,107,68,100,47,69,43,31,14,247,43,248,188,21,125,140,
+149,130,154,27,172,140,5,187,196,119,108,181,31,168,118,158,118,167,96,8,
+167,95,102,150,87,27,251,22,36,40,251,17,251,17,242,39,247,23,247,21,243,
+238,247,16,233,100,247,0,78,209,31,203,85,51,176,41,27,112,136,138,132,132,
+31,135,135,137,132,132,26,247,39,251,64,21,243,219,64,40,43,59,62,38,38,58,
+216,236,234,219,217,238,31,14,247,173,248,136,21,251,30,251,7,251,3,251,26,
+251,34,247,6,251,5,247,36,247,31,247,5,247,3,247,28,247,31,251,8,247,6,251,
+33,31,143,251,190,21,245,35,5,114,103,104,128,97,27,96,110,148,163,108,31,
+93,184,21,112,175,130,166,180,26,183,150,174,163,172,30,247,2,251,0,5,232,
+22,247,2,246,5,161,109,148,114,102,26,90,128,102,115,106,30,251,44,247,41,
+21,251,3,247,0,5,163,172,174,150,181,27,183,170,129,114,174,31,14,247,164,
+248,43,21,251,20,64,75,62,56,26,113,146,109,154,102,30,88,66,125,106,98,26,
+83,178,98,192,196,184,193,207,179,125,183,98,223,30,176,185,177,177,194,183,
+8,190,201,174,157,174,27,169,159,112,99,87,115,65,107,91,31,102,114,104,116,
+107,27,111,114,157,159,149,144,144,151,140,31,163,141,156,156,160,26,158,
+124,153,119,107,113,106,99,91,177,105,193,190,198,172,194,187,30,180,186,
+162,195,195,26,209,97,187,78,59,72,94,251,51,251,46,30,132,160,137,149,156,
+26,202,174,193,205,181,30,148,145,145,143,159,150,8,251,64,251,226,21,176,
+74,156,96,109,26,112,120,120,112,105,114,167,178,174,147,157,182,203,30,14,
+248,85,248,100,21,56,6,251,46,104,247,126,10,46,185,65,222,96,30,94,73,5,
+132,130,137,133,133,26,127,148,130,151,151,147,144,154,149,30,189,213,5,135,
+175,172,136,150,27,138,148,171,139,187,27,247,86,6,161,152,148,155,155,126,
+149,117,31,251,88,6,98,112,139,140,127,31,131,117,141,141,114,31,247,135,
+247,249,5,227,6,162,151,148,155,155,125,149,118,31,85,6,192,217,5,146,150,
+141,143,145,247,76,10,127,131,134,125,130,30,36,251,44,21,251,127,251,239,
+110,150,127,147,121,156,25,105,174,118,187,186,26,197,170,198,187,171,30,
+165,178,179,145,247,33,27,14,248,93,248,92,21,252,115,252,89,5,249,20,190,
+252,147,6,248,17,247,255,5,14,247,116,22,247,45,176,153,29,247,22,179,134,
+120,175,31,194,111,177,74,226,29,124,153,128,160,31,14,247,233,248,100,247,
+48,10,62,173,70,200,95,30,103,189,174,133,247,57,176,10,199,186,170,236,10,
+14,247,116,247,33,21,247,47,174,153,29,247,23,178,134,120,175,31,194,110,
+177,75,226,29,123,153,129,160,31,248,115,251,33,247,128,10,252,115,6,117,
+128,130,122,123,150,130,161,31,14,247,233,248,241,247,48,10,88,154,91,167,
+100,30,175,89,186,110,202,130,8,134,173,160,138,240,176,10,198,186,171,236,
+10,252,115,252,190,21,117,128,130,122,123,150,130,161,31,248,115,247,91,10,
+247,218,247,124,21,247,147,189,251,121,6,236,247,73,5,247,24,190,34,6,151,
+169,150,161,150,154,8,143,144,141,143,142,26,150,126,150,127,126,133,135,
+123,131,30,96,58,5,251,26,247,57,29,251,16,183,59,230,99,30,110,85,5,135,
+131,137,133,134,26,127,151,128,152,151,146,144,154,147,30,172,202,5,135,172,
+143,139,184,27,247,186,190,251,198,6,115,132,139,141,126,31,178,247,71,21,
+49,251,60,74,161,104,195,135,224,25,144,7,247,210,247,123,21,42,251,73,5,
+251,113,144,6,145,247,12,204,198,247,20,136,8,14,247,213,4,223,210,5,248,
+242,195,252,176,6,241,10,248,176,195,252,242,6,14,248,235,247,213,21,55,69,
+5,252,242,83,248,176,234,29,252,176,83,248,242,6,14,222,248,84,21,241,10,
+248,70,234,29,252,136,83,21,248,202,6,222,69,56,68,5,252,202,6,55,210,5,14,
+248,221,251,137,247,23,10,123,121,150,131,160,31,248,206,67,247,23,10,122,
+122,150,131,160,31,14,249,125,249,70,213,29,248,102,248,107,21,142,144,141,
+148,143,26,152,127,150,125,127,134,135,123,131,30,100,66,5,149,104,123,142,
+112,27,251,25,36,41,251,18,63,173,76,206,92,31,103,72,5,136,134,137,130,135,
+26,126,151,128,153,151,144,143,155,147,30,175,205,5,126,176,156,136,169,27,
+247,25,242,237,247,19,217,102,204,69,185,31,115,94,21,191,103,166,90,80,26,
+41,59,63,35,119,126,141,147,112,30,93,162,21,89,179,116,183,196,26,236,219,
+215,242,158,150,137,134,163,30,14,247,116,248,193,21,140,156,5,161,140,118,
+159,114,27,113,120,120,115,135,134,10,247,170,248,99,21,140,155,5,162,141,
+118,159,113,27,114,119,120,116,134,134,10,14,247,78,10,14,247,78,10,247,115,
+251,111,21,251,48,247,45,247,48,6,14,197,22,248,122,201,252,60,248,60,77,
+6,14,247,168,197,29,14,247,82,197,29,247,82,22,229,247,95,5,152,168,141,147,
+153,26,161,121,156,116,247,134,29,14,209,22,248,97,247,203,6,251,123,247,
+146,251,122,251,146,5,189,251,153,21,247,133,7,247,72,247,90,247,73,251,90,
+5,251,133,7,14,248,52,189,21,236,194,198,235,242,26,247,46,251,10,247,9,251,
+46,251,47,251,9,251,9,251,46,36,198,43,236,84,30,251,21,6,116,128,131,122,
+123,152,130,160,31,247,98,187,6,84,170,123,150,117,159,8,81,191,109,204,211,
+26,211,167,198,194,185,30,173,180,179,153,195,27,195,179,125,105,180,31,194,
+93,167,80,67,26,71,113,79,87,87,30,114,114,122,127,78,105,8,91,247,98,7,160,
+152,148,155,156,128,147,116,31,14,247,150,247,156,21,251,6,97,180,68,231,
+219,118,251,13,5,227,6,118,247,13,231,59,180,210,251,6,181,247,6,180,98,210,
+47,59,160,247,13,5,51,6,160,251,13,47,219,98,68,5,14,159,247,123,21,248,141,
+134,6,133,251,12,74,81,251,20,142,8,251,198,88,247,186,6,247,1,181,152,188,
+187,31,186,187,160,201,228,26,233,109,209,78,186,30,172,97,101,148,43,27,
+251,186,88,247,198,6,247,19,142,204,82,146,251,11,8,136,7,134,252,141,7,14,
+248,113,247,84,21,138,207,135,168,125,170,8,204,110,70,178,54,27,251,20,59,
+55,251,26,251,26,216,60,247,21,235,206,180,215,165,31,140,142,141,143,5,94,
+6,138,137,139,138,136,135,8,90,114,90,112,74,27,65,105,161,200,119,31,214,
+7,247,150,180,21,251,148,211,6,197,169,171,160,200,27,203,189,109,90,158,
+31,14,248,170,247,152,21,252,73,247,46,5,251,200,7,14,206,247,152,21,248,
+73,251,46,5,247,200,7,14,247,216,248,129,21,160,112,162,118,163,126,200,104,
+150,132,144,130,8,146,126,143,120,115,26,251,146,7,146,120,114,144,118,27,
+63,72,81,74,101,170,115,189,195,192,164,181,172,31,162,168,146,163,142,192,
+8,248,34,7,140,218,103,219,89,171,87,172,24,113,156,124,149,134,143,8,125,
+155,132,158,165,26,153,91,252,174,7,147,120,116,143,118,27,65,73,82,73,101,
+170,115,187,194,191,164,181,172,31,161,168,146,163,142,192,8,247,44,247,71,
+21,251,13,204,113,180,135,247,18,142,137,24,247,13,73,165,99,144,251,18,8,
+14,74,10,70,29,247,234,95,10,248,147,22,44,248,199,5,61,6,251,226,252,199,
+5,248,80,190,21,251,250,6,247,166,248,97,5,146,6,14,58,10,248,94,22,179,247,
+75,5,141,148,139,140,142,26,150,129,148,127,122,129,130,117,195,10,135,247,
+117,29,159,29,14,61,10,247,156,247,201,21,141,150,5,140,143,139,142,142,26,
+152,138,131,147,127,27,123,128,129,121,135,31,122,61,5,138,135,139,137,135,
+26,127,148,130,151,155,150,150,156,143,30,143,155,5,247,98,6,136,126,5,138,
+135,139,136,136,26,127,148,130,151,155,151,150,156,143,30,155,217,5,140,143,
+140,143,141,26,151,140,129,148,127,27,123,127,129,121,135,31,136,125,5,94,
+247,158,21,251,62,251,50,251,69,251,84,251,23,220,48,247,9,247,61,247,50,
+247,70,247,83,247,22,58,231,251,8,31,124,88,21,234,203,66,32,251,50,251,22,
+251,43,251,28,50,75,215,245,247,45,247,23,247,46,247,21,31,14,50,29,247,65,
+247,111,21,232,207,224,110,168,81,169,251,92,25,230,89,29,87,6,107,247,74,
+112,190,56,179,247,147,247,80,24,154,141,10,251,11,168,10,168,6,251,201,251,
+119,189,247,119,5,209,141,10,251,62,119,10,247,62,247,143,10,14,248,19,195,
+29,217,252,97,94,10,247,166,248,97,5,14,67,29,248,98,218,10,120,125,121,10,
+153,130,146,247,91,29,14,248,182,195,29,122,60,5,137,132,138,130,247,127,
+29,143,30,169,247,33,5,252,94,6,112,251,22,5,137,129,138,133,247,127,29,144,
+30,157,229,5,169,251,97,21,142,155,5,143,157,139,139,141,26,153,129,148,125,
+123,129,128,117,135,30,119,46,5,136,123,139,139,135,26,125,148,130,154,154,
+148,149,162,144,30,145,165,5,247,94,6,136,123,5,137,128,138,134,136,26,124,
+148,130,154,154,149,150,161,143,30,160,232,5,142,152,139,142,142,247,100,
+29,133,113,5,251,225,251,148,21,156,218,5,141,152,140,142,143,247,100,29,
+110,251,33,5,248,93,6,166,247,22,5,141,146,140,148,144,26,153,130,148,124,
+124,130,128,117,134,30,120,49,5,14,105,10,79,10,86,10,249,37,248,199,21,252,
+38,6,128,90,247,30,251,108,251,130,251,138,128,87,5,248,45,6,171,247,41,5,
+140,144,140,145,142,26,150,131,146,129,126,129,130,125,135,30,111,32,5,251,
+188,6,247,138,247,138,251,33,247,107,5,247,173,6,125,251,3,138,137,5,131,
+137,149,130,150,27,152,149,148,153,142,31,14,82,29,76,29,14,247,225,177,21,
+247,51,156,247,20,247,21,247,37,26,244,69,213,251,4,152,30,146,175,5,241,
+68,29,251,145,48,10,238,6,132,104,5,251,52,121,251,19,251,21,247,95,29,93,
+5,37,142,29,247,145,6,161,154,151,156,155,130,145,119,31,40,6,243,248,114,
+21,226,127,183,10,60,29,248,36,195,29,182,247,16,29,251,36,161,10,121,125,
+149,131,157,31,188,6,76,251,176,5,66,143,101,170,195,26,155,142,163,146,172,
+30,175,247,63,5,43,161,10,121,125,149,131,158,31,180,6,114,251,5,5,132,108,
+136,117,119,26,51,192,87,238,130,30,113,251,18,5,90,88,10,247,47,115,10,85,
+6,165,247,18,247,42,145,202,201,176,247,72,25,158,226,5,168,96,29,58,6,110,
+251,31,108,251,32,92,89,32,133,25,14,248,63,190,21,181,160,178,168,175,177,
+8,205,206,172,216,222,26,247,15,48,225,251,22,58,62,108,80,73,30,71,78,95,
+46,56,26,62,182,61,205,97,30,251,23,6,114,125,128,121,125,149,131,159,31,
+247,97,6,149,187,103,163,128,147,123,152,25,96,176,112,198,197,26,247,36,
+247,24,247,25,247,35,196,176,125,106,172,30,173,105,156,98,91,26,62,104,65,
+73,77,30,101,102,117,125,58,98,129,90,24,247,99,6,162,155,247,117,10,117,
+31,14,248,223,247,107,21,247,2,247,58,5,145,148,142,148,145,26,150,131,147,
+128,126,130,132,122,128,30,63,251,7,129,179,131,158,122,160,25,183,106,85,
+163,75,27,251,41,251,29,251,21,251,32,34,218,64,247,2,201,205,164,181,184,
+31,166,164,158,161,169,184,162,251,17,24,114,144,145,132,154,27,156,151,152,
+157,143,139,142,137,148,31,55,247,76,21,111,95,5,43,77,76,97,59,27,55,79,
+197,218,247,1,247,0,240,247,8,214,190,100,70,154,31,14,247,38,191,21,93,179,
+186,117,200,27,247,7,241,240,247,7,178,122,175,109,164,31,120,155,123,146,
+104,146,8,218,170,180,190,208,26,212,84,187,54,79,86,115,96,103,30,113,109,
+122,93,121,53,251,3,252,152,24,138,136,139,135,136,26,125,150,128,153,153,
+148,148,155,143,30,247,73,248,84,21,167,138,158,138,148,138,8,216,129,180,
+107,88,26,101,122,99,108,106,30,103,105,101,122,93,27,73,78,186,189,147,142,
+159,146,167,31,184,247,97,5,247,1,163,186,188,220,27,196,171,114,96,78,93,
+102,251,4,110,31,132,138,5,14,247,159,212,21,35,247,238,5,86,88,10,162,6,
+245,251,250,5,108,78,126,97,98,26,109,152,121,160,178,162,192,228,155,139,
+152,137,154,30,247,113,247,211,164,174,151,147,169,141,25,171,151,147,160,
+153,129,147,120,31,117,6,95,114,122,84,101,31,14,247,255,248,66,21,79,129,
+98,122,93,104,8,71,86,97,62,65,26,34,218,64,247,3,247,42,247,29,247,21,247,
+32,181,125,178,112,169,30,120,161,125,149,82,175,8,56,190,126,152,169,26,
+159,152,164,157,151,30,154,159,165,145,186,27,207,6,160,153,150,156,151,129,
+146,122,31,74,6,74,99,127,109,104,31,109,113,121,104,105,26,108,152,119,174,
+114,30,172,83,21,225,247,133,29,50,247,67,10,248,57,247,143,21,130,140,5,
+132,6,126,138,5,66,92,165,179,185,188,171,209,161,156,137,135,152,31,129,
+169,139,139,145,27,153,153,154,156,159,96,154,80,37,56,79,66,97,164,111,191,
+123,31,114,133,128,136,123,132,8,81,116,104,93,86,26,76,193,102,230,188,199,
+150,153,170,30,152,146,146,149,151,26,152,132,146,126,136,136,138,137,132,
+30,122,87,120,136,95,27,70,103,158,175,174,166,172,181,157,31,152,170,171,
+143,199,27,146,6,146,6,14,248,95,248,187,21,251,121,251,85,52,251,8,251,3,
+26,93,159,101,175,114,30,167,120,175,128,200,130,8,181,133,152,130,117,26,
+95,91,107,71,138,30,121,138,129,131,122,26,122,151,131,164,227,210,197,210,
+167,128,163,118,153,30,126,148,126,143,87,148,88,148,130,142,116,151,8,111,
+152,124,167,174,26,192,178,211,209,216,30,176,179,206,203,208,199,164,161,
+156,154,146,146,144,144,24,140,140,140,140,141,141,151,187,5,251,108,88,10,
+14,116,10,196,173,112,93,133,138,131,137,29,14,248,17,248,238,21,51,53,76,
+34,85,31,101,67,117,49,61,26,251,22,202,59,242,217,208,182,224,196,30,194,
+221,168,236,239,26,247,23,76,219,36,30,251,105,251,156,21,148,175,152,168,
+160,172,8,215,187,196,178,201,27,211,184,81,47,124,138,117,137,113,31,129,
+88,21,123,75,122,98,111,98,8,71,93,82,101,80,27,69,95,198,234,163,142,174,
+145,178,31,14,97,10,14,247,113,247,132,21,177,247,71,5,33,122,10,190,189,
+29,98,83,10,247,38,103,29,88,6,168,247,30,5,168,6,221,135,171,103,181,251,
+28,141,132,24,141,133,5,221,6,162,153,149,157,154,129,147,121,31,86,6,112,
+230,95,202,91,156,247,72,247,38,24,151,6,162,153,150,157,154,129,146,120,
+31,44,123,29,147,6,251,57,251,20,5,14,196,190,21,116,83,10,247,6,96,29,112,
+6,247,105,247,179,245,251,179,5,105,123,29,247,8,247,16,29,113,6,251,94,248,
+187,5,52,102,10,199,6,195,251,46,5,14,248,95,248,4,21,100,251,69,127,83,118,
+101,107,113,25,116,110,102,126,102,27,85,98,177,188,152,142,159,146,172,31,
+191,247,123,5,37,123,29,185,6,251,3,252,143,5,137,131,138,131,135,26,124,
+148,131,154,154,149,150,160,144,30,180,247,81,5,100,170,175,123,194,27,193,
+175,153,174,178,31,132,106,5,239,6,163,153,149,158,153,129,147,119,31,95,
+6,219,248,4,5,39,83,10,14,247,79,248,53,21,59,6,118,126,247,115,10,155,31,
+181,6,231,252,2,5,187,6,247,68,247,48,200,224,231,26,187,120,183,119,123,
+124,125,125,135,141,131,141,131,30,145,120,143,119,125,26,70,87,60,251,4,
+36,30,135,136,136,136,135,135,134,135,135,136,135,135,8,14,248,60,247,177,
+21,146,6,151,190,129,140,5,131,6,45,144,89,169,192,26,207,223,194,246,141,
+30,171,140,139,139,145,141,8,150,144,147,150,150,26,153,129,147,120,30,251,
+92,6,115,247,68,10,153,6,89,107,113,97,87,26,91,157,108,183,112,30,40,103,
+78,64,56,26,56,192,91,245,126,30,213,131,153,133,114,26,121,128,120,121,126,
+30,124,127,114,133,104,137,8,108,137,130,133,120,26,120,150,131,164,231,207,
+191,210,167,128,163,118,154,30,122,151,119,145,91,145,100,144,131,140,123,
+144,8,93,154,118,165,179,26,187,170,185,192,171,30,177,161,190,151,201,140,
+8,14,247,241,247,165,10,248,173,248,4,21,180,6,161,154,151,156,154,130,146,
+119,31,252,31,6,117,124,128,122,123,216,10,177,179,10,208,247,209,5,247,104,
+179,10,14,247,9,214,21,77,180,190,110,209,27,247,32,247,17,247,18,247,33,
+247,1,67,212,251,0,65,60,105,86,87,31,108,107,116,88,121,57,68,251,210,24,
+137,130,138,132,134,26,124,148,130,155,154,148,149,162,144,30,247,185,248,
+167,21,221,189,90,60,251,5,36,33,251,0,59,81,198,219,247,3,240,236,247,8,
+31,14,249,15,248,18,21,159,153,151,157,153,130,146,123,31,251,108,6,43,86,
+123,90,76,31,70,85,98,63,65,26,34,218,64,247,4,247,40,247,30,247,21,247,31,
+192,120,181,99,174,30,251,32,22,226,247,133,29,49,247,67,10,248,30,248,4,
+21,247,18,6,162,153,151,158,153,131,145,119,31,251,197,6,117,124,127,121,
+126,149,131,157,31,247,19,6,72,251,202,5,136,128,138,129,130,26,111,165,124,
+189,201,183,158,165,151,132,147,128,136,136,138,138,137,30,127,110,128,137,
+117,27,113,127,145,151,145,140,144,140,146,31,14,248,99,248,4,21,107,251,
+39,123,65,123,100,113,85,29,14,247,70,251,30,21,137,127,138,134,135,26,125,
+149,130,155,155,146,147,164,144,30,168,247,26,5,138,150,141,139,143,27,211,
+203,166,195,196,31,196,194,168,204,212,26,240,79,211,55,58,97,86,251,27,110,
+30,97,251,93,5,64,159,106,182,217,26,221,189,218,214,176,30,158,148,145,146,
+151,26,152,130,148,125,109,96,111,95,100,30,93,86,118,84,71,26,38,193,70,
+235,116,30,201,183,21,182,247,99,5,241,161,166,176,190,27,192,177,89,69,77,
+116,89,91,92,31,95,93,88,115,86,27,136,6,14,247,197,247,87,21,62,247,116,
+5,71,88,10,179,6,214,251,115,251,98,251,166,5,129,126,136,131,130,26,125,
+148,130,152,150,148,144,150,147,30,247,81,247,144,230,251,160,5,212,115,10,
+94,6,49,247,160,247,72,247,136,5,148,150,143,149,148,26,152,130,148,126,128,
+130,134,128,131,30,14,248,41,248,195,21,140,145,141,151,142,26,152,128,148,
+124,122,134,132,113,133,30,251,7,252,169,5,77,143,112,159,180,26,152,143,
+162,145,171,30,193,247,142,5,39,6,116,125,247,109,29,182,6,97,251,89,5,133,
+111,136,113,122,26,74,187,97,221,131,30,113,251,15,5,137,131,138,132,134,
+26,124,148,130,154,154,149,149,162,144,30,167,247,26,247,23,148,185,181,164,
+247,25,25,182,247,91,5,184,6,163,153,149,158,153,129,147,120,31,42,6,86,251,
+141,121,44,107,109,52,130,25,14,61,29,14,248,158,248,19,21,173,102,91,155,
+75,27,251,51,251,18,251,14,251,44,80,161,92,178,111,31,164,122,177,127,200,
+130,8,203,130,151,133,116,26,96,98,106,81,137,30,108,137,126,131,121,26,122,
+150,131,164,228,209,197,212,190,109,164,64,150,30,81,148,106,147,124,147,
+8,107,156,121,173,185,26,247,17,242,238,247,22,183,184,126,121,159,30,149,
+129,145,125,140,119,8,102,142,145,128,158,27,156,149,151,165,142,31,143,174,
+146,170,148,159,8,143,149,140,144,145,26,152,129,149,125,124,129,130,121,
+134,30,14,248,105,247,254,21,196,148,147,141,191,168,131,185,24,91,115,131,
+136,98,128,8,164,247,3,143,164,186,26,226,75,195,38,251,1,53,56,32,83,160,
+106,206,93,30,193,101,180,127,224,136,106,251,41,24,126,80,115,95,105,111,
+8,109,103,87,120,93,27,86,110,162,179,145,140,149,141,148,31,205,247,194,
+5,37,80,29,187,6,85,251,141,5,136,128,138,128,128,26,109,152,111,161,119,
+30,122,158,166,132,186,27,215,188,155,179,183,31,186,180,171,197,154,209,
+8,132,247,90,21,52,145,90,156,91,184,8,109,166,127,164,172,26,210,198,195,
+214,169,167,131,124,162,30,165,121,150,114,97,26,97,133,102,119,46,30,14,
+247,225,177,21,247,51,156,247,20,247,22,247,37,26,244,69,212,251,4,153,30,
+147,175,140,150,5,151,131,146,124,123,129,130,120,135,30,131,101,5,251,51,
+122,251,20,251,22,247,95,29,92,5,138,136,139,136,135,26,126,140,146,133,153,
+27,155,149,148,157,143,31,244,248,118,21,226,126,183,10,249,23,248,25,21,
+160,153,151,157,153,130,146,121,31,252,20,6,66,97,120,79,81,31,134,134,136,
+133,132,26,133,143,135,144,142,140,140,142,145,30,201,184,148,143,175,142,
+103,106,121,120,122,110,8,105,83,118,63,75,26,64,183,87,202,184,181,162,179,
+169,30,99,153,171,116,184,27,181,185,164,181,175,31,178,185,168,227,215,26,
+193,128,175,109,176,30,49,22,166,122,5,174,116,155,103,86,26,251,15,80,38,
+67,104,123,161,187,169,142,170,146,167,30,145,171,247,116,29,142,26,153,132,
+147,124,123,128,128,119,135,30,132,107,5,32,116,100,84,88,27,100,113,172,
+189,208,167,219,181,192,31,156,161,167,160,167,152,151,144,142,140,150,145,
+8,14,247,228,248,24,21,143,157,139,140,142,26,153,247,43,10,126,137,124,128,
+26,96,169,113,187,159,177,10,145,141,150,142,156,31,120,248,116,148,29,48,
+29,251,35,247,114,21,247,105,29,168,159,202,29,248,110,248,223,247,74,29,
+131,147,126,192,10,248,109,248,223,92,29,247,46,248,152,21,148,151,141,145,
+146,26,151,130,148,127,129,129,133,126,131,30,46,251,27,5,132,129,136,131,
+132,26,126,147,130,152,149,148,145,152,148,30,248,19,251,88,21,161,251,25,
+94,10,219,247,25,5,247,140,190,21,251,110,6,247,56,247,169,5,146,6,14,247,
+42,94,29,247,82,251,6,21,247,25,6,130,101,138,126,5,127,147,131,152,156,150,
+150,159,143,30,167,247,21,5,141,145,139,142,143,26,152,131,146,125,192,29,
+247,108,29,159,143,30,170,247,35,5,252,67,247,124,29,185,146,10,90,88,10,
+248,86,6,174,247,53,140,153,5,151,131,146,126,122,128,128,119,135,30,114,
+251,4,5,251,190,6,14,247,33,94,29,248,53,251,6,21,247,8,29,129,120,125,149,
+131,158,215,10,100,6,247,119,29,160,103,29,251,12,161,10,121,125,149,131,
+158,31,186,6,97,251,87,5,251,148,247,20,29,188,142,10,251,12,247,124,29,157,
+146,10,98,6,115,126,129,120,125,149,131,157,215,10,92,6,186,247,107,5,14,
+247,67,94,29,247,231,247,24,21,247,26,103,29,251,209,247,124,29,247,23,146,
+10,251,26,88,10,247,209,103,29,251,23,6,14,248,42,248,211,21,251,58,251,49,
+251,71,251,81,251,25,218,49,247,8,223,215,177,215,205,31,204,215,173,226,
+229,26,201,122,193,106,180,30,185,102,93,160,75,27,131,88,21,229,201,65,32,
+251,47,251,21,251,45,251,23,46,78,211,247,2,215,167,211,193,202,31,203,194,
+199,171,204,27,251,123,131,152,29,205,190,21,144,160,140,151,5,153,130,148,
+124,124,129,128,118,134,30,124,64,5,247,115,6,166,247,15,116,143,128,142,
+125,144,25,80,160,108,186,207,26,197,167,208,181,183,30,191,187,213,169,214,
+27,247,7,210,74,34,251,5,55,51,251,23,114,31,132,138,111,251,19,5,247,120,
+6,154,205,5,140,144,140,148,143,26,153,130,148,124,124,129,128,118,135,30,
+133,115,5,251,13,6,146,173,202,158,177,158,176,172,25,197,192,173,214,218,
+26,247,18,42,225,251,34,49,63,108,78,78,30,80,80,107,64,61,26,78,160,85,176,
+107,30,158,123,156,130,174,126,131,104,24,96,248,101,152,29,247,42,94,29,
+247,238,251,20,21,247,121,247,152,5,160,247,17,10,251,2,102,10,167,6,251,
+74,251,99,44,247,99,5,169,96,29,251,3,6,116,125,247,109,29,159,6,247,10,251,
+150,95,251,95,5,39,123,29,247,143,103,29,41,6,14,110,29,155,249,44,21,111,
+113,114,112,117,155,124,160,169,164,164,167,160,124,154,116,31,247,99,22,
+111,113,114,111,118,155,124,160,168,164,164,167,160,247,139,29,247,228,247,
+144,21,247,121,247,152,5,161,6,161,247,7,10,251,2,6,116,124,127,121,125,216,
+10,166,6,251,74,251,99,44,247,99,5,170,89,29,251,3,6,116,124,127,122,124,
+216,10,160,6,247,10,251,150,95,251,95,5,38,204,29,247,142,89,29,41,6,133,
+249,44,21,111,113,114,112,117,155,124,160,168,164,164,167,160,247,94,29,117,
+155,124,160,169,164,164,167,160,123,154,117,31,14,248,98,190,21,247,18,7,
+199,215,207,247,16,172,26,152,129,149,126,125,130,131,120,131,30,121,92,110,
+85,106,90,8,247,7,118,78,201,47,27,251,16,251,3,251,22,251,37,35,202,69,232,
+209,186,167,236,229,31,251,1,226,7,247,39,29,43,247,33,21,103,92,127,125,
+117,117,8,87,86,97,117,96,27,78,97,189,212,247,9,227,246,235,219,177,82,251,
+25,148,31,173,248,31,21,152,149,145,148,150,26,150,130,148,187,10,247,234,
+247,85,21,147,140,150,189,5,39,143,100,158,182,26,181,188,169,206,179,172,
+129,121,159,30,147,132,144,126,121,26,113,146,130,157,155,148,149,158,141,
+30,141,164,145,161,150,170,8,143,148,140,145,146,26,152,129,149,125,124,131,
+132,119,132,30,138,135,138,138,137,132,8,166,102,100,151,89,27,43,69,86,67,
+101,152,117,174,118,31,67,116,97,91,79,26,68,202,98,247,0,226,209,166,172,
+151,129,149,128,133,134,137,133,124,30,122,98,107,133,97,27,68,96,162,178,
+195,216,179,245,31,247,20,248,30,247,74,29,130,147,127,129,10,148,131,151,
+247,92,29,116,10,197,172,112,92,133,138,132,137,29,247,146,247,111,247,6,
+10,130,147,127,247,158,10,97,10,247,73,248,134,247,6,10,130,147,127,129,10,
+148,131,151,247,92,29,247,242,248,69,21,251,42,251,28,251,21,251,33,35,217,
+64,246,247,44,247,27,247,20,247,37,240,60,214,32,31,128,88,21,223,199,83,
+61,251,3,33,37,251,8,54,80,195,220,247,0,247,0,241,247,6,31,247,26,247,97,
+21,153,149,145,148,150,26,151,130,147,127,131,239,10,147,146,142,146,149,
+30,14,61,29,247,30,248,18,21,151,148,146,150,149,26,151,130,147,187,10,48,
+29,192,247,111,247,6,10,131,147,126,247,158,10,247,227,185,29,97,169,112,
+187,159,230,29,129,115,121,134,122,27,123,131,145,153,146,140,146,143,159,
+31,247,86,248,134,92,29,48,29,196,247,90,247,74,29,130,147,127,247,72,29,
+43,5,126,129,133,130,128,26,127,147,131,152,146,147,142,146,149,229,10,247,
+152,22,110,113,114,111,117,153,126,162,168,165,164,166,160,247,139,29,74,
+10,248,198,248,199,21,252,49,117,10,251,20,247,20,29,247,151,6,130,101,247,
+14,10,153,155,150,150,159,144,30,252,38,252,57,163,29,70,29,247,190,95,10,
+248,93,22,119,46,5,138,133,138,134,134,26,122,147,130,154,154,148,149,161,
+144,30,163,247,2,5,141,152,140,142,143,26,154,125,148,113,30,109,6,247,119,
+29,180,204,10,252,27,140,29,189,6,88,251,126,113,251,24,75,59,49,125,25,119,
+137,134,134,133,113,115,251,5,24,137,129,138,134,135,26,126,148,130,154,153,
+149,149,159,143,30,162,244,5,247,159,195,29,247,85,146,10,251,156,6,201,187,
+172,200,164,247,7,8,14,58,10,248,27,195,29,50,10,170,57,10,117,6,107,10,8,
+14,247,32,248,96,21,79,29,96,247,13,91,247,2,233,202,158,180,189,31,182,176,
+164,188,189,137,10,14,76,10,14,53,10,14,248,187,195,29,174,123,10,252,15,
+140,10,183,6,71,251,208,5,34,116,95,82,81,27,131,133,140,143,122,31,151,191,
+140,150,5,154,128,151,125,125,130,129,118,134,30,126,79,5,137,131,138,130,
+135,26,120,171,125,185,181,178,154,167,169,30,173,172,163,191,156,221,209,
+247,210,24,247,84,247,116,10,104,57,29,247,17,104,29,102,6,14,67,29,61,10,
+105,10,79,10,86,10,248,176,118,29,137,130,130,30,75,67,90,116,70,220,10,185,
+185,124,115,247,50,29,148,155,247,84,10,141,142,26,150,129,147,127,122,129,
+129,119,134,30,14,82,29,65,10,14,248,28,195,29,173,6,152,6,159,138,153,150,
+157,26,155,127,146,113,30,251,3,6,123,140,5,136,6,120,142,121,125,121,26,
+121,149,134,171,30,169,6,132,107,67,137,96,128,95,111,25,67,94,95,62,61,26,
+41,205,84,247,15,136,30,132,107,5,104,6,108,121,129,120,124,152,132,166,31,
+247,11,6,169,156,150,159,153,127,145,113,31,107,6,146,171,211,141,182,150,
+183,167,25,210,184,183,216,217,26,237,72,195,251,13,141,30,251,19,251,237,
+21,37,146,94,174,210,26,187,162,186,178,172,30,177,171,183,154,205,144,8,
+192,22,241,131,183,105,66,26,85,106,81,90,108,30,108,120,95,127,86,135,8,
+14,60,29,248,172,190,21,251,2,90,29,248,86,6,118,51,5,138,136,138,133,135,
+26,126,147,132,152,155,150,149,160,144,30,14,248,19,190,21,32,88,29,247,91,
+57,10,100,6,78,10,14,177,190,21,98,83,10,248,177,142,10,93,75,10,14,248,219,
+190,21,49,75,10,247,139,10,98,83,10,248,165,6,118,51,5,138,135,138,133,247,
+110,10,149,149,160,144,30,14,247,136,195,29,195,115,10,251,52,117,10,251,
+16,6,77,251,158,163,29,247,89,195,29,184,115,10,251,41,88,10,186,146,10,89,
+83,10,247,107,247,110,29,175,172,158,247,35,10,96,6,77,251,158,21,186,247,
+107,5,192,6,247,6,188,112,74,67,76,88,49,31,248,21,248,97,21,178,96,29,251,
+19,102,10,175,146,10,98,205,29,157,31,247,33,103,29,92,6,14,247,14,195,29,
+247,30,146,10,89,122,10,247,120,6,247,15,227,213,242,175,129,169,118,161,
+31,171,110,69,159,58,27,84,247,20,29,217,6,162,153,149,157,154,129,147,121,
+31,251,213,6,106,251,31,5,138,133,138,135,135,26,127,147,131,152,155,151,
+150,159,144,30,247,2,252,6,21,187,247,107,5,205,6,247,6,187,112,75,66,75,
+88,50,31,14,248,127,247,150,21,251,33,101,41,56,251,19,27,86,113,149,186,
+70,31,145,130,132,142,134,27,126,125,125,127,121,161,119,181,119,31,116,186,
+177,130,188,27,241,218,176,217,200,31,196,210,171,230,229,26,247,29,60,226,
+251,17,73,90,121,96,88,30,142,152,140,145,145,26,154,131,147,123,121,134,
+131,90,126,30,118,61,5,135,124,136,124,133,26,126,149,130,153,152,148,148,
+158,148,30,148,157,141,145,145,149,8,200,172,198,171,215,27,238,199,77,35,
+124,138,123,137,121,31,251,162,6,112,125,130,121,124,151,130,160,31,14,247,
+85,247,158,21,136,114,138,124,119,26,251,26,203,51,237,211,200,179,219,189,
+30,186,216,164,227,230,26,247,26,79,221,40,251,1,45,39,251,51,98,30,89,247,
+20,29,189,247,17,10,251,11,122,10,157,180,29,186,247,107,5,247,193,247,151,
+21,211,178,79,251,4,45,108,45,85,73,31,95,104,104,119,98,27,68,93,210,247,
+2,213,160,212,179,203,31,206,181,184,170,193,27,14,248,167,195,29,179,123,
+10,251,92,6,60,90,126,110,103,31,100,108,115,90,90,26,75,178,98,213,123,30,
+103,117,65,47,73,33,8,89,57,29,187,6,156,149,141,142,142,31,141,141,151,156,
+151,156,247,3,247,57,202,201,193,134,8,201,6,96,251,104,5,92,57,29,247,33,
+57,10,98,6,183,248,98,21,96,251,91,5,43,6,42,92,166,194,173,156,172,168,162,
+31,158,165,172,147,198,27,14,247,190,195,29,247,207,6,183,247,94,140,151,
+5,247,130,10,106,251,45,5,252,43,138,10,247,139,247,96,21,197,224,195,163,
+192,27,183,167,110,93,92,119,87,107,105,31,116,114,116,127,101,135,8,116,
+137,129,131,122,26,122,150,130,160,239,230,244,247,9,220,91,190,65,84,82,
+118,92,66,30,191,247,134,5,247,18,6,126,42,5,137,123,139,139,138,26,123,148,
+130,155,155,148,151,163,142,30,153,247,4,5,140,148,140,145,141,26,155,125,
+148,114,30,251,217,6,106,138,139,247,97,29,134,26,126,148,130,153,190,10,
+247,28,123,10,101,6,14,247,28,247,209,21,247,17,174,234,221,247,3,27,214,
+205,95,89,135,139,137,138,133,31,138,7,138,133,139,139,137,26,126,147,131,
+153,155,150,150,160,143,30,163,247,1,5,141,145,139,142,143,26,152,131,146,
+125,123,128,128,119,134,30,136,122,5,180,99,89,159,75,27,251,27,251,24,251,
+2,251,29,108,31,121,55,5,135,123,138,131,124,26,80,153,93,166,104,30,88,181,
+202,109,206,27,193,181,152,177,205,31,188,167,170,171,160,26,149,130,147,
+127,130,132,136,130,130,30,84,82,69,107,76,27,47,65,212,231,155,141,157,145,
+171,31,247,175,6,166,153,148,157,155,128,147,117,31,14,248,145,248,160,21,
+173,108,95,156,83,27,251,13,34,53,41,107,152,109,161,121,31,165,118,172,127,
+209,126,208,127,158,134,159,125,8,155,127,150,117,119,26,59,55,74,36,99,97,
+151,155,138,29,5,98,171,193,117,204,27,247,30,247,5,247,39,10,247,65,10,207,
+215,198,228,175,175,128,123,156,30,148,131,159,109,247,163,29,50,29,50,29,
+50,29,248,167,195,29,231,6,162,153,101,10,187,115,203,27,244,244,222,238,
+160,31,14,248,89,195,29,187,57,10,251,189,88,29,188,6,72,251,208,5,32,116,
+96,85,78,27,129,131,140,141,128,31,151,192,5,140,143,139,142,143,26,156,130,
+149,124,124,130,129,119,134,30,126,78,5,137,130,138,131,135,26,119,166,126,
+181,246,195,200,247,41,171,30,209,247,210,5,229,247,116,10,100,57,29,222,
+6,226,195,158,182,178,31,170,174,157,187,186,26,185,118,178,103,158,30,110,
+155,116,144,88,141,8,124,86,21,224,138,172,117,84,26,93,114,92,102,117,30,
+117,126,109,132,92,137,8,14,247,179,247,158,21,93,251,107,5,107,102,10,247,
+53,247,110,29,174,172,159,184,186,26,230,70,186,251,28,30,122,6,182,247,87,
+5,201,115,10,251,40,6,114,126,247,108,10,173,6,96,251,87,5,251,41,247,20,
+29,169,96,29,251,1,122,10,166,146,10,98,83,10,247,23,96,29,100,6,186,247,
+107,5,247,47,251,107,21,185,247,107,5,162,6,244,191,109,77,67,76,88,50,31,
+14,247,204,195,29,247,19,6,125,42,138,123,5,123,148,129,154,155,148,150,163,
+142,30,156,247,5,5,141,154,139,139,141,26,155,125,148,113,30,251,219,6,107,
+138,138,247,97,29,135,26,125,149,130,152,190,10,247,31,57,10,98,6,173,247,
+44,5,198,210,185,162,186,27,179,160,117,98,124,137,120,136,125,31,113,251,
+15,5,93,57,29,247,13,57,10,117,6,165,247,11,5,143,159,141,155,154,26,208,
+94,186,72,90,91,120,96,83,30,14,247,183,22,247,104,247,17,10,73,90,29,247,
+89,247,45,10,156,150,150,159,144,30,14,248,60,248,211,21,251,61,251,50,251,
+70,251,82,251,25,220,49,247,11,247,57,247,52,247,71,247,77,247,28,60,230,
+251,11,31,247,23,251,214,21,123,94,127,115,116,107,8,65,85,65,96,65,27,54,
+72,215,235,153,140,154,140,156,31,150,189,21,247,25,183,240,227,247,0,27,
+225,206,63,42,127,138,121,137,121,31,14,248,137,190,21,107,10,178,247,76,
+24,50,10,154,6,117,51,5,137,131,139,137,247,58,29,247,33,5,14,39,29,14,243,
+247,175,21,133,92,137,121,116,26,78,164,79,181,99,30,106,174,183,122,192,
+27,247,60,247,50,247,70,247,81,247,26,58,229,251,11,57,51,94,68,82,31,187,
+120,5,188,179,211,174,199,27,230,202,63,251,0,122,138,126,134,111,31,124,
+89,21,112,78,120,110,102,104,8,92,90,82,114,83,27,53,72,215,235,145,139,148,
+140,149,31,14,247,203,195,29,246,204,10,251,91,140,10,178,146,10,102,140,
+10,247,24,123,10,98,6,181,247,84,5,198,224,198,163,199,27,183,161,120,100,
+126,138,128,135,121,31,101,251,67,5,93,140,29,247,30,123,10,100,6,176,247,
+61,5,144,163,141,153,153,26,202,93,181,70,79,78,119,93,65,30,14,247,42,195,
+29,247,139,10,114,57,29,247,7,57,10,99,6,228,248,47,216,252,50,5,102,146,
+148,128,161,27,163,147,149,177,147,31,240,248,100,5,163,204,10,251,6,88,29,
+179,6,51,252,40,61,248,57,132,171,137,140,106,140,25,88,57,29,248,118,57,
+21,140,145,140,143,143,26,172,113,164,105,113,110,120,116,128,30,131,123,
+111,251,18,121,26,110,166,117,172,179,165,164,186,150,30,89,142,21,123,136,
+132,132,126,27,130,135,142,146,142,139,141,140,144,31,163,247,1,5,153,142,
+146,145,152,27,148,142,136,130,31,134,7,81,251,185,21,165,152,148,157,161,
+129,143,87,97,127,133,119,121,153,130,165,31,14,247,120,247,158,21,247,15,
+6,150,190,5,251,15,134,29,97,251,87,5,78,6,128,88,5,200,6,92,251,107,188,
+10,248,8,247,102,21,149,181,101,29,129,95,5,36,169,10,240,6,115,251,1,5,38,
+48,10,247,144,141,29,41,6,163,247,1,5,247,0,247,17,29,14,247,79,247,158,21,
+247,25,6,131,101,5,138,136,138,131,137,247,117,29,155,150,150,159,143,30,
+167,247,21,5,140,144,140,144,142,26,150,130,148,126,192,29,128,148,130,152,
+156,149,149,160,143,30,171,247,35,5,252,68,6,117,124,127,121,125,216,10,186,
+146,10,89,204,29,248,86,6,174,247,53,5,140,142,139,144,144,26,150,130,148,
+126,124,127,128,119,135,30,115,251,4,5,251,191,6,247,58,249,45,21,247,147,
+10,202,29,248,201,195,29,185,247,71,29,119,91,29,154,129,146,120,31,88,6,
+251,57,249,93,21,118,127,123,112,78,190,100,216,190,186,156,169,173,31,163,
+161,158,172,159,247,76,10,124,129,131,121,133,30,100,126,92,112,85,27,92,
+103,163,171,142,139,141,140,141,31,141,7,140,7,145,7,150,130,148,129,30,14,
+247,130,195,29,40,252,97,5,38,83,10,247,142,96,29,41,6,247,119,29,247,166,
+6,111,251,22,5,138,135,138,133,135,26,126,147,132,153,155,150,150,159,143,
+30,179,247,76,5,252,113,83,10,247,234,247,109,21,152,148,145,149,149,26,152,
+131,147,126,132,133,136,132,128,30,251,27,42,5,126,130,133,130,128,26,127,
+148,131,151,147,146,142,146,149,30,14,110,29,153,249,45,21,247,148,29,124,
+154,117,31,247,98,22,247,148,29,247,139,29,53,10,49,247,109,21,152,148,145,
+149,149,26,152,130,147,127,247,72,29,42,5,126,131,247,28,29,65,10,113,248,
+185,21,119,127,123,112,78,190,100,216,190,187,156,169,172,31,163,162,158,
+171,159,247,76,10,124,129,131,121,133,30,100,125,93,112,85,27,91,104,163,
+172,31,145,7,140,141,139,144,142,26,149,130,148,128,30,14,32,10,41,247,152,
+68,10,32,29,247,10,249,101,68,10,247,166,247,166,21,186,130,160,114,163,65,
+247,103,29,205,57,10,80,6,247,166,29,70,56,122,122,114,128,155,212,24,141,
+146,139,141,142,26,152,128,151,126,125,130,131,120,135,30,120,51,124,138,
+179,247,77,5,183,123,10,251,36,57,29,185,247,116,10,94,57,29,247,36,104,29,
+93,6,188,247,117,5,154,6,119,48,138,125,5,247,120,29,14,248,92,190,21,72,
+29,129,102,24,63,10,189,6,118,51,5,138,134,138,134,247,110,10,149,149,159,
+144,247,137,10,248,86,190,21,78,29,247,151,6,92,251,107,5,89,142,29,247,14,
+6,117,247,132,29,131,153,206,29,174,247,33,5,14,248,120,190,21,251,27,247,
+128,66,10,247,6,6,117,51,5,137,132,139,136,247,4,10,247,179,247,84,21,199,
+157,176,154,181,166,96,251,93,24,32,88,29,247,91,57,10,100,6,247,119,29,176,
+123,10,251,24,140,10,180,6,97,251,84,78,97,106,122,92,125,25,157,219,140,
+151,5,152,128,151,126,125,131,131,121,135,30,117,38,5,130,6,94,117,158,178,
+151,141,152,139,29,73,181,102,216,137,30,122,59,5,138,135,138,132,247,55,
+10,72,10,32,88,29,247,74,6,117,51,5,137,129,139,139,247,4,10,32,29,247,38,
+249,102,21,147,132,247,47,29,231,41,5,130,146,143,137,149,27,154,154,154,
+155,143,136,144,131,147,31,14,76,10,251,90,249,102,21,147,131,135,142,131,
+27,123,124,124,123,134,142,134,247,92,10,130,146,143,137,148,27,154,148,147,
+157,144,31,140,144,140,142,135,146,132,146,25,14,247,123,248,87,21,152,200,
+5,195,115,10,251,52,88,10,186,6,126,78,5,80,169,10,195,6,63,251,242,150,10,
+251,16,6,157,223,5,247,16,6,161,154,150,157,247,20,10,251,104,252,36,163,
+29,167,29,247,24,251,212,21,123,91,127,116,116,107,8,66,85,64,95,66,27,53,
+73,215,239,149,140,156,140,156,31,149,194,169,142,171,27,169,150,136,122,
+166,31,125,163,158,134,169,27,171,189,147,154,193,31,252,23,177,21,155,192,
+152,166,166,176,8,213,192,214,182,212,27,228,203,63,33,122,138,128,135,115,
+31,128,80,133,138,113,247,61,10,105,112,134,116,47,31,14,247,200,195,21,59,
+248,92,5,208,247,9,10,125,170,29,166,6,228,252,148,5,202,6,247,162,248,51,
+166,184,141,143,152,149,25,148,149,150,143,150,225,29,109,129,117,110,31,
+112,119,135,134,102,81,8,14,247,162,124,21,203,141,191,151,174,158,8,204,
+175,180,202,202,137,10,122,54,5,79,29,101,242,93,237,133,31,125,75,247,163,
+10,104,142,31,14,247,14,195,29,238,119,29,205,57,10,80,6,247,167,10,251,129,
+6,106,251,31,5,138,134,138,133,136,26,127,147,131,152,155,151,150,159,143,
+30,14,247,212,123,21,203,206,164,185,199,31,177,168,153,154,154,247,111,10,
+136,131,55,10,136,121,5,120,29,37,208,53,237,119,30,124,71,247,163,10,105,
+142,31,14,72,10,251,33,6,113,251,34,5,138,136,139,135,136,26,125,145,133,
+153,157,150,150,161,143,30,155,227,5,247,95,6,157,151,149,155,154,128,149,
+121,31,14,248,5,22,241,141,29,92,6,247,113,10,148,145,26,201,81,181,54,101,
+46,121,124,101,30,125,133,131,129,127,26,127,148,130,150,144,141,139,144,
+155,30,160,215,165,144,173,27,202,178,116,101,235,29,40,73,191,99,224,208,
+197,160,192,212,31,153,199,21,78,57,85,117,68,27,81,106,162,180,204,223,188,
+247,3,183,180,134,130,174,31,14,248,49,248,123,21,192,172,147,158,165,31,
+160,155,151,160,158,26,155,129,149,123,124,130,132,122,133,30,134,118,110,
+127,86,138,8,47,6,57,70,108,86,106,31,98,73,98,251,41,55,26,40,221,70,247,
+12,223,206,165,193,196,30,193,191,168,203,209,26,247,2,61,209,251,15,61,74,
+114,87,83,30,173,236,182,171,235,141,8,159,34,21,232,197,88,58,85,116,88,
+97,96,31,94,93,87,118,71,27,46,81,189,220,247,11,242,235,247,20,31,14,227,
+190,21,89,83,10,247,176,6,214,190,150,160,167,31,164,158,154,170,173,26,192,
+110,169,71,157,30,204,160,167,169,189,26,204,85,175,40,30,251,132,88,10,192,
+6,165,251,18,21,165,247,18,5,247,33,6,208,173,120,101,94,88,115,40,31,251,
+54,251,83,21,170,247,32,5,247,20,6,243,192,114,90,92,98,120,41,31,14,97,29,
+14,248,88,22,124,81,138,125,5,122,148,129,155,153,148,149,160,144,30,156,
+214,5,140,146,140,146,144,26,155,126,148,113,30,106,6,208,247,209,5,173,104,
+29,252,8,57,29,185,6,104,251,52,122,49,85,86,54,126,25,119,137,134,135,133,
+112,123,62,24,136,126,139,137,136,26,126,149,130,155,154,148,148,158,143,
+30,155,209,5,247,116,248,4,21,247,78,6,71,251,209,5,251,135,6,140,140,180,
+164,169,190,156,215,25,14,248,159,247,113,29,155,26,239,211,29,131,148,126,
+133,135,138,132,129,30,108,91,65,118,76,27,45,225,10,228,205,82,66,134,31,
+14,247,251,248,4,21,52,10,165,104,29,119,6,105,29,8,14,247,71,248,28,21,69,
+29,123,149,128,159,131,31,116,194,205,127,206,27,226,198,152,168,184,31,180,
+166,161,175,179,220,29,14,47,29,14,51,29,248,141,248,4,21,174,104,29,252,
+8,57,29,185,6,91,251,113,5,65,123,101,103,78,27,130,133,140,140,129,31,144,
+170,5,140,142,139,143,142,26,157,130,149,123,124,130,129,119,136,30,132,102,
+5,137,127,138,133,134,26,120,164,127,180,240,196,189,247,0,163,30,187,247,
+115,5,247,79,189,29,105,88,29,247,12,6,164,153,148,155,156,126,148,113,31,
+106,6,14,247,196,179,21,247,101,247,210,73,251,199,5,69,247,15,10,247,40,
+116,29,112,6,207,247,209,5,159,142,10,32,6,251,105,251,217,61,247,217,5,36,
+123,29,157,6,71,251,209,5,110,247,15,10,247,41,6,162,153,150,157,154,129,
+146,120,31,72,6,205,247,202,219,251,213,5,14,248,63,247,83,21,108,251,32,
+5,99,6,115,126,129,121,124,149,131,157,215,10,92,6,77,10,14,247,241,247,165,
+10,248,100,248,4,21,71,251,209,5,90,83,10,247,31,96,29,101,6,210,247,209,
+5,165,103,29,252,61,169,29,175,180,10,207,247,209,5,14,247,88,248,55,21,37,
+103,10,186,6,251,0,252,135,5,89,48,10,247,85,6,162,153,150,158,154,131,145,
+119,31,48,6,187,247,117,5,81,174,247,63,29,67,206,251,3,65,85,115,80,76,31,
+247,73,171,247,59,10,216,239,247,138,29,248,140,248,21,21,171,104,91,155,
+247,36,10,207,211,159,174,198,31,178,162,156,156,156,26,150,130,147,127,131,
+135,137,131,128,30,100,110,125,130,106,128,8,125,102,98,132,103,247,11,29,
+181,177,152,10,128,119,135,30,14,247,251,248,4,21,247,46,6,110,251,22,138,
+126,5,247,108,29,158,143,30,179,247,76,5,252,100,6,100,251,73,247,120,10,
+152,156,150,150,158,144,30,167,247,25,5,247,46,6,71,251,209,5,39,205,29,157,
+31,247,143,247,16,10,40,6,14,80,10,14,248,35,248,182,21,141,148,140,146,144,
+26,154,129,148,122,30,138,6,126,138,72,135,5,113,137,126,130,123,26,123,150,
+130,156,144,144,139,140,143,30,186,143,113,251,15,5,152,119,124,143,114,27,
+82,87,106,77,98,31,99,80,118,70,69,26,48,189,76,211,155,151,141,145,167,30,
+120,44,5,58,57,29,247,105,57,10,59,6,162,242,5,126,156,157,134,164,27,196,
+189,170,200,180,31,179,197,160,207,208,26,241,94,199,62,119,125,136,130,116,
+30,127,77,21,155,159,158,146,161,27,188,164,101,67,251,14,65,251,6,61,117,
+126,146,155,125,31,87,141,21,122,119,121,132,116,27,89,112,176,208,197,155,
+194,170,189,31,190,172,174,164,181,27,161,151,133,124,151,31,14,247,231,247,
+167,29,120,125,170,29,247,25,160,10,153,130,146,247,3,10,120,125,247,99,10,
+247,20,10,132,6,14,248,172,190,21,40,89,10,248,68,6,118,51,5,137,130,139,
+138,247,73,29,149,160,144,30,14,248,227,190,21,41,75,29,71,251,209,5,98,83,
+10,248,174,6,118,51,5,138,136,138,132,136,26,127,147,131,152,247,93,10,14,
+238,248,4,21,247,27,6,71,251,209,5,90,123,29,247,111,6,247,24,201,179,225,
+219,82,175,251,19,31,61,6,166,247,18,5,198,6,163,152,149,158,154,129,146,
+121,31,251,187,6,106,251,30,5,138,133,138,134,136,26,126,147,132,152,155,
+151,150,159,144,30,247,32,251,119,21,170,247,32,5,202,6,247,7,181,120,87,
+89,100,120,39,31,14,247,69,248,4,21,198,103,29,251,56,88,10,192,6,71,251,
+209,5,89,83,10,247,115,6,222,192,151,163,163,31,160,160,152,172,173,26,217,
+77,179,251,14,30,56,6,99,251,83,21,170,247,32,5,206,6,247,9,179,121,86,88,
+102,121,36,31,247,239,247,209,21,163,142,10,39,6,115,125,129,120,125,149,
+131,159,31,162,6,72,251,209,5,115,88,10,243,247,16,10,110,6,14,247,100,248,
+4,21,204,116,29,251,63,88,10,192,6,71,251,209,184,29,99,251,83,238,29,248,
+106,247,84,21,49,116,46,72,39,27,76,89,158,182,85,31,151,124,132,142,130,
+27,125,128,128,125,121,164,117,187,115,31,111,195,179,128,190,27,220,205,
+165,195,196,31,194,192,167,200,207,26,247,3,59,213,251,12,68,79,117,96,93,
+30,140,152,139,145,144,26,156,131,149,124,120,132,127,99,134,30,131,79,5,
+137,127,139,134,133,26,122,148,128,153,153,146,146,157,148,30,148,158,146,
+152,150,152,8,174,169,196,160,207,27,193,176,126,112,164,31,160,115,151,108,
+107,26,137,139,133,138,135,30,251,143,140,29,14,247,95,247,83,21,138,131,
+139,131,127,26,251,1,201,69,237,196,193,165,185,175,30,182,192,165,218,212,
+26,245,82,205,47,43,53,64,251,8,105,30,70,247,46,29,120,31,251,12,133,10,
+247,182,247,83,21,205,176,93,58,70,116,73,100,97,31,110,112,109,125,101,27,
+67,96,190,223,192,156,190,172,181,31,184,173,178,160,185,27,14,248,144,248,
+3,21,181,6,165,153,148,156,156,125,148,113,31,251,123,6,251,12,66,88,54,84,
+173,106,209,128,31,100,112,82,86,92,86,8,82,57,29,192,6,158,143,140,141,143,
+31,146,144,140,141,152,154,239,247,4,201,183,191,137,8,207,6,110,251,20,5,
+88,57,29,247,39,57,10,97,6,155,247,208,21,109,251,30,5,251,18,6,60,101,158,
+179,192,189,165,240,31,14,248,180,248,55,21,252,61,161,10,121,125,149,131,
+157,31,235,6,72,251,209,5,38,83,10,247,142,96,29,41,6,207,247,209,5,247,218,
+6,179,247,73,140,153,5,152,131,146,126,122,128,128,119,135,30,14,247,132,
+248,153,21,158,224,5,37,88,10,186,6,131,105,5,91,6,116,127,129,121,124,148,
+131,156,31,185,6,49,252,51,5,98,83,10,247,23,96,29,100,6,192,247,134,5,215,
+226,163,152,194,27,199,172,112,92,133,139,138,136,127,31,73,251,202,124,75,
+81,91,78,141,25,251,20,6,116,247,68,10,247,20,6,232,222,207,230,156,31,207,
+247,204,5,141,150,140,147,148,26,209,84,185,57,86,86,117,96,86,30,160,237,
+5,247,37,6,166,154,149,156,155,127,147,118,31,14,247,37,247,134,21,229,179,
+212,189,232,27,212,197,104,95,136,139,136,138,137,31,137,7,138,133,139,139,
+137,26,247,108,29,159,144,30,158,228,5,140,145,140,143,142,26,152,131,147,
+126,121,130,129,115,132,30,171,104,93,155,79,27,59,73,111,81,83,31,85,84,
+111,72,70,26,33,212,73,247,9,243,247,37,205,186,150,131,147,127,131,133,136,
+131,128,30,92,75,76,116,71,27,50,82,189,218,148,140,148,140,148,31,247,145,
+6,167,247,137,29,200,172,21,138,133,138,135,136,247,117,29,206,29,140,7,107,
+172,186,123,202,27,247,22,247,135,10,161,104,150,78,145,64,147,139,139,118,
+148,245,10,133,157,119,135,26,137,247,114,10,150,149,160,143,30,154,207,243,
+29,126,178,10,163,133,162,247,77,29,63,83,146,29,129,148,127,122,129,129,
+118,135,30,14,120,10,247,14,248,207,247,5,10,248,83,106,10,248,56,248,4,21,
+174,57,10,251,166,88,29,185,6,91,251,113,5,67,123,101,101,82,27,128,131,140,
+142,129,31,146,168,5,141,147,139,140,143,26,155,130,148,124,124,128,128,119,
+135,30,131,100,5,137,130,138,132,135,26,120,166,127,182,237,194,188,247,1,
+163,30,188,247,115,5,227,189,29,117,88,29,232,6,209,185,153,172,170,31,165,
+165,154,176,175,26,202,90,173,47,30,116,6,128,88,21,167,6,207,164,126,104,
+81,92,104,60,31,113,6,14,247,145,247,83,21,109,251,32,5,113,83,10,247,65,
+6,247,18,195,177,225,183,123,168,104,158,31,156,108,98,148,91,27,81,6,167,
+247,18,5,197,96,29,251,29,102,10,166,6,111,251,18,5,251,21,6,164,247,18,5,
+160,116,29,41,102,10,163,6,71,251,209,5,107,83,10,247,6,247,17,10,110,6,170,
+247,32,5,247,45,251,32,21,170,247,32,5,181,6,241,180,119,90,92,96,115,56,
+31,14,247,132,248,153,21,158,224,5,37,88,10,186,6,131,105,5,94,6,114,126,
+130,122,123,150,130,159,31,180,6,49,252,51,82,10,86,118,95,86,30,160,237,
+5,247,41,6,163,247,137,29,66,29,66,29,248,22,190,21,34,57,29,247,84,6,165,
+152,247,111,29,105,6,81,29,14,177,190,21,98,83,10,248,177,142,10,93,75,29,
+14,248,126,190,21,105,29,164,247,10,24,52,10,150,6,117,50,247,14,10,152,156,
+150,149,160,144,30,173,247,33,5,14,247,124,146,21,103,251,59,199,29,171,247,
+49,247,159,248,7,189,10,251,198,50,247,198,200,29,14,203,247,114,21,132,102,
+137,125,123,26,39,219,68,247,4,247,44,247,25,247,14,247,31,247,3,57,216,251,
+12,35,251,24,89,99,127,147,130,152,145,143,140,146,149,30,171,189,211,159,
+203,27,233,204,81,54,136,139,132,138,132,31,252,9,88,21,247,253,6,57,105,
+54,85,46,27,51,78,192,216,31,14,247,151,248,238,21,37,88,10,186,6,251,1,252,
+136,82,10,87,118,95,85,30,14,247,130,247,162,21,160,237,5,247,166,6,110,251,
+22,138,125,5,247,108,29,159,143,30,179,247,76,5,252,113,102,10,235,6,118,
+41,5,89,169,10,187,6,103,251,61,5,38,83,10,247,142,96,29,41,6,175,247,61,
+5,247,28,247,17,29,14,247,118,120,21,46,203,10,231,6,119,48,199,29,158,230,
+5,232,247,17,29,47,6,142,154,247,159,248,8,189,10,251,199,50,247,199,200,
+29,244,251,253,5,14,248,158,247,86,21,147,176,140,144,161,26,244,62,209,251,
+5,251,42,251,25,251,15,251,30,251,5,220,64,247,16,242,247,22,189,179,150,
+130,149,128,133,133,137,133,129,30,106,86,71,120,76,27,43,75,196,223,144,
+139,140,140,151,31,151,190,21,221,176,222,193,228,27,229,196,86,56,31,251,
+91,247,237,148,29,47,29,251,207,247,69,21,146,7,151,130,147,126,119,247,43,
+29,163,157,170,160,247,76,10,125,128,130,124,134,30,97,126,93,112,83,27,92,
+103,163,171,142,139,141,140,142,31,14,97,29,247,220,145,10,248,7,248,55,21,
+251,57,6,116,124,127,121,125,149,132,158,31,247,3,189,29,251,46,204,29,247,
+249,89,29,251,44,6,85,248,175,21,111,113,114,112,118,155,124,160,169,164,
+163,168,159,124,154,116,31,247,99,238,10,51,10,52,145,10,247,72,248,4,21,
+172,104,29,33,88,29,156,6,247,5,251,227,97,83,5,86,98,116,122,105,27,130,
+135,140,141,127,31,149,185,5,142,148,139,142,144,26,155,130,149,123,124,130,
+129,116,134,30,127,84,5,137,129,138,134,135,26,119,171,123,182,195,175,162,
+211,195,30,247,214,248,53,5,161,104,29,37,140,29,156,6,251,113,251,178,5,
+128,248,147,21,140,7,140,142,139,143,142,26,150,130,147,127,118,247,43,29,
+162,157,171,160,247,76,10,124,129,130,121,133,30,100,126,92,112,85,27,92,
+103,164,171,31,14,35,10,251,18,248,41,46,10,35,29,251,87,247,244,46,10,247,
+146,247,88,21,188,134,154,127,169,82,247,165,29,132,100,24,147,29,81,106,
+123,86,83,30,69,72,109,114,121,137,152,197,24,141,149,139,139,142,26,152,
+128,151,126,124,131,131,120,135,30,122,63,5,123,109,29,155,6,123,66,5,138,
+136,138,131,247,55,10,248,77,190,21,114,29,132,100,24,59,29,182,247,45,10,
+155,150,149,159,144,247,137,10,248,85,190,21,77,10,247,148,6,108,251,32,5,
+99,169,29,247,13,6,118,51,5,137,131,139,137,247,5,29,248,116,190,21,251,33,
+247,59,55,29,120,125,170,29,247,25,160,10,153,130,146,247,3,10,120,125,170,
+29,247,4,6,118,51,5,137,129,139,139,247,5,29,247,125,247,24,21,129,91,5,138,
+135,138,133,247,79,29,153,203,185,147,170,149,191,165,25,111,251,23,5,34,
+57,29,247,84,6,165,152,247,111,29,105,6,207,247,209,5,178,104,29,251,20,88,
+29,175,6,111,251,17,80,109,116,129,92,127,25,151,192,5,140,145,140,143,142,
+26,152,128,151,126,125,131,131,120,135,30,122,66,122,140,5,95,142,121,151,
+165,26,149,141,151,142,154,30,163,246,5,183,6,166,177,29,90,178,108,206,135,
+30,14,73,10,34,57,29,247,71,6,118,51,5,138,133,138,135,247,73,29,149,159,
+143,247,137,10,247,200,195,21,59,248,92,5,209,6,162,154,150,158,161,29,251,
+43,142,29,165,6,228,252,148,5,203,6,247,161,248,51,164,180,139,139,149,151,
+25,151,151,153,146,152,225,29,110,129,117,109,31,112,119,136,134,101,81,8,
+14,47,29,251,224,247,99,21,147,131,135,142,132,27,122,125,125,123,133,142,
+134,145,132,247,118,29,147,144,136,146,27,154,247,107,10,247,112,248,87,21,
+148,189,5,205,6,162,153,149,158,153,129,147,120,31,251,62,123,29,192,6,129,
+89,5,83,203,10,194,6,70,251,242,184,29,169,247,51,5,247,21,6,161,154,150,
+157,247,20,10,251,99,252,36,238,29,248,29,182,29,247,17,251,144,21,49,100,
+58,83,47,27,52,79,195,221,147,139,141,140,148,31,145,178,167,142,165,27,169,
+151,136,122,166,31,125,163,156,134,170,27,169,169,144,153,203,31,251,242,
+187,21,232,175,223,199,234,27,227,198,83,56,131,139,134,137,127,31,134,105,
+124,137,117,247,61,10,108,105,133,122,71,31,134,137,5,14,247,164,190,21,127,
+6,63,247,209,5,197,6,163,153,247,117,10,118,31,251,43,247,70,29,158,31,176,
+6,227,252,4,5,216,6,247,65,247,162,5,194,175,157,156,163,27,146,146,136,132,
+151,31,126,160,149,135,151,27,166,165,166,166,170,113,158,95,76,87,103,60,
+90,31,14,247,167,127,21,194,140,189,147,173,154,8,199,165,174,184,188,220,
+29,141,146,5,69,29,119,152,128,180,126,31,183,124,180,132,189,136,124,72,
+247,164,29,105,142,31,14,51,29,247,223,124,21,188,143,183,150,181,158,77,
+29,41,200,76,243,128,31,125,75,5,166,6,162,151,134,129,124,120,127,113,124,
+127,143,149,121,247,87,29,183,119,181,196,181,175,186,170,121,156,105,142,
+31,14,73,10,251,31,6,114,251,30,5,138,135,139,135,136,26,124,146,131,154,
+157,148,149,162,143,30,156,227,5,247,73,6,171,152,147,157,156,126,147,113,
+31,14,211,183,21,122,129,131,125,125,149,131,156,31,247,50,6,156,149,147,
+153,153,129,147,122,31,90,6,133,137,141,145,31,247,76,7,145,141,141,145,30,
+244,6,143,140,138,136,141,31,247,17,251,75,5,140,137,140,138,137,26,137,138,
+138,138,137,30,82,55,5,135,133,136,132,134,26,129,150,129,150,148,145,143,
+149,145,30,184,205,5,141,140,141,140,142,27,141,142,138,137,140,31,185,72,
+5,130,145,145,135,148,27,150,150,149,149,144,136,146,135,145,31,81,223,5,
+137,141,139,140,141,26,141,139,139,141,142,30,202,231,5,143,146,141,145,144,
+26,150,128,149,128,131,133,135,129,132,30,89,66,5,135,137,137,138,137,27,
+136,138,140,143,136,31,47,247,27,5,138,140,139,141,140,26,142,141,141,141,
+30,188,150,157,147,166,162,8,175,169,157,181,189,26,183,125,179,113,165,30,
+167,112,94,152,74,27,251,143,6,122,129,131,125,125,149,131,156,31,188,6,145,
+141,137,133,31,252,92,7,133,137,137,133,30,199,247,136,21,133,137,141,145,
+31,247,104,7,145,141,141,145,30,247,33,6,229,184,103,68,100,122,106,110,118,
+31,119,109,100,131,66,27,14,247,189,248,137,21,251,27,226,10,247,31,251,3,
+247,3,251,30,31,112,251,173,21,251,54,7,53,148,62,214,135,217,8,194,4,145,
+222,213,213,226,150,8,251,60,7,194,84,21,247,59,6,136,66,59,61,55,128,8,247,
+109,4,247,60,7,223,130,215,63,146,56,8,14,248,45,227,21,148,99,143,126,146,
+127,8,120,151,155,128,156,27,200,180,230,247,28,247,24,96,230,78,68,103,50,
+251,64,31,251,238,7,123,147,129,153,153,147,149,156,30,248,3,4,161,7,237,
+167,215,175,176,165,66,34,251,13,117,75,97,104,117,184,215,135,30,251,229,
+129,21,138,93,125,102,118,129,8,129,134,133,130,128,26,137,7,124,140,149,
+131,156,27,241,140,5,244,196,236,247,70,247,29,102,232,72,172,31,117,150,
+117,143,101,138,8,132,136,141,143,149,147,163,144,147,31,142,144,140,141,
+143,26,144,136,144,135,142,30,137,140,5,141,136,135,140,135,27,121,118,105,
+108,138,31,130,138,138,137,132,27,122,6,122,129,130,126,125,149,131,156,31,
+156,6,145,141,136,134,31,183,22,146,140,140,155,238,175,75,251,67,251,9,118,
+70,96,114,30,128,121,104,134,90,27,126,134,141,143,140,139,140,140,140,31,
+160,168,148,170,140,186,8,14,111,10,14,226,22,197,6,163,220,165,226,167,201,
+174,188,25,201,182,214,190,187,27,153,151,130,128,128,132,110,128,99,31,76,
+251,103,5,135,124,137,125,123,26,109,157,119,166,170,162,155,197,192,30,124,
+168,5,98,100,126,129,129,27,133,135,143,144,143,140,145,141,146,31,212,247,
+164,5,142,148,140,150,148,26,191,112,166,88,82,87,111,71,69,30,173,240,247,
+40,206,159,184,251,47,71,182,247,40,251,30,117,124,110,5,145,155,147,141,
+149,27,167,150,131,120,127,136,121,133,121,31,120,82,251,20,84,132,100,247,
+18,193,5,14,248,141,243,21,85,101,110,119,97,27,109,118,145,158,102,31,180,
+195,155,192,222,26,247,11,178,202,215,242,26,208,102,186,84,66,79,51,251,
+9,133,30,135,65,71,150,99,153,114,159,25,110,163,123,172,175,26,197,173,170,
+214,151,30,119,178,92,130,110,128,118,121,25,110,115,122,101,96,26,93,159,
+97,178,103,30,175,106,193,118,221,125,133,57,127,105,102,89,8,174,78,99,152,
+93,27,76,93,109,97,99,182,112,203,188,201,151,153,168,31,145,149,145,141,
+141,27,141,143,137,133,148,31,124,159,181,128,171,27,208,191,168,200,176,
+31,251,205,114,21,116,83,121,134,104,27,101,113,151,157,159,166,154,174,171,
+162,131,110,195,31,247,43,247,242,21,216,144,169,190,181,27,171,160,109,97,
+77,102,96,40,87,31,14,247,58,248,23,21,178,129,158,122,113,26,105,108,116,
+94,99,108,159,170,134,30,149,137,132,145,130,27,130,131,131,130,129,144,124,
+147,126,31,109,157,177,121,187,27,202,180,175,194,183,116,166,88,153,31,71,
+158,5,113,146,126,152,158,26,169,167,162,177,176,165,124,115,145,30,130,140,
+147,133,149,27,140,6,147,145,145,146,181,91,174,83,78,101,105,84,100,159,
+117,186,126,31,247,231,74,21,221,247,76,5,251,136,102,7,127,132,133,129,129,
+147,247,46,10,124,247,146,149,6,151,146,146,149,149,132,145,127,31,79,6,58,
+251,76,56,247,76,5,80,6,127,132,133,129,129,146,132,151,31,149,251,146,125,
+6,127,132,133,129,129,146,247,46,10,102,247,136,6,222,251,76,5,14,247,66,
+247,23,21,186,185,177,158,188,27,220,204,78,62,69,84,81,73,105,101,157,169,
+112,31,105,176,5,168,112,105,157,110,27,98,107,110,102,116,148,122,159,122,
+31,146,157,5,128,157,135,148,151,26,165,160,159,166,163,168,119,107,163,30,
+167,100,5,99,169,183,116,189,27,186,184,158,172,168,31,172,178,157,183,182,
+26,215,83,202,46,167,30,228,165,178,185,219,26,234,75,205,47,85,99,122,84,
+71,30,176,110,5,186,201,166,152,179,27,199,177,93,67,62,91,82,74,122,127,
+141,148,114,31,145,153,140,145,148,26,167,126,159,121,120,121,117,116,106,
+169,120,201,133,30,75,127,115,128,84,98,8,14,248,141,247,37,21,73,101,78,
+103,62,27,251,16,51,247,4,247,51,247,15,200,241,213,154,149,135,127,157,31,
+120,114,132,123,120,26,115,153,102,160,107,30,176,83,5,165,100,154,97,107,
+26,109,115,119,103,106,115,159,166,149,142,147,149,154,30,98,163,5,125,116,
+135,129,121,26,85,190,98,205,194,184,179,188,171,125,179,115,178,30,107,191,
+110,190,5,125,162,131,163,154,26,175,186,173,190,169,162,131,116,177,30,180,
+185,120,153,129,132,5,151,104,120,142,111,27,96,115,131,110,100,31,166,108,
+116,149,107,27,39,60,251,21,251,54,251,69,247,1,251,19,247,44,237,215,186,
+227,186,31,14,248,19,247,100,21,221,168,189,189,194,26,200,75,181,47,251,
+53,251,22,251,13,251,41,251,9,221,69,247,28,200,207,155,164,186,30,171,156,
+152,153,157,26,149,138,147,133,162,30,89,85,67,113,58,27,44,81,177,212,122,
+31,202,140,221,152,197,159,8,251,87,160,21,149,181,151,165,163,167,8,191,
+183,214,172,213,27,192,176,117,108,116,119,116,102,121,31,98,119,36,109,90,
+134,67,131,24,14,247,4,22,247,233,6,168,194,5,96,6,156,205,5,154,193,150,
+219,184,26,247,1,89,194,40,30,251,16,6,73,138,136,140,127,185,8,142,137,147,
+137,147,30,135,114,138,126,121,26,90,155,124,191,30,247,7,6,192,155,137,127,
+158,31,162,125,154,107,101,26,96,132,86,126,82,30,115,36,5,251,135,6,14,247,
+59,22,247,59,6,175,184,154,116,147,130,159,126,25,146,167,141,155,140,171,
+140,217,24,141,226,5,168,139,159,140,146,30,147,247,0,139,139,149,26,186,
+120,157,80,147,30,81,147,100,146,130,144,128,161,25,122,119,134,129,128,26,
+115,168,119,177,137,30,154,138,157,138,156,138,8,146,146,136,137,143,31,151,
+131,143,121,140,87,8,55,7,138,37,133,82,124,83,8,251,44,6,14,248,149,211,
+21,251,195,247,196,145,140,5,142,6,144,140,167,143,156,144,176,156,25,146,
+142,142,142,145,26,145,133,144,132,30,134,6,137,117,135,139,125,27,105,85,
+148,153,91,31,140,137,137,139,138,27,133,135,135,135,134,140,136,142,126,
+31,152,95,146,93,105,26,129,139,132,138,127,30,128,7,129,143,133,146,145,
+142,142,151,144,30,149,160,152,186,141,156,8,141,7,139,139,142,140,141,30,
+247,196,251,195,5,14,246,211,21,168,111,247,195,247,195,5,81,148,157,90,153,
+27,146,143,145,149,142,139,142,138,144,31,138,168,5,173,146,185,152,183,30,
+142,152,140,142,144,26,143,135,143,133,138,137,139,138,137,30,125,90,87,130,
+103,27,130,129,139,140,130,31,140,125,139,139,137,27,132,133,134,133,133,
+142,136,146,136,31,176,122,156,134,167,135,144,138,24,142,6,146,138,5,14,
+246,248,56,21,247,196,251,196,5,132,6,136,138,134,138,111,136,122,134,102,
+122,25,132,135,136,136,134,26,133,145,134,146,30,144,6,141,161,143,139,153,
+27,173,193,130,125,187,31,138,141,141,139,140,27,145,143,143,143,144,138,
+142,136,152,31,126,183,132,184,173,26,140,168,5,140,144,139,142,143,26,148,
+135,145,132,133,136,136,127,133,30,130,118,125,92,137,123,8,136,7,139,139,
+136,138,137,30,251,195,247,196,5,14,248,149,248,56,21,111,168,251,196,251,
+196,5,198,130,122,187,125,27,132,135,133,130,31,127,7,140,127,139,133,128,
+26,105,132,94,126,95,30,136,126,138,136,134,26,135,143,135,145,140,141,139,
+140,141,30,153,188,191,148,175,27,148,149,139,138,148,31,138,153,139,139,
+141,27,146,145,144,145,144,136,142,132,143,31,102,155,123,145,110,142,134,
+140,24,136,140,5,133,6,14,166,219,21,211,104,180,110,187,88,8,167,6,119,186,
+125,160,97,180,8,248,67,171,252,68,6,179,178,156,163,159,185,8,111,6,93,91,
+93,107,70,104,8,247,115,4,248,67,6,100,100,122,115,119,93,8,167,6,187,189,
+185,171,206,171,8,160,7,70,172,93,172,94,187,8,111,6,159,91,154,118,180,99,
+8,252,68,6,14,168,213,21,248,68,6,99,101,122,115,119,92,8,167,6,184,186,185,
+172,209,174,8,160,7,68,174,94,171,94,186,8,112,6,158,93,158,112,177,103,8,
+252,68,6,247,115,4,207,106,185,106,186,90,8,167,6,121,182,118,170,102,174,
+8,248,67,170,252,68,6,179,177,156,163,159,186,8,111,6,95,92,91,105,70,106,
+8,14,247,96,247,15,21,100,158,126,145,79,166,8,122,6,220,81,241,45,182,81,
+182,199,247,1,239,213,188,140,140,24,140,135,134,139,137,27,128,93,119,106,
+77,31,248,17,7,178,119,151,133,199,112,8,159,6,54,198,48,222,87,207,85,72,
+66,72,39,63,157,137,157,146,233,186,8,182,252,39,21,248,63,7,193,179,192,
+99,5,252,65,7,86,100,5,14,247,37,22,130,185,161,136,165,27,247,19,232,247,
+6,247,48,200,122,187,107,171,31,169,110,92,159,100,27,101,107,132,116,79,
+31,156,96,5,153,180,159,143,164,27,183,186,120,113,160,31,155,118,146,114,
+140,97,8,251,68,6,102,137,137,110,119,144,135,164,31,247,72,6,251,0,123,82,
+84,42,27,123,133,139,142,93,31,14,247,212,247,120,21,247,54,7,157,132,148,
+126,125,132,130,121,30,251,54,251,72,7,121,130,132,126,126,149,131,156,31,
+247,72,251,52,6,121,146,130,153,152,146,148,157,30,247,53,247,72,7,158,148,
+145,153,152,130,146,120,31,252,37,247,193,21,121,130,132,126,126,148,132,
+157,31,248,38,6,157,148,146,152,152,130,146,121,31,14,247,153,251,37,21,180,
+250,106,98,6,14,247,81,251,138,21,177,6,138,250,251,5,102,6,247,38,254,251,
+21,177,250,251,101,6,14,230,22,190,6,247,52,248,26,247,53,252,26,5,190,6,
+251,66,248,71,5,64,6,14,230,248,70,21,247,66,252,70,5,214,6,247,66,248,71,
+5,88,6,251,53,252,25,251,52,248,25,5,88,6,14,247,172,248,68,21,47,126,72,
+58,40,26,46,209,56,228,126,30,36,7,61,131,110,118,130,136,142,154,129,30,
+154,129,126,147,124,27,115,124,124,116,112,162,120,174,165,166,152,162,161,
+31,168,170,146,170,227,26,206,7,236,150,210,221,241,26,239,69,217,41,148,
+30,203,7,208,148,167,161,145,145,135,128,146,30,120,151,149,133,156,27,162,
+155,154,161,166,116,158,107,116,115,131,124,121,31,103,111,126,96,50,26,180,
+77,21,213,129,191,77,61,26,61,87,76,65,128,30,98,22,70,151,91,202,217,26,
+216,189,202,206,148,30,14,243,248,210,21,103,109,110,103,102,168,110,247,
+132,10,247,88,252,79,247,0,29,247,88,248,79,247,0,29,14,241,247,23,21,104,
+108,109,107,100,167,109,177,175,168,168,175,176,110,168,103,31,248,79,4,104,
+108,110,106,100,168,109,247,132,10,247,218,252,146,21,104,169,110,174,176,
+168,168,175,175,110,169,103,102,110,110,103,30,248,76,4,105,169,110,174,176,
+168,168,175,175,110,168,103,102,110,111,102,30,14,248,49,248,83,21,178,212,
+5,143,145,141,145,143,26,149,129,148,128,130,134,135,126,132,30,90,48,5,251,
+181,6,121,130,132,125,126,148,132,157,31,247,159,6,84,36,5,251,104,247,125,
+29,247,82,6,83,37,5,251,26,247,125,29,247,4,6,100,65,5,136,134,137,132,135,
+26,129,149,130,149,149,144,143,152,145,30,189,231,5,247,177,247,121,29,251,
+155,6,194,241,5,247,100,247,121,29,251,78,6,194,242,5,247,23,6,157,148,146,
+152,153,130,146,121,31,14,199,247,218,21,248,54,251,125,5,137,143,144,137,
+143,27,145,145,143,145,142,31,141,142,5,141,142,140,143,142,26,146,135,144,
+130,144,30,251,246,247,89,247,246,247,89,5,148,143,143,145,146,26,143,138,
+142,137,142,30,138,142,5,145,135,133,143,133,27,135,135,138,136,134,31,251,
+110,251,125,21,247,108,251,12,5,136,144,145,137,143,27,149,148,149,149,148,
+135,145,129,144,31,251,44,224,247,44,223,5,149,145,143,145,147,26,150,130,
+149,129,135,134,137,136,133,30,14,248,147,247,218,21,252,53,247,125,5,142,
+134,134,140,135,27,133,133,135,133,136,31,137,136,5,137,135,138,136,136,26,
+133,143,133,149,134,30,247,245,251,89,251,246,251,89,5,130,134,135,134,132,
+26,136,140,135,141,136,30,140,136,5,133,143,145,135,146,27,142,143,140,142,
+144,31,247,110,247,125,21,251,108,247,13,5,142,134,134,140,134,27,129,130,
+129,129,130,143,133,149,134,31,247,44,54,251,44,55,5,129,133,135,133,131,
+26,128,148,129,149,143,145,141,142,144,30,14,247,56,174,21,224,6,247,46,172,
+144,165,184,31,206,180,180,214,224,26,233,85,225,62,170,30,187,212,5,144,
+147,142,145,144,26,148,132,146,130,129,133,135,125,130,30,86,60,5,147,97,
+120,140,251,2,27,251,86,6,120,129,132,126,126,150,131,157,31,247,89,6,217,
+169,138,134,174,31,251,141,252,11,5,48,6,120,129,132,126,126,151,131,157,
+31,202,6,81,51,5,133,130,136,133,135,26,130,146,132,149,149,145,143,153,148,
+30,236,247,38,21,247,135,248,3,5,208,118,191,62,60,26,78,107,77,89,105,30,
+112,99,100,133,251,34,27,14,155,10,247,86,251,173,21,40,118,64,76,40,27,83,
+87,162,180,102,31,113,167,128,163,128,185,8,194,4,242,160,215,204,238,27,
+236,214,73,37,159,31,14,247,186,248,137,21,251,28,226,10,247,30,251,3,247,
+4,251,29,31,251,49,252,3,21,111,174,129,169,184,26,247,5,224,225,247,5,179,
+161,132,108,190,30,178,100,21,170,100,147,116,94,26,251,8,55,54,251,8,93,
+110,148,167,101,30,14,111,10,247,88,183,21,118,120,121,119,115,156,121,162,
+161,157,157,161,161,121,157,117,31,14,185,22,194,247,117,248,85,194,252,85,
+247,116,84,6,14,188,247,117,21,248,86,251,117,194,248,140,84,251,116,252,
+86,6,14,188,248,85,21,247,117,252,85,194,248,85,247,117,194,252,141,6,14,
+230,251,52,21,248,57,194,252,57,6,140,248,178,21,247,65,252,70,5,214,6,247,
+64,248,71,5,85,6,251,47,252,25,251,50,248,25,5,85,6,14,247,228,251,138,21,
+135,247,254,203,247,3,247,101,131,8,202,7,78,138,251,90,133,61,251,44,145,
+252,5,25,14,247,111,4,188,153,138,137,157,31,190,131,183,113,166,100,8,184,
+75,163,251,13,251,55,26,98,201,193,7,200,137,185,135,187,30,131,232,109,235,
+103,184,8,191,98,66,171,61,27,77,6,14,247,111,4,201,140,238,141,224,194,178,
+227,25,172,214,155,247,0,247,42,26,190,76,7,251,67,131,77,105,39,30,104,45,
+80,102,251,6,140,8,118,6,14,247,165,249,129,21,134,252,39,222,251,26,247,
+145,146,8,202,7,251,72,133,73,223,118,247,154,8,136,164,138,149,162,26,155,
+140,166,140,165,30,14,233,173,21,248,49,6,251,98,248,78,5,251,19,252,24,21,
+247,19,247,164,247,19,251,164,5,14,233,178,21,248,78,247,99,252,78,247,99,
+5,193,251,226,21,247,146,7,247,164,251,19,5,14,234,248,112,21,247,98,252,
+78,247,99,248,78,5,251,225,85,21,247,145,6,251,19,251,164,5,14,209,247,138,
+21,248,78,251,99,5,248,50,7,251,218,251,99,21,247,164,247,19,5,251,146,7,
+14,183,247,223,21,247,155,251,182,247,151,247,179,251,157,247,184,5,14,132,
+247,220,21,247,200,251,232,247,200,247,232,251,200,247,233,5,251,157,251,
+232,21,247,157,247,179,247,157,251,179,251,157,251,180,5,14,247,194,248,53,
+21,70,84,84,69,69,193,82,207,206,194,195,209,208,85,196,73,31,137,79,21,174,
+168,109,103,103,110,109,105,103,110,168,176,175,167,169,175,31,14,247,8,251,
+47,21,247,138,166,51,250,13,227,165,251,138,6,174,254,39,21,250,13,227,254,
+13,7,14,247,8,251,47,21,247,138,250,66,251,138,113,227,254,13,51,6,247,15,
+22,250,13,227,254,13,7,14,123,155,248,53,155,247,22,151,167,152,6,190,10,
+192,11,167,147,142,143,143,143,142,143,147,187,174,171,12,12,248,236,20,173,
+19,1,127,2,0,1,0,31,0,58,0,97,0,112,0,117,0,133,0,189,0,194,0,226,1,54,1,
+73,1,81,1,154,2,90,2,121,2,156,2,161,3,39,3,188,3,204,4,84,4,100,4,150,4,
+159,4,170,4,181,4,237,5,72,5,119,5,140,5,164,5,174,5,252,6,85,6,123,6,131,
+6,140,6,217,6,247,7,4,7,15,7,26,7,65,7,120,7,144,7,173,7,215,8,0,8,32,8,98,
+8,158,8,163,8,174,8,194,8,203,9,30,9,37,9,83,9,137,9,215,9,246,10,22,10,58,
+10,89,10,113,10,131,10,139,10,208,10,220,11,7,11,18,11,23,11,32,11,35,11,
+44,11,109,11,172,11,199,11,229,12,0,12,33,12,86,12,129,12,140,12,174,12,184,
+12,214,12,223,12,234,12,254,13,4,13,11,13,19,13,43,13,58,13,70,13,79,13,92,
+13,98,13,120,13,131,13,141,13,187,13,203,13,214,14,2,14,31,14,44,14,55,14,
+63,14,74,14,99,14,121,14,144,14,149,14,169,14,176,14,180,14,196,14,202,14,
+232,14,240,14,248,15,22,15,30,15,67,15,76,15,83,15,89,15,94,15,114,15,121,
+15,133,15,142,15,177,15,185,15,194,15,201,15,227,15,237,15,242,16,2,16,9,
+16,41,16,73,16,86,16,105,16,125,16,132,16,152,16,166,16,195,16,200,16,218,
+16,243,16,246,17,2,17,15,17,34,17,52,17,59,17,73,17,89,17,117,17,128,17,154,
+17,165,17,175,17,188,17,204,17,211,17,218,17,229,17,238,17,243,18,2,18,28,
+18,46,18,63,18,87,18,96,18,106,18,120,18,126,18,131,18,155,18,165,18,173,
+18,197,18,208,18,217,18,230,18,239,19,6,19,20,19,27,19,40,19,62,19,82,19,
+95,19,108,19,115,19,122,19,130,19,151,19,159,19,166,19,179,19,189,19,209,
+19,216,19,228,19,240,20,3,20,22,20,41,20,60,20,79,20,96,20,103,20,113,20,
+122,20,129,20,136,20,145,20,161,20,171,20,189,20,193,20,204,20,211,20,217,
+20,225,20,236,20,247,20,253,21,14,21,21,21,31,21,38,21,48,21,65,21,82,21,
+87,21,92,21,108,21,124,21,138,21,146,21,162,21,178,21,187,21,203,21,217,21,
+227,21,235,21,243,21,249,22,8,22,14,22,29,22,44,22,59,22,67,22,78,22,93,22,
+108,22,123,22,130,22,143,22,147,22,155,22,169,22,183,22,197,22,211,22,225,
+22,239,22,253,23,11,23,16,23,26,23,38,23,47,23,56,23,62,23,71,23,80,23,89,
+23,98,23,105,23,111,23,124,23,137,23,150,23,161,23,174,23,187,23,200,23,213,
+23,226,23,239,23,252,24,9,24,22,24,28,24,39,24,46,24,53,24,65,24,77,24,82,
+24,87,24,99,24,106,24,118,24,130,24,142,24,154,24,159,24,169,24,179,24,189,
+24,197,24,205,24,213,24,221,24,229,24,237,24,245,24,251,25,1,25,7,25,13,25,
+24,25,35,25,46,25,57,25,65,25,76,25,87,25,98,25,109,25,120,25,131,25,142,
+25,153,25,164,25,175,25,186,25,197,25,206,25,212,25,217,25,222,25,225,25,
+230,25,235,25,240,25,245,25,250,25,254,26,3,26,10,26,15,26,20,26,27,26,31,
+26,38,26,42,26,47,26,51,26,56,26,64,26,73,26,80,26,88,26,98,26,102,26,109,
+26,112,26,119,26,127,248,100,247,76,21,162,251,25,5,69,48,10,247,48,68,29,
+107,6,52,248,148,5,125,29,247,142,190,243,10,11,248,69,22,221,6,161,247,7,
+10,112,6,219,248,4,5,164,10,73,73,74,29,202,163,188,203,31,11,248,189,248,
+160,21,85,10,5,98,171,193,117,204,27,247,30,247,5,247,39,10,112,247,34,29,
+228,176,173,128,123,157,30,148,130,159,110,102,29,11,248,49,22,241,168,29,
+92,6,93,10,153,200,224,29,11,247,155,64,10,11,128,29,247,212,6,162,154,151,
+156,155,130,145,247,118,10,11,247,115,247,138,21,247,19,6,205,105,171,87,
+193,251,52,8,199,68,29,112,6,91,247,22,117,177,91,180,8,246,174,199,200,214,
+26,214,72,196,51,30,251,140,143,29,192,247,138,247,83,10,73,44,80,35,31,11,
+248,52,124,10,11,247,169,146,21,40,251,30,5,251,16,80,29,247,125,6,162,153,
+150,158,241,29,131,145,118,181,10,131,145,118,194,29,11,247,236,248,55,21,
+251,14,80,29,207,189,29,47,6,117,124,127,122,124,149,132,157,31,247,209,6,
+161,154,151,156,154,129,146,120,31,251,64,6,184,247,100,5,234,247,19,181,
+163,182,27,159,153,131,116,159,31,131,146,142,137,147,27,156,154,153,155,
+148,130,152,122,154,31,157,119,120,146,112,27,87,87,114,61,34,31,11,248,82,
+22,247,53,248,4,5,155,141,10,251,3,103,10,180,114,10,11,247,73,10,129,149,
+128,188,29,248,49,22,241,168,29,92,6,182,10,142,144,140,140,144,30,164,229,
+159,143,175,27,202,178,115,102,134,139,135,138,136,31,125,75,5,154,85,110,
+143,95,27,251,34,251,1,64,41,72,191,99,224,208,198,161,191,211,31,153,200,
+247,81,29,224,188,247,5,179,181,134,130,174,31,11,247,227,189,21,96,164,176,
+116,183,27,174,182,157,175,188,31,163,156,145,147,247,25,29,110,27,88,102,
+190,209,147,140,154,141,155,31,247,150,6,149,187,141,157,247,51,29,92,92,
+113,91,100,31,185,125,102,167,93,27,107,105,131,123,98,31,110,127,129,129,
+124,26,129,149,128,148,145,147,142,144,149,30,154,167,170,147,166,27,178,
+166,114,103,131,139,136,138,134,31,127,86,5,146,116,110,143,112,27,70,66,
+112,99,99,31,115,114,127,108,101,26,67,188,93,215,181,179,157,178,183,30,
+138,131,5,138,134,138,135,135,26,128,148,130,151,206,29,107,224,21,81,80,
+102,116,102,27,91,107,166,181,157,146,162,149,152,31,168,162,205,164,194,
+27,160,163,135,131,164,31,200,185,21,228,171,185,186,195,27,186,164,106,78,
+125,138,129,138,121,31,11,214,10,191,184,247,33,29,130,132,121,133,30,103,
+127,91,113,85,27,113,115,146,150,125,31,132,145,125,157,141,26,14,248,91,
+248,239,21,251,56,161,10,120,124,147,133,160,31,247,2,6,251,1,252,137,5,251,
+48,48,10,247,254,68,29,251,46,6,11,160,29,158,31,11,247,223,247,77,21,110,
+251,26,5,91,103,10,247,241,6,168,247,27,5,140,140,139,146,143,26,150,247,
+30,29,186,247,108,5,206,6,135,119,5,137,133,139,137,135,26,127,148,130,151,
+155,150,150,159,143,30,159,233,247,116,29,142,26,151,130,148,127,123,129,
+129,118,134,30,134,116,5,72,6,181,247,86,5,247,72,6,117,36,5,137,132,139,
+137,231,10,173,247,48,5,252,69,48,10,194,6,251,122,252,97,5,105,142,29,242,
+68,29,122,6,206,247,26,5,247,34,190,21,251,9,6,247,29,247,168,5,179,6,11,
+162,104,29,44,57,29,158,6,99,251,77,5,132,6,116,140,133,150,116,221,121,206,
+135,151,125,167,8,163,127,114,150,97,27,113,132,133,112,133,31,127,82,5,137,
+128,138,136,135,26,126,148,130,154,154,148,148,158,143,30,151,190,164,137,
+145,132,151,93,25,155,75,161,71,150,122,96,121,123,122,83,53,52,251,28,24,
+110,57,29,171,6,152,150,140,141,141,31,142,141,146,148,145,148,227,247,33,
+24,186,211,187,183,167,135,8,146,6,90,251,117,5,110,88,29,240,104,29,120,
+6,188,247,117,5,148,6,175,138,162,105,156,64,165,251,24,24,146,107,141,138,
+171,138,8,11,248,149,247,221,21,59,29,198,57,10,84,6,114,29,8,11,167,57,10,
+42,57,29,156,6,114,251,10,5,132,6,116,140,132,147,113,196,8,229,100,125,152,
+80,27,111,131,132,113,133,31,131,103,5,136,126,139,138,135,26,126,148,130,
+154,155,150,149,156,143,30,146,170,162,137,143,134,160,95,25,156,99,154,109,
+151,122,88,112,136,137,92,80,67,48,24,111,57,29,164,6,163,140,141,140,146,
+145,149,152,25,215,235,184,194,180,169,166,136,25,145,6,107,251,40,5,112,
+88,29,235,57,10,123,6,171,247,40,5,148,6,180,136,156,123,160,79,170,49,24,
+149,112,142,137,168,138,8,11,248,191,248,111,21,63,10,205,57,10,80,6,72,29,
+8,11,247,10,10,251,9,47,5,123,127,136,134,128,26,127,148,130,152,146,146,
+142,147,148,30,247,152,230,247,10,10,251,10,47,5,124,128,135,134,127,26,127,
+148,130,152,146,146,142,147,149,30,14,179,29,185,185,124,115,144,10,11,125,
+10,136,26,127,148,130,152,159,29,11,6,164,153,148,155,156,125,148,114,31,
+11,247,76,247,158,21,183,29,141,247,76,10,122,129,129,119,135,30,130,98,217,
+29,151,247,93,10,170,247,35,5,252,72,119,10,248,91,6,174,247,53,247,95,10,
+123,128,129,118,134,30,115,251,4,5,251,195,6,14,247,48,247,158,21,92,251,
+107,5,109,142,29,247,112,6,247,16,136,247,27,247,11,169,247,28,150,194,24,
+144,159,141,159,156,26,247,8,61,222,251,2,247,33,10,97,251,87,5,66,48,10,
+247,68,247,138,21,247,66,29,98,26,127,138,126,136,127,30,123,67,114,36,251,
+0,44,50,142,25,251,35,6,186,247,107,5,247,49,203,29,251,47,6,14,21,247,47,
+247,1,5,155,146,144,146,154,26,151,130,147,126,136,125,134,135,134,30,251,
+13,53,53,224,5,148,130,137,140,130,27,136,6,127,124,123,127,128,142,134,148,
+134,31,14,248,81,247,158,21,92,251,107,5,89,142,29,247,32,89,29,100,6,78,
+29,14,248,125,247,158,21,187,29,150,29,121,124,127,29,115,125,213,10,156,
+155,130,145,205,10,11,65,29,251,36,57,29,185,119,29,11,248,55,21,57,247,70,
+29,158,31,167,200,10,119,31,101,6,191,247,132,5,215,218,166,154,202,27,174,
+157,133,121,157,31,154,125,146,122,119,26,130,139,136,138,133,30,87,251,130,
+5,110,168,10,247,0,68,29,112,6,191,247,135,5,141,147,140,147,147,26,209,85,
+184,57,78,99,121,84,75,30,11,247,99,195,29,174,57,10,251,3,140,29,158,6,247,
+9,251,239,95,81,5,92,102,106,114,111,27,132,129,140,142,125,31,150,188,5,
+141,146,140,145,144,26,153,129,148,124,124,129,128,117,135,30,126,81,5,137,
+131,138,131,135,26,118,168,126,185,199,176,162,213,196,30,247,225,248,67,
+5,162,104,29,32,140,10,158,6,251,120,251,189,5,11,247,116,247,117,5,152,160,
+10,154,131,145,118,147,10,120,125,236,29,120,125,216,10,247,22,160,10,153,
+130,146,247,37,10,117,124,247,41,29,11,21,130,29,247,113,247,152,10,247,129,
+10,185,154,169,176,135,10,247,121,247,71,21,187,173,247,24,251,54,5,122,80,
+29,247,23,68,29,97,6,251,50,247,85,247,70,247,16,5,184,6,162,154,151,156,
+155,131,145,118,31,251,22,80,29,145,6,251,72,251,19,217,247,254,5,38,161,
+10,121,123,147,133,159,31,187,6,251,1,252,137,5,89,80,29,239,6,11,183,29,
+142,26,150,247,109,10,135,30,130,99,217,29,152,155,150,149,160,143,30,170,
+247,35,5,252,72,119,10,11,196,10,184,119,180,196,182,175,186,170,121,156,
+11,248,73,190,21,78,10,96,251,93,5,11,248,75,190,21,81,29,111,251,23,5,11,
+248,56,247,76,21,162,251,25,5,69,48,10,247,48,89,29,107,247,96,29,120,125,
+181,29,247,20,10,69,6,219,247,25,5,247,142,190,243,10,14,6,247,119,29,173,
+115,10,251,6,161,10,121,125,149,131,158,31,166,146,10,251,41,6,238,248,97,
+5,164,115,10,32,6,116,247,68,10,168,146,10,251,41,6,247,119,29,162,116,29,
+251,3,88,10,174,6,11,248,201,195,29,185,6,163,152,149,158,154,129,146,120,
+91,29,153,129,147,120,31,88,6,11,207,247,209,5,172,96,29,251,12,169,29,173,
+6,112,251,18,5,251,147,247,46,29,119,31,251,11,133,10,11,247,119,29,176,123,
+10,251,24,140,10,180,6,97,251,84,5,80,54,80,115,79,27,95,117,158,178,152,
+141,151,139,29,76,185,97,208,199,200,159,185,213,30,11,248,132,195,29,247,
+139,10,90,83,10,247,31,96,29,101,6,247,119,29,168,6,162,153,149,158,153,129,
+147,121,31,252,62,88,10,174,180,29,247,119,29,14,247,125,146,21,40,251,30,
+5,251,16,48,10,247,125,6,161,154,151,157,241,29,130,145,119,181,10,130,145,
+119,194,29,11,247,1,190,21,109,142,29,247,112,6,247,22,247,18,247,2,247,35,
+171,31,151,194,5,144,159,141,160,156,26,247,9,63,219,251,4,247,33,10,91,252,
+97,21,247,119,29,247,66,29,99,26,128,137,125,137,127,30,123,67,114,35,32,
+44,49,142,25,11,5,98,83,10,247,23,96,29,100,6,192,247,134,5,215,225,164,152,
+194,27,199,172,113,91,133,139,138,136,127,31,88,251,130,5,98,102,10,247,24,
+247,16,10,100,6,191,247,130,5,141,150,140,147,148,26,209,86,185,59,82,11,
+205,29,158,31,11,247,8,93,29,121,124,170,29,148,6,11,247,51,10,161,121,31,
+165,117,173,128,208,126,208,247,21,10,98,130,10,11,247,67,118,10,153,130,
+146,197,10,21,247,18,6,155,148,148,154,152,134,143,126,31,251,58,6,105,251,
+47,5,135,7,131,147,129,146,30,149,141,144,140,145,142,5,145,148,182,149,155,
+27,171,161,118,107,81,94,91,85,113,104,155,156,127,31,145,134,136,141,132,
+27,127,128,128,126,113,197,107,186,217,207,211,221,192,104,173,85,121,121,
+136,130,113,31,14,6,115,126,247,109,29,11,6,207,247,209,5,180,103,29,251,
+31,6,114,126,247,109,29,186,6,71,251,209,5,251,148,6,207,247,209,5,188,116,
+29,251,32,122,10,178,6,68,251,209,5,112,83,10,11,171,203,27,175,170,136,131,
+193,31,138,147,142,139,142,27,156,153,152,156,149,133,146,127,142,31,145,
+108,71,146,100,27,46,62,86,64,123,31,127,83,5,55,103,10,220,189,29,45,103,
+10,247,208,68,29,11,21,150,148,145,149,147,26,152,130,148,125,133,139,139,
+129,123,30,251,10,43,5,125,128,134,132,130,26,126,148,130,153,145,150,144,
+144,146,30,247,152,235,21,151,148,145,149,147,26,152,130,148,126,132,133,
+136,132,129,30,251,11,43,5,125,128,135,134,129,26,124,147,131,153,145,150,
+144,144,146,30,14,6,150,191,5,185,149,173,174,175,27,153,159,135,133,159,
+31,135,148,141,139,142,27,154,153,191,29,120,125,100,10,11,182,10,144,141,
+139,144,154,30,160,216,165,144,173,27,202,178,115,102,235,29,41,72,191,99,
+224,208,198,161,191,211,31,11,5,68,83,10,247,43,103,29,113,247,96,29,121,
+124,149,132,158,31,247,1,6,251,166,252,97,5,111,83,10,247,42,96,29,71,6,11,
+195,29,247,154,6,106,251,43,5,137,131,139,137,137,247,117,29,155,150,149,
+159,144,30,183,247,96,5,252,94,138,10,127,131,135,137,130,128,30,92,78,74,
+116,65,247,11,29,180,178,152,10,129,118,135,30,11,247,228,185,29,96,169,113,
+186,160,177,10,146,140,146,143,159,31,11,21,104,247,53,10,113,31,14,6,115,
+107,118,97,124,26,131,146,132,148,146,143,141,146,145,30,173,178,163,159,
+188,168,153,148,24,145,142,143,141,140,140,8,153,147,142,142,147,26,146,135,
+143,120,149,30,79,173,110,162,108,174,8,152,128,135,142,132,27,130,131,133,
+131,124,155,107,168,95,31,11,170,29,210,189,29,60,48,10,247,88,6,11,247,42,
+10,251,188,48,10,247,44,6,65,251,235,5,64,123,63,80,60,27,91,99,159,182,100,
+31,166,247,17,247,29,10,134,30,107,251,41,145,133,5,77,196,11,6,115,126,129,
+120,125,149,131,157,31,11,159,10,159,31,11,121,10,154,130,145,247,91,29,11,
+109,10,14,122,29,247,189,247,146,247,105,10,112,247,26,126,196,119,182,115,
+159,25,160,159,171,180,175,190,194,219,147,148,163,144,129,100,24,138,128,
+5,121,148,129,155,153,148,149,160,144,30,151,194,5,141,151,140,144,142,26,
+155,126,148,113,81,117,120,251,23,49,30,90,68,126,127,112,136,11,21,251,85,
+251,72,251,64,251,76,251,28,242,39,247,32,247,86,247,72,247,63,247,77,247,
+29,37,238,251,34,31,130,88,21,247,8,223,58,251,4,251,43,251,42,251,38,251,
+48,251,13,55,218,247,6,247,45,247,42,247,36,247,53,31,14,248,15,209,29,247,
+25,58,230,251,10,31,132,88,21,228,203,63,33,251,44,247,12,10,247,28,31,11,
+248,28,195,29,247,27,141,10,251,212,161,10,121,124,136,10,247,212,6,162,154,
+151,156,154,130,146,247,118,10,11,155,10,251,86,251,143,21,246,226,225,246,
+247,0,225,53,33,33,53,52,34,251,1,51,224,243,30,11,138,124,5,123,149,128,
+154,153,148,150,161,144,30,150,192,5,141,148,140,147,142,26,155,123,148,110,
+69,116,124,34,54,30,11,154,27,147,146,146,148,146,136,143,132,145,31,99,172,
+120,161,109,188,136,143,136,144,136,144,8,136,144,135,145,139,26,247,85,29,
+106,82,114,107,103,111,8,126,128,136,134,133,26,129,146,132,147,153,11,6,
+251,18,251,181,107,247,128,5,80,6,251,25,251,127,136,247,180,5,186,141,10,
+251,3,103,10,153,6,143,252,4,5,197,6,247,31,247,135,173,251,135,5,11,6,163,
+153,149,157,154,129,147,120,31,11,247,123,248,55,21,58,6,115,247,68,10,166,
+189,29,98,83,10,247,23,96,29,100,6,191,247,132,5,212,219,171,157,194,27,11,
+88,10,186,6,39,252,97,150,10,11,247,118,21,247,19,6,247,24,247,7,233,247,
+0,218,71,195,44,31,251,132,119,10,247,126,6,161,154,151,157,11,80,29,187,
+146,10,89,80,29,11,248,8,145,29,247,20,10,251,46,6,11,216,10,207,6,45,252,
+67,251,84,248,118,5,251,2,80,29,187,107,29,11,6,115,247,69,29,11,6,164,153,
+247,111,29,11,145,29,161,29,251,46,6,11,248,137,22,179,247,75,5,141,149,139,
+139,142,26,150,129,148,127,122,129,129,118,195,10,11,247,128,10,252,80,247,
+18,10,248,80,251,33,224,10,11,247,101,246,10,137,146,128,31,242,217,10,11,
+222,29,251,43,247,223,229,29,11,247,72,29,43,5,126,130,133,129,128,26,127,
+11,98,150,156,138,29,11,207,29,225,53,5,131,146,143,137,146,27,155,155,153,
+154,147,138,141,128,149,31,14,167,10,142,145,149,30,247,14,247,154,10,123,
+29,169,180,10,170,247,32,5,11,139,134,140,132,31,157,251,212,5,117,140,148,
+129,155,27,155,147,149,161,140,31,108,251,35,21,105,114,116,108,108,164,115,
+173,31,151,6,173,165,163,170,170,113,162,105,31,11,247,101,29,124,133,134,
+119,131,30,101,123,91,115,80,227,29,170,29,247,25,146,10,251,27,48,10,11,
+26,195,110,177,80,160,30,221,169,180,188,209,26,219,72,190,34,81,101,129,
+108,80,30,131,125,136,138,136,27,135,137,144,150,159,130,149,123,124,130,
+130,122,136,31,11,6,117,124,127,121,125,247,49,29,127,121,124,147,133,159,
+31,247,126,6,162,153,150,158,247,20,10,50,6,14,248,245,21,247,12,29,247,113,
+22,247,12,29,14,6,114,125,130,123,122,153,130,164,31,11,160,10,154,131,145,
+118,31,11,6,163,153,149,158,154,129,146,120,31,11,21,251,47,242,29,247,13,
+226,225,53,5,131,146,144,137,146,27,154,155,154,153,147,138,141,11,247,50,
+29,147,156,247,84,10,139,143,26,151,130,147,126,122,129,129,119,134,30,11,
+247,111,21,152,148,145,149,150,26,151,131,147,126,132,239,10,146,147,142,
+146,149,30,14,6,247,139,10,11,31,251,3,142,29,171,6,251,74,251,75,35,247,
+75,5,172,247,22,10,11,21,147,148,143,147,166,29,249,6,156,29,5,89,83,10,247,
+188,247,110,29,174,172,159,247,35,10,11,173,29,143,247,138,10,129,123,160,
+31,149,131,163,112,135,26,137,103,5,133,151,130,149,156,149,149,159,143,30,
+159,229,243,29,123,128,11,247,98,29,204,210,208,10,11,218,29,122,116,247,
+64,10,11,247,191,248,137,21,251,27,247,89,10,247,31,247,29,247,2,247,4,247,
+31,247,31,251,2,247,3,251,30,31,11,247,60,10,132,146,133,227,10,202,146,166,
+157,144,143,135,130,145,30,119,153,149,133,159,27,165,157,156,163,169,114,
+160,104,115,114,130,124,119,31,102,110,125,96,50,26,14,247,6,29,103,129,247,
+126,29,11,6,116,125,247,115,29,11,6,162,154,151,157,11,6,116,125,128,11,247,
+84,29,126,247,77,10,192,182,149,147,164,27,154,157,130,120,163,31,11,247,
+103,10,155,146,198,29,251,14,168,10,207,6,85,251,139,5,81,11,6,77,108,113,
+110,98,185,10,11,21,251,51,251,19,251,16,251,47,251,50,247,17,251,18,247,
+49,247,47,247,18,247,18,247,48,247,45,251,18,247,20,251,43,31,11,247,41,10,
+247,15,29,145,11,6,115,125,247,115,10,159,31,11,161,10,121,125,216,10,11,
+51,30,251,151,80,29,187,6,149,251,87,21,181,247,87,5,247,52,6,200,182,107,
+92,112,122,11,247,3,29,148,130,152,247,85,10,11,214,29,240,10,11,21,247,50,
+247,0,5,156,151,143,144,151,247,76,10,133,11,105,247,54,29,112,31,11,248,
+146,247,241,21,196,108,91,166,70,27,251,27,251,19,251,15,251,23,40,210,69,
+239,208,197,165,195,195,31,115,32,11,27,247,86,6,160,153,149,155,155,127,
+148,116,31,251,88,6,251,20,96,144,158,104,31,84,168,101,203,203,26,197,171,
+11,230,29,128,115,122,135,121,27,123,131,145,153,11,128,129,123,133,30,165,
+111,96,153,85,27,251,4,247,34,10,192,133,11,189,29,98,204,29,247,23,6,161,
+154,151,156,154,130,146,120,31,100,6,11,6,71,251,209,199,10,11,31,251,2,80,
+29,183,6,251,111,251,198,51,247,198,5,183,160,10,154,11,247,113,10,148,145,
+26,201,81,181,54,247,27,10,11,192,81,58,26,251,1,39,36,251,15,121,30,87,22,
+53,151,85,197,220,26,247,2,238,241,247,16,157,30,14,247,45,196,29,11,26,106,
+165,121,185,183,247,35,29,136,138,113,27,122,130,145,152,11,26,107,165,120,
+182,185,184,161,161,148,132,147,130,136,135,138,136,134,30,126,113,247,72,
+10,11,127,192,10,5,89,48,10,247,126,68,29,251,24,6,14,5,150,203,29,251,2,
+80,29,183,6,251,111,11,153,149,149,160,145,30,170,247,1,5,247,19,247,116,
+10,94,88,29,11,157,165,175,178,247,52,29,94,104,116,160,170,178,180,174,184,
+31,11,247,96,10,130,247,28,29,21,154,150,143,144,151,247,76,10,132,134,137,
+131,11,191,5,185,149,174,174,174,27,153,159,135,133,159,31,135,11,134,30,
+110,251,26,5,251,193,6,248,59,248,83,153,204,5,251,252,6,104,251,53,5,137,
+130,139,139,11,247,102,29,127,143,149,120,247,87,29,11,120,31,251,24,6,188,
+247,118,21,190,247,127,5,247,36,6,205,188,99,86,64,52,72,43,31,14,5,188,141,
+10,251,12,48,10,158,6,11,5,98,205,29,158,215,10,91,6,11,189,29,98,202,10,
+247,24,247,8,10,130,145,11,172,21,247,19,29,206,29,140,7,107,172,186,123,
+202,27,11,6,115,125,247,41,29,11,161,10,121,125,170,29,11,6,165,153,148,156,
+155,125,148,113,31,11,119,31,92,6,186,247,107,5,11,248,142,218,10,11,21,251,
+50,247,149,10,145,142,145,149,30,247,15,223,11,192,101,176,86,31,132,100,
+21,173,163,115,105,93,95,95,93,103,115,162,174,186,183,182,187,31,11,30,251,
+15,55,54,223,5,145,132,133,142,133,27,123,124,247,136,29,158,31,181,164,159,
+169,175,26,184,103,170,87,86,247,104,29,11,190,21,247,119,29,247,47,6,125,
+74,138,130,5,134,7,130,138,150,129,150,27,156,149,11,145,133,247,118,29,147,
+247,29,29,247,41,29,247,32,6,162,154,151,11,21,145,127,147,130,119,126,123,
+113,81,190,101,217,11,31,247,32,96,29,11,148,132,159,31,11,251,53,251,66,
+251,53,5,125,126,136,134,129,26,127,148,130,152,147,146,142,148,150,30,11,
+22,247,3,248,148,5,247,11,10,11,148,139,139,118,147,245,10,11,27,41,67,211,
+237,153,141,153,142,154,31,154,208,5,247,6,163,247,1,232,247,0,27,11,247,
+27,10,144,141,139,144,154,30,160,11,247,24,29,172,114,162,102,31,14,30,251,
+28,41,5,124,128,135,133,128,247,66,10,247,129,29,252,80,247,18,29,11,74,197,
+224,144,139,143,140,147,31,248,9,190,21,251,254,6,220,174,224,194,231,27,
+11,247,89,10,247,32,247,28,247,3,247,4,247,31,11,247,118,29,146,247,29,29,
+243,29,122,129,129,118,134,30,115,251,4,5,11,30,39,217,21,110,114,115,111,
+116,152,126,162,169,164,163,167,160,124,154,117,31,11,251,144,5,128,7,120,
+150,127,156,159,152,151,166,149,30,229,247,147,5,14,136,26,127,148,130,152,
+155,150,149,160,143,30,11,31,119,123,131,129,128,26,127,148,131,152,146,11,
+130,148,126,247,13,29,11,68,29,251,2,159,10,11,135,137,131,127,247,26,29,
+11,30,166,179,176,144,247,35,27,247,88,6,161,152,149,155,155,126,148,117,
+31,11,21,106,247,53,29,112,31,14,22,247,65,29,247,139,29,247,125,10,129,133,
+130,128,26,127,148,131,151,11,149,30,247,14,247,64,29,155,146,11,195,186,
+5,215,7,251,192,251,142,247,192,251,141,5,214,7,83,187,5,11,239,247,102,247,
+23,29,11,21,251,112,6,247,57,247,169,5,146,6,11,111,113,114,112,118,155,124,
+160,168,164,163,11,8,120,147,125,155,154,26,180,204,174,215,175,170,132,127,
+158,30,148,11,21,251,60,247,89,5,148,131,132,143,131,27,123,125,125,123,134,
+140,11,21,167,95,105,155,124,27,132,132,131,130,133,143,134,151,128,31,174,
+11,21,106,106,107,107,114,159,119,163,173,172,170,172,165,120,158,113,31,
+11,31,155,158,151,166,154,26,150,130,148,126,124,130,131,121,133,30,110,11,
+119,31,87,6,247,64,247,25,247,4,251,25,5,86,161,10,11,247,58,29,247,34,5,
+14,21,69,6,114,251,5,5,209,6,14,21,152,149,145,148,150,26,151,11,154,151,
+157,247,20,10,11,6,161,154,151,157,154,11,247,124,10,251,42,161,10,120,11,
+21,155,152,142,143,150,247,76,10,132,131,136,132,130,30,11,168,68,29,251,
+41,6,115,125,128,11,251,23,251,47,251,21,44,75,212,247,0,247,50,247,22,247,
+42,11,247,37,29,14,5,137,129,139,139,136,26,126,147,132,11,6,115,126,247,
+108,10,11,247,70,10,121,31,11,6,163,247,93,29,119,31,11,6,118,128,130,122,
+123,150,130,160,31,11,185,44,24,152,113,140,139,168,138,8,11,153,130,146,
+119,31,11,128,158,133,159,124,8,155,128,150,117,119,26,59,55,74,36,11,68,
+29,251,2,161,10,11,247,129,29,252,206,6,118,128,130,11,21,251,51,247,63,10,
+11,247,21,29,125,129,134,247,71,10,11,73,76,82,78,115,147,122,159,123,30,
+94,113,116,103,98,26,11,101,43,120,125,104,30,124,133,132,129,127,26,127,
+148,130,150,11,136,133,247,55,29,247,44,29,118,11,130,146,119,31,251,14,6,
+171,247,42,5,141,145,139,141,11,6,155,138,151,149,154,26,142,7,154,127,149,
+123,138,30,11,27,76,77,82,66,123,31,128,85,5,66,161,10,11,30,251,112,142,
+29,166,6,11,50,79,63,116,152,114,159,125,31,164,121,166,132,212,132,11,184,
+186,26,174,128,168,119,161,30,171,110,69,159,58,27,11,247,133,10,34,213,71,
+247,6,11,119,31,88,6,247,87,247,88,247,4,251,88,5,86,6,11,101,5,247,50,180,
+21,38,6,247,29,247,60,5,14,229,247,3,175,123,173,113,157,31,11,127,26,127,
+148,130,152,145,11,21,251,50,251,1,5,123,11,247,117,10,119,31,11,129,148,
+123,123,132,131,114,134,30,73,251,200,5,137,11,247,78,29,150,149,11,6,118,
+51,5,138,134,138,135,135,26,126,147,132,152,11,132,150,31,224,6,150,147,146,
+149,149,132,145,127,31,11,143,31,165,247,11,5,252,103,6,114,251,8,5,138,11,
+21,251,43,101,247,126,10,11,154,247,117,10,118,31,251,12,161,10,11,41,5,126,
+130,134,131,128,26,127,148,130,151,147,142,11,173,107,96,156,83,27,251,13,
+34,53,40,108,152,109,11,184,176,8,146,145,142,143,146,26,148,132,146,131,
+124,11,247,104,10,164,120,158,11,128,26,127,148,130,152,146,144,141,147,150,
+30,14,247,79,29,14,150,26,150,129,148,127,30,14,132,133,130,127,26,127,149,
+130,151,143,152,144,143,11,247,53,247,67,247,54,5,153,152,142,143,149,26,
+11,21,223,196,87,63,40,36,45,251,0,53,82,190,11,21,148,131,134,141,132,27,
+123,124,125,124,133,142,11,27,117,123,143,148,123,31,168,88,134,141,104,27,
+11,154,153,153,150,130,156,124,154,31,166,115,108,152,11,251,1,5,123,129,
+134,133,127,26,127,148,130,152,11,108,105,108,105,112,121,155,163,171,172,
+169,175,31,11,112,247,87,10,11,26,127,148,130,152,146,144,247,138,10,79,194,
+222,247,0,247,0,240,247,9,31,14,125,129,120,124,149,132,158,31,11,6,161,154,
+151,156,155,131,145,11,6,162,247,93,29,11,132,128,26,127,148,130,152,146,
+11,134,137,121,27,118,128,145,151,11,21,148,149,143,146,147,26,149,11,21,
+92,97,100,95,106,164,116,11,247,118,29,146,145,136,11,26,151,130,148,126,
+11,129,26,126,150,128,153,148,145,143,149,147,30,11,247,47,247,33,21,247,
+182,247,177,251,182,6,11,251,50,251,70,251,82,251,23,220,47,247,8,11,142,
+247,76,10,123,128,128,119,135,30,11,21,147,131,134,142,132,27,122,125,125,
+123,133,11,21,251,33,6,231,251,128,5,121,146,148,131,11,21,186,247,107,5,
+247,40,6,201,189,99,89,11,149,149,159,144,30,163,247,2,5,141,148,139,11,155,
+150,149,159,143,30,150,189,5,247,125,6,11,31,223,6,155,152,150,153,150,131,
+146,125,31,11,158,112,147,63,152,8,43,155,108,160,186,26,11,172,82,8,121,
+149,143,135,146,27,146,144,142,11,251,5,251,4,251,27,251,34,247,2,251,4,11,
+248,104,247,130,29,11,6,160,150,148,155,156,128,148,118,31,14,146,132,31,
+232,41,5,11,156,149,149,160,144,30,11,125,8,156,128,151,120,123,26,87,62,
+95,11,5,141,149,139,139,142,26,150,130,148,126,11,132,247,125,10,11,247,128,
+29,128,11,21,147,131,134,142,132,27,123,124,125,124,11,170,29,247,24,160,
+10,11,30,247,15,223,224,56,5,132,147,144,136,11,248,41,248,5,21,247,16,6,
+162,154,150,11,168,177,142,140,144,140,146,30,140,142,139,11,56,5,132,146,
+145,136,145,27,155,154,153,11,106,247,134,10,11,21,69,6,115,251,5,5,208,6,
+14,149,130,151,148,150,145,149,148,30,14,155,153,153,142,132,153,136,142,
+31,14,129,121,124,149,131,158,31,11,130,148,126,122,129,129,118,11,136,26,
+126,147,132,153,155,11,26,150,130,147,127,129,134,11,162,154,151,157,154,
+130,145,11,194,247,147,5,141,147,140,11,109,5,132,151,130,148,156,11,128,
+120,125,148,132,11,6,40,252,97,5,11,151,157,154,131,145,11,118,31,251,24,
+6,11,124,129,130,119,133,30,77,251,108,5,11,5,137,131,139,137,136,26,126,
+147,132,11,6,160,150,149,160,150,131,144,123,31,11,6,160,155,152,155,155,
+131,145,118,31,11,6,162,154,150,157,161,29,11,6,163,153,150,158,154,131,145,
+118,31,11,132,136,132,129,30,251,27,43,5,126,11,134,113,94,31,70,98,97,63,
+55,26,11,138,126,5,128,149,130,151,155,149,149,11,21,161,150,148,155,156,
+128,148,117,31,11,21,119,126,124,117,74,187,103,224,193,11,151,130,147,126,
+123,128,129,119,135,30,11,153,154,148,134,147,129,143,31,147,120,11,176,175,
+168,168,176,175,110,168,103,31,11,80,27,251,48,251,25,251,19,251,41,11,108,
+106,114,158,120,165,175,171,170,172,11,240,208,228,164,125,167,118,155,31,
+111,11,130,152,146,139,139,149,156,30,14,30,174,247,34,5,14,141,147,151,30,
+14,39,252,97,5,11,102,10,14,5,247,19,29,11,51,247,14,10,11,89,29,71,6,11,
+68,29,71,6,11,48,10,160,6,11,21,233,29,11,244,10,167,160,11,131,147,126,247,
+96,10,11,247,63,10,145,11,214,29,149,30,11,247,44,10,159,143,30,11,22,130,
+29,14,137,131,128,247,25,10,11,223,225,163,10,249,18,167,10,11,115,158,29,
+11,234,10,158,31,11,129,10,147,131,152,247,92,29,88,10,174,146,10,98,83,10,
+11,100,10,162,154,151,157,11,107,29,247,20,10,71,6,11,161,10,120,125,136,
+10,247,212,6,11,5,71,10,11,6,247,114,249,64,56,29,54,29,14,164,10,72,74,74,
+29,11,72,29,129,102,24,65,29,11,};
+#endif
@@ -0,0 +1,2584 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusMonoPS_Regular_cff_size = 53809;
+asm(".section .rodata");
+asm(".global fz_font_NimbusMonoPS_Regular_cff");
+asm(".type fz_font_NimbusMonoPS_Regular_cff STT_OBJECT");
+asm(".size fz_font_NimbusMonoPS_Regular_cff, 53809");
+asm(".balign 64");
+asm("fz_font_NimbusMonoPS_Regular_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusMonoPS-Regular.cff\"");
+#else
+const int fz_font_NimbusMonoPS_Regular_cff_size = 53809;
+const char fz_font_NimbusMonoPS_Regular_cff[] = {
+1,0,4,2,0,1,1,1,21,78,105,109,98,117,115,77,111,110,111,80,83,45,82,101,103,
+117,108,97,114,0,1,1,1,53,250,26,0,250,27,1,250,28,12,0,250,29,2,250,30,3,
+248,24,4,140,12,1,48,12,3,190,12,4,251,53,251,209,249,141,250,57,5,28,54,
+75,15,28,54,97,17,187,29,0,0,184,205,18,2,4,2,0,1,0,3,0,9,0,16,0,22,0,28,
+0,38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,0,123,0,136,
+0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,216,0,227,0,
+238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,1,103,1,115,
+1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,190,1,196,1,
+206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,2,38,2,44,
+2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,2,151,2,
+162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,3,20,3,
+27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,118,3,
+131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,3,216,
+3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,73,4,
+79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,163,4,
+168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,4,251,
+5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,5,127,
+5,136,5,141,5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,229,5,
+237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,112,6,
+121,6,128,6,137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,6,248,
+7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,115,7,
+122,7,134,7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,7,211,
+7,214,7,219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,1,8,4,
+8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,
+8,80,8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,8,127,
+8,132,8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,230,8,
+239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,134,9,
+154,9,163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,10,
+6,10,15,10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,114,
+10,123,10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,10,
+213,10,222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,46,
+11,53,11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,11,
+144,11,151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,214,
+11,221,11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,12,54,
+12,63,12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,153,12,
+162,12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,12,252,
+13,5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,102,13,
+111,13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,13,191,
+13,200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,14,18,
+14,25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,102,
+14,109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,14,
+179,14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,249,
+15,0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,15,
+84,15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,15,
+161,15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,80,16,94,73,74,65,
+98,114,101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,67,99,
+97,114,111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,
+99,114,111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,116,
+69,111,103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,99,99,
+101,110,116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,76,99,
+97,114,111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,110,103,
+97,114,117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,83,
+97,99,117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,114,
+105,110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,99,117,
+116,101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,117,
+110,105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,114,
+99,117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,114,
+99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,105,
+114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,73,
+109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,109,
+102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,109,
+97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,109,
+97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,114,
+99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,85,109,
+97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,73,98,
+114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,111,
+103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,111,
+116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,101,
+99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,110,
+101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,97,
+99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,77,111,110,111,32,80,83,32,82,101,103,117,
+108,97,114,78,105,109,98,117,115,32,77,111,110,111,32,80,83,1,106,2,0,1,0,
+65,0,128,0,164,0,193,0,201,0,219,1,36,1,71,1,88,1,159,1,248,2,6,2,48,2,154,
+2,233,3,169,3,203,3,207,4,11,4,129,4,157,4,173,4,188,4,219,5,74,5,148,6,23,
+6,26,6,41,6,163,6,204,6,237,7,97,7,182,7,193,8,0,8,108,8,199,9,2,9,9,9,14,
+9,69,9,104,9,187,9,242,9,253,10,3,10,54,10,59,10,141,10,207,11,17,11,94,11,
+102,11,157,11,175,11,234,11,241,12,21,12,92,12,113,12,160,12,221,13,1,13,
+27,13,55,13,60,13,91,13,112,13,125,13,158,13,210,14,14,14,39,14,82,14,93,
+14,104,14,130,14,182,14,199,14,223,14,251,15,14,15,49,15,60,15,68,15,73,15,
+93,15,101,15,149,15,156,15,167,15,205,15,236,15,251,16,10,16,19,16,62,16,
+69,16,81,16,123,16,141,16,176,16,182,16,193,16,204,16,224,17,1,17,16,17,49,
+17,57,17,97,17,119,17,132,17,149,17,153,17,184,17,214,17,228,17,255,18,19,
+18,24,18,31,18,68,18,85,18,121,18,157,18,171,18,183,18,210,18,227,19,6,19,
+39,19,44,19,50,19,60,19,82,19,91,19,117,19,124,19,133,19,139,19,163,19,195,
+19,219,19,250,20,4,20,35,20,42,20,48,20,52,20,73,20,78,20,95,20,116,20,128,
+20,149,20,171,20,191,20,205,20,214,20,223,20,236,20,251,21,23,21,51,21,61,
+21,88,21,107,21,122,21,129,21,140,21,151,21,156,21,182,21,197,21,223,21,237,
+21,247,22,16,22,35,22,41,22,66,22,80,22,86,22,110,22,134,22,146,22,156,22,
+167,22,183,22,206,22,229,22,243,23,10,23,31,23,35,23,57,23,65,23,80,23,101,
+23,108,23,129,23,150,23,163,23,175,23,195,23,215,23,233,23,245,23,253,24,
+9,24,28,24,47,24,66,24,76,24,83,24,101,24,112,24,130,24,140,24,158,24,176,
+24,187,24,198,24,209,24,220,24,230,24,241,24,252,25,13,25,23,25,40,25,49,
+25,65,25,81,25,97,25,109,25,120,25,128,25,144,25,160,25,174,25,184,25,194,
+25,204,25,214,25,220,25,230,25,240,25,247,25,254,26,13,26,28,26,43,26,58,
+26,73,26,86,26,100,26,114,26,128,26,142,26,156,26,170,26,182,26,194,26,203,
+26,212,26,221,26,227,26,240,26,253,27,10,27,23,27,36,27,49,27,62,27,75,27,
+88,27,101,27,114,27,127,27,140,27,153,27,164,27,171,27,178,27,185,27,192,
+27,204,27,216,27,228,27,240,27,252,28,8,28,20,28,32,28,44,28,53,28,63,28,
+71,28,79,28,87,28,95,28,103,28,111,28,119,28,127,28,132,28,139,28,150,28,
+161,28,172,28,183,28,194,28,205,28,216,28,227,28,238,28,249,29,4,29,15,29,
+26,29,37,29,48,29,59,29,69,29,80,29,91,29,102,29,111,29,120,29,129,29,135,
+29,138,29,141,29,145,29,156,29,160,29,172,29,181,29,189,29,194,29,199,29,
+217,29,225,29,231,29,241,29,249,30,12,30,29,30,45,30,55,30,68,30,82,30,97,
+30,112,30,131,30,141,30,148,30,176,30,179,248,61,247,76,21,190,251,25,5,71,
+6,130,29,247,48,49,29,106,6,251,89,248,148,5,251,99,167,29,247,3,6,251,66,
+252,97,5,111,6,118,128,130,123,122,151,130,159,31,247,43,49,29,68,6,189,247,
+25,5,247,131,190,247,109,29,11,248,141,248,148,21,168,6,160,150,148,156,156,
+129,147,117,31,251,42,6,154,29,208,251,217,6,53,72,73,53,54,72,205,225,30,
+247,217,208,7,247,30,29,251,41,204,29,167,251,217,6,251,7,227,51,247,8,247,
+8,228,227,247,7,30,11,248,162,247,87,21,147,7,146,7,247,20,39,234,251,26,
+251,24,37,45,251,13,251,24,247,1,37,247,31,236,247,11,187,177,155,29,11,247,
+196,248,211,160,29,133,88,21,247,6,230,251,0,251,29,251,26,48,251,2,251,4,
+251,3,247,46,29,11,214,29,176,127,209,45,29,11,248,50,22,240,6,247,121,29,
+247,148,6,103,29,198,4,235,29,11,248,82,22,221,248,4,5,154,6,161,150,148,
+156,156,129,147,116,31,251,3,6,117,129,131,122,173,29,183,6,75,251,181,56,
+247,129,5,80,6,57,251,129,73,247,181,5,185,166,29,251,3,6,117,129,131,122,
+173,29,154,6,223,252,4,5,198,6,225,247,136,226,251,136,5,11,247,196,248,69,
+21,251,26,36,41,251,19,251,16,243,39,247,22,247,22,242,238,247,18,247,15,
+36,240,251,19,31,133,88,165,29,11,247,218,156,29,251,47,6,130,29,247,254,
+49,29,251,47,6,11,247,65,248,55,21,58,6,117,129,131,122,173,29,168,251,209,
+247,127,29,150,247,88,29,99,247,133,6,214,200,164,154,200,27,175,158,133,
+121,161,31,163,119,151,116,112,26,251,129,111,7,247,32,29,247,1,202,29,110,
+247,136,6,217,69,199,47,78,103,121,83,86,30,11,247,147,248,55,21,251,13,6,
+118,127,130,123,123,151,129,160,31,208,251,209,48,6,118,127,129,124,122,247,
+93,29,247,209,6,159,151,148,156,154,127,149,119,31,251,66,247,100,6,236,247,
+0,172,161,182,27,159,157,130,115,163,31,132,147,142,137,148,27,154,150,150,
+155,149,133,148,120,154,31,162,112,117,148,108,27,87,92,113,61,51,31,11,21,
+124,128,128,123,76,204,91,224,225,122,29,135,29,247,125,248,148,21,230,6,
+247,30,29,251,126,6,154,29,230,252,97,48,6,130,29,248,93,247,95,6,159,130,
+150,122,122,130,128,119,30,251,44,251,154,7,11,127,210,128,159,133,163,124,
+8,165,123,155,109,107,26,70,72,88,48,51,69,186,201,134,30,159,138,131,148,
+123,27,122,130,128,118,31,251,1,80,29,153,7,99,180,196,117,204,27,247,16,
+227,210,237,191,115,183,99,163,31,108,158,111,147,61,152,78,149,113,147,115,
+155,8,115,154,126,164,168,26,202,197,184,219,214,197,98,83,144,30,119,140,
+148,130,247,91,29,240,7,159,130,150,122,122,131,128,119,30,11,247,222,247,
+58,21,247,48,247,237,5,252,96,70,7,118,128,130,123,122,151,130,159,31,247,
+42,6,181,29,110,248,97,159,6,247,30,29,35,6,251,43,251,226,251,45,247,226,
+5,36,6,130,29,159,252,97,110,6,118,128,130,123,122,151,130,159,31,247,42,
+49,29,70,248,95,6,247,50,251,236,5,14,247,218,188,21,97,172,181,116,182,27,
+173,170,152,172,181,31,164,158,147,149,151,26,152,127,151,126,133,133,137,
+135,134,30,96,92,119,127,110,27,77,89,206,232,130,31,247,150,6,138,186,137,
+158,132,173,8,227,120,87,189,68,27,91,98,113,91,110,31,185,116,96,167,92,
+27,108,107,131,122,100,31,116,129,130,130,126,26,127,151,126,150,145,146,
+142,144,148,30,154,167,166,147,165,27,185,176,105,95,31,87,7,146,115,109,
+143,113,27,32,58,84,66,52,204,75,227,181,176,158,178,175,31,129,7,118,148,
+128,155,156,148,150,160,30,88,222,21,82,94,107,116,103,27,81,98,176,191,161,
+145,154,152,152,31,159,162,194,157,181,27,159,169,134,132,162,31,190,185,
+21,228,151,175,186,194,27,173,167,121,106,156,31,149,119,146,115,144,98,8,
+11,247,218,248,239,21,251,55,6,117,128,130,123,122,150,130,161,31,247,3,252,
+137,251,47,6,130,29,247,254,49,29,251,47,6,11,6,220,29,11,247,84,248,55,21,
+247,4,7,217,29,251,150,6,63,202,89,237,186,195,150,157,187,30,176,153,155,
+152,154,26,153,128,150,125,134,135,138,133,130,30,117,100,70,123,84,27,73,
+98,169,186,31,247,148,247,106,7,161,150,242,29,11,165,108,29,36,136,29,164,
+251,77,134,6,116,140,127,156,92,235,8,246,87,122,154,75,27,112,132,131,108,
+31,85,7,115,148,127,156,155,149,151,160,30,185,7,160,136,149,125,177,62,164,
+85,164,96,152,124,111,122,108,96,113,78,83,251,27,24,112,107,29,171,6,168,
+140,141,140,150,165,196,247,29,24,171,212,175,180,169,136,8,148,251,117,114,
+136,29,242,108,29,113,247,117,148,6,170,142,175,98,171,66,196,251,29,24,150,
+112,140,139,169,138,8,11,80,27,251,29,41,44,251,25,251,21,235,47,247,27,206,
+205,158,175,192,31,169,159,154,157,153,111,29,11,21,160,151,148,155,155,128,
+148,117,31,251,128,247,10,29,14,247,54,29,247,3,29,129,136,135,130,26,124,
+247,0,29,248,135,248,106,21,183,29,247,77,186,108,29,251,37,6,114,125,247,
+86,29,185,252,97,93,107,29,247,37,96,29,11,247,184,247,77,21,251,26,92,7,
+118,128,130,123,122,151,130,159,31,247,243,247,28,6,158,129,152,123,121,131,
+130,116,30,54,251,92,247,108,206,118,7,119,148,127,155,155,148,150,160,30,
+233,7,160,131,150,122,122,131,128,118,30,117,72,247,86,247,72,35,80,29,247,
+47,252,68,7,154,29,195,6,251,22,252,97,5,107,6,247,32,29,242,49,29,120,6,
+177,247,26,5,247,24,190,21,251,9,6,215,247,168,5,180,6,11,247,224,247,180,
+21,247,67,247,116,5,151,6,161,150,168,29,150,148,156,156,128,147,118,31,251,
+2,6,118,128,130,123,122,151,130,159,31,151,6,247,68,251,116,251,76,251,129,
+5,124,6,118,128,130,123,122,151,130,159,31,247,23,186,29,247,111,29,156,155,
+128,148,117,31,125,6,14,247,34,187,21,94,188,187,120,201,27,247,33,247,4,
+247,23,247,57,214,116,209,97,193,31,206,222,5,148,149,140,142,145,26,152,
+128,149,127,130,135,137,127,129,30,77,61,5,185,86,95,156,79,27,251,35,251,
+4,251,22,251,57,63,159,78,184,78,31,72,57,5,132,129,137,136,132,26,127,149,
+129,152,147,145,143,148,147,30,203,247,45,21,108,188,124,188,196,26,247,27,
+230,247,2,247,3,186,177,123,103,179,30,170,104,21,170,89,154,90,80,26,251,
+26,48,251,2,251,3,92,101,155,176,99,30,11,60,29,14,247,219,190,21,248,97,
+170,29,252,97,40,7,230,29,11,247,47,172,21,105,184,184,124,195,27,247,22,
+242,238,247,17,195,120,189,101,181,31,199,199,5,148,148,142,144,146,26,152,
+129,149,126,131,136,137,129,129,30,78,77,5,171,96,93,154,84,27,251,22,36,
+40,251,17,84,157,92,176,96,31,76,76,5,131,130,136,134,132,26,127,149,129,
+152,146,144,142,147,148,30,247,241,247,243,21,166,106,153,102,98,26,42,59,
+62,38,96,108,149,163,103,30,106,170,21,113,172,126,175,179,26,235,219,216,
+240,181,168,130,116,175,30,11,26,153,129,149,124,130,134,136,131,131,30,77,
+85,91,114,71,27,251,7,41,237,247,8,31,208,7,247,6,226,231,247,1,225,215,90,
+81,144,30,218,29,11,248,67,247,158,21,251,107,91,7,247,32,29,247,32,49,29,
+99,248,97,159,6,160,150,148,156,156,128,147,118,90,29,6,11,248,4,247,143,
+21,107,140,5,61,84,171,185,179,178,164,202,161,157,137,135,152,31,129,172,
+139,139,144,27,152,149,151,154,149,134,147,129,144,31,148,121,96,147,106,
+27,47,72,91,72,104,160,105,174,120,31,150,133,148,135,161,133,8,59,120,101,
+102,80,26,64,204,91,243,185,192,149,152,170,30,153,146,145,146,151,26,154,
+130,149,125,135,136,138,137,133,30,122,89,121,136,96,27,61,97,164,184,194,
+196,173,228,31,163,6,146,6,147,138,5,11,238,247,158,21,251,107,110,7,130,
+29,247,113,6,247,17,136,247,2,247,11,247,30,26,193,7,247,31,251,2,247,11,
+251,17,136,30,251,113,6,154,29,168,251,87,67,6,130,29,247,16,247,138,21,247,
+30,6,234,146,224,49,144,251,4,8,67,7,136,36,53,46,49,141,8,251,36,247,107,
+247,49,6,181,29,251,49,6,14,6,165,153,148,155,156,125,148,113,31,11,247,63,
+248,239,21,38,6,130,29,188,252,137,247,127,29,151,148,156,155,128,148,117,
+31,99,247,135,6,166,169,156,158,145,144,8,163,168,166,149,177,247,4,29,130,
+29,247,24,49,29,99,247,132,6,221,70,199,44,79,98,119,86,91,30,11,248,177,
+247,108,21,213,247,58,5,143,146,140,145,145,26,152,129,149,126,126,131,132,
+121,131,30,89,251,6,5,236,96,63,190,40,27,251,22,36,39,251,16,251,17,243,
+39,247,20,201,199,164,181,176,31,160,164,153,161,160,184,190,251,18,24,115,
+148,146,132,154,27,153,149,149,152,146,137,146,135,150,31,251,15,247,74,21,
+120,95,5,43,98,86,98,59,27,41,58,217,235,235,219,216,240,215,198,100,69,170,
+31,11,247,36,29,151,161,30,193,7,171,131,146,101,71,122,128,43,58,30,94,85,
+126,132,87,138,8,115,247,10,182,6,164,153,148,155,156,126,148,113,31,251,
+30,6,113,125,130,122,123,153,130,165,31,182,251,209,96,6,113,125,130,122,
+123,153,130,165,31,247,30,108,29,96,247,40,163,6,218,138,168,124,182,77,207,
+40,24,149,122,146,135,164,138,8,11,247,218,22,247,83,247,136,29,36,6,117,
+128,130,122,123,247,93,29,164,251,209,251,142,247,209,164,6,160,151,148,155,
+156,128,148,117,31,36,72,29,165,251,209,99,89,29,247,83,40,6,116,148,126,
+156,156,148,152,163,30,14,179,29,133,88,165,29,11,6,247,33,29,11,247,59,248,
+4,21,205,6,161,150,242,29,73,192,6,185,166,173,174,153,157,136,132,163,30,
+135,150,140,139,142,27,152,150,150,153,150,132,148,127,144,31,147,118,103,
+146,118,247,142,29,247,88,49,29,73,6,11,247,42,248,55,21,38,6,117,129,131,
+122,173,29,188,252,135,125,29,65,91,115,78,88,31,247,62,173,21,238,215,69,
+48,247,27,29,21,124,130,131,126,127,147,131,155,31,190,247,108,29,117,147,
+159,110,30,144,133,135,140,134,27,128,130,130,128,114,203,109,191,207,195,
+188,199,174,121,168,101,163,31,169,159,153,162,169,26,192,93,179,79,90,82,
+108,112,129,148,130,150,147,142,141,148,147,30,155,154,162,148,168,27,176,
+167,117,109,110,113,118,103,31,14,248,64,248,148,21,252,97,91,205,29,247,
+32,6,160,151,148,155,156,127,148,118,31,99,248,97,179,6,160,151,148,156,155,
+127,148,118,31,252,76,89,29,179,252,97,99,89,29,247,33,137,29,90,248,97,6,
+14,123,29,150,128,153,146,145,141,146,210,29,120,29,167,147,164,29,247,83,
+248,55,21,59,6,117,128,130,123,122,150,130,161,31,167,200,29,247,132,6,212,
+201,167,157,194,27,205,184,101,83,31,252,74,80,29,248,81,7,217,69,199,49,
+81,101,122,90,87,30,11,7,247,34,29,11,165,153,148,156,155,125,148,113,31,
+251,17,6,113,125,130,123,122,153,130,165,31,176,251,18,6,96,70,89,123,79,
+27,80,116,161,197,31,244,185,7,164,153,148,155,156,125,148,114,31,251,25,
+6,113,125,130,122,123,153,130,165,31,174,34,6,85,153,105,168,121,30,123,164,
+175,131,180,27,198,197,156,172,190,31,11,21,149,147,143,147,148,26,153,129,
+149,125,131,133,136,131,129,30,251,5,43,5,128,131,135,132,129,26,125,149,
+129,154,147,146,142,147,148,30,251,6,216,21,114,119,120,114,247,48,29,247,
+151,22,113,119,120,114,247,73,29,159,163,163,119,159,115,31,14,238,190,21,
+110,6,130,29,247,113,6,247,22,138,243,247,4,140,247,35,8,194,7,138,247,35,
+35,247,4,251,22,138,8,251,113,6,154,29,168,6,191,252,97,21,248,97,247,30,
+7,234,146,224,49,144,251,3,8,67,7,137,35,53,46,48,141,8,11,21,247,17,6,153,
+148,147,152,151,130,147,125,31,251,58,251,47,6,126,147,130,151,144,143,140,
+143,146,30,149,157,166,146,159,27,180,167,110,95,88,106,104,91,109,112,151,
+161,114,31,144,133,135,141,133,27,128,130,130,127,113,207,104,189,211,189,
+191,213,206,94,187,77,118,122,136,130,114,31,14,21,247,6,29,247,113,153,29,
+185,182,171,202,176,168,136,131,197,30,138,146,143,139,141,27,155,150,149,
+154,152,131,148,125,142,31,146,107,70,145,99,27,47,72,85,64,31,84,57,247,
+11,29,221,251,209,47,6,247,32,29,247,208,49,29,11,222,29,148,145,136,146,
+27,154,150,150,154,147,139,139,125,154,31,14,248,162,247,97,21,148,49,29,
+251,86,204,29,247,25,251,30,6,114,84,108,132,88,27,251,34,54,218,247,23,31,
+211,7,194,166,200,182,179,30,174,176,182,155,194,27,225,208,102,91,144,31,
+119,140,147,130,155,27,156,148,11,6,118,127,247,35,29,11,31,251,12,167,29,
+187,251,87,251,150,247,87,187,166,29,251,12,6,154,29,159,252,97,99,6,247,
+32,29,247,32,49,29,91,247,107,11,21,251,62,251,27,251,23,251,58,251,54,247,
+27,251,25,247,59,247,58,247,27,247,25,247,55,247,54,251,27,247,26,251,55,
+31,133,88,21,247,33,247,3,251,0,251,29,251,27,251,4,251,2,251,29,251,30,251,
+4,247,2,247,27,247,26,247,4,247,3,247,27,31,14,117,31,83,6,247,143,248,135,
+5,149,6,161,150,242,29,251,2,6,118,128,11,251,41,247,209,155,203,29,55,6,
+117,128,130,122,123,150,130,161,31,155,251,209,251,41,247,209,155,6,161,151,
+148,155,156,128,148,116,31,54,6,130,29,156,251,209,113,72,29,11,176,188,26,
+223,63,203,39,30,251,151,6,154,29,188,6,191,251,87,21,247,87,247,51,7,208,
+193,97,85,81,81,98,57,31,251,34,251,158,21,247,107,247,36,7,199,171,133,121,
+170,31,175,118,160,107,105,26,81,86,93,71,30,14,6,117,128,130,122,123,247,
+93,29,164,251,15,251,142,247,15,164,6,160,151,148,155,156,128,148,117,31,
+36,72,29,165,200,29,247,35,11,174,29,197,66,29,83,6,69,247,27,105,203,102,
+182,106,153,25,168,170,146,150,181,247,53,29,11,103,31,158,107,125,143,141,
+29,163,27,163,160,149,165,166,31,158,157,144,146,149,26,152,127,150,125,30,
+14,6,247,31,29,11,247,125,248,148,21,247,154,251,44,6,247,36,29,150,159,30,
+247,95,252,93,205,29,230,252,97,48,6,226,29,6,14,208,29,177,167,113,105,108,
+111,115,102,102,111,163,170,172,168,166,174,229,29,11,114,29,247,135,247,
+146,21,69,251,5,209,6,14,31,171,6,251,153,251,120,5,247,120,208,7,160,151,
+242,29,251,62,6,118,128,131,122,247,132,29,247,62,49,29,70,6,11,212,68,192,
+43,101,74,126,120,84,247,61,29,142,140,143,152,30,157,196,181,147,171,27,
+209,187,109,94,31,77,7,154,79,114,142,94,27,251,22,52,79,50,62,204,86,235,
+208,194,161,192,201,31,11,21,54,113,112,131,132,136,8,131,135,134,133,130,
+26,129,148,129,150,142,142,139,140,142,30,201,159,5,251,151,7,140,117,115,
+139,125,27,118,128,132,124,127,149,131,152,31,247,71,6,152,148,147,152,151,
+130,147,125,31,71,6,11,30,247,21,117,29,100,251,26,247,87,247,174,216,29,
+252,71,7,118,128,131,122,247,132,29,11,6,106,138,135,136,136,106,131,251,
+5,24,138,126,139,139,138,26,122,149,129,154,156,148,151,164,140,30,147,242,
+5,247,19,252,97,93,107,29,247,31,108,29,98,11,6,114,125,130,122,123,153,130,
+164,31,11,6,164,153,148,155,156,125,148,114,31,11,21,247,27,247,1,5,153,149,
+141,143,149,26,153,127,150,125,133,133,136,133,247,87,29,145,131,11,251,13,
+6,116,129,131,122,122,150,130,161,31,208,251,140,6,82,85,81,111,74,27,91,
+101,175,186,31,247,193,38,7,117,129,131,122,173,29,188,251,142,6,58,195,86,
+222,203,196,163,189,194,30,11,26,152,128,150,126,131,134,137,130,130,30,93,
+89,78,143,29,11,131,247,24,29,151,151,141,141,148,26,153,128,150,124,132,
+131,243,29,146,142,147,147,30,14,8,225,168,186,190,203,26,224,54,212,39,30,
+251,141,6,118,128,131,122,247,132,29,247,62,49,29,70,11,248,48,248,4,161,
+29,251,179,7,116,129,131,122,122,150,130,161,31,11,165,7,166,153,132,126,
+126,123,130,116,125,125,143,149,118,31,144,129,137,140,133,247,90,29,132,
+155,132,31,129,159,171,131,160,219,29,6,164,153,148,156,155,125,148,114,31,
+11,7,247,72,29,128,118,30,11,247,102,121,29,11,247,38,29,137,140,179,87,31,
+183,83,124,247,58,29,125,247,56,29,193,11,247,22,29,143,158,175,29,11,21,
+251,103,247,89,5,147,130,131,143,131,27,125,128,128,125,130,140,137,150,127,
+31,247,31,251,53,251,31,251,54,5,128,127,138,137,130,26,125,150,128,153,148,
+146,142,148,148,30,11,159,29,103,134,98,114,11,247,1,29,127,130,136,135,128,
+26,125,11,27,75,115,171,225,31,247,49,188,7,164,153,148,155,156,125,148,114,
+31,251,31,107,29,177,251,53,6,71,153,96,168,116,30,119,164,176,128,11,90,
+6,130,29,247,85,98,29,47,247,116,6,82,185,194,113,212,27,247,18,236,232,247,
+11,247,12,43,230,251,20,11,123,29,151,128,152,146,150,29,149,137,143,125,
+150,31,14,123,29,150,128,154,145,150,29,149,137,143,125,150,31,14,247,140,
+29,86,27,85,247,50,29,248,171,248,62,21,151,146,143,145,148,26,151,128,150,
+128,134,133,137,134,131,30,252,83,251,173,5,127,132,135,133,129,26,127,149,
+128,152,144,141,140,146,150,30,14,118,128,130,123,173,29,11,163,29,202,164,
+185,188,30,167,165,151,155,11,154,125,159,154,148,145,158,150,30,247,34,247,
+134,5,217,22,68,251,116,5,137,134,139,136,135,26,122,155,125,158,154,148,
+145,158,150,30,247,34,247,134,5,14,193,29,136,131,247,24,29,152,151,140,141,
+148,26,153,128,150,124,11,21,148,129,135,141,131,27,125,128,128,125,130,143,
+132,148,131,247,29,29,146,27,154,150,150,154,147,139,140,130,147,31,134,145,
+5,14,85,27,86,247,50,29,6,113,126,130,122,123,153,130,164,31,11,6,160,150,
+148,155,156,128,148,118,31,11,21,247,26,166,29,251,212,6,154,29,247,26,252,
+97,251,26,6,130,29,11,128,118,30,251,25,251,193,7,247,218,248,84,5,203,251,
+252,251,54,80,29,247,3,247,147,7,251,217,252,83,5,74,7,11,247,185,187,29,
+108,109,115,162,167,167,163,162,169,31,11,118,27,113,116,128,112,110,31,124,
+126,133,129,130,26,125,150,129,247,77,29,158,27,149,150,135,128,158,31,115,
+180,158,132,11,21,247,6,29,247,112,153,29,116,67,27,33,64,209,240,244,212,
+210,246,221,206,101,89,145,31,119,141,147,131,154,27,156,148,150,159,31,229,
+7,160,130,150,122,122,131,128,118,30,11,21,145,148,141,144,145,26,153,127,
+150,125,247,8,29,133,131,137,134,133,247,49,29,195,29,153,151,150,153,148,
+139,139,124,154,31,14,21,151,149,141,143,247,3,29,129,136,135,129,26,125,
+247,0,29,247,44,29,14,21,75,89,89,76,77,190,88,201,201,247,81,29,180,171,
+107,97,98,107,106,99,98,107,172,180,180,171,172,179,31,11,247,191,248,137,
+21,251,27,247,67,29,247,31,247,29,247,2,247,4,247,31,247,31,251,2,247,3,251,
+30,31,11,247,14,29,133,148,145,136,145,27,153,151,150,153,11,127,6,251,37,
+247,209,5,196,166,29,251,44,6,117,129,131,122,173,29,177,6,247,60,252,4,5,
+11,247,58,29,126,247,56,29,192,182,149,147,164,27,154,157,130,120,163,31,
+11,22,247,6,29,14,118,128,131,122,173,29,11,153,128,150,125,133,135,137,133,
+131,30,109,99,67,117,79,27,35,61,203,235,125,31,190,4,221,156,211,193,231,
+27,230,212,84,58,155,31,11,248,55,21,251,57,6,117,129,131,122,173,29,247,
+5,251,209,11,31,175,120,160,108,103,26,106,123,108,112,118,30,116,108,96,
+128,75,27,66,87,155,182,66,31,144,131,133,141,132,27,127,125,126,126,11,199,
+26,229,58,201,251,8,75,90,122,100,91,30,134,133,136,138,137,27,134,135,147,
+155,136,31,161,135,131,149,124,27,125,130,130,124,11,204,187,202,155,128,
+150,124,124,131,131,121,137,31,11,21,251,38,251,4,251,21,251,59,207,29,11,
+21,252,26,7,74,138,94,95,76,27,251,20,204,29,247,21,6,230,137,210,210,137,
+230,8,248,77,11,247,5,29,130,136,140,133,247,90,29,133,155,131,31,129,159,
+11,248,109,248,151,21,178,93,81,160,75,27,72,78,113,91,93,31,95,93,110,69,
+78,26,58,7,251,28,247,18,251,15,247,31,204,11,144,157,27,150,150,135,128,
+158,31,115,180,157,132,162,27,164,160,149,165,166,31,159,158,143,145,149,
+26,153,127,150,125,30,14,21,247,7,29,11,6,160,151,242,29,11,6,117,128,131,
+122,122,247,93,29,11,242,29,251,3,6,154,29,174,6,251,35,251,75,251,36,247,
+75,5,171,6,160,11,182,128,116,247,80,29,71,30,14,247,47,73,7,120,150,125,
+155,156,147,149,162,30,247,9,252,103,251,9,247,101,29,205,247,48,11,247,95,
+247,45,199,29,14,247,68,29,169,114,163,110,31,11,122,150,130,160,31,11,116,
+29,92,247,117,164,6,220,137,166,119,188,49,211,251,30,24,114,153,140,138,
+167,27,11,104,31,157,107,125,144,118,27,112,117,128,112,110,31,124,126,133,
+129,129,26,127,150,128,153,147,147,142,145,144,30,168,11,127,150,125,131,
+134,136,131,130,30,251,7,42,5,129,130,136,133,131,26,124,150,247,116,29,130,
+165,31,165,6,247,49,200,119,86,88,76,108,38,62,79,152,170,72,31,144,130,134,
+140,134,27,126,126,126,125,11,247,59,29,129,136,247,21,29,163,11,247,196,
+248,69,21,251,26,36,41,251,19,251,16,243,39,247,22,247,22,242,238,247,17,
+247,16,36,240,251,19,31,11,152,146,145,141,146,210,29,160,150,247,88,29,11,
+187,29,109,11,241,29,170,131,147,107,61,120,124,34,75,30,76,34,128,130,81,
+137,8,114,11,165,247,9,29,11,5,160,6,158,152,247,89,29,251,3,167,29,170,6,
+251,32,11,49,29,86,6,247,45,247,88,247,46,251,88,5,89,6,117,128,130,123,122,
+11,21,83,95,97,87,87,183,97,194,239,29,11,25,229,98,29,87,6,67,247,75,101,
+190,47,179,247,106,247,79,24,153,6,11,247,11,190,21,90,6,130,29,247,199,6,
+233,215,209,225,203,98,188,61,168,31,11,247,8,29,131,128,138,137,133,26,125,
+151,127,153,150,144,142,153,148,30,14,248,137,247,144,21,247,31,29,252,38,
+6,247,119,29,233,29,150,137,142,126,150,31,14,128,150,124,247,106,29,127,
+137,11,247,63,247,158,21,247,26,100,6,247,36,29,11,21,148,130,247,107,29,
+133,150,130,247,29,29,146,27,11,247,207,21,228,247,95,5,152,169,141,146,153,
+26,161,122,156,115,106,128,122,73,127,30,103,251,102,5,11,247,27,113,199,
+108,183,111,155,25,151,153,166,186,163,191,174,212,152,157,160,142,8,93,7,
+118,149,127,11,131,132,243,29,145,142,147,148,30,14,21,68,251,141,5,138,135,
+138,135,135,26,120,154,124,159,154,147,145,160,151,30,247,41,247,160,5,11,
+251,209,99,89,29,247,24,6,160,151,148,155,156,127,148,118,31,99,11,248,148,
+21,188,6,160,150,148,156,155,127,148,119,31,11,6,159,151,247,88,29,11,6,161,
+150,148,155,156,128,148,117,31,11,6,117,128,131,122,122,150,130,161,31,11,
+7,247,33,29,11,7,98,116,120,112,102,26,98,169,115,191,181,179,159,160,150,
+130,148,129,136,135,138,136,135,30,11,251,57,247,5,251,22,247,33,247,35,247,
+41,29,31,11,30,107,117,124,112,105,26,81,189,92,201,201,189,186,197,173,124,
+166,107,161,30,73,247,26,21,11,247,87,29,146,130,134,141,133,27,124,128,247,
+115,29,247,2,29,149,137,143,126,150,31,14,249,102,21,148,130,134,141,132,
+27,124,128,128,125,130,143,133,149,130,31,247,6,42,5,131,11,21,149,148,142,
+145,147,26,154,128,150,125,131,135,247,28,29,130,136,11,48,7,231,29,48,11,
+248,77,248,160,21,174,99,93,155,83,27,251,0,58,71,50,95,159,99,173,116,31,
+170,117,11,247,168,145,21,71,251,29,5,251,16,6,118,128,11,48,80,29,247,34,
+11,160,130,149,122,122,130,128,119,30,251,4,70,7,117,128,131,122,122,150,
+130,161,31,208,11,120,141,147,130,155,27,156,148,150,160,31,247,2,7,160,130,
+149,122,122,130,128,119,30,11,27,189,173,167,180,177,115,163,98,142,31,14,
+160,151,148,156,155,128,148,117,31,11,247,74,29,129,137,140,133,247,90,29,
+11,21,148,129,247,107,29,133,150,130,31,247,6,42,5,131,11,30,251,242,252,
+46,5,131,131,137,134,133,26,127,149,129,151,148,141,141,151,149,30,11,74,
+230,92,204,127,149,101,152,25,160,156,156,157,169,175,191,201,145,142,181,
+141,8,11,247,67,29,247,32,247,28,247,3,247,4,247,31,11,118,128,130,122,122,
+150,131,160,31,247,126,6,160,150,147,156,156,128,148,118,31,48,11,159,161,
+163,173,106,163,91,105,112,129,117,114,31,116,118,135,133,115,82,8,14,146,
+233,29,11,31,251,47,4,180,170,112,104,103,108,111,99,99,108,167,175,174,170,
+166,178,31,11,247,32,29,247,142,49,29,11,119,127,130,122,123,151,130,159,
+31,247,126,247,9,29,11,6,222,190,152,165,164,31,159,160,152,173,173,26,216,
+74,179,251,19,30,50,11,145,141,146,247,2,29,11,155,128,150,124,122,130,128,
+118,30,58,7,118,148,128,156,155,148,150,159,30,11,79,74,87,116,70,27,72,97,
+170,187,197,209,179,239,183,187,134,131,172,31,11,247,83,29,114,31,247,98,
+22,114,119,120,114,11,132,132,136,131,130,30,251,5,247,79,29,11,140,143,143,
+26,148,134,146,128,145,30,251,237,247,80,247,238,247,80,5,11,193,183,181,
+191,190,95,182,86,31,137,96,21,170,163,117,110,111,115,116,11,35,124,30,87,
+22,35,154,66,217,237,26,236,211,217,244,154,30,14,116,148,126,156,156,148,
+152,164,30,191,7,11,148,156,156,128,147,117,31,11,136,132,132,30,41,47,5,
+127,247,94,29,11,21,163,158,120,116,115,120,120,116,115,120,158,163,161,158,
+159,162,31,11,21,167,95,105,155,124,27,132,132,131,130,133,143,134,151,128,
+31,174,11,115,148,126,156,156,148,152,164,30,213,7,138,172,133,144,106,140,
+8,11,150,128,154,146,144,141,148,149,30,14,21,251,27,251,1,5,11,147,30,243,
+223,244,55,5,133,147,145,136,145,27,153,151,150,153,11,247,110,29,129,30,
+251,6,42,5,128,11,27,178,159,133,121,161,31,163,120,151,116,111,26,251,129,
+99,7,11,165,7,166,153,132,126,247,74,29,11,108,114,115,108,109,164,115,170,
+169,164,163,170,168,114,164,109,31,11,243,219,64,40,43,59,62,38,38,58,216,
+236,234,219,217,238,31,11,129,133,135,127,130,30,55,251,16,5,11,6,159,151,
+148,155,156,128,148,118,31,11,6,118,128,130,123,123,151,130,159,31,11,7,117,
+128,130,123,122,150,130,161,31,11,7,118,127,130,122,123,247,93,29,11,7,159,
+130,150,122,122,130,128,119,30,11,145,142,145,147,30,243,223,243,55,5,11,
+130,128,118,30,107,7,33,113,84,88,85,103,196,226,227,163,11,30,247,95,252,
+65,247,102,29,230,11,120,7,109,131,135,122,127,148,131,153,31,225,6,153,149,
+147,11,248,207,21,69,251,5,209,6,14,129,149,127,131,136,137,128,130,30,251,
+243,252,46,5,133,11,6,123,140,127,129,124,26,136,7,124,151,129,155,140,30,
+11,135,138,136,135,30,126,116,134,137,121,27,113,127,148,158,11,21,132,134,
+137,132,132,31,109,247,92,29,11,247,52,29,127,150,125,131,134,136,131,11,
+247,76,29,247,131,231,21,11,31,247,42,6,160,151,148,155,156,127,148,118,31,
+70,6,11,247,218,177,21,247,27,154,233,238,247,20,26,247,19,45,11,50,63,68,
+43,42,63,210,229,227,215,211,233,31,14,137,130,129,30,251,6,42,5,128,11,31,
+247,6,42,5,131,148,145,136,11,160,150,148,156,156,128,147,118,31,11,161,150,
+148,156,155,128,148,117,31,11,117,128,247,35,29,11,118,128,130,122,123,150,
+130,160,31,11,118,148,128,156,156,148,150,160,30,11,130,123,122,247,93,29,
+11,119,148,128,156,156,148,11,132,150,31,224,6,150,147,146,149,149,132,145,
+127,31,11,21,126,135,135,117,122,31,106,115,117,123,117,27,123,11,21,251,
+43,101,134,113,94,31,70,98,97,63,55,26,11,184,176,8,146,145,142,143,146,26,
+148,132,146,131,124,11,247,4,247,22,247,58,247,55,251,4,247,24,251,31,11,
+151,150,154,147,138,140,131,147,31,133,145,5,14,6,51,102,132,113,100,31,71,
+94,104,64,39,26,11,131,161,27,189,173,167,180,177,115,163,98,142,31,11,21,
+251,34,6,247,36,251,129,5,121,149,150,132,11,48,247,2,247,27,247,25,230,247,
+3,247,1,31,11,251,2,7,115,148,126,156,156,148,152,162,30,238,11,114,159,120,
+164,164,159,159,163,163,119,159,114,31,11,26,125,151,127,153,149,144,142,
+153,148,30,14,98,165,174,134,31,157,137,131,147,124,27,14,135,138,121,27,
+112,127,148,158,11,21,152,150,141,142,148,26,154,11,208,190,224,148,147,182,
+141,8,11,21,151,150,141,142,11,127,148,119,31,90,248,97,188,6,159,151,148,
+11,129,26,126,150,128,153,148,145,143,149,147,30,11,247,47,247,33,21,247,
+182,247,177,251,182,6,11,147,106,27,104,113,124,99,104,31,117,115,131,11,
+26,98,169,115,190,181,179,159,160,150,130,148,11,152,160,180,204,150,150,
+165,141,8,115,7,118,11,30,125,134,132,131,127,26,125,150,128,152,144,11,30,
+55,251,15,5,133,131,137,133,134,26,124,11,159,27,160,150,151,167,143,31,173,
+247,146,5,11,169,26,194,91,184,81,81,91,94,84,109,153,11,172,82,8,121,149,
+143,135,146,27,146,144,142,11,66,102,74,95,68,27,75,77,177,202,101,31,11,
+251,5,251,4,251,27,251,34,247,2,251,4,11,108,114,115,109,109,164,115,169,
+170,163,163,169,11,6,118,148,128,156,155,148,150,160,30,14,6,118,127,130,
+123,122,11,27,115,129,149,163,31,11,160,130,150,122,122,130,11,115,159,119,
+164,164,159,11,126,123,130,116,125,124,143,149,119,31,144,11,148,150,160,
+31,207,7,160,130,150,123,125,11,26,124,150,128,154,146,146,142,147,147,30,
+11,153,147,147,142,145,144,30,168,167,147,144,11,30,107,165,175,121,175,27,
+184,176,162,180,11,43,5,129,131,135,132,131,26,125,151,127,11,170,31,164,
+119,153,112,110,26,80,86,93,11,189,190,201,201,89,190,78,31,137,100,21,11,
+251,19,26,251,20,233,40,247,27,124,30,11,247,73,29,158,164,163,119,159,11,
+176,135,31,158,137,131,148,123,27,14,130,26,124,150,128,154,146,11,130,123,
+122,153,130,164,31,11,130,30,35,55,35,223,5,11,148,156,155,128,148,118,31,
+11,149,155,155,127,148,119,31,11,27,125,128,129,125,127,144,11,154,27,156,
+148,150,160,31,11,110,130,133,124,27,127,130,11,151,130,160,31,11,128,137,
+136,247,85,29,11,6,157,148,146,153,152,130,146,121,31,11,6,160,150,148,155,
+155,128,148,118,31,11,6,117,128,130,123,123,151,129,160,31,11,6,117,148,128,
+156,156,148,150,161,30,11,6,119,127,130,122,123,151,130,159,31,11,6,121,130,
+132,126,125,148,132,157,31,11,7,117,148,128,156,156,148,150,161,30,11,7,118,
+128,130,122,123,151,130,159,31,11,7,120,149,128,155,155,149,150,158,30,11,
+7,160,130,150,123,122,130,128,118,30,11,7,216,201,87,75,74,70,85,55,31,11,
+132,132,136,132,131,30,42,47,5,127,11,134,141,132,27,124,128,128,125,130,
+142,11,137,177,109,101,26,102,101,108,95,108,11,21,251,111,6,243,247,169,
+5,147,6,11,148,26,154,128,150,124,132,134,137,130,11,247,93,29,247,23,6,160,
+151,148,11,157,129,150,123,123,131,131,119,137,31,11,83,196,72,31,136,96,
+21,186,175,103,11,220,71,200,49,80,91,118,94,94,30,11,128,125,128,142,135,
+151,130,31,14,128,153,147,142,141,148,150,30,14,150,153,149,136,144,127,149,
+31,14,84,101,119,36,31,14,130,29,14,89,29,14,181,29,90,11,160,151,148,155,
+156,127,148,118,31,91,11,99,247,120,29,100,6,117,128,130,123,122,150,130,
+161,31,11,6,247,32,29,247,24,6,160,11,130,159,31,247,24,49,29,11,99,247,125,
+29,11,247,148,123,29,11,145,26,151,129,149,127,131,136,137,128,130,30,251,
+243,252,46,5,11,123,29,151,128,152,146,145,11,8,74,247,5,29,11,173,29,188,
+252,97,90,6,130,29,11,247,53,29,96,7,241,29,11,26,153,127,150,125,133,133,
+136,133,247,87,29,145,131,133,142,133,27,11,251,36,21,145,148,141,144,145,
+26,153,127,150,125,247,8,29,11,6,160,151,148,155,156,127,148,118,31,99,247,
+209,184,29,11,36,240,251,19,31,133,88,165,29,14,251,47,6,130,29,247,254,49,
+29,251,47,6,14,251,47,6,130,29,247,254,49,29,251,47,6,137,11,249,94,21,124,
+128,128,123,76,204,91,224,225,122,29,11,21,151,149,141,143,247,3,29,129,136,
+135,247,85,29,11,27,77,89,80,67,31,86,67,7,130,29,211,251,209,61,6,130,29,
+11,249,114,123,29,150,128,153,228,29,11,6,247,3,249,64,54,29,92,29,131,122,
+173,29,185,6,251,45,251,199,251,47,247,199,5,182,166,29,251,7,6,154,29,152,
+6,11,45,29,14,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,1,135,255,2,135,254,2,
+243,2,0,1,0,2,0,3,0,8,0,20,0,152,1,58,1,153,2,19,2,26,2,94,2,161,3,12,3,60,
+3,62,3,64,3,70,3,113,3,205,3,249,4,72,4,189,4,238,5,66,5,175,5,218,6,49,6,
+158,6,177,6,186,6,242,6,248,7,42,7,123,7,252,7,255,8,6,8,21,8,24,8,27,8,76,
+8,79,8,81,8,84,8,86,8,89,8,92,8,94,8,97,8,100,8,102,8,250,8,253,9,0,9,2,9,
+5,9,31,9,34,9,41,9,44,9,47,9,66,9,109,9,127,9,179,9,185,9,215,9,218,10,25,
+10,28,10,31,10,34,10,53,10,60,10,63,10,69,10,71,10,74,10,77,10,176,10,179,
+10,182,10,184,10,253,11,0,11,3,11,6,11,9,11,35,11,38,11,40,11,47,11,50,11,
+142,11,153,11,244,12,22,12,88,12,183,13,27,13,29,13,115,13,211,14,128,15,
+33,15,50,15,89,15,100,15,119,15,124,15,151,15,225,15,235,15,242,16,15,16,
+17,16,111,16,134,16,136,16,154,16,172,16,183,16,205,17,35,17,116,17,122,17,
+128,17,145,17,151,17,157,17,163,17,170,17,176,17,182,17,208,17,223,17,242,
+17,248,17,250,17,253,18,99,18,173,18,176,19,15,19,58,19,61,19,64,19,139,19,
+142,19,251,20,103,20,110,20,132,20,207,21,115,21,117,21,225,22,48,22,109,
+22,214,22,252,23,23,23,66,23,96,23,174,23,245,24,95,24,106,24,239,25,85,25,
+91,25,185,25,198,25,213,25,221,25,228,25,234,26,20,26,123,26,155,26,196,26,
+203,26,217,26,225,26,232,26,240,26,255,27,10,27,18,27,25,27,33,27,40,27,48,
+27,89,27,102,27,110,27,118,27,140,27,167,27,175,27,190,27,204,27,223,27,231,
+27,249,28,11,28,33,28,77,28,84,28,103,28,111,28,119,28,134,28,149,28,157,
+28,185,28,208,28,239,28,246,28,254,29,5,29,62,29,90,29,100,29,108,29,116,
+29,124,29,132,29,139,29,166,30,5,30,30,30,91,30,147,30,208,31,3,31,103,31,
+140,31,220,31,255,32,5,32,81,32,87,32,174,33,8,33,110,33,118,33,168,33,187,
+33,198,33,210,33,217,33,219,33,227,33,236,34,14,34,31,34,40,34,48,34,63,34,
+107,34,114,34,122,34,139,34,147,34,154,34,161,34,239,35,8,35,16,35,49,35,
+60,35,69,35,90,35,106,35,117,35,137,35,145,35,152,35,225,35,233,35,241,35,
+253,36,4,36,43,36,55,36,63,36,70,36,82,36,90,36,97,36,110,36,123,36,144,36,
+183,36,190,36,196,36,238,36,248,37,0,37,46,37,53,37,67,37,76,37,92,37,170,
+37,178,37,187,37,224,37,235,38,2,38,10,38,45,38,53,38,68,38,83,38,91,38,103,
+38,132,38,151,38,168,38,176,38,201,38,208,38,217,39,48,39,55,39,62,39,70,
+39,77,39,103,39,120,39,127,39,149,39,157,39,164,39,196,39,209,39,216,39,224,
+39,232,39,248,40,0,40,7,40,43,40,50,40,91,40,138,40,228,41,102,41,225,42,
+74,42,76,42,78,42,80,42,82,43,74,43,167,43,169,43,175,43,231,43,243,43,251,
+44,46,44,74,44,82,44,89,44,96,44,103,44,131,44,139,44,147,44,163,44,170,44,
+178,44,206,44,241,44,249,45,37,45,66,45,135,45,174,45,210,46,39,46,46,46,
+66,46,101,46,121,46,136,46,144,46,151,46,176,46,183,46,184,46,185,47,69,47,
+140,47,194,47,230,48,82,48,152,49,18,49,88,49,154,50,20,50,52,50,103,50,168,
+50,178,50,190,50,212,50,226,50,238,51,52,51,131,51,203,52,17,52,59,52,110,
+52,153,52,167,52,206,53,22,53,74,53,126,53,171,54,94,54,120,55,71,56,64,56,
+93,56,120,56,159,56,199,57,25,57,42,57,96,57,141,57,152,57,198,58,32,58,98,
+58,158,58,179,59,20,59,117,59,180,59,196,60,47,60,143,60,183,60,249,61,48,
+61,173,62,75,62,158,63,20,63,184,64,80,64,102,64,129,64,156,64,197,64,248,
+65,129,65,150,65,172,65,201,65,239,65,245,66,110,66,136,66,140,66,156,66,
+169,66,174,66,199,66,235,67,79,67,129,67,199,68,28,68,42,68,55,68,192,68,
+195,68,197,68,199,68,229,68,231,68,239,68,241,69,17,69,20,69,54,69,106,69,
+108,69,111,69,186,69,189,69,191,69,193,70,5,70,7,70,10,70,64,70,66,70,160,
+71,4,71,7,71,106,71,169,71,251,71,254,72,106,72,109,72,179,72,190,73,14,73,
+66,73,134,73,201,74,93,74,96,74,135,74,210,75,0,75,72,75,75,75,194,76,18,
+76,95,76,98,77,0,77,137,77,191,78,66,78,98,78,116,78,122,78,128,78,193,79,
+9,79,65,79,97,79,171,80,31,80,89,80,155,80,231,81,2,81,9,81,22,81,37,81,80,
+81,105,81,121,81,169,81,240,81,243,82,24,82,26,82,28,82,113,82,115,82,136,
+82,211,82,214,82,217,83,34,83,36,83,38,83,41,83,43,83,45,83,60,83,62,83,65,
+83,231,83,233,84,23,84,48,84,70,84,100,84,120,84,206,85,11,85,147,85,252,
+86,87,86,114,86,199,87,86,87,94,87,97,87,100,87,103,87,105,87,226,88,47,88,
+127,88,174,88,241,89,11,89,14,89,95,89,172,90,59,90,101,90,164,90,253,91,
+30,91,112,91,143,91,183,91,231,91,239,91,244,92,75,92,137,92,177,92,236,93,
+57,93,94,93,127,93,168,93,229,94,88,94,95,94,188,94,220,95,47,95,104,95,188,
+96,42,96,124,96,127,96,205,96,208,97,37,97,82,97,85,97,88,97,160,97,226,97,
+240,97,243,98,15,98,17,98,29,98,66,98,73,98,237,98,239,98,250,99,29,99,93,
+99,158,99,191,100,33,100,111,100,214,100,244,101,57,101,162,101,244,101,250,
+101,252,102,97,102,169,102,209,102,211,102,213,102,232,102,254,103,96,103,
+132,103,201,103,236,104,25,104,81,104,167,104,208,104,231,105,43,105,66,105,
+187,105,195,105,208,106,60,106,85,106,136,106,186,107,5,107,33,107,40,107,
+71,107,127,107,217,108,7,108,59,108,168,108,211,109,7,110,21,110,92,111,55,
+111,58,111,193,112,122,113,42,113,199,114,97,114,200,115,25,115,125,115,233,
+116,71,116,180,117,20,117,105,117,190,118,26,118,111,118,197,118,208,118,
+232,118,255,119,29,119,166,119,193,120,14,120,135,121,1,121,124,122,9,122,
+50,122,113,122,137,122,152,122,170,122,188,122,228,123,2,123,52,123,93,123,
+132,123,158,123,183,123,209,123,235,123,253,124,33,124,76,124,103,124,130,
+14,14,247,236,100,10,14,247,32,248,239,21,234,10,179,22,234,10,14,248,31,
+247,241,21,225,98,29,57,6,154,247,104,5,147,7,153,128,150,124,124,130,129,
+119,138,30,123,251,107,5,59,6,154,247,104,5,159,141,128,152,123,27,123,130,
+129,119,138,31,124,251,107,5,63,98,10,211,6,131,251,5,5,54,49,10,220,6,124,
+251,104,5,130,7,125,140,149,128,153,27,155,148,149,159,140,31,155,247,108,
+5,219,6,124,251,104,138,132,5,125,138,151,126,154,27,155,147,149,159,141,
+31,154,247,108,5,217,49,29,65,6,96,247,5,21,130,251,5,5,59,6,147,247,5,5,
+14,247,167,248,211,21,56,129,78,78,66,26,100,158,102,170,120,30,165,122,169,
+129,203,127,207,126,153,135,161,126,8,162,126,152,115,111,26,81,80,97,56,
+68,75,172,179,134,30,137,156,139,139,134,144,8,143,134,132,142,133,27,122,
+130,128,119,31,61,7,119,148,128,156,156,147,150,159,30,143,7,163,116,192,
+119,178,137,8,251,4,80,29,247,4,7,240,150,204,197,218,26,183,120,175,106,
+161,30,111,158,113,147,66,153,80,150,119,144,120,151,8,118,150,127,161,163,
+26,192,193,182,205,197,193,111,107,145,30,120,142,146,132,247,91,29,198,7,
+160,131,149,122,125,130,130,125,136,30,110,161,113,148,100,144,8,184,117,
+29,14,247,255,247,131,21,68,83,83,69,70,195,83,208,208,195,195,208,208,247,
+113,29,92,94,247,67,10,251,13,248,50,21,68,83,84,68,70,195,83,208,208,195,
+195,209,207,247,113,29,93,93,247,67,10,247,152,251,118,21,152,143,145,146,
+150,26,150,130,149,129,136,134,138,137,134,30,252,15,251,13,5,125,135,133,
+133,128,26,128,149,129,149,144,142,139,141,144,30,14,248,26,22,200,49,29,
+105,6,115,174,157,166,158,182,152,187,25,147,203,10,93,6,127,91,127,103,120,
+103,32,247,58,24,109,187,127,165,160,26,177,176,174,179,162,155,132,119,162,
+30,174,157,5,153,146,144,146,150,26,153,127,151,126,134,134,137,135,131,30,
+131,135,5,152,117,118,145,116,27,69,81,84,72,109,144,128,181,72,31,73,118,
+97,82,71,26,52,208,66,221,184,175,158,179,169,30,110,185,21,105,117,110,119,
+107,27,86,94,190,198,189,170,178,187,151,31,14,247,95,248,239,199,29,14,248,
+74,248,239,21,127,132,132,111,120,31,67,251,2,100,251,7,37,26,39,173,34,208,
+251,1,30,99,163,148,130,152,27,154,150,150,153,144,138,141,136,145,31,71,
+247,12,108,239,244,26,243,170,240,207,247,11,30,142,145,140,141,144,26,153,
+127,150,125,30,14,247,60,248,239,21,124,128,128,125,134,140,137,142,133,31,
+207,251,11,170,38,35,26,34,108,39,71,251,12,30,136,133,138,137,134,26,125,
+151,128,153,151,146,146,167,158,30,211,247,3,178,247,6,241,26,238,105,244,
+70,247,2,30,178,115,130,149,126,27,14,247,166,248,78,21,251,18,178,5,141,
+132,135,140,135,27,126,127,128,125,125,146,132,156,135,31,247,18,99,62,35,
+5,131,129,138,136,132,26,125,151,128,153,149,145,143,151,147,30,217,243,216,
+35,5,126,148,144,136,149,27,154,150,150,153,145,136,145,133,147,31,63,243,
+247,18,179,5,157,144,146,146,153,26,152,127,151,127,136,130,137,138,134,30,
+251,18,99,5,247,20,7,161,130,150,122,122,130,128,117,30,14,247,218,247,147,
+21,247,67,98,29,251,67,247,84,6,247,29,10,251,83,251,67,7,130,137,5,124,137,
+131,131,125,26,122,150,130,160,30,247,67,251,85,6,247,36,29,150,159,30,14,
+171,29,191,29,247,187,247,16,132,10,248,123,249,4,21,144,149,140,141,144,
+26,152,127,150,125,127,132,134,124,132,30,251,220,253,63,5,135,131,138,135,
+134,26,126,151,128,153,151,146,144,154,146,30,14,248,129,247,242,21,247,50,
+61,247,0,251,6,251,7,61,251,0,251,50,30,41,7,251,51,217,251,0,247,7,247,6,
+217,247,0,247,51,30,251,225,231,21,201,157,204,168,184,30,171,160,171,156,
+180,27,179,171,122,107,160,31,168,94,157,74,77,26,52,7,78,121,73,110,94,30,
+107,118,106,122,100,27,99,106,156,171,118,31,110,184,121,205,200,26,14,247,
+219,248,249,21,251,84,79,5,120,133,133,133,125,26,126,151,127,151,141,149,
+141,140,143,30,247,17,178,5,252,129,251,26,247,10,10,247,212,88,10,251,26,
+6,14,247,27,190,21,193,185,201,196,222,219,8,247,18,247,12,159,168,198,26,
+232,50,220,38,77,81,111,91,101,30,119,114,126,109,120,26,127,150,128,153,
+152,147,146,155,143,30,197,156,198,180,204,27,213,203,82,74,96,121,114,46,
+49,31,56,60,63,69,69,78,130,131,24,72,248,41,220,117,29,109,7,14,247,171,
+247,249,21,118,128,129,123,123,247,54,10,235,137,216,79,64,26,67,66,78,51,
+83,88,157,174,91,30,145,130,134,141,132,27,126,128,128,126,123,152,126,175,
+121,31,111,191,186,126,190,27,247,10,235,222,240,204,93,201,69,170,31,200,
+168,173,186,195,26,228,60,207,36,86,88,123,109,99,30,116,121,125,122,127,
+26,126,150,128,153,147,145,142,145,144,30,179,175,180,156,199,27,213,195,
+93,79,107,121,108,110,120,31,124,115,119,134,100,27,14,248,7,247,58,21,251,
+7,68,7,247,32,10,247,44,202,29,110,247,7,168,88,10,110,248,22,46,6,251,122,
+252,20,5,86,7,247,163,190,21,251,109,6,247,94,247,227,5,154,6,14,247,88,248,
+188,21,247,128,98,29,251,180,251,161,6,123,149,128,154,145,144,141,145,152,
+30,161,183,179,149,179,27,220,194,81,54,39,74,71,44,83,87,161,182,91,31,147,
+130,134,141,132,27,125,128,128,125,124,153,124,174,117,31,106,190,189,123,
+193,27,247,15,226,229,247,19,247,6,62,221,33,96,105,131,120,90,31,14,247,
+74,247,154,21,138,149,139,148,144,26,199,155,199,168,181,30,211,187,216,184,
+214,27,157,154,137,134,149,31,134,149,143,138,145,27,153,149,150,152,162,
+102,156,90,74,73,114,93,85,31,64,76,103,54,251,9,26,251,65,224,251,14,247,
+14,239,217,224,247,1,242,61,224,44,73,80,101,72,103,30,146,66,21,162,179,
+150,156,153,155,8,174,171,177,158,175,27,205,194,77,64,58,85,77,68,64,91,
+187,244,112,31,14,248,69,248,176,21,251,52,252,138,5,137,133,138,135,135,
+26,125,150,128,153,153,145,145,157,145,30,247,55,248,146,5,209,252,20,59,
+247,101,29,168,247,173,7,14,248,24,247,204,21,202,172,170,185,197,26,230,
+56,215,40,40,56,63,48,81,171,93,202,106,30,72,107,101,85,76,26,41,225,59,
+246,245,225,219,237,202,100,194,73,170,30,49,247,145,21,213,197,87,73,77,
+82,91,66,66,82,187,201,204,197,192,209,31,251,170,4,221,200,86,68,68,77,83,
+61,60,77,195,210,208,200,194,216,31,14,248,101,247,231,21,140,129,139,130,
+135,26,78,123,79,110,97,30,67,91,62,94,64,27,121,124,142,144,129,31,144,129,
+135,140,133,27,125,129,128,125,116,175,122,189,204,205,164,185,193,31,214,
+202,175,224,247,8,26,247,66,54,247,14,251,14,39,61,54,251,1,36,217,54,234,
+205,197,177,206,176,30,132,212,21,116,99,128,122,124,123,8,105,108,101,119,
+103,27,73,84,201,214,220,193,201,210,214,186,91,34,167,31,14,247,187,247,
+16,247,38,10,170,178,178,107,169,97,31,128,247,186,132,10,247,99,185,10,57,
+247,157,132,10,199,247,173,21,248,62,251,125,5,136,144,145,138,144,27,147,
+147,144,146,143,31,141,142,5,141,143,238,29,150,145,144,146,148,26,143,138,
+143,136,143,30,138,142,5,147,134,131,144,131,27,135,134,137,136,133,31,14,
+248,158,247,219,114,10,248,170,247,173,21,252,63,247,125,5,142,132,135,141,
+135,27,130,132,134,131,134,199,10,133,134,132,130,26,136,141,134,141,135,
+30,140,136,5,132,143,148,134,146,27,145,144,140,142,145,31,14,247,220,247,
+136,21,247,16,197,180,182,214,26,233,65,201,251,2,82,119,134,100,48,30,127,
+134,5,69,80,29,176,7,163,190,168,146,182,27,220,195,96,76,86,93,99,251,11,
+90,31,69,7,247,36,29,149,160,30,98,251,5,21,102,114,117,107,107,164,116,176,
+31,167,6,175,164,162,171,171,114,161,103,31,14,248,49,247,34,21,178,6,160,
+150,147,157,151,132,148,127,142,31,247,159,7,232,68,209,46,251,8,54,251,3,
+251,44,30,251,51,7,67,158,77,176,88,30,87,176,184,115,201,27,217,216,172,
+173,152,128,150,124,133,134,137,135,134,31,115,113,106,128,90,27,91,106,156,
+176,113,31,109,182,123,194,198,26,247,48,7,247,18,201,228,226,204,186,92,
+74,30,99,7,35,136,67,79,55,26,66,199,84,221,150,148,140,141,153,30,189,4,
+137,123,134,139,129,27,84,101,171,185,193,192,180,210,140,31,14,32,29,14,
+189,29,191,170,164,94,29,163,29,201,164,185,189,30,167,165,151,155,151,62,
+29,14,83,29,14,32,10,14,247,63,247,158,21,247,26,100,6,118,148,129,156,156,
+148,150,159,30,247,21,117,29,100,251,26,247,87,247,195,216,29,252,92,7,118,
+128,130,123,247,132,29,247,126,49,29,251,25,6,14,43,10,14,44,10,35,10,14,
+91,10,60,10,14,44,29,14,46,29,39,10,14,35,29,14,51,10,247,199,124,21,247,
+34,144,245,247,18,247,56,26,247,57,251,4,247,22,251,35,251,34,251,4,251,22,
+251,57,55,168,62,192,82,30,171,104,167,122,188,122,58,82,24,131,133,134,132,
+131,26,124,150,127,153,142,143,140,140,143,30,152,186,202,149,168,27,165,
+153,136,129,166,31,129,169,150,136,156,27,164,163,146,157,171,31,160,150,
+146,147,151,26,154,128,150,125,134,134,138,135,134,30,119,108,123,133,119,
+27,127,132,141,147,115,31,151,109,116,143,108,27,123,130,138,136,119,31,164,
+248,200,21,247,7,229,251,0,251,29,251,26,48,251,2,251,3,251,4,247,46,29,14,
+40,10,14,36,29,14,59,29,33,29,14,247,156,22,202,6,247,102,248,148,5,166,203,
+10,251,42,79,10,210,6,251,79,252,92,179,10,14,38,10,14,247,65,10,160,151,
+59,10,36,10,14,52,10,14,247,219,248,188,21,231,88,10,251,36,253,105,247,36,
+88,10,47,6,14,247,52,249,25,21,154,132,132,144,127,27,125,127,128,126,134,
+140,135,143,131,31,247,220,253,63,5,124,146,146,134,151,27,153,151,150,152,
+144,138,142,134,148,31,14,247,166,68,21,47,72,29,247,36,249,105,251,36,72,
+29,231,6,14,247,192,248,252,21,251,74,251,115,5,131,130,137,134,132,26,125,
+150,128,154,148,145,143,150,148,30,247,34,247,67,247,35,251,67,5,128,147,
+146,135,148,27,154,150,150,153,146,137,143,131,149,31,14,248,221,251,8,214,
+10,248,27,248,236,21,251,38,6,247,40,251,129,5,121,150,149,132,154,27,158,
+155,153,156,144,138,145,137,144,31,14,37,29,14,247,42,248,239,21,38,49,10,
+188,252,137,90,49,10,240,214,6,77,187,195,110,210,27,247,15,238,240,247,17,
+247,17,41,237,251,16,69,79,108,80,94,31,247,62,178,21,238,215,63,41,43,62,
+62,43,44,62,216,236,234,215,217,233,31,14,42,10,14,81,10,14,34,29,14,247,
+169,248,4,21,247,76,202,10,251,76,194,6,86,29,251,64,6,14,124,10,121,123,
+70,10,14,67,29,14,40,29,137,247,18,29,101,29,68,10,14,48,29,14,247,10,248,
+55,21,59,6,153,10,168,251,209,110,6,118,128,130,123,123,151,129,158,31,247,
+1,136,10,111,247,147,6,192,175,169,162,173,27,170,167,107,104,31,251,207,
+219,7,247,121,10,247,147,6,192,175,168,162,172,27,172,167,109,105,31,251,
+210,219,7,159,151,247,88,29,110,247,163,6,200,89,189,78,98,109,122,91,99,
+30,183,115,107,160,97,27,99,110,123,101,108,31,14,41,29,14,39,29,14,74,29,
+248,92,247,241,21,198,92,86,164,65,27,251,19,42,47,251,11,251,12,237,47,247,
+18,212,194,165,196,185,31,251,116,47,247,11,29,247,85,88,10,90,248,135,188,
+6,247,78,10,251,67,102,21,238,215,69,48,50,63,68,42,42,63,209,230,228,215,
+210,234,31,14,42,29,14,34,10,14,50,29,14,33,10,14,247,232,22,247,58,248,4,
+5,176,166,29,251,44,6,153,10,199,6,251,34,251,209,5,151,29,14,38,29,14,57,
+10,109,10,131,122,62,10,14,54,10,14,247,220,248,130,21,171,158,161,170,143,
+30,162,142,147,145,156,26,154,128,149,121,81,93,91,78,30,251,61,7,105,117,
+117,106,137,30,119,137,130,131,122,26,123,148,131,159,137,30,172,137,161,
+117,105,26,251,61,7,78,185,91,197,157,150,149,154,156,131,145,116,142,30,
+108,144,120,160,171,26,247,61,7,179,127,162,110,160,30,168,160,151,163,179,
+26,14,247,218,249,205,21,88,254,199,190,6,14,247,165,126,21,107,120,117,108,
+135,30,116,136,131,133,122,26,124,150,129,157,197,185,187,200,30,247,61,7,
+173,161,162,172,141,30,159,140,148,147,156,26,155,130,147,119,141,30,106,
+141,117,162,172,26,247,61,7,200,93,187,81,121,128,129,124,122,147,133,162,
+136,30,170,135,158,117,107,26,251,61,7,99,151,116,168,118,30,110,118,127,
+115,99,26,14,248,125,247,226,119,29,183,148,147,164,27,154,157,130,120,163,
+31,86,203,161,127,172,27,172,169,157,181,175,31,158,160,247,83,10,247,149,
+251,44,21,138,131,139,133,136,26,115,159,121,164,164,159,157,163,140,139,
+145,138,149,30,121,247,212,5,161,137,131,149,123,27,123,130,129,117,138,31,
+171,247,35,21,172,165,162,170,170,113,162,106,31,127,6,105,113,116,108,108,
+165,116,173,31,14,247,167,248,131,21,100,131,117,131,116,124,8,87,104,108,
+83,76,26,45,211,60,234,127,30,33,80,29,245,7,211,145,215,175,168,26,154,129,
+149,125,131,135,137,132,130,30,113,106,95,125,94,27,54,76,198,218,221,202,
+196,228,200,181,114,99,145,31,120,142,146,131,247,91,29,199,7,158,129,150,
+122,130,132,135,130,134,30,115,157,100,152,105,140,8,237,117,29,14,247,86,
+190,21,172,184,157,197,201,26,156,138,154,136,158,30,222,203,29,44,6,137,
+148,139,139,129,173,8,131,168,134,164,156,26,190,183,182,191,172,166,125,
+107,164,188,10,143,119,160,72,31,52,49,10,239,6,141,126,140,119,125,26,53,
+98,57,95,137,30,123,128,129,125,122,151,130,159,31,247,215,6,188,180,183,
+192,155,128,150,124,124,130,130,121,138,31,110,136,124,122,116,27,14,129,
+29,247,219,247,125,21,247,17,6,158,147,146,155,156,131,146,120,31,251,0,6,
+247,50,247,124,5,159,98,29,251,1,98,10,168,6,251,33,251,100,251,33,247,100,
+5,168,88,10,251,3,49,10,160,6,247,49,251,124,5,33,247,56,10,91,251,17,247,
+56,10,52,58,49,10,247,106,202,29,58,226,247,17,247,8,10,251,17,6,14,247,219,
+248,14,21,219,7,203,183,182,204,155,154,137,133,156,30,137,149,141,138,143,
+27,152,150,151,152,150,134,146,127,144,31,148,119,110,144,113,27,51,70,69,
+51,31,59,48,116,10,230,251,151,6,75,98,95,79,127,124,141,141,131,30,146,114,
+136,140,133,27,126,129,128,125,130,144,131,149,134,31,130,158,171,132,165,
+27,224,207,207,224,31,247,157,230,7,247,118,10,248,138,248,239,21,251,109,
+6,66,78,85,73,123,142,129,146,125,31,73,127,105,110,94,26,90,183,95,240,83,
+30,204,103,5,233,87,173,108,107,26,101,101,109,90,30,251,52,203,6,157,129,
+150,123,123,129,128,121,30,251,6,247,104,7,219,198,189,207,156,136,150,132,
+154,31,203,147,174,170,186,26,190,100,180,42,192,30,83,169,5,251,9,203,110,
+163,173,26,177,178,171,185,30,247,55,76,6,121,149,128,155,155,149,150,157,
+30,251,12,251,97,21,202,106,180,99,112,26,118,113,125,97,138,30,129,6,137,
+138,139,138,135,31,121,156,109,158,85,169,77,173,24,60,183,96,176,165,26,
+162,168,155,179,30,146,6,142,141,139,140,143,31,167,115,165,122,203,105,8,
+14,247,91,247,49,21,115,175,167,130,177,27,177,164,148,163,176,31,191,87,
+5,130,148,146,136,146,27,154,150,150,153,146,134,148,132,146,31,87,191,5,
+162,172,149,168,177,26,175,131,165,115,175,30,191,190,5,149,149,141,142,148,
+26,154,128,150,124,131,133,136,130,130,30,87,88,5,162,106,108,149,101,27,
+101,110,130,115,105,31,87,190,5,148,129,134,142,131,27,124,128,128,125,131,
+142,133,148,130,31,191,88,5,117,107,129,108,103,26,102,148,113,163,103,30,
+86,87,5,130,130,136,133,131,26,125,151,128,153,147,144,142,148,149,30,247,
+44,247,196,21,205,192,87,74,74,86,87,74,74,86,191,204,203,192,192,203,31,
+14,247,122,248,239,21,174,251,146,5,112,143,150,126,247,63,29,14,247,121,
+248,236,247,45,29,154,27,158,155,153,156,143,138,145,137,145,31,247,30,247,
+107,247,45,29,153,27,159,155,153,156,143,138,145,137,145,31,14,194,247,102,
+120,10,156,251,89,120,10,14,194,247,102,160,10,142,147,26,153,128,150,125,
+131,131,135,131,130,30,14,248,185,118,29,14,73,29,247,214,248,4,21,35,6,153,
+10,191,251,209,67,89,10,247,86,202,29,69,6,138,247,18,29,247,59,248,4,21,
+205,203,10,73,192,6,184,166,174,174,152,160,135,133,161,30,135,150,140,247,
+37,10,119,102,146,118,27,78,88,80,67,31,86,67,116,10,211,251,209,61,49,10,
+247,88,49,29,73,6,247,214,248,188,21,35,49,10,191,252,137,67,49,10,247,88,
+88,10,67,6,14,248,137,247,147,247,21,10,198,10,14,121,10,252,34,167,10,14,
+121,10,82,251,15,49,10,247,15,251,183,6,247,36,29,150,159,30,247,183,247,
+15,7,220,10,251,15,6,14,113,10,248,79,248,188,21,195,6,158,150,149,155,154,
+128,149,120,31,251,93,6,251,28,137,52,80,138,47,8,93,7,142,56,220,80,247,
+13,133,8,251,158,47,7,120,127,129,123,124,151,129,158,31,247,26,6,159,150,
+148,156,151,131,149,126,141,31,248,199,200,252,199,7,126,137,131,129,127,
+26,123,151,129,157,30,238,6,159,150,148,156,155,128,148,119,31,82,6,14,247,
+188,248,89,21,56,73,73,55,56,205,72,221,220,205,206,222,221,73,207,59,31,
+14,171,29,247,53,247,45,21,68,251,116,5,138,135,138,135,135,26,122,132,29,
+247,53,248,239,21,68,251,116,5,138,135,138,135,136,26,121,132,29,247,211,
+118,29,248,77,247,90,121,29,14,241,232,21,172,29,247,91,22,172,29,247,92,
+22,247,68,29,168,114,164,110,31,14,247,38,248,249,21,74,89,89,76,77,190,88,
+201,202,247,81,29,181,171,107,97,98,106,106,99,98,106,172,180,180,172,172,
+179,31,247,245,251,82,21,151,143,144,145,149,26,149,130,148,131,137,135,138,
+137,133,30,252,10,251,12,5,126,135,134,133,129,26,129,148,130,148,141,143,
+140,141,145,30,199,92,148,29,247,166,178,148,29,14,247,165,247,53,21,251,
+15,82,97,94,65,26,46,213,76,247,2,191,172,147,166,202,30,154,146,143,140,
+152,145,8,209,247,13,29,101,7,116,88,111,132,95,27,58,83,182,201,193,186,
+180,247,10,186,31,209,117,29,180,247,6,21,176,164,161,171,171,114,161,102,
+31,111,6,103,113,117,107,107,164,117,176,31,14,247,90,249,6,87,29,248,73,
+248,224,53,10,247,192,249,18,74,10,153,145,150,29,149,137,143,125,150,31,
+14,248,71,248,237,50,10,248,54,248,161,53,29,247,68,248,254,43,29,247,193,
+248,246,65,10,14,247,83,248,246,85,29,247,194,249,38,84,10,247,161,150,21,
+49,165,7,166,153,133,125,221,29,132,155,132,31,129,159,170,247,44,29,185,
+7,14,247,187,248,219,247,54,29,148,26,153,193,29,136,112,29,248,62,150,21,
+70,6,78,110,118,113,96,178,29,158,163,176,159,31,14,247,192,248,115,76,10,
+192,10,56,29,14,247,248,247,169,21,208,6,156,150,148,153,154,129,148,121,
+31,118,247,54,6,189,94,176,78,114,97,129,127,109,30,128,134,133,131,129,26,
+126,149,128,151,144,141,139,143,148,30,150,166,169,146,156,27,175,163,123,
+115,31,102,7,145,111,122,141,117,27,58,81,97,81,89,181,106,201,177,166,146,
+157,176,31,192,4,117,105,108,130,102,27,106,116,152,159,173,178,163,192,161,
+157,136,133,165,31,14,247,124,194,10,251,108,6,251,16,68,5,126,131,134,133,
+128,26,125,151,127,152,144,143,140,145,149,30,237,195,5,251,78,48,116,10,
+248,94,247,96,247,9,10,251,45,251,155,247,101,7,247,44,227,5,154,148,143,
+144,150,26,152,127,151,126,133,131,137,135,133,30,251,18,66,5,14,58,29,14,
+247,236,247,158,21,206,117,6,247,33,10,234,247,103,10,117,72,247,87,247,72,
+33,80,29,247,49,251,212,7,251,41,37,251,6,251,60,251,61,242,251,4,247,47,
+31,247,225,247,28,6,158,129,151,123,121,131,130,117,30,54,251,92,7,87,248,
+97,21,252,97,112,7,69,90,160,185,101,31,106,181,121,194,205,26,205,157,194,
+172,182,30,185,177,187,160,210,27,14,247,196,248,212,21,52,71,74,55,58,208,
+72,223,223,207,206,221,220,71,206,57,31,135,92,21,199,185,94,82,83,92,94,
+82,81,92,185,195,194,186,185,195,31,14,47,29,14,40,29,14,247,217,248,239,
+21,251,55,98,10,247,3,251,115,6,35,80,5,124,131,135,133,128,26,125,150,128,
+153,145,142,140,145,149,30,218,183,5,251,112,251,45,247,10,10,247,254,88,
+10,251,49,247,134,6,244,198,5,154,147,143,145,151,26,152,128,151,125,134,
+135,138,133,129,30,59,94,5,14,61,29,14,248,219,247,87,21,186,137,158,131,
+173,30,227,120,88,189,67,27,81,95,104,71,110,31,202,109,87,179,86,27,53,67,
+38,251,11,251,16,212,34,226,193,188,179,208,169,31,71,170,194,98,198,27,172,
+223,10,93,118,127,111,27,79,86,210,228,131,31,190,4,228,152,174,186,195,27,
+172,167,121,106,156,31,150,119,145,115,144,98,8,252,0,247,28,21,198,189,59,
+45,47,88,58,82,82,88,220,232,230,189,221,196,31,14,247,11,247,212,21,251,
+161,90,116,10,239,6,140,248,108,5,184,181,174,192,194,184,96,86,98,96,102,
+91,30,134,6,122,128,129,124,122,150,131,161,31,143,6,176,184,122,114,172,
+31,176,110,161,94,90,26,67,100,83,90,104,118,164,183,135,30,158,138,130,148,
+124,27,123,129,128,123,70,187,87,202,219,199,216,241,228,90,208,49,176,31,
+174,166,156,169,178,26,222,72,205,55,58,72,80,67,30,38,90,116,10,14,247,213,
+248,247,104,29,14,248,118,248,25,21,251,85,7,247,36,29,150,159,30,247,136,
+252,70,247,11,29,14,247,63,149,21,119,167,160,133,178,27,201,199,162,183,
+192,31,88,220,7,160,150,148,155,155,128,148,118,31,110,248,5,251,13,6,116,
+129,131,122,123,247,93,29,208,251,141,6,81,85,81,111,73,27,88,105,173,189,
+31,247,193,38,7,117,129,131,122,123,247,54,10,188,252,169,167,10,14,247,39,
+248,156,21,199,6,140,72,5,125,148,129,152,152,148,149,154,30,247,1,251,145,
+251,2,7,125,148,129,152,152,148,149,154,30,205,199,251,131,91,7,124,129,130,
+126,127,149,130,154,31,247,33,6,153,149,148,152,152,129,147,124,31,91,6,247,
+198,187,21,212,247,53,5,251,101,108,7,124,129,131,126,126,149,130,153,31,
+224,6,154,149,148,152,151,129,148,124,31,130,247,131,144,6,153,149,148,151,
+153,129,147,124,31,76,6,61,251,65,61,247,65,5,76,6,124,129,131,126,126,149,
+130,154,31,143,251,131,130,6,124,130,130,127,126,149,130,153,31,224,6,153,
+149,148,152,151,129,148,125,31,107,247,102,6,213,251,54,5,14,65,29,248,128,
+248,109,21,145,146,142,146,143,26,152,129,149,127,131,135,137,128,130,223,
+29,151,102,10,247,133,251,148,21,247,55,247,42,155,157,182,26,194,88,187,
+80,102,105,123,110,117,30,127,124,132,121,127,26,129,148,130,150,150,145,
+144,152,142,30,168,148,168,160,173,27,176,171,110,107,122,128,121,115,115,
+31,95,95,81,84,101,105,131,132,133,134,136,136,8,93,247,127,180,7,153,131,
+148,127,126,131,130,125,30,14,247,218,247,187,21,247,67,6,161,150,148,155,
+156,128,147,117,31,251,67,247,45,6,247,29,10,251,44,251,67,7,122,136,139,
+139,136,138,8,132,134,134,131,130,26,123,150,130,160,30,247,67,251,45,167,
+10,251,119,47,21,118,128,130,123,123,247,54,10,248,38,6,161,150,148,155,155,
+128,148,117,31,14,247,63,247,20,21,247,18,6,247,8,231,214,233,233,54,212,
+251,1,31,251,32,187,247,25,166,29,251,126,6,118,128,131,122,247,132,29,247,
+126,49,29,251,25,6,247,20,4,247,126,247,35,7,216,201,87,75,75,70,85,55,31,
+14,247,38,248,247,21,59,115,108,129,131,133,10,153,247,52,10,70,6,248,24,
+247,68,21,145,146,142,145,144,26,152,247,19,29,133,136,132,133,26,127,149,
+129,151,147,141,140,152,149,30,247,216,167,21,88,120,7,108,131,135,122,127,
+149,131,153,31,225,6,153,247,52,10,128,190,6,165,147,144,155,151,130,147,
+125,31,128,247,106,78,6,251,22,251,109,5,101,7,247,42,180,21,37,6,241,247,
+61,5,14,248,137,247,149,21,161,150,148,155,155,128,148,117,31,252,38,6,118,
+128,130,123,123,247,54,10,247,95,251,17,21,172,29,248,44,4,172,29,14,247,
+218,248,207,21,247,63,10,119,148,128,156,155,148,150,159,30,251,29,4,247,
+63,10,247,33,10,14,247,194,249,14,21,54,72,74,56,58,207,73,221,223,206,205,
+220,220,72,206,57,31,136,88,21,195,183,96,85,86,95,96,85,84,95,182,193,191,
+183,183,192,31,14,247,42,248,225,21,38,79,10,188,253,49,125,29,66,89,115,
+79,89,31,247,62,172,21,239,214,70,47,247,27,29,247,5,248,104,21,124,130,131,
+126,127,148,131,154,31,191,247,108,29,116,247,2,10,192,207,195,188,199,174,
+120,130,10,248,9,144,21,145,145,142,147,143,26,152,176,10,247,248,167,21,
+88,247,17,29,152,151,129,147,125,31,128,190,247,74,10,247,106,78,6,251,21,
+251,109,247,94,10,247,61,5,14,247,118,247,189,21,247,56,247,42,154,157,183,
+26,194,88,186,80,84,82,93,96,129,148,130,150,150,145,144,151,142,30,169,148,
+168,159,173,27,176,171,110,107,117,129,126,90,91,31,94,95,97,100,99,103,133,
+134,24,93,247,127,180,7,153,131,148,126,127,131,130,125,30,14,247,131,247,
+145,21,196,6,173,128,178,89,174,65,8,182,6,154,149,149,152,153,129,148,124,
+31,127,6,133,150,107,192,125,157,114,160,25,182,157,160,166,176,26,195,93,
+179,74,30,251,30,6,123,129,130,125,125,149,130,155,31,158,251,127,120,6,123,
+129,130,125,125,150,130,154,31,235,6,155,149,148,153,153,129,148,123,31,109,
+6,247,27,4,239,211,7,177,165,119,110,108,106,119,87,31,152,247,170,91,29,
+238,247,199,21,130,29,248,38,98,29,14,248,78,248,202,21,146,142,144,147,149,
+26,154,128,150,125,136,137,139,138,137,30,46,99,5,167,77,80,157,111,27,124,
+128,128,124,126,146,132,156,135,31,179,131,154,134,169,127,88,117,24,132,
+135,134,132,129,26,124,151,126,153,141,142,140,140,143,30,226,179,172,116,
+187,84,164,96,25,167,97,100,150,91,27,251,21,36,39,251,16,251,17,242,39,247,
+23,202,197,162,182,183,31,185,183,161,195,212,26,246,76,247,16,43,222,30,
+64,251,45,21,243,219,63,41,42,58,62,38,38,58,216,236,235,220,217,238,31,14,
+247,192,247,209,21,251,30,247,28,5,147,130,132,143,132,27,125,127,128,125,
+131,142,133,148,130,31,247,31,251,27,251,31,251,28,5,130,130,136,133,131,
+26,125,150,128,154,147,145,142,148,148,30,247,30,247,28,247,31,251,28,5,130,
+148,144,136,147,27,154,150,150,153,147,136,146,130,147,31,251,30,247,28,247,
+30,247,27,5,147,147,143,146,146,26,154,127,150,125,132,133,136,130,130,30,
+14,247,180,248,104,75,29,247,40,247,152,21,59,212,68,221,177,174,153,167,
+169,30,157,155,146,149,149,26,152,129,148,126,131,134,137,132,133,30,105,
+109,118,128,104,27,80,90,188,198,31,177,7,198,182,185,194,182,176,116,111,
+143,30,123,141,146,131,153,27,153,148,149,155,31,201,7,155,130,149,125,128,
+131,133,127,135,30,157,108,117,146,108,27,60,73,72,58,31,247,47,247,165,91,
+29,32,29,215,247,115,247,52,29,127,150,125,191,10,32,29,115,247,165,247,1,
+29,126,240,10,141,146,210,10,32,29,251,26,247,137,85,29,32,29,48,247,153,
+134,29,32,29,120,140,29,14,32,29,247,2,247,129,21,132,134,136,133,132,31,
+109,110,130,133,124,27,127,129,143,158,235,10,126,247,45,10,158,27,149,151,
+135,128,157,31,115,180,158,226,10,247,215,123,21,145,6,197,204,166,183,187,
+31,167,165,151,155,151,26,153,129,149,124,130,134,136,131,131,30,76,84,92,
+115,71,27,251,7,41,237,247,8,31,208,7,191,161,195,175,178,30,178,175,186,
+159,194,148,10,71,79,247,68,10,140,251,11,234,251,3,247,12,115,8,71,165,7,
+166,153,133,125,126,123,130,116,125,125,143,149,118,31,144,130,136,247,28,
+10,133,155,131,31,129,159,170,147,29,32,10,247,113,249,64,247,52,29,127,150,
+125,131,134,137,130,130,30,251,6,42,5,126,247,94,29,145,142,147,148,30,14,
+32,10,247,13,249,114,247,1,29,126,130,137,135,128,26,125,150,128,153,146,
+144,141,146,148,30,243,223,243,55,5,132,148,144,137,145,27,153,151,247,117,
+29,32,10,150,249,86,85,29,32,10,186,211,29,147,146,136,146,27,153,247,42,
+29,35,10,247,3,249,64,54,29,35,10,113,249,114,126,10,35,10,251,28,249,86,
+45,10,35,10,46,249,102,195,29,154,150,150,153,148,247,116,10,39,10,126,249,
+129,120,29,166,148,164,29,35,29,247,2,247,103,146,10,35,29,141,247,153,77,
+29,35,29,251,0,247,125,45,10,35,29,68,247,141,134,29,35,29,247,35,247,117,
+78,29,36,29,251,23,234,21,247,28,247,1,5,152,149,141,142,150,26,153,127,150,
+125,133,133,136,133,131,30,34,55,35,223,5,145,131,133,205,10,151,130,31,14,
+33,29,38,248,184,247,52,29,128,150,124,191,10,33,29,251,97,248,234,77,29,
+33,29,251,207,248,206,45,10,33,29,251,167,248,222,171,10,247,7,42,5,131,147,
+146,136,145,27,154,247,42,29,36,10,215,249,64,21,150,148,142,144,247,110,
+29,130,30,251,7,42,5,129,130,136,134,130,247,49,10,36,10,251,30,249,86,45,
+10,52,10,247,91,249,6,109,29,132,205,10,152,130,31,14,37,10,116,248,25,247,
+141,29,143,141,148,150,30,14,37,29,251,16,248,75,74,10,152,146,150,29,150,
+137,142,125,150,31,14,37,10,251,125,248,47,142,29,37,10,251,89,248,63,222,
+29,149,144,247,27,10,139,125,154,31,14,37,10,251,14,248,95,182,29,109,114,
+162,167,167,163,162,169,31,14,37,10,150,248,38,193,10,142,159,103,31,157,
+107,125,144,141,29,162,27,164,246,10,247,213,124,21,194,141,183,150,181,160,
+8,187,163,170,168,158,111,29,137,7,247,64,10,66,171,74,197,98,31,168,117,
+166,129,186,132,8,73,162,29,171,131,160,219,29,34,29,73,247,234,53,10,34,
+29,251,59,248,28,82,10,153,146,150,29,150,137,142,125,150,31,14,34,29,251,
+168,248,0,142,29,34,29,251,132,248,16,87,29,40,29,207,248,173,21,152,150,
+141,142,149,26,153,176,29,40,29,97,248,223,247,1,29,126,240,10,142,145,210,
+10,40,29,251,41,248,195,45,10,40,29,33,248,211,171,10,247,7,42,5,131,148,
+145,136,146,27,153,151,150,153,148,139,139,124,154,31,14,122,10,213,199,165,
+155,73,10,102,121,83,87,30,247,144,247,134,193,10,142,159,97,29,39,29,242,
+247,98,247,23,29,129,30,251,6,42,5,130,131,135,132,131,26,124,150,128,153,
+147,142,140,149,150,30,14,39,29,141,247,148,127,10,39,29,251,0,247,120,45,
+10,39,29,74,247,136,145,29,39,29,247,35,247,111,21,132,134,137,132,132,31,
+110,110,130,133,124,27,127,131,142,159,103,31,158,106,126,143,118,27,112,
+117,211,10,157,27,150,149,135,128,159,31,115,180,157,132,163,27,163,161,150,
+164,165,247,42,10,34,10,247,49,248,4,21,247,27,247,1,5,151,148,142,144,149,
+26,153,128,150,125,132,134,137,132,209,29,33,10,91,248,166,247,52,29,176,
+29,33,10,251,34,248,216,127,10,33,10,251,144,248,188,45,10,33,10,251,101,
+248,204,145,29,46,10,247,238,247,112,53,10,46,10,238,247,134,45,10,54,10,
+251,73,242,21,247,27,247,0,5,153,150,141,143,149,26,153,127,150,125,132,134,
+136,133,209,29,247,122,248,171,21,82,6,121,129,131,125,125,149,130,157,31,
+149,251,76,121,6,122,129,131,125,125,149,130,156,31,221,6,157,149,147,154,
+153,129,147,121,31,122,247,36,6,177,171,156,149,175,27,175,165,119,111,31,
+251,36,129,7,121,129,131,125,124,149,131,157,31,206,6,157,149,148,153,153,
+129,147,121,31,129,247,40,6,190,92,177,78,103,117,130,114,111,30,14,73,29,
+247,174,247,209,21,205,203,10,73,192,6,185,165,173,175,247,60,10,153,149,
+104,10,14,247,6,190,21,61,49,10,248,165,202,29,69,248,4,251,57,192,6,185,
+166,173,174,154,153,136,131,167,30,136,149,141,247,37,10,118,103,146,118,
+27,113,155,10,6,247,221,251,209,21,251,5,247,209,247,5,6,251,169,251,209,
+134,10,248,131,248,217,21,88,153,5,144,121,117,142,125,27,114,155,10,251,
+209,61,49,10,248,165,202,29,69,6,87,22,251,5,247,209,217,203,10,61,192,6,
+185,166,173,174,152,153,137,132,163,30,251,169,252,128,134,10,248,130,247,
+41,10,135,137,128,130,30,251,242,252,46,5,132,131,136,247,44,10,136,102,10,
+248,40,251,9,21,166,159,153,163,170,26,194,91,184,81,81,91,94,84,108,152,
+115,167,119,208,29,176,168,247,82,10,167,166,175,229,29,14,248,112,247,5,
+10,130,30,251,243,252,46,5,131,130,137,135,133,26,127,149,129,152,147,142,
+141,151,149,30,248,43,247,8,21,166,158,153,165,247,64,29,113,166,120,100,
+29,251,232,247,201,75,29,248,113,247,5,10,129,223,29,248,43,247,8,21,167,
+159,153,164,169,26,194,91,184,81,80,91,94,84,109,153,114,167,119,30,106,117,
+124,112,105,26,81,189,92,202,201,189,186,197,173,124,166,106,161,30,74,247,
+26,21,176,168,113,105,108,110,115,102,102,111,163,170,172,168,166,175,31,
+251,47,4,180,170,112,104,103,107,111,100,99,107,167,175,174,170,166,179,31,
+252,14,248,39,84,29,248,112,248,109,21,145,145,142,146,145,26,151,176,10,
+248,43,247,8,21,166,159,153,164,247,64,29,114,166,119,100,29,251,134,248,
+39,138,10,248,49,248,93,21,231,94,201,72,71,94,77,47,30,84,7,47,184,77,207,
+206,184,201,231,30,251,76,191,21,172,149,174,154,163,30,155,150,154,147,160,
+27,159,155,131,123,149,31,155,115,148,104,106,26,91,7,105,130,104,123,116,
+30,122,128,124,131,119,27,118,124,147,156,128,31,124,162,129,174,173,26,14,
+247,224,247,241,21,87,247,17,29,151,152,130,147,124,31,128,191,247,74,10,
+247,105,78,6,251,21,251,108,247,94,10,247,60,5,14,247,140,248,198,84,29,247,
+133,248,67,21,213,198,204,207,148,147,138,137,144,30,136,145,142,138,143,
+27,150,148,147,151,155,117,151,107,46,63,57,39,251,1,187,67,212,197,185,189,
+203,199,93,190,84,108,112,126,110,114,31,146,75,21,184,163,162,159,168,27,
+172,166,107,101,97,112,108,103,102,114,165,191,128,31,14,248,1,248,198,138,
+10,248,1,248,72,21,167,159,152,164,169,26,194,91,184,81,81,91,94,85,108,153,
+114,166,119,30,108,118,123,112,105,26,80,189,92,202,201,189,186,198,172,123,
+167,107,160,30,73,247,26,21,176,168,113,106,108,111,115,102,102,111,163,170,
+172,168,165,174,31,251,46,4,181,170,112,103,104,107,110,99,100,107,168,174,
+174,170,167,178,31,14,248,19,248,59,21,140,135,139,135,139,26,70,81,82,68,
+131,134,140,142,132,30,142,133,137,139,135,27,127,130,131,127,122,162,128,
+173,180,180,156,169,171,31,176,173,154,177,196,26,247,7,92,211,65,81,93,87,
+75,76,185,88,195,170,163,152,168,165,30,134,205,21,90,112,119,121,110,27,
+106,111,172,179,181,167,172,174,176,160,116,81,155,31,14,247,7,248,148,21,
+252,97,58,7,119,128,172,10,247,104,6,160,150,148,156,155,128,148,119,31,58,
+248,97,220,6,159,150,247,88,10,251,104,6,118,128,130,122,123,150,130,159,
+31,248,94,22,252,102,7,65,77,81,60,97,84,161,169,105,30,160,115,138,140,129,
+27,125,127,128,125,128,141,136,157,125,31,86,205,185,120,199,27,244,227,222,
+239,31,248,102,159,7,247,30,29,251,73,89,10,14,32,29,251,14,247,145,43,29,
+247,226,248,199,21,118,10,247,151,6,190,251,25,5,71,49,10,233,6,98,116,120,
+112,102,182,10,167,170,170,187,159,31,161,149,144,143,154,247,70,10,106,6,
+251,18,247,76,247,109,29,14,131,29,152,26,152,63,10,103,247,96,247,141,29,
+144,141,148,149,30,14,131,29,152,26,152,247,144,10,234,58,10,131,29,151,62,
+29,251,64,247,118,65,10,14,83,29,144,248,211,58,10,65,29,32,10,247,21,248,
+211,58,10,32,10,247,22,249,86,65,10,14,194,29,149,160,105,29,248,16,6,99,
+116,120,112,102,178,29,159,163,175,159,31,169,155,5,247,52,117,29,251,3,251,
+195,7,14,43,10,251,212,249,108,180,10,225,247,125,10,134,98,113,135,29,61,
+10,251,117,249,100,65,10,14,35,10,114,249,86,65,10,14,44,29,247,16,249,64,
+212,29,133,131,26,124,247,0,29,44,29,247,165,248,106,21,144,146,142,146,144,
+26,154,128,150,125,128,134,136,125,130,30,54,251,15,5,133,129,137,135,134,
+26,124,151,128,153,150,144,142,153,148,30,14,39,10,130,249,115,146,29,39,
+10,251,38,249,6,58,10,35,29,176,247,98,247,54,29,147,26,154,133,29,132,131,
+209,10,40,10,247,49,248,74,146,29,40,10,159,247,221,58,10,36,29,135,247,96,
+54,29,247,210,124,21,247,12,148,215,204,234,26,190,115,184,99,163,30,108,
+157,110,148,62,151,78,149,114,147,114,155,8,115,155,126,164,168,26,201,197,
+184,218,215,196,10,132,7,174,98,94,247,16,10,175,127,210,117,10,167,109,190,
+116,190,132,8,74,247,72,10,221,29,133,155,131,31,129,160,169,147,29,60,29,
+251,18,248,211,21,247,27,247,1,5,153,149,141,142,150,247,134,29,125,127,247,
+115,29,33,29,251,95,248,254,84,10,33,29,251,62,248,179,21,152,150,140,142,
+147,26,154,193,29,137,130,247,24,29,150,149,141,143,147,26,154,128,150,125,
+198,29,52,10,247,231,249,115,187,10,247,0,29,52,10,247,95,249,137,65,10,14,
+32,29,247,12,247,52,21,160,151,148,155,155,247,73,10,251,128,247,10,29,14,
+60,29,37,251,36,247,53,10,145,26,153,127,150,125,190,10,131,29,151,62,29,
+251,65,247,146,125,10,38,10,247,134,247,165,247,1,29,127,130,136,135,128,
+26,126,151,127,180,29,38,10,247,25,247,137,85,29,36,10,111,249,114,77,29,
+247,13,248,31,21,251,236,99,7,105,10,91,247,107,247,150,251,107,91,247,133,
+10,99,247,236,173,6,160,150,147,157,155,128,148,118,31,105,205,159,202,10,
+251,12,167,29,187,73,251,150,205,213,10,73,105,6,118,128,130,123,121,150,
+131,160,31,225,22,247,150,61,251,150,6,14,32,10,247,139,249,1,53,29,61,10,
+251,118,249,128,125,10,63,29,247,19,248,155,74,10,153,145,192,29,35,10,231,
+249,1,53,29,247,218,248,148,138,29,247,154,6,98,116,120,111,103,238,10,125,
+116,247,51,29,167,166,166,192,165,31,155,147,145,146,151,247,70,10,251,26,
+6,14,93,10,251,58,248,253,139,10,126,150,31,14,60,10,247,85,251,36,86,10,
+44,29,240,251,36,144,10,39,10,37,46,247,53,10,145,26,153,175,10,35,29,247,
+12,247,40,53,29,40,10,223,252,26,86,10,214,29,175,127,210,45,29,251,33,247,
+146,126,10,43,10,251,54,251,22,21,145,149,141,143,164,10,33,29,52,248,121,
+21,160,150,148,155,155,128,148,118,31,251,128,247,10,29,14,85,10,151,146,
+140,141,154,30,113,118,126,115,110,238,10,126,116,135,137,120,27,113,127,
+148,158,164,159,169,178,170,31,219,207,157,172,143,221,8,14,32,10,144,249,
+94,43,29,35,10,251,42,128,29,247,109,156,29,251,5,49,10,247,170,49,29,251,
+5,6,137,248,207,21,69,251,5,209,6,247,204,251,33,161,29,251,137,7,116,129,
+241,10,247,94,247,117,10,247,169,190,21,248,59,7,86,29,14,37,29,251,130,248,
+55,43,29,248,102,190,21,247,148,7,103,29,80,183,206,29,126,115,135,137,121,
+27,112,127,148,158,167,163,163,200,171,31,149,145,144,146,150,26,155,128,
+148,118,30,38,206,21,235,29,14,42,10,110,247,93,145,10,42,10,251,28,231,109,
+29,133,205,10,152,130,31,14,42,10,251,27,247,115,65,10,14,81,10,248,3,247,
+80,247,53,10,186,10,143,152,148,30,14,248,144,248,156,21,222,38,116,10,188,
+107,251,25,79,10,247,25,251,12,6,194,94,79,168,69,27,251,16,40,39,251,16,
+251,16,238,38,247,15,210,197,167,196,186,31,70,240,7,247,121,29,248,54,188,
+202,29,251,168,251,30,21,238,215,64,40,43,63,62,42,42,63,216,236,235,215,
+216,234,31,14,34,29,251,64,247,125,76,10,34,29,251,63,248,0,65,10,14,228,
+10,251,20,247,1,33,247,23,150,151,140,140,157,30,113,116,128,118,110,182,
+10,171,162,159,236,192,31,178,160,151,150,154,26,155,29,14,124,10,122,122,
+70,10,44,247,128,78,10,162,10,80,82,77,140,8,251,8,6,118,128,131,122,122,
+70,10,169,247,120,65,10,14,48,29,247,3,249,64,54,29,48,29,247,72,248,155,
+21,145,147,141,145,144,26,153,127,151,125,129,134,136,125,129,247,62,29,151,
+128,153,149,144,143,152,148,30,14,41,29,247,156,247,121,53,10,41,29,247,19,
+247,12,109,29,133,205,10,152,130,31,14,39,29,136,247,93,247,54,29,148,26,
+153,133,29,198,29,42,29,247,74,247,155,145,10,34,10,247,179,248,113,187,10,
+151,247,116,29,34,10,247,42,248,163,247,129,10,142,145,147,30,243,223,243,
+55,5,132,148,144,137,146,27,153,150,247,117,29,34,10,247,66,251,96,21,145,
+149,141,143,144,26,154,128,150,124,189,10,50,29,239,247,43,21,145,147,141,
+145,186,10,142,153,148,30,14,33,10,251,24,248,236,84,10,33,10,251,11,248,
+161,21,149,148,142,144,147,26,154,128,150,125,247,106,29,128,137,135,112,
+29,54,10,96,247,104,53,10,54,10,251,71,247,126,65,10,14,247,63,248,156,21,
+222,38,116,10,188,107,76,6,117,128,130,123,123,247,93,29,202,252,55,247,127,
+29,150,247,88,29,99,247,135,6,178,184,139,139,150,148,8,163,168,166,149,176,
+247,4,29,119,128,130,123,122,150,247,126,29,99,247,132,6,221,70,199,45,79,
+98,119,86,91,30,247,2,247,12,7,160,151,148,155,155,247,73,10,14,50,29,57,
+252,148,86,10,38,29,51,249,18,127,29,38,29,251,89,248,246,85,29,37,29,143,
+247,218,53,29,215,29,198,10,247,125,6,161,150,148,156,156,128,147,92,29,130,
+123,62,10,247,101,247,162,127,29,248,102,248,21,21,171,98,87,155,52,29,251,
+58,247,143,126,29,34,29,85,247,171,53,29,162,10,80,82,77,140,8,251,8,6,118,
+128,131,122,122,70,10,168,247,148,126,29,40,29,251,42,248,203,78,10,40,29,
+231,248,110,53,29,114,29,247,40,247,162,21,251,26,251,1,5,126,130,136,135,
+128,26,125,150,128,154,145,150,29,150,137,142,125,150,31,14,68,10,247,25,
+46,247,53,10,144,26,154,175,10,48,29,137,251,36,144,29,41,29,247,43,252,88,
+144,10,39,29,247,12,247,35,53,29,42,29,168,252,54,247,53,10,145,26,152,127,
+151,125,189,10,33,10,251,150,248,196,43,29,33,10,123,248,103,53,29,248,122,
+248,55,21,110,29,81,163,206,29,125,115,247,51,29,168,161,160,202,173,31,150,
+145,143,146,150,26,155,128,148,118,30,110,6,14,42,29,184,247,46,76,10,247,
+210,124,21,247,5,146,211,191,214,26,175,119,174,107,160,30,77,10,116,119,
+247,110,10,146,7,234,29,168,115,179,123,190,134,8,74,162,29,170,147,29,124,
+10,122,122,70,10,232,247,129,21,145,148,141,143,145,26,153,128,151,124,129,
+133,135,126,130,30,55,251,15,5,131,127,138,138,133,26,124,151,128,153,150,
+144,143,152,148,30,14,247,1,247,198,21,247,149,137,29,251,145,6,243,162,212,
+202,235,148,10,251,15,38,49,251,20,119,31,80,49,10,195,99,85,75,10,195,137,
+6,149,88,151,111,167,101,8,68,191,217,98,222,27,204,201,164,185,189,31,167,
+165,151,155,152,26,152,247,19,10,73,80,168,195,97,31,116,168,129,162,129,
+180,8,141,247,144,7,219,10,251,147,6,14,247,63,247,119,21,165,6,247,8,231,
+213,234,233,54,212,251,1,31,251,33,6,118,128,131,122,247,132,29,247,26,6,
+186,139,139,143,145,31,147,143,144,148,148,247,70,10,73,6,247,118,4,247,127,
+182,247,105,29,247,164,120,21,198,7,155,131,148,125,125,131,130,123,30,80,
+118,7,122,130,132,125,126,149,131,155,31,160,251,37,6,76,154,122,192,174,
+168,161,165,150,129,148,127,132,134,136,130,134,30,127,132,136,137,126,27,
+117,135,145,172,31,247,36,186,7,155,149,147,152,153,130,146,122,31,14,247,
+80,247,68,21,128,68,104,85,104,138,8,123,128,129,125,122,247,93,29,247,215,
+6,188,179,183,192,155,128,150,124,124,131,130,121,137,31,110,136,124,122,
+117,27,251,133,6,163,170,156,182,146,190,8,247,21,247,8,10,251,18,6,138,160,
+139,147,136,157,8,247,22,247,8,10,251,33,6,137,148,139,139,128,174,8,131,
+168,134,164,155,26,191,183,182,191,173,163,126,106,166,188,10,144,117,160,
+73,31,70,247,99,10,220,6,141,130,140,121,140,119,8,54,247,99,10,14,247,11,
+190,21,90,49,10,248,48,6,159,151,149,155,156,128,147,118,31,32,247,63,6,169,
+197,143,148,152,156,8,161,153,155,150,152,27,154,152,132,122,159,31,124,155,
+143,137,148,27,154,150,150,153,151,133,147,121,153,31,165,105,123,146,113,
+27,102,120,123,79,102,31,225,51,116,10,175,107,251,44,247,87,247,195,94,247,
+98,29,235,252,92,116,10,188,6,191,251,138,21,247,44,251,107,251,44,6,14,113,
+10,113,10,191,29,192,10,248,157,248,213,21,144,146,141,146,145,26,153,127,
+152,125,129,132,134,129,132,30,252,44,252,239,5,135,132,136,132,133,26,124,
+151,127,154,148,146,144,149,146,30,247,63,248,41,21,145,135,134,142,133,27,
+134,136,138,135,133,31,114,107,116,130,114,27,89,104,178,193,193,175,177,
+191,158,157,134,129,151,31,149,132,141,134,144,117,142,127,149,131,148,140,
+142,140,24,147,140,5,146,140,145,145,146,26,140,139,142,138,141,30,135,154,
+138,149,150,26,145,140,144,140,144,30,142,152,139,139,142,26,152,129,149,
+126,132,132,135,133,135,30,137,137,138,138,137,135,8,153,112,120,144,115,
+27,63,82,80,59,59,195,79,214,189,208,174,164,144,137,145,137,142,31,247,22,
+43,21,93,108,127,113,113,31,115,113,125,102,101,26,101,153,102,163,114,30,
+112,165,170,127,183,27,183,171,151,165,164,31,163,165,153,176,177,26,221,
+83,196,58,30,92,4,192,174,102,84,115,131,115,123,121,31,120,123,120,132,106,
+27,87,103,176,193,165,147,162,155,157,31,158,156,156,146,173,27,14,248,95,
+247,63,21,101,189,123,155,105,163,113,29,247,87,247,18,6,179,121,179,106,
+170,97,65,113,24,122,133,133,132,125,26,127,150,127,152,143,144,140,142,146,
+30,226,170,156,112,151,118,169,87,25,145,128,5,198,49,29,112,6,113,183,131,
+152,126,160,224,169,24,156,145,145,146,152,26,151,128,151,127,135,130,137,
+138,135,30,252,21,230,21,247,40,10,14,129,29,248,54,248,161,53,29,37,29,251,
+5,248,95,21,84,95,97,87,87,183,97,193,239,29,109,109,115,162,167,167,163,
+162,168,31,195,247,27,247,22,10,129,30,251,6,41,5,127,129,137,135,130,26,
+124,150,128,154,147,142,141,148,150,30,14,67,29,247,21,248,61,139,10,125,
+150,31,14,34,29,251,188,248,8,78,10,247,218,156,29,251,47,49,10,247,195,6,
+98,116,120,112,102,26,98,169,115,190,182,247,46,10,125,115,247,51,29,163,
+160,164,174,158,31,186,164,139,139,154,247,70,10,251,47,6,137,247,18,29,48,
+29,247,67,247,223,21,98,107,109,100,99,171,109,180,31,150,6,181,171,169,179,
+178,107,169,97,31,14,71,29,251,14,247,128,43,29,61,29,130,247,130,146,10,
+40,29,201,248,186,50,10,33,10,133,248,179,50,10,44,29,247,23,247,193,21,97,
+107,108,100,100,171,109,181,31,149,6,182,171,169,178,179,107,169,96,31,14,
+35,29,251,14,247,133,43,29,36,29,251,9,253,4,144,29,60,29,37,251,36,247,53,
+10,145,26,153,127,150,125,190,10,50,29,57,252,148,86,10,33,29,251,221,248,
+214,131,10,32,29,118,140,29,176,247,13,247,22,10,130,30,251,6,41,5,126,128,
+137,136,130,26,124,151,247,115,10,58,29,247,128,249,27,247,52,29,128,150,
+124,131,134,137,130,130,30,251,6,42,5,128,130,136,133,131,26,124,247,89,10,
+149,30,14,56,29,247,37,247,115,54,29,248,143,248,148,21,168,6,90,10,247,182,
+252,103,5,146,127,143,123,119,26,81,96,100,76,30,75,98,10,204,6,188,179,156,
+173,170,31,174,180,144,158,140,240,8,14,247,219,247,237,21,247,59,170,29,
+251,59,41,7,154,29,237,251,135,40,6,230,29,40,247,135,236,88,10,14,247,68,
+247,184,21,213,200,164,155,199,27,212,176,109,76,143,31,251,203,7,74,138,
+94,95,76,27,78,75,10,201,6,230,137,210,210,137,230,8,247,209,7,220,72,196,
+44,78,102,121,83,87,30,199,58,7,153,10,168,251,209,247,127,29,150,247,88,
+29,99,6,14,247,84,247,192,21,207,247,106,7,161,150,242,29,251,106,247,4,6,
+217,29,71,83,204,29,195,251,31,154,10,187,31,247,28,247,73,7,220,29,14,112,
+10,156,128,147,117,31,251,21,6,116,129,241,10,146,6,251,45,251,19,5,247,70,
+38,7,247,122,10,251,209,90,49,10,240,6,14,247,99,248,55,21,59,6,116,129,241,
+10,167,251,209,247,123,10,247,24,6,159,150,148,156,155,128,148,119,31,99,
+247,133,6,214,200,164,154,73,10,103,121,83,86,30,82,247,103,21,146,149,141,
+143,144,26,153,127,151,125,128,134,135,126,130,30,54,251,15,5,132,129,138,
+136,133,26,124,151,128,153,149,145,143,152,148,30,14,33,29,82,248,198,78,
+29,47,29,251,6,247,234,21,150,222,10,134,129,26,125,247,89,10,149,30,14,35,
+10,247,0,249,78,247,22,29,142,159,175,29,167,147,144,157,27,150,151,135,128,
+157,31,115,179,158,132,162,27,165,159,247,7,10,38,10,247,32,247,153,206,10,
+145,247,90,10,140,131,147,31,134,145,5,14,38,10,248,15,247,115,212,29,134,
+130,26,124,247,0,29,38,29,251,82,249,6,87,29,38,29,188,248,224,53,10,36,10,
+251,7,211,29,148,145,136,145,27,154,150,150,154,147,138,140,132,147,31,133,
+145,5,14,46,10,246,247,150,87,29,14,14,247,109,248,35,21,117,121,122,117,
+118,156,121,161,161,156,156,161,160,122,157,118,31,247,65,140,21,117,121,
+121,118,117,157,121,161,160,157,157,160,161,121,157,118,31,233,55,21,130,
+100,131,123,119,115,8,97,102,92,119,77,27,76,93,159,181,102,31,119,163,131,
+155,130,178,144,72,147,108,162,104,8,91,172,189,114,203,27,198,186,160,180,
+171,31,168,176,150,174,144,211,8,251,71,247,139,161,10,131,102,21,247,29,
+247,3,251,0,251,27,251,29,251,1,251,1,251,28,251,27,251,1,247,1,247,28,247,
+25,247,2,247,3,247,23,31,14,247,197,248,199,161,10,48,251,52,244,29,247,162,
+52,21,134,72,130,108,116,105,8,90,106,90,114,75,27,79,94,160,180,106,31,110,
+176,128,173,133,212,149,99,147,122,158,117,8,97,174,188,118,202,27,201,188,
+160,181,174,31,158,161,147,156,149,179,8,41,226,244,29,14,247,192,117,21,
+155,210,186,219,227,247,2,8,213,233,164,191,201,26,202,85,192,74,75,93,98,
+63,118,30,217,114,95,178,75,27,74,88,86,71,87,155,104,204,51,31,247,9,251,
+48,169,86,160,59,8,14,246,247,162,21,225,32,220,251,9,175,71,186,224,227,
+247,15,219,235,77,209,251,16,247,68,110,196,96,58,83,60,251,6,251,35,8,14,
+248,130,22,155,7,251,21,158,80,206,247,24,26,156,110,145,129,148,128,8,104,
+169,186,115,181,27,209,194,196,212,209,89,194,76,120,128,136,126,112,31,137,
+138,130,134,134,137,8,161,170,147,163,168,26,208,83,193,68,68,84,85,69,112,
+144,125,165,97,30,156,104,120,145,118,27,79,88,82,70,67,195,83,210,202,192,
+177,210,173,31,140,120,5,133,7,138,83,110,76,98,106,114,120,121,132,66,124,
+8,123,7,14,247,34,22,248,9,157,6,251,17,145,81,205,141,247,23,8,74,173,175,
+114,195,27,193,184,186,197,192,119,170,56,215,31,55,216,124,161,109,229,127,
+68,92,71,58,74,8,77,88,112,95,90,26,81,186,91,196,195,179,168,200,168,30,
+251,20,144,71,64,251,14,27,14,247,228,248,49,21,145,117,119,142,118,27,251,
+11,44,44,251,10,251,10,234,44,247,10,247,10,234,234,247,10,219,94,212,69,
+176,31,227,247,83,5,97,170,170,109,149,27,146,143,143,144,143,137,143,133,
+149,31,117,173,120,192,136,175,8,158,138,138,142,133,27,135,135,137,131,129,
+31,120,122,74,115,103,136,8,121,136,135,137,131,26,128,163,132,178,30,159,
+6,159,140,5,141,6,251,49,251,121,21,234,216,64,47,45,64,63,45,46,63,214,232,
+231,215,216,229,31,14,247,214,247,172,21,246,148,224,233,247,1,26,247,10,
+43,234,251,10,251,10,44,44,251,10,251,1,224,45,245,130,30,50,251,41,100,247,
+41,251,44,183,247,44,247,40,178,251,40,7,114,248,105,21,235,216,64,47,45,
+63,63,45,46,63,214,233,230,215,216,229,31,14,247,166,247,40,21,144,126,122,
+143,125,27,87,93,94,89,110,161,120,173,211,190,194,218,31,247,139,7,186,132,
+179,75,70,26,96,131,105,119,94,30,162,6,169,176,155,185,188,26,202,115,199,
+89,199,30,97,190,138,140,134,144,133,148,25,188,102,7,14,247,35,248,43,21,
+115,109,124,104,135,101,8,44,94,235,6,143,100,153,104,162,110,72,72,24,171,
+107,206,207,169,115,171,126,180,133,25,44,184,234,7,180,145,173,153,167,162,
+206,71,24,171,171,72,207,161,164,154,175,144,180,25,235,184,43,6,134,179,
+124,175,117,166,206,206,24,107,171,72,72,112,161,99,155,103,143,25,234,94,
+45,7,103,135,98,121,114,117,71,207,24,107,107,5,247,114,93,21,220,204,76,
+60,58,75,75,59,60,75,203,218,218,203,204,216,31,14,200,22,248,115,248,115,
+252,115,6,247,130,251,33,21,195,183,95,83,86,94,95,86,84,95,183,193,193,183,
+184,192,31,14,247,189,248,92,21,236,218,62,43,41,62,61,42,44,61,217,236,233,
+217,219,232,31,145,179,21,251,13,42,45,251,11,251,12,234,43,247,12,247,10,
+235,235,247,11,247,9,43,236,251,7,31,14,247,195,248,92,21,41,60,62,43,41,
+216,61,237,235,217,217,236,234,61,218,45,31,247,171,252,92,21,248,199,252,
+199,252,199,7,247,170,248,132,21,247,13,236,45,251,11,251,12,44,43,251,11,
+251,11,43,235,247,11,247,8,235,237,247,7,31,14,158,22,248,199,247,174,252,
+199,6,14,199,248,117,21,252,117,248,115,248,117,7,14,156,22,248,203,248,203,
+252,203,6,248,146,252,146,21,252,89,248,89,248,89,6,14,248,167,190,21,251,
+123,248,70,251,124,252,70,5,14,163,247,107,21,248,60,94,10,252,60,6,14,248,
+221,247,159,21,252,60,6,163,171,160,181,154,26,147,132,146,130,132,135,137,
+132,133,30,100,94,120,124,65,96,8,125,131,136,136,131,26,132,143,135,158,
+129,30,198,106,170,115,169,104,8,127,149,144,135,145,27,149,147,145,147,154,
+123,171,110,183,31,248,60,6,14,247,53,247,158,21,169,184,154,170,154,26,147,
+131,145,130,132,135,136,126,128,30,108,104,110,116,79,105,8,120,129,135,135,
+132,26,133,143,133,146,135,30,145,136,140,138,143,137,145,136,25,153,130,
+188,110,163,119,173,100,25,132,145,143,137,146,27,148,146,146,147,154,118,
+181,115,171,31,247,179,94,10,14,247,208,127,21,248,52,7,117,170,184,117,154,
+27,147,146,146,148,146,137,143,131,145,31,99,172,121,160,108,189,136,143,
+136,143,136,145,136,144,136,144,138,140,8,247,59,10,105,81,116,110,102,108,
+8,126,129,136,134,133,26,129,145,132,147,154,169,153,169,187,30,252,52,7,
+14,247,155,248,174,21,252,52,7,162,108,94,161,124,27,131,132,132,130,132,
+141,135,147,133,31,184,101,154,121,184,65,8,126,146,142,136,148,27,146,143,
+144,156,149,31,171,195,165,171,175,169,8,152,150,142,144,145,26,148,133,147,
+131,124,107,124,110,93,30,248,51,7,14,247,166,247,2,245,29,110,165,107,247,
+65,29,147,143,31,183,212,158,164,247,40,29,95,117,116,107,30,247,174,7,116,
+171,183,118,101,10,171,154,168,185,30,14,247,87,99,21,95,247,106,183,7,251,
+24,247,81,245,29,112,165,106,247,65,29,146,143,31,182,213,159,163,247,40,
+29,94,117,117,108,30,247,173,7,117,170,184,117,101,10,172,154,168,184,30,
+14,247,161,249,27,21,251,137,251,234,247,140,251,236,195,140,247,138,247,
+235,251,136,247,233,5,247,60,251,231,21,251,90,251,174,251,89,247,174,247,
+89,247,171,5,14,198,248,101,21,247,133,252,77,247,132,248,77,5,14,247,197,
+248,202,21,251,55,251,23,251,17,251,48,251,50,247,20,251,19,247,53,247,52,
+247,21,247,19,247,48,247,46,251,22,247,21,251,46,31,14,248,147,247,56,21,
+248,32,93,251,237,251,143,7,168,183,154,171,154,26,146,131,146,132,132,134,
+136,126,128,30,110,104,106,114,81,107,8,123,130,133,134,133,26,132,142,134,
+147,135,30,216,94,161,123,178,94,8,132,145,143,136,145,27,147,147,146,147,
+153,118,180,114,173,31,14,247,79,247,152,21,247,81,251,254,5,124,147,149,
+131,149,27,146,142,142,147,144,138,143,135,151,31,251,36,247,245,247,36,247,
+246,5,142,146,141,148,146,26,145,136,142,132,129,134,135,120,126,30,14,248,
+50,247,152,21,251,81,247,255,5,157,127,133,144,129,27,132,136,136,133,132,
+141,130,142,132,31,247,36,251,246,251,36,251,245,5,135,127,138,135,134,26,
+131,142,136,146,149,149,147,154,147,30,14,247,225,22,247,103,248,235,5,85,
+6,76,251,55,5,251,151,6,77,247,55,5,88,6,247,95,252,235,5,247,42,248,21,21,
+251,3,251,226,5,132,6,36,247,226,5,14,247,245,247,220,21,251,172,247,239,
+5,123,108,134,120,113,26,116,147,123,163,109,30,213,48,79,251,1,5,119,104,
+128,107,117,26,117,148,114,163,101,30,166,94,139,139,128,26,123,128,131,117,
+30,114,63,234,6,186,169,143,147,154,31,161,150,151,165,174,26,184,129,160,
+79,219,30,102,187,126,167,169,26,158,143,150,155,171,30,247,218,252,38,5,
+156,169,144,157,163,26,164,131,156,109,176,30,96,192,5,98,190,130,158,174,
+26,157,143,154,152,172,30,185,247,2,5,159,6,161,148,130,115,143,31,137,141,
+129,141,129,30,156,199,142,155,178,26,197,118,163,89,30,64,6,100,127,149,
+170,31,155,7,140,153,5,94,93,125,110,90,26,108,148,112,155,124,30,127,152,
+155,135,174,27,175,6,14,248,48,247,158,21,251,107,251,185,88,247,237,248,
+199,251,237,88,247,185,251,87,251,185,88,7,14,248,160,248,235,21,63,123,101,
+105,126,132,149,199,113,30,117,190,121,166,117,158,8,167,106,93,154,90,27,
+251,20,34,42,251,10,68,174,81,204,101,31,170,121,155,134,195,130,146,186,
+24,104,145,129,142,122,146,8,80,162,104,190,199,26,217,206,206,217,191,171,
+111,53,182,30,73,172,172,114,192,27,214,184,198,237,31,152,7,150,7,165,251,
+233,21,133,168,137,145,133,155,8,198,119,100,169,85,27,64,71,77,69,114,146,
+107,151,112,31,183,43,139,139,114,26,108,106,112,100,102,112,155,181,109,
+30,97,196,128,154,123,154,118,153,25,160,107,97,151,100,27,133,6,130,6,138,
+95,177,127,151,131,158,111,25,196,49,139,139,166,111,8,104,173,180,119,180,
+27,189,202,162,173,185,31,183,172,160,174,176,26,156,135,156,128,163,30,88,
+247,5,137,146,163,26,165,158,158,166,177,158,116,71,156,30,14,144,150,21,
+161,152,144,144,151,27,148,148,136,134,146,31,104,191,139,139,170,27,183,
+186,171,193,176,31,171,187,156,203,214,26,195,152,7,190,144,133,70,157,31,
+185,251,71,5,89,151,158,113,161,27,164,183,161,167,168,31,148,147,146,148,
+158,162,120,160,24,133,124,134,137,133,27,119,129,152,177,129,31,108,247,
+11,125,192,120,171,115,153,25,237,174,182,180,197,26,228,67,206,43,78,91,
+118,93,92,30,187,101,97,160,82,27,251,2,52,47,251,7,72,160,105,206,103,31,
+180,116,157,119,113,26,133,138,134,135,122,30,159,133,5,180,188,151,161,170,
+26,164,122,159,104,157,30,79,170,139,139,131,145,8,117,157,128,161,166,26,
+193,180,181,193,209,171,86,251,8,30,251,51,7,80,136,112,128,109,30,119,132,
+126,122,129,27,136,134,142,144,131,31,160,110,125,145,116,27,109,112,122,
+109,119,31,128,123,135,129,126,102,8,247,235,247,247,21,247,21,138,140,125,
+188,30,158,169,157,145,171,27,196,180,103,88,106,119,108,108,123,31,108,123,
+120,133,77,124,8,14,174,248,199,21,247,132,252,199,5,189,6,247,132,248,199,
+5,252,90,88,21,248,14,6,251,81,252,72,5,14,174,22,248,166,6,251,132,248,198,
+5,89,6,251,56,252,147,21,247,81,248,71,247,81,252,71,5,14,247,193,227,21,
+63,224,5,248,167,89,252,110,7,85,200,5,71,6,247,140,251,173,247,139,247,173,
+5,71,6,85,78,5,248,110,89,252,167,7,14,247,193,249,9,21,214,54,5,252,167,
+189,248,110,7,193,78,5,207,6,251,139,247,173,251,140,251,173,5,207,6,193,
+200,5,252,110,189,248,167,7,14,248,18,248,14,21,186,229,5,143,146,141,146,
+144,26,152,127,150,125,128,132,134,125,131,30,79,251,6,5,251,137,72,29,247,
+111,6,91,49,5,251,63,49,10,247,36,6,97,58,5,135,132,137,133,134,26,126,151,
+127,153,150,146,144,154,146,30,194,243,5,247,134,98,29,251,107,6,187,229,
+5,247,59,203,29,14,248,158,247,8,247,14,10,252,80,49,10,248,80,247,174,114,
+10,247,46,247,209,21,34,6,121,140,128,130,138,122,8,138,7,140,122,150,130,
+157,140,8,199,6,228,251,176,247,133,249,47,5,247,59,6,156,152,150,154,155,
+128,148,120,31,251,102,6,251,85,252,204,5,14,247,167,92,21,68,132,111,123,
+132,136,141,153,131,30,154,128,124,148,122,27,113,121,122,114,109,165,118,
+176,167,167,152,163,162,31,169,171,147,169,228,26,248,138,7,149,10,247,166,
+251,74,21,191,249,53,6,149,10,247,218,249,14,21,87,253,53,6,75,131,112,122,
+134,135,143,148,133,30,160,125,129,146,119,27,114,120,122,114,110,164,117,
+174,163,164,148,154,159,31,176,168,153,182,228,26,14,248,130,248,42,247,38,
+29,136,140,179,88,31,183,83,124,152,29,86,203,161,127,172,27,172,170,157,
+180,174,31,157,161,147,151,148,26,152,128,150,125,30,251,32,4,126,135,135,
+116,122,31,106,115,117,123,117,27,123,138,140,179,86,31,183,84,123,152,29,
+85,204,160,128,172,27,172,170,158,180,174,31,158,160,146,152,148,26,152,128,
+150,125,30,14,188,247,217,21,248,62,251,125,5,136,145,145,137,143,27,147,
+147,144,147,143,31,140,141,5,142,144,238,29,149,144,144,147,148,26,144,138,
+142,137,143,30,137,142,5,146,135,131,144,131,27,134,133,137,137,134,31,158,
+252,195,21,219,10,252,52,72,29,14,248,160,247,217,21,252,63,247,125,5,141,
+134,133,141,135,27,130,131,134,132,135,199,10,132,134,133,130,26,136,141,
+134,141,134,30,140,137,5,131,144,147,134,146,27,144,145,141,142,145,31,119,
+97,21,247,33,29,248,52,137,29,14,247,11,248,25,21,248,18,98,29,252,70,251,
+136,6,247,36,29,150,159,30,14,202,247,231,21,251,43,144,104,166,95,30,71,
+181,216,98,225,27,191,187,154,166,180,31,190,174,168,185,149,202,8,144,172,
+140,161,237,26,247,81,7,159,128,153,123,123,130,127,117,30,251,84,7,251,16,
+134,98,120,106,30,87,109,74,104,73,27,99,98,152,162,106,31,98,168,120,172,
+133,187,135,169,139,139,138,247,1,8,247,84,7,160,129,152,123,122,130,127,
+117,30,14,248,173,247,116,21,247,42,134,174,112,184,30,206,97,62,180,53,27,
+87,91,124,112,98,31,88,104,110,93,129,77,8,134,105,138,117,42,26,251,82,7,
+117,148,127,156,155,149,152,160,30,247,85,7,140,227,139,139,149,26,142,191,
+146,169,154,161,8,189,173,200,171,203,27,200,198,110,94,171,31,166,102,145,
+102,251,28,26,251,85,7,117,148,127,155,155,150,153,159,30,14,248,217,247,
+123,21,190,252,141,7,143,247,16,205,199,247,21,136,8,247,198,190,251,186,
+247,43,29,73,153,80,164,101,30,162,104,174,108,172,126,8,124,175,167,135,
+212,27,247,186,190,251,198,6,251,20,136,74,197,133,247,12,8,144,7,14,182,
+203,21,75,248,151,203,251,117,248,77,74,252,77,7,14,247,192,247,138,21,82,
+186,200,105,191,27,167,165,147,152,159,31,170,161,162,186,178,26,208,80,195,
+67,84,79,104,84,97,30,198,89,86,169,85,27,67,80,82,68,71,196,82,209,199,184,
+164,202,193,31,174,178,21,185,171,189,169,182,27,186,170,109,94,94,108,107,
+97,119,118,145,151,117,31,122,148,139,139,92,185,8,71,143,21,92,102,88,109,
+97,27,94,110,170,186,182,170,169,184,180,179,116,88,186,31,14,248,101,247,
+71,21,85,144,119,150,84,197,137,140,24,179,191,174,160,194,143,136,189,24,
+69,134,100,118,87,76,8,194,95,79,173,87,27,64,84,85,66,66,192,86,212,197,
+184,162,196,188,31,142,142,142,143,141,142,200,74,173,120,208,132,8,251,89,
+247,20,21,90,97,93,112,98,27,97,109,170,184,183,169,170,183,178,176,118,89,
+187,31,140,137,139,139,141,137,8,14,248,158,247,136,119,10,248,47,248,4,119,
+29,182,149,147,163,27,155,157,130,120,163,31,85,204,160,128,172,27,172,170,
+157,180,174,31,158,161,247,83,10,242,247,31,21,101,107,108,101,100,170,108,
+179,178,170,170,177,178,108,170,99,31,247,89,248,70,21,100,107,108,102,99,
+171,108,178,178,171,170,178,177,108,170,99,31,247,88,252,70,21,100,107,108,
+102,99,170,108,179,178,171,170,178,177,107,170,100,31,14,248,125,248,227,
+21,188,247,20,10,252,113,247,20,29,188,253,2,90,247,20,29,247,1,10,89,249,
+2,247,166,253,2,90,6,123,140,128,129,138,124,8,136,7,140,124,150,129,155,
+140,8,247,1,10,90,6,14,248,85,248,148,21,147,33,5,125,147,130,153,137,30,
+144,6,154,141,146,148,155,26,247,20,7,158,130,148,120,138,30,251,235,6,122,
+140,129,130,138,123,8,126,7,128,139,138,146,130,30,247,69,251,140,251,71,
+251,215,5,134,131,139,138,130,26,124,7,122,149,131,157,30,247,242,6,158,148,
+148,158,31,247,20,7,155,132,148,124,141,30,133,6,125,137,132,130,138,124,
+135,33,24,251,185,6,247,69,247,205,5,143,146,140,142,143,26,145,137,143,134,
+146,30,251,61,247,133,5,14,247,80,247,34,21,141,69,142,118,149,118,8,114,
+152,159,125,163,27,168,163,153,171,168,31,157,159,155,160,150,158,144,148,
+24,141,142,140,143,143,26,146,133,144,132,132,134,135,130,132,30,128,123,
+5,108,117,122,125,124,27,121,132,158,192,151,139,164,140,160,31,158,7,175,
+7,247,30,247,68,190,236,225,26,193,110,174,95,95,90,106,82,100,30,96,75,116,
+251,1,136,251,61,138,78,24,116,111,134,133,121,118,136,136,25,118,117,5,133,
+133,137,134,134,26,135,7,132,143,142,136,145,27,150,139,139,185,183,31,236,
+247,61,21,141,177,5,247,109,149,158,208,188,27,162,154,118,107,68,100,47,
+69,43,31,14,247,43,248,188,21,125,140,149,130,154,27,172,140,5,187,196,119,
+108,181,31,168,118,158,118,167,96,8,167,95,102,150,87,27,251,22,36,40,251,
+17,251,17,242,39,247,23,247,21,243,238,247,16,233,100,247,0,78,209,31,203,
+85,51,176,41,27,112,136,138,132,132,31,135,135,137,132,132,26,247,39,251,
+64,165,29,14,247,173,248,136,21,251,30,251,7,251,3,251,26,251,34,247,6,251,
+5,247,36,247,31,247,5,247,3,247,28,247,31,251,8,247,6,251,33,31,143,251,190,
+21,245,35,5,114,103,104,128,97,27,96,110,148,163,108,31,93,184,21,112,175,
+130,166,180,26,183,150,174,163,172,30,247,2,251,0,5,232,22,247,2,246,5,161,
+109,148,114,102,26,90,128,102,115,106,30,251,44,247,41,21,251,3,247,0,5,163,
+172,174,150,181,27,183,170,129,114,174,31,14,247,164,248,43,21,251,20,64,
+75,62,56,26,113,146,109,154,102,30,88,66,125,106,98,26,83,178,98,192,196,
+184,193,207,179,125,183,98,223,30,176,185,177,177,194,183,8,190,201,174,157,
+174,27,169,159,112,99,87,115,65,107,91,31,102,114,104,116,107,27,111,114,
+157,159,149,144,144,151,140,31,163,141,156,156,160,26,158,124,153,119,107,
+113,106,99,91,177,105,193,190,198,172,194,187,30,180,186,162,195,195,26,209,
+97,187,78,59,72,94,251,51,251,46,30,132,160,137,149,156,26,202,174,193,205,
+181,30,148,145,145,143,159,150,8,251,64,251,226,21,176,74,156,96,109,26,112,
+120,120,112,105,114,167,178,174,147,157,182,203,30,14,248,85,248,100,21,56,
+6,251,46,104,247,106,10,46,185,65,222,96,30,94,73,5,132,130,137,133,133,26,
+127,148,130,151,151,147,144,154,149,30,189,213,5,135,175,172,136,150,27,138,
+148,171,139,187,27,247,86,6,161,152,148,155,155,126,149,117,31,251,88,6,98,
+112,139,140,127,31,131,117,141,141,114,31,247,135,247,249,5,227,6,162,151,
+148,155,155,125,149,118,31,85,6,192,217,5,146,150,141,143,145,26,151,130,
+148,126,127,131,134,125,130,30,36,251,44,21,251,127,251,239,110,150,127,147,
+121,156,25,105,174,118,187,186,26,197,170,198,187,171,30,165,178,179,145,
+247,33,27,14,248,93,248,92,21,252,115,252,89,5,249,20,190,252,147,6,248,17,
+247,255,5,14,247,116,22,247,45,176,147,10,247,22,179,134,120,175,31,194,111,
+177,74,224,10,124,153,128,160,31,14,247,233,248,100,247,39,29,62,173,70,200,
+95,30,103,189,174,133,247,57,174,10,199,186,170,233,10,14,247,116,247,33,
+21,247,47,174,147,10,247,23,178,134,120,175,31,194,110,177,75,224,10,123,
+153,129,160,31,248,115,251,33,21,220,10,252,115,247,97,10,14,247,233,248,
+241,247,39,29,88,154,91,167,100,30,175,89,186,110,202,130,8,134,173,160,138,
+240,174,10,198,186,171,233,10,252,115,252,190,21,117,128,130,122,123,150,
+130,161,31,248,115,137,29,14,247,218,247,124,21,247,147,189,251,121,6,236,
+247,73,5,247,24,190,34,6,151,169,150,161,150,154,8,143,144,141,143,142,26,
+150,126,150,127,126,133,135,123,131,30,96,58,5,251,26,247,43,29,251,16,183,
+59,230,99,30,110,85,5,135,131,137,133,134,26,127,151,128,152,151,146,144,
+154,147,30,172,202,5,135,172,143,139,184,27,247,186,190,251,198,6,115,132,
+139,141,126,31,178,247,71,21,49,251,60,74,161,104,195,135,224,25,144,7,247,
+210,247,123,21,42,251,73,5,251,113,144,6,145,247,12,204,198,247,20,136,8,
+14,247,213,4,223,210,5,248,242,195,252,176,6,239,10,248,176,195,252,242,6,
+14,248,235,247,213,21,55,69,5,252,242,83,248,176,232,10,252,176,83,248,242,
+6,14,222,248,84,21,239,10,248,70,232,10,252,136,83,21,248,202,6,222,69,56,
+68,5,252,202,6,55,210,5,14,248,221,251,137,247,14,10,252,206,6,118,128,130,
+123,121,150,131,160,31,248,206,67,247,14,10,252,206,6,118,128,130,122,122,
+150,131,160,31,14,248,221,249,70,214,10,248,102,248,107,21,142,144,141,148,
+143,26,152,127,150,125,127,134,135,123,131,30,100,66,5,149,104,123,142,112,
+27,251,25,36,41,251,18,63,173,76,206,92,31,103,72,5,136,134,137,130,135,26,
+126,151,128,153,151,144,143,155,147,30,175,205,5,126,176,156,136,169,27,247,
+25,242,237,247,19,217,102,204,69,185,31,115,94,21,191,103,166,90,80,26,41,
+59,63,35,119,126,141,147,112,30,93,162,21,89,179,116,183,196,26,236,219,215,
+242,158,150,137,134,163,30,14,247,116,100,10,247,170,248,99,21,140,155,5,
+162,141,118,159,113,27,114,119,120,116,134,123,10,14,247,57,29,14,247,57,
+29,247,115,251,111,21,251,48,247,45,247,48,6,14,207,142,21,248,102,181,252,
+60,248,60,97,6,14,247,168,196,29,14,247,82,196,29,247,82,22,229,247,95,5,
+152,168,141,147,153,26,161,121,156,116,247,114,10,14,209,22,248,97,247,203,
+6,251,123,247,146,251,122,251,146,5,189,251,153,21,247,133,7,247,72,247,90,
+247,73,251,90,5,251,133,7,14,248,52,189,21,236,194,198,235,242,26,247,46,
+251,10,247,9,251,46,251,47,251,9,251,9,251,46,247,25,10,130,160,31,247,98,
+187,6,84,170,123,150,117,159,8,81,191,109,204,211,26,211,167,198,194,185,
+30,173,180,179,153,195,27,195,179,125,105,180,31,194,93,167,80,67,26,71,113,
+79,87,87,30,114,114,122,127,78,105,8,91,247,98,7,160,152,148,155,156,128,
+147,116,31,14,247,150,247,156,21,251,6,97,180,68,231,219,118,251,13,5,227,
+6,118,247,13,231,59,180,210,251,6,181,247,6,180,98,210,47,59,160,247,13,5,
+51,6,160,251,13,47,219,98,68,5,14,159,247,123,21,248,141,134,6,133,251,12,
+74,81,251,20,142,8,251,198,88,247,186,6,247,1,181,152,188,187,31,186,187,
+160,201,228,26,233,109,209,78,186,30,172,97,101,148,43,27,251,186,88,247,
+198,6,247,19,142,204,82,146,251,11,8,136,7,134,252,141,7,14,248,113,247,84,
+21,138,207,135,168,125,170,8,204,110,70,178,54,27,251,20,59,55,251,26,251,
+26,216,60,247,21,235,206,180,215,165,31,140,142,141,143,5,94,6,138,137,139,
+138,136,135,8,90,114,90,112,74,27,65,105,161,200,119,31,214,7,247,150,180,
+21,251,148,211,6,197,169,171,160,200,27,203,189,109,90,158,31,14,248,170,
+247,152,21,252,73,247,46,5,251,200,7,14,206,247,152,21,248,73,251,46,5,247,
+200,7,14,247,216,248,129,21,160,112,162,118,163,126,200,104,150,132,144,130,
+8,146,126,143,120,115,26,251,146,7,146,120,114,144,118,27,63,72,81,74,101,
+170,115,189,195,192,164,181,172,31,162,168,146,163,142,192,8,248,34,7,140,
+218,103,219,89,171,87,172,24,113,156,124,149,134,143,8,125,155,132,158,165,
+26,153,91,252,174,7,147,120,116,143,118,27,65,73,82,73,101,170,115,187,194,
+191,164,181,172,31,161,168,146,163,142,192,8,247,44,247,71,21,251,13,204,
+113,180,135,247,18,142,137,24,247,13,73,165,99,144,251,18,8,14,32,29,14,69,
+10,99,29,248,191,22,251,113,248,199,5,62,6,251,104,252,199,5,248,68,190,21,
+251,251,6,247,66,248,97,5,146,6,14,72,10,247,105,10,121,131,139,29,14,44,
+10,247,91,247,201,21,151,247,102,10,62,247,103,29,153,247,98,125,247,103,
+29,216,247,102,10,127,7,38,247,158,97,10,14,35,10,14,247,63,247,112,21,216,
+206,231,110,181,79,212,251,90,188,29,160,151,242,29,251,11,6,117,128,131,
+122,122,151,130,160,102,29,14,247,193,248,148,21,247,70,252,97,5,70,89,29,
+247,42,136,10,112,247,69,10,251,99,204,10,247,3,6,251,66,252,97,5,112,6,118,
+127,130,122,123,151,130,160,247,25,29,247,66,248,97,5,14,46,29,39,10,14,248,
+115,248,148,21,216,29,252,97,251,34,80,29,230,7,231,251,98,21,174,7,160,130,
+151,122,122,130,127,118,30,251,13,247,12,10,174,247,65,104,247,12,10,247,
+13,7,160,130,151,122,122,130,127,118,30,104,7,251,157,251,147,21,230,117,
+29,251,34,248,97,247,34,117,29,48,7,14,35,29,14,76,29,51,10,248,172,248,199,
+21,252,38,89,6,247,77,251,108,251,77,251,138,5,88,248,45,247,42,7,160,132,
+149,124,125,131,130,124,138,30,134,33,5,251,189,6,247,86,247,139,251,79,247,
+106,5,247,172,6,149,251,4,5,129,140,148,131,151,27,152,147,148,155,31,14,
+59,29,36,10,14,247,26,29,238,251,27,154,30,175,240,7,160,151,242,29,251,146,
+79,10,240,103,6,251,27,124,45,40,247,82,29,93,38,116,10,247,146,49,29,38,
+6,248,114,4,243,124,212,61,42,26,41,66,61,240,29,57,29,247,218,248,148,21,
+192,106,10,251,50,89,29,192,251,176,6,251,0,147,105,187,141,247,33,8,247,
+30,51,7,231,10,175,52,6,140,251,1,153,91,178,100,175,106,186,121,194,137,
+8,251,17,86,247,12,29,247,50,71,10,86,247,18,6,187,183,154,166,173,31,189,
+178,154,186,140,247,12,8,226,175,7,129,10,51,251,30,6,141,251,30,102,86,34,
+133,8,14,248,52,190,21,236,194,198,235,242,26,247,45,251,10,247,9,251,46,
+251,46,251,10,251,9,251,45,247,25,10,129,160,31,247,98,188,6,83,171,123,149,
+118,158,8,80,192,109,203,211,26,211,167,198,195,185,30,173,179,180,153,195,
+27,195,180,125,105,179,31,195,93,167,80,67,26,71,113,80,87,87,30,113,114,
+123,128,77,104,8,90,247,98,7,160,152,149,155,156,128,147,116,31,14,68,29,
+14,247,68,188,21,94,190,186,119,192,27,239,221,223,241,192,117,182,97,169,
+31,112,159,117,147,92,148,8,206,167,172,183,197,26,219,72,199,49,82,88,114,
+95,110,30,117,106,130,93,57,26,252,159,80,29,225,248,81,21,247,24,138,202,
+98,55,26,61,85,83,63,91,91,162,176,107,30,123,159,132,166,188,26,247,96,7,
+247,2,174,186,220,202,181,103,86,83,86,96,57,129,30,14,247,192,205,21,251,
+69,247,245,5,82,107,10,163,6,247,77,252,7,5,128,90,135,107,109,26,97,155,
+113,164,163,155,166,183,168,134,172,127,185,30,247,56,247,218,158,175,148,
+147,164,140,25,160,203,29,113,6,93,138,122,126,108,79,8,14,247,162,248,66,
+21,100,132,119,132,111,123,8,67,247,81,10,247,22,242,238,247,17,199,114,195,
+95,179,30,115,161,125,148,73,176,8,38,194,122,154,176,26,185,171,158,213,
+30,207,6,159,149,147,155,154,128,147,120,31,74,6,86,106,131,121,113,31,108,
+118,121,105,104,26,97,157,112,186,111,30,181,83,165,29,14,64,29,14,248,34,
+248,188,21,73,72,118,115,106,96,8,59,34,104,61,63,26,84,168,80,182,109,30,
+164,122,176,127,202,131,8,204,130,156,129,111,26,100,106,117,79,138,30,117,
+128,130,123,122,151,130,164,220,199,187,204,171,123,167,113,155,31,126,147,
+112,146,104,144,82,147,112,146,119,150,8,102,160,118,179,189,26,230,217,247,
+14,247,61,247,63,30,141,142,144,143,5,187,251,106,7,118,127,130,122,123,150,
+130,161,31,14,79,29,14,247,196,248,239,21,251,23,51,251,16,251,77,251,74,
+227,251,19,247,19,247,19,228,247,20,247,73,247,73,51,247,20,251,16,31,251,
+59,251,176,21,247,34,143,203,230,235,27,233,202,49,251,35,144,31,88,4,251,
+32,136,74,47,44,27,44,75,231,247,32,135,31,14,247,196,156,10,126,136,120,
+247,71,29,14,247,100,247,132,21,247,71,39,7,117,128,130,122,123,247,93,29,
+187,251,209,91,204,10,247,40,71,10,91,247,30,164,6,215,140,202,82,198,251,
+19,142,133,24,224,6,161,151,148,155,156,127,148,117,31,87,6,88,234,81,203,
+88,157,247,51,247,32,24,154,49,29,41,107,10,146,6,251,35,251,20,5,14,228,
+190,21,113,204,10,247,9,71,10,107,6,247,44,247,178,247,57,251,178,5,109,49,
+10,247,10,71,10,113,6,251,208,248,188,5,54,6,119,127,130,122,123,247,54,10,
+191,6,231,251,53,5,14,248,62,248,4,21,251,70,7,41,91,82,56,100,103,157,169,
+114,30,123,161,132,169,194,26,247,121,39,7,117,128,130,122,123,247,93,29,
+187,252,154,167,10,247,76,7,103,177,173,125,189,27,191,177,155,180,181,31,
+98,238,7,247,122,29,248,4,39,107,10,14,247,60,248,53,21,60,6,120,129,131,
+122,123,150,129,157,31,182,6,247,63,252,2,5,186,6,247,13,247,24,189,223,211,
+26,202,104,213,110,127,125,127,128,133,142,129,145,129,30,157,108,146,114,
+109,26,79,103,71,63,50,30,131,130,134,134,133,131,8,14,248,58,247,176,21,
+190,132,7,97,142,108,144,119,145,8,95,153,106,180,180,26,169,157,168,170,
+158,30,165,155,178,148,197,142,161,140,139,139,144,141,8,150,142,145,147,
+151,26,156,127,148,117,30,251,94,72,29,175,6,90,109,120,107,90,26,83,174,
+92,200,114,30,49,106,95,85,60,26,90,160,94,177,109,30,169,115,176,127,205,
+132,8,216,131,157,129,107,26,105,111,119,80,131,30,109,135,132,135,122,26,
+122,150,131,162,217,203,191,202,169,126,164,116,155,30,121,152,111,146,92,
+144,8,251,4,151,93,173,209,26,195,179,190,198,158,30,164,147,172,143,189,
+140,8,14,71,29,14,248,94,248,4,21,179,106,10,252,31,89,29,179,251,209,99,
+89,29,247,23,71,10,100,247,209,247,103,251,209,100,204,10,247,23,106,10,99,
+6,14,247,40,209,21,81,191,196,111,208,27,247,12,238,241,247,15,197,119,193,
+102,182,31,186,98,87,161,71,27,74,82,118,101,98,31,93,97,117,76,50,26,251,
+222,80,29,247,66,248,168,21,241,208,70,37,42,64,60,46,86,88,165,183,102,31,
+115,169,127,174,181,26,238,212,210,240,30,14,248,188,248,18,21,157,150,149,
+154,155,128,149,121,31,251,108,6,62,108,132,113,93,31,68,247,81,10,247,21,
+243,238,247,17,210,111,193,76,188,30,251,37,22,247,7,29,14,247,207,248,4,
+21,247,17,6,160,150,148,156,156,129,147,117,31,251,197,6,119,127,129,124,
+123,151,129,159,31,247,20,251,203,6,106,144,126,156,127,30,130,153,160,134,
+169,27,196,180,156,163,152,130,150,127,135,137,138,138,136,31,127,112,130,
+137,116,27,104,130,147,168,31,14,41,10,14,247,139,251,35,21,114,148,125,156,
+156,148,152,165,30,247,20,7,138,144,146,139,145,27,247,24,235,236,247,24,
+247,13,59,238,41,99,106,122,107,118,31,120,111,132,103,63,26,251,95,7,110,
+148,125,145,122,150,8,89,170,112,193,208,26,210,169,195,192,168,30,161,151,
+146,147,151,26,153,130,149,126,116,98,111,102,110,30,106,99,123,90,80,26,
+251,16,208,54,247,12,117,30,191,247,147,21,242,156,174,190,207,197,62,49,
+251,2,66,72,251,13,136,30,14,247,191,247,87,21,251,20,247,116,5,74,107,10,
+176,6,247,19,251,117,251,45,251,165,5,132,126,136,130,132,26,126,149,129,
+152,152,148,146,158,149,30,247,29,247,139,247,46,251,165,5,205,71,10,101,
+6,251,45,247,166,247,28,247,130,5,146,152,142,148,146,26,152,129,149,126,
+127,129,131,121,129,30,14,247,218,248,206,21,159,130,151,122,122,130,127,
+119,30,252,170,7,54,144,112,172,142,235,8,247,141,39,247,12,29,187,251,90,
+6,140,251,20,185,86,247,6,135,8,251,27,80,29,247,27,7,247,7,144,186,193,138,
+247,18,8,247,90,187,7,129,10,39,251,141,6,140,40,115,109,53,134,8,14,56,10,
+14,248,113,248,31,21,165,95,95,151,85,27,251,32,42,42,251,32,69,166,75,183,
+103,31,170,114,177,125,199,132,188,133,160,135,148,136,8,157,132,152,124,
+123,26,122,128,121,121,128,30,125,130,121,135,109,138,8,117,128,130,123,121,
+151,131,164,218,199,187,201,171,120,171,110,154,31,123,147,112,145,81,148,
+86,146,109,148,118,155,8,103,166,118,191,197,26,247,2,214,212,247,6,183,178,
+128,118,165,30,152,129,149,121,149,107,8,112,147,144,134,156,27,154,149,149,
+155,142,139,139,137,155,31,143,7,138,146,138,150,147,26,145,140,152,141,157,
+30,141,166,139,140,145,26,157,130,150,123,127,131,133,126,133,30,14,248,108,
+247,254,21,193,147,145,142,187,169,121,183,24,96,115,132,136,100,129,8,199,
+7,242,124,200,103,179,30,176,106,78,164,79,27,44,74,77,48,65,171,93,228,86,
+31,205,101,178,128,227,136,138,251,42,24,251,5,138,83,78,36,27,106,121,143,
+148,126,31,113,157,125,164,167,26,247,193,38,7,154,29,188,251,142,6,100,151,
+108,165,113,30,111,167,167,129,188,27,247,33,223,224,247,33,31,89,247,89,
+21,61,144,101,150,84,172,8,76,178,111,179,192,26,197,184,180,202,184,188,
+119,111,161,30,165,106,151,78,42,26,14,247,26,29,239,251,27,154,30,176,7,
+158,130,149,122,122,130,129,120,30,102,7,251,27,124,45,39,247,82,29,91,7,
+121,148,129,156,156,148,149,157,30,248,116,4,243,124,212,61,42,26,42,66,60,
+240,29,248,189,248,25,21,158,151,148,155,156,127,148,120,31,252,21,6,68,104,
+122,83,93,31,131,128,138,137,132,26,130,143,134,146,142,141,140,143,143,30,
+186,181,153,146,176,141,8,84,80,119,86,51,26,69,152,91,169,103,247,78,29,
+160,31,98,162,176,116,183,247,111,10,187,206,26,227,116,201,87,192,30,48,
+22,147,134,142,137,145,136,8,205,106,170,77,37,26,51,104,81,84,89,113,193,
+246,30,171,7,159,129,151,122,123,247,15,29,201,187,173,30,146,145,146,142,
+150,145,148,144,140,139,147,144,8,14,247,196,248,37,21,247,72,29,127,119,
+247,4,10,130,136,134,130,30,131,123,126,136,120,247,71,29,251,10,248,136,
+141,10,41,10,251,73,247,93,21,114,119,119,115,247,48,10,247,99,236,10,248,
+10,248,224,87,10,248,34,248,224,82,29,246,66,10,248,5,251,89,21,191,251,25,
+5,70,98,10,247,42,106,10,112,247,69,10,251,88,72,29,239,6,251,67,252,97,5,
+113,6,117,128,130,122,123,150,130,161,247,25,29,189,247,25,5,247,130,190,
+21,251,111,6,244,247,169,5,146,6,14,213,66,10,247,58,251,7,21,247,24,100,
+167,10,247,21,117,29,100,251,24,247,87,247,169,48,7,118,148,128,156,155,149,
+151,159,30,247,34,252,48,7,118,127,130,122,123,150,130,161,31,170,252,97,
+108,98,10,248,69,247,54,6,247,72,29,127,119,30,251,3,251,190,7,14,224,66,
+10,248,37,251,7,21,251,107,90,116,10,247,33,71,10,99,248,97,159,137,29,251,
+13,72,29,188,251,87,251,148,247,87,187,71,10,251,3,89,29,150,252,97,128,89,
+29,247,3,106,10,91,247,107,6,14,246,66,10,247,158,247,23,21,247,25,71,10,
+251,210,89,29,247,25,252,97,251,25,89,29,247,210,71,10,251,25,6,14,247,211,
+248,211,21,251,37,251,2,251,20,251,60,251,57,247,3,251,21,247,33,247,33,247,
+3,247,22,247,57,247,56,251,2,247,23,251,31,31,134,88,21,247,5,228,32,251,
+29,251,28,50,251,0,251,4,251,3,51,247,1,247,28,247,26,228,247,1,247,1,31,
+251,135,141,143,10,235,190,21,164,247,13,29,63,247,120,247,14,7,110,145,134,
+140,122,145,8,59,166,94,203,225,26,196,159,190,175,179,30,183,180,190,159,
+211,27,211,191,119,95,179,31,175,99,159,87,84,26,57,97,75,68,110,30,119,131,
+131,137,105,133,8,251,14,247,119,215,247,13,29,114,251,15,169,7,247,7,173,
+199,219,247,12,26,247,40,251,9,247,4,251,47,251,47,251,9,251,4,251,41,251,
+10,200,57,247,7,106,30,109,7,251,57,248,111,143,10,235,66,10,247,170,251,
+20,21,247,64,247,151,5,160,106,10,251,3,6,119,127,172,10,169,6,251,30,251,
+99,251,31,247,99,5,168,106,10,46,92,6,247,69,251,155,5,251,94,41,7,231,10,
+247,141,71,10,40,6,14,247,219,248,148,21,247,25,6,159,151,148,155,156,127,
+148,119,31,251,210,204,10,247,25,252,97,251,25,89,29,247,210,6,159,151,247,
+89,29,251,25,6,251,22,249,43,21,114,119,119,115,247,73,29,159,163,163,119,
+159,114,31,247,99,22,247,6,10,14,247,219,247,145,21,247,64,247,151,5,160,
+6,159,151,148,156,155,127,148,119,31,251,3,89,29,168,6,251,29,251,99,251,
+32,247,99,5,168,106,10,251,3,89,10,160,6,247,67,251,151,5,251,94,208,10,251,
+21,249,43,21,114,119,119,115,236,29,247,73,29,158,163,164,119,159,114,31,
+14,68,29,88,247,207,247,108,10,126,131,133,136,131,130,247,61,10,151,127,
+152,146,145,142,147,148,30,14,64,29,161,248,26,87,10,79,29,247,106,247,113,
+177,10,152,146,247,18,10,247,197,156,10,125,136,121,247,71,29,208,248,155,
+87,10,71,29,219,247,98,21,149,147,143,146,147,26,153,127,151,126,131,133,
+136,131,130,30,251,5,43,5,128,130,135,133,131,26,125,151,127,153,146,146,
+142,147,147,30,14,56,10,210,248,27,21,150,148,142,144,247,109,10,131,30,251,
+6,247,79,29,153,145,247,18,10,41,10,148,247,112,247,108,10,125,132,132,136,
+131,131,218,10,247,196,248,37,21,159,130,151,122,122,130,128,118,30,251,234,
+7,88,166,115,196,194,181,158,165,152,127,151,127,134,131,136,134,129,30,132,
+124,124,135,121,247,71,29,222,248,155,82,29,41,10,160,247,112,21,149,147,
+143,146,149,26,153,129,149,125,130,133,136,131,130,30,251,6,43,5,129,131,
+135,132,129,26,125,149,129,153,147,147,142,147,147,30,251,6,216,21,114,119,
+119,115,247,48,29,247,152,22,113,119,120,114,247,73,29,159,164,162,119,159,
+115,31,14,32,29,14,248,141,248,199,21,252,68,142,10,247,87,247,171,48,6,118,
+148,127,156,156,148,151,160,30,251,223,252,6,21,247,107,247,32,7,206,169,
+29,69,10,99,29,248,149,22,41,7,115,247,35,10,164,30,247,2,7,138,173,135,142,
+104,140,8,104,248,97,174,66,29,252,20,136,29,188,251,128,6,138,43,129,98,
+106,100,113,110,108,121,113,138,8,117,137,133,131,110,26,251,2,7,114,247,
+35,10,163,30,237,7,247,47,248,148,21,247,88,252,97,251,160,6,182,173,166,
+223,141,246,8,14,72,10,247,218,248,148,21,51,29,171,108,29,113,6,82,197,29,
+156,155,212,10,6,14,227,248,94,21,135,7,132,137,122,138,129,30,137,126,137,
+122,170,10,57,27,111,115,10,167,6,229,186,133,123,169,157,29,97,247,21,90,
+247,3,226,196,154,174,180,31,176,170,159,182,186,26,208,100,185,62,162,30,
+202,166,171,182,158,29,133,140,127,140,124,31,135,139,132,140,131,30,14,47,
+10,14,55,29,14,248,126,248,148,21,176,116,29,252,23,107,29,189,251,209,6,
+32,108,85,79,129,131,140,143,126,30,196,7,160,130,151,122,122,130,126,115,
+30,80,7,120,142,129,147,135,30,130,153,174,132,165,27,230,188,212,247,30,
+31,247,209,247,88,252,97,102,137,10,247,18,116,29,102,6,14,46,29,44,10,35,
+29,14,76,29,51,10,163,29,201,164,185,189,30,167,165,151,155,151,62,29,14,
+59,29,64,10,14,247,218,248,148,21,173,6,166,247,71,10,112,31,251,4,6,105,
+122,131,122,122,156,130,169,31,169,107,6,80,138,99,129,103,118,8,81,104,105,
+78,68,26,74,168,82,190,103,30,176,112,182,128,206,137,8,107,106,7,112,122,
+129,123,123,154,130,168,31,247,11,6,165,154,148,156,155,125,148,112,31,105,
+171,6,201,141,180,148,174,161,8,196,174,172,201,208,26,204,110,196,87,175,
+30,100,166,96,151,74,140,8,87,251,237,21,90,142,105,148,112,155,8,98,165,
+115,183,187,26,181,157,177,171,166,30,169,164,173,150,200,143,8,191,22,190,
+135,173,130,166,123,8,179,113,163,96,90,26,94,118,99,103,112,30,111,119,103,
+128,84,136,8,14,57,29,248,111,190,21,248,97,178,247,13,10,251,31,89,29,187,
+252,97,251,148,248,97,188,88,10,251,33,89,29,179,252,97,99,89,29,248,69,201,
+10,138,172,134,144,105,140,8,14,248,56,190,21,251,2,107,29,247,92,66,29,101,
+248,97,177,6,165,153,148,155,156,80,10,14,248,111,190,21,92,10,248,157,71,
+10,105,248,97,155,71,10,46,204,10,164,6,14,248,163,190,21,248,97,155,7,129,
+10,46,204,10,164,252,97,92,10,248,150,201,10,138,173,135,143,104,140,8,14,
+247,66,201,29,251,42,142,10,6,251,158,4,247,107,247,31,7,207,169,29,247,25,
+201,29,251,42,6,119,127,172,10,188,252,97,90,72,29,247,110,6,236,213,208,
+228,240,56,197,251,38,31,80,6,251,158,4,247,107,194,7,247,6,206,99,70,79,
+87,93,69,31,247,162,248,97,21,187,71,10,251,40,6,117,127,130,123,122,151,
+130,161,31,187,252,97,91,6,117,127,130,122,123,151,130,161,247,24,10,14,247,
+138,201,29,251,187,251,95,6,118,148,127,156,156,148,150,161,30,247,44,247,
+34,252,97,121,205,29,247,133,6,235,212,207,229,240,56,197,251,37,31,251,4,
+6,251,158,4,247,107,247,1,7,206,181,129,115,247,80,29,72,30,14,248,124,247,
+209,21,251,138,247,97,29,247,138,122,6,87,118,88,101,97,30,93,98,90,117,80,
+27,74,83,167,197,89,31,148,131,133,142,129,27,125,129,130,126,119,165,109,
+179,111,31,103,193,179,126,193,27,213,199,166,195,193,31,189,191,166,201,
+200,26,220,7,201,115,199,96,189,30,193,91,83,164,66,27,73,84,119,99,93,31,
+154,7,160,129,150,123,122,130,128,118,30,251,1,7,118,148,127,156,155,147,
+148,159,141,30,141,161,145,151,156,157,8,173,172,193,160,191,27,184,185,123,
+114,167,31,184,99,170,73,86,26,14,247,100,247,209,21,45,247,87,176,71,10,
+251,1,6,119,127,172,10,159,252,97,119,72,29,247,1,71,10,102,247,107,233,107,
+6,251,49,211,47,247,16,196,187,160,179,172,30,175,181,156,200,224,26,230,
+7,224,122,202,104,181,30,178,106,90,161,84,27,85,90,118,101,103,31,99,96,
+120,79,50,26,191,22,247,20,192,211,232,230,185,71,251,24,30,48,7,251,23,92,
+72,48,46,87,211,247,18,30,14,248,61,247,138,21,251,87,70,7,231,10,247,62,
+6,159,151,149,155,155,247,55,29,155,156,127,148,119,31,251,137,6,39,55,67,
+54,74,184,90,226,107,31,80,96,117,111,57,251,30,8,111,6,119,127,247,85,10,
+196,6,145,150,143,146,148,154,217,247,26,177,182,213,175,8,247,13,190,21,
+35,6,45,61,189,199,193,203,190,208,31,247,35,6,14,247,73,248,148,21,252,97,
+48,7,226,29,248,97,247,206,247,95,247,9,10,251,44,252,41,116,10,14,247,138,
+247,98,21,195,210,190,162,193,27,198,175,94,67,63,106,92,81,133,31,114,136,
+128,130,123,26,122,151,130,161,222,202,217,241,242,80,208,52,84,85,118,91,
+70,30,247,136,247,18,7,147,36,5,114,141,149,127,156,27,154,148,149,154,142,
+139,143,138,148,31,129,247,5,5,171,135,134,144,107,27,251,217,106,29,6,14,
+247,4,247,209,21,146,7,192,170,205,184,179,30,164,167,185,155,184,27,187,
+188,121,110,172,31,162,119,148,124,141,114,8,119,141,147,130,155,27,156,148,
+151,160,31,247,1,7,160,130,150,122,123,129,128,118,30,124,7,179,93,84,159,
+74,27,65,83,114,85,91,31,96,89,115,79,77,26,58,7,78,166,77,189,87,30,83,193,
+199,112,213,27,193,179,152,175,193,31,180,167,164,169,159,26,152,129,148,
+125,129,133,136,130,131,30,81,89,83,111,74,27,80,90,161,185,98,31,101,181,
+118,190,191,26,156,247,138,7,160,151,149,155,155,128,148,117,31,14,214,29,
+175,127,210,247,146,29,35,10,14,35,10,14,35,10,14,91,10,248,24,248,148,21,
+189,116,29,251,190,107,29,189,251,209,6,34,110,83,85,127,130,141,145,121,
+30,193,7,160,130,151,122,122,130,126,116,30,79,7,120,142,129,146,135,30,130,
+154,173,132,168,27,174,168,149,158,160,31,171,167,160,211,221,26,247,209,
+233,252,97,97,247,104,10,190,6,237,181,146,160,171,31,179,166,163,187,194,
+26,194,117,184,99,167,30,108,161,100,149,78,140,8,86,4,234,137,181,107,67,
+26,102,126,108,115,121,30,120,124,108,132,89,138,8,14,247,154,247,158,21,
+251,107,114,7,231,10,247,86,6,235,213,208,229,239,56,197,251,38,31,81,247,
+87,187,98,29,251,17,204,10,164,251,87,251,42,247,87,164,106,10,42,72,29,159,
+252,97,110,247,99,29,245,136,10,114,247,107,6,247,94,251,107,21,247,107,194,
+7,206,182,129,115,247,26,10,247,138,248,148,21,247,20,6,146,36,5,114,141,
+148,127,156,27,154,149,149,156,140,139,139,138,152,31,131,247,5,136,172,135,
+142,106,140,25,251,221,106,29,247,46,6,199,204,174,159,180,27,195,172,96,
+64,31,251,8,90,247,104,10,247,14,66,29,118,247,13,6,240,86,203,57,89,93,118,
+93,88,30,14,247,166,22,40,7,116,247,35,10,163,30,237,247,86,7,129,10,99,248,
+97,179,106,10,251,32,89,29,187,252,97,251,148,248,97,187,98,29,251,32,89,
+29,179,252,97,247,123,29,247,196,248,211,21,251,38,251,4,251,20,251,60,207,
+29,247,89,251,220,21,133,96,132,117,124,109,8,247,66,29,119,173,130,167,132,
+188,8,137,189,21,145,191,146,164,156,173,8,211,176,204,183,209,27,204,200,
+102,75,177,31,162,101,148,109,145,81,8,14,248,175,190,21,83,197,29,155,156,
+212,10,247,77,51,29,161,201,10,138,173,135,143,105,140,8,14,36,10,14,183,
+247,189,21,147,36,145,108,164,96,8,53,188,219,89,227,27,247,34,247,41,29,
+57,89,110,39,50,31,196,127,5,212,210,169,156,198,27,193,194,112,94,174,31,
+174,95,162,80,93,26,133,7,138,89,21,127,69,127,108,106,100,8,93,100,88,113,
+86,27,85,88,165,185,100,31,106,178,127,170,128,209,8,14,247,41,248,148,21,
+247,2,116,29,251,92,135,10,177,252,97,101,135,10,247,24,108,29,97,247,86,
+6,197,212,190,162,199,27,203,163,107,52,31,251,48,90,7,114,125,247,86,29,
+247,31,108,29,101,247,53,6,208,125,181,110,162,30,159,114,102,150,97,27,86,
+86,122,107,95,31,112,119,5,14,221,248,148,21,252,97,120,137,10,247,6,66,29,
+96,248,45,6,247,56,252,54,5,104,153,146,132,159,27,166,149,154,180,31,248,
+92,159,247,101,10,251,8,166,10,183,252,38,6,251,59,248,60,128,167,138,139,
+109,140,25,87,135,10,248,147,58,21,179,109,170,101,117,120,129,119,125,30,
+128,123,136,122,87,26,66,141,116,146,128,30,120,151,162,127,165,27,183,162,
+164,188,31,87,22,124,134,132,128,128,134,146,154,30,247,0,7,152,144,145,150,
+150,144,133,126,30,141,251,183,21,166,152,148,157,160,129,143,87,95,128,134,
+118,122,153,130,165,31,14,247,63,247,158,21,247,37,190,251,37,247,87,247,
+195,48,167,10,247,34,252,92,116,10,188,251,87,72,88,206,251,107,90,49,10,
+247,126,49,29,251,25,6,14,247,220,247,109,21,176,7,247,66,247,150,185,29,
+251,99,251,34,247,99,5,167,166,29,251,3,79,10,160,6,247,69,251,150,5,102,
+41,7,118,128,130,123,123,247,54,10,237,251,8,39,49,10,247,144,88,10,39,247,
+8,231,247,96,29,14,247,66,247,158,21,247,25,100,6,119,149,127,155,155,149,
+151,159,30,247,21,7,159,130,151,122,123,129,127,119,30,100,251,25,247,87,
+247,169,48,7,119,149,127,156,155,148,150,160,30,247,34,252,66,247,102,29,
+188,252,97,90,6,119,127,247,85,10,248,88,247,54,6,159,129,151,122,123,130,
+128,118,30,251,3,251,191,7,162,249,45,141,10,47,10,233,247,128,21,123,129,
+128,121,74,205,89,224,223,205,189,204,247,112,29,101,134,98,112,86,27,87,
+97,167,247,84,29,247,127,190,21,248,97,247,149,251,44,7,119,149,127,155,156,
+148,150,160,30,247,95,252,88,7,119,127,247,85,10,230,252,97,48,247,99,29,
+247,125,136,10,188,249,41,21,150,149,142,144,147,26,153,127,151,125,132,131,
+135,133,131,30,251,5,43,5,129,130,135,132,131,26,125,150,127,153,146,145,
+142,147,149,30,14,247,91,249,96,21,113,119,120,114,247,83,29,115,31,247,97,
+247,57,10,164,163,119,159,114,31,61,251,96,108,10,14,55,29,34,247,91,21,149,
+148,143,145,147,26,153,127,151,126,132,131,135,133,131,30,251,6,43,5,129,
+130,135,132,131,26,125,151,127,152,146,247,18,10,64,10,251,7,248,169,21,122,
+129,128,121,74,205,89,224,223,205,190,203,156,129,151,123,124,130,131,122,
+137,31,97,134,100,113,84,27,87,96,167,176,136,31,158,137,131,148,124,27,14,
+32,29,251,24,247,145,131,10,32,10,120,128,29,247,146,247,165,21,193,131,164,
+117,181,60,247,113,10,197,66,29,83,6,247,66,10,147,150,180,247,133,29,170,
+131,147,107,61,121,125,33,74,30,88,54,121,118,112,134,8,247,11,247,104,29,
+251,16,129,247,77,186,7,165,247,71,10,113,31,251,37,166,10,185,252,97,93,
+107,29,247,37,6,181,10,92,247,117,149,251,18,247,69,29,248,128,190,21,217,
+10,96,7,241,29,172,132,146,103,65,117,122,35,77,30,76,35,128,129,81,137,8,
+114,247,77,186,108,29,251,37,166,10,185,252,97,93,107,29,247,37,174,29,189,
+41,6,115,247,75,10,138,173,135,143,104,140,8,14,248,119,190,21,248,97,159,
+7,160,151,148,156,156,128,147,117,90,29,247,150,251,107,91,75,10,247,17,39,
+6,116,247,75,10,171,132,146,110,140,30,14,248,155,190,21,251,79,247,129,247,
+67,247,116,5,151,6,161,150,168,29,151,242,29,251,2,49,10,152,6,247,67,251,
+116,251,76,251,129,5,125,75,10,247,22,186,29,150,130,161,31,247,8,201,10,
+169,132,147,109,140,30,14,247,193,247,85,21,175,148,164,150,170,161,166,158,
+24,251,95,251,2,137,10,247,92,66,29,101,248,97,177,66,29,251,24,166,10,181,
+251,86,6,93,102,114,124,91,120,8,247,26,247,104,29,251,36,7,60,118,162,234,
+137,195,10,251,54,6,141,251,13,175,100,247,8,134,8,43,7,247,84,10,248,108,
+190,21,248,97,177,7,165,153,148,156,155,80,10,251,95,251,2,7,114,125,247,
+86,29,247,80,201,10,140,168,131,148,109,140,8,14,32,10,166,249,102,21,148,
+129,247,107,29,134,150,129,247,29,29,146,27,154,150,150,154,146,138,141,131,
+147,31,134,145,5,14,47,10,247,23,247,153,21,148,130,134,141,131,27,125,128,
+128,125,130,143,133,148,130,31,247,7,42,5,131,148,144,247,27,10,140,131,147,
+31,133,145,5,14,247,66,248,87,21,200,188,7,160,150,148,156,155,127,148,119,
+31,251,42,6,119,127,172,10,188,78,86,247,10,29,192,251,242,200,10,223,247,
+24,6,159,151,148,155,155,127,148,119,31,251,24,252,36,21,247,107,247,31,7,
+207,169,29,247,196,248,211,160,29,251,98,251,180,21,142,193,146,168,159,177,
+8,212,177,203,182,209,27,204,200,102,75,177,31,164,98,148,105,144,78,8,130,
+97,121,137,116,27,116,122,143,149,120,31,169,81,135,140,104,27,105,116,134,
+115,49,31,248,14,97,21,146,141,133,94,132,115,123,108,25,247,66,29,118,175,
+129,168,133,191,8,140,141,139,139,141,27,146,167,194,145,167,27,169,151,136,
+122,171,31,124,165,159,134,169,27,169,191,148,151,180,31,14,95,10,151,27,
+162,227,29,247,211,124,21,194,141,185,149,168,155,8,194,170,171,191,198,26,
+208,100,185,61,162,30,203,165,171,183,158,29,130,139,129,140,125,31,140,133,
+139,135,130,26,140,104,5,135,7,132,7,138,123,5,138,137,139,138,138,26,138,
+139,137,138,135,30,138,128,137,120,170,10,56,27,112,115,10,166,6,230,185,
+133,123,170,157,29,101,247,8,91,239,135,31,75,115,29,247,83,248,148,21,187,
+106,10,251,126,251,95,167,10,247,44,221,252,97,94,137,10,247,36,96,29,96,
+7,183,29,6,14,247,220,123,21,190,140,190,156,181,169,8,178,167,168,172,155,
+62,29,123,7,178,93,80,160,76,27,72,78,247,68,10,251,11,239,251,7,247,13,118,
+30,71,247,72,10,125,123,130,116,125,125,143,150,118,31,144,130,135,140,134,
+247,90,29,132,155,131,31,129,160,169,131,161,27,189,173,167,180,178,115,162,
+98,143,31,14,248,108,190,21,248,97,178,247,101,10,251,25,166,10,181,251,86,
+6,81,65,87,116,81,124,29,180,27,192,193,157,170,183,31,166,158,5,251,95,251,
+5,7,109,138,131,130,140,110,8,247,47,29,247,81,247,11,10,14,248,49,22,240,
+88,10,90,247,148,6,212,69,192,43,101,74,126,120,84,247,61,29,141,140,143,
+153,30,157,196,180,147,172,27,209,186,109,94,31,77,7,151,96,96,145,95,27,
+251,22,52,79,50,62,204,86,236,208,196,162,191,198,31,198,4,82,82,79,113,70,
+27,72,97,170,187,197,209,179,241,181,191,133,132,168,31,14,247,242,248,123,
+21,220,186,166,186,158,129,149,120,125,134,134,121,132,31,134,119,119,132,
+86,137,8,48,6,66,92,119,95,107,31,109,99,127,80,251,1,26,251,1,154,85,181,
+94,30,91,185,202,114,215,27,247,35,238,231,247,24,247,23,41,232,251,31,59,
+76,113,85,92,31,150,238,172,171,232,142,8,185,34,21,247,4,216,69,36,39,62,
+67,251,1,67,88,163,190,105,31,119,168,129,173,174,26,239,217,211,245,30,14,
+247,31,190,21,90,72,29,247,160,6,246,196,181,216,201,107,173,64,156,31,186,
+157,157,162,180,26,208,80,175,251,3,30,251,112,49,10,188,6,191,251,6,21,247,
+6,247,11,7,225,171,124,101,99,93,118,50,31,37,251,95,21,247,44,244,7,214,
+188,131,123,161,31,156,126,150,118,115,26,92,100,116,62,30,14,103,10,14,248,
+142,22,75,7,116,247,35,10,164,30,214,7,138,171,134,144,105,140,8,105,247,
+209,173,6,181,10,252,8,135,10,186,251,54,6,140,45,103,93,53,125,114,136,135,
+134,138,108,8,64,7,114,247,35,10,162,30,203,7,247,43,248,4,21,247,79,251,
+209,251,136,6,174,165,160,194,140,213,8,14,34,29,14,247,218,248,4,21,161,
+66,29,42,136,29,162,251,10,135,6,114,141,123,155,100,202,8,210,96,114,156,
+81,67,10,126,144,131,142,138,8,137,142,150,138,153,27,164,6,181,10,115,6,
+88,229,114,182,110,173,114,153,25,149,147,161,168,247,60,29,148,247,55,10,
+109,82,122,127,63,89,30,93,69,128,129,116,138,8,135,6,14,248,76,247,115,21,
+157,10,147,148,160,144,207,10,114,125,129,122,123,152,177,29,126,149,129,
+164,128,31,115,191,221,123,214,27,247,36,219,186,225,187,103,182,89,150,31,
+14,48,10,14,55,10,14,248,119,248,4,21,174,116,29,252,9,136,29,186,251,114,
+6,66,111,103,84,128,132,140,142,123,30,173,7,161,131,150,122,122,129,126,
+117,30,99,7,120,142,129,146,135,30,130,154,170,133,166,27,229,187,195,244,
+31,247,114,247,79,251,209,105,137,10,247,13,108,29,104,6,14,247,220,179,21,
+247,38,247,205,5,251,194,71,7,117,127,130,123,122,151,130,161,31,247,40,49,
+29,111,247,209,158,136,10,43,6,251,39,251,208,251,42,247,208,5,42,49,10,159,
+251,209,110,89,10,247,42,49,29,70,247,193,6,247,40,251,204,5,14,248,61,247,
+86,21,251,35,152,10,36,95,29,6,14,71,29,14,248,61,248,4,21,251,209,152,10,
+252,42,6,118,128,130,122,123,151,130,159,31,165,200,29,247,209,6,14,74,29,
+248,102,248,21,21,171,98,87,155,247,145,10,247,218,248,4,21,247,35,251,23,
+6,118,148,127,156,156,148,151,160,30,247,74,252,78,251,74,247,12,10,247,23,
+247,35,251,209,208,10,14,109,10,130,123,62,10,14,247,218,248,188,21,165,130,
+152,121,30,58,134,5,113,137,126,130,122,26,124,151,128,154,140,30,141,6,205,
+143,5,251,11,7,150,115,123,143,117,27,49,73,44,251,23,251,24,205,51,237,158,
+151,141,147,162,31,41,58,7,114,125,130,123,123,153,130,164,31,247,106,6,164,
+153,148,155,155,125,148,114,31,58,237,6,131,163,150,137,159,27,193,179,161,
+184,167,31,166,182,153,192,198,26,247,19,72,236,51,117,121,135,128,116,30,
+81,4,155,157,154,145,161,27,202,184,66,38,41,94,67,77,118,124,145,156,119,
+31,87,22,122,122,124,133,116,27,76,94,210,238,184,149,181,158,174,31,174,
+159,165,156,174,27,161,154,133,123,155,31,14,57,10,248,142,22,76,7,246,29,
+84,96,10,14,248,163,190,21,247,209,156,7,247,30,10,53,49,10,156,251,209,93,
+29,248,138,76,6,115,148,247,93,10,173,135,143,104,140,8,14,247,166,248,4,
+21,188,247,9,29,251,180,251,34,247,98,29,230,247,27,251,209,121,205,29,247,
+66,6,222,191,152,165,163,31,160,161,151,172,173,26,216,74,179,251,19,30,35,
+6,251,86,4,247,35,240,7,245,175,122,87,85,102,119,35,31,14,248,153,248,4,
+21,187,136,10,251,40,107,10,187,251,209,91,247,70,29,151,130,160,247,24,10,
+252,40,247,209,21,188,88,10,251,9,75,10,155,251,209,121,72,29,247,51,232,
+29,6,251,86,4,247,35,225,7,246,174,122,86,85,101,120,36,31,14,247,73,248,
+4,21,188,88,10,251,9,75,10,155,251,209,163,10,6,251,86,4,247,35,247,3,7,245,
+176,121,89,247,118,29,247,151,247,124,21,118,127,247,86,10,247,98,6,47,124,
+73,86,41,27,69,86,160,188,85,31,147,130,133,142,130,27,126,129,130,126,117,
+164,115,186,114,31,112,191,185,127,194,27,247,28,234,229,247,23,247,23,41,
+235,251,25,80,89,123,107,98,31,141,7,247,72,29,127,119,30,49,7,119,148,127,
+156,155,147,148,159,141,30,188,145,205,178,218,27,237,203,85,43,154,31,14,
+247,104,247,86,21,251,22,151,209,60,242,27,247,1,216,233,247,24,247,25,66,
+228,251,2,41,67,66,251,7,123,31,66,247,15,188,137,29,251,12,107,10,158,251,
+209,99,89,29,247,33,137,29,90,247,35,6,247,146,247,80,21,222,192,71,33,36,
+85,70,59,60,85,208,239,245,192,210,217,31,14,248,51,247,56,21,251,5,86,7,
+120,129,130,123,122,149,130,158,31,247,35,6,157,149,148,156,155,129,148,121,
+31,101,247,209,177,6,157,149,148,155,156,129,148,121,31,251,115,6,44,85,95,
+62,77,172,98,206,120,31,80,112,96,95,119,85,8,119,6,120,129,130,122,123,149,
+130,158,31,199,6,152,213,186,190,234,178,8,247,1,190,21,46,6,41,100,162,196,
+189,173,162,210,31,247,17,6,14,247,87,248,4,21,251,209,213,29,247,209,247,
+178,247,95,6,247,29,10,251,44,252,13,7,119,127,247,85,10,14,247,103,247,186,
+21,212,205,163,154,194,27,207,184,102,82,31,251,202,7,73,137,95,96,76,27,
+251,20,6,119,127,172,10,247,20,6,233,209,208,230,136,31,247,205,7,247,114,
+29,236,247,39,247,13,10,251,39,227,39,204,10,187,102,80,6,117,128,159,10,
+6,14,247,27,247,124,21,235,154,203,193,236,27,219,205,100,89,145,31,120,141,
+147,130,155,27,156,148,151,159,31,229,7,159,130,151,122,122,130,127,119,30,
+137,7,171,97,90,155,80,27,251,26,41,43,251,23,251,23,234,49,247,29,193,185,
+151,166,192,31,186,163,164,164,161,26,151,129,149,125,131,134,136,131,129,
+30,90,85,86,118,69,27,41,72,193,230,125,31,247,98,6,161,150,148,155,156,247,
+73,10,14,173,10,247,9,223,195,218,175,119,174,107,160,31,106,161,102,150,
+77,145,52,247,23,10,210,212,189,112,98,144,30,121,141,148,130,154,27,155,
+247,75,29,130,130,123,136,30,165,105,94,152,86,27,38,64,90,72,107,157,107,
+247,79,10,164,133,165,124,8,164,126,155,117,118,26,90,76,103,54,58,72,173,
+181,30,14,40,29,137,247,18,29,101,29,248,22,248,4,21,173,66,29,251,166,136,
+29,186,251,114,6,68,110,100,86,131,129,140,143,122,30,173,7,160,130,151,122,
+122,130,127,116,30,99,7,120,142,128,147,135,30,130,155,169,133,166,27,227,
+188,197,243,31,247,114,228,251,209,116,137,10,230,6,208,183,151,165,164,31,
+161,160,151,171,172,26,217,83,180,33,30,113,6,88,4,165,6,216,169,119,90,91,
+105,115,69,31,110,6,14,247,169,247,137,21,251,54,247,15,184,29,35,6,118,128,
+130,122,123,151,130,159,31,165,251,209,99,89,29,247,10,137,29,113,247,35,
+247,54,251,35,122,89,29,247,50,232,29,247,15,187,136,10,251,8,49,10,155,6,
+191,251,209,21,247,35,224,7,246,175,122,88,247,118,29,247,65,248,151,21,227,
+39,247,12,29,187,102,80,6,118,127,159,10,247,135,6,212,205,163,154,194,27,
+207,184,102,82,140,10,236,247,39,247,13,10,14,70,29,70,29,248,57,190,21,36,
+115,10,247,83,66,29,103,247,209,175,6,81,29,14,248,111,190,21,93,29,248,141,
+106,10,114,247,209,156,88,10,53,49,10,156,6,14,248,164,190,21,87,229,114,
+182,110,173,115,153,25,147,146,162,169,247,60,29,149,247,55,10,108,82,121,
+126,64,90,30,93,70,128,128,116,138,8,135,247,10,161,66,29,42,136,29,162,251,
+10,135,6,115,141,124,153,107,191,8,225,85,119,154,78,67,10,125,144,132,143,
+138,8,137,141,151,138,152,27,157,6,140,73,5,116,247,35,10,164,30,213,7,171,
+132,144,101,143,30,14,247,168,144,21,251,28,100,7,225,10,247,25,6,247,76,
+248,2,184,10,251,199,251,47,247,199,5,182,166,29,251,7,79,10,152,6,14,197,
+247,114,21,131,7,132,7,251,20,239,44,247,26,247,24,241,232,247,14,247,23,
+251,1,242,251,31,42,251,11,91,101,125,150,128,153,145,143,141,145,147,30,
+169,179,211,161,200,27,241,218,74,44,153,31,88,4,56,121,68,86,47,27,47,66,
+194,220,124,31,14,247,65,248,239,21,39,204,10,187,252,137,247,124,29,247,
+23,71,10,99,247,135,6,212,205,163,154,195,27,206,184,101,83,140,10,14,247,
+87,247,135,21,251,84,213,29,247,84,230,247,95,10,48,214,247,126,251,44,6,
+118,148,128,156,156,148,150,160,247,16,29,64,83,6,118,128,130,123,123,247,
+54,10,14,247,168,120,21,49,6,118,128,130,123,123,247,54,10,229,77,100,6,225,
+10,201,233,247,96,29,45,161,6,247,76,248,1,184,10,251,198,251,47,247,198,
+5,182,166,29,251,7,79,10,152,6,247,77,251,255,5,14,248,161,247,86,21,138,
+165,138,159,136,153,8,246,119,48,211,251,7,27,251,24,38,45,251,15,251,23,
+247,0,39,247,36,233,247,11,186,177,152,127,151,126,133,134,137,133,131,31,
+108,97,70,119,78,27,35,63,200,236,123,31,140,190,21,222,157,209,193,229,27,
+228,210,85,56,157,31,251,163,247,236,21,247,6,10,247,98,236,10,48,10,247,
+16,248,240,21,123,129,128,121,75,205,89,224,223,205,189,203,247,112,29,102,
+134,98,112,86,27,87,96,167,175,136,31,158,137,131,148,123,27,14,103,10,195,
+248,173,21,149,147,143,146,148,26,152,127,151,126,132,132,136,131,130,218,
+10,247,220,248,55,21,251,56,247,97,29,247,4,251,209,251,45,6,120,129,133,
+124,134,31,138,7,138,137,5,120,143,150,131,159,27,247,249,6,160,152,148,156,
+155,127,148,117,31,251,44,6,251,64,248,174,21,247,47,10,247,92,10,247,47,
+10,118,159,115,31,14,55,10,48,247,112,21,148,147,143,146,148,26,152,127,151,
+126,237,29,152,146,247,18,10,247,40,248,4,21,166,66,29,32,115,10,159,6,247,
+82,251,232,110,86,5,84,108,123,126,102,27,131,132,140,141,127,31,192,7,163,
+130,151,122,122,130,126,114,30,84,7,119,144,128,149,133,30,131,155,165,134,
+165,27,191,173,165,209,178,31,247,124,248,52,5,159,247,98,10,35,136,29,165,
+6,251,51,251,178,5,251,17,248,158,21,123,129,128,121,75,205,89,223,224,205,
+189,203,156,128,151,124,124,131,131,122,136,31,98,134,100,113,84,27,87,97,
+166,247,84,29,37,29,251,130,248,55,43,29,34,29,251,198,247,139,10,86,27,85,
+247,50,29,247,151,247,88,21,187,132,163,123,175,87,207,40,24,150,122,145,
+135,164,138,8,196,66,29,85,6,74,230,92,204,127,149,101,152,25,158,154,161,
+162,166,172,190,200,146,144,181,140,8,94,7,230,10,108,102,121,124,121,134,
+8,203,7,160,130,150,123,122,130,127,119,30,70,123,247,10,182,7,165,153,148,
+156,155,126,148,112,31,251,30,115,10,182,251,209,96,115,10,247,30,6,181,10,
+96,247,40,155,60,247,69,29,248,116,190,21,224,29,94,7,69,29,185,76,6,115,
+149,247,93,10,171,134,144,109,141,8,14,248,113,190,21,247,209,164,7,129,10,
+37,95,29,247,142,251,35,99,6,118,127,247,86,10,247,8,138,5,75,7,116,247,35,
+10,163,30,213,7,160,135,149,130,143,30,144,130,135,140,128,27,14,248,151,
+191,21,251,69,247,59,110,10,117,128,131,122,122,151,130,160,247,62,10,132,
+247,125,29,151,247,87,10,85,6,247,35,247,25,247,34,251,25,5,87,89,10,247,
+8,77,6,246,29,14,247,150,247,75,21,116,140,83,141,121,158,138,197,25,197,
+10,140,51,172,106,232,130,162,138,24,95,7,247,33,10,189,7,187,150,166,150,
+176,162,8,251,24,36,137,10,247,83,66,29,103,247,209,175,6,247,137,10,97,113,
+107,124,101,129,8,202,7,159,130,150,122,123,130,128,119,30,14,248,109,190,
+21,247,209,175,7,81,29,251,24,36,137,10,247,72,201,10,169,132,147,112,140,
+30,136,6,14,95,10,152,27,161,227,29,48,10,247,62,249,6,21,148,130,242,10,
+130,148,144,137,146,27,154,150,150,154,146,138,141,132,147,31,133,145,5,14,
+247,73,248,89,21,187,188,7,159,151,148,155,156,127,148,119,31,251,9,204,10,
+155,91,75,247,10,29,203,251,244,163,10,247,50,247,13,247,95,10,251,13,252,
+38,21,247,35,247,3,7,245,176,121,89,247,118,29,179,29,251,65,251,145,21,149,
+179,182,147,156,27,160,151,135,124,166,31,127,162,158,134,162,27,171,167,
+143,154,203,31,50,121,69,82,47,27,50,68,195,226,121,31,136,178,21,143,176,
+145,158,155,165,8,192,172,196,169,204,27,237,209,77,42,152,31,132,107,117,
+136,115,27,126,123,142,143,130,31,160,88,133,141,113,27,100,84,130,123,73,
+31,14,247,201,190,21,151,29,216,6,247,19,247,180,5,197,165,151,152,163,27,
+147,145,137,131,153,31,127,161,152,134,151,27,162,159,161,163,173,106,163,
+91,75,98,105,58,104,31,14,247,218,124,21,247,27,142,214,186,221,26,188,103,
+182,89,150,30,129,142,5,157,10,146,148,160,145,207,10,113,125,129,122,123,
+153,177,29,119,168,121,194,125,31,186,126,175,133,181,137,8,74,115,29,208,
+248,4,21,217,251,209,96,107,29,247,30,66,29,96,247,40,163,6,218,138,168,124,
+183,77,207,40,24,149,122,146,135,164,138,8,196,66,29,85,6,74,230,91,204,128,
+149,101,152,25,158,155,159,160,168,173,191,201,145,143,181,140,8,94,7,247,
+36,29,151,161,30,193,7,171,131,146,101,73,119,127,60,72,30,80,68,130,134,
+83,137,8,115,247,10,188,6,159,152,149,154,156,247,73,10,251,123,251,34,167,
+10,14,247,226,124,21,186,143,183,151,176,157,8,187,163,170,168,158,247,58,
+10,88,79,143,29,137,7,247,64,10,251,12,224,49,247,13,129,31,75,168,10,160,
+169,147,29,248,109,190,21,247,209,175,7,158,10,126,130,123,122,153,130,164,
+111,10,179,27,199,197,156,172,190,31,251,24,33,7,136,6,112,138,132,131,109,
+26,247,47,29,247,72,7,165,247,71,10,113,31,14,211,183,21,122,129,131,125,
+125,149,131,156,31,247,50,6,156,149,147,153,153,129,147,122,31,90,6,133,137,
+141,145,31,247,76,7,145,141,141,145,30,244,6,143,140,138,136,141,31,247,17,
+251,75,5,140,137,140,138,137,26,137,138,138,138,137,30,82,55,5,135,133,136,
+132,134,26,129,150,129,150,148,145,143,149,145,30,184,205,5,141,140,141,140,
+142,27,141,142,138,137,140,31,185,72,5,130,145,145,135,148,27,150,150,149,
+149,144,136,146,135,145,31,81,223,5,137,141,139,140,141,26,141,139,139,141,
+142,30,202,231,5,143,146,141,145,144,26,150,128,149,128,131,133,135,129,132,
+30,89,66,5,135,137,137,138,137,27,136,138,140,143,136,31,47,247,27,5,138,
+140,139,141,140,26,142,141,141,141,30,188,150,157,147,166,162,8,175,169,157,
+181,189,26,183,125,179,113,165,30,167,112,94,152,74,27,251,143,6,122,129,
+131,125,125,149,131,156,31,188,6,145,141,137,133,31,252,92,7,133,137,137,
+133,30,199,247,136,21,133,137,141,145,31,247,104,7,145,141,141,145,30,247,
+33,6,229,184,103,68,100,122,106,110,118,31,119,109,100,131,66,27,14,247,189,
+248,137,21,251,27,225,29,247,31,251,3,247,3,251,30,31,112,251,173,21,251,
+54,7,53,148,62,214,135,217,8,194,4,145,222,213,213,226,150,8,251,60,7,194,
+84,21,247,59,6,136,66,59,61,55,128,8,247,109,4,247,60,7,223,130,215,63,146,
+56,8,14,248,45,227,21,148,99,143,126,146,127,8,120,151,155,128,156,27,200,
+180,230,247,28,247,24,96,230,78,68,103,50,251,64,31,251,238,7,123,147,129,
+153,153,147,149,156,30,248,3,4,161,7,237,167,215,175,176,165,66,34,251,13,
+117,75,97,104,117,184,215,135,30,251,229,129,21,138,93,125,102,118,129,8,
+129,134,133,130,128,26,137,7,124,140,149,131,156,27,241,140,5,244,196,236,
+247,70,247,29,102,232,72,172,31,117,150,117,143,101,138,8,132,136,141,143,
+149,147,163,144,147,31,142,144,140,141,143,26,144,136,144,135,142,30,137,
+140,5,141,136,135,140,135,27,121,118,105,108,138,31,130,138,138,137,132,27,
+122,6,122,129,130,126,125,149,131,156,31,156,6,145,141,136,134,31,183,22,
+146,140,140,155,238,175,75,251,67,251,9,118,70,96,114,30,128,121,104,134,
+90,27,126,134,141,143,140,139,140,140,140,31,160,168,148,170,140,186,8,14,
+99,10,14,226,22,197,6,163,220,165,226,167,201,174,188,25,201,182,214,190,
+187,27,153,151,130,128,128,132,110,128,99,31,76,251,103,5,135,124,137,125,
+123,26,109,157,119,166,170,162,155,197,192,30,124,168,5,98,100,126,129,129,
+27,133,135,143,144,143,140,145,141,146,31,212,247,164,5,142,148,140,150,148,
+26,191,112,166,88,82,87,111,71,69,30,173,240,247,40,206,159,184,251,47,71,
+182,247,40,251,30,117,124,110,5,145,155,147,141,149,27,167,150,131,120,127,
+136,121,133,121,31,120,82,251,20,84,132,100,247,18,193,5,14,248,141,243,21,
+85,101,110,119,97,27,109,118,145,158,102,31,180,195,155,192,222,26,247,11,
+178,202,215,242,26,208,102,186,84,66,79,51,251,9,133,30,135,65,71,150,99,
+153,114,159,25,110,163,123,172,175,26,197,173,170,214,151,30,119,178,92,130,
+110,128,118,121,25,110,115,122,101,96,26,93,159,97,178,103,30,175,106,193,
+118,221,125,133,57,127,105,102,89,8,174,78,99,152,93,27,76,93,109,97,99,182,
+112,203,188,201,151,153,168,31,145,149,145,141,141,27,141,143,137,133,148,
+31,124,159,181,128,171,27,208,191,168,200,176,31,251,205,114,21,116,83,121,
+134,104,27,101,113,151,157,159,166,154,174,171,162,131,110,195,31,247,43,
+247,242,21,216,144,169,190,181,27,171,160,109,97,77,102,96,40,87,31,14,247,
+58,248,23,21,178,129,158,122,113,26,105,108,116,94,99,108,159,170,134,30,
+149,137,132,145,130,27,130,131,131,130,129,144,124,147,126,31,109,157,177,
+121,187,27,202,180,175,194,183,116,166,88,153,31,71,158,5,113,146,126,152,
+158,26,169,167,162,177,176,165,124,115,145,30,130,140,147,133,149,27,140,
+6,147,145,145,146,181,91,174,83,78,101,105,84,100,159,117,186,126,31,247,
+231,74,21,221,247,76,5,251,136,102,7,127,132,133,129,129,147,247,37,29,124,
+247,146,149,6,151,146,146,149,149,132,145,127,31,79,6,58,251,76,56,247,76,
+5,80,6,127,132,133,129,129,146,132,151,31,149,251,146,125,6,127,132,133,129,
+129,146,247,37,29,102,247,136,6,222,251,76,5,14,247,66,247,23,21,186,185,
+177,158,188,27,220,204,78,62,69,84,81,73,105,101,157,169,112,31,105,176,5,
+168,112,105,157,110,27,98,107,110,102,116,148,122,159,122,31,146,157,5,128,
+157,135,148,151,26,165,160,159,166,163,168,119,107,163,30,167,100,5,99,169,
+183,116,189,27,186,184,158,172,168,31,172,178,157,183,182,26,215,83,202,46,
+167,30,228,165,178,185,219,26,234,75,205,47,85,99,122,84,71,30,176,110,5,
+186,201,166,152,179,27,199,177,93,67,62,91,82,74,122,127,141,148,114,31,145,
+153,140,145,148,26,167,126,159,121,120,121,117,116,106,169,120,201,133,30,
+75,127,115,128,84,98,8,14,248,141,247,37,21,73,101,78,103,62,27,251,16,51,
+247,4,247,51,247,15,200,241,213,154,149,135,127,157,31,120,114,132,123,120,
+26,115,153,102,160,107,30,176,83,5,165,100,154,97,107,26,109,115,119,103,
+106,115,159,166,149,142,147,149,154,30,98,163,5,125,116,135,129,121,26,85,
+190,98,205,194,184,179,188,171,125,179,115,178,30,107,191,110,190,5,125,162,
+131,163,154,26,175,186,173,190,169,162,131,116,177,30,180,185,120,153,129,
+132,5,151,104,120,142,111,27,96,115,131,110,100,31,166,108,116,149,107,27,
+39,60,251,21,251,54,251,69,247,1,251,19,247,44,237,215,186,227,186,31,14,
+248,19,247,100,21,221,168,189,189,194,26,200,75,181,47,251,53,251,22,251,
+13,251,41,251,9,221,69,247,28,200,207,155,164,186,30,171,156,152,153,157,
+26,149,138,147,133,162,30,89,85,67,113,58,27,44,81,177,212,122,31,202,140,
+221,152,197,159,8,251,87,160,21,149,181,151,165,163,167,8,191,183,214,172,
+213,27,192,176,117,108,116,119,116,102,121,31,98,119,36,109,90,134,67,131,
+24,14,247,4,22,247,233,6,168,194,5,96,6,156,205,5,154,193,150,219,184,26,
+247,1,89,194,40,30,251,16,6,73,138,136,140,127,185,8,142,137,147,137,147,
+30,135,114,138,126,121,26,90,155,124,191,30,247,7,6,192,155,137,127,158,31,
+162,125,154,107,101,26,96,132,86,126,82,30,115,36,5,251,135,6,14,247,59,22,
+247,59,6,175,184,154,116,147,130,159,126,25,146,167,141,155,140,171,140,217,
+24,141,226,5,168,139,159,140,146,30,147,247,0,139,139,149,26,186,120,157,
+80,147,30,81,147,100,146,130,144,128,161,25,122,119,134,129,128,26,115,168,
+119,177,137,30,154,138,157,138,156,138,8,146,146,136,137,143,31,151,131,143,
+121,140,87,8,55,7,138,37,133,82,124,83,8,251,44,6,14,248,149,211,21,251,195,
+247,196,145,140,5,142,6,144,140,167,143,156,144,176,156,25,146,142,142,142,
+145,26,145,133,144,132,30,134,6,137,117,135,139,125,27,105,85,148,153,91,
+31,140,137,137,139,138,27,133,135,135,135,134,140,136,142,126,31,152,95,146,
+93,105,26,129,139,132,138,127,30,128,7,129,143,133,146,145,142,142,151,144,
+30,149,160,152,186,141,156,8,141,7,139,139,142,140,141,30,247,196,251,195,
+5,14,246,211,21,168,111,247,195,247,195,5,81,148,157,90,153,27,146,143,145,
+149,142,139,142,138,144,31,138,168,5,173,146,185,152,183,30,142,152,140,142,
+144,26,143,135,143,133,138,137,139,138,137,30,125,90,87,130,103,27,130,129,
+139,140,130,31,140,125,139,139,137,27,132,133,134,133,133,142,136,146,136,
+31,176,122,156,134,167,135,144,138,24,142,6,146,138,5,14,246,248,56,21,247,
+196,251,196,5,132,6,136,138,134,138,111,136,122,134,102,122,25,132,135,136,
+136,134,26,133,145,134,146,30,144,6,141,161,143,139,153,27,173,193,130,125,
+187,31,138,141,141,139,140,27,145,143,143,143,144,138,142,136,152,31,126,
+183,132,184,173,26,140,168,5,140,144,139,142,143,26,148,135,145,132,133,136,
+136,127,133,30,130,118,125,92,137,123,8,136,7,139,139,136,138,137,30,251,
+195,247,196,5,14,248,149,248,56,21,111,168,251,196,251,196,5,198,130,122,
+187,125,27,132,135,133,130,31,127,7,140,127,139,133,128,26,105,132,94,126,
+95,30,136,126,138,136,134,26,135,143,135,145,140,141,139,140,141,30,153,188,
+191,148,175,27,148,149,139,138,148,31,138,153,139,139,141,27,146,145,144,
+145,144,136,142,132,143,31,102,155,123,145,110,142,134,140,24,136,140,5,133,
+6,14,166,219,21,211,104,180,110,187,88,8,167,6,119,186,125,160,97,180,8,248,
+67,171,252,68,6,179,178,156,163,159,185,8,111,6,93,91,93,107,70,104,8,247,
+115,4,248,67,6,100,100,122,115,119,93,8,167,6,187,189,185,171,206,171,8,160,
+7,70,172,93,172,94,187,8,111,6,159,91,154,118,180,99,8,252,68,6,14,168,213,
+21,248,68,6,99,101,122,115,119,92,8,167,6,184,186,185,172,209,174,8,160,7,
+68,174,94,171,94,186,8,112,6,158,93,158,112,177,103,8,252,68,6,247,115,4,
+207,106,185,106,186,90,8,167,6,121,182,118,170,102,174,8,248,67,170,252,68,
+6,179,177,156,163,159,186,8,111,6,95,92,91,105,70,106,8,14,247,96,247,15,
+21,100,158,126,145,79,166,8,122,6,220,81,241,45,182,81,182,199,247,1,239,
+213,188,140,140,24,140,135,134,139,137,27,128,93,119,106,77,31,248,17,7,178,
+119,151,133,199,112,8,159,6,54,198,48,222,87,207,85,72,66,72,39,63,157,137,
+157,146,233,186,8,182,252,39,21,248,63,7,193,179,192,99,5,252,65,7,86,100,
+5,14,247,37,22,130,185,161,136,165,27,247,19,232,247,6,247,48,200,122,187,
+107,171,31,169,110,92,159,100,27,101,107,132,116,79,31,156,96,5,153,180,159,
+143,164,27,183,186,120,113,160,31,155,118,146,114,140,97,8,251,68,6,102,137,
+137,110,119,144,135,164,31,247,72,6,251,0,123,82,84,42,27,123,133,139,142,
+93,31,14,247,212,247,120,21,247,54,7,157,132,148,126,125,132,130,121,30,251,
+54,251,72,7,121,130,132,126,126,149,131,156,31,247,72,251,52,6,121,146,130,
+153,152,146,148,157,30,247,53,247,72,7,158,148,145,153,152,130,146,120,31,
+252,37,247,193,21,121,130,132,126,126,148,132,157,31,248,38,6,157,148,146,
+152,152,130,146,121,31,14,247,153,251,37,21,180,250,106,98,6,14,247,81,251,
+138,21,177,6,138,250,251,5,102,6,247,38,254,251,21,177,250,251,101,6,14,230,
+22,190,6,247,52,248,26,247,53,252,26,5,190,6,251,66,248,71,5,64,6,14,230,
+248,70,21,247,66,252,70,5,214,6,247,66,248,71,5,88,6,251,53,252,25,251,52,
+248,25,5,88,6,14,247,172,248,68,21,47,126,72,58,40,26,46,209,56,228,126,30,
+36,7,61,131,110,118,130,136,142,154,129,30,154,129,126,147,124,27,115,124,
+124,116,112,162,120,174,165,166,152,162,161,31,168,170,146,170,227,26,206,
+7,236,150,210,221,241,26,239,69,217,41,148,30,203,7,208,148,167,161,145,145,
+135,128,146,30,120,151,149,133,156,27,162,155,154,161,166,116,158,107,116,
+115,131,124,121,31,103,111,126,96,50,26,180,77,21,213,129,191,77,61,26,61,
+87,76,65,128,30,98,22,70,151,91,202,217,26,216,189,202,206,148,30,14,243,
+248,210,21,103,109,110,103,102,168,110,247,112,10,247,88,252,79,244,10,247,
+88,248,79,244,10,14,241,247,23,21,104,108,109,107,100,167,109,177,175,168,
+168,175,176,110,168,103,31,248,79,4,104,108,110,106,100,168,109,247,112,10,
+247,218,252,146,21,104,169,110,174,176,168,168,175,175,110,169,103,102,110,
+110,103,30,248,76,4,105,169,110,174,176,168,168,175,175,110,168,103,102,110,
+111,102,30,14,248,49,248,83,21,178,212,5,143,145,141,145,143,26,149,129,148,
+128,130,134,135,126,132,30,90,48,5,251,181,6,121,130,132,125,126,148,132,
+157,31,247,159,6,84,36,5,251,104,247,100,29,247,82,6,83,37,5,251,26,247,100,
+29,247,4,6,100,65,5,136,134,137,132,135,26,129,149,130,149,149,144,143,152,
+145,30,189,231,5,247,177,247,95,29,251,155,6,194,241,5,247,100,247,95,29,
+251,78,6,194,242,5,247,23,6,157,148,146,152,153,130,146,121,31,14,199,247,
+218,21,248,54,251,125,5,137,143,144,137,143,27,145,145,143,145,142,31,141,
+142,5,141,142,140,143,142,26,146,135,144,130,144,30,251,246,247,89,247,246,
+247,89,5,148,143,143,145,146,26,143,138,142,137,142,30,138,142,5,145,135,
+133,143,133,27,135,135,138,136,134,31,251,110,251,125,21,247,108,251,12,5,
+136,144,145,137,143,27,149,148,149,149,148,135,145,129,144,31,251,44,224,
+247,44,223,5,149,145,143,145,147,26,150,130,149,129,135,134,137,136,133,30,
+14,248,147,247,218,21,252,53,247,125,5,142,134,134,140,135,27,133,133,135,
+133,136,31,137,136,5,137,135,138,136,136,26,133,143,133,149,134,30,247,245,
+251,89,251,246,251,89,5,130,134,135,134,132,26,136,140,135,141,136,30,140,
+136,5,133,143,145,135,146,27,142,143,140,142,144,31,247,110,247,125,21,251,
+108,247,13,5,142,134,134,140,134,27,129,130,129,129,130,143,133,149,134,31,
+247,44,54,251,44,55,5,129,133,135,133,131,26,128,148,129,149,143,145,141,
+142,144,30,14,247,56,174,21,224,6,247,46,172,144,165,184,31,206,180,180,214,
+224,26,233,85,225,62,170,30,187,212,5,144,147,142,145,144,26,148,132,146,
+130,129,133,135,125,130,30,86,60,5,147,97,120,140,251,2,27,251,86,6,120,129,
+132,126,126,150,131,157,31,247,89,6,217,169,138,134,174,31,251,141,252,11,
+5,48,6,120,129,132,126,126,151,131,157,31,202,6,81,51,5,133,130,136,133,135,
+26,130,146,132,149,149,145,143,153,148,30,236,247,38,21,247,135,248,3,5,208,
+118,191,62,60,26,78,107,77,89,105,30,112,99,100,133,251,34,27,14,149,29,247,
+86,251,173,21,40,118,64,76,40,27,83,87,162,180,102,31,113,167,128,163,128,
+185,8,194,4,242,160,215,204,238,27,236,214,73,37,159,31,14,247,186,248,137,
+21,251,28,225,29,247,30,251,3,247,4,251,29,31,251,49,252,3,21,111,174,129,
+169,184,26,247,5,224,225,247,5,179,161,132,108,190,30,178,100,21,170,100,
+147,116,94,26,251,8,55,54,251,8,93,110,148,167,101,30,14,99,10,247,88,183,
+21,118,120,121,119,115,156,121,162,161,157,157,161,161,121,157,117,31,14,
+185,22,194,247,117,248,85,194,252,85,247,116,84,6,14,188,247,117,21,248,86,
+251,117,194,248,140,84,251,116,252,86,6,14,188,248,85,21,247,117,252,85,194,
+248,85,247,117,194,252,141,6,14,230,251,52,21,248,57,194,252,57,6,140,248,
+178,21,247,65,252,70,5,214,6,247,64,248,71,5,85,6,251,47,252,25,251,50,248,
+25,5,85,6,14,247,228,251,138,21,135,247,254,203,247,3,247,101,131,8,202,7,
+78,138,251,90,133,61,251,44,145,252,5,25,14,247,111,4,188,153,138,137,157,
+31,190,131,183,113,166,100,8,184,75,163,251,13,251,55,26,98,201,193,7,200,
+137,185,135,187,30,131,232,109,235,103,184,8,191,98,66,171,61,27,77,6,14,
+247,111,4,201,140,238,141,224,194,178,227,25,172,214,155,247,0,247,42,26,
+190,76,7,251,67,131,77,105,39,30,104,45,80,102,251,6,140,8,118,6,14,247,165,
+249,129,21,134,252,39,222,251,26,247,145,146,8,202,7,251,72,133,73,223,118,
+247,154,8,136,164,138,149,162,26,155,140,166,140,165,30,14,233,173,21,248,
+49,6,251,98,248,78,5,251,19,252,24,21,247,19,247,164,247,19,251,164,5,14,
+233,178,21,248,78,247,99,252,78,247,99,5,193,251,226,21,247,146,7,247,164,
+251,19,5,14,234,248,112,21,247,98,252,78,247,99,248,78,5,251,225,85,21,247,
+145,6,251,19,251,164,5,14,209,247,138,21,248,78,251,99,5,248,50,7,251,218,
+251,99,21,247,164,247,19,5,251,146,7,14,183,247,223,21,247,155,251,182,247,
+151,247,179,251,157,247,184,5,14,132,247,220,21,247,200,251,232,247,200,247,
+232,251,200,247,233,5,251,157,251,232,21,247,157,247,179,247,157,251,179,
+251,157,251,180,5,14,247,194,248,53,21,70,84,84,69,69,193,82,207,206,194,
+195,209,208,85,196,73,31,137,79,21,174,168,109,103,103,110,109,105,103,110,
+168,176,175,167,169,175,31,14,247,8,251,47,21,247,138,166,51,250,13,227,165,
+251,138,6,174,254,39,21,250,13,227,254,13,7,14,247,8,251,47,21,247,138,250,
+66,251,138,113,227,254,13,51,6,247,15,22,250,13,227,254,13,7,14,123,155,248,
+53,155,247,22,151,167,152,6,191,10,190,11,167,147,142,143,143,144,143,142,
+146,187,174,169,12,12,174,143,143,143,143,142,143,148,144,180,159,158,12,
+13,248,236,20,187,19,1,105,2,0,1,0,8,0,20,0,41,0,48,0,92,0,157,0,212,0,227,
+1,9,1,93,1,105,1,112,1,115,1,121,1,139,1,199,1,247,1,251,2,1,2,48,2,56,2,
+65,2,108,2,123,2,235,3,29,3,38,3,82,3,116,3,123,3,146,3,173,4,2,4,7,4,12,
+4,98,4,130,4,137,4,179,4,183,4,190,4,224,4,229,4,234,4,245,5,46,5,54,5,58,
+5,89,5,155,5,160,5,176,5,188,5,243,5,248,5,255,6,3,6,8,6,43,6,46,6,81,6,127,
+6,196,6,237,7,8,7,33,7,40,7,67,7,87,7,140,7,145,7,174,7,197,7,205,7,215,7,
+225,7,235,7,252,8,23,8,52,8,89,8,115,8,118,8,123,8,127,8,169,8,195,8,214,
+8,230,8,255,9,23,9,69,9,83,9,87,9,93,9,102,9,147,9,156,9,200,9,224,9,235,
+10,22,10,63,10,74,10,79,10,84,10,124,10,131,10,150,10,170,10,181,10,184,10,
+195,10,211,10,229,11,12,11,30,11,67,11,74,11,112,11,122,11,127,11,164,11,
+193,11,215,11,251,12,2,12,19,12,54,12,89,12,124,12,151,12,159,12,174,12,181,
+12,186,12,201,12,208,12,241,13,3,13,8,13,22,13,54,13,59,13,78,13,92,13,114,
+13,129,13,134,13,144,13,153,13,159,13,172,13,177,13,197,13,210,13,239,13,
+250,14,5,14,16,14,28,14,40,14,52,14,65,14,82,14,95,14,100,14,127,14,146,14,
+158,14,163,14,169,14,179,14,190,14,196,14,222,14,233,14,241,15,2,15,12,15,
+37,15,46,15,56,15,62,15,68,15,78,15,91,15,97,15,107,15,113,15,120,15,143,
+15,166,15,175,15,183,15,196,15,218,15,240,16,3,16,9,16,30,16,51,16,63,16,
+79,16,89,16,93,16,105,16,125,16,137,16,145,16,157,16,170,16,189,16,202,16,
+209,16,218,16,224,16,242,17,4,17,22,17,29,17,44,17,60,17,71,17,82,17,87,17,
+95,17,106,17,116,17,121,17,126,17,143,17,158,17,164,17,180,17,196,17,205,
+17,221,17,237,17,245,18,5,18,11,18,17,18,23,18,30,18,40,18,50,18,56,18,66,
+18,74,18,81,18,96,18,111,18,126,18,131,18,146,18,161,18,174,18,188,18,202,
+18,208,18,214,18,228,18,234,18,240,18,249,19,2,19,11,19,17,19,22,19,35,19,
+48,19,61,19,74,19,87,19,100,19,113,19,126,19,139,19,152,19,165,19,178,19,
+191,19,204,19,211,19,218,19,225,19,232,19,237,19,249,20,5,20,17,20,29,20,
+41,20,53,20,65,20,77,20,89,20,99,20,109,20,117,20,125,20,133,20,141,20,149,
+20,157,20,165,20,173,20,184,20,195,20,206,20,217,20,228,20,239,20,250,21,
+5,21,16,21,27,21,38,21,49,21,60,21,71,21,82,21,93,21,104,21,115,21,126,21,
+137,21,148,21,159,21,168,21,177,21,186,21,189,21,192,21,196,21,200,21,204,
+21,208,21,213,21,217,21,222,21,227,21,233,21,239,21,245,21,249,22,3,22,7,
+22,11,22,23,22,27,22,38,22,46,22,56,22,60,22,69,22,77,22,86,22,91,22,94,194,
+29,149,160,83,10,11,248,70,22,220,88,10,110,248,4,110,29,11,173,10,247,10,
+223,195,218,175,119,174,107,160,31,77,10,117,118,247,110,10,11,247,218,248,
+148,108,10,11,247,220,247,145,21,247,66,247,151,185,29,251,100,251,34,247,
+100,5,167,166,29,251,3,79,10,160,6,247,69,251,151,5,251,94,39,116,10,247,
+144,88,10,39,6,11,248,50,22,240,88,10,90,247,148,6,212,68,192,43,102,74,126,
+120,83,178,10,153,84,108,144,95,27,251,21,51,79,50,61,204,86,235,208,194,
+161,192,201,31,198,4,79,74,87,116,69,27,73,97,170,188,197,209,179,242,180,
+186,133,131,173,31,11,247,9,22,212,6,247,2,248,14,247,0,252,14,5,212,6,201,
+248,148,5,149,166,29,251,42,79,10,229,6,86,252,70,36,247,254,5,69,6,33,251,
+255,87,248,71,5,227,166,29,251,42,79,10,150,6,11,248,143,22,248,148,168,7,
+90,10,247,188,252,117,5,11,247,63,247,138,21,247,18,6,214,104,181,88,228,
+251,52,8,198,49,29,112,6,62,247,22,109,179,82,179,113,29,6,247,138,4,247,
+40,10,11,248,62,248,4,21,251,38,7,67,131,99,119,111,30,109,117,105,123,97,
+27,98,103,157,169,117,31,120,166,131,179,210,26,247,89,39,7,117,128,130,122,
+123,247,93,29,187,251,43,6,57,150,89,166,103,30,96,170,185,118,200,27,199,
+187,160,178,170,31,168,176,151,190,228,26,247,38,187,7,247,30,10,251,40,107,
+10,11,248,102,248,21,21,170,99,86,156,52,29,11,88,29,150,159,128,10,11,63,
+29,14,65,10,247,114,153,29,215,29,198,10,247,125,6,161,150,148,156,156,128,
+147,247,145,29,11,238,190,21,90,72,29,247,2,6,247,180,248,115,5,252,64,90,
+116,10,247,42,6,159,151,148,155,156,247,55,29,156,155,127,148,119,31,251,
+2,6,251,180,252,116,5,248,65,208,7,129,10,251,62,6,119,127,172,10,188,6,11,
+247,51,22,247,173,247,232,5,251,181,91,247,12,29,247,41,137,29,90,247,209,
+188,137,29,34,6,251,173,251,233,5,247,182,187,7,220,10,251,35,107,10,182,
+251,209,96,89,29,11,6,130,29,11,193,10,143,158,97,29,247,63,247,118,21,247,
+18,6,247,8,231,214,234,233,54,212,251,1,31,251,133,6,118,128,131,122,247,
+132,29,247,126,49,29,251,25,6,247,118,4,247,127,247,35,247,105,29,14,247,
+105,10,122,130,139,29,11,247,141,10,143,141,148,150,30,14,248,116,248,55,
+21,251,253,40,167,10,187,247,126,7,251,187,251,217,5,96,248,21,239,7,160,
+131,150,121,122,130,128,118,30,90,251,152,7,247,189,247,217,5,11,248,122,
+247,215,21,69,29,196,66,29,85,6,224,29,11,247,218,247,121,21,159,129,151,
+123,122,247,15,29,202,187,172,30,147,145,145,143,151,145,8,163,151,142,142,
+152,26,154,129,149,123,113,103,114,100,107,30,98,89,123,85,56,26,75,153,91,
+168,104,247,78,29,161,31,98,160,177,116,184,247,111,10,186,207,26,209,121,
+203,106,182,30,177,110,93,171,113,27,124,129,129,124,126,142,136,164,126,
+31,151,133,144,136,147,134,8,186,106,164,75,53,26,50,104,82,84,88,113,193,
+246,30,11,247,229,247,111,21,110,10,116,129,131,122,122,150,130,161,247,62,
+10,131,89,10,247,25,49,29,85,6,247,35,247,25,247,34,251,25,5,87,6,118,128,
+130,123,122,151,247,126,29,132,6,14,109,29,133,205,10,151,130,31,14,168,29,
+150,148,156,156,128,147,118,31,251,2,89,10,151,6,247,68,251,116,251,76,251,
+129,5,124,89,10,247,23,186,29,247,111,29,156,155,128,148,117,31,125,6,14,
+247,63,247,112,21,216,206,231,109,181,81,212,251,91,188,29,161,150,242,29,
+251,11,6,117,128,131,122,122,150,130,161,102,29,11,88,29,149,160,128,10,11,
+173,29,185,6,251,45,251,199,251,47,247,199,5,182,166,29,251,7,79,10,152,6,
+11,247,19,10,251,7,41,237,247,8,31,208,7,247,6,226,231,247,1,225,215,90,81,
+144,30,218,29,11,247,37,248,148,21,166,247,98,10,251,4,135,10,161,6,247,88,
+251,244,109,85,5,83,108,122,124,106,27,128,133,140,144,121,31,191,7,162,130,
+152,122,122,130,126,114,30,82,7,120,142,128,147,135,30,129,153,169,133,166,
+27,195,175,166,210,179,31,247,131,248,66,5,160,116,29,251,0,135,10,166,6,
+251,56,251,189,5,11,21,247,6,29,11,248,162,151,10,11,27,110,132,131,108,31,
+106,7,116,148,127,156,156,148,150,160,30,163,7,163,137,148,130,175,86,161,
+103,157,116,153,126,112,121,110,107,116,98,88,49,24,114,107,29,167,6,166,
+140,140,139,153,163,191,232,24,172,194,172,167,169,137,8,147,251,40,116,107,
+29,236,66,29,117,247,40,147,6,168,141,173,111,171,84,192,46,24,147,11,112,
+10,155,128,148,117,31,251,21,204,29,146,6,251,45,251,19,5,247,254,38,116,
+10,188,252,137,90,49,10,240,6,11,189,29,192,170,163,94,29,247,54,10,247,7,
+6,225,134,226,221,136,222,8,248,26,188,7,247,78,10,251,56,102,21,232,210,
+69,48,50,68,68,48,48,67,210,229,227,211,211,228,31,11,6,129,10,11,194,29,
+150,159,83,10,14,200,27,175,158,133,121,161,31,163,119,151,116,112,26,251,
+129,111,247,10,10,247,1,202,29,110,247,136,6,217,69,199,47,78,11,123,29,151,
+128,11,6,247,32,29,11,109,29,133,142,133,27,124,128,247,115,29,106,161,102,
+150,77,145,51,247,23,10,211,212,189,112,98,144,30,121,141,147,130,154,27,
+156,247,75,29,129,129,124,137,30,165,105,94,152,85,27,38,64,90,72,106,157,
+108,247,79,10,165,133,165,124,8,164,126,155,11,247,0,10,225,224,247,140,10,
+6,154,29,11,125,148,113,31,251,24,166,10,181,251,86,6,81,66,87,116,80,124,
+29,181,27,192,192,156,171,183,31,166,158,5,11,248,144,248,239,21,38,49,10,
+188,251,102,6,199,94,79,170,68,27,251,15,40,39,251,16,251,16,238,38,247,14,
+210,201,171,198,183,31,64,240,7,247,121,29,6,251,119,247,223,21,238,215,64,
+40,43,62,62,43,42,63,216,236,235,215,216,234,31,11,123,29,150,128,11,105,
+29,248,92,247,54,6,247,29,10,251,3,251,195,7,11,182,29,108,115,162,167,167,
+163,162,169,31,14,248,141,248,148,21,168,6,160,150,148,156,156,129,147,117,
+31,251,42,79,10,208,251,217,6,53,72,73,53,54,72,205,225,30,247,217,208,7,
+247,30,29,251,41,204,29,167,251,217,6,251,7,227,51,247,8,11,247,53,10,164,
+10,177,10,153,145,247,18,10,6,181,29,11,6,247,32,10,11,247,30,29,251,42,167,
+29,208,252,66,6,251,188,248,117,5,251,2,79,10,188,252,97,110,89,10,247,42,
+49,29,70,248,66,6,11,93,10,14,251,41,248,97,155,247,96,10,46,6,119,127,172,
+10,164,252,97,251,40,248,97,163,71,10,251,8,89,29,179,252,97,105,98,10,11,
+248,102,248,148,21,230,202,10,251,188,167,29,247,45,251,236,6,65,77,80,60,
+91,94,159,183,90,30,247,17,117,29,251,41,7,71,217,188,116,205,27,245,227,
+222,240,31,11,6,115,107,118,97,124,26,131,146,132,148,146,143,141,146,145,
+30,173,178,163,159,188,168,153,148,24,145,142,143,141,140,140,8,153,147,142,
+142,147,26,146,135,143,120,149,30,79,173,110,162,108,174,8,152,128,135,142,
+132,27,130,131,133,131,124,155,107,168,95,31,11,247,190,195,21,179,10,247,
+92,252,148,5,202,6,247,72,248,51,156,185,141,142,149,149,25,148,147,149,143,
+150,27,147,145,137,131,153,31,127,162,151,134,11,247,209,184,29,36,107,10,
+164,251,209,251,142,247,209,164,136,10,36,72,29,165,251,209,99,89,29,11,160,
+29,133,88,21,247,6,230,251,0,251,29,251,26,48,251,2,251,4,251,3,247,46,29,
+11,6,117,128,247,86,10,11,149,29,251,86,251,143,21,246,226,225,246,247,0,
+225,53,33,33,53,52,34,251,1,51,224,243,30,11,248,193,21,140,156,5,161,140,
+118,159,114,27,113,120,120,115,135,123,10,11,154,27,147,146,146,148,146,136,
+143,132,145,31,99,172,120,161,109,188,136,143,136,144,136,144,8,136,144,135,
+145,139,26,247,59,10,106,82,114,107,103,111,8,126,128,136,134,133,26,129,
+146,132,147,153,11,248,183,104,29,11,247,139,190,21,247,209,247,126,251,44,
+7,119,148,127,156,156,148,151,159,247,16,29,251,209,48,6,231,29,11,150,153,
+150,132,148,127,144,31,147,118,103,146,118,247,142,29,247,88,49,29,73,6,11,
+247,32,29,247,32,49,29,11,6,160,151,148,156,155,247,73,10,11,6,117,128,130,
+122,123,247,93,29,11,138,29,247,212,49,29,251,26,6,11,215,29,172,10,247,125,
+6,161,150,148,156,155,128,148,92,29,11,247,50,247,41,5,143,247,43,10,153,
+10,174,6,251,16,251,6,251,12,247,6,5,171,247,43,10,11,31,176,251,18,6,96,
+70,89,123,79,27,80,116,161,197,31,197,10,85,153,105,168,121,30,123,164,175,
+131,11,247,83,247,71,21,180,173,247,58,251,54,5,124,89,10,247,23,98,29,97,
+6,251,93,247,86,247,42,247,15,5,184,6,160,151,148,156,11,247,187,247,244,
+21,97,107,109,99,100,171,109,181,31,150,6,181,171,169,178,179,107,169,97,
+31,14,119,10,14,6,247,31,10,11,7,130,29,11,127,210,128,159,133,163,124,8,
+165,123,155,109,107,26,70,72,88,48,51,69,186,201,134,30,159,138,131,148,123,
+27,122,130,128,118,31,251,1,80,29,153,7,11,251,99,167,29,247,3,6,251,66,252,
+97,5,111,89,10,247,43,49,29,68,6,189,247,25,5,11,21,220,10,252,80,72,29,248,
+80,251,33,247,14,10,252,80,49,10,11,160,10,141,148,26,153,128,150,125,131,
+131,136,130,130,30,11,247,218,248,5,21,247,15,203,29,251,15,247,43,247,9,
+10,251,43,251,15,205,29,247,15,11,247,65,248,55,21,58,6,153,10,168,251,209,
+247,127,29,150,247,88,29,99,247,133,6,11,139,134,140,132,31,157,251,212,5,
+117,140,148,129,155,27,155,147,149,161,140,31,108,251,35,21,105,114,116,108,
+108,164,115,173,31,151,6,173,165,163,170,170,113,162,105,31,11,162,10,81,
+82,76,140,8,251,8,6,118,128,131,11,74,10,180,29,82,10,153,146,192,29,82,10,
+154,145,145,142,145,210,29,31,229,7,160,131,149,121,122,130,129,118,30,136,
+7,170,95,85,155,76,27,251,35,251,4,251,5,251,37,31,67,7,251,50,247,1,36,247,
+58,205,201,156,175,204,30,11,160,151,148,155,156,247,73,10,11,168,101,163,
+31,169,159,153,162,169,26,192,93,179,79,90,82,108,112,129,148,130,150,147,
+142,141,148,147,30,155,154,162,148,168,27,176,167,117,109,110,113,118,103,
+31,11,180,10,224,247,125,10,135,97,113,86,27,86,97,165,174,135,31,157,137,
+131,147,124,27,14,247,38,10,169,179,178,107,169,97,31,14,136,8,131,135,134,
+133,130,26,129,148,129,150,142,142,139,140,142,30,201,159,5,251,151,7,140,
+117,115,139,125,27,118,128,132,124,127,149,131,152,31,247,71,6,11,21,247,
+209,247,4,251,209,7,248,4,4,251,4,192,6,185,165,173,175,153,155,136,131,164,
+30,142,138,5,141,141,138,138,142,31,129,119,134,118,114,26,14,6,113,125,130,
+123,122,153,130,165,31,11,6,247,30,10,11,7,247,31,10,11,21,95,251,23,94,251,
+37,127,26,129,149,130,149,149,146,145,150,142,30,229,247,177,5,185,251,115,
+87,7,125,147,130,152,151,147,148,153,30,150,7,14,74,10,152,247,136,10,11,
+31,251,129,99,247,12,29,247,24,71,10,99,247,132,6,247,114,29,11,21,114,119,
+120,114,247,48,10,247,98,247,57,10,164,163,119,159,114,31,14,6,119,127,172,
+10,188,252,97,200,10,11,151,10,14,247,53,10,144,26,154,128,150,124,190,10,
+21,151,149,141,143,150,10,129,26,125,247,89,10,150,30,14,247,54,29,247,3,
+29,130,136,134,247,85,29,143,141,148,149,30,14,144,165,184,31,208,180,181,
+215,223,26,216,104,208,79,183,30,175,89,103,145,251,57,27,251,85,6,117,126,
+130,123,123,152,129,161,31,247,88,6,11,27,225,215,90,81,144,31,218,29,123,
+7,178,93,80,160,76,27,11,202,146,166,157,144,143,135,130,145,30,119,153,149,
+133,159,27,165,157,156,163,169,114,160,104,115,114,130,124,119,31,102,110,
+125,96,50,26,14,247,3,29,129,136,135,11,21,140,145,139,142,141,26,155,130,
+148,123,123,130,130,120,136,30,116,251,37,5,137,131,139,137,137,26,124,148,
+130,155,155,147,148,158,143,30,11,99,7,231,10,247,24,247,136,29,11,117,129,
+198,10,11,6,63,202,89,237,186,195,150,157,187,30,176,153,155,152,154,26,153,
+128,150,125,134,135,138,133,130,30,117,100,70,123,84,27,73,98,169,11,119,
+131,117,114,31,135,147,135,142,130,143,8,147,118,103,146,119,27,77,89,80,
+67,31,86,67,116,10,211,11,248,37,21,159,130,151,122,122,130,128,118,247,4,
+10,132,136,134,128,30,131,123,11,192,161,161,167,183,26,209,63,185,251,10,
+64,81,120,102,98,30,156,7,164,129,153,122,123,130,125,114,30,35,7,122,147,
+129,154,153,11,181,10,251,17,6,113,11,247,35,29,198,252,49,100,6,117,128,
+130,123,122,247,3,10,11,21,247,104,251,89,5,130,149,146,135,147,27,153,150,
+150,153,148,138,141,128,151,31,251,32,247,54,247,32,247,53,5,150,151,140,
+11,21,251,51,251,19,251,16,251,47,251,50,247,17,251,18,247,49,247,47,247,
+18,247,18,247,48,247,45,251,18,247,20,251,43,31,11,248,71,247,241,21,197,
+95,87,165,70,27,251,9,44,44,251,8,251,9,234,44,247,9,207,192,166,195,183,
+31,251,1,7,143,80,11,121,72,29,247,77,6,222,189,151,166,165,31,159,160,152,
+173,172,26,217,74,179,251,19,30,251,7,11,144,26,154,128,150,124,190,29,26,
+153,127,150,125,133,133,136,133,247,87,29,145,131,11,6,114,125,247,86,29,
+11,6,247,34,29,11,247,72,10,126,123,130,116,125,125,143,149,118,245,10,11,
+193,29,136,247,15,10,11,132,26,124,148,130,154,152,147,147,156,143,30,232,
+160,198,186,235,27,232,199,99,76,115,131,118,124,123,31,111,113,67,120,11,
+21,148,129,135,141,131,27,125,128,128,125,130,143,132,148,131,31,11,130,123,
+173,29,11,247,42,247,10,21,234,29,108,177,192,123,200,27,11,27,247,86,6,160,
+153,149,155,155,127,148,116,31,251,88,6,251,20,96,144,158,104,31,84,168,101,
+203,203,26,197,171,11,127,150,125,190,29,247,19,29,132,136,133,133,26,127,
+149,129,151,147,142,141,151,149,30,11,21,150,148,142,144,148,26,153,127,151,
+125,237,29,11,247,61,29,142,140,143,152,30,157,196,181,147,171,27,209,187,
+109,94,31,77,7,11,251,71,248,92,5,207,203,10,251,43,79,10,167,6,11,247,0,
+10,224,11,165,153,148,156,155,125,148,113,31,11,247,59,29,130,135,247,21,
+29,11,146,145,141,146,210,29,5,149,202,10,251,2,204,29,184,6,251,44,11,247,
+45,199,29,11,144,26,153,127,151,125,129,133,135,126,130,247,62,29,150,128,
+154,149,144,11,21,148,148,143,243,10,129,136,135,129,26,125,11,30,129,148,
+144,135,147,27,152,152,151,151,151,127,156,118,158,31,165,109,105,152,101,
+27,58,74,74,58,113,11,247,34,10,251,15,5,131,127,247,17,10,247,8,29,134,132,
+136,132,134,247,49,29,247,100,10,130,130,135,133,131,247,49,10,248,208,247,
+148,247,14,10,252,180,49,10,14,21,132,133,136,133,133,31,110,247,92,29,11,
+248,148,21,230,202,10,251,126,79,10,230,11,31,247,49,188,247,11,10,251,31,
+107,29,177,11,197,98,83,144,30,119,140,148,130,247,91,29,240,247,103,10,11,
+244,185,247,11,10,251,25,115,10,174,34,6,11,131,122,173,29,11,31,138,136,
+5,136,135,138,135,135,26,130,144,132,150,133,30,247,238,251,80,251,238,251,
+80,5,128,11,90,72,29,247,194,6,236,213,208,228,240,55,197,251,37,31,251,35,
+11,40,6,116,247,35,10,163,30,247,2,7,11,6,247,30,29,11,6,161,150,242,29,11,
+6,118,127,130,122,123,247,93,29,11,142,133,27,125,127,128,125,128,142,135,
+11,222,29,148,145,136,11,30,200,155,193,167,238,27,230,194,114,97,127,135,
+128,129,128,31,116,117,65,124,52,27,113,6,11,40,7,231,10,247,142,106,10,40,
+6,11,243,29,145,142,147,148,30,14,147,30,244,223,243,55,5,133,148,144,247,
+107,10,126,150,31,14,247,50,10,130,26,125,247,45,10,11,148,151,163,30,193,
+7,170,132,147,110,75,122,123,33,89,30,91,38,131,127,112,138,8,134,11,187,
+166,29,251,12,79,10,159,11,21,161,150,242,29,252,206,49,10,14,31,247,24,49,
+29,11,233,29,150,137,142,11,247,66,10,146,150,181,247,53,29,11,247,61,10,
+150,127,153,146,145,142,147,148,30,14,160,150,247,88,10,11,161,150,148,155,
+156,128,148,117,31,11,237,10,148,145,136,11,148,142,243,10,130,136,11,170,
+152,172,181,31,164,158,147,149,151,26,152,127,151,126,133,133,137,135,134,
+30,96,11,75,26,81,107,80,91,107,30,113,101,99,133,251,33,27,251,88,6,116,
+127,130,123,11,117,128,130,122,123,247,3,10,11,132,162,27,164,160,247,7,10,
+247,53,10,145,26,153,127,150,125,247,8,29,11,248,162,247,87,21,147,7,146,
+7,247,20,39,234,251,26,251,24,37,45,251,13,11,247,196,248,69,21,251,26,36,
+41,251,19,251,16,243,39,247,22,247,22,242,238,11,247,36,29,151,161,30,193,
+7,171,131,146,101,71,122,128,43,58,30,11,118,127,247,35,29,11,6,83,91,5,64,
+7,247,192,247,141,251,192,247,142,5,63,7,195,92,5,11,30,166,179,176,144,247,
+35,27,247,88,6,161,152,149,155,155,126,148,117,31,11,174,251,146,5,111,143,
+150,127,247,63,29,11,104,31,157,107,125,144,118,27,112,117,247,50,10,129,
+26,11,247,57,10,163,164,119,159,114,31,14,242,10,131,11,26,98,169,115,190,
+182,247,80,10,134,30,11,195,186,5,215,7,251,192,251,142,247,192,251,141,5,
+214,7,83,187,5,11,130,136,135,128,26,125,151,128,153,145,145,11,131,122,122,
+150,130,161,31,11,247,107,29,133,150,130,31,247,6,42,5,11,145,147,26,154,
+128,150,125,131,135,247,28,29,11,21,103,109,109,104,102,168,110,176,175,168,
+168,175,176,110,168,103,31,11,31,144,129,137,247,28,10,132,155,132,31,129,
+11,160,149,165,166,247,42,10,21,124,128,128,123,76,204,91,11,247,43,247,20,
+10,11,147,159,110,30,144,133,135,140,134,27,128,130,130,128,114,203,109,11,
+150,130,161,31,247,22,6,161,151,148,156,155,127,148,117,31,100,11,30,251,
+234,7,89,166,114,195,195,181,158,165,152,127,151,127,134,11,247,41,10,136,
+137,128,11,114,119,120,114,247,73,29,158,163,164,119,159,114,31,11,149,165,
+166,31,159,158,143,145,149,26,153,127,150,125,30,14,6,158,147,146,156,155,
+131,146,120,31,11,6,159,130,150,122,122,130,128,119,30,11,7,247,32,29,11,
+7,164,247,71,10,114,31,11,7,118,148,127,156,156,148,151,160,30,11,7,160,151,
+148,156,155,247,73,10,11,21,247,31,29,11,131,247,24,29,11,155,83,27,251,0,
+58,71,50,95,159,99,173,116,31,170,117,11,138,137,133,26,125,151,127,153,150,
+144,142,153,148,30,14,146,142,147,148,30,14,129,149,124,130,134,136,131,131,
+30,77,85,91,114,71,27,11,6,155,138,151,149,154,26,142,7,154,127,149,123,138,
+30,11,247,14,10,252,38,6,118,128,11,21,150,149,142,143,148,26,154,128,150,
+124,132,134,137,131,11,149,134,140,117,152,8,121,150,128,154,153,26,178,192,
+168,11,31,247,40,106,10,91,6,11,36,198,43,236,84,30,251,21,6,116,128,131,
+122,123,152,11,247,80,29,71,30,14,136,146,247,90,10,11,140,133,247,90,29,
+11,247,72,29,128,118,30,11,160,151,148,155,156,128,148,117,31,11,113,125,
+130,122,123,153,130,165,31,11,118,128,247,85,10,11,118,148,128,155,156,148,
+150,160,30,11,129,133,135,127,130,30,55,11,148,126,156,156,148,152,11,129,
+149,127,131,136,137,128,130,30,251,243,252,46,5,11,139,142,27,152,150,150,
+153,150,132,148,127,144,31,147,11,21,97,107,109,100,100,171,108,181,31,150,
+6,181,171,11,181,247,46,10,11,247,107,247,39,7,209,203,88,83,80,61,90,45,
+31,11,248,109,21,145,146,142,145,145,26,151,129,149,127,131,11,31,158,157,
+144,146,149,26,152,127,150,125,30,14,6,161,150,148,156,156,129,147,116,31,
+251,2,6,11,134,133,26,127,149,129,151,148,141,141,151,149,30,11,150,129,247,
+77,29,11,247,80,10,135,30,11,113,120,120,114,115,159,119,163,165,159,158,
+164,163,11,247,83,29,114,31,11,26,124,150,247,115,10,128,112,110,31,124,126,
+133,129,11,145,136,145,27,153,151,150,153,11,148,147,152,151,130,147,125,
+31,11,21,145,148,141,144,11,150,130,160,31,11,128,156,156,148,151,162,30,
+172,7,170,131,147,11,6,120,131,132,123,122,147,132,158,31,247,17,11,22,114,
+119,120,114,114,159,120,164,164,159,158,11,26,152,128,150,126,131,134,137,
+130,130,30,93,11,152,132,136,142,130,27,132,135,135,121,129,31,11,153,157,
+136,132,163,30,135,150,140,139,142,27,11,30,251,6,43,5,130,132,135,131,131,
+26,125,11,31,143,6,247,50,251,41,251,70,251,60,5,11,160,130,150,122,123,130,
+128,118,30,251,154,7,11,170,99,86,156,80,27,251,29,41,44,251,25,11,247,224,
+247,180,21,247,67,247,116,5,151,6,11,69,247,27,105,203,102,182,106,153,25,
+168,170,11,102,102,94,94,102,176,185,184,175,176,184,31,11,113,91,93,31,95,
+92,110,70,78,26,58,7,11,6,251,89,248,148,5,11,26,155,128,148,117,30,11,153,
+148,155,156,125,148,11,165,7,166,153,132,126,11,127,148,118,31,11,6,165,148,
+144,155,151,129,147,125,31,128,11,148,127,156,156,148,152,163,30,247,1,7,
+11,27,189,173,167,180,177,115,163,98,142,31,11,154,148,145,158,150,30,247,
+34,247,134,5,11,160,150,148,156,156,129,147,117,31,38,6,11,169,121,31,168,
+121,168,132,213,132,194,133,11,179,159,160,150,130,148,129,136,135,138,136,
+11,98,95,66,61,26,251,17,243,40,247,22,11,113,105,108,111,115,102,102,111,
+163,170,172,11,146,151,148,26,152,128,150,125,30,14,118,148,128,156,155,148,
+150,160,30,14,130,123,122,151,130,159,31,11,130,123,122,150,130,161,31,11,
+148,156,155,128,148,117,31,11,148,155,156,128,148,118,31,11,150,128,154,146,
+143,141,148,11,27,154,150,150,154,147,139,11,31,247,42,6,160,151,148,11,119,
+159,114,31,247,98,22,11,126,156,156,148,153,163,30,213,7,138,11,5,101,7,247,
+41,180,21,38,6,240,11,6,160,150,148,155,155,127,148,119,31,11,6,160,150,148,
+156,155,127,148,119,31,11,6,117,128,130,122,123,150,130,161,31,11,6,164,153,
+148,155,156,126,148,113,31,11,6,119,131,132,122,123,147,132,159,31,11,131,
+134,136,131,130,30,251,7,42,5,11,7,164,153,148,156,155,125,148,114,31,11,
+7,158,129,150,123,123,129,128,120,30,11,7,159,130,150,122,122,131,128,119,
+30,11,7,114,125,130,122,123,153,130,164,31,11,248,139,22,247,76,7,160,130,
+150,122,11,134,113,94,31,70,98,97,63,55,26,11,136,145,27,153,151,150,153,
+150,137,142,11,21,149,147,143,145,148,26,153,127,151,11,148,26,153,127,151,
+125,132,132,136,131,11,26,90,76,103,54,57,72,173,181,30,11,27,175,175,157,
+171,165,31,168,175,153,11,176,175,168,168,176,175,110,168,103,31,11,211,251,
+30,24,114,153,140,138,167,27,11,106,128,122,73,127,30,103,251,102,5,11,128,
+153,147,143,141,148,149,30,14,138,140,131,147,31,133,145,5,14,247,146,21,
+69,251,5,209,6,14,219,10,14,49,29,14,7,181,10,11,181,29,110,11,153,10,188,
+11,99,75,10,11,130,247,76,29,11,159,29,104,11,247,39,10,126,11,247,146,123,
+29,11,130,160,215,10,99,11,74,10,153,145,145,11,82,10,153,146,145,11,245,
+10,159,11,247,23,29,130,30,251,7,42,5,11,6,105,10,11,105,10,99,11,247,28,
+29,129,136,135,129,26,125,247,0,29,146,216,10,11,158,10,126,247,86,29,176,
+251,18,6,11,221,10,146,27,154,150,150,11,248,8,247,0,10,225,224,122,29,11,
+122,29,135,29,247,54,29,150,10,247,85,29,11,247,136,29,36,107,10,164,11,247,
+54,29,148,26,153,169,10,11,63,10,251,65,11,52,29,14,};
+#endif
@@ -0,0 +1,2759 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusRoman_Bold_cff_size = 57297;
+asm(".section .rodata");
+asm(".global fz_font_NimbusRoman_Bold_cff");
+asm(".type fz_font_NimbusRoman_Bold_cff STT_OBJECT");
+asm(".size fz_font_NimbusRoman_Bold_cff, 57297");
+asm(".balign 64");
+asm("fz_font_NimbusRoman_Bold_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusRoman-Bold.cff\"");
+#else
+const int fz_font_NimbusRoman_Bold_cff_size = 57297;
+const char fz_font_NimbusRoman_Bold_cff[] = {
+1,0,4,2,0,1,1,1,17,78,105,109,98,117,115,82,111,109,97,110,45,66,111,108,
+100,0,1,1,1,57,250,26,0,250,27,1,250,28,12,0,250,29,2,250,30,3,248,20,4,251,
+1,12,3,208,12,4,251,60,251,233,250,203,250,168,5,29,0,76,157,5,13,28,49,125,
+15,28,49,147,17,189,29,0,0,199,196,18,2,4,2,0,1,0,3,0,9,0,16,0,22,0,28,0,
+38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,0,123,0,136,
+0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,216,0,227,0,
+238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,1,103,1,115,
+1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,190,1,196,1,
+206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,2,38,2,44,
+2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,2,151,2,
+162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,3,20,3,
+27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,118,3,
+131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,3,216,
+3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,73,4,
+79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,163,4,
+168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,4,251,
+5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,5,127,
+5,136,5,141,5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,229,5,
+237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,112,6,
+121,6,128,6,137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,6,248,
+7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,115,7,
+122,7,134,7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,7,211,
+7,214,7,219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,1,8,4,
+8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,
+8,80,8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,8,127,
+8,132,8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,230,8,
+239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,134,9,
+154,9,163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,10,
+6,10,15,10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,114,
+10,123,10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,10,
+213,10,222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,46,
+11,53,11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,11,
+144,11,151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,214,
+11,221,11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,12,54,
+12,63,12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,153,12,
+162,12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,12,252,
+13,5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,102,13,
+111,13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,13,191,
+13,200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,14,18,
+14,25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,102,
+14,109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,14,
+179,14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,249,
+15,0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,15,
+84,15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,15,
+161,15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,75,16,87,73,74,65,
+98,114,101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,67,99,
+97,114,111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,
+99,114,111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,116,
+69,111,103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,99,99,
+101,110,116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,76,99,
+97,114,111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,110,103,
+97,114,117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,83,
+97,99,117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,114,
+105,110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,99,117,
+116,101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,117,
+110,105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,114,
+99,117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,114,
+99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,105,
+114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,73,
+109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,109,
+102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,109,
+97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,109,
+97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,114,
+99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,85,109,
+97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,73,98,
+114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,111,
+103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,111,
+116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,101,
+99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,110,
+101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,97,
+99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,82,111,109,97,110,32,66,111,108,100,78,105,
+109,98,117,115,32,82,111,109,97,110,1,17,2,0,1,0,18,0,46,0,126,0,197,1,65,
+1,175,1,230,2,11,2,125,2,132,2,153,2,248,2,254,3,52,3,104,3,124,3,181,4,70,
+4,193,5,25,5,56,5,62,5,174,5,224,6,6,6,113,6,168,6,180,7,21,7,124,7,224,8,
+36,8,130,8,214,9,16,9,40,9,126,9,208,10,32,10,91,10,115,10,185,10,208,11,
+19,11,83,11,110,11,128,11,182,11,214,11,223,12,5,12,52,12,67,12,87,12,138,
+12,149,12,175,12,201,12,249,13,9,13,27,13,32,13,78,13,124,13,147,13,180,13,
+225,13,233,13,242,14,15,14,45,14,76,14,119,14,162,14,173,14,215,15,0,15,11,
+15,21,15,42,15,80,15,90,15,127,15,155,15,161,15,170,15,205,15,217,15,251,
+16,29,16,63,16,71,16,99,16,109,16,141,16,146,16,177,16,208,16,238,16,244,
+16,247,17,3,17,7,17,36,17,65,17,70,17,86,17,91,17,119,17,127,17,155,17,183,
+17,211,17,230,17,238,18,9,18,36,18,45,18,56,18,74,18,100,18,126,18,152,18,
+176,18,193,18,203,18,228,18,251,19,9,19,33,19,57,19,67,19,91,19,101,19,124,
+19,147,19,163,19,186,19,209,19,215,19,238,20,3,20,24,20,46,20,68,20,89,20,
+110,20,131,20,144,20,165,20,186,20,201,20,213,20,233,20,240,21,4,21,11,21,
+24,21,44,21,62,21,80,21,84,21,88,21,102,21,121,21,140,21,159,21,178,21,188,
+21,199,21,217,21,235,21,246,22,8,22,26,22,31,22,39,22,56,22,65,22,82,22,99,
+22,116,22,124,22,141,22,156,22,166,22,176,22,192,22,208,22,224,22,240,23,
+0,23,16,23,32,23,48,23,64,23,78,23,84,23,99,23,114,23,129,23,144,23,159,23,
+174,23,187,23,200,23,214,23,228,23,242,24,0,24,14,24,21,24,35,24,49,24,61,
+24,70,24,74,24,87,24,100,24,113,24,126,24,139,24,152,24,158,24,171,24,184,
+24,195,24,202,24,214,24,226,24,238,24,250,25,1,25,13,25,25,25,37,25,49,25,
+61,25,73,25,85,25,97,25,109,25,121,25,129,25,140,25,151,25,162,25,173,25,
+184,25,195,25,206,25,217,25,228,25,239,25,250,26,5,26,14,26,23,26,29,26,34,
+26,39,26,52,26,57,26,72,26,76,26,93,26,97,26,119,26,127,26,139,26,146,26,
+153,26,158,67,29,88,150,161,120,188,27,182,170,155,180,177,31,111,29,11,249,
+81,249,56,21,251,112,114,6,216,134,160,118,66,26,251,197,7,251,40,83,70,251,
+11,36,77,29,11,248,38,247,17,21,90,98,109,121,96,27,100,110,157,174,118,31,
+121,171,131,172,135,208,8,247,144,6,133,223,124,186,107,177,8,178,107,92,
+159,83,27,251,16,55,40,251,38,251,38,221,43,247,16,220,188,170,233,204,31,
+251,154,247,63,21,247,12,142,157,179,188,27,186,154,105,251,3,141,31,124,
+7,11,248,29,249,71,21,251,102,251,40,251,39,251,101,251,99,247,39,251,39,
+247,99,247,99,247,39,247,39,247,100,247,96,251,40,247,43,251,94,31,138,106,
+21,247,2,203,251,13,251,100,251,98,78,251,1,251,8,251,7,77,247,1,247,95,247,
+108,202,247,8,247,9,31,11,250,105,249,56,21,251,74,114,6,193,136,154,129,
+108,26,126,136,124,135,125,30,251,4,251,235,251,0,247,228,5,128,173,136,151,
+149,26,163,154,148,183,142,30,141,144,139,140,145,31,164,251,204,114,7,180,
+137,159,130,150,115,174,43,24,251,10,251,200,251,12,248,0,5,134,156,137,146,
+148,26,168,151,148,191,143,30,164,251,186,114,7,181,133,149,130,156,90,247,
+104,252,238,24,167,6,247,78,248,113,247,63,252,113,5,166,6,247,92,248,238,
+152,179,161,160,173,142,25,11,247,232,247,218,21,247,37,117,7,124,133,133,
+134,126,27,133,130,141,144,123,31,150,107,116,143,116,27,48,73,77,55,73,180,
+93,240,96,31,208,109,166,114,107,26,100,109,113,94,69,93,184,226,118,30,111,
+251,57,164,6,161,150,145,145,148,27,144,147,137,135,149,31,127,168,189,128,
+168,27,230,202,201,229,210,101,182,39,181,31,71,168,111,164,173,26,172,167,
+164,177,166,165,128,118,161,30,160,119,150,121,154,95,8,11,247,143,248,109,
+21,251,20,41,34,251,28,251,35,233,36,247,24,247,22,234,242,247,32,247,33,
+43,242,251,21,31,140,108,21,197,158,84,251,56,251,46,119,87,81,80,119,190,
+247,39,247,67,157,191,201,31,11,248,120,248,111,21,247,109,109,7,74,29,150,
+136,132,161,31,122,188,176,132,183,27,247,40,239,224,247,18,214,94,214,74,
+171,31,140,29,11,249,95,164,21,121,126,144,153,129,31,251,93,247,177,198,
+158,164,151,167,165,25,168,166,155,179,184,26,247,8,40,201,251,75,30,251,
+214,114,6,211,135,153,125,141,65,8,252,78,7,137,65,130,129,62,131,8,114,247,
+230,164,7,63,148,129,150,137,211,8,247,88,166,7,247,99,251,205,5,247,97,6,
+252,75,248,236,21,145,143,154,142,145,30,149,145,155,144,164,27,231,176,96,
+34,75,124,100,107,118,31,113,122,105,132,63,138,8,11,21,196,6,251,15,200,
+29,153,29,248,108,178,29,252,120,7,138,87,125,128,68,131,8,114,248,214,7,
+11,249,135,247,179,21,251,235,114,6,223,135,154,129,141,83,8,34,7,88,110,
+117,72,76,97,158,182,106,30,95,195,118,225,247,12,26,247,102,202,247,2,247,
+13,186,182,121,101,182,30,182,101,163,104,173,64,85,29,82,90,150,91,27,251,
+92,251,41,251,45,251,99,251,98,247,38,251,36,247,102,242,247,0,163,177,204,
+31,247,19,7,141,212,150,151,212,146,8,11,202,248,26,61,29,11,248,56,247,52,
+21,111,6,131,109,130,121,123,116,104,93,115,129,53,138,8,110,6,247,123,248,
+39,5,165,252,7,7,132,251,34,5,165,6,164,234,165,155,247,32,138,251,126,252,
+40,24,114,248,19,7,11,247,56,29,203,247,2,247,12,186,181,121,101,183,30,182,
+101,163,104,173,64,85,29,82,90,150,91,27,251,92,251,41,251,45,251,97,251,
+99,247,38,251,37,247,100,247,7,207,174,247,3,240,31,11,248,48,247,1,21,90,
+29,251,31,228,41,247,17,216,195,170,213,197,31,11,249,14,247,133,21,113,6,
+94,251,58,84,102,251,101,136,8,65,6,248,15,249,5,5,155,252,160,7,118,251,
+98,5,167,6,187,247,31,184,170,247,39,137,151,140,173,140,176,140,252,18,253,
+5,24,123,248,216,7,11,208,21,129,7,141,89,122,121,89,138,8,115,119,247,214,
+159,114,6,89,140,123,157,140,189,8,149,151,7,200,198,151,160,183,31,221,178,
+194,230,238,26,247,6,71,235,32,173,30,108,149,122,141,67,144,121,140,24,150,
+7,138,188,155,157,189,141,8,164,159,251,214,119,163,6,189,137,156,121,137,
+90,8,128,7,97,136,72,135,112,132,99,120,25,55,97,86,51,40,26,40,194,48,221,
+100,30,117,184,197,128,201,27,247,46,248,123,21,241,133,194,60,251,32,26,
+251,31,84,60,37,133,30,251,35,22,37,145,84,218,247,31,26,247,32,195,218,240,
+145,30,14,249,149,164,21,114,140,128,144,126,154,251,197,248,14,24,247,80,
+247,86,175,164,236,147,8,164,251,181,114,7,218,133,145,136,115,26,123,134,
+131,108,108,30,251,109,251,110,5,247,106,7,141,212,154,154,211,143,8,164,
+251,230,114,7,206,136,158,124,140,86,8,252,120,7,138,87,123,126,69,133,8,
+114,247,229,164,7,69,147,122,152,138,189,8,247,88,7,166,164,247,74,251,119,
+5,158,115,144,130,128,26,126,125,134,106,137,30,134,126,139,138,125,31,114,
+247,228,7,11,247,180,247,187,21,208,29,153,115,145,125,220,29,132,145,104,
+200,251,101,247,245,24,204,220,5,236,217,173,162,211,27,159,251,127,119,161,
+7,166,155,127,119,125,132,126,120,116,31,251,60,251,97,5,247,103,7,137,195,
+154,157,192,141,8,147,159,251,197,119,158,6,192,137,154,121,137,83,8,252,
+106,7,113,29,247,197,159,131,100,29,11,196,248,88,21,119,7,168,138,155,118,
+137,102,8,251,186,7,115,29,130,134,123,114,29,127,131,134,129,185,29,7,11,
+80,29,168,174,229,29,248,149,248,97,21,251,106,116,6,169,134,156,135,144,
+136,8,143,136,142,133,134,26,129,129,121,128,128,30,251,20,251,20,5,248,67,
+251,79,115,7,171,138,154,121,140,100,8,252,146,7,138,99,123,120,108,138,8,
+115,247,131,163,7,92,146,135,145,138,186,8,247,6,7,162,163,234,251,26,5,157,
+114,145,127,131,26,127,125,133,111,138,30,115,247,126,163,7,128,134,142,151,
+130,31,251,86,247,160,239,244,165,157,202,147,25,11,247,154,247,210,21,247,
+149,251,114,6,113,29,247,207,159,121,100,29,248,103,7,136,197,155,158,243,
+29,120,137,81,8,251,97,251,149,247,97,7,137,198,154,157,150,29,191,137,155,
+247,55,29,247,147,163,21,107,123,159,179,138,31,248,228,251,82,115,7,172,
+138,156,120,140,101,8,252,146,7,138,101,121,118,107,138,8,115,247,131,7,11,
+249,42,21,119,189,7,167,153,127,117,129,136,125,133,127,31,251,29,251,192,
+251,36,247,206,5,134,151,135,152,146,26,154,148,148,154,30,189,159,251,188,
+119,6,172,140,158,125,158,103,247,122,252,106,24,83,116,117,116,111,27,119,
+132,148,167,138,31,177,138,117,162,103,27,100,112,112,100,86,183,103,204,
+178,173,152,164,165,31,156,156,150,156,163,190,247,112,248,104,24,164,193,
+149,148,173,140,8,150,159,6,11,247,164,247,51,21,248,40,7,78,29,119,247,208,
+159,120,6,87,142,124,155,140,191,247,141,248,50,24,252,45,7,113,29,247,207,
+159,121,100,29,248,103,7,137,197,154,247,45,29,188,138,158,119,137,92,8,11,
+247,244,159,21,149,29,191,137,155,247,51,29,247,151,247,194,21,138,163,159,
+139,154,27,226,192,149,164,186,31,192,168,170,193,203,26,206,106,193,80,170,
+30,159,99,105,146,73,27,251,221,119,159,6,191,136,154,122,137,83,8,252,106,
+7,140,83,124,122,86,136,8,121,119,247,221,159,107,100,29,248,163,4,140,159,
+157,139,154,27,171,165,133,128,155,31,166,120,155,93,79,26,39,102,98,49,128,
+123,139,140,123,30,14,21,141,149,150,140,145,27,147,146,136,134,143,31,148,
+129,139,138,140,42,8,251,13,7,109,142,115,145,117,30,83,154,188,105,205,27,
+247,8,216,246,247,53,211,125,207,117,168,31,159,124,120,149,115,27,102,115,
+115,103,108,158,116,172,127,31,168,130,142,137,147,131,8,152,125,146,113,
+101,26,41,97,70,80,95,121,172,216,30,247,88,7,184,111,178,106,132,135,138,
+138,135,30,251,4,93,5,11,249,18,21,205,135,157,125,141,87,8,252,110,7,137,
+87,125,127,69,133,8,115,248,209,7,178,247,96,5,112,6,108,73,119,111,104,111,
+8,103,94,86,123,64,27,76,121,151,182,31,247,129,7,246,179,101,251,6,150,31,
+165,247,224,113,6,125,251,4,100,103,34,140,8,247,120,7,176,151,148,193,227,
+192,127,111,170,30,170,112,153,109,152,72,8,163,247,89,252,201,6,248,19,11,
+247,211,21,166,6,182,165,119,90,159,31,148,117,143,158,29,191,88,149,45,8,
+161,247,74,252,155,119,157,6,193,137,154,121,247,31,29,85,136,8,121,119,248,
+167,6,171,247,95,5,114,6,116,251,3,68,83,251,9,140,8,101,6,94,124,157,192,
+141,31,11,248,5,247,43,21,67,123,101,99,86,27,87,104,183,203,160,142,155,
+147,160,31,120,169,165,130,167,27,178,166,161,169,167,116,158,105,111,115,
+133,125,105,31,126,160,134,154,156,26,176,171,165,185,180,168,131,117,176,
+30,158,230,5,157,84,106,145,90,27,251,1,69,93,69,95,162,107,192,111,31,76,
+108,112,104,86,26,61,203,89,240,243,204,191,241,161,30,11,247,204,21,251,
+26,247,163,5,128,161,138,144,146,26,155,155,148,166,30,155,159,251,181,119,
+151,6,172,135,161,247,27,29,140,83,124,122,86,136,8,110,119,247,229,159,109,
+6,86,142,124,156,142,195,8,247,72,7,247,26,247,166,177,214,150,150,185,145,
+25,159,251,83,119,159,7,171,160,123,114,123,133,122,123,106,31,11,247,5,29,
+247,78,7,247,27,140,173,143,183,156,8,220,170,183,199,217,26,247,8,44,205,
+251,59,30,251,214,114,6,154,29,248,217,21,162,156,151,172,222,172,95,251,
+0,76,127,101,113,116,30,119,115,106,132,68,27,11,176,29,224,63,191,251,14,
+251,5,63,88,64,126,29,251,11,103,90,120,102,113,202,29,11,248,34,247,14,21,
+92,100,109,121,97,27,101,110,156,174,119,31,120,170,132,172,135,206,8,247,
+139,6,133,220,124,186,108,177,8,176,107,94,159,84,27,251,13,56,42,251,35,
+251,35,219,45,247,14,218,187,170,231,203,31,251,149,247,59,21,247,10,142,
+156,178,188,27,167,157,124,108,147,31,143,120,142,113,140,88,8,124,7,11,248,
+47,247,105,21,188,251,6,5,147,118,143,127,130,26,113,121,128,96,30,114,119,
+247,194,159,130,6,115,141,132,146,123,174,251,149,248,240,24,111,6,251,97,
+252,184,118,74,109,106,100,137,25,119,247,101,159,117,7,104,112,158,163,148,
+142,152,147,161,31,177,245,5,226,247,130,21,223,251,94,5,251,49,6,11,153,
+22,247,208,6,247,108,247,36,247,30,247,99,247,98,251,31,247,17,251,124,31,
+251,197,114,6,202,134,158,124,140,92,8,252,129,7,95,112,117,83,30,247,137,
+248,218,21,162,159,151,178,211,189,106,70,174,30,166,87,153,66,54,26,45,119,
+52,107,94,30,93,105,91,116,74,27,94,126,152,184,31,11,248,88,21,119,7,168,
+137,154,119,137,102,8,251,187,7,141,103,124,119,110,137,8,119,247,119,7,247,
+2,199,183,219,228,74,188,251,10,123,134,139,137,113,31,247,5,217,29,7,95,
+251,118,21,140,147,143,139,144,232,29,11,249,69,164,21,95,128,153,247,17,
+85,129,29,152,146,163,161,193,30,154,179,5,165,29,11,21,251,88,251,44,251,
+47,251,93,251,89,247,44,251,49,247,83,247,94,247,42,247,43,247,97,247,91,
+251,43,247,47,251,88,31,87,4,247,45,247,15,251,27,251,60,251,63,251,14,251,
+24,251,50,251,42,251,15,247,28,247,58,247,61,247,15,247,27,247,46,31,14,112,
+131,133,132,121,27,130,127,142,146,118,31,156,93,107,161,29,86,26,70,136,
+29,11,192,137,155,120,137,81,8,251,108,7,119,87,108,132,106,27,105,114,149,
+160,124,31,127,155,136,157,180,26,247,29,7,136,197,155,158,192,141,8,150,
+159,251,195,119,152,6,192,137,155,120,137,81,8,251,39,7,40,196,90,247,6,196,
+188,149,166,213,30,11,191,150,162,148,163,159,8,172,164,159,182,181,26,194,
+107,188,81,170,30,162,96,94,148,67,27,79,251,233,21,163,6,233,186,92,44,51,
+96,86,68,101,126,153,178,31,248,168,4,158,6,225,188,92,56,54,92,91,56,135,
+129,139,140,129,31,14,108,29,212,27,213,209,161,176,182,31,184,177,165,215,
+232,26,247,211,7,140,199,153,155,202,148,8,11,137,197,154,158,125,29,252,
+103,7,141,83,124,122,86,136,8,120,11,247,101,248,93,21,247,34,29,143,27,162,
+150,119,95,31,251,110,7,87,141,127,154,115,30,122,149,150,130,148,27,144,
+146,141,142,148,31,247,17,189,132,161,5,133,124,130,137,132,27,113,135,150,
+219,31,11,21,106,109,108,106,102,167,110,174,175,167,167,175,175,110,169,
+104,31,247,101,22,106,110,109,105,102,166,110,174,175,168,11,170,29,195,177,
+179,226,162,124,29,247,129,247,190,21,205,164,160,167,163,27,163,149,118,
+92,31,252,135,247,17,248,144,7,210,92,192,77,91,103,110,69,103,30,238,168,
+29,7,11,248,97,21,95,196,251,225,7,138,95,128,127,94,135,8,115,247,135,163,
+7,99,141,133,150,138,205,8,247,206,247,30,251,225,7,138,95,131,128,101,134,
+8,115,247,125,133,29,11,106,29,142,146,150,149,149,30,161,161,163,175,29,
+7,11,8,164,247,126,112,6,103,124,130,129,118,27,130,125,143,149,117,31,163,
+11,27,72,87,115,95,112,31,118,104,131,98,53,26,247,31,22,247,14,7,194,153,
+161,175,157,150,132,127,134,136,133,133,129,30,130,124,135,129,128,26,108,
+165,115,173,149,144,140,143,151,30,136,11,159,21,149,29,192,137,154,119,29,
+6,11,92,29,123,125,142,148,116,31,133,141,123,102,5,126,175,166,134,172,27,
+219,247,21,29,127,31,14,92,29,123,126,142,148,115,31,133,141,123,102,5,126,
+175,166,134,172,27,219,247,21,29,127,31,11,97,102,113,125,98,27,52,84,226,
+247,28,242,171,202,191,155,154,131,128,145,31,144,130,139,139,97,26,89,140,
+156,117,177,27,181,165,163,178,201,72,187,51,251,28,39,33,251,36,11,146,29,
+172,159,146,149,162,26,165,120,157,110,120,247,1,29,150,131,5,142,150,146,
+140,149,27,168,156,126,116,112,119,125,101,11,251,72,103,29,14,251,105,252,
+25,24,75,251,5,132,130,100,133,8,114,247,98,164,7,122,141,5,87,145,125,148,
+167,26,151,143,151,150,160,30,239,247,80,5,247,82,251,76,6,138,64,125,11,
+249,65,249,117,21,89,6,76,46,5,173,75,90,152,70,27,251,99,251,40,251,41,251,
+99,89,147,93,156,95,31,163,79,163,107,198,88,53,251,18,24,189,6,210,243,5,
+11,247,17,248,53,21,93,101,101,93,91,175,102,186,188,176,175,187,185,101,
+178,92,31,14,247,248,231,29,107,89,91,168,108,184,144,144,139,140,145,30,
+140,142,141,139,141,27,150,147,130,126,101,105,97,64,87,31,11,119,166,6,174,
+138,160,116,101,26,251,145,7,251,80,110,46,82,123,130,148,154,143,139,143,
+140,143,30,150,7,169,115,161,105,101,116,114,98,84,180,102,199,198,186,174,
+11,21,195,6,247,34,199,29,11,6,86,142,124,156,141,195,8,11,138,29,141,84,
+146,114,160,110,8,104,165,180,120,192,27,195,180,159,180,165,31,156,165,146,
+164,145,190,8,14,220,29,133,145,103,200,251,101,247,245,24,204,220,5,236,
+217,174,162,210,27,159,251,127,119,161,7,166,155,127,11,231,29,107,88,93,
+168,107,183,144,145,139,140,145,30,140,142,141,139,141,27,150,147,130,127,
+100,105,97,64,87,31,11,88,8,252,120,7,138,89,123,126,71,131,8,114,247,229,
+164,7,68,146,121,152,138,190,8,247,122,247,133,251,122,7,137,88,122,126,68,
+132,8,114,247,232,7,11,247,162,249,10,21,92,101,102,93,92,176,101,186,185,
+177,177,185,185,101,177,94,31,248,94,22,92,101,102,93,92,177,101,185,185,
+177,177,185,184,101,178,94,31,11,230,29,143,126,155,176,26,247,159,7,11,21,
+80,140,128,148,185,26,247,229,128,7,251,56,74,5,118,7,149,169,157,144,147,
+27,155,146,126,111,31,251,113,7,90,140,125,128,75,27,119,247,135,7,11,95,
+198,247,28,30,247,226,7,141,216,153,152,220,141,8,164,251,230,114,7,208,133,
+150,126,141,66,8,251,226,7,41,160,90,200,95,30,104,187,203,121,11,117,29,
+165,120,157,110,119,122,130,120,11,127,29,182,157,142,150,148,149,31,11,251,
+87,196,21,108,112,119,127,115,27,109,118,166,179,197,181,181,219,160,31,11,
+127,27,133,136,143,144,141,139,139,141,149,31,140,145,139,139,143,26,168,
+117,160,108,106,117,116,104,93,169,109,185,178,169,158,174,156,30,159,11,
+141,83,124,122,86,136,8,120,119,11,30,131,119,247,103,159,6,115,140,137,140,
+113,183,251,38,247,126,24,182,189,199,210,155,149,193,140,25,159,251,65,119,
+159,7,155,148,132,11,141,102,123,118,110,138,8,119,247,96,159,7,114,144,127,
+159,140,247,20,29,153,116,144,129,134,26,130,11,123,29,247,131,7,11,146,29,
+172,160,146,148,162,26,11,21,251,91,251,58,251,56,251,87,251,99,247,53,251,
+56,247,93,247,97,247,55,247,54,247,95,247,94,251,55,247,55,251,94,31,11,120,
+137,81,8,252,103,7,113,29,247,208,11,7,138,97,131,131,92,131,8,115,247,165,
+7,61,248,187,21,146,148,155,151,152,30,161,159,162,151,161,27,191,163,79,
+251,23,11,21,252,160,7,58,247,102,86,116,247,19,251,178,5,216,6,247,20,247,
+178,86,162,58,251,102,5,248,160,7,220,251,102,192,11,202,247,10,247,6,198,
+176,114,75,174,30,159,94,21,159,74,145,91,59,26,251,100,78,251,1,251,8,76,
+100,165,203,105,30,11,233,29,183,131,147,219,29,11,31,96,6,103,126,125,126,
+111,27,128,137,140,150,114,31,99,157,5,152,110,115,145,118,27,78,247,43,29,
+150,29,191,137,155,120,137,81,8,11,97,163,115,180,179,167,163,173,153,134,
+152,126,155,30,130,149,136,145,145,26,160,166,155,175,198,164,112,78,30,66,
+7,11,121,111,131,29,11,143,7,251,98,247,58,5,154,120,127,147,134,27,132,134,
+133,130,119,166,97,190,78,31,152,124,151,123,154,117,8,11,31,251,115,248,
+162,5,111,6,251,114,252,184,101,45,127,125,91,130,25,114,247,95,164,7,79,
+143,117,150,165,26,11,21,133,129,122,127,126,30,116,119,118,128,117,27,86,
+114,198,247,20,247,21,166,198,197,172,170,115,101,153,31,11,148,29,98,117,
+161,11,141,29,14,163,7,104,143,126,155,140,176,8,247,228,11,21,142,29,11,
+249,3,6,251,102,57,162,87,247,178,247,20,5,216,7,251,178,247,19,116,86,247,
+102,58,5,253,3,6,11,90,95,62,80,90,164,188,101,30,112,176,125,172,122,209,
+8,110,251,139,168,6,165,145,147,147,155,27,147,11,21,251,28,155,29,21,75,
+121,110,116,77,27,76,107,165,200,128,31,95,6,11,249,68,240,29,11,251,39,212,
+5,58,179,117,164,187,26,201,181,177,207,184,181,120,102,175,30,173,104,155,
+110,159,74,8,11,21,203,253,3,7,172,29,11,80,77,107,115,90,120,8,127,110,106,
+133,111,27,73,76,174,191,110,31,110,192,125,210,240,26,247,99,11,98,26,81,
+214,105,247,18,247,59,226,191,238,216,81,182,33,141,30,74,140,5,54,140,124,
+144,167,26,11,120,126,146,149,144,142,146,145,149,30,149,154,143,151,149,
+26,169,113,163,106,102,114,114,103,80,197,98,11,249,118,146,29,172,159,146,
+149,162,26,166,120,156,110,119,123,247,44,29,21,195,6,247,34,227,5,11,143,
+8,159,251,92,119,7,164,135,153,118,137,105,8,65,7,58,187,101,241,166,158,
+142,150,170,30,11,26,92,183,105,201,190,186,168,185,164,30,117,153,134,137,
+138,138,131,135,25,129,119,129,136,123,27,11,183,29,159,251,208,119,158,6,
+11,192,141,8,158,159,251,208,119,158,6,11,7,74,182,99,208,206,179,169,221,
+180,30,114,150,5,247,25,29,11,27,187,168,130,117,160,31,164,115,151,101,89,
+26,43,93,83,60,58,87,189,233,123,30,99,133,11,249,18,247,119,21,110,6,106,
+61,119,108,104,107,8,102,98,83,121,61,27,78,121,152,182,31,11,207,134,153,
+124,141,67,8,252,78,7,138,77,125,117,94,135,8,136,129,137,137,128,31,247,
+138,11,247,49,5,157,123,120,149,120,27,113,118,119,114,119,150,125,168,121,
+31,247,34,51,5,14,247,18,29,182,252,166,6,141,83,124,122,86,136,8,110,119,
+11,201,29,137,176,247,33,29,167,138,11,121,114,26,131,162,247,215,116,7,130,
+44,106,93,79,137,8,112,247,163,247,6,6,229,136,11,251,9,249,71,21,96,104,
+104,97,94,172,106,183,183,173,172,183,183,105,173,96,31,14,247,140,7,225,
+86,194,57,86,102,119,81,87,30,11,145,100,27,251,28,56,62,251,19,52,191,76,
+247,11,82,31,206,107,5,227,97,163,113,11,31,192,92,5,172,162,156,149,168,
+27,174,170,130,113,185,31,114,185,165,131,172,27,185,11,212,29,140,132,144,
+119,144,118,8,11,252,63,21,180,166,157,167,177,26,194,91,179,74,70,87,94,
+79,97,157,107,182,102,30,11,247,117,6,173,60,151,104,215,29,11,127,140,5,
+114,141,127,158,174,26,248,245,120,7,92,109,5,161,85,97,148,85,27,11,131,
+134,129,127,126,31,251,17,251,30,5,247,22,7,138,173,151,158,165,144,8,159,
+11,7,247,34,29,142,27,163,150,119,95,31,251,214,247,17,11,137,83,8,251,103,
+7,251,60,247,97,5,120,162,132,152,153,26,159,155,151,166,30,11,21,167,142,
+159,158,164,27,153,145,137,119,184,31,168,126,5,131,157,165,133,159,27,11,
+26,92,187,29,119,11,247,102,220,116,192,251,178,251,19,5,62,7,247,178,251,
+20,162,191,251,102,221,5,11,136,140,150,114,31,99,157,5,152,111,115,145,118,
+27,78,102,100,53,121,31,14,248,53,21,93,101,101,93,91,175,102,186,188,176,
+175,186,186,101,178,92,31,14,151,162,27,174,156,112,83,31,251,134,7,138,101,
+126,123,106,136,8,115,247,127,11,248,109,203,21,129,129,5,136,136,136,138,
+134,27,125,132,147,156,31,247,153,7,11,6,79,87,5,82,7,247,154,247,114,251,
+154,247,114,5,82,7,199,87,5,11,7,141,216,153,152,224,141,8,164,251,241,114,
+7,205,136,158,123,140,87,8,11,21,76,123,110,116,78,27,77,108,164,200,128,
+31,96,6,141,85,146,115,160,11,31,168,126,5,131,158,165,247,15,29,103,127,
+11,162,31,96,6,103,126,125,126,112,27,127,137,140,150,114,31,99,157,5,152,
+11,251,16,8,162,247,230,116,6,111,251,21,129,130,251,9,128,8,247,140,7,11,
+120,100,29,248,103,7,137,197,154,158,192,141,8,158,11,251,84,115,7,185,130,
+145,133,140,96,8,11,127,126,31,251,16,251,30,5,247,21,7,137,173,152,160,164,
+143,8,159,11,221,29,118,137,103,8,11,184,105,200,190,186,168,185,164,30,117,
+153,134,137,138,138,131,135,25,129,11,225,29,110,8,104,164,11,247,22,247,
+21,191,195,247,13,31,247,32,29,11,118,104,131,98,53,26,82,95,196,251,225,
+6,138,95,128,127,94,135,8,11,6,251,4,40,251,4,238,5,83,6,247,14,251,68,5,
+231,6,14,93,101,101,94,90,175,102,187,186,177,177,185,186,101,177,92,31,14,
+21,207,29,11,21,205,29,11,146,29,172,159,146,149,162,26,165,120,157,110,119,
+11,21,169,164,114,109,109,114,114,109,110,113,164,168,170,164,164,169,31,
+11,22,109,116,116,110,110,162,116,168,167,163,163,167,167,116,163,111,31,
+11,247,104,24,182,188,5,210,198,156,150,192,27,159,251,65,119,160,7,11,227,
+5,172,160,146,148,162,26,166,120,156,110,119,122,130,120,123,30,11,247,68,
+5,47,247,29,29,237,5,14,110,140,123,160,141,176,8,247,186,7,11,8,95,109,119,
+105,96,26,78,185,94,204,196,185,159,189,194,30,11,153,74,27,33,62,86,67,100,
+166,114,181,179,162,159,176,158,135,11,189,219,136,8,166,252,166,6,113,29,
+11,99,108,108,101,100,170,108,177,178,170,170,177,177,108,171,102,31,11,107,
+113,114,107,107,165,113,171,170,165,165,171,170,113,165,108,31,11,110,115,
+226,29,11,159,166,247,26,251,126,5,11,6,56,104,132,114,102,31,74,96,105,66,
+44,26,251,8,184,11,8,158,159,252,68,247,18,29,11,26,150,148,144,171,143,30,
+159,251,120,119,7,167,136,144,134,11,162,26,178,111,167,102,100,114,111,96,
+117,151,77,160,55,30,11,74,94,101,55,105,30,163,6,178,160,160,154,173,27,
+181,172,11,247,8,29,167,90,184,30,11,117,26,117,126,130,104,137,30,134,138,
+126,138,125,138,8,114,11,27,195,179,159,180,165,31,156,165,146,164,145,190,
+8,14,7,137,176,155,160,169,140,8,159,11,198,184,198,217,26,202,103,181,85,
+11,130,140,97,8,251,186,7,138,97,132,131,94,129,8,115,11,132,26,124,123,131,
+110,30,115,119,247,187,159,6,105,140,11,137,174,153,160,165,142,8,159,251,
+97,119,7,168,137,154,11,149,147,26,151,148,146,155,30,159,159,251,65,119,
+6,193,11,165,180,120,193,27,194,180,159,180,165,31,156,165,146,164,11,168,
+27,160,251,245,118,7,184,137,145,127,54,26,67,7,11,77,27,75,108,165,200,127,
+31,95,6,142,84,146,114,160,11,116,110,110,162,116,168,168,162,162,168,167,
+116,163,111,31,11,120,8,60,112,99,100,88,26,98,157,121,203,116,30,76,11,121,
+82,85,98,121,187,244,247,75,155,196,189,30,14,175,109,169,104,31,14,7,138,
+96,131,130,95,131,8,115,247,133,163,7,103,11,21,247,8,206,189,205,225,26,
+208,98,186,79,89,106,11,27,189,163,106,71,80,117,107,99,117,132,147,163,31,
+11,163,21,105,143,126,154,177,26,248,16,251,84,115,7,11,172,30,153,105,112,
+143,70,27,251,172,77,247,183,6,11,94,167,185,112,31,108,193,125,209,244,26,
+247,16,159,11,247,179,247,179,21,251,135,251,8,247,135,6,14,81,104,91,251,
+41,251,41,31,125,247,162,7,14,7,138,96,131,130,96,132,8,115,247,125,163,7,
+11,140,123,160,141,176,8,247,186,7,137,176,155,160,11,21,252,77,253,80,5,
+197,6,248,75,249,80,5,11,159,147,149,162,26,166,120,156,110,120,122,130,120,
+11,174,8,247,34,247,6,251,34,7,141,104,125,118,11,247,38,29,191,137,155,11,
+100,26,105,123,118,113,107,125,162,190,182,143,155,11,122,140,134,154,73,
+30,141,129,141,130,141,130,8,11,84,37,49,97,86,67,101,126,153,180,31,14,171,
+170,177,178,108,170,100,31,11,122,247,44,29,129,251,41,5,159,6,213,142,175,
+177,209,27,11,131,26,124,123,131,110,30,115,119,247,27,6,11,8,252,120,7,137,
+86,125,127,67,133,8,114,11,22,247,226,164,6,61,148,131,148,137,213,8,11,162,
+26,165,120,157,110,119,123,130,120,122,30,11,163,6,208,145,166,173,188,27,
+179,162,108,86,11,247,40,29,184,123,11,251,20,247,178,5,62,6,251,19,251,178,
+192,11,115,112,119,97,27,73,96,203,243,135,31,137,11,120,149,125,168,121,
+31,247,31,53,5,14,119,158,6,191,137,155,11,6,110,251,102,5,217,6,168,247,
+102,5,11,7,225,86,194,57,79,93,111,80,102,30,11,133,158,27,196,176,179,226,
+162,31,96,6,11,247,186,7,137,176,155,160,168,140,8,159,11,30,202,251,49,146,
+29,11,251,67,168,6,144,231,187,189,220,136,8,11,164,200,127,31,96,6,142,85,
+146,115,159,11,173,8,247,6,7,153,157,222,251,31,5,11,189,173,194,183,106,
+165,84,126,131,138,135,11,251,107,115,7,204,135,149,132,140,92,8,11,207,247,
+70,21,248,1,248,1,252,1,6,11,218,105,30,125,173,166,135,208,27,247,172,11,
+101,119,123,125,118,27,111,128,156,179,31,11,115,114,121,119,114,122,140,
+134,155,73,30,11,118,168,78,247,48,251,194,24,251,50,7,11,81,31,138,91,21,
+171,166,11,6,251,14,251,68,5,195,6,247,4,11,8,251,33,7,119,143,124,148,117,
+30,11,137,82,8,252,105,7,141,83,124,122,11,247,183,201,251,172,6,56,104,132,
+114,11,155,160,168,140,8,159,251,102,119,7,11,251,73,84,144,119,5,142,147,
+144,140,11,248,173,247,101,21,227,252,140,51,7,11,51,93,162,183,160,146,150,
+167,162,31,11,63,147,121,158,138,211,8,248,38,7,11,192,141,8,157,159,251,
+207,119,158,6,11,251,245,103,78,133,133,105,138,25,119,11,92,26,74,189,95,
+215,211,190,190,211,11,131,128,103,109,102,71,92,31,14,31,156,165,146,163,
+144,189,8,14,103,100,53,121,31,14,130,120,122,30,14,158,247,38,29,11,162,
+26,166,120,156,110,119,122,130,120,123,30,14,149,247,6,29,14,247,38,251,37,
+247,100,247,7,207,174,247,3,240,31,14,230,117,29,11,150,131,5,142,150,147,
+140,148,27,168,156,126,116,112,119,125,11,119,29,6,14,77,27,76,107,165,200,
+128,31,95,6,141,84,146,114,160,111,8,103,165,180,120,11,7,137,198,154,157,
+125,29,11,105,97,64,87,31,251,151,117,231,29,107,11,119,29,159,120,100,29,
+14,249,37,247,44,134,29,11,247,118,80,29,11,1,0,1,227,1,5,0,1,10,2,1,64,3,
+1,70,6,1,135,255,2,135,254,2,243,2,0,1,0,4,0,7,0,56,0,80,0,141,1,22,1,225,
+2,150,2,156,2,222,3,31,3,240,4,10,4,15,4,19,4,29,4,46,4,123,4,178,5,9,5,107,
+5,154,5,232,6,73,6,106,6,214,7,66,7,80,7,117,7,148,7,170,7,199,8,38,8,208,
+8,211,9,56,9,59,9,62,9,67,9,143,9,148,9,166,9,170,9,201,9,206,9,211,10,53,
+10,56,10,61,10,67,10,187,10,190,10,194,10,199,10,202,11,24,11,29,11,174,11,
+177,11,182,11,218,11,234,12,13,12,43,12,55,12,62,12,66,12,141,12,145,12,151,
+12,155,12,174,12,178,12,205,12,211,13,4,13,8,13,13,13,152,13,156,13,160,13,
+196,14,25,14,29,14,33,14,38,14,42,14,107,14,110,15,6,15,10,15,14,15,91,15,
+103,15,178,15,215,16,24,16,146,17,58,17,65,17,194,18,55,18,240,19,86,19,108,
+19,126,19,149,19,157,19,164,19,234,20,36,20,46,20,209,21,199,21,203,22,56,
+22,81,22,86,22,97,22,108,22,134,22,154,23,141,23,240,23,248,23,253,24,5,24,
+12,24,20,24,26,24,34,24,41,24,49,24,63,24,73,24,108,24,116,24,121,24,181,
+25,38,25,76,25,98,26,19,26,63,26,160,26,165,26,171,26,223,27,93,27,204,27,
+213,27,229,28,73,28,201,28,203,28,249,29,30,29,101,29,119,29,166,29,185,29,
+228,30,10,30,49,30,85,30,182,30,187,31,50,31,94,31,121,31,204,31,215,31,222,
+31,234,31,241,32,36,32,81,32,123,32,132,32,154,32,164,32,173,32,180,32,188,
+32,197,32,205,32,232,32,240,32,248,33,2,33,10,33,38,33,46,33,59,33,66,33,
+77,33,84,33,94,33,102,33,111,33,129,33,137,33,146,33,154,33,162,33,171,33,
+204,33,213,33,221,33,230,33,238,33,246,33,255,34,18,34,27,34,43,34,50,34,
+58,34,66,34,73,34,81,34,89,34,98,34,107,34,116,34,125,34,133,34,142,34,150,
+34,242,35,61,35,125,35,175,36,26,36,154,37,33,37,109,37,163,37,205,38,24,
+38,99,38,133,38,226,39,56,39,187,39,203,39,216,39,227,39,235,40,10,40,18,
+40,20,40,30,40,40,40,80,40,101,40,116,40,125,40,139,40,162,40,170,40,178,
+40,201,40,208,40,216,40,225,41,45,41,54,41,62,41,80,41,88,41,98,41,106,41,
+123,41,146,41,155,41,165,41,172,42,20,42,30,42,44,42,67,42,75,42,94,42,128,
+42,148,42,191,42,219,42,229,42,243,43,83,43,126,43,134,43,203,43,213,43,244,
+44,137,44,206,44,214,44,255,45,8,45,16,45,25,45,46,45,83,45,91,45,99,45,156,
+45,165,46,29,46,39,46,57,46,66,46,74,46,92,46,101,46,110,46,118,46,134,46,
+169,46,178,46,194,46,203,46,212,47,9,47,26,47,33,47,78,47,87,47,95,47,158,
+47,166,47,174,47,183,47,192,47,229,47,251,48,12,48,28,48,37,48,53,48,76,48,
+84,48,117,48,130,48,168,48,216,49,84,49,139,49,145,50,27,50,31,50,35,50,39,
+50,44,50,159,50,208,50,215,50,223,51,49,51,77,51,90,51,106,51,114,51,127,
+51,183,51,235,51,244,51,252,52,14,52,36,52,54,52,120,52,128,52,195,52,224,
+53,43,53,105,53,149,53,196,53,236,54,89,54,145,54,178,55,32,55,98,55,106,
+55,115,55,122,55,129,55,135,55,152,55,154,55,157,56,14,56,91,56,163,56,207,
+57,59,57,140,58,1,58,83,58,158,59,34,59,71,59,136,59,227,59,240,59,244,60,
+3,60,18,60,24,60,30,60,83,60,115,60,131,60,144,60,166,60,207,60,221,60,252,
+61,15,61,68,61,122,61,163,62,68,62,93,63,56,64,47,64,79,64,106,64,145,64,
+185,64,237,65,12,65,41,65,152,65,207,66,6,66,99,66,140,66,179,66,197,67,10,
+67,79,67,122,67,143,68,7,68,115,68,194,68,235,69,31,69,91,69,229,70,87,70,
+187,71,90,71,170,71,194,71,224,72,0,72,46,72,94,72,191,72,213,72,235,73,9,
+73,30,73,42,73,149,73,220,73,225,73,241,73,255,74,6,74,25,74,64,74,182,74,
+231,75,27,75,115,75,129,75,143,76,17,76,19,76,52,76,116,76,156,76,161,76,
+215,76,219,77,88,77,100,77,107,77,137,77,141,77,209,78,63,78,69,78,120,78,
+124,78,188,78,218,78,223,78,229,78,231,79,142,80,38,80,45,80,164,81,28,81,
+138,81,142,82,33,82,37,82,154,82,159,82,250,83,85,83,188,84,11,84,189,84,
+193,85,51,85,120,85,184,86,4,86,8,86,144,86,242,87,107,87,115,87,236,88,106,
+88,231,89,103,89,119,89,153,89,185,89,235,90,24,90,76,90,124,90,135,90,228,
+91,108,91,191,91,208,91,225,92,16,92,58,92,101,92,134,92,162,92,191,92,242,
+93,38,93,94,93,96,93,167,93,194,93,201,94,45,94,52,94,149,94,202,94,207,94,
+212,94,244,94,248,94,252,95,2,95,26,95,30,95,119,95,149,95,156,95,162,95,
+164,95,210,96,1,96,15,96,34,96,41,96,64,96,118,96,243,97,70,97,174,97,230,
+98,78,98,204,99,104,99,107,99,110,99,113,99,191,100,15,100,105,100,185,101,
+11,101,100,101,246,102,91,102,209,103,65,103,251,104,88,104,192,104,218,105,
+31,105,65,105,93,105,124,105,184,106,51,106,65,106,193,107,8,107,79,107,196,
+108,56,108,118,108,151,108,177,109,53,109,191,110,37,110,112,110,165,110,
+232,111,51,111,173,112,26,112,127,112,161,112,254,113,65,113,203,113,243,
+113,247,113,251,114,46,114,142,114,202,115,8,115,67,115,173,115,240,116,41,
+116,45,116,181,117,44,117,98,117,140,117,168,117,210,117,215,118,57,118,156,
+118,250,119,48,119,147,119,237,120,102,120,130,120,219,121,33,121,106,121,
+190,121,248,122,65,122,126,122,158,123,15,123,60,123,146,123,239,124,31,124,
+84,124,163,124,212,125,53,125,102,125,134,125,182,126,76,126,89,126,198,126,
+243,127,80,127,208,128,51,128,121,128,154,128,179,129,41,129,157,129,255,
+130,78,130,112,130,158,130,231,131,143,131,255,132,183,133,4,133,182,134,
+128,134,247,135,202,136,116,136,231,137,53,137,143,137,179,137,215,137,250,
+138,29,138,43,138,57,138,175,138,248,139,29,139,43,139,69,139,97,139,126,
+140,2,140,29,140,52,140,120,140,171,140,220,141,66,141,123,141,186,141,252,
+142,17,142,37,142,57,142,98,142,148,142,197,142,246,143,40,143,68,143,96,
+143,125,143,154,143,175,143,214,144,3,144,37,144,71,251,138,14,251,138,14,
+251,55,247,58,247,48,21,92,10,153,217,21,152,247,15,149,188,168,235,8,153,
+183,143,159,162,26,204,109,176,85,85,108,102,76,113,143,121,153,94,30,168,
+44,149,90,152,251,16,8,14,198,247,60,248,40,21,172,247,37,150,191,163,29,
+247,193,22,173,247,38,149,190,163,29,14,143,248,103,247,175,21,52,6,157,247,
+26,5,237,212,51,247,13,10,251,5,247,13,10,33,66,235,6,121,251,26,5,32,66,
+235,247,13,29,247,5,247,13,29,237,6,251,39,247,99,21,121,251,26,5,251,5,6,
+157,247,26,5,14,143,248,64,248,117,21,247,33,7,92,168,105,150,61,151,8,215,
+84,61,7,93,134,117,133,108,122,8,84,107,108,87,75,26,50,189,80,247,26,72,
+30,251,143,7,65,153,99,184,107,247,0,118,141,24,251,48,7,221,105,163,133,
+201,136,8,40,194,238,7,221,154,178,155,171,171,8,172,171,156,184,195,26,187,
+124,182,113,168,30,104,179,109,159,42,189,8,247,107,7,210,123,177,95,168,
+39,8,251,30,251,123,21,219,94,152,122,85,26,80,109,106,76,127,30,83,248,60,
+21,79,160,110,172,185,26,187,165,165,202,155,30,14,248,140,249,141,248,8,
+21,251,5,251,5,251,16,251,15,55,191,84,220,183,185,159,172,170,31,193,195,
+173,223,217,26,209,93,184,69,30,170,88,21,169,161,109,97,99,126,96,111,89,
+31,84,109,104,110,102,27,107,120,161,173,141,31,141,187,170,221,173,190,8,
+175,164,161,155,165,27,75,248,7,21,101,6,135,133,135,132,134,31,108,116,66,
+112,78,27,97,118,145,161,109,31,157,113,115,148,114,27,251,9,251,1,251,12,
+251,20,59,192,83,215,199,192,170,197,179,31,181,201,155,195,140,228,8,135,
+160,151,138,153,27,174,176,148,157,182,31,251,240,253,0,5,194,6,176,249,19,
+21,143,142,137,133,148,31,147,133,141,137,145,137,8,160,129,147,128,116,26,
+89,117,74,103,86,30,97,110,112,120,107,27,109,119,162,172,141,31,142,185,
+172,226,174,191,161,171,163,159,155,137,8,14,247,229,248,213,248,55,21,115,
+7,198,132,146,134,110,26,99,121,105,81,68,30,251,43,247,106,5,245,178,185,
+183,203,26,212,73,187,38,251,12,64,78,41,95,150,108,180,70,30,251,34,69,85,
+76,45,26,35,218,67,247,4,214,204,164,201,221,30,73,198,176,117,192,27,170,
+176,152,157,164,31,155,152,152,155,164,180,155,165,24,119,151,5,112,122,123,
+128,114,27,101,114,158,211,83,31,194,215,150,155,166,182,166,183,24,157,168,
+151,146,182,143,8,163,7,252,96,251,25,21,215,251,6,160,109,171,97,8,111,100,
+114,128,113,27,109,105,155,165,114,31,96,183,110,204,191,26,177,158,163,194,
+171,30,247,14,233,21,86,205,118,182,180,26,174,158,160,172,188,182,81,72,
+98,119,116,89,122,30,14,251,55,236,97,29,14,251,55,247,198,249,74,21,77,106,
+111,118,100,98,8,54,47,93,251,10,251,22,26,47,164,52,187,62,30,185,67,182,
+99,237,80,8,167,7,82,176,114,164,118,184,8,109,201,125,231,247,29,26,247,
+31,153,239,167,199,30,159,183,164,165,199,179,8,14,251,55,166,251,60,21,201,
+172,167,160,178,181,8,224,230,185,247,11,247,21,26,230,114,227,91,216,30,
+93,211,96,179,41,198,8,111,7,196,103,164,113,160,94,8,169,77,153,47,251,29,
+26,251,30,125,38,111,79,30,119,95,114,113,79,99,8,14,143,247,170,248,112,
+21,172,161,151,142,182,141,8,163,148,141,144,151,31,159,148,155,161,157,26,
+165,114,163,111,118,127,130,109,119,30,114,102,130,129,102,110,131,142,24,
+138,184,142,149,159,175,8,152,162,142,149,154,26,172,120,161,110,109,117,
+118,110,122,143,128,153,114,30,160,100,142,129,140,97,132,136,24,101,160,
+132,145,114,179,8,173,119,124,150,111,27,111,120,119,110,103,155,127,191,
+135,31,184,135,155,135,180,121,138,132,24,109,117,128,136,97,137,8,83,110,
+120,102,111,161,117,167,160,151,148,170,160,31,166,178,147,147,177,167,146,
+134,24,138,93,136,129,120,105,8,127,117,136,130,123,26,105,158,116,168,168,
+161,161,169,152,136,148,128,159,30,120,178,133,157,135,182,146,144,24,168,
+124,147,132,159,111,8,89,172,154,127,166,27,167,160,160,168,173,120,152,85,
+143,31,94,143,124,143,103,156,8,14,213,247,133,247,189,21,251,100,51,247,
+100,251,101,227,247,101,247,100,227,251,100,247,101,51,6,14,251,138,196,93,
+29,251,55,236,29,251,138,247,17,247,48,21,247,50,10,251,110,247,194,249,71,
+21,49,6,251,128,253,90,5,229,6,14,143,247,142,249,68,21,74,73,95,67,98,31,
+107,84,117,45,56,26,251,99,233,251,38,247,25,247,22,234,247,40,247,94,247,
+92,42,247,43,251,21,30,207,252,102,21,80,131,61,130,112,30,110,128,123,125,
+116,27,89,120,197,247,41,31,247,121,7,247,44,157,196,188,188,159,77,251,39,
+30,14,143,248,78,163,21,49,140,121,155,216,26,248,206,122,7,251,144,251,1,
+5,113,7,148,142,146,142,143,141,8,149,166,164,146,152,27,164,150,117,92,31,
+252,21,7,140,58,118,121,40,138,8,115,248,11,7,14,143,248,114,247,103,21,115,
+6,110,68,128,133,36,138,8,251,43,6,247,54,247,46,5,218,214,174,206,215,26,
+246,63,215,251,1,89,91,119,103,104,30,100,100,119,105,111,64,8,167,6,202,
+170,176,166,193,27,183,173,120,103,160,31,151,118,147,111,116,26,95,120,84,
+107,90,30,88,62,104,96,251,38,251,48,8,116,248,52,7,14,143,197,248,159,21,
+200,177,172,162,191,27,202,178,100,75,73,104,104,44,109,31,122,7,222,110,
+172,122,175,105,8,170,110,157,94,91,26,67,101,93,79,115,120,150,171,106,30,
+178,100,110,155,108,27,101,112,115,105,85,199,103,231,247,60,247,24,247,6,
+247,38,186,124,181,110,174,31,118,164,122,150,99,157,8,203,178,158,168,198,
+26,225,78,190,37,40,64,89,36,84,30,14,143,248,48,247,147,21,248,69,59,7,80,
+62,251,18,251,56,71,44,79,44,25,251,5,247,140,251,36,247,37,247,36,202,247,
+3,7,251,98,22,251,101,6,247,101,247,189,5,14,143,247,41,248,185,21,247,170,
+6,182,247,19,5,251,214,6,42,251,237,234,132,179,133,184,125,25,228,111,192,
+83,72,26,83,95,95,83,116,112,151,169,99,30,171,96,109,152,113,27,103,113,
+114,104,86,197,104,228,247,57,247,9,239,247,33,243,75,219,251,1,170,31,101,
+150,108,143,57,144,8,14,143,248,106,249,68,21,251,25,120,76,117,64,87,8,251,
+4,62,80,251,4,251,25,26,251,65,230,251,5,247,33,247,16,230,238,247,28,247,
+13,66,217,251,6,107,117,135,126,109,30,176,247,39,222,220,247,38,169,8,251,
+129,251,178,21,206,162,85,251,51,251,12,127,110,90,115,122,149,158,129,31,
+122,172,129,212,232,26,201,145,196,146,144,30,145,147,152,143,154,27,14,143,
+248,113,249,56,21,252,52,6,95,251,114,5,164,6,156,201,168,163,191,138,8,247,
+99,6,251,92,252,175,5,234,6,14,143,247,70,247,216,21,82,120,115,126,114,114,
+8,110,111,124,101,95,26,37,224,71,247,19,247,31,232,219,247,12,226,96,201,
+32,207,30,235,173,179,179,204,26,228,64,195,251,12,251,27,50,70,33,63,179,
+85,238,80,30,247,12,237,21,55,182,93,194,195,26,186,175,175,186,195,171,94,
+62,91,131,116,106,95,30,41,251,8,21,247,1,66,163,107,65,26,72,106,98,85,78,
+103,192,228,194,150,169,179,199,30,14,143,170,126,21,247,32,159,207,164,217,
+198,8,241,215,193,247,0,247,19,26,247,65,47,247,5,251,32,251,17,49,40,251,
+29,251,10,212,59,247,1,178,163,144,153,167,30,96,251,44,58,60,251,36,110,
+8,247,99,249,28,21,165,155,129,115,151,31,154,112,149,68,68,26,112,137,107,
+136,94,30,137,126,139,130,138,135,138,126,138,134,136,137,8,134,131,121,135,
+124,27,77,116,197,247,50,247,8,151,169,187,31,14,251,55,247,58,247,48,21,
+92,10,247,208,4,192,29,251,55,239,251,72,231,29,106,89,94,169,106,180,30,
+147,6,151,141,5,146,6,149,147,129,128,100,105,97,64,87,31,216,249,10,21,192,
+29,213,248,127,248,237,21,252,60,251,164,5,120,7,248,60,251,176,5,247,22,
+7,251,179,247,84,247,179,247,78,5,14,213,248,173,248,35,21,252,140,51,248,
+140,6,251,8,4,252,140,51,248,140,6,14,213,213,165,21,248,60,247,164,5,159,
+7,252,60,247,175,5,251,22,7,247,179,251,83,251,179,251,79,5,14,143,247,145,
+247,123,21,212,147,153,202,178,30,230,195,169,180,208,26,239,60,205,251,13,
+251,2,61,79,55,94,167,108,179,177,164,165,177,159,134,151,122,158,30,127,
+152,136,145,149,26,163,163,155,175,193,170,92,56,87,129,105,106,76,30,115,
+93,131,116,111,26,128,139,134,141,109,30,155,64,21,93,100,100,94,91,176,102,
+187,186,176,176,186,186,101,177,93,31,14,248,70,248,231,248,102,21,182,116,
+125,149,103,27,95,96,120,106,107,31,87,84,107,60,65,26,74,180,89,192,182,
+187,167,185,174,30,94,146,176,109,189,27,241,226,247,5,247,26,247,62,251,
+39,247,23,251,82,251,102,251,59,251,51,251,94,251,88,247,58,251,45,247,105,
+214,191,153,185,236,31,126,174,5,102,58,89,127,71,27,251,67,251,16,247,16,
+247,66,247,82,247,12,247,29,247,57,247,49,247,25,251,14,251,37,33,77,40,73,
+114,126,156,170,145,140,146,140,144,31,205,247,152,5,68,6,68,104,21,168,137,
+154,115,137,100,137,94,122,78,118,97,8,97,117,109,114,109,27,103,116,172,
+192,193,157,190,173,177,31,167,172,173,159,164,137,8,14,34,10,14,247,63,155,
+22,247,214,6,247,61,247,4,214,247,5,185,120,179,104,170,31,104,169,105,154,
+69,154,8,247,8,173,182,180,215,26,242,47,196,251,60,30,251,201,114,6,206,
+136,158,124,141,86,8,252,120,7,137,87,124,126,68,133,8,247,140,247,210,21,
+169,6,242,189,85,251,2,42,98,89,58,95,122,156,183,31,248,140,4,175,153,152,
+179,209,171,96,45,34,106,111,251,15,136,30,14,46,29,14,70,29,14,247,63,32,
+10,14,247,7,155,249,31,21,206,136,159,124,140,86,247,4,29,247,252,164,7,50,
+142,120,151,137,195,8,247,125,7,241,137,176,102,153,251,8,8,164,247,230,114,
+6,251,6,121,104,104,39,27,247,124,7,177,152,148,190,231,199,122,104,169,30,
+161,114,150,112,153,76,8,163,247,93,252,203,6,14,247,174,43,29,14,247,174,
+249,139,109,10,190,160,156,247,38,10,157,124,141,104,29,14,32,40,10,14,143,
+248,115,249,56,21,251,244,114,6,218,138,159,124,106,10,165,178,130,179,27,
+247,33,213,215,247,35,247,17,10,14,247,174,50,29,14,247,63,42,29,14,248,84,
+250,45,164,21,63,148,129,149,137,212,8,248,78,7,141,213,153,153,211,143,8,
+164,251,144,7,251,92,252,108,251,92,248,108,5,251,145,114,6,211,134,156,125,
+87,26,252,111,7,138,78,126,127,62,132,8,114,247,126,164,7,58,144,120,159,
+138,213,8,248,106,7,247,144,252,230,5,166,6,247,144,248,245,5,252,145,7,137,
+82,126,127,65,133,8,114,247,224,7,14,41,10,14,247,174,35,29,14,247,7,155,
+66,29,14,247,174,249,110,251,9,21,129,105,126,137,119,27,92,94,157,173,105,
+31,120,158,129,154,121,176,220,165,174,159,182,185,8,200,204,172,225,236,
+26,247,100,251,40,247,41,251,98,251,97,251,41,251,44,251,100,47,170,56,197,
+75,30,180,93,171,119,215,111,160,95,151,120,162,116,8,83,195,223,107,227,
+27,200,183,148,165,213,31,251,238,249,179,21,247,4,203,251,12,251,101,251,
+97,78,251,2,251,8,251,8,78,247,1,247,100,247,102,203,247,9,247,6,31,14,40,
+29,14,199,39,29,14,247,63,50,10,14,33,29,14,249,81,249,56,21,251,105,114,
+6,209,135,155,131,107,26,123,136,127,122,96,30,251,19,251,221,251,30,247,
+226,5,120,185,135,150,154,26,162,154,150,177,141,30,144,152,140,140,154,31,
+164,251,228,114,7,189,132,148,131,164,84,247,148,252,235,24,166,6,247,120,
+248,223,163,201,153,152,191,146,25,14,248,140,36,29,14,249,68,249,56,21,251,
+142,114,6,203,134,147,134,112,26,118,128,119,92,74,30,127,123,119,111,115,
+106,42,247,42,24,126,159,137,144,151,26,160,151,147,175,141,30,144,151,140,
+140,153,31,164,251,238,114,7,175,136,152,129,170,94,247,90,251,183,24,251,
+67,251,113,109,102,115,126,89,133,25,114,247,142,164,7,78,145,119,149,165,
+26,160,158,170,214,240,30,177,190,240,251,54,5,151,120,148,116,127,26,122,
+122,130,104,137,30,135,128,138,138,126,31,114,247,232,164,7,105,140,124,152,
+91,211,251,74,247,175,24,219,247,3,227,247,12,165,158,213,146,25,14,38,10,
+14,247,63,48,29,14,251,55,247,193,249,58,21,251,126,253,207,247,126,172,59,
+6,97,140,130,149,140,181,8,249,18,7,140,199,147,148,197,140,8,202,6,14,251,
+110,247,103,120,21,231,6,251,127,249,90,5,46,6,14,251,55,171,251,41,21,247,
+126,249,207,251,126,106,202,6,196,138,148,130,140,79,8,253,18,7,140,96,131,
+130,96,138,8,59,6,14,224,247,54,247,203,21,247,21,247,164,247,21,251,164,
+5,228,6,251,70,248,1,5,59,6,251,70,252,1,5,14,143,248,135,251,35,21,208,252,
+133,70,7,14,251,55,247,128,97,10,14,143,32,29,14,199,156,249,32,21,184,131,
+148,130,140,98,8,252,243,151,7,218,195,5,97,185,175,124,189,27,247,25,232,
+242,247,42,247,31,62,234,251,3,90,104,123,99,101,31,247,151,251,86,7,247,
+86,251,208,21,182,157,158,155,172,27,201,170,73,251,24,251,31,109,75,75,97,
+112,170,187,31,14,87,47,29,14,199,248,170,65,10,14,87,34,29,14,251,55,153,
+22,247,170,163,6,89,10,72,87,115,95,112,30,190,29,14,143,37,10,14,199,248,
+170,163,21,104,140,125,157,180,26,160,29,247,173,184,29,252,146,106,29,143,
+146,149,134,10,14,251,110,43,10,159,29,251,55,247,152,248,97,21,251,94,115,
+6,188,136,152,127,140,95,8,252,110,7,86,124,116,106,108,10,64,249,69,21,96,
+105,105,96,93,171,107,184,183,173,173,182,182,104,174,96,31,14,199,54,29,
+14,251,110,56,29,14,247,229,249,194,163,21,101,140,126,154,140,180,8,247,
+143,7,225,86,194,57,82,100,116,75,88,30,202,109,104,163,76,27,75,94,112,79,
+101,31,214,251,83,115,7,181,134,151,247,12,10,95,132,8,115,247,132,163,7,
+105,143,127,153,178,26,247,159,7,145,155,157,152,150,30,155,160,155,146,157,
+27,178,154,116,79,31,251,134,7,140,100,126,124,103,136,8,115,247,126,163,
+7,105,142,126,155,177,26,247,159,7,144,155,158,152,149,30,156,161,155,146,
+157,27,177,154,115,80,31,251,134,7,140,99,126,124,102,137,8,115,247,130,7,
+14,199,39,10,14,143,38,29,14,199,120,10,80,103,116,81,108,31,208,251,83,115,
+7,183,133,149,128,97,26,252,137,120,29,251,16,112,80,81,106,110,162,177,124,
+31,14,199,248,172,251,73,21,94,147,130,148,138,180,8,248,231,124,7,61,83,
+5,183,88,108,152,89,27,251,22,47,34,251,41,251,29,215,43,247,1,187,173,155,
+179,180,31,251,31,7,138,76,131,130,75,128,8,114,247,159,7,251,86,247,195,
+21,102,129,114,118,105,27,77,108,204,247,23,247,28,171,208,202,179,166,107,
+91,31,14,87,44,10,14,32,37,29,14,251,55,86,10,14,199,33,10,14,143,248,121,
+243,10,127,136,125,131,120,30,67,251,74,60,247,95,5,131,159,138,143,146,26,
+154,149,146,164,141,30,142,146,140,140,147,31,247,18,10,8,142,185,39,99,155,
+31,247,12,251,188,5,165,6,247,52,248,32,158,183,147,147,170,142,25,14,36,
+10,14,143,248,120,163,21,123,144,132,143,132,150,251,40,247,120,24,240,247,
+18,158,162,159,150,170,144,25,163,251,60,115,7,187,134,142,138,121,26,124,
+129,122,111,107,30,133,133,124,120,124,118,118,167,126,157,135,145,8,118,
+171,127,161,147,26,152,152,145,173,140,30,163,251,142,115,7,165,134,145,135,
+159,109,247,20,251,89,24,110,102,112,106,130,125,111,100,111,108,120,127,
+130,133,128,136,121,137,8,115,247,61,163,7,102,141,126,146,154,26,155,165,
+180,177,185,30,142,142,145,147,146,148,157,111,153,118,149,125,154,117,24,
+149,124,147,120,131,26,127,126,133,107,137,30,115,247,133,7,14,143,35,10,
+14,87,45,29,14,37,247,232,251,55,21,62,153,111,172,138,215,8,247,63,7,138,
+223,115,166,46,158,231,157,164,167,140,223,8,247,63,7,140,215,167,172,216,
+154,8,151,7,251,50,88,105,251,0,137,31,251,71,7,138,67,116,114,56,120,223,
+119,161,115,140,67,8,251,71,7,140,33,192,103,247,49,140,8,14,251,168,205,
+251,142,21,227,250,122,51,6,14,37,193,251,67,21,247,50,190,173,247,0,141,
+31,247,71,7,140,211,161,163,223,159,55,158,117,163,138,212,8,247,71,7,246,
+137,87,173,251,49,27,127,7,216,125,167,106,140,63,8,251,63,7,140,55,164,111,
+231,121,8,47,121,113,110,56,26,251,63,7,138,63,111,106,62,124,8,14,163,248,
+72,247,212,21,107,114,120,126,115,27,121,120,145,159,95,31,171,69,107,149,
+107,27,86,100,113,81,107,162,29,172,161,201,183,31,14,251,55,247,60,248,137,
+21,90,102,103,92,91,177,101,186,185,177,177,185,187,103,176,92,31,124,251,
+139,21,126,251,16,129,91,110,43,8,125,94,135,121,114,26,75,170,102,192,193,
+170,176,202,164,135,158,125,184,30,110,235,129,188,126,247,15,8,14,143,248,
+65,248,224,21,99,6,95,251,15,5,145,115,124,141,118,27,251,25,40,32,251,35,
+68,161,79,181,96,31,157,121,152,129,172,123,88,251,37,24,179,6,186,247,25,
+5,134,158,151,137,158,27,178,176,149,158,173,31,166,154,159,158,173,181,121,
+157,24,98,105,111,124,96,27,105,117,149,166,112,31,221,247,122,5,125,151,
+152,133,158,27,179,165,164,177,177,120,166,95,163,31,251,48,251,216,21,117,
+186,130,179,198,26,242,172,204,190,164,157,121,115,30,136,7,14,143,248,20,
+248,9,21,251,6,6,120,224,119,247,3,161,26,177,161,164,173,168,155,122,110,
+138,30,137,95,5,101,137,165,112,177,27,181,165,166,184,209,81,182,46,89,94,
+126,116,108,31,91,104,110,79,75,26,109,142,114,150,78,30,59,74,237,6,143,
+128,169,54,144,119,141,104,25,144,119,126,141,121,27,70,102,107,79,85,171,
+108,195,184,173,158,182,172,31,90,194,166,125,182,27,179,171,156,170,160,
+31,160,170,149,178,146,218,8,116,6,84,124,116,123,76,27,112,114,145,155,95,
+31,155,186,143,163,188,26,159,138,154,138,158,30,247,1,6,251,95,251,114,21,
+90,125,118,119,102,27,105,117,158,169,171,161,159,173,165,158,131,115,166,
+31,14,251,221,247,165,139,29,14,143,248,86,247,184,21,189,251,3,7,247,36,
+247,163,152,163,156,149,173,142,25,165,251,97,113,7,203,136,153,131,107,26,
+127,136,127,134,128,30,251,11,251,122,124,168,124,170,125,167,126,163,25,
+109,197,5,102,212,130,161,153,26,160,156,146,199,140,30,165,251,193,113,7,
+180,136,162,125,158,103,247,22,251,147,24,40,89,247,16,6,150,118,5,82,251,
+27,89,247,27,90,7,137,69,122,125,56,133,8,114,247,223,164,7,58,145,123,153,
+137,209,8,188,247,27,189,251,27,206,7,143,150,5,14,143,213,248,30,21,247,
+8,6,126,252,42,5,71,137,113,94,102,27,127,129,146,148,142,141,142,144,145,
+31,147,149,142,146,150,26,168,117,159,108,106,117,116,105,91,175,109,196,
+245,210,227,247,57,168,30,147,186,141,162,152,247,118,8,247,14,185,251,14,
+229,6,236,161,188,181,151,150,132,131,137,137,135,136,134,30,131,127,134,
+126,127,26,114,163,118,168,170,162,165,174,186,99,170,77,85,95,117,96,106,
+30,104,94,120,84,122,38,8,251,12,6,14,143,247,174,171,21,167,116,148,123,
+108,26,91,113,116,86,103,107,153,154,143,143,143,150,146,30,162,153,147,150,
+156,26,169,109,165,104,103,112,111,102,84,206,94,222,235,207,193,214,193,
+111,180,65,191,30,193,140,167,146,161,157,8,162,158,153,170,175,26,170,132,
+167,126,161,30,109,190,89,188,73,182,8,70,185,104,178,173,26,180,173,167,
+189,166,165,129,128,135,134,132,129,131,30,121,125,130,124,125,26,111,170,
+110,168,173,170,170,172,192,72,185,61,52,77,85,63,91,157,113,221,67,30,93,
+116,135,127,118,31,105,120,121,102,89,26,72,165,106,247,34,251,7,30,100,247,
+206,21,169,181,112,76,205,31,172,108,149,120,112,26,105,117,115,108,109,118,
+151,193,77,30,79,191,130,153,177,26,171,161,162,171,30,14,143,113,247,11,
+21,197,81,235,237,5,113,181,175,128,183,27,183,175,150,165,181,31,235,41,
+197,197,41,237,5,165,176,150,175,186,26,185,129,172,112,182,30,237,237,81,
+195,43,43,5,164,99,104,149,92,27,93,103,129,114,99,31,43,235,81,83,237,41,
+5,113,99,128,103,93,26,92,150,105,165,100,30,247,70,247,145,21,210,195,80,
+63,68,81,79,70,68,83,198,213,214,195,197,210,31,14,251,110,247,52,248,40,
+21,173,247,38,149,190,212,29,141,132,143,120,144,117,8,14,143,247,90,97,10,
+247,151,161,221,10,189,186,110,171,95,168,10,14,143,247,65,247,137,107,10,
+144,135,144,134,143,136,141,138,25,160,10,247,102,157,69,10,251,55,247,93,
+247,137,69,10,251,55,247,24,77,10,14,199,248,172,163,21,104,140,125,155,179,
+26,248,28,7,57,131,73,134,116,93,10,65,83,121,103,102,30,99,99,124,93,137,
+49,8,247,0,10,129,128,93,134,8,115,247,135,133,29,243,7,165,138,147,132,113,
+26,251,194,7,140,101,126,124,104,135,8,115,247,127,7,14,199,248,172,163,21,
+166,29,73,87,119,101,105,31,107,103,126,93,136,49,8,247,0,10,129,128,93,134,
+8,115,247,135,133,29,247,30,251,228,7,104,128,122,111,135,30,131,138,5,115,
+247,127,7,251,80,248,97,21,124,10,143,247,163,4,49,248,136,229,7,14,143,247,
+153,251,26,21,144,247,36,141,224,161,246,166,201,25,140,141,139,140,140,26,
+141,137,142,136,143,30,105,182,119,204,141,200,177,137,147,137,179,119,8,
+125,165,153,135,155,27,170,158,159,171,172,120,160,107,124,128,135,127,113,
+31,100,121,123,134,105,134,8,192,143,153,163,186,30,153,167,143,151,155,26,
+174,119,159,103,104,117,116,102,124,142,131,151,118,30,162,98,143,123,141,
+75,103,143,127,142,101,159,8,152,114,127,143,123,27,106,120,120,105,106,159,
+118,169,156,150,142,152,163,31,176,159,149,142,181,143,137,56,131,113,108,
+96,8,131,128,134,130,135,26,135,141,133,142,132,30,165,72,157,45,141,57,144,
+251,36,24,14,143,247,113,248,101,21,118,140,128,143,106,155,8,152,111,121,
+145,123,27,110,119,119,109,110,160,119,168,153,153,143,151,164,31,182,158,
+148,142,178,141,137,73,128,106,97,71,180,71,151,102,141,76,104,141,129,142,
+96,158,8,151,111,125,144,124,27,111,118,118,111,109,159,119,169,154,157,144,
+153,167,31,167,153,167,148,148,137,8,157,6,138,85,135,124,117,90,8,127,112,
+136,128,124,26,106,160,118,171,171,163,162,171,154,135,151,127,167,30,116,
+190,135,157,138,186,176,136,152,135,181,121,8,127,164,153,135,151,27,170,
+159,158,168,170,121,157,109,122,126,135,126,111,31,121,98,126,135,105,27,
+140,202,153,186,171,185,8,144,144,141,144,141,26,141,137,144,134,144,30,110,
+177,121,198,197,26,176,138,153,136,181,119,8,127,164,150,136,154,27,170,158,
+158,169,169,119,158,109,126,125,135,127,114,31,96,121,127,135,102,136,140,
+185,143,158,162,191,8,151,167,143,152,153,26,171,115,162,107,107,118,117,
+107,124,142,128,151,112,30,161,89,143,123,140,85,8,14,251,138,96,29,183,247,
+185,249,31,21,189,253,217,247,63,164,6,68,146,135,142,138,181,138,149,24,
+177,7,248,248,7,177,7,140,149,5,178,145,144,188,145,30,143,150,140,140,150,
+31,164,251,192,7,251,43,71,78,251,26,50,171,74,199,104,31,169,121,165,132,
+190,137,8,251,218,7,101,7,138,129,5,98,133,135,65,132,30,114,247,67,7,45,
+248,112,21,64,166,105,200,244,26,188,148,179,155,165,30,156,168,159,151,186,
+151,8,14,251,38,247,68,248,114,21,62,75,76,63,59,200,78,219,217,200,200,217,
+218,77,201,62,31,14,251,55,236,93,29,143,247,194,96,10,251,151,117,103,29,
+14,143,247,194,97,29,251,151,117,102,10,14,143,247,23,77,10,247,74,121,169,
+10,154,30,142,140,141,141,141,141,247,95,247,56,24,128,29,14,248,140,247,
+58,247,48,21,92,10,247,225,22,92,10,247,225,22,247,50,10,248,140,248,208,
+249,86,21,91,6,75,88,90,112,73,27,103,120,146,162,111,31,160,113,120,147,
+113,27,34,47,39,251,5,57,191,82,213,175,176,155,167,167,31,180,180,168,217,
+207,26,152,138,150,137,159,30,129,164,153,136,160,27,180,171,151,169,179,
+31,252,24,253,35,5,187,6,211,249,43,21,144,143,137,132,149,31,150,132,142,
+138,146,136,8,165,129,145,129,105,26,32,78,38,75,106,122,163,183,228,201,
+247,20,180,136,30,249,66,251,193,21,33,49,41,251,6,54,189,85,216,177,175,
+154,166,165,31,183,185,167,212,209,26,214,100,184,75,30,158,106,21,173,164,
+104,93,88,118,72,110,97,31,105,116,114,124,110,27,107,122,162,183,191,165,
+222,171,185,31,168,158,158,152,160,27,252,17,172,21,36,46,39,251,1,53,189,
+83,216,178,174,154,166,165,31,184,186,167,212,209,26,213,100,184,74,30,159,
+106,21,173,164,105,93,87,118,72,110,97,31,106,116,114,123,110,27,105,123,
+162,185,190,166,220,170,185,31,168,159,158,153,160,27,14,143,247,139,247,
+149,21,66,131,125,76,100,30,47,83,110,98,70,26,39,218,73,247,13,247,2,217,
+199,223,183,110,171,99,102,114,113,101,119,144,127,156,120,30,151,126,142,
+133,129,26,115,115,123,103,85,108,186,222,192,149,172,172,202,30,163,185,
+147,162,167,26,146,139,151,138,152,30,138,153,5,124,247,136,21,91,102,103,
+91,92,177,101,185,185,178,178,184,187,102,176,92,31,14,251,55,247,138,248,
+164,45,10,251,55,225,145,10,251,55,247,170,248,164,41,29,251,55,165,248,185,
+80,10,251,55,247,223,249,17,82,10,251,55,247,166,95,10,251,55,247,57,249,
+47,73,10,251,55,200,249,47,42,10,251,55,247,59,249,130,52,10,251,55,247,8,
+43,21,89,29,167,203,5,97,6,14,251,55,126,152,10,202,251,49,90,10,251,55,247,
+50,171,21,134,133,138,137,131,129,8,98,89,126,113,109,131,29,181,154,142,
+157,148,170,31,142,149,140,142,140,146,8,14,251,55,247,227,249,84,48,10,248,
+140,247,42,10,248,140,224,10,87,105,104,8,98,99,80,119,247,36,10,247,4,132,
+164,113,157,182,29,163,153,145,195,229,199,122,104,167,30,160,113,149,114,
+152,76,220,10,130,119,120,107,30,138,136,136,134,136,134,94,29,124,66,135,
+230,10,14,251,88,247,183,248,79,21,133,133,5,137,137,138,139,136,27,131,136,
+143,150,31,247,48,7,190,90,170,61,60,89,110,93,114,154,124,166,167,159,153,
+160,146,136,145,131,147,30,132,145,137,144,142,26,151,157,149,162,175,153,
+124,102,30,99,7,251,27,104,100,114,89,26,100,169,112,183,177,168,151,168,
+174,30,109,146,153,128,171,27,168,159,148,164,163,31,251,21,173,21,121,126,
+125,131,123,27,120,126,156,162,173,164,163,189,154,31,14,247,63,153,29,247,
+186,7,247,15,215,5,200,7,251,15,63,5,247,9,178,29,251,125,7,58,90,5,78,7,
+220,188,5,251,82,247,3,10,14,247,174,95,29,104,202,191,125,211,27,247,99,
+144,10,182,213,26,247,104,122,29,14,248,140,250,105,247,103,21,112,6,106,
+69,118,109,103,111,8,105,97,90,125,65,27,81,125,149,177,31,247,142,7,245,
+133,169,107,154,251,11,8,162,247,230,116,6,113,251,19,120,120,33,137,8,247,
+141,7,159,152,145,181,212,197,128,121,169,30,180,113,155,107,153,60,8,165,
+247,93,252,48,6,137,6,138,6,91,142,120,140,5,142,85,117,140,121,27,251,95,
+251,31,251,34,251,100,251,4,181,41,212,79,31,94,194,216,115,229,27,153,154,
+140,140,153,31,141,157,181,140,186,27,248,66,6,252,103,247,104,21,39,135,
+106,122,118,30,117,122,115,130,95,27,72,99,160,187,112,31,115,181,123,230,
+230,26,247,112,201,247,4,247,15,175,166,129,119,152,30,154,118,143,113,67,
+26,14,251,58,247,57,249,68,21,54,77,77,55,56,201,77,222,226,201,199,225,222,
+76,201,55,31,118,4,176,151,108,39,50,127,109,101,103,126,171,228,237,151,
+170,177,31,14,249,52,247,20,21,91,101,103,120,90,27,58,136,10,101,101,203,
+29,148,126,154,31,130,149,136,144,146,26,159,166,154,177,195,161,116,81,30,
+59,7,251,21,97,95,122,105,116,8,101,112,121,106,95,26,68,180,102,216,205,
+197,166,195,195,30,145,145,5,77,177,178,117,209,179,10,186,202,170,172,227,
+171,31,247,30,176,21,247,9,157,180,190,187,155,108,45,30,106,7,14,251,110,
+43,10,14,251,110,247,98,81,10,143,247,23,10,103,110,146,101,27,251,22,181,
+10,175,170,131,179,27,247,22,234,242,247,32,221,113,199,77,194,31,251,107,
+251,178,21,138,159,139,161,167,26,247,72,162,10,104,119,157,184,126,30,14,
+249,56,247,17,21,87,93,113,124,93,27,61,103,192,247,6,31,142,7,156,247,141,
+7,135,208,132,172,120,175,8,198,108,83,170,65,27,89,109,128,101,90,31,174,
+104,103,153,85,27,251,24,45,37,251,34,251,36,230,40,247,24,197,179,153,173,
+179,31,105,169,172,125,191,27,223,188,169,232,204,31,251,144,247,65,21,193,
+7,210,162,176,181,179,156,108,64,142,30,131,140,117,140,113,30,251,155,251,
+25,21,47,119,98,93,83,120,196,247,67,247,42,156,185,194,189,158,102,43,30,
+14,199,158,22,247,82,248,222,6,189,160,166,178,188,160,100,45,40,126,116,
+82,138,30,105,7,172,137,155,134,154,127,8,165,117,151,89,52,26,251,25,125,
+100,92,130,135,140,145,130,30,129,146,125,105,5,128,169,155,135,157,27,244,
+223,230,247,7,192,122,183,106,170,31,107,170,105,156,58,162,188,150,161,148,
+165,157,8,177,165,160,177,181,26,228,54,204,251,6,251,13,53,62,32,30,252,
+56,7,138,92,131,129,97,133,8,14,251,88,247,165,247,187,107,29,14,213,248,
+85,247,0,21,227,247,183,252,140,51,248,52,6,14,199,248,111,248,97,21,251,
+31,251,251,6,121,111,114,130,118,27,105,116,169,183,31,247,204,251,31,252,
+9,7,84,133,97,122,76,30,132,110,136,124,126,26,90,163,111,180,180,161,166,
+188,157,135,158,129,173,30,126,180,137,146,135,172,8,114,172,167,129,180,
+27,181,164,152,178,171,31,103,161,169,123,188,27,181,159,148,179,183,31,163,
+7,134,130,134,138,132,27,117,121,160,165,31,14,248,140,247,143,249,32,21,
+185,6,174,160,118,96,149,31,162,227,251,254,51,162,6,182,149,160,160,173,
+27,185,251,201,6,96,138,138,90,135,30,247,26,10,248,53,67,21,152,6,247,41,
+247,190,5,251,118,7,109,137,133,133,135,30,131,134,135,139,109,136,8,247,
+26,10,247,154,7,176,149,147,183,142,30,162,251,10,7,251,43,251,181,251,34,
+247,181,5,251,31,116,6,169,138,164,121,154,106,8,251,129,7,84,131,128,95,
+136,30,116,247,25,162,7,95,142,131,150,194,26,247,95,7,14,58,10,247,146,248,
+209,139,29,252,27,100,10,248,173,251,40,21,123,6,121,96,132,136,71,138,8,
+53,144,6,232,226,5,193,190,159,174,184,26,203,89,185,70,213,29,106,96,237,
+29,213,247,133,247,251,21,251,100,51,247,100,251,35,227,247,35,247,100,227,
+251,100,247,101,51,6,251,100,252,204,21,248,140,227,252,140,6,14,247,7,155,
+247,5,29,195,7,247,51,140,175,145,194,172,8,197,173,169,191,204,26,247,12,
+46,201,251,71,30,73,151,6,141,213,147,148,217,149,8,164,251,226,114,7,154,
+29,248,87,21,162,156,151,173,221,172,95,251,0,76,127,101,113,117,30,118,115,
+106,132,68,27,14,247,146,249,82,247,45,115,10,145,247,252,240,29,252,34,100,
+10,14,213,247,35,29,247,144,247,220,21,99,103,103,99,97,174,104,181,179,175,
+176,179,179,103,175,98,31,252,51,4,98,104,104,99,97,174,103,181,178,176,176,
+180,179,103,174,98,31,14,251,168,205,120,21,227,247,169,51,6,247,48,4,227,
+247,169,51,6,14,43,247,92,249,68,21,59,76,76,59,60,202,75,217,221,202,201,
+220,219,76,202,59,31,103,4,194,186,90,81,80,93,91,82,84,93,188,197,198,185,
+187,195,31,14,199,120,10,79,104,116,80,110,31,247,177,251,86,115,7,184,131,
+148,130,140,98,8,253,97,120,29,251,14,111,78,84,105,113,159,180,120,31,14,
+247,146,248,249,139,29,252,249,41,85,10,247,0,225,208,226,188,113,175,89,
+159,30,143,7,176,159,152,158,174,247,16,10,249,36,252,80,115,10,14,251,88,
+247,192,248,38,21,123,6,96,121,131,135,72,27,47,6,238,231,5,193,189,159,175,
+183,26,204,90,185,69,213,29,105,97,237,29,247,143,247,99,248,150,21,184,137,
+140,138,98,26,251,147,7,99,138,138,94,136,30,121,247,64,157,7,94,142,138,
+140,179,26,244,176,7,160,105,149,123,157,103,8,76,172,153,121,155,27,220,
+150,6,118,159,119,164,110,179,81,221,24,193,161,165,173,188,26,198,95,176,
+68,30,251,85,6,247,18,117,21,175,6,180,159,113,86,82,117,107,99,31,104,6,
+180,247,241,73,29,213,247,35,29,14,143,247,148,248,210,21,180,99,165,97,158,
+82,137,136,24,169,113,116,150,97,27,251,19,42,34,251,31,251,32,235,36,247,
+22,247,34,222,247,5,247,86,207,129,198,118,190,31,115,200,114,171,78,189,
+231,186,24,90,169,49,93,89,165,90,153,78,145,25,93,114,189,130,179,121,182,
+108,25,251,9,80,187,108,5,245,63,21,196,159,85,251,48,251,55,120,87,81,113,
+120,150,161,126,31,123,169,133,185,235,26,244,146,190,156,170,30,161,151,
+157,150,165,27,14,213,247,115,247,145,21,251,67,251,67,201,77,247,67,247,
+68,247,67,251,68,201,201,251,68,247,67,247,68,247,67,77,201,251,67,251,68,
+251,67,247,68,77,77,5,14,251,88,175,248,226,85,10,247,1,224,208,226,190,113,
+173,85,161,30,180,161,152,157,175,247,16,10,14,247,143,248,161,247,148,21,
+74,107,103,113,83,27,60,95,203,247,7,247,6,183,202,218,196,172,112,77,156,
+31,158,211,6,149,133,144,123,145,30,153,100,112,144,102,27,251,30,51,59,251,
+17,251,13,222,63,247,23,169,167,143,149,176,31,144,141,146,140,139,26,158,
+143,151,148,149,26,155,213,5,251,62,248,71,73,29,34,10,251,14,248,138,195,
+29,247,43,10,34,10,210,248,138,41,29,34,10,251,39,249,21,80,29,167,175,229,
+29,34,10,189,248,138,45,10,104,10,153,178,240,30,165,29,247,216,7,125,10,
+97,249,92,21,81,90,90,83,78,186,92,198,199,186,186,198,197,91,188,247,28,
+29,111,107,108,112,113,107,107,113,165,171,171,166,166,170,31,14,34,10,251,
+66,248,159,21,167,143,159,158,165,27,152,147,136,120,181,31,168,126,5,131,
+158,165,133,158,27,197,175,178,227,162,31,96,6,103,127,125,126,112,27,127,
+173,29,248,37,120,21,247,9,140,214,177,233,246,109,164,24,71,10,251,98,251,
+80,247,17,251,34,247,74,121,31,142,138,104,60,150,131,5,142,150,147,140,148,
+105,10,247,63,32,10,247,123,201,155,10,247,63,32,10,248,59,201,21,196,6,251,
+16,247,68,5,48,247,29,29,237,5,14,247,63,32,10,247,98,247,93,53,29,247,63,
+32,10,248,27,201,45,10,32,40,10,251,148,145,29,32,40,10,75,249,118,41,29,
+32,40,10,251,173,250,1,53,29,32,40,10,37,249,118,45,10,41,10,247,90,249,114,
+113,10,127,136,140,150,115,31,99,157,5,152,110,116,145,118,27,77,247,43,29,
+247,174,35,29,49,219,90,10,247,174,35,29,241,219,41,29,247,174,35,29,251,
+7,247,111,53,29,247,174,35,29,209,219,45,10,247,174,35,29,251,42,240,113,
+10,128,135,140,150,115,31,99,157,5,152,111,115,145,118,27,77,247,43,29,199,
+39,29,130,248,75,48,10,33,29,252,28,226,146,29,171,241,29,122,30,14,33,29,
+251,92,226,41,29,33,29,252,60,247,57,29,167,175,229,29,33,29,251,147,226,
+45,10,38,10,252,22,226,109,29,122,30,14,38,10,252,51,247,118,53,29,247,63,
+48,29,34,250,38,48,10,143,32,29,251,31,247,175,117,29,165,120,157,110,119,
+123,247,44,29,143,32,29,208,247,175,41,29,143,32,29,251,46,248,58,42,10,143,
+32,29,175,247,175,137,29,143,32,29,86,248,141,52,10,143,32,29,251,75,247,
+196,81,29,87,247,157,126,21,208,149,188,170,186,202,87,10,251,24,217,46,247,
+11,128,31,102,56,150,131,5,142,150,146,140,149,105,10,87,34,29,251,31,247,
+138,91,29,87,34,29,189,247,138,41,29,87,34,29,251,66,248,21,42,10,87,34,29,
+153,247,138,45,10,251,110,43,10,251,95,145,10,251,110,43,10,128,248,164,41,
+29,251,110,43,10,251,120,249,47,21,106,109,109,105,103,168,109,173,127,10,
+251,110,43,10,96,248,164,45,10,199,39,10,252,37,248,185,170,29,196,175,179,
+226,163,124,29,143,38,29,57,225,155,10,143,38,29,247,2,225,41,29,143,38,29,
+32,247,117,42,10,143,38,29,216,225,137,29,143,38,29,251,34,246,81,29,32,37,
+29,187,248,14,48,10,199,33,10,251,244,248,144,91,29,199,33,10,251,43,248,
+144,41,29,199,33,10,252,14,249,27,42,10,199,33,10,251,71,248,144,45,10,143,
+35,10,251,202,230,91,10,143,35,10,251,212,247,122,42,10,87,45,29,136,249,
+84,48,10,59,247,249,247,188,21,116,140,133,145,162,26,247,40,7,192,106,173,
+89,106,115,126,109,115,30,175,251,11,119,7,166,135,142,135,140,115,8,251,
+66,7,138,115,136,135,112,134,8,119,247,41,159,7,117,142,132,146,160,26,247,
+50,7,140,7,144,144,5,156,152,153,147,154,27,157,148,124,108,31,251,35,7,138,
+117,133,132,119,137,8,119,247,37,7,14,247,28,247,129,248,53,21,242,251,225,
+6,138,95,130,127,102,135,8,115,247,160,163,7,89,10,88,97,125,113,109,30,164,
+115,95,154,89,27,71,87,115,95,112,31,190,29,115,247,135,163,7,99,141,133,
+150,138,205,8,247,250,4,165,10,112,158,118,168,133,30,138,122,138,123,103,
+26,14,247,252,166,83,29,243,7,165,138,147,132,113,26,251,194,7,140,101,126,
+124,104,135,8,115,247,127,163,7,104,140,125,154,180,26,248,28,7,57,131,72,
+134,117,93,10,50,80,115,86,101,30,187,124,87,168,66,86,29,123,138,127,137,
+94,8,14,247,252,165,83,29,247,30,251,228,7,104,128,122,111,135,30,131,138,
+5,115,247,127,163,7,166,29,64,85,115,90,105,31,187,119,91,164,68,86,29,118,
+138,126,137,100,8,247,169,22,124,10,247,146,247,87,249,71,21,124,6,251,38,
+72,148,119,5,149,156,148,142,148,27,155,146,127,113,31,251,143,7,140,106,
+132,130,109,137,8,115,120,247,99,158,122,6,110,141,131,148,140,172,8,53,251,
+220,247,32,10,243,164,29,86,108,122,247,25,10,183,123,169,90,183,30,108,163,
+21,92,174,121,164,171,26,164,158,160,161,164,155,113,98,114,133,115,128,117,
+30,87,65,21,184,103,158,108,244,29,159,167,30,14,247,146,180,248,218,21,173,
+156,157,151,169,27,174,162,114,100,99,110,111,92,134,31,120,7,209,121,177,
+99,83,26,100,118,113,108,122,120,148,155,122,30,159,117,131,143,123,27,122,
+125,125,121,108,173,119,192,236,206,201,228,188,117,177,98,160,31,169,161,
+153,165,173,26,191,100,175,83,107,106,127,119,117,30,120,122,130,124,127,
+102,8,224,252,223,247,32,10,244,164,29,87,109,121,112,214,29,107,163,21,92,
+174,121,164,170,26,165,157,160,162,165,155,113,97,115,133,115,127,117,30,
+87,158,10,247,146,226,248,236,21,247,38,6,172,221,5,251,76,6,69,251,102,203,
+138,168,135,165,128,25,186,120,164,107,98,26,103,118,112,110,123,124,146,
+161,103,30,151,120,131,142,128,27,119,124,125,120,108,178,117,194,227,204,
+204,228,230,67,198,251,5,140,31,173,252,200,21,213,10,166,178,26,194,91,179,
+74,70,87,94,79,98,157,106,182,102,30,86,108,122,247,47,10,168,90,183,30,107,
+163,21,93,174,121,164,170,26,165,158,160,161,164,155,113,98,114,133,114,127,
+118,30,87,65,21,185,104,158,107,244,29,158,167,30,14,247,146,247,84,248,234,
+21,41,251,232,5,191,6,247,16,248,60,5,251,124,6,111,251,18,5,159,6,170,149,
+160,150,187,27,252,234,4,213,10,241,10,106,182,103,30,87,108,121,113,214,
+29,108,163,21,90,175,122,163,171,26,164,158,160,161,165,155,114,97,113,133,
+115,128,118,30,86,158,10,251,88,247,42,249,68,21,61,80,49,251,11,251,16,196,
+51,219,217,197,228,247,14,247,11,80,230,62,31,175,251,171,21,57,128,102,114,
+112,129,173,224,30,247,27,7,226,149,173,165,165,150,103,54,30,14,251,88,247,
+141,248,68,21,247,148,87,7,103,92,52,251,7,111,100,103,83,25,68,247,39,54,
+231,224,176,211,7,251,20,22,251,6,6,247,6,247,53,5,14,251,88,232,248,235,
+21,247,56,6,166,221,5,251,89,6,80,251,102,151,138,192,135,158,136,165,131,
+25,189,123,170,106,102,26,107,115,115,108,126,123,146,156,116,30,158,113,
+121,147,123,27,116,122,123,116,106,175,117,193,238,210,200,224,202,100,187,
+74,158,31,116,145,121,142,94,142,8,14,251,88,247,175,249,68,21,66,128,118,
+133,101,120,8,52,94,91,64,46,26,35,194,71,224,214,194,199,221,213,94,186,
+69,122,131,138,132,121,30,161,221,187,184,224,156,8,251,55,251,67,21,144,
+145,144,140,148,27,176,152,108,49,69,133,123,113,106,128,175,242,169,141,
+157,143,153,31,14,251,88,247,180,249,61,21,251,145,6,112,251,30,5,160,6,150,
+176,153,153,170,138,8,247,9,6,251,10,251,210,5,202,6,14,251,88,239,248,106,
+21,81,119,113,108,91,26,77,191,97,216,223,195,188,211,190,114,177,79,178,
+30,191,158,163,165,177,26,193,93,174,66,58,85,96,75,95,163,105,193,106,30,
+217,201,21,93,162,112,171,171,26,164,159,159,165,169,157,114,95,113,134,125,
+123,116,30,83,61,21,200,99,152,120,97,26,102,121,116,109,105,119,169,189,
+170,145,157,161,171,30,14,251,88,156,247,159,21,220,151,164,147,181,164,8,
+216,185,181,211,225,26,243,84,207,54,64,84,79,57,67,184,90,204,159,154,141,
+145,153,30,114,55,92,95,55,123,8,247,55,247,66,21,135,132,132,138,130,27,
+105,126,172,228,208,145,155,165,169,152,104,58,124,138,111,137,120,31,138,
+132,139,133,137,26,134,139,138,138,136,30,14,248,29,248,6,160,21,120,6,86,
+141,124,157,141,196,8,248,114,7,137,199,154,157,192,142,8,158,159,251,208,
+119,158,6,192,136,154,121,137,79,8,252,114,7,141,82,124,121,86,137,8,120,
+118,247,208,6,247,24,249,37,21,172,6,192,136,154,121,137,78,8,252,81,7,70,
+118,108,94,109,117,152,156,144,140,143,141,141,30,159,167,142,146,159,26,
+175,107,171,102,101,108,102,94,67,216,82,237,210,206,169,188,175,30,163,172,
+146,168,211,26,248,15,7,137,199,154,158,192,142,8,155,159,251,223,6,14,34,
+10,208,249,45,21,75,121,110,116,121,10,145,190,8,14,72,29,247,163,7,105,93,
+130,110,29,125,10,14,46,29,252,2,248,247,109,29,122,30,14,46,29,251,10,249,
+167,176,10,247,133,248,38,250,0,21,100,107,108,101,100,170,108,178,177,170,
+170,178,176,108,171,102,31,247,147,253,104,63,10,14,70,29,247,163,249,201,
+48,10,58,10,247,63,32,10,248,122,247,130,48,10,247,63,32,10,247,208,247,93,
+73,10,247,63,248,90,248,148,21,126,10,114,6,198,10,248,171,7,105,93,130,121,
+111,148,29,101,114,161,174,150,139,139,154,208,31,173,247,67,119,10,6,14,
+247,174,43,29,251,150,249,19,21,75,121,110,116,247,52,29,193,27,194,236,10,
+247,190,248,39,250,4,194,29,247,243,252,229,55,10,14,32,40,10,251,69,250,
+1,73,10,247,63,42,29,251,236,249,118,194,10,123,247,44,29,247,63,42,29,251,
+42,248,26,21,243,54,10,148,147,130,129,104,109,102,71,91,31,14,41,10,247,
+157,249,93,53,10,41,10,248,150,250,13,48,10,247,174,35,29,251,74,219,99,29,
+202,251,49,21,195,6,247,33,227,5,173,222,10,14,40,29,144,248,29,53,10,40,
+29,247,146,248,205,48,10,199,39,29,251,150,247,155,53,10,199,248,120,249,
+72,21,109,6,74,29,151,136,132,160,31,182,124,167,133,175,137,105,61,24,92,
+29,122,128,142,148,113,31,138,137,140,140,137,31,123,102,5,126,175,166,134,
+172,159,10,127,31,159,185,190,142,180,150,173,158,25,202,175,178,207,212,
+26,214,94,214,74,171,30,140,29,167,6,14,247,63,50,10,128,250,38,48,10,33,
+29,251,231,247,201,52,10,33,29,252,155,226,99,29,202,251,49,21,194,6,247,
+35,199,29,14,247,63,48,29,251,247,145,29,247,63,48,29,251,168,250,1,73,10,
+34,10,247,34,248,247,82,10,247,63,50,10,251,138,251,233,21,243,54,10,149,
+146,247,41,29,247,133,249,37,247,44,63,10,251,11,248,247,21,251,15,232,10,
+238,247,4,40,5,14,248,140,36,29,251,251,226,41,29,248,140,36,29,252,212,247,
+118,42,10,38,10,251,111,226,41,29,247,174,245,248,113,21,252,17,209,10,153,
+138,189,8,247,122,247,133,251,122,7,138,89,121,125,68,132,8,114,247,231,164,
+7,70,147,122,152,138,189,8,248,17,223,179,55,202,7,140,190,160,156,204,142,
+8,164,251,231,114,7,206,136,161,123,140,87,8,76,251,133,202,7,140,191,160,
+155,207,142,8,164,251,229,114,7,204,135,158,123,140,88,8,76,50,99,7,247,143,
+22,247,133,35,251,133,6,14,247,63,32,10,248,118,247,63,82,10,247,190,249,
+135,247,179,55,10,251,137,248,112,41,29,247,190,249,140,109,10,191,160,155,
+247,38,10,158,124,140,104,29,251,147,249,118,41,29,32,40,10,128,249,227,82,
+10,32,98,10,247,191,7,104,93,131,127,29,181,157,142,150,146,150,31,14,153,
+248,116,249,56,21,251,244,114,6,218,137,159,125,106,10,164,179,130,179,27,
+247,33,213,214,247,36,247,17,10,73,243,41,29,247,174,50,29,252,83,251,233,
+21,244,247,56,10,103,109,102,71,92,31,14,247,63,42,29,251,222,251,233,21,
+243,218,29,93,110,110,94,96,165,111,180,142,144,139,140,144,30,140,142,142,
+139,140,27,149,146,131,128,103,108,102,72,92,31,14,41,10,247,170,252,2,21,
+244,218,29,93,110,110,95,95,223,10,149,146,131,128,103,109,103,71,91,31,14,
+247,174,35,29,247,54,247,81,82,10,40,29,157,253,66,21,244,54,10,149,146,247,
+41,29,211,248,38,249,118,21,196,6,251,15,247,68,5,47,6,251,13,251,68,5,195,
+6,247,3,237,5,247,86,251,253,21,247,109,109,7,112,131,133,132,120,27,130,
+128,142,146,118,31,156,94,106,161,29,87,26,69,136,29,150,136,132,161,31,122,
+188,176,132,183,27,247,40,239,224,247,18,214,93,214,75,171,31,229,10,185,
+180,120,102,175,30,173,104,154,110,160,74,8,14,247,174,43,29,252,69,252,239,
+21,243,218,29,94,110,110,94,96,165,111,179,143,144,139,140,144,30,140,141,
+142,139,140,27,149,146,131,128,103,109,102,72,92,31,14,33,29,251,67,247,88,
+82,10,249,81,111,10,251,11,36,108,29,213,27,197,190,151,165,186,31,93,81,
+128,117,108,26,92,183,105,201,189,186,168,185,165,30,117,153,134,137,138,
+138,130,135,25,129,119,129,136,124,27,95,119,162,191,158,149,178,148,156,
+31,180,210,152,185,141,223,8,247,35,10,14,247,63,32,10,248,56,247,117,101,
+10,32,40,10,71,250,25,21,76,123,109,115,77,27,76,107,165,200,128,31,94,6,
+142,247,28,10,223,29,144,190,8,14,212,247,132,248,97,21,251,71,118,145,6,
+169,156,118,101,137,31,251,192,7,102,141,122,117,109,27,133,118,247,123,160,
+132,6,109,122,161,176,141,31,68,248,229,21,99,108,108,101,99,170,108,178,
+177,170,170,178,177,108,171,102,31,247,213,251,105,21,251,75,118,149,6,169,
+156,117,102,137,31,251,239,7,110,7,141,108,5,142,82,139,136,131,26,112,132,
+122,127,132,135,147,150,143,139,143,140,143,30,140,148,140,145,141,26,170,
+116,164,110,109,113,111,106,91,184,109,209,228,193,192,228,30,61,249,85,21,
+98,107,107,99,99,171,106,179,179,171,172,179,178,107,172,100,31,14,251,110,
+138,22,247,164,163,6,71,140,128,150,138,204,8,248,106,7,193,153,161,174,156,
+150,132,128,134,137,247,30,10,108,164,116,172,176,163,164,175,197,82,179,
+57,73,88,115,97,112,30,118,104,132,100,54,26,83,96,195,251,219,6,138,96,128,
+128,95,135,8,14,143,32,29,204,248,82,101,29,143,67,29,145,112,144,127,151,
+127,8,103,91,129,118,111,171,29,128,136,125,27,103,110,159,163,158,154,157,
+159,146,31,197,157,144,141,175,178,8,111,29,14,87,47,29,251,140,248,73,91,
+10,87,47,29,129,248,249,176,10,87,47,29,251,71,248,212,73,10,247,107,248,
+171,65,10,247,94,174,21,243,247,56,10,104,109,102,71,91,31,14,199,247,228,
+248,181,21,251,26,114,10,162,7,94,142,125,152,181,26,248,80,198,183,80,226,
+247,22,29,134,47,95,7,231,252,69,130,29,14,87,34,29,232,248,58,48,10,87,34,
+29,62,248,21,73,10,87,248,57,247,137,21,185,10,251,37,221,42,247,14,143,146,
+139,140,147,31,113,102,132,122,114,171,29,129,136,123,27,97,118,162,183,158,
+144,148,158,152,31,184,171,161,161,175,192,115,153,24,188,10,134,176,202,
+10,14,143,37,10,247,10,247,141,101,29,153,247,148,249,43,21,106,112,113,106,
+106,165,113,172,172,165,165,172,171,113,166,107,31,247,119,251,157,21,192,
+251,22,7,156,96,111,144,99,27,251,12,247,20,10,159,126,185,227,29,130,106,
+114,143,29,159,152,155,162,150,30,144,151,139,139,204,27,185,165,145,159,
+173,31,184,165,162,179,193,26,179,127,169,111,167,30,251,53,183,21,186,158,
+101,46,46,120,103,92,91,121,174,233,233,157,176,187,31,223,252,130,21,193,
+165,123,105,92,85,114,39,247,36,29,14,251,110,56,29,251,88,249,118,53,10,
+68,56,29,146,248,26,21,243,247,56,10,104,109,103,71,90,31,14,199,39,10,251,
+233,248,164,53,10,199,39,10,47,249,84,48,10,143,38,29,251,73,225,109,29,123,
+30,202,251,49,109,29,122,30,14,87,44,10,251,45,248,164,91,10,32,37,29,251,
+93,247,94,90,10,32,37,29,130,247,94,41,29,32,37,29,251,79,253,47,21,243,54,
+10,149,146,247,41,29,107,247,231,248,97,21,251,19,103,10,214,7,128,131,149,
+120,5,244,199,183,196,218,151,10,148,147,131,128,121,128,115,123,121,31,14,
+199,33,10,251,150,249,110,52,10,199,33,10,252,74,248,144,109,29,123,30,202,
+251,49,155,10,87,45,29,251,154,248,164,91,10,87,45,29,251,75,249,47,73,10,
+199,208,248,180,21,252,96,230,29,144,126,154,176,26,247,159,7,143,146,149,
+149,149,30,161,160,164,175,29,163,7,104,140,125,157,180,26,160,29,247,41,
+247,18,179,251,18,231,184,29,129,86,99,7,14,251,55,86,10,251,97,253,138,21,
+243,54,10,149,146,247,41,29,36,10,251,105,230,41,29,36,10,252,73,247,122,
+21,106,109,109,105,103,167,109,174,175,167,167,175,175,110,169,104,31,247,
+100,22,107,110,109,105,102,166,110,174,175,168,167,175,175,109,169,103,31,
+14,143,32,29,247,14,248,28,82,10,143,35,10,251,4,230,41,29,96,248,47,247,
+1,21,97,102,113,125,98,27,52,84,225,247,29,242,171,202,191,155,153,131,128,
+146,31,144,129,139,139,98,231,10,52,251,29,39,33,251,36,251,31,228,41,247,
+17,217,195,170,213,196,31,73,248,73,21,195,6,251,14,200,29,87,34,29,228,247,
+247,82,10,143,37,10,247,16,225,41,29,251,110,247,146,116,29,123,95,10,251,
+110,43,10,187,249,17,82,10,251,48,247,152,248,97,21,251,94,115,6,189,136,
+151,128,140,94,8,252,110,7,86,124,116,106,144,29,220,209,247,21,10,162,248,
+162,41,29,199,54,29,251,194,253,159,21,244,54,10,149,146,131,128,104,108,
+101,72,92,31,14,251,110,56,29,251,75,251,233,21,244,54,10,149,146,247,41,
+29,199,39,10,251,220,251,233,21,244,54,10,149,146,247,41,29,143,38,29,247,
+55,247,87,82,10,87,44,10,251,92,251,233,21,244,54,10,149,146,247,41,29,199,
+33,10,251,52,249,51,138,29,142,84,146,114,159,110,8,104,223,29,145,190,8,
+14,199,33,10,45,248,253,82,10,199,76,10,48,7,127,119,135,124,120,26,93,187,
+29,118,130,136,123,27,99,116,161,177,171,162,160,180,143,31,201,146,5,14,
+87,44,10,235,249,84,21,81,6,251,3,216,10,32,247,105,125,21,229,144,197,198,
+227,26,210,101,182,39,181,30,164,10,164,247,37,117,6,78,10,157,131,157,135,
+176,131,101,54,24,89,29,14,143,37,10,216,248,5,21,35,80,94,80,61,26,76,175,
+97,193,184,168,168,184,182,113,167,100,135,134,139,138,133,30,138,137,136,
+139,138,27,129,132,147,150,174,169,176,206,186,31,14,143,174,247,127,21,251,
+61,167,226,49,247,29,27,212,198,166,198,191,31,191,7,75,106,74,94,79,27,66,
+92,222,247,39,127,31,231,6,168,189,5,251,16,176,6,155,247,57,7,168,189,5,
+251,85,6,247,61,153,180,217,215,27,181,181,113,95,167,31,159,109,149,105,
+146,86,8,158,247,115,120,6,109,135,127,123,122,27,131,131,141,143,132,31,
+168,87,120,145,99,27,49,56,80,40,91,31,120,99,131,113,129,85,8,97,6,111,89,
+5,205,113,6,112,101,7,111,89,5,14,248,109,247,17,66,29,248,92,80,21,84,239,
+119,6,101,85,119,117,97,103,8,118,170,251,80,7,99,166,114,182,181,163,157,
+192,165,30,118,148,5,114,125,133,133,126,27,125,134,147,161,31,247,66,194,
+7,14,45,29,247,138,81,10,143,247,169,171,21,75,172,105,244,247,55,26,243,
+155,230,167,193,30,182,161,167,159,177,27,180,179,113,95,165,31,158,107,149,
+106,145,87,8,165,247,115,116,6,108,136,128,123,124,27,131,132,141,143,132,
+31,168,87,119,146,100,27,251,40,251,7,251,47,251,91,41,164,55,188,76,31,81,
+183,201,111,223,27,213,191,165,207,198,31,117,158,113,108,120,122,109,124,
+25,247,37,7,140,179,143,152,159,164,8,113,154,154,129,163,27,173,158,159,
+174,177,116,164,105,105,119,120,77,108,31,209,251,24,119,7,167,136,145,129,
+141,99,8,14,251,138,96,29,251,138,96,29,251,55,236,29,248,140,247,42,10,247,
+229,249,57,249,71,21,72,6,252,115,253,99,5,205,6,236,248,91,21,109,110,121,
+129,114,27,78,95,212,240,203,158,180,169,157,148,126,110,143,31,93,144,154,
+120,172,27,166,157,157,166,188,89,177,76,42,72,62,251,1,36,202,66,226,198,
+184,169,199,173,31,247,241,72,21,44,73,64,251,0,33,205,66,234,236,203,211,
+247,0,246,73,214,44,31,113,4,180,152,103,251,1,251,21,127,102,97,102,123,
+175,224,247,47,149,174,182,31,14,251,55,247,137,248,6,21,67,190,105,180,177,
+26,151,147,148,150,140,142,139,138,142,30,138,144,145,139,143,27,182,168,
+170,185,188,107,171,90,80,99,93,71,55,187,75,247,7,73,31,14,251,221,247,165,
+139,29,14,251,55,247,223,249,17,82,10,143,176,29,223,63,192,251,12,251,7,
+63,89,63,126,29,251,12,103,91,119,102,114,202,29,88,150,161,120,188,27,182,
+170,155,180,177,31,111,29,86,248,141,21,81,90,91,82,78,186,92,198,199,186,
+186,198,198,91,187,247,28,29,112,106,244,10,53,205,146,29,171,159,147,149,
+162,26,165,120,157,110,120,247,1,29,211,248,170,163,21,104,140,124,157,140,
+180,8,160,29,247,173,184,29,252,146,84,29,251,43,249,135,41,29,87,34,29,174,
+248,45,21,75,122,110,116,110,10,251,110,247,147,123,29,247,78,7,104,93,131,
+110,29,159,29,39,247,146,116,10,203,174,29,143,38,29,245,247,141,21,76,122,
+110,115,110,10,143,247,23,10,104,109,146,100,27,251,21,181,10,176,169,131,
+179,27,247,22,234,242,247,32,222,113,198,77,194,31,251,107,251,178,21,138,
+161,139,161,164,26,247,73,162,10,103,121,157,184,125,30,126,248,84,91,29,
+251,110,247,147,233,29,182,131,148,219,29,247,131,7,251,152,248,185,246,10,
+148,136,120,181,31,168,126,5,131,158,164,133,158,27,197,176,178,227,181,29,
+111,114,145,118,27,78,103,99,54,121,31,14,199,33,10,252,37,248,165,80,10,
+247,63,42,29,251,31,174,29,247,174,35,29,243,247,135,21,76,123,109,115,121,
+10,144,190,8,14,199,39,29,251,137,253,196,21,244,54,10,149,146,131,128,104,
+108,101,72,92,31,14,247,63,248,4,22,247,37,164,6,83,10,247,62,7,96,43,88,
+29,251,55,247,98,128,21,194,147,177,171,172,210,114,150,24,247,25,29,247,
+193,233,183,45,247,61,114,7,79,54,99,94,73,83,8,112,191,251,216,7,141,78,
+171,103,197,132,100,54,24,151,166,10,133,141,123,102,5,126,176,165,134,173,
+159,10,126,31,14,33,29,251,105,247,142,101,10,104,10,154,178,239,30,247,117,
+6,172,62,152,102,215,29,247,216,7,125,10,99,249,58,21,81,90,91,82,79,186,
+91,198,198,187,186,198,198,91,187,172,10,36,188,21,195,6,247,34,201,5,172,
+153,146,145,156,26,157,120,151,110,120,121,133,126,123,30,14,247,174,95,29,
+103,203,190,126,210,27,247,100,144,10,181,213,26,247,105,122,29,193,249,20,
+194,10,247,43,10,248,140,224,10,88,104,103,8,97,100,80,120,247,36,10,247,
+3,132,166,113,156,182,29,152,141,144,146,142,30,144,149,165,143,166,27,227,
+199,121,105,167,31,160,113,149,115,152,75,220,10,131,120,119,106,30,138,138,
+136,133,136,133,94,29,123,66,136,230,10,184,248,37,195,10,247,43,10,248,145,
+234,21,143,251,20,5,131,7,64,143,104,83,90,27,122,126,146,149,144,142,146,
+145,149,31,149,155,143,149,150,247,5,10,221,208,195,167,187,165,30,156,171,
+150,188,180,26,138,248,212,5,94,10,114,247,119,164,7,247,37,29,14,247,63,
+247,145,247,206,21,251,89,7,137,63,128,129,55,133,8,114,247,249,164,7,54,
+143,128,150,137,216,8,247,89,222,186,56,247,175,117,10,251,175,54,92,7,14,
+199,247,104,248,97,21,251,83,115,6,183,132,147,130,140,96,8,251,186,106,29,
+167,149,184,169,170,27,174,156,112,83,31,252,55,7,86,125,116,105,108,10,247,
+222,247,14,29,14,251,55,247,103,247,189,21,247,12,233,183,45,247,61,114,7,
+78,53,99,94,74,84,8,112,191,251,12,79,92,199,251,49,151,29,247,26,230,186,
+7,14,199,247,114,247,80,21,152,154,222,251,24,5,155,116,139,139,130,26,129,
+132,134,123,137,30,126,137,5,119,247,111,159,7,113,142,134,143,114,179,251,
+35,247,118,24,201,208,188,195,147,145,182,152,25,159,251,84,119,7,180,133,
+156,128,119,26,122,125,113,117,115,30,51,41,5,247,114,251,71,118,146,7,169,
+140,155,117,137,103,8,251,193,7,103,141,123,117,109,27,132,119,247,119,159,
+135,6,109,123,161,175,141,31,14,247,125,164,248,0,21,191,155,163,152,166,
+164,8,177,175,162,190,191,26,205,99,188,85,95,102,102,95,99,170,105,176,156,
+153,144,151,153,30,140,132,139,134,136,26,88,103,93,72,104,30,249,67,251,
+255,66,10,14,249,82,111,10,251,12,37,77,29,252,89,240,21,167,143,159,158,
+164,27,153,145,137,119,183,180,29,125,126,111,27,128,173,29,249,52,247,20,
+21,91,101,103,120,89,27,59,136,10,102,100,203,29,149,126,153,31,130,149,136,
+144,146,26,160,166,153,177,195,161,116,81,30,59,7,251,22,97,95,122,106,116,
+8,101,112,121,106,94,26,69,180,102,216,205,195,165,196,197,30,145,145,5,77,
+177,177,117,210,179,10,187,201,170,172,227,171,31,247,30,176,21,247,10,157,
+179,191,186,155,107,46,30,106,7,251,167,247,135,117,29,165,120,157,110,120,
+247,1,29,32,248,6,164,21,65,143,119,154,138,191,146,10,138,88,120,124,66,
+134,8,114,247,242,7,251,206,249,128,21,167,142,159,158,165,27,152,148,136,
+120,181,31,168,126,5,131,157,166,247,15,29,102,126,125,127,247,9,10,111,114,
+145,119,27,77,247,43,29,248,140,36,29,252,38,132,10,248,140,36,29,252,177,
+226,53,10,36,10,251,155,230,45,10,36,10,252,29,230,53,10,38,10,251,155,132,
+10,143,35,10,251,45,230,21,251,29,247,49,5,157,124,119,191,10,143,14,251,
+138,14,248,140,248,27,248,154,193,10,251,20,251,0,21,146,54,150,98,169,94,
+8,76,181,203,107,222,27,216,199,166,193,181,31,175,186,154,184,146,232,128,
+89,128,117,113,109,8,84,91,79,113,58,27,58,79,165,194,91,31,113,169,128,161,
+128,189,8,247,238,247,0,193,10,251,1,247,104,118,29,137,90,21,247,69,247,
+33,251,32,251,68,251,67,251,33,251,33,251,67,251,65,251,35,247,33,247,62,
+247,71,247,30,247,34,247,68,31,14,248,140,248,137,249,110,118,29,251,1,251,
+99,196,29,251,20,251,5,21,150,89,150,117,165,109,8,84,187,199,113,220,27,
+220,199,165,194,187,31,165,169,150,161,150,189,132,54,128,98,109,94,8,76,
+97,75,107,56,27,62,79,166,193,97,31,103,186,124,184,132,232,8,247,238,247,
+5,196,29,14,248,140,248,135,111,21,159,229,199,242,247,8,247,37,8,235,247,
+14,171,206,219,26,221,69,207,55,91,95,118,101,106,30,117,114,129,117,126,
+93,127,175,131,157,127,157,8,189,106,88,168,84,27,54,73,71,50,72,160,94,223,
+251,6,31,247,43,251,94,179,71,165,36,8,14,248,140,247,142,247,241,21,240,
+251,17,247,16,251,69,177,64,199,247,0,247,6,247,53,243,247,16,58,232,251,
+54,247,120,104,210,84,36,64,33,251,38,251,75,8,14,248,140,249,131,22,159,
+7,36,159,110,153,93,187,92,191,122,192,138,235,160,102,147,126,151,125,8,
+93,178,201,108,192,27,230,210,213,233,229,74,211,58,110,132,137,110,80,31,
+167,180,150,170,176,26,227,66,210,48,46,68,69,48,104,146,121,173,85,30,163,
+90,119,145,108,27,64,73,63,52,46,212,66,231,220,207,189,230,184,31,140,123,
+139,128,134,26,67,101,58,85,95,30,107,114,116,130,44,119,8,119,7,14,248,140,
+247,187,22,248,119,162,6,251,53,147,63,224,142,247,62,8,56,183,185,106,212,
+27,209,197,201,213,207,113,180,32,236,31,251,1,240,120,166,100,247,9,123,
+46,81,55,32,52,8,58,72,105,83,75,26,64,200,77,212,181,180,156,169,171,30,
+158,157,150,154,156,176,145,251,59,52,44,251,51,138,8,14,248,193,248,229,
+21,67,188,156,121,156,27,149,147,146,149,145,138,143,132,153,31,116,182,122,
+203,183,26,169,137,145,126,134,132,136,131,126,30,120,112,61,117,96,27,113,
+138,131,134,126,26,117,173,129,226,133,30,37,251,77,5,151,108,110,145,107,
+27,251,26,251,0,251,0,251,26,251,25,247,0,251,0,247,26,247,25,247,0,247,0,
+247,26,216,102,211,76,185,31,251,34,123,21,238,220,59,40,40,59,58,40,39,59,
+219,238,238,219,220,238,31,14,248,25,247,167,21,179,147,156,144,164,154,8,
+208,180,180,210,217,26,247,14,41,237,251,14,251,13,41,41,251,14,61,180,68,
+208,98,30,163,124,156,133,179,132,8,62,251,41,87,247,41,251,44,195,247,44,
+247,40,191,251,40,7,108,248,94,21,231,213,67,49,48,66,66,49,49,66,212,229,
+227,212,214,226,31,14,143,247,129,247,67,21,146,124,119,143,122,27,77,84,
+86,80,104,165,117,180,186,183,162,177,166,31,159,166,145,161,141,187,8,247,
+185,7,195,131,185,63,56,26,89,131,101,115,84,30,166,6,175,182,158,194,197,
+26,214,110,210,81,209,30,88,200,138,140,134,146,131,149,25,197,95,7,14,248,
+140,247,205,248,119,21,110,102,124,103,133,91,8,251,5,84,247,5,6,143,97,158,
+91,166,106,59,60,24,177,101,219,219,177,110,178,123,184,134,25,251,5,193,
+247,5,7,183,144,185,158,171,165,219,59,24,176,177,59,219,168,174,156,181,
+144,184,25,247,5,194,251,5,6,134,182,121,183,112,173,218,218,24,102,177,59,
+59,105,166,98,157,92,145,25,247,4,85,251,4,7,96,134,95,121,104,111,59,219,
+24,101,101,5,247,156,85,21,236,216,64,45,43,63,62,44,45,62,216,234,231,216,
+217,230,31,14,248,140,250,66,249,143,21,254,9,254,9,250,9,6,252,81,248,222,
+21,220,204,75,61,58,75,75,59,60,75,203,219,216,204,205,215,31,14,248,2,248,
+155,21,251,39,251,9,251,6,251,35,251,38,247,7,251,8,247,37,247,35,247,8,247,
+8,247,36,247,33,251,8,247,10,251,31,31,131,78,21,247,4,229,51,251,1,251,3,
+51,50,251,2,251,2,50,228,247,2,246,228,230,245,31,14,248,140,248,141,248,
+247,21,251,52,251,20,251,17,251,48,251,50,247,18,251,19,247,49,247,48,247,
+19,247,19,247,48,247,46,251,19,247,21,251,43,31,248,73,247,52,21,254,9,254,
+9,250,9,6,252,84,249,139,21,247,70,247,35,251,32,251,66,251,68,251,32,251,
+34,251,68,251,66,251,33,247,33,247,67,247,63,247,34,247,37,247,60,31,14,248,
+140,247,34,22,249,96,247,250,253,96,6,14,247,8,10,14,247,8,10,179,252,63,
+21,248,23,248,23,252,23,7,14,248,208,247,103,21,251,103,248,36,251,103,252,
+36,5,14,247,249,4,135,29,14,249,102,247,249,132,29,249,3,248,55,21,252,160,
+6,247,102,220,116,192,251,178,251,20,5,62,7,247,178,251,19,162,191,251,102,
+221,5,248,160,6,251,102,57,162,87,247,178,247,19,5,216,7,251,178,247,20,116,
+86,5,14,248,27,22,249,3,7,220,251,102,192,163,251,20,247,177,5,62,6,251,19,
+251,177,191,115,221,247,102,5,253,3,7,14,248,27,249,102,21,75,253,3,6,57,
+247,102,87,199,10,14,247,222,249,3,121,29,162,247,9,29,116,5,14,247,91,44,
+21,81,247,219,197,7,251,88,249,66,121,29,163,247,9,29,115,5,14,217,247,141,
+22,199,138,247,89,248,11,251,81,248,2,5,76,6,251,88,251,255,5,247,114,251,
+138,21,251,14,247,137,247,18,247,127,247,13,251,129,5,14,248,208,248,175,
+21,252,58,6,247,103,252,36,5,14,247,254,248,133,21,251,11,43,43,251,12,251,
+11,235,44,247,11,247,12,234,234,247,11,247,12,43,235,251,11,31,14,248,140,
+250,8,248,237,21,75,251,72,252,195,6,172,29,249,3,6,14,251,55,197,247,130,
+21,247,66,251,232,5,124,147,149,131,151,27,147,144,143,146,146,137,147,136,
+147,31,251,23,247,221,247,23,247,221,5,142,147,141,147,146,26,147,134,143,
+131,127,131,133,121,129,30,14,251,55,247,167,247,130,21,251,66,247,232,5,
+156,130,130,146,127,27,131,134,135,131,133,141,131,142,130,31,247,23,251,
+221,251,23,251,221,5,136,132,137,131,132,26,131,144,135,147,151,147,145,156,
+149,30,14,236,248,39,248,28,21,251,105,6,65,247,77,5,45,6,247,125,252,213,
+5,222,6,247,125,248,213,5,45,6,34,251,157,21,63,251,72,64,247,72,5,14,143,
+247,191,247,184,21,251,148,247,217,5,129,117,134,119,118,26,119,146,124,159,
+113,30,209,52,83,34,5,121,106,129,111,119,26,119,148,117,159,104,30,165,96,
+139,139,128,26,121,126,129,117,30,121,78,221,6,226,162,154,198,179,130,158,
+84,212,31,105,185,127,167,168,26,158,143,151,158,174,30,247,191,252,11,5,
+149,160,144,157,159,26,160,131,157,114,170,30,100,189,5,102,185,129,160,172,
+26,158,142,153,151,170,30,183,245,5,161,6,161,149,129,114,143,31,148,170,
+143,165,168,26,191,122,159,95,30,71,6,100,126,150,171,31,155,7,110,108,125,
+106,99,26,112,147,115,153,126,30,129,149,153,135,170,27,179,6,14,67,189,22,
+247,217,248,213,251,217,55,247,133,251,54,251,133,55,247,133,251,55,251,133,
+6,14,248,226,248,233,21,109,134,111,132,117,30,113,129,128,129,118,27,121,
+132,150,203,112,31,118,188,121,167,117,158,8,166,108,95,154,90,27,251,15,
+37,43,251,9,82,160,93,182,101,31,175,107,171,126,199,130,144,176,24,89,148,
+115,149,112,160,8,106,166,119,183,184,26,221,208,210,219,194,172,109,51,182,
+30,74,171,170,114,190,27,213,178,195,244,140,31,151,7,164,251,229,21,132,
+169,134,155,131,156,8,184,119,105,163,93,27,66,75,79,70,114,146,109,151,112,
+31,182,43,139,139,140,113,8,103,141,104,108,95,27,101,110,156,183,108,31,
+94,202,139,139,134,144,124,157,116,156,116,150,8,152,113,107,146,110,27,130,
+6,138,104,174,127,153,129,158,111,25,195,48,139,139,165,112,8,103,173,178,
+120,180,27,186,201,162,173,184,31,181,171,159,172,175,26,156,135,156,128,
+162,30,89,247,7,136,147,164,26,168,161,161,168,178,162,113,75,154,30,14,247,
+174,247,8,151,21,155,149,147,146,150,27,149,148,136,134,146,31,108,186,139,
+139,166,27,178,180,168,188,172,31,168,183,154,197,208,26,196,7,140,146,145,
+139,142,27,161,152,136,132,149,31,152,131,142,131,151,91,181,251,60,24,95,
+150,154,116,158,27,172,182,169,188,178,31,126,153,5,135,128,134,137,133,27,
+118,128,152,177,130,31,110,247,3,124,195,125,161,110,157,25,233,172,179,176,
+192,26,219,75,200,55,83,96,120,92,94,30,181,113,92,164,88,27,41,61,56,34,
+78,157,110,198,106,31,178,117,157,118,114,26,133,138,131,137,129,30,150,136,
+5,172,178,151,163,165,26,161,125,156,108,155,30,84,167,139,139,131,146,8,
+118,156,128,161,165,26,193,179,180,191,206,170,88,251,3,30,251,40,7,83,136,
+114,129,110,30,120,132,125,121,129,27,134,133,142,144,131,31,156,116,124,
+145,120,27,98,112,110,74,117,31,247,195,247,251,21,222,137,151,127,182,30,
+160,168,157,145,170,27,194,178,103,89,106,120,108,109,123,31,110,124,121,
+133,77,124,8,14,247,63,170,249,10,21,247,149,253,10,5,227,6,247,151,249,10,
+5,251,195,252,164,21,251,74,248,91,5,248,1,6,14,247,63,172,22,248,238,6,251,
+173,249,68,5,251,107,252,230,21,247,64,248,9,247,47,252,9,5,14,247,253,210,
+21,68,221,5,248,131,97,252,82,7,87,199,5,82,6,247,114,251,154,247,114,247,
+154,5,82,6,87,79,5,248,82,97,252,131,7,14,247,253,248,213,21,210,57,5,252,
+131,181,248,82,7,191,79,5,196,6,251,114,247,154,251,114,251,154,5,196,6,191,
+199,5,252,82,181,248,131,7,14,248,140,248,214,247,203,21,247,66,227,251,21,
+6,179,220,61,178,78,251,12,5,251,168,51,247,124,6,81,251,8,5,251,66,51,247,
+21,6,99,58,217,100,200,247,12,5,247,168,227,251,124,6,14,248,140,247,157,
+126,21,248,106,214,252,106,6,247,29,4,248,106,214,252,106,6,247,29,4,248,
+106,214,252,106,6,14,248,63,104,21,182,6,247,44,250,64,62,150,251,9,253,105,
+251,68,247,248,251,74,50,172,68,234,186,5,14,248,140,248,101,247,135,21,67,
+140,99,142,81,30,141,109,140,111,122,26,111,130,120,127,136,135,143,147,134,
+30,159,129,128,147,120,27,114,119,120,114,108,168,116,180,177,172,158,173,
+158,31,164,184,153,247,0,247,36,26,247,214,7,214,138,176,136,198,30,137,167,
+138,172,150,26,167,147,160,149,143,141,137,133,142,30,118,150,155,129,158,
+27,165,158,158,163,172,110,161,98,101,106,119,106,120,31,114,94,125,251,0,
+251,36,26,14,248,46,251,102,21,249,113,7,137,214,136,199,134,213,8,135,182,
+138,157,150,26,161,145,149,151,143,144,137,136,142,30,120,158,145,136,157,
+27,166,160,161,166,170,111,163,104,52,108,33,251,184,31,253,105,7,14,247,
+227,250,37,21,253,113,7,141,64,142,79,144,65,8,143,96,140,121,128,26,117,
+133,129,127,132,137,140,150,128,30,149,130,127,144,125,27,112,118,117,112,
+108,167,115,174,226,170,245,247,183,31,249,106,7,14,248,140,249,56,247,107,
+21,107,114,120,126,115,27,120,125,144,165,80,31,167,77,109,148,108,27,85,
+103,115,79,105,162,29,173,162,200,182,31,84,247,128,21,106,114,120,126,115,
+27,120,126,143,166,79,31,167,77,109,148,108,27,85,103,114,80,105,31,192,93,
+5,171,162,156,149,168,27,175,168,130,113,186,31,114,185,165,131,172,27,185,
+171,161,202,184,31,14,248,140,249,90,140,21,223,252,60,55,7,248,60,248,212,
+21,252,60,251,121,5,119,7,248,60,251,118,5,247,5,7,251,176,247,38,247,176,
+247,44,5,14,248,140,247,183,140,21,248,60,223,252,60,6,156,4,248,60,247,108,
+5,159,7,252,60,247,132,5,251,5,7,247,176,251,52,251,176,251,30,5,14,248,29,
+247,172,247,0,21,247,95,248,52,227,252,140,251,183,7,14,248,140,249,100,248,
+195,21,79,251,141,6,38,134,98,124,110,30,91,114,83,107,80,27,87,88,164,179,
+111,31,116,172,133,180,247,4,26,247,141,79,251,138,7,251,29,144,105,163,99,
+30,74,177,209,102,222,27,215,203,170,195,180,31,172,184,145,171,247,41,26,
+14,248,140,249,100,22,247,138,7,247,29,134,173,115,180,30,202,101,68,177,
+57,27,63,75,108,83,98,31,106,94,133,107,251,41,26,251,138,199,247,141,7,240,
+145,182,156,170,30,185,164,194,169,196,27,192,191,113,97,167,31,160,107,145,
+102,251,6,26,251,141,7,14,248,140,249,147,247,108,21,200,252,98,7,145,246,
+195,189,247,1,137,8,247,183,201,251,172,209,29,56,247,24,29,201,251,183,6,
+251,1,137,83,189,133,245,8,14,248,140,248,106,248,234,21,252,173,251,161,
+78,248,234,200,251,160,248,173,7,14,248,140,248,136,247,164,21,96,178,135,
+142,120,153,8,165,106,96,155,106,27,69,81,81,69,69,197,81,209,173,180,155,
+165,173,31,158,153,143,142,182,178,184,100,143,135,156,126,8,113,174,180,
+123,173,27,209,197,197,209,209,81,197,69,106,96,123,113,105,31,122,126,134,
+135,95,100,8,172,109,21,190,190,191,169,179,27,183,176,102,95,94,102,102,
+95,100,88,168,192,86,31,74,22,87,87,87,110,100,27,95,102,176,183,183,176,
+176,184,178,190,110,87,191,31,14,248,140,249,62,247,59,21,90,140,109,156,
+86,197,8,192,185,176,161,182,27,139,142,139,142,138,30,201,127,7,79,81,103,
+73,89,31,207,85,81,173,80,27,61,83,82,58,59,192,84,217,191,190,163,185,181,
+31,147,147,144,145,155,157,195,70,203,102,199,142,8,251,121,247,30,21,135,
+134,139,139,133,133,8,92,93,106,121,98,27,99,112,169,185,185,167,168,184,
+173,162,127,94,187,31,149,130,139,139,148,130,8,14,248,140,247,140,247,207,
+21,192,176,171,157,196,27,176,161,133,107,224,31,116,202,162,133,174,27,211,
+195,168,200,187,31,77,188,5,100,94,117,129,98,27,104,116,144,164,68,31,167,
+57,98,149,105,27,67,93,107,47,81,31,163,251,46,21,248,225,213,252,225,6,138,
+251,94,21,248,225,213,252,225,6,14,248,136,247,161,247,60,21,92,102,225,10,
+248,94,22,93,101,101,92,93,177,102,186,184,177,178,184,185,101,177,93,31,
+251,121,248,98,21,93,101,225,10,14,248,140,249,69,249,85,21,253,114,7,84,
+138,120,119,84,240,10,249,59,7,196,160,162,192,30,156,157,253,159,121,155,
+6,193,159,117,81,140,31,253,59,7,84,138,119,119,85,240,10,249,114,7,14,248,
+140,247,238,249,91,21,247,133,6,244,138,165,117,154,38,8,162,6,130,247,57,
+5,252,175,6,247,102,252,103,251,110,252,44,5,248,200,6,188,247,102,5,116,
+6,111,59,108,120,38,140,8,251,188,6,247,73,247,244,5,14,251,13,247,82,247,
+148,21,142,142,147,147,153,154,198,201,144,145,155,161,8,185,205,167,212,
+193,26,198,105,179,87,43,71,251,23,251,174,89,30,124,119,133,131,131,130,
+8,101,96,139,139,124,26,124,149,122,147,146,155,153,161,158,30,138,129,139,
+129,135,26,101,142,104,144,123,30,94,151,169,114,179,27,170,168,156,171,162,
+31,156,163,150,166,160,26,154,131,148,127,128,133,134,122,131,30,104,121,
+132,130,128,27,131,134,148,155,165,147,204,153,223,31,149,215,21,247,69,166,
+165,219,172,27,152,147,126,119,84,89,33,82,76,31,14,143,246,249,24,21,168,
+201,153,143,180,27,232,194,49,251,43,113,138,118,135,105,31,182,81,104,152,
+88,27,90,97,122,103,103,31,90,91,111,73,73,26,251,2,227,51,247,1,203,195,
+165,188,181,30,197,208,178,247,28,247,29,26,247,14,96,239,56,209,30,175,96,
+88,157,81,27,96,108,132,113,68,31,247,198,252,46,21,123,251,2,125,89,113,
+95,8,97,113,104,115,103,27,90,109,185,215,247,0,201,226,215,173,162,127,104,
+176,31,14,248,140,248,139,249,75,21,251,92,133,10,251,85,31,135,251,208,21,
+251,82,247,80,5,184,194,204,162,209,27,208,204,116,96,195,31,179,99,21,187,
+81,162,77,66,26,67,116,75,93,83,30,251,84,247,87,5,247,44,251,127,21,95,84,
+72,115,69,27,69,75,162,186,80,31,247,85,247,85,5,251,125,251,45,21,95,193,
+116,203,209,26,211,162,203,186,196,30,247,82,251,80,5,14,247,81,247,205,248,
+38,21,251,14,67,76,60,58,26,113,146,111,155,97,30,88,64,124,106,98,26,85,
+176,99,188,193,182,192,206,179,124,186,98,224,30,177,187,179,179,195,185,
+8,192,201,176,158,175,27,172,162,109,95,85,115,62,105,89,31,100,114,101,115,
+106,27,108,111,160,162,152,146,146,153,140,31,161,141,154,154,158,26,155,
+127,151,122,110,115,108,101,93,175,107,190,189,196,172,194,186,30,180,186,
+161,195,194,26,208,99,185,81,60,72,92,251,56,251,49,30,130,158,136,157,161,
+26,214,178,193,233,194,30,251,56,251,224,21,180,64,156,95,106,26,108,118,
+117,109,102,112,170,182,178,146,155,189,215,30,14,248,140,248,61,141,21,137,
+161,145,139,173,27,247,172,201,251,183,6,123,6,247,109,248,6,5,229,201,86,
+6,167,187,97,164,96,66,5,251,62,247,29,10,67,43,26,251,16,190,53,229,110,
+30,111,90,180,113,5,247,126,248,131,21,251,105,251,255,5,68,158,105,197,240,
+26,247,21,191,195,247,13,30,14,248,140,249,23,248,53,21,252,68,252,53,5,248,
+214,181,252,105,6,247,244,247,234,5,14,248,140,247,125,201,247,4,10,183,172,
+211,242,26,246,204,10,247,13,191,84,251,22,251,22,87,84,251,13,31,14,248,
+140,249,147,201,21,251,183,6,251,13,87,194,189,29,102,31,74,96,105,67,43,
+26,251,7,184,55,247,24,29,6,14,248,140,247,125,247,58,247,4,10,182,172,212,
+238,26,247,4,93,224,61,234,29,247,13,191,83,251,21,251,22,87,83,251,13,31,
+247,135,251,3,21,252,170,84,248,170,6,14,248,140,249,147,247,58,21,251,183,
+6,251,13,87,195,189,29,101,31,75,96,105,66,43,26,42,167,72,198,93,30,107,
+179,176,130,229,27,247,172,6,90,4,252,170,84,248,170,6,14,248,140,248,164,
+247,108,21,247,131,200,251,96,6,227,247,47,5,247,8,201,58,6,172,198,97,163,
+92,56,5,251,35,209,29,55,220,105,30,106,82,182,116,177,206,5,136,164,153,
+138,180,27,247,172,201,251,183,6,119,133,139,140,129,31,171,247,45,21,58,
+251,33,87,157,108,190,136,211,25,247,182,247,108,21,51,251,47,5,251,94,6,
+145,246,195,189,247,1,137,8,14,219,247,187,21,221,210,5,248,188,181,252,139,
+6,187,10,248,139,181,252,188,6,14,249,23,247,187,21,57,68,5,252,188,97,248,
+139,177,29,252,139,97,248,188,6,14,247,95,248,44,21,187,10,247,206,177,29,
+251,255,97,21,248,48,6,221,68,57,68,5,252,48,6,57,210,5,14,143,142,251,77,
+21,52,248,124,226,7,252,124,247,32,21,52,248,124,226,7,14,143,248,136,249,
+133,21,208,252,136,70,7,14,248,140,240,177,21,171,102,247,14,239,5,64,208,
+227,100,238,27,247,83,247,47,247,47,247,83,214,117,207,93,202,31,247,5,231,
+107,177,251,5,46,5,207,70,55,174,46,27,251,83,251,47,251,47,251,82,68,159,
+75,179,79,31,177,171,21,107,190,124,192,197,26,247,59,247,24,247,27,247,55,
+218,210,109,80,198,30,170,101,21,175,88,158,77,76,26,251,58,251,24,251,27,
+251,55,55,64,173,205,79,30,14,217,247,60,247,131,21,144,225,145,171,165,226,
+8,167,235,141,149,247,7,10,111,150,101,30,178,251,23,145,112,192,10,184,102,
+176,94,31,247,174,227,21,144,225,145,170,164,227,8,168,234,141,150,247,7,
+10,109,150,103,30,178,251,21,145,110,192,10,185,103,175,93,31,14,143,247,
+23,29,14,143,247,23,29,179,251,217,21,247,177,247,177,251,177,7,14,248,119,
+147,22,250,86,211,254,14,250,3,67,6,14,251,107,247,10,142,10,14,195,247,7,
+142,10,247,156,22,243,247,83,5,161,179,151,170,211,10,14,248,140,247,45,22,
+249,80,248,37,6,251,243,247,220,251,241,251,220,5,200,251,242,21,247,220,
+7,247,180,247,162,247,182,251,162,5,251,220,7,14,247,7,247,151,22,124,247,
+47,5,89,184,107,227,232,26,194,150,197,159,189,30,202,164,180,174,189,27,
+218,202,251,8,251,37,46,107,51,89,94,31,124,251,47,5,247,128,247,45,120,6,
+132,94,123,122,106,138,8,251,10,6,142,177,5,242,185,199,232,247,7,26,187,
+127,190,117,186,30,239,93,56,197,45,27,46,56,81,39,93,31,117,92,127,88,91,
+26,251,8,199,47,242,93,30,142,101,5,251,10,6,106,140,124,155,131,185,8,120,
+251,45,6,14,248,140,248,98,247,134,21,34,101,177,74,223,212,120,251,3,5,219,
+6,120,247,3,223,66,177,204,34,177,244,176,101,204,55,66,158,247,3,5,59,6,
+158,251,3,55,212,101,74,5,14,248,140,247,125,247,108,21,248,98,6,134,33,82,
+88,251,1,142,8,251,183,77,247,172,6,222,174,146,164,177,31,205,183,171,211,
+241,26,247,0,204,10,247,1,141,196,88,144,33,8,252,98,6,14,243,248,158,247,
+143,21,138,212,134,174,126,176,8,218,109,66,188,48,27,251,26,54,35,251,57,
+251,54,221,41,247,28,242,208,191,236,167,31,98,6,69,110,85,104,64,27,97,104,
+151,162,115,31,122,156,130,156,128,178,8,243,7,247,175,174,21,251,173,232,
+6,213,171,175,166,207,27,192,176,121,98,172,31,150,125,143,131,146,119,8,
+14,248,238,248,11,21,252,92,247,73,5,251,254,7,14,248,213,247,86,21,247,254,
+7,252,92,251,73,5,14,248,19,248,87,21,158,114,161,120,160,127,195,107,148,
+133,144,130,8,145,128,143,120,118,26,251,124,7,146,122,116,143,120,27,70,
+77,86,79,104,168,117,184,190,187,162,177,170,31,160,166,146,161,141,188,8,
+248,0,7,140,211,106,213,93,167,84,175,109,159,135,143,8,126,153,133,157,162,
+26,152,95,252,128,7,146,123,116,143,121,27,70,79,86,79,104,167,117,183,190,
+187,162,177,168,31,160,166,146,161,141,188,8,142,248,10,21,247,3,79,163,103,
+143,251,8,251,6,200,116,174,135,247,9,8,14,68,10,247,63,148,10,247,236,6,
+197,201,158,170,180,31,175,167,160,183,192,26,190,119,179,99,171,30,114,159,
+120,147,70,158,76,29,247,32,151,249,42,21,117,7,208,134,151,122,137,52,8,
+252,36,7,141,52,127,123,70,133,8,117,247,208,161,7,69,145,127,155,141,226,
+8,248,49,7,203,163,161,208,206,192,122,106,176,30,170,111,160,106,174,60,
+8,165,6,100,247,114,5,14,247,23,247,209,249,48,21,111,6,251,161,253,48,5,
+248,236,6,251,94,241,21,251,139,6,101,127,143,153,148,143,152,145,155,31,
+247,20,247,207,5,14,247,63,62,10,14,247,63,247,119,179,21,248,10,249,2,5,
+252,132,6,125,251,80,5,164,6,149,239,199,190,243,138,8,247,11,6,252,8,253,
+4,5,248,211,6,164,247,122,5,114,6,119,251,19,62,73,251,18,142,8,14,247,174,
+55,29,247,174,247,177,248,89,21,251,125,169,7,185,140,163,162,188,27,187,
+164,116,93,31,169,247,125,109,6,92,134,118,119,92,27,91,119,158,187,133,31,
+214,247,117,21,49,44,101,79,77,31,82,83,103,45,46,26,35,172,51,199,78,30,
+79,199,235,101,231,27,223,229,173,194,197,31,205,200,176,232,242,26,242,102,
+233,73,199,30,195,80,51,172,53,27,138,106,21,245,205,251,12,251,85,251,85,
+73,251,12,33,34,71,247,16,247,85,227,157,221,172,199,31,190,167,182,167,190,
+27,14,32,247,242,247,55,10,191,137,155,247,51,29,247,174,247,206,51,10,14,
+247,113,247,195,248,87,21,247,39,251,244,5,149,115,141,131,129,210,10,145,
+123,175,131,10,143,153,146,159,31,14,248,84,61,10,247,33,248,181,21,248,86,
+252,181,5,160,248,200,6,136,197,154,156,190,142,8,156,159,251,93,119,158,
+6,191,137,154,121,138,81,8,251,220,7,251,241,248,62,5,251,99,119,6,164,152,
+132,111,164,31,161,112,5,252,120,7,113,29,247,97,159,121,247,44,10,247,73,
+248,224,22,172,247,95,5,113,6,116,67,69,103,251,10,140,8,49,6,251,10,138,
+68,175,116,211,8,114,6,172,251,95,5,248,135,249,42,21,252,135,251,74,161,
+6,149,195,191,169,229,141,8,247,43,6,229,137,192,109,148,83,8,161,6,39,126,
+21,131,83,106,112,79,138,8,38,6,79,140,106,166,131,195,8,115,251,150,163,
+6,137,188,183,175,198,137,8,240,6,198,141,183,104,137,89,8,163,247,150,6,
+14,247,174,248,23,67,10,247,174,249,127,249,42,21,253,98,75,10,248,83,7,137,
+198,154,157,192,141,8,247,17,6,192,137,154,121,137,80,8,252,83,7,113,29,247,
+207,159,121,100,29,248,103,7,247,27,10,157,6,14,247,7,60,29,247,50,248,196,
+249,42,21,252,162,6,247,58,251,243,251,58,251,203,5,248,162,6,187,247,112,
+5,109,6,86,251,16,71,93,251,17,141,8,251,5,6,247,30,247,174,251,36,247,180,
+5,247,1,6,247,27,143,203,90,148,251,6,8,169,6,14,247,63,248,48,249,6,21,182,
+6,219,142,188,88,144,48,8,168,247,67,252,207,156,29,247,241,159,110,247,44,
+10,248,48,65,29,14,247,225,247,235,49,29,49,10,247,176,248,93,247,112,21,
+247,43,142,235,243,138,247,51,142,216,24,184,140,149,159,160,27,146,145,137,
+134,150,31,147,159,5,160,100,118,146,108,27,71,95,93,64,137,31,135,251,13,
+140,44,96,69,77,134,25,247,198,7,136,197,155,158,191,141,8,148,159,251,174,
+119,148,6,191,137,155,120,137,81,8,251,198,7,78,143,95,206,227,26,136,235,
+138,174,135,169,134,159,25,182,126,96,168,87,27,108,117,132,118,104,31,146,
+119,5,145,153,144,140,146,27,150,149,131,129,143,31,143,126,139,135,141,92,
+141,72,24,141,251,46,237,36,247,40,137,8,251,16,7,141,83,123,122,87,136,8,
+120,119,247,194,159,120,6,87,142,123,156,142,195,8,14,247,197,248,171,247,
+0,21,186,145,165,147,165,154,8,208,177,181,226,243,26,247,82,251,28,247,16,
+251,100,251,101,251,28,251,16,251,82,48,173,57,194,97,30,170,115,170,128,
+198,131,145,126,24,143,109,120,141,108,27,97,6,86,140,129,148,127,200,8,78,
+6,176,251,64,5,247,204,237,6,95,155,121,150,119,164,8,102,185,116,229,237,
+26,244,160,207,186,186,30,166,166,181,155,182,27,182,180,123,112,166,31,186,
+91,160,72,34,26,55,121,54,111,93,30,116,102,119,124,86,120,8,41,247,204,7,
+176,247,64,5,78,6,127,79,129,129,86,138,8,97,6,109,120,137,135,108,31,14,
+201,248,179,248,87,59,10,170,247,95,177,21,105,168,165,125,173,27,244,228,
+246,247,19,208,114,202,96,175,31,128,148,126,147,111,152,8,196,174,166,181,
+194,26,210,78,186,47,62,69,105,82,101,30,113,101,129,97,73,26,252,250,247,
+19,7,249,8,4,247,19,160,196,186,172,163,101,85,102,135,104,130,107,30,148,
+119,130,142,125,27,110,119,122,115,116,154,123,161,158,153,145,156,160,31,
+158,103,146,90,42,26,75,134,105,125,107,30,114,128,118,122,118,27,116,118,
+154,171,118,31,14,111,158,248,38,21,146,121,5,144,150,144,141,146,27,161,
+168,100,64,171,31,168,72,174,251,1,155,62,8,112,87,131,111,99,26,85,166,107,
+184,182,165,174,197,173,137,163,128,207,30,153,176,149,158,179,217,8,204,
+247,15,155,180,185,26,183,112,171,104,107,109,109,106,125,146,121,150,124,
+30,169,98,139,139,122,26,117,117,82,106,76,30,130,122,133,127,137,135,138,
+137,136,133,136,132,130,204,120,213,112,218,8,220,112,99,199,113,27,138,136,
+138,137,134,31,14,162,248,70,248,234,21,168,41,79,150,72,27,63,98,116,98,
+119,150,120,164,119,31,155,126,146,135,203,100,81,125,110,123,106,103,8,101,
+96,121,87,73,26,251,38,227,40,247,22,247,20,232,242,247,33,214,111,204,88,
+185,30,108,167,117,153,251,0,203,8,77,175,131,146,153,26,151,153,146,163,
+190,189,125,89,247,19,30,251,69,37,21,195,165,70,251,37,251,22,110,67,88,
+87,110,211,247,23,247,34,165,210,192,31,14,70,64,29,14,56,247,15,249,74,21,
+83,90,5,134,136,137,134,135,26,114,182,104,211,103,30,92,77,118,109,119,98,
+8,106,75,122,70,71,26,70,156,80,170,103,30,108,165,182,123,198,27,159,167,
+141,142,164,31,140,150,152,140,142,27,169,156,124,113,107,116,114,111,125,
+123,144,146,126,31,159,106,131,142,120,27,103,113,116,106,101,171,115,191,
+235,217,215,234,213,103,179,73,132,125,138,138,127,31,110,138,5,80,110,179,
+221,239,159,226,189,247,1,31,132,165,154,137,161,27,210,184,169,187,172,115,
+162,103,94,96,114,83,86,31,92,173,118,166,165,26,150,143,148,151,151,30,14,
+211,82,29,14,165,247,159,249,38,21,68,76,96,67,104,31,118,95,125,52,47,26,
+251,45,164,53,199,87,30,114,167,180,125,180,27,180,179,154,164,166,31,203,
+199,168,229,247,35,26,247,41,116,224,82,196,30,167,111,98,155,96,27,55,251,
+175,21,140,241,145,202,152,177,8,165,147,163,159,161,27,171,164,112,93,150,
+31,148,101,144,87,53,26,97,4,138,251,8,136,72,135,107,8,74,129,118,110,102,
+27,108,116,162,184,127,31,128,177,136,188,138,247,46,8,14,251,78,79,10,14,
+198,247,201,247,190,21,188,166,170,174,154,27,143,145,136,136,142,31,108,
+169,147,134,162,27,169,163,166,173,175,116,159,98,89,96,111,78,97,31,105,
+90,107,89,119,102,8,247,117,168,29,247,108,7,247,29,251,103,5,127,147,146,
+135,150,27,145,146,141,142,146,31,247,5,194,130,157,5,132,127,133,137,131,
+27,125,127,149,162,125,31,102,196,5,14,134,171,22,247,31,6,247,1,247,140,
+153,79,167,48,159,85,25,101,153,148,124,148,27,142,143,140,141,142,31,215,
+189,132,155,5,135,127,131,137,132,27,101,120,168,247,5,106,31,63,247,154,
+114,224,137,147,122,175,25,183,120,112,161,102,27,96,110,105,87,98,157,113,
+168,159,153,152,163,143,31,168,144,141,143,150,27,159,151,111,251,9,169,31,
+14,210,242,248,86,21,251,111,7,138,251,6,132,61,122,39,8,133,106,137,123,
+127,26,99,159,116,176,174,165,164,172,149,135,156,133,158,30,126,175,129,
+173,134,170,8,118,160,159,130,165,27,184,177,166,194,171,31,57,7,247,73,194,
+134,159,5,137,131,134,138,135,27,116,128,159,182,31,247,217,251,17,251,202,
+7,79,119,117,111,113,27,130,131,144,147,132,31,129,153,137,152,193,26,247,
+196,7,14,90,247,92,248,28,21,204,118,139,139,117,27,130,136,138,135,128,31,
+33,98,145,120,5,141,150,142,140,142,27,161,150,121,58,164,31,235,251,194,
+5,187,6,247,24,247,172,5,164,192,148,168,169,26,180,114,169,105,107,111,111,
+107,125,145,124,148,128,30,171,102,139,139,121,26,111,123,97,89,36,30,14,
+89,247,40,249,107,21,84,95,5,133,135,135,132,133,26,123,167,115,199,104,30,
+87,105,112,97,92,26,94,165,102,190,112,30,51,75,107,88,62,26,37,209,70,241,
+153,164,141,143,162,30,143,165,149,140,149,27,173,156,121,103,108,121,118,
+113,126,135,140,154,116,31,148,124,127,143,123,27,103,113,116,108,107,168,
+117,182,228,209,212,232,214,98,185,71,130,121,137,137,124,31,137,125,123,
+138,132,27,91,109,179,204,188,150,170,177,195,31,119,189,170,131,173,27,196,
+180,169,183,172,113,159,98,94,88,120,104,91,31,120,167,132,161,172,26,174,
+145,162,158,178,30,123,172,165,133,183,27,207,178,161,178,172,114,158,94,
+93,91,124,107,84,31,104,166,125,159,161,26,151,143,146,152,153,30,14,143,
+72,10,14,191,248,4,247,248,21,77,110,114,100,144,78,247,30,29,115,150,163,
+120,180,10,126,128,146,151,133,31,132,154,138,156,206,26,217,7,140,192,143,
+157,156,162,8,242,239,252,37,6,69,136,125,134,122,109,77,251,8,24,186,124,
+174,188,171,159,193,143,25,137,84,135,104,131,98,120,55,136,131,104,114,126,
+129,24,118,122,132,125,115,26,107,165,117,178,173,163,156,173,154,30,157,
+179,152,228,143,238,141,189,24,140,145,139,152,140,159,8,14,178,247,95,169,
+21,109,168,161,129,172,27,246,225,245,247,23,192,125,190,113,178,31,197,100,
+81,168,61,27,60,76,102,79,114,31,127,109,134,107,92,26,252,62,247,14,7,248,
+80,4,246,156,182,183,196,164,76,251,31,251,10,110,69,90,116,121,153,175,115,
+30,14,187,247,161,248,99,21,251,30,140,49,48,251,33,26,251,38,227,40,247,
+22,247,19,233,242,247,32,219,112,198,79,189,30,247,47,107,5,215,7,251,179,
+109,21,193,165,69,251,35,251,23,110,67,88,86,111,210,247,26,247,33,166,209,
+193,31,14,104,248,103,248,87,21,251,203,6,69,136,126,134,121,109,77,251,8,
+24,187,124,181,199,173,154,225,138,25,183,6,114,127,122,127,122,120,123,120,
+137,130,134,81,247,30,29,114,150,163,121,180,10,127,127,146,151,134,31,132,
+153,137,158,205,26,217,7,140,192,143,156,156,163,8,247,43,6,14,162,44,29,
+14,247,20,247,249,251,82,21,247,66,7,247,27,144,237,245,247,33,26,204,117,
+191,94,183,30,179,97,89,161,90,27,98,102,123,112,118,31,121,116,131,104,82,
+26,251,179,7,122,144,131,143,130,146,8,103,170,121,203,239,26,247,27,163,
+200,201,159,30,157,7,84,137,107,129,104,114,8,77,95,103,67,60,26,67,168,72,
+190,92,30,178,105,177,123,204,132,8,251,66,7,239,248,106,21,240,144,162,161,
+156,157,123,114,152,30,154,108,147,95,79,26,77,130,85,122,98,30,133,125,128,
+125,123,127,129,131,130,135,119,134,8,14,105,248,78,248,86,21,251,23,6,48,
+251,87,5,247,38,93,94,198,75,27,100,112,114,104,107,162,113,168,148,147,142,
+148,151,31,148,151,145,142,146,27,153,153,127,117,154,31,152,118,144,124,
+167,49,251,85,252,14,24,247,23,6,247,10,247,139,179,251,26,195,251,16,159,
+140,25,142,143,141,141,143,31,224,189,131,161,5,135,127,134,138,129,27,80,
+104,194,247,73,82,31,14,247,84,248,50,248,85,21,34,6,138,251,249,50,146,110,
+173,144,231,25,247,28,7,196,120,180,113,135,133,137,137,132,30,42,99,145,
+118,5,142,148,143,140,143,27,163,145,121,56,31,42,7,134,251,17,228,56,247,
+26,142,138,251,61,24,247,2,247,62,6,208,149,166,153,175,185,8,183,195,163,
+216,229,26,244,103,204,80,108,118,116,107,114,153,118,164,128,30,171,125,
+140,138,150,126,8,153,122,146,120,113,26,84,114,86,102,113,30,115,123,109,
+129,97,134,8,14,247,127,247,81,248,93,57,10,65,247,173,248,93,21,65,79,109,
+78,92,31,100,89,117,73,74,26,79,159,84,174,103,30,112,165,175,127,193,27,
+156,156,140,141,155,31,142,155,153,140,146,27,164,154,123,111,105,119,113,
+113,130,130,142,146,132,31,163,111,132,142,117,27,105,113,114,108,104,172,
+113,182,225,208,214,232,206,104,183,86,132,122,138,137,123,31,137,127,126,
+138,128,27,87,118,178,234,247,0,171,205,192,158,151,130,117,147,31,87,159,
+149,129,173,27,175,163,163,176,193,95,175,73,31,14,242,247,116,247,106,21,
+189,117,173,105,126,127,136,130,117,30,67,108,146,118,5,141,146,143,140,143,
+27,162,149,120,94,31,93,7,55,198,86,234,226,204,181,224,182,30,164,189,150,
+185,145,231,8,196,239,82,6,133,222,132,172,121,185,8,214,108,64,188,50,27,
+251,1,61,67,40,65,184,75,215,105,31,185,119,172,130,225,125,8,251,95,117,
+67,78,97,120,180,226,30,247,37,247,148,21,251,32,160,89,175,218,26,195,176,
+184,186,175,166,117,95,157,30,154,102,145,98,143,46,8,14,247,20,248,15,124,
+21,188,144,171,150,173,162,8,204,184,178,219,227,26,220,106,210,82,181,30,
+102,166,103,150,79,142,141,167,142,160,142,156,8,151,197,140,145,156,26,182,
+105,168,90,89,104,109,95,130,140,130,141,129,30,149,97,145,97,140,106,8,251,
+23,132,48,37,251,34,26,251,31,222,49,247,27,132,30,136,251,68,5,247,32,6,
+251,29,247,98,21,90,152,108,225,247,11,26,245,173,225,190,158,30,247,18,140,
+21,191,122,171,56,251,10,26,251,4,109,61,89,118,30,14,247,127,207,248,130,
+21,106,96,247,8,145,5,70,75,97,43,43,197,10,183,171,157,182,169,31,172,186,
+158,197,189,26,247,3,96,229,64,184,30,171,85,58,157,44,27,137,127,139,138,
+123,31,247,19,252,16,21,167,199,151,184,182,26,187,115,170,103,103,113,106,
+93,90,151,87,163,90,30,104,120,110,118,107,27,82,109,199,247,4,223,153,210,
+162,173,31,146,149,151,150,160,156,8,140,157,154,139,148,27,208,203,122,106,
+194,31,204,100,175,69,50,26,52,94,77,76,102,112,157,176,116,30,14,251,78,
+79,29,251,24,248,133,196,10,247,49,22,206,29,14,162,247,77,249,27,196,10,
+247,68,22,107,113,113,108,107,165,113,170,171,165,165,171,170,113,165,108,
+31,251,190,251,149,61,29,14,251,55,247,40,248,125,21,176,6,142,153,141,152,
+141,148,8,156,208,139,141,155,26,165,121,159,247,26,29,144,111,5,14,251,55,
+218,248,239,193,29,247,69,197,29,32,98,21,174,6,143,159,142,151,141,26,155,
+205,139,141,154,26,164,122,158,115,116,122,120,114,123,139,137,155,74,30,
+141,130,140,130,141,131,8,14,69,29,92,247,108,21,141,149,145,174,5,157,224,
+140,143,159,26,170,119,161,111,112,118,117,109,126,142,117,143,119,30,147,
+100,144,116,140,132,141,130,140,133,142,123,8,14,247,195,244,47,10,247,228,
+251,38,21,166,6,182,165,119,90,160,31,148,117,142,158,29,192,88,148,123,10,
+172,247,95,5,113,6,117,251,3,68,83,251,10,140,8,101,6,94,124,156,193,141,
+31,14,248,49,237,47,10,247,224,251,39,21,247,149,251,114,6,113,29,247,208,
+159,149,29,191,137,155,120,137,81,8,251,97,251,149,247,97,7,137,198,154,157,
+150,29,192,137,154,247,55,29,165,233,47,10,248,56,252,81,88,10,14,247,174,
+207,47,10,248,36,247,99,21,50,73,115,84,74,31,65,76,102,53,251,5,26,251,97,
+247,26,251,28,247,94,247,88,247,28,247,30,247,93,244,110,217,77,203,30,204,
+75,60,170,36,27,142,104,21,247,0,199,251,0,251,84,35,121,55,103,82,31,98,
+115,91,112,94,27,92,93,167,185,113,31,107,193,125,210,244,26,247,15,159,217,
+186,196,228,10,247,197,203,47,10,249,110,252,101,21,171,247,79,5,113,6,78,
+124,118,121,81,27,251,28,6,222,168,178,163,182,186,8,184,189,164,202,204,
+26,213,107,214,83,192,30,195,80,57,167,251,1,27,37,56,111,83,81,31,83,87,
+107,63,64,26,69,167,73,190,88,30,180,97,175,118,218,112,8,251,28,6,81,118,
+157,200,124,31,113,6,171,251,79,5,247,164,245,6,104,161,122,153,122,160,8,
+102,186,117,219,229,26,247,58,203,230,247,8,247,7,203,47,251,57,60,121,64,
+111,94,30,120,109,119,121,96,112,8,33,7,14,248,5,247,19,47,10,248,113,251,
+45,21,251,26,247,163,5,129,161,137,144,146,26,155,155,148,167,30,154,159,
+251,180,119,150,6,173,135,160,247,27,29,141,247,11,10,110,119,247,228,159,
+110,100,29,247,72,7,247,27,247,166,176,214,150,150,185,145,25,159,251,82,
+119,159,7,171,159,123,114,122,134,124,122,105,31,14,32,247,248,87,29,251,
+151,249,239,194,29,247,97,22,205,29,14,248,67,65,29,251,143,247,216,21,205,
+10,247,111,22,205,10,14,201,247,189,248,165,21,141,147,145,167,5,154,206,
+140,144,155,26,165,121,158,114,115,121,119,113,128,141,125,143,120,30,150,
+96,141,128,141,129,139,137,142,126,25,247,175,61,59,10,70,64,29,251,32,248,
+21,21,143,161,142,151,141,26,155,208,140,142,155,26,164,121,159,114,115,121,
+120,113,122,140,133,155,74,30,142,119,142,127,140,135,8,14,211,82,29,167,
+248,165,21,176,6,143,161,142,151,141,26,155,208,140,141,155,26,166,121,158,
+114,115,121,119,113,128,141,124,143,121,30,146,108,144,121,140,134,8,14,251,
+78,79,10,66,248,15,21,177,6,143,161,142,151,141,26,155,207,140,142,156,26,
+165,120,158,115,115,121,119,114,245,29,14,143,72,10,120,247,2,247,15,10,210,
+139,139,155,26,166,121,158,247,26,29,140,129,141,130,141,130,8,14,247,127,
+248,0,248,165,247,15,10,209,139,140,155,26,165,121,159,115,114,121,120,113,
+245,29,251,65,59,57,10,162,44,29,247,126,247,12,21,144,162,141,151,140,26,
+155,207,140,143,155,26,164,121,159,114,115,121,119,114,127,141,124,143,121,
+30,145,113,143,125,141,129,140,135,25,141,129,139,137,142,126,8,14,251,78,
+79,29,251,61,248,89,193,29,247,100,22,207,29,52,98,21,143,158,141,148,140,
+145,8,155,207,139,139,154,26,164,122,158,115,117,121,120,115,123,140,134,
+154,76,30,142,120,142,128,135,26,14,162,44,29,246,247,86,21,109,116,226,29,
+247,108,197,29,251,19,98,21,175,6,142,156,141,147,141,148,8,153,203,140,143,
+155,26,163,122,158,116,116,122,120,115,123,140,134,154,76,30,140,130,141,
+130,141,131,8,14,68,10,247,57,248,184,249,42,21,252,141,247,12,29,120,137,
+80,8,252,102,7,113,29,247,216,6,247,46,223,202,247,9,247,20,48,209,251,57,
+117,132,139,136,93,31,247,143,247,3,7,220,142,187,89,144,47,8,168,6,251,166,
+251,43,21,140,152,152,140,149,27,222,185,246,29,247,63,148,10,247,216,6,247,
+43,226,202,247,4,191,119,179,99,170,31,111,161,111,150,82,153,76,29,247,32,
+248,209,84,10,14,247,84,249,29,249,42,21,252,164,119,186,6,184,148,119,42,
+251,113,101,251,46,64,58,31,116,118,122,131,110,27,108,6,133,251,67,5,168,
+6,155,240,182,180,224,134,8,247,190,6,234,137,187,96,147,47,8,168,247,67,
+101,6,95,130,144,168,138,31,248,127,7,137,197,155,158,191,141,8,158,6,251,
+123,252,240,21,251,181,6,228,232,177,247,44,141,247,161,8,211,247,52,7,14,
+247,63,247,173,63,29,14,248,129,248,60,247,187,21,251,91,150,10,131,119,247,
+186,159,131,100,29,247,91,7,208,29,153,114,145,126,102,29,119,125,132,126,
+120,201,10,137,195,154,157,192,141,8,147,159,251,186,119,147,6,192,137,154,
+121,169,29,161,159,251,127,119,6,210,174,116,42,217,31,204,58,251,101,247,
+39,29,247,187,159,115,7,110,123,147,154,146,145,152,153,164,31,247,26,247,
+126,5,14,171,207,249,56,21,251,92,163,7,128,10,134,139,140,130,31,99,7,141,
+153,148,139,151,152,29,5,251,13,153,218,70,247,19,27,247,42,241,216,247,5,
+236,85,199,35,159,31,225,157,184,194,154,10,14,247,174,58,29,14,247,121,51,
+29,14,247,141,248,11,22,163,10,159,252,148,98,29,205,166,30,161,194,148,200,
+246,26,247,205,247,54,252,164,150,10,120,6,14,248,84,61,10,247,174,55,29,
+247,174,248,24,67,10,247,174,249,129,249,42,21,253,100,75,10,248,164,247,
+150,252,164,7,113,29,163,10,6,14,247,7,60,29,249,9,247,70,21,47,82,69,94,
+52,27,251,7,74,242,247,76,231,154,204,173,193,31,192,172,189,168,197,27,192,
+192,116,101,176,31,164,112,151,116,154,87,8,162,247,106,116,6,104,133,130,
+127,119,27,131,139,139,155,100,31,163,77,110,146,89,27,251,80,251,32,251,
+42,251,93,251,85,247,21,251,30,247,73,247,8,240,195,239,202,31,14,247,63,
+248,43,249,6,21,182,6,220,142,187,89,144,47,8,168,247,67,252,194,156,29,247,
+228,159,110,247,44,10,247,130,248,116,57,29,14,247,255,247,250,49,29,49,10,
+247,174,164,22,248,183,6,234,137,187,95,147,48,8,168,247,67,112,6,86,142,
+125,156,141,195,8,248,85,7,137,197,154,158,125,29,252,161,251,150,248,161,
+7,78,29,6,14,247,130,248,98,235,21,141,83,123,122,86,136,8,107,119,247,221,
+159,120,6,87,142,123,156,142,195,8,248,103,7,136,197,155,158,191,141,8,158,
+159,251,200,119,150,6,75,29,14,248,238,165,22,250,170,159,120,100,29,248,
+103,64,10,248,238,165,22,249,252,6,232,141,192,91,239,10,196,8,248,85,64,
+10,247,57,247,168,70,10,14,248,122,247,179,70,10,249,29,66,21,120,100,29,
+248,103,7,78,29,119,247,208,6,14,247,161,248,27,248,199,21,137,197,155,158,
+191,141,210,29,177,252,166,6,113,29,247,216,6,247,47,222,202,247,9,247,20,
+49,209,251,58,117,132,139,136,93,31,100,4,140,152,152,140,150,27,222,184,
+246,29,247,74,188,249,56,21,251,131,161,7,148,191,148,165,162,171,8,191,175,
+198,167,209,27,206,187,114,89,173,31,172,89,152,90,141,43,8,251,2,6,53,140,
+108,168,134,224,8,117,251,160,161,6,225,145,170,169,224,27,247,2,6,138,42,
+129,90,111,91,8,78,104,84,109,63,27,45,76,180,243,70,31,104,116,5,251,15,
+219,216,92,247,15,27,247,97,247,37,247,32,247,89,247,94,251,35,247,41,251,
+88,91,103,131,120,96,31,124,105,131,136,127,27,114,124,154,170,132,31,14,
+249,10,210,22,247,208,159,120,100,29,247,126,226,7,251,98,141,247,24,251,
+26,247,93,27,247,90,247,27,247,30,247,94,242,110,218,77,203,31,203,76,58,
+171,37,27,251,0,55,100,59,73,31,97,89,118,87,131,61,8,50,247,82,6,78,29,6,
+249,32,248,253,21,246,200,247,39,10,91,235,29,216,186,197,228,10,248,69,247,
+192,21,251,96,150,10,115,119,247,213,159,120,100,29,248,106,7,137,195,154,
+157,192,141,8,158,159,251,227,6,251,40,52,71,251,7,54,180,89,235,105,31,251,
+9,251,96,103,76,119,120,106,135,25,119,247,81,7,247,62,247,192,5,188,177,
+21,138,120,118,138,128,27,92,100,152,162,119,31,120,161,128,181,188,26,186,
+151,174,161,162,30,160,160,169,147,192,27,146,163,139,138,157,31,14,163,247,
+139,249,5,21,247,182,247,71,109,6,134,45,89,88,57,142,8,251,251,118,158,6,
+193,137,155,120,137,80,8,252,99,7,140,82,124,121,85,137,8,120,118,247,228,
+160,106,6,85,141,124,156,141,197,8,14,247,196,248,22,249,6,21,203,6,219,142,
+188,89,144,47,8,168,247,67,252,198,251,67,168,6,144,231,187,204,29,247,123,
+247,218,6,164,191,158,144,177,27,177,160,130,117,155,31,158,113,148,96,77,
+26,38,120,76,109,129,132,146,149,143,140,144,141,144,30,145,152,140,142,148,
+26,168,118,160,109,102,116,115,101,84,182,107,212,247,15,223,230,247,27,247,
+16,63,210,251,27,87,101,131,114,72,30,14,247,74,248,255,249,56,21,116,6,108,
+133,124,124,114,27,130,127,142,145,126,31,169,71,117,145,82,27,251,87,251,
+36,251,41,251,94,251,90,247,37,251,31,247,98,247,19,220,186,247,15,223,31,
+104,162,5,35,66,72,98,41,27,67,87,164,191,104,31,106,189,126,191,137,245,
+8,247,14,6,224,170,109,53,144,31,162,247,160,116,6,135,54,108,110,53,138,
+8,251,14,6,142,228,149,184,166,186,8,199,173,190,168,212,27,204,194,115,94,
+175,31,167,105,152,109,147,82,8,162,6,14,199,248,133,249,51,21,116,6,111,
+138,129,126,119,27,132,132,140,142,133,31,170,57,109,146,90,27,251,17,49,
+60,251,1,83,163,86,179,107,31,172,113,140,138,247,2,97,236,102,139,139,161,
+126,8,170,121,159,104,103,26,77,87,97,62,73,74,166,182,101,30,101,184,121,
+178,138,185,8,113,251,130,165,6,167,147,150,150,162,27,149,147,137,131,160,
+31,117,195,183,129,183,27,200,202,159,173,184,31,182,172,163,191,200,26,197,
+117,191,99,175,30,100,173,139,139,251,15,184,47,174,139,139,117,151,8,111,
+155,121,170,170,26,195,190,178,214,197,192,116,96,179,30,167,109,152,111,
+148,91,8,162,6,14,32,59,29,32,59,29,32,59,29,143,247,38,249,22,21,172,6,192,
+137,154,120,137,80,8,252,71,7,71,119,109,93,110,116,152,155,143,140,144,141,
+141,30,159,166,142,146,159,26,174,107,170,102,101,108,103,95,69,216,83,237,
+210,206,169,186,175,30,163,171,146,168,209,26,248,7,7,137,198,154,158,192,
+141,8,155,159,251,223,6,14,248,143,247,218,249,4,21,247,41,252,164,6,113,
+29,247,216,6,247,38,219,202,247,9,247,20,53,209,251,50,117,128,139,136,97,
+31,247,80,7,247,27,10,158,159,252,135,98,29,204,166,30,161,195,148,200,246,
+26,247,187,164,21,140,153,152,140,148,27,215,180,84,37,48,102,87,73,102,126,
+153,180,31,14,248,142,248,146,247,210,21,251,114,7,113,29,247,216,6,247,38,
+218,202,247,9,247,21,53,209,251,50,118,134,139,135,91,31,247,80,7,137,197,
+154,158,125,29,251,97,251,137,247,97,7,137,198,154,157,247,57,10,86,142,124,
+156,141,195,8,247,114,7,248,27,158,21,140,153,151,140,149,27,214,181,83,38,
+47,101,87,73,103,126,153,180,31,14,247,196,247,247,249,6,21,204,6,220,142,
+187,89,145,47,8,168,247,67,252,195,6,134,251,67,5,168,6,143,231,188,204,29,
+247,200,159,128,100,29,247,101,7,165,182,173,150,182,27,204,160,110,48,31,
+251,18,150,10,128,119,247,194,159,126,100,29,247,42,7,239,82,186,251,14,77,
+93,129,111,74,30,14,247,174,249,130,22,159,121,7,86,142,124,157,141,197,8,
+248,103,7,137,195,154,157,243,29,121,137,83,8,252,164,251,150,248,164,7,137,
+195,154,157,150,29,191,137,155,121,137,83,8,252,103,7,141,81,124,121,86,136,
+8,120,119,247,123,6,204,142,180,88,147,44,8,154,6,153,6,147,234,180,191,204,
+135,8,14,247,174,248,28,249,56,21,251,97,251,37,251,36,251,97,251,94,247,
+36,251,36,247,94,247,95,247,36,247,36,247,95,247,92,251,37,247,40,251,90,
+31,251,68,251,216,21,247,84,147,198,239,244,27,205,187,100,60,169,31,155,
+99,147,90,144,54,8,80,4,134,51,131,95,121,95,8,70,110,92,104,73,27,251,0,
+82,231,247,80,132,31,14,248,138,248,32,247,187,21,251,91,150,10,131,119,247,
+186,159,131,6,85,142,125,156,141,195,8,247,91,7,208,29,154,112,144,129,247,
+3,29,236,141,192,93,145,46,8,169,247,67,113,6,101,140,124,148,115,179,251,
+100,247,245,24,203,220,218,236,173,161,210,140,25,159,251,126,119,161,7,165,
+156,127,119,126,131,125,121,201,10,136,195,154,156,193,142,8,147,159,251,
+186,119,147,6,192,136,154,122,169,29,160,159,251,126,119,6,211,138,172,117,
+218,42,203,58,24,251,100,247,39,29,247,186,159,115,7,110,124,147,154,146,
+144,151,153,165,31,247,27,247,126,5,14,249,72,249,42,21,251,108,114,6,204,
+135,156,131,110,26,120,125,106,115,98,30,251,0,251,73,251,10,247,119,137,
+143,137,143,136,143,25,126,162,135,151,150,26,161,154,147,179,30,164,164,
+251,220,114,6,171,137,166,121,158,106,247,71,251,217,24,251,36,7,137,66,128,
+128,61,132,8,115,247,232,163,7,61,146,129,149,137,213,8,247,72,7,247,79,247,
+196,154,162,157,150,173,143,25,14,247,174,180,247,186,21,143,81,145,110,159,
+98,8,251,12,196,245,75,247,31,27,226,225,167,190,205,31,221,200,182,230,247,
+3,26,237,105,224,75,201,30,206,69,40,179,40,27,53,56,108,85,81,31,98,101,
+118,101,114,57,247,16,129,24,156,209,157,190,159,167,8,184,171,185,163,190,
+27,182,180,122,104,176,31,192,90,170,40,251,10,26,129,139,130,138,129,30,
+135,97,21,133,57,95,42,97,112,8,120,109,105,129,106,27,42,84,216,247,50,123,
+31,14,247,81,247,148,248,202,21,137,195,154,156,192,142,8,171,159,251,221,
+119,158,6,192,136,154,122,137,83,8,252,103,7,141,81,123,120,87,137,8,120,
+119,247,199,159,129,6,86,141,124,158,141,197,8,247,108,7,159,192,167,146,
+172,27,173,164,128,119,154,31,151,123,143,120,98,26,251,28,7,141,81,124,120,
+86,137,8,128,119,247,194,159,126,6,86,141,124,158,141,197,8,247,39,7,237,
+82,189,251,5,79,101,131,110,57,30,14,248,145,249,0,126,21,248,164,7,176,141,
+155,146,155,30,156,146,150,151,149,27,145,142,136,134,31,135,7,137,132,139,
+137,133,26,109,160,118,169,171,161,164,174,184,106,170,92,101,111,121,104,
+120,30,125,112,134,109,78,26,251,165,7,251,204,248,71,5,251,86,113,6,178,
+137,161,123,166,96,8,252,59,7,70,128,108,113,134,135,143,144,140,139,141,
+140,141,30,141,146,140,142,146,26,167,117,160,108,107,117,113,101,90,172,
+107,187,176,168,157,174,157,30,153,166,144,169,199,26,248,5,7,248,24,252,
+175,5,247,121,248,111,21,48,73,74,48,49,204,73,229,232,204,203,231,230,74,
+204,48,31,138,105,21,182,164,94,62,60,115,96,95,96,115,183,218,215,164,184,
+181,31,251,22,252,64,21,247,154,208,251,154,6,14,247,7,247,159,248,219,21,
+176,151,148,190,228,197,122,105,169,30,160,114,150,114,153,76,8,163,247,89,
+252,192,115,6,205,136,159,124,140,87,8,251,105,51,108,7,227,138,5,251,121,
+7,137,87,125,128,68,132,8,115,247,245,163,7,52,142,121,151,137,194,8,247,
+120,7,238,137,175,102,152,251,5,8,164,247,224,114,6,122,251,4,104,104,43,
+140,8,14,248,74,247,123,21,203,7,247,78,247,196,154,162,157,150,173,143,25,
+164,251,107,114,7,204,135,156,131,110,26,120,125,107,114,97,30,251,0,251,
+73,251,10,247,119,138,142,5,119,175,137,146,151,26,161,154,147,178,30,164,
+164,251,219,114,6,171,138,166,120,158,106,247,71,251,217,24,111,57,97,221,
+65,7,137,66,128,128,61,132,8,115,247,231,163,7,61,146,129,149,138,213,8,213,
+222,181,7,14,247,63,62,10,84,249,131,21,208,10,177,177,247,0,29,247,111,22,
+208,10,177,177,247,0,29,14,247,174,247,158,60,10,251,120,247,173,21,107,116,
+116,106,84,201,104,238,241,202,173,195,172,116,162,106,110,116,120,114,134,
+140,132,142,125,31,140,135,140,136,136,26,123,110,125,106,107,110,153,155,
+142,139,143,140,142,30,144,155,140,143,145,26,164,116,158,109,30,14,247,32,
+248,218,84,10,251,206,247,128,21,194,6,247,31,225,5,170,159,147,149,161,26,
+165,120,156,111,120,122,130,121,123,30,14,32,247,246,87,29,251,140,249,239,
+21,208,10,178,176,247,0,29,247,71,22,208,10,178,176,247,0,29,14,247,121,51,
+29,192,249,7,21,194,6,247,31,225,5,172,160,146,147,162,26,165,120,156,111,
+119,122,130,121,123,30,14,247,130,248,128,57,29,251,95,247,5,21,123,110,125,
+106,107,110,153,155,30,140,149,5,143,152,140,146,145,26,164,116,158,109,107,
+116,116,106,84,201,104,238,242,201,173,195,172,116,162,107,110,116,120,114,
+134,140,132,143,125,30,14,249,62,163,21,96,128,153,247,15,86,31,251,110,248,
+151,5,111,6,251,109,252,173,102,47,127,125,92,130,25,115,247,91,163,7,81,
+143,117,150,165,26,152,147,166,159,188,30,154,178,5,247,112,6,173,59,150,
+107,117,26,119,126,130,105,136,30,134,127,138,137,125,31,115,247,209,7,252,
+126,247,123,21,231,247,130,238,251,130,5,206,249,34,21,76,122,110,116,78,
+27,77,109,247,19,29,111,8,103,164,179,121,192,27,193,179,159,179,165,31,155,
+165,146,163,145,189,8,14,247,31,161,62,29,247,115,179,29,111,8,103,183,10,
+247,11,247,167,248,15,21,120,115,5,247,102,7,137,196,154,156,191,142,8,147,
+159,251,196,119,158,6,192,136,154,122,247,31,29,86,136,8,120,119,247,196,
+159,131,6,86,142,125,155,141,196,8,247,91,7,158,165,5,251,116,201,247,10,
+7,211,251,19,5,152,117,146,124,132,26,124,123,130,111,30,115,119,247,186,
+159,6,105,140,133,145,103,200,251,101,247,245,24,204,219,218,237,172,161,
+211,140,25,159,251,126,119,160,7,166,156,127,118,126,132,126,119,115,31,53,
+34,5,247,12,77,7,14,247,106,247,148,247,187,21,208,29,154,113,144,128,247,
+3,29,237,141,191,93,146,46,8,168,247,67,113,6,101,140,124,149,115,178,251,
+100,247,245,24,203,220,218,236,173,161,210,140,25,159,251,126,157,10,156,
+192,142,8,147,159,251,197,119,158,6,192,136,154,122,140,10,14,247,174,247,
+148,247,209,21,247,149,251,113,6,113,29,247,34,6,233,140,191,92,239,10,195,
+8,248,86,7,137,197,154,157,192,142,8,157,159,251,207,119,158,6,191,136,155,
+121,137,81,8,251,98,251,149,247,98,7,137,198,154,157,247,57,10,86,142,124,
+156,141,195,8,14,247,77,247,174,247,151,21,238,251,73,5,145,128,143,128,130,
+26,123,123,128,113,30,124,119,247,18,6,236,142,193,92,145,46,8,168,247,67,
+113,6,93,140,124,152,91,221,251,34,247,145,24,234,247,30,204,231,162,157,
+201,146,25,159,251,116,119,151,7,170,163,119,114,122,131,121,123,115,186,
+10,155,159,251,192,119,6,189,136,167,111,196,35,247,12,251,107,24,251,5,251,
+55,5,62,85,101,107,99,27,129,119,247,121,159,120,6,101,117,247,41,10,247,
+81,248,0,247,175,21,168,148,149,142,165,149,8,251,101,150,10,107,119,247,
+221,159,120,100,29,248,103,7,137,197,154,157,192,142,8,158,159,251,200,119,
+150,6,192,136,154,121,137,81,8,251,108,7,119,130,113,130,120,135,8,247,115,
+64,251,119,7,90,150,121,167,141,205,8,247,29,7,137,197,154,157,193,142,8,
+149,159,251,194,119,152,6,192,137,154,120,137,81,8,251,40,7,39,196,91,247,
+12,154,147,140,140,150,30,251,33,214,7,14,247,130,249,72,249,22,21,159,251,
+200,119,150,7,75,29,251,101,7,141,83,123,122,86,136,8,107,119,247,74,6,210,
+131,181,90,144,61,8,168,247,27,6,159,113,7,90,142,126,151,143,180,8,248,123,
+7,136,197,155,158,191,141,8,14,247,63,162,62,29,200,21,251,27,247,46,5,157,
+124,120,148,120,27,113,119,120,114,120,149,126,169,120,31,247,31,53,5,14,
+247,174,58,29,89,247,41,21,251,26,247,46,5,157,123,121,148,120,27,113,119,
+120,114,247,11,29,247,160,248,9,248,220,21,145,178,161,152,203,140,8,164,
+251,235,114,7,193,136,159,131,150,115,141,133,140,135,141,131,8,251,40,6,
+136,251,62,5,162,6,155,231,151,148,240,142,8,252,60,7,128,138,132,137,129,
+30,130,111,119,130,80,134,8,115,247,235,140,7,247,50,148,233,207,244,26,184,
+121,179,104,169,30,104,169,106,154,72,153,251,49,147,24,247,45,157,7,247,
+3,137,150,130,155,46,8,163,6,135,247,62,5,251,70,251,140,21,168,6,240,188,
+86,251,0,44,99,90,60,95,123,155,183,31,14,247,174,248,29,249,57,21,251,98,
+251,37,251,37,251,96,251,95,247,36,251,36,247,95,247,94,247,36,247,36,247,
+95,247,93,251,37,247,40,251,89,31,251,67,251,185,21,247,58,149,201,234,238,
+27,244,199,38,251,82,147,31,122,90,127,136,112,27,118,121,146,154,121,31,
+103,171,139,139,134,142,8,152,121,119,145,117,27,112,114,132,120,93,31,247,
+236,55,21,72,127,71,119,91,30,70,110,92,104,74,27,251,5,78,246,247,91,31,
+143,159,155,141,155,27,167,152,133,111,170,31,114,167,158,130,170,27,175,
+181,151,168,202,31,14,247,211,248,74,247,106,21,251,23,247,208,5,121,182,
+135,152,154,26,161,154,149,176,141,30,144,140,152,139,153,141,8,163,251,221,
+115,7,188,131,148,132,163,85,247,143,252,223,24,165,6,247,62,248,108,5,244,
+177,156,171,157,27,148,145,135,130,143,31,109,154,158,125,167,27,172,160,
+163,177,164,135,157,130,148,31,154,125,114,148,111,27,105,105,125,116,118,
+31,111,108,106,75,116,70,8,14,171,247,165,125,21,247,29,150,225,212,244,26,
+236,85,199,35,159,30,225,156,184,195,154,10,115,251,92,163,6,128,10,135,139,
+140,129,31,99,7,141,160,139,139,153,152,29,151,251,7,219,65,247,7,138,25,
+103,58,150,166,10,136,140,139,139,137,140,123,102,24,126,175,166,134,172,
+207,10,247,223,247,136,249,6,21,252,166,7,113,29,247,197,159,131,100,29,247,
+91,7,208,29,153,115,145,125,102,29,118,126,132,125,120,117,31,251,60,251,
+97,5,247,88,7,137,210,151,156,195,142,210,29,14,248,16,121,21,138,151,144,
+139,148,27,208,198,157,175,193,31,171,161,161,160,184,188,109,164,24,122,
+10,182,121,101,182,30,182,101,162,105,174,63,85,29,82,90,150,91,27,251,92,
+251,41,251,45,251,98,251,75,247,5,251,26,247,70,110,31,102,57,88,29,247,130,
+248,98,215,21,142,98,126,127,90,136,8,113,251,47,168,6,143,216,182,189,210,
+147,8,247,73,159,108,6,86,142,123,156,142,195,8,248,103,7,136,197,155,158,
+191,141,8,158,159,251,200,119,150,6,247,37,10,120,88,107,131,156,10,149,159,
+251,194,190,10,187,149,166,214,30,14,143,248,93,214,21,119,124,137,137,130,
+27,124,133,153,175,31,247,123,7,180,128,171,119,158,30,160,115,94,153,91,
+27,37,51,83,74,106,170,110,175,176,170,164,168,150,134,149,126,151,31,129,
+150,137,143,147,26,158,161,153,170,179,154,118,84,30,68,7,86,119,97,120,102,
+115,8,79,102,112,100,89,26,87,182,98,193,177,184,164,181,178,30,95,149,168,
+114,183,27,182,178,164,183,163,31,251,81,183,21,117,115,127,132,123,27,118,
+126,158,168,185,171,181,193,163,31,14,143,248,61,249,59,21,124,131,126,135,
+102,27,107,6,92,96,136,134,119,31,87,126,98,102,111,82,8,108,73,116,251,6,
+46,26,50,161,65,182,87,30,98,173,191,113,187,27,189,197,167,180,175,31,176,
+181,159,200,207,26,247,23,53,239,251,5,66,85,101,60,102,30,153,247,41,189,
+198,247,4,140,8,168,6,224,136,189,180,159,227,8,251,90,251,149,21,161,160,
+121,113,148,31,148,111,143,104,75,26,251,57,228,29,183,196,248,88,21,119,
+7,168,155,117,102,137,31,251,187,7,141,103,123,118,110,138,8,119,247,120,
+7,247,3,203,183,216,196,105,175,65,160,31,194,155,169,174,188,26,179,116,
+172,98,161,30,155,109,108,145,89,27,102,251,130,21,175,152,136,131,152,31,
+161,125,151,111,102,26,82,115,107,96,117,132,146,163,30,247,243,4,197,137,
+164,115,82,26,86,113,108,95,137,133,139,140,134,30,14,97,248,20,248,88,21,
+251,219,118,6,168,155,117,103,137,31,251,186,177,10,247,228,177,7,211,138,
+174,103,142,64,8,160,6,14,149,248,106,176,21,125,6,110,140,123,160,141,175,
+8,247,170,7,176,137,155,160,167,27,160,252,4,118,152,7,177,150,123,82,251,
+42,113,38,88,86,31,125,125,128,135,121,27,124,6,135,251,40,5,159,6,142,216,
+176,175,215,138,8,247,80,6,215,140,176,104,142,61,8,159,6,251,74,247,41,21,
+251,77,6,196,203,163,238,141,247,65,8,181,241,7,14,87,248,36,247,125,21,137,
+202,131,175,116,179,8,195,107,88,172,86,27,86,86,108,88,105,31,108,94,124,
+83,71,26,62,159,83,180,100,30,108,170,183,122,183,27,214,202,187,223,176,
+31,114,151,5,90,247,10,29,176,21,238,140,163,193,242,10,55,8,14,247,121,247,
+155,22,247,90,159,6,114,144,126,159,141,247,20,29,156,110,141,136,133,26,
+130,130,134,123,30,131,119,247,102,159,6,115,140,138,247,31,10,198,210,156,
+149,192,140,25,159,251,65,119,160,7,154,149,132,127,130,134,130,185,29,251,
+90,119,7,164,135,152,118,138,105,8,251,21,7,251,16,247,30,5,127,152,134,222,
+29,138,155,129,198,68,182,89,24,251,37,251,126,112,95,138,138,115,138,25,
+119,247,103,159,131,7,122,131,144,148,144,144,150,152,161,31,222,247,31,154,
+121,5,251,6,7,140,105,127,119,113,134,8,14,45,195,247,212,21,247,7,29,76,
+119,118,82,31,182,10,5,54,159,189,99,224,27,247,3,216,192,215,203,99,181,
+63,156,31,202,155,171,177,153,10,14,219,46,10,14,219,52,29,14,204,247,229,
+248,51,21,251,228,7,141,103,124,118,110,137,8,119,247,102,159,7,201,29,175,
+137,155,161,224,29,54,136,84,132,109,30,109,133,128,122,112,29,180,145,188,
+247,16,26,247,49,7,14,247,77,248,77,248,88,21,41,251,154,35,247,154,5,251,
+56,119,6,167,138,155,118,137,102,8,251,186,7,141,103,124,118,110,137,8,119,
+247,12,159,7,111,140,123,161,141,175,8,247,161,7,247,31,251,240,5,157,6,247,
+21,247,236,5,251,157,7,102,141,122,117,110,27,119,247,103,159,7,110,141,124,
+160,141,175,8,247,186,7,137,175,155,161,167,140,8,159,7,14,219,247,237,247,
+150,21,251,6,247,7,6,186,29,251,186,7,141,102,218,10,242,29,113,136,8,119,
+247,97,159,7,111,140,123,161,141,175,8,247,186,7,137,175,154,161,168,140,
+8,159,251,97,119,7,165,136,153,118,137,104,8,14,143,247,144,248,97,21,251,
+9,53,38,251,28,71,163,75,181,97,31,103,174,192,115,184,27,192,196,166,181,
+176,31,176,181,159,200,207,26,247,24,53,238,251,6,30,138,100,21,161,160,121,
+113,148,31,149,111,142,105,76,26,251,59,228,29,219,247,124,248,51,21,247,
+4,251,228,6,141,103,123,117,110,138,8,119,247,103,159,7,201,29,176,137,155,
+160,168,27,160,252,84,118,7,168,155,117,103,137,31,251,186,7,184,10,247,103,
+159,7,110,140,123,161,141,175,8,14,199,247,134,176,21,107,161,165,124,175,
+27,174,176,159,172,166,31,173,183,155,195,218,26,247,32,79,238,55,104,113,
+124,104,111,30,185,116,7,251,40,101,5,118,149,7,165,133,150,122,138,106,8,
+252,62,7,104,141,122,118,111,27,131,119,247,127,159,129,6,106,137,121,159,
+141,177,8,248,32,4,172,140,146,149,155,30,154,149,153,148,153,27,174,152,
+94,251,15,251,28,129,96,107,117,116,160,167,129,31,14,87,248,18,247,17,21,
+101,109,108,121,106,27,71,84,232,247,6,222,168,199,180,159,153,124,117,140,
+31,140,104,140,131,149,120,8,113,152,158,126,165,27,172,164,164,173,207,71,
+192,52,251,8,56,37,251,36,251,27,211,49,247,1,207,200,179,217,186,31,14,134,
+247,29,22,247,109,159,6,107,123,159,178,141,31,247,228,156,7,210,174,103,
+63,143,31,159,6,129,247,41,5,252,35,6,129,251,41,5,159,6,214,142,175,176,
+210,27,156,251,228,6,140,100,124,120,107,138,8,14,143,56,10,14,247,88,248,
+44,249,34,21,251,59,118,6,167,155,117,104,137,31,251,51,7,172,108,117,150,
+103,27,46,73,40,251,30,251,33,202,46,233,172,167,150,163,169,31,32,7,141,
+104,123,117,111,138,8,119,247,103,159,7,109,123,161,175,141,31,246,7,115,
+170,166,128,172,27,233,202,233,247,32,247,30,73,238,46,104,113,126,108,111,
+31,99,4,155,159,155,146,155,27,185,160,88,251,8,251,21,116,83,86,123,126,
+144,151,125,31,251,17,22,127,125,126,134,123,27,86,116,195,247,20,247,8,160,
+191,185,155,156,131,124,158,31,14,143,247,104,247,56,21,198,44,5,150,121,
+142,132,133,26,125,124,133,115,141,30,138,119,247,120,159,130,6,120,140,137,
+140,109,186,251,16,247,89,24,221,247,2,172,184,153,149,176,140,25,159,251,
+37,119,7,165,135,147,133,124,26,130,131,122,128,125,30,85,67,85,226,5,129,
+156,136,144,147,211,29,184,68,239,251,52,24,57,251,2,104,91,121,127,96,136,
+25,119,247,54,159,7,126,140,132,139,137,140,8,125,142,130,148,149,26,148,
+145,152,151,156,30,14,219,248,162,176,21,127,6,109,138,122,160,141,177,8,
+247,170,217,29,251,98,215,10,137,173,152,160,165,143,8,159,251,97,174,10,
+103,141,123,117,110,27,118,247,216,7,215,141,178,103,142,61,8,159,6,14,247,
+240,249,151,176,21,127,6,105,126,158,186,141,31,247,162,7,137,176,154,159,
+168,141,8,159,251,97,74,10,248,184,7,214,140,177,103,142,62,8,159,6,14,226,
+189,248,88,21,247,2,29,251,229,167,10,124,127,139,137,119,31,247,5,217,29,
+7,95,251,118,173,10,247,177,229,71,29,248,72,72,21,159,7,109,239,29,169,140,
+8,159,251,103,119,7,167,138,155,117,137,103,8,251,186,7,141,103,123,117,111,
+138,8,119,7,14,172,194,71,29,14,75,247,25,247,112,21,247,38,6,137,83,136,
+117,131,112,8,95,125,106,115,93,27,81,100,172,207,116,31,109,130,5,41,166,
+199,88,227,27,247,13,228,239,247,27,247,26,52,241,251,7,113,119,134,126,110,
+31,133,126,132,137,130,27,125,129,147,151,137,31,121,6,132,251,42,5,163,6,
+218,158,175,177,193,27,175,167,119,104,153,31,150,111,142,120,143,76,8,251,
+39,6,14,247,160,247,119,247,151,21,247,6,7,137,175,154,161,168,129,10,110,
+141,124,160,141,175,8,247,33,195,7,140,90,150,99,160,102,8,76,174,206,98,
+204,27,191,197,166,181,175,31,176,181,159,200,207,26,247,25,54,237,251,7,
+32,62,62,251,17,122,30,247,92,247,56,21,162,160,121,113,148,31,148,111,143,
+105,75,26,251,59,120,82,85,98,121,187,245,247,75,155,196,189,30,14,184,247,
+213,247,92,21,251,13,7,141,103,124,118,110,137,8,119,247,101,159,7,110,141,
+124,159,141,176,8,247,186,7,175,137,155,161,167,27,160,251,131,7,251,0,74,
+91,60,82,172,100,203,120,31,60,251,24,114,94,127,128,119,137,25,119,247,38,
+7,247,5,247,92,5,164,247,105,21,251,70,7,138,127,133,139,133,27,71,111,166,
+204,201,165,164,204,31,14,32,247,88,248,50,21,247,54,6,149,247,43,5,118,6,
+136,62,103,103,66,138,8,251,103,118,6,169,155,117,102,137,31,251,183,7,102,
+141,123,117,109,27,118,247,113,160,135,7,108,123,161,176,141,31,14,180,247,
+105,249,34,21,251,66,119,146,6,168,136,154,119,137,104,8,119,72,102,206,252,
+77,7,178,10,247,154,7,175,160,166,163,159,27,180,155,61,251,87,251,80,122,
+66,96,132,135,143,146,31,140,149,5,141,148,140,146,143,26,167,120,159,113,
+107,118,117,105,95,174,111,194,247,19,222,247,36,247,114,247,60,88,239,54,
+94,107,122,89,92,30,247,17,247,33,176,251,33,7,14,75,247,191,247,112,21,176,
+251,39,7,247,9,144,167,187,202,27,193,174,101,60,159,31,163,6,132,247,42,
+5,121,6,127,137,129,131,124,27,131,132,141,145,126,31,152,110,119,144,113,
+27,251,7,52,37,251,26,251,27,228,39,247,12,228,198,190,237,167,31,109,148,
+5,70,115,101,107,81,27,93,106,163,183,125,31,130,166,137,162,137,194,8,14,
+32,247,215,248,100,21,121,6,121,138,129,127,125,27,132,129,142,147,117,31,
+151,108,128,141,118,27,62,78,82,68,82,172,91,207,100,31,222,91,139,139,158,
+121,8,149,129,145,125,126,26,109,107,113,103,83,81,188,205,120,30,123,6,147,
+251,42,5,153,6,160,147,147,146,155,27,145,145,138,136,145,31,120,184,158,
+134,168,27,218,204,200,213,199,105,187,68,179,31,48,190,139,139,126,151,8,
+131,148,133,152,152,26,167,166,161,174,189,187,98,71,167,30,152,6,14,251,
+110,247,98,112,10,69,248,217,21,101,108,109,101,101,169,108,177,177,169,170,
+177,176,108,170,103,31,14,251,55,247,143,248,88,21,251,71,118,149,6,168,140,
+156,117,137,102,8,251,232,7,110,7,141,109,5,142,83,139,136,131,26,112,132,
+123,128,132,135,147,151,143,139,142,140,142,30,140,156,5,170,116,163,111,
+110,114,112,106,93,183,109,208,225,192,191,226,30,64,249,71,21,99,107,108,
+100,99,170,107,179,177,171,171,178,178,108,171,101,31,14,247,176,247,191,
+22,247,119,6,247,2,199,183,220,227,74,188,251,11,123,135,139,137,113,31,247,
+5,7,176,137,155,160,224,29,55,136,83,132,109,30,110,133,128,121,112,29,179,
+145,189,247,16,26,247,49,238,251,229,7,141,103,124,119,110,137,8,247,59,247,
+98,173,10,247,193,247,243,247,113,21,251,35,167,10,125,132,139,137,113,31,
+247,5,7,137,176,247,33,29,167,137,155,118,137,103,8,251,7,251,6,247,7,7,186,
+29,251,187,7,141,103,218,10,173,8,247,35,7,247,131,144,21,156,6,188,164,106,
+72,80,117,107,99,117,132,147,163,31,14,199,173,248,155,21,206,252,77,6,178,
+10,247,146,7,188,165,157,156,166,27,161,150,118,94,31,251,146,7,140,106,128,
+120,113,133,8,119,247,95,159,7,110,141,124,159,141,175,8,247,128,7,233,99,
+192,67,98,103,116,90,99,30,247,22,247,62,176,251,62,237,251,66,119,146,7,
+168,136,154,119,137,104,8,119,72,7,14,219,203,248,88,21,174,10,103,141,123,
+117,110,27,118,234,7,216,141,178,103,142,61,8,159,6,142,217,178,175,216,137,
+8,234,160,6,110,123,160,176,141,31,247,16,29,251,97,215,10,138,173,151,159,
+165,144,8,159,7,14,143,247,143,248,99,21,251,17,43,36,251,25,251,32,231,38,
+247,21,247,19,232,240,247,30,247,29,45,240,251,18,31,216,251,144,21,251,44,
+135,123,96,82,27,82,119,189,247,37,31,185,4,142,7,247,20,142,159,184,194,
+27,168,157,125,106,152,31,147,118,143,102,142,68,8,14,207,205,248,68,21,164,
+135,153,118,137,105,8,64,7,59,187,101,241,166,159,142,149,169,30,251,6,7,
+141,103,123,117,111,138,8,133,119,247,108,159,6,157,29,155,214,10,181,31,
+229,7,137,174,153,159,165,143,8,159,251,92,7,14,247,240,248,187,248,88,21,
+74,10,249,49,160,7,111,123,160,176,141,31,247,186,7,137,176,154,159,168,141,
+8,159,7,14,247,160,247,139,22,247,90,159,6,189,10,135,133,26,130,131,134,
+122,30,130,226,10,101,140,125,148,114,179,251,22,198,29,154,149,131,128,167,
+29,251,90,119,7,164,134,151,120,138,105,8,251,22,7,251,16,247,30,5,128,152,
+133,222,29,156,127,69,198,31,182,90,251,38,251,126,113,95,137,138,116,138,
+25,119,247,102,159,131,7,122,131,144,148,144,143,148,154,163,31,222,247,31,
+153,120,5,251,5,7,140,104,127,120,114,134,8,14,96,247,167,247,50,21,82,247,
+60,5,121,200,139,139,151,170,10,251,87,238,29,104,143,126,154,176,26,247,
+103,7,196,247,95,170,243,154,162,234,10,139,139,122,82,31,14,77,173,247,110,
+21,140,77,148,102,162,99,8,83,171,189,106,193,27,191,192,170,190,174,31,169,
+184,154,194,208,26,216,119,195,98,178,30,170,108,96,156,94,27,64,75,91,55,
+104,31,163,127,5,188,163,166,159,181,27,205,183,75,35,142,31,141,102,21,40,
+138,116,85,96,27,119,122,155,163,133,31,132,163,138,146,138,221,8,14,199,
+248,164,162,21,105,141,125,156,179,26,247,135,7,223,87,193,59,87,103,120,
+82,88,30,247,167,251,80,115,7,183,131,146,132,140,98,8,252,136,7,138,97,131,
+130,96,131,8,116,247,128,162,7,104,144,126,154,175,26,247,154,7,142,146,149,
+148,149,30,161,161,163,151,161,27,173,156,112,84,31,251,129,7,138,102,126,
+124,107,135,8,116,247,122,7,14,32,247,91,247,140,21,247,58,177,7,211,138,
+174,104,143,64,8,159,6,129,247,40,5,251,219,118,6,168,155,117,104,137,31,
+251,17,84,95,194,251,17,177,10,247,17,232,183,7,14,96,247,191,145,21,235,
+7,196,247,95,171,244,153,161,234,10,138,137,123,84,31,91,251,59,82,247,61,
+5,121,200,139,139,150,170,10,56,63,88,215,78,238,29,103,143,127,154,176,26,
+203,220,190,7,14,87,248,36,247,124,21,137,201,131,175,116,178,8,194,106,89,
+172,86,27,86,86,108,89,105,31,108,94,124,84,72,26,62,159,84,180,99,30,109,
+170,183,122,183,27,214,203,187,222,175,31,114,152,5,89,247,10,29,175,21,238,
+140,163,192,242,10,56,8,251,33,248,15,21,206,10,247,68,22,206,10,14,219,46,
+10,131,247,102,21,140,136,5,136,7,131,7,117,118,125,105,105,118,153,161,142,
+139,141,140,142,30,140,154,5,161,121,155,114,113,121,121,112,92,199,104,218,
+247,24,10,117,30,14,97,197,248,66,21,140,6,141,6,140,6,140,6,166,138,150,
+127,138,112,8,251,221,7,111,128,128,113,138,30,134,118,247,108,160,128,6,
+113,140,128,150,167,26,247,242,143,7,144,6,144,6,143,6,220,174,108,57,149,
+31,162,6,131,247,45,5,251,219,6,247,17,203,21,247,46,237,5,160,153,148,152,
+156,26,159,126,151,117,124,131,134,120,120,30,251,39,251,42,5,14,251,110,
+247,99,112,10,251,49,248,216,21,107,110,109,106,103,167,110,172,175,166,167,
+174,175,111,168,104,31,247,69,22,107,111,109,106,103,166,110,173,174,167,
+167,174,175,110,168,104,31,14,219,52,29,137,199,21,247,46,237,5,160,152,148,
+152,155,26,159,126,151,118,123,130,134,121,121,30,251,39,251,41,5,14,143,
+56,10,124,247,148,21,140,131,139,138,137,26,117,118,125,106,105,118,153,161,
+30,147,7,140,146,139,142,144,26,160,121,156,114,114,121,121,112,92,199,104,
+217,247,24,10,115,30,14,143,248,105,202,21,129,129,5,136,136,137,138,134,
+27,125,132,147,155,31,247,148,7,222,65,190,251,12,251,3,65,89,66,98,162,115,
+179,179,166,162,173,153,134,151,126,155,30,131,149,136,145,145,26,159,166,
+155,174,196,164,113,79,30,67,7,251,10,103,92,121,103,114,8,96,109,119,106,
+97,26,79,184,95,203,195,184,159,188,193,30,89,149,161,120,187,27,182,169,
+154,180,176,31,251,83,195,21,108,112,120,128,115,27,109,119,166,178,195,180,
+180,218,160,31,189,248,72,21,76,122,111,116,78,27,77,108,247,19,29,110,8,
+104,164,179,121,192,27,194,178,159,179,165,247,42,29,87,68,29,177,248,36,
+179,29,110,8,104,183,10,98,247,92,247,158,21,118,116,247,2,10,251,97,247,
+10,10,102,141,123,118,110,27,118,247,97,160,7,113,143,126,159,141,173,8,247,
+6,7,154,157,145,129,5,251,33,181,210,7,174,80,5,155,112,142,134,133,26,130,
+130,135,122,30,132,118,247,102,160,6,115,137,141,182,113,31,251,37,247,126,
+182,189,5,209,198,156,150,192,27,159,251,65,119,159,7,155,148,132,127,131,
+133,128,128,127,31,78,71,5,219,97,7,14,177,151,248,87,21,247,10,10,184,10,
+247,97,159,7,189,10,134,134,26,130,130,134,123,30,131,226,10,100,140,126,
+148,114,179,251,23,198,29,155,148,132,127,167,29,7,14,169,247,186,247,150,
+21,251,6,247,7,6,138,173,152,247,33,10,138,154,118,137,103,8,251,186,7,141,
+103,124,117,110,138,8,119,247,97,159,7,113,142,126,160,140,242,29,112,136,
+8,119,205,7,238,140,190,100,145,58,8,168,247,49,113,6,95,140,120,155,141,
+172,8,247,177,7,137,175,155,160,167,140,8,159,251,98,119,7,166,136,152,119,
+138,104,8,14,115,247,96,247,56,21,197,44,5,149,123,143,130,133,26,125,124,
+133,116,141,30,138,119,210,6,238,140,190,100,146,58,8,168,247,49,113,6,101,
+140,125,148,114,179,251,3,247,69,24,221,247,2,172,185,152,148,177,140,25,
+159,251,37,119,7,166,134,147,134,124,26,130,131,123,128,124,30,84,67,85,226,
+5,130,154,136,147,146,211,29,183,68,240,251,52,24,57,251,1,104,91,120,127,
+97,136,25,119,247,53,159,7,127,140,131,139,137,140,8,125,142,130,147,149,
+26,149,145,151,152,157,30,14,106,247,90,247,117,21,120,148,129,160,167,26,
+229,7,137,173,152,159,165,143,8,159,251,91,119,7,165,135,152,119,137,105,
+8,64,7,57,185,104,247,0,138,30,32,184,247,5,7,145,140,150,142,149,142,8,251,
+6,7,141,103,124,117,110,138,8,133,119,247,108,159,6,201,29,137,175,247,33,
+29,168,138,154,118,137,103,8,251,35,7,130,134,132,137,128,137,8,247,31,94,
+7,14,207,248,134,248,88,21,251,102,119,6,168,138,154,214,10,182,31,228,7,
+137,174,153,159,165,147,29,251,7,7,141,103,124,118,110,138,8,133,118,219,
+6,204,132,180,96,143,74,8,168,247,29,113,6,121,140,138,142,138,173,8,247,
+205,7,137,176,155,160,168,140,8,14,87,68,29,162,247,133,21,251,26,247,46,
+5,156,124,120,149,120,27,113,119,119,115,120,150,125,167,121,31,247,31,53,
+5,14,219,46,10,163,247,34,21,251,26,247,46,5,156,123,121,149,120,27,113,119,
+119,115,247,11,29,243,247,30,248,32,21,251,205,7,102,138,121,117,108,27,115,
+247,148,7,247,14,214,189,221,182,116,173,95,161,31,161,97,87,151,90,27,122,
+127,138,136,111,31,247,27,237,7,175,149,134,118,145,31,155,6,135,219,5,251,
+54,247,123,6,135,141,251,74,118,5,116,7,175,132,152,125,140,103,8,251,24,
+40,7,135,59,5,154,6,160,146,149,144,175,27,247,63,251,60,21,141,151,153,140,
+152,27,204,177,102,75,77,104,104,78,122,130,142,149,119,31,14,143,247,147,
+248,99,21,251,22,44,38,251,31,251,28,233,38,247,19,247,20,232,240,247,29,
+247,28,45,242,251,15,31,211,251,175,21,251,18,134,121,101,86,27,81,120,188,
+247,44,31,143,149,146,141,144,27,151,148,133,120,156,31,120,155,153,131,156,
+27,151,152,142,145,160,31,251,44,235,21,152,7,236,141,164,186,189,27,194,
+157,94,251,37,142,31,138,133,137,139,135,27,130,129,142,145,133,31,170,103,
+134,142,120,27,121,125,136,130,115,31,14,247,1,247,220,247,66,21,62,247,91,
+5,131,158,138,143,146,26,154,149,145,163,142,30,142,146,140,140,147,31,162,
+251,137,116,7,161,135,145,137,145,129,142,140,184,41,155,99,247,9,251,182,
+24,165,6,247,35,248,2,5,163,149,155,157,152,27,144,144,135,133,141,31,113,
+150,149,131,163,27,166,157,159,169,175,121,158,105,117,123,137,134,127,31,
+110,128,110,105,124,101,8,14,45,247,107,131,21,236,150,197,187,207,26,203,
+99,181,63,156,30,202,156,171,176,153,10,132,251,33,5,247,7,29,104,130,113,
+122,126,31,131,128,127,137,111,27,182,10,156,60,187,98,219,134,25,100,53,
+92,29,123,126,142,148,115,31,133,141,123,102,5,126,175,166,134,173,27,218,
+247,21,29,127,31,14,247,37,247,58,218,21,115,29,131,134,122,114,29,126,131,
+134,130,247,1,10,176,155,160,169,140,8,159,251,180,7,247,2,29,14,87,247,133,
+125,21,218,142,198,171,190,209,87,10,251,15,208,48,246,119,31,101,54,92,29,
+122,126,142,148,115,31,136,140,139,139,137,140,123,102,24,126,175,165,134,
+173,207,10,207,247,222,199,21,138,105,138,136,120,138,8,113,251,29,168,6,
+143,203,181,183,204,146,8,219,160,133,6,110,140,124,160,141,175,8,247,16,
+29,251,103,119,7,168,138,155,117,137,103,8,251,35,7,132,125,128,136,123,27,
+98,119,160,182,31,228,7,137,174,152,159,166,147,29,14,247,155,248,102,204,
+21,190,74,5,247,44,157,6,103,141,120,150,112,170,79,213,24,199,208,156,157,
+154,146,167,141,25,153,251,41,125,7,167,137,148,134,124,26,132,135,129,131,
+130,30,121,118,251,5,247,31,5,247,13,163,190,186,226,26,208,104,187,69,167,
+30,155,100,100,144,64,27,251,136,121,6,209,132,148,130,140,70,8,252,45,7,
+138,58,131,129,68,134,8,121,247,154,157,7,66,144,128,150,138,208,8,247,78,
+7,192,141,247,45,251,89,90,83,126,125,121,131,118,137,25,125,247,29,153,7,
+111,129,144,152,144,142,143,145,146,31,251,105,248,145,21,167,149,145,184,
+247,4,194,96,52,92,119,100,105,120,30,96,115,105,133,48,137,8,14,248,140,
+248,140,249,96,21,251,96,251,52,251,50,251,95,251,91,247,52,251,51,247,93,
+247,91,247,52,247,52,247,92,247,89,251,52,247,54,251,88,31,164,82,21,247,
+35,126,247,6,251,6,153,251,37,8,251,163,6,247,164,82,21,130,251,34,251,13,
+251,15,251,34,128,8,247,168,7,83,251,168,21,251,39,153,251,5,247,5,125,247,
+41,8,247,166,6,251,166,196,21,153,247,36,247,7,247,6,247,37,153,8,251,164,
+7,14,248,140,173,137,21,146,6,213,6,247,68,205,151,183,204,31,241,208,213,
+247,54,247,47,26,234,109,222,91,177,30,167,103,90,152,74,27,251,43,32,86,
+46,105,31,125,102,135,115,138,73,217,177,24,148,7,138,234,176,183,230,153,
+61,252,62,24,122,64,114,92,109,129,116,140,24,229,22,143,142,194,185,158,
+182,161,247,19,25,199,247,236,5,146,6,142,6,180,150,138,135,152,31,196,118,
+169,73,38,26,251,102,44,251,41,251,30,132,30,247,141,251,153,21,218,6,177,
+247,98,5,123,178,142,138,161,27,247,20,247,1,247,57,247,83,247,0,94,195,54,
+87,94,117,98,106,31,102,93,118,80,115,251,24,8,234,230,21,230,155,176,192,
+185,27,180,161,97,60,251,42,82,251,11,67,110,117,150,165,119,31,14,248,136,
+248,141,249,101,21,251,96,251,54,251,50,251,91,251,93,247,52,251,53,247,91,
+247,91,247,53,247,53,247,91,247,87,251,53,247,56,251,84,31,127,82,21,247,
+64,247,28,251,25,251,59,251,62,251,26,251,27,251,61,251,59,251,27,247,27,
+247,60,247,56,247,27,247,30,247,54,31,14,215,181,22,247,11,6,185,247,53,158,
+204,190,220,197,193,25,166,168,159,152,152,27,143,142,136,134,135,138,133,
+137,133,31,136,132,138,135,138,26,76,251,117,5,128,97,133,110,121,26,99,163,
+115,178,186,182,172,221,199,30,96,169,131,127,137,135,131,129,25,136,134,
+133,132,137,136,8,130,133,135,136,135,27,136,137,141,143,142,140,144,141,
+145,31,141,144,141,144,140,145,199,247,110,24,148,172,142,160,162,26,192,
+111,170,91,99,105,121,98,100,30,91,89,137,137,132,131,127,128,25,177,247,
+29,247,45,217,160,218,251,44,60,180,247,31,251,93,112,125,96,5,144,143,139,
+140,142,31,140,151,149,140,143,27,155,149,131,127,130,139,137,128,98,31,118,
+61,32,82,120,60,247,0,195,5,14,248,7,248,29,249,148,21,251,51,116,54,76,45,
+26,71,178,69,199,98,30,188,106,194,124,245,130,130,251,23,108,50,92,102,8,
+194,251,25,113,147,82,27,75,90,108,98,87,216,96,234,200,187,152,176,209,31,
+106,225,204,123,193,27,198,203,169,185,177,31,157,160,150,159,158,182,103,
+156,24,45,98,86,100,55,27,90,92,147,160,74,31,231,247,1,173,216,146,247,15,
+8,247,63,209,229,229,239,26,213,76,200,62,58,66,82,50,105,30,115,75,129,78,
+137,34,58,145,102,146,104,155,8,77,168,96,196,190,26,218,217,202,247,17,161,
+30,247,54,251,198,21,148,247,9,148,193,158,195,8,193,158,171,167,179,27,182,
+167,108,91,91,117,90,98,94,31,101,98,104,115,76,116,8,251,128,251,245,21,
+117,93,106,132,91,27,69,87,158,165,158,178,154,188,186,169,129,99,223,31,
+14,247,5,165,248,122,21,128,7,80,184,102,211,206,181,173,195,161,131,161,
+126,151,30,126,152,118,148,92,151,8,83,153,122,149,159,26,163,165,157,173,
+177,157,125,102,146,30,182,6,199,138,100,174,73,27,77,98,104,87,95,165,116,
+208,125,31,199,126,159,126,112,26,112,111,120,101,95,111,162,175,138,30,144,
+7,247,119,247,89,21,251,191,183,247,164,143,7,199,251,164,5,192,6,199,247,
+164,5,143,251,164,182,247,191,59,6,87,251,149,84,247,149,5,14,247,4,247,64,
+248,214,21,193,230,161,148,185,27,208,193,75,57,53,84,64,76,119,126,144,156,
+118,31,157,175,142,149,157,26,168,116,161,108,103,114,112,100,91,176,97,196,
+122,30,73,122,92,104,79,61,176,106,24,215,206,175,160,205,27,187,177,121,
+100,172,31,172,101,157,90,90,26,96,125,93,114,100,30,98,113,106,118,102,27,
+95,102,172,177,161,146,154,159,161,31,138,131,133,139,131,27,112,120,147,
+163,105,31,173,91,120,147,109,27,81,94,95,83,108,151,111,164,111,31,193,172,
+5,109,158,128,153,160,26,167,161,160,168,173,164,113,103,117,132,125,118,
+117,30,140,146,145,139,142,27,166,158,133,122,161,31,179,109,139,139,149,
+134,8,122,172,172,131,172,27,247,15,246,247,11,247,30,204,113,205,94,186,
+31,107,173,112,153,82,155,8,238,169,198,217,237,26,247,6,49,227,251,9,72,
+93,119,66,37,30,14,247,60,249,51,249,20,21,107,183,111,121,5,167,95,125,144,
+106,27,93,112,128,104,95,31,182,89,117,149,97,27,251,25,36,251,56,251,103,
+251,123,247,33,251,66,247,78,221,221,176,200,192,31,168,173,157,169,166,197,
+95,160,24,43,82,75,97,51,27,81,74,165,180,98,31,79,197,104,243,247,10,26,
+247,46,199,247,5,220,161,155,132,117,166,30,102,99,122,98,90,26,101,156,104,
+192,68,30,195,62,144,130,107,26,99,114,114,101,95,99,180,183,159,144,152,
+157,163,30,85,163,5,125,115,133,116,107,26,57,205,72,222,221,206,210,228,
+171,129,171,121,169,30,125,161,135,145,90,195,8,78,210,139,139,167,26,178,
+174,174,177,167,168,122,102,174,30,14,85,225,247,60,21,224,149,237,158,182,
+154,8,238,173,187,186,201,26,208,76,183,41,73,62,114,100,83,30,62,85,94,56,
+51,26,251,9,225,63,247,26,216,210,163,186,204,30,168,160,151,154,153,26,156,
+118,164,125,134,133,136,134,131,30,97,111,139,139,126,132,8,113,92,91,126,
+94,27,72,98,174,205,131,31,146,218,21,156,182,156,163,175,167,8,166,175,190,
+156,187,27,173,160,126,119,119,123,122,107,122,31,95,117,46,116,64,132,8,
+14,85,211,247,30,21,94,251,30,5,248,16,6,187,247,30,5,91,6,158,203,147,186,
+187,26,195,126,195,119,171,30,182,112,102,154,62,27,251,26,6,87,138,134,142,
+138,175,8,117,122,130,113,98,26,102,149,109,156,126,30,128,153,153,137,192,
+27,247,33,6,207,167,105,58,106,134,105,129,99,31,14,251,56,236,247,30,21,
+94,251,33,5,247,39,6,186,237,149,124,157,90,148,105,25,158,155,142,151,187,
+26,197,133,213,130,204,30,131,195,139,139,156,26,154,140,154,142,155,30,143,
+160,141,157,148,26,180,105,163,68,148,30,84,146,130,143,136,159,8,119,117,
+133,121,105,26,71,163,112,204,132,30,207,131,141,137,78,26,99,133,70,131,
+91,30,14,247,115,135,248,241,21,247,14,251,186,205,162,64,247,64,248,197,
+252,194,191,188,252,201,248,198,247,65,63,162,204,251,182,247,9,5,14,247,
+115,248,197,248,195,21,252,201,252,198,191,90,248,197,248,194,64,251,64,205,
+116,247,14,247,186,72,199,251,182,251,9,162,74,5,14,247,115,248,245,243,21,
+252,197,248,195,87,90,248,201,252,199,251,65,215,116,74,247,182,251,10,206,
+200,251,14,247,186,73,116,5,14,247,115,247,49,190,21,248,201,248,199,87,188,
+252,197,252,195,214,247,64,73,162,251,14,251,186,206,78,247,182,247,10,116,
+204,5,14,248,136,249,218,247,95,141,29,40,247,147,130,10,14,248,136,247,8,
+247,95,130,10,249,102,247,83,132,29,247,115,247,140,247,10,21,96,164,115,
+151,94,160,119,115,24,203,101,247,38,251,23,173,87,198,214,241,231,222,193,
+120,163,24,93,120,113,126,96,113,8,248,3,7,181,114,164,126,187,119,158,163,
+24,55,193,37,232,81,213,104,86,251,35,251,21,73,100,159,115,24,190,162,162,
+151,177,162,8,212,184,21,145,144,145,144,146,143,145,144,146,145,146,144,
+158,124,142,137,157,126,8,252,93,7,132,134,132,134,134,135,118,123,24,124,
+151,133,143,121,153,8,14,122,210,22,247,25,6,245,186,148,169,182,31,200,182,
+175,208,216,26,210,109,202,85,184,30,177,92,92,150,251,7,27,251,25,69,247,
+21,6,231,175,132,118,170,31,177,111,161,109,146,105,8,251,247,63,247,247,
+6,132,108,123,114,107,111,105,111,104,132,37,138,8,251,21,6,14,248,136,247,
+107,248,145,21,248,198,213,252,198,6,252,23,4,247,136,251,88,213,247,88,247,
+136,213,251,136,247,79,65,251,79,251,136,6,14,247,115,247,206,249,136,21,
+254,131,212,250,131,7,14,247,115,247,141,250,19,21,28,251,130,212,28,4,126,
+7,215,22,28,251,130,212,28,4,126,7,14,248,140,248,169,248,149,21,73,6,251,
+116,252,149,5,219,6,247,69,248,45,247,69,252,45,5,219,6,14,248,140,248,169,
+22,247,116,248,149,5,59,6,251,69,252,45,251,69,248,45,5,59,6,247,116,252,
+149,5,14,248,136,247,128,251,23,21,134,166,156,137,162,27,247,3,219,199,244,
+168,31,149,176,141,159,142,198,8,240,157,207,224,245,26,245,77,217,36,163,
+30,247,26,147,191,199,246,27,156,149,138,134,163,31,224,7,144,116,127,140,
+115,27,60,81,113,84,94,31,103,95,121,82,133,43,8,36,115,76,60,33,26,35,199,
+62,241,112,30,251,31,136,90,80,251,5,27,123,126,141,144,114,31,247,195,248,
+160,21,187,125,175,86,84,26,83,105,90,89,121,30,56,141,21,93,155,105,190,
+193,26,192,173,191,185,155,30,14,248,136,105,29,251,121,252,98,21,92,101,
+102,93,92,177,101,185,185,177,177,185,185,101,177,94,31,14,248,136,105,29,
+252,94,252,98,147,10,176,101,186,185,177,177,185,184,101,178,94,31,14,248,
+136,248,204,248,104,21,251,250,65,247,210,6,100,68,5,251,171,65,247,131,6,
+101,68,5,251,93,65,247,52,6,103,73,204,104,195,240,5,248,5,213,251,221,6,
+178,210,5,247,182,213,251,142,6,177,210,5,247,104,213,251,63,6,179,212,74,
+175,5,14,248,136,249,207,249,30,21,253,40,251,175,5,72,7,249,40,251,175,5,
+227,7,252,162,247,121,248,162,247,120,5,93,4,252,49,251,74,248,49,251,75,
+5,229,7,251,100,232,247,100,231,5,14,248,136,247,59,249,30,21,51,7,248,162,
+251,120,252,162,251,121,5,51,7,249,40,247,175,5,206,7,253,40,247,41,21,49,
+7,247,100,47,251,100,46,5,49,7,248,49,247,75,5,14,248,136,249,71,249,77,21,
+53,6,103,56,5,146,103,84,144,87,27,251,142,57,247,142,6,190,173,137,135,164,
+31,251,87,252,92,5,251,57,57,247,22,6,109,68,5,226,6,169,210,5,172,6,247,
+8,212,156,179,201,31,228,198,186,227,247,1,26,247,15,80,235,251,2,194,30,
+108,66,21,220,93,175,77,46,26,87,128,98,117,106,30,112,99,96,106,95,125,8,
+126,99,96,134,67,27,14,248,136,248,138,249,76,118,10,247,188,252,26,21,251,
+48,122,251,19,251,7,251,48,27,251,48,251,21,247,8,247,47,123,31,140,198,21,
+247,46,155,247,20,247,9,247,47,27,247,49,247,19,251,6,251,49,156,31,14,248,
+136,248,138,249,75,21,251,93,133,10,251,84,31,251,130,252,185,21,94,196,117,
+200,209,26,247,58,247,26,247,27,247,58,208,203,117,94,196,30,183,96,21,184,
+82,161,78,67,26,251,57,251,27,251,26,251,58,71,75,161,184,82,30,14,248,136,
+248,134,248,32,21,105,112,113,104,106,166,112,172,173,166,166,173,172,112,
+166,106,31,143,247,192,118,10,130,79,21,247,64,247,27,251,24,251,61,251,57,
+251,27,251,26,251,59,251,59,251,27,247,26,247,56,247,57,247,27,247,29,247,
+54,31,14,248,136,249,193,247,213,21,252,191,247,131,59,252,196,219,247,131,
+248,191,6,14,248,136,247,70,247,213,21,57,248,191,251,131,219,248,196,59,
+251,131,7,14,248,136,247,108,249,18,21,56,247,129,252,191,223,248,191,247,
+129,222,7,14,248,136,247,105,248,221,21,247,127,252,220,5,238,6,247,127,248,
+220,5,51,6,251,88,252,127,251,89,248,127,5,55,253,102,21,248,199,213,252,
+199,6,14,248,136,250,126,247,175,21,88,6,251,52,138,251,7,106,62,70,37,44,
+108,50,140,251,89,8,88,202,190,7,141,171,140,247,51,173,220,236,216,25,198,
+184,240,164,247,19,141,8,190,6,14,248,136,133,247,175,21,76,190,7,247,6,137,
+236,118,196,102,8,247,2,65,180,50,251,58,26,141,107,5,88,202,190,7,140,247,
+89,108,228,37,234,61,208,251,6,172,251,52,140,8,14,248,136,133,247,112,21,
+190,6,247,53,140,247,5,172,217,208,241,234,170,228,138,247,89,8,190,76,88,
+7,137,107,138,251,51,105,58,42,63,25,78,93,41,114,251,20,137,8,88,6,14,248,
+136,250,126,247,112,21,202,88,7,251,6,141,43,160,80,176,8,251,1,213,98,228,
+247,58,26,137,171,5,190,76,88,7,138,251,89,170,50,241,44,217,70,247,5,106,
+247,53,138,8,14,247,115,248,234,176,21,251,130,248,107,251,130,252,107,5,
+248,15,198,21,251,175,6,247,35,247,176,5,14,247,115,247,18,170,21,248,102,
+247,133,252,102,247,132,5,201,252,14,21,247,173,7,247,179,251,35,5,14,247,
+115,247,14,248,143,21,247,130,252,107,247,130,248,107,5,252,15,80,21,247,
+175,6,251,35,251,176,5,14,247,115,248,229,170,21,248,117,7,252,102,251,132,
+5,248,40,251,30,21,251,179,247,30,247,179,247,35,5,14,248,136,247,133,247,
+223,21,247,157,251,184,247,153,247,182,251,159,247,186,5,14,248,136,247,82,
+247,224,21,247,202,251,235,247,203,247,236,251,203,247,235,5,251,157,251,
+235,21,247,157,247,184,247,157,251,184,251,157,251,185,5,14,141,247,139,248,
+99,21,35,53,54,37,251,0,223,54,246,243,224,224,244,244,54,224,34,31,140,81,
+21,211,198,80,66,67,80,79,68,63,81,198,215,209,200,198,211,31,14,247,113,
+237,10,247,114,251,48,21,247,175,194,41,249,213,237,194,251,175,6,194,254,
+12,21,249,213,214,253,213,7,248,2,227,10,247,113,237,10,247,111,251,48,21,
+247,175,250,67,251,175,84,237,253,213,41,6,247,45,22,249,213,214,253,213,
+7,247,163,227,10,120,158,248,97,151,247,95,154,6,172,10,247,30,11,168,143,
+144,144,144,143,143,146,142,146,144,229,12,12,182,157,146,164,147,164,151,
+149,148,143,144,151,12,13,249,102,20,248,132,21,189,19,1,17,2,0,1,0,21,0,
+35,0,43,0,151,1,19,1,108,1,211,1,217,1,223,1,244,1,255,2,4,2,67,2,72,2,121,
+2,157,2,161,3,10,3,20,3,64,3,83,3,86,3,93,3,138,3,245,4,78,4,144,4,247,5,
+43,5,112,5,117,5,156,5,183,5,206,5,236,6,40,6,43,6,62,6,111,6,138,6,211,6,
+219,7,20,7,31,7,96,7,112,7,174,7,220,7,251,8,36,8,44,8,67,8,99,8,152,8,163,
+8,169,8,179,8,202,8,205,8,210,8,228,9,18,9,64,9,78,9,83,9,95,9,116,9,140,
+9,145,9,174,9,193,9,213,9,228,9,244,10,30,10,72,10,80,10,120,10,127,10,148,
+10,186,10,199,10,235,11,15,11,35,11,70,11,105,11,139,11,173,11,189,11,198,
+11,224,11,255,12,12,12,44,12,50,12,81,12,95,12,99,12,129,12,157,12,186,12,
+196,12,225,12,254,13,14,13,18,13,28,13,43,13,71,13,85,13,92,13,120,13,123,
+13,150,13,177,13,197,13,212,13,218,13,231,13,236,14,6,14,32,14,40,14,65,14,
+82,14,105,14,111,14,135,14,143,14,167,14,172,14,196,14,213,14,223,14,246,
+15,13,15,36,15,59,15,75,15,83,15,92,15,105,15,109,15,113,15,128,15,149,15,
+170,15,191,15,212,15,233,15,246,15,255,16,19,16,39,16,59,16,79,16,99,16,119,
+16,137,16,156,16,175,16,189,16,203,16,207,16,226,16,236,16,255,17,10,17,21,
+17,39,17,50,17,56,17,74,17,92,17,101,17,109,17,126,17,143,17,160,17,177,17,
+194,17,211,17,228,17,243,17,253,18,13,18,29,18,45,18,61,18,68,18,84,18,100,
+18,116,18,132,18,146,18,154,18,169,18,184,18,199,18,207,18,222,18,237,18,
+252,18,255,19,13,19,27,19,41,19,55,19,69,19,83,19,97,19,111,19,123,19,132,
+19,141,19,154,19,167,19,180,19,193,19,206,19,219,19,232,19,245,20,2,20,15,
+20,22,20,34,20,46,20,58,20,70,20,82,20,94,20,106,20,118,20,130,20,142,20,
+154,20,166,20,178,20,183,20,195,20,203,20,211,20,222,20,233,20,244,20,255,
+21,10,21,21,21,32,21,43,21,54,21,65,21,76,21,87,21,96,21,105,21,111,21,114,
+21,118,21,123,21,128,21,132,21,137,21,140,21,144,21,150,21,153,21,160,21,
+165,21,172,21,181,155,249,31,21,198,10,248,221,7,179,247,100,119,10,247,230,
+126,10,6,11,76,10,74,7,182,154,163,143,204,146,201,146,24,11,72,29,247,216,
+7,125,10,11,248,116,243,10,128,137,130,130,114,30,71,251,84,67,247,77,5,119,
+190,139,139,147,26,154,151,146,164,142,30,155,140,5,247,18,10,142,138,185,
+41,155,98,247,12,251,187,24,121,86,5,89,122,114,107,115,27,130,131,147,148,
+140,139,141,140,142,31,140,144,140,144,143,26,168,116,159,104,101,113,113,
+101,92,179,107,196,173,168,150,161,160,30,160,162,159,179,174,233,247,41,
+248,33,24,156,181,149,149,170,142,8,11,249,87,248,97,21,251,27,115,6,176,
+135,150,131,116,26,126,126,101,108,62,30,125,103,131,117,126,103,128,182,
+134,158,121,204,8,120,203,131,171,149,26,155,149,144,177,142,30,163,251,126,
+115,7,178,135,140,138,158,73,140,136,141,131,142,131,71,251,63,24,115,203,
+103,232,5,120,189,134,154,150,26,156,149,146,167,143,30,163,251,114,115,7,
+165,134,143,133,166,73,247,40,252,10,24,163,6,247,17,247,202,241,251,202,
+5,162,6,247,47,248,37,154,176,147,147,166,144,25,11,248,118,248,34,21,192,
+251,22,7,155,95,111,145,99,27,251,11,247,20,10,158,126,186,227,29,131,106,
+113,143,29,170,167,160,179,231,143,139,154,172,30,199,165,169,182,201,26,
+179,127,169,111,167,30,62,252,86,21,193,165,123,105,93,84,113,40,247,36,29,
+228,248,130,21,186,158,101,46,46,121,103,91,91,121,174,233,233,157,176,187,
+31,11,249,79,249,56,21,251,112,114,6,207,134,155,131,110,26,119,126,107,113,
+96,30,251,3,251,77,251,12,247,124,136,144,138,141,137,144,25,125,162,135,
+151,151,26,161,154,147,180,30,164,140,5,164,251,227,114,7,173,137,165,120,
+159,105,247,75,251,224,24,251,39,7,137,64,128,129,59,132,8,114,247,239,164,
+7,59,146,129,149,137,214,8,247,76,7,247,83,247,203,154,162,158,150,173,144,
+25,11,248,175,163,66,10,11,98,10,247,242,7,11,155,22,247,119,164,6,247,37,
+29,248,83,252,180,5,167,248,225,6,94,10,11,21,106,109,109,105,103,167,109,
+174,127,10,247,147,116,29,11,247,187,163,21,78,142,128,152,138,202,8,247,
+81,7,191,167,182,172,147,148,132,123,150,30,112,158,154,130,165,27,176,165,
+167,177,185,105,172,92,89,101,113,71,92,31,221,251,81,115,7,181,134,150,247,
+12,10,96,132,8,115,247,158,7,11,21,251,29,155,29,247,118,247,44,21,247,113,
+7,137,175,155,161,167,129,10,112,140,123,160,140,171,247,16,247,117,24,251,
+112,7,141,103,123,117,111,138,8,119,247,102,159,7,157,29,154,118,138,104,
+8,11,248,101,21,141,149,145,174,5,157,223,140,144,160,26,169,119,161,111,
+112,118,117,109,126,142,118,143,118,30,147,101,146,106,144,110,8,11,21,82,
+191,29,247,224,247,151,21,238,251,73,5,148,124,141,132,130,26,123,123,128,
+112,30,124,119,247,185,159,127,6,113,137,106,176,95,218,251,35,247,145,24,
+234,247,30,204,231,163,157,201,146,25,159,251,117,119,151,7,170,163,119,114,
+122,131,120,123,116,186,10,156,159,251,193,119,6,189,136,167,111,197,35,247,
+11,251,107,24,251,5,251,55,5,61,85,101,108,99,27,129,119,247,121,159,120,
+6,102,116,247,41,10,248,149,164,21,83,10,247,249,7,11,247,187,21,208,29,153,
+115,145,125,220,29,132,145,104,247,22,10,173,162,211,27,159,251,127,157,10,
+157,192,141,8,147,159,251,197,119,158,6,192,137,154,121,140,10,11,21,81,90,
+90,83,79,186,91,198,199,186,186,198,197,91,188,172,10,14,99,29,14,198,184,
+198,217,151,10,11,141,10,224,247,13,26,247,102,202,247,2,247,13,186,181,121,
+101,182,30,183,101,162,104,174,247,51,10,81,91,150,90,27,251,91,251,41,251,
+45,251,98,251,99,99,10,11,247,190,247,85,21,80,247,33,5,126,171,134,158,154,
+26,159,150,151,158,30,148,159,251,116,119,6,172,131,146,129,182,251,1,247,
+9,251,176,24,110,64,5,102,124,125,121,125,27,132,134,144,146,31,146,7,140,
+144,139,143,142,26,168,116,161,110,105,116,114,103,98,175,106,186,186,177,
+173,203,163,30,247,29,248,5,184,247,11,144,146,176,140,25,159,251,36,119,
+151,7,158,153,126,120,122,133,110,129,111,31,11,21,69,74,98,45,42,197,10,
+231,203,242,247,39,247,17,90,231,72,104,115,116,107,106,158,118,174,133,31,
+179,132,140,138,152,126,8,154,122,146,111,94,26,38,94,75,67,102,112,156,177,
+116,30,166,198,151,185,182,26,187,116,170,103,101,115,107,89,94,152,85,162,
+91,30,104,120,110,118,107,27,82,109,198,247,7,215,150,201,164,202,31,14,145,
+247,218,21,230,251,127,6,95,112,117,83,30,114,247,208,7,135,10,251,103,48,
+7,248,3,22,251,6,247,114,6,156,140,147,143,144,30,150,147,158,145,167,27,
+210,190,106,70,173,31,166,86,153,67,54,26,44,119,53,235,10,247,125,247,6,
+7,14,21,251,31,6,113,58,5,211,101,107,161,73,27,251,20,45,251,1,251,40,251,
+26,214,52,247,6,218,203,176,208,180,31,148,99,146,120,155,118,8,124,150,150,
+129,147,27,142,145,141,142,146,31,236,179,128,170,5,135,127,133,138,131,27,
+97,107,176,212,121,31,251,2,157,21,131,103,112,76,121,113,8,122,128,117,127,
+122,27,95,119,191,247,4,247,31,171,222,194,178,165,97,251,8,172,31,14,247,
+51,21,248,40,7,137,197,154,158,247,57,10,87,142,124,155,140,191,247,141,248,
+50,24,252,45,7,113,29,247,207,159,121,100,29,248,103,7,137,197,154,247,45,
+29,188,138,158,119,137,92,8,11,248,108,247,96,21,251,76,248,94,5,251,145,
+119,158,6,192,137,154,139,10,119,247,95,159,126,6,81,140,122,156,142,197,
+8,248,158,7,247,145,252,254,5,156,6,247,149,248,229,5,252,133,7,141,83,123,
+122,87,136,8,113,119,247,215,175,10,159,251,132,6,14,247,176,63,29,11,134,
+29,202,247,2,247,13,186,182,121,101,182,30,182,101,162,105,174,63,85,29,81,
+91,150,91,27,251,92,251,41,251,45,251,98,251,98,149,10,11,247,53,29,252,161,
+251,111,248,161,7,136,197,155,158,125,29,252,161,251,111,248,161,7,78,29,
+6,14,182,21,94,142,125,152,181,26,248,211,247,22,29,251,75,114,10,251,90,
+231,130,29,11,21,102,141,126,154,140,179,8,247,143,247,14,29,214,251,83,115,
+7,183,132,147,130,140,96,8,251,186,84,29,11,249,52,21,51,73,115,84,74,31,
+65,76,102,52,251,4,26,251,97,247,26,251,28,247,93,247,88,247,28,247,30,247,
+91,245,110,218,77,203,30,204,75,61,170,35,27,143,104,21,246,199,247,39,10,
+92,235,29,217,186,196,228,10,69,29,14,107,10,140,138,140,138,142,137,25,144,
+134,143,136,141,138,8,160,10,14,248,199,21,78,29,119,247,216,6,247,46,223,
+202,247,9,247,20,48,209,251,57,117,135,139,136,90,31,100,4,141,155,148,139,
+150,27,222,185,83,38,49,97,86,67,100,127,153,180,31,11,122,10,181,121,101,
+183,30,182,101,163,104,173,247,51,10,82,90,150,91,27,251,92,251,41,251,45,
+11,247,144,248,93,21,251,9,53,39,251,27,71,163,77,181,96,31,103,174,192,116,
+184,27,192,196,165,182,176,31,176,180,159,200,206,26,247,23,53,237,251,6,
+30,138,101,21,162,159,122,112,148,31,149,112,142,105,76,26,251,59,121,83,
+85,98,121,186,244,247,75,155,195,189,30,11,21,247,40,10,168,174,229,29,119,
+7,165,135,153,119,137,104,8,251,228,34,247,228,7,138,174,152,159,165,143,
+8,159,251,93,119,7,165,135,153,119,137,104,8,251,228,34,247,228,7,221,29,
+119,137,102,8,251,186,7,103,141,123,117,111,27,118,11,247,54,10,86,142,124,
+156,141,195,8,11,248,173,182,21,96,141,127,152,138,182,8,247,252,251,93,115,
+7,188,136,151,127,140,95,8,251,175,7,106,106,119,128,110,27,98,124,159,190,
+31,247,231,251,80,115,7,180,131,146,130,140,97,8,251,144,7,51,189,87,222,
+191,174,155,189,197,30,11,247,98,169,10,155,30,145,144,247,95,247,56,5,128,
+29,11,124,133,133,134,126,27,133,130,141,144,123,31,150,107,116,143,116,27,
+48,73,77,55,73,180,93,240,96,31,208,109,166,114,107,26,100,109,113,94,69,
+93,184,226,118,30,111,251,57,164,6,161,150,145,145,148,27,144,147,137,135,
+149,31,11,247,101,248,93,21,203,10,251,110,7,87,141,127,153,115,30,122,149,
+150,130,149,27,144,146,141,142,147,31,247,17,189,132,161,5,134,125,130,136,
+132,27,112,136,150,219,31,11,246,10,146,137,119,183,31,168,126,5,131,157,
+166,133,158,27,196,176,179,226,181,29,110,116,145,118,27,77,247,43,29,248,
+36,21,236,219,5,189,7,42,59,5,247,118,247,19,10,251,125,7,50,67,5,89,7,228,
+211,5,251,119,247,14,10,163,7,107,123,159,179,138,31,14,21,251,222,67,247,
+222,6,14,54,143,128,150,137,216,8,248,163,117,10,252,163,7,137,63,128,129,
+55,133,8,114,11,249,42,21,252,151,247,12,29,139,10,119,247,221,159,107,100,
+29,248,166,247,13,7,219,142,188,89,144,47,8,168,6,11,21,176,164,158,152,170,
+27,179,164,115,102,99,116,118,78,121,31,129,7,235,108,173,107,81,26,100,114,
+113,101,123,127,145,159,118,30,109,165,131,143,110,142,8,112,130,126,126,
+120,26,106,178,118,200,11,247,197,248,97,21,45,103,10,233,7,11,121,157,24,
+90,29,11,21,149,29,192,137,154,119,29,6,11,70,141,127,150,138,205,8,247,206,
+226,183,52,143,10,176,164,164,176,198,81,180,54,11,161,10,14,109,29,123,30,
+14,93,101,101,93,91,175,102,186,187,177,175,186,187,101,177,92,31,11,140,
+8,33,6,244,143,174,154,166,30,161,152,161,150,173,27,169,163,127,124,138,
+138,136,138,136,31,135,128,136,127,128,26,107,165,117,177,177,166,163,175,
+196,71,174,251,1,11,196,152,153,204,148,30,164,251,107,114,7,212,132,159,
+118,68,26,251,197,7,251,241,248,65,5,251,103,114,6,159,156,124,82,187,31,
+252,110,7,138,80,123,126,68,131,8,11,249,71,21,76,122,110,115,188,29,180,
+120,193,216,29,251,72,103,29,11,249,71,221,10,190,185,109,171,96,168,10,11,
+248,6,164,21,65,143,119,153,138,192,146,10,137,88,121,124,66,134,8,114,11,
+247,38,251,36,247,102,242,247,0,163,177,204,31,247,19,7,141,212,150,151,212,
+146,8,11,252,29,107,29,11,21,75,122,110,116,225,29,111,8,103,164,181,120,
+192,27,195,179,159,180,165,31,156,165,147,164,144,190,8,14,138,10,89,91,168,
+108,184,144,144,238,10,126,101,105,97,64,87,31,11,247,61,114,6,78,53,99,94,
+74,84,8,112,191,251,216,151,29,247,193,11,249,69,164,21,95,127,153,247,17,
+86,129,29,155,144,11,27,168,156,126,116,112,119,125,101,123,127,142,148,114,
+137,10,141,84,8,252,192,7,77,121,114,93,111,122,151,159,148,142,144,148,150,
+30,151,154,142,147,155,26,179,105,174,100,102,106,105,101,98,167,94,178,116,
+30,125,11,21,167,174,155,160,144,146,8,177,192,154,165,156,26,146,135,143,
+131,131,131,135,126,124,30,138,138,137,137,136,137,251,95,251,56,24,135,7,
+247,98,251,58,11,144,29,221,208,247,21,10,11,164,21,69,147,122,152,138,189,
+8,248,120,7,140,190,160,156,205,142,8,164,251,232,114,7,207,136,159,123,141,
+87,8,251,99,251,133,247,99,7,140,11,188,29,181,120,192,216,29,249,56,21,251,
+112,114,6,216,134,160,118,66,26,251,197,7,251,40,83,70,11,248,88,21,251,67,
+118,145,6,168,140,156,117,137,102,8,251,186,7,102,141,123,117,109,27,133,
+119,247,118,159,132,6,109,123,161,176,141,31,11,246,10,147,136,120,182,180,
+29,124,126,112,27,11,7,185,96,109,155,93,27,251,2,57,32,251,37,251,29,215,
+41,244,192,172,155,189,186,31,74,7,185,152,164,144,201,146,201,147,24,11,
+21,247,152,87,7,100,93,48,251,2,108,98,97,77,25,72,247,53,52,233,226,180,
+205,7,251,26,22,251,29,6,247,29,247,67,5,11,163,21,107,123,159,179,138,31,
+248,228,247,19,10,252,146,247,14,10,7,11,7,247,15,135,191,93,156,251,11,8,
+168,6,137,247,93,5,252,236,6,136,251,93,5,168,6,156,247,11,191,185,247,16,
+143,8,11,21,251,94,251,54,251,53,251,93,251,88,247,54,251,55,247,89,247,89,
+247,56,247,55,247,88,247,88,251,55,247,58,251,85,31,11,5,111,6,108,72,119,
+111,103,110,8,102,93,85,123,62,27,74,121,152,182,31,247,134,7,247,1,180,100,
+251,8,151,31,165,11,247,184,251,76,21,79,141,123,158,137,208,8,247,33,7,92,
+187,164,126,184,27,247,5,218,243,247,40,247,32,64,233,251,3,11,247,52,29,
+192,27,195,180,159,180,165,31,156,166,146,163,11,142,29,203,247,2,247,12,
+186,11,45,8,161,247,74,252,155,119,157,6,193,137,154,121,247,31,29,85,136,
+8,121,119,248,167,6,11,251,30,201,6,241,160,172,206,165,155,131,126,135,137,
+133,136,132,30,133,128,137,131,132,26,123,148,124,151,135,30,14,252,136,247,
+128,21,233,247,135,240,251,135,5,11,113,6,124,251,6,100,103,251,0,140,8,247,
+124,7,177,152,148,191,247,55,188,105,251,25,164,30,164,247,93,252,213,11,
+171,10,168,174,229,29,146,191,147,164,156,163,8,170,161,173,156,180,27,203,
+173,94,56,77,119,96,102,124,31,133,125,118,137,104,27,129,11,140,8,159,251,
+102,174,10,184,10,247,102,159,7,11,21,135,29,11,251,149,248,240,24,111,6,
+251,97,252,184,118,74,109,106,100,137,25,119,247,101,159,117,7,104,112,158,
+163,148,11,226,21,251,29,247,49,5,157,123,121,149,119,27,113,118,119,114,
+119,150,126,168,120,31,247,34,51,5,14,251,54,251,53,251,92,251,88,247,54,
+251,54,247,87,247,89,247,55,247,55,247,87,247,88,251,54,247,57,11,149,149,
+30,161,161,163,175,29,7,11,247,108,247,36,247,30,247,99,247,98,251,31,247,
+17,251,124,31,251,197,114,6,202,134,158,124,140,92,8,11,105,188,247,7,31,
+162,247,146,7,201,134,169,122,174,30,201,109,78,175,65,27,86,102,124,103,
+102,31,176,11,31,133,141,123,102,5,126,175,166,134,172,159,10,127,31,14,231,
+29,107,11,120,137,81,8,252,103,150,10,120,11,137,83,8,252,106,7,113,29,247,
+197,159,131,100,29,11,21,251,235,114,6,223,135,154,129,141,83,8,34,7,88,110,
+117,72,76,97,158,182,106,30,95,195,118,11,247,252,21,243,247,83,5,162,181,
+150,168,211,10,11,165,10,108,165,115,173,11,247,39,247,39,247,100,207,123,
+203,108,194,31,117,177,120,160,91,179,8,252,9,252,107,21,122,199,134,11,152,
+10,14,8,248,120,7,140,192,161,155,211,141,8,164,251,242,114,7,209,136,160,
+123,141,87,8,252,120,7,11,21,92,101,102,93,92,176,101,186,185,177,177,185,
+185,101,177,94,31,248,94,22,92,101,102,93,92,11,185,249,42,21,119,158,7,191,
+137,155,120,137,80,8,252,102,7,113,29,11,247,38,251,37,247,100,247,7,207,
+174,247,3,240,31,11,7,141,247,11,10,11,26,202,103,181,85,93,110,110,94,96,
+223,10,11,248,164,161,10,11,194,26,204,77,184,48,115,123,136,130,110,30,135,
+126,131,137,132,27,126,133,145,151,31,122,6,11,226,26,241,63,201,251,19,103,
+120,135,118,88,30,131,120,130,137,129,27,118,131,149,164,138,31,11,146,29,
+170,241,29,123,30,14,106,27,105,114,149,160,124,31,127,155,136,157,180,26,
+247,29,7,136,197,155,158,192,141,8,11,119,161,7,166,155,127,119,125,132,126,
+120,201,10,137,195,154,11,65,21,185,103,158,108,100,26,105,123,118,113,107,
+125,162,189,183,143,155,158,167,30,14,27,219,247,21,29,11,131,148,145,137,
+145,27,146,143,145,148,159,112,182,88,198,31,125,156,127,155,125,160,8,11,
+195,29,123,130,120,122,30,11,157,191,201,172,157,122,96,152,30,150,81,21,
+140,93,140,113,106,26,251,42,119,87,81,11,247,208,175,10,11,71,168,111,164,
+173,26,172,167,164,177,166,165,128,118,161,30,160,119,150,121,154,95,8,11,
+247,14,7,194,153,161,175,157,150,132,127,134,136,247,30,10,11,219,10,100,
+123,126,142,148,115,31,11,7,141,103,124,118,110,138,8,119,247,119,7,247,2,
+199,183,220,227,74,188,251,10,11,134,133,139,138,133,30,138,136,137,139,137,
+27,128,131,148,151,179,173,180,214,191,31,11,21,111,104,123,118,134,132,8,
+101,86,124,113,122,26,131,143,136,147,148,145,142,153,11,26,159,150,151,157,
+30,149,159,251,116,119,6,166,167,96,55,167,31,207,251,107,5,11,175,167,167,
+175,175,110,169,104,31,247,101,22,247,40,10,11,247,28,29,111,107,244,10,11,
+21,140,147,142,139,145,232,29,14,119,7,168,138,155,118,137,102,8,251,186,
+7,11,159,183,29,11,21,83,191,29,7,184,10,247,108,159,135,7,109,123,161,176,
+141,31,11,141,103,123,119,109,137,8,134,119,247,103,159,6,113,144,127,159,
+140,172,8,11,27,234,194,171,229,198,31,252,33,107,21,114,115,125,132,115,
+27,101,120,163,11,160,27,143,142,140,140,144,31,247,26,188,5,177,7,128,112,
+129,136,128,27,11,42,35,251,32,59,164,82,199,83,31,63,251,20,5,186,6,202,
+244,5,120,11,106,102,172,6,199,168,110,80,82,105,104,85,95,109,166,198,118,
+31,112,130,11,164,179,121,191,27,194,179,159,179,164,247,42,29,141,102,123,
+118,110,138,8,119,11,133,223,124,186,107,177,8,178,107,92,159,83,27,251,16,
+55,40,251,38,11,31,55,251,11,59,247,38,5,124,168,135,149,148,26,156,156,151,
+164,30,11,199,191,5,196,7,251,154,251,114,247,154,251,114,5,196,7,79,191,
+5,11,90,98,109,121,96,27,100,110,157,174,118,31,121,171,131,172,135,208,8,
+11,113,144,126,159,141,173,8,247,5,7,154,158,222,251,31,5,156,111,141,11,
+119,152,6,192,137,155,120,137,81,8,251,39,7,40,196,90,247,6,196,11,149,120,
+27,113,118,119,114,119,150,125,168,121,31,247,34,51,5,14,145,43,8,154,51,
+21,94,102,102,95,93,175,102,185,184,176,176,184,11,21,112,116,116,113,111,
+162,116,166,166,162,162,166,166,116,162,112,31,11,146,29,171,159,147,149,
+162,26,165,120,157,110,119,11,146,29,172,159,146,149,162,26,166,120,156,110,
+119,11,21,206,29,11,26,251,15,206,51,231,198,180,168,211,181,30,69,168,176,
+108,191,27,11,206,136,158,123,141,87,247,4,29,11,116,247,19,251,178,5,216,
+6,247,20,247,178,86,162,58,251,102,5,11,77,27,76,107,165,200,128,31,95,6,
+11,116,31,251,60,251,97,5,247,103,7,11,21,247,12,142,157,179,188,27,186,154,
+105,251,3,141,31,124,7,11,247,34,29,142,27,163,150,119,95,31,11,92,224,62,
+234,29,11,100,108,108,101,100,170,108,177,177,171,170,177,177,107,171,102,
+31,11,108,113,113,108,107,165,113,171,170,165,165,170,171,114,165,106,31,
+11,217,10,125,132,138,135,127,31,14,101,108,108,101,100,170,108,11,7,138,
+89,123,126,71,131,8,114,247,229,164,7,68,146,121,11,26,113,121,128,96,30,
+114,119,247,194,159,130,6,115,141,132,11,158,26,168,116,160,107,76,99,85,
+52,138,30,136,251,82,5,11,190,186,168,185,164,30,117,153,134,137,138,138,
+131,135,25,129,11,201,6,248,93,249,42,5,77,6,244,252,63,21,181,166,156,11,
+117,137,103,8,251,35,7,132,126,127,136,124,27,98,118,160,11,119,7,165,135,
+152,118,137,105,8,251,228,251,4,247,228,7,11,40,251,4,238,5,83,6,247,14,251,
+68,5,231,6,14,27,219,189,173,194,183,106,165,84,11,124,118,110,138,8,119,
+247,97,159,7,113,142,125,160,141,11,131,5,142,150,147,140,148,27,168,156,
+126,116,112,119,125,11,8,164,247,93,253,14,117,6,206,135,159,130,115,26,129,
+11,21,251,8,72,89,74,52,26,70,180,92,199,189,172,171,11,160,146,148,247,6,
+10,11,165,111,179,143,144,139,140,144,30,140,142,142,139,140,27,11,247,236,
+22,248,202,6,180,247,103,5,116,6,131,110,105,11,101,92,93,177,102,186,184,
+177,177,185,185,101,177,93,31,11,119,200,6,237,141,192,99,145,58,8,168,247,
+49,113,6,11,239,21,151,151,127,6,140,128,21,149,150,129,7,14,30,173,166,173,
+156,179,27,14,251,39,212,5,58,179,117,164,187,26,201,181,177,207,11,8,59,
+247,210,21,247,53,247,182,5,146,251,182,6,11,26,89,140,156,117,177,27,181,
+165,163,178,201,72,187,11,247,68,5,47,247,29,29,11,248,53,21,93,101,101,93,
+91,175,102,186,188,176,175,11,176,138,25,159,251,37,119,151,7,159,153,125,
+120,123,11,107,94,30,93,105,91,116,74,27,94,126,152,184,31,11,180,245,10,
+127,22,151,151,127,6,140,128,21,149,149,129,7,11,139,140,145,30,140,142,141,
+139,141,27,150,147,130,11,145,48,8,168,247,67,113,6,86,141,124,156,141,11,
+27,123,120,247,184,158,122,6,85,119,159,194,31,11,167,177,26,194,91,179,74,
+70,87,94,79,97,157,11,182,27,158,156,123,116,146,31,146,114,139,134,141,11,
+248,97,21,251,43,115,6,182,137,151,132,115,26,11,108,112,113,106,108,113,
+165,171,171,166,166,170,31,11,159,180,165,31,156,165,146,164,145,190,8,14,
+21,167,143,158,158,165,27,152,11,82,95,196,251,225,6,138,95,11,127,126,31,
+251,16,251,30,5,247,21,7,137,11,5,247,22,7,138,173,151,158,165,144,8,159,
+11,7,138,87,125,128,68,131,8,114,248,214,7,11,21,77,247,172,7,222,174,146,
+164,177,31,204,11,26,169,113,163,106,102,114,114,103,80,197,98,11,162,26,
+166,120,156,110,119,122,130,120,123,30,11,174,26,202,106,181,90,90,106,97,
+76,113,144,11,247,17,247,16,21,248,103,248,103,252,103,6,11,112,27,127,137,
+140,150,114,31,99,157,5,152,11,119,7,168,138,155,118,137,103,8,251,186,7,
+11,83,124,122,86,136,8,11,127,140,97,8,251,186,7,138,97,129,128,11,6,168,
+247,102,5,62,6,109,251,102,5,11,7,138,101,121,118,107,138,8,115,247,131,11,
+21,176,6,143,158,141,148,140,147,8,156,11,26,190,100,169,72,74,91,110,77,
+103,30,11,31,248,72,7,141,213,153,154,212,142,8,11,163,251,142,115,7,162,
+136,145,136,145,130,11,251,82,115,7,172,138,156,120,140,101,8,11,55,73,44,
+104,151,107,163,111,31,161,114,11,192,166,188,167,30,158,171,147,177,198,
+26,11,200,251,101,247,245,24,204,220,5,236,217,11,248,97,248,185,21,93,6,
+79,38,5,157,11,220,199,174,186,166,121,157,114,114,121,123,11,113,247,40,
+29,11,116,247,86,162,7,89,143,138,140,182,26,11,137,197,154,158,192,141,8,
+11,84,146,114,160,111,8,103,11,6,56,104,132,114,102,31,74,96,105,11,133,133,
+129,30,130,124,135,129,128,26,11,140,113,183,251,38,247,126,24,182,189,11,
+21,200,6,248,94,249,42,5,77,6,11,160,165,142,8,159,251,97,119,7,168,11,162,
+26,165,120,157,110,119,122,130,120,11,247,211,7,140,199,153,155,202,148,8,
+11,54,27,79,123,150,182,31,247,135,7,11,192,137,155,120,137,81,8,251,108,
+7,11,207,142,8,164,251,229,114,7,204,134,11,251,0,251,84,251,88,75,251,9,
+32,11,106,110,109,105,102,166,110,174,175,168,11,154,164,152,145,154,154,
+161,31,14,247,163,4,49,250,124,229,7,14,122,130,120,123,30,14,100,29,14,247,
+6,29,14,247,17,29,172,11,113,247,8,29,11,226,117,29,11,248,164,117,29,11,
+92,10,14,64,85,29,11,119,29,159,120,6,11,99,10,14,247,12,29,247,52,10,11,
+159,21,149,29,11,54,10,148,147,131,128,11,150,29,191,137,155,247,52,10,11,
+};
+#endif
@@ -0,0 +1,3011 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusRoman_BoldItalic_cff_size = 62238;
+asm(".section .rodata");
+asm(".global fz_font_NimbusRoman_BoldItalic_cff");
+asm(".type fz_font_NimbusRoman_BoldItalic_cff STT_OBJECT");
+asm(".size fz_font_NimbusRoman_BoldItalic_cff, 62238");
+asm(".balign 64");
+asm("fz_font_NimbusRoman_BoldItalic_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusRoman-BoldItalic.cff\"");
+#else
+const int fz_font_NimbusRoman_BoldItalic_cff_size = 62238;
+const char fz_font_NimbusRoman_BoldItalic_cff[] = {
+1,0,4,2,0,1,1,1,23,78,105,109,98,117,115,82,111,109,97,110,45,66,111,108,
+100,73,116,97,108,105,99,0,1,1,1,70,250,26,0,250,27,1,250,28,12,0,250,29,
+2,250,30,3,248,20,4,30,225,90,48,0,0,25,7,53,255,12,2,251,1,12,3,208,12,4,
+251,92,251,216,28,4,130,250,96,5,29,0,76,157,11,13,28,52,250,15,28,53,16,
+17,175,29,0,0,215,156,18,2,4,2,0,1,0,3,0,9,0,16,0,22,0,28,0,38,0,44,0,50,
+0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,0,123,0,136,0,142,0,148,0,
+154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,216,0,227,0,238,0,247,1,2,
+1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,1,103,1,115,1,126,1,138,
+1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,190,1,196,1,206,1,212,1,
+218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,2,38,2,44,2,50,2,61,2,
+73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,2,151,2,162,2,173,2,
+180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,3,20,3,27,3,34,3,40,
+3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,118,3,131,3,138,3,145,
+3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,3,216,3,222,3,234,3,
+246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,73,4,79,4,86,4,92,4,
+98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,163,4,168,4,175,4,179,
+4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,4,251,5,2,5,9,5,19,
+5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,5,127,5,136,5,141,
+5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,229,5,237,5,247,6,
+1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,112,6,121,6,128,6,
+137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,6,248,7,2,7,14,
+7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,115,7,122,7,134,
+7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,7,211,7,214,7,
+219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,1,8,4,8,11,8,
+14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,8,80,
+8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,8,127,8,132,
+8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,230,8,239,8,
+251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,134,9,154,9,
+163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,10,6,10,15,
+10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,114,10,123,
+10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,10,213,10,
+222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,46,11,53,
+11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,11,144,11,
+151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,214,11,221,
+11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,12,54,12,63,
+12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,153,12,162,
+12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,12,252,13,
+5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,102,13,111,
+13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,13,191,13,
+200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,14,18,14,
+25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,102,14,
+109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,14,179,
+14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,249,15,
+0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,15,84,
+15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,15,161,
+15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,82,16,94,73,74,65,98,114,
+101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,67,99,97,114,
+111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,99,114,
+111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,116,69,111,
+103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,99,99,101,110,
+116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,76,99,97,114,
+111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,110,103,97,114,
+117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,83,97,99,
+117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,114,105,
+110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,99,117,116,
+101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,117,110,
+105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,114,99,
+117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,114,
+99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,105,
+114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,73,
+109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,109,
+102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,109,
+97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,109,
+97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,114,
+99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,85,109,
+97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,73,98,
+114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,111,
+103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,111,
+116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,101,
+99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,110,
+101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,97,
+99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,82,111,109,97,110,32,66,111,108,100,32,73,
+116,97,108,105,99,78,105,109,98,117,115,32,82,111,109,97,110,1,37,2,0,1,0,
+139,0,251,1,66,1,75,1,192,2,54,2,163,2,181,3,24,3,133,3,146,3,235,4,15,4,
+18,4,23,4,97,4,107,4,112,4,188,4,240,5,15,5,117,5,213,6,92,6,187,6,201,7,
+20,7,59,7,181,8,44,8,76,8,191,9,48,9,67,9,74,9,98,9,120,9,222,9,249,10,10,
+10,22,10,119,10,176,11,12,11,103,11,179,11,185,11,243,11,249,12,61,12,141,
+12,219,12,230,13,46,13,116,13,119,13,188,13,217,13,223,14,33,14,40,14,85,
+14,90,14,151,14,183,14,243,15,9,15,51,15,68,15,98,15,154,15,183,15,237,15,
+244,15,251,16,22,16,38,16,48,16,66,16,111,16,122,16,146,16,190,16,235,17,
+2,17,45,17,49,17,91,17,133,17,146,17,163,17,203,17,243,17,249,18,0,18,22,
+18,31,18,68,18,88,18,102,18,106,18,141,18,176,18,211,18,222,18,237,18,253,
+19,31,19,65,19,98,19,131,19,144,19,176,19,207,19,238,20,13,20,22,20,30,20,
+60,20,90,20,118,20,145,20,174,20,203,20,213,20,242,21,15,21,23,21,32,21,38,
+21,49,21,76,21,94,21,121,21,146,21,157,21,183,21,209,21,235,22,4,22,29,22,
+46,22,71,22,83,22,107,22,117,22,140,22,147,22,158,22,181,22,187,22,200,22,
+222,22,242,23,8,23,29,23,50,23,71,23,92,23,113,23,134,23,146,23,165,23,170,
+23,188,23,208,23,228,23,238,24,1,24,20,24,39,24,58,24,77,24,95,24,100,24,
+118,24,135,24,153,24,164,24,175,24,180,24,196,24,204,24,209,24,224,24,241,
+25,2,25,19,25,34,25,51,25,68,25,85,25,100,25,110,25,114,25,126,25,140,25,
+156,25,172,25,188,25,204,25,211,25,227,25,243,26,1,26,16,26,31,26,46,26,61,
+26,67,26,82,26,97,26,103,26,118,26,124,26,137,26,145,26,159,26,173,26,187,
+26,201,26,215,26,229,26,235,26,244,26,253,27,10,27,23,27,36,27,49,27,62,27,
+75,27,88,27,101,27,114,27,120,27,133,27,146,27,159,27,172,27,183,27,194,27,
+201,27,213,27,225,27,237,27,249,28,5,28,17,28,29,28,41,28,53,28,65,28,75,
+28,83,28,91,28,99,28,107,28,118,28,129,28,140,28,151,28,162,28,173,28,184,
+28,195,28,206,28,217,28,228,28,239,28,250,29,5,29,14,29,23,29,29,29,33,29,
+41,29,51,29,55,29,69,29,76,29,81,29,88,29,93,29,104,29,111,29,132,29,156,
+29,169,29,180,29,190,29,212,29,217,248,222,247,86,21,114,144,104,82,118,114,
+100,112,25,100,83,71,120,53,27,96,121,149,163,146,141,150,145,159,31,141,
+143,140,146,141,147,141,145,24,195,247,101,5,247,6,137,169,120,71,26,125,
+138,127,136,120,30,167,134,213,247,165,111,143,92,45,113,126,251,24,140,25,
+200,247,115,5,174,149,151,148,180,27,211,194,124,112,166,31,162,115,146,114,
+77,26,166,134,182,247,82,5,252,176,114,6,174,133,160,135,146,135,8,145,135,
+143,130,128,26,125,135,115,133,117,30,251,15,252,85,123,86,127,128,87,131,
+25,114,248,190,7,11,248,70,247,19,21,83,98,124,125,123,27,132,134,145,148,
+164,149,181,163,220,31,210,247,128,251,3,132,121,80,5,190,130,117,160,96,
+27,251,15,251,42,251,84,251,48,63,182,88,204,200,184,175,235,197,31,127,98,
+137,127,125,26,102,169,110,176,186,185,178,226,197,30,251,81,247,200,21,161,
+138,154,120,112,26,79,105,251,3,101,70,30,90,112,109,113,112,27,113,120,162,
+170,191,172,239,180,213,31,169,192,172,170,166,137,8,11,248,85,249,65,21,
+66,65,113,89,71,31,251,13,51,53,251,53,251,31,26,251,35,234,43,247,33,218,
+215,165,188,206,30,247,16,231,221,247,51,247,38,26,247,25,36,237,251,31,30,
+136,105,21,199,180,91,68,251,13,77,251,92,72,247,51,29,186,213,241,247,18,
+29,11,192,29,107,90,124,126,104,29,11,248,107,247,27,247,13,29,145,160,158,
+195,31,175,247,1,5,155,186,149,183,163,26,188,113,165,92,102,103,124,113,
+112,30,102,104,120,115,72,40,203,247,90,24,75,125,59,128,83,137,8,112,7,181,
+151,133,120,127,125,85,107,251,4,31,116,57,132,113,113,43,8,247,13,6,186,
+247,65,176,226,200,220,8,166,159,170,161,157,27,152,151,129,128,136,137,131,
+136,129,31,84,251,58,5,123,91,127,82,113,26,101,164,117,182,199,180,173,236,
+197,30,11,153,248,47,21,157,144,138,135,146,31,156,130,155,97,154,68,8,172,
+251,54,156,44,108,26,116,130,115,121,114,30,111,118,112,118,122,27,132,121,
+146,146,130,31,151,122,114,148,121,27,113,115,113,110,105,166,113,174,194,
+204,178,206,194,31,247,22,247,51,247,11,247,129,240,26,173,110,169,106,108,
+113,112,109,114,146,127,163,121,30,158,125,144,131,126,26,108,122,99,69,251,
+26,30,127,214,117,247,11,113,247,3,121,186,25,90,127,103,133,75,133,8,11,
+155,248,43,21,164,148,138,132,147,31,159,121,153,46,142,251,30,141,61,24,
+135,139,138,138,104,30,138,94,5,166,6,196,225,196,235,148,154,186,227,25,
+162,251,177,5,166,6,247,77,247,88,226,247,25,223,26,172,111,168,106,109,113,
+111,107,124,145,126,154,118,30,153,121,145,125,129,26,109,108,92,51,35,30,
+107,247,224,5,112,6,55,251,37,123,110,83,38,136,247,17,132,203,116,225,93,
+130,118,135,51,124,8,11,249,57,249,65,21,103,29,251,47,247,1,35,247,55,97,
+29,5,11,152,247,187,21,167,136,155,183,155,155,170,140,25,247,37,6,251,184,
+251,246,164,117,150,147,5,146,149,144,143,140,27,146,149,144,141,148,27,159,
+158,130,115,174,31,103,192,176,125,180,27,200,186,178,191,167,114,163,111,
+112,116,115,111,128,142,130,149,128,31,144,132,141,135,135,26,130,130,132,
+126,121,127,151,174,122,30,107,200,115,163,88,160,247,173,247,227,24,149,
+251,204,7,11,247,3,249,24,21,98,29,251,15,252,85,123,87,124,125,90,133,25,
+114,247,188,164,7,81,143,125,147,169,26,153,144,164,148,171,30,194,247,85,
+5,168,6,246,251,223,5,247,94,164,6,82,144,130,147,117,198,56,247,138,24,194,
+150,164,149,171,160,8,190,173,168,190,194,26,236,62,186,251,51,30,251,168,
+6,247,114,63,21,175,148,148,147,170,27,196,172,105,78,73,111,78,95,112,31,
+113,122,100,132,77,138,8,11,21,104,110,109,103,131,29,247,104,22,247,65,29,
+247,198,249,49,21,251,87,114,6,194,134,148,133,158,95,251,12,252,47,24,100,
+251,23,132,128,84,128,8,114,247,100,164,7,80,144,118,154,178,26,158,145,172,
+151,181,30,238,247,248,247,149,252,185,5,167,6,247,35,248,142,177,247,23,
+145,148,197,152,25,164,251,101,114,7,198,134,160,123,101,26,120,132,105,128,
+98,30,59,251,179,5,11,147,29,247,21,248,114,155,194,158,152,205,143,25,164,
+251,209,114,7,98,29,251,15,252,85,123,87,124,125,90,133,25,114,248,189,7,
+11,126,29,14,177,29,247,64,29,247,123,247,15,21,92,106,120,120,126,27,132,
+134,145,146,143,140,143,143,152,31,243,247,254,251,80,112,133,115,5,140,146,
+146,140,144,27,155,154,125,125,131,135,117,135,125,31,77,251,103,5,133,119,
+136,121,123,26,92,165,111,183,166,160,150,168,172,30,161,159,150,154,164,
+180,8,11,21,83,6,251,27,42,48,247,26,29,247,155,50,29,11,247,79,21,242,248,
+23,247,41,29,151,118,29,251,163,66,29,143,153,247,232,248,36,251,1,252,45,
+127,94,121,121,104,136,25,132,6,133,117,5,247,165,118,29,110,6,113,140,122,
+155,165,26,143,140,146,141,146,30,247,23,248,127,151,184,156,157,174,196,
+29,112,26,134,138,134,137,129,30,11,248,190,247,86,21,112,144,59,251,16,62,
+97,251,36,141,25,69,6,248,70,248,241,5,168,252,104,7,82,251,70,167,135,212,
+245,206,178,247,4,141,25,217,6,252,70,252,241,5,110,248,142,7,11,247,182,
+161,21,111,247,39,29,148,139,142,141,146,30,247,23,248,127,247,41,29,151,
+118,29,251,163,6,134,70,29,14,247,74,249,42,21,133,117,5,167,247,29,29,251,
+23,252,127,127,94,121,121,104,136,25,124,6,133,117,5,247,214,6,187,190,154,
+164,175,31,189,175,174,204,197,26,178,119,180,108,166,30,113,160,118,150,
+89,154,189,144,167,148,178,164,8,193,174,167,184,193,26,227,71,187,251,18,
+30,251,11,251,223,96,29,247,48,248,224,21,210,170,112,78,71,106,76,91,113,
+31,126,114,118,135,95,27,14,247,1,248,33,24,155,192,153,151,190,146,8,164,
+251,190,114,7,98,29,92,251,65,5,251,131,6,193,247,91,231,29,134,145,135,225,
+29,120,132,112,30,251,14,252,85,123,87,125,126,89,132,25,114,247,188,164,
+7,76,144,129,145,171,26,154,143,157,148,170,30,141,146,140,144,140,143,189,
+247,73,24,247,131,6,75,251,124,125,85,119,125,72,135,25,114,247,209,7,11,
+248,251,247,84,21,114,144,105,83,118,114,100,112,25,100,84,72,121,54,27,95,
+122,149,164,145,142,150,144,158,31,141,145,140,144,143,153,193,247,99,24,
+247,6,137,168,120,70,26,126,138,128,137,120,30,166,134,211,247,162,111,143,
+93,46,114,126,251,23,140,25,198,247,113,5,174,149,151,148,179,27,211,193,
+124,112,166,31,162,116,146,114,77,26,166,134,180,247,80,5,252,170,115,6,191,
+131,139,139,150,133,8,145,135,143,130,129,26,125,135,115,133,117,30,251,11,
+252,81,123,87,127,128,88,131,25,114,248,184,7,11,247,245,21,220,251,151,5,
+145,123,140,132,130,26,115,123,123,115,30,127,6,133,117,5,247,147,6,145,161,
+108,137,118,159,117,190,25,251,3,247,220,247,56,247,45,195,184,178,157,186,
+144,25,144,161,5,251,115,6,133,117,5,151,6,156,152,124,120,119,123,111,113,
+115,31,251,78,251,67,196,247,107,247,41,29,161,118,29,251,177,141,29,247,
+165,118,29,108,6,11,126,27,131,130,148,146,141,140,143,141,145,61,29,14,247,
+172,248,94,21,251,75,193,29,222,29,80,141,125,149,115,217,29,95,116,121,120,
+119,27,123,131,152,169,134,31,126,236,121,164,80,142,183,149,156,158,175,
+217,8,166,151,149,150,151,27,146,143,136,130,143,31,120,148,147,133,247,34,
+29,124,123,251,0,83,31,76,108,107,115,87,27,11,249,30,249,49,21,252,187,6,
+101,251,63,164,132,190,239,203,181,241,140,25,251,40,252,173,5,88,125,113,
+118,88,27,125,114,247,223,156,29,5,11,248,136,248,80,21,251,10,6,88,251,86,
+119,83,127,115,113,99,25,93,109,126,127,122,27,131,134,145,150,147,141,149,
+141,150,31,228,247,232,251,73,113,133,116,5,140,143,143,139,142,27,159,153,
+124,117,132,138,131,137,130,31,78,251,123,5,134,118,135,114,122,26,102,167,
+111,176,185,171,165,241,217,30,134,123,136,127,136,131,8,133,119,136,122,
+127,26,114,162,121,169,196,191,184,222,178,30,119,147,5,94,118,121,113,127,
+27,135,136,143,144,144,140,145,144,156,31,11,31,197,247,70,5,159,201,149,
+180,158,26,186,110,167,92,103,110,127,109,103,30,108,112,115,110,83,58,246,
+248,52,24,61,124,89,131,59,132,8,112,7,140,147,148,139,144,27,167,152,128,
+116,130,137,127,133,118,31,251,46,252,203,5,247,13,6,190,247,70,160,189,189,
+212,8,199,181,172,168,165,27,151,149,129,128,133,137,131,136,130,31,137,131,
+135,128,134,125,135,126,135,128,136,130,8,91,251,32,126,89,98,26,105,166,
+115,178,200,179,172,242,205,30,11,21,85,104,119,119,122,27,131,133,146,149,
+151,150,187,153,184,31,217,247,160,5,251,10,6,83,29,83,133,114,183,29,11,
+248,60,248,196,21,102,6,80,35,5,144,121,129,140,125,27,251,42,251,31,251,
+50,251,62,82,163,99,192,109,31,67,251,18,5,179,6,203,247,6,5,133,159,152,
+137,157,27,247,40,247,28,247,47,247,61,203,114,180,82,167,31,251,135,252,
+2,21,147,7,213,176,247,32,175,204,30,184,164,168,162,171,27,152,148,135,129,
+149,31,153,97,21,140,137,139,138,137,26,79,112,251,10,110,70,30,63,108,108,
+106,100,27,123,128,144,152,129,31,11,247,125,247,106,21,132,247,26,129,188,
+104,196,251,25,109,24,132,113,5,152,6,167,156,120,102,144,31,146,91,156,251,
+122,140,80,8,95,7,140,135,139,131,129,26,117,120,126,130,129,27,132,130,144,
+154,119,31,158,113,123,146,122,27,110,117,114,106,100,170,111,182,196,189,
+183,247,43,247,5,31,247,25,247,70,201,247,5,202,26,180,107,175,103,110,116,
+113,107,116,146,128,165,124,30,159,128,147,128,125,26,102,78,32,70,57,30,
+11,21,247,44,226,5,170,157,147,149,247,71,29,170,157,147,149,247,64,29,6,
+134,70,29,143,29,11,21,251,3,247,39,5,161,123,118,151,120,27,115,118,118,
+115,247,27,29,247,25,50,5,14,247,35,248,173,247,75,29,252,128,127,94,122,
+122,104,136,25,131,6,133,117,5,11,247,41,247,80,21,178,166,5,251,62,171,168,
+86,201,27,189,174,171,231,190,31,117,150,5,91,112,123,123,120,27,111,127,
+175,247,86,101,31,202,194,207,197,161,152,184,144,25,164,251,99,114,7,178,
+137,151,134,123,26,113,101,102,251,18,41,30,247,15,248,95,63,125,87,131,59,
+131,25,112,7,140,147,148,139,143,27,168,152,128,116,130,137,127,133,118,31,
+251,48,252,203,5,247,14,6,11,195,29,139,135,137,133,30,251,23,252,127,127,
+94,121,121,105,136,25,131,6,133,117,5,247,165,6,11,21,243,185,207,216,212,
+26,192,108,130,29,104,104,68,101,30,14,77,29,193,100,235,194,179,147,165,
+212,30,11,248,4,247,14,21,113,112,135,136,128,129,8,123,118,110,129,112,27,
+81,108,178,213,31,161,7,205,140,176,148,185,164,8,206,176,181,195,194,26,
+191,105,168,80,251,42,251,20,251,35,251,60,96,150,102,160,114,30,110,164,
+185,119,183,27,204,200,177,217,200,31,251,111,245,21,247,0,157,201,244,184,
+27,157,152,123,116,100,119,84,114,111,31,112,108,101,121,93,136,8,11,233,
+249,24,21,209,128,142,137,110,26,129,136,123,130,106,30,251,13,252,82,124,
+88,122,124,91,133,25,114,247,178,7,247,148,247,81,247,61,247,119,247,63,251,
+4,241,251,81,31,251,182,6,247,116,70,21,119,29,11,247,18,21,94,118,121,113,
+127,27,135,136,143,144,144,140,145,144,156,31,231,247,244,5,251,10,6,88,251,
+86,119,83,127,115,113,99,25,93,109,126,127,122,27,131,134,145,150,147,141,
+149,141,150,31,228,247,232,251,73,113,133,116,5,140,143,143,139,142,27,159,
+153,124,117,132,138,131,137,130,31,78,251,123,5,134,118,135,114,122,26,102,
+167,111,176,11,81,159,85,175,97,31,156,120,152,129,170,121,60,251,28,24,187,
+6,209,247,12,5,129,170,160,136,170,27,215,214,165,188,206,31,247,16,231,222,
+247,50,247,38,26,190,122,192,109,177,30,120,164,123,153,100,161,8,252,24,
+252,215,21,132,159,135,161,161,26,241,188,247,67,197,242,30,226,188,194,182,
+200,27,164,158,133,124,158,31,166,102,21,148,11,144,161,5,251,162,6,133,117,
+5,161,6,166,138,155,123,113,26,135,138,131,137,133,30,76,251,129,5,118,90,
+106,131,99,27,90,112,159,175,155,142,155,151,182,31,173,247,22,151,184,157,
+247,67,29,165,138,156,123,113,26,134,138,132,137,133,30,99,251,45,5,132,113,
+136,123,123,26,70,11,21,96,107,235,29,14,248,54,247,76,21,79,248,114,5,251,
+108,6,134,117,191,133,150,135,155,118,25,251,22,252,126,153,29,247,13,248,
+94,212,252,208,5,156,6,248,24,248,208,251,21,252,120,127,95,120,120,104,136,
+25,116,6,133,117,5,11,107,29,98,117,161,11,151,184,157,157,174,142,25,151,
+6,144,161,5,251,162,6,133,117,5,161,6,165,138,156,123,113,26,134,138,132,
+137,133,30,251,36,252,178,5,251,104,6,247,34,248,173,152,184,156,247,67,29,
+166,138,155,123,113,26,133,138,133,138,133,30,251,37,252,178,5,11,249,49,
+21,251,189,114,6,174,133,160,134,145,135,8,145,136,144,129,130,26,127,135,
+116,132,113,30,251,6,252,68,5,251,41,100,124,111,103,27,120,131,145,151,146,
+141,144,147,148,31,150,152,141,145,153,26,175,111,166,104,103,111,109,99,
+80,203,97,227,247,0,205,200,247,23,174,30,247,20,248,115,156,11,83,251,86,
+111,74,81,67,8,101,108,117,122,119,27,125,132,147,156,154,140,145,153,184,
+31,233,247,200,5,134,129,137,136,126,31,77,128,64,129,95,137,8,112,7,185,
+136,149,134,119,26,123,134,111,130,110,30,99,251,25,5,125,89,132,106,114,
+26,90,164,114,189,206,169,165,247,36,242,30,121,11,21,251,217,6,122,69,5,
+247,218,6,14,247,205,248,89,21,251,27,251,20,251,42,251,51,48,192,78,220,
+177,175,152,166,180,31,226,198,194,241,245,26,229,86,203,64,30,121,105,21,
+165,155,118,104,76,109,251,20,105,59,31,93,119,115,116,109,27,112,120,167,
+179,185,167,247,15,168,215,31,192,158,170,169,174,27,11,122,146,94,149,193,
+147,164,148,168,160,8,182,170,164,190,194,26,224,74,195,39,112,105,134,132,
+114,30,131,112,139,139,130,27,124,132,144,154,136,31,119,6,97,251,67,5,158,
+6,232,190,191,184,195,27,181,160,111,82,73,116,86,98,111,31,119,109,112,132,
+83,27,11,92,29,14,231,154,177,172,205,26,204,93,172,47,97,106,132,125,112,
+30,103,119,117,107,108,26,110,158,120,166,164,160,157,161,148,136,148,132,
+148,30,127,153,138,141,146,26,156,171,153,175,182,160,120,103,103,123,102,
+115,121,30,128,125,119,133,113,27,131,134,139,141,128,31,11,6,178,247,37,
+5,104,6,85,59,89,121,29,157,157,209,175,247,16,31,147,170,146,163,157,203,
+8,222,6,14,93,29,247,188,7,11,111,30,126,6,133,117,5,247,157,6,145,161,100,
+142,125,157,105,234,25,60,247,126,247,10,247,23,233,243,175,169,171,142,25,
+226,29,251,84,6,133,117,5,150,6,161,153,126,116,119,133,127,112,109,31,251,
+8,251,22,93,247,30,5,130,165,137,148,11,146,29,100,60,97,30,11,164,21,82,
+142,124,148,167,26,155,143,160,153,189,30,247,6,248,56,155,192,154,152,190,
+145,25,164,251,190,114,7,98,29,251,15,252,85,123,87,124,125,90,133,25,114,
+11,247,119,95,29,11,21,120,118,130,129,122,121,8,68,66,109,99,118,26,132,
+145,134,146,148,152,148,157,158,30,152,151,149,147,163,157,247,62,247,16,
+24,148,7,48,231,94,185,107,176,8,147,132,136,141,134,27,130,133,132,131,124,
+148,113,163,90,31,11,21,177,158,136,130,155,31,170,124,160,100,97,26,96,124,
+88,116,107,30,97,111,97,118,87,27,125,129,140,143,120,31,11,210,205,161,182,
+196,31,168,161,156,157,171,183,109,161,24,89,80,111,116,97,121,8,127,111,
+108,133,108,27,45,83,204,247,1,247,37,211,247,66,230,215,31,170,176,178,154,
+180,27,220,189,79,41,126,138,131,137,125,31,171,133,11,171,134,153,137,149,
+136,146,135,25,145,135,143,130,129,26,127,134,108,134,121,30,11,247,33,21,
+72,91,108,116,96,27,95,110,175,192,202,165,229,175,204,31,186,166,167,163,
+170,27,151,149,132,129,135,137,133,133,130,31,130,124,135,127,199,29,11,247,
+4,29,157,98,108,147,114,173,29,129,165,151,136,247,57,29,157,210,5,238,164,
+169,189,175,27,149,146,134,131,136,138,137,135,133,31,131,127,136,130,129,
+26,111,160,118,167,11,251,74,113,133,116,5,140,143,143,139,142,27,159,153,
+124,117,132,138,129,137,132,31,117,57,5,133,115,136,123,123,26,97,164,112,
+179,192,177,167,236,216,30,94,251,63,5,134,122,137,123,126,26,104,166,114,
+178,11,109,6,117,126,129,132,124,27,131,124,142,144,124,31,153,94,94,146,
+98,27,251,115,251,77,251,93,251,135,11,103,131,25,114,247,88,164,7,93,120,
+150,163,153,144,154,149,156,31,198,241,5,247,107,6,149,65,144,98,129,26,98,
+124,128,75,133,30,114,247,196,7,252,68,247,140,21,247,40,247,135,176,251,
+135,5,11,179,29,247,25,50,5,14,247,108,247,33,176,29,11,26,92,184,105,200,
+190,186,168,185,164,30,117,153,134,137,138,138,131,135,25,129,119,129,136,
+123,27,11,130,97,5,212,6,86,251,127,110,251,18,133,108,128,29,11,203,29,207,
+247,150,5,190,168,29,11,104,111,110,103,105,169,109,173,174,169,168,173,175,
+109,169,103,31,11,251,56,5,162,6,181,215,202,181,218,143,251,34,252,168,24,
+127,94,121,121,104,136,8,98,6,133,117,5,247,215,118,29,94,6,113,122,156,164,
+146,140,144,140,146,31,11,152,127,5,142,151,146,140,150,125,29,11,127,94,
+121,121,105,136,25,103,6,133,117,5,247,190,118,29,114,6,112,140,123,180,29,
+11,21,165,137,154,117,137,106,135,74,107,39,103,74,8,85,108,107,111,105,27,
+117,122,155,159,155,147,173,165,226,31,163,220,150,168,155,163,164,178,172,
+164,165,137,8,14,128,27,133,136,142,148,135,31,158,129,127,147,119,27,109,
+119,118,107,102,165,115,178,163,161,148,156,151,31,156,160,149,165,168,237,
+8,247,50,184,172,194,186,27,149,6,11,247,40,29,127,123,144,150,113,31,157,
+98,107,147,114,27,82,94,93,67,126,136,29,11,247,162,249,10,21,92,101,102,
+93,92,176,101,186,185,177,177,185,185,101,177,94,31,248,94,22,92,101,102,
+93,92,177,101,185,185,177,177,185,184,101,178,94,31,11,6,226,29,11,166,146,
+155,150,170,27,247,4,193,80,251,13,251,7,105,251,11,85,62,31,62,86,68,103,
+44,27,101,123,149,163,151,142,154,148,166,31,141,140,141,139,30,11,110,6,
+120,128,136,137,124,27,129,131,141,146,121,31,149,114,127,142,118,27,58,86,
+90,62,85,153,111,205,60,31,177,94,157,105,114,26,109,114,115,107,116,11,97,
+60,109,8,104,190,7,71,251,130,145,29,11,21,104,110,109,103,131,29,247,104,
+22,104,110,110,102,131,29,14,21,161,138,154,119,111,26,94,96,251,20,104,74,
+30,90,111,111,114,109,27,114,121,167,174,141,31,142,193,170,231,175,204,171,
+196,175,171,169,137,8,11,249,59,21,251,77,110,134,117,5,145,6,163,155,125,
+117,128,138,133,131,110,31,73,6,130,104,5,205,6,251,26,252,147,5,247,9,6,
+177,247,35,11,190,29,172,206,29,11,218,29,247,23,234,5,11,24,113,7,60,134,
+21,247,37,29,170,170,114,165,110,31,247,77,22,247,37,29,11,247,3,29,141,142,
+141,189,29,11,89,140,124,146,163,26,152,146,171,158,208,30,146,163,139,141,
+143,154,8,121,174,151,135,160,27,247,28,247,33,247,72,247,66,213,97,186,11,
+174,93,102,112,111,101,115,148,125,166,120,30,160,126,145,130,126,26,107,
+11,105,169,109,173,175,169,168,174,175,109,169,103,31,11,138,29,86,11,21,
+251,8,88,64,54,57,26,80,173,100,190,180,169,170,181,166,129,155,108,159,30,
+117,154,132,149,154,26,174,178,178,218,181,30,11,21,251,94,251,54,251,53,
+251,93,251,88,247,54,251,55,247,89,247,89,247,56,247,55,247,88,247,88,251,
+55,247,58,251,85,31,11,69,121,104,78,31,251,24,62,52,251,43,251,45,26,251,
+52,247,12,251,1,247,68,217,238,158,166,196,30,167,152,187,247,73,158,11,31,
+179,6,171,152,151,150,162,167,29,11,134,117,5,160,6,165,138,156,122,113,26,
+132,184,29,11,140,150,190,29,171,132,176,27,210,192,176,189,181,101,169,11,
+248,34,21,221,247,78,140,140,141,144,142,147,25,149,161,140,142,152,26,166,
+119,161,114,100,102,104,101,136,30,123,251,106,5,11,189,176,232,195,31,147,
+93,147,119,156,118,8,111,161,179,123,187,27,223,206,186,227,182,31,111,156,
+5,80,105,97,109,91,27,11,6,133,117,5,170,6,165,156,122,114,132,138,134,138,
+132,31,251,23,252,127,127,94,121,121,104,136,25,130,6,133,117,5,11,30,172,
+169,169,149,203,144,8,247,18,22,181,129,151,133,155,116,8,161,109,149,102,
+90,26,251,2,94,251,9,75,81,30,11,226,29,111,247,39,29,148,139,142,141,146,
+30,11,104,109,109,104,125,124,143,146,127,31,156,109,131,142,121,27,100,114,
+115,102,103,166,118,183,245,246,242,241,188,113,166,11,5,124,87,130,96,121,
+26,100,167,113,181,199,179,172,242,205,30,117,153,5,86,105,113,112,123,27,
+131,131,146,147,11,21,247,8,190,214,225,220,26,198,105,178,88,98,109,108,
+97,112,149,123,169,119,30,162,124,146,129,125,26,103,100,11,248,226,247,86,
+21,115,144,105,83,117,114,100,111,25,101,85,68,119,57,27,94,120,148,160,147,
+141,152,142,150,31,11,138,134,247,30,29,104,136,25,11,157,174,142,25,151,
+118,29,11,141,148,141,149,30,225,142,179,144,185,155,8,247,24,183,216,245,
+247,28,26,247,30,52,227,251,40,151,30,151,11,251,74,113,133,116,5,140,143,
+144,139,141,27,160,153,124,117,132,138,132,136,129,31,48,251,241,5,247,9,
+6,11,21,203,253,3,7,247,102,220,116,192,251,178,251,19,5,62,7,247,178,251,
+20,162,191,251,102,221,5,14,124,79,113,107,102,134,25,133,117,5,247,68,118,
+29,96,143,115,160,171,26,148,141,151,143,153,30,11,251,54,251,53,251,92,251,
+88,247,54,251,54,247,87,247,89,247,55,247,55,247,87,247,88,251,54,247,57,
+11,21,169,6,168,151,146,145,158,27,149,152,136,131,162,31,122,188,173,132,
+179,27,247,32,228,218,247,15,227,11,242,29,247,32,248,142,247,54,29,11,251,
+90,228,21,247,31,175,185,215,187,27,158,148,128,116,95,122,96,107,106,31,
+112,110,114,125,82,121,8,11,108,99,99,121,136,141,167,118,30,158,126,125,
+148,123,27,117,124,122,115,107,171,121,193,244,225,210,226,178,11,247,66,
+29,128,100,247,1,29,21,227,29,123,128,100,247,1,29,247,2,29,113,121,11,151,
+184,157,157,173,196,29,113,26,131,11,251,43,6,160,229,154,181,160,174,8,177,
+163,170,160,172,27,157,157,130,129,137,138,138,134,131,31,11,21,73,108,247,
+22,29,138,133,139,134,137,26,38,183,91,233,235,11,26,36,189,74,219,205,189,
+172,218,195,30,141,74,139,139,141,127,8,116,144,147,127,151,27,174,180,11,
+158,157,174,142,25,161,118,29,251,185,6,133,117,5,170,6,165,156,122,115,132,
+138,133,137,11,27,150,153,136,134,152,31,198,116,5,11,6,231,142,202,94,145,
+64,8,157,6,180,247,46,5,252,111,6,133,117,5,164,6,165,138,156,11,31,184,186,
+167,212,209,26,213,100,184,73,30,160,106,21,173,164,104,94,87,118,72,110,
+97,31,11,115,119,136,25,133,117,5,247,66,6,144,161,5,124,6,115,122,153,160,
+154,144,152,155,160,31,11,6,133,117,5,161,6,164,138,156,123,115,26,130,139,
+135,137,132,30,251,33,252,127,125,94,11,133,25,112,7,183,154,132,117,131,
+136,124,135,122,31,81,251,107,5,131,110,134,113,125,26,11,27,82,93,93,67,
+126,31,179,6,171,152,152,150,161,167,29,11,111,110,103,88,194,109,231,246,
+210,179,199,168,121,156,109,107,113,118,112,137,139,136,140,134,11,151,118,
+29,251,163,6,133,117,5,161,6,11,21,125,119,5,100,113,116,118,124,27,131,132,
+146,147,148,144,165,143,156,31,230,247,226,11,21,247,44,226,5,169,156,148,
+150,11,140,150,144,139,149,27,183,153,126,101,65,100,84,87,101,112,158,188,
+107,31,118,126,11,201,29,122,161,125,31,11,155,165,26,144,140,146,141,145,
+240,29,11,95,27,127,134,142,145,143,141,142,144,145,31,148,149,142,145,150,
+26,167,117,160,110,11,6,134,247,56,29,11,110,26,98,160,120,183,199,188,179,
+228,191,30,11,139,135,137,133,30,251,23,252,127,127,94,122,121,104,136,25,
+131,6,133,117,5,11,26,176,158,156,178,30,157,118,29,251,182,6,133,117,5,152,
+6,178,156,11,104,30,225,178,21,98,176,128,157,165,26,169,159,160,167,167,
+156,119,106,108,127,11,6,79,87,5,82,7,247,154,247,114,251,154,247,114,5,82,
+7,199,87,5,11,8,200,247,16,144,150,173,26,172,115,162,105,117,115,128,122,
+127,30,127,124,11,143,31,147,151,143,150,150,26,163,115,163,113,112,115,114,
+110,91,178,108,199,11,27,169,156,126,116,114,117,123,105,117,122,143,152,
+111,31,117,106,5,121,182,11,247,118,21,65,110,106,104,88,26,82,190,98,211,
+219,201,194,208,176,121,176,11,248,229,164,21,73,144,134,144,126,215,43,248,
+208,24,114,6,252,8,252,224,11,247,24,29,133,136,129,31,48,251,242,5,11,21,
+104,108,108,105,100,168,109,176,177,170,168,176,176,108,170,101,31,14,247,
+56,29,131,11,142,25,151,118,29,251,163,6,134,117,5,160,6,166,138,155,123,
+11,159,6,214,176,103,67,251,0,71,56,51,74,89,179,222,97,31,110,126,11,199,
+191,5,196,7,251,154,251,114,247,154,251,114,5,196,7,79,191,5,11,127,26,109,
+163,117,173,247,17,29,11,21,112,116,116,113,111,162,116,166,166,162,162,166,
+166,116,162,112,31,11,21,251,3,247,39,5,161,122,119,151,120,27,115,118,118,
+115,123,151,11,152,127,5,142,151,146,140,151,27,168,156,126,116,114,117,123,
+105,117,11,31,160,6,200,247,122,5,118,6,111,75,88,106,68,140,8,97,6,11,121,
+83,125,129,70,134,25,114,247,214,164,7,74,142,127,146,176,26,11,5,143,127,
+141,129,130,26,115,122,122,116,30,126,6,133,117,5,11,132,175,230,29,11,160,
+31,206,251,145,85,251,97,127,94,121,121,104,136,25,107,6,11,186,143,25,226,
+29,251,117,6,133,117,5,151,6,155,152,124,11,94,111,115,112,124,27,133,134,
+145,145,148,161,226,174,247,19,31,11,247,53,29,166,173,174,111,168,107,31,
+11,118,26,128,141,132,144,125,247,49,29,11,151,113,30,246,29,247,163,247,
+174,21,251,137,6,115,251,8,5,247,138,6,14,142,25,178,6,144,161,5,11,226,29,
+111,6,11,118,29,104,6,113,122,156,164,146,140,144,140,146,31,11,8,99,155,
+165,119,173,27,184,167,166,236,193,31,120,152,5,11,21,190,6,53,247,66,5,58,
+6,251,52,251,66,5,196,6,11,34,251,28,26,43,178,70,216,98,30,176,119,166,133,
+200,134,11,173,142,8,151,118,29,251,238,252,239,21,66,150,103,11,194,146,
+157,156,174,25,199,168,175,186,156,27,143,145,135,130,11,247,9,6,195,247,
+107,5,148,6,161,138,150,121,144,90,145,11,236,228,247,5,190,112,189,94,171,
+31,101,166,105,146,32,142,11,250,101,247,161,21,254,124,6,122,48,5,250,124,
+6,14,8,146,135,143,130,127,26,127,135,11,145,161,5,11,247,44,226,5,170,157,
+147,149,247,42,29,11,131,6,133,117,5,247,168,118,29,110,6,113,140,11,21,82,
+6,252,63,253,70,5,197,6,247,229,247,118,21,11,27,210,192,176,189,181,101,
+169,87,129,133,138,137,129,31,11,155,194,159,154,204,141,25,164,251,209,114,
+7,174,133,160,11,31,247,37,248,159,51,122,92,132,65,133,25,112,7,140,11,164,
+21,247,19,29,141,11,247,217,247,155,21,195,251,52,5,142,128,141,129,128,26,
+11,107,97,97,170,107,181,181,172,171,181,179,106,173,99,31,11,239,21,151,
+151,127,6,140,128,21,149,150,129,7,14,131,147,147,150,147,174,152,188,31,
+140,143,212,247,175,11,21,73,107,105,115,73,27,75,107,168,200,133,31,96,11,
+146,149,26,166,117,161,112,112,117,115,110,93,181,108,11,30,247,22,248,127,
+152,184,156,157,174,142,25,151,6,11,251,74,247,24,29,11,164,6,68,142,127,
+145,171,26,154,143,160,146,165,30,11,172,30,153,105,112,143,70,27,251,172,
+77,247,183,6,11,247,23,29,110,168,11,117,26,251,8,76,251,95,73,44,30,73,93,
+94,108,11,95,159,179,247,38,29,112,26,100,164,116,182,200,177,170,244,208,
+30,14,103,30,251,14,251,23,5,14,247,44,226,5,169,156,148,150,158,26,165,117,
+160,11,8,251,40,108,120,98,99,27,129,131,144,145,141,11,21,107,124,126,129,
+116,27,127,123,144,150,113,31,11,27,123,120,247,184,158,122,6,85,119,159,
+194,31,11,30,247,6,248,74,79,126,101,134,251,2,129,25,11,202,247,133,5,247,
+2,132,162,124,75,26,131,139,11,247,33,247,31,29,11,21,244,185,206,216,212,
+26,192,11,67,6,178,247,37,5,104,6,11,251,165,6,133,117,5,167,6,165,156,122,
+113,11,21,251,7,93,115,103,109,27,118,127,170,192,11,21,77,99,126,125,122,
+27,131,133,146,149,149,11,154,152,148,157,157,25,163,164,152,166,164,26,11,
+30,247,33,248,127,152,184,157,157,174,142,25,11,249,13,249,144,21,90,6,86,
+47,5,149,107,11,176,164,167,181,193,94,175,72,251,33,251,36,11,190,247,76,
+194,236,31,229,190,192,180,204,27,11,84,141,121,149,168,26,154,143,159,154,
+191,30,11,249,63,247,46,29,11,247,17,247,16,21,248,103,248,103,252,103,6,
+11,104,115,74,27,75,106,168,200,134,31,96,6,11,111,112,104,104,168,110,174,
+173,166,166,174,174,11,114,133,116,5,150,6,160,153,124,117,132,138,11,24,
+247,21,6,148,174,5,251,21,6,14,236,5,89,6,227,251,66,5,221,6,14,123,151,123,
+161,124,31,11,6,54,251,102,5,217,6,224,247,102,5,11,6,165,156,122,113,133,
+138,133,138,133,31,11,138,133,30,251,23,252,127,127,94,121,121,11,21,80,99,
+119,118,121,27,131,132,146,147,11,26,103,166,115,180,200,177,170,244,208,
+30,11,27,128,127,146,144,142,140,140,143,145,31,11,156,27,168,158,162,174,
+175,118,160,101,95,11,47,252,38,5,251,36,106,124,108,104,27,11,218,105,30,
+125,173,166,135,208,27,247,172,11,109,115,115,108,107,164,113,169,168,163,
+164,11,117,201,27,236,203,197,243,157,31,14,6,113,140,122,155,164,26,11,21,
+108,124,126,128,116,27,11,151,184,157,157,173,142,25,11,158,26,165,117,160,
+113,121,11,128,128,149,149,144,142,143,146,144,31,11,6,56,104,132,114,102,
+31,74,96,105,11,137,131,31,40,251,245,5,247,10,6,11,21,81,6,252,71,253,77,
+5,197,6,11,21,145,159,152,142,148,27,166,155,117,11,27,83,101,190,214,247,
+2,187,247,65,11,30,144,127,140,134,131,26,113,126,122,11,31,168,6,188,247,
+67,5,113,6,101,11,41,31,72,93,94,109,85,27,76,100,11,198,175,169,244,207,
+30,119,150,5,86,11,105,113,112,105,104,166,110,173,172,165,11,233,138,178,
+96,144,251,3,25,166,137,11,113,132,116,5,150,6,159,153,124,118,11,117,5,160,
+6,166,138,155,123,113,26,11,157,27,200,174,174,223,161,31,14,90,27,127,131,
+140,143,123,31,14,203,197,243,157,30,14,134,195,29,11,251,216,247,9,29,108,
+174,11,117,160,113,121,123,127,101,247,1,29,161,29,123,11,247,42,29,122,127,
+101,104,30,251,14,251,23,5,14,104,110,109,103,131,29,14,21,247,63,29,11,157,
+174,142,25,175,29,11,26,132,148,29,11,182,29,131,139,135,137,133,30,251,23,
+11,214,29,251,189,182,29,11,247,42,29,122,127,101,104,30,251,14,251,23,5,
+247,130,22,247,44,226,5,11,133,30,251,23,252,127,127,94,121,121,105,136,25,
+131,6,133,117,5,247,165,6,215,29,11,81,54,152,127,5,142,151,146,140,150,190,
+29,11,184,29,247,165,6,215,29,113,140,122,11,162,29,139,135,137,133,30,251,
+23,11,6,196,247,104,247,41,29,178,6,144,161,5,251,189,247,69,29,252,127,127,
+94,11,70,29,143,29,14,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,1,135,255,2,135,
+254,2,243,2,0,1,0,4,0,7,0,75,0,86,0,154,1,48,1,246,2,155,2,163,2,220,3,22,
+4,6,4,32,4,39,4,43,4,67,4,87,4,177,4,238,5,55,5,158,5,208,6,30,6,124,6,158,
+7,10,7,115,7,128,7,141,7,170,7,192,7,219,8,38,8,216,8,220,9,108,9,112,9,116,
+9,120,9,200,9,204,9,218,9,223,9,234,9,238,9,242,10,106,10,110,10,114,10,120,
+11,31,11,35,11,39,11,43,11,47,11,126,11,131,12,27,12,31,12,35,12,79,12,98,
+12,141,12,171,12,182,12,189,12,192,13,37,13,42,13,45,13,50,13,58,13,61,13,
+73,13,79,13,116,13,119,13,124,14,51,14,55,14,58,14,113,14,235,14,240,14,245,
+14,255,15,3,15,91,15,95,15,234,15,239,15,244,16,88,16,100,16,200,17,2,17,
+71,17,184,18,94,18,98,18,235,19,105,20,30,20,130,20,137,20,147,20,164,20,
+171,20,178,21,9,21,100,21,115,22,19,23,20,23,28,23,145,23,170,23,177,23,192,
+23,203,23,213,23,233,24,178,24,254,25,6,25,14,25,22,25,30,25,38,25,56,25,
+65,25,73,25,81,25,94,25,114,25,148,25,156,25,160,25,183,26,37,26,91,26,123,
+27,75,27,142,27,194,27,199,27,214,27,217,28,128,29,41,29,77,29,93,29,217,
+30,92,30,95,30,127,30,164,30,222,30,233,31,8,31,27,31,71,31,130,31,170,31,
+193,32,54,32,66,32,172,32,216,32,254,33,74,33,82,33,91,33,99,33,108,33,116,
+33,125,33,161,33,170,33,176,33,185,33,193,33,202,33,209,33,218,33,227,33,
+235,33,242,33,250,34,2,34,24,34,46,34,55,34,63,34,71,34,80,34,88,34,97,34,
+106,34,130,34,136,34,162,34,169,34,181,34,188,34,213,35,5,35,14,35,24,35,
+33,35,43,35,52,35,73,35,83,35,92,35,100,35,106,35,113,35,120,35,126,35,143,
+35,153,35,162,35,170,35,179,35,187,35,196,35,206,35,216,36,75,36,148,37,37,
+37,183,38,41,38,178,39,63,39,156,39,235,40,27,40,101,40,184,40,219,41,57,
+41,139,42,8,42,28,42,76,42,85,42,93,42,104,42,129,42,132,42,140,42,150,42,
+171,42,180,42,191,42,201,42,210,42,228,42,236,42,253,43,5,43,13,43,22,43,
+31,43,90,43,98,43,107,43,115,43,124,43,134,43,143,43,152,43,179,43,188,43,
+198,43,207,44,56,44,64,44,90,44,106,44,116,44,143,44,159,44,168,44,177,44,
+186,44,195,44,204,44,246,44,255,45,8,45,76,45,84,45,110,46,53,46,170,46,178,
+46,210,46,219,46,229,46,239,47,8,47,74,47,84,47,95,47,133,47,141,47,172,47,
+181,47,200,47,209,47,217,47,246,47,255,48,8,48,17,48,41,48,86,48,95,48,104,
+48,113,48,124,48,226,49,7,49,15,49,24,49,41,49,50,49,67,49,77,49,95,49,107,
+49,117,49,158,49,165,49,212,49,221,49,229,50,24,50,49,50,57,50,106,50,116,
+50,166,50,206,51,88,51,164,51,180,52,71,52,79,52,87,52,91,52,95,52,254,53,
+53,53,57,53,65,53,119,53,147,53,179,53,223,53,238,53,252,54,14,54,36,54,67,
+54,75,54,102,54,110,54,137,54,215,54,238,55,60,55,114,55,150,55,194,56,6,
+56,79,56,133,56,234,57,118,57,163,57,229,58,12,58,27,58,36,58,44,58,52,58,
+61,58,70,58,71,58,74,58,187,59,8,59,79,59,126,59,252,60,88,60,206,61,33,61,
+107,61,239,62,20,62,86,62,177,62,190,62,195,62,211,62,227,62,234,62,241,63,
+39,63,72,63,89,63,103,63,126,63,167,63,182,63,214,63,233,64,30,64,84,64,125,
+65,29,65,55,66,19,67,10,67,41,67,67,67,107,67,148,67,200,67,232,68,6,68,117,
+68,179,68,241,69,99,69,142,69,183,69,201,70,14,70,83,70,126,70,147,71,11,
+71,119,71,198,71,239,72,37,72,97,72,236,73,99,73,199,74,101,74,181,74,205,
+74,235,75,11,75,57,75,105,75,202,75,225,75,248,76,23,76,42,76,53,76,160,76,
+247,76,251,77,10,77,24,77,56,77,120,77,159,78,24,78,73,78,125,78,206,78,221,
+78,236,79,111,79,114,79,117,79,202,79,247,80,17,80,70,80,81,80,234,80,245,
+81,5,81,39,81,62,81,130,81,254,82,64,82,96,82,137,82,211,82,227,82,231,83,
+25,83,38,83,221,84,128,84,181,85,55,85,174,86,49,86,54,86,168,86,172,87,17,
+87,22,87,143,87,233,88,130,88,222,89,127,89,130,90,3,90,88,90,178,91,13,91,
+18,91,148,91,234,92,111,92,118,93,5,93,152,94,14,94,157,94,179,94,194,94,
+236,95,35,95,68,95,160,95,249,96,26,96,95,96,220,97,28,97,56,97,93,97,178,
+97,226,98,1,98,48,98,92,98,137,98,179,98,213,98,252,98,255,99,55,99,58,99,
+62,99,175,99,218,100,182,100,222,100,227,101,5,101,91,101,122,101,131,101,
+211,101,254,102,41,102,130,102,146,102,153,102,203,102,216,103,10,103,54,
+103,84,103,141,103,175,103,242,104,39,104,180,105,28,105,141,105,210,106,
+62,106,204,107,88,107,92,107,96,107,100,107,177,108,36,108,153,108,243,109,
+48,109,143,110,109,110,145,111,1,111,127,112,48,112,161,112,216,112,253,113,
+44,113,70,113,105,113,143,113,183,114,38,114,57,114,133,114,204,115,62,115,
+213,116,104,116,167,116,175,116,206,117,88,117,234,118,74,118,125,118,188,
+118,242,119,40,119,157,119,239,120,82,120,88,120,196,120,201,121,109,121,
+138,121,142,121,147,121,211,122,81,122,149,122,187,123,34,123,159,123,235,
+124,129,124,134,125,75,125,222,126,18,126,217,127,108,127,245,128,40,128,
+139,128,225,129,110,129,186,130,32,130,122,130,238,131,79,131,184,132,15,
+132,99,132,204,133,3,133,48,133,92,134,3,134,197,134,227,135,44,135,56,135,
+148,135,196,135,205,136,12,136,49,136,131,136,166,136,232,137,128,137,149,
+138,25,138,153,138,245,139,136,140,15,140,79,140,99,140,107,140,214,141,91,
+141,186,141,227,142,55,142,137,143,35,143,231,144,87,145,15,145,92,146,18,
+146,220,147,82,148,42,148,211,149,71,149,150,149,240,150,19,150,54,150,88,
+150,122,150,136,150,150,151,14,151,88,151,125,151,138,151,163,151,191,151,
+220,152,96,152,123,152,146,152,214,153,9,153,58,153,160,153,217,154,24,154,
+90,154,111,154,131,154,151,154,192,154,242,155,35,155,84,155,134,155,161,
+155,188,155,216,155,244,156,9,156,48,156,94,156,128,156,162,252,39,14,252,
+39,14,251,156,247,88,247,96,21,181,247,0,183,237,196,247,4,8,165,185,144,
+155,166,26,183,111,168,98,108,115,122,110,125,30,131,121,137,128,137,96,134,
+60,121,251,11,109,251,48,8,113,58,21,97,107,107,97,98,170,110,181,181,172,
+170,178,178,104,174,100,31,14,41,247,69,139,29,247,193,22,147,10,14,248,85,
+247,175,21,52,6,193,247,26,5,236,6,159,212,5,51,247,28,10,251,5,247,28,10,
+34,6,119,66,5,235,6,85,251,26,5,33,6,119,66,5,235,247,28,29,247,5,247,28,
+29,236,6,48,247,99,21,85,251,26,5,251,5,6,193,247,26,5,14,248,133,248,234,
+21,121,153,102,163,91,159,106,144,25,159,211,5,89,6,121,74,5,141,119,131,
+139,129,27,251,4,55,61,35,71,165,103,245,58,31,65,251,153,69,171,119,179,
+136,247,0,25,117,145,97,251,34,192,92,170,122,202,124,25,110,32,5,191,6,167,
+240,162,138,5,247,15,134,247,0,233,247,4,26,210,112,180,251,5,236,30,198,
+247,107,5,199,119,163,103,70,26,133,139,126,138,128,30,160,134,5,251,99,110,
+21,86,179,122,165,179,26,197,182,176,206,145,143,139,137,144,30,89,251,253,
+21,194,95,154,113,92,26,83,110,95,92,121,30,133,122,131,138,103,27,14,247,
+72,249,56,248,12,21,90,94,119,100,96,31,85,87,104,66,75,26,56,192,84,219,
+184,185,159,173,171,30,193,196,172,221,216,26,209,92,185,69,30,171,88,21,
+169,137,160,111,100,26,97,125,93,112,90,30,85,109,104,110,103,27,109,117,
+164,171,141,31,142,183,173,231,170,183,162,174,165,157,163,138,8,252,150,
+251,225,21,195,6,248,30,249,80,5,100,6,90,81,91,119,76,27,97,113,147,159,
+111,31,160,110,120,146,110,27,251,5,251,3,251,15,251,17,59,192,82,214,200,
+192,170,196,178,31,182,201,156,196,140,228,8,135,161,149,138,150,27,176,178,
+148,157,182,31,251,148,158,21,145,141,137,133,146,31,147,131,140,139,146,
+136,8,167,128,140,137,117,26,251,6,64,251,15,69,110,118,162,170,141,30,142,
+186,173,230,172,188,161,172,163,158,156,137,8,14,247,17,249,53,240,21,110,
+110,118,128,112,27,100,107,160,190,100,31,247,29,247,77,145,145,201,151,8,
+164,251,104,114,7,181,132,153,130,117,26,111,122,110,82,67,30,98,205,106,
+226,127,213,8,247,17,189,196,194,206,26,206,81,186,59,251,2,64,56,251,15,
+114,142,117,147,94,30,251,8,89,107,121,104,103,8,103,101,118,91,93,26,40,
+217,71,247,7,209,195,157,184,205,30,95,184,180,121,192,27,205,182,163,213,
+200,31,252,82,247,155,21,165,251,3,166,74,195,52,8,118,99,113,132,108,27,
+66,85,198,218,209,170,180,223,181,31,247,5,230,21,130,197,137,152,164,26,
+216,164,181,184,172,158,114,97,79,107,96,60,94,30,14,251,212,247,3,248,5,
+87,29,251,212,247,218,249,65,21,251,44,251,4,79,74,93,35,8,112,79,126,74,
+67,26,251,29,180,251,3,240,251,30,30,162,154,5,84,236,123,200,247,8,26,247,
+20,164,247,21,182,235,30,175,219,176,187,220,213,8,14,251,212,112,251,71,
+21,247,10,223,189,188,190,218,8,192,220,165,227,236,26,213,123,217,108,213,
+30,116,194,118,173,87,210,116,124,24,193,49,157,72,251,6,26,251,25,107,251,
+44,89,39,30,107,75,108,100,63,69,8,14,247,145,248,118,21,128,145,110,156,
+127,152,115,176,25,174,117,122,152,115,27,114,115,113,111,122,148,126,156,
+128,31,130,153,149,137,168,27,183,138,152,136,172,120,150,133,24,128,133,
+106,121,127,136,94,137,25,110,127,136,132,127,31,123,130,129,123,123,26,110,
+162,114,166,164,155,151,175,160,30,160,175,150,149,172,159,150,145,24,127,
+7,136,95,137,131,118,102,8,127,117,134,126,125,26,107,159,119,170,169,159,
+159,171,154,135,151,126,161,30,118,176,137,147,136,183,8,151,7,150,133,172,
+119,150,129,160,103,25,103,160,155,127,164,27,166,162,164,168,155,129,155,
+123,148,31,146,127,127,142,110,27,94,141,127,142,106,157,128,145,24,150,145,
+172,158,152,142,183,140,25,168,149,141,148,153,31,156,150,148,152,156,26,
+167,115,165,114,115,122,126,104,117,30,115,102,127,126,110,122,128,133,24,
+151,7,142,184,141,147,160,176,8,152,161,143,150,155,26,171,119,159,109,108,
+119,118,108,124,143,127,152,117,30,160,102,141,131,142,94,8,14,56,247,133,
+247,189,21,251,100,51,247,100,251,101,227,247,101,247,100,227,251,100,247,
+101,51,6,14,252,39,92,251,74,87,29,251,212,213,29,252,39,205,247,27,21,96,
+107,107,96,98,171,107,180,181,172,171,181,180,106,172,99,31,14,252,11,247,
+147,249,65,21,251,211,253,83,5,226,6,247,211,249,83,5,14,247,219,249,63,21,
+84,84,113,93,94,31,46,43,77,251,53,251,40,26,251,25,202,52,236,181,179,153,
+168,178,30,239,214,218,247,73,247,49,26,247,38,80,234,48,30,137,110,21,170,
+157,112,94,120,135,107,132,102,31,121,53,89,251,85,117,73,8,43,106,110,101,
+98,27,109,119,165,179,203,195,247,126,186,247,23,31,243,176,167,179,176,27,
+14,144,22,247,237,162,6,60,140,121,147,176,26,149,140,142,150,180,30,247,
+46,248,196,48,117,76,127,251,8,121,25,137,116,5,143,165,156,140,160,27,169,
+154,128,117,133,137,130,137,130,31,251,20,252,95,5,84,122,109,120,67,27,14,
+248,55,247,83,21,114,6,102,73,118,127,58,137,8,251,41,6,247,88,247,59,5,234,
+220,188,220,214,26,233,67,213,47,86,91,119,99,95,30,110,113,123,115,111,85,
+161,127,24,198,179,180,166,191,27,198,173,98,70,47,78,49,251,80,251,79,31,
+49,49,5,115,248,3,7,14,247,20,247,239,21,181,137,158,135,163,127,8,186,114,
+164,91,72,26,49,90,67,78,123,123,145,147,131,30,137,141,133,149,122,163,8,
+174,116,123,150,113,27,102,116,117,105,90,190,108,221,247,53,247,21,247,9,
+247,38,205,119,177,82,182,31,151,145,5,211,176,174,186,199,26,217,75,197,
+54,58,78,99,46,77,30,160,126,5,196,181,166,157,186,27,192,173,104,84,62,79,
+90,251,21,112,31,14,248,89,247,140,21,70,6,247,11,248,71,5,76,6,252,63,252,
+64,111,34,5,247,136,6,98,251,42,5,247,20,6,181,247,42,5,207,6,252,9,237,21,
+247,174,247,172,60,251,172,5,14,247,89,248,196,21,247,146,6,175,247,1,5,251,
+175,6,251,23,251,189,206,136,170,132,177,119,25,201,107,175,82,75,26,53,76,
+63,68,117,128,148,173,118,30,179,115,122,152,109,27,104,115,116,105,92,191,
+107,218,247,57,247,19,247,7,247,41,216,105,204,77,179,31,105,162,112,148,
+47,158,8,14,248,139,249,59,21,251,26,114,75,113,58,80,8,251,18,45,64,251,
+31,251,33,26,251,24,204,61,247,1,247,29,247,1,247,10,247,40,245,82,204,46,
+119,126,136,129,110,30,201,247,15,220,210,247,27,191,8,251,150,251,165,21,
+186,160,118,93,76,104,251,25,106,76,31,115,126,117,124,113,27,102,121,164,
+192,193,160,227,172,222,31,192,160,147,148,172,27,14,222,248,115,21,175,203,
+165,151,245,140,8,247,25,6,251,224,252,192,5,231,6,248,17,249,49,5,252,17,
+6,52,251,82,5,14,247,225,248,17,21,243,183,178,183,210,26,174,127,170,117,
+161,30,173,105,85,160,85,27,251,2,58,61,33,81,157,102,195,80,31,134,7,251,
+16,95,83,81,54,26,40,218,72,247,7,247,20,233,226,247,11,203,115,191,77,206,
+30,251,16,84,21,225,37,150,119,87,26,63,94,85,77,77,102,186,216,214,169,189,
+218,194,30,240,221,21,70,204,118,175,188,26,195,173,180,187,188,171,97,75,
+88,124,109,81,79,30,14,133,129,21,247,27,164,203,164,219,198,8,247,17,231,
+216,247,35,247,34,26,205,118,199,102,176,30,168,110,100,154,89,27,251,30,
+251,0,251,11,251,44,39,200,72,229,161,152,142,150,165,31,78,251,17,45,57,
+251,14,102,8,247,218,249,16,21,172,155,116,93,117,135,103,133,106,31,131,
+98,139,139,114,66,8,60,112,131,129,97,27,96,116,162,180,203,167,247,4,169,
+200,31,180,160,166,160,170,27,14,251,212,237,247,27,21,109,10,232,247,216,
+78,29,251,212,127,251,75,92,29,247,108,248,254,78,29,56,248,189,248,237,21,
+252,133,251,164,134,120,247,240,251,176,173,247,22,251,127,247,84,247,229,
+247,78,5,14,56,248,173,248,35,21,252,140,51,248,140,6,251,8,4,252,140,51,
+248,140,6,14,56,148,165,21,248,132,247,164,145,159,251,240,247,175,104,251,
+22,247,128,251,83,251,229,251,79,5,14,247,88,247,100,21,167,209,155,162,177,
+164,205,182,24,229,197,175,189,202,26,225,69,197,33,38,65,85,64,101,165,110,
+174,173,166,166,172,154,134,152,126,156,30,131,149,136,145,145,26,159,169,
+157,171,182,165,109,90,91,119,93,95,84,30,98,88,93,81,118,93,135,84,25,126,
+59,78,29,247,71,248,181,248,99,21,181,117,125,149,103,27,96,96,120,106,107,
+31,88,85,107,60,66,26,75,180,89,191,182,186,167,185,174,30,98,141,181,105,
+188,27,240,225,247,5,247,24,247,60,251,37,247,22,251,81,251,100,251,57,251,
+50,251,91,251,87,247,56,251,43,247,104,212,190,153,184,236,31,126,174,5,103,
+61,89,127,69,27,251,64,251,15,247,15,247,63,247,81,247,10,247,27,247,57,247,
+49,247,22,251,13,251,38,89,121,80,110,99,31,105,116,112,122,109,27,115,126,
+155,168,148,139,144,141,145,31,204,247,149,5,68,6,69,105,21,168,137,154,116,
+137,99,137,95,123,80,117,97,8,97,117,109,114,110,27,103,116,172,191,192,158,
+191,171,176,31,167,171,173,159,164,137,8,14,153,35,29,14,153,247,8,249,24,
+21,175,137,148,137,151,132,8,148,134,146,126,127,26,129,135,117,132,114,30,
+251,14,252,85,123,88,123,124,91,133,25,114,247,193,7,247,75,247,4,217,247,
+19,218,104,177,37,172,31,215,158,170,153,174,168,8,169,164,156,179,180,26,
+235,58,189,251,47,30,251,164,6,247,45,251,223,21,205,137,169,133,159,122,
+8,162,120,150,111,102,26,80,116,77,103,103,30,112,112,105,126,95,27,100,121,
+149,162,147,140,146,143,153,31,247,27,248,135,21,175,149,149,147,171,27,197,
+168,105,70,76,118,92,99,113,31,108,119,105,132,65,136,8,14,153,39,29,14,208,
+74,29,14,153,32,29,14,153,248,151,248,108,21,111,143,92,45,119,128,251,23,
+138,25,200,247,115,236,10,116,145,112,83,26,166,134,182,247,82,5,252,169,
+114,6,143,10,247,187,164,7,83,143,124,148,170,26,151,142,154,147,165,30,141,
+146,140,144,140,142,193,247,93,24,246,137,169,119,71,26,125,138,128,136,120,
+30,167,134,5,14,208,38,10,14,247,17,249,37,233,29,146,140,144,142,149,54,
+29,14,251,156,36,10,14,248,160,82,29,192,154,152,188,145,25,14,153,52,10,
+14,97,44,29,14,247,128,250,41,249,49,21,251,104,6,251,202,252,116,85,248,
+116,5,251,113,114,6,202,136,148,135,111,26,125,135,121,132,113,30,251,1,252,
+9,99,251,22,132,128,85,127,25,114,247,99,164,7,75,147,123,151,180,26,156,
+144,164,153,189,30,240,248,5,206,252,195,5,167,6,248,11,248,209,251,17,252,
+100,123,85,120,125,74,135,25,114,247,204,164,7,81,142,125,147,171,26,150,
+141,150,145,162,30,140,144,140,144,247,15,248,85,154,191,154,153,190,145,
+25,14,208,43,29,14,208,34,29,14,97,247,5,62,10,14,208,249,14,99,21,79,81,
+103,121,78,27,112,119,143,150,103,31,97,152,114,147,99,146,94,142,25,108,
+141,132,141,143,26,139,140,141,140,140,30,146,146,149,150,149,149,156,155,
+25,247,22,147,194,159,216,208,8,247,2,238,206,247,32,247,25,26,247,27,37,
+237,251,32,251,108,251,98,251,123,251,134,73,164,79,184,97,30,165,114,152,
+132,192,120,147,136,142,137,142,135,137,136,138,137,137,137,138,138,134,135,
+131,132,251,48,251,22,24,153,115,5,161,195,165,145,171,27,168,162,134,123,
+191,31,119,201,172,133,180,27,247,1,208,178,247,2,220,31,251,101,249,90,21,
+199,180,91,68,251,13,78,251,91,71,247,51,29,185,212,242,247,18,29,14,153,
+41,29,14,42,39,10,14,97,59,29,14,208,32,10,14,153,249,95,249,49,21,251,84,
+114,6,184,135,139,139,148,133,8,146,135,143,130,130,26,116,119,96,100,77,
+30,251,82,251,194,88,248,37,5,138,145,139,143,145,26,173,147,144,207,145,
+30,164,251,190,114,7,201,145,129,251,35,161,31,215,252,145,5,171,6,248,29,
+249,2,152,158,157,151,167,148,25,14,247,128,37,10,14,153,248,222,164,21,67,
+147,124,153,110,233,65,247,129,24,247,91,247,97,183,183,159,151,174,144,25,
+164,251,95,114,7,165,136,155,136,144,136,8,144,136,142,132,132,26,121,120,
+113,88,85,30,45,40,129,172,136,151,135,149,25,116,211,128,181,154,26,162,
+150,148,172,143,30,143,151,140,141,153,31,164,251,197,114,7,199,133,155,128,
+154,93,223,251,164,24,113,111,134,134,102,98,251,50,251,66,108,111,97,131,
+8,114,247,106,164,7,94,143,119,152,162,26,152,147,152,161,164,30,247,26,247,
+40,143,124,141,132,152,101,25,166,62,150,97,117,26,113,125,132,85,134,30,
+114,247,200,7,14,97,40,10,14,97,51,29,14,251,212,247,247,249,19,21,146,174,
+5,251,92,6,251,91,253,213,5,247,111,6,146,174,5,61,6,115,129,146,156,138,
+31,247,50,249,56,154,201,139,139,176,140,25,14,252,11,138,249,65,21,247,88,
+253,83,5,223,6,251,87,249,83,5,14,251,212,90,251,14,21,132,104,5,247,91,6,
+247,92,249,211,5,251,112,6,132,104,5,217,6,163,149,132,123,140,31,251,50,
+253,57,124,79,139,139,102,138,25,14,56,247,77,247,199,21,247,21,247,167,247,
+24,251,167,5,229,6,251,74,248,5,5,58,6,251,70,252,5,5,14,248,108,251,35,21,
+208,252,133,70,7,14,251,212,247,211,129,10,14,33,29,14,215,249,22,21,188,
+153,132,116,126,126,88,113,46,31,45,251,219,5,129,103,129,99,134,26,111,211,
+107,205,247,55,247,49,247,64,247,71,212,93,190,73,88,103,116,71,88,30,229,
+247,220,68,126,89,131,52,130,25,247,91,251,167,21,168,154,116,93,80,112,46,
+103,77,31,78,105,100,109,96,27,121,126,150,155,150,155,212,150,178,31,151,
+183,159,196,155,175,8,196,165,170,169,173,27,14,251,101,45,10,14,55,10,14,
+251,101,34,10,14,251,212,247,220,248,85,58,10,41,10,14,42,248,112,247,34,
+21,77,96,120,118,57,29,252,11,44,10,176,10,252,11,170,248,43,21,190,150,134,
+113,126,135,116,131,109,31,47,251,247,131,10,202,239,208,215,247,47,179,247,
+6,29,247,71,247,142,194,29,69,29,14,252,11,53,10,14,247,17,173,248,43,21,
+147,6,167,140,157,129,122,26,125,131,108,112,41,30,72,251,130,5,247,13,6,
+192,247,82,177,225,195,206,8,165,162,167,159,153,27,149,147,129,126,123,127,
+96,106,39,31,74,251,99,5,247,12,6,197,247,82,146,159,175,202,8,213,181,179,
+181,169,27,151,150,129,128,133,136,128,135,126,31,94,251,23,5,118,76,124,
+77,111,26,98,163,117,182,201,179,172,237,197,30,117,152,121,112,129,125,138,
+138,25,114,120,128,130,129,27,130,132,145,147,150,139,139,160,206,31,184,
+247,25,5,154,182,147,177,165,26,180,106,169,95,71,92,98,251,22,56,30,159,
+190,145,163,167,26,182,114,164,97,111,109,128,116,111,30,102,112,109,100,
+74,39,203,247,91,24,78,125,113,135,251,5,130,8,14,42,36,29,14,35,10,14,162,
+248,43,21,184,137,148,135,120,26,130,131,102,125,87,30,39,252,24,120,73,131,
+130,91,140,25,112,247,141,166,7,129,29,73,82,95,107,56,80,31,177,247,7,37,
+123,100,133,87,133,25,247,151,96,114,29,248,7,251,70,21,125,6,103,124,147,
+159,157,176,247,29,182,247,32,31,162,214,158,209,182,247,51,8,251,1,6,124,
+80,134,167,136,150,130,150,25,153,129,118,147,116,27,63,51,72,36,80,31,104,
+78,122,80,84,26,58,178,90,204,199,179,168,221,191,30,76,251,105,122,87,128,
+131,77,136,25,112,247,159,7,58,249,4,21,161,138,152,120,111,26,86,102,251,
+15,104,77,30,89,110,111,115,108,27,113,126,158,177,195,167,229,180,211,31,
+171,195,174,170,167,137,8,14,251,156,51,10,14,251,156,43,10,14,252,11,247,
+173,248,85,21,67,89,29,42,33,10,14,251,101,155,248,43,21,170,148,136,126,
+146,31,155,107,150,52,251,0,26,135,139,122,138,119,30,135,251,28,5,165,6,
+247,19,247,13,186,192,194,220,8,179,196,160,193,181,26,174,110,171,107,109,
+113,112,108,122,145,125,157,119,30,154,123,144,129,128,26,104,112,99,40,251,
+5,30,135,247,88,133,197,118,219,89,127,116,135,57,127,8,14,153,38,29,14,248,
+36,247,15,21,89,100,129,130,121,27,120,129,153,178,131,31,107,247,48,142,
+143,140,141,144,146,25,197,174,164,163,162,27,145,146,136,133,151,31,130,
+153,146,137,150,27,169,165,163,168,171,112,168,108,92,108,112,251,3,59,31,
+121,226,131,163,120,166,251,59,115,24,112,7,141,157,146,139,149,27,171,153,
+121,90,149,31,169,251,46,95,69,5,106,119,129,131,121,27,133,134,141,145,129,
+31,148,123,128,143,126,27,108,115,115,107,104,165,115,177,189,161,159,235,
+198,31,163,178,5,251,7,161,164,99,189,27,187,181,173,227,200,31,14,251,101,
+37,29,14,251,156,40,29,14,251,197,248,72,249,66,21,251,51,81,106,251,1,108,
+31,93,251,71,119,67,111,115,50,119,25,201,123,161,120,104,26,115,129,95,123,
+91,30,120,83,123,66,109,26,113,147,120,156,124,30,164,118,178,131,232,137,
+142,151,24,80,150,117,160,185,26,165,150,189,158,203,30,158,199,149,186,162,
+26,181,121,153,65,159,30,237,158,169,165,162,224,184,247,63,24,159,215,175,
+172,221,154,8,14,252,69,205,251,142,21,227,250,122,51,6,14,251,197,251,21,
+251,79,21,247,51,197,172,247,1,170,31,185,247,71,159,211,167,164,228,158,
+25,78,155,116,158,174,26,163,149,183,155,187,30,158,196,155,213,170,26,162,
+131,158,122,154,30,114,160,100,147,46,141,136,127,24,197,129,162,116,95,26,
+113,129,94,118,69,30,120,73,130,98,116,26,97,156,125,214,119,30,41,120,109,
+113,116,54,94,251,63,24,119,63,103,106,57,124,8,14,56,248,99,247,206,21,106,
+114,120,127,116,27,120,124,144,161,90,31,173,60,117,146,102,27,88,101,113,
+81,106,31,193,92,5,171,163,155,149,169,27,174,170,129,114,186,31,114,186,
+164,131,173,27,186,169,160,203,186,31,14,251,156,247,85,247,167,21,96,251,
+2,96,43,82,251,4,8,113,92,134,124,113,26,94,166,110,181,170,163,156,168,153,
+30,147,157,141,152,141,180,143,215,158,247,17,169,247,45,8,166,247,117,21,
+97,106,108,100,100,174,104,178,181,171,171,181,179,108,169,97,31,14,248,67,
+248,212,21,104,6,98,251,9,5,141,127,132,140,130,27,251,34,251,35,251,54,251,
+54,49,193,84,233,133,31,93,251,22,5,173,6,186,247,25,206,152,176,169,202,
+229,25,112,157,98,79,104,112,97,137,25,231,247,153,5,131,149,150,136,153,
+27,176,167,168,178,173,123,164,102,159,31,251,64,252,28,21,119,150,132,147,
+132,155,8,132,155,135,160,157,26,197,165,226,175,203,30,189,167,166,162,170,
+27,152,151,131,131,136,31,14,248,30,248,6,21,251,6,6,178,247,94,5,189,149,
+160,166,168,27,153,149,130,127,134,138,132,137,132,31,137,127,137,127,129,
+26,110,162,117,169,174,165,168,178,191,93,178,76,82,85,112,90,97,30,90,84,
+115,81,114,251,16,8,34,6,129,79,5,247,1,6,129,55,137,128,132,72,8,150,113,
+125,142,118,27,82,100,104,87,88,176,104,192,182,167,156,182,166,31,94,190,
+173,123,181,27,181,179,159,174,164,31,160,167,150,166,151,196,8,114,6,90,
+117,119,125,91,27,106,106,148,162,80,31,150,156,165,182,164,207,152,197,25,
+247,7,6,251,163,251,112,21,90,128,121,117,109,27,106,116,160,169,169,159,
+159,170,161,157,131,117,163,31,14,252,122,224,10,248,140,247,234,21,251,27,
+6,247,58,247,125,173,185,158,154,179,147,25,164,251,92,114,7,194,137,154,
+130,104,26,121,133,126,119,110,30,251,27,251,86,59,247,128,5,135,151,137,
+150,148,26,162,157,146,196,141,30,164,251,172,114,7,194,133,146,133,159,88,
+218,251,131,24,251,17,6,125,89,5,247,34,6,117,61,5,251,33,6,125,89,5,247,
+33,6,120,72,121,82,125,129,62,134,25,114,247,214,164,7,72,142,125,146,172,
+26,158,143,161,151,183,30,142,150,5,247,44,6,153,189,5,251,44,6,160,217,5,
+247,42,6,14,248,79,248,76,21,251,10,6,161,247,22,148,177,157,171,8,163,153,
+158,152,160,27,154,149,133,130,135,136,136,133,133,31,125,126,133,128,123,
+26,109,160,119,171,175,163,163,176,189,92,176,76,251,2,52,40,251,60,102,30,
+32,6,131,95,5,244,6,69,252,0,126,73,116,79,119,119,25,130,129,129,135,122,
+27,122,131,143,148,144,141,143,147,147,31,151,153,145,151,151,26,167,116,
+161,109,106,115,114,104,87,183,104,205,247,26,226,247,21,247,161,186,30,166,
+247,46,5,247,8,6,14,247,180,247,17,21,136,151,146,138,150,27,203,192,194,
+206,186,118,190,100,184,31,70,220,5,88,199,122,170,171,26,182,175,169,189,
+169,167,126,124,134,135,134,129,132,30,123,126,133,129,124,26,109,164,115,
+169,173,163,165,174,196,82,180,60,47,76,84,60,95,158,94,175,99,30,137,136,
+5,142,126,116,142,126,27,81,93,83,69,96,155,101,174,96,31,205,59,5,210,53,
+151,119,106,26,94,104,108,88,105,106,153,154,144,142,144,149,147,30,155,153,
+145,150,159,26,168,116,160,106,105,115,114,104,80,202,93,221,231,211,198,
+214,181,123,173,96,193,30,48,247,171,21,197,247,3,251,19,72,108,112,112,107,
+117,123,147,162,115,31,116,160,111,172,115,172,8,122,164,127,169,160,26,172,
+163,164,171,30,14,173,213,21,185,92,216,218,5,117,173,167,131,174,27,175,
+168,148,160,172,31,216,60,186,186,60,217,5,160,168,148,168,177,26,176,131,
+165,117,174,30,218,217,92,184,62,62,5,159,107,111,147,102,27,102,111,131,
+119,106,31,62,216,93,94,217,61,5,119,107,130,110,102,26,102,148,111,159,108,
+30,247,35,247,94,21,196,184,92,79,81,92,92,84,82,94,186,198,199,184,185,196,
+31,14,252,11,247,61,139,29,14,247,136,129,10,247,135,163,133,29,14,247,29,
+93,10,247,37,222,21,158,160,148,148,156,158,103,10,14,251,212,247,49,93,10,
+14,251,212,247,48,94,29,14,42,156,248,43,21,214,6,47,252,47,5,251,33,108,
+124,113,181,29,110,119,117,107,94,247,17,10,208,152,191,247,36,10,125,84,
+137,130,122,26,97,165,115,184,199,177,170,244,208,30,117,152,5,82,99,117,
+117,124,27,131,237,29,71,134,125,168,10,135,137,135,134,187,10,75,77,115,
+99,101,30,98,95,118,99,103,33,8,63,6,14,42,159,248,43,21,213,6,247,35,29,
+126,130,144,146,142,141,143,143,247,11,10,106,120,119,106,91,178,106,197,
+242,213,234,247,83,185,230,10,126,128,26,105,169,115,181,247,52,29,104,116,
+117,121,27,130,131,147,148,143,139,140,143,154,240,10,76,80,115,100,104,31,
+99,96,120,99,105,251,1,8,65,6,247,234,22,163,29,127,122,136,131,247,56,10,
+248,113,247,161,21,252,136,6,122,48,5,248,136,6,14,247,71,251,37,21,155,196,
+143,152,154,202,173,247,32,175,231,178,188,8,120,187,132,172,176,26,157,141,
+154,143,162,30,175,152,136,118,177,31,126,161,151,135,151,27,173,163,160,
+170,171,118,159,106,124,129,136,126,114,31,102,121,125,135,108,138,147,176,
+146,158,153,157,154,158,24,162,168,148,159,161,26,170,115,162,107,104,118,
+116,101,123,142,124,146,112,30,146,117,141,127,128,26,122,136,123,133,118,
+30,107,127,142,158,100,31,152,112,126,143,123,27,107,119,119,108,108,159,
+119,170,159,153,143,154,166,31,174,157,144,140,174,140,130,78,105,74,95,100,
+8,144,105,140,119,115,26,90,133,59,132,96,30,111,251,65,5,14,247,160,248,
+107,21,116,118,145,154,107,31,151,115,127,143,125,27,108,118,119,110,110,
+157,121,173,137,31,155,140,144,140,165,152,8,158,177,157,144,171,27,115,43,
+122,105,89,93,8,159,104,143,121,87,26,105,138,127,133,115,30,101,142,130,
+142,97,158,8,150,114,125,144,126,27,110,116,116,110,112,161,119,167,150,152,
+142,149,162,31,181,155,150,142,179,143,124,90,133,128,110,97,8,118,110,132,
+124,121,26,109,162,118,170,174,158,160,178,149,137,149,135,160,30,133,164,
+137,151,160,26,162,140,151,144,159,30,176,151,136,121,179,31,127,163,151,
+135,152,27,171,160,158,169,169,120,156,106,141,31,123,134,137,126,113,31,
+101,121,121,134,107,138,163,235,156,173,189,185,8,119,175,135,155,194,26,
+172,140,151,145,162,30,177,136,148,137,181,119,8,127,164,153,135,152,27,168,
+162,162,168,166,117,159,111,128,126,135,130,116,31,97,123,128,136,99,135,
+154,188,145,150,168,181,8,160,168,146,154,157,26,168,116,161,108,104,120,
+118,101,128,140,129,144,119,30,145,113,141,127,118,26,117,138,127,134,118,
+30,14,252,39,247,18,248,41,78,29,247,222,249,24,21,194,6,251,109,253,217,
+5,247,63,6,146,164,5,80,144,125,144,156,26,147,179,143,156,143,155,247,61,
+249,29,24,153,193,142,141,220,146,145,164,24,251,187,6,50,74,117,95,98,31,
+96,93,106,46,63,26,94,156,100,169,118,30,164,122,162,133,189,137,54,251,218,
+24,123,77,134,125,131,133,128,129,122,135,90,135,132,114,24,247,62,6,173,
+248,112,21,93,159,113,178,191,26,193,159,209,167,185,30,168,186,165,156,202,
+155,8,14,251,195,247,70,248,142,21,53,73,73,54,53,207,71,224,222,208,206,
+221,226,72,208,53,31,14,251,212,147,251,74,87,29,247,104,251,74,146,29,101,
+60,96,30,251,135,115,87,29,247,214,248,5,92,29,251,135,115,87,29,247,235,
+94,29,251,37,56,95,29,14,247,239,247,7,247,27,21,109,10,247,224,22,109,10,
+247,224,22,247,64,10,247,239,225,110,21,187,6,248,74,249,115,5,91,6,75,88,
+90,112,73,27,102,121,146,162,111,31,160,114,119,147,113,27,32,49,40,251,9,
+60,191,82,212,176,176,155,167,167,31,180,181,168,216,208,26,152,138,150,137,
+158,30,129,163,154,136,160,27,180,171,151,169,179,31,251,160,147,21,146,143,
+136,130,152,31,151,131,142,137,150,136,149,136,143,137,140,136,8,142,132,
+143,113,126,26,37,77,38,76,106,122,163,183,228,201,247,20,180,136,30,247,
+215,251,193,21,37,46,40,251,2,52,189,84,217,177,175,154,166,164,169,29,105,
+116,115,124,109,27,106,123,161,185,191,165,221,171,185,31,168,159,158,152,
+159,27,247,233,172,21,37,46,39,251,1,53,189,83,216,178,174,154,166,165,169,
+29,106,116,115,123,109,27,106,123,161,185,191,166,221,170,185,31,168,159,
+158,152,159,27,14,247,196,247,163,21,111,69,123,116,101,114,73,96,24,49,81,
+103,89,76,26,53,209,81,245,240,213,193,214,177,112,168,105,105,112,113,105,
+124,144,126,152,122,30,147,129,142,133,133,26,120,109,120,107,96,113,169,
+189,186,158,185,184,194,30,180,190,185,197,159,185,144,194,25,154,247,120,
+78,29,251,212,247,189,248,152,67,29,251,212,247,80,248,152,46,29,251,212,
+247,208,248,152,45,29,251,212,248,2,249,35,100,10,251,212,248,29,249,3,84,
+29,251,212,247,240,249,58,238,29,126,6,38,183,91,232,236,247,59,29,251,212,
+247,119,249,35,107,10,14,251,212,247,11,249,35,42,29,251,212,247,126,249,
+134,50,10,251,212,114,47,21,112,29,184,206,5,95,6,14,251,212,247,10,248,152,
+21,161,29,247,68,10,156,148,150,247,42,29,148,10,251,212,167,171,21,135,133,
+137,137,131,129,8,98,89,126,112,110,80,29,181,154,142,157,148,170,31,142,
+149,140,142,140,146,8,14,251,212,248,47,249,70,48,29,247,239,224,29,247,183,
+174,10,97,123,150,165,145,141,149,142,151,31,247,7,29,133,138,125,56,10,14,
+252,23,247,205,248,120,21,136,136,139,139,137,136,8,116,120,124,126,132,27,
+136,137,142,145,155,145,164,155,187,31,185,247,32,63,135,128,104,5,170,132,
+125,152,113,27,56,42,251,5,43,94,167,108,181,183,168,162,204,176,31,129,105,
+138,133,128,26,119,159,121,163,169,168,162,192,177,30,251,20,247,75,21,151,
+138,147,127,124,26,109,121,79,118,101,30,103,119,117,118,120,27,126,128,152,
+154,205,208,247,15,174,135,31,14,97,147,29,205,247,136,247,40,222,160,209,
+251,42,58,183,247,54,155,194,158,152,205,143,25,164,251,209,247,70,10,84,
+251,93,39,86,117,69,243,195,89,251,73,123,87,125,126,89,132,25,114,248,189,
+7,14,208,247,16,29,119,142,109,27,251,108,251,98,251,123,251,134,76,29,117,
+144,117,245,29,85,27,113,120,145,155,119,31,14,247,183,250,70,249,49,21,251,
+227,6,123,109,141,142,94,31,142,108,130,139,123,27,251,0,73,119,84,66,31,
+251,10,50,63,251,40,251,33,26,48,175,70,206,100,30,179,115,202,127,204,142,
+247,46,146,24,161,6,144,148,139,140,149,31,167,6,247,188,6,199,247,86,112,
+144,5,251,13,70,68,93,251,9,27,87,118,149,163,145,141,149,141,148,31,203,
+247,137,214,132,159,134,154,126,25,152,127,146,122,120,26,130,138,124,137,
+122,30,136,139,132,138,130,30,166,134,211,247,164,112,142,107,62,97,112,49,
+140,25,135,6,118,6,200,247,112,5,180,150,146,145,173,27,191,190,127,121,163,
+31,164,119,152,110,102,26,124,139,131,138,125,30,164,133,5,252,144,251,247,
+21,68,119,110,112,81,27,66,91,192,219,247,10,193,247,70,202,230,31,207,187,
+189,171,199,27,186,165,117,99,123,135,113,131,112,31,14,251,245,247,135,249,
+65,21,43,48,43,39,87,184,102,200,231,227,227,238,144,31,196,142,96,180,75,
+27,137,119,21,156,138,148,125,138,116,137,96,123,79,120,98,8,96,118,120,119,
+115,27,121,129,152,161,183,160,217,162,179,31,157,171,161,156,159,138,8,14,
+208,247,244,248,32,21,189,121,119,155,95,27,251,18,251,41,251,85,251,55,71,
+187,89,205,206,140,29,98,114,171,192,154,140,150,81,10,127,111,81,109,91,
+80,102,31,108,119,117,131,111,135,8,14,252,11,44,10,14,252,11,247,108,247,
+33,92,10,251,66,126,84,247,0,29,63,29,14,208,248,227,247,31,21,70,94,112,
+119,93,27,96,115,166,190,155,141,152,145,166,31,242,162,164,148,184,168,8,
+196,176,169,183,185,26,195,96,173,70,87,105,125,91,79,30,184,107,108,156,
+86,27,42,45,78,39,81,31,110,87,123,85,88,26,46,204,75,234,198,185,157,178,
+182,30,98,178,171,123,185,27,184,181,154,169,173,31,163,159,156,162,165,188,
+8,251,90,233,21,191,247,35,148,158,170,175,8,149,148,152,145,153,27,162,153,
+124,114,114,129,107,124,115,31,110,92,104,115,63,117,8,251,31,247,107,21,
+175,158,114,90,87,105,251,26,109,76,31,74,108,110,110,103,27,105,120,168,
+191,182,151,196,162,207,31,247,12,179,174,187,187,27,14,247,133,248,20,21,
+167,135,151,136,149,131,8,154,128,148,114,109,26,75,118,37,115,87,30,100,
+121,119,120,116,27,123,120,147,149,131,31,135,144,119,104,5,123,162,159,133,
+169,27,247,8,243,247,16,247,30,182,124,174,111,163,31,115,160,116,149,85,
+150,217,168,168,155,173,171,8,165,164,154,175,176,26,215,78,194,54,251,14,
+53,35,251,90,96,30,47,252,59,125,76,122,91,123,118,25,126,129,129,135,120,
+27,127,135,142,147,144,140,141,144,144,31,148,148,141,146,154,26,167,121,
+156,109,108,119,118,107,93,178,108,197,244,215,240,247,93,184,30,230,248,
+43,5,247,9,165,169,188,185,27,170,154,120,99,251,0,97,51,87,31,135,6,123,
+140,5,14,251,245,169,247,166,141,10,144,27,153,147,132,125,142,31,140,134,
+103,251,12,114,66,133,120,133,121,138,134,8,73,122,124,125,83,27,14,92,248,
+103,247,0,21,227,247,183,252,140,51,248,52,6,14,62,248,182,248,85,21,251,
+27,6,89,251,56,5,251,1,105,66,33,96,27,127,132,148,155,152,141,154,143,153,
+31,231,247,204,5,251,27,6,251,1,252,11,121,90,133,123,120,94,25,115,81,133,
+116,110,26,100,157,117,172,169,167,158,169,152,30,145,152,140,148,166,26,
+183,147,185,153,182,30,120,164,152,134,163,27,186,170,167,229,191,31,130,
+102,137,127,120,26,103,166,112,175,196,173,166,243,215,30,117,155,5,99,114,
+117,117,124,27,132,134,145,147,147,141,148,142,149,31,14,247,239,247,138,
+249,27,21,188,6,173,161,118,94,149,31,160,227,251,242,51,160,6,183,149,160,
+161,174,27,188,251,201,6,106,137,132,133,135,30,131,135,136,138,108,188,10,
+248,60,64,21,150,6,247,45,247,200,5,251,125,7,105,137,133,133,135,30,131,
+135,137,138,107,188,10,247,149,7,177,153,152,181,142,30,159,251,1,7,251,49,
+251,194,251,42,247,194,5,251,19,119,6,170,137,164,121,153,107,8,251,136,7,
+138,87,131,128,96,135,8,118,247,23,160,7,96,143,131,150,138,191,8,247,108,
+7,14,208,60,10,236,248,250,247,20,29,248,158,247,20,130,10,175,171,159,151,
+233,10,121,39,44,8,123,247,130,7,253,39,247,166,102,10,56,247,133,247,251,
+21,251,100,51,247,100,251,35,227,247,35,247,100,227,251,100,247,101,51,6,
+251,100,252,204,21,248,140,227,252,140,6,14,97,247,5,113,10,142,154,146,173,
+30,153,203,5,135,175,157,228,10,91,6,152,177,159,196,147,146,192,147,25,140,
+164,5,251,186,6,247,72,251,103,21,146,164,139,139,143,144,8,149,149,149,143,
+158,27,193,169,192,10,14,236,249,68,99,10,251,79,247,180,102,10,56,248,173,
+247,101,21,227,252,140,51,7,247,145,49,21,109,10,248,52,4,96,107,247,53,10,
+180,106,172,99,31,14,252,69,236,120,21,226,247,166,52,6,247,47,4,226,247,
+166,52,6,14,251,145,247,118,249,63,21,59,76,76,59,60,202,75,217,221,202,201,
+220,219,76,202,59,31,103,4,194,186,90,81,80,93,91,82,84,93,188,197,198,185,
+187,195,31,14,247,21,251,70,21,129,29,74,82,96,109,63,88,31,136,142,234,247,
+232,69,126,90,131,52,130,25,112,7,188,153,132,116,132,135,120,126,90,31,251,
+54,253,10,121,65,128,127,90,140,25,112,247,141,7,247,45,248,232,114,29,236,
+249,73,99,10,40,248,131,21,207,136,171,109,80,26,88,158,29,126,162,100,165,
+31,146,143,5,197,172,153,156,176,26,185,96,174,83,86,99,170,10,251,245,247,
+183,248,24,130,10,174,170,160,152,233,10,120,39,45,8,123,247,130,7,14,233,
+247,102,248,147,21,170,135,140,139,147,135,8,145,135,140,134,109,26,251,141,
+7,109,137,132,134,136,30,131,135,138,139,108,135,8,123,247,58,155,7,109,142,
+137,140,131,143,8,133,143,137,145,169,26,241,183,7,162,104,150,120,157,108,
+175,75,153,123,157,138,8,209,150,6,119,155,116,165,108,181,80,221,24,193,
+159,166,174,188,26,198,94,175,67,30,251,75,6,247,10,118,21,179,6,185,162,
+113,87,81,114,106,96,31,98,6,185,247,240,85,10,92,248,191,247,101,21,227,
+252,140,51,7,14,247,175,248,210,21,178,89,158,93,143,85,137,135,24,169,120,
+118,151,108,27,251,30,251,29,251,55,251,57,55,207,76,229,247,47,247,23,247,
+68,247,101,230,112,205,72,218,31,246,195,105,171,32,82,96,174,99,157,90,146,
+25,95,112,179,132,175,118,179,102,25,251,14,75,172,108,5,247,4,60,21,167,
+247,50,10,76,110,109,111,104,27,106,123,162,186,213,176,247,32,175,204,31,
+185,165,167,161,172,27,14,56,247,115,247,145,21,251,67,251,67,201,77,247,
+67,247,68,247,67,251,68,201,201,251,68,247,67,247,68,247,67,77,201,251,67,
+251,68,251,67,247,68,77,77,5,14,251,245,247,2,248,117,21,206,136,172,109,
+81,26,87,158,29,125,162,101,165,31,146,143,5,197,173,153,155,176,26,185,96,
+174,83,85,100,170,10,233,248,162,247,142,21,78,111,102,113,81,27,51,89,203,
+247,7,247,4,188,203,225,200,175,110,78,152,31,156,210,6,148,132,145,124,145,
+30,152,103,112,144,102,27,251,28,50,59,251,15,251,14,221,66,247,27,172,195,
+150,152,168,31,148,142,140,140,141,149,156,211,24,251,62,248,71,85,10,153,
+35,29,167,248,111,159,10,153,35,29,247,51,248,111,45,29,153,35,29,91,248,
+250,42,29,153,35,29,247,15,248,111,67,29,153,35,29,202,249,81,50,10,153,35,
+29,247,86,248,250,100,29,153,247,133,127,21,135,161,159,137,160,27,97,29,
+190,247,126,5,103,29,251,11,201,51,247,1,103,31,78,49,123,10,86,130,247,58,
+10,153,32,29,251,45,249,103,158,10,153,32,29,115,114,10,153,32,29,251,119,
+249,242,122,10,153,32,29,88,249,103,67,29,251,156,36,10,91,249,106,159,29,
+251,156,36,10,244,114,10,251,156,36,10,42,249,242,42,29,251,156,36,10,233,
+249,103,67,29,208,43,29,217,249,38,100,29,208,34,29,126,211,159,10,208,34,
+29,247,15,211,45,29,208,34,29,43,247,103,42,29,208,34,29,235,211,247,9,10,
+118,151,120,27,115,118,118,115,124,151,122,247,0,10,208,34,29,247,47,247,
+103,116,29,129,165,151,136,157,27,199,174,174,223,162,31,14,42,39,10,248,
+121,249,71,48,29,208,32,10,251,227,218,49,10,208,32,10,251,65,218,45,29,208,
+32,10,252,26,247,110,42,29,208,32,10,251,85,218,104,10,97,40,10,247,96,247,
+34,49,10,97,40,10,247,43,247,173,42,29,97,51,29,195,250,21,21,83,6,251,27,
+42,48,236,5,89,6,226,251,66,5,222,6,14,33,29,145,235,46,29,33,29,247,26,235,
+21,190,6,53,247,66,5,57,6,251,51,251,66,5,196,6,247,23,234,5,14,33,29,66,
+247,127,122,29,33,29,247,7,235,179,29,247,24,50,5,14,33,29,191,247,226,50,
+10,33,29,247,76,247,127,247,40,29,128,123,144,150,112,134,10,158,27,199,173,
+174,223,162,31,14,251,101,247,22,127,21,138,146,144,139,145,27,183,183,155,
+168,172,31,165,161,155,158,174,189,111,157,24,140,10,123,135,128,199,29,251,
+56,251,52,71,174,87,200,117,30,79,51,74,10,251,101,34,10,235,247,194,46,29,
+251,101,34,10,247,116,247,194,45,29,251,101,34,10,156,248,77,42,29,251,101,
+34,10,247,111,247,194,105,29,252,11,90,10,62,248,25,46,29,252,11,247,166,
+248,152,126,29,169,252,106,176,29,81,126,76,130,58,247,74,10,252,11,90,10,
+251,48,248,164,42,29,252,11,44,10,161,248,25,67,29,42,36,29,109,248,169,100,
+10,35,10,136,222,46,29,35,10,247,17,222,45,29,35,10,52,247,114,42,29,35,10,
+245,222,105,29,35,10,247,67,247,114,111,10,158,27,199,173,174,223,162,31,
+14,251,156,43,10,247,21,248,18,48,29,42,33,10,251,84,248,32,49,10,42,33,10,
+71,248,32,45,29,42,33,10,251,168,248,171,122,29,42,33,10,56,248,32,105,29,
+251,101,37,29,247,122,217,49,10,251,101,37,29,247,38,247,109,42,29,251,156,
+40,29,248,4,247,133,48,29,251,174,247,191,247,250,21,102,115,130,130,131,
+27,136,137,142,143,144,141,145,152,179,31,161,202,5,148,169,145,164,154,26,
+169,122,156,110,97,113,118,61,85,30,172,239,94,129,93,133,103,138,25,116,
+147,7,157,145,136,131,131,134,121,101,251,27,31,127,94,133,116,5,217,6,161,
+219,148,163,159,179,8,193,165,167,171,158,27,144,145,134,135,136,138,135,
+138,135,31,106,41,5,129,108,132,107,124,26,115,156,124,165,177,164,160,199,
+175,30,14,117,248,231,248,85,21,47,6,101,29,169,160,161,170,188,101,170,78,
+87,90,118,99,104,30,97,93,119,98,111,225,10,54,252,14,139,139,136,125,247,
+3,29,140,142,142,189,29,181,176,153,168,170,30,178,175,167,192,171,242,164,
+218,150,185,193,247,144,8,229,6,251,116,181,58,10,247,105,248,103,249,0,21,
+186,100,170,79,87,90,117,100,104,30,97,93,120,98,110,38,8,66,6,108,29,201,
+190,170,201,177,30,137,133,139,135,133,26,95,247,17,10,209,152,190,247,36,
+10,126,88,136,125,122,26,98,166,115,183,199,177,170,244,208,30,117,152,5,
+83,100,116,116,123,27,132,237,29,73,134,123,168,10,134,138,136,133,187,10,
+61,73,107,81,97,30,251,102,251,56,21,101,29,148,146,141,143,147,30,124,113,
+130,115,114,67,8,128,97,21,47,252,47,5,251,32,108,124,112,181,29,127,128,
+135,131,130,30,186,247,1,167,240,197,247,174,8,14,247,103,206,248,85,21,108,
+29,205,179,165,211,187,30,137,132,139,135,133,26,91,178,106,197,242,212,234,
+247,83,186,230,10,127,127,26,105,168,115,182,247,52,29,103,117,117,121,27,
+130,131,147,148,142,140,146,142,149,240,10,64,81,111,82,96,31,188,138,102,
+169,78,27,87,90,118,99,104,31,97,93,120,98,110,38,8,247,7,22,101,29,147,145,
+140,142,146,30,127,117,131,116,115,64,8,129,97,21,247,35,29,125,131,144,146,
+143,140,142,144,247,11,10,124,127,135,130,128,30,188,247,3,161,221,201,247,
+190,8,248,47,181,21,163,29,128,123,135,130,247,56,10,236,164,247,163,21,247,
+114,158,6,89,130,143,160,148,141,152,143,151,31,236,247,219,69,125,106,133,
+67,128,25,137,119,5,140,164,153,140,143,27,153,151,129,128,129,108,35,112,
+57,31,133,120,133,122,138,133,8,75,123,124,125,83,27,248,243,248,22,247,46,
+10,247,230,191,29,105,247,16,10,66,86,93,76,108,149,116,170,186,29,115,110,
+115,30,76,79,21,178,99,155,111,109,26,100,113,111,105,103,118,163,180,181,
+159,171,181,165,30,14,236,247,23,248,114,21,206,136,171,110,81,26,89,109,
+100,100,121,136,141,167,119,30,157,125,126,148,123,27,118,124,122,116,108,
+170,121,192,242,223,208,224,177,126,162,100,165,31,146,143,5,195,170,153,
+157,174,26,185,97,173,83,87,100,116,84,101,30,153,126,5,170,166,157,149,167,
+27,172,160,119,108,97,101,113,59,124,31,248,135,247,76,229,29,66,111,105,
+103,247,10,10,194,208,176,121,176,106,171,30,203,168,161,162,180,26,191,95,
+175,75,66,86,93,76,108,150,116,169,186,29,116,110,114,247,49,10,101,113,110,
+247,8,10,236,234,248,148,21,140,146,144,139,142,27,204,185,92,73,92,115,99,
+110,129,123,145,148,125,31,158,111,137,140,127,27,122,124,125,123,115,165,
+122,175,236,213,215,237,182,122,170,101,165,31,116,155,121,145,105,142,157,
+174,24,247,27,6,158,206,5,251,46,6,248,81,137,229,29,65,110,106,104,247,10,
+10,193,209,176,121,176,106,171,30,204,168,161,162,180,26,191,95,175,74,66,
+86,93,76,108,149,117,170,103,30,225,178,21,97,177,129,155,166,26,169,159,
+160,167,168,156,119,106,108,126,114,110,116,247,49,10,100,114,111,104,104,
+117,247,57,10,236,247,184,248,242,21,251,88,251,215,169,123,247,138,248,45,
+5,251,116,6,87,37,5,160,6,163,151,161,147,193,27,248,16,209,247,46,10,248,
+2,191,29,106,247,16,10,65,86,93,76,108,150,116,169,104,30,225,178,21,97,177,
+129,155,167,26,168,159,160,167,168,156,119,106,108,127,115,109,115,30,76,
+79,21,177,100,156,110,109,26,100,113,111,247,8,10,251,245,247,87,249,61,21,
+106,105,123,111,112,31,84,82,102,43,51,26,59,178,86,198,164,164,148,156,162,
+30,199,184,186,247,0,233,26,227,103,196,83,30,138,115,21,156,148,125,114,
+104,105,251,35,113,63,31,84,120,123,117,116,27,123,129,153,160,177,172,247,
+30,167,215,31,199,160,155,162,159,27,14,251,245,247,166,248,60,21,98,6,209,
+247,149,5,96,6,251,145,251,146,121,72,5,247,36,6,115,50,5,221,6,164,228,5,
+179,6,251,106,203,21,247,43,247,42,97,251,42,5,14,251,245,247,13,248,237,
+21,247,42,6,163,210,5,251,66,6,59,251,74,180,137,151,137,159,131,25,180,121,
+164,105,98,26,91,103,95,99,128,133,144,158,128,30,164,124,128,147,120,27,
+117,123,124,117,109,171,119,188,237,216,209,228,186,118,178,102,163,31,119,
+153,123,144,88,150,8,14,251,245,247,194,249,59,21,69,125,117,132,101,118,
+8,41,86,78,43,40,26,60,179,91,205,221,205,210,228,204,104,179,82,129,133,
+138,135,126,30,174,205,186,180,218,169,8,251,49,251,54,21,165,150,128,113,
+103,119,61,120,102,31,126,132,127,131,125,27,119,130,152,168,171,151,190,
+158,188,31,170,151,143,143,156,27,14,251,245,192,248,190,21,160,177,153,145,
+201,140,8,212,6,251,88,251,220,5,201,6,247,121,248,37,5,251,125,6,85,251,
+10,5,14,251,245,247,95,248,133,21,199,165,163,166,182,26,190,93,176,78,72,
+90,91,75,104,150,116,171,105,30,66,114,106,103,87,26,79,187,98,209,216,196,
+192,211,177,124,171,104,178,30,61,101,21,188,81,145,128,110,26,96,114,108,
+104,105,118,166,182,182,156,167,182,170,30,199,197,21,102,175,127,159,167,
+26,170,158,162,165,166,157,116,103,110,130,121,107,107,30,14,251,245,135,
+247,157,21,211,152,160,146,177,160,8,236,192,201,236,239,26,216,98,187,73,
+55,74,67,48,78,176,98,195,150,144,140,143,151,30,103,70,87,94,67,117,8,247,
+88,248,6,21,157,147,127,114,106,131,101,122,90,31,93,123,135,135,117,27,115,
+127,151,161,176,155,205,157,174,31,162,150,154,151,156,27,14,247,99,247,218,
+161,21,111,6,113,140,122,155,163,26,146,140,145,141,146,247,15,29,151,6,146,
+161,5,251,166,171,29,122,121,103,136,25,131,89,10,247,168,6,247,171,249,20,
+21,169,6,164,156,122,115,131,138,134,137,132,31,251,36,252,138,5,106,130,
+128,125,122,27,128,130,147,149,144,141,145,142,143,31,157,164,142,146,158,
+26,170,118,159,107,102,111,106,96,83,185,97,202,231,215,206,247,0,170,30,
+247,9,248,44,152,184,158,157,174,142,25,146,6,146,161,5,251,168,6,14,153,
+35,29,247,85,249,20,21,73,108,104,247,55,10,6,87,142,121,212,29,153,247,245,
+247,100,21,247,4,10,247,146,7,105,93,130,121,111,80,29,182,154,141,149,146,
+153,31,164,7,221,10,107,90,124,126,185,10,162,179,21,247,40,247,135,176,251,
+135,5,14,153,39,29,251,103,247,167,160,29,153,39,29,151,248,85,48,29,153,
+39,29,251,70,248,50,21,247,65,10,208,74,29,248,52,249,154,21,83,6,251,27,
+42,47,236,5,90,6,227,251,66,5,221,6,14,208,60,10,153,32,29,190,250,24,48,
+29,153,32,29,251,25,249,245,107,10,14,153,54,10,248,144,7,105,94,130,120,
+111,80,29,180,158,143,158,152,183,31,14,208,38,10,251,15,248,220,68,10,208,
+38,10,251,129,248,197,21,247,65,10,251,156,36,10,130,249,245,107,10,14,97,
+44,29,251,96,249,106,160,29,97,44,29,87,248,37,247,9,29,109,130,29,103,104,
+68,101,30,14,208,43,29,41,248,158,49,10,208,43,29,247,17,249,76,21,83,6,251,
+28,42,49,247,26,29,208,34,29,251,25,214,65,29,153,41,29,221,247,255,159,29,
+153,41,29,247,197,248,173,48,29,42,39,10,247,154,248,156,49,10,42,247,94,
+123,21,137,154,145,139,152,27,208,203,159,173,176,31,178,175,162,193,197,
+26,227,94,205,251,15,232,30,73,10,103,251,116,5,242,10,156,133,153,135,155,
+134,83,56,24,152,127,5,142,150,147,132,29,130,247,58,10,97,59,29,125,248,
+59,48,29,208,32,10,251,207,247,212,50,10,208,32,10,252,27,221,65,29,97,51,
+29,251,60,249,106,46,29,97,51,29,251,21,249,245,107,10,14,153,35,29,247,136,
+248,221,84,29,97,59,29,252,153,253,181,71,10,160,39,29,68,247,167,21,191,
+6,53,247,66,5,57,6,251,52,251,66,5,196,6,247,23,234,5,14,247,128,37,10,251,
+185,220,45,29,247,128,37,10,252,139,247,112,122,10,97,40,10,247,248,247,37,
+45,29,247,17,247,52,248,114,21,35,252,17,106,10,164,7,247,19,29,145,161,222,
+247,195,5,202,6,151,183,5,76,6,153,189,155,192,153,151,190,146,25,164,251,
+190,114,7,171,134,153,138,149,135,146,135,25,145,135,143,131,128,26,127,134,
+108,134,121,30,132,115,5,251,131,6,153,189,231,29,135,145,134,225,29,121,
+132,111,30,132,115,5,75,6,126,95,5,247,104,22,247,132,6,110,34,5,251,131,
+6,14,153,32,29,192,249,213,84,29,216,248,230,117,10,247,92,252,124,75,10,
+95,105,145,94,27,61,135,29,210,146,145,192,144,25,14,247,25,249,38,233,29,
+145,141,147,141,147,54,29,102,114,10,251,156,36,10,247,89,249,213,84,29,251,
+156,247,156,93,29,247,127,7,105,93,130,121,111,107,29,100,115,161,176,157,
+146,155,152,150,31,14,251,40,248,163,82,29,191,154,153,188,145,25,125,241,
+45,29,153,52,10,252,60,252,20,71,10,97,44,29,252,70,251,216,71,10,208,43,
+29,252,5,252,164,57,10,208,34,29,247,74,247,74,84,29,153,41,29,251,40,253,
+67,71,10,48,248,97,117,10,252,6,253,216,155,29,93,206,251,14,231,31,77,186,
+124,161,184,26,204,179,179,204,218,178,90,251,9,152,218,10,125,142,147,113,
+96,10,14,208,38,10,252,190,253,8,57,10,208,32,10,251,8,247,81,84,29,208,248,
+172,249,49,21,114,7,82,10,247,22,192,183,149,160,181,30,97,87,128,116,109,
+26,92,184,105,200,189,186,168,185,165,247,14,10,128,136,124,27,99,116,161,
+179,176,150,180,157,165,31,164,177,155,163,144,150,149,161,151,175,159,209,
+247,18,10,164,7,14,153,32,29,152,250,12,68,10,251,156,36,10,247,42,250,12,
+21,73,108,103,247,37,10,86,141,122,151,113,30,95,160,247,25,10,38,247,133,
+247,16,21,90,104,121,121,126,27,132,134,145,146,143,141,148,141,147,31,247,
+4,248,7,251,82,111,132,115,5,140,147,146,140,143,27,156,154,125,124,131,135,
+121,133,120,31,73,251,108,5,132,118,136,120,121,26,93,165,111,182,166,161,
+150,170,173,30,162,159,151,155,164,180,8,130,248,230,21,99,107,106,98,97,
+170,106,179,178,170,172,180,180,108,173,101,31,247,175,251,133,21,251,80,
+104,132,115,5,156,148,138,138,142,31,155,134,148,126,122,26,130,137,128,134,
+119,30,60,251,208,5,251,14,108,118,92,115,27,133,132,145,144,142,141,144,
+144,145,31,146,148,142,146,146,26,157,121,155,118,111,118,118,111,109,170,
+117,180,181,189,162,170,170,30,177,180,171,206,162,227,8,194,249,7,21,101,
+109,108,100,99,169,107,176,176,169,171,178,178,109,171,103,31,14,251,212,
+247,34,248,38,21,92,251,105,108,251,31,132,104,8,251,37,110,119,97,100,27,
+129,131,144,145,141,140,142,142,143,31,147,150,143,150,150,26,163,115,163,
+114,112,115,114,111,91,178,108,198,192,182,161,182,173,30,184,196,179,247,
+3,172,247,49,219,248,18,141,148,165,183,8,166,155,156,152,157,247,13,10,128,
+136,130,129,26,111,160,118,167,168,160,161,170,187,101,170,79,87,91,118,100,
+104,30,98,93,119,98,112,39,8,67,6,130,97,5,14,33,29,247,58,247,150,68,10,
+95,10,101,164,115,180,135,30,114,102,132,123,114,80,29,179,163,146,154,167,
+169,31,168,172,150,153,164,177,8,119,10,14,251,101,45,10,46,248,29,46,29,
+251,101,45,10,247,14,248,203,48,29,251,101,45,10,96,248,168,107,10,14,112,
+55,10,247,119,120,204,10,94,247,52,10,159,126,146,130,126,26,107,104,104,
+67,101,30,14,247,236,248,149,21,117,55,118,10,117,155,5,209,29,199,247,111,
+5,205,6,147,170,5,73,6,182,247,47,79,125,91,133,38,130,25,112,160,7,165,154,
+129,121,132,138,133,131,110,31,138,135,136,127,135,126,8,251,30,6,130,108,
+5,204,46,123,29,14,251,101,34,10,247,211,248,112,48,29,251,101,34,10,247,
+27,248,77,107,10,14,251,101,108,10,227,159,155,142,146,162,30,106,96,131,
+120,112,107,29,97,118,161,184,174,146,156,169,176,31,157,161,149,154,161,
+175,8,157,29,14,41,10,247,69,247,139,68,10,251,40,247,184,249,46,21,105,112,
+111,103,104,166,110,172,173,166,168,174,174,112,168,106,31,247,76,251,129,
+47,10,14,252,11,53,10,102,248,235,158,10,251,139,53,10,202,247,166,247,9,
+29,108,130,29,103,104,69,101,30,14,42,36,29,251,85,248,30,49,10,42,36,29,
+169,248,204,48,29,35,10,66,222,21,247,43,226,5,169,156,148,150,158,26,165,
+118,160,112,122,247,68,10,157,148,149,247,64,29,251,156,51,10,247,81,221,
+46,29,251,156,43,10,45,247,100,46,29,251,156,43,10,173,247,100,45,29,251,
+156,112,10,117,150,159,124,101,10,165,103,56,155,30,166,137,5,251,216,253,
+12,71,29,251,158,247,183,248,66,21,145,123,5,234,195,186,201,204,26,192,108,
+174,93,102,112,111,101,115,148,124,166,121,30,160,126,145,130,126,26,116,
+115,108,102,115,30,48,89,29,42,33,10,251,38,249,14,50,10,42,33,10,251,154,
+248,32,65,29,251,156,40,29,247,52,206,46,29,251,156,40,29,247,91,247,98,107,
+10,14,42,247,16,248,139,21,251,29,252,139,98,10,117,154,5,77,96,120,118,126,
+27,131,130,148,146,141,140,143,141,145,31,197,247,70,5,159,201,149,180,159,
+26,185,111,167,91,103,109,127,109,104,30,108,112,115,110,83,58,195,247,112,
+24,247,27,6,151,179,5,251,28,6,179,247,48,61,123,89,132,59,132,25,112,161,
+7,167,152,128,117,129,137,128,133,118,31,133,115,5,75,6,127,99,5,14,252,11,
+247,173,248,85,21,247,10,29,86,59,88,121,29,158,157,212,175,247,12,31,148,
+173,146,163,156,200,8,222,6,251,242,253,111,71,29,153,38,29,248,102,221,45,
+29,153,38,29,247,144,247,113,42,29,33,29,247,103,247,95,21,251,217,6,122,
+69,5,247,217,6,14,251,101,37,29,247,232,217,45,29,251,97,247,212,99,29,251,
+56,251,52,207,10,204,248,29,45,29,251,101,34,10,247,193,248,45,84,29,251,
+40,248,113,248,65,47,10,247,30,224,218,29,247,22,234,5,14,252,11,44,10,200,
+248,187,164,29,247,59,29,252,11,44,10,247,20,248,132,84,29,252,8,171,248,
+43,21,190,150,134,113,126,135,116,131,109,31,47,251,247,5,38,113,122,109,
+151,10,202,239,207,215,247,47,180,247,6,29,247,121,221,45,29,69,29,81,251,
+216,57,10,252,11,247,107,247,8,29,152,146,169,154,196,232,29,150,142,139,
+146,27,166,154,129,121,125,125,78,120,72,31,64,251,156,5,118,62,126,81,116,
+247,32,29,251,199,252,87,71,29,42,36,29,252,60,252,82,57,10,35,10,247,94,
+247,82,84,29,251,156,247,34,10,109,251,5,67,251,136,30,247,13,6,185,247,38,
+157,221,29,145,31,122,154,152,131,156,27,172,164,170,181,179,116,165,105,
+88,99,89,251,51,59,247,15,10,41,253,138,71,29,48,248,108,247,25,62,29,114,
+248,194,238,29,6,85,141,124,152,112,30,95,158,180,247,38,29,42,33,10,152,
+248,139,84,29,42,248,6,248,85,21,83,29,84,133,113,110,26,98,160,120,184,151,
+146,140,143,155,30,107,96,131,121,112,80,29,180,177,148,161,170,179,31,157,
+161,146,150,155,167,118,152,24,191,10,14,251,156,51,10,248,48,247,148,48,
+29,251,156,247,6,127,21,138,147,146,139,143,27,222,190,10,166,103,56,154,
+30,166,137,162,247,45,5,120,29,118,150,159,123,179,10,145,151,136,134,152,
+31,140,142,138,138,142,31,79,50,74,10,41,10,247,23,247,226,21,34,93,72,62,
+66,26,86,170,104,184,176,166,167,176,164,130,153,112,158,30,118,152,133,148,
+152,26,171,175,174,209,176,30,14,247,181,248,45,21,140,142,5,247,36,195,222,
+232,210,27,199,177,80,46,31,128,158,7,188,247,94,5,120,6,122,130,129,132,
+125,27,132,129,141,143,129,31,155,89,126,142,110,27,251,23,251,37,251,13,
+251,51,81,31,94,6,106,89,5,203,6,133,120,135,123,136,121,8,91,6,106,89,5,
+217,6,138,134,139,132,139,26,251,49,211,47,247,13,223,206,172,202,181,30,
+152,181,5,74,91,84,108,74,27,67,98,196,239,160,140,157,143,162,31,247,1,6,
+172,189,5,251,27,6,143,157,145,161,144,152,8,247,59,6,172,189,5,14,247,117,
+247,85,62,10,248,73,111,21,89,6,167,242,5,107,6,99,80,105,111,81,117,8,107,
+174,7,92,251,55,5,128,99,133,111,126,26,109,161,119,171,184,165,160,219,191,
+30,117,153,5,103,115,119,117,129,27,136,135,142,143,152,153,192,163,222,31,
+146,163,144,154,150,181,8,199,6,14,153,40,29,248,185,251,200,92,10,251,68,
+126,86,247,0,29,247,118,177,21,109,161,126,172,197,26,213,166,247,13,176,
+235,30,247,27,192,200,207,206,27,197,177,88,59,121,138,126,135,114,31,166,
+6,198,247,115,5,117,6,108,126,125,124,123,27,131,132,141,143,132,31,168,91,
+120,145,98,27,251,75,251,76,251,127,251,128,68,160,78,177,102,31,109,170,
+183,124,200,27,213,200,164,202,218,31,117,164,104,109,112,122,104,125,25,
+178,247,35,151,180,146,151,165,164,25,113,148,151,129,164,27,179,169,172,
+183,165,123,154,111,106,108,115,82,98,31,157,209,5,251,24,6,133,119,5,161,
+135,143,135,124,26,129,138,129,136,129,30,14,252,39,247,18,248,41,78,29,252,
+39,247,18,248,41,78,29,251,212,213,29,247,239,224,29,247,72,249,151,249,64,
+21,79,6,252,249,253,91,5,198,6,247,74,248,84,21,104,104,106,123,103,27,97,
+112,173,189,187,154,188,166,183,31,184,166,171,162,174,27,153,150,132,129,
+134,135,133,132,134,31,123,127,132,128,124,26,117,156,123,162,168,163,167,
+171,180,107,164,86,251,9,251,7,251,14,251,17,68,181,96,209,203,191,168,202,
+193,30,247,244,79,21,251,13,251,7,251,16,251,22,73,181,98,207,200,194,166,
+193,187,31,185,191,164,199,198,26,205,96,182,73,30,123,119,21,159,151,122,
+113,73,112,45,99,69,31,106,121,121,124,121,27,116,125,156,167,207,180,247,
+21,179,192,31,158,152,152,146,158,27,14,251,212,247,134,247,247,21,114,193,
+129,174,170,26,182,155,154,181,137,30,166,137,158,143,150,149,8,157,155,149,
+160,161,26,178,104,171,95,112,115,125,112,117,30,116,109,130,108,93,26,76,
+155,84,174,76,30,14,252,122,224,10,251,212,248,29,249,3,84,29,248,70,247,
+19,21,84,98,124,124,123,27,132,134,145,148,164,148,180,164,221,120,10,102,
+169,110,176,186,186,178,226,196,116,10,189,247,216,163,10,111,113,107,108,
+113,165,171,171,165,166,170,31,135,205,46,29,48,248,115,247,34,21,78,96,120,
+117,126,27,131,130,148,146,142,139,141,142,146,61,29,89,248,255,45,29,251,
+101,34,10,247,160,248,100,21,73,108,104,115,74,27,75,106,168,200,133,31,96,
+126,6,38,183,91,232,236,247,59,29,252,11,106,29,81,126,75,130,59,172,29,102,
+167,113,178,142,147,139,140,145,30,110,99,131,121,113,80,29,181,173,147,155,
+175,176,31,163,164,149,153,166,180,8,176,10,251,166,247,110,88,10,230,247,
+173,21,97,106,235,29,14,35,10,247,43,247,137,164,29,204,197,243,156,30,14,
+63,29,247,35,248,118,21,247,44,226,5,169,157,148,149,247,64,29,252,11,44,
+10,239,248,164,116,29,128,166,149,137,158,27,199,174,174,223,162,31,14,42,
+248,122,249,35,189,10,95,94,66,125,136,29,128,166,149,137,158,27,200,173,
+174,223,162,31,84,252,158,62,29,14,97,44,29,68,248,44,78,29,208,34,29,247,
+45,247,129,21,73,108,103,115,74,27,75,107,168,200,133,31,96,6,86,142,122,
+212,29,42,39,10,170,252,166,57,10,97,247,133,22,247,32,156,29,175,247,84,
+5,157,10,247,39,6,76,47,202,29,123,143,152,110,166,10,252,11,221,132,21,189,
+149,178,175,193,227,117,153,24,87,106,112,111,123,27,131,131,146,147,158,
+158,215,174,247,9,31,150,177,144,159,156,200,8,222,181,247,10,29,86,59,88,
+247,42,10,71,251,130,5,124,87,130,96,121,26,107,158,115,169,132,30,81,54,
+152,127,5,142,151,147,140,149,125,29,14,216,32,10,251,9,247,143,200,10,133,
+138,26,38,183,91,232,236,204,198,242,156,30,14,153,192,29,106,89,125,127,
+104,29,203,248,231,21,81,90,105,100,96,186,105,198,199,186,173,181,179,91,
+173,81,31,137,105,21,172,166,120,116,117,111,121,107,108,113,158,160,162,
+165,158,170,31,96,175,21,247,44,200,5,169,151,148,147,152,26,157,117,154,
+113,121,124,131,112,102,30,251,14,47,5,14,208,247,16,29,118,142,109,27,251,
+106,251,99,251,124,251,133,76,29,116,144,118,245,29,86,27,112,121,145,155,
+118,31,247,140,249,75,21,247,44,226,5,169,157,148,149,158,26,165,117,160,
+112,122,136,10,14,247,183,174,10,98,122,150,165,146,140,147,142,150,31,140,
+141,247,7,29,130,138,128,56,10,247,72,248,77,177,29,159,26,164,247,62,29,
+208,248,77,200,21,114,60,5,55,111,87,65,108,247,33,29,146,150,142,239,29,
+202,238,205,212,247,49,184,30,247,24,248,104,156,10,251,107,248,101,5,115,
+10,5,14,97,248,7,247,246,21,217,247,172,247,54,29,175,247,84,5,252,187,6,
+101,251,63,164,132,191,239,202,181,241,140,25,62,251,172,5,49,6,126,85,5,
+227,6,83,251,95,5,88,125,113,118,88,27,125,114,247,223,242,29,186,247,64,
+5,232,6,151,193,5,14,251,17,247,140,248,97,21,146,10,176,247,30,167,212,181,
+214,8,201,174,183,181,167,27,152,149,131,129,131,138,131,137,131,31,38,252,
+29,131,10,201,193,189,163,180,169,30,170,181,168,203,155,199,203,247,140,
+24,158,212,146,171,155,26,182,111,165,93,64,80,85,251,33,60,30,14,252,11,
+247,58,247,186,21,145,158,148,173,140,141,155,197,25,222,181,247,10,29,85,
+59,89,247,42,10,107,251,5,5,94,6,125,85,5,182,6,119,68,145,29,156,152,190,
+166,235,31,224,6,152,193,5,14,247,65,247,66,21,206,196,178,251,65,5,96,148,
+160,119,174,27,187,185,185,223,177,31,114,6,98,120,128,127,123,27,126,131,
+153,178,131,31,96,247,78,209,199,181,178,178,160,166,138,25,145,159,5,251,
+91,6,134,119,5,179,135,149,132,119,26,124,129,122,123,124,30,251,43,251,25,
+218,247,140,251,71,113,133,115,5,167,152,129,115,130,137,126,135,127,31,35,
+251,241,5,247,7,6,14,185,225,248,93,21,197,159,166,154,168,164,8,180,173,
+160,179,181,26,186,110,172,99,103,110,109,103,120,146,122,154,121,30,155,
+120,143,132,130,26,110,106,112,79,117,30,248,182,251,237,247,13,29,144,156,
+159,199,31,176,247,1,5,154,184,149,185,219,10,73,40,202,247,90,24,76,125,
+58,128,83,137,8,112,7,181,138,151,134,120,26,127,125,84,108,251,3,30,114,
+50,133,120,113,43,8,247,13,6,186,247,65,176,226,200,220,8,166,159,170,161,
+157,27,152,151,129,128,135,137,131,136,130,31,84,251,58,5,123,89,127,84,247,
+23,10,14,208,32,10,32,247,107,21,107,124,126,129,116,27,127,124,144,150,112,
+31,156,99,106,148,114,27,82,94,93,67,126,136,29,129,166,150,136,158,27,199,
+174,175,222,161,31,14,208,247,244,248,32,21,189,121,119,155,96,27,251,19,
+251,41,251,84,251,56,71,187,89,204,207,140,29,99,113,171,191,154,140,151,
+81,10,126,112,81,109,91,80,102,31,108,120,117,130,111,135,8,130,247,194,177,
+29,159,26,164,117,160,113,121,136,10,14,251,156,247,157,90,29,247,73,249,
+236,247,4,29,156,98,107,148,114,27,82,94,93,67,126,136,29,129,164,152,136,
+157,27,199,175,175,222,161,31,14,247,128,37,10,252,3,220,247,9,10,119,151,
+119,212,10,247,128,37,10,251,248,220,49,10,153,38,29,248,6,221,104,10,153,
+38,29,248,12,221,49,10,97,40,10,247,183,247,37,104,10,251,101,37,29,247,124,
+217,67,29,14,252,39,14,247,239,248,27,248,154,200,29,251,20,251,0,21,146,
+54,150,98,169,94,8,76,181,203,107,222,27,216,199,166,193,181,31,175,186,154,
+184,146,232,128,89,128,117,113,109,8,84,91,79,113,58,27,58,79,165,194,91,
+31,113,169,128,161,128,189,8,247,238,247,0,200,29,251,1,247,104,133,10,137,
+90,21,247,69,247,33,251,32,251,68,251,67,251,33,251,33,251,67,251,65,251,
+35,247,33,247,62,247,71,247,30,247,34,247,68,31,14,247,239,248,137,249,110,
+133,10,251,1,251,99,201,10,251,20,251,5,21,150,89,150,117,165,109,8,84,187,
+199,113,220,27,220,199,165,194,187,31,165,169,150,161,150,189,132,54,128,
+98,109,94,8,76,97,75,107,56,27,62,79,166,193,97,31,103,186,124,184,132,232,
+8,247,238,247,5,201,10,14,247,239,248,135,111,21,156,222,199,243,247,11,247,
+43,180,192,155,160,154,163,8,177,202,157,194,193,26,220,68,207,55,91,95,118,
+101,106,30,118,114,129,117,126,93,8,242,103,86,187,58,27,54,72,70,52,74,163,
+86,220,251,1,31,247,44,251,95,178,72,165,36,8,14,247,239,248,149,249,137,
+21,66,251,19,77,51,251,33,251,69,240,251,15,247,53,251,120,153,97,222,247,
+32,223,247,11,247,3,247,26,251,11,247,38,42,247,29,77,247,1,8,14,247,239,
+249,131,22,159,7,132,141,116,144,62,158,139,140,112,156,25,69,187,100,216,
+228,26,148,7,155,7,159,103,148,126,151,124,8,92,177,200,109,193,27,230,211,
+213,232,231,74,210,57,113,128,136,121,103,31,136,138,130,134,130,135,8,168,
+183,149,165,176,26,229,67,210,47,46,68,69,49,103,146,120,173,86,30,163,88,
+120,145,112,27,61,73,64,51,45,211,67,233,219,209,190,229,182,31,140,114,5,
+131,7,84,113,69,101,95,30,92,90,138,138,251,14,110,131,137,24,119,7,14,247,
+239,248,171,247,153,21,127,7,68,107,69,90,102,30,108,98,86,122,87,27,126,
+116,248,119,162,6,251,50,145,60,227,142,247,61,8,53,185,182,109,218,27,205,
+196,202,212,208,115,176,251,1,239,31,251,2,241,122,165,99,247,9,124,48,77,
+48,35,57,8,60,73,103,81,76,26,64,200,77,212,180,180,156,169,172,30,158,157,
+150,154,156,176,8,14,208,248,193,248,229,21,67,188,156,121,156,27,149,147,
+146,149,145,138,143,132,153,31,116,182,122,203,183,26,169,137,145,126,134,
+132,136,131,126,30,120,112,61,117,96,27,113,138,131,134,126,26,117,173,129,
+226,133,30,37,251,77,5,151,108,110,145,107,27,251,26,251,0,251,0,251,26,251,
+25,247,0,251,0,247,26,247,25,247,0,247,0,247,26,216,102,211,76,185,31,251,
+34,123,21,238,220,59,40,40,59,58,40,39,59,219,238,238,219,220,238,31,14,208,
+248,25,247,167,21,179,147,156,144,164,154,8,208,180,180,210,217,26,247,14,
+41,237,251,14,251,13,41,41,251,14,61,180,68,208,98,30,163,124,156,133,179,
+132,8,62,251,41,87,247,41,251,44,195,247,44,247,40,191,251,40,7,108,248,94,
+21,231,213,67,49,48,66,66,49,49,66,212,229,227,212,214,226,31,14,247,129,
+247,67,21,146,124,119,143,122,27,77,84,86,80,104,165,117,180,186,183,162,
+177,166,31,159,166,145,161,141,187,8,247,185,7,195,131,185,63,56,26,89,131,
+101,115,84,30,166,6,175,182,158,194,197,26,214,110,210,81,209,30,88,200,138,
+140,134,146,131,149,25,197,95,7,14,247,239,247,205,248,119,21,110,102,124,
+103,133,91,8,251,5,84,247,5,6,143,97,158,91,166,106,59,60,24,177,101,219,
+219,177,110,178,123,184,134,25,251,5,193,247,5,7,183,144,185,158,171,165,
+219,59,24,176,177,59,219,168,174,156,181,144,184,25,247,5,194,251,5,6,134,
+182,121,183,112,173,218,218,24,102,177,59,59,108,165,95,158,92,145,25,247,
+4,85,251,4,7,96,134,92,120,107,112,59,219,24,101,101,5,247,156,85,21,236,
+216,64,45,43,63,62,44,45,62,216,234,231,216,217,230,31,14,247,239,250,66,
+249,143,21,254,9,254,9,250,9,6,252,81,248,222,21,220,204,75,61,58,75,75,59,
+60,75,203,219,216,204,205,215,31,14,208,248,2,248,155,21,251,39,251,9,251,
+6,251,35,251,38,247,7,251,8,247,37,247,35,247,8,247,8,247,36,247,33,251,8,
+247,10,251,31,31,131,78,21,247,4,229,51,251,1,251,3,51,50,251,2,251,2,50,
+228,247,2,246,228,230,245,31,14,247,239,248,141,248,247,21,251,52,251,20,
+251,17,251,48,251,50,247,18,251,19,247,49,247,48,247,19,247,19,247,48,247,
+46,251,19,247,21,251,43,31,248,73,247,52,21,254,9,254,9,250,9,6,252,84,249,
+139,21,247,70,247,35,251,32,251,66,251,68,251,32,251,34,251,68,251,66,251,
+33,247,33,247,67,247,63,247,34,247,37,247,60,31,14,247,239,247,34,22,249,
+96,247,250,253,96,6,14,208,247,21,29,14,208,247,21,29,179,252,63,21,248,23,
+248,23,252,23,7,14,208,248,208,247,103,21,251,103,248,36,251,103,252,36,5,
+14,208,247,249,4,155,10,14,208,249,102,247,249,152,29,208,249,3,248,55,21,
+252,160,6,247,102,220,116,192,251,178,251,20,5,62,7,247,178,251,19,162,191,
+251,102,221,5,248,160,6,251,102,57,162,87,247,178,247,19,5,216,7,251,178,
+247,20,116,86,5,14,208,248,27,22,249,3,7,220,251,102,192,163,251,20,247,177,
+5,62,6,251,19,251,177,191,115,221,247,102,5,253,3,7,14,208,248,27,249,102,
+21,75,253,3,6,57,247,102,87,203,10,14,208,247,222,249,3,138,10,162,247,22,
+10,116,5,14,208,247,91,44,21,81,247,219,197,7,251,88,249,66,138,10,163,247,
+22,10,115,5,14,60,247,141,22,199,138,247,89,248,11,251,81,248,2,5,76,6,251,
+88,251,255,5,247,114,251,138,21,251,14,247,137,247,18,247,127,247,13,251,
+129,5,14,208,248,208,248,175,21,252,58,6,247,103,252,36,5,14,208,247,254,
+248,133,21,251,11,43,43,251,12,251,11,235,44,247,11,247,12,234,234,247,11,
+247,12,43,235,251,11,31,14,247,239,250,8,248,237,21,75,251,72,252,195,6,180,
+10,249,3,6,14,251,212,197,247,130,21,247,66,251,232,5,124,147,149,131,151,
+27,147,144,143,146,146,137,147,136,147,31,251,23,247,221,247,23,247,221,5,
+142,147,141,147,146,26,147,134,143,131,127,131,133,121,129,30,14,251,212,
+247,167,247,130,21,251,66,247,232,5,156,130,130,146,127,27,131,134,135,131,
+133,141,131,142,130,31,247,23,251,221,251,23,251,221,5,136,132,137,131,132,
+26,131,144,135,147,151,147,145,156,149,30,14,79,248,39,248,28,21,251,105,
+6,65,247,77,5,45,6,247,125,252,213,5,222,6,247,125,248,213,5,45,6,34,251,
+157,21,63,251,72,64,247,72,5,14,247,191,247,184,21,251,148,247,217,5,129,
+117,134,119,118,26,119,146,124,159,113,30,209,52,83,34,5,121,106,129,111,
+119,26,119,148,117,159,104,30,165,96,139,139,128,26,121,126,129,117,30,121,
+78,221,6,226,162,154,198,179,130,158,84,212,31,105,185,127,167,168,26,158,
+143,151,158,174,30,247,191,252,11,5,149,160,144,157,159,26,160,131,157,114,
+170,30,100,189,5,102,185,129,160,172,26,158,142,153,151,170,30,183,245,5,
+161,6,161,149,129,114,143,31,148,170,143,165,168,26,191,122,159,95,30,71,
+6,100,126,150,171,31,155,7,110,108,125,106,99,26,112,147,115,153,126,30,129,
+149,153,135,170,27,179,6,14,251,121,189,22,247,217,248,213,251,217,55,247,
+133,251,54,251,133,55,247,133,251,55,251,133,6,14,208,248,226,248,233,21,
+109,134,111,132,117,30,113,129,128,129,118,27,121,132,150,203,112,31,118,
+189,121,167,117,157,8,167,107,96,154,90,27,251,15,37,43,251,9,81,160,93,182,
+102,31,176,107,170,125,199,130,144,176,24,89,148,115,149,112,161,8,106,166,
+119,183,183,26,221,208,210,219,194,172,109,51,182,30,74,171,170,114,190,27,
+213,178,195,244,140,31,151,7,164,251,229,21,132,169,134,155,131,156,8,184,
+119,105,163,93,27,66,75,79,70,114,146,109,151,112,31,182,43,139,139,140,113,
+8,103,141,104,108,95,27,101,110,156,183,108,31,94,202,139,139,134,144,124,
+157,116,156,116,150,8,152,113,107,146,110,27,130,6,138,104,174,127,153,129,
+158,111,25,195,48,139,139,165,112,8,103,173,178,120,180,27,186,201,162,173,
+184,31,181,171,159,172,175,26,156,135,156,128,162,30,89,247,7,136,147,164,
+26,168,161,161,168,178,162,113,75,154,30,14,247,17,247,8,151,21,155,149,147,
+146,150,27,149,148,136,134,146,31,108,186,139,139,166,27,178,180,168,188,
+172,31,168,183,154,197,208,26,196,7,140,146,145,139,142,27,161,152,136,132,
+149,31,152,131,142,131,151,91,181,251,60,24,95,150,154,116,158,27,172,182,
+169,188,178,31,126,153,5,135,128,134,137,133,27,118,128,152,177,130,31,110,
+247,3,124,195,125,161,110,157,25,233,172,179,176,192,26,219,75,200,55,83,
+96,120,92,94,30,181,113,92,164,88,27,41,61,56,34,78,157,110,198,106,31,178,
+117,157,118,114,26,133,138,131,137,129,30,150,136,5,172,178,151,163,165,26,
+161,125,156,108,155,30,84,167,139,139,131,146,8,118,156,128,161,165,26,193,
+179,180,191,206,170,88,251,3,30,251,40,7,83,136,114,129,110,30,120,132,125,
+121,129,27,134,133,142,144,131,31,156,116,124,145,120,27,98,112,110,74,117,
+31,247,195,247,251,21,222,137,151,127,182,30,160,168,157,145,170,27,194,178,
+103,89,106,120,108,109,123,31,110,124,121,133,77,124,8,14,153,170,249,10,
+21,247,149,253,10,5,227,6,247,151,249,10,5,251,195,252,164,21,251,74,248,
+91,5,248,1,6,14,153,172,22,248,238,6,251,173,249,68,5,251,107,252,230,21,
+247,64,248,9,247,47,252,9,5,14,208,247,253,210,21,68,221,5,248,131,97,252,
+82,7,87,199,5,82,6,247,114,251,154,247,114,247,154,5,82,6,87,79,5,248,82,
+97,252,131,7,14,208,247,253,248,213,21,210,57,5,252,131,181,248,82,7,191,
+79,5,196,6,251,114,247,154,251,114,251,154,5,196,6,191,199,5,252,82,181,248,
+131,7,14,247,239,248,214,247,203,21,247,66,227,251,21,6,179,220,61,178,78,
+251,12,5,251,168,51,247,124,6,81,251,8,5,251,66,51,247,21,6,99,58,217,100,
+200,247,12,5,247,168,227,251,124,6,14,247,239,247,140,247,99,21,248,140,229,
+252,140,6,251,148,4,248,140,229,252,140,6,247,134,4,248,140,229,252,140,6,
+14,208,248,63,104,21,182,6,247,44,250,64,62,150,251,9,253,105,251,68,247,
+248,251,74,50,172,68,234,186,5,14,247,239,248,101,247,135,21,67,140,99,142,
+81,30,141,109,140,111,122,26,111,130,120,127,136,135,143,147,134,30,159,129,
+128,147,120,27,114,119,120,114,108,168,116,180,177,172,158,173,158,31,164,
+184,153,247,0,247,36,26,247,214,7,214,138,176,136,198,30,137,167,138,172,
+150,26,167,147,160,149,143,141,137,132,143,30,120,149,155,128,158,27,165,
+158,158,163,172,110,161,98,101,106,119,106,120,31,114,94,125,251,0,251,36,
+26,14,208,248,48,251,97,21,248,250,7,183,135,200,129,243,30,135,181,137,161,
+151,26,157,145,149,151,145,141,138,128,150,30,130,149,150,134,153,27,165,
+161,161,166,170,111,163,104,95,108,108,81,125,31,123,75,134,66,251,65,26,
+252,242,7,14,208,247,231,249,180,21,252,251,7,96,143,78,149,35,30,143,97,
+141,117,127,26,121,133,129,127,133,137,140,150,128,30,148,129,128,144,125,
+27,113,117,117,112,108,167,115,174,183,170,170,197,153,31,155,203,144,212,
+247,65,26,248,242,7,14,247,239,249,56,247,107,21,107,114,120,126,115,27,121,
+124,144,161,90,31,173,63,115,146,103,27,88,102,113,81,106,31,192,92,5,172,
+163,155,149,168,27,174,170,130,113,185,31,114,186,164,131,172,27,185,171,
+161,201,184,31,84,247,128,21,106,114,120,126,115,27,121,125,143,162,89,31,
+173,63,115,146,103,27,89,101,113,81,106,31,192,93,5,171,163,155,149,168,27,
+175,169,130,113,185,31,114,185,165,131,172,27,185,171,161,202,184,31,14,247,
+239,249,11,140,21,161,223,5,252,59,6,116,55,5,248,214,248,212,21,252,121,
+251,121,134,119,247,255,251,118,169,247,5,251,136,247,38,247,216,247,44,5,
+14,247,239,247,115,140,21,248,60,6,161,223,5,252,59,6,143,156,21,248,118,
+247,108,144,159,251,252,247,132,109,251,5,247,133,251,52,251,213,251,30,5,
+14,247,128,247,172,247,0,21,247,95,248,52,227,252,140,251,183,7,14,247,239,
+249,100,248,195,21,79,251,141,6,38,134,98,124,110,30,91,114,83,107,80,27,
+87,88,164,179,111,31,116,172,133,180,247,4,26,247,141,79,251,138,7,251,29,
+144,105,163,99,30,74,177,209,102,222,27,215,203,170,195,180,31,172,184,145,
+171,247,41,26,14,247,239,249,100,22,247,138,7,247,29,134,173,115,180,30,202,
+101,68,177,57,27,63,75,108,83,98,31,106,94,133,107,251,41,26,251,138,199,
+247,141,7,240,145,182,156,170,30,185,164,194,169,196,27,192,191,113,97,167,
+31,160,107,145,102,251,6,26,251,141,7,14,247,239,249,147,247,108,21,200,252,
+98,7,145,246,195,189,247,1,137,8,247,183,201,251,172,216,10,56,247,36,29,
+201,251,183,6,251,1,137,83,189,133,245,8,14,247,239,248,106,248,234,21,252,
+173,251,161,78,248,234,200,251,160,248,173,7,14,247,239,248,136,247,164,21,
+96,178,135,142,120,153,8,165,106,96,155,106,27,69,81,81,69,69,197,81,209,
+173,180,155,165,173,31,158,153,143,142,182,178,184,100,143,135,156,126,8,
+113,174,180,123,173,27,209,197,197,209,209,81,197,69,106,96,123,113,105,31,
+122,126,134,135,95,100,8,172,109,21,190,190,191,169,179,27,183,176,102,95,
+94,102,102,95,100,88,168,192,86,31,74,22,87,87,87,110,100,27,95,102,176,183,
+183,176,176,184,178,190,110,87,191,31,14,247,239,249,62,247,59,21,90,140,
+109,156,86,197,8,192,185,176,161,182,27,139,142,139,142,138,30,201,127,7,
+79,81,103,73,89,31,207,85,81,173,80,27,61,83,82,58,59,192,84,217,191,190,
+163,185,181,31,147,147,144,145,155,157,195,70,203,102,199,142,8,251,121,247,
+30,21,135,134,139,139,133,133,8,92,93,106,121,98,27,99,112,169,185,185,167,
+168,184,173,162,127,94,187,31,149,130,139,139,148,130,8,14,247,239,247,140,
+247,207,21,192,176,171,157,196,27,176,161,133,107,224,31,116,202,162,133,
+174,27,211,195,167,201,187,31,77,187,5,101,94,117,129,98,27,104,116,144,164,
+68,31,167,57,98,149,105,27,67,93,107,47,81,31,163,251,46,21,248,225,213,252,
+225,6,138,251,94,21,248,225,213,252,225,6,14,247,235,247,161,247,60,21,92,
+102,234,10,248,94,22,93,101,101,92,93,177,102,186,184,177,178,184,185,101,
+177,93,31,251,121,248,98,21,93,101,234,10,14,247,239,249,69,249,85,21,253,
+114,7,84,138,120,119,84,247,5,29,249,59,7,196,160,162,192,30,156,157,253,
+159,121,155,6,193,159,117,81,140,31,253,59,7,84,138,119,119,85,247,5,29,249,
+114,7,14,247,239,247,238,249,91,21,247,133,6,244,138,165,117,154,38,8,162,
+6,130,247,57,5,252,175,6,247,102,252,103,251,110,252,44,5,248,200,6,188,247,
+102,5,116,6,111,59,108,120,38,140,8,251,188,6,247,73,247,244,5,14,251,118,
+247,135,247,150,21,209,212,158,161,158,166,8,183,205,166,211,193,26,196,107,
+176,91,46,73,251,23,251,175,88,30,127,123,127,125,134,133,8,99,95,139,139,
+126,26,126,148,124,147,146,158,156,160,158,30,137,116,139,123,118,26,98,142,
+120,147,119,30,108,152,166,120,172,27,170,167,157,172,163,31,154,162,149,
+164,157,26,153,132,147,127,130,133,134,123,131,30,103,121,130,128,126,27,
+130,134,148,155,165,147,201,155,234,31,149,209,21,247,91,171,163,211,174,
+27,152,148,126,119,115,125,90,121,99,31,118,91,115,103,103,98,8,14,246,249,
+24,21,166,195,161,145,179,27,160,163,133,129,156,31,192,107,171,57,32,26,
+110,138,117,135,105,30,181,82,103,153,88,27,90,98,122,103,102,31,90,91,111,
+73,73,26,251,2,227,51,247,1,203,195,165,188,181,30,198,208,177,247,28,247,
+31,26,247,12,95,240,57,208,30,175,96,88,157,81,27,96,109,132,113,67,31,247,
+198,252,46,21,123,251,2,125,88,113,96,8,97,112,105,115,103,27,89,110,185,
+216,246,201,226,215,173,163,127,104,175,31,14,247,239,248,139,249,75,21,251,
+92,154,29,251,85,31,135,251,208,21,251,82,247,80,5,184,194,204,162,209,27,
+208,203,117,95,196,31,179,99,21,187,81,162,77,66,26,67,116,75,93,83,30,251,
+84,247,87,5,247,44,251,127,21,95,84,72,115,69,27,69,75,162,186,80,31,247,
+85,247,85,5,251,125,251,45,21,95,193,116,203,209,26,211,162,203,186,196,30,
+247,82,251,80,5,14,171,247,205,248,38,21,251,14,67,76,60,58,26,113,146,111,
+155,97,30,88,64,124,106,98,26,85,176,99,188,193,182,192,206,179,124,186,98,
+224,30,177,187,179,179,195,185,8,192,201,176,158,175,27,172,162,109,95,85,
+115,62,105,89,31,100,114,101,115,106,27,108,111,160,162,152,146,146,153,140,
+31,161,141,154,154,158,26,155,127,151,122,110,115,108,101,93,175,107,190,
+189,196,172,194,186,30,180,186,161,195,194,26,208,99,185,81,60,72,92,251,
+56,251,49,30,130,158,136,157,161,26,214,178,193,233,194,30,251,56,251,224,
+21,180,64,156,95,106,26,108,118,117,109,102,112,170,182,178,146,155,189,215,
+30,14,247,239,248,61,141,21,137,161,145,139,173,27,247,172,201,251,183,6,
+123,6,247,109,248,6,5,229,201,86,6,167,187,97,164,96,66,5,251,62,247,44,29,
+67,43,26,251,16,190,53,229,110,30,111,90,180,113,5,247,126,248,131,21,251,
+105,251,255,5,68,158,105,197,240,26,247,21,191,195,247,13,30,14,247,239,249,
+23,248,53,21,252,68,252,53,5,248,214,181,252,105,6,247,244,247,234,5,14,247,
+239,247,125,201,247,12,10,183,172,211,242,26,246,208,10,247,13,191,84,251,
+22,251,22,87,84,251,13,31,14,247,239,249,147,201,21,251,183,6,251,13,87,194,
+198,10,102,31,74,96,105,67,43,26,251,7,184,55,247,36,29,6,14,247,239,247,
+125,247,58,247,12,10,182,172,212,238,26,247,4,93,224,61,243,29,247,13,191,
+83,251,21,251,22,87,83,251,13,31,247,135,251,3,21,252,170,84,248,170,6,14,
+247,239,249,147,247,58,21,251,183,6,251,13,87,195,198,10,101,31,75,96,105,
+66,43,26,42,167,72,198,93,30,107,179,176,130,229,27,247,172,6,90,4,252,170,
+84,248,170,6,14,247,239,248,164,247,108,21,247,131,200,251,96,6,227,247,47,
+5,247,8,201,58,6,172,198,97,163,92,56,5,251,35,216,10,55,220,105,30,106,82,
+182,116,177,206,5,136,164,153,138,180,27,247,172,201,251,183,6,119,133,139,
+140,129,31,171,247,45,21,58,251,33,87,157,108,190,136,211,25,247,182,247,
+108,21,51,251,47,5,251,94,6,145,246,195,189,247,1,137,8,14,208,219,247,187,
+21,221,210,5,248,188,181,252,139,6,198,29,248,139,181,252,188,6,14,208,249,
+23,247,187,21,57,68,5,252,188,97,248,139,187,29,252,139,97,248,188,6,14,208,
+247,97,248,44,21,198,29,247,204,187,29,251,253,97,21,248,46,6,221,68,57,68,
+5,252,46,6,57,210,5,14,251,95,4,52,248,136,226,7,252,136,247,50,21,52,248,
+136,226,7,14,249,110,249,130,21,208,252,133,70,7,14,247,239,240,177,21,171,
+102,247,14,239,5,64,208,227,100,238,27,247,83,247,47,247,47,247,83,215,117,
+206,93,202,31,247,5,232,107,176,251,5,46,5,208,70,55,174,46,27,251,83,251,
+47,251,47,251,83,68,158,76,180,78,31,177,171,21,107,190,124,193,197,26,247,
+58,247,24,247,28,247,55,218,211,108,80,197,30,170,101,21,175,87,158,79,75,
+26,251,58,251,24,251,27,251,55,55,64,173,205,79,30,14,60,247,28,247,85,21,
+165,209,178,224,216,247,48,8,168,195,146,157,162,26,177,108,167,97,115,119,
+129,121,126,30,125,119,133,120,134,87,117,251,79,127,59,120,59,8,120,197,
+10,248,74,197,21,165,209,179,227,216,247,45,8,167,194,146,158,162,26,177,
+108,167,97,88,117,107,52,130,30,118,251,77,126,54,119,62,8,121,197,10,14,
+247,35,10,14,247,35,10,179,251,217,21,247,177,247,177,251,177,7,14,247,218,
+147,22,250,86,211,254,14,250,3,67,6,14,252,8,247,72,247,248,21,242,247,81,
+5,160,179,151,170,158,26,167,116,160,108,76,100,86,53,137,30,137,251,81,5,
+14,38,248,61,247,248,21,241,247,81,5,171,200,142,146,159,26,169,117,160,108,
+111,110,125,115,118,30,120,116,133,114,138,86,135,251,81,24,251,106,22,242,
+247,81,5,161,180,151,170,157,26,167,116,160,107,77,99,85,55,138,30,136,251,
+82,5,14,247,239,247,45,22,249,80,248,37,6,251,243,247,220,251,241,251,220,
+5,200,251,242,21,247,220,7,247,180,247,162,247,182,251,162,5,251,220,7,14,
+97,247,151,22,124,247,47,5,73,183,98,228,234,26,192,152,198,162,188,30,201,
+169,188,175,195,27,195,188,103,77,169,31,162,90,152,80,86,26,44,97,50,74,
+95,30,124,251,47,5,247,136,247,45,119,6,94,132,123,121,104,27,251,13,6,141,
+177,5,246,184,201,232,247,8,26,187,127,190,116,186,30,239,91,54,197,42,27,
+42,54,81,39,91,31,116,92,127,88,91,26,251,8,201,46,246,94,30,142,101,5,251,
+14,6,104,123,157,184,132,31,119,251,45,6,14,247,239,248,98,247,134,21,34,
+101,177,74,223,212,120,251,3,5,219,6,120,247,3,223,66,177,204,34,177,244,
+176,101,204,55,66,158,247,3,5,59,6,158,251,3,55,212,101,74,5,14,247,239,247,
+125,247,108,21,248,98,6,134,33,82,88,251,1,142,8,251,183,77,247,172,6,222,
+174,146,164,177,31,205,183,171,211,241,26,247,0,208,10,247,1,141,196,88,144,
+33,8,252,98,6,14,86,248,150,247,142,21,138,211,134,174,125,176,8,218,109,
+65,188,49,27,251,27,53,35,251,56,251,54,221,41,247,29,242,209,190,236,167,
+31,98,6,70,109,86,104,64,27,96,104,151,162,115,31,122,155,130,156,128,178,
+8,244,7,247,176,174,21,251,174,232,6,213,172,175,165,206,27,210,192,102,76,
+161,31,14,208,248,238,248,11,21,252,92,247,73,5,251,254,7,14,208,248,213,
+247,86,21,247,254,7,252,92,251,73,5,14,208,248,19,248,87,21,158,114,161,120,
+160,127,195,107,148,133,144,130,8,145,128,143,120,118,26,251,124,7,146,122,
+116,143,120,27,70,77,86,79,104,168,117,184,190,187,162,177,170,31,160,166,
+146,161,141,188,8,248,0,7,140,211,106,213,93,167,84,175,109,159,135,143,8,
+126,153,133,157,162,26,152,95,252,128,7,146,123,116,143,121,27,70,79,86,79,
+104,167,117,183,190,187,162,177,168,31,160,166,146,161,141,188,8,142,248,
+10,21,247,3,79,163,103,143,251,8,251,6,200,116,174,135,247,9,8,14,153,76,
+10,153,53,29,90,247,140,165,21,87,141,121,150,166,26,154,142,157,151,184,
+30,230,248,7,153,195,146,160,149,152,25,152,148,164,145,185,27,218,181,127,
+107,170,31,169,109,150,108,142,81,167,146,24,187,247,86,5,252,223,6,140,113,
+5,192,136,157,129,111,26,125,138,134,130,104,30,42,252,30,114,37,127,123,
+86,136,25,113,247,186,7,14,113,116,22,248,142,6,165,249,42,5,112,6,251,21,
+252,237,21,251,46,6,83,140,139,139,128,143,8,129,142,133,147,148,26,151,154,
+165,172,184,30,247,98,247,171,5,14,153,247,210,247,223,21,202,6,191,168,115,
+98,131,139,137,136,116,109,29,122,114,26,132,110,10,14,97,248,189,247,74,
+21,114,6,32,251,1,77,107,32,137,8,60,6,248,118,248,237,5,161,252,133,7,86,
+251,48,5,172,6,184,219,213,177,246,138,8,241,6,252,114,252,237,133,117,5,
+248,144,6,14,247,17,70,10,251,188,6,133,247,77,29,247,2,247,193,248,98,21,
+82,251,126,5,168,6,192,153,162,157,191,27,175,163,121,112,134,138,135,136,
+122,31,168,6,197,247,126,5,110,6,88,120,119,124,91,27,100,118,154,168,145,
+139,143,141,151,31,247,14,247,109,21,77,75,126,116,85,31,79,113,89,97,90,
+74,8,74,55,107,49,45,26,251,52,241,40,247,57,247,23,247,13,187,217,205,30,
+212,224,189,247,21,238,26,247,50,34,238,251,59,30,140,106,21,178,172,125,
+115,157,31,160,110,152,94,93,26,251,48,56,251,110,56,77,30,118,111,87,124,
+97,27,55,97,190,242,247,33,199,247,70,220,235,31,178,171,194,161,201,27,14,
+251,156,132,10,251,162,6,133,247,75,10,153,247,198,56,29,112,123,156,165,
+147,139,143,141,145,31,14,153,248,9,248,86,21,119,251,252,135,94,193,10,159,
+176,31,150,7,167,248,208,5,114,6,252,54,252,192,96,82,114,170,29,14,247,128,
+79,29,247,175,6,184,10,151,184,158,157,173,142,25,157,118,29,251,83,6,14,
+208,248,188,247,103,21,251,98,248,87,5,251,80,6,133,117,174,138,159,129,158,
+112,25,251,20,252,119,153,29,247,11,248,84,247,151,252,198,5,159,6,247,34,
+248,168,162,224,153,157,183,144,25,226,29,251,59,89,10,181,158,126,113,126,
+137,124,134,123,31,14,145,248,109,247,115,21,203,247,132,5,118,6,87,120,106,
+113,92,27,64,6,84,109,159,176,143,139,143,140,152,31,118,6,75,251,132,5,160,
+6,158,191,172,166,186,138,8,215,6,193,169,119,102,134,139,135,138,127,31,
+247,6,101,21,94,85,76,101,96,140,8,251,98,6,87,138,87,176,115,194,8,121,6,
+121,251,77,5,248,94,6,220,247,77,5,230,248,113,21,252,110,6,95,251,59,5,157,
+6,167,188,190,169,193,137,8,247,78,6,206,141,185,110,145,89,8,157,6,14,208,
+248,112,249,52,21,58,47,103,84,75,31,37,50,74,251,35,251,23,247,32,10,204,
+27,247,107,247,86,247,107,247,130,247,33,53,226,251,30,31,126,99,21,196,176,
+90,62,251,9,85,251,76,77,44,31,90,107,87,108,90,229,10,190,173,196,27,14,
+247,17,249,191,249,42,21,253,14,6,133,67,10,247,18,248,110,247,41,10,247,
+18,247,29,29,251,19,252,110,113,29,14,97,172,10,251,139,89,10,166,6,165,156,
+125,10,147,141,145,31,247,36,248,177,21,203,136,172,106,80,26,103,125,85,
+120,103,30,92,114,110,121,247,58,29,105,248,254,249,43,21,252,177,6,247,30,
+251,243,251,207,251,204,5,248,209,6,240,247,82,5,77,6,103,62,128,130,67,137,
+8,251,121,6,118,130,143,147,149,146,149,167,167,31,247,93,247,96,46,247,134,
+5,247,76,6,180,170,108,99,136,139,135,138,132,31,138,118,5,198,6,14,97,248,
+111,249,0,21,173,137,154,134,158,125,8,164,86,10,97,64,10,14,247,28,248,14,
+173,10,98,125,8,251,25,93,63,219,29,125,91,124,186,10,162,26,146,150,29,183,
+157,156,220,29,189,229,26,247,3,186,247,15,204,197,142,29,100,105,110,127,
+84,136,8,14,153,234,29,110,119,119,91,29,151,26,163,94,10,247,39,250,24,249,
+28,21,160,98,116,146,107,27,105,114,129,118,120,31,118,115,127,108,116,47,
+104,251,46,83,70,251,3,116,225,247,214,24,151,184,157,157,174,142,8,175,29,
+172,138,159,123,113,26,134,138,133,137,132,30,53,251,216,113,145,128,144,
+127,148,25,110,161,122,177,182,26,164,145,175,151,185,30,162,227,140,143,
+163,26,185,111,167,94,109,115,133,116,88,30,142,113,5,143,152,144,140,146,
+27,155,148,128,120,129,138,133,134,119,31,123,80,5,131,108,135,115,118,26,
+92,157,90,169,102,30,175,94,178,122,219,132,104,251,26,24,126,95,116,120,
+100,136,8,118,89,10,247,185,216,29,176,247,28,247,84,158,247,0,221,172,247,
+48,25,155,200,5,217,160,148,154,163,27,146,145,137,134,152,31,14,232,249,
+88,247,68,21,77,6,112,77,126,129,85,138,8,97,6,108,119,137,135,107,31,149,
+152,221,151,184,161,183,188,25,202,211,181,244,226,26,187,121,190,109,176,
+30,198,93,64,166,251,7,27,251,42,251,5,84,251,2,66,31,99,79,116,65,67,26,
+74,158,83,173,103,30,160,117,158,129,181,130,142,126,24,143,109,121,141,107,
+27,97,6,97,122,157,180,141,31,141,139,145,138,145,30,78,6,132,251,68,5,247,
+207,6,164,239,5,75,186,119,178,222,26,218,157,216,175,216,30,244,188,189,
+178,226,27,186,186,122,114,164,31,159,119,151,103,100,26,51,105,251,8,87,
+50,30,102,75,105,112,66,114,114,39,24,247,207,6,14,39,248,23,248,80,21,107,
+60,5,201,128,112,165,87,27,96,88,111,93,97,31,86,82,108,56,60,165,29,192,
+231,175,31,120,151,227,10,247,192,5,251,111,251,159,247,12,29,198,239,10,
+66,148,31,14,251,33,112,251,69,21,247,5,6,197,247,117,5,96,167,159,126,173,
+27,247,7,247,5,247,27,247,28,209,114,185,82,177,31,223,188,177,187,198,26,
+205,90,181,61,89,93,124,111,102,30,96,105,108,80,113,40,8,247,3,128,21,180,
+247,51,145,153,176,167,8,146,148,150,143,149,27,163,154,114,101,94,126,91,
+108,76,31,149,115,128,142,124,27,115,119,123,118,123,153,126,156,154,153,
+145,158,166,31,140,122,139,131,131,26,61,100,251,54,107,87,30,111,122,119,
+124,117,27,113,124,151,182,116,31,14,251,129,172,247,184,21,187,158,170,179,
+157,27,146,144,135,132,143,31,149,118,146,76,77,26,79,137,109,131,39,30,82,
+63,117,92,91,26,104,157,120,170,160,156,148,159,157,30,165,168,152,177,163,
+247,11,221,234,184,190,145,146,8,210,227,169,202,196,26,179,116,168,108,109,
+113,111,107,128,141,127,143,127,30,151,103,140,134,120,26,112,128,112,111,
+99,30,127,123,139,139,80,65,113,107,24,152,219,145,199,202,26,247,4,112,195,
+84,86,85,82,45,103,30,14,251,33,247,165,248,180,21,106,164,122,163,162,26,
+157,152,149,165,180,206,116,93,232,30,154,201,5,167,62,71,151,67,27,89,107,
+128,116,117,31,126,123,129,115,120,26,105,161,110,215,73,30,70,115,106,118,
+103,93,8,93,79,111,61,66,26,39,204,74,238,228,226,187,215,187,30,172,191,
+163,212,188,26,195,112,196,86,194,30,123,155,117,158,126,149,8,73,60,21,198,
+82,162,100,91,26,70,108,45,98,83,30,117,123,112,125,113,27,95,110,174,192,
+192,155,216,164,203,31,166,207,161,168,181,159,8,14,251,135,65,10,14,251,
+104,247,176,249,104,21,65,111,93,102,107,26,113,166,111,186,116,30,251,9,
+32,62,251,58,251,39,26,45,179,97,226,155,151,140,141,147,30,145,168,144,140,
+152,27,166,153,126,114,144,29,92,127,122,137,137,124,31,137,125,126,137,133,
+27,107,121,158,172,196,158,247,3,159,205,31,158,198,164,193,172,193,8,127,
+172,153,136,177,27,226,198,170,183,169,115,158,101,84,85,116,84,69,31,116,
+161,130,156,162,26,168,152,154,188,168,30,14,35,66,10,14,251,26,247,249,249,
+50,21,33,61,59,251,53,87,31,111,51,117,251,7,79,26,251,5,187,78,229,226,216,
+197,237,182,30,185,243,175,247,48,232,26,188,127,185,118,167,30,172,115,109,
+152,85,27,143,251,226,21,110,251,12,121,77,118,87,8,92,120,111,111,109,27,
+112,122,163,180,193,147,184,172,247,37,31,148,176,21,247,97,189,168,198,192,
+27,166,154,116,96,85,132,94,117,40,31,14,252,11,47,29,14,251,15,247,187,247,
+180,21,191,191,170,161,160,27,140,155,136,133,162,31,138,146,148,138,150,
+27,184,165,161,175,166,119,156,105,107,108,127,111,102,31,107,115,133,134,
+251,27,251,37,194,247,106,24,251,69,111,132,115,5,140,147,145,140,144,27,
+156,154,125,124,131,139,139,130,104,31,54,251,223,5,247,3,6,198,247,124,212,
+251,68,5,95,157,160,122,176,27,169,164,151,161,157,31,154,157,146,151,164,
+190,120,151,24,95,116,129,128,119,27,124,132,148,185,120,31,14,251,101,97,
+22,247,25,6,247,57,247,147,5,128,77,135,91,83,26,103,141,120,145,127,30,119,
+147,153,129,157,27,178,183,189,216,168,31,122,147,5,96,109,127,129,118,27,
+115,128,156,175,213,155,247,104,154,247,9,31,142,164,141,163,151,26,189,114,
+168,96,101,116,114,98,118,148,122,159,122,30,179,106,146,127,105,26,131,139,
+130,138,129,30,14,42,248,81,247,21,21,94,118,121,114,129,27,134,136,143,144,
+143,140,145,144,156,31,229,247,241,5,251,6,6,89,251,84,119,85,128,117,111,
+96,25,95,110,126,126,122,27,129,134,145,152,146,139,139,145,158,31,222,247,
+215,5,251,6,6,73,251,146,129,102,129,101,130,102,25,129,103,132,115,134,127,
+137,134,132,124,129,117,8,118,95,131,111,112,26,106,161,116,170,170,164,162,
+168,149,138,152,136,152,30,133,172,137,160,170,26,151,139,147,141,156,30,
+119,151,149,132,157,27,181,172,167,240,214,31,135,123,136,127,136,131,8,133,
+119,136,121,127,26,114,161,121,170,195,189,184,223,178,30,14,251,101,209,
+247,190,21,189,153,163,177,156,27,155,144,82,251,82,83,137,110,130,85,31,
+171,132,156,159,146,146,167,165,25,247,36,247,28,211,247,2,222,26,181,109,
+175,103,113,117,114,109,118,144,127,160,110,30,151,122,145,123,125,26,100,
+108,92,60,57,30,140,209,139,149,154,26,198,136,188,134,176,30,197,130,110,
+173,97,27,85,90,84,53,118,31,14,251,96,247,167,249,105,21,64,113,100,108,
+106,26,116,158,122,192,115,30,118,126,128,131,129,129,8,113,112,121,103,112,
+26,106,155,114,178,113,30,104,121,123,129,114,116,8,77,82,106,73,72,26,59,
+195,88,226,154,159,141,143,162,30,142,153,152,140,147,27,163,153,125,115,
+144,29,93,128,121,137,137,122,31,137,123,124,137,130,27,88,120,157,186,209,
+172,209,198,194,31,113,190,164,131,175,27,198,174,160,175,170,115,157,98,
+97,106,130,115,86,31,130,165,137,152,156,26,178,149,174,161,181,30,118,191,
+168,133,180,27,210,186,165,178,170,112,157,92,80,98,126,97,69,31,116,154,
+128,157,159,26,162,158,159,179,157,30,14,85,29,14,32,248,218,248,80,21,252,
+24,6,69,126,134,95,99,31,62,48,179,122,174,184,175,156,204,141,25,125,87,
+127,104,121,98,101,57,134,132,99,114,123,128,24,111,120,125,115,111,26,117,
+162,122,171,181,171,168,200,168,30,171,206,139,139,199,247,99,8,247,59,6,
+79,116,104,99,122,74,107,251,24,24,135,124,137,125,131,26,110,167,101,160,
+142,145,141,142,146,30,247,10,186,148,175,5,130,115,130,136,127,27,124,132,
+149,160,153,139,140,146,168,31,173,247,32,148,174,144,149,162,167,25,243,
+6,14,251,30,124,251,70,21,247,3,6,195,247,111,5,106,155,166,123,176,27,245,
+247,5,247,42,247,34,241,82,206,52,90,88,120,106,102,31,99,103,126,108,106,
+251,18,8,247,25,221,21,153,196,149,168,149,154,8,157,152,154,149,157,27,165,
+153,113,93,45,104,251,25,99,79,31,122,127,121,128,122,27,117,125,152,173,
+122,31,14,251,6,248,211,248,80,21,251,111,6,251,0,92,126,96,83,31,68,83,92,
+45,51,26,41,205,75,238,247,39,247,20,247,6,247,23,176,126,173,118,160,30,
+126,151,126,145,113,148,8,247,64,6,251,109,22,151,116,142,126,114,26,86,119,
+56,113,83,30,85,114,111,115,100,27,96,112,169,188,219,172,247,0,174,172,31,
+162,164,164,147,190,27,14,251,101,248,112,248,80,21,251,188,6,73,123,133,
+109,115,31,52,251,7,181,124,184,197,178,156,228,138,25,187,6,80,120,102,98,
+120,71,106,251,28,24,137,130,137,126,130,26,105,165,104,165,143,142,140,140,
+143,30,247,18,188,148,177,5,128,110,127,136,126,27,125,133,145,154,155,145,
+170,151,189,31,156,211,154,197,147,157,161,162,25,247,43,6,14,251,55,42,10,
+14,71,247,107,251,82,21,182,247,66,205,142,199,165,192,188,25,205,201,183,
+234,219,26,228,74,210,57,101,101,123,112,112,30,117,116,122,104,125,82,68,
+251,179,24,129,142,132,142,135,143,8,123,150,128,168,172,26,222,176,247,29,
+177,199,30,161,174,161,157,172,150,143,157,24,72,136,91,119,88,91,8,73,78,
+100,54,56,26,76,164,85,181,110,30,164,122,160,132,181,134,96,251,66,24,247,
+102,248,106,21,239,164,150,163,159,27,161,155,108,100,52,90,251,41,95,94,
+31,117,117,124,130,109,131,8,14,251,80,248,97,248,81,21,32,6,251,38,251,115,
+5,247,79,130,122,183,72,27,104,119,122,109,111,154,122,168,131,31,198,128,
+145,127,148,251,39,251,140,251,253,24,247,2,6,247,55,247,139,140,84,143,87,
+147,87,25,68,149,156,108,169,27,176,182,197,232,171,31,118,147,5,82,116,119,
+114,113,27,99,123,203,247,57,135,31,14,154,191,247,184,21,191,164,168,175,
+157,27,145,143,133,131,132,139,139,130,105,31,131,106,5,115,44,134,113,109,
+26,55,207,82,238,30,93,251,70,5,247,2,6,178,247,65,229,151,191,168,186,202,
+25,191,209,174,247,0,232,26,192,117,169,101,107,115,113,104,119,145,123,154,
+114,30,159,106,143,126,113,26,100,123,88,113,98,30,100,76,101,114,61,125,
+234,248,55,24,47,6,33,252,50,5,95,140,113,174,194,26,164,145,168,157,211,
+30,161,225,5,146,165,142,157,154,26,175,115,163,103,83,80,83,47,97,30,14,
+209,247,147,248,87,63,10,251,99,248,90,248,149,21,85,115,117,119,102,27,132,
+129,140,141,127,31,142,122,126,140,129,27,81,81,104,66,78,31,75,64,115,84,
+71,26,48,187,84,219,152,144,140,143,159,30,142,157,151,141,149,27,164,153,
+124,115,102,109,108,104,126,123,143,147,127,31,157,109,132,142,121,27,100,
+114,114,101,102,166,117,183,244,246,245,244,191,113,166,89,127,132,138,136,
+116,31,137,128,130,138,130,27,103,123,160,186,191,149,209,152,173,31,174,
+153,155,149,186,27,152,161,138,137,155,31,135,166,165,137,148,27,176,166,
+157,176,159,31,153,164,146,160,154,194,8,14,251,18,170,247,73,21,187,168,
+159,161,152,27,144,144,133,133,134,137,132,128,105,31,127,99,135,117,113,
+26,67,187,97,222,247,27,224,240,247,122,197,30,162,138,143,139,161,137,149,
+173,24,87,141,5,158,218,146,179,173,26,247,2,80,203,38,251,2,51,58,36,86,
+165,95,188,108,30,174,117,170,131,211,132,110,251,3,113,57,117,89,8,101,121,
+109,113,112,27,114,122,161,171,162,143,158,157,197,31,151,180,144,162,160,
+26,174,114,164,105,92,82,87,59,99,30,248,3,247,69,21,47,152,98,176,208,26,
+225,187,212,195,176,162,103,84,103,133,106,114,251,10,30,14,65,247,233,124,
+21,207,145,195,164,189,185,8,202,198,178,225,221,26,247,4,75,205,251,4,145,
+30,147,172,146,157,158,185,8,154,176,143,153,155,26,172,118,158,103,86,103,
+100,81,90,136,103,133,105,30,251,49,128,251,18,251,28,251,51,26,251,3,203,
+73,247,3,134,30,100,251,65,5,247,6,6,70,247,92,21,97,148,111,196,216,26,219,
+160,211,180,196,30,172,186,172,165,178,149,8,240,22,186,128,165,86,56,26,
+251,31,70,251,14,47,113,30,14,242,247,2,248,130,21,97,96,247,9,145,5,39,64,
+67,251,25,251,3,26,48,185,82,213,199,185,167,212,197,30,69,154,169,108,191,
+27,193,185,169,208,187,31,183,202,158,195,210,26,229,102,202,62,178,30,159,
+100,76,150,61,27,138,128,139,138,122,31,191,252,16,21,187,210,164,199,182,
+26,173,122,158,111,86,106,84,50,106,142,118,147,108,30,104,113,105,118,107,
+27,100,117,171,193,186,154,211,163,206,31,163,205,157,162,193,177,8,140,158,
+154,139,148,27,193,183,130,118,184,31,209,107,169,91,62,26,251,7,72,44,57,
+105,115,157,176,125,30,14,252,11,47,29,48,248,179,21,247,53,29,167,172,174,
+111,168,107,31,247,31,194,10,251,55,42,10,247,103,247,238,21,210,29,247,58,
+194,10,251,212,247,97,248,102,21,190,6,151,163,146,153,141,141,8,187,228,
+143,147,164,26,165,117,157,107,119,119,131,127,128,30,129,128,134,115,138,
+96,138,64,24,14,251,212,247,126,248,213,21,168,6,144,147,143,146,146,151,
+8,177,198,141,142,157,26,157,122,152,115,123,124,133,131,131,30,131,130,139,
+138,137,102,143,94,24,140,114,5,65,133,21,210,10,247,57,22,210,10,14,153,
+77,10,251,53,81,21,153,169,146,156,144,147,188,29,132,108,136,80,135,80,137,
+105,138,130,137,122,139,135,137,115,8,14,247,16,247,48,46,10,247,232,78,21,
+202,6,191,168,115,97,132,139,135,136,118,31,160,6,200,247,122,5,118,6,74,
+110,90,108,67,27,97,6,208,247,150,5,189,205,10,134,117,5,163,6,165,138,156,
+123,112,26,132,138,135,138,247,3,10,132,89,10,248,113,6,202,247,58,5,120,
+6,55,55,48,92,60,27,103,117,154,163,147,141,150,143,153,31,14,247,134,247,
+33,46,10,247,230,68,21,247,122,6,77,251,125,213,10,102,89,10,247,191,118,
+29,114,6,113,140,122,155,165,26,145,140,145,140,145,30,247,23,248,127,177,
+10,226,29,251,168,89,10,165,6,165,156,122,114,131,138,134,138,237,10,156,
+157,174,247,70,29,132,138,134,138,247,72,29,112,140,122,155,164,26,144,140,
+146,141,146,30,14,251,39,247,20,46,10,247,236,252,6,21,243,10,247,23,248,
+127,151,184,156,157,174,196,29,113,26,132,138,134,138,247,69,10,217,244,46,
+10,248,125,247,172,21,59,46,103,84,75,31,38,50,73,251,34,251,24,247,32,10,
+205,27,247,107,247,86,247,107,247,129,247,34,53,226,251,31,31,126,99,21,197,
+176,90,63,251,9,85,251,76,76,43,31,90,107,88,108,89,229,10,191,173,195,27,
+14,247,24,247,17,46,10,188,251,111,21,126,251,65,5,247,126,6,163,229,5,111,
+192,132,169,202,26,208,153,216,167,225,30,247,6,176,187,188,215,27,206,181,
+93,66,73,115,41,102,54,31,105,59,112,96,93,89,115,49,24,247,131,6,214,247,
+65,5,121,6,92,73,107,122,59,137,8,54,6,190,163,172,161,185,179,8,239,228,
+188,232,239,26,247,24,48,223,251,34,68,70,119,102,85,30,44,77,74,251,14,251,
+6,26,45,187,61,232,82,30,73,6,74,137,89,172,124,193,8,14,236,247,3,46,10,
+248,94,83,21,76,247,113,5,137,149,137,150,147,185,29,118,66,207,29,134,117,
+5,247,197,216,29,194,247,96,247,104,247,173,173,182,164,161,162,146,25,226,
+29,251,82,89,10,158,6,165,162,120,116,123,132,120,126,122,31,14,251,156,132,
+10,251,162,6,133,70,29,86,249,210,21,104,244,29,106,31,247,87,22,105,244,
+29,105,31,14,97,64,10,251,88,247,176,21,105,111,112,104,104,168,110,174,173,
+166,167,173,174,110,168,105,31,247,89,22,104,247,23,29,111,168,105,31,14,
+39,248,25,248,81,21,107,60,5,201,127,114,164,86,27,95,89,112,92,97,31,86,
+82,108,57,59,165,29,193,231,175,31,120,150,227,10,247,193,5,251,111,251,160,
+247,12,29,199,239,10,65,148,31,153,247,105,21,144,148,155,172,5,188,231,142,
+147,241,10,135,115,138,95,8,138,96,138,113,130,26,132,138,127,138,124,30,
+14,251,135,65,10,251,0,248,16,21,190,6,143,147,146,153,148,159,8,188,231,
+142,147,165,26,166,117,157,107,119,119,131,126,128,30,130,127,134,115,138,
+95,138,96,139,114,138,129,8,14,35,66,10,247,154,247,118,21,190,6,142,145,
+139,140,157,174,8,187,230,143,148,241,10,134,117,138,93,138,61,24,14,252,
+11,47,29,67,248,50,21,190,6,147,154,146,153,145,152,8,187,230,143,148,164,
+26,166,117,158,107,119,119,131,126,128,30,129,127,135,116,138,94,8,138,96,
+138,114,129,26,14,85,29,131,242,21,190,6,143,148,156,172,5,188,232,142,146,
+164,26,166,117,158,107,119,118,131,126,129,30,129,127,134,116,138,94,138,
+77,24,134,138,126,138,118,30,14,209,248,36,248,158,21,191,6,142,147,146,153,
+149,159,8,187,230,143,148,164,26,167,117,157,107,115,117,128,122,129,30,131,
+125,138,124,137,33,137,100,24,251,38,57,63,10,251,55,42,10,247,133,247,109,
+21,190,6,143,148,155,172,5,188,230,143,148,165,26,165,117,158,107,115,116,
+128,122,130,30,130,125,138,124,137,33,137,100,24,14,252,11,47,29,92,248,124,
+21,168,6,143,145,151,161,5,220,10,132,131,135,120,140,117,143,93,127,29,169,
+170,114,166,110,31,14,251,55,42,10,247,147,247,183,21,168,6,143,145,143,146,
+143,146,143,147,25,220,10,131,130,139,138,137,101,143,92,127,29,170,169,114,
+166,110,31,14,153,76,10,121,248,25,249,4,21,174,6,236,140,188,99,150,53,8,
+158,6,183,247,55,5,252,95,89,10,167,6,165,138,156,122,114,26,133,138,133,
+247,30,29,104,136,25,162,10,8,128,98,21,175,159,136,130,156,169,10,14,153,
+53,29,90,83,10,14,169,247,105,249,42,21,133,117,5,153,6,182,156,124,101,110,
+131,97,122,71,31,106,251,19,103,45,93,61,8,59,93,94,105,80,27,118,6,84,251,
+96,5,164,6,214,247,17,208,185,247,4,137,8,247,45,6,247,4,187,95,37,136,139,
+129,138,129,31,164,6,193,247,96,5,80,6,117,131,144,154,143,139,139,143,152,
+31,247,25,248,138,177,10,226,29,251,251,253,5,21,251,135,6,223,216,228,247,
+124,190,247,170,8,247,67,6,14,153,247,211,247,223,21,201,6,191,168,116,97,
+132,139,137,136,115,203,29,208,247,150,5,189,168,29,123,112,26,133,128,10,
+104,117,154,163,148,141,150,142,152,31,14,247,157,248,208,247,206,21,216,
+251,116,5,143,127,141,127,128,26,118,122,127,108,30,134,117,5,247,138,6,145,
+161,98,140,121,161,116,217,25,44,247,164,202,195,166,163,186,184,25,247,1,
+242,154,149,200,146,144,161,24,251,117,6,134,117,5,150,6,157,151,126,118,
+91,57,55,251,47,251,1,31,128,6,195,247,101,152,188,161,157,181,138,25,226,
+29,251,150,89,10,154,6,171,157,125,112,131,138,131,134,123,31,82,251,106,
+5,129,6,62,247,0,95,224,181,26,169,164,161,173,30,146,118,29,251,133,6,134,
+117,5,150,6,199,137,169,110,207,251,11,160,103,150,121,158,109,251,196,251,
+223,24,110,108,108,122,104,134,132,117,24,247,160,118,29,113,140,132,143,
+156,26,149,144,149,152,153,30,247,105,247,128,5,148,6,79,251,118,126,91,120,
+122,99,138,25,133,117,5,247,152,118,29,123,6,101,121,152,167,147,141,151,
+146,165,31,194,247,97,5,14,251,36,247,87,247,234,21,197,29,159,89,151,117,
+164,113,25,94,181,194,116,207,27,247,36,247,4,241,247,21,186,123,176,110,
+164,31,120,154,86,29,14,247,17,49,29,14,164,247,204,247,245,21,80,10,161,
+6,144,161,5,251,181,141,29,247,169,118,29,108,6,113,122,156,164,145,140,145,
+141,146,31,14,172,248,148,249,4,21,251,35,252,172,213,10,195,10,215,29,112,
+140,123,155,165,26,147,139,143,141,145,30,247,23,248,127,182,10,252,123,6,
+132,117,5,153,6,175,165,115,107,124,138,132,128,97,31,115,47,5,251,159,69,
+90,251,6,96,27,130,132,145,149,138,31,187,136,123,158,102,27,103,114,113,
+101,92,173,109,247,6,10,14,247,128,79,29,247,182,118,29,110,247,39,29,147,
+140,143,140,146,214,10,157,157,174,142,25,156,118,29,251,89,6,14,247,17,70,
+10,251,189,66,29,14,208,248,110,249,49,21,59,47,104,83,75,31,38,51,73,251,
+34,251,23,26,76,161,78,177,97,30,101,174,198,117,205,27,247,106,247,86,247,
+106,247,128,247,34,54,225,251,32,31,127,99,21,196,176,90,63,251,9,85,251,
+75,77,44,31,91,107,87,108,90,247,48,29,194,232,31,202,177,190,173,196,27,
+14,247,17,247,76,249,42,21,137,29,247,165,6,143,29,247,36,248,177,5,247,120,
+6,251,34,252,172,226,10,226,29,110,247,2,10,247,22,248,127,177,10,226,29,
+14,97,172,10,251,140,6,134,117,5,166,6,166,155,125,10,146,141,146,31,247,
+36,248,177,21,203,136,172,107,79,26,102,125,87,120,102,30,93,114,110,120,
+247,58,29,153,248,207,247,31,21,72,92,73,103,66,27,35,76,211,247,14,247,109,
+247,25,247,85,247,40,217,193,83,58,136,139,129,138,132,31,157,6,190,247,84,
+5,121,6,122,132,127,131,120,27,127,132,140,151,93,31,147,104,115,143,117,
+27,251,10,251,23,75,43,59,31,81,69,110,59,49,26,251,60,242,251,9,247,42,246,
+222,185,231,199,30,14,97,248,111,249,0,21,173,137,154,134,159,125,8,163,86,
+10,182,248,67,247,176,59,10,247,89,248,43,173,10,99,125,8,251,25,93,62,219,
+29,126,91,123,186,10,163,26,145,150,29,182,157,157,220,29,188,230,26,247,
+3,186,247,16,204,196,142,29,101,105,109,127,84,136,8,14,153,234,29,111,119,
+118,91,29,150,26,164,94,10,247,17,247,116,176,21,68,29,248,52,6,247,4,187,
+95,37,31,116,163,7,193,247,96,5,80,6,117,132,143,155,143,140,145,141,146,
+31,247,25,248,138,152,184,156,149,29,251,163,175,10,14,234,248,73,227,21,
+127,94,122,121,104,136,8,195,10,226,29,111,247,39,29,147,140,143,140,146,
+30,247,23,248,127,177,10,77,29,192,100,236,194,179,147,165,212,30,14,248,
+109,247,123,176,21,68,29,250,88,6,215,29,112,123,156,165,145,140,144,140,
+145,31,247,23,248,128,81,29,14,248,109,247,84,249,42,21,137,10,249,126,6,
+247,4,186,95,33,137,139,131,138,130,31,164,6,194,247,96,5,73,6,123,132,145,
+150,145,140,142,142,153,31,247,25,248,135,81,29,251,104,6,247,35,248,173,
+182,10,14,120,248,80,105,10,102,165,107,146,251,2,143,192,247,94,24,145,155,
+148,170,158,155,170,142,25,151,6,251,33,251,201,247,73,10,247,208,248,76,
+105,10,101,166,105,146,32,142,192,247,94,24,145,155,148,170,158,155,170,142,
+25,151,6,251,33,251,201,96,29,249,22,122,21,110,6,113,140,122,155,165,26,
+144,140,146,141,145,30,247,22,248,127,165,10,132,148,29,132,89,10,247,165,
+6,14,246,247,97,249,42,21,96,251,54,5,158,6,189,228,189,173,224,141,251,35,
+252,173,24,127,94,121,121,104,136,8,162,10,192,247,94,24,152,184,156,157,
+174,142,8,151,118,29,251,39,251,223,247,73,10,137,248,91,247,216,21,112,251,
+1,121,92,98,80,8,86,102,92,111,85,27,93,92,160,175,102,31,114,164,123,161,
+113,190,116,128,24,165,74,155,111,166,110,8,95,180,187,120,207,27,247,104,
+247,68,247,91,247,132,218,119,200,99,182,31,181,100,82,159,58,27,105,109,
+136,131,98,31,134,115,130,138,130,27,123,133,143,156,134,31,119,6,95,251,
+92,5,160,6,169,192,156,161,170,166,8,175,179,183,157,184,27,209,175,91,44,
+100,135,111,125,79,31,60,6,64,119,159,214,136,31,119,6,84,251,127,5,159,6,
+171,213,180,169,208,138,8,14,248,39,248,52,247,213,21,130,103,135,110,107,
+26,251,37,223,51,247,30,247,104,247,87,247,107,247,127,247,33,53,226,251,
+31,33,251,0,85,47,64,30,100,91,106,81,121,84,8,251,18,6,196,247,104,247,41,
+29,178,6,144,161,5,251,189,66,29,202,247,130,5,248,139,247,200,21,197,176,
+90,62,251,8,85,251,73,76,43,31,90,108,87,108,89,247,48,29,195,232,31,202,
+176,191,173,195,27,14,175,248,206,22,184,10,152,184,156,149,29,251,159,6,
+251,64,34,63,251,17,101,151,105,160,115,31,159,116,160,126,191,117,68,124,
+129,133,93,74,39,251,32,24,107,95,118,125,103,138,8,135,6,132,117,5,247,84,
+6,247,81,247,158,5,163,156,155,148,164,27,143,143,139,138,148,31,83,251,102,
+127,94,121,121,104,136,25,132,89,10,247,37,247,233,21,137,129,135,138,132,
+27,81,99,187,209,229,208,216,219,151,149,137,134,160,31,14,251,75,247,92,
+249,42,21,134,117,5,161,6,165,138,156,122,113,26,132,138,134,138,133,30,251,
+20,252,125,126,93,122,122,104,135,25,228,29,122,156,164,26,148,139,142,141,
+146,30,247,33,248,176,5,247,150,6,174,247,28,5,116,6,108,69,92,108,67,142,
+8,14,247,57,248,127,249,0,21,195,6,178,163,133,123,160,31,164,122,247,48,
+10,165,6,182,247,56,5,252,178,6,95,154,10,247,113,6,222,247,201,5,148,177,
+167,143,168,27,200,170,107,75,93,128,90,119,94,31,102,122,118,120,114,27,
+127,132,146,150,146,140,142,146,145,31,149,151,143,149,153,26,172,117,160,
+105,103,115,113,99,82,187,101,210,247,19,243,247,2,247,25,227,74,192,251,
+2,93,100,133,125,81,30,14,143,249,71,249,55,21,119,6,121,132,124,129,118,
+27,130,132,141,146,122,31,152,105,103,145,98,27,251,1,251,7,88,56,59,31,66,
+64,100,43,37,26,251,61,240,251,2,247,49,211,202,161,181,193,30,167,162,156,
+158,169,184,120,154,24,105,91,119,120,103,118,8,120,105,103,129,102,27,36,
+76,216,247,19,164,141,155,145,175,31,231,6,204,141,166,113,141,74,140,127,
+24,158,6,201,247,126,5,120,6,72,102,92,110,69,27,53,6,167,235,159,180,181,
+189,8,199,190,201,173,198,27,179,171,122,106,163,31,161,109,147,111,144,85,
+8,159,6,14,42,248,208,249,48,21,118,6,119,131,123,130,112,27,132,127,141,
+142,126,31,157,70,99,146,107,27,251,3,61,66,34,73,172,81,214,69,31,192,91,
+151,127,148,127,8,158,114,148,113,114,26,76,82,82,75,104,96,160,168,115,30,
+112,171,119,194,182,26,145,140,149,140,152,30,114,6,89,251,136,5,164,6,159,
+151,151,146,160,27,148,148,138,137,147,31,117,227,160,135,180,27,247,20,239,
+224,247,1,201,112,185,59,212,31,88,185,126,153,128,154,8,117,168,128,169,
+167,26,198,179,183,194,218,204,67,50,135,139,133,138,132,30,162,6,14,251,
+156,52,29,251,156,52,29,251,156,52,29,247,106,249,20,21,169,6,165,156,122,
+113,134,138,132,137,133,31,251,25,252,138,5,106,130,128,125,123,27,128,130,
+147,149,145,141,144,142,143,31,155,163,142,146,158,26,171,118,159,106,104,
+112,107,97,82,186,96,202,229,214,206,247,0,167,30,247,1,248,44,247,41,29,
+147,118,29,251,165,6,14,247,147,248,139,249,4,21,251,35,252,172,213,10,123,
+89,10,247,215,6,247,14,223,29,193,247,94,24,145,155,147,170,159,155,169,142,
+25,151,118,29,252,119,6,132,117,5,153,6,175,165,115,106,126,137,128,129,100,
+31,115,47,5,251,161,68,92,251,4,94,27,129,133,146,155,138,31,178,138,119,
+161,105,27,103,114,113,101,92,173,108,247,6,10,247,98,251,185,21,175,159,
+136,130,156,31,170,124,160,100,97,26,97,123,87,117,107,30,246,10,247,215,
+249,190,249,42,21,251,163,124,10,251,189,247,61,10,247,74,29,156,164,26,147,
+139,143,141,145,30,202,247,130,5,247,122,6,77,251,125,127,94,121,121,105,
+136,25,103,6,133,117,5,247,235,6,247,13,237,228,247,4,187,111,187,93,169,
+31,101,164,105,146,251,0,142,196,247,104,24,145,155,148,170,157,155,170,142,
+25,151,6,251,36,251,210,21,154,6,209,181,100,73,100,124,89,117,108,31,97,
+111,97,118,87,27,125,130,140,143,119,31,14,247,50,248,95,249,0,21,201,6,176,
+160,133,124,159,31,164,121,247,48,10,163,6,182,247,56,5,252,150,6,69,111,
+29,200,247,118,5,150,191,166,143,171,27,191,168,119,103,124,137,129,125,88,
+31,112,35,226,10,144,161,5,111,247,39,29,146,140,145,140,145,30,173,247,19,
+5,145,162,142,159,158,26,208,83,176,32,92,107,134,122,70,30,14,247,17,249,
+41,22,215,29,112,123,156,165,147,139,142,141,145,31,247,23,248,128,162,29,
+138,135,138,133,30,251,36,252,178,5,251,121,6,68,29,247,54,6,202,138,169,
+92,140,41,140,110,24,158,6,181,247,16,185,188,219,141,8,14,208,248,92,249,
+61,21,66,65,113,90,71,31,251,13,51,53,251,53,251,29,26,251,35,234,44,247,
+34,217,215,165,188,206,30,247,16,230,221,247,50,247,37,26,247,24,36,237,251,
+31,30,209,251,223,21,251,201,6,247,84,195,222,244,234,27,202,179,93,66,88,
+137,125,113,251,2,31,123,82,21,251,74,81,58,41,48,27,76,100,185,213,184,146,
+187,156,206,31,14,247,166,248,219,247,206,21,212,251,116,5,143,130,141,124,
+130,26,116,122,127,108,30,132,117,5,217,6,226,178,109,71,127,138,130,135,
+121,247,50,29,140,126,148,126,179,36,247,199,24,204,196,169,165,184,181,247,
+5,242,154,149,200,146,145,161,24,251,119,89,10,150,6,158,150,126,119,91,56,
+56,251,53,251,3,31,128,6,200,247,101,153,188,161,157,181,138,25,226,29,251,
+152,89,10,154,6,171,157,125,113,130,138,136,133,118,31,78,251,106,5,129,6,
+68,238,92,232,181,26,170,164,161,174,30,146,118,29,251,135,89,10,151,6,199,
+137,169,110,206,251,11,160,102,149,122,158,109,251,206,251,223,24,110,108,
+107,122,103,134,132,117,24,247,163,118,29,113,140,132,143,156,26,149,144,
+148,153,154,30,247,111,247,128,5,149,6,74,251,118,124,91,121,122,98,138,25,
+132,117,5,247,155,118,29,123,6,102,121,152,166,148,141,150,147,166,31,198,
+247,97,5,14,97,247,126,247,202,21,79,251,106,204,29,151,140,146,146,164,30,
+191,247,81,139,10,196,131,163,122,193,25,116,204,129,174,196,10,8,14,208,
+201,247,186,21,132,103,137,120,119,26,110,144,109,147,112,30,41,170,215,86,
+247,1,27,247,131,247,91,247,94,247,134,247,39,32,242,251,45,59,58,109,83,
+71,31,92,102,112,102,93,56,247,4,129,24,173,211,168,189,164,166,8,184,180,
+187,163,187,27,165,165,130,123,158,31,177,107,156,96,71,26,80,129,73,122,
+85,30,124,97,21,123,91,112,87,108,96,8,77,95,87,109,74,27,70,108,184,237,
+164,142,172,144,173,31,14,162,247,213,248,210,21,153,185,156,156,174,142,
+8,147,6,146,161,5,251,168,6,132,117,5,168,6,165,156,122,114,134,138,132,137,
+132,31,251,33,252,127,126,94,120,121,104,136,25,127,6,133,247,24,10,122,155,
+163,26,145,140,146,141,146,30,207,247,129,5,160,189,173,147,179,27,188,166,
+120,103,122,137,131,125,88,31,101,251,22,247,38,10,127,6,132,247,24,10,123,
+155,163,26,148,140,143,140,146,30,183,247,45,5,147,165,142,156,156,26,207,
+86,177,43,83,94,130,114,69,30,14,247,154,248,9,249,42,21,251,86,89,10,150,
+6,170,138,157,124,153,103,251,12,252,85,24,85,125,111,104,111,27,128,134,
+147,157,174,122,157,105,103,116,114,100,93,174,107,191,213,184,187,247,1,
+168,31,247,2,248,45,247,97,252,189,5,160,6,247,31,248,159,5,194,154,164,173,
+165,27,150,144,133,123,141,31,105,143,155,123,172,27,173,160,161,174,186,
+105,170,87,66,96,93,251,3,110,31,65,251,172,5,152,251,130,21,247,151,6,158,
+208,5,251,151,6,247,105,248,29,21,47,63,58,41,59,187,86,210,237,218,220,238,
+220,90,190,60,31,146,107,21,163,151,119,98,92,126,80,121,105,31,107,122,120,
+125,116,27,115,126,160,176,185,152,198,158,175,31,171,156,158,155,162,27,
+14,153,247,34,248,2,21,51,6,130,108,5,227,6,73,251,131,123,86,127,128,87,
+132,25,114,247,187,164,7,82,143,125,148,170,26,150,142,154,147,165,30,141,
+145,140,145,140,141,193,247,91,24,246,137,169,120,71,26,125,138,128,136,121,
+30,167,134,213,247,162,111,143,93,46,117,128,251,22,138,25,200,247,112,236,
+10,117,145,113,83,26,166,134,182,247,80,5,252,169,114,6,174,134,160,134,247,
+40,10,129,26,124,135,116,133,117,30,14,97,247,250,247,124,21,159,212,139,
+10,199,129,169,124,184,25,116,203,129,175,196,10,227,251,157,24,117,61,5,
+47,6,127,97,5,231,6,113,45,204,29,152,140,145,146,164,30,159,213,5,239,6,
+150,181,5,14,153,247,210,247,223,21,202,6,191,168,116,97,132,139,137,136,
+115,109,29,123,112,26,133,110,10,229,249,126,21,110,29,247,102,22,110,29,
+14,247,17,247,153,50,29,251,65,247,181,21,103,174,29,31,140,135,139,134,137,
+26,115,111,122,101,108,113,152,154,143,140,143,143,148,30,145,153,141,146,
+146,26,160,119,155,112,30,14,90,83,10,248,30,249,95,21,247,41,225,5,170,156,
+147,150,158,26,164,117,160,113,121,247,26,10,251,156,247,182,161,21,111,247,
+39,29,148,139,142,141,146,30,247,23,248,127,247,76,10,75,249,233,21,110,29,
+247,101,22,110,29,14,164,247,204,56,29,113,122,156,165,147,139,143,141,145,
+31,247,146,249,12,21,247,42,225,5,168,156,148,150,158,26,164,117,160,113,
+122,247,26,10,182,248,210,249,176,21,115,111,122,101,109,113,152,154,143,
+140,141,143,150,30,144,151,141,148,146,26,160,119,155,112,104,174,29,30,251,
+35,252,159,59,10,153,249,2,164,21,73,144,135,143,126,215,40,248,202,24,115,
+6,252,1,252,218,107,90,124,127,104,131,25,114,247,86,164,7,93,120,149,164,
+152,143,153,150,157,31,197,240,5,247,105,6,149,65,144,98,131,26,97,125,128,
+75,134,30,114,247,193,7,252,65,247,138,21,247,37,247,132,178,251,132,5,247,
+86,249,20,21,73,107,106,116,74,27,75,106,168,199,134,31,97,6,251,5,138,180,
+92,235,27,235,202,196,242,156,31,14,153,55,29,141,250,10,21,73,108,105,116,
+74,27,76,107,168,199,211,10,171,247,249,248,27,21,105,108,200,247,107,152,
+183,166,29,133,31,251,33,252,128,144,10,217,247,162,152,94,83,251,95,5,189,
+6,171,247,9,177,251,20,205,29,247,150,247,43,10,33,247,221,247,61,247,44,
+195,184,180,158,208,29,122,118,122,111,112,114,31,50,58,173,247,14,5,89,6,
+14,171,247,213,247,245,21,216,251,151,205,29,222,6,226,178,109,71,128,138,
+130,135,120,247,50,29,126,149,178,126,31,251,0,247,224,247,61,247,45,195,
+183,180,159,208,29,121,119,122,111,112,114,31,251,83,251,67,200,247,107,152,
+184,166,29,132,31,251,33,252,127,144,10,14,247,25,247,198,247,213,21,247,
+124,6,72,251,125,247,38,10,102,89,10,247,16,6,226,177,109,72,126,138,131,
+135,120,31,169,6,187,247,67,5,113,6,105,117,152,159,140,31,143,140,143,140,
+143,247,15,29,152,118,29,251,171,89,10,165,6,165,156,122,115,131,138,134,
+137,132,31,77,251,109,5,251,124,6,200,247,104,152,184,157,157,174,142,25,
+178,118,29,251,192,171,29,121,121,104,136,25,131,89,10,247,168,118,29,111,
+247,2,10,14,160,247,225,247,155,21,192,251,52,5,143,129,140,130,127,26,110,
+118,118,111,30,126,89,10,234,6,225,179,108,72,128,138,130,135,119,31,168,
+6,188,247,68,5,113,6,101,126,149,178,126,31,47,247,177,247,14,247,23,234,
+242,178,170,171,142,25,226,29,251,86,89,10,149,6,161,153,126,117,119,131,
+124,113,111,31,251,12,251,22,96,247,30,5,129,167,138,146,149,26,165,155,158,
+160,30,152,118,29,251,158,89,10,152,6,174,134,162,113,154,87,222,251,146,
+24,251,55,251,67,82,76,95,105,102,130,25,133,117,5,247,99,118,29,126,6,107,
+121,151,162,154,150,158,162,165,31,14,242,248,50,247,161,21,168,145,156,144,
+181,154,79,251,99,24,126,94,121,121,104,136,8,228,29,123,155,164,26,147,140,
+143,140,146,30,247,33,248,128,153,183,157,149,29,251,165,6,132,117,5,161,
+6,165,156,122,115,132,138,133,137,133,31,71,251,130,106,125,113,131,111,134,
+25,203,247,123,5,76,6,74,251,123,5,105,147,124,155,168,26,156,141,146,154,
+192,30,176,247,22,152,183,157,157,174,142,25,152,118,29,251,166,89,10,161,
+6,165,156,123,114,134,138,131,137,133,31,95,251,45,5,131,110,136,124,122,
+26,71,192,101,236,30,157,6,98,251,38,5,202,6,14,234,249,157,249,20,21,72,
+29,84,251,98,127,94,122,121,104,136,25,131,89,10,230,6,222,179,107,73,128,
+138,130,135,119,31,169,6,182,247,54,5,113,6,108,117,151,156,144,140,144,140,
+145,31,247,28,248,141,151,184,157,157,174,142,25,14,153,55,29,87,249,95,160,
+10,247,17,49,29,93,247,31,21,251,3,247,38,5,160,123,119,151,120,27,115,118,
+118,116,247,27,29,247,25,51,5,14,120,248,1,248,220,21,151,178,154,152,173,
+143,8,151,118,29,247,11,29,135,139,136,138,134,31,251,43,6,99,251,62,5,163,
+6,175,231,150,147,241,143,251,6,252,67,24,127,95,121,120,104,137,124,138,
+24,133,117,5,247,252,6,247,14,236,229,247,4,190,112,189,94,171,31,99,168,
+99,146,251,28,140,178,247,39,24,188,6,238,157,127,75,131,139,131,138,127,
+31,163,6,171,247,61,5,251,163,251,144,21,175,6,176,159,136,130,156,31,170,
+124,160,100,96,26,33,71,56,53,134,126,140,140,126,30,131,140,116,140,115,
+140,8,14,208,248,112,249,58,21,67,66,113,90,71,31,251,10,52,55,251,51,251,
+29,26,251,34,233,43,247,33,217,215,165,188,204,30,247,14,229,219,247,48,247,
+36,26,247,25,37,237,251,31,30,210,251,222,21,129,106,121,135,117,27,118,121,
+146,154,121,31,103,171,139,139,134,142,8,152,121,120,145,116,27,121,119,135,
+132,118,31,247,53,194,212,223,225,27,202,179,92,67,92,131,86,120,62,31,120,
+76,21,251,74,77,68,52,50,27,76,100,185,213,190,149,202,159,211,31,141,150,
+149,140,149,27,169,151,133,111,171,31,114,166,159,130,170,27,169,172,147,
+159,187,31,14,247,15,248,101,247,106,21,75,247,208,5,133,171,136,155,146,
+26,173,156,153,183,141,30,143,140,154,140,153,140,144,163,24,251,221,6,134,
+115,186,131,147,132,152,85,25,247,18,252,223,5,165,6,247,162,248,108,5,244,
+199,163,171,157,27,148,144,135,130,142,31,109,148,155,125,165,27,182,168,
+177,193,168,114,156,97,105,101,124,117,113,31,104,107,93,76,102,70,8,14,251,
+36,247,95,127,21,138,144,142,139,140,27,247,31,247,4,243,247,19,186,123,176,
+110,163,31,120,155,86,29,131,102,5,197,29,172,46,199,85,223,124,25,82,56,
+202,29,122,143,152,111,166,10,227,247,249,249,5,21,251,35,252,173,127,94,
+121,121,104,136,25,130,89,10,247,169,118,29,108,6,113,122,156,164,145,140,
+145,141,146,31,211,247,162,80,10,151,118,29,251,251,6,96,251,54,5,158,6,180,
+214,183,176,201,149,167,141,24,14,153,247,193,121,21,247,6,234,191,236,205,
+31,109,161,89,80,111,116,97,121,25,126,10,190,247,126,5,103,29,251,31,221,
+46,247,37,115,31,87,62,152,127,5,142,150,147,132,29,129,133,138,137,130,31,
+14,234,248,70,215,21,131,97,125,128,88,136,8,113,6,101,251,47,5,168,6,162,
+217,195,188,211,147,8,247,61,6,144,159,5,107,6,104,120,152,163,147,142,154,
+143,155,31,247,20,248,114,177,10,72,29,14,248,87,248,80,21,251,9,6,124,85,
+5,185,132,122,158,104,27,97,95,111,85,95,31,80,67,104,43,47,26,69,174,86,
+186,185,172,173,243,193,30,132,108,137,122,116,26,93,159,118,185,168,170,
+151,160,162,30,159,157,153,160,163,184,121,151,24,93,115,121,120,120,27,131,
+133,146,148,148,141,149,147,169,31,48,247,196,21,156,152,118,110,86,123,82,
+106,68,31,57,101,117,109,116,27,121,129,157,170,181,168,244,168,202,31,197,
+166,161,165,162,27,14,251,46,247,59,248,12,21,190,247,13,164,162,222,144,
+247,26,142,182,170,173,247,12,8,113,6,126,108,129,134,91,138,103,140,109,
+137,118,135,71,128,81,88,83,41,8,85,43,96,251,41,43,26,54,195,78,219,184,
+186,159,177,187,30,214,199,185,236,235,26,229,86,203,64,76,86,113,79,76,30,
+247,51,191,127,10,251,98,247,177,247,130,21,188,156,155,146,157,151,8,179,
+165,161,173,176,26,192,98,170,69,251,41,251,18,251,32,251,58,42,201,77,236,
+238,222,212,226,196,104,170,74,30,32,22,247,21,180,173,192,183,27,160,153,
+123,114,111,124,110,111,114,31,113,115,113,126,80,117,8,130,106,21,150,167,
+152,142,155,27,167,153,122,105,57,107,75,98,112,123,162,177,168,143,167,152,
+204,31,14,251,176,245,79,10,14,251,49,247,62,249,19,21,148,167,158,143,161,
+27,222,189,68,251,10,123,138,127,137,113,31,172,124,120,152,104,27,251,16,
+251,6,251,32,251,43,251,1,189,74,223,196,195,166,184,180,31,212,222,182,247,
+18,247,23,26,247,67,64,243,251,19,111,116,136,130,104,30,247,17,251,140,21,
+165,154,120,104,78,112,251,8,106,57,31,81,115,115,114,106,27,113,124,161,
+176,188,157,221,171,235,31,216,165,166,172,177,27,14,251,101,73,29,14,247,
+191,248,109,22,163,229,186,224,224,244,8,105,74,128,103,92,26,53,181,83,203,
+200,185,173,226,196,30,123,150,5,89,99,114,120,112,27,104,116,178,200,247,
+15,203,247,39,193,152,149,132,129,132,136,136,123,128,31,126,131,134,129,
+125,26,112,158,121,166,173,163,166,177,185,101,175,89,69,50,57,251,64,251,
+8,30,203,247,135,5,38,6,117,54,94,58,55,35,8,169,205,148,170,182,26,223,95,
+196,76,79,94,105,53,82,30,154,128,5,185,172,169,162,167,27,175,162,100,79,
+251,10,76,251,46,90,247,43,29,153,149,144,149,156,26,165,120,158,113,106,
+114,110,102,93,177,103,188,213,235,228,247,61,246,30,73,251,140,5,14,251,
+155,247,30,247,119,21,178,29,5,59,174,186,106,217,27,234,208,203,226,199,
+109,170,71,150,31,88,29,14,42,60,29,14,251,38,58,29,14,251,32,248,88,248,
+80,21,70,6,251,18,140,70,50,82,251,131,8,98,131,133,128,115,29,67,251,167,
+5,134,118,137,126,125,26,104,166,113,178,188,180,173,217,184,30,122,150,5,
+102,119,122,122,123,27,131,135,143,147,144,141,147,142,154,31,14,171,248,
+135,247,237,21,75,251,140,5,133,118,137,125,127,26,104,166,114,177,189,180,
+172,217,185,30,121,150,5,102,119,121,121,124,27,131,135,143,148,143,141,147,
+142,154,31,231,247,239,5,251,20,6,251,57,251,158,105,247,172,251,87,110,133,
+117,5,146,6,165,153,126,114,131,138,130,137,132,31,84,251,99,125,85,5,127,
+135,133,133,131,27,134,136,142,149,135,31,157,131,127,147,119,27,108,118,
+118,106,102,164,115,178,194,163,171,247,8,169,31,204,247,138,186,252,29,5,
+163,6,14,41,247,133,247,148,21,192,247,94,151,29,198,247,115,5,246,6,106,
+251,18,5,136,128,137,121,125,26,99,163,115,179,188,183,175,214,182,30,121,
+149,5,99,115,125,125,125,27,132,133,144,147,141,139,140,144,163,31,230,247,
+239,5,251,9,6,89,251,80,5,14,247,216,248,91,21,251,31,251,22,251,43,251,54,
+48,193,78,220,177,177,152,166,180,31,228,199,195,242,246,26,229,85,204,65,
+30,119,105,127,10,42,247,59,22,186,247,71,148,175,168,197,177,197,25,162,
+154,155,152,152,27,149,145,132,128,126,139,139,130,104,31,90,251,81,5,129,
+100,139,138,124,26,100,165,111,174,165,170,151,158,161,30,161,158,152,158,
+164,187,118,152,24,92,114,130,128,125,27,132,135,143,147,145,140,147,142,
+148,31,198,247,120,5,145,163,142,155,155,26,184,113,168,99,83,84,83,251,4,
+84,30,183,247,63,251,73,181,10,247,51,138,21,132,160,148,137,154,27,193,201,
+171,194,187,31,194,200,172,230,228,26,223,103,192,83,113,122,131,109,102,
+30,134,134,131,133,132,133,151,183,24,114,6,251,51,109,133,118,5,171,152,
+128,109,130,138,131,134,121,31,34,252,37,5,95,126,117,115,108,27,129,6,134,
+120,5,247,141,6,143,158,5,135,6,113,114,163,165,150,140,148,142,149,31,246,
+248,45,21,167,152,156,152,163,27,165,156,111,94,80,121,59,112,79,31,77,111,
+110,109,106,27,123,130,146,160,125,31,14,251,101,247,249,247,13,21,92,107,
+105,117,97,27,79,107,179,213,202,168,228,177,195,31,172,161,176,160,171,27,
+158,155,130,129,135,136,134,134,135,31,111,118,133,129,117,26,112,159,117,
+164,172,169,175,178,189,97,175,83,251,20,251,36,251,59,251,39,50,196,77,221,
+210,202,177,218,196,30,14,247,17,247,46,22,180,247,46,146,167,180,228,157,
+166,25,182,168,170,166,159,27,149,146,131,127,130,136,123,135,125,31,53,251,
+201,5,247,11,6,171,247,14,5,247,30,175,208,247,3,189,27,147,147,131,130,132,
+139,137,133,113,31,77,251,127,5,136,126,137,126,129,26,106,166,114,175,186,
+179,170,214,187,30,124,151,5,101,115,123,123,126,27,131,135,144,149,145,139,
+139,143,155,31,199,247,120,5,145,161,142,163,158,26,181,113,168,101,78,77,
+79,251,13,77,30,149,183,145,180,171,26,176,116,166,108,95,93,109,84,99,30,
+116,108,128,121,109,86,189,247,82,24,251,74,181,10,251,101,64,29,14,202,248,
+173,249,59,21,251,76,110,133,117,5,145,6,165,154,126,115,132,138,130,136,
+131,31,99,251,46,5,170,116,117,150,105,27,251,5,251,9,251,41,251,36,93,150,
+94,158,108,31,105,161,167,123,179,27,175,166,148,159,162,31,143,6,114,45,
+5,72,120,121,123,87,27,130,6,133,118,5,247,161,6,145,160,5,93,123,149,168,
+152,140,142,146,167,31,165,239,5,114,164,162,129,172,27,247,7,247,6,247,37,
+247,38,244,91,208,65,106,115,130,116,112,31,136,6,251,70,121,21,166,154,119,
+106,100,110,251,14,114,71,31,77,116,115,112,107,27,111,121,159,172,185,165,
+247,8,165,206,31,203,163,163,164,176,27,247,121,22,168,155,119,103,87,114,
+251,2,112,73,31,75,112,117,116,104,27,112,123,159,172,180,166,247,7,166,211,
+31,203,163,162,165,172,27,14,248,52,247,10,21,108,122,119,119,124,27,127,
+126,149,154,131,31,129,160,133,159,112,240,131,168,24,170,199,139,139,148,
+154,8,157,150,151,147,156,27,144,145,138,138,143,31,130,168,139,139,150,27,
+167,161,163,168,169,113,162,105,105,104,112,94,115,31,95,56,129,184,134,156,
+107,234,25,251,47,107,133,117,5,141,148,148,140,145,27,166,162,111,89,151,
+31,175,251,38,97,65,5,118,127,126,128,126,27,133,133,140,142,134,31,153,114,
+136,140,126,27,108,117,116,107,106,160,118,174,173,183,171,184,165,31,184,
+217,5,251,16,169,160,108,197,27,187,177,172,221,185,31,14,42,248,104,75,29,
+185,171,165,241,217,135,10,169,162,149,164,170,30,121,106,133,123,211,29,
+111,130,30,150,115,171,247,14,29,153,135,150,126,160,30,126,158,135,149,147,
+26,155,144,151,173,205,30,14,247,72,247,212,248,94,21,232,10,118,132,138,
+131,136,129,31,86,251,96,5,128,96,136,125,119,26,93,166,107,177,191,184,180,
+244,203,30,126,98,135,118,121,26,99,165,113,179,195,187,181,243,200,30,125,
+89,136,122,121,26,103,167,114,178,167,155,146,170,177,30,113,93,137,133,116,
+26,130,141,131,144,126,30,144,127,140,135,131,26,112,126,122,112,130,30,150,
+115,171,154,152,148,156,156,25,163,163,152,168,164,26,153,133,154,129,156,
+30,125,160,136,146,150,26,157,148,160,162,175,30,122,150,5,102,119,121,120,
+125,27,130,135,144,149,145,140,143,143,154,31,230,247,240,5,251,11,6,107,
+251,13,120,68,93,42,97,82,247,47,10,149,143,139,139,149,180,31,220,247,200,
+5,251,10,6,106,251,13,5,34,112,57,251,36,106,27,131,135,145,150,148,141,152,
+146,162,31,14,251,18,248,10,248,89,21,126,120,129,135,122,27,121,118,143,
+152,95,31,148,107,129,141,121,27,105,110,128,116,113,31,127,129,137,137,111,
+110,157,120,24,163,157,153,147,159,27,147,150,137,135,148,31,127,173,143,
+138,153,27,156,147,141,154,181,31,144,141,151,143,153,144,65,90,107,111,110,
+101,8,103,91,116,77,89,26,100,154,97,164,111,30,115,161,173,126,178,27,247,
+7,230,220,242,212,100,185,78,115,119,134,125,102,31,160,199,183,201,192,181,
+8,251,23,251,89,21,147,160,148,141,149,27,167,158,112,98,54,94,61,91,116,
+126,159,172,178,151,188,169,219,31,14,180,247,184,248,94,21,251,74,114,132,
+116,5,150,6,160,152,125,118,132,138,133,135,127,31,85,251,76,5,134,124,135,
+109,123,26,71,192,92,217,247,8,233,226,246,208,103,181,79,114,132,137,121,
+85,30,129,107,21,145,160,150,142,148,27,164,155,119,106,101,125,88,119,104,
+31,104,119,118,121,116,27,120,124,156,160,149,141,149,145,161,31,247,253,
+247,234,21,49,251,237,5,134,120,137,124,125,26,104,166,113,178,188,180,172,
+218,184,30,121,150,5,103,120,122,121,123,27,131,135,143,147,145,141,148,142,
+152,31,230,247,237,5,14,251,88,247,165,248,94,21,241,29,135,136,127,31,91,
+251,76,5,135,125,136,112,123,26,69,195,90,218,247,6,229,222,244,212,100,183,
+75,115,133,137,121,86,30,130,107,247,47,29,103,53,235,10,251,130,137,232,
+21,159,104,150,124,156,124,8,114,166,175,126,177,27,247,24,247,5,247,24,247,
+48,194,125,188,113,170,31,166,117,100,154,90,27,37,67,94,76,111,158,120,166,
+164,159,158,161,148,136,148,132,147,31,127,154,138,140,146,26,157,177,155,
+182,188,161,118,94,113,134,110,128,89,30,251,26,6,130,107,5,247,27,6,251,
+38,105,105,85,80,27,91,100,168,195,111,31,14,216,247,64,22,198,247,115,5,
+213,6,131,107,136,118,113,26,45,192,79,223,175,178,152,166,179,30,228,198,
+195,243,244,26,232,86,203,64,37,40,60,251,12,93,30,62,6,192,247,94,241,29,
+132,136,130,31,48,251,242,5,248,124,248,57,21,165,155,118,104,75,108,251,
+21,105,58,31,92,119,114,244,10,193,159,170,169,174,27,14,251,30,248,79,247,
+6,21,97,114,127,127,126,27,130,134,144,148,144,140,142,141,150,31,140,143,
+5,140,141,139,141,140,26,229,247,234,5,251,91,6,40,76,89,61,110,149,113,157,
+121,31,155,124,156,132,179,128,63,131,110,115,100,53,8,97,120,128,127,122,
+27,125,128,151,160,132,31,118,130,5,84,163,160,122,184,27,203,181,175,217,
+167,31,167,226,158,159,194,138,110,251,0,24,135,122,136,120,126,26,102,167,
+113,177,189,180,173,217,183,30,251,49,247,31,21,137,129,135,139,133,27,102,
+116,166,184,200,179,179,201,146,144,139,137,149,31,14,251,176,247,147,248,
+46,21,247,61,6,167,237,5,120,6,115,93,111,123,81,138,8,251,121,6,133,119,
+5,153,6,157,151,129,124,136,138,135,138,136,31,46,251,223,132,112,127,129,
+116,137,25,134,6,133,119,5,247,104,6,145,159,5,120,6,121,126,150,154,140,
+31,142,140,142,140,143,30,14,251,22,247,241,124,29,154,194,185,231,178,188,
+25,155,152,156,150,149,27,149,145,129,125,85,90,251,114,100,251,12,31,68,
+116,123,112,120,27,132,136,141,144,142,140,141,142,145,31,143,146,141,143,
+145,26,162,120,158,115,112,120,120,111,103,169,115,185,200,192,180,223,187,
+30,201,247,3,198,247,97,247,0,26,195,117,171,99,104,104,120,102,104,30,117,
+116,126,119,99,72,198,247,114,247,25,29,251,130,247,58,247,145,21,247,5,173,
+186,195,199,27,158,154,130,129,135,136,134,134,136,31,112,118,133,129,117,
+26,113,159,117,164,171,168,174,177,194,98,176,76,77,86,113,85,90,30,80,73,
+102,48,61,26,50,195,78,220,210,203,179,217,194,30,118,150,5,93,107,106,117,
+98,27,80,108,179,214,157,140,153,144,162,31,247,36,6,147,171,5,14,251,156,
+247,253,248,92,21,110,6,121,128,136,137,125,27,128,131,141,146,122,31,148,
+114,126,142,119,27,59,87,90,65,85,154,109,204,62,31,177,95,157,105,114,26,
+110,114,115,108,117,117,150,159,123,30,120,164,131,161,131,192,112,142,24,
+118,251,56,5,166,6,151,143,150,147,152,27,146,150,136,134,152,31,131,163,
+157,135,160,27,222,201,195,213,184,114,188,83,203,31,100,183,122,169,162,
+26,171,159,159,171,184,166,103,58,155,30,166,137,5,14,252,11,247,123,247,
+11,21,94,107,119,120,126,27,132,134,145,146,143,139,139,144,155,31,243,247,
+249,251,80,112,133,115,5,141,146,146,140,143,27,156,154,125,125,131,135,116,
+135,126,31,77,251,99,5,133,120,136,120,123,26,93,166,112,182,166,160,149,
+169,172,30,162,159,151,155,162,177,8,119,248,208,21,101,108,108,100,99,170,
+106,179,177,169,170,178,178,107,173,101,31,14,252,11,247,156,248,81,21,251,
+79,105,134,116,5,154,149,138,138,142,31,154,134,149,126,123,26,130,137,126,
+135,123,30,66,251,197,5,251,7,111,118,92,115,27,133,132,145,143,143,141,144,
+144,144,31,146,148,142,145,146,26,157,121,154,117,112,119,119,113,110,170,
+117,181,179,189,161,169,169,30,177,178,169,203,160,224,8,182,248,240,21,102,
+110,110,101,100,169,108,177,175,168,169,176,177,108,171,103,31,14,145,248,
+73,248,80,21,70,6,251,14,140,66,44,81,251,125,8,89,127,138,137,115,29,85,
+251,103,5,135,121,136,119,122,26,68,193,92,220,247,6,229,221,242,211,100,
+184,77,119,127,137,128,106,30,135,138,132,136,130,137,8,131,106,21,146,161,
+148,141,149,27,166,154,118,103,54,92,52,93,119,124,156,164,149,139,139,147,
+167,31,14,199,247,133,247,160,21,188,247,82,151,29,201,247,128,245,142,120,
+66,5,136,127,135,108,124,26,70,195,90,218,247,2,231,221,237,210,99,180,71,
+120,128,138,133,93,30,183,247,61,5,251,9,6,94,251,64,5,247,1,110,21,143,161,
+147,140,147,27,168,155,118,100,57,93,55,94,119,124,156,163,148,141,152,144,
+156,31,14,42,247,239,124,29,155,198,183,226,178,188,25,156,153,156,150,151,
+27,148,144,133,129,133,139,139,133,116,31,81,251,117,5,134,118,137,127,126,
+26,104,167,114,178,188,182,174,214,181,30,121,149,5,98,114,127,127,124,27,
+131,134,144,147,144,140,145,142,146,31,140,142,140,143,140,26,201,247,126,
+5,144,160,142,160,156,26,181,117,163,100,104,105,121,102,104,30,117,115,125,
+120,99,70,198,247,115,247,25,29,42,248,106,75,29,165,157,147,162,169,30,123,
+111,133,122,211,29,112,130,30,150,115,5,201,169,176,183,184,26,153,135,149,
+126,161,30,129,157,133,153,150,26,158,147,152,185,195,135,10,196,191,184,
+222,178,30,14,145,10,251,30,251,99,21,247,7,170,185,202,191,27,168,157,117,
+103,105,134,105,128,87,31,128,96,21,251,23,103,96,74,88,27,109,120,162,178,
+176,146,185,151,190,31,14,251,20,247,171,248,94,21,102,29,188,179,171,217,
+185,30,121,149,5,104,120,121,120,124,27,130,136,143,149,146,139,140,144,157,
+247,33,10,54,116,81,62,247,20,10,14,247,72,249,103,247,5,21,103,119,122,121,
+124,27,130,136,143,148,145,140,145,143,153,31,230,247,238,5,251,10,6,107,
+251,14,120,69,93,42,98,84,247,47,10,148,144,141,149,142,148,31,140,142,141,
+146,141,149,220,247,200,24,251,9,6,106,251,14,121,70,94,45,94,80,25,124,128,
+127,130,129,27,131,135,145,150,147,139,141,148,172,31,223,247,214,251,74,
+113,133,116,5,140,144,143,139,141,27,160,153,124,117,132,138,131,137,130,
+31,85,251,95,5,129,99,136,122,119,26,92,166,107,178,189,182,179,245,204,30,
+127,97,135,121,119,26,99,165,113,179,194,181,177,247,0,205,30,125,90,136,
+122,120,26,104,166,113,177,189,179,172,218,185,30,14,247,147,248,80,22,164,
+230,190,227,226,243,8,103,74,127,99,91,26,107,146,106,153,113,30,153,112,
+153,131,187,134,167,136,146,136,150,124,8,155,119,147,111,107,26,127,138,
+130,135,120,30,169,6,187,247,72,5,113,6,113,106,147,149,124,31,117,154,126,
+173,184,26,247,15,208,247,46,195,151,149,132,129,132,136,136,122,128,30,127,
+131,133,129,124,26,113,158,121,165,174,164,167,178,184,101,174,90,68,48,57,
+251,66,251,13,30,208,247,133,5,37,6,101,34,108,86,51,251,2,8,172,207,148,
+171,184,26,221,96,195,76,79,92,105,53,80,30,155,127,5,186,173,169,161,169,
+27,173,162,101,83,251,10,71,251,53,88,247,43,29,155,150,144,148,156,26,166,
+121,157,112,105,113,109,101,94,177,103,187,215,236,228,247,63,247,4,30,68,
+251,142,5,14,251,97,247,129,247,48,21,127,247,57,153,10,85,251,83,127,97,
+127,129,94,183,10,148,30,197,247,99,142,10,14,251,97,197,247,110,21,129,101,
+136,119,114,26,53,187,80,209,247,28,247,28,247,62,247,62,218,85,192,59,62,
+63,91,54,79,30,160,127,5,189,177,172,159,182,27,188,167,102,73,118,137,125,
+131,108,31,131,102,21,39,111,100,85,96,27,119,126,155,163,164,140,143,161,
+224,31,14,42,248,112,247,34,21,76,95,121,119,57,29,251,172,247,195,247,150,
+21,181,165,158,169,180,26,199,99,176,74,81,106,122,74,68,30,155,122,5,172,
+175,170,154,172,27,173,159,118,103,99,123,116,97,116,31,251,65,6,127,96,5,
+235,6,60,103,116,114,90,26,70,190,93,216,204,183,163,211,206,30,122,158,5,
+97,97,105,120,101,27,104,116,166,181,184,159,163,204,172,31,247,36,6,151,
+182,5,14,251,97,247,111,144,21,166,234,142,10,44,251,57,127,247,58,153,10,
+116,57,5,62,6,125,89,5,216,6,122,79,126,98,129,129,93,183,10,147,30,156,202,
+5,221,6,153,189,5,14,251,101,73,29,171,248,84,121,10,42,248,45,248,246,21,
+140,135,139,136,136,26,119,112,124,104,111,118,150,154,142,141,145,140,143,
+30,147,154,139,139,147,26,159,123,152,115,108,116,115,108,94,185,113,218,
+230,199,173,191,164,124,154,115,114,120,121,116,30,230,251,67,61,10,14,251,
+152,247,10,79,10,247,45,247,38,21,247,42,227,5,168,156,148,150,158,26,164,
+117,161,114,121,123,128,100,103,30,251,12,251,24,5,14,252,11,247,124,247,
+12,21,96,108,118,118,125,27,132,134,145,146,143,140,144,142,150,31,247,0,
+248,5,251,84,105,133,116,5,140,146,145,140,144,27,156,155,125,125,131,135,
+118,134,124,31,76,251,103,5,133,120,136,121,121,26,92,166,111,183,166,161,
+150,169,172,30,162,159,152,155,162,178,8,251,46,248,190,121,10,251,38,58,
+29,247,20,247,167,21,247,42,227,5,170,156,147,150,158,26,164,117,161,114,
+120,123,127,101,104,30,251,12,251,24,5,14,251,101,64,29,87,248,210,21,108,
+116,115,108,94,185,113,218,231,199,173,192,163,124,154,114,114,120,121,116,
+137,139,136,140,135,31,140,135,139,135,137,26,119,112,124,104,110,118,150,
+154,143,140,144,141,143,30,147,155,139,139,146,26,158,123,153,115,30,14,251,
+46,248,99,247,18,21,84,99,124,124,124,27,131,135,144,149,165,148,182,162,
+217,31,208,247,125,251,2,132,122,81,5,189,130,117,160,96,27,251,13,251,39,
+251,81,251,47,64,182,88,203,200,184,175,234,195,31,129,100,136,126,125,26,
+102,168,110,176,186,185,178,225,195,30,251,81,247,196,21,161,137,154,121,
+112,26,80,107,251,2,101,71,30,91,113,110,113,111,27,114,120,162,170,191,170,
+237,180,212,31,168,191,172,170,165,137,8,247,22,247,140,21,74,108,104,115,
+75,27,75,107,167,200,133,31,97,6,141,72,139,139,152,111,8,96,159,179,117,
+201,27,234,202,196,242,156,31,14,251,101,78,10,247,186,248,95,21,74,109,104,
+115,75,27,75,107,167,200,211,10,251,33,247,143,247,140,21,138,133,134,139,
+128,27,200,247,108,251,77,247,55,29,131,138,130,217,10,143,143,138,137,143,
+31,97,251,46,5,189,6,157,205,5,44,149,166,98,193,27,184,167,165,238,197,31,
+120,153,5,93,115,120,120,119,27,123,130,152,169,135,31,128,234,123,165,87,
+144,137,140,24,140,141,173,148,159,160,166,195,25,190,164,145,147,154,27,
+145,143,136,130,143,31,120,149,147,133,156,27,168,159,163,174,175,118,159,
+101,95,123,122,251,0,81,31,123,109,132,130,126,124,171,247,12,24,89,6,14,
+251,33,247,182,248,99,21,251,77,113,132,116,5,140,143,144,139,141,27,159,
+153,124,118,131,138,129,217,10,161,138,150,120,143,90,145,40,161,92,185,131,
+158,134,148,135,147,132,8,155,125,149,111,109,26,131,139,134,137,127,30,168,
+6,185,247,56,5,113,6,98,140,111,164,137,175,127,239,123,163,79,142,179,148,
+159,158,168,199,149,160,24,166,152,150,150,151,27,145,143,136,130,143,31,
+120,149,146,133,157,27,168,159,163,174,175,118,159,102,94,123,122,251,0,81,
+31,76,106,107,115,87,27,14,47,247,140,247,151,21,196,247,96,251,76,247,55,
+29,132,138,129,247,45,29,202,247,118,5,247,1,6,103,251,20,5,135,125,137,122,
+124,26,99,158,121,185,135,30,161,137,154,134,147,132,8,151,128,147,116,114,
+26,130,138,132,137,125,30,168,6,182,247,52,5,113,6,109,116,151,154,145,141,
+148,141,148,31,238,247,238,5,251,11,6,86,251,77,5,14,251,40,248,56,191,21,
+113,6,84,141,138,141,95,247,69,132,168,24,234,190,143,143,165,27,147,146,
+138,135,151,31,135,153,145,138,149,27,167,162,163,168,169,113,161,105,105,
+104,112,94,114,31,92,57,129,187,136,152,108,234,25,251,49,107,132,117,5,141,
+149,147,140,145,27,167,161,111,90,151,31,172,251,38,96,67,5,116,125,127,129,
+126,27,131,134,141,146,127,31,146,125,131,142,127,27,108,116,116,107,106,
+160,119,173,174,183,171,184,167,31,186,216,163,251,3,159,105,185,133,25,164,
+134,144,138,145,135,8,154,131,149,115,112,26,130,138,133,136,125,30,169,6,
+14,251,15,247,150,247,127,21,135,6,126,134,146,155,152,139,140,146,163,31,
+185,247,59,251,76,113,133,116,5,150,6,159,153,125,118,131,138,129,136,131,
+31,116,56,5,130,110,137,125,123,26,99,165,112,177,163,164,147,152,159,30,
+117,56,5,184,6,176,247,27,149,150,150,152,162,168,25,90,251,65,5,133,116,
+137,128,125,26,104,166,115,178,188,180,171,218,187,30,122,150,5,102,118,121,
+121,124,27,130,136,143,148,147,139,140,145,157,31,238,247,239,5,251,12,6,
+125,93,123,89,122,105,108,99,25,166,239,5,93,6,14,251,20,248,120,239,21,121,
+149,5,103,119,122,121,123,27,132,135,144,148,145,140,144,143,154,247,33,10,
+55,116,81,61,247,20,10,182,247,58,102,29,151,148,141,143,151,30,147,118,143,
+117,123,26,132,138,132,137,126,30,168,6,184,247,51,5,14,251,101,78,10,247,
+107,247,191,238,10,118,116,247,27,29,247,24,51,5,14,42,60,29,137,248,55,160,
+10,153,248,4,248,86,21,186,247,111,251,73,113,133,116,5,140,143,143,139,142,
+27,160,152,124,116,133,138,133,137,128,31,115,251,2,5,32,6,118,59,5,154,6,
+160,150,150,144,176,27,181,6,89,251,122,5,134,117,137,121,122,26,69,194,90,
+219,247,6,229,222,244,212,101,183,74,115,132,137,121,88,30,165,247,13,5,209,
+6,176,148,134,118,141,31,154,6,152,219,5,251,74,251,99,247,47,29,102,54,235,
+10,247,205,248,93,21,251,37,251,29,251,48,251,58,54,206,76,230,247,39,247,
+25,247,44,247,60,226,74,202,48,31,143,251,170,21,132,114,130,116,128,114,
+8,77,111,110,111,104,27,109,120,163,177,176,146,190,152,188,31,143,147,150,
+142,143,27,152,146,133,120,152,31,121,151,152,130,155,27,153,153,141,145,
+156,31,251,19,233,21,155,189,147,158,150,158,8,184,164,168,162,170,27,168,
+157,117,102,104,134,100,127,87,31,137,127,138,139,135,27,130,130,142,145,
+134,31,170,109,135,142,119,27,124,122,136,130,115,31,14,251,10,247,129,247,
+65,21,104,247,91,5,137,150,138,148,144,26,160,150,145,186,143,30,144,163,
+5,251,137,6,134,115,161,136,144,136,143,130,25,145,127,159,59,148,94,195,
+251,182,24,164,6,247,113,248,2,5,163,154,159,157,151,27,145,143,135,133,140,
+31,113,144,148,131,163,27,170,165,168,175,167,126,151,110,116,124,137,134,
+125,31,107,127,104,106,116,101,8,14,251,155,247,72,129,21,231,142,204,202,
+224,26,199,109,170,71,150,30,88,29,129,103,5,178,29,164,76,180,103,198,128,
+25,81,54,123,10,87,129,247,58,10,251,38,247,172,248,94,21,251,132,138,92,
+251,40,5,159,6,168,205,181,172,206,146,251,1,252,51,24,222,29,81,142,123,
+148,116,217,29,94,116,121,121,119,27,123,130,152,169,135,231,10,152,148,150,
+151,27,146,143,135,131,143,31,119,148,147,134,247,34,29,125,124,251,1,82,
+31,76,107,108,115,87,27,172,247,14,5,14,251,101,247,32,126,21,148,6,182,183,
+155,168,172,31,165,161,155,158,174,189,111,157,24,72,91,108,116,96,27,95,
+110,175,193,201,165,230,175,203,31,186,166,168,163,169,27,151,149,132,129,
+134,137,134,133,130,31,130,124,135,127,127,26,109,164,117,172,247,17,29,251,
+55,251,53,68,178,84,205,120,30,81,54,74,10,251,46,248,94,247,18,21,94,119,
+121,113,127,27,135,136,143,144,144,141,150,142,151,31,231,247,244,5,251,15,
+6,125,95,119,83,127,115,113,100,247,31,10,146,141,150,141,149,31,190,247,
+82,251,73,247,7,10,118,131,138,132,136,129,31,116,58,5,134,122,135,109,123,
+26,102,167,111,176,185,171,165,241,217,30,91,251,78,5,136,129,138,128,126,
+26,135,139,134,140,131,30,116,105,5,120,107,133,123,118,26,128,141,131,144,
+126,247,49,29,112,130,30,150,115,170,247,14,29,152,135,149,128,158,30,128,
+157,135,148,147,26,144,140,144,142,146,30,128,146,155,132,160,27,196,182,
+176,230,186,31,14,245,248,99,206,21,175,75,5,247,42,6,143,157,100,142,127,
+146,118,172,25,96,211,212,207,158,156,160,148,163,140,25,142,153,5,251,39,
+6,136,125,5,166,137,146,136,127,26,131,133,129,126,127,30,117,119,57,247,
+28,217,153,181,157,171,170,25,173,171,158,185,186,26,190,114,174,87,163,30,
+155,104,102,144,65,27,251,131,6,135,121,5,193,133,152,131,113,26,129,137,
+121,135,123,30,55,252,38,121,61,128,128,69,134,25,135,121,5,247,150,6,142,
+157,5,83,142,124,148,168,26,150,141,154,142,155,30,178,247,76,191,141,247,
+2,251,87,80,84,119,125,120,131,121,138,25,136,125,5,247,27,6,142,153,5,112,
+131,142,150,145,142,143,149,149,31,35,248,136,21,166,145,151,145,183,27,233,
+186,108,78,63,94,82,58,116,31,106,129,112,136,74,138,8,14,247,239,248,140,
+249,96,21,251,96,251,52,251,50,251,95,251,91,247,52,251,51,247,93,247,91,
+247,52,247,52,247,92,247,89,251,52,247,54,251,88,31,164,82,21,247,35,126,
+247,6,251,6,153,251,37,8,251,163,6,247,164,82,21,130,251,34,251,13,251,15,
+251,34,128,8,247,168,7,83,251,168,21,251,39,153,251,5,247,5,125,247,41,8,
+247,166,6,251,166,196,21,153,247,36,247,7,247,6,247,37,153,8,251,164,7,14,
+247,239,173,137,21,146,6,213,6,247,68,205,151,183,204,31,241,208,213,247,
+54,247,47,26,234,109,222,91,177,30,167,103,90,152,74,27,251,43,32,86,46,105,
+31,125,102,135,115,138,73,217,177,24,148,7,138,234,176,183,230,153,61,252,
+62,24,122,64,114,92,109,129,116,140,24,229,22,143,142,194,185,158,182,161,
+247,19,25,199,247,236,5,146,6,142,6,180,150,138,135,152,31,196,118,169,73,
+38,26,251,102,44,251,41,251,30,132,30,247,141,251,153,21,218,6,177,247,98,
+5,123,178,142,138,161,27,247,20,247,1,247,57,247,83,247,0,94,195,54,87,94,
+117,98,106,31,102,93,118,80,115,251,24,8,234,230,21,230,155,176,192,185,27,
+180,161,97,60,251,42,82,251,11,67,110,117,150,165,119,31,14,247,235,248,141,
+249,101,21,251,96,251,54,251,50,251,91,251,93,247,52,251,53,247,91,247,91,
+247,53,247,53,247,91,247,87,251,53,247,56,251,84,31,127,82,21,247,64,247,
+28,251,25,251,59,251,62,251,26,251,27,251,61,251,59,251,27,247,27,247,60,
+247,56,247,27,247,30,247,54,31,14,58,181,22,247,11,6,185,247,53,158,204,190,
+220,197,193,25,166,168,159,152,152,27,143,142,136,134,135,138,133,137,133,
+31,137,132,137,135,137,26,76,251,116,5,128,97,133,110,121,26,99,163,115,178,
+186,183,173,220,198,30,96,169,131,127,136,135,132,129,25,136,134,135,134,
+135,134,8,130,133,135,136,135,27,136,137,141,143,142,140,144,141,145,31,141,
+144,141,144,140,145,199,247,110,24,148,172,142,160,162,26,192,111,170,91,
+99,104,121,98,101,30,123,122,123,122,123,123,137,136,132,132,127,128,177,
+247,28,24,247,45,218,160,218,251,44,60,180,247,30,251,93,112,125,96,5,140,
+144,143,139,142,27,141,151,149,140,143,27,155,149,131,127,130,138,136,129,
+99,31,118,60,32,83,120,59,247,0,196,5,14,247,106,248,29,249,148,21,251,51,
+116,54,76,45,26,71,178,69,199,98,30,188,106,194,124,245,130,130,251,23,108,
+50,92,102,8,194,251,25,113,147,82,27,75,90,108,98,87,216,96,234,200,187,152,
+176,209,31,106,225,204,123,193,27,198,203,169,185,177,31,157,160,150,159,
+158,182,103,156,24,45,98,86,100,55,27,90,92,147,160,74,31,231,247,1,173,216,
+146,247,15,8,247,63,209,229,229,239,26,213,76,200,62,58,66,82,50,105,30,115,
+75,129,78,137,34,58,145,102,146,104,155,8,77,168,96,196,190,26,218,217,202,
+247,17,161,30,247,54,251,198,21,148,247,9,148,193,158,195,8,193,158,171,167,
+179,27,182,167,108,91,91,117,90,98,94,31,101,98,104,115,76,116,8,251,128,
+251,245,21,117,93,106,132,91,27,69,87,158,165,158,178,154,188,186,169,129,
+99,223,31,14,95,165,248,122,21,128,7,80,184,102,211,206,181,173,195,161,131,
+161,126,151,30,126,152,118,148,92,150,8,83,153,122,150,159,26,163,165,157,
+173,177,157,125,102,146,30,182,6,199,138,100,174,73,27,77,98,104,87,95,165,
+117,208,124,31,199,126,159,126,112,26,112,111,120,101,95,111,162,175,138,
+30,144,7,247,119,247,89,21,251,191,183,247,164,143,7,199,251,164,5,192,6,
+199,247,164,5,143,251,164,182,247,191,59,6,87,251,149,84,247,149,5,14,94,
+247,64,248,214,21,194,231,160,147,185,27,208,193,75,57,53,84,64,76,119,126,
+144,156,118,31,157,175,142,148,158,26,168,116,161,108,103,114,112,100,114,
+148,117,161,117,30,158,118,152,131,170,130,73,122,92,103,79,62,176,106,24,
+215,206,175,160,205,27,187,177,121,100,172,31,172,101,157,90,90,26,96,125,
+93,114,100,30,98,113,106,118,102,27,95,102,172,177,161,146,154,159,161,31,
+138,131,133,139,131,27,113,120,147,163,104,31,173,90,121,147,109,27,81,94,
+95,83,108,151,111,164,111,31,193,172,5,109,158,128,153,160,26,167,161,160,
+168,173,164,113,103,117,132,125,118,117,30,140,146,145,139,142,27,166,158,
+133,122,161,31,179,109,139,139,149,134,8,122,172,172,131,172,27,247,15,246,
+247,11,247,30,204,113,204,94,187,31,107,173,112,153,82,155,8,237,169,199,
+217,237,26,247,6,49,227,251,9,72,93,119,66,37,30,14,150,249,51,249,20,21,
+107,183,111,121,5,167,95,125,144,106,27,93,112,128,104,95,31,182,89,117,149,
+97,27,251,25,36,251,56,251,103,251,123,247,33,251,66,247,78,221,221,176,200,
+192,31,168,173,157,169,166,197,95,160,24,43,82,75,97,51,27,81,74,165,180,
+98,31,79,197,104,243,247,10,26,247,46,199,247,5,220,161,155,132,117,166,30,
+102,99,122,98,90,26,101,156,104,192,68,30,195,62,144,130,107,26,99,114,114,
+101,95,99,180,183,159,144,152,157,163,30,85,163,5,125,115,133,116,107,26,
+57,205,72,222,221,206,210,228,171,129,171,121,169,30,125,161,135,145,90,195,
+8,78,210,139,139,167,26,178,174,174,177,167,168,122,102,174,30,14,251,103,
+225,247,60,21,224,149,237,158,182,154,8,238,173,187,186,201,26,208,76,183,
+41,73,62,114,100,83,30,62,85,94,56,51,26,251,9,225,63,247,26,216,210,163,
+186,204,30,168,160,151,154,153,26,156,118,164,125,134,133,136,134,131,30,
+97,111,139,139,126,132,8,113,92,91,126,94,27,72,98,174,205,131,31,146,218,
+21,156,182,156,163,175,167,8,166,175,190,156,187,27,173,160,126,119,119,123,
+122,107,122,31,95,117,46,116,64,132,8,14,251,103,211,247,30,21,94,251,30,
+5,248,16,6,187,247,30,5,91,6,158,203,147,186,187,26,195,126,195,119,171,30,
+182,112,102,154,62,27,251,26,6,87,138,134,142,138,175,8,117,122,130,113,98,
+26,102,149,109,156,126,30,128,153,153,137,192,27,247,33,6,207,167,105,58,
+106,134,105,129,99,31,14,251,213,236,247,30,21,94,251,33,5,247,39,6,186,237,
+149,124,157,90,148,105,25,158,155,142,151,187,26,197,133,213,130,204,30,131,
+195,139,139,156,26,154,140,154,142,155,30,143,160,141,157,148,26,180,105,
+163,68,148,30,84,146,130,143,136,159,8,119,117,133,121,105,26,71,163,112,
+204,132,30,207,131,141,137,78,26,99,133,70,131,91,30,14,205,135,248,241,21,
+247,14,251,186,205,162,64,247,64,248,197,252,194,191,188,252,201,248,198,
+247,65,63,162,204,251,182,247,9,5,14,205,248,197,248,195,21,252,201,252,198,
+191,90,248,197,248,194,64,251,64,205,116,247,14,247,186,72,199,251,182,251,
+9,162,74,5,14,205,248,245,243,21,252,197,248,195,87,90,248,201,252,199,251,
+65,215,116,74,247,182,251,9,206,199,251,14,247,186,73,116,5,14,205,247,49,
+190,21,248,201,248,199,87,188,252,197,252,195,214,247,64,73,162,251,14,251,
+186,206,79,247,182,247,9,116,204,5,14,247,235,249,218,247,95,161,10,40,247,
+147,150,10,14,247,235,247,8,247,95,150,10,249,102,247,83,152,29,205,247,140,
+247,11,21,96,163,115,152,94,159,119,115,24,203,101,247,38,251,23,173,87,198,
+214,241,232,222,192,120,163,24,93,120,113,126,96,114,8,248,2,7,181,114,164,
+126,187,119,158,163,24,55,193,37,232,81,213,104,86,251,35,251,20,73,99,159,
+115,24,190,163,162,150,177,162,8,212,184,21,145,144,145,144,146,143,145,145,
+146,144,146,144,158,125,142,136,157,126,8,252,93,7,132,134,132,134,134,135,
+132,134,132,134,132,133,124,151,133,143,121,153,8,14,251,66,210,22,247,25,
+6,245,186,148,169,182,31,200,182,175,208,216,26,210,109,202,85,184,30,177,
+92,94,150,251,9,27,251,25,69,247,21,6,231,175,132,118,170,31,177,111,161,
+109,146,105,8,251,247,63,247,247,6,132,108,123,114,107,111,105,111,104,132,
+37,138,8,251,21,6,14,247,235,247,107,248,145,21,248,198,213,252,198,6,252,
+23,4,247,136,251,88,213,247,88,247,136,213,251,136,247,79,65,251,79,251,136,
+6,14,205,247,206,249,136,21,254,131,212,250,131,7,14,205,247,141,250,19,21,
+28,251,130,212,28,4,126,7,215,22,28,251,130,212,28,4,126,7,14,247,239,248,
+169,248,149,21,73,6,251,116,252,149,5,219,6,247,69,248,45,247,69,252,45,5,
+219,6,14,247,239,248,169,22,247,116,248,149,5,59,6,251,69,252,45,251,69,248,
+45,5,59,6,247,116,252,149,5,14,247,235,247,128,251,23,21,134,166,156,137,
+162,27,247,3,219,199,244,168,31,149,176,141,159,142,198,8,240,157,207,224,
+245,26,245,77,217,36,163,30,247,26,147,191,199,246,27,156,149,138,134,163,
+31,224,7,144,116,127,140,115,27,60,81,113,84,94,31,103,95,121,82,133,43,8,
+36,115,76,60,33,26,35,199,62,241,112,30,251,31,136,90,80,251,5,27,123,126,
+141,144,114,31,247,195,248,160,21,187,125,175,86,84,26,83,105,90,89,121,30,
+56,141,21,93,155,105,190,193,26,192,173,191,185,155,30,14,247,235,117,29,
+251,121,252,98,21,92,101,102,93,92,177,101,185,185,177,177,185,185,101,177,
+94,31,14,247,235,117,29,252,94,252,98,164,10,176,101,186,185,177,177,185,
+184,101,178,94,31,14,247,235,248,204,248,104,21,251,250,65,247,210,6,100,
+68,5,251,171,65,247,131,6,101,68,5,251,93,65,247,52,6,103,73,204,104,195,
+240,5,248,5,213,251,221,6,178,210,5,247,182,213,251,142,6,177,210,5,247,104,
+213,251,63,6,179,212,74,175,5,14,247,235,249,207,249,30,21,253,40,251,175,
+5,72,7,249,40,251,175,5,227,7,252,162,247,121,248,162,247,120,5,93,4,252,
+49,251,74,248,49,251,75,5,229,7,251,100,232,247,100,231,5,14,247,235,247,
+59,249,30,21,51,7,248,162,251,120,252,162,251,121,5,51,7,249,40,247,175,5,
+206,7,253,40,247,41,21,49,7,247,100,47,251,100,46,5,49,7,248,49,247,75,5,
+14,247,235,249,71,249,77,21,53,6,103,56,5,146,103,84,144,87,27,251,142,57,
+247,142,6,190,173,137,135,164,31,251,87,252,92,5,251,57,57,247,22,6,109,68,
+5,226,6,169,210,5,172,6,247,8,212,156,179,201,31,228,198,186,227,247,1,26,
+247,15,80,235,251,2,194,30,108,66,21,220,93,175,77,46,26,87,128,98,117,106,
+30,112,99,96,106,95,125,8,126,99,96,134,67,27,14,247,235,248,138,249,76,134,
+29,247,188,252,26,21,251,48,122,251,19,251,7,251,48,27,251,48,251,21,247,
+8,247,47,123,31,140,198,21,247,46,155,247,20,247,9,247,47,27,247,49,247,19,
+251,6,251,49,156,31,14,247,235,248,138,249,75,21,251,93,154,29,251,84,31,
+251,130,252,185,21,94,196,117,200,209,26,247,58,247,26,247,27,247,58,208,
+203,117,94,196,30,183,96,21,184,82,161,78,67,26,251,57,251,27,251,26,251,
+58,71,75,161,184,82,30,14,247,235,248,134,248,32,21,105,112,113,104,106,166,
+112,172,173,166,166,173,172,112,166,106,31,143,247,192,134,29,130,79,21,247,
+64,247,27,251,24,251,61,251,57,251,27,251,26,251,59,251,59,251,27,247,26,
+247,56,247,57,247,27,247,29,247,54,31,14,247,235,249,193,247,213,21,252,191,
+247,131,59,252,196,219,247,131,248,191,6,14,247,235,247,70,247,213,21,57,
+248,191,251,131,219,248,196,59,251,131,7,14,247,235,247,108,249,18,21,56,
+247,129,252,191,223,248,191,247,129,222,7,14,247,235,247,105,248,221,21,247,
+127,252,220,5,238,6,247,127,248,220,5,51,6,251,88,252,127,251,89,248,127,
+5,55,253,102,21,248,199,213,252,199,6,14,247,235,250,126,247,175,21,88,6,
+251,52,138,251,7,106,62,70,37,44,108,50,140,251,89,8,88,202,190,7,141,171,
+140,247,51,173,220,236,216,25,198,184,240,164,247,19,141,8,190,6,14,247,235,
+133,247,175,21,76,190,7,247,6,137,236,118,196,102,8,247,2,65,180,50,251,58,
+26,141,107,5,88,202,190,7,140,247,89,108,228,37,234,61,208,251,6,172,251,
+52,140,8,14,247,235,133,247,112,21,190,6,247,53,140,247,5,172,217,208,241,
+234,170,228,138,247,89,8,190,76,88,7,137,107,138,251,51,105,58,42,63,25,78,
+93,41,114,251,20,137,8,88,6,14,247,235,250,126,247,112,21,202,88,7,251,6,
+141,43,160,80,176,8,251,1,213,98,228,247,58,26,137,171,5,190,76,88,7,138,
+251,89,170,50,241,44,217,70,247,5,106,247,53,138,8,14,205,248,234,176,21,
+251,130,248,107,251,130,252,107,5,248,15,198,21,251,175,6,247,35,247,176,
+5,14,205,247,18,170,21,248,102,247,133,252,102,247,132,5,201,252,14,21,247,
+173,7,247,179,251,35,5,14,205,247,14,248,144,21,247,130,252,107,247,130,248,
+107,5,252,15,80,21,247,175,6,251,35,251,176,5,14,205,248,229,170,21,248,117,
+7,252,102,251,132,5,248,40,251,30,21,251,179,247,30,247,179,247,35,5,14,247,
+235,247,133,247,223,21,247,157,251,184,247,153,247,182,251,159,247,186,5,
+14,247,235,247,82,247,225,21,247,202,251,236,247,203,247,236,251,203,247,
+235,5,251,157,251,235,21,247,157,247,184,247,157,251,184,251,157,251,185,
+5,14,251,47,247,139,248,99,21,35,53,54,37,251,0,223,54,246,243,224,224,244,
+244,54,224,34,31,140,81,21,211,198,80,66,67,80,79,68,63,81,198,215,209,200,
+198,211,31,14,203,247,1,10,247,114,251,48,21,247,175,194,41,249,213,237,194,
+251,175,6,194,254,12,21,249,213,214,253,213,7,248,2,236,29,203,247,1,10,247,
+111,251,48,21,247,175,250,67,251,175,84,237,253,213,41,6,247,45,22,249,213,
+214,253,213,7,247,163,236,29,121,157,248,85,152,247,99,155,6,172,10,247,10,
+11,162,145,143,143,143,143,143,146,146,143,144,144,12,12,248,136,20,249,33,
+21,175,19,1,37,2,0,1,0,31,0,43,0,55,0,88,0,93,0,205,0,226,0,239,1,58,1,70,
+1,190,1,207,1,217,1,228,2,1,2,9,2,93,2,96,2,111,2,156,3,35,3,40,3,156,3,198,
+4,74,4,85,4,144,5,8,5,51,5,73,5,114,5,226,6,42,6,149,6,255,7,4,7,19,7,28,
+7,48,7,59,7,158,7,183,7,186,8,21,8,24,8,72,8,157,8,241,9,45,9,126,9,205,9,
+236,9,240,10,54,10,78,10,125,10,161,10,166,10,176,10,189,10,238,10,250,11,
+50,11,73,11,133,11,139,11,198,11,248,11,253,12,15,12,39,12,93,12,99,12,125,
+12,176,12,184,12,234,12,239,12,252,13,7,13,15,13,32,13,35,13,79,13,83,13,
+88,13,130,13,172,13,213,13,234,13,247,14,0,14,20,14,46,14,84,14,108,14,129,
+14,134,14,170,14,178,14,199,14,234,14,247,15,10,15,21,15,44,15,62,15,96,15,
+130,15,163,15,196,15,209,15,234,16,9,16,40,16,71,16,77,16,107,16,111,16,121,
+16,133,16,162,16,189,16,218,16,247,17,20,17,25,17,33,17,45,17,53,17,64,17,
+91,17,118,17,130,17,140,17,145,17,171,17,197,17,221,17,228,17,253,18,22,18,
+47,18,55,18,60,18,70,18,75,18,98,18,121,18,124,18,131,18,153,18,170,18,192,
+18,210,18,231,18,252,19,13,19,34,19,55,19,76,19,93,19,97,19,104,19,114,19,
+134,19,147,19,164,19,174,19,193,19,203,19,222,19,228,19,246,20,8,20,26,20,
+32,20,43,20,61,20,77,20,88,20,96,20,104,20,121,20,131,20,141,20,158,20,175,
+20,192,20,209,20,226,20,243,20,249,21,3,21,17,21,33,21,49,21,65,21,81,21,
+97,21,103,21,119,21,135,21,149,21,164,21,179,21,194,21,209,21,224,21,239,
+21,254,22,13,22,28,22,33,22,46,22,54,22,68,22,78,22,85,22,99,22,113,22,127,
+22,141,22,147,22,156,22,165,22,178,22,191,22,204,22,217,22,230,22,243,23,
+0,23,13,23,26,23,39,23,52,23,65,23,78,23,89,23,93,23,104,23,116,23,128,23,
+133,23,145,23,157,23,169,23,181,23,193,23,205,23,217,23,229,23,237,23,245,
+23,253,24,5,24,13,24,24,24,35,24,46,24,57,24,68,24,79,24,90,24,101,24,112,
+24,123,24,134,24,145,24,156,24,165,24,174,24,180,24,183,24,188,24,192,24,
+195,24,200,24,203,24,210,24,215,24,221,24,232,24,235,24,240,24,245,24,252,
+24,255,25,2,25,5,25,13,25,16,249,124,249,49,21,251,100,114,6,82,10,247,23,
+224,206,166,192,184,30,173,178,162,192,171,247,1,247,18,10,11,248,107,247,
+25,69,10,84,133,113,183,29,11,108,10,226,216,192,178,238,199,30,157,29,11,
+145,10,130,110,21,168,247,50,10,77,110,109,110,104,27,109,120,162,178,218,
+176,247,37,174,201,31,185,165,168,162,171,27,11,247,156,90,29,11,250,64,249,
+49,21,251,79,114,6,195,135,146,134,103,26,127,137,131,126,113,30,251,48,251,
+219,106,247,187,5,133,192,139,139,151,26,182,149,149,192,144,30,164,251,161,
+115,7,199,131,149,125,140,53,251,42,251,203,24,100,247,241,5,138,144,139,
+146,143,26,175,152,150,187,145,30,164,251,169,115,7,203,128,142,137,149,68,
+217,252,215,24,168,6,247,125,248,125,198,252,125,5,168,6,247,178,248,226,
+167,194,153,151,181,145,25,11,249,86,247,222,75,10,96,104,145,93,27,62,135,
+29,209,146,147,192,143,25,11,141,121,155,29,94,205,251,15,232,31,73,10,11,
+247,126,247,205,21,79,251,108,121,82,215,10,152,140,146,146,164,30,191,247,
+83,247,82,247,159,173,185,158,154,177,147,25,164,251,100,114,7,192,137,153,
+130,104,26,121,134,127,118,109,30,251,21,251,78,121,194,129,169,123,190,25,
+116,204,129,175,157,26,167,247,5,10,136,158,86,8,11,248,114,248,65,72,10,
+199,26,155,48,10,11,200,247,183,21,198,168,161,168,155,27,148,143,134,130,
+128,137,128,128,99,31,104,251,22,133,110,103,26,70,188,92,211,216,201,187,
+234,184,30,171,208,160,222,199,26,206,115,178,98,107,116,112,103,121,145,
+123,151,124,30,158,115,139,139,143,131,8,148,116,144,117,118,26,100,121,84,
+110,93,30,95,113,107,116,108,27,110,118,164,172,152,143,161,145,163,31,186,
+247,74,5,144,162,142,157,155,26,176,117,163,104,101,93,113,100,108,30,121,
+116,128,120,121,98,8,11,112,10,118,150,159,123,101,10,166,103,56,154,30,166,
+137,5,11,106,29,81,126,75,130,59,91,10,11,247,210,99,29,251,55,251,53,207,
+10,11,248,28,21,153,170,147,156,143,146,188,29,133,108,135,80,135,80,137,
+105,138,130,138,122,138,135,137,115,8,11,72,10,200,26,154,48,10,11,137,149,
+135,155,30,206,6,251,255,252,15,21,151,138,215,113,161,129,8,167,125,152,
+122,113,26,95,95,114,63,74,93,171,185,159,148,155,160,159,30,151,151,170,
+157,146,138,8,247,32,248,73,21,165,158,115,104,105,127,89,122,103,31,93,117,
+114,117,108,27,112,124,160,177,179,156,200,160,177,31,172,158,160,155,165,
+27,11,84,10,14,163,10,112,113,106,108,113,165,171,171,165,166,170,31,14,247,
+34,10,107,251,11,69,251,130,30,247,13,6,186,247,38,156,221,29,146,31,122,
+153,152,131,156,27,172,164,170,181,179,117,165,104,88,98,89,251,51,60,247,
+15,10,11,248,28,248,34,21,247,108,247,90,182,178,147,142,182,145,25,164,251,
+103,114,7,189,133,145,136,121,26,120,119,113,82,86,30,63,68,116,119,41,55,
+201,247,120,24,154,191,159,155,198,143,8,164,251,202,114,7,174,133,160,134,
+145,135,225,29,120,132,112,30,251,14,252,85,123,86,124,126,90,133,25,114,
+247,181,164,7,87,143,125,148,172,26,145,140,145,140,144,30,205,247,141,247,
+6,251,134,5,149,118,142,128,128,26,125,127,131,113,137,30,135,138,128,138,
+127,138,8,114,247,172,164,7,101,143,125,146,128,163,8,11,247,108,88,10,11,
+248,222,247,86,21,114,144,104,82,118,114,100,112,25,100,83,71,120,53,27,96,
+121,149,163,146,141,150,145,159,31,141,143,140,146,141,147,141,145,24,195,
+247,101,5,247,6,137,169,120,71,26,125,138,127,136,120,30,167,134,213,247,
+165,111,143,92,45,113,126,251,24,140,25,200,247,115,5,174,149,151,148,180,
+27,211,194,124,112,166,31,162,115,146,114,77,26,166,134,182,247,82,5,252,
+176,114,6,174,133,160,135,247,40,10,128,26,125,206,10,11,248,63,247,23,21,
+209,29,247,3,248,41,79,125,91,132,38,131,25,112,160,7,165,154,129,121,130,
+134,117,115,52,31,121,71,118,10,251,70,247,197,123,29,11,30,138,130,138,128,
+164,134,212,247,165,113,143,103,56,99,115,40,140,25,130,6,129,6,204,247,127,
+5,166,146,149,144,181,27,243,193,101,64,143,31,141,99,163,134,184,247,82,
+5,252,225,116,6,204,135,155,134,120,26,128,131,122,127,123,30,252,2,252,108,
+99,88,127,125,133,136,25,131,134,133,137,123,137,8,114,247,87,164,7,91,143,
+123,147,161,26,151,144,153,149,152,30,247,6,247,49,5,247,84,6,93,251,51,123,
+85,129,130,87,131,25,100,247,161,21,247,145,247,225,5,151,6,47,251,225,5,
+11,204,10,94,209,10,104,104,68,101,30,14,21,47,6,101,29,169,160,161,170,188,
+101,170,78,87,90,117,100,104,30,97,93,120,98,110,225,10,91,251,102,104,251,
+50,134,115,128,29,181,176,153,168,170,30,179,175,166,192,172,242,163,218,
+150,185,193,247,144,8,229,6,14,21,69,247,165,5,136,148,136,163,147,26,166,
+160,154,178,30,146,6,146,161,5,251,171,6,133,117,191,134,152,122,163,42,25,
+242,252,12,107,90,121,119,111,119,25,128,124,126,133,133,27,130,133,144,148,
+144,139,140,144,151,31,141,146,140,144,144,26,169,111,163,103,99,111,110,
+97,88,174,109,200,190,181,157,180,178,30,168,168,154,158,208,240,247,126,
+247,235,24,189,210,171,166,180,140,146,161,24,251,104,89,10,151,6,163,154,
+124,115,116,127,109,120,110,31,14,247,16,248,9,21,37,6,127,95,5,241,6,76,
+251,124,149,10,114,6,247,19,10,241,251,62,21,200,247,119,5,119,29,194,247,
+95,5,247,14,6,151,183,5,14,21,87,10,185,171,165,241,217,135,10,196,191,184,
+222,178,30,119,147,5,222,10,11,113,10,145,172,143,155,30,193,247,91,5,135,
+174,158,228,10,251,179,6,247,112,63,21,146,163,139,139,143,145,8,149,148,
+150,143,159,27,191,170,192,10,11,21,96,107,116,118,114,110,8,87,79,110,63,
+63,26,38,189,75,217,186,177,161,193,187,30,80,167,160,122,181,27,242,234,
+247,53,247,65,218,110,187,92,108,115,114,107,121,146,119,150,126,31,173,101,
+139,139,144,131,8,152,120,145,117,116,26,43,61,251,5,74,112,120,159,188,120,
+30,198,220,162,192,194,26,180,120,166,110,91,104,80,57,108,141,115,147,89,
+30,89,99,112,118,114,27,113,120,176,189,229,185,247,33,195,224,31,14,248,
+32,247,228,21,76,247,113,5,137,149,137,149,148,185,29,119,65,207,29,133,117,
+5,247,198,118,29,104,6,113,122,156,165,146,140,144,140,145,31,194,247,96,
+247,104,247,173,172,181,165,162,162,146,25,226,29,251,82,89,10,157,6,166,
+162,120,116,123,132,120,126,122,31,11,247,230,247,45,21,70,103,95,105,85,
+27,94,108,173,189,170,149,165,163,174,31,117,173,157,133,166,27,176,167,158,
+164,160,117,155,110,123,121,135,127,92,31,138,148,139,147,143,26,211,181,
+202,187,153,149,129,125,138,139,137,138,138,30,136,125,139,139,136,26,114,
+166,115,169,168,161,161,169,186,93,168,66,251,2,59,89,70,105,154,114,175,
+113,30,58,110,101,95,77,26,67,200,89,225,232,199,185,243,183,30,11,206,247,
+178,21,197,167,162,170,156,27,148,144,132,126,129,136,124,131,109,31,58,251,
+192,5,247,10,6,186,247,74,147,169,172,205,171,189,25,163,154,155,152,151,
+27,149,145,132,127,128,137,126,132,112,31,251,14,252,109,5,247,8,6,247,20,
+248,134,5,145,160,142,161,156,26,183,113,168,101,109,111,123,102,106,30,112,
+109,122,111,108,76,8,163,239,139,139,155,26,172,114,164,104,80,83,84,37,94,
+30,11,70,29,143,29,11,21,73,107,247,22,29,141,71,139,139,152,111,8,246,29,
+21,191,10,251,10,6,83,29,11,247,189,247,213,21,247,122,6,77,251,125,113,29,
+226,29,251,168,124,10,11,204,10,93,209,10,104,104,68,101,30,14,21,251,3,6,
+163,105,109,148,93,27,251,15,40,58,38,88,165,103,193,116,31,57,93,125,125,
+102,26,107,157,120,183,124,30,77,124,119,131,115,120,8,123,125,128,115,115,
+26,74,212,98,247,7,247,33,237,201,227,200,99,172,251,1,170,30,86,154,5,107,
+148,120,153,154,26,155,154,159,152,144,146,138,136,147,30,136,150,147,138,
+151,27,183,184,151,161,177,31,197,172,170,190,11,77,186,124,161,184,26,204,
+179,179,203,219,177,90,251,9,153,218,10,124,142,147,114,96,10,11,112,29,14,
+21,251,179,113,6,182,135,147,137,150,133,8,145,135,145,128,130,26,113,135,
+120,112,48,30,116,63,139,139,135,133,8,122,125,98,126,100,27,33,81,205,247,
+14,247,41,207,247,59,230,216,31,171,177,182,155,184,27,186,178,120,107,161,
+31,161,106,146,110,141,71,168,135,24,190,247,113,5,108,6,117,128,128,131,
+119,27,130,131,141,146,120,31,154,11,77,10,14,247,252,247,100,21,132,251,
+11,135,95,193,10,158,177,31,149,7,167,248,209,5,114,6,252,54,252,192,97,82,
+113,170,29,214,241,5,247,58,181,21,251,28,6,247,38,247,92,5,11,247,239,247,
+32,21,71,93,111,117,97,27,97,117,167,194,156,140,150,143,158,31,242,159,189,
+161,187,184,8,173,171,158,176,173,26,190,95,175,79,251,35,251,33,251,52,251,
+55,54,203,77,226,214,192,177,238,198,30,251,89,227,21,247,29,174,184,214,
+187,27,158,148,128,116,95,122,97,108,107,31,112,111,115,125,82,121,8,11,247,
+248,21,172,174,169,154,171,27,173,160,117,102,114,130,114,123,126,31,124,
+125,118,127,85,114,66,104,137,137,116,121,8,120,123,129,115,111,26,68,191,
+92,216,203,183,164,211,204,30,121,158,5,96,98,106,120,101,27,103,116,167,
+182,187,164,166,217,175,31,233,183,167,169,195,26,200,98,177,74,82,106,122,
+74,70,30,11,220,251,151,5,143,127,141,128,130,26,115,123,123,116,202,10,251,
+4,247,220,247,57,247,45,195,184,178,158,185,143,25,226,29,251,115,89,10,151,
+6,155,152,124,121,118,123,111,114,115,31,251,79,251,67,196,247,107,247,41,
+10,11,143,159,31,178,148,5,247,37,172,222,206,221,26,194,102,171,77,89,111,
+124,89,96,30,159,204,36,134,5,54,104,21,167,159,115,107,85,107,35,100,71,
+31,85,110,109,114,105,27,109,119,165,179,141,31,142,197,165,222,177,206,8,
+198,172,171,167,171,27,247,25,251,80,21,247,26,178,182,203,189,27,162,149,
+11,196,134,162,123,103,26,122,132,103,127,96,30,81,251,101,112,41,117,89,
+109,103,25,99,105,95,119,84,27,63,93,177,202,167,141,149,165,234,31,221,247,
+192,156,196,154,151,201,142,25,164,251,203,114,7,208,129,143,137,112,26,127,
+133,108,130,106,30,84,251,98,5,116,57,128,79,106,26,41,231,71,11,247,217,
+22,143,29,247,36,248,177,5,185,6,235,140,188,99,150,53,8,159,6,183,247,55,
+5,252,104,6,137,29,11,21,167,10,11,21,251,84,251,44,251,48,251,89,251,85,
+247,44,251,49,247,79,247,91,247,42,247,44,247,92,247,88,251,44,247,47,251,
+84,31,93,4,247,47,247,20,251,31,251,58,251,62,251,19,251,28,251,52,251,43,
+251,20,247,32,247,57,247,60,247,20,247,30,247,47,31,14,120,154,111,110,26,
+133,138,130,138,129,30,165,6,182,247,56,5,252,106,6,95,111,29,14,251,10,6,
+88,251,86,119,83,127,115,113,99,247,31,10,147,141,149,141,150,31,228,247,
+232,251,73,223,10,131,137,130,31,78,251,123,5,134,118,135,114,122,26,102,
+167,111,176,11,245,10,146,171,154,193,232,29,149,142,139,147,27,166,154,129,
+121,125,125,80,120,70,31,64,251,156,5,118,63,126,81,115,247,32,29,11,6,133,
+117,5,11,106,29,80,126,77,130,58,91,10,11,172,29,101,167,114,180,199,176,
+169,245,209,30,11,247,31,29,153,147,173,153,191,31,190,247,75,225,186,158,
+207,53,92,214,247,164,247,51,10,148,143,139,145,27,168,154,129,121,122,124,
+81,94,251,53,31,61,96,120,69,216,182,5,90,11,247,112,21,158,160,148,149,156,
+157,103,10,11,154,158,159,30,153,6,144,161,5,251,155,89,10,152,6,174,134,
+162,113,154,87,227,251,146,24,251,51,251,67,84,76,96,105,103,130,25,133,117,
+5,247,97,118,29,126,6,106,121,151,162,155,148,156,163,166,31,14,248,70,247,
+19,21,83,98,124,125,123,27,132,134,145,148,164,149,181,163,220,120,10,11,
+31,153,98,111,144,110,27,251,6,52,55,251,2,113,144,116,147,122,31,161,97,
+180,95,195,95,8,218,79,173,93,92,26,117,132,114,127,118,30,100,116,105,120,
+89,27,87,94,163,182,113,31,120,170,131,169,135,199,110,141,24,11,247,3,10,
+195,10,11,5,247,13,6,190,247,70,160,189,189,212,8,199,181,172,168,165,27,
+151,149,129,128,133,137,131,136,130,31,137,131,135,128,134,125,135,126,135,
+128,136,130,8,91,251,32,126,89,98,26,105,166,115,178,200,179,172,242,205,
+30,11,247,41,21,94,6,217,247,153,5,93,6,251,170,251,147,123,72,5,247,51,6,
+112,51,5,225,6,167,227,5,183,6,251,138,200,21,247,76,247,62,87,251,62,5,211,
+248,170,247,46,29,11,111,10,247,57,29,179,10,146,150,136,134,152,31,131,163,
+157,135,160,27,224,190,10,11,141,10,143,27,153,151,129,128,128,108,36,110,
+54,31,126,98,5,73,122,124,125,83,27,14,8,209,211,170,180,160,26,145,133,145,
+132,131,125,130,120,120,30,126,127,129,131,115,122,251,62,251,16,24,130,7,
+224,53,198,77,163,112,8,131,146,142,137,144,27,148,145,146,147,154,129,166,
+116,187,31,11,201,29,123,247,0,10,249,42,21,247,11,29,133,138,133,138,133,
+31,152,10,124,89,10,247,214,6,247,15,247,54,10,11,123,87,125,126,89,132,25,
+114,247,188,164,7,76,144,129,145,171,26,154,143,157,148,170,30,141,146,140,
+144,140,143,189,247,73,24,247,131,6,75,251,124,125,85,119,125,72,135,25,114,
+247,209,11,21,104,110,109,103,131,29,11,247,209,247,34,21,70,93,110,117,96,
+27,97,117,167,193,155,141,152,143,159,31,243,159,188,161,189,185,8,174,171,
+158,176,175,26,190,95,175,78,251,37,251,35,251,55,251,57,54,203,77,11,96,
+107,235,29,11,128,10,103,117,154,163,147,141,151,142,152,31,11,247,40,29,
+128,122,144,150,113,134,10,11,247,225,248,97,21,120,29,11,249,24,21,143,10,
+247,186,164,7,83,142,123,148,166,26,149,11,117,10,14,251,87,114,6,194,134,
+148,133,158,95,251,12,252,47,24,100,251,23,132,128,84,128,8,114,247,100,164,
+7,80,144,118,154,178,26,158,145,172,151,181,30,238,247,248,11,30,119,10,11,
+249,103,126,29,11,5,163,115,120,148,110,27,251,14,251,42,251,85,251,49,66,
+184,87,200,203,184,175,234,196,31,130,100,137,126,123,26,101,161,116,177,
+188,184,177,227,194,30,11,251,81,247,200,21,161,138,154,120,112,26,79,105,
+251,3,101,70,30,90,112,109,113,112,27,113,120,162,170,191,172,239,180,213,
+31,169,192,172,170,166,137,8,11,31,210,247,128,251,3,132,121,80,5,190,130,
+117,160,96,27,251,15,251,42,251,84,251,48,63,182,88,204,200,184,175,235,197,
+31,127,98,137,127,125,26,11,21,247,21,10,175,109,170,103,31,247,102,22,247,
+21,10,176,109,169,103,31,14,21,104,110,110,102,131,29,247,104,22,247,65,29,
+152,127,5,142,151,146,138,29,11,89,10,165,6,166,155,122,113,131,139,135,137,
+237,10,157,157,173,214,29,11,122,113,132,138,134,138,133,31,152,10,135,89,
+10,247,172,118,29,100,6,113,122,156,165,143,140,11,127,111,108,133,108,27,
+45,83,204,247,1,247,37,211,247,66,230,215,31,170,176,178,154,180,27,220,189,
+79,41,126,138,131,137,125,31,171,133,11,21,165,155,117,105,76,107,251,25,
+106,61,31,92,118,115,244,10,192,158,171,170,174,27,14,148,29,133,89,10,248,
+113,6,201,247,58,5,121,6,55,56,47,92,60,27,11,249,65,133,29,11,21,123,6,115,
+102,125,132,87,138,8,50,6,247,17,240,5,206,193,164,177,187,26,195,92,182,
+78,77,93,108,72,103,30,157,128,5,11,5,39,113,122,108,151,10,11,247,182,161,
+21,111,247,39,29,148,139,142,141,146,30,247,23,248,127,182,10,11,21,251,91,
+251,58,251,56,251,87,251,99,247,53,251,56,247,93,247,97,247,55,247,54,247,
+95,247,94,251,55,247,55,251,94,31,11,31,157,98,107,147,115,173,29,128,166,
+150,137,11,30,134,123,136,127,136,131,8,133,119,136,122,127,26,114,162,121,
+169,11,122,127,101,104,30,251,14,251,23,5,11,247,60,29,139,135,137,133,30,
+251,23,252,128,127,94,122,122,104,136,25,131,89,10,11,21,252,160,7,58,247,
+102,86,203,10,248,160,7,220,251,102,192,11,247,82,247,156,173,185,157,153,
+178,147,25,164,251,100,114,7,192,138,153,129,104,26,122,133,126,119,110,30,
+251,21,251,76,120,11,72,91,108,116,96,27,95,110,175,192,202,165,229,175,204,
+31,186,166,167,163,170,27,151,149,132,129,135,137,133,133,130,31,130,11,21,
+247,116,158,6,90,129,143,161,148,141,152,143,151,31,239,247,222,74,126,97,
+131,69,129,25,137,118,5,141,163,154,140,11,247,5,247,92,199,242,161,162,175,
+137,25,145,159,5,251,38,6,133,119,5,151,6,155,149,131,125,124,134,128,107,
+83,31,11,174,134,160,134,247,40,10,129,26,124,206,10,11,247,38,10,129,89,
+10,247,172,6,146,161,5,107,6,113,122,156,163,144,140,147,141,146,31,11,247,
+176,248,98,21,251,40,251,31,251,51,251,60,54,206,76,231,247,41,247,28,247,
+47,247,61,227,74,202,47,31,11,75,125,59,128,83,137,8,112,7,181,151,133,120,
+127,125,85,107,251,4,31,116,57,132,113,113,43,8,247,13,6,11,221,247,78,140,
+140,141,144,142,147,25,149,161,140,142,152,26,166,119,161,114,100,102,104,
+101,136,30,123,251,106,5,11,123,127,101,247,1,29,124,88,122,124,91,133,25,
+114,247,178,7,247,148,247,81,247,61,247,119,247,63,251,4,241,251,81,31,251,
+182,11,21,155,10,11,110,247,33,29,147,150,141,239,29,11,251,23,252,127,127,
+94,121,121,104,136,25,11,138,186,5,175,154,159,165,30,149,6,144,159,5,251,
+118,6,134,119,5,166,155,98,55,145,31,149,251,104,11,251,56,5,162,6,181,215,
+202,181,218,143,251,34,252,168,24,127,94,121,121,104,136,8,98,89,10,11,249,
+3,6,251,102,57,162,87,247,178,247,20,5,216,7,251,178,247,19,116,86,247,102,
+58,5,253,3,6,11,177,247,23,145,148,197,152,25,164,251,101,114,7,198,134,160,
+123,101,26,120,132,105,128,98,30,59,251,179,11,252,187,6,101,251,63,164,132,
+190,239,203,181,241,140,25,251,40,252,173,5,88,125,113,118,88,27,125,114,
+11,21,161,29,148,10,21,247,2,29,114,120,148,10,238,10,119,115,247,27,29,247,
+24,51,5,14,21,203,253,3,7,180,10,11,124,89,10,247,214,6,247,15,223,29,11,
+21,81,90,91,82,79,186,91,198,198,187,187,198,197,91,187,81,31,137,91,21,172,
+166,112,106,108,11,21,92,101,102,93,92,176,101,186,185,177,177,185,185,101,
+177,94,31,248,94,22,92,101,102,93,92,11,247,41,10,175,29,166,138,155,123,
+113,26,11,31,117,106,5,121,183,171,206,29,14,227,29,136,10,11,138,66,135,
+25,251,10,6,172,247,11,151,168,171,178,8,162,158,173,153,176,27,156,148,134,
+128,11,31,170,124,160,100,97,26,96,124,88,116,107,30,97,111,97,118,87,27,
+125,129,140,143,120,31,11,115,83,99,30,153,126,5,171,167,158,149,167,27,173,
+160,119,107,96,100,112,57,124,31,14,247,61,10,247,30,10,11,247,186,247,195,
+21,135,175,155,138,162,27,247,37,247,0,226,247,8,236,59,203,251,14,31,11,
+249,72,21,133,117,5,161,6,164,138,157,123,115,26,134,138,131,137,131,30,54,
+136,87,132,11,247,156,22,248,163,6,198,247,88,113,142,97,72,114,111,102,113,
+25,109,96,76,123,68,27,11,199,10,251,36,252,178,5,11,95,248,193,194,29,151,
+184,157,157,174,142,25,151,6,11,140,150,190,29,11,30,119,164,131,162,131,
+193,112,142,24,117,251,58,5,166,6,151,143,151,147,152,27,11,247,102,220,116,
+192,251,178,251,19,5,62,7,247,178,251,20,162,191,251,102,221,5,11,193,29,
+14,247,41,29,151,118,29,11,132,25,133,116,5,247,127,6,146,162,5,113,143,128,
+148,157,26,146,140,148,142,11,226,29,110,247,39,29,144,140,146,141,146,30,
+247,22,248,127,11,103,131,25,114,247,88,164,7,93,120,150,163,153,144,154,
+149,156,31,198,241,5,11,123,103,135,8,131,89,10,247,159,118,29,110,6,114,
+140,121,155,11,132,31,128,127,135,128,126,26,108,164,115,172,172,163,163,
+172,195,81,178,55,11,136,8,118,247,70,160,7,108,142,136,140,131,143,8,133,
+143,137,146,172,26,11,247,40,29,127,123,144,150,113,31,157,98,107,147,114,
+27,82,11,202,196,214,184,114,188,83,204,31,101,184,121,169,162,26,171,160,
+160,171,185,11,85,104,119,119,122,27,131,133,146,149,151,150,187,153,184,
+31,217,247,160,5,11,106,81,103,130,94,125,108,31,80,113,103,116,68,27,126,
+127,140,140,122,31,11,119,117,100,138,25,132,89,10,247,147,118,29,127,6,113,
+126,11,22,210,29,14,131,89,10,247,165,6,11,157,26,166,247,5,10,137,158,86,
+11,73,21,98,106,106,99,98,172,106,180,179,172,172,179,180,106,172,99,31,11,
+247,22,247,21,191,195,247,13,31,247,45,10,11,89,10,161,6,165,138,156,123,
+113,26,134,138,132,137,133,30,11,21,73,108,247,22,29,138,133,139,11,21,169,
+164,114,109,109,114,114,109,110,113,164,168,170,164,164,169,31,11,30,127,
+89,10,247,147,247,43,10,11,116,247,19,251,178,5,216,6,247,20,247,178,86,162,
+58,251,102,5,11,247,9,29,108,174,11,6,231,142,202,94,145,64,8,157,6,180,247,
+46,5,252,111,6,11,135,115,133,117,30,251,15,252,85,123,86,127,128,87,131,
+25,114,11,50,201,77,230,183,182,155,168,173,30,165,161,155,158,174,189,8,
+11,92,224,62,243,29,11,247,52,10,160,126,145,130,126,26,107,11,109,115,116,
+109,108,164,114,169,168,163,163,169,169,114,164,110,31,11,133,31,96,128,6,
+38,183,91,232,234,203,197,241,156,30,14,27,115,118,118,115,123,151,123,247,
+0,10,127,94,121,121,105,136,25,11,30,247,23,248,127,151,184,11,125,129,70,
+134,25,114,247,214,164,7,74,142,127,146,176,26,11,247,44,29,66,44,26,251,
+8,184,11,247,45,29,200,247,109,5,148,6,11,30,166,135,179,247,93,5,109,6,121,
+130,125,131,118,27,128,11,163,26,188,113,165,92,102,103,124,113,112,30,102,
+104,120,115,11,177,199,141,143,158,26,158,122,152,115,124,124,133,130,131,
+30,11,73,144,134,144,126,215,43,248,208,24,114,6,252,8,252,224,11,94,118,
+121,113,127,27,135,136,143,144,144,140,145,144,156,31,11,113,133,116,5,140,
+143,143,139,142,27,159,153,124,117,132,138,11,247,216,247,20,29,14,38,8,66,
+6,130,97,5,212,6,11,126,94,122,121,104,136,25,131,89,10,247,166,6,11,5,72,
+105,122,119,117,27,123,136,150,210,136,31,247,21,11,138,166,27,247,58,246,
+216,247,12,240,65,193,251,31,31,11,27,83,101,190,215,247,2,187,247,66,195,
+233,31,202,176,11,30,218,247,218,5,247,39,6,60,251,213,5,136,126,137,11,31,
+126,236,121,164,80,142,183,149,156,158,175,217,8,166,11,251,74,247,7,10,11,
+169,27,176,161,114,98,107,120,106,88,83,31,110,107,120,11,101,92,93,177,102,
+186,184,177,177,185,185,101,177,93,31,11,92,53,92,120,123,157,161,149,139,
+139,147,169,31,14,5,174,149,151,148,180,27,212,190,123,108,166,31,159,11,
+133,31,81,251,109,5,251,122,6,196,247,104,151,184,11,21,251,3,247,38,5,160,
+123,118,151,120,27,116,118,11,152,210,160,203,31,216,166,163,170,175,27,176,
+157,109,11,31,247,43,248,238,40,127,5,154,61,139,139,117,27,11,164,26,167,
+117,157,107,119,119,131,126,128,30,129,127,11,169,6,168,151,146,145,158,27,
+149,152,136,131,162,31,11,111,6,112,140,122,155,164,26,144,140,146,141,146,
+30,11,116,110,27,111,120,167,179,185,168,247,18,168,215,31,11,247,8,29,153,
+11,97,111,97,118,87,27,125,130,140,143,119,31,14,161,124,31,247,25,50,5,14,
+127,22,151,151,127,6,140,128,21,149,149,129,7,11,247,39,29,145,140,145,141,
+146,30,11,247,44,10,105,136,25,11,149,65,144,98,129,26,98,124,128,75,133,
+30,114,11,154,147,194,140,30,164,251,175,114,7,190,132,142,11,193,247,4,183,
+216,247,254,236,31,191,247,88,5,11,113,133,116,5,140,143,144,139,141,27,160,
+153,124,11,105,103,118,247,57,10,21,251,3,247,39,5,161,123,11,88,26,82,190,
+98,211,219,201,11,145,31,146,149,142,147,149,26,167,120,157,111,11,21,77,
+247,172,7,222,174,146,164,177,31,204,11,27,149,146,134,131,136,138,137,135,
+133,31,131,11,30,117,153,134,137,138,138,131,135,25,129,119,11,31,205,247,
+101,76,124,127,137,251,17,128,25,11,171,30,204,168,161,162,181,26,190,95,
+175,75,11,180,106,195,188,188,164,181,172,30,170,178,172,11,205,247,120,24,
+179,247,24,146,149,194,150,8,11,209,128,142,137,110,26,129,136,123,130,106,
+30,11,99,27,126,134,146,157,151,139,140,146,161,31,11,104,111,109,103,105,
+169,108,172,175,169,168,174,11,251,20,247,178,5,62,6,251,19,251,178,192,11,
+113,26,101,164,117,182,199,180,173,236,197,30,11,117,5,247,166,118,29,117,
+6,113,140,11,179,247,38,29,122,127,102,105,30,251,12,251,22,5,14,6,113,122,
+156,164,146,140,144,140,146,31,11,6,225,247,102,5,62,6,52,251,102,5,11,134,
+247,56,29,11,139,135,137,133,30,251,23,252,127,127,94,11,25,93,109,126,127,
+122,27,131,134,145,150,11,26,75,161,78,177,98,30,100,174,198,117,11,31,231,
+247,240,5,251,10,6,126,89,5,11,166,248,43,21,184,137,148,135,120,26,114,11,
+207,247,70,21,248,1,248,1,252,1,6,11,233,248,21,24,247,42,6,70,251,161,5,
+11,115,74,27,75,106,168,200,134,31,96,6,11,126,94,121,121,104,136,25,11,6,
+178,247,37,5,104,6,11,146,135,8,145,135,143,130,11,152,184,156,157,174,142,
+25,11,97,60,109,8,104,190,7,11,6,145,161,108,137,118,159,117,190,25,11,133,
+30,251,23,252,127,127,94,121,121,11,247,183,201,251,172,6,56,104,132,114,
+11,21,82,6,252,63,253,70,5,196,6,11,25,124,128,126,130,129,27,131,133,146,
+11,154,110,110,26,132,138,131,138,129,30,11,30,76,79,21,177,101,156,109,109,
+26,11,157,117,103,71,109,251,21,106,68,31,11,51,122,92,132,65,133,25,112,
+7,140,11,102,112,111,101,115,148,125,166,120,30,11,107,97,97,170,107,181,
+181,172,171,181,11,236,228,247,5,190,112,189,94,171,31,11,115,73,27,75,107,
+168,200,133,31,96,11,126,26,123,145,127,154,128,30,14,163,179,183,158,170,
+182,165,30,14,133,138,137,129,31,14,183,29,14,167,29,128,166,11,182,29,131,
+11,230,29,14,247,108,245,10,11,109,10,14,104,110,110,102,131,29,14,240,29,
+226,29,11,249,106,21,161,29,11,136,10,247,130,22,247,44,226,5,169,11,97,10,
+14,114,7,98,29,11,180,29,226,29,11,136,25,195,10,143,29,11,96,29,14,91,10,
+14,70,29,14,162,29,139,135,137,97,10,11,48,10,14,};
+#endif
@@ -0,0 +1,3061 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusRoman_Italic_cff_size = 63196;
+asm(".section .rodata");
+asm(".global fz_font_NimbusRoman_Italic_cff");
+asm(".type fz_font_NimbusRoman_Italic_cff STT_OBJECT");
+asm(".size fz_font_NimbusRoman_Italic_cff, 63196");
+asm(".balign 64");
+asm("fz_font_NimbusRoman_Italic_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusRoman-Italic.cff\"");
+#else
+const int fz_font_NimbusRoman_Italic_cff_size = 63196;
+const char fz_font_NimbusRoman_Italic_cff[] = {
+1,0,4,2,0,1,1,1,19,78,105,109,98,117,115,82,111,109,97,110,45,73,116,97,108,
+105,99,0,1,1,1,65,250,26,0,250,27,1,250,28,12,0,250,29,2,250,30,3,248,24,
+4,30,225,90,80,0,0,0,0,0,255,12,2,34,12,3,251,61,251,162,250,209,250,75,5,
+29,0,76,157,9,13,28,52,135,15,28,52,157,17,174,29,0,0,217,197,18,2,4,2,0,
+1,0,3,0,9,0,16,0,22,0,28,0,38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,
+0,111,0,117,0,123,0,136,0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,
+202,0,209,0,216,0,227,0,238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,
+72,1,84,1,96,1,103,1,115,1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,
+1,177,1,184,1,190,1,196,1,206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,
+2,13,2,19,2,25,2,38,2,44,2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,
+2,124,2,135,2,144,2,151,2,162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,
+239,2,251,3,2,3,14,3,20,3,27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,
+3,93,3,100,3,109,3,118,3,131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,
+189,3,200,3,206,3,212,3,216,3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,
+4,43,4,46,4,50,4,62,4,73,4,79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,
+4,135,4,142,4,151,4,163,4,168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,
+217,4,223,4,232,4,242,4,251,5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,
+81,5,88,5,94,5,108,5,117,5,127,5,136,5,141,5,152,5,160,5,168,5,176,5,181,
+5,193,5,203,5,211,5,222,5,229,5,237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,
+63,6,70,6,83,6,91,6,103,6,112,6,121,6,128,6,137,6,146,6,157,6,171,6,182,6,
+191,6,196,6,210,6,222,6,236,6,248,7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,
+7,82,7,88,7,98,7,104,7,110,7,115,7,122,7,134,7,142,7,151,7,158,7,165,7,179,
+7,184,7,188,7,193,7,200,7,207,7,211,7,214,7,219,7,223,7,228,7,234,7,236,7,
+238,7,240,7,247,7,249,7,252,8,1,8,4,8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,
+41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,8,80,8,87,8,89,8,91,8,98,8,100,8,103,
+8,108,8,111,8,118,8,121,8,124,8,127,8,132,8,139,8,145,8,149,8,155,8,167,8,
+182,8,187,8,200,8,210,8,222,8,230,8,239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,
+9,74,9,83,9,95,9,105,9,117,9,134,9,154,9,163,9,172,9,181,9,190,9,199,9,208,
+9,217,9,226,9,235,9,244,9,253,10,6,10,15,10,24,10,33,10,42,10,51,10,60,10,
+69,10,78,10,87,10,96,10,105,10,114,10,123,10,132,10,141,10,150,10,159,10,
+168,10,177,10,186,10,195,10,204,10,213,10,222,10,229,10,236,10,245,10,254,
+11,7,11,16,11,25,11,32,11,39,11,46,11,53,11,60,11,69,11,76,11,83,11,92,11,
+101,11,110,11,119,11,128,11,137,11,144,11,151,11,158,11,165,11,172,11,179,
+11,186,11,193,11,200,11,207,11,214,11,221,11,228,11,235,11,242,11,249,12,
+0,12,9,12,18,12,27,12,36,12,45,12,54,12,63,12,72,12,81,12,90,12,99,12,108,
+12,117,12,126,12,135,12,144,12,153,12,162,12,171,12,180,12,189,12,198,12,
+207,12,216,12,225,12,234,12,243,12,252,13,5,13,14,13,23,13,32,13,41,13,50,
+13,59,13,68,13,77,13,86,13,95,13,102,13,111,13,120,13,127,13,134,13,143,13,
+150,13,157,13,164,13,173,13,182,13,191,13,200,13,209,13,218,13,225,13,232,
+13,239,13,246,13,253,14,4,14,11,14,18,14,25,14,32,14,39,14,46,14,53,14,60,
+14,67,14,74,14,81,14,88,14,95,14,102,14,109,14,116,14,123,14,130,14,137,14,
+144,14,151,14,158,14,165,14,172,14,179,14,186,14,193,14,200,14,207,14,214,
+14,221,14,228,14,235,14,242,14,249,15,0,15,7,15,14,15,21,15,28,15,35,15,42,
+15,49,15,56,15,63,15,70,15,77,15,84,15,91,15,98,15,105,15,112,15,119,15,126,
+15,133,15,140,15,147,15,154,15,161,15,168,15,178,15,185,15,192,15,196,15,
+250,16,58,16,77,16,89,73,74,65,98,114,101,118,101,65,111,103,111,110,101,
+107,67,97,99,117,116,101,67,99,97,114,111,110,67,100,111,116,97,99,99,101,
+110,116,68,99,97,114,111,110,68,99,114,111,97,116,69,99,97,114,111,110,69,
+100,111,116,97,99,99,101,110,116,69,111,103,111,110,101,107,71,98,114,101,
+118,101,71,100,111,116,97,99,99,101,110,116,73,100,111,116,97,99,99,101,110,
+116,76,97,99,117,116,101,76,99,97,114,111,110,78,97,99,117,116,101,78,99,
+97,114,111,110,79,104,117,110,103,97,114,117,109,108,97,117,116,82,97,99,
+117,116,101,82,99,97,114,111,110,83,97,99,117,116,101,83,99,101,100,105,108,
+108,97,84,99,97,114,111,110,85,114,105,110,103,85,104,117,110,103,97,114,
+117,109,108,97,117,116,90,97,99,117,116,101,90,100,111,116,97,99,99,101,110,
+116,65,109,97,99,114,111,110,117,110,105,48,50,49,65,67,99,105,114,99,117,
+109,102,108,101,120,87,99,105,114,99,117,109,102,108,101,120,87,100,105,101,
+114,101,115,105,115,89,99,105,114,99,117,109,102,108,101,120,72,98,97,114,
+69,109,97,99,114,111,110,71,99,105,114,99,117,109,102,108,101,120,72,99,105,
+114,99,117,109,102,108,101,120,73,109,97,99,114,111,110,73,111,103,111,110,
+101,107,74,99,105,114,99,117,109,102,108,101,120,75,99,111,109,109,97,97,
+99,99,101,110,116,76,99,111,109,109,97,97,99,99,101,110,116,78,99,111,109,
+109,97,97,99,99,101,110,116,79,109,97,99,114,111,110,82,99,111,109,109,97,
+97,99,99,101,110,116,83,99,105,114,99,117,109,102,108,101,120,71,99,111,109,
+109,97,97,99,99,101,110,116,85,109,97,99,114,111,110,85,111,103,111,110,101,
+107,69,98,114,101,118,101,73,98,114,101,118,101,105,106,108,111,110,103,115,
+97,98,114,101,118,101,97,111,103,111,110,101,107,99,97,99,117,116,101,99,
+99,97,114,111,110,99,100,111,116,97,99,99,101,110,116,100,99,97,114,111,110,
+100,99,114,111,97,116,101,99,97,114,111,110,101,100,111,116,97,99,99,101,
+110,116,101,111,103,111,110,101,107,103,98,114,101,118,101,103,100,111,116,
+97,99,99,101,110,116,108,97,99,117,116,101,108,99,97,114,111,110,110,97,99,
+117,116,101,110,99,97,114,111,110,111,104,117,110,103,97,114,117,109,108,
+97,117,116,114,97,99,117,116,101,115,97,99,117,116,101,115,99,105,114,99,
+117,109,102,108,101,120,115,99,111,109,109,97,97,99,99,101,110,116,116,99,
+97,114,111,110,117,114,105,110,103,117,104,117,110,103,97,114,117,109,108,
+97,117,116,122,97,99,117,116,101,122,100,111,116,97,99,99,101,110,116,104,
+98,97,114,117,110,105,48,50,49,66,119,99,105,114,99,117,109,102,108,101,120,
+119,100,105,101,114,101,115,105,115,97,109,97,99,114,111,110,121,99,105,114,
+99,117,109,102,108,101,120,99,99,105,114,99,117,109,102,108,101,120,101,109,
+97,99,114,111,110,103,99,105,114,99,117,109,102,108,101,120,105,98,114,101,
+118,101,105,109,97,99,114,111,110,106,99,105,114,99,117,109,102,108,101,120,
+107,99,111,109,109,97,97,99,99,101,110,116,108,99,111,109,109,97,97,99,99,
+101,110,116,110,99,111,109,109,97,97,99,99,101,110,116,111,109,97,99,114,
+111,110,114,99,111,109,109,97,97,99,99,101,110,116,117,98,114,101,118,101,
+117,109,97,99,114,111,110,117,111,103,111,110,101,107,114,99,97,114,111,110,
+115,99,101,100,105,108,108,97,103,99,111,109,109,97,97,99,99,101,110,116,
+69,117,114,111,112,101,115,101,116,97,108,105,114,97,102,114,97,110,99,117,
+110,105,48,51,56,55,117,110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,
+105,105,48,48,50,48,56,97,102,105,105,54,49,50,52,56,113,117,111,116,101,
+114,101,118,101,114,115,101,100,117,110,105,50,50,49,53,117,110,105,48,50,
+67,57,97,114,105,110,103,97,99,117,116,101,104,99,105,114,99,117,109,102,
+108,101,120,101,98,114,101,118,101,105,111,103,111,110,101,107,108,100,111,
+116,111,98,114,101,118,101,111,115,108,97,115,104,97,99,117,116,101,105,116,
+105,108,100,101,117,116,105,108,100,101,76,100,111,116,79,98,114,101,118,
+101,83,99,111,109,109,97,97,99,99,101,110,116,84,99,111,109,109,97,97,99,
+99,101,110,116,116,99,111,109,109,97,97,99,99,101,110,116,85,98,114,101,118,
+101,65,114,105,110,103,97,99,117,116,101,79,115,108,97,115,104,97,99,117,
+116,101,65,69,97,99,117,116,101,69,110,103,84,98,97,114,101,110,103,116,98,
+97,114,107,103,114,101,101,110,108,97,110,100,105,99,110,97,112,111,115,116,
+114,111,112,104,101,85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,
+105,108,100,101,87,103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,
+118,101,119,97,99,117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,
+117,110,105,50,48,48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,
+99,101,105,110,118,115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,
+105,97,109,111,110,100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,
+101,109,97,108,101,109,117,115,105,99,97,108,110,111,116,101,115,117,110,
+105,110,118,98,117,108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,
+114,99,108,101,102,105,108,108,101,100,114,101,99,116,102,105,108,108,101,
+100,98,111,120,117,110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,
+114,111,119,114,105,103,104,116,97,114,114,111,119,108,101,102,116,97,114,
+114,111,119,98,111,116,104,97,114,114,111,119,117,112,97,114,114,111,119,
+100,111,119,110,97,114,114,111,119,117,112,100,110,97,114,114,111,119,117,
+112,100,110,98,115,101,108,111,122,101,110,103,101,116,114,105,97,103,100,
+110,72,49,56,53,51,51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,
+97,110,103,108,101,108,101,102,116,97,110,103,108,101,114,105,103,104,116,
+117,110,105,118,101,114,115,97,108,97,108,101,112,104,101,120,105,115,116,
+101,110,116,105,97,108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,
+117,114,103,114,97,100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,
+100,98,108,100,111,119,110,97,114,114,111,119,100,98,108,117,112,110,111,
+116,101,113,117,97,108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,
+105,99,97,108,105,110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,
+116,112,105,110,116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,
+113,117,97,108,108,101,115,115,101,113,117,97,108,103,114,101,97,116,101,
+114,101,113,117,97,108,114,101,118,108,111,103,105,99,97,108,110,111,116,
+117,110,105,111,110,105,110,116,101,114,115,101,99,116,105,111,110,101,108,
+101,109,101,110,116,112,101,114,112,101,110,100,105,99,117,108,97,114,105,
+110,102,105,110,105,116,121,112,114,111,112,111,114,116,105,111,110,97,108,
+99,111,110,103,114,117,101,110,116,116,104,101,114,101,102,111,114,101,112,
+114,111,100,117,99,116,115,117,109,109,97,116,105,111,110,97,102,105,105,
+54,49,50,56,57,112,97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,
+101,109,117,108,116,105,112,108,121,119,101,105,101,114,115,116,114,97,115,
+115,110,111,116,115,117,98,115,101,116,97,110,103,108,101,112,114,111,112,
+101,114,115,117,112,101,114,115,101,116,112,114,111,112,101,114,115,117,98,
+115,101,116,114,101,102,108,101,120,115,117,112,101,114,115,101,116,114,101,
+102,108,101,120,115,117,98,115,101,116,110,111,116,101,108,101,109,101,110,
+116,97,114,114,111,119,100,98,108,108,101,102,116,97,114,114,111,119,100,
+98,108,114,105,103,104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,
+110,100,101,114,115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,
+109,112,116,121,115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,
+52,51,72,49,56,53,53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,
+117,116,101,115,101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,
+50,54,97,115,116,101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,
+97,116,101,115,116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,
+114,105,97,103,108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,
+65,108,112,104,97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,
+69,112,115,105,108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,
+116,97,75,97,112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,
+99,114,111,110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,
+108,111,110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,
+112,104,97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,
+105,108,111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,
+97,107,97,112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,
+120,105,111,109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,
+116,97,117,117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,
+111,109,101,103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,
+105,49,111,109,101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,
+117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,
+115,100,105,101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,
+116,111,110,111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,
+97,116,111,110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,
+111,110,116,111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,
+115,105,108,111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,
+115,105,115,85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,
+108,112,104,97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,
+111,115,101,116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,
+111,109,105,99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,
+110,111,115,117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,
+100,105,101,114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,
+110,100,105,101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,
+48,48,49,55,97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,
+102,105,105,49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,
+48,48,50,50,97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,
+102,105,105,49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,
+48,48,50,57,97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,
+102,105,105,49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,
+48,48,51,52,97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,
+102,105,105,49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,
+48,48,51,57,97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,
+102,105,105,49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,
+48,48,52,54,97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,
+102,105,105,49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,
+48,48,52,57,97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,
+102,105,105,49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,
+48,48,53,53,117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,
+49,48,48,53,55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,
+97,102,105,105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,
+52,69,56,117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,
+68,56,117,110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,
+52,57,50,117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,
+105,49,48,48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,
+53,54,97,102,105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,
+105,48,52,69,50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,
+48,52,57,65,117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,
+52,66,56,117,110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,
+48,68,117,110,105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,
+52,117,110,105,48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,
+117,110,105,48,52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,
+48,54,54,97,102,105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,
+105,105,49,48,48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,
+48,55,50,97,102,105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,
+105,105,49,48,48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,
+48,55,56,97,102,105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,
+105,105,49,48,48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,
+48,56,51,97,102,105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,
+105,105,49,48,48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,
+48,56,56,97,102,105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,
+105,105,49,48,48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,
+48,57,53,97,102,105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,
+105,105,49,48,48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,
+49,48,49,97,102,105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,
+105,105,49,48,49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,
+49,48,55,97,102,105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,
+110,105,48,52,69,57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,
+57,48,117,110,105,48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,
+56,52,54,117,110,105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,
+66,49,97,102,105,105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,
+105,105,49,48,49,48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,
+49,48,57,97,102,105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,
+48,52,69,70,117,110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,
+52,65,51,117,110,105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,
+66,55,117,110,105,48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,
+51,117,110,105,48,52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,
+117,110,105,48,52,65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,
+110,105,50,49,49,69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,
+105,50,48,68,68,117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,
+50,49,50,48,117,110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,
+49,50,70,117,110,105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,
+57,54,117,110,105,50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,
+57,117,110,105,50,49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,
+117,110,105,50,50,48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,
+110,105,50,50,50,53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,
+105,50,50,50,69,117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,
+50,50,54,50,117,110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,
+50,56,53,117,110,105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,
+57,57,117,110,105,50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,
+52,117,110,105,50,50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,
+117,110,105,50,53,54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,
+110,105,50,53,66,57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,
+105,50,53,67,54,117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,
+116,117,110,105,51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,
+87,41,43,43,44,67,111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,
+32,40,85,82,87,41,43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,
+108,111,112,109,101,110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,
+87,41,43,43,44,67,111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,
+32,40,85,82,87,41,43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,
+108,111,112,109,101,110,116,78,105,109,98,117,115,32,82,111,109,97,110,32,
+73,116,97,108,105,99,78,105,109,98,117,115,32,82,111,109,97,110,1,26,2,0,
+1,0,17,0,27,0,70,0,152,1,35,1,207,2,8,2,120,2,127,2,131,2,255,3,12,3,121,
+3,222,3,225,3,230,3,240,4,48,4,52,4,107,4,214,5,17,5,156,6,36,6,170,6,175,
+7,28,7,121,7,242,8,103,8,157,8,203,9,48,9,74,9,179,9,203,10,47,10,58,10,152,
+10,233,11,65,11,121,11,203,11,249,12,35,12,64,12,70,12,100,12,176,12,215,
+12,243,13,29,13,100,13,115,13,139,13,183,13,211,13,218,14,11,14,40,14,101,
+14,141,14,175,14,212,14,223,14,246,15,3,15,12,15,61,15,109,15,126,15,161,
+15,208,15,254,16,44,16,89,16,134,16,142,16,177,16,214,17,0,17,19,17,59,17,
+99,17,138,17,167,17,178,17,182,17,218,17,252,18,31,18,59,18,94,18,127,18,
+146,18,180,18,214,18,230,19,7,19,40,19,45,19,77,19,102,19,134,19,156,19,187,
+19,198,19,222,19,252,20,20,20,49,20,78,20,100,20,129,20,158,20,186,20,212,
+20,231,21,0,21,26,21,36,21,41,21,51,21,56,21,61,21,85,21,110,21,116,21,139,
+21,153,21,160,21,184,21,208,21,232,22,0,22,12,22,22,22,38,22,61,22,84,22,
+106,22,121,22,134,22,154,22,176,22,195,22,216,22,235,22,254,23,10,23,14,23,
+23,23,32,23,52,23,65,23,85,23,105,23,125,23,145,23,165,23,176,23,181,23,199,
+23,205,23,209,23,217,23,221,23,228,23,238,24,1,24,10,24,21,24,26,24,44,24,
+62,24,80,24,91,24,109,24,127,24,145,24,163,24,181,24,190,24,194,24,211,24,
+228,24,245,25,6,25,23,25,40,25,57,25,72,25,82,25,92,25,108,25,124,25,140,
+25,156,25,172,25,188,25,202,25,217,25,232,25,247,26,6,26,21,26,36,26,51,26,
+66,26,79,26,93,26,107,26,121,26,135,26,149,26,163,26,177,26,191,26,205,26,
+217,26,226,26,235,26,248,27,5,27,18,27,31,27,44,27,57,27,70,27,83,27,96,27,
+109,27,122,27,135,27,148,27,161,27,174,27,187,27,198,27,205,27,217,27,229,
+27,241,27,253,28,9,28,21,28,33,28,45,28,57,28,69,28,81,28,91,28,99,28,105,
+28,116,28,127,28,138,28,149,28,160,28,171,28,182,28,193,28,204,28,215,28,
+226,28,237,28,248,29,3,29,14,29,25,29,36,29,47,29,58,29,69,29,75,29,79,29,
+83,29,99,29,106,29,110,29,131,29,138,249,14,215,29,142,29,248,143,7,201,247,
+54,68,29,5,11,64,29,251,0,124,72,247,21,29,11,248,200,155,21,105,29,247,112,
+6,159,251,23,5,140,130,140,130,131,26,101,125,130,75,133,30,123,247,138,7,
+252,25,247,154,21,247,42,247,152,183,251,152,5,11,247,250,247,1,21,80,67,
+108,123,95,27,83,102,175,194,154,141,153,147,171,31,167,143,5,247,42,160,
+245,215,225,26,181,109,165,89,251,36,251,49,251,56,251,43,58,193,83,217,210,
+216,180,206,198,30,251,110,247,47,21,228,173,213,216,190,27,160,153,124,115,
+108,120,103,108,109,31,102,104,101,121,53,118,8,11,154,248,36,21,142,151,
+147,140,150,27,180,158,123,85,159,31,166,65,191,251,106,101,26,123,132,123,
+125,120,30,111,102,116,111,127,126,8,117,118,128,131,126,27,132,133,142,147,
+128,31,151,124,129,144,127,27,117,122,122,117,113,160,121,169,203,247,22,
+247,41,247,91,247,1,31,207,247,15,167,211,188,26,169,114,164,109,116,123,
+124,117,123,147,129,159,126,30,158,128,146,130,125,26,99,103,62,53,251,34,
+30,119,247,8,5,228,124,83,247,56,124,27,135,6,138,137,136,139,135,27,131,
+138,102,133,86,129,134,138,126,136,125,137,8,11,248,108,248,41,21,78,6,136,
+134,141,145,131,31,157,112,106,149,101,27,251,3,49,62,45,87,160,109,197,113,
+31,80,99,121,119,115,26,126,147,127,158,125,30,40,74,121,119,93,26,70,205,
+94,240,247,18,223,198,226,202,92,182,43,165,30,95,150,113,155,154,26,154,
+162,165,152,141,141,139,138,142,30,137,148,150,138,150,27,231,232,220,217,
+156,136,156,133,161,31,189,6,251,216,251,230,21,140,141,138,138,141,31,142,
+138,149,136,155,134,8,246,105,175,112,93,26,85,81,99,62,59,92,177,203,163,
+145,156,155,158,30,157,153,180,171,147,27,247,40,248,27,21,176,158,115,92,
+103,127,96,120,105,31,98,117,108,117,105,27,101,117,167,186,231,196,219,204,
+31,11,247,217,248,77,21,96,100,128,117,98,31,36,81,67,251,7,33,26,52,195,
+86,230,205,203,168,197,197,30,205,204,179,223,215,26,222,81,196,54,30,127,
+118,21,182,167,102,82,65,107,40,94,74,31,86,102,178,29,11,248,96,247,9,21,
+71,85,127,128,123,27,130,132,146,148,147,143,158,149,175,31,196,247,98,5,
+144,160,143,161,153,26,176,247,57,29,206,247,110,136,141,86,128,117,135,52,
+123,25,123,7,190,138,152,133,119,26,133,138,133,138,134,30,43,251,242,5,214,
+6,186,247,50,148,161,183,207,8,231,199,190,189,176,27,154,148,128,121,127,
+133,106,131,108,31,95,251,57,5,126,87,136,126,129,26,101,153,123,172,184,
+164,159,232,209,30,11,247,114,247,6,77,29,11,131,94,29,11,248,203,155,21,
+95,142,119,156,120,191,46,247,137,24,216,156,172,153,175,171,8,172,168,157,
+178,184,26,232,65,190,251,26,30,251,140,123,6,181,133,144,138,149,132,8,147,
+134,145,127,128,26,127,134,115,132,112,30,251,15,252,78,121,80,132,133,83,
+130,25,123,247,136,155,7,77,147,133,143,174,26,149,141,149,149,176,30,195,
+247,101,204,134,247,15,251,216,5,247,40,6,251,151,248,231,21,160,145,152,
+146,171,27,222,180,102,63,41,75,88,251,17,121,131,140,143,114,31,11,21,111,
+117,118,112,161,29,247,92,22,247,63,29,188,247,189,21,188,162,177,184,159,
+27,147,145,132,128,132,137,132,134,119,31,96,251,54,5,131,110,135,112,117,
+26,76,188,93,206,208,205,189,222,181,30,173,207,164,238,209,26,188,116,174,
+105,115,119,119,113,122,144,128,158,111,30,164,104,146,120,110,26,99,120,
+80,109,88,30,80,104,93,104,97,27,104,116,169,183,159,146,179,150,181,31,179,
+247,40,5,142,151,143,165,150,26,171,119,163,112,91,88,90,49,95,30,11,248,
+210,248,141,21,32,252,36,121,70,120,122,78,138,25,134,121,5,247,151,6,144,
+157,5,84,140,122,150,170,26,150,141,151,143,155,30,247,15,248,93,5,211,157,
+158,154,182,29,167,146,247,5,29,120,26,133,139,135,137,129,30,252,19,252,
+47,243,248,24,109,29,194,138,156,129,106,26,129,137,124,247,66,29,111,140,
+132,139,128,143,25,123,144,129,154,156,26,150,141,151,142,152,30,11,78,29,
+14,247,242,85,29,11,21,103,6,251,34,34,49,247,23,29,247,13,22,191,247,63,
+156,180,185,216,8,195,173,166,170,156,27,146,143,135,129,144,31,122,147,147,
+134,159,27,169,155,157,171,247,33,29,96,99,81,123,99,125,103,24,192,247,109,
+136,141,66,126,130,137,66,127,25,122,7,143,161,143,205,29,11,21,170,160,29,
+248,242,215,29,252,122,6,93,251,38,158,134,182,231,174,158,247,23,143,25,
+247,63,6,252,115,252,239,5,125,248,141,7,193,247,60,120,142,87,251,3,97,116,
+251,48,138,25,251,53,6,248,119,248,239,5,11,21,247,161,6,79,251,117,121,69,
+120,123,73,138,25,134,121,5,247,158,6,144,157,5,115,125,183,29,156,26,152,
+141,151,143,154,247,24,29,211,158,157,154,208,27,144,157,5,251,160,132,29,
+192,158,128,109,126,137,126,135,125,31,87,251,88,5,251,161,6,190,247,82,109,
+29,163,152,138,135,148,31,155,133,149,125,123,26,126,137,126,135,125,99,29,
+144,157,5,115,126,183,29,155,26,149,141,155,143,154,30,14,247,153,247,241,
+21,91,29,130,137,137,120,123,30,251,171,251,126,190,247,83,157,210,158,154,
+204,140,25,144,157,5,251,159,132,29,171,152,137,134,149,31,152,133,147,126,
+123,26,129,137,125,135,124,30,251,15,252,94,125,29,11,249,29,249,42,21,252,
+140,123,6,202,133,155,131,111,26,127,134,108,133,118,30,251,13,252,85,122,
+81,132,132,82,129,25,123,248,150,7,201,247,56,122,147,93,74,112,113,95,119,
+25,121,102,71,129,61,27,83,115,149,163,152,150,187,163,227,31,144,154,152,
+190,152,190,187,136,24,185,138,168,138,163,135,147,132,25,148,132,141,132,
+117,26,121,138,129,134,116,30,159,134,206,247,127,120,144,102,52,129,133,
+48,135,25,126,107,138,138,103,31,204,247,129,5,162,145,149,142,198,27,247,
+51,174,125,78,123,139,127,138,122,31,160,137,5,11,248,64,248,190,21,105,6,
+84,251,6,5,140,131,135,139,131,27,251,33,251,42,251,52,251,43,100,152,103,
+163,114,31,154,123,152,131,170,129,75,251,23,24,174,6,200,247,18,5,138,145,
+145,138,147,27,201,199,166,191,196,31,209,204,183,228,214,26,167,131,171,
+126,161,30,121,169,120,153,98,151,8,251,122,252,42,21,120,158,130,160,167,
+26,234,184,247,4,205,209,30,168,166,174,156,172,27,142,141,138,138,144,31,
+168,127,21,158,118,148,114,104,26,65,107,40,94,74,30,86,102,102,115,94,27,
+130,134,140,142,131,31,11,248,99,247,3,21,76,84,129,131,122,27,129,131,147,
+151,155,170,247,10,173,247,4,31,162,219,159,212,195,247,111,134,144,24,87,
+128,103,134,74,132,8,122,7,194,137,146,136,118,26,125,138,136,125,86,30,95,
+251,56,5,181,131,121,155,100,27,251,22,251,54,251,80,251,42,68,179,96,204,
+207,183,171,239,207,31,128,88,137,124,116,26,112,156,121,164,181,192,180,
+212,190,30,251,56,247,209,21,169,137,154,120,103,26,251,44,35,251,64,47,104,
+116,165,179,221,189,247,9,205,209,30,167,168,176,158,167,137,8,11,248,101,
+59,29,14,21,251,139,123,6,197,132,151,131,111,26,124,136,119,131,112,30,93,
+251,56,5,251,177,6,193,247,87,154,190,165,158,199,143,25,155,251,165,123,
+7,202,133,153,131,110,200,29,123,247,138,155,7,79,147,128,146,168,26,146,
+140,147,141,146,30,205,247,136,5,247,177,6,74,251,128,123,87,119,124,74,132,
+25,123,247,165,155,7,74,145,126,147,168,26,148,140,145,141,147,30,247,24,
+248,117,156,197,147,145,196,149,25,14,247,9,21,128,29,247,12,248,84,134,144,
+79,125,100,133,81,132,25,123,7,165,140,5,162,140,157,128,124,26,125,134,115,
+130,110,30,138,137,135,125,134,118,251,27,252,148,24,214,6,179,247,46,152,
+173,179,200,8,218,191,207,201,174,27,154,152,127,126,135,136,126,135,123,
+31,84,251,99,5,126,90,132,108,127,26,113,156,123,167,189,174,166,226,199,
+30,11,187,247,218,21,229,6,74,251,128,122,81,131,133,83,129,25,123,247,145,
+7,247,9,246,170,195,216,31,236,210,196,247,2,247,8,26,247,56,251,6,244,251,
+70,30,251,170,123,6,202,133,153,131,112,26,124,135,114,132,115,30,93,251,
+56,5,49,6,247,235,22,251,45,6,202,247,118,5,161,145,155,146,182,27,247,28,
+214,63,251,31,251,1,97,251,3,71,71,31,79,80,58,109,35,27,93,120,150,165,151,
+142,152,156,201,31,141,147,185,247,56,5,247,45,6,14,248,8,247,203,21,247,
+56,247,118,5,213,192,185,172,191,27,145,157,5,251,115,6,133,121,5,156,6,172,
+158,129,121,128,134,128,123,116,31,251,43,251,106,76,247,106,5,132,161,138,
+144,146,26,166,160,151,182,30,160,6,143,157,5,251,174,6,133,121,5,160,6,184,
+141,165,117,155,86,217,251,142,24,81,251,108,120,66,120,124,64,140,25,133,
+121,5,247,181,6,144,157,5,114,122,140,141,130,31,118,144,127,153,159,26,151,
+141,152,143,154,30,11,21,90,127,82,129,97,137,134,120,24,142,155,147,140,
+148,27,158,147,132,121,129,137,128,134,119,31,81,251,109,5,130,106,137,127,
+121,26,98,162,109,171,198,216,209,247,21,223,30,109,251,1,5,90,29,11,247,
+24,29,103,29,181,146,140,148,140,144,31,177,247,33,177,29,106,26,129,137,
+127,135,124,30,105,251,18,5,134,118,137,128,125,26,74,190,103,232,193,193,
+147,158,206,30,11,248,97,247,9,21,73,86,125,126,123,27,132,135,145,150,145,
+139,139,158,211,31,218,247,191,5,65,6,85,251,40,128,114,94,68,247,41,29,154,
+142,139,142,140,142,31,230,247,255,136,141,81,125,102,133,84,132,25,125,7,
+179,138,139,139,149,134,8,144,137,144,130,132,26,130,134,115,130,105,30,102,
+251,34,5,120,65,133,108,121,26,102,157,121,174,210,192,193,247,85,247,7,30,
+109,11,21,76,114,91,103,77,27,75,100,175,202,134,31,110,6,251,0,140,180,89,
+227,27,193,185,167,29,247,22,249,17,21,202,133,153,131,112,26,124,135,115,
+132,114,30,251,15,252,78,121,81,132,133,83,129,25,123,247,145,7,247,9,246,
+170,195,216,31,236,210,196,247,2,247,8,26,247,56,251,6,244,251,70,30,251,
+170,6,247,75,80,21,161,145,154,146,179,27,196,189,126,115,171,31,188,104,
+166,75,61,26,251,2,97,251,3,71,71,30,79,80,58,109,35,27,93,120,150,165,152,
+144,159,156,201,31,11,21,106,128,126,136,29,165,131,118,191,31,129,165,157,
+134,152,27,187,172,175,207,153,31,14,123,147,92,74,113,114,96,119,25,122,
+102,71,129,63,27,83,116,149,163,151,151,186,163,226,31,171,247,7,5,138,155,
+154,138,155,27,185,138,167,138,163,134,146,133,25,148,132,141,132,119,26,
+121,137,127,134,117,30,159,134,207,247,124,121,143,101,54,129,132,49,136,
+25,127,107,138,138,104,31,205,247,125,5,162,145,149,142,197,27,247,48,174,
+126,79,126,138,124,138,122,31,160,137,11,248,64,21,168,29,141,26,145,75,29,
+11,247,110,248,81,21,89,127,83,130,98,136,134,120,24,142,155,146,140,148,
+27,158,147,132,122,128,137,127,134,120,31,48,251,232,5,211,6,197,247,108,
+5,152,140,145,140,139,26,152,150,133,128,146,31,147,129,141,133,152,94,8,
+251,3,172,167,99,185,27,179,173,173,236,196,31,123,148,5,85,105,117,120,111,
+27,116,129,152,193,123,31,119,212,115,171,99,146,11,21,134,251,9,5,79,136,
+128,126,92,27,116,6,135,121,5,247,156,6,144,157,5,116,6,90,124,151,179,144,
+139,139,140,168,247,32,29,92,76,124,128,104,140,25,128,132,29,247,90,6,143,
+157,5,120,6,109,124,148,157,145,143,149,145,148,31,235,247,30,5,247,72,175,
+21,251,47,6,247,57,247,128,5,14,179,247,91,5,116,6,118,125,130,134,117,27,
+126,127,142,147,118,31,148,118,106,144,108,27,35,65,70,41,85,154,110,199,
+75,31,144,135,156,120,156,120,155,122,154,123,147,130,8,186,90,152,113,96,
+26,64,84,81,65,55,77,210,237,146,139,143,141,148,30,119,141,105,251,115,5,
+157,6,162,146,150,149,159,27,150,154,135,130,165,31,11,248,101,21,130,29,
+251,45,247,0,251,0,247,45,242,219,182,245,229,31,122,153,5,51,49,81,109,57,
+27,251,3,75,214,247,22,247,11,187,247,13,217,220,31,188,187,202,167,205,27,
+231,190,85,251,0,149,31,11,21,93,93,99,118,94,27,82,100,183,203,152,140,155,
+141,157,31,217,142,184,148,185,161,8,207,170,182,194,195,26,182,99,170,82,
+251,22,251,29,251,46,251,37,47,193,77,221,201,203,173,206,200,30,251,126,
+247,18,21,247,8,171,208,223,201,27,162,157,120,114,105,117,98,104,109,31,
+102,107,103,127,65,132,8,14,137,142,133,133,136,138,131,133,30,100,89,77,
+88,107,130,8,114,131,132,133,128,26,138,139,137,140,136,30,213,6,67,251,167,
+137,130,138,135,116,29,227,247,225,5,223,6,11,251,59,247,211,21,173,137,161,
+115,104,26,55,88,251,10,71,65,30,112,115,105,122,110,27,103,117,167,185,195,
+176,240,183,202,31,179,197,185,171,180,136,8,11,21,114,106,133,131,129,129,
+8,122,122,124,97,29,79,133,110,119,26,102,155,119,169,186,175,169,223,196,
+30,11,247,142,157,81,29,11,248,193,21,192,29,106,26,128,137,127,135,125,30,
+251,14,252,95,165,29,247,19,29,117,30,129,101,21,141,153,11,164,8,181,167,
+160,172,177,26,182,108,166,89,98,105,121,93,92,30,161,201,68,137,120,96,5,
+175,123,123,150,105,27,251,16,251,48,251,92,251,50,84,174,100,188,203,184,
+176,247,17,225,31,134,122,138,131,124,26,68,183,88,202,202,215,183,207,195,
+30,251,185,247,212,21,166,138,157,119,11,21,115,126,183,29,155,26,149,141,
+155,143,154,30,247,15,248,93,109,29,163,152,138,135,148,31,155,133,149,125,
+123,26,126,137,126,135,125,99,29,11,248,100,247,2,21,111,111,5,107,107,128,
+130,130,27,131,133,145,146,159,181,247,64,186,247,63,100,29,11,31,122,153,
+5,51,49,81,109,57,27,251,3,75,214,247,22,247,11,187,247,13,217,220,31,188,
+187,202,167,205,27,231,190,85,251,0,149,31,157,136,130,29,11,21,247,28,6,
+155,194,5,251,50,6,76,251,23,5,127,7,178,130,152,136,154,133,8,182,121,159,
+110,93,26,76,93,83,87,127,129,143,152,123,30,151,124,129,143,129,27,123,128,
+128,123,116,163,125,181,238,219,216,235,176,125,172,113,163,31,117,160,119,
+149,93,150,8,11,245,21,93,29,44,193,84,232,214,192,169,216,200,30,11,21,174,
+6,247,63,245,5,151,146,144,148,151,26,159,123,155,119,129,131,135,133,132,
+30,14,239,21,104,115,111,114,125,27,131,132,145,145,142,140,144,140,144,31,
+240,248,15,89,127,89,131,92,149,29,126,137,126,129,26,119,154,127,166,172,
+180,170,204,193,30,11,21,224,186,184,194,196,184,29,113,120,145,129,158,122,
+30,154,125,144,131,129,26,112,117,113,86,103,30,14,139,29,111,87,105,30,11,
+135,122,136,121,126,26,114,153,122,161,174,183,174,211,196,30,125,151,5,104,
+111,118,121,126,27,131,134,147,151,146,140,147,141,146,208,29,76,27,123,130,
+151,159,147,140,146,143,153,31,11,247,22,29,123,130,94,135,30,133,121,5,247,
+161,6,145,157,76,138,109,162,148,29,176,140,152,134,126,26,11,130,27,135,
+136,136,135,129,165,84,175,71,31,142,134,147,122,148,121,112,109,117,116,
+123,125,126,127,126,126,126,126,8,103,101,123,116,126,26,135,142,136,142,
+146,162,157,198,206,30,165,162,147,145,196,184,151,147,151,149,151,148,8,
+11,80,84,100,117,90,27,82,105,181,211,224,174,229,195,197,31,169,168,179,
+157,179,27,162,153,131,127,134,137,134,135,130,31,243,29,166,186,247,35,29,
+11,22,247,136,155,6,82,146,128,145,167,26,159,141,149,148,172,30,247,15,248,
+79,157,197,146,145,196,149,25,155,251,139,154,29,11,132,29,194,138,156,129,
+106,26,129,137,125,135,126,99,29,144,157,111,140,132,139,128,143,25,123,144,
+129,154,157,26,150,141,150,143,156,30,11,110,29,151,27,187,172,176,206,153,
+31,14,129,130,27,131,131,146,147,149,142,155,146,157,31,144,157,140,141,5,
+141,7,134,29,11,229,6,51,252,56,5,32,117,106,84,112,29,11,30,251,14,252,94,
+247,3,29,11,31,142,149,140,141,141,148,132,142,24,78,132,136,136,128,91,5,
+176,131,110,160,96,27,251,25,251,45,251,74,251,51,69,177,98,203,209,182,172,
+247,16,227,31,118,57,137,131,114,26,11,31,156,135,208,247,124,121,143,97,
+48,129,134,251,51,138,25,200,247,114,5,172,148,147,143,187,27,247,55,167,
+127,69,132,139,123,138,126,31,156,137,172,247,45,5,252,153,124,6,11,148,131,
+5,144,153,147,141,149,129,29,130,133,138,137,129,31,11,225,29,251,165,6,135,
+121,5,166,147,247,5,29,121,26,128,137,127,135,124,30,84,251,101,5,123,87,
+97,132,97,27,74,106,161,11,247,33,248,157,5,212,158,156,153,213,27,144,157,
+5,251,163,6,133,121,5,194,138,156,129,106,26,129,137,124,135,127,30,251,14,
+252,95,122,71,120,122,77,138,25,134,121,5,11,82,144,133,147,126,212,45,248,
+202,24,113,6,251,182,252,136,60,251,25,129,128,99,131,25,123,247,79,155,7,
+88,144,131,144,164,26,158,142,148,156,173,30,196,247,5,5,11,236,167,189,187,
+210,27,204,183,93,72,55,66,82,32,129,132,139,141,123,31,127,102,5,140,151,
+144,139,148,27,232,192,93,61,41,67,68,41,63,88,176,219,104,31,115,130,11,
+132,122,130,121,67,92,251,67,31,67,103,127,93,211,175,130,105,132,113,134,
+123,25,118,65,5,120,69,132,108,121,26,102,155,120,172,191,173,167,236,204,
+30,126,148,5,11,156,180,27,160,152,133,129,136,138,137,136,135,31,132,132,
+137,134,128,26,114,155,122,164,164,156,156,164,181,97,167,78,83,84,115,100,
+104,30,97,92,119,98,108,37,8,11,5,212,158,157,153,182,29,11,21,106,128,126,
+181,29,114,146,116,27,87,111,110,62,119,31,168,6,171,149,155,154,164,27,156,
+163,132,117,193,31,129,165,158,134,11,252,163,5,251,103,6,247,32,248,157,
+247,60,29,251,163,6,133,121,5,194,138,156,129,107,26,127,137,128,135,124,
+30,251,33,252,163,5,11,97,27,127,131,146,148,143,140,141,142,144,31,143,145,
+140,143,145,26,160,121,156,118,118,123,121,116,104,173,113,184,228,208,237,
+247,77,181,30,211,247,212,5,11,248,242,21,111,117,118,112,161,29,247,92,22,
+111,117,118,112,161,29,11,134,121,5,247,84,6,247,40,189,147,173,192,31,198,
+175,175,202,206,26,209,104,183,63,166,30,191,153,162,149,164,159,8,178,169,
+164,188,184,26,180,11,192,72,217,209,189,172,221,197,30,135,111,138,126,126,
+26,103,155,114,162,178,178,180,233,187,30,251,95,173,21,43,104,97,90,91,27,
+100,118,171,198,11,136,131,25,129,106,132,108,129,26,118,160,123,166,185,
+172,167,232,202,30,126,146,5,76,90,123,123,123,27,130,133,146,152,140,139,
+139,140,143,31,11,103,78,27,75,99,176,201,135,203,29,162,173,124,184,27,192,
+186,163,183,172,31,159,165,148,160,148,182,8,14,249,145,215,29,251,91,123,
+6,145,29,11,22,213,29,14,190,247,82,90,127,82,129,98,137,25,134,120,5,142,
+155,146,140,148,27,158,147,132,122,128,137,127,134,120,31,48,251,232,5,211,
+6,11,27,87,112,110,62,118,31,168,6,171,149,155,154,164,27,156,165,131,118,
+191,31,129,165,157,134,152,27,187,172,175,207,153,31,14,21,251,94,251,54,
+251,53,251,93,251,88,247,54,251,55,247,89,247,89,247,56,247,55,247,88,247,
+88,251,55,247,58,251,85,31,11,247,201,248,78,21,251,20,251,18,251,34,251,
+38,41,247,54,29,195,177,221,221,26,235,81,208,59,30,11,249,206,247,61,21,
+32,67,81,110,251,42,27,109,6,104,123,148,159,151,154,197,188,247,64,31,146,
+163,5,179,6,236,160,130,98,11,122,70,119,122,76,138,25,134,121,5,247,160,
+204,29,103,127,141,144,129,31,126,146,131,152,154,26,152,141,151,142,154,
+30,11,31,122,110,5,123,181,162,134,167,27,209,188,175,189,181,107,165,89,
+11,21,252,160,7,58,247,102,86,116,247,19,251,178,5,216,6,247,20,247,178,86,
+162,58,251,102,5,248,160,7,220,251,102,192,11,72,85,127,127,123,27,130,132,
+147,149,150,155,201,156,191,31,168,232,158,214,164,26,179,112,166,100,74,
+68,74,251,38,46,30,11,190,29,181,162,134,167,27,209,188,175,189,181,107,165,
+89,11,176,247,91,5,118,6,123,131,129,133,119,27,130,128,141,144,118,31,150,
+95,99,145,106,27,251,106,251,84,251,92,251,115,11,108,8,108,120,124,128,114,
+27,125,133,143,148,142,140,141,142,144,31,143,146,140,144,144,26,159,121,
+156,117,119,123,122,116,11,6,134,121,5,11,247,111,247,166,171,179,147,146,
+169,154,25,155,251,81,123,7,187,133,139,139,150,133,8,145,136,143,131,131,
+26,111,93,11,227,247,214,136,141,37,120,120,136,100,247,42,29,131,136,122,
+133,120,30,91,251,69,5,123,11,122,84,117,124,73,134,25,123,247,181,155,7,
+141,123,127,140,131,27,122,140,125,142,129,145,8,132,143,134,149,153,26,11,
+181,29,113,146,117,27,87,111,110,62,119,31,168,6,171,149,155,154,164,27,156,
+11,25,134,120,5,142,155,147,140,148,27,158,147,132,121,129,137,128,134,119,
+31,81,251,109,5,130,106,137,127,121,26,11,203,29,162,173,124,184,27,192,186,
+167,29,21,224,186,184,194,196,184,29,113,121,145,128,158,122,30,154,125,144,
+131,128,26,113,116,11,26,124,135,121,126,92,30,251,10,252,61,121,79,132,133,
+82,131,25,123,247,137,155,7,76,148,134,142,174,26,11,195,195,184,29,113,120,
+145,129,158,122,30,154,125,144,131,129,26,112,117,112,86,104,30,11,252,133,
+123,6,201,133,154,131,112,26,127,133,106,134,120,30,251,15,252,78,122,82,
+131,132,83,129,25,123,11,21,85,94,94,85,83,182,95,196,194,184,184,193,194,
+94,184,83,31,105,4,176,169,110,102,102,110,111,101,11,247,51,29,163,166,116,
+157,104,96,114,118,72,100,31,91,56,106,113,72,131,8,11,192,134,157,128,109,
+26,123,113,39,91,251,63,30,126,90,5,251,56,95,75,71,251,2,27,56,82,186,210,
+11,93,104,119,121,123,27,132,133,145,146,146,139,140,146,165,31,232,247,241,
+5,67,6,251,0,116,46,251,4,11,157,114,31,110,161,177,120,173,27,225,216,247,
+1,247,14,214,105,182,80,31,148,111,21,174,165,102,88,11,89,229,25,251,33,
+247,147,247,156,247,107,182,172,164,149,179,140,25,145,157,5,251,93,132,29,
+11,135,25,134,121,5,141,155,147,140,148,247,30,29,63,251,174,5,136,11,175,
+27,182,174,109,102,107,108,93,77,78,31,251,25,251,22,5,121,247,123,7,172,
+218,5,14,247,114,247,6,21,114,106,133,131,129,129,8,122,121,125,129,130,27,
+131,131,146,147,149,142,155,11,201,29,91,123,105,251,15,126,30,11,248,130,
+163,29,11,123,7,198,131,150,132,111,200,29,11,173,29,132,30,14,21,174,172,
+29,14,21,174,6,247,63,245,5,151,146,144,148,151,26,159,123,155,118,130,131,
+136,132,132,30,14,248,81,21,89,127,84,130,96,136,134,120,24,142,155,147,140,
+148,27,158,147,132,121,129,137,11,212,21,174,172,29,11,6,251,8,247,41,5,155,
+126,128,146,124,27,119,124,124,120,127,145,129,152,129,31,14,111,160,117,
+167,166,161,161,166,164,116,163,114,31,11,21,174,186,29,133,30,11,21,174,
+6,247,63,245,5,151,146,144,148,151,26,159,123,155,119,129,130,135,133,133,
+30,11,167,186,26,192,94,175,72,63,88,98,78,107,151,118,179,103,30,47,104,
+109,108,79,26,11,121,71,120,122,78,138,25,134,121,5,247,150,6,223,202,153,
+167,187,31,201,176,176,200,11,248,131,247,26,21,80,104,112,114,111,27,118,
+128,162,185,145,139,146,140,149,31,247,9,11,163,183,172,31,159,166,148,160,
+148,181,8,14,59,6,167,242,5,140,141,139,141,11,247,43,29,127,137,125,135,
+125,30,251,14,252,94,122,72,11,247,189,21,100,140,129,143,155,26,147,146,
+164,151,179,30,225,247,166,5,141,145,140,11,247,102,220,116,192,251,178,251,
+19,5,62,7,247,178,251,20,162,191,251,102,221,5,11,6,247,63,245,5,151,147,
+144,147,151,26,160,123,154,118,129,131,136,132,133,30,11,21,174,6,247,63,
+245,5,151,224,29,129,131,136,132,11,247,9,29,108,102,110,97,27,94,111,177,
+202,11,30,251,23,252,94,120,70,120,122,76,138,25,134,121,5,247,156,204,29,
+11,248,224,247,5,21,83,79,100,118,96,27,92,116,173,207,161,140,147,146,169,
+31,11,5,212,158,157,153,213,27,143,157,5,251,163,132,29,194,138,156,129,11,
+101,114,96,27,92,108,175,194,213,168,227,188,210,31,196,178,181,168,182,27,
+11,21,111,116,117,112,110,163,116,168,167,161,161,166,167,115,163,111,31,
+14,21,108,115,114,107,109,163,115,169,171,164,163,169,171,114,164,108,31,
+14,128,112,27,124,122,144,153,109,31,156,101,11,212,202,29,11,141,142,130,
+31,123,145,129,153,11,26,179,114,170,106,110,117,119,11,6,203,169,131,116,
+161,31,154,124,149,108,106,26,125,138,121,138,119,30,11,6,247,63,245,5,151,
+224,29,130,130,135,133,11,132,142,147,126,31,153,116,131,142,123,27,107,118,
+120,110,103,167,117,185,11,21,167,170,155,147,165,27,167,161,117,109,94,92,
+109,39,120,31,130,7,11,21,124,112,127,133,101,138,8,251,0,6,137,144,247,6,
+247,2,5,226,11,27,166,158,121,113,113,120,124,105,118,122,143,150,109,31,
+122,110,5,123,11,199,191,5,196,7,251,154,251,114,247,154,251,114,5,196,7,
+79,191,5,11,225,29,251,164,132,29,194,138,156,129,11,112,21,213,29,11,109,
+114,114,107,110,164,114,168,170,165,163,169,170,113,165,109,31,14,21,109,
+114,231,29,11,21,212,29,11,21,90,6,251,49,245,29,11,21,211,29,11,22,102,239,
+29,104,31,11,247,12,29,81,132,133,83,129,25,11,248,86,21,188,6,164,194,5,
+167,198,154,186,163,26,163,127,152,117,11,27,144,157,5,251,164,132,29,11,
+31,110,6,82,147,108,159,113,30,110,11,6,145,157,5,11,140,147,27,161,152,129,
+121,125,139,139,123,71,31,58,251,184,5,11,21,76,114,90,103,77,27,76,99,175,
+202,135,31,110,6,251,0,11,31,156,6,186,247,66,5,252,180,6,92,251,66,5,158,
+6,159,11,247,52,29,251,36,98,251,5,251,49,11,252,168,6,97,251,46,157,135,
+192,247,0,172,156,247,44,137,25,11,92,224,62,172,30,153,105,112,143,70,27,
+251,172,77,247,183,6,11,107,114,115,109,107,165,113,171,170,164,163,170,170,
+113,165,108,31,11,111,117,118,112,112,162,116,167,166,161,160,166,166,116,
+162,112,31,11,114,119,120,115,114,160,118,164,164,158,158,163,164,118,160,
+115,31,11,111,168,176,174,169,169,174,31,14,249,33,21,11,141,123,158,116,
+223,76,247,124,24,247,51,247,83,202,214,171,11,25,144,157,5,251,93,6,133,
+121,5,150,6,163,148,133,123,11,27,240,190,95,53,34,55,65,251,11,119,125,140,
+144,111,31,11,31,144,132,133,141,130,27,114,122,123,117,115,159,124,171,170,
+11,164,26,173,164,161,176,175,163,116,103,107,116,114,94,121,30,11,98,176,
+202,134,31,110,6,140,82,147,107,159,113,8,109,162,11,115,61,141,8,72,6,209,
+247,151,5,243,6,241,178,115,77,11,247,229,249,56,21,88,6,252,91,253,66,5,
+190,6,14,147,144,147,151,26,159,123,155,118,11,212,158,157,153,213,27,144,
+157,5,11,5,194,6,211,171,114,83,126,138,124,137,122,31,156,137,11,135,122,
+31,156,6,182,247,50,5,252,117,6,135,121,5,11,21,140,127,139,139,136,26,117,
+105,120,100,108,110,154,155,11,31,49,251,177,133,124,127,134,92,134,25,123,
+247,73,7,11,247,198,247,158,21,188,251,71,5,141,129,141,128,133,26,11,114,
+107,110,164,114,167,171,165,163,169,170,113,165,109,31,11,239,21,151,151,
+127,6,140,128,21,149,150,129,7,14,6,144,157,5,112,132,140,143,128,31,123,
+144,129,154,11,133,116,31,41,251,227,5,210,6,201,247,105,5,140,11,137,25,
+134,121,5,248,131,6,199,247,80,5,123,6,11,26,74,116,93,95,113,30,122,108,
+100,131,77,27,121,11,159,157,125,124,132,138,137,126,126,31,129,128,134,128,
+11,199,137,144,136,117,26,130,137,128,132,116,30,137,133,11,109,110,103,102,
+168,110,175,176,168,168,176,174,110,169,11,111,153,135,141,24,216,166,163,
+160,178,26,182,98,172,11,159,26,160,129,150,120,98,126,111,33,128,30,14,127,
+22,151,151,127,6,140,128,21,149,149,129,7,11,132,126,137,133,129,26,115,154,
+125,163,167,159,158,11,143,25,155,251,165,123,7,202,133,153,131,110,26,11,
+251,61,5,178,6,247,29,243,221,35,5,175,6,11,27,123,120,247,184,158,122,6,
+85,119,159,194,31,11,190,152,179,159,26,160,129,150,120,98,125,110,34,11,
+87,27,111,119,154,161,173,174,247,22,169,214,31,11,110,26,124,135,114,132,
+115,30,251,15,252,78,121,11,122,71,119,121,78,138,25,134,121,5,247,151,6,
+11,163,184,173,31,159,166,147,161,148,181,8,14,138,135,150,31,155,134,149,
+124,11,21,170,6,251,8,247,41,5,11,5,142,155,146,140,149,27,157,147,132,124,
+128,11,139,139,142,143,8,152,149,151,146,150,27,146,11,21,180,168,97,81,74,
+115,50,104,74,31,82,11,21,77,247,172,7,222,174,146,164,177,31,204,11,149,
+170,146,25,148,140,144,155,5,251,26,6,11,26,124,136,119,131,112,30,251,15,
+252,78,121,11,27,124,134,142,149,142,140,142,142,144,31,143,11,31,134,131,
+138,134,131,26,115,154,123,161,162,11,248,165,21,88,6,252,91,253,66,5,190,
+6,11,178,161,164,178,26,149,138,142,135,159,30,135,11,249,49,249,102,21,95,
+6,87,61,5,155,101,11,77,138,25,134,121,5,247,151,6,144,157,5,11,206,26,247,
+1,51,207,251,35,123,129,138,137,11,247,17,247,16,21,248,103,248,103,252,103,
+6,11,117,26,108,157,122,169,186,161,158,237,208,30,11,247,35,251,141,5,150,
+120,145,122,127,26,118,11,244,5,102,6,235,251,61,5,185,6,14,30,247,14,248,
+93,5,11,6,219,247,104,5,78,6,59,251,104,5,11,6,133,112,125,69,117,251,5,104,
+251,70,11,7,247,178,251,19,162,191,251,102,221,5,11,134,144,78,125,101,133,
+82,132,25,123,7,11,26,142,137,141,136,133,115,135,133,109,30,11,27,158,147,
+132,122,129,137,127,134,120,31,11,30,247,16,248,98,200,252,198,5,157,6,11,
+31,162,248,194,5,122,6,252,42,252,207,11,169,120,160,111,116,112,124,112,
+113,31,98,11,207,247,70,21,248,1,248,1,252,1,6,11,95,173,78,251,42,251,32,
+251,38,251,48,11,247,111,205,251,111,247,112,73,6,14,21,181,6,161,186,5,161,
+11,174,30,122,157,5,11,129,93,125,127,96,138,8,123,247,97,11,6,56,104,132,
+114,102,31,74,96,105,11,8,44,79,90,88,107,27,126,131,149,11,136,25,123,7,
+193,138,148,136,119,26,11,138,137,147,31,160,134,151,125,120,26,11,139,131,
+144,8,133,143,137,145,174,26,11,140,120,139,134,135,26,116,131,129,104,11,
+247,183,201,251,172,6,56,104,132,114,11,21,54,92,94,84,82,26,99,164,108,11,
+147,140,148,27,157,147,132,124,128,137,11,27,167,157,154,163,166,117,156,
+105,97,11,30,193,230,157,184,185,26,166,128,154,11,31,125,153,145,136,154,
+27,167,156,154,11,31,227,247,229,5,67,6,117,61,5,11,169,174,205,170,31,238,
+184,139,139,165,11,195,72,220,188,192,162,184,190,31,203,11,198,247,19,168,
+212,155,26,155,125,152,11,248,226,247,112,21,205,252,140,73,7,11,112,163,
+100,75,76,78,251,51,36,30,11,123,153,138,150,138,149,134,143,132,25,11,130,
+136,132,133,30,14,5,225,29,11,244,29,124,11,27,209,188,175,189,181,107,165,
+89,130,132,138,137,130,31,14,111,117,118,112,161,29,14,126,29,129,11,27,166,
+158,121,113,113,120,124,105,118,121,143,150,110,31,122,110,5,123,181,11,135,
+127,99,29,144,157,11,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,1,135,255,2,135,
+254,2,243,2,0,1,0,4,0,7,0,68,0,112,0,180,1,72,2,7,2,192,2,201,3,5,3,65,4,
+18,4,37,4,44,4,48,4,55,4,75,4,152,4,235,5,63,5,175,5,227,6,51,6,147,6,183,
+7,32,7,130,7,157,7,170,7,198,7,220,7,246,8,81,8,254,9,2,9,125,9,129,9,133,
+9,137,9,242,9,246,9,253,10,2,10,7,10,11,10,15,10,131,10,135,10,139,10,145,
+11,36,11,40,11,43,11,47,11,51,11,122,11,127,12,20,12,24,12,28,12,76,12,95,
+12,142,12,172,12,183,12,190,12,193,13,37,13,42,13,45,13,50,13,70,13,73,13,
+75,13,81,13,92,13,97,13,104,14,54,14,57,14,60,14,169,15,20,15,25,15,30,15,
+37,15,40,15,139,15,143,16,56,16,61,16,66,16,159,16,171,17,15,17,77,17,139,
+18,13,18,161,18,165,19,66,19,198,20,116,20,216,20,233,20,244,21,9,21,15,21,
+23,21,117,22,7,22,22,22,186,23,194,23,198,24,79,24,104,24,111,24,137,24,167,
+24,196,24,211,25,158,25,250,26,2,26,8,26,16,26,39,26,47,26,55,26,64,26,71,
+26,82,26,95,26,105,26,146,26,154,26,158,26,184,27,29,27,111,27,145,28,63,
+28,119,28,136,28,141,28,169,28,172,29,83,30,11,30,79,30,95,30,216,31,112,
+31,115,31,190,31,217,32,41,32,82,32,97,32,119,32,163,33,13,33,46,33,84,33,
+207,33,212,34,48,34,92,34,120,34,201,34,209,34,217,34,225,34,233,34,241,34,
+250,35,45,35,54,35,63,35,72,35,81,35,91,35,101,35,121,35,131,35,140,35,147,
+35,161,35,169,35,176,35,194,35,201,35,213,35,222,35,231,35,239,35,247,36,
+0,36,8,36,14,36,21,36,28,36,34,36,70,36,78,36,124,36,133,36,143,36,152,36,
+164,36,173,36,182,36,193,36,202,36,209,36,243,36,250,37,1,37,7,37,15,37,25,
+37,33,37,41,37,49,37,57,37,66,37,76,37,86,37,207,37,243,38,71,38,215,39,74,
+39,207,40,30,40,169,40,234,41,25,41,34,41,109,41,143,41,237,42,56,42,214,
+42,235,43,39,43,48,43,56,43,66,43,75,43,78,43,86,43,96,43,136,43,160,43,170,
+43,181,43,189,43,201,43,209,43,217,43,229,43,237,43,246,43,254,44,44,44,52,
+44,61,44,79,44,106,44,116,44,125,44,134,44,144,44,154,44,164,44,173,45,9,
+45,17,45,26,45,38,45,48,45,87,45,96,45,105,45,114,45,123,45,141,45,149,45,
+164,45,173,45,182,45,250,46,6,46,27,46,167,47,20,47,34,47,74,47,84,47,94,
+47,104,47,116,47,191,47,201,47,212,47,252,48,21,48,29,48,59,48,75,48,88,48,
+95,48,107,48,115,48,125,48,135,48,144,48,155,48,168,48,186,48,196,48,207,
+49,9,49,29,49,38,49,47,49,55,49,65,49,76,49,86,49,97,49,137,49,147,49,159,
+49,169,49,186,49,194,49,202,50,2,50,23,50,30,50,66,50,76,50,107,50,130,51,
+9,51,117,51,145,52,39,52,43,52,47,52,51,52,55,52,201,52,249,52,253,53,5,53,
+71,53,82,53,101,53,151,53,162,53,170,53,177,53,248,54,10,54,18,54,31,54,39,
+54,80,54,175,54,184,54,253,55,36,55,60,55,115,55,158,55,212,56,7,56,125,57,
+28,57,80,57,100,57,129,57,138,57,147,57,173,57,197,57,205,57,214,57,215,57,
+218,58,75,58,152,58,223,59,14,59,140,59,232,60,94,60,177,60,251,61,127,61,
+164,61,230,62,65,62,78,62,83,62,99,62,115,62,127,62,138,62,179,62,212,62,
+229,62,243,63,10,63,51,63,66,63,98,63,117,63,170,63,224,64,9,64,169,64,195,
+65,159,66,150,66,181,66,207,66,247,67,32,67,84,67,117,67,145,67,254,68,60,
+68,122,68,192,68,233,69,16,69,34,69,103,69,172,69,215,69,236,70,100,70,208,
+71,29,71,72,71,124,71,184,72,59,72,166,73,10,73,168,73,248,74,16,74,46,74,
+78,74,124,74,172,75,13,75,36,75,59,75,90,75,103,75,114,75,221,76,44,76,48,
+76,63,76,77,76,114,76,185,76,224,77,89,77,138,77,190,78,15,78,30,78,45,78,
+176,78,183,78,248,78,251,79,33,79,64,79,117,79,120,80,28,80,32,80,103,80,
+115,80,209,81,45,81,180,82,1,82,78,82,167,82,238,83,63,83,67,83,72,83,127,
+84,68,84,219,85,15,85,140,86,16,86,132,86,137,87,11,87,16,87,118,87,123,87,
+242,88,76,88,218,89,64,89,239,89,242,90,123,90,198,91,28,91,121,91,126,91,
+248,92,77,92,225,93,49,93,166,94,67,94,183,95,77,95,91,95,102,95,121,95,156,
+95,173,95,230,95,241,95,253,96,77,96,211,97,52,97,61,97,69,97,131,97,152,
+97,167,97,188,97,211,98,56,98,79,98,117,98,164,98,242,99,85,99,158,99,161,
+100,34,100,38,101,24,101,55,101,59,101,63,101,147,101,253,102,0,102,41,102,
+93,102,190,103,11,103,74,103,81,103,87,103,142,103,229,104,6,104,54,104,115,
+104,126,104,174,105,6,105,137,106,7,106,120,106,190,107,42,107,183,108,61,
+108,65,108,69,108,73,108,159,109,31,109,174,110,50,110,151,110,240,111,220,
+112,2,112,120,112,252,113,170,114,36,114,88,114,97,114,122,114,138,114,173,
+114,186,114,214,115,76,115,101,115,193,116,9,116,151,117,66,117,222,118,16,
+118,31,118,46,118,155,119,1,119,108,119,149,119,200,119,233,120,50,120,165,
+121,18,121,125,121,207,122,52,122,59,122,246,123,38,123,41,123,63,123,161,
+124,48,124,113,124,132,124,229,125,92,125,150,126,75,126,80,127,6,127,149,
+128,10,128,191,129,62,129,190,130,7,130,100,130,214,131,90,131,161,132,54,
+132,136,132,244,133,40,133,123,133,231,134,71,134,230,135,41,135,89,135,123,
+135,248,136,193,137,15,137,97,137,99,137,202,138,45,138,58,138,106,138,213,
+139,31,139,78,139,118,140,1,140,25,140,174,141,36,141,132,142,22,142,157,
+142,211,142,244,143,19,143,140,143,232,144,72,144,140,145,19,145,59,145,123,
+146,62,146,174,147,102,147,179,148,77,149,41,149,150,150,77,151,42,151,146,
+151,220,152,61,152,96,152,128,152,163,152,197,152,237,153,18,153,125,153,
+187,153,227,153,240,154,9,154,37,154,66,154,194,154,245,155,48,155,120,155,
+171,155,220,156,67,156,124,156,187,156,253,157,15,157,35,157,53,157,94,157,
+144,157,193,157,242,158,36,158,63,158,90,158,118,158,146,158,167,158,206,
+158,252,159,29,159,62,252,46,14,252,46,14,251,219,247,29,247,69,21,195,247,
+45,165,202,184,239,8,167,201,149,170,169,26,173,125,156,113,102,120,106,56,
+125,30,116,251,34,131,102,98,251,83,8,110,52,21,112,114,115,112,108,161,116,
+168,170,164,162,168,167,114,164,109,31,14,251,132,247,236,248,57,21,198,247,
+20,168,211,155,26,155,125,152,122,115,113,247,35,10,251,50,22,247,55,29,122,
+115,113,120,117,134,30,133,114,130,62,131,37,8,14,248,101,247,159,21,44,6,
+193,247,35,5,244,6,150,193,5,43,247,25,29,251,22,247,25,29,34,6,128,85,5,
+235,6,85,251,35,5,34,6,128,85,5,234,247,26,10,247,22,247,26,10,244,6,48,247,
+89,21,85,251,35,5,251,22,6,193,247,35,5,14,248,133,248,248,21,107,162,96,
+157,93,149,155,207,24,105,6,122,76,5,60,117,134,115,97,31,92,112,111,93,86,
+26,102,151,109,168,103,30,161,112,159,121,191,103,70,251,189,24,61,158,113,
+176,128,244,123,136,24,112,251,15,175,109,191,116,201,127,25,117,48,5,174,
+6,160,228,212,142,173,146,178,159,25,198,169,174,199,209,26,218,114,175,251,
+9,230,30,195,247,129,200,115,162,104,140,65,25,154,137,5,251,79,61,21,77,
+184,120,166,185,26,184,163,174,182,154,30,146,158,143,140,184,27,92,251,227,
+21,145,134,5,207,83,156,110,86,26,55,87,93,32,131,30,14,247,65,249,63,248,
+7,21,33,251,1,251,11,251,9,54,183,89,215,183,179,157,172,171,31,193,196,171,
+217,216,26,207,99,179,72,30,150,107,21,178,171,103,95,76,107,62,91,88,31,
+115,117,110,125,110,27,98,119,163,186,187,168,221,173,188,31,180,166,167,
+157,171,27,98,247,229,21,99,6,89,89,96,121,71,27,106,116,145,150,126,31,121,
+155,5,152,125,112,147,112,27,251,2,251,0,251,12,251,15,66,191,82,206,191,
+186,165,187,177,31,178,189,168,214,191,26,151,137,155,135,158,30,142,139,
+139,138,142,30,131,160,152,137,166,27,186,162,145,163,182,31,251,242,253,
+6,5,186,6,240,248,249,21,146,118,141,126,122,26,251,6,58,251,4,57,102,117,
+163,178,246,221,247,31,203,144,142,137,133,146,30,154,127,149,134,166,132,
+8,14,247,10,248,166,247,242,21,120,7,179,136,149,132,117,26,104,123,111,76,
+63,30,107,188,108,224,115,242,202,171,168,157,166,163,8,174,171,157,174,173,
+26,192,95,180,81,45,73,54,251,13,128,140,126,142,112,30,134,141,127,140,125,
+30,35,94,95,115,104,110,8,91,99,115,93,85,26,42,210,78,247,3,203,170,152,
+205,243,30,82,184,178,117,192,27,189,175,158,188,182,31,128,150,5,116,110,
+121,132,116,27,92,104,166,206,99,31,194,215,154,161,169,181,157,165,150,153,
+150,149,154,150,150,143,168,142,8,156,7,252,18,134,21,175,251,19,174,54,173,
+96,8,100,92,96,122,89,27,66,84,195,213,211,204,211,237,176,31,216,222,21,
+135,169,138,159,165,26,229,160,179,187,169,152,122,99,74,117,108,54,86,30,
+14,251,219,247,52,248,72,89,29,14,251,219,247,51,251,67,21,102,241,128,200,
+236,26,247,13,167,247,35,186,247,3,30,172,218,170,186,204,207,126,154,24,
+251,22,251,10,88,73,97,35,8,113,76,128,78,62,26,62,151,64,161,70,30,153,97,
+154,107,175,73,8,14,251,219,168,251,72,21,247,16,247,0,190,204,184,247,0,
+8,167,205,151,202,214,26,196,131,202,125,199,30,122,207,124,175,94,219,120,
+134,24,173,58,154,58,39,26,251,19,105,251,53,89,251,0,30,110,74,109,97,78,
+75,8,14,247,211,248,136,21,160,143,158,151,176,30,147,165,142,152,150,26,
+162,125,155,117,117,126,124,114,130,141,130,145,119,30,153,94,143,115,96,
+26,100,162,119,155,107,175,8,162,119,128,146,123,27,119,124,124,119,112,154,
+128,185,131,31,176,133,170,128,164,124,151,132,24,96,113,122,132,92,131,8,
+97,132,122,126,115,26,119,155,123,158,156,155,149,160,156,30,167,174,151,
+150,171,158,148,144,142,141,142,142,8,141,123,139,134,131,26,117,133,114,
+126,103,30,132,118,136,128,130,26,117,154,123,159,162,155,155,163,148,137,
+146,133,157,30,124,181,135,161,138,192,146,135,24,172,120,162,119,165,106,
+8,116,158,151,131,154,27,161,155,156,161,162,122,151,95,146,31,111,144,116,
+146,124,147,102,158,24,182,166,156,146,186,147,8,181,146,154,150,165,26,161,
+124,154,116,126,131,135,122,125,30,85,82,137,137,95,110,8,14,154,247,197,
+247,178,21,251,111,73,247,111,251,112,205,247,112,247,36,29,252,46,144,251,
+21,87,10,251,219,222,10,252,46,221,239,195,29,14,252,18,247,205,249,46,21,
+252,14,253,64,5,212,6,248,14,249,64,5,14,247,233,249,56,21,251,49,251,44,
+251,120,251,127,251,24,203,51,236,182,181,154,170,181,31,240,213,215,247,
+58,247,36,26,247,50,80,234,42,30,133,111,21,192,169,93,59,251,26,99,251,57,
+82,37,31,73,101,98,105,93,27,86,107,189,224,246,190,247,89,191,232,31,203,
+176,177,170,185,27,14,188,22,247,171,154,122,6,90,119,148,162,148,142,154,
+148,167,31,141,146,140,144,142,149,247,35,248,155,24,144,157,140,145,144,
+26,143,137,142,136,30,139,111,134,85,128,30,49,121,137,138,132,138,127,137,
+25,124,7,196,141,5,162,140,154,127,119,26,132,137,132,134,119,30,251,30,252,
+128,127,102,118,129,60,132,25,14,248,36,247,31,21,116,90,119,127,83,137,8,
+251,82,144,6,247,84,247,84,5,247,9,247,9,171,189,206,26,234,68,213,48,103,
+102,130,122,109,30,88,111,112,105,110,67,160,132,24,204,176,182,168,199,27,
+211,192,87,69,118,136,120,133,126,31,115,85,93,76,74,69,251,102,251,116,24,
+122,247,247,7,189,247,24,5,14,247,70,248,203,21,186,174,173,159,181,27,193,
+174,103,84,97,118,103,96,110,31,96,110,96,124,50,124,140,123,24,195,149,138,
+130,165,31,200,116,171,85,59,26,104,131,103,125,115,30,99,116,94,111,98,27,
+120,117,149,161,109,31,160,110,123,146,120,27,111,123,125,114,101,179,118,
+211,195,191,152,163,180,31,218,185,189,223,228,26,212,110,184,73,170,30,142,
+7,247,12,186,174,172,207,26,212,80,193,58,70,77,100,74,107,30,14,248,89,247,
+133,21,44,6,247,13,248,71,5,98,6,252,53,252,67,119,72,5,247,154,6,90,251,
+70,5,218,6,185,247,68,5,239,6,251,54,204,21,251,104,143,6,247,196,247,210,
+5,143,6,14,247,130,248,231,21,247,122,6,162,210,5,251,148,6,35,251,110,5,
+124,7,236,118,172,127,175,110,8,171,113,160,89,86,26,251,1,58,41,49,118,121,
+147,160,110,30,158,114,124,146,123,27,116,122,122,116,103,178,118,206,247,
+57,247,25,247,20,247,51,201,116,192,96,180,31,101,174,104,155,58,159,8,14,
+248,156,249,66,21,251,26,123,72,115,53,76,8,251,18,45,62,251,34,251,35,26,
+251,20,211,56,247,3,247,26,247,6,247,19,247,43,241,68,213,40,111,106,131,
+126,112,30,135,141,208,247,19,247,28,240,247,9,153,25,251,154,251,151,21,
+208,183,89,62,71,115,60,102,87,31,94,109,104,118,96,27,78,103,188,221,207,
+159,222,165,183,31,185,166,172,159,186,27,14,248,173,249,36,21,133,149,5,
+252,11,6,58,251,28,153,130,185,195,167,154,198,140,25,247,114,6,141,136,252,
+3,252,234,5,209,6,14,247,221,248,18,21,247,11,178,184,182,210,26,222,66,197,
+37,32,66,78,50,85,159,100,206,66,30,251,18,99,70,68,51,26,112,147,109,154,
+114,30,82,172,199,110,222,27,247,16,230,216,242,206,109,193,54,227,31,57,
+101,21,247,2,251,6,151,121,82,26,58,82,80,60,60,83,197,221,222,193,208,234,
+176,30,203,194,21,61,213,122,164,181,26,209,177,182,203,203,182,92,68,76,
+112,107,52,98,30,14,162,122,21,247,27,162,206,166,222,204,8,247,8,231,207,
+247,25,247,27,26,247,24,67,225,251,1,251,18,251,8,251,20,251,32,34,201,65,
+227,180,174,151,172,192,30,143,137,122,93,89,74,78,83,25,66,78,90,113,60,
+122,8,247,187,249,29,21,201,176,90,56,61,114,46,109,110,31,113,113,98,122,
+101,27,75,103,189,228,213,168,219,182,183,31,164,163,170,152,173,27,14,251,
+219,245,239,21,108,114,113,108,110,164,114,168,171,164,163,169,170,114,165,
+109,31,238,247,233,180,29,251,219,175,251,21,88,10,247,70,248,189,180,29,
+154,249,1,248,232,21,252,121,251,156,137,133,247,227,251,168,168,243,251,
+141,247,96,247,253,247,91,5,14,154,248,226,248,22,21,252,140,73,248,140,6,
+251,26,4,252,140,73,248,140,6,14,154,233,189,21,248,121,247,156,141,146,251,
+228,247,167,111,36,247,141,251,97,251,253,251,91,5,14,247,108,247,66,21,146,
+168,153,195,168,177,211,196,25,247,6,232,159,166,200,26,217,81,190,49,57,
+81,94,75,109,154,121,164,162,155,154,159,147,137,145,134,150,30,133,152,137,
+145,147,26,169,165,157,183,190,168,109,84,87,117,97,74,68,30,56,44,127,117,
+122,40,8,125,54,21,109,116,116,110,110,162,117,169,167,164,163,166,168,115,
+162,110,31,14,247,152,248,223,248,85,21,179,118,124,150,104,27,97,98,121,
+107,109,31,88,87,108,62,68,26,76,178,91,189,181,184,165,184,175,30,96,145,
+175,110,186,27,238,224,247,2,247,20,247,55,251,34,247,19,251,76,251,94,251,
+52,251,46,251,86,251,81,247,51,251,39,247,98,210,189,152,183,233,31,127,168,
+5,104,62,90,127,73,27,251,64,251,13,247,13,247,63,247,80,247,9,247,26,247,
+55,247,48,247,21,251,14,251,38,79,114,74,102,99,31,119,120,114,128,114,27,
+115,126,154,166,144,140,148,141,146,31,204,247,144,5,70,6,72,109,21,167,137,
+153,116,137,102,8,251,5,133,83,39,82,27,102,117,171,191,193,157,188,172,177,
+31,167,171,174,159,163,137,8,14,90,34,29,14,90,131,22,247,174,6,247,49,247,
+0,220,247,11,212,108,176,44,180,31,210,156,168,151,171,167,8,167,163,154,
+173,179,26,234,68,191,251,21,30,251,150,123,6,202,134,153,132,247,2,29,81,
+132,133,83,129,25,247,138,247,207,21,203,182,135,131,159,31,180,122,164,96,
+84,26,251,0,65,73,251,14,97,117,153,167,152,151,187,162,218,30,152,182,147,
+169,150,185,8,214,247,156,21,161,145,151,145,178,27,220,175,105,65,82,115,
+94,96,115,31,105,120,90,131,50,140,8,14,146,45,10,14,201,66,29,14,90,32,29,
+14,90,249,25,215,29,252,134,123,6,204,133,151,133,247,2,29,79,247,27,10,142,
+121,150,169,26,148,141,151,146,163,30,201,247,115,5,137,176,161,138,161,27,
+178,146,138,135,148,31,154,131,146,126,119,26,123,137,127,133,108,30,156,
+134,215,247,126,121,144,94,49,136,138,251,60,137,25,205,247,125,5,159,145,
+153,145,180,27,247,61,174,126,75,132,139,134,138,129,31,138,130,139,137,138,
+131,160,137,24,14,201,36,10,14,201,249,147,249,33,58,29,251,219,41,29,14,
+251,108,76,10,14,146,52,10,14,35,44,10,14,247,65,249,253,215,29,251,59,6,
+251,228,252,129,84,248,129,5,251,73,123,6,189,136,163,128,116,26,131,135,
+124,133,121,30,137,135,136,129,135,123,136,128,24,33,252,8,108,35,124,119,
+87,133,25,123,247,90,155,7,88,143,119,151,167,26,150,143,163,144,157,30,247,
+10,248,69,200,252,182,5,156,6,248,13,248,197,251,21,252,106,123,86,247,57,
+10,71,145,130,145,170,26,156,141,152,148,170,30,247,15,248,79,157,199,144,
+144,198,148,25,14,146,41,10,14,201,34,10,14,90,247,38,62,10,14,201,247,171,
+123,21,216,144,177,149,195,170,8,247,40,222,240,247,54,247,50,26,247,27,43,
+237,251,24,58,48,98,67,60,30,38,46,80,251,13,251,10,26,57,169,71,193,97,30,
+166,118,160,129,183,129,47,58,130,132,63,85,149,124,24,160,177,176,149,179,
+27,159,168,134,126,183,31,122,200,192,130,177,27,194,209,165,178,190,31,163,
+158,152,153,165,174,124,150,24,81,83,98,121,67,27,109,103,145,155,82,31,85,
+153,103,146,118,138,114,138,24,247,132,249,86,21,219,188,81,44,33,92,251,
+38,75,46,31,59,84,77,101,66,27,57,93,199,245,235,247,16,10,14,90,42,29,14,
+40,10,14,35,47,10,14,201,33,10,14,90,249,68,215,29,251,78,123,6,184,134,157,
+129,120,26,120,120,97,106,81,30,251,98,251,248,73,248,79,5,138,144,139,143,
+145,26,173,153,148,202,147,30,155,251,133,123,7,195,132,141,137,160,251,18,
+224,252,156,24,158,6,248,9,248,251,156,166,155,151,162,140,25,14,247,65,38,
+10,14,90,249,35,215,29,251,100,123,6,188,133,151,132,116,26,126,133,127,125,
+123,30,251,37,251,59,80,247,39,5,129,165,134,156,152,26,164,155,148,194,146,
+30,155,251,156,123,7,197,134,154,129,158,93,245,251,155,24,122,120,122,119,
+123,120,118,115,119,115,119,116,130,128,129,128,130,129,91,83,109,107,121,
+125,114,119,122,130,113,134,8,123,247,106,155,7,91,122,148,164,154,146,155,
+153,155,31,247,43,247,64,206,251,57,5,146,121,143,123,124,26,110,129,134,
+73,134,30,123,247,165,155,7,69,147,130,145,114,199,37,247,150,24,247,61,247,
+86,191,197,169,162,182,153,25,14,35,37,10,14,35,51,29,14,251,163,248,20,249,
+16,21,146,166,5,251,65,6,251,89,253,196,5,247,80,6,146,166,5,83,6,107,122,
+148,158,144,139,139,143,155,31,247,52,249,58,146,166,149,146,169,140,25,14,
+252,18,98,249,46,21,247,181,253,64,5,210,6,251,180,249,64,5,14,251,163,158,
+251,18,21,132,112,5,247,65,6,247,89,249,196,5,251,81,6,132,112,5,196,6,172,
+155,130,121,134,139,139,135,123,31,251,53,253,58,133,112,130,131,108,138,
+25,14,251,130,234,247,195,21,247,35,247,185,247,40,251,185,5,191,6,251,67,
+247,239,5,88,6,251,61,251,239,5,14,248,106,251,22,21,189,252,132,89,7,14,
+251,219,247,193,120,10,14,32,10,14,247,2,249,23,21,238,29,137,132,138,133,
+137,132,24,251,28,252,137,5,135,7,116,215,109,196,247,43,247,58,247,66,247,
+50,209,90,189,72,69,87,98,251,2,68,30,190,247,79,147,167,184,247,65,134,144,
+24,88,130,110,134,66,130,8,247,100,251,160,21,183,165,106,86,73,89,32,79,
+77,31,101,102,96,118,96,27,108,124,150,162,199,169,235,181,214,31,216,183,
+184,177,187,27,14,251,108,47,29,14,56,29,14,251,108,35,29,14,252,18,174,248,
+32,21,98,29,247,1,6,145,171,5,251,0,6,98,10,14,37,29,14,57,29,252,18,40,29,
+166,10,252,18,247,138,80,10,223,249,6,179,10,251,108,58,10,14,252,18,247,
+120,53,10,14,201,249,69,247,9,21,135,134,134,134,135,133,122,119,130,128,
+138,138,8,115,117,129,132,125,27,131,135,144,150,143,143,156,145,163,31,207,
+247,143,5,140,144,141,155,146,26,175,114,166,106,119,119,132,124,115,30,90,
+107,98,91,70,251,2,8,165,217,153,194,158,26,175,116,163,105,78,69,73,251,
+37,47,30,197,247,101,136,141,85,128,118,135,54,123,25,123,7,185,138,139,139,
+148,134,8,144,137,143,132,132,26,127,115,47,104,251,17,30,117,63,135,123,
+126,88,8,214,6,187,247,50,154,177,173,191,8,225,196,198,194,173,27,152,146,
+130,123,126,109,251,10,99,251,33,31,131,110,135,125,126,90,8,214,6,179,247,
+48,159,190,190,209,8,207,188,189,183,168,27,150,148,130,127,134,137,129,134,
+119,31,81,251,122,5,129,100,136,122,129,26,109,153,123,165,186,183,172,213,
+192,30,144,146,5,14,39,29,14,38,29,14,195,248,39,21,162,140,5,161,140,159,
+126,123,26,127,104,251,31,103,251,24,30,116,54,119,64,124,76,247,39,29,154,
+7,92,122,147,161,153,156,215,159,215,247,31,10,247,59,247,52,217,95,186,68,
+74,91,107,57,81,31,168,240,5,140,144,140,142,139,26,142,137,141,136,30,138,
+6,251,46,117,5,247,155,118,21,182,137,158,113,82,26,71,110,54,96,77,30,79,
+97,91,109,247,1,29,166,207,197,188,189,136,8,14,248,27,251,83,21,121,6,103,
+118,149,158,140,31,142,140,143,140,143,30,247,56,248,213,5,66,6,124,92,5,
+185,123,119,155,98,27,251,24,251,53,251,76,251,44,68,178,94,202,210,185,175,
+247,20,228,31,50,251,185,126,99,123,130,74,135,25,123,247,133,7,69,249,8,
+21,172,165,112,106,55,71,251,34,71,82,31,117,113,112,127,115,27,104,118,169,
+186,213,191,247,2,204,206,31,170,170,172,157,168,27,14,251,163,49,29,14,251,
+163,39,10,14,252,18,247,188,69,29,14,33,29,14,251,108,160,248,39,21,140,150,
+147,139,150,27,178,149,122,47,153,31,150,69,150,251,39,78,26,110,140,133,
+147,164,230,241,247,38,243,30,174,189,165,203,177,26,171,113,166,109,116,
+125,126,118,123,145,127,157,123,30,152,127,144,131,129,26,92,74,251,2,67,
+65,30,108,107,132,247,33,133,191,126,213,25,241,119,139,141,130,27,134,132,
+138,136,131,31,123,135,77,127,106,134,8,14,146,35,10,14,251,108,248,38,247,
+3,21,131,130,134,133,130,127,8,109,116,127,129,127,27,125,130,152,167,132,
+31,136,150,139,141,138,142,8,114,241,128,185,154,26,217,184,174,182,157,27,
+145,148,136,134,148,31,132,151,146,137,148,27,159,153,154,160,161,122,154,
+115,95,102,103,32,69,31,128,194,5,207,125,128,159,112,27,116,107,131,118,
+77,31,133,137,139,139,134,137,143,124,24,149,178,146,140,149,27,164,145,130,
+79,153,31,168,251,15,57,251,9,5,109,118,120,121,128,27,133,129,142,145,129,
+31,146,126,129,142,130,27,119,125,124,119,113,158,123,170,170,151,148,199,
+189,31,166,172,161,169,180,194,169,251,12,24,87,152,152,124,171,27,177,165,
+163,229,197,31,14,251,108,36,29,14,251,163,42,10,14,251,152,248,43,249,67,
+21,251,5,94,105,33,108,31,91,251,70,120,66,117,115,75,122,25,178,125,152,
+125,110,26,115,127,85,117,64,30,117,64,129,93,116,26,84,172,119,231,136,30,
+142,150,5,101,150,124,157,176,26,155,145,164,155,200,30,165,232,157,218,157,
+26,166,123,158,100,156,30,204,156,165,168,161,222,184,247,60,24,160,218,165,
+168,201,155,8,14,252,21,206,251,141,21,205,250,122,73,6,14,251,152,247,113,
+249,56,21,177,128,154,120,102,26,125,132,110,124,81,30,137,131,139,139,130,
+106,8,106,251,21,139,139,119,26,111,155,121,178,122,30,73,122,115,111,116,
+55,94,251,60,24,118,60,113,110,77,123,136,128,24,247,5,184,173,245,170,31,
+187,247,70,158,212,161,163,203,156,25,100,153,126,153,168,26,163,151,192,
+161,215,30,161,214,149,185,162,26,194,106,159,47,142,30,14,251,11,248,148,
+247,168,21,85,171,5,100,115,122,127,108,27,118,119,144,148,122,31,186,50,
+121,145,95,27,93,111,119,75,93,31,193,108,5,177,164,156,151,169,27,160,159,
+134,130,156,31,92,228,157,133,183,27,177,175,160,179,168,31,14,251,163,247,
+116,247,177,21,86,251,36,103,49,101,57,8,110,77,130,109,107,26,106,153,122,
+165,175,159,172,222,153,30,158,247,10,155,225,176,247,58,8,169,247,84,21,
+108,114,116,110,110,164,115,169,166,164,163,166,170,117,162,110,31,14,248,
+50,248,196,21,109,6,97,251,12,87,131,114,130,102,115,25,46,80,81,40,38,26,
+85,158,95,172,114,30,154,127,153,133,166,133,91,251,28,24,170,6,186,247,25,
+5,138,144,140,139,144,27,212,193,170,215,199,31,123,149,5,79,83,101,118,88,
+27,129,133,140,142,131,31,247,29,248,27,5,163,138,150,132,126,26,135,137,
+134,135,130,30,243,29,166,161,127,161,121,153,30,120,153,123,144,104,142,
+8,251,62,252,35,21,112,162,127,169,184,26,203,160,211,174,192,30,174,191,
+168,161,190,154,8,14,248,32,247,211,21,146,181,5,251,15,6,247,118,181,162,
+193,196,27,163,151,126,108,143,31,104,144,146,130,163,27,164,153,153,166,
+184,101,170,84,85,89,112,90,101,31,89,75,118,83,119,251,5,8,251,2,6,130,97,
+5,247,5,6,114,251,96,5,150,99,138,139,124,27,83,101,111,99,100,165,114,178,
+174,161,154,187,178,31,89,203,170,126,188,27,206,189,173,202,164,31,128,148,
+129,132,5,119,111,117,132,110,27,96,94,150,166,67,31,180,228,145,155,165,
+247,2,8,251,16,251,138,21,105,127,110,116,109,27,115,120,155,160,166,161,
+157,170,160,151,134,119,167,31,14,252,129,223,29,248,92,247,74,21,151,179,
+5,251,72,6,163,221,145,147,5,247,62,6,151,179,5,251,43,6,247,73,247,116,171,
+179,148,146,171,153,25,155,251,81,123,7,188,133,139,139,149,133,8,145,136,
+143,131,131,26,111,91,72,251,6,251,23,30,134,133,132,132,136,134,126,124,
+24,126,184,137,149,125,184,8,111,235,128,181,155,26,164,150,144,203,145,30,
+155,251,131,123,7,206,130,143,136,156,85,202,251,111,24,251,32,6,127,99,5,
+247,55,6,142,129,116,59,5,251,56,6,127,99,5,247,57,6,112,47,122,88,110,120,
+76,135,25,135,123,5,247,177,155,6,53,146,133,142,170,26,161,145,162,164,219,
+30,14,248,86,248,48,21,251,18,6,157,247,31,146,174,156,170,8,163,151,157,
+151,161,27,151,148,134,130,136,137,135,135,132,31,134,130,137,134,133,26,
+118,158,121,161,162,156,158,167,179,104,168,92,99,102,120,101,109,30,101,
+91,119,86,120,251,4,8,251,1,6,132,109,5,247,4,6,100,251,235,127,37,129,94,
+122,113,25,124,129,123,129,122,27,127,130,146,148,144,141,143,143,146,31,
+145,148,141,146,145,26,160,121,156,117,113,121,119,110,100,171,112,186,225,
+206,238,247,54,161,30,181,247,195,5,247,14,6,14,247,141,248,34,21,146,121,
+122,143,121,27,81,91,84,71,92,163,87,186,85,31,215,52,5,177,95,151,116,109,
+26,86,97,102,79,102,105,156,159,145,143,144,150,145,30,159,152,146,150,161,
+26,166,122,155,109,104,118,118,104,78,199,92,215,228,206,198,217,179,129,
+161,86,206,30,141,142,5,133,151,146,138,153,27,210,186,189,215,180,124,180,
+113,171,31,251,15,247,42,5,122,160,130,164,165,26,190,174,171,196,173,165,
+125,122,133,135,134,130,131,30,124,126,133,128,125,26,113,158,120,166,171,
+159,160,173,197,85,180,63,53,78,87,66,95,155,105,190,77,30,101,126,21,172,
+174,114,88,178,31,182,82,153,110,105,26,100,110,107,103,81,32,247,22,210,
+176,168,168,176,30,14,176,221,21,179,99,216,218,5,116,172,170,129,176,27,
+177,170,149,162,170,31,218,60,177,179,62,216,5,162,174,148,168,177,26,177,
+130,168,116,172,30,216,217,101,178,60,62,5,160,109,108,149,101,27,101,109,
+130,117,105,31,62,216,99,100,217,61,5,117,107,129,109,100,26,101,148,110,
+162,105,30,247,35,247,114,21,202,191,84,73,72,87,85,74,73,86,193,207,206,
+192,192,207,31,14,252,82,247,45,248,57,21,247,55,29,121,115,114,247,35,10,
+14,35,247,188,120,10,247,92,156,127,10,14,192,81,10,247,54,130,92,10,114,
+119,82,74,30,113,116,128,131,49,69,8,14,251,219,190,81,10,14,251,219,247,
+174,247,116,75,10,247,24,248,32,21,133,123,118,41,99,251,88,109,251,40,127,
+94,122,107,8,108,121,122,126,114,247,13,29,146,140,143,144,26,160,121,156,
+118,164,10,144,136,132,135,138,137,128,97,31,80,251,104,124,78,134,10,147,
+173,247,21,177,247,30,31,148,172,147,168,144,156,140,143,24,143,155,140,146,
+144,26,168,10,159,170,8,177,164,169,108,29,52,6,132,107,5,14,248,11,248,32,
+21,131,100,136,126,117,57,8,105,251,23,126,76,112,26,108,158,120,168,181,
+169,163,220,199,30,123,148,5,87,94,120,122,125,27,133,134,144,145,155,225,
+248,0,180,247,50,31,156,202,143,157,146,139,10,118,117,141,121,27,83,83,114,
+97,100,31,96,92,118,98,109,40,8,48,6,133,107,5,228,247,26,29,109,251,6,121,
+131,29,103,171,113,185,229,210,240,247,81,181,30,208,247,202,5,146,171,21,
+144,159,5,247,38,176,188,205,211,247,30,10,133,131,137,133,132,26,134,140,
+134,143,132,30,143,132,141,133,138,136,138,136,24,103,251,36,5,14,248,141,
+247,135,21,252,139,6,131,93,5,248,139,6,14,247,71,251,51,21,187,247,102,156,
+210,177,236,165,178,25,126,162,136,158,182,26,171,141,155,146,174,30,183,
+160,135,122,179,31,131,158,147,137,150,27,167,155,154,166,166,124,152,107,
+124,130,137,129,116,31,102,124,128,137,97,138,150,187,146,158,168,186,8,158,
+167,144,153,157,26,168,124,155,112,108,123,119,102,129,140,131,142,122,30,
+143,120,140,128,128,26,116,137,120,131,95,30,97,140,128,141,102,154,8,148,
+117,129,142,125,27,106,124,126,112,112,155,124,167,150,147,141,148,159,31,
+155,178,155,143,180,27,126,65,117,92,100,96,8,134,139,133,141,123,30,141,
+120,140,127,129,26,86,126,46,118,33,30,136,124,131,99,130,93,8,14,247,174,
+248,63,21,120,55,119,96,102,103,8,140,135,140,136,137,26,150,101,142,123,
+120,26,117,135,108,132,106,30,113,6,120,126,142,153,107,31,149,115,125,143,
+126,27,111,119,122,114,115,157,123,166,153,149,141,149,164,31,178,154,152,
+141,178,140,132,95,132,122,110,92,8,119,109,133,123,121,26,111,155,121,164,
+165,161,164,168,145,138,148,137,150,30,135,162,137,159,158,26,163,142,159,
+146,171,30,178,138,151,137,179,124,8,130,163,150,136,151,27,168,157,155,163,
+163,119,157,111,126,125,135,129,115,31,126,107,126,135,120,27,120,6,158,223,
+159,182,176,175,8,127,181,135,158,161,26,161,143,170,146,171,30,165,6,157,
+153,136,125,171,31,129,163,152,135,153,27,167,159,156,164,163,121,155,112,
+125,129,136,130,114,31,99,124,127,137,100,138,146,183,146,157,168,186,8,159,
+169,145,155,157,26,166,122,157,115,113,117,114,110,133,140,130,141,128,30,
+143,116,141,118,122,26,117,137,120,132,103,30,100,140,127,141,99,154,8,148,
+115,128,142,126,27,111,121,123,115,114,159,122,167,153,152,143,149,163,31,
+153,171,153,142,157,27,14,252,46,106,10,251,29,248,252,215,29,251,149,6,37,
+78,117,85,94,31,103,96,116,71,76,26,100,155,107,168,118,30,167,120,164,132,
+194,137,127,95,132,116,128,94,71,251,148,139,139,126,135,127,133,123,136,
+93,135,134,118,24,247,40,6,247,92,249,135,5,197,6,251,92,253,135,5,247,40,
+6,144,160,5,76,146,130,142,155,26,151,141,150,148,166,30,141,146,141,146,
+140,26,247,48,248,221,153,187,146,144,215,144,25,251,247,251,220,21,111,142,
+126,143,127,151,8,118,158,127,170,172,26,201,167,215,177,180,30,167,170,167,
+152,182,142,8,14,251,202,247,93,248,90,21,66,81,81,66,64,199,79,213,211,199,
+198,210,216,80,198,63,31,14,251,219,192,251,21,87,10,35,205,251,21,88,10,
+247,110,122,21,224,186,184,195,195,184,29,112,121,160,10,112,86,104,30,14,
+35,247,52,248,72,89,29,247,110,122,21,224,186,184,194,196,184,29,112,121,
+145,129,247,32,10,111,87,105,30,14,248,83,247,116,21,127,157,117,166,106,
+178,130,150,132,147,134,147,8,180,112,114,166,92,29,251,54,148,75,10,247,
+121,247,4,239,21,178,10,178,10,108,115,231,29,14,247,232,248,222,249,86,21,
+95,6,53,51,121,128,86,27,93,119,147,170,102,31,161,111,127,145,117,27,38,
+47,38,251,4,62,191,79,206,228,216,247,2,247,19,150,139,143,136,151,31,138,
+146,5,126,180,143,138,159,27,200,172,153,183,176,31,252,29,253,39,5,185,6,
+196,249,48,21,143,138,144,136,147,131,150,128,143,136,146,136,8,170,123,143,
+134,105,26,251,7,78,41,68,102,116,170,186,141,30,142,203,166,211,176,183,
+155,159,165,159,146,138,8,247,237,251,212,21,41,46,38,251,0,101,148,110,147,
+29,89,120,78,110,97,31,104,114,110,121,106,27,106,118,167,183,183,157,203,
+164,184,31,185,166,167,162,169,27,247,243,167,21,41,46,38,251,0,100,148,111,
+147,29,88,120,79,110,97,31,104,115,110,121,105,27,107,117,167,179,209,171,
+224,183,186,31,154,153,159,148,157,27,14,247,176,247,177,21,132,110,125,83,
+109,101,68,82,25,251,6,46,119,112,78,26,61,197,88,228,222,197,184,203,169,
+124,157,114,116,123,125,117,132,141,133,144,128,30,145,126,141,133,131,26,
+109,112,121,96,88,110,169,193,192,161,181,204,210,30,222,234,150,161,157,
+238,8,153,247,80,21,110,115,115,112,110,163,116,168,169,162,162,168,168,116,
+161,109,31,14,251,219,247,172,248,128,50,29,251,219,247,72,148,10,251,219,
+247,189,249,41,43,10,251,219,248,35,249,4,21,106,127,127,136,29,165,131,118,
+191,224,10,176,206,153,31,14,251,219,248,47,248,219,73,10,251,219,248,25,
+249,30,65,29,251,219,247,149,248,242,68,10,14,251,219,247,49,113,29,14,251,
+219,247,146,249,87,143,29,102,214,29,251,219,160,43,21,102,29,183,205,5,101,
+6,14,251,219,232,153,29,147,251,52,55,10,251,219,247,75,65,21,117,112,115,
+129,107,27,104,115,160,169,169,149,169,162,174,31,115,6,89,101,119,107,95,
+26,87,182,96,191,188,180,165,190,174,30,14,251,219,248,62,249,41,48,29,247,
+121,223,10,247,121,124,29,125,137,125,135,115,101,29,170,136,157,136,145,
+135,8,145,136,142,132,131,79,10,14,252,20,247,191,249,53,21,137,137,132,109,
+5,163,134,119,150,105,27,51,38,32,46,95,169,113,187,188,166,158,207,189,31,
+125,104,136,129,122,26,124,151,129,158,165,153,150,194,189,30,132,149,5,109,
+110,129,130,133,27,137,137,142,142,154,156,205,180,247,37,31,37,122,21,150,
+138,147,123,118,26,108,118,86,112,99,30,103,113,112,119,115,27,124,125,158,
+160,213,222,247,2,191,133,31,14,35,248,175,247,77,21,104,67,112,107,95,117,
+8,122,104,98,133,55,27,60,113,147,165,150,150,183,166,232,31,147,168,144,
+159,160,213,247,34,222,24,153,188,251,35,54,188,247,67,190,10,135,119,132,
+112,30,83,251,92,40,80,126,91,238,198,85,251,86,121,81,132,133,83,129,25,
+123,248,145,7,197,247,71,5,14,201,247,17,29,109,145,103,70,10,110,146,108,
+100,26,36,91,251,41,75,48,30,60,85,77,101,68,27,105,116,147,160,116,31,14,
+247,176,250,88,215,29,252,5,6,251,44,152,5,251,100,251,78,251,101,251,124,
+251,26,236,40,247,22,164,155,140,142,200,31,142,191,163,140,173,27,247,238,
+6,204,247,58,123,145,5,251,2,59,80,110,251,37,27,82,121,148,166,148,142,155,
+147,169,31,140,141,140,142,141,26,141,146,191,247,82,201,136,218,136,154,
+130,140,92,25,137,123,135,113,159,137,205,247,122,121,143,99,49,126,133,251,
+49,140,25,203,247,119,145,163,148,146,161,140,25,235,6,245,136,155,124,137,
+40,8,155,6,252,111,251,196,21,118,63,126,108,115,110,8,114,119,103,125,96,
+27,43,91,199,247,10,247,36,206,247,52,231,216,31,173,179,184,156,186,27,200,
+181,106,93,125,139,139,119,65,31,14,251,242,247,157,249,56,21,38,42,48,43,
+89,177,106,198,237,239,233,231,188,99,174,82,31,132,117,21,160,138,149,124,
+108,26,87,113,74,103,101,30,125,126,120,131,122,27,116,124,157,167,224,203,
+236,193,135,31,14,146,176,29,247,0,170,187,157,176,80,29,110,26,53,90,10,
+14,252,18,40,29,14,252,18,247,101,248,46,228,10,189,157,107,29,56,73,131,
+131,118,27,129,134,145,152,147,141,151,144,176,10,55,29,14,146,248,229,244,
+21,79,61,110,124,101,27,94,109,173,190,160,144,172,144,155,31,143,151,147,
+143,163,141,182,143,213,168,180,167,8,182,170,165,179,178,26,181,109,164,
+88,84,104,121,77,70,30,189,121,98,169,86,27,251,21,251,37,251,54,251,36,54,
+200,78,223,191,174,156,189,190,31,93,163,174,117,184,27,202,198,171,213,214,
+31,251,212,247,216,21,175,162,113,99,105,127,80,118,69,31,122,80,124,105,
+118,109,8,100,112,112,121,106,27,98,113,173,196,237,183,247,8,203,208,31,
+162,161,163,151,166,27,247,0,251,95,21,165,223,158,175,178,181,8,164,162,
+164,153,161,27,160,152,124,116,105,119,102,106,109,31,108,112,122,131,52,
+112,8,14,247,222,248,20,21,147,142,5,247,4,182,182,184,212,26,218,83,191,
+56,251,17,63,251,0,251,148,81,30,67,251,211,5,251,27,109,112,95,89,27,129,
+132,142,144,142,140,142,142,143,31,144,148,142,149,146,26,160,122,154,116,
+115,124,123,113,102,170,114,185,220,208,220,247,30,175,30,247,3,248,62,5,
+247,36,177,187,213,198,27,179,161,111,88,84,123,86,113,110,31,112,115,102,
+123,106,27,126,135,136,129,129,145,135,159,138,31,194,137,165,104,69,26,71,
+120,59,111,88,30,104,119,115,120,112,27,129,131,145,146,141,141,144,141,143,
+31,145,149,141,147,148,26,163,124,155,116,112,122,121,110,100,171,112,187,
+185,188,160,175,173,30,190,192,172,217,208,26,185,115,186,104,162,30,120,
+151,124,144,108,143,8,14,251,252,247,116,247,179,21,101,140,128,143,154,26,
+148,145,162,152,181,30,226,247,166,5,141,146,140,145,142,26,142,137,141,136,
+30,136,6,136,138,5,130,120,135,134,113,31,115,134,122,137,109,134,8,120,7,
+173,140,5,152,147,133,127,135,138,132,135,129,213,10,154,248,160,247,0,21,
+205,247,170,252,140,73,248,74,6,14,248,121,248,64,21,51,6,53,251,205,5,93,
+101,95,115,95,27,99,114,164,180,148,141,155,141,147,31,218,247,176,5,51,6,
+38,252,10,132,111,127,108,120,98,25,105,78,130,113,104,26,111,149,126,162,
+189,165,202,247,14,140,30,183,140,152,143,172,30,149,107,148,125,158,126,
+8,129,155,161,132,161,27,194,188,166,202,194,31,135,124,138,130,128,26,102,
+157,121,175,179,164,152,183,184,30,142,148,5,119,113,125,133,122,27,123,130,
+148,156,148,140,143,146,162,31,14,247,212,247,218,249,13,21,189,6,174,138,
+159,119,151,92,8,159,227,251,237,51,159,6,151,186,159,159,175,140,8,188,251,
+202,6,104,137,133,133,135,30,131,134,139,139,105,135,8,119,247,63,159,7,105,
+143,139,247,44,29,248,63,63,21,150,6,247,46,247,204,5,251,128,7,105,138,136,
+135,134,30,133,132,135,138,105,135,8,119,247,62,159,7,106,143,138,247,44,
+29,247,147,7,178,153,152,181,142,30,159,36,7,251,52,251,201,251,46,247,201,
+5,251,13,119,6,169,138,165,120,152,109,8,251,141,7,91,129,126,97,135,30,119,
+247,23,159,7,96,143,129,151,188,26,247,115,7,14,201,60,29,229,249,15,247,
+18,10,174,170,29,146,142,247,29,29,112,134,121,136,114,135,8,120,7,170,140,
+5,145,6,150,146,132,128,134,139,139,134,123,229,29,248,132,251,76,189,29,
+224,151,155,174,26,195,89,185,79,105,106,127,117,113,30,120,124,129,124,125,
+106,152,131,24,177,167,165,154,150,29,154,225,22,248,140,205,252,140,6,247,
+111,247,174,21,251,111,73,247,111,251,52,205,247,52,247,36,29,90,247,38,249,
+17,21,196,132,153,131,112,140,29,151,141,149,149,174,30,156,199,5,131,164,
+161,137,181,27,223,207,156,170,182,246,10,83,6,159,216,148,167,152,148,179,
+144,25,155,251,130,7,247,32,251,86,21,160,145,151,147,167,27,178,177,130,
+124,159,31,165,120,150,110,91,236,29,135,139,144,109,31,14,229,108,10,247,
+77,247,15,29,159,170,29,145,143,247,29,29,116,135,119,135,112,135,8,120,7,
+169,140,5,146,6,150,146,132,128,135,138,136,135,125,213,10,154,247,56,29,
+247,144,251,12,195,29,248,53,4,194,29,252,21,247,11,251,45,21,204,248,5,74,
+6,204,248,87,21,74,251,250,204,6,14,251,152,247,136,249,56,21,59,76,76,59,
+60,202,75,217,221,202,201,220,219,76,202,59,31,105,4,196,186,89,80,79,92,
+90,81,83,92,189,198,199,186,188,196,31,14,247,22,251,82,21,92,122,147,162,
+153,155,209,160,220,247,31,10,247,60,247,50,218,96,186,66,76,86,104,66,93,
+31,137,141,149,172,155,199,204,247,142,25,134,144,89,130,110,134,66,130,25,
+122,7,238,29,138,133,137,132,132,112,128,98,89,251,74,96,251,53,76,251,133,
+131,107,247,39,29,7,247,79,248,239,21,181,159,111,82,71,110,54,96,77,31,80,
+97,91,108,247,1,29,207,166,193,185,193,27,14,229,108,10,247,78,247,15,29,
+73,248,254,188,29,170,141,139,136,152,110,10,149,138,139,240,29,86,93,99,
+116,101,119,30,14,251,252,247,178,247,250,189,29,223,151,156,174,26,195,89,
+184,78,105,106,127,118,114,30,120,123,129,125,125,106,152,131,24,178,169,
+163,153,150,29,239,247,113,248,132,21,148,138,147,138,146,138,146,138,145,
+138,142,136,8,145,136,141,133,108,26,251,131,7,109,137,132,133,136,30,132,
+135,137,138,108,136,8,124,247,52,154,7,107,142,138,140,131,143,8,133,142,
+138,145,170,26,237,186,7,163,103,149,123,156,109,176,76,153,124,157,138,8,
+202,148,6,119,155,115,165,108,181,82,217,24,191,160,166,174,186,26,195,95,
+174,69,30,251,67,6,247,4,120,21,180,6,185,162,113,87,82,115,107,95,31,97,
+6,186,247,233,82,10,154,247,56,29,14,247,216,248,203,21,179,87,161,87,149,
+69,137,138,24,171,122,110,156,101,27,251,30,251,37,251,52,251,44,52,195,86,
+230,247,49,247,28,247,63,247,91,232,114,206,78,212,31,240,184,107,167,40,
+96,99,172,102,157,94,149,25,104,122,181,122,165,122,174,106,25,251,15,85,
+172,110,5,245,43,21,182,167,102,82,66,106,39,94,74,31,86,103,178,29,14,154,
+247,181,247,145,21,251,88,251,89,187,91,247,88,247,89,247,89,251,89,187,187,
+251,89,247,89,247,89,247,88,91,187,251,89,251,89,251,88,247,89,91,91,5,14,
+251,252,247,41,248,244,188,29,168,144,139,136,151,110,10,148,138,140,240,
+29,85,94,99,116,101,119,30,14,239,248,165,247,132,21,80,111,104,114,82,27,
+49,88,202,247,4,247,3,188,200,228,201,174,110,80,149,31,155,208,6,148,132,
+146,125,144,30,135,140,134,141,5,149,107,113,144,107,27,251,21,50,57,251,
+10,251,6,220,66,247,18,177,165,143,154,188,31,153,143,142,141,141,150,154,
+207,24,251,57,248,62,82,10,90,34,29,89,248,80,157,29,90,34,29,211,248,247,
+43,10,90,34,29,66,248,192,43,29,90,34,29,199,248,78,50,29,90,34,29,158,249,
+22,115,10,90,34,29,247,61,248,210,96,29,146,247,169,125,21,136,157,155,138,
+155,27,242,219,182,245,229,83,29,251,14,208,44,247,1,107,31,83,49,148,131,
+5,144,153,147,141,149,247,65,29,161,134,168,138,10,130,133,138,137,129,31,
+14,90,32,29,251,155,247,98,101,10,90,32,29,251,24,248,9,43,10,90,32,29,251,
+178,247,210,43,29,90,32,29,251,66,247,96,69,10,251,219,41,29,247,80,249,70,
+157,29,251,219,41,29,247,237,249,237,43,10,251,219,41,29,247,87,249,182,68,
+10,247,92,22,111,117,117,113,161,29,14,251,219,41,29,247,222,249,68,69,10,
+146,41,10,251,32,247,91,96,29,201,34,10,63,159,29,14,201,34,10,192,247,132,
+21,89,6,251,48,245,29,14,201,34,10,48,247,77,43,29,201,34,10,178,210,69,10,
+201,34,10,247,31,247,95,110,29,152,27,186,172,176,206,153,31,14,40,10,209,
+248,38,48,29,201,33,10,251,249,208,205,10,130,247,59,29,201,33,10,251,129,
+247,128,43,10,201,33,10,252,7,247,73,43,29,201,33,10,251,146,206,69,10,35,
+37,10,247,114,192,156,29,35,37,10,247,89,247,57,43,29,35,51,29,81,247,126,
+48,29,32,10,94,214,86,29,32,10,211,247,134,43,10,32,10,71,247,79,43,29,32,
+10,194,212,50,29,32,10,168,247,180,21,85,94,94,85,83,182,95,195,194,184,184,
+193,194,94,184,84,31,105,4,175,169,110,102,102,110,111,101,103,214,29,32,
+10,247,66,247,97,67,29,251,108,247,60,128,21,147,6,215,192,169,216,200,31,
+123,149,5,104,10,165,187,247,35,29,60,175,89,206,123,30,83,49,148,131,5,144,
+153,147,119,10,133,138,137,129,31,14,251,108,35,29,240,247,178,55,10,251,
+108,35,29,247,110,248,89,43,10,251,108,35,29,207,248,34,43,29,251,108,35,
+29,247,92,247,176,21,171,160,29,252,18,40,29,37,248,27,55,10,252,18,40,29,
+144,248,194,43,10,252,18,244,113,29,56,252,128,77,29,14,252,18,40,29,157,
+248,25,50,29,39,29,113,248,156,67,29,114,10,127,118,21,182,167,102,82,66,
+107,39,94,74,31,86,102,247,56,10,226,188,211,31,196,178,181,168,182,27,90,
+213,55,10,38,29,196,247,133,43,10,38,29,67,247,78,43,29,38,29,190,211,50,
+29,38,29,247,47,247,96,67,29,251,163,39,10,248,38,248,151,48,29,59,10,251,
+113,248,22,86,29,33,29,251,11,248,189,43,10,59,10,251,136,248,134,43,29,33,
+29,251,3,248,20,50,29,251,108,36,29,247,113,216,155,10,251,108,36,29,247,
+70,247,81,43,29,251,163,42,10,248,5,247,240,48,29,251,237,247,165,247,240,
+21,134,133,134,133,135,133,8,119,123,128,129,132,27,136,136,142,142,143,139,
+139,147,171,31,173,247,14,5,142,152,141,151,149,26,162,122,155,114,103,102,
+106,60,86,30,173,247,1,134,142,114,134,108,133,95,131,25,124,7,171,138,145,
+137,129,26,138,130,81,251,103,5,190,6,166,229,142,147,154,166,8,201,175,179,
+182,162,27,146,143,134,130,133,136,121,133,119,31,114,42,5,130,106,138,133,
+134,26,114,149,128,160,168,152,149,199,184,30,14,45,247,136,46,10,247,47,
+6,51,252,56,5,251,0,116,107,85,112,29,247,1,6,145,171,5,251,0,6,109,10,118,
+93,110,43,8,14,247,10,247,118,46,10,247,69,6,134,126,95,251,100,109,251,42,
+8,251,46,109,111,85,90,247,13,29,145,140,144,144,26,160,122,156,117,164,10,
+145,136,132,135,139,139,127,95,31,77,251,112,126,86,134,10,145,223,247,205,
+151,178,31,142,151,141,148,143,26,139,139,140,138,141,30,168,10,160,170,8,
+177,164,168,108,29,14,247,18,247,122,46,10,247,67,247,26,29,110,251,6,120,
+131,29,102,171,114,185,230,209,240,247,81,181,30,209,247,202,5,247,58,6,130,
+100,136,127,118,56,8,105,251,23,126,77,111,26,109,158,119,167,182,169,163,
+220,199,30,123,148,5,85,93,121,124,125,27,133,134,144,145,155,227,248,11,
+178,247,39,31,154,199,144,159,147,139,10,117,118,141,122,27,82,83,114,97,
+100,31,96,92,119,98,108,40,8,218,22,144,159,5,247,38,175,188,205,212,247,
+30,10,134,131,136,132,133,26,135,140,134,143,131,30,141,133,141,133,135,26,
+136,7,103,251,36,5,14,229,247,133,247,183,21,100,140,128,143,157,26,147,145,
+166,149,176,30,214,247,170,5,140,145,140,144,143,26,143,137,141,136,134,114,
+135,133,108,30,107,133,124,136,116,136,140,120,24,171,140,5,145,6,150,146,
+131,127,134,138,135,136,128,31,61,251,180,134,123,126,134,92,134,25,140,123,
+5,247,75,6,248,40,93,21,208,162,166,164,29,75,189,99,238,10,94,180,130,151,
+220,29,98,90,21,197,88,149,124,105,247,12,10,201,164,30,184,241,10,229,247,
+21,248,253,21,167,170,155,147,165,27,168,161,116,109,93,91,108,39,121,31,
+130,152,7,204,177,102,76,86,103,99,90,128,126,144,153,120,31,151,122,126,
+145,130,27,122,126,127,122,114,165,125,187,247,1,216,204,232,166,132,159,
+124,155,31,130,149,138,140,111,153,135,141,24,216,167,163,160,178,26,183,
+97,173,85,93,99,116,100,118,30,248,164,252,31,21,207,162,167,164,29,74,189,
+100,238,10,95,178,129,153,220,29,97,90,21,194,93,153,118,221,10,192,248,119,
+21,87,6,252,66,253,75,5,191,6,14,229,247,102,249,10,84,29,248,93,251,253,
+21,207,162,167,167,185,26,193,94,175,72,62,88,98,78,107,151,118,179,103,30,
+48,104,109,108,79,26,75,189,99,221,224,201,247,33,10,95,177,128,155,163,26,
+173,164,161,177,175,163,116,103,107,117,114,93,121,30,97,90,21,194,92,153,
+119,221,10,189,241,10,229,247,209,248,249,21,251,85,251,230,172,123,247,121,
+248,39,5,251,98,6,83,44,5,161,6,166,181,146,142,184,140,8,248,43,188,21,252,
+129,253,42,5,185,6,248,129,249,42,5,103,252,81,21,203,164,169,172,183,26,
+186,97,174,83,77,85,94,86,111,152,113,172,103,30,64,109,102,98,84,26,86,185,
+99,201,207,201,196,201,174,123,171,103,176,30,124,154,21,98,181,128,158,166,
+26,174,161,160,174,175,162,118,105,100,120,114,94,114,30,97,103,21,185,94,
+153,115,108,26,96,103,104,95,100,115,164,180,187,168,178,193,164,30,14,251,
+252,247,135,249,57,21,45,48,251,28,251,33,59,178,86,198,232,229,247,18,247,
+23,235,103,196,79,31,136,116,21,168,156,113,93,61,115,43,106,79,31,101,118,
+115,119,113,27,109,122,167,188,201,169,247,8,170,194,31,175,160,161,157,164,
+27,14,251,252,247,206,248,56,21,90,6,211,247,148,5,102,6,251,140,251,147,
+126,94,5,247,47,6,110,34,5,199,6,166,243,5,192,6,38,184,21,251,9,6,247,62,
+247,69,5,14,251,252,247,77,248,252,84,29,14,251,252,247,245,249,63,21,64,
+130,115,132,95,113,8,45,86,80,43,42,26,61,183,89,206,220,208,215,230,201,
+96,184,78,125,123,136,132,122,30,180,212,216,194,208,147,8,251,51,251,46,
+21,178,164,111,96,58,93,67,88,105,119,166,186,178,150,187,155,165,31,165,
+154,158,150,165,27,14,251,252,247,255,232,10,133,148,5,251,117,6,89,55,152,
+130,168,169,153,145,174,140,25,247,13,6,251,110,251,241,5,195,6,14,251,252,
+247,135,248,134,21,206,162,166,166,181,26,190,95,175,77,74,94,102,84,107,
+151,115,175,98,30,68,115,98,97,87,26,78,189,97,210,214,194,186,202,178,122,
+171,91,189,30,84,114,21,202,74,145,129,107,26,93,107,106,94,95,107,172,185,
+186,170,178,192,160,30,178,180,21,96,180,129,154,163,26,178,160,163,174,175,
+163,112,100,103,124,121,91,116,30,14,251,252,192,247,152,21,215,153,163,147,
+183,166,8,226,194,191,227,232,26,218,95,192,73,63,69,62,55,75,177,93,192,
+163,161,146,156,167,30,101,63,56,74,68,128,8,247,69,248,13,21,174,159,112,
+91,94,124,85,123,122,31,124,124,116,130,118,27,103,119,167,190,214,179,200,
+190,31,14,229,247,145,157,21,115,127,141,142,130,31,123,145,130,152,156,26,
+149,142,155,143,154,30,247,23,248,93,159,212,158,154,211,138,25,144,157,5,
+251,160,132,29,162,152,138,135,148,31,155,133,148,126,122,26,129,136,123,
+135,125,30,251,23,252,94,120,70,120,122,78,184,10,247,147,6,247,201,249,24,
+21,198,140,158,128,108,26,128,137,124,135,125,30,251,20,252,82,5,83,123,109,
+104,108,27,122,127,148,153,149,141,143,151,150,31,149,150,143,148,151,26,
+164,119,159,113,104,111,107,100,87,182,100,198,183,187,162,177,177,30,168,
+169,165,189,156,198,245,248,4,24,155,203,161,160,188,141,144,157,24,251,145,
+6,14,90,34,29,247,51,248,236,21,76,114,90,103,78,27,75,100,175,202,134,138,
+29,90,248,10,247,118,21,208,10,247,89,7,117,109,133,123,112,26,86,181,96,
+192,188,180,165,190,247,38,29,116,112,115,130,107,27,102,117,160,175,161,
+144,155,150,150,31,155,7,105,29,160,175,21,247,42,247,152,183,251,152,5,14,
+146,45,10,251,109,247,130,156,10,146,45,10,168,248,41,48,29,146,45,10,251,
+35,247,242,68,10,14,201,66,29,248,65,249,91,48,29,201,60,29,90,32,29,141,
+248,9,48,29,90,32,29,251,59,247,210,68,10,14,90,248,204,247,54,21,68,29,170,
+247,45,5,142,29,248,96,7,118,112,132,121,111,26,86,181,96,192,230,10,105,
+114,160,168,152,144,159,148,162,31,14,201,36,10,104,248,33,21,76,114,152,
+10,185,163,183,173,31,159,166,147,160,149,181,8,14,201,36,10,251,92,247,245,
+68,10,14,251,219,41,29,247,197,249,182,68,10,14,35,44,10,251,3,208,156,29,
+35,44,10,202,251,93,21,223,186,185,135,10,146,41,10,251,232,208,156,10,146,
+41,10,45,247,128,48,29,201,34,10,251,69,159,29,147,251,52,155,29,90,42,29,
+215,247,232,101,10,90,42,29,247,214,248,143,48,29,40,10,251,78,247,127,155,
+29,247,85,124,21,137,155,147,138,151,129,10,106,141,72,157,136,24,72,29,154,
+133,146,137,152,135,84,50,24,199,10,123,143,150,109,31,122,110,5,123,180,
+162,134,168,247,61,10,35,47,10,118,248,19,193,10,201,33,10,251,168,247,174,
+115,10,201,33,10,252,73,208,173,29,133,30,146,251,52,21,175,172,29,14,35,
+51,29,251,206,206,21,174,6,247,63,245,5,150,146,144,147,152,26,160,123,154,
+119,247,23,10,14,35,51,29,251,129,247,71,68,10,14,90,34,29,247,73,248,169,
+73,10,35,47,10,252,118,253,140,50,10,146,249,31,73,29,51,248,41,43,10,247,
+65,38,10,251,242,247,128,43,10,247,65,38,10,252,141,247,73,43,29,35,37,10,
+247,242,247,112,43,10,201,249,54,248,158,21,150,180,156,197,146,145,197,149,
+25,155,251,139,123,7,198,131,150,132,111,26,123,135,119,132,113,30,136,129,
+5,251,177,6,150,180,155,190,164,229,10,123,135,119,132,113,30,136,129,5,63,
+6,129,109,5,217,6,251,4,252,38,93,10,247,5,248,46,5,216,6,148,169,5,252,106,
+109,21,247,178,6,104,251,16,5,251,177,6,14,90,32,29,126,247,187,73,10,191,
+36,10,251,1,248,44,43,10,191,248,187,249,253,197,29,247,21,88,58,29,251,219,
+41,29,248,85,249,159,73,10,251,219,247,29,215,29,154,29,123,247,86,7,117,
+108,134,124,112,26,86,220,10,107,27,102,117,160,175,159,144,154,150,153,31,
+155,7,158,10,7,14,251,114,76,10,88,247,135,43,10,146,52,10,252,175,254,31,
+88,29,35,44,10,251,168,254,31,50,10,146,41,10,252,180,254,31,88,29,201,34,
+10,247,72,247,54,21,251,192,6,128,88,5,247,193,6,14,90,42,29,51,253,16,88,
+29,251,59,248,106,56,10,105,141,73,8,107,248,38,43,10,201,36,10,252,85,253,
+115,50,10,201,33,10,251,11,247,50,73,10,201,248,202,215,29,123,7,145,29,174,
+167,247,0,214,247,154,31,159,208,155,153,208,147,128,10,247,18,186,177,147,
+159,178,30,114,111,129,113,108,163,10,172,170,148,162,179,206,31,170,192,
+153,169,154,190,222,247,177,24,177,247,22,143,144,201,153,8,155,7,14,90,32,
+29,92,247,254,21,76,115,89,117,29,251,219,41,29,248,73,249,226,21,76,114,
+90,137,10,166,148,160,148,181,8,14,247,102,242,21,102,114,109,111,247,6,10,
+247,1,248,16,87,126,93,131,91,135,225,10,141,154,247,48,29,126,133,120,31,
+58,251,174,5,135,125,137,127,131,26,119,159,121,161,169,182,172,202,192,30,
+146,248,167,195,10,243,251,106,21,141,154,144,139,147,27,157,150,129,124,
+133,138,132,134,125,31,36,251,252,119,67,133,125,120,114,25,120,124,117,126,
+118,27,127,132,143,148,133,31,155,148,148,155,157,126,150,119,117,122,123,
+117,112,169,120,179,222,208,215,247,24,177,31,247,7,248,36,84,128,101,133,
+88,135,25,247,23,247,89,195,10,14,252,18,192,248,38,21,230,6,47,252,62,5,
+251,2,115,106,84,96,27,127,131,146,149,142,140,141,142,144,31,143,146,140,
+143,145,26,161,121,156,117,118,123,120,115,105,174,112,183,229,212,241,247,
+77,181,30,237,248,65,139,139,148,166,154,188,152,167,155,161,8,161,156,158,
+150,161,27,152,148,134,131,137,138,136,136,134,247,14,29,159,158,161,177,
+102,166,89,90,99,117,92,102,30,109,99,118,93,108,41,8,45,6,14,32,10,247,55,
+247,123,21,76,115,152,10,186,167,29,82,29,123,141,132,146,131,30,120,113,
+132,118,111,26,88,182,96,191,230,10,103,116,160,172,163,146,150,163,152,31,
+166,154,168,168,187,199,8,76,29,14,251,108,47,29,251,23,248,34,55,10,251,
+108,47,29,247,10,248,201,48,29,251,108,47,29,106,248,146,68,10,14,63,56,29,
+247,132,157,21,224,186,184,135,10,248,51,248,180,21,96,251,53,111,10,127,
+149,5,247,17,10,247,11,173,247,3,31,155,195,156,201,163,231,146,167,24,197,
+6,147,174,5,82,6,165,238,134,144,87,128,103,134,74,132,25,122,7,194,137,146,
+136,117,26,129,138,131,134,120,30,251,60,6,131,104,5,201,251,18,132,10,14,
+251,108,35,29,247,239,248,89,48,29,251,108,35,29,247,70,248,34,68,10,14,251,
+108,102,10,218,174,166,146,157,175,30,112,109,128,113,106,235,10,117,112,
+115,129,107,27,104,115,160,171,183,155,169,192,198,31,155,156,5,145,10,14,
+37,29,247,69,247,123,206,29,181,89,227,192,186,163,183,172,30,159,166,148,
+160,148,181,8,14,37,29,147,247,79,68,10,14,252,18,247,120,53,10,51,248,228,
+21,174,6,247,62,245,5,152,147,144,147,151,26,160,123,154,118,247,23,10,14,
+251,232,247,122,53,10,191,247,214,139,29,112,87,104,30,14,39,29,251,102,248,
+26,187,10,135,133,133,30,14,39,29,175,248,193,193,10,38,29,251,28,213,162,
+29,147,251,52,155,10,251,163,49,29,247,55,148,10,251,163,39,10,247,48,247,
+240,55,10,251,163,39,10,247,165,248,151,43,10,251,163,39,10,131,252,52,88,
+29,251,226,247,189,69,29,133,179,89,29,14,33,29,251,29,248,235,21,85,94,95,
+84,125,10,33,29,251,190,248,22,162,29,146,251,52,21,175,186,29,133,30,14,
+251,163,42,10,247,35,247,73,55,10,251,163,42,10,247,112,247,185,68,10,14,
+247,47,248,151,21,138,136,251,27,252,148,5,103,10,126,151,5,128,29,215,247,
+177,5,247,37,6,146,172,5,251,35,6,174,247,22,234,10,161,140,158,127,125,26,
+126,134,116,131,111,30,137,135,5,87,6,132,106,5,14,252,18,247,188,248,64,
+21,168,29,140,26,146,75,29,251,195,253,46,87,10,146,35,10,248,70,247,136,
+43,10,146,35,10,247,178,247,81,43,29,32,10,247,78,247,56,73,10,251,108,36,
+29,247,214,247,136,43,10,251,114,247,240,85,29,146,248,201,43,10,251,108,
+35,29,247,224,248,11,73,10,251,59,248,105,49,10,219,247,134,43,10,252,18,
+151,29,146,157,31,140,144,141,145,141,146,8,141,7,140,141,134,29,79,133,110,
+119,26,102,155,119,169,186,175,169,223,196,30,219,248,183,65,29,252,18,40,
+29,247,41,248,116,73,10,252,22,247,136,80,10,247,2,249,13,43,10,251,108,58,
+10,251,250,252,4,50,10,252,18,247,120,86,10,174,168,235,203,30,251,145,252,
+20,87,10,39,29,252,11,252,10,50,10,38,29,247,74,247,55,73,10,251,163,247,
+13,22,191,247,62,156,182,185,215,8,196,173,166,169,219,10,156,172,247,33,
+29,97,98,79,124,100,124,103,24,193,247,109,136,141,66,126,128,137,68,127,
+25,122,7,143,160,144,205,29,96,251,162,87,10,251,59,33,29,109,248,178,21,
+76,114,90,103,78,27,75,99,175,202,135,138,29,33,29,159,248,111,73,10,64,29,
+251,1,124,73,117,26,122,145,125,150,130,30,120,113,132,118,112,163,10,173,
+164,145,148,172,157,31,166,154,156,159,190,211,8,14,251,163,49,29,248,45,
+249,41,48,29,251,163,247,33,129,21,138,147,142,139,146,27,224,77,10,123,6,
+247,21,10,152,148,137,131,169,31,80,45,102,29,14,37,29,242,247,179,247,47,
+29,172,168,161,159,165,157,247,7,10,162,165,191,174,30,14,247,155,248,41,
+21,247,44,190,240,245,231,27,200,173,94,57,119,138,125,135,119,31,157,6,192,
+247,103,5,120,6,121,129,126,128,128,27,133,132,141,144,126,31,159,90,129,
+141,108,27,251,19,251,33,251,15,251,57,76,31,89,6,108,98,5,206,6,134,122,
+135,120,134,111,8,87,6,108,98,5,218,123,6,251,36,221,40,247,10,206,189,161,
+187,181,30,156,188,5,79,90,95,114,84,27,56,87,213,247,10,150,139,147,140,
+153,31,247,34,6,169,180,5,251,59,6,144,164,143,158,145,159,8,247,94,6,169,
+180,5,14,247,130,247,121,62,10,248,81,103,21,83,6,157,207,5,140,141,139,141,
+140,26,146,140,135,143,133,27,131,139,139,131,133,31,108,100,104,111,112,
+130,8,119,131,134,134,130,26,136,139,137,140,135,30,190,6,89,251,81,137,130,
+5,138,138,137,138,136,30,132,114,134,118,131,26,122,156,126,160,174,161,158,
+211,188,30,123,148,5,92,103,128,129,130,27,135,136,143,143,140,139,141,140,
+141,31,200,247,124,5,199,6,14,146,42,10,248,169,236,228,10,188,158,107,29,
+55,73,132,132,117,27,129,134,145,151,147,142,152,143,176,10,247,128,163,21,
+78,150,106,192,228,26,237,194,247,68,197,231,30,205,181,197,180,190,27,198,
+182,83,61,119,138,121,135,115,31,164,6,182,247,115,5,118,6,108,126,129,126,
+128,27,136,133,142,144,133,31,162,108,102,151,105,27,52,49,80,35,68,31,77,
+50,102,251,6,39,26,251,30,206,55,247,1,212,211,170,196,199,30,122,157,99,
+105,111,122,101,127,25,187,247,72,170,183,157,156,163,145,25,120,149,147,
+133,155,27,163,156,156,161,158,127,150,118,107,113,122,87,93,31,158,206,129,
+142,251,5,100,134,121,5,142,154,143,140,144,27,148,143,135,130,134,137,130,
+135,124,31,14,252,46,106,10,252,46,106,10,251,219,222,10,247,121,223,10,247,
+65,247,239,248,56,21,89,91,107,122,97,27,89,109,170,193,246,222,246,222,161,
+154,131,126,133,136,135,131,130,31,127,127,135,131,130,26,125,151,127,154,
+161,157,162,167,176,109,162,88,251,5,251,4,251,9,251,10,68,181,96,208,200,
+187,165,204,195,30,248,73,247,150,21,94,6,253,71,253,74,5,185,6,248,218,248,
+2,21,251,4,251,0,251,6,251,9,70,187,90,206,247,5,244,247,3,247,11,210,93,
+187,72,31,129,120,21,177,161,111,92,88,123,83,109,89,31,86,108,106,113,103,
+27,102,114,169,185,189,155,193,169,191,31,192,171,172,165,176,27,14,251,219,
+247,224,248,88,21,97,173,121,168,173,26,153,146,148,150,140,140,139,138,141,
+30,137,148,143,138,148,27,181,168,166,177,165,121,156,110,83,92,86,75,90,
+171,89,189,112,31,14,252,129,223,29,251,219,248,47,248,219,73,10,248,100,
+247,2,21,123,124,132,131,134,134,8,107,108,127,130,130,27,131,133,145,146,
+159,181,247,63,186,247,64,100,29,110,151,127,167,179,163,158,230,214,30,76,
+29,182,247,180,143,29,103,110,168,176,174,169,169,174,31,106,201,187,10,136,
+132,133,30,14,251,59,248,102,59,29,61,249,155,43,10,251,108,35,29,247,196,
+248,78,206,29,140,180,89,227,27,192,186,167,29,252,18,247,0,10,121,125,97,
+29,80,133,109,119,26,108,148,123,161,131,30,122,116,134,123,115,26,85,220,
+10,108,27,101,117,160,174,166,144,146,174,168,31,167,162,155,158,171,187,
+8,166,10,252,23,247,95,53,10,217,247,155,118,10,38,29,247,54,247,122,65,29,
+55,29,201,248,116,86,29,252,18,151,29,145,157,31,140,141,141,147,142,147,
+8,141,7,140,141,227,247,214,136,141,37,120,119,136,101,247,42,29,132,136,
+122,133,119,30,91,251,69,5,124,83,132,106,119,26,102,155,119,169,185,176,
+169,223,196,30,231,248,157,21,106,127,127,181,29,113,146,117,121,29,33,29,
+111,248,152,122,10,164,131,118,192,224,10,175,207,153,31,14,35,44,10,147,
+251,152,118,10,201,34,10,247,52,247,121,21,76,114,90,117,29,40,10,251,243,
+253,121,50,10,35,47,10,252,98,252,224,21,247,37,10,148,141,149,190,29,180,
+162,134,168,27,209,188,174,190,181,107,165,89,130,133,138,137,129,31,183,
+205,5,101,6,14,252,18,240,129,21,179,147,171,169,193,221,126,146,24,75,89,
+124,124,247,22,10,227,247,225,5,223,6,144,171,5,168,29,141,26,145,137,142,
+133,133,136,138,131,133,30,99,87,79,90,107,130,8,114,131,132,133,129,26,132,
+213,7,67,251,167,137,130,5,138,137,134,137,133,30,130,108,131,107,128,26,
+124,149,127,156,133,30,84,50,112,10,129,134,138,137,129,31,14,191,63,10,251,
+29,247,119,65,29,90,34,29,158,248,200,21,85,94,108,101,99,182,108,196,193,
+185,171,176,178,94,171,83,31,115,4,177,168,118,113,114,110,119,101,103,110,
+159,165,164,169,160,174,31,58,169,21,174,6,247,63,213,5,151,145,144,144,148,
+26,153,123,150,118,129,131,137,134,133,30,14,201,247,17,29,110,145,102,70,
+10,109,146,110,99,26,36,91,251,40,75,47,30,60,84,78,101,68,27,105,116,147,
+160,116,31,247,112,249,38,101,10,247,121,124,29,124,137,125,135,116,101,29,
+198,134,144,136,119,79,10,247,55,248,53,157,10,145,248,68,193,21,99,251,10,
+122,91,127,113,8,109,126,119,123,118,143,10,185,181,177,158,174,167,30,167,
+174,164,191,154,190,247,36,248,139,24,176,247,22,143,144,202,153,8,155,251,
+91,123,7,84,10,5,14,35,247,237,247,255,21,210,247,147,226,29,183,247,55,5,
+209,29,69,251,147,5,42,6,131,104,5,235,6,74,251,130,159,10,197,247,100,5,
+245,6,147,174,5,14,251,103,247,98,248,75,21,100,10,128,133,106,132,111,31,
+63,251,184,5,251,35,103,118,101,141,10,186,180,174,157,175,170,30,172,178,
+160,187,164,233,217,247,187,24,144,161,143,161,153,26,175,247,57,29,14,252,
+18,247,74,247,192,21,164,235,5,223,6,144,171,5,168,29,140,26,146,136,10,114,
+43,5,56,6,131,104,5,221,6,101,251,36,137,129,138,136,116,29,192,247,94,5,
+243,6,146,174,5,14,251,108,247,14,247,68,21,203,194,207,251,83,5,104,151,
+157,122,162,27,158,164,152,160,158,31,160,163,152,157,168,190,125,147,24,
+89,114,108,105,121,27,124,125,159,179,124,31,76,247,66,247,7,241,205,179,
+195,141,25,143,154,5,251,69,6,135,124,5,173,138,146,136,128,26,127,139,139,
+65,76,30,251,24,251,6,206,247,126,75,126,130,137,74,132,25,133,120,5,142,
+161,139,139,145,27,151,150,130,128,134,137,128,135,126,31,42,251,252,5,206,
+6,14,56,202,248,125,21,208,171,182,190,190,26,167,118,163,114,116,119,118,
+115,129,143,130,147,132,30,153,126,142,134,129,26,115,116,117,92,119,30,247,
+140,73,21,77,131,129,138,75,134,133,120,24,142,160,139,139,146,27,151,150,
+130,128,132,136,125,133,119,31,33,251,245,5,211,6,172,247,6,155,195,165,184,
+190,203,25,214,198,175,169,168,27,153,150,126,122,128,136,126,133,118,31,
+62,251,142,5,135,128,137,127,132,26,115,156,123,164,177,182,171,202,186,30,
+130,148,5,103,110,114,118,125,27,132,133,145,147,143,141,147,141,149,31,211,
+247,141,5,144,157,142,159,157,26,178,119,162,106,79,75,81,251,38,37,30,14,
+201,63,10,251,20,247,88,21,105,127,127,128,111,27,124,123,144,153,109,31,
+156,101,113,147,117,247,48,10,148,155,154,164,27,157,163,132,117,192,31,128,
+166,157,134,152,27,186,173,176,207,153,31,14,146,176,29,246,170,187,157,177,
+80,29,109,26,54,90,10,125,247,163,86,29,251,219,129,94,29,248,68,249,191,
+21,106,128,126,128,112,27,124,123,144,153,108,31,156,102,113,146,116,121,
+29,247,65,38,10,252,21,206,50,29,247,65,38,10,252,84,208,157,10,146,35,10,
+247,240,214,247,6,29,155,127,127,146,124,27,119,124,124,120,127,145,130,152,
+128,31,14,146,35,10,247,232,216,131,10,146,144,148,151,26,159,123,155,119,
+130,130,135,133,132,30,14,35,37,10,247,186,190,69,10,251,108,36,29,247,124,
+214,50,29,14,252,46,14,247,232,248,27,248,154,196,10,251,20,251,0,21,146,
+54,150,98,169,94,8,76,181,203,107,222,27,216,199,166,193,181,31,175,186,154,
+184,146,232,128,89,128,117,113,109,8,84,91,79,113,58,27,58,79,165,194,91,
+31,113,169,128,161,128,189,8,247,238,247,0,196,10,251,1,247,104,121,10,137,
+90,21,247,69,247,33,251,32,251,68,251,67,251,33,251,33,251,67,251,65,251,
+35,247,33,247,62,247,71,247,30,247,34,247,68,31,14,247,232,248,137,249,110,
+121,10,251,1,251,99,197,10,251,20,251,5,21,151,89,149,117,165,109,8,84,187,
+199,113,220,27,220,199,165,194,187,31,165,169,149,161,151,189,132,54,128,
+98,109,94,8,76,97,75,107,56,27,62,79,166,193,97,31,103,186,124,184,132,232,
+8,247,238,247,5,197,10,14,247,232,248,135,111,21,156,222,199,243,247,11,247,
+43,180,192,155,160,154,163,8,177,202,157,194,193,26,220,68,207,55,91,95,118,
+101,106,30,118,114,129,117,126,93,8,242,103,86,187,58,27,54,72,70,52,74,163,
+86,220,251,1,31,247,44,251,95,178,72,165,36,8,14,247,232,248,149,249,137,
+21,66,251,19,77,51,251,33,251,69,240,251,15,247,53,251,120,153,97,222,247,
+32,223,247,11,247,3,247,26,251,11,247,38,42,247,29,77,247,1,8,14,247,232,
+249,131,22,159,7,132,141,116,144,62,158,139,140,112,156,25,69,187,100,216,
+228,26,148,7,155,7,159,103,148,126,151,124,8,92,177,200,109,193,27,230,211,
+213,232,231,74,210,57,113,128,136,121,103,31,136,138,130,134,130,135,8,168,
+183,149,165,176,26,229,67,210,47,46,68,69,49,103,146,120,173,86,30,163,88,
+120,145,112,27,61,73,64,51,45,211,67,233,219,209,190,229,182,31,140,114,5,
+131,7,84,113,69,101,95,30,92,90,138,138,251,14,110,131,137,24,119,7,14,247,
+232,248,171,247,153,21,127,7,68,107,69,90,102,30,108,98,86,122,87,27,126,
+116,248,119,162,6,251,50,145,60,227,142,247,61,8,53,185,182,109,218,27,205,
+196,202,212,208,115,176,251,1,239,31,251,2,241,122,165,99,247,9,124,48,77,
+48,35,57,8,60,73,103,81,76,26,64,200,77,212,180,180,156,169,172,30,158,157,
+150,154,156,176,8,14,201,248,193,248,229,21,68,188,156,120,156,27,149,147,
+146,149,145,138,143,132,153,31,116,182,122,203,183,26,169,137,145,126,134,
+132,136,131,126,30,119,112,61,118,96,27,113,138,131,134,126,26,117,173,129,
+226,133,30,37,251,77,5,151,108,110,145,107,27,251,26,251,0,251,0,251,26,251,
+25,247,0,251,0,247,26,247,25,247,0,247,0,247,26,216,102,211,76,185,31,251,
+34,123,21,238,220,59,40,40,59,58,40,39,59,219,238,238,219,220,238,31,14,201,
+248,25,247,167,21,179,147,156,144,164,154,8,208,179,180,210,218,26,247,13,
+41,237,251,14,251,13,41,41,251,13,60,180,69,208,98,30,163,124,156,133,179,
+132,8,62,251,41,87,247,41,251,44,195,247,44,247,40,191,251,40,7,108,248,93,
+21,231,213,67,50,48,66,66,49,49,66,212,229,227,212,213,226,31,14,247,129,
+247,67,21,146,124,118,143,123,27,77,84,86,80,104,165,117,180,186,183,162,
+177,166,31,159,166,145,161,141,187,8,247,185,7,195,131,185,64,55,26,89,131,
+101,115,84,30,166,6,175,182,158,194,197,26,215,110,209,81,210,30,88,199,138,
+141,134,145,131,149,25,197,95,7,14,247,232,247,205,248,119,21,110,102,124,
+103,133,91,8,251,5,84,247,5,6,143,97,158,91,166,106,59,60,24,177,101,219,
+219,177,110,178,123,184,134,25,251,5,193,247,5,7,183,144,185,158,171,165,
+219,59,24,176,177,59,219,168,174,156,181,144,184,25,247,5,194,251,5,6,134,
+182,121,183,112,173,218,218,24,102,177,59,59,105,166,98,156,92,146,25,247,
+4,85,251,4,7,96,134,95,121,104,111,59,219,24,101,101,5,247,156,85,21,236,
+216,64,45,43,63,62,44,45,62,216,234,231,216,217,230,31,14,247,232,250,66,
+249,143,21,254,9,254,9,250,9,6,252,81,248,222,21,220,204,75,61,58,75,75,59,
+60,75,203,219,216,204,205,215,31,14,201,248,2,248,155,21,251,39,251,9,251,
+6,251,35,251,38,247,7,251,8,247,37,247,35,247,8,247,8,247,36,247,33,251,8,
+247,10,251,31,31,131,78,21,247,4,229,51,251,1,251,3,51,50,251,2,251,2,50,
+228,247,2,246,228,230,245,31,14,247,232,248,141,248,247,21,251,52,251,20,
+251,17,251,48,251,50,247,18,251,19,247,49,247,48,247,19,247,19,247,48,247,
+46,251,19,247,21,251,43,31,248,73,247,52,21,254,9,254,9,250,9,6,252,84,249,
+139,21,247,70,247,35,251,32,251,66,251,68,251,32,251,34,251,68,251,66,251,
+33,247,33,247,67,247,63,247,34,247,37,247,60,31,14,247,232,247,34,22,249,
+96,247,250,253,96,6,14,201,247,20,29,14,201,247,20,29,179,252,63,21,248,23,
+248,23,252,23,7,14,201,248,208,247,103,21,251,103,248,36,251,103,252,36,5,
+14,201,247,249,4,249,3,161,10,253,3,6,14,201,249,102,247,249,21,203,253,3,
+154,10,201,249,3,248,55,21,252,160,6,247,102,220,116,192,251,178,251,20,5,
+62,247,27,29,248,160,247,4,10,247,19,5,216,7,251,178,247,20,116,86,5,14,201,
+248,27,22,249,3,7,220,251,102,192,163,251,20,247,177,5,62,6,251,19,251,177,
+191,115,221,247,102,5,253,3,7,14,201,248,27,249,102,21,75,253,3,6,57,247,
+102,87,201,10,14,201,247,222,249,3,127,29,162,247,20,10,116,5,14,201,247,
+91,44,21,81,247,219,197,7,251,88,249,66,127,29,163,247,20,10,115,5,14,53,
+247,144,22,199,138,247,89,248,11,251,81,248,2,5,76,6,251,88,251,255,5,247,
+114,251,211,21,251,51,247,210,247,56,247,199,247,49,251,202,5,14,201,248,
+208,248,175,21,252,58,6,247,103,252,36,5,14,201,247,254,248,133,21,251,11,
+43,43,251,12,251,11,235,44,247,11,247,12,234,234,247,11,247,12,43,235,251,
+11,31,14,247,232,250,8,248,237,21,75,251,72,252,195,6,171,29,249,3,6,14,251,
+219,197,247,130,21,247,66,251,232,5,124,147,149,131,151,27,147,144,143,146,
+146,137,147,136,147,31,251,23,247,221,247,23,247,221,5,142,147,141,147,146,
+26,147,134,143,131,127,131,133,121,129,30,14,251,219,247,167,247,130,21,251,
+66,247,232,5,156,130,130,146,127,27,131,134,135,131,133,141,131,142,130,31,
+247,23,251,221,251,23,251,221,5,136,132,137,131,132,26,131,144,135,147,151,
+147,145,156,149,30,14,72,248,39,248,28,21,251,105,6,65,247,77,5,45,6,247,
+125,252,213,5,222,6,247,125,248,213,5,45,6,34,251,157,21,63,251,72,64,247,
+72,5,14,247,191,247,184,21,251,148,247,217,5,129,117,134,119,118,26,119,146,
+124,159,113,30,209,52,83,34,5,121,106,129,111,119,26,119,148,117,159,104,
+30,165,96,139,139,128,26,121,126,129,117,30,121,78,221,6,226,162,154,198,
+179,130,158,84,212,31,105,185,127,167,168,26,158,143,151,158,174,30,247,191,
+252,11,5,149,160,144,157,159,26,160,131,157,114,170,30,100,189,5,102,185,
+129,160,172,26,158,142,153,151,170,30,183,245,5,161,6,161,149,129,114,143,
+31,148,170,143,165,168,26,191,122,159,95,30,71,6,100,126,150,171,31,155,7,
+110,108,125,106,99,26,112,147,115,153,126,30,129,149,153,135,170,27,179,6,
+14,251,128,189,22,247,217,248,213,251,217,55,247,133,251,54,251,133,55,247,
+133,251,55,251,133,6,14,201,248,226,248,233,21,109,134,111,132,117,30,113,
+129,128,129,118,27,121,132,150,203,112,31,118,189,121,167,117,157,8,167,107,
+96,154,90,27,251,15,37,43,251,9,81,160,93,182,101,31,176,107,170,126,199,
+130,144,176,24,89,148,115,149,112,160,8,106,166,119,183,184,26,221,208,210,
+219,194,172,109,51,182,30,74,171,170,114,190,27,213,178,195,244,140,31,151,
+7,164,251,229,21,132,169,134,155,131,156,8,184,119,105,163,93,27,66,75,79,
+70,114,146,109,151,112,31,182,43,139,139,140,113,8,103,141,104,108,95,27,
+101,110,156,183,108,31,94,202,139,139,134,144,124,157,116,156,116,150,8,152,
+113,107,146,110,27,130,6,138,104,174,127,153,129,158,111,25,195,48,139,139,
+165,112,8,103,173,178,120,180,27,186,201,162,173,184,31,181,171,159,172,175,
+26,156,135,156,128,162,30,89,247,7,136,147,164,26,168,161,161,168,178,162,
+113,75,154,30,14,247,10,247,8,151,21,155,149,147,146,150,27,149,148,136,134,
+146,31,108,186,139,139,166,27,178,180,168,188,172,31,168,183,154,197,208,
+26,196,7,140,146,145,139,142,27,161,152,136,132,149,31,152,131,142,131,151,
+91,181,251,60,24,95,150,154,116,158,27,172,182,169,188,178,31,126,153,5,135,
+128,134,137,133,27,118,128,152,177,130,31,110,247,3,124,195,125,161,110,157,
+25,233,172,179,176,192,26,219,75,200,55,83,96,120,92,94,30,181,113,92,164,
+88,27,41,61,56,34,78,157,110,198,106,31,178,117,157,118,114,26,133,138,131,
+137,129,30,150,136,5,172,178,151,163,165,26,161,125,156,108,155,30,84,167,
+139,139,131,146,8,118,156,128,161,165,26,193,179,180,191,206,170,88,251,3,
+30,251,40,7,83,136,114,129,110,30,120,132,125,121,129,27,134,133,142,144,
+131,31,156,116,124,145,120,27,98,112,110,74,117,31,247,195,247,251,21,222,
+137,151,127,182,30,160,168,157,145,170,27,194,178,103,89,106,120,108,109,
+123,31,110,124,121,133,77,124,8,14,146,170,249,10,21,247,149,253,10,5,227,
+6,247,151,249,10,5,251,195,252,164,21,251,74,248,91,5,248,1,6,14,146,172,
+22,248,238,6,251,173,249,68,5,251,142,253,17,21,247,105,248,94,247,81,252,
+94,5,14,201,247,253,210,21,68,221,5,248,131,97,252,82,7,87,199,5,82,6,247,
+114,251,154,247,114,247,154,5,82,6,87,79,5,248,82,97,252,131,7,14,201,247,
+253,248,213,21,210,57,5,252,131,181,248,82,7,191,79,5,196,6,251,114,247,154,
+251,114,251,154,5,196,6,191,199,5,252,82,181,248,131,7,14,247,232,248,207,
+247,212,21,247,73,205,251,40,6,186,232,80,169,77,251,15,5,251,174,73,247,
+141,6,71,251,26,5,251,73,73,247,40,6,92,46,198,109,201,247,15,5,247,174,205,
+251,141,6,14,247,232,247,140,247,183,21,76,248,140,202,7,252,140,247,33,21,
+76,248,140,202,7,252,140,251,173,21,76,248,140,202,7,14,201,248,91,74,21,
+247,50,250,104,83,148,251,15,253,149,251,78,248,13,251,55,60,163,88,234,186,
+5,14,247,232,248,179,248,212,21,213,138,177,136,197,30,137,167,138,170,152,
+26,176,150,162,157,144,145,136,136,141,30,111,156,146,134,157,27,158,154,
+153,157,166,115,157,104,104,110,122,109,122,31,115,95,125,32,251,33,26,251,
+237,7,67,140,101,142,80,30,141,109,140,111,121,26,105,127,116,120,131,133,
+144,152,132,30,156,129,132,144,125,27,119,124,124,121,113,163,121,174,174,
+168,156,169,156,31,163,183,153,246,247,33,26,14,201,248,48,251,97,21,248,
+250,7,183,135,200,129,243,30,135,181,137,161,151,26,157,145,149,151,145,141,
+138,128,150,30,130,149,150,134,153,27,165,161,161,166,170,111,163,104,95,
+108,108,81,125,31,123,75,134,66,251,65,26,252,242,7,14,201,247,231,249,180,
+21,252,251,7,96,143,78,149,35,30,143,97,141,117,127,26,121,133,129,127,133,
+137,140,150,128,30,148,129,128,144,125,27,113,117,117,112,108,167,115,174,
+183,170,170,197,153,31,155,203,144,212,247,65,26,248,242,7,14,247,232,249,
+58,247,108,244,10,186,50,121,146,94,27,93,108,118,75,93,31,193,107,242,10,
+91,228,157,133,184,27,185,170,160,204,185,31,85,247,97,244,10,187,50,121,
+145,94,27,93,109,118,74,92,31,193,108,242,10,92,228,157,132,184,27,185,173,
+163,200,182,31,14,247,232,249,24,22,157,205,5,252,48,6,121,73,5,248,209,248,
+219,21,252,113,251,129,137,133,247,235,251,140,165,232,251,147,247,76,247,
+246,247,66,5,14,247,232,247,144,22,248,48,6,157,205,5,252,48,6,146,165,21,
+248,114,247,129,141,145,251,235,247,140,113,46,247,147,251,76,251,246,251,
+66,5,14,247,121,247,151,247,0,21,247,104,248,74,205,252,140,251,170,7,14,
+247,232,249,100,248,195,21,79,251,141,6,38,134,98,124,110,30,91,114,83,107,
+80,27,87,88,164,179,111,31,116,172,133,180,247,4,26,247,141,79,251,138,7,
+251,29,144,105,163,99,30,74,177,209,102,222,27,215,203,170,195,180,31,172,
+184,145,171,247,41,26,14,247,232,249,100,22,247,138,7,247,29,134,173,115,
+180,30,202,101,68,177,57,27,63,75,108,83,98,31,106,94,133,107,251,41,26,251,
+138,199,247,141,7,240,145,182,156,170,30,185,164,194,169,196,27,192,191,113,
+97,167,31,160,107,145,102,251,6,26,251,141,7,14,247,232,249,147,247,108,21,
+200,252,98,7,145,246,195,189,247,1,137,8,247,183,201,251,172,215,10,56,247,
+34,10,201,251,183,6,251,1,137,83,189,133,245,8,14,247,232,248,106,248,234,
+21,252,173,251,161,78,248,234,200,251,160,248,173,7,14,247,232,248,136,247,
+164,21,96,178,135,142,120,153,8,165,106,96,155,106,27,69,81,81,69,69,197,
+81,209,173,180,155,165,173,31,158,153,143,142,182,178,184,100,143,135,156,
+126,8,113,174,180,123,173,27,209,197,197,209,209,81,197,69,106,96,123,113,
+105,31,122,126,134,135,95,100,8,172,109,21,190,190,191,169,179,27,183,176,
+102,95,94,102,102,95,100,88,168,192,86,31,74,22,87,87,87,110,100,27,95,102,
+176,183,183,176,176,184,178,190,110,87,191,31,14,247,232,249,62,247,59,21,
+90,140,109,156,86,197,8,192,185,176,161,182,27,139,142,139,142,138,30,201,
+127,7,79,81,103,73,89,31,207,85,81,173,80,27,61,83,82,58,59,192,84,217,191,
+190,163,185,181,31,147,147,144,145,155,157,195,70,203,102,199,142,8,251,121,
+247,30,21,135,134,139,139,133,133,8,92,93,106,121,98,27,99,112,169,185,185,
+167,168,184,173,162,127,94,187,31,149,130,139,139,148,130,8,14,247,232,247,
+144,247,201,21,190,163,184,170,190,27,176,182,127,114,197,31,107,209,157,
+134,179,27,205,194,167,196,183,31,86,183,5,102,109,102,119,104,27,107,111,
+147,176,45,31,163,77,110,146,104,27,60,86,103,56,96,31,171,54,21,80,248,196,
+198,7,252,197,251,8,21,80,248,196,198,7,14,247,228,249,121,247,20,21,103,
+110,109,103,103,169,110,175,174,169,169,174,176,110,168,102,31,252,125,22,
+103,239,10,102,31,247,138,248,133,21,102,239,10,103,31,14,247,232,249,69,
+249,85,21,253,114,7,84,138,120,119,84,246,29,249,59,7,196,160,162,192,30,
+156,157,253,159,121,155,6,193,159,117,81,140,31,253,59,7,84,138,119,119,85,
+246,29,249,114,7,14,247,232,247,238,249,91,21,247,133,6,244,138,165,117,154,
+38,8,162,6,130,247,57,5,252,175,6,247,102,252,103,251,110,252,44,5,248,200,
+6,188,247,102,5,116,6,111,59,108,120,38,140,8,251,188,6,247,73,247,244,5,
+14,251,135,247,134,247,155,21,196,198,173,180,162,177,8,178,203,163,209,192,
+26,189,114,171,99,57,79,251,19,251,182,84,30,118,114,118,117,126,127,8,125,
+126,134,132,132,26,131,146,129,145,146,165,161,161,160,30,132,68,137,116,
+114,26,81,164,106,184,171,165,158,177,162,30,152,159,146,158,151,26,148,134,
+145,130,131,134,134,126,133,30,100,120,126,125,122,27,128,133,148,155,164,
+154,243,153,213,31,148,194,21,247,121,177,166,217,178,27,154,149,124,117,
+112,129,94,124,101,31,116,81,111,95,86,81,8,14,247,3,249,54,21,162,185,170,
+148,177,27,237,198,42,251,53,109,137,115,134,91,31,190,75,103,154,88,27,91,
+101,122,104,104,31,92,92,112,74,74,26,32,222,53,243,200,193,165,187,179,30,
+195,208,177,247,29,247,30,26,247,87,251,8,247,42,251,43,100,104,131,119,84,
+30,247,192,252,49,21,122,251,10,125,85,111,93,8,92,111,101,113,100,27,84,
+105,190,224,247,8,205,233,221,176,165,126,97,181,31,14,247,232,248,139,249,
+75,21,251,92,142,10,251,85,31,135,251,208,21,251,82,247,80,5,184,194,204,
+162,209,27,208,204,116,96,195,31,179,99,21,187,81,162,77,66,26,67,116,75,
+93,83,30,251,84,247,87,5,247,44,251,127,21,95,84,72,115,69,27,69,75,162,186,
+80,31,247,85,247,85,5,251,125,251,45,21,95,193,116,203,209,26,211,162,203,
+186,196,30,247,82,251,80,5,14,127,247,186,248,38,21,251,14,67,76,60,58,26,
+113,146,111,155,97,30,88,64,124,106,98,26,85,176,99,188,193,182,192,206,179,
+124,186,98,224,30,177,187,179,179,195,185,8,192,201,176,158,175,27,172,162,
+109,95,85,115,62,105,89,31,100,114,101,115,106,27,108,111,160,162,152,146,
+146,153,140,31,161,141,154,154,158,26,155,127,151,122,110,115,108,101,93,
+175,107,190,189,196,172,194,186,30,180,186,161,195,194,26,208,99,185,81,60,
+72,92,251,56,251,49,30,130,158,136,157,161,26,214,178,193,233,194,30,251,
+56,251,224,21,180,64,156,95,106,26,108,118,117,109,102,112,170,182,178,146,
+155,189,215,30,14,247,232,248,61,141,21,137,161,145,139,173,27,247,172,201,
+251,183,6,123,6,247,109,248,6,5,229,201,86,6,167,187,97,164,96,66,5,251,62,
+247,40,29,67,43,26,251,16,190,53,229,110,30,111,90,180,113,5,247,126,248,
+131,21,251,105,251,255,5,68,158,105,197,240,26,247,21,191,195,247,13,30,14,
+247,232,249,23,248,54,21,252,68,252,54,5,248,214,181,252,105,6,247,244,247,
+234,5,14,247,232,247,125,201,247,10,29,183,172,211,242,26,246,210,29,247,
+13,191,84,251,22,251,22,87,84,251,13,31,14,247,232,249,147,201,21,251,183,
+6,251,13,87,194,192,10,102,31,74,96,105,67,43,26,251,7,184,55,247,34,10,6,
+14,247,232,247,125,247,58,247,10,29,182,172,212,238,26,247,4,93,224,61,237,
+10,247,13,191,83,251,21,251,22,87,83,251,13,31,247,135,251,3,21,252,170,84,
+248,170,6,14,247,232,249,147,247,58,21,251,183,6,251,13,87,195,192,10,101,
+31,75,96,105,66,43,26,42,167,72,198,93,30,107,179,176,130,229,27,247,172,
+6,90,4,252,170,84,248,170,6,14,247,232,248,164,247,108,21,247,131,200,251,
+96,6,227,247,47,5,247,8,201,58,6,172,198,97,163,92,56,5,251,35,215,10,55,
+220,105,30,106,82,182,116,177,206,5,136,164,153,138,180,27,247,172,201,251,
+183,6,119,133,139,140,129,31,171,247,45,21,58,251,33,87,157,108,190,136,211,
+25,247,182,247,108,21,51,251,47,5,251,94,6,145,246,195,189,247,1,137,8,14,
+201,219,247,187,21,221,210,5,248,188,181,252,139,6,191,29,248,139,181,252,
+188,6,14,201,249,23,247,187,21,57,68,5,252,188,97,248,139,177,10,252,139,
+97,248,188,6,14,201,247,97,248,44,21,191,29,247,204,177,10,251,253,97,21,
+248,46,6,221,68,57,68,5,252,46,6,57,210,5,14,175,50,247,46,10,252,174,251,
+9,247,46,10,14,247,131,249,190,21,90,248,133,188,7,14,247,232,243,177,21,
+170,102,247,12,239,5,64,208,225,100,236,27,247,79,247,44,247,47,247,83,214,
+118,207,94,202,31,247,3,231,107,177,251,2,46,5,207,71,57,174,47,27,251,80,
+251,44,251,47,251,82,68,159,74,177,80,31,177,171,21,107,191,125,191,197,26,
+247,59,247,22,247,27,247,52,217,208,109,80,197,30,170,101,21,173,89,158,76,
+76,26,251,58,251,22,251,27,251,51,56,65,173,205,81,30,14,251,32,220,247,70,
+21,154,135,5,143,148,141,145,140,26,162,199,143,150,147,160,159,186,25,192,
+247,19,5,170,213,159,207,168,26,165,126,153,114,146,10,247,245,224,21,154,
+135,5,141,145,143,148,140,26,162,199,142,149,156,180,151,167,25,192,247,19,
+5,169,213,160,207,168,26,165,125,153,115,146,10,14,247,34,29,14,247,34,29,
+179,251,217,21,247,177,247,177,251,177,7,14,247,211,147,22,250,86,211,254,
+14,250,3,67,6,14,252,77,247,23,248,23,21,160,6,206,247,34,5,173,213,145,154,
+155,26,159,124,153,116,119,121,129,122,128,30,125,119,134,117,132,69,8,14,
+251,135,247,214,248,23,21,161,6,207,247,33,5,159,181,156,187,156,26,159,125,
+152,117,118,117,127,122,129,30,126,118,135,119,132,68,8,251,83,251,32,21,
+160,6,206,247,34,5,174,214,144,152,156,26,159,124,153,117,120,120,129,122,
+127,30,125,119,134,118,132,68,8,14,247,232,247,45,22,249,80,248,37,6,251,
+243,247,220,251,241,251,220,5,200,251,242,21,247,220,7,247,180,247,162,247,
+182,251,162,5,251,220,7,14,90,247,151,22,124,247,47,5,73,183,98,228,234,26,
+192,152,198,162,188,30,201,169,188,175,195,27,195,188,103,77,169,31,162,90,
+152,80,86,26,44,97,50,74,95,30,124,251,47,5,247,136,247,45,119,6,94,132,123,
+121,104,27,251,13,6,141,177,5,246,184,201,232,247,8,26,187,127,190,116,186,
+30,239,91,54,197,42,27,42,54,81,39,91,31,116,92,127,88,91,26,251,8,201,46,
+246,94,30,142,101,5,251,14,6,104,123,157,184,132,31,119,251,45,6,14,247,232,
+248,98,247,134,21,34,101,177,74,223,212,120,251,3,5,219,6,120,247,3,223,66,
+177,204,34,177,244,176,101,204,55,66,158,247,3,5,59,6,158,251,3,55,212,101,
+74,5,14,247,232,247,125,247,108,21,248,98,6,134,33,82,88,251,1,142,8,251,
+183,77,247,172,6,222,174,146,164,177,31,205,183,171,211,241,26,247,0,210,
+29,247,1,141,196,88,144,33,8,252,98,6,14,79,248,155,247,142,21,138,211,135,
+174,125,176,8,219,110,68,187,52,27,251,22,57,35,251,55,251,55,218,41,247,
+24,238,207,191,235,165,31,100,6,70,110,88,104,66,27,98,105,151,162,116,31,
+122,155,131,156,128,178,8,244,7,247,166,174,21,251,164,232,6,213,171,173,
+165,205,27,206,192,102,76,159,31,14,201,248,238,248,11,21,252,92,247,73,5,
+251,254,7,14,201,248,213,247,86,21,247,254,7,252,92,251,73,5,14,201,248,19,
+248,87,21,158,114,161,120,160,127,195,107,148,133,144,130,8,145,128,143,120,
+118,26,251,124,7,146,122,116,143,120,27,70,77,86,79,104,168,117,184,190,187,
+162,177,170,31,160,166,146,161,141,188,8,248,0,7,140,211,106,213,93,167,84,
+175,109,159,135,143,8,126,153,133,157,162,26,152,95,252,128,7,146,123,116,
+143,121,27,70,79,86,79,104,167,117,183,190,187,162,177,168,31,160,166,146,
+161,141,188,8,142,248,10,21,247,3,79,163,103,143,251,8,251,6,200,116,174,
+135,247,9,8,14,90,248,7,247,100,71,29,90,247,62,232,10,134,122,5,196,138,
+159,129,108,181,10,121,69,120,123,73,138,25,114,29,117,183,108,163,30,164,
+107,92,217,10,44,70,75,34,127,121,140,140,120,31,130,104,21,163,6,240,186,
+102,59,34,63,66,251,3,118,126,141,145,111,31,14,48,71,10,66,248,96,22,151,
+249,42,5,120,6,252,141,253,42,5,248,52,180,21,251,151,6,113,124,146,152,147,
+149,158,151,156,31,247,182,248,21,5,14,90,247,157,247,223,174,10,117,61,106,
+222,29,127,138,132,227,29,160,156,169,29,120,121,80,235,29,117,90,119,171,
+10,35,247,41,178,21,248,111,249,3,5,252,129,6,87,251,48,5,164,6,169,236,184,
+162,247,49,137,8,247,22,6,252,111,253,4,5,248,139,6,194,247,70,5,118,6,106,
+32,76,106,251,67,140,8,14,201,51,10,201,248,182,248,93,21,122,6,79,118,119,
+126,73,27,105,6,88,119,151,168,147,140,151,141,151,31,122,6,83,251,109,5,
+156,6,160,200,156,151,210,140,8,171,6,193,157,129,110,131,138,125,136,126,
+31,156,6,135,248,73,21,251,12,251,7,91,57,62,31,61,55,88,251,21,251,9,26,
+251,41,232,54,247,56,247,12,247,1,185,222,216,30,220,226,190,247,22,247,9,
+26,214,114,199,92,177,30,176,93,73,160,69,27,133,106,21,172,177,129,124,163,
+31,179,114,160,90,72,26,36,101,251,20,81,44,30,51,86,57,91,41,27,103,102,
+148,156,112,31,101,162,119,185,201,26,247,13,191,247,52,205,223,30,208,194,
+213,176,223,27,14,251,219,46,29,146,247,160,247,241,21,247,22,29,120,129,
+97,136,247,50,10,137,109,163,148,29,185,136,143,137,126,26,131,138,137,119,
+153,10,195,159,128,109,128,137,124,135,125,31,251,15,252,94,122,70,119,122,
+76,184,10,247,160,204,29,112,123,182,10,156,26,152,141,151,143,154,30,14,
+83,248,14,248,116,21,123,252,25,83,10,14,247,65,227,10,136,147,138,150,134,
+25,154,132,149,130,131,26,137,138,135,138,135,30,251,25,252,132,122,70,120,
+122,76,184,10,247,99,150,10,112,124,182,10,155,26,150,141,154,143,154,247,
+31,29,247,251,248,175,251,14,252,70,120,70,120,122,75,184,10,247,159,150,
+10,114,125,183,29,155,26,152,141,152,183,10,211,158,157,154,208,27,144,157,
+5,251,57,6,14,146,247,151,248,176,21,247,105,252,184,5,154,6,247,43,248,201,
+157,208,157,155,203,141,25,143,157,5,251,98,132,29,164,154,247,42,10,129,
+137,124,135,124,30,36,252,19,251,79,248,119,5,251,68,6,134,122,5,159,6,181,
+162,126,105,161,31,251,24,252,129,121,69,120,123,75,184,10,247,101,204,29,
+112,124,182,10,156,26,152,141,151,143,154,30,14,118,248,199,247,80,21,123,
+6,102,50,92,105,48,138,8,47,6,48,6,62,105,167,202,148,140,147,140,155,31,
+123,6,89,251,80,5,248,135,6,247,51,232,10,252,103,6,93,251,63,5,156,6,165,
+218,178,164,237,137,8,247,54,6,225,165,124,87,129,138,131,136,122,31,156,
+6,54,115,21,122,6,120,74,107,119,61,141,8,82,6,92,124,142,152,125,31,130,
+147,135,149,152,26,148,140,148,143,157,30,121,6,75,251,133,5,156,6,157,208,
+165,158,214,140,8,220,6,195,161,126,106,127,138,130,133,117,31,156,6,14,201,
+248,107,249,52,21,56,48,95,64,70,31,52,46,87,251,15,251,4,26,251,36,226,48,
+247,29,225,210,247,15,10,247,35,50,234,251,26,30,133,102,21,218,186,80,40,
+50,104,251,13,85,37,31,51,92,71,86,71,27,63,89,201,232,247,5,195,247,53,212,
+238,31,191,177,193,170,190,27,14,201,249,179,232,10,253,18,132,29,163,152,
+247,42,10,126,137,127,135,124,30,251,14,252,93,247,3,29,144,157,5,99,10,247,
+10,248,74,157,211,159,155,211,138,25,234,6,190,160,126,110,129,137,125,134,
+123,31,251,9,252,74,122,70,120,122,247,18,29,116,126,172,10,212,158,158,153,
+212,27,14,90,247,185,247,216,21,129,178,155,136,170,27,247,38,239,220,247,
+10,233,60,197,251,20,31,251,115,132,29,164,154,138,135,149,31,155,133,149,
+125,123,181,10,122,69,120,123,74,184,10,247,163,150,10,111,122,182,10,156,
+26,148,141,155,143,154,247,13,10,205,179,97,71,93,116,86,106,109,31,114,111,
+99,125,97,27,119,126,141,146,114,31,14,73,248,221,249,43,21,252,115,6,247,
+18,251,240,251,210,251,207,5,248,154,6,239,247,63,111,148,5,57,90,105,122,
+251,9,27,251,79,6,110,129,143,149,146,158,164,166,166,31,247,97,247,99,42,
+247,157,5,247,57,6,238,169,122,81,127,138,124,138,123,31,171,6,14,35,248,
+71,249,2,21,236,6,193,166,116,92,120,137,120,134,113,31,156,6,185,247,66,
+5,252,179,6,92,251,66,5,158,6,158,230,200,185,237,136,8,202,6,251,30,252,
+153,5,66,120,120,125,65,27,135,121,5,247,182,150,10,129,6,110,123,141,142,
+129,31,123,145,129,153,156,26,149,141,154,143,154,30,14,35,61,29,14,240,249,
+16,48,10,90,230,29,112,118,124,103,30,122,6,133,121,5,247,147,204,29,126,
+6,92,216,29,160,201,141,217,29,128,135,131,118,114,31,251,38,251,70,96,247,
+57,5,136,149,136,163,147,26,163,94,10,147,153,156,31,14,182,249,200,249,26,
+21,160,97,121,144,117,27,92,108,105,65,116,31,106,32,103,251,2,85,86,39,118,
+25,215,247,176,158,212,157,154,213,138,25,143,157,5,251,160,6,135,121,5,162,
+153,138,135,148,31,155,133,149,125,122,26,130,137,123,135,125,30,61,251,182,
+5,65,155,111,170,206,26,164,142,168,144,161,30,158,223,5,143,157,141,159,
+152,26,182,113,170,102,115,105,127,122,112,30,146,118,5,145,152,144,140,148,
+27,153,146,132,125,132,138,134,133,107,31,122,61,5,134,115,137,119,119,26,
+74,183,76,205,110,30,161,129,159,134,173,134,101,251,32,24,122,71,120,121,
+77,138,134,121,24,247,147,150,10,116,126,183,29,155,26,153,141,151,143,154,
+30,177,247,37,247,61,156,237,212,176,247,30,25,162,223,5,191,153,154,161,
+162,27,147,145,138,134,152,31,14,202,249,88,247,55,21,109,6,101,75,117,124,
+76,136,8,87,6,120,131,138,137,117,31,144,142,145,142,145,142,184,162,24,200,
+171,155,151,177,184,8,204,215,174,229,228,26,211,116,197,98,174,30,175,95,
+72,161,69,27,251,10,251,6,87,51,65,31,74,63,103,44,47,26,46,176,80,226,95,
+30,141,121,126,140,131,27,89,6,69,123,154,206,137,31,109,6,130,251,55,5,247,
+162,6,160,217,104,155,125,151,125,160,25,118,170,128,180,182,26,223,165,233,
+182,211,30,238,198,218,192,227,27,235,192,82,36,47,101,251,5,82,56,31,98,
+81,97,106,73,112,119,61,24,247,162,6,14,251,27,166,29,247,182,5,53,6,108,
+54,5,204,131,107,170,83,27,89,85,110,85,88,31,85,81,109,67,65,26,40,115,29,
+194,154,208,164,201,31,220,173,183,182,188,27,184,161,103,61,141,31,14,251,
+54,117,251,64,21,218,6,197,247,107,5,102,166,168,123,179,27,247,14,247,10,
+247,17,247,21,207,114,192,91,174,31,212,177,182,195,196,26,203,87,183,64,
+74,80,110,88,99,30,114,107,119,92,120,68,8,218,22,153,191,156,192,149,161,
+8,190,163,174,167,180,27,176,163,110,94,87,117,87,99,97,31,153,113,123,143,
+120,27,112,120,126,121,120,157,127,168,155,153,142,147,160,31,154,113,144,
+114,100,26,84,118,56,111,87,30,85,111,95,106,96,27,109,114,157,180,112,31,
+14,251,158,247,82,203,21,156,218,146,197,199,26,247,4,105,210,87,98,90,87,
+55,100,30,152,128,5,197,171,170,175,156,27,150,155,120,115,146,31,150,106,
+144,91,69,26,78,135,81,132,95,30,100,85,132,129,127,114,8,124,108,128,104,
+120,26,116,154,123,159,160,159,157,173,156,30,153,168,148,168,161,232,167,
+171,154,155,170,170,228,226,149,151,168,179,8,171,185,158,191,179,26,177,
+118,165,109,112,118,118,112,125,141,133,152,107,30,147,121,142,127,125,26,
+121,135,124,129,122,30,121,105,132,132,82,81,8,14,251,87,248,104,248,253,
+21,177,72,58,161,71,27,70,99,109,86,112,155,113,170,114,31,204,88,68,117,
+99,115,99,96,25,82,76,105,55,62,26,42,201,77,235,247,48,247,27,247,41,247,
+64,207,113,187,82,177,30,251,39,238,5,94,169,138,140,151,26,153,152,147,163,
+201,241,100,91,202,30,251,55,41,21,205,94,164,97,77,26,77,115,66,100,80,30,
+84,102,95,111,90,27,81,109,179,217,209,159,212,175,197,31,172,193,172,165,
+207,166,8,14,251,158,65,10,14,251,147,247,174,249,103,21,77,114,91,100,114,
+26,113,171,112,193,118,30,75,87,112,110,102,83,8,79,51,106,38,47,26,51,188,
+82,216,149,156,140,141,155,30,141,156,153,140,144,27,166,154,130,121,104,
+102,108,99,129,186,10,173,182,154,165,178,31,190,247,53,10,124,138,137,125,
+30,137,124,123,138,129,27,91,114,167,193,213,162,228,180,223,31,170,201,166,
+176,192,196,8,134,163,151,138,162,27,224,198,166,178,159,121,152,110,86,108,
+127,83,54,31,106,156,120,162,163,26,161,162,161,181,159,30,14,251,56,67,10,
+14,251,61,247,246,249,39,21,51,57,63,251,15,93,31,102,37,110,251,22,71,26,
+251,1,184,78,218,220,215,202,244,184,30,184,242,174,247,44,228,26,234,90,
+201,64,30,251,59,251,186,21,173,247,15,156,186,167,186,8,176,161,169,160,
+169,27,179,164,107,89,98,131,88,116,38,31,134,113,21,110,251,7,118,71,119,
+94,8,71,110,104,105,98,27,99,113,171,189,188,154,222,169,247,8,31,14,252,
+18,54,10,14,251,72,247,120,247,152,21,163,158,163,158,162,159,175,168,151,
+143,186,140,8,176,147,140,145,154,31,157,147,150,157,159,26,163,122,154,113,
+98,116,123,251,8,251,20,30,119,120,99,103,122,124,194,247,95,24,80,125,97,
+132,91,135,134,120,24,167,10,122,128,137,130,134,118,31,48,251,232,5,212,
+6,202,247,129,233,251,90,5,104,156,158,123,163,27,159,164,152,160,157,31,
+160,162,150,158,164,190,124,147,24,90,116,110,104,120,27,123,122,158,180,
+120,31,14,251,119,247,154,247,192,21,123,251,28,5,132,80,135,103,127,26,95,
+154,116,167,178,183,184,219,177,30,122,149,5,86,109,122,124,114,27,116,127,
+158,175,159,140,156,143,177,31,175,247,237,5,142,162,140,159,148,26,188,116,
+166,98,107,119,121,109,120,147,125,157,130,30,183,115,145,130,95,26,116,137,
+117,135,111,30,251,211,252,56,5,223,6,14,251,50,247,39,248,70,21,70,251,151,
+126,89,110,50,120,91,25,103,48,136,128,118,26,114,157,121,164,169,154,162,
+185,146,139,149,138,150,30,138,159,138,154,146,26,152,140,150,141,162,30,
+124,151,150,133,156,27,168,173,158,177,179,31,176,175,167,175,192,222,104,
+251,23,24,134,122,137,124,128,26,117,155,123,160,175,189,174,191,177,30,129,
+149,5,107,110,118,123,126,27,132,135,145,148,146,144,164,145,160,31,226,247,
+222,5,68,6,117,52,115,49,122,103,84,63,25,73,91,101,105,111,27,118,128,149,
+159,149,139,140,146,163,31,225,247,216,5,14,251,108,247,143,247,81,21,138,
+198,135,189,132,178,8,210,125,114,175,101,27,91,97,84,56,126,31,155,133,5,
+190,150,164,179,160,27,155,147,125,104,146,31,150,82,150,251,14,77,26,81,
+138,114,136,105,30,160,6,152,156,139,139,167,174,205,222,147,151,175,200,
+8,184,219,164,203,181,26,176,115,168,109,116,120,121,115,124,147,124,154,
+131,30,158,127,143,134,124,26,84,92,44,64,42,30,14,251,124,247,180,249,105,
+21,80,117,95,107,117,26,117,169,116,194,118,30,72,102,99,89,92,26,105,156,
+115,181,114,30,251,4,84,70,47,45,26,93,155,101,170,115,30,124,158,161,134,
+181,27,152,155,140,141,161,31,142,161,155,140,145,27,165,153,129,122,104,
+103,107,98,130,186,10,172,182,154,165,179,31,189,247,53,10,121,138,137,121,
+30,137,120,110,137,126,27,96,115,163,184,220,187,221,219,195,31,124,177,171,
+132,174,27,189,173,158,167,158,117,152,107,101,102,130,114,80,31,126,157,
+134,156,163,26,190,162,185,186,180,30,126,187,160,136,171,27,206,182,158,
+170,160,119,150,102,90,86,124,108,79,31,108,159,119,162,157,26,156,150,151,
+174,158,30,141,143,142,143,146,31,14,85,10,14,251,51,248,209,248,70,21,252,
+24,6,93,129,136,117,107,31,39,69,150,119,208,176,171,148,207,138,25,64,251,
+97,134,128,93,99,105,114,139,139,130,129,8,125,124,131,121,123,26,119,151,
+128,162,174,165,159,185,163,30,156,173,163,205,159,208,147,167,145,158,141,
+145,166,222,24,247,93,6,86,99,116,107,123,81,105,251,28,24,130,105,138,133,
+126,26,113,151,113,151,141,141,140,143,151,30,247,9,185,140,159,5,125,98,
+139,139,131,27,124,125,153,153,144,139,139,149,179,31,168,247,4,160,227,143,
+150,158,169,25,247,9,6,14,251,72,117,251,64,21,218,6,195,247,101,5,103,171,
+160,128,176,27,247,14,247,11,247,34,247,38,238,83,206,56,89,87,118,102,99,
+31,103,106,120,100,116,52,8,232,190,21,227,162,184,192,190,27,180,164,106,
+82,74,117,45,110,79,31,77,109,97,106,91,27,110,119,153,175,117,31,14,251,
+59,248,208,248,70,21,251,133,6,34,85,118,72,77,31,85,82,106,59,68,26,51,202,
+82,237,209,206,167,189,188,30,191,192,168,204,202,26,199,115,176,89,158,30,
+170,137,196,136,203,136,163,138,5,251,100,144,21,158,105,144,120,100,26,251,
+29,61,251,7,46,81,104,182,210,192,157,195,169,181,30,194,180,186,163,213,
+27,14,251,194,248,80,248,70,21,251,167,6,96,122,134,117,111,31,39,61,153,
+117,214,186,167,148,220,140,25,180,6,78,89,124,118,121,77,100,251,44,24,133,
+117,138,132,131,26,115,153,113,151,140,30,142,143,140,142,145,31,247,15,186,
+144,161,5,129,113,114,132,125,27,125,133,146,154,148,139,139,150,183,31,177,
+247,39,152,188,145,154,157,168,25,247,70,6,14,251,93,44,29,14,32,247,173,
+248,82,21,79,134,97,121,94,99,8,78,84,101,53,53,26,43,191,82,237,127,30,91,
+251,84,5,199,6,188,247,84,218,148,189,162,191,188,25,201,199,179,227,217,
+26,223,84,203,67,104,104,123,110,114,30,120,118,126,110,124,78,71,251,164,
+24,84,158,117,172,203,26,226,176,247,2,184,188,30,163,165,159,151,175,150,
+8,184,251,26,21,151,187,144,154,147,150,8,154,150,153,147,154,27,176,167,
+95,79,62,106,49,93,94,31,106,106,108,124,82,129,8,14,251,112,248,83,248,70,
+21,56,6,251,49,251,122,5,247,93,128,124,178,75,27,106,117,122,113,117,153,
+126,168,134,31,196,134,146,119,149,251,58,251,139,251,234,24,224,6,247,60,
+247,133,140,89,144,88,147,85,25,70,149,156,109,170,27,176,184,196,227,169,
+31,126,146,5,82,114,116,115,110,27,97,122,199,247,54,134,31,14,100,248,71,
+248,70,21,67,6,251,3,252,51,5,85,146,110,168,187,26,162,145,177,147,168,30,
+177,247,35,5,144,158,142,158,153,26,170,120,164,114,109,103,119,107,110,30,
+120,118,127,120,116,95,154,132,24,197,170,172,175,163,27,148,144,133,128,
+132,138,134,133,117,31,106,251,15,5,129,102,134,109,119,26,98,155,106,171,
+112,30,168,115,162,131,187,134,94,251,60,24,211,6,183,247,57,230,147,199,
+173,190,210,25,182,199,173,244,213,26,199,117,178,104,114,117,116,114,125,
+145,123,151,124,30,174,92,143,131,105,26,88,111,70,100,94,30,98,91,94,117,
+67,129,8,14,185,247,124,248,76,21,251,12,50,88,53,251,2,26,43,192,70,211,
+191,188,172,205,188,170,10,123,147,124,156,123,31,182,99,146,126,97,26,251,
+9,51,251,20,60,99,111,173,208,125,247,50,29,119,94,110,75,40,120,140,125,
+142,110,30,76,95,88,100,101,27,101,116,174,196,238,192,247,42,199,210,31,
+14,251,146,247,237,248,80,21,251,46,251,39,251,48,251,57,54,180,98,225,148,
+149,139,140,146,31,143,172,139,139,149,27,169,153,129,119,107,104,106,107,
+129,129,141,144,127,31,146,117,137,140,128,27,112,120,123,116,115,160,124,
+170,216,231,225,211,182,112,167,97,131,130,138,138,130,31,135,106,139,139,
+125,27,90,120,157,186,189,157,207,167,198,31,193,165,176,169,178,27,157,159,
+131,122,163,31,121,164,148,135,153,27,165,160,160,164,171,109,159,94,31,14,
+251,61,248,153,247,234,21,143,122,130,141,118,27,156,210,144,172,178,26,246,
+87,199,47,35,58,66,45,44,222,79,247,31,134,30,107,251,3,132,116,116,83,8,
+50,102,105,102,93,27,107,117,163,175,161,143,163,149,173,31,165,229,5,142,
+150,141,152,149,26,172,121,159,111,94,87,96,69,96,30,154,129,5,187,171,170,
+167,158,27,146,143,134,129,129,139,139,129,105,31,124,86,131,113,135,114,
+138,116,25,75,136,187,94,211,27,211,210,188,223,187,31,168,191,161,197,163,
+232,8,151,6,155,146,137,133,150,31,251,12,173,21,35,148,81,185,214,26,219,
+195,210,204,183,166,104,81,98,132,92,116,39,30,14,251,34,247,149,124,21,247,
+40,152,247,21,247,41,247,49,26,243,86,200,46,143,30,147,165,147,157,151,166,
+8,173,212,141,145,161,26,165,124,154,111,112,116,125,114,124,30,128,120,136,
+127,135,93,135,99,135,109,132,112,8,251,41,126,251,15,251,39,251,54,26,37,
+187,79,222,134,30,91,251,61,5,228,6,105,247,87,21,108,146,118,194,213,26,
+247,33,222,247,32,235,160,30,217,140,21,180,130,163,88,58,26,251,35,59,251,
+22,36,114,30,14,185,247,140,248,86,21,89,95,186,148,149,140,202,141,25,107,
+124,124,130,119,122,8,74,86,98,42,39,26,57,178,87,202,186,185,172,201,176,
+30,72,155,169,111,193,27,195,185,171,204,180,31,173,192,159,203,191,26,221,
+95,205,67,162,30,155,90,100,143,251,4,27,158,251,213,21,89,109,113,118,107,
+27,101,117,170,194,200,167,234,171,187,31,158,168,162,162,165,157,8,247,63,
+138,218,88,251,4,26,96,123,86,113,96,30,101,117,106,117,105,27,102,112,167,
+177,157,149,178,148,155,31,156,170,142,147,152,26,155,130,151,127,123,124,
+122,108,129,30,129,109,138,128,138,83,8,14,252,18,54,10,69,248,157,196,29,
+247,33,198,10,14,251,93,44,29,247,103,247,194,116,10,14,251,219,247,108,248,
+118,21,181,6,161,186,5,162,247,0,29,129,30,14,251,219,247,132,248,193,21,
+173,6,155,172,5,156,174,148,165,155,26,154,131,147,123,106,129,119,65,133,
+30,75,193,29,247,46,119,29,90,247,72,191,10,122,104,251,14,127,30,247,77,
+251,199,71,29,158,227,248,86,21,188,6,164,194,5,166,197,155,187,163,26,163,
+127,152,117,92,121,104,251,14,127,30,247,144,251,76,174,10,116,61,107,222,
+29,128,138,131,227,29,159,157,169,29,119,121,81,235,29,116,90,120,171,10,
+247,24,218,151,10,247,145,251,77,52,29,251,150,206,151,10,247,149,252,133,
+81,29,14,201,224,152,29,248,50,247,49,21,55,48,95,64,70,31,52,45,87,251,14,
+251,5,26,251,35,226,48,247,30,224,211,247,15,10,247,34,49,235,251,25,30,133,
+102,21,218,186,81,39,50,104,251,14,85,38,31,51,91,71,86,72,27,62,89,201,233,
+247,4,195,247,53,212,238,31,191,177,194,170,190,27,14,205,223,201,29,92,121,
+104,251,14,127,30,248,217,251,244,21,116,77,111,117,85,136,8,251,3,6,204,
+176,177,167,178,179,8,223,226,183,234,234,26,247,25,58,220,251,25,48,63,109,
+77,74,30,62,66,95,43,41,26,42,178,61,220,77,30,251,11,6,96,123,152,174,149,
+140,147,141,160,31,119,132,123,251,48,5,247,118,6,158,209,5,100,182,124,184,
+213,26,216,162,247,1,172,218,30,226,176,209,193,215,27,215,187,87,57,52,110,
+33,91,51,31,104,76,109,102,78,86,120,69,24,247,119,6,207,247,49,5,14,139,
+210,152,29,248,54,251,96,21,247,55,247,118,5,213,192,185,172,192,27,144,157,
+5,251,114,6,133,121,5,155,6,173,158,129,121,128,134,129,122,115,31,251,42,
+251,106,75,247,106,5,134,157,137,148,247,10,10,251,175,132,29,160,6,183,141,
+165,117,156,247,19,10,63,140,225,10,247,180,204,29,114,122,140,141,130,31,
+119,144,126,153,159,26,152,141,151,143,154,30,14,251,219,78,29,109,249,210,
+78,10,35,61,29,165,249,110,78,10,251,27,166,29,247,184,5,53,6,108,53,5,204,
+131,107,170,83,27,88,86,110,85,88,31,85,80,109,68,65,26,39,115,29,195,154,
+208,164,200,31,221,173,183,182,188,27,184,161,103,60,141,31,95,247,73,247,
+37,29,186,153,183,241,29,251,158,65,10,251,3,247,235,21,181,6,160,186,5,163,
+247,0,29,128,30,14,251,56,67,10,194,249,34,247,37,29,187,153,182,241,29,252,
+18,54,10,104,248,32,21,181,6,161,186,5,160,186,154,184,158,247,3,10,85,10,
+138,202,247,37,29,188,153,181,159,26,160,129,150,120,98,125,111,33,129,30,
+14,177,248,34,248,118,21,181,6,160,186,5,163,190,152,179,160,26,159,247,36,
+10,128,30,251,67,41,21,251,12,50,88,54,251,3,26,43,192,70,211,191,189,172,
+205,187,170,10,124,148,123,155,123,31,183,99,146,125,97,26,251,8,51,251,20,
+59,99,112,173,208,124,247,50,29,118,95,110,74,41,119,140,125,142,111,30,76,
+95,89,100,100,27,101,116,174,196,238,192,247,41,199,211,31,14,251,93,44,29,
+247,127,247,69,247,37,29,187,153,182,160,26,159,247,36,10,129,30,14,252,18,
+247,102,87,29,118,248,107,21,173,6,155,172,5,155,172,149,168,154,26,154,130,
+147,124,107,128,118,66,133,30,65,193,29,247,67,119,29,251,93,44,29,247,152,
+247,144,21,172,6,155,172,5,155,172,149,167,155,26,154,131,147,123,107,128,
+119,65,134,30,65,112,21,114,119,120,115,113,160,119,247,52,10,247,66,119,
+29,90,248,7,247,100,21,134,251,9,5,80,136,128,125,247,1,10,115,6,91,124,151,
+180,146,139,139,140,165,247,32,29,93,77,123,127,104,140,25,127,6,135,121,
+5,247,90,6,143,157,5,119,6,110,124,148,157,145,143,149,145,148,31,235,247,
+30,5,247,72,175,21,251,47,6,247,57,247,128,5,14,69,248,234,232,10,252,75,
+6,134,247,24,10,106,26,129,137,126,135,125,30,251,14,252,95,121,71,120,122,
+78,184,10,247,164,6,247,55,247,3,223,247,15,247,0,55,205,251,28,121,128,138,
+136,115,31,205,247,141,5,247,20,6,191,166,114,91,118,137,121,134,113,31,156,
+6,251,186,251,43,21,145,160,149,140,157,27,225,184,92,50,34,67,73,251,8,114,
+125,142,149,109,31,14,90,247,62,232,10,134,122,170,138,148,138,150,135,25,
+155,134,149,125,122,181,10,5,69,121,120,122,73,27,114,29,118,183,107,163,
+30,164,106,93,217,10,42,70,77,251,1,127,129,139,141,116,31,130,104,21,170,
+140,5,231,187,99,63,32,63,66,251,2,118,126,141,145,111,31,14,48,71,10,115,
+249,96,232,10,252,143,6,135,121,5,155,6,185,160,125,106,106,125,64,115,46,
+31,101,251,40,98,51,71,64,8,94,98,120,130,88,27,115,6,89,251,79,5,157,6,247,
+21,184,168,166,235,27,247,228,6,189,161,117,90,120,138,128,131,101,31,138,
+136,138,133,138,131,8,157,6,191,247,79,5,86,6,105,125,148,160,146,140,147,
+142,148,31,247,19,248,111,5,209,157,158,153,211,27,251,80,121,21,251,50,252,
+226,5,251,152,6,230,214,201,247,18,181,247,82,158,230,153,205,149,181,8,14,
+90,57,10,14,247,148,248,87,247,250,21,127,6,47,243,76,244,190,26,157,153,
+147,169,30,156,150,10,251,85,6,134,121,180,135,157,120,201,39,25,177,77,154,
+117,179,84,251,185,251,175,24,88,91,113,122,92,123,134,121,24,247,124,6,143,
+157,5,112,142,132,144,153,26,147,143,144,152,151,30,155,154,247,139,247,137,
+5,157,6,87,251,112,124,70,121,123,77,137,25,135,121,5,247,151,6,143,157,105,
+140,128,141,129,146,25,127,147,133,151,156,26,149,140,147,143,156,30,191,
+247,117,5,158,6,247,6,251,132,5,153,110,139,139,131,26,122,120,126,110,30,
+135,121,5,247,123,6,144,157,105,138,108,161,118,180,25,251,40,247,184,217,
+201,169,164,210,201,25,247,5,237,170,160,182,143,144,157,24,251,86,132,29,
+157,6,161,150,135,129,120,116,115,43,60,31,115,119,105,110,109,113,50,64,
+24,123,6,185,247,91,5,212,156,156,153,213,27,143,157,5,251,164,6,135,121,
+5,166,147,138,135,150,31,156,133,149,124,119,26,129,137,125,137,128,30,14,
+251,57,247,40,248,116,21,106,29,158,90,151,118,162,113,25,95,181,192,117,
+208,27,247,31,242,228,247,12,96,10,14,201,45,29,14,143,53,29,14,156,248,191,
+249,6,21,251,32,252,157,121,70,120,123,78,137,225,10,247,150,6,144,236,10,
+247,14,248,94,5,211,158,157,153,213,27,144,157,5,252,133,6,135,121,5,148,
+6,185,165,124,112,104,92,251,63,94,251,19,31,251,20,93,93,66,104,27,130,187,
+29,213,192,189,247,13,195,31,186,240,172,244,205,247,151,8,14,247,65,227,
+10,137,147,137,150,134,25,154,132,149,130,131,26,138,130,5,136,132,138,133,
+138,26,251,21,252,119,121,70,120,122,76,184,10,247,99,150,10,105,126,141,
+144,129,31,126,145,131,153,155,26,150,141,149,143,157,247,31,29,247,243,248,
+160,251,4,252,55,120,70,119,122,74,184,10,247,159,150,10,83,140,121,149,171,
+26,149,141,154,143,153,247,24,29,210,157,159,155,207,27,144,157,5,251,57,
+6,14,201,51,10,201,105,10,133,101,21,219,186,80,40,53,104,251,13,86,38,31,
+51,92,70,85,73,27,58,91,200,242,243,197,247,55,209,234,31,190,177,193,170,
+191,27,14,201,247,221,249,6,21,247,167,214,10,122,70,119,122,78,184,10,247,
+150,204,29,84,140,122,150,170,26,150,141,149,143,157,30,247,15,248,94,5,211,
+158,157,153,212,27,144,157,5,253,23,95,29,14,90,247,161,247,216,21,129,177,
+156,136,170,27,247,37,239,220,247,10,195,107,187,86,164,31,157,102,107,144,
+66,27,251,95,132,29,169,148,247,5,29,121,26,128,137,128,135,123,30,251,15,
+252,94,122,69,119,123,75,184,10,247,162,204,29,106,130,140,143,127,31,123,
+145,129,153,158,26,149,141,154,143,152,247,13,10,201,181,96,74,42,68,66,45,
+119,126,141,146,114,31,14,146,249,48,248,108,21,175,247,93,5,117,233,10,93,
+100,145,105,27,251,108,251,84,251,93,251,116,251,49,247,3,251,3,247,49,243,
+219,183,246,230,31,121,153,5,49,48,82,110,55,27,251,6,74,217,247,26,247,11,
+186,247,13,217,220,31,188,187,202,167,206,27,233,191,84,251,0,150,31,14,35,
+248,73,249,6,21,229,6,197,167,117,92,117,137,119,134,112,207,29,233,200,186,
+237,136,8,203,214,10,5,66,120,121,125,65,27,134,121,5,247,183,6,143,157,5,
+111,130,139,140,131,31,109,143,124,152,163,26,150,141,151,143,156,30,14,152,
+247,35,249,42,61,10,247,36,249,38,48,10,90,230,29,113,118,123,103,30,122,
+6,133,121,5,247,147,204,29,125,6,93,216,29,159,201,142,217,29,127,133,128,
+122,118,31,251,40,251,70,96,247,57,5,137,149,135,164,147,26,162,94,10,146,
+153,157,31,14,201,248,163,232,10,135,121,5,167,146,247,5,29,120,26,128,137,
+130,135,122,30,251,33,252,163,5,251,167,6,124,10,252,96,122,72,119,122,78,
+184,10,248,144,6,181,148,138,130,154,31,157,129,148,120,110,26,112,135,114,
+130,103,30,157,6,192,247,79,5,72,6,119,128,150,158,147,141,149,144,158,31,
+247,15,248,95,247,39,10,14,168,248,66,244,21,121,71,120,121,76,138,134,121,
+24,247,151,6,144,157,112,247,44,10,157,26,150,141,152,143,154,63,29,14,248,
+19,247,107,175,21,104,29,249,252,233,29,156,26,150,141,153,143,153,30,247,
+14,248,94,247,60,29,251,164,132,29,193,138,157,129,107,26,128,137,127,135,
+124,30,251,33,111,29,14,248,19,250,8,251,48,21,192,247,79,5,86,6,104,129,
+145,161,146,141,149,142,151,31,247,17,248,105,5,192,29,107,26,126,138,136,
+133,117,30,251,32,111,29,251,103,6,104,29,249,152,6,187,163,117,96,112,135,
+109,130,105,31,14,69,247,205,79,29,146,140,151,218,29,14,247,104,247,208,
+79,29,147,140,150,218,29,248,244,114,21,84,140,122,150,170,26,149,141,152,
+143,155,30,247,15,248,93,5,212,157,158,153,175,10,122,26,128,137,123,135,
+127,247,63,10,155,248,154,232,10,252,20,6,97,251,54,5,155,6,225,169,187,179,
+214,27,203,6,251,32,252,158,122,71,119,122,78,184,10,247,150,6,223,201,152,
+168,188,31,202,177,175,199,247,19,29,118,30,186,247,69,5,211,158,156,153,
+213,27,251,59,251,192,21,140,152,147,140,151,27,239,190,96,53,32,56,66,251,
+12,119,126,140,144,111,31,14,134,247,61,248,109,21,157,6,163,192,153,162,
+164,164,8,178,178,187,160,192,27,231,192,77,251,0,103,135,113,130,102,31,
+251,27,6,80,121,150,178,151,141,149,144,162,31,121,6,79,251,126,5,155,6,153,
+213,185,171,229,138,8,246,6,102,35,114,94,90,84,8,82,89,79,109,77,27,59,85,
+184,234,103,31,114,129,159,80,153,114,165,109,25,96,178,190,116,198,27,247,
+93,247,80,247,106,247,121,247,35,53,233,251,21,95,109,132,118,80,31,135,127,
+127,136,131,27,126,130,150,153,31,149,123,7,14,248,8,248,57,247,223,21,128,
+99,135,108,106,26,251,38,226,48,247,30,242,223,183,234,214,30,213,232,183,
+247,4,234,26,247,31,50,236,251,21,251,44,251,36,251,11,251,71,74,30,251,39,
+113,10,121,78,138,247,11,10,139,128,143,25,123,145,129,153,156,26,151,140,
+148,144,158,30,201,247,123,5,248,143,247,189,21,218,186,80,42,75,123,67,106,
+55,31,251,42,81,62,61,49,27,106,107,154,163,117,31,112,169,128,176,197,26,
+219,175,247,12,191,235,30,237,193,198,185,211,27,14,136,248,90,247,188,21,
+88,251,83,247,3,29,143,236,10,247,15,248,94,5,211,157,157,153,213,27,144,
+157,5,251,173,6,52,92,128,109,92,31,81,101,105,76,70,26,94,154,102,166,114,
+30,163,118,163,130,192,132,85,126,128,132,77,72,39,33,24,75,73,103,115,91,
+133,134,121,24,247,52,6,247,121,247,138,177,182,144,142,176,143,25,190,180,
+21,135,112,126,138,123,27,59,96,183,219,244,209,203,247,5,158,154,138,137,
+177,31,14,251,112,247,72,232,10,134,121,5,193,138,156,129,108,26,128,137,
+127,135,124,30,251,16,252,97,121,72,121,122,78,184,10,247,147,150,10,86,140,
+122,149,171,26,149,141,153,143,152,30,247,34,248,164,5,247,138,6,174,247,
+23,5,122,6,120,68,113,117,71,137,8,14,247,29,248,110,249,6,21,247,16,6,191,
+166,115,95,117,137,117,134,113,207,29,232,201,187,236,136,8,176,214,10,5,
+66,121,120,125,65,27,134,121,5,247,77,6,228,247,223,5,145,193,173,141,168,
+27,210,175,100,62,251,3,74,35,70,123,127,147,151,141,139,141,140,141,31,148,
+157,140,143,149,26,162,121,155,112,107,118,115,103,94,173,116,206,247,33,
+247,3,245,247,27,240,72,202,32,99,93,135,130,81,30,14,148,249,44,249,51,21,
+117,124,131,134,122,27,129,130,141,145,122,31,154,98,116,143,102,27,251,107,
+251,76,251,73,251,104,251,64,242,251,8,247,43,206,198,160,181,190,31,168,
+164,155,159,170,187,121,152,24,57,77,75,102,58,27,251,2,76,222,247,38,161,
+140,153,144,171,31,247,59,6,181,147,138,132,151,31,153,131,146,124,119,26,
+122,137,125,131,108,30,155,6,204,247,137,5,123,6,118,66,108,114,72,141,8,
+251,69,6,159,201,148,161,158,169,8,230,195,224,194,224,27,221,194,87,61,131,
+139,129,138,128,31,156,6,181,247,89,5,14,248,119,248,111,21,177,247,93,5,
+116,6,118,125,130,134,116,27,126,129,142,148,116,31,148,117,106,144,107,27,
+35,65,70,41,83,154,109,202,74,31,147,131,153,123,157,120,164,112,149,128,
+143,135,8,188,88,152,113,95,26,62,84,82,65,53,75,212,236,146,139,144,141,
+148,30,118,141,107,251,118,5,157,6,162,146,150,149,160,27,150,153,135,130,
+166,31,122,186,166,133,171,27,247,8,226,225,247,7,206,116,178,46,232,31,46,
+232,130,153,190,26,202,181,178,208,177,170,126,115,160,30,161,113,148,105,
+141,72,8,14,251,219,46,29,251,219,46,29,251,219,46,29,251,108,247,127,249,
+24,21,161,156,247,43,29,125,137,127,135,125,30,251,11,252,82,5,83,124,110,
+104,108,27,121,127,149,153,148,141,143,150,150,31,149,150,143,147,151,26,
+165,118,159,113,104,111,108,100,87,184,99,200,183,188,162,177,176,30,168,
+169,164,188,154,199,238,248,4,24,155,203,160,160,188,141,144,157,24,251,149,
+6,14,247,159,249,137,232,10,252,133,6,135,121,5,148,6,186,164,125,112,95,
+65,251,142,97,38,31,42,97,108,96,108,27,131,187,29,198,190,176,211,180,31,
+200,246,181,247,16,214,247,188,8,247,63,6,251,31,252,157,121,71,120,122,78,
+137,225,10,247,137,6,238,195,151,170,192,31,202,177,175,199,206,26,247,2,
+51,206,251,35,123,129,138,137,117,30,187,247,69,5,211,158,156,152,213,27,
+251,60,251,191,21,141,152,145,139,156,27,237,190,95,54,32,56,66,251,14,120,
+125,141,143,113,31,14,247,153,248,153,248,3,21,251,160,113,10,122,78,137,
+247,11,10,140,128,142,25,123,145,129,153,157,26,151,141,148,143,157,30,201,
+247,123,5,247,163,6,77,251,118,121,71,120,122,78,137,225,10,247,137,6,239,
+193,150,171,193,31,200,176,176,198,201,26,217,87,196,48,160,30,148,101,129,
+140,49,27,190,247,82,5,212,158,157,153,212,27,144,157,5,251,163,6,132,121,
+5,167,147,138,135,150,31,156,134,149,124,121,26,127,138,132,134,120,30,173,
+251,123,21,207,154,137,129,170,31,184,125,167,96,85,26,40,54,67,251,9,119,
+126,140,144,111,30,14,247,31,248,86,249,6,21,247,6,6,217,166,121,85,126,138,
+130,136,119,31,154,6,179,247,42,5,252,190,6,99,251,42,5,154,6,154,211,194,
+180,222,140,8,199,214,10,122,71,120,121,77,184,10,247,150,6,143,157,5,86,
+140,122,150,171,26,149,141,149,144,157,30,201,247,119,5,142,174,177,140,170,
+27,217,172,115,80,124,138,131,132,113,31,113,45,122,71,120,121,247,18,29,
+85,140,122,150,171,26,150,141,156,142,149,30,160,213,5,149,176,143,161,159,
+26,223,80,174,251,34,109,117,138,136,90,30,14,201,247,71,176,21,247,33,248,
+156,5,212,158,156,153,213,27,144,157,5,251,162,6,131,121,5,195,243,10,252,
+95,122,71,119,122,78,184,10,247,65,6,182,148,138,131,152,31,157,129,148,117,
+108,26,112,135,112,126,90,30,157,6,188,247,38,176,172,247,3,135,8,247,53,
+233,29,157,26,150,141,152,143,153,30,247,14,248,94,177,29,107,26,127,137,
+129,135,123,30,251,32,252,162,5,14,201,248,110,249,52,21,55,49,99,65,59,31,
+38,45,80,251,14,251,11,26,251,33,230,39,247,19,247,100,247,94,247,104,247,
+120,150,30,247,34,146,42,247,0,251,27,27,227,252,4,21,251,75,81,41,33,251,
+3,27,58,90,201,239,176,145,184,150,184,31,151,182,21,247,77,197,238,246,247,
+6,27,218,189,80,46,97,131,85,127,95,31,14,247,135,248,82,247,250,21,127,6,
+53,241,79,245,188,26,159,152,148,170,30,156,150,10,251,83,6,134,121,178,135,
+158,120,197,39,25,174,79,155,115,177,84,251,188,251,175,24,89,92,112,121,
+92,123,134,121,24,247,120,150,10,113,142,132,143,153,26,147,143,145,153,151,
+30,141,142,145,144,146,146,247,142,247,137,24,156,6,84,251,112,122,70,121,
+122,78,184,10,247,148,6,143,157,5,84,140,123,150,173,26,149,140,146,144,158,
+30,196,247,117,5,156,6,247,0,251,132,5,152,111,139,139,131,26,121,120,126,
+110,30,134,121,5,191,185,29,157,6,183,247,85,69,138,123,151,97,228,25,251,
+6,247,133,217,201,168,163,212,202,25,247,6,238,170,159,181,143,144,157,24,
+251,83,132,29,156,6,161,150,135,130,119,115,115,43,60,31,116,121,101,107,
+111,114,109,114,110,114,108,114,8,124,6,189,247,91,5,212,157,156,153,212,
+27,143,157,5,251,160,6,135,121,5,193,138,156,129,105,26,130,137,124,136,127,
+30,14,35,230,249,26,21,247,54,10,78,251,107,135,29,160,146,170,163,218,30,
+142,147,141,147,140,143,168,241,24,133,29,73,35,251,15,140,10,7,14,201,203,
+247,193,21,132,104,136,118,121,26,251,36,235,42,247,35,247,117,247,89,247,
+104,247,135,191,129,181,117,175,30,205,100,63,178,52,27,57,55,110,86,67,31,
+87,101,112,106,91,59,207,128,24,182,212,173,183,172,166,8,180,192,200,162,
+197,27,188,184,117,103,163,31,156,113,147,103,90,26,81,130,81,121,85,30,124,
+96,21,114,77,112,91,112,107,8,79,86,74,105,75,27,89,95,161,174,116,31,120,
+168,131,177,196,26,160,140,154,141,158,30,14,158,247,117,247,227,21,156,225,
+162,142,174,27,206,173,115,91,121,136,123,131,110,31,108,251,9,5,69,120,119,
+124,65,27,135,121,5,247,174,150,10,79,140,124,147,169,26,148,142,158,144,
+157,30,171,247,9,5,145,163,143,165,159,26,211,89,176,41,94,123,137,115,251,
+21,30,189,247,78,5,210,159,159,153,212,27,144,157,5,251,174,132,29,198,138,
+154,131,110,26,128,136,121,134,121,30,251,15,252,92,5,69,120,119,124,66,27,
+134,121,5,247,174,150,10,80,140,124,147,168,26,151,142,157,144,156,30,14,
+247,175,247,31,232,10,133,121,5,155,6,180,161,126,103,157,31,251,15,252,99,
+5,86,125,124,118,119,27,132,131,142,144,132,31,154,119,126,145,122,27,112,
+118,118,111,109,166,121,185,187,170,157,181,164,31,148,154,150,168,149,177,
+247,1,248,51,24,247,122,252,183,5,158,6,247,33,248,166,5,192,153,153,157,
+164,27,148,145,137,132,154,31,134,151,146,137,148,27,168,161,156,162,167,
+112,158,98,72,103,100,36,112,31,45,251,243,251,89,248,119,5,247,155,253,42,
+21,247,149,6,155,201,5,251,149,6,247,113,248,70,21,47,59,48,33,52,186,77,
+207,232,219,229,244,228,91,201,71,31,135,111,21,178,161,102,76,36,89,52,79,
+102,116,177,203,239,190,227,197,31,14,90,247,222,248,238,21,160,145,153,145,
+180,27,247,62,173,126,73,31,128,7,138,128,138,135,138,124,160,137,171,247,
+47,5,252,134,123,6,186,135,143,138,151,132,8,148,134,144,128,126,26,123,135,
+114,132,114,30,91,251,65,38,138,130,107,5,240,6,73,251,134,121,78,247,27,
+10,143,121,149,170,26,148,141,152,146,162,30,201,247,119,244,136,155,139,
+152,134,25,154,134,148,122,119,26,122,137,127,133,108,30,156,134,215,247,
+129,121,144,94,48,137,138,251,60,137,25,14,35,247,215,247,127,21,160,214,
+133,29,72,35,251,14,140,10,123,7,247,54,10,119,68,5,38,6,130,105,5,239,6,
+108,251,2,135,29,161,146,167,166,229,30,140,143,5,247,3,6,148,173,5,14,90,
+57,10,247,37,249,118,78,10,201,45,29,248,14,249,83,228,29,142,141,145,216,
+10,105,88,200,10,114,111,121,120,108,30,14,48,247,237,72,10,247,58,248,252,
+21,175,204,10,247,59,29,251,219,247,142,157,21,99,10,247,15,248,93,109,29,
+192,158,128,109,126,137,126,135,125,31,210,10,109,249,210,198,29,247,66,180,
+10,143,53,29,247,133,248,252,21,174,204,10,194,10,152,248,227,249,179,228,
+29,143,141,144,216,10,106,87,200,10,113,112,121,120,108,30,252,76,251,36,
+61,10,90,248,220,155,21,81,144,132,147,126,213,38,248,211,24,113,6,251,182,
+252,144,61,251,26,129,127,98,131,25,123,247,82,155,7,86,145,131,143,166,26,
+158,141,145,157,176,30,196,247,6,5,247,115,6,160,251,25,5,141,129,140,128,
+131,26,103,125,130,74,133,30,123,247,142,7,252,33,247,158,21,247,41,247,156,
+187,251,156,5,247,45,248,242,21,75,115,90,103,76,27,75,221,29,174,124,184,
+27,194,186,163,184,172,31,159,166,148,161,148,181,8,14,90,54,29,82,248,1,
+21,75,114,90,103,77,27,74,221,29,175,124,183,27,195,185,247,4,29,134,247,
+188,248,28,21,108,113,147,10,125,134,124,175,29,105,126,247,8,10,155,143,
+154,30,209,247,141,155,110,76,251,111,5,203,6,180,247,35,217,251,36,5,150,
+119,144,124,127,26,118,122,129,94,135,30,133,121,5,247,158,6,145,157,76,138,
+110,162,92,229,25,251,16,247,129,149,172,247,139,247,92,144,10,251,59,251,
+31,171,247,4,5,76,6,14,134,247,151,247,241,21,247,28,251,141,5,150,118,144,
+125,127,26,117,122,130,94,135,30,133,121,5,201,185,29,156,6,184,247,85,68,
+138,129,147,90,231,25,251,25,247,147,247,158,247,107,144,10,251,173,251,126,
+147,10,124,134,125,175,29,104,127,247,8,10,154,143,155,30,14,191,247,144,
+247,223,21,247,159,6,73,251,118,120,69,120,123,73,184,10,227,6,238,180,106,
+58,126,138,122,138,120,31,157,6,184,247,85,5,74,140,117,150,172,26,153,142,
+159,146,162,30,247,14,248,61,5,210,159,158,155,207,27,144,157,5,251,155,6,
+131,247,24,10,108,26,128,137,125,135,125,30,81,251,88,5,251,156,6,193,247,
+82,5,212,159,158,153,211,27,144,157,5,251,160,132,29,192,138,156,129,109,
+26,128,137,125,134,124,30,251,23,252,94,120,71,120,121,78,184,10,247,147,
+204,29,86,140,122,149,170,26,150,141,150,144,157,30,14,81,247,194,247,158,
+21,182,251,71,5,142,129,140,130,132,26,112,118,123,103,30,122,6,133,121,5,
+218,6,204,168,132,116,161,31,154,123,149,108,106,26,123,138,123,138,120,30,
+157,6,184,247,84,5,98,121,143,148,128,31,109,163,130,153,130,180,81,247,124,
+24,247,54,247,83,203,215,171,158,200,142,25,145,157,5,251,91,6,133,121,5,
+149,6,162,148,133,124,127,132,126,123,119,31,251,42,251,70,100,247,57,5,137,
+150,136,161,148,26,163,159,152,174,30,155,204,29,251,157,6,133,121,5,156,
+6,189,138,156,122,159,72,202,251,141,24,251,59,251,90,5,86,96,77,98,103,27,
+133,121,5,247,98,204,29,118,6,110,123,146,154,148,143,146,153,157,31,14,158,
+248,14,247,187,21,175,144,165,144,179,151,79,251,105,24,120,71,120,122,77,
+138,134,121,24,247,147,204,29,85,140,123,149,170,26,151,140,146,145,159,30,
+247,23,248,94,5,212,160,157,153,211,27,144,157,5,251,161,6,135,121,5,192,
+138,156,129,109,26,128,137,124,135,125,30,79,251,101,104,128,108,132,103,
+136,25,204,247,114,5,76,6,74,251,114,5,95,146,118,158,173,26,146,140,146,
+142,148,30,179,247,33,5,212,159,158,153,211,27,143,157,5,251,159,132,29,192,
+138,156,129,108,26,128,137,127,134,123,30,103,251,18,5,131,110,138,134,123,
+26,75,189,106,236,30,93,251,52,5,202,6,14,168,248,251,172,21,103,128,141,
+144,126,31,123,145,120,161,152,26,142,140,145,142,149,63,29,84,251,104,121,
+71,120,121,76,184,10,247,20,6,204,175,100,70,123,138,123,138,119,31,157,6,
+14,90,54,29,251,19,247,99,21,171,185,10,152,128,31,14,201,45,29,247,209,248,
+254,21,170,185,10,153,128,31,14,154,247,146,248,175,21,251,8,252,71,165,29,
+205,26,247,2,51,206,251,35,123,130,139,137,116,30,182,247,50,5,247,16,6,188,
+138,155,125,142,90,8,158,6,155,245,5,251,108,6,190,157,158,151,206,202,29,
+194,138,156,129,106,26,132,139,135,138,131,30,251,75,6,110,33,5,158,6,163,
+187,161,154,188,140,8,247,23,251,88,21,141,153,146,139,151,27,240,190,96,
+52,34,55,66,251,11,119,125,140,144,111,31,14,201,105,10,251,134,251,197,21,
+247,69,200,219,229,234,27,219,186,80,40,97,133,99,124,86,31,131,110,123,136,
+118,27,116,122,146,156,123,31,109,170,139,139,136,142,8,150,125,121,145,119,
+27,107,102,129,111,73,31,247,221,69,21,251,64,83,53,40,45,27,61,89,200,234,
+182,147,196,151,178,31,146,167,171,144,164,27,168,152,132,111,165,31,115,
+160,157,131,167,27,169,183,150,159,189,31,14,149,247,176,128,21,227,247,61,
+247,47,247,194,146,152,178,202,25,173,161,162,161,155,27,146,145,134,132,
+140,31,143,122,139,138,143,134,8,129,146,155,132,156,27,178,174,178,183,171,
+115,156,95,75,83,100,60,88,31,90,64,104,72,251,35,251,183,37,248,14,24,129,
+178,131,181,156,26,153,142,148,147,147,30,149,149,145,140,195,143,143,158,
+24,251,158,6,135,120,188,137,148,128,165,47,25,247,33,252,185,5,14,251,57,
+247,101,129,21,147,6,247,29,242,229,247,11,96,10,156,6,106,29,170,47,200,
+84,223,127,25,84,50,199,10,122,143,150,110,247,64,10,132,203,10,143,247,159,
+248,2,21,189,247,84,5,211,158,157,153,213,27,144,157,5,252,20,6,97,251,54,
+5,154,6,225,170,187,179,213,27,204,214,10,125,29,205,247,141,91,29,131,137,
+136,120,123,30,14,146,247,207,121,21,151,6,242,218,182,245,230,83,29,251,
+27,223,37,247,22,119,31,88,57,247,37,10,148,119,10,132,203,10,168,249,26,
+248,193,21,103,29,182,145,107,10,124,26,75,191,103,231,193,193,147,158,206,
+30,92,251,72,114,46,127,129,53,138,25,91,251,88,5,157,6,187,247,13,188,176,
+247,7,144,8,235,6,143,157,99,140,130,140,128,145,25,126,146,132,150,155,26,
+154,146,169,154,182,30,14,248,78,242,21,98,111,114,116,121,27,131,134,144,
+146,144,140,145,144,157,31,144,154,230,247,234,63,129,125,86,5,183,129,113,
+163,101,27,251,10,251,41,251,82,251,41,70,175,94,192,168,177,154,162,171,
+31,168,160,158,159,176,190,135,123,139,139,134,121,8,130,104,138,136,127,
+26,111,155,121,166,179,179,170,209,188,30,251,49,247,214,21,172,160,115,100,
+251,28,33,251,57,52,105,120,164,185,198,167,215,191,214,31,194,176,176,167,
+177,27,14,251,49,248,156,249,53,21,117,134,129,132,112,27,134,128,139,140,
+129,31,140,126,129,139,130,27,54,71,106,66,80,31,65,51,71,251,77,251,3,26,
+38,191,73,220,188,191,163,183,190,30,203,195,177,221,221,26,236,81,207,58,
+77,78,102,70,85,30,203,247,57,196,193,247,8,143,239,144,176,165,164,222,8,
+251,122,251,148,247,9,29,109,102,110,97,27,94,111,178,202,226,162,225,176,
+195,31,188,172,177,164,179,27,14,251,118,247,150,247,122,21,212,159,168,151,
+163,159,8,167,161,155,168,166,26,188,95,172,73,251,40,251,24,251,33,251,50,
+39,191,85,235,245,220,204,224,199,100,170,63,30,251,11,137,21,165,212,155,
+169,170,173,8,172,170,173,157,172,27,167,157,122,112,113,125,115,109,114,
+31,98,105,96,122,50,121,8,130,106,21,151,186,160,142,162,27,184,163,116,95,
+66,94,83,80,96,116,172,199,167,142,164,146,174,31,14,251,162,247,9,247,238,
+21,179,180,174,157,174,27,174,164,114,104,95,112,109,66,105,31,63,103,125,
+131,115,119,8,116,120,126,111,107,26,74,185,96,209,195,169,156,216,214,247,
+49,10,94,112,168,186,187,247,53,29,161,8,160,157,150,164,168,26,192,97,175,
+78,108,107,129,121,114,30,124,128,129,131,102,103,8,14,251,46,247,74,249,
+12,21,150,172,166,144,167,27,222,193,63,251,10,119,138,125,135,115,31,171,
+116,110,153,96,27,251,24,251,12,251,26,251,39,33,197,73,231,215,203,177,213,
+189,31,192,217,170,247,10,247,10,26,247,59,69,227,251,23,105,113,135,127,
+96,30,247,37,251,129,21,181,163,102,75,72,117,58,106,81,31,74,101,97,107,
+93,27,92,115,175,209,247,36,235,247,46,229,31,14,251,108,247,254,243,74,29,
+247,162,248,130,248,70,21,118,66,88,52,49,251,8,8,159,198,145,169,182,26,
+233,96,200,72,77,86,104,61,81,30,153,129,5,193,179,177,165,178,27,184,168,
+94,69,83,121,69,111,81,31,78,109,107,109,105,27,118,123,149,152,148,141,141,
+156,154,31,150,148,145,150,150,26,162,123,156,117,109,117,113,103,92,175,
+105,190,232,239,233,247,97,247,17,30,64,251,180,5,205,6,158,208,198,240,221,
+240,8,119,74,134,114,101,26,42,181,82,209,175,175,152,165,172,30,159,154,
+151,152,173,182,126,149,24,93,99,102,117,98,27,93,110,181,205,247,18,217,
+247,38,206,157,154,128,126,130,135,133,127,129,31,126,128,135,131,125,26,
+115,154,123,162,168,162,167,175,185,102,176,92,47,45,51,251,109,251,30,30,
+217,247,185,5,14,251,162,247,25,247,109,21,162,6,209,169,118,89,68,91,91,
+69,83,102,163,197,105,31,123,131,5,61,171,189,105,221,27,239,217,200,216,
+195,103,173,60,154,31,184,142,161,91,10,14,60,10,14,251,84,70,29,166,149,
+168,170,168,186,162,181,247,8,29,147,136,135,142,144,29,14,251,116,248,23,
+242,21,104,111,117,121,126,27,130,132,145,148,145,139,139,147,167,31,228,
+247,227,5,57,6,59,135,128,135,103,102,109,105,121,95,109,251,2,8,251,19,104,
+128,116,110,27,130,138,140,146,128,219,29,163,151,165,158,31,159,164,153,
+178,168,241,185,247,61,171,183,212,137,8,166,6,50,251,223,5,133,116,138,131,
+127,26,113,152,124,162,176,180,170,210,197,30,14,117,248,128,248,70,21,251,
+77,251,203,110,247,217,69,123,121,136,70,131,25,134,120,5,142,150,146,140,
+148,27,160,152,131,126,135,138,133,137,131,31,73,251,136,5,89,126,128,124,
+118,27,133,135,140,144,131,31,146,129,132,141,129,27,115,123,124,116,111,
+160,121,171,169,163,153,166,158,31,151,157,148,161,153,192,211,247,157,24,
+169,252,34,5,157,6,247,135,248,34,56,251,201,5,135,122,136,122,125,26,113,
+152,123,161,167,172,160,178,173,30,167,172,152,153,124,151,5,103,110,118,
+122,126,27,131,134,145,149,145,140,141,145,164,31,226,247,222,5,14,251,56,
+247,71,247,147,21,120,29,199,247,115,247,51,144,99,251,41,5,136,127,135,113,
+128,26,115,154,122,160,176,176,169,217,200,30,126,150,5,97,107,125,128,122,
+27,129,132,145,147,144,139,139,147,169,31,227,247,222,5,66,6,93,251,67,5,
+14,123,29,130,116,174,29,215,165,230,179,202,31,187,169,176,165,178,27,14,
+247,112,123,10,169,247,1,149,178,156,175,164,176,25,241,208,197,199,169,27,
+154,148,124,111,128,138,130,134,122,31,79,251,116,137,124,5,136,124,139,138,
+126,26,108,150,124,162,174,173,167,219,205,30,126,151,5,100,110,121,124,122,
+27,130,134,145,151,138,31,145,7,202,247,127,5,147,168,142,159,158,26,181,
+121,164,107,112,102,122,113,111,30,100,104,123,120,62,44,8,14,247,21,146,
+21,126,163,156,134,164,27,247,17,247,22,247,54,247,48,220,99,193,80,91,102,
+112,67,91,31,165,237,103,132,103,134,73,129,25,134,120,5,143,154,144,140,
+146,27,155,148,128,120,131,138,132,134,122,31,33,252,34,117,54,134,132,106,
+138,25,113,132,29,247,105,150,10,103,6,113,128,144,153,147,142,157,143,153,
+31,224,247,203,21,157,207,150,164,163,168,8,169,163,169,157,164,27,172,158,
+104,80,251,30,48,251,41,55,113,119,149,159,128,31,14,251,108,247,250,247,
+1,21,90,104,94,111,93,27,84,101,185,206,247,27,230,247,32,226,237,29,127,
+26,119,155,125,162,165,160,167,174,182,98,174,88,251,22,251,23,251,42,251,
+43,48,193,78,220,206,204,178,209,187,30,14,201,247,102,248,85,21,82,128,123,
+137,78,133,133,120,24,141,153,148,140,143,27,151,149,129,128,133,137,127,
+136,130,31,43,252,2,5,211,6,169,247,0,156,198,164,186,191,208,25,208,191,
+179,172,168,27,154,148,128,120,131,138,133,135,125,31,52,251,219,5,211,6,
+168,247,0,154,195,163,184,188,204,25,224,203,169,166,170,27,154,151,126,121,
+132,138,136,135,121,31,69,251,156,5,133,117,139,139,131,26,113,156,121,164,
+181,180,170,203,184,30,126,151,5,106,114,111,116,124,27,132,134,145,146,144,
+139,140,144,153,31,200,247,124,5,147,169,143,165,158,26,176,117,164,106,102,
+100,117,93,95,30,112,110,117,111,83,59,163,229,24,149,173,140,147,152,26,
+172,114,166,107,77,71,75,251,43,40,30,14,251,108,64,10,14,189,247,141,84,
+21,116,53,136,134,105,137,8,113,132,29,247,106,6,143,157,5,112,6,103,130,
+143,157,144,140,144,143,153,31,168,247,1,5,125,164,155,135,162,27,247,18,
+247,22,247,54,247,48,218,91,195,72,103,112,128,111,103,31,212,247,164,103,
+134,67,127,139,139,107,135,25,134,120,5,143,154,144,140,147,27,154,147,129,
+120,129,137,127,136,128,31,93,251,67,5,168,109,117,149,106,27,251,3,251,8,
+251,43,251,38,47,192,75,216,162,158,143,153,173,31,148,173,21,118,111,116,
+130,114,27,101,116,179,206,247,32,219,247,49,209,174,169,108,104,130,137,
+124,134,124,31,212,138,21,149,180,150,160,155,153,8,154,156,164,148,160,27,
+177,159,102,70,251,35,51,251,41,54,115,122,148,160,123,31,14,251,108,247,
+99,247,82,21,180,251,21,5,90,155,160,116,166,27,172,170,168,216,186,31,125,
+156,5,90,109,121,120,123,27,127,127,158,182,125,31,85,247,48,5,229,199,163,
+163,169,27,145,145,138,135,153,31,135,152,145,138,144,27,158,152,153,159,
+164,122,156,115,114,114,125,109,110,31,122,120,139,139,70,46,99,247,7,125,
+164,111,154,251,19,111,24,134,122,5,144,160,149,141,150,27,188,166,99,251,
+37,191,31,78,47,5,80,101,114,112,122,27,133,135,141,152,125,31,147,130,131,
+142,130,27,120,125,124,119,114,158,122,166,175,174,168,200,180,31,14,248,
+88,247,0,21,102,111,120,123,123,27,131,133,146,149,145,139,140,144,157,208,
+29,75,27,123,130,151,159,147,139,139,145,160,31,227,247,221,90,127,82,130,
+97,136,137,29,97,162,110,170,199,216,209,247,21,223,30,109,251,1,5,247,41,
+10,166,155,149,189,190,30,109,86,131,117,109,26,128,7,140,121,139,136,133,
+26,115,132,129,102,117,30,150,126,5,205,176,163,166,177,26,148,138,146,135,
+156,30,134,158,137,153,154,26,165,145,153,166,176,30,14,234,247,138,158,29,
+130,134,117,31,81,251,109,5,131,109,137,127,119,26,95,159,111,171,189,200,
+196,247,25,228,30,125,83,5,131,110,136,121,123,26,99,163,108,170,189,206,
+202,247,12,218,30,114,46,5,134,121,136,121,127,26,114,155,122,162,166,160,
+152,182,184,30,112,94,130,114,104,26,140,114,5,140,133,139,134,137,26,120,
+129,127,105,118,30,150,126,5,206,176,162,166,177,26,148,138,147,135,155,30,
+134,158,137,153,153,26,166,149,163,160,166,30,126,150,5,102,112,120,123,123,
+27,130,134,145,149,147,141,151,142,152,31,227,247,222,5,67,6,118,61,5,251,
+29,102,251,2,251,56,85,27,124,128,152,157,148,141,152,141,147,207,10,93,97,
+99,110,27,124,130,150,158,148,139,140,145,160,31,14,251,33,247,247,248,82,
+21,127,121,121,133,118,27,127,133,140,146,118,31,148,109,115,144,121,27,94,
+106,120,82,89,31,151,129,5,165,162,162,152,159,27,147,147,137,132,161,31,
+133,160,149,137,155,27,164,140,140,172,225,31,68,88,118,121,112,110,8,74,
+71,105,71,79,26,57,189,84,214,247,0,230,220,235,212,93,188,71,106,114,131,
+114,99,30,177,206,187,201,193,190,8,251,44,251,110,21,162,171,166,149,164,
+27,183,165,107,86,59,82,71,73,101,116,172,194,176,147,167,161,186,31,14,156,
+248,238,243,21,96,89,122,124,128,138,8,132,132,146,146,143,139,139,142,149,
+31,237,248,4,5,67,6,39,252,12,5,134,122,138,133,131,26,118,159,122,162,171,
+182,172,208,197,30,252,3,247,246,21,88,127,85,130,96,136,133,120,24,142,155,
+247,48,29,128,132,117,31,86,251,67,5,133,120,134,106,122,26,74,183,97,208,
+247,6,235,224,239,210,95,185,70,106,114,131,114,98,30,126,97,21,167,178,160,
+148,163,27,177,161,109,88,56,83,67,74,105,118,164,181,160,140,145,151,179,
+31,14,251,97,247,124,248,81,21,88,127,85,130,96,136,134,120,24,167,10,122,
+127,137,129,134,119,31,92,251,67,5,134,121,135,110,121,26,72,186,95,210,247,
+3,231,220,238,212,92,188,69,105,116,131,114,98,30,128,97,247,9,10,85,71,76,
+104,117,166,184,157,141,154,147,168,31,14,251,111,247,44,247,140,21,131,109,
+5,247,54,6,129,93,129,111,124,111,8,83,109,93,107,87,27,91,107,163,197,111,
+31,123,132,5,61,167,185,103,208,27,247,18,247,4,247,23,247,38,247,1,72,212,
+39,54,67,90,81,113,157,118,162,160,157,156,160,147,135,147,131,148,31,130,
+149,137,142,147,26,161,176,158,184,200,176,91,60,124,138,128,137,121,30,14,
+184,247,77,247,110,21,235,6,133,112,137,124,118,26,39,194,73,223,186,193,
+163,183,189,30,203,195,177,221,221,26,235,81,208,58,44,41,58,251,4,97,30,
+42,6,191,247,88,89,127,85,130,96,135,225,10,141,155,145,140,149,27,158,147,
+132,122,128,137,128,134,120,31,48,251,232,5,211,6,248,27,248,55,21,180,168,
+97,80,74,115,51,104,74,31,82,109,101,110,97,27,94,111,178,201,214,165,231,
+179,201,31,188,170,175,165,178,27,14,251,87,248,53,247,0,21,95,102,129,130,
+125,27,128,134,145,151,147,141,151,142,150,31,227,247,220,5,141,92,75,140,
+121,27,251,31,63,95,60,75,181,108,233,133,31,53,125,110,116,98,49,8,90,116,
+130,127,121,27,124,126,149,160,128,31,123,130,5,99,160,159,123,167,27,184,
+185,178,212,180,31,186,226,158,154,210,147,103,251,24,24,135,123,136,120,
+126,26,113,153,123,161,177,160,156,230,215,30,251,14,247,30,21,137,108,136,
+139,129,27,134,6,82,104,168,187,201,194,180,222,155,154,138,138,158,31,14,
+251,237,247,96,248,47,21,247,70,6,163,224,5,125,6,122,93,115,122,95,140,8,
+251,116,6,136,126,5,175,138,149,133,120,26,132,139,136,134,125,30,48,251,
+206,5,135,125,137,127,131,26,119,159,122,161,170,182,172,201,191,30,132,160,
+5,88,99,124,125,247,6,10,14,251,73,247,128,248,172,21,176,247,21,77,129,129,
+138,76,133,25,133,119,5,141,154,149,140,141,27,151,151,129,129,132,135,119,
+131,111,31,133,119,5,48,6,131,109,5,230,6,251,33,252,142,5,210,6,153,187,
+170,244,147,157,178,199,25,235,201,194,193,174,27,162,156,109,98,53,91,251,
+71,89,41,31,70,104,104,106,101,27,131,134,143,145,142,140,141,144,142,31,
+146,146,142,145,149,26,159,122,155,117,115,121,119,112,104,167,118,184,207,
+198,183,229,193,30,203,247,0,184,247,39,243,26,217,112,185,95,78,56,65,251,
+23,51,30,219,247,167,5,247,40,6,148,169,5,14,251,116,247,40,247,132,21,247,
+3,175,201,207,204,27,237,29,126,26,121,155,124,158,167,162,168,174,182,98,
+174,88,251,21,251,24,251,43,251,41,91,152,100,163,114,30,114,163,176,122,
+171,27,205,214,184,206,185,31,121,148,5,89,104,94,112,93,27,84,101,185,207,
+159,141,156,144,166,31,247,53,6,147,169,5,14,251,163,247,236,248,75,21,125,
+6,125,129,129,132,130,27,135,132,141,143,131,31,152,113,117,145,116,27,79,
+90,90,79,95,153,112,194,75,31,181,92,156,108,109,26,95,103,103,96,86,101,
+191,215,135,30,123,6,115,251,43,5,158,6,154,148,145,144,152,27,145,146,138,
+137,146,31,123,186,149,137,164,27,214,197,194,210,184,123,169,81,206,31,91,
+193,127,160,168,26,172,163,164,172,193,171,94,64,138,30,155,6,14,252,18,247,
+107,242,21,102,113,110,111,124,27,131,132,146,146,142,140,144,140,144,31,
+241,248,16,86,126,93,131,90,149,29,125,137,128,130,26,119,159,121,163,169,
+182,172,202,191,30,134,248,167,179,29,252,18,232,248,35,21,141,154,144,139,
+147,27,157,151,129,123,133,137,129,136,129,31,43,251,252,120,67,133,125,121,
+114,25,120,124,116,126,118,27,128,132,143,148,132,31,155,148,148,155,156,
+125,151,119,117,122,123,118,112,170,119,181,222,207,215,247,24,175,31,246,
+248,36,84,128,100,133,88,135,25,247,20,247,89,179,29,158,248,53,248,70,21,
+57,6,38,145,75,67,99,251,59,8,251,10,108,123,106,111,27,130,137,140,147,129,
+219,29,161,151,165,159,31,156,161,156,186,167,237,186,247,61,171,184,213,
+136,8,166,6,74,251,137,5,133,113,137,126,119,26,68,182,98,214,247,3,232,219,
+235,211,92,188,69,106,113,131,114,99,30,127,97,21,167,176,160,148,164,27,
+180,162,107,85,59,86,73,76,105,115,166,176,157,143,165,145,161,31,14,191,
+247,78,247,115,21,247,55,144,122,76,5,134,120,135,111,121,26,72,186,95,210,
+245,234,218,227,178,120,174,107,158,30,152,118,113,144,98,27,117,122,138,
+135,105,31,184,247,64,5,68,6,92,251,68,251,55,136,120,29,247,186,247,121,
+21,140,152,153,139,142,27,184,155,137,134,151,31,163,127,153,113,104,26,70,
+85,75,80,102,118,166,186,157,140,145,148,175,30,14,239,22,153,193,173,247,
+13,152,167,198,217,25,210,193,180,174,170,27,152,149,128,122,129,136,120,
+134,122,31,76,251,131,5,131,112,139,138,126,26,113,156,121,164,171,172,163,
+200,189,30,148,151,126,150,5,102,111,114,116,127,27,132,132,147,147,143,141,
+152,140,143,31,203,247,126,5,146,167,144,167,157,26,173,116,163,106,107,110,
+123,95,92,30,104,107,131,128,67,40,215,247,165,24,247,42,6,148,169,5,251,
+42,6,172,247,15,83,130,123,137,76,132,25,133,120,5,141,154,149,140,142,27,
+152,150,129,128,134,138,133,137,132,31,137,132,137,133,136,26,130,105,5,51,
+6,130,109,5,227,6,251,34,252,147,5,14,247,50,55,21,247,45,29,118,30,150,125,
+5,206,247,16,29,154,137,151,146,26,160,167,195,167,172,30,158,160,152,158,
+171,187,109,251,1,24,90,29,227,247,221,90,127,82,129,97,137,137,29,98,162,
+109,171,168,171,156,175,181,30,101,87,127,112,103,26,14,114,10,251,76,251,
+88,21,141,142,5,247,3,186,200,200,203,27,180,167,101,83,112,137,122,131,102,
+31,129,105,21,251,13,104,69,59,69,27,92,108,175,194,175,145,174,151,178,31,
+14,251,75,247,161,197,21,137,131,137,124,131,26,118,158,122,162,177,176,168,
+212,196,30,126,150,5,146,29,72,27,122,89,10,8,14,234,247,141,158,29,129,134,
+118,31,81,251,109,5,130,106,138,131,120,26,94,159,110,171,190,199,197,247,
+25,228,30,125,82,5,130,108,137,125,123,26,97,163,108,170,191,204,201,247,
+21,224,30,111,38,5,135,122,136,119,127,26,114,153,123,161,179,187,178,208,
+186,30,126,150,5,103,112,119,122,123,27,131,133,145,147,144,141,151,142,150,
+247,52,29,251,37,99,35,251,48,83,27,123,131,152,163,149,140,150,140,142,207,
+10,92,98,99,110,27,124,130,150,158,148,139,139,145,161,31,14,247,89,248,129,
+248,70,21,129,80,78,37,44,251,9,8,161,200,146,170,183,26,229,98,196,75,78,
+86,105,62,80,30,152,129,5,192,180,178,165,177,27,181,167,96,75,83,120,66,
+108,80,31,78,108,108,110,105,27,119,123,149,152,147,141,142,156,153,31,151,
+148,144,150,151,26,161,124,155,117,110,116,112,103,94,173,106,188,232,239,
+230,247,96,247,21,30,58,251,176,5,204,6,161,209,196,233,224,243,8,118,73,
+133,111,100,26,90,153,92,159,120,30,148,130,147,136,160,133,8,186,128,162,
+105,81,26,123,139,124,137,121,30,157,6,184,247,82,5,99,119,141,144,123,31,
+105,150,122,170,189,26,247,18,220,247,41,207,157,153,128,127,130,135,133,
+126,129,30,126,128,135,131,125,26,116,154,124,160,169,162,168,175,183,103,
+174,95,47,44,52,251,105,251,32,30,222,247,187,5,14,251,114,247,44,185,21,
+98,251,43,247,2,10,142,153,5,100,247,28,10,183,247,55,247,68,247,165,182,
+208,149,247,11,29,134,123,5,144,6,159,148,134,125,127,128,117,114,98,31,251,
+24,251,101,117,247,105,5,137,164,138,149,149,247,29,10,251,76,6,135,247,58,
+29,144,132,144,109,149,52,8,14,251,136,232,247,148,21,211,192,193,174,195,
+27,192,173,93,67,115,137,123,131,107,31,251,154,6,132,110,137,125,121,26,
+66,183,94,209,247,19,247,14,247,41,247,45,227,92,196,65,87,84,113,93,94,30,
+116,115,120,111,108,86,8,247,135,251,21,21,75,114,98,103,90,27,106,117,164,
+177,149,140,148,143,157,31,14,57,29,251,167,247,145,247,134,21,143,141,143,
+141,5,202,167,169,175,188,26,191,99,174,79,109,107,129,121,114,30,123,128,
+130,131,102,103,151,125,24,180,181,173,157,174,27,172,163,115,104,110,123,
+110,114,121,31,127,130,123,130,115,126,8,251,46,6,130,104,5,231,6,79,110,
+111,102,89,26,75,183,97,206,195,168,156,217,216,247,49,10,96,113,167,185,
+184,167,176,192,165,31,247,52,6,148,174,5,14,251,114,247,98,135,21,156,201,
+247,68,247,165,183,208,148,247,11,29,135,123,5,143,6,159,148,134,125,127,
+128,115,114,100,31,251,24,251,101,117,247,105,5,136,170,139,144,148,247,29,
+10,251,75,6,134,247,58,29,145,132,144,109,148,52,163,251,126,24,126,89,5,
+251,1,6,130,99,5,246,6,122,78,247,2,10,143,153,5,99,247,28,10,156,200,5,247,
+2,6,148,179,5,14,251,108,247,156,248,243,116,10,83,252,139,74,29,248,80,249,
+36,21,113,123,122,111,137,139,136,140,137,31,140,129,139,139,136,26,119,108,
+165,10,120,118,108,93,186,109,211,219,208,183,190,158,124,152,116,30,251,
+114,251,103,62,29,14,251,175,247,2,247,241,21,180,180,174,157,174,27,174,
+164,114,103,95,112,109,66,104,31,65,104,122,130,116,119,8,116,119,126,111,
+107,26,72,184,97,211,200,182,165,209,194,30,128,150,5,92,93,100,119,97,27,
+94,112,168,186,188,247,53,29,162,8,160,157,150,164,168,26,193,97,175,78,85,
+102,118,75,82,30,247,16,247,36,21,174,6,247,65,247,1,5,151,146,144,147,152,
+26,160,123,155,117,130,247,59,29,252,18,247,107,242,21,92,101,119,121,127,
+27,131,132,145,147,142,140,144,140,144,31,241,248,16,86,126,93,131,90,135,
+225,10,141,155,146,140,149,247,30,29,64,251,174,5,136,130,138,130,130,26,
+112,156,121,163,175,176,169,214,198,30,251,3,248,159,21,212,10,247,52,22,
+212,10,14,251,84,70,29,171,154,151,151,176,200,8,195,174,149,149,157,27,146,
+146,136,135,143,144,29,233,247,149,21,174,6,247,65,246,5,150,147,144,147,
+152,26,159,123,155,118,129,194,10,251,108,64,10,247,16,248,170,21,140,130,
+139,139,135,26,119,109,165,10,119,118,109,92,185,109,212,219,208,183,190,
+158,124,152,116,114,123,122,111,30,14,248,114,247,4,21,110,110,5,107,108,
+127,130,129,27,131,133,145,146,161,187,247,80,185,247,50,247,51,10,77,247,
+40,10,95,27,251,27,251,50,251,79,251,52,69,177,98,203,211,182,173,247,17,
+230,31,116,56,137,131,113,26,110,151,127,167,180,163,158,231,216,30,251,58,
+247,216,21,173,137,161,115,104,26,55,86,251,13,69,63,30,112,114,105,122,110,
+27,102,117,167,185,195,178,242,184,204,31,181,198,186,171,180,136,8,247,54,
+247,126,188,10,160,113,8,109,162,174,124,184,27,193,186,163,184,173,31,159,
+166,148,161,147,181,8,14,251,108,74,10,247,246,248,84,188,10,159,113,8,109,
+162,175,124,183,27,194,186,247,4,29,251,91,247,93,247,141,21,126,134,129,
+137,122,137,197,247,91,24,89,127,85,130,97,136,133,120,24,141,155,146,140,
+148,27,158,147,132,124,129,137,130,234,29,150,146,140,140,27,146,143,138,
+135,146,31,96,251,41,5,175,6,171,247,0,5,137,7,162,58,146,117,154,111,8,110,
+154,163,121,165,27,179,174,173,235,196,31,124,148,5,85,104,118,120,111,27,
+116,130,152,192,124,31,121,210,116,171,102,146,8,141,7,164,149,169,170,167,
+184,163,180,247,8,29,146,136,135,143,31,125,152,145,136,153,247,49,29,114,
+118,73,98,31,115,98,120,116,118,120,173,247,11,24,102,6,14,251,91,247,111,
+248,75,21,92,127,82,130,97,136,133,120,24,247,45,10,129,137,129,234,29,151,
+145,140,142,27,150,149,133,128,147,31,145,130,141,133,152,94,166,42,153,113,
+174,119,8,172,118,149,119,97,26,127,138,119,138,119,30,157,6,184,247,82,69,
+140,134,143,121,205,25,120,211,116,171,101,146,168,150,174,177,171,195,8,
+176,159,150,149,158,27,147,145,136,132,145,31,129,148,147,135,152,247,49,
+29,113,118,73,99,31,90,57,105,113,74,131,8,14,251,63,247,72,247,147,21,194,
+247,82,91,127,81,129,99,137,25,133,120,247,7,29,137,129,133,116,31,41,251,
+232,5,210,6,203,247,115,247,49,144,96,251,41,5,136,128,135,110,127,26,116,
+147,130,170,129,30,172,128,152,119,97,26,125,138,118,138,119,30,157,6,184,
+247,84,5,88,140,122,144,153,26,144,139,140,146,168,30,234,247,222,5,68,6,
+89,251,67,5,14,251,114,247,94,247,82,21,177,251,21,153,97,152,119,154,136,
+25,174,128,154,109,80,26,127,138,122,138,121,30,157,6,184,247,84,66,141,134,
+142,121,203,25,92,247,44,5,229,199,164,163,168,27,145,146,138,135,152,31,
+135,153,143,138,145,27,157,153,154,159,163,123,156,115,114,115,125,109,110,
+31,121,120,139,139,69,46,102,247,7,127,164,111,154,251,18,111,24,134,122,
+5,144,160,148,141,150,27,187,166,99,251,37,186,31,77,47,5,80,100,113,112,
+123,27,133,135,141,152,126,31,147,130,131,142,131,27,119,125,124,118,114,
+157,123,166,174,174,167,201,181,31,14,251,82,247,129,247,83,21,177,168,160,
+162,174,191,72,251,129,24,137,132,136,121,132,26,119,158,122,160,177,177,
+168,212,196,30,126,150,5,96,106,117,119,124,27,132,133,145,146,145,142,155,
+142,150,31,239,247,241,5,68,6,128,76,88,57,82,93,174,247,19,24,91,6,95,251,
+47,5,138,135,138,139,135,27,123,131,148,156,146,139,142,143,151,31,192,247,
+75,90,126,89,131,92,135,25,134,121,247,7,29,138,131,131,114,31,117,61,5,134,
+125,135,111,129,26,104,160,116,172,152,151,141,144,153,30,117,60,5,187,6,
+14,251,82,66,10,131,137,124,131,26,118,158,122,162,155,152,143,151,157,30,
+123,112,131,114,113,245,10,118,30,149,125,5,207,247,16,29,153,137,152,146,
+26,150,142,147,154,168,30,150,150,154,156,157,164,8,14,251,108,74,10,247,
+98,247,180,21,170,6,251,8,247,43,5,155,126,128,146,124,27,118,124,124,119,
+127,144,130,153,128,31,14,60,10,247,109,248,19,21,171,6,251,11,247,43,5,155,
+126,128,146,123,27,119,124,125,119,126,145,130,152,128,31,14,146,247,228,
+248,83,21,196,247,110,89,127,87,130,93,135,225,10,141,156,146,140,148,27,
+158,147,132,122,128,138,133,133,115,31,109,251,5,5,251,42,6,121,74,5,154,
+6,160,150,151,144,175,27,223,6,76,251,135,5,135,121,135,110,122,26,71,186,
+95,210,247,2,231,220,238,212,93,188,68,106,115,131,114,98,30,178,247,42,5,
+247,3,6,175,149,134,118,141,31,154,6,149,204,5,251,126,251,123,247,9,10,86,
+71,76,104,117,166,184,157,142,157,146,165,31,14,123,29,251,60,251,121,21,
+150,167,155,144,148,27,153,148,133,118,153,31,122,150,151,132,154,27,159,
+164,146,154,176,31,251,14,102,88,75,78,27,92,112,177,203,169,142,165,149,
+180,31,151,181,21,238,169,198,204,197,27,180,168,97,79,113,137,120,133,112,
+31,133,120,124,136,125,27,129,129,143,145,133,31,169,111,136,141,121,27,118,
+111,132,123,102,31,14,34,247,192,22,177,214,236,247,88,150,160,177,198,25,
+165,155,157,155,152,27,144,143,136,133,140,31,116,144,147,132,162,27,169,
+165,168,173,163,121,152,106,100,109,123,102,106,31,108,104,120,106,71,251,
+26,121,106,139,138,96,56,72,247,180,24,137,146,138,147,146,26,169,151,148,
+180,143,30,143,154,5,251,87,6,136,124,176,136,142,135,166,251,0,25,212,251,
+212,5,14,251,162,247,49,128,21,240,138,218,200,217,26,195,103,172,60,155,
+30,185,142,160,91,10,131,110,5,162,6,209,169,118,89,67,91,91,69,83,102,163,
+198,105,31,123,131,161,78,183,101,199,129,25,84,51,247,37,10,147,141,150,
+129,29,129,134,138,137,129,31,14,77,247,240,248,84,21,251,131,6,109,251,5,
+5,154,6,191,165,183,164,204,27,177,6,138,136,120,70,48,251,232,5,212,6,196,
+247,108,5,140,152,145,140,140,27,160,153,124,106,149,31,163,57,147,116,155,
+111,8,109,155,164,121,165,27,179,173,173,236,196,31,124,148,5,86,105,117,
+119,111,27,115,130,152,193,122,31,119,212,115,171,99,146,167,150,167,168,
+168,187,162,181,139,139,143,143,8,152,149,150,146,151,27,145,147,136,135,
+143,247,51,29,162,167,117,156,102,97,114,118,73,99,31,91,56,106,113,73,131,
+8,14,251,108,247,78,128,21,209,142,195,172,193,210,123,149,24,93,29,54,180,
+88,217,127,30,85,52,247,37,10,147,141,150,247,65,29,162,134,167,247,61,10,
+251,82,66,10,132,137,123,131,26,138,139,136,140,136,30,108,98,124,104,104,
+245,10,117,30,149,126,5,207,178,161,164,178,26,148,138,143,135,158,30,135,
+154,137,151,146,26,149,141,145,145,154,30,130,149,149,135,151,27,177,176,
+168,212,196,31,14,238,248,89,202,21,174,76,5,247,40,6,142,156,101,142,128,
+147,118,171,25,96,210,211,206,158,155,160,148,163,140,25,142,153,5,251,37,
+6,136,125,5,166,137,145,136,128,26,130,133,130,127,127,30,117,119,58,247,
+26,216,153,179,156,171,170,25,172,171,158,184,186,26,188,114,175,88,162,30,
+154,105,103,144,66,27,251,127,6,135,122,5,192,133,152,131,114,26,129,137,
+121,135,123,30,56,252,32,122,62,128,129,70,133,25,135,122,5,247,145,6,143,
+156,5,83,143,125,147,168,26,150,141,153,142,156,30,177,247,72,191,141,246,
+251,83,81,84,120,125,120,132,121,138,25,136,125,5,247,25,6,142,153,5,113,
+132,142,150,144,143,145,147,147,31,37,248,128,21,166,144,151,145,183,27,231,
+185,109,79,63,95,84,59,116,31,106,129,113,136,75,138,8,14,247,232,248,140,
+249,96,21,251,96,251,52,251,50,251,95,251,91,247,52,251,51,247,93,247,91,
+247,52,247,52,247,92,247,89,251,52,247,54,251,88,31,164,82,21,247,35,126,
+247,6,251,6,153,251,37,8,251,163,6,247,164,82,21,130,251,34,251,13,251,15,
+251,34,128,8,247,168,7,83,251,168,21,251,39,153,251,5,247,5,125,247,41,8,
+247,166,6,251,166,196,21,153,247,36,247,7,247,6,247,37,153,8,251,164,7,14,
+247,232,173,137,21,146,6,213,6,247,68,205,151,183,204,31,241,208,213,247,
+54,247,47,26,234,109,222,91,177,30,167,103,90,152,74,27,251,43,32,86,46,105,
+31,125,102,135,115,138,73,217,177,24,148,7,138,234,176,183,230,153,61,252,
+62,24,122,64,114,92,109,129,116,140,24,229,22,143,142,194,185,158,182,161,
+247,19,25,199,247,236,5,146,6,142,6,180,150,138,135,152,31,196,118,169,73,
+38,26,251,102,44,251,41,251,30,132,30,247,141,251,153,21,218,6,177,247,98,
+5,123,178,142,138,161,27,247,20,247,1,247,57,247,83,247,0,94,195,54,87,94,
+117,98,106,31,102,93,118,80,115,251,24,8,234,230,21,230,156,175,192,185,27,
+180,161,97,60,251,42,82,251,11,67,110,117,150,165,119,31,14,247,228,248,140,
+249,96,21,251,94,251,53,251,49,251,89,251,92,247,50,251,52,247,91,247,89,
+247,52,247,52,247,89,247,86,251,52,247,55,251,83,31,128,82,21,247,61,247,
+28,251,24,251,58,251,59,251,26,251,27,251,58,251,58,251,26,247,26,247,58,
+247,55,247,26,247,29,247,53,31,14,51,184,146,21,228,6,174,247,2,161,209,180,
+211,193,200,25,194,187,191,176,167,27,151,147,130,125,127,138,136,126,100,
+31,76,251,105,5,130,109,134,113,120,26,108,158,115,164,173,187,176,208,197,
+30,118,153,130,130,138,138,126,124,25,119,122,128,131,129,27,131,132,146,
+148,143,142,152,145,159,31,200,247,99,5,158,203,141,146,162,26,180,114,171,
+106,87,61,85,58,77,30,127,124,127,123,127,123,138,138,134,133,131,130,203,
+247,107,24,247,53,220,159,193,251,59,51,189,247,54,251,62,117,129,112,5,151,
+6,174,156,129,119,129,135,119,126,94,31,123,80,251,6,82,121,90,247,7,194,
+5,14,247,62,249,123,247,59,21,39,92,88,101,51,27,96,103,148,169,64,31,233,
+247,3,148,158,174,247,77,8,247,37,194,239,244,236,26,213,83,193,63,64,71,
+76,40,108,30,121,81,131,95,130,251,8,61,140,88,152,90,172,8,88,174,110,189,
+193,26,179,157,174,175,170,30,175,169,161,149,224,163,129,168,24,251,45,110,
+65,81,45,26,81,168,80,188,95,30,194,91,201,119,242,137,132,251,19,104,38,
+87,94,8,181,48,75,159,91,27,76,99,116,102,85,202,103,234,197,174,149,178,
+217,31,103,233,192,126,185,27,194,194,163,180,176,31,161,163,151,161,158,
+185,8,251,118,247,150,21,142,141,194,140,154,30,143,225,144,170,156,185,8,
+193,158,180,173,183,27,181,171,101,89,93,114,84,99,94,31,108,106,110,120,
+57,101,8,251,108,251,238,21,110,95,100,126,93,27,74,81,164,167,164,173,154,
+192,170,171,131,124,175,31,190,117,139,139,154,133,8,14,88,165,248,125,21,
+123,7,86,187,101,207,207,180,173,196,186,120,154,57,157,30,81,152,124,147,
+157,26,164,164,157,173,177,156,125,102,147,30,182,6,199,137,101,173,74,27,
+77,98,105,87,96,162,122,211,126,31,200,127,157,129,113,26,112,112,120,100,
+93,113,162,180,138,30,247,118,247,81,21,251,188,182,247,162,143,7,199,251,
+162,5,192,6,199,247,162,5,143,251,162,182,247,188,59,6,87,251,147,84,247,
+147,5,14,87,247,67,248,219,21,181,203,187,157,186,27,219,199,74,53,46,79,
+61,69,106,114,150,158,125,31,159,177,142,147,157,26,164,121,158,114,109,118,
+113,102,94,172,102,202,115,30,65,117,106,116,69,58,163,118,24,210,209,178,
+160,203,27,242,221,51,251,2,33,73,51,59,86,95,175,182,157,144,151,154,158,
+31,101,141,130,143,92,170,8,166,96,117,148,112,27,89,93,95,90,115,147,120,
+162,108,31,166,161,5,124,158,134,150,157,26,172,167,167,173,174,171,104,101,
+121,133,127,120,121,30,176,138,146,137,165,122,8,90,213,176,124,183,27,247,
+7,247,0,247,14,247,21,201,114,199,96,184,31,105,174,109,156,78,156,187,158,
+161,152,164,159,8,182,175,166,198,199,26,245,49,228,32,72,82,115,77,53,30,
+14,143,249,44,249,20,21,119,168,114,124,5,171,84,131,142,109,27,100,106,126,
+103,88,31,187,77,121,148,103,27,76,77,98,72,101,31,96,66,115,42,45,26,251,
+10,179,251,3,207,67,30,78,197,222,102,217,27,212,216,172,195,194,31,172,172,
+156,166,166,200,113,150,24,107,94,127,124,119,120,8,102,101,85,119,79,27,
+58,62,175,197,94,31,89,205,110,237,245,26,215,153,209,164,191,30,190,163,
+188,173,187,27,161,152,133,114,171,31,142,137,144,135,144,135,8,91,85,127,
+113,92,26,97,155,102,183,82,30,181,84,139,139,144,131,8,159,109,148,114,117,
+26,123,131,120,127,124,30,119,122,123,132,114,27,87,95,185,193,158,143,153,
+150,159,31,106,154,5,127,108,135,124,118,26,64,206,74,215,219,203,206,223,
+173,128,171,116,171,30,118,169,98,189,118,161,8,103,176,131,153,167,26,189,
+180,178,191,161,155,131,109,175,30,140,137,145,135,147,132,8,14,251,110,224,
+247,70,21,237,151,197,151,186,157,8,228,172,190,191,197,26,201,86,181,61,
+251,44,251,28,251,29,251,45,251,7,211,66,247,5,209,202,165,196,203,30,163,
+160,147,149,149,26,153,124,153,125,130,134,136,130,129,30,85,82,82,112,86,
+27,94,100,160,172,120,31,129,159,134,162,172,26,147,197,21,243,176,218,208,
+220,27,176,164,119,110,108,119,117,88,116,31,82,114,80,124,67,131,8,14,251,
+110,211,247,5,21,102,251,5,5,248,10,6,176,247,5,5,92,6,165,227,147,181,200,
+26,247,17,92,202,44,30,251,58,6,95,141,129,146,135,171,8,119,114,133,124,
+111,26,112,148,114,155,124,30,127,151,154,135,171,27,247,34,6,237,166,110,
+251,2,88,135,113,124,86,31,14,251,220,227,247,4,21,107,251,4,5,247,33,6,184,
+235,165,97,141,133,149,91,25,156,157,144,159,187,26,172,135,177,130,202,30,
+129,202,137,162,178,26,160,140,151,142,161,30,141,152,140,151,147,26,175,
+118,156,82,146,30,86,147,121,147,124,162,8,123,116,134,125,115,26,116,145,
+118,151,123,30,154,119,151,133,181,135,8,190,134,155,122,89,26,60,133,67,
+127,93,30,14,198,249,91,127,21,252,228,248,226,247,95,52,161,184,251,191,
+247,18,83,85,247,22,251,186,184,159,52,247,94,248,228,252,225,5,14,198,134,
+127,21,180,98,248,229,248,225,51,251,94,185,119,247,22,247,186,83,193,251,
+191,251,18,161,94,247,95,226,5,14,198,134,249,1,21,248,228,252,226,251,95,
+225,117,95,247,191,251,18,195,192,251,22,247,187,93,119,227,251,94,252,229,
+248,225,5,14,198,249,91,249,1,21,97,180,252,228,252,225,226,247,94,94,159,
+251,22,251,187,195,86,247,191,247,18,117,183,251,95,53,5,14,247,228,247,51,
+248,95,21,248,219,247,4,10,247,19,5,217,7,251,178,247,19,116,87,247,102,57,
+5,252,219,6,249,62,251,242,21,203,252,219,154,10,247,228,249,221,248,95,21,
+203,252,219,7,247,102,221,116,191,251,178,251,19,5,61,247,27,29,40,251,178,
+21,248,219,161,10,252,219,6,14,198,248,224,247,71,21,120,132,86,112,90,113,
+8,248,22,7,212,100,164,127,162,130,154,159,24,38,211,47,220,88,200,88,79,
+52,63,32,61,154,119,24,163,148,164,152,211,177,8,252,22,7,91,165,86,165,119,
+147,124,119,24,242,65,230,59,190,79,191,201,234,223,236,207,8,251,184,248,
+22,21,165,160,143,142,157,149,156,128,145,135,163,120,8,252,102,7,112,118,
+136,136,122,129,121,149,139,140,109,162,8,14,251,92,248,32,247,92,21,131,
+47,71,83,40,141,8,251,79,85,247,72,6,193,179,147,156,173,31,210,176,179,212,
+231,26,225,104,208,77,178,30,163,101,97,149,77,27,251,72,85,247,79,6,239,
+140,206,84,147,47,8,251,254,84,6,14,247,228,247,125,248,206,21,80,248,196,
+198,7,252,196,251,201,21,80,247,143,251,94,198,247,94,247,142,198,251,142,
+247,94,7,80,140,5,251,95,7,14,198,247,220,249,129,21,254,124,197,250,124,
+7,14,198,247,144,250,10,21,28,251,139,197,28,4,117,7,238,22,28,251,139,197,
+28,4,117,7,14,247,232,248,169,248,149,21,73,6,251,116,252,149,5,219,6,247,
+69,248,45,247,69,252,45,5,219,6,14,247,232,248,169,22,247,116,248,149,5,59,
+6,251,69,252,45,251,69,248,45,5,59,6,247,116,252,149,5,14,247,228,249,138,
+249,216,21,99,6,251,36,142,58,46,117,251,83,100,128,114,128,114,124,8,86,
+104,105,73,68,26,37,201,70,247,6,112,30,128,251,47,78,72,251,17,144,8,103,
+71,175,6,247,62,142,213,222,152,247,91,8,234,149,220,234,241,26,205,102,206,
+86,171,30,116,153,116,148,101,149,154,247,43,201,211,247,0,131,8,179,6,251,
+179,252,182,21,72,156,98,187,202,26,203,176,184,210,163,30,199,138,21,167,
+131,152,134,152,129,8,170,117,162,91,96,26,74,98,92,72,127,30,14,247,228,
+249,122,249,5,21,103,109,110,103,103,168,109,175,176,168,168,176,174,110,
+169,103,31,252,124,199,29,247,137,252,133,21,102,109,110,103,102,168,110,
+176,175,168,168,176,174,110,169,104,31,14,247,228,249,123,249,5,21,101,110,
+110,103,102,168,110,176,174,169,169,175,174,109,169,105,31,252,125,199,29,
+248,125,252,133,21,101,110,110,103,102,168,110,176,175,168,169,175,174,109,
+169,105,31,252,126,22,103,239,29,103,31,14,247,228,249,7,248,74,21,205,247,
+39,66,140,73,251,40,5,251,227,80,247,201,6,104,62,5,251,166,80,247,140,6,
+102,57,5,251,103,80,247,77,6,74,251,36,212,138,204,247,37,5,247,229,198,251,
+203,6,176,221,5,247,166,198,251,140,6,174,216,5,247,105,198,6,14,247,228,
+249,204,248,220,21,253,35,251,184,5,96,7,249,35,251,184,5,215,7,252,173,247,
+129,248,173,247,130,5,77,4,252,35,251,67,248,35,251,68,5,215,7,251,123,239,
+247,123,238,5,14,247,228,247,61,248,220,21,63,7,248,173,251,130,252,173,251,
+129,5,63,7,249,35,247,184,5,182,7,253,35,247,46,21,63,7,247,123,40,251,123,
+39,5,63,7,248,35,247,68,5,14,247,228,248,197,248,247,21,148,93,124,140,61,
+27,251,134,73,247,134,6,204,155,138,133,168,31,251,111,252,118,5,251,25,73,
+242,6,102,57,5,210,6,176,221,5,207,6,247,2,171,144,164,200,31,247,12,190,
+207,239,247,22,26,247,21,72,239,251,15,191,30,182,232,5,67,6,251,102,252,
+255,21,247,104,248,101,5,237,103,190,64,251,1,26,36,98,71,52,98,30,114,86,
+93,131,43,27,14,247,228,248,138,249,76,122,29,247,188,252,26,21,251,48,122,
+251,19,251,7,251,48,27,251,48,251,21,247,8,247,47,123,31,140,198,21,247,46,
+155,247,20,247,9,247,47,27,247,49,247,19,251,6,251,49,156,31,14,247,228,248,
+138,249,75,21,251,93,142,10,251,84,31,251,130,252,185,21,94,196,117,200,209,
+26,247,58,247,26,247,27,247,58,208,203,117,94,196,30,183,96,21,184,82,161,
+78,67,26,251,57,251,27,251,26,251,58,71,75,161,184,82,30,14,247,228,248,134,
+248,32,21,105,112,113,104,106,166,112,172,173,166,166,173,172,112,166,106,
+31,143,247,192,122,29,130,79,21,247,64,247,27,251,24,251,61,251,57,251,27,
+251,26,251,59,251,59,251,27,247,26,247,56,247,57,247,27,247,29,247,54,31,
+14,247,228,247,73,22,205,247,137,248,199,206,252,199,247,137,73,6,14,247,
+228,249,190,248,193,21,72,251,137,252,198,72,248,198,251,137,206,6,14,247,
+228,248,98,22,205,248,202,247,133,206,252,183,72,247,132,6,14,247,228,247,
+108,248,218,21,247,137,252,218,5,207,6,247,143,248,218,5,65,6,251,103,252,
+128,251,99,248,128,5,67,253,107,21,248,196,205,252,196,6,14,247,228,250,124,
+247,174,21,88,6,251,51,138,251,6,106,61,70,38,45,109,52,140,251,89,8,88,201,
+190,7,141,170,140,247,50,173,220,236,215,25,198,184,238,164,247,19,141,8,
+190,6,14,247,228,136,247,174,21,76,190,7,247,7,137,233,118,197,102,8,247,
+0,67,180,49,251,57,26,141,108,5,88,202,190,7,140,247,88,108,227,38,233,61,
+208,251,5,172,251,51,140,8,14,247,228,136,247,111,21,190,6,247,49,247,7,173,
+208,217,31,240,233,170,227,138,247,87,8,190,76,88,7,137,108,138,251,49,105,
+57,43,64,25,79,94,42,114,251,20,137,8,88,6,14,247,228,250,124,247,111,21,
+202,88,7,251,6,141,43,160,82,176,8,251,1,212,98,228,247,56,26,137,170,5,190,
+77,88,7,138,251,88,170,52,239,45,8,70,217,247,8,105,247,49,27,14,198,248,
+234,176,21,251,130,248,107,251,130,252,107,5,248,15,198,21,251,175,6,247,
+35,247,176,5,14,198,247,18,170,21,248,102,247,133,252,102,247,132,5,201,252,
+14,21,247,173,7,247,179,251,35,5,14,198,247,14,248,143,21,247,130,252,107,
+247,130,248,107,5,252,15,80,21,247,175,6,251,35,251,176,5,14,198,248,229,
+170,21,248,117,7,252,102,251,132,5,248,40,251,30,21,251,179,247,30,247,179,
+247,35,5,14,247,228,247,133,247,223,21,247,157,251,184,247,153,247,182,251,
+159,247,186,5,14,247,228,247,82,247,224,21,247,202,251,235,247,203,247,236,
+251,203,247,235,5,251,157,251,235,21,247,157,247,184,247,157,251,184,251,
+157,251,185,5,14,251,54,247,139,248,99,21,35,53,54,37,251,0,223,54,246,243,
+224,224,244,244,54,224,34,31,140,81,21,211,198,80,66,67,80,79,68,63,81,198,
+215,209,200,198,211,31,14,196,242,29,247,114,251,48,21,247,175,194,41,249,
+213,237,194,251,175,6,194,254,12,21,249,213,214,253,213,7,248,2,232,29,196,
+242,29,247,111,251,48,21,247,175,250,67,251,175,84,237,253,213,41,6,247,45,
+22,249,213,214,253,213,7,247,163,232,29,121,157,248,68,148,247,104,152,6,
+162,10,217,11,162,143,143,142,143,143,143,142,143,145,143,143,12,12,248,136,
+20,249,40,21,174,19,1,26,2,0,1,0,16,0,35,0,109,1,7,1,141,2,14,2,136,2,159,
+2,168,2,198,3,35,3,38,3,97,3,102,3,113,3,133,4,49,4,219,4,226,4,232,5,117,
+5,125,5,130,5,133,5,146,6,15,6,131,6,196,6,203,7,57,7,122,7,147,7,253,8,102,
+8,119,8,222,8,230,8,239,9,76,9,81,9,116,9,127,9,210,9,231,10,47,10,125,10,
+131,10,207,11,0,11,17,11,88,11,139,11,210,11,254,12,67,12,70,12,77,12,132,
+12,195,13,1,13,62,13,114,13,166,13,190,13,243,14,9,14,19,14,32,14,80,14,94,
+14,141,14,188,14,223,15,13,15,19,15,46,15,91,15,126,15,170,15,212,15,223,
+15,249,16,3,16,10,16,17,16,55,16,58,16,70,16,75,16,110,16,117,16,132,16,156,
+16,167,16,201,16,219,16,252,17,29,17,62,17,71,17,103,17,135,17,167,17,191,
+17,222,17,245,17,255,18,29,18,59,18,63,18,92,18,121,18,148,18,177,18,206,
+18,232,18,235,18,255,19,4,19,30,19,48,19,72,19,76,19,81,19,86,19,100,19,125,
+19,150,19,164,19,183,19,188,19,200,19,224,19,248,19,253,20,7,20,30,20,53,
+20,76,20,97,20,107,20,112,20,134,20,142,20,162,20,183,20,189,20,208,20,212,
+20,224,20,233,20,239,20,243,21,7,21,27,21,40,21,60,21,67,21,74,21,78,21,91,
+21,101,21,107,21,126,21,145,21,164,21,168,21,172,21,191,21,210,21,221,21,
+226,21,244,21,249,22,9,22,27,22,45,22,63,22,71,22,76,22,94,22,97,22,103,22,
+113,22,130,22,147,22,157,22,174,22,189,22,197,22,212,22,227,22,237,22,242,
+22,250,23,10,23,18,23,23,23,37,23,53,23,57,23,72,23,87,23,100,23,115,23,130,
+23,137,23,152,23,165,23,178,23,192,23,206,23,220,23,227,23,241,23,255,24,
+11,24,25,24,37,24,46,24,55,24,68,24,81,24,94,24,107,24,120,24,131,24,144,
+24,157,24,170,24,183,24,196,24,209,24,215,24,228,24,241,24,254,25,11,25,18,
+25,25,25,37,25,49,25,61,25,73,25,85,25,97,25,109,25,121,25,133,25,145,25,
+157,25,165,25,171,25,182,25,193,25,204,25,215,25,226,25,234,25,245,26,0,26,
+11,26,22,26,33,26,44,26,55,26,66,26,77,26,88,26,99,26,110,26,121,26,132,26,
+143,26,147,26,151,26,157,26,164,26,167,26,171,26,181,26,188,82,29,110,151,
+127,167,179,163,158,230,214,30,76,29,11,118,29,174,167,247,0,214,247,154,
+31,159,208,155,153,208,147,95,10,11,248,111,249,46,21,54,49,99,66,59,31,38,
+46,80,251,14,251,9,26,251,32,230,40,247,19,247,100,247,94,247,102,247,118,
+150,30,247,33,146,42,246,251,26,27,129,106,21,219,188,81,45,251,0,92,251,
+38,74,45,31,60,84,78,100,68,27,55,93,199,247,1,234,247,16,10,11,155,248,39,
+21,159,140,174,138,145,137,146,118,25,151,106,156,251,28,143,45,143,51,24,
+100,141,141,131,148,27,150,156,164,208,175,31,144,150,159,174,169,192,228,
+247,48,24,168,251,211,5,112,141,141,136,146,27,147,149,148,173,166,31,139,
+144,145,143,144,30,247,29,247,56,214,247,16,203,26,170,117,161,109,114,125,
+126,118,126,144,130,155,125,30,155,124,145,128,127,26,96,105,86,251,23,251,
+55,30,107,247,244,5,150,137,142,133,134,136,137,131,134,30,251,84,251,196,
+136,209,128,244,128,208,25,203,128,137,146,127,27,133,128,136,135,126,31,
+138,103,132,107,134,30,135,128,137,137,128,31,11,249,88,232,10,124,143,5,
+115,122,122,129,112,27,129,128,141,147,117,31,155,92,93,147,98,27,251,103,
+251,84,251,92,251,112,71,168,69,186,91,31,88,190,212,112,226,27,227,211,158,
+182,216,31,188,247,79,156,195,154,151,204,143,25,155,251,158,123,7,192,133,
+139,139,152,132,8,146,135,144,130,131,26,117,132,109,118,67,30,118,68,135,
+130,127,127,8,117,117,101,127,94,27,251,21,66,213,247,23,247,15,188,247,20,
+218,222,31,186,184,201,166,205,27,204,194,112,93,169,31,155,114,146,117,144,
+95,157,136,24,11,230,249,17,21,195,131,142,136,156,84,216,251,161,24,78,251,
+104,122,85,117,123,73,135,25,123,247,181,155,7,123,140,127,140,131,140,122,
+140,125,142,129,144,8,132,144,134,149,152,26,160,146,169,163,217,30,142,148,
+141,146,140,143,168,240,24,247,111,247,162,171,179,147,146,169,153,25,155,
+251,81,123,7,187,134,139,139,150,132,8,145,136,143,131,131,26,112,93,74,35,
+251,13,30,122,119,133,131,124,121,127,183,134,156,125,188,8,114,225,128,182,
+154,26,164,151,144,199,145,30,155,251,131,7,11,250,30,215,29,251,77,123,6,
+193,134,150,132,111,26,122,132,116,125,112,30,251,79,252,4,99,248,38,5,138,
+144,139,146,142,26,179,153,152,193,144,30,155,251,130,123,7,197,137,149,132,
+146,90,148,70,24,251,64,251,240,95,248,42,5,138,144,139,146,141,26,178,151,
+148,200,146,30,155,251,128,123,7,172,135,148,136,148,130,151,128,143,120,
+151,47,201,252,153,24,158,6,247,114,248,90,5,144,6,189,252,90,5,159,6,247,
+195,248,219,166,190,149,148,177,151,25,11,175,247,38,21,247,21,10,150,157,
+135,134,159,31,132,162,154,136,156,27,223,77,10,11,248,104,56,10,106,141,
+72,8,11,249,107,215,29,251,91,123,6,84,10,247,122,252,186,5,157,6,247,36,
+248,139,176,247,22,143,144,202,153,25,11,220,247,201,21,159,188,154,150,185,
+138,8,247,38,6,251,202,252,8,148,130,5,152,155,152,144,155,27,165,171,126,
+110,186,31,108,189,172,126,168,27,189,183,175,179,161,125,153,118,119,125,
+126,120,131,142,130,145,127,31,142,133,141,133,136,26,130,128,133,123,114,
+127,148,180,106,30,95,196,120,152,81,152,247,182,247,236,24,150,251,176,7,
+108,251,7,5,11,197,29,14,248,39,215,29,251,165,123,6,202,133,153,131,110,
+200,29,123,248,145,7,197,247,71,119,145,104,67,112,107,95,117,25,122,104,
+98,133,51,27,64,114,147,165,147,143,160,145,160,31,247,15,248,79,154,190,
+165,158,199,143,25,11,249,32,73,29,11,248,64,21,98,10,132,107,5,98,29,11,
+249,13,215,29,209,29,251,36,252,164,159,10,247,31,248,134,226,29,5,11,249,
+45,21,146,166,5,251,170,6,132,112,5,151,6,185,156,128,107,128,138,131,134,
+122,31,39,135,81,125,80,104,8,46,85,75,251,0,35,26,74,167,88,191,110,30,181,
+115,185,130,217,138,136,126,24,123,80,116,121,79,138,8,128,6,132,112,5,247,
+170,6,146,166,5,128,6,92,121,150,171,150,139,140,145,162,31,142,152,247,18,
+148,196,156,203,187,25,218,198,191,240,237,26,198,113,186,93,165,30,99,161,
+91,148,50,142,8,197,151,165,160,199,27,251,209,252,182,21,95,141,120,144,
+113,151,8,94,161,121,171,196,26,231,179,239,195,190,30,183,177,190,158,213,
+146,8,238,141,21,245,128,186,97,55,26,70,110,54,99,87,30,91,78,89,115,40,
+128,8,14,248,41,21,78,6,136,134,141,145,131,31,157,112,106,149,101,27,251,
+3,49,62,45,87,160,109,197,113,31,80,99,121,119,115,26,126,147,127,158,125,
+30,40,74,121,119,93,26,70,205,94,240,247,18,223,198,226,202,92,182,43,165,
+30,95,150,113,155,154,26,154,162,165,152,141,141,139,138,142,30,137,148,150,
+138,150,27,231,232,220,217,156,136,156,133,161,31,189,6,251,216,251,230,21,
+140,141,138,138,141,31,142,138,149,136,155,134,8,246,105,175,112,93,26,85,
+81,99,62,59,92,177,203,163,145,156,155,158,30,157,153,180,171,147,27,247,
+40,248,27,21,176,158,115,92,103,127,96,120,105,31,98,117,108,117,105,27,101,
+117,167,186,231,196,219,204,31,11,21,223,186,185,141,29,14,247,149,247,222,
+52,29,249,102,215,29,251,114,123,6,151,138,148,138,145,138,151,138,149,137,
+145,135,8,142,137,142,134,134,26,115,84,85,50,77,30,251,44,33,192,247,86,
+154,189,166,159,198,247,61,29,136,119,131,112,30,251,15,252,78,121,79,134,
+134,80,130,25,123,247,140,155,7,76,146,130,145,170,26,150,140,146,146,160,
+30,141,145,141,146,141,147,201,247,120,24,247,13,251,100,5,163,98,153,104,
+120,26,124,125,131,107,136,30,134,128,138,137,126,31,123,247,167,155,7,76,
+145,133,142,111,186,251,66,247,195,24,247,192,247,118,167,160,162,150,163,
+143,25,11,86,10,173,167,236,204,30,11,247,103,87,29,11,163,29,14,248,104,
+21,72,29,122,185,166,133,170,129,10,11,247,158,247,223,21,216,6,191,162,125,
+106,123,137,130,132,106,31,156,6,205,247,133,5,120,6,116,61,108,115,62,141,
+8,72,6,209,247,151,5,242,6,240,178,115,77,127,138,132,135,122,31,157,6,181,
+247,50,5,252,117,6,135,121,5,174,152,138,133,149,31,152,133,147,126,124,26,
+127,137,125,135,125,30,251,14,252,94,122,72,120,121,80,137,225,10,248,130,
+6,200,247,80,5,123,6,117,91,119,113,105,115,8,105,92,76,120,71,27,55,126,
+143,163,146,140,144,143,154,31,11,248,50,247,1,21,77,103,133,133,121,27,118,
+118,172,235,100,31,134,152,124,175,122,178,247,40,247,23,168,159,187,142,
+8,155,251,75,123,7,182,138,151,135,126,26,119,89,91,46,67,30,124,128,125,
+128,125,128,247,12,248,93,24,247,28,29,188,140,157,132,140,120,137,122,132,
+112,126,93,135,125,136,128,137,131,137,130,24,251,19,252,119,5,214,6,187,
+247,72,181,171,155,95,165,77,157,104,25,76,171,157,120,168,27,179,164,164,
+223,185,31,11,133,10,115,94,67,247,41,29,155,142,139,141,140,142,31,230,247,
+255,136,141,80,125,103,133,84,132,25,125,7,177,141,138,134,148,31,145,137,
+144,130,132,26,131,134,114,130,105,30,102,251,34,5,120,66,133,107,231,10,
+251,2,124,74,247,21,29,11,247,114,248,81,62,29,11,21,135,121,5,158,6,186,
+138,159,122,153,88,247,16,252,62,24,69,97,115,112,120,27,129,128,145,149,
+130,31,180,102,136,141,115,27,109,117,117,108,96,181,105,194,184,177,158,
+177,169,31,173,181,146,149,220,247,22,247,55,247,156,24,215,247,14,175,174,
+194,142,144,157,24,251,101,132,29,168,6,165,154,132,127,126,135,132,96,71,
+31,251,77,251,184,62,247,222,5,138,146,138,145,148,26,171,156,154,176,30,
+160,204,29,14,249,17,21,196,132,153,130,113,140,29,150,141,147,149,177,30,
+192,247,85,5,133,165,163,137,181,27,221,207,156,170,181,246,10,251,140,6,
+247,68,81,21,160,145,151,146,167,27,178,177,130,124,159,31,165,121,150,109,
+92,236,29,134,139,144,110,31,11,118,29,173,169,247,9,207,247,127,31,141,146,
+141,145,140,145,160,209,155,153,207,146,95,10,11,247,93,248,20,21,135,170,
+134,155,125,154,251,27,108,24,135,123,5,143,153,145,140,148,27,184,155,112,
+55,147,31,165,251,190,5,65,78,100,102,123,27,134,136,141,147,137,31,155,133,
+130,146,124,27,115,116,117,117,118,157,121,161,193,247,7,247,6,247,76,247,
+25,31,222,247,8,184,224,181,26,178,117,167,108,116,123,124,116,117,154,119,
+162,132,30,150,136,143,134,129,26,103,65,251,12,48,251,3,30,11,247,231,247,
+41,21,55,99,91,98,79,27,86,103,178,197,185,157,175,174,165,31,119,186,160,
+134,169,27,172,158,151,160,159,118,151,103,110,120,135,125,100,31,135,154,
+138,147,147,26,215,182,200,193,170,157,122,110,140,30,140,114,139,139,144,
+129,8,126,146,152,131,155,27,165,158,159,167,185,88,172,70,35,60,87,70,106,
+151,117,174,113,31,66,111,93,87,84,26,72,200,89,223,230,201,186,241,184,30,
+11,248,62,241,21,146,29,71,27,123,89,10,76,251,128,24,137,11,247,214,251,
+64,21,247,23,248,127,5,145,163,143,162,158,26,174,115,163,103,83,77,84,251,
+22,49,30,167,240,5,142,152,141,153,148,26,169,122,157,112,83,79,87,55,100,
+30,157,128,5,192,165,177,181,162,27,149,146,130,127,133,139,139,128,99,31,
+53,251,217,5,211,6,177,247,33,156,204,188,215,201,197,25,172,173,155,149,
+156,27,154,148,128,121,121,138,136,125,89,31,251,18,252,91,5,11,21,111,117,
+118,112,161,29,11,247,6,29,156,126,128,145,240,10,27,60,48,98,67,60,31,38,
+46,80,251,13,251,9,26,48,168,78,205,91,30,53,251,19,5,183,6,213,247,0,5,124,
+177,164,133,170,27,247,102,247,100,247,115,247,118,185,127,187,117,176,31,
+124,164,126,152,107,165,8,252,51,252,188,21,121,173,132,169,177,26,243,186,
+247,35,202,230,30,219,194,202,178,210,27,173,162,132,120,164,31,163,106,21,
+156,11,247,242,72,10,14,249,6,21,247,39,6,169,153,137,132,150,31,157,128,
+150,117,112,26,120,137,121,133,107,30,156,6,185,247,66,5,252,97,95,29,11,
+21,251,193,6,128,88,5,247,193,6,14,248,7,247,3,21,79,66,107,123,95,27,82,
+102,175,194,155,141,148,148,177,31,167,143,5,247,45,160,247,0,217,226,26,
+181,109,165,89,251,39,251,53,251,60,251,45,58,193,83,218,210,218,180,207,
+199,30,251,111,247,50,21,229,174,215,217,190,27,160,153,124,116,107,120,101,
+107,109,31,101,103,101,122,51,117,8,11,21,127,157,117,166,106,178,130,149,
+132,148,134,147,8,179,112,114,167,92,29,14,248,127,215,29,251,146,247,58,
+10,119,131,110,30,251,23,252,101,5,100,128,125,124,115,27,115,128,151,167,
+144,139,144,140,144,31,148,7,164,117,161,112,112,121,117,107,86,186,104,209,
+190,184,159,176,170,30,166,171,159,184,160,215,242,248,7,24,157,199,146,145,
+196,147,8,11,199,193,215,178,118,182,92,197,31,101,186,123,170,167,26,172,
+160,159,174,191,169,102,61,149,30,155,6,159,247,31,5,125,6,125,130,133,135,
+124,27,131,130,141,144,120,31,147,114,125,141,122,27,65,92,96,72,107,160,
+96,181,85,31,178,88,156,104,110,26,93,109,108,95,83,109,180,234,123,30,11,
+198,29,247,70,180,10,26,127,137,136,109,101,30,252,5,252,101,91,79,127,129,
+115,133,25,123,247,79,155,7,86,145,128,144,159,26,162,178,200,200,212,30,
+143,143,149,151,150,153,8,247,82,6,90,251,62,127,102,132,134,78,133,25,123,
+248,134,7,203,247,56,5,252,231,246,21,247,160,247,234,44,251,234,5,11,248,
+75,21,136,141,54,124,86,131,107,137,25,123,7,166,140,5,146,6,167,151,129,
+117,129,134,113,128,95,31,67,251,184,5,251,30,105,116,96,141,10,185,226,199,
+214,247,52,179,30,11,247,108,92,10,113,119,82,75,30,113,116,128,131,49,69,
+8,11,21,251,80,251,43,251,45,251,82,251,83,247,42,251,42,247,83,247,78,247,
+43,247,42,247,79,247,89,251,38,247,42,251,85,31,140,97,21,247,49,247,18,251,
+28,251,61,251,51,251,22,251,28,251,45,251,47,251,22,247,28,247,55,247,56,
+247,22,247,29,247,47,31,14,5,79,136,128,126,247,1,10,116,6,90,124,151,179,
+144,139,139,140,168,247,32,29,92,76,124,128,104,140,25,128,132,29,247,90,
+6,143,157,5,120,6,109,124,148,157,145,143,149,145,148,31,11,196,134,152,129,
+103,26,127,137,128,132,118,30,138,136,138,135,138,26,37,252,16,251,100,248,
+135,5,251,53,123,6,186,135,159,126,158,100,251,11,252,53,24,101,251,20,131,
+127,82,131,8,123,247,90,155,7,87,143,121,150,167,26,152,142,159,145,160,30,
+247,6,248,58,11,247,202,248,80,21,251,20,251,18,251,35,251,38,40,247,54,29,
+196,177,221,221,26,236,81,208,59,30,130,114,174,29,214,165,232,179,201,31,
+187,169,176,165,178,27,11,247,15,21,56,74,131,131,117,27,129,134,145,151,
+147,142,152,144,157,31,140,143,140,142,140,26,141,7,247,43,248,215,134,144,
+79,125,101,133,81,132,25,123,7,187,159,133,122,135,138,133,137,131,31,251,
+30,252,164,5,136,129,138,130,132,26,102,156,120,171,191,11,88,10,14,21,224,
+186,184,141,29,11,131,148,157,146,139,141,143,151,31,188,247,75,90,127,86,
+129,94,136,225,10,167,10,122,128,137,130,133,117,31,118,61,5,136,126,135,
+113,127,26,104,161,115,173,170,173,153,166,174,30,173,165,158,161,175,192,
+11,84,251,19,67,61,30,114,116,108,123,113,27,115,127,161,177,141,31,146,247,
+39,247,1,247,71,219,135,8,224,251,90,21,169,228,157,173,174,177,8,159,159,
+162,151,162,27,162,151,126,116,117,132,118,126,119,31,108,92,96,115,49,116,
+8,11,145,163,154,8,171,160,157,169,175,26,202,87,175,50,82,99,126,112,110,
+30,121,121,127,115,119,26,112,157,119,163,161,159,157,159,147,134,148,130,
+148,30,128,150,137,143,147,26,160,174,155,187,194,169,114,93,78,88,100,58,
+30,121,6,11,21,151,121,161,112,172,100,148,129,146,130,144,131,8,99,166,164,
+111,148,27,143,142,142,143,149,114,194,102,207,31,136,144,131,156,130,157,
+166,169,161,162,155,153,152,151,152,152,152,152,8,175,177,155,162,152,26,
+143,136,142,136,132,11,121,81,132,133,83,129,25,123,247,138,155,7,79,147,
+128,146,168,26,146,140,147,141,146,30,205,247,136,5,247,177,6,74,251,128,
+123,87,247,57,10,74,145,126,147,168,26,148,140,145,141,147,30,11,159,152,
+174,30,154,204,29,251,160,6,133,121,5,157,6,189,138,157,122,161,72,208,251,
+141,24,251,56,251,90,5,86,97,76,98,103,27,133,121,5,247,101,204,29,118,6,
+108,123,147,154,147,143,11,128,10,247,19,247,23,222,210,247,42,183,30,222,
+247,177,177,247,22,143,144,201,153,25,11,191,120,181,103,166,31,121,152,124,
+146,104,149,195,153,164,149,168,162,8,181,171,160,182,190,26,225,73,196,39,
+104,124,136,122,89,30,134,123,130,137,132,27,124,131,148,157,31,123,6,100,
+251,78,5,11,109,29,163,152,138,135,148,31,155,133,149,125,123,26,126,137,
+126,135,125,99,29,11,109,10,119,93,109,43,8,47,6,11,115,126,183,29,155,26,
+149,141,155,143,154,30,11,136,141,86,128,117,135,52,123,25,123,7,190,138,
+152,133,119,26,133,138,133,138,134,30,43,251,242,5,214,6,186,247,50,148,161,
+183,207,8,231,199,190,189,176,27,154,148,128,121,11,131,10,146,144,148,151,
+26,160,123,154,118,130,194,10,247,250,247,1,21,80,67,108,123,95,27,83,102,
+175,194,154,141,153,147,171,31,167,143,5,247,42,160,245,215,225,26,181,109,
+165,89,251,36,251,49,251,56,251,43,58,193,83,11,214,6,179,247,46,152,173,
+179,200,8,218,191,207,201,174,27,154,152,127,126,135,136,126,135,123,31,84,
+251,99,5,126,90,132,108,127,26,113,156,123,167,189,174,166,226,199,30,11,
+80,84,100,117,90,27,82,105,181,211,224,174,229,195,197,31,169,168,179,157,
+179,27,162,153,131,127,134,137,134,135,130,31,243,29,11,248,106,249,51,21,
+55,49,95,66,70,31,55,49,85,251,17,33,26,251,46,224,50,247,37,219,213,171,
+198,199,30,236,236,203,247,31,247,8,26,247,35,49,234,251,26,30,11,247,17,
+247,202,118,10,140,148,140,144,31,177,247,33,177,29,106,26,129,137,127,135,
+124,30,105,251,18,5,134,118,137,128,11,249,92,247,39,21,84,6,218,247,151,
+5,103,6,251,163,251,151,126,97,5,247,60,6,107,34,5,202,6,169,243,5,197,6,
+89,247,121,21,79,251,78,5,251,21,6,11,247,50,168,176,209,195,27,153,147,134,
+131,137,138,136,136,135,247,14,29,158,157,161,177,102,166,89,91,100,117,93,
+103,30,109,99,11,31,181,128,164,104,91,26,86,103,99,91,127,127,144,153,120,
+30,150,122,126,145,131,27,122,126,127,123,114,164,125,187,247,0,216,204,231,
+165,132,159,125,155,31,130,11,5,181,131,121,155,100,27,251,22,251,54,251,
+80,251,42,68,179,96,204,207,183,171,239,207,31,128,88,137,124,116,26,112,
+156,121,164,181,192,180,212,190,30,11,148,131,5,144,153,147,141,149,129,29,
+11,6,190,247,82,109,29,194,138,156,129,107,26,129,137,123,135,127,30,251,
+14,252,94,122,71,119,11,130,10,214,26,223,81,196,54,30,11,21,85,94,94,85,
+125,10,196,29,247,46,198,10,11,31,122,153,5,51,49,81,109,57,27,251,3,75,214,
+247,22,247,11,187,247,13,217,220,31,188,187,202,167,205,27,231,190,85,251,
+0,149,31,11,21,194,29,141,149,189,10,180,162,134,168,138,10,130,11,249,46,
+127,10,11,21,251,91,251,58,251,56,251,87,251,99,247,53,251,56,247,93,247,
+97,247,55,247,54,247,95,247,94,251,55,247,55,251,94,31,11,21,106,128,126,
+136,29,11,248,81,21,89,127,83,130,98,136,134,120,24,169,10,11,247,33,248,
+157,5,212,158,156,153,213,27,144,157,5,251,163,6,133,121,5,194,243,10,11,
+209,10,109,103,102,110,111,101,102,214,29,133,83,129,25,123,247,145,7,247,
+9,246,170,195,216,31,236,210,196,247,2,247,8,26,247,56,251,6,244,251,70,30,
+251,170,11,247,47,29,171,169,161,159,166,156,247,7,10,161,165,192,174,30,
+11,8,155,251,165,123,7,206,133,150,133,110,26,127,136,123,135,122,30,86,251,
+84,5,109,251,1,126,77,97,26,44,230,70,11,27,247,7,226,225,247,6,204,117,177,
+48,231,31,49,230,130,153,188,26,202,181,178,206,178,169,126,115,160,30,161,
+114,147,11,247,217,248,77,21,96,100,128,117,98,31,36,81,67,251,7,33,26,52,
+195,86,230,205,203,168,197,197,30,205,204,179,223,11,21,174,6,247,63,245,
+5,151,11,21,169,137,154,120,103,26,251,44,35,251,64,47,104,116,165,179,221,
+189,247,9,205,209,30,167,168,176,158,167,137,8,11,248,97,247,9,21,73,86,125,
+126,123,27,132,135,145,150,145,139,139,158,211,31,218,247,191,5,65,6,85,251,
+40,128,11,115,26,110,158,119,168,179,174,167,216,196,30,123,148,121,118,128,
+127,135,134,25,117,117,126,130,129,27,133,134,143,145,11,195,195,184,29,113,
+121,145,128,158,122,30,154,125,144,131,128,26,112,116,112,87,105,30,14,137,
+142,133,133,136,138,131,133,30,100,89,77,88,107,130,8,114,131,132,133,128,
+26,138,139,137,140,136,30,213,6,11,103,78,27,75,99,176,201,135,203,29,162,
+173,124,184,27,192,186,163,183,172,31,159,11,27,209,188,175,189,181,107,165,
+89,11,26,144,137,143,136,137,135,138,137,135,30,135,138,135,138,5,133,125,
+139,139,133,27,134,128,141,141,124,31,144,11,30,122,119,133,131,124,121,127,
+184,134,156,125,189,8,114,226,128,182,154,26,164,151,145,199,145,30,155,251,
+131,11,99,143,10,11,251,54,251,53,251,92,251,88,247,54,251,54,247,87,247,
+89,247,55,247,55,247,87,247,88,251,54,247,57,11,27,127,133,143,146,143,140,
+141,143,144,31,145,147,141,144,147,26,160,121,155,116,116,122,121,115,103,
+172,114,11,181,172,164,149,179,140,25,145,157,5,251,90,132,29,174,140,152,
+134,126,26,131,135,134,122,125,30,11,251,110,247,47,21,228,173,213,216,190,
+27,160,153,124,115,108,120,103,108,109,31,102,104,101,121,53,118,8,11,102,
+122,105,251,10,117,30,53,252,58,21,111,117,117,111,112,162,116,166,166,162,
+161,166,168,117,161,111,31,11,194,247,83,159,209,158,155,203,140,25,144,157,
+5,251,155,132,29,195,138,156,130,108,26,128,137,11,153,29,14,167,10,121,129,
+137,128,134,119,31,81,251,109,5,130,106,137,127,121,26,11,6,144,157,5,11,
+248,86,21,188,6,165,194,5,165,195,155,189,163,26,163,127,152,118,91,122,105,
+251,15,127,30,11,90,103,77,27,76,99,175,202,135,203,29,161,174,124,184,27,
+192,11,123,30,251,171,251,126,190,247,83,157,210,158,154,204,140,25,144,157,
+5,251,159,132,29,11,7,171,29,14,173,10,132,30,14,205,10,130,194,10,131,10,
+146,144,148,151,26,160,123,154,119,129,194,10,82,146,128,145,167,26,159,141,
+149,148,172,30,247,15,248,79,157,197,146,145,196,149,25,155,11,123,86,115,
+123,73,134,25,123,247,182,155,7,53,146,135,141,176,26,151,141,149,149,175,
+30,11,145,129,158,122,30,154,125,144,131,129,26,112,117,11,247,4,10,247,20,
+5,216,7,251,178,247,19,116,86,247,102,58,5,11,21,174,172,29,11,235,10,116,
+112,115,130,107,27,103,116,160,11,118,123,122,116,103,172,113,184,229,208,
+236,247,78,181,30,211,247,212,5,247,47,6,150,11,122,104,110,113,152,154,143,
+141,144,141,144,30,148,154,141,145,148,26,157,124,152,118,110,11,118,248,
+187,179,10,142,155,147,140,148,27,158,147,132,11,134,142,5,135,135,139,137,
+129,31,135,114,112,137,110,27,251,42,6,169,244,154,179,11,142,155,146,140,
+148,27,158,147,132,122,128,137,127,134,120,31,48,251,232,5,211,6,11,30,75,
+154,173,104,188,27,247,2,244,247,54,247,64,207,106,191,97,116,119,120,116,
+11,114,105,115,8,105,92,76,120,71,27,53,126,143,163,146,140,145,143,153,31,
+14,183,29,156,26,152,141,151,183,10,11,21,174,186,29,11,21,217,6,192,162,
+124,106,123,137,129,132,108,31,156,6,203,247,133,5,122,6,11,182,29,167,146,
+247,5,29,11,157,31,140,143,140,142,140,140,8,141,7,208,247,157,237,189,151,
+185,5,14,6,79,87,5,82,7,247,154,247,114,251,154,247,114,5,82,7,199,87,5,11,
+211,10,247,189,22,11,21,112,119,117,108,107,158,118,168,165,162,162,167,168,
+116,165,112,31,14,22,211,29,14,26,128,137,124,135,125,30,251,15,252,94,11,
+140,143,129,31,123,145,129,153,11,143,154,247,24,29,11,138,225,10,11,6,251,
+11,247,43,5,155,126,127,146,124,27,119,124,124,120,126,145,130,11,132,140,
+143,127,31,146,118,133,140,127,27,110,120,124,116,117,158,124,167,11,21,174,
+6,247,62,245,5,152,224,29,130,130,11,21,75,114,90,103,76,27,75,98,176,202,
+134,31,110,6,140,81,147,108,11,202,10,121,247,5,10,11,154,190,165,229,10,
+124,11,201,29,91,11,247,22,247,21,191,195,247,13,31,247,46,29,11,21,103,6,
+251,35,34,50,247,23,29,131,136,132,132,30,14,21,111,116,117,111,111,162,116,
+167,166,162,162,167,166,116,162,112,31,11,21,112,116,116,113,111,162,116,
+166,166,162,162,166,166,116,162,112,31,11,21,169,164,114,109,109,114,114,
+109,110,113,164,168,170,164,164,169,31,11,22,212,29,11,206,10,117,11,191,
+106,218,199,189,157,172,170,30,154,156,149,160,155,26,161,122,153,11,116,
+247,19,251,178,5,216,6,247,20,247,178,86,162,58,251,102,5,11,27,166,158,121,
+113,113,120,124,105,118,11,138,137,130,31,14,6,247,64,247,0,5,151,146,144,
+147,152,26,159,123,155,118,129,11,21,174,226,10,11,247,37,10,147,141,150,
+27,166,158,121,113,113,120,124,105,11,31,224,247,210,5,67,6,120,61,127,89,
+101,56,103,83,25,67,11,159,251,23,5,140,130,140,130,131,26,101,125,130,75,
+133,30,123,11,83,182,95,196,194,184,184,193,194,94,184,83,31,105,4,176,169,
+11,251,14,252,94,247,3,29,11,109,114,231,29,11,111,117,118,112,110,161,117,
+167,166,161,161,166,165,115,163,114,31,11,229,29,14,6,251,32,252,157,11,247,
+40,29,66,44,26,251,8,184,11,142,145,30,149,157,141,144,148,26,160,123,153,
+115,107,117,116,11,150,72,27,87,99,21,142,154,146,140,153,27,215,182,102,
+75,11,247,48,10,149,155,154,164,27,156,11,156,27,146,143,135,129,144,31,122,
+147,147,134,159,27,169,155,11,181,96,192,188,180,164,191,247,38,29,116,112,
+115,130,11,106,247,12,10,200,164,30,11,247,174,247,147,21,251,111,6,125,76,
+5,247,112,6,14,250,18,247,135,21,254,16,6,131,93,5,250,16,6,14,31,129,165,
+157,134,152,27,187,172,11,25,134,121,5,11,247,25,10,160,123,154,118,11,248,
+27,247,44,21,84,248,146,5,251,69,6,134,121,172,11,21,209,247,160,247,28,29,
+11,158,199,244,29,11,188,180,165,190,247,38,29,117,112,115,129,107,27,11,
+121,26,102,157,121,174,210,192,193,247,85,247,7,30,109,11,249,42,21,11,6,
+123,131,129,133,119,27,130,128,141,144,118,31,150,11,134,144,79,125,100,133,
+81,132,25,123,7,165,140,5,11,26,88,182,96,191,188,180,164,191,247,38,29,11,
+157,5,85,140,122,150,171,26,149,141,151,143,155,30,11,172,30,153,105,112,
+143,70,27,251,172,77,247,183,6,11,221,225,200,247,33,10,11,110,110,102,103,
+169,110,176,174,168,169,174,176,110,168,11,124,27,119,124,124,120,127,145,
+129,152,129,31,14,248,119,21,88,6,252,67,253,75,5,191,6,14,5,178,165,156,
+151,170,27,160,160,134,130,156,31,11,138,156,129,106,26,129,137,124,135,127,
+30,251,14,11,21,100,113,122,127,108,27,118,118,144,148,122,31,11,26,128,7,
+247,45,29,11,31,189,176,168,194,198,26,235,64,192,251,28,30,11,247,114,247,
+6,21,114,106,133,131,129,129,8,122,11,92,27,116,6,135,121,5,247,156,150,10,
+11,119,71,131,131,84,132,25,135,125,5,247,85,6,11,26,160,129,150,120,98,126,
+111,33,128,30,14,6,251,102,57,162,87,247,178,11,143,150,110,31,122,110,5,
+123,11,124,27,132,132,145,147,143,140,143,140,144,31,11,133,150,120,156,30,
+124,153,134,147,150,26,166,11,141,144,129,31,127,145,131,152,154,26,149,142,
+11,21,167,177,159,148,163,27,179,163,106,83,60,11,146,26,166,160,151,182,
+30,160,6,143,157,5,11,225,10,247,151,6,144,157,112,140,131,11,26,93,107,109,
+92,91,109,167,183,186,166,171,11,30,247,31,248,155,21,143,162,151,140,152,
+27,11,31,122,110,5,123,180,162,134,168,27,209,188,11,168,200,201,30,238,236,
+202,247,30,247,11,26,11,188,247,40,200,226,31,220,195,200,177,212,27,11,76,
+84,129,131,122,27,129,131,147,151,155,170,11,249,56,247,47,10,11,86,217,251,
+142,24,81,251,108,120,66,120,124,11,251,20,247,178,5,62,6,251,19,251,178,
+192,11,119,251,51,5,155,6,156,148,143,143,150,27,11,123,27,130,133,146,152,
+140,139,139,140,143,31,11,129,131,136,132,133,30,11,121,5,194,138,156,129,
+11,6,247,63,245,5,151,147,144,147,151,26,11,6,59,251,105,5,201,6,218,247,
+105,5,11,132,133,82,131,25,123,247,144,155,7,81,11,143,129,146,162,26,151,
+142,157,144,158,30,11,26,168,155,155,169,30,146,6,144,155,5,11,27,162,159,
+129,127,137,138,136,136,135,31,11,31,126,164,157,135,162,27,247,38,247,46,
+11,158,122,30,154,125,144,131,128,26,113,116,11,191,212,180,126,160,86,186,
+30,114,161,21,11,218,105,30,125,173,166,135,208,27,247,172,11,120,117,134,
+30,133,115,130,61,131,37,8,11,129,150,120,98,125,110,34,11,148,131,5,144,
+152,11,129,130,27,131,131,146,147,149,142,155,11,5,212,158,157,153,213,27,
+143,157,5,11,132,136,136,128,91,5,176,131,110,160,11,135,122,136,121,126,
+26,114,153,122,161,11,137,136,148,31,155,133,149,125,122,26,11,184,10,247,
+151,6,144,157,11,140,132,139,128,143,25,123,144,129,154,11,142,155,146,140,
+149,27,157,147,132,124,11,21,126,96,5,248,142,6,152,182,5,11,21,88,6,252,
+91,253,66,5,190,6,11,27,87,111,110,62,119,31,168,6,171,11,30,127,151,5,93,
+93,100,118,97,27,11,30,133,121,5,247,161,6,145,157,76,11,31,142,149,140,141,
+141,148,132,142,24,11,164,164,158,158,163,164,118,160,115,31,11,171,165,178,
+183,26,182,114,165,99,130,11,195,131,142,136,156,83,216,251,165,24,11,79,
+80,58,109,35,27,93,120,150,165,11,101,114,96,27,92,108,175,194,213,168,11,
+119,124,74,132,25,123,247,165,155,7,11,123,6,202,133,153,131,112,26,124,135,
+11,5,167,10,11,153,182,29,11,138,10,129,133,203,10,143,150,109,247,14,10,
+11,99,29,14,126,29,130,11,133,30,147,251,52,131,10,224,29,11,184,29,113,120,
+160,10,11,};
+#endif
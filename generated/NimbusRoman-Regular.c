@@ -0,0 +1,2654 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusRoman_Regular_cff_size = 55266;
+asm(".section .rodata");
+asm(".global fz_font_NimbusRoman_Regular_cff");
+asm(".type fz_font_NimbusRoman_Regular_cff STT_OBJECT");
+asm(".size fz_font_NimbusRoman_Regular_cff, 55266");
+asm(".balign 64");
+asm("fz_font_NimbusRoman_Regular_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusRoman-Regular.cff\"");
+#else
+const int fz_font_NimbusRoman_Regular_cff_size = 55266;
+const char fz_font_NimbusRoman_Regular_cff[] = {
+1,0,4,2,0,1,1,1,20,78,105,109,98,117,115,82,111,109,97,110,45,82,101,103,
+117,108,97,114,0,1,1,1,53,250,26,0,250,27,1,250,28,12,0,250,29,2,250,30,3,
+248,24,4,32,12,3,251,60,251,173,250,124,250,177,5,29,0,76,157,3,13,28,51,
+157,15,28,51,179,17,188,29,0,0,190,63,18,2,4,2,0,1,0,3,0,9,0,16,0,22,0,28,
+0,38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,0,123,0,136,
+0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,216,0,227,0,
+238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,1,103,1,115,
+1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,190,1,196,1,
+206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,2,38,2,44,
+2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,2,151,2,
+162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,3,20,3,
+27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,118,3,
+131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,3,216,
+3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,73,4,
+79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,163,4,
+168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,4,251,
+5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,5,127,
+5,136,5,141,5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,229,5,
+237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,112,6,
+121,6,128,6,137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,6,248,
+7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,115,7,
+122,7,134,7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,7,211,
+7,214,7,219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,1,8,4,
+8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,
+8,80,8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,8,127,
+8,132,8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,230,8,
+239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,134,9,
+154,9,163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,10,
+6,10,15,10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,114,
+10,123,10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,10,
+213,10,222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,46,
+11,53,11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,11,
+144,11,151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,214,
+11,221,11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,12,54,
+12,63,12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,153,12,
+162,12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,12,252,
+13,5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,102,13,
+111,13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,13,191,
+13,200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,14,18,
+14,25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,102,
+14,109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,14,
+179,14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,249,
+15,0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,15,
+84,15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,15,
+161,15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,78,16,90,73,74,65,
+98,114,101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,67,99,
+97,114,111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,
+99,114,111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,116,
+69,111,103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,99,99,
+101,110,116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,76,99,
+97,114,111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,110,103,
+97,114,117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,83,
+97,99,117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,114,
+105,110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,99,117,
+116,101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,117,
+110,105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,114,
+99,117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,114,
+99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,105,
+114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,73,
+109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,109,
+102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,109,
+97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,109,
+97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,114,
+99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,85,109,
+97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,73,98,
+114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,111,
+103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,111,
+116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,101,
+99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,110,
+101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,97,
+99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,82,111,109,97,110,32,82,101,103,117,108,
+97,114,78,105,109,98,117,115,32,82,111,109,97,110,1,17,2,0,1,0,10,0,38,0,
+52,0,120,1,0,1,127,1,245,2,12,2,89,2,102,2,205,2,232,3,25,3,33,3,55,3,75,
+3,108,4,12,4,166,4,175,4,203,5,73,5,103,5,222,6,84,6,92,6,111,6,194,7,45,
+7,74,7,172,7,187,7,245,8,21,8,122,8,219,9,29,9,108,9,112,9,146,9,233,10,48,
+10,132,10,208,11,0,11,4,11,80,11,92,11,167,11,239,12,50,12,118,12,186,12,
+200,13,3,13,59,13,122,13,146,13,196,13,205,13,215,13,228,13,237,14,37,14,
+83,14,89,14,109,14,134,14,154,14,205,14,254,15,48,15,98,15,134,15,175,15,
+182,15,230,16,22,16,27,16,74,16,119,16,126,16,137,16,178,16,201,16,243,17,
+1,17,17,17,33,17,43,17,64,17,99,17,137,17,156,17,179,17,205,17,242,18,6,18,
+39,18,52,18,87,18,98,18,132,18,152,18,185,18,218,18,229,18,238,19,14,19,46,
+19,78,19,83,19,114,19,133,19,164,19,181,19,211,19,241,20,15,20,43,20,72,20,
+101,20,116,20,143,20,171,20,199,20,216,20,243,21,14,21,41,21,47,21,73,21,
+94,21,120,21,131,21,157,21,181,21,186,21,200,21,218,21,240,21,254,22,2,22,
+26,22,50,22,67,22,90,22,97,22,118,22,126,22,148,22,170,22,192,22,213,22,234,
+22,255,23,9,23,30,23,44,23,56,23,68,23,77,23,86,23,95,23,115,23,135,23,155,
+23,175,23,194,23,213,23,232,23,251,24,14,24,33,24,37,24,48,24,55,24,73,24,
+80,24,98,24,104,24,111,24,119,24,127,24,135,24,152,24,169,24,186,24,203,24,
+213,24,223,24,233,24,243,25,3,25,19,25,25,25,32,25,48,25,62,25,66,25,77,25,
+92,25,107,25,122,25,137,25,152,25,167,25,182,25,196,25,202,25,216,25,230,
+25,244,26,2,26,16,26,30,26,44,26,58,26,70,26,79,26,88,26,101,26,114,26,127,
+26,140,26,153,26,166,26,179,26,192,26,205,26,212,26,219,26,224,26,236,26,
+248,27,4,27,16,27,28,27,40,27,52,27,62,27,72,27,82,27,90,27,98,27,106,27,
+112,27,118,27,129,27,140,27,151,27,162,27,173,27,184,27,195,27,206,27,217,
+27,226,27,235,27,238,27,252,28,1,28,6,28,16,28,37,28,44,28,51,28,57,28,82,
+28,86,28,104,28,136,28,188,67,29,160,151,177,174,70,29,11,81,29,247,62,247,
+1,214,174,207,178,30,163,181,148,185,216,26,247,153,7,141,244,150,153,220,
+148,8,11,80,29,56,7,143,137,189,159,175,150,190,153,25,11,248,44,247,56,21,
+63,91,96,110,75,27,82,96,168,196,110,31,121,177,132,171,137,201,8,247,200,
+6,131,204,129,168,114,171,8,175,109,93,160,87,27,89,92,121,105,101,31,92,
+98,112,68,57,26,251,30,211,53,247,7,234,214,198,247,0,181,30,211,29,11,248,
+207,231,29,124,7,173,132,149,132,122,26,124,133,115,128,112,30,49,251,114,
+55,247,116,5,122,185,139,139,152,26,161,150,146,186,146,30,154,251,95,124,
+7,176,135,151,127,159,86,144,125,148,114,145,122,48,251,91,24,40,247,153,
+5,135,149,137,149,149,26,160,150,147,174,143,30,154,251,72,124,7,162,137,
+147,129,161,88,247,27,251,234,24,108,151,147,126,145,27,144,147,151,166,151,
+31,247,4,247,132,230,251,128,5,101,154,141,134,146,27,146,144,148,179,155,
+31,247,30,247,238,157,181,142,144,159,146,25,154,7,11,250,56,174,29,251,90,
+120,6,190,134,157,128,112,26,119,133,112,129,111,30,251,17,251,231,251,24,
+247,233,132,157,136,147,137,143,25,130,160,133,158,150,26,163,162,149,193,
+140,30,158,251,159,120,7,196,138,149,130,173,59,172,57,24,32,251,174,251,
+36,248,12,5,132,157,135,156,150,26,161,153,145,190,143,30,158,251,137,120,
+7,190,134,154,121,176,45,247,85,252,173,24,154,6,247,46,248,59,247,52,252,
+59,5,154,6,225,247,154,146,160,247,3,247,192,158,191,150,148,192,149,8,11,
+248,111,231,29,251,27,124,6,171,155,130,123,135,138,133,136,132,31,42,251,
+168,251,7,247,145,5,133,153,135,153,149,26,157,154,146,182,141,30,154,251,
+98,125,7,165,135,156,128,147,122,247,6,251,138,24,151,112,140,138,144,129,
+8,167,89,155,102,124,26,123,116,78,122,108,30,114,124,118,120,125,27,133,
+130,141,144,128,31,146,121,121,143,123,27,115,120,120,114,106,170,114,182,
+207,185,194,247,37,194,31,247,46,248,44,152,171,150,149,163,142,25,11,21,
+251,17,247,59,5,77,6,251,16,251,59,5,173,6,247,13,242,247,14,36,5,14,249,
+0,248,87,21,163,29,56,108,84,77,31,69,77,101,47,251,2,26,251,96,247,25,251,
+28,247,91,247,5,239,185,220,199,30,121,157,5,68,66,72,109,56,27,76,83,159,
+177,96,31,84,188,108,229,247,4,26,247,73,232,247,8,247,37,196,191,118,100,
+179,30,171,107,154,111,158,74,8,11,157,22,247,189,158,6,204,29,251,189,198,
+29,11,172,248,32,21,147,152,145,141,150,27,170,147,122,75,31,251,77,7,46,
+187,85,221,193,190,165,188,181,30,181,188,158,201,222,26,247,7,101,225,89,
+114,119,119,114,120,149,123,161,119,30,166,115,145,131,147,124,8,151,115,
+145,108,106,26,42,81,68,59,111,115,150,158,127,30,128,157,135,163,187,26,
+247,101,7,169,136,151,129,153,30,154,128,130,146,132,27,136,135,138,137,135,
+31,36,85,5,11,248,34,247,48,21,101,29,251,21,218,46,247,3,184,179,155,170,
+175,30,166,162,158,167,169,198,8,11,247,186,174,29,251,174,224,29,252,80,
+222,29,248,174,7,187,247,66,5,114,6,92,34,96,113,251,21,135,8,72,6,62,141,
+131,142,138,175,8,248,109,7,141,212,152,152,217,143,8,11,72,29,115,172,79,
+116,29,11,21,247,4,29,155,26,159,126,151,117,124,130,134,121,121,30,251,39,
+251,40,5,14,21,105,6,251,14,36,251,13,242,5,105,6,247,16,251,59,5,201,6,14,
+163,249,24,21,162,138,5,191,137,155,120,76,26,252,92,7,76,189,29,202,26,248,
+92,214,29,161,140,5,157,251,178,7,14,249,196,248,157,21,247,33,252,200,119,
+7,204,137,164,130,117,26,133,136,128,133,128,30,251,137,252,120,106,78,127,
+128,96,133,25,120,247,91,158,138,7,97,143,113,150,154,26,161,162,197,180,
+217,30,167,192,5,247,68,251,44,6,137,70,132,130,76,130,122,137,24,120,248,
+146,7,183,247,60,5,115,6,81,251,2,112,121,251,4,137,8,63,6,108,113,143,144,
+135,31,134,142,136,156,163,26,247,130,247,37,7,210,137,158,119,147,61,8,160,
+247,126,118,6,132,59,119,124,34,137,8,251,3,247,122,6,162,140,145,146,159,
+27,226,6,247,37,164,125,48,151,31,252,190,251,114,21,247,51,247,211,5,251,
+211,7,11,82,27,98,101,159,169,123,31,117,178,134,170,239,26,247,154,6,247,
+21,127,92,193,38,27,92,112,129,104,94,31,173,100,110,150,89,27,49,70,92,78,
+109,156,121,166,167,154,156,170,143,139,146,138,145,31,138,150,5,145,7,172,
+141,162,156,182,27,163,158,131,125,146,31,146,123,144,108,116,26,137,76,53,
+103,5,32,95,97,98,79,26,74,187,94,207,189,173,155,196,207,30,87,173,176,118,
+197,27,185,181,155,171,174,31,167,163,157,167,167,198,8,251,250,191,21,140,
+102,145,102,150,103,8,140,138,139,138,138,26,121,74,107,103,102,109,178,187,
+199,166,163,247,13,183,30,221,193,21,227,11,67,29,159,151,177,175,70,29,11,
+247,97,184,29,247,210,157,7,78,140,96,165,54,226,251,120,247,128,24,145,146,
+145,146,147,147,73,29,11,247,1,247,15,177,182,173,156,184,138,25,156,251,
+75,122,148,7,157,152,130,126,130,135,130,129,128,31,251,17,251,33,5,113,228,
+6,140,230,144,148,189,142,8,157,156,251,119,122,157,6,189,136,144,130,141,
+48,8,50,112,7,251,17,247,33,5,130,150,135,147,149,26,153,150,147,158,30,148,
+156,251,75,122,6,184,140,173,122,177,96,247,2,251,15,24,251,25,251,58,5,90,
+100,110,120,105,27,131,122,247,91,156,121,6,128,132,144,147,146,142,146,146,
+148,31,247,16,247,49,5,14,248,88,158,21,57,143,126,151,138,213,8,248,147,
+128,29,252,136,6,138,53,130,129,55,134,8,120,247,184,7,11,21,178,62,7,118,
+125,142,146,119,31,117,147,5,149,113,111,144,113,27,46,65,68,47,76,165,101,
+206,106,31,113,115,118,119,127,128,136,135,25,118,117,133,128,122,26,117,
+150,128,181,119,30,67,87,113,106,102,26,86,216,95,235,214,217,165,181,191,
+30,177,170,156,171,177,26,201,92,180,65,143,30,251,21,145,5,85,141,115,148,
+155,26,159,172,174,166,147,30,136,175,158,137,141,27,176,179,154,166,170,
+31,172,167,154,174,189,26,168,134,162,125,171,30,11,249,38,249,114,21,90,
+6,67,32,5,175,75,94,152,73,27,251,85,251,27,251,35,251,95,75,154,75,165,89,
+31,157,104,155,119,181,101,44,251,31,24,188,6,218,247,8,5,102,201,185,126,
+207,27,247,86,247,26,247,33,247,97,203,124,204,112,189,31,121,174,122,159,
+98,177,8,96,75,21,173,74,152,83,49,26,251,82,58,251,9,251,24,81,98,158,186,
+96,30,114,174,21,105,203,127,194,227,26,247,83,221,247,11,247,23,195,180,
+120,93,183,30,11,133,29,247,91,22,247,48,29,194,29,195,194,218,29,110,110,
+101,104,110,168,176,175,169,168,175,31,14,155,249,23,21,218,132,147,131,140,
+64,8,251,86,56,95,222,251,98,7,138,66,127,127,64,134,8,120,247,176,7,247,
+8,244,172,195,201,31,204,198,176,228,236,26,229,110,217,83,194,30,208,71,
+251,1,175,251,29,27,251,162,6,247,228,251,195,21,251,38,247,119,6,170,149,
+147,178,229,146,29,247,129,247,38,7,14,21,37,6,100,251,23,124,187,134,153,
+130,157,25,185,114,101,163,90,27,251,7,46,251,13,251,41,251,20,211,49,242,
+214,196,174,211,181,31,145,101,147,119,154,116,8,122,150,150,130,146,27,142,
+144,141,142,146,31,230,180,5,175,7,132,122,131,137,129,27,99,110,176,214,
+122,31,52,157,21,251,8,102,102,83,98,27,88,104,219,247,9,247,31,180,223,206,
+168,162,124,105,159,31,153,116,147,114,160,61,8,14,248,123,21,168,6,149,183,
+5,154,194,140,146,160,26,175,125,158,113,112,125,120,103,118,140,133,153,
+83,30,11,197,21,247,19,29,248,203,7,134,141,92,123,105,128,73,122,25,123,
+7,140,147,144,139,148,27,176,148,129,98,31,251,48,7,171,101,112,150,99,27,
+251,7,46,251,5,251,34,251,20,213,52,247,3,195,177,159,186,173,31,75,7,143,
+136,247,39,191,5,251,43,199,21,132,132,127,129,128,30,119,122,113,129,110,
+27,55,85,219,247,16,247,4,188,213,215,193,187,92,86,31,11,21,251,39,247,40,
+5,157,120,131,144,123,27,119,230,29,248,123,154,21,85,148,134,146,138,210,
+8,247,91,7,244,98,193,57,80,97,115,79,93,30,247,196,7,134,142,104,127,114,
+131,84,123,25,112,131,5,123,7,140,143,141,139,145,27,182,147,131,96,31,252,
+107,108,29,7,11,247,207,247,174,21,251,71,7,76,124,120,85,159,29,189,225,
+173,196,29,125,134,126,142,29,189,132,162,119,181,66,25,11,144,155,251,53,
+123,147,6,160,154,131,127,138,31,131,134,127,131,127,30,82,57,99,203,5,126,
+158,129,163,149,26,149,152,146,156,30,146,155,251,92,123,147,6,184,135,140,
+138,219,251,21,184,66,24,71,33,84,52,127,127,101,134,25,120,138,5,123,247,
+58,156,128,7,119,128,145,151,147,141,144,159,171,31,206,247,1,207,251,2,5,
+151,121,145,124,130,26,126,128,132,117,30,131,122,11,248,78,205,21,125,122,
+127,134,124,27,116,132,153,183,31,247,87,7,191,134,168,124,163,30,175,117,
+96,158,80,27,45,65,90,76,116,158,119,163,163,160,159,161,143,138,144,138,
+146,31,137,148,138,147,146,26,166,171,161,179,188,166,110,85,30,78,7,251,
+45,78,121,130,96,101,8,117,119,125,105,106,26,76,183,95,200,183,180,160,191,
+200,30,86,144,157,119,180,27,173,11,155,22,247,176,6,247,8,244,172,195,201,
+31,204,198,176,228,236,26,229,110,217,83,194,30,208,71,251,1,175,251,29,27,
+251,162,120,6,218,132,147,131,140,64,8,252,80,7,138,66,127,127,64,134,8,247,
+82,248,203,21,170,149,147,181,226,146,29,11,111,6,91,33,94,114,251,35,138,
+8,112,6,35,142,138,140,178,26,247,139,247,46,7,223,137,152,127,152,57,8,162,
+247,124,116,6,127,58,125,127,55,137,8,251,46,247,114,6,169,140,143,143,167,
+27,247,27,6,247,8,137,159,125,155,50,8,164,6,136,247,35,5,252,167,224,29,
+252,80,222,29,11,31,140,29,11,247,106,247,73,21,248,14,126,29,145,7,247,187,
+248,14,5,252,20,7,69,138,123,124,65,247,53,29,213,155,125,69,140,31,11,247,
+207,247,206,21,135,247,29,5,128,6,131,134,134,136,133,27,133,129,141,144,
+128,31,147,116,116,144,115,27,60,82,87,67,83,171,99,224,91,31,197,106,5,174,
+119,156,115,108,26,95,107,111,88,70,104,177,241,116,30,123,251,48,152,6,149,
+146,143,141,151,27,150,151,137,133,162,31,133,166,165,135,159,27,217,202,
+197,209,189,11,154,154,154,155,154,155,149,148,199,205,169,171,209,219,163,
+154,206,143,8,158,251,135,120,7,186,138,150,134,119,26,103,42,251,5,251,29,
+251,14,30,247,105,7,204,155,157,196,140,30,141,148,139,140,147,31,157,251,
+180,121,7,147,29,247,180,157,7,63,123,153,210,31,11,118,6,117,135,128,127,
+122,27,129,122,143,147,122,31,153,102,102,147,106,27,97,95,122,110,106,31,
+104,108,121,97,87,26,59,183,83,247,4,80,30,211,100,191,99,164,101,8,148,126,
+144,118,114,26,73,89,93,66,49,77,194,247,14,89,30,116,6,169,251,104,5,161,
+6,158,140,151,153,154,27,150,156,135,132,158,31,11,247,100,7,227,247,29,29,
+251,112,122,150,6,190,136,144,130,140,47,8,251,0,7,130,106,109,134,112,27,
+79,113,168,205,31,166,7,227,146,154,189,140,30,148,156,251,111,122,156,6,
+190,136,144,130,140,47,8,112,7,97,142,121,150,121,30,109,158,178,123,196,
+27,178,174,144,152,191,31,11,167,29,116,153,162,146,146,163,149,164,31,181,
+244,5,247,134,6,177,42,5,152,106,143,123,124,26,115,247,14,29,113,168,227,
+103,31,252,1,247,15,21,239,247,130,246,251,130,5,11,21,164,29,14,174,29,251,
+178,121,6,213,155,124,69,140,31,252,92,7,68,138,124,125,64,27,121,247,179,
+7,247,54,228,206,247,16,247,16,44,209,251,58,108,119,138,134,109,31,247,72,
+7,209,155,154,213,30,49,251,197,21,144,166,158,141,159,27,234,203,75,44,50,
+76,78,49,118,123,142,148,104,31,11,247,251,249,49,201,29,211,169,201,199,
+102,29,248,115,189,21,134,6,90,141,132,147,138,186,8,247,235,251,50,122,7,
+201,136,151,129,89,26,251,127,7,111,134,125,125,128,30,117,112,108,127,109,
+27,100,107,173,181,31,247,218,251,38,125,7,186,137,153,125,140,91,8,251,144,
+7,60,187,88,212,176,178,155,166,166,30,182,182,5,11,249,85,174,29,251,124,
+120,6,216,134,154,119,141,36,8,251,162,7,71,133,101,122,109,30,91,112,75,
+108,64,27,68,90,163,186,112,31,121,171,132,176,202,26,247,212,7,140,212,149,
+149,219,146,8,158,251,175,120,7,218,133,149,129,140,65,8,251,204,7,251,65,
+220,57,11,21,164,6,150,177,5,147,164,142,154,154,26,170,127,155,116,118,125,
+121,113,126,144,115,145,118,30,88,90,21,114,119,120,114,115,159,119,163,163,
+159,159,163,163,119,159,116,31,247,44,22,114,119,120,114,115,159,119,163,
+163,159,159,163,163,119,159,116,31,14,247,77,21,66,103,91,101,82,27,59,83,
+219,247,9,136,31,247,172,6,247,7,136,76,210,41,27,251,1,58,39,251,24,251,
+24,218,39,244,193,190,166,187,173,31,157,163,152,168,157,195,8,251,189,247,
+25,21,205,147,173,177,189,27,190,169,101,73,142,31,11,249,86,158,21,94,142,
+129,149,104,213,251,141,248,204,24,119,6,251,100,252,127,75,251,38,127,123,
+91,137,25,120,247,90,158,7,91,119,151,168,151,142,153,144,152,31,185,247,
+9,5,247,154,6,180,43,5,151,112,146,113,125,26,114,122,131,86,138,30,120,11,
+21,215,29,167,168,162,162,168,167,116,162,111,31,11,247,65,248,103,21,72,
+106,129,134,69,111,145,124,24,145,141,5,141,147,146,140,146,27,166,247,36,
+29,155,121,30,130,147,146,133,143,27,142,144,141,142,144,31,242,193,133,153,
+5,131,126,133,137,128,27,108,131,156,203,31,11,247,147,231,29,38,247,8,6,
+149,137,142,134,30,81,55,109,105,110,122,8,128,132,133,133,133,26,136,140,
+137,142,137,30,192,251,193,6,55,169,96,198,188,177,163,191,172,30,126,150,
+5,192,29,247,178,240,7,11,30,108,173,178,125,194,27,160,155,140,143,179,31,
+140,150,150,140,146,27,163,153,125,117,108,113,114,107,132,134,140,143,127,
+31,144,124,130,141,130,27,117,123,123,118,113,162,122,171,211,204,212,218,
+191,111,169,89,132,124,138,137,123,31,137,11,7,209,155,154,213,30,157,251,
+178,121,7,214,154,124,69,140,31,251,91,251,187,121,29,14,21,101,122,126,127,
+116,27,125,119,145,148,120,31,115,151,5,151,116,114,247,20,29,171,150,156,
+153,162,27,150,154,135,132,154,31,162,128,5,119,180,154,135,164,27,194,168,
+168,216,160,31,14,113,29,223,185,190,245,151,31,14,178,29,92,142,124,147,
+159,149,29,11,111,29,251,78,7,69,138,124,124,64,27,121,11,232,29,90,140,131,
+154,227,26,11,8,124,247,107,154,7,85,143,129,148,192,26,248,236,7,134,141,
+130,137,129,136,127,133,25,130,120,124,134,131,27,134,129,142,144,124,31,
+150,111,110,145,114,27,93,93,115,100,111,31,109,96,129,100,135,51,8,11,127,
+116,27,125,119,145,148,121,31,115,151,5,151,115,115,247,20,29,170,150,155,
+154,163,27,150,154,135,132,154,31,162,128,5,119,180,153,135,164,27,195,168,
+169,215,160,31,14,125,148,24,101,29,11,21,162,138,5,192,137,154,120,76,26,
+252,92,171,29,248,92,241,29,7,11,248,47,21,222,6,207,171,110,68,150,31,156,
+6,123,247,31,5,251,240,122,156,6,145,29,11,198,158,169,246,29,163,157,157,
+162,175,95,165,79,236,29,107,221,191,29,11,69,91,103,115,82,27,47,76,219,
+247,7,243,194,209,220,175,152,129,101,149,31,145,117,5,110,147,157,122,161,
+27,165,160,158,162,195,69,186,55,90,88,119,103,98,31,89,95,111,71,59,26,11,
+31,200,203,172,225,236,26,247,85,251,28,247,36,251,75,30,138,100,21,247,12,
+222,251,13,251,69,251,73,59,251,11,251,15,251,9,59,247,14,247,69,247,71,218,
+247,12,247,10,31,14,21,180,247,239,5,142,163,142,173,153,26,192,120,167,104,
+104,120,111,86,126,142,96,141,123,30,180,251,239,5,147,67,21,107,113,113,
+107,107,165,113,171,170,165,165,171,171,113,165,108,31,11,247,199,247,102,
+21,50,7,137,47,134,130,89,136,8,121,122,247,119,156,121,6,89,142,134,148,
+138,231,8,228,166,7,247,16,251,49,5,147,130,142,132,132,26,131,132,134,127,
+30,121,122,11,248,253,21,247,68,6,224,140,172,108,143,52,158,140,24,129,247,
+53,5,252,139,121,6,147,29,247,198,157,7,49,120,153,209,138,31,11,249,98,247,
+39,21,84,247,150,92,6,251,95,251,158,5,90,247,72,49,209,229,194,7,251,17,
+196,21,251,27,6,247,27,247,71,5,183,247,242,207,29,11,21,85,247,203,193,7,
+14,7,137,67,134,131,82,132,8,124,247,108,154,7,81,144,131,150,137,210,8,247,
+133,7,185,181,169,156,179,27,188,164,103,69,31,251,90,7,137,68,130,128,82,
+134,8,124,247,104,11,120,156,121,147,100,147,166,148,151,145,151,148,8,164,
+159,155,170,172,26,203,84,176,46,111,126,137,131,107,30,133,119,129,137,131,
+27,126,132,145,150,138,31,125,6,131,251,35,5,11,247,200,112,29,11,122,64,
+109,135,104,27,46,104,176,238,31,247,8,7,209,155,154,213,30,157,251,178,121,
+7,213,155,124,69,140,31,251,8,7,251,14,199,81,247,21,184,154,141,163,247,
+16,30,11,21,95,141,127,147,138,165,8,247,235,7,125,142,251,10,84,5,116,7,
+148,164,153,143,143,27,145,141,133,117,31,251,149,7,138,116,129,132,97,137,
+8,115,247,83,7,11,129,29,178,120,187,27,11,248,69,21,206,172,184,200,199,
+130,29,11,110,177,82,162,31,182,170,156,162,167,26,186,92,175,78,77,100,112,
+71,104,30,164,121,5,183,170,159,152,175,27,174,160,120,109,102,113,117,69,
+116,31,14,175,31,251,0,203,5,111,156,124,163,166,26,180,170,166,185,196,169,
+106,49,162,30,11,247,109,247,208,21,126,176,167,134,174,27,200,198,158,172,
+180,31,174,167,159,185,192,26,216,103,192,64,173,30,98,157,119,141,251,18,
+140,8,251,106,121,6,11,133,29,247,91,22,247,32,29,159,117,167,247,26,29,200,
+199,26,189,104,178,172,29,131,107,111,102,85,102,31,14,200,199,26,190,104,
+177,172,29,131,107,111,102,85,102,31,14,247,91,7,219,29,252,91,208,29,11,
+7,140,212,149,149,216,146,8,158,251,170,120,7,216,133,149,129,140,65,8,11,
+21,206,172,184,200,199,26,189,104,178,94,104,247,16,29,176,146,145,140,140,
+145,30,141,145,140,139,140,27,147,145,133,131,107,111,11,31,251,94,247,87,
+247,57,247,34,170,166,166,151,180,141,25,156,251,83,122,151,7,160,149,132,
+122,132,135,132,127,129,31,251,63,251,45,5,11,21,112,116,116,111,110,161,
+117,167,169,161,161,168,168,116,161,110,31,14,7,209,155,154,213,30,157,251,
+178,121,7,147,29,247,178,157,7,65,123,154,209,31,11,248,146,228,7,224,140,
+172,108,143,55,158,141,24,129,247,52,5,252,181,173,29,228,252,146,6,11,193,
+7,247,8,137,160,122,161,251,1,8,163,6,133,247,62,5,252,200,6,133,251,62,5,
+163,6,162,247,1,160,156,247,7,141,8,193,11,81,27,75,105,169,206,125,31,110,
+6,140,88,146,115,158,111,8,104,164,11,26,189,104,178,94,104,247,16,29,177,
+146,145,140,140,145,30,141,144,139,139,141,27,147,145,133,131,106,111,103,
+85,102,31,11,21,206,172,184,200,199,26,189,104,178,172,29,11,21,251,94,251,
+54,251,53,251,93,251,88,247,54,251,55,247,89,247,89,247,56,247,55,247,88,
+247,88,251,55,247,58,251,85,31,11,21,247,32,29,159,117,167,166,195,29,11,
+137,73,129,127,84,138,8,124,247,112,154,7,83,143,126,153,194,26,247,221,225,
+7,236,142,137,85,140,31,251,156,7,138,70,11,247,30,29,247,98,247,195,251,
+87,193,29,120,247,170,158,7,247,30,29,11,249,83,174,29,251,111,120,6,191,
+138,156,131,115,26,129,135,127,129,124,30,251,35,251,118,251,40,247,114,5,
+128,155,133,11,251,13,251,51,36,247,46,5,129,154,133,154,151,26,155,148,153,
+152,143,30,147,141,141,140,168,140,8,157,251,188,121,7,11,247,41,29,163,169,
+170,113,165,109,31,11,27,177,154,129,113,112,118,122,11,251,47,222,21,109,
+134,128,118,127,30,125,114,112,131,118,27,104,111,173,182,31,143,7,140,199,
+183,177,247,9,180,8,11,84,203,251,24,211,31,34,196,97,183,194,26,194,181,
+176,201,184,181,120,103,174,30,170,107,153,113,155,80,8,164,6,11,122,111,
+30,251,21,251,110,251,22,247,97,5,120,169,131,158,155,26,161,157,149,176,
+30,153,157,251,193,121,6,162,137,11,188,29,247,26,29,174,163,162,173,171,
+117,158,102,132,132,138,138,133,30,137,134,138,139,138,27,131,133,145,147,
+172,166,174,194,177,31,11,190,136,144,131,140,47,8,251,102,7,138,48,134,130,
+237,29,226,26,11,203,123,105,187,30,217,85,180,53,251,0,26,251,10,98,55,58,
+92,30,110,88,81,127,52,27,99,127,148,171,31,11,213,155,124,69,140,31,252,
+92,7,69,138,123,124,65,27,121,11,137,62,132,129,79,136,8,124,247,116,154,
+7,83,144,125,151,138,186,8,247,231,247,80,251,226,7,138,89,124,11,26,151,
+144,149,157,163,30,247,34,247,78,247,10,251,65,5,156,114,146,122,124,26,115,
+124,131,93,138,30,121,11,249,24,21,161,138,5,189,161,113,81,141,31,252,51,
+7,55,132,113,117,128,129,148,154,132,30,183,117,126,150,11,215,21,251,39,
+247,40,5,157,121,130,144,124,27,118,126,127,120,123,150,123,157,128,31,247,
+46,42,5,14,251,54,251,53,251,92,251,88,247,54,251,54,247,87,247,89,247,55,
+247,55,247,87,247,88,251,54,247,57,11,31,112,158,152,129,156,27,160,154,155,
+162,182,89,166,62,63,81,113,90,103,31,109,98,128,102,133,59,8,11,21,251,39,
+247,40,5,157,121,130,144,123,27,119,230,29,105,169,206,126,31,110,6,140,88,
+145,115,159,111,8,104,163,179,120,187,27,222,185,190,245,152,31,14,142,157,
+141,152,141,148,8,155,215,148,199,168,26,161,120,157,116,115,120,121,116,
+122,153,49,157,42,30,11,31,162,121,125,148,123,27,116,121,122,117,107,178,
+116,194,183,179,153,164,166,31,175,171,161,207,218,26,11,247,46,236,5,159,
+152,148,152,155,26,159,126,151,118,247,3,29,137,30,114,138,5,121,247,190,
+157,7,112,140,5,85,141,124,158,202,26,247,71,7,247,36,247,134,11,21,132,173,
+217,133,190,27,229,172,126,103,81,63,100,251,5,50,82,168,183,162,148,154,
+179,187,31,11,82,157,141,24,133,247,115,5,118,6,111,135,130,127,122,27,129,
+138,139,158,99,31,157,100,89,149,11,147,154,247,12,29,11,130,247,117,5,118,
+6,118,133,123,127,119,27,130,124,142,144,124,31,156,90,89,147,92,27,57,11,
+247,4,29,155,26,159,126,151,118,123,130,134,121,121,30,251,39,251,40,5,11,
+248,83,21,171,203,5,167,195,152,177,165,26,163,122,156,115,104,122,98,35,
+133,30,134,59,5,11,119,122,105,117,123,142,148,111,210,29,11,248,7,249,49,
+21,127,6,251,128,252,181,99,45,128,129,73,137,25,121,247,113,158,127,7,103,
+11,7,247,102,220,116,192,251,178,251,19,5,62,7,247,178,251,20,162,191,251,
+102,221,5,14,248,71,207,29,14,241,29,121,7,162,138,5,192,137,154,120,76,26,
+11,7,76,221,29,247,179,157,7,116,140,5,86,141,124,158,202,26,11,94,104,247,
+16,29,176,146,146,140,140,145,30,141,144,140,139,140,27,147,145,133,11,6,
+129,251,52,158,137,143,223,172,170,224,138,25,11,249,42,21,11,7,209,140,155,
+154,213,27,157,252,26,7,129,251,53,158,138,143,226,172,170,224,138,25,11,
+188,26,202,86,182,61,98,105,127,116,116,30,118,120,129,120,123,93,164,125,
+24,187,161,11,75,221,29,247,179,157,7,116,140,5,87,141,123,158,203,26,11,
+247,211,247,216,21,251,28,251,73,57,251,2,119,125,59,138,25,121,247,136,157,
+7,11,206,29,191,183,107,164,11,21,169,195,175,185,213,188,63,251,9,251,2,
+90,64,67,92,82,175,169,30,14,146,134,5,142,147,147,140,11,136,98,27,251,49,
+182,6,138,176,143,178,144,155,8,182,152,179,169,184,27,167,11,162,30,169,
+199,21,93,170,119,164,168,26,168,162,160,172,176,161,117,102,108,125,11,247,
+213,21,247,73,251,79,5,190,87,157,115,123,26,123,124,133,96,137,30,121,11,
+6,79,87,5,82,7,247,154,247,114,251,154,247,114,5,82,7,199,87,5,11,7,138,51,
+130,130,48,135,8,120,247,198,158,7,50,141,126,150,138,216,8,11,21,100,113,
+122,127,108,27,118,118,144,148,122,31,186,50,121,146,94,27,93,11,166,195,
+29,247,91,22,247,5,29,11,123,120,87,137,30,116,138,5,121,247,178,157,7,117,
+140,5,86,141,124,158,11,22,215,29,167,168,162,162,168,167,116,162,111,31,
+14,251,206,6,137,64,129,128,68,136,8,124,11,113,117,123,130,117,27,102,124,
+166,202,31,11,7,138,54,130,128,61,134,8,11,21,85,94,94,85,83,182,95,11,162,
+161,167,166,116,162,112,31,11,169,192,142,25,150,140,5,157,251,115,121,160,
+7,166,138,153,129,121,26,11,199,191,5,196,7,251,154,251,114,247,154,251,114,
+5,196,7,79,191,5,11,120,7,224,134,150,129,140,64,8,252,80,7,138,63,127,128,
+55,136,8,11,123,26,123,124,133,97,137,30,121,247,209,157,7,79,140,95,165,
+54,226,11,248,147,4,147,161,153,141,161,27,224,195,81,53,54,86,84,59,116,
+11,21,251,72,251,27,251,37,251,85,251,85,247,27,251,37,247,72,232,11,22,102,
+109,110,103,102,168,110,175,176,168,168,176,174,110,169,104,31,11,170,106,
+181,180,173,162,192,176,30,119,155,5,112,108,120,130,118,27,11,57,141,125,
+153,137,213,8,248,80,7,141,214,152,151,222,142,8,158,11,116,247,19,251,178,
+5,216,6,247,20,247,178,86,162,58,251,102,5,11,118,213,29,11,21,93,6,252,89,
+253,70,5,188,6,11,7,68,242,29,210,31,11,21,122,146,125,117,130,135,111,138,
+25,251,13,6,225,224,5,200,11,244,29,191,183,107,164,11,251,217,247,44,21,
+217,150,173,176,200,27,200,163,111,52,152,31,11,92,224,62,234,29,11,122,142,
+148,112,244,29,11,7,202,154,158,192,141,30,11,110,116,116,111,110,162,116,
+11,25,149,140,5,247,11,29,11,170,166,166,151,180,141,25,156,251,82,122,151,
+7,160,149,132,11,184,183,194,194,94,184,84,31,140,105,21,174,169,109,103,
+103,11,210,155,153,213,30,157,251,178,121,7,213,155,124,69,140,31,11,215,
+151,178,179,203,27,195,174,106,88,91,103,106,88,31,107,11,124,120,86,137,
+30,116,138,5,121,11,7,137,67,126,125,67,135,8,120,11,156,123,6,90,140,131,
+154,227,26,11,120,6,212,134,151,126,141,67,8,11,130,88,136,8,122,122,247,
+118,156,123,6,90,141,131,153,11,25,123,145,7,140,150,151,140,147,27,171,149,
+125,92,31,11,27,221,247,0,29,11,247,12,29,143,131,141,11,248,99,21,71,105,
+128,135,65,109,146,125,24,150,142,5,11,126,127,120,123,149,124,158,127,31,
+247,46,42,5,14,248,86,21,11,247,28,29,122,122,247,118,156,123,6,11,150,26,
+160,151,150,165,138,30,147,156,251,87,122,6,11,172,30,153,105,112,143,70,
+27,251,172,77,247,183,6,11,190,140,145,158,26,172,126,156,115,115,126,122,
+106,120,11,76,87,112,94,113,31,113,94,131,103,138,59,8,57,11,88,136,8,122,
+122,247,118,156,123,6,90,140,131,154,11,110,110,102,103,169,110,176,174,168,
+169,174,176,110,168,11,252,126,247,149,21,247,7,247,167,247,8,251,167,5,11,
+5,178,165,156,151,170,27,160,160,134,130,156,31,11,247,17,29,251,179,11,138,
+123,124,65,27,121,247,178,157,7,65,123,154,11,27,123,120,247,184,158,122,
+6,85,119,159,194,31,11,31,125,108,5,127,168,162,135,171,27,216,187,171,11,
+248,46,22,155,6,247,128,248,167,5,252,64,7,11,177,161,152,129,110,157,30,
+113,155,151,129,156,27,11,187,101,73,82,95,103,68,123,127,141,144,113,31,
+11,86,198,100,219,217,196,178,192,162,124,154,118,30,11,247,253,249,56,21,
+251,83,251,28,251,35,251,94,11,123,131,134,121,121,30,251,39,251,40,5,14,
+247,46,236,5,160,152,148,152,11,113,117,116,112,111,160,117,166,11,7,247,
+40,247,118,200,227,165,161,190,143,25,11,251,44,251,41,251,81,251,78,247,
+41,251,44,11,21,166,6,148,179,5,152,189,140,145,159,26,11,21,77,247,172,7,
+222,174,146,164,177,31,204,11,26,190,92,176,74,68,87,98,83,100,152,120,11,
+156,251,35,122,144,7,164,140,152,129,120,26,11,188,140,30,155,156,251,118,
+122,156,6,190,136,11,247,17,247,16,21,248,103,248,103,252,103,6,11,120,126,
+103,30,123,120,247,170,157,126,6,94,11,21,247,45,236,5,161,11,115,116,105,
+107,161,120,11,7,247,40,29,11,7,247,178,251,19,162,191,251,102,221,5,11,138,
+126,133,139,135,27,104,130,150,185,31,11,145,117,27,89,103,103,74,124,31,
+168,6,11,31,76,197,228,100,227,27,247,89,247,28,11,184,187,161,151,172,27,
+188,163,108,73,31,11,218,105,30,125,173,166,135,208,27,247,172,11,121,247,
+179,157,7,64,124,154,209,138,31,11,7,247,10,184,100,251,15,161,31,14,167,
+161,161,167,166,116,162,112,31,14,247,111,205,251,111,247,112,73,6,14,138,
+47,134,130,88,136,8,11,147,154,188,140,30,155,156,11,64,145,127,151,138,211,
+8,11,21,63,110,115,118,11,113,117,116,113,110,11,6,56,104,132,114,102,31,
+74,96,105,11,134,8,124,247,112,154,7,83,143,129,11,134,65,109,146,124,24,
+150,143,5,141,11,146,125,84,31,251,144,7,104,142,127,11,27,181,163,132,122,
+157,31,158,121,150,11,155,114,111,120,120,112,85,202,98,223,11,248,170,247,
+112,21,205,252,140,73,7,11,202,154,158,192,141,30,162,140,5,157,11,109,114,
+114,107,110,164,114,168,170,165,11,31,41,32,5,116,247,145,7,14,162,162,168,
+166,116,163,111,31,14,195,29,14,134,130,88,136,8,122,122,247,118,156,123,
+6,90,11,7,226,162,29,11,7,232,29,90,11,247,32,29,159,117,167,166,247,44,29,
+153,148,151,155,26,159,126,151,117,124,130,134,121,121,30,251,39,251,40,5,
+14,174,29,121,7,147,29,11,7,94,29,247,101,7,11,247,31,29,129,29,11,27,121,
+247,178,157,7,65,123,154,209,31,248,92,7,209,155,154,213,30,157,251,178,121,
+7,11,118,113,29,11,252,62,247,84,21,247,5,29,166,195,29,247,91,22,113,117,
+116,11,247,8,7,149,137,142,134,30,81,55,109,105,110,122,8,128,132,133,133,
+133,26,136,140,137,142,137,30,192,251,193,6,11,247,110,247,221,21,247,58,
+6,197,138,159,113,137,69,8,157,247,133,121,6,140,66,118,112,83,140,8,251,
+58,247,141,247,45,6,242,141,171,114,150,50,156,140,24,129,247,42,5,252,138,
+121,6,11,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,1,135,255,2,135,254,2,243,2,
+0,1,0,4,0,7,0,63,0,74,0,171,1,56,1,243,2,152,2,158,2,222,3,29,3,238,4,1,4,
+8,4,13,4,21,4,38,4,121,4,168,4,242,5,102,5,141,5,249,6,90,6,126,6,224,7,64,
+7,78,7,123,7,153,7,175,7,203,8,46,8,221,8,224,9,98,9,103,9,106,9,110,9,139,
+9,142,9,145,9,150,9,157,9,160,9,164,9,245,9,248,9,251,10,0,10,129,10,134,
+10,138,10,142,10,145,10,214,10,219,11,104,11,107,11,111,11,146,11,165,11,
+199,11,228,11,240,11,253,12,1,12,76,12,80,12,86,12,90,12,110,12,114,12,118,
+12,128,12,137,12,141,12,146,13,44,13,48,13,52,13,100,13,197,13,202,13,207,
+13,212,13,216,14,53,14,56,14,190,14,194,14,198,15,17,15,29,15,105,15,163,
+15,226,16,91,17,17,17,26,17,145,18,40,18,212,19,58,19,64,19,92,19,112,19,
+118,19,126,19,175,19,202,19,212,20,23,20,179,20,188,21,14,21,39,21,46,21,
+69,21,82,21,137,21,170,22,104,22,204,22,212,22,219,22,227,22,235,22,242,22,
+250,23,3,23,10,23,18,23,31,23,43,23,84,23,92,23,97,23,102,23,218,24,15,24,
+18,24,186,24,239,25,8,25,13,25,23,25,32,25,172,26,35,26,44,26,59,26,157,27,
+27,27,29,27,67,27,94,27,164,27,172,27,188,27,208,27,251,28,34,28,54,28,83,
+29,13,29,18,29,133,29,177,29,195,30,79,30,87,30,94,30,111,30,118,30,125,30,
+132,30,188,30,197,30,205,30,218,30,230,30,240,30,250,31,3,31,13,31,27,31,
+33,31,40,31,47,31,53,31,61,31,69,31,76,31,83,31,89,31,96,31,103,31,111,31,
+120,31,128,31,136,31,145,31,153,31,161,31,173,31,204,31,217,31,225,31,234,
+31,242,31,251,32,5,32,29,32,39,32,48,32,55,32,63,32,71,32,78,32,87,32,95,
+32,104,32,112,32,121,32,130,32,142,32,151,32,159,33,11,33,97,33,174,33,218,
+34,24,34,145,35,60,35,153,35,220,36,2,36,115,36,184,36,213,37,51,37,130,37,
+213,37,220,38,7,38,17,38,26,38,36,38,44,38,46,38,54,38,63,38,89,38,97,38,
+105,38,115,38,122,38,132,38,139,38,156,38,171,38,180,38,190,38,206,39,0,39,
+8,39,17,39,48,39,57,39,66,39,74,39,87,39,96,39,105,39,113,39,120,39,163,39,
+172,39,180,39,188,39,197,39,228,39,238,39,245,40,1,40,14,40,22,40,36,40,44,
+40,52,40,60,40,98,40,110,40,123,40,225,41,15,41,23,41,62,41,84,41,92,41,102,
+41,134,41,170,41,178,41,187,41,234,41,243,42,11,42,20,42,34,42,43,42,52,42,
+70,42,80,42,90,42,98,42,108,42,135,42,144,42,164,42,173,42,183,42,242,42,
+252,43,3,43,17,43,26,43,33,43,41,43,50,43,59,43,69,43,83,43,92,43,109,43,
+118,43,127,43,136,43,145,43,154,43,163,43,211,43,221,44,4,44,53,44,203,45,
+22,45,33,45,177,45,186,45,195,45,200,45,205,46,60,46,108,46,117,46,124,46,
+136,46,144,46,157,46,191,46,203,46,212,46,226,46,237,46,245,46,255,47,13,
+47,30,47,71,47,124,47,144,47,183,47,198,47,207,48,24,48,67,48,102,48,133,
+49,7,49,141,49,200,49,231,50,13,50,21,50,30,50,37,50,44,50,50,50,58,50,60,
+50,63,50,176,50,253,51,69,51,113,51,221,52,46,52,163,52,235,53,54,53,186,
+53,223,54,32,54,123,54,136,54,140,54,155,54,170,54,181,54,191,54,231,55,7,
+55,23,55,36,55,58,55,99,55,113,55,144,55,163,55,216,56,14,56,55,56,216,56,
+241,57,204,58,195,58,227,58,254,59,37,59,77,59,133,59,166,59,193,60,47,60,
+99,60,151,60,207,60,246,61,27,61,45,61,114,61,183,61,226,61,247,62,111,62,
+219,63,40,63,83,63,135,63,195,64,69,64,183,65,27,65,186,66,10,66,34,66,64,
+66,96,66,142,66,190,67,31,67,53,67,75,67,105,67,124,67,135,67,242,67,255,
+68,4,68,20,68,34,68,40,68,71,68,110,68,233,69,26,69,78,69,167,69,181,69,195,
+70,69,70,72,70,95,70,156,70,196,70,224,71,20,71,43,71,160,71,164,72,1,72,
+54,72,123,72,173,73,32,73,34,73,71,73,97,73,159,73,188,73,191,74,32,74,103,
+74,248,75,135,75,142,75,254,76,118,76,219,76,223,77,54,77,60,77,147,77,152,
+78,14,78,110,78,228,79,61,79,187,79,191,80,64,80,139,80,211,81,34,81,38,81,
+166,82,6,82,130,82,241,83,109,84,2,84,115,84,247,85,11,85,30,85,56,85,64,
+85,97,85,166,85,201,85,211,85,226,86,88,86,125,86,141,86,153,86,177,86,204,
+86,223,87,0,87,23,87,147,87,168,87,177,87,223,87,251,88,36,88,60,88,66,88,
+170,88,205,88,232,89,11,89,14,89,19,89,101,89,147,89,162,89,164,89,192,89,
+205,90,5,90,26,90,31,90,135,90,154,90,177,90,195,90,221,91,5,91,11,91,34,
+91,93,91,208,92,19,92,125,92,157,93,11,93,102,93,230,93,234,93,238,93,242,
+94,19,94,137,95,23,95,124,95,160,95,248,96,31,96,38,96,141,96,184,97,74,97,
+107,97,163,97,221,98,16,98,40,98,78,98,98,98,147,98,154,98,175,99,39,99,81,
+99,112,99,145,99,235,100,28,100,40,100,47,100,181,101,90,101,178,101,235,
+102,74,102,124,102,164,103,26,103,147,104,7,104,13,104,108,104,114,104,135,
+104,188,104,192,104,196,105,7,105,102,105,133,105,181,105,216,106,77,106,
+144,106,188,106,192,107,106,107,136,107,193,107,227,108,35,108,64,108,69,
+108,156,108,216,109,64,109,87,109,201,110,32,110,147,110,189,110,244,111,
+97,111,174,112,15,112,91,112,162,112,180,112,200,112,229,113,37,113,107,113,
+201,114,10,114,84,114,99,114,158,114,170,114,200,114,210,115,10,115,18,115,
+40,115,112,115,155,115,201,115,237,116,85,116,143,116,153,116,161,117,26,
+117,143,117,237,118,57,118,159,118,198,118,245,119,157,120,13,120,197,121,
+18,121,172,122,136,122,245,123,172,124,138,124,241,125,58,125,155,125,191,
+125,224,126,4,126,39,126,79,126,116,126,224,127,24,127,64,127,78,127,104,
+127,132,127,161,128,33,128,84,128,143,128,215,129,10,129,59,129,162,129,219,
+130,26,130,92,130,110,130,130,130,148,130,189,130,239,131,32,131,81,131,131,
+131,159,131,187,131,216,131,245,132,10,132,49,132,94,132,128,132,162,251,
+149,14,251,149,14,251,66,247,81,247,68,21,184,248,19,5,140,151,140,150,153,
+26,191,120,167,105,106,119,109,92,113,147,63,151,64,30,148,80,145,90,141,
+109,148,251,0,24,146,59,21,109,116,115,109,110,161,117,169,172,247,42,10,
+40,247,191,144,10,251,40,22,156,29,14,132,248,107,247,163,21,39,6,159,247,
+26,5,244,194,42,6,169,247,94,5,81,6,109,251,94,5,251,25,6,170,247,94,5,81,
+6,108,251,94,5,251,10,84,247,2,6,118,251,26,5,251,8,84,246,6,106,251,108,
+5,197,6,172,247,108,5,247,26,6,108,251,108,5,197,6,170,247,108,5,247,1,6,
+251,30,247,81,21,119,251,26,5,251,26,6,160,247,26,5,14,132,248,61,248,136,
+21,247,3,7,105,167,96,154,55,149,8,202,105,76,7,76,132,111,130,106,113,8,
+105,112,119,99,96,26,92,155,104,179,102,30,168,111,161,124,210,99,8,251,174,
+7,45,140,86,186,115,244,8,124,251,22,6,199,102,181,128,223,136,8,52,173,226,
+7,213,151,170,151,175,168,8,172,167,158,180,187,26,175,132,172,126,160,30,
+113,180,112,160,251,12,208,8,247,138,7,223,129,184,97,156,54,8,251,73,46,
+21,55,195,120,163,186,26,194,173,173,208,153,30,174,251,236,21,232,81,160,
+112,77,26,73,103,102,61,124,30,14,247,218,249,49,248,7,21,251,5,32,251,9,
+251,17,61,186,88,212,184,176,155,174,174,31,192,193,172,220,217,26,207,101,
+178,74,30,146,107,21,178,170,103,95,82,114,71,101,91,31,100,107,110,122,103,
+27,102,115,165,177,193,167,220,176,191,31,179,166,167,157,170,27,97,247,229,
+21,100,6,88,84,100,122,76,27,99,117,146,159,115,31,161,113,126,144,108,27,
+251,7,33,251,11,251,19,69,192,82,204,182,184,159,174,172,31,191,192,171,219,
+211,26,153,137,151,134,157,30,132,157,158,136,168,27,182,164,146,163,180,
+31,251,243,253,7,5,187,6,240,248,249,21,145,119,142,124,125,26,98,124,86,
+116,97,30,81,106,93,105,93,27,104,115,164,175,245,222,247,34,201,144,141,
+138,134,145,31,153,126,151,134,168,131,8,14,247,163,249,91,248,62,21,251,
+108,118,6,189,134,153,129,109,26,95,113,87,74,53,30,84,208,106,190,95,225,
+8,247,6,193,180,184,211,26,210,83,189,60,53,71,71,53,101,147,107,166,64,30,
+101,117,5,33,78,88,68,55,26,44,203,82,246,220,199,164,205,214,30,74,202,188,
+113,197,27,203,196,181,210,169,31,124,150,5,99,107,117,126,103,27,83,88,170,
+200,92,31,183,198,164,176,170,193,165,185,24,163,180,159,151,189,145,8,252,
+26,150,21,109,202,129,177,184,26,187,170,173,185,185,173,103,90,84,101,93,
+60,97,30,70,66,21,199,251,6,174,84,196,69,8,92,79,101,121,96,27,68,81,202,
+217,203,170,182,226,195,31,14,251,66,245,114,29,14,251,66,247,187,249,56,
+21,65,90,109,114,102,93,8,68,52,104,39,251,9,26,251,20,176,42,227,37,30,180,
+91,165,117,191,107,151,155,24,59,202,111,175,112,213,8,115,206,128,214,240,
+26,244,152,222,166,200,30,167,201,169,175,211,197,8,14,251,66,177,251,69,
+21,213,188,169,164,176,185,8,210,226,174,239,247,9,26,247,20,102,236,51,241,
+30,98,187,113,161,87,171,127,123,24,219,76,166,104,167,64,8,163,72,150,64,
+38,26,34,126,57,112,78,30,112,77,108,102,67,81,8,14,132,247,133,248,85,21,
+140,130,140,133,137,26,113,133,113,127,107,30,132,120,135,122,128,26,120,
+155,122,158,160,157,158,160,145,136,151,134,153,30,126,174,132,177,178,26,
+146,7,146,136,160,131,162,119,165,107,25,108,164,156,127,157,27,160,153,154,
+161,165,124,150,95,146,31,100,145,106,151,114,155,131,144,24,188,167,158,
+146,183,146,8,178,145,151,149,165,26,162,125,155,117,124,122,126,111,115,
+30,114,109,115,117,116,127,132,135,24,165,7,166,247,22,5,159,123,155,119,
+119,124,124,119,128,143,120,145,118,30,149,104,144,108,114,26,126,7,101,160,
+119,155,107,175,8,163,119,127,147,123,27,119,125,124,118,114,158,126,188,
+130,31,176,132,169,129,158,126,150,132,24,98,114,123,133,93,130,8,94,131,
+122,127,113,26,118,152,126,162,155,148,144,158,156,30,168,172,144,144,147,
+146,149,147,143,143,176,163,8,14,196,247,141,247,178,21,251,111,73,247,111,
+251,112,205,247,112,247,27,29,251,149,222,251,33,45,10,251,66,247,26,10,251,
+149,247,17,239,102,10,14,251,121,247,179,249,56,21,72,6,251,121,253,70,5,
+207,6,14,132,247,146,249,56,21,84,97,123,103,102,31,81,83,101,251,7,251,9,
+26,251,2,172,251,8,186,83,30,95,176,190,115,197,27,190,182,156,174,175,31,
+197,194,177,247,8,247,13,26,247,97,48,247,33,251,23,30,136,113,21,223,184,
+251,5,251,101,251,101,95,32,53,53,95,246,247,100,247,105,184,247,2,225,31,
+14,132,247,10,22,247,168,154,6,62,122,150,187,138,31,248,236,7,131,141,251,
+72,48,5,125,7,154,178,163,146,148,27,160,148,124,107,31,252,89,7,137,76,122,
+125,63,138,8,14,132,248,111,247,29,21,126,144,102,81,128,132,92,138,25,251,
+131,6,247,60,247,68,5,228,232,178,215,217,26,239,58,216,35,84,87,117,99,102,
+30,107,105,124,107,122,68,160,134,24,237,179,174,171,209,27,224,195,82,55,
+60,93,47,55,50,31,251,70,251,81,5,127,248,26,7,14,132,247,45,247,222,21,198,
+162,137,130,162,31,202,116,177,83,70,26,54,83,75,65,111,119,146,163,102,30,
+157,110,122,146,122,27,116,124,125,118,104,182,117,209,215,218,165,180,187,
+31,186,180,164,197,206,26,191,123,185,111,170,30,118,161,120,151,96,158,8,
+207,186,164,176,193,26,221,76,194,46,89,95,122,107,103,30,109,111,124,114,
+118,79,154,135,24,213,179,184,171,202,27,205,183,96,75,103,124,104,114,113,
+31,109,109,111,124,71,115,8,14,132,248,108,247,123,21,37,248,81,95,6,251,
+206,252,81,5,75,247,173,251,59,216,247,59,241,7,251,72,203,21,251,132,6,247,
+132,247,235,5,14,132,247,73,248,219,21,247,88,6,156,142,140,147,142,31,177,
+228,130,146,5,119,124,130,133,117,27,251,101,6,251,1,251,129,5,138,137,139,
+138,137,26,133,143,137,147,171,178,132,126,181,30,247,7,102,191,78,39,26,
+43,79,64,60,119,123,146,161,109,30,163,107,117,148,116,27,111,125,127,114,
+101,185,115,215,222,211,166,190,190,31,184,184,160,196,215,26,211,120,185,
+90,189,30,95,183,82,162,251,10,160,8,14,132,248,82,249,64,21,251,6,129,81,
+120,66,88,8,251,0,62,80,251,6,251,26,26,52,166,51,182,89,30,95,177,193,115,
+201,27,247,16,225,234,247,30,247,21,67,219,251,9,95,119,132,101,76,31,166,
+247,43,247,4,247,0,247,49,165,8,251,98,251,178,21,226,188,67,251,17,251,2,
+100,78,69,51,85,233,247,47,190,147,167,159,154,31,155,160,170,148,174,27,
+14,132,248,85,174,29,252,6,6,80,251,39,156,131,180,206,158,152,195,140,25,
+247,109,6,251,90,252,232,5,204,6,247,104,249,34,5,14,132,247,182,248,7,21,
+239,193,173,180,207,26,222,68,198,38,251,1,58,72,48,74,158,110,244,47,30,
+251,1,56,118,110,70,26,41,217,72,247,6,247,12,216,205,242,216,105,187,251,
+13,230,30,121,36,21,212,87,163,103,83,26,74,94,94,74,63,88,197,225,204,160,
+180,198,187,30,188,216,21,50,197,103,185,195,26,197,184,180,202,207,182,95,
+70,78,113,99,71,94,30,14,132,198,117,21,247,4,152,194,158,207,188,8,243,215,
+200,247,16,247,27,26,247,57,48,247,9,251,22,251,11,50,38,251,27,251,14,211,
+58,247,0,194,181,155,180,192,30,98,251,55,251,3,32,251,44,113,8,247,198,247,
+249,21,119,135,130,128,130,30,116,112,101,125,103,27,63,91,214,247,11,196,
+155,199,160,165,31,159,156,164,150,168,27,226,184,53,251,60,31,14,251,121,
+247,28,248,95,102,10,251,251,4,138,29,14,251,121,246,251,33,21,208,173,182,
+199,199,26,190,104,177,94,103,116,117,105,106,202,10,131,107,111,102,85,102,
+31,177,248,217,21,247,41,29,164,168,170,113,165,109,31,14,196,248,124,248,
+232,21,252,48,251,156,5,133,7,248,48,251,168,5,243,7,251,198,247,96,247,198,
+247,91,5,14,196,248,170,248,22,21,252,140,73,248,140,6,251,26,4,252,140,73,
+248,140,6,14,196,215,189,21,248,48,247,156,5,146,7,252,48,247,167,5,36,7,
+247,198,251,97,251,198,251,91,5,14,76,247,136,247,56,21,150,207,156,179,176,
+185,185,195,139,139,153,160,8,171,188,152,175,180,26,177,126,175,116,162,
+30,174,105,80,162,84,27,47,69,77,56,98,155,118,171,164,155,155,164,153,133,
+151,124,156,31,126,153,135,147,148,26,171,185,169,187,200,187,86,72,93,126,
+84,115,84,30,111,75,120,90,129,90,138,95,25,149,72,21,109,116,115,108,110,
+161,118,170,171,247,42,10,248,50,249,68,212,21,104,61,88,126,72,27,251,63,
+251,13,247,15,247,67,232,175,234,196,197,31,188,188,205,166,213,27,247,49,
+247,22,251,15,251,41,38,76,43,73,113,126,154,170,146,140,145,140,144,31,204,
+247,146,5,70,6,129,101,5,180,117,124,150,104,27,96,104,123,105,104,31,87,
+86,108,64,65,26,76,178,90,188,183,186,166,184,173,30,95,145,176,110,187,27,
+238,224,247,3,247,21,247,57,251,35,247,20,251,77,251,95,251,54,251,47,251,
+87,251,84,247,52,251,40,247,100,209,188,152,183,236,31,251,61,248,57,21,167,
+137,154,116,137,100,137,89,122,81,114,92,8,103,119,110,117,112,27,102,116,
+171,192,193,157,189,173,177,31,167,171,174,159,163,137,8,14,34,10,14,247,
+52,156,249,23,21,223,247,34,10,64,126,127,57,136,8,120,247,226,7,216,211,
+160,173,176,31,175,171,159,184,187,26,183,122,179,107,168,30,109,166,112,
+151,74,155,191,152,160,149,163,160,8,164,161,154,175,181,26,247,4,49,197,
+251,64,30,251,172,6,247,90,251,228,21,236,185,133,124,175,31,196,116,166,
+98,77,26,85,118,100,99,116,30,121,107,98,131,73,27,90,125,148,171,31,247,
+179,4,247,122,7,140,161,143,145,156,140,183,140,24,247,3,142,204,88,50,26,
+60,88,97,43,138,30,14,247,52,40,29,14,68,29,14,243,32,10,14,188,248,115,247,
+123,21,247,124,116,7,107,10,252,69,186,10,247,110,247,37,7,221,138,155,125,
+151,58,8,14,37,10,14,66,10,14,251,66,41,29,14,251,10,248,6,91,10,14,54,10,
+14,243,44,29,14,248,18,249,243,174,29,251,91,6,251,113,252,141,251,123,248,
+141,5,251,90,120,6,221,135,150,128,141,64,8,252,42,185,10,248,39,7,247,143,
+252,186,5,153,6,247,148,248,209,5,252,89,7,138,54,128,128,60,134,8,120,247,
+172,158,7,67,143,126,153,137,211,8,248,80,7,141,211,151,152,212,144,8,14,
+42,10,14,33,10,14,188,155,68,10,14,249,81,251,51,21,251,6,142,59,183,58,244,
+207,152,175,156,185,179,8,213,205,177,230,247,3,26,247,93,251,28,247,36,251,
+83,251,83,251,28,251,36,251,95,41,169,57,198,75,30,178,97,171,119,210,115,
+186,84,24,59,207,247,13,97,247,52,27,150,152,139,140,149,31,145,6,251,229,
+249,197,21,182,185,120,108,174,31,193,91,171,43,251,5,26,40,110,37,99,93,
+30,98,102,87,116,84,27,91,95,156,171,102,31,87,186,107,238,247,10,26,236,
+168,236,180,185,30,183,180,186,160,197,27,14,247,52,41,10,14,188,36,10,14,
+243,54,29,14,33,29,14,249,77,174,29,251,97,120,6,194,135,157,129,111,26,123,
+132,112,127,109,30,251,39,252,3,251,43,247,230,5,106,213,131,161,154,26,159,
+153,148,171,141,30,144,150,247,19,10,153,125,182,50,247,138,252,185,24,154,
+6,247,114,248,197,172,218,150,150,187,142,25,14,248,73,37,29,14,249,76,174,
+29,251,130,120,6,193,137,155,132,116,26,124,129,121,109,103,30,251,5,251,
+30,97,198,5,78,225,115,181,161,26,159,154,147,172,140,30,167,140,5,158,251,
+194,120,7,204,136,157,124,237,251,31,247,1,251,52,24,251,49,251,85,50,33,
+134,135,88,135,25,120,247,125,158,7,80,143,122,147,162,26,154,154,164,176,
+185,30,247,11,247,40,234,251,32,5,173,88,156,107,124,26,121,123,129,105,138,
+30,135,128,138,138,127,31,120,247,189,158,7,86,145,124,149,96,197,251,84,
+247,166,24,247,38,247,74,204,217,159,151,203,143,25,14,39,10,14,243,48,10,
+14,251,66,247,191,249,17,21,164,251,103,253,198,247,103,164,53,7,105,140,
+125,154,138,175,8,249,52,7,140,171,150,150,172,140,8,14,251,121,130,249,56,
+21,247,120,253,70,5,207,6,251,121,249,70,5,14,251,66,173,251,23,21,114,247,
+103,249,198,251,103,114,225,7,173,138,153,124,140,103,8,253,52,7,138,107,
+128,128,106,138,8,14,101,232,247,187,21,247,34,247,179,247,33,251,179,5,207,
+6,251,72,247,254,5,80,6,251,72,251,254,5,14,132,248,135,251,24,21,189,252,
+133,89,7,14,251,66,247,119,249,56,21,72,106,94,124,10,14,76,32,29,14,132,
+247,45,249,61,21,134,141,98,125,112,130,91,126,25,110,131,5,247,2,10,252,
+155,7,108,223,106,220,247,24,241,247,2,247,35,247,16,63,232,39,78,81,104,
+89,119,30,86,4,178,186,175,191,167,164,129,120,160,30,171,108,161,71,67,26,
+251,3,91,75,57,87,94,161,165,30,14,76,43,29,14,132,248,127,62,29,14,76,35,
+29,14,251,66,247,201,231,29,251,15,247,8,6,100,29,247,152,247,10,10,7,14,
+132,35,10,14,132,64,29,14,251,121,43,10,247,4,249,48,125,29,251,121,77,10,
+88,249,63,125,29,132,51,10,14,251,121,50,10,14,247,163,155,22,247,114,154,
+6,88,140,123,150,138,179,8,247,174,7,141,147,149,146,146,30,162,164,182,156,
+174,27,183,161,104,69,31,251,109,7,137,82,129,128,83,136,8,124,247,116,154,
+7,83,125,155,203,137,31,247,144,7,182,169,171,157,186,27,196,157,112,56,31,
+251,103,7,137,80,133,132,81,133,8,124,247,111,154,7,113,141,5,107,144,128,
+154,178,26,247,98,7,247,10,100,199,62,81,88,113,81,85,30,196,121,105,166,
+85,27,94,112,126,75,56,31,214,7,132,141,86,120,105,128,86,124,25,122,7,142,
+151,148,140,150,27,165,148,123,91,31,251,145,7,83,137,126,125,84,27,14,132,
+40,10,14,132,38,10,14,132,127,10,83,95,115,84,95,31,216,7,133,141,85,118,
+104,126,84,122,25,123,7,140,148,145,139,149,27,173,146,129,92,31,252,104,
+7,86,128,129,80,133,30,247,46,248,170,180,29,132,247,252,248,61,21,165,94,
+109,148,99,27,251,18,44,251,3,251,37,251,17,205,50,233,197,194,165,187,183,
+31,251,80,7,138,83,121,123,69,135,8,122,247,128,153,7,85,151,132,146,137,
+182,8,248,233,7,128,140,5,66,251,222,21,115,135,126,129,130,30,121,117,106,
+127,108,27,108,112,149,158,119,31,107,169,118,203,206,26,247,10,192,212,224,
+201,170,106,73,30,14,251,66,44,10,14,251,10,45,29,14,251,121,87,29,14,132,
+34,29,14,132,248,113,231,29,251,31,124,6,171,136,154,129,120,26,129,137,129,
+135,129,30,40,251,151,37,247,148,5,133,153,136,153,148,26,157,150,146,174,
+142,30,154,251,88,124,7,177,137,146,129,185,36,247,12,251,179,24,141,133,
+142,132,142,131,142,131,142,132,142,134,8,135,141,143,137,142,27,145,146,
+152,176,154,31,247,20,247,213,168,207,145,146,169,142,25,14,36,29,14,132,
+247,170,22,247,93,154,6,108,119,155,183,108,31,251,20,247,88,222,247,12,158,
+166,168,154,172,141,25,154,251,50,124,7,169,137,149,133,125,26,127,127,117,
+114,108,30,134,133,127,121,126,119,131,151,24,124,162,130,152,137,143,8,120,
+170,132,155,149,26,154,152,145,169,140,30,154,251,99,124,148,7,169,155,126,
+92,170,31,233,251,36,251,6,251,57,109,98,129,132,106,136,25,124,247,37,154,
+7,110,128,144,152,146,145,152,153,160,31,218,247,15,230,251,32,5,143,133,
+141,134,132,26,121,132,135,106,137,30,14,132,38,29,14,76,46,10,14,112,247,
+242,251,62,21,71,155,117,170,138,215,8,247,60,7,138,224,120,164,65,157,213,
+158,158,165,140,223,8,247,60,7,140,215,161,170,207,155,8,150,7,251,16,100,
+106,33,137,31,251,70,7,138,69,121,114,73,121,205,120,157,114,140,69,8,251,
+69,7,32,142,177,106,247,16,27,14,251,199,206,251,141,21,205,250,122,73,6,
+14,112,247,22,249,49,21,206,123,162,108,140,63,8,251,60,7,140,54,158,114,
+213,121,65,120,120,113,138,55,8,251,60,7,138,63,116,108,72,123,8,128,7,247,
+16,178,172,245,141,31,247,70,7,140,209,157,164,205,158,73,157,121,164,138,
+209,8,247,69,7,247,0,136,101,171,251,16,27,14,173,248,83,247,206,21,100,114,
+121,127,109,27,118,118,144,148,122,31,186,51,120,146,95,27,93,110,119,74,
+92,31,193,108,5,178,164,156,151,170,27,160,159,134,130,157,31,91,227,157,
+133,184,27,185,167,159,204,187,31,14,251,66,247,36,247,174,21,94,252,19,5,
+138,127,138,126,127,26,87,158,111,173,172,159,168,188,173,131,210,127,210,
+30,132,184,133,185,135,186,130,247,0,24,133,247,77,21,108,116,118,110,108,
+162,115,169,170,163,163,169,168,115,161,109,31,14,132,248,39,248,215,21,104,
+6,95,251,16,5,143,115,126,140,125,27,251,16,43,33,251,27,84,156,85,168,100,
+31,157,114,154,126,176,118,88,251,42,24,173,6,188,247,30,5,132,163,154,137,
+156,27,177,176,153,163,167,31,174,169,158,166,173,209,126,147,24,64,87,103,
+114,80,27,119,123,142,148,116,31,240,247,183,5,100,157,154,126,164,27,164,
+157,157,166,174,112,169,91,158,31,251,50,251,238,21,90,184,120,184,211,26,
+241,193,207,221,156,151,137,132,157,30,14,132,247,236,248,9,21,251,17,6,130,
+213,137,166,175,26,227,174,190,199,176,158,122,104,30,86,140,147,125,169,
+27,168,160,161,170,192,84,179,64,251,12,64,49,251,36,114,141,121,144,113,
+31,32,94,247,0,6,141,122,141,123,5,150,63,145,84,121,26,132,138,133,137,131,
+30,143,120,127,140,124,27,84,103,109,93,101,165,115,181,174,162,153,187,179,
+31,92,207,172,125,182,27,187,184,160,176,171,31,160,163,161,183,157,26,142,
+137,140,135,133,132,134,128,129,30,105,108,103,124,93,27,90,104,147,166,74,
+31,161,247,1,142,159,172,26,139,139,152,138,154,30,138,166,5,247,14,6,251,
+147,251,126,21,164,167,129,131,131,133,126,128,127,31,122,126,126,133,119,
+27,115,122,154,161,163,156,152,173,31,14,251,232,247,223,249,56,207,29,14,
+132,247,247,158,21,76,140,123,156,138,211,8,212,247,65,179,251,65,215,7,146,
+153,5,247,58,179,251,38,6,231,247,76,176,208,169,166,190,150,25,158,251,87,
+120,153,7,169,160,127,120,129,134,122,130,122,31,251,4,251,112,251,10,247,
+113,5,131,154,134,156,152,26,160,157,147,186,30,158,251,135,120,7,185,137,
+156,122,194,40,234,251,65,24,251,36,99,247,59,6,146,125,5,63,251,66,99,247,
+66,77,7,138,55,128,125,72,136,8,120,247,136,7,14,132,248,68,248,43,21,251,
+18,6,142,172,142,165,141,156,144,194,152,186,158,174,8,156,148,157,149,160,
+27,151,147,134,132,136,137,134,136,133,31,134,130,136,130,133,26,121,157,
+123,159,164,160,159,164,177,101,169,92,97,96,116,102,113,30,101,82,122,91,
+123,35,8,32,6,129,108,5,247,3,6,137,124,128,72,138,135,133,83,134,86,25,124,
+251,64,5,251,9,129,112,82,93,27,127,131,144,147,142,141,143,143,146,31,145,
+149,142,147,148,26,161,125,153,117,112,120,121,112,99,172,110,186,194,178,
+171,212,172,30,170,209,156,219,163,247,77,141,156,146,196,146,190,8,247,12,
+6,14,132,247,202,247,17,21,207,187,189,209,192,108,193,81,187,31,251,29,247,
+5,5,119,156,125,167,165,26,181,173,168,190,174,166,125,121,136,137,136,133,
+134,30,123,128,129,122,123,26,114,158,121,167,171,158,159,172,195,84,181,
+66,56,83,90,66,85,158,109,220,73,30,140,129,130,139,133,27,73,90,88,71,65,
+188,76,247,14,55,31,204,95,163,107,100,26,92,105,109,86,102,105,156,157,143,
+143,144,146,145,30,154,152,147,153,153,26,163,118,157,112,108,116,116,108,
+83,199,95,217,226,196,190,215,191,120,168,64,204,30,38,247,150,21,170,191,
+108,92,186,31,173,105,158,106,113,26,104,107,108,102,101,102,162,199,78,30,
+105,173,127,162,169,26,178,167,167,179,30,14,132,117,247,0,21,189,89,235,
+237,5,110,181,177,127,186,27,186,177,152,167,179,31,237,41,187,189,43,235,
+5,168,184,149,173,187,26,188,129,172,110,182,30,235,237,91,187,41,43,5,166,
+100,102,151,90,27,91,104,128,111,95,31,43,235,89,91,237,41,5,110,99,127,101,
+91,26,91,151,103,168,97,30,247,69,247,169,21,218,204,71,57,54,74,72,58,57,
+73,207,222,224,205,205,223,31,14,251,219,240,144,10,14,76,247,47,249,56,21,
+71,106,95,124,10,247,115,158,21,71,106,95,78,79,26,88,174,101,184,144,29,
+14,132,181,78,10,247,19,80,82,10,136,137,24,134,134,134,134,133,135,8,14,
+251,66,202,78,10,14,251,66,247,162,247,114,76,10,188,170,248,53,21,207,251,
+215,6,134,29,133,131,77,247,34,29,152,138,204,8,247,154,7,151,139,154,140,
+158,30,140,191,135,142,5,132,99,107,182,29,157,127,104,164,153,29,70,6,14,
+188,171,248,54,21,208,251,205,6,148,29,123,88,136,95,29,68,6,247,233,156,
+10,140,145,144,31,14,132,247,142,4,90,248,136,188,7,14,132,247,154,251,41,
+21,140,247,15,141,247,18,152,235,164,196,25,110,170,126,195,237,26,217,10,
+164,164,122,158,117,127,121,134,131,120,31,97,122,124,135,103,138,8,192,143,
+164,88,10,8,40,126,84,110,108,30,161,84,157,251,12,141,35,140,251,15,24,14,
+132,247,153,248,92,21,193,143,163,88,10,140,52,127,87,109,100,168,112,151,
+89,138,41,105,142,124,142,97,155,8,146,119,119,144,128,27,116,123,122,113,
+113,155,121,163,149,158,144,147,158,31,181,156,154,143,175,140,8,86,135,114,
+119,89,30,132,120,134,122,129,26,115,161,117,163,164,161,161,163,149,134,
+156,132,158,30,119,189,135,164,192,26,175,138,154,135,181,122,8,131,158,158,
+134,149,27,162,156,157,164,166,123,156,116,127,120,134,132,119,31,97,123,
+124,136,105,136,8,236,149,183,170,173,30,108,176,129,183,140,236,217,10,163,
+165,123,158,116,128,121,134,131,119,31,97,122,124,135,103,138,8,14,251,149,
+247,17,247,202,102,10,14,85,247,130,249,20,21,197,253,174,247,46,161,6,247,
+30,29,248,231,7,140,212,149,149,216,146,8,158,251,155,7,251,39,77,84,251,
+22,58,162,82,186,107,31,172,115,167,132,202,136,8,251,196,193,29,117,247,
+46,7,73,248,85,21,53,148,107,190,247,17,26,211,153,184,168,160,30,157,152,
+156,145,179,142,8,14,251,49,247,66,248,99,21,65,80,80,65,63,198,80,214,212,
+200,199,211,216,80,198,63,31,14,251,66,245,251,33,45,10,76,211,251,33,21,
+207,172,183,135,10,103,85,101,31,247,133,120,21,207,172,183,120,29,76,196,
+114,29,247,133,120,21,206,172,184,119,10,132,248,94,247,114,21,74,198,128,
+148,133,145,137,140,25,129,148,131,146,133,144,110,165,108,169,138,142,8,
+160,123,118,157,133,27,134,134,134,134,126,163,99,169,103,31,171,101,157,
+117,140,10,251,53,166,76,10,248,129,247,58,239,102,10,247,225,22,138,29,247,
+225,22,108,115,114,107,110,164,114,168,170,165,163,169,170,114,165,108,31,
+14,248,129,248,203,249,86,21,95,6,51,48,124,130,81,27,98,118,148,169,102,
+31,161,112,127,145,118,27,37,48,39,251,5,61,190,80,206,173,167,152,168,168,
+31,185,185,168,211,206,26,155,138,150,136,156,30,128,171,157,136,165,27,192,
+170,153,182,176,31,252,30,253,38,5,186,6,200,249,47,21,156,122,152,129,153,
+132,8,160,129,143,132,110,26,251,7,77,38,69,105,116,167,181,196,157,200,172,
+189,30,158,168,150,149,178,158,8,247,230,251,211,21,43,46,35,32,61,235,10,
+151,111,21,175,164,103,87,34,73,38,71,107,115,168,179,206,173,227,183,186,
+31,153,152,158,148,158,27,247,242,167,21,43,46,35,33,60,235,10,150,111,21,
+176,164,103,87,34,73,38,71,106,116,169,180,194,169,226,173,181,31,166,160,
+159,151,162,27,14,76,247,92,247,186,21,125,58,121,104,76,65,8,88,77,115,85,
+88,26,101,152,103,162,116,30,104,173,198,116,194,27,231,209,201,222,180,122,
+160,108,114,123,123,114,125,145,127,154,122,31,151,125,144,131,130,26,107,
+93,109,91,78,91,192,206,185,152,194,163,194,30,167,203,158,187,149,189,140,
+183,25,130,247,64,21,107,117,118,110,107,162,116,169,170,163,163,169,168,
+116,161,108,31,14,251,66,247,134,248,143,52,10,251,66,247,25,151,10,14,251,
+66,247,214,248,143,39,29,251,66,247,194,249,18,56,10,251,66,150,248,237,107,
+29,251,66,247,170,249,44,81,10,251,66,247,58,249,3,133,29,14,251,66,205,249,
+3,57,29,251,66,247,58,249,91,58,29,251,66,237,40,21,109,10,164,204,5,104,
+6,14,251,66,247,85,151,10,251,8,22,164,29,14,251,66,247,121,66,21,112,108,
+120,130,118,27,117,123,155,163,162,152,160,170,164,31,93,6,101,109,123,112,
+106,26,97,170,106,181,180,173,162,192,176,30,14,251,66,247,214,249,54,47,
+29,248,129,247,43,10,248,18,49,29,14,251,123,247,162,248,78,21,130,129,131,
+136,129,27,128,137,145,168,31,247,7,7,203,104,171,69,76,94,111,100,121,153,
+126,157,156,153,151,152,141,139,142,138,142,30,138,144,138,144,143,26,151,
+161,150,162,162,152,124,112,30,109,7,251,20,92,114,120,91,26,99,169,111,180,
+170,165,152,170,173,30,107,145,151,127,166,27,162,151,145,163,163,31,251,
+4,189,21,131,135,132,132,132,30,131,122,127,136,126,27,118,122,159,163,165,
+159,154,210,164,31,14,243,238,247,217,21,52,89,5,90,7,226,189,5,251,59,129,
+10,247,147,7,247,47,228,5,188,7,251,47,50,5,247,61,7,141,212,152,152,217,
+143,8,158,251,174,120,7,212,134,151,126,141,67,8,14,56,29,14,248,18,249,218,
+248,157,21,247,33,251,218,7,117,112,140,141,94,31,128,6,142,91,138,139,124,
+27,56,64,113,90,84,31,76,83,102,39,251,7,26,251,0,169,55,199,80,30,89,189,
+207,112,212,27,154,159,140,140,163,31,154,6,154,140,5,142,181,147,139,180,
+27,247,242,6,183,247,60,5,115,6,88,44,103,108,76,137,251,16,137,24,92,140,
+132,145,137,178,8,247,137,7,247,30,140,209,137,160,118,146,62,25,160,247,
+126,118,6,132,59,120,125,33,136,35,138,24,247,128,7,160,144,140,199,141,30,
+190,6,247,22,165,123,50,151,31,252,20,252,26,21,68,110,110,68,251,15,73,242,
+247,83,247,88,208,247,3,247,13,208,169,107,66,30,14,251,89,247,51,249,56,
+21,47,78,82,53,58,200,81,223,227,204,203,223,218,79,194,54,31,130,106,21,
+187,172,86,63,83,114,108,93,114,120,151,161,127,31,123,167,130,180,178,26,
+184,167,168,182,30,14,247,52,249,0,247,46,21,68,91,100,113,50,29,144,164,
+175,196,27,193,162,102,52,141,31,14,251,121,43,10,14,251,121,237,99,10,128,
+68,122,213,10,132,62,10,161,129,113,166,30,14,249,59,247,37,21,75,92,104,
+115,91,27,102,104,159,169,121,31,113,185,130,176,135,226,8,247,146,6,136,
+201,131,167,116,170,8,178,111,92,162,88,27,84,105,119,83,98,31,195,89,99,
+159,77,27,89,96,122,108,105,31,93,96,110,64,63,26,251,25,224,44,247,13,207,
+180,165,208,177,30,71,169,175,112,201,27,217,187,179,247,1,192,31,252,97,
+247,184,21,212,180,55,251,40,251,12,104,76,71,60,98,225,247,61,191,153,193,
+159,160,31,161,161,163,150,168,27,247,82,251,16,21,222,140,166,180,192,27,
+185,172,98,83,31,112,7,14,132,151,22,247,37,248,185,6,204,173,181,191,196,
+173,87,51,60,109,98,74,132,30,118,137,131,135,130,26,128,148,134,162,138,
+30,227,136,183,70,251,27,26,54,117,94,97,120,131,147,161,137,30,137,161,5,
+162,137,121,156,117,27,113,120,118,112,96,179,109,196,240,217,224,247,2,196,
+117,187,99,174,31,107,167,110,151,78,150,8,246,188,169,172,211,26,232,73,
+198,35,71,88,113,88,110,30,118,102,130,94,69,26,252,6,7,137,84,130,128,89,
+136,8,14,251,99,247,140,247,186,112,29,14,196,169,248,34,21,59,248,60,251,
+105,219,247,185,7,14,132,248,64,248,83,21,52,251,225,6,99,115,100,117,93,
+27,87,107,173,196,31,247,196,52,252,29,7,118,137,121,129,81,30,132,99,134,
+96,118,26,95,156,113,168,169,154,165,190,167,134,166,126,191,30,127,188,137,
+150,135,176,8,87,169,174,117,190,27,193,181,166,201,179,31,77,141,161,112,
+187,27,177,162,153,182,171,31,147,7,117,116,128,133,124,27,117,129,158,184,
+31,14,248,109,247,130,249,22,21,189,6,174,138,159,119,151,92,8,159,227,251,
+237,51,159,6,151,186,159,159,175,140,8,188,251,202,6,105,137,131,247,18,10,
+247,63,227,10,248,63,63,21,150,6,247,46,247,204,5,251,128,7,104,138,132,247,
+18,10,247,62,227,10,247,147,7,178,153,152,181,142,30,159,36,7,251,52,251,
+201,251,46,247,201,5,251,13,119,6,169,138,165,120,152,109,8,251,141,7,138,
+90,130,127,97,135,8,119,247,23,159,7,96,143,130,151,138,188,8,247,115,7,14,
+59,29,247,135,248,236,249,56,207,29,211,110,29,248,160,251,77,209,29,199,
+162,180,176,29,166,161,176,27,179,172,105,97,109,108,87,89,84,247,42,29,196,
+169,22,248,140,205,252,140,6,247,111,247,174,21,251,111,73,247,111,251,52,
+205,247,52,247,27,29,188,247,188,158,21,60,141,125,153,138,213,8,191,241,
+10,198,171,176,200,205,26,247,3,39,209,251,52,30,59,6,138,230,149,152,221,
+146,8,158,251,169,120,7,188,10,7,45,248,97,21,165,145,146,165,247,30,200,
+93,36,42,80,89,251,7,118,125,140,141,117,30,14,247,135,106,29,180,110,29,
+14,196,247,39,29,247,144,247,188,102,10,252,51,4,138,29,14,251,199,206,251,
+44,21,205,247,219,73,6,247,29,4,205,247,219,73,6,14,32,247,92,249,56,21,59,
+76,76,59,60,202,75,217,220,203,201,219,220,77,202,58,31,105,4,196,186,89,
+80,79,92,90,81,83,92,189,198,199,186,188,196,31,14,132,127,10,84,95,115,85,
+94,31,247,190,7,134,142,92,123,112,130,68,120,25,247,2,10,253,84,7,86,128,
+129,80,134,30,247,46,248,169,180,29,247,135,106,29,46,248,110,21,162,142,
+150,140,165,132,123,10,217,191,115,29,251,99,247,188,247,247,209,29,200,162,
+179,176,29,165,161,177,27,179,172,105,97,109,108,86,89,85,247,42,29,247,145,
+247,111,248,141,21,172,136,140,138,147,135,8,144,136,141,131,109,26,251,133,
+7,109,137,132,134,136,30,131,135,136,138,108,136,8,124,247,54,154,7,108,142,
+136,140,131,143,8,134,142,137,146,169,26,238,187,7,176,83,143,132,150,119,
+168,87,165,109,153,142,8,203,147,6,115,159,115,165,111,178,82,218,24,191,
+160,166,174,187,26,195,95,175,68,30,251,69,6,247,5,120,21,180,6,186,163,112,
+87,82,114,107,95,31,96,6,188,247,235,21,251,83,251,44,251,45,251,85,251,84,
+247,43,251,44,247,84,247,81,247,44,247,44,247,79,247,90,251,40,247,45,251,
+85,31,97,4,247,51,247,19,251,29,251,63,251,52,251,24,251,30,251,46,251,49,
+251,23,247,29,247,57,247,58,247,23,247,30,247,49,31,14,196,247,39,29,14,132,
+247,162,248,211,21,198,79,162,98,154,65,8,186,88,112,152,91,27,251,12,47,
+36,251,26,251,25,232,39,247,17,192,185,157,174,175,31,194,191,173,233,235,
+26,209,123,211,108,202,30,117,184,121,163,88,188,230,187,24,106,169,44,89,
+88,169,104,150,73,145,25,97,116,192,130,170,126,188,105,25,251,13,75,172,
+109,5,229,61,21,224,198,44,251,28,251,8,95,72,63,99,103,163,180,117,31,111,
+191,123,210,210,26,232,186,201,210,30,14,196,247,126,247,145,21,251,88,251,
+89,187,91,247,88,247,89,247,89,251,89,187,187,251,89,247,89,247,89,247,88,
+91,187,251,89,251,89,251,88,247,89,91,91,5,14,251,99,233,248,96,21,162,142,
+150,141,165,131,123,10,218,190,115,29,247,145,248,167,247,139,21,77,109,105,
+115,79,27,51,87,204,247,3,247,4,189,202,228,202,175,109,80,148,31,156,209,
+6,146,134,146,130,142,30,153,106,99,147,106,27,251,24,50,58,251,12,251,6,
+220,63,247,13,196,217,156,152,142,31,156,215,5,251,53,248,65,21,251,88,251,
+44,251,43,251,87,251,84,247,43,251,44,247,84,247,83,247,42,247,43,247,85,
+247,83,251,43,247,47,251,77,31,138,97,21,247,44,247,22,251,31,251,56,251,
+57,251,22,251,30,251,48,251,49,251,23,247,29,247,57,247,60,247,23,247,28,
+247,53,31,14,34,10,251,16,248,98,46,29,34,10,204,248,98,39,29,34,10,251,85,
+248,214,21,113,117,116,112,111,159,117,167,143,29,34,10,129,248,98,52,10,
+34,10,43,249,38,58,29,34,10,189,248,229,90,29,247,52,247,228,126,21,138,148,
+146,139,147,27,247,5,239,186,219,199,31,74,10,162,6,163,29,57,108,84,76,31,
+69,77,101,47,251,3,26,251,73,246,251,22,247,59,115,30,102,50,118,10,84,130,
+247,30,10,14,243,32,10,251,171,249,99,46,29,243,32,10,49,249,99,39,29,243,
+32,10,251,238,249,215,21,247,5,29,143,29,243,32,10,251,63,249,99,21,251,38,
+167,10,251,66,41,29,247,7,249,80,46,29,251,66,41,29,247,196,249,80,39,29,
+251,66,41,29,187,249,196,57,10,251,66,41,29,247,117,249,80,154,10,42,10,251,
+102,247,99,98,10,169,169,215,159,31,14,33,10,106,218,46,29,33,10,247,48,218,
+39,29,33,10,39,247,87,57,10,33,10,215,218,52,10,33,10,247,28,247,102,90,29,
+188,36,10,104,248,59,47,29,33,29,251,244,215,46,29,33,29,251,61,215,39,29,
+33,29,252,62,114,10,33,29,251,142,215,154,10,39,10,251,235,215,46,29,39,10,
+252,62,247,84,57,10,243,48,10,251,27,249,90,47,29,76,32,29,41,247,131,63,
+10,76,32,29,230,247,131,39,29,76,32,29,251,57,247,247,57,29,76,32,29,150,
+247,131,63,29,76,32,29,74,248,90,58,29,76,32,29,210,248,6,21,101,121,126,
+96,29,76,247,118,129,21,220,146,192,184,191,244,97,29,251,11,205,51,240,126,
+30,101,48,181,29,151,139,29,105,247,55,10,76,35,29,251,6,247,90,247,15,29,
+247,49,29,76,35,29,214,247,90,39,29,76,35,29,251,73,247,206,57,29,76,35,29,
+134,247,90,63,29,251,121,43,10,229,248,128,77,29,251,121,43,10,247,171,248,
+128,39,29,251,121,198,249,3,21,247,32,29,180,10,247,51,22,138,10,251,94,253,
+3,21,110,10,14,251,121,43,10,247,91,248,128,52,10,132,40,10,248,3,249,3,90,
+10,132,38,10,119,214,63,10,132,38,10,247,61,214,39,29,132,38,10,52,247,83,
+118,29,132,38,10,228,214,63,29,132,38,10,247,40,247,98,90,10,251,10,58,10,
+247,252,47,29,132,34,29,251,154,248,107,63,10,132,34,29,53,248,107,39,29,
+132,34,29,251,241,248,223,118,29,132,34,29,251,66,248,107,63,29,132,38,29,
+251,150,211,247,15,29,247,49,29,132,38,29,251,202,247,80,57,29,76,46,10,113,
+249,54,47,29,251,36,171,247,184,21,117,247,35,161,7,104,141,132,143,157,26,
+247,55,7,163,166,152,145,158,27,166,151,123,104,31,251,15,7,138,102,134,135,
+105,137,8,117,247,32,161,7,108,143,137,141,138,165,8,247,28,7,198,108,175,
+89,111,117,129,109,104,30,176,7,128,142,113,130,115,131,118,133,25,127,135,
+133,138,5,114,7,143,147,146,140,146,27,150,142,133,114,31,251,38,7,138,112,
+135,132,123,137,131,137,24,14,237,248,169,22,247,10,10,171,251,15,247,8,7,
+197,158,170,203,10,96,165,79,88,93,121,108,110,31,169,129,100,158,86,27,236,
+29,107,221,191,29,7,247,58,231,29,247,8,7,198,158,169,246,29,143,140,139,
+140,143,31,124,100,134,104,82,26,107,4,251,206,7,137,65,129,128,73,135,8,
+82,143,131,150,213,26,247,206,7,14,247,229,247,84,231,29,247,8,7,121,10,106,
+221,251,205,6,137,64,129,128,68,136,8,124,247,128,154,7,78,142,131,150,214,
+26,247,205,247,79,251,215,7,134,29,132,131,78,247,34,29,151,138,205,8,247,
+154,7,163,139,160,141,192,30,135,142,5,132,98,108,182,29,158,126,105,163,
+153,29,14,247,227,247,84,231,29,247,8,7,100,29,247,128,154,7,78,142,131,150,
+214,26,247,206,247,79,251,205,7,148,29,124,88,135,95,29,247,162,156,10,141,
+144,144,31,14,247,135,247,108,247,180,21,97,142,125,149,138,168,8,247,230,
+7,132,140,251,4,87,5,130,7,149,168,139,139,146,27,151,142,131,112,31,251,
+149,7,138,113,126,129,100,137,8,128,247,70,7,248,55,84,73,10,118,104,115,
+30,151,169,29,247,135,237,248,105,21,157,141,5,140,142,142,139,141,27,187,
+180,97,91,96,110,110,96,120,127,144,155,117,31,152,122,128,144,129,27,122,
+126,125,121,110,167,123,188,247,0,218,195,214,171,124,170,113,160,31,127,
+149,132,143,109,151,154,150,148,146,143,141,8,162,157,153,163,160,26,182,
+94,173,81,93,98,117,102,114,30,134,131,138,137,128,120,157,126,24,180,168,
+161,153,175,27,176,163,118,107,101,114,117,68,114,31,248,174,251,159,73,10,
+117,104,116,30,156,169,29,247,135,247,19,174,29,72,251,28,5,137,137,138,134,
+136,26,133,142,138,151,137,30,153,156,137,136,153,31,221,121,181,99,78,26,
+84,102,96,92,126,133,142,153,118,30,135,142,5,151,122,126,144,124,27,118,
+127,129,122,115,168,125,190,247,2,210,200,232,185,122,176,107,164,31,108,
+162,109,150,68,151,160,182,24,247,28,6,171,202,124,146,5,126,128,134,136,
+125,27,248,12,252,76,21,192,166,162,168,178,247,10,29,198,90,30,77,95,125,
+120,98,26,79,190,98,215,215,189,180,201,185,118,167,70,188,30,112,76,21,179,
+112,153,119,109,26,105,116,116,104,98,112,169,186,172,150,162,167,162,30,
+169,199,21,92,247,11,10,103,107,125,117,105,116,30,158,169,29,247,135,249,
+15,247,114,21,193,166,162,167,179,26,190,93,176,73,68,87,98,83,100,152,119,
+198,91,30,77,96,124,119,98,226,10,113,76,21,178,112,153,119,108,26,105,116,
+117,104,98,112,169,186,172,150,162,167,183,29,117,104,116,30,251,185,248,
+56,247,20,10,149,146,173,27,247,12,6,251,17,251,236,5,201,6,247,27,248,27,
+5,247,192,171,207,29,14,251,99,247,44,249,62,21,106,113,129,117,117,31,104,
+104,116,70,68,26,73,159,68,167,105,30,112,162,170,124,174,27,221,194,222,
+247,19,247,16,84,225,59,31,138,110,21,175,159,74,251,11,251,9,120,78,101,
+101,120,200,247,12,247,10,159,202,177,31,14,251,99,247,184,248,56,21,87,247,
+154,94,6,251,93,251,158,5,92,247,69,40,208,238,191,7,251,14,190,21,251,23,
+6,247,23,247,67,5,14,251,99,247,3,248,243,21,247,11,6,145,143,140,141,142,
+31,141,140,140,140,144,150,164,197,24,124,150,5,138,136,137,137,139,26,137,
+136,5,131,132,135,137,128,27,251,28,6,68,251,36,138,133,5,131,144,135,150,
+140,30,165,186,127,123,171,31,176,120,159,106,96,26,86,107,98,97,128,129,
+143,151,122,30,154,117,124,145,123,27,118,127,129,121,111,171,123,191,247,
+0,209,201,235,184,127,167,106,170,31,111,165,103,153,70,151,8,14,251,99,247,
+171,249,67,21,91,136,119,135,114,131,8,251,2,104,69,48,32,26,33,199,68,228,
+221,196,198,224,218,90,190,63,113,125,135,123,109,30,160,220,205,192,235,
+154,8,251,29,251,61,21,186,164,100,65,81,119,106,104,92,110,193,227,185,154,
+155,183,31,14,251,99,247,173,249,54,247,20,10,150,146,172,27,247,12,6,251,
+17,251,237,5,201,6,247,27,248,28,5,14,251,99,247,80,248,131,21,194,167,162,
+167,179,26,192,91,177,72,67,85,97,81,100,152,119,200,89,30,75,94,124,119,
+97,26,77,192,97,217,216,191,182,202,186,118,168,68,190,30,111,74,21,179,111,
+154,118,108,26,104,115,116,103,97,112,170,187,173,151,163,167,163,30,170,
+200,21,90,171,119,164,169,26,169,163,160,173,176,162,116,102,107,125,117,
+104,115,30,14,251,99,162,247,148,21,149,140,199,146,163,146,177,159,25,222,
+182,189,222,232,26,239,78,211,54,60,80,76,56,64,187,88,210,170,164,146,156,
+167,30,111,56,74,84,53,126,130,137,24,247,79,247,97,21,129,138,135,134,135,
+30,127,124,119,132,120,27,100,114,181,204,201,159,173,174,185,162,91,44,31,
+14,247,112,247,205,157,21,117,193,10,248,92,214,29,161,140,5,157,251,178,
+121,7,161,138,5,192,137,155,120,76,26,252,92,7,76,123,120,86,137,30,117,138,
+5,121,247,178,7,247,3,150,29,109,27,110,119,120,112,95,181,109,201,243,205,
+217,247,14,31,248,2,7,138,202,155,158,192,141,159,140,24,157,251,179,7,14,
+34,10,165,248,255,128,10,84,29,247,96,7,99,107,125,115,105,26,97,170,106,
+181,181,172,162,192,176,30,119,155,5,112,108,121,130,117,27,117,123,155,163,
+165,166,177,161,144,31,239,29,14,247,52,40,29,251,129,247,160,46,29,247,52,
+40,29,61,248,71,47,29,247,52,40,29,251,136,248,20,125,10,68,29,247,203,249,
+188,47,29,59,29,243,32,10,48,250,10,47,29,243,32,10,251,139,249,215,125,10,
+243,248,188,22,184,247,61,5,69,29,248,104,7,101,109,123,113,172,10,163,172,
+173,175,169,31,14,37,10,251,128,248,176,128,10,37,10,251,232,248,135,125,
+10,251,66,41,29,247,40,249,196,125,10,243,44,29,117,215,46,29,243,44,29,247,
+1,251,102,116,10,14,42,10,252,15,215,46,29,42,10,251,82,247,135,247,8,10,
+247,15,251,59,5,202,6,14,33,10,206,218,21,247,4,29,137,10,251,8,22,158,29,
+247,52,41,10,235,248,12,46,29,247,52,41,10,247,177,248,179,47,29,188,36,10,
+251,116,247,148,247,15,29,152,148,152,247,47,10,188,247,172,125,21,148,6,
+247,6,227,219,241,222,141,29,117,247,105,5,74,29,165,128,162,134,167,135,
+103,51,24,181,29,150,139,29,106,205,10,191,183,108,164,85,129,132,138,137,
+130,31,14,243,54,29,148,250,10,47,29,33,29,251,216,247,172,120,10,14,33,29,
+251,169,215,247,15,29,194,10,117,124,129,134,121,121,30,251,38,251,40,5,251,
+8,22,247,4,29,247,47,10,243,48,10,251,217,248,179,46,29,243,48,10,251,184,
+249,39,125,10,34,10,251,133,248,192,107,29,243,54,29,251,81,251,173,21,206,
+172,184,120,29,247,52,40,29,55,247,160,39,29,248,73,37,29,251,200,215,39,
+29,248,73,37,29,252,200,114,10,39,10,251,74,215,39,29,248,250,248,101,21,
+230,179,48,187,6,195,10,91,251,195,187,122,29,91,50,99,228,251,237,193,29,
+120,247,170,158,7,135,29,37,247,248,21,33,251,195,245,7,14,243,32,10,252,
+38,249,193,107,29,37,10,251,75,248,19,39,29,66,10,248,133,249,80,39,29,251,
+66,41,29,132,249,174,107,29,251,66,157,174,29,198,29,120,247,140,143,10,159,
+149,157,157,158,31,149,148,143,142,144,140,8,158,7,204,29,7,14,251,10,248,
+7,91,10,149,215,39,29,54,10,45,254,67,45,10,243,44,29,108,254,48,21,207,172,
+183,119,29,42,10,252,24,254,48,123,29,102,85,102,31,14,33,10,251,47,247,65,
+107,29,247,52,41,10,226,253,4,123,29,103,85,101,31,14,188,36,10,95,247,148,
+39,29,37,10,252,26,252,253,45,10,33,29,252,115,247,62,107,29,81,29,247,61,
+172,169,143,146,171,30,104,110,124,114,107,26,96,183,10,161,170,157,167,180,
+174,31,219,205,154,175,141,247,21,8,247,41,10,14,243,32,10,251,28,250,0,247,
+31,29,91,29,251,66,41,29,247,152,249,237,247,31,29,91,29,184,247,88,248,106,
+232,10,146,144,140,147,27,168,146,126,83,31,251,94,7,138,46,134,225,29,228,
+26,94,248,177,21,215,29,168,167,162,162,168,167,116,162,111,31,247,194,251,
+85,21,70,105,129,247,35,29,145,144,140,148,27,168,146,126,83,31,251,216,7,
+51,247,32,10,116,125,147,123,27,116,121,121,118,110,173,117,185,200,192,169,
+189,166,31,156,173,143,164,226,26,93,248,232,85,29,14,251,121,247,144,154,
+21,57,143,128,149,214,26,248,98,7,197,158,170,176,247,38,10,157,27,162,157,
+157,162,175,95,165,79,77,86,247,23,10,94,107,184,191,29,247,152,7,14,76,32,
+29,186,248,32,47,10,76,70,10,142,106,145,124,155,124,8,101,109,123,113,106,
+26,96,203,29,116,124,156,165,167,155,161,163,144,31,180,146,150,145,174,177,
+8,140,29,14,76,43,29,251,95,247,252,247,15,10,153,148,151,155,26,159,126,
+151,117,247,3,29,76,43,29,125,248,163,47,29,76,43,29,251,62,248,112,133,29,
+14,240,248,126,62,29,247,40,240,21,206,172,183,200,199,26,189,105,178,93,
+105,247,16,29,176,209,10,112,103,85,102,31,14,132,247,232,248,163,21,251,
+2,130,10,155,7,247,19,29,248,49,215,173,63,247,12,175,10,127,251,13,105,7,
+247,13,252,61,152,10,14,76,35,29,214,248,1,47,29,76,35,29,58,247,206,133,
+29,14,76,248,44,96,10,247,8,161,154,141,146,161,30,101,107,125,115,106,26,
+97,245,10,107,121,130,118,27,117,123,155,161,166,152,161,181,183,31,194,198,
+162,171,154,183,8,211,29,14,132,35,10,247,102,247,221,47,10,132,247,139,249,
+16,85,29,247,115,251,140,55,29,251,127,89,160,10,134,251,229,160,29,14,251,
+121,50,10,224,249,84,46,29,251,21,50,10,247,123,248,54,21,207,172,183,119,
+10,132,40,10,247,91,248,128,63,10,132,40,10,248,24,249,39,47,29,132,38,10,
+179,214,247,15,10,153,148,151,247,53,10,160,247,49,29,251,66,44,10,247,20,
+248,128,77,29,251,10,45,29,251,11,247,85,77,29,251,10,58,10,247,85,39,29,
+251,10,45,29,251,40,252,231,45,10,251,10,247,50,231,29,247,8,7,95,10,171,
+7,107,118,21,168,160,5,191,178,169,188,188,130,29,14,132,34,29,251,121,249,
+55,58,29,132,34,29,251,94,248,107,247,15,29,153,148,151,247,53,10,160,247,
+49,29,76,46,10,251,107,248,143,63,10,76,46,10,251,74,249,3,133,29,14,132,
+212,248,146,21,252,44,108,29,154,7,236,10,79,98,115,79,93,30,247,26,247,31,
+178,251,31,247,23,7,134,142,104,127,114,130,84,124,25,112,131,5,123,7,140,
+142,143,139,143,27,183,147,131,96,31,115,86,100,7,14,251,121,87,29,251,50,
+253,79,45,10,36,29,251,73,196,39,29,36,29,252,73,247,65,247,52,10,113,110,
+180,10,14,76,32,29,251,112,247,225,107,29,132,38,29,71,211,39,29,76,43,29,
+116,247,252,39,29,76,35,29,251,128,247,184,107,29,132,35,10,247,145,247,64,
+39,29,251,121,43,10,247,122,249,29,81,10,251,121,43,10,107,248,222,21,85,
+247,200,193,7,14,251,121,77,10,224,248,143,39,29,132,51,10,247,93,251,188,
+131,29,132,105,111,103,85,102,31,14,251,121,50,10,215,251,188,45,10,132,40,
+10,247,82,251,188,45,10,132,38,10,251,34,247,61,107,29,251,66,44,10,218,251,
+188,45,10,132,34,29,251,15,249,8,47,10,132,34,29,252,20,248,201,107,29,132,
+80,29,34,7,122,116,133,123,118,26,96,170,106,181,180,173,161,193,176,30,119,
+155,5,112,108,120,130,118,27,117,123,155,162,163,157,169,165,161,31,159,155,
+153,146,169,146,8,14,251,66,44,10,247,209,249,39,47,29,251,10,247,90,129,
+21,150,6,215,202,197,209,189,115,172,79,116,29,154,6,85,10,150,137,133,163,
+31,151,137,145,137,152,137,100,46,24,109,10,14,132,35,10,247,33,248,37,21,
+72,106,94,78,79,26,89,174,100,184,173,163,162,173,170,117,159,103,132,133,
+138,138,132,30,137,133,139,139,137,27,132,133,145,147,172,167,175,193,176,
+31,14,132,247,41,248,26,21,144,193,147,186,150,172,8,217,164,187,184,196,
+27,188,190,103,85,167,31,153,111,148,105,145,95,8,156,6,123,247,115,5,121,
+6,108,133,132,126,127,27,135,134,142,144,131,31,162,105,103,151,104,27,251,
+10,42,251,7,251,60,116,31,92,6,112,98,5,209,6,138,131,139,132,128,26,122,
+139,130,141,128,30,95,6,112,98,5,214,6,251,51,165,231,39,247,12,27,212,203,
+173,199,182,31,173,7,81,107,76,100,80,27,46,73,227,247,32,125,31,247,18,6,
+165,180,5,251,47,6,138,157,139,148,142,26,143,139,146,140,161,30,247,87,6,
+166,180,5,14,247,236,211,68,10,248,94,115,21,72,207,6,151,135,143,127,30,
+106,91,113,108,122,129,8,128,132,135,134,133,26,134,141,135,145,136,30,168,
+251,81,6,81,162,108,182,167,168,153,162,157,30,142,143,139,139,150,156,120,
+155,24,118,120,134,135,124,27,119,132,153,175,31,247,71,206,7,14,46,10,247,
+30,99,10,129,68,121,213,10,132,247,178,169,21,251,2,144,74,247,7,247,80,26,
+247,77,209,247,14,244,179,178,116,99,167,30,163,105,150,110,154,71,8,165,
+6,132,247,117,5,114,6,119,135,128,126,127,27,132,130,142,144,129,31,156,107,
+104,147,103,27,63,63,101,79,96,31,93,75,114,49,40,26,251,95,241,251,28,247,
+44,227,214,185,220,185,30,116,155,109,99,109,112,102,122,25,247,58,7,157,
+182,154,157,161,145,8,120,154,149,133,154,27,159,150,150,161,162,124,152,
+113,106,120,123,86,106,31,206,7,128,142,37,100,5,121,7,142,153,143,140,143,
+27,154,143,129,107,31,14,251,149,247,17,247,202,102,10,14,251,149,247,17,
+247,202,102,10,14,251,66,247,26,10,248,129,247,43,10,247,218,248,15,248,141,
+21,95,122,112,118,98,27,88,107,179,202,198,166,177,180,162,147,131,115,143,
+31,117,143,151,128,160,27,159,153,151,156,175,95,168,85,60,83,79,55,59,192,
+79,209,196,179,176,214,163,31,251,109,252,133,21,182,6,248,41,249,42,5,95,
+6,100,252,21,21,58,77,76,57,60,198,79,218,218,201,204,220,219,82,197,60,31,
+131,112,21,187,172,87,63,77,111,99,96,90,106,187,210,209,165,180,185,31,14,
+251,66,247,128,248,88,21,85,177,111,174,172,26,147,145,145,147,140,140,139,
+138,141,30,137,149,143,138,148,27,176,161,158,171,173,115,162,104,94,104,
+101,88,79,184,78,206,106,31,14,251,232,247,223,249,56,207,29,14,251,66,150,
+248,237,107,29,76,51,29,74,248,90,120,10,87,207,77,29,132,64,29,54,249,106,
+39,29,76,35,29,172,247,247,21,64,111,114,117,91,29,251,121,247,71,248,93,
+21,136,10,124,247,23,143,10,176,172,172,177,31,172,154,6,73,144,132,148,138,
+212,8,88,248,217,125,29,251,55,162,105,10,247,149,248,11,102,10,14,132,38,
+10,247,16,247,124,81,10,132,62,10,160,129,113,167,30,251,11,247,3,63,10,251,
+121,156,108,10,247,146,249,3,56,10,132,34,29,40,248,238,56,10,243,44,29,247,
+3,251,145,102,10,14,33,10,247,4,247,128,247,31,29,80,27,75,155,29,188,36,
+10,251,125,253,124,131,29,132,106,111,102,85,102,31,14,243,247,205,22,247,
+31,158,6,92,10,247,9,7,99,40,181,29,151,27,176,154,129,114,111,119,122,105,
+205,10,192,182,108,164,84,130,132,138,137,130,31,14,251,121,247,66,130,21,
+184,146,173,163,165,183,126,150,24,192,29,247,178,240,171,38,247,56,29,141,
+60,159,103,187,129,101,48,24,181,29,151,139,29,106,117,213,29,192,182,107,
+164,85,129,247,30,10,14,33,29,251,126,247,124,247,52,29,179,120,186,27,223,
+185,190,245,151,31,14,34,10,43,249,4,194,29,195,194,218,29,109,110,102,104,
+110,169,175,175,169,168,175,31,84,174,21,247,4,29,156,26,158,126,151,118,
+123,247,44,10,56,29,251,66,247,45,247,15,29,152,148,152,247,47,10,248,18,
+49,29,182,248,68,46,29,248,160,218,21,93,7,118,7,87,7,58,139,133,133,123,
+30,115,131,118,122,116,27,126,128,147,159,122,31,162,122,125,148,122,27,117,
+121,122,117,106,179,117,199,190,184,153,163,166,31,174,169,156,207,247,0,
+26,248,125,7,142,243,152,156,218,146,8,158,251,127,120,7,101,10,14,243,247,
+146,247,208,21,251,88,7,138,53,130,129,55,134,8,120,247,184,158,7,57,143,
+126,151,138,213,8,247,99,244,173,34,247,162,128,29,251,162,35,105,6,14,132,
+247,56,247,240,21,247,22,29,251,245,231,10,128,146,160,123,157,29,247,202,
+111,10,124,247,104,154,7,89,142,123,152,175,26,14,251,121,247,46,247,209,
+21,240,240,171,38,247,8,7,106,10,38,69,105,209,251,58,163,10,247,43,247,16,
+173,7,14,132,247,73,247,122,21,247,8,251,57,5,149,126,146,125,133,26,129,
+132,134,126,30,129,122,247,101,156,6,88,116,156,221,82,31,251,9,247,53,229,
+236,184,188,159,151,187,143,25,152,140,5,156,251,69,122,144,7,156,137,147,
+134,128,26,131,133,128,129,128,30,251,9,251,22,5,247,100,7,70,105,128,134,
+66,109,145,125,24,150,142,5,141,146,147,141,144,27,151,150,135,131,144,31,
+147,129,140,131,99,26,251,94,7,50,131,125,90,137,30,125,122,247,112,156,126,
+6,89,140,131,154,140,228,8,14,236,145,248,89,21,217,151,188,191,208,26,188,
+110,176,99,108,115,116,109,110,163,114,167,147,145,140,143,155,30,137,91,
+109,103,86,122,8,247,163,140,232,10,145,147,141,145,27,168,146,126,82,31,
+251,94,7,50,131,125,90,137,30,121,122,247,116,157,119,6,93,142,136,145,138,
+238,8,247,109,7,186,193,163,151,176,27,194,154,114,48,31,251,52,7,138,40,
+136,133,93,136,8,120,121,247,106,157,124,6,92,142,136,145,138,238,8,247,49,
+7,205,135,166,126,169,30,174,123,103,161,97,27,90,94,114,80,80,31,14,33,29,
+251,102,247,97,21,101,122,126,127,116,27,124,119,144,149,121,31,115,151,5,
+150,116,113,146,118,27,89,103,103,74,124,31,168,6,170,150,156,154,162,27,
+150,154,214,10,120,178,156,134,164,27,194,168,168,216,160,31,14,247,52,249,
+0,247,46,21,69,91,100,112,50,29,143,165,175,196,27,193,162,102,52,141,31,
+251,111,247,92,21,158,29,251,66,41,29,247,176,249,205,21,101,122,126,127,
+116,27,124,120,144,149,166,10,150,154,214,10,120,179,155,134,164,27,194,168,
+169,215,160,31,14,248,73,37,29,252,25,151,29,248,73,37,29,252,134,215,46,
+29,36,29,251,154,196,52,10,36,29,252,7,196,77,29,39,10,251,158,151,29,132,
+38,29,251,48,211,154,29,132,14,251,149,14,248,129,248,27,248,154,200,10,251,
+20,251,0,21,146,54,150,98,169,94,8,76,181,203,107,222,27,216,199,166,193,
+181,31,175,186,154,184,146,232,128,89,128,117,113,109,8,84,91,79,113,58,27,
+58,79,165,194,91,31,113,169,128,161,128,189,8,247,238,247,0,200,10,251,1,
+247,104,131,10,137,90,21,247,69,247,33,251,32,251,68,251,67,251,33,251,33,
+251,67,251,65,251,35,247,33,247,62,247,71,247,30,247,34,247,68,31,14,248,
+129,248,137,249,110,131,10,251,1,251,99,201,10,251,20,251,5,21,150,89,150,
+117,165,109,8,84,187,199,113,220,27,220,199,165,194,187,31,165,169,150,161,
+150,189,132,54,128,98,109,94,8,76,97,75,107,56,27,62,79,166,193,97,31,103,
+186,124,184,132,232,8,247,238,247,5,201,10,14,248,129,248,135,111,21,159,
+229,199,242,247,8,247,37,8,235,247,14,171,206,219,26,221,69,207,55,91,95,
+118,101,106,30,117,114,129,117,126,93,127,175,131,157,127,157,8,189,106,88,
+168,84,27,54,73,71,50,72,160,94,223,251,6,31,247,43,251,94,179,71,165,36,
+8,14,248,129,247,142,247,241,21,240,251,17,247,16,251,69,177,64,199,247,0,
+247,6,247,53,243,247,16,58,232,251,54,247,120,104,210,84,36,64,33,251,38,
+251,75,8,14,248,129,249,131,22,159,7,36,159,110,153,93,187,92,191,122,192,
+138,235,160,102,147,126,151,125,8,93,178,201,108,192,27,230,210,213,233,229,
+74,211,58,110,132,137,110,80,31,167,180,150,170,176,26,227,66,210,48,46,68,
+69,48,104,146,121,173,85,30,163,90,119,145,108,27,64,73,63,52,46,212,66,231,
+220,207,189,230,184,31,140,123,139,128,134,26,67,101,58,85,95,30,107,114,
+116,130,44,119,8,119,7,14,248,129,247,187,22,248,119,162,6,251,53,147,63,
+224,142,247,62,8,56,183,185,106,212,27,209,197,201,213,207,113,180,32,236,
+31,251,1,240,120,166,100,247,9,123,46,81,55,32,52,8,58,72,105,83,75,26,64,
+200,77,212,181,180,156,169,171,30,158,157,150,154,156,176,145,251,59,52,44,
+251,51,138,8,14,248,193,248,229,21,67,188,156,121,156,27,149,147,146,149,
+145,138,143,132,153,31,116,182,122,203,183,26,169,137,145,126,134,132,136,
+131,126,30,120,112,61,117,96,27,113,138,131,134,126,26,117,173,129,226,133,
+30,37,251,77,5,151,108,110,145,107,27,251,26,251,0,251,0,251,26,251,25,247,
+0,251,0,247,26,247,25,247,0,247,0,247,26,216,102,211,76,185,31,251,34,123,
+21,238,220,59,40,40,59,58,40,39,59,219,238,238,219,220,238,31,14,248,19,247,
+172,21,247,2,151,221,230,247,1,26,247,11,43,234,251,10,251,10,44,43,251,10,
+251,1,221,48,247,1,127,30,50,251,41,100,247,41,251,44,183,247,44,247,40,178,
+251,40,7,114,248,106,21,235,216,64,46,45,63,63,45,46,63,215,232,231,215,216,
+229,31,14,132,247,129,247,67,21,146,124,118,143,123,27,77,84,86,80,104,165,
+117,180,186,183,162,177,166,31,159,166,145,161,141,187,8,247,185,7,195,131,
+185,64,55,26,89,131,101,115,84,30,166,6,175,182,158,194,197,26,215,110,209,
+81,210,30,88,199,138,141,134,145,131,149,25,197,95,7,14,248,129,247,205,248,
+119,21,110,102,124,103,133,91,8,251,5,84,247,5,6,143,97,158,91,166,106,59,
+60,24,177,101,219,219,177,110,178,123,184,134,25,251,5,193,247,5,7,183,144,
+185,158,171,165,219,59,24,176,177,59,219,168,174,156,181,144,184,25,247,5,
+194,251,5,6,134,182,121,183,112,173,218,218,24,102,177,59,59,105,166,98,156,
+92,146,25,247,4,85,251,4,7,96,134,95,121,104,111,59,219,24,101,101,5,247,
+156,85,21,236,216,64,45,43,63,62,44,45,62,216,234,231,216,217,230,31,14,248,
+129,250,66,249,143,21,254,9,254,9,250,9,6,252,81,248,222,21,220,204,75,61,
+58,75,75,59,60,75,203,219,216,204,205,215,31,14,248,2,248,155,21,251,39,251,
+9,251,6,251,35,251,38,247,7,251,8,247,37,247,35,247,8,247,8,247,36,247,33,
+251,8,247,10,251,31,31,131,78,21,247,4,229,51,251,1,251,3,51,50,251,2,251,
+2,50,228,247,2,246,228,230,245,31,14,248,129,248,141,248,247,21,251,52,251,
+20,251,17,251,48,251,50,247,18,251,19,247,49,247,48,247,19,247,19,247,48,
+247,46,251,19,247,21,251,43,31,248,73,247,52,21,254,9,254,9,250,9,6,252,84,
+249,139,21,247,70,247,35,251,32,251,66,251,68,251,32,251,34,251,68,251,66,
+251,33,247,33,247,67,247,63,247,34,247,37,247,60,31,14,248,129,247,34,22,
+249,96,247,250,253,96,6,14,247,13,29,14,247,13,29,179,252,63,21,248,23,248,
+23,252,23,7,14,248,208,247,103,21,251,103,248,36,251,103,252,36,5,14,247,
+249,4,249,3,174,10,253,3,6,14,249,102,247,249,21,203,253,3,168,29,249,3,248,
+55,21,252,160,6,247,102,220,116,192,251,178,251,20,5,62,247,18,29,248,160,
+247,3,10,247,19,5,216,7,251,178,247,20,116,86,5,14,248,27,22,249,3,7,220,
+251,102,192,163,251,20,247,177,5,62,6,251,19,251,177,191,115,221,247,102,
+5,253,3,7,14,248,27,249,102,21,75,253,3,6,57,247,102,87,205,29,14,247,222,
+249,3,134,10,162,247,13,10,116,5,14,247,91,44,21,81,247,219,197,7,251,88,
+249,66,134,10,163,247,13,10,115,5,14,206,247,144,22,199,138,247,89,248,11,
+251,81,248,2,5,76,6,251,88,251,255,5,247,114,251,211,21,251,51,247,210,247,
+56,247,199,247,49,251,202,5,14,248,208,248,175,21,252,58,6,247,103,252,36,
+5,14,247,254,248,133,21,251,11,43,43,251,12,251,11,235,44,247,11,247,12,234,
+234,247,11,247,12,43,235,251,11,31,14,248,129,250,8,248,237,21,75,251,72,
+252,195,6,178,10,249,3,6,14,251,66,197,247,130,21,247,66,251,232,5,124,147,
+149,131,151,27,147,144,143,146,146,137,147,136,147,31,251,23,247,221,247,
+23,247,221,5,142,147,141,147,146,26,147,134,143,131,127,131,133,121,129,30,
+14,251,66,247,167,247,130,21,251,66,247,232,5,156,130,130,146,127,27,131,
+134,135,131,133,141,131,142,130,31,247,23,251,221,251,23,251,221,5,136,132,
+137,131,132,26,131,144,135,147,151,147,145,156,149,30,14,225,248,39,248,28,
+21,251,105,6,65,247,77,5,45,6,247,125,252,213,5,222,6,247,125,248,213,5,45,
+6,34,251,157,21,63,251,72,64,247,72,5,14,132,247,191,247,184,21,251,148,247,
+218,5,129,117,134,119,118,26,119,146,124,159,113,30,209,52,83,34,5,121,106,
+129,110,120,26,119,148,116,159,104,30,165,97,139,138,128,26,121,126,129,117,
+30,121,78,221,6,226,162,154,198,179,130,158,84,213,31,105,185,127,166,169,
+26,158,143,151,158,174,30,247,191,252,12,5,149,160,144,157,159,26,161,131,
+156,114,171,30,100,188,5,102,186,129,160,172,26,157,142,153,151,171,30,183,
+245,5,161,6,161,149,129,114,143,31,148,170,143,165,168,26,191,122,159,95,
+30,71,6,100,126,150,171,31,155,7,110,108,125,106,99,26,112,147,115,153,126,
+30,129,149,153,135,170,27,179,6,14,56,189,22,247,217,248,213,251,217,55,247,
+133,251,54,251,133,55,247,133,251,55,251,133,6,14,248,226,248,233,21,109,
+134,111,132,117,30,113,129,128,129,118,27,121,132,150,203,112,31,118,189,
+121,167,117,157,8,167,107,96,154,90,27,251,15,37,43,251,9,81,160,93,182,102,
+31,176,107,170,125,199,130,144,176,24,89,148,115,149,112,161,8,106,166,119,
+183,183,26,221,208,210,219,194,172,109,51,182,30,74,171,170,114,190,27,213,
+178,195,244,140,31,151,7,164,251,229,21,132,169,134,155,131,156,8,184,119,
+105,163,93,27,66,75,79,70,114,146,109,151,112,31,182,43,139,139,140,113,8,
+103,141,104,108,95,27,101,110,156,183,108,31,94,202,139,139,134,144,124,157,
+116,156,116,150,8,152,113,107,146,110,27,130,6,138,104,174,127,153,129,158,
+111,25,195,48,139,139,165,112,8,103,173,178,120,180,27,186,201,162,173,184,
+31,181,171,159,172,175,26,156,135,156,128,162,30,89,247,7,136,147,164,26,
+168,161,161,168,178,162,113,75,154,30,14,247,163,247,8,151,21,155,149,147,
+146,150,27,149,148,136,134,146,31,108,186,139,139,166,27,178,180,168,188,
+172,31,168,183,154,197,208,26,196,7,140,146,145,139,142,27,161,152,136,132,
+149,31,152,131,142,131,151,91,181,251,60,24,95,150,154,116,158,27,172,182,
+169,188,178,31,126,153,5,135,128,134,137,133,27,118,128,152,177,130,31,110,
+247,3,124,195,125,161,110,157,25,233,172,179,176,192,26,219,75,200,55,83,
+96,120,92,94,30,181,113,92,164,88,27,41,61,56,34,78,157,110,198,106,31,178,
+117,157,118,114,26,133,138,131,137,129,30,150,136,5,172,178,151,163,165,26,
+161,125,156,108,155,30,84,167,139,139,131,146,8,118,156,128,161,165,26,193,
+179,180,191,206,170,88,251,3,30,251,40,7,83,136,114,129,110,30,120,132,125,
+121,129,27,134,133,142,144,131,31,156,116,124,145,120,27,98,112,110,74,117,
+31,247,195,247,251,21,222,137,151,127,182,30,160,168,157,145,170,27,194,178,
+103,89,106,120,108,109,123,31,110,124,121,133,77,124,8,14,247,52,170,249,
+10,21,247,149,253,10,5,227,6,247,151,249,10,5,251,195,252,164,21,251,74,248,
+91,5,248,1,6,14,247,52,172,22,248,238,6,251,173,249,68,5,251,142,253,17,21,
+247,105,248,94,247,81,252,94,5,14,247,253,210,21,68,221,5,248,131,97,252,
+82,7,87,199,5,82,6,247,114,251,154,247,114,247,154,5,82,6,87,79,5,248,82,
+97,252,131,7,14,247,253,248,213,21,210,57,5,252,131,181,248,82,7,191,79,5,
+196,6,251,114,247,154,251,114,251,154,5,196,6,191,199,5,252,82,181,248,131,
+7,14,248,129,248,20,247,4,21,79,251,11,211,103,217,247,47,5,247,170,219,251,
+130,6,200,247,14,5,247,69,219,251,28,6,199,247,11,67,175,61,251,47,5,251,
+170,59,247,130,6,78,251,14,5,251,69,59,6,14,248,129,247,140,247,184,21,75,
+248,140,203,7,252,140,251,84,21,75,248,140,203,7,252,140,248,20,21,75,248,
+140,203,7,14,248,91,74,21,247,50,250,104,83,148,251,15,253,149,251,78,248,
+13,251,55,60,163,88,234,186,5,14,248,129,248,179,248,212,21,213,138,177,136,
+197,30,137,168,138,169,154,26,174,150,162,157,144,145,136,136,141,30,111,
+156,146,134,157,27,158,154,153,158,165,115,157,104,105,109,122,110,123,31,
+114,96,125,251,0,251,34,26,251,237,7,68,140,97,142,83,30,141,109,140,113,
+120,26,104,126,116,121,131,133,144,152,132,30,156,130,131,144,125,27,119,
+124,124,121,113,163,121,174,173,168,156,168,156,31,164,182,153,246,247,35,
+26,14,248,67,251,110,21,249,130,7,190,7,205,139,139,141,158,30,160,141,146,
+148,152,27,148,145,134,126,148,31,117,152,152,131,160,27,164,158,158,163,
+171,112,162,101,53,80,51,251,20,31,253,130,7,14,247,252,249,128,21,253,131,
+7,89,7,72,139,139,137,120,30,119,137,132,130,126,27,130,133,144,153,130,31,
+160,126,126,147,118,27,114,120,120,115,107,166,116,177,225,198,226,247,20,
+31,249,131,7,14,248,129,249,58,247,108,187,29,108,118,75,93,31,193,107,240,
+29,92,228,157,132,184,27,185,170,160,204,185,31,85,247,97,187,29,109,118,
+74,92,31,193,108,240,29,91,228,157,133,184,27,185,173,163,200,182,31,14,248,
+129,249,86,22,205,252,48,73,7,248,48,248,219,21,252,48,251,129,5,133,7,248,
+48,251,140,5,232,7,251,198,247,76,247,198,247,66,5,14,248,129,247,186,22,
+248,48,205,252,48,6,165,4,248,48,247,129,5,145,7,252,48,247,140,5,46,7,247,
+198,251,76,251,198,251,66,5,14,248,18,249,76,248,34,21,252,140,251,185,219,
+247,105,248,60,6,14,248,129,249,100,248,195,21,79,251,141,6,38,134,98,124,
+110,30,91,114,83,107,80,27,87,88,164,179,111,31,116,172,133,180,247,4,26,
+247,141,79,251,138,7,251,29,144,105,163,99,30,74,177,209,102,222,27,215,203,
+170,195,180,31,172,184,145,171,247,41,26,14,248,129,249,100,22,247,138,7,
+247,29,134,173,115,180,30,202,101,68,177,57,27,63,75,108,83,98,31,106,94,
+133,107,251,41,26,251,138,199,247,141,7,240,145,182,156,170,30,185,164,194,
+169,196,27,192,191,113,97,167,31,160,107,145,102,251,6,26,251,141,7,14,248,
+129,249,147,247,108,21,200,252,98,7,145,246,195,189,247,1,137,8,247,183,201,
+251,172,215,10,56,247,23,29,201,251,183,6,251,1,137,83,189,133,245,8,14,248,
+129,248,106,248,234,21,252,173,251,161,78,248,234,200,251,160,248,173,7,14,
+248,129,248,136,247,164,21,96,178,135,142,120,153,8,165,106,96,155,106,27,
+69,81,81,69,69,197,81,209,173,180,155,165,173,31,158,153,143,142,182,178,
+184,100,143,135,156,126,8,113,174,180,123,173,27,209,197,197,209,209,81,197,
+69,106,96,123,113,105,31,122,126,134,135,95,100,8,172,109,21,190,190,191,
+169,179,27,183,176,102,95,94,102,102,95,100,88,168,192,86,31,74,22,87,87,
+87,110,100,27,95,102,176,183,183,176,176,184,178,190,110,87,191,31,14,248,
+129,249,62,247,59,21,90,140,109,156,86,197,8,192,185,176,161,182,27,139,142,
+139,142,138,30,201,127,7,79,81,103,73,89,31,207,85,81,173,80,27,61,83,82,
+58,59,192,84,217,191,190,163,185,181,31,147,147,144,145,155,157,195,70,203,
+102,199,142,8,251,121,247,30,21,135,134,139,139,133,133,8,92,93,106,121,98,
+27,99,112,169,185,185,167,168,184,173,162,127,94,187,31,149,130,139,139,148,
+130,8,14,248,129,247,144,247,201,21,190,163,184,170,190,27,176,182,127,114,
+197,31,107,209,157,134,179,27,205,194,167,196,183,31,86,183,5,102,109,102,
+119,104,27,107,111,147,176,45,31,163,77,110,146,104,27,60,86,103,56,96,31,
+171,54,21,80,248,196,198,7,252,197,251,8,21,80,248,196,198,7,14,248,125,249,
+121,247,20,21,103,110,109,103,103,169,110,175,174,169,169,174,176,110,168,
+102,31,252,125,22,103,238,29,102,31,247,138,248,133,21,102,238,29,103,31,
+14,248,129,249,69,249,85,21,253,114,7,84,138,120,119,84,243,29,249,59,7,196,
+160,162,192,30,156,157,253,159,121,155,6,193,159,117,81,140,31,253,59,7,84,
+138,119,119,85,243,29,249,114,7,14,248,129,247,238,249,91,21,247,133,6,244,
+138,165,117,154,38,8,162,6,130,247,57,5,252,175,6,247,102,252,103,251,110,
+252,44,5,248,200,6,188,247,102,5,116,6,111,59,108,120,38,140,8,251,188,6,
+247,73,247,244,5,14,111,247,132,247,154,21,196,200,171,177,162,176,8,179,
+203,163,209,192,26,190,113,172,98,55,79,251,20,251,180,84,30,107,101,132,
+132,123,124,8,126,126,134,132,132,26,130,147,128,145,145,164,159,162,160,
+30,133,73,138,117,115,26,77,164,106,186,170,166,158,176,163,30,151,160,147,
+159,152,26,149,133,145,131,130,134,134,125,133,30,100,120,127,126,123,27,
+128,133,148,155,164,151,225,155,228,31,148,197,21,247,122,177,163,210,178,
+27,153,149,124,119,112,128,93,124,100,31,117,83,110,94,91,86,8,14,132,247,
+3,249,54,21,162,184,171,148,174,27,241,197,44,251,56,110,137,115,134,91,31,
+189,75,103,155,88,27,90,98,121,100,103,31,95,93,114,76,77,26,251,0,222,53,
+243,209,197,171,201,181,30,185,207,172,247,25,247,10,26,247,8,106,231,70,
+209,30,188,91,86,162,75,27,100,104,131,119,84,31,247,192,252,49,21,123,251,
+3,129,96,113,88,8,86,113,96,106,95,27,84,106,191,225,247,6,206,233,220,177,
+164,126,97,181,31,14,248,129,248,139,249,75,21,251,92,152,29,251,85,31,135,
+251,208,21,251,82,247,80,5,184,194,204,162,209,27,208,203,117,95,196,31,179,
+99,21,187,81,162,77,66,26,67,116,75,93,83,30,251,84,247,87,5,247,44,251,127,
+21,95,84,72,115,69,27,69,75,162,186,80,31,247,85,247,85,5,251,125,251,45,
+21,95,193,116,203,209,26,211,162,203,186,196,30,247,82,251,80,5,14,247,33,
+247,186,248,38,21,251,14,67,76,60,58,26,113,146,111,155,97,30,88,64,124,106,
+98,26,85,176,99,188,193,182,192,206,179,124,186,98,224,30,177,187,179,179,
+195,185,8,192,201,176,158,175,27,172,162,109,95,85,115,62,105,89,31,100,114,
+101,115,106,27,108,111,160,162,152,146,146,153,140,31,161,141,154,154,158,
+26,155,127,151,122,110,115,108,101,93,175,107,190,189,196,172,194,186,30,
+180,186,161,195,194,26,208,99,185,81,60,72,92,251,56,251,49,30,130,158,136,
+157,161,26,214,178,193,233,194,30,251,56,251,224,21,180,64,156,95,106,26,
+108,118,117,109,102,112,170,182,178,146,155,189,215,30,14,248,129,248,61,
+141,21,137,161,145,139,173,27,247,172,201,251,183,6,123,6,247,109,248,6,5,
+229,201,86,6,167,187,97,164,96,66,5,251,62,247,33,29,67,43,26,251,16,190,
+53,229,110,30,111,90,180,113,5,247,126,248,131,21,251,105,251,255,5,68,158,
+105,197,240,26,247,21,191,195,247,13,30,14,248,129,249,23,248,53,21,252,68,
+252,53,5,248,214,181,252,105,6,247,244,247,234,5,14,248,129,247,125,201,247,
+9,29,183,172,211,242,26,246,212,29,247,13,191,84,251,22,251,22,87,84,251,
+13,31,14,248,129,249,147,201,21,251,183,6,251,13,87,194,197,10,102,31,74,
+96,105,67,43,26,251,7,184,55,247,23,29,6,14,248,129,247,125,247,58,247,9,
+29,182,172,212,238,26,247,4,93,224,61,234,29,247,13,191,83,251,21,251,22,
+87,83,251,13,31,247,135,251,3,21,252,170,84,248,170,6,14,248,129,249,147,
+247,58,21,251,183,6,251,13,87,195,197,10,101,31,75,96,105,66,43,26,42,167,
+72,198,93,30,107,179,176,130,229,27,247,172,6,90,4,252,170,84,248,170,6,14,
+248,129,248,164,247,108,21,247,131,200,251,96,6,227,247,47,5,247,8,201,58,
+6,172,198,97,163,92,56,5,251,35,215,10,55,220,105,30,106,82,182,116,177,206,
+5,136,164,153,138,180,27,247,172,201,251,183,6,119,133,139,140,129,31,171,
+247,45,21,58,251,33,87,157,108,190,136,211,25,247,182,247,108,21,51,251,47,
+5,251,94,6,145,246,195,189,247,1,137,8,14,219,247,187,21,221,210,5,248,188,
+181,252,139,6,197,29,248,139,181,252,188,6,14,249,23,247,187,21,57,68,5,252,
+188,97,248,139,185,29,252,139,97,248,188,6,14,247,41,248,44,21,197,29,248,
+61,185,29,252,110,97,21,248,159,6,221,68,57,68,5,252,159,6,57,210,5,14,132,
+251,68,4,90,248,136,188,7,252,136,232,21,90,248,136,188,7,14,132,141,249,
+190,21,90,248,133,188,7,14,248,129,243,177,21,170,102,247,12,239,5,64,208,
+225,100,236,27,247,79,247,44,247,47,247,83,214,118,207,94,202,31,247,3,231,
+107,177,251,2,46,5,207,71,57,174,47,27,251,80,251,44,251,47,251,82,68,159,
+74,177,80,31,177,171,21,107,191,125,191,197,26,247,59,247,22,247,27,247,52,
+217,208,109,80,197,30,170,101,21,173,89,158,76,76,26,251,58,251,22,251,27,
+251,51,56,65,173,205,81,30,14,152,247,60,247,67,103,29,247,99,211,103,29,
+14,132,247,22,10,14,132,247,22,10,179,251,217,21,247,177,247,177,251,177,
+7,14,248,108,147,22,250,86,211,254,14,250,3,67,6,14,251,180,234,165,29,14,
+49,247,23,165,29,247,50,22,171,203,5,167,196,152,176,165,26,163,122,156,115,
+104,123,98,35,132,30,134,59,5,14,248,129,247,45,22,249,80,248,37,6,251,243,
+247,220,251,241,251,220,5,200,251,242,21,247,220,7,247,180,247,162,247,182,
+251,162,5,251,220,7,14,243,247,146,22,124,247,47,5,73,185,98,226,234,26,191,
+152,199,162,188,30,201,169,188,175,196,27,194,188,103,77,169,31,162,90,152,
+80,86,26,44,98,51,73,94,30,124,251,47,5,247,136,247,45,119,6,94,132,123,121,
+104,27,251,13,6,141,177,5,247,0,185,200,231,247,9,26,207,115,211,96,196,30,
+209,88,71,175,60,27,70,78,111,85,90,31,86,80,106,56,60,26,251,9,201,46,246,
+94,30,141,101,5,251,13,6,104,140,123,156,132,184,8,119,251,45,6,14,248,129,
+248,98,247,134,21,34,101,177,74,223,212,120,251,3,5,219,6,120,247,3,223,66,
+177,204,34,177,244,176,101,204,55,66,158,247,3,5,59,6,158,251,3,55,212,101,
+74,5,14,248,129,247,125,247,108,21,248,98,6,134,33,82,88,251,1,142,8,251,
+183,77,247,172,6,222,174,146,164,177,31,205,183,171,211,241,26,247,0,212,
+29,247,1,141,196,88,144,33,8,252,98,6,14,232,248,164,247,142,21,137,212,134,
+174,125,175,8,219,106,62,187,43,27,251,35,49,35,251,56,251,54,226,41,247,
+37,247,1,213,190,236,169,31,95,6,70,108,82,104,59,27,94,102,151,162,114,31,
+120,155,130,156,127,178,140,244,24,247,192,174,21,251,190,232,6,213,173,177,
+165,211,27,196,178,121,98,174,31,151,125,143,132,146,119,8,14,248,238,248,
+11,21,252,92,247,73,5,251,254,7,14,248,213,247,86,21,247,254,7,252,92,251,
+73,5,14,248,19,248,87,21,158,114,161,120,160,127,195,107,148,133,144,130,
+8,145,128,143,120,118,26,251,124,7,146,122,116,143,120,27,70,77,86,79,104,
+168,117,184,190,187,162,177,170,31,160,166,146,161,141,188,8,248,0,7,140,
+211,106,213,93,167,84,175,109,159,135,143,8,126,153,133,157,162,26,152,95,
+252,128,7,146,123,116,143,121,27,70,79,86,79,104,167,117,183,190,187,162,
+177,168,31,160,166,146,161,141,188,8,142,248,10,21,247,3,79,163,103,143,251,
+8,251,6,200,116,174,135,247,9,8,14,76,29,14,247,52,194,174,29,121,7,113,10,
+252,92,7,76,123,120,87,137,30,116,138,5,65,10,210,247,169,159,21,65,145,124,
+154,206,26,248,90,7,137,179,153,153,187,142,8,247,5,6,242,136,190,104,177,
+45,8,167,6,90,247,67,5,252,173,119,6,213,133,154,124,72,26,252,82,7,72,124,
+124,65,133,30,119,247,174,7,14,247,28,247,217,249,49,21,130,6,251,184,253,
+49,5,248,232,6,251,34,215,21,251,215,6,115,130,143,150,146,143,154,146,154,
+31,247,54,248,10,5,14,243,247,57,29,113,10,252,91,7,75,224,10,248,148,7,196,
+247,59,123,190,10,92,138,133,148,202,26,14,243,248,60,248,253,21,252,54,252,
+253,5,248,186,6,175,247,74,120,141,117,34,90,100,32,144,25,251,123,6,248,
+52,248,253,5,252,131,6,120,251,65,158,137,154,247,4,163,160,247,5,136,25,
+14,247,39,10,176,10,248,91,169,10,251,91,251,187,247,91,169,10,252,91,7,176,
+10,14,247,147,248,70,21,251,90,170,7,186,164,163,189,188,164,115,92,30,170,
+247,90,108,6,91,134,118,119,91,27,90,118,159,187,134,31,217,247,133,21,251,
+86,251,29,251,35,251,94,251,90,247,30,251,37,247,81,247,82,247,30,247,36,
+247,91,247,90,251,30,247,39,251,78,31,130,101,21,183,182,123,109,173,31,201,
+86,173,44,251,12,26,251,4,109,48,86,89,30,111,109,93,122,91,27,251,22,53,
+247,15,247,79,247,82,215,247,4,247,22,31,14,251,66,48,29,247,125,247,213,
+21,247,73,251,79,5,189,88,158,115,124,26,124,124,130,112,138,30,123,138,5,
+121,247,210,157,7,78,140,96,247,4,10,146,147,146,147,145,145,154,154,154,
+155,154,155,148,147,203,209,166,168,206,215,162,154,196,146,153,140,24,171,
+10,154,157,197,140,30,158,140,5,157,251,180,247,54,10,247,180,157,7,116,140,
+85,141,123,158,140,202,25,14,247,110,248,9,247,12,10,130,73,136,25,121,247,
+113,158,127,7,103,116,153,162,147,148,167,147,159,31,247,53,248,17,247,53,
+252,9,5,151,111,144,121,122,26,114,247,14,29,140,113,167,103,228,8,14,248,
+18,245,29,76,123,120,86,137,30,120,138,5,121,247,175,157,7,117,140,86,141,
+123,158,140,202,25,248,92,7,138,202,155,158,192,141,161,140,24,157,251,87,
+7,251,107,252,127,251,116,248,127,5,251,83,121,6,115,10,247,124,157,7,115,
+193,10,248,58,7,14,248,242,22,155,248,195,6,247,40,29,251,123,192,10,251,
+246,7,252,28,248,93,5,251,88,121,6,194,138,152,131,198,78,8,252,107,7,76,
+221,29,247,123,157,7,116,193,10,248,48,7,14,247,28,247,40,247,123,21,157,
+6,137,202,158,161,198,140,8,247,51,6,198,138,158,117,137,76,8,157,247,133,
+121,6,141,82,118,118,82,140,8,251,51,6,82,138,118,160,141,196,8,121,6,86,
+177,21,148,201,164,155,219,138,8,247,116,6,219,140,165,122,147,78,156,141,
+24,129,247,42,5,252,102,6,129,251,42,5,153,252,148,21,248,96,6,180,247,61,
+122,143,110,69,109,119,63,137,25,251,130,6,62,141,110,158,110,210,122,135,
+24,14,79,29,249,84,174,29,253,66,121,6,113,10,252,92,170,10,248,78,7,202,
+155,159,191,141,30,247,51,6,191,137,155,119,76,26,252,78,126,10,14,188,117,
+29,115,10,247,180,157,7,115,140,86,141,123,158,140,202,25,200,29,121,143,
+149,114,31,14,214,248,171,174,29,252,127,6,247,62,251,244,251,62,251,202,
+5,248,127,6,188,247,118,5,108,6,85,251,19,70,91,251,21,141,8,251,7,6,247,
+33,247,173,251,39,247,179,5,247,4,6,247,29,143,205,88,148,251,9,8,170,6,14,
+243,247,54,22,247,179,157,6,117,140,5,85,141,124,158,203,26,127,29,75,124,
+120,85,137,30,117,138,5,14,65,29,14,247,116,247,206,248,226,21,251,62,121,
+251,9,34,251,28,26,251,28,247,11,32,247,60,123,30,127,7,140,82,128,127,81,
+137,116,138,24,121,247,177,244,10,247,60,155,247,11,246,247,28,26,247,28,
+251,8,244,251,63,233,10,251,177,238,10,251,0,161,77,224,247,16,26,247,16,
+203,226,245,160,30,242,138,21,247,0,115,201,55,251,15,26,251,15,75,52,33,
+117,30,14,178,29,118,141,5,113,141,124,150,155,149,29,247,183,157,7,118,141,
+99,143,114,161,78,229,25,251,51,247,125,247,22,247,63,212,233,146,144,192,
+143,25,151,140,5,157,251,115,121,155,7,170,156,127,118,129,134,129,122,117,
+31,137,29,161,136,183,134,163,118,196,56,25,14,247,123,247,118,174,29,192,
+10,251,197,7,95,148,122,148,110,167,99,183,128,175,137,243,138,211,136,162,
+131,162,8,184,124,109,161,93,27,115,115,134,130,115,31,146,118,5,144,150,
+145,140,147,27,168,144,127,72,142,31,144,251,53,145,116,193,70,187,85,194,
+114,220,132,8,251,11,171,29,247,11,7,204,145,177,152,184,172,211,199,164,
+196,140,247,9,143,235,139,139,142,148,8,158,143,150,147,157,27,147,144,138,
+134,150,31,147,160,5,148,114,116,144,115,27,96,110,120,100,123,31,128,114,
+136,116,138,60,140,251,32,95,69,39,119,8,247,197,247,6,10,14,247,128,247,
+194,247,34,21,96,155,117,154,117,167,8,104,186,120,204,216,26,221,161,207,
+181,185,30,175,172,189,158,203,27,202,189,120,103,172,31,181,93,161,72,55,
+26,62,120,75,104,92,30,117,111,117,124,96,123,124,251,34,24,247,187,247,55,
+123,6,89,127,127,129,91,27,251,40,153,6,193,155,176,156,170,164,8,197,187,
+176,221,222,26,219,103,219,78,191,30,188,82,57,165,44,27,45,57,113,90,82,
+31,78,87,103,59,59,26,63,170,62,190,91,30,172,108,178,118,202,121,8,125,251,
+40,7,91,128,149,189,127,31,122,251,55,247,187,6,14,156,248,155,248,89,60,
+29,141,247,49,189,21,96,179,167,125,183,27,247,0,225,243,247,22,232,98,211,
+64,177,31,197,179,164,179,188,26,205,85,183,58,64,78,108,81,99,30,107,92,
+130,98,33,26,252,201,218,7,248,219,4,217,145,186,152,170,30,186,159,176,166,
+181,27,189,175,101,87,100,129,117,102,96,31,143,122,129,141,126,27,95,108,
+123,115,125,154,127,157,161,162,147,159,176,31,188,84,158,85,59,26,251,3,
+86,60,65,102,115,153,184,102,30,14,74,125,248,25,21,145,149,144,141,147,27,
+165,168,103,63,173,31,184,40,171,47,154,69,8,116,75,132,110,104,26,94,162,
+103,167,172,161,180,200,168,135,168,130,181,30,238,247,90,142,146,148,156,
+153,163,25,150,159,148,157,147,156,8,153,171,147,168,164,26,173,117,164,108,
+112,119,120,114,132,141,128,143,130,30,154,99,140,135,123,26,108,135,128,
+102,63,30,71,251,34,118,241,85,247,47,102,205,25,174,118,107,176,129,27,138,
+135,137,136,135,31,60,79,5,14,103,248,35,249,10,21,169,40,62,154,80,27,76,
+97,111,97,111,154,118,183,106,31,227,72,5,251,5,119,62,41,251,13,247,9,10,
+247,32,217,113,192,69,201,30,107,167,127,149,62,192,67,190,24,107,161,126,
+153,153,26,153,154,147,165,196,228,111,93,229,30,251,69,251,36,21,222,197,
+44,251,29,251,1,98,76,68,102,103,158,170,118,31,109,183,121,209,209,26,246,
+181,202,210,30,14,52,69,10,14,46,247,14,249,62,21,87,90,5,137,136,137,135,
+136,26,114,197,100,209,117,30,32,251,2,86,251,7,251,17,26,74,156,95,177,103,
+88,29,112,114,137,124,27,72,102,185,220,247,7,175,244,216,247,4,31,138,152,
+148,139,150,27,213,215,180,180,155,120,153,117,96,92,114,85,78,31,77,162,
+105,167,166,26,149,144,149,151,153,30,14,155,247,73,83,10,14,111,247,136,
+249,49,21,81,92,109,77,100,31,96,72,115,49,43,26,54,158,59,174,75,30,73,174,
+192,103,200,27,247,10,231,247,44,247,86,247,81,53,247,33,251,8,31,251,13,
+251,178,21,247,54,147,177,228,201,27,205,183,48,251,52,152,31,141,102,21,
+140,121,139,127,126,26,251,58,96,251,1,72,62,91,247,14,247,88,30,14,251,130,
+86,10,14,136,247,73,248,103,21,70,105,128,134,66,109,146,125,24,150,143,5,
+141,145,145,140,147,27,168,146,126,83,31,251,214,218,247,129,7,247,60,251,
+127,5,131,145,144,135,144,27,142,144,141,142,145,31,236,189,133,154,5,134,
+126,132,137,131,27,125,126,146,152,126,31,123,154,115,166,130,152,251,1,247,
+41,24,222,211,157,153,173,27,145,145,139,138,146,31,137,149,147,138,143,27,
+162,160,163,165,164,119,157,112,91,90,96,251,45,251,14,31,133,131,5,14,117,
+248,90,203,21,132,125,132,137,130,27,107,117,170,223,112,31,45,247,179,113,
+221,120,181,114,168,25,173,112,106,157,108,27,110,119,120,111,111,160,117,
+165,144,147,140,140,146,31,141,147,146,140,143,27,159,159,126,117,151,31,
+150,121,149,112,154,86,251,82,252,73,24,224,6,247,31,247,226,210,251,128,
+5,68,160,158,101,152,27,141,142,140,140,141,31,222,198,5,14,168,248,67,231,
+29,60,251,225,6,91,83,120,129,105,27,89,119,170,217,31,247,174,60,251,35,
+7,137,251,55,136,105,121,251,22,8,124,43,139,139,124,26,107,157,117,165,163,
+155,159,169,150,137,156,135,155,30,120,220,137,156,137,204,8,85,158,169,114,
+186,27,172,174,153,164,166,31,154,152,144,144,169,173,8,122,7,105,142,128,
+155,122,30,129,147,146,134,143,27,141,144,141,142,145,31,242,191,133,153,
+5,131,127,132,136,128,27,108,131,156,204,31,14,84,247,144,247,3,21,50,247,
+174,5,178,127,113,174,123,27,135,135,137,136,135,31,58,77,146,125,5,145,151,
+145,141,148,27,152,152,131,127,145,31,146,126,139,139,157,84,240,251,208,
+24,164,6,247,49,247,202,5,160,180,150,176,166,26,173,119,163,112,112,119,
+117,108,132,140,129,141,131,30,148,104,140,134,124,26,116,131,112,119,98,
+30,14,78,247,44,249,96,21,86,94,5,134,134,135,133,135,26,126,179,117,198,
+121,30,80,100,114,104,92,26,91,163,108,190,119,30,52,74,100,74,60,26,87,159,
+92,174,106,88,29,113,113,137,124,27,74,100,185,217,206,165,198,193,192,31,
+135,161,150,138,156,27,208,199,169,173,157,118,152,110,105,95,120,101,85,
+31,111,165,129,162,174,26,179,153,168,175,172,30,130,178,159,136,168,27,205,
+190,163,170,158,114,153,105,99,94,125,109,83,31,76,162,125,148,157,26,149,
+143,150,147,151,30,14,132,89,10,14,137,248,164,248,84,21,252,35,6,93,128,
+135,117,113,31,55,65,156,119,199,186,169,150,210,138,25,121,251,87,128,91,
+105,108,8,98,101,134,131,113,26,110,156,122,168,199,159,193,247,79,147,30,
+141,173,140,162,148,26,145,224,5,247,98,6,95,97,124,107,138,80,8,251,43,7,
+97,140,130,146,120,30,120,147,156,120,148,27,141,141,140,143,150,31,247,0,
+186,135,160,5,130,112,124,134,135,27,123,121,153,154,135,31,138,144,139,139,
+179,26,247,19,7,138,230,140,149,150,170,8,247,13,6,14,131,247,44,251,74,21,
+247,108,7,107,174,167,127,181,27,247,7,226,242,247,28,247,32,60,231,251,11,
+77,84,114,95,106,31,112,102,128,89,46,26,252,30,7,218,248,102,21,184,144,
+166,153,162,30,169,155,168,156,172,27,214,186,60,251,21,251,9,93,65,67,103,
+112,153,176,101,31,14,171,248,172,248,95,21,251,137,6,70,124,137,124,105,
+31,55,103,83,49,40,247,9,10,247,31,189,124,188,114,173,30,124,159,125,151,
+107,159,247,56,118,24,251,191,165,21,225,196,46,251,34,33,97,76,69,102,103,
+158,170,118,31,109,184,121,208,210,26,244,181,203,208,30,14,34,248,60,231,
+29,251,174,6,76,138,121,133,116,107,84,62,24,180,116,182,200,174,155,226,
+138,25,154,6,106,77,131,107,137,73,8,251,36,7,86,155,95,158,142,139,139,149,
+158,30,247,14,182,5,178,7,127,112,128,136,127,27,112,126,167,197,31,247,26,
+7,141,199,144,161,156,161,8,247,42,6,14,127,42,29,14,209,247,120,248,97,21,
+251,17,130,63,55,251,20,26,251,31,221,49,247,31,124,30,251,89,206,247,89,
+7,206,146,175,152,177,167,8,199,184,174,212,220,26,202,119,191,99,181,30,
+178,102,93,161,92,27,101,105,122,110,119,31,123,117,134,110,76,26,251,170,
+7,106,149,125,146,122,154,8,95,177,117,202,228,26,222,159,197,179,173,30,
+152,149,151,145,164,146,8,226,251,28,21,187,140,154,146,151,30,154,146,152,
+147,156,27,200,189,55,38,61,116,84,92,106,31,116,123,120,132,95,131,8,14,
+76,247,151,247,40,21,247,75,247,195,5,49,6,251,19,251,115,111,211,5,240,100,
+83,196,79,27,109,118,120,113,114,162,119,167,31,201,143,161,121,172,63,178,
+45,24,251,108,251,255,5,230,6,247,49,247,173,186,251,15,5,36,179,174,77,158,
+27,142,143,140,142,144,31,218,187,133,154,5,134,126,131,137,129,27,114,117,
+152,165,121,31,118,168,130,158,108,220,8,14,247,11,247,186,231,29,252,20,
+7,49,147,104,179,143,228,8,247,70,7,169,137,149,130,153,30,153,130,129,147,
+133,27,137,134,137,136,133,31,38,88,145,126,5,147,152,146,141,150,27,170,
+148,122,76,31,251,27,7,136,251,6,207,73,247,21,129,8,251,64,214,247,62,7,
+247,19,168,213,240,247,36,26,247,0,101,223,89,115,118,119,116,123,147,124,
+158,121,30,176,104,139,139,149,123,8,152,118,145,113,108,26,83,118,88,104,
+110,30,113,117,113,130,86,132,8,248,24,7,14,247,43,247,73,248,98,21,57,79,
+96,51,36,26,251,17,201,46,223,193,185,175,208,171,30,69,171,178,104,187,27,
+223,204,245,247,29,247,26,90,231,68,114,121,121,114,120,151,121,155,132,31,
+189,120,144,136,154,116,8,157,113,149,98,96,26,47,90,70,72,96,110,162,193,
+114,30,157,192,146,173,181,26,189,125,167,115,111,123,108,85,94,146,106,157,
+93,30,87,113,109,115,104,27,81,105,204,247,4,223,160,209,181,199,31,14,251,
+3,247,204,217,21,129,130,138,136,111,31,137,121,120,138,129,27,62,96,190,
+231,197,154,185,169,171,31,169,166,180,160,172,27,153,153,135,128,160,31,
+125,166,148,136,155,27,165,157,157,163,171,107,159,88,251,41,251,13,251,18,
+251,46,79,157,90,173,105,31,109,169,179,126,198,27,153,152,140,140,152,31,
+142,165,161,141,144,27,162,152,127,120,105,112,110,109,130,133,140,144,125,
+31,143,127,131,141,132,27,115,123,125,117,114,162,122,175,207,204,213,218,
+191,113,168,92,31,14,127,248,143,248,26,21,126,6,100,138,5,125,6,136,209,
+130,182,118,185,8,217,102,72,186,63,27,45,59,68,55,78,179,89,215,103,31,188,
+116,189,127,235,126,8,251,87,136,100,51,55,27,81,102,181,203,31,247,5,7,169,
+137,151,130,152,30,155,130,132,146,132,27,136,136,138,137,135,31,35,85,146,
+125,5,147,151,147,141,150,27,169,149,120,82,31,63,7,61,195,86,222,247,27,
+229,247,20,247,90,143,30,151,6,178,140,5,153,6,251,35,212,21,72,148,96,149,
+99,154,8,73,165,104,177,187,26,189,183,180,195,187,181,111,88,165,30,160,
+101,148,97,144,61,8,14,158,247,197,124,21,247,10,150,224,245,247,27,26,247,
+29,56,233,251,17,144,30,141,165,141,158,144,165,8,149,196,140,143,156,26,
+178,116,164,104,105,116,114,100,125,140,135,145,105,30,146,102,142,110,141,
+108,8,251,14,128,54,36,251,29,26,251,30,218,45,247,15,133,30,137,251,61,5,
+228,6,52,247,87,21,70,149,92,228,247,12,26,247,4,189,230,209,155,30,217,140,
+21,212,126,187,51,251,14,26,251,5,94,56,67,119,30,14,247,43,247,6,231,29,
+99,95,184,148,150,140,200,141,25,55,94,104,75,32,26,251,14,196,52,220,187,
+175,170,203,165,30,75,167,178,108,191,27,187,174,161,183,165,31,164,182,152,
+192,195,26,247,3,84,216,37,170,30,155,85,101,143,251,5,27,227,251,213,21,
+89,119,117,118,109,27,85,108,196,239,236,163,204,190,180,31,246,138,194,124,
+183,99,8,182,101,163,75,66,26,55,112,92,91,92,104,176,188,154,143,169,141,
+147,30,148,167,140,141,152,26,158,126,156,124,119,127,112,93,117,139,136,
+149,92,30,14,251,130,86,29,251,6,248,138,85,29,247,44,22,215,29,167,168,247,
+43,29,127,42,29,247,37,247,118,85,29,247,44,22,215,29,168,167,247,43,29,251,
+66,247,46,248,139,21,165,6,149,179,5,152,192,140,142,159,247,36,10,140,133,
+152,88,30,14,251,66,247,46,248,229,82,29,76,29,251,180,247,121,21,168,6,149,
+183,5,154,195,140,146,159,26,175,125,158,113,112,125,120,102,119,140,134,
+153,82,30,14,247,79,164,61,29,247,188,251,94,21,247,59,240,10,141,66,117,
+111,83,141,8,251,59,247,141,247,45,6,243,141,171,115,151,49,156,140,24,129,
+247,42,5,252,140,121,6,223,10,252,91,7,75,221,29,248,150,7,196,247,59,122,
+190,10,91,138,133,148,202,26,14,247,193,161,61,29,247,190,251,108,21,247,
+188,251,103,6,177,29,248,91,170,29,251,91,251,188,247,91,170,29,252,91,7,
+177,29,14,43,163,61,29,239,247,5,98,29,14,161,61,29,248,0,247,30,201,29,210,
+169,201,200,102,29,247,128,168,61,29,249,105,251,255,21,122,142,110,63,111,
+118,65,137,25,35,6,247,23,196,218,247,2,247,18,26,247,62,251,29,247,26,251,
+66,251,65,251,30,251,27,251,60,57,171,65,200,80,30,177,102,175,114,181,122,
+8,36,6,64,141,111,160,110,215,122,136,24,177,251,60,5,247,145,213,6,101,158,
+120,156,114,180,8,104,194,121,210,221,26,247,51,221,247,4,247,8,247,8,221,
+251,3,251,50,251,31,87,251,2,56,101,30,65,247,145,7,14,247,201,188,61,29,
+248,22,251,141,21,251,71,7,76,123,120,86,159,29,188,225,174,196,29,126,134,
+125,142,29,188,132,163,119,181,66,25,14,251,66,162,249,24,98,29,190,247,51,
+85,29,247,77,190,29,65,29,247,48,247,171,85,29,247,78,190,29,156,247,112,
+248,139,21,165,6,149,179,5,152,235,29,140,135,153,86,30,247,200,49,60,29,
+52,69,10,251,31,247,25,21,166,6,148,179,5,152,190,140,145,158,26,171,126,
+157,115,116,247,24,10,155,247,69,83,10,210,247,16,247,28,10,235,29,139,136,
+153,85,30,14,251,130,86,10,86,248,5,247,28,10,191,140,144,158,26,172,126,
+156,115,114,127,122,106,124,141,126,144,118,30,146,112,5,14,132,89,10,133,
+216,247,8,29,171,126,157,115,116,126,122,106,119,140,136,152,86,30,14,247,
+43,247,73,248,99,21,58,79,95,51,35,26,251,17,201,46,223,193,185,176,208,171,
+30,68,171,178,104,187,27,223,204,246,247,29,247,26,90,232,68,114,121,121,
+114,119,151,121,155,133,31,189,120,144,136,154,116,8,157,112,149,98,96,26,
+46,90,70,72,96,110,162,194,114,30,157,191,146,174,182,26,189,125,167,115,
+111,123,107,85,94,146,106,157,92,30,87,113,109,115,103,27,82,105,204,247,
+5,223,160,210,181,198,31,247,11,192,247,8,29,172,126,156,116,115,247,24,10,
+127,42,29,247,99,232,247,28,10,192,140,143,247,21,10,140,132,152,89,30,14,
+251,130,86,29,88,248,95,82,29,127,42,29,247,100,247,75,21,164,6,151,177,5,
+147,165,142,153,153,26,171,127,155,115,118,125,121,113,126,143,119,147,114,
+30,88,90,21,114,119,120,114,115,158,119,164,142,10,167,29,115,154,160,140,
+31,148,146,162,149,164,30,246,10,125,26,114,179,10,241,247,133,244,251,133,
+5,14,206,150,174,29,121,7,213,155,124,68,140,31,252,91,147,10,247,130,247,
+11,7,243,141,171,116,150,53,156,141,24,129,247,42,5,251,165,251,215,182,10,
+14,247,52,194,174,29,121,7,213,155,124,69,140,31,252,92,7,69,138,123,124,
+65,27,65,10,210,247,120,105,29,14,247,67,247,5,174,29,121,7,161,138,5,195,
+138,152,120,62,26,251,100,115,251,65,101,73,30,93,112,108,116,103,27,106,
+6,132,251,84,5,157,6,159,247,11,189,183,247,7,138,8,247,125,6,247,13,140,
+185,100,162,251,16,8,157,6,132,247,84,5,64,124,154,211,138,31,248,78,247,
+6,10,251,88,94,21,252,208,251,182,7,187,189,159,195,153,247,16,8,147,213,
+143,224,247,13,26,201,7,14,243,247,57,29,213,155,124,69,140,31,252,91,7,68,
+138,123,124,65,27,121,248,148,7,196,247,59,123,190,10,91,134,147,202,31,14,
+248,25,97,10,247,145,157,7,91,140,104,166,71,225,251,74,247,128,24,189,205,
+183,198,177,190,53,10,133,184,248,123,21,103,10,161,95,152,121,164,117,25,
+97,184,194,118,206,27,247,27,235,218,247,3,194,117,188,99,170,31,112,10,14,
+71,29,14,247,52,52,29,14,247,63,247,15,174,29,121,7,213,155,124,69,140,31,
+251,125,7,251,59,111,46,89,129,132,142,152,121,30,152,122,126,144,125,27,
+113,119,117,111,103,170,116,188,202,182,170,206,167,31,163,196,146,191,247,
+18,26,247,185,247,83,252,150,7,69,123,124,64,30,247,24,29,248,91,7,210,140,
+155,154,213,27,157,7,14,248,18,245,29,70,138,124,123,67,27,121,247,175,146,
+10,251,87,7,251,107,252,127,251,116,248,127,5,251,83,121,6,147,29,247,124,
+157,7,63,123,153,210,31,248,58,7,14,211,10,247,178,157,7,65,123,154,210,31,
+248,91,89,29,79,29,151,174,29,157,10,248,151,7,247,197,138,5,252,150,7,69,
+138,124,124,65,27,121,247,177,146,10,7,14,188,117,29,165,10,200,29,124,142,
+150,111,31,14,247,52,248,253,247,47,21,59,78,67,101,48,27,251,37,46,247,5,
+247,70,247,76,232,247,12,247,34,199,195,116,96,182,31,174,104,156,102,147,
+161,29,88,27,251,85,247,7,29,247,76,244,237,195,234,203,31,14,243,247,54,
+22,247,179,157,6,64,123,154,210,31,127,29,68,123,124,64,30,14,247,93,60,10,
+14,247,175,247,234,248,226,21,251,80,121,251,21,34,251,28,26,251,28,247,24,
+32,247,77,123,30,127,7,140,82,127,127,82,137,116,138,24,121,247,179,244,10,
+247,78,155,247,23,246,247,28,26,247,28,251,20,244,251,81,233,10,251,179,238,
+10,97,146,114,148,111,156,8,73,179,100,212,224,26,247,16,214,226,247,17,160,
+30,244,138,21,247,19,115,212,55,251,15,26,251,15,64,52,251,17,117,30,14,92,
+29,247,183,157,7,80,141,120,155,70,239,251,51,247,125,24,79,10,249,93,251,
+54,21,131,247,84,5,65,123,154,211,31,248,78,100,10,248,136,247,25,29,247,
+35,248,92,247,220,21,93,29,247,178,157,7,204,10,181,10,14,248,138,249,183,
+184,21,251,138,248,150,6,104,10,250,112,157,7,204,10,213,155,124,69,140,31,
+14,248,138,250,124,251,54,21,132,247,84,68,138,126,150,137,198,25,248,96,
+7,209,155,154,247,1,10,252,150,251,138,248,150,7,104,10,249,168,247,25,29,
+206,247,193,78,29,14,248,1,247,206,78,29,247,225,248,231,21,181,10,252,92,
+208,10,248,92,221,10,7,14,247,91,247,112,248,253,21,252,150,7,68,138,124,
+125,64,27,247,14,10,45,209,251,59,108,119,138,134,109,31,247,72,175,29,247,
+60,251,170,21,144,166,158,141,159,27,235,203,75,44,50,76,78,49,117,123,142,
+148,104,31,14,247,45,248,145,247,207,21,251,66,132,50,35,251,34,27,47,67,
+177,219,79,31,122,128,5,44,202,238,83,244,27,247,76,247,41,247,43,247,79,
+247,81,251,45,247,41,251,85,89,89,129,121,99,31,120,100,138,139,129,27,122,
+130,151,167,134,31,119,6,132,251,115,158,137,145,191,154,172,168,173,25,187,
+182,200,167,203,27,247,27,227,36,251,61,151,31,251,112,6,83,138,118,166,141,
+212,8,121,251,133,157,6,137,209,158,165,198,140,8,14,248,157,247,120,247,
+252,21,121,29,247,103,247,11,7,251,82,148,247,23,251,24,247,71,27,247,72,
+247,26,247,36,247,86,247,87,251,28,247,35,251,75,251,62,251,20,251,18,251,
+75,123,31,247,205,247,162,21,247,13,222,251,13,251,69,251,73,58,184,10,247,
+52,248,77,247,203,21,251,99,7,138,69,124,124,67,138,8,121,247,176,157,7,64,
+123,154,210,31,248,90,7,210,140,154,154,214,27,157,251,168,7,79,110,136,131,
+112,31,65,118,91,77,64,26,92,160,93,174,107,30,165,116,161,128,189,125,251,
+45,251,93,24,66,46,128,131,79,140,8,120,247,65,7,247,128,247,203,5,191,174,
+21,121,6,251,6,70,192,226,219,196,194,223,159,152,137,130,166,31,14,82,154,
+247,50,29,247,198,157,7,49,120,153,209,138,31,248,151,247,138,247,66,121,
+7,117,41,98,109,251,4,138,8,14,247,137,247,214,248,250,21,247,29,6,224,140,
+173,108,142,55,158,141,24,130,247,52,5,252,177,173,29,175,252,146,6,68,123,
+124,64,30,121,247,88,247,201,7,163,199,164,145,177,27,231,181,83,251,15,44,
+112,82,92,117,128,149,159,144,139,141,140,145,31,140,143,139,142,142,26,162,
+121,156,114,110,119,118,109,94,183,112,211,196,183,156,173,172,30,179,179,
+162,198,198,26,247,10,50,216,251,27,86,100,130,114,82,30,14,247,45,248,101,
+247,110,21,247,133,121,7,140,66,119,112,82,140,8,251,111,6,247,60,149,229,
+243,247,26,27,199,195,116,96,182,31,174,104,157,102,146,161,29,89,27,251,
+86,247,7,29,247,75,247,3,229,189,240,206,31,122,150,5,59,79,66,101,48,27,
+53,68,180,213,98,31,113,184,128,186,136,210,8,247,112,6,198,138,158,114,137,
+68,8,14,188,244,22,159,146,147,146,155,27,148,152,136,134,154,31,113,221,
+139,139,178,27,247,6,221,215,246,216,92,201,37,198,31,62,183,5,76,175,105,
+180,179,26,191,183,177,199,177,172,126,114,163,30,165,113,155,105,162,64,
+8,157,247,102,119,6,122,131,131,132,127,27,130,136,140,152,99,31,152,100,
+117,143,109,27,34,68,69,37,68,177,88,231,85,31,217,95,161,126,162,121,158,
+120,25,167,110,150,115,108,26,79,89,92,74,87,87,168,187,108,30,118,170,130,
+165,132,193,8,119,251,116,6,14,251,66,48,29,251,66,48,29,251,66,48,29,251,
+10,219,150,29,110,27,110,118,120,112,95,182,109,201,242,205,217,247,14,31,
+248,2,214,29,159,140,5,157,251,179,7,14,248,1,231,174,29,121,7,181,10,251,
+125,7,32,132,76,121,97,30,108,126,120,121,119,27,131,129,143,145,130,31,159,
+112,129,143,123,27,113,119,118,110,104,170,116,186,202,185,173,207,168,31,
+160,190,147,199,247,12,26,247,185,247,83,252,150,7,68,123,125,64,30,247,14,
+10,44,209,251,58,108,120,138,134,108,31,247,72,7,209,140,155,154,213,27,157,
+7,48,251,215,21,144,164,160,141,159,27,234,203,75,44,51,77,77,50,115,119,
+142,148,109,31,14,248,1,248,76,247,207,21,251,104,7,138,97,135,122,124,126,
+134,135,137,138,129,135,8,136,124,133,138,114,27,138,121,247,156,6,247,42,
+222,204,247,11,219,97,192,55,166,31,153,96,113,141,251,13,27,247,92,7,209,
+154,153,207,30,157,251,156,121,7,207,155,124,69,31,251,91,251,145,247,91,
+7,210,154,153,207,30,157,251,156,121,7,208,153,124,69,140,31,252,92,7,68,
+138,125,125,70,27,121,247,156,157,7,70,125,153,210,31,247,104,7,247,242,22,
+228,145,138,127,172,31,187,122,171,90,81,26,57,80,80,58,117,119,142,148,113,
+30,14,247,126,247,71,248,250,21,252,146,7,68,123,124,64,30,121,247,178,157,
+7,65,123,154,210,31,247,84,7,180,217,155,144,194,27,233,164,110,32,31,36,
+7,69,138,124,124,65,27,121,247,178,157,7,64,124,153,210,138,31,242,7,198,
+134,161,120,169,30,183,111,84,160,51,27,72,94,130,113,73,31,247,159,247,56,
+7,223,140,173,108,142,55,159,141,24,129,247,52,5,252,203,173,29,14,249,88,
+22,157,7,65,123,154,209,31,248,92,100,10,247,99,7,221,146,183,77,145,251,
+24,8,156,6,145,247,23,184,202,221,132,8,14,247,2,29,46,171,47,193,81,247,
+21,29,247,32,247,94,238,110,224,84,198,31,208,76,55,175,43,27,247,104,252,
+5,21,135,59,121,69,113,98,8,78,101,81,106,72,27,68,72,179,199,108,31,114,
+190,124,200,135,212,8,138,183,21,142,212,154,201,167,193,8,199,170,206,179,
+208,27,208,206,99,79,170,31,167,85,154,77,142,66,8,14,248,25,97,10,201,7,
+247,14,179,103,251,18,162,31,157,6,132,247,84,5,69,130,144,234,60,31,251,
+72,247,130,189,205,183,198,177,190,25,53,10,136,29,155,151,84,10,14,173,247,
+192,21,143,80,146,111,159,97,8,251,9,195,247,1,71,247,23,27,247,85,247,26,
+247,34,247,94,247,94,251,28,247,36,251,83,58,60,110,86,79,31,95,101,119,105,
+112,59,213,128,24,163,213,162,182,167,167,8,180,182,196,162,196,27,190,185,
+122,106,175,31,191,93,172,37,251,3,26,121,139,139,138,126,30,135,96,21,251,
+41,121,63,53,251,5,27,251,6,64,223,247,43,117,31,14,247,55,247,106,247,226,
+21,156,214,168,143,174,27,232,175,102,40,31,251,8,208,10,247,8,7,247,15,78,
+196,251,21,95,125,137,115,251,17,30,247,78,126,29,14,248,83,247,83,174,29,
+251,60,121,6,177,138,166,123,161,103,8,252,105,7,94,133,127,118,130,136,140,
+145,129,30,144,130,133,141,130,27,111,118,120,114,108,164,119,179,210,174,
+187,237,31,248,44,7,248,38,252,186,5,158,248,207,6,164,150,156,156,143,143,
+138,137,143,30,129,167,145,137,154,27,169,158,157,167,169,115,157,99,63,92,
+84,51,31,251,236,7,247,140,247,195,21,59,78,64,39,39,197,68,219,222,199,213,
+240,238,80,211,58,31,131,107,21,193,171,83,46,52,114,93,90,87,106,199,233,
+220,166,186,185,31,42,252,100,21,247,114,201,251,114,6,14,188,247,93,247,
+219,21,247,37,6,221,138,155,125,151,58,8,162,247,124,116,6,107,10,251,77,
+60,98,218,251,99,186,10,14,248,53,247,129,21,205,247,6,29,158,251,111,120,
+7,191,138,156,131,115,26,129,135,128,129,123,243,10,155,151,187,10,154,125,
+238,251,33,247,23,251,84,24,82,251,8,99,247,8,62,186,29,227,247,4,179,7,14,
+243,247,109,67,10,113,10,252,91,7,75,224,10,248,148,7,196,247,59,123,190,
+10,92,138,133,148,202,26,128,249,99,21,113,117,116,112,111,159,117,166,167,
+195,29,247,91,22,113,117,116,112,111,159,117,166,167,247,44,29,248,97,249,
+236,242,10,140,137,134,26,122,107,122,106,104,108,156,157,142,140,143,140,
+144,30,144,154,140,143,147,26,162,121,247,38,29,224,202,180,193,166,119,158,
+111,30,251,139,253,55,72,10,14,210,247,117,105,29,174,248,253,247,15,10,152,
+149,152,155,26,159,125,151,118,123,247,44,10,251,66,162,249,24,21,181,10,
+252,92,7,69,138,124,124,64,27,247,24,29,248,92,7,209,140,154,154,214,27,157,
+251,179,7,182,247,65,57,10,247,52,52,29,247,25,248,252,21,247,46,236,5,159,
+152,149,152,247,47,10,247,93,60,10,247,75,247,86,242,10,139,138,134,26,121,
+108,122,106,105,107,156,157,142,140,143,140,144,30,143,154,140,144,146,26,
+162,122,247,38,29,223,202,180,193,166,120,158,111,30,14,34,10,165,248,249,
+47,10,243,32,10,251,36,249,250,247,51,10,179,120,186,27,223,185,190,245,151,
+31,14,247,61,247,149,248,22,21,134,134,137,137,129,130,130,131,130,131,131,
+131,8,247,105,7,204,154,157,196,140,30,142,147,139,140,148,31,157,251,180,
+121,7,214,154,125,68,140,31,252,91,7,68,225,10,247,110,7,182,94,5,251,68,
+201,247,4,7,215,61,5,189,88,157,114,199,29,251,107,247,115,24,166,7,143,143,
+142,143,203,205,145,146,214,221,25,209,218,164,154,205,144,8,157,251,134,
+121,7,185,137,151,134,120,26,114,91,75,58,56,30,247,21,77,7,14,247,96,247,
+106,184,29,238,7,247,9,184,100,251,15,162,31,157,6,132,247,84,75,138,124,
+148,49,233,25,251,117,247,128,145,146,145,146,147,147,25,73,29,14,247,121,
+211,10,244,7,247,10,138,184,100,161,251,15,8,158,6,131,247,85,50,140,122,
+155,140,224,25,248,63,89,29,247,133,92,29,239,7,247,10,140,184,99,161,251,
+15,8,157,6,132,247,88,71,137,120,153,74,229,25,251,51,247,125,79,10,247,55,
+247,243,247,162,21,144,140,155,141,155,142,155,142,25,148,141,156,142,165,
+144,8,251,77,208,29,248,90,7,210,222,10,214,154,124,68,140,31,251,123,7,87,
+128,115,135,110,136,8,247,141,73,251,141,7,67,149,112,177,141,224,8,247,8,
+7,210,222,10,213,155,124,68,140,31,251,8,7,251,13,199,81,247,19,30,154,251,
+24,205,6,14,247,35,249,31,174,29,251,178,121,6,181,10,251,123,7,93,29,235,
+7,247,6,134,180,102,162,251,13,8,157,6,132,247,88,61,140,126,149,141,198,
+25,248,92,7,209,155,154,213,30,14,243,32,10,251,63,249,99,21,251,38,167,10,
+71,29,54,247,51,154,29,247,56,247,97,248,172,21,252,63,7,138,66,130,130,65,
+131,8,120,247,169,7,206,202,153,161,177,31,191,170,170,195,202,26,224,83,
+202,40,165,30,154,84,91,144,55,27,247,48,247,0,7,188,138,158,125,152,90,8,
+158,6,133,245,5,251,93,6,143,190,156,151,211,141,8,158,251,172,120,7,204,
+134,154,128,141,93,8,136,251,82,7,133,33,5,157,6,153,188,158,153,188,140,
+8,247,92,251,89,21,140,150,150,139,143,27,247,23,207,87,40,89,120,97,103,
+110,31,118,112,97,129,76,27,107,133,145,167,31,14,248,3,249,56,21,251,88,
+251,29,251,33,251,92,251,99,247,25,251,34,247,86,247,84,247,27,247,34,247,
+95,234,109,225,85,198,31,206,78,52,177,50,27,247,99,251,255,21,135,58,121,
+66,112,96,8,79,101,81,105,72,27,68,71,179,199,109,31,114,190,124,200,134,
+213,8,154,182,182,147,172,27,169,153,133,110,171,31,115,165,159,131,166,27,
+179,177,151,174,216,31,252,59,174,21,142,215,154,203,167,193,8,198,169,207,
+180,208,27,208,205,99,79,171,31,168,84,154,76,141,68,8,122,93,112,133,113,
+27,116,119,147,155,120,31,103,170,139,139,135,142,8,150,122,120,145,119,27,
+107,106,129,110,75,31,123,132,126,133,128,134,8,14,247,198,248,81,128,21,
+191,247,61,228,247,190,144,154,166,203,25,173,152,159,161,155,27,146,145,
+134,132,142,31,109,152,152,130,169,27,173,163,166,179,180,110,163,88,76,91,
+101,59,104,31,107,65,119,72,57,251,184,251,74,248,14,24,112,195,125,177,157,
+26,157,154,149,170,141,30,143,151,247,19,10,150,128,185,47,247,150,252,185,
+24,14,133,247,140,130,21,247,21,147,225,215,245,26,194,117,188,99,170,30,
+112,10,134,251,71,5,103,10,181,49,212,88,232,134,25,101,48,146,134,5,142,
+148,147,140,151,27,176,154,129,113,112,166,29,86,128,247,30,10,14,247,175,
+247,114,248,253,21,252,150,7,69,138,124,124,64,27,121,247,181,157,7,62,123,
+154,209,31,247,109,7,247,74,251,78,5,189,87,157,115,199,29,251,120,247,128,
+24,146,146,146,147,145,146,154,154,154,155,154,155,142,140,212,219,163,165,
+209,219,164,154,205,143,8,158,251,134,120,7,185,138,150,134,119,26,103,42,
+251,5,251,29,251,14,30,247,105,175,29,14,247,52,247,235,125,21,156,6,247,
+5,239,185,220,199,31,74,10,162,6,122,10,251,77,245,251,19,247,67,114,30,102,
+51,247,31,10,148,140,150,27,177,154,129,114,111,119,122,104,247,55,10,247,
+35,248,92,242,21,140,80,127,129,61,138,132,251,88,24,157,6,161,247,13,180,
+176,247,6,144,8,235,157,6,204,10,181,10,251,123,7,111,29,14,76,248,61,212,
+21,123,122,124,132,125,27,123,135,149,178,31,247,110,7,237,97,181,40,48,62,
+87,79,113,159,117,162,161,157,158,162,176,139,141,144,152,30,163,148,163,
+153,171,27,168,161,127,119,150,31,148,120,141,126,87,26,118,7,47,105,112,
+127,101,118,8,83,109,112,99,87,26,77,183,91,195,184,178,159,189,195,30,93,
+145,158,115,171,27,178,173,162,185,170,31,251,53,175,21,109,111,113,125,108,
+27,97,110,170,183,194,167,163,247,20,191,31,14,141,247,172,248,197,21,138,
+147,145,139,143,27,216,173,166,210,152,31,126,6,118,132,121,133,82,27,132,
+128,139,140,126,31,116,6,72,87,111,85,103,31,104,84,116,33,251,2,26,56,153,
+72,165,93,30,83,171,199,105,204,27,247,3,227,245,247,25,247,23,59,233,251,
+4,72,91,106,62,96,31,150,215,144,160,151,164,8,199,166,184,171,197,27,126,
+251,31,21,208,186,51,251,24,33,100,71,79,64,92,222,247,26,197,145,172,155,
+170,31,176,159,166,157,175,27,14,104,169,207,10,190,136,143,131,141,46,8,
+251,100,7,138,46,134,131,88,136,8,122,122,247,49,6,247,2,158,141,154,173,
+31,184,159,167,180,185,26,193,109,172,72,161,30,164,150,149,145,151,151,8,
+158,158,151,167,165,26,177,114,175,97,161,30,154,109,114,143,72,27,107,110,
+21,141,153,146,140,149,27,202,180,104,85,83,103,107,77,127,131,140,142,122,
+31,104,4,143,155,147,140,151,27,210,183,102,79,82,96,100,77,123,129,140,144,
+119,31,14,42,247,73,99,29,14,141,248,118,231,29,252,27,122,153,6,181,153,
+116,70,56,126,251,6,124,93,31,94,125,110,116,98,27,112,6,130,251,33,5,156,
+6,148,218,171,172,206,138,8,247,116,6,205,173,105,62,147,31,156,6,130,247,
+33,5,103,6,110,138,135,143,171,26,247,157,7,227,147,153,188,140,30,155,6,
+251,44,252,30,21,251,81,6,179,171,155,242,247,129,26,247,25,6,14,76,248,32,
+83,29,14,247,76,104,29,247,91,156,133,6,103,111,157,189,100,31,251,25,247,
+58,53,29,251,4,192,247,205,21,220,29,102,6,140,146,143,139,145,247,37,29,
+113,112,26,82,95,99,75,84,98,162,194,93,30,121,127,5,61,189,190,108,219,27,
+239,215,196,216,173,125,171,115,161,31,109,29,14,167,61,10,14,118,55,10,14,
+131,207,231,29,122,151,7,194,152,119,52,251,68,118,47,99,132,132,142,145,
+128,31,146,126,130,142,130,27,115,120,120,117,110,163,121,177,233,176,232,
+247,126,156,139,155,138,201,31,247,26,251,182,6,94,29,247,101,7,227,147,153,
+188,140,30,155,156,6,14,247,18,248,97,247,251,21,251,130,247,33,10,247,118,
+156,124,6,89,140,131,154,140,227,8,247,100,7,138,227,147,154,189,140,8,154,
+156,251,37,6,251,38,251,230,251,33,247,230,5,251,52,122,149,6,191,138,157,
+120,138,86,8,251,166,7,140,89,121,121,87,138,8,129,122,247,67,156,130,6,95,
+140,125,156,141,190,8,247,163,7,247,49,251,252,5,154,6,14,167,247,52,247,
+146,21,215,247,46,29,144,130,140,48,8,251,101,7,94,29,236,247,107,42,7,94,
+29,247,101,168,10,132,247,147,248,93,21,78,92,120,94,95,31,94,95,114,76,72,
+26,251,21,231,42,247,14,247,14,236,245,247,25,247,22,50,234,251,14,30,126,
+104,21,219,194,50,251,23,34,220,10,167,153,207,10,190,136,144,131,140,47,
+8,251,101,7,94,29,247,182,247,95,251,182,247,51,29,227,147,153,188,140,30,
+155,156,6,14,132,247,58,164,21,115,178,162,131,172,27,247,4,236,247,3,247,
+22,247,14,64,240,50,89,104,117,73,84,31,233,7,70,106,128,134,66,109,145,125,
+24,149,142,5,142,146,145,140,145,27,168,149,122,87,31,251,250,7,136,101,137,
+111,139,139,137,132,25,116,131,126,131,108,27,121,122,247,119,156,127,6,90,
+140,130,154,138,227,8,247,253,4,191,182,155,150,176,27,210,186,68,251,1,35,
+90,66,68,108,109,154,162,123,31,125,159,136,159,190,26,14,76,248,32,247,73,
+21,70,114,90,101,74,27,55,86,208,247,1,241,184,205,208,177,156,123,97,145,
+31,105,144,156,122,171,27,167,159,157,164,196,71,185,57,251,15,52,41,251,
+30,77,156,86,170,99,31,94,174,194,111,192,27,225,202,201,247,10,175,31,14,
+69,247,151,248,47,21,176,6,204,140,170,111,153,66,8,154,6,127,247,31,5,252,
+16,6,126,251,31,5,155,6,152,214,168,163,219,140,8,165,251,182,6,94,29,14,
+132,59,10,14,247,33,248,71,251,52,21,156,126,7,90,140,130,155,138,226,8,185,
+7,129,173,159,135,157,27,238,224,247,2,247,21,247,21,65,233,38,119,124,137,
+131,93,31,247,115,7,71,105,128,134,66,110,145,124,24,145,154,146,140,149,
+27,149,151,134,133,144,31,147,128,140,132,100,26,55,7,151,90,125,141,119,
+27,48,56,251,3,251,15,251,19,218,39,240,157,167,143,147,170,31,95,7,137,101,
+137,112,139,137,136,133,25,116,131,126,131,108,27,121,122,6,247,47,248,199,
+21,154,162,150,143,159,27,209,182,54,251,27,251,1,103,74,80,115,122,146,162,
+108,31,61,127,21,126,117,125,134,119,27,71,95,219,247,16,247,14,173,207,201,
+164,156,131,113,169,31,14,132,247,208,247,213,21,207,239,148,147,187,144,
+8,66,29,247,98,156,132,6,95,141,124,157,251,32,247,118,8,14,167,248,158,251,
+3,21,129,247,33,5,138,133,133,139,137,27,95,132,154,227,31,247,89,247,46,
+10,144,130,140,47,8,251,182,251,94,247,182,7,161,10,131,88,136,8,122,122,
+248,20,6,209,136,168,110,148,60,8,14,247,155,249,136,251,3,21,131,247,32,
+5,127,6,90,141,131,148,200,26,247,117,71,10,248,234,6,223,142,172,110,149,
+54,8,14,149,247,205,231,29,216,10,166,251,182,6,137,47,134,130,89,136,8,121,
+122,247,116,6,247,8,211,189,221,216,64,190,251,5,119,124,138,136,104,31,213,
+7,227,146,153,189,140,30,155,6,66,251,97,21,141,156,147,139,152,27,222,247,
+0,29,14,247,57,160,75,10,248,114,116,21,123,6,90,140,131,153,228,26,247,100,
+7,228,147,152,188,141,149,10,6,14,88,159,75,10,14,61,168,247,191,21,155,6,
+224,156,187,185,214,27,223,184,80,251,8,143,31,251,80,103,247,80,6,138,86,
+133,112,120,107,8,93,112,98,115,86,27,80,97,162,195,91,31,122,126,5,59,195,
+190,109,216,27,247,17,235,240,247,24,247,28,49,234,251,22,114,119,136,131,
+113,31,127,99,139,139,129,27,129,134,143,151,133,31,127,6,14,247,132,247,
+166,247,110,21,251,23,142,228,45,247,13,27,247,15,236,245,247,26,247,23,50,
+232,251,17,251,3,52,57,251,13,120,31,39,215,6,80,10,140,131,154,227,26,236,
+7,247,199,247,96,21,219,194,50,251,22,33,220,10,92,247,193,247,13,21,137,
+47,135,130,88,136,8,121,122,247,119,223,29,191,10,251,122,6,89,94,130,124,
+114,31,102,115,119,103,93,26,66,184,102,240,130,30,105,131,123,129,119,111,
+64,251,0,24,125,120,118,127,120,140,8,131,122,247,7,6,247,5,247,54,5,172,
+163,154,149,167,27,143,144,139,138,151,31,166,4,134,116,129,138,122,27,65,
+94,175,198,201,184,179,208,156,151,137,134,165,31,14,251,48,144,207,10,145,
+29,247,183,247,83,247,22,122,7,133,71,121,114,95,141,8,14,115,247,54,249,
+48,21,228,10,154,151,132,126,144,31,142,131,139,138,140,113,8,42,110,236,
+252,23,6,196,10,247,110,7,182,178,171,157,178,27,165,162,126,116,155,31,165,
+103,147,84,251,25,26,251,43,131,73,117,101,30,119,128,125,130,122,27,122,
+126,151,154,140,31,140,156,5,163,140,122,158,114,27,115,124,123,114,100,179,
+109,188,247,1,207,247,27,247,110,247,77,93,223,37,82,99,118,83,89,31,247,
+22,247,47,168,251,47,7,14,61,248,25,231,29,127,6,127,134,133,135,130,27,132,
+128,141,142,128,31,154,93,121,142,107,27,251,19,49,43,251,27,251,24,235,38,
+247,17,216,190,169,219,195,31,122,152,5,83,91,97,116,80,27,90,101,159,178,
+112,31,115,173,131,170,138,197,8,247,80,175,251,80,6,247,8,143,184,198,223,
+27,214,187,94,53,156,31,155,6,14,251,10,220,136,21,150,141,143,142,149,27,
+144,143,138,137,147,31,126,187,154,137,167,27,222,197,191,214,195,106,184,
+68,176,31,89,166,5,86,166,119,162,170,26,172,166,164,177,198,176,100,65,152,
+30,156,247,34,121,6,131,135,135,135,133,27,136,137,139,144,120,31,148,107,
+125,141,118,27,60,83,86,66,104,153,110,169,113,31,157,123,140,138,184,115,
+178,117,24,188,111,162,111,106,26,104,110,114,101,75,98,183,225,121,30,122,
+251,54,6,14,251,121,210,10,142,146,147,140,144,27,168,146,126,83,31,251,90,
+7,94,29,94,248,167,21,110,116,117,111,111,162,116,168,167,162,162,167,166,
+116,162,111,31,14,251,121,247,85,229,29,141,145,147,141,145,27,168,146,126,
+83,31,251,211,7,52,247,32,10,117,124,147,123,27,116,121,121,118,110,173,118,
+185,200,192,169,188,166,31,156,172,143,164,225,26,93,248,222,132,10,14,247,
+112,248,63,247,222,21,227,147,153,188,140,30,155,156,252,34,122,151,6,194,
+152,119,53,251,70,119,48,99,131,133,141,146,127,31,146,125,131,142,131,27,
+114,120,121,116,110,163,121,177,233,176,231,247,128,156,139,149,138,206,31,
+247,26,251,182,6,177,10,247,115,6,247,9,210,189,221,216,64,190,251,5,118,
+125,138,136,104,31,111,4,141,157,147,139,151,27,222,187,101,73,82,95,103,
+69,122,124,141,144,116,31,14,247,108,248,10,247,146,21,251,107,215,6,80,10,
+141,131,153,227,26,236,247,107,42,7,177,10,247,116,6,247,7,211,189,221,216,
+64,190,251,6,120,123,138,136,105,31,213,7,226,147,153,188,141,30,155,156,
+251,118,122,157,6,189,136,144,130,140,48,8,218,37,21,141,156,146,139,154,
+227,29,14,132,247,52,248,173,21,247,23,7,228,10,164,149,126,103,140,31,133,
+42,110,236,252,23,7,196,10,247,108,7,186,189,169,155,173,27,166,166,120,113,
+147,31,145,123,142,111,110,26,251,53,7,51,131,124,91,138,30,128,122,247,104,
+156,129,6,90,140,132,154,227,26,247,53,7,197,134,170,124,169,30,173,123,102,
+161,100,27,87,103,119,74,75,31,247,28,247,47,168,7,14,167,143,22,247,55,6,
+197,138,170,89,142,42,8,157,6,142,238,169,187,197,140,8,247,55,156,123,6,
+90,140,131,153,227,26,247,101,7,228,147,153,188,140,30,155,156,251,119,122,
+157,6,190,136,144,131,140,46,8,251,182,7,137,140,5,251,112,247,181,6,161,
+10,130,88,137,8,122,6,14,132,247,142,248,89,21,251,23,49,45,251,29,251,25,
+232,40,247,18,247,18,235,243,247,28,247,22,47,232,251,20,31,247,22,251,133,
+21,121,7,251,1,94,72,66,66,91,206,247,19,121,30,136,175,21,138,150,139,145,
+146,26,231,186,200,210,211,193,71,251,1,152,30,14,135,247,224,247,13,21,247,
+28,29,108,122,247,132,223,29,75,29,14,247,155,249,134,22,156,123,7,90,140,
+131,153,227,26,247,98,71,10,6,14,247,76,104,29,176,6,238,166,118,41,165,31,
+158,247,40,6,76,140,126,145,97,188,251,25,247,58,24,53,29,104,247,97,187,
+21,251,49,247,17,10,154,7,82,144,130,149,137,209,8,247,62,7,247,1,247,174,
+166,211,146,149,170,146,216,29,126,134,120,125,102,30,59,251,108,55,247,112,
+5,123,180,136,149,233,29,153,138,173,135,140,136,192,251,27,25,14,76,187,
+247,157,21,212,174,187,177,196,27,219,196,59,251,9,141,31,251,171,6,251,7,
+141,202,68,238,27,247,1,220,238,247,25,247,24,60,239,34,85,88,112,92,104,
+31,121,114,127,110,121,83,8,247,188,251,25,21,73,131,106,101,88,27,89,108,
+177,205,137,31,14,132,248,123,154,21,85,148,135,145,137,209,8,247,89,7,242,
+98,192,57,80,97,115,80,93,30,247,192,7,134,142,103,127,113,130,86,124,25,
+112,131,5,124,7,140,143,143,139,145,27,180,147,130,97,31,252,100,7,138,68,
+133,132,247,0,10,208,8,247,130,7,184,181,169,156,178,27,189,164,103,71,31,
+251,88,7,137,70,130,128,82,134,8,124,247,104,7,14,42,247,73,247,129,21,247,
+66,221,7,207,172,110,68,149,31,157,6,122,247,31,5,251,239,122,156,6,190,136,
+144,131,140,46,8,47,61,106,217,55,7,138,47,134,131,88,136,8,122,122,247,117,
+156,124,6,90,140,131,154,226,26,223,244,172,7,14,104,247,169,134,21,185,7,
+247,2,247,194,163,208,150,154,168,144,216,29,125,137,132,122,91,30,58,251,
+128,55,247,132,5,122,185,138,144,233,29,154,138,171,136,146,129,188,251,21,
+25,231,251,154,5,106,42,100,236,74,247,17,10,153,7,81,145,130,149,138,209,
+8,204,242,178,7,14,76,248,30,83,29,251,37,247,208,132,10,247,45,189,10,167,
+248,5,249,5,21,120,125,124,119,133,140,136,142,127,31,141,132,140,132,136,
+26,121,105,123,99,96,106,156,162,143,140,143,141,145,30,142,146,140,143,146,
+26,159,125,154,120,118,124,124,116,247,1,29,66,251,67,64,10,14,42,247,69,
+99,29,247,12,248,149,247,25,10,251,121,210,10,141,146,147,141,144,27,168,
+146,126,83,31,251,90,7,94,29,251,10,248,141,132,10,247,44,189,10,118,55,10,
+247,95,248,148,247,25,10,132,59,10,247,136,247,227,21,120,125,124,119,133,
+140,134,142,129,31,141,131,140,134,135,26,121,105,123,99,96,106,156,162,144,
+140,142,141,145,30,141,145,140,144,146,26,159,126,154,120,118,124,123,117,
+247,1,29,14,76,51,29,186,248,32,47,10,76,248,49,49,10,179,247,247,247,52,
+29,178,120,187,27,222,186,190,245,151,31,14,118,247,102,247,170,21,88,93,
+5,237,7,227,147,153,117,10,235,143,7,186,92,5,251,1,174,212,7,219,59,247,
+5,10,129,122,247,98,156,132,6,119,115,152,164,114,31,251,79,247,72,5,167,
+7,247,41,247,21,217,29,123,131,136,134,126,127,31,54,64,5,227,104,7,14,165,
+164,10,189,6,238,166,117,42,165,31,157,6,140,247,40,5,88,118,145,159,119,
+124,29,236,247,46,10,143,131,141,46,8,251,100,7,137,46,135,131,219,10,14,
+167,247,53,247,146,21,215,7,80,10,140,131,154,227,26,236,247,107,42,7,177,
+10,213,6,238,166,118,41,165,31,157,6,140,247,40,59,142,124,148,142,182,25,
+247,138,168,10,103,247,153,247,155,21,178,197,207,239,148,147,187,144,25,
+66,29,197,6,238,166,117,42,165,31,157,247,40,6,75,121,147,181,111,31,14,135,
+247,161,247,75,21,163,143,148,141,169,146,8,64,7,137,47,135,130,89,136,8,
+108,122,247,131,223,29,247,101,7,226,247,29,29,251,111,122,150,6,189,136,
+143,131,141,47,8,251,1,7,116,133,130,137,108,135,8,247,43,90,251,43,7,95,
+147,119,168,196,26,166,7,226,147,154,188,140,30,148,156,251,111,122,157,6,
+189,136,144,131,140,47,8,112,7,49,135,178,105,244,27,142,40,188,6,14,119,
+248,120,248,69,21,156,251,112,122,150,7,87,10,64,7,247,28,29,108,122,244,
+6,212,133,164,115,162,51,8,157,6,140,247,40,5,98,116,143,147,133,31,134,143,
+136,165,188,26,247,100,7,227,147,154,188,140,30,14,76,248,51,49,10,176,247,
+90,52,10,167,61,10,251,60,196,63,29,175,247,53,248,47,21,251,201,7,137,65,
+130,129,71,136,8,124,247,125,7,247,8,211,189,221,216,64,190,251,4,119,124,
+138,136,103,31,247,47,237,7,175,149,134,118,146,31,154,6,135,204,5,251,54,
+247,123,6,135,141,86,122,102,129,70,122,25,123,145,7,141,153,147,139,151,
+27,168,149,123,94,31,251,6,251,43,7,135,74,5,154,6,160,146,149,144,175,27,
+247,63,251,75,21,141,158,147,139,152,27,220,187,100,74,82,94,103,69,123,127,
+141,144,113,31,14,132,247,143,248,97,21,251,24,49,43,251,31,251,27,232,38,
+247,18,247,18,235,245,247,31,247,23,47,234,251,19,31,247,21,251,160,21,33,
+93,70,67,69,87,209,247,7,124,30,152,161,175,152,151,27,154,149,133,118,158,
+31,122,153,152,132,155,27,164,171,150,161,180,31,251,152,169,21,138,152,139,
+145,153,26,235,186,202,210,211,190,73,251,6,155,30,128,118,116,133,122,27,
+129,128,143,145,132,31,169,104,135,141,122,27,111,109,129,114,90,31,14,221,
+247,209,22,160,214,194,247,86,146,161,164,199,25,164,150,154,156,152,27,144,
+143,135,134,142,31,116,149,148,132,162,27,165,157,160,169,170,117,157,100,
+101,112,123,102,114,31,115,103,127,106,100,251,25,134,122,124,91,123,87,251,
+21,247,180,24,133,152,136,153,149,26,157,151,146,173,142,30,154,251,86,124,
+7,177,136,142,135,189,251,0,247,33,251,212,24,14,251,4,247,89,133,21,234,
+144,207,194,212,26,173,125,171,115,161,30,109,29,156,6,220,29,101,6,141,146,
+142,139,146,247,37,29,114,111,26,82,95,100,75,84,98,161,194,93,30,121,127,
+178,73,191,104,207,133,25,100,45,181,29,151,139,29,105,206,29,192,182,107,
+164,85,129,247,30,10,14,198,247,53,248,47,21,251,182,7,136,75,139,138,137,
+131,8,116,131,125,131,109,27,121,122,247,119,156,123,6,89,141,132,153,227,
+26,234,143,7,247,54,251,54,5,151,126,143,134,132,26,129,134,137,115,30,129,
+122,247,99,156,132,6,118,116,152,164,113,31,251,94,247,87,247,56,247,34,217,
+29,122,131,135,134,127,128,31,251,63,251,45,5,237,7,227,146,152,189,141,30,
+155,156,216,10,14,76,247,125,130,21,216,148,191,183,189,242,97,29,251,14,
+207,52,243,127,30,102,49,181,29,151,27,177,154,129,114,111,166,29,85,129,
+247,30,10,14,119,247,146,169,21,140,251,40,5,157,6,162,227,164,163,212,145,
+8,244,156,108,6,88,142,135,147,137,232,8,75,29,64,7,100,136,107,136,134,30,
+136,130,121,134,101,138,8,14,247,144,248,101,203,21,189,75,5,247,42,157,6,
+103,141,121,149,112,170,80,212,24,198,206,155,157,154,146,167,141,25,153,
+251,39,125,7,167,137,148,134,125,26,132,135,130,130,129,30,122,119,251,3,
+247,28,5,247,11,163,189,185,225,26,207,105,186,70,167,30,155,100,101,144,
+65,27,251,132,121,6,208,132,148,130,140,71,8,252,39,7,138,60,131,129,69,134,
+8,121,247,150,157,7,67,143,128,150,138,207,8,247,76,7,191,141,247,43,251,
+87,91,84,126,126,120,130,119,138,25,125,247,27,153,7,112,129,144,151,144,
+142,144,144,146,31,251,101,248,137,21,166,149,145,184,247,1,194,96,54,93,
+119,100,105,121,30,97,115,106,133,49,137,8,14,248,129,248,140,249,96,21,251,
+96,251,52,251,50,251,95,251,91,247,52,251,51,247,93,247,91,247,52,247,52,
+247,92,247,89,251,52,247,54,251,88,31,164,82,21,247,35,126,247,6,251,6,153,
+251,37,8,251,163,6,247,164,82,21,130,251,34,251,13,251,15,251,34,128,8,247,
+168,7,83,251,168,21,251,39,153,251,5,247,5,125,247,41,8,247,166,6,251,166,
+196,21,153,247,36,247,7,247,6,247,37,153,8,251,164,7,14,248,129,173,137,21,
+146,6,213,6,247,68,205,151,183,204,31,241,208,213,247,54,247,47,26,234,109,
+222,91,177,30,167,103,90,152,74,27,251,43,32,86,46,105,31,125,102,135,115,
+138,73,217,177,24,148,7,138,234,176,183,230,153,61,252,62,24,122,64,114,92,
+109,129,116,140,24,229,22,143,142,194,185,158,182,161,247,19,25,199,247,236,
+5,146,6,142,6,180,150,138,135,152,31,196,118,169,73,38,26,251,102,44,251,
+41,251,30,132,30,247,141,251,153,21,218,6,177,247,98,5,123,178,142,138,161,
+27,247,20,247,1,247,57,247,83,247,0,94,195,54,87,94,117,98,106,31,102,93,
+118,80,115,251,24,8,234,230,21,230,155,176,192,185,27,180,161,97,60,251,42,
+82,251,11,67,110,117,150,165,119,31,14,248,125,248,140,249,96,21,251,94,251,
+53,251,49,251,89,251,92,247,50,251,52,247,91,247,89,247,52,247,52,247,89,
+247,86,251,52,247,55,251,83,31,128,82,21,247,61,247,28,251,24,251,58,251,
+59,251,26,251,27,251,58,251,58,251,26,247,26,247,58,247,55,247,26,247,29,
+247,53,31,14,204,184,146,21,228,6,174,247,2,161,209,180,211,193,200,25,194,
+187,191,176,167,27,151,147,130,125,127,138,136,126,99,31,76,251,104,5,130,
+109,134,113,120,26,108,158,115,164,173,188,177,207,196,30,118,153,130,130,
+138,138,126,124,25,119,122,128,131,129,27,131,132,146,148,143,142,152,145,
+159,31,200,247,99,5,158,203,141,146,161,26,181,114,171,106,87,62,85,58,76,
+30,127,124,127,123,127,123,138,138,134,133,131,130,203,247,107,24,247,53,
+220,159,193,251,59,51,189,247,54,251,62,117,129,112,5,151,6,174,156,129,119,
+129,134,119,127,94,31,123,80,251,6,82,121,90,247,7,194,5,14,247,215,249,123,
+247,59,21,39,92,88,101,51,27,96,103,148,169,64,31,233,247,3,148,158,174,247,
+77,8,247,37,194,239,244,236,26,213,83,193,63,64,71,76,40,108,30,121,81,131,
+95,130,251,8,61,140,88,152,90,172,8,88,174,110,189,193,26,179,157,174,175,
+170,30,175,169,161,149,224,163,129,168,24,251,45,110,65,81,45,26,81,168,80,
+188,95,30,194,91,201,119,242,137,132,251,19,104,38,87,94,8,181,48,75,159,
+91,27,76,99,116,102,85,202,103,234,197,174,149,178,217,31,103,233,192,126,
+185,27,194,194,163,180,176,31,161,163,151,161,158,185,8,251,118,247,150,21,
+142,141,194,140,154,30,143,225,144,170,156,185,8,193,158,180,173,183,27,181,
+171,101,89,93,114,84,99,94,31,108,106,110,120,57,101,8,251,108,251,238,21,
+110,95,100,126,93,27,74,81,164,167,164,173,154,192,170,171,131,124,175,31,
+190,117,139,139,154,133,8,14,241,165,248,125,21,124,7,85,187,101,207,207,
+180,173,196,186,120,154,57,157,30,81,152,124,147,157,26,164,164,157,173,177,
+156,125,102,147,30,182,6,199,137,101,173,74,27,77,98,105,87,96,162,122,211,
+126,31,200,127,157,129,113,26,112,112,120,100,93,113,162,180,138,30,247,118,
+247,81,21,251,188,182,247,162,143,7,199,251,162,5,192,6,199,247,162,5,143,
+251,162,182,247,188,59,6,87,251,147,84,247,147,5,14,240,247,67,248,219,21,
+181,203,187,157,186,27,219,199,74,53,46,79,61,69,106,114,150,158,125,31,159,
+177,142,147,157,26,164,121,158,114,109,118,113,102,94,172,102,202,115,30,
+65,117,106,116,69,58,163,118,24,210,209,178,160,203,27,242,221,51,251,2,33,
+73,51,59,86,95,175,182,157,144,151,154,158,31,101,141,130,143,92,170,8,166,
+96,117,148,112,27,89,93,95,90,115,147,120,162,108,31,166,161,5,124,158,134,
+150,157,26,172,167,167,173,174,171,104,101,121,133,127,120,121,30,176,138,
+146,137,165,122,8,91,212,177,123,183,27,247,7,247,0,247,14,247,21,201,114,
+199,96,184,31,105,174,109,156,78,156,187,159,161,151,164,159,8,182,175,166,
+198,199,26,245,49,228,32,72,82,115,77,53,30,14,247,49,249,44,249,20,21,119,
+168,114,124,5,171,84,131,142,109,27,100,106,126,103,88,31,187,77,121,148,
+103,27,76,77,98,72,101,31,96,66,115,42,45,26,251,10,179,251,3,207,67,30,78,
+197,222,102,217,27,212,216,172,195,194,31,172,172,156,166,166,200,113,150,
+24,107,94,127,124,119,120,8,102,101,85,119,79,27,58,62,175,197,94,31,89,205,
+110,237,245,26,215,153,209,164,191,30,190,163,188,173,187,27,161,152,133,
+114,171,31,142,137,144,135,144,135,8,91,85,127,113,92,26,97,155,102,183,82,
+30,181,84,139,139,144,131,8,159,109,148,114,117,26,123,131,120,127,124,30,
+119,122,123,132,114,27,87,95,185,193,158,143,153,150,159,31,106,154,5,127,
+108,135,124,118,26,64,206,74,215,219,203,206,223,173,128,171,116,171,30,118,
+169,98,189,118,161,8,103,176,131,153,167,26,189,180,178,191,161,155,131,109,
+175,30,140,137,145,135,147,132,8,14,74,224,247,70,21,237,151,197,151,186,
+157,8,228,172,190,191,197,26,201,86,181,61,251,44,251,28,251,29,251,45,251,
+7,211,66,247,5,209,202,165,196,203,30,163,160,147,149,149,26,153,124,153,
+125,130,134,136,130,129,30,85,82,82,112,86,27,94,100,160,172,120,31,129,159,
+134,162,172,26,147,197,21,243,177,217,208,220,27,176,164,119,110,108,119,
+117,88,117,31,82,113,80,124,67,131,8,14,74,211,247,5,21,102,251,5,5,248,10,
+6,176,247,5,5,92,6,165,227,147,181,200,26,247,17,92,202,44,30,251,58,6,95,
+141,129,146,135,171,8,119,114,133,124,111,26,112,148,114,155,124,30,127,151,
+154,135,171,27,247,34,6,237,166,110,251,2,88,135,113,124,86,31,14,251,67,
+227,247,4,21,107,251,4,5,247,33,6,184,235,165,97,141,133,149,91,25,156,157,
+144,159,187,26,172,135,177,130,202,30,129,202,137,162,178,26,160,140,151,
+142,161,30,141,152,140,151,147,26,175,118,156,82,146,30,86,147,121,147,124,
+162,8,123,116,134,125,115,26,116,145,118,151,123,30,154,119,151,133,181,135,
+8,190,134,155,122,89,26,60,133,67,127,93,30,14,247,104,249,91,127,21,252,
+228,248,226,247,95,52,161,184,251,191,247,18,83,85,247,22,251,186,184,159,
+52,247,94,248,228,252,225,5,14,247,104,134,127,21,180,98,248,229,248,225,
+51,251,94,185,119,247,22,247,186,83,193,251,191,251,18,161,94,247,95,226,
+5,14,247,104,134,249,1,21,248,228,252,226,251,95,225,117,95,247,191,251,18,
+195,192,251,22,247,187,93,119,227,251,94,252,229,248,225,5,14,247,104,249,
+91,249,1,21,97,180,252,228,252,225,226,247,94,94,159,251,22,251,187,195,86,
+247,191,247,18,117,183,251,95,53,5,14,248,125,247,51,248,95,21,248,219,247,
+3,10,247,19,5,217,7,251,178,247,19,116,87,247,102,57,5,252,219,6,249,62,251,
+242,21,203,252,219,168,29,248,125,249,221,248,95,21,203,252,219,7,247,102,
+221,116,191,251,178,251,19,5,61,247,18,29,40,251,178,21,248,219,174,10,252,
+219,6,14,247,104,248,224,247,72,21,120,131,86,112,90,113,8,248,23,7,212,99,
+164,127,162,130,154,159,24,38,211,47,220,88,201,88,78,52,63,32,61,154,119,
+24,163,148,164,152,211,178,8,252,23,7,91,165,86,165,119,148,124,118,24,242,
+65,230,59,190,79,191,201,234,223,236,207,8,251,184,248,22,21,165,160,143,
+142,157,149,156,128,145,135,163,120,8,252,102,7,112,118,136,136,122,129,121,
+149,139,140,109,162,8,14,92,248,32,247,92,21,131,47,71,83,40,141,8,251,79,
+85,247,72,6,193,179,147,156,173,31,210,176,179,212,231,26,247,37,51,222,251,
+43,30,251,72,85,247,79,6,239,140,206,84,147,47,8,251,254,84,6,14,248,125,
+247,125,248,206,21,80,248,196,198,7,252,196,251,201,21,80,247,143,251,94,
+198,247,94,247,142,198,251,142,247,94,7,80,140,5,251,95,7,14,247,104,247,
+220,249,129,21,254,124,197,250,124,7,14,247,104,247,144,250,10,21,28,251,
+139,197,28,4,117,7,238,22,28,251,139,197,28,4,117,7,14,248,129,248,169,248,
+149,21,73,6,251,116,252,149,5,219,6,247,69,248,45,247,69,252,45,5,219,6,14,
+248,129,248,169,22,247,116,248,149,5,59,6,251,69,252,45,251,69,248,45,5,59,
+6,247,116,252,149,5,14,248,125,249,138,249,216,21,99,6,251,36,142,58,46,117,
+251,83,100,128,114,128,114,124,8,86,104,105,73,68,26,37,201,70,247,6,112,
+30,128,251,47,78,72,251,17,144,8,103,71,175,6,247,62,142,213,222,152,247,
+91,8,234,149,220,234,241,26,205,102,206,86,171,30,116,153,116,148,101,149,
+154,247,43,201,211,247,0,131,8,179,6,251,179,252,182,21,72,156,98,187,202,
+26,203,176,184,210,163,30,199,138,21,167,131,152,134,152,129,8,170,117,162,
+91,96,26,74,98,92,72,127,30,14,248,125,249,122,249,5,21,103,109,110,103,103,
+168,109,175,176,168,168,176,174,110,169,103,31,252,124,202,29,247,137,252,
+133,21,102,109,110,103,102,168,110,176,175,168,168,176,174,110,169,104,31,
+14,248,125,249,123,249,5,21,101,110,110,103,102,168,110,176,174,169,169,175,
+174,109,169,105,31,252,125,202,29,248,125,252,133,21,101,110,110,103,102,
+168,110,176,175,168,169,175,174,109,169,105,31,252,126,22,103,237,10,103,
+31,14,248,125,249,7,248,74,21,205,247,39,66,140,73,251,40,5,251,227,80,247,
+201,6,104,62,5,251,166,80,247,140,6,102,57,5,251,103,80,247,77,6,74,251,36,
+212,138,204,247,37,5,247,229,198,251,203,6,176,221,5,247,166,198,251,140,
+6,174,216,5,247,105,198,6,14,248,125,249,204,248,220,21,253,35,251,184,5,
+96,7,249,35,251,184,5,215,7,252,173,247,129,248,173,247,130,5,77,4,252,35,
+251,67,248,35,251,68,5,215,7,251,123,239,247,123,238,5,14,248,125,247,61,
+248,220,21,63,7,248,173,251,130,252,173,251,129,5,63,7,249,35,247,184,5,182,
+7,253,35,247,46,21,63,7,247,123,40,251,123,39,5,63,7,248,35,247,68,5,14,248,
+125,248,197,248,247,21,148,93,124,140,61,27,251,134,73,247,134,6,204,155,
+138,133,168,31,251,111,252,118,5,251,25,73,242,6,102,57,5,210,6,176,221,5,
+207,6,247,2,171,144,164,200,31,247,12,190,207,239,247,22,26,247,21,72,239,
+251,15,191,30,182,232,5,67,6,251,102,252,255,21,247,104,248,101,5,237,103,
+190,64,251,1,26,36,98,71,52,98,30,114,86,93,131,43,27,14,248,125,248,138,
+249,76,132,29,247,188,252,26,21,251,48,122,251,19,251,7,251,48,27,251,48,
+251,21,247,8,247,47,123,31,140,198,21,247,46,155,247,20,247,9,247,47,27,247,
+49,247,19,251,6,251,49,156,31,14,248,125,248,138,249,75,21,251,93,152,29,
+251,84,31,251,130,252,185,21,94,196,117,200,209,26,247,58,247,26,247,27,247,
+58,208,203,117,94,196,30,183,96,21,184,82,161,78,67,26,251,57,251,27,251,
+26,251,58,71,75,161,184,82,30,14,248,125,248,134,248,32,21,105,112,113,104,
+106,166,112,172,173,166,166,173,172,112,166,106,31,143,247,192,132,29,130,
+79,21,247,64,247,27,251,24,251,61,251,57,251,27,251,26,251,59,251,59,251,
+27,247,26,247,56,247,57,247,27,247,29,247,54,31,14,248,125,247,73,22,205,
+247,137,248,199,206,252,199,247,137,73,6,14,248,125,249,190,248,193,21,72,
+251,137,252,198,72,248,198,251,137,206,6,14,248,125,248,98,22,205,248,202,
+247,133,206,252,183,72,247,132,6,14,248,125,247,108,248,218,21,247,137,252,
+218,5,207,6,247,143,248,218,5,65,6,251,103,252,128,251,99,248,128,5,67,253,
+107,21,248,196,205,252,196,6,14,248,125,250,124,247,174,21,88,6,251,51,138,
+251,6,106,61,70,38,45,109,52,140,251,89,8,88,201,190,7,141,170,140,247,50,
+173,220,236,215,25,198,184,238,164,247,19,141,8,190,6,14,248,125,136,247,
+174,21,76,190,7,247,7,137,233,118,197,102,8,247,0,67,180,49,251,57,26,141,
+108,5,88,202,190,7,140,247,88,108,227,38,233,61,208,251,5,172,251,51,140,
+8,14,248,125,136,247,111,21,190,6,247,49,247,7,173,208,217,31,240,233,170,
+227,138,247,87,8,190,76,88,7,137,108,138,251,49,105,57,43,64,25,79,94,42,
+114,251,20,137,8,88,6,14,248,125,250,124,247,111,21,202,88,7,251,6,141,43,
+160,82,176,8,251,1,212,98,228,247,56,26,137,170,5,190,77,88,7,138,251,88,
+170,52,239,45,8,70,217,247,8,105,247,49,27,14,247,104,248,234,176,21,251,
+130,248,107,251,130,252,107,5,248,15,198,21,251,175,6,247,35,247,176,5,14,
+247,104,247,18,170,21,248,102,247,133,252,102,247,132,5,201,252,14,21,247,
+173,7,247,179,251,35,5,14,247,104,247,14,248,143,21,247,130,252,107,247,130,
+248,107,5,252,15,80,21,247,175,6,251,35,251,176,5,14,247,104,248,229,170,
+21,248,117,7,252,102,251,132,5,248,40,251,30,21,251,179,247,30,247,179,247,
+35,5,14,248,125,247,133,247,223,21,247,157,251,184,247,153,247,182,251,159,
+247,186,5,14,248,125,247,82,247,225,21,247,202,251,236,247,203,247,236,251,
+203,247,235,5,251,157,251,235,21,247,157,247,184,247,157,251,184,251,157,
+251,185,5,14,130,247,139,248,99,21,35,53,54,37,251,0,223,54,246,243,224,224,
+244,244,54,224,34,31,140,81,21,211,198,80,66,67,80,79,68,63,81,198,215,209,
+200,198,211,31,14,247,102,239,10,247,114,251,48,21,247,175,194,41,249,213,
+237,194,251,175,6,194,254,12,21,249,213,214,253,213,7,248,2,230,10,247,102,
+239,10,247,111,251,48,21,247,175,250,67,251,175,84,237,253,213,41,6,247,45,
+22,249,213,214,253,213,7,247,163,230,10,125,153,248,86,149,247,94,153,6,177,
+10,222,11,164,143,143,144,142,142,143,145,143,143,143,178,12,12,178,143,159,
+144,143,143,142,143,143,143,149,143,12,13,249,102,20,248,143,21,188,19,1,
+17,2,0,1,0,12,0,99,0,107,0,125,0,147,1,11,1,72,1,79,1,124,1,232,2,3,2,7,2,
+88,2,94,2,146,2,159,2,215,2,229,2,233,3,106,3,116,3,239,4,107,4,129,4,159,
+4,169,4,178,5,23,5,130,5,137,5,242,5,248,6,40,6,140,6,165,6,204,7,12,7,105,
+7,195,8,23,8,53,8,96,8,139,8,195,8,244,9,29,9,41,9,85,9,99,9,106,9,174,9,
+242,10,8,10,74,10,133,10,197,11,4,11,64,11,70,11,128,11,151,11,159,11,165,
+11,175,11,230,12,28,12,59,12,112,12,142,12,175,12,179,12,229,12,244,13,24,
+13,50,13,74,13,78,13,86,13,103,13,149,13,194,13,204,13,217,13,226,13,235,
+13,250,14,6,14,15,14,22,14,33,14,48,14,86,14,96,14,99,14,109,14,146,14,154,
+14,183,14,218,14,253,15,1,15,9,15,27,15,33,15,66,15,72,15,82,15,90,15,122,
+15,136,15,166,15,175,15,181,15,190,15,195,15,225,15,237,15,249,16,23,16,28,
+16,57,16,72,16,77,16,87,16,115,16,128,16,148,16,152,16,179,16,194,16,205,
+16,222,16,239,16,251,17,4,17,28,17,40,17,53,17,60,17,85,17,91,17,98,17,117,
+17,141,17,147,17,153,17,176,17,190,17,197,17,204,17,226,17,232,17,252,18,
+17,18,38,18,59,18,80,18,84,18,96,18,104,18,109,18,118,18,127,18,147,18,167,
+18,180,18,192,18,198,18,217,18,236,18,255,19,7,19,12,19,31,19,42,19,48,19,
+55,19,73,19,78,19,89,19,107,19,110,19,118,19,128,19,145,19,162,19,167,19,
+172,19,187,19,197,19,207,19,217,19,227,19,243,20,3,20,19,20,35,20,51,20,65,
+20,80,20,88,20,103,20,118,20,133,20,148,20,163,20,178,20,192,20,206,20,220,
+20,234,20,248,21,6,21,20,21,34,21,48,21,62,21,76,21,85,21,94,21,107,21,112,
+21,117,21,130,21,143,21,156,21,169,21,182,21,195,21,208,21,215,21,220,21,
+232,21,244,22,0,22,12,22,17,22,29,22,41,22,51,22,61,22,71,22,81,22,89,22,
+97,22,103,22,109,22,120,22,131,22,142,22,153,22,164,22,175,22,186,22,197,
+22,208,22,219,22,228,22,237,22,240,22,245,22,250,22,253,23,8,23,15,23,23,
+23,31,23,43,23,53,23,58,23,61,23,69,23,76,248,233,247,61,21,69,29,248,176,
+7,11,247,2,29,45,171,47,193,82,247,21,29,247,31,247,94,238,110,225,84,198,
+31,208,76,55,175,43,27,103,4,185,185,121,107,175,31,193,90,170,45,251,11,
+26,80,127,70,118,87,30,130,114,122,114,116,116,8,104,104,94,121,86,27,93,
+94,157,170,103,31,88,185,106,240,247,3,26,241,167,236,181,186,30,182,178,
+188,161,194,27,11,84,29,247,147,7,239,29,11,248,106,248,24,55,29,251,132,
+252,26,160,29,144,247,232,160,10,11,248,83,249,56,21,74,29,124,177,180,131,
+178,27,247,8,227,218,243,221,141,29,11,249,89,247,246,21,251,147,121,6,217,
+134,147,131,141,63,8,251,54,7,107,79,112,66,251,55,39,247,6,247,78,233,167,
+230,183,188,30,188,182,202,166,207,27,195,189,120,103,177,31,169,110,155,
+113,164,78,8,162,6,131,247,103,5,117,6,119,133,121,126,118,27,129,123,142,
+146,121,31,154,94,92,147,94,27,251,91,251,35,251,39,251,96,41,166,64,195,
+80,31,70,205,236,101,247,2,27,226,247,16,174,174,179,31,247,95,7,141,200,
+150,151,196,143,8,11,247,142,248,96,21,251,23,49,43,251,30,251,28,232,39,
+247,18,247,18,235,244,247,31,247,24,47,233,251,20,31,126,111,21,223,198,43,
+251,29,251,6,94,72,64,100,102,163,179,118,31,111,191,123,209,210,26,234,185,
+201,211,30,11,136,29,156,150,84,10,11,157,22,247,104,154,6,89,142,123,152,
+175,26,247,173,7,247,22,29,251,101,7,137,74,127,123,90,136,8,124,247,100,
+154,7,90,144,128,151,138,188,8,247,121,111,10,11,249,39,158,21,101,142,119,
+149,110,173,251,98,247,145,24,247,19,164,193,189,231,26,182,126,176,113,168,
+30,180,101,55,165,46,27,251,168,120,6,213,131,149,130,140,66,8,252,69,7,138,
+54,130,129,64,133,8,120,247,169,158,7,62,144,127,151,138,212,8,247,89,7,195,
+141,247,130,251,200,5,247,53,6,252,91,248,225,21,167,150,147,179,247,17,197,
+96,45,89,118,97,103,120,30,93,113,104,133,43,137,8,11,249,87,174,29,251,127,
+120,6,101,10,248,78,252,186,5,156,248,162,6,142,243,152,156,218,146,8,11,
+155,108,10,11,144,22,247,132,154,6,72,141,123,153,137,198,8,247,117,7,171,
+181,189,167,145,148,134,129,150,30,124,154,151,134,152,27,163,154,156,167,
+172,118,159,105,97,111,117,67,89,31,231,7,134,141,83,117,103,125,83,121,25,
+123,7,142,153,148,140,151,27,164,148,123,95,31,251,142,7,137,87,133,133,76,
+128,8,11,21,206,172,184,119,29,248,54,247,27,21,121,143,121,45,125,127,43,
+136,25,251,30,6,247,161,248,41,5,154,251,239,7,136,251,10,5,157,6,147,210,
+153,154,201,141,8,247,30,6,251,158,252,41,5,124,248,13,7,11,247,31,29,81,
+27,74,229,10,164,178,247,27,10,248,210,247,68,21,109,32,105,112,251,0,135,
+8,251,149,6,248,68,248,245,5,154,252,162,7,119,251,63,5,165,6,156,240,175,
+168,247,7,142,8,247,113,6,252,73,252,245,5,124,248,200,7,163,247,68,5,11,
+96,10,247,7,234,214,198,247,0,181,30,211,29,11,160,105,10,11,146,22,247,126,
+154,6,119,140,97,142,127,150,138,176,25,247,76,7,247,32,251,79,143,134,142,
+134,142,136,25,147,129,142,133,134,26,130,130,133,127,30,120,124,247,110,
+154,6,95,142,108,158,97,190,251,45,247,86,24,168,166,247,17,247,4,166,155,
+203,137,25,154,251,96,125,7,178,138,150,135,126,26,130,130,126,125,126,30,
+251,29,251,14,5,248,56,7,135,141,100,127,110,130,82,124,25,109,131,5,123,
+7,140,152,148,140,149,27,173,148,126,91,31,252,118,7,138,86,136,136,68,128,
+8,11,139,10,121,130,144,124,27,118,230,29,196,219,157,154,193,143,8,158,251,
+86,120,7,174,138,150,133,123,26,102,65,251,2,36,251,8,30,118,247,94,6,209,
+152,154,198,30,157,251,120,121,7,198,152,124,69,31,251,94,118,7,36,247,8,
+65,247,2,176,26,156,150,144,174,140,30,158,251,86,120,7,193,135,158,124,195,
+59,156,115,190,71,151,124,151,123,151,123,151,124,155,117,24,251,74,251,128,
+70,52,105,113,91,138,25,121,247,145,157,7,105,141,128,145,157,26,154,146,
+151,186,202,30,247,22,247,79,5,14,248,49,249,23,21,199,136,147,135,115,26,
+117,116,109,84,88,30,251,69,251,53,5,247,97,7,140,214,149,148,220,145,8,158,
+251,176,120,7,216,134,150,127,141,66,8,252,69,7,138,54,128,128,61,134,8,120,
+247,174,158,7,62,144,127,150,138,213,8,247,79,7,165,160,245,34,5,216,62,192,
+70,115,26,124,126,133,110,138,30,134,128,139,138,127,31,120,247,197,158,7,
+87,140,125,149,48,236,251,125,247,142,24,247,82,247,80,207,204,155,147,207,
+144,25,158,251,154,7,11,164,10,247,98,156,132,6,119,115,152,164,113,124,29,
+237,7,226,147,154,117,10,11,21,101,122,126,127,116,27,124,120,145,148,166,
+10,151,153,214,10,119,180,154,135,164,27,194,168,169,215,160,31,14,21,247,
+5,29,188,29,166,247,44,29,72,29,116,172,78,116,29,189,11,247,128,155,21,75,
+114,118,112,114,27,133,136,140,146,125,31,145,124,126,143,128,27,111,116,
+117,114,109,167,117,176,174,169,152,166,165,31,163,162,159,177,169,217,247,
+14,247,212,24,166,211,146,149,170,146,149,140,24,247,11,29,126,134,121,125,
+101,30,58,251,109,55,247,113,5,121,186,138,143,150,26,160,151,150,166,138,
+30,147,156,251,88,122,6,154,138,173,134,139,139,193,251,29,25,11,142,174,
+29,121,7,203,138,168,117,185,60,247,91,252,18,24,55,98,126,122,114,27,127,
+130,143,153,120,31,153,119,128,143,122,27,107,117,121,112,103,171,116,190,
+182,179,155,168,168,31,161,161,148,152,171,207,247,74,248,21,24,182,225,177,
+171,202,141,8,157,251,115,121,7,188,152,132,116,132,139,139,130,114,31,131,
+117,251,22,251,175,251,30,247,162,5,125,165,130,166,152,26,160,157,149,177,
+30,152,157,6,11,247,188,248,86,64,10,11,248,73,248,187,21,100,6,82,251,1,
+5,152,104,116,144,105,27,251,21,48,42,251,28,93,151,93,160,101,31,155,112,
+152,124,173,112,66,251,32,24,176,6,204,247,15,5,123,174,162,134,174,27,247,
+19,235,244,247,31,187,125,188,115,176,31,123,163,126,151,108,161,8,107,79,
+21,168,85,150,94,75,26,251,9,95,71,64,105,116,151,169,114,30,118,171,21,112,
+197,127,196,208,26,233,186,201,210,170,11,247,15,10,247,49,29,21,122,156,
+7,176,140,155,123,141,104,251,93,251,160,24,247,106,7,227,147,154,188,140,
+149,10,156,123,6,102,124,152,176,136,31,247,93,247,157,5,251,103,7,94,29,
+191,10,6,11,121,247,93,7,247,48,167,142,161,187,31,203,169,179,199,207,26,
+179,125,176,113,168,30,116,164,117,152,91,156,172,154,154,149,154,155,8,165,
+167,156,181,177,26,195,103,192,80,170,30,163,96,106,144,42,27,93,97,21,142,
+160,148,140,153,27,233,199,87,59,58,85,91,49,122,127,140,144,114,31,88,4,
+144,163,149,140,157,27,241,203,85,51,55,77,82,49,115,126,141,146,110,31,14,
+158,22,247,170,158,6,135,29,248,80,122,29,251,86,251,195,247,86,122,29,252,
+69,193,29,11,247,221,21,247,58,240,10,140,66,118,112,83,140,8,251,58,247,
+141,247,45,6,242,141,171,114,150,50,156,140,24,129,247,42,5,252,138,121,6,
+11,249,23,21,188,10,158,7,60,141,125,153,138,213,8,247,74,241,10,199,171,
+175,200,205,26,181,125,177,112,168,30,183,99,52,167,45,27,251,156,6,247,78,
+68,21,166,146,146,166,247,27,201,92,36,42,80,89,251,7,119,125,140,141,116,
+30,11,248,4,248,81,21,151,92,92,145,93,27,43,64,90,75,102,160,111,189,110,
+31,75,98,117,106,87,26,59,209,82,236,239,209,200,243,159,30,120,142,5,61,
+114,91,98,72,27,72,88,189,207,168,147,160,162,170,31,125,171,168,132,170,
+27,169,158,151,160,159,116,152,104,114,117,134,126,103,31,122,154,132,156,
+161,26,187,175,166,203,183,176,131,120,184,30,11,248,78,205,21,125,122,127,
+134,124,27,116,132,153,183,31,247,87,7,191,134,168,124,163,30,175,117,96,
+158,80,27,45,65,90,76,116,158,119,163,163,160,159,161,143,138,144,138,146,
+31,137,148,138,147,146,26,166,171,161,179,188,166,110,85,30,78,7,251,45,78,
+121,130,96,101,8,117,119,125,105,106,26,76,183,95,200,183,180,160,191,200,
+30,11,7,230,247,29,29,251,105,122,150,6,183,134,143,130,141,49,8,251,181,
+251,68,247,181,7,228,147,153,188,140,30,148,156,251,105,122,150,6,190,136,
+144,130,140,47,8,251,181,251,70,247,181,7,224,146,154,183,143,30,148,156,
+251,105,122,156,6,190,136,144,130,140,47,8,251,101,7,138,47,134,130,88,137,
+8,122,122,11,21,248,14,126,29,145,7,247,187,248,14,5,252,20,7,69,138,123,
+124,65,247,53,29,213,155,125,69,140,31,11,21,193,166,162,167,179,247,10,29,
+197,90,30,78,95,124,119,99,226,10,112,76,21,179,112,153,119,108,26,106,116,
+116,104,98,112,169,186,172,151,162,166,183,29,11,121,157,5,68,66,72,109,56,
+27,76,83,159,177,96,31,84,188,108,229,247,4,26,247,73,232,247,8,247,37,196,
+191,118,100,179,30,171,107,154,111,158,74,8,11,207,10,190,136,144,130,140,
+48,8,251,101,7,177,10,247,116,6,247,8,210,189,221,216,64,190,251,6,120,124,
+138,136,104,31,213,7,227,147,153,188,140,30,155,156,6,66,251,114,21,141,157,
+146,139,153,227,29,11,21,74,198,133,143,134,144,134,144,25,136,141,130,147,
+129,148,134,143,25,110,165,108,169,138,142,8,160,122,119,157,133,27,134,134,
+134,134,126,164,99,168,103,31,172,100,156,118,140,10,14,247,85,248,93,21,
+134,142,77,115,101,126,83,122,25,123,7,144,140,5,141,154,154,140,149,27,162,
+148,122,96,31,252,15,231,10,129,146,160,122,157,29,11,247,114,82,10,137,138,
+133,133,128,130,8,11,247,22,247,63,215,236,144,143,203,142,25,157,251,115,
+121,7,166,143,139,137,146,31,154,135,150,126,125,26,129,134,129,122,117,30,
+137,29,203,134,158,125,203,46,8,14,226,147,154,188,140,247,45,10,251,101,
+247,47,29,11,21,63,111,114,118,91,29,21,170,112,211,77,176,105,200,79,25,
+134,143,141,138,144,27,145,142,142,145,152,98,197,62,237,31,136,143,138,139,
+133,148,164,172,156,160,172,178,8,168,175,164,179,152,26,144,134,144,134,
+133,119,121,118,122,30,138,136,108,109,110,113,132,133,131,132,130,131,11,
+248,103,21,70,105,129,134,65,108,146,125,24,149,143,5,141,146,145,140,147,
+27,168,146,126,82,31,251,212,218,247,235,7,185,192,164,152,175,27,194,154,
+114,48,31,252,101,218,248,98,7,205,135,166,125,169,30,174,124,102,161,98,
+27,90,94,114,80,81,31,11,187,10,153,125,239,251,33,247,23,251,84,24,251,66,
+186,29,247,86,247,6,29,11,135,247,29,5,128,6,131,134,134,136,133,27,133,129,
+141,144,128,31,147,116,116,144,115,27,60,82,87,67,83,171,99,224,91,31,197,
+106,5,174,119,156,115,108,26,95,107,111,88,70,104,177,241,116,30,123,251,
+48,152,6,149,146,143,141,151,27,150,11,247,66,248,103,21,72,106,128,134,70,
+111,144,124,24,146,141,5,141,146,147,140,145,27,167,247,36,29,154,121,30,
+130,148,146,133,143,27,142,143,141,142,145,31,242,193,133,153,5,131,126,132,
+137,128,27,109,131,156,203,31,11,190,136,144,130,140,47,8,251,0,7,130,106,
+109,134,112,27,79,113,168,205,31,166,7,227,146,154,189,140,30,148,156,251,
+111,122,156,6,190,136,144,130,140,47,8,112,7,97,142,121,150,121,30,109,158,
+178,123,196,27,178,174,144,152,191,31,11,159,189,30,146,158,144,156,149,26,
+163,117,161,114,115,117,117,115,129,144,122,146,120,30,159,88,143,115,86,
+26,103,140,124,143,97,156,8,147,120,120,144,129,27,116,122,121,113,111,154,
+124,168,151,149,142,148,163,31,178,154,156,143,174,142,11,247,147,248,97,
+21,77,93,119,94,95,31,94,94,114,75,72,26,251,23,231,40,247,14,247,14,236,
+246,247,28,247,24,50,235,251,14,30,126,104,21,219,194,48,251,25,32,92,69,
+67,58,84,223,247,15,247,15,183,210,215,31,11,21,101,123,125,96,29,174,29,
+251,179,120,6,220,133,150,129,140,65,8,252,99,7,94,127,118,113,125,133,147,
+164,132,30,174,129,123,155,113,27,112,117,116,112,97,180,109,197,247,0,200,
+211,247,17,31,248,6,7,141,214,148,148,220,145,8,11,57,143,126,151,138,213,
+8,248,147,128,29,252,136,6,138,53,130,129,55,134,8,120,11,179,29,85,129,247,
+30,10,11,153,148,151,137,10,11,106,10,251,193,163,10,247,178,240,11,247,56,
+21,63,91,96,110,75,27,82,96,168,196,110,31,121,177,132,171,137,201,8,247,
+200,6,131,204,129,168,114,171,8,175,109,93,160,87,27,89,92,121,105,101,31,
+92,98,112,68,57,26,251,30,211,53,11,248,40,247,213,21,251,110,7,76,127,120,
+97,137,30,121,138,5,121,247,120,157,7,121,140,5,97,141,127,158,202,26,247,
+110,165,7,247,22,251,79,5,186,76,146,127,124,26,121,128,133,105,137,30,121,
+11,21,101,122,126,127,116,27,125,119,145,148,198,10,171,150,156,153,162,27,
+150,154,214,10,119,180,154,135,164,27,194,11,247,254,21,61,85,5,95,7,217,
+192,5,251,122,7,138,85,125,125,77,135,8,124,247,128,154,7,76,142,128,149,
+138,195,8,247,183,7,216,192,5,183,7,62,86,5,247,154,7,135,141,88,123,102,
+11,7,209,155,154,213,30,157,251,177,121,7,213,154,124,69,140,31,252,150,251,
+197,248,150,221,10,121,7,147,29,11,219,134,152,122,142,33,8,251,229,7,252,
+21,248,120,5,251,63,120,6,182,153,131,92,179,31,252,77,185,10,248,28,7,11,
+21,138,29,11,158,6,230,150,188,186,222,27,214,185,95,66,52,86,94,37,135,127,
+139,140,127,31,94,154,7,197,178,132,124,163,31,180,114,162,94,84,26,50,81,
+79,52,66,83,176,217,95,30,117,126,11,219,29,252,150,251,138,248,150,221,10,
+121,7,147,29,11,22,247,128,154,6,76,142,128,149,138,195,8,248,233,7,135,141,
+88,123,102,128,68,122,226,29,252,113,7,138,85,125,125,77,135,8,11,149,137,
+142,134,30,81,55,109,105,110,122,8,128,132,133,133,133,26,136,140,137,142,
+137,30,192,11,128,60,122,125,57,137,8,251,37,247,114,6,140,169,142,142,167,
+140,8,247,28,158,10,11,22,110,10,11,118,10,85,129,247,30,10,11,247,129,154,
+6,73,144,132,148,138,212,8,247,247,7,136,10,11,7,233,95,195,65,93,108,122,
+75,71,30,218,7,132,141,87,120,105,128,87,124,25,122,7,142,146,148,140,150,
+27,167,148,124,90,31,251,140,7,138,80,128,126,89,136,8,11,109,164,111,149,
+83,146,187,152,160,148,162,157,8,176,169,161,184,187,26,228,63,200,251,4,
+102,111,133,123,98,30,131,116,129,136,128,27,118,129,148,158,136,31,123,6,
+11,162,138,5,191,137,155,120,76,26,11,247,84,133,10,247,91,22,247,32,29,180,
+10,14,113,10,252,92,7,76,224,10,11,21,206,172,184,200,199,130,29,11,228,29,
+47,8,251,101,7,137,47,135,225,29,227,26,11,247,31,10,148,140,150,139,29,105,
+179,29,11,200,199,26,190,104,177,141,10,14,194,29,194,195,153,10,11,198,158,
+169,203,10,95,165,79,236,29,11,163,29,56,108,84,77,31,69,77,101,47,251,2,
+26,11,154,131,25,165,124,154,114,108,26,98,112,112,98,121,128,143,155,117,
+30,153,120,128,144,128,27,119,124,123,118,107,169,121,192,247,3,221,197,11,
+78,79,26,88,173,101,185,144,29,11,133,10,14,170,10,248,92,214,29,161,140,
+5,11,144,251,109,21,247,134,157,6,64,140,127,149,138,203,8,247,49,7,106,175,
+162,129,181,27,247,11,230,247,4,247,37,247,16,69,228,42,11,247,31,29,81,27,
+74,155,29,222,29,248,174,7,187,247,66,5,114,6,92,34,96,113,251,21,135,8,72,
+6,62,141,131,142,138,175,8,11,7,171,101,112,150,99,27,251,7,46,251,5,251,
+34,251,20,213,52,247,3,195,177,159,186,173,31,75,7,143,136,247,39,191,5,11,
+21,251,91,251,58,251,56,251,87,251,99,247,53,251,56,247,93,247,97,247,55,
+247,54,247,95,247,94,251,55,247,55,251,94,31,11,21,212,10,11,21,247,5,29,
+166,195,29,11,21,252,160,7,58,247,102,86,205,29,248,160,7,220,251,102,192,
+11,145,10,131,107,111,11,135,142,251,47,84,5,124,7,147,140,5,141,151,151,
+140,149,27,163,148,123,95,31,251,124,7,137,65,130,129,71,136,8,11,247,29,
+10,162,10,11,247,32,29,159,117,167,166,195,29,11,21,251,39,247,40,5,157,11,
+164,106,135,133,24,133,132,5,62,41,98,81,126,26,133,142,136,145,144,141,140,
+144,143,30,198,197,179,176,210,200,8,11,94,104,247,16,29,177,209,10,111,103,
+85,102,31,11,163,159,159,163,163,119,159,116,31,247,44,22,114,119,120,114,
+115,159,119,163,163,159,159,163,163,119,159,116,31,14,7,100,108,124,114,172,
+10,162,11,248,67,21,156,29,11,200,199,26,189,104,178,172,29,11,157,7,234,
+10,11,7,68,138,124,125,64,27,121,247,179,7,247,54,228,206,247,16,247,16,44,
+209,251,58,108,119,138,134,109,31,11,133,29,247,91,22,247,32,29,159,117,167,
+11,173,10,47,8,251,100,7,177,10,247,118,11,247,8,244,172,195,201,31,204,198,
+176,228,236,26,229,110,217,83,194,30,208,71,251,1,175,251,29,27,251,162,11,
+248,143,159,10,11,21,132,132,127,129,128,30,119,122,113,129,110,27,55,85,
+219,247,16,247,4,188,213,215,193,187,92,86,31,11,218,29,110,110,101,104,110,
+168,176,175,169,168,175,31,11,21,251,39,167,10,166,195,29,247,91,22,113,117,
+116,11,22,251,80,6,138,191,5,240,138,162,192,183,27,161,151,131,112,157,31,
+111,158,152,130,162,27,147,142,11,121,7,213,155,124,69,140,31,252,92,208,
+10,11,6,247,8,137,159,125,155,50,8,164,6,136,247,35,5,252,167,224,29,11,21,
+164,29,11,21,198,167,174,185,170,165,122,109,155,30,158,104,150,94,99,26,
+83,111,104,93,77,98,204,235,30,11,227,162,29,144,130,140,47,8,251,101,7,138,
+47,134,11,130,134,121,121,30,251,39,251,40,5,11,6,55,169,96,198,188,177,163,
+191,172,30,126,150,5,192,29,11,247,51,247,108,21,143,6,247,54,251,54,247,
+5,10,130,122,11,147,29,247,180,157,7,63,123,153,210,31,11,198,10,170,150,
+156,154,162,27,11,247,40,5,157,120,131,144,124,27,118,126,127,120,123,149,
+123,158,128,31,247,46,42,5,14,7,226,147,153,188,141,247,45,10,63,7,14,214,
+29,161,140,5,157,251,178,121,7,113,10,11,7,76,189,29,202,26,11,158,251,135,
+120,7,186,138,150,134,119,26,103,42,251,5,251,29,251,14,30,247,105,7,204,
+11,105,26,97,183,10,11,247,37,10,144,130,140,11,247,3,10,247,20,5,216,7,251,
+178,247,19,116,86,247,102,58,5,11,7,134,141,92,123,105,128,73,122,25,123,
+7,140,147,144,139,148,27,176,148,129,98,31,11,75,189,29,203,26,11,247,28,
+29,122,122,11,247,102,220,116,192,251,178,251,19,5,62,7,247,178,251,20,162,
+191,251,102,221,5,11,247,14,29,113,168,227,103,31,252,1,247,15,21,11,160,
+117,166,166,195,29,11,214,154,124,69,140,31,11,21,144,166,158,141,159,27,
+234,203,75,44,50,76,78,49,118,123,142,148,104,31,11,203,29,117,123,155,11,
+251,11,251,15,251,9,59,247,14,247,69,247,71,218,247,12,247,10,31,14,7,137,
+33,126,122,57,134,8,120,247,127,158,7,62,143,124,160,137,242,8,11,7,138,54,
+129,128,63,134,8,120,247,172,158,7,63,142,125,153,138,212,8,11,26,158,153,
+147,171,141,30,143,149,139,140,150,31,158,251,172,120,7,187,137,11,213,131,
+148,130,140,66,8,252,69,7,138,54,132,130,63,132,8,120,247,172,11,22,212,10,
+14,146,98,40,100,111,34,137,25,251,11,6,11,247,100,7,227,247,29,29,11,121,
+7,223,10,11,140,5,86,141,124,158,202,26,11,152,148,152,155,26,159,126,151,
+11,140,212,149,149,216,146,8,158,251,170,120,7,216,133,149,129,140,65,8,11,
+51,131,124,90,138,30,122,122,247,116,156,125,6,90,140,131,154,227,26,11,247,
+22,247,21,191,195,247,13,31,247,35,10,11,120,31,115,151,5,151,116,114,247,
+20,29,11,144,123,27,119,230,29,21,112,116,116,113,111,162,116,166,166,162,
+162,166,166,116,162,112,31,11,21,169,164,114,109,109,114,114,109,110,113,
+164,168,170,164,164,169,31,11,161,120,176,146,146,140,140,145,30,141,144,
+140,139,140,27,147,145,133,11,246,29,163,157,157,162,175,11,218,10,121,7,
+11,117,123,142,148,112,31,125,108,5,127,167,163,135,170,27,217,186,171,11,
+140,139,140,27,147,145,133,131,107,111,11,231,29,122,156,7,11,7,69,242,29,
+209,31,11,146,145,140,140,145,30,141,144,139,139,141,27,147,145,133,131,106,
+11,247,73,229,29,11,247,39,10,68,138,123,124,65,27,121,11,110,116,117,111,
+111,162,116,167,168,162,162,167,166,116,162,111,31,11,226,29,14,135,132,154,
+31,162,128,5,11,247,33,29,66,44,26,251,8,184,11,251,186,6,126,251,31,5,155,
+6,157,215,166,164,206,138,8,11,173,136,155,136,180,123,8,132,159,159,134,
+151,27,161,155,157,11,234,10,251,178,11,237,29,227,26,11,92,70,67,58,84,222,
+247,12,247,13,183,209,215,31,14,7,209,155,154,213,30,157,251,178,11,155,154,
+213,30,157,251,178,121,7,11,162,138,5,192,137,154,120,76,26,11,123,120,87,
+137,30,116,138,5,121,11,138,123,124,65,27,121,247,180,157,7,63,123,153,210,
+31,11,26,79,190,98,215,215,189,180,202,184,118,167,70,188,30,11,159,7,107,
+143,137,139,131,144,8,133,142,137,147,173,26,11,71,105,128,134,65,109,146,
+125,24,145,154,146,140,148,27,11,105,169,206,126,31,110,6,140,88,145,115,
+159,111,8,104,11,239,21,151,151,127,6,140,128,21,149,150,129,7,14,7,63,136,
+114,128,119,30,129,133,125,131,125,27,124,11,21,71,105,128,247,35,29,11,157,
+30,151,7,138,196,150,151,197,141,162,140,24,157,11,65,123,154,209,31,248,
+92,7,209,155,154,213,30,157,11,192,79,207,225,217,247,3,247,13,213,104,182,
+78,31,11,85,148,134,146,138,210,8,247,91,7,244,98,193,57,11,109,110,103,102,
+168,110,175,176,168,168,176,174,110,169,11,121,7,162,138,197,137,150,127,
+138,82,25,252,138,4,11,127,22,151,151,127,6,140,128,21,149,149,129,7,11,6,
+197,138,159,113,137,69,8,157,247,133,121,6,11,7,137,165,156,138,165,27,218,
+192,149,163,182,31,11,21,114,122,123,116,133,140,133,141,133,31,143,124,11,
+30,251,35,251,118,251,40,247,114,5,128,155,133,11,157,7,116,140,81,141,128,
+151,140,196,25,151,7,11,170,106,181,180,173,162,192,176,30,119,155,5,112,
+11,181,244,5,247,134,6,177,42,5,152,106,143,123,11,82,132,8,124,247,108,154,
+7,81,144,131,150,137,11,213,30,157,251,178,121,7,213,155,124,69,140,31,11,
+123,7,140,145,142,139,147,27,179,148,130,97,31,11,6,251,102,57,162,87,247,
+178,11,165,54,226,251,120,247,128,24,11,5,152,126,142,134,132,26,129,134,
+137,115,30,11,247,17,29,7,11,134,247,16,10,11,21,105,6,251,14,36,251,13,242,
+5,105,6,11,26,251,24,230,43,247,16,247,18,238,247,0,11,154,7,57,142,128,150,
+214,26,247,206,247,14,11,170,119,164,168,26,168,162,160,172,176,161,117,11,
+249,49,21,127,6,251,128,252,181,99,45,128,11,251,20,247,178,5,62,6,251,19,
+251,178,192,11,121,247,179,7,247,55,227,206,247,16,247,16,11,21,247,46,236,
+5,160,11,130,247,40,10,11,7,137,69,133,131,82,132,8,124,247,97,11,133,136,
+30,131,134,137,139,107,135,8,119,11,140,140,152,31,158,251,158,120,7,188,
+137,11,21,251,136,6,98,42,161,129,5,175,166,11,158,247,36,10,11,207,247,70,
+21,248,1,248,1,252,1,6,11,112,94,113,31,113,94,131,103,138,59,8,11,126,122,
+106,120,140,135,152,86,30,14,21,56,6,97,251,19,152,129,5,14,178,247,149,21,
+76,247,138,202,7,14,120,187,27,222,185,190,245,152,31,14,21,166,6,148,179,
+5,153,11,155,26,159,126,151,117,124,11,133,138,137,129,31,11,146,134,5,142,
+147,11,130,111,113,129,129,144,153,125,30,159,11,7,137,47,134,130,89,136,
+8,121,122,11,134,150,129,140,64,8,252,80,7,138,11,247,183,201,251,172,6,56,
+104,132,114,11,26,172,126,156,115,115,126,122,106,120,11,30,155,156,251,118,
+122,156,6,190,136,11,161,152,129,110,157,30,113,155,151,129,11,247,106,247,
+207,21,247,187,251,103,6,11,88,136,8,122,122,247,118,156,123,6,11,247,153,
+7,141,244,150,153,220,148,8,11,162,160,169,169,114,163,109,31,14,247,142,
+4,90,250,124,188,7,14,162,10,14,173,10,48,8,11,7,227,162,29,11,137,10,14,
+162,10,251,8,22,247,46,236,5,160,11,224,29,252,80,222,29,11,210,29,85,129,
+247,30,10,14,21,63,111,114,118,129,29,11,21,113,117,116,112,111,159,117,167,
+155,10,11,137,10,251,8,22,247,46,236,5,11,121,7,115,10,11,93,10,14,70,29,
+74,248,90,194,29,11,70,29,186,248,32,47,10,};
+#endif
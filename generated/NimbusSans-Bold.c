@@ -0,0 +1,1943 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusSans_Bold_cff_size = 40990;
+asm(".section .rodata");
+asm(".global fz_font_NimbusSans_Bold_cff");
+asm(".type fz_font_NimbusSans_Bold_cff STT_OBJECT");
+asm(".size fz_font_NimbusSans_Bold_cff, 40990");
+asm(".balign 64");
+asm("fz_font_NimbusSans_Bold_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusSans-Bold.cff\"");
+#else
+const int fz_font_NimbusSans_Bold_cff_size = 40990;
+const char fz_font_NimbusSans_Bold_cff[] = {
+1,0,4,2,0,1,1,1,16,78,105,109,98,117,115,83,97,110,115,45,66,111,108,100,
+0,1,1,1,57,250,26,0,250,27,1,250,28,12,0,250,29,2,250,30,3,248,20,4,251,47,
+12,3,208,12,4,251,80,251,199,250,193,250,194,5,29,0,76,156,232,13,28,39,125,
+15,28,39,147,17,190,29,0,0,144,189,18,2,4,2,0,1,0,3,0,9,0,16,0,22,0,28,0,
+38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,0,123,0,136,
+0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,216,0,227,0,
+238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,1,103,1,115,
+1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,190,1,196,1,
+206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,2,38,2,44,
+2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,2,151,2,
+162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,3,20,3,
+27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,118,3,
+131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,3,216,
+3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,73,4,
+79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,163,4,
+168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,4,251,
+5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,5,127,
+5,136,5,141,5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,229,5,
+237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,112,6,
+121,6,128,6,137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,6,248,
+7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,115,7,
+122,7,134,7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,7,211,
+7,214,7,219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,1,8,4,
+8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,
+8,80,8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,8,127,
+8,132,8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,230,8,
+239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,134,9,
+154,9,163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,10,
+6,10,15,10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,114,
+10,123,10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,10,
+213,10,222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,46,
+11,53,11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,11,
+144,11,151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,214,
+11,221,11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,12,54,
+12,63,12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,153,12,
+162,12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,12,252,
+13,5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,102,13,
+111,13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,13,191,
+13,200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,14,18,
+14,25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,102,
+14,109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,14,
+179,14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,249,
+15,0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,15,
+84,15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,15,
+161,15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,74,16,84,73,74,65,
+98,114,101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,67,99,
+97,114,111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,
+99,114,111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,116,
+69,111,103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,99,99,
+101,110,116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,76,99,
+97,114,111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,110,103,
+97,114,117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,83,
+97,99,117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,114,
+105,110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,99,117,
+116,101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,117,
+110,105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,114,
+99,117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,114,
+99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,105,
+114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,73,
+109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,109,
+102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,109,
+97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,109,
+97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,114,
+99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,85,109,
+97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,73,98,
+114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,111,
+103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,111,
+116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,101,
+99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,110,
+101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,97,
+99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,83,97,110,115,32,66,111,108,100,78,105,109,
+98,117,115,83,97,110,115,0,212,2,0,1,0,35,0,103,0,211,0,221,1,55,1,158,1,
+192,1,197,1,250,2,60,2,107,2,143,2,227,2,247,3,28,3,33,3,72,3,76,3,95,3,120,
+3,212,3,242,4,18,4,64,4,87,4,173,4,204,5,32,5,54,5,64,5,102,5,110,5,133,5,
+165,5,223,6,18,6,76,6,79,6,135,6,163,6,179,6,202,6,252,7,3,7,51,7,76,7,120,
+7,164,7,206,7,223,7,226,8,12,8,18,8,60,8,98,8,138,8,149,8,190,8,210,8,238,
+8,251,9,33,9,40,9,77,9,90,9,94,9,108,9,143,9,162,9,169,9,178,9,202,9,233,
+9,238,10,14,10,45,10,50,10,60,10,63,10,87,10,116,10,145,10,172,10,200,10,
+228,11,0,11,26,11,43,11,70,11,95,11,102,11,128,11,154,11,162,11,167,11,192,
+11,195,11,219,11,224,11,247,12,14,12,37,12,41,12,63,12,80,12,100,12,121,12,
+142,12,149,12,170,12,175,12,194,12,198,12,218,12,238,13,2,13,20,13,39,13,
+58,13,71,13,90,13,99,13,118,13,128,13,138,13,156,13,174,13,179,13,197,13,
+215,13,227,13,244,14,5,14,22,14,26,14,42,14,58,14,73,14,88,14,103,14,115,
+14,128,14,135,14,141,14,155,14,169,14,183,14,197,14,211,14,223,14,235,14,
+248,15,5,15,18,15,31,15,44,15,57,15,68,15,76,15,84,15,89,15,101,15,105,15,
+117,15,129,15,141,15,153,15,163,15,169,15,175,15,186,15,197,15,208,15,219,
+15,230,15,241,15,252,16,0,16,11,16,20,16,29,16,38,16,45,16,52,16,62,16,72,
+16,82,16,92,16,102,16,112,16,122,16,132,16,140,16,145,16,154,16,163,16,172,
+16,181,16,190,16,199,16,208,16,217,16,226,16,235,16,244,16,251,17,1,17,7,
+17,13,17,19,17,24,17,28,60,29,247,44,6,251,61,247,109,21,58,99,93,68,92,110,
+164,179,181,161,159,197,151,30,187,148,176,146,145,141,155,147,25,11,248,
+160,247,118,21,163,29,251,1,27,251,47,44,251,4,251,73,251,65,233,33,247,45,
+247,13,237,207,246,170,31,251,30,6,96,122,100,114,88,27,99,107,156,169,119,
+31,126,159,134,163,137,190,8,141,232,21,222,148,174,179,201,27,203,177,96,
+59,146,31,11,248,141,248,2,21,247,6,137,51,208,251,37,27,251,29,54,70,251,
+3,103,150,108,158,118,31,158,120,156,130,191,122,247,59,87,24,174,128,151,
+128,117,26,106,100,119,74,102,111,145,152,121,30,124,150,133,150,133,168,
+8,251,29,6,251,11,143,226,78,247,56,27,214,196,155,171,179,31,179,171,163,
+189,192,26,209,104,184,68,160,30,251,69,190,5,100,151,129,147,161,26,169,
+171,159,188,206,172,115,90,140,30,11,247,193,106,29,140,251,5,100,29,11,249,
+91,248,28,21,251,184,251,17,247,58,6,135,98,129,114,117,113,8,95,103,83,113,
+82,27,251,14,53,245,247,42,247,49,215,234,247,20,191,183,124,110,172,31,160,
+121,150,122,152,101,8,247,33,6,247,43,121,251,14,233,251,68,27,251,102,251,
+35,251,47,251,119,251,113,247,36,251,53,247,89,237,205,174,221,195,31,157,
+43,5,229,6,11,247,122,247,181,21,247,64,6,204,167,113,79,31,109,7,138,120,
+139,121,128,26,70,143,118,157,104,30,247,53,166,6,116,152,130,154,171,26,
+135,247,107,135,149,46,179,8,221,171,180,198,228,26,197,119,192,104,175,30,
+173,106,93,155,77,27,252,27,253,109,247,42,6,248,50,4,247,82,247,73,7,182,
+156,135,124,158,31,157,124,148,114,105,26,104,130,111,121,124,30,125,122,
+120,134,96,27,11,249,62,248,118,21,216,29,49,233,29,251,39,251,128,251,127,
+247,19,251,38,247,95,247,74,247,12,244,247,59,148,31,115,29,11,247,121,61,
+29,11,249,110,22,247,94,249,109,5,251,51,6,251,1,252,183,251,10,248,183,5,
+251,40,6,251,5,252,182,251,5,248,182,5,251,51,6,247,98,253,109,5,247,27,6,
+247,11,248,205,247,14,252,205,5,11,247,82,248,176,21,251,32,251,220,6,53,
+155,86,175,103,30,99,179,204,119,225,27,229,207,162,185,178,31,170,175,151,
+184,224,26,247,220,251,32,251,214,7,84,133,116,121,119,30,120,121,111,128,
+108,27,108,110,150,157,122,31,120,159,133,161,196,26,11,248,249,22,247,45,
+248,176,5,251,37,6,57,252,14,58,248,14,5,251,32,6,57,252,14,53,248,14,5,251,
+37,6,247,44,252,176,5,247,36,6,225,248,17,220,252,17,5,11,248,55,247,162,
+21,247,123,248,95,5,251,60,6,251,31,251,214,251,41,247,214,5,251,59,6,247,
+134,252,95,5,251,162,247,42,7,11,249,121,21,37,55,105,72,77,31,74,69,102,
+37,251,1,26,251,1,176,36,204,70,30,71,202,221,106,243,27,243,221,172,207,
+202,31,202,206,178,245,242,26,247,6,102,242,74,208,30,208,75,59,171,33,27,
+140,251,20,21,247,15,217,39,251,50,251,42,58,39,251,12,251,14,60,239,247,
+46,247,46,218,239,247,14,31,11,21,251,0,251,42,5,215,6,221,239,221,39,5,217,
+6,36,247,42,5,14,249,129,21,107,136,127,123,118,27,132,119,142,142,132,31,
+68,164,5,152,103,138,139,120,27,84,98,29,148,149,137,135,150,195,29,171,225,
+29,21,37,39,199,29,202,248,176,21,252,176,247,32,247,179,7,221,180,180,221,
+154,149,138,136,158,30,247,34,7,140,131,136,139,133,27,75,84,97,66,108,31,
+245,7,11,21,246,155,29,33,29,251,138,248,74,21,247,19,251,42,5,208,6,70,247,
+42,5,14,248,147,22,192,29,251,42,252,132,6,251,181,248,132,5,251,46,253,109,
+247,42,248,140,6,11,247,18,174,21,103,179,207,117,211,27,247,57,241,247,1,
+247,69,211,124,197,107,189,31,211,212,96,180,71,69,5,181,88,81,159,66,27,
+251,60,240,29,64,155,79,173,90,31,64,62,182,99,5,248,3,248,10,21,147,115,
+143,114,112,26,39,86,69,65,106,110,153,167,115,30,109,191,21,130,162,134,
+167,170,26,240,191,209,214,174,166,125,106,166,30,11,204,22,247,42,228,6,
+247,181,247,250,5,252,83,192,29,251,42,48,7,251,181,251,252,5,248,87,251,
+42,7,11,209,22,247,32,210,6,247,87,247,146,5,251,217,247,32,248,176,251,32,
+68,7,251,87,251,146,5,247,217,251,32,7,11,247,193,248,165,21,61,247,37,251,
+32,251,37,70,46,208,251,224,6,54,184,97,231,171,162,142,147,165,30,237,7,
+137,125,132,138,128,27,102,130,150,187,31,247,186,217,7,11,249,123,21,251,
+2,251,14,247,2,6,247,78,247,14,21,251,2,251,14,247,2,6,14,247,205,248,165,
+21,56,192,6,167,151,153,165,152,152,138,137,153,30,244,7,141,109,110,140,
+118,27,46,94,95,48,31,74,63,46,215,252,72,247,32,248,72,222,7,247,225,232,
+21,56,192,6,167,151,153,165,152,152,138,137,153,30,244,7,141,109,110,140,
+118,27,46,94,95,48,31,74,63,46,215,252,72,247,32,248,72,222,7,11,221,22,247,
+220,6,223,195,165,29,211,185,167,181,201,26,190,114,191,98,175,30,176,96,
+88,155,61,27,251,217,87,29,21,166,157,137,137,148,31,167,132,157,116,110,
+26,104,113,114,103,97,118,160,184,137,30,47,6,48,140,195,87,236,27,236,202,
+193,223,186,117,173,95,161,31,173,160,157,170,176,26,210,82,185,51,87,96,
+122,107,114,30,120,116,132,114,136,89,8,228,6,194,140,154,158,180,27,171,
+160,118,106,101,113,119,89,31,129,6,11,248,160,156,21,115,162,131,155,166,
+26,247,192,7,247,2,64,195,251,38,67,29,11,145,29,248,181,247,17,252,31,6,
+11,21,88,99,100,88,89,179,99,189,188,180,179,188,191,100,178,89,31,91,4,162,
+157,121,115,116,120,120,117,115,120,158,162,163,158,157,163,31,11,247,105,
+166,29,174,29,6,11,250,46,21,251,2,251,14,247,2,6,247,78,247,14,21,251,2,
+251,14,247,2,6,14,21,92,130,117,120,94,27,94,114,160,184,132,31,84,6,50,141,
+189,85,219,27,214,196,196,214,141,139,143,138,144,31,14,21,107,135,127,123,
+119,27,132,119,142,142,132,31,67,164,5,151,107,134,140,121,27,83,104,93,61,
+136,31,201,6,171,144,151,152,162,27,149,148,137,135,151,31,210,113,5,131,
+160,157,135,155,27,198,170,181,224,144,31,14,251,38,63,77,251,17,130,30,247,
+27,6,195,146,162,157,208,27,193,166,121,103,121,130,124,124,130,205,29,32,
+121,87,84,42,26,42,204,74,238,199,193,164,191,189,30,111,142,129,152,123,
+30,11,129,159,128,8,129,158,175,125,147,27,148,146,147,149,146,137,143,130,
+147,31,79,189,120,163,81,236,8,157,129,136,141,130,27,132,133,132,119,128,
+31,98,66,105,95,92,99,8,122,124,136,136,131,26,129,146,131,148,157,11,191,
+29,14,176,121,27,130,132,131,129,131,142,136,156,124,31,186,99,173,95,180,
+66,8,119,150,145,132,146,27,147,144,143,147,144,31,198,240,161,167,199,189,
+8,148,147,141,143,146,26,149,132,147,130,133,106,127,131,123,30,11,21,83,
+6,93,130,117,119,95,27,93,114,160,184,133,31,83,129,6,63,195,82,215,214,196,
+196,214,30,14,8,115,29,247,35,6,216,29,49,233,29,251,39,251,128,11,203,29,
+60,60,81,90,73,98,156,127,29,59,247,26,21,176,165,117,106,106,113,116,11,
+248,55,248,8,21,247,117,247,249,5,251,66,6,251,26,251,132,251,20,247,132,
+5,251,70,6,247,114,251,254,251,122,252,3,5,247,66,6,247,31,247,145,247,32,
+251,145,5,247,70,6,14,248,39,248,176,80,29,11,190,22,247,35,6,206,140,189,
+171,169,199,247,176,249,16,24,251,47,6,251,46,252,5,251,47,248,5,5,251,47,
+6,247,125,252,158,120,99,125,103,137,137,115,135,25,251,21,6,11,21,251,17,
+219,7,141,89,113,110,83,129,8,93,7,227,147,190,195,135,226,8,247,1,7,11,247,
+164,21,247,68,247,160,5,251,60,6,52,251,55,51,247,55,5,251,60,6,247,68,251,
+160,251,72,251,164,5,247,60,6,231,247,60,230,251,60,5,247,60,6,14,247,152,
+21,247,79,6,247,26,225,234,247,40,247,38,56,219,251,44,31,251,214,253,109,
+247,42,6,248,21,4,247,111,247,32,7,219,176,104,65,64,102,104,59,31,14,21,
+251,4,252,29,251,11,248,29,5,251,46,6,247,93,252,198,129,68,116,124,48,142,
+25,251,5,7,231,152,140,146,167,31,192,158,159,161,163,209,241,29,11,22,247,
+202,6,161,29,251,42,6,247,42,252,240,21,171,29,11,86,29,14,166,29,252,175,
+7,84,110,109,87,82,115,167,206,30,209,251,42,67,7,63,157,92,182,99,30,101,
+181,195,119,208,27,247,41,224,216,247,28,31,248,175,7,11,107,29,249,203,211,
+29,247,52,247,23,230,220,247,21,152,31,251,26,6,69,122,111,112,83,27,68,97,
+202,245,191,149,186,156,171,31,169,155,170,155,179,27,196,166,112,68,155,
+31,11,247,116,247,136,21,214,217,247,131,251,214,5,247,71,6,251,214,248,51,
+247,183,247,206,5,251,69,6,251,177,251,212,5,247,212,174,29,7,11,6,247,42,
+251,17,21,247,55,6,209,175,111,85,84,103,111,69,31,251,55,6,251,17,4,247,
+71,6,212,177,107,76,77,101,107,66,31,251,71,6,14,22,156,29,251,32,6,247,32,
+159,29,11,189,165,166,183,193,26,227,59,198,251,13,251,9,55,80,57,30,100,
+247,26,151,7,172,164,161,178,179,163,117,103,99,113,120,86,30,112,44,166,
+6,180,11,21,251,0,251,42,5,216,6,221,239,221,39,5,216,6,36,247,42,5,14,247,
+91,247,222,21,248,35,251,32,253,109,247,32,247,69,7,195,200,247,21,251,130,
+5,247,56,176,29,11,248,21,248,240,21,208,29,252,240,247,42,6,11,248,176,251,
+32,251,230,7,75,95,97,70,79,109,171,204,30,247,239,251,32,252,12,7,251,12,
+204,72,247,8,212,188,165,200,179,30,75,7,11,21,215,29,6,202,29,14,249,110,
+21,251,91,251,58,251,56,251,87,251,99,247,53,251,56,247,93,247,97,247,55,
+247,54,247,95,247,94,251,55,247,55,251,94,31,11,249,137,21,251,18,6,69,251,
+42,5,209,6,14,249,123,103,29,104,93,61,135,31,202,6,171,144,150,152,163,27,
+11,162,183,166,146,177,27,166,161,135,127,188,31,127,188,162,135,166,27,188,
+179,151,172,195,31,98,247,1,5,119,99,107,130,106,27,11,21,216,189,70,33,38,
+87,69,64,63,88,208,243,243,190,208,215,31,11,248,176,21,215,29,6,11,144,29,
+117,145,163,85,153,29,11,21,42,251,14,236,6,247,91,247,14,21,42,251,14,236,
+6,42,247,160,21,37,49,199,29,21,93,247,149,251,1,6,251,57,251,150,5,65,247,
+71,46,234,232,185,7,251,33,214,21,33,6,245,247,56,5,14,247,101,101,29,11,
+248,185,21,251,57,38,251,1,251,69,251,70,240,251,0,247,58,247,57,241,247,
+0,247,66,247,75,40,246,251,61,31,11,21,251,32,252,239,6,108,128,128,109,130,
+132,140,142,130,30,251,4,7,136,166,173,137,161,27,226,175,175,227,31,11,248,
+143,119,29,14,113,162,172,172,165,161,177,132,29,11,116,29,14,249,106,21,
+251,42,251,102,6,180,251,201,5,206,6,181,247,201,5,252,6,4,190,29,11,251,
+54,251,53,251,92,251,88,247,54,251,54,247,87,247,89,247,55,247,55,247,87,
+247,88,251,54,247,57,11,57,206,73,222,220,207,205,219,223,73,205,55,31,59,
+4,179,170,108,100,101,107,108,101,100,107,170,178,177,11,22,247,78,248,176,
+5,251,40,6,251,1,252,31,251,9,248,31,5,251,40,6,247,81,252,176,5,14,251,38,
+6,46,129,81,86,46,27,251,8,71,233,247,51,247,53,210,235,247,10,226,188,97,
+50,159,31,11,21,83,6,93,131,116,119,95,27,93,114,160,184,133,31,83,129,6,
+63,195,82,215,214,196,196,214,30,11,247,26,251,223,5,247,50,6,251,50,248,
+28,247,7,247,229,5,251,44,6,38,251,165,5,53,247,165,11,110,79,105,31,247,
+10,111,21,210,186,71,35,41,91,71,69,68,92,207,239,241,186,207,210,31,14,247,
+223,21,251,223,192,29,251,43,251,165,251,180,122,29,7,11,93,224,61,172,30,
+153,105,112,143,70,27,251,172,77,247,183,6,247,13,191,84,251,22,251,22,87,
+11,22,251,17,219,7,141,89,113,110,83,129,8,93,7,227,147,190,195,135,226,8,
+247,1,7,14,247,165,174,29,247,223,11,6,251,151,253,109,5,247,45,6,188,247,
+39,5,247,124,247,17,21,251,82,6,234,247,177,5,11,27,87,107,159,171,31,247,
+113,251,32,251,113,7,87,150,102,161,113,30,108,168,192,120,201,27,11,247,
+106,166,29,174,29,6,14,247,110,131,29,11,113,178,119,30,90,112,118,107,89,
+26,58,201,83,228,228,201,195,220,189,118,171,90,166,30,11,228,29,14,247,17,
+59,7,137,189,165,168,195,149,8,185,7,51,132,88,82,143,52,8,251,1,7,11,203,
+247,231,128,29,21,247,59,251,38,5,247,6,7,38,228,240,228,5,247,9,7,251,59,
+251,41,5,11,31,138,251,60,21,180,165,112,94,98,113,112,98,98,113,166,181,
+182,165,167,180,31,11,247,17,21,92,169,119,154,121,160,8,99,185,117,209,222,
+26,247,37,217,233,247,12,11,248,176,94,29,176,90,24,175,169,165,152,179,27,
+161,166,134,124,196,31,118,217,151,137,165,27,11,137,135,150,31,211,113,5,
+131,159,158,135,154,27,198,171,225,29,21,247,0,247,42,5,62,6,57,42,57,236,
+5,62,6,242,251,42,5,14,6,79,87,5,82,7,247,154,247,114,251,154,247,114,5,82,
+7,199,87,5,11,31,67,164,5,152,103,138,139,121,27,83,104,93,61,135,31,202,
+6,171,144,11,247,80,249,109,164,29,11,251,6,161,5,32,160,108,160,192,26,194,
+187,174,217,234,192,99,65,144,30,11,247,22,154,29,11,7,248,125,251,74,5,247,
+3,7,252,18,247,23,248,18,247,25,5,14,206,29,111,11,247,206,21,247,241,247,
+17,251,241,247,57,248,13,247,17,252,163,253,109,11,199,191,5,196,7,251,154,
+251,114,247,154,251,114,5,196,7,79,191,5,11,251,132,251,19,247,132,5,251,
+74,6,247,118,251,251,251,118,252,6,5,11,133,184,27,222,185,172,199,183,110,
+166,91,124,127,137,134,125,31,14,6,247,26,251,223,5,247,51,6,251,51,248,28,
+247,7,247,229,5,11,21,112,116,116,113,111,162,116,166,166,162,162,166,166,
+116,162,112,31,11,21,102,109,110,103,102,168,110,176,175,231,29,11,21,169,
+164,114,109,109,114,114,109,109,114,164,170,168,165,164,168,31,11,175,29,
+204,168,133,220,29,92,11,248,209,21,251,181,234,248,61,75,7,89,125,93,114,
+61,27,78,7,11,247,42,5,63,6,57,42,57,213,29,247,175,6,210,29,251,35,247,92,
+11,21,77,247,172,7,222,174,146,164,177,31,204,182,172,212,238,26,11,30,143,
+97,141,117,127,26,121,133,129,127,133,137,140,150,128,30,11,252,63,168,29,
+11,248,121,21,251,71,247,116,251,26,251,116,251,71,251,8,247,71,11,247,30,
+240,234,247,23,247,23,39,234,251,31,31,251,52,247,169,11,251,42,251,165,251,
+181,247,165,174,29,6,14,140,151,139,144,146,26,193,131,189,126,177,30,237,
+103,52,198,11,21,251,30,251,22,6,179,251,21,5,195,6,181,247,21,5,11,155,176,
+183,31,183,176,167,200,198,26,211,101,196,56,187,30,11,249,109,21,11,247,
+183,201,251,172,6,56,104,132,114,102,31,74,96,105,11,21,247,6,247,28,7,169,
+160,115,106,106,118,115,109,31,11,251,39,251,37,251,91,58,161,70,181,88,30,
+161,112,11,21,89,248,248,7,107,107,108,87,115,80,8,178,6,11,247,94,247,52,
+7,194,173,101,77,77,104,99,85,31,11,247,11,239,29,247,141,247,17,252,35,6,
+11,247,190,247,234,21,251,164,251,27,247,164,6,14,251,42,253,109,247,42,11,
+31,120,87,5,117,11,6,251,89,247,228,247,76,247,96,5,251,51,6,11,8,178,6,115,
+200,108,188,107,172,8,248,248,6,11,21,210,186,71,35,41,91,71,69,69,91,208,
+238,11,193,104,93,164,71,27,251,21,41,251,16,251,55,11,115,118,148,154,126,
+30,128,153,134,156,138,173,8,11,250,127,247,203,21,254,134,35,250,134,6,14,
+251,32,251,92,251,87,247,92,251,32,6,14,6,251,4,247,193,230,247,131,5,251,
+35,6,11,247,57,247,254,247,17,252,148,253,109,247,42,11,22,235,6,212,140,
+200,199,138,211,8,247,186,11,248,176,21,251,32,253,138,247,32,247,174,6,11,
+187,30,171,172,153,168,151,192,8,251,32,6,11,217,232,61,247,37,251,32,251,
+37,70,46,208,11,21,251,19,6,70,251,42,5,208,6,14,251,42,251,38,247,42,6,11,
+21,251,191,60,247,191,6,11,247,42,249,109,11,8,115,188,136,147,160,26,191,
+180,177,196,11,142,206,29,11,31,210,113,5,131,160,158,135,154,27,198,11,207,
+144,175,149,182,165,8,214,186,178,220,11,218,105,30,125,173,166,135,208,27,
+247,172,11,120,176,111,80,26,78,83,102,48,37,82,11,6,169,40,5,179,6,171,238,
+5,14,127,137,134,124,31,11,22,247,42,247,223,11,249,109,4,251,32,251,17,247,
+32,6,11,21,179,160,155,163,181,26,205,81,188,11,248,153,220,21,252,125,48,
+248,125,6,11,31,120,129,139,139,70,128,83,129,24,11,159,27,169,159,125,118,
+116,114,121,107,11,252,176,247,32,247,216,7,203,183,181,11,247,105,247,17,
+252,220,251,17,247,113,11,203,218,29,11,245,217,212,239,238,65,207,251,2,
+31,11,4,251,32,251,17,247,32,6,14,21,251,32,253,109,247,32,6,14,236,5,61,
+6,242,251,42,5,14,251,51,247,42,247,176,11,251,32,252,176,247,32,11,134,202,
+126,179,108,180,8,213,83,11,140,114,121,118,116,137,8,90,6,11,22,247,32,247,
+119,247,87,251,119,11,58,220,36,31,40,4,187,176,102,11,184,27,222,184,172,
+199,183,110,166,11,194,102,228,167,163,142,146,166,30,11,87,31,251,187,247,
+32,247,219,7,11,247,32,247,216,7,201,184,183,202,11,21,252,236,70,248,236,
+6,14,181,224,143,31,14,4,252,120,251,11,248,120,6,11,145,246,195,189,247,
+1,137,8,11,21,251,15,247,16,247,15,7,11,27,247,58,240,247,0,247,70,11,31,
+154,127,148,120,117,26,100,11,168,168,176,174,110,169,104,31,11,173,187,111,
+207,27,247,22,235,11,180,251,1,27,251,98,251,20,11,247,4,192,31,189,251,31,
+5,11,97,31,93,102,111,83,82,26,11,115,138,127,128,116,27,86,6,11,247,14,5,
+251,25,6,14,7,229,251,131,5,11,22,247,42,248,240,11,38,251,0,251,70,11,247,
+114,249,19,24,11,248,63,251,32,11,251,110,21,11,1,0,1,227,1,5,0,1,10,2,1,
+64,3,1,70,6,1,135,255,2,135,254,2,243,2,0,1,0,2,0,3,0,9,0,20,0,92,0,222,1,
+52,1,194,1,200,1,247,2,39,2,80,2,110,2,114,2,118,2,123,2,141,2,251,3,19,3,
+88,3,191,3,234,4,51,4,157,4,200,5,49,5,145,5,157,5,169,5,184,5,192,5,197,
+6,9,6,225,6,229,6,232,6,236,6,240,6,244,7,4,7,9,7,12,7,15,7,19,7,22,7,26,
+7,30,7,34,7,39,7,42,7,138,7,142,7,146,7,150,7,154,7,184,7,189,7,192,7,196,
+7,200,7,221,7,235,8,0,8,32,8,39,8,44,8,48,8,115,8,119,8,125,8,129,8,134,8,
+138,8,142,8,146,8,152,8,156,8,159,8,213,8,217,8,221,9,7,9,75,9,80,9,84,9,
+89,9,93,9,98,9,103,9,108,9,112,9,117,9,200,9,212,10,39,10,116,10,142,10,229,
+11,77,11,82,11,143,11,239,12,154,13,1,13,6,13,18,13,29,13,35,13,42,13,50,
+13,59,13,72,13,87,13,118,13,120,13,162,13,187,13,193,13,203,13,213,13,225,
+13,240,14,52,14,119,14,124,14,130,14,138,14,144,14,152,14,160,14,168,14,174,
+14,183,14,204,14,212,14,245,14,253,15,1,15,6,15,121,15,161,15,166,15,252,
+16,52,16,57,16,60,16,93,16,97,16,211,17,56,17,63,17,78,17,155,17,209,17,212,
+17,245,18,28,18,66,18,80,18,99,18,119,18,163,18,195,18,211,18,236,19,62,19,
+76,19,193,19,239,19,246,20,55,20,64,20,72,20,80,20,89,20,98,20,107,20,152,
+20,161,20,169,20,177,20,185,20,190,20,198,20,200,20,208,20,241,20,251,21,
+4,21,13,21,23,21,78,21,86,21,95,21,104,21,113,21,122,21,128,21,135,21,144,
+21,152,21,161,21,170,21,179,21,188,21,196,22,21,22,29,22,38,22,47,22,50,22,
+55,22,63,22,67,22,73,22,82,22,91,22,99,22,107,22,116,22,153,22,161,22,167,
+22,176,22,183,22,190,22,199,22,208,22,218,23,10,23,14,23,21,23,29,23,52,23,
+96,23,201,23,248,24,71,24,79,24,144,24,237,25,15,25,105,25,181,25,192,25,
+200,25,241,25,249,26,2,26,11,26,19,26,22,26,31,26,40,26,81,26,102,26,112,
+26,119,26,127,26,135,26,144,26,153,26,162,26,170,26,178,26,186,26,246,26,
+254,27,8,27,17,27,26,27,35,27,44,27,52,27,61,27,71,27,79,27,88,27,138,27,
+147,27,157,27,165,27,178,27,219,27,228,27,235,27,243,27,251,28,5,28,13,28,
+22,28,31,28,40,28,110,28,119,28,126,28,136,28,167,28,175,28,217,28,225,28,
+233,28,241,28,252,29,47,29,55,29,63,29,161,29,173,29,184,29,189,29,198,29,
+207,29,215,29,223,29,233,29,241,29,255,30,8,30,17,30,26,30,34,30,43,30,53,
+30,97,30,107,30,117,30,125,30,133,30,142,30,151,30,159,30,167,30,174,30,189,
+30,201,30,210,30,217,30,225,30,234,30,244,31,25,31,33,31,66,31,74,31,118,
+31,151,32,19,32,168,33,31,33,71,33,73,33,75,33,79,33,83,33,204,33,232,33,
+237,33,245,34,2,34,11,34,19,34,74,34,85,34,94,34,102,34,107,34,113,34,122,
+34,131,34,140,34,170,34,233,34,242,34,255,35,8,35,18,35,100,35,128,35,191,
+35,237,36,22,36,33,36,42,36,52,36,92,36,102,36,109,36,117,36,124,36,133,36,
+142,36,145,36,146,37,0,37,75,37,146,37,189,38,40,38,120,39,7,39,72,39,140,
+40,16,40,49,40,116,40,198,40,211,40,223,40,246,41,6,41,84,41,161,42,39,42,
+51,42,128,42,152,42,194,42,238,42,255,43,39,43,78,43,131,43,185,43,226,44,
+132,44,158,45,120,46,114,46,145,46,170,46,210,46,251,47,50,47,62,47,93,47,
+135,47,150,47,191,47,254,48,13,48,22,48,38,48,107,48,176,48,213,48,234,49,
+97,49,200,50,21,50,72,50,113,50,166,51,36,51,150,51,250,52,152,52,228,52,
+252,53,12,53,38,53,61,53,99,53,193,53,216,53,239,54,14,54,36,54,44,54,151,
+54,160,54,174,54,200,54,214,54,221,54,234,55,15,55,118,55,167,55,222,56,72,
+56,88,56,104,56,129,56,133,56,136,56,148,56,176,56,180,56,184,56,187,56,207,
+56,210,56,213,56,238,56,242,56,246,57,23,57,28,57,44,57,47,57,85,57,89,57,
+93,57,202,57,205,58,35,58,82,58,161,59,25,59,61,59,122,59,204,60,46,60,50,
+60,159,60,162,60,187,60,218,61,6,61,11,61,162,61,168,61,196,62,8,62,67,62,
+88,62,92,62,195,62,246,63,64,63,69,63,172,64,51,64,174,65,46,65,52,65,60,
+65,68,65,74,65,83,65,95,65,107,65,119,65,131,65,183,65,195,65,197,65,204,
+66,31,66,117,66,126,66,133,66,143,66,153,66,162,66,168,66,176,66,191,66,242,
+67,18,67,22,67,74,67,80,67,114,67,149,67,153,67,165,67,179,67,185,67,192,
+67,199,67,216,67,221,68,2,68,8,68,12,68,99,68,133,68,144,68,152,68,174,68,
+192,68,197,68,211,68,230,69,69,69,161,69,252,70,16,70,95,70,191,71,11,71,
+13,71,15,71,17,71,62,71,85,71,119,71,193,71,216,71,249,72,42,72,46,72,117,
+72,158,72,251,73,28,73,80,73,90,73,139,73,152,73,158,73,186,73,235,73,244,
+74,3,74,32,74,61,74,76,74,113,74,173,74,189,74,197,74,206,75,14,75,156,75,
+220,76,6,76,27,76,72,76,108,76,138,76,218,77,30,77,35,77,87,77,125,77,157,
+77,201,77,205,77,218,77,236,78,20,78,27,78,33,78,50,78,79,78,94,78,115,78,
+119,78,242,78,247,79,3,79,30,79,50,79,66,79,71,79,138,79,210,80,23,80,43,
+80,114,80,182,80,241,80,245,81,24,81,67,81,88,81,133,81,150,81,187,81,197,
+81,219,81,254,82,18,82,100,82,135,82,165,82,192,82,219,83,4,83,14,83,20,83,
+64,83,106,83,115,83,127,83,149,83,181,83,196,83,212,84,22,84,38,84,41,84,
+49,84,112,84,233,85,32,85,99,85,120,85,175,85,210,86,41,86,153,87,91,87,168,
+88,66,89,30,89,139,90,67,91,28,91,121,91,195,92,36,92,71,92,103,92,138,92,
+172,92,244,93,60,93,170,93,244,94,31,94,43,94,56,94,84,94,113,95,43,95,72,
+95,87,95,152,95,203,95,252,96,80,96,137,96,200,97,10,97,28,97,48,97,66,97,
+107,97,157,97,206,97,255,98,49,98,76,98,103,98,131,98,159,98,180,98,219,99,
+9,99,37,99,64,14,14,251,207,247,154,107,10,251,66,140,29,247,128,247,22,164,
+29,14,47,247,38,107,21,179,247,96,5,242,6,99,251,96,5,244,6,179,247,96,5,
+247,11,238,39,6,170,247,45,5,247,1,238,49,192,10,36,192,10,251,11,40,238,
+6,109,251,45,5,42,40,216,6,99,251,96,5,247,57,247,195,21,169,247,45,5,242,
+6,109,251,45,5,14,47,248,153,248,134,21,137,247,17,61,218,251,18,146,8,193,
+71,85,7,251,21,127,64,66,251,4,26,251,3,208,68,247,27,108,30,251,105,7,83,
+149,108,180,136,209,8,251,23,130,6,66,169,80,195,98,30,177,112,176,126,199,
+133,8,34,207,244,7,194,145,181,153,172,160,8,193,174,171,203,215,26,247,2,
+79,198,251,48,182,30,247,93,7,190,132,168,97,137,78,8,251,38,68,21,83,157,
+114,166,183,26,191,165,168,194,150,30,207,251,218,21,195,122,167,105,91,26,
+89,111,106,83,125,30,14,247,133,247,98,249,81,21,38,56,57,39,39,222,57,240,
+240,222,220,238,242,219,29,92,93,101,102,92,92,101,176,186,185,177,176,186,
+31,248,36,246,21,252,32,253,109,5,216,6,248,31,249,109,5,136,251,249,21,37,
+57,57,39,38,221,57,241,240,222,221,237,243,219,29,91,94,100,101,93,92,101,
+177,185,185,177,177,186,31,14,213,248,162,248,9,21,129,7,95,131,110,117,97,
+30,251,8,247,36,5,228,200,167,181,213,26,231,68,201,32,32,57,67,44,102,153,
+103,167,106,30,148,128,148,128,149,127,141,137,143,134,145,131,8,251,9,78,
+99,86,45,26,251,22,234,53,247,34,208,183,157,200,221,30,185,83,5,247,53,6,
+251,15,247,46,179,185,165,220,141,215,25,144,7,150,7,251,253,85,21,247,28,
+251,63,5,103,92,97,120,108,27,85,87,196,199,172,155,168,166,157,31,225,247,
+72,21,89,201,134,148,164,26,168,162,158,174,175,160,118,102,103,120,112,98,
+116,30,14,205,249,109,77,29,14,251,207,247,95,166,29,251,7,251,66,91,251,
+28,251,46,26,251,47,187,251,28,247,7,251,66,30,239,6,32,247,98,106,247,3,
+247,40,26,247,39,173,247,5,245,247,96,30,14,251,207,247,14,251,92,21,247,
+7,247,66,187,247,28,247,46,26,247,47,91,247,28,251,7,247,66,30,39,6,246,251,
+98,172,251,3,251,40,26,251,39,105,251,5,33,251,96,30,14,251,151,247,23,248,
+180,21,72,45,197,96,207,233,206,45,197,182,72,233,247,0,174,117,209,251,0,
+103,5,247,8,67,251,8,7,251,1,175,117,70,5,14,75,248,169,247,183,21,251,74,
+247,74,251,11,251,74,251,74,251,11,247,74,251,74,247,11,247,74,247,74,6,14,
+203,117,10,14,251,207,173,29,247,106,122,10,14,247,100,249,94,21,251,98,253,
+108,5,206,6,247,98,249,108,5,14,47,247,165,249,104,21,63,74,107,80,96,31,
+98,84,120,49,251,30,26,251,18,155,51,173,85,30,71,181,208,102,222,27,216,
+202,170,198,183,31,179,194,159,230,247,25,26,247,22,123,227,105,194,30,207,
+97,70,176,56,27,251,5,4,175,168,119,102,156,31,153,109,147,62,41,26,59,132,
+61,128,110,30,97,123,109,116,99,27,102,111,158,175,122,31,125,169,131,213,
+234,26,223,146,219,150,168,30,182,154,170,163,179,27,14,47,247,130,248,125,
+21,252,125,247,32,249,89,46,7,55,117,66,96,251,14,27,46,7,14,47,248,148,243,
+10,251,193,6,158,177,161,160,243,214,8,247,15,229,175,192,236,26,247,29,44,
+227,251,40,251,39,53,52,251,42,30,114,247,27,162,7,218,176,185,203,201,177,
+96,68,60,115,110,251,50,251,4,30,251,12,57,102,77,133,251,24,8,248,118,6,
+14,47,247,109,247,209,21,193,142,139,132,164,31,186,126,169,98,87,26,76,95,
+95,78,73,103,177,212,135,30,251,28,6,251,34,140,231,50,247,38,27,247,43,236,
+228,247,30,222,103,193,59,178,31,204,180,167,184,204,26,247,10,51,214,251,
+29,36,60,94,62,108,30,126,105,135,116,80,26,247,22,6,140,177,142,158,146,
+157,8,170,152,171,158,180,27,195,171,105,80,67,98,104,56,31,127,6,14,47,248,
+158,247,165,21,65,248,72,251,57,6,251,151,252,70,5,251,10,247,176,251,49,
+247,32,247,49,213,7,251,106,247,8,21,251,77,6,247,77,247,195,5,14,47,248,
+125,249,89,21,252,15,6,76,252,31,5,247,18,6,174,154,171,158,182,27,210,182,
+88,53,56,96,88,68,78,105,170,196,136,31,251,30,6,251,16,141,233,55,247,30,
+27,247,44,243,243,247,45,247,38,49,238,251,23,92,104,127,108,98,31,162,247,
+40,5,247,185,6,14,47,248,143,248,184,21,132,185,130,162,121,165,8,190,102,
+74,169,62,27,51,67,100,68,96,31,97,70,122,60,251,21,26,251,14,154,63,175,
+82,30,73,180,213,100,223,27,247,33,235,244,247,47,247,28,55,233,251,14,81,
+100,122,93,95,31,140,154,141,205,142,160,149,166,25,191,158,173,165,188,27,
+184,163,121,94,157,31,40,251,84,21,205,181,89,60,64,93,84,77,75,95,191,215,
+216,183,193,203,31,14,47,248,164,249,89,21,252,135,251,17,247,245,6,96,93,
+54,251,21,111,77,90,36,114,46,120,251,43,8,247,33,6,152,247,116,212,247,64,
+247,60,247,95,8,14,47,248,45,248,22,21,163,152,150,146,150,149,8,168,166,
+156,182,185,26,247,3,43,220,251,23,251,24,43,58,251,4,71,167,96,203,105,30,
+57,94,105,86,55,26,251,26,242,46,247,41,247,40,242,232,247,26,223,105,192,
+57,184,30,251,26,247,117,21,201,182,101,84,85,95,100,78,76,96,177,195,193,
+182,177,202,31,137,251,173,21,208,182,93,65,71,95,94,71,71,96,184,209,211,
+182,185,207,31,14,47,177,247,57,21,251,1,142,231,59,247,14,27,230,208,177,
+211,181,31,176,202,161,246,247,6,26,243,123,219,106,193,30,215,94,69,179,
+54,27,251,34,42,37,251,40,251,38,225,39,247,18,175,173,149,155,161,31,152,
+148,147,148,162,165,8,251,29,101,74,60,89,106,166,181,136,30,229,248,81,21,
+207,181,87,55,61,96,87,74,75,99,189,221,221,178,191,202,31,14,251,207,247,
+155,122,10,248,156,4,190,29,14,251,207,247,5,117,10,248,10,4,190,29,14,75,
+248,165,248,110,21,252,125,251,73,5,251,13,143,29,75,248,170,248,47,150,10,
+14,75,179,129,113,10,102,248,5,247,93,21,205,146,150,199,181,30,232,205,166,
+183,223,26,247,28,37,233,251,39,53,72,109,80,96,30,106,95,126,91,138,57,8,
+247,28,6,229,181,194,208,198,184,90,73,94,127,120,81,91,30,59,71,116,94,142,
+54,8,247,32,84,21,190,29,14,247,219,249,24,248,144,21,123,77,5,189,115,105,
+161,83,27,71,70,105,82,94,31,93,82,111,64,71,26,44,212,63,230,194,195,167,
+186,178,30,147,114,147,129,159,125,8,122,164,170,130,172,27,199,199,169,193,
+187,31,194,202,166,208,222,26,246,104,223,63,213,30,221,54,251,1,182,251,
+19,27,251,27,251,10,90,44,47,31,50,47,85,251,20,251,13,26,251,7,196,251,5,
+233,65,30,74,221,236,109,247,19,27,234,211,153,170,209,31,111,212,5,114,81,
+62,124,67,27,48,53,168,191,72,31,61,200,99,222,239,26,239,177,240,204,214,
+30,222,211,235,182,247,8,27,237,220,109,77,209,31,205,80,171,72,59,26,81,
+121,82,106,93,30,95,106,97,111,104,27,109,120,158,169,151,139,140,147,168,
+31,217,247,172,5,251,115,78,21,191,171,100,76,88,113,72,102,96,31,111,115,
+104,120,110,27,88,101,185,200,242,216,239,218,31,14,213,34,10,14,213,58,29,
+213,38,29,14,213,65,10,14,158,39,29,14,102,247,116,247,206,21,247,211,247,
+17,251,211,184,29,6,14,247,22,36,29,14,213,108,29,63,29,14,47,80,10,14,213,
+82,29,102,67,10,14,247,77,78,10,213,51,29,14,247,22,32,10,14,158,76,10,247,
+22,249,45,242,21,188,199,170,239,237,26,246,101,242,75,208,30,207,76,57,172,
+35,27,35,57,106,71,76,31,74,70,102,36,251,1,26,251,1,177,36,203,233,10,215,
+194,154,174,197,31,225,58,215,220,5,251,157,247,143,21,63,58,216,66,5,127,
+115,107,132,107,27,251,12,59,240,247,45,247,46,218,239,247,14,247,14,218,
+39,251,47,79,128,85,117,95,31,14,213,37,29,14,158,35,10,14,102,92,29,14,213,
+33,10,14,158,248,33,22,247,142,249,109,5,251,43,6,251,51,252,185,251,54,248,
+185,5,251,43,6,247,138,253,109,5,14,247,188,40,29,14,158,74,29,158,43,29,
+14,102,53,10,14,251,207,247,200,166,29,251,134,254,53,247,134,241,251,4,249,
+105,247,4,6,14,194,249,94,21,72,6,247,126,253,108,5,206,6,14,251,207,157,
+251,92,21,247,134,250,53,251,134,37,247,4,253,105,251,4,6,14,75,248,158,247,
+162,21,251,63,248,61,5,251,17,6,251,57,252,61,5,247,4,6,247,7,247,192,247,
+13,251,192,5,14,47,248,214,251,12,224,29,247,98,120,10,14,47,32,29,14,102,
+198,166,29,253,109,247,32,194,7,86,173,186,114,207,27,247,21,237,247,15,247,
+55,212,117,213,103,191,31,192,102,73,173,73,27,71,92,114,85,105,31,247,151,
+7,247,10,251,189,21,208,188,69,39,40,91,70,69,68,92,206,243,238,187,207,209,
+31,14,47,38,10,14,102,248,41,64,10,14,47,33,29,14,251,207,58,10,14,102,50,
+10,14,102,70,10,14,247,99,134,29,247,102,248,176,84,29,47,91,29,14,104,10,
+14,247,133,199,182,10,252,176,247,32,247,216,7,206,175,178,208,10,247,216,
+7,205,175,179,208,10,248,18,7,244,75,201,251,0,70,92,115,83,97,30,190,113,
+85,168,72,27,77,99,119,83,93,31,206,7,14,102,44,10,14,102,35,29,14,102,247,
+90,186,29,79,232,29,247,14,247,56,215,117,215,103,189,31,190,103,72,173,74,
+27,71,91,188,10,40,91,71,69,68,92,207,240,241,186,207,210,31,14,102,248,40,
+182,10,59,7,198,106,89,169,72,27,251,22,43,251,14,251,57,63,161,63,175,90,
+31,88,175,206,105,203,27,207,189,168,198,172,31,251,174,247,32,249,138,7,
+251,150,251,0,21,211,185,71,34,41,91,71,69,69,91,207,240,240,187,208,209,
+31,14,251,151,48,29,14,47,34,29,14,251,207,55,29,14,102,36,10,14,47,247,242,
+114,29,247,22,42,29,14,47,247,247,78,29,47,39,10,14,251,40,54,10,14,251,151,
+247,209,166,29,63,6,68,140,86,78,140,59,8,251,103,7,97,140,118,118,94,27,
+127,6,135,47,6,202,140,158,122,138,82,8,251,102,7,137,59,193,78,210,140,8,
+215,238,102,6,105,127,158,185,140,31,247,87,7,211,113,168,68,148,30,210,147,
+165,168,211,26,247,87,7,178,138,154,157,170,27,176,6,14,252,4,247,72,166,
+29,59,254,53,219,6,14,251,151,211,251,92,21,215,6,210,138,192,200,138,219,
+8,247,103,7,181,138,160,160,184,27,151,6,143,231,6,76,138,120,156,140,196,
+8,247,102,7,141,219,85,200,68,138,8,63,40,176,6,173,151,120,93,138,31,251,
+87,7,67,165,110,210,130,30,68,131,113,110,67,26,251,87,7,100,140,124,121,
+108,27,102,6,14,75,248,77,248,47,21,138,112,138,135,136,131,8,121,131,123,
+130,115,27,118,125,144,159,113,31,82,181,5,156,115,113,147,106,27,60,96,91,
+42,134,31,217,6,140,166,140,142,142,147,8,157,147,155,148,163,27,160,156,
+132,122,162,31,196,97,5,121,165,163,131,172,27,219,180,187,237,145,31,14,
+251,207,205,251,78,21,247,42,247,102,6,98,247,201,5,72,6,97,251,201,5,248,
+6,4,223,10,47,247,195,248,71,21,186,132,164,111,152,77,8,247,26,6,131,247,
+16,51,224,251,15,141,8,224,95,53,7,251,36,124,61,38,251,65,26,251,58,222,
+34,247,31,130,30,37,7,183,138,5,241,7,247,11,143,228,224,150,247,12,8,251,
+26,6,124,78,115,111,93,132,8,95,142,21,86,154,110,197,232,26,238,168,200,
+192,152,30,14,47,248,11,248,7,21,251,31,6,133,153,134,152,120,177,193,29,
+170,165,175,10,247,24,6,134,198,131,172,124,168,8,210,103,61,178,35,27,72,
+84,122,107,235,29,94,147,118,184,60,30,79,84,228,6,155,99,144,119,114,26,
+81,112,102,56,83,30,194,38,5,99,29,122,119,142,146,113,31,149,100,132,140,
+121,27,110,119,133,108,76,31,224,206,170,185,197,26,159,136,152,127,165,30,
+247,14,6,14,247,197,71,10,14,47,248,133,247,243,21,251,29,6,247,84,247,245,
+5,251,27,6,251,26,251,146,251,31,247,146,5,251,31,6,247,95,251,245,5,251,
+30,80,247,37,86,251,37,80,247,37,251,72,247,32,247,72,247,34,198,251,34,192,
+247,34,6,14,47,248,136,248,116,21,251,15,6,146,180,5,211,151,164,174,178,
+27,156,149,136,126,167,31,159,247,7,5,152,96,118,143,107,27,34,82,76,251,
+34,115,31,129,80,5,251,31,42,247,15,6,80,252,12,5,56,126,122,111,103,27,123,
+122,145,154,115,31,115,251,7,5,123,172,164,133,171,27,189,185,157,169,168,
+31,173,173,160,193,152,224,198,248,18,24,247,29,6,14,47,248,109,248,180,21,
+137,188,132,166,122,166,8,187,108,74,167,61,27,251,13,51,67,39,108,149,106,
+156,117,31,145,131,142,135,164,114,8,67,84,119,107,79,26,84,167,92,190,109,
+30,247,63,39,180,116,139,139,150,129,25,150,128,146,123,121,26,103,108,114,
+94,113,117,147,153,125,30,126,151,135,153,137,171,8,149,251,23,7,251,25,140,
+210,71,247,31,27,247,22,227,216,247,6,196,116,183,92,172,31,206,170,166,179,
+206,26,207,109,187,72,176,30,251,19,209,5,68,178,120,157,168,26,169,164,159,
+178,186,163,115,86,146,30,130,251,130,21,186,114,153,122,107,26,116,127,121,
+105,115,30,251,39,219,5,97,162,127,155,170,26,168,152,157,169,157,30,14,47,
+248,24,248,164,21,158,110,99,150,101,27,102,98,127,120,108,31,62,216,70,71,
+218,60,5,120,109,129,102,101,26,100,147,112,161,99,30,61,62,207,70,218,217,
+5,120,166,183,127,179,27,176,155,144,164,186,31,214,64,208,207,62,215,5,159,
+174,148,173,178,26,177,133,163,118,180,30,214,214,70,208,5,251,73,251,33,
+21,197,187,90,81,79,91,91,80,80,91,187,198,200,187,186,199,31,14,252,46,140,
+29,14,251,40,247,102,120,10,247,254,22,129,29,14,47,227,126,29,247,105,251,
+6,131,29,14,251,207,222,126,29,14,251,207,247,139,125,10,14,102,58,10,247,
+119,243,94,29,102,58,10,247,119,247,185,212,29,47,248,193,247,203,21,252,
+202,35,248,202,6,14,47,248,159,160,29,252,199,247,26,248,199,247,71,6,14,
+47,248,156,160,29,251,115,251,71,251,8,247,71,251,116,247,26,247,116,247,
+71,247,8,251,71,247,115,247,71,6,14,130,29,47,248,165,166,29,251,195,6,74,
+87,113,86,101,31,106,95,121,83,84,26,251,21,224,46,247,14,133,30,252,94,237,
+249,228,202,253,228,237,249,228,182,7,14,251,190,247,69,248,61,21,68,83,84,
+69,70,195,83,208,208,195,195,208,208,83,195,72,31,14,205,247,17,77,29,14,
+251,40,211,247,17,77,29,229,121,29,251,40,212,249,109,77,29,236,121,29,47,
+247,147,125,10,247,99,247,7,131,10,14,247,244,247,134,122,10,247,225,122,
+10,247,225,122,10,14,247,244,247,52,249,119,21,57,72,73,57,132,10,100,101,
+107,170,178,177,170,170,178,31,247,228,218,21,252,56,253,139,5,205,6,248,
+57,249,139,5,47,252,100,21,57,72,72,58,113,29,171,170,177,31,248,5,219,21,
+57,72,73,57,113,29,170,170,178,31,14,102,247,131,247,231,21,74,132,127,79,
+97,30,45,73,112,95,55,26,251,28,241,45,247,40,225,206,169,198,182,30,172,
+183,152,187,140,221,8,251,28,6,49,97,84,70,79,94,188,205,184,151,158,198,
+187,30,219,207,162,184,136,224,8,251,32,194,21,223,10,251,207,156,84,10,251,
+207,247,209,96,29,251,207,247,8,249,137,45,29,251,207,247,174,46,29,251,207,
+247,207,249,99,69,29,251,207,247,191,249,128,71,29,251,207,247,114,249,123,
+92,10,251,207,247,20,56,29,251,207,247,60,249,150,62,29,14,251,207,247,54,
+22,85,33,5,149,159,148,141,102,29,124,200,29,168,202,5,14,251,207,247,44,
+249,137,62,10,251,207,247,61,22,62,111,92,87,80,26,81,221,29,186,7,135,121,
+120,137,119,27,86,116,155,173,190,163,169,224,191,31,14,251,207,247,111,248,
+243,89,10,247,244,181,29,247,244,68,10,14,251,170,247,213,247,232,21,251,
+176,61,247,176,6,147,247,40,21,124,153,134,148,156,26,247,71,7,205,94,173,
+51,50,94,101,65,137,30,218,6,172,143,154,150,179,27,171,156,128,119,128,134,
+131,129,134,31,128,133,139,139,97,132,106,133,24,74,128,108,106,80,26,80,
+178,100,199,175,172,155,169,168,30,123,141,133,147,129,30,231,6,37,247,22,
+21,91,114,111,97,110,122,154,163,164,152,151,174,146,30,168,145,161,143,143,
+140,149,144,25,14,102,247,122,248,59,21,247,198,251,42,252,19,7,59,83,5,50,
+7,219,195,5,251,149,248,153,247,17,252,3,247,101,7,247,57,247,5,5,227,7,14,
+247,22,48,10,14,247,244,249,4,247,206,21,247,191,247,17,251,191,247,57,247,
+219,247,17,252,107,87,6,187,91,100,155,75,27,251,70,251,15,251,48,251,118,
+251,115,247,16,251,51,247,65,207,177,159,201,188,31,80,248,126,247,17,251,
+238,7,251,42,192,21,88,110,104,117,85,27,32,68,240,247,45,247,45,210,240,
+246,193,174,117,88,168,31,14,251,175,247,226,247,232,21,251,193,61,247,193,
+6,251,43,248,103,21,39,79,74,32,33,200,74,238,238,200,204,243,247,2,80,203,
+38,31,71,4,185,169,98,75,79,108,97,94,93,109,181,201,201,169,180,185,31,14,
+247,133,43,10,14,73,10,14,247,88,248,78,21,247,179,251,32,251,248,7,83,99,
+5,60,7,195,179,5,251,186,247,32,247,255,7,195,179,5,218,7,14,102,52,29,14,
+247,188,249,156,247,44,21,99,126,96,111,90,27,99,104,157,169,121,31,125,162,
+133,164,138,185,8,247,254,6,163,29,251,3,27,63,78,113,89,96,31,190,90,74,
+164,58,27,251,58,240,29,251,70,240,251,0,247,58,219,203,164,189,190,31,90,
+183,201,113,212,27,247,13,237,208,245,170,31,253,4,247,176,100,29,247,161,
+251,9,21,142,171,144,158,148,157,8,172,156,174,160,177,27,172,172,122,111,
+158,31,152,120,145,119,143,100,8,14,102,247,177,247,241,21,152,6,225,190,
+93,61,69,91,88,70,137,31,119,6,137,134,139,138,133,31,251,4,7,135,172,156,
+137,161,27,247,23,226,240,247,44,201,125,177,102,173,31,113,163,121,149,104,
+146,8,196,161,169,186,206,26,246,45,214,251,27,70,72,120,108,100,30,96,105,
+121,90,61,26,252,154,247,32,248,173,7,189,171,168,194,200,176,108,87,85,102,
+105,78,138,30,130,6,14,251,207,247,30,154,29,14,75,179,248,11,21,62,248,63,
+251,104,216,247,181,7,14,102,247,84,251,112,21,247,127,7,112,167,169,128,
+181,27,185,169,153,179,179,31,99,163,163,125,186,27,167,158,144,151,162,31,
+226,7,136,129,135,138,133,27,115,133,154,197,31,248,26,251,32,251,230,7,77,
+97,95,80,111,115,151,160,125,30,125,159,135,157,178,26,247,226,251,32,253,
+140,7,14,247,244,247,195,249,31,21,247,25,217,252,1,61,247,29,252,14,234,
+6,248,88,22,222,247,241,5,251,241,230,248,92,251,29,7,55,251,242,53,247,242,
+5,251,29,252,92,230,247,241,6,224,251,241,5,14,213,56,10,247,78,142,29,248,
+183,247,34,127,10,247,62,253,14,184,10,163,156,168,160,101,10,178,161,115,
+99,94,125,124,40,72,180,10,75,248,163,242,21,252,107,251,11,248,107,6,248,
+84,4,251,68,247,68,251,11,251,68,251,68,251,11,247,68,251,68,247,11,247,68,
+247,68,6,14,158,247,118,247,32,21,247,79,6,247,27,224,232,247,41,213,119,
+195,97,180,31,178,99,88,156,57,27,251,64,247,12,174,29,6,247,157,161,10,247,
+78,142,29,248,189,247,34,127,10,247,35,99,10,75,248,170,247,183,227,10,251,
+196,247,194,228,29,251,16,251,254,128,29,252,4,247,72,166,29,59,252,25,219,
+6,251,43,4,59,252,25,219,6,14,251,140,247,92,249,66,21,55,71,71,56,56,207,
+70,221,224,207,206,224,222,71,207,56,31,76,4,187,179,100,90,89,99,100,89,
+92,99,179,187,188,179,179,188,31,14,102,247,90,166,29,251,32,254,71,247,32,
+247,174,6,80,232,29,247,13,247,56,247,57,43,247,14,251,22,71,91,118,29,247,
+78,247,29,57,10,248,107,247,74,127,10,247,10,99,10,251,207,247,209,248,1,
+184,10,162,155,169,161,101,10,177,162,115,99,94,124,123,41,73,180,10,228,
+247,180,247,205,21,230,6,181,158,124,105,31,122,7,138,130,139,128,133,26,
+93,141,127,152,116,30,241,160,6,125,147,134,146,158,26,136,247,20,137,146,
+88,163,8,187,163,160,172,190,26,215,94,184,63,30,251,129,252,79,235,6,247,
+146,4,247,0,241,7,188,155,126,98,98,123,126,90,31,118,247,241,61,10,75,248,
+180,247,183,21,252,140,251,11,248,140,6,14,102,248,68,249,90,21,88,173,52,
+87,131,142,133,142,138,140,25,109,156,124,147,122,147,114,148,25,72,92,188,
+115,153,131,166,123,25,69,95,181,102,216,185,177,117,169,108,166,96,25,154,
+100,119,143,113,27,96,95,126,115,100,31,63,94,102,62,251,2,26,251,72,239,
+251,0,247,59,225,212,170,195,186,30,180,190,159,205,227,26,247,58,70,247,
+15,251,44,241,30,93,251,123,21,216,188,73,33,39,89,72,63,62,90,205,243,241,
+188,206,216,31,14,75,248,57,248,80,21,251,21,251,21,251,21,247,21,55,54,247,
+21,251,20,251,20,251,20,223,55,247,20,247,20,247,20,251,21,223,223,251,20,
+247,21,247,21,247,21,5,14,251,207,247,17,57,10,14,228,248,188,248,67,21,136,
+180,131,163,120,165,8,184,105,84,164,72,27,251,17,61,50,251,35,251,35,216,
+50,247,16,247,4,212,203,244,144,31,47,6,83,134,105,109,82,27,69,98,193,233,
+233,182,195,210,192,168,115,85,150,31,46,247,204,61,10,213,34,10,247,37,248,
+15,42,10,213,34,10,87,248,15,90,29,213,34,10,100,248,1,40,10,213,34,10,251,
+36,248,15,52,10,213,34,10,140,248,28,62,29,14,213,34,10,247,11,248,7,66,29,
+213,248,15,116,21,247,74,143,247,8,242,147,247,57,72,29,251,21,177,36,212,
+69,31,187,94,178,121,232,123,96,56,24,148,158,149,142,102,29,123,127,137,
+134,125,31,14,158,39,29,247,143,249,191,42,10,158,39,29,203,249,191,45,10,
+158,39,29,217,249,177,40,10,158,39,29,118,249,191,52,10,63,29,216,96,10,63,
+29,251,16,250,60,45,29,91,10,63,29,251,115,250,60,52,10,213,51,29,247,160,
+248,60,21,107,135,237,10,120,142,142,132,31,67,164,5,151,106,135,140,121,
+27,83,98,29,149,148,136,29,247,22,32,10,247,31,247,215,42,10,247,22,32,10,
+88,247,215,45,29,247,22,32,10,101,247,201,40,10,247,22,32,10,251,29,247,215,
+52,10,247,22,248,26,44,29,247,13,247,207,21,107,135,128,123,118,27,132,119,
+142,142,132,31,68,164,5,151,106,134,140,121,27,83,104,93,61,136,31,201,6,
+171,144,151,152,163,27,148,165,10,160,158,135,154,224,10,158,35,10,53,247,
+171,49,29,213,33,10,251,42,247,99,42,10,213,33,10,251,232,247,99,45,29,213,
+33,10,251,219,247,85,40,10,213,33,10,252,62,247,99,52,10,158,43,29,200,96,
+10,158,43,29,251,7,64,29,102,53,10,251,111,247,74,49,29,47,32,29,195,248,
+138,42,10,47,32,29,251,26,248,138,137,10,47,32,29,251,13,248,124,40,10,47,
+32,29,251,115,248,138,52,10,47,32,29,57,248,151,62,29,14,47,32,29,171,248,
+130,66,10,47,247,183,116,21,247,17,138,234,225,150,247,17,8,251,26,6,69,122,
+111,112,85,27,108,109,151,159,123,31,115,168,125,191,196,26,190,149,186,156,
+171,30,186,10,247,26,6,121,10,251,56,215,41,247,30,121,31,96,54,5,148,158,
+150,142,143,10,113,146,162,89,175,29,201,170,183,10,126,137,134,126,31,14,
+47,33,29,179,248,74,42,10,47,33,29,251,42,248,74,137,10,47,33,29,251,29,248,
+60,40,10,47,50,29,73,10,222,96,29,73,10,251,10,249,137,45,29,247,99,97,10,
+73,10,251,109,84,10,102,44,10,247,105,247,101,66,10,102,35,29,247,31,247,
+213,42,10,102,35,29,88,247,213,45,29,102,35,29,101,247,199,40,10,102,35,29,
+251,29,247,213,52,10,102,35,29,247,10,247,205,21,107,135,127,123,119,27,131,
+120,142,142,132,139,29,151,152,162,27,149,165,10,159,158,135,154,27,199,170,
+225,29,47,34,29,102,247,133,49,29,102,36,10,176,96,29,102,36,10,251,45,249,
+137,90,29,102,36,10,251,32,56,29,102,36,10,251,130,84,10,47,39,10,251,18,
+247,109,42,10,47,39,10,251,195,247,95,40,10,251,40,54,10,251,48,247,72,49,
+29,251,144,181,248,222,21,251,211,237,247,54,7,200,160,166,187,175,155,121,
+98,30,251,83,237,247,90,7,179,135,161,127,157,30,169,120,99,158,95,27,95,
+109,125,105,113,31,179,7,14,157,57,29,14,247,187,55,10,243,94,29,247,187,
+55,10,247,185,212,29,247,78,248,200,71,10,252,162,251,34,163,10,249,105,251,
+233,73,29,102,101,109,29,14,247,78,248,233,71,10,205,252,119,85,10,58,247,
+26,21,177,165,117,106,106,113,116,101,102,113,162,172,172,165,161,176,31,
+251,60,4,158,10,252,163,247,165,59,29,14,247,78,248,220,71,10,218,252,119,
+203,29,61,60,81,90,73,98,155,127,29,59,247,26,21,176,165,116,107,106,113,
+116,101,103,113,163,171,171,165,162,176,132,29,252,8,248,164,21,251,119,6,
+101,251,129,5,215,6,160,148,158,151,164,27,183,164,108,87,89,113,108,97,102,
+118,157,174,137,31,57,6,66,138,197,87,222,27,231,201,202,231,226,85,199,60,
+111,118,132,120,115,31,152,228,5,247,68,6,14,247,78,248,191,71,10,231,252,
+119,73,29,101,102,109,29,251,193,248,164,21,251,191,64,247,103,6,47,251,5,
+100,47,121,251,38,8,224,6,147,247,27,183,242,239,247,14,8,14,251,207,247,
+55,249,98,21,90,97,120,103,112,31,112,106,127,85,57,26,63,150,87,160,106,
+30,99,167,183,116,192,27,188,180,158,175,167,31,166,172,151,192,219,26,218,
+129,190,117,172,30,181,112,95,161,85,27,65,4,185,155,101,251,5,251,1,123,
+102,93,93,123,176,247,2,247,4,155,177,185,31,14,251,207,247,215,248,88,104,
+29,251,207,247,196,249,89,21,251,137,6,98,251,131,5,225,6,160,148,158,150,
+165,27,183,164,110,90,92,113,110,97,101,119,157,173,138,31,46,6,63,137,201,
+86,229,27,237,206,202,231,227,81,199,55,111,124,135,121,108,31,152,216,5,
+247,77,6,14,251,207,247,207,248,243,21,134,169,133,155,127,155,8,170,116,
+96,157,90,27,251,3,81,58,251,44,69,149,92,162,104,31,99,165,187,116,193,27,
+230,201,203,232,222,85,195,58,107,113,130,119,114,31,140,174,141,154,145,
+153,8,168,151,159,153,168,27,167,152,130,111,151,31,79,251,5,21,178,164,111,
+94,96,112,108,101,101,113,169,181,184,165,169,178,31,14,251,207,247,219,249,
+89,21,251,213,59,247,110,6,42,251,7,102,55,120,251,38,8,235,6,147,247,27,
+184,239,246,247,13,8,14,251,207,247,148,248,151,21,180,169,152,161,174,26,
+206,76,188,56,55,76,90,72,103,153,117,179,110,30,90,112,119,108,90,26,57,
+204,83,236,235,204,195,221,188,120,169,89,167,30,47,247,21,21,177,164,118,
+109,109,113,117,103,101,113,160,170,169,165,160,176,31,138,251,58,21,181,
+164,113,98,100,113,114,98,99,113,164,179,179,165,165,179,31,14,251,207,151,
+248,24,21,70,140,198,90,220,27,247,1,197,220,247,47,201,129,186,118,172,31,
+185,110,94,163,84,27,48,76,78,49,51,195,79,221,173,162,148,162,163,31,72,
+114,102,94,108,120,154,165,138,30,193,247,148,21,179,164,110,91,95,113,110,
+100,101,116,167,185,186,162,168,177,31,14,247,29,247,106,100,10,247,253,83,
+29,14,213,34,10,212,248,6,65,29,213,248,137,247,39,21,187,251,39,5,214,6,
+61,111,93,88,80,26,78,192,105,234,166,160,142,145,166,204,10,116,155,176,
+188,183,189,208,169,31,103,10,14,213,38,29,110,248,90,42,10,213,38,29,251,
+4,247,196,136,10,213,38,29,251,11,248,76,92,10,213,65,10,168,249,41,49,29,
+213,56,10,158,39,29,247,59,249,41,89,10,158,39,29,247,63,249,177,92,10,158,
+247,121,145,29,248,107,6,53,100,100,96,83,218,10,166,30,186,7,136,121,120,
+137,119,27,88,115,156,175,186,176,182,210,178,31,247,17,252,31,7,14,247,22,
+36,29,251,73,250,53,21,83,6,92,130,117,120,94,27,94,160,10,14,247,22,36,29,
+251,171,250,48,92,10,63,29,119,250,46,92,10,102,67,10,207,249,191,42,10,102,
+67,10,239,248,240,37,10,213,51,29,247,174,248,68,42,10,213,51,29,247,91,247,
+174,136,10,247,22,32,10,209,247,215,62,10,213,37,29,222,248,158,189,29,213,
+37,29,248,8,4,148,10,158,35,10,138,248,65,42,10,158,247,232,116,21,247,87,
+148,237,218,247,41,26,247,6,81,199,251,27,165,30,141,29,247,32,6,79,10,149,
+251,38,223,62,247,63,121,97,56,24,149,158,149,141,124,10,221,185,172,199,
+184,110,165,91,124,128,137,135,124,31,14,102,92,29,116,249,166,49,29,213,
+33,10,251,180,247,112,62,29,14,213,33,10,251,113,247,99,62,10,102,53,10,251,
+29,247,224,42,10,102,53,10,251,108,247,210,92,10,213,34,10,247,41,247,233,
+69,29,102,92,29,251,25,79,37,10,213,38,29,251,112,248,90,45,10,247,188,40,
+29,251,66,250,60,45,10,247,188,40,29,251,53,64,29,158,43,29,251,28,250,60,
+45,29,213,248,143,247,223,21,251,223,247,42,248,173,206,219,72,247,4,251,
+42,251,4,251,181,247,4,251,42,251,4,72,59,206,252,173,247,42,247,223,7,247,
+181,243,10,251,181,220,247,181,6,14,158,39,29,247,157,249,153,69,29,247,22,
+36,29,252,9,250,62,45,10,213,111,10,231,248,241,45,10,63,29,200,250,22,21,
+251,164,60,247,164,6,14,247,105,190,10,223,6,62,98,103,96,87,26,79,190,102,
+221,162,160,142,145,165,30,186,7,136,123,118,137,126,27,102,113,160,169,182,
+171,186,196,180,31,14,47,80,10,251,19,247,99,45,10,213,86,29,230,79,37,10,
+102,67,10,178,251,77,37,10,213,51,29,221,252,200,37,10,247,22,32,10,247,42,
+247,177,69,29,213,37,29,46,252,110,37,10,158,35,10,251,92,248,65,45,29,247,
+22,36,29,252,15,81,37,10,213,33,10,251,31,247,61,69,29,213,248,233,251,69,
+21,135,120,121,137,118,27,87,114,156,173,174,158,174,185,188,31,247,0,247,
+3,154,170,143,245,8,248,130,251,42,108,10,230,27,178,162,142,152,186,31,62,
+91,112,104,91,26,98,161,111,185,124,30,131,163,164,135,166,27,168,163,142,
+146,166,31,14,158,39,29,247,139,249,182,110,10,63,29,197,250,51,110,10,47,
+247,116,140,10,247,147,75,84,29,247,95,22,248,218,7,167,151,153,165,151,229,
+10,108,111,140,117,27,48,94,95,48,31,74,62,46,216,252,72,7,14,47,32,29,191,
+248,129,110,29,47,60,29,216,6,62,112,92,86,80,26,80,193,104,233,167,159,141,
+146,166,30,186,7,136,120,120,137,120,27,87,115,156,175,186,177,184,210,176,
+31,112,10,14,47,38,10,178,248,55,42,10,47,38,10,92,247,161,137,29,47,38,10,
+94,248,41,92,10,234,248,43,64,10,247,203,247,189,37,10,102,248,41,248,232,
+21,251,18,7,179,29,251,54,237,251,15,247,21,207,185,163,193,174,31,84,247,
+32,248,232,199,206,79,205,251,32,73,251,25,72,7,154,251,56,178,29,239,187,
+209,209,31,14,47,33,29,91,247,180,137,29,47,33,29,95,248,60,92,10,47,248,
+114,251,69,21,135,120,121,137,119,27,87,115,155,175,183,159,173,208,213,31,
+197,201,151,157,153,190,8,251,30,6,95,122,101,114,88,27,99,106,156,169,120,
+31,126,160,134,163,137,190,8,196,10,190,126,176,239,10,251,2,194,10,32,247,
+45,167,157,142,149,175,31,68,90,115,107,94,26,79,221,29,251,207,248,179,21,
+222,148,174,179,202,27,203,177,96,59,146,31,14,102,248,72,249,128,116,29,
+103,251,89,41,10,102,247,243,249,123,105,10,188,58,41,10,104,10,210,96,10,
+251,140,104,10,192,249,109,37,10,102,44,10,247,128,247,109,42,10,102,44,10,
+247,41,206,49,29,102,35,29,208,247,213,62,10,251,151,48,29,247,37,247,109,
+42,10,47,34,29,188,248,27,189,29,47,34,29,251,32,248,27,174,10,216,6,221,
+189,10,47,34,29,251,35,252,62,37,10,251,151,55,29,114,248,29,37,10,102,36,
+10,39,249,150,62,29,14,102,36,10,109,249,137,62,10,251,40,54,10,67,247,222,
+42,10,251,40,54,10,251,45,247,208,92,10,102,247,99,249,52,21,196,251,32,82,
+77,59,201,252,228,223,29,169,162,128,117,155,30,152,120,143,125,147,10,93,
+27,71,89,111,80,100,31,247,22,247,71,219,7,14,251,207,55,29,251,66,252,132,
+37,10,247,22,42,29,251,23,249,125,90,29,247,22,42,29,251,17,56,29,47,32,29,
+206,248,100,69,29,47,39,10,251,204,247,109,45,10,47,38,10,251,53,248,55,45,
+10,47,33,29,190,248,36,69,29,102,50,10,60,247,217,45,29,73,10,199,249,120,
+71,29,247,100,101,29,198,249,99,21,251,151,60,247,151,6,14,247,102,248,176,
+107,29,251,15,249,231,45,29,47,91,29,251,39,252,236,37,10,104,10,251,21,79,
+37,10,102,44,10,180,252,236,37,10,102,35,29,247,42,247,175,69,29,251,151,
+48,29,251,21,252,236,37,10,102,36,10,104,249,128,21,93,130,117,119,94,27,
+94,114,160,184,132,31,84,6,138,135,139,134,138,26,63,195,82,215,219,191,195,
+226,30,14,102,36,10,187,249,99,69,29,102,248,101,22,115,130,131,136,125,130,
+8,90,111,109,93,96,218,10,167,204,10,115,156,175,186,177,184,212,176,31,93,
+29,14,251,151,48,29,200,206,89,10,47,247,175,116,21,157,6,247,21,229,214,
+247,0,209,104,184,68,160,31,153,10,140,30,247,27,6,69,10,144,251,1,201,86,
+247,35,122,96,55,24,148,157,150,83,10,102,247,250,248,242,21,247,4,72,7,138,
+189,161,169,185,148,8,185,7,69,137,84,75,142,61,8,36,7,247,56,73,41,10,47,
+169,247,210,21,115,71,5,211,6,152,75,159,87,170,93,8,72,184,222,95,218,27,
+178,173,147,165,218,31,247,41,7,97,61,111,129,99,27,79,91,190,230,113,31,
+247,73,6,164,207,5,251,109,6,137,149,139,146,149,26,153,140,150,141,155,30,
+247,132,6,163,207,5,251,143,6,231,163,184,187,201,27,185,176,122,89,202,31,
+184,247,21,5,192,67,99,154,69,27,251,36,34,40,251,63,102,31,91,6,115,71,5,
+202,6,138,127,139,130,127,26,127,139,130,141,125,30,14,248,82,249,46,247,
+178,21,95,217,55,61,100,85,178,251,68,6,93,164,117,195,157,152,141,143,155,
+30,192,7,137,130,134,139,132,27,120,135,145,164,31,247,48,183,7,209,251,39,
+21,75,141,190,106,234,27,224,191,177,200,176,118,164,97,150,31,38,167,5,118,
+145,134,143,152,26,156,156,149,166,177,155,128,110,141,30,220,6,200,138,87,
+177,55,27,61,89,102,79,100,155,122,192,123,31,235,110,5,158,134,145,133,127,
+26,120,119,129,101,98,124,149,167,134,30,252,213,247,67,21,176,169,10,251,
+64,200,10,248,21,4,247,111,159,7,198,167,104,64,65,111,104,80,31,14,47,248,
+11,247,208,21,194,251,31,7,135,149,130,159,122,174,193,29,169,166,175,10,
+247,23,6,135,198,131,172,124,168,8,210,102,62,178,35,27,72,84,123,106,235,
+29,96,147,116,180,67,30,143,132,5,79,84,228,6,143,127,144,126,141,132,8,39,
+84,247,1,6,138,81,114,105,56,82,194,38,24,99,29,121,120,142,146,112,31,149,
+100,132,140,122,27,110,118,132,109,77,31,208,192,174,184,148,184,8,247,2,
+194,251,2,6,136,150,136,146,133,153,8,14,47,248,58,248,75,21,251,142,184,
+29,247,206,247,2,251,206,247,32,247,78,6,221,180,180,221,153,150,216,10,135,
+139,134,27,74,85,97,66,108,31,14,130,29,130,29,251,207,173,29,247,244,181,
+29,247,129,248,31,248,212,21,236,131,76,197,41,27,251,9,72,62,251,25,251,
+21,206,64,247,8,233,205,199,233,149,31,251,6,6,97,129,123,123,109,27,99,115,
+179,207,215,160,177,182,170,154,124,95,149,31,248,5,251,71,21,251,11,66,61,
+251,21,251,20,212,61,247,12,247,11,213,217,247,18,247,24,68,216,251,15,31,
+140,43,21,184,168,95,71,74,109,95,95,95,109,183,205,206,169,183,183,31,66,
+248,44,21,252,20,253,89,5,219,6,248,19,249,89,5,14,247,108,166,29,251,27,
+251,1,6,135,52,190,83,227,131,8,185,7,83,149,113,168,141,189,8,219,6,14,247,
+197,71,10,14,251,207,247,207,249,99,69,29,47,32,29,50,248,151,62,29,176,247,
+62,42,10,102,70,10,251,5,247,99,45,29,47,33,29,172,248,65,110,29,247,99,182,
+10,251,32,252,176,216,6,64,95,104,96,90,26,79,190,102,222,159,151,141,146,
+170,30,186,7,135,116,128,138,129,27,124,125,143,146,126,31,123,149,134,150,
+161,26,184,168,183,193,178,30,202,29,14,251,61,247,111,202,10,236,248,61,
+128,29,102,35,29,247,21,247,204,71,29,102,52,29,165,248,3,42,10,73,10,186,
+46,29,102,36,10,159,46,29,102,67,10,247,43,247,192,128,29,247,22,32,10,214,
+247,206,65,29,158,35,10,251,77,252,203,37,10,102,247,255,22,161,248,240,187,
+10,224,6,85,33,5,149,158,149,141,144,29,116,146,162,86,153,29,124,200,29,
+14,251,207,247,63,121,21,135,156,155,138,155,27,170,163,142,147,165,31,237,
+7,137,125,132,138,127,27,102,131,150,186,31,247,187,188,29,251,224,7,84,154,
+109,176,116,30,86,37,5,149,159,149,141,143,10,118,145,163,84,175,29,205,166,
+148,29,213,33,10,251,108,247,90,65,29,213,34,10,137,248,28,62,29,169,247,
+61,42,10,247,22,48,10,106,248,17,42,10,247,244,68,10,247,156,247,224,42,10,
+214,248,30,251,179,21,134,182,176,137,169,27,199,182,156,173,162,31,157,166,
+146,172,208,26,248,239,7,234,119,195,88,184,30,176,98,84,158,77,27,45,74,
+103,57,88,31,245,174,29,248,86,7,185,156,178,170,165,30,161,166,171,149,190,
+27,234,174,105,44,31,252,183,7,81,128,126,94,121,126,141,143,116,30,14,102,
+248,21,248,90,21,247,42,208,29,251,42,251,38,59,247,38,252,10,247,42,248,
+10,247,39,219,7,14,102,247,232,251,105,21,136,166,173,137,161,27,229,172,
+173,229,31,248,92,7,208,122,184,101,171,30,165,108,95,154,88,27,66,90,113,
+78,99,31,217,251,32,207,29,207,202,167,109,73,30,252,26,7,103,129,126,111,
+129,133,140,143,127,30,14,251,207,247,115,247,229,21,238,188,29,40,80,72,
+198,251,58,7,54,184,97,231,171,161,142,147,166,30,237,7,137,125,131,138,128,
+27,103,130,150,187,31,247,20,210,206,7,14,47,247,51,247,62,21,191,194,247,
+59,251,117,5,247,18,6,251,117,247,183,247,96,247,111,5,251,17,6,251,91,251,
+116,5,247,116,34,252,146,244,7,14,199,247,38,88,10,251,163,247,81,37,10,213,
+33,10,251,69,247,91,66,29,247,133,43,10,251,53,248,74,42,10,63,29,180,250,
+52,21,107,136,237,10,120,142,142,131,31,68,164,5,151,106,134,140,121,27,84,
+98,29,149,148,137,135,150,195,29,170,181,224,144,31,14,247,188,40,29,251,
+134,250,60,52,10,247,188,40,29,173,96,10,247,22,42,29,251,98,84,10,247,22,
+42,29,162,96,29,158,43,29,251,72,250,60,52,10,47,39,10,252,45,247,109,52,
+10,251,40,14,14,248,9,248,147,95,29,90,4,247,67,247,33,251,33,251,67,251,
+68,251,33,251,32,251,69,251,67,251,31,247,34,247,71,247,62,247,35,247,33,
+247,65,31,251,1,251,55,150,29,251,20,251,0,21,146,54,150,98,169,94,8,76,181,
+203,107,222,27,216,199,166,193,181,31,175,186,154,184,146,232,128,89,128,
+117,113,109,8,84,91,79,113,58,27,58,79,165,194,91,31,113,169,128,161,128,
+189,8,247,238,247,0,150,29,14,248,40,248,163,95,29,251,1,251,99,152,29,251,
+20,251,5,21,150,89,150,117,165,109,8,84,187,199,113,220,27,220,199,165,194,
+187,31,165,169,150,161,150,189,132,54,128,98,109,94,8,76,97,75,107,56,27,
+62,79,166,193,97,31,103,186,124,184,132,232,8,247,238,247,5,152,29,14,85,
+247,188,111,21,159,229,199,242,247,8,247,37,8,235,247,14,171,206,218,26,222,
+69,207,55,91,95,118,101,106,30,117,114,129,117,126,93,127,175,131,157,127,
+157,8,189,106,88,168,84,27,54,73,71,50,72,160,94,223,251,6,31,247,43,251,
+94,179,71,165,36,8,14,251,30,144,247,241,21,240,251,17,247,16,251,69,177,
+64,199,247,0,247,5,247,52,244,247,17,59,230,251,57,247,125,106,207,83,36,
+65,34,251,38,251,76,8,14,147,248,215,22,159,7,36,159,110,153,93,187,92,191,
+122,192,138,235,160,102,147,126,151,125,8,93,178,201,108,192,27,230,210,213,
+233,229,74,211,58,110,132,137,110,80,31,167,180,150,170,176,26,227,66,210,
+48,46,68,69,49,103,146,120,173,86,30,163,91,118,145,108,27,64,73,63,52,46,
+212,66,231,220,207,189,230,184,31,140,123,139,128,134,26,67,101,58,85,95,
+30,107,114,116,130,44,119,8,119,7,14,251,9,199,22,248,119,162,6,251,53,147,
+63,224,142,247,62,8,56,183,185,106,212,27,209,197,201,213,207,113,180,32,
+236,31,251,1,240,120,166,100,247,9,123,47,80,53,33,53,8,59,72,104,83,75,26,
+64,200,77,212,181,180,156,169,171,30,158,157,150,154,156,176,145,251,59,52,
+44,251,51,138,8,14,241,248,20,248,130,21,159,100,115,146,105,27,40,54,54,
+39,43,224,57,239,237,223,225,240,185,121,181,104,174,31,247,42,247,42,144,
+114,159,90,154,109,25,119,150,144,133,149,27,146,144,145,146,144,138,143,
+137,150,31,132,171,137,161,168,26,177,142,169,146,164,30,144,156,139,140,
+143,26,145,135,143,133,135,130,137,136,130,30,131,113,121,137,92,27,111,115,
+142,145,110,31,141,128,136,140,134,27,131,133,134,131,126,166,121,178,124,
+31,180,124,145,137,152,136,8,251,140,251,65,21,211,199,78,66,65,79,79,65,
+65,79,199,214,213,199,198,215,31,14,241,247,244,247,152,21,251,55,96,247,
+55,251,58,187,247,58,247,53,182,251,53,243,6,228,152,207,218,230,26,238,55,
+222,40,41,56,52,38,52,207,62,230,126,30,166,247,203,21,208,197,80,69,67,81,
+81,68,66,82,197,212,210,197,196,213,31,14,251,40,247,127,247,83,21,146,123,
+117,144,120,27,72,79,82,74,100,167,115,184,232,205,211,240,31,247,212,7,200,
+130,189,57,48,26,84,130,96,114,80,30,168,6,178,187,160,198,203,26,221,108,
+217,75,215,30,83,206,138,140,133,146,131,150,25,203,91,7,14,247,161,247,148,
+248,163,21,107,98,122,99,133,88,8,251,16,79,247,16,6,144,91,159,90,168,103,
+52,52,24,181,98,226,226,181,107,183,121,185,134,25,251,15,198,247,15,7,186,
+144,186,158,179,170,226,52,24,180,180,52,226,169,177,158,184,145,189,25,247,
+15,199,251,15,6,133,189,120,184,109,177,226,225,24,98,180,52,52,102,169,92,
+158,89,145,25,247,15,80,251,14,7,91,133,94,120,100,108,52,226,24,97,98,5,
+247,185,80,21,240,223,54,38,36,55,55,36,35,57,222,244,242,222,221,244,31,
+14,95,131,22,249,0,249,0,253,0,6,247,201,251,74,21,209,198,81,71,70,76,78,
+68,74,82,197,205,210,198,200,207,31,14,95,247,194,249,24,21,251,42,251,21,
+251,19,251,40,251,47,247,17,251,20,247,44,247,46,247,19,247,18,247,45,247,
+45,251,19,247,18,251,44,31,90,4,247,19,242,36,251,19,251,19,36,36,251,21,
+251,18,37,243,247,22,247,15,244,242,247,17,31,14,95,247,194,249,24,21,247,
+44,247,19,251,19,251,44,251,45,251,19,251,18,251,46,251,44,251,17,247,20,
+247,47,247,40,247,21,247,19,247,42,31,248,0,253,24,21,249,109,253,109,253,
+109,7,248,1,248,231,21,251,17,34,35,251,14,251,22,241,35,247,18,247,21,242,
+241,247,20,247,19,36,242,251,19,31,14,247,244,247,28,22,249,109,248,1,253,
+109,6,14,95,76,166,29,253,109,249,109,249,109,7,14,95,182,22,248,155,248,
+155,252,155,6,248,103,252,103,21,252,51,248,51,248,51,6,14,247,234,249,175,
+206,21,251,192,248,197,251,192,252,197,5,14,247,244,224,247,173,21,249,42,
+6,115,110,101,64,121,26,130,147,132,149,147,142,142,156,154,30,179,186,183,
+173,212,180,8,159,150,146,145,146,26,147,135,144,131,144,30,38,198,112,161,
+88,199,8,148,131,135,141,132,27,129,131,132,130,133,151,106,147,123,31,150,
+116,151,121,158,113,8,253,42,6,14,247,244,250,37,247,173,21,199,253,42,7,
+156,162,149,155,150,159,8,149,158,153,175,147,26,148,131,146,129,132,135,
+137,130,131,30,89,79,115,120,42,81,8,121,129,137,136,130,26,132,146,133,159,
+128,30,212,98,183,105,179,92,8,122,154,142,136,147,27,149,147,146,148,157,
+101,214,115,168,31,14,247,244,249,93,247,172,21,106,94,110,83,120,26,129,
+147,132,149,146,143,141,148,147,30,188,198,166,160,234,196,8,156,148,141,
+142,149,26,146,133,144,118,151,30,66,181,95,173,100,185,8,156,125,135,142,
+131,27,129,131,132,130,121,176,64,164,109,31,252,63,6,166,172,175,211,158,
+26,147,131,146,129,131,136,136,122,124,30,99,92,97,106,65,97,8,119,128,132,
+133,132,26,131,143,134,147,134,30,233,84,170,115,183,88,8,118,157,140,138,
+148,27,149,147,146,148,145,127,171,131,155,31,128,160,128,157,118,167,8,14,
+251,40,247,102,32,21,199,249,42,6,63,10,251,40,247,162,249,101,21,79,253,
+42,6,116,156,123,149,119,150,8,149,120,103,153,131,27,130,132,131,129,132,
+141,135,148,131,31,199,89,158,115,197,42,8,121,149,142,137,148,27,146,145,
+146,159,150,31,180,212,173,183,186,179,8,156,154,142,142,147,26,149,132,147,
+130,121,64,101,115,110,30,14,251,40,247,103,247,25,21,165,108,66,70,29,115,
+127,121,127,114,120,138,248,58,24,63,10,251,40,247,12,71,21,96,247,156,182,
+7,251,65,247,148,21,164,109,65,70,29,116,128,121,127,113,120,138,248,58,24,
+163,122,154,68,29,214,177,163,168,30,14,251,46,247,164,249,124,21,77,6,251,
+84,252,8,247,84,252,8,5,201,6,247,84,248,8,5,251,114,251,204,21,251,53,247,
+204,247,53,247,204,247,52,251,204,5,14,247,234,247,87,248,236,21,247,192,
+252,197,247,192,248,197,5,14,95,247,199,248,155,21,251,39,251,9,251,6,251,
+35,251,38,247,7,251,8,247,37,247,35,247,8,247,8,247,36,247,33,251,8,247,10,
+251,31,31,14,247,244,250,8,248,163,21,75,251,72,252,195,6,247,102,220,116,
+192,251,178,251,19,5,62,7,247,178,251,20,162,191,251,102,221,5,249,3,6,14,
+251,207,197,247,130,21,247,66,251,232,5,123,147,149,132,151,27,147,144,143,
+146,146,137,147,136,147,31,251,23,247,221,247,23,247,221,5,142,147,141,147,
+146,26,147,134,143,131,127,131,133,121,129,30,14,251,207,247,167,247,130,
+21,251,66,247,232,5,156,130,130,146,127,27,131,134,135,131,133,141,131,142,
+130,31,247,23,251,221,251,23,251,221,5,136,132,137,131,132,26,131,144,135,
+147,151,147,145,156,149,30,14,84,248,39,248,28,21,251,105,6,65,247,77,5,45,
+6,247,125,252,213,5,222,6,247,125,248,213,5,45,6,34,251,157,21,63,251,72,
+64,247,72,5,14,251,40,247,191,247,184,21,251,148,247,217,5,129,117,134,119,
+118,26,120,146,123,159,114,30,209,52,83,34,5,121,106,129,110,120,26,119,148,
+116,159,104,30,165,96,139,139,128,26,121,126,129,117,30,121,78,221,6,227,
+161,154,198,179,130,158,84,213,31,105,185,127,166,169,26,158,143,151,158,
+174,30,247,191,252,12,5,149,160,144,157,159,26,160,131,157,114,171,30,100,
+188,5,102,186,129,160,172,26,157,142,153,151,171,30,183,245,5,161,6,161,149,
+129,114,143,31,148,170,143,165,168,26,190,122,159,95,30,71,6,101,125,150,
+171,31,155,7,110,108,125,106,100,26,112,147,114,153,127,30,128,149,153,136,
+170,27,179,6,14,251,116,190,22,247,217,248,213,251,217,55,247,133,251,54,
+251,133,55,247,133,251,55,251,133,6,14,210,248,227,248,236,21,109,135,110,
+131,117,30,113,130,127,129,118,27,121,132,150,203,111,31,118,189,122,167,
+117,158,8,167,106,96,154,90,27,251,16,36,42,251,9,81,160,93,182,101,31,176,
+107,170,125,200,130,144,176,24,89,149,114,149,113,160,8,106,166,118,184,183,
+26,222,209,210,219,194,172,109,50,183,30,74,171,171,114,190,27,213,180,197,
+243,31,151,7,163,251,230,21,133,169,134,155,131,157,8,184,118,105,163,93,
+27,66,74,78,70,115,146,108,151,112,31,182,43,139,139,140,113,8,102,141,104,
+108,95,27,100,111,156,183,107,31,94,202,139,139,134,144,124,157,116,156,116,
+150,8,152,112,108,146,109,27,130,6,138,104,174,127,154,129,157,111,25,196,
+48,139,139,165,111,8,103,174,178,120,180,27,186,201,162,173,184,31,181,172,
+160,172,175,26,163,138,142,101,224,30,116,190,132,162,160,26,168,161,161,
+168,179,162,112,74,155,30,14,247,22,247,8,151,21,155,149,147,146,150,27,149,
+148,136,134,146,31,108,186,139,139,166,27,178,180,168,188,172,31,168,183,
+154,197,208,26,196,7,140,146,145,139,142,27,161,152,136,132,149,31,152,131,
+142,131,151,91,181,251,60,24,95,150,154,116,158,27,172,182,169,188,178,31,
+126,153,5,135,128,134,137,133,27,118,128,152,177,130,31,110,247,3,123,196,
+126,160,110,157,25,233,172,179,176,192,26,219,75,200,55,83,94,118,94,96,30,
+181,112,93,164,88,27,41,61,56,34,78,157,110,198,106,31,178,117,157,118,114,
+26,133,138,131,137,129,30,150,136,5,172,178,151,163,165,26,161,125,156,108,
+155,30,84,167,139,139,131,146,8,118,156,128,161,165,26,193,179,180,191,200,
+176,86,50,30,129,7,129,7,251,40,7,83,136,114,129,110,30,119,132,125,122,130,
+27,133,133,142,144,131,31,156,115,126,145,119,27,98,112,110,74,117,31,247,
+195,247,251,21,222,137,151,127,182,30,160,168,157,145,170,27,194,178,103,
+89,106,120,108,109,123,31,110,124,121,133,77,124,8,14,232,208,249,10,21,247,
+149,253,10,5,227,6,247,151,249,10,5,251,195,252,164,21,251,74,248,91,5,248,
+1,6,14,103,143,22,248,240,6,251,151,249,10,5,51,6,183,37,21,247,75,252,91,
+5,252,1,6,14,213,247,253,210,21,68,221,5,248,131,97,252,82,7,87,199,5,82,
+6,247,114,251,154,247,114,247,154,5,82,6,87,79,5,248,82,97,252,131,7,14,213,
+247,253,248,213,21,210,57,5,252,131,181,248,82,7,191,79,5,196,6,251,114,247,
+154,251,114,251,154,5,196,6,191,199,5,252,82,181,248,131,7,14,40,247,15,191,
+21,100,74,236,83,207,247,13,5,247,177,247,11,251,110,6,207,247,13,5,247,42,
+247,11,55,6,174,200,41,195,74,251,9,5,251,164,251,11,247,97,6,71,251,13,5,
+251,29,251,11,6,14,74,248,170,247,183,150,10,248,235,226,29,14,40,248,115,
+250,37,21,251,20,253,168,251,85,248,32,251,40,66,157,106,233,185,247,133,
+252,133,247,44,250,68,5,14,252,10,247,80,248,159,21,176,74,10,251,120,7,95,
+143,77,149,36,158,29,148,129,128,144,125,27,113,117,117,112,108,167,115,174,
+183,231,10,212,247,65,26,14,95,247,245,243,29,249,120,7,177,74,10,253,112,
+7,14,95,247,171,250,37,21,253,121,7,102,145,60,148,46,158,29,149,129,127,
+144,126,27,112,118,117,111,109,167,115,174,182,231,10,207,247,70,26,249,112,
+7,14,40,248,115,248,37,116,10,131,128,114,103,136,134,132,128,131,129,135,
+29,169,168,151,161,161,31,152,152,140,140,174,180,8,101,251,17,116,10,130,
+128,115,103,136,135,132,128,131,128,135,29,170,167,151,162,161,31,152,151,
+141,141,173,179,8,14,40,204,29,249,29,4,252,125,251,74,5,251,12,143,29,40,
+204,29,252,125,247,57,113,10,75,248,171,247,209,21,216,252,121,251,200,216,
+247,123,7,14,210,248,235,248,247,21,69,251,164,6,251,5,134,95,123,107,30,
+86,112,80,103,76,27,84,84,167,183,110,31,115,176,132,183,247,17,26,247,164,
+69,251,161,7,251,41,144,101,166,95,30,69,181,215,98,229,27,222,209,172,201,
+184,31,175,188,145,175,247,54,26,14,210,248,235,22,247,161,7,247,41,134,177,
+113,183,30,209,97,62,180,49,27,56,70,106,77,94,31,102,90,133,103,251,54,26,
+251,161,209,247,164,7,247,5,145,186,157,173,30,189,166,197,173,200,27,196,
+194,110,93,168,31,162,103,145,98,251,18,26,251,164,7,14,247,244,249,147,247,
+108,21,200,252,98,7,227,29,167,29,66,44,26,251,8,184,56,197,29,201,251,183,
+6,251,1,137,83,189,133,245,8,14,247,244,248,106,248,234,21,252,173,251,161,
+78,248,234,200,251,160,248,173,7,14,204,247,248,247,189,21,91,182,134,143,
+120,153,8,167,103,92,157,103,27,62,76,76,62,62,202,76,216,176,184,157,167,
+176,31,158,153,144,143,187,182,188,96,144,135,158,125,8,111,175,185,121,176,
+27,216,202,202,216,216,76,202,62,103,92,121,111,103,31,120,125,134,135,90,
+96,8,175,106,21,196,197,194,170,181,27,188,179,99,91,90,99,99,90,97,83,171,
+196,82,31,68,22,83,82,83,107,97,27,90,99,179,187,187,179,179,188,181,195,
+108,82,196,31,14,247,244,249,62,247,59,21,90,140,109,156,86,197,8,192,185,
+176,161,182,27,145,200,127,6,79,81,103,73,89,31,207,85,81,173,80,27,61,83,
+82,58,59,192,84,217,191,192,164,184,179,31,147,147,144,144,155,158,195,70,
+203,102,199,142,8,251,121,247,30,21,135,134,139,139,133,133,8,92,93,106,121,
+98,27,99,112,169,185,185,167,168,184,173,162,127,94,187,31,149,130,139,139,
+148,130,8,14,247,244,249,120,247,165,21,252,117,88,248,117,6,64,4,252,117,
+89,248,117,6,96,247,230,21,92,97,121,128,103,27,122,127,142,158,77,31,160,
+69,121,143,113,27,86,96,114,87,103,31,179,108,5,187,181,152,148,174,27,159,
+139,139,115,222,31,116,212,141,139,168,27,199,182,165,191,168,31,14,247,244,
+249,121,247,20,21,103,110,109,103,103,169,110,175,174,169,169,174,176,110,
+168,102,31,252,125,22,103,209,10,174,176,110,168,102,31,247,138,248,133,21,
+102,209,10,175,175,110,168,103,31,14,247,240,247,104,251,48,21,62,54,247,
+143,6,138,224,5,64,249,171,247,254,253,171,69,6,140,54,5,247,132,224,66,249,
+171,240,224,253,143,54,243,6,14,247,240,249,106,249,126,21,252,127,56,6,247,
+85,251,232,251,85,252,6,5,54,248,135,247,125,45,7,137,251,30,5,251,178,6,
+247,79,247,254,251,78,247,218,5,247,170,6,143,251,30,5,230,6,14,251,51,247,
+62,247,182,21,202,206,178,186,165,183,8,180,209,164,217,197,26,193,112,174,
+97,51,73,251,34,251,212,78,30,112,108,121,121,124,126,8,121,123,133,131,131,
+26,130,147,129,147,146,166,159,163,164,30,127,47,138,123,107,26,81,168,104,
+186,175,169,160,184,165,30,152,161,146,159,151,26,149,132,146,129,130,133,
+133,124,131,30,94,117,126,125,121,27,126,134,146,157,164,158,247,19,155,216,
+31,150,206,21,247,139,180,170,231,181,27,154,149,123,116,49,85,251,8,54,45,
+31,14,251,46,245,249,50,21,172,213,139,139,177,27,186,178,121,105,163,31,
+173,92,160,64,65,26,111,137,115,130,79,30,192,70,112,151,85,27,90,100,123,
+105,105,31,93,92,111,72,74,26,251,1,222,54,246,215,200,180,216,182,30,177,
+207,167,247,22,243,26,247,92,251,3,247,37,251,45,94,92,129,121,99,30,247,
+191,252,54,21,125,50,132,106,125,96,8,61,112,93,95,85,27,83,106,190,226,247,
+8,205,235,219,182,175,117,98,165,31,14,247,244,248,139,249,75,21,251,92,112,
+29,251,85,31,135,251,208,21,251,82,247,80,5,184,194,204,162,209,27,208,203,
+116,96,196,31,179,99,21,187,82,162,76,66,26,67,116,75,93,83,30,251,84,247,
+87,5,247,44,251,127,21,95,84,72,115,69,27,69,75,162,186,80,31,247,85,247,
+85,5,251,125,251,45,21,95,193,116,203,209,26,211,162,203,186,196,30,247,82,
+251,80,5,14,176,247,205,248,38,21,251,14,67,76,60,58,26,113,146,111,155,97,
+30,88,64,124,106,98,26,85,176,99,188,193,182,192,206,179,124,186,98,224,30,
+178,188,178,178,195,185,8,192,201,176,158,175,27,173,161,109,95,85,115,62,
+105,89,31,100,114,101,115,106,27,108,111,160,162,152,146,146,153,140,31,161,
+141,154,154,158,26,155,127,151,122,110,115,108,101,93,175,107,190,189,196,
+172,194,186,30,180,186,161,195,194,26,208,99,185,81,60,72,92,251,56,251,49,
+30,130,158,136,157,161,26,214,178,193,233,194,30,251,56,251,224,21,180,64,
+156,95,106,26,108,118,117,109,102,112,170,182,178,146,155,189,215,30,14,247,
+244,248,61,141,21,137,161,145,139,173,27,247,172,201,251,183,6,123,6,247,
+109,248,6,5,229,201,86,6,167,187,97,164,96,66,5,251,62,176,10,251,16,190,
+53,229,110,30,111,90,180,113,5,247,126,248,131,21,251,105,251,255,5,68,158,
+105,197,240,26,247,21,191,195,247,13,30,14,247,244,249,23,248,53,21,252,68,
+252,53,5,248,214,181,252,105,6,247,244,247,234,5,14,247,244,247,125,201,157,
+29,247,3,120,29,84,251,13,31,14,247,244,249,147,201,21,251,183,6,251,13,87,
+194,126,10,67,43,26,251,7,184,55,197,29,6,14,247,244,247,125,247,58,157,29,
+247,4,120,29,83,251,13,31,247,135,251,3,21,236,10,247,244,249,147,247,58,
+21,251,183,6,251,13,87,195,126,10,66,43,26,42,167,72,198,93,30,107,179,176,
+130,229,27,247,172,6,90,4,236,10,247,244,248,164,247,108,21,247,131,200,251,
+96,6,227,247,47,5,247,8,201,58,6,172,198,97,163,92,56,5,251,35,176,10,251,
+8,184,55,220,105,30,106,82,182,116,177,206,5,136,165,151,138,181,27,247,172,
+201,251,183,6,119,133,139,140,130,31,170,247,45,21,58,251,33,87,157,108,190,
+136,211,25,247,182,247,108,21,51,251,47,5,251,94,6,227,29,14,213,218,247,
+187,21,221,210,5,248,188,181,252,139,6,146,29,248,139,181,252,188,6,14,213,
+249,23,247,187,21,57,68,5,252,188,97,248,139,138,29,252,139,97,248,188,6,
+14,213,247,100,248,44,21,146,29,247,202,138,29,251,251,97,21,248,44,6,221,
+68,57,68,5,252,44,6,57,210,5,14,43,248,212,251,107,21,252,236,70,248,236,
+6,247,99,4,252,236,70,248,236,6,14,251,207,248,102,250,42,224,29,247,244,
+234,185,21,179,91,247,12,239,5,67,206,228,100,235,27,247,83,247,47,247,50,
+247,86,214,117,209,98,199,31,247,3,232,99,187,251,4,46,5,210,64,66,169,45,
+27,251,83,251,47,251,50,251,86,68,157,78,177,77,31,187,180,21,111,189,127,
+186,194,26,247,55,247,19,247,24,247,47,215,198,114,82,200,30,178,91,21,170,
+89,155,83,79,26,251,54,251,19,251,24,251,47,60,66,172,198,86,30,14,95,247,
+138,111,29,247,196,107,10,251,186,188,247,23,21,247,148,247,148,251,148,6,
+14,251,186,188,247,23,21,247,148,247,149,251,148,6,247,96,251,97,21,251,44,
+247,45,247,44,6,14,247,223,189,22,250,4,205,253,194,249,184,73,6,14,252,44,
+247,78,195,10,14,251,61,247,133,195,10,247,96,247,148,217,10,14,95,166,22,
+248,186,248,37,6,251,167,247,220,251,167,251,220,5,190,251,242,21,247,220,
+7,247,116,247,162,247,116,251,162,5,251,220,7,14,247,12,247,224,243,10,90,
+170,118,156,120,162,8,102,184,118,208,218,26,247,38,217,233,247,12,247,13,
+217,45,251,38,66,121,73,106,94,30,119,112,117,121,85,104,8,251,17,247,204,
+247,17,251,62,7,191,173,156,153,159,162,8,183,190,162,208,221,26,247,90,251,
+39,247,37,251,94,251,95,251,39,251,37,251,91,64,159,73,177,90,30,162,110,
+157,124,196,101,8,251,62,251,17,247,204,6,14,247,244,248,98,247,134,21,34,
+101,177,74,223,212,120,251,3,5,219,6,120,247,3,223,66,177,204,34,177,244,
+176,101,204,55,66,158,247,3,5,59,6,158,251,3,55,212,101,74,5,14,247,244,247,
+125,247,108,21,248,98,6,134,33,82,88,251,1,142,8,251,183,77,247,172,6,222,
+174,146,164,177,31,205,183,171,211,241,26,247,0,92,224,62,170,10,247,1,141,
+196,88,144,33,8,252,98,6,14,91,248,169,247,136,21,146,7,148,7,137,212,134,
+168,124,178,8,222,105,58,189,40,27,251,41,44,251,0,251,60,251,60,230,38,247,
+43,247,6,216,193,240,170,31,141,144,141,146,5,75,6,138,137,137,134,138,136,
+8,79,112,83,105,66,27,96,104,150,160,115,31,123,154,130,155,128,174,140,233,
+24,247,172,193,21,251,170,219,6,207,171,174,163,206,27,193,175,123,100,172,
+31,150,127,143,132,145,122,8,14,247,234,249,178,247,229,21,252,202,247,92,
+5,252,36,7,14,247,234,247,85,247,229,21,248,202,251,92,5,248,36,7,14,241,
+247,149,249,25,21,252,89,115,10,247,240,7,247,181,95,5,252,3,115,10,248,82,
+7,14,213,34,10,14,213,58,29,92,213,239,29,247,254,247,17,252,148,6,14,210,
+142,22,249,93,6,251,152,249,109,5,251,85,6,76,252,240,21,247,51,248,96,247,
+52,252,96,5,14,158,39,29,14,102,53,10,14,213,108,29,247,22,248,161,248,43,
+21,251,159,41,247,159,6,251,27,248,68,59,10,14,63,29,14,213,82,29,158,134,
+22,247,45,6,247,78,248,193,247,77,252,193,5,247,45,6,251,151,249,109,241,
+10,14,247,77,78,10,213,51,29,14,135,166,22,248,225,247,17,252,225,6,174,247,
+81,21,248,147,247,17,252,147,6,109,247,57,21,248,214,247,17,252,214,6,14,
+247,22,32,10,14,213,205,239,29,247,180,252,240,247,43,249,109,252,225,6,14,
+158,76,10,91,165,22,248,189,247,17,252,2,6,247,126,247,135,251,122,247,128,
+5,247,238,247,17,252,170,251,17,6,247,126,251,128,251,129,251,141,5,14,102,
+92,29,14,158,43,29,14,247,65,247,241,125,21,247,17,228,6,207,145,180,150,
+183,163,8,224,185,189,231,247,3,26,247,2,89,231,54,185,30,95,163,98,150,71,
+145,8,228,251,17,50,7,74,133,100,128,97,117,8,51,94,84,42,251,0,26,251,1,
+194,42,227,94,30,181,117,178,128,204,133,8,247,9,4,44,156,87,200,234,26,235,
+190,198,235,154,30,247,17,22,184,133,162,130,162,120,8,174,110,159,90,85,
+26,44,85,74,47,122,30,14,158,74,29,247,53,247,225,22,247,39,247,22,6,216,
+142,201,158,185,176,212,201,159,211,138,247,80,8,247,110,251,42,251,110,7,
+251,33,135,107,117,105,30,106,113,105,122,98,27,248,111,251,39,252,111,7,
+102,109,151,166,114,31,108,173,134,171,247,44,26,247,110,251,42,251,110,7,
+138,251,65,154,75,195,75,186,89,209,112,230,136,8,14,247,46,247,241,133,29,
+247,13,146,10,247,204,247,17,251,55,7,182,166,159,205,10,247,92,251,39,247,
+36,251,95,251,94,169,29,159,122,182,112,8,251,55,251,17,247,204,6,14,106,
+248,141,247,166,21,245,247,158,5,251,38,6,99,251,25,118,179,127,157,118,160,
+25,179,101,88,162,90,27,251,13,49,251,15,251,57,251,56,227,251,13,247,13,
+222,200,190,234,29,247,45,226,10,130,114,124,116,8,105,117,110,119,113,27,
+85,101,211,242,243,176,208,195,191,178,89,251,5,174,31,14,101,205,243,29,
+247,32,247,139,6,102,182,181,124,197,27,247,21,235,238,247,23,198,119,194,
+106,172,31,119,159,118,150,95,154,8,202,179,167,185,204,26,247,4,47,216,251,
+25,54,68,110,87,99,30,109,99,129,95,43,26,247,32,153,21,201,142,161,151,161,
+30,166,154,171,157,173,27,194,175,100,80,99,121,103,111,124,31,121,129,122,
+136,102,137,8,57,144,7,154,140,155,140,174,130,160,128,25,182,118,163,95,
+82,26,59,88,80,68,101,103,151,163,107,30,14,47,247,104,243,29,247,24,247,
+120,6,247,90,248,166,5,251,42,6,251,6,252,27,251,6,248,27,5,251,42,6,247,
+90,252,166,5,14,97,246,249,129,21,42,7,247,47,251,12,69,133,104,126,101,105,
+25,85,89,110,65,45,26,251,68,241,251,0,247,57,247,58,240,247,0,247,70,247,
+11,103,211,43,212,30,251,38,247,3,5,247,106,247,3,6,251,95,251,205,94,10,
+251,65,247,197,247,203,21,93,140,125,140,116,145,8,107,147,121,161,169,26,
+179,169,163,188,192,178,10,251,31,27,251,20,57,81,48,89,161,100,185,103,31,
+81,117,111,97,76,26,35,227,72,247,28,228,198,161,190,187,29,78,121,108,115,
+80,27,84,104,167,183,169,157,163,168,146,31,163,145,142,140,213,140,8,14,
+251,80,209,248,252,21,247,88,6,63,87,105,106,94,76,8,80,56,111,60,52,26,51,
+173,68,196,110,30,168,125,183,128,192,134,176,136,24,207,133,153,130,102,
+26,105,126,98,99,50,30,247,10,6,179,244,148,176,199,26,220,104,171,42,148,
+30,101,143,84,144,116,144,121,150,25,112,155,124,176,187,26,212,169,215,197,
+216,30,196,215,183,174,235,186,8,247,5,252,17,7,14,102,86,10,14,32,247,164,
+249,118,21,60,76,109,81,94,31,93,78,117,48,251,23,26,34,156,38,165,84,30,
+53,181,208,96,237,27,247,59,227,247,20,247,137,247,8,121,233,105,199,31,218,
+94,72,178,51,27,251,7,251,212,21,141,208,143,172,147,165,8,191,157,172,166,
+186,27,194,174,107,75,153,31,146,106,142,117,140,83,8,46,4,58,135,97,126,
+103,30,88,120,109,114,93,27,82,101,178,211,127,31,132,176,138,161,204,26,
+14,105,29,14,49,247,92,247,222,21,247,102,215,29,247,69,7,197,202,247,21,
+251,132,5,247,54,176,29,14,47,155,22,247,36,6,247,9,247,243,247,7,251,243,
+5,247,45,6,251,182,249,109,5,251,33,6,232,251,130,5,14,103,204,182,10,253,
+138,247,25,247,155,7,95,161,167,120,181,27,191,170,161,203,174,31,71,215,
+10,251,32,251,230,7,73,100,99,76,73,104,176,209,30,247,229,7,14,47,247,245,
+114,29,251,95,248,53,243,29,177,239,151,187,192,26,176,127,171,118,158,30,
+120,157,116,147,89,145,70,147,24,84,146,127,142,121,152,8,118,154,126,169,
+170,26,183,165,178,179,154,30,150,169,168,143,201,27,203,247,5,77,6,99,109,
+144,149,115,31,108,152,117,170,172,26,169,157,167,167,153,30,151,164,163,
+143,191,27,228,247,5,252,34,251,5,221,6,102,108,123,108,97,26,78,172,98,208,
+114,30,93,124,118,129,115,118,8,100,107,118,91,81,26,73,168,79,185,106,30,
+171,116,178,128,205,132,185,135,24,181,135,148,137,151,130,8,149,132,145,
+123,121,26,110,132,118,95,251,1,30,14,102,247,197,49,10,14,247,10,249,76,
+182,10,253,6,251,4,212,252,64,247,32,248,64,247,92,252,64,247,32,248,64,212,
+6,14,110,204,243,29,247,32,247,175,6,77,174,182,113,208,27,247,28,232,247,
+7,247,58,247,75,43,247,0,251,54,57,68,109,86,95,31,94,86,123,79,251,0,26,
+247,153,247,83,21,211,182,73,251,4,34,95,76,66,64,95,203,247,1,247,2,183,
+202,216,31,14,175,249,16,182,10,251,106,6,146,91,118,141,112,27,69,67,108,
+90,94,31,93,89,115,69,53,26,251,70,240,251,0,247,57,220,208,167,190,185,30,
+182,188,166,210,208,26,213,113,195,80,192,30,247,12,6,251,192,147,94,10,251,
+94,247,46,22,247,32,248,64,247,34,247,4,252,61,251,4,247,35,6,14,73,41,29,
+14,206,247,184,226,21,99,144,115,150,117,165,8,109,175,124,188,199,26,215,
+163,199,183,173,30,226,7,251,19,107,68,43,251,31,26,251,0,178,58,215,92,30,
+181,113,175,129,207,134,8,251,97,247,23,247,97,7,196,29,246,26,247,77,251,
+8,240,251,104,114,125,138,136,114,30,247,23,38,21,180,135,162,128,161,113,
+8,169,105,154,91,82,26,82,124,93,109,105,30,117,114,116,128,98,135,8,14,67,
+247,181,247,187,21,251,4,247,137,5,251,43,6,247,82,252,3,251,97,252,27,5,
+247,41,6,247,19,247,165,247,17,251,165,5,247,46,6,251,98,248,31,247,81,247,
+255,5,251,39,6,14,244,247,202,243,29,247,25,247,96,6,227,140,200,162,189,
+190,8,183,189,151,179,236,26,247,184,251,32,251,177,7,141,251,3,104,89,57,
+138,8,248,83,251,25,252,83,7,56,142,106,185,141,247,5,8,247,177,251,32,251,
+184,7,46,148,105,176,90,30,188,81,205,112,232,138,8,14,247,89,47,10,14,251,
+20,248,148,247,224,21,135,202,128,172,109,176,8,194,95,72,168,57,27,71,78,
+119,102,95,31,82,90,103,54,54,26,251,29,215,46,247,37,100,30,227,115,5,185,
+126,154,126,111,26,115,124,92,107,66,30,247,9,6,178,243,146,168,181,26,172,
+128,165,117,161,30,120,157,120,148,74,162,83,158,24,95,154,97,161,119,157,
+8,109,166,121,187,191,26,227,189,198,212,202,177,102,72,145,30,14,73,146,
+247,192,21,46,181,7,147,75,149,103,160,106,8,76,177,204,105,219,27,236,217,
+186,221,177,31,165,196,152,213,140,239,160,140,142,139,156,143,8,234,7,121,
+136,136,139,119,137,133,215,127,190,116,183,8,228,93,67,185,48,27,251,14,
+51,62,32,67,178,79,210,100,31,190,112,204,124,238,133,8,123,7,91,135,91,133,
+110,30,70,124,105,104,87,27,92,104,168,189,125,31,132,165,136,168,136,215,
+8,247,112,247,20,21,251,19,146,65,185,210,26,182,172,172,183,185,178,111,
+94,156,30,152,104,148,91,95,26,14,241,247,201,243,29,247,23,247,97,6,196,
+29,247,0,26,238,102,218,71,187,30,95,170,97,152,69,144,8,247,16,251,23,251,
+16,7,69,134,97,126,95,108,8,71,91,102,60,40,26,251,0,178,58,214,92,30,182,
+113,175,129,207,134,8,247,23,248,89,21,180,135,162,129,161,113,8,169,106,
+154,92,83,26,83,124,92,109,105,30,117,114,116,129,98,134,8,251,23,22,98,144,
+116,149,117,164,8,109,173,124,186,195,26,195,154,186,169,172,30,161,165,162,
+149,180,143,8,14,247,89,247,38,248,71,21,123,118,131,125,132,126,8,121,102,
+128,83,86,26,49,167,70,195,92,30,109,173,182,123,182,27,188,180,158,176,175,
+31,101,176,179,121,188,27,247,7,227,246,247,32,247,3,96,221,51,194,31,177,
+77,58,157,33,27,251,181,34,6,247,157,22,228,186,132,119,178,31,202,107,174,
+76,59,26,62,111,85,99,124,126,146,153,128,30,123,158,134,164,191,26,247,1,
+251,32,251,1,7,93,135,116,128,120,30,120,127,125,130,121,27,96,113,191,224,
+229,166,195,206,188,31,14,105,29,251,0,56,29,73,41,29,203,248,161,40,10,251,
+207,247,110,249,169,47,29,251,75,247,74,97,29,213,34,10,251,96,247,64,47,
+29,247,97,248,0,61,29,251,102,248,240,47,29,247,150,249,26,119,29,251,102,
+248,34,47,29,251,66,247,253,100,10,251,102,249,109,47,29,247,69,248,70,44,
+29,251,222,247,8,47,29,247,82,248,25,133,29,247,12,146,10,247,205,247,17,
+251,56,7,182,166,160,205,10,247,91,251,39,247,37,251,95,251,95,169,29,160,
+122,182,112,8,251,56,251,17,247,205,6,251,170,249,109,47,29,247,171,248,238,
+102,10,252,58,249,109,47,29,91,10,158,43,29,251,15,64,29,106,248,152,247,
+166,21,246,247,158,5,251,38,6,98,251,25,119,179,126,157,119,160,25,179,100,
+88,162,89,27,251,17,45,251,16,251,56,251,55,231,251,13,247,17,223,200,189,
+234,29,247,46,226,10,129,115,125,116,8,104,116,111,120,111,27,80,98,212,242,
+240,180,209,199,192,178,90,251,6,175,31,71,248,151,47,29,251,89,247,185,247,
+203,21,94,140,126,140,118,145,8,108,147,121,161,169,26,179,167,163,186,191,
+178,10,251,30,27,251,18,59,81,47,91,159,99,182,103,31,85,117,112,97,77,26,
+33,225,73,247,28,224,199,162,189,187,29,79,121,108,114,81,27,87,105,167,183,
+169,156,163,167,146,31,163,145,142,140,210,140,8,122,248,204,47,29,102,86,
+10,247,83,247,141,47,29,105,29,120,249,169,47,29,102,247,197,49,10,190,247,
+245,47,29,247,89,47,10,251,88,247,141,47,29,73,41,29,247,45,248,207,47,29,
+105,29,251,13,97,29,73,41,29,190,248,161,103,29,213,248,134,210,10,251,135,
+249,109,5,251,67,123,29,14,210,213,22,247,243,6,247,32,243,233,247,17,247,
+14,251,0,237,251,28,31,251,93,247,57,248,15,247,17,252,165,6,247,42,252,240,
+21,247,81,247,107,7,184,174,98,84,84,106,101,92,31,14,213,218,22,247,221,
+6,223,194,165,29,212,185,166,181,201,26,190,115,191,98,175,30,176,97,89,155,
+62,27,251,221,87,29,58,172,29,14,203,126,251,28,21,247,42,247,28,248,59,251,
+28,247,42,247,153,73,248,240,252,116,252,85,6,140,53,72,71,53,138,8,114,6,
+248,143,22,251,155,6,190,173,171,196,197,26,247,222,247,72,7,14,158,247,115,
+61,29,14,247,148,248,13,201,29,226,149,29,251,43,6,48,251,165,5,45,247,165,
+251,42,251,165,36,138,10,247,26,247,223,5,236,6,14,117,198,247,134,21,111,
+7,74,157,88,176,99,30,88,186,213,109,219,27,247,37,247,3,242,247,25,225,97,
+204,66,164,31,60,10,14,210,53,29,14,101,197,201,29,229,6,117,29,251,42,6,
+14,193,144,164,10,192,29,252,167,252,205,7,236,29,14,247,77,247,104,81,10,
+213,220,10,192,29,162,29,247,22,248,24,44,29,14,210,211,22,247,42,248,242,
+247,168,252,242,192,29,252,212,6,14,158,247,111,79,29,213,249,61,248,118,
+21,216,29,48,233,29,251,38,251,129,251,127,247,18,251,38,247,95,247,73,247,
+12,244,247,59,148,31,251,36,123,10,14,102,248,20,154,10,14,113,76,29,14,247,
+98,247,243,22,247,42,240,188,6,247,42,247,4,247,5,247,44,247,42,251,4,247,
+4,251,42,31,90,240,251,42,38,85,6,251,42,251,4,251,4,251,42,251,44,247,4,
+251,5,247,42,31,193,6,136,248,38,21,251,169,114,7,58,82,197,221,220,195,195,
+221,31,247,72,22,159,6,221,196,83,58,57,82,81,57,31,119,6,14,158,248,51,248,
+6,21,247,121,247,251,5,251,67,6,251,30,147,29,247,62,6,247,31,247,145,247,
+30,251,145,5,247,67,6,14,221,207,22,248,118,177,10,251,158,168,10,194,248,
+129,22,192,29,93,10,247,249,188,22,250,30,249,109,251,42,252,240,251,120,
+242,10,252,240,251,120,168,10,248,7,191,22,249,186,177,10,251,113,242,10,
+252,240,251,111,168,10,210,239,81,29,14,247,223,246,81,29,247,197,251,17,
+21,173,10,6,14,247,114,247,154,134,10,252,32,251,17,247,138,6,247,42,252,
+115,162,10,202,248,165,247,206,21,251,26,124,74,64,35,27,47,79,191,247,2,
+105,31,251,32,94,5,251,47,186,247,13,49,247,54,27,239,218,174,209,199,31,
+198,208,173,240,246,26,237,110,233,88,207,30,220,80,53,180,251,0,27,251,32,
+35,75,251,17,76,31,247,22,75,5,226,179,192,177,220,27,199,189,112,92,170,
+31,157,110,147,117,150,90,8,251,188,251,17,6,14,248,19,247,95,248,92,21,122,
+29,245,7,144,70,154,80,168,85,8,251,6,200,237,81,247,24,27,239,220,173,206,
+199,31,202,209,175,241,247,1,26,247,1,103,241,76,209,30,206,79,59,173,38,
+27,251,64,251,12,36,251,74,100,31,247,222,247,49,21,247,9,213,39,251,50,251,
+42,63,39,251,6,251,8,64,239,247,46,247,46,214,239,247,7,31,14,210,248,129,
+22,192,29,251,233,6,76,90,122,102,97,31,91,97,112,78,77,26,90,155,89,168,
+102,30,155,118,155,128,172,125,83,137,106,97,140,71,8,251,13,7,135,79,127,
+114,110,129,8,247,30,6,174,138,158,167,142,196,8,247,31,7,175,153,153,177,
+141,30,247,88,6,247,17,4,251,66,6,81,101,179,200,199,179,182,195,31,247,66,
+6,14,251,53,248,3,166,29,251,180,253,109,247,42,248,240,247,141,247,17,211,
+10,247,129,247,145,22,247,42,247,184,6,184,166,190,163,206,27,197,173,113,
+96,31,251,5,7,137,105,115,118,103,140,8,68,251,17,247,20,6,220,135,210,208,
+142,224,8,247,67,7,178,126,176,116,168,30,179,106,91,158,70,27,59,76,118,
+94,81,31,247,73,247,86,247,17,252,183,251,17,247,95,7,14,202,248,120,247,
+206,21,247,17,251,188,7,150,188,147,161,157,168,8,186,170,189,166,199,27,
+220,192,101,52,179,31,247,22,203,5,247,17,76,35,203,251,32,27,40,59,104,72,
+80,31,79,70,104,36,251,0,26,42,167,46,189,71,30,56,200,223,98,247,1,27,247,
+54,247,9,226,247,50,190,31,251,32,184,5,251,2,105,79,87,47,27,35,74,214,247,
+26,124,31,14,158,248,243,248,143,21,247,43,138,38,222,251,77,27,251,66,185,
+10,240,119,5,240,198,29,181,218,134,30,251,38,6,251,48,148,246,54,247,78,
+27,247,81,247,2,226,247,42,247,6,80,199,251,26,165,31,251,6,161,5,251,0,160,
+109,160,192,26,195,187,173,217,234,192,99,65,144,30,14,125,29,125,29,125,
+29,47,247,231,166,29,252,171,7,81,110,108,86,83,115,165,202,30,215,251,42,
+63,7,64,157,93,182,100,30,101,181,195,120,207,27,247,42,224,217,247,31,31,
+248,171,7,14,248,82,155,164,10,247,202,7,161,29,252,167,252,205,6,236,29,
+249,0,22,171,29,14,248,51,247,94,247,223,21,247,181,251,223,247,202,6,247,
+30,240,234,247,23,247,24,39,233,191,10,166,10,248,75,247,17,162,10,247,119,
+247,139,22,247,42,247,184,6,149,156,145,148,148,148,8,160,160,182,152,191,
+27,191,162,133,124,153,31,150,125,146,122,122,26,251,184,247,42,247,217,7,
+176,125,179,115,167,30,181,105,92,156,56,27,45,99,125,87,77,31,247,73,247,
+89,247,17,252,167,251,17,247,76,7,14,210,216,22,247,100,251,52,247,42,247,
+52,247,100,249,109,251,42,252,240,251,158,168,10,247,22,248,24,249,121,72,
+10,247,89,252,79,21,172,10,247,17,4,247,14,161,209,207,243,27,243,209,71,
+251,14,161,31,14,248,112,248,98,201,29,240,213,10,197,214,29,39,6,251,0,247,
+159,247,6,247,229,5,251,43,6,48,251,165,5,32,247,165,251,42,251,165,251,2,
+138,10,247,27,247,223,5,242,6,14,158,43,29,14,247,22,181,248,59,21,136,113,
+138,122,117,26,251,0,177,36,203,171,10,203,208,177,242,247,1,26,247,15,92,
+247,7,61,207,30,189,80,65,165,52,27,251,36,33,75,251,17,75,31,247,22,75,5,
+227,181,193,176,225,27,243,203,76,251,19,163,31,251,17,4,172,10,14,208,247,
+109,190,10,247,42,247,244,6,158,208,201,149,187,27,222,187,106,80,31,251,
+181,247,42,247,181,7,247,31,36,220,251,67,79,111,135,114,45,30,14,248,103,
+248,64,22,247,13,249,109,251,13,252,132,6,251,125,248,132,5,251,16,253,109,
+247,13,248,140,6,248,91,252,140,21,248,56,234,252,56,6,247,98,249,26,21,251,
+25,57,251,1,251,69,251,70,220,251,0,247,26,247,25,222,247,0,247,66,247,75,
+59,246,251,28,31,251,5,4,201,180,70,33,38,97,69,79,77,98,208,243,243,180,
+208,200,31,14,251,61,247,117,248,75,21,247,57,247,141,247,17,252,35,251,182,
+89,251,17,189,251,206,247,42,247,206,247,81,247,17,7,14,158,248,55,247,131,
+21,171,7,247,123,248,94,5,251,60,6,251,31,251,213,251,41,247,213,5,251,59,
+6,247,134,252,94,5,107,251,23,251,17,247,23,251,6,247,42,247,6,247,23,247,
+17,7,14,160,247,116,61,29,223,249,177,40,10,210,53,29,248,8,247,96,21,90,
+133,112,114,95,27,94,113,164,188,132,31,51,6,140,101,142,123,149,118,8,85,
+167,190,111,212,27,206,186,162,187,169,31,155,164,143,157,141,182,8,14,58,
+172,29,247,10,205,21,247,4,6,227,237,29,252,8,247,104,95,10,101,172,201,29,
+225,149,29,251,44,6,43,251,165,5,52,247,165,251,42,6,247,104,205,21,247,3,
+211,10,113,76,29,247,229,249,188,21,90,132,113,114,94,27,95,112,164,188,133,
+31,50,6,140,101,143,123,149,118,8,85,166,191,111,211,27,207,186,162,187,169,
+31,154,164,144,157,140,182,8,14,210,53,29,248,75,247,45,69,29,113,248,102,
+250,22,191,29,252,51,253,199,21,77,10,14,169,247,139,248,92,21,109,122,29,
+169,251,32,218,247,32,159,6,142,10,48,251,165,5,113,247,32,60,6,14,219,248,
+125,22,251,52,247,42,247,177,43,7,251,0,247,159,234,10,38,251,165,5,58,122,
+29,224,213,10,14,213,220,10,205,251,52,247,42,247,177,73,248,240,162,29,208,
+248,50,248,6,21,247,122,247,251,5,251,68,6,251,29,147,29,247,61,6,247,32,
+247,145,247,29,251,145,5,215,214,29,251,20,6,14,208,248,21,247,116,21,170,
+142,158,144,205,156,8,251,141,173,10,251,244,7,98,127,104,132,99,134,8,247,
+39,60,251,44,7,65,144,98,171,194,26,247,181,251,42,251,181,7,138,251,26,239,
+56,247,58,136,8,251,27,218,7,14,208,248,136,22,205,251,54,247,42,247,179,
+73,248,240,93,10,158,39,29,109,249,191,52,10,210,53,29,247,46,247,99,52,10,
+247,113,247,51,248,146,21,252,146,248,23,7,247,31,244,233,247,17,247,14,251,
+1,237,251,27,31,251,129,210,247,104,247,25,251,104,225,251,42,53,251,26,251,
+25,6,247,176,252,21,21,247,81,247,142,7,185,174,98,84,84,106,101,91,31,14,
+247,22,248,32,249,120,21,251,1,58,107,72,75,31,74,70,102,38,251,0,26,33,176,
+39,204,70,30,73,201,222,106,243,27,243,222,172,205,201,31,204,208,176,240,
+245,26,247,113,251,34,247,47,251,96,30,247,78,252,96,21,35,113,71,80,42,27,
+251,2,67,213,247,23,122,31,146,165,163,142,163,27,172,163,131,119,170,31,
+96,206,146,136,179,27,169,166,144,156,196,31,252,20,247,52,21,247,4,164,207,
+199,239,27,247,4,213,60,251,26,153,31,128,110,94,131,112,27,111,134,141,176,
+84,31,163,103,104,150,98,27,110,108,134,130,107,31,14,247,59,249,133,249,
+98,21,155,102,121,143,109,27,64,90,98,55,114,31,251,22,252,69,251,55,248,
+185,5,251,42,6,247,138,253,109,5,247,19,6,247,99,248,227,5,147,142,154,146,
+152,27,152,146,137,132,153,31,148,134,150,133,151,132,8,14,117,247,214,116,
+21,247,35,141,247,0,241,247,24,26,225,97,204,66,164,30,60,10,251,42,111,6,
+137,251,19,221,50,247,30,120,95,54,24,148,158,149,83,10,101,197,248,240,21,
+252,240,247,42,247,223,229,7,117,29,252,32,251,17,6,14,213,248,35,117,21,
+247,62,150,247,1,242,146,247,49,72,29,251,119,247,11,251,38,247,84,131,31,
+96,56,5,148,158,150,142,143,10,116,145,163,86,175,29,204,167,148,29,194,248,
+129,243,10,33,251,176,247,42,247,51,245,249,109,251,42,251,244,6,120,70,78,
+129,90,157,10,247,68,198,167,143,164,233,30,14,47,248,160,156,21,116,161,
+132,156,166,26,247,192,7,247,2,63,195,251,40,67,29,247,45,6,251,62,119,10,
+14,109,248,12,249,227,21,137,64,121,111,86,124,44,109,93,110,97,81,8,86,68,
+114,42,251,23,26,50,148,76,158,97,30,49,179,227,87,247,3,229,29,220,119,204,
+98,189,31,193,94,70,171,68,27,84,90,123,103,86,31,147,203,184,169,247,12,
+164,247,26,167,176,188,144,247,50,8,251,105,252,47,94,10,106,226,22,247,203,
+6,231,205,202,227,205,107,181,72,161,31,199,164,167,178,196,26,217,75,199,
+56,30,251,203,6,247,32,252,63,21,247,12,247,24,7,171,164,112,106,105,114,
+113,107,31,251,24,247,107,21,238,247,24,7,166,158,119,110,109,120,119,112,
+31,14,251,123,179,10,14,126,146,251,4,21,247,32,247,4,247,221,251,4,247,32,
+247,117,89,248,63,252,61,251,189,6,61,140,108,87,91,27,83,6,248,55,22,251,
+99,6,180,172,159,186,140,208,8,247,57,247,37,7,14,47,75,10,97,122,101,116,
+89,27,99,107,155,169,119,31,126,159,134,162,137,189,8,141,232,21,220,148,
+174,178,201,27,203,177,97,61,146,31,14,200,248,61,22,247,131,190,238,29,247,
+35,183,29,70,251,80,5,88,247,80,251,32,251,80,79,128,10,199,251,131,6,14,
+251,43,173,247,71,21,143,72,150,107,169,105,8,94,178,198,115,209,27,247,12,
+227,212,238,196,114,177,79,173,31,89,29,149,137,127,154,230,29,111,111,98,
+180,29,14,106,54,29,14,251,40,174,182,10,252,176,109,10,247,80,6,14,126,176,
+185,29,247,37,252,63,215,10,252,61,252,15,7,217,29,14,231,249,39,22,248,176,
+251,81,7,36,252,41,41,248,41,5,251,80,252,176,247,23,248,48,6,239,252,48,
+5,247,3,6,241,248,48,5,252,48,7,14,95,209,29,215,10,182,29,102,247,197,49,
+10,14,95,212,22,247,32,248,63,247,70,252,63,215,10,252,94,6,14,102,247,92,
+186,29,80,172,188,111,206,27,247,23,235,247,13,247,57,247,60,47,247,10,251,
+22,70,88,118,29,47,248,160,247,230,21,121,10,251,71,232,36,85,29,14,251,50,
+247,67,22,247,32,248,63,247,51,247,5,252,94,251,5,247,51,6,14,47,75,29,14,
+247,119,248,4,22,251,110,247,32,247,110,160,7,205,220,166,178,190,31,200,
+187,178,218,215,26,211,103,216,85,187,30,187,85,65,165,59,27,118,247,88,251,
+32,251,88,118,6,251,62,251,22,251,6,251,43,251,45,247,25,251,14,247,59,31,
+160,247,5,21,77,143,110,148,106,166,8,104,169,117,184,183,26,181,159,180,
+173,168,30,172,167,169,149,203,144,8,247,32,22,202,135,168,130,172,111,8,
+173,109,159,96,94,26,92,117,95,102,111,30,108,115,111,130,78,136,8,14,47,
+247,250,78,29,106,210,22,248,5,214,10,83,248,63,181,10,247,88,182,22,249,
+33,251,51,247,32,247,164,83,242,29,252,63,251,50,242,29,252,63,251,51,199,
+10,220,247,96,22,156,29,251,211,251,5,247,71,6,247,32,251,206,168,29,14,247,
+98,240,88,29,247,127,251,5,21,215,10,251,32,6,14,106,231,88,29,14,43,247,
+65,247,118,21,247,107,6,52,127,94,90,72,27,80,98,175,209,119,31,251,27,103,
+5,251,11,174,228,75,247,22,229,29,247,70,38,247,0,251,57,33,55,93,57,96,31,
+247,16,79,5,190,164,173,163,188,27,200,188,93,70,150,31,251,103,6,14,247,
+98,247,81,247,232,21,247,92,215,29,247,119,239,7,251,53,154,234,50,247,47,
+27,247,58,240,247,0,247,69,247,71,38,247,0,251,58,53,67,109,82,92,31,110,
+104,125,108,127,83,8,247,152,235,21,216,189,70,33,37,87,70,64,63,88,208,243,
+242,190,209,215,31,14,74,248,9,22,215,10,251,191,6,41,72,75,44,73,169,90,
+193,116,31,98,112,131,122,136,73,136,66,133,113,116,105,8,247,37,6,151,163,
+147,175,180,26,173,7,188,156,156,189,30,231,6,247,5,4,251,33,6,111,118,162,
+172,173,159,162,168,31,247,33,6,14,251,93,247,221,182,10,251,133,252,176,
+247,32,248,63,247,82,247,5,198,10,102,247,34,22,247,32,247,113,6,177,169,
+158,151,168,27,173,157,122,106,31,251,94,7,140,101,114,112,102,138,8,44,46,
+247,16,6,237,140,216,219,136,238,8,247,73,7,230,80,200,52,96,106,126,105,
+91,30,247,105,247,26,232,251,26,243,251,32,35,33,46,245,7,14,43,248,15,247,
+118,21,234,251,103,7,208,150,188,185,200,27,188,173,115,88,164,31,247,16,
+199,5,221,96,55,185,33,27,251,57,240,29,251,70,239,251,0,247,59,247,22,227,
+203,247,11,175,31,251,28,175,5,69,120,98,103,80,27,72,94,188,226,127,31,14,
+47,248,141,248,2,21,247,6,137,51,208,251,38,27,251,28,118,10,105,100,120,
+73,68,111,157,191,129,30,251,29,6,251,11,143,224,78,247,54,27,220,200,157,
+176,181,31,174,170,160,187,189,26,208,103,184,69,139,10,30,14,247,101,134,
+29,247,103,182,10,251,32,252,239,6,106,129,130,98,30,124,251,5,154,6,243,
+146,139,151,167,31,173,155,157,175,196,26,249,206,211,29,247,213,172,185,
+29,247,63,252,63,247,198,7,210,29,251,58,247,92,252,87,252,15,6,217,29,248,
+176,22,247,6,247,52,7,168,160,115,106,106,118,115,110,31,14,247,150,209,218,
+29,144,10,251,92,251,87,247,92,251,32,6,248,111,159,29,14,102,219,22,247,
+32,247,187,6,199,167,171,165,188,27,192,173,105,222,29,237,68,209,40,81,100,
+123,87,70,30,247,7,247,29,232,251,29,240,251,32,38,36,46,242,7,14,95,215,
+22,247,48,251,52,247,32,247,52,247,49,248,176,181,10,102,247,197,106,29,247,
+16,251,225,21,58,124,95,94,75,27,75,95,184,220,124,31,233,4,220,154,183,184,
+203,27,203,183,94,58,154,31,14,72,248,19,22,247,35,248,176,82,10,247,77,199,
+22,249,94,248,176,251,32,252,63,251,39,242,29,252,63,251,39,199,10,247,140,
+248,131,22,247,131,204,238,29,189,214,10,50,6,70,247,80,197,10,74,247,80,
+251,32,251,80,69,128,10,209,251,131,6,14,34,248,32,182,10,159,10,251,110,
+247,32,247,110,7,247,84,248,176,5,14,66,175,247,192,21,138,128,139,130,133,
+26,88,147,86,152,103,30,41,175,226,80,247,1,27,247,46,234,247,4,247,73,247,
+65,44,245,251,46,251,15,41,70,33,108,31,247,36,6,181,156,176,162,190,27,179,
+171,123,109,158,31,152,119,144,116,141,89,8,138,46,21,58,130,104,100,77,27,
+74,101,181,217,133,31,14,106,221,22,247,32,247,187,6,200,167,171,165,188,
+27,191,173,104,222,29,238,68,209,40,82,100,123,86,70,30,247,201,251,32,7,
+14,251,140,247,96,247,213,21,245,247,82,247,5,251,222,251,111,98,44,180,251,
+118,247,32,247,118,247,52,234,7,14,34,247,240,22,247,84,248,176,5,251,36,
+6,159,10,32,44,246,251,15,247,32,247,15,246,234,6,14,47,75,10,95,122,101,
+115,89,27,99,107,155,170,119,31,126,160,134,162,149,10,251,35,248,60,40,10,
+106,54,29,247,202,219,10,90,119,154,179,135,31,72,6,110,143,123,147,122,30,
+99,159,191,111,195,27,194,191,167,179,159,31,147,156,143,155,140,168,8,14,
+251,123,179,10,224,197,21,228,198,10,252,3,247,100,97,10,251,40,247,82,248,
+234,21,231,6,247,23,247,50,5,251,23,6,251,139,251,108,21,252,176,247,32,247,
+131,201,238,29,247,36,183,29,69,251,80,5,77,247,80,6,14,47,75,29,251,75,219,
+10,91,119,154,179,135,31,71,6,140,110,142,123,148,122,8,99,158,192,111,194,
+27,194,192,167,179,158,31,148,156,142,155,140,168,8,14,106,54,29,248,12,247,
+28,69,29,47,248,76,249,79,191,29,102,59,80,29,14,50,247,128,247,244,21,107,
+206,10,171,40,169,238,166,6,133,10,112,244,109,6,14,96,248,47,22,214,10,34,
+7,69,247,80,230,247,131,5,251,35,6,69,251,80,5,89,206,10,189,6,229,251,131,
+5,14,94,209,29,195,251,53,247,32,247,166,83,248,63,182,29,70,247,243,87,10,
+214,251,51,247,32,247,164,251,14,6,14,92,247,215,247,55,21,166,144,157,143,
+164,147,8,251,72,247,35,248,176,251,32,251,141,7,112,129,120,134,112,134,
+8,247,13,79,251,17,7,92,142,113,158,169,26,221,10,101,161,114,30,108,168,
+192,120,202,27,150,147,139,140,155,31,251,8,199,7,14,92,248,29,22,198,251,
+49,247,32,247,162,83,248,63,82,10,47,50,29,106,54,29,230,247,109,52,10,194,
+247,35,248,71,21,252,71,247,210,7,247,6,215,205,238,198,111,190,91,171,31,
+155,114,90,151,99,27,251,82,239,242,244,36,247,27,251,19,251,27,52,34,6,247,
+106,251,216,21,247,5,247,79,7,180,160,120,101,102,118,120,98,31,14,102,247,
+199,248,187,21,251,63,39,35,251,70,251,66,240,33,247,58,247,58,240,245,247,
+67,247,65,38,247,0,251,54,31,251,20,251,137,21,223,151,185,188,205,27,210,
+187,82,48,147,31,123,101,133,137,127,27,127,124,146,156,118,31,163,109,123,
+146,116,27,120,126,135,121,93,31,247,139,53,21,66,125,93,94,76,27,102,103,
+157,169,118,31,122,163,132,159,132,182,8,151,169,153,142,154,27,160,153,132,
+118,165,31,120,162,153,132,155,27,155,152,143,157,185,31,14,137,248,227,248,
+171,21,148,105,124,141,116,27,65,97,101,52,117,31,80,251,121,251,12,247,240,
+5,251,33,6,247,92,252,176,5,247,15,6,247,12,248,30,5,172,149,146,147,158,
+27,149,139,139,124,180,31,14,251,43,247,149,116,21,247,8,143,221,211,235,
+26,196,114,177,79,173,30,89,29,150,137,127,153,230,29,110,111,99,180,29,251,
+32,6,141,251,6,204,67,247,5,125,96,54,24,149,159,148,141,143,10,116,146,162,
+86,175,29,205,167,201,10,91,125,200,29,14,251,40,247,66,248,175,21,251,209,
+140,5,251,5,247,69,252,63,109,10,6,14,47,247,203,117,21,247,7,146,225,224,
+149,247,9,8,106,10,247,26,6,121,10,251,63,220,41,247,44,127,31,96,55,5,148,
+157,150,194,29,112,112,147,161,89,175,29,202,170,193,10,124,126,137,134,126,
+31,14,72,248,19,247,5,21,71,251,165,247,32,247,52,210,248,176,251,32,251,
+141,6,122,94,101,132,100,124,29,191,196,148,156,196,31,14,247,3,248,103,247,
+21,21,42,251,39,5,247,10,6,175,204,174,74,5,247,11,6,41,247,39,235,247,37,
+5,251,11,6,106,77,107,198,5,194,173,171,209,224,26,247,26,63,212,251,32,30,
+251,186,253,47,247,29,247,130,247,63,6,145,144,139,140,146,31,251,81,247,
+5,21,247,93,247,20,7,213,173,107,71,70,105,107,65,31,14,247,244,248,140,249,
+96,21,251,96,251,52,251,51,251,94,251,91,247,52,251,51,247,93,247,91,247,
+52,247,52,247,92,247,89,251,53,247,54,251,87,31,164,82,21,247,35,126,247,
+6,251,6,153,251,37,8,251,163,6,247,164,82,21,130,251,34,251,13,251,15,251,
+34,128,8,247,168,7,83,251,168,21,251,39,153,251,5,247,5,125,247,41,8,247,
+166,6,251,166,196,21,153,247,36,247,7,247,6,247,37,153,8,251,164,7,14,247,
+160,176,137,21,247,105,175,143,165,200,31,247,5,189,223,247,51,247,55,26,
+225,112,214,95,173,30,164,108,94,151,80,27,251,8,56,107,77,94,31,113,103,
+129,100,137,66,204,171,24,151,7,193,156,177,173,162,30,156,150,149,142,185,
+148,66,252,31,24,124,69,115,97,110,129,8,119,6,211,138,21,200,188,154,172,
+161,247,15,194,247,210,24,146,6,144,6,158,6,169,151,136,127,158,31,179,114,
+161,81,58,26,32,115,52,92,76,30,100,89,88,110,84,136,8,247,123,251,125,21,
+206,6,173,247,82,5,125,170,151,136,158,27,247,6,238,247,41,247,66,236,100,
+189,62,92,99,119,102,109,31,105,97,121,85,117,251,11,8,185,251,0,21,174,247,
+84,5,225,155,173,188,183,27,178,160,99,65,251,32,86,251,2,71,113,119,149,
+161,121,31,14,247,240,248,140,249,96,21,251,94,251,53,251,49,251,89,251,92,
+247,50,251,52,247,91,247,89,247,52,247,52,247,89,247,86,251,52,247,55,251,
+83,31,128,82,21,247,61,247,28,251,24,251,58,251,60,251,25,251,26,251,59,251,
+58,251,26,247,26,247,58,247,55,247,26,247,29,247,53,31,14,63,184,146,21,228,
+6,174,247,2,161,209,180,210,193,200,25,195,187,190,175,168,27,151,147,130,
+125,126,139,139,125,98,31,76,251,104,5,129,106,134,115,121,26,108,158,115,
+164,173,190,178,206,195,30,118,153,129,129,138,138,126,125,25,118,121,129,
+132,127,27,132,132,147,147,142,141,147,141,146,31,143,149,141,146,140,141,
+200,247,99,24,158,200,141,149,160,26,181,114,171,106,87,63,86,58,75,30,103,
+92,137,137,134,133,131,130,25,204,247,107,247,53,220,158,193,251,58,52,188,
+247,53,251,62,118,130,111,5,189,153,132,116,129,138,136,123,77,31,123,81,
+251,7,82,122,89,247,7,195,5,14,247,110,249,141,247,59,21,38,91,89,102,51,
+27,95,103,148,169,64,31,233,247,1,148,160,175,247,76,8,247,36,194,239,245,
+236,26,213,84,193,63,63,72,77,39,107,30,121,81,132,97,130,251,10,61,140,88,
+152,90,172,8,88,173,110,189,193,26,180,157,173,175,170,30,176,170,160,149,
+223,162,130,169,24,251,46,110,66,80,46,26,80,168,81,188,95,30,195,91,200,
+119,242,137,131,251,22,106,42,86,93,8,184,41,81,156,90,27,79,98,115,103,85,
+202,103,234,197,174,149,178,217,31,103,233,191,126,188,27,192,194,164,179,
+175,31,161,163,152,161,157,185,8,251,117,247,149,21,143,141,194,140,154,30,
+142,224,144,170,156,186,8,193,159,179,173,183,27,181,171,101,89,93,114,83,
+99,95,31,109,106,109,120,58,100,8,251,108,251,237,21,110,95,99,126,94,27,
+74,81,164,167,164,173,154,193,169,171,131,124,174,31,191,117,139,139,154,
+133,8,14,100,165,248,125,21,123,7,86,187,101,207,207,180,173,196,186,120,
+154,57,157,30,81,152,124,147,157,26,164,164,157,173,177,156,125,102,147,30,
+182,6,199,137,101,173,74,27,77,98,105,87,96,162,122,211,126,31,200,127,157,
+129,113,26,112,112,120,100,93,113,162,180,138,30,247,118,247,81,21,251,188,
+182,247,162,143,7,199,251,162,5,192,6,199,247,162,5,143,251,162,182,247,188,
+59,6,87,251,147,84,247,147,5,14,99,247,67,248,219,21,180,202,187,157,187,
+27,219,199,74,53,46,79,61,69,107,113,150,158,125,31,159,176,142,148,157,26,
+164,121,158,114,109,118,113,102,94,171,103,203,115,30,65,117,106,115,69,59,
+162,118,24,209,210,178,160,203,27,242,221,52,251,2,32,73,52,59,86,95,175,
+182,157,144,151,154,158,31,102,141,126,144,94,169,8,166,98,116,148,112,27,
+89,93,95,90,115,147,120,162,108,31,166,161,5,124,158,134,151,156,26,172,167,
+167,173,174,171,105,100,121,133,127,120,121,30,177,138,144,138,165,121,8,
+93,207,184,121,183,27,247,6,247,0,247,14,247,21,201,114,199,96,184,31,104,
+174,109,155,78,157,188,159,161,150,164,160,8,182,174,166,198,200,26,244,49,
+228,251,0,73,82,116,77,53,30,14,155,249,44,249,20,21,118,167,114,125,5,171,
+81,135,141,109,27,100,104,125,105,90,31,186,79,119,149,102,27,77,77,98,72,
+101,31,96,66,115,42,45,26,251,10,179,251,3,207,67,30,78,197,222,102,216,27,
+213,216,172,195,194,31,171,171,156,167,166,200,114,150,24,107,95,127,124,
+119,119,8,102,100,86,119,79,27,58,62,175,197,94,31,89,205,110,237,245,26,
+215,153,209,164,191,30,190,163,188,173,187,27,160,153,133,114,171,31,152,
+129,5,92,85,126,112,93,26,97,156,101,182,83,30,181,84,139,139,144,131,8,159,
+109,148,114,117,26,124,131,119,127,124,30,120,123,122,131,114,27,87,95,185,
+193,158,143,153,150,159,31,106,154,5,127,109,135,124,117,26,64,205,74,216,
+219,203,206,222,174,128,171,117,171,30,117,169,98,189,118,161,8,103,176,131,
+152,167,26,190,179,177,192,161,155,131,109,174,30,141,138,145,133,147,133,
+8,14,44,248,57,247,4,21,80,74,101,117,99,27,84,95,181,191,158,142,156,148,
+174,31,246,160,177,150,178,162,8,204,177,178,192,189,26,189,106,169,82,251,
+35,251,51,251,71,251,54,47,193,81,225,206,200,172,219,220,30,251,127,247,
+24,21,159,198,155,172,164,174,8,196,179,179,170,169,27,160,155,123,117,110,
+116,96,108,108,31,104,105,108,124,51,114,8,14,251,98,211,247,4,21,102,251,
+4,5,248,10,6,176,247,4,5,92,6,165,225,147,183,202,26,247,17,92,201,44,30,
+251,58,6,94,141,130,146,135,170,8,119,116,133,123,111,26,113,148,113,155,
+124,30,127,151,154,135,171,27,247,33,6,237,166,109,251,1,88,135,111,125,87,
+31,14,251,208,228,247,4,21,107,251,4,5,247,33,6,184,235,165,97,141,133,149,
+91,25,155,157,144,158,188,26,173,136,172,129,206,30,130,199,137,166,176,26,
+160,140,153,142,160,30,141,153,140,150,148,26,175,118,155,82,147,30,85,147,
+121,147,125,162,8,123,116,134,125,115,26,116,145,118,151,123,30,154,118,151,
+134,181,135,8,190,134,155,121,89,26,59,132,67,128,94,30,14,210,249,90,127,
+21,252,227,248,225,247,95,53,161,183,251,191,247,18,83,85,247,22,251,186,
+184,159,52,247,94,248,228,252,224,5,14,210,134,127,21,180,98,248,229,248,
+224,51,251,94,185,119,247,21,247,186,83,193,251,190,251,18,160,95,247,96,
+225,5,14,210,134,249,0,21,248,228,252,225,251,96,225,118,95,247,190,251,18,
+195,192,251,21,247,187,93,118,227,251,93,252,229,248,224,5,14,210,249,90,
+249,0,21,98,180,252,228,252,224,226,247,93,94,160,251,22,251,187,195,86,247,
+191,247,18,117,183,251,95,53,5,14,247,240,247,10,248,140,170,29,247,1,247,
+1,161,156,201,167,8,169,7,78,170,96,174,50,229,8,100,6,168,69,162,100,174,
+101,8,247,37,251,143,21,252,248,6,175,179,164,180,165,205,8,100,6,49,48,97,
+105,78,108,8,109,7,203,111,151,129,247,9,251,8,177,29,14,247,240,249,255,
+248,140,21,252,248,6,174,177,165,182,165,205,8,100,6,47,46,99,107,78,108,
+8,109,7,201,112,161,121,247,1,251,1,177,29,253,137,251,93,170,29,247,9,247,
+8,151,148,203,168,8,169,7,78,170,94,176,52,227,8,100,6,168,69,161,101,175,
+100,8,14,210,248,224,247,71,21,118,131,106,122,73,104,8,248,22,7,192,111,
+188,114,157,131,155,160,24,32,216,56,212,84,203,84,75,72,79,251,14,49,154,
+118,24,158,147,187,163,193,168,8,252,22,7,72,174,107,155,117,148,124,119,
+24,247,14,48,204,82,196,73,197,205,217,208,247,1,218,8,251,184,248,21,21,
+162,158,145,144,157,150,157,128,146,134,162,120,8,252,101,7,112,118,136,136,
+121,129,122,149,135,142,113,160,8,14,251,42,220,22,247,25,6,245,186,148,169,
+182,31,200,182,175,208,216,26,210,109,202,85,184,30,177,92,92,150,251,7,27,
+251,25,69,247,21,6,231,175,132,118,170,31,177,111,161,109,146,105,8,251,247,
+63,247,247,6,132,108,123,114,107,111,105,111,104,132,37,138,8,251,21,6,14,
+247,240,249,109,248,169,21,247,9,252,98,251,9,7,248,98,251,215,21,247,9,251,
+64,247,65,251,9,251,65,251,65,251,9,247,65,251,64,247,9,247,64,7,14,213,248,
+31,249,130,21,72,254,124,206,6,14,210,247,144,250,10,21,235,10,238,22,235,
+10,14,247,244,248,169,248,149,21,73,6,251,116,252,149,5,219,6,247,69,248,
+45,247,69,252,45,5,219,6,14,247,244,248,169,22,247,116,248,149,5,59,6,251,
+69,252,45,251,69,248,45,5,59,6,247,116,252,149,5,14,247,240,248,61,248,155,
+21,47,109,84,70,55,26,42,213,62,247,1,122,30,158,251,42,149,55,121,26,82,
+107,89,103,130,136,143,148,142,139,139,141,149,30,141,146,140,143,145,26,
+167,116,162,109,108,116,115,107,99,174,111,189,192,187,171,193,164,30,163,
+191,152,238,142,247,52,8,228,169,195,210,222,26,234,69,214,32,158,30,116,
+247,38,128,222,159,26,201,172,194,175,148,143,135,131,136,139,136,136,129,
+30,137,131,138,135,133,26,111,163,118,171,171,161,162,172,179,100,169,87,
+86,95,110,87,114,30,110,78,129,72,137,251,53,8,247,26,251,236,21,219,130,
+228,122,247,3,30,220,119,190,81,65,26,75,99,84,73,112,30,37,130,21,54,157,
+84,200,215,26,204,180,193,208,164,30,142,43,151,251,16,154,60,8,14,247,240,
+249,122,249,5,21,103,109,110,103,103,168,109,232,10,103,31,252,124,152,10,
+247,137,252,133,151,29,14,247,240,249,124,249,5,90,10,248,125,252,133,90,
+10,14,247,240,248,135,247,138,21,247,128,208,251,89,6,196,239,5,247,32,208,
+38,6,169,191,89,168,93,58,5,251,200,70,247,161,6,83,39,5,251,105,70,247,66,
+6,82,40,5,251,9,70,217,6,111,90,189,111,182,216,5,247,224,208,251,185,6,14,
+247,240,249,204,248,219,21,253,35,251,183,5,96,7,249,35,251,184,5,215,7,252,
+173,247,129,248,173,247,130,5,77,4,252,34,251,68,248,34,251,67,5,215,7,251,
+123,238,247,123,239,5,14,247,240,247,61,248,219,21,64,7,248,173,251,130,252,
+173,251,129,5,63,7,249,35,247,184,5,182,7,253,35,247,46,21,63,7,247,123,39,
+251,123,40,5,63,7,248,34,247,67,5,14,247,240,248,249,76,21,180,165,111,188,
+5,229,168,190,225,247,16,26,229,110,206,81,184,30,171,99,102,148,49,27,251,
+62,6,96,212,97,114,167,91,5,86,77,229,6,247,109,252,6,5,123,6,251,183,77,
+247,172,6,173,145,139,141,161,31,251,88,248,66,21,247,37,6,247,13,191,83,
+251,21,38,105,81,68,120,31,14,247,240,248,138,249,76,98,10,247,188,252,26,
+21,251,47,123,251,20,251,8,251,48,27,251,48,251,21,247,8,247,47,123,31,140,
+198,21,247,46,155,247,20,247,9,247,47,27,247,49,247,20,251,8,251,47,155,31,
+14,247,240,248,138,249,75,21,251,93,112,29,251,84,31,251,130,252,185,21,94,
+195,117,201,209,26,247,58,247,26,247,27,247,58,208,202,117,94,197,30,183,
+96,21,184,83,161,77,67,26,251,57,251,27,251,26,251,58,71,75,161,184,82,30,
+14,247,240,248,134,248,32,21,105,112,113,104,106,166,112,172,173,166,166,
+173,172,112,166,106,31,143,247,192,98,10,131,79,21,247,63,247,27,251,24,251,
+61,251,57,251,28,251,26,251,58,251,59,251,27,247,26,247,56,247,57,247,27,
+247,29,247,55,31,14,247,240,247,73,22,205,247,137,248,198,206,252,198,247,
+136,73,6,14,247,240,249,189,248,192,21,73,251,136,252,198,72,248,198,251,
+137,205,6,14,247,240,248,98,22,206,248,201,247,131,206,252,182,72,247,132,
+6,14,247,240,247,108,248,218,21,247,137,252,218,5,207,6,247,142,248,218,5,
+65,6,251,102,252,128,251,99,248,128,5,67,253,107,21,248,195,205,252,195,6,
+14,247,240,250,122,247,174,21,88,6,251,49,251,7,105,70,61,31,38,45,109,51,
+140,251,88,8,88,201,190,7,141,170,140,247,50,173,221,235,214,25,200,184,234,
+163,247,21,142,8,190,6,14,247,240,137,247,174,21,76,190,7,247,8,137,230,118,
+198,102,8,247,0,67,180,49,251,57,26,141,108,5,88,202,190,7,140,247,86,108,
+228,38,234,8,208,61,251,6,173,251,49,27,14,247,240,137,247,111,21,190,6,247,
+48,247,7,173,208,217,31,240,234,170,227,138,247,86,8,190,76,88,7,137,108,
+138,251,50,105,58,43,64,25,80,94,41,114,251,19,137,8,88,6,14,247,240,250,
+122,247,111,21,202,88,7,251,6,141,43,160,82,176,8,251,0,212,98,227,247,57,
+26,137,170,5,190,77,88,7,138,251,88,170,52,239,45,8,70,217,247,7,105,247,
+49,27,14,210,248,234,176,21,251,130,248,107,251,130,252,107,5,248,15,198,
+21,251,175,6,247,35,247,176,5,14,210,247,19,170,21,248,102,247,133,252,102,
+247,132,5,201,252,14,21,247,173,7,247,179,251,35,5,14,210,247,14,248,143,
+21,247,130,252,107,247,130,248,107,5,252,15,80,21,247,175,6,251,35,251,176,
+5,14,210,248,229,170,21,248,117,7,252,102,251,132,5,248,40,251,30,21,251,
+179,247,30,247,179,247,35,5,14,247,240,247,133,247,223,21,247,157,251,184,
+247,153,247,182,251,159,247,186,5,14,247,240,247,82,247,224,21,247,202,251,
+235,247,203,247,236,251,203,247,235,5,251,157,251,235,21,247,157,247,184,
+247,157,251,184,251,157,251,185,5,14,251,42,247,139,248,99,21,35,53,54,37,
+251,0,223,54,246,243,224,224,244,244,54,224,34,31,140,81,21,211,198,80,66,
+67,80,79,68,63,81,198,215,209,200,198,211,31,14,210,247,111,251,47,21,247,
+174,194,43,249,220,235,194,251,174,6,191,254,19,21,249,220,221,253,220,7,
+14,210,248,137,251,47,21,250,74,251,174,84,236,253,220,42,84,7,247,122,194,
+21,58,249,220,220,6,14,116,162,248,176,148,247,72,151,6,247,16,10,247,31,
+11,200,146,144,142,143,154,150,146,144,142,142,143,12,12,202,144,149,144,
+153,144,146,151,151,142,142,151,12,13,247,170,20,249,28,21,190,19,0,212,2,
+0,1,0,6,0,30,0,37,0,70,0,76,0,100,0,114,0,154,0,162,0,165,0,173,1,67,1,71,
+1,75,1,109,1,220,2,74,2,82,2,89,2,184,2,197,2,228,3,3,3,8,3,93,3,98,3,105,
+3,137,3,213,4,28,4,37,4,48,4,90,4,150,4,169,4,181,4,238,5,15,5,46,5,51,5,
+92,5,97,5,146,5,191,5,195,5,241,5,245,6,15,6,20,6,57,6,76,6,88,6,92,6,104,
+6,116,6,157,6,168,6,173,6,180,6,184,6,187,6,208,6,211,6,217,6,221,6,226,7,
+5,7,9,7,15,7,49,7,83,7,93,7,98,7,107,7,129,7,132,7,162,7,172,7,182,7,187,
+7,192,7,219,7,235,8,7,8,35,8,63,8,90,8,117,8,123,8,138,8,144,8,170,8,187,
+8,192,8,204,8,218,8,242,9,10,9,20,9,43,9,66,9,80,9,87,9,91,9,104,9,111,9,
+132,9,137,9,142,9,148,9,163,9,169,9,174,9,185,9,205,9,225,9,228,9,247,9,254,
+10,5,10,18,10,37,10,46,10,56,10,74,10,92,10,110,10,128,10,146,10,162,10,165,
+10,182,10,199,10,209,10,221,10,225,10,229,10,244,11,3,11,12,11,27,11,32,11,
+39,11,53,11,67,11,75,11,89,11,103,11,115,11,123,11,127,11,137,11,150,11,163,
+11,176,11,181,11,194,11,198,11,205,11,213,11,225,11,229,11,241,11,246,12,
+2,12,14,12,24,12,28,12,34,12,38,12,43,12,51,12,62,12,73,12,80,12,91,12,102,
+12,113,12,124,12,128,12,137,12,144,12,151,12,156,12,166,12,176,12,186,12,
+196,12,206,12,216,12,226,12,234,12,242,12,251,13,4,13,13,13,22,13,31,13,40,
+13,49,13,58,13,67,13,76,13,85,13,92,13,98,13,104,13,110,13,116,13,121,13,
+126,13,130,248,26,44,29,11,248,140,166,29,108,10,227,27,227,216,165,187,192,
+31,188,183,161,197,221,26,248,130,7,11,248,137,210,10,103,10,11,248,243,248,
+143,21,79,10,251,48,148,246,54,247,78,27,247,80,247,3,226,247,41,247,7,81,
+199,251,27,165,31,141,29,11,248,177,22,93,29,11,21,251,4,206,7,140,89,117,
+109,93,130,8,93,7,209,141,194,203,136,217,8,242,7,14,248,158,247,230,21,121,
+10,251,70,232,35,85,29,11,248,30,248,176,156,10,5,83,104,101,87,128,130,141,
+143,122,30,34,7,136,160,151,138,156,27,175,179,146,149,164,31,178,155,156,
+161,162,204,241,29,11,105,10,247,78,247,14,92,10,51,10,14,238,10,251,42,5,
+209,6,14,249,92,247,44,21,99,127,95,111,91,27,100,104,157,170,119,31,124,
+162,134,163,185,26,196,10,191,126,175,30,238,102,53,197,251,4,27,78,86,122,
+106,98,31,172,101,80,156,61,27,251,41,62,76,251,16,137,31,247,23,6,193,146,
+164,159,202,27,196,167,122,103,123,130,123,124,131,205,29,251,0,121,88,84,
+41,26,38,204,75,242,220,201,170,213,201,30,71,181,209,103,227,27,247,14,236,
+207,246,170,31,252,132,203,21,57,100,94,67,92,110,164,180,180,166,164,192,
+146,30,187,146,169,144,151,143,156,149,25,247,33,204,21,220,145,176,181,203,
+27,204,176,97,58,146,31,11,202,88,10,11,21,32,155,10,21,56,192,6,167,151,
+153,165,152,229,10,109,110,140,118,27,46,94,95,48,31,74,63,46,215,252,72,
+247,32,248,72,222,7,11,248,154,182,10,218,48,176,44,251,2,26,44,109,82,89,
+117,123,149,159,126,30,126,161,135,165,203,26,247,62,251,18,251,62,7,81,136,
+114,129,118,30,114,127,120,126,115,27,89,109,196,234,247,3,176,233,218,230,
+31,251,44,6,67,49,107,47,251,7,26,51,159,75,181,90,30,97,175,189,116,193,
+27,205,188,172,207,173,31,70,174,187,107,205,27,193,190,163,181,175,31,180,
+188,159,203,225,26,247,8,107,231,67,229,30,11,247,57,191,21,89,197,213,114,
+230,27,242,221,172,207,203,31,203,207,177,243,246,26,232,111,233,94,200,30,
+228,238,87,184,56,47,5,198,72,69,164,44,27,34,57,106,71,76,31,73,70,102,36,
+251,1,26,41,166,54,194,65,30,53,44,190,93,5,248,121,248,172,21,153,100,147,
+90,91,26,251,48,60,39,251,15,87,91,157,169,108,30,97,195,21,120,182,129,188,
+194,26,247,49,218,239,247,16,195,186,120,100,176,30,11,106,29,140,251,5,100,
+29,11,248,36,248,176,51,10,11,21,56,7,202,100,96,168,82,27,91,86,115,100,
+102,31,85,83,111,61,44,26,251,58,227,251,6,247,21,197,174,158,198,188,30,
+66,7,74,93,94,73,89,108,161,180,128,30,251,36,6,140,97,154,110,176,109,8,
+104,182,198,122,215,27,247,48,233,214,247,17,31,248,194,7,251,138,251,0,21,
+205,188,66,39,41,92,72,69,78,96,206,237,241,182,210,202,31,11,21,247,18,251,
+42,5,209,6,69,247,42,5,14,248,214,166,29,252,184,251,17,248,9,6,252,9,252,
+115,5,251,17,248,184,247,17,252,8,7,248,8,248,115,5,11,248,95,182,10,252,
+56,251,5,247,141,6,251,159,251,206,5,251,5,248,83,247,5,251,166,7,247,157,
+247,206,5,11,57,29,247,119,11,216,247,231,21,251,231,247,177,7,247,6,208,
+164,199,187,31,194,207,172,243,247,0,26,247,0,106,242,84,208,30,198,90,72,
+164,251,7,27,251,177,251,202,62,59,6,247,119,22,247,42,219,251,42,247,77,
+247,27,6,204,177,123,101,165,31,170,95,154,78,58,26,59,124,78,108,95,30,101,
+113,101,123,74,27,251,27,6,14,248,107,59,29,11,247,205,248,165,46,10,11,72,
+10,140,251,20,21,247,15,217,39,251,50,251,42,58,39,251,12,251,14,60,239,247,
+46,247,46,218,239,247,14,31,11,204,175,170,189,208,26,247,6,38,222,251,30,
+63,66,114,99,97,30,100,102,123,94,68,26,114,247,42,164,7,195,173,173,196,
+195,177,105,89,86,98,102,81,30,94,251,17,195,6,162,162,132,126,159,31,166,
+121,151,113,100,26,73,100,99,76,102,108,152,161,122,30,123,160,132,167,192,
+26,11,21,251,103,251,64,251,64,251,102,251,101,247,64,251,66,247,98,247,108,
+247,63,247,61,247,106,247,103,251,63,247,63,251,103,31,138,67,21,247,60,247,
+29,251,31,251,63,251,66,251,28,251,29,251,64,251,56,251,29,247,33,247,62,
+247,63,247,28,247,31,247,60,31,14,203,10,247,206,247,39,203,10,14,162,122,
+155,68,29,213,177,163,169,30,14,22,247,32,249,109,251,32,251,151,6,179,29,
+66,161,65,175,87,31,86,176,205,106,205,27,207,185,163,193,174,31,251,10,248,
+13,178,29,240,187,208,209,31,11,216,22,247,177,6,247,3,209,165,198,189,31,
+196,207,170,237,247,6,26,247,5,108,237,82,208,30,198,89,70,164,251,4,27,251,
+177,6,247,42,252,240,21,248,115,247,27,7,247,5,195,60,251,53,251,52,83,60,
+251,5,31,11,21,107,135,237,10,119,142,142,133,139,29,150,152,163,27,148,149,
+136,29,247,122,190,10,248,135,247,17,251,241,6,11,248,66,247,44,21,251,44,
+248,172,247,17,252,22,247,81,247,231,247,17,251,231,247,57,248,2,247,17,253,
+62,7,251,155,253,109,5,247,45,6,192,247,44,5,247,115,243,10,251,73,6,247,
+6,247,219,5,206,6,11,247,6,137,51,208,251,37,27,251,29,118,10,106,100,119,
+74,102,111,145,152,121,30,124,150,133,150,133,168,8,251,29,6,11,206,166,29,
+253,109,223,29,170,162,128,117,155,30,152,121,142,124,147,10,94,27,70,89,
+112,79,100,31,247,159,7,11,249,95,127,10,11,21,37,55,105,72,77,31,74,69,102,
+37,251,1,26,251,1,176,36,204,171,10,202,206,178,245,242,26,247,6,102,242,
+74,208,30,208,75,59,171,33,27,11,247,99,101,29,11,133,218,130,232,30,135,
+181,137,160,152,26,157,145,149,151,145,141,138,128,150,30,129,149,151,134,
+152,27,166,160,161,167,169,111,163,104,96,108,108,81,125,31,123,75,134,70,
+251,69,26,11,248,166,247,118,21,140,150,139,149,144,26,190,131,192,126,175,
+239,10,251,1,27,251,46,44,251,4,251,73,251,65,234,33,247,46,247,14,238,208,
+245,170,31,251,36,6,11,247,118,79,29,247,35,6,206,140,189,171,169,199,247,
+176,249,16,24,251,47,6,251,46,252,5,251,47,248,5,5,251,47,6,247,125,252,158,
+120,99,125,103,137,137,115,135,25,251,21,6,11,247,108,81,10,247,43,138,38,
+222,251,76,27,251,67,185,10,241,119,5,239,198,29,182,217,134,30,251,38,6,
+11,247,228,83,29,11,248,204,21,247,23,252,204,5,247,42,6,247,21,248,204,5,
+252,204,192,29,251,118,7,251,20,252,216,251,24,248,216,5,251,116,200,10,14,
+251,32,251,141,6,123,94,100,131,101,124,29,190,196,148,156,197,31,14,142,
+124,10,222,184,240,10,92,124,200,29,14,249,137,52,10,203,29,60,60,81,90,73,
+98,156,127,29,11,205,145,10,252,187,247,32,248,216,114,10,11,247,164,21,247,
+68,247,160,5,251,60,6,52,251,55,51,247,55,5,251,60,6,247,68,251,160,251,72,
+251,164,5,247,60,6,231,247,60,230,251,60,5,11,145,10,251,225,247,32,247,254,
+114,10,11,21,247,0,155,29,151,29,252,125,152,10,11,247,105,95,10,105,10,14,
+251,42,251,244,6,120,70,77,129,91,157,10,247,67,199,167,143,164,233,30,14,
+100,29,14,100,10,251,4,64,29,250,60,42,10,101,29,33,56,29,21,251,94,251,54,
+251,53,251,93,251,88,247,54,251,55,247,89,247,89,247,56,247,55,247,88,247,
+88,251,55,247,58,251,85,31,11,252,183,104,29,190,10,247,42,6,11,8,219,194,
+161,170,199,26,225,85,187,42,39,83,88,47,136,139,132,140,131,30,231,6,138,
+146,138,146,141,26,184,161,165,177,11,247,162,21,247,123,248,95,5,251,60,
+6,251,31,251,214,251,41,247,214,5,251,59,6,247,134,252,95,5,251,162,247,42,
+7,11,251,144,249,109,5,251,58,123,29,11,247,99,202,10,11,21,251,2,251,14,
+247,2,6,11,251,26,6,69,122,111,112,83,27,68,97,202,245,191,149,186,156,171,
+31,186,10,11,111,29,14,252,130,7,51,94,97,45,45,94,181,227,30,248,130,251,
+42,252,130,7,57,161,81,188,95,30,91,192,216,113,11,247,32,247,131,204,7,133,
+10,74,11,21,83,6,92,130,117,120,141,10,14,248,143,119,29,11,251,61,119,10,
+11,21,248,125,247,73,5,247,13,7,252,125,247,74,5,251,3,7,248,18,251,23,252,
+18,251,25,5,14,7,247,12,74,206,251,8,66,90,113,78,99,30,217,7,11,7,147,121,
+122,142,121,27,74,82,85,78,101,166,116,183,186,185,163,179,167,31,160,168,
+147,169,188,26,11,21,108,109,117,129,100,27,113,126,142,155,81,31,156,74,
+106,146,115,27,113,116,130,122,117,31,124,128,11,247,38,21,251,38,225,7,141,
+71,111,100,79,128,8,83,7,246,155,186,196,135,247,2,8,247,29,7,11,54,70,251,
+3,103,150,108,158,118,31,158,120,156,130,191,122,247,59,87,24,174,128,151,
+128,117,26,11,247,109,21,58,99,93,68,92,110,164,179,181,161,159,197,151,30,
+187,148,176,146,145,141,155,147,25,11,248,105,21,129,29,11,247,24,129,52,
+218,251,28,27,251,54,46,33,251,76,11,247,38,21,190,29,11,6,46,129,81,86,46,
+27,251,8,71,233,247,51,247,53,210,235,247,10,226,188,97,50,159,31,11,144,
+29,114,146,162,88,31,120,87,5,118,200,172,132,184,27,11,247,227,131,10,11,
+247,22,247,21,191,195,247,13,31,167,29,11,21,252,59,253,115,5,226,6,248,59,
+249,115,5,11,6,70,247,80,5,251,33,6,228,251,131,251,4,251,193,5,247,36,6,
+228,247,131,5,11,251,17,219,7,141,89,113,110,83,129,8,93,7,227,147,190,195,
+135,226,8,247,1,7,11,216,29,49,233,29,251,39,251,128,11,21,251,59,247,38,
+5,251,6,7,240,50,38,50,5,251,9,7,247,59,247,40,5,11,57,206,73,222,220,207,
+205,219,223,73,205,55,31,59,4,179,170,108,100,101,107,108,11,229,251,131,
+5,247,35,6,251,3,247,193,197,10,11,22,247,202,6,161,29,11,119,141,10,11,21,
+247,0,247,42,5,63,6,56,42,58,213,29,174,10,215,6,222,189,10,6,48,247,165,
+5,251,44,6,247,7,251,229,251,50,252,28,5,247,50,6,11,160,30,153,10,11,248,
+176,151,10,11,95,27,93,160,10,11,247,26,251,223,5,247,50,6,251,50,248,28,
+234,10,11,158,27,170,230,10,11,156,29,251,32,11,182,10,207,29,208,199,169,
+106,75,30,11,217,45,251,37,63,120,72,105,94,30,119,113,118,122,86,105,8,251,
+17,11,105,26,251,222,247,32,247,254,7,206,121,187,102,170,30,165,108,94,154,
+11,246,155,29,137,190,8,141,232,21,222,148,174,179,201,27,203,177,96,59,146,
+31,11,227,10,251,13,226,29,11,21,215,29,6,202,29,11,22,102,109,110,103,102,
+168,110,232,10,104,31,11,251,69,190,5,100,151,129,147,161,26,169,171,159,
+188,206,172,115,90,11,248,240,21,187,10,247,42,6,11,251,42,5,215,6,221,239,
+221,212,10,21,251,4,252,29,251,11,248,29,5,251,46,6,247,93,252,198,11,27,
+56,91,172,198,31,247,181,251,42,251,181,7,251,31,242,58,11,180,165,112,94,
+98,113,112,98,98,113,166,181,182,165,167,180,31,11,251,3,252,29,251,12,248,
+29,5,251,46,6,247,89,252,176,5,11,114,160,184,133,31,83,129,6,63,195,82,215,
+214,196,196,214,30,11,4,247,111,247,32,7,219,176,104,65,64,102,104,59,31,
+14,167,10,14,21,251,181,234,248,61,75,7,89,125,93,114,61,27,78,7,11,22,223,
+6,223,138,213,211,136,217,8,248,91,247,123,252,240,11,148,137,135,151,31,
+210,113,5,131,11,251,42,251,165,251,181,247,165,174,29,6,11,21,171,29,11,
+242,10,6,14,6,247,26,225,234,247,40,247,38,56,219,251,44,31,11,172,30,153,
+105,112,143,70,27,251,172,77,247,183,6,11,233,10,243,221,172,207,202,31,11,
+251,16,118,69,70,34,27,35,68,208,247,16,118,31,11,192,29,251,42,11,21,251,
+0,251,42,5,11,130,121,159,30,160,121,147,121,145,93,140,128,24,11,6,56,104,
+132,114,101,31,75,96,105,66,44,26,11,214,29,73,242,10,252,240,11,170,118,
+93,151,30,247,32,6,247,5,120,55,199,11,212,22,247,32,248,63,247,82,247,5,
+251,222,6,11,30,61,89,116,101,136,58,8,247,202,6,14,251,32,252,63,251,65,
+199,10,248,176,21,11,133,184,27,222,185,240,10,91,124,11,21,251,79,6,153,
+156,145,145,147,146,145,144,11,38,57,251,34,251,5,196,84,247,40,111,31,11,
+169,155,170,155,179,27,196,166,112,68,155,31,11,208,29,252,240,11,110,79,
+105,31,247,10,111,21,210,186,71,35,11,239,220,212,10,166,29,251,42,253,109,
+11,251,31,31,251,52,247,169,11,6,173,247,66,5,34,6,105,251,66,5,11,201,10,
+92,11,27,251,47,44,251,4,251,73,251,65,233,11,249,53,217,10,11,247,254,6,
+140,151,139,146,144,26,193,131,11,229,247,131,5,251,34,6,69,251,80,5,11,6,
+247,26,247,50,5,251,26,6,14,242,29,6,14,253,109,247,42,6,11,133,220,29,11,
+249,109,228,10,11,238,10,251,39,5,209,6,11,30,186,7,136,120,120,137,119,27,
+87,11,156,161,166,8,181,190,161,208,220,26,11,247,80,215,29,247,131,11,61,
+247,37,251,32,251,37,70,46,208,11,199,186,168,112,96,30,251,252,247,32,11,
+110,110,102,103,169,110,176,174,168,169,11,247,39,21,187,251,39,5,247,46,
+6,11,6,228,237,29,39,5,217,6,36,247,42,5,14,6,247,26,251,223,5,11,251,52,
+247,32,247,165,11,247,32,248,176,11,138,136,158,30,247,34,7,140,131,11,21,
+65,6,85,251,148,5,196,6,11,26,79,193,104,234,167,158,141,146,11,247,98,21,
+99,135,119,124,91,27,11,247,109,247,223,21,247,181,251,223,11,247,113,251,
+32,251,113,7,87,150,11,104,93,61,135,31,202,6,171,144,11,247,42,247,38,251,
+42,6,14,27,198,170,181,224,144,31,14,4,251,32,251,17,247,32,6,11,6,251,148,
+247,166,21,113,56,11,21,252,120,251,11,248,120,6,11,21,251,32,253,109,247,
+32,6,11,152,138,137,153,30,244,7,141,11,159,125,118,116,114,121,107,111,11,
+170,170,197,153,31,155,203,144,11,175,176,168,168,176,174,110,169,11,70,30,
+71,202,221,106,243,27,11,247,7,247,229,5,251,44,6,11,28,251,139,197,28,4,
+117,7,11,252,170,84,248,170,6,14,127,123,118,27,132,11,21,251,18,6,69,11,
+30,237,103,52,198,11,172,199,183,110,166,11,5,251,51,6,11,248,240,251,42,
+11,247,17,21,11,};
+#endif
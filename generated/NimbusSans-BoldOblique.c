@@ -0,0 +1,2215 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusSans_BoldOblique_cff_size = 46763;
+asm(".section .rodata");
+asm(".global fz_font_NimbusSans_BoldOblique_cff");
+asm(".type fz_font_NimbusSans_BoldOblique_cff STT_OBJECT");
+asm(".size fz_font_NimbusSans_BoldOblique_cff, 46763");
+asm(".balign 64");
+asm("fz_font_NimbusSans_BoldOblique_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusSans-BoldOblique.cff\"");
+#else
+const int fz_font_NimbusSans_BoldOblique_cff_size = 46763;
+const char fz_font_NimbusSans_BoldOblique_cff[] = {
+1,0,4,2,0,1,1,1,23,78,105,109,98,117,115,83,97,110,115,45,66,111,108,100,
+79,98,108,105,113,117,101,0,1,1,1,61,250,26,0,250,27,1,250,28,12,0,250,29,
+2,250,30,3,248,20,4,127,12,2,251,3,12,3,208,12,4,251,36,251,201,28,4,172,
+250,197,5,29,0,76,156,238,13,28,43,50,15,28,43,72,17,176,29,0,0,163,228,18,
+2,4,2,0,1,0,3,0,9,0,16,0,22,0,28,0,38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,
+0,99,0,105,0,111,0,117,0,123,0,136,0,142,0,148,0,154,0,162,0,168,0,173,0,
+186,0,192,0,202,0,209,0,216,0,227,0,238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,
+1,49,1,60,1,72,1,84,1,96,1,103,1,115,1,126,1,138,1,145,1,152,1,158,1,164,
+1,166,1,171,1,177,1,184,1,190,1,196,1,206,1,212,1,218,1,224,1,234,1,241,1,
+247,2,1,2,7,2,13,2,19,2,25,2,38,2,44,2,50,2,61,2,73,2,79,2,84,2,97,2,103,
+2,113,2,117,2,124,2,135,2,144,2,151,2,162,2,173,2,180,2,191,2,197,2,204,2,
+215,2,227,2,239,2,251,3,2,3,14,3,20,3,27,3,34,3,40,3,48,3,60,3,64,3,70,3,
+74,3,79,3,86,3,93,3,100,3,109,3,118,3,131,3,138,3,145,3,155,3,166,3,172,3,
+179,3,183,3,189,3,200,3,206,3,212,3,216,3,222,3,234,3,246,4,2,4,8,4,18,4,
+29,4,36,4,39,4,43,4,46,4,50,4,62,4,73,4,79,4,86,4,92,4,98,4,104,4,110,4,116,
+4,122,4,128,4,135,4,142,4,151,4,163,4,168,4,175,4,179,4,184,4,188,4,194,4,
+205,4,208,4,217,4,223,4,232,4,242,4,251,5,2,5,9,5,19,5,28,5,37,5,44,5,53,
+5,62,5,74,5,81,5,88,5,94,5,108,5,117,5,127,5,136,5,141,5,152,5,160,5,168,
+5,176,5,181,5,193,5,203,5,211,5,222,5,229,5,237,5,247,6,1,6,12,6,21,6,33,
+6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,112,6,121,6,128,6,137,6,146,6,157,6,
+171,6,182,6,191,6,196,6,210,6,222,6,236,6,248,7,2,7,14,7,27,7,39,7,52,7,59,
+7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,115,7,122,7,134,7,142,7,151,7,158,
+7,165,7,179,7,184,7,188,7,193,7,200,7,207,7,211,7,214,7,219,7,223,7,228,7,
+234,7,236,7,238,7,240,7,247,7,249,7,252,8,1,8,4,8,11,8,14,8,17,8,20,8,27,
+8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,8,80,8,87,8,89,8,91,8,98,
+8,100,8,103,8,108,8,111,8,118,8,121,8,124,8,127,8,132,8,139,8,145,8,149,8,
+155,8,167,8,182,8,187,8,200,8,210,8,222,8,230,8,239,8,251,9,5,9,17,9,29,9,
+44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,134,9,154,9,163,9,172,9,181,9,190,
+9,199,9,208,9,217,9,226,9,235,9,244,9,253,10,6,10,15,10,24,10,33,10,42,10,
+51,10,60,10,69,10,78,10,87,10,96,10,105,10,114,10,123,10,132,10,141,10,150,
+10,159,10,168,10,177,10,186,10,195,10,204,10,213,10,222,10,229,10,236,10,
+245,10,254,11,7,11,16,11,25,11,32,11,39,11,46,11,53,11,60,11,69,11,76,11,
+83,11,92,11,101,11,110,11,119,11,128,11,137,11,144,11,151,11,158,11,165,11,
+172,11,179,11,186,11,193,11,200,11,207,11,214,11,221,11,228,11,235,11,242,
+11,249,12,0,12,9,12,18,12,27,12,36,12,45,12,54,12,63,12,72,12,81,12,90,12,
+99,12,108,12,117,12,126,12,135,12,144,12,153,12,162,12,171,12,180,12,189,
+12,198,12,207,12,216,12,225,12,234,12,243,12,252,13,5,13,14,13,23,13,32,13,
+41,13,50,13,59,13,68,13,77,13,86,13,95,13,102,13,111,13,120,13,127,13,134,
+13,143,13,150,13,157,13,164,13,173,13,182,13,191,13,200,13,209,13,218,13,
+225,13,232,13,239,13,246,13,253,14,4,14,11,14,18,14,25,14,32,14,39,14,46,
+14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,102,14,109,14,116,14,123,14,
+130,14,137,14,144,14,151,14,158,14,165,14,172,14,179,14,186,14,193,14,200,
+14,207,14,214,14,221,14,228,14,235,14,242,14,249,15,0,15,7,15,14,15,21,15,
+28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,15,84,15,91,15,98,15,105,15,
+112,15,119,15,126,15,133,15,140,15,147,15,154,15,161,15,168,15,178,15,185,
+15,192,15,196,15,250,16,58,16,81,16,91,73,74,65,98,114,101,118,101,65,111,
+103,111,110,101,107,67,97,99,117,116,101,67,99,97,114,111,110,67,100,111,
+116,97,99,99,101,110,116,68,99,97,114,111,110,68,99,114,111,97,116,69,99,
+97,114,111,110,69,100,111,116,97,99,99,101,110,116,69,111,103,111,110,101,
+107,71,98,114,101,118,101,71,100,111,116,97,99,99,101,110,116,73,100,111,
+116,97,99,99,101,110,116,76,97,99,117,116,101,76,99,97,114,111,110,78,97,
+99,117,116,101,78,99,97,114,111,110,79,104,117,110,103,97,114,117,109,108,
+97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,83,97,99,117,116,101,
+83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,114,105,110,103,85,104,
+117,110,103,97,114,117,109,108,97,117,116,90,97,99,117,116,101,90,100,111,
+116,97,99,99,101,110,116,65,109,97,99,114,111,110,117,110,105,48,50,49,65,
+67,99,105,114,99,117,109,102,108,101,120,87,99,105,114,99,117,109,102,108,
+101,120,87,100,105,101,114,101,115,105,115,89,99,105,114,99,117,109,102,108,
+101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,105,114,99,117,109,102,
+108,101,120,72,99,105,114,99,117,109,102,108,101,120,73,109,97,99,114,111,
+110,73,111,103,111,110,101,107,74,99,105,114,99,117,109,102,108,101,120,75,
+99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,109,97,97,99,99,101,
+110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,109,97,99,114,111,110,
+82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,114,99,117,109,102,108,
+101,120,71,99,111,109,109,97,97,99,99,101,110,116,85,109,97,99,114,111,110,
+85,111,103,111,110,101,107,69,98,114,101,118,101,73,98,114,101,118,101,105,
+106,108,111,110,103,115,97,98,114,101,118,101,97,111,103,111,110,101,107,
+99,97,99,117,116,101,99,99,97,114,111,110,99,100,111,116,97,99,99,101,110,
+116,100,99,97,114,111,110,100,99,114,111,97,116,101,99,97,114,111,110,101,
+100,111,116,97,99,99,101,110,116,101,111,103,111,110,101,107,103,98,114,101,
+118,101,103,100,111,116,97,99,99,101,110,116,108,97,99,117,116,101,108,99,
+97,114,111,110,110,97,99,117,116,101,110,99,97,114,111,110,111,104,117,110,
+103,97,114,117,109,108,97,117,116,114,97,99,117,116,101,115,97,99,117,116,
+101,115,99,105,114,99,117,109,102,108,101,120,115,99,111,109,109,97,97,99,
+99,101,110,116,116,99,97,114,111,110,117,114,105,110,103,117,104,117,110,
+103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,122,100,111,116,97,
+99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,119,99,105,114,99,
+117,109,102,108,101,120,119,100,105,101,114,101,115,105,115,97,109,97,99,
+114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,99,105,114,99,117,
+109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,114,99,117,109,102,
+108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,110,106,99,105,114,
+99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,99,101,110,116,108,
+99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,109,97,97,99,99,101,
+110,116,111,109,97,99,114,111,110,114,99,111,109,109,97,97,99,99,101,110,
+116,117,98,114,101,118,101,117,109,97,99,114,111,110,117,111,103,111,110,
+101,107,114,99,97,114,111,110,115,99,101,100,105,108,108,97,103,99,111,109,
+109,97,97,99,99,101,110,116,69,117,114,111,112,101,115,101,116,97,108,105,
+114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,110,105,50,50,49,57,
+117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,97,102,105,105,54,49,
+50,52,56,113,117,111,116,101,114,101,118,101,114,115,101,100,117,110,105,
+50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,97,99,117,116,101,
+104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,118,101,105,111,
+103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,111,115,108,97,
+115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,105,108,100,101,
+76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,97,99,99,101,110,
+116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,109,109,97,97,99,
+99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,97,99,117,116,101,
+79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,116,101,69,110,103,
+84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,101,110,108,97,110,
+100,105,99,110,97,112,111,115,116,114,111,112,104,101,85,116,105,108,100,
+101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,103,114,97,118,101,
+87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,117,116,101,89,103,
+114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,48,50,117,110,105,
+48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,115,109,105,108,
+101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,100,99,108,117,
+98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,109,117,115,105,
+99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,108,108,101,116,
+99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,105,108,108,101,
+100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,110,105,50,53,65,
+49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,103,104,116,97,114,
+114,111,119,108,101,102,116,97,114,114,111,119,98,111,116,104,97,114,114,
+111,119,117,112,97,114,114,111,119,100,111,119,110,97,114,114,111,119,117,
+112,100,110,97,114,114,111,119,117,112,100,110,98,115,101,108,111,122,101,
+110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,51,99,97,114,114,105,
+97,103,101,114,101,116,117,114,110,97,110,103,108,101,108,101,102,116,97,
+110,103,108,101,114,105,103,104,116,117,110,105,118,101,114,115,97,108,97,
+108,101,112,104,101,120,105,115,116,101,110,116,105,97,108,73,102,114,97,
+107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,100,105,101,110,
+116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,119,110,97,114,
+114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,108,101,113,117,
+105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,110,116,101,103,
+114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,116,101,103,114,
+97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,101,115,115,101,
+113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,108,114,101,118,
+108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,105,110,116,101,
+114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,112,101,114,112,
+101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,116,121,112,114,
+111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,117,101,110,116,
+116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,116,115,117,109,
+109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,97,114,116,105,97,
+108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,105,112,108,121,
+119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,117,98,115,101,
+116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,101,114,115,101,
+116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,102,108,101,120,
+115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,117,98,115,101,
+116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,119,100,98,108,
+108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,104,116,97,114,
+114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,115,99,111,114,
+101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,115,101,116,101,
+120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,53,49,111,114,
+116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,101,99,111,110,
+100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,101,114,105,115,
+107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,116,105,109,97,116,
+101,100,116,114,105,97,103,114,116,116,114,105,97,103,108,102,109,117,115,
+105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,97,66,101,116,97,
+71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,108,111,110,90,101,
+116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,112,112,97,76,97,109,
+98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,110,80,105,82,104,111,
+83,105,103,109,97,84,97,117,85,112,115,105,108,111,110,80,104,105,67,104,
+105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,97,98,101,116,97,103,
+97,109,109,97,100,101,108,116,97,101,112,115,105,108,111,110,122,101,116,
+97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,112,112,97,108,97,
+109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,109,105,99,114,
+111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,117,112,115,105,
+108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,103,97,117,110,
+105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,101,103,97,49,
+105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,105,108,111,110,
+100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,101,114,101,115,
+105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,111,115,69,112,
+115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,110,111,115,73,
+111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,111,110,111,
+115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,111,110,116,
+111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,85,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,97,116,111,
+110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,116,97,116,
+111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,99,114,111,
+110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,117,112,115,
+105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,114,101,115,
+105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,101,114,101,
+115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,97,102,105,
+105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,49,48,48,
+50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,97,102,
+105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,49,48,
+48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,97,102,
+105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,49,48,
+48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,97,102,
+105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,49,48,
+48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,97,102,
+105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,49,48,
+48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,97,102,
+105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,49,48,
+48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,97,102,
+105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,49,48,
+48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,117,
+110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,55,
+97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,105,
+49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,117,
+110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,110,
+105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,117,
+110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,48,
+50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,83,97,110,115,32,66,111,108,100,32,73,116,
+97,108,105,99,78,105,109,98,117,115,83,97,110,115,0,241,2,0,1,0,49,0,178,
+0,223,0,255,1,15,1,37,1,85,1,93,1,127,1,164,2,36,2,165,2,186,3,55,3,106,3,
+123,3,134,3,170,4,29,4,64,4,97,4,104,4,137,4,221,5,12,5,26,5,48,5,53,5,66,
+5,89,5,101,5,110,5,141,5,224,6,50,6,57,6,66,6,138,6,145,6,187,6,230,7,7,7,
+69,7,121,7,153,7,159,7,197,7,214,7,225,8,24,8,37,8,44,8,76,8,93,8,109,8,113,
+8,165,8,208,9,2,9,48,9,96,9,134,9,156,9,162,9,209,9,214,9,219,9,232,10,21,
+10,26,10,70,10,105,10,148,10,153,10,166,10,182,10,223,10,245,11,16,11,43,
+11,82,11,96,11,121,11,158,11,170,11,205,11,229,11,234,12,10,12,42,12,52,12,
+58,12,91,12,113,12,145,12,177,12,206,12,215,12,232,13,6,13,21,13,27,13,56,
+13,85,13,89,13,105,13,133,13,155,13,167,13,182,13,186,13,213,13,238,13,251,
+14,4,14,30,14,56,14,80,14,93,14,107,14,132,14,155,14,166,14,180,14,192,14,
+197,14,205,14,217,14,223,14,246,15,7,15,30,15,43,15,56,15,78,15,100,15,122,
+15,142,15,151,15,172,15,193,15,214,15,235,15,250,16,2,16,14,16,26,16,34,16,
+39,16,43,16,62,16,82,16,102,16,112,16,118,16,137,16,156,16,175,16,193,16,
+204,16,211,16,229,16,247,17,7,17,25,17,28,17,44,17,50,17,67,17,78,17,95,17,
+112,17,127,17,133,17,143,17,159,17,175,17,190,17,206,17,222,17,238,17,254,
+18,12,18,27,18,42,18,48,18,63,18,76,18,85,18,89,18,95,18,101,18,105,18,119,
+18,133,18,147,18,161,18,173,18,187,18,194,18,208,18,222,18,235,18,246,19,
+3,19,16,19,27,19,39,19,51,19,63,19,75,19,87,19,99,19,111,19,123,19,135,19,
+147,19,157,19,167,19,175,19,183,19,194,19,205,19,216,19,227,19,238,19,246,
+20,1,20,10,20,24,20,27,20,30,20,33,20,40,20,45,20,50,20,56,20,63,20,84,20,
+112,20,133,248,163,156,50,29,247,45,6,251,15,247,109,21,57,121,91,93,71,27,
+91,114,156,172,186,176,172,204,150,31,189,147,155,142,149,141,146,140,143,
+140,25,150,141,142,140,151,146,8,11,247,183,247,181,21,247,64,6,196,167,121,
+102,127,137,127,129,102,31,120,71,132,101,113,26,126,141,129,145,121,30,247,
+51,6,145,166,5,126,149,134,149,153,26,146,140,148,141,149,30,162,247,15,144,
+174,164,26,177,113,166,87,156,30,192,165,165,156,163,164,8,178,179,164,202,
+195,26,177,123,178,112,166,30,171,107,99,153,81,27,252,13,192,29,247,42,6,
+227,248,50,21,179,247,82,5,247,60,6,185,162,133,124,158,31,153,126,147,122,
+120,26,111,128,108,120,119,30,110,113,108,127,89,27,11,50,29,247,45,6,251,
+15,247,109,21,57,121,91,93,71,27,91,114,156,172,186,176,172,204,150,31,189,
+147,155,142,149,141,146,140,143,140,25,150,141,142,140,151,146,8,14,247,70,
+248,176,21,251,7,252,176,5,158,29,72,156,29,157,157,26,219,81,191,50,65,85,
+112,75,85,30,157,221,5,11,21,56,6,151,192,104,29,224,29,232,248,72,5,221,
+6,11,72,29,196,163,188,31,198,167,176,165,194,27,173,163,247,4,29,126,140,
+101,8,11,248,253,22,247,156,248,176,5,251,37,6,251,55,252,14,5,248,14,251,
+36,7,251,51,252,14,134,248,14,5,251,37,6,176,252,176,5,247,37,6,247,58,248,
+16,143,252,16,5,11,208,29,82,163,65,74,29,14,248,113,247,162,21,247,220,248,
+95,5,251,59,6,251,99,251,207,57,247,207,5,251,59,6,247,37,252,95,81,251,162,
+119,29,11,249,196,249,109,21,251,34,6,251,1,252,151,251,84,248,151,5,251,
+42,192,29,247,34,6,247,3,248,159,247,84,252,159,5,247,40,6,11,21,118,155,
+124,149,117,151,8,149,121,101,153,132,27,130,132,131,129,130,141,136,159,
+123,31,186,99,164,107,193,49,8,122,148,142,137,147,27,148,145,145,160,150,
+31,167,195,189,202,183,176,8,152,149,146,147,144,26,152,133,147,129,120,66,
+102,114,108,30,248,63,7,114,169,214,101,157,27,149,145,147,151,144,136,143,
+122,154,31,105,166,83,208,118,179,8,179,117,134,146,131,27,131,134,136,130,
+134,31,79,39,122,117,86,92,8,118,120,138,138,130,26,129,146,132,148,159,201,
+171,170,178,30,14,247,73,195,21,87,186,213,112,232,27,247,16,245,188,236,
+221,31,217,231,186,247,16,247,5,26,197,128,189,116,186,30,247,0,236,97,184,
+38,49,5,194,89,67,166,45,27,251,17,34,90,42,56,31,61,47,92,251,17,251,7,26,
+79,151,86,163,95,30,251,3,40,180,93,5,248,239,248,175,21,143,118,140,121,
+117,26,57,112,53,94,77,30,70,89,75,104,63,27,84,96,157,173,110,31,109,195,
+21,135,162,137,160,162,26,219,167,226,183,201,30,207,188,204,175,216,27,195,
+182,121,101,169,31,11,249,39,249,109,21,124,29,105,135,108,116,26,251,8,235,
+65,247,43,130,29,11,249,7,248,176,21,182,72,158,76,62,26,84,126,78,118,90,
+30,91,118,106,111,105,27,109,120,162,176,162,142,157,150,194,31,173,247,48,
+5,251,18,6,102,251,62,129,92,134,119,128,117,25,106,123,112,118,110,27,105,
+117,169,185,247,16,201,247,16,247,15,247,17,31,251,51,6,39,251,1,78,251,32,
+251,13,26,251,7,208,59,239,205,190,176,212,175,30,152,108,146,127,149,125,
+8,106,165,179,120,186,27,205,199,173,203,183,31,186,207,167,236,236,26,221,
+124,196,101,204,30,11,249,97,248,143,21,102,29,34,49,87,172,197,143,215,29,
+86,159,93,175,106,30,95,187,207,118,236,27,247,14,232,174,206,197,31,181,
+187,166,211,163,29,225,185,110,85,134,138,130,138,130,30,11,21,124,29,104,
+135,109,117,26,251,9,234,65,247,44,247,17,29,248,177,22,247,7,248,176,5,88,
+29,11,21,153,29,148,145,164,31,208,247,219,98,29,59,252,12,5,135,120,137,
+121,121,26,59,197,87,227,213,192,166,203,194,30,124,71,5,14,21,124,156,133,
+152,154,26,145,140,146,141,147,30,202,247,192,5,143,157,141,154,151,26,168,
+122,174,115,158,30,165,107,91,151,68,27,251,49,58,82,251,22,111,31,247,23,
+6,194,156,169,159,204,27,190,161,126,109,118,125,117,119,129,31,119,128,139,
+139,67,129,81,130,24,91,131,102,125,108,117,8,86,101,106,78,79,26,101,157,
+101,168,115,30,118,164,173,129,183,27,196,188,161,194,199,31,136,124,139,
+134,132,26,129,141,133,144,128,30,11,248,159,248,176,21,121,56,5,202,112,
+98,168,80,27,63,64,101,73,86,31,81,67,102,251,1,42,26,251,2,213,59,240,65,
+29,11,204,22,247,42,6,158,228,248,1,247,250,44,252,83,205,29,251,42,6,120,
+48,252,2,251,252,235,248,87,5,251,42,6,11,248,220,248,2,55,29,11,248,211,
+248,176,21,252,57,199,29,247,141,6,251,226,251,206,115,251,5,5,248,84,160,
+29,251,166,6,247,224,247,206,5,11,165,29,59,74,119,100,95,30,95,101,112,83,
+88,26,82,180,101,227,212,29,72,103,162,184,136,30,251,29,6,136,125,138,133,
+130,26,93,168,92,183,114,30,116,178,186,129,201,27,247,62,247,0,221,247,20,
+199,100,178,56,164,31,43,167,5,88,154,125,149,159,26,171,174,160,192,194,
+172,120,106,133,138,135,137,130,30,11,81,29,146,26,247,20,251,1,224,251,55,
+251,16,251,1,89,44,58,30,61,48,91,251,19,251,8,26,251,66,247,4,251,3,247,
+68,232,205,171,218,213,30,132,49,5,229,6,11,21,37,6,118,39,148,40,5,178,6,
+193,238,5,14,72,29,197,163,187,31,198,167,176,165,194,27,172,164,247,4,29,
+127,140,100,8,11,248,174,61,29,14,248,174,249,121,106,29,32,244,251,75,110,
+29,11,249,121,21,251,16,38,91,40,57,31,61,47,127,29,32,244,251,75,30,120,
+114,29,11,248,21,176,29,248,135,95,29,251,241,6,11,106,29,33,244,251,76,110,
+29,11,84,29,42,89,193,244,222,165,226,184,209,31,213,186,200,174,220,27,193,
+179,121,104,160,31,152,119,143,120,100,26,11,201,179,158,198,203,30,123,66,
+5,73,125,80,95,66,27,89,103,160,169,31,140,151,5,251,36,6,137,127,138,128,
+131,26,100,165,102,179,119,30,121,176,183,131,201,27,247,58,247,1,211,247,
+20,166,31,247,11,248,194,5,251,169,36,21,195,175,91,65,251,14,63,35,50,87,
+107,181,209,247,15,214,247,5,221,31,11,248,216,247,118,21,150,188,143,174,
+176,26,247,13,52,220,251,21,54,60,101,71,85,30,86,73,105,36,43,26,251,17,
+221,62,247,23,247,13,234,201,247,6,191,30,251,36,6,97,114,99,116,91,27,83,
+108,170,194,155,141,154,143,161,31,161,232,21,220,165,183,178,201,27,191,
+172,106,86,128,138,131,138,124,31,11,107,29,67,247,39,5,14,21,251,192,180,
+29,247,192,6,14,248,100,247,44,21,107,251,44,5,248,172,95,29,252,22,6,179,
+247,81,5,247,231,6,165,247,17,5,251,231,6,175,247,57,5,248,3,6,165,247,17,
+5,253,63,6,252,56,253,109,5,247,51,6,224,247,44,5,247,138,247,17,21,251,73,
+6,247,77,247,219,5,205,6,11,118,29,115,160,100,123,11,247,173,247,152,21,
+247,79,6,218,197,174,29,72,27,251,200,192,29,247,42,6,221,248,21,21,185,247,
+111,5,247,46,6,193,175,107,92,109,128,101,247,2,29,248,229,247,230,21,126,
+29,89,157,90,170,104,30,98,175,195,119,212,27,247,22,237,215,247,26,181,31,
+251,26,6,68,108,106,112,85,27,79,110,172,209,193,152,11,248,50,248,165,21,
+128,29,83,179,109,212,172,163,142,147,167,30,159,237,29,143,141,152,143,156,
+31,201,247,186,5,217,6,11,27,61,59,108,90,92,31,75,72,93,251,9,39,26,251,
+16,224,55,247,18,247,13,240,202,247,4,194,30,251,30,6,101,120,94,114,91,27,
+82,101,176,194,149,140,149,141,164,31,157,232,21,217,160,185,179,205,247,
+9,29,137,104,26,11,247,114,249,109,21,251,47,253,109,87,29,204,247,196,5,
+220,156,192,191,204,27,186,164,112,90,126,137,126,135,117,31,72,156,29,157,
+157,26,218,81,192,52,67,85,111,76,85,30,197,247,163,5,11,21,96,123,104,117,
+88,27,88,117,159,184,138,31,96,6,135,122,138,129,126,26,77,181,98,203,217,
+208,200,221,153,30,14,176,29,247,42,6,11,248,177,22,153,29,148,145,164,31,
+208,247,219,98,29,59,252,12,5,135,120,137,121,121,26,59,197,87,227,213,192,
+166,203,194,30,124,71,5,11,111,29,149,138,161,27,183,177,145,150,168,31,183,
+247,10,29,11,248,150,248,240,21,162,29,247,42,6,11,249,175,248,28,21,251,
+184,133,29,247,58,6,126,98,125,114,112,113,8,94,94,80,114,81,27,40,68,214,
+243,210,165,230,175,194,31,214,187,207,176,224,27,234,196,98,63,147,31,247,
+30,6,140,153,140,150,11,250,44,146,29,247,2,6,247,104,247,12,123,29,86,29,
+210,251,39,5,14,249,169,248,118,21,138,29,251,52,243,41,247,63,247,74,247,
+26,240,247,63,183,30,251,35,6,47,110,68,87,43,27,11,249,121,146,29,247,2,
+6,247,104,247,12,146,29,247,2,6,11,21,247,31,247,39,5,63,6,36,42,78,236,5,
+61,6,11,5,224,29,11,251,32,6,71,251,210,5,58,122,87,87,74,27,88,114,164,189,
+154,140,149,144,163,31,209,247,219,98,29,59,252,12,5,135,120,137,121,121,
+26,59,197,87,227,213,193,166,203,193,30,124,71,5,11,248,133,22,247,161,248,
+255,251,24,252,255,5,247,34,221,29,251,111,6,251,146,252,196,119,248,196,
+5,251,109,192,29,247,34,6,247,24,248,255,146,252,255,5,14,22,247,175,6,197,
+192,155,166,174,31,187,178,169,198,196,26,218,72,202,54,30,251,35,6,182,247,
+92,98,29,188,252,63,21,163,247,6,5,247,28,6,164,155,123,113,100,109,106,104,
+31,11,221,29,251,42,6,65,251,244,5,121,65,70,128,92,27,70,99,166,184,147,
+140,144,140,146,31,200,247,181,5,251,42,6,78,251,181,5,135,121,137,120,122,
+26,36,231,76,11,248,135,248,8,21,247,195,247,249,5,251,67,6,251,75,251,128,
+60,247,128,5,251,70,6,247,37,251,254,251,202,252,3,5,247,67,6,247,81,247,
+141,229,251,141,5,247,71,6,14,247,70,248,176,21,251,7,252,176,87,29,200,247,
+179,5,221,157,189,180,222,27,154,178,29,136,139,133,27,74,76,97,66,92,31,
+162,245,5,11,248,213,247,223,21,69,251,223,205,29,251,43,6,81,251,165,5,251,
+180,113,29,14,6,166,247,17,5,11,248,149,248,176,21,251,87,252,29,103,248,
+29,5,251,41,6,221,252,198,119,78,107,116,79,140,25,127,6,121,6,115,251,5,
+247,50,135,178,158,197,244,25,247,250,249,18,5,11,218,22,100,29,11,5,251,
+32,6,11,247,182,194,29,248,13,95,29,252,163,129,29,11,247,36,6,217,141,186,
+165,180,204,248,55,249,16,24,251,53,6,251,125,252,5,63,248,5,5,251,41,6,247,
+14,252,158,107,90,121,112,132,134,106,138,25,251,7,6,11,247,216,145,29,11,
+145,167,141,153,159,26,247,0,46,203,251,51,42,63,115,89,82,30,82,90,104,64,
+68,26,56,189,95,247,11,115,30,237,119,5,230,121,168,119,92,26,71,72,96,11,
+247,8,29,251,109,251,152,123,67,5,247,69,6,119,46,5,233,6,158,232,5,185,6,
+251,15,212,21,34,6,247,32,247,58,5,14,5,168,145,153,153,165,27,149,146,138,
+136,164,31,161,244,5,142,92,129,139,119,27,41,86,97,46,119,31,125,74,5,63,
+6,119,46,5,216,6,46,252,72,5,11,248,45,108,29,11,21,251,16,38,91,41,57,31,
+61,46,127,29,11,21,251,31,251,39,5,215,6,242,236,200,42,5,217,6,11,248,185,
+21,43,54,101,73,84,31,85,74,105,41,50,26,251,27,225,58,247,34,236,223,176,
+206,194,30,192,204,174,238,227,26,247,27,53,220,251,34,30,11,140,142,135,
+31,115,251,3,5,135,153,151,138,158,27,247,6,195,176,226,157,31,11,30,120,
+251,20,21,239,199,73,251,2,60,112,51,96,79,31,68,89,76,105,62,27,37,77,137,
+29,11,248,145,217,29,215,252,176,140,124,5,82,95,103,70,127,134,139,141,128,
+30,116,251,1,5,136,152,11,21,45,52,53,46,72,191,89,209,235,226,224,233,207,
+87,188,67,31,123,61,21,174,164,115,106,95,99,100,94,105,113,162,170,184,179,
+180,184,31,11,223,29,251,42,192,29,247,42,6,209,247,223,5,11,251,20,21,239,
+199,73,251,2,60,112,51,96,78,31,69,89,76,105,62,27,38,76,137,29,11,249,110,
+21,251,91,251,58,251,56,251,87,251,99,247,53,251,56,247,93,247,97,247,55,
+247,54,247,95,247,94,251,55,247,55,251,94,31,11,247,38,21,251,42,6,108,251,
+38,119,29,11,21,251,94,251,54,251,53,251,93,251,88,247,54,251,55,247,89,247,
+89,247,56,247,55,247,88,247,88,251,55,247,58,251,85,31,11,149,163,228,29,
+117,146,162,91,31,109,88,5,117,196,170,132,184,27,230,198,181,204,175,11,
+5,247,42,6,11,249,106,21,251,42,6,94,251,102,115,251,201,5,206,6,246,247,
+201,5,60,252,6,21,251,42,6,108,251,38,119,29,11,21,96,123,104,117,87,27,92,
+112,160,175,31,147,97,7,134,122,138,129,126,26,77,181,98,203,218,207,200,
+221,153,30,14,21,251,42,6,108,251,38,119,29,14,146,29,247,2,6,14,34,252,130,
+5,49,120,89,99,47,27,62,94,170,193,154,141,153,142,155,31,244,248,130,5,251,
+42,6,38,252,110,5,132,11,157,27,147,158,133,130,156,31,190,114,5,133,151,
+161,240,29,149,160,151,179,8,14,142,163,140,148,149,26,181,122,179,108,170,
+30,177,102,92,156,72,27,45,65,108,75,87,31,80,69,97,251,9,44,26,11,92,251,
+18,251,7,26,251,67,247,3,251,1,247,70,247,21,234,184,241,225,30,217,230,184,
+247,14,247,10,26,247,73,11,61,6,170,247,37,98,29,108,251,37,5,70,6,119,46,
+5,208,6,69,251,224,5,136,125,137,125,126,26,11,192,29,248,181,6,247,5,29,
+11,227,221,165,187,200,30,196,184,171,195,157,222,244,248,130,24,11,153,26,
+197,192,188,200,201,170,108,77,134,139,129,138,128,30,247,23,6,142,164,140,
+152,156,26,247,8,70,199,11,27,172,173,154,165,164,31,158,159,150,160,150,
+179,8,14,6,112,251,17,5,11,251,54,251,53,251,92,251,88,247,54,251,54,247,
+87,247,89,247,55,247,55,247,87,247,88,251,54,247,57,11,248,105,21,166,247,
+17,5,58,6,148,189,171,168,197,149,149,185,24,50,132,75,82,125,52,116,251,
+1,24,11,249,137,144,29,207,247,1,217,167,227,183,200,31,207,189,204,175,216,
+27,11,142,166,140,150,151,26,247,17,34,223,251,47,251,15,32,86,38,57,30,69,
+51,95,251,27,251,21,26,11,220,29,186,111,175,30,184,103,81,163,66,27,61,59,
+108,90,92,31,75,72,93,11,21,116,251,4,5,205,6,133,95,105,197,29,231,29,53,
+86,104,184,207,247,18,213,247,1,225,31,14,21,150,29,11,21,105,125,122,123,
+116,27,128,136,140,147,120,31,89,160,5,155,103,131,141,113,27,84,96,97,63,
+11,21,251,18,6,37,251,39,5,209,6,247,238,247,39,21,251,18,6,37,251,39,5,209,
+6,14,248,176,21,251,32,6,251,7,252,176,87,29,11,21,251,2,6,113,251,12,5,11,
+21,251,75,6,178,247,73,5,251,11,6,100,251,73,5,251,74,6,114,251,12,5,247,
+74,6,11,160,188,168,146,176,27,166,162,135,128,184,31,127,188,159,136,166,
+27,188,181,151,172,203,31,121,11,248,50,248,165,21,61,6,170,247,37,98,29,
+108,251,37,5,69,6,120,46,5,208,6,11,213,29,228,146,203,196,153,226,162,247,
+1,24,11,6,203,251,223,119,29,64,248,28,247,79,246,29,11,6,110,247,80,5,251,
+29,6,178,251,131,251,68,251,193,5,247,41,6,247,32,247,131,5,11,247,7,248,
+176,98,29,71,251,210,5,58,122,87,87,74,27,88,114,164,189,154,140,11,121,168,
+118,30,75,203,29,103,161,30,11,21,252,217,253,115,5,224,6,248,217,249,115,
+5,11,251,205,87,29,216,247,254,5,143,158,141,11,247,110,166,29,11,190,29,
+137,127,135,116,31,11,21,240,251,42,5,202,6,94,247,42,5,14,6,163,247,5,5,
+11,21,77,251,181,5,233,6,229,248,61,5,76,6,89,115,89,114,61,27,126,78,5,11,
+247,104,95,29,252,220,133,29,247,114,6,251,21,252,240,5,11,205,26,216,84,
+191,37,159,30,251,1,161,5,45,158,112,155,177,26,203,195,179,230,11,5,251,
+42,6,251,21,252,240,5,251,157,185,29,21,143,157,140,147,151,26,230,63,193,
+251,18,11,21,247,28,251,38,163,247,6,57,228,247,12,228,164,247,9,251,91,251,
+41,5,11,22,223,6,222,138,228,211,153,217,236,248,91,24,247,124,6,251,21,252,
+240,5,11,249,137,21,251,32,251,39,5,216,6,242,236,200,42,5,216,6,68,247,39,
+5,11,21,247,32,247,39,5,62,6,36,42,79,236,5,61,6,210,251,39,5,14,233,29,78,
+6,179,247,80,5,14,5,247,27,6,231,184,95,48,60,113,36,105,80,31,64,96,90,111,
+52,27,11,6,79,87,5,82,7,247,154,247,114,251,154,247,114,5,82,7,199,87,5,11,
+31,193,6,173,156,155,154,157,27,147,158,133,130,156,31,189,114,5,133,152,
+11,163,196,193,31,193,196,173,224,216,26,191,116,186,98,170,30,167,103,98,
+150,11,98,29,48,252,63,5,251,65,6,230,248,63,98,29,14,249,109,21,251,42,192,
+29,11,21,239,251,42,5,203,6,94,247,42,5,11,148,138,136,157,31,169,247,34,
+5,140,131,11,22,224,29,230,248,63,5,11,6,122,59,5,11,187,29,129,11,30,160,
+163,151,155,170,187,159,251,27,24,224,29,251,76,247,166,21,11,89,21,158,153,
+126,121,114,114,115,112,119,125,153,157,164,165,162,166,31,11,251,30,6,101,
+119,95,114,91,27,82,101,175,195,149,140,149,141,164,31,11,6,247,20,248,240,
+5,251,42,6,14,6,197,191,210,29,11,21,96,123,104,117,88,27,92,112,160,175,
+31,147,96,7,135,122,138,11,21,102,109,110,103,102,168,110,176,175,168,168,
+176,174,110,169,104,31,11,22,102,109,110,103,102,168,110,175,176,168,168,
+176,174,110,169,104,31,11,224,29,204,247,196,5,222,156,191,189,207,27,187,
+165,113,90,125,11,21,251,18,6,37,251,42,5,209,6,11,6,251,47,253,109,5,11,
+21,77,247,172,7,222,174,146,164,177,31,204,182,172,212,238,26,11,247,206,
+21,247,241,6,165,247,17,5,251,241,6,174,247,57,5,11,186,247,113,98,29,92,
+251,113,5,134,119,137,119,121,26,11,251,131,5,247,30,6,91,247,193,247,34,
+247,131,5,251,40,6,11,102,204,29,248,7,247,234,21,251,164,6,110,251,27,5,
+247,164,6,14,6,115,251,5,5,11,6,106,247,165,5,251,36,6,183,251,229,251,134,
+252,28,5,11,140,150,145,165,31,247,254,6,220,29,11,188,111,226,167,160,141,
+146,170,30,150,191,5,131,114,118,136,11,108,106,91,79,26,73,189,98,218,239,
+219,213,231,175,125,161,11,94,131,129,93,24,215,145,206,206,150,217,159,235,
+24,14,5,247,42,221,29,11,22,247,42,6,247,20,248,240,5,11,136,140,147,121,
+31,89,160,5,155,103,130,141,113,27,84,11,21,151,185,145,179,177,26,185,122,
+187,111,175,30,184,103,11,22,224,29,187,247,119,5,247,88,6,90,251,119,5,11,
+155,166,174,31,187,178,169,198,196,26,218,72,202,55,30,11,207,161,183,192,
+30,179,172,160,172,155,195,8,251,32,6,11,110,30,218,114,5,202,119,152,130,
+116,26,107,96,116,78,11,112,251,17,5,220,6,130,89,107,110,81,129,129,93,24,
+11,21,37,6,117,39,149,40,5,178,6,192,238,5,14,140,148,140,148,30,251,38,6,
+136,119,138,129,125,26,11,21,89,248,248,7,107,107,108,87,115,80,8,178,6,11,
+248,176,21,245,29,11,172,30,153,105,112,143,70,27,251,172,77,247,183,6,11,
+129,93,24,214,145,207,206,149,217,160,235,24,14,151,184,145,181,177,26,185,
+122,11,222,29,5,11,6,247,47,249,109,11,6,197,247,165,5,11,247,32,6,11,6,59,
+252,15,134,114,117,118,115,137,25,90,6,11,135,125,151,31,150,125,145,121,
+116,26,68,90,81,11,22,235,6,213,140,212,199,154,211,201,247,186,24,11,151,
+142,156,27,165,157,126,119,114,110,120,101,110,11,31,76,251,187,87,29,209,
+247,219,5,142,11,184,27,231,198,181,204,175,115,160,99,123,127,137,11,247,
+3,116,247,6,29,11,251,13,248,86,251,74,167,247,23,251,184,247,3,11,247,34,
+247,131,5,251,40,6,251,2,251,80,5,11,5,251,70,6,114,251,8,5,247,71,6,91,11,
+6,48,252,64,87,29,230,248,64,5,11,30,135,181,137,161,151,26,157,145,149,151,
+145,11,237,5,137,125,131,138,128,27,115,125,148,155,11,81,102,183,209,247,
+19,217,244,232,31,14,247,44,21,101,119,94,114,90,27,82,100,11,134,155,27,
+172,173,154,165,165,31,158,159,11,140,148,120,31,89,160,5,153,107,125,142,
+11,21,100,102,103,100,111,160,118,168,178,176,11,21,251,30,6,111,251,22,152,
+251,21,5,11,21,251,3,6,114,251,12,5,247,2,6,11,251,87,252,29,103,248,29,5,
+251,46,6,11,247,229,5,251,52,6,251,41,251,165,5,11,85,87,82,98,169,109,181,
+197,193,191,196,11,243,21,252,125,6,117,35,5,248,125,6,11,125,118,31,104,
+114,105,123,86,27,14,89,107,100,118,58,8,247,198,6,14,127,118,152,31,147,
+124,141,11,166,247,17,5,252,31,6,11,21,193,173,95,69,251,18,65,251,0,11,21,
+251,19,6,38,251,42,5,209,6,11,21,93,6,194,247,151,5,251,0,6,11,27,186,172,
+111,96,144,31,141,129,139,11,156,161,161,175,204,247,250,249,18,24,11,251,
+17,24,247,204,95,29,11,250,60,21,251,19,6,38,251,42,5,11,110,85,134,138,130,
+138,130,30,14,54,5,149,163,151,142,156,27,165,157,126,119,114,11,145,29,14,
+137,29,14,130,29,14,248,220,248,2,165,29,11,249,137,107,29,11,249,169,86,
+29,11,249,109,21,213,29,11,231,247,17,21,213,29,11,111,175,30,184,103,81,
+163,66,27,61,59,108,90,92,31,75,72,93,251,9,11,165,226,184,209,31,213,186,
+200,174,220,27,193,179,121,104,160,31,152,119,143,120,100,26,247,33,6,142,
+11,127,29,32,244,251,75,30,120,251,20,21,239,199,73,251,2,60,112,51,96,11,
+1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,1,135,255,2,135,254,2,243,2,0,1,0,2,
+0,3,0,10,0,25,0,108,1,18,1,49,1,184,1,200,1,249,2,48,2,90,2,112,2,116,2,120,
+2,125,2,143,2,231,3,4,3,86,3,212,4,7,4,94,4,195,4,240,5,101,5,202,5,214,5,
+225,5,244,6,1,6,12,6,99,7,54,7,58,7,61,7,65,7,69,7,73,7,99,7,104,7,107,7,
+110,7,114,7,117,7,121,7,125,7,129,7,133,7,136,7,237,7,241,7,245,7,249,7,253,
+8,25,8,30,8,33,8,37,8,41,8,73,8,89,8,121,8,151,8,157,8,162,8,166,8,235,8,
+239,8,245,8,249,9,2,9,6,9,10,9,17,9,36,9,40,9,43,9,135,9,139,9,143,9,175,
+9,248,9,253,10,9,10,14,10,18,10,46,10,51,10,100,10,104,10,109,10,228,10,244,
+11,107,11,170,11,205,12,63,12,160,12,165,12,242,13,83,14,6,14,109,14,124,
+14,136,14,148,14,155,14,162,14,175,14,194,14,210,15,1,15,54,15,56,15,110,
+15,135,15,149,15,159,15,170,15,182,15,197,16,13,16,102,16,109,16,116,16,124,
+16,132,16,140,16,148,16,156,16,163,16,172,16,198,16,204,17,3,17,11,17,15,
+17,20,17,166,17,208,17,213,18,60,18,126,18,131,18,134,18,167,18,171,19,12,
+19,116,19,123,19,148,19,237,20,52,20,55,20,116,20,152,20,199,20,216,20,244,
+21,15,21,60,21,88,21,138,21,190,22,76,22,80,22,220,23,6,23,13,23,121,23,130,
+23,138,23,147,23,155,23,164,23,192,24,27,24,36,24,45,24,55,24,64,24,70,24,
+77,24,82,24,94,24,121,24,131,24,148,24,159,24,172,24,200,24,217,24,229,24,
+244,24,253,25,10,25,17,25,23,25,50,25,60,25,75,25,85,25,95,25,104,25,113,
+25,189,25,200,25,210,25,220,25,231,25,238,25,245,25,251,26,1,26,10,26,19,
+26,35,26,45,26,61,26,126,26,144,26,158,26,168,26,178,26,190,26,198,26,207,
+26,217,27,26,27,39,27,58,27,83,27,102,27,161,28,4,28,56,28,132,28,140,28,
+213,29,34,29,71,29,161,29,246,30,41,30,53,30,96,30,113,30,121,30,228,30,237,
+30,240,30,249,31,2,31,40,31,55,31,173,31,181,31,190,31,199,31,209,31,217,
+31,236,31,245,31,253,32,5,32,63,32,72,32,82,32,91,32,99,32,112,32,121,32,
+140,32,149,32,158,32,165,32,173,32,242,33,2,33,12,33,21,33,36,33,78,33,84,
+33,91,33,99,33,107,33,117,33,126,33,135,33,148,33,156,33,240,33,249,34,7,
+34,34,34,44,34,53,34,99,34,108,34,134,34,146,34,163,34,219,34,227,34,235,
+35,54,35,71,35,207,35,213,35,223,35,232,35,240,36,4,36,14,36,23,36,32,36,
+102,36,116,36,136,36,143,36,152,36,161,36,247,37,36,37,45,37,53,37,62,37,
+71,37,79,37,88,37,96,37,104,37,119,37,134,37,148,37,155,37,176,37,185,37,
+219,37,228,37,245,38,36,38,72,38,120,38,153,39,13,39,251,40,121,40,194,40,
+196,40,198,40,202,40,206,41,90,41,131,41,136,41,144,41,157,41,163,41,171,
+41,231,41,243,41,252,42,4,42,57,42,66,42,85,42,103,42,116,42,167,42,223,42,
+232,42,245,42,254,43,8,43,95,43,143,43,177,43,247,44,5,44,35,44,54,44,63,
+44,79,44,88,44,97,44,107,44,116,44,124,44,134,44,137,44,138,44,248,45,67,
+45,137,45,184,46,53,46,145,47,38,47,103,47,185,48,90,48,123,48,190,49,16,
+49,29,49,41,49,64,49,80,49,151,49,221,50,99,50,168,50,240,50,248,51,9,51,
+51,51,68,51,108,51,147,51,200,51,254,52,39,52,201,52,227,53,189,54,183,54,
+214,54,239,55,23,55,64,55,128,55,146,55,177,55,237,56,33,56,56,56,161,56,
+185,56,203,56,227,57,40,57,109,57,153,57,174,58,38,58,141,58,218,59,15,59,
+56,59,109,59,241,60,99,60,199,61,101,61,177,61,201,61,217,61,244,62,16,62,
+59,62,159,62,182,62,205,62,236,62,249,63,1,63,108,63,139,63,153,63,179,63,
+193,63,200,63,220,64,1,64,100,64,149,64,204,65,54,65,70,65,86,65,111,65,115,
+65,118,65,130,65,157,65,161,65,165,65,168,65,239,65,242,65,245,66,14,66,18,
+66,22,66,55,66,59,66,79,66,82,66,124,66,128,66,132,66,248,66,251,67,98,67,
+105,67,177,68,41,68,75,68,168,69,7,69,110,69,114,69,222,69,225,70,5,70,33,
+70,95,70,123,71,11,71,15,71,34,71,116,71,198,71,221,71,225,72,83,72,132,72,
+229,72,234,73,86,73,217,74,97,74,228,74,235,74,244,74,252,75,2,75,11,75,42,
+75,79,75,90,75,102,75,114,75,147,75,154,75,162,75,244,76,91,76,98,76,106,
+76,115,76,123,76,144,76,149,76,158,76,204,77,8,77,95,77,107,77,173,77,177,
+77,218,77,250,77,254,78,14,78,39,78,77,78,103,78,112,78,136,78,199,79,38,
+79,62,79,66,79,162,79,169,79,192,79,209,79,238,80,24,80,29,80,48,80,85,80,
+182,80,250,81,83,81,112,81,214,82,56,82,181,82,186,82,191,82,196,83,9,83,
+58,83,109,83,186,83,207,83,251,84,58,84,62,84,159,84,211,85,81,85,125,85,
+180,85,190,85,250,86,21,86,28,86,59,86,119,86,128,86,144,86,179,86,222,86,
+255,87,17,87,93,87,147,87,156,87,170,87,229,88,73,88,126,88,174,88,199,89,
+8,89,37,89,193,90,43,90,129,90,142,90,202,90,206,90,237,91,7,91,11,91,31,
+91,49,91,99,91,110,91,135,91,152,91,200,92,36,92,54,92,58,92,190,92,199,92,
+217,92,240,93,21,93,37,93,42,93,133,93,205,94,25,94,59,94,157,94,254,95,114,
+95,121,95,170,95,217,95,245,96,58,96,82,96,127,96,143,96,156,96,202,96,224,
+97,50,97,97,97,141,97,181,97,189,97,237,98,8,98,15,98,55,98,105,98,114,98,
+132,98,189,98,218,98,239,99,3,99,79,99,134,99,145,99,155,99,231,100,70,100,
+124,100,196,100,236,101,24,101,52,101,137,101,249,102,187,103,8,103,162,104,
+126,104,235,105,163,106,124,106,217,107,35,107,132,107,167,107,199,107,234,
+108,12,108,84,108,156,109,10,109,84,109,127,109,139,109,164,109,192,109,221,
+110,151,110,186,110,201,111,10,111,61,111,110,111,194,111,251,112,58,112,
+124,112,142,112,162,112,180,112,221,113,15,113,64,113,113,113,163,113,190,
+113,217,113,245,114,17,114,38,114,77,114,123,114,151,114,178,14,14,251,209,
+248,53,120,29,14,251,68,247,235,249,109,192,10,247,156,247,22,192,10,14,45,
+247,30,107,21,223,247,96,5,241,6,56,251,96,5,244,6,223,247,96,5,247,11,6,
+160,239,5,40,6,201,247,44,5,245,6,160,239,5,52,239,10,36,239,10,251,10,6,
+117,39,5,238,6,77,251,44,5,42,6,118,39,5,216,6,56,251,96,5,247,121,247,196,
+21,202,247,44,5,241,6,77,251,44,5,14,45,249,3,248,134,21,143,160,140,151,
+155,26,190,121,182,107,167,30,112,162,105,151,83,144,151,193,24,71,6,128,
+85,87,134,104,129,101,119,25,61,99,90,61,58,26,48,193,82,247,3,111,30,93,
+251,105,5,95,148,118,167,190,26,150,139,147,140,153,30,251,22,6,133,115,137,
+123,120,26,42,203,79,247,8,127,30,116,34,5,207,6,161,244,195,145,183,152,
+178,160,25,215,181,191,227,227,26,220,86,190,251,15,177,30,182,247,93,5,175,
+133,161,113,101,26,127,138,130,137,120,30,251,53,68,21,97,155,119,164,172,
+26,173,158,174,167,158,30,153,149,153,143,164,144,8,138,251,218,21,178,123,
+159,111,99,26,83,102,98,75,124,30,14,247,131,249,136,249,89,21,252,186,253,
+109,5,215,6,248,187,249,109,5,252,117,131,102,10,248,55,251,151,102,10,14,
+211,248,243,248,9,21,128,82,124,109,105,108,57,247,29,24,193,171,169,161,
+161,164,8,172,176,159,190,186,26,209,77,186,48,251,12,34,46,32,108,156,100,
+175,87,30,89,116,116,127,108,117,8,70,92,102,73,64,26,251,5,212,73,247,17,
+216,181,155,206,232,30,176,79,5,247,52,6,45,247,52,198,192,187,226,150,212,
+25,252,9,85,21,238,251,59,5,93,72,109,126,105,27,90,99,181,191,185,158,168,
+189,167,31,247,16,247,72,21,107,194,135,148,157,26,176,166,165,177,171,158,
+124,113,98,111,103,87,112,30,14,247,112,247,21,29,233,146,201,195,151,227,
+162,247,1,24,14,251,209,247,250,199,10,251,83,251,112,56,251,76,251,95,26,
+41,164,33,191,251,10,30,239,6,95,247,37,125,214,231,26,247,25,176,247,24,
+214,247,28,30,174,203,176,194,210,236,8,14,251,209,218,251,92,21,196,205,
+193,209,175,194,8,224,247,24,184,247,37,247,30,26,238,114,241,84,247,14,30,
+39,6,186,251,40,153,68,45,26,251,24,102,251,24,63,251,28,30,103,75,107,91,
+62,35,8,14,251,153,247,138,248,180,21,52,45,188,96,226,233,186,45,206,182,
+92,233,247,8,174,132,209,251,9,103,164,247,8,5,67,6,115,251,8,38,175,102,
+70,5,14,73,248,232,247,184,147,29,100,251,74,5,247,11,6,178,247,74,5,247,
+75,6,14,234,128,10,14,251,209,198,29,247,137,116,29,14,247,252,249,94,21,
+251,253,253,108,5,206,6,247,253,249,108,5,14,45,248,57,249,104,21,251,5,47,
+74,251,10,84,31,97,47,101,251,63,37,26,251,16,211,64,247,10,247,8,231,203,
+247,11,194,30,181,230,177,247,65,241,26,247,16,67,213,251,13,30,112,251,4,
+21,186,169,106,88,77,116,251,26,112,44,31,40,111,105,100,80,27,93,109,172,
+190,236,188,247,114,172,192,31,177,163,168,158,174,27,14,45,247,234,248,125,
+21,35,252,125,87,29,247,43,249,89,5,46,6,55,99,57,96,251,14,27,119,46,5,14,
+45,248,174,247,17,21,251,192,6,164,176,169,161,247,10,214,222,191,176,168,
+171,177,8,181,189,162,200,202,26,247,0,62,203,251,22,251,48,38,45,251,60,
+113,30,247,26,6,236,152,184,192,209,27,192,171,109,89,92,119,93,105,104,31,
+108,106,107,117,251,7,67,251,31,56,90,77,104,251,24,8,248,118,6,14,45,247,
+176,247,209,21,193,142,139,132,163,31,175,128,160,111,99,26,113,131,112,125,
+117,30,101,114,106,120,97,27,82,107,167,188,138,31,161,7,138,149,5,251,28,
+6,135,117,137,123,120,26,251,2,214,75,247,22,237,218,172,201,190,30,179,189,
+164,210,203,26,193,117,178,89,169,30,219,188,179,204,218,26,235,66,194,251,
+19,53,70,113,88,93,30,102,99,121,96,124,61,8,247,21,6,148,178,145,158,149,
+156,8,172,158,172,157,179,27,185,170,111,97,59,80,88,48,31,128,6,14,45,248,
+216,247,165,21,65,6,232,248,72,5,251,57,6,251,244,252,70,114,251,10,5,247,
+177,6,105,251,49,87,29,173,247,49,5,212,6,251,81,247,8,21,251,76,6,247,141,
+247,196,5,14,45,249,21,249,89,21,252,19,6,251,38,252,31,5,247,18,6,173,162,
+174,158,182,27,197,171,107,80,38,79,63,58,85,105,164,177,145,140,147,140,
+148,31,251,30,6,135,119,138,129,125,26,40,218,74,247,13,240,227,183,219,198,
+30,180,196,163,211,209,26,247,3,72,207,251,0,90,102,127,108,92,30,193,247,
+40,5,247,188,6,14,45,249,4,248,184,21,140,148,139,148,144,26,234,71,197,251,
+6,32,53,85,33,74,30,86,52,92,251,76,251,14,26,251,11,217,64,247,13,226,218,
+179,210,192,30,185,200,167,218,211,26,243,76,202,34,86,93,122,100,89,30,156,
+201,141,146,152,171,8,209,167,176,169,196,27,187,162,121,93,148,31,251,34,
+251,85,21,189,171,105,87,46,79,62,66,88,104,176,191,229,202,216,213,31,14,
+45,249,59,249,89,21,252,137,133,29,247,245,6,251,87,251,80,41,251,46,59,251,
+134,8,247,34,6,192,247,83,217,247,29,247,39,247,55,201,203,174,175,147,147,
+8,14,45,248,127,248,22,21,173,159,158,152,155,156,8,177,176,161,188,187,26,
+230,58,202,251,9,251,37,251,13,35,251,17,95,157,110,186,103,30,89,114,112,
+120,114,110,8,102,95,117,80,84,26,251,1,222,70,247,25,222,215,168,191,193,
+30,192,191,172,214,207,26,199,116,175,78,176,30,46,247,118,21,194,176,110,
+96,75,83,88,68,87,106,168,185,202,191,188,207,31,83,251,174,21,194,174,107,
+88,53,83,77,60,84,100,173,186,223,200,205,217,31,14,45,211,247,57,21,136,
+124,138,131,129,26,47,212,76,246,247,2,228,193,243,199,30,201,245,181,247,
+49,247,13,26,247,17,61,219,251,12,251,56,251,21,251,33,251,72,251,1,203,73,
+244,195,174,154,187,195,30,128,91,128,106,127,111,8,86,115,96,109,89,27,92,
+107,161,171,142,139,143,140,144,31,247,74,248,83,21,195,175,103,82,42,75,
+61,59,90,108,173,192,240,197,219,213,31,14,251,209,247,186,116,29,247,3,248,
+156,122,29,251,209,247,36,128,10,219,248,10,122,29,73,249,10,248,110,21,252,
+163,251,73,113,232,29,247,232,247,5,5,14,73,249,2,248,48,242,10,113,251,12,
+242,10,14,73,177,129,180,10,251,232,251,5,5,14,100,248,50,247,93,21,153,205,
+148,150,207,181,198,175,176,169,160,166,8,169,178,159,199,193,26,192,116,
+189,99,170,30,168,104,86,154,75,27,53,69,109,82,86,31,100,96,117,90,120,55,
+8,247,28,6,227,156,188,190,207,27,193,176,103,88,118,133,119,129,120,31,124,
+113,129,130,83,100,45,73,100,83,132,63,8,247,18,84,122,29,247,217,249,130,
+248,144,21,112,80,5,189,119,112,158,90,27,59,52,92,58,70,31,83,73,105,64,
+79,26,59,195,83,220,194,193,164,187,189,30,93,154,176,115,195,27,221,225,
+189,226,210,31,197,210,169,223,230,26,205,117,198,94,193,30,224,70,41,181,
+251,20,27,251,56,251,49,71,251,12,251,6,31,37,32,79,251,31,251,22,26,54,173,
+58,199,82,30,74,208,230,109,247,18,27,235,213,153,170,216,31,127,218,5,108,
+44,85,129,76,27,251,70,251,17,242,247,39,229,175,242,202,225,31,247,13,227,
+247,22,205,247,44,27,243,210,111,76,198,31,181,94,160,90,87,26,77,114,69,
+95,83,30,81,94,80,99,97,27,115,124,152,161,154,141,145,156,172,31,247,28,
+247,172,5,251,126,77,21,179,137,164,111,99,26,98,115,81,100,89,30,81,95,88,
+106,94,27,99,112,171,186,242,247,11,247,25,225,134,31,14,211,32,10,14,211,
+56,10,211,64,29,14,211,81,10,14,156,33,10,14,100,247,183,247,206,21,247,211,
+95,29,251,212,6,174,247,57,5,247,254,95,29,252,148,130,10,14,247,20,55,10,
+14,211,94,29,51,10,14,45,75,10,14,211,93,10,100,62,29,14,247,75,89,29,211,
+41,29,14,247,20,59,29,156,71,29,247,20,249,66,242,21,224,221,199,247,37,247,
+15,26,247,72,251,2,247,0,251,75,251,16,40,92,39,55,30,63,49,93,251,18,251,
+8,26,251,67,247,3,251,2,247,69,211,197,154,174,200,30,208,58,232,220,5,251,
+103,247,143,21,45,58,201,66,5,127,113,108,132,107,27,40,78,206,247,2,218,
+166,225,183,200,31,209,189,202,174,215,27,242,200,73,251,3,57,107,43,93,81,
+31,14,211,33,29,14,156,45,10,14,100,80,29,14,211,44,29,14,156,248,36,22,248,
+38,249,109,5,251,43,6,251,168,252,185,94,248,185,5,251,43,6,233,253,109,5,
+14,247,186,37,10,14,156,92,29,156,40,29,14,100,53,10,14,251,209,248,99,199,
+10,251,135,6,251,89,254,53,5,247,135,6,160,239,5,251,5,6,247,46,249,109,5,
+247,5,6,14,247,30,249,89,21,211,253,112,5,214,6,66,249,112,5,14,251,209,114,
+251,92,21,247,135,6,247,89,250,53,5,251,135,6,118,39,5,247,5,6,251,46,253,
+109,5,251,5,6,14,73,248,216,247,162,21,58,248,61,5,251,17,6,251,147,252,61,
+5,247,4,6,247,70,247,192,197,251,192,5,14,45,248,186,63,170,10,247,194,135,
+29,14,45,32,29,14,100,247,106,199,10,251,47,253,109,87,29,151,194,5,85,162,
+180,115,207,27,247,47,247,34,247,67,247,82,247,17,70,221,33,71,87,114,85,
+93,31,194,247,151,5,194,251,184,21,194,172,94,66,251,14,64,251,0,53,86,104,
+184,207,247,18,214,247,1,225,31,14,45,58,29,14,100,248,41,72,10,14,45,57,
+10,14,251,209,248,61,248,165,247,25,10,100,50,10,14,100,75,29,14,247,214,
+248,176,89,10,14,248,1,199,10,251,32,133,29,224,29,126,75,208,10,125,132,
+109,29,14,45,98,10,14,101,10,14,247,131,247,67,178,10,208,247,216,5,209,154,
+184,182,197,27,178,163,116,104,127,138,129,137,128,31,65,251,238,87,29,208,
+247,216,5,211,154,184,180,202,27,177,159,119,103,127,137,124,136,125,31,67,
+251,232,87,29,216,247,254,5,145,169,141,151,158,26,219,87,185,49,71,85,114,
+82,84,30,189,125,91,171,77,27,73,93,115,73,80,31,156,220,5,14,100,35,29,14,
+100,34,10,14,100,247,204,248,176,223,10,251,53,253,138,171,10,247,92,247,
+19,72,219,32,72,84,110,79,93,31,231,29,52,87,238,10,100,248,155,206,10,122,
+59,5,199,119,95,168,70,27,56,59,95,64,85,31,89,68,109,47,53,26,251,16,209,
+59,246,206,195,168,197,185,30,79,251,174,87,29,247,53,249,138,5,251,174,36,
+21,193,174,95,70,251,19,65,251,0,51,85,104,184,207,247,17,215,247,2,225,31,
+14,251,153,93,29,14,45,248,220,248,2,21,80,10,94,94,10,14,251,209,73,29,14,
+100,48,29,14,45,247,242,22,247,193,248,176,5,251,40,6,251,88,252,31,109,248,
+31,5,251,40,6,213,252,176,5,14,247,20,38,29,14,45,248,47,247,166,21,247,129,
+247,158,5,251,60,6,251,15,251,55,88,247,55,5,251,60,6,247,3,251,158,251,125,
+251,166,5,247,60,6,247,15,247,60,198,251,60,5,247,60,6,14,45,49,10,14,251,
+42,54,29,14,251,153,248,108,199,10,63,6,58,137,84,89,122,51,94,251,103,24,
+97,131,113,118,95,27,127,6,135,6,119,47,143,138,5,152,6,173,159,125,115,133,
+137,126,136,124,31,94,251,102,5,136,126,138,126,125,26,79,178,99,197,30,216,
+6,160,238,5,104,6,114,125,148,155,149,141,152,142,156,31,181,247,87,5,142,
+154,141,155,149,26,166,126,160,118,148,30,127,145,131,141,114,143,212,147,
+171,168,155,211,180,247,87,24,147,184,150,150,177,140,8,176,6,14,252,6,247,
+227,199,10,59,6,251,90,254,53,5,219,6,14,251,153,168,251,92,21,216,6,220,
+141,194,189,156,227,184,247,103,24,181,147,165,160,183,27,152,6,143,6,159,
+231,135,140,5,125,6,105,119,153,163,145,141,152,142,154,31,184,247,102,5,
+142,152,140,152,153,26,199,100,179,81,30,61,6,118,40,5,175,6,164,153,130,
+123,129,137,126,136,122,31,97,251,87,5,136,124,137,123,129,26,112,152,118,
+160,130,30,151,133,147,137,164,135,66,131,107,110,123,67,98,251,87,24,131,
+94,128,128,101,138,8,101,6,14,73,248,140,248,47,21,88,125,124,124,101,27,
+117,126,145,158,118,31,90,181,5,156,119,115,147,107,27,58,87,91,42,113,31,
+217,6,189,153,154,154,177,27,160,154,133,121,159,31,187,97,5,121,160,162,
+131,172,27,219,194,190,234,162,31,14,251,209,165,251,78,21,247,42,6,184,247,
+102,163,247,201,5,72,6,32,251,201,5,218,248,6,21,247,42,6,170,247,38,146,
+10,14,45,248,46,248,71,21,177,127,151,114,79,26,247,26,6,142,163,140,148,
+149,26,205,95,201,74,165,30,123,145,124,142,115,142,158,226,24,73,6,120,53,
+51,132,71,101,90,69,25,89,68,105,33,55,26,59,183,68,207,113,30,155,132,156,
+135,163,135,117,35,24,205,6,160,241,247,9,145,235,220,175,247,14,25,251,26,
+6,115,80,113,110,98,129,8,74,143,21,102,155,126,166,194,26,211,163,220,175,
+188,30,154,160,160,153,165,146,8,14,45,248,91,248,7,21,251,31,6,136,154,135,
+155,130,173,8,129,176,137,148,131,29,251,27,58,71,114,91,87,30,90,94,109,
+77,82,26,111,143,122,161,77,30,79,6,127,84,5,228,6,143,111,140,127,124,26,
+69,99,89,35,78,30,172,38,5,148,29,247,1,5,118,94,106,131,211,10,127,135,110,
+74,31,247,3,217,179,193,212,26,146,139,145,137,151,30,247,14,6,14,248,95,
+86,10,14,45,248,210,247,244,21,251,31,6,247,159,247,244,5,251,28,6,251,79,
+251,146,54,247,146,5,251,31,6,247,20,251,244,98,29,127,79,5,247,38,6,128,
+87,5,251,38,6,126,79,5,247,38,6,101,251,72,87,29,177,247,72,5,247,36,6,152,
+199,5,251,36,6,150,191,5,247,36,6,14,45,248,239,248,119,21,251,15,6,154,180,
+5,210,167,171,173,178,27,156,149,136,126,164,31,183,247,6,5,152,99,119,143,
+107,27,34,68,76,251,31,85,31,116,80,5,251,30,6,118,39,5,247,15,6,251,31,252,
+12,5,56,108,116,111,103,27,123,120,147,152,122,31,90,251,7,5,123,169,163,
+133,171,27,247,3,212,206,247,46,195,31,247,32,248,18,5,247,29,6,14,45,248,
+225,248,180,21,144,164,141,150,153,26,220,75,187,32,65,75,116,98,95,30,98,
+102,115,88,92,26,99,151,110,165,112,30,87,106,124,127,118,115,8,113,109,126,
+101,95,26,100,159,103,173,116,30,247,42,39,5,189,108,144,133,112,26,97,100,
+107,88,97,116,158,175,149,140,146,141,156,30,251,23,6,132,113,137,125,120,
+26,52,207,84,247,0,227,211,170,198,189,30,173,180,159,189,186,26,181,124,
+169,106,166,30,231,173,177,190,230,26,187,118,174,91,169,30,251,4,209,5,88,
+170,119,160,161,26,175,171,165,182,179,161,118,101,135,139,132,138,132,30,
+251,96,251,189,21,110,156,129,154,161,26,174,157,165,177,159,30,247,19,63,
+5,174,118,150,125,115,26,106,121,117,92,117,30,14,45,248,137,248,164,21,157,
+114,102,151,104,27,99,96,127,120,104,31,78,216,56,71,201,60,5,104,97,119,
+84,88,26,117,142,122,147,115,30,45,62,193,70,233,217,5,121,160,183,126,177,
+27,176,162,145,163,187,31,198,64,222,207,79,215,5,175,185,159,193,190,26,
+159,136,155,132,163,30,230,214,85,208,5,251,105,251,33,21,190,174,104,89,
+66,83,82,67,88,104,173,190,213,195,195,211,31,14,252,48,247,235,249,109,243,
+29,194,6,209,247,21,5,14,251,42,247,198,135,29,247,254,22,148,10,14,45,247,
+27,157,29,247,81,251,6,166,29,14,251,209,247,20,157,29,14,251,209,247,211,
+156,10,14,100,248,61,248,165,36,29,247,142,243,89,10,14,100,248,61,248,165,
+36,29,247,182,247,185,21,251,32,192,29,224,29,14,45,249,4,247,203,21,252,
+203,6,117,35,5,248,203,6,14,45,249,6,248,121,21,251,71,6,186,247,116,5,251,
+25,6,91,251,116,5,251,71,6,114,251,8,5,247,71,6,251,11,252,199,5,247,26,6,
+247,11,248,199,5,247,71,6,14,45,249,3,248,121,21,251,71,6,187,247,116,5,251,
+26,6,91,251,116,234,29,251,115,234,29,251,116,5,247,26,6,187,247,116,5,247,
+70,6,164,247,8,5,251,71,6,187,247,115,5,247,70,6,14,121,10,45,249,64,199,
+10,251,194,6,74,83,113,85,88,31,82,78,107,63,62,26,41,202,74,239,134,30,42,
+252,94,5,237,6,247,72,249,227,5,201,6,251,72,253,227,5,237,6,247,72,249,227,
+5,183,6,14,251,192,247,150,248,61,21,61,70,70,62,79,184,95,200,217,211,209,
+215,198,92,184,77,31,14,247,22,29,233,146,201,195,151,227,162,247,1,24,14,
+251,42,231,247,17,142,29,239,135,10,251,42,247,120,249,109,142,29,236,135,
+10,45,247,218,156,10,247,123,247,7,166,10,14,247,242,247,165,116,29,248,0,
+116,29,248,0,116,29,14,247,242,249,34,249,118,21,252,218,253,139,5,205,6,
+248,219,249,139,5,252,41,140,21,44,52,53,46,72,191,89,210,235,226,224,233,
+207,87,188,67,31,122,61,21,174,165,115,107,94,99,100,94,104,113,162,170,184,
+180,180,183,31,247,121,252,21,112,29,248,21,217,112,29,14,100,247,202,247,
+231,21,125,73,130,127,71,98,67,95,103,107,117,103,8,116,100,125,88,95,26,
+251,2,222,71,247,24,225,209,168,197,192,30,178,182,161,188,158,223,8,251,
+28,6,52,123,89,87,72,27,85,101,175,190,159,145,160,149,158,31,154,165,150,
+149,194,177,233,205,178,194,146,216,8,251,18,194,21,247,42,6,170,247,38,146,
+10,14,251,209,247,67,155,10,14,251,209,248,111,125,10,14,251,209,247,166,
+249,137,67,10,251,209,248,82,249,124,42,10,251,209,248,103,249,102,68,29,
+251,209,248,49,249,134,76,10,251,209,248,13,249,121,123,29,251,209,247,175,
+85,29,14,251,209,247,218,249,153,69,10,14,251,209,247,46,22,71,33,234,10,
+109,120,101,111,109,10,99,124,127,137,135,123,31,180,201,5,14,251,209,247,
+202,136,29,251,209,247,66,22,98,122,120,130,115,122,8,97,110,114,96,97,26,
+92,190,110,222,165,158,141,146,171,30,149,191,5,131,118,116,136,112,27,106,
+122,152,166,162,150,164,162,168,31,158,163,145,143,205,177,8,14,251,209,247,
+238,248,246,83,29,247,242,203,10,247,242,69,29,14,251,172,248,32,247,234,
+21,251,175,180,29,247,176,6,179,247,39,21,130,150,136,146,148,26,144,139,
+143,140,143,30,178,247,72,5,141,150,140,148,147,26,184,97,166,67,48,86,102,
+64,122,30,218,6,171,149,157,151,178,27,170,152,131,122,126,131,126,127,133,
+31,126,133,139,139,96,133,105,133,24,65,128,91,90,76,26,91,171,109,190,179,
+170,152,172,175,30,137,129,139,137,135,26,133,140,135,142,133,30,231,6,65,
+247,22,21,91,129,109,111,98,27,112,124,149,159,167,161,159,177,145,31,169,
+145,149,140,5,140,145,143,140,141,27,146,141,141,140,146,142,8,14,100,247,
+230,248,57,21,204,247,200,146,10,60,252,9,39,78,119,45,239,200,83,251,154,
+5,248,135,95,29,251,241,6,182,247,94,247,79,247,2,159,233,5,14,247,20,43,
+29,14,247,242,249,72,247,206,21,247,190,95,29,251,190,6,174,247,57,5,247,
+218,95,29,252,107,6,128,87,5,185,102,99,157,73,27,45,54,98,58,65,31,56,47,
+83,251,41,251,25,26,251,53,233,32,247,34,206,183,161,199,195,30,127,80,5,
+248,126,160,10,251,237,6,251,31,192,21,87,100,102,118,85,27,48,86,201,246,
+209,158,214,174,202,31,226,186,203,183,217,27,195,172,117,88,158,31,14,251,
+177,248,46,247,234,21,251,193,180,29,247,193,6,85,248,103,21,251,6,54,44,
+251,20,65,189,93,218,203,192,164,188,176,31,168,176,158,199,192,26,213,90,
+184,56,30,125,71,21,175,162,112,95,62,94,75,85,104,116,167,182,216,183,203,
+193,31,14,247,131,36,10,14,43,10,14,247,188,248,71,21,202,247,186,98,29,63,
+251,245,63,92,122,56,215,187,77,251,186,87,29,214,247,245,215,184,156,221,
+5,14,100,47,10,14,247,186,249,189,239,29,174,189,154,201,29,186,111,175,30,
+184,103,82,163,69,27,63,66,112,94,93,31,185,105,72,165,60,27,37,49,95,60,
+79,31,91,75,107,40,52,26,251,15,222,63,247,26,220,216,166,185,191,30,95,167,
+205,110,213,27,247,11,247,1,207,246,192,31,252,203,247,177,138,10,248,99,
+251,10,21,251,108,6,216,160,185,180,203,27,193,170,106,82,31,14,100,247,251,
+247,241,21,154,6,214,177,106,74,95,119,95,105,109,31,108,112,111,130,84,138,
+8,125,221,10,134,171,156,137,158,27,229,219,184,220,194,31,172,189,162,209,
+193,26,210,103,188,77,153,30,214,165,186,206,217,26,228,59,197,251,14,251,
+32,35,72,35,117,30,251,11,252,194,87,29,247,6,248,173,5,192,150,173,166,195,
+27,195,172,115,98,109,124,107,114,120,31,121,117,111,130,97,27,14,251,209,
+247,152,97,10,14,73,247,20,248,12,21,114,251,12,5,248,21,6,103,251,62,5,247,
+11,6,200,247,182,5,14,100,247,38,251,112,21,189,247,127,5,111,164,164,129,
+184,27,196,175,153,180,187,31,98,155,159,125,186,27,167,159,144,152,165,31,
+157,225,5,136,129,135,138,132,27,125,132,147,154,150,141,155,144,162,31,222,
+248,26,98,29,67,251,230,5,76,126,87,99,72,27,92,110,163,177,148,142,157,143,
+158,31,210,247,225,98,29,251,54,253,140,5,14,247,242,248,81,249,29,21,247,
+25,6,156,219,5,252,1,180,29,247,29,6,59,252,12,5,234,6,248,87,22,247,49,247,
+241,65,251,241,5,230,6,236,248,92,5,251,29,6,251,50,251,243,128,247,243,5,
+251,30,6,42,252,92,5,230,6,214,247,241,149,251,241,5,14,211,61,10,247,76,
+247,137,97,10,248,224,247,34,155,29,167,253,15,21,251,76,6,153,157,158,153,
+208,180,190,194,10,77,82,35,122,30,230,6,197,146,165,170,181,27,172,158,122,
+110,113,128,113,118,119,31,120,120,117,125,71,98,51,247,3,29,73,249,10,248,
+88,147,29,104,251,54,5,247,11,6,174,247,54,5,247,75,6,93,251,105,21,252,120,
+6,114,251,11,5,248,120,6,14,156,247,148,247,32,21,247,79,6,218,196,174,29,
+73,27,251,51,6,165,247,12,5,251,42,130,10,195,247,157,21,186,247,111,5,247,
+45,6,193,175,108,91,110,128,100,247,2,29,247,76,247,144,97,10,248,227,247,
+34,155,29,156,252,185,103,29,73,212,10,251,155,91,242,29,174,177,169,119,
+160,109,31,211,247,230,242,29,175,176,169,119,160,109,31,14,252,6,247,227,
+199,10,59,6,56,252,25,5,219,6,107,251,43,21,59,6,56,252,25,5,219,6,14,251,
+142,247,207,249,66,21,56,71,71,56,56,207,70,221,224,207,206,224,222,71,207,
+55,31,140,76,21,187,179,100,90,89,99,100,89,92,99,179,187,188,179,179,188,
+31,14,100,247,244,249,109,223,10,251,93,254,71,171,10,247,93,247,18,72,219,
+33,72,83,110,79,93,31,141,29,247,76,247,128,58,10,248,144,247,73,155,29,143,
+252,185,247,8,29,251,110,251,152,124,67,5,247,69,6,119,46,5,232,6,159,232,
+5,185,6,251,15,212,21,33,6,247,32,247,58,5,14,251,209,248,27,248,0,21,251,
+76,6,152,157,159,153,207,180,191,194,10,76,82,35,123,30,230,6,197,145,165,
+170,182,27,172,158,122,110,113,127,113,119,119,31,120,120,118,125,69,98,52,
+247,3,29,226,247,248,247,205,21,230,6,175,156,128,115,133,137,131,135,122,
+31,131,106,133,108,124,26,130,140,133,143,126,30,241,6,144,160,5,130,145,
+136,145,148,26,140,152,5,151,210,142,160,156,26,161,128,153,111,152,30,203,
+168,172,186,203,26,198,106,169,73,30,251,130,6,45,252,78,5,235,6,193,247,
+146,21,162,247,0,5,241,6,179,154,130,115,120,132,115,130,128,31,124,128,121,
+133,106,27,194,247,241,21,251,138,218,10,247,139,247,121,247,114,247,132,
+247,67,251,21,247,20,173,10,251,32,37,243,247,33,247,87,247,75,247,73,247,
+88,31,14,73,212,10,14,100,247,247,248,245,21,177,112,174,101,163,98,8,160,
+101,119,145,107,27,69,72,109,88,94,31,80,72,101,33,41,26,251,18,222,64,247,
+31,243,225,180,218,197,30,191,208,167,227,230,26,247,20,90,223,251,22,236,
+30,232,180,96,182,35,94,133,143,134,141,137,141,25,111,155,122,149,126,146,
+115,149,25,69,89,177,115,145,135,165,121,25,51,98,180,96,5,247,21,251,25,
+21,163,166,130,125,159,31,162,122,149,114,99,26,251,28,69,38,44,115,115,148,
+154,120,30,117,158,129,168,184,26,189,152,193,163,180,30,191,168,182,167,
+190,27,14,73,248,152,248,80,21,251,49,251,21,38,247,21,37,54,240,251,20,251,
+47,251,20,205,55,247,47,247,20,240,251,21,241,223,38,247,21,247,49,247,21,
+5,14,251,209,247,116,58,10,14,226,249,24,248,67,21,141,156,140,146,148,26,
+216,78,190,46,63,72,106,78,91,30,96,84,112,59,63,26,40,199,79,237,247,6,225,
+203,244,167,30,47,6,83,121,99,109,82,27,83,109,172,200,188,155,193,164,177,
+31,181,168,176,160,185,27,192,162,115,85,31,115,247,204,21,251,139,218,10,
+247,140,247,121,247,114,247,132,247,68,251,21,247,19,173,10,251,33,37,242,
+247,34,247,87,247,75,247,73,247,89,31,14,211,32,10,247,123,248,17,83,10,211,
+32,10,167,248,17,67,10,211,32,10,178,248,1,90,10,14,211,32,10,63,248,17,159,
+29,211,32,10,221,248,34,69,10,14,211,32,10,247,94,248,4,21,105,125,121,123,
+117,27,127,207,29,97,97,63,115,173,29,161,134,155,132,29,211,248,25,116,21,
+247,68,140,247,28,243,180,247,59,8,251,35,6,47,110,68,87,42,27,42,90,193,
+245,221,247,24,29,165,140,150,151,26,247,18,34,223,251,47,251,15,32,86,38,
+58,30,68,51,95,251,27,251,21,26,251,37,231,38,247,33,128,30,84,55,5,227,10,
+102,110,116,146,162,91,31,109,88,5,116,197,169,133,230,29,134,124,31,14,156,
+33,10,248,55,249,191,83,10,156,33,10,247,130,249,191,67,29,156,33,10,247,
+138,249,175,90,10,14,156,33,10,247,36,249,191,159,29,51,10,247,168,150,10,
+51,10,214,250,60,67,10,51,10,223,82,29,51,10,107,250,60,198,10,95,247,42,
+5,14,211,41,29,161,250,47,21,105,125,121,123,116,27,128,207,29,96,97,63,116,
+173,29,160,134,156,132,29,247,20,249,112,237,10,103,94,39,10,247,20,248,177,
+247,20,10,68,247,39,5,251,3,251,87,39,10,247,20,248,186,85,10,251,64,80,39,
+10,247,20,248,86,250,60,177,29,108,251,87,39,10,247,20,248,174,249,121,63,
+29,247,87,247,202,21,105,126,121,163,10,116,31,193,6,172,155,155,155,125,
+29,156,248,173,247,20,29,210,251,39,5,247,180,251,174,48,10,14,211,249,72,
+250,60,191,29,247,17,82,47,29,211,248,152,247,20,10,68,247,39,5,174,251,99,
+47,29,211,248,155,85,10,119,68,47,29,211,248,66,250,60,177,10,247,2,251,99,
+47,29,156,40,29,247,141,150,10,156,40,29,215,82,29,100,53,10,251,75,247,77,
+21,247,31,247,39,5,62,6,37,42,78,236,5,61,6,210,251,39,5,14,45,248,223,125,
+10,237,252,226,34,29,45,248,22,247,19,29,68,247,39,5,172,253,120,34,29,45,
+248,31,85,29,111,252,240,34,29,45,247,195,155,10,244,253,120,34,29,45,32,
+29,172,248,154,69,10,14,45,32,29,247,42,248,125,42,10,45,247,180,116,21,247,
+19,136,246,221,178,247,23,8,112,10,247,26,6,226,10,101,93,156,72,27,45,66,
+108,75,86,31,80,69,97,251,9,45,26,67,175,72,194,109,30,158,129,157,133,175,
+132,82,52,24,227,10,101,110,117,146,163,91,31,109,87,5,117,196,170,132,230,
+29,135,124,31,14,45,248,198,125,10,247,61,252,17,39,29,45,248,14,168,29,227,
+252,167,39,29,45,248,28,84,10,159,252,31,39,29,45,247,189,155,10,247,49,252,
+167,39,29,43,10,247,133,125,10,14,43,10,179,249,137,67,10,43,10,188,85,29,
+14,43,10,79,155,10,14,100,35,29,247,166,247,96,42,10,100,248,235,125,10,111,
+81,41,10,100,248,51,247,19,29,67,247,39,5,251,1,251,100,41,10,100,248,57,
+85,29,251,60,67,41,10,100,247,219,249,137,198,10,95,247,42,5,105,251,100,
+41,10,100,34,10,247,86,247,199,21,105,118,118,122,116,27,128,136,140,148,
+122,31,94,160,5,153,110,125,142,115,27,84,87,97,64,100,31,193,6,172,162,158,
+154,157,27,147,160,132,132,152,31,184,114,5,132,150,159,135,156,27,203,197,
+183,217,176,31,14,45,248,94,248,246,86,29,210,251,39,5,247,126,251,136,55,
+29,14,100,248,223,249,137,247,7,29,247,4,252,243,49,29,100,248,42,168,29,
+167,253,137,49,29,100,248,56,84,10,99,253,1,49,29,100,247,217,249,137,177,
+29,236,253,137,49,29,45,79,29,52,247,109,83,10,45,79,29,251,148,247,93,66,
+10,251,42,54,29,251,9,247,75,169,29,251,146,247,66,248,245,21,70,251,217,
+5,232,6,178,247,75,5,187,150,168,167,180,27,167,154,124,110,131,138,131,137,
+128,31,99,251,80,5,232,6,185,247,109,5,142,150,140,151,149,26,187,100,172,
+83,100,102,124,112,112,30,135,134,148,180,5,14,155,248,61,248,165,36,29,247,
+245,232,247,25,10,247,185,248,61,248,165,36,29,247,245,232,36,29,247,142,
+243,89,10,14,247,185,248,61,248,165,36,29,247,245,232,36,29,247,182,247,185,
+21,251,32,192,29,224,29,14,247,76,249,96,86,10,252,190,251,34,161,29,249,
+28,251,233,64,10,14,247,76,249,129,86,10,100,252,119,21,193,171,162,172,184,
+26,193,91,177,69,51,67,77,64,113,149,154,29,83,247,27,21,172,161,122,113,
+100,105,109,97,108,119,157,166,177,170,168,180,31,105,172,10,252,99,247,165,
+59,10,14,247,76,249,116,86,10,113,252,119,21,194,217,10,149,122,168,117,30,
+76,203,29,102,161,30,83,106,10,251,145,248,163,21,251,121,6,51,251,129,5,
+214,6,160,153,160,150,165,27,174,158,119,104,78,103,94,90,107,118,154,162,
+142,140,145,140,144,31,56,6,137,127,138,133,131,26,79,187,100,211,244,222,
+225,247,0,205,99,180,74,110,116,132,121,111,30,171,227,5,247,70,6,14,247,
+76,249,93,86,10,127,252,119,64,10,251,81,248,162,21,251,193,6,123,64,5,247,
+104,6,251,9,251,5,80,47,91,251,37,8,224,6,171,247,6,186,222,227,236,176,178,
+160,160,144,144,8,14,251,209,247,203,249,98,21,68,80,100,68,106,31,113,85,
+117,39,78,26,63,185,93,215,212,197,178,210,173,30,165,193,161,239,200,26,
+215,93,185,61,30,123,67,21,167,158,120,110,101,125,62,123,84,31,82,122,119,
+117,103,27,111,121,158,167,177,152,213,156,196,31,197,156,159,162,174,27,
+14,251,209,248,52,248,86,103,29,251,209,248,87,249,89,21,251,135,6,48,251,
+131,5,224,6,161,153,159,149,167,27,174,158,120,105,81,104,97,91,106,118,153,
+160,31,140,155,5,47,6,137,125,138,133,130,26,79,190,99,216,247,2,225,224,
+247,0,207,96,181,69,111,119,133,124,111,30,167,215,5,247,76,6,14,251,209,
+248,78,248,244,21,155,7,198,95,174,66,72,84,107,75,99,30,106,88,112,33,63,
+26,67,189,93,216,240,222,226,245,203,98,178,72,108,112,130,119,110,30,218,
+159,162,168,184,27,168,152,129,111,145,31,55,251,5,21,170,158,120,108,86,
+104,96,95,108,118,160,170,190,176,182,183,31,14,251,209,248,111,249,89,21,
+251,210,180,29,247,107,6,251,11,251,6,84,55,89,251,39,8,234,6,179,247,31,
+195,225,247,30,247,23,8,14,251,209,247,255,248,152,21,188,167,165,175,183,
+26,195,88,177,64,47,63,77,64,112,148,123,168,117,30,76,108,107,92,81,26,72,
+193,97,222,244,222,213,231,174,125,162,104,160,30,71,247,22,21,172,162,123,
+115,103,106,111,96,108,119,155,165,174,169,166,180,31,108,251,59,21,173,160,
+121,109,91,106,105,91,105,115,158,166,187,175,175,187,31,14,251,209,234,248,
+25,21,137,128,138,134,132,26,83,186,100,207,209,196,172,202,176,30,176,203,
+164,227,212,26,216,90,188,61,35,59,56,251,0,73,181,98,206,172,163,148,162,
+168,30,65,122,114,110,95,27,111,120,151,158,141,139,142,140,143,31,245,247,
+149,21,173,160,119,106,84,102,96,92,110,121,158,170,196,172,183,182,31,14,
+247,24,51,10,248,145,199,10,251,6,252,175,5,84,127,104,109,86,27,100,112,
+161,171,148,141,151,141,152,31,156,216,146,10,123,67,5,135,117,136,115,120,
+201,10,156,216,247,6,248,175,24,14,211,32,10,247,59,248,15,181,29,126,159,
+10,211,248,168,247,39,21,157,251,39,5,214,6,95,124,119,129,115,121,8,96,108,
+114,98,99,26,89,202,29,113,27,101,122,152,169,189,195,197,217,171,31,124,
+10,14,211,63,10,221,248,90,21,251,26,6,45,251,42,5,202,6,14,211,63,10,101,
+247,199,83,29,211,249,164,248,118,21,141,155,141,157,145,26,197,117,190,97,
+181,30,185,91,78,161,58,27,251,23,251,9,84,44,71,31,74,51,94,251,34,251,4,
+26,71,163,70,180,88,30,81,185,200,113,227,27,245,239,174,198,202,31,188,185,
+171,194,159,216,8,251,39,6,49,111,64,83,49,27,47,91,190,238,232,165,230,185,
+204,31,213,192,200,176,210,27,206,182,112,90,150,31,143,122,140,131,109,26,
+113,248,76,122,10,211,81,10,247,51,249,44,82,10,211,61,10,156,33,10,247,199,
+249,44,83,29,156,33,10,247,228,249,173,123,29,156,117,10,248,108,6,95,124,
+119,129,115,121,8,95,108,115,98,98,26,90,202,29,112,27,102,122,151,167,189,
+177,181,230,190,31,247,5,29,14,247,20,56,29,106,250,60,181,29,127,26,76,247,
+2,10,247,20,249,174,215,10,99,125,117,109,111,8,92,88,82,114,83,27,40,77,
+204,243,220,164,223,182,198,31,215,194,207,178,217,27,190,183,124,112,164,
+31,156,122,144,123,144,97,8,247,33,6,140,151,139,146,146,26,195,112,196,93,
+180,30,183,90,76,160,58,27,251,22,251,10,87,50,67,31,63,46,93,251,17,251,
+3,26,69,158,79,177,85,30,62,194,204,106,235,27,194,191,152,163,186,31,174,
+157,154,153,176,187,136,43,24,229,6,56,250,48,122,10,51,10,247,67,250,42,
+123,29,100,62,29,247,129,249,191,83,10,100,62,29,247,120,248,240,46,10,211,
+41,29,168,247,12,29,208,6,14,211,41,29,55,249,169,82,10,247,20,60,29,247,
+26,247,215,247,6,10,247,238,247,39,247,6,10,14,211,33,29,247,66,248,158,68,
+10,211,33,29,204,248,11,83,29,156,46,29,211,248,65,68,10,156,247,239,116,
+21,243,140,214,161,199,187,8,200,187,179,225,222,167,10,225,185,179,10,224,
+29,102,29,34,49,87,172,197,143,215,29,76,167,86,191,103,30,172,116,170,130,
+217,127,84,55,24,70,29,127,137,135,123,31,14,100,80,29,247,38,249,169,169,
+29,211,44,10,251,134,247,116,69,10,14,211,44,10,251,93,247,99,144,29,100,
+53,10,57,247,224,83,10,100,53,10,251,49,247,206,146,29,247,3,6,14,211,32,
+10,247,115,247,238,68,29,100,80,29,251,40,79,21,116,251,4,5,205,6,133,94,
+105,103,204,29,211,64,29,251,25,248,91,67,29,247,186,37,10,147,250,60,67,
+29,247,186,37,10,167,82,29,156,40,29,187,250,60,67,10,211,248,213,247,223,
+21,69,251,223,119,29,247,6,248,173,5,206,6,156,219,5,72,222,10,251,43,6,116,
+251,4,5,251,181,222,10,251,42,221,10,72,180,29,206,6,251,6,252,173,119,29,
+209,247,223,5,247,208,247,17,21,251,181,6,156,220,5,247,181,6,14,156,33,10,
+248,66,249,156,21,251,192,180,29,247,193,6,14,247,20,55,10,251,68,250,62,
+67,10,211,96,10,247,108,248,241,67,29,51,10,247,145,250,25,21,251,165,180,
+29,247,165,6,14,248,4,176,29,215,6,49,89,97,91,82,26,90,185,110,214,162,153,
+141,146,173,30,150,191,5,133,121,111,134,125,27,110,122,155,167,183,188,202,
+199,171,31,14,45,75,10,46,158,10,211,95,10,220,79,140,29,100,62,29,147,251,
+79,139,10,211,41,29,252,9,79,139,10,247,20,60,29,247,106,247,180,68,29,211,
+33,29,251,93,252,110,140,29,156,45,10,251,14,248,65,67,10,247,20,56,29,252,
+24,81,145,10,94,104,197,10,211,44,10,37,247,64,68,29,211,248,205,251,64,21,
+131,118,115,136,113,27,101,121,153,169,162,149,162,161,169,31,161,169,155,
+153,198,186,217,198,172,190,161,236,244,248,130,24,251,42,6,124,29,105,135,
+108,116,26,251,9,235,66,247,45,172,161,142,149,189,30,97,120,113,123,123,
+124,8,108,111,123,105,104,26,91,190,111,228,164,159,142,145,170,30,14,156,
+33,10,248,10,249,189,76,10,248,5,77,29,247,97,250,58,187,29,130,125,159,10,
+45,247,234,248,176,89,10,247,170,247,17,21,251,32,133,29,224,29,126,75,208,
+10,124,133,109,29,14,247,94,22,247,16,248,218,104,29,14,45,32,29,247,8,248,
+135,76,29,45,248,163,156,50,29,218,6,36,100,86,86,77,26,87,186,112,227,168,
+159,141,146,171,30,149,191,5,131,114,119,136,108,27,104,123,152,169,186,181,
+185,228,186,31,110,10,14,45,37,29,247,6,248,55,83,10,45,37,29,147,247,164,
+21,247,32,247,39,5,62,6,36,42,78,236,5,62,6,210,251,39,5,14,45,37,29,178,
+248,39,146,29,247,3,6,14,232,248,52,72,10,248,16,247,184,145,10,94,104,103,
+247,15,10,100,248,182,249,43,223,10,125,72,87,29,112,251,18,127,10,127,84,
+87,29,247,19,248,232,5,199,6,153,206,5,79,6,153,205,98,29,251,72,251,184,
+247,6,29,54,85,106,184,211,247,14,214,247,1,222,31,14,45,38,10,145,247,183,
+82,10,45,38,10,173,248,58,123,29,45,248,79,251,64,21,131,118,116,136,112,
+27,106,121,154,167,177,177,195,195,184,31,210,193,179,184,165,193,8,184,29,
+247,255,6,139,29,251,10,39,26,251,16,225,55,247,18,159,151,140,145,166,30,
+53,87,112,107,88,26,87,188,110,224,165,158,141,146,170,30,251,96,248,179,
+142,10,14,100,51,29,247,68,247,209,21,96,123,104,117,87,27,92,131,10,100,
+248,158,206,10,121,56,130,156,132,148,119,162,25,170,112,113,151,100,27,62,
+62,100,74,89,31,83,66,103,36,48,26,75,156,90,175,99,30,106,170,176,124,190,
+27,210,197,166,190,177,31,123,66,5,77,126,77,91,72,27,108,110,149,154,125,
+31,131,148,135,149,158,26,251,37,6,138,130,138,132,135,26,99,170,94,180,118,
+30,120,174,182,131,199,27,247,61,241,207,247,24,167,31,247,10,248,194,5,251,
+166,251,0,21,196,172,98,66,251,12,61,35,50,87,109,176,203,247,15,215,247,
+6,222,31,247,11,247,203,122,10,101,10,247,159,150,10,251,142,101,10,247,107,
+249,109,46,10,100,35,29,247,168,247,109,83,10,100,35,29,247,52,209,82,10,
+100,34,10,247,23,247,212,219,10,210,6,247,237,247,39,219,10,210,6,14,251,
+153,93,29,247,74,247,109,68,10,45,53,29,247,13,248,27,68,10,45,53,29,81,248,
+27,181,10,14,45,247,18,29,59,74,119,100,95,30,95,101,112,83,88,26,82,179,
+101,228,212,29,104,108,147,153,120,30,125,151,133,150,138,162,8,251,29,6,
+136,126,138,132,130,26,93,107,10,105,134,138,135,137,130,30,251,131,252,62,
+21,115,251,4,5,206,6,132,94,105,197,10,251,153,73,29,201,248,29,145,10,94,
+104,103,204,10,100,78,29,202,249,153,21,82,247,0,29,181,109,168,96,31,130,
+183,29,14,100,78,29,247,0,136,29,251,42,54,29,130,247,222,68,10,251,42,54,
+29,52,247,206,123,29,100,247,242,249,52,21,151,196,98,29,127,82,5,77,180,
+29,201,6,251,18,252,228,87,29,208,247,216,5,199,152,196,185,201,27,181,166,
+116,103,131,137,122,135,123,31,69,251,222,87,29,216,247,254,5,143,157,141,
+159,155,26,220,83,191,51,103,99,129,122,105,30,113,126,127,127,112,104,167,
+247,22,24,247,72,6,156,219,5,14,251,209,149,29,69,251,224,5,135,125,138,126,
+125,26,83,179,109,212,172,163,142,147,166,30,160,237,29,144,141,152,142,155,
+31,202,247,186,5,217,6,251,172,252,132,46,10,247,20,38,29,157,249,137,67,
+29,247,20,38,29,165,84,10,14,45,32,29,247,63,248,103,68,29,45,49,10,251,170,
+247,109,169,10,45,58,29,75,248,55,67,10,45,38,10,247,21,248,39,68,29,100,
+50,10,144,247,212,67,10,43,10,247,70,249,134,76,29,43,10,247,109,249,102,
+21,251,159,180,29,247,159,6,14,247,217,248,176,208,10,125,132,109,29,196,
+249,231,67,29,45,98,10,90,252,26,145,10,95,104,102,247,15,10,101,10,251,36,
+79,46,10,100,35,29,52,252,236,145,10,95,104,102,95,131,129,93,24,215,145,
+206,191,10,100,34,10,247,107,247,177,68,29,251,153,152,10,149,138,136,156,
+31,169,247,34,5,140,131,136,139,133,27,75,75,97,66,93,31,161,245,5,251,150,
+252,236,46,10,100,48,29,247,26,249,134,121,29,100,248,177,22,153,29,147,145,
+165,126,10,247,95,249,102,68,29,100,249,36,206,10,88,29,204,6,38,94,91,90,
+79,26,86,185,113,232,162,147,140,144,163,30,154,142,150,191,5,131,116,116,
+136,117,27,104,121,153,166,189,184,190,219,180,31,14,251,153,247,70,178,10,
+200,247,179,5,221,156,190,180,222,27,154,178,29,135,139,134,27,74,75,97,66,
+93,31,162,245,5,215,209,83,29,45,247,180,117,21,247,58,244,221,247,19,162,
+10,106,133,138,135,137,130,30,247,27,6,80,10,84,178,88,199,116,30,126,171,
+163,133,162,27,85,247,14,29,109,120,101,111,247,24,10,100,51,29,247,5,247,
+62,21,163,247,4,5,72,6,146,184,173,175,184,147,149,185,24,63,133,72,72,128,
+61,119,43,24,14,45,199,247,210,21,100,71,5,212,6,140,71,147,90,159,94,8,74,
+169,213,93,217,27,179,173,146,166,226,31,170,247,41,5,97,52,110,129,98,27,
+79,103,189,231,132,31,247,73,6,177,207,5,251,109,6,143,161,143,158,147,166,
+8,247,132,6,178,207,5,251,143,6,231,181,196,187,202,27,183,173,122,89,191,
+31,212,247,21,5,193,77,103,153,68,27,251,35,251,17,40,251,63,65,31,91,6,100,
+71,5,203,6,131,111,137,128,134,110,8,14,248,90,247,159,247,140,21,236,6,214,
+199,165,194,189,31,190,195,171,219,213,26,192,117,188,100,170,30,168,104,
+100,150,75,27,251,100,6,251,43,253,92,87,29,217,248,1,21,187,247,119,5,202,
+6,198,172,109,85,106,128,102,124,117,31,104,114,104,123,85,27,248,42,251,
+171,21,137,129,133,138,130,27,117,123,149,154,140,31,143,141,151,143,157,
+30,159,230,5,205,6,157,225,5,73,6,164,247,11,5,251,23,6,114,251,11,5,87,6,
+121,53,5,191,6,111,251,21,5,136,125,137,123,128,26,83,179,109,215,165,150,
+141,148,165,30,248,2,247,130,21,143,153,140,145,147,26,193,90,174,62,89,98,
+126,113,111,30,112,114,122,103,104,26,100,163,115,196,121,30,183,124,5,171,
+129,143,137,129,26,120,122,128,108,105,123,150,161,138,30,38,6,137,128,139,
+135,133,26,82,194,101,221,247,0,205,193,227,176,113,165,87,154,30,84,156,
+5,115,146,135,142,150,26,156,153,147,167,164,152,132,125,134,138,136,136,
+134,30,14,45,248,79,247,208,21,151,194,5,251,31,6,138,145,137,149,135,156,
+130,171,25,129,177,137,147,131,29,251,28,59,71,114,91,87,30,90,94,109,77,
+81,26,113,143,121,158,84,30,142,132,5,79,6,127,84,5,228,6,140,134,5,135,7,
+140,132,140,134,140,130,8,36,6,127,84,5,247,4,6,129,83,99,97,49,86,172,38,
+24,148,29,247,2,5,118,94,106,130,211,10,126,135,110,75,31,217,193,184,186,
+155,183,8,247,2,6,151,194,5,251,2,144,6,147,139,142,137,153,30,14,45,248,
+9,248,64,21,251,8,6,175,247,56,5,247,146,6,164,247,12,5,252,30,6,251,43,253,
+92,87,29,205,247,200,5,247,7,6,73,251,200,5,247,23,6,186,247,109,5,218,155,
+190,183,212,27,153,178,29,135,139,134,27,82,79,97,66,93,31,161,245,5,251,
+23,6,14,121,10,121,10,251,209,198,29,247,242,203,10,247,127,248,153,248,212,
+21,140,152,140,146,148,26,218,88,186,53,74,83,115,95,98,30,94,90,109,55,63,
+26,53,193,88,232,233,217,198,234,169,30,251,6,6,97,121,120,123,108,27,109,
+123,160,178,173,148,180,154,171,31,178,157,159,155,170,27,171,150,124,95,
+140,31,247,224,251,71,21,65,71,106,83,96,31,103,93,116,69,76,26,48,197,85,
+237,247,32,243,247,7,247,47,229,81,192,41,30,120,43,21,172,160,112,96,58,
+91,69,84,105,118,166,182,220,187,209,195,31,151,248,44,21,252,170,253,89,
+5,218,6,248,171,249,89,5,14,248,4,199,10,251,28,6,116,251,1,5,134,116,136,
+118,130,26,84,184,100,206,135,30,148,185,5,96,148,118,158,171,26,146,140,
+147,141,153,30,220,6,14,248,95,86,10,14,251,209,248,103,249,102,68,29,45,
+32,29,169,248,154,69,10,201,247,53,68,10,100,75,29,60,158,10,45,57,10,212,
+248,71,121,29,247,210,248,176,223,10,251,7,252,176,5,212,6,46,83,103,97,87,
+26,87,184,108,213,158,142,139,148,180,30,150,191,5,130,109,134,138,124,27,
+108,123,154,166,184,175,189,203,184,31,247,47,249,109,223,10,113,251,17,87,
+29,14,251,63,247,255,214,10,247,230,248,83,122,29,100,34,10,247,53,247,209,
+76,10,100,47,10,236,248,1,83,10,43,10,247,103,249,124,21,105,126,121,122,
+116,27,128,136,241,29,115,27,84,96,97,64,116,31,193,6,172,155,155,154,157,
+27,147,161,132,132,153,31,190,114,5,133,152,160,240,29,150,160,150,179,8,
+14,100,48,29,247,76,249,124,42,10,100,62,29,248,9,247,243,21,251,42,6,108,
+251,38,5,247,41,6,14,247,20,60,10,247,42,247,213,21,96,123,104,117,88,27,
+91,131,10,156,46,29,251,197,252,203,145,10,95,104,197,29,100,247,248,22,168,
+6,247,21,248,240,5,162,29,210,6,77,43,5,150,164,228,29,118,145,163,90,31,
+109,87,5,117,198,167,133,185,27,230,198,181,204,175,115,160,99,124,127,137,
+134,123,31,14,251,209,247,82,117,21,138,148,146,139,149,27,170,163,142,147,
+167,31,147,10,159,232,5,128,29,105,155,113,169,125,30,78,44,5,149,163,151,
+142,156,27,165,157,126,120,113,247,23,10,99,124,127,137,135,123,31,14,211,
+44,29,251,68,247,97,76,29,211,32,10,210,248,34,69,10,192,247,62,83,10,247,
+20,43,29,174,248,15,68,10,247,242,69,29,247,220,247,224,68,10,212,214,22,
+247,42,6,243,248,124,5,230,158,194,179,244,27,211,172,116,88,125,137,126,
+135,118,31,251,9,252,186,5,108,132,125,127,108,27,125,133,140,141,135,31,
+113,251,12,5,135,153,153,138,163,27,247,9,195,175,227,157,31,247,30,249,28,
+5,143,158,141,157,157,26,223,69,187,251,16,45,81,115,72,73,30,157,221,146,
+10,14,100,248,117,248,87,21,172,247,45,5,247,104,95,29,252,220,133,29,247,
+114,6,106,251,45,5,251,45,180,29,247,45,6,60,252,7,119,29,218,248,7,5,247,
+45,6,156,219,5,14,100,202,22,158,29,59,252,11,5,107,132,125,127,109,27,124,
+133,109,29,236,248,92,5,143,158,141,157,157,144,10,251,32,6,14,251,209,149,
+29,119,43,5,79,6,125,72,5,198,6,104,251,61,5,135,125,138,126,125,26,83,179,
+109,212,172,163,142,147,167,30,159,237,5,137,125,132,138,127,27,115,125,148,
+155,144,141,152,142,155,31,167,247,23,5,211,6,153,206,5,68,6,159,235,5,217,
+6,14,45,247,204,248,176,223,10,251,5,252,176,119,10,14,197,247,165,206,10,
+251,7,252,176,5,190,29,138,128,133,115,31,73,156,29,158,156,144,10,251,148,
+247,81,46,10,211,44,29,251,61,247,86,143,29,116,31,193,6,173,155,155,154,
+125,29,247,131,36,10,62,248,46,68,10,51,10,247,143,250,47,143,29,115,173,
+29,161,134,155,132,29,247,186,37,10,69,250,57,159,29,247,186,37,10,247,118,
+237,10,14,247,20,38,29,72,249,137,177,29,14,247,20,38,29,247,75,125,10,14,
+156,40,29,121,250,60,159,29,45,49,10,251,238,247,109,177,29,14,251,42,14,
+14,248,7,248,147,115,29,90,4,247,67,247,33,251,33,251,67,251,68,251,33,251,
+32,251,69,251,67,251,31,247,34,247,71,247,62,247,35,247,33,247,65,31,251,
+1,251,55,187,10,251,20,251,0,21,146,54,150,98,169,94,8,76,181,203,107,222,
+27,216,199,166,193,181,31,175,186,154,184,146,232,128,89,128,117,113,109,
+8,84,91,79,113,58,27,58,79,165,194,91,31,113,169,128,161,128,189,8,247,238,
+247,0,187,10,14,248,38,248,163,115,29,251,1,251,99,188,10,251,20,251,5,21,
+150,89,150,117,165,109,8,84,187,199,113,220,27,220,199,165,194,187,31,165,
+169,150,161,150,189,132,54,128,98,109,94,8,76,97,75,107,56,27,62,79,166,193,
+97,31,103,186,124,184,132,232,8,247,238,247,5,188,10,14,83,247,188,111,21,
+156,222,199,243,247,11,247,43,180,192,155,160,154,163,8,177,202,157,194,193,
+26,220,69,207,54,91,95,118,101,107,30,118,114,128,117,126,93,8,242,103,86,
+187,58,27,54,72,70,52,74,163,87,220,251,2,31,247,44,251,96,178,73,165,36,
+8,14,251,32,247,160,249,137,21,66,251,18,76,49,251,32,251,68,240,251,15,247,
+53,251,120,153,97,222,247,32,223,247,11,247,3,247,26,251,10,247,37,41,247,
+31,77,247,0,8,14,145,248,215,22,159,7,132,141,116,144,62,158,139,140,112,
+156,25,69,187,100,216,228,26,148,7,155,7,159,103,148,126,151,124,8,92,177,
+200,109,193,27,230,211,213,232,231,74,210,57,113,128,136,121,103,31,136,138,
+131,134,129,135,8,169,183,148,165,176,26,229,67,210,47,46,68,69,49,103,146,
+120,173,86,30,163,88,120,145,112,27,61,73,64,51,45,211,67,233,219,209,190,
+229,182,31,140,114,5,131,7,84,113,69,101,95,30,92,90,138,138,251,14,110,131,
+137,24,119,7,14,251,11,247,192,247,153,21,127,7,68,107,69,90,102,30,108,98,
+86,122,87,27,126,116,248,119,162,6,251,50,145,60,227,142,247,61,8,53,185,
+182,109,218,27,205,196,202,212,208,115,176,251,1,239,31,251,2,241,122,165,
+99,247,9,124,48,77,49,35,56,8,60,73,103,81,76,26,64,200,77,212,180,180,156,
+169,172,30,158,157,150,154,156,176,8,14,239,248,20,248,130,21,159,100,114,
+146,106,27,39,55,56,41,42,229,54,242,171,169,147,155,166,31,190,170,174,196,
+191,26,182,120,189,104,192,30,247,42,247,42,142,121,161,82,154,110,25,119,
+150,144,133,149,27,146,144,144,146,142,139,139,136,157,31,132,174,137,161,
+166,26,171,145,189,146,162,30,141,144,139,141,141,26,145,135,143,132,136,
+136,139,138,136,30,129,105,109,135,103,27,112,117,141,146,104,31,142,121,
+139,139,136,27,133,133,132,133,123,181,115,194,122,31,162,132,145,137,5,251,
+140,251,65,21,211,199,78,66,65,79,79,65,64,79,199,214,213,199,198,216,31,
+14,239,247,244,247,152,21,251,55,96,247,55,251,58,187,247,58,247,53,182,251,
+53,243,6,231,162,204,217,226,26,235,54,220,39,42,57,56,42,54,205,62,232,116,
+30,166,247,203,21,208,197,80,69,67,81,81,67,67,82,197,212,211,197,195,213,
+31,14,251,42,247,127,247,83,21,147,117,123,143,122,27,70,79,82,73,101,168,
+115,184,190,186,164,181,169,31,160,169,148,170,184,26,247,212,7,171,133,161,
+123,162,102,8,163,101,149,101,85,26,89,129,97,115,81,30,168,6,178,185,160,
+199,204,26,220,107,219,76,214,30,83,206,137,141,131,149,134,146,25,203,91,
+7,14,247,159,247,148,248,163,21,115,116,108,66,103,26,251,16,79,247,16,6,
+104,156,96,176,84,30,52,52,180,98,227,226,157,120,161,126,161,134,25,206,
+122,142,138,5,251,15,198,247,15,7,143,140,178,149,165,145,141,140,25,150,
+144,158,150,171,160,227,52,24,180,180,52,226,157,166,153,164,143,150,25,142,
+146,144,159,150,182,8,247,15,199,251,15,6,129,179,133,162,136,146,135,150,
+125,164,121,166,226,225,24,98,180,51,53,109,166,126,145,49,161,25,247,14,
+80,251,14,7,136,138,72,121,132,137,119,127,104,116,25,51,226,98,98,5,247,
+186,80,21,239,222,54,38,36,56,55,36,34,58,221,245,243,222,220,245,31,14,93,
+131,22,249,0,249,0,253,0,6,247,201,251,74,21,209,198,81,71,70,76,78,68,74,
+82,197,205,210,198,200,207,31,14,93,247,194,249,24,21,251,42,251,21,251,19,
+251,40,251,47,247,17,251,20,247,44,247,46,247,19,247,18,247,45,247,45,251,
+19,247,18,251,44,31,90,4,247,19,242,36,251,19,251,19,36,36,251,21,251,18,
+37,243,247,22,247,15,244,242,247,17,31,14,93,247,194,249,24,21,247,44,247,
+19,251,19,251,44,251,45,251,19,251,18,251,46,251,44,251,17,247,20,247,47,
+247,40,247,21,247,19,247,42,31,248,0,253,24,21,249,109,253,109,253,109,7,
+248,1,248,231,21,251,17,34,35,251,14,251,22,241,35,247,18,247,21,242,241,
+247,20,247,19,36,242,251,19,31,14,247,242,247,28,22,249,109,248,1,253,109,
+6,14,93,76,199,10,253,109,249,109,249,109,7,14,93,182,22,248,155,248,155,
+252,155,6,248,103,252,103,21,252,51,248,51,248,51,6,14,247,232,249,175,206,
+21,251,192,248,197,251,192,252,197,5,14,247,242,225,247,173,21,249,41,6,114,
+109,102,65,121,26,131,147,131,147,149,144,143,155,152,30,181,187,173,166,
+220,186,8,162,152,143,142,146,26,151,138,140,106,158,30,74,176,96,172,99,
+186,8,160,121,137,140,130,27,129,132,132,130,118,171,76,169,101,31,253,41,
+6,14,247,242,250,37,247,173,21,199,253,41,7,169,177,171,202,160,26,148,132,
+146,129,130,137,138,118,121,30,103,97,99,107,86,107,8,86,108,139,139,127,
+26,132,143,136,162,126,30,220,92,173,112,181,91,8,123,152,144,135,149,27,
+147,147,147,147,157,102,213,114,169,31,14,247,242,249,94,247,172,21,123,119,
+129,123,127,117,8,129,121,125,101,132,26,130,147,132,149,148,142,141,159,
+155,30,179,186,171,164,229,193,8,156,148,141,142,147,26,148,133,145,118,150,
+30,83,167,76,189,102,183,8,152,129,131,146,134,27,126,131,133,129,120,176,
+65,164,109,31,252,63,6,164,169,177,214,157,26,149,131,145,127,134,135,136,
+122,124,30,112,105,70,83,99,118,8,99,117,132,134,131,26,131,142,134,148,134,
+30,239,79,161,122,186,86,8,118,158,140,138,148,27,149,146,146,148,159,107,
+200,108,179,31,14,251,42,247,110,37,21,199,249,41,6,109,177,202,107,160,27,
+148,146,146,149,148,138,141,118,157,31,97,175,107,179,107,192,8,192,108,139,
+139,127,27,132,136,135,116,126,31,92,58,112,105,91,97,8,123,126,135,134,129,
+26,131,147,131,147,157,212,176,164,170,30,14,251,42,247,110,249,105,21,253,
+41,7,164,109,65,176,121,27,131,131,131,131,129,143,134,155,126,31,187,97,
+166,105,186,58,8,116,152,142,135,146,27,151,140,140,172,158,31,176,204,172,
+182,186,179,8,160,157,140,141,148,26,149,132,146,130,118,76,107,109,101,30,
+249,41,7,14,251,42,247,111,247,22,42,29,251,42,247,13,71,21,96,247,155,182,
+7,251,57,247,150,42,29,251,48,248,67,249,124,21,77,6,251,163,252,8,247,5,
+252,8,5,201,6,247,163,248,8,5,251,181,251,204,21,45,247,204,247,119,247,204,
+233,251,204,5,14,247,232,247,87,248,236,21,247,192,252,197,247,192,248,197,
+5,14,93,247,199,248,155,21,251,39,251,9,251,6,251,35,251,38,247,7,251,8,247,
+37,247,35,247,8,247,8,247,36,247,33,251,8,247,10,251,31,31,14,247,242,250,
+8,248,153,21,75,251,73,252,195,6,247,102,221,116,191,251,178,251,19,5,62,
+7,247,178,251,20,162,191,251,102,221,5,249,3,6,14,251,209,197,247,130,21,
+247,66,251,232,5,123,147,149,132,151,27,147,144,143,146,146,137,147,136,147,
+31,251,23,247,221,247,23,247,221,5,142,147,141,147,146,26,147,134,143,131,
+127,131,133,121,129,30,14,251,209,247,167,247,130,21,251,66,247,232,5,156,
+130,130,146,127,27,131,134,135,131,133,141,131,142,130,31,247,23,251,221,
+251,23,251,221,5,136,132,137,131,132,26,131,144,135,147,151,147,145,156,149,
+30,14,82,248,39,248,28,21,251,105,6,65,247,77,5,45,6,247,125,252,213,5,222,
+6,247,125,248,213,5,45,6,34,251,157,21,63,251,72,64,247,72,5,14,251,42,247,
+191,247,184,21,251,148,247,217,5,129,117,134,119,118,26,120,146,123,159,114,
+30,209,52,83,34,5,121,106,129,110,120,26,119,148,116,159,104,30,165,96,139,
+139,128,26,121,126,129,117,30,121,78,221,6,227,161,154,198,179,130,158,84,
+213,31,105,185,127,166,169,26,158,143,151,158,174,30,247,191,252,12,5,149,
+160,144,157,159,26,160,131,157,114,171,30,100,188,5,102,186,129,160,172,26,
+157,142,153,151,171,30,183,245,5,161,6,161,149,129,114,143,31,148,170,143,
+165,168,26,190,122,159,95,30,71,6,101,125,150,171,31,155,7,110,108,125,106,
+100,26,112,147,114,153,127,30,128,149,153,136,170,27,179,6,14,251,118,190,
+22,247,217,248,213,251,217,55,247,133,251,54,251,133,55,247,133,251,55,251,
+133,6,14,208,248,227,248,236,21,109,135,110,131,117,30,113,130,127,129,118,
+27,121,132,150,203,111,31,118,189,122,167,117,158,8,167,106,96,154,90,27,
+251,16,36,42,251,9,81,160,93,182,101,31,176,107,170,125,200,130,144,176,24,
+89,149,114,149,113,160,8,106,166,118,184,183,26,222,209,210,219,194,172,109,
+50,183,30,74,171,171,114,190,27,213,180,197,243,31,151,7,163,251,230,21,133,
+169,134,155,131,157,8,184,118,105,163,93,27,66,74,78,70,115,146,108,151,112,
+31,182,43,139,139,140,113,8,102,141,104,108,95,27,100,111,156,183,107,31,
+94,202,139,139,134,144,124,157,116,156,116,150,8,152,112,108,146,109,27,130,
+6,138,104,174,127,154,129,157,111,25,196,48,139,139,165,111,8,103,174,178,
+120,180,27,186,201,162,173,184,31,181,172,160,172,175,26,163,138,142,101,
+224,30,116,190,132,162,160,26,168,161,161,168,179,162,112,74,155,30,14,247,
+20,247,8,151,21,155,149,147,146,150,27,149,148,136,134,146,31,108,186,139,
+139,166,27,178,180,168,188,172,31,168,183,154,197,208,26,196,7,140,146,145,
+139,142,27,161,152,136,132,149,31,152,131,142,131,151,91,181,251,60,24,95,
+150,154,116,158,27,172,182,169,188,178,31,126,153,5,135,128,134,137,133,27,
+118,128,152,177,130,31,110,247,3,123,196,126,160,110,157,25,233,172,179,176,
+192,26,219,75,200,55,83,94,118,94,96,30,181,112,93,164,88,27,41,61,56,34,
+78,157,110,198,106,31,178,117,157,118,114,26,133,138,131,137,129,30,150,136,
+5,172,178,151,163,165,26,161,125,156,108,155,30,84,167,139,139,131,146,8,
+118,156,128,161,165,26,193,179,180,191,200,176,86,50,30,129,7,129,7,251,40,
+7,83,136,114,129,110,30,119,132,125,122,130,27,133,133,142,144,131,31,156,
+115,126,145,119,27,98,112,110,74,117,31,247,195,247,251,21,222,137,151,127,
+182,30,160,168,157,145,170,27,194,178,103,89,106,120,108,109,123,31,110,124,
+121,133,77,124,8,14,230,208,249,10,21,247,149,253,10,5,227,6,247,151,249,
+10,5,251,195,252,164,21,251,74,248,91,5,248,1,6,14,101,143,22,248,240,6,251,
+151,249,10,5,51,6,183,37,21,247,75,252,91,5,252,1,6,14,211,247,253,210,21,
+68,221,5,248,131,97,252,82,7,87,199,5,82,6,247,114,251,154,247,114,247,154,
+5,82,6,87,79,5,248,82,97,252,131,7,14,211,247,253,248,213,21,210,57,5,252,
+131,181,248,82,7,191,79,5,196,6,251,114,247,154,251,114,251,154,5,196,6,191,
+199,5,252,82,181,248,131,7,14,38,247,4,191,21,91,76,234,76,236,247,18,5,247,
+165,6,164,247,12,5,251,99,6,232,247,12,87,29,164,247,12,5,66,6,192,208,44,
+202,37,251,24,5,251,160,6,114,251,12,5,247,93,6,46,251,12,5,251,26,6,114,
+251,12,5,14,72,248,230,247,172,190,10,201,247,182,190,10,81,251,172,190,10,
+14,38,249,54,250,37,21,251,187,253,168,251,2,248,32,251,55,66,150,106,243,
+185,247,27,252,133,247,245,250,68,5,14,252,12,247,80,248,159,21,176,133,218,
+130,232,236,29,142,138,128,149,30,129,149,151,134,152,27,166,160,161,167,
+169,111,163,104,96,108,108,81,125,31,123,75,134,70,251,69,26,251,120,7,95,
+143,78,149,34,193,10,149,141,10,14,93,247,244,251,97,21,248,250,7,183,135,
+200,129,243,236,29,141,138,128,150,30,130,149,150,134,153,27,165,161,161,
+166,170,111,163,104,95,108,108,81,125,31,123,75,134,66,251,65,26,252,242,
+7,14,93,247,171,249,180,21,252,250,7,95,143,78,149,35,193,10,148,141,10,248,
+242,7,14,38,247,49,247,132,21,188,174,160,153,172,27,157,144,137,115,200,
+31,120,186,236,10,160,161,179,197,80,178,24,98,106,118,126,106,27,118,130,
+141,162,86,31,158,92,111,147,114,27,71,93,104,40,76,31,152,251,139,21,188,
+175,159,153,172,27,158,143,137,115,200,31,120,187,236,10,159,161,180,197,
+79,178,24,97,106,119,127,105,27,118,131,141,162,85,31,158,92,111,147,115,
+27,71,92,104,40,77,31,14,38,248,165,247,1,29,247,25,249,4,21,252,164,251,
+73,114,232,29,247,231,247,5,5,14,38,248,174,247,1,29,252,95,247,32,180,10,
+251,231,251,5,5,14,73,249,12,248,12,21,252,140,6,78,251,182,5,247,11,6,175,
+247,62,5,248,21,6,14,208,248,235,248,247,21,69,251,164,6,251,5,134,95,123,
+107,30,86,112,80,103,76,27,84,84,167,183,110,31,115,176,132,183,247,17,26,
+247,164,69,251,161,7,251,41,144,101,166,95,30,69,181,215,98,229,27,222,209,
+172,201,184,31,175,188,145,175,247,54,26,14,208,248,235,22,247,161,7,247,
+41,134,177,113,183,30,209,97,62,180,49,27,56,70,106,77,94,31,102,90,133,103,
+251,54,26,251,161,209,247,164,7,247,5,145,186,157,173,30,189,166,197,173,
+200,27,196,194,110,93,168,31,162,103,145,98,251,18,26,251,164,7,14,247,242,
+249,147,247,108,21,200,252,98,7,145,246,195,189,247,1,137,8,207,10,66,44,
+26,251,8,184,56,247,0,10,201,251,183,6,251,1,137,83,189,133,245,8,14,247,
+242,248,106,248,234,21,252,173,251,161,78,248,234,200,251,160,248,173,7,14,
+202,248,55,247,189,21,109,174,128,150,121,155,8,168,107,99,155,101,27,50,
+56,57,52,74,185,93,205,197,194,167,218,241,31,55,215,176,116,194,27,230,222,
+220,227,204,93,185,75,99,91,123,110,95,31,117,124,133,135,81,96,8,168,106,
+21,199,213,196,169,182,27,179,171,107,101,83,84,85,82,111,121,147,169,102,
+31,116,158,129,149,121,162,8,68,22,113,117,128,131,103,117,8,110,92,115,130,
+110,27,98,107,170,179,196,193,191,197,180,185,108,80,186,31,14,247,242,249,
+62,247,59,21,90,140,109,156,86,197,8,192,185,176,161,182,27,145,200,127,6,
+79,81,103,73,89,31,207,85,81,173,80,27,61,83,82,58,59,192,84,217,191,192,
+164,184,179,31,147,147,144,144,155,158,195,70,203,102,199,142,8,251,121,247,
+30,21,135,134,139,139,133,133,8,92,93,106,121,98,27,99,112,169,185,185,167,
+168,184,173,162,127,94,187,31,149,130,139,139,148,130,8,14,247,242,249,120,
+247,165,21,252,117,88,248,117,6,64,4,252,117,89,248,117,6,96,247,230,21,92,
+97,121,128,103,27,122,127,142,158,77,31,160,69,121,143,113,27,86,96,114,87,
+103,31,179,108,5,187,181,152,148,174,27,159,139,139,115,222,31,116,212,141,
+139,168,27,199,182,165,191,168,31,14,247,242,249,121,247,20,21,103,110,109,
+103,103,169,110,175,174,169,169,174,176,110,168,102,31,252,125,22,103,247,
+11,10,174,176,110,168,102,31,247,138,248,133,21,102,247,11,10,175,175,110,
+168,103,31,14,247,238,247,128,251,48,21,62,54,247,143,6,138,224,5,64,249,
+171,247,254,253,171,69,6,140,54,5,247,132,224,66,249,171,240,224,253,143,
+54,243,6,14,247,238,249,106,249,126,21,252,127,56,6,247,85,251,232,251,85,
+252,6,5,54,248,135,247,125,45,7,137,251,30,5,251,178,6,247,79,247,254,251,
+78,247,218,5,247,170,6,143,251,30,5,230,6,14,251,26,247,176,247,184,21,218,
+205,188,187,171,182,8,191,209,170,216,196,26,192,107,172,89,32,56,251,35,
+251,209,64,30,105,109,113,117,123,129,8,118,124,131,131,131,26,133,148,130,
+146,148,176,163,165,172,30,124,41,137,121,107,26,82,173,105,195,184,174,160,
+183,172,30,154,160,148,159,151,26,146,132,145,130,128,132,134,125,131,30,
+93,111,122,124,113,27,121,131,148,158,165,161,247,10,160,226,31,151,194,21,
+247,157,195,175,226,195,27,161,153,122,113,109,126,90,120,98,31,108,72,95,
+83,62,73,8,14,251,48,245,249,50,21,172,213,139,139,177,27,185,178,121,105,
+163,31,173,92,160,64,65,26,110,137,116,131,79,30,192,70,112,151,85,27,90,
+100,123,105,105,31,93,92,111,72,74,26,251,1,222,54,246,215,200,180,216,182,
+30,177,207,167,247,22,243,26,247,92,251,3,247,37,251,45,94,92,129,121,99,
+30,247,191,252,54,21,126,51,131,106,124,95,8,61,112,94,95,84,27,83,106,190,
+225,247,8,205,234,220,181,176,118,99,165,31,14,247,242,248,139,249,75,21,
+251,92,134,29,251,85,31,135,251,208,21,251,82,247,80,5,184,194,204,162,209,
+27,208,203,116,96,196,31,179,99,21,187,82,162,76,66,26,67,116,75,93,83,30,
+251,84,247,87,5,247,44,251,127,21,95,84,72,115,69,27,69,75,162,186,80,31,
+247,85,247,85,5,251,125,251,45,21,95,193,116,203,209,26,211,162,203,186,196,
+30,247,82,251,80,5,14,174,247,205,248,38,21,251,14,67,76,60,58,26,113,146,
+111,155,97,30,88,64,124,106,98,26,85,176,99,188,193,182,192,206,179,124,186,
+98,224,30,178,188,178,178,195,185,8,192,201,176,158,175,27,173,161,109,95,
+85,115,62,105,89,31,100,114,101,115,106,27,108,111,160,162,152,146,146,153,
+140,31,161,141,154,154,158,26,155,127,151,122,110,115,108,101,93,175,107,
+190,189,196,172,194,186,30,180,186,161,195,194,26,208,99,185,81,60,72,92,
+251,56,251,49,30,130,158,136,157,161,26,214,178,193,233,194,30,251,56,251,
+224,21,180,64,156,95,106,26,108,118,117,109,102,112,170,182,178,146,155,189,
+215,30,14,247,242,248,61,141,21,137,161,145,139,173,27,247,172,201,251,183,
+6,123,6,247,109,248,6,5,229,201,86,6,167,187,97,164,96,66,5,251,62,224,10,
+251,16,190,53,229,110,30,111,90,180,113,5,247,126,248,131,21,251,105,251,
+255,5,68,158,105,197,240,26,247,21,191,195,247,13,30,14,247,242,249,23,248,
+53,21,252,68,252,53,5,248,214,181,252,105,6,247,244,247,234,5,14,247,242,
+247,125,201,193,29,247,3,143,10,84,251,13,31,14,247,242,249,147,201,21,251,
+183,6,251,13,87,194,153,10,67,43,26,251,7,184,55,247,0,10,6,14,247,242,247,
+125,247,58,193,29,247,4,143,10,83,251,13,31,247,135,251,3,21,252,170,84,248,
+170,6,14,247,242,249,147,247,58,21,251,183,6,251,13,87,195,153,10,66,43,26,
+42,167,72,198,93,30,107,179,176,130,229,27,247,172,6,90,4,252,170,84,248,
+170,6,14,247,242,248,164,247,108,21,247,131,200,251,96,6,227,247,47,5,247,
+8,201,58,6,172,198,97,163,92,56,5,251,35,224,10,251,8,184,55,220,105,30,106,
+82,182,116,177,206,5,136,165,151,138,181,27,247,172,201,251,183,6,119,133,
+139,140,130,31,170,247,45,21,58,251,33,87,157,108,190,136,211,25,247,182,
+247,108,21,51,251,47,5,251,94,6,145,246,195,189,247,1,137,8,14,211,218,247,
+187,21,221,210,5,248,188,181,252,139,6,182,10,248,139,181,252,188,6,14,211,
+249,23,247,187,21,57,68,5,252,188,97,248,139,172,29,252,139,97,248,188,6,
+14,211,247,41,248,44,21,182,10,248,61,172,29,252,110,97,21,248,159,6,221,
+68,57,68,5,252,159,6,57,210,5,14,41,248,154,251,110,247,7,10,184,247,103,
+170,10,251,209,249,20,249,254,170,10,247,242,234,185,21,179,91,247,12,239,
+5,67,206,228,100,235,27,247,83,247,47,247,50,247,86,214,117,209,98,199,31,
+247,3,232,99,187,251,4,46,5,210,64,66,169,45,27,251,83,251,47,251,50,251,
+86,68,157,78,177,77,31,187,180,21,111,189,127,186,194,26,247,55,247,19,247,
+24,247,47,215,198,114,82,200,30,178,91,21,170,89,155,83,79,26,251,54,251,
+19,251,24,251,47,60,66,172,198,86,30,14,93,248,22,120,29,248,82,249,106,21,
+251,42,6,94,251,102,114,251,201,5,207,6,246,247,201,5,60,252,6,122,29,251,
+188,188,247,23,21,247,148,247,148,251,148,6,14,251,188,188,247,23,21,247,
+148,247,149,251,148,6,247,96,251,97,21,251,44,247,45,247,44,6,14,247,221,
+189,22,250,4,205,253,194,249,184,73,6,14,252,46,247,123,246,10,14,251,63,
+247,147,246,10,247,96,247,148,21,65,6,85,251,148,5,196,6,14,93,150,22,248,
+219,248,37,6,251,184,247,220,251,183,251,220,5,190,251,242,21,247,220,7,247,
+132,247,162,247,133,251,162,5,251,220,7,14,247,10,160,22,247,204,6,166,247,
+17,105,164,127,150,123,157,25,114,169,126,181,191,26,247,75,247,5,247,35,
+247,35,235,202,76,43,57,105,40,88,75,30,108,100,119,122,63,95,112,247,11,
+29,251,62,6,211,181,169,163,171,178,8,193,204,171,234,229,26,247,47,251,7,
+245,251,60,251,124,251,91,251,87,251,120,82,155,91,171,103,30,152,124,151,
+128,173,113,8,251,62,6,14,247,242,248,98,247,134,21,34,101,177,74,223,212,
+120,251,3,5,219,6,120,247,3,223,66,177,204,34,177,244,176,101,204,55,66,158,
+247,3,5,59,6,158,251,3,55,212,101,74,5,14,247,242,247,125,247,108,21,248,
+98,6,134,33,82,88,251,1,142,8,251,183,77,247,172,6,222,174,146,164,177,31,
+205,183,171,211,241,26,247,0,92,224,62,218,29,247,1,141,196,88,144,33,8,252,
+98,6,14,89,248,184,247,132,21,146,7,148,7,137,213,134,168,124,178,8,222,105,
+58,190,40,27,251,41,44,251,0,251,62,251,60,230,37,247,43,247,6,215,192,242,
+171,31,141,144,141,146,5,75,6,138,137,137,134,138,136,8,79,112,83,105,66,
+27,96,104,150,160,115,31,123,154,130,155,128,174,140,233,24,247,172,194,21,
+251,170,220,6,207,171,174,163,206,27,193,175,123,100,172,31,150,126,143,132,
+145,122,8,14,247,232,249,178,247,229,21,252,202,247,92,5,252,36,7,14,247,
+232,247,85,247,229,21,248,202,251,92,5,248,36,7,14,239,247,149,249,25,21,
+252,89,137,10,247,240,7,247,181,95,5,252,3,137,10,248,82,7,14,211,32,10,14,
+211,56,10,99,217,206,29,247,254,95,29,252,148,6,14,160,121,22,249,86,6,34,
+249,109,5,251,78,6,251,81,252,240,21,247,149,248,96,200,252,96,5,14,156,33,
+10,14,100,53,10,14,211,94,29,247,20,248,247,248,43,21,251,159,6,118,41,5,
+247,159,6,80,248,68,21,251,9,35,92,50,61,31,62,53,90,251,22,251,7,26,251,
+70,247,12,251,11,247,69,247,14,240,186,232,221,30,214,225,184,247,14,247,
+9,26,247,75,251,7,247,8,251,74,30,127,114,29,14,51,10,14,211,93,10,156,134,
+22,247,50,6,247,196,248,193,206,252,193,5,247,40,6,35,249,109,5,251,51,6,
+14,247,75,89,29,211,41,29,14,146,173,22,248,225,95,29,252,225,6,214,247,81,
+21,248,147,95,29,252,147,6,144,247,57,21,248,214,160,10,252,214,6,14,247,
+20,59,29,207,203,206,29,247,180,6,251,20,252,240,5,247,43,221,29,252,225,
+6,14,156,71,29,79,160,22,248,199,160,10,252,13,6,247,179,247,142,251,73,247,
+124,5,247,230,6,164,247,14,5,252,159,6,115,251,3,247,74,251,122,251,180,251,
+149,5,14,100,80,29,14,156,40,29,14,247,64,247,238,125,21,247,17,6,158,228,
+216,143,196,154,197,171,25,242,195,204,247,2,247,9,26,247,22,50,231,251,40,
+162,30,158,228,5,251,17,6,120,50,67,136,84,125,82,108,25,251,0,82,72,32,251,
+9,26,55,181,62,209,95,30,176,115,172,128,193,129,8,164,247,9,21,65,154,97,
+190,216,26,201,170,201,190,176,30,170,161,165,149,189,146,8,247,17,22,214,
+125,181,88,62,26,76,108,78,88,102,30,108,117,113,129,88,131,8,14,156,92,29,
+247,71,247,233,22,247,39,6,167,247,22,247,88,144,232,212,183,247,75,25,148,
+179,147,179,147,179,186,247,110,24,251,42,6,92,251,110,110,251,32,127,105,
+110,106,25,105,106,101,123,98,27,240,248,111,5,251,39,6,38,252,111,5,78,140,
+100,177,196,26,163,139,139,166,247,29,30,186,247,110,146,10,92,251,110,5,
+121,54,130,78,105,26,69,179,75,205,103,30,174,119,170,131,191,136,8,14,247,
+23,248,2,54,10,14,109,248,201,247,157,21,247,61,247,167,98,29,66,233,10,86,
+27,67,73,101,73,92,31,89,68,111,48,50,26,251,24,206,54,241,196,196,165,183,
+179,182,29,106,76,131,125,121,111,8,91,108,95,108,103,27,108,117,186,204,
+247,16,201,247,2,208,191,167,89,251,4,151,31,14,110,165,251,110,21,224,29,
+191,247,139,5,104,176,190,121,198,27,247,35,247,14,247,23,247,44,210,109,
+180,67,168,31,224,184,181,198,215,26,236,61,202,251,12,54,67,112,88,92,30,
+99,96,121,98,118,40,8,247,35,153,21,152,200,147,162,156,161,8,166,159,175,
+157,174,27,183,168,111,96,91,110,89,99,119,31,121,130,120,135,101,137,121,
+57,24,140,146,149,139,141,27,174,160,134,126,157,31,164,120,155,106,106,26,
+44,66,57,54,102,105,152,162,114,30,14,45,247,58,251,110,21,247,24,6,187,247,
+120,247,203,248,166,146,10,251,87,252,20,104,248,20,5,251,40,6,225,252,166,
+5,14,99,248,13,248,168,21,58,136,89,119,86,89,8,73,77,97,36,41,26,251,26,
+229,54,247,34,234,225,179,212,197,30,186,198,172,238,224,26,212,110,195,67,
+204,30,251,14,247,3,5,247,122,6,163,247,3,5,252,35,6,118,42,5,247,44,251,
+108,21,198,175,95,65,91,123,83,113,96,31,87,107,92,110,88,27,81,102,183,209,
+247,19,217,244,233,31,14,251,63,248,9,247,203,21,50,140,109,152,181,26,183,
+179,171,194,193,164,118,93,141,30,247,32,150,6,240,57,200,251,27,69,89,124,
+108,97,30,96,106,115,93,89,26,97,153,108,168,116,30,99,125,121,128,120,117,
+8,115,112,124,99,102,26,46,217,82,247,16,220,211,29,80,107,103,116,79,27,
+92,112,159,174,169,157,167,168,152,31,159,148,157,141,218,140,8,14,251,50,
+247,106,248,252,21,247,89,6,49,87,86,96,80,70,8,56,43,93,36,46,26,49,197,
+87,247,5,127,30,186,135,5,181,134,152,132,120,26,111,114,94,59,251,8,30,247,
+23,6,216,247,6,172,211,193,26,162,128,163,122,152,30,121,152,122,144,91,145,
+102,143,24,77,146,125,142,123,149,8,122,149,128,164,166,26,215,194,243,227,
+231,30,210,212,205,186,236,184,160,239,24,252,17,6,14,100,71,10,14,47,248,
+59,249,118,21,42,56,91,51,84,31,81,48,94,251,64,251,17,26,76,159,74,172,97,
+30,95,174,194,115,206,27,237,215,189,243,202,31,190,224,183,247,62,247,3,
+26,247,48,67,225,251,24,30,251,59,251,212,21,152,196,145,160,152,170,8,201,
+163,185,175,193,27,194,167,106,73,109,136,113,130,87,31,119,46,21,124,68,
+130,110,121,98,8,79,112,96,105,88,27,87,108,176,202,176,143,170,154,206,31,
+14,101,29,14,55,247,166,247,222,21,184,247,102,164,10,175,247,59,216,209,
+217,251,129,5,247,39,6,251,11,247,216,247,135,247,108,5,251,62,6,14,45,155,
+22,247,38,6,247,80,247,236,188,251,236,5,247,38,6,251,28,249,109,98,29,181,
+251,130,5,14,92,247,67,206,10,251,53,253,138,5,247,25,6,195,247,155,5,96,
+151,163,119,181,27,191,180,164,200,183,31,124,71,5,220,10,251,32,6,67,251,
+230,5,73,125,92,99,76,27,88,107,166,182,149,141,153,141,152,31,211,247,229,
+5,14,45,247,241,22,247,193,248,176,5,251,43,6,251,85,252,31,106,248,31,5,
+251,37,6,213,252,176,5,14,251,92,247,252,251,110,21,216,247,10,171,208,190,
+26,161,129,162,124,152,30,123,153,116,147,100,143,72,146,24,98,144,122,143,
+125,147,8,121,149,128,162,164,26,181,163,180,177,164,30,161,172,177,146,220,
+27,203,160,29,77,6,52,97,163,190,175,165,175,176,156,31,151,166,164,143,191,
+27,228,160,29,252,34,199,29,221,6,85,100,115,101,90,26,89,165,104,191,119,
+30,80,125,109,124,107,109,8,95,99,112,78,78,26,87,160,94,175,112,30,167,119,
+172,129,193,134,183,134,24,180,135,139,139,150,131,8,144,135,143,131,132,
+26,109,111,89,62,32,30,14,100,70,10,14,201,249,161,206,10,253,7,221,10,216,
+235,29,247,92,235,29,209,6,14,94,151,251,110,21,224,29,199,247,175,148,122,
+143,131,148,129,25,107,166,188,118,190,27,247,42,247,21,247,51,247,78,247,
+33,53,226,251,32,61,69,110,86,85,31,87,87,114,83,114,251,7,8,247,189,247,
+83,21,198,171,99,65,251,17,67,32,54,84,100,184,201,193,156,202,166,186,31,
+186,166,182,167,185,27,14,153,248,145,206,10,147,103,122,141,112,27,55,60,
+107,84,86,31,75,72,99,38,41,26,251,26,229,53,247,33,222,217,169,193,195,30,
+197,195,176,226,219,26,200,123,182,102,179,30,247,7,222,10,251,208,35,21,
+200,174,97,64,92,123,83,115,97,31,84,106,94,110,88,27,78,103,182,210,247,
+18,216,245,232,31,14,251,133,247,27,22,224,29,230,248,64,5,247,5,222,10,252,
+9,221,10,247,12,6,14,80,35,10,14,193,247,193,226,21,112,142,126,143,125,150,
+8,111,159,123,178,186,26,234,184,234,205,182,30,157,226,5,251,50,101,34,251,
+29,251,63,26,85,153,96,170,105,30,175,97,187,120,221,133,95,251,97,24,247,
+23,6,183,247,97,230,145,198,161,196,188,25,214,203,185,243,246,26,247,30,
+45,211,251,73,114,124,138,136,114,30,247,1,38,21,167,136,151,135,154,129,
+8,166,120,156,99,92,26,84,120,79,109,96,30,105,91,103,117,83,133,8,14,67,
+247,239,247,187,21,79,247,137,5,251,38,6,247,4,252,3,251,180,252,27,5,247,
+47,6,247,76,247,165,207,251,165,5,247,40,6,251,14,248,31,247,158,247,255,
+5,251,44,6,14,247,15,247,166,251,110,21,247,25,6,182,247,96,5,223,190,151,
+172,193,31,209,185,164,183,165,247,19,201,247,184,24,251,32,6,79,251,177,
+117,251,3,95,90,56,137,25,234,248,83,5,251,25,6,44,252,83,5,76,142,112,165,
+197,26,155,143,170,145,167,30,199,247,177,98,29,77,251,184,5,133,107,135,
+109,114,26,100,156,98,168,110,30,181,97,181,122,218,132,8,14,247,76,45,29,
+14,251,10,248,232,247,224,21,138,199,131,170,117,175,8,197,103,69,172,52,
+27,56,71,110,81,86,31,84,80,105,51,59,26,251,0,199,59,247,2,99,30,190,120,
+5,186,122,148,131,113,26,120,131,120,115,101,30,102,82,139,139,123,116,8,
+247,23,6,215,247,14,155,175,184,26,162,131,159,122,155,30,124,154,119,149,
+88,158,88,158,24,59,169,107,179,207,26,242,208,227,220,194,171,104,80,138,
+139,134,138,135,30,14,80,213,247,194,21,119,46,5,179,126,6,99,150,97,160,
+101,30,73,175,198,106,220,27,225,212,180,216,192,31,188,209,171,218,157,233,
+159,140,24,155,140,160,235,120,135,136,139,119,138,25,140,157,139,157,147,
+26,221,122,197,101,183,30,191,95,76,166,62,27,251,15,54,66,34,251,9,247,5,
+54,247,71,120,31,121,54,127,99,119,99,8,84,112,98,110,89,27,84,111,174,210,
+172,141,162,147,189,31,247,151,247,23,21,251,15,154,76,180,204,26,184,171,
+168,190,207,181,90,61,117,137,122,134,110,30,14,246,247,159,251,110,21,247,
+23,6,182,247,97,227,144,186,153,191,173,25,226,197,195,247,1,247,4,26,215,
+103,208,79,176,30,106,159,111,149,84,147,165,247,16,24,251,23,6,113,251,16,
+52,134,88,124,85,102,25,55,80,85,251,0,251,3,26,63,172,75,197,102,30,173,
+117,168,130,197,130,8,161,239,21,107,143,124,144,123,152,8,115,160,125,174,
+181,26,203,163,207,178,183,30,171,175,172,156,187,143,8,247,23,22,168,136,
+153,135,154,127,8,166,119,154,102,95,26,80,117,74,104,95,30,106,98,106,121,
+87,133,8,14,247,76,247,123,248,71,21,111,110,129,125,124,114,8,104,80,118,
+63,73,26,34,204,67,232,188,184,158,176,183,30,102,167,176,120,187,27,247,
+26,247,17,247,37,247,48,221,106,210,80,182,31,175,89,66,157,36,27,251,180,
+6,117,34,5,247,156,22,247,63,206,99,36,91,122,82,112,97,31,109,120,120,126,
+116,27,114,122,162,174,155,141,154,145,167,31,162,247,1,98,29,116,251,1,130,
+93,129,116,124,120,25,120,124,122,130,121,27,108,123,163,187,204,161,208,
+173,187,31,163,171,161,159,180,165,8,14,101,29,189,249,123,88,10,80,35,10,
+247,67,248,161,88,10,251,209,248,21,249,169,57,29,251,209,247,165,105,10,
+211,32,10,251,59,247,66,57,29,247,96,248,67,247,206,21,247,241,160,10,251,
+240,6,174,247,57,5,248,14,160,10,252,164,129,29,57,248,240,57,29,247,148,
+249,97,247,223,21,68,251,223,205,29,251,42,6,81,251,165,5,251,181,223,29,
+251,42,130,10,210,247,223,5,251,18,248,34,57,29,251,69,248,151,77,29,84,249,
+109,57,29,247,86,248,227,61,29,251,195,247,8,57,29,247,89,248,56,54,10,251,
+34,249,109,214,29,247,172,249,41,247,1,10,251,98,251,207,57,247,207,5,251,
+60,6,247,37,252,95,82,251,162,119,29,251,160,249,109,57,29,51,10,223,250,
+46,88,10,156,40,29,212,250,46,88,10,109,248,202,247,157,21,247,61,247,167,
+98,29,65,233,10,87,27,68,74,101,73,92,31,91,68,111,48,50,26,251,24,204,54,
+239,195,197,165,183,178,182,29,96,56,124,115,119,116,8,105,109,107,119,114,
+27,106,119,182,210,191,152,195,161,187,31,187,162,173,167,173,27,191,168,
+89,251,4,150,31,180,248,151,57,29,251,63,248,9,247,203,21,54,140,112,152,
+181,26,183,176,171,191,192,164,118,93,140,30,224,29,140,144,139,144,140,26,
+240,57,200,251,26,71,89,124,108,99,30,97,106,116,93,88,26,98,151,108,163,
+116,30,102,125,121,128,121,117,8,117,113,125,98,102,26,46,214,82,247,13,219,
+211,29,81,107,102,115,81,27,96,114,159,174,169,157,167,166,152,31,159,148,
+155,141,215,140,8,233,248,204,57,29,100,71,10,247,116,196,10,101,29,247,41,
+249,169,57,29,100,70,10,247,8,247,245,57,29,247,76,45,29,251,27,196,10,80,
+35,10,247,165,248,207,21,37,6,118,39,148,40,5,179,6,192,238,5,14,101,29,176,
+105,10,80,35,10,247,54,248,161,108,10,211,248,175,247,39,21,156,251,39,5,
+247,36,6,51,249,109,5,251,67,6,252,50,253,109,5,247,55,6,219,247,39,5,247,
+151,247,17,21,251,83,6,247,49,247,177,5,14,197,208,22,247,243,6,228,188,150,
+171,187,31,206,183,181,216,218,26,247,6,55,221,251,9,30,251,94,6,174,247,
+57,5,248,15,95,29,252,165,6,161,252,240,21,179,247,81,5,247,106,6,177,164,
+111,96,76,91,84,84,31,14,211,218,22,247,221,6,247,5,198,155,185,195,31,190,
+180,171,209,206,26,197,113,180,71,187,30,227,176,183,197,220,26,241,64,203,
+251,11,30,251,221,6,247,15,251,17,21,247,56,6,199,169,118,97,108,123,107,
+113,121,31,124,119,111,133,97,27,251,49,6,113,251,17,21,247,70,6,202,170,
+116,93,67,87,91,61,31,251,74,6,14,103,225,206,29,247,197,95,29,252,91,6,14,
+211,112,251,28,21,247,42,6,168,247,28,5,248,41,6,110,251,28,119,29,194,247,
+153,5,73,6,247,20,248,240,5,252,97,6,43,252,85,123,53,57,71,52,138,25,114,
+6,248,125,22,251,137,6,198,173,183,196,151,197,209,247,222,24,247,53,6,14,
+156,99,29,14,247,169,248,25,22,247,41,6,210,247,223,5,247,2,151,10,38,223,
+29,251,41,6,81,251,165,5,251,13,200,29,247,59,6,247,96,247,223,5,238,6,14,
+132,247,10,247,134,21,133,111,5,135,119,137,122,125,26,33,238,59,247,23,247,
+58,247,17,247,6,247,44,201,62,10,14,208,52,29,14,104,195,22,247,3,10,240,
+151,10,48,223,29,251,41,6,14,176,136,167,29,247,42,221,29,252,167,6,251,13,
+252,205,5,115,133,124,128,117,27,86,6,14,247,75,247,224,248,204,21,149,252,
+204,119,29,247,142,248,204,251,13,252,204,205,29,251,118,6,251,143,252,216,
+130,248,216,5,251,116,130,10,14,211,247,178,247,10,10,247,42,221,29,251,42,
+6,81,251,165,5,251,181,6,197,247,165,247,13,10,247,20,87,10,125,251,20,114,
+10,208,211,22,247,42,6,247,21,248,242,5,247,168,6,251,21,252,242,205,29,252,
+212,6,14,156,247,166,247,152,21,247,79,6,218,201,163,192,191,31,190,189,171,
+222,222,26,191,118,190,105,167,30,166,108,83,157,90,27,251,214,130,10,221,
+248,21,21,185,247,111,87,29,206,170,115,88,106,129,104,122,115,31,103,115,
+102,123,83,27,14,211,249,162,248,118,21,141,158,140,147,150,26,247,22,251,
+2,230,251,51,251,8,40,93,48,63,30,64,49,93,251,24,251,17,26,54,169,62,191,
+90,30,94,185,209,115,221,27,242,231,175,204,204,31,189,189,170,196,150,203,
+8,251,42,6,46,110,71,86,46,27,50,88,196,239,223,164,231,181,204,31,214,186,
+202,176,216,27,213,189,99,79,132,138,127,138,127,31,14,100,248,149,248,240,
+21,247,105,95,29,252,220,133,29,247,113,6,251,20,252,240,119,29,14,166,97,
+29,14,247,23,247,191,22,247,43,6,160,240,5,225,6,205,203,167,186,181,31,190,
+196,173,230,221,26,247,24,70,229,38,30,73,6,160,240,5,251,43,6,118,38,5,60,
+6,251,30,251,6,251,29,251,59,251,26,205,50,237,31,199,6,218,248,38,21,83,
+251,169,5,88,6,108,119,180,203,235,187,215,198,31,247,99,22,197,6,173,160,
+99,75,44,89,61,78,31,81,6,14,156,100,10,247,59,6,14,218,207,22,248,118,6,
+106,251,48,119,29,199,247,173,5,72,6,247,21,248,240,164,29,197,248,131,22,
+247,42,91,29,247,42,201,195,148,159,204,30,14,247,221,206,22,249,225,221,
+29,251,42,6,251,20,252,240,5,251,90,205,10,251,20,252,240,5,251,89,185,29,
+247,231,202,22,249,132,6,105,251,53,119,29,200,247,178,5,72,205,10,251,20,
+252,240,5,251,85,6,247,21,248,240,146,10,251,21,252,240,5,251,84,185,29,197,
+233,77,10,14,247,242,247,9,77,10,247,171,251,17,21,247,42,221,29,251,42,6,
+14,247,96,247,55,199,10,112,251,17,5,247,138,6,251,20,252,240,5,247,191,6,
+232,149,10,251,21,252,240,21,182,247,94,5,247,45,175,10,208,248,236,247,206,
+21,251,27,96,58,65,34,27,48,90,191,247,2,128,31,251,40,95,5,251,50,165,244,
+51,247,54,27,247,10,241,189,234,216,31,208,225,181,247,10,247,1,26,247,81,
+251,1,247,9,251,68,57,59,113,93,74,30,101,111,110,110,97,84,247,18,71,24,
+224,196,202,178,219,27,199,186,112,91,159,31,151,111,143,117,90,26,251,189,
+6,113,251,17,5,14,248,28,248,10,247,223,21,138,119,138,127,123,26,251,81,
+247,4,251,9,247,74,247,14,247,2,191,230,214,30,210,228,181,247,8,247,4,26,
+228,114,213,90,194,30,197,87,70,167,45,27,251,67,251,42,251,1,251,68,72,31,
+32,113,29,248,148,247,174,114,10,218,248,134,22,247,42,221,29,251,239,6,69,
+72,113,94,88,31,86,92,105,65,74,26,76,168,85,186,112,30,83,137,98,97,124,
+71,114,251,13,24,121,77,124,116,107,129,8,247,44,6,170,149,158,164,152,188,
+165,247,25,24,148,182,157,153,183,140,8,247,82,6,165,247,17,21,251,66,6,91,
+110,167,187,208,194,198,205,31,247,66,6,14,64,248,201,199,10,251,179,130,
+10,247,20,248,240,5,247,141,6,166,247,17,247,6,247,14,5,251,25,6,14,247,128,
+247,147,22,247,42,6,201,247,184,153,155,147,148,149,147,25,163,167,182,152,
+187,27,201,168,122,101,134,138,129,136,129,31,118,36,130,106,110,117,104,
+140,25,67,6,113,251,17,5,247,20,6,233,212,200,234,160,31,170,247,41,5,143,
+154,140,152,152,26,192,109,191,97,159,30,152,113,98,146,95,27,62,97,124,86,
+71,31,177,247,73,5,247,112,160,10,252,185,133,29,247,72,6,14,208,248,191,
+247,206,21,165,247,17,5,251,192,6,161,188,153,163,163,166,8,187,181,197,166,
+199,27,218,185,99,53,160,31,247,31,201,5,247,16,105,44,206,251,36,27,251,
+15,38,89,38,61,31,71,51,95,251,22,251,4,26,251,62,247,2,251,5,247,57,247,
+56,247,10,215,247,58,235,30,251,32,187,5,251,2,82,68,87,47,27,53,83,200,234,
+151,140,160,141,159,31,14,156,249,94,248,143,21,143,166,140,152,154,26,195,
+116,185,97,167,30,170,92,69,157,63,27,52,59,114,95,85,31,82,94,104,64,62,
+26,58,192,92,247,9,115,30,236,120,5,223,122,172,115,93,26,68,71,92,37,53,
+87,174,196,145,140,150,140,149,30,251,38,6,136,117,138,129,123,26,251,10,
+243,64,247,56,247,0,233,170,193,193,30,189,188,170,212,207,26,227,88,193,
+37,159,30,251,2,161,5,48,157,109,157,176,26,205,199,183,227,217,187,106,86,
+133,138,129,137,129,30,14,248,5,247,14,10,248,5,247,14,10,248,5,247,14,10,
+45,248,131,199,10,251,6,252,171,5,81,126,104,108,85,27,98,115,157,171,149,
+141,154,142,153,31,155,215,146,10,123,63,5,134,117,137,121,122,26,96,159,
+97,174,108,30,110,173,188,124,200,27,210,204,159,174,186,31,183,172,164,186,
+155,214,247,8,248,178,24,14,248,80,155,167,29,247,192,113,10,251,39,6,198,
+247,169,5,252,167,6,251,13,252,205,133,115,124,127,117,140,25,86,6,249,0,
+22,182,247,94,5,247,45,6,168,153,226,29,79,30,14,248,28,247,168,247,223,21,
+247,167,6,69,251,223,5,247,175,113,10,251,22,6,198,247,169,146,10,81,251,
+165,5,251,167,223,29,251,42,130,10,248,87,247,17,21,182,247,94,5,247,29,175,
+10,247,96,247,96,22,247,42,6,201,247,184,5,191,183,175,157,201,27,193,167,
+121,104,133,138,129,136,128,31,79,251,174,119,29,204,247,197,5,143,157,141,
+155,152,26,186,108,191,100,158,30,152,114,99,147,99,27,71,97,123,87,71,31,
+178,247,73,5,247,102,95,29,252,169,133,29,247,65,6,14,208,216,22,247,100,
+6,106,251,51,119,29,172,247,51,5,247,100,222,29,164,29,247,20,87,10,251,165,
+252,79,21,248,21,6,251,12,95,51,66,38,27,44,82,203,247,0,31,165,247,38,21,
+247,12,185,225,209,240,27,240,190,75,251,18,138,31,14,248,112,248,98,22,247,
+42,6,210,247,223,5,247,19,6,202,251,223,5,190,6,106,251,49,119,29,199,247,
+174,5,38,6,88,247,159,229,10,251,10,223,29,251,42,6,81,251,165,5,251,21,200,
+29,247,58,6,247,97,247,223,5,246,6,14,156,40,29,14,247,20,247,24,248,59,21,
+119,80,131,91,84,26,67,157,77,174,90,30,71,186,215,106,244,27,247,16,247,
+0,189,235,222,31,219,233,186,247,14,247,10,26,247,71,38,244,251,65,251,36,
+251,12,76,251,18,48,30,247,9,75,5,227,199,202,176,224,27,238,193,78,251,2,
+137,139,129,138,132,31,113,251,17,21,251,16,90,55,70,35,27,41,81,204,247,
+0,31,159,7,14,206,248,8,77,29,214,247,244,5,157,212,208,150,186,27,208,179,
+112,94,127,139,138,137,132,31,78,251,181,119,29,201,247,181,5,142,157,141,
+155,159,26,242,47,202,251,42,77,83,130,119,74,30,14,248,132,248,70,22,247,
+11,6,247,46,249,109,5,251,16,6,32,252,142,251,31,248,142,5,251,15,6,251,46,
+253,109,5,247,17,6,247,0,248,150,5,247,253,252,150,21,248,69,6,159,234,5,
+252,69,6,247,229,249,26,21,56,64,96,60,87,31,100,79,108,251,4,56,26,251,9,
+213,61,247,2,223,212,181,218,192,30,179,199,170,247,4,224,26,247,8,65,217,
+251,3,30,107,251,5,21,190,136,167,98,68,26,251,17,75,33,62,90,108,182,210,
+247,18,206,247,2,214,135,30,14,251,63,247,210,248,75,21,174,247,57,5,247,
+141,95,29,252,35,6,77,251,182,5,91,6,113,251,17,5,187,6,72,251,206,119,29,
+206,247,206,5,247,80,95,29,14,156,248,106,247,131,21,145,171,247,221,248,
+94,5,251,60,6,251,99,251,213,58,247,213,5,251,59,6,247,36,252,94,133,107,
+5,251,23,133,29,247,23,6,115,251,6,119,29,163,247,6,5,247,23,95,29,14,156,
+99,29,247,132,249,175,90,10,14,208,52,29,247,57,247,70,21,136,121,137,123,
+127,26,109,152,110,162,117,30,119,162,171,129,187,27,195,182,155,173,178,
+31,172,168,152,162,154,194,8,50,6,88,119,110,116,95,27,113,118,151,160,130,
+31,134,148,138,149,161,26,14,103,218,206,29,247,205,160,10,252,98,6,247,65,
+197,21,247,3,6,247,7,247,14,5,251,25,6,14,51,10,222,250,44,66,10,111,199,
+22,247,3,10,241,151,29,47,223,29,251,41,6,247,81,204,21,247,4,6,247,5,247,
+5,5,251,27,6,14,166,97,29,247,152,249,186,21,136,120,137,122,127,26,110,153,
+109,162,117,30,117,162,173,129,186,27,197,185,155,174,178,31,173,169,153,
+162,154,196,8,48,6,87,118,109,115,93,27,99,113,167,179,142,31,141,139,141,
+140,143,30,14,208,52,29,248,98,247,52,68,29,166,249,40,250,1,247,5,10,252,
+200,253,177,21,100,29,14,167,248,10,248,92,21,79,113,29,199,6,110,251,32,
+5,218,6,169,247,32,5,167,6,202,161,10,121,6,169,247,32,5,60,6,14,217,206,
+22,247,42,6,209,247,223,5,244,6,202,251,223,5,190,6,104,251,48,119,29,200,
+247,173,5,39,6,88,247,159,247,78,246,29,45,223,29,251,42,6,14,211,247,179,
+247,10,10,205,6,105,251,49,119,29,200,247,174,5,73,205,10,81,251,165,5,251,
+181,6,197,247,165,247,13,10,206,100,10,206,6,104,251,49,119,29,201,247,174,
+5,251,20,6,14,206,248,69,247,116,21,170,142,158,143,209,157,86,251,141,24,
+247,42,221,29,251,42,6,65,251,244,95,127,103,132,98,134,25,170,247,39,5,60,
+6,107,251,44,5,73,144,107,163,182,26,146,140,146,140,145,30,195,10,75,175,
+87,202,112,30,173,125,178,131,191,138,111,251,27,24,218,6,14,206,248,136,
+22,205,6,104,251,48,119,29,201,247,173,5,73,205,10,65,251,244,5,120,64,77,
+129,87,27,70,98,166,184,146,140,146,140,145,31,210,10,123,26,33,227,78,247,
+42,198,168,143,164,238,30,14,156,33,10,247,51,249,191,159,29,208,52,29,247,
+63,247,99,198,10,95,247,42,5,14,247,64,247,129,248,197,21,251,11,252,197,
+5,247,241,113,10,251,88,6,162,247,1,5,247,46,6,156,219,5,251,46,6,158,227,
+146,10,120,51,5,251,29,180,29,247,86,252,72,21,182,247,94,5,247,95,200,10,
+79,30,14,247,20,248,174,92,10,78,251,233,21,161,110,112,148,101,27,107,109,
+134,127,96,31,247,18,184,227,212,247,0,27,240,198,73,251,3,118,137,121,136,
+117,31,127,96,105,133,110,27,115,119,145,150,125,31,247,38,70,21,251,19,96,
+53,66,33,27,35,77,206,247,2,159,141,157,142,161,31,147,171,162,142,165,27,
+179,164,131,116,169,31,99,191,146,136,172,27,172,183,148,156,190,31,14,247,
+26,250,10,249,106,21,151,106,114,143,106,27,60,89,104,53,95,31,251,122,252,
+87,77,248,195,5,251,41,6,246,253,109,119,29,247,203,248,228,5,168,154,164,
+154,169,27,155,149,136,128,157,31,14,132,247,241,116,21,247,52,145,247,10,
+247,5,247,38,26,202,62,10,251,42,6,133,111,5,135,119,137,122,125,26,44,219,
+63,247,7,126,30,84,54,5,70,29,128,137,134,123,31,14,104,247,77,248,240,21,
+251,21,252,240,5,247,3,10,240,151,29,48,223,29,252,27,133,29,14,211,248,24,
+116,21,247,71,141,247,25,242,181,247,59,8,251,35,6,47,110,68,87,43,27,42,
+89,193,244,222,74,10,247,33,6,138,29,33,190,51,222,102,30,168,127,170,131,
+178,134,84,54,24,244,10,157,10,116,160,99,123,128,137,135,123,31,14,197,248,
+158,247,17,21,54,6,81,251,173,119,29,171,247,48,5,223,91,29,247,43,200,196,
+148,159,203,30,14,45,248,163,156,21,126,156,134,152,152,26,146,140,146,141,
+148,30,202,247,192,5,143,154,140,152,153,26,171,122,173,115,158,30,165,105,
+89,152,66,27,50,78,121,99,95,31,101,103,115,96,131,89,8,247,28,6,193,153,
+170,159,206,27,186,163,125,112,123,133,123,127,128,31,122,122,129,136,56,
+126,82,129,24,78,130,97,120,106,108,8,100,102,117,87,85,26,58,191,90,226,
+204,191,162,193,194,30,137,124,138,134,132,26,129,141,133,145,128,30,247,
+45,6,251,16,247,109,21,58,122,89,93,68,27,98,116,157,171,161,149,160,155,
+155,31,156,155,153,145,179,147,190,148,24,176,146,147,141,156,147,8,14,108,
+248,196,249,227,21,120,64,116,111,82,124,251,11,103,79,101,79,60,8,67,46,
+79,251,72,251,13,26,251,16,230,58,247,31,236,226,179,210,195,30,188,201,172,
+240,228,26,247,15,51,225,251,17,82,91,121,101,94,30,164,205,184,166,247,19,
+165,247,32,168,185,187,178,247,50,8,251,190,252,47,21,198,176,95,68,90,125,
+85,114,97,31,83,107,93,109,86,27,80,102,183,209,247,19,216,244,232,31,14,
+93,221,22,247,203,6,190,194,158,168,173,31,174,170,163,191,186,26,188,112,
+174,85,158,30,174,152,155,148,156,155,8,167,165,155,177,178,26,207,87,189,
+69,30,251,196,6,188,252,63,21,164,247,12,5,247,24,6,167,157,120,110,101,106,
+105,101,31,51,247,101,21,162,247,0,5,247,24,6,162,152,124,114,102,112,108,
+107,31,14,251,8,207,179,29,247,145,160,29,252,29,6,14,107,130,251,4,21,247,
+32,222,10,247,193,221,10,224,29,187,247,117,5,88,6,230,248,63,5,252,32,6,
+75,251,189,5,61,124,97,87,91,27,83,6,248,26,22,251,70,6,188,173,167,184,155,
+209,175,247,57,24,247,8,6,14,45,66,29,14,225,248,74,22,189,247,131,5,221,
+6,169,196,29,251,2,251,80,5,77,235,10,66,152,29,202,6,89,251,131,5,14,251,
+32,218,247,71,21,136,118,137,119,126,26,50,214,80,247,3,247,28,246,225,247,
+0,65,10,14,100,52,10,14,251,35,247,59,136,10,210,6,178,251,131,5,247,31,6,
+91,247,193,170,29,111,169,227,29,247,37,6,48,252,63,5,220,10,252,61,225,29,
+14,229,249,39,22,247,7,248,176,5,251,81,6,251,81,252,41,127,248,41,5,251,
+80,6,251,7,252,176,5,247,23,6,227,248,48,151,252,48,5,247,3,6,247,82,248,
+48,51,252,48,5,14,93,202,10,224,29,247,7,248,176,174,10,100,105,29,129,251,
+5,21,197,176,94,69,90,125,86,114,96,31,84,107,91,108,87,27,238,29,100,215,
+179,29,247,70,6,48,252,63,5,220,10,252,94,6,14,100,247,207,248,176,223,10,
+251,53,253,138,87,29,199,247,174,5,79,161,183,112,212,27,223,212,178,212,
+192,31,188,206,167,233,231,26,247,14,68,224,37,71,83,110,79,94,30,141,29,
+45,248,232,247,230,21,140,154,140,153,149,26,178,124,179,112,169,30,182,101,
+88,159,65,27,56,70,110,82,85,31,77,74,95,251,13,36,26,251,11,223,62,247,24,
+217,199,161,186,187,30,179,178,165,183,156,196,8,251,35,6,71,109,106,111,
+88,27,84,109,174,205,193,154,200,165,187,31,194,168,176,165,189,27,187,170,
+112,98,129,138,132,136,126,31,14,247,131,248,11,179,29,247,112,160,29,252,
+240,199,29,247,136,6,14,45,96,29,14,247,127,247,219,251,110,21,224,29,185,
+247,110,5,211,182,147,163,193,31,247,10,192,218,247,9,247,14,26,247,19,35,
+229,251,39,138,30,180,247,88,98,29,98,251,88,5,66,99,132,119,89,31,251,15,
+87,59,251,7,251,21,26,45,198,64,240,105,30,127,173,156,137,179,27,163,247,
+5,21,98,142,121,143,117,152,8,104,158,119,177,184,26,192,167,194,188,178,
+30,174,168,170,150,199,144,8,247,32,22,180,137,158,134,161,127,8,173,120,
+159,102,96,26,80,108,79,88,101,30,105,113,109,130,82,135,8,14,45,248,51,103,
+10,247,55,6,14,135,226,22,248,5,6,105,251,47,87,29,197,247,160,5,83,154,10,
+247,177,214,22,249,62,6,104,251,49,87,29,198,247,162,5,83,6,229,248,63,118,
+10,196,247,21,206,10,115,251,5,5,247,71,6,48,252,63,5,247,175,186,29,251,
+35,6,182,247,92,5,48,252,63,21,163,231,10,105,31,14,247,96,240,90,29,247,
+103,251,5,21,220,10,251,32,6,14,83,221,90,29,14,41,247,110,247,118,21,247,
+107,6,52,109,83,90,72,27,103,108,157,169,124,31,130,155,136,152,137,168,251,
+33,104,24,148,88,149,113,159,111,8,89,176,208,110,221,27,232,225,175,200,
+191,31,196,205,175,239,230,26,247,26,51,223,251,34,37,53,96,56,77,30,247,
+7,77,5,191,176,178,162,189,27,194,183,92,82,136,31,138,128,5,251,103,6,14,
+247,107,247,229,247,119,21,137,125,139,132,128,26,251,29,224,58,247,37,233,
+224,177,205,194,30,193,204,173,237,228,26,247,26,53,221,251,34,251,32,36,
+66,251,28,86,30,45,6,182,247,92,164,10,187,247,119,5,248,40,247,101,21,197,
+176,94,69,251,17,61,33,46,238,29,78,248,12,22,220,10,251,191,6,251,10,51,
+61,34,88,158,104,182,111,31,95,119,121,115,127,85,132,106,24,126,89,123,106,
+113,110,8,247,36,6,159,163,152,171,148,184,147,173,24,188,149,160,156,189,
+27,231,6,163,247,5,21,251,33,6,115,125,154,166,179,166,170,174,31,247,33,
+6,14,251,75,248,89,206,10,251,161,6,251,7,252,176,87,29,230,248,63,5,247,
+110,6,163,247,5,247,59,247,50,5,251,25,6,14,100,247,34,22,224,29,186,247,
+113,5,175,176,164,152,167,27,165,155,126,120,129,139,138,138,133,31,96,251,
+94,132,101,108,112,102,138,25,43,6,120,46,5,247,16,6,247,10,145,207,197,163,
+247,8,178,247,73,24,142,153,140,152,154,26,204,91,183,69,96,102,126,106,84,
+30,182,247,96,5,247,26,6,159,232,5,251,26,160,29,251,32,199,29,33,6,119,46,
+5,245,6,14,52,248,69,247,118,21,159,234,5,251,103,6,208,165,197,185,200,27,
+188,168,115,88,153,31,247,24,197,126,170,127,157,122,157,25,178,100,74,163,
+68,27,52,57,104,78,82,31,82,77,101,36,46,26,79,163,77,177,102,30,101,178,
+199,118,208,27,214,208,163,186,196,31,179,171,160,167,161,190,251,24,176,
+24,68,104,91,104,78,27,84,100,184,201,148,139,148,140,150,31,14,45,248,221,
+248,2,21,141,163,139,140,146,26,231,56,198,251,20,70,80,120,103,94,30,93,
+103,109,80,87,26,90,171,102,197,120,30,247,48,88,5,163,130,152,125,120,26,
+100,95,116,66,78,108,157,173,145,139,142,141,148,30,251,32,6,137,126,139,
+133,131,26,39,214,86,247,30,235,214,164,186,187,30,176,175,163,192,182,26,
+185,108,180,93,153,30,251,57,191,5,112,147,124,156,160,26,174,177,163,194,
+194,171,120,105,132,138,135,135,130,30,14,247,216,248,176,89,10,14,247,218,
+248,176,223,10,251,20,252,238,5,105,132,127,130,99,27,123,199,29,154,6,192,
+6,196,162,144,154,163,31,168,158,160,173,149,187,8,247,67,249,206,223,10,
+113,251,17,87,29,14,247,211,172,227,29,247,62,6,49,252,63,5,247,196,186,29,
+251,56,6,182,247,92,5,252,87,225,29,248,176,22,163,247,6,5,247,49,6,163,155,
+123,113,100,109,106,105,31,14,247,148,209,209,29,186,10,55,30,251,35,6,181,
+247,92,185,10,248,20,252,63,21,164,231,10,104,31,14,100,234,22,224,29,202,
+247,187,5,199,181,178,165,189,27,180,164,114,98,132,138,132,138,133,229,29,
+152,140,152,152,26,210,75,197,62,82,90,120,90,68,30,163,247,7,5,247,29,6,
+159,232,5,251,29,6,160,240,98,29,118,38,5,36,6,119,46,5,242,6,14,100,218,
+22,247,48,6,107,251,49,87,29,171,247,49,5,247,49,6,247,7,248,176,175,29,100,
+105,29,251,73,251,225,21,247,138,6,57,106,86,95,74,27,81,102,183,207,31,159,
+247,0,21,221,172,192,183,204,27,175,171,119,109,153,31,149,117,142,120,104,
+26,14,72,248,21,22,247,34,91,10,236,193,193,148,156,188,30,14,247,131,201,
+22,249,146,6,247,6,248,176,118,10,247,138,248,131,22,190,247,131,5,223,6,
+178,251,131,5,184,6,100,251,53,87,29,202,247,166,5,50,6,110,247,80,232,10,
+65,235,10,56,152,29,212,6,88,251,131,5,14,32,248,147,217,29,221,252,176,93,
+251,110,87,29,185,247,110,247,199,248,176,5,14,64,238,247,192,21,128,90,135,
+104,102,26,251,13,226,58,247,22,224,218,177,207,193,30,192,205,173,241,235,
+26,247,17,57,216,251,24,251,12,44,77,251,5,87,30,247,36,6,180,163,179,162,
+188,27,195,170,109,84,122,137,125,134,117,31,118,46,21,58,112,96,100,76,27,
+87,106,172,192,149,140,148,141,154,31,14,74,221,22,224,29,202,247,187,5,200,
+181,178,165,189,27,180,164,114,98,131,138,133,138,132,229,29,153,140,152,
+151,26,210,75,198,62,82,90,120,89,68,30,204,247,201,98,29,14,251,142,247,
+164,247,213,21,162,245,5,247,82,160,29,251,222,6,92,251,111,5,95,6,119,44,
+5,183,6,91,251,118,87,29,187,247,118,5,247,52,6,159,234,5,14,32,247,240,22,
+247,199,248,176,5,251,36,6,245,29,221,252,176,5,32,6,119,44,5,246,6,113,251,
+15,87,29,165,247,15,5,246,6,159,234,5,14,45,66,29,80,248,58,66,10,100,52,
+10,247,29,247,78,21,136,123,137,125,129,26,88,190,100,205,186,184,157,171,
+172,30,163,161,147,156,149,180,8,71,6,98,126,116,124,91,27,99,117,153,165,
+31,140,155,5,14,251,73,202,179,29,247,117,160,29,252,1,6,247,24,197,21,228,
+6,247,60,247,50,5,251,26,6,14,43,10,188,249,121,66,10,251,35,247,64,136,10,
+209,6,178,251,131,5,247,30,6,92,247,193,232,10,79,6,179,247,80,5,166,197,
+21,231,6,247,57,247,50,5,251,23,6,14,45,96,29,251,252,247,91,21,136,123,138,
+125,128,26,86,190,100,208,186,185,157,171,172,30,162,162,148,157,150,181,
+8,70,6,95,124,119,126,88,27,96,119,152,166,143,139,146,140,145,31,14,100,
+52,10,248,31,247,30,68,29,45,248,198,249,72,21,251,192,180,29,247,193,6,106,
+67,104,10,14,48,247,216,247,244,21,93,6,179,247,80,164,10,190,247,131,5,185,
+6,113,251,12,5,199,6,165,247,12,179,251,131,5,247,35,6,91,247,193,247,34,
+247,131,5,251,35,6,251,2,251,80,164,247,12,5,79,6,14,94,247,71,136,10,211,
+6,178,251,131,5,184,6,104,251,52,87,29,198,247,165,5,50,6,109,247,80,170,
+29,92,202,10,195,6,103,251,51,87,29,199,247,164,5,83,6,230,248,63,174,10,
+78,248,45,103,10,209,6,106,251,51,87,29,196,247,164,5,251,14,6,14,90,247,
+250,247,55,21,167,144,158,143,167,147,100,251,72,24,247,35,6,247,7,248,176,
+98,29,86,251,141,111,129,119,134,109,134,25,165,247,13,5,73,6,113,251,17,
+5,93,150,128,147,163,26,143,139,142,140,141,30,195,29,68,193,103,243,148,
+143,139,140,147,30,114,251,8,5,205,6,14,90,248,30,22,198,6,105,251,51,87,
+29,197,247,164,5,83,6,230,248,63,98,29,86,251,141,5,123,93,96,131,99,27,95,
+111,156,165,143,139,142,140,141,31,195,29,71,192,100,234,191,198,148,156,
+201,30,14,45,247,189,155,10,247,49,252,167,39,29,100,52,10,247,21,247,109,
+177,29,14,247,89,247,171,248,115,21,37,252,115,5,248,11,6,247,13,243,236,
+247,5,220,82,188,43,31,251,126,6,168,247,31,5,247,61,6,159,232,5,251,62,6,
+161,239,98,29,117,39,5,251,23,6,119,46,5,247,86,252,2,21,164,247,6,5,247,
+120,6,164,154,123,113,100,109,106,104,31,14,100,248,24,108,29,251,56,251,
+139,21,224,170,195,188,206,27,197,176,95,69,128,138,129,138,124,31,125,101,
+132,137,127,27,127,126,146,156,122,31,162,113,125,146,117,27,119,124,135,
+121,88,31,247,121,53,21,60,109,83,92,74,27,80,103,183,210,148,139,146,140,
+151,31,152,179,148,141,155,27,160,152,132,119,160,31,120,158,152,132,154,
+27,155,155,144,155,185,31,14,103,249,46,248,171,21,148,107,124,141,117,27,
+65,88,101,52,99,31,251,0,251,121,93,247,240,5,251,33,6,224,252,176,5,247,
+15,6,247,97,248,30,5,172,156,147,147,158,27,149,139,139,124,177,31,14,251,
+32,247,179,117,21,181,143,172,148,167,153,8,207,174,184,205,204,26,65,10,
+251,32,6,136,118,137,119,125,26,58,203,82,238,131,30,85,55,5,149,163,228,
+29,118,145,164,90,31,109,87,5,117,197,169,132,184,27,230,198,181,204,175,
+116,160,99,123,127,137,135,124,31,14,251,35,247,36,248,65,21,47,252,65,87,
+29,190,247,131,5,211,6,178,196,29,251,1,251,80,5,77,6,179,247,80,5,251,213,
+199,29,247,71,6,14,45,247,192,116,21,247,14,140,241,221,176,247,19,8,112,
+10,247,26,6,126,29,63,179,71,200,110,30,161,129,162,133,168,135,84,54,24,
+70,29,127,137,135,124,31,14,72,248,45,247,5,21,68,6,85,251,166,87,29,169,
+247,53,5,212,91,10,237,192,193,148,156,188,30,14,247,1,248,107,247,176,21,
+170,141,162,146,161,151,8,201,174,170,194,216,26,247,17,65,209,251,24,30,
+251,168,253,47,224,247,175,247,26,6,241,251,43,47,251,24,5,230,6,183,205,
+182,73,5,234,6,49,247,28,241,247,36,5,44,6,87,59,5,251,174,247,50,21,247,
+126,247,70,7,221,187,95,66,65,91,96,57,31,14,247,242,248,140,249,96,21,251,
+96,251,52,251,51,251,94,251,91,247,52,251,51,247,93,247,91,247,52,247,52,
+247,92,247,89,251,53,247,54,251,87,31,164,82,21,247,35,126,247,6,251,6,153,
+251,37,8,251,163,6,247,164,82,21,130,251,34,251,13,251,15,251,34,128,8,247,
+168,7,83,251,168,21,251,39,153,251,5,247,5,125,247,41,8,247,166,6,251,166,
+196,21,153,247,36,247,7,247,6,247,37,153,8,251,164,7,14,247,158,176,137,21,
+247,105,175,143,165,200,31,247,5,189,223,247,51,247,55,26,225,112,214,95,
+173,30,164,108,94,151,80,27,251,8,56,107,77,94,31,113,103,129,100,137,66,
+204,171,24,151,7,193,156,177,173,162,30,156,150,149,142,185,148,66,252,31,
+24,124,69,115,97,110,129,8,119,6,211,138,21,200,188,154,172,161,247,15,194,
+247,210,24,146,6,144,6,158,6,169,151,136,127,158,31,179,114,161,81,58,26,
+32,115,52,92,76,30,100,89,88,110,84,136,8,247,123,251,125,21,206,6,173,247,
+82,5,125,170,151,136,158,27,247,6,238,247,41,247,66,236,100,189,62,92,99,
+119,102,109,31,105,97,121,85,117,251,11,8,185,251,0,21,174,247,84,5,225,155,
+173,188,183,27,178,160,99,65,251,32,86,251,2,71,113,119,149,161,121,31,14,
+247,238,248,140,249,96,21,251,94,251,53,251,49,251,89,251,92,247,50,251,52,
+247,91,247,89,247,52,247,52,247,89,247,86,251,52,247,55,251,83,31,128,82,
+21,247,61,247,28,251,24,251,58,251,60,251,25,251,26,251,59,251,58,251,26,
+247,26,247,58,247,55,247,26,247,29,247,53,31,14,61,184,146,21,228,6,174,247,
+2,161,209,180,210,193,200,25,195,187,190,175,168,27,151,147,130,125,126,139,
+139,125,98,31,76,251,104,5,129,106,134,115,121,26,108,158,115,164,173,190,
+178,206,195,30,118,153,129,129,138,138,126,125,25,118,121,129,132,127,27,
+132,132,147,147,142,141,147,141,146,31,143,149,141,146,140,141,200,247,99,
+24,158,200,141,149,160,26,181,114,171,106,87,63,86,58,75,30,103,92,137,137,
+134,133,131,130,25,204,247,107,247,53,220,158,193,251,58,52,188,247,53,251,
+62,118,130,111,5,189,153,132,116,129,138,136,123,77,31,123,81,251,7,82,122,
+89,247,7,195,5,14,247,108,249,141,247,59,21,38,91,89,102,51,27,95,103,148,
+169,64,31,233,247,1,148,160,175,247,76,8,247,36,194,239,245,236,26,213,84,
+193,63,63,72,77,39,107,30,121,81,132,97,130,251,10,61,140,88,152,90,172,8,
+88,173,110,189,193,26,180,157,173,175,170,30,176,170,160,149,223,162,130,
+169,24,251,46,110,66,80,46,26,80,168,81,188,95,30,195,91,200,119,242,137,
+131,251,22,106,42,86,93,8,184,41,81,156,90,27,79,98,115,103,85,202,103,234,
+197,174,149,178,217,31,103,233,191,126,188,27,192,194,164,179,175,31,161,
+163,152,161,157,185,8,251,117,247,149,21,143,141,194,140,154,30,142,224,144,
+170,156,186,8,193,159,179,173,183,27,181,171,101,89,93,114,83,99,95,31,109,
+106,109,120,58,100,8,251,108,251,237,21,110,95,99,126,94,27,74,81,164,167,
+164,173,154,193,169,171,131,124,174,31,191,117,139,139,154,133,8,14,98,165,
+248,125,21,123,7,86,187,101,207,207,180,173,196,186,120,154,57,157,30,81,
+152,124,147,157,26,164,164,157,173,177,156,125,102,147,30,182,6,199,137,101,
+173,74,27,77,98,105,87,96,162,122,211,126,31,200,127,157,129,113,26,112,112,
+120,100,93,113,162,180,138,30,247,118,247,81,21,251,188,182,247,162,143,7,
+199,251,162,5,192,6,199,247,162,5,143,251,162,182,247,188,59,6,87,251,147,
+84,247,147,5,14,97,247,67,248,219,21,180,202,187,157,187,27,219,199,74,53,
+46,79,61,69,107,113,150,158,125,31,159,176,142,148,157,26,164,121,158,114,
+109,118,113,102,94,171,103,203,115,30,65,117,106,115,69,59,162,118,24,209,
+210,178,160,203,27,242,221,52,251,2,32,73,52,59,86,95,175,182,157,144,151,
+154,158,31,102,141,126,144,94,169,8,166,98,116,148,112,27,89,93,95,90,115,
+147,120,162,108,31,166,161,5,124,158,134,151,156,26,172,167,167,173,174,171,
+105,100,121,133,127,120,121,30,177,138,144,138,165,121,8,93,207,184,121,183,
+27,247,6,247,0,247,14,247,21,201,114,199,96,184,31,104,174,109,155,78,157,
+188,159,161,150,164,160,8,182,174,166,198,200,26,244,49,228,251,0,73,82,116,
+77,53,30,14,153,249,44,249,20,21,118,167,114,125,5,171,81,135,141,109,27,
+100,104,125,105,90,31,186,79,119,149,102,27,77,77,98,72,101,31,96,66,115,
+42,45,26,251,10,179,251,3,207,67,30,78,197,222,102,216,27,213,216,172,195,
+194,31,171,171,156,167,166,200,114,150,24,107,95,127,124,119,119,8,102,100,
+86,119,79,27,58,62,175,197,94,31,89,205,110,237,245,26,215,153,209,164,191,
+30,190,163,188,173,187,27,160,153,133,114,171,31,152,129,5,92,85,126,112,
+93,26,97,156,101,182,83,30,181,84,139,139,144,131,8,159,109,148,114,117,26,
+124,131,119,127,124,30,120,123,122,131,114,27,87,95,185,193,158,143,153,150,
+159,31,106,154,5,127,109,135,124,117,26,64,205,74,216,219,203,206,222,174,
+128,171,117,171,30,117,169,98,189,118,161,8,103,176,131,152,167,26,190,179,
+177,192,161,155,131,109,174,30,141,138,145,133,147,133,8,14,42,248,57,247,
+4,21,80,74,101,117,99,27,84,95,181,191,158,142,156,148,174,31,246,160,177,
+150,178,162,8,204,177,178,192,189,26,189,106,169,82,251,35,251,51,251,71,
+251,54,47,193,81,225,206,200,172,219,220,30,251,127,247,24,21,159,198,155,
+172,164,174,8,196,179,179,170,169,27,160,155,123,117,110,116,96,108,108,31,
+104,105,108,124,51,114,8,14,251,100,211,247,4,21,102,251,4,5,248,10,6,176,
+247,4,5,92,6,165,225,147,183,202,26,247,17,92,201,44,30,251,58,6,94,141,130,
+146,135,170,8,119,116,133,123,111,26,113,148,113,155,124,30,127,151,154,135,
+171,27,247,33,6,237,166,109,251,1,88,135,111,125,87,31,14,251,210,228,247,
+4,21,107,251,4,5,247,33,6,184,235,165,97,141,133,149,91,25,155,157,144,158,
+188,26,173,136,172,129,206,30,130,199,137,166,176,26,160,140,153,142,160,
+30,141,153,140,150,148,26,175,118,155,82,147,30,85,147,121,147,125,162,8,
+123,116,134,125,115,26,116,145,118,151,123,30,154,118,151,134,181,135,8,190,
+134,155,121,89,26,59,132,67,128,94,30,14,208,249,90,127,21,252,227,248,225,
+247,95,53,161,183,251,191,247,18,83,85,247,22,251,186,184,159,52,247,94,248,
+228,252,224,5,14,208,134,127,21,180,98,248,229,248,224,51,251,94,185,119,
+247,21,247,186,83,193,251,190,251,18,160,95,247,96,225,5,14,208,134,249,0,
+21,248,228,252,225,251,96,225,118,95,247,190,251,18,195,192,251,21,247,187,
+93,118,227,251,93,252,229,248,224,5,14,208,249,90,249,0,21,98,180,252,228,
+252,224,226,247,93,94,160,251,22,251,187,195,86,247,191,247,18,117,183,251,
+95,53,5,14,247,238,247,10,248,140,216,29,247,1,247,1,161,156,201,167,8,169,
+7,78,170,96,174,50,229,8,100,6,168,69,162,100,174,101,8,247,37,251,143,21,
+252,248,6,175,179,164,180,165,205,8,100,6,49,48,97,105,78,108,8,109,7,203,
+111,151,129,247,9,251,8,225,10,14,247,238,249,255,248,140,21,252,248,6,174,
+177,165,182,165,205,8,100,6,47,46,99,107,78,108,8,109,7,201,112,161,121,247,
+1,251,1,225,10,253,137,251,93,216,29,247,9,247,8,151,148,203,168,8,169,7,
+78,170,94,176,52,227,8,100,6,168,69,161,101,175,100,8,14,208,248,224,247,
+71,21,118,131,106,122,73,104,8,248,22,7,192,111,188,114,157,131,155,160,24,
+32,216,56,212,84,203,84,75,72,79,251,14,49,154,118,24,158,147,187,163,193,
+168,8,252,22,7,72,174,107,155,117,148,124,119,24,247,14,48,204,82,196,73,
+197,205,217,208,247,1,218,8,251,184,248,21,21,162,158,145,144,157,150,157,
+128,146,134,162,120,8,252,101,7,112,118,136,136,121,129,122,149,135,142,113,
+160,8,14,251,44,220,22,247,25,6,245,186,148,169,182,31,200,182,175,208,216,
+26,210,109,202,85,184,30,177,92,92,150,251,7,27,251,25,69,247,21,6,231,175,
+132,118,170,31,177,111,161,109,146,105,8,251,247,63,247,247,6,132,108,123,
+114,107,111,105,111,104,132,37,138,8,251,21,6,14,247,238,249,109,248,169,
+21,247,9,252,98,251,9,7,248,98,251,215,21,247,9,251,64,247,65,251,9,251,65,
+251,65,251,9,247,65,251,64,247,9,247,64,7,14,211,248,31,249,130,21,72,254,
+124,206,6,14,208,247,144,250,10,21,28,251,139,197,28,4,117,7,238,22,28,251,
+139,197,28,4,117,7,14,247,242,248,169,248,149,21,73,6,251,116,252,149,5,219,
+6,247,69,248,45,247,69,252,45,5,219,6,14,247,242,248,169,22,247,116,248,149,
+5,59,6,251,69,252,45,251,69,248,45,5,59,6,247,116,252,149,5,14,247,238,248,
+61,248,155,21,47,109,84,71,55,26,42,213,61,247,1,122,30,158,251,42,149,55,
+121,26,82,107,89,103,130,136,143,148,142,139,139,141,149,30,141,146,140,143,
+145,26,167,116,162,109,108,116,115,107,99,174,111,189,192,186,171,193,165,
+30,163,191,152,238,142,247,53,8,228,168,195,210,222,26,234,69,214,32,158,
+30,116,247,38,128,222,159,26,201,172,194,175,148,143,135,131,136,139,136,
+136,129,30,137,131,138,135,133,26,111,163,118,171,171,161,162,172,179,100,
+169,87,86,95,110,88,114,30,110,77,129,72,137,251,53,8,247,26,251,235,21,218,
+130,228,122,247,4,30,220,119,190,80,65,26,75,99,84,73,113,30,37,129,21,54,
+157,84,200,215,26,205,180,193,208,163,30,142,44,151,251,17,154,60,8,14,247,
+238,249,122,249,5,21,103,109,110,103,103,168,109,175,176,168,168,176,174,
+110,169,103,31,252,124,189,29,247,137,252,133,188,29,14,247,238,249,124,249,
+5,111,10,248,125,252,133,111,10,14,247,238,248,135,247,138,21,247,128,208,
+251,89,6,196,239,5,247,32,208,38,6,169,191,89,168,93,58,5,251,200,70,247,
+161,6,83,39,5,251,105,70,247,66,6,82,40,5,251,9,70,217,6,111,90,189,111,182,
+216,5,247,224,208,251,185,6,14,247,238,249,204,248,219,21,253,35,251,183,
+5,96,7,249,35,251,184,5,215,7,252,173,247,129,248,173,247,130,5,77,4,252,
+34,251,68,248,34,251,67,5,215,7,251,123,238,247,123,239,5,14,247,238,247,
+61,248,219,21,64,7,248,173,251,130,252,173,251,129,5,63,7,249,35,247,184,
+5,182,7,253,35,247,46,21,63,7,247,123,39,251,123,40,5,63,7,248,34,247,67,
+5,14,247,238,248,249,76,21,180,165,111,188,5,229,168,190,225,247,16,26,229,
+110,206,81,184,30,171,99,102,148,49,27,251,62,6,96,212,97,114,167,91,5,86,
+77,229,6,247,109,252,6,5,123,6,251,183,77,247,172,6,173,145,139,141,161,31,
+251,88,248,66,21,247,37,6,247,13,191,83,251,21,38,105,81,68,120,31,14,247,
+238,248,138,249,76,117,29,247,188,252,26,21,251,47,123,251,20,251,8,251,48,
+27,251,48,251,21,247,8,247,47,123,31,140,198,21,247,46,155,247,20,247,9,247,
+47,27,247,49,247,20,251,8,251,47,155,31,14,247,238,248,138,249,75,21,251,
+93,134,29,251,84,31,251,130,252,185,21,94,195,117,201,209,26,247,58,247,26,
+247,27,247,58,208,202,117,94,197,30,183,96,21,184,83,161,77,67,26,251,57,
+251,27,251,26,251,58,71,75,161,184,82,30,14,247,238,248,134,248,32,21,105,
+112,113,104,106,166,112,172,173,166,166,173,172,112,166,106,31,143,247,192,
+117,29,131,79,21,247,63,247,27,251,24,251,61,251,57,251,28,251,26,251,58,
+251,59,251,27,247,26,247,56,247,57,247,27,247,29,247,55,31,14,247,238,247,
+73,22,205,247,137,248,198,206,252,198,247,136,73,6,14,247,238,249,189,248,
+192,21,73,251,136,252,198,72,248,198,251,137,205,6,14,247,238,248,98,22,206,
+248,201,247,131,206,252,182,72,247,132,6,14,247,238,247,108,248,218,21,247,
+137,252,218,5,207,6,247,142,248,218,5,65,6,251,102,252,128,251,99,248,128,
+5,67,253,107,21,248,195,205,252,195,6,14,247,238,250,122,247,174,21,88,6,
+251,49,251,7,105,70,61,31,38,45,109,51,140,251,88,8,88,201,190,7,141,170,
+140,247,50,173,221,235,214,25,200,184,234,163,247,21,142,8,190,6,14,247,238,
+137,247,174,21,76,190,7,247,8,137,230,118,198,102,8,247,0,67,180,49,251,57,
+26,141,108,5,88,202,190,7,140,247,86,108,228,38,234,8,208,61,251,6,173,251,
+49,27,14,247,238,137,247,111,21,190,6,247,48,247,7,173,208,217,31,240,234,
+170,227,138,247,86,8,190,76,88,7,137,108,138,251,50,105,58,43,64,25,80,94,
+41,114,251,19,137,8,88,6,14,247,238,250,122,247,111,21,202,88,7,251,6,141,
+43,160,82,176,8,251,0,212,98,227,247,57,26,137,170,5,190,77,88,7,138,251,
+88,170,52,239,45,8,70,217,247,7,105,247,49,27,14,208,248,234,176,21,251,130,
+248,107,251,130,252,107,5,248,15,198,21,251,175,6,247,35,247,176,5,14,208,
+247,19,170,21,248,102,247,133,252,102,247,132,5,201,252,14,21,247,173,7,247,
+179,251,35,5,14,208,247,14,248,143,21,247,130,252,107,247,130,248,107,5,252,
+15,80,21,247,175,6,251,35,251,176,5,14,208,248,229,170,21,248,117,7,252,102,
+251,132,5,248,40,251,30,21,251,179,247,30,247,179,247,35,5,14,247,238,247,
+133,247,223,21,247,157,251,184,247,153,247,182,251,159,247,186,5,14,247,238,
+247,82,247,224,21,247,202,251,235,247,203,247,236,251,203,247,235,5,251,157,
+251,235,21,247,157,247,184,247,157,251,184,251,157,251,185,5,14,251,44,247,
+139,248,99,21,35,53,54,37,251,0,223,54,246,243,224,224,244,244,54,224,34,
+31,140,81,21,211,198,80,66,67,80,79,68,63,81,198,215,209,200,198,211,31,14,
+208,247,111,251,47,21,247,174,194,43,249,220,235,194,251,174,6,191,254,19,
+21,249,220,221,253,220,7,14,208,248,137,251,47,21,250,74,251,174,84,236,253,
+220,42,84,7,247,122,194,21,58,249,220,220,6,14,116,162,248,176,148,247,72,
+151,6,247,5,10,247,35,11,191,148,146,142,143,144,154,153,143,147,142,143,
+12,12,247,170,20,249,30,21,176,19,0,241,2,0,1,0,16,0,25,0,32,0,106,1,16,1,
+65,1,77,1,80,1,88,1,91,1,134,1,139,1,146,1,170,1,185,2,50,2,70,2,87,2,102,
+2,107,2,138,2,170,3,13,3,34,3,134,3,166,3,171,4,5,4,10,4,49,4,132,4,142,4,
+153,4,234,4,243,4,250,4,254,5,12,5,85,5,146,5,185,5,230,5,254,6,45,6,53,6,
+83,6,99,6,107,6,126,6,140,6,147,6,150,6,167,6,172,6,177,6,231,6,239,7,2,7,
+11,7,50,7,65,7,68,7,78,7,118,7,140,7,145,7,158,7,162,7,207,7,212,8,0,8,43,
+8,86,8,90,8,114,8,135,8,168,8,173,8,213,8,220,8,238,8,247,9,27,9,35,9,58,
+9,71,9,81,9,113,9,117,9,134,9,137,9,157,9,190,9,195,9,208,9,239,10,14,10,
+18,10,24,10,52,10,58,10,87,10,116,10,120,10,127,10,155,10,183,10,190,10,206,
+10,233,10,253,11,12,11,27,11,36,11,41,11,57,11,83,11,97,11,101,11,113,11,
+129,11,141,11,147,11,152,11,157,11,164,11,168,11,173,11,179,11,191,11,214,
+11,237,11,246,12,3,12,25,12,47,12,67,12,87,12,91,12,110,12,131,12,152,12,
+155,12,160,12,170,12,177,12,186,12,195,12,215,12,235,12,255,13,19,13,39,13,
+54,13,62,13,81,13,100,13,112,13,123,13,130,13,139,13,157,13,175,13,180,13,
+184,13,189,13,197,13,201,13,207,13,224,13,228,13,243,14,2,14,10,14,14,14,
+30,14,44,14,59,14,73,14,89,14,105,14,121,14,130,14,142,14,157,14,172,14,187,
+14,196,14,204,14,210,14,216,14,221,14,235,14,249,15,7,15,21,15,35,15,49,15,
+61,15,75,15,89,15,103,15,107,15,118,15,131,15,137,15,148,15,160,15,172,15,
+184,15,196,15,208,15,220,15,230,15,242,15,254,16,10,16,20,16,28,16,36,16,
+45,16,56,16,67,16,78,16,89,16,100,16,111,16,120,16,126,16,129,16,133,16,136,
+16,140,16,147,16,152,16,157,16,163,16,170,16,175,16,185,16,188,248,168,247,
+39,21,157,251,39,5,247,45,6,124,10,11,117,10,248,181,6,247,5,29,11,248,49,
+248,185,73,10,11,247,201,248,176,223,10,72,251,207,5,130,98,134,101,117,26,
+111,150,109,158,117,30,93,177,198,118,227,27,227,208,160,180,183,31,177,173,
+159,185,159,232,209,247,220,24,251,32,6,70,251,214,128,84,129,117,116,118,
+25,120,117,108,128,108,27,89,106,166,179,150,143,164,144,164,31,11,249,130,
+239,29,173,191,153,201,29,187,111,174,30,184,103,82,163,68,27,79,80,122,107,
+93,31,173,106,89,154,61,27,49,69,118,99,94,31,106,110,122,105,126,76,8,247,
+23,6,194,156,170,159,204,27,189,161,126,109,118,125,117,119,129,31,118,128,
+139,139,67,129,82,130,24,91,131,102,125,107,116,8,86,101,107,79,77,26,58,
+197,91,236,232,192,164,214,209,30,75,167,204,103,227,27,247,12,247,1,207,
+246,192,31,252,120,203,21,57,121,91,94,69,27,92,115,156,172,186,175,172,205,
+150,31,189,147,155,142,5,140,149,146,141,143,27,150,142,142,140,151,145,8,
+248,8,204,21,251,108,6,217,160,184,179,204,27,194,169,106,81,31,11,249,110,
+22,247,249,249,109,5,251,51,6,251,117,252,184,142,248,184,5,251,50,6,251,
+116,252,182,142,248,182,5,251,51,6,190,253,109,5,247,27,6,247,129,248,191,
+143,252,191,5,11,248,209,247,118,208,29,81,163,66,74,29,11,63,29,14,50,29,
+247,45,6,110,10,11,73,10,14,21,105,125,122,122,116,27,127,137,241,29,114,
+27,85,95,97,64,116,31,193,6,172,156,155,154,157,27,147,160,132,132,154,31,
+189,114,5,133,152,160,134,156,132,29,247,214,145,29,11,249,39,249,109,78,
+10,11,249,97,248,143,99,10,35,48,87,172,196,144,116,10,186,166,212,163,29,
+224,186,179,10,11,145,10,94,104,103,95,131,129,93,24,215,145,206,191,10,247,
+27,175,21,100,179,197,119,210,27,241,229,183,218,199,31,186,201,172,239,222,
+26,174,133,169,127,169,30,230,215,105,180,54,68,5,180,100,79,161,65,27,36,
+49,95,60,79,31,91,76,107,40,53,26,104,146,107,153,108,30,46,61,173,99,5,248,
+83,248,10,21,140,132,139,134,136,26,101,130,95,123,103,30,67,109,87,97,80,
+27,105,108,154,164,122,31,121,193,21,138,150,139,144,148,26,185,154,194,162,
+180,30,195,170,185,170,192,27,174,169,123,110,157,31,11,99,10,34,49,87,172,
+197,143,116,10,187,166,211,163,29,225,185,179,10,11,111,29,150,138,159,27,
+184,176,145,150,170,31,182,247,10,29,11,209,10,63,101,73,87,247,9,10,212,
+59,241,65,29,11,248,4,77,29,11,207,22,224,29,154,210,247,141,247,146,70,251,
+217,5,220,10,251,32,6,124,68,251,141,251,146,208,247,217,98,29,11,249,113,
+199,10,252,184,133,29,248,9,6,252,110,252,115,112,251,17,5,248,184,95,29,
+252,9,6,248,110,248,115,5,11,247,17,21,110,160,127,150,124,154,8,109,170,
+124,184,195,26,247,73,247,1,247,28,247,36,237,204,76,44,59,106,43,90,77,30,
+109,101,114,119,63,97,113,247,11,29,251,56,6,202,172,173,164,173,177,8,192,
+198,172,230,223,26,213,108,213,87,191,30,196,81,61,169,45,27,33,38,99,67,
+63,31,64,67,91,251,3,35,26,51,176,67,214,81,30,251,65,133,29,247,204,6,11,
+81,29,147,26,247,19,251,1,224,251,55,251,16,251,0,89,44,57,134,10,11,221,
+22,247,220,6,239,208,163,193,195,31,188,187,171,208,199,26,194,119,177,88,
+179,30,216,189,179,202,209,26,178,124,178,114,166,30,175,103,89,156,65,27,
+251,217,6,227,251,182,21,174,247,57,5,247,56,6,201,166,120,96,114,129,112,
+121,120,31,114,117,117,132,87,27,251,122,251,206,21,179,247,81,5,247,70,6,
+201,168,117,92,114,130,111,125,118,31,105,116,111,127,82,27,14,248,209,247,
+118,21,139,29,251,9,38,26,251,15,224,55,247,18,247,13,240,202,247,4,194,30,
+184,29,157,232,142,10,11,248,107,59,10,11,21,140,144,142,139,144,27,192,162,
+124,105,98,106,106,99,102,120,155,170,145,139,143,141,147,31,48,6,136,123,
+138,130,128,26,71,187,100,222,247,1,214,208,238,171,125,162,110,157,30,186,
+168,163,177,185,26,198,92,173,58,39,87,94,37,119,30,226,6,195,151,156,158,
+178,27,166,157,123,115,118,130,120,124,126,31,123,125,122,135,99,138,8,11,
+248,174,61,29,11,247,42,247,233,21,66,251,233,5,133,10,73,251,200,5,63,180,
+29,247,119,22,247,65,6,156,219,5,251,66,6,178,247,75,171,29,251,26,6,14,112,
+187,85,175,30,182,158,159,152,160,165,8,168,172,156,185,183,26,242,51,207,
+251,24,65,78,120,103,94,30,91,101,114,92,122,61,134,114,24,247,42,6,144,164,
+5,195,151,181,173,195,27,186,170,114,101,77,86,90,73,31,94,133,29,194,6,191,
+174,110,95,61,84,81,66,86,106,169,189,156,141,151,144,167,31,11,84,29,41,
+90,193,245,221,74,10,11,21,193,217,10,150,154,29,82,106,10,11,184,117,174,
+95,166,30,201,165,178,193,199,26,219,68,190,251,3,60,79,117,94,95,30,112,
+111,129,116,128,77,8,224,29,186,147,165,162,183,27,172,161,121,112,92,104,
+111,80,31,111,6,119,44,5,167,6,176,146,138,130,152,31,152,131,146,124,121,
+26,92,100,100,92,103,115,162,173,148,140,146,142,158,30,11,244,29,247,104,
+247,12,244,29,14,107,29,68,247,39,5,14,247,7,29,14,21,81,247,0,29,180,109,
+169,97,31,129,183,29,11,248,47,248,185,21,50,61,108,83,84,31,75,73,99,37,
+40,26,251,26,227,55,247,33,225,216,170,196,196,30,200,200,181,243,230,26,
+247,37,56,222,251,35,30,126,251,5,21,201,174,97,64,91,123,84,114,97,31,84,
+107,94,110,87,27,78,103,181,211,247,18,216,245,232,31,11,247,73,178,10,204,
+247,199,150,187,153,165,167,160,25,157,163,168,149,171,27,186,167,116,101,
+130,135,115,134,116,31,251,4,252,167,87,29,247,15,248,216,5,144,161,141,159,
+154,26,215,76,193,48,65,92,115,76,85,30,156,217,5,11,22,247,32,221,29,251,
+32,6,84,251,151,127,10,102,248,18,21,193,173,95,69,251,18,66,251,0,53,85,
+106,184,211,247,13,214,247,2,222,31,11,21,35,50,95,60,80,31,91,75,108,40,
+53,26,251,14,223,61,247,25,247,0,226,181,220,200,30,187,202,170,238,226,26,
+247,16,55,215,251,29,30,117,251,4,138,10,11,165,226,184,209,31,213,186,200,
+174,220,27,193,179,121,104,160,31,152,119,143,120,100,26,11,248,127,199,10,
+251,7,252,175,5,84,128,104,109,86,27,100,112,161,171,149,140,151,142,151,
+31,155,216,146,10,124,67,5,134,117,137,117,118,201,10,155,216,247,7,248,175,
+24,11,21,96,122,104,117,88,140,10,22,247,192,6,231,149,10,251,42,6,161,252,
+240,21,182,247,94,5,247,45,6,168,152,240,10,91,81,79,30,11,120,10,104,135,
+109,117,26,251,9,234,65,247,44,130,29,11,153,29,148,145,164,126,10,11,241,
+10,60,72,118,101,96,30,96,101,111,82,89,123,10,132,130,26,11,216,22,133,10,
+161,252,240,21,240,248,115,171,29,11,86,29,211,251,39,5,14,191,29,14,249,
+121,146,29,247,3,6,247,103,247,12,146,29,247,3,6,11,250,44,90,10,11,249,95,
+155,29,11,248,169,249,121,21,251,13,251,2,87,45,59,31,68,55,96,251,10,251,
+3,26,251,79,247,5,251,10,247,69,247,19,246,189,232,216,30,210,227,181,247,
+8,247,4,26,247,81,251,2,247,8,251,71,30,11,243,10,247,104,247,14,122,10,223,
+10,251,7,252,176,5,247,32,222,29,21,251,32,133,29,224,29,11,132,10,247,104,
+247,12,132,10,11,6,247,7,248,176,98,29,86,251,141,5,123,93,96,131,98,27,96,
+111,156,165,143,139,141,140,142,31,245,10,135,119,136,119,126,26,73,206,93,
+11,249,121,21,251,16,38,91,40,57,31,61,47,115,10,11,95,10,14,107,10,106,133,
+138,135,137,130,30,11,247,166,247,126,21,230,219,247,65,251,206,5,247,71,
+6,251,127,248,46,247,253,247,211,5,251,70,6,251,246,251,212,207,247,212,5,
+251,42,130,10,11,248,213,247,223,21,69,251,223,205,29,251,43,6,81,251,165,
+5,251,180,113,29,11,248,209,161,29,11,247,246,249,109,223,10,251,47,253,109,
+119,10,11,21,102,29,11,248,129,248,6,21,247,198,247,251,5,251,76,6,251,80,
+251,132,63,247,132,5,251,66,6,247,42,251,251,251,197,252,6,5,247,70,6,247,
+85,247,145,223,251,145,5,11,247,254,214,10,11,21,251,7,251,0,33,251,5,56,
+203,77,226,247,10,246,244,247,7,223,75,199,50,31,118,41,21,182,170,111,100,
+86,91,91,84,97,108,167,177,193,188,187,192,31,11,247,164,21,247,125,247,160,
+5,251,65,6,251,14,251,55,86,247,55,5,251,55,6,247,11,251,160,251,130,251,
+164,5,247,65,6,247,20,247,60,194,251,60,5,11,21,251,87,252,29,103,248,29,
+5,251,41,6,221,252,198,119,78,107,116,79,140,25,127,6,121,6,115,251,5,247,
+50,135,178,158,197,244,25,247,250,249,18,5,11,249,123,108,10,247,27,21,173,
+161,122,113,100,105,109,96,108,119,157,166,177,171,168,179,31,106,172,10,
+11,168,92,183,114,30,116,178,186,129,201,27,247,62,247,0,221,247,20,162,10,
+11,21,42,6,113,251,14,5,236,6,247,117,247,14,21,42,6,113,251,14,5,236,6,99,
+247,160,21,37,6,120,49,247,12,10,183,10,115,160,11,251,15,247,109,21,57,121,
+91,93,71,27,91,114,156,172,186,176,172,204,150,31,189,147,155,142,149,141,
+146,140,143,140,25,150,141,142,140,151,146,8,11,188,29,252,125,189,29,11,
+213,10,197,163,187,247,4,10,172,164,247,4,29,127,140,100,8,11,6,232,191,153,
+178,189,216,10,11,21,234,195,75,251,2,58,112,53,94,76,31,70,89,76,104,63,
+27,46,83,204,247,1,221,167,226,184,201,31,207,188,203,174,212,27,14,127,29,
+32,244,251,75,30,11,215,29,86,159,93,175,106,30,95,187,207,118,236,27,247,
+14,232,174,206,197,31,181,11,247,188,194,29,248,14,95,29,252,164,192,29,11,
+98,29,49,252,63,5,251,65,154,10,87,29,177,247,69,207,201,218,251,131,5,247,
+56,6,251,21,247,226,247,124,247,98,5,251,51,6,251,115,251,102,5,11,21,124,
+29,11,247,28,247,231,21,113,251,15,5,247,16,6,165,247,15,5,14,243,10,14,26,
+82,180,101,227,212,29,72,103,162,184,136,30,251,29,6,136,125,138,11,42,249,
+109,5,251,65,6,252,43,253,109,5,247,45,6,220,247,39,5,247,150,247,17,21,251,
+81,6,247,46,247,175,5,11,249,137,191,29,11,31,208,168,10,192,166,203,194,
+30,124,71,5,11,5,193,116,97,164,71,27,58,57,93,64,87,31,90,68,110,49,57,26,
+251,19,206,58,244,207,191,163,193,185,30,11,247,38,21,108,251,38,5,225,6,
+126,71,103,100,77,128,127,83,24,247,2,155,199,196,158,247,2,168,247,29,24,
+11,21,213,29,11,192,29,247,42,6,11,112,160,175,140,139,142,140,143,31,96,
+6,134,122,138,129,126,26,77,181,98,203,218,208,200,221,152,30,14,146,29,247,
+2,6,11,247,177,6,247,37,223,178,240,212,31,211,237,179,247,15,247,10,26,247,
+67,61,214,251,73,30,251,177,6,11,30,61,48,91,251,19,251,8,26,251,66,247,4,
+251,3,247,68,232,205,171,218,213,30,132,49,5,229,6,11,22,150,29,14,178,10,
+190,247,131,5,11,7,147,121,122,142,121,27,74,82,85,78,101,166,116,183,186,
+185,163,179,167,31,160,168,147,169,188,26,11,21,201,177,94,67,90,125,86,115,
+97,31,83,108,93,108,87,27,79,100,184,210,247,19,214,244,230,31,11,145,10,
+95,104,102,204,10,27,92,112,160,175,31,147,97,7,134,122,138,129,126,159,10,
+129,128,144,125,27,113,117,117,112,108,167,115,174,183,170,170,197,153,31,
+155,203,144,212,247,65,26,11,21,148,171,147,158,152,155,8,171,163,178,158,
+179,247,9,29,139,102,26,11,93,224,61,218,29,247,13,191,84,251,22,251,22,87,
+11,26,219,81,191,50,65,85,112,75,85,30,157,221,5,11,21,115,251,4,5,206,6,
+133,11,5,251,42,6,11,159,237,29,143,141,152,143,156,31,201,247,186,5,217,
+6,11,166,247,17,5,58,6,148,189,171,168,197,149,149,185,24,50,132,75,82,125,
+52,116,251,1,24,11,192,153,178,188,216,10,251,38,6,198,247,169,5,11,250,60,
+83,10,6,203,251,223,119,29,64,248,28,229,10,11,247,70,178,10,200,247,179,
+5,221,157,189,180,222,27,154,11,247,22,247,21,191,195,247,13,31,207,10,11,
+6,230,248,63,175,29,249,137,177,10,11,247,227,166,10,11,110,120,101,110,183,
+10,11,247,99,169,10,26,77,247,2,10,6,165,247,17,5,11,251,223,119,29,64,248,
+28,247,79,246,29,11,199,100,178,56,164,31,43,167,5,88,154,125,149,159,26,
+171,174,160,192,194,172,120,11,123,116,27,128,136,140,147,120,31,89,160,5,
+155,103,131,141,113,27,84,96,97,63,11,98,29,251,7,252,176,87,29,11,251,20,
+21,239,199,73,251,2,60,112,51,96,11,21,251,28,247,38,115,251,6,221,50,251,
+12,50,114,251,9,247,91,247,40,5,11,26,216,84,191,37,159,30,251,1,161,5,45,
+158,112,155,177,26,203,195,179,230,11,247,219,98,29,59,252,12,5,135,120,137,
+121,121,26,59,197,87,227,213,11,21,251,32,251,39,5,216,6,242,236,199,42,5,
+217,6,68,247,39,5,14,247,7,10,14,87,29,199,247,174,5,79,160,181,112,209,27,
+247,53,247,24,247,57,11,251,61,21,172,160,120,108,87,106,102,92,106,115,159,
+167,190,176,179,185,31,11,251,70,31,123,67,21,247,33,241,36,251,33,251,87,
+251,75,251,74,251,89,11,185,10,14,200,10,80,30,14,21,251,42,6,108,251,38,
+119,29,11,198,10,94,247,42,5,11,206,10,251,7,252,176,87,29,11,110,85,134,
+138,130,138,130,30,11,21,248,163,247,73,165,247,13,252,86,247,74,111,251,
+23,247,184,251,3,11,21,251,32,251,39,5,216,6,242,236,200,42,5,216,6,68,247,
+39,5,11,199,191,5,196,7,251,154,251,114,247,154,251,114,5,196,7,79,191,5,
+11,117,146,162,91,31,109,88,5,117,196,170,132,184,27,230,198,181,204,175,
+11,251,32,6,71,251,210,5,58,122,87,87,74,27,88,114,164,189,154,140,11,98,
+29,97,251,92,5,251,88,6,182,247,92,98,29,11,247,175,6,197,192,228,10,11,21,
+112,116,116,113,111,162,116,166,166,162,162,166,166,116,162,112,31,11,21,
+169,164,114,109,109,114,114,109,109,114,164,170,168,165,164,168,31,11,111,
+175,30,184,103,81,163,66,247,8,10,11,21,252,121,6,117,39,5,248,121,6,11,206,
+149,217,160,235,24,14,243,29,195,6,208,247,21,5,11,30,143,97,141,117,127,
+26,121,133,129,127,133,137,140,150,128,30,11,170,162,157,159,161,8,165,170,
+153,175,177,26,205,90,178,56,39,11,210,10,122,26,11,247,141,214,29,104,95,
+130,219,29,21,240,251,42,5,202,6,11,249,109,21,11,6,169,152,226,29,11,26,
+42,210,80,247,9,206,208,157,167,182,30,188,171,174,197,11,203,209,29,11,250,
+194,247,203,21,254,135,6,117,35,5,250,135,6,14,94,131,130,93,24,214,145,207,
+206,149,217,159,235,24,14,6,247,20,248,240,146,10,11,248,176,21,11,247,183,
+201,251,172,6,56,104,132,114,102,31,74,96,105,11,223,10,251,20,252,238,5,
+107,132,125,127,109,27,11,248,159,206,10,121,56,5,202,112,98,168,80,27,63,
+11,200,247,181,146,10,78,251,181,5,135,121,137,120,11,103,27,122,116,142,
+144,113,31,148,95,136,139,121,27,108,11,248,242,247,184,21,252,140,6,114,
+251,12,5,248,140,6,11,251,26,6,68,108,106,112,85,27,79,110,172,209,193,152,
+11,199,10,251,32,192,29,224,29,11,248,28,21,251,184,133,29,247,58,6,126,11,
+31,203,190,177,217,220,26,247,10,63,210,251,20,30,11,171,162,172,184,26,193,
+90,177,69,52,66,77,64,113,11,251,121,251,115,251,131,251,67,247,21,251,20,
+247,69,11,21,251,18,6,37,251,39,5,11,224,29,247,7,248,176,5,11,6,115,251,
+4,5,11,6,163,247,4,5,11,21,251,32,6,11,6,56,104,132,114,101,31,75,96,105,
+66,44,26,11,8,178,6,115,200,108,188,107,172,8,248,248,6,11,142,163,140,148,
+149,26,181,122,179,108,170,30,177,11,149,163,151,142,157,27,165,157,126,119,
+114,109,120,11,155,166,174,31,187,178,169,198,196,26,218,72,202,11,247,78,
+247,229,5,251,51,6,251,41,251,165,5,11,61,6,170,247,37,98,29,108,251,37,5,
+11,247,6,5,247,28,6,163,155,123,113,100,109,106,11,247,33,247,131,5,251,39,
+6,251,2,251,80,5,11,251,34,126,185,128,165,122,159,25,176,108,91,161,11,5,
+244,10,11,6,179,247,80,98,29,99,251,80,5,11,164,132,159,27,169,172,149,158,
+169,31,169,159,11,247,12,29,209,6,11,104,184,207,247,18,213,247,1,225,31,
+14,6,211,247,65,5,33,6,68,251,65,5,11,135,125,151,31,150,125,145,121,116,
+26,68,11,143,157,140,147,151,26,230,63,193,251,18,11,21,252,121,6,114,251,
+12,5,248,121,6,11,21,251,2,6,113,251,14,5,247,2,6,11,149,163,151,142,156,
+27,165,157,126,119,114,11,186,247,113,98,29,92,251,113,5,11,249,53,21,65,
+6,85,251,148,5,196,6,11,218,105,30,125,173,166,135,208,27,247,172,11,247,
+162,21,247,220,248,95,5,251,59,6,11,181,98,203,218,207,200,221,153,30,14,
+247,41,6,209,247,223,5,11,31,198,167,176,165,194,27,11,21,251,192,180,29,
+247,192,6,11,21,251,19,6,38,251,39,5,209,6,11,21,252,236,6,124,70,5,248,236,
+6,11,27,61,59,108,90,92,31,75,72,93,11,31,81,67,102,251,1,42,26,251,2,11,
+247,223,21,247,181,6,69,251,223,5,11,110,110,102,103,169,110,176,174,168,
+169,11,148,40,5,178,6,193,238,5,14,5,251,42,130,10,14,77,29,14,95,131,219,
+29,129,29,14,209,86,29,11,6,91,247,193,233,29,11,249,44,86,29,11,250,60,107,
+29,11,210,29,251,35,6,11,43,10,188,249,121,21,11,157,10,115,160,11,109,10,
+100,123,127,137,135,124,31,14,36,29,14,};
+#endif
@@ -0,0 +1,2242 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusSans_Oblique_cff_size = 47308;
+asm(".section .rodata");
+asm(".global fz_font_NimbusSans_Oblique_cff");
+asm(".type fz_font_NimbusSans_Oblique_cff STT_OBJECT");
+asm(".size fz_font_NimbusSans_Oblique_cff, 47308");
+asm(".balign 64");
+asm("fz_font_NimbusSans_Oblique_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusSans-Oblique.cff\"");
+#else
+const int fz_font_NimbusSans_Oblique_cff_size = 47308;
+const char fz_font_NimbusSans_Oblique_cff[] = {
+1,0,4,2,0,1,1,1,19,78,105,109,98,117,115,83,97,110,115,45,79,98,108,105,113,
+117,101,0,1,1,1,58,250,26,0,250,27,1,250,28,12,0,250,29,2,250,30,3,250,31,
+4,127,12,2,251,43,12,3,251,36,251,176,28,4,130,250,194,5,29,0,76,156,236,
+13,28,44,176,15,28,44,198,17,174,29,0,0,165,218,18,2,5,2,0,1,0,3,0,9,0,16,
+0,22,0,28,0,38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,
+0,123,0,136,0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,
+216,0,227,0,238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,
+1,103,1,115,1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,
+190,1,196,1,206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,
+2,38,2,44,2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,
+2,151,2,162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,
+3,20,3,27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,
+118,3,131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,
+3,216,3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,
+73,4,79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,
+163,4,168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,
+4,251,5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,
+5,127,5,136,5,141,5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,
+229,5,237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,
+112,6,121,6,128,6,137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,
+6,248,7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,
+115,7,122,7,134,7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,
+7,211,7,214,7,219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,
+1,8,4,8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,
+69,8,74,8,80,8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,
+8,127,8,132,8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,
+230,8,239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,
+134,9,154,9,163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,
+10,6,10,15,10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,
+114,10,123,10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,
+10,213,10,222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,
+46,11,53,11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,
+11,144,11,151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,
+214,11,221,11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,
+12,54,12,63,12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,
+153,12,162,12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,
+12,252,13,5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,
+102,13,111,13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,
+13,191,13,200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,
+14,18,14,25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,
+102,14,109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,
+14,179,14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,
+249,15,0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,
+15,84,15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,
+15,161,15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,76,16,86,16,93,
+73,74,65,98,114,101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,
+67,99,97,114,111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,
+110,68,99,114,111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,
+110,116,69,111,103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,
+99,99,101,110,116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,
+76,99,97,114,111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,
+110,103,97,114,117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,
+110,83,97,99,117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,
+85,114,105,110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,
+99,117,116,101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,
+117,110,105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,
+114,99,117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,
+114,99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,
+105,114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,
+73,109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,
+109,102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,
+109,97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,
+109,97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,
+114,99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,
+85,109,97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,
+73,98,114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,
+111,103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,
+111,116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,
+101,99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,
+110,101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,
+97,99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,83,97,110,115,32,73,116,97,108,105,99,78,
+105,109,98,117,115,83,97,110,115,79,98,108,105,113,117,101,0,239,2,0,1,0,
+25,0,75,0,155,0,204,1,3,1,6,1,203,1,206,2,3,2,48,2,97,2,117,2,185,2,234,2,
+248,3,6,3,42,3,57,3,129,3,254,4,62,4,182,4,228,5,0,5,44,5,47,5,147,5,181,
+6,21,6,29,6,38,6,131,6,208,6,233,7,63,7,68,7,151,7,194,7,202,7,231,8,22,8,
+25,8,63,8,99,8,166,8,207,8,215,8,244,9,53,9,117,9,181,9,244,10,49,10,109,
+10,121,10,161,10,172,10,202,10,228,11,0,11,41,11,58,11,109,11,124,11,174,
+11,199,11,207,11,212,11,253,12,43,12,46,12,49,12,77,12,81,12,85,12,90,12,
+95,12,137,12,173,12,178,12,212,12,247,12,252,13,10,13,49,13,88,13,97,13,103,
+13,111,13,131,13,145,13,171,13,178,13,189,13,211,13,245,14,23,14,57,14,78,
+14,96,14,101,14,121,14,138,14,143,14,172,14,183,14,208,14,237,14,253,15,25,
+15,36,15,64,15,92,15,118,15,145,15,149,15,176,15,187,15,194,15,199,15,225,
+15,229,15,254,16,3,16,15,16,38,16,44,16,59,16,83,16,107,16,130,16,137,16,
+144,16,149,16,171,16,187,16,192,16,197,16,202,16,223,16,244,16,255,17,8,17,
+17,17,37,17,57,17,73,17,93,17,112,17,131,17,150,17,169,17,188,17,207,17,218,
+17,229,17,240,17,247,18,9,18,26,18,42,18,49,18,57,18,63,18,80,18,86,18,103,
+18,120,18,137,18,150,18,163,18,173,18,178,18,194,18,210,18,226,18,242,18,
+249,18,254,19,13,19,28,19,43,19,48,19,63,19,76,19,91,19,100,19,109,19,116,
+19,121,19,125,19,130,19,144,19,158,19,172,19,186,19,200,19,214,19,227,19,
+233,19,246,20,3,20,16,20,28,20,39,20,51,20,63,20,75,20,87,20,99,20,111,20,
+123,20,131,20,142,20,152,20,163,20,174,20,185,20,196,20,207,20,218,20,229,
+20,240,20,249,21,2,21,6,21,13,21,19,21,24,21,41,21,47,21,55,21,81,21,84,21,
+114,21,131,21,157,21,206,22,10,248,160,247,111,21,166,251,111,5,241,6,214,
+29,247,15,247,111,5,247,167,247,6,29,11,21,251,5,42,97,54,58,31,50,47,86,
+251,23,251,20,26,52,166,63,185,93,30,91,187,220,110,224,27,233,224,166,189,
+204,31,247,9,229,215,247,54,247,50,26,218,112,215,94,247,23,29,249,150,248,
+139,21,172,29,60,44,90,251,29,251,18,26,69,159,76,176,92,30,81,185,202,112,
+228,27,245,231,178,210,204,31,178,182,171,194,173,220,8,41,6,114,82,123,109,
+121,114,8,80,97,63,102,60,27,35,70,220,247,13,231,169,238,190,215,31,229,
+200,212,182,231,27,240,189,90,251,0,147,31,11,21,153,214,142,165,171,26,237,
+144,29,196,27,247,12,242,213,247,0,170,31,241,29,223,161,140,149,143,154,
+31,157,211,21,231,165,213,203,220,27,210,184,91,64,129,138,132,137,123,31,
+14,21,46,57,97,65,88,31,94,75,106,251,2,54,26,251,3,216,63,247,4,235,215,
+178,216,195,30,185,202,172,247,1,226,26,192,119,190,104,173,30,172,105,94,
+155,81,27,126,62,21,213,182,91,58,71,29,14,79,29,14,247,117,248,5,21,205,
+160,180,166,218,27,204,178,118,103,133,138,133,138,132,31,134,114,129,96,
+121,128,67,132,25,251,21,128,96,129,89,109,8,88,107,108,85,81,26,60,194,90,
+226,226,226,176,204,206,30,69,178,194,107,219,27,247,13,241,212,247,1,171,
+31,55,6,70,103,86,103,73,27,104,112,147,156,119,31,113,161,122,173,167,26,
+145,7,151,7,164,140,150,143,156,30,248,22,6,153,216,142,165,172,26,232,54,
+215,37,71,70,114,99,94,30,136,146,137,141,120,155,8,169,103,104,149,75,27,
+56,70,117,100,98,31,115,115,126,112,123,81,8,247,172,251,97,21,79,126,52,
+84,55,27,80,108,162,182,172,158,171,169,158,31,163,154,166,147,191,146,238,
+153,145,140,176,152,8,228,188,21,237,170,207,197,223,27,209,183,92,63,128,
+138,132,137,124,31,11,158,29,14,248,199,247,126,21,153,214,142,165,171,26,
+237,144,29,196,27,247,12,242,213,247,0,170,31,241,29,223,161,140,149,143,
+154,31,157,211,21,231,165,213,203,220,27,210,184,91,64,129,138,132,137,123,
+31,11,248,192,22,247,156,248,160,5,48,6,251,88,252,44,128,248,44,5,34,6,251,
+81,252,44,120,248,44,5,48,6,179,252,160,5,235,6,247,87,248,54,151,252,54,
+5,11,247,17,29,165,139,139,150,26,207,71,184,33,161,29,200,184,112,102,134,
+138,132,138,132,74,29,81,108,162,182,172,158,172,169,157,31,164,154,167,147,
+188,146,233,152,148,140,183,154,8,11,56,29,97,167,115,187,151,142,139,145,
+163,30,141,145,141,140,145,123,29,11,21,137,130,135,139,135,27,113,127,148,
+159,142,139,143,140,142,31,203,247,193,5,145,165,139,139,150,26,207,70,184,
+34,161,29,200,184,112,102,134,138,133,138,131,74,29,82,107,162,182,172,158,
+172,169,157,31,164,154,167,147,188,146,234,152,147,140,183,154,8,11,249,86,
+248,151,21,145,167,141,152,154,26,183,118,184,117,29,121,102,110,112,30,101,
+98,80,121,59,27,251,5,87,180,231,212,29,251,13,229,68,247,43,245,226,86,29,
+132,136,119,30,11,174,29,243,238,195,40,5,202,6,75,247,42,5,14,249,86,249,
+109,21,126,29,104,132,94,123,91,29,11,248,84,247,178,21,248,4,248,79,5,251,
+3,6,251,181,251,249,251,28,247,249,5,251,4,6,247,78,252,79,78,251,178,5,233,
+6,11,248,150,248,14,55,29,31,133,7,134,7,138,128,5,11,101,29,251,29,110,86,
+86,32,27,71,99,166,184,31,145,7,147,55,7,137,115,139,138,133,26,62,208,89,
+247,0,219,209,163,182,184,30,189,187,166,200,166,247,19,232,248,75,24,251,
+130,77,21,203,181,91,65,76,121,65,111,90,213,29,168,191,31,204,176,194,176,
+203,27,11,248,68,248,33,21,97,251,92,128,89,125,104,120,118,25,116,120,111,
+124,116,27,100,116,172,196,247,21,214,247,37,247,13,246,31,35,6,103,110,108,
+103,106,87,8,86,57,112,50,50,26,34,190,74,221,196,183,166,201,183,30,147,
+113,145,128,150,126,8,115,159,175,124,174,27,192,194,169,189,179,31,190,204,
+173,245,236,26,217,119,207,100,192,30,48,6,181,78,158,77,65,26,70,121,64,
+108,82,30,94,114,100,111,102,27,105,121,162,182,159,140,147,150,189,31,181,
+247,92,5,11,83,29,112,140,93,8,230,146,6,143,7,145,7,247,25,42,222,251,49,
+251,8,41,99,61,61,30,43,43,81,251,28,251,22,26,45,173,53,195,93,30,102,184,
+205,118,207,27,204,208,157,170,193,31,163,153,158,153,177,171,143,49,24,198,
+6,11,158,137,21,165,111,217,210,5,97,169,192,117,207,27,231,216,179,215,194,
+31,185,203,172,247,0,228,26,168,133,164,126,168,30,220,213,113,169,63,70,
+5,184,106,89,161,68,27,47,58,98,64,88,31,94,74,106,251,1,54,26,108,145,112,
+154,107,30,212,206,21,134,154,138,146,156,26,201,155,203,167,190,30,207,175,
+195,176,203,27,185,175,121,105,158,31,153,99,21,143,119,140,128,128,26,91,
+120,63,115,94,30,73,103,82,100,75,27,95,103,156,170,120,31,11,247,14,29,69,
+69,53,27,84,105,168,187,147,140,148,141,149,31,218,248,7,222,29,53,252,40,
+5,137,129,138,128,126,26,71,191,98,225,217,196,163,195,197,30,127,82,5,11,
+21,144,160,140,148,152,26,209,73,187,41,64,29,164,157,156,30,162,163,169,
+149,183,27,198,172,117,99,11,247,17,29,166,139,139,149,26,207,70,184,34,161,
+29,199,185,112,102,135,138,132,138,131,143,29,228,176,179,146,152,176,30,
+170,150,155,149,180,175,8,132,7,135,7,11,121,29,14,218,22,247,222,6,221,203,
+167,198,191,31,182,187,161,197,204,26,200,112,174,69,169,30,227,178,187,211,
+229,26,177,128,167,114,166,30,175,105,97,154,70,27,251,188,6,166,251,206,
+21,189,247,124,5,247,72,6,225,177,112,80,102,125,103,115,112,31,107,109,100,
+125,72,27,251,143,251,225,21,193,247,143,5,247,118,6,208,176,108,79,100,128,
+105,116,109,31,99,108,101,122,83,27,14,248,193,248,160,21,252,28,165,29,247,
+186,6,252,31,252,14,121,65,5,248,63,6,154,211,5,251,218,6,248,28,248,13,5,
+11,22,247,180,108,29,47,202,106,197,240,26,247,93,247,23,247,47,247,63,247,
+11,219,60,251,11,55,107,49,82,65,30,97,85,97,106,53,94,122,57,24,247,180,
+108,29,251,80,6,247,51,206,232,247,28,247,56,26,247,69,251,7,247,8,251,68,
+251,5,251,1,88,53,67,30,76,65,100,251,2,38,26,76,159,75,175,91,30,157,114,
+154,125,173,115,8,251,85,6,11,21,120,219,29,158,230,5,14,247,241,249,109,
+21,45,118,29,11,21,148,6,162,6,193,164,122,103,80,93,98,75,90,113,160,179,
+147,140,146,141,152,31,77,6,136,123,138,130,127,26,71,182,102,221,245,220,
+209,231,176,123,161,102,152,30,189,159,167,180,191,26,198,97,172,64,46,80,
+91,45,118,30,201,6,145,166,145,153,148,152,8,161,156,169,152,172,27,178,163,
+121,108,109,126,114,118,128,31,128,119,119,136,88,27,11,68,78,118,100,98,
+30,102,104,116,87,92,26,78,174,110,242,112,30,213,120,172,130,154,133,148,
+128,25,146,130,145,124,130,26,120,124,109,122,126,30,118,114,96,126,96,27,
+69,101,166,189,145,140,148,140,149,31,50,6,134,116,138,127,123,26,59,208,
+91,247,9,247,41,236,216,247,11,131,29,11,188,217,203,160,215,172,191,31,198,
+177,188,169,200,27,202,178,104,82,133,139,132,138,130,31,11,252,121,21,196,
+170,161,170,188,26,195,98,173,74,54,70,78,64,111,148,125,171,116,30,75,110,
+105,93,79,26,75,184,100,211,233,219,211,223,175,122,166,103,158,30,102,247,
+46,21,178,161,120,107,92,101,104,88,100,117,158,171,185,178,175,189,31,101,
+251,69,21,184,167,114,100,80,91,94,77,96,111,164,178,197,187,185,199,31,11,
+78,29,172,93,29,249,109,21,55,6,79,251,173,5,204,107,99,165,68,27,251,58,
+251,16,251,50,251,103,251,9,206,63,243,183,184,152,164,179,31,169,157,152,
+154,153,167,123,63,24,220,6,251,32,248,98,21,214,182,89,54,79,123,79,109,
+87,31,72,100,90,105,78,27,65,96,189,225,196,155,202,167,190,31,208,177,187,
+171,203,27,11,248,21,248,175,21,51,58,99,67,86,31,92,77,108,37,47,26,251,
+9,216,62,247,9,230,218,178,212,193,30,186,201,170,240,231,26,247,11,63,215,
+251,12,30,11,21,234,29,201,22,234,29,14,80,123,74,111,89,31,70,101,85,103,
+70,27,68,95,188,220,197,156,204,166,189,31,207,175,196,176,205,27,11,248,
+15,248,175,21,56,62,102,75,88,31,88,75,106,37,48,26,251,15,218,58,247,13,
+225,214,175,204,191,30,190,204,172,239,228,26,247,19,61,219,251,16,30,136,
+62,128,29,11,120,29,14,143,29,229,175,179,146,152,176,30,170,150,154,149,
+181,175,8,132,7,135,7,97,167,115,187,151,142,139,145,163,30,141,145,141,140,
+145,232,29,11,248,123,154,29,150,140,150,142,151,31,153,205,5,45,6,125,75,
+5,135,122,137,122,125,26,96,160,97,173,111,30,117,166,174,196,29,11,21,251,
+138,251,121,251,114,251,131,251,67,247,21,251,20,247,69,247,138,247,121,247,
+114,247,132,247,67,251,21,247,19,251,69,31,125,77,21,247,37,244,33,251,38,
+251,93,251,81,251,79,251,94,251,36,33,246,247,38,247,92,247,81,247,79,247,
+94,31,14,136,29,128,129,26,90,173,109,194,160,168,142,143,154,30,155,212,
+5,131,106,137,139,126,27,117,125,150,155,142,140,144,140,145,31,217,248,3,
+5,228,6,11,149,29,214,188,190,158,169,11,21,207,29,209,152,141,154,142,154,
+31,247,1,248,148,5,45,6,37,252,114,5,131,103,133,96,122,91,29,11,101,190,
+75,153,30,177,149,159,150,164,164,8,179,178,162,193,193,26,240,64,206,251,
+5,52,60,100,72,92,30,113,102,124,101,129,80,8,236,6,240,156,197,196,224,27,
+203,176,106,80,53,68,74,44,31,106,6,122,58,5,179,6,229,179,110,73,11,247,
+71,248,160,21,251,3,252,160,5,223,6,200,247,181,5,243,162,218,212,231,27,
+188,167,118,102,129,135,114,134,115,31,251,12,252,203,5,223,6,247,14,248,
+210,5,146,172,143,166,150,26,205,78,185,54,58,82,108,67,89,30,157,227,5,11,
+247,117,249,109,21,251,47,253,109,5,223,6,200,247,181,5,247,2,163,209,207,
+230,27,190,173,105,88,127,139,139,133,112,31,66,251,235,5,223,6,219,248,12,
+5,142,152,140,151,151,26,218,89,186,54,64,91,118,80,75,30,196,247,162,5,11,
+249,173,248,21,21,251,196,6,121,57,5,247,114,6,133,113,124,73,110,93,88,97,
+25,95,85,81,118,70,27,65,75,167,185,108,31,115,174,126,192,196,26,227,174,
+242,192,209,30,218,200,225,182,236,27,200,189,121,105,172,31,165,112,149,
+11,248,160,21,251,3,252,160,5,223,6,200,247,181,5,247,2,163,209,207,229,27,
+189,176,104,93,133,137,125,135,122,31,65,251,241,5,223,6,219,248,12,5,142,
+152,140,151,152,26,215,86,188,56,63,73,112,86,87,30,152,204,5,11,248,133,
+248,160,21,251,123,252,44,91,248,44,5,54,6,205,252,160,89,54,5,97,115,120,
+125,105,27,124,129,141,148,120,31,123,62,5,131,162,152,136,159,27,168,169,
+148,154,163,31,166,157,156,159,166,185,248,5,249,14,24,11,168,194,198,30,
+191,186,174,211,196,96,29,11,171,29,116,100,122,128,102,138,25,127,6,129,
+6,124,141,134,139,134,140,123,64,24,131,157,150,137,160,27,209,189,172,214,
+183,31,248,4,249,14,5,11,21,251,166,6,124,70,5,247,166,6,14,248,56,21,205,
+247,201,5,45,6,251,47,253,109,5,247,211,175,29,251,128,57,21,247,102,187,
+29,251,103,6,11,151,29,147,160,98,31,111,101,5,113,190,167,131,178,27,224,
+199,220,29,134,135,139,137,127,31,14,26,98,162,89,171,110,30,102,180,205,
+118,216,27,247,60,247,21,233,247,38,170,31,247,1,248,148,5,11,6,247,47,249,
+109,5,45,6,60,252,4,5,118,57,79,130,80,27,32,95,163,196,146,140,150,141,148,
+31,227,29,127,128,26,93,163,97,179,114,30,113,11,240,29,129,99,116,79,27,
+90,106,159,169,31,144,7,147,7,14,101,157,27,149,145,147,151,144,136,143,122,
+154,31,105,166,83,208,118,179,8,179,117,134,146,131,27,131,134,136,130,134,
+31,79,39,122,117,86,92,8,118,120,138,138,130,26,129,146,132,148,159,11,247,
+182,248,163,21,55,6,251,4,252,163,5,223,6,11,26,166,131,165,123,164,30,117,
+174,110,159,92,152,251,64,188,24,62,161,115,159,183,26,175,153,169,169,166,
+30,172,176,187,155,206,27,195,181,128,119,161,31,158,122,152,107,110,26,130,
+138,11,177,29,128,124,131,123,127,103,203,29,144,150,137,135,149,31,117,204,
+156,135,161,27,183,182,11,69,147,29,146,161,178,29,11,159,29,111,114,11,247,
+118,247,141,21,247,46,247,19,247,60,252,12,5,247,2,6,251,98,248,67,247,253,
+247,190,5,251,12,6,252,80,252,9,218,248,9,5,45,118,29,11,248,160,21,122,61,
+124,172,129,153,117,155,25,158,113,107,150,105,27,62,61,101,77,90,31,85,72,
+102,251,3,46,26,251,1,210,63,241,202,197,166,192,190,30,135,120,5,11,132,
+29,14,107,29,14,247,72,248,160,21,251,19,252,236,180,29,142,139,148,27,247,
+7,182,166,221,157,31,247,26,249,13,5,11,249,121,46,29,250,64,46,29,249,1,
+113,29,11,6,156,221,5,11,21,251,0,36,40,34,63,197,83,217,247,4,240,237,247,
+0,212,79,196,61,31,123,73,21,190,172,106,90,76,77,80,74,92,104,174,186,202,
+199,198,204,31,11,247,141,247,224,21,248,33,108,29,252,33,6,189,247,125,5,
+248,48,108,29,252,141,6,251,47,253,109,5,248,159,108,29,252,66,6,11,250,63,
+158,29,11,31,152,100,123,143,121,27,113,109,124,118,123,31,127,124,131,122,
+127,247,10,29,145,149,137,135,150,31,117,203,156,135,161,27,11,247,224,21,
+68,251,224,5,233,6,247,47,249,109,5,45,6,72,251,207,5,252,9,6,206,247,207,
+5,45,118,29,210,247,224,5,11,249,121,122,29,11,249,95,150,29,242,6,247,76,
+242,150,29,242,6,11,21,85,85,87,86,100,170,108,179,196,191,190,196,178,109,
+167,97,31,131,95,21,159,154,125,119,112,113,113,111,119,124,153,160,165,166,
+165,166,31,11,106,168,30,175,98,86,155,61,27,36,58,110,83,85,31,98,97,108,
+68,88,26,76,183,86,206,120,30,247,63,91,5,220,116,171,111,90,26,108,11,6,
+251,47,253,109,5,233,6,11,124,29,252,65,6,11,132,29,247,75,242,132,29,11,
+21,247,20,247,40,5,75,6,35,41,83,237,5,76,6,203,251,40,5,11,174,29,242,238,
+195,40,5,203,6,74,247,42,5,11,232,29,82,107,163,181,172,158,172,169,157,31,
+163,154,168,147,189,146,233,152,147,140,183,154,8,11,138,29,248,159,108,29,
+11,147,29,146,161,98,31,111,101,5,113,11,207,29,208,153,141,154,142,154,31,
+247,1,248,148,5,45,6,37,252,114,5,132,11,247,174,6,247,0,230,184,228,212,
+31,207,223,187,247,37,247,17,26,212,109,213,92,181,30,173,101,86,157,74,27,
+251,174,6,11,21,212,182,91,58,80,123,74,111,89,31,69,101,85,104,71,27,68,
+95,188,220,197,156,204,166,189,31,207,175,196,176,205,27,11,146,251,105,21,
+223,6,199,247,173,5,74,170,180,113,210,27,217,214,175,201,190,31,193,206,
+173,242,238,26,247,12,72,214,32,11,247,206,249,27,21,248,9,189,29,233,6,247,
+47,249,109,5,252,197,118,29,14,200,106,171,51,161,30,63,158,5,83,153,110,
+159,165,26,159,151,11,150,29,243,6,11,193,29,251,102,6,235,248,86,193,29,
+251,102,6,235,248,86,5,53,6,14,21,118,41,5,194,6,80,128,115,110,100,27,131,
+101,5,202,11,27,90,247,9,29,248,160,21,50,6,170,247,36,222,29,108,251,36,
+5,68,6,125,72,5,210,6,60,252,6,5,137,129,138,11,208,22,223,6,247,3,248,160,
+222,29,11,21,248,31,221,29,252,32,6,189,247,125,5,248,48,108,29,252,142,6,
+251,47,253,109,5,11,165,186,173,150,176,27,162,159,136,131,159,31,113,207,
+173,130,176,27,188,189,158,174,182,31,114,209,5,115,11,247,72,248,160,21,
+251,3,252,160,5,223,6,197,247,164,11,137,147,27,148,145,145,160,150,31,167,
+195,189,202,183,176,8,152,149,146,147,144,26,152,133,147,129,120,11,146,161,
+178,29,135,135,139,137,126,31,11,31,136,121,130,98,120,128,66,132,25,251,
+26,127,97,129,90,108,8,87,106,109,86,81,26,59,193,91,11,56,213,251,0,52,56,
+98,72,88,30,92,76,102,251,5,57,26,85,163,84,177,102,30,105,174,183,123,11,
+21,117,36,5,198,6,57,125,118,112,91,27,131,101,205,136,189,188,156,224,25,
+165,247,11,5,14,6,73,251,206,125,69,94,85,85,127,25,123,65,247,4,144,215,
+216,165,247,27,25,188,247,125,5,11,24,151,29,11,93,224,61,172,30,153,105,
+112,143,70,27,251,172,77,247,183,6,247,13,191,84,251,22,251,22,87,11,21,135,
+121,138,131,129,26,80,191,99,11,21,35,6,117,36,5,11,159,29,110,115,11,239,
+140,25,144,6,149,6,157,224,5,141,126,131,140,128,27,81,95,113,68,76,31,156,
+221,5,11,206,163,29,14,249,109,21,251,1,252,149,127,83,126,106,117,114,25,
+112,115,102,122,102,27,85,103,169,185,11,248,160,163,29,11,247,22,247,21,
+191,195,247,13,31,205,29,11,21,252,81,247,99,122,62,247,245,251,55,252,58,
+251,56,122,60,248,169,247,99,5,14,21,251,20,245,29,11,152,133,144,140,139,
+139,145,140,25,141,149,140,238,29,11,117,36,5,187,6,129,82,118,111,103,134,
+131,101,24,200,143,183,187,156,218,160,239,24,11,251,32,55,80,251,3,120,30,
+223,6,148,167,146,153,153,153,8,162,161,181,153,182,27,11,6,234,251,141,5,
+233,6,33,247,178,247,66,247,130,5,38,6,251,40,251,93,5,11,183,29,36,5,223,
+6,11,6,247,30,249,27,5,11,6,124,67,5,11,132,107,27,111,109,145,154,95,31,
+147,116,132,140,116,27,100,102,128,111,82,31,11,249,109,21,251,47,253,109,
+5,232,164,29,247,253,108,29,11,247,119,176,29,11,21,33,218,29,14,181,204,
+160,31,14,248,137,248,160,21,251,125,252,43,93,248,43,5,49,6,207,252,164,
+87,58,11,136,198,129,177,120,173,8,209,98,69,176,44,27,251,9,42,92,45,61,
+31,11,5,45,189,29,252,10,164,29,45,6,14,21,251,20,251,42,5,203,6,11,6,219,
+199,226,29,251,13,30,11,21,247,17,251,13,157,221,53,222,247,13,223,157,222,
+251,69,251,14,5,11,27,128,112,145,148,113,31,152,100,123,143,122,27,113,109,
+124,118,122,31,11,98,31,111,101,5,113,191,166,131,178,27,224,199,220,29,11,
+249,89,21,115,251,3,138,251,26,5,179,6,194,247,26,163,247,3,5,11,5,83,127,
+124,125,88,27,133,134,139,141,125,31,124,68,5,136,146,11,6,206,184,155,175,
+176,31,175,173,159,188,189,26,216,82,191,57,30,11,21,112,116,116,113,111,
+162,116,166,166,162,162,166,166,116,162,112,31,11,21,55,6,251,3,252,160,5,
+223,6,247,47,249,109,21,55,6,117,11,21,169,164,114,109,109,114,114,109,109,
+114,164,170,168,165,164,168,31,11,30,143,97,141,117,127,26,121,133,129,127,
+133,137,140,150,128,30,149,11,193,29,251,110,6,234,248,86,222,29,14,6,221,
+179,108,75,49,62,68,40,31,11,21,33,6,247,16,251,40,5,193,6,11,6,251,30,253,
+27,5,11,21,231,165,213,203,220,27,210,184,91,64,130,138,131,137,123,31,11,
+180,247,86,222,29,94,251,105,5,136,124,137,124,128,26,79,11,247,102,21,251,
+20,251,40,5,199,6,247,73,247,40,5,14,222,29,43,252,86,5,11,22,233,6,212,247,
+237,5,11,21,110,121,129,131,11,129,188,27,247,25,230,213,247,23,167,31,247,
+8,248,183,5,11,6,219,198,226,29,11,21,247,120,6,202,186,155,175,184,31,202,
+189,175,215,220,26,11,22,223,6,235,248,86,5,247,124,6,155,213,5,251,209,6,
+11,178,176,200,27,182,166,114,100,112,124,112,116,124,31,126,119,11,250,192,
+247,204,21,254,135,165,29,250,135,6,14,247,243,247,204,21,251,131,165,29,
+247,131,6,14,8,192,6,168,160,145,143,162,27,11,6,123,65,5,11,247,183,201,
+251,172,6,56,104,132,114,102,31,74,96,105,11,161,27,145,150,137,135,149,31,
+117,203,157,135,160,27,184,11,251,1,252,148,5,40,118,58,79,251,6,27,42,75,
+185,11,247,140,248,216,21,76,251,188,5,201,6,229,248,61,5,11,199,184,203,
+247,5,29,14,247,181,231,29,11,21,89,248,248,7,107,107,108,87,115,80,8,178,
+6,11,152,140,148,142,158,31,52,6,132,113,137,123,118,26,11,31,78,106,80,101,
+79,27,72,97,188,219,199,155,203,11,233,29,238,6,11,247,103,5,80,251,168,21,
+55,6,117,36,5,223,6,11,248,227,247,161,21,252,120,165,29,248,120,6,11,119,
+27,129,112,145,148,113,31,152,100,123,143,121,27,11,6,247,17,251,40,5,192,
+6,11,48,143,35,5,169,6,187,243,11,184,203,167,109,162,102,11,6,157,221,5,
+11,5,55,6,11,236,29,5,125,11,144,147,178,24,79,134,95,91,122,60,118,39,24,
+11,30,247,5,6,144,162,5,126,151,131,158,161,26,11,159,181,187,31,192,186,
+171,211,211,26,245,70,200,11,201,247,182,5,45,6,76,251,187,5,136,126,138,
+11,247,1,251,2,247,68,247,8,237,180,219,217,30,11,247,26,247,22,26,247,71,
+251,0,247,3,251,68,11,249,109,21,55,6,65,251,242,116,251,103,5,11,247,3,29,
+223,6,11,31,251,0,247,70,21,77,126,51,86,51,27,11,38,249,109,5,251,12,6,252,
+51,253,109,5,11,251,20,251,42,5,199,6,247,72,247,42,5,11,6,173,247,49,5,46,
+6,105,251,49,5,11,6,247,3,248,160,222,29,85,251,148,11,6,183,247,100,5,51,
+6,95,251,100,5,11,139,144,27,156,153,129,127,107,113,116,102,11,21,53,252,
+37,5,199,6,225,248,37,5,11,30,163,160,150,160,150,183,8,83,6,99,11,55,6,70,
+103,86,103,72,27,60,94,188,11,247,237,5,251,1,6,251,135,251,194,5,11,218,
+105,30,125,173,166,135,208,27,247,172,11,6,203,247,194,5,45,6,11,251,40,5,
+199,6,247,72,247,40,5,11,222,29,251,3,252,160,5,223,6,11,6,247,59,251,247,
+251,230,252,10,5,11,6,251,141,251,178,251,18,247,178,5,11,21,118,41,5,193,
+6,80,128,115,110,11,248,160,21,55,6,251,3,252,160,5,11,30,148,184,5,132,118,
+117,136,114,27,11,167,109,162,102,135,135,139,137,126,31,11,217,21,251,123,
+6,247,83,247,225,5,11,110,110,102,103,169,110,176,174,168,169,11,21,35,6,
+117,35,5,243,6,14,107,159,169,31,144,7,147,7,14,104,203,29,11,249,109,21,
+45,118,29,14,131,178,27,224,209,29,249,226,78,29,11,248,119,22,247,3,248,
+160,222,29,76,251,189,5,251,0,116,11,195,29,217,29,113,11,249,86,249,109,
+21,207,29,11,248,188,190,21,137,130,135,139,135,27,113,127,148,159,142,139,
+143,140,142,31,203,247,193,5,145,11,91,29,14,31,218,248,7,222,29,53,252,40,
+5,137,129,138,128,126,26,71,191,98,225,217,196,163,195,197,30,127,82,5,14,
+131,29,164,157,156,30,162,163,169,149,183,27,198,172,117,99,11,175,8,132,
+7,135,7,97,167,115,187,151,142,139,145,163,30,141,145,141,140,145,232,29,
+82,107,11,248,173,249,121,21,251,5,42,97,54,58,31,50,47,86,251,23,251,20,
+26,52,166,63,185,93,30,91,187,220,110,224,27,233,224,166,189,204,31,247,9,
+229,215,247,54,247,50,26,218,11,184,30,188,90,60,167,48,27,127,58,21,207,
+203,111,95,173,31,166,104,153,92,79,26,47,108,43,86,66,30,58,80,51,93,42,
+27,74,76,167,183,104,31,112,174,125,186,198,26,231,170,236,192,213,30,218,
+197,228,186,233,27,14,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,1,135,255,2,135,
+254,2,243,2,0,1,0,4,0,7,0,14,0,25,0,108,1,20,1,51,1,182,1,191,1,240,2,33,
+2,73,2,113,2,120,2,124,2,131,2,150,2,240,3,15,3,99,3,222,4,14,4,99,4,212,
+4,253,5,126,5,237,5,250,6,8,6,14,6,33,6,40,6,119,7,72,7,76,7,79,7,83,7,87,
+7,91,7,117,7,121,7,124,7,129,7,134,7,137,7,140,7,144,7,148,7,152,7,155,8,
+13,8,63,8,67,8,71,8,75,8,101,8,106,8,109,8,113,8,117,8,147,8,164,8,192,8,
+221,8,227,9,2,9,5,9,96,9,101,9,106,9,109,9,118,9,121,9,124,9,131,9,146,9,
+151,9,158,10,2,10,5,10,8,10,26,10,118,10,134,10,149,10,156,10,159,10,186,
+10,190,10,236,10,241,10,246,11,96,11,115,11,221,12,35,12,67,12,190,13,42,
+13,49,13,127,13,218,14,151,15,3,15,10,15,45,15,55,15,62,15,69,15,81,15,100,
+15,113,15,147,15,205,15,209,16,5,16,30,16,37,16,48,16,61,16,71,16,88,16,124,
+16,211,16,219,16,226,16,232,16,240,16,244,16,252,17,4,17,10,17,19,17,30,17,
+38,17,99,17,107,17,111,17,116,18,36,18,77,18,81,18,184,19,9,19,14,19,19,19,
+54,19,58,19,214,20,75,20,104,20,127,20,222,21,36,21,39,21,130,21,181,21,216,
+22,14,22,28,22,43,22,88,22,107,22,154,22,221,23,84,23,98,23,229,24,19,24,
+127,24,203,24,211,24,220,24,228,24,236,24,243,24,252,25,47,25,71,25,84,25,
+97,25,110,25,118,25,125,25,135,25,145,25,173,25,184,25,196,25,206,25,217,
+25,240,25,254,26,8,26,20,26,29,26,41,26,53,26,61,26,70,26,80,26,91,26,102,
+26,113,26,157,26,187,26,235,26,244,26,253,27,6,27,15,27,24,27,31,27,40,27,
+49,27,65,27,75,27,84,27,93,27,101,27,138,27,153,27,162,27,171,27,180,27,193,
+27,203,27,214,27,235,28,42,28,54,28,70,28,93,28,142,28,158,28,241,29,31,29,
+107,29,155,29,235,30,69,30,108,30,198,31,42,31,73,31,81,31,122,31,130,31,
+138,32,1,32,10,32,13,32,22,32,31,32,70,32,79,32,199,32,209,32,217,32,230,
+32,236,32,244,32,252,33,4,33,12,33,20,33,68,33,77,33,99,33,108,33,117,33,
+126,33,144,33,152,33,161,33,168,33,177,33,183,33,242,33,251,34,4,34,13,34,
+32,34,93,34,102,34,119,34,126,34,139,34,148,34,166,34,175,34,195,34,204,35,
+26,35,35,35,44,35,96,35,108,35,140,35,178,35,187,35,196,35,205,35,225,36,
+11,36,18,36,25,36,113,36,144,37,9,37,19,37,40,37,48,37,55,37,62,37,78,37,
+87,37,124,37,143,37,154,37,173,37,180,37,189,37,198,38,26,38,76,38,82,38,
+88,38,96,38,106,38,115,38,122,38,129,38,138,38,157,38,166,38,175,38,185,38,
+192,38,200,38,228,38,236,38,244,39,61,39,75,39,158,39,190,40,51,41,27,41,
+134,41,209,41,213,41,217,41,221,41,225,42,125,42,167,42,174,42,178,42,195,
+42,202,42,219,43,18,43,30,43,37,43,46,43,54,43,60,43,68,43,76,43,104,43,130,
+43,200,43,217,43,228,43,237,43,247,44,75,44,117,44,145,44,237,45,26,45,37,
+45,62,45,72,45,95,45,105,45,112,45,119,45,126,45,134,45,144,45,147,45,150,
+46,4,46,79,46,149,46,196,47,65,47,157,48,50,48,115,48,197,49,102,49,135,49,
+202,50,28,50,41,50,53,50,76,50,92,50,163,50,233,51,111,51,182,51,254,52,47,
+52,105,52,149,52,166,52,206,52,245,53,42,53,96,53,135,54,41,54,67,55,29,56,
+22,56,53,56,78,56,118,56,159,56,220,56,241,57,17,57,78,57,130,57,154,57,250,
+58,13,58,32,58,55,58,124,58,193,58,236,59,1,59,121,59,224,60,45,60,98,60,
+139,60,192,61,68,61,182,62,26,62,184,63,4,63,28,63,44,63,70,63,98,63,141,
+63,241,64,8,64,31,64,62,64,74,64,82,64,189,64,205,64,219,64,245,65,3,65,10,
+65,30,65,67,65,169,65,218,66,17,66,119,66,135,66,151,66,176,66,180,66,183,
+66,197,66,224,66,228,66,232,66,235,67,91,67,96,67,99,67,125,67,129,67,133,
+67,166,67,170,67,173,67,176,67,214,67,218,67,222,68,92,68,95,68,191,68,196,
+69,43,69,176,69,210,70,50,70,55,70,172,70,177,71,40,71,45,71,83,71,111,71,
+182,71,209,72,95,72,98,72,119,72,206,73,7,73,28,73,33,73,158,73,203,74,33,
+74,37,74,143,75,30,75,143,76,12,76,39,76,54,76,62,76,77,76,85,76,101,76,113,
+76,124,76,140,76,149,76,161,76,176,76,190,77,41,77,50,77,58,77,65,77,72,77,
+80,77,90,77,104,77,121,77,155,77,174,78,13,78,20,78,74,78,78,78,129,78,168,
+78,172,78,180,78,195,78,238,79,12,79,65,79,68,79,123,79,211,79,234,79,238,
+80,90,80,113,80,132,80,151,80,166,80,193,80,199,80,215,81,0,81,105,81,204,
+82,49,82,72,82,177,83,36,83,175,83,182,83,189,83,196,84,4,84,50,84,105,84,
+185,84,210,85,29,85,103,85,107,85,202,86,8,86,125,86,169,86,230,86,239,87,
+26,87,36,87,48,87,76,87,85,87,98,87,116,87,169,87,205,87,247,88,25,88,93,
+88,137,88,146,88,155,88,237,89,118,89,170,89,215,89,235,90,19,90,53,90,212,
+91,44,91,125,91,132,91,192,91,195,91,232,92,55,92,58,92,70,92,90,92,123,92,
+135,92,148,92,165,92,234,93,57,93,80,93,85,93,195,93,216,93,237,94,2,94,36,
+94,56,94,71,94,151,94,221,95,54,95,80,95,164,95,251,96,101,96,113,96,168,
+96,212,96,242,97,15,97,38,97,80,97,92,97,105,97,156,97,178,98,2,98,12,98,
+49,98,94,98,101,98,116,98,139,98,148,98,169,98,220,98,237,98,253,99,53,99,
+92,99,112,99,144,99,206,100,3,100,12,100,20,100,92,100,183,100,233,101,69,
+101,115,101,166,101,190,102,18,102,130,103,68,103,145,104,43,105,7,105,116,
+106,44,107,5,107,99,107,173,108,14,108,49,108,81,108,116,108,150,108,222,
+109,38,109,148,109,210,109,247,110,3,110,28,110,56,110,85,111,15,111,50,111,
+65,111,130,111,181,111,230,112,58,112,115,112,178,112,244,113,6,113,26,113,
+44,113,85,113,135,113,184,113,233,114,27,114,54,114,81,114,109,114,137,114,
+158,114,197,114,243,115,15,115,42,252,32,14,252,32,14,252,32,247,255,135,
+10,14,251,211,247,94,179,29,204,22,200,10,14,249,12,249,77,21,63,6,62,251,
+86,5,251,16,6,215,247,86,5,63,6,62,251,86,5,251,13,6,126,75,5,247,1,6,66,
+251,76,5,251,4,6,125,75,5,240,235,10,247,17,235,10,247,10,6,153,203,5,32,
+6,212,247,76,5,244,6,153,203,229,10,38,75,21,66,251,76,5,251,17,6,213,247,
+76,5,14,248,43,249,150,21,128,85,71,134,78,115,99,102,25,94,97,109,67,72,
+26,98,153,107,170,113,30,160,121,159,130,212,114,81,251,164,24,66,160,111,
+167,194,26,148,140,158,141,158,30,140,150,5,60,6,133,105,137,122,116,26,48,
+192,91,247,9,121,30,117,36,5,198,6,161,242,212,141,205,163,183,179,25,190,
+184,172,219,214,26,187,123,170,98,166,30,115,155,124,146,57,164,192,247,141,
+24,194,136,174,104,86,26,135,139,131,138,130,30,138,124,5,218,6,144,159,140,
+149,155,26,229,81,195,39,144,30,150,193,5,251,28,252,1,21,70,160,113,165,
+188,26,215,201,200,223,146,30,126,251,228,21,220,115,167,113,91,26,41,80,
+80,33,131,30,14,247,107,249,139,249,89,21,252,186,253,109,5,205,6,248,186,
+249,109,5,252,116,112,109,29,248,64,251,188,109,29,14,132,248,201,247,226,
+21,127,90,123,106,107,102,41,247,55,24,247,17,196,195,203,227,26,214,88,186,
+57,251,1,40,50,42,116,144,115,148,118,30,157,97,141,135,142,131,143,128,25,
+100,117,111,122,113,120,8,64,84,102,71,58,26,45,204,82,244,220,196,164,215,
+230,30,185,61,5,245,6,49,247,43,188,190,178,210,151,200,25,251,159,239,21,
+98,198,133,151,167,26,198,186,186,198,182,165,114,99,85,101,98,49,94,30,210,
+251,189,21,79,66,94,116,89,27,71,98,178,204,205,184,190,247,5,200,31,14,252,
+88,247,107,249,88,247,16,10,251,233,248,27,174,10,70,67,90,73,89,49,8,64,
+251,28,104,251,13,251,20,26,251,12,168,251,14,188,52,30,194,6,101,236,122,
+231,242,26,247,115,226,247,113,247,60,247,98,30,14,251,233,187,251,105,21,
+203,205,197,218,185,222,8,213,247,25,174,247,18,247,25,26,247,6,109,247,17,
+92,222,30,84,6,177,41,156,46,32,26,251,108,50,251,116,251,58,251,96,30,14,
+251,177,247,211,174,10,119,251,4,39,179,109,80,243,108,47,51,186,99,220,234,
+183,43,197,176,86,230,247,5,166,130,201,251,2,101,168,247,4,5,14,49,248,227,
+247,161,21,251,99,6,183,247,96,5,69,6,95,251,96,5,251,99,165,29,247,99,6,
+95,251,100,5,209,6,183,247,100,5,247,99,6,14,252,32,247,1,242,145,29,251,
+233,202,29,252,32,247,105,242,102,29,252,32,248,15,174,10,252,27,253,129,
+5,194,6,248,27,249,129,5,14,248,54,249,89,21,56,70,99,57,83,31,75,47,91,251,
+72,251,37,26,78,157,85,171,109,30,109,170,187,121,188,27,225,205,177,223,
+197,31,203,232,187,247,70,247,36,26,247,15,72,211,251,5,30,127,62,21,205,
+177,92,58,45,106,251,44,101,59,31,53,99,92,101,74,27,76,101,187,218,234,171,
+247,42,177,222,31,222,178,187,179,202,27,14,248,3,248,141,21,251,0,252,141,
+5,227,6,247,43,249,89,5,81,6,85,251,0,118,126,251,36,119,126,76,24,14,248,
+160,226,21,252,13,6,156,188,194,188,230,184,247,4,196,24,247,25,207,204,221,
+239,26,184,124,180,112,169,30,177,105,91,157,71,27,251,46,51,62,251,61,100,
+31,227,6,151,184,151,169,157,164,8,183,170,189,164,197,27,209,185,97,74,75,
+92,79,55,97,31,35,87,251,65,47,93,85,95,251,53,25,248,107,6,14,247,182,247,
+217,21,141,159,150,139,153,27,222,188,105,82,251,0,61,65,251,4,67,93,178,
+200,150,140,148,143,171,31,51,6,135,109,138,125,121,26,251,0,207,80,247,17,
+229,215,169,195,191,30,184,189,167,210,204,26,196,118,172,82,167,30,224,187,
+176,198,228,26,228,68,196,251,3,56,69,110,83,90,30,110,105,121,101,120,67,
+8,227,6,149,183,148,163,154,159,8,181,169,186,161,196,27,205,179,106,86,100,
+126,102,118,116,31,108,112,87,123,65,27,133,6,127,6,14,247,254,247,62,21,
+103,251,62,5,227,6,175,247,62,5,245,6,156,217,5,33,6,237,248,97,5,73,6,252,
+52,252,83,119,47,5,247,208,217,21,251,113,6,247,178,247,200,5,14,249,9,249,
+89,21,252,6,6,251,27,252,22,5,219,6,193,201,167,152,198,27,219,185,95,62,
+251,17,57,49,251,6,59,97,179,219,136,31,51,127,6,129,7,80,153,101,174,110,
+30,107,177,190,122,202,27,233,213,177,216,198,31,183,197,164,212,211,26,244,
+66,206,251,5,91,97,126,109,89,30,209,247,90,5,247,192,6,14,248,246,150,10,
+140,150,139,149,145,26,235,70,201,32,45,59,89,40,76,30,81,48,92,251,68,251,
+18,26,251,9,214,66,247,10,224,212,176,211,194,30,180,192,165,210,200,26,242,
+68,207,32,73,83,113,81,82,30,247,61,168,221,244,240,27,162,159,133,129,156,
+31,162,124,147,127,145,109,8,144,111,139,139,137,26,138,139,137,138,137,30,
+251,50,251,51,21,207,185,95,74,251,4,60,49,39,69,91,188,209,247,0,220,223,
+241,31,14,249,51,249,89,21,252,111,6,120,52,5,248,19,6,251,117,251,145,251,
+0,251,50,49,251,103,8,237,6,206,247,81,247,73,247,163,247,63,247,60,8,14,
+247,125,248,9,21,34,91,85,61,37,26,36,220,74,247,18,223,210,171,202,195,30,
+182,187,164,200,197,26,197,112,183,83,171,30,176,162,160,153,145,145,8,177,
+173,164,196,193,26,174,125,174,115,165,30,174,106,92,156,74,27,62,80,115,
+86,88,31,97,97,116,85,83,26,95,149,121,181,104,30,247,78,247,141,21,207,180,
+107,85,109,126,106,119,114,31,105,111,100,123,86,27,72,100,170,191,222,201,
+197,227,31,76,251,190,21,217,189,97,73,42,59,64,34,64,89,182,202,236,220,
+216,240,31,14,223,247,54,21,138,128,139,129,133,26,43,208,77,245,200,196,
+161,183,191,30,203,193,176,203,167,244,8,164,232,156,244,200,26,187,121,187,
+109,172,30,175,105,88,158,77,27,49,65,101,68,89,31,97,78,117,76,80,26,33,
+207,72,247,1,183,185,152,161,171,30,152,148,152,149,169,165,8,251,72,99,69,
+49,38,27,75,104,178,208,31,247,113,248,106,21,207,190,89,72,251,0,57,53,37,
+68,97,181,212,246,220,228,236,31,14,252,32,247,128,242,132,29,247,4,248,160,
+102,29,252,32,247,217,248,160,132,29,251,63,251,210,145,29,49,226,247,90,
+156,10,49,248,245,247,247,247,1,10,117,39,21,252,119,165,29,248,120,6,14,
+49,248,232,247,159,157,29,248,7,247,91,21,149,186,153,189,155,158,213,194,
+25,242,217,181,203,217,26,184,117,183,103,167,30,162,110,98,150,86,27,251,
+36,49,60,251,47,108,31,224,6,247,2,161,187,186,227,27,203,182,104,88,82,111,
+97,62,77,31,32,56,124,120,125,78,127,84,24,209,43,21,49,6,117,36,5,229,6,
+14,247,233,249,151,248,137,21,103,73,5,198,127,101,169,80,27,251,41,251,59,
+251,63,251,44,55,192,84,221,187,174,155,183,193,31,141,141,145,144,146,144,
+8,130,7,134,7,123,151,117,153,130,30,129,154,165,133,171,27,231,247,2,196,
+218,200,31,186,200,169,233,226,26,247,68,251,42,247,22,251,97,251,50,251,
+52,73,251,4,251,3,30,251,1,251,1,76,251,33,251,23,26,61,163,73,188,84,30,
+60,210,247,0,93,247,7,27,221,228,154,166,213,31,126,206,5,115,50,86,131,77,
+27,251,76,251,15,244,247,48,247,128,247,137,247,124,247,139,247,62,247,15,
+34,251,37,251,27,251,15,251,44,251,1,117,120,156,158,148,146,155,156,172,
+31,247,41,247,172,5,251,130,93,21,182,163,116,97,95,108,64,96,79,31,83,100,
+92,108,95,27,95,107,175,189,189,167,204,182,191,31,189,182,189,167,188,27,
+14,132,32,29,14,132,58,29,187,34,29,14,187,80,10,14,132,37,10,14,76,247,147,
+247,224,21,247,239,108,29,251,239,6,189,247,125,5,248,31,108,29,252,125,118,
+29,14,243,52,29,14,187,103,29,252,32,62,29,14,251,66,75,29,14,132,98,10,71,
+10,14,247,51,94,10,187,47,10,14,243,32,10,14,132,79,10,243,249,113,138,21,
+61,216,5,247,3,238,201,247,29,247,36,26,223,112,216,93,186,30,188,91,59,167,
+48,27,51,61,114,87,70,31,251,11,50,61,251,50,251,45,26,251,73,245,33,247,
+72,217,184,151,178,212,30,226,52,5,251,41,247,156,21,81,83,201,77,5,117,89,
+112,132,97,27,251,23,61,218,247,26,232,170,235,192,212,31,219,197,228,186,
+233,27,207,202,112,94,174,31,166,104,153,92,79,26,251,12,92,251,2,52,55,30,
+14,187,247,146,247,206,21,247,131,6,204,175,113,90,122,136,118,134,117,31,
+115,39,139,139,107,26,123,140,128,142,119,225,29,150,141,156,143,161,30,158,
+244,141,152,77,10,110,96,122,75,27,14,132,45,29,14,76,91,10,14,187,47,29,
+14,132,248,28,22,248,44,249,109,5,40,6,251,228,252,253,56,248,253,5,42,6,
+246,253,109,5,14,247,162,40,10,14,132,92,10,132,48,29,14,76,58,10,14,252,
+32,248,41,174,10,251,78,6,251,92,254,66,5,247,78,6,154,211,5,37,6,247,62,
+249,178,5,241,6,14,252,32,247,39,174,10,217,253,129,5,194,6,61,249,129,5,
+14,252,32,116,251,105,21,247,79,6,247,92,250,66,5,251,79,165,29,242,6,251,
+62,253,178,5,36,6,14,251,97,247,241,249,89,21,251,126,252,16,5,211,6,247,
+74,247,191,197,251,191,5,208,6,65,248,16,5,14,248,187,251,18,169,10,252,88,
+247,148,248,113,21,161,242,5,92,6,150,199,159,165,177,143,147,178,24,77,135,
+95,92,121,58,118,39,24,14,43,29,14,247,101,174,10,251,47,253,109,5,214,6,
+156,217,5,67,171,181,110,213,27,206,210,169,187,184,31,206,210,183,247,6,
+242,26,247,4,63,223,38,98,95,127,121,109,30,122,129,126,127,108,106,197,247,
+167,24,229,251,159,21,212,183,87,53,81,122,76,110,91,31,71,98,87,106,74,27,
+71,96,189,218,201,157,207,167,187,31,205,178,192,174,199,27,14,251,66,61,
+10,14,249,30,68,29,14,65,10,14,252,32,248,6,248,160,247,22,10,49,10,14,82,
+29,14,252,88,247,153,155,29,14,252,88,104,29,183,247,97,21,55,6,117,36,195,
+10,14,251,66,103,10,14,252,88,247,199,131,10,14,247,51,247,74,188,10,209,
+247,221,5,215,155,207,201,206,27,188,172,112,97,128,137,126,137,126,31,62,
+251,253,195,10,209,247,221,5,217,155,208,199,211,27,186,168,110,91,124,139,
+139,130,105,31,67,251,233,195,10,218,248,9,5,142,150,142,172,150,26,166,127,
+167,119,161,30,163,117,113,149,92,27,73,83,113,82,80,31,195,123,100,166,73,
+27,70,94,119,79,75,31,152,204,5,14,35,10,14,66,10,14,129,29,61,59,96,83,112,
+30,157,223,5,58,6,247,107,77,123,10,248,86,251,105,21,247,49,249,117,5,64,
+6,120,53,5,205,116,88,174,66,27,71,68,109,91,94,31,72,68,95,251,6,36,26,251,
+4,215,55,240,180,184,151,157,168,30,155,149,151,150,173,173,80,251,167,24,
+137,249,55,21,206,182,89,60,77,121,71,111,91,31,73,100,86,104,79,27,68,93,
+191,219,197,158,211,166,184,31,205,178,195,174,203,27,14,251,233,140,29,165,
+247,14,210,200,247,2,135,25,185,10,14,251,66,248,150,248,14,55,29,133,139,
+131,138,131,31,14,252,32,248,2,77,29,14,54,29,14,251,66,247,179,22,247,203,
+248,160,5,48,6,251,136,252,58,90,248,58,5,47,6,213,252,160,5,14,187,41,29,
+14,251,66,247,242,247,159,21,247,125,247,149,5,42,6,251,59,251,84,51,247,
+84,5,46,6,247,10,251,149,251,131,251,159,5,237,6,247,66,247,92,229,251,92,
+5,233,6,14,251,66,57,10,14,251,66,59,29,14,251,232,248,67,174,10,92,6,70,
+138,86,88,125,59,103,251,58,24,121,50,109,100,81,129,124,69,24,177,133,158,
+115,98,26,123,136,117,133,110,30,104,251,58,5,135,121,137,120,122,26,90,171,
+110,193,30,186,6,153,204,5,123,6,101,123,149,163,149,140,150,142,151,31,178,
+247,73,5,143,158,141,159,161,26,190,128,161,102,164,30,195,169,177,195,153,
+210,178,247,73,24,191,150,156,154,189,27,155,6,14,252,50,247,147,174,10,251,
+93,254,65,5,199,6,247,93,250,65,5,14,251,232,123,251,105,21,186,6,207,135,
+189,188,157,226,175,247,58,24,153,223,173,184,197,148,154,209,24,102,145,
+119,162,176,26,160,142,159,145,170,30,174,247,58,5,143,158,141,156,153,26,
+188,104,172,88,30,92,6,125,74,5,155,6,177,155,129,115,129,138,128,136,127,
+31,100,251,73,5,135,120,137,121,122,26,96,154,106,172,110,30,73,108,114,103,
+122,49,100,251,73,24,87,128,122,124,89,27,123,6,14,49,248,178,248,47,21,87,
+128,118,116,103,27,125,125,144,151,121,31,37,208,5,150,124,122,144,120,27,
+75,90,88,45,114,31,191,6,191,155,163,166,170,27,149,157,132,131,150,31,224,
+76,5,123,161,167,129,163,27,177,178,160,173,164,31,157,163,148,162,146,180,
+8,14,251,233,215,251,97,21,223,6,213,247,242,162,247,103,5,99,6,72,251,103,
+5,200,247,168,21,223,6,161,242,222,29,14,248,43,248,99,21,175,133,140,139,
+150,133,8,166,125,156,109,103,26,133,139,131,138,130,30,223,6,140,154,5,140,
+154,140,150,142,26,196,96,197,82,160,30,146,119,122,142,114,27,158,229,5,
+99,6,120,49,68,132,89,118,91,96,25,67,74,93,251,8,251,7,26,32,204,64,242,
+128,30,118,41,5,179,6,160,236,247,26,147,215,203,174,247,23,25,55,6,108,57,
+96,102,68,131,8,100,142,21,79,147,102,188,209,26,225,176,232,194,192,30,165,
+164,165,152,177,146,8,14,248,83,248,12,21,251,52,6,133,159,139,140,130,162,
+8,124,181,138,145,163,138,10,251,39,251,27,251,11,251,22,114,143,123,156,
+98,30,142,133,142,131,142,131,8,56,6,127,84,5,247,5,6,148,109,140,134,124,
+26,68,83,68,251,10,62,30,176,73,5,139,29,96,120,166,29,145,144,146,144,146,
+144,166,159,24,183,173,155,154,154,159,8,164,175,157,188,172,26,143,138,149,
+138,152,30,138,150,5,247,29,6,14,252,32,248,120,78,10,14,248,209,247,246,
+21,251,46,6,247,169,247,247,5,54,6,251,140,251,214,251,8,247,214,5,54,6,247,
+22,251,247,5,251,46,6,128,88,5,247,67,6,122,62,5,251,66,6,128,88,5,247,66,
+6,102,251,67,5,227,6,176,247,67,5,247,65,6,149,190,5,251,64,6,156,216,5,247,
+64,6,14,248,203,248,100,21,251,5,6,166,208,5,223,171,181,183,186,27,156,150,
+134,124,159,31,185,217,5,152,114,115,145,113,27,53,55,72,35,96,31,96,36,5,
+251,17,165,29,247,4,6,251,57,252,49,5,61,108,101,103,89,27,119,126,144,153,
+122,31,104,53,5,131,156,151,137,162,27,247,5,217,204,247,34,195,31,247,50,
+248,33,5,247,19,6,14,248,211,150,10,141,147,139,139,141,148,8,148,164,140,
+148,158,26,219,76,194,49,251,4,36,49,40,109,147,115,157,116,30,79,107,127,
+131,116,113,8,111,107,119,89,98,26,97,156,108,185,100,30,247,37,251,16,5,
+167,115,149,120,110,26,83,88,93,78,88,103,171,184,152,141,150,145,160,30,
+54,6,131,113,136,125,118,26,55,203,85,237,203,198,164,184,179,30,173,178,
+159,186,180,26,173,131,162,117,169,30,179,152,171,159,162,166,8,169,174,161,
+196,183,26,168,131,163,123,161,30,129,151,130,148,105,166,251,19,240,24,105,
+166,131,151,162,26,191,188,186,195,190,171,109,92,122,136,125,132,119,30,
+251,147,251,187,21,105,168,129,158,171,26,187,164,170,209,179,30,247,23,33,
+5,172,113,159,104,109,26,91,106,97,75,106,30,14,248,162,247,83,21,96,193,
+5,169,168,163,199,186,26,165,136,154,129,155,30,208,195,92,197,71,83,5,157,
+119,104,150,101,27,105,99,128,123,111,31,94,197,73,83,181,84,119,112,128,
+123,137,136,25,123,108,130,107,108,26,114,144,117,148,121,30,79,90,183,81,
+204,191,5,122,159,169,131,179,27,178,177,150,158,167,31,181,86,5,52,247,203,
+21,189,178,102,92,73,75,78,70,88,100,176,188,204,204,199,208,31,14,252,119,
+247,90,179,29,14,251,233,247,131,248,113,21,161,242,5,92,6,149,197,160,166,
+174,224,29,247,146,22,161,242,5,91,6,150,197,159,166,175,224,29,14,247,39,
+168,29,247,78,50,176,29,14,251,233,247,32,168,29,14,251,233,247,199,167,10,
+14,251,66,248,0,248,160,43,10,247,89,153,29,251,66,248,6,248,160,43,10,247,
+121,247,164,21,55,149,10,223,6,14,249,8,247,204,21,252,203,165,29,248,203,
+6,14,249,0,248,137,21,251,86,237,29,251,86,6,122,58,5,247,85,6,251,18,252,
+233,5,227,6,247,18,248,233,5,247,87,6,14,249,0,248,137,21,251,83,237,29,251,
+82,6,122,58,5,247,82,6,73,251,200,5,251,82,6,122,58,5,247,82,6,95,251,100,
+5,227,6,183,247,100,5,247,83,6,156,220,5,251,83,6,205,247,200,5,247,83,6,
+14,252,32,153,10,251,29,249,57,174,10,251,142,6,251,38,251,28,251,33,251,
+44,251,0,200,73,243,136,31,46,252,73,5,203,6,247,71,249,223,5,222,6,251,71,
+253,223,5,203,6,247,71,249,223,5,195,6,14,251,216,247,166,248,106,21,59,65,
+66,59,85,183,96,195,221,213,212,218,197,97,179,79,31,14,252,88,225,242,247,
+16,10,251,233,208,242,76,10,204,22,160,29,14,251,233,247,91,249,88,76,10,
+204,22,160,29,14,247,211,167,10,247,110,228,176,10,14,247,218,247,133,242,
+132,29,247,247,242,132,29,247,247,242,102,29,247,218,249,29,249,118,21,252,
+192,253,138,5,205,6,248,192,249,138,5,252,37,126,73,10,247,134,252,30,73,
+10,248,10,194,73,10,14,76,247,236,247,217,21,129,92,125,89,123,120,65,84,
+25,91,102,114,116,119,113,8,107,97,120,87,93,26,107,152,106,161,114,30,101,
+172,184,122,206,27,247,36,229,218,247,47,170,31,54,6,251,2,117,91,92,51,27,
+74,97,173,192,193,171,188,211,196,31,244,219,157,161,153,200,151,194,24,69,
+235,21,229,6,161,242,5,49,6,14,251,233,247,177,249,120,169,29,251,233,247,
+238,90,10,14,251,233,247,166,105,29,251,233,248,54,249,99,84,10,251,233,201,
+10,251,233,247,62,249,109,67,29,251,233,248,6,249,95,102,29,251,233,247,177,
+105,10,251,233,247,216,249,134,116,29,14,251,233,247,57,22,89,10,169,195,
+5,14,251,233,247,111,249,120,70,29,251,233,247,57,22,104,126,122,130,120,
+127,8,101,114,118,105,102,26,91,188,112,224,167,158,142,146,160,30,148,184,
+5,132,120,115,136,112,27,100,112,157,165,155,146,158,152,154,31,156,159,153,
+149,190,164,146,142,147,143,146,143,8,14,251,233,247,227,248,228,57,29,247,
+218,201,29,247,218,75,10,14,251,196,248,42,247,246,21,251,180,6,128,88,5,
+247,180,6,176,247,38,21,131,138,5,138,135,136,139,137,27,130,131,145,147,
+141,139,141,140,142,31,180,247,82,5,140,142,139,147,146,26,180,99,164,75,
+87,97,126,115,114,30,123,124,133,126,127,96,8,195,6,177,150,165,158,182,27,
+161,162,133,133,145,31,149,127,140,136,131,26,134,138,134,138,134,30,137,
+131,132,114,132,136,95,134,25,60,131,113,133,110,121,8,107,119,121,107,102,
+26,88,173,110,200,181,176,153,168,169,30,111,142,154,124,168,27,146,140,139,
+143,157,31,140,144,140,140,143,31,69,247,2,21,106,133,86,106,94,27,103,122,
+151,164,156,150,159,156,149,31,157,150,152,142,196,147,163,142,149,141,156,
+145,8,14,247,153,247,207,21,247,88,247,10,156,218,251,88,251,10,210,247,227,
+229,10,59,252,10,56,88,122,60,222,190,81,251,168,5,248,88,221,29,251,251,
+6,14,243,53,10,14,247,218,249,67,247,219,21,247,218,221,29,251,219,6,190,
+247,130,5,247,228,108,29,252,66,6,123,63,5,200,108,88,166,55,27,46,40,91,
+62,70,31,62,52,82,251,62,251,32,26,251,38,231,43,247,31,226,202,169,209,196,
+30,123,62,5,248,70,108,29,251,232,6,67,239,21,56,82,70,98,55,27,43,80,201,
+241,235,171,247,28,178,208,31,229,191,211,186,227,27,227,190,100,57,158,31,
+14,251,201,248,24,247,246,21,251,155,6,128,88,5,247,155,6,98,248,75,21,84,
+87,113,95,106,31,112,102,119,69,83,26,73,185,95,206,198,189,164,185,172,30,
+166,177,160,207,190,26,172,124,177,119,157,30,155,121,109,149,106,27,130,
+87,21,179,164,111,94,46,88,66,74,97,114,166,186,232,191,211,205,31,14,247,
+107,38,29,14,252,32,95,29,14,252,88,247,131,248,50,21,206,247,207,222,29,
+66,251,239,66,94,125,72,211,183,72,251,206,195,10,213,247,239,212,181,153,
+206,5,14,76,53,29,14,247,162,249,218,247,51,21,69,103,86,104,73,27,61,90,
+186,214,159,141,152,144,164,31,248,22,6,153,217,142,163,171,26,236,56,213,
+251,0,56,48,96,79,96,30,206,110,80,175,55,27,44,60,98,63,89,31,94,71,107,
+251,0,58,26,86,159,88,173,104,30,106,171,185,123,197,27,226,218,178,207,189,
+31,144,127,142,133,148,128,8,84,181,187,116,208,27,247,13,241,212,247,1,171,
+31,252,187,247,195,21,211,183,91,59,80,123,71,113,91,31,72,102,82,101,73,
+27,70,96,187,218,247,49,226,247,16,247,3,31,247,102,251,48,21,232,166,213,
+202,221,27,209,183,91,63,129,138,131,137,125,31,14,76,247,237,247,241,21,
+155,6,192,162,136,129,162,31,176,124,159,108,96,26,36,49,57,251,6,30,108,
+6,129,6,122,61,5,136,157,150,138,158,27,235,222,176,207,195,31,180,187,167,
+213,196,26,180,118,178,103,164,30,119,153,124,146,104,150,8,246,171,193,201,
+230,26,226,67,195,251,3,71,72,119,104,87,30,92,107,113,99,125,75,251,6,252,
+174,24,222,6,247,6,248,174,5,208,154,204,183,226,27,210,185,104,86,65,61,
+81,39,31,129,6,14,251,233,247,165,248,216,21,76,251,188,5,203,6,229,248,61,
+5,95,6,106,74,129,133,48,127,129,93,24,14,49,247,6,248,13,21,124,67,5,248,
+71,6,93,251,111,5,209,6,200,247,183,5,14,248,190,188,21,137,132,135,138,133,
+27,114,126,149,160,143,139,143,140,142,31,232,248,72,222,29,76,251,189,5,
+32,116,68,69,53,27,85,107,169,189,149,140,150,141,148,31,216,248,0,222,29,
+251,50,253,124,195,10,187,247,118,5,118,160,162,131,176,27,209,198,166,195,
+193,31,137,131,138,132,135,26,93,160,121,193,153,144,140,144,161,30,141,144,
+141,140,145,31,14,247,218,248,66,249,54,21,247,45,6,150,194,5,252,10,6,127,
+84,5,247,46,6,58,252,18,5,207,6,248,101,22,247,87,247,233,66,251,233,5,206,
+6,232,248,73,5,49,6,251,101,251,254,84,247,254,229,10,46,252,73,5,206,6,212,
+247,233,187,251,233,5,14,187,63,10,247,52,208,29,96,6,106,72,126,130,49,132,
+130,93,24,248,221,247,21,157,10,165,253,31,21,251,122,6,159,177,161,158,188,
+162,208,171,24,220,175,184,195,201,26,202,93,177,63,40,80,90,36,114,30,201,
+6,148,170,145,155,150,152,8,164,158,170,153,172,27,180,168,115,103,102,112,
+106,89,115,31,74,108,33,89,103,99,114,42,25,247,196,6,14,49,249,5,248,65,
+21,251,99,6,183,247,96,5,68,6,96,251,96,5,251,99,165,29,247,99,6,94,251,100,
+5,210,6,183,247,100,5,247,99,6,78,251,177,21,252,120,165,29,248,120,6,14,
+132,247,118,247,83,198,29,246,77,193,251,15,30,251,100,6,164,247,10,5,45,
+118,29,197,247,165,21,193,247,148,5,247,87,179,10,247,52,208,29,97,6,105,
+72,126,130,50,132,129,93,24,248,245,247,21,157,10,251,2,252,245,21,118,39,
+5,201,6,160,208,10,251,152,251,158,126,80,5,247,91,192,21,251,21,6,247,57,
+247,62,5,14,49,216,29,251,163,46,181,10,213,247,250,181,10,14,252,50,247,
+147,249,109,239,29,251,67,252,176,239,29,14,251,166,247,231,249,66,21,56,
+71,71,56,56,207,70,221,224,207,206,224,222,71,207,55,31,140,96,21,197,187,
+91,79,78,91,91,79,82,91,189,198,198,187,188,198,31,14,129,29,63,63,98,81,
+109,30,200,247,181,222,29,247,64,251,159,123,10,247,52,247,137,248,112,63,
+29,248,166,247,74,157,10,251,32,252,245,21,117,39,5,201,6,161,208,10,251,
+153,251,158,127,80,5,247,91,192,21,251,22,6,247,58,247,62,5,14,251,233,248,
+19,247,236,21,251,123,6,158,170,161,156,193,166,207,172,24,222,180,180,189,
+199,26,204,92,180,63,40,84,92,32,115,30,202,6,208,156,171,169,196,27,180,
+165,115,103,104,111,105,92,117,31,76,108,251,2,83,112,108,111,38,25,247,192,
+6,14,202,247,233,247,217,21,247,26,6,175,157,126,112,130,137,127,136,128,
+31,126,83,138,136,113,26,128,140,134,142,127,30,217,6,144,164,5,130,147,136,
+146,153,26,150,141,150,144,171,30,145,168,141,156,149,26,166,133,150,116,
+157,30,174,160,154,153,151,162,8,150,161,146,169,165,26,200,101,167,58,30,
+251,98,6,45,252,81,5,209,6,192,247,140,21,167,247,26,5,247,21,6,183,158,126,
+106,118,131,115,128,124,31,119,123,118,131,104,27,185,247,246,76,29,49,248,
+237,247,161,21,252,141,165,29,248,141,6,14,247,143,248,200,21,239,184,175,
+106,155,122,171,97,25,153,111,127,142,113,27,54,61,98,69,91,31,94,74,106,
+251,1,54,26,86,160,88,173,105,30,107,172,186,122,197,27,231,217,179,215,193,
+31,184,201,173,247,2,221,26,246,88,235,34,229,30,234,180,100,177,40,96,5,
+142,135,136,141,138,27,127,148,127,147,126,148,135,142,127,147,120,150,133,
+143,131,144,131,144,97,94,24,151,130,151,131,143,137,154,129,149,133,141,
+137,142,137,147,132,148,131,50,98,24,247,44,251,33,21,213,182,92,57,71,29,
+14,49,248,165,248,63,21,251,70,251,38,251,7,247,37,79,90,247,7,251,38,251,
+70,251,39,178,90,247,70,247,38,247,8,251,39,200,189,251,9,247,39,247,70,247,
+38,5,14,251,233,247,119,248,110,21,140,154,146,139,148,27,189,167,121,107,
+79,95,99,74,98,112,161,173,144,139,147,140,147,31,140,151,5,75,6,137,118,
+138,130,128,26,73,183,102,219,244,217,209,233,172,126,161,108,154,30,189,
+171,158,170,191,26,194,93,174,68,87,95,121,105,108,30,119,118,128,116,127,
+91,8,202,6,146,170,144,151,148,150,8,162,156,166,151,171,27,178,162,121,110,
+84,106,114,65,31,135,6,127,6,14,202,249,17,248,73,21,245,137,97,188,49,27,
+71,78,109,83,91,31,91,81,110,58,64,26,36,196,76,233,198,189,162,186,182,30,
+165,167,155,167,163,199,8,68,6,58,109,93,96,84,27,82,101,184,207,192,156,
+198,167,182,31,187,171,181,165,187,27,191,162,112,73,142,31,103,247,197,76,
+29,132,32,29,220,247,201,39,29,132,32,29,151,247,202,122,29,14,132,32,29,
+166,247,176,73,29,132,32,29,148,247,201,168,10,132,32,29,198,112,10,14,132,
+32,29,247,45,247,180,84,10,187,248,4,116,21,247,66,141,247,6,228,218,247,
+90,82,10,60,44,90,251,29,251,18,26,53,169,64,194,90,30,174,108,168,127,206,
+129,101,68,115,10,223,200,220,29,134,135,139,137,127,31,14,132,248,218,250,
+63,21,251,20,251,40,5,200,6,247,71,247,40,5,252,75,252,243,56,10,132,248,
+131,250,64,121,10,251,227,252,244,56,10,132,248,141,250,38,120,29,252,25,
+252,115,56,10,132,248,132,250,63,187,10,251,204,252,95,56,10,252,32,62,29,
+247,65,101,10,252,32,62,29,240,106,29,252,32,62,29,247,4,250,31,73,29,252,
+32,62,29,247,4,250,63,169,29,187,47,10,162,250,42,175,10,114,109,124,118,
+122,31,127,124,131,122,127,104,8,193,6,168,160,145,161,10,243,249,1,111,29,
+251,88,251,90,33,29,243,248,174,250,64,122,29,44,251,91,33,29,243,248,186,
+114,10,251,43,69,33,29,243,248,174,250,63,188,29,66,89,33,29,243,247,22,29,
+112,215,94,55,10,247,60,247,150,21,110,121,130,131,119,97,29,170,29,132,248,
+183,249,171,121,29,247,146,251,168,45,10,14,187,248,227,111,29,142,251,102,
+37,29,187,248,153,250,64,122,29,234,251,103,37,29,187,248,168,114,10,175,
+57,37,29,187,248,150,250,63,188,29,247,12,77,37,29,132,248,200,111,29,251,
+120,253,33,132,10,14,132,48,29,247,9,114,10,14,76,58,10,251,80,247,38,57,
+29,248,94,90,10,121,253,69,44,29,14,248,29,249,121,121,10,203,253,70,33,10,
+248,39,249,95,120,29,149,252,197,33,10,248,28,249,120,187,10,228,252,177,
+33,10,42,10,129,248,132,21,85,85,87,86,99,170,109,179,196,191,190,196,177,
+109,168,97,31,131,95,21,160,153,125,118,113,113,113,111,118,125,153,160,165,
+166,165,166,31,14,42,29,218,248,97,21,111,122,128,130,160,10,123,127,103,
+8,192,6,167,159,147,144,206,29,182,182,203,159,31,14,251,66,247,163,116,21,
+247,21,143,225,209,171,247,21,202,10,70,95,247,19,10,155,140,150,142,26,171,
+100,10,81,163,82,178,103,30,163,116,159,130,186,130,101,69,115,10,224,209,
+29,248,104,90,10,122,252,142,35,29,248,25,114,29,219,252,143,35,29,248,36,
+115,29,164,252,14,35,29,248,20,163,10,246,251,250,35,29,252,32,95,29,247,
+33,90,10,14,252,32,95,29,208,105,29,252,32,95,29,219,249,88,73,29,252,32,
+95,29,219,249,120,169,29,35,10,247,170,247,87,195,29,120,97,29,182,203,160,
+31,14,248,100,90,10,251,84,251,93,36,29,248,19,114,29,46,251,94,36,29,248,
+31,115,29,251,41,66,36,29,248,16,163,10,71,86,36,29,41,10,247,51,247,149,
+195,29,119,27,129,111,146,147,114,218,10,110,124,118,122,31,127,124,132,124,
+126,102,166,10,184,182,182,203,159,31,14,251,66,248,55,248,228,121,29,247,
+82,251,106,50,10,14,248,99,90,10,47,253,120,39,10,248,16,114,29,148,253,121,
+39,10,248,30,115,29,90,252,248,39,10,248,12,249,120,21,33,218,29,174,252,
+228,39,10,251,66,87,29,251,48,247,108,39,29,251,66,87,29,251,110,247,83,120,
+10,14,251,66,59,29,251,12,247,35,21,247,21,247,40,5,74,6,36,247,4,10,14,251,
+201,247,69,248,236,21,72,251,208,5,200,6,176,247,66,5,200,152,179,177,192,
+27,168,160,121,114,135,138,130,137,131,31,95,251,101,5,200,6,186,247,117,
+5,141,147,140,147,146,26,185,104,170,86,96,100,126,113,108,30,145,169,5,14,
+248,6,248,160,43,10,247,184,206,247,22,10,243,248,6,248,160,43,10,247,184,
+206,43,10,247,75,153,29,243,248,6,248,160,43,10,247,184,206,43,10,247,121,
+247,164,21,55,149,10,223,6,14,247,52,249,121,78,10,252,158,251,21,21,76,251,
+188,5,201,6,230,248,61,5,96,6,106,72,125,130,50,132,129,93,24,248,229,251,
+248,21,197,125,10,121,166,103,158,30,103,108,10,14,247,52,249,150,78,10,85,
+66,29,252,79,247,167,63,29,14,247,52,249,150,78,10,85,252,121,21,196,125,
+10,122,166,103,158,30,102,108,10,251,135,150,10,251,111,6,57,251,123,5,188,
+6,168,170,161,149,173,27,186,166,113,93,65,89,85,71,94,115,163,186,137,31,
+86,128,6,70,180,101,214,238,222,225,242,204,96,179,71,109,113,131,122,111,
+30,181,247,10,5,247,69,6,14,247,52,249,87,78,10,138,66,29,251,88,150,10,251,
+176,6,127,87,5,247,122,6,251,25,251,38,81,53,76,251,33,8,196,6,192,247,29,
+216,247,8,247,16,247,20,8,14,251,233,247,201,249,89,21,87,95,114,90,104,31,
+100,85,110,35,54,26,63,182,93,210,194,181,162,190,175,30,178,193,168,243,
+223,26,217,97,184,65,30,130,84,21,177,161,112,94,83,121,53,117,93,31,91,116,
+112,118,102,27,103,117,166,184,216,165,237,172,185,31,162,155,163,152,165,
+27,14,251,233,247,164,248,20,21,118,39,5,202,6,160,239,5,204,6,151,194,5,
+74,6,196,247,162,5,92,6,251,148,251,157,126,79,5,247,88,194,21,251,14,6,247,
+48,247,53,5,14,251,233,248,80,249,89,21,251,128,6,55,251,128,5,195,6,171,
+177,155,146,174,27,186,166,115,95,70,92,89,73,91,116,161,187,137,31,75,126,
+6,109,143,124,148,124,30,106,159,182,120,192,27,198,186,162,186,177,31,166,
+173,154,183,181,26,204,92,181,67,111,121,135,123,106,30,175,241,5,247,78,
+6,14,251,233,248,68,248,227,21,140,151,139,142,144,26,199,95,177,70,79,89,
+109,79,99,30,104,85,111,37,62,26,68,187,94,215,193,185,162,182,174,30,164,
+171,155,181,176,26,202,93,181,70,101,110,127,109,103,30,230,158,184,192,197,
+27,173,163,118,108,31,138,128,5,47,45,21,178,166,115,102,77,94,90,83,98,111,
+166,179,198,184,185,198,31,14,251,233,248,107,249,89,21,251,194,6,126,79,
+5,247,123,6,251,28,251,41,79,52,82,251,21,8,209,6,178,247,3,247,5,247,56,
+243,236,8,14,251,233,247,249,248,144,21,189,167,161,172,187,26,194,92,176,
+69,50,68,78,61,111,147,126,167,118,30,80,111,106,91,80,26,76,191,99,219,234,
+220,212,224,173,122,167,109,157,30,83,247,38,21,179,162,121,109,96,103,108,
+89,100,117,156,168,184,173,170,189,31,102,251,66,21,185,168,116,101,86,93,
+98,80,96,109,163,173,194,184,181,197,31,14,251,233,241,248,24,21,138,131,
+139,131,134,26,81,184,100,207,177,177,153,165,171,30,178,171,163,179,156,
+201,8,153,193,149,200,176,26,207,89,184,64,82,92,116,96,108,30,113,103,125,
+101,104,26,73,183,98,209,177,173,152,166,169,30,48,119,96,88,83,27,105,116,
+160,171,138,31,143,7,145,7,247,19,247,158,21,178,169,111,101,80,93,92,80,
+98,115,163,179,199,184,187,195,31,14,198,247,182,107,10,248,174,154,29,149,
+140,151,230,10,121,137,122,126,26,96,159,97,174,111,30,117,167,173,196,29,
+14,132,32,29,47,247,190,67,29,132,248,160,247,111,21,166,251,111,5,170,6,
+102,126,123,131,139,10,98,112,156,166,182,176,173,228,178,31,214,29,247,2,
+247,111,5,247,180,247,6,29,14,187,34,29,86,248,72,39,29,187,34,29,61,247,
+180,57,29,187,249,149,248,139,21,153,7,247,37,57,218,251,42,251,18,37,92,
+48,67,30,63,44,91,251,27,251,10,26,62,157,79,179,86,30,78,186,200,112,232,
+27,247,77,247,4,228,247,92,203,31,44,6,119,89,123,106,117,110,8,78,93,71,
+105,62,27,92,94,153,165,107,31,100,170,119,191,209,26,237,169,241,190,214,
+30,227,199,214,183,229,27,184,184,128,121,165,31,170,119,154,102,87,26,137,
+139,130,138,132,30,95,248,48,21,35,6,116,35,5,243,6,14,187,80,10,247,56,249,
+89,57,29,187,63,10,132,37,10,247,246,249,89,57,29,132,37,10,248,20,249,212,
+102,29,132,247,147,247,224,138,29,248,88,6,102,125,123,132,139,10,97,113,
+156,166,161,151,160,161,160,31,157,154,151,146,201,169,156,221,24,252,65,
+6,14,243,51,10,251,159,250,56,52,10,243,249,171,248,21,21,251,196,6,122,57,
+5,247,113,6,135,119,127,81,104,84,87,95,25,93,85,82,118,70,27,66,73,167,182,
+108,31,117,172,127,187,198,26,236,172,234,197,212,30,221,204,221,181,231,
+27,219,199,110,87,164,31,149,118,142,125,104,26,234,6,197,129,177,113,176,
+30,206,94,66,172,37,27,251,10,40,100,62,64,31,48,48,81,251,34,251,23,26,251,
+64,244,251,4,247,53,242,247,4,187,207,195,30,142,42,5,197,6,67,250,43,247,
+8,29,252,32,62,29,247,87,250,38,102,29,71,10,247,69,249,237,39,29,71,10,247,
+130,249,27,134,29,186,188,221,209,10,187,47,10,87,101,10,187,47,10,63,249,
+171,57,29,243,32,10,169,247,171,70,29,187,34,10,214,248,179,39,29,187,34,
+10,193,248,31,57,29,132,44,10,87,248,60,39,29,132,247,230,117,21,223,206,
+157,175,195,31,210,185,192,226,211,96,29,131,136,120,30,227,6,72,10,75,168,
+83,190,105,30,169,120,167,130,208,130,102,98,29,134,136,139,137,126,31,14,
+76,91,10,247,61,249,171,57,29,187,46,10,251,125,247,116,146,10,112,113,112,
+118,125,153,159,166,165,165,168,31,14,187,46,10,251,172,247,102,70,29,76,
+58,10,251,59,247,186,39,29,76,58,10,251,49,247,161,102,29,132,32,29,247,81,
+247,157,21,251,166,6,123,70,5,247,166,6,14,76,91,10,251,3,79,62,10,187,34,
+29,251,53,248,73,46,29,247,162,40,10,108,106,29,247,162,40,10,128,250,38,
+73,29,132,48,29,228,106,29,187,247,82,248,138,21,32,252,138,5,233,6,210,247,
+224,5,248,10,6,68,251,224,5,232,6,246,248,138,5,214,6,153,209,5,64,235,29,
+252,11,235,29,65,6,124,69,5,247,60,22,248,11,6,120,51,5,252,11,6,14,132,37,
+10,248,101,249,193,88,29,243,52,29,251,69,250,68,46,29,187,107,29,247,145,
+248,244,46,29,252,32,62,29,247,156,250,19,21,251,139,6,123,70,5,247,140,6,
+14,252,32,247,241,174,10,45,149,10,174,6,116,126,130,132,121,124,8,97,103,
+124,115,105,26,94,187,108,206,160,151,141,147,163,30,148,184,5,131,112,135,
+138,124,27,102,116,156,166,169,164,173,189,178,31,145,143,145,144,143,142,
+8,14,251,66,75,29,78,247,103,46,29,132,100,29,247,5,247,13,10,186,187,222,
+158,31,158,232,5,14,71,10,193,251,34,96,10,187,47,10,252,0,247,13,10,186,
+187,222,209,10,243,32,10,247,79,247,127,88,29,187,34,10,251,84,252,92,134,
+29,187,187,222,157,31,158,232,5,14,132,45,29,251,37,248,61,46,29,243,51,10,
+252,14,83,247,2,29,101,27,130,101,5,203,186,187,222,209,10,187,46,10,251,
+0,247,58,88,29,187,248,204,251,42,21,132,120,115,136,111,27,99,113,157,165,
+171,171,182,190,174,31,247,2,210,183,195,162,235,247,1,248,148,24,45,6,126,
+29,105,132,93,123,26,98,162,89,171,110,30,101,181,203,119,220,27,170,157,
+141,147,177,31,74,105,107,102,96,26,89,186,111,223,171,157,141,147,161,30,
+14,132,37,10,247,75,249,226,67,10,252,32,62,29,133,250,52,67,29,251,122,247,
+167,155,29,232,37,21,251,19,252,236,217,10,133,139,141,126,31,124,68,5,136,
+145,142,139,148,27,247,7,183,166,221,157,31,247,26,249,13,5,183,247,97,21,
+55,6,116,36,195,10,14,252,88,247,37,22,247,18,248,229,106,10,14,42,10,251,
+61,248,107,78,29,171,30,163,160,150,160,151,183,8,83,6,99,128,99,116,79,27,
+83,112,160,181,141,31,14,56,29,107,157,115,166,133,30,68,102,115,112,94,26,
+90,187,111,221,163,146,140,148,180,247,4,29,98,112,156,166,180,188,187,194,
+152,123,29,14,251,66,38,10,135,248,28,39,29,251,66,38,10,107,247,136,57,29,
+251,66,38,10,143,248,3,102,29,108,249,26,68,29,247,247,247,159,134,29,187,
+188,221,156,31,159,232,5,14,248,186,249,33,21,251,42,6,127,86,5,247,42,6,
+107,251,44,118,10,247,19,248,236,5,201,6,150,192,5,78,6,155,215,222,29,251,
+103,251,159,128,10,14,40,29,100,247,178,57,29,40,29,132,248,45,102,29,248,
+100,251,42,21,132,121,114,136,112,27,99,112,158,166,167,166,179,180,171,31,
+224,204,178,187,156,199,8,241,29,224,161,140,148,143,154,31,248,22,6,153,
+217,142,163,171,26,236,144,29,194,27,159,154,140,145,170,31,69,97,116,111,
+98,26,112,151,119,163,127,30,128,161,178,131,176,27,168,157,142,146,160,31,
+251,152,248,137,190,29,14,248,161,50,29,64,247,11,10,215,187,190,158,169,
+172,240,29,130,98,116,79,27,89,107,159,170,31,144,7,146,7,14,248,159,150,
+10,123,63,5,204,102,99,165,76,27,62,63,101,77,90,31,85,70,102,251,0,49,26,
+251,5,209,57,235,210,193,168,204,193,30,133,112,124,69,121,98,111,108,25,
+107,109,94,121,88,27,71,99,166,184,31,155,54,7,138,130,139,131,135,26,55,
+207,86,247,0,219,215,164,179,180,30,185,183,168,209,166,247,17,232,248,74,
+24,251,130,77,21,206,178,94,62,251,49,51,251,21,251,1,70,99,185,217,247,48,
+229,247,20,247,2,31,247,12,247,145,102,29,252,88,247,199,131,10,247,91,101,
+10,252,11,247,195,131,10,247,107,249,109,134,29,187,188,221,156,31,159,232,
+5,14,35,10,247,103,247,108,39,29,35,10,247,85,207,57,29,41,10,165,247,170,
+70,29,251,233,140,29,162,247,7,208,147,10,247,22,247,108,39,29,251,66,49,
+29,142,247,254,39,29,251,66,248,150,248,14,21,144,160,140,148,152,26,209,
+72,187,42,64,29,163,157,157,173,10,31,133,7,134,7,138,128,5,64,247,255,46,
+29,251,66,49,29,251,131,252,74,134,29,186,187,222,158,31,158,232,5,14,251,
+249,248,1,77,29,179,247,236,62,10,54,10,164,249,134,210,10,108,167,98,31,
+131,95,21,160,153,204,10,14,54,10,129,249,120,70,29,251,66,59,29,40,247,183,
+39,29,251,66,59,29,50,247,158,102,29,247,184,249,33,21,155,215,5,56,6,123,
+63,5,79,6,127,86,5,199,6,251,19,252,236,5,222,6,200,247,181,5,243,162,213,
+212,222,27,192,175,111,98,123,138,131,137,129,31,62,251,255,5,222,6,223,248,
+32,5,141,148,140,148,151,26,210,88,181,52,61,85,114,77,85,30,170,247,40,5,
+247,99,6,151,192,5,14,252,32,248,2,136,29,130,127,26,90,173,109,194,159,169,
+142,143,154,30,155,212,5,132,107,135,138,126,27,118,125,150,155,143,140,144,
+140,144,31,217,248,3,5,227,6,251,140,252,153,62,10,187,41,29,131,105,29,187,
+41,29,151,105,10,42,29,247,7,248,74,88,29,251,66,57,10,251,138,247,109,46,
+29,251,66,61,10,43,248,29,46,29,40,29,212,248,26,88,29,49,10,129,247,171,
+46,29,252,32,95,29,104,249,109,52,10,252,32,210,29,247,115,249,76,21,251,
+126,6,124,70,5,247,126,6,14,252,88,104,29,85,247,109,46,29,251,66,103,10,
+140,252,2,96,10,252,88,247,199,131,10,34,79,62,10,35,10,100,252,220,96,10,
+41,10,247,79,247,126,88,29,251,233,247,73,150,10,251,4,252,160,195,10,197,
+247,164,162,247,6,208,203,152,29,251,95,252,220,62,10,54,29,251,30,249,109,
+67,10,54,10,247,44,249,76,88,29,248,230,150,10,55,6,76,251,189,5,251,0,116,
+69,69,53,27,84,105,168,187,147,140,148,141,149,86,10,159,6,60,106,95,93,91,
+26,91,183,109,210,166,158,142,146,160,30,148,184,5,133,122,114,135,119,27,
+109,114,159,164,159,150,159,163,161,31,173,170,152,149,162,151,8,14,251,233,
+140,29,163,247,7,207,147,10,241,207,57,29,251,66,247,146,116,21,208,142,181,
+150,182,165,8,191,171,172,199,203,26,247,20,29,31,133,7,134,7,138,128,195,
+10,144,160,140,148,152,26,209,73,187,41,81,10,67,189,97,241,126,30,101,69,
+152,133,145,140,139,139,144,140,25,141,150,139,238,29,111,115,146,161,97,
+31,111,101,5,113,191,167,131,178,27,223,209,29,248,146,50,29,235,247,19,21,
+160,237,5,84,6,198,150,163,168,178,27,147,177,5,76,92,91,56,121,31,119,46,
+5,14,186,247,205,21,104,80,195,10,138,128,139,124,136,26,251,55,207,55,247,
+23,201,198,154,170,196,30,159,232,5,91,47,101,126,90,27,55,96,201,247,14,
+31,153,247,107,7,175,198,5,251,138,6,142,160,145,166,145,157,8,247,162,6,
+175,198,5,251,177,6,247,30,199,201,196,226,27,191,176,121,86,201,31,188,219,
+5,186,83,86,159,70,27,53,66,106,71,79,31,95,90,106,83,114,74,8,76,6,104,80,
+5,218,6,132,116,133,114,136,121,8,14,248,56,247,152,247,196,21,247,4,6,201,
+184,155,176,184,31,198,188,176,213,209,26,181,122,185,113,165,30,171,109,
+95,153,74,27,251,72,6,251,43,253,90,5,227,6,220,248,18,21,192,247,142,5,218,
+6,220,182,104,74,95,118,97,102,110,31,115,107,103,128,87,27,247,223,251,14,
+21,217,6,153,203,5,60,6,164,247,9,5,59,6,114,251,9,5,76,6,126,75,5,202,6,
+102,251,62,5,137,129,138,127,130,26,88,171,111,197,155,150,140,143,162,30,
+152,211,5,135,122,131,138,128,27,118,125,150,155,141,140,145,140,145,31,248,
+65,247,24,21,143,156,140,146,148,26,186,94,171,73,50,73,85,67,98,161,121,
+210,120,30,184,128,5,163,133,148,131,124,26,109,109,118,95,103,121,152,165,
+144,140,148,140,147,30,61,6,135,121,138,131,128,26,85,185,107,218,236,204,
+190,215,180,117,160,79,154,30,93,150,5,109,147,126,148,153,26,169,164,158,
+180,169,153,129,117,133,139,135,137,131,30,14,247,190,247,213,21,247,29,6,
+151,194,5,251,52,6,134,156,136,147,138,142,8,117,201,139,139,165,138,10,251,
+40,251,26,251,11,251,22,110,141,133,166,73,30,140,136,5,56,6,127,84,5,247,
+5,6,145,120,142,127,133,26,251,27,6,127,84,5,247,33,6,122,83,78,74,50,83,
+176,73,24,139,29,97,119,166,29,247,11,229,147,146,166,210,8,247,12,6,151,
+194,5,251,13,6,144,139,145,137,154,30,14,247,81,247,212,21,247,103,6,155,
+217,5,251,103,6,189,247,126,5,247,211,6,155,217,5,252,42,6,251,43,253,90,
+5,227,6,247,216,248,130,21,34,252,130,5,219,6,190,247,134,160,247,0,214,213,
+225,136,25,157,224,5,141,127,133,140,132,27,97,89,106,75,85,31,156,221,5,
+14,252,32,153,10,252,32,153,10,251,233,202,29,247,218,201,29,247,107,248,
+130,248,224,21,140,153,140,147,147,26,208,94,179,62,78,86,112,87,98,30,100,
+89,114,67,74,26,50,187,89,223,229,208,194,232,166,30,67,6,84,119,105,111,
+94,27,95,111,170,189,183,154,194,160,174,31,178,162,172,160,176,27,178,164,
+115,101,137,139,134,138,134,31,247,211,251,90,21,73,82,109,85,98,31,105,92,
+116,64,73,26,55,190,89,224,205,196,168,195,179,30,175,186,161,213,207,26,
+221,88,189,54,30,126,74,21,184,167,106,86,101,128,92,121,106,31,93,115,102,
+113,97,27,94,111,172,192,244,198,224,212,31,155,248,20,21,252,171,253,89,
+5,205,6,248,171,249,89,5,14,252,88,247,200,249,88,21,45,6,118,39,5,136,123,
+137,122,124,26,89,164,110,185,135,30,147,177,5,114,144,129,152,168,26,150,
+140,150,144,160,30,188,6,14,252,32,248,120,78,10,14,251,233,201,10,43,29,
+124,248,132,146,10,247,7,10,167,31,105,247,62,39,29,82,29,98,247,103,46,29,
+65,10,251,96,248,59,149,29,214,188,247,15,10,89,247,9,29,252,88,247,153,247,
+3,29,173,6,75,97,103,93,99,26,94,181,107,199,157,152,142,146,161,30,148,184,
+5,130,116,138,139,127,27,105,118,156,165,171,171,188,184,174,31,247,47,174,
+10,55,6,116,36,195,10,14,251,166,247,216,131,10,247,162,248,77,102,29,66,
+10,50,247,159,52,10,76,53,29,247,140,249,18,39,29,252,32,210,29,247,104,83,
+10,54,29,247,14,83,10,71,10,247,248,247,253,102,29,243,32,10,93,247,160,67,
+10,132,44,10,251,234,252,211,21,118,41,5,193,6,80,129,115,110,100,27,131,
+101,5,202,186,188,221,209,10,76,247,235,22,151,164,29,247,130,108,29,252,
+208,6,121,57,5,247,133,189,29,180,6,89,10,14,252,32,247,57,118,21,138,148,
+144,138,146,27,160,168,142,143,155,31,154,233,10,141,140,145,140,145,31,217,
+248,3,5,228,6,153,206,5,155,10,128,138,129,129,26,108,149,119,162,126,30,
+94,55,99,29,146,161,220,10,191,166,131,178,27,224,199,185,202,247,5,29,14,
+187,47,29,252,48,247,91,149,29,215,187,190,158,169,172,93,29,132,32,29,200,
+112,10,106,247,53,39,29,243,53,10,247,225,249,196,39,29,247,218,75,10,247,
+104,247,184,39,29,188,247,1,22,233,6,241,248,118,5,247,13,165,208,196,247,
+13,27,221,192,108,90,132,137,126,135,121,31,251,21,252,246,217,10,133,139,
+141,126,31,122,60,5,136,146,142,139,148,27,247,18,181,164,223,157,31,247,
+38,249,67,5,142,152,140,152,151,26,223,80,180,251,15,251,8,74,117,81,81,30,
+153,204,5,53,6,14,76,248,91,248,106,21,177,247,69,5,207,10,101,251,69,5,251,
+52,6,125,72,5,247,52,6,53,252,39,5,233,6,225,248,39,5,247,52,6,153,206,5,
+14,209,22,159,10,49,252,61,180,29,141,139,149,27,247,6,183,166,221,157,31,
+242,248,121,170,10,63,6,14,252,32,248,2,150,10,51,6,169,247,36,222,29,109,
+251,36,5,67,6,125,72,5,210,6,122,55,5,77,6,128,86,5,200,6,90,251,125,5,136,
+128,138,127,131,26,90,173,109,194,160,169,142,143,154,30,154,212,5,131,106,
+137,139,126,27,117,124,151,154,140,31,142,140,143,140,146,30,188,247,122,
+5,221,6,150,192,5,58,6,156,223,5,228,6,14,251,66,247,71,247,71,21,240,222,
+243,251,154,5,236,6,251,37,247,194,247,150,247,114,5,251,12,6,251,167,251,
+146,195,247,146,5,53,6,251,6,252,160,5,225,6,14,80,247,115,84,29,251,42,247,
+97,62,10,187,47,29,251,45,247,81,21,110,122,129,131,119,27,128,112,145,148,
+114,112,29,183,182,170,29,247,107,38,29,251,113,248,70,39,29,252,32,62,29,
+247,136,250,42,195,29,160,10,122,127,104,8,192,6,168,160,146,161,10,247,162,
+40,10,117,250,56,187,10,14,247,162,40,10,214,101,10,187,41,29,141,163,10,
+14,187,41,29,219,90,10,14,132,48,29,234,250,63,169,29,251,66,57,10,251,134,
+247,108,169,29,251,66,14,252,32,14,247,239,248,147,119,10,90,4,247,67,247,
+33,251,33,251,67,251,68,251,33,251,32,251,69,251,67,251,31,247,34,247,71,
+247,62,247,35,247,33,247,65,31,251,1,251,55,182,29,251,20,251,0,21,146,54,
+150,98,169,94,8,76,181,203,107,222,27,216,199,166,193,181,31,175,186,154,
+184,146,232,128,89,128,117,113,109,8,84,91,79,113,58,27,58,79,165,194,91,
+31,113,169,128,161,128,189,8,247,238,247,0,182,29,14,248,14,248,163,119,10,
+251,1,251,99,184,29,251,20,251,5,21,150,89,150,117,165,109,8,84,187,199,113,
+220,27,220,199,165,194,187,31,165,169,150,161,150,189,132,54,128,98,109,94,
+8,76,97,75,107,56,27,62,79,166,193,97,31,103,186,124,184,132,232,8,247,238,
+247,5,184,29,14,59,247,188,111,21,156,222,199,243,247,11,247,43,180,192,155,
+160,154,163,8,177,202,157,194,193,26,220,69,207,54,91,95,118,101,107,30,118,
+114,128,117,126,93,8,242,103,86,187,58,27,54,72,70,52,74,163,87,220,251,2,
+31,247,44,251,96,178,73,165,36,8,14,251,56,247,160,249,137,21,66,251,18,76,
+49,251,32,251,68,240,251,15,247,53,251,120,153,97,222,247,32,223,247,11,247,
+3,247,26,251,10,247,37,41,247,31,77,247,0,8,14,121,248,215,22,159,7,132,141,
+116,144,62,158,139,140,112,156,25,69,187,100,216,228,26,148,7,155,7,159,103,
+148,126,151,124,8,92,177,200,109,193,27,230,211,213,232,231,74,210,57,113,
+128,136,121,103,31,136,138,131,134,129,135,8,169,183,148,165,176,26,229,67,
+210,47,46,68,69,49,103,146,120,173,86,30,163,88,120,145,112,27,61,73,64,51,
+45,211,67,233,219,209,190,229,182,31,140,114,5,131,7,84,113,69,101,95,30,
+92,90,138,138,251,14,110,131,137,24,119,7,14,251,35,247,192,247,153,21,127,
+7,68,107,69,90,102,30,108,98,86,122,87,27,126,116,248,119,162,6,251,50,145,
+60,227,142,247,61,8,53,185,182,109,218,27,205,196,202,212,208,115,176,251,
+1,239,31,251,2,241,122,165,99,247,9,124,48,77,49,35,56,8,60,73,103,81,76,
+26,64,200,77,212,180,180,156,169,172,30,158,157,150,154,156,176,8,14,215,
+248,20,248,130,21,159,100,114,146,106,27,39,55,56,41,42,229,54,242,171,169,
+147,155,166,31,190,170,174,196,191,26,182,120,189,104,192,30,247,42,247,42,
+142,121,161,82,154,110,25,119,150,144,133,149,27,146,144,144,146,142,139,
+139,136,157,31,132,174,137,161,166,26,171,145,189,146,162,30,141,144,139,
+141,141,26,145,135,143,132,136,136,139,138,136,30,129,105,109,135,103,27,
+112,117,141,146,104,31,142,121,139,139,136,27,133,133,132,133,123,181,115,
+194,122,31,162,132,145,137,5,251,140,251,65,21,211,199,78,66,65,79,79,65,
+64,79,199,214,213,199,198,216,31,14,215,247,244,247,152,21,251,55,96,247,
+55,251,58,187,247,58,247,53,182,251,53,243,6,231,162,204,217,226,26,235,54,
+220,39,42,57,56,42,54,205,62,232,116,30,166,247,203,21,208,197,80,69,67,81,
+81,67,67,82,197,212,211,197,195,213,31,14,251,66,247,127,247,83,21,147,117,
+123,143,122,27,70,79,82,73,101,168,115,184,190,186,164,181,169,31,160,169,
+148,170,184,26,247,212,7,171,133,161,123,162,102,8,163,101,149,101,85,26,
+89,129,97,115,81,30,168,6,178,185,160,199,204,26,220,107,219,76,214,30,83,
+206,137,141,131,149,134,146,25,203,91,7,14,247,135,247,148,248,163,21,115,
+116,108,66,103,26,251,16,79,247,16,6,104,156,96,176,84,30,52,52,180,98,227,
+226,157,120,161,126,161,134,25,206,122,142,138,5,251,15,198,247,15,7,143,
+140,178,149,165,145,141,140,25,150,144,158,150,171,160,227,52,24,180,180,
+52,226,157,166,153,164,143,150,25,142,146,144,159,150,182,8,247,15,199,251,
+15,6,129,179,133,162,136,146,135,150,125,164,121,166,226,225,24,98,180,51,
+53,109,166,126,145,49,161,25,247,14,80,251,14,7,136,138,72,121,132,137,119,
+127,104,116,25,51,226,98,98,5,247,186,80,21,239,222,54,38,36,56,55,36,34,
+58,221,245,243,222,220,245,31,14,69,131,22,249,0,249,0,253,0,6,247,201,251,
+74,21,209,198,81,71,70,76,78,68,74,82,197,205,210,198,200,207,31,14,69,247,
+194,249,24,21,251,42,251,21,251,19,251,40,251,47,247,17,251,20,247,44,247,
+46,247,19,247,18,247,45,247,45,251,19,247,18,251,44,31,90,4,247,19,242,36,
+251,19,251,19,36,36,251,21,251,18,37,243,247,22,247,15,244,242,247,17,31,
+14,69,247,194,249,24,21,247,44,247,19,251,19,251,44,251,45,251,19,251,18,
+251,46,251,44,251,17,247,20,247,47,247,40,247,21,247,19,247,42,31,248,0,253,
+24,21,249,109,253,109,253,109,7,248,1,248,231,21,251,17,34,35,251,14,251,
+22,241,35,247,18,247,21,242,241,247,20,247,19,36,242,251,19,31,14,247,218,
+247,28,22,249,109,248,1,253,109,6,14,69,76,174,10,253,109,249,109,249,109,
+7,14,69,182,22,248,155,248,155,252,155,6,248,103,252,103,21,252,51,248,51,
+248,51,6,14,247,208,249,175,206,21,251,192,248,197,251,192,252,197,5,14,247,
+218,225,247,173,21,249,41,6,114,109,102,65,121,26,131,147,131,147,149,144,
+143,155,152,30,181,187,173,166,220,186,8,162,152,143,142,146,26,151,138,140,
+106,158,30,74,176,96,172,99,186,8,160,121,137,140,130,27,129,132,132,130,
+118,171,76,169,101,31,253,41,6,14,247,218,250,37,247,173,21,199,253,41,7,
+169,177,171,202,160,26,148,132,146,129,130,137,138,118,121,30,103,97,99,107,
+86,107,8,86,108,139,139,127,26,132,143,136,162,126,30,220,92,173,112,181,
+91,8,123,152,144,135,149,27,147,147,147,147,157,102,213,114,169,31,14,247,
+218,249,94,247,172,21,123,119,129,123,127,117,8,129,121,125,101,132,26,130,
+147,132,149,148,142,141,159,155,30,179,186,171,164,229,193,8,156,148,141,
+142,147,26,148,133,145,118,150,30,83,167,76,189,102,183,8,152,129,131,146,
+134,27,126,131,133,129,120,176,65,164,109,31,252,63,6,164,169,177,214,157,
+26,149,131,145,127,134,135,136,122,124,30,112,105,70,83,99,118,8,99,117,132,
+134,131,26,131,142,134,148,134,30,239,79,161,122,186,86,8,118,158,140,138,
+148,27,149,146,146,148,159,107,200,108,179,31,14,251,66,247,170,37,21,249,
+41,7,114,170,212,102,157,27,147,147,147,147,149,135,144,123,152,31,91,181,
+112,173,92,220,8,162,126,136,143,132,27,127,138,138,106,120,31,102,74,106,
+96,92,99,8,118,121,138,137,130,26,129,146,132,148,160,202,171,169,177,30,
+253,41,7,14,251,66,247,110,249,105,21,253,41,7,164,109,65,176,121,27,131,
+131,131,131,129,143,134,155,126,31,187,97,166,105,186,58,8,116,152,142,135,
+146,27,151,140,140,172,158,31,176,204,172,182,186,179,8,160,157,140,141,148,
+26,149,132,146,130,118,76,107,109,101,30,249,41,7,14,251,66,247,111,247,15,
+21,118,155,124,149,117,151,8,149,121,101,212,10,99,164,107,193,49,8,122,148,
+142,141,29,66,102,114,108,30,248,63,7,114,169,214,94,29,200,170,171,179,30,
+14,251,66,247,13,71,21,96,247,155,182,7,251,57,247,151,21,119,155,123,150,
+117,151,8,149,120,102,212,10,98,163,108,194,48,8,122,149,141,141,29,65,102,
+114,109,30,248,63,7,114,170,213,94,29,201,171,170,178,30,14,251,95,247,153,
+249,124,21,77,6,251,84,252,8,247,84,252,8,5,201,6,247,84,248,8,5,251,114,
+251,204,21,251,53,247,204,247,53,247,204,247,52,251,204,5,14,247,208,247,
+87,248,236,21,247,192,252,197,247,192,248,197,5,14,69,247,199,248,155,21,
+251,39,251,9,251,6,251,35,251,38,247,7,251,8,247,37,247,35,247,8,247,8,247,
+36,247,33,251,8,247,10,251,31,31,14,247,218,250,8,248,158,21,75,251,72,252,
+195,6,247,102,220,116,192,251,178,251,19,5,62,7,247,178,251,20,162,191,251,
+102,221,5,249,3,6,14,251,233,197,247,130,21,247,66,251,232,5,123,147,149,
+132,151,27,147,144,143,146,146,137,147,136,147,31,251,23,247,221,247,23,247,
+221,5,142,147,141,147,146,26,147,134,143,131,127,131,133,121,129,30,14,251,
+233,247,167,247,130,21,251,66,247,232,5,156,130,130,146,127,27,131,134,135,
+131,133,141,131,142,130,31,247,23,251,221,251,23,251,221,5,136,132,137,131,
+132,26,131,144,135,147,151,147,145,156,149,30,14,58,248,39,248,28,21,251,
+105,6,65,247,77,229,10,247,125,252,213,5,222,6,247,125,248,213,229,10,34,
+251,157,21,63,251,72,64,247,72,5,14,251,66,247,191,247,184,21,251,148,247,
+217,5,129,117,134,119,118,26,120,146,123,159,114,30,209,52,83,34,5,121,106,
+129,110,120,26,119,148,116,159,104,30,165,96,139,139,128,26,121,126,129,117,
+30,121,78,221,6,227,161,154,198,179,130,158,84,213,31,105,185,127,166,169,
+26,158,143,151,158,174,30,247,191,252,12,5,149,160,144,157,159,26,160,131,
+157,114,171,30,100,188,5,102,186,129,160,172,26,157,142,153,151,171,30,183,
+245,5,161,6,161,149,129,114,143,31,148,170,143,165,168,26,190,122,159,95,
+30,71,6,101,125,150,171,31,155,7,110,108,125,106,100,26,112,147,114,153,127,
+30,128,149,153,136,170,27,179,6,14,251,142,190,22,247,217,248,213,251,217,
+55,247,133,251,54,251,133,55,247,133,251,55,251,133,6,14,184,248,227,248,
+236,21,109,135,110,131,117,30,113,130,127,129,118,27,121,132,150,203,111,
+31,118,189,122,167,117,158,8,167,106,96,154,90,27,251,16,36,42,251,9,81,160,
+93,182,101,31,176,107,170,125,200,130,144,176,24,89,149,114,149,113,160,8,
+106,166,118,184,183,26,222,209,210,219,194,172,109,50,183,30,74,171,171,114,
+190,27,213,180,197,243,31,151,7,163,251,230,21,133,169,134,155,131,157,8,
+184,118,105,163,93,27,66,74,78,70,115,146,108,151,112,31,182,43,139,139,140,
+113,8,102,141,104,108,95,27,100,111,156,183,107,31,94,202,139,139,134,144,
+124,157,116,156,116,150,8,152,112,108,146,109,27,130,6,138,104,174,127,154,
+129,157,111,25,196,48,139,139,165,111,8,103,174,178,120,180,27,186,201,162,
+173,184,31,181,172,160,172,175,26,163,138,142,101,224,30,116,190,132,162,
+160,26,168,161,161,168,179,162,112,74,155,30,14,243,247,8,151,21,155,149,
+147,146,150,27,149,148,136,134,146,31,108,186,139,139,166,27,178,180,168,
+188,172,31,168,183,154,197,208,26,196,7,140,146,145,139,142,27,161,152,136,
+132,149,31,152,131,142,131,151,91,181,251,60,24,95,150,154,116,158,27,172,
+182,169,188,178,31,126,153,5,135,128,134,137,133,27,118,128,152,177,130,31,
+110,247,3,123,196,126,160,110,157,25,233,172,179,176,192,26,219,75,200,55,
+83,94,118,94,96,30,181,112,93,164,88,27,41,61,56,34,78,157,110,198,106,31,
+178,117,157,118,114,26,133,138,131,137,129,30,150,136,5,172,178,151,163,165,
+26,161,125,156,108,155,30,84,167,139,139,131,146,8,118,156,128,161,165,26,
+193,179,180,191,200,176,86,50,30,129,7,129,7,251,40,7,83,136,114,129,110,
+30,119,132,125,122,130,27,133,133,142,144,131,31,156,115,126,145,119,27,98,
+112,110,74,117,31,247,195,247,251,21,222,137,151,127,182,30,160,168,157,145,
+170,27,194,178,103,89,106,120,108,109,123,31,110,124,121,133,77,124,8,14,
+206,208,249,10,21,247,149,253,10,5,227,6,247,151,249,10,5,251,195,252,164,
+21,251,74,248,91,5,248,1,6,14,77,143,22,248,240,6,251,151,249,10,5,51,6,183,
+37,21,247,75,252,91,5,252,1,6,14,187,247,253,210,21,68,221,5,248,131,97,252,
+82,7,87,199,5,82,6,247,114,251,154,247,114,247,154,5,82,6,87,79,5,248,82,
+97,252,131,7,14,187,247,253,248,213,21,210,57,5,252,131,181,248,82,7,191,
+79,5,196,6,251,114,247,154,251,114,251,154,5,196,6,191,199,5,252,82,181,248,
+131,7,14,251,17,247,72,247,3,21,85,69,201,100,222,247,1,5,247,162,6,153,211,
+5,251,122,6,217,239,5,247,66,6,154,211,5,251,27,6,205,225,77,178,43,251,17,
+5,251,149,6,125,67,5,247,110,6,60,39,5,251,53,165,29,14,49,216,29,185,247,
+110,247,1,10,91,251,112,21,252,119,165,29,248,120,6,14,251,113,249,6,250,
+37,21,251,187,253,168,251,2,248,32,251,55,66,150,106,243,185,247,28,252,133,
+247,244,250,68,5,14,252,36,247,80,248,159,21,176,133,218,130,232,231,10,142,
+138,128,149,30,129,149,151,134,152,27,166,160,161,167,169,111,163,104,96,
+108,108,81,125,31,123,75,134,70,251,69,26,251,120,7,95,143,78,149,34,185,
+29,129,128,154,10,14,69,247,244,251,97,21,248,250,7,183,135,201,129,243,231,
+10,141,138,128,150,30,129,150,149,134,153,27,165,161,161,166,170,111,163,
+104,95,108,108,81,125,31,123,75,134,66,251,65,26,252,242,7,14,69,247,171,
+249,180,21,252,250,7,95,143,77,149,35,185,29,128,129,154,10,248,242,7,14,
+251,17,247,18,247,135,238,10,164,31,98,221,159,132,166,27,200,191,174,216,
+193,31,102,164,5,87,97,113,122,100,27,115,126,144,166,86,31,164,90,110,149,
+112,27,81,90,104,60,86,31,145,251,87,238,10,165,31,98,220,159,132,167,27,
+199,191,174,216,193,31,102,164,5,88,98,112,121,101,27,115,125,144,166,86,
+31,164,90,111,149,111,27,82,90,104,60,85,31,14,251,17,248,168,211,21,252,
+125,165,29,248,125,6,252,59,247,200,156,10,251,17,193,211,21,124,67,5,248,
+125,6,154,211,5,205,247,197,157,29,49,248,254,248,13,21,252,141,6,78,251,
+183,5,209,6,185,247,111,5,248,71,6,14,184,248,235,248,247,21,69,251,164,6,
+251,5,134,95,123,107,30,86,112,80,103,76,27,84,84,167,183,110,31,115,176,
+132,183,247,17,26,247,164,69,251,161,7,251,41,144,101,166,95,30,69,181,215,
+98,229,27,222,209,172,201,184,31,175,188,145,175,247,54,26,14,184,248,235,
+22,247,161,7,247,41,134,177,113,183,30,209,97,62,180,49,27,56,70,106,77,94,
+31,102,90,133,103,251,54,26,251,161,209,247,164,7,247,5,145,186,157,173,30,
+189,166,197,173,200,27,196,194,110,93,168,31,162,103,145,98,251,18,26,251,
+164,7,14,247,218,249,147,247,108,21,200,252,98,7,145,246,195,189,247,1,137,
+8,205,29,66,44,26,251,8,184,56,243,29,201,251,183,6,251,1,137,83,189,133,
+245,8,14,247,218,248,106,248,234,21,252,173,251,161,78,248,234,200,251,160,
+248,173,7,14,178,248,55,247,189,21,109,174,128,150,121,155,8,168,107,99,155,
+101,27,50,56,57,52,74,185,93,205,197,194,167,218,241,31,55,215,176,116,194,
+27,230,222,220,227,204,93,185,75,99,91,123,110,95,31,117,124,133,135,81,96,
+8,168,106,21,199,213,196,168,182,27,179,171,108,101,83,84,86,82,111,121,147,
+169,102,31,116,158,129,149,121,161,8,68,22,113,117,128,132,103,117,8,110,
+92,115,130,110,27,98,107,169,179,195,193,191,197,180,185,108,81,186,31,14,
+247,218,249,62,247,59,21,90,140,109,156,86,197,8,192,185,176,161,182,27,145,
+200,127,6,79,81,103,73,89,31,207,85,81,173,80,27,61,83,82,58,59,192,84,217,
+191,192,164,184,179,31,147,147,144,144,155,158,195,70,203,102,199,142,8,251,
+121,247,30,21,135,134,139,139,133,133,8,92,93,106,121,98,27,99,112,169,185,
+185,167,168,184,173,162,127,94,187,31,149,130,139,139,148,130,8,14,247,218,
+249,120,247,165,21,252,117,88,248,117,6,64,4,252,117,89,248,117,6,96,247,
+230,21,92,97,121,128,103,27,122,127,142,158,77,31,160,69,121,143,113,27,86,
+96,114,87,103,31,179,108,5,187,181,152,148,174,27,159,139,139,115,222,31,
+116,212,141,139,168,27,199,182,165,191,168,31,14,247,218,249,121,247,20,21,
+103,110,109,103,103,169,110,175,174,169,169,174,176,110,168,102,31,252,125,
+22,103,247,7,29,174,176,110,168,102,31,247,138,248,133,21,102,247,7,29,175,
+175,110,168,103,31,14,247,214,247,136,251,48,21,62,54,247,143,6,138,224,5,
+64,249,171,247,254,253,171,69,6,140,54,5,247,132,224,66,249,171,240,224,253,
+143,54,243,6,14,247,214,249,99,249,126,21,252,128,69,6,247,97,251,245,251,
+97,252,22,5,68,248,135,247,107,67,7,136,251,35,5,251,227,6,247,96,248,22,
+251,95,247,241,5,247,219,6,143,251,34,5,210,6,14,251,243,247,70,247,184,21,
+202,205,178,186,165,184,8,180,208,164,216,196,26,191,113,173,100,53,73,251,
+34,251,210,79,30,111,108,119,119,126,128,8,122,123,133,132,132,26,132,146,
+130,145,146,169,163,165,165,30,127,47,137,113,108,26,83,166,105,185,174,168,
+160,183,164,30,152,160,146,159,151,26,146,133,145,132,131,133,134,125,132,
+30,94,118,124,123,119,27,125,132,148,158,165,158,247,17,154,219,31,149,194,
+21,247,159,184,167,224,184,27,156,150,122,113,109,129,90,124,98,31,114,72,
+104,84,78,72,8,14,251,90,241,249,50,21,172,213,139,139,177,27,186,178,121,
+105,163,31,173,92,160,64,66,26,109,137,115,130,80,30,192,70,112,151,85,27,
+90,100,123,105,105,31,93,92,111,72,74,26,251,1,222,54,246,215,200,180,216,
+182,30,177,207,167,247,22,243,26,247,92,251,3,247,37,251,45,94,92,129,121,
+99,30,247,191,252,54,21,125,50,132,107,125,95,8,61,112,93,95,85,27,83,106,
+190,225,247,8,205,234,220,180,176,118,99,165,31,14,247,218,248,139,249,75,
+21,251,92,137,10,251,85,31,135,251,208,21,251,82,247,80,5,184,194,204,162,
+209,27,208,203,116,96,196,31,179,99,21,187,82,162,76,66,26,67,116,75,93,83,
+30,251,84,247,87,5,247,44,251,127,21,95,84,72,115,69,27,69,75,162,186,80,
+31,247,85,247,85,5,251,125,251,45,21,95,193,116,203,209,26,211,162,203,186,
+196,30,247,82,251,80,5,14,113,247,186,248,38,21,251,14,67,76,60,58,26,113,
+146,111,155,97,30,88,64,124,106,98,26,85,176,99,188,193,182,192,206,179,124,
+186,98,224,30,178,188,178,178,195,185,8,192,201,176,158,175,27,173,161,109,
+95,85,115,62,105,89,31,100,114,101,115,106,27,108,111,160,162,152,146,146,
+153,140,31,161,141,154,154,158,26,155,127,151,122,110,115,108,101,93,175,
+107,190,189,196,172,194,186,30,180,186,161,195,194,26,208,99,185,81,60,72,
+92,251,56,251,49,30,130,158,136,157,161,26,214,178,193,233,194,30,251,56,
+251,224,21,180,64,156,95,106,26,108,118,117,109,102,112,170,182,178,146,155,
+189,215,30,14,247,218,248,61,141,21,137,161,145,139,173,27,247,172,201,251,
+183,6,123,6,247,109,248,6,5,229,201,86,6,167,187,97,164,96,66,5,251,62,222,
+10,251,16,190,53,229,110,30,111,90,180,113,5,247,126,248,131,21,251,105,251,
+255,5,68,158,105,197,240,26,247,21,191,195,247,13,30,14,247,218,249,23,248,
+53,21,252,68,252,53,5,248,214,181,252,105,6,247,244,247,234,5,14,247,218,
+247,125,201,190,10,247,3,148,29,84,251,13,31,14,247,218,249,147,201,21,251,
+183,6,251,13,87,194,156,29,67,43,26,251,7,184,55,243,29,6,14,247,218,247,
+125,247,58,190,10,247,4,148,29,83,251,13,31,247,135,251,3,21,252,170,84,248,
+170,6,14,247,218,249,147,247,58,21,251,183,6,251,13,87,195,156,29,66,43,26,
+42,167,72,198,93,30,107,179,176,130,229,27,247,172,6,90,4,252,170,84,248,
+170,6,14,247,218,248,164,247,108,21,247,131,200,251,96,6,227,247,47,5,247,
+8,201,58,6,172,198,97,163,92,56,5,251,35,222,10,251,8,184,55,220,105,30,106,
+82,182,116,177,206,5,136,165,151,138,181,27,247,172,201,251,183,6,119,133,
+139,140,130,31,170,247,45,21,58,251,33,87,157,108,190,136,211,25,247,182,
+247,108,21,51,251,47,5,251,94,6,145,246,195,189,247,1,137,8,14,187,218,247,
+187,21,221,210,5,248,188,181,252,139,6,177,10,248,139,181,252,188,6,14,187,
+249,23,247,187,21,57,68,5,252,188,97,248,139,171,10,252,139,97,248,188,6,
+14,187,247,95,248,44,21,177,10,247,209,171,10,252,2,97,21,248,51,6,221,68,
+57,68,5,252,51,6,57,210,5,14,251,14,248,196,63,247,2,10,126,79,169,10,251,
+233,249,39,250,29,169,10,247,218,234,185,21,179,91,247,12,239,5,67,206,228,
+100,235,27,247,83,247,47,247,50,247,86,214,117,209,98,199,31,247,3,232,99,
+187,251,4,46,5,210,64,66,169,45,27,251,83,251,47,251,50,251,86,68,157,78,
+177,77,31,187,180,21,111,189,127,186,194,26,247,55,247,19,247,24,247,47,215,
+198,114,82,200,30,178,91,21,170,89,155,83,79,26,251,54,251,19,251,24,251,
+47,60,66,172,198,86,30,14,251,66,247,220,135,10,248,48,230,29,178,6,207,215,
+29,14,251,212,188,247,23,21,247,148,247,148,251,148,6,14,251,212,188,247,
+23,21,247,148,247,149,251,148,6,247,96,251,97,21,251,44,247,45,247,44,6,14,
+247,197,189,22,250,4,205,253,194,249,184,73,6,14,252,122,247,110,242,10,14,
+251,212,247,115,242,10,247,96,247,148,21,65,6,85,251,148,5,196,6,14,69,150,
+22,248,219,248,37,6,251,184,247,220,251,183,251,220,5,190,251,242,21,247,
+220,7,247,132,247,162,247,133,251,162,5,251,220,7,14,233,167,22,247,194,6,
+155,217,5,45,198,96,212,238,26,247,83,247,38,247,52,247,65,209,187,116,88,
+177,30,169,100,153,97,90,26,46,98,40,69,65,30,95,93,99,111,61,101,123,61,
+24,247,193,108,29,251,93,6,215,178,192,179,182,191,8,198,211,176,239,230,
+26,247,47,251,9,247,2,251,57,251,2,35,94,54,51,30,58,60,93,33,251,2,26,37,
+179,68,233,78,30,251,94,6,14,247,218,248,98,247,134,21,34,101,177,74,223,
+212,120,251,3,5,219,6,120,247,3,223,66,177,204,34,177,244,176,101,204,55,
+66,158,247,3,5,59,6,158,251,3,55,212,101,74,5,14,247,218,247,125,247,108,
+21,248,98,6,134,33,82,88,251,1,142,8,251,183,77,247,172,6,222,174,146,164,
+177,31,205,183,171,211,241,26,247,0,92,224,62,214,10,247,1,141,196,88,144,
+33,8,252,98,6,14,65,248,182,247,136,21,146,7,138,199,138,151,132,172,8,245,
+117,52,206,251,7,27,251,39,46,32,251,59,251,59,229,38,247,40,247,6,213,191,
+242,171,31,141,146,5,82,6,132,123,134,130,136,135,8,89,108,88,113,74,27,95,
+103,151,161,115,31,122,154,130,155,128,176,8,237,7,247,179,187,21,251,177,
+224,6,209,172,175,164,208,27,193,176,122,99,174,31,150,126,143,132,145,121,
+8,14,247,208,249,178,247,229,21,252,202,247,92,5,252,36,7,14,247,208,247,
+85,247,229,21,248,202,251,92,5,248,36,7,14,215,247,149,249,25,21,252,89,140,
+10,247,240,7,247,181,95,5,252,3,140,10,248,82,7,14,132,32,29,14,132,58,29,
+35,212,22,233,164,29,248,38,221,29,252,133,6,14,136,129,22,249,71,6,251,34,
+249,109,5,39,6,251,191,253,27,21,247,217,248,170,238,252,170,5,14,132,37,
+10,14,76,58,10,14,187,103,29,243,249,2,248,53,21,251,178,6,121,57,5,247,179,
+6,83,248,42,21,251,41,251,22,65,251,21,58,31,86,54,109,32,39,26,251,54,247,
+2,32,247,58,247,35,247,20,206,247,9,219,30,197,225,173,247,2,243,26,247,70,
+38,241,251,67,30,119,58,21,214,195,113,89,172,31,162,105,152,93,89,26,53,
+115,52,95,66,30,43,81,45,85,251,2,27,251,12,62,218,247,14,221,163,229,181,
+211,31,239,196,234,196,247,1,27,14,252,32,62,29,14,132,98,10,132,248,187,
+174,10,251,12,6,252,51,253,109,5,239,6,247,250,249,9,220,253,9,5,236,6,14,
+247,51,94,10,187,47,10,14,113,201,22,248,159,108,29,252,159,6,223,247,142,
+21,248,96,108,29,252,95,6,159,247,125,21,248,156,108,29,252,156,6,14,243,
+32,10,14,190,130,29,132,79,10,65,168,22,248,181,221,29,252,62,6,247,209,247,
+179,251,91,247,170,5,248,47,108,29,252,162,6,121,54,247,86,251,167,251,208,
+251,179,5,14,76,91,10,14,132,48,29,14,247,55,248,6,127,21,233,6,158,229,239,
+144,205,159,205,186,25,228,202,194,242,243,26,214,100,210,77,178,30,94,167,
+102,151,68,145,158,229,24,45,6,120,49,43,134,75,120,75,97,25,43,77,79,33,
+32,26,62,181,66,205,100,30,184,113,175,128,208,133,8,156,217,21,86,144,114,
+147,108,158,8,97,165,115,184,192,26,212,176,215,198,186,30,186,178,188,158,
+211,146,8,232,22,193,137,165,132,169,120,8,182,113,164,92,86,26,66,104,64,
+83,92,30,89,97,88,119,65,133,8,14,132,92,10,247,49,248,8,22,231,6,168,247,
+30,225,141,213,159,198,175,25,231,198,175,206,178,247,82,185,247,109,24,45,
+6,93,251,109,109,251,35,119,93,88,96,25,92,102,80,119,72,136,247,0,248,145,
+24,47,6,251,1,252,145,5,251,10,145,83,181,222,26,174,144,174,159,230,30,185,
+247,109,229,10,93,251,109,5,122,59,131,86,100,26,251,12,233,63,247,49,133,
+30,14,226,171,60,29,14,35,249,71,150,10,49,6,54,251,43,127,187,129,161,120,
+166,25,182,109,89,164,81,27,67,74,101,69,91,31,91,70,112,53,52,26,82,154,
+81,164,102,30,98,165,175,121,190,27,231,214,197,247,21,215,31,160,251,56,
+5,231,6,93,247,163,5,55,22,251,43,54,72,73,72,27,96,109,195,218,202,157,206,
+173,196,31,195,171,182,169,186,27,174,165,123,106,158,31,156,110,148,107,
+151,58,8,14,36,171,251,110,21,222,6,192,247,139,5,105,169,186,121,199,27,
+247,40,247,15,247,20,247,46,185,122,184,113,166,31,125,152,125,147,111,150,
+173,153,155,149,158,158,8,177,174,161,188,186,26,232,65,204,33,75,78,115,
+98,98,30,101,101,123,100,117,39,8,223,144,21,154,209,152,170,164,164,8,163,
+162,176,153,179,27,202,174,106,80,97,119,101,103,111,31,112,118,115,132,74,
+136,125,71,24,140,151,152,140,146,27,169,168,131,124,162,31,168,120,152,110,
+95,26,251,6,55,51,251,2,89,102,155,172,114,30,14,251,66,247,57,251,110,21,
+223,6,188,247,126,247,193,248,144,5,40,6,251,115,252,25,74,248,25,5,50,6,
+230,252,144,5,14,248,13,248,162,21,126,6,63,69,106,79,92,31,87,75,105,37,
+50,26,251,17,214,63,247,17,227,214,176,208,191,30,187,202,172,241,222,26,
+216,111,195,64,207,30,251,25,247,15,5,247,152,189,10,252,6,6,124,68,5,247,
+34,251,88,21,208,183,89,60,83,122,70,113,91,31,71,102,82,101,74,27,68,96,
+188,219,194,156,209,165,187,31,207,175,197,177,205,27,14,251,127,60,10,14,
+251,103,247,128,249,35,21,247,116,6,64,102,69,85,72,66,8,39,251,0,83,251,
+15,251,3,26,85,163,94,177,119,30,165,126,164,133,194,133,175,135,24,196,133,
+150,133,115,26,110,125,107,87,54,30,131,126,132,127,132,127,8,228,6,213,247,
+19,153,172,189,26,165,129,160,121,151,30,121,150,123,143,91,145,100,144,24,
+68,147,139,139,120,149,8,116,150,126,165,172,26,223,194,247,4,228,236,30,
+215,222,218,199,242,193,155,213,24,251,236,6,14,251,11,81,29,14,251,24,248,
+55,249,125,21,85,87,120,105,95,31,79,90,104,77,107,251,11,8,108,251,3,120,
+251,7,72,26,251,9,210,64,247,4,203,191,158,178,185,30,191,184,171,201,171,
+247,6,8,170,247,3,159,247,9,205,26,247,11,67,215,251,5,30,251,97,251,222,
+21,165,242,154,177,171,184,8,182,169,185,163,189,27,209,178,94,60,109,135,
+109,127,70,31,124,72,21,118,46,125,90,122,102,8,63,103,86,99,71,27,71,100,
+184,216,179,145,185,157,226,31,14,252,88,137,29,14,251,66,247,96,247,195,
+21,186,247,113,246,29,180,247,87,247,3,230,247,7,251,178,5,232,6,251,31,247,
+230,247,118,247,78,5,251,7,6,14,251,74,157,22,234,6,247,110,248,27,197,252,
+27,5,226,6,251,5,249,109,5,52,6,175,251,102,5,14,251,18,248,146,150,10,78,
+251,175,125,71,122,105,101,104,25,106,105,99,122,100,27,89,100,169,179,145,
+142,156,143,159,31,215,247,249,222,29,251,50,253,122,5,222,6,190,247,133,
+5,106,168,166,126,182,27,203,198,172,202,187,31,123,66,5,214,6,247,4,248,
+160,5,14,251,66,247,179,22,247,204,248,160,5,40,6,251,128,252,49,87,248,49,
+5,50,6,212,252,160,5,14,251,119,247,77,249,35,21,244,6,73,111,95,77,74,26,
+87,168,100,196,115,30,84,128,106,124,104,109,8,90,97,111,76,73,26,88,157,
+96,172,114,30,166,119,170,129,193,135,189,135,24,208,134,150,133,112,26,107,
+129,118,62,251,20,30,228,6,205,247,4,162,195,184,26,155,133,154,130,150,30,
+121,159,116,147,82,145,90,144,24,77,146,124,142,121,148,8,117,150,125,166,
+171,26,197,172,195,193,170,30,164,183,185,149,219,27,189,189,10,92,6,251,
+3,88,166,199,181,168,189,180,166,31,161,172,174,147,197,27,229,6,154,213,
+5,252,7,6,14,72,29,14,135,249,105,150,10,252,193,6,124,65,5,214,236,10,247,
+131,236,10,214,6,14,38,152,251,110,21,223,6,197,247,165,5,86,169,187,114,
+211,27,223,211,176,206,190,31,191,208,169,230,228,26,247,19,60,222,251,15,
+71,72,111,90,90,30,89,89,118,90,113,251,13,8,247,172,247,111,21,211,181,91,
+57,70,117,64,102,85,31,91,106,84,108,84,27,68,97,191,225,197,164,222,172,
+188,31,188,171,194,169,195,27,14,68,248,113,150,10,150,109,115,143,108,27,
+57,61,102,75,89,31,88,75,106,37,49,26,251,17,218,59,247,15,222,214,175,204,
+191,30,187,199,174,245,222,26,189,125,177,107,174,30,247,11,189,10,251,184,
+77,128,29,14,251,192,247,37,22,223,221,10,5,247,33,189,10,252,2,204,29,247,
+33,6,14,251,16,36,10,14,117,247,126,251,110,21,223,6,181,247,88,224,147,198,
+164,196,195,25,209,205,180,236,234,26,247,31,52,214,251,52,129,134,139,138,
+124,30,35,252,121,105,143,125,143,121,149,25,106,158,120,182,196,26,195,154,
+199,165,187,30,163,186,161,160,183,161,156,222,24,63,110,96,108,92,81,8,90,
+79,113,59,54,26,72,159,86,176,104,30,172,108,175,126,209,132,8,247,79,248,
+121,21,166,137,152,136,157,130,8,176,120,162,94,85,26,76,116,64,104,88,30,
+100,81,99,115,70,132,8,14,251,20,247,215,247,142,21,66,247,166,5,49,6,239,
+251,245,251,159,252,25,5,235,6,247,94,247,195,219,251,195,5,228,6,251,0,248,
+18,247,141,247,252,5,41,6,14,193,248,153,150,10,55,6,40,252,102,5,55,147,
+102,169,200,26,156,143,170,146,170,30,200,247,180,222,29,77,251,183,5,131,
+102,134,102,121,26,101,154,102,165,114,30,177,103,176,124,215,130,96,251,
+91,24,223,6,182,247,91,247,70,156,217,208,168,247,58,25,201,247,183,222,29,
+78,251,180,115,251,6,87,89,251,2,125,25,14,244,51,29,14,251,80,248,7,251,
+110,21,211,247,18,150,163,179,26,163,130,157,120,154,30,127,150,139,139,78,
+162,85,160,24,70,166,130,143,120,156,8,113,161,126,174,183,26,247,12,236,
+247,1,246,201,181,104,87,132,138,127,137,127,30,227,6,141,155,140,154,149,
+26,231,65,201,251,1,57,66,107,78,84,30,84,79,104,51,59,26,46,189,71,233,105,
+30,226,108,5,188,121,150,131,120,26,116,130,120,63,251,15,30,14,251,16,206,
+247,186,21,124,72,5,177,6,137,114,138,127,122,26,251,17,206,67,247,8,230,
+219,186,220,187,30,175,200,160,201,159,247,0,8,163,6,163,6,157,212,5,138,
+118,135,139,114,27,149,203,141,164,172,26,247,23,59,223,251,17,251,1,57,60,
+35,67,182,71,210,99,30,181,115,183,128,224,130,124,60,119,76,114,90,8,81,
+109,83,103,80,27,67,103,182,225,167,143,174,147,189,31,247,209,247,7,21,82,
+142,102,148,102,157,8,83,168,105,186,190,26,199,186,184,202,176,174,124,114,
+160,30,161,114,148,107,85,26,94,136,115,129,97,30,14,247,82,251,110,21,220,
+6,181,247,88,206,142,185,155,186,177,25,212,198,188,247,7,247,4,26,247,15,
+78,220,37,153,30,166,247,15,5,57,6,113,251,15,73,137,91,121,93,97,25,71,78,
+93,251,7,251,2,26,63,164,73,183,103,30,163,119,162,129,178,134,8,155,214,
+21,83,150,113,183,222,26,216,163,225,174,185,30,169,178,172,159,187,144,8,
+220,22,197,131,170,92,56,26,67,116,57,105,92,30,109,96,104,118,84,131,8,14,
+244,247,169,248,92,21,52,74,83,251,9,251,10,26,40,196,71,221,190,189,166,
+190,180,30,90,156,179,110,189,27,247,19,247,7,247,43,247,57,210,113,193,86,
+178,31,176,90,65,157,38,27,251,159,6,124,71,5,247,136,22,231,188,131,117,
+176,31,187,110,164,90,76,26,84,122,78,110,93,30,100,114,113,120,106,27,99,
+117,170,194,163,142,166,146,170,31,154,209,222,29,124,69,5,251,1,116,96,81,
+81,27,99,116,173,198,211,163,218,178,192,31,166,177,165,162,189,171,8,14,
+252,88,137,29,189,247,83,21,35,6,118,36,5,243,6,247,75,242,21,35,6,118,36,
+5,243,6,14,251,16,36,10,247,28,247,83,132,29,247,76,242,102,29,251,233,247,
+183,249,159,61,29,251,233,247,200,249,239,21,120,48,142,35,5,170,133,10,132,
+32,29,251,157,238,61,29,247,7,247,222,247,224,124,29,252,64,6,46,249,27,61,
+29,247,64,249,77,113,29,251,38,248,33,61,29,251,177,248,49,107,10,64,249,
+109,61,29,247,12,248,180,64,10,111,215,95,55,10,252,27,208,145,10,240,178,
+60,29,221,249,27,145,10,247,83,248,220,127,10,251,223,249,109,61,29,252,32,
+62,29,247,2,250,38,132,29,247,76,242,102,29,132,48,29,247,4,250,38,132,29,
+247,76,242,102,29,35,249,71,150,10,49,6,55,251,43,126,187,130,161,120,166,
+25,182,108,89,164,81,27,69,75,101,69,91,31,92,70,113,53,52,26,82,154,81,163,
+102,30,98,164,174,121,189,27,230,215,197,247,21,214,31,161,251,56,5,231,6,
+92,247,163,5,56,22,251,43,53,72,73,73,27,98,111,194,218,203,157,206,171,196,
+31,195,171,180,169,185,27,174,165,123,106,159,31,156,110,147,107,152,58,8,
+39,248,144,61,29,251,127,60,10,141,248,181,61,29,251,11,81,29,247,48,192,
+10,252,88,137,29,195,192,10,72,29,155,247,209,61,29,244,51,29,137,248,18,
+145,10,251,16,36,10,247,29,247,147,61,29,252,88,137,29,212,247,227,21,119,
+219,29,159,148,10,251,16,36,10,247,46,247,227,21,120,48,143,35,5,169,133,
+10,132,248,161,247,111,21,167,251,111,5,238,6,233,29,243,6,247,15,247,111,
+5,247,164,217,21,251,123,6,247,82,247,224,5,14,116,247,149,248,56,21,188,
+247,119,5,248,19,221,29,252,114,99,10,14,132,220,22,247,221,6,217,204,163,
+187,187,31,184,184,167,205,201,26,203,105,186,73,168,30,178,154,160,152,163,
+167,8,173,177,158,189,188,26,232,70,197,251,2,30,251,188,6,166,251,207,21,
+189,247,125,5,247,71,6,232,171,118,78,97,122,100,107,110,31,109,107,106,128,
+78,27,251,142,251,224,21,193,247,142,5,247,117,6,213,173,110,77,51,67,68,
+50,31,14,251,22,247,131,167,29,14,169,248,218,22,104,199,10,252,66,6,63,251,
+253,107,251,60,50,32,251,9,128,25,86,251,140,5,233,6,174,247,58,5,248,72,
+221,21,251,247,6,222,184,203,244,167,247,31,198,247,168,24,247,133,6,14,132,
+110,29,14,247,135,248,47,194,29,244,6,247,44,251,237,5,236,6,251,61,248,20,
+247,169,242,29,47,244,29,75,251,194,5,37,6,251,8,247,194,5,39,246,10,247,
+2,6,247,189,247,237,5,231,6,14,79,247,0,247,116,21,134,113,137,125,118,26,
+251,6,222,67,247,25,224,209,167,194,191,30,186,188,167,208,204,26,211,80,
+29,94,119,91,178,10,14,180,74,10,14,54,205,22,117,10,45,6,14,151,248,166,
+22,233,164,10,252,123,126,10,247,192,6,14,247,51,248,102,22,247,227,248,247,
+251,22,252,247,5,227,164,10,251,21,6,251,239,253,15,58,249,15,5,251,21,149,
+10,227,6,247,22,248,247,216,252,247,5,14,187,248,255,247,224,21,68,251,224,
+5,232,164,10,46,6,72,251,207,5,252,11,6,206,247,207,5,46,247,10,10,243,172,
+10,251,71,228,29,224,228,192,229,29,30,129,57,21,247,17,214,59,251,26,48,
+108,44,85,65,31,58,79,51,94,42,27,251,14,64,220,247,25,230,170,235,193,212,
+31,219,198,228,185,233,27,14,190,130,29,132,247,144,247,201,21,247,119,6,
+247,36,247,1,247,2,247,36,244,71,200,251,8,31,251,193,118,29,222,248,27,21,
+194,247,148,5,247,85,6,216,180,105,76,103,125,102,116,110,31,100,106,96,121,
+79,27,14,187,249,23,247,149,21,251,10,111,39,59,251,11,27,251,14,75,209,247,
+25,245,175,244,201,215,31,209,196,220,179,225,27,232,201,92,67,127,138,129,
+135,117,31,233,6,143,157,140,148,154,26,247,12,39,222,251,35,251,6,36,93,
+54,64,30,58,49,90,251,23,251,18,26,251,72,238,33,247,59,247,71,247,38,247,
+7,247,57,171,30,14,76,248,126,249,27,21,247,131,108,29,252,208,6,122,57,5,
+247,132,189,29,232,6,14,104,104,10,14,247,13,247,240,129,21,233,6,158,230,
+230,141,208,160,205,185,25,227,200,191,242,247,3,26,247,25,53,218,251,51,
+150,30,158,230,229,10,120,48,54,136,75,120,77,99,25,44,77,80,34,251,0,26,
+251,26,231,52,247,44,130,30,156,220,21,251,2,147,76,193,228,26,211,174,214,
+194,183,30,187,178,190,158,210,144,8,233,22,189,136,163,133,170,121,8,182,
+115,165,92,87,26,251,30,251,0,33,251,45,128,30,14,132,247,6,10,251,8,247,
+1,29,251,0,247,0,29,247,10,247,0,10,247,2,6,14,192,215,22,248,159,6,104,199,
+10,45,189,29,252,10,164,29,45,6,14,138,248,146,22,233,92,29,180,188,129,218,
+27,217,188,146,159,209,31,14,247,138,204,22,249,166,164,10,45,189,29,251,
+141,152,10,247,141,199,22,249,132,6,104,251,58,5,233,6,191,247,140,5,84,164,
+29,45,189,29,251,146,152,10,116,247,150,89,29,14,247,104,247,160,89,29,248,
+146,57,21,233,164,10,45,6,14,247,23,248,70,248,56,21,204,247,201,5,252,4,
+6,122,57,5,247,166,6,251,29,253,27,5,247,187,175,29,251,105,57,21,247,79,
+187,29,251,79,6,14,159,248,2,248,42,21,121,56,5,247,176,6,251,58,93,33,41,
+251,26,27,73,79,166,184,105,31,113,172,129,171,134,200,47,123,24,149,62,152,
+101,169,96,8,71,187,223,101,238,27,246,236,181,216,209,31,221,228,189,247,
+28,247,23,26,224,115,213,95,190,30,192,95,75,165,56,27,251,46,251,21,60,251,
+35,58,31,231,120,5,242,204,231,195,246,27,247,1,205,60,251,23,131,138,123,
+138,120,31,14,247,240,247,237,247,224,21,135,115,138,121,118,26,251,75,247,
+0,251,1,247,72,247,4,239,181,218,216,30,225,228,191,229,29,251,79,251,48,
+251,18,251,93,74,30,251,17,6,206,247,207,5,46,118,29,210,247,224,5,248,176,
+247,219,21,247,20,215,59,251,26,48,107,43,85,66,31,58,78,50,94,40,27,251,
+16,62,220,247,24,231,171,234,194,213,31,219,198,229,185,235,27,14,147,248,
+224,247,206,21,72,251,206,5,232,164,10,251,225,6,56,82,123,102,94,31,86,97,
+107,70,71,26,78,163,98,197,104,30,55,115,108,97,113,251,14,115,251,4,126,
+110,102,108,8,247,0,6,163,170,157,187,154,217,160,247,7,177,179,230,141,8,
+247,149,221,21,251,116,6,98,114,144,151,121,31,116,153,125,168,173,26,183,
+158,185,170,168,30,166,168,174,150,199,27,247,117,6,14,251,74,248,243,174,
+10,252,30,118,29,247,30,249,27,5,247,252,6,156,221,247,8,10,247,61,247,139,
+22,233,6,198,247,170,147,179,152,161,169,162,25,172,181,186,152,220,27,219,
+173,119,92,133,138,129,137,130,31,106,251,48,5,88,130,109,111,94,27,251,27,
+6,121,57,5,247,39,6,241,138,208,201,153,247,0,172,247,44,24,142,153,140,150,
+151,26,173,123,172,111,165,30,166,110,90,152,68,27,36,94,123,77,78,31,188,
+247,126,5,247,94,108,29,252,132,6,122,57,5,247,92,6,14,173,247,114,248,42,
+21,247,55,190,241,229,247,24,27,205,199,112,94,173,31,157,116,149,115,147,
+100,232,156,24,124,202,124,174,109,174,8,196,91,58,172,45,27,34,47,99,62,
+67,31,54,48,88,251,27,251,23,26,54,161,68,183,87,30,84,185,204,112,227,27,
+243,237,177,206,211,31,182,180,167,179,176,216,46,156,24,114,84,119,110,103,
+106,8,87,82,65,110,66,27,251,3,73,218,247,27,156,140,151,141,160,31,247,178,
+6,157,222,5,14,132,249,88,248,151,21,143,159,140,150,154,26,247,3,49,208,
+251,37,52,67,116,93,84,30,86,96,107,74,77,26,68,185,86,218,117,30,247,48,
+96,5,220,116,169,113,92,26,105,119,100,106,108,30,103,100,83,121,67,27,33,
+80,186,222,150,140,149,143,161,31,45,6,135,115,138,128,121,26,251,21,232,
+66,247,58,232,213,162,185,196,30,196,186,174,210,211,26,213,97,186,48,165,
+30,251,51,184,92,153,121,147,124,155,25,127,151,131,160,158,26,176,162,180,
+176,165,30,164,174,183,151,192,27,235,195,100,71,128,138,130,135,122,31,14,
+252,32,247,233,247,11,29,252,32,247,233,247,11,29,252,32,247,233,247,11,29,
+251,66,248,122,174,10,251,1,252,149,127,82,125,106,116,113,25,111,115,102,
+122,101,27,85,106,168,187,154,142,160,143,158,31,149,186,229,10,129,92,5,
+134,119,137,119,122,26,48,211,77,243,247,18,223,211,247,25,168,30,247,8,248,
+183,5,14,248,28,248,114,22,247,212,197,29,251,12,30,251,111,6,204,247,201,
+5,252,52,126,10,247,121,6,167,251,201,21,247,103,6,220,179,108,75,49,62,68,
+40,31,251,102,6,14,247,200,248,171,247,230,21,67,251,230,5,247,146,197,29,
+251,13,30,251,45,6,205,247,201,229,10,73,251,201,5,251,194,6,205,247,201,
+5,46,118,29,211,247,230,5,248,31,22,247,36,187,29,251,36,6,14,247,62,247,
+139,22,233,6,198,247,170,5,226,158,211,184,247,15,27,218,173,118,92,135,137,
+128,137,129,31,72,251,209,5,233,6,207,247,213,5,142,154,141,152,148,26,175,
+124,171,110,165,30,165,110,89,153,74,27,39,95,122,77,77,31,189,247,126,5,
+247,61,108,29,252,97,6,122,57,5,247,90,6,14,189,220,22,247,125,6,103,251,
+58,5,233,6,175,247,58,5,247,127,6,247,47,249,109,173,29,243,172,10,251,72,
+228,29,225,228,191,247,26,247,22,26,247,72,251,0,247,3,251,68,30,247,62,252,
+60,21,251,52,90,251,9,40,251,33,27,251,18,65,219,247,27,154,140,150,141,157,
+31,156,222,21,247,54,190,247,7,236,247,33,27,247,18,213,59,251,27,124,138,
+128,137,121,31,14,247,245,248,77,194,29,247,7,6,247,43,251,237,5,191,6,104,
+251,51,5,232,6,191,247,133,5,43,6,251,25,247,194,247,170,247,237,5,35,6,251,
+136,251,194,5,251,3,244,29,75,251,194,5,251,3,6,251,8,247,194,5,34,246,10,
+244,6,247,189,247,237,5,247,3,6,14,132,48,29,14,243,247,16,248,36,21,124,
+87,133,97,89,26,251,67,244,34,247,68,247,7,244,183,221,219,30,229,232,193,
+247,27,247,23,26,247,67,34,244,251,68,251,49,251,17,64,251,39,49,30,227,121,
+5,242,203,232,194,247,1,27,247,20,215,59,251,26,124,139,130,137,118,31,122,
+56,21,251,55,86,251,8,43,251,36,27,251,20,63,219,247,27,153,140,151,141,157,
+31,14,160,247,202,107,10,217,248,4,5,160,222,199,148,198,27,245,187,113,84,
+136,31,131,137,130,137,129,30,78,251,182,5,233,6,201,247,187,5,142,152,141,
+154,147,26,185,115,181,99,164,30,165,98,90,149,59,27,62,89,132,119,69,31,
+14,248,45,249,93,174,10,65,6,251,20,252,240,251,87,248,240,5,58,149,10,213,
+6,247,19,248,235,247,84,252,235,5,224,6,248,63,249,121,21,65,71,102,70,87,
+31,89,73,108,44,54,26,251,16,206,61,244,212,204,174,206,189,30,191,207,171,
+233,220,26,247,19,72,221,37,30,129,56,21,203,178,89,58,251,28,51,251,13,41,
+75,98,190,221,195,158,202,170,188,31,198,177,184,167,194,27,251,238,253,38,
+21,248,44,6,157,222,5,252,44,6,14,251,28,247,154,248,50,21,189,247,125,5,
+247,252,108,29,252,90,6,72,251,207,5,92,6,121,57,5,187,6,68,251,224,5,233,
+6,210,247,224,5,247,148,108,29,14,132,248,71,247,114,21,152,203,248,4,248,
+79,5,251,3,6,251,180,251,250,251,29,247,250,5,251,4,6,247,78,252,79,126,75,
+5,251,47,6,121,55,5,247,47,6,109,251,30,5,233,6,169,247,30,5,247,40,6,157,
+223,5,14,132,110,29,247,209,249,212,73,29,180,214,22,233,6,157,222,248,103,
+248,66,251,1,252,149,5,233,165,10,247,63,247,91,78,29,172,30,162,160,151,
+160,150,183,8,83,6,99,129,99,116,78,135,29,251,22,247,134,167,29,251,87,192,
+29,252,32,247,233,107,10,247,12,250,38,73,29,54,205,194,29,217,6,247,43,251,
+237,5,238,6,251,62,248,20,247,170,242,29,73,244,29,247,187,192,29,104,104,
+10,247,95,249,226,52,10,180,74,10,248,71,247,30,244,10,247,167,6,14,104,249,
+3,250,2,244,10,247,168,6,252,101,253,189,21,113,10,14,83,247,209,248,63,21,
+87,6,203,247,194,5,45,118,29,212,247,237,5,191,6,101,251,75,5,199,6,177,247,
+75,5,141,6,247,43,251,237,5,243,6,251,62,248,20,237,10,178,247,76,5,79,6,
+14,131,219,194,29,214,6,247,26,251,237,5,197,6,104,251,58,5,233,6,192,247,
+140,5,37,6,251,26,247,194,237,10,5,83,244,29,14,187,248,255,247,224,21,68,
+251,224,5,195,6,104,251,58,5,233,6,191,247,140,5,83,164,29,45,6,72,251,207,
+5,252,10,6,206,247,207,5,46,247,10,10,174,247,6,10,251,3,247,1,29,251,5,247,
+0,29,247,5,247,0,10,202,6,104,251,58,5,233,6,191,247,140,5,41,6,14,160,248,
+57,247,143,21,197,144,189,147,190,152,80,251,169,24,233,164,10,45,6,60,252,
+6,75,122,94,132,89,136,25,187,247,117,5,79,6,91,251,117,5,50,145,95,166,188,
+26,145,140,149,141,148,30,191,10,211,89,247,32,136,30,109,251,33,5,199,6,
+14,160,248,157,22,195,6,103,199,10,45,6,60,252,6,5,119,59,89,131,79,27,33,
+83,168,193,145,140,149,141,148,31,191,10,217,86,247,31,206,211,149,157,214,
+30,14,132,37,10,247,173,249,237,169,29,180,74,10,247,147,247,102,168,10,225,
+247,127,248,202,21,251,12,252,202,5,247,235,6,219,199,159,181,186,31,193,
+186,171,211,211,26,245,69,200,251,12,30,251,135,6,170,247,38,5,247,36,6,154,
+208,5,251,36,6,159,233,229,10,119,45,5,251,47,6,124,70,5,247,93,251,120,21,
+247,126,6,221,179,108,75,49,61,68,40,31,251,125,6,14,243,248,163,64,10,111,
+215,95,184,30,188,90,60,167,48,27,251,225,252,51,21,159,204,172,146,178,27,
+179,164,131,116,169,31,99,191,146,136,172,27,177,180,148,166,220,31,152,143,
+144,141,147,141,8,251,56,91,251,8,38,251,35,27,71,76,166,184,104,31,111,174,
+126,186,200,26,158,140,155,142,157,30,153,208,21,247,56,187,247,9,240,247,
+34,27,207,202,112,94,174,31,166,105,153,91,80,26,121,138,123,137,119,30,112,
+58,100,130,98,27,116,119,145,150,124,31,106,165,5,161,110,112,148,101,27,
+95,124,136,107,36,31,14,225,249,204,249,106,21,149,116,126,142,116,27,70,
+92,104,56,97,31,251,148,252,145,56,248,253,5,39,6,246,253,109,5,239,6,247,
+204,248,228,5,182,162,160,155,172,27,155,148,136,130,155,31,14,79,247,218,
+116,21,211,142,191,157,186,176,8,201,189,179,219,218,26,210,80,29,95,119,
+90,178,10,43,6,134,113,137,125,118,26,34,210,68,247,6,130,30,101,69,90,29,
+54,247,95,249,27,21,251,29,253,27,5,117,10,251,254,6,122,57,5,14,187,248,
+11,116,21,247,66,146,245,224,219,247,89,82,10,61,44,89,251,29,251,16,26,48,
+170,63,197,91,30,176,109,176,124,199,133,101,69,24,90,29,138,248,163,221,
+21,82,6,124,57,105,251,51,5,232,6,173,247,51,5,195,92,29,181,187,129,220,
+27,215,189,146,159,208,31,14,248,183,192,21,134,124,133,138,131,27,122,128,
+149,155,144,140,148,141,147,31,201,247,182,5,142,155,141,155,150,26,207,70,
+182,251,1,62,78,119,100,98,30,108,111,124,110,125,83,8,226,6,205,158,183,
+168,220,27,202,178,118,106,137,31,132,137,131,137,129,30,136,123,131,105,
+116,126,70,130,25,251,39,121,116,133,95,112,8,87,107,106,79,76,26,60,196,
+90,231,207,197,162,190,196,30,138,134,139,134,135,26,102,170,116,190,156,
+151,141,144,161,30,251,0,247,72,21,133,113,128,122,112,118,8,106,97,91,122,
+90,27,84,109,162,181,167,152,166,161,159,31,161,159,173,150,196,147,231,152,
+157,143,169,151,8,14,251,3,248,148,249,164,21,130,99,128,96,110,121,56,124,
+25,48,121,85,100,90,55,8,86,48,95,251,51,35,26,251,12,214,63,247,11,233,218,
+179,215,193,30,185,201,168,238,230,26,247,6,62,220,251,1,82,84,117,99,97,
+30,162,202,186,178,210,151,247,29,156,184,179,169,247,27,8,251,108,251,214,
+141,10,207,175,198,177,205,27,14,251,44,192,22,247,187,6,194,175,151,168,
+173,31,177,172,163,193,192,26,183,122,169,98,165,30,198,173,165,178,193,26,
+206,85,188,65,30,251,162,6,128,252,86,21,174,247,58,5,247,78,6,185,165,116,
+98,80,93,96,78,31,251,27,247,132,21,168,247,28,5,247,78,6,174,158,121,107,
+88,102,104,83,31,14,251,73,247,15,199,29,14,251,13,119,42,21,226,6,159,236,
+5,247,249,6,119,42,5,225,6,175,247,63,5,96,221,10,5,251,226,6,97,251,138,
+47,251,59,251,7,102,8,248,39,22,251,169,6,220,200,204,247,12,175,247,52,147,
+174,24,247,59,6,14,70,10,14,153,247,194,194,10,214,6,234,251,141,5,232,6,
+33,247,178,247,66,247,130,5,37,219,10,74,193,10,97,251,93,5,63,162,10,204,
+6,14,251,101,219,247,56,21,134,117,5,137,129,138,130,127,26,57,201,87,237,
+247,15,234,224,247,2,185,119,171,96,162,30,209,171,171,182,200,26,216,77,
+192,50,251,1,62,70,251,10,116,30,228,6,212,152,200,29,108,129,118,27,104,
+6,123,241,10,71,87,110,162,180,152,139,141,141,148,31,144,161,5,14,59,10,
+14,251,94,193,194,10,202,162,29,84,193,10,14,251,2,248,27,22,223,6,247,3,
+248,160,5,251,238,146,29,247,71,6,14,151,192,22,223,221,10,199,252,86,5,225,
+6,247,141,248,86,240,10,251,20,6,251,138,252,75,77,248,75,5,251,20,6,14,251,
+16,206,10,223,6,247,3,248,160,186,10,69,29,132,62,141,10,206,175,198,178,
+205,27,14,251,16,214,22,223,221,10,5,247,124,6,240,10,252,37,6,14,151,251,
+110,21,221,6,197,247,165,5,85,175,185,115,209,27,247,58,247,14,247,46,247,
+101,247,13,68,217,251,1,69,83,111,78,89,31,155,213,5,57,6,247,109,76,21,210,
+184,87,57,251,40,47,251,16,251,3,71,96,190,219,247,42,229,247,17,247,0,31,
+14,251,66,248,183,247,240,21,140,166,139,141,144,26,235,71,200,251,0,55,64,
+101,69,85,30,88,72,107,43,49,26,251,17,210,63,247,10,247,17,227,210,247,24,
+176,30,50,6,55,108,88,97,70,27,71,96,186,215,206,162,220,173,190,31,196,176,
+188,168,199,27,197,174,109,87,132,138,126,138,127,31,14,247,51,248,11,22,
+223,6,234,248,86,5,247,115,189,10,252,166,204,29,247,115,6,14,251,66,85,29,
+14,247,53,247,221,251,110,21,223,6,181,247,88,228,143,198,157,197,181,25,
+226,202,194,247,1,247,3,26,247,18,58,215,251,40,151,30,165,247,15,222,29,
+113,251,15,51,135,80,120,82,97,25,54,76,85,251,1,251,0,26,251,20,217,63,247,
+38,127,30,155,214,21,38,147,88,188,227,26,214,172,217,191,188,30,181,178,
+184,158,206,145,8,223,22,244,130,191,90,51,26,64,106,61,85,91,30,96,100,93,
+120,71,133,8,14,251,66,247,246,247,161,21,247,124,247,147,5,38,6,251,61,143,
+10,229,6,14,37,226,22,247,238,6,105,251,53,5,226,6,188,247,127,5,93,221,10,
+186,29,247,69,223,22,249,12,6,105,251,50,195,10,189,247,124,5,96,221,10,133,
+29,86,247,77,22,247,126,180,10,251,41,6,183,247,102,5,251,185,204,29,247,
+102,6,143,252,12,21,174,247,58,5,247,39,234,10,201,228,109,10,185,162,118,
+98,79,95,95,78,31,247,103,65,21,203,10,14,251,40,210,109,10,184,162,118,98,
+79,96,95,78,31,14,251,74,247,69,247,242,21,209,174,200,181,204,27,199,178,
+93,68,130,138,125,138,125,31,251,58,204,29,247,61,6,251,2,115,72,69,57,27,
+69,97,188,220,31,152,7,51,118,5,251,18,210,66,247,13,223,209,175,209,189,
+30,189,208,168,233,228,26,247,20,72,215,251,5,251,0,47,76,251,0,87,30,14,
+217,247,55,188,10,190,247,131,5,225,6,135,112,138,121,118,26,251,12,215,63,
+247,12,227,219,179,211,192,30,186,201,170,240,232,26,247,10,62,215,251,11,
+251,24,37,56,251,35,96,30,52,6,183,247,103,5,247,205,77,224,10,82,228,10,
+206,175,197,178,205,27,14,251,32,248,13,22,223,6,247,4,248,160,5,251,142,
+6,83,98,129,117,105,31,94,109,110,85,82,26,90,164,100,190,109,30,90,128,110,
+107,126,79,127,83,24,129,93,132,124,120,126,8,228,6,155,153,147,155,148,183,
+150,189,24,150,195,176,171,192,137,8,247,25,6,155,213,21,251,58,6,96,116,
+161,180,197,183,184,196,31,247,58,6,14,251,227,248,50,150,10,251,149,6,251,
+3,252,160,5,223,221,10,5,247,124,6,155,213,247,8,10,215,205,10,110,94,128,
+139,134,137,132,31,74,251,199,126,82,81,88,89,140,25,251,21,6,122,62,5,247,
+22,6,247,4,140,225,211,162,247,3,204,247,199,24,143,155,140,153,155,26,210,
+80,196,66,74,84,111,70,69,30,170,247,42,5,247,2,189,10,251,2,6,154,209,222,
+29,124,69,5,251,1,204,29,247,1,6,14,251,70,248,191,248,4,21,134,175,133,161,
+127,162,8,196,109,77,172,62,27,53,68,101,64,87,31,93,73,113,53,52,26,251,
+26,203,63,247,4,247,14,231,208,247,21,190,30,53,161,5,47,102,79,88,66,27,
+78,102,189,222,154,140,150,141,160,31,247,60,6,154,213,5,251,56,6,240,171,
+194,192,212,27,205,182,97,69,144,31,14,251,66,248,160,248,14,21,142,154,140,
+147,151,26,217,75,187,37,251,26,43,63,33,74,176,104,233,115,30,219,119,5,
+187,126,158,121,107,26,83,78,99,53,67,107,161,187,150,140,145,141,154,30,
+53,6,135,118,138,128,125,26,54,206,91,247,10,216,200,158,178,181,30,179,174,
+162,189,186,26,200,101,176,58,160,30,63,157,5,79,154,116,157,170,26,194,193,
+178,215,193,174,115,103,133,138,130,138,130,30,14,252,88,247,156,248,160,
+183,29,34,195,10,14,252,88,247,72,150,10,251,16,252,219,131,102,134,127,130,
+128,25,124,126,117,132,111,27,134,132,139,140,130,31,123,61,247,12,136,193,
+169,160,221,25,247,27,249,13,5,182,247,97,21,55,6,117,34,195,10,14,247,128,
+248,60,22,247,159,181,29,251,75,6,184,247,102,5,252,13,146,29,247,101,6,143,
+252,12,21,175,247,58,5,247,72,6,184,162,118,98,79,96,95,78,31,14,247,46,199,
+211,10,247,142,180,10,251,58,6,184,247,102,196,10,247,205,252,86,21,175,247,
+58,5,247,55,234,10,215,95,10,170,247,42,5,247,3,189,10,251,3,6,154,209,222,
+29,124,69,5,251,0,204,29,247,0,6,14,224,22,247,45,6,104,251,53,195,10,174,
+247,53,5,247,42,6,247,3,248,160,186,29,69,29,227,251,210,21,32,105,73,79,
+54,27,69,95,188,218,151,140,149,141,156,31,155,213,21,245,171,207,200,224,
+27,210,182,90,58,127,138,130,137,123,31,14,251,48,247,248,22,223,223,29,93,
+99,110,10,247,48,217,22,249,53,6,247,4,248,160,133,29,247,37,247,243,194,
+10,247,0,6,234,251,141,5,182,6,108,251,53,195,10,185,247,127,5,62,6,61,247,
+104,247,66,247,130,5,37,219,10,41,193,10,97,251,93,5,251,1,162,10,237,6,14,
+251,66,248,138,150,10,227,10,92,251,110,195,10,186,247,110,247,190,248,160,
+5,14,243,247,174,21,126,94,134,111,104,26,251,13,214,63,247,12,224,216,177,
+207,195,30,190,203,172,239,233,26,247,15,63,214,251,16,251,13,49,75,251,10,
+94,30,228,6,208,176,193,175,205,27,212,189,89,66,121,137,126,134,113,31,124,
+71,21,41,111,68,77,54,27,69,94,186,212,152,140,148,143,157,31,14,32,221,95,
+10,201,247,186,222,29,14,251,177,247,116,247,215,21,166,247,19,245,10,97,
+251,93,5,101,6,124,65,5,176,6,86,251,141,195,10,192,247,141,5,247,43,189,
+10,14,251,66,247,184,137,21,140,141,247,190,248,160,5,50,6,227,10,138,137,
+5,251,13,6,127,82,5,247,13,6,105,251,51,195,10,173,247,51,5,247,11,6,151,
+196,5,14,70,10,47,248,49,73,29,59,10,230,247,97,149,29,215,187,191,158,169,
+171,93,29,251,188,209,199,29,247,110,247,108,21,251,27,251,40,5,207,6,247,
+72,247,40,5,14,252,88,247,159,231,29,213,105,10,251,94,193,194,10,207,162,
+29,79,193,10,247,142,247,108,21,251,19,245,29,14,251,66,85,29,251,230,247,
+97,21,136,120,138,130,127,26,81,188,102,215,194,183,155,171,174,30,163,162,
+151,160,149,182,8,81,6,96,124,107,120,80,27,89,110,157,169,142,139,145,140,
+144,31,14,59,10,247,245,247,26,21,251,166,6,123,70,5,247,167,6,14,251,66,
+248,148,249,48,244,10,247,166,6,140,64,88,10,14,251,61,247,166,247,215,21,
+89,6,181,247,93,246,29,192,247,141,5,189,6,112,251,20,5,193,6,166,247,20,
+233,251,141,5,237,6,33,247,178,247,66,247,130,5,42,6,251,39,251,93,166,247,
+20,5,85,6,14,251,27,210,194,10,199,6,234,251,141,5,187,6,104,251,51,195,10,
+190,247,125,5,61,6,61,247,104,247,66,247,130,5,42,219,10,79,193,10,14,251,
+16,206,10,173,6,105,251,53,195,10,188,247,127,5,105,221,10,186,10,251,39,
+247,242,247,161,21,247,124,247,147,5,44,6,251,67,143,10,179,6,105,251,51,
+195,10,188,247,125,5,56,6,14,251,62,247,198,247,67,21,171,144,162,146,172,
+152,97,251,92,24,223,236,29,108,130,113,134,109,135,25,165,247,13,5,85,6,
+113,251,14,5,94,143,117,159,174,26,149,139,143,141,147,30,191,29,192,102,
+227,137,30,119,37,5,193,6,14,251,62,247,244,22,173,6,103,251,51,195,10,190,
+247,125,5,105,221,10,222,29,85,251,148,5,125,92,100,133,99,27,86,110,160,
+178,149,139,143,141,147,31,191,29,196,100,225,187,182,148,159,189,30,14,248,
+20,163,10,246,251,250,35,29,59,10,247,67,247,108,168,10,244,247,163,248,161,
+21,251,8,252,161,5,247,237,6,247,9,227,222,247,2,216,88,183,51,31,251,152,
+6,188,247,103,5,247,43,189,10,251,43,6,153,209,222,29,125,69,5,251,35,204,
+29,247,19,252,87,21,174,247,58,5,247,150,6,185,162,119,97,79,95,95,79,31,
+14,69,29,230,251,199,21,251,6,107,71,75,51,27,68,96,188,219,154,140,153,142,
+155,31,153,175,162,145,159,27,157,153,132,119,160,31,120,158,152,132,154,
+27,155,162,145,156,182,31,169,213,21,119,87,131,137,126,27,127,126,146,156,
+122,31,162,113,125,146,117,27,117,108,131,119,93,31,245,172,206,199,224,27,
+208,184,90,62,131,138,126,138,124,31,14,55,249,23,150,10,144,119,129,141,
+122,27,74,99,106,57,101,31,251,36,251,209,90,248,61,229,10,212,252,160,5,
+230,6,247,93,248,35,5,184,161,156,153,169,27,149,146,138,134,150,31,14,251,
+101,247,150,117,21,247,1,148,223,223,239,26,186,119,171,95,162,30,209,171,
+172,182,200,26,216,77,192,50,251,1,61,70,251,10,116,30,228,6,212,153,200,
+29,107,129,119,27,103,6,124,241,10,70,87,110,162,180,147,140,147,141,147,
+31,143,161,5,52,6,135,117,5,136,128,138,128,130,26,61,191,91,232,131,30,101,
+70,99,29,147,160,151,10,14,251,94,247,42,248,86,21,43,252,86,195,10,192,247,
+141,5,202,6,234,251,141,5,233,6,33,247,178,247,67,247,130,5,37,219,10,84,
+6,182,247,93,5,251,185,204,29,14,251,66,247,169,116,21,247,19,146,221,208,
+171,247,19,202,10,69,96,247,19,10,154,140,150,142,26,172,100,10,79,164,80,
+180,104,30,165,117,167,127,179,135,101,98,29,135,135,139,137,126,31,14,251,
+48,248,8,213,21,89,6,95,251,127,195,10,170,247,53,5,186,223,29,92,100,110,
+10,224,248,107,247,176,21,170,141,162,146,161,151,8,201,174,170,194,216,26,
+247,17,65,209,251,24,30,251,168,253,47,224,247,175,247,26,6,241,251,43,47,
+251,24,5,230,6,183,205,182,73,5,234,6,49,247,28,241,247,36,5,44,6,87,59,5,
+251,174,247,50,21,247,126,247,70,7,221,187,95,66,65,91,96,57,31,14,247,218,
+248,140,249,96,21,251,96,251,52,251,51,251,94,251,91,247,52,251,51,247,93,
+247,91,247,52,247,52,247,92,247,89,251,53,247,54,251,87,31,164,82,21,247,
+35,126,247,6,251,6,153,251,37,8,251,163,6,247,164,82,21,130,251,34,251,13,
+251,15,251,34,128,8,247,168,7,83,251,168,21,251,39,153,251,5,247,5,125,247,
+41,8,247,166,6,251,166,196,21,153,247,36,247,7,247,6,247,37,153,8,251,164,
+7,14,247,134,176,137,21,247,105,175,143,165,200,31,247,5,189,223,247,51,247,
+55,26,225,112,214,95,173,30,164,108,94,151,80,27,251,8,56,107,77,94,31,113,
+103,129,100,137,66,204,171,24,151,7,193,156,177,173,162,30,156,150,149,142,
+185,148,66,252,31,24,124,69,115,97,110,129,8,119,6,211,138,21,200,188,154,
+172,161,247,15,194,247,210,24,146,6,144,6,158,6,169,151,136,127,158,31,179,
+114,161,81,58,26,32,115,52,92,76,30,100,89,88,110,84,136,8,247,123,251,125,
+21,206,6,173,247,82,5,125,170,151,136,158,27,247,6,238,247,41,247,66,236,
+100,189,62,92,99,119,102,109,31,105,97,121,85,117,251,11,8,185,251,0,21,174,
+247,84,5,225,155,173,188,183,27,178,160,99,65,251,32,86,251,2,71,113,119,
+149,161,121,31,14,247,214,248,140,249,96,21,251,94,251,53,251,49,251,89,251,
+92,247,50,251,52,247,91,247,89,247,52,247,52,247,89,247,86,251,52,247,55,
+251,83,31,128,82,21,247,61,247,28,251,24,251,58,251,60,251,25,251,26,251,
+59,251,58,251,26,247,26,247,58,247,55,247,26,247,29,247,53,31,14,37,184,146,
+21,228,6,174,247,2,161,209,180,210,193,200,25,195,187,190,175,168,27,151,
+147,130,125,126,139,139,125,98,31,76,251,104,5,129,106,134,115,121,26,108,
+158,115,164,173,190,178,206,195,30,118,153,129,129,138,138,126,125,25,118,
+121,129,132,127,27,132,132,147,147,142,141,147,141,146,31,143,149,141,146,
+140,141,200,247,99,24,158,200,141,149,160,26,181,114,171,106,87,63,86,58,
+75,30,103,92,137,137,134,133,131,130,25,204,247,107,247,53,220,158,193,251,
+58,52,188,247,53,251,62,118,130,111,5,189,153,132,116,129,138,136,123,77,
+31,123,81,251,7,82,122,89,247,7,195,5,14,247,48,249,123,247,59,21,39,91,89,
+101,51,27,95,103,148,169,64,31,233,247,1,148,160,175,247,76,8,247,36,194,
+239,245,236,26,213,84,193,63,63,72,77,39,107,30,121,81,132,97,130,251,10,
+61,140,88,152,90,172,8,88,173,110,189,193,26,180,157,173,175,170,30,176,170,
+160,148,223,163,130,168,24,251,46,111,66,80,46,26,80,168,81,188,95,30,195,
+91,200,119,242,137,131,251,22,106,42,86,93,8,183,42,80,157,90,27,79,98,115,
+103,85,202,103,234,197,174,149,178,217,31,103,233,191,126,188,27,192,194,
+164,179,175,31,161,163,152,161,157,185,8,251,117,247,149,21,143,141,194,140,
+154,30,142,224,144,170,156,186,8,193,159,179,173,183,27,181,171,101,89,93,
+114,83,99,95,31,109,106,109,120,58,100,8,251,108,251,237,21,110,95,99,126,
+94,27,74,81,164,167,164,173,154,193,169,171,131,124,174,31,191,117,139,139,
+154,133,8,14,74,165,248,125,21,123,7,86,187,101,207,207,180,173,196,186,120,
+154,57,157,30,81,152,124,147,157,26,164,164,157,173,177,156,125,102,147,30,
+182,6,199,137,101,173,74,27,77,98,105,87,96,162,122,211,126,31,200,127,157,
+129,113,26,112,112,120,100,93,113,162,180,138,30,247,118,247,81,21,251,188,
+182,247,162,143,7,199,251,162,5,192,6,199,247,162,5,143,251,162,182,247,188,
+59,6,87,251,147,84,247,147,5,14,73,247,67,248,219,21,180,202,187,157,187,
+27,219,199,74,53,46,79,61,69,107,113,150,158,125,31,159,176,142,148,157,26,
+164,121,158,114,109,118,113,102,94,171,103,203,115,30,65,117,106,115,69,59,
+162,118,24,209,210,178,160,203,27,242,221,52,251,2,32,73,52,59,86,95,175,
+182,157,144,151,154,158,31,102,141,126,144,94,169,8,166,98,116,148,112,27,
+89,93,95,90,115,147,120,162,108,31,166,161,5,124,158,134,151,156,26,172,167,
+167,173,174,171,105,100,121,133,127,120,121,30,177,138,144,138,165,121,8,
+93,207,184,121,183,27,247,6,247,0,247,14,247,21,201,114,199,96,184,31,104,
+174,109,155,78,157,188,159,161,150,164,160,8,182,174,166,198,200,26,244,49,
+228,251,0,73,82,116,77,53,30,14,129,249,44,249,20,21,118,167,114,125,5,171,
+81,135,141,109,27,100,104,125,105,90,31,186,79,119,149,102,27,77,77,98,72,
+101,31,96,66,115,42,45,26,251,10,179,251,3,207,67,30,78,197,222,102,216,27,
+213,216,172,195,194,31,171,171,156,167,166,200,114,150,24,107,95,127,124,
+119,119,8,102,100,86,119,79,27,58,62,175,197,94,31,89,205,110,237,245,26,
+215,153,209,164,191,30,190,163,188,173,187,27,160,153,133,114,171,31,152,
+129,5,92,85,126,112,93,26,97,156,101,182,83,30,181,84,139,139,144,131,8,159,
+109,148,114,117,26,124,131,119,127,124,30,120,123,122,131,114,27,87,95,185,
+193,158,143,153,150,159,31,106,154,5,127,109,135,124,117,26,64,205,74,216,
+219,203,206,222,174,128,171,117,171,30,117,169,98,189,118,161,8,103,176,131,
+152,167,26,190,179,177,192,161,155,131,109,174,30,141,138,145,133,147,133,
+8,14,251,68,248,30,247,4,21,80,74,101,117,99,27,84,95,181,191,158,142,156,
+148,174,31,246,160,177,150,178,162,8,204,177,178,192,189,26,189,106,169,82,
+251,35,251,51,251,71,251,54,47,193,81,225,206,200,172,219,220,30,251,127,
+247,24,21,159,198,155,172,164,174,8,196,179,179,170,169,27,160,155,123,117,
+110,116,96,108,108,31,104,105,108,124,51,114,8,14,251,124,211,247,4,21,102,
+251,4,5,248,10,6,176,247,4,5,92,6,165,225,147,183,202,26,247,17,92,201,44,
+30,251,58,6,94,141,130,146,135,170,8,119,116,133,123,111,26,113,148,113,155,
+124,30,127,151,154,135,171,27,247,33,6,237,166,109,251,1,88,135,111,125,87,
+31,14,251,234,228,247,4,21,107,251,4,5,247,33,6,184,235,165,97,141,133,149,
+91,25,155,157,144,158,188,26,173,136,172,129,206,30,130,199,137,166,176,26,
+160,140,153,142,160,30,141,153,140,150,148,26,175,118,155,82,147,30,85,147,
+121,147,125,162,8,123,116,134,125,115,26,116,145,118,151,123,30,154,118,151,
+134,181,135,8,190,134,155,121,89,26,59,132,66,128,95,30,14,184,249,90,127,
+21,252,227,248,225,247,95,53,161,183,251,191,247,18,83,85,247,22,251,186,
+184,159,52,247,94,248,228,252,224,5,14,184,134,127,21,180,98,248,229,248,
+224,51,251,94,185,119,247,21,247,186,83,193,251,190,251,18,160,95,247,96,
+225,5,14,184,134,249,0,21,248,228,252,225,251,96,225,118,95,247,190,251,18,
+195,192,251,21,247,187,93,118,227,251,93,252,229,248,224,5,14,184,249,90,
+249,0,21,98,180,252,228,252,224,226,247,93,94,160,251,22,251,187,195,86,247,
+191,247,18,117,183,251,95,53,5,14,247,214,247,10,248,140,211,29,247,1,247,
+1,161,156,201,167,8,169,7,78,170,96,174,50,229,8,100,6,168,69,162,100,174,
+101,8,247,37,251,143,21,252,248,6,175,179,164,180,165,205,8,100,6,49,48,97,
+105,78,108,8,109,7,203,111,151,129,247,9,251,8,223,10,14,247,214,249,255,
+248,140,21,252,248,6,174,177,165,182,165,205,8,100,6,47,46,99,107,78,108,
+8,109,7,201,112,161,121,247,1,251,1,223,10,253,137,251,93,211,29,247,9,247,
+8,151,148,203,168,8,169,7,78,170,94,176,52,227,8,100,6,168,69,161,101,175,
+100,8,14,184,248,224,247,71,21,118,131,106,122,73,104,8,248,22,7,192,111,
+188,114,157,131,155,160,24,32,216,56,212,84,203,84,75,72,79,251,14,49,154,
+118,24,158,147,187,163,193,168,8,252,22,7,72,174,107,155,117,148,124,119,
+24,247,14,48,204,82,196,73,197,205,217,208,247,1,218,8,251,184,248,21,21,
+162,158,145,144,157,150,157,128,146,134,162,120,8,252,101,7,112,118,136,136,
+121,129,122,149,135,142,113,160,8,14,251,31,248,92,247,92,21,131,47,71,83,
+40,141,8,251,79,85,247,72,6,193,179,147,156,173,31,210,176,179,212,231,26,
+225,104,208,77,178,30,164,100,99,148,76,27,251,72,85,247,79,6,239,140,206,
+84,147,47,8,251,254,84,6,14,247,214,249,115,247,84,21,208,251,95,247,95,70,
+251,95,251,95,70,247,95,251,95,208,247,95,7,247,95,247,243,21,208,252,111,
+70,7,14,187,248,31,249,130,21,72,254,124,206,6,14,184,247,144,250,10,21,28,
+251,139,197,28,4,117,7,238,22,28,251,139,197,28,4,117,7,14,247,218,248,169,
+248,149,21,73,6,251,116,252,149,5,219,6,247,69,248,45,247,69,252,45,5,219,
+6,14,247,218,248,169,22,247,116,248,149,5,59,6,251,69,252,45,251,69,248,45,
+5,59,6,247,116,252,149,5,14,247,214,248,61,248,183,21,48,108,83,66,51,26,
+37,214,56,247,0,122,30,158,251,50,149,51,120,26,78,107,87,103,130,136,143,
+148,143,139,140,141,148,30,141,147,140,143,145,26,169,116,163,109,108,116,
+114,105,97,174,109,189,192,187,173,195,164,30,163,195,152,243,142,247,61,
+8,228,170,195,213,227,26,239,69,218,32,159,30,116,247,45,128,226,161,26,204,
+172,197,175,148,143,135,130,136,138,136,137,129,30,137,130,138,134,133,26,
+110,163,117,172,170,161,163,174,181,100,171,87,86,95,108,85,114,30,110,74,
+129,69,137,251,61,8,247,26,251,254,21,223,130,233,122,247,9,30,220,118,190,
+77,61,26,71,100,83,72,110,30,37,129,21,55,157,83,204,219,26,208,180,196,208,
+165,30,142,37,151,251,21,154,55,8,14,247,214,249,122,249,5,21,103,109,110,
+103,103,168,109,175,176,168,168,176,174,110,169,103,31,252,124,184,10,247,
+137,252,133,183,10,14,247,214,249,124,249,5,116,10,248,125,252,133,116,10,
+14,247,214,248,135,247,138,21,247,128,208,251,89,6,196,239,5,247,32,208,38,
+6,169,191,89,168,93,58,5,251,200,70,247,161,6,83,39,5,251,105,70,247,66,6,
+82,40,5,251,9,70,217,6,111,90,189,111,182,216,5,247,224,208,251,185,6,14,
+247,214,249,204,248,219,21,253,35,251,183,5,96,7,249,35,251,184,5,215,7,252,
+173,247,129,248,173,247,130,5,77,4,252,34,251,68,248,34,251,67,5,215,7,251,
+123,238,247,123,239,5,14,247,214,247,61,248,219,21,64,7,248,173,251,130,252,
+173,251,129,5,63,7,249,35,247,184,5,182,7,253,35,247,46,21,63,7,247,123,39,
+251,123,40,5,63,7,248,34,247,67,5,14,247,214,248,249,76,21,180,165,111,188,
+5,229,168,190,225,247,16,26,229,110,206,81,184,30,171,99,102,148,49,27,251,
+62,6,96,212,97,114,167,91,5,86,77,229,6,247,109,252,6,5,123,6,251,183,77,
+247,172,6,173,145,139,141,161,31,251,88,248,66,21,247,37,6,247,13,191,83,
+251,21,38,105,81,68,120,31,14,247,214,248,138,249,76,124,10,247,188,252,26,
+21,251,47,123,251,20,251,8,251,48,27,251,48,251,21,247,8,247,47,123,31,140,
+198,21,247,46,155,247,20,247,9,247,47,27,247,49,247,20,251,8,251,47,155,31,
+14,247,214,248,138,249,75,21,251,93,137,10,251,84,31,251,130,252,185,21,94,
+195,117,201,209,26,247,58,247,26,247,27,247,58,208,202,117,94,197,30,183,
+96,21,184,83,161,77,67,26,251,57,251,27,251,26,251,58,71,75,161,184,82,30,
+14,247,214,248,134,248,32,21,105,112,113,104,106,166,112,172,173,166,166,
+173,172,112,166,106,31,143,247,192,124,10,131,79,21,247,63,247,27,251,24,
+251,61,251,57,251,28,251,26,251,58,251,59,251,27,247,26,247,56,247,57,247,
+27,247,29,247,55,31,14,247,214,247,73,22,205,247,137,248,198,206,252,198,
+247,136,73,6,14,247,214,249,189,248,192,21,73,251,136,252,198,72,248,198,
+251,137,205,6,14,247,214,248,98,22,206,248,201,247,131,206,252,182,72,247,
+132,6,14,247,214,247,108,248,218,21,247,137,252,218,5,207,6,247,142,248,218,
+5,65,6,251,102,252,128,251,99,248,128,5,67,253,107,21,248,195,205,252,195,
+6,14,247,214,250,122,247,174,21,88,6,251,49,251,7,105,70,61,31,38,45,109,
+51,140,251,88,8,88,201,190,7,141,170,140,247,50,173,221,235,214,25,200,184,
+234,163,247,21,142,8,190,6,14,247,214,137,247,174,21,76,190,7,247,8,137,230,
+118,198,102,8,247,0,67,180,49,251,57,26,141,108,5,88,202,190,7,140,247,86,
+108,228,38,234,8,208,61,251,6,173,251,49,27,14,247,214,137,247,111,21,190,
+6,247,48,247,7,173,208,217,31,240,234,170,227,138,247,86,8,190,76,88,7,137,
+108,138,251,50,105,58,43,64,25,80,94,41,114,251,19,137,8,88,6,14,247,214,
+250,122,247,111,21,202,88,7,251,6,141,43,160,82,176,8,251,0,212,98,227,247,
+57,26,137,170,5,190,77,88,7,138,251,88,170,52,239,45,8,70,217,247,7,105,247,
+49,27,14,184,248,234,176,21,251,130,248,107,251,130,252,107,5,248,15,198,
+21,251,175,6,247,35,247,176,5,14,184,247,19,170,21,248,102,247,133,252,102,
+247,132,5,201,252,14,21,247,173,7,247,179,251,35,5,14,184,247,14,248,143,
+21,247,130,252,107,247,130,248,107,5,252,15,80,21,247,175,6,251,35,251,176,
+5,14,184,248,229,170,21,248,117,7,252,102,251,132,5,248,40,251,30,21,251,
+179,247,30,247,179,247,35,5,14,247,214,247,133,247,223,21,247,157,251,184,
+247,153,247,182,251,159,247,186,5,14,247,214,247,82,247,224,21,247,202,251,
+235,247,203,247,236,251,203,247,235,5,251,157,251,235,21,247,157,247,184,
+247,157,251,184,251,157,251,185,5,14,251,68,247,139,248,99,21,35,53,54,37,
+251,0,223,54,246,243,224,224,244,244,54,224,34,31,140,81,21,211,198,80,66,
+67,80,79,68,63,81,198,215,209,200,198,211,31,14,184,247,111,251,47,21,247,
+174,194,43,249,220,235,194,251,174,6,191,254,19,21,249,220,221,253,220,7,
+14,184,248,137,251,47,21,250,74,251,174,84,236,253,220,42,84,7,247,122,194,
+21,58,249,220,220,6,14,116,162,248,160,154,247,82,151,6,220,10,228,11,179,
+143,143,142,142,146,146,144,144,142,157,144,12,12,248,192,20,249,54,21,174,
+19,0,238,2,0,1,0,10,0,19,0,69,0,74,0,142,0,149,0,171,0,190,0,235,1,5,1,11,
+1,27,1,34,1,52,1,59,1,91,1,115,1,154,1,165,1,173,1,193,2,57,2,76,2,136,2,
+139,2,175,2,208,2,236,3,80,3,102,3,113,3,173,3,178,3,204,3,215,3,235,4,7,
+4,30,4,111,4,126,4,149,4,188,4,207,5,16,5,20,5,82,5,87,5,115,5,149,5,213,
+5,220,5,237,5,252,6,55,6,85,6,114,6,170,6,177,6,182,6,197,6,247,7,9,7,50,
+7,86,7,100,7,115,7,118,7,136,7,161,7,164,7,209,7,243,7,249,7,253,8,40,8,46,
+8,77,8,102,8,141,8,182,8,187,8,228,8,233,8,241,8,248,9,31,9,69,9,106,9,118,
+9,132,9,168,9,202,9,237,10,9,10,43,10,48,10,82,10,106,10,124,10,132,10,164,
+10,170,10,178,10,186,10,195,10,224,10,253,11,19,11,47,11,53,11,81,11,109,
+11,113,11,127,11,138,11,142,11,167,11,174,11,178,11,187,11,206,11,213,11,
+238,12,6,12,29,12,43,12,60,12,75,12,87,12,93,12,116,12,121,12,128,12,145,
+12,160,12,165,12,168,12,172,12,193,12,214,12,235,12,247,12,251,13,0,13,20,
+13,40,13,60,13,78,13,97,13,116,13,123,13,142,13,161,13,180,13,183,13,188,
+13,197,13,202,13,220,13,227,13,237,13,244,13,252,14,0,14,15,14,31,14,35,14,
+48,14,65,14,75,14,85,14,94,14,103,14,119,14,123,14,137,14,153,14,159,14,174,
+14,189,14,204,14,219,14,234,14,248,15,0,15,9,15,18,15,25,15,32,15,37,15,51,
+15,65,15,79,15,93,15,100,15,114,15,128,15,132,15,144,15,157,15,170,15,183,
+15,194,15,206,15,216,15,228,15,240,15,252,16,7,16,19,16,31,16,43,16,51,16,
+60,16,71,16,82,16,93,16,104,16,115,16,126,16,137,16,148,16,159,16,168,16,
+171,16,178,16,183,16,186,16,190,16,197,16,204,16,207,16,210,16,214,16,223,
+16,231,16,236,16,239,247,22,29,111,215,95,55,10,11,69,10,166,139,139,149,
+48,10,14,247,146,247,206,21,247,131,6,205,174,113,90,121,136,118,134,118,
+31,115,39,139,139,108,26,123,140,128,142,118,225,29,149,141,157,143,161,30,
+159,247,2,140,147,77,10,109,97,122,75,27,11,247,73,84,29,11,247,70,150,10,
+66,251,231,5,132,106,135,108,124,26,62,216,87,247,5,209,196,158,177,181,30,
+177,173,151,165,158,230,212,247,231,24,55,6,66,251,231,128,84,123,111,109,
+118,25,122,113,104,129,103,27,76,99,168,185,148,142,162,144,163,31,212,247,
+231,5,11,247,147,247,224,119,29,11,248,187,247,240,21,140,154,5,140,155,140,
+150,142,26,171,87,10,70,95,65,29,11,21,215,10,68,69,54,27,84,105,168,187,
+147,140,149,141,148,247,19,29,249,124,22,247,232,249,109,5,35,6,251,155,252,
+228,98,248,228,5,43,6,251,180,252,228,124,248,228,5,39,6,171,253,109,5,241,
+6,247,182,248,228,180,252,228,5,11,248,20,248,175,122,10,191,104,172,30,172,
+106,93,155,81,27,126,62,21,213,182,91,58,71,29,11,248,188,190,44,29,11,21,
+53,6,154,208,106,10,223,6,236,248,93,5,225,6,11,249,86,248,151,45,10,11,21,
+72,10,251,13,229,68,247,43,244,227,86,29,131,136,120,30,11,249,86,249,109,
+79,29,11,249,181,174,10,50,6,251,19,252,234,251,142,248,234,5,35,149,10,228,
+6,247,18,248,227,247,141,252,227,5,245,6,11,26,207,70,184,34,136,10,133,138,
+131,74,29,82,107,213,10,234,152,147,140,183,154,8,11,248,161,101,29,251,28,
+110,86,85,232,10,138,121,138,129,136,142,10,204,180,91,64,77,121,66,111,89,
+213,29,169,191,31,205,175,194,175,203,27,11,55,29,31,133,7,134,7,138,128,
+5,11,83,29,113,140,92,85,10,11,78,29,171,30,163,160,150,160,151,183,8,83,
+6,99,129,98,116,79,135,29,171,154,21,174,100,230,220,5,87,190,215,111,232,
+27,228,223,166,189,206,31,247,8,225,217,247,57,247,50,26,195,127,190,114,
+182,30,231,222,104,178,52,61,5,191,95,54,171,42,27,251,5,42,96,55,59,31,52,
+47,85,251,24,251,14,26,75,153,77,163,97,30,215,207,21,126,169,134,165,179,
+26,247,114,247,34,247,66,247,74,206,200,114,96,175,30,167,93,21,150,114,144,
+103,97,26,51,107,40,87,67,30,60,81,49,92,46,27,73,78,163,180,105,31,11,247,
+14,29,68,69,54,27,84,105,168,187,147,140,149,141,148,86,10,11,184,30,188,
+90,60,167,48,27,127,58,21,207,203,111,95,173,31,166,104,153,92,79,26,47,108,
+43,86,66,30,58,80,51,93,42,27,74,76,167,183,104,31,112,174,125,186,198,26,
+231,170,236,192,213,30,218,197,228,186,233,27,11,119,29,14,171,29,5,97,112,
+124,129,100,27,129,135,139,143,110,31,123,64,5,131,157,151,137,158,27,210,
+190,172,214,182,31,248,4,249,14,5,11,249,117,174,10,252,161,6,122,57,5,248,
+42,6,252,191,252,199,121,55,5,248,192,108,29,252,74,6,248,192,248,199,5,11,
+218,22,223,6,149,187,247,188,247,202,63,251,250,5,203,10,130,95,251,187,251,
+199,213,247,243,222,29,11,247,238,247,196,21,34,96,159,188,188,194,179,206,
+176,174,125,117,155,31,149,126,143,125,141,109,8,224,6,138,186,133,164,120,
+166,8,184,108,81,165,69,27,251,9,44,64,48,101,156,111,182,108,31,57,117,92,
+83,65,26,51,213,80,247,3,211,205,163,183,187,30,176,172,158,172,158,196,8,
+46,6,65,114,83,99,60,27,71,101,167,191,205,202,174,247,9,142,148,139,138,
+149,31,11,248,187,247,240,21,140,154,5,140,154,140,150,142,26,172,87,10,69,
+96,65,29,11,134,29,187,188,221,157,31,158,232,5,14,247,53,247,233,21,67,251,
+233,5,127,29,71,251,213,5,69,6,126,72,5,247,54,22,247,59,6,153,206,5,251,
+58,6,190,247,131,5,247,63,6,246,203,77,34,47,107,251,12,99,76,31,59,88,62,
+96,48,27,251,64,6,14,249,121,102,10,11,248,199,247,126,21,153,217,142,163,
+171,26,236,97,10,224,161,140,148,143,154,31,157,211,190,29,11,248,20,248,
+175,93,10,92,57,71,29,11,78,29,172,30,162,160,151,160,150,183,8,83,6,99,129,
+98,116,79,135,29,21,153,214,142,165,171,26,237,97,10,223,161,140,149,143,
+154,31,157,211,239,10,129,138,132,137,123,31,11,21,137,130,135,139,135,27,
+113,127,148,159,142,139,143,140,142,31,203,247,193,5,145,11,248,201,247,126,
+21,152,184,144,167,174,26,247,13,64,215,251,12,54,62,101,71,83,30,88,75,106,
+39,45,26,251,15,215,64,247,16,247,13,229,203,247,10,184,30,50,6,70,102,85,
+103,73,27,66,89,189,212,157,141,152,144,165,31,154,207,21,237,167,210,201,
+224,27,209,184,92,66,126,138,130,135,121,31,11,247,221,174,10,45,149,10,248,
+90,108,29,251,252,6,11,145,167,141,151,155,26,182,118,185,117,29,120,101,
+111,113,247,3,10,181,230,212,29,11,21,43,49,53,46,73,190,89,207,239,226,224,
+236,205,89,186,69,31,126,84,21,180,171,108,100,78,87,85,79,96,108,168,181,
+200,192,192,199,31,11,214,22,233,6,157,222,248,104,248,66,251,1,252,149,5,
+232,165,10,11,248,149,247,106,21,94,251,106,5,248,118,108,29,252,24,6,192,
+247,142,5,247,243,221,29,251,243,6,188,247,125,5,248,7,108,29,253,2,6,252,
+90,253,109,5,242,6,247,22,247,106,5,247,179,220,21,251,130,6,247,104,247,
+244,5,239,6,11,21,160,29,11,159,26,184,126,159,92,170,30,178,161,155,150,
+157,155,8,179,176,166,206,201,26,245,81,187,251,20,30,251,228,118,29,223,
+248,32,21,193,247,143,5,247,122,6,192,165,132,118,158,31,152,125,147,116,
+115,26,101,125,96,117,111,30,103,11,249,89,157,10,11,247,143,247,201,198,
+29,245,77,194,251,15,30,251,194,118,29,222,248,27,21,194,247,148,5,247,86,
+179,10,228,22,127,29,95,253,27,21,247,13,248,201,5,247,63,6,246,203,77,34,
+47,108,251,12,98,76,31,59,88,62,96,48,27,11,68,78,118,100,98,30,102,104,116,
+87,92,26,78,174,110,242,112,30,213,120,172,130,154,133,148,128,25,146,130,
+145,124,130,26,120,124,109,122,126,30,118,114,96,126,96,27,69,101,166,189,
+145,140,148,140,149,31,50,6,134,116,138,127,123,26,11,111,10,235,6,172,29,
+11,249,99,195,29,120,177,29,127,124,131,122,128,104,158,10,170,29,195,29,
+119,27,129,112,145,148,113,112,29,184,181,170,29,8,230,146,6,143,7,145,7,
+247,25,42,222,251,49,251,8,41,99,61,61,30,43,43,81,251,28,251,22,26,45,173,
+53,195,93,30,102,184,205,118,207,27,204,208,157,170,193,31,163,153,158,153,
+177,171,143,49,24,198,6,11,31,218,248,7,222,29,53,252,40,5,137,129,138,128,
+126,26,71,191,98,225,217,196,163,195,197,30,127,82,5,11,100,10,91,155,91,
+167,104,30,96,173,183,120,204,27,221,208,168,193,185,31,165,169,155,173,155,
+195,202,10,11,21,251,123,252,44,91,248,44,5,54,6,205,252,160,89,54,5,97,115,
+120,125,105,27,124,129,141,148,120,31,123,62,5,131,162,152,136,159,27,168,
+169,148,154,163,31,166,157,156,159,166,185,248,5,249,14,24,11,89,47,99,29,
+142,29,11,249,120,158,29,11,248,129,249,27,21,207,10,251,30,253,27,5,233,
+6,11,248,107,248,10,21,247,215,247,247,5,251,6,6,251,140,251,177,251,17,247,
+177,5,251,5,6,247,59,251,247,251,231,252,10,5,247,7,6,247,156,247,196,247,
+26,251,196,5,247,7,6,14,122,10,190,104,173,30,172,105,94,155,81,27,126,62,
+21,213,182,11,248,103,22,247,226,248,241,251,21,252,241,5,228,164,10,251,
+23,6,251,238,253,7,59,249,7,5,251,21,149,10,228,6,247,21,248,241,216,252,
+241,5,14,205,10,109,95,127,139,136,137,131,31,63,251,250,195,10,215,247,250,
+5,143,155,140,153,155,26,210,81,196,65,74,84,111,70,69,30,11,247,2,29,100,
+27,131,101,5,203,186,187,222,209,10,144,29,196,27,247,12,242,213,247,0,170,
+31,241,29,11,100,29,14,149,10,247,211,175,29,251,128,57,21,247,102,187,29,
+251,103,6,11,121,179,113,166,30,171,108,98,154,82,27,49,58,101,70,86,31,92,
+78,105,251,1,47,26,11,111,29,14,21,251,5,42,97,54,58,31,50,47,86,251,23,251,
+20,26,52,166,63,185,93,30,91,187,220,110,224,27,233,224,166,189,204,31,247,
+9,229,215,247,54,247,50,26,218,11,247,189,131,10,182,247,95,246,227,247,6,
+251,183,5,235,6,251,32,247,235,247,114,247,73,5,251,0,6,251,161,251,110,5,
+11,247,36,22,113,10,11,249,95,73,29,5,190,150,156,155,183,27,146,146,139,
+137,152,31,154,208,5,143,121,128,140,123,27,62,83,94,65,123,31,120,50,5,69,
+6,125,72,5,209,6,42,252,93,5,11,174,10,45,118,29,11,247,46,21,177,162,120,
+107,92,100,104,88,101,116,158,171,185,178,175,190,225,10,95,111,164,178,197,
+187,185,200,31,11,22,247,143,181,29,251,58,6,183,247,102,222,29,128,252,86,
+21,174,247,58,5,247,56,6,11,133,99,27,86,110,159,176,148,140,150,142,151,
+31,179,247,79,222,29,93,251,105,5,137,128,138,129,128,26,75,201,95,230,186,
+176,147,160,185,30,14,8,41,6,114,82,123,109,121,114,8,80,97,63,102,60,27,
+35,70,220,247,13,231,169,238,190,215,31,229,200,212,182,231,27,240,189,90,
+251,0,147,31,11,247,215,116,29,11,227,6,196,179,165,205,183,31,248,48,249,
+17,5,251,6,6,251,178,252,98,38,248,98,5,251,0,6,247,34,252,205,105,81,114,
+120,97,138,25,83,6,11,250,38,120,10,11,125,29,190,167,131,178,27,11,183,10,
+252,125,184,10,11,233,6,212,247,237,5,215,6,247,44,251,237,5,238,6,251,62,
+248,20,247,212,247,237,5,251,43,6,251,136,251,194,5,75,6,203,247,194,5,11,
+5,204,107,99,165,68,27,251,58,251,16,251,50,251,103,251,9,206,63,243,183,
+184,152,164,179,31,169,157,152,154,153,167,123,63,24,220,6,11,249,110,21,
+251,91,251,58,251,56,251,87,251,99,247,53,251,56,247,93,247,97,247,55,247,
+54,247,95,247,94,251,55,247,55,251,94,31,11,150,29,242,6,247,76,242,150,29,
+242,6,11,174,29,243,238,195,40,5,202,6,75,247,42,5,11,21,46,57,97,65,88,31,
+94,75,106,251,2,54,26,251,3,216,63,247,4,235,215,178,216,195,30,185,202,172,
+247,1,226,26,192,119,11,21,214,183,88,52,84,122,75,112,89,31,71,102,89,106,
+74,27,65,94,189,219,199,156,204,169,191,31,206,176,189,173,201,27,14,21,251,
+94,251,54,251,53,251,93,251,88,247,54,251,55,247,89,247,89,247,56,247,55,
+247,88,247,88,251,55,247,58,251,85,31,11,247,5,10,69,78,64,111,148,125,172,
+116,30,74,111,105,92,79,26,75,184,100,211,234,219,211,223,175,11,6,42,252,
+89,113,251,7,79,67,62,132,25,122,57,5,155,6,202,137,189,162,193,195,183,186,
+164,192,162,240,217,248,5,24,11,247,178,132,10,11,21,214,182,89,54,79,123,
+79,109,87,31,72,100,90,105,78,27,65,96,189,225,196,155,202,167,190,31,208,
+177,187,171,203,27,11,175,8,132,7,135,7,97,167,115,187,151,142,139,145,163,
+30,141,145,141,140,145,232,29,11,27,68,95,188,220,197,156,204,166,189,31,
+207,175,196,176,205,27,11,174,10,55,149,10,223,6,11,21,248,4,248,79,5,251,
+3,6,251,181,251,249,251,28,247,249,5,251,4,6,247,78,252,79,78,251,178,5,233,
+6,11,6,187,243,158,148,10,240,29,129,99,116,79,27,11,230,29,179,6,206,215,
+29,11,161,29,200,184,112,102,134,138,11,251,54,251,53,251,92,251,88,247,54,
+251,54,247,87,247,89,247,55,247,55,247,87,247,88,251,54,247,57,11,26,230,
+212,208,234,210,184,101,79,121,137,125,132,114,30,227,6,146,181,141,157,161,
+26,229,64,199,251,3,11,119,125,8,104,115,117,102,105,26,93,189,110,219,162,
+146,140,148,181,247,4,29,11,7,147,121,122,142,121,27,74,82,85,78,101,166,
+116,183,186,185,163,179,167,31,160,168,147,169,188,26,11,224,10,81,228,10,
+11,26,62,208,89,247,0,219,209,163,182,184,30,189,187,166,200,166,247,19,232,
+248,75,24,251,130,77,21,11,251,82,55,247,82,5,44,6,247,18,251,147,251,129,
+251,161,5,235,6,247,69,247,93,225,251,93,5,11,69,147,29,11,21,120,48,142,
+35,5,170,6,187,243,158,230,5,14,182,10,132,95,21,159,153,124,119,113,11,202,
+152,29,11,230,5,199,251,43,21,47,6,117,36,5,231,6,251,44,242,21,47,6,117,
+36,5,231,6,14,6,251,47,253,109,5,11,248,160,21,11,178,29,135,135,139,137,
+126,31,11,6,247,29,249,27,229,10,251,29,253,27,5,251,147,164,29,45,6,14,247,
+176,247,223,247,8,29,144,125,27,113,117,117,112,108,167,115,174,183,170,170,
+197,153,31,155,203,144,212,247,65,26,11,50,6,170,247,36,222,29,108,251,36,
+5,68,6,125,72,5,210,6,60,252,6,5,137,11,21,248,81,251,99,156,216,251,245,
+247,55,248,58,247,56,156,218,252,169,251,99,5,14,21,252,243,253,109,5,197,
+6,248,243,249,109,5,11,203,29,144,150,137,135,149,31,117,204,156,135,161,
+27,183,182,11,243,10,229,27,189,176,104,93,133,137,125,135,122,31,11,217,
+29,113,110,124,118,122,31,127,124,131,11,143,206,29,181,170,29,6,77,247,93,
+5,46,6,213,251,130,251,120,251,178,5,242,6,247,93,247,141,5,11,249,120,188,
+29,11,6,247,47,249,109,5,11,164,10,45,6,122,57,252,103,252,64,247,0,248,146,
+229,10,11,203,29,145,149,137,135,150,31,117,203,156,135,161,27,11,247,209,
+176,10,11,188,29,14,247,2,10,14,5,142,152,140,151,152,26,215,86,188,56,63,
+73,112,86,87,30,152,204,5,11,6,79,87,5,82,7,247,154,247,114,251,154,247,115,
+5,81,7,199,87,5,11,248,175,249,121,21,251,3,38,96,57,61,31,52,48,85,251,25,
+251,18,26,11,30,162,163,169,149,183,27,198,172,117,99,11,249,109,21,11,195,
+29,217,29,11,21,251,19,247,13,121,57,227,56,251,15,55,121,56,247,71,247,14,
+5,11,199,191,5,197,7,251,154,251,115,247,154,251,114,5,196,7,79,191,5,11,
+107,105,31,103,106,95,121,85,27,60,96,177,209,158,141,153,143,163,31,11,6,
+217,181,105,76,103,128,107,115,109,31,97,106,96,120,75,27,14,6,206,184,155,
+175,177,31,174,173,159,188,189,26,216,83,191,56,30,11,21,110,116,116,110,
+110,162,116,168,167,163,162,167,169,116,162,110,31,11,210,10,109,167,97,31,
+11,21,102,109,110,103,102,168,110,176,175,168,168,176,174,110,169,104,31,
+11,22,102,109,110,103,102,168,110,175,176,168,168,176,174,110,169,104,31,
+11,157,224,5,141,126,131,140,128,27,81,95,113,68,76,31,156,221,5,11,196,10,
+14,21,32,218,29,11,150,10,251,3,252,160,195,10,11,6,155,213,5,11,21,77,247,
+172,7,222,174,146,164,177,31,204,182,172,212,238,26,11,227,29,126,126,26,
+46,11,247,147,21,119,219,29,159,230,5,14,6,181,247,93,222,29,11,22,223,6,
+192,247,141,5,11,5,223,6,11,222,29,94,251,103,5,251,132,6,183,247,103,222,
+29,11,141,154,142,154,31,247,1,248,148,229,10,37,252,114,5,11,21,207,29,11,
+251,58,5,233,6,192,247,140,5,83,164,29,11,115,251,3,138,251,26,5,179,6,194,
+247,26,163,247,3,5,11,248,86,249,76,244,10,247,167,6,14,8,55,6,57,109,84,
+95,67,27,11,223,6,247,3,248,160,222,29,11,125,119,112,247,7,10,166,31,11,
+22,223,6,212,247,237,5,211,200,202,177,197,27,183,168,11,210,211,10,11,247,
+130,108,29,252,209,6,122,57,5,247,133,6,11,239,5,206,6,150,192,5,72,6,197,
+247,164,5,93,6,11,157,31,159,232,5,14,21,85,85,87,86,100,170,108,179,196,
+191,190,196,178,11,22,223,6,190,247,131,5,247,132,6,89,251,131,5,11,153,132,
+27,130,132,131,129,130,141,136,159,123,31,186,11,162,182,172,158,172,169,
+157,31,164,154,167,147,188,146,11,172,30,153,105,112,143,70,27,251,172,77,
+247,183,6,11,247,3,248,160,222,29,76,251,189,5,251,0,116,11,252,121,21,196,
+247,5,10,11,5,83,127,124,125,88,27,133,11,31,152,100,123,143,121,27,113,11,
+6,251,40,251,93,5,11,98,31,111,101,5,113,11,6,235,248,86,11,6,56,104,132,
+114,101,31,75,96,105,66,44,26,11,8,178,6,115,200,108,188,107,172,8,248,248,
+6,11,21,209,183,89,61,82,122,70,113,91,31,71,102,11,31,101,251,69,21,184,
+167,114,100,80,91,94,77,11,199,184,203,247,5,29,11,251,119,252,44,86,248,
+44,5,50,6,215,252,160,11,101,73,27,69,95,189,216,197,156,207,165,188,31,11,
+5,45,6,11,142,151,31,153,205,229,10,125,75,5,135,11,30,135,181,137,161,151,
+26,157,145,149,151,145,11,32,27,71,99,166,184,31,145,7,147,55,7,11,212,5,
+131,106,137,139,126,27,117,125,150,155,11,6,184,162,118,98,79,96,95,79,31,
+14,6,56,251,103,5,215,6,222,247,103,5,11,6,43,252,86,5,223,221,10,5,11,247,
+170,247,237,5,35,6,251,135,251,194,11,21,191,178,169,160,175,27,156,159,133,
+126,11,21,231,165,213,203,220,27,210,184,91,64,11,43,252,86,195,10,247,4,
+248,160,5,11,65,5,174,6,193,171,113,95,78,87,92,11,249,53,21,65,6,85,251,
+148,5,196,6,11,223,6,200,247,181,5,247,2,163,209,207,11,21,251,167,6,124,
+70,5,11,5,247,124,189,10,251,209,6,11,6,247,26,251,237,251,225,252,20,5,11,
+6,247,157,247,196,247,26,251,196,5,11,21,252,120,6,125,67,5,248,119,6,11,
+21,252,235,6,128,89,5,248,235,6,11,30,101,98,80,121,59,27,251,5,87,11,41,
+83,237,5,76,6,203,251,40,5,11,170,161,170,188,26,195,98,173,74,54,11,248,
+104,248,10,21,247,214,247,247,5,11,113,113,111,119,124,153,160,165,166,165,
+11,247,72,247,40,5,251,4,6,14,218,29,14,118,29,210,247,224,5,14,247,159,149,
+29,11,130,10,14,79,134,29,11,249,109,78,29,172,30,11,190,158,169,172,134,
+10,11,76,10,14,142,29,14,101,144,10,11,65,29,223,6,140,154,5,140,11,249,150,
+78,10,85,216,10,11,101,69,125,29,11,43,10,14,};
+#endif
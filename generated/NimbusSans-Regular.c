@@ -0,0 +1,1901 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NimbusSans_Regular_cff_size = 40089;
+asm(".section .rodata");
+asm(".global fz_font_NimbusSans_Regular_cff");
+asm(".type fz_font_NimbusSans_Regular_cff STT_OBJECT");
+asm(".size fz_font_NimbusSans_Regular_cff, 40089");
+asm(".balign 64");
+asm("fz_font_NimbusSans_Regular_cff:");
+asm(".incbin \"resources/fonts/urw/NimbusSans-Regular.cff\"");
+#else
+const int fz_font_NimbusSans_Regular_cff_size = 40089;
+const char fz_font_NimbusSans_Regular_cff[] = {
+1,0,4,2,0,1,1,1,19,78,105,109,98,117,115,83,97,110,115,45,82,101,103,117,
+108,97,114,0,1,1,1,54,250,26,0,250,27,1,250,28,12,0,250,29,2,250,29,3,248,
+24,4,251,43,12,3,251,102,251,191,250,156,250,199,5,29,0,76,156,230,13,28,
+39,106,15,28,39,128,17,188,29,0,0,141,65,18,2,3,2,0,1,0,3,0,9,0,16,0,22,0,
+28,0,38,0,44,0,50,0,56,0,66,0,73,0,79,0,89,0,99,0,105,0,111,0,117,0,123,0,
+136,0,142,0,148,0,154,0,162,0,168,0,173,0,186,0,192,0,202,0,209,0,216,0,227,
+0,238,0,247,1,2,1,6,1,13,1,24,1,35,1,42,1,49,1,60,1,72,1,84,1,96,1,103,1,
+115,1,126,1,138,1,145,1,152,1,158,1,164,1,166,1,171,1,177,1,184,1,190,1,196,
+1,206,1,212,1,218,1,224,1,234,1,241,1,247,2,1,2,7,2,13,2,19,2,25,2,38,2,44,
+2,50,2,61,2,73,2,79,2,84,2,97,2,103,2,113,2,117,2,124,2,135,2,144,2,151,2,
+162,2,173,2,180,2,191,2,197,2,204,2,215,2,227,2,239,2,251,3,2,3,14,3,20,3,
+27,3,34,3,40,3,48,3,60,3,64,3,70,3,74,3,79,3,86,3,93,3,100,3,109,3,118,3,
+131,3,138,3,145,3,155,3,166,3,172,3,179,3,183,3,189,3,200,3,206,3,212,3,216,
+3,222,3,234,3,246,4,2,4,8,4,18,4,29,4,36,4,39,4,43,4,46,4,50,4,62,4,73,4,
+79,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,135,4,142,4,151,4,163,4,
+168,4,175,4,179,4,184,4,188,4,194,4,205,4,208,4,217,4,223,4,232,4,242,4,251,
+5,2,5,9,5,19,5,28,5,37,5,44,5,53,5,62,5,74,5,81,5,88,5,94,5,108,5,117,5,127,
+5,136,5,141,5,152,5,160,5,168,5,176,5,181,5,193,5,203,5,211,5,222,5,229,5,
+237,5,247,6,1,6,12,6,21,6,33,6,46,6,51,6,63,6,70,6,83,6,91,6,103,6,112,6,
+121,6,128,6,137,6,146,6,157,6,171,6,182,6,191,6,196,6,210,6,222,6,236,6,248,
+7,2,7,14,7,27,7,39,7,52,7,59,7,67,7,76,7,82,7,88,7,98,7,104,7,110,7,115,7,
+122,7,134,7,142,7,151,7,158,7,165,7,179,7,184,7,188,7,193,7,200,7,207,7,211,
+7,214,7,219,7,223,7,228,7,234,7,236,7,238,7,240,7,247,7,249,7,252,8,1,8,4,
+8,11,8,14,8,17,8,20,8,27,8,32,8,36,8,41,8,46,8,53,8,57,8,60,8,65,8,69,8,74,
+8,80,8,87,8,89,8,91,8,98,8,100,8,103,8,108,8,111,8,118,8,121,8,124,8,127,
+8,132,8,139,8,145,8,149,8,155,8,167,8,182,8,187,8,200,8,210,8,222,8,230,8,
+239,8,251,9,5,9,17,9,29,9,44,9,54,9,66,9,74,9,83,9,95,9,105,9,117,9,134,9,
+154,9,163,9,172,9,181,9,190,9,199,9,208,9,217,9,226,9,235,9,244,9,253,10,
+6,10,15,10,24,10,33,10,42,10,51,10,60,10,69,10,78,10,87,10,96,10,105,10,114,
+10,123,10,132,10,141,10,150,10,159,10,168,10,177,10,186,10,195,10,204,10,
+213,10,222,10,229,10,236,10,245,10,254,11,7,11,16,11,25,11,32,11,39,11,46,
+11,53,11,60,11,69,11,76,11,83,11,92,11,101,11,110,11,119,11,128,11,137,11,
+144,11,151,11,158,11,165,11,172,11,179,11,186,11,193,11,200,11,207,11,214,
+11,221,11,228,11,235,11,242,11,249,12,0,12,9,12,18,12,27,12,36,12,45,12,54,
+12,63,12,72,12,81,12,90,12,99,12,108,12,117,12,126,12,135,12,144,12,153,12,
+162,12,171,12,180,12,189,12,198,12,207,12,216,12,225,12,234,12,243,12,252,
+13,5,13,14,13,23,13,32,13,41,13,50,13,59,13,68,13,77,13,86,13,95,13,102,13,
+111,13,120,13,127,13,134,13,143,13,150,13,157,13,164,13,173,13,182,13,191,
+13,200,13,209,13,218,13,225,13,232,13,239,13,246,13,253,14,4,14,11,14,18,
+14,25,14,32,14,39,14,46,14,53,14,60,14,67,14,74,14,81,14,88,14,95,14,102,
+14,109,14,116,14,123,14,130,14,137,14,144,14,151,14,158,14,165,14,172,14,
+179,14,186,14,193,14,200,14,207,14,214,14,221,14,228,14,235,14,242,14,249,
+15,0,15,7,15,14,15,21,15,28,15,35,15,42,15,49,15,56,15,63,15,70,15,77,15,
+84,15,91,15,98,15,105,15,112,15,119,15,126,15,133,15,140,15,147,15,154,15,
+161,15,168,15,178,15,185,15,192,15,196,15,250,16,58,16,69,73,74,65,98,114,
+101,118,101,65,111,103,111,110,101,107,67,97,99,117,116,101,67,99,97,114,
+111,110,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,99,114,
+111,97,116,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,116,69,111,
+103,111,110,101,107,71,98,114,101,118,101,71,100,111,116,97,99,99,101,110,
+116,73,100,111,116,97,99,99,101,110,116,76,97,99,117,116,101,76,99,97,114,
+111,110,78,97,99,117,116,101,78,99,97,114,111,110,79,104,117,110,103,97,114,
+117,109,108,97,117,116,82,97,99,117,116,101,82,99,97,114,111,110,83,97,99,
+117,116,101,83,99,101,100,105,108,108,97,84,99,97,114,111,110,85,114,105,
+110,103,85,104,117,110,103,97,114,117,109,108,97,117,116,90,97,99,117,116,
+101,90,100,111,116,97,99,99,101,110,116,65,109,97,99,114,111,110,117,110,
+105,48,50,49,65,67,99,105,114,99,117,109,102,108,101,120,87,99,105,114,99,
+117,109,102,108,101,120,87,100,105,101,114,101,115,105,115,89,99,105,114,
+99,117,109,102,108,101,120,72,98,97,114,69,109,97,99,114,111,110,71,99,105,
+114,99,117,109,102,108,101,120,72,99,105,114,99,117,109,102,108,101,120,73,
+109,97,99,114,111,110,73,111,103,111,110,101,107,74,99,105,114,99,117,109,
+102,108,101,120,75,99,111,109,109,97,97,99,99,101,110,116,76,99,111,109,109,
+97,97,99,99,101,110,116,78,99,111,109,109,97,97,99,99,101,110,116,79,109,
+97,99,114,111,110,82,99,111,109,109,97,97,99,99,101,110,116,83,99,105,114,
+99,117,109,102,108,101,120,71,99,111,109,109,97,97,99,99,101,110,116,85,109,
+97,99,114,111,110,85,111,103,111,110,101,107,69,98,114,101,118,101,73,98,
+114,101,118,101,105,106,108,111,110,103,115,97,98,114,101,118,101,97,111,
+103,111,110,101,107,99,97,99,117,116,101,99,99,97,114,111,110,99,100,111,
+116,97,99,99,101,110,116,100,99,97,114,111,110,100,99,114,111,97,116,101,
+99,97,114,111,110,101,100,111,116,97,99,99,101,110,116,101,111,103,111,110,
+101,107,103,98,114,101,118,101,103,100,111,116,97,99,99,101,110,116,108,97,
+99,117,116,101,108,99,97,114,111,110,110,97,99,117,116,101,110,99,97,114,
+111,110,111,104,117,110,103,97,114,117,109,108,97,117,116,114,97,99,117,116,
+101,115,97,99,117,116,101,115,99,105,114,99,117,109,102,108,101,120,115,99,
+111,109,109,97,97,99,99,101,110,116,116,99,97,114,111,110,117,114,105,110,
+103,117,104,117,110,103,97,114,117,109,108,97,117,116,122,97,99,117,116,101,
+122,100,111,116,97,99,99,101,110,116,104,98,97,114,117,110,105,48,50,49,66,
+119,99,105,114,99,117,109,102,108,101,120,119,100,105,101,114,101,115,105,
+115,97,109,97,99,114,111,110,121,99,105,114,99,117,109,102,108,101,120,99,
+99,105,114,99,117,109,102,108,101,120,101,109,97,99,114,111,110,103,99,105,
+114,99,117,109,102,108,101,120,105,98,114,101,118,101,105,109,97,99,114,111,
+110,106,99,105,114,99,117,109,102,108,101,120,107,99,111,109,109,97,97,99,
+99,101,110,116,108,99,111,109,109,97,97,99,99,101,110,116,110,99,111,109,
+109,97,97,99,99,101,110,116,111,109,97,99,114,111,110,114,99,111,109,109,
+97,97,99,99,101,110,116,117,98,114,101,118,101,117,109,97,99,114,111,110,
+117,111,103,111,110,101,107,114,99,97,114,111,110,115,99,101,100,105,108,
+108,97,103,99,111,109,109,97,97,99,99,101,110,116,69,117,114,111,112,101,
+115,101,116,97,108,105,114,97,102,114,97,110,99,117,110,105,48,51,56,55,117,
+110,105,50,50,49,57,117,110,105,48,48,65,68,97,102,105,105,48,48,50,48,56,
+97,102,105,105,54,49,50,52,56,113,117,111,116,101,114,101,118,101,114,115,
+101,100,117,110,105,50,50,49,53,117,110,105,48,50,67,57,97,114,105,110,103,
+97,99,117,116,101,104,99,105,114,99,117,109,102,108,101,120,101,98,114,101,
+118,101,105,111,103,111,110,101,107,108,100,111,116,111,98,114,101,118,101,
+111,115,108,97,115,104,97,99,117,116,101,105,116,105,108,100,101,117,116,
+105,108,100,101,76,100,111,116,79,98,114,101,118,101,83,99,111,109,109,97,
+97,99,99,101,110,116,84,99,111,109,109,97,97,99,99,101,110,116,116,99,111,
+109,109,97,97,99,99,101,110,116,85,98,114,101,118,101,65,114,105,110,103,
+97,99,117,116,101,79,115,108,97,115,104,97,99,117,116,101,65,69,97,99,117,
+116,101,69,110,103,84,98,97,114,101,110,103,116,98,97,114,107,103,114,101,
+101,110,108,97,110,100,105,99,110,97,112,111,115,116,114,111,112,104,101,
+85,116,105,108,100,101,97,101,97,99,117,116,101,73,116,105,108,100,101,87,
+103,114,97,118,101,87,97,99,117,116,101,119,103,114,97,118,101,119,97,99,
+117,116,101,89,103,114,97,118,101,121,103,114,97,118,101,117,110,105,50,48,
+48,50,117,110,105,48,48,65,48,115,109,105,108,101,102,97,99,101,105,110,118,
+115,109,105,108,101,102,97,99,101,104,101,97,114,116,100,105,97,109,111,110,
+100,99,108,117,98,115,112,97,100,101,109,97,108,101,102,101,109,97,108,101,
+109,117,115,105,99,97,108,110,111,116,101,115,117,110,105,110,118,98,117,
+108,108,101,116,99,105,114,99,108,101,105,110,118,99,105,114,99,108,101,102,
+105,108,108,101,100,114,101,99,116,102,105,108,108,101,100,98,111,120,117,
+110,105,50,53,65,49,116,114,105,97,103,117,112,97,114,114,111,119,114,105,
+103,104,116,97,114,114,111,119,108,101,102,116,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,117,112,97,114,114,111,119,100,111,119,110,97,
+114,114,111,119,117,112,100,110,97,114,114,111,119,117,112,100,110,98,115,
+101,108,111,122,101,110,103,101,116,114,105,97,103,100,110,72,49,56,53,51,
+51,99,97,114,114,105,97,103,101,114,101,116,117,114,110,97,110,103,108,101,
+108,101,102,116,97,110,103,108,101,114,105,103,104,116,117,110,105,118,101,
+114,115,97,108,97,108,101,112,104,101,120,105,115,116,101,110,116,105,97,
+108,73,102,114,97,107,116,117,114,82,102,114,97,107,116,117,114,103,114,97,
+100,105,101,110,116,68,101,108,116,97,97,114,114,111,119,100,98,108,100,111,
+119,110,97,114,114,111,119,100,98,108,117,112,110,111,116,101,113,117,97,
+108,101,113,117,105,118,97,108,101,110,99,101,114,97,100,105,99,97,108,105,
+110,116,101,103,114,97,108,105,110,116,101,103,114,97,108,116,112,105,110,
+116,101,103,114,97,108,98,116,97,112,112,114,111,120,101,113,117,97,108,108,
+101,115,115,101,113,117,97,108,103,114,101,97,116,101,114,101,113,117,97,
+108,114,101,118,108,111,103,105,99,97,108,110,111,116,117,110,105,111,110,
+105,110,116,101,114,115,101,99,116,105,111,110,101,108,101,109,101,110,116,
+112,101,114,112,101,110,100,105,99,117,108,97,114,105,110,102,105,110,105,
+116,121,112,114,111,112,111,114,116,105,111,110,97,108,99,111,110,103,114,
+117,101,110,116,116,104,101,114,101,102,111,114,101,112,114,111,100,117,99,
+116,115,117,109,109,97,116,105,111,110,97,102,105,105,54,49,50,56,57,112,
+97,114,116,105,97,108,100,105,102,102,99,105,114,99,108,101,109,117,108,116,
+105,112,108,121,119,101,105,101,114,115,116,114,97,115,115,110,111,116,115,
+117,98,115,101,116,97,110,103,108,101,112,114,111,112,101,114,115,117,112,
+101,114,115,101,116,112,114,111,112,101,114,115,117,98,115,101,116,114,101,
+102,108,101,120,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,
+117,98,115,101,116,110,111,116,101,108,101,109,101,110,116,97,114,114,111,
+119,100,98,108,108,101,102,116,97,114,114,111,119,100,98,108,114,105,103,
+104,116,97,114,114,111,119,100,98,108,98,111,116,104,117,110,100,101,114,
+115,99,111,114,101,100,98,108,117,110,105,50,48,51,69,101,109,112,116,121,
+115,101,116,101,120,99,108,97,109,100,98,108,72,49,56,53,52,51,72,49,56,53,
+53,49,111,114,116,104,111,103,111,110,97,108,109,105,110,117,116,101,115,
+101,99,111,110,100,104,111,117,115,101,117,110,105,50,49,50,54,97,115,116,
+101,114,105,115,107,109,97,116,104,115,117,99,104,116,104,97,116,101,115,
+116,105,109,97,116,101,100,116,114,105,97,103,114,116,116,114,105,97,103,
+108,102,109,117,115,105,99,97,108,110,111,116,101,100,98,108,65,108,112,104,
+97,66,101,116,97,71,97,109,109,97,117,110,105,48,51,57,52,69,112,115,105,
+108,111,110,90,101,116,97,69,116,97,84,104,101,116,97,73,111,116,97,75,97,
+112,112,97,76,97,109,98,100,97,77,117,78,117,88,105,79,109,105,99,114,111,
+110,80,105,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,111,
+110,80,104,105,67,104,105,80,115,105,117,110,105,48,51,65,57,97,108,112,104,
+97,98,101,116,97,103,97,109,109,97,100,101,108,116,97,101,112,115,105,108,
+111,110,122,101,116,97,101,116,97,116,104,101,116,97,105,111,116,97,107,97,
+112,112,97,108,97,109,98,100,97,117,110,105,48,51,66,67,110,117,120,105,111,
+109,105,99,114,111,110,112,105,114,104,111,115,105,103,109,97,116,97,117,
+117,112,115,105,108,111,110,112,104,105,99,104,105,112,115,105,111,109,101,
+103,97,117,110,105,48,51,67,50,116,104,101,116,97,49,112,104,105,49,111,109,
+101,103,97,49,105,111,116,97,100,105,101,114,101,115,105,115,117,112,115,
+105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,100,105,
+101,114,101,115,105,115,116,111,110,111,115,65,108,112,104,97,116,111,110,
+111,115,69,112,115,105,108,111,110,116,111,110,111,115,69,116,97,116,111,
+110,111,115,73,111,116,97,116,111,110,111,115,79,109,105,99,114,111,110,116,
+111,110,111,115,79,109,101,103,97,116,111,110,111,115,85,112,115,105,108,
+111,110,116,111,110,111,115,73,111,116,97,100,105,101,114,101,115,105,115,
+85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,97,108,112,104,
+97,116,111,110,111,115,101,112,115,105,108,111,110,116,111,110,111,115,101,
+116,97,116,111,110,111,115,105,111,116,97,116,111,110,111,115,111,109,105,
+99,114,111,110,116,111,110,111,115,111,109,101,103,97,116,111,110,111,115,
+117,112,115,105,108,111,110,116,111,110,111,115,105,111,116,97,100,105,101,
+114,101,115,105,115,116,111,110,111,115,117,112,115,105,108,111,110,100,105,
+101,114,101,115,105,115,116,111,110,111,115,97,102,105,105,49,48,48,49,55,
+97,102,105,105,49,48,48,49,56,97,102,105,105,49,48,48,49,57,97,102,105,105,
+49,48,48,50,48,97,102,105,105,49,48,48,50,49,97,102,105,105,49,48,48,50,50,
+97,102,105,105,49,48,48,50,52,97,102,105,105,49,48,48,50,53,97,102,105,105,
+49,48,48,50,54,97,102,105,105,49,48,48,50,56,97,102,105,105,49,48,48,50,57,
+97,102,105,105,49,48,48,51,48,97,102,105,105,49,48,48,51,49,97,102,105,105,
+49,48,48,51,50,97,102,105,105,49,48,48,51,51,97,102,105,105,49,48,48,51,52,
+97,102,105,105,49,48,48,51,53,97,102,105,105,49,48,48,51,54,97,102,105,105,
+49,48,48,51,55,97,102,105,105,49,48,48,51,56,97,102,105,105,49,48,48,51,57,
+97,102,105,105,49,48,48,52,48,97,102,105,105,49,48,48,52,49,97,102,105,105,
+49,48,48,52,50,97,102,105,105,49,48,48,52,51,97,102,105,105,49,48,48,52,54,
+97,102,105,105,49,48,48,52,53,97,102,105,105,49,48,48,52,52,97,102,105,105,
+49,48,48,52,55,97,102,105,105,49,48,48,52,56,97,102,105,105,49,48,48,52,57,
+97,102,105,105,49,48,48,53,48,97,102,105,105,49,48,48,53,49,97,102,105,105,
+49,48,48,53,51,97,102,105,105,49,48,48,53,52,97,102,105,105,49,48,48,53,53,
+117,110,105,48,52,67,48,117,110,105,48,52,67,70,97,102,105,105,49,48,48,53,
+55,97,102,105,105,49,48,48,53,56,97,102,105,105,49,48,48,53,57,97,102,105,
+105,49,48,48,54,48,97,102,105,105,49,48,49,52,53,117,110,105,48,52,69,56,
+117,110,105,48,52,57,54,117,110,105,48,52,65,69,117,110,105,48,52,68,56,117,
+110,105,48,52,66,65,97,102,105,105,54,49,51,53,50,117,110,105,48,52,57,50,
+117,110,105,48,52,66,48,97,102,105,105,49,48,48,50,51,97,102,105,105,49,48,
+48,50,55,97,102,105,105,49,48,48,53,50,97,102,105,105,49,48,48,53,54,97,102,
+105,105,49,48,48,54,49,97,102,105,105,49,48,48,54,50,117,110,105,48,52,69,
+50,117,110,105,48,52,69,69,117,110,105,48,52,57,67,117,110,105,48,52,57,65,
+117,110,105,48,52,65,50,117,110,105,48,52,66,50,117,110,105,48,52,66,56,117,
+110,105,48,52,66,54,117,110,105,48,52,48,48,117,110,105,48,52,48,68,117,110,
+105,48,52,54,50,117,110,105,48,52,55,50,117,110,105,48,52,55,52,117,110,105,
+48,52,57,56,117,110,105,48,52,65,48,117,110,105,48,52,65,65,117,110,105,48,
+52,67,66,97,102,105,105,49,48,48,54,53,97,102,105,105,49,48,48,54,54,97,102,
+105,105,49,48,48,54,55,97,102,105,105,49,48,48,54,56,97,102,105,105,49,48,
+48,54,57,97,102,105,105,49,48,48,55,48,97,102,105,105,49,48,48,55,50,97,102,
+105,105,49,48,48,55,51,97,102,105,105,49,48,48,55,52,97,102,105,105,49,48,
+48,55,54,97,102,105,105,49,48,48,55,55,97,102,105,105,49,48,48,55,56,97,102,
+105,105,49,48,48,55,57,97,102,105,105,49,48,48,56,48,97,102,105,105,49,48,
+48,56,49,97,102,105,105,49,48,48,56,50,97,102,105,105,49,48,48,56,51,97,102,
+105,105,49,48,48,56,52,97,102,105,105,49,48,48,56,53,97,102,105,105,49,48,
+48,56,54,97,102,105,105,49,48,48,56,55,97,102,105,105,49,48,48,56,56,97,102,
+105,105,49,48,48,57,49,97,102,105,105,49,48,48,57,50,97,102,105,105,49,48,
+48,57,51,97,102,105,105,49,48,48,57,52,97,102,105,105,49,48,48,57,53,97,102,
+105,105,49,48,48,57,54,97,102,105,105,49,48,48,57,55,97,102,105,105,49,48,
+48,57,56,97,102,105,105,49,48,48,57,57,97,102,105,105,49,48,49,48,49,97,102,
+105,105,49,48,49,48,50,97,102,105,105,49,48,49,48,51,97,102,105,105,49,48,
+49,48,53,97,102,105,105,49,48,49,48,54,97,102,105,105,49,48,49,48,55,97,102,
+105,105,49,48,49,48,56,97,102,105,105,49,48,49,57,51,117,110,105,48,52,69,
+57,97,102,105,105,49,48,48,56,57,97,102,105,105,49,48,48,57,48,117,110,105,
+48,52,57,55,117,110,105,48,52,65,70,97,102,105,105,49,48,56,52,54,117,110,
+105,48,52,66,66,117,110,105,48,52,57,51,117,110,105,48,52,66,49,97,102,105,
+105,49,48,48,55,49,97,102,105,105,49,48,48,55,53,97,102,105,105,49,48,49,
+48,48,97,102,105,105,49,48,49,48,52,97,102,105,105,49,48,49,48,57,97,102,
+105,105,49,48,49,49,48,117,110,105,48,52,69,51,117,110,105,48,52,69,70,117,
+110,105,48,52,57,68,117,110,105,48,52,57,66,117,110,105,48,52,65,51,117,110,
+105,48,52,66,51,117,110,105,48,52,66,57,117,110,105,48,52,66,55,117,110,105,
+48,52,53,48,117,110,105,48,52,53,68,117,110,105,48,52,54,51,117,110,105,48,
+52,55,51,117,110,105,48,52,55,53,117,110,105,48,52,57,57,117,110,105,48,52,
+65,49,117,110,105,48,52,65,66,117,110,105,48,52,67,67,117,110,105,50,49,49,
+69,117,110,105,50,50,57,53,117,110,105,50,48,65,70,117,110,105,50,48,68,68,
+117,110,105,50,49,48,70,117,110,105,50,49,49,50,117,110,105,50,49,50,48,117,
+110,105,50,49,50,56,117,110,105,50,49,50,68,117,110,105,50,49,50,70,117,110,
+105,50,49,51,54,117,110,105,50,49,51,55,117,110,105,50,49,57,54,117,110,105,
+50,49,57,55,117,110,105,50,49,57,56,117,110,105,50,49,57,57,117,110,105,50,
+49,67,52,117,110,105,50,49,67,54,117,110,105,50,49,68,53,117,110,105,50,50,
+48,68,117,110,105,50,50,49,51,117,110,105,50,50,50,51,117,110,105,50,50,50,
+53,117,110,105,50,50,50,55,117,110,105,50,50,50,56,117,110,105,50,50,50,69,
+117,110,105,50,50,51,53,117,110,105,50,50,51,55,117,110,105,50,50,54,50,117,
+110,105,50,50,54,65,117,110,105,50,50,54,66,117,110,105,50,50,56,53,117,110,
+105,50,50,57,54,117,110,105,50,50,57,56,117,110,105,50,50,57,57,117,110,105,
+50,50,65,50,117,110,105,50,50,65,51,117,110,105,50,50,65,52,117,110,105,50,
+50,66,66,117,110,105,50,53,54,68,117,110,105,50,53,54,69,117,110,105,50,53,
+54,70,117,110,105,50,53,55,48,117,110,105,50,53,66,53,117,110,105,50,53,66,
+57,117,110,105,50,53,66,70,117,110,105,50,53,67,51,117,110,105,50,53,67,54,
+117,110,105,50,53,67,55,111,112,101,110,98,117,108,108,101,116,117,110,105,
+51,48,49,65,117,110,105,51,48,49,66,49,46,48,48,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,67,111,112,121,114,105,103,104,116,32,40,85,82,87,41,43,43,44,67,
+111,112,121,114,105,103,104,116,32,50,48,49,52,32,98,121,32,40,85,82,87,41,
+43,43,32,68,101,115,105,103,110,32,38,32,68,101,118,101,108,111,112,109,101,
+110,116,78,105,109,98,117,115,32,83,97,110,115,0,204,2,0,1,0,115,0,169,0,
+174,1,16,1,96,1,109,1,165,1,190,1,239,2,129,2,133,2,137,2,151,2,215,2,218,
+3,2,3,46,3,79,3,180,4,23,4,117,4,128,4,150,4,168,4,239,5,12,5,41,5,118,5,
+193,5,231,6,27,6,43,6,70,6,73,6,138,6,152,6,164,6,223,6,231,6,235,7,23,7,
+64,7,68,7,119,7,134,7,182,7,222,8,12,8,40,8,50,8,95,8,139,8,183,8,200,8,204,
+8,246,9,32,9,37,9,76,9,86,9,103,9,126,9,138,9,175,9,208,9,235,9,244,10,19,
+10,23,10,35,10,41,10,72,10,81,10,90,10,122,10,145,10,176,10,193,10,222,10,
+251,11,24,11,30,11,40,11,68,11,95,11,122,11,134,11,159,11,170,11,181,11,207,
+11,232,12,1,12,26,12,38,12,61,12,75,12,89,12,113,12,127,12,132,12,139,12,
+160,12,164,12,186,12,201,12,222,12,243,13,8,13,29,13,38,13,53,13,73,13,87,
+13,96,13,115,13,131,13,144,13,163,13,170,13,181,13,199,13,217,13,229,13,238,
+13,255,14,16,14,33,14,50,14,64,14,80,14,96,14,112,14,126,14,141,14,156,14,
+171,14,180,14,189,14,196,14,210,14,224,14,238,14,250,15,7,15,20,15,33,15,
+46,15,59,15,72,15,85,15,96,15,103,15,111,15,119,15,127,15,139,15,151,15,163,
+15,175,15,187,15,199,15,211,15,223,15,230,15,236,15,242,15,248,16,3,16,14,
+16,25,16,33,16,44,16,55,16,66,16,77,16,88,16,97,16,104,16,110,16,115,16,119,
+16,129,16,139,16,149,16,159,16,169,16,179,16,187,16,192,16,196,16,205,16,
+214,16,223,16,232,16,241,16,250,17,3,17,12,17,19,17,25,17,31,17,37,17,42,
+248,171,188,21,137,130,135,139,134,27,110,123,154,165,31,247,200,7,232,71,
+189,251,21,62,78,117,100,103,30,115,218,29,146,177,168,217,27,215,180,111,
+89,31,117,7,138,103,121,126,71,130,251,10,124,121,135,107,126,8,78,219,29,
+205,192,162,193,198,30,85,145,165,116,193,27,157,150,141,146,167,31,251,38,
+247,71,21,111,131,122,114,116,30,108,105,98,123,90,27,74,101,170,192,194,
+175,167,229,152,31,228,151,156,143,167,152,8,11,248,149,247,126,21,219,133,
+187,124,178,30,225,105,59,191,41,27,251,38,45,251,3,251,65,251,65,229,34,
+247,40,247,12,222,207,247,6,160,31,55,6,70,116,92,103,72,27,86,94,163,183,
+111,85,29,11,247,164,49,29,11,21,63,7,202,97,93,167,73,27,251,19,51,251,10,
+251,60,51,160,75,184,86,31,93,178,189,114,193,27,202,184,167,205,183,31,112,
+7,251,32,100,87,35,68,102,167,199,131,30,54,6,42,147,216,78,247,6,27,216,
+203,164,181,173,31,179,188,154,204,247,15,26,248,74,7,251,115,77,21,227,189,
+65,251,25,251,19,88,65,52,53,89,214,247,21,247,20,189,215,225,31,14,249,42,
+248,139,21,247,52,110,47,217,251,52,27,41,60,108,79,85,31,73,67,103,35,251,
+10,26,251,12,176,36,207,68,30,81,196,211,112,234,27,247,70,239,235,247,85,
+161,31,43,6,131,89,129,105,124,110,8,79,109,77,105,61,27,251,37,47,247,8,
+247,74,247,79,226,247,7,247,34,198,181,29,11,248,118,22,248,160,56,251,189,
+7,117,29,7,11,248,107,247,240,21,135,190,128,172,119,204,29,48,251,4,251,
+66,251,61,229,32,247,34,247,17,218,214,247,20,149,31,55,6,55,125,96,97,68,
+27,47,84,214,247,16,247,23,193,217,230,209,183,98,66,149,31,11,248,188,249,
+109,21,116,29,251,40,245,47,247,65,247,63,247,2,233,247,38,30,248,148,7,11,
+249,124,22,247,77,249,109,5,35,6,251,26,252,228,251,58,248,228,5,39,6,251,
+54,252,228,251,29,248,228,5,35,6,247,79,253,109,5,241,6,247,55,248,235,247,
+60,252,235,5,11,249,131,247,51,21,70,115,118,29,224,105,59,192,42,27,67,74,
+109,87,103,31,194,108,80,166,54,27,64,77,117,100,104,31,115,218,29,146,177,
+168,216,27,216,180,112,88,31,117,7,138,98,123,128,69,132,55,132,88,129,106,
+125,8,78,113,108,93,71,26,45,205,78,241,217,202,171,217,214,30,146,127,143,
+132,144,131,8,87,174,205,108,216,27,247,10,222,207,247,6,161,31,252,90,137,
+21,120,120,112,109,116,30,114,106,102,126,98,27,77,101,171,191,194,175,166,
+229,152,31,228,152,156,143,167,151,8,219,183,21,236,146,198,202,223,27,224,
+198,74,44,31,11,21,43,183,29,209,96,29,11,248,23,129,29,247,173,252,79,5,
+251,178,232,7,11,204,135,29,251,231,7,57,150,102,171,107,30,102,175,198,119,
+210,27,212,198,160,177,175,31,170,172,148,174,220,26,247,231,55,251,231,7,
+80,131,114,112,119,30,122,117,106,129,105,27,105,106,149,156,116,31,113,158,
+130,165,198,26,247,231,7,11,148,29,14,135,29,52,221,6,174,158,157,178,146,
+142,139,138,158,30,208,7,143,120,128,140,122,27,62,93,95,64,31,50,69,71,209,
+252,92,222,248,92,226,7,11,21,114,131,127,200,29,98,131,141,118,27,95,109,
+102,73,128,31,196,6,162,146,151,152,153,27,151,152,136,129,163,31,117,198,
+146,137,158,27,189,169,174,208,149,31,14,248,175,21,251,40,51,34,251,68,251,
+69,227,35,247,41,247,40,228,244,247,64,247,74,53,242,251,44,31,140,62,131,
+29,11,247,178,247,196,21,76,104,145,152,114,31,112,154,124,161,163,26,185,
+184,172,202,206,176,110,74,156,30,220,6,132,188,129,163,114,167,8,184,100,
+82,163,71,27,251,3,59,79,57,88,167,95,192,111,31,79,118,104,92,77,26,42,223,
+69,247,9,212,197,164,189,183,30,167,172,153,168,151,193,8,56,6,58,116,98,
+105,64,27,67,90,178,196,198,188,166,247,1,142,148,139,138,148,31,11,247,240,
+248,33,21,251,92,7,87,137,120,131,116,30,106,128,112,120,107,27,82,103,207,
+247,0,247,9,177,234,219,224,31,41,6,69,62,102,39,251,7,26,251,48,206,39,243,
+199,173,162,206,176,30,76,171,177,113,198,27,244,207,239,247,47,247,7,102,
+240,69,215,31,41,6,219,55,177,44,251,9,26,32,102,70,82,106,114,158,171,128,
+30,131,162,137,159,190,26,247,92,7,11,248,165,248,147,21,107,167,81,74,5,
+184,94,87,159,70,27,251,41,51,35,251,69,61,154,80,172,90,31,73,65,171,111,
+200,208,5,98,179,194,118,207,27,247,40,227,244,247,68,215,125,195,109,189,
+31,78,70,21,151,107,145,102,95,26,251,19,82,62,46,97,104,155,171,110,30,116,
+178,21,125,173,132,175,186,26,247,19,196,216,232,183,179,120,106,165,30,11,
+33,29,251,64,248,74,21,251,4,156,29,247,146,135,29,53,247,36,56,251,36,68,
+71,210,252,32,6,206,29,158,29,7,11,248,188,249,109,21,252,148,7,111,29,233,
+247,38,30,248,148,7,11,21,183,166,153,160,179,26,206,87,185,63,64,86,93,72,
+99,153,118,183,112,30,90,115,115,104,92,26,61,197,85,224,223,198,193,217,
+186,115,174,90,163,30,69,247,46,21,184,168,29,184,31,251,69,4,192,175,105,
+89,88,103,106,85,87,103,173,189,189,175,173,192,31,11,249,26,249,109,21,51,
+252,232,6,252,17,248,232,5,38,253,109,227,248,227,6,248,13,252,227,5,244,
+6,11,248,217,249,109,21,252,161,57,248,46,6,252,74,252,201,5,57,248,191,221,
+252,74,7,248,72,248,199,5,11,26,233,90,203,55,155,30,173,150,156,149,156,
+160,8,166,171,155,184,184,26,247,6,46,222,251,19,251,26,50,50,251,26,30,122,
+233,173,7,213,192,189,216,214,189,90,67,65,84,91,55,30,106,58,179,6,186,165,
+133,122,165,31,175,116,158,100,88,26,51,85,87,47,45,79,197,229,30,156,11,
+21,148,6,162,6,201,169,115,91,88,106,109,82,79,111,166,201,136,31,77,6,48,
+194,88,235,233,200,192,220,190,116,172,91,155,30,176,156,159,168,178,26,214,
+86,184,53,45,91,91,45,137,30,202,6,167,141,152,146,152,30,161,151,166,152,
+172,27,187,167,114,96,92,115,125,53,31,11,21,91,99,100,91,90,178,100,188,
+187,179,178,187,188,100,178,90,31,95,4,164,158,120,114,116,119,119,115,115,
+119,159,162,163,159,159,163,31,11,247,126,21,219,133,189,124,176,30,225,105,
+59,191,41,27,251,38,45,251,3,251,65,251,65,229,34,247,40,247,12,222,207,247,
+6,160,31,60,6,70,116,90,103,71,27,86,93,163,183,110,85,29,11,199,29,204,6,
+218,235,219,43,5,202,6,43,247,42,5,14,21,140,100,145,120,153,119,8,102,166,
+183,119,196,203,29,135,106,115,85,27,82,109,161,183,134,31,14,131,29,14,248,
+131,249,109,21,56,251,163,6,192,104,83,167,69,27,251,28,50,251,1,251,59,251,
+69,225,251,1,247,34,211,189,166,204,184,31,70,213,7,251,122,248,97,21,229,
+196,60,251,18,251,13,81,59,51,47,78,220,247,14,247,14,200,220,230,31,11,75,
+29,140,72,152,95,168,99,8,70,189,223,104,11,190,29,147,7,193,177,190,209,
+31,242,7,14,21,251,121,6,151,177,157,158,182,162,202,171,24,202,171,172,183,
+192,26,213,79,191,53,40,90,90,36,136,30,201,6,141,170,142,155,147,152,8,163,
+153,167,154,171,27,188,175,107,96,108,119,112,100,118,31,81,108,43,88,11,
+21,251,166,69,247,166,6,14,247,108,42,29,21,114,131,127,200,29,98,131,141,
+118,27,95,108,102,73,128,31,197,6,162,145,151,152,154,27,151,152,136,129,
+163,31,117,198,146,137,158,27,188,170,174,208,148,31,14,247,76,247,201,21,
+247,121,6,196,184,179,29,58,216,251,36,30,251,193,253,109,232,6,248,27,4,
+247,148,247,86,7,228,192,91,59,59,86,91,50,31,14,248,27,77,29,27,251,52,40,
+57,251,24,50,186,83,235,114,31,247,73,91,5,232,115,180,102,82,26,100,118,
+99,108,117,30,118,110,93,129,80,27,59,86,158,181,104,31,112,171,127,174,140,
+184,8,51,6,11,247,65,249,109,21,46,253,109,248,89,221,251,252,6,11,248,10,
+21,247,138,247,247,5,251,3,6,251,80,251,178,251,79,247,178,5,251,5,6,247,
+134,251,247,251,150,252,10,5,247,5,6,247,92,247,196,247,91,251,196,5,247,
+7,6,14,228,22,247,173,6,247,76,247,5,208,29,251,77,31,251,173,6,232,253,27,
+21,248,201,247,64,7,247,36,215,42,251,78,251,77,63,42,251,36,31,11,247,225,
+249,109,21,252,149,7,81,133,106,122,114,30,111,121,105,122,102,27,69,100,
+186,224,31,186,44,75,7,251,10,217,64,247,17,247,19,218,218,247,18,30,248,
+183,7,11,209,198,29,222,247,181,7,246,195,209,225,167,165,131,124,159,30,
+163,121,149,114,102,154,29,247,169,7,11,249,95,233,29,247,54,242,233,29,14,
+247,34,22,227,6,191,181,170,200,166,31,247,169,249,17,5,251,2,6,251,80,252,
+98,251,91,248,98,5,251,4,6,247,157,252,209,115,78,125,128,91,137,25,83,6,
+11,22,247,221,6,208,190,158,181,178,31,175,177,159,191,196,26,227,99,192,
+46,175,30,206,170,173,192,214,26,193,119,185,101,173,30,174,100,90,155,69,
+27,251,188,6,11,251,13,27,251,14,60,76,42,57,181,100,247,16,109,31,217,120,
+5,197,125,162,118,102,26,89,90,106,66,94,101,152,161,118,30,126,154,133,154,
+134,176,8,51,6,11,224,29,141,207,21,236,146,198,202,223,27,224,198,73,45,
+31,11,250,63,42,29,247,64,247,147,21,247,11,247,11,247,149,252,10,5,247,2,
+6,251,192,248,68,247,189,247,189,5,251,12,6,251,255,252,5,5,248,5,46,253,
+109,232,7,11,247,161,21,247,70,247,147,5,43,6,251,20,251,82,251,16,247,82,
+5,38,6,247,72,251,147,251,72,251,161,5,229,6,247,27,247,93,247,20,251,93,
+5,11,249,89,128,29,11,248,104,22,247,97,248,247,5,252,247,227,249,109,251,
+21,7,251,104,253,15,251,108,249,15,5,251,21,253,109,227,248,247,6,247,99,
+252,247,5,14,108,29,247,97,4,56,34,222,6,14,21,102,109,110,103,102,168,110,
+176,175,225,29,252,125,149,29,11,104,29,55,6,223,252,86,21,247,58,247,56,
+7,192,170,109,86,86,108,109,86,31,11,21,235,247,42,5,74,6,60,43,59,209,29,
+249,110,21,251,91,251,58,251,56,251,87,251,99,247,53,251,56,247,93,247,97,
+247,55,247,54,247,95,247,94,251,55,247,55,251,94,31,11,211,29,247,181,7,246,
+195,209,225,205,181,99,76,30,251,255,222,248,32,7,226,74,195,38,61,89,109,
+66,93,30,227,7,11,21,140,100,144,120,154,119,8,102,166,183,119,196,203,29,
+135,106,115,85,27,82,109,161,183,134,31,14,112,29,203,209,149,157,209,30,
+14,211,29,247,164,7,140,247,18,191,195,247,7,136,8,224,7,141,125,131,140,
+129,27,85,98,107,61,91,31,234,7,11,252,245,103,29,21,251,4,6,247,40,251,40,
+5,200,6,14,109,29,109,161,183,11,21,39,201,239,206,192,72,247,164,93,7,251,
+96,251,158,5,80,7,247,80,192,21,251,21,6,247,21,247,62,5,14,22,247,143,6,
+195,29,247,102,11,249,109,21,45,253,109,233,6,11,251,148,249,109,5,251,12,
+6,251,152,253,109,5,238,6,216,247,111,5,247,147,217,21,251,124,6,247,12,247,
+224,5,11,200,29,97,132,141,118,27,95,108,102,73,128,31,197,6,162,145,151,
+152,154,27,150,11,21,252,236,7,87,123,122,87,133,136,139,140,128,30,68,7,
+137,149,144,138,152,27,233,188,176,211,31,249,13,7,11,21,140,182,29,232,234,
+29,80,6,97,134,107,115,85,27,82,11,251,54,251,53,251,92,251,88,247,54,251,
+54,247,87,247,89,247,55,247,55,247,87,247,88,251,54,247,57,11,41,68,79,251,
+8,251,8,68,199,237,30,248,148,46,252,148,7,251,38,247,2,45,247,62,247,62,
+247,2,11,45,252,6,6,119,64,90,131,80,27,251,14,78,175,211,31,247,182,45,251,
+187,7,251,9,233,71,247,54,11,7,247,122,76,127,29,247,102,6,231,193,92,58,
+227,29,11,7,147,121,122,142,121,27,74,82,85,78,101,166,116,183,186,185,163,
+179,167,31,160,168,147,169,188,26,11,252,148,7,41,68,79,251,9,85,95,152,164,
+104,30,103,167,122,176,194,26,248,148,46,252,148,7,11,32,83,69,52,73,97,179,
+202,30,248,7,56,252,40,7,52,204,83,241,216,188,166,208,188,30,66,11,155,29,
+248,22,6,219,133,187,124,178,30,11,21,248,125,251,99,5,218,7,252,30,247,56,
+248,30,247,53,5,218,7,252,125,251,99,5,14,247,44,249,109,21,55,253,109,223,
+6,11,247,85,249,109,21,46,253,109,232,6,11,247,71,247,224,21,248,32,221,252,
+32,247,125,248,47,221,252,141,253,109,248,159,221,252,65,6,11,6,251,72,247,
+194,5,34,6,247,99,251,237,251,143,252,20,5,244,6,247,116,247,237,5,11,249,
+109,21,56,251,230,6,160,251,115,5,179,6,161,247,115,5,251,179,4,55,35,223,
+6,11,247,209,21,251,46,247,13,5,56,7,247,0,56,251,0,56,5,56,7,247,46,247,
+14,5,11,247,22,247,21,191,195,247,13,31,163,29,11,21,231,199,58,251,17,251,
+11,78,58,48,50,82,219,247,15,247,15,196,219,228,31,14,21,252,88,253,109,5,
+197,6,248,88,249,109,5,11,247,178,21,176,29,251,106,247,247,5,251,7,6,11,
+247,224,21,248,33,221,252,33,247,125,248,48,221,252,141,253,109,248,159,221,
+252,66,6,11,21,233,195,62,251,22,251,16,81,62,47,191,29,11,151,146,139,29,
+11,150,29,233,247,224,7,11,35,187,7,140,81,125,112,104,134,8,101,7,199,143,
+172,186,219,26,240,7,14,248,160,21,11,21,251,99,247,99,69,251,99,251,99,69,
+247,99,251,99,209,247,99,247,99,6,11,217,29,247,97,247,237,5,35,6,251,71,
+251,194,5,11,6,79,87,5,82,7,247,154,247,114,251,154,247,115,5,81,7,199,87,
+5,11,141,151,27,168,156,125,116,113,116,120,108,113,121,145,162,94,31,130,
+143,118,11,21,247,44,251,13,5,222,7,33,222,245,222,5,222,7,251,44,251,14,
+5,11,243,91,7,138,196,154,167,173,144,8,177,7,80,134,105,92,60,26,38,7,11,
+251,58,233,247,140,83,249,27,11,186,29,201,163,133,178,27,215,186,175,196,
+182,110,163,11,199,191,5,197,7,251,154,251,115,247,154,251,114,5,196,7,79,
+191,5,11,170,29,228,217,166,189,198,31,218,206,186,247,5,11,133,178,27,215,
+186,175,196,184,29,21,112,116,116,113,111,162,116,166,166,162,162,166,166,
+116,162,112,31,11,199,29,203,6,218,235,219,43,5,203,6,42,247,42,5,11,22,102,
+109,110,103,102,168,110,226,29,104,31,11,247,224,21,251,224,232,249,109,46,
+251,207,252,11,247,207,46,253,109,11,187,29,187,29,54,6,14,251,42,5,199,6,
+247,41,247,42,5,11,248,149,248,138,21,251,86,247,99,51,251,99,251,85,57,247,
+85,11,26,251,255,222,248,32,7,227,76,194,37,65,94,116,75,90,30,11,92,103,
+72,27,86,94,163,183,111,224,29,11,6,247,41,251,40,5,199,6,14,251,55,121,43,
+43,251,35,27,251,35,43,236,247,54,121,31,11,209,7,136,127,128,138,122,27,
+103,129,149,176,31,247,251,225,11,222,220,207,206,221,224,73,206,55,31,79,
+4,190,179,99,88,11,247,16,247,130,5,42,6,33,251,93,5,36,247,93,55,6,11,251,
+141,5,237,232,29,247,16,247,130,5,42,6,11,7,191,168,132,120,164,31,165,119,
+153,109,99,26,99,125,11,247,183,201,251,172,6,56,104,132,114,102,31,74,96,
+105,11,21,252,120,69,248,120,6,37,4,252,120,69,248,120,6,11,31,117,197,147,
+137,158,27,188,169,174,208,149,31,14,248,20,247,96,247,237,5,36,6,251,72,
+251,194,5,11,21,89,248,248,7,107,107,108,87,115,80,8,178,6,11,168,113,97,
+100,109,113,95,94,110,165,179,180,168,165,11,22,223,247,131,247,133,251,131,
+11,251,121,247,33,251,45,247,103,11,243,21,35,35,243,6,11,6,56,104,132,114,
+101,31,75,96,105,66,44,26,11,21,48,7,165,35,5,169,6,165,243,5,230,7,11,151,
+174,27,160,163,135,132,160,31,110,222,165,133,11,247,176,247,204,21,251,130,
+67,247,130,6,14,247,166,248,79,5,251,3,6,251,100,251,247,11,6,251,90,247,
+194,247,97,247,237,5,35,6,11,22,223,247,141,242,6,247,40,251,141,5,187,11,
+156,174,178,31,183,179,158,186,206,26,247,29,11,160,113,181,123,30,131,162,
+164,134,161,27,157,11,194,122,110,169,31,166,114,154,109,150,84,8,11,100,
+144,120,154,119,8,102,165,184,119,196,27,11,251,40,5,199,6,247,41,247,40,
+5,14,182,110,163,89,130,197,29,249,109,4,55,34,223,6,11,31,130,143,118,99,
+5,111,11,55,252,86,251,102,248,86,11,247,41,227,243,247,69,225,120,205,99,
+189,11,7,98,147,114,160,116,30,106,169,188,121,11,21,39,194,7,84,141,120,
+108,101,27,101,11,46,82,216,247,19,247,19,196,216,232,31,11,248,66,5,252,
+149,233,249,109,45,57,7,11,247,125,248,32,221,252,125,253,109,232,6,11,218,
+105,30,125,173,166,135,208,27,247,172,11,241,205,199,233,237,73,201,36,31,
+251,58,11,45,253,27,252,10,221,29,133,139,137,126,31,14,249,109,21,253,109,
+11,21,43,251,42,5,11,128,121,27,127,113,146,149,114,31,156,11,248,153,195,
+21,252,125,72,248,125,6,11,22,247,93,248,160,5,45,6,251,40,11,27,232,234,
+29,80,6,97,11,168,8,188,103,76,168,66,27,251,34,11,182,110,163,88,130,134,
+139,137,126,31,11,85,175,110,204,161,157,141,144,167,30,11,225,207,53,247,
+36,56,251,36,68,71,11,247,30,247,119,247,118,251,4,247,30,11,235,5,76,6,235,
+251,42,5,14,7,241,73,211,46,73,11,135,29,252,160,223,11,22,223,248,86,11,
+222,29,223,11,21,235,247,42,5,75,6,60,43,11,21,65,6,85,251,148,5,196,6,11,
+162,143,144,157,30,184,7,133,121,11,251,237,5,243,6,251,144,248,20,11,112,
+129,109,137,87,8,223,6,203,11,113,108,93,71,26,44,205,79,245,11,4,252,120,
+69,248,120,6,14,249,27,45,6,14,251,110,21,11,6,166,247,26,5,247,3,7,11,31,
+119,169,132,169,138,191,8,11,168,168,176,174,110,169,104,31,11,175,176,168,
+168,176,174,110,169,11,59,85,91,47,31,251,102,6,11,251,103,251,33,251,45,
+251,121,11,98,180,189,189,179,179,189,31,11,28,251,139,197,28,4,117,7,11,
+252,170,84,248,170,6,14,6,251,59,247,178,11,21,35,36,243,6,11,191,185,228,
+146,31,11,22,233,247,237,11,1,0,1,227,1,5,0,1,10,2,1,64,3,1,70,6,1,135,255,
+2,135,254,2,243,2,0,1,0,4,0,7,0,25,0,37,0,109,1,0,1,83,1,208,1,215,2,4,2,
+49,2,89,2,97,2,103,2,107,2,114,2,133,2,201,2,225,3,56,3,160,3,197,4,15,4,
+107,4,142,4,238,5,74,5,88,5,101,5,107,5,115,5,123,5,189,6,110,6,114,6,117,
+6,121,6,125,6,129,6,143,6,147,6,157,6,162,6,167,6,170,6,173,6,177,6,181,6,
+185,6,188,7,10,7,14,7,18,7,22,7,26,7,53,7,58,7,61,7,65,7,69,7,88,7,103,7,
+122,7,152,7,158,7,165,7,168,7,217,7,222,7,225,7,228,7,235,7,241,7,244,7,251,
+8,2,8,7,8,12,8,66,8,69,8,72,8,94,8,148,8,153,8,158,8,163,8,166,8,177,8,181,
+8,229,8,234,8,239,9,65,9,77,9,159,9,231,10,5,10,89,10,225,10,232,11,33,11,
+131,12,31,12,134,12,150,12,162,12,171,12,177,12,184,12,207,12,224,12,236,
+12,247,13,16,13,20,13,62,13,87,13,113,13,119,13,126,13,136,13,151,13,242,
+14,53,14,61,14,67,14,75,14,83,14,91,14,98,14,106,14,112,14,121,14,145,14,
+152,14,176,14,184,14,188,14,193,15,60,15,97,15,101,15,207,16,9,16,14,16,21,
+16,54,16,58,16,162,17,7,17,14,17,29,17,93,17,149,17,152,17,179,17,190,17,
+239,17,254,18,23,18,45,18,89,18,118,18,133,18,150,18,228,18,241,19,73,19,
+119,19,126,19,198,19,206,19,214,19,222,19,230,19,239,19,247,20,50,20,59,20,
+68,20,77,20,86,20,93,20,102,20,111,20,120,20,157,20,165,20,173,20,181,20,
+189,20,197,20,206,20,231,20,240,20,249,21,2,21,24,21,30,21,39,21,46,21,54,
+21,62,21,70,21,79,21,96,21,143,21,151,21,159,21,167,21,169,21,176,21,185,
+21,194,21,203,21,211,21,218,21,225,21,232,21,239,21,246,21,255,22,5,22,13,
+22,19,22,27,22,35,22,45,22,55,22,95,22,105,22,114,22,128,22,147,22,163,23,
+40,23,81,23,132,23,140,23,211,24,30,24,64,24,153,24,230,24,240,24,249,25,
+26,25,35,25,44,25,53,25,61,25,64,25,73,25,82,25,123,25,132,25,141,25,152,
+25,159,25,166,25,175,25,184,25,192,25,200,25,208,25,217,26,35,26,43,26,53,
+26,62,26,71,26,80,26,89,26,96,26,105,26,115,26,123,26,131,26,176,26,185,26,
+194,26,203,26,218,27,1,27,10,27,18,27,25,27,33,27,42,27,50,27,59,27,67,27,
+76,27,133,27,141,27,153,27,164,27,184,27,195,28,42,28,51,28,60,28,69,28,78,
+28,154,28,161,28,168,29,27,29,46,29,56,29,63,29,72,29,78,29,85,29,100,29,
+107,29,116,29,126,29,136,29,145,29,154,29,162,29,172,29,182,29,217,29,227,
+29,236,29,243,29,250,30,4,30,14,30,21,30,32,30,42,30,64,30,76,30,85,30,93,
+30,100,30,108,30,117,30,125,30,132,30,186,30,194,31,0,31,33,31,157,32,55,
+32,205,32,222,32,226,32,230,32,234,32,238,33,104,33,131,33,138,33,146,33,
+159,33,166,33,174,33,215,33,235,33,243,33,251,34,4,34,11,34,23,34,32,34,41,
+34,56,34,90,34,99,34,112,34,121,34,131,34,231,35,2,35,86,35,113,35,152,35,
+163,35,172,35,182,35,191,35,201,35,208,35,217,35,223,35,231,35,241,35,244,
+35,247,36,101,36,176,36,247,37,34,37,141,37,221,38,108,38,173,38,241,39,117,
+39,150,39,217,40,43,40,56,40,66,40,89,40,105,40,183,41,4,41,138,41,214,42,
+37,42,45,42,62,42,106,42,123,42,163,42,202,42,255,43,53,43,94,44,0,44,26,
+44,244,45,237,46,12,46,37,46,77,46,118,46,170,46,181,46,213,47,3,47,17,47,
+63,47,77,47,87,47,96,47,113,47,182,47,251,48,32,48,53,48,172,49,19,49,96,
+49,147,49,188,49,241,50,117,50,231,51,75,51,233,52,53,52,77,52,93,52,119,
+52,142,52,180,53,18,53,41,53,64,53,95,53,118,53,126,53,233,53,244,54,2,54,
+28,54,42,54,49,54,62,54,99,54,207,55,0,55,55,55,157,55,173,55,189,55,214,
+55,218,55,221,55,234,56,4,56,8,56,12,56,16,56,35,56,40,56,43,56,69,56,73,
+56,77,56,107,56,111,56,116,56,119,56,154,56,158,56,162,57,12,57,15,57,100,
+57,105,57,185,58,34,58,67,58,115,58,120,58,220,58,223,59,85,59,90,59,128,
+59,157,59,209,59,224,60,96,60,101,60,125,60,192,60,241,61,1,61,6,61,128,61,
+176,61,240,61,244,62,101,62,225,63,72,63,170,63,179,63,188,63,196,63,204,
+63,212,63,224,63,236,63,248,64,2,64,11,64,23,64,30,64,36,64,116,64,125,64,
+133,64,142,64,151,64,159,64,168,64,175,64,182,64,188,64,221,64,253,65,3,65,
+50,65,54,65,81,65,114,65,118,65,129,65,144,65,150,65,160,65,166,65,171,65,
+188,66,14,66,33,66,37,66,144,66,149,66,161,66,170,66,192,66,214,66,220,66,
+236,67,20,67,115,67,204,68,38,68,56,68,137,68,220,68,247,68,251,68,255,69,
+3,69,62,69,122,69,155,69,209,69,225,70,15,70,54,70,66,70,138,70,181,71,23,
+71,52,71,91,71,100,71,131,71,142,71,151,71,172,71,180,71,188,71,203,71,235,
+72,3,72,13,72,24,72,86,72,95,72,104,72,113,72,171,73,55,73,109,73,156,73,
+176,73,229,73,252,74,124,74,205,75,18,75,24,75,76,75,81,75,114,75,148,75,
+153,75,158,75,171,75,209,75,227,75,232,75,248,76,29,76,87,76,103,76,108,76,
+214,76,223,76,238,76,254,77,11,77,25,77,31,77,103,77,154,77,228,77,246,78,
+40,78,112,78,126,78,135,78,174,78,189,78,233,78,242,79,3,79,39,79,47,79,57,
+79,90,79,112,79,187,79,201,79,232,80,11,80,21,80,33,80,42,80,51,80,59,80,
+69,80,79,80,92,80,128,80,144,80,165,80,180,80,239,80,252,80,254,81,8,81,39,
+81,171,81,213,82,5,82,30,82,79,82,125,82,209,83,65,84,3,84,80,84,234,85,198,
+86,51,86,235,87,196,88,34,88,108,88,205,88,240,89,16,89,51,89,85,89,157,89,
+229,90,83,90,145,90,182,90,194,90,207,90,235,91,8,91,194,91,223,91,238,92,
+47,92,98,92,147,92,231,93,32,93,95,93,161,93,179,93,199,93,217,94,2,94,52,
+94,101,94,150,94,200,94,227,94,254,95,26,95,54,95,75,95,114,95,160,95,188,
+95,215,252,32,14,252,32,14,252,32,247,100,114,10,56,251,230,6,161,251,115,
+5,178,176,10,14,251,211,191,213,10,158,10,206,22,158,10,14,248,121,249,77,
+21,62,6,104,251,88,5,251,17,6,175,247,88,5,63,6,103,251,88,5,251,13,71,247,
+0,6,108,251,66,5,251,6,71,240,188,10,247,16,188,10,247,9,207,34,6,170,247,
+66,5,245,207,46,6,50,71,21,108,251,66,5,251,17,6,171,247,66,5,14,247,142,
+249,150,21,85,7,251,20,123,70,69,251,6,26,76,163,90,185,105,30,166,120,167,
+128,211,117,8,251,164,7,94,145,101,159,116,170,124,162,135,156,133,204,8,
+60,6,132,251,31,215,56,247,33,130,8,36,198,242,7,193,143,176,150,172,159,
+8,197,175,173,207,218,26,210,112,189,81,172,30,113,154,126,144,47,167,8,247,
+141,7,206,136,186,88,140,66,8,218,6,247,6,66,213,251,13,148,30,193,7,80,252,
+1,21,60,160,102,178,200,26,205,181,182,213,149,30,198,251,228,21,241,109,
+171,109,73,26,100,124,104,112,113,30,115,116,114,130,96,134,8,14,247,107,
+247,91,249,65,21,45,63,62,45,45,215,62,234,232,216,216,231,236,205,10,84,
+93,94,84,83,93,184,195,195,184,184,195,31,248,46,233,21,252,31,221,10,205,
+6,248,31,249,109,5,152,252,23,21,45,63,63,45,44,215,63,234,232,216,215,232,
+235,205,10,85,93,94,84,82,94,184,195,194,184,184,195,31,14,132,248,129,247,
+226,21,140,103,127,91,119,104,251,25,247,55,24,243,198,173,182,211,26,231,
+71,204,44,43,64,70,51,92,157,102,202,60,30,251,17,67,102,90,47,26,251,12,
+221,60,247,15,189,185,151,162,175,30,160,153,156,153,178,177,201,61,24,247,
+1,6,251,14,247,43,5,176,196,160,205,199,26,251,180,236,21,78,209,130,155,
+175,26,191,173,173,191,189,176,103,90,95,112,107,63,92,30,247,25,251,186,
+21,80,83,96,116,87,27,67,80,196,210,195,170,179,230,197,31,14,252,88,204,
+114,10,134,29,251,233,247,128,114,10,39,251,23,76,251,74,251,49,26,251,50,
+202,251,74,239,251,23,30,194,6,51,247,35,90,247,60,247,52,26,247,51,188,247,
+61,227,247,34,30,14,251,233,232,251,104,21,239,247,23,202,247,74,247,49,26,
+247,50,76,247,74,39,247,23,30,84,6,227,251,35,188,251,60,251,52,26,251,51,
+90,251,61,51,251,34,30,14,251,177,247,52,114,10,144,251,4,33,177,120,80,247,
+0,109,70,50,189,103,202,232,201,46,190,175,69,228,247,0,169,120,198,33,101,
+144,247,4,5,14,49,248,170,247,159,136,29,14,252,32,226,243,126,10,251,233,
+175,29,252,32,247,83,171,29,14,252,32,247,121,114,10,251,129,253,129,5,194,
+6,247,129,249,129,5,14,247,167,213,10,73,79,110,90,102,31,93,77,116,44,251,
+23,26,251,132,219,251,18,247,44,247,42,221,247,19,247,125,247,30,117,231,
+92,203,30,189,102,80,167,72,27,61,4,234,186,44,251,83,251,93,93,45,41,46,
+92,237,247,86,247,86,186,234,234,31,14,247,151,248,141,21,252,141,227,249,
+89,81,7,108,251,1,119,124,251,28,122,8,76,7,14,248,142,226,21,252,9,6,148,
+197,171,176,226,190,239,193,24,238,193,190,212,226,26,198,115,194,97,178,
+30,176,97,88,157,71,27,49,72,108,78,100,31,114,101,128,95,137,67,8,227,6,
+142,187,145,168,151,162,8,182,162,185,165,192,27,219,199,82,63,83,106,91,
+76,103,31,47,87,251,40,55,96,72,131,251,48,25,248,108,6,14,247,113,247,217,
+21,150,6,176,140,5,236,189,95,54,50,84,86,47,43,92,187,242,133,31,51,6,143,
+82,149,102,156,107,8,71,175,209,104,236,27,247,38,233,226,247,26,229,104,
+189,54,168,31,205,166,172,188,210,26,247,14,58,212,251,27,251,35,63,61,251,
+43,136,30,227,6,140,182,143,163,150,161,8,178,159,183,163,194,27,217,186,
+94,63,89,121,109,100,123,31,115,129,108,135,77,138,8,14,247,219,247,62,21,
+251,62,227,247,62,244,218,34,248,96,74,7,251,214,252,82,5,46,7,247,191,218,
+21,251,114,6,247,114,247,202,5,14,248,112,213,10,252,2,6,86,252,22,5,220,
+6,188,180,173,156,195,27,234,198,74,34,37,80,77,43,62,92,178,219,118,31,51,
+6,151,81,149,111,160,113,8,85,179,211,108,219,27,247,35,239,243,247,42,247,
+32,46,235,251,28,89,99,126,109,98,31,167,247,90,5,247,187,6,14,248,134,135,
+29,247,8,122,63,208,251,0,27,61,69,102,75,97,31,95,70,119,52,251,21,26,251,
+12,157,64,181,76,30,82,177,201,108,217,27,247,27,236,239,247,31,247,24,49,
+232,251,19,69,84,112,87,101,31,247,65,140,195,235,240,27,201,182,100,71,153,
+31,251,17,251,53,21,224,192,80,44,50,79,74,58,57,77,207,230,227,199,200,226,
+31,14,248,156,213,10,252,110,52,248,19,6,251,61,251,133,70,251,40,86,251,
+125,8,233,6,178,247,119,228,247,87,247,52,247,105,8,14,248,27,248,9,21,212,
+184,163,174,206,26,247,4,52,216,251,18,251,17,51,61,251,3,73,162,103,212,
+94,30,58,100,99,80,61,26,251,22,236,49,247,33,247,32,237,229,247,21,218,99,
+198,57,178,30,251,8,247,150,21,214,187,95,70,73,90,95,65,64,91,183,206,207,
+187,183,214,31,251,189,4,227,199,83,56,54,80,84,48,53,79,196,222,222,198,
+195,228,31,14,192,247,54,21,251,8,156,215,70,247,0,27,218,209,176,203,181,
+31,183,208,159,226,247,21,26,247,11,121,215,97,202,30,196,100,77,170,61,27,
+251,27,42,39,251,31,251,24,229,46,247,20,206,188,163,194,185,31,251,65,138,
+83,43,38,27,77,96,178,207,125,31,247,20,248,106,21,221,201,71,47,51,79,78,
+52,54,86,198,234,229,198,204,221,31,14,252,32,247,106,171,29,248,160,4,35,
+35,243,6,14,252,32,247,107,248,160,198,10,34,251,208,126,10,49,184,247,90,
+119,29,49,248,170,247,245,164,29,14,49,248,175,247,159,21,122,10,247,222,
+247,91,21,186,7,140,184,153,161,203,196,8,214,207,164,183,206,26,247,9,56,
+214,251,22,251,37,65,60,251,47,30,224,6,247,0,178,187,229,216,190,93,71,93,
+117,100,86,92,30,54,64,120,110,80,26,84,7,229,44,21,49,35,229,6,14,247,233,
+249,45,248,137,21,117,73,5,197,114,97,168,84,27,251,26,251,15,251,24,251,
+37,35,209,60,232,192,182,161,189,185,31,88,148,176,113,203,27,214,199,168,
+199,190,31,194,203,170,219,218,26,247,96,251,85,247,60,251,125,251,11,251,
+18,90,59,51,30,41,50,79,251,26,251,23,26,251,114,247,94,251,70,247,145,213,
+218,154,166,212,30,111,206,5,116,56,84,130,83,27,251,103,251,55,247,39,247,
+83,247,102,247,74,247,73,247,103,247,84,247,52,251,32,251,60,251,8,56,251,
+5,54,112,116,159,163,148,143,157,147,162,31,229,247,172,5,251,125,96,21,195,
+180,98,84,136,31,137,89,112,55,114,102,8,98,111,102,115,102,27,84,95,191,
+205,247,4,216,241,223,31,14,132,34,10,14,132,51,10,187,36,29,14,187,78,29,
+14,132,39,10,14,76,247,75,247,224,21,247,240,221,251,240,193,29,14,243,36,
+10,14,187,248,187,150,29,232,247,224,7,14,252,32,121,10,14,251,66,79,29,14,
+132,84,10,76,29,14,247,51,90,29,187,57,29,14,243,32,10,14,132,73,29,243,249,
+113,138,21,45,216,5,208,215,173,232,247,8,26,247,119,251,34,247,45,251,102,
+228,29,251,120,247,33,251,46,247,103,212,198,155,174,198,30,244,52,5,251,
+97,247,156,21,93,83,213,77,5,118,96,106,132,95,27,251,47,203,10,247,48,247,
+47,243,251,12,251,71,44,114,67,85,78,31,14,187,37,10,14,132,33,10,14,76,104,
+10,14,187,39,29,14,132,248,28,22,247,145,249,109,5,40,6,251,94,252,253,251,
+106,248,253,5,39,6,247,154,221,10,14,247,162,40,29,14,132,74,29,132,44,29,
+14,76,58,29,14,252,32,247,142,114,10,251,78,254,65,247,78,211,36,249,177,
+242,6,14,252,32,186,114,10,84,6,247,129,253,129,5,194,6,14,252,32,162,251,
+104,21,247,78,250,65,251,78,67,242,253,177,36,6,14,251,97,247,89,213,10,251,
+45,252,16,5,208,6,247,13,247,192,247,14,251,192,5,208,6,251,47,248,16,5,14,
+248,214,251,18,220,10,252,88,247,50,130,10,14,32,29,14,193,198,29,214,206,
+7,78,179,192,110,212,27,247,30,229,247,5,247,66,247,62,54,244,251,31,67,88,
+112,80,100,31,247,168,7,247,38,251,160,21,232,199,58,251,17,251,11,77,165,
+10,251,66,38,29,14,66,29,14,33,29,14,252,32,247,150,47,29,14,248,40,248,160,
+35,29,80,29,14,252,88,247,42,164,10,14,252,88,209,248,160,91,29,251,66,93,
+10,14,252,88,120,29,14,247,51,209,135,29,252,160,229,10,201,174,101,72,30,
+251,253,229,10,200,175,100,73,30,251,253,223,248,29,7,233,85,191,41,69,97,
+118,80,90,30,195,108,97,163,71,27,69,92,113,76,95,31,213,7,14,43,29,14,34,
+29,14,193,213,29,156,10,247,68,53,247,2,251,31,68,82,107,77,100,31,218,62,
+113,29,248,131,222,29,249,122,65,69,7,194,100,80,169,70,27,251,30,49,251,
+5,251,66,251,62,224,34,247,31,212,189,165,196,178,31,251,170,7,251,38,249,
+59,21,228,196,60,251,19,251,12,181,10,231,31,14,251,233,49,10,14,251,66,35,
+10,14,252,32,54,29,14,37,29,14,251,66,247,177,202,29,252,61,182,10,14,187,
+41,10,14,251,66,247,184,247,163,21,247,68,247,145,5,45,6,251,18,251,82,251,
+18,247,82,5,44,6,247,67,251,149,251,77,251,159,5,234,6,247,25,247,93,247,
+23,251,93,5,236,6,14,251,66,38,10,14,251,66,57,10,14,251,232,247,168,114,
+10,93,6,70,138,97,89,141,58,8,251,58,7,140,50,118,101,81,128,8,70,7,197,128,
+160,101,138,50,8,251,58,7,137,58,181,89,208,138,8,185,204,124,6,89,140,126,
+153,191,26,247,73,7,138,222,111,193,86,160,8,197,160,163,185,229,26,247,73,
+7,191,152,153,189,140,30,154,6,14,252,50,239,114,10,254,65,199,250,65,7,14,
+251,232,168,251,104,21,186,6,209,140,181,189,137,220,8,247,58,7,138,228,160,
+177,195,150,8,208,7,83,150,118,177,140,228,8,247,58,7,141,220,97,189,69,140,
+8,92,74,155,6,189,138,153,125,87,26,251,73,7,140,56,167,85,192,118,86,119,
+111,85,138,56,8,251,73,7,87,126,125,88,138,30,123,6,14,49,248,91,248,47,21,
+86,140,124,117,102,27,124,124,144,151,119,31,251,9,208,5,150,122,120,144,
+121,27,74,101,89,44,134,31,192,6,141,162,141,149,143,149,8,161,149,155,152,
+158,27,149,162,131,133,149,31,237,76,5,123,165,169,129,164,27,204,179,188,
+217,31,155,7,14,251,233,247,14,251,97,21,222,247,230,6,117,247,115,5,100,
+6,117,251,115,5,138,247,179,21,223,243,55,6,14,247,204,248,98,21,200,134,
+179,97,146,72,8,223,6,133,247,6,70,208,251,9,147,8,228,97,49,7,251,27,125,
+56,251,0,251,55,26,251,51,222,35,247,27,127,30,41,181,236,7,247,8,145,214,
+216,146,247,12,8,55,6,127,60,101,98,75,132,8,97,141,21,56,152,91,211,247,
+5,26,247,13,184,210,225,155,30,14,248,2,248,12,21,251,52,6,132,152,134,148,
+135,145,118,178,24,124,166,132,165,167,26,215,195,190,224,226,185,88,36,142,
+30,227,6,138,200,131,178,120,172,8,201,103,68,176,54,27,251,26,35,46,251,
+13,95,146,120,185,63,31,58,84,247,2,6,155,113,147,112,114,26,77,106,89,47,
+60,30,187,73,5,164,178,174,174,29,176,27,191,178,156,178,179,31,97,205,5,
+119,110,111,129,113,27,121,120,143,151,97,31,151,100,123,142,112,27,96,99,
+126,113,100,31,229,230,167,185,191,26,158,134,162,129,168,30,247,28,6,14,
+252,32,247,225,89,29,14,248,131,247,246,21,251,43,6,247,93,247,247,5,54,6,
+251,71,251,214,251,77,247,214,5,54,6,247,97,251,247,5,251,43,88,247,64,62,
+251,64,88,247,64,251,67,227,247,67,247,62,190,251,62,216,247,62,6,14,248,
+103,248,98,21,251,5,6,151,209,5,221,154,171,183,186,27,155,150,135,125,164,
+31,169,218,5,152,109,116,145,113,27,99,96,121,109,107,31,109,110,119,100,
+128,83,117,35,24,251,17,69,247,5,6,61,252,49,5,62,124,109,103,87,27,120,125,
+144,150,122,31,122,55,5,132,152,157,136,163,27,189,190,161,174,173,31,171,
+172,159,186,152,209,214,248,33,24,247,18,6,14,248,100,135,29,147,7,159,7,
+245,69,210,34,36,58,66,47,101,152,110,170,104,30,65,100,108,95,72,26,73,166,
+93,204,94,30,247,62,251,9,5,176,113,156,112,104,26,88,100,104,83,102,111,
+154,168,119,30,126,158,135,159,178,26,54,124,6,110,142,119,147,117,30,68,
+165,204,97,223,27,246,218,210,236,182,126,169,100,184,31,211,166,175,191,
+216,26,211,110,183,60,190,30,251,38,233,5,97,167,124,159,168,26,188,177,175,
+190,198,177,99,77,30,122,7,130,7,251,84,251,187,21,86,178,126,159,179,26,
+179,158,166,191,173,30,247,52,251,1,5,188,106,163,102,98,26,98,113,102,93,
+114,30,14,248,121,247,82,21,85,193,5,159,170,148,171,173,26,172,129,173,123,
+165,30,194,194,82,197,80,86,5,157,113,104,149,102,27,103,107,130,122,110,
+31,84,194,83,86,193,84,5,119,110,127,102,103,26,102,151,101,159,112,30,91,
+90,195,82,190,190,5,123,165,174,130,172,27,179,172,149,159,166,31,192,86,
+5,251,45,247,201,21,199,186,92,80,83,91,92,81,80,91,186,196,197,187,186,197,
+31,14,252,119,187,213,10,251,3,7,166,251,26,5,179,223,29,14,251,233,247,33,
+130,10,247,143,22,141,29,14,237,133,10,247,97,50,140,29,14,251,233,230,133,
+10,14,251,233,247,131,125,29,14,251,66,247,144,47,29,247,76,207,21,56,252,
+160,222,6,249,109,4,56,34,222,6,14,251,66,247,149,47,29,247,65,247,165,21,
+56,253,109,222,6,14,248,197,247,204,21,252,202,67,248,202,6,14,153,29,252,
+233,227,248,233,247,86,6,14,153,29,251,199,251,85,57,247,85,251,100,227,247,
+100,247,86,221,251,86,247,199,247,86,6,14,252,32,146,10,251,29,248,158,114,
+10,251,142,6,251,18,41,34,251,27,65,169,70,191,96,31,174,110,174,127,194,
+136,8,252,72,203,249,222,221,253,222,203,249,222,196,7,14,251,216,247,67,
+248,106,21,70,83,83,70,70,195,83,208,207,196,195,206,210,84,195,69,31,14,
+252,88,204,243,21,35,187,7,141,81,124,112,103,134,8,101,7,199,143,173,186,
+219,26,240,7,14,251,233,186,243,80,10,251,233,188,249,89,80,10,247,144,125,
+29,247,91,228,131,10,14,247,218,247,111,171,29,247,225,171,29,247,225,171,
+29,14,247,218,247,50,249,108,21,57,72,72,56,55,206,72,159,29,89,98,99,90,
+88,99,180,189,189,179,179,189,31,247,226,209,21,252,31,253,138,5,205,6,248,
+31,249,138,5,64,252,95,21,57,72,72,56,55,206,72,222,220,207,207,220,194,10,
+90,98,98,89,90,229,29,247,252,199,21,57,72,71,57,56,206,71,159,29,90,98,98,
+90,89,229,29,14,76,247,167,247,217,21,92,7,138,94,125,117,74,82,8,64,71,114,
+95,72,26,251,9,222,64,247,23,247,37,213,218,247,47,30,54,6,251,0,100,91,49,
+61,88,185,207,185,161,178,192,186,30,225,214,158,168,198,26,194,7,49,234,
+21,229,243,49,6,14,251,233,247,27,249,120,66,10,251,233,247,80,85,10,251,
+233,247,8,249,121,46,10,251,233,247,153,249,97,48,10,251,233,247,194,249,
+81,70,29,251,233,154,249,112,64,29,251,233,247,111,249,96,91,10,251,233,247,
+26,81,29,251,233,247,59,249,134,61,29,14,251,233,247,57,22,97,47,116,10,99,
+5,111,201,163,197,10,174,197,205,29,162,195,5,14,251,233,200,249,120,74,10,
+251,233,247,46,22,78,117,103,98,117,10,115,27,92,114,158,174,181,160,162,
+212,180,31,14,251,233,247,102,248,227,71,10,247,218,175,10,247,218,72,10,
+14,251,196,247,212,247,246,21,251,169,88,247,169,6,152,247,38,21,137,135,
+137,138,135,27,124,131,147,154,31,247,71,7,202,99,170,57,57,94,102,68,137,
+30,198,6,182,146,155,152,184,27,183,162,124,110,31,126,7,137,115,130,133,
+101,136,97,136,98,131,122,132,8,102,123,119,109,98,26,80,179,102,203,178,
+172,153,168,172,30,108,145,155,127,172,27,151,146,140,144,152,31,49,247,4,
+21,103,97,109,90,103,118,156,169,171,159,154,191,146,30,189,147,151,141,153,
+145,8,14,247,65,248,42,21,247,215,46,252,9,7,59,83,5,62,7,219,196,5,251,172,
+248,108,221,252,15,247,139,7,247,63,247,14,5,215,7,14,243,50,10,14,247,218,
+248,254,247,219,21,247,220,221,251,220,247,130,247,228,221,252,65,63,6,199,
+96,81,167,57,27,66,65,110,90,89,31,71,72,105,35,251,28,26,251,16,167,47,198,
+71,30,79,191,213,107,224,27,220,196,168,204,185,31,65,248,70,221,251,233,
+7,46,239,21,58,99,79,100,55,27,73,86,166,190,104,31,103,193,124,203,241,26,
+241,154,204,175,193,30,190,174,192,166,206,27,223,198,100,58,179,31,14,251,
+201,247,206,247,246,21,251,155,88,247,155,6,251,24,248,75,21,48,88,77,251,
+2,251,1,190,77,230,229,191,201,246,247,5,89,200,47,31,87,4,192,170,94,63,
+66,107,94,87,87,107,184,214,213,171,184,191,31,14,247,107,41,29,14,252,32,
+247,70,169,10,14,252,88,247,38,248,57,21,247,200,56,251,244,7,76,89,5,75,
+7,202,189,5,251,205,222,247,249,7,205,190,5,203,7,14,76,52,29,14,247,162,
+249,184,247,51,21,70,116,118,29,225,105,59,191,41,27,57,69,100,72,98,31,209,
+99,72,175,50,27,251,44,54,38,251,71,251,72,224,37,247,44,227,203,173,208,
+181,31,72,179,208,103,224,27,247,11,222,207,247,6,160,31,252,247,247,195,
+21,233,195,63,251,22,251,17,82,62,46,46,82,216,247,20,247,18,196,216,232,
+31,247,130,251,52,21,236,146,197,202,224,27,224,198,74,44,31,14,76,247,163,
+247,241,21,155,6,192,163,136,129,164,31,190,120,167,95,79,26,49,70,78,40,
+30,107,6,130,61,6,136,157,149,138,159,27,247,44,235,231,247,38,195,123,177,
+101,174,31,112,164,112,152,87,155,8,225,167,178,184,210,26,247,2,51,213,251,
+22,72,77,119,104,93,30,99,107,122,99,75,26,252,174,222,248,174,7,208,195,
+183,225,220,196,94,75,74,76,93,50,30,129,6,14,251,233,247,43,90,10,14,49,
+179,248,11,21,69,248,70,251,111,209,247,181,7,14,248,180,188,21,137,129,135,
+139,135,27,110,123,153,166,31,248,72,56,251,189,7,32,83,69,52,74,97,179,202,
+30,248,7,56,253,124,222,247,115,7,121,164,168,131,175,27,207,194,167,194,
+179,31,82,141,166,113,196,27,157,152,141,146,165,31,14,247,218,247,177,249,
+54,21,247,45,194,252,11,84,247,46,252,18,207,6,248,99,22,247,15,247,233,5,
+251,233,206,248,73,48,7,251,23,251,254,251,24,247,254,5,45,252,73,206,247,
+233,6,247,13,251,233,5,14,187,63,10,247,52,247,16,90,10,248,194,247,21,128,
+29,247,56,253,31,69,29,113,100,134,42,25,247,196,6,14,49,248,170,248,52,136,
+29,251,179,220,29,132,247,76,247,81,21,247,121,6,247,11,223,225,247,14,247,
+24,54,219,251,31,31,251,100,247,12,46,253,109,232,6,247,163,4,247,148,247,
+86,7,226,190,91,59,58,88,92,52,31,14,247,52,247,17,90,10,248,218,247,21,128,
+29,158,100,29,49,248,170,247,163,21,252,120,69,248,120,6,251,82,42,198,10,
+248,108,4,35,35,243,6,14,252,50,239,114,10,252,37,199,248,37,7,79,252,176,
+21,252,37,199,248,37,7,14,251,166,247,92,249,66,21,55,71,71,56,56,207,70,
+221,224,207,206,224,222,71,207,56,31,82,4,191,181,97,87,86,97,97,85,89,96,
+182,191,191,181,181,192,31,14,193,222,29,222,156,10,247,66,51,247,4,251,28,
+72,81,110,88,103,31,247,147,56,7,247,121,251,145,127,29,247,52,247,36,59,
+10,248,128,247,74,128,29,128,100,29,251,233,247,206,247,234,69,29,112,100,
+135,42,25,247,196,6,14,202,247,164,247,217,21,247,26,6,184,158,119,91,31,
+138,99,5,111,145,111,148,118,30,218,164,6,121,152,135,151,138,197,138,210,
+132,156,102,163,8,181,169,151,162,185,26,224,93,180,44,30,251,98,252,81,209,
+6,247,140,4,247,26,247,21,7,192,161,119,92,92,116,119,87,31,107,247,246,62,
+10,49,248,180,247,159,21,252,140,69,248,140,6,14,247,111,248,249,21,191,95,
+150,129,174,104,8,149,109,125,142,120,27,99,99,127,116,104,31,71,95,104,56,
+251,9,26,251,71,225,37,247,43,247,44,224,240,247,73,231,118,207,88,217,30,
+101,196,102,177,67,194,229,180,24,99,176,42,94,72,182,126,146,108,152,25,
+95,95,182,115,152,131,165,119,25,54,99,175,100,5,247,43,33,65,29,49,248,74,
+248,63,21,251,39,251,38,251,38,247,37,90,90,247,38,251,38,251,39,251,39,189,
+90,247,38,247,38,247,39,251,39,189,189,251,39,247,39,247,38,247,38,5,14,251,
+233,247,18,59,10,14,202,248,180,248,73,21,245,115,86,188,50,27,251,10,60,
+45,251,33,251,29,218,45,247,7,196,185,162,186,172,31,158,167,149,167,151,
+199,8,68,6,58,126,102,96,83,27,107,103,157,167,118,31,116,168,126,183,190,
+26,244,188,206,215,192,167,112,73,156,30,35,247,197,62,10,132,34,10,173,247,
+202,42,29,132,34,10,91,247,203,46,29,132,34,10,109,247,177,43,10,132,34,10,
+106,247,202,101,29,132,34,10,138,247,216,61,29,14,132,34,10,237,247,179,48,
+10,187,248,15,116,21,247,68,239,237,247,83,161,31,186,10,109,134,10,247,75,
+247,79,227,247,7,247,34,197,83,10,182,109,169,128,215,128,108,70,24,150,132,
+5,145,119,10,122,144,163,93,143,29,88,130,134,139,137,126,31,14,132,39,10,
+247,76,249,237,52,10,132,39,10,247,6,249,238,63,29,132,39,10,247,24,249,212,
+43,10,132,39,10,247,29,249,237,66,10,252,32,121,29,113,86,29,252,32,121,29,
+41,250,64,46,10,252,32,121,29,59,250,31,43,10,252,32,121,29,60,250,63,66,
+10,187,136,10,248,12,252,227,5,245,6,251,71,250,40,21,114,131,127,128,122,
+27,126,113,146,149,115,31,156,97,131,141,119,27,95,108,103,10,243,32,10,169,
+247,172,52,10,243,32,10,93,247,173,46,29,243,32,10,111,247,147,43,10,243,
+32,10,108,247,172,101,29,243,32,10,243,247,149,72,29,132,33,10,251,20,247,
+167,53,10,187,248,187,114,10,140,252,148,5,111,29,234,247,37,30,138,248,148,
+5,251,149,247,102,42,29,187,55,29,251,219,247,103,46,29,187,55,29,251,201,
+247,77,43,10,187,55,29,251,204,247,102,101,29,132,248,22,162,10,251,105,247,
+247,5,251,7,6,247,172,234,10,232,7,118,86,29,132,44,29,64,68,10,76,58,29,
+251,107,247,37,53,10,32,29,54,248,117,52,10,32,29,251,53,248,118,46,29,32,
+29,251,37,248,92,43,10,32,29,251,31,248,117,66,10,32,29,251,6,248,131,61,
+29,14,32,29,125,248,94,21,114,131,127,107,29,153,136,129,163,165,29,251,66,
+247,156,116,21,247,15,222,217,247,17,146,31,55,6,54,151,10,247,24,105,10,
+33,175,54,204,93,31,166,119,162,130,182,131,108,68,24,116,10,98,5,112,204,
+160,146,29,33,29,251,7,248,74,42,29,33,29,251,76,248,75,46,10,33,29,251,58,
+248,49,43,10,53,29,252,32,86,10,123,85,10,252,32,86,10,51,249,121,46,10,252,
+32,86,10,69,249,88,43,10,252,32,86,10,70,249,120,66,10,43,29,247,123,247,
+85,48,29,34,29,164,247,170,42,29,34,29,92,247,171,46,29,34,29,110,247,145,
+43,10,34,29,111,247,170,66,10,34,29,242,247,147,72,29,251,66,35,10,83,247,
+105,71,10,37,29,251,3,85,10,37,29,251,72,249,121,46,10,37,29,251,54,81,29,
+37,29,251,56,249,120,66,10,251,66,38,10,251,99,71,29,251,66,38,10,251,153,
+247,83,43,10,251,66,57,10,251,37,247,33,53,10,251,201,189,248,212,21,251,
+201,198,247,62,7,203,172,180,191,177,163,115,102,30,251,106,198,247,125,7,
+190,97,173,74,94,107,123,103,112,30,182,7,14,247,152,47,29,247,161,207,60,
+10,14,243,55,10,247,62,207,173,10,14,243,55,10,247,64,247,165,21,55,253,109,
+223,6,14,247,52,248,226,89,29,252,130,251,21,142,10,249,49,251,248,56,29,
+14,247,52,248,255,89,29,188,54,10,252,138,247,167,60,29,14,247,52,248,255,
+89,29,187,252,121,21,184,166,153,160,179,26,206,86,185,64,63,87,93,72,99,
+152,118,184,145,10,89,163,30,69,247,46,21,185,168,29,183,31,140,251,69,21,
+192,175,105,89,88,103,106,84,87,104,173,189,189,174,173,193,31,251,246,135,
+29,251,112,6,107,251,123,5,188,6,168,163,160,149,172,27,196,175,100,76,78,
+103,102,82,93,110,162,187,127,31,86,6,146,104,145,123,152,123,8,107,163,182,
+120,187,27,225,199,201,229,224,83,196,57,109,115,131,122,115,31,155,247,10,
+5,247,70,6,14,247,52,248,193,89,29,241,54,10,251,200,135,29,251,176,87,247,
+121,6,38,251,37,98,51,107,251,32,8,195,6,163,247,28,192,247,9,235,247,20,
+8,14,251,233,247,56,213,10,42,87,63,251,35,251,36,191,63,237,235,192,215,
+247,32,247,40,88,214,40,31,86,4,197,168,84,251,2,251,9,111,85,79,82,111,196,
+247,4,247,5,167,193,197,31,14,251,233,247,85,248,20,103,29,251,233,247,186,
+213,10,251,129,6,105,251,127,5,195,6,168,165,160,149,173,27,197,176,101,81,
+81,103,103,80,91,111,161,187,126,31,77,6,146,102,146,122,153,121,8,107,166,
+184,120,191,27,231,204,203,228,223,78,198,52,109,114,132,125,116,31,154,245,
+5,247,79,6,14,251,233,247,201,248,229,21,213,127,92,181,67,27,89,94,117,100,
+112,31,111,98,126,87,62,26,251,30,191,69,241,225,202,200,223,218,80,196,58,
+97,114,129,108,106,30,228,177,196,197,178,164,117,98,148,30,63,44,21,191,
+171,105,86,88,103,102,90,88,102,178,191,189,175,173,192,31,14,251,233,247,
+215,213,10,251,197,81,247,130,6,34,251,33,97,54,105,251,33,8,205,6,163,247,
+27,196,247,8,240,247,18,8,14,251,233,247,137,248,144,21,180,163,155,162,178,
+26,207,82,186,58,58,82,92,71,100,154,116,181,115,30,92,116,114,104,93,26,
+59,201,85,230,230,201,193,218,185,114,175,92,162,30,58,247,40,21,185,168,
+115,100,101,109,115,94,93,110,163,177,177,168,164,185,31,251,67,4,193,175,
+107,92,91,103,108,84,86,103,171,186,186,175,171,193,31,14,251,233,160,248,
+22,21,66,150,187,96,211,27,189,183,161,178,167,31,168,180,151,190,218,26,
+247,30,88,208,37,52,76,78,55,59,197,83,221,181,162,149,171,173,30,46,138,
+104,85,79,27,101,113,161,180,131,31,216,247,162,21,190,176,100,87,90,102,
+104,87,87,107,172,193,190,175,176,188,31,14,200,247,88,105,29,248,3,82,10,
+14,132,34,10,251,43,247,194,64,10,132,248,110,247,111,21,214,251,111,5,175,
+6,68,108,109,107,117,10,114,27,92,115,158,175,180,169,172,205,170,31,106,
+29,14,187,36,29,251,53,248,72,42,29,187,36,29,251,31,247,179,53,10,187,36,
+29,251,25,248,48,91,10,187,78,29,171,249,88,94,29,187,63,10,132,39,10,247,
+101,249,88,53,10,132,39,10,247,106,249,213,91,10,132,247,75,154,10,248,91,
+6,68,109,109,106,91,26,100,180,29,173,144,144,162,31,184,7,132,120,120,210,
+10,174,180,170,174,204,169,31,221,252,66,7,14,243,36,10,252,96,250,59,97,
+10,243,36,10,251,159,250,43,91,10,252,32,247,87,105,29,140,250,39,91,10,76,
+29,132,249,237,42,29,76,29,239,249,27,68,29,187,57,29,251,148,250,63,52,10,
+187,57,29,251,129,249,170,94,29,243,32,10,114,247,172,74,10,187,37,10,111,
+248,179,42,29,187,37,10,132,248,30,94,29,132,33,10,251,38,248,60,42,29,132,
+247,230,115,21,210,142,179,146,180,155,8,220,172,192,218,225,26,229,83,205,
+78,10,227,6,189,136,153,123,173,30,223,99,54,183,251,15,75,29,136,251,16,
+213,44,247,13,113,183,132,24,140,143,138,137,145,31,108,70,150,133,5,144,
+151,147,141,150,120,10,122,145,162,93,113,10,76,104,10,140,249,170,94,29,
+187,39,29,251,172,247,116,61,29,14,187,39,29,251,208,247,102,74,10,76,58,
+29,251,126,247,186,42,29,76,58,29,251,102,247,162,91,10,132,34,10,247,28,
+247,163,70,29,76,104,10,45,79,40,10,187,36,29,251,133,248,73,46,10,247,162,
+40,29,251,113,250,64,63,29,247,162,40,29,251,91,68,10,132,44,29,49,250,64,
+46,29,187,222,248,138,21,252,138,233,247,224,248,10,251,224,232,248,138,214,
+209,64,247,49,46,251,49,252,11,247,49,46,251,49,64,69,7,247,60,22,248,11,
+51,252,11,6,14,132,39,10,247,191,249,198,70,29,243,36,10,252,7,250,68,63,
+29,187,125,10,247,39,248,244,46,10,252,32,121,10,219,250,24,21,251,146,69,
+247,146,6,14,252,32,247,86,114,10,45,253,109,182,6,82,98,119,108,95,26,86,
+183,104,204,157,216,29,126,136,125,27,108,119,160,170,175,158,177,176,172,
+31,14,251,66,79,29,32,247,103,46,29,132,87,29,247,19,79,40,10,76,29,223,251,
+34,40,10,187,57,29,251,240,79,40,10,243,32,10,247,30,247,133,70,29,187,37,
+10,47,252,92,40,10,132,33,10,251,117,248,61,46,10,243,36,10,252,8,83,40,10,
+187,39,29,251,35,247,63,70,29,187,248,238,251,42,21,132,121,119,210,10,174,
+169,160,173,183,181,31,223,216,165,190,142,228,8,248,148,46,116,29,251,41,
+246,48,247,66,175,160,142,149,183,30,87,107,118,110,98,26,101,180,29,172,
+144,144,163,31,14,132,39,10,150,249,229,97,10,252,32,247,80,105,29,251,92,
+250,55,97,29,251,122,247,63,164,10,247,1,39,91,29,252,88,247,35,22,248,242,
+7,174,158,157,177,30,169,138,5,144,10,7,14,32,29,251,156,248,109,102,29,133,
+31,14,248,172,157,10,233,71,188,251,21,63,77,117,100,103,30,116,218,29,145,
+177,168,217,27,215,180,111,89,31,117,7,103,120,126,72,130,30,251,11,124,121,
+135,108,126,8,77,219,29,206,192,162,193,197,30,143,95,160,113,177,132,8,90,
+112,120,114,101,26,102,162,110,179,126,30,131,161,171,134,159,27,156,167,
+143,145,165,31,184,7,132,121,118,210,10,175,178,167,172,187,158,31,251,39,
+102,10,14,251,66,38,29,51,248,28,52,10,251,66,38,29,65,247,135,53,10,251,
+66,38,29,70,248,4,91,10,108,66,29,247,175,247,160,68,29,248,130,249,33,21,
+215,56,63,251,42,86,247,42,251,31,7,193,95,90,163,71,27,251,27,50,251,1,251,
+58,251,65,229,251,6,247,28,206,192,165,195,187,31,80,213,248,236,202,192,
+7,251,184,251,88,21,228,196,61,251,15,251,11,81,61,51,47,79,218,247,12,247,
+12,199,218,231,31,14,33,29,50,247,181,71,10,33,29,53,248,50,91,10,248,149,
+247,126,21,140,219,132,188,124,177,8,225,106,58,227,10,251,66,251,65,229,
+35,247,41,163,153,141,145,169,31,113,119,132,133,132,132,8,122,120,128,113,
+116,26,85,194,105,223,162,158,142,145,166,30,184,7,132,120,119,136,114,27,
+94,112,158,171,177,156,168,193,196,31,185,185,163,182,150,194,8,55,6,70,116,
+91,102,72,27,87,94,164,182,110,31,120,170,131,169,138,191,8,142,207,21,236,
+145,198,202,223,27,224,199,73,45,31,14,247,11,249,112,21,141,159,10,146,31,
+81,171,10,247,118,251,100,35,29,247,209,249,95,233,29,226,51,35,29,252,88,
+120,29,146,86,29,252,11,120,29,192,249,109,68,29,43,29,247,55,71,29,43,29,
+247,71,206,71,10,34,29,106,247,170,21,42,152,29,201,22,42,152,29,14,251,233,
+49,10,211,71,29,251,66,35,10,64,247,254,42,29,251,66,35,10,251,40,247,255,
+63,29,251,66,35,10,251,45,252,74,40,10,251,249,54,29,106,247,237,40,10,37,
+29,251,25,249,134,61,29,14,37,29,251,56,249,120,74,10,251,66,57,10,251,56,
+247,182,52,10,251,66,57,10,251,32,247,158,91,10,247,45,249,33,21,215,56,63,
+79,86,199,252,236,222,247,181,7,246,195,209,226,166,224,10,115,101,154,29,
+247,40,247,99,192,7,14,252,32,54,29,251,35,252,152,40,10,187,41,10,251,43,
+249,121,63,29,187,41,10,251,31,81,29,32,29,161,248,78,70,29,251,66,38,10,
+251,167,247,109,46,29,251,66,38,29,251,59,248,29,46,29,33,29,138,248,35,70,
+29,247,117,249,121,148,29,224,251,109,35,29,252,32,86,10,251,81,249,112,64,
+29,252,32,247,72,135,29,56,252,160,222,6,221,249,81,21,251,139,69,247,139,
+6,14,252,88,209,248,160,108,29,46,247,109,46,10,251,66,93,10,215,251,254,
+40,10,252,88,120,29,50,79,40,10,43,29,221,252,220,40,10,34,29,247,29,247,
+131,70,29,251,233,49,10,58,252,220,40,10,37,29,251,171,249,112,96,10,37,29,
+143,249,81,70,29,248,118,135,29,56,251,189,6,117,29,161,7,73,105,109,105,
+96,26,82,192,103,222,151,146,140,144,159,30,141,140,144,140,145,140,8,184,
+7,131,118,127,137,123,27,99,113,159,171,178,169,182,185,165,31,14,251,233,
+49,10,232,206,71,10,251,66,247,136,115,21,199,143,169,145,166,151,8,200,166,
+176,194,202,26,217,95,182,35,164,30,143,10,227,6,242,138,71,197,84,29,141,
+251,0,196,81,247,4,128,108,68,24,150,133,5,144,119,10,122,145,162,93,143,
+29,89,130,197,29,247,207,248,228,21,239,84,7,137,194,157,168,176,140,141,
+140,24,177,7,79,141,100,92,138,63,8,36,7,247,81,71,35,29,218,247,205,21,84,
+6,117,80,5,222,6,151,71,159,82,169,91,8,75,178,213,100,224,27,199,195,154,
+170,189,31,232,7,91,57,104,126,90,27,52,82,206,247,23,114,31,247,106,6,163,
+198,5,251,138,6,138,150,139,147,150,26,152,140,149,140,152,30,247,162,6,162,
+198,5,251,176,6,247,25,167,191,201,225,27,192,180,122,85,212,31,171,219,5,
+186,73,82,159,70,27,53,74,106,71,92,31,105,89,117,83,129,75,8,76,6,117,80,
+5,218,6,137,120,139,129,126,26,14,248,56,249,13,247,201,21,85,224,81,54,95,
+99,183,251,126,6,108,163,121,181,153,150,140,143,160,30,181,7,136,128,133,
+138,129,27,116,135,143,163,31,247,104,193,7,247,250,93,21,200,138,95,173,
+62,27,62,88,101,82,91,166,117,219,121,31,187,127,5,172,132,152,126,116,26,
+109,111,120,95,90,119,155,184,132,30,78,6,68,142,182,104,226,27,222,193,178,
+198,185,111,165,72,154,31,90,150,5,98,148,123,152,161,26,169,163,156,181,
+179,159,123,105,140,30,253,102,225,21,195,6,197,183,179,29,59,216,251,36,
+30,251,21,253,109,232,209,10,161,7,227,192,91,59,59,86,91,51,31,14,248,2,
+247,213,21,194,251,52,7,134,149,135,145,132,151,8,103,202,132,158,177,26,
+215,195,190,224,226,184,88,36,143,30,227,6,138,200,131,178,119,172,8,201,
+104,68,176,55,27,251,27,35,46,251,13,97,147,116,177,76,31,146,128,5,58,84,
+247,2,6,146,127,143,130,145,123,8,251,18,84,247,24,6,131,80,104,89,57,72,
+188,73,24,163,177,175,174,29,175,27,192,178,156,179,179,31,97,205,5,118,109,
+112,129,112,27,121,122,143,151,96,31,151,100,122,142,112,27,97,99,126,113,
+100,31,214,214,171,185,148,186,8,247,16,194,251,18,6,136,152,136,149,134,
+153,8,14,247,27,247,224,21,247,40,221,251,40,193,29,247,56,99,29,14,252,32,
+146,10,252,32,146,10,251,233,175,29,247,218,175,10,247,103,248,3,248,224,
+21,136,177,131,163,124,159,8,175,114,93,160,87,27,36,73,58,251,17,251,14,
+204,62,241,230,197,194,232,145,31,68,6,84,130,111,111,94,27,79,104,189,223,
+228,174,191,198,183,168,112,92,145,31,247,253,251,90,21,32,75,63,251,19,251,
+20,202,64,247,0,246,203,214,247,17,247,23,77,214,251,1,31,74,4,200,175,87,
+51,55,102,87,79,79,102,191,225,225,176,191,199,31,73,248,20,21,252,20,253,
+89,5,205,6,248,20,249,89,5,14,252,88,247,50,114,10,46,38,6,59,172,92,199,
+135,30,177,7,104,144,125,166,140,197,8,187,6,14,252,32,247,225,89,29,14,251,
+233,247,194,249,81,70,29,32,29,251,2,248,131,61,29,97,247,83,52,10,80,29,
+52,247,103,46,10,33,29,251,179,248,66,64,29,252,88,247,42,135,29,56,252,160,
+171,6,83,94,121,110,97,26,87,183,103,202,156,216,29,127,136,126,27,109,119,
+161,173,171,162,183,169,166,31,185,29,14,251,232,247,50,114,10,56,253,109,
+222,6,206,248,44,21,34,241,244,7,14,34,29,251,43,247,162,96,10,76,52,29,44,
+247,236,42,29,252,32,86,10,195,249,97,48,10,37,29,105,249,97,48,29,76,29,
+247,60,247,218,21,34,241,244,7,14,243,32,10,251,43,247,164,64,10,132,33,10,
+251,109,252,211,40,10,76,247,239,22,146,249,27,206,10,187,6,97,47,75,10,252,
+32,247,57,117,21,138,147,144,139,148,27,160,157,141,144,167,31,158,29,207,
+191,10,7,105,154,113,169,126,30,103,60,75,10,187,39,29,252,71,247,94,64,10,
+132,34,10,137,247,216,61,29,83,247,58,42,29,243,50,10,247,78,249,186,52,10,
+247,218,72,10,247,36,247,184,52,10,188,248,46,251,188,21,137,165,150,138,
+154,27,194,181,152,164,169,31,172,169,151,175,216,26,249,29,7,208,120,188,
+100,174,30,175,98,79,160,77,27,42,73,100,37,66,31,247,12,56,253,100,232,248,
+52,7,219,156,195,177,182,30,181,176,189,161,198,27,190,185,122,110,163,31,
+161,114,149,103,87,26,252,227,7,72,138,128,129,125,30,118,126,114,130,98,
+27,127,128,139,141,121,31,14,76,247,153,248,39,21,252,39,232,248,39,247,52,
+206,251,52,247,69,228,10,251,69,251,52,72,7,14,247,209,251,107,21,137,157,
+147,138,154,27,181,169,148,160,162,31,167,162,145,162,215,26,248,85,7,188,
+129,171,115,164,30,171,110,93,157,86,27,63,94,113,62,83,31,227,62,252,160,
+223,247,181,7,247,1,195,207,229,202,179,99,77,30,252,43,7,78,138,131,132,
+128,30,125,131,121,132,111,27,131,134,139,140,127,31,14,252,32,247,146,193,
+21,189,10,247,115,215,192,63,222,207,29,210,56,78,86,200,251,152,7,206,29,
+14,251,66,245,247,71,21,222,221,247,72,251,153,5,216,6,251,102,247,194,247,
+100,247,100,5,55,6,251,146,251,150,5,247,150,74,252,146,204,7,14,69,247,10,
+96,29,251,77,247,132,68,29,187,39,29,251,81,247,79,48,29,247,107,41,29,251,
+181,248,74,42,29,252,32,121,10,178,250,40,48,10,247,162,40,29,251,74,250,
+63,66,10,247,162,40,29,47,86,29,187,41,10,251,22,249,120,101,29,187,41,10,
+48,85,10,132,44,29,54,250,63,66,10,251,66,38,10,251,158,247,108,66,10,251,
+66,14,252,32,14,247,239,248,147,95,29,90,4,247,67,247,33,251,33,251,67,251,
+68,251,33,251,32,251,69,251,67,251,31,247,34,247,71,247,62,247,35,247,33,
+247,65,31,251,1,251,55,147,29,251,20,251,0,21,146,54,150,98,169,94,8,76,181,
+203,107,222,27,216,199,166,193,181,31,175,186,154,184,146,232,128,89,128,
+117,113,109,8,84,91,79,113,58,27,58,79,165,194,91,31,113,169,128,161,128,
+189,8,247,238,247,0,147,29,14,248,14,248,163,95,29,251,1,251,99,148,10,251,
+20,251,5,21,150,89,150,117,165,109,8,84,187,199,113,220,27,220,199,165,194,
+187,31,165,169,150,161,150,189,132,54,128,98,109,94,8,76,97,75,107,56,27,
+62,79,166,193,97,31,103,186,124,184,132,232,8,247,238,247,5,148,10,14,59,
+247,188,111,21,159,229,199,242,247,8,247,37,8,235,247,14,171,206,218,26,222,
+69,207,55,91,95,118,101,106,30,117,114,129,117,126,93,127,175,131,157,127,
+157,8,189,106,88,168,84,27,54,73,71,50,72,160,94,223,251,6,31,247,43,251,
+94,179,71,165,36,8,14,251,56,144,247,241,21,240,251,17,247,16,251,69,177,
+64,199,247,0,247,5,247,52,244,247,17,59,230,251,57,247,125,106,207,83,36,
+65,34,251,38,251,76,8,14,121,248,215,22,159,7,36,159,110,153,93,187,92,191,
+122,192,138,235,160,102,147,126,151,125,8,93,178,201,108,192,27,230,210,213,
+233,229,74,211,58,110,132,137,110,80,31,167,180,150,170,176,26,227,66,210,
+48,46,68,69,49,103,146,120,173,86,30,163,91,118,145,108,27,64,73,63,52,46,
+212,66,231,220,207,189,230,184,31,140,123,139,128,134,26,67,101,58,85,95,
+30,107,114,116,130,44,119,8,119,7,14,251,35,199,22,248,119,162,6,251,53,147,
+63,224,142,247,62,8,56,183,185,106,212,27,209,197,201,213,207,113,180,32,
+236,31,251,1,240,120,166,100,247,9,123,47,80,53,33,53,8,59,72,104,83,75,26,
+64,200,77,212,181,180,156,169,171,30,158,157,150,154,156,176,145,251,59,52,
+44,251,51,138,8,14,215,248,20,248,130,21,159,100,115,146,105,27,40,54,54,
+39,43,224,57,239,237,223,225,240,185,121,181,104,174,31,247,42,247,42,144,
+114,159,90,154,109,25,119,150,144,133,149,27,146,144,145,146,144,138,143,
+137,150,31,132,171,137,161,168,26,177,142,169,146,164,30,144,156,139,140,
+143,26,145,135,143,133,135,130,137,136,130,30,131,113,121,137,92,27,111,115,
+142,145,110,31,141,128,136,140,134,27,131,133,134,131,126,166,121,178,124,
+31,180,124,145,137,152,136,8,251,140,251,65,21,211,199,78,66,65,79,79,65,
+65,79,199,214,213,199,198,215,31,14,215,247,244,247,152,21,251,55,96,247,
+55,251,58,187,247,58,247,53,182,251,53,243,6,228,152,207,218,230,26,238,55,
+222,40,41,56,52,38,52,207,62,230,126,30,166,247,203,21,208,197,80,69,67,81,
+81,68,66,82,197,212,210,197,196,213,31,14,251,66,247,127,247,83,21,146,123,
+117,144,120,27,72,79,82,74,100,167,115,184,232,205,211,240,31,247,212,7,200,
+130,189,57,48,26,84,130,96,114,80,30,168,6,178,187,160,198,203,26,221,108,
+217,75,215,30,83,206,138,140,133,146,131,150,25,203,91,7,14,247,135,247,148,
+248,163,21,107,98,122,99,133,88,8,251,16,79,247,16,6,144,91,159,90,168,103,
+52,52,24,181,98,226,226,181,107,183,121,185,134,25,251,15,198,247,15,7,186,
+144,186,158,179,170,226,52,24,180,180,52,226,169,177,158,184,145,189,25,247,
+15,199,251,15,6,133,188,120,185,109,176,226,226,24,98,180,52,52,102,169,92,
+158,89,145,25,247,15,80,251,14,7,91,133,94,120,100,108,52,226,24,97,98,5,
+247,185,80,21,240,223,54,38,36,55,55,36,35,57,222,244,242,222,221,244,31,
+14,69,131,22,249,0,249,0,253,0,6,247,201,251,74,21,209,198,81,71,70,76,78,
+68,74,82,197,205,210,198,200,207,31,14,69,247,194,249,24,21,251,42,251,21,
+251,19,251,40,251,47,247,17,251,20,247,44,247,46,247,19,247,18,247,45,247,
+45,251,19,247,18,251,44,31,90,4,247,19,242,36,251,19,251,19,36,36,251,21,
+251,18,37,243,247,22,247,15,244,242,247,17,31,14,69,247,194,249,24,21,247,
+44,247,19,251,19,251,44,251,45,251,19,251,18,251,46,251,44,251,17,247,20,
+247,47,247,40,247,21,247,19,247,42,31,248,0,253,24,21,249,109,253,109,253,
+109,7,248,1,248,231,21,251,17,34,35,251,14,251,22,241,35,247,18,247,21,242,
+241,247,20,247,19,36,242,251,19,31,14,247,218,247,28,22,249,109,248,1,253,
+109,6,14,69,76,198,29,249,109,249,109,7,14,69,182,22,248,155,248,155,252,
+155,6,248,103,252,103,21,252,51,248,51,248,51,6,14,247,208,249,175,206,21,
+251,192,248,197,251,192,252,197,5,14,247,218,224,247,173,21,249,42,6,115,
+110,101,64,121,26,130,147,132,149,147,142,142,156,154,30,179,186,183,173,
+212,180,8,159,150,146,145,146,26,147,135,144,131,144,30,38,198,112,161,88,
+199,8,148,131,135,141,132,27,129,131,132,130,133,151,106,147,123,31,150,116,
+151,121,158,113,8,253,42,6,14,247,218,250,37,247,173,21,199,253,42,7,156,
+162,149,155,150,159,8,149,158,153,175,147,26,148,131,146,129,132,135,137,
+130,131,30,89,79,115,120,42,81,8,121,129,137,136,130,26,132,146,133,159,128,
+30,212,98,183,105,179,92,8,122,154,142,136,147,27,149,147,146,148,157,101,
+214,115,168,31,14,247,218,249,93,247,172,21,106,94,110,83,120,26,129,147,
+132,149,146,143,141,148,147,30,188,198,166,160,234,196,8,156,148,141,142,
+149,26,146,133,144,118,151,30,66,181,95,173,100,185,8,156,125,135,142,131,
+27,129,131,132,130,121,176,64,164,109,31,252,63,6,166,172,175,211,158,26,
+147,131,146,129,131,136,136,122,124,30,99,92,97,106,65,97,8,119,128,132,133,
+132,26,131,143,134,147,134,30,233,84,170,115,183,88,8,118,157,140,138,148,
+27,149,147,146,148,145,127,171,131,155,31,128,160,128,157,118,167,8,14,251,
+66,247,102,32,21,199,249,42,6,162,122,155,129,159,128,8,129,158,175,125,147,
+27,148,146,147,149,146,137,143,130,147,31,79,189,120,163,81,236,8,157,129,
+136,141,130,27,132,133,132,119,128,31,98,66,105,95,92,99,8,122,124,136,136,
+131,26,129,146,131,148,157,213,177,163,169,30,14,251,66,247,102,249,101,21,
+253,42,7,163,110,64,177,121,27,130,132,131,129,131,142,136,156,124,31,186,
+99,173,95,180,66,8,119,150,145,132,146,27,147,144,143,147,144,31,198,240,
+161,167,199,189,8,148,147,141,143,146,26,149,132,147,130,133,106,127,131,
+123,30,116,128,121,127,113,120,8,249,42,7,14,251,66,247,110,247,21,44,10,
+251,66,247,12,71,21,96,247,156,182,7,251,58,247,156,44,10,251,95,247,153,
+249,124,21,77,6,251,84,252,8,247,84,252,8,5,201,6,247,84,248,8,5,251,114,
+251,204,21,251,53,247,204,247,53,247,204,247,52,251,204,5,14,247,208,247,
+87,248,236,21,247,192,252,197,247,192,248,197,5,14,69,247,199,248,155,21,
+251,39,251,9,251,6,251,35,251,38,247,7,251,8,247,37,247,35,247,8,247,8,247,
+36,247,33,251,8,247,10,251,31,31,14,247,218,250,8,248,158,21,75,251,72,252,
+195,6,247,102,220,116,192,251,178,251,19,5,62,7,247,178,251,20,162,191,251,
+102,221,5,249,3,6,14,251,233,197,247,130,21,247,66,251,232,5,123,147,149,
+132,151,27,147,144,143,146,146,137,147,136,147,31,251,23,247,221,247,23,247,
+221,5,142,147,141,147,146,26,147,134,143,131,127,131,133,121,129,30,14,251,
+233,247,167,247,130,21,251,66,247,232,5,156,130,130,146,127,27,131,134,135,
+131,133,141,131,142,130,31,247,23,251,221,251,23,251,221,5,136,132,137,131,
+132,26,131,144,135,147,151,147,145,156,149,30,14,58,248,39,248,28,21,251,
+105,6,65,247,77,5,45,6,247,125,252,213,5,222,6,247,125,248,213,5,45,6,34,
+251,157,21,63,251,72,64,247,72,5,14,251,66,247,191,247,184,21,251,148,247,
+217,5,129,117,134,119,118,26,120,146,123,159,114,30,209,52,83,34,5,121,106,
+129,110,120,26,119,148,116,159,104,30,165,96,139,139,128,26,121,126,129,117,
+30,121,78,221,6,227,161,154,198,179,130,158,84,213,31,105,185,127,166,169,
+26,158,143,151,158,174,30,247,191,252,12,5,149,160,144,157,159,26,160,131,
+157,114,171,30,100,188,5,102,186,129,160,172,26,157,142,153,151,171,30,183,
+245,5,161,6,161,149,129,114,143,31,148,170,143,165,168,26,190,122,159,95,
+30,71,6,101,125,150,171,31,155,7,110,108,125,106,100,26,112,147,114,153,127,
+30,128,149,153,136,170,27,179,6,14,251,142,190,22,247,217,248,213,251,217,
+55,247,133,251,54,251,133,55,247,133,251,55,251,133,6,14,184,248,227,248,
+236,21,109,135,110,131,117,30,113,130,127,129,118,27,121,132,150,203,111,
+31,118,189,122,167,117,158,8,167,106,96,154,90,27,251,16,36,42,251,9,81,160,
+93,182,101,31,176,107,170,125,200,130,144,176,24,89,149,114,149,113,160,8,
+106,166,118,184,183,26,222,209,210,219,194,172,109,50,183,30,74,171,171,114,
+190,27,213,180,197,243,31,151,7,163,251,230,21,133,169,134,155,131,157,8,
+184,118,105,163,93,27,66,74,78,70,115,146,108,151,112,31,182,43,139,139,140,
+113,8,102,141,104,108,95,27,100,111,156,183,107,31,94,202,139,139,134,144,
+124,157,116,156,116,150,8,152,112,108,146,109,27,130,6,138,104,174,127,154,
+129,157,111,25,196,48,139,139,165,111,8,103,174,178,120,180,27,186,201,162,
+173,184,31,181,172,160,172,175,26,163,138,142,101,224,30,116,190,132,162,
+160,26,168,161,161,168,179,162,112,74,155,30,14,243,247,8,151,21,155,149,
+147,146,150,27,149,148,136,134,146,31,108,186,139,139,166,27,178,180,168,
+188,172,31,168,183,154,197,208,26,196,7,140,146,145,139,142,27,161,152,136,
+132,149,31,152,131,142,131,151,91,181,251,60,24,95,150,154,116,158,27,172,
+182,169,188,178,31,126,153,5,135,128,134,137,133,27,118,128,152,177,130,31,
+110,247,3,123,196,126,160,110,157,25,233,172,179,176,192,26,219,75,200,55,
+83,94,118,94,96,30,181,112,93,164,88,27,41,61,56,34,78,157,110,198,106,31,
+178,117,157,118,114,26,133,138,131,137,129,30,150,136,5,172,178,151,163,165,
+26,161,125,156,108,155,30,84,167,139,139,131,146,8,118,156,128,161,165,26,
+193,179,180,191,200,176,86,50,30,129,7,129,7,251,40,7,83,136,114,129,110,
+30,119,132,125,122,130,27,133,133,142,144,131,31,156,115,126,145,119,27,98,
+112,110,74,117,31,247,195,247,251,21,222,137,151,127,182,30,160,168,157,145,
+170,27,194,178,103,89,106,120,108,109,123,31,110,124,121,133,77,124,8,14,
+206,208,249,10,21,247,149,253,10,5,227,6,247,151,249,10,5,251,195,252,164,
+21,251,74,248,91,5,248,1,6,14,77,143,22,248,240,6,251,151,249,10,5,51,6,183,
+37,21,247,75,252,91,5,252,1,6,14,187,247,253,210,21,68,221,5,248,131,97,252,
+82,7,87,199,5,82,6,247,114,251,154,247,114,247,154,5,82,6,87,79,5,248,82,
+97,252,131,7,14,187,247,253,248,213,21,210,57,5,252,131,181,248,82,7,191,
+79,5,196,6,251,114,247,154,251,114,251,154,5,196,6,191,199,5,252,82,181,248,
+131,7,14,251,17,247,49,247,3,21,79,32,190,110,215,247,28,5,247,184,209,251,
+145,6,196,241,5,247,88,209,251,49,6,198,244,89,167,63,251,25,5,251,152,69,
+247,113,6,82,37,5,251,56,69,6,14,48,248,170,247,159,164,29,248,50,220,29,
+251,113,248,68,250,37,21,251,20,253,168,251,85,248,32,251,40,66,157,106,233,
+185,247,133,252,133,247,44,250,68,5,14,252,36,247,80,248,159,21,76,10,251,
+120,7,95,143,78,149,34,178,10,137,140,150,128,30,149,129,128,144,125,27,113,
+117,117,112,108,167,115,174,183,225,10,212,247,65,26,14,69,247,231,222,29,
+249,121,7,76,10,253,112,7,14,69,247,157,250,37,21,253,121,7,102,145,60,148,
+46,178,10,136,140,150,129,30,149,129,127,144,126,27,112,118,117,111,109,167,
+115,174,182,225,10,208,247,69,26,249,112,7,14,251,17,248,115,248,24,65,10,
+101,251,16,65,10,14,251,17,201,29,252,125,248,10,119,29,251,17,201,29,248,
+79,4,122,10,49,248,180,248,11,21,252,140,251,181,209,247,111,248,70,6,14,
+184,248,235,248,247,21,69,251,164,6,251,5,134,95,123,107,30,86,112,80,103,
+76,27,84,84,167,183,110,31,115,176,132,183,247,17,26,247,164,69,251,161,7,
+251,41,144,101,166,95,30,69,181,215,98,229,27,222,209,172,201,184,31,175,
+188,145,175,247,54,26,14,184,248,235,22,247,161,7,247,41,134,177,113,183,
+30,209,97,62,180,49,27,56,70,106,77,94,31,102,90,133,103,251,54,26,251,161,
+209,247,164,7,247,5,145,186,157,173,30,189,166,197,173,200,27,196,194,110,
+93,168,31,162,103,145,98,251,18,26,251,164,7,14,247,218,249,147,247,108,21,
+200,252,98,7,223,10,163,29,66,44,26,251,8,184,56,194,29,201,251,183,6,251,
+1,137,83,189,133,245,8,14,247,218,248,106,248,234,21,252,173,251,161,78,248,
+234,200,251,160,248,173,7,14,178,247,248,247,189,21,91,182,135,142,119,154,
+8,167,102,93,157,103,27,62,76,76,62,62,202,76,216,176,184,156,168,176,31,
+159,153,143,143,187,182,188,96,144,135,158,125,8,111,176,184,121,176,27,216,
+202,202,216,216,76,202,62,103,92,121,111,103,31,119,125,135,135,90,96,8,175,
+106,21,195,196,195,171,181,27,188,179,99,91,90,99,99,90,97,83,171,196,82,
+31,68,22,83,82,83,107,97,27,90,99,179,187,187,179,179,188,181,195,108,82,
+196,31,14,247,218,249,62,247,59,21,90,140,109,156,86,197,8,192,185,176,161,
+182,27,145,200,127,6,79,81,103,73,89,31,207,85,81,173,80,27,61,83,82,58,59,
+192,84,217,191,192,164,184,179,31,147,147,144,144,155,158,195,70,203,102,
+199,142,8,251,121,247,30,21,135,134,139,139,133,133,8,92,93,106,121,98,27,
+99,112,169,185,185,167,168,184,173,162,127,94,187,31,149,130,139,139,148,
+130,8,14,247,218,249,120,247,165,21,252,117,88,248,117,6,64,4,252,117,89,
+248,117,6,96,247,230,21,92,97,121,128,103,27,122,127,142,158,77,31,160,69,
+121,143,113,27,86,96,114,87,103,31,179,108,5,187,181,152,148,174,27,159,139,
+139,115,222,31,116,212,141,139,168,27,199,182,165,191,168,31,14,247,218,249,
+121,247,20,21,103,110,109,103,103,169,110,175,174,169,169,174,176,110,168,
+102,31,252,125,22,103,207,10,174,176,110,168,102,31,247,138,248,133,21,102,
+207,10,175,175,110,168,103,31,14,247,214,247,112,251,48,21,62,54,247,143,
+6,138,224,5,64,249,171,247,254,253,171,69,6,140,54,5,247,132,224,66,249,171,
+240,224,253,143,54,243,6,14,247,214,249,99,249,126,21,252,128,69,6,247,97,
+251,245,251,97,252,22,5,68,248,135,247,107,67,7,136,251,35,5,251,227,6,247,
+96,248,22,251,95,247,241,5,247,219,6,143,251,34,5,210,6,14,251,243,247,22,
+247,184,21,202,205,178,186,165,184,8,180,208,164,216,196,26,191,113,173,100,
+53,73,251,34,251,210,79,30,111,108,119,119,126,128,8,122,123,133,132,132,
+26,132,146,130,145,146,169,163,165,165,30,127,47,137,113,108,26,83,166,105,
+185,174,168,160,183,164,30,152,160,146,159,151,26,146,133,145,132,131,133,
+134,125,132,30,94,118,124,123,119,27,125,132,148,158,165,158,247,17,154,219,
+31,149,194,21,247,159,184,167,224,184,27,156,150,122,113,109,129,90,124,98,
+31,114,72,104,84,78,72,8,14,251,90,241,249,50,21,172,213,139,139,177,27,186,
+178,121,105,163,31,173,92,160,64,66,26,109,137,115,130,80,30,192,70,112,151,
+85,27,90,100,123,105,105,31,93,92,111,72,74,26,251,1,222,54,246,215,200,180,
+216,182,30,177,207,167,247,22,243,26,247,92,251,3,247,37,251,45,94,92,129,
+121,99,30,247,191,252,54,21,126,51,131,106,124,95,8,61,112,94,95,84,27,83,
+106,190,226,247,8,205,235,220,181,176,117,98,165,31,14,247,218,248,139,249,
+75,21,251,92,110,29,251,85,31,135,251,208,21,251,82,247,80,5,184,194,204,
+162,209,27,208,203,116,96,196,31,179,99,21,187,82,162,76,66,26,67,116,75,
+93,83,30,251,84,247,87,5,247,44,251,127,21,95,84,72,115,69,27,69,75,162,186,
+80,31,247,85,247,85,5,251,125,251,45,21,95,193,116,203,209,26,211,162,203,
+186,196,30,247,82,251,80,5,14,113,247,186,248,38,21,251,14,67,76,60,58,26,
+113,146,111,155,97,30,88,64,124,106,98,26,85,176,99,188,193,182,192,206,179,
+124,186,98,224,30,178,188,178,178,195,185,8,192,201,176,158,175,27,173,161,
+109,95,85,115,62,105,89,31,100,114,101,115,106,27,108,111,160,162,152,146,
+146,153,140,31,161,141,154,154,158,26,155,127,151,122,110,115,108,101,93,
+175,107,190,189,196,172,194,186,30,180,186,161,195,194,26,208,99,185,81,60,
+72,92,251,56,251,49,30,130,158,136,157,161,26,214,178,193,233,194,30,251,
+56,251,224,21,180,64,156,95,106,26,108,118,117,109,102,112,170,182,178,146,
+155,189,215,30,14,247,218,248,61,141,21,137,161,145,139,173,27,247,172,201,
+251,183,6,123,6,247,109,248,6,5,229,201,86,6,167,187,97,164,96,66,5,251,62,
+172,29,251,16,190,53,229,110,30,111,90,180,113,5,247,126,248,131,21,251,105,
+251,255,5,68,158,105,197,240,26,247,21,191,195,247,13,30,14,247,218,249,23,
+248,53,21,252,68,252,53,5,248,214,181,252,105,6,247,244,247,234,5,14,247,
+218,247,125,201,153,10,247,3,118,10,84,251,13,31,14,247,218,249,147,201,21,
+251,183,6,251,13,87,194,126,29,67,43,26,251,7,184,55,194,29,6,14,247,218,
+247,125,247,58,153,10,247,4,118,10,83,251,13,31,247,135,251,3,21,231,29,247,
+218,249,147,247,58,21,251,183,6,251,13,87,195,126,29,66,43,26,42,167,72,198,
+93,30,107,179,176,130,229,27,247,172,6,90,4,231,29,247,218,248,164,247,108,
+21,247,131,200,251,96,6,227,247,47,5,247,8,201,58,6,172,198,97,163,92,56,
+5,251,35,172,29,251,8,184,55,220,105,30,106,82,182,116,177,206,5,136,165,
+151,138,181,27,247,172,201,251,183,6,119,133,139,140,130,31,170,247,45,21,
+58,251,33,87,157,108,190,136,211,25,247,182,247,108,21,51,251,47,5,251,94,
+6,223,10,14,187,218,247,187,21,221,210,5,248,188,181,252,139,6,144,29,248,
+139,181,252,188,6,14,187,249,23,247,187,21,57,68,5,252,188,97,248,139,138,
+29,252,139,97,248,188,6,14,187,247,95,248,44,21,144,29,247,206,138,29,251,
+255,97,21,248,48,6,221,68,57,68,5,252,48,6,57,210,5,14,251,14,248,212,251,
+71,21,252,236,89,248,236,6,247,42,4,252,236,89,248,236,6,14,251,233,248,102,
+250,29,220,10,247,218,234,185,21,179,91,247,12,239,5,67,206,228,100,235,27,
+247,83,247,47,247,50,247,86,214,117,209,98,199,31,247,3,232,99,187,251,4,
+46,5,210,64,66,169,45,27,251,83,251,47,251,50,251,86,68,157,78,177,77,31,
+187,180,21,111,189,127,186,194,26,247,55,247,19,247,24,247,47,215,198,114,
+82,200,30,178,91,21,170,89,155,83,79,26,251,54,251,19,251,24,251,47,60,66,
+172,198,86,30,14,251,66,247,87,124,29,247,141,124,29,14,251,212,188,247,23,
+21,247,148,247,148,251,148,6,14,251,212,188,247,23,21,247,148,247,149,251,
+148,6,247,96,251,97,21,251,44,247,45,247,44,6,14,247,197,189,22,250,4,205,
+253,194,249,184,73,6,14,252,122,247,53,192,10,14,251,212,247,70,192,10,247,
+96,247,148,215,29,14,69,180,22,248,158,248,37,6,251,153,247,220,251,153,251,
+220,5,190,251,242,21,247,220,7,247,102,247,162,247,102,251,162,5,251,220,
+7,14,233,248,175,221,21,247,23,214,200,240,247,31,26,243,101,225,62,207,30,
+196,74,62,168,49,27,49,62,110,82,74,31,62,71,101,53,35,26,251,31,200,38,247,
+23,64,30,251,93,57,247,193,217,6,87,167,114,157,111,167,8,77,201,107,219,
+231,26,220,163,201,193,195,30,191,189,191,161,213,27,213,191,117,87,189,31,
+193,83,163,77,58,26,53,111,64,85,78,30,108,106,111,118,81,107,8,61,247,193,
+221,7,14,247,218,248,98,247,134,21,34,101,177,74,223,212,120,251,3,5,219,
+6,120,247,3,223,66,177,204,34,177,244,176,101,204,55,66,158,247,3,5,59,6,
+158,251,3,55,212,101,74,5,14,247,218,247,125,247,108,21,248,98,6,134,33,82,
+88,251,1,142,8,251,183,77,247,172,6,222,174,146,164,177,31,205,183,171,211,
+241,26,247,0,92,224,62,168,10,247,1,141,196,88,144,33,8,252,98,6,14,65,248,
+164,247,136,21,146,7,138,199,138,151,132,172,8,245,117,52,206,251,7,27,251,
+39,46,32,251,59,251,59,229,38,247,40,247,6,213,191,242,171,31,141,146,5,82,
+6,132,123,134,130,136,135,8,89,108,88,113,74,27,95,103,151,161,115,31,122,
+154,130,155,128,176,8,237,7,247,179,187,21,251,177,224,6,209,172,175,164,
+208,27,193,176,122,99,174,31,150,126,143,132,145,121,8,14,247,208,249,178,
+247,229,21,252,202,247,92,5,252,36,7,14,247,208,247,85,247,229,21,248,202,
+251,92,5,248,36,7,14,215,247,149,249,25,21,252,89,115,29,247,240,7,247,181,
+95,5,252,3,115,29,248,82,7,14,132,34,10,14,132,51,10,251,15,217,198,29,232,
+249,27,248,12,221,7,14,133,127,22,249,71,6,251,189,249,109,5,39,6,190,251,
+5,21,247,103,252,170,5,252,59,6,14,132,39,10,14,76,58,29,14,187,125,10,14,
+243,248,175,248,32,21,251,191,66,247,191,6,251,43,248,54,61,10,14,252,32,
+121,10,14,132,84,10,133,248,32,114,10,251,16,6,251,148,221,10,243,6,247,106,
+249,9,247,106,253,9,5,243,6,14,247,51,90,29,187,57,29,14,115,203,22,248,159,
+221,252,159,6,170,247,142,21,248,95,221,252,95,6,110,247,125,21,248,155,221,
+252,155,6,14,243,32,10,14,187,247,67,150,10,132,73,29,83,183,22,248,168,221,
+252,50,6,247,173,247,180,251,167,247,169,5,248,27,221,252,150,57,6,247,172,
+251,169,251,173,251,181,5,14,76,104,10,14,132,44,29,14,247,16,247,244,129,
+21,232,230,6,247,65,149,241,244,247,61,26,247,61,38,243,251,66,149,30,230,
+46,48,7,251,59,129,251,0,251,3,251,54,26,251,55,247,0,251,2,247,59,128,30,
+220,4,97,143,116,146,110,158,8,78,178,112,192,219,26,221,167,194,197,176,
+30,168,157,163,147,182,142,8,232,22,182,136,163,131,168,121,8,197,102,167,
+84,57,26,59,112,86,78,100,30,110,120,116,132,97,135,8,14,132,74,29,247,53,
+248,99,114,10,47,252,145,6,79,141,89,155,101,167,85,182,128,182,140,247,52,
+8,247,109,45,251,109,7,251,62,156,73,200,80,30,195,89,217,112,233,137,8,251,
+30,231,247,30,7,220,141,207,159,193,177,8,220,198,161,208,247,78,26,247,109,
+45,251,109,7,140,251,42,130,99,98,95,101,104,82,119,71,136,8,14,213,167,47,
+10,14,43,248,225,135,29,49,6,87,251,43,116,188,126,161,116,166,25,182,103,
+86,163,84,27,251,16,51,251,9,251,56,251,57,224,251,7,247,14,200,195,169,193,
+177,31,160,169,151,162,160,189,195,251,56,24,230,10,251,44,90,90,75,73,27,
+66,87,223,247,10,247,15,191,221,216,204,181,89,251,33,192,31,14,40,218,222,
+29,222,247,133,6,108,177,183,124,196,27,247,27,227,233,247,35,239,98,203,
+54,173,31,195,170,168,188,204,26,247,0,57,215,251,9,70,76,113,97,105,30,109,
+103,130,98,42,26,222,144,21,212,144,168,158,163,30,163,157,174,153,177,27,
+212,185,96,70,93,116,97,106,124,31,119,129,123,137,90,136,8,70,7,140,154,
+151,140,151,27,225,196,77,44,41,81,77,48,86,99,156,178,106,31,14,251,66,247,
+104,213,29,247,126,6,247,84,248,144,5,45,6,251,32,252,25,251,40,248,25,5,
+45,6,247,92,252,144,5,14,251,9,247,150,248,168,21,251,28,134,59,38,251,60,
+26,251,69,227,35,247,41,188,29,30,122,160,133,144,69,193,251,40,247,7,24,
+247,143,213,252,5,68,6,247,73,251,88,65,29,251,120,50,29,14,251,125,224,249,
+35,21,247,116,6,92,111,103,108,97,93,8,44,35,90,251,7,251,9,26,49,173,71,
+200,111,30,166,126,175,131,188,135,183,135,24,202,133,153,130,102,26,105,
+136,129,93,251,13,30,224,6,183,247,11,144,157,187,26,206,105,167,44,149,30,
+93,144,65,146,133,141,118,151,25,107,158,121,184,199,26,231,181,238,218,234,
+30,189,199,191,181,218,184,8,213,251,236,7,14,79,10,14,247,170,249,124,21,
+65,79,108,84,101,31,96,74,124,62,251,44,26,251,39,153,62,176,74,30,76,175,
+202,104,215,27,224,199,171,205,177,31,176,203,153,217,247,37,26,247,46,124,
+215,96,205,30,195,101,79,169,65,27,251,37,251,221,21,143,243,145,175,162,
+185,8,182,160,179,162,191,27,191,178,116,96,161,31,161,93,146,103,143,35,
+8,138,72,21,138,45,135,91,130,103,8,62,120,93,99,72,27,76,96,174,205,117,
+31,127,178,134,188,138,245,8,14,252,88,187,10,14,251,66,247,33,247,195,21,
+247,113,55,252,160,223,247,91,7,222,220,247,66,251,172,5,242,6,251,106,247,
+234,247,76,247,74,5,251,1,6,14,251,66,161,22,229,6,247,27,248,27,247,33,252,
+27,5,231,6,251,160,249,109,5,48,6,221,251,112,5,14,41,248,49,135,29,251,175,
+7,67,129,101,110,106,30,109,113,101,121,100,27,74,97,179,202,31,248,7,55,
+253,122,222,247,106,7,127,164,170,132,172,27,212,188,167,207,187,31,66,214,
+248,160,7,14,251,66,247,179,202,29,252,49,251,32,248,49,222,10,14,251,118,
+186,249,35,21,244,6,86,108,112,96,84,26,99,156,99,168,112,30,158,122,154,
+131,172,129,8,32,107,91,82,43,26,72,166,80,185,106,30,170,116,173,129,200,
+135,197,135,24,213,134,154,130,101,26,107,128,101,101,44,30,225,6,175,235,
+151,183,184,26,208,105,167,41,148,30,82,144,75,145,118,144,117,153,25,111,
+157,120,179,180,26,193,170,187,188,159,30,154,176,180,145,204,27,190,213,
+91,6,251,10,74,180,214,178,162,179,173,159,31,154,165,171,145,192,27,228,
+213,252,7,6,14,247,169,49,29,14,155,249,3,135,29,252,193,65,214,252,86,223,
+248,86,247,131,252,86,223,248,86,214,6,14,34,198,213,29,247,165,6,85,183,
+187,115,206,27,247,29,228,247,2,247,61,247,66,49,247,1,251,34,65,74,109,85,
+96,31,97,87,126,89,251,2,26,247,126,247,111,21,230,196,59,251,20,251,12,79,
+60,49,48,82,217,247,17,247,17,197,218,231,31,14,82,248,218,135,29,251,74,
+6,151,92,116,142,104,27,251,37,49,251,0,251,65,179,10,227,120,195,91,191,
+31,247,7,6,251,177,151,21,234,194,63,251,22,251,17,82,62,46,191,29,14,251,
+171,247,47,212,29,247,66,213,252,67,65,247,65,6,14,251,19,45,29,14,113,247,
+170,213,29,247,88,6,204,145,176,152,180,171,8,205,189,176,221,233,26,247,
+9,82,237,45,180,30,157,100,85,149,85,27,127,135,139,138,123,31,252,121,7,
+90,144,113,149,115,163,8,104,173,118,202,211,26,190,149,183,158,174,30,152,
+164,152,151,168,155,8,222,7,80,115,111,119,106,97,8,99,88,122,86,68,26,37,
+175,53,202,90,30,179,108,177,126,210,132,8,223,248,121,21,236,133,195,67,
+251,11,26,69,121,80,105,100,30,114,111,112,127,90,134,8,14,251,41,247,153,
+247,152,21,251,19,247,156,5,43,6,247,68,251,251,251,77,252,19,5,229,6,247,
+32,247,185,247,34,251,185,5,234,6,251,81,248,24,247,64,247,246,5,47,6,14,
+178,248,43,135,29,55,252,102,6,251,2,148,97,189,143,247,11,8,247,180,55,251,
+183,7,131,251,49,209,63,247,62,120,8,251,91,223,247,91,7,247,62,158,209,215,
+131,247,49,8,247,183,55,251,180,7,143,251,11,97,89,251,2,130,8,14,246,51,
+29,14,251,84,248,55,222,29,175,234,152,186,169,26,163,129,162,123,154,30,
+115,161,135,141,54,168,94,155,24,72,163,113,152,117,160,8,104,171,118,193,
+194,26,241,205,215,228,182,179,120,108,162,30,153,121,145,122,143,106,8,227,
+6,134,194,128,168,112,173,8,188,99,76,167,68,27,73,78,114,96,96,31,95,93,
+110,64,69,26,71,165,67,180,95,30,168,107,175,118,200,118,247,5,101,24,174,
+127,153,125,117,26,118,127,101,103,44,30,14,251,19,143,247,186,21,72,181,
+7,251,55,145,213,51,247,22,27,236,205,184,231,176,31,160,192,148,202,246,
+26,160,140,142,139,160,141,8,208,7,118,137,136,139,118,138,136,245,131,193,
+118,184,8,224,100,67,188,50,27,35,66,66,35,251,30,247,18,45,247,78,31,154,
+6,138,61,136,96,132,105,8,55,120,93,95,69,27,80,98,171,199,119,31,128,170,
+136,168,136,229,8,247,175,247,2,21,251,43,43,202,239,200,179,182,196,179,
+177,121,109,162,31,174,96,153,82,50,26,14,251,6,247,130,222,29,221,247,88,
+6,194,143,170,149,173,163,8,208,186,178,227,246,26,247,0,100,226,70,187,30,
+105,163,108,149,84,143,8,247,15,57,251,15,7,85,135,108,129,105,115,8,71,91,
+101,52,251,0,26,32,177,51,207,92,30,173,115,170,129,193,135,8,214,4,49,149,
+91,211,247,17,26,247,13,188,212,228,149,30,221,22,229,129,189,66,251,15,26,
+251,14,89,66,49,129,30,14,246,247,58,248,92,21,80,87,111,66,40,26,52,165,
+72,190,93,30,112,168,178,123,176,27,191,183,167,189,169,31,89,167,185,111,
+190,27,242,217,243,247,27,247,84,251,18,243,251,123,31,251,159,71,6,247,136,
+22,231,189,131,117,181,31,209,101,178,67,48,26,43,104,75,85,81,109,196,247,
+3,30,209,55,69,7,251,1,109,81,81,83,104,203,241,243,170,201,218,197,30,14,
+252,88,187,10,148,247,83,43,10,251,19,45,29,235,247,83,43,10,251,233,247,
+18,249,159,45,10,251,233,247,18,249,239,106,10,132,34,10,251,173,239,45,10,
+247,2,247,148,130,29,251,121,249,27,45,10,247,56,249,4,133,29,251,122,248,
+33,45,10,251,182,247,148,105,29,251,122,249,109,45,10,239,248,22,42,10,252,
+46,209,45,10,217,168,47,10,88,249,27,45,10,247,73,248,155,101,10,252,122,
+249,109,45,10,252,32,121,10,55,68,10,132,44,29,57,68,10,43,248,223,135,29,
+48,6,87,251,43,117,188,126,161,116,166,25,182,102,87,163,80,27,251,26,41,
+251,11,251,54,251,55,234,251,9,247,24,236,199,192,247,26,194,31,196,251,56,
+5,230,10,251,46,89,91,77,70,27,54,78,225,247,10,247,10,201,224,226,208,180,
+92,251,36,193,31,251,96,248,144,45,10,251,120,50,29,35,248,181,45,10,79,10,
+247,2,247,147,45,10,252,88,187,10,140,247,147,45,10,247,169,49,29,98,247,
+209,45,10,246,51,29,56,248,18,45,10,251,19,45,29,223,247,147,45,10,252,88,
+187,10,140,100,10,251,19,45,29,223,100,10,132,248,109,89,10,14,121,247,62,
+248,56,21,247,119,248,20,221,252,114,253,109,180,10,93,176,31,172,98,93,152,
+65,27,251,111,57,21,114,29,14,132,220,83,29,233,251,207,21,247,125,247,71,
+162,29,108,218,10,251,71,251,224,21,247,142,247,118,7,221,188,93,231,10,251,
+24,222,177,10,14,142,248,205,22,142,29,252,56,251,253,7,143,251,60,73,32,
+251,7,128,8,251,140,233,247,58,7,248,45,221,21,251,238,6,212,184,181,244,
+138,247,31,8,247,168,247,124,7,14,132,122,29,14,247,141,248,50,235,29,239,
+170,10,241,6,251,143,166,29,42,247,194,45,251,194,42,123,29,236,6,14,69,195,
+247,116,21,140,77,147,104,163,99,8,67,182,214,101,237,27,215,200,162,182,
+179,31,178,180,162,201,199,59,29,7,14,184,73,10,14,48,202,22,112,10,76,247,
+194,45,6,14,121,248,151,22,233,249,109,252,123,109,10,247,191,7,14,247,51,
+248,103,92,10,187,248,184,233,10,233,249,109,161,10,243,248,24,42,10,14,184,
+247,65,150,10,132,247,78,247,201,21,247,120,123,10,233,209,10,247,85,183,
+10,187,248,219,247,149,21,251,11,137,58,60,251,12,27,251,42,45,247,6,247,
+77,247,81,231,247,4,247,48,247,8,210,77,38,140,31,238,6,247,35,136,251,12,
+241,251,57,27,251,97,251,28,251,44,251,123,251,19,183,251,4,215,72,31,89,
+195,210,114,224,27,247,15,236,192,237,194,31,164,184,147,168,194,26,14,76,
+247,245,249,27,21,247,131,221,252,208,57,247,131,253,27,233,6,14,100,82,29,
+14,225,247,225,129,21,233,230,6,247,84,149,247,5,244,247,61,26,247,61,251,
+4,243,251,85,149,30,230,45,48,7,251,78,129,251,11,251,3,251,54,26,251,55,
+247,11,251,2,247,78,128,30,220,4,91,143,112,146,104,158,8,69,178,108,192,
+219,26,220,172,196,206,175,30,173,158,166,146,189,142,8,233,22,189,136,166,
+132,173,120,8,206,103,172,82,58,26,59,108,86,68,100,30,105,120,112,132,91,
+135,8,14,132,248,25,77,29,205,222,22,248,159,199,10,84,249,27,196,29,132,
+248,143,22,233,249,109,98,29,247,135,190,22,249,194,249,109,45,253,27,251,
+158,249,27,45,253,27,251,158,221,29,247,156,192,22,249,170,142,29,45,253,
+27,251,170,249,27,45,253,27,251,160,221,29,121,247,64,77,10,14,247,103,247,
+71,77,10,248,163,57,21,233,249,109,45,6,14,247,10,247,230,114,10,252,4,57,
+247,166,253,27,247,185,6,219,10,93,176,31,172,98,93,152,65,27,251,85,6,57,
+4,247,76,200,10,251,76,6,14,184,248,246,247,215,21,251,57,123,43,40,251,37,
+27,69,75,165,185,94,31,106,172,122,171,121,200,48,123,24,163,59,160,100,181,
+94,8,74,202,225,104,241,27,247,102,247,34,247,45,247,121,247,121,251,34,247,
+45,251,102,251,49,251,1,64,251,39,80,31,230,121,5,242,182,221,194,247,1,27,
+225,216,99,72,183,31,165,99,153,96,148,76,8,251,205,56,6,14,247,228,247,56,
+248,50,21,247,207,45,253,109,233,247,224,247,42,7,251,110,153,247,22,251,
+29,247,85,27,247,83,247,18,247,44,247,122,247,122,251,18,247,44,251,83,251,
+76,251,18,251,15,251,96,114,31,247,226,247,137,21,247,30,226,251,10,251,78,
+251,70,49,251,10,251,27,251,37,40,247,14,247,70,247,70,238,247,14,247,37,
+31,14,187,248,176,247,206,21,251,206,233,249,109,251,225,7,251,35,60,70,251,
+18,54,171,90,219,99,31,60,105,120,102,251,11,26,137,251,9,134,119,106,106,
+8,247,0,6,154,174,145,170,193,26,171,7,138,153,139,150,147,26,228,176,179,
+222,30,247,131,221,21,251,116,6,40,95,178,226,182,152,172,164,160,31,159,
+162,169,147,191,27,247,116,6,14,251,77,248,70,114,10,252,14,253,109,233,249,
+27,247,236,221,195,10,247,83,247,150,22,233,247,183,6,169,149,163,161,160,
+30,171,172,179,151,214,27,243,184,111,74,31,251,61,7,99,118,115,103,137,30,
+251,37,57,247,38,6,219,137,211,214,137,221,8,247,58,7,185,125,175,108,170,
+30,181,97,91,155,49,27,37,92,120,79,90,31,247,126,247,61,221,252,132,57,247,
+125,7,14,184,248,60,247,215,21,222,251,205,7,146,193,149,175,159,175,8,219,
+182,220,186,234,27,247,1,220,84,36,182,31,231,157,5,247,39,80,251,2,214,251,
+48,27,228,29,170,29,240,225,174,204,202,31,182,184,160,178,163,219,47,155,
+24,121,78,122,107,107,106,8,93,94,74,113,70,27,251,37,43,238,247,57,123,31,
+14,132,248,232,248,151,21,247,33,140,38,224,251,59,67,29,247,4,27,225,193,
+10,230,83,204,78,10,14,252,32,137,10,252,32,137,10,252,32,137,10,251,66,247,
+222,114,10,252,149,7,80,133,107,122,114,30,111,121,106,122,102,27,105,108,
+153,163,120,31,120,163,132,165,183,26,186,45,75,7,251,10,218,64,247,14,206,
+186,157,178,178,30,177,177,156,185,203,26,248,183,7,14,248,19,248,148,249,
+27,21,253,27,247,188,7,247,35,220,216,247,28,210,117,191,91,177,31,172,98,
+93,152,65,27,251,87,247,201,252,95,109,10,7,248,1,251,201,21,247,79,6,230,
+193,92,58,59,85,91,48,31,251,79,6,14,247,228,248,78,247,230,21,251,230,129,
+10,247,201,45,251,201,251,185,247,201,46,253,109,233,247,230,6,248,22,22,
+114,29,14,247,72,247,145,22,233,247,183,6,211,203,185,240,237,183,111,75,
+30,251,209,233,247,213,7,185,125,173,108,171,30,180,100,89,156,59,27,47,91,
+119,81,92,31,247,126,247,103,221,252,177,57,247,128,7,14,184,218,22,247,125,
+251,58,233,247,58,247,127,249,109,196,29,243,248,24,249,121,21,251,102,251,
+33,251,46,251,121,145,29,247,12,202,10,247,150,252,60,21,157,29,222,4,247,
+54,157,235,236,247,35,27,247,35,235,43,251,55,157,31,14,247,239,248,77,235,
+29,247,6,170,10,191,251,38,232,247,120,43,177,29,251,72,251,194,5,251,3,247,
+194,45,251,194,251,3,123,29,247,3,6,14,139,248,23,129,29,247,172,234,10,233,
+7,14,243,178,248,36,21,137,122,139,129,125,26,251,121,247,33,251,46,247,103,
+247,103,247,33,247,45,247,121,247,121,251,33,247,46,251,103,251,48,251,2,
+64,251,39,80,30,231,121,5,242,182,220,194,247,1,27,226,216,99,72,182,31,166,
+97,155,93,146,75,8,56,4,157,29,14,160,247,47,114,10,45,253,109,233,248,6,
+6,159,214,188,147,198,27,247,14,200,103,67,31,251,182,233,247,187,7,247,9,
+45,207,251,54,75,69,129,121,69,30,14,248,35,248,170,114,10,64,252,232,6,251,
+216,248,232,5,53,253,109,214,248,227,6,247,213,252,227,5,228,6,247,173,249,
+121,21,251,17,48,251,9,251,51,251,58,227,251,4,247,22,247,18,228,247,8,247,
+55,247,50,47,247,9,251,17,31,56,4,225,195,61,251,11,251,3,81,59,57,54,81,
+219,247,8,247,5,197,218,222,31,251,98,253,38,21,248,50,222,252,50,6,14,251,
+28,247,67,248,50,21,247,125,247,252,221,252,90,251,207,93,57,185,251,224,
+233,247,224,247,148,221,7,14,139,248,23,247,114,21,203,7,176,29,251,107,247,
+247,5,251,6,6,247,172,252,79,5,75,251,47,55,247,47,251,30,233,247,30,247,
+40,223,7,14,132,122,29,247,23,249,212,43,10,184,216,22,233,222,6,248,12,192,
+29,252,12,252,64,5,248,146,45,7,247,23,247,94,139,10,80,6,97,135,184,10,251,
+24,225,177,10,251,131,247,102,42,29,252,32,247,78,105,29,63,68,10,48,202,
+235,29,202,6,247,117,137,29,77,247,194,45,6,247,142,247,102,42,29,100,82,
+29,164,249,229,97,29,184,73,10,248,69,246,70,29,100,248,104,250,1,185,10,
+251,218,253,187,21,87,10,14,83,247,118,248,63,21,87,247,194,45,253,109,233,
+247,237,191,251,75,199,247,75,141,6,247,116,137,29,247,76,79,7,14,131,219,
+235,29,212,170,10,197,199,10,37,177,29,251,71,251,194,5,67,247,194,45,6,14,
+187,248,184,233,10,195,142,29,161,10,174,248,25,81,10,202,199,10,40,6,14,
+160,248,4,247,143,21,196,144,187,147,187,152,8,251,169,233,249,109,45,252,
+6,7,79,123,96,131,89,136,8,247,117,79,251,117,7,35,145,89,174,140,205,8,247,
+182,45,251,187,7,140,251,8,229,72,247,48,137,8,251,33,199,7,14,160,248,157,
+22,195,142,29,98,29,132,39,10,247,40,249,237,66,10,184,73,10,247,164,247,
+102,66,10,243,247,80,249,22,21,251,71,58,247,71,252,197,247,211,6,247,35,
+221,216,247,26,210,115,193,93,177,31,172,99,92,152,65,27,251,111,247,33,247,
+81,220,251,81,226,45,6,233,252,27,21,247,102,200,10,251,102,6,14,243,248,
+29,249,120,21,251,108,251,32,251,40,251,121,251,115,247,34,251,43,247,102,
+247,103,247,33,247,43,247,116,247,115,251,34,247,45,251,98,31,137,251,232,
+21,161,105,111,148,100,27,97,109,132,110,52,31,247,55,154,237,239,247,37,
+27,247,37,239,36,251,53,152,31,113,69,93,128,100,27,115,117,145,150,123,31,
+247,108,89,21,251,53,119,46,47,251,36,27,52,64,177,205,94,31,113,177,123,
+186,131,204,8,161,203,168,145,179,27,179,166,131,116,173,31,100,199,148,135,
+173,27,176,174,147,167,218,31,150,143,148,142,145,141,8,14,247,21,249,121,
+249,106,21,149,114,125,142,116,27,70,100,103,57,115,31,251,40,252,145,251,
+106,248,253,5,39,6,247,153,221,10,240,6,247,78,248,228,5,182,152,157,155,
+173,27,155,148,136,130,157,31,14,69,247,200,116,21,193,188,151,161,175,31,
+200,176,179,216,220,59,29,45,7,135,251,25,223,40,247,22,126,107,68,24,150,
+133,5,144,152,146,141,150,120,10,121,145,162,94,113,10,48,247,49,248,63,21,
+140,247,194,5,252,4,57,247,165,253,27,112,10,14,187,248,26,116,21,247,61,
+143,235,236,161,247,80,8,186,10,110,134,10,247,74,247,79,226,247,7,247,34,
+198,83,10,185,107,186,124,204,135,108,69,24,151,133,5,144,151,146,107,10,
+174,197,205,29,14,132,248,143,221,21,83,251,140,233,247,58,195,249,109,112,
+29,204,208,149,157,209,30,14,248,171,190,21,136,131,134,138,132,27,112,123,
+154,165,31,247,199,7,233,71,189,251,21,62,78,117,99,103,30,115,112,130,109,
+136,86,8,223,6,204,146,177,169,216,27,215,180,111,88,31,123,7,138,102,121,
+127,72,129,251,11,124,122,136,107,125,8,78,113,108,92,71,26,41,204,79,244,
+205,190,161,191,198,30,88,145,166,116,194,27,158,151,141,146,167,31,251,39,
+247,70,21,112,131,121,115,117,30,108,105,97,123,91,27,74,101,170,192,194,
+175,166,228,152,31,229,152,156,143,166,151,8,14,38,247,242,249,164,21,99,
+7,135,93,118,123,61,123,68,124,95,108,109,83,8,105,75,121,42,251,14,26,251,
+1,155,77,183,85,30,87,180,200,112,214,27,188,29,31,188,99,75,169,75,27,81,
+89,118,99,98,31,148,202,179,177,207,152,232,155,143,141,171,167,8,171,175,
+149,172,216,26,251,41,251,214,65,29,251,35,197,22,247,187,6,231,198,198,232,
+200,117,175,79,171,31,181,170,157,172,184,26,217,74,195,50,30,251,162,6,223,
+252,86,21,247,58,247,78,7,193,174,106,88,89,104,107,85,31,251,78,247,132,
+21,247,28,247,78,7,181,164,114,97,98,111,111,100,31,14,251,201,198,201,10,
+14,48,155,42,21,226,236,247,248,42,226,247,63,96,248,86,251,226,76,6,37,127,
+55,114,75,30,111,63,104,98,86,119,8,248,39,22,251,169,6,207,201,177,247,11,
+142,247,52,8,174,247,60,7,14,248,151,62,29,14,134,247,185,22,223,247,141,
+201,6,247,40,251,141,5,236,232,29,247,17,217,10,77,247,93,55,251,93,76,128,
+10,202,6,14,251,108,182,247,56,21,117,7,38,210,75,247,5,247,2,216,209,237,
+199,111,180,69,10,101,106,78,75,105,170,196,31,161,7,14,251,7,58,10,14,251,
+128,99,10,14,48,248,53,235,10,252,24,132,10,247,112,7,14,153,181,212,29,6,
+247,67,252,86,5,225,6,247,66,248,86,5,252,86,223,248,160,251,20,7,251,66,
+252,75,251,66,248,75,5,251,19,6,14,251,14,211,169,29,223,248,160,55,251,103,
+251,133,247,103,55,6,14,247,169,49,29,14,251,24,210,212,29,247,124,252,86,
+223,248,160,252,36,6,14,197,222,29,221,247,165,6,85,183,188,115,208,27,247,
+28,228,247,1,247,59,247,69,54,247,1,251,29,69,82,108,81,101,31,213,57,113,
+29,251,66,248,108,247,240,21,134,190,129,172,118,204,29,47,251,4,251,66,251,
+61,228,32,247,33,247,16,217,214,247,20,149,31,56,6,55,126,96,97,68,27,49,
+84,214,247,16,247,23,194,217,231,209,184,98,66,149,31,14,251,108,247,79,212,
+29,247,44,213,252,25,65,247,45,6,14,251,66,67,10,14,247,41,248,5,213,29,247,
+88,6,210,143,179,149,187,163,8,229,183,192,230,246,26,247,0,86,230,49,183,
+30,91,163,99,148,68,144,8,247,15,55,251,15,7,69,134,100,130,92,115,8,50,94,
+87,49,251,0,26,32,191,48,228,95,30,186,115,178,129,209,135,8,214,4,251,28,
+149,65,211,247,15,26,247,15,213,211,247,28,150,30,223,22,247,32,128,214,67,
+251,15,26,251,14,64,67,251,32,128,30,14,251,66,247,189,88,29,235,6,14,38,
+226,22,247,239,251,51,225,247,125,93,248,86,196,10,247,41,209,22,249,12,251,
+51,223,247,125,96,248,86,151,29,90,247,80,104,29,251,186,65,247,102,6,141,
+10,184,220,93,29,247,118,65,21,223,248,160,55,6,14,251,45,208,93,29,14,251,
+56,247,5,247,242,21,210,159,191,180,207,27,219,193,82,42,150,31,251,76,65,
+247,78,6,251,1,136,80,68,51,27,63,90,189,232,121,31,53,117,5,251,23,167,217,
+72,247,15,27,247,39,230,247,0,247,66,247,63,46,247,1,251,37,251,5,59,78,251,
+2,109,31,14,215,247,27,247,205,21,247,103,55,252,160,223,247,131,247,11,7,
+251,61,147,223,46,247,36,27,247,41,227,243,247,69,247,69,51,243,251,41,251,
+24,56,58,251,37,120,31,247,126,247,41,65,29,251,24,248,17,235,10,251,142,
+6,39,69,74,48,69,169,99,212,110,31,93,121,117,108,137,89,8,83,7,138,92,135,
+124,124,127,8,226,6,151,151,146,165,140,175,8,195,7,140,186,168,171,181,140,
+8,247,36,6,213,4,251,58,6,88,107,171,191,189,172,171,189,31,247,58,6,14,251,
+155,247,236,135,29,251,149,252,160,223,248,86,247,125,213,195,10,215,22,223,
+247,237,6,211,185,194,177,195,27,193,178,98,83,31,251,199,7,138,81,93,89,
+88,140,8,251,21,62,247,21,6,243,144,216,217,140,240,8,247,199,210,29,87,110,
+71,82,155,10,251,56,248,119,248,4,21,247,2,109,58,200,251,4,27,251,38,47,
+251,1,251,63,251,66,230,251,0,247,38,247,16,216,206,247,23,168,31,53,161,
+5,46,121,89,89,64,27,51,80,210,247,1,135,31,247,79,213,251,76,6,236,150,192,
+196,220,27,207,191,98,68,159,31,14,251,66,248,74,248,14,21,243,138,71,196,
+56,10,14,252,88,247,45,169,10,185,29,14,252,88,208,135,29,252,232,7,87,123,
+122,87,134,132,139,140,131,30,61,7,247,7,135,192,172,143,219,8,249,13,7,247,
+97,4,55,34,223,6,14,247,124,248,63,104,29,252,34,132,10,247,122,7,141,10,
+247,31,191,169,29,160,10,55,251,103,251,133,247,103,55,6,248,45,252,86,21,
+247,58,247,56,7,164,153,135,129,152,31,159,125,151,112,111,26,86,108,109,
+86,30,14,215,115,10,86,110,71,83,155,10,251,14,222,22,247,45,251,52,223,247,
+52,247,42,248,160,196,10,247,169,111,10,247,41,251,210,21,32,128,86,79,55,
+27,55,86,199,246,128,31,213,4,246,150,192,199,223,27,223,192,79,32,150,31,
+14,251,45,247,252,235,10,88,10,247,20,203,22,249,53,248,160,151,29,247,37,
+247,243,178,29,251,49,223,247,124,62,6,251,16,247,103,247,16,217,10,36,247,
+93,55,251,93,36,128,10,242,6,14,251,66,248,27,135,29,251,32,167,10,251,110,
+223,247,110,7,247,79,248,160,5,14,251,11,180,247,174,21,59,145,89,154,102,
+30,53,173,219,87,237,27,247,38,233,247,3,247,65,247,65,49,244,251,40,251,
+12,56,71,251,6,118,31,218,6,208,162,188,175,207,27,192,185,115,95,168,31,
+159,109,146,109,140,87,8,137,71,21,42,132,80,76,55,27,54,80,205,233,31,14,
+32,221,115,10,87,110,71,82,30,247,186,55,7,14,251,177,247,46,247,215,21,247,
+19,247,125,213,251,209,251,93,104,65,174,251,141,223,247,141,247,43,7,140,
+213,5,14,251,66,247,185,137,21,141,7,247,79,248,160,5,49,6,251,31,167,10,
+137,251,13,82,247,13,251,51,223,247,51,247,11,196,7,14,248,152,62,29,251,
+69,248,49,43,10,251,7,58,10,187,247,100,102,29,134,31,14,251,201,203,201,
+10,247,64,71,29,252,32,247,76,169,10,65,81,29,251,128,99,10,247,99,71,29,
+251,66,67,10,252,17,247,100,64,29,251,7,58,10,247,216,247,16,70,29,251,66,
+248,17,249,38,185,10,148,75,70,10,14,251,61,247,97,247,215,21,89,247,93,55,
+252,160,223,247,141,189,251,20,193,247,20,6,247,39,161,29,34,251,93,5,247,
+20,85,7,14,251,27,210,178,29,232,10,62,6,251,16,247,104,160,29,14,251,16,
+210,169,29,173,232,10,105,248,86,55,251,103,251,133,247,103,55,6,14,251,39,
+247,185,88,29,185,251,51,223,247,125,56,6,14,251,58,247,166,247,67,21,170,
+144,161,146,169,151,8,251,91,223,248,160,55,251,148,7,110,130,115,133,109,
+136,8,247,13,85,251,14,7,86,143,110,167,188,26,247,86,55,251,105,7,135,54,
+203,85,245,138,8,49,193,7,14,251,58,247,245,22,173,232,10,105,248,86,88,10,
+53,29,251,7,58,10,247,45,247,108,66,10,78,247,17,248,92,21,252,92,247,143,
+7,195,29,247,34,207,29,6,247,46,252,18,214,10,85,88,108,108,86,31,14,247,
+176,248,171,21,251,47,51,38,251,68,251,61,227,39,247,42,247,41,226,238,247,
+63,247,64,52,243,251,36,31,247,35,251,198,21,36,131,85,79,53,27,89,95,162,
+179,113,31,122,166,132,161,134,187,8,154,174,163,146,159,27,158,154,132,119,
+164,31,120,162,153,132,155,27,155,160,145,156,179,31,153,213,21,119,89,134,
+137,126,27,127,124,146,156,118,31,162,109,123,146,117,27,116,110,130,118,
+93,31,145,188,146,161,156,166,8,181,165,183,163,189,27,189,182,115,97,164,
+31,155,112,145,118,145,93,8,14,96,248,192,135,29,144,119,127,141,123,27,74,
+105,106,57,119,31,63,251,209,182,10,230,6,247,8,248,35,5,184,152,153,153,
+169,27,149,146,138,134,151,31,14,251,108,247,134,116,21,241,145,209,207,233,
+26,198,111,181,69,10,102,106,77,75,105,170,196,31,161,52,117,7,45,200,77,
+237,131,30,108,69,151,132,5,145,151,146,95,10,131,197,29,251,128,176,248,
+86,21,252,86,223,247,141,242,7,247,40,161,29,33,211,10,251,185,65,6,14,251,
+66,247,171,116,21,247,7,145,215,216,146,247,12,8,55,6,55,151,10,247,23,105,
+10,251,51,217,36,247,22,126,31,108,69,151,133,5,144,150,147,95,10,130,133,
+139,137,127,31,14,251,45,247,252,214,21,82,251,124,223,247,49,196,248,160,
+55,251,147,6,125,95,102,133,100,27,74,105,167,193,31,247,85,55,251,104,189,
+29,199,27,186,181,148,158,185,31,14,224,248,107,247,176,21,170,141,162,146,
+161,151,8,201,174,170,194,216,26,247,17,65,209,251,24,30,251,168,253,47,224,
+247,175,247,26,6,241,251,43,47,251,24,5,230,6,183,205,182,73,5,234,6,49,247,
+28,241,247,36,5,44,6,87,59,5,251,174,247,50,21,247,126,247,70,7,221,187,95,
+66,65,91,96,57,31,14,247,218,248,140,249,96,21,251,96,251,52,251,51,251,94,
+251,91,247,52,251,51,247,93,247,91,247,52,247,52,247,92,247,89,251,53,247,
+54,251,87,31,164,82,21,247,35,126,247,6,251,6,153,251,37,8,251,163,6,247,
+164,82,21,130,251,34,251,13,251,15,251,34,128,8,247,168,7,83,251,168,21,251,
+39,153,251,5,247,5,125,247,41,8,247,166,6,251,166,196,21,153,247,36,247,7,
+247,6,247,37,153,8,251,164,7,14,247,134,176,137,21,247,105,175,143,165,200,
+31,247,5,189,223,247,51,247,55,26,225,112,214,95,173,30,164,108,94,151,80,
+27,251,8,56,107,77,94,31,113,103,129,100,137,66,204,171,24,151,7,193,156,
+177,173,162,30,156,150,149,142,185,148,66,252,31,24,124,69,115,97,110,129,
+8,119,6,211,138,21,200,188,154,172,161,247,15,194,247,210,24,146,6,144,6,
+158,6,169,151,136,127,158,31,179,114,161,81,58,26,32,115,52,92,76,30,100,
+89,88,110,84,136,8,247,123,251,125,21,206,6,173,247,82,5,125,170,151,136,
+158,27,247,6,238,247,41,247,66,236,100,189,62,92,99,119,102,109,31,105,97,
+121,85,117,251,11,8,185,251,0,21,174,247,84,5,225,155,173,188,183,27,178,
+160,99,65,251,32,86,251,2,71,113,119,149,161,121,31,14,247,214,248,140,249,
+96,21,251,94,251,53,251,49,251,89,251,92,247,50,251,52,247,91,247,89,247,
+52,247,52,247,89,247,86,251,52,247,55,251,83,31,128,82,21,247,61,247,28,251,
+24,251,58,251,60,251,25,251,26,251,59,251,58,251,26,247,26,247,58,247,55,
+247,26,247,29,247,53,31,14,37,184,146,21,228,6,174,247,2,161,209,180,210,
+193,200,25,195,187,190,175,168,27,151,147,130,125,126,139,139,125,98,31,76,
+251,104,5,129,106,134,115,121,26,108,158,115,164,173,190,178,206,195,30,118,
+153,129,129,138,138,126,125,25,118,121,129,132,127,27,132,132,147,147,142,
+141,147,141,146,31,143,149,141,146,140,141,200,247,99,24,158,200,141,149,
+160,26,181,114,171,106,87,63,86,58,75,30,103,92,137,137,134,133,131,130,25,
+204,247,107,247,53,220,158,193,251,58,52,188,247,53,251,62,118,130,111,5,
+189,153,132,116,129,138,136,123,77,31,123,81,251,7,82,122,89,247,7,195,5,
+14,247,48,249,123,247,59,21,39,91,89,101,51,27,95,103,148,169,64,31,233,247,
+1,148,160,175,247,76,8,247,36,194,239,245,236,26,213,84,193,63,63,72,77,39,
+107,30,121,81,132,97,130,251,10,61,140,88,152,90,172,8,88,173,110,189,193,
+26,180,157,173,175,170,30,176,170,160,148,223,163,130,168,24,251,46,111,66,
+80,46,26,80,168,81,188,95,30,195,91,200,119,242,137,131,251,22,106,42,86,
+93,8,183,42,80,157,90,27,79,98,115,103,85,202,103,234,197,174,149,178,217,
+31,103,233,191,126,188,27,192,194,164,179,175,31,161,163,152,161,157,185,
+8,251,117,247,149,21,143,141,194,140,154,30,142,224,144,170,156,186,8,193,
+159,179,173,183,27,181,171,101,89,93,114,83,99,95,31,109,106,109,120,58,100,
+8,251,108,251,237,21,110,95,99,126,94,27,74,81,164,167,164,173,154,193,169,
+171,131,124,174,31,191,117,139,139,154,133,8,14,74,165,248,125,21,123,7,86,
+187,101,207,207,180,173,196,186,120,154,57,157,30,81,152,124,147,157,26,164,
+164,157,173,177,156,125,102,147,30,182,6,199,137,101,173,74,27,77,98,105,
+87,96,162,122,211,126,31,200,127,157,129,113,26,112,112,120,100,93,113,162,
+180,138,30,247,118,247,81,21,251,188,182,247,162,143,7,199,251,162,5,192,
+6,199,247,162,5,143,251,162,182,247,188,59,6,87,251,147,84,247,147,5,14,73,
+247,67,248,219,21,180,202,187,157,187,27,219,199,74,53,46,79,61,69,107,113,
+150,158,125,31,159,176,142,148,157,26,164,121,158,114,109,118,113,102,94,
+171,103,203,115,30,65,117,106,115,69,59,162,118,24,209,210,178,160,203,27,
+242,221,52,251,2,32,73,52,59,86,95,175,182,157,144,151,154,158,31,102,141,
+126,144,94,169,8,166,98,116,148,112,27,89,93,95,90,115,147,120,162,108,31,
+166,161,5,124,158,134,151,156,26,172,167,167,173,174,171,105,100,121,133,
+127,120,121,30,177,138,144,138,165,121,8,93,207,184,121,183,27,247,6,247,
+0,247,14,247,21,201,114,199,96,184,31,104,174,109,155,78,157,188,159,161,
+150,164,160,8,182,174,166,198,200,26,244,49,228,251,0,73,82,116,77,53,30,
+14,129,249,44,249,20,21,118,167,114,125,5,171,81,135,141,109,27,100,104,125,
+105,90,31,186,79,119,149,102,27,77,77,98,72,101,31,96,66,115,42,45,26,251,
+10,179,251,3,207,67,30,78,197,222,102,216,27,213,216,172,195,194,31,171,171,
+156,167,166,200,114,150,24,107,95,127,124,119,119,8,102,100,86,119,79,27,
+58,62,175,197,94,31,89,205,110,237,245,26,215,153,209,164,191,30,190,163,
+188,173,187,27,160,153,133,114,171,31,152,129,5,92,85,126,112,93,26,97,156,
+101,182,83,30,181,84,139,139,144,131,8,159,109,148,114,117,26,124,131,119,
+127,124,30,120,123,122,131,114,27,87,95,185,193,158,143,153,150,159,31,106,
+154,5,127,109,135,124,117,26,64,205,74,216,219,203,206,222,174,128,171,117,
+171,30,117,169,98,189,118,161,8,103,176,131,152,167,26,190,179,177,192,161,
+155,131,109,174,30,141,138,145,133,147,133,8,14,251,68,248,30,247,4,21,80,
+74,101,117,99,27,84,95,181,191,158,142,156,148,174,31,246,160,177,150,178,
+162,8,204,177,178,192,189,26,189,106,169,82,251,35,251,51,251,71,251,54,47,
+193,81,225,206,200,172,219,220,30,251,127,247,24,21,159,198,155,172,164,174,
+8,196,179,179,170,169,27,160,155,123,117,110,116,96,108,108,31,104,105,108,
+124,51,114,8,14,251,124,211,247,4,21,102,251,4,5,248,10,6,176,247,4,5,92,
+6,165,225,147,183,202,26,247,17,92,201,44,30,251,58,6,94,141,130,146,135,
+170,8,119,116,133,123,111,26,113,148,113,155,124,30,127,151,154,135,171,27,
+247,33,6,237,166,109,251,1,88,135,111,125,87,31,14,251,234,228,247,4,21,107,
+251,4,5,247,33,6,184,235,165,97,141,133,149,91,25,155,157,144,158,188,26,
+173,136,172,129,206,30,130,199,137,166,176,26,160,140,153,142,160,30,141,
+153,140,150,148,26,175,118,155,82,147,30,85,147,121,147,125,162,8,123,116,
+134,125,115,26,116,145,118,151,123,30,154,118,151,134,181,135,8,190,134,155,
+121,89,26,59,132,66,128,95,30,14,184,249,90,127,21,252,227,248,225,247,95,
+53,161,183,251,191,247,18,83,85,247,22,251,186,184,159,52,247,94,248,228,
+252,224,5,14,184,134,127,21,180,98,248,229,248,224,51,251,94,185,119,247,
+21,247,186,83,193,251,190,251,18,160,95,247,96,225,5,14,184,134,249,0,21,
+248,228,252,225,251,96,225,118,95,247,190,251,18,195,192,251,21,247,187,93,
+118,227,251,93,252,229,248,224,5,14,184,249,90,249,0,21,98,180,252,228,252,
+224,226,247,93,94,160,251,22,251,187,195,86,247,191,247,18,117,183,251,95,
+53,5,14,247,214,247,10,248,140,167,29,247,1,247,1,161,156,201,167,8,169,7,
+78,170,96,174,50,229,8,100,6,168,69,162,100,174,101,8,247,37,251,143,21,252,
+248,6,175,179,164,180,165,205,8,100,6,49,48,97,105,78,108,8,109,7,203,111,
+151,129,247,9,251,8,172,10,14,247,214,249,255,248,140,21,252,248,6,174,177,
+165,182,165,205,8,100,6,47,46,99,107,78,108,8,109,7,201,112,161,121,247,1,
+251,1,172,10,253,137,251,93,167,29,247,9,247,8,151,148,203,168,8,169,7,78,
+170,94,176,52,227,8,100,6,168,69,161,101,175,100,8,14,184,248,224,247,71,
+21,118,131,106,122,73,104,8,248,22,7,192,111,188,114,157,131,155,160,24,32,
+216,56,212,84,203,84,75,72,79,251,14,49,154,118,24,158,147,187,163,193,168,
+8,252,22,7,72,174,107,155,117,148,124,119,24,247,14,48,204,82,196,73,197,
+205,217,208,247,1,218,8,251,184,248,21,21,162,158,145,144,157,150,157,128,
+146,134,162,120,8,252,101,7,112,118,136,136,121,129,122,149,135,142,113,160,
+8,14,251,31,248,92,247,92,21,131,47,71,83,40,141,8,251,79,85,247,72,6,193,
+179,147,156,173,31,210,176,179,212,231,26,225,104,208,77,178,30,164,100,99,
+148,76,27,251,72,85,247,79,6,239,140,206,84,147,47,8,251,254,84,6,14,247,
+214,249,115,247,84,21,208,251,95,247,95,70,251,95,251,95,70,247,95,251,95,
+208,247,95,7,247,95,247,243,21,208,252,111,70,7,14,187,248,31,249,130,21,
+72,254,124,206,6,14,184,247,144,250,10,21,230,29,238,22,230,29,14,247,218,
+248,169,248,149,21,73,6,251,116,252,149,5,219,6,247,69,248,45,247,69,252,
+45,5,219,6,14,247,218,248,169,22,247,116,248,149,5,59,6,251,69,252,45,251,
+69,248,45,5,59,6,247,116,252,149,5,14,247,214,248,61,248,183,21,48,108,83,
+66,51,26,37,214,56,247,0,122,30,158,251,50,149,51,120,26,78,107,87,103,130,
+136,143,148,143,139,140,141,148,30,141,147,140,143,145,26,169,116,163,109,
+108,116,114,105,97,174,109,189,192,187,173,195,164,30,163,195,152,243,142,
+247,61,8,228,170,195,213,227,26,239,69,218,32,159,30,116,247,45,128,226,161,
+26,204,172,197,175,148,143,135,130,136,138,136,137,129,30,137,130,138,134,
+133,26,110,163,117,172,170,161,163,174,181,100,171,87,86,95,108,85,114,30,
+110,74,129,69,137,251,61,8,247,26,251,254,21,223,130,233,122,247,9,30,220,
+118,190,77,61,26,71,100,83,72,110,30,37,129,21,55,157,83,204,219,26,208,180,
+196,208,165,30,142,37,151,251,21,154,55,8,14,247,214,249,122,249,5,21,103,
+109,110,103,103,168,109,226,29,103,31,252,124,149,29,247,137,252,133,147,
+10,14,247,214,249,124,249,5,92,29,248,125,252,133,92,29,14,247,214,248,135,
+247,138,21,247,128,208,251,89,6,196,239,5,247,32,208,38,6,169,191,89,168,
+93,58,5,251,200,70,247,161,6,83,39,5,251,105,70,247,66,6,82,40,5,251,9,70,
+217,6,111,90,189,111,182,216,5,247,224,208,251,185,6,14,247,214,249,204,248,
+219,21,253,35,251,183,5,96,7,249,35,251,184,5,215,7,252,173,247,129,248,173,
+247,130,5,77,4,252,34,251,68,248,34,251,67,5,215,7,251,123,238,247,123,239,
+5,14,247,214,247,61,248,219,21,64,7,248,173,251,130,252,173,251,129,5,63,
+7,249,35,247,184,5,182,7,253,35,247,46,21,63,7,247,123,39,251,123,40,5,63,
+7,248,34,247,67,5,14,247,214,248,249,76,21,180,165,111,188,5,229,168,190,
+225,247,16,26,229,110,206,81,184,30,171,99,102,148,49,27,251,62,6,96,212,
+97,114,167,91,5,86,77,229,6,247,109,252,6,5,123,6,251,183,77,247,172,6,173,
+145,139,141,161,31,251,88,248,66,21,247,37,6,247,13,191,83,251,21,38,105,
+81,68,120,31,14,247,214,248,138,249,76,98,10,247,188,252,26,21,251,47,123,
+251,20,251,8,251,48,27,251,48,251,21,247,8,247,47,123,31,140,198,21,247,46,
+155,247,20,247,9,247,47,27,247,49,247,20,251,8,251,47,155,31,14,247,214,248,
+138,249,75,21,251,93,110,29,251,84,31,251,130,252,185,21,94,195,117,201,209,
+26,247,58,247,26,247,27,247,58,208,202,117,94,197,30,183,96,21,184,83,161,
+77,67,26,251,57,251,27,251,26,251,58,71,75,161,184,82,30,14,247,214,248,134,
+248,32,21,105,112,113,104,106,166,112,172,173,166,166,173,172,112,166,106,
+31,143,247,192,98,10,131,79,21,247,63,247,27,251,24,251,61,251,57,251,28,
+251,26,251,58,251,59,251,27,247,26,247,56,247,57,247,27,247,29,247,55,31,
+14,247,214,247,73,22,205,247,137,248,198,206,252,198,247,136,73,6,14,247,
+214,249,189,248,192,21,73,251,136,252,198,72,248,198,251,137,205,6,14,247,
+214,248,98,22,206,248,201,247,131,206,252,182,72,247,132,6,14,247,214,247,
+108,248,218,21,247,137,252,218,5,207,6,247,142,248,218,5,65,6,251,102,252,
+128,251,99,248,128,5,67,253,107,21,248,195,205,252,195,6,14,247,214,250,122,
+247,174,21,88,6,251,49,251,7,105,70,61,31,38,45,109,51,140,251,88,8,88,201,
+190,7,141,170,140,247,50,173,221,235,214,25,200,184,234,163,247,21,142,8,
+190,6,14,247,214,137,247,174,21,76,190,7,247,8,137,230,118,198,102,8,247,
+0,67,180,49,251,57,26,141,108,5,88,202,190,7,140,247,86,108,228,38,234,8,
+208,61,251,6,173,251,49,27,14,247,214,137,247,111,21,190,6,247,48,247,7,173,
+208,217,31,240,234,170,227,138,247,86,8,190,76,88,7,137,108,138,251,50,105,
+58,43,64,25,80,94,41,114,251,19,137,8,88,6,14,247,214,250,122,247,111,21,
+202,88,7,251,6,141,43,160,82,176,8,251,0,212,98,227,247,57,26,137,170,5,190,
+77,88,7,138,251,88,170,52,239,45,8,70,217,247,7,105,247,49,27,14,184,248,
+234,176,21,251,130,248,107,251,130,252,107,5,248,15,198,21,251,175,6,247,
+35,247,176,5,14,184,247,19,170,21,248,102,247,133,252,102,247,132,5,201,252,
+14,21,247,173,7,247,179,251,35,5,14,184,247,14,248,143,21,247,130,252,107,
+247,130,248,107,5,252,15,80,21,247,175,6,251,35,251,176,5,14,184,248,229,
+170,21,248,117,7,252,102,251,132,5,248,40,251,30,21,251,179,247,30,247,179,
+247,35,5,14,247,214,247,133,247,223,21,247,157,251,184,247,153,247,182,251,
+159,247,186,5,14,247,214,247,82,247,224,21,247,202,251,235,247,203,247,236,
+251,203,247,235,5,251,157,251,235,21,247,157,247,184,247,157,251,184,251,
+157,251,185,5,14,251,68,247,139,248,99,21,35,53,54,37,251,0,223,54,246,243,
+224,224,244,244,54,224,34,31,140,81,21,211,198,80,66,67,80,79,68,63,81,198,
+215,209,200,198,211,31,14,184,247,111,251,47,21,247,174,194,43,249,220,235,
+194,251,174,6,191,254,19,21,249,220,221,253,220,7,14,184,248,137,251,47,21,
+250,74,251,174,84,236,253,220,42,84,7,247,122,194,21,58,249,220,220,6,14,
+116,162,248,160,154,247,82,151,6,220,10,232,11,182,142,146,143,143,146,144,
+144,142,149,149,142,12,12,180,151,145,143,144,147,142,143,144,144,149,204,
+12,13,248,192,20,249,54,21,188,19,0,204,2,0,1,0,6,0,37,0,42,0,54,0,143,0,
+228,1,32,1,37,1,50,1,93,1,98,1,106,1,234,1,237,1,242,2,90,2,102,2,106,2,206,
+2,237,2,241,2,253,3,2,3,12,3,36,3,64,3,92,3,97,3,119,3,158,3,228,4,33,4,41,
+4,107,4,112,4,119,4,123,4,182,4,239,4,244,5,40,5,59,5,69,5,84,5,134,5,149,
+5,174,5,205,5,212,6,1,6,44,6,59,6,62,6,66,6,76,6,118,6,149,6,161,6,166,6,
+169,6,206,6,243,6,250,7,3,7,13,7,21,7,56,7,65,7,69,7,78,7,111,7,142,7,152,
+7,159,7,178,7,189,7,210,7,240,8,7,8,26,8,39,8,49,8,53,8,77,8,84,8,111,8,126,
+8,133,8,144,8,149,8,173,8,188,8,193,8,198,8,221,8,235,9,3,9,17,9,23,9,46,
+9,69,9,74,9,87,9,109,9,130,9,135,9,148,9,166,9,187,9,193,9,213,9,233,9,253,
+10,17,10,23,10,36,10,55,10,66,10,83,10,94,10,112,10,130,10,148,10,164,10,
+181,10,198,10,209,10,216,10,224,10,239,10,245,10,254,11,3,11,17,11,24,11,
+39,11,54,11,62,11,69,11,83,11,97,11,106,11,113,11,125,11,138,11,148,11,161,
+11,174,11,180,11,193,11,200,11,211,11,222,11,230,11,238,11,244,12,0,12,12,
+12,24,12,30,12,35,12,47,12,59,12,69,12,79,12,83,12,89,12,95,12,106,12,115,
+12,126,12,137,12,146,12,157,12,162,12,173,12,182,12,189,12,196,12,203,12,
+208,12,212,12,222,12,232,12,242,12,252,13,6,13,16,13,24,13,28,13,37,13,46,
+13,55,13,64,13,73,13,82,13,91,13,100,13,109,13,116,13,122,13,128,13,134,13,
+139,248,25,42,10,11,248,232,248,151,21,189,136,153,123,173,30,223,99,54,183,
+251,15,67,29,247,3,27,226,193,10,229,83,205,78,10,11,248,110,89,10,11,248,
+74,248,14,21,242,138,71,197,56,10,11,249,89,248,21,21,251,196,57,247,114,
+119,6,251,22,43,45,251,25,65,72,166,186,96,30,91,191,110,226,229,26,247,71,
+241,247,10,247,46,247,3,219,82,45,159,30,234,6,247,40,113,251,4,224,251,59,
+27,50,67,116,92,82,31,54,69,92,251,5,251,23,26,251,116,247,29,251,48,247,
+89,238,217,176,218,211,30,162,42,5,198,6,11,247,78,247,206,21,247,132,6,222,
+176,99,49,31,138,74,5,94,147,95,152,109,30,247,5,162,6,104,163,132,165,137,
+236,138,247,12,120,175,60,173,8,221,180,172,188,223,26,247,18,61,208,251,
+36,30,251,228,253,109,232,6,248,32,4,247,143,247,117,7,191,169,131,119,162,
+31,164,118,152,106,96,26,52,95,100,40,30,11,248,24,135,29,251,37,252,44,251,
+26,248,44,5,50,6,247,69,252,162,107,56,5,102,125,121,125,104,27,125,127,141,
+143,121,31,64,7,130,156,156,135,161,27,166,168,148,155,161,31,165,158,154,
+161,155,181,247,125,249,14,24,11,247,75,130,29,11,190,29,7,199,137,178,186,
+140,215,8,242,7,14,248,190,22,247,46,248,160,5,45,6,35,252,44,36,248,44,5,
+37,6,39,252,44,32,248,44,5,47,6,247,44,252,160,5,233,6,240,248,47,245,252,
+47,5,11,249,121,61,10,11,233,29,247,54,242,233,29,14,21,171,94,83,168,120,
+27,129,132,131,129,132,141,135,148,131,31,198,90,160,112,196,44,8,122,148,
+142,137,149,27,146,144,145,160,151,31,181,212,173,183,185,178,8,156,153,142,
+143,147,26,149,132,147,130,121,64,102,115,109,30,248,62,7,112,172,210,103,
+159,27,147,146,147,149,147,136,142,122,154,31,92,179,106,181,97,213,8,159,
+128,133,146,132,27,131,134,135,131,134,31,84,45,115,108,88,95,8,118,121,138,
+138,130,26,129,146,131,148,145,171,151,147,155,30,160,150,157,150,167,160,
+8,14,173,29,14,94,10,220,208,10,22,247,180,221,6,78,175,110,164,111,177,8,
+99,193,117,216,221,26,247,55,231,241,247,39,247,38,231,37,251,55,57,117,62,
+99,85,30,111,101,110,114,78,103,8,57,247,180,221,251,85,7,200,175,166,162,
+167,178,8,180,195,160,212,225,26,229,116,216,96,195,30,216,78,41,185,32,27,
+46,52,104,76,77,31,80,80,109,55,34,26,53,160,66,180,83,30,167,100,166,116,
+200,103,8,251,85,6,11,21,114,131,128,107,29,152,136,129,164,165,29,208,99,
+29,11,169,158,21,178,103,216,223,5,78,205,217,110,236,27,247,102,247,34,247,
+45,247,120,242,109,232,85,207,31,228,236,99,175,52,44,5,193,77,62,166,48,
+27,251,102,251,34,251,45,251,120,42,164,54,190,69,31,202,207,21,108,192,124,
+200,209,26,247,71,243,247,12,247,47,204,197,118,96,187,30,174,98,21,174,85,
+157,72,64,26,251,71,35,251,12,251,47,68,78,164,188,90,30,11,218,83,29,232,
+251,206,21,247,124,247,72,162,29,109,218,10,251,72,251,225,21,247,143,247,
+119,7,221,188,92,231,10,21,42,183,29,214,29,59,235,5,75,6,236,251,42,5,14,
+252,121,56,29,11,247,150,47,29,247,170,207,60,10,11,84,29,251,13,143,207,
+81,247,29,27,247,24,223,204,240,217,95,182,35,164,31,143,10,11,248,79,135,
+29,252,27,66,247,184,6,251,205,252,12,5,64,248,62,212,251,217,7,247,203,248,
+13,5,11,220,22,223,187,6,247,122,247,202,5,251,250,223,248,160,55,95,7,251,
+122,251,199,5,247,243,55,7,11,248,112,60,29,11,21,52,221,6,174,158,157,178,
+146,142,139,138,158,30,144,10,222,248,92,226,7,11,21,251,101,251,34,251,46,
+251,120,145,29,247,11,202,10,57,4,247,50,241,251,11,251,77,251,68,34,251,
+12,251,46,251,48,203,10,247,47,31,11,21,251,103,251,63,251,63,251,103,251,
+100,247,64,251,66,247,97,247,109,247,62,247,61,247,106,247,102,251,63,247,
+63,251,103,31,77,4,247,65,247,33,251,35,251,68,251,71,251,32,251,34,251,70,
+251,61,251,33,247,38,247,66,247,69,247,33,247,35,247,65,31,14,228,247,231,
+21,251,231,247,174,7,247,76,247,4,208,29,251,76,31,251,174,251,215,70,72,
+6,247,54,22,247,63,206,251,63,247,133,247,65,6,209,196,114,91,176,31,177,
+90,156,74,44,26,251,78,63,42,251,35,30,251,65,6,14,109,29,108,161,183,134,
+31,14,21,86,109,117,123,100,27,113,125,143,162,82,31,165,74,106,149,114,27,
+104,107,121,105,113,31,127,123,132,129,115,101,176,103,24,194,169,165,160,
+179,27,161,165,132,117,197,31,107,222,145,137,166,27,169,168,154,166,161,
+31,152,155,141,141,173,188,8,11,21,251,5,156,29,248,26,248,160,70,10,11,250,
+38,43,10,80,166,30,190,167,164,178,189,26,223,65,204,42,81,89,117,101,107,
+30,118,113,122,93,107,26,116,226,162,7,189,177,176,191,189,174,105,92,122,
+133,122,129,129,30,121,121,106,126,114,27,104,65,174,6,201,180,103,85,84,
+11,21,251,36,252,44,251,27,248,44,5,50,6,247,69,252,160,107,54,5,100,125,
+121,125,105,27,124,126,141,145,122,31,62,7,131,156,156,136,160,27,167,167,
+148,155,162,31,164,158,154,161,155,181,247,126,249,14,24,11,214,29,58,209,
+29,248,104,247,106,21,251,106,248,118,221,252,25,247,142,247,244,221,251,
+244,247,125,248,7,221,253,2,7,251,191,221,10,242,6,224,247,106,5,247,161,
+221,21,251,130,6,247,30,247,243,5,239,6,11,216,22,233,222,6,248,13,192,29,
+252,13,252,64,5,248,146,45,7,11,21,43,152,29,200,22,43,152,29,14,151,133,
+5,144,124,10,111,201,163,133,204,10,131,197,29,176,133,218,130,232,30,135,
+181,137,161,151,26,157,145,149,151,145,142,138,128,149,30,129,149,151,134,
+152,27,166,160,161,167,169,111,163,104,96,108,108,81,125,31,123,75,134,70,
+251,69,26,11,248,56,21,247,201,45,253,109,129,10,57,21,114,29,11,40,166,30,
+251,75,188,5,51,163,107,167,195,26,213,204,188,237,247,8,204,87,43,140,30,
+11,209,211,29,247,181,7,202,152,178,169,171,30,167,166,174,154,176,27,204,
+181,99,76,31,252,217,223,248,250,127,10,11,21,140,10,206,22,134,29,248,10,
+21,247,138,247,247,5,251,3,6,251,80,251,178,251,79,247,178,5,251,5,6,247,
+134,251,247,251,150,252,10,5,247,5,6,247,92,247,196,247,91,251,196,5,11,114,
+10,252,149,7,81,133,106,122,114,30,111,121,105,122,102,27,69,100,186,224,
+31,186,44,75,7,251,10,217,64,247,17,247,19,218,218,247,18,30,248,183,7,11,
+181,29,234,6,135,10,251,34,192,251,13,230,75,30,11,87,29,14,249,120,42,29,
+247,69,135,29,56,252,160,222,6,11,227,6,191,181,170,200,166,31,247,169,249,
+17,5,251,2,6,251,80,252,98,251,91,248,98,5,251,4,6,247,157,252,209,115,78,
+125,128,91,137,25,83,6,11,55,251,148,6,125,96,101,133,101,27,73,105,167,193,
+31,247,86,55,251,105,189,29,200,27,186,180,148,159,185,31,14,247,111,21,214,
+251,111,5,243,6,106,29,11,248,216,142,10,11,198,10,14,22,247,97,248,247,5,
+252,247,227,249,109,251,21,7,251,104,253,15,251,108,249,15,5,251,21,253,109,
+227,248,247,6,247,99,252,247,5,14,247,33,114,10,56,253,109,222,247,96,6,220,
+219,247,69,251,176,5,242,6,251,106,247,235,247,74,247,73,5,32,6,251,114,251,
+114,5,11,199,29,203,6,218,235,11,107,10,175,196,182,110,163,88,11,21,140,
+159,10,147,31,80,171,10,14,139,10,81,6,97,134,184,10,21,251,94,251,54,251,
+53,251,93,251,88,247,54,251,55,247,89,247,89,247,56,247,55,247,88,247,88,
+251,55,247,58,251,85,31,11,176,190,10,237,232,29,160,29,11,247,227,106,10,
+129,29,247,173,234,10,232,7,11,247,71,21,111,131,122,114,116,30,108,105,98,
+123,90,27,74,101,170,192,194,175,167,229,152,31,228,151,156,143,167,152,8,
+11,102,73,128,31,196,6,162,146,151,152,153,27,151,152,136,129,163,31,117,
+198,146,137,158,27,189,169,174,208,149,31,14,247,246,249,27,21,206,10,232,
+6,11,216,10,223,6,138,10,11,173,29,231,251,43,21,47,36,231,6,251,66,242,21,
+47,36,231,6,14,139,29,99,5,112,201,163,132,212,10,11,119,8,102,166,183,119,
+196,203,29,135,106,115,85,27,82,109,161,183,134,31,14,252,89,6,141,251,12,
+96,71,58,133,8,57,155,7,198,137,181,161,183,197,175,187,155,196,142,234,8,
+248,5,11,30,225,105,59,227,10,251,65,251,65,229,34,247,40,247,12,222,207,
+247,6,160,31,11,248,175,21,251,40,51,34,251,68,179,10,247,74,53,242,251,44,
+31,11,233,247,237,204,170,10,243,6,251,144,166,29,11,186,29,202,162,197,10,
+174,197,184,29,249,109,21,11,22,223,247,237,6,210,185,194,178,195,27,193,
+178,98,83,31,251,250,223,247,250,210,29,11,151,132,5,145,132,29,11,91,26,
+100,160,113,181,123,30,131,161,164,134,161,27,158,172,144,144,163,31,184,
+7,132,120,119,136,11,93,224,61,168,10,247,13,191,84,251,22,251,22,87,11,151,
+146,141,151,120,10,11,27,168,156,125,116,113,116,120,108,113,11,247,86,105,
+29,11,252,125,247,99,5,60,7,248,30,251,56,252,30,251,53,5,60,7,248,125,247,
+99,5,14,6,196,184,179,29,58,216,251,36,30,251,193,253,109,11,132,29,99,5,
+11,248,187,133,29,11,21,35,199,121,7,70,126,119,92,137,30,101,7,205,137,178,
+187,224,26,247,12,7,14,7,226,74,195,38,61,89,109,66,93,30,227,7,11,6,33,247,
+93,5,42,6,247,16,251,130,251,59,251,178,5,237,6,247,40,247,141,5,11,180,10,
+92,176,31,172,99,93,152,65,27,251,111,11,248,113,21,141,29,11,21,251,46,247,
+13,5,56,7,247,0,56,251,0,56,5,56,7,247,46,247,14,5,11,251,216,6,137,75,105,
+87,91,129,8,65,7,244,144,204,224,137,247,19,8,247,125,11,247,119,140,29,11,
+8,79,109,77,105,61,27,251,37,47,247,8,11,247,52,110,47,217,251,52,27,41,60,
+108,79,85,31,73,67,103,35,251,10,26,11,249,26,114,10,51,252,232,6,252,17,
+248,232,5,38,253,109,227,248,227,6,11,247,78,105,29,14,135,190,128,172,119,
+204,29,48,251,4,251,66,11,21,141,100,144,120,153,119,8,102,166,184,119,195,
+27,232,234,29,11,35,187,7,140,81,125,112,104,134,8,101,7,199,143,172,186,
+219,26,240,7,11,223,252,12,163,10,14,21,251,188,201,248,61,96,7,122,75,125,
+128,67,132,124,138,24,93,7,11,59,158,5,71,155,110,161,176,26,188,182,169,
+207,206,175,110,84,141,30,11,208,7,143,120,128,140,122,27,62,93,95,64,31,
+50,69,71,209,252,92,11,112,30,90,115,115,104,92,26,61,197,85,224,223,198,
+193,217,186,115,174,11,247,106,247,223,91,10,21,102,109,110,103,102,168,110,
+176,175,225,29,11,21,169,164,114,109,109,114,114,109,109,114,164,170,168,
+165,164,168,31,11,120,10,121,145,162,94,31,130,143,118,11,249,27,21,248,9,
+253,27,233,249,109,252,197,253,109,233,6,14,125,96,97,68,27,47,84,214,247,
+16,11,141,118,27,95,108,102,73,128,31,197,6,162,145,151,152,154,27,11,21,
+77,247,172,7,222,174,146,164,177,31,204,182,172,212,238,26,11,247,224,21,
+248,33,221,252,33,247,125,248,48,221,252,141,253,109,11,30,247,42,247,8,213,
+251,8,209,55,69,36,65,242,7,14,247,165,6,85,183,188,115,207,27,247,28,227,
+247,1,247,59,11,188,21,137,130,135,139,134,27,110,123,154,165,31,247,200,
+7,11,251,3,7,166,251,26,5,178,223,29,11,182,29,231,191,185,228,11,247,143,
+6,195,29,247,102,11,45,251,207,252,10,247,207,46,253,109,233,247,224,7,14,
+247,178,21,176,29,11,214,10,86,86,108,109,86,31,11,248,160,173,10,11,58,48,
+50,82,219,247,15,247,15,196,219,228,31,14,21,114,131,127,200,29,11,252,44,
+251,32,248,44,5,50,6,247,79,252,160,5,11,172,30,153,105,112,143,70,27,251,
+172,77,247,183,6,11,135,29,55,252,160,223,6,11,6,247,117,251,237,5,11,6,97,
+134,106,115,86,27,82,108,161,183,134,31,11,8,178,6,115,200,108,188,107,172,
+8,248,248,6,11,21,56,252,160,222,6,185,29,11,115,218,29,146,177,168,11,250,
+125,247,204,21,254,134,67,250,134,6,14,6,161,247,115,5,251,179,4,55,35,223,
+6,11,198,29,233,249,27,247,252,221,7,11,30,143,97,141,117,127,26,121,133,
+129,127,133,11,251,69,227,35,247,41,247,40,228,244,247,64,11,247,211,7,219,
+10,11,81,59,51,47,78,220,247,14,247,14,200,220,11,251,32,248,61,222,10,11,
+7,228,192,91,59,59,86,91,50,31,14,106,115,86,27,81,109,161,183,134,31,14,
+21,251,166,69,247,166,6,11,43,6,131,89,129,105,124,11,208,235,10,55,6,11,
+6,101,251,103,5,215,6,178,247,103,5,11,136,127,128,138,122,27,103,129,149,
+176,31,11,22,223,247,141,242,6,247,40,251,141,5,11,226,10,210,252,32,11,249,
+53,215,29,11,210,159,175,186,31,188,178,170,204,202,26,11,224,73,206,55,31,
+79,4,190,179,99,88,11,6,247,41,247,40,5,251,5,6,14,55,252,86,251,111,248,
+86,55,6,14,133,212,10,11,21,35,35,243,6,11,251,58,233,247,140,11,6,231,193,
+91,59,59,85,91,47,31,11,212,29,247,125,213,251,209,6,11,26,247,127,251,31,
+247,45,251,106,30,11,36,247,12,247,72,247,72,242,247,12,11,212,10,175,196,
+182,110,163,88,11,64,215,43,31,69,4,196,184,94,82,11,228,10,253,27,11,110,
+110,102,103,169,110,176,174,168,169,11,43,5,202,6,43,247,42,5,14,6,248,27,
+4,247,148,11,136,114,27,92,114,158,11,251,93,5,36,247,93,11,178,27,215,186,
+11,249,89,21,11,21,247,58,247,56,7,192,170,109,11,21,236,146,198,202,223,
+27,224,198,11,193,217,230,209,183,98,66,149,31,11,247,130,5,41,6,34,251,93,
+5,11,113,119,30,120,114,110,132,87,27,11,247,35,221,216,247,25,211,115,194,
+11,21,252,236,89,248,236,6,14,253,109,5,11,5,45,6,247,76,252,160,5,11,145,
+246,195,189,247,1,137,8,11,165,131,124,159,30,163,121,149,11,170,170,197,
+153,31,155,203,144,11,53,247,36,56,251,36,68,71,11,191,41,27,251,38,45,251,
+3,11,247,131,221,252,208,57,247,132,11,223,247,221,7,215,194,200,207,11,231,
+6,35,247,163,5,55,22,11,60,61,90,92,57,31,14,251,52,223,247,126,11,247,224,
+21,251,224,11,252,79,5,251,178,11,22,223,248,160,11,};
+#endif
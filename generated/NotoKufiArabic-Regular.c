@@ -0,0 +1,2553 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoKufiArabic_Regular_ttf_size = 62996;
+asm(".section .rodata");
+asm(".global fz_font_NotoKufiArabic_Regular_ttf");
+asm(".type fz_font_NotoKufiArabic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoKufiArabic_Regular_ttf, 62996");
+asm(".balign 64");
+asm("fz_font_NotoKufiArabic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoKufiArabic-Regular.ttf\"");
+#else
+const int fz_font_NotoKufiArabic_Regular_ttf_size = 62996;
+const char fz_font_NotoKufiArabic_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,43,222,45,152,0,0,202,196,0,0,0,186,
+71,80,79,83,133,120,190,182,0,0,203,128,0,0,25,192,71,83,85,66,230,42,248,
+34,0,0,229,64,0,0,16,212,79,83,47,50,164,21,109,86,0,0,1,104,0,0,0,96,99,
+109,97,112,49,25,47,194,0,0,13,168,0,0,4,182,103,97,115,112,0,7,0,7,0,0,202,
+184,0,0,0,12,103,108,121,102,18,53,239,140,0,0,24,88,0,0,132,24,104,101,97,
+100,5,13,81,8,0,0,0,236,0,0,0,54,104,104,101,97,20,140,8,175,0,0,1,36,0,0,
+0,36,104,109,116,120,73,99,62,151,0,0,1,200,0,0,11,224,108,111,99,97,151,
+5,119,19,0,0,18,96,0,0,5,246,109,97,120,112,3,21,1,1,0,0,1,72,0,0,0,32,110,
+97,109,101,140,56,184,54,0,0,156,112,0,0,6,0,112,111,115,116,99,243,13,123,
+0,0,162,112,0,0,40,72,0,1,0,0,0,1,10,61,143,229,8,32,95,15,60,245,0,11,8,
+0,0,0,0,0,201,30,121,22,0,0,0,0,210,135,130,237,254,33,251,157,12,39,10,45,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,10,65,251,20,0,0,12,213,254,33,253,207,12,
+39,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,246,0,1,0,0,2,250,0,131,0,16,0,124,0,
+7,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,5,32,1,144,0,5,0,0,5,154,5,51,0,
+0,1,31,5,154,5,51,0,0,3,209,0,102,3,92,0,0,2,11,5,6,3,8,4,2,2,4,0,0,32,0,
+0,0,0,0,0,0,0,8,0,0,0,0,71,79,79,71,0,64,0,0,254,255,10,45,251,157,0,0,10,
+65,4,236,0,0,0,1,0,0,0,0,7,31,10,45,0,0,0,32,0,4,4,205,0,102,0,0,0,0,2,90,
+0,0,2,184,0,0,3,236,0,133,2,80,0,205,2,135,0,205,5,39,0,92,4,164,255,236,
+4,152,255,236,4,233,0,92,4,18,0,92,2,154,255,174,2,223,255,174,9,240,0,133,
+7,6,255,236,7,96,255,236,10,74,0,133,9,88,0,133,6,68,255,236,6,174,255,236,
+9,199,0,133,6,109,0,41,6,47,255,236,6,174,255,236,6,195,0,61,4,72,0,133,4,
+31,255,236,4,193,255,236,4,233,0,133,4,156,255,236,5,2,255,236,6,88,0,133,
+6,145,0,133,5,127,0,133,2,135,255,236,2,186,255,236,5,137,0,133,5,49,0,133,
+4,152,255,236,4,217,255,236,5,115,0,133,4,199,0,133,6,53,255,236,6,135,255,
+236,4,203,0,133,4,125,0,133,4,109,0,133,6,182,0,133,7,182,0,133,5,100,0,92,
+5,172,0,92,1,94,255,236,6,57,0,133,6,145,0,133,4,174,255,236,4,207,255,236,
+8,25,0,133,8,66,0,133,7,2,0,133,7,43,0,133,0,0,255,141,0,0,254,217,0,0,254,
+221,0,0,254,221,2,162,0,205,2,80,0,205,3,213,0,92,4,182,0,92,3,217,0,174,
+4,199,0,133,3,254,0,0,4,57,0,41,4,57,0,41,4,92,0,61,4,129,0,92,4,199,0,133,
+3,244,0,133,2,125,255,236,4,145,255,236,6,115,0,133,4,158,0,92,3,27,0,92,
+6,119,0,133,6,221,0,133,6,119,0,133,4,156,255,236,5,2,255,236,6,221,0,133,
+5,96,0,133,5,137,0,133,4,150,0,102,3,225,0,133,2,68,0,133,2,92,0,133,2,68,
+0,133,2,68,0,133,4,102,0,82,0,0,255,16,0,0,255,16,0,0,255,16,0,0,254,211,
+0,0,254,145,0,0,255,16,0,0,254,186,0,0,255,31,0,0,254,209,0,0,255,53,0,0,
+255,53,0,0,255,197,0,0,255,197,0,0,255,18,4,141,0,92,0,0,254,246,2,104,255,
+236,2,186,255,236,2,254,255,236,3,33,255,236,5,55,0,102,5,39,0,92,4,233,0,
+92,0,0,255,141,0,0,254,217,2,80,0,205,2,135,0,205,2,80,0,90,2,135,0,90,2,
+80,0,104,2,135,0,104,2,80,255,238,2,135,255,238,2,80,0,27,2,135,0,27,6,57,
+0,133,2,104,255,236,2,186,255,236,6,145,0,133,6,57,0,133,6,145,0,133,2,254,
+255,236,3,33,255,236,6,57,0,133,2,254,255,236,3,33,255,236,6,145,0,133,6,
+57,0,133,2,254,255,236,3,33,255,236,6,145,0,133,6,57,0,133,2,254,255,236,
+3,33,255,236,6,145,0,133,4,199,0,133,4,203,0,133,4,164,255,236,4,152,255,
+236,5,39,0,92,4,164,255,236,4,152,255,236,4,233,0,92,5,39,0,92,4,164,255,
+236,4,152,255,236,4,233,0,92,4,18,0,92,4,141,0,92,4,18,0,92,4,141,0,92,2,
+154,255,174,2,223,255,174,2,154,255,174,2,223,255,174,2,154,255,174,2,223,
+255,174,9,240,0,133,7,6,255,236,7,96,255,236,10,74,0,133,9,88,0,133,6,68,
+255,236,6,174,255,236,9,199,0,133,6,109,0,41,6,47,255,236,6,174,255,236,6,
+195,0,61,4,72,0,133,4,31,255,236,4,193,255,236,4,233,0,133,4,156,255,236,
+5,2,255,236,8,25,0,133,4,174,255,236,4,207,255,236,8,66,0,133,8,25,0,133,
+4,174,255,236,4,207,255,236,8,66,0,133,4,174,255,236,4,207,255,236,7,2,0,
+133,7,43,0,133,2,104,255,236,2,186,255,236,5,96,0,133,5,137,0,133,4,199,0,
+133,4,199,0,133,4,203,0,133,4,125,0,133,4,109,0,133,2,104,255,236,2,186,255,
+236,2,254,255,236,3,33,255,236,6,182,0,133,7,182,0,133,6,182,0,133,2,254,
+255,236,3,33,255,236,7,182,0,133,4,158,0,92,3,27,0,92,6,182,0,133,2,254,255,
+236,3,33,255,236,7,182,0,133,5,100,0,92,5,172,0,92,5,100,0,92,5,172,0,92,
+5,100,0,45,5,172,0,45,5,100,0,90,5,172,0,90,4,203,0,133,4,199,0,133,5,55,
+0,102,4,199,0,133,4,199,0,133,5,55,0,102,6,197,0,133,6,53,255,236,6,135,255,
+236,2,162,0,205,2,80,0,205,3,213,0,92,4,182,0,92,4,92,0,61,4,57,0,41,4,57,
+0,41,4,74,0,92,3,213,0,72,0,0,255,16,0,0,254,145,0,0,255,16,0,0,255,16,0,
+0,254,211,0,0,255,16,0,0,254,186,0,0,255,31,0,0,255,2,0,0,254,145,0,0,254,
+186,0,0,254,144,0,0,254,179,0,0,254,186,0,0,254,186,0,0,254,186,0,0,255,16,
+0,0,255,16,0,0,254,145,0,0,254,211,0,0,255,31,0,0,255,16,0,0,255,16,2,80,
+255,180,2,135,255,180,2,80,255,188,2,135,255,188,2,80,0,205,2,135,0,205,4,
+125,0,133,4,109,0,133,4,125,255,244,4,109,255,244,6,182,0,133,7,182,0,133,
+6,57,0,133,6,145,0,133,2,104,255,236,3,33,255,236,6,57,0,133,6,145,0,133,
+2,104,255,236,2,186,255,236,6,57,0,133,6,145,0,133,2,254,255,236,3,33,255,
+236,6,57,0,133,6,145,0,133,2,254,255,236,3,33,255,236,6,57,0,133,6,145,0,
+133,2,254,255,236,3,33,255,236,6,57,0,133,6,145,0,133,2,254,255,236,3,33,
+255,236,5,39,0,92,4,233,0,92,4,164,255,236,4,152,255,236,5,39,0,92,4,233,
+0,92,4,164,255,236,4,152,255,236,5,39,0,92,4,233,0,92,4,164,255,236,4,152,
+255,236,5,39,0,92,4,233,0,92,4,164,255,236,4,152,255,236,5,39,0,92,4,233,
+0,92,4,164,255,236,4,152,255,236,5,39,0,92,4,233,0,92,4,164,255,236,4,152,
+255,236,4,18,0,92,4,141,0,92,4,18,0,92,4,141,0,92,4,18,0,92,4,141,0,92,4,
+18,0,72,4,141,0,72,4,18,0,92,4,141,0,92,4,18,0,71,4,141,0,71,4,18,0,76,4,
+141,0,76,4,18,0,92,4,141,0,92,2,154,255,174,2,223,255,174,2,154,255,174,2,
+223,255,174,2,154,255,174,2,223,255,174,2,154,255,174,2,223,255,174,2,154,
+255,174,2,223,255,174,2,154,255,174,2,223,255,174,2,154,255,174,2,223,255,
+174,9,240,0,133,10,74,0,133,7,6,255,236,7,96,255,236,9,240,0,133,10,74,0,
+133,7,6,255,236,7,96,255,236,9,240,0,133,10,74,0,133,7,6,255,236,7,96,255,
+236,9,88,0,133,9,199,0,133,6,68,255,236,6,174,255,236,9,88,0,133,9,199,0,
+133,6,68,255,236,6,174,255,236,6,109,0,41,6,195,0,61,4,72,0,133,4,233,0,133,
+4,31,255,236,4,193,255,236,8,25,0,133,8,25,0,133,8,66,0,133,4,174,255,236,
+4,207,255,236,8,25,0,133,8,66,0,133,4,174,255,236,4,207,255,236,8,66,0,133,
+4,174,255,236,4,207,255,236,8,25,0,133,8,66,0,133,4,174,255,236,4,207,255,
+236,8,25,0,133,8,66,0,133,4,174,255,236,4,207,255,236,7,2,0,133,7,43,0,133,
+7,2,0,133,7,43,0,133,9,16,0,41,9,88,0,41,8,29,255,236,8,115,255,236,6,119,
+0,133,6,221,0,133,4,156,255,236,5,2,255,236,6,88,0,133,6,145,0,133,4,156,
+255,236,5,2,255,236,6,88,0,133,6,145,0,133,4,156,255,236,5,2,255,236,6,88,
+0,133,6,145,0,133,4,156,255,236,5,2,255,236,6,119,0,133,6,221,0,133,4,156,
+255,236,5,2,255,236,6,119,0,133,6,221,0,133,4,156,255,236,5,2,255,236,6,119,
+0,133,6,221,0,133,4,156,255,236,5,2,255,236,6,119,0,133,6,221,0,133,4,156,
+255,236,5,2,255,236,6,119,0,133,6,221,0,133,4,156,255,236,5,2,255,236,5,127,
+0,133,5,137,0,133,2,135,255,236,2,186,255,236,5,127,0,133,5,137,0,133,2,135,
+255,236,2,186,255,236,5,127,0,133,5,137,0,133,2,135,255,236,2,186,255,236,
+5,127,0,133,5,137,0,133,2,135,255,236,2,186,255,236,5,96,0,133,5,137,0,133,
+2,104,255,236,2,186,255,236,5,96,0,133,5,137,0,133,5,96,0,133,5,137,0,133,
+2,104,255,236,2,186,255,236,5,96,0,133,5,137,0,133,5,39,0,92,4,233,0,92,4,
+164,255,236,4,152,255,236,4,125,0,145,4,109,0,145,4,125,0,145,7,170,0,41,
+8,170,0,41,0,0,254,51,0,0,254,113,0,0,255,47,0,0,255,45,0,0,255,74,0,0,255,
+53,0,0,254,115,0,0,255,141,0,0,255,35,0,0,255,59,0,0,254,115,0,0,255,129,
+1,164,0,41,2,76,0,41,0,0,254,209,0,0,255,61,0,0,255,88,0,0,255,88,0,0,255,
+59,9,88,0,133,9,199,0,133,6,68,255,236,6,174,255,236,4,72,0,133,4,233,0,133,
+4,31,255,236,4,193,255,236,3,236,0,133,5,49,0,133,6,119,0,133,6,221,0,133,
+5,100,255,225,5,172,255,225,5,100,0,92,5,172,0,92,5,100,0,92,5,172,0,92,5,
+100,0,92,5,172,0,92,5,100,0,92,5,172,0,92,5,100,0,92,5,172,0,92,5,100,0,92,
+5,172,0,92,7,68,0,70,12,37,0,84,9,88,0,92,7,47,0,41,9,88,0,92,5,29,0,133,
+0,0,255,20,0,0,255,57,0,0,254,182,0,0,254,195,0,0,254,225,0,0,255,152,0,0,
+255,133,4,18,0,88,4,141,0,88,2,154,255,174,2,223,255,174,6,207,0,134,6,197,
+0,133,6,53,255,236,6,135,255,236,12,141,0,133,12,213,0,133,4,174,255,236,
+2,154,0,41,0,0,255,43,0,0,254,223,0,0,254,242,0,0,255,141,0,0,254,211,0,0,
+255,2,7,211,0,133,8,43,0,133,4,207,255,236,4,207,255,236,6,57,0,133,6,145,
+0,133,2,254,255,236,3,33,255,236,6,57,0,133,6,145,0,133,2,254,255,236,3,33,
+255,236,6,57,0,133,6,145,0,133,2,254,255,236,3,33,255,236,6,57,0,133,6,145,
+0,133,2,254,255,236,3,33,255,236,6,57,0,133,6,145,0,133,2,254,255,236,3,33,
+255,236,6,57,0,133,6,145,0,133,2,254,255,236,3,33,255,236,5,39,0,92,4,233,
+0,92,4,164,255,236,4,152,255,236,5,39,0,92,4,233,0,92,4,164,255,236,4,152,
+255,236,4,18,0,92,4,141,0,92,4,18,0,92,4,141,0,92,2,154,0,70,2,223,0,29,9,
+240,0,133,10,74,0,133,7,6,255,236,7,96,255,236,4,72,0,133,4,233,0,133,4,31,
+255,236,4,193,255,236,4,72,0,133,4,233,0,133,4,31,255,236,4,193,255,236,4,
+72,0,133,4,233,0,133,4,31,255,236,4,193,255,236,8,25,0,133,8,66,0,133,4,174,
+255,236,4,207,255,236,8,25,0,133,8,66,0,133,4,174,255,236,4,207,255,236,6,
+119,0,133,6,221,0,133,4,156,255,236,5,2,255,236,6,119,0,133,6,221,0,133,4,
+156,255,236,5,2,255,236,6,119,0,133,6,221,0,133,4,156,255,236,5,2,255,236,
+5,49,0,133,5,115,0,133,4,152,255,236,4,217,255,236,5,49,0,133,5,115,0,133,
+4,152,255,236,4,217,255,236,5,96,0,133,5,137,0,133,2,254,255,236,3,33,255,
+236,5,96,0,133,5,137,0,133,2,104,255,236,2,186,255,236,5,96,0,133,5,137,0,
+133,2,104,255,236,2,186,255,236,5,127,0,133,5,137,0,133,2,135,255,236,2,186,
+255,236,2,154,255,174,2,223,255,174,2,154,255,174,2,223,255,174,9,240,0,133,
+10,74,0,133,7,6,255,236,7,96,255,236,0,0,255,49,0,0,255,49,0,0,255,141,0,
+0,255,141,0,0,255,176,0,0,255,176,0,0,255,53,0,0,255,53,0,0,254,246,0,0,254,
+246,0,0,254,33,0,0,254,223,0,0,254,242,0,0,255,53,0,0,254,137,0,0,254,137,
+0,0,254,219,0,0,254,219,8,25,0,133,4,125,0,145,4,125,0,133,4,109,0,133,4,
+125,0,133,4,109,0,133,4,125,0,133,4,109,0,133,4,125,0,133,4,109,0,133,4,125,
+0,133,4,109,0,133,4,125,0,133,4,109,0,133,4,125,0,133,4,109,0,133,2,254,255,
+236,3,33,255,236,6,182,0,133,7,182,0,133,6,182,0,133,7,182,0,133,2,254,255,
+236,3,33,255,236,6,182,0,133,7,182,0,133,1,94,255,236,9,240,0,133,10,74,0,
+133,7,6,255,236,7,96,255,236,5,100,0,92,5,172,0,92,8,252,0,49,8,172,0,49,
+0,0,255,158,4,205,0,49,2,150,0,84,2,188,0,0,2,154,0,41,2,154,0,41,2,154,0,
+41,1,55,0,41,1,233,0,41,4,6,0,41,2,104,0,82,2,104,0,61,5,39,0,92,4,233,0,
+92,2,213,0,0,2,51,0,90,2,51,0,141,2,51,0,102,5,39,2,119,4,193,0,102,6,47,
+255,236,6,174,255,236,0,0,0,0,255,220,255,37,255,220,254,81,0,0,0,1,0,3,0,
+1,0,0,0,12,0,4,4,170,0,0,0,84,0,64,0,5,0,20,0,0,0,13,0,32,0,160,6,3,6,21,
+6,27,6,31,6,58,6,88,6,94,6,105,6,115,6,235,6,255,7,109,32,15,37,204,251,81,
+251,89,251,109,251,125,251,149,251,159,251,177,251,233,251,255,252,99,253,
+63,253,242,253,252,254,112,254,114,254,116,254,118,254,120,254,122,254,124,
+254,126,254,252,254,255,255,255,0,0,0,0,0,13,0,32,0,160,6,0,6,11,6,27,6,30,
+6,33,6,64,6,89,6,96,6,106,6,117,6,237,7,80,32,11,37,204,251,80,251,86,251,
+102,251,122,251,136,251,158,251,164,251,230,251,252,252,94,253,62,253,242,
+253,252,254,112,254,114,254,116,254,118,254,120,254,122,254,124,254,126,254,
+128,254,255,255,255,0,1,255,245,255,227,255,99,252,29,0,0,250,67,0,0,0,0,
+0,0,251,221,249,225,0,0,0,0,0,0,0,0,226,234,221,38,5,51,5,51,0,0,0,0,0,0,
+4,187,0,0,0,0,0,0,0,0,5,171,4,64,4,55,2,144,2,143,2,142,2,141,2,140,2,139,
+2,138,2,137,0,0,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,92,0,94,0,144,0,0,
+0,0,0,188,0,206,1,186,1,222,0,0,0,0,0,0,0,0,2,16,2,30,2,36,0,0,2,60,2,86,
+2,92,2,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,86,0,0,0,0,2,52,0,
+93,2,225,2,33,2,34,2,35,2,36,2,37,2,38,2,39,0,111,2,53,0,92,0,4,0,129,0,125,
+0,212,0,127,0,226,0,5,0,133,0,153,0,141,0,145,0,157,0,7,0,161,0,11,0,165,
+0,12,0,169,0,14,0,175,0,18,0,179,0,22,0,183,0,26,0,187,0,52,0,193,0,203,0,
+32,0,34,0,38,0,207,0,42,0,46,0,48,0,218,0,98,0,102,0,99,0,100,0,101,0,103,
+0,104,0,105,0,106,0,107,0,108,0,110,2,40,2,41,0,91,0,95,0,96,0,97,0,53,0,
+59,0,109,0,131,1,23,1,25,1,27,1,29,1,31,1,33,0,149,1,35,1,39,1,43,1,47,0,
+137,1,51,1,55,1,59,1,63,1,67,1,71,1,75,0,119,1,79,0,167,1,83,1,85,1,87,1,
+89,1,91,1,93,1,95,1,97,0,171,1,99,1,101,1,103,1,105,1,107,1,109,0,173,1,111,
+1,113,1,117,1,121,1,125,1,129,1,133,1,135,1,139,1,140,1,144,2,188,1,151,1,
+155,1,159,1,161,0,83,1,163,1,167,1,171,1,175,1,179,0,85,1,183,1,187,1,191,
+1,195,1,199,1,203,1,207,1,211,1,215,1,219,0,89,1,223,1,225,1,229,0,80,1,231,
+0,210,0,241,0,239,0,242,1,235,1,237,2,190,2,192,2,194,2,196,2,198,2,200,0,
+220,1,238,2,206,2,202,2,208,2,212,0,81,0,224,2,214,0,209,1,240,1,241,1,242,
+1,243,1,244,1,245,1,246,2,221,2,222,1,247,2,223,1,248,1,249,1,250,1,251,1,
+252,1,253,1,254,1,255,2,224,2,0,2,1,2,2,2,42,2,44,0,247,0,248,0,249,0,250,
+0,75,0,76,0,77,0,252,0,253,0,251,2,215,2,3,2,7,2,11,2,12,2,46,2,60,2,64,2,
+68,2,72,2,76,2,80,2,84,2,88,2,92,2,96,2,98,2,100,2,102,2,106,2,110,2,114,
+2,118,2,122,2,126,2,130,2,134,2,138,2,142,2,146,2,150,2,154,2,158,2,162,2,
+164,2,166,0,149,0,152,0,150,0,151,0,197,0,200,0,198,0,199,0,119,0,120,0,155,
+0,156,0,167,0,168,0,173,0,174,0,171,0,172,0,83,0,84,0,191,0,192,0,85,0,88,
+0,86,0,87,0,210,0,211,0,241,0,118,0,78,0,79,0,80,0,244,0,245,0,246,0,81,0,
+82,0,224,0,225,2,210,2,211,0,214,0,215,0,220,0,223,0,221,0,222,1,9,1,10,1,
+12,1,13,1,14,1,15,0,4,0,129,0,130,0,125,0,126,0,212,0,213,0,127,0,128,0,226,
+0,229,0,227,0,228,0,5,0,6,0,133,0,136,0,134,0,135,0,153,0,154,0,141,0,144,
+0,142,0,143,0,145,0,148,0,146,0,147,0,157,0,160,0,158,0,159,0,7,0,10,0,8,
+0,9,0,161,0,164,0,162,0,163,0,11,0,112,0,165,0,166,0,12,0,13,0,169,0,170,
+0,14,0,17,0,15,0,16,0,175,0,178,0,176,0,177,0,18,0,21,0,19,0,20,0,179,0,182,
+0,180,0,181,0,22,0,25,0,23,0,24,0,183,0,186,0,184,0,185,0,26,0,29,0,27,0,
+28,0,187,0,190,0,188,0,189,0,193,0,196,0,194,0,195,0,203,0,204,0,201,0,202,
+0,32,0,33,0,30,0,31,0,34,0,37,0,35,0,36,0,38,0,41,0,39,0,40,0,207,0,208,0,
+205,0,206,0,42,0,45,0,43,0,44,0,46,0,47,0,48,0,49,0,218,0,219,0,216,0,217,
+0,234,0,235,0,230,0,231,0,232,0,233,0,50,0,51,0,0,0,0,0,21,0,21,0,21,0,21,
+0,67,0,80,0,100,0,165,0,206,0,251,1,67,1,93,1,120,1,155,1,221,2,13,2,67,2,
+140,2,203,2,243,3,34,3,101,3,143,3,183,3,230,4,20,4,80,4,120,4,189,5,14,5,
+57,5,107,5,172,5,243,6,25,6,44,6,69,6,114,6,174,6,229,7,45,7,122,7,162,7,
+227,8,42,8,83,8,133,8,190,9,9,9,102,9,130,9,160,9,181,9,210,9,245,10,29,10,
+77,10,125,10,180,10,239,11,49,11,71,11,109,11,162,11,215,11,229,11,242,12,
+4,12,50,12,102,12,150,12,166,12,191,12,216,12,255,13,47,13,107,13,154,13,
+192,13,227,14,32,14,75,14,110,14,163,14,223,14,235,14,246,15,1,15,13,15,49,
+15,92,15,119,15,177,15,195,15,227,15,247,16,11,16,46,16,68,16,90,16,104,16,
+150,16,202,16,216,17,2,17,38,17,77,17,118,17,158,17,171,17,184,17,219,17,
+250,18,24,18,43,18,68,18,87,18,112,18,145,18,157,18,169,18,191,18,229,18,
+242,19,6,19,18,19,30,19,42,19,54,19,66,19,78,19,90,19,102,19,114,19,126,19,
+138,19,150,19,162,19,174,19,186,19,198,19,210,19,222,19,234,19,246,20,2,20,
+14,20,26,20,38,20,50,20,62,20,74,20,86,20,98,20,110,20,122,20,134,20,146,
+20,158,20,170,20,182,20,194,20,206,20,218,20,230,20,242,20,254,21,10,21,22,
+21,34,21,46,21,58,21,70,21,82,21,94,21,106,21,118,21,130,21,142,21,154,21,
+166,21,178,21,190,21,202,21,214,21,226,21,238,21,250,22,6,22,18,22,30,22,
+38,22,46,22,58,22,70,22,82,22,94,22,106,22,118,22,130,22,142,22,154,22,166,
+22,178,22,190,22,202,22,214,22,226,22,238,22,246,23,2,23,14,23,26,23,38,23,
+46,23,54,23,66,23,78,23,90,23,102,23,110,23,122,23,134,23,142,23,154,23,166,
+23,178,23,190,23,202,23,214,23,226,23,238,23,250,24,6,24,18,24,30,24,42,24,
+54,24,62,24,74,24,86,24,94,24,106,24,118,24,185,24,193,24,201,24,209,24,217,
+24,225,24,233,24,241,24,249,25,1,25,33,25,51,25,59,25,67,25,75,25,83,25,91,
+25,99,25,107,25,115,25,153,25,165,25,177,25,189,25,201,25,213,25,225,25,237,
+25,249,26,5,26,17,26,29,26,41,26,53,26,65,26,77,26,89,26,101,26,113,26,125,
+26,137,26,149,26,161,26,177,26,193,26,205,26,217,26,229,26,241,26,253,27,
+9,27,21,27,33,27,45,27,57,27,73,27,89,27,105,27,121,27,133,27,145,27,157,
+27,169,27,181,27,193,27,205,27,217,27,229,27,241,27,253,28,9,28,21,28,33,
+28,45,28,57,28,69,28,81,28,93,28,105,28,117,28,129,28,141,28,153,28,165,28,
+177,28,189,28,201,28,213,28,225,28,237,28,249,29,5,29,17,29,29,29,41,29,53,
+29,65,29,77,29,89,29,105,29,121,29,133,29,145,29,157,29,169,29,181,29,193,
+29,205,29,217,29,229,29,241,29,253,30,9,30,21,30,33,30,45,30,57,30,69,30,
+81,30,97,30,113,30,125,30,137,30,149,30,161,30,177,30,193,30,209,30,225,30,
+237,30,249,31,5,31,17,31,33,31,49,31,65,31,81,31,93,31,105,31,117,31,129,
+31,141,31,153,31,165,31,177,31,189,31,201,31,213,31,225,31,237,31,249,32,
+1,32,13,32,25,32,37,32,49,32,65,32,81,32,97,32,113,32,125,32,137,32,149,32,
+161,32,173,32,185,32,197,32,209,32,221,32,233,32,245,33,1,33,13,33,25,33,
+37,33,84,33,137,33,175,33,219,34,45,34,134,34,207,35,30,35,42,35,54,35,66,
+35,78,35,90,35,102,35,113,35,124,35,136,35,148,35,160,35,172,35,184,35,196,
+35,207,35,218,35,234,35,250,36,8,36,22,36,38,36,54,36,69,36,84,36,100,36,
+116,36,131,36,146,36,162,36,178,36,193,36,208,36,220,36,232,36,244,37,0,37,
+12,37,24,37,36,37,48,37,60,37,72,37,84,37,96,37,108,37,120,37,132,37,144,
+37,160,37,176,37,192,37,208,37,220,37,232,37,248,38,8,38,24,38,40,38,52,38,
+64,38,80,38,96,38,112,38,128,38,197,39,18,39,83,39,164,40,3,40,56,40,129,
+40,174,40,201,41,9,41,18,41,75,41,97,41,134,41,184,41,242,42,21,42,67,42,
+106,42,145,42,192,42,213,42,234,43,28,43,44,43,60,43,76,43,92,43,108,43,124,
+43,140,43,156,43,172,43,188,43,200,43,212,43,224,43,236,43,248,44,4,44,16,
+44,28,44,40,44,52,44,64,44,76,44,88,44,100,44,112,44,124,44,146,44,243,45,
+25,45,62,45,100,45,185,45,226,46,22,46,90,46,164,46,204,46,253,47,20,47,32,
+47,44,47,56,47,68,47,81,47,93,47,105,47,117,47,212,48,59,48,75,48,84,48,98,
+48,107,48,116,48,125,48,172,48,218,49,38,49,121,49,187,50,4,50,20,50,36,50,
+52,50,68,50,80,50,92,50,104,50,116,50,132,50,148,50,164,50,180,50,196,50,
+212,50,228,50,244,51,0,51,12,51,24,51,36,51,48,51,60,51,72,51,84,51,96,51,
+108,51,120,51,132,51,143,51,154,51,166,51,178,51,194,51,210,51,222,51,234,
+52,11,52,52,52,64,52,76,52,88,52,100,52,112,52,124,52,136,52,148,52,160,52,
+172,52,184,52,196,52,208,52,220,52,232,52,244,53,0,53,12,53,24,53,36,53,48,
+53,60,53,72,53,84,53,96,53,108,53,120,53,132,53,144,53,156,53,167,53,178,
+53,190,53,202,53,214,53,226,53,238,53,250,54,6,54,18,54,30,54,42,54,54,54,
+66,54,82,54,98,54,114,54,130,54,146,54,162,54,178,54,194,54,210,54,226,54,
+242,55,2,55,50,55,106,55,136,55,173,55,185,55,197,55,209,55,221,55,233,55,
+245,56,1,56,13,56,50,56,87,56,125,56,163,56,201,56,239,57,31,57,79,57,149,
+57,219,58,17,58,37,58,57,58,97,58,154,58,210,59,7,59,59,59,71,59,144,59,156,
+59,168,59,180,59,192,59,204,59,216,59,228,59,240,59,252,60,8,60,20,60,32,
+60,44,60,56,60,72,60,88,60,100,60,112,60,124,60,136,60,148,60,160,60,172,
+60,184,60,205,60,221,60,237,60,253,61,13,61,51,61,91,62,27,62,166,62,178,
+63,12,63,33,63,45,63,54,63,63,63,72,63,81,63,90,63,99,63,128,63,157,63,214,
+64,22,64,44,64,98,64,151,64,189,64,244,65,155,65,167,65,179,65,179,65,192,
+65,221,65,245,66,12,0,0,0,2,0,102,254,150,4,102,5,164,0,3,0,7,0,0,19,17,33,
+17,37,33,17,33,102,4,0,252,115,3,27,252,229,254,150,7,14,248,242,114,6,41,
+0,1,0,133,255,238,3,154,3,70,0,28,0,0,55,54,55,55,38,38,53,52,54,54,51,50,
+23,7,38,35,34,6,21,20,22,23,55,36,51,21,34,4,7,133,42,24,116,57,74,105,193,
+126,147,101,45,101,98,119,124,71,58,45,1,54,69,100,253,180,101,131,5,7,21,
+38,152,90,124,176,94,60,153,53,126,120,77,126,28,5,40,166,76,22,0,1,0,205,
+0,0,1,131,6,20,0,3,0,0,19,51,17,35,205,182,182,6,20,249,236,0,0,1,0,205,0,
+0,2,156,6,20,0,9,0,0,19,51,17,33,50,21,21,20,35,33,205,182,1,14,11,11,254,
+60,6,20,250,140,8,142,10,0,0,1,0,92,253,111,4,162,3,246,0,39,0,0,37,38,38,
+39,4,4,21,20,22,51,50,55,23,6,6,35,34,38,53,52,54,36,37,38,39,38,38,35,34,
+6,7,39,54,54,51,32,19,22,22,23,4,53,55,78,29,254,169,254,219,152,161,103,
+198,22,145,170,82,198,228,150,1,66,1,40,16,23,27,147,125,73,206,79,72,79,
+238,115,1,136,67,25,96,82,25,44,82,54,93,216,142,131,123,33,141,31,18,207,
+188,129,216,179,88,54,131,162,157,59,43,141,51,70,254,80,160,201,55,0,0,1,
+255,236,0,0,4,31,3,246,0,25,0,0,35,34,53,53,52,51,33,38,3,38,38,35,34,7,39,
+54,54,51,50,22,22,23,22,22,23,21,10,10,10,3,110,75,54,30,114,114,142,155,
+71,88,179,103,125,168,99,26,30,75,49,10,142,8,75,1,44,177,142,82,141,57,44,
+90,177,165,183,199,44,156,0,1,255,236,0,0,4,172,3,246,0,29,0,0,35,34,53,53,
+52,51,33,38,3,38,38,35,34,7,39,54,54,51,50,22,22,23,18,23,51,50,21,21,20,
+35,10,10,10,3,110,79,50,29,116,113,142,155,71,88,179,103,125,168,99,26,47,
+101,137,10,10,10,142,8,79,1,40,174,145,82,141,57,44,90,177,165,254,191,101,
+8,142,10,0,1,0,92,253,111,4,254,3,246,0,47,0,0,1,34,38,53,52,54,36,37,38,
+39,38,38,35,34,6,7,39,54,54,51,32,19,30,2,51,51,50,21,21,20,35,35,34,38,39,
+6,4,6,21,20,22,51,50,55,23,6,6,2,6,198,228,154,1,72,1,32,22,19,27,147,125,
+73,206,79,72,79,238,115,1,136,67,32,62,100,80,11,10,10,11,112,167,58,245,
+254,242,126,152,161,103,198,22,145,170,253,111,207,188,130,218,180,84,70,
+115,162,157,59,43,141,51,70,254,80,196,150,76,8,142,10,97,108,67,133,158,
+93,131,123,33,141,31,18,0,1,0,92,0,0,3,182,4,94,0,10,0,0,55,33,2,2,39,55,
+22,0,19,21,33,92,2,170,40,226,209,66,236,1,41,52,252,166,160,1,19,1,131,141,
+155,123,254,28,254,157,156,0,0,1,255,174,254,20,1,236,3,225,0,14,0,0,19,34,
+39,55,22,22,51,50,54,53,17,51,17,20,6,127,98,111,53,50,64,38,92,104,173,188,
+254,20,58,137,22,13,150,123,4,28,251,238,207,236,0,1,255,174,254,20,2,244,
+3,225,0,22,0,0,33,21,20,6,35,34,39,55,22,22,51,50,54,53,17,51,17,51,50,21,
+21,20,35,1,236,188,177,98,111,53,50,64,38,92,104,173,253,11,11,49,207,236,
+58,137,22,13,150,123,4,28,252,191,8,142,10,0,0,1,0,133,254,20,9,66,3,225,
+0,45,0,0,33,34,38,39,6,6,35,35,20,6,33,35,34,2,53,52,18,55,51,6,17,20,22,
+51,51,50,54,53,17,51,17,51,50,54,53,17,51,17,7,22,22,51,51,17,51,17,8,23,
+92,155,83,47,150,102,240,246,254,248,147,190,222,44,40,170,70,140,127,100,
+178,166,174,221,99,110,174,2,51,124,92,124,175,61,80,63,78,242,250,1,24,245,
+126,1,3,98,177,254,206,175,190,162,164,3,72,253,94,131,106,1,181,254,20,23,
+89,70,3,65,252,31,0,1,255,236,0,0,6,88,3,225,0,31,0,0,33,34,38,39,6,6,35,
+33,34,53,53,52,51,33,17,51,17,51,50,54,53,17,51,17,7,22,22,51,51,17,51,17,
+5,45,92,155,83,45,150,104,253,62,10,10,1,37,174,221,99,110,174,2,51,121,94,
+125,174,61,82,63,80,10,142,8,2,162,253,94,131,106,1,181,254,20,23,88,71,3,
+65,252,31,0,0,1,255,236,0,0,7,117,3,225,0,37,0,0,33,34,38,39,6,6,35,33,34,
+53,53,52,51,33,17,51,17,51,50,54,53,17,51,17,7,22,22,51,51,17,51,17,33,50,
+21,21,20,35,5,45,92,155,83,45,150,104,253,62,10,10,1,37,174,221,99,110,174,
+2,51,121,94,125,174,1,18,11,11,61,82,63,80,10,142,8,2,162,253,94,131,106,
+1,181,254,20,23,88,71,3,65,252,191,8,142,10,0,1,0,133,254,20,10,94,3,225,
+0,51,0,0,33,34,38,39,6,6,35,35,20,6,33,35,34,2,53,52,18,55,51,6,17,20,22,
+51,51,50,54,53,17,51,17,51,50,54,53,17,51,17,7,22,22,51,51,17,51,17,33,50,
+21,21,20,35,8,23,92,155,83,47,150,102,240,246,254,248,147,190,222,44,40,170,
+70,140,127,100,178,166,174,221,99,110,174,2,51,124,92,124,175,1,18,10,10,
+61,80,63,78,242,250,1,24,245,126,1,3,98,177,254,206,175,190,162,164,3,72,
+253,94,131,106,1,181,254,20,23,89,70,3,65,252,191,8,142,10,0,0,2,0,133,254,
+20,8,190,3,246,0,30,0,38,0,0,1,34,2,53,52,18,55,51,6,17,20,22,51,51,50,54,
+53,17,51,17,54,36,51,50,22,17,17,33,20,6,33,1,17,52,38,35,32,3,21,2,33,190,
+222,44,40,170,70,140,127,100,178,166,174,96,1,34,181,232,237,251,244,246,
+254,248,5,92,164,167,254,195,214,254,20,1,24,245,126,1,3,98,177,254,206,175,
+190,162,164,3,231,254,72,229,232,252,254,244,254,18,248,244,2,140,1,69,189,
+178,253,248,172,0,0,2,255,236,0,0,5,170,3,246,0,16,0,24,0,0,35,34,53,53,52,
+51,51,17,51,17,54,36,51,50,22,17,17,39,17,52,38,35,32,3,21,10,10,10,250,174,
+96,1,34,181,232,237,174,165,167,254,197,215,10,142,8,3,4,254,133,229,232,
+252,254,244,254,18,160,1,69,189,178,253,244,168,0,2,255,236,0,0,6,195,3,246,
+0,22,0,30,0,0,35,34,53,53,52,51,51,17,51,17,54,36,51,50,22,17,17,33,50,21,
+21,20,35,37,17,52,38,35,32,3,21,10,10,10,250,174,96,1,34,181,232,237,1,14,
+11,11,254,68,165,167,254,197,215,10,142,8,3,4,254,133,229,232,252,254,244,
+254,178,8,142,10,160,1,69,189,178,253,244,168,0,2,0,133,254,20,9,219,3,246,
+0,36,0,44,0,0,33,20,6,33,35,34,2,53,52,18,55,51,6,17,20,22,51,51,50,54,53,
+17,51,17,54,36,51,50,22,17,17,33,50,21,21,20,35,37,17,52,38,35,32,3,21,4,
+178,246,254,248,147,190,222,44,40,170,70,140,127,100,178,166,174,96,1,34,
+181,232,237,1,19,10,10,254,63,164,167,254,195,214,248,244,1,24,245,126,1,
+3,98,177,254,206,175,190,162,164,3,231,254,72,229,232,252,254,244,254,178,
+8,142,10,160,1,69,189,178,253,248,172,0,2,0,41,0,0,5,231,6,20,0,16,0,25,0,
+0,51,34,53,53,52,51,51,17,51,17,54,36,51,50,22,17,17,39,17,52,38,35,34,0,
+3,21,51,10,10,250,174,96,1,34,181,232,237,174,164,167,155,254,244,108,10,
+142,8,5,116,252,21,229,232,252,254,244,254,18,160,1,69,189,178,254,251,254,
+249,168,0,2,255,236,0,0,5,170,6,20,0,16,0,24,0,0,35,34,53,53,52,51,51,17,
+51,17,54,36,51,50,22,17,17,39,17,52,38,35,32,3,21,10,10,10,250,174,96,1,34,
+181,232,237,174,165,167,254,197,215,10,142,8,5,116,252,21,229,232,252,254,
+244,254,18,160,1,69,189,178,253,244,168,0,2,255,236,0,0,6,195,6,20,0,22,0,
+30,0,0,35,34,53,53,52,51,51,17,51,17,54,36,51,50,22,17,17,33,50,21,21,20,
+35,37,17,52,38,35,32,3,21,10,10,10,250,174,96,1,34,181,232,237,1,14,11,11,
+254,68,165,167,254,197,215,10,142,8,5,116,252,21,229,232,252,254,244,254,
+178,8,142,10,160,1,69,189,178,253,244,168,0,2,0,61,0,0,6,215,6,20,0,18,0,
+27,0,0,55,51,17,51,17,54,36,51,50,22,17,17,33,50,21,21,20,35,33,37,17,52,
+38,35,34,0,3,21,61,199,174,96,1,34,181,232,237,1,15,10,10,249,112,4,211,164,
+167,155,254,244,108,160,5,116,252,21,229,232,252,254,244,254,178,8,142,10,
+160,1,69,189,178,254,251,254,249,168,0,1,0,133,253,111,3,236,3,246,0,38,0,
+0,1,34,38,53,52,37,38,53,52,54,54,51,50,22,23,7,38,35,34,6,21,20,22,23,54,
+55,23,6,4,6,21,20,22,51,50,55,23,6,6,2,47,198,228,1,8,182,130,231,143,88,
+149,48,56,127,112,147,161,67,58,171,182,49,181,254,223,139,154,160,103,198,
+22,145,170,253,111,207,188,227,176,159,249,142,210,113,35,25,153,53,157,146,
+106,177,51,85,54,151,45,147,168,91,132,122,33,141,31,18,0,1,255,236,0,0,3,
+195,3,246,0,25,0,0,35,34,53,53,52,51,33,38,38,53,52,0,51,50,22,23,7,38,35,
+32,17,20,22,51,33,21,10,10,10,1,59,65,80,1,9,222,88,149,48,55,127,113,254,
+221,139,113,1,109,10,142,8,55,192,117,231,1,3,35,25,153,53,254,174,159,197,
+160,0,2,255,236,0,0,4,213,4,35,0,35,0,45,0,0,33,34,38,39,6,35,35,34,53,53,
+52,51,51,50,55,46,2,39,54,36,51,50,4,23,20,2,7,22,51,51,50,21,21,20,35,1,
+54,18,55,38,35,34,7,22,18,3,219,86,198,95,180,201,237,10,10,235,147,97,79,
+165,115,18,112,1,25,146,129,1,6,98,196,172,114,113,248,10,10,253,151,158,
+154,10,143,152,174,174,31,170,51,51,102,10,142,8,41,57,215,249,112,105,120,
+82,68,212,254,136,118,43,8,142,10,1,37,107,1,0,167,76,119,140,255,0,0,2,0,
+133,253,111,4,254,4,35,0,42,0,52,0,0,19,52,54,55,38,2,39,54,36,51,50,4,23,
+6,2,7,22,51,51,50,21,21,20,35,35,34,38,39,6,6,21,20,22,51,50,54,55,23,6,6,
+35,34,38,19,22,18,23,54,54,55,38,35,34,193,148,163,145,204,22,112,1,25,146,
+129,1,6,98,4,190,179,111,121,248,10,10,240,78,220,87,146,118,152,161,81,148,
+72,23,148,160,90,198,227,137,25,170,120,157,159,12,143,152,174,254,250,128,
+227,112,139,1,87,147,105,120,82,68,197,254,147,140,47,8,142,10,62,47,93,169,
+93,131,123,21,12,141,31,18,208,4,205,118,254,248,99,108,254,162,76,0,1,255,
+236,0,0,4,2,6,131,0,25,0,0,35,34,53,53,52,51,33,17,52,38,35,33,53,54,18,36,
+55,23,6,0,7,51,32,4,21,17,10,10,10,3,94,184,193,254,164,66,232,1,31,136,65,
+188,254,152,68,178,1,12,1,27,10,142,8,1,121,153,144,167,138,1,11,209,52,156,
+74,254,211,143,220,206,253,201,0,1,255,236,0,0,5,23,6,131,0,31,0,0,35,34,
+53,53,52,51,33,17,52,38,35,33,53,54,18,36,55,23,6,0,7,51,32,4,21,17,33,50,
+21,21,20,35,10,10,10,3,94,184,193,254,164,66,232,1,31,136,65,188,254,152,
+68,178,1,12,1,27,1,10,11,11,10,142,8,1,121,153,144,167,138,1,11,209,52,156,
+74,254,211,143,220,206,254,105,8,142,10,0,0,2,0,133,0,0,5,139,6,20,0,26,0,
+42,0,0,1,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,54,51,21,34,
+6,7,6,7,3,34,38,53,52,55,51,6,21,20,22,51,33,17,51,17,2,74,96,72,114,95,76,
+59,30,43,60,45,61,35,26,24,152,29,17,146,35,177,20,70,186,197,51,154,31,109,
+94,2,223,174,2,219,14,47,82,87,98,31,92,25,51,54,35,49,12,5,21,100,15,5,25,
+4,253,131,190,177,136,140,146,116,103,118,5,116,249,236,0,0,2,0,133,0,0,6,
+166,6,20,0,21,0,48,0,0,33,34,38,53,52,55,51,6,21,20,22,51,33,17,51,17,33,
+50,21,21,20,35,1,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,54,51,
+21,34,6,7,6,7,2,4,186,197,51,154,31,109,94,2,223,174,1,17,10,10,251,174,96,
+72,114,95,76,59,30,43,60,45,61,35,26,24,152,29,17,146,35,177,20,190,177,136,
+140,146,116,103,118,5,116,250,140,8,142,10,2,219,14,47,82,87,98,31,92,25,
+51,54,35,49,12,5,21,100,15,5,25,4,0,0,1,0,133,254,20,4,178,6,20,0,22,0,0,
+1,34,2,53,52,18,55,51,6,17,20,22,51,51,50,54,53,17,51,17,20,6,33,2,33,190,
+222,44,40,170,70,140,127,100,178,166,174,246,254,248,254,20,1,24,245,126,
+1,3,98,177,254,206,175,190,162,164,6,26,249,244,248,252,0,1,255,236,0,0,1,
+186,6,20,0,9,0,0,35,34,53,53,52,51,33,17,51,17,10,10,10,1,14,182,10,142,8,
+5,116,249,236,0,0,1,255,236,0,0,2,207,6,20,0,15,0,0,35,34,53,53,52,51,33,
+17,51,17,33,50,21,21,20,35,10,10,10,1,14,182,1,11,10,10,10,142,8,5,116,250,
+140,8,142,10,0,1,0,133,254,20,5,158,6,20,0,29,0,0,33,6,6,33,35,34,2,53,52,
+18,55,51,6,17,20,22,51,51,50,54,53,17,51,17,51,50,21,21,20,35,4,178,3,246,
+254,251,147,190,222,44,40,170,70,140,127,100,178,166,174,225,11,11,243,249,
+1,24,245,126,1,3,98,177,254,206,175,190,162,164,6,26,250,140,8,142,10,0,0,
+2,0,133,253,113,4,172,3,205,0,25,0,40,0,0,33,34,21,17,35,17,52,54,54,51,51,
+38,53,52,55,54,54,51,50,22,22,21,20,6,6,35,3,20,22,23,51,50,54,53,52,38,35,
+34,7,6,6,1,195,146,172,66,113,71,14,75,73,76,194,105,128,194,104,117,213,
+137,223,33,45,145,137,146,141,101,129,111,17,7,150,254,7,2,24,89,124,66,195,
+155,182,144,63,74,113,208,132,161,234,125,2,33,95,183,107,186,176,129,164,
+84,43,89,0,2,255,236,0,0,4,18,3,205,0,21,0,37,0,0,35,34,53,53,52,51,51,38,
+53,52,55,54,54,51,50,22,22,21,20,6,6,35,3,20,22,23,51,50,54,53,52,38,35,34,
+6,7,6,6,10,10,10,254,76,74,75,194,105,128,194,104,117,213,137,223,34,44,145,
+137,146,141,101,65,125,49,17,8,10,142,8,198,152,183,143,63,74,113,208,132,
+161,234,125,2,33,95,183,107,186,176,129,164,46,38,43,89,0,2,255,236,0,0,4,
+238,3,205,0,35,0,51,0,0,35,34,53,53,52,51,51,38,53,52,55,54,54,51,50,22,22,
+21,20,7,22,22,51,51,50,21,21,20,35,35,34,38,39,6,6,35,3,20,22,23,51,50,54,
+53,52,38,35,34,6,7,6,6,10,10,10,254,76,74,75,194,105,128,194,104,43,44,109,
+89,10,11,11,10,109,154,71,65,173,94,223,34,44,145,137,146,141,101,65,125,
+49,17,8,10,142,8,198,152,183,143,63,74,113,208,132,131,110,67,52,8,142,10,
+60,73,68,65,2,33,95,183,107,186,176,129,164,46,38,43,89,0,0,2,0,133,253,113,
+5,135,3,205,0,39,0,54,0,0,33,34,21,17,35,17,52,54,54,51,51,38,53,52,55,54,
+54,51,50,22,22,21,20,7,22,22,51,51,50,21,21,20,35,35,34,38,39,6,6,35,3,20,
+22,23,51,50,54,53,52,38,35,34,7,6,6,1,195,146,172,66,113,71,14,75,73,76,194,
+105,128,194,104,43,45,110,87,10,10,10,10,109,154,71,65,173,94,223,33,45,145,
+137,146,141,101,129,111,17,7,150,254,7,2,24,89,124,66,195,155,182,144,63,
+74,113,208,132,131,110,69,50,8,142,10,60,73,68,65,2,33,95,183,107,186,176,
+129,164,84,43,89,0,0,2,0,133,255,236,4,66,3,246,0,13,0,23,0,0,5,34,38,53,
+52,18,54,51,50,22,18,21,20,6,39,32,17,52,38,35,34,6,21,16,2,96,226,249,125,
+221,135,127,221,128,243,235,1,37,156,139,125,168,20,247,228,150,1,4,149,153,
+254,248,142,232,243,157,1,60,186,217,224,179,254,196,0,2,255,236,0,0,5,135,
+4,242,0,10,0,41,0,0,37,53,52,38,35,34,6,21,20,22,51,5,34,53,53,52,51,33,38,
+38,53,52,54,54,51,32,17,17,33,17,16,2,33,34,7,39,54,51,32,0,17,17,3,31,117,
+115,104,117,158,127,253,127,10,10,1,61,65,78,110,189,112,1,142,1,12,252,254,
+242,199,180,47,192,234,1,78,1,106,160,239,151,140,127,117,131,155,160,10,
+142,8,41,156,96,125,189,103,254,72,254,242,1,145,1,23,1,8,60,158,64,254,151,
+254,185,253,190,0,2,255,236,0,0,6,156,4,242,0,36,0,47,0,0,35,34,53,53,52,
+51,33,38,38,53,52,54,54,51,32,17,17,33,17,16,2,33,34,7,39,54,51,32,0,17,17,
+33,50,21,21,20,35,37,53,52,38,35,34,6,21,20,22,51,10,10,10,1,61,65,78,110,
+189,112,1,142,1,12,252,254,242,199,180,47,192,234,1,78,1,106,1,10,11,11,252,
+142,117,115,104,117,158,127,10,142,8,41,156,96,125,189,103,254,72,254,242,
+1,145,1,23,1,8,60,158,64,254,151,254,185,254,94,8,142,10,160,239,151,140,
+127,117,131,155,0,0,2,0,133,0,0,4,223,4,98,0,16,0,25,0,0,33,34,36,53,52,0,
+33,51,53,51,17,51,50,21,21,20,35,37,17,35,34,6,21,20,22,51,2,141,246,254,
+238,1,48,1,1,135,175,233,10,10,254,104,129,184,201,174,160,249,224,242,1,
+22,129,252,62,8,142,10,160,2,162,189,170,153,162,0,0,2,0,133,254,20,3,207,
+3,225,0,21,0,30,0,0,1,34,39,55,22,22,51,50,54,53,53,35,34,38,53,52,0,33,33,
+17,20,6,19,17,35,34,6,21,20,22,51,1,246,209,160,82,66,140,85,139,158,201,
+218,239,1,50,1,0,1,12,247,73,88,182,203,139,141,254,20,105,137,35,47,149,
+124,59,240,227,241,1,29,251,238,209,234,2,140,2,162,192,173,160,149,0,0,2,
+0,133,254,20,4,129,3,225,0,8,0,38,0,0,37,17,35,34,6,21,20,22,51,5,20,6,35,
+34,39,55,22,22,51,50,54,53,53,35,34,38,53,52,0,33,33,17,51,50,21,21,20,35,
+35,3,33,88,182,203,139,141,1,111,247,226,209,160,82,66,140,85,139,158,201,
+218,239,1,50,1,0,1,12,168,10,10,168,160,2,162,192,173,160,149,209,209,234,
+105,137,35,47,149,124,59,240,227,241,1,29,252,191,8,142,10,0,1,0,133,254,
+20,6,111,3,225,0,50,0,0,1,34,2,53,52,54,55,51,14,2,21,20,22,51,33,50,54,53,
+52,38,38,39,46,2,53,52,18,36,51,50,22,23,7,38,38,35,34,6,6,21,20,23,30,2,
+21,20,4,35,2,33,192,220,35,37,170,23,25,10,138,129,1,145,157,183,52,88,106,
+123,98,51,181,1,12,126,49,177,39,74,30,111,43,69,183,127,153,151,127,70,254,
+238,252,254,20,1,10,228,107,172,90,57,105,98,97,166,180,114,95,38,72,70,64,
+73,85,91,54,122,1,15,176,56,26,137,15,20,112,164,74,69,93,92,120,139,73,171,
+194,0,0,1,0,133,254,20,7,203,2,215,0,66,0,0,1,34,2,53,52,54,55,51,14,2,21,
+20,22,51,33,50,54,53,52,38,39,46,2,53,52,54,54,51,50,22,22,23,30,3,51,51,
+50,21,21,20,35,35,34,38,39,38,39,38,38,35,34,6,6,21,20,22,23,30,2,21,16,33,
+2,33,192,220,35,37,170,23,25,10,138,129,1,125,146,192,76,77,155,115,61,141,
+224,112,69,107,94,70,88,85,60,66,39,11,10,10,11,86,159,84,24,81,99,116,51,
+56,128,86,73,81,147,123,63,253,242,254,20,1,10,228,107,172,90,57,105,98,97,
+166,180,109,76,42,60,22,44,66,98,67,118,220,137,50,95,110,142,98,47,25,8,
+142,10,77,89,25,116,140,96,86,129,52,34,54,24,43,64,87,56,254,106,0,0,1,0,
+92,0,0,4,172,6,20,0,14,0,0,55,33,1,51,1,51,50,53,17,51,17,20,6,35,33,92,1,
+203,254,248,190,1,8,56,217,182,206,173,253,43,160,4,96,251,160,237,4,135,
+251,97,170,203,0,1,0,92,0,0,5,193,6,20,0,15,0,0,55,33,1,51,1,33,17,51,17,
+33,50,21,21,20,35,33,92,1,203,254,248,190,1,8,1,17,182,1,10,11,11,250,166,
+160,4,96,251,160,5,116,250,140,8,142,10,0,0,1,255,236,0,0,1,115,0,160,0,11,
+0,0,37,50,21,21,20,35,33,34,53,53,52,51,1,104,11,11,254,142,10,10,160,8,142,
+10,10,142,8,0,0,1,0,133,0,0,5,139,3,225,0,16,0,0,33,34,38,53,52,54,55,51,
+6,21,20,22,51,33,17,51,17,2,4,177,206,29,22,164,31,106,87,2,223,174,213,184,
+68,178,62,148,145,112,140,3,65,252,31,0,0,1,0,133,0,0,6,166,3,225,0,22,0,
+0,33,34,38,53,52,54,55,51,6,21,20,22,51,33,17,51,17,33,50,21,21,20,35,2,4,
+177,206,29,22,164,31,106,87,2,223,174,1,17,10,10,213,184,68,178,62,148,145,
+112,140,3,65,252,191,8,142,10,0,2,255,236,0,0,4,0,3,225,0,7,0,22,0,0,37,17,
+35,34,6,21,16,33,5,34,53,53,52,51,33,38,38,53,52,0,33,33,17,3,82,88,182,203,
+1,24,253,101,10,10,1,55,52,54,1,45,1,4,1,12,160,2,162,190,173,254,201,160,
+10,142,8,59,168,82,240,1,28,252,31,0,0,2,255,236,0,0,4,227,3,225,0,7,0,29,
+0,0,37,17,35,34,6,21,16,33,5,34,53,53,52,51,33,38,38,53,52,0,33,33,17,51,
+50,23,23,21,20,35,3,82,88,183,202,1,24,253,101,10,10,1,55,52,54,1,47,1,2,
+1,12,217,6,3,1,10,160,2,162,193,172,254,203,160,10,142,8,59,168,82,244,1,
+24,252,191,5,5,142,8,0,0,2,0,133,0,0,7,106,3,225,0,21,0,29,0,0,33,34,38,53,
+52,54,55,51,6,21,20,22,51,33,38,38,53,52,0,33,33,17,39,17,35,34,6,21,16,33,
+2,4,177,206,29,22,164,31,106,87,2,154,48,59,1,45,1,4,1,12,174,88,182,203,
+1,25,213,184,68,178,62,148,145,112,140,52,170,87,240,1,28,252,31,160,2,162,
+190,173,254,201,0,2,0,133,0,0,8,86,3,225,0,7,0,35,0,0,37,17,35,34,6,21,16,
+33,5,34,38,53,52,54,55,51,6,21,20,22,51,33,38,38,53,52,0,33,33,17,51,50,21,
+21,20,35,6,188,88,182,203,1,25,252,8,177,206,29,22,164,31,106,87,2,154,48,
+59,1,45,1,4,1,12,226,10,10,160,2,162,190,173,254,201,160,213,184,68,178,62,
+148,145,112,140,52,170,87,240,1,28,252,191,8,142,10,0,2,0,133,254,20,6,84,
+3,225,0,27,0,36,0,0,1,34,0,53,16,55,51,6,17,20,22,51,33,50,54,53,53,35,34,
+38,53,52,0,51,33,17,16,33,1,17,35,34,6,21,20,22,51,2,106,225,254,252,84,170,
+70,177,161,1,158,200,177,189,227,239,1,50,255,1,12,253,250,1,88,88,182,203,
+139,141,254,20,1,10,228,1,5,222,196,254,237,166,180,155,163,14,240,227,243,
+1,27,252,19,254,32,2,140,2,162,192,173,160,149,0,0,2,0,133,254,20,7,63,3,
+225,0,8,0,44,0,0,37,17,35,34,6,21,20,22,51,33,50,21,21,20,35,35,21,16,33,
+33,34,0,53,16,55,51,6,17,20,22,51,33,50,54,53,53,35,34,38,53,52,0,51,33,17,
+5,166,88,182,203,139,141,2,80,10,10,225,253,250,254,28,225,254,252,84,170,
+70,177,161,1,158,200,177,189,227,239,1,50,255,1,12,160,2,162,192,173,160,
+149,8,142,10,12,254,32,1,10,228,1,5,222,196,254,237,166,180,155,163,14,240,
+227,243,1,27,252,191,0,0,1,255,141,4,164,0,115,5,154,0,11,0,0,17,34,38,53,
+52,54,51,50,22,21,20,6,53,62,61,54,55,60,60,4,164,64,59,59,64,67,56,56,67,
+0,0,2,254,217,4,164,1,33,5,154,0,11,0,23,0,0,3,34,38,53,52,54,51,50,22,21,
+20,6,33,34,38,53,52,54,51,50,22,21,20,6,180,48,67,67,48,52,62,61,1,45,53,
+62,61,54,55,60,60,4,164,58,65,65,58,63,60,59,64,64,59,59,64,67,56,56,67,0,
+0,3,254,221,4,164,1,37,6,154,0,11,0,23,0,35,0,0,17,34,38,53,52,54,51,50,22,
+21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,
+6,46,60,60,46,43,63,63,219,48,67,67,48,55,60,60,1,43,53,62,61,54,55,60,60,
+5,184,53,60,59,54,55,58,60,53,254,236,58,65,65,58,67,56,56,67,64,59,59,64,
+67,56,56,67,0,3,254,221,253,80,1,37,255,63,0,11,0,23,0,35,0,0,17,34,38,53,
+52,54,51,50,22,21,20,6,39,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,
+54,51,50,22,21,20,6,46,60,60,46,43,63,63,219,48,67,67,48,54,61,60,1,43,53,
+62,62,53,54,61,60,253,80,53,60,58,54,54,58,60,53,250,58,65,64,58,66,56,56,
+67,64,59,58,64,66,56,56,67,0,0,1,0,205,1,133,1,213,3,4,0,3,0,0,19,33,17,33,
+205,1,8,254,248,3,4,254,129,0,0,1,0,205,0,0,1,131,5,100,0,3,0,0,19,51,17,
+35,205,182,182,5,100,250,156,0,0,1,0,92,0,0,3,141,5,100,0,6,0,0,19,53,33,
+21,33,1,35,92,3,49,253,148,1,174,197,4,211,145,166,251,66,0,0,1,0,92,0,0,
+4,90,5,100,0,29,0,0,19,51,19,22,51,50,54,53,51,20,6,7,22,51,50,54,53,51,21,
+20,6,35,34,39,6,35,34,39,1,35,92,195,92,17,50,60,51,182,18,25,41,51,80,64,
+182,147,170,124,69,45,55,57,27,1,47,195,5,100,254,203,10,154,165,105,148,
+54,12,143,176,28,234,211,47,45,21,252,94,0,0,1,0,174,255,236,3,145,5,127,
+0,33,0,0,5,34,38,38,53,52,18,55,39,38,53,52,54,54,55,23,14,2,21,20,23,23,
+14,2,21,20,22,51,50,55,21,6,2,70,117,189,102,205,158,105,207,136,228,146,
+56,72,165,148,184,160,245,88,46,130,97,200,115,129,20,61,107,63,74,1,1,122,
+84,163,62,62,172,152,48,156,23,91,121,19,29,149,131,249,102,78,30,40,56,43,
+151,45,0,2,0,133,255,236,4,66,5,119,0,14,0,28,0,0,5,34,2,17,52,18,54,51,50,
+22,18,21,20,6,6,39,50,54,53,52,2,38,35,34,6,2,21,20,22,2,96,249,226,132,219,
+130,134,217,125,102,202,174,154,135,80,131,80,74,130,84,137,20,1,19,1,21,
+228,1,154,229,235,254,101,221,194,243,115,157,201,199,196,1,79,175,185,254,
+173,182,199,201,0,1,0,0,0,0,3,49,5,100,0,5,0,0,1,33,53,33,17,35,2,123,253,
+133,3,49,182,4,190,166,250,156,0,1,0,41,0,0,4,16,5,100,0,10,0,0,19,51,19,
+22,23,54,55,19,51,1,35,41,188,248,42,20,22,41,248,190,254,125,227,5,100,252,
+86,156,114,131,139,3,170,250,156,0,0,1,0,41,0,0,4,16,5,100,0,10,0,0,1,51,
+1,35,3,38,39,6,7,3,35,1,170,227,1,131,190,248,44,19,20,42,248,188,5,100,250,
+156,3,170,148,122,116,154,252,86,0,2,0,61,0,0,3,164,5,121,0,12,0,22,0,0,1,
+35,34,38,53,52,54,51,50,18,17,17,35,3,52,38,38,35,34,6,21,16,33,2,248,232,
+223,244,220,184,245,222,172,2,60,123,110,108,124,1,35,2,39,225,207,190,228,
+254,194,254,164,253,33,2,199,190,233,107,137,123,254,242,0,1,0,92,0,0,4,68,
+5,154,0,30,0,0,19,51,23,22,23,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,
+54,53,51,21,16,33,34,38,39,1,35,92,195,65,63,152,82,109,100,75,48,29,39,47,
+30,45,127,168,170,254,155,94,163,79,1,68,195,5,100,227,30,38,51,115,85,98,
+21,113,15,39,49,112,36,28,212,25,254,146,27,34,252,35,0,2,0,133,255,242,4,
+66,5,119,0,18,0,38,0,0,37,50,55,51,22,51,50,54,53,52,2,38,35,34,6,2,21,20,
+22,23,34,38,53,52,18,54,51,50,22,18,21,20,6,35,34,38,39,6,6,1,195,90,6,131,
+6,94,66,57,81,131,79,73,129,86,59,43,147,144,136,218,127,130,216,130,138,
+151,59,106,28,24,101,145,174,174,168,162,202,1,113,197,208,254,141,189,162,
+168,159,241,244,236,1,189,247,253,254,66,229,245,240,63,53,53,63,0,0,1,0,
+133,0,0,3,152,5,121,0,27,0,0,51,54,18,55,38,38,53,52,54,54,51,50,22,23,7,
+38,35,34,6,21,20,5,54,55,23,6,0,7,133,60,172,143,168,180,106,193,125,71,150,
+59,61,104,111,122,118,1,35,104,111,66,251,254,209,63,186,1,7,122,38,221,169,
+126,180,96,33,29,151,53,135,117,241,52,86,54,154,144,254,174,200,0,0,1,255,
+236,254,96,1,207,3,225,0,24,0,0,1,34,38,53,52,54,55,35,34,53,53,52,51,33,
+17,51,17,35,6,21,20,22,51,51,21,1,29,87,108,46,61,207,10,10,1,14,182,90,100,
+36,36,139,254,96,103,77,52,108,76,10,142,8,3,65,252,31,125,63,25,43,160,0,
+0,1,255,236,254,4,4,166,0,160,0,21,0,0,37,50,21,21,20,35,33,17,35,34,2,39,
+35,34,53,53,52,51,33,18,33,17,4,156,10,10,254,241,192,201,255,46,225,10,10,
+1,100,70,1,55,160,8,142,10,254,4,1,0,252,10,142,8,254,4,1,252,0,2,0,133,0,
+0,5,197,4,242,0,10,0,37,0,0,37,53,52,38,35,34,6,21,20,22,51,33,51,38,38,53,
+52,54,54,51,32,17,17,33,17,16,2,33,34,7,39,54,51,32,0,17,17,33,3,92,114,117,
+104,117,155,129,253,209,236,66,78,109,191,112,1,141,1,13,254,254,243,197,
+182,47,192,234,1,76,1,109,250,192,160,239,150,141,127,117,130,156,42,155,
+96,125,188,104,254,72,254,242,1,145,1,24,1,7,60,158,64,254,153,254,183,253,
+190,0,0,1,0,92,254,96,5,76,2,133,0,27,0,0,1,34,38,53,52,54,54,55,62,2,53,
+53,51,21,20,6,6,7,14,2,21,20,22,51,33,21,1,145,148,161,75,155,182,156,112,
+43,182,63,146,178,173,115,48,69,54,3,191,254,96,137,127,83,123,102,73,65,
+79,98,94,80,80,118,149,113,74,72,67,69,55,44,60,160,0,1,0,92,254,96,5,76,
+0,160,0,22,0,0,37,50,21,21,20,35,33,34,6,21,20,22,51,33,21,33,34,38,53,52,
+54,54,51,3,45,10,10,254,217,109,135,66,57,3,191,252,69,148,161,122,213,118,
+160,8,142,10,85,67,48,56,160,137,127,87,142,83,0,1,0,133,0,0,5,221,6,131,
+0,32,0,0,33,34,38,53,52,54,55,51,6,21,20,22,51,33,17,52,38,35,33,53,54,18,
+36,55,23,6,0,7,51,32,4,21,17,2,4,186,197,22,19,164,31,109,94,3,49,184,193,
+254,164,66,232,1,31,136,66,186,254,150,69,178,1,12,1,27,190,177,52,154,70,
+170,86,106,121,1,121,153,144,167,138,1,11,209,52,156,72,254,210,144,220,206,
+253,201,0,1,0,133,0,0,6,242,6,131,0,38,0,0,33,34,38,53,52,54,55,51,6,21,20,
+22,51,33,17,52,38,35,33,53,54,18,36,55,23,6,0,7,51,32,4,21,17,33,50,21,21,
+20,35,2,4,186,197,22,19,164,31,109,94,3,49,184,193,254,164,66,232,1,31,136,
+66,186,254,150,69,178,1,12,1,27,1,10,11,11,190,177,52,154,70,170,86,106,121,
+1,121,153,144,167,138,1,11,209,52,156,72,254,210,144,220,206,254,105,8,142,
+10,0,255,255,0,133,0,0,5,221,7,88,2,38,0,83,0,0,0,7,2,237,2,35,0,0,255,255,
+255,236,0,0,4,2,7,88,2,38,0,30,0,0,0,6,2,237,76,0,255,255,255,236,0,0,5,23,
+7,88,2,38,0,31,0,0,0,6,2,237,76,0,255,255,0,133,0,0,6,242,7,88,2,38,0,84,
+0,0,0,7,2,237,2,35,0,0,0,1,0,133,254,20,4,178,3,225,0,21,0,0,1,34,2,53,52,
+55,51,6,17,20,22,51,51,50,54,53,17,51,17,20,6,33,2,33,192,220,84,170,70,138,
+129,100,178,166,174,246,254,248,254,20,1,10,228,245,208,177,254,248,166,180,
+162,164,3,231,252,39,248,252,0,1,0,133,254,20,5,158,3,225,0,28,0,0,33,6,6,
+33,35,34,2,53,52,55,51,6,17,20,22,51,51,50,54,53,17,51,17,51,50,21,21,20,
+35,4,178,3,246,254,251,147,192,220,84,170,70,138,129,100,178,166,174,225,
+11,11,243,249,1,10,228,245,208,177,254,248,166,180,162,166,3,229,252,191,
+8,142,10,0,0,3,0,102,0,0,4,47,5,100,0,3,0,7,0,11,0,0,19,51,21,35,1,51,1,35,
+1,51,21,35,201,215,215,2,200,158,252,213,158,2,136,215,215,4,221,215,1,94,
+250,156,1,125,215,0,0,2,0,133,255,227,3,133,5,203,0,28,0,38,0,0,1,52,38,39,
+46,2,53,52,54,51,50,23,7,38,38,35,34,6,21,20,22,22,23,22,22,21,21,35,19,34,
+38,53,52,51,50,21,20,6,2,6,62,108,98,80,37,212,190,171,195,63,70,148,85,108,
+120,30,67,83,101,69,139,60,54,73,127,127,66,1,176,86,105,94,87,109,119,78,
+173,200,101,145,35,51,115,100,63,91,84,71,89,145,114,37,254,69,66,74,139,
+139,66,74,0,1,0,133,0,0,1,190,1,246,0,6,0,0,55,54,19,51,2,7,35,133,59,117,
+137,60,40,199,23,218,1,5,254,252,242,0,0,2,0,133,255,236,1,215,5,90,0,9,0,
+17,0,0,5,34,53,52,54,51,50,22,21,20,3,54,55,51,6,2,7,35,1,4,127,73,54,54,
+73,229,66,110,137,25,61,14,199,20,139,73,66,66,73,139,3,143,242,237,102,254,
+205,93,0,1,0,133,254,248,1,190,0,238,0,7,0,0,19,54,18,55,51,23,6,3,133,25,
+61,14,199,14,50,126,254,248,102,1,51,93,23,197,254,230,0,1,0,133,1,31,1,190,
+3,20,0,7,0,0,19,54,18,55,51,23,6,3,133,25,62,13,199,14,48,128,1,31,103,1,
+52,90,22,193,254,226,0,1,0,82,2,119,4,20,6,20,0,14,0,0,19,19,37,55,5,3,51,
+3,37,23,5,19,7,3,3,215,242,254,137,29,1,135,43,205,43,1,141,26,254,134,245,
+178,176,158,2,215,1,70,28,193,111,1,137,254,119,111,193,28,254,186,96,1,102,
+254,154,0,0,2,255,16,6,53,0,240,8,63,0,3,0,7,0,0,3,37,21,5,17,37,21,5,240,
+1,224,254,32,1,224,254,32,6,166,178,111,180,1,88,178,110,180,0,0,2,255,16,
+252,231,0,240,254,242,0,3,0,7,0,0,3,37,21,5,17,37,21,5,240,1,224,254,32,1,
+224,254,32,253,88,178,110,181,1,88,179,111,180,0,0,1,255,16,6,53,0,240,7,
+88,0,3,0,0,3,37,21,5,240,1,224,254,32,6,166,178,111,180,0,2,254,211,6,61,
+1,45,8,10,0,18,0,29,0,0,3,34,39,55,22,51,50,55,38,53,52,54,51,50,22,21,20,
+6,6,55,54,54,53,52,38,35,34,6,21,20,92,114,95,59,76,70,60,42,65,102,82,82,
+94,109,184,88,54,45,42,32,31,45,6,61,68,86,51,14,83,91,78,92,93,69,73,141,
+85,152,29,75,35,32,40,40,42,63,0,2,254,145,6,61,1,96,8,10,0,23,0,33,0,0,19,
+34,39,39,7,39,55,22,22,51,50,55,38,38,53,52,54,51,50,22,21,20,6,6,55,54,53,
+52,38,35,34,6,21,20,10,115,81,31,84,66,160,53,110,46,41,16,29,38,102,82,80,
+96,94,158,54,92,42,32,31,45,6,61,71,26,68,78,145,71,78,10,37,96,45,78,92,
+90,72,82,138,79,146,51,94,32,40,40,42,60,0,1,255,16,253,207,0,240,254,242,
+0,3,0,0,3,37,21,5,240,1,224,254,32,254,63,179,111,180,0,1,254,186,6,115,1,
+72,8,12,0,29,0,0,3,34,38,53,53,51,21,20,22,51,50,53,53,51,21,20,22,51,50,
+54,53,53,51,21,20,6,35,34,39,6,158,81,87,107,36,46,90,96,38,40,55,39,107,
+89,87,96,48,49,6,115,101,97,129,110,62,51,94,181,140,54,40,53,60,151,170,
+96,102,61,102,0,0,2,255,31,6,135,0,227,8,53,0,11,0,22,0,0,3,34,38,53,52,54,
+51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,2,102,121,122,101,103,126,
+126,103,49,64,64,49,50,63,6,135,115,100,101,114,117,96,99,118,103,58,54,54,
+59,59,54,112,0,1,254,209,6,20,1,86,6,233,0,23,0,0,1,54,54,51,50,30,2,51,50,
+54,55,51,6,6,35,34,46,2,35,34,6,7,254,209,11,92,85,37,74,69,63,26,41,41,14,
+92,11,92,85,37,72,68,64,28,42,40,14,6,20,98,113,28,34,28,43,49,97,113,28,
+34,28,43,50,0,0,1,255,53,5,254,0,193,7,164,0,25,0,0,3,55,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,22,23,54,54,51,21,34,6,7,7,203,97,72,115,94,80,55,31,
+41,61,45,62,36,26,20,156,29,16,113,152,115,6,92,14,47,83,88,96,31,92,25,51,
+54,35,49,12,5,21,100,11,20,18,0,1,255,53,253,227,0,193,255,137,0,24,0,0,3,
+55,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,54,51,21,34,4,7,203,97,
+29,43,111,98,80,55,31,41,61,45,62,62,20,164,21,46,254,215,53,254,66,14,18,
+66,45,86,98,31,92,25,51,54,65,31,5,22,101,38,11,0,1,255,197,6,125,0,57,8,
+10,0,3,0,0,3,51,17,35,59,116,116,8,10,254,115,0,0,1,255,197,252,231,0,57,
+254,117,0,3,0,0,3,51,17,35,59,116,116,254,117,254,114,0,0,2,255,18,4,180,
+0,186,6,129,0,11,0,20,0,0,3,51,17,51,17,54,54,51,50,21,21,33,37,53,52,38,
+35,34,6,7,21,238,31,82,25,75,60,151,254,88,1,86,36,43,48,73,29,5,12,1,117,
+254,252,60,73,178,156,88,51,54,53,65,72,21,0,1,0,92,0,0,4,162,4,94,0,15,0,
+0,55,33,2,2,39,55,22,0,19,51,50,21,21,20,35,33,92,2,170,40,226,209,66,236,
+1,41,50,228,10,10,251,196,160,1,19,1,131,141,155,125,254,28,254,163,8,142,
+10,0,0,2,254,246,6,41,0,233,7,88,0,8,0,15,0,0,1,51,54,51,50,22,21,21,33,37,
+52,38,35,34,6,7,254,246,94,72,157,85,91,254,13,1,139,35,37,36,65,15,6,135,
+209,110,99,94,94,60,53,64,49,0,0,1,255,236,0,0,1,186,3,225,0,9,0,0,35,34,
+53,53,52,51,33,17,51,17,10,10,10,1,14,182,10,142,8,3,65,252,31,0,0,1,255,
+236,0,0,2,207,3,225,0,15,0,0,35,34,53,53,52,51,33,17,51,17,33,50,21,21,20,
+35,10,10,10,1,14,182,1,11,10,10,10,142,8,3,65,252,191,8,142,10,0,1,255,236,
+0,0,2,53,3,225,0,9,0,0,35,34,53,53,52,51,33,17,51,17,10,10,10,1,137,182,10,
+142,8,3,65,252,31,0,0,1,255,236,0,0,3,53,3,225,0,15,0,0,35,34,53,53,52,51,
+33,17,51,17,33,50,21,21,20,35,10,10,10,1,76,182,1,51,10,10,10,142,8,3,65,
+252,191,8,142,10,0,1,0,102,0,0,5,76,3,20,0,18,0,0,51,18,18,54,55,51,17,33,
+50,21,21,20,35,33,17,14,2,7,102,153,214,249,165,192,1,15,10,10,254,59,133,
+177,150,111,1,35,1,20,175,46,253,140,8,142,10,2,109,52,133,209,227,0,255,
+255,0,92,253,111,4,162,3,246,2,38,2,235,0,0,0,7,0,64,3,33,0,100,255,255,0,
+92,253,111,4,254,3,246,2,38,2,236,0,0,0,7,0,64,3,33,0,100,0,1,255,141,254,
+102,0,115,255,92,0,11,0,0,17,34,38,53,52,54,51,50,22,21,20,6,53,62,61,54,
+55,60,60,254,102,64,59,59,64,67,56,56,67,0,0,2,254,217,254,102,1,33,255,92,
+0,11,0,23,0,0,3,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,
+21,20,6,180,48,67,67,48,52,62,61,1,45,53,62,61,54,55,60,60,254,102,58,65,
+65,58,63,60,59,64,64,59,59,64,67,56,56,67,0,0,1,0,205,0,0,1,131,5,154,0,3,
+0,0,19,51,17,35,205,182,182,5,154,250,102,0,0,1,0,205,0,0,2,156,5,154,0,9,
+0,0,19,51,17,33,50,21,21,20,35,33,205,182,1,14,11,11,254,60,5,154,251,6,8,
+142,10,0,255,255,0,90,0,0,1,230,7,164,2,38,0,123,0,0,0,7,0,107,1,37,0,0,255,
+255,0,90,0,0,2,156,7,164,2,38,0,124,0,0,0,7,0,107,1,37,0,0,255,255,0,104,
+253,227,1,244,6,20,2,38,0,5,0,0,0,7,0,108,1,51,0,0,255,255,0,104,253,227,
+2,156,6,20,2,38,0,6,0,0,0,7,0,108,1,51,0,0,255,255,255,238,0,0,2,115,6,233,
+2,38,0,123,0,0,0,7,0,106,1,29,0,0,255,255,255,238,0,0,2,156,6,233,2,38,0,
+124,0,0,0,7,0,106,1,29,0,0,255,255,0,27,0,0,2,14,7,88,2,38,0,123,0,0,0,7,
+0,113,1,37,0,0,255,255,0,27,0,0,2,156,7,88,2,38,0,124,0,0,0,7,0,113,1,37,
+0,0,255,255,0,133,254,102,5,139,3,225,2,38,0,53,0,0,0,7,0,121,3,86,0,0,255,
+255,255,236,254,102,1,201,3,225,2,38,0,114,0,0,0,7,0,121,1,86,0,0,255,255,
+255,236,254,102,2,207,3,225,2,38,0,115,0,0,0,7,0,121,1,84,0,0,255,255,0,133,
+254,102,6,166,3,225,2,38,0,54,0,0,0,7,0,121,3,86,0,0,255,255,0,133,253,80,
+5,139,3,225,2,38,0,53,0,0,0,7,0,64,3,74,0,0,255,255,0,133,253,80,6,166,3,
+225,2,38,0,54,0,0,0,7,0,64,3,74,0,0,255,255,255,236,253,80,2,72,3,225,2,38,
+0,116,0,0,0,7,0,64,1,35,0,0,255,255,255,236,253,80,3,53,3,225,2,38,0,117,
+0,0,0,7,0,64,1,174,0,0,255,255,0,133,0,0,5,139,4,216,2,38,0,53,0,0,0,7,0,
+62,3,10,255,62,255,255,255,236,0,0,2,242,5,154,2,38,0,116,0,0,0,7,0,62,1,
+209,0,0,255,255,255,236,0,0,3,53,5,154,2,38,0,117,0,0,0,7,0,62,1,158,0,0,
+255,255,0,133,0,0,6,166,4,216,2,38,0,54,0,0,0,7,0,62,3,10,255,62,255,255,
+0,133,0,0,5,139,5,218,2,38,0,53,0,0,0,7,0,63,3,23,255,64,255,255,255,236,
+0,0,2,242,6,154,2,38,0,116,0,0,0,7,0,63,1,205,0,0,255,255,255,236,0,0,3,53,
+6,154,2,38,0,117,0,0,0,7,0,63,1,154,0,0,255,255,0,133,0,0,6,166,5,216,2,38,
+0,54,0,0,0,7,0,63,3,23,255,62,255,255,0,133,0,0,5,139,5,175,2,38,0,53,0,0,
+0,7,0,111,3,51,255,46,255,255,255,236,0,0,2,163,6,129,2,38,0,116,0,0,0,7,
+0,111,1,233,0,0,255,255,255,236,0,0,3,53,6,129,2,38,0,117,0,0,0,7,0,111,1,
+176,0,0,255,255,0,133,0,0,6,166,5,175,2,38,0,54,0,0,0,7,0,111,3,51,255,46,
+255,255,0,133,255,236,4,66,5,154,2,38,0,42,0,0,0,7,0,62,2,76,0,0,255,255,
+0,133,0,0,4,223,6,21,2,38,0,45,0,0,0,7,0,62,2,215,0,123,255,255,255,236,253,
+80,4,31,3,246,2,38,0,8,0,0,0,7,0,64,1,233,0,0,255,255,255,236,253,80,4,172,
+3,246,2,38,0,9,0,0,0,7,0,64,1,233,0,0,255,255,0,92,253,111,4,162,3,246,2,
+38,0,7,0,0,0,7,0,121,2,102,0,61,255,255,255,236,254,102,4,31,3,246,2,38,0,
+8,0,0,0,7,0,121,1,221,0,0,255,255,255,236,254,102,4,172,3,246,2,38,0,9,0,
+0,0,7,0,121,1,221,0,0,255,255,0,92,253,111,4,254,3,246,2,38,0,10,0,0,0,7,
+0,121,2,102,0,61,255,255,0,92,253,111,4,162,5,154,2,38,0,7,0,0,0,7,0,61,1,
+250,0,0,255,255,255,236,0,0,4,31,5,154,2,38,0,8,0,0,0,7,0,61,1,250,0,0,255,
+255,255,236,0,0,4,172,5,154,2,38,0,9,0,0,0,7,0,61,1,250,0,0,255,255,0,92,
+253,111,4,254,5,154,2,38,0,10,0,0,0,7,0,61,1,250,0,0,255,255,0,92,0,0,3,182,
+6,17,2,38,0,11,0,0,0,7,0,61,1,115,0,119,255,255,0,92,0,0,4,162,6,17,2,38,
+0,112,0,0,0,7,0,61,1,115,0,119,255,255,0,92,0,0,3,182,6,223,2,38,0,11,0,0,
+0,7,0,111,1,160,0,94,255,255,0,92,0,0,4,162,6,223,2,38,0,112,0,0,0,7,0,111,
+1,160,0,94,255,255,255,174,254,20,1,254,5,154,2,38,0,12,0,0,0,7,0,61,1,139,
+0,0,255,255,255,174,254,20,2,244,5,154,2,38,0,13,0,0,0,7,0,61,1,180,0,0,255,
+255,255,174,254,20,2,98,6,129,2,38,0,12,0,0,0,7,0,111,1,168,0,0,255,255,255,
+174,254,20,2,244,6,129,2,38,0,13,0,0,0,7,0,111,1,209,0,0,255,255,255,174,
+254,20,2,184,6,154,2,38,0,12,0,0,0,7,0,63,1,147,0,0,255,255,255,174,254,20,
+2,244,6,154,2,38,0,13,0,0,0,7,0,63,1,188,0,0,255,255,0,133,254,20,9,66,6,
+154,2,38,0,14,0,0,0,7,0,63,6,170,0,0,255,255,255,236,0,0,6,88,6,154,2,38,
+0,15,0,0,0,7,0,63,3,203,0,0,255,255,255,236,0,0,7,117,6,154,2,38,0,16,0,0,
+0,7,0,63,3,205,0,0,255,255,0,133,254,20,10,94,6,154,2,38,0,17,0,0,0,7,0,63,
+6,180,0,0,255,255,0,133,254,20,8,190,5,154,2,38,0,18,0,0,0,7,0,61,6,190,0,
+0,255,255,255,236,0,0,5,170,5,154,2,38,0,19,0,0,0,7,0,61,3,156,0,0,255,255,
+255,236,0,0,6,195,5,154,2,38,0,20,0,0,0,7,0,61,3,158,0,0,255,255,0,133,254,
+20,9,219,5,154,2,38,0,21,0,0,0,7,0,61,6,190,0,0,255,255,0,41,0,0,5,231,6,
+20,2,38,0,22,0,0,0,7,0,61,3,231,0,0,255,255,255,236,0,0,5,170,6,20,2,38,0,
+23,0,0,0,7,0,61,3,170,0,0,255,255,255,236,0,0,6,195,6,20,2,38,0,24,0,0,0,
+7,0,61,3,170,0,0,255,255,0,61,0,0,6,215,6,20,2,38,0,25,0,0,0,7,0,61,3,170,
+0,0,255,255,0,133,253,111,3,236,5,154,2,38,0,26,0,0,0,7,0,61,2,113,0,0,255,
+255,255,236,0,0,3,195,5,154,2,38,0,27,0,0,0,7,0,61,2,80,0,0,255,255,255,236,
+0,0,4,213,5,236,2,38,0,28,0,0,0,7,0,61,2,72,0,82,255,255,0,133,253,111,4,
+254,5,236,2,38,0,29,0,0,0,7,0,61,2,113,0,82,255,255,255,236,0,0,4,2,6,131,
+2,6,0,30,0,0,255,255,255,236,0,0,5,23,6,131,2,6,0,31,0,0,255,255,0,133,0,
+0,7,106,5,154,2,38,0,57,0,0,0,7,0,61,5,231,0,0,255,255,255,236,0,0,4,0,5,
+154,2,38,0,55,0,0,0,7,0,61,2,123,0,0,255,255,255,236,0,0,4,227,5,154,2,38,
+0,56,0,0,0,7,0,61,2,141,0,0,255,255,0,133,0,0,8,86,5,154,2,38,0,58,0,0,0,
+7,0,61,5,231,0,0,255,255,0,133,0,0,7,106,6,154,2,38,0,57,0,0,0,7,0,63,5,225,
+0,0,255,255,255,236,0,0,4,0,6,154,2,38,0,55,0,0,0,7,0,63,2,166,0,0,255,255,
+255,236,0,0,4,227,6,154,2,38,0,56,0,0,0,7,0,63,2,166,0,0,255,255,0,133,0,
+0,8,86,6,154,2,38,0,58,0,0,0,7,0,63,5,225,0,0,255,255,255,236,0,0,4,0,5,154,
+2,38,0,55,0,0,0,7,0,62,2,178,0,0,255,255,255,236,0,0,4,227,5,154,2,38,0,56,
+0,0,0,7,0,62,2,178,0,0,255,255,0,133,254,20,6,84,5,154,2,38,0,59,0,0,0,7,
+0,62,5,0,0,0,255,255,0,133,254,20,7,63,5,154,2,38,0,60,0,0,0,7,0,62,5,37,
+0,0,255,255,255,236,0,0,1,209,5,154,2,38,0,114,0,0,0,7,0,61,1,94,0,0,255,
+255,255,236,0,0,2,207,5,154,2,38,0,115,0,0,0,7,0,61,1,88,0,0,255,255,0,133,
+254,20,4,178,4,216,2,38,0,89,0,0,0,7,0,61,2,160,255,62,255,255,0,133,254,
+20,5,158,4,216,2,38,0,90,0,0,0,7,0,61,2,160,255,62,255,255,0,133,255,236,
+4,66,3,246,2,6,0,42,0,0,255,255,0,133,255,236,4,66,6,59,2,38,0,42,0,0,0,7,
+0,107,2,43,254,151,255,255,0,133,0,0,4,223,6,59,2,38,0,45,0,0,0,7,0,107,2,
+43,254,151,255,255,0,133,254,20,3,207,6,59,2,38,0,46,0,0,0,7,0,107,2,43,254,
+151,255,255,0,133,254,20,4,129,6,59,2,38,0,47,0,0,0,7,0,107,2,43,254,151,
+255,255,255,236,0,0,1,186,3,225,2,6,0,114,0,0,255,255,255,236,0,0,2,207,3,
+225,2,6,0,115,0,0,255,255,255,236,254,102,2,80,3,225,2,38,0,116,0,0,0,7,0,
+122,1,47,0,0,255,255,255,236,254,102,3,53,3,225,2,38,0,117,0,0,0,7,0,122,
+1,166,0,0,255,255,0,133,252,123,6,111,3,225,2,38,0,48,0,0,0,7,0,122,3,20,
+254,21,255,255,0,133,252,123,7,203,2,215,2,38,0,49,0,0,0,7,0,122,3,20,254,
+21,255,255,0,133,254,20,6,111,3,225,2,6,0,48,0,0,255,255,255,236,254,102,
+2,80,3,225,2,38,0,116,0,0,0,7,0,122,1,47,0,0,255,255,255,236,254,102,3,53,
+3,225,2,38,0,117,0,0,0,7,0,122,1,166,0,0,255,255,0,133,254,20,7,203,2,215,
+2,6,0,49,0,0,255,255,0,92,254,96,5,76,3,63,2,38,0,81,0,0,0,7,0,107,1,131,
+251,155,255,255,0,92,254,96,5,76,2,194,2,38,0,82,0,0,0,7,0,107,1,193,251,
+30,255,255,0,133,254,20,6,111,4,13,2,38,0,48,0,0,0,7,0,107,1,254,252,105,
+255,255,255,236,0,0,2,125,6,67,2,38,0,116,0,0,0,7,0,107,1,188,254,159,255,
+255,255,236,0,0,3,53,6,67,2,38,0,117,0,0,0,7,0,107,1,147,254,159,255,255,
+0,133,254,20,7,203,4,13,2,38,0,49,0,0,0,7,0,107,2,102,252,105,255,255,0,92,
+0,0,4,172,7,83,2,38,0,50,0,0,0,7,0,107,1,88,255,175,255,255,0,92,0,0,5,193,
+7,83,2,38,0,51,0,0,0,7,0,107,1,88,255,175,255,255,0,92,253,146,4,172,6,20,
+2,38,0,50,0,0,0,7,0,108,2,164,255,175,255,255,0,92,253,146,5,193,6,20,2,38,
+0,51,0,0,0,7,0,108,2,164,255,175,255,255,0,45,0,0,4,172,6,111,2,38,0,50,0,
+0,0,7,0,106,1,92,255,134,255,255,0,45,0,0,5,193,6,111,2,38,0,51,0,0,0,7,0,
+106,1,92,255,134,255,255,0,90,0,0,4,172,6,200,2,38,0,50,0,0,0,7,0,113,1,100,
+255,112,255,255,0,90,0,0,5,193,6,200,2,38,0,51,0,0,0,7,0,113,1,100,255,112,
+255,255,0,133,0,0,4,223,4,98,2,6,0,45,0,0,255,255,0,133,255,236,4,66,6,87,
+2,38,0,42,0,0,0,7,0,107,2,68,254,179,255,255,0,102,0,0,5,76,5,124,2,38,0,
+118,0,0,0,7,0,107,3,133,253,216,255,255,0,133,255,236,4,66,3,246,2,6,0,42,
+0,0,255,255,0,133,255,236,4,66,5,154,2,38,0,42,0,0,0,7,0,62,2,76,0,0,255,
+255,0,102,0,0,5,76,4,214,2,38,0,118,0,0,0,7,0,62,3,47,255,60,0,2,0,133,0,
+0,6,217,4,242,0,32,0,43,0,0,55,51,38,38,53,52,54,54,51,32,17,17,33,17,16,
+2,33,34,7,39,54,51,32,0,17,17,33,50,21,21,20,35,33,37,53,52,38,35,34,6,21,
+20,22,51,133,236,66,78,109,191,112,1,141,1,13,254,254,243,197,182,47,192,
+234,1,76,1,109,1,10,10,10,249,182,2,215,114,117,104,117,155,129,160,42,155,
+96,125,188,104,254,72,254,242,1,145,1,24,1,7,60,158,64,254,153,254,183,254,
+94,8,142,10,160,239,150,141,127,117,130,156,255,255,255,236,0,0,5,135,4,242,
+2,6,0,43,0,0,255,255,255,236,0,0,6,156,4,242,2,6,0,44,0,0,255,255,0,205,1,
+133,1,213,3,4,2,6,0,65,0,0,255,255,0,205,0,0,1,131,5,100,2,6,0,66,0,0,255,
+255,0,92,0,0,3,141,5,100,2,6,0,67,0,0,255,255,0,92,0,0,4,90,5,100,2,6,0,68,
+0,0,255,255,0,61,0,0,3,164,5,121,2,6,0,74,0,0,255,255,0,41,0,0,4,16,5,100,
+2,6,0,72,0,0,255,255,0,41,0,0,4,16,5,100,2,6,0,73,0,0,0,1,0,92,0,0,3,238,
+5,154,0,15,0,0,19,55,22,22,23,54,54,55,21,6,6,7,38,39,1,35,92,166,129,150,
+112,77,176,104,100,193,64,132,214,1,51,184,5,4,150,70,111,106,92,135,60,187,
+61,184,93,162,143,251,66,0,0,1,0,72,0,0,3,121,5,100,0,6,0,0,1,51,1,33,21,
+33,53,1,246,196,254,82,2,109,252,207,5,100,251,66,166,145,255,255,255,16,
+6,53,0,240,8,63,2,6,0,98,0,0,255,255,254,145,6,61,1,96,8,10,2,6,0,102,0,0,
+255,255,255,16,252,231,0,240,254,242,2,6,0,99,0,0,255,255,255,16,6,53,0,240,
+7,88,2,6,0,100,0,0,255,255,254,211,6,61,1,45,8,10,2,6,0,101,0,0,255,255,255,
+16,253,207,0,240,254,242,2,6,0,103,0,0,255,255,254,186,6,115,1,72,8,12,2,
+6,0,104,0,0,255,255,255,31,6,135,0,227,8,53,2,6,0,105,0,0,0,2,255,2,4,170,
+0,215,7,51,0,20,0,24,0,0,3,34,38,53,52,55,51,6,21,20,51,51,50,54,53,53,51,
+21,20,6,35,3,51,17,35,66,86,102,37,80,33,123,24,82,76,80,112,121,33,80,80,
+4,170,117,108,116,93,81,122,157,73,74,215,209,112,115,2,137,254,178,255,255,
+254,145,6,115,1,96,10,37,2,38,0,104,0,0,0,7,0,102,0,0,2,27,255,255,254,186,
+4,129,1,107,8,12,2,38,0,104,0,0,0,7,0,99,0,123,7,154,255,255,254,144,6,115,
+1,72,10,32,2,38,0,104,0,0,0,7,0,98,255,128,1,225,255,255,254,179,6,115,1,
+72,9,88,2,38,0,104,0,0,0,7,0,100,255,163,2,0,255,255,254,186,6,115,1,72,10,
+45,2,38,0,104,0,0,0,7,0,101,0,0,2,35,255,255,254,186,5,62,1,97,8,12,2,38,
+0,104,0,0,0,7,0,103,0,113,7,111,255,255,254,186,6,115,1,72,10,20,2,38,0,104,
+0,0,0,7,0,109,0,0,2,10,255,255,255,16,5,254,0,240,9,196,0,39,0,98,0,0,1,133,
+0,6,0,107,0,0,255,255,255,16,5,254,0,240,8,213,0,39,0,100,0,0,1,125,0,6,0,
+107,0,0,255,255,254,145,5,254,1,96,9,192,0,39,0,102,0,0,1,182,0,6,0,107,0,
+0,255,255,254,211,5,254,1,45,9,209,0,39,0,101,0,0,1,199,0,6,0,107,0,0,255,
+255,255,31,5,254,0,227,9,182,0,39,0,105,0,0,1,129,0,6,0,107,0,0,255,255,255,
+16,251,201,0,240,255,137,0,39,0,99,0,0,254,226,0,6,0,108,0,0,255,255,255,
+16,252,169,0,240,255,137,0,39,0,103,0,0,254,218,0,6,0,108,0,0,255,255,255,
+180,0,0,1,236,7,164,2,38,0,123,0,0,0,7,2,184,1,43,0,0,255,255,255,180,0,0,
+2,156,7,164,2,38,0,124,0,0,0,7,2,184,1,43,0,0,255,255,255,188,253,231,1,244,
+6,20,2,38,0,5,0,0,0,7,2,185,1,51,0,0,255,255,255,188,253,231,2,156,6,20,2,
+38,0,6,0,0,0,7,2,185,1,51,0,0,255,255,0,205,0,0,3,117,5,155,2,38,0,123,0,
+0,0,7,0,107,2,180,253,247,255,255,0,205,0,0,3,117,5,155,2,38,0,124,0,0,0,
+7,0,107,2,180,253,247,255,255,0,133,254,20,4,152,6,59,2,38,0,46,0,0,0,7,0,
+107,3,215,254,151,255,255,0,133,254,20,4,154,6,59,2,38,0,47,0,0,0,7,0,107,
+3,217,254,151,255,255,255,244,254,20,4,152,6,59,2,38,0,46,0,0,0,39,0,107,
+3,215,254,151,0,7,0,101,1,33,254,34,255,255,255,244,254,20,4,154,6,59,2,38,
+0,47,0,0,0,39,0,107,3,217,254,151,0,7,0,101,1,33,254,34,255,255,0,133,254,
+20,6,111,6,20,2,38,0,48,0,0,0,7,0,107,5,43,254,112,255,255,0,133,254,20,7,
+203,5,28,2,38,0,49,0,0,0,7,0,107,4,223,253,120,255,255,0,133,0,0,5,139,5,
+85,2,38,0,53,0,0,0,7,2,172,3,4,254,73,255,255,0,133,0,0,6,166,5,85,2,38,0,
+54,0,0,0,7,2,172,3,4,254,73,255,255,255,236,0,0,1,199,7,12,2,38,0,114,0,0,
+0,7,2,172,1,84,0,0,255,255,255,236,0,0,3,53,7,12,2,38,0,117,0,0,0,7,2,172,
+1,156,0,0,255,255,0,133,252,244,5,139,3,225,2,38,0,53,0,0,0,7,2,173,3,86,
+0,0,255,255,0,133,252,244,6,166,3,225,2,38,0,54,0,0,0,7,2,173,3,86,0,0,255,
+255,255,236,252,244,1,199,3,225,2,38,0,114,0,0,0,7,2,173,1,84,0,0,255,255,
+255,236,252,244,2,207,3,225,2,38,0,115,0,0,0,7,2,173,1,84,0,0,255,255,0,133,
+254,185,5,139,4,216,2,38,0,53,0,0,0,39,0,62,3,10,255,62,0,7,0,105,3,61,248,
+50,255,255,0,133,254,185,6,166,4,216,2,38,0,54,0,0,0,39,0,105,3,61,248,50,
+0,7,0,62,3,10,255,62,255,255,255,236,254,185,2,242,5,154,2,38,0,116,0,0,0,
+39,0,62,1,209,0,0,0,7,0,105,1,45,248,50,255,255,255,236,254,185,3,53,5,154,
+2,38,0,117,0,0,0,39,0,62,1,158,0,0,0,7,0,105,1,170,248,50,255,255,0,133,0,
+0,5,139,4,216,2,38,0,53,0,0,0,7,2,186,3,18,254,64,255,255,0,133,0,0,6,166,
+4,216,2,38,0,54,0,0,0,7,2,186,3,18,254,64,255,255,255,236,0,0,2,242,6,152,
+2,38,0,116,0,0,0,7,2,186,1,207,0,0,255,255,255,236,0,0,3,53,6,152,2,38,0,
+117,0,0,0,7,2,186,1,158,0,0,255,255,0,133,0,0,5,139,5,75,2,38,0,53,0,0,0,
+7,2,178,3,20,254,85,255,255,0,133,0,0,6,166,5,75,2,38,0,54,0,0,0,7,2,178,
+3,20,254,85,255,255,255,236,0,0,2,207,6,246,2,38,0,116,0,0,0,7,2,178,1,203,
+0,0,255,255,255,236,0,0,3,53,6,246,2,38,0,117,0,0,0,7,2,178,1,152,0,0,255,
+255,0,133,253,6,5,139,3,225,2,38,0,53,0,0,0,7,2,179,3,23,0,0,255,255,0,133,
+253,6,6,166,3,225,2,38,0,54,0,0,0,7,2,179,3,23,0,0,255,255,255,236,253,6,
+2,53,3,225,2,38,0,116,0,0,0,7,2,179,1,31,0,0,255,255,255,236,253,6,3,53,3,
+225,2,38,0,117,0,0,0,7,2,179,1,164,0,0,255,255,0,92,253,111,4,162,6,67,2,
+38,0,7,0,0,0,7,0,107,1,195,254,159,255,255,0,92,253,111,4,254,6,67,2,38,0,
+10,0,0,0,7,0,107,1,195,254,159,255,255,255,236,0,0,4,31,6,67,2,38,0,8,0,0,
+0,7,0,107,1,195,254,159,255,255,255,236,0,0,4,172,6,67,2,38,0,9,0,0,0,7,0,
+107,1,195,254,159,255,255,0,92,253,111,4,162,7,12,2,38,0,7,0,0,0,7,2,172,
+1,186,0,0,255,255,0,92,253,111,4,254,7,12,2,38,0,10,0,0,0,7,2,172,1,186,0,
+0,255,255,255,236,0,0,4,31,7,12,2,38,0,8,0,0,0,7,2,172,1,186,0,0,255,255,
+255,236,0,0,4,172,7,12,2,38,0,9,0,0,0,7,2,172,1,186,0,0,255,255,0,92,253,
+111,4,162,3,246,2,38,0,7,0,0,0,7,0,122,3,20,0,70,255,255,0,92,253,111,4,254,
+3,246,2,38,0,10,0,0,0,7,0,122,3,20,0,70,255,255,255,236,254,102,4,31,3,246,
+2,38,0,8,0,0,0,7,0,122,1,244,0,0,255,255,255,236,254,102,4,172,3,246,2,38,
+0,9,0,0,0,7,0,122,1,244,0,0,255,255,0,92,253,111,4,162,3,246,2,38,2,235,0,
+0,0,7,2,173,3,35,0,125,255,255,0,92,253,111,4,254,3,246,2,38,2,236,0,0,0,
+7,2,173,3,35,0,125,255,255,255,236,252,244,4,31,3,246,2,38,0,8,0,0,0,7,2,
+173,1,223,0,0,255,255,255,236,252,244,4,172,3,246,2,38,0,9,0,0,0,7,2,173,
+1,223,0,0,255,255,0,92,253,111,4,162,6,154,2,38,0,7,0,0,0,7,0,63,1,213,0,
+0,255,255,0,92,253,111,4,254,6,154,2,38,0,10,0,0,0,7,0,63,1,213,0,0,255,255,
+255,236,0,0,4,31,6,154,2,38,0,8,0,0,0,7,0,63,1,213,0,0,255,255,255,236,0,
+0,4,172,6,154,2,38,0,9,0,0,0,7,0,63,1,213,0,0,255,255,0,92,253,111,4,162,
+3,246,2,38,2,235,0,0,0,7,2,179,3,127,0,111,255,255,0,92,253,111,4,254,3,246,
+2,38,2,236,0,0,0,7,2,179,3,127,0,111,255,255,255,236,253,6,4,31,3,246,2,38,
+0,8,0,0,0,7,2,179,1,231,0,0,255,255,255,236,253,6,4,172,3,246,2,38,0,9,0,
+0,0,7,2,179,1,231,0,0,255,255,0,92,254,185,3,182,4,94,2,38,0,11,0,0,0,7,0,
+105,2,6,248,50,255,255,0,92,254,185,4,162,4,94,2,38,0,112,0,0,0,7,0,105,2,
+6,248,50,255,255,0,92,254,102,3,182,4,94,2,38,0,11,0,0,0,7,0,121,2,18,0,0,
+255,255,0,92,254,102,4,162,4,94,2,38,0,112,0,0,0,7,0,121,2,18,0,0,255,255,
+0,92,254,102,3,182,6,223,2,38,0,11,0,0,0,39,0,111,1,160,0,94,0,7,0,121,2,
+18,0,0,255,255,0,92,254,102,4,162,6,223,2,38,0,112,0,0,0,39,0,111,1,160,0,
+94,0,7,0,121,2,18,0,0,255,255,0,72,0,0,3,182,6,21,2,38,0,11,0,0,0,7,0,62,
+1,111,0,123,255,255,0,72,0,0,4,162,6,21,2,38,0,112,0,0,0,7,0,62,1,111,0,123,
+255,255,0,92,254,102,3,182,4,94,2,38,0,11,0,0,0,7,0,122,2,23,0,0,255,255,
+0,92,254,102,4,162,4,94,2,38,0,112,0,0,0,7,0,122,2,23,0,0,255,255,0,71,0,
+0,3,182,7,21,2,38,0,11,0,0,0,7,0,63,1,106,0,123,255,255,0,71,0,0,4,162,7,
+21,2,38,0,112,0,0,0,7,0,63,1,106,0,123,255,255,0,76,0,0,3,182,7,11,2,38,0,
+11,0,0,0,7,2,186,1,113,0,115,255,255,0,76,0,0,4,162,7,11,2,38,0,112,0,0,0,
+7,2,186,1,113,0,115,255,255,0,92,0,0,3,182,6,246,2,38,0,11,0,0,0,7,2,178,
+1,111,0,0,255,255,0,92,0,0,4,162,6,246,2,38,0,112,0,0,0,7,2,178,1,111,0,0,
+255,255,255,174,254,20,2,176,6,65,2,38,0,12,0,0,0,7,2,181,1,141,255,161,255,
+255,255,174,254,20,2,244,6,65,2,38,0,13,0,0,0,7,2,181,1,182,255,161,255,255,
+255,174,253,27,2,118,3,225,2,38,0,12,0,0,0,7,0,105,1,147,246,148,255,255,
+255,174,253,27,2,244,3,225,2,38,0,13,0,0,0,7,0,105,1,188,246,148,255,255,
+255,174,252,179,1,236,3,225,2,38,0,12,0,0,0,7,0,121,1,16,254,77,255,255,255,
+174,252,179,2,244,3,225,2,38,0,13,0,0,0,7,0,121,1,57,254,77,255,255,255,174,
+251,220,2,27,3,225,2,38,0,12,0,0,0,7,2,181,0,248,246,212,255,255,255,174,
+251,220,2,244,3,225,2,38,0,13,0,0,0,7,2,181,1,33,246,212,255,255,255,174,
+252,179,1,236,3,225,2,38,0,12,0,0,0,39,0,121,1,16,254,77,0,7,0,121,0,158,
+1,154,255,255,255,174,252,179,2,244,3,225,2,38,0,13,0,0,0,39,0,121,1,57,254,
+77,0,7,0,121,0,156,1,154,255,255,255,174,254,20,2,176,5,154,2,38,0,12,0,0,
+0,7,0,62,1,143,0,0,255,255,255,174,254,20,2,244,5,154,2,38,0,13,0,0,0,7,0,
+62,1,184,0,0,255,255,255,174,254,20,2,149,6,222,2,38,0,12,0,0,0,7,2,178,1,
+145,255,232,255,255,255,174,254,20,2,244,6,222,2,38,0,13,0,0,0,7,2,178,1,
+186,255,232,255,255,0,133,254,20,9,66,5,154,2,38,0,14,0,0,0,39,0,61,6,180,
+0,0,0,7,0,121,6,172,0,0,255,255,0,133,254,20,10,94,5,154,2,38,0,17,0,0,0,
+39,0,121,6,172,0,0,0,7,0,61,6,180,0,0,255,255,255,236,254,102,6,88,5,154,
+2,38,0,15,0,0,0,39,0,61,3,209,0,0,0,7,0,121,3,201,0,0,255,255,255,236,254,
+102,7,117,5,154,2,38,0,16,0,0,0,39,0,61,3,219,0,0,0,7,0,121,3,211,0,0,255,
+255,0,133,253,80,9,66,3,225,2,38,0,14,0,0,0,7,0,64,6,170,0,0,255,255,0,133,
+253,80,10,94,3,225,2,38,0,17,0,0,0,7,0,64,6,170,0,0,255,255,255,236,253,80,
+6,88,3,225,2,38,0,15,0,0,0,7,0,64,3,201,0,0,255,255,255,236,253,80,7,117,
+3,225,2,38,0,16,0,0,0,7,0,64,3,201,0,0,255,255,0,133,253,80,9,66,6,154,2,
+38,0,14,0,0,0,39,0,64,6,170,0,0,0,7,0,63,6,190,0,0,255,255,0,133,253,80,10,
+94,6,154,2,38,0,17,0,0,0,39,0,64,6,170,0,0,0,7,0,63,6,190,0,0,255,255,255,
+236,253,80,6,88,6,154,2,38,0,15,0,0,0,39,0,64,3,201,0,0,0,7,0,63,3,190,0,
+0,255,255,255,236,253,80,7,117,6,154,2,38,0,16,0,0,0,39,0,64,3,201,0,0,0,
+7,0,63,3,190,0,0,255,255,0,133,254,20,8,190,3,246,2,38,0,18,0,0,0,7,0,122,
+6,139,0,0,255,255,0,133,254,20,9,219,3,246,2,38,0,21,0,0,0,7,0,122,6,139,
+0,0,255,255,255,236,254,102,5,170,3,246,2,38,0,19,0,0,0,7,0,122,3,70,0,0,
+255,255,255,236,254,102,6,195,3,246,2,38,0,20,0,0,0,7,0,122,3,70,0,0,255,
+255,0,133,254,20,8,190,6,154,2,38,0,18,0,0,0,7,0,63,6,190,0,0,255,255,0,133,
+254,20,9,219,6,154,2,38,0,21,0,0,0,7,0,63,6,190,0,0,255,255,255,236,0,0,5,
+170,6,154,2,38,0,19,0,0,0,7,0,63,4,0,0,0,255,255,255,236,0,0,6,195,6,154,
+2,38,0,20,0,0,0,7,0,63,4,0,0,0,255,255,0,41,0,0,5,231,6,154,2,38,0,22,0,0,
+0,7,0,63,4,0,0,0,255,255,0,61,0,0,6,215,6,154,2,38,0,25,0,0,0,7,0,63,4,0,
+0,0,255,255,0,133,253,111,3,236,6,154,2,38,0,26,0,0,0,7,0,63,2,133,0,0,255,
+255,0,133,253,111,4,254,6,154,2,38,0,29,0,0,0,7,0,63,2,133,0,0,255,255,255,
+236,0,0,3,195,6,154,2,38,0,27,0,0,0,7,0,63,2,133,0,0,255,255,255,236,0,0,
+4,213,6,154,2,38,0,28,0,0,0,7,0,63,2,92,0,0,255,255,0,133,0,0,7,106,3,225,
+2,6,0,57,0,0,255,255,0,133,254,102,7,106,3,225,2,38,0,57,0,0,0,7,0,121,6,
+0,0,0,255,255,0,133,254,102,8,86,3,225,2,38,0,58,0,0,0,7,0,121,6,0,0,0,255,
+255,255,236,254,102,4,0,3,225,2,38,0,55,0,0,0,7,0,121,2,145,0,0,255,255,255,
+236,254,102,4,227,3,225,2,38,0,56,0,0,0,7,0,121,2,145,0,0,255,255,0,133,254,
+102,7,106,5,154,2,38,0,57,0,0,0,39,0,61,5,231,0,0,0,7,0,121,6,0,0,0,255,255,
+0,133,254,102,8,86,5,154,2,38,0,58,0,0,0,39,0,61,5,231,0,0,0,7,0,121,6,0,
+0,0,255,255,255,236,254,102,4,0,5,154,2,38,0,55,0,0,0,39,0,61,2,123,0,0,0,
+7,0,121,2,145,0,0,255,255,255,236,254,102,4,227,5,154,2,38,0,56,0,0,0,39,
+0,61,2,141,0,0,0,7,0,121,2,145,0,0,255,255,0,133,0,0,8,86,6,154,2,38,0,58,
+0,0,0,7,0,63,5,244,0,0,255,255,255,236,0,0,4,0,6,154,2,38,0,55,0,0,0,7,0,
+63,2,143,0,0,255,255,255,236,0,0,4,227,6,154,2,38,0,56,0,0,0,7,0,63,2,143,
+0,0,255,255,0,133,253,80,7,106,3,225,2,38,0,57,0,0,0,7,0,64,5,217,0,0,255,
+255,0,133,253,80,8,86,3,225,2,38,0,58,0,0,0,7,0,64,5,217,0,0,255,255,255,
+236,253,80,4,0,3,225,2,38,0,55,0,0,0,7,0,64,2,127,0,0,255,255,255,236,253,
+80,4,227,3,225,2,38,0,56,0,0,0,7,0,64,2,127,0,0,255,255,0,133,0,0,7,106,6,
+246,2,38,0,57,0,0,0,7,2,178,5,209,0,0,255,255,0,133,0,0,8,86,6,246,2,38,0,
+58,0,0,0,7,2,178,5,209,0,0,255,255,255,236,0,0,4,0,6,246,2,38,0,55,0,0,0,
+7,2,178,2,139,0,0,255,255,255,236,0,0,4,227,6,246,2,38,0,56,0,0,0,7,2,178,
+2,139,0,0,255,255,0,133,254,20,6,84,5,154,2,38,0,59,0,0,0,7,0,61,4,229,0,
+0,255,255,0,133,254,20,7,63,5,154,2,38,0,60,0,0,0,7,0,61,4,229,0,0,255,255,
+0,133,254,20,6,84,6,154,2,38,0,59,0,0,0,7,0,63,4,246,0,0,255,255,0,133,254,
+20,7,63,6,154,2,38,0,60,0,0,0,7,0,63,4,246,0,0,0,1,0,41,0,0,8,119,5,68,0,
+26,0,0,33,34,36,39,55,22,22,51,33,53,52,38,35,33,53,54,0,55,23,6,0,7,33,32,
+4,21,21,3,8,189,254,78,112,20,142,214,220,5,76,187,190,251,178,100,1,155,
+210,65,191,254,158,71,3,164,1,13,1,26,79,50,92,34,27,57,154,143,168,210,1,
+118,82,156,77,254,215,144,222,204,248,0,0,1,0,41,0,0,9,109,5,68,0,32,0,0,
+33,34,36,39,55,22,22,51,33,53,52,38,35,33,53,54,0,55,23,6,0,7,33,32,4,21,
+21,51,50,21,21,20,35,3,8,189,254,78,112,20,142,214,220,5,76,187,190,251,178,
+100,1,155,210,65,191,254,158,71,3,164,1,13,1,26,235,11,11,79,50,92,34,27,
+57,154,143,168,210,1,118,82,156,77,254,215,144,222,204,88,8,142,10,0,0,1,
+255,236,0,0,7,131,5,68,0,20,0,0,39,33,53,52,38,35,33,53,54,0,55,23,6,0,7,
+33,32,4,21,21,33,20,6,233,184,193,251,178,99,1,154,212,66,189,254,156,72,
+3,164,1,13,1,26,248,105,160,57,153,144,168,206,1,122,82,156,76,254,216,146,
+222,204,248,0,1,255,236,0,0,8,135,5,68,0,26,0,0,39,33,53,52,38,35,33,53,54,
+0,55,23,6,0,7,33,32,4,21,21,51,50,21,21,20,35,33,20,6,233,184,193,251,178,
+99,1,154,212,66,189,254,156,72,3,164,1,13,1,26,250,10,10,247,111,160,57,153,
+144,168,206,1,122,82,156,76,254,216,146,222,204,88,8,142,10,0,2,0,133,0,0,
+5,221,6,131,0,42,0,54,0,0,1,34,38,39,6,7,51,32,4,21,17,33,34,38,53,52,54,
+55,51,6,21,20,22,51,33,17,52,38,35,33,53,54,18,36,55,23,6,7,22,22,21,20,6,
+39,50,54,53,52,38,35,34,6,21,20,22,4,158,92,121,11,131,55,178,1,12,1,27,252,
+39,186,197,22,19,164,31,109,94,3,49,184,193,254,164,66,232,1,31,136,66,75,
+32,59,70,123,106,49,63,63,49,50,63,57,4,27,94,88,127,113,220,206,253,201,
+190,177,52,154,70,170,86,106,121,1,121,153,144,167,138,1,11,209,52,156,32,
+17,23,100,71,97,120,102,59,54,54,58,58,54,54,59,0,2,0,133,0,0,6,242,6,131,
+0,48,0,60,0,0,1,34,38,39,6,7,51,32,4,21,17,33,50,21,21,20,35,33,34,38,53,
+52,54,55,51,6,21,20,22,51,33,17,52,38,35,33,53,54,18,36,55,23,6,7,22,22,21,
+20,6,39,50,54,53,52,38,35,34,6,21,20,22,4,158,92,121,11,131,55,178,1,12,1,
+27,1,10,11,11,251,29,186,197,22,19,164,31,109,94,3,49,184,193,254,164,66,
+232,1,31,136,66,75,32,59,70,123,106,49,63,63,49,50,63,57,4,27,94,88,127,113,
+220,206,254,105,8,142,10,190,177,52,154,70,170,86,106,121,1,121,153,144,167,
+138,1,11,209,52,156,32,17,23,100,71,97,120,102,59,54,54,58,58,54,54,59,0,
+0,2,255,236,0,0,4,2,6,131,0,35,0,47,0,0,1,34,38,39,6,7,51,32,4,21,17,33,34,
+53,53,52,51,33,17,52,38,35,33,53,54,18,36,55,23,6,7,22,22,21,20,6,39,50,54,
+53,52,38,35,34,6,21,20,22,2,195,92,121,11,130,56,178,1,12,1,27,251,244,10,
+10,3,94,184,193,254,164,66,232,1,31,136,65,70,36,59,70,123,106,49,63,63,49,
+50,63,57,4,27,94,88,123,117,220,206,253,201,10,142,8,1,121,153,144,167,138,
+1,11,209,52,156,30,19,23,100,71,97,120,102,59,54,54,58,58,54,54,59,0,0,2,
+255,236,0,0,5,23,6,131,0,41,0,53,0,0,1,34,38,39,6,7,51,32,4,21,17,33,50,21,
+21,20,35,33,34,53,53,52,51,33,17,52,38,35,33,53,54,18,36,55,23,6,7,22,22,
+21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,2,195,92,121,11,130,56,178,1,12,
+1,27,1,10,11,11,250,234,10,10,3,94,184,193,254,164,66,232,1,31,136,65,70,
+36,59,70,123,106,49,63,63,49,50,63,57,4,27,94,88,123,117,220,206,254,105,
+8,142,10,10,142,8,1,121,153,144,167,138,1,11,209,52,156,30,19,23,100,71,97,
+120,102,59,54,54,58,58,54,54,59,255,255,0,133,0,0,5,139,6,21,2,38,0,32,0,
+0,0,7,0,61,3,14,0,123,255,255,0,133,0,0,6,166,6,21,2,38,0,33,0,0,0,7,0,61,
+3,14,0,123,255,255,255,236,0,0,4,2,7,11,2,38,0,30,0,0,0,7,0,61,1,55,1,113,
+255,255,255,236,0,0,5,23,7,11,2,38,0,31,0,0,0,7,0,61,1,55,1,113,255,255,0,
+133,0,0,5,139,6,154,2,38,0,32,0,0,0,7,0,63,3,10,0,0,255,255,0,133,0,0,6,166,
+6,154,2,38,0,33,0,0,0,7,0,63,3,10,0,0,255,255,255,236,0,0,4,2,7,31,2,38,0,
+30,0,0,0,6,2,239,0,0,255,255,255,236,0,0,5,23,7,31,2,38,0,31,0,0,0,6,2,239,
+0,0,255,255,0,133,253,80,5,139,6,20,2,38,0,32,0,0,0,7,0,64,3,33,0,0,255,255,
+0,133,253,80,6,166,6,20,2,38,0,33,0,0,0,7,0,64,3,33,0,0,255,255,255,236,253,
+80,4,2,6,131,2,38,0,30,0,0,0,7,0,64,1,254,0,0,255,255,255,236,253,80,5,23,
+6,131,2,38,0,31,0,0,0,7,0,64,1,246,0,0,255,255,0,133,0,0,5,221,7,88,2,38,
+1,167,0,0,0,7,2,237,2,35,0,0,255,255,0,133,0,0,6,242,7,88,2,38,1,168,0,0,
+0,7,2,237,2,35,0,0,255,255,255,236,0,0,4,2,7,88,2,38,1,169,0,0,0,6,2,237,
+76,0,255,255,255,236,0,0,5,23,7,88,2,38,1,170,0,0,0,6,2,237,76,0,255,255,
+0,133,0,0,5,221,7,203,2,38,0,83,0,0,0,39,2,237,2,35,0,0,0,7,2,240,1,215,0,
+0,255,255,0,133,0,0,6,242,7,203,2,38,0,84,0,0,0,39,2,237,2,35,0,0,0,7,2,240,
+1,215,0,0,255,255,255,236,0,0,4,2,7,203,2,38,0,30,0,0,0,38,2,237,76,0,0,6,
+2,240,0,0,255,255,255,236,0,0,5,23,7,203,2,38,0,31,0,0,0,38,2,237,76,0,0,
+6,2,240,0,0,255,255,0,133,254,102,5,221,7,88,2,38,0,83,0,0,0,39,2,237,2,35,
+0,0,0,7,0,122,3,88,0,0,255,255,0,133,254,102,6,242,7,88,2,38,0,84,0,0,0,39,
+2,237,2,35,0,0,0,7,0,122,3,88,0,0,255,255,255,236,254,102,4,2,7,88,2,38,0,
+30,0,0,0,38,2,237,76,0,0,7,0,122,2,6,0,0,255,255,255,236,254,102,5,23,7,88,
+2,38,0,31,0,0,0,38,2,237,76,0,0,7,0,122,2,4,0,0,255,255,0,133,252,244,5,221,
+7,88,2,38,0,83,0,0,0,39,2,237,2,35,0,0,0,7,2,173,3,90,0,0,255,255,0,133,252,
+244,6,242,7,88,2,38,0,84,0,0,0,39,2,237,2,35,0,0,0,7,2,173,3,90,0,0,255,255,
+255,236,252,244,4,2,7,88,2,38,0,30,0,0,0,38,2,237,76,0,0,7,2,173,1,254,0,
+0,255,255,255,236,252,244,5,23,7,88,2,38,0,31,0,0,0,38,2,237,76,0,0,7,2,173,
+2,8,0,0,255,255,0,133,0,0,5,221,8,41,2,38,0,83,0,0,0,39,2,237,2,35,0,0,0,
+7,2,238,1,193,0,219,255,255,0,133,0,0,6,242,8,41,2,38,0,84,0,0,0,39,2,237,
+2,35,0,0,0,7,2,238,1,193,0,219,255,255,255,236,0,0,4,2,8,41,2,38,0,30,0,0,
+0,38,2,237,76,0,0,7,2,238,255,234,0,219,255,255,255,236,0,0,5,23,8,41,2,38,
+0,31,0,0,0,38,2,237,76,0,0,7,2,238,255,234,0,219,255,255,0,133,254,20,5,119,
+8,31,2,38,0,34,0,0,0,7,2,181,4,84,1,127,255,255,0,133,254,20,5,158,8,31,2,
+38,0,37,0,0,0,7,2,181,4,84,1,127,255,255,255,236,0,0,2,103,8,31,2,38,0,35,
+0,0,0,7,2,181,1,68,1,127,255,255,255,236,0,0,2,207,8,31,2,38,0,36,0,0,0,7,
+2,181,1,78,1,127,255,255,0,133,254,20,4,199,7,136,2,38,0,34,0,0,0,7,0,61,
+4,84,1,238,255,255,0,133,254,20,5,158,7,136,2,38,0,37,0,0,0,7,0,61,4,84,1,
+238,255,255,255,236,0,0,1,203,7,136,2,38,0,35,0,0,0,7,0,61,1,88,1,238,255,
+255,255,236,0,0,2,207,7,136,2,38,0,36,0,0,0,7,0,61,1,94,1,238,255,255,0,133,
+254,20,5,21,8,25,2,38,0,34,0,0,0,7,2,176,4,72,1,203,255,255,0,133,254,20,
+5,158,8,25,2,38,0,37,0,0,0,7,2,176,4,72,1,203,255,255,255,236,0,0,2,21,8,
+25,2,38,0,35,0,0,0,7,2,176,1,72,1,203,255,255,255,236,0,0,2,207,8,25,2,38,
+0,36,0,0,0,7,2,176,1,94,1,203,255,255,0,133,252,22,4,178,6,20,2,38,0,34,0,
+0,0,7,2,177,2,166,254,124,255,255,0,133,252,22,5,158,6,20,2,38,0,37,0,0,0,
+7,2,177,2,166,254,124,255,255,255,236,253,80,2,100,6,20,2,38,0,35,0,0,0,7,
+0,64,1,63,0,0,255,255,255,236,253,80,2,207,6,20,2,38,0,36,0,0,0,7,0,64,1,
+90,0,0,255,255,0,133,252,123,4,178,4,216,2,38,0,89,0,0,0,39,0,61,2,160,255,
+62,0,7,0,121,2,150,254,21,255,255,0,133,252,123,5,158,4,216,2,38,0,90,0,0,
+0,39,0,61,2,160,255,62,0,7,0,121,2,150,254,21,255,255,255,236,254,102,1,203,
+5,154,2,38,0,114,0,0,0,39,0,61,1,88,0,0,0,7,0,121,1,68,0,0,255,255,255,236,
+254,102,2,207,5,154,2,38,0,115,0,0,0,39,0,61,1,88,0,0,0,7,0,121,1,68,0,0,
+255,255,0,133,254,20,4,178,5,87,2,38,0,89,0,0,0,7,0,111,2,178,254,214,255,
+255,0,133,254,20,5,158,5,87,2,38,0,90,0,0,0,7,0,111,2,178,254,214,255,255,
+0,133,252,206,4,178,4,216,2,38,0,89,0,0,0,39,0,61,2,160,255,62,0,7,0,105,
+2,125,246,71,255,255,0,133,252,206,5,158,4,216,2,38,0,90,0,0,0,39,0,61,2,
+160,255,62,0,7,0,105,2,125,246,71,255,255,255,236,254,185,1,215,5,154,2,38,
+0,114,0,0,0,39,0,61,1,88,0,0,0,7,0,105,0,244,248,50,255,255,255,236,254,185,
+2,207,5,154,2,38,0,115,0,0,0,39,0,61,1,88,0,0,0,7,0,105,1,90,248,50,255,255,
+0,133,254,20,4,178,4,227,2,38,0,89,0,0,0,7,0,63,2,117,254,73,255,255,0,133,
+254,20,5,158,4,227,2,38,0,90,0,0,0,7,0,63,2,117,254,73,255,255,0,92,253,111,
+4,162,5,154,2,38,2,235,0,0,0,39,0,61,2,18,0,0,0,7,0,64,3,55,0,98,255,255,
+0,92,253,111,4,254,5,154,2,38,2,236,0,0,0,39,0,64,3,55,0,98,0,7,0,61,2,18,
+0,0,255,255,255,236,253,113,4,31,5,154,2,38,0,8,0,0,0,39,0,61,1,213,0,0,0,
+7,0,64,1,215,0,33,255,255,255,236,253,113,4,172,5,154,2,38,0,9,0,0,0,39,0,
+61,1,213,0,0,0,7,0,64,1,215,0,33,0,3,0,145,253,113,3,207,3,225,0,23,0,32,
+0,44,0,0,1,55,38,38,53,52,54,51,50,23,55,53,35,34,38,53,52,0,33,33,17,20,
+2,7,19,17,35,34,6,21,20,22,51,19,50,54,53,52,38,35,34,6,21,20,22,2,18,76,
+73,82,104,98,93,55,2,201,218,239,1,50,1,0,1,12,157,175,158,88,182,203,139,
+141,45,39,53,55,37,40,52,47,253,242,65,14,97,80,94,100,49,12,113,240,227,
+241,1,29,251,197,146,254,244,151,3,47,2,162,192,173,160,149,253,246,50,42,
+49,43,52,40,43,49,0,3,0,145,253,113,4,129,3,225,0,31,0,40,0,52,0,0,33,21,
+20,2,7,39,55,38,38,53,52,54,51,50,23,55,53,35,34,38,53,52,0,33,33,17,51,50,
+21,21,20,35,37,17,35,34,6,21,20,22,51,19,50,54,53,52,38,35,34,6,21,20,22,
+3,207,157,175,113,76,73,82,104,98,93,55,2,201,218,239,1,50,1,0,1,12,168,10,
+10,254,170,88,182,203,139,141,45,39,53,55,37,40,52,47,90,146,254,244,151,
+129,65,14,97,80,94,100,49,12,113,240,227,241,1,29,252,191,8,142,10,160,2,
+162,192,173,160,149,253,246,50,42,49,43,52,40,43,49,0,0,2,0,145,253,113,3,
+207,3,225,0,31,0,40,0,0,5,54,54,51,50,23,22,23,54,53,53,35,34,38,53,52,0,
+33,33,17,20,2,7,39,54,55,39,38,38,35,34,7,1,17,35,34,6,21,20,22,51,1,100,
+54,71,41,50,77,99,40,15,201,218,239,1,50,1,0,1,12,157,175,113,149,60,58,60,
+65,36,41,71,1,137,88,182,203,139,141,203,42,32,28,37,9,54,49,100,240,227,
+241,1,29,251,197,146,254,244,151,129,123,94,21,24,16,31,1,183,2,162,192,173,
+160,149,0,0,1,0,41,254,20,7,98,3,225,0,53,0,0,1,6,21,20,22,51,33,50,54,53,
+52,46,2,39,46,2,53,52,18,36,51,50,22,23,7,38,38,35,34,6,6,21,20,22,23,30,
+2,21,20,4,35,33,34,2,53,52,54,55,5,39,37,2,106,57,137,129,1,146,157,183,49,
+73,87,37,123,98,51,181,1,14,124,48,176,40,73,30,111,44,72,187,120,73,81,151,
+127,70,254,238,252,254,71,191,220,27,34,254,148,33,1,244,1,156,181,217,166,
+180,114,95,37,68,62,54,23,73,85,91,54,123,1,15,175,55,27,137,15,20,119,161,
+70,35,77,50,92,120,139,73,171,194,1,10,228,107,152,85,104,102,199,0,0,1,0,
+41,254,20,8,190,2,215,0,66,0,0,1,34,2,53,52,54,55,5,39,37,23,6,21,20,22,51,
+33,50,54,53,52,38,39,46,2,53,52,54,54,51,50,22,22,23,30,3,51,51,50,21,21,
+20,35,35,34,38,39,38,39,38,38,35,34,6,6,21,20,22,23,22,22,21,16,33,3,20,191,
+220,27,34,254,148,33,1,244,77,57,137,129,1,125,146,192,74,78,158,111,62,141,
+224,112,69,106,92,72,88,85,60,67,39,10,10,10,10,87,159,84,27,78,92,120,53,
+56,130,85,92,152,124,120,253,241,254,20,1,10,228,107,152,85,104,102,199,131,
+181,217,166,180,108,77,42,59,23,45,64,98,68,118,220,137,49,92,114,142,98,
+47,25,8,142,10,77,89,29,112,133,103,88,128,51,39,55,46,37,109,76,254,106,
+0,2,254,51,3,225,1,217,6,227,0,27,0,36,0,0,1,34,21,20,51,33,21,33,34,38,53,
+52,54,51,51,17,51,17,51,17,51,21,54,51,50,22,21,21,39,53,52,38,35,34,6,7,
+21,254,207,82,49,1,127,254,129,53,70,90,74,98,74,115,69,87,139,94,94,70,65,
+68,59,96,56,4,166,70,63,64,62,65,68,65,1,254,254,2,1,4,100,133,100,109,147,
+63,82,76,70,66,92,70,0,4,254,113,3,225,1,156,6,227,0,26,0,34,0,44,0,52,0,
+0,3,51,17,51,38,38,53,52,54,51,51,17,33,34,21,20,51,33,21,33,34,38,53,52,
+54,51,51,33,17,35,34,6,21,20,51,3,34,53,52,51,50,22,21,20,6,51,34,53,52,51,
+50,21,20,137,74,186,20,23,124,101,107,253,112,82,50,1,126,254,130,53,70,89,
+74,99,1,223,35,71,82,110,57,47,47,18,27,27,123,47,47,45,6,227,254,2,22,68,
+35,98,111,254,115,70,63,64,62,65,68,65,1,15,75,71,125,1,156,49,49,23,26,26,
+23,49,49,49,49,0,0,2,255,47,3,225,0,215,5,102,0,18,0,30,0,0,3,34,53,53,52,
+51,51,38,53,52,55,54,51,50,22,21,20,6,35,39,20,23,51,50,53,52,38,35,34,7,
+6,205,4,4,103,33,31,61,88,79,91,102,84,90,30,60,112,55,41,52,44,10,3,225,
+4,58,4,72,67,69,62,53,98,82,95,114,219,77,76,143,50,69,35,28,0,1,255,45,3,
+225,0,229,6,80,0,14,0,0,3,51,3,51,19,51,50,53,17,51,17,20,6,35,33,211,182,
+104,76,104,23,88,71,80,71,254,223,4,33,1,192,254,64,96,1,207,254,39,66,84,
+0,2,255,74,3,225,1,0,6,125,0,32,0,42,0,0,19,38,39,6,6,21,20,22,51,50,55,23,
+6,35,34,38,53,52,54,55,39,38,35,34,7,39,54,54,51,50,23,22,23,7,34,53,52,51,
+50,22,21,20,6,213,50,16,141,112,63,61,51,70,8,87,72,76,94,136,171,14,23,98,
+68,76,28,37,96,41,155,27,19,63,229,45,45,18,29,29,4,242,41,30,38,87,55,54,
+46,12,57,19,80,78,77,118,51,73,127,41,58,22,25,172,125,41,207,49,49,23,26,
+26,23,0,255,255,255,53,3,229,0,205,5,67,0,7,2,176,0,0,254,245,0,1,254,115,
+3,225,1,240,6,51,0,40,0,0,1,34,39,6,35,35,20,35,35,34,38,53,52,55,51,6,21,
+20,22,51,51,50,54,53,17,51,17,51,50,54,53,53,51,21,22,22,51,51,17,51,17,1,
+121,81,52,42,77,96,203,59,75,89,32,68,27,51,56,39,72,65,70,90,40,42,69,17,
+48,42,49,70,4,166,57,57,197,109,102,114,79,67,126,65,80,63,66,1,80,254,243,
+54,41,174,207,31,31,1,76,254,115,0,0,1,255,141,3,229,0,115,4,219,0,11,0,0,
+17,34,38,53,52,54,51,50,22,21,20,6,53,62,61,54,55,60,60,3,229,64,59,59,64,
+67,56,56,67,0,0,1,255,35,3,225,0,209,5,119,0,22,0,0,3,34,53,53,52,51,33,38,
+39,38,38,35,34,7,39,54,51,50,22,23,22,23,21,217,4,4,1,96,31,20,12,46,46,55,
+64,29,67,83,73,80,12,24,38,3,225,4,58,4,31,118,71,56,32,57,39,81,91,136,34,
+64,0,2,255,59,3,225,0,227,6,109,0,21,0,34,0,0,3,34,21,21,35,53,52,54,51,51,
+38,53,52,55,54,51,50,22,21,20,6,35,39,20,23,51,50,54,53,52,38,35,34,7,6,70,
+59,68,56,43,8,33,31,63,86,77,93,102,84,90,31,59,61,52,58,39,52,44,10,4,231,
+59,203,215,53,60,72,67,69,62,54,97,84,95,114,220,76,78,81,62,54,65,35,28,
+0,1,254,115,254,20,1,240,0,102,0,41,0,0,1,34,38,39,6,35,35,20,35,35,34,38,
+53,52,55,51,6,21,20,22,51,51,50,54,53,17,51,17,51,50,54,53,53,51,21,22,22,
+51,51,17,51,17,1,121,51,61,21,45,74,96,203,59,75,89,32,68,27,51,56,39,72,
+65,70,90,40,42,69,17,48,42,49,70,254,217,36,21,57,197,109,102,114,79,71,122,
+65,80,63,66,1,80,254,244,54,40,174,207,29,32,1,75,254,115,0,1,255,129,4,139,
+0,131,4,225,0,20,0,0,3,54,51,50,23,22,51,50,54,55,51,6,6,35,34,39,38,35,34,
+6,7,127,11,65,20,38,38,12,16,16,5,37,3,37,34,21,36,37,14,17,16,6,4,139,84,
+17,18,17,20,38,46,18,17,17,20,0,0,2,0,41,3,225,1,123,6,51,0,20,0,29,0,0,19,
+34,39,55,22,51,50,54,53,53,35,34,38,53,52,54,51,51,17,20,6,19,17,35,34,6,
+21,20,22,51,188,85,62,33,54,62,57,62,80,81,101,120,103,109,97,27,37,77,76,
+55,57,3,225,43,56,33,59,49,23,91,97,96,113,254,96,81,97,1,6,1,13,81,65,65,
+58,0,0,1,0,41,3,225,2,35,5,139,0,24,0,0,19,34,38,53,52,54,55,54,54,53,53,
+51,21,20,6,6,7,6,6,21,20,22,51,33,21,164,53,70,66,98,84,41,73,25,53,77,86,
+47,29,20,1,127,3,225,51,56,46,67,38,35,48,52,33,33,45,59,44,34,34,39,31,20,
+21,66,0,1,254,209,3,225,0,203,5,139,0,24,0,0,3,34,38,53,52,54,55,54,54,53,
+53,51,21,20,6,6,7,6,6,21,20,22,51,33,21,180,53,70,66,98,84,41,73,25,53,77,
+86,47,29,20,1,127,3,225,51,56,46,67,38,35,48,52,33,33,45,59,44,34,34,39,31,
+20,21,66,0,2,255,61,3,225,0,231,6,150,0,20,0,31,0,0,3,34,38,53,52,55,51,6,
+21,20,51,51,50,54,53,17,51,17,20,6,35,3,34,38,53,52,51,50,22,21,20,6,31,74,
+90,33,68,27,107,39,72,65,69,96,106,9,20,27,47,19,27,27,3,225,103,96,97,83,
+67,109,137,63,66,1,143,254,119,99,102,2,82,25,24,50,24,26,24,25,0,2,255,88,
+253,111,0,168,254,190,0,3,0,7,0,0,19,7,39,55,23,39,7,23,168,168,168,168,104,
+104,104,104,254,23,168,168,167,167,104,104,105,0,0,2,255,88,3,221,0,168,5,
+45,0,3,0,7,0,0,19,7,39,55,23,39,7,23,168,168,168,168,104,104,104,104,4,133,
+168,168,168,168,103,103,104,0,0,2,255,59,253,14,0,227,255,154,0,21,0,34,0,
+0,3,34,21,21,35,53,52,54,51,51,38,53,52,55,54,51,50,22,21,20,6,35,39,20,23,
+51,50,54,53,52,38,35,34,7,6,70,59,68,56,43,8,33,31,63,86,77,93,102,84,90,
+31,59,61,52,58,39,52,44,10,254,20,59,203,215,53,60,76,63,69,62,54,97,84,95,
+114,220,72,82,81,62,54,65,35,28,255,255,0,133,253,220,8,190,5,154,2,38,0,
+18,0,0,0,39,0,61,6,172,0,0,0,7,0,121,6,180,255,118,255,255,0,133,253,220,
+9,219,5,154,2,38,0,21,0,0,0,39,0,121,6,180,255,118,0,7,0,61,6,172,0,0,255,
+255,255,236,253,220,5,170,5,154,2,38,0,19,0,0,0,39,0,121,3,160,255,118,0,
+7,0,61,3,152,0,0,255,255,255,236,253,220,6,195,5,154,2,38,0,20,0,0,0,39,0,
+121,3,160,255,118,0,7,0,61,3,152,0,0,255,255,0,133,253,111,3,236,5,154,2,
+38,0,26,0,0,0,39,0,61,2,166,0,0,0,7,0,121,2,166,0,61,255,255,0,133,253,111,
+4,254,5,236,2,38,0,29,0,0,0,39,0,121,2,166,0,61,0,7,0,61,2,166,0,82,255,255,
+255,236,254,102,3,195,5,154,2,38,0,27,0,0,0,39,0,61,2,86,0,0,0,7,0,121,2,
+82,0,0,255,255,255,236,254,102,4,213,5,236,2,38,0,28,0,0,0,39,0,121,2,82,
+0,0,0,7,0,61,2,86,0,82,255,255,0,133,253,194,3,154,3,70,2,38,0,4,0,0,0,39,
+0,110,2,172,0,219,0,7,0,110,1,178,0,219,255,255,0,133,253,113,4,172,3,205,
+2,38,0,38,0,0,0,39,0,110,3,78,0,219,0,7,0,110,2,84,0,219,255,255,0,133,0,
+0,5,221,7,52,2,38,0,83,0,0,0,7,2,238,1,233,255,230,255,255,0,133,0,0,6,242,
+7,52,2,38,0,84,0,0,0,7,2,238,1,233,255,230,255,255,255,225,0,0,4,172,7,83,
+2,38,0,50,0,0,0,7,2,184,1,88,255,175,255,255,255,225,0,0,5,193,7,83,2,38,
+0,51,0,0,0,7,2,184,1,88,255,175,255,255,0,92,253,150,4,172,6,20,2,38,0,50,
+0,0,0,7,2,185,2,164,255,175,255,255,0,92,253,150,5,193,6,20,2,38,0,51,0,0,
+0,7,2,185,2,164,255,175,255,255,0,92,0,0,4,172,6,237,2,38,0,50,0,0,0,7,0,
+107,2,227,255,73,255,255,0,92,0,0,5,193,6,237,2,38,0,51,0,0,0,7,0,107,2,227,
+255,73,255,255,0,92,0,0,5,109,8,72,2,38,0,50,0,0,0,7,2,181,4,74,1,168,255,
+255,0,92,0,0,5,193,8,72,2,38,0,51,0,0,0,7,2,181,4,74,1,168,255,255,0,92,0,
+0,4,189,7,146,2,38,0,50,0,0,0,7,0,61,4,74,1,248,255,255,0,92,0,0,5,193,7,
+146,2,38,0,51,0,0,0,7,0,61,4,74,1,248,255,255,0,92,0,0,5,27,7,250,2,38,0,
+50,0,0,0,7,2,176,4,78,1,172,255,255,0,92,0,0,5,193,7,250,2,38,0,51,0,0,0,
+7,2,176,4,78,1,172,255,255,0,92,253,80,4,172,6,20,2,38,0,50,0,0,0,7,0,64,
+2,139,0,0,255,255,0,92,253,80,5,193,6,20,2,38,0,51,0,0,0,7,0,64,2,139,0,0,
+0,1,0,70,254,115,6,221,0,111,0,10,0,0,1,33,34,53,33,52,55,23,6,21,51,6,221,
+249,228,123,5,6,108,154,86,225,254,115,161,206,141,91,130,126,0,1,0,84,254,
+88,11,180,0,0,0,68,0,0,5,20,6,7,39,54,54,53,52,38,35,34,7,4,7,4,35,34,39,
+6,6,35,34,39,38,38,35,34,6,7,6,35,34,38,53,52,55,51,6,21,20,51,50,54,55,54,
+54,51,50,23,22,22,51,50,54,53,53,51,21,20,22,51,50,37,37,36,51,50,22,11,180,
+115,124,58,66,76,24,21,97,255,254,199,44,254,33,244,99,67,37,122,64,81,106,
+69,51,19,32,58,54,89,105,123,104,27,145,27,88,39,59,43,37,95,67,96,85,47,
+62,32,62,69,164,75,54,213,1,184,1,166,1,11,85,72,94,133,89,138,64,92,36,76,
+25,20,23,63,78,8,90,119,55,64,115,73,41,47,71,119,114,117,75,93,97,59,82,
+48,71,60,59,114,63,52,69,62,98,98,66,65,86,87,56,78,0,2,0,92,254,113,9,88,
+0,207,0,13,0,21,0,0,5,20,6,35,33,32,38,53,52,54,51,50,22,23,1,34,21,20,22,
+23,38,38,9,88,55,68,249,115,254,252,240,173,138,174,248,49,254,41,133,218,
+206,48,144,238,86,75,164,165,124,153,238,207,1,21,119,73,83,2,145,132,0,2,
+0,41,254,115,6,180,1,125,0,7,0,20,0,0,5,53,52,38,35,32,1,21,35,17,51,21,0,
+33,50,22,17,17,33,34,53,6,6,163,169,254,238,255,0,174,174,1,24,1,31,232,237,
+249,240,123,238,91,189,177,254,180,125,2,45,241,1,47,252,254,244,254,254,
+159,0,2,0,92,0,0,9,88,2,94,0,13,0,21,0,0,37,20,6,35,33,32,38,53,52,54,51,
+50,22,23,1,34,21,20,22,23,38,38,9,88,55,68,249,115,254,252,240,175,136,173,
+248,50,254,41,133,214,210,47,143,162,86,76,164,166,126,150,235,209,1,20,119,
+74,81,2,142,134,0,2,0,133,253,115,4,193,3,250,0,44,0,55,0,0,1,4,4,7,54,51,
+50,22,22,21,20,6,35,34,38,39,7,39,54,55,38,53,52,37,38,38,53,52,54,54,51,
+50,22,23,7,38,35,34,6,21,20,22,23,54,55,3,34,6,7,22,51,50,54,53,52,38,4,61,
+254,243,254,189,14,214,177,91,163,93,238,195,128,224,67,138,94,90,80,12,1,
+16,108,82,130,231,143,88,148,48,55,127,113,146,161,60,69,155,193,174,91,176,
+93,62,227,118,146,106,1,16,69,243,153,148,74,129,84,149,172,100,88,133,98,
+96,70,46,50,247,194,84,158,108,142,210,113,35,25,153,53,158,145,90,127,57,
+84,59,253,147,81,72,146,84,76,64,75,0,0,2,255,20,5,174,0,199,7,18,0,15,0,
+24,0,0,3,54,53,53,55,21,54,54,51,50,22,21,21,33,6,7,37,53,52,38,35,34,6,7,
+21,236,43,70,38,82,64,63,75,254,190,26,52,1,74,44,38,56,77,37,5,207,63,54,
+174,20,100,60,52,85,72,97,59,43,166,31,45,49,55,62,8,0,0,1,255,57,5,201,0,
+190,7,18,0,33,0,0,3,22,51,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,
+55,21,6,6,35,34,39,6,7,39,54,53,53,55,86,23,35,28,43,75,56,43,45,20,30,36,
+26,39,36,67,62,33,132,52,41,28,21,47,35,43,70,6,80,5,1,28,54,58,58,18,59,
+14,33,35,46,13,8,31,66,14,27,15,49,37,32,63,54,45,21,0,0,2,254,182,4,211,
+1,4,6,244,0,29,0,43,0,0,19,38,39,6,6,21,20,23,7,38,53,52,54,55,39,38,38,35,
+34,7,39,54,54,51,50,22,23,22,22,23,23,34,39,55,22,51,50,54,53,17,55,17,20,
+6,53,42,21,140,106,8,65,17,139,152,5,19,46,49,67,76,29,37,95,40,78,94,13,
+9,41,29,7,39,43,20,35,27,37,40,70,75,5,145,34,36,40,85,53,29,16,37,31,45,
+79,123,48,17,82,56,41,58,22,25,87,77,57,58,18,234,23,55,14,61,49,1,72,21,
+254,167,81,97,0,4,254,195,4,225,1,37,7,63,0,15,0,24,0,38,0,48,0,0,1,54,53,
+53,55,21,54,54,51,50,22,21,21,33,6,7,37,53,52,38,35,34,6,7,21,5,34,39,55,
+22,51,50,54,53,17,55,17,20,6,3,34,38,53,52,51,50,21,20,6,254,195,43,69,40,
+85,60,63,74,254,190,27,51,1,74,44,38,56,77,37,1,94,39,43,21,35,26,38,40,70,
+75,247,18,29,47,45,28,5,84,63,54,174,20,100,63,50,86,72,96,61,42,166,31,45,
+49,55,62,8,248,23,55,14,61,49,1,72,21,254,167,81,97,1,254,23,24,49,49,24,
+23,0,1,254,225,5,137,0,252,6,154,0,25,0,0,1,39,62,2,53,53,55,21,20,22,51,
+50,54,53,53,55,21,20,35,34,38,39,14,2,254,244,19,89,147,61,62,16,35,35,24,
+70,113,37,42,17,26,54,95,5,137,43,15,33,40,31,57,21,51,25,37,34,40,51,21,
+84,131,23,20,35,29,20,0,2,255,152,5,8,0,139,6,139,0,19,0,30,0,0,19,23,7,7,
+6,7,22,22,21,20,6,35,34,38,53,52,54,55,55,54,7,6,21,20,22,51,50,54,53,52,
+38,104,35,10,36,72,27,50,62,71,47,41,51,51,57,26,35,102,16,30,21,18,31,46,
+6,139,51,4,22,44,34,16,68,37,44,67,70,51,51,109,41,19,26,185,27,28,27,40,
+33,14,21,41,0,1,255,133,5,55,0,102,5,254,0,12,0,0,19,20,6,35,34,38,53,51,
+20,51,50,54,53,102,56,58,52,59,43,68,33,32,5,254,103,96,78,78,96,63,74,0,
+255,255,0,88,0,0,3,182,6,158,2,38,0,11,0,0,0,7,2,182,1,102,0,0,255,255,0,
+88,0,0,4,162,6,158,2,38,0,112,0,0,0,7,2,182,1,102,0,0,255,255,255,174,254,
+20,2,147,6,16,2,38,0,12,0,0,0,7,2,182,1,135,255,114,255,255,255,174,254,20,
+2,244,6,16,2,38,0,13,0,0,0,7,2,182,1,176,255,114,255,255,0,134,0,0,6,33,7,
+49,0,39,0,43,0,154,0,0,0,7,2,182,3,147,0,147,255,255,0,133,0,0,6,217,7,49,
+2,38,0,244,0,0,0,7,2,182,3,70,0,147,255,255,255,236,0,0,5,135,7,49,2,38,0,
+43,0,0,0,7,2,182,3,4,0,147,255,255,255,236,0,0,6,156,7,49,2,38,0,44,0,0,0,
+7,2,182,3,4,0,147,0,5,0,133,0,0,11,193,8,113,0,18,0,27,0,31,0,61,0,65,0,0,
+33,34,36,53,52,0,33,51,53,51,17,33,17,51,17,33,17,51,17,37,17,35,34,6,21,
+20,22,51,1,51,17,35,1,34,38,53,53,51,21,20,22,51,50,53,53,51,21,20,22,51,
+50,54,53,53,51,21,20,6,35,34,39,6,3,51,17,35,2,141,246,254,238,1,48,1,1,135,
+175,1,227,182,2,4,182,249,254,129,184,201,174,160,8,129,183,183,250,103,80,
+88,106,33,49,90,96,38,40,56,39,106,90,86,94,49,49,17,117,117,249,224,242,
+1,22,129,252,62,4,65,251,191,4,65,251,31,160,2,162,189,170,153,162,5,116,
+249,236,5,59,102,97,129,111,55,57,94,180,139,54,40,52,60,152,170,96,103,62,
+103,3,54,254,174,0,5,0,133,254,20,12,39,6,20,0,22,0,30,0,44,0,56,0,68,0,0,
+1,34,2,53,52,18,55,51,6,17,20,22,51,51,50,54,53,17,51,17,20,6,33,1,51,17,
+33,17,51,17,33,1,34,39,55,22,51,50,54,53,17,51,17,20,6,37,34,38,53,52,54,
+51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,2,33,190,222,44,40,170,
+70,140,127,100,178,166,174,246,254,248,3,105,182,2,20,183,252,127,4,157,96,
+113,54,76,75,91,106,172,188,252,38,53,61,60,54,55,60,60,1,44,48,67,67,48,
+52,62,61,254,20,1,24,245,126,1,3,98,177,254,206,175,190,162,164,6,26,249,
+244,248,252,8,0,250,140,3,65,252,31,254,20,58,137,35,148,125,4,28,251,238,
+207,236,82,64,59,58,65,67,56,56,67,58,65,65,58,63,60,59,64,0,255,255,255,
+236,253,192,4,0,5,154,2,38,0,55,0,0,0,39,0,61,2,123,0,0,0,7,0,110,2,111,0,
+217,255,255,0,41,1,26,2,113,3,16,0,7,0,63,1,76,252,118,0,1,255,43,5,20,0,
+217,5,182,0,3,0,0,19,7,33,55,217,82,254,164,72,5,182,162,162,0,255,255,254,
+223,3,249,1,35,5,145,0,7,2,181,0,0,254,241,255,255,254,242,4,44,1,12,5,196,
+0,7,2,182,0,0,255,38,255,255,255,141,255,175,0,115,0,165,0,7,0,61,0,0,251,
+11,0,2,254,211,4,182,1,45,6,131,0,18,0,29,0,0,19,34,38,38,53,52,54,51,50,
+22,21,20,7,22,51,50,55,23,6,37,54,53,52,38,35,34,6,21,20,22,92,102,183,108,
+97,79,82,102,65,42,60,70,76,59,95,254,210,51,45,31,32,42,45,4,182,85,142,
+72,71,91,92,78,91,83,14,51,86,68,152,66,63,42,40,40,32,35,75,0,0,3,255,2,
+4,49,1,2,6,45,0,3,0,15,0,27,0,0,1,7,5,55,55,34,38,53,52,54,51,50,22,21,20,
+6,19,34,38,53,52,54,51,50,22,21,20,6,1,2,82,254,82,72,110,29,40,40,29,28,
+42,42,138,29,40,40,29,28,42,42,5,203,162,164,162,113,35,40,39,35,35,39,40,
+35,254,153,36,40,38,36,36,38,40,36,0,4,0,133,254,102,7,37,3,225,0,16,0,28,
+0,40,0,52,0,0,33,34,38,53,52,54,55,51,6,21,20,22,51,33,17,51,17,1,34,38,53,
+52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,
+54,51,50,22,21,20,6,2,4,177,206,29,22,164,31,106,87,4,121,174,251,96,53,61,
+60,54,55,60,60,1,54,53,62,61,54,55,60,60,1,43,53,61,60,54,55,60,60,213,184,
+68,178,62,148,145,112,140,3,65,252,31,254,102,64,59,58,65,67,56,56,67,64,
+59,59,64,67,56,56,67,64,59,58,65,67,56,56,67,0,4,0,133,254,102,8,63,3,225,
+0,22,0,34,0,46,0,58,0,0,33,34,38,53,52,54,55,51,6,21,20,22,51,33,17,51,17,
+33,50,21,21,20,35,1,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,
+50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,2,4,177,206,29,22,164,31,
+106,87,4,121,174,1,16,10,10,250,80,53,61,60,54,55,60,60,1,54,53,62,61,54,
+55,60,60,1,43,53,61,60,54,55,60,60,213,184,68,178,62,148,145,112,140,3,65,
+252,191,8,142,10,254,102,64,59,58,65,67,56,56,67,64,59,59,64,67,56,56,67,
+64,59,58,65,67,56,56,67,0,0,4,255,236,254,102,4,33,3,225,0,9,0,21,0,33,0,
+45,0,0,35,34,53,53,52,51,33,17,51,17,1,34,38,53,52,54,51,50,22,21,20,6,33,
+34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,10,10,
+10,3,116,183,252,139,53,61,60,54,55,60,60,1,54,53,62,61,54,55,60,60,1,43,
+53,61,60,54,55,60,60,10,142,8,3,65,252,31,254,102,64,59,58,65,67,56,56,67,
+64,59,59,64,67,56,56,67,64,59,58,65,67,56,56,67,0,4,255,236,254,102,4,227,
+3,225,0,15,0,27,0,39,0,51,0,0,35,34,53,53,52,51,33,17,51,17,33,50,21,21,20,
+35,1,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,33,
+34,38,53,52,54,51,50,22,21,20,6,10,10,10,2,250,182,1,51,10,10,252,65,53,61,
+60,54,55,60,60,1,54,53,62,61,54,55,60,60,1,43,53,61,60,54,55,60,60,10,142,
+8,3,65,252,191,8,142,10,254,102,64,59,58,65,67,56,56,67,64,59,59,64,67,56,
+56,67,64,59,58,65,67,56,56,67,0,255,255,0,133,254,102,5,139,5,218,2,38,0,
+53,0,0,0,39,0,63,3,23,255,64,0,7,0,121,3,18,0,0,255,255,0,133,254,102,6,166,
+5,216,2,38,0,54,0,0,0,39,0,63,3,23,255,62,0,7,0,121,3,18,0,0,255,255,255,
+236,254,102,2,246,6,154,2,38,0,116,0,0,0,39,0,63,1,209,0,0,0,7,0,121,1,211,
+0,0,255,255,255,236,254,102,3,53,6,154,2,38,0,117,0,0,0,39,0,63,1,154,0,0,
+0,7,0,121,1,152,0,0,255,255,0,133,253,80,5,139,3,225,2,38,0,53,0,0,0,7,2,
+187,3,27,0,0,255,255,0,133,253,80,6,166,3,225,2,38,0,54,0,0,0,7,2,187,3,27,
+0,0,255,255,255,236,253,80,2,119,3,225,2,38,0,116,0,0,0,7,2,187,1,84,0,0,
+255,255,255,236,253,80,3,53,3,225,2,38,0,117,0,0,0,7,2,187,1,156,0,0,255,
+255,0,133,253,80,5,139,4,216,2,38,0,53,0,0,0,39,0,62,3,10,255,62,0,7,2,187,
+3,27,0,0,255,255,0,133,253,80,6,166,4,216,2,38,0,54,0,0,0,39,0,62,3,10,255,
+62,0,7,2,187,3,27,0,0,255,255,255,236,253,80,2,242,5,154,2,38,0,116,0,0,0,
+39,0,62,1,209,0,0,0,7,2,187,1,84,0,0,255,255,255,236,253,80,3,53,5,154,2,
+38,0,117,0,0,0,39,0,62,1,158,0,0,0,7,2,187,1,156,0,0,255,255,0,133,254,102,
+5,139,4,216,2,38,0,53,0,0,0,39,0,122,3,84,0,0,0,7,0,61,3,43,255,62,255,255,
+0,133,254,102,6,166,4,216,2,38,0,54,0,0,0,39,0,61,3,43,255,62,0,7,0,122,3,
+84,0,0,255,255,255,236,254,102,2,80,5,154,2,38,0,116,0,0,0,39,0,122,1,47,
+0,0,0,7,0,61,1,217,0,0,255,255,255,236,254,102,3,53,5,154,2,38,0,117,0,0,
+0,39,0,122,1,166,0,0,0,7,0,61,1,156,0,0,255,255,0,133,253,195,5,139,3,225,
+2,38,0,53,0,0,0,7,2,182,3,74,248,189,255,255,0,133,253,195,6,166,3,225,2,
+38,0,54,0,0,0,7,2,182,3,74,248,189,255,255,255,236,253,195,2,53,3,225,2,38,
+0,116,0,0,0,7,2,182,1,14,248,189,255,255,255,236,253,195,3,53,3,225,2,38,
+0,117,0,0,0,7,2,182,1,147,248,189,255,255,0,133,0,0,5,139,5,18,2,38,0,53,
+0,0,0,7,2,181,3,6,254,114,255,255,0,133,0,0,6,166,5,18,2,38,0,54,0,0,0,7,
+2,181,3,6,254,114,255,255,255,236,0,0,2,248,6,38,2,38,0,116,0,0,0,7,2,181,
+1,213,255,134,255,255,255,236,0,0,3,53,6,38,2,38,0,117,0,0,0,7,2,181,1,147,
+255,134,255,255,0,92,253,111,4,162,5,154,2,38,0,7,0,0,0,7,0,62,2,16,0,0,255,
+255,0,92,253,111,4,254,5,154,2,38,0,10,0,0,0,7,0,62,2,16,0,0,255,255,255,
+236,0,0,4,31,5,154,2,38,0,8,0,0,0,7,0,62,2,16,0,0,255,255,255,236,0,0,4,172,
+5,154,2,38,0,9,0,0,0,7,0,62,2,16,0,0,255,255,0,92,253,111,4,162,3,246,2,38,
+2,235,0,0,0,6,2,241,0,0,255,255,0,92,253,111,4,254,3,246,2,38,2,236,0,0,0,
+6,2,241,0,0,255,255,255,236,253,80,4,31,3,246,2,38,0,8,0,0,0,7,2,187,1,215,
+0,0,255,255,255,236,253,80,4,172,3,246,2,38,0,9,0,0,0,7,2,187,1,215,0,0,255,
+255,0,92,252,244,3,182,6,223,2,38,0,11,0,0,0,39,0,111,1,160,0,94,0,7,2,173,
+1,221,0,0,255,255,0,92,252,244,4,162,6,223,2,38,0,112,0,0,0,39,0,111,1,160,
+0,94,0,7,2,173,1,221,0,0,255,255,0,92,253,195,3,182,4,94,2,38,0,11,0,0,0,
+7,2,182,1,254,248,189,255,255,0,92,253,195,4,162,4,94,2,38,0,112,0,0,0,7,
+2,182,1,254,248,189,0,1,0,70,253,113,2,135,3,225,0,18,0,0,23,33,54,53,3,51,
+17,20,7,51,21,35,6,6,7,39,54,55,35,70,1,24,10,2,174,8,123,160,38,143,105,
+113,154,59,231,186,42,44,4,69,251,197,59,37,117,90,169,93,129,127,96,0,0,
+1,0,29,253,113,2,244,3,225,0,26,0,0,1,51,17,51,50,21,21,20,35,35,21,20,7,
+51,21,35,6,6,7,39,54,55,35,53,33,54,53,1,61,175,253,11,11,253,9,123,160,38,
+143,105,113,154,59,231,1,24,10,3,225,252,191,8,142,10,90,51,45,117,90,169,
+93,129,127,96,117,42,44,0,255,255,0,133,254,20,9,66,6,165,2,38,0,14,0,0,0,
+7,2,178,6,184,255,175,255,255,0,133,254,20,10,94,6,165,2,38,0,17,0,0,0,7,
+2,178,6,184,255,175,255,255,255,236,0,0,6,88,6,165,2,38,0,15,0,0,0,7,2,178,
+3,197,255,175,255,255,255,236,0,0,7,117,6,165,2,38,0,16,0,0,0,7,2,178,3,199,
+255,175,255,255,0,133,253,111,3,236,5,154,2,38,0,26,0,0,0,7,0,62,2,123,0,
+0,255,255,0,133,253,111,4,254,5,154,2,38,0,29,0,0,0,7,0,62,2,123,0,0,255,
+255,255,236,0,0,3,195,5,154,2,38,0,27,0,0,0,7,0,62,2,123,0,0,255,255,255,
+236,0,0,4,213,5,154,2,38,0,28,0,0,0,7,0,62,2,123,0,0,255,255,0,133,253,111,
+3,236,6,152,2,38,0,26,0,0,0,7,2,186,2,137,0,0,255,255,0,133,253,111,4,254,
+6,152,2,38,0,29,0,0,0,7,2,186,2,137,0,0,255,255,255,236,0,0,3,195,6,152,2,
+38,0,27,0,0,0,7,2,186,2,137,0,0,255,255,255,236,0,0,4,213,6,152,2,38,0,28,
+0,0,0,7,2,186,2,96,0,0,255,255,0,133,253,111,3,236,7,12,2,38,0,26,0,0,0,7,
+2,172,2,109,0,0,255,255,0,133,253,111,4,254,7,12,2,38,0,29,0,0,0,7,2,172,
+2,109,0,0,255,255,255,236,0,0,3,195,7,12,2,38,0,27,0,0,0,7,2,172,2,109,0,
+0,255,255,255,236,0,0,4,213,7,12,2,38,0,28,0,0,0,7,2,172,2,109,0,0,255,255,
+0,133,254,102,7,106,3,225,2,38,0,57,0,0,0,7,0,122,6,12,0,0,255,255,0,133,
+254,102,8,86,3,225,2,38,0,58,0,0,0,7,0,122,6,12,0,0,255,255,255,236,254,102,
+4,0,3,225,2,38,0,55,0,0,0,7,0,122,2,152,0,0,255,255,255,236,254,102,4,227,
+3,225,2,38,0,56,0,0,0,7,0,122,2,131,0,0,255,255,0,133,253,80,7,106,3,225,
+2,38,0,57,0,0,0,7,2,187,5,223,0,0,255,255,0,133,253,80,8,86,3,225,2,38,0,
+58,0,0,0,7,2,187,5,223,0,0,255,255,255,236,253,80,4,0,3,225,2,38,0,55,0,0,
+0,7,2,187,2,131,0,0,255,255,255,236,253,80,4,227,3,225,2,38,0,56,0,0,0,7,
+2,187,2,131,0,0,255,255,0,133,0,0,5,221,6,144,2,38,0,83,0,0,0,7,0,61,2,197,
+0,246,255,255,0,133,0,0,6,242,6,144,2,38,0,84,0,0,0,7,0,61,2,197,0,246,255,
+255,255,236,0,0,4,2,6,144,2,38,0,30,0,0,0,7,0,61,0,219,0,246,255,255,255,
+236,0,0,5,23,6,144,2,38,0,31,0,0,0,7,0,61,0,219,0,246,255,255,0,133,0,0,5,
+221,7,78,2,38,0,83,0,0,0,7,2,238,1,233,0,0,255,255,0,133,0,0,6,242,7,78,2,
+38,0,84,0,0,0,7,2,238,1,233,0,0,255,255,255,236,0,0,4,2,7,78,2,38,0,30,0,
+0,0,6,2,238,0,0,255,255,255,236,0,0,5,23,7,78,2,38,0,31,0,0,0,6,2,238,0,0,
+255,255,0,133,253,80,5,221,6,131,2,38,0,83,0,0,0,7,2,187,3,72,0,0,255,255,
+0,133,253,80,6,242,6,131,2,38,0,84,0,0,0,7,2,187,3,72,0,0,255,255,255,236,
+253,80,4,2,6,131,2,38,0,30,0,0,0,7,2,187,1,227,0,0,255,255,255,236,253,80,
+5,23,6,131,2,38,0,31,0,0,0,7,2,187,1,227,0,0,255,255,0,133,253,113,4,172,
+5,154,2,38,0,38,0,0,0,7,0,61,2,197,0,0,255,255,0,133,253,113,5,135,5,154,
+2,38,0,41,0,0,0,7,0,61,2,197,0,0,255,255,255,236,0,0,4,18,5,154,2,38,0,39,
+0,0,0,7,0,61,2,10,0,0,255,255,255,236,0,0,4,238,5,154,2,38,0,40,0,0,0,7,0,
+61,2,10,0,0,255,255,0,133,253,113,4,172,3,205,2,38,0,38,0,0,0,7,0,121,2,213,
+0,0,255,255,0,133,253,113,5,135,3,205,2,38,0,41,0,0,0,7,0,121,2,213,0,0,255,
+255,255,236,254,102,4,18,3,205,2,38,0,39,0,0,0,7,0,121,2,14,0,0,255,255,255,
+236,254,102,4,238,3,205,2,38,0,40,0,0,0,7,0,121,2,14,0,0,255,255,0,133,252,
+201,4,178,4,216,2,38,0,89,0,0,0,39,0,61,2,160,255,62,0,7,2,171,2,199,254,
+62,255,255,0,133,252,201,5,158,4,216,2,38,0,90,0,0,0,39,0,61,2,160,255,62,
+0,7,2,171,2,199,254,62,255,255,255,236,254,102,2,80,5,154,2,38,0,116,0,0,
+0,39,0,61,1,215,0,0,0,7,0,122,1,47,0,0,255,255,255,236,254,102,3,53,5,154,
+2,38,0,117,0,0,0,39,0,122,1,166,0,0,0,7,0,61,1,156,0,0,255,255,0,133,254,
+20,4,178,7,76,2,38,0,89,0,0,0,39,0,61,2,160,255,62,0,7,0,111,2,190,0,203,
+255,255,0,133,254,20,5,158,7,76,2,38,0,90,0,0,0,39,0,61,2,160,255,62,0,7,
+0,111,2,190,0,203,255,255,255,236,0,0,2,32,7,225,2,38,0,114,0,0,0,39,0,61,
+1,88,0,0,0,7,0,111,1,102,1,96,255,255,255,236,0,0,2,207,7,225,2,38,0,115,
+0,0,0,39,0,61,1,88,0,0,0,7,0,111,1,102,1,96,255,255,0,133,254,20,4,178,6,
+238,2,38,0,89,0,0,0,39,0,61,2,160,255,62,0,7,2,181,2,152,0,78,255,255,0,133,
+254,20,5,158,6,238,2,38,0,90,0,0,0,39,0,61,2,160,255,62,0,7,2,181,2,152,0,
+78,255,255,255,236,0,0,2,113,7,172,2,38,0,114,0,0,0,39,0,61,1,88,0,0,0,7,
+2,181,1,78,1,12,255,255,255,236,0,0,2,207,7,172,2,38,0,115,0,0,0,39,0,61,
+1,88,0,0,0,7,2,181,1,78,1,12,0,1,0,133,254,20,5,63,6,20,0,30,0,0,1,33,17,
+51,17,51,21,35,17,20,6,33,35,34,2,53,52,18,55,51,6,17,20,22,51,51,50,54,53,
+17,33,2,254,1,6,174,141,141,246,254,248,147,190,222,44,40,170,70,140,127,
+100,178,166,254,250,4,86,1,190,254,66,117,252,39,248,252,1,24,245,126,1,3,
+98,177,254,206,175,190,162,164,3,231,0,1,0,133,254,20,5,158,6,20,0,37,0,0,
+1,33,17,51,17,51,21,35,17,51,50,21,21,20,35,35,6,6,33,35,34,2,53,52,18,55,
+51,6,17,20,22,51,51,50,54,53,17,33,2,254,1,6,174,141,141,225,11,11,225,3,
+246,254,251,147,190,222,44,40,170,70,140,127,100,178,166,254,250,4,86,1,190,
+254,66,117,252,191,8,142,10,243,249,1,24,245,126,1,3,98,177,254,206,175,190,
+162,164,3,231,0,0,1,255,236,0,0,2,63,6,20,0,17,0,0,3,33,17,51,17,51,21,35,
+17,33,34,53,53,52,51,33,17,33,2,1,6,182,133,133,254,60,10,10,1,14,254,250,
+4,86,1,190,254,66,117,252,31,10,142,8,3,65,0,1,255,236,0,0,2,207,6,20,0,23,
+0,0,3,33,17,51,17,51,21,35,17,33,50,21,21,20,35,33,34,53,53,52,51,33,17,33,
+2,1,6,182,133,133,1,11,10,10,253,49,10,10,1,14,254,250,4,86,1,190,254,66,
+117,252,191,8,142,10,10,142,8,3,65,0,255,255,255,174,254,20,2,4,7,12,2,38,
+0,12,0,0,0,7,2,172,1,145,0,0,255,255,255,174,254,20,2,244,7,12,2,38,0,13,
+0,0,0,7,2,172,1,145,0,0,255,255,255,174,254,20,2,64,6,22,2,38,0,12,0,0,0,
+7,0,107,1,127,254,114,255,255,255,174,254,20,2,244,6,22,2,38,0,13,0,0,0,7,
+0,107,1,168,254,114,255,255,0,133,254,20,9,66,6,144,2,38,0,14,0,0,0,7,2,172,
+6,188,255,132,255,255,0,133,254,20,10,94,6,144,2,38,0,17,0,0,0,7,2,172,6,
+188,255,132,255,255,255,236,0,0,6,88,6,144,2,38,0,15,0,0,0,7,2,172,3,199,
+255,132,255,255,255,236,0,0,7,117,6,144,2,38,0,16,0,0,0,7,2,172,3,199,255,
+132,0,2,255,49,4,201,0,201,5,117,0,11,0,23,0,0,3,34,38,53,52,54,51,50,22,
+21,20,6,51,34,38,53,52,54,51,50,22,21,20,6,127,34,46,46,34,32,48,48,216,34,
+46,46,34,32,48,48,4,201,41,45,45,41,41,45,45,41,41,45,45,41,41,45,45,41,0,
+2,255,49,254,139,0,201,255,55,0,11,0,23,0,0,3,34,38,53,52,54,51,50,22,21,
+20,6,51,34,38,53,52,54,51,50,22,21,20,6,127,34,46,46,34,32,48,48,216,34,46,
+46,34,32,48,48,254,139,41,45,45,41,41,45,45,41,41,45,45,41,41,45,45,41,0,
+2,255,141,4,164,0,115,7,12,0,11,0,23,0,0,17,34,38,53,52,54,51,50,22,21,20,
+6,3,34,38,53,52,54,51,50,22,21,20,6,53,62,61,54,55,60,60,55,53,62,61,54,55,
+60,60,4,164,64,59,59,64,67,56,56,67,1,115,64,58,59,64,67,56,55,67,0,0,2,255,
+141,252,244,0,115,255,92,0,11,0,23,0,0,17,34,38,53,52,54,51,50,22,21,20,6,
+3,34,38,53,52,54,51,50,22,21,20,6,53,62,62,53,54,61,60,55,53,62,61,54,55,
+60,60,252,244,64,59,58,64,66,56,56,67,1,114,64,59,59,64,67,56,56,67,0,0,2,
+255,176,5,0,0,80,6,176,0,11,0,23,0,0,17,34,38,53,52,54,51,50,22,21,20,6,3,
+34,38,53,52,54,51,50,22,21,20,6,34,46,46,34,32,48,48,32,34,46,46,34,32,48,
+48,5,0,41,45,46,40,40,46,45,41,1,4,40,46,45,41,41,45,46,40,0,0,2,255,176,
+253,80,0,80,255,0,0,11,0,23,0,0,17,34,38,53,52,54,51,50,22,21,20,6,3,34,38,
+53,52,54,51,50,22,21,20,6,34,46,46,34,32,48,48,32,34,46,46,34,32,48,48,253,
+80,41,45,46,40,40,46,45,41,1,4,40,46,45,41,41,45,46,40,0,0,3,255,53,4,240,
+0,205,6,78,0,10,0,21,0,32,0,0,17,34,53,52,54,51,50,22,21,20,6,7,34,53,52,
+54,51,50,22,21,20,6,51,34,53,52,54,51,50,22,21,20,6,74,42,32,31,45,45,154,
+80,46,34,32,48,48,216,80,46,34,32,48,48,5,176,80,40,38,38,40,43,37,192,86,
+45,41,41,45,47,39,86,45,41,41,45,47,39,0,0,3,255,53,253,154,0,205,254,246,
+0,10,0,21,0,32,0,0,17,34,53,52,54,51,50,22,21,20,6,39,34,53,52,54,51,50,22,
+21,20,6,51,34,53,52,54,51,50,22,21,20,6,74,42,32,31,45,45,154,80,46,34,32,
+48,48,216,80,46,34,32,48,48,253,154,79,41,37,37,41,43,36,176,86,45,41,41,
+45,47,39,86,45,41,41,45,47,39,0,0,4,254,246,4,195,1,4,6,246,0,11,0,23,0,35,
+0,47,0,0,3,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,
+20,6,1,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,
+162,49,55,61,43,42,61,55,1,14,44,59,59,44,47,57,56,254,146,49,55,61,43,42,
+61,55,1,14,44,59,59,44,47,57,56,4,195,56,54,58,53,52,59,53,57,51,59,59,52,
+59,52,52,58,1,86,56,54,58,53,52,59,53,57,51,59,59,52,59,52,52,58,0,0,4,254,
+246,253,6,1,4,255,57,0,11,0,23,0,35,0,47,0,0,3,34,38,53,52,54,51,50,22,21,
+20,6,33,34,38,53,52,54,51,50,22,21,20,6,1,34,38,53,52,54,51,50,22,21,20,6,
+33,34,38,53,52,54,51,50,22,21,20,6,162,47,57,61,43,42,61,61,1,20,44,59,59,
+44,49,55,57,254,147,47,57,61,43,42,61,61,1,20,44,59,59,44,49,55,57,253,6,
+57,54,58,52,52,58,59,52,52,59,59,51,59,51,52,59,1,86,57,54,58,52,52,58,59,
+52,52,59,59,51,59,51,52,59,0,0,3,254,33,254,102,1,213,255,92,0,11,0,23,0,
+35,0,0,1,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,
+6,33,34,38,53,52,54,51,50,22,21,20,6,254,147,53,61,60,54,55,60,60,1,54,53,
+62,61,54,55,60,60,1,43,53,61,60,54,55,60,60,254,102,64,59,58,65,67,56,56,
+67,64,59,59,64,67,56,56,67,64,59,58,65,67,56,56,67,0,0,1,254,223,5,8,1,35,
+6,160,0,6,0,0,1,3,35,3,51,19,19,1,35,225,127,228,160,129,133,6,160,254,104,
+1,152,254,248,1,8,0,0,1,254,242,5,6,1,12,6,158,0,6,0,0,1,19,51,19,35,3,3,
+254,242,225,86,227,139,129,133,5,6,1,152,254,104,1,8,254,248,0,0,1,255,53,
+3,68,0,193,4,233,0,24,0,0,3,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,
+54,54,51,21,34,6,7,7,203,97,72,111,98,78,57,31,39,63,45,62,62,13,164,28,16,
+113,152,115,3,162,14,47,82,86,98,30,92,24,50,54,66,31,5,22,100,11,20,18,0,
+0,1,254,137,6,2,0,193,7,164,0,37,0,0,3,34,46,2,35,34,7,39,54,54,51,50,23,
+22,51,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,54,55,21,6,6,82,27,
+41,35,30,16,45,52,47,44,60,27,20,39,39,40,72,115,94,80,55,31,41,61,45,62,
+36,26,22,149,34,31,212,6,16,10,11,10,45,43,55,37,15,16,47,83,88,96,31,92,
+25,51,54,35,49,12,2,23,8,101,7,30,0,0,1,254,137,253,231,0,193,255,137,0,36,
+0,0,3,34,39,38,35,34,7,39,54,54,51,50,23,22,51,38,38,53,52,54,51,50,23,7,
+38,35,34,6,21,20,23,54,54,55,21,6,6,82,42,43,44,20,45,52,47,45,59,27,20,39,
+39,40,29,43,111,98,80,55,31,41,61,45,62,62,22,149,34,54,201,253,246,15,15,
+45,43,57,36,15,16,18,66,45,86,98,31,92,25,51,54,65,31,2,23,8,100,12,25,0,
+0,3,254,219,4,162,1,35,6,152,0,11,0,23,0,35,0,0,17,50,22,21,20,6,35,34,38,
+53,52,54,19,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,
+52,54,46,60,60,46,43,63,63,219,48,67,67,48,55,60,60,254,213,53,62,61,54,53,
+62,61,5,131,53,60,58,54,54,58,60,53,1,21,58,65,65,58,67,56,56,67,64,59,59,
+64,64,59,59,64,0,3,254,219,253,80,1,35,255,63,0,11,0,23,0,35,0,0,21,50,22,
+21,20,6,35,34,38,53,52,54,23,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,
+20,6,35,34,38,53,52,54,46,60,60,46,50,56,57,225,48,67,67,48,55,60,60,254,
+213,53,62,61,54,53,62,61,193,52,60,59,54,61,52,53,59,249,58,65,65,58,67,56,
+56,67,64,59,59,64,64,59,59,64,255,255,0,133,0,0,7,106,6,154,2,38,0,57,0,0,
+0,7,0,63,5,244,0,0,0,2,0,145,253,113,4,145,3,225,0,39,0,48,0,0,1,54,55,39,
+38,38,35,34,7,39,54,54,51,50,23,22,23,54,53,53,35,34,38,53,52,0,33,33,17,
+51,50,21,21,20,35,35,21,20,2,7,19,17,35,34,6,21,20,22,51,2,18,149,60,58,60,
+65,36,41,71,52,54,71,41,50,77,99,40,15,201,218,239,1,50,1,0,1,12,184,10,10,
+184,157,175,158,88,182,203,139,141,253,242,123,94,21,24,16,31,76,42,32,28,
+37,9,54,49,100,240,227,241,1,29,252,191,8,142,10,90,146,254,244,151,3,47,
+2,162,192,173,160,149,0,255,255,0,133,254,20,3,207,6,160,2,38,0,46,0,0,0,
+7,2,181,2,104,0,0,255,255,0,133,254,20,4,129,6,160,2,38,0,47,0,0,0,7,2,181,
+2,104,0,0,255,255,0,133,254,20,3,207,6,93,2,38,0,46,0,0,0,7,0,101,1,231,254,
+83,255,255,0,133,254,20,4,129,6,93,2,38,0,47,0,0,0,7,0,101,1,231,254,83,255,
+255,0,133,254,20,3,207,6,64,2,38,0,46,0,0,0,7,0,109,2,119,254,54,255,255,
+0,133,254,20,4,129,6,64,2,38,0,47,0,0,0,7,0,109,2,119,254,54,255,255,0,133,
+254,20,3,207,6,158,2,38,0,46,0,0,0,7,2,182,2,117,0,0,255,255,0,133,254,20,
+4,129,6,158,2,38,0,47,0,0,0,7,2,182,2,117,0,0,255,255,0,133,254,20,3,207,
+5,154,2,38,0,46,0,0,0,7,0,62,2,170,0,0,255,255,0,133,254,20,4,129,5,154,2,
+38,0,47,0,0,0,7,0,62,2,170,0,0,255,255,0,133,254,20,3,207,6,154,2,38,0,46,
+0,0,0,7,0,63,2,117,0,0,255,255,0,133,254,20,4,129,6,154,2,38,0,47,0,0,0,7,
+0,63,2,117,0,0,255,255,0,133,254,20,3,207,5,154,2,38,0,46,0,0,0,7,0,61,2,
+109,0,0,255,255,0,133,254,20,4,129,5,154,2,38,0,47,0,0,0,7,0,61,2,109,0,0,
+255,255,255,236,254,102,2,244,6,160,2,38,0,116,0,0,0,39,0,122,1,47,0,0,0,
+7,2,181,1,209,0,0,255,255,255,236,254,102,3,53,6,160,2,38,0,117,0,0,0,39,
+0,122,1,166,0,0,0,7,2,181,1,154,0,0,255,255,0,133,254,20,6,111,4,5,2,38,0,
+48,0,0,0,7,2,181,2,43,253,101,255,255,0,133,254,20,7,203,4,5,2,38,0,49,0,
+0,0,7,2,181,2,102,253,101,255,255,0,133,251,157,6,111,3,225,2,38,0,48,0,0,
+0,7,2,175,3,66,254,77,255,255,0,133,251,157,7,203,2,215,2,38,0,49,0,0,0,7,
+2,175,3,66,254,77,255,255,255,236,252,244,2,68,3,225,2,38,0,116,0,0,0,7,2,
+173,1,209,0,0,255,255,255,236,252,244,3,53,3,225,2,38,0,117,0,0,0,7,2,173,
+1,127,0,0,255,255,0,133,252,22,6,111,3,225,2,38,0,48,0,0,0,7,2,177,3,59,254,
+124,255,255,0,133,252,22,7,203,2,215,2,38,0,49,0,0,0,7,2,177,3,59,254,124,
+0,1,255,236,0,0,1,115,0,160,0,11,0,0,37,50,21,21,20,35,33,34,53,53,52,51,
+1,104,11,11,254,142,10,10,160,8,142,10,10,142,8,0,255,255,0,133,254,20,9,
+66,6,154,2,38,0,14,0,0,0,39,0,63,6,190,0,0,0,7,0,121,6,193,0,0,255,255,0,
+133,254,20,10,94,6,154,2,38,0,17,0,0,0,39,0,63,6,190,0,0,0,7,0,121,6,193,
+0,0,255,255,255,236,254,102,6,88,6,154,2,38,0,15,0,0,0,39,0,63,3,190,0,0,
+0,7,0,121,3,207,0,0,255,255,255,236,254,102,7,117,6,154,2,38,0,16,0,0,0,39,
+0,63,3,190,0,0,0,7,0,121,3,190,0,0,0,1,0,92,0,0,5,57,6,20,0,22,0,0,1,51,17,
+51,17,51,21,35,17,20,6,35,33,53,33,1,51,1,51,50,53,17,35,2,248,254,182,141,
+141,206,173,253,43,1,203,254,248,190,1,8,56,217,254,4,86,1,190,254,66,117,
+253,148,170,203,160,4,96,251,160,237,2,84,0,1,0,92,0,0,5,193,6,20,0,23,0,
+0,1,51,17,51,17,51,21,35,17,33,50,21,21,20,35,33,53,33,1,51,1,33,17,35,2,
+248,254,182,141,141,1,10,11,11,250,166,1,203,254,248,190,1,8,1,17,254,4,86,
+1,190,254,66,117,252,191,8,142,10,160,4,96,251,160,3,65,0,0,8,0,49,254,127,
+8,203,7,23,0,44,0,56,0,61,0,73,0,101,0,113,0,118,0,130,0,0,1,20,2,7,23,20,
+6,35,34,39,6,33,32,39,6,35,34,38,53,55,38,39,38,53,52,18,55,39,52,54,51,50,
+23,54,33,32,23,54,51,50,22,21,7,22,18,1,52,38,35,34,6,21,20,22,51,50,54,39,
+38,35,34,7,7,52,38,35,34,6,21,20,22,51,50,54,1,52,2,39,6,35,34,39,33,6,35,
+34,39,6,2,23,16,1,54,51,50,23,33,54,51,50,23,0,1,52,38,35,34,6,21,20,22,51,
+50,54,39,33,22,51,50,37,52,38,35,34,6,21,20,22,51,50,54,8,203,210,173,2,78,
+55,39,35,240,254,238,254,240,240,35,39,55,78,2,178,100,105,205,178,2,78,55,
+39,35,240,1,18,1,16,240,35,39,55,78,2,179,204,254,78,48,30,33,47,47,33,30,
+48,215,211,240,242,211,57,47,33,31,47,47,31,35,45,5,219,182,158,28,35,56,
+39,252,39,39,55,35,28,160,182,2,1,84,28,35,55,39,3,217,39,56,35,28,1,84,254,
+189,48,30,33,47,47,33,30,48,215,252,120,211,242,240,253,18,45,35,31,47,47,
+31,33,47,2,203,246,254,74,150,28,56,78,23,127,127,23,78,56,28,154,215,219,
+246,243,1,181,153,29,55,76,20,127,127,20,76,55,29,154,254,75,2,108,33,45,
+47,31,33,47,47,51,109,109,18,31,47,45,33,33,47,47,252,195,218,1,134,137,16,
+41,41,16,139,254,117,211,254,61,254,217,17,41,41,17,1,39,254,101,32,45,45,
+32,31,47,45,14,108,127,32,45,45,32,33,45,47,0,0,12,0,49,254,201,8,123,7,18,
+0,15,0,18,0,21,0,24,0,27,0,30,0,33,0,36,0,44,0,47,0,59,0,71,0,0,1,1,17,33,
+1,1,33,17,1,1,17,33,1,1,33,17,1,17,33,17,33,17,33,17,33,1,17,1,5,23,55,1,
+7,23,1,39,7,1,1,33,1,17,1,33,1,1,39,17,37,20,6,35,34,38,53,52,54,51,50,22,
+7,52,38,35,34,6,21,20,22,51,50,54,8,123,254,203,254,71,254,201,254,203,254,
+71,254,201,1,55,1,185,1,53,1,55,1,185,250,110,1,33,254,223,5,70,254,221,1,
+35,254,221,253,178,205,205,252,69,204,204,3,187,205,205,3,113,254,117,253,
+208,254,117,1,139,2,48,1,139,1,22,202,253,233,127,90,88,129,129,88,90,127,
+74,84,59,59,82,82,59,59,84,2,238,254,200,254,74,254,201,1,55,1,182,1,56,1,
+55,1,182,1,55,254,201,254,74,253,72,254,223,5,69,254,224,1,32,250,187,1,33,
+254,223,76,205,205,3,186,204,205,3,186,207,207,254,43,1,139,254,117,253,207,
+254,119,1,137,1,25,204,254,103,205,91,127,127,91,90,127,127,90,59,84,84,59,
+60,84,84,0,1,255,158,4,96,0,98,5,37,0,3,0,0,19,35,53,51,98,196,196,4,96,197,
+0,6,0,49,0,0,4,156,6,139,0,8,0,17,0,24,0,31,0,38,0,45,0,0,33,33,19,17,3,1,
+1,3,17,19,1,1,23,17,7,33,39,17,55,7,17,33,17,39,9,3,23,17,33,17,55,7,17,33,
+17,39,55,23,39,7,23,17,51,17,4,156,251,149,230,230,2,53,2,54,230,152,254,
+24,254,25,211,160,3,105,160,104,149,254,49,150,1,125,1,52,254,204,254,205,
+125,1,109,37,89,254,250,88,219,166,166,165,73,183,1,4,2,78,1,2,2,55,253,201,
+254,254,253,178,3,80,1,233,254,23,238,253,138,185,185,2,118,238,170,252,217,
+3,39,170,1,125,254,131,1,51,254,205,139,252,241,3,15,139,96,253,22,2,234,
+96,223,223,170,170,82,253,51,2,205,0,0,1,0,84,254,88,2,150,0,160,0,9,0,0,
+33,35,34,6,7,39,18,18,51,51,2,150,111,103,155,57,152,74,231,160,113,200,224,
+37,1,27,1,8,0,1,0,0,1,31,2,188,1,193,0,3,0,0,17,53,33,21,2,188,1,31,162,162,
+255,255,0,41,254,102,2,113,255,92,0,7,0,122,1,80,0,0,255,255,0,41,253,80,
+2,113,255,63,0,7,2,187,1,78,0,0,255,255,0,41,253,80,2,113,255,63,0,7,0,64,
+1,76,0,0,255,255,0,41,252,244,1,15,255,92,0,7,2,173,0,156,0,0,255,255,0,41,
+253,154,1,193,254,246,0,7,2,177,0,244,0,0,255,255,0,41,254,102,3,221,255,
+92,0,7,2,180,2,8,0,0,0,1,0,82,254,188,2,43,5,182,0,13,0,0,19,16,18,55,51,
+6,2,21,20,18,23,35,38,2,82,155,146,172,140,145,145,138,170,147,154,2,49,1,
+9,1,206,174,193,254,50,244,237,254,51,189,170,1,198,0,0,1,0,61,254,188,2,
+23,5,182,0,13,0,0,1,16,2,7,35,54,18,53,52,2,39,51,22,18,2,23,156,146,170,
+135,148,144,141,172,145,157,2,49,254,248,254,59,168,184,1,201,246,244,1,206,
+193,173,254,51,0,1,0,92,253,111,4,162,3,246,0,33,0,0,37,38,38,39,4,4,21,20,
+33,7,34,38,53,52,54,36,37,38,39,38,38,35,34,6,7,39,54,54,51,32,19,22,22,23,
+4,53,55,78,29,254,169,254,219,1,22,39,198,228,150,1,66,1,40,16,23,27,147,
+125,73,206,79,72,79,238,115,1,136,67,25,96,82,25,44,82,54,93,216,142,254,
+157,207,188,129,216,179,88,54,131,162,157,59,43,141,51,70,254,80,160,201,
+55,0,1,0,92,253,111,4,254,3,246,0,41,0,0,1,34,38,53,52,54,36,37,38,39,38,
+38,35,34,6,7,39,54,54,51,32,19,30,2,51,51,50,21,21,20,35,35,34,38,39,6,4,
+6,21,20,33,2,6,198,228,154,1,72,1,32,22,19,27,147,125,73,206,79,72,79,238,
+115,1,136,67,32,62,100,80,11,10,10,11,112,167,58,245,254,242,126,1,22,253,
+111,207,188,130,218,180,84,70,115,162,157,59,43,141,51,70,254,80,196,150,
+76,8,142,10,97,108,67,133,158,93,254,0,1,0,0,4,139,2,209,7,88,0,8,0,0,17,
+54,0,55,23,6,4,6,7,67,1,140,199,59,126,254,232,213,47,5,4,150,1,107,83,137,
+48,200,230,102,0,3,0,90,5,154,1,236,7,78,0,11,0,23,0,35,0,0,19,34,38,53,52,
+54,51,50,22,21,20,6,55,34,38,53,52,54,51,50,22,21,20,6,37,34,38,53,52,54,
+51,50,22,21,20,6,205,34,46,46,34,32,48,48,175,34,46,46,34,32,48,48,254,238,
+34,46,46,34,32,48,48,5,154,41,45,45,41,41,45,45,41,170,41,45,45,41,41,45,
+45,41,94,41,45,45,41,41,45,45,41,0,0,3,0,141,5,154,2,10,7,31,0,11,0,23,0,
+35,0,0,19,34,38,53,52,54,51,50,22,21,20,6,23,34,38,53,52,54,51,50,22,21,20,
+6,55,34,38,53,52,54,51,50,22,21,20,6,223,28,54,48,30,30,52,50,1,32,58,49,
+33,33,57,54,160,32,58,49,33,33,57,53,6,125,58,28,28,48,53,33,28,48,227,61,
+35,29,49,60,35,29,50,159,61,36,28,49,60,34,28,52,0,2,0,102,6,117,1,213,7,
+203,0,11,0,23,0,0,19,34,38,53,52,54,51,50,22,21,20,6,55,34,38,53,52,54,51,
+50,22,21,20,6,182,34,46,46,34,32,48,48,175,34,46,46,34,32,48,48,6,117,41,
+45,45,41,41,45,45,41,170,41,45,45,41,41,45,45,41,0,0,3,2,119,253,147,4,154,
+255,182,0,11,0,23,0,35,0,0,1,34,38,53,52,54,51,50,22,21,20,6,3,52,54,51,50,
+22,21,20,6,35,34,38,5,34,38,53,52,54,51,50,22,21,20,6,3,43,49,82,75,44,44,
+85,72,225,68,40,41,80,66,42,44,77,1,174,49,82,76,43,44,85,72,253,147,82,50,
+44,70,82,45,45,74,1,183,39,69,76,40,42,69,76,144,82,49,45,70,82,45,45,74,
+0,0,16,0,102,0,90,4,91,4,78,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,
+79,0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,
+34,53,52,51,50,19,20,35,34,53,52,51,50,23,20,35,34,53,52,51,50,1,20,35,34,
+53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,
+51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,
+7,22,35,34,53,52,51,50,1,20,35,34,53,52,51,50,37,20,35,34,53,52,51,50,19,
+20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,3,212,48,52,52,48,148,48,52,
+52,48,247,51,49,51,49,36,48,52,52,48,254,55,50,50,50,50,173,51,49,49,51,2,
+82,51,49,49,51,253,26,50,50,50,50,2,131,48,52,52,48,148,48,52,52,48,253,174,
+48,52,50,50,36,1,49,52,52,49,1,199,50,50,50,50,254,92,50,50,50,50,247,51,
+49,49,51,148,50,50,50,50,3,150,50,50,50,48,49,49,51,254,215,51,51,49,223,
+50,50,50,1,151,51,51,49,86,49,49,51,253,123,49,49,51,1,189,50,47,53,253,72,
+49,49,51,149,48,48,52,2,32,51,51,49,223,50,50,50,254,7,51,51,49,232,49,49,
+51,254,217,52,48,52,46,49,49,51,255,255,255,236,0,0,5,170,6,154,2,38,0,23,
+0,0,0,7,0,63,3,202,0,0,255,255,255,236,0,0,6,195,6,154,2,38,0,24,0,0,0,7,
+0,63,3,202,0,0,0,1,255,220,0,183,0,36,6,131,0,3,0,0,19,17,35,17,36,72,6,131,
+250,52,5,204,0,1,255,37,0,183,0,219,6,131,0,14,0,0,55,35,17,7,39,55,39,55,
+23,55,23,7,23,7,39,36,72,134,49,171,171,49,170,170,49,171,171,49,134,183,
+4,161,136,49,169,168,49,171,171,49,168,169,49,136,0,1,255,220,0,183,1,174,
+6,131,0,10,0,0,1,7,39,55,33,17,35,17,33,39,55,1,174,217,49,137,254,246,71,
+1,81,137,49,5,172,214,49,130,251,46,5,25,130,49,0,1,254,81,0,183,0,35,6,131,
+0,10,0,0,55,35,17,33,23,7,39,55,23,7,33,35,71,254,246,137,49,217,217,49,137,
+1,81,183,4,210,130,49,214,215,49,130,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,
+0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,1,4,9,0,2,0,14,0,126,0,3,0,1,4,9,0,3,
+0,70,0,140,0,3,0,1,4,9,0,4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,0,210,0,3,0,1,4,
+9,0,6,0,28,0,240,0,3,0,1,4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,8,0,42,1,80,0,3,
+0,1,4,9,0,9,0,40,1,122,0,3,0,1,4,9,0,10,0,96,1,162,0,3,0,1,4,9,0,11,0,62,
+2,2,0,3,0,1,4,9,0,12,0,60,2,64,0,3,0,1,4,9,0,13,2,150,2,124,0,3,0,1,4,9,0,
+14,0,52,5,18,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,
+50,0,48,0,49,0,48,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,75,0,117,0,102,0,105,0,32,0,65,0,114,0,97,0,98,0,105,0,99,0,82,
+0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,
+111,0,116,0,111,0,32,0,75,0,117,0,102,0,105,0,32,0,65,0,114,0,97,0,98,0,105,
+0,99,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,
+32,0,117,0,104,0,78,0,111,0,116,0,111,0,75,0,117,0,102,0,105,0,65,0,114,0,
+97,0,98,0,105,0,99,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,
+0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,
+0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,
+0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,
+0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,
+0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,
+0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,
+0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,
+0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,
+0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,
+0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,
+0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,
+101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,
+115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,
+46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,
+0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,
+0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,
+83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,
+0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,
+0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,
+0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,
+101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,
+0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,
+0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,
+0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,
+0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,
+0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,
+0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,
+117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,250,0,0,0,1,0,2,0,3,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,
+11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,
+1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,
+1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,
+1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,
+1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,
+1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,
+1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,
+113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,
+1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,
+138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,
+1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,
+163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,
+1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,
+188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,
+1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,
+213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,
+1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,
+238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,
+1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,
+2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,
+2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,
+2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,
+2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,
+2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,
+2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,
+2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,
+113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,
+2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,
+138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,
+2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,
+163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,
+2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,
+188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,
+2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,
+213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,
+2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,
+238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,
+2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,
+3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,
+3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,
+3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,
+3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,
+3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,
+3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,
+3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,3,111,3,112,3,
+113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,
+3,126,3,127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,
+138,3,139,3,140,3,141,3,142,3,143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,
+3,151,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,3,162,3,
+163,3,164,3,165,3,166,3,167,3,168,3,169,3,170,3,171,3,172,3,173,3,174,3,175,
+3,176,3,177,3,178,3,179,3,180,3,181,3,182,3,183,3,184,3,185,3,186,3,187,3,
+188,3,189,3,190,3,191,3,192,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,200,
+3,201,3,202,3,203,3,204,3,205,3,206,3,207,3,208,3,209,3,210,3,211,3,212,3,
+213,3,214,3,215,3,216,3,217,3,218,3,219,3,220,3,221,3,222,3,223,3,224,3,225,
+3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,
+238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,7,117,110,105,48,
+54,50,49,7,117,110,105,48,54,50,55,12,117,110,105,48,54,50,55,46,102,105,
+110,97,7,117,110,105,48,54,50,68,12,117,110,105,48,54,50,68,46,105,110,105,
+116,12,117,110,105,48,54,50,68,46,109,101,100,105,12,117,110,105,48,54,50,
+68,46,102,105,110,97,7,117,110,105,48,54,50,70,7,117,110,105,48,54,51,49,
+12,117,110,105,48,54,51,49,46,102,105,110,97,7,117,110,105,48,54,51,51,12,
+117,110,105,48,54,51,51,46,105,110,105,116,12,117,110,105,48,54,51,51,46,
+109,101,100,105,12,117,110,105,48,54,51,51,46,102,105,110,97,7,117,110,105,
+48,54,51,53,12,117,110,105,48,54,51,53,46,105,110,105,116,12,117,110,105,
+48,54,51,53,46,109,101,100,105,12,117,110,105,48,54,51,53,46,102,105,110,
+97,7,117,110,105,48,54,51,55,12,117,110,105,48,54,51,55,46,105,110,105,116,
+12,117,110,105,48,54,51,55,46,109,101,100,105,12,117,110,105,48,54,51,55,
+46,102,105,110,97,7,117,110,105,48,54,51,57,12,117,110,105,48,54,51,57,46,
+105,110,105,116,12,117,110,105,48,54,51,57,46,109,101,100,105,12,117,110,
+105,48,54,51,57,46,102,105,110,97,12,117,110,105,48,54,52,51,46,105,110,105,
+116,12,117,110,105,48,54,52,51,46,109,101,100,105,7,117,110,105,48,54,52,
+51,12,117,110,105,48,54,52,51,46,102,105,110,97,7,117,110,105,48,54,52,52,
+12,117,110,105,48,54,52,52,46,105,110,105,116,12,117,110,105,48,54,52,52,
+46,109,101,100,105,12,117,110,105,48,54,52,52,46,102,105,110,97,7,117,110,
+105,48,54,52,53,12,117,110,105,48,54,52,53,46,105,110,105,116,12,117,110,
+105,48,54,52,53,46,109,101,100,105,12,117,110,105,48,54,52,53,46,102,105,
+110,97,7,117,110,105,48,54,52,55,12,117,110,105,48,54,52,55,46,105,110,105,
+116,12,117,110,105,48,54,52,55,46,109,101,100,105,12,117,110,105,48,54,52,
+55,46,102,105,110,97,7,117,110,105,48,54,52,56,12,117,110,105,48,54,52,56,
+46,102,105,110,97,7,117,110,105,48,54,52,57,12,117,110,105,48,54,52,57,46,
+102,105,110,97,16,117,110,105,48,54,52,52,48,54,50,55,46,105,115,111,108,
+16,117,110,105,48,54,52,52,48,54,50,55,46,102,105,110,97,7,117,110,105,48,
+54,52,48,7,117,110,105,48,54,54,69,12,117,110,105,48,54,54,69,46,102,105,
+110,97,12,117,110,105,48,54,54,70,46,105,110,105,116,12,117,110,105,48,54,
+54,70,46,109,101,100,105,16,102,101,104,95,100,111,116,108,101,115,115,46,
+105,115,111,108,12,117,110,105,48,54,65,49,46,102,105,110,97,7,117,110,105,
+48,54,54,70,12,117,110,105,48,54,54,70,46,102,105,110,97,12,111,110,101,100,
+111,116,46,97,98,111,118,101,13,116,119,111,100,111,116,115,46,97,98,111,
+118,101,15,116,104,114,101,101,100,111,116,115,46,97,98,111,118,101,15,116,
+104,114,101,101,100,111,116,115,46,98,101,108,111,119,7,117,110,105,48,54,
+54,48,7,117,110,105,48,54,54,49,7,117,110,105,48,54,54,50,7,117,110,105,48,
+54,54,51,7,117,110,105,48,54,54,52,7,117,110,105,48,54,54,53,7,117,110,105,
+48,54,54,54,7,117,110,105,48,54,54,55,7,117,110,105,48,54,54,56,7,117,110,
+105,48,54,54,57,7,117,110,105,48,54,70,52,7,117,110,105,48,54,70,53,7,117,
+110,105,48,54,70,54,12,117,110,105,48,54,67,49,46,105,110,105,116,12,117,
+110,105,48,54,67,49,46,109,101,100,105,7,117,110,105,48,54,66,69,7,117,110,
+105,48,54,68,50,12,117,110,105,48,54,68,50,46,102,105,110,97,7,117,110,105,
+48,54,65,57,12,117,110,105,48,54,65,57,46,102,105,110,97,7,117,110,105,48,
+54,65,70,12,117,110,105,48,54,65,70,46,105,110,105,116,12,117,110,105,48,
+54,65,70,46,109,101,100,105,12,117,110,105,48,54,65,70,46,102,105,110,97,
+7,117,110,105,48,54,66,65,12,117,110,105,48,54,66,65,46,102,105,110,97,7,
+117,110,105,48,54,54,65,7,117,110,105,48,54,49,70,7,117,110,105,48,54,48,
+67,7,117,110,105,48,54,49,66,7,117,110,105,48,54,54,66,7,117,110,105,48,54,
+54,67,7,117,110,105,48,54,54,68,7,117,110,105,48,54,52,66,7,117,110,105,48,
+54,52,68,7,117,110,105,48,54,52,69,7,117,110,105,48,54,52,70,7,117,110,105,
+48,54,52,67,7,117,110,105,48,54,53,48,7,117,110,105,48,54,53,49,7,117,110,
+105,48,54,53,50,7,117,110,105,48,54,53,51,7,117,110,105,48,54,53,52,7,117,
+110,105,48,54,53,53,7,117,110,105,48,54,55,48,7,117,110,105,48,54,53,54,7,
+117,110,105,48,54,49,53,12,117,110,105,48,54,50,70,46,102,105,110,97,5,119,
+97,115,108,97,12,117,110,105,48,54,54,69,46,105,110,105,116,12,117,110,105,
+48,54,54,69,46,109,101,100,105,20,98,101,104,95,100,111,116,108,101,115,115,
+95,97,108,116,46,105,110,105,116,20,98,101,104,95,100,111,116,108,101,115,
+115,95,97,108,116,46,109,101,100,105,12,117,110,105,48,54,67,49,46,102,105,
+110,97,7,117,110,105,48,54,56,54,12,117,110,105,48,54,56,54,46,102,105,110,
+97,12,111,110,101,100,111,116,46,98,101,108,111,119,13,116,119,111,100,111,
+116,115,46,98,101,108,111,119,13,97,108,101,102,95,97,108,116,46,105,115,
+111,108,13,97,108,101,102,95,97,108,116,46,102,105,110,97,7,117,110,105,48,
+54,50,51,12,117,110,105,48,54,50,51,46,102,105,110,97,7,117,110,105,48,54,
+50,53,12,117,110,105,48,54,50,53,46,102,105,110,97,7,117,110,105,48,54,50,
+50,12,117,110,105,48,54,50,50,46,102,105,110,97,7,117,110,105,48,54,55,49,
+12,117,110,105,48,54,55,49,46,102,105,110,97,7,117,110,105,48,54,50,56,12,
+117,110,105,48,54,50,56,46,105,110,105,116,12,117,110,105,48,54,50,56,46,
+109,101,100,105,12,117,110,105,48,54,50,56,46,102,105,110,97,7,117,110,105,
+48,54,55,69,12,117,110,105,48,54,55,69,46,102,105,110,97,12,117,110,105,48,
+54,55,69,46,105,110,105,116,12,117,110,105,48,54,55,69,46,109,101,100,105,
+7,117,110,105,48,54,50,65,12,117,110,105,48,54,50,65,46,105,110,105,116,12,
+117,110,105,48,54,50,65,46,109,101,100,105,12,117,110,105,48,54,50,65,46,
+102,105,110,97,7,117,110,105,48,54,50,66,12,117,110,105,48,54,50,66,46,105,
+110,105,116,12,117,110,105,48,54,50,66,46,109,101,100,105,12,117,110,105,
+48,54,50,66,46,102,105,110,97,7,117,110,105,48,54,55,57,12,117,110,105,48,
+54,55,57,46,105,110,105,116,12,117,110,105,48,54,55,57,46,109,101,100,105,
+12,117,110,105,48,54,55,57,46,102,105,110,97,7,117,110,105,48,54,50,57,12,
+117,110,105,48,54,50,57,46,102,105,110,97,12,117,110,105,48,54,56,54,46,105,
+110,105,116,12,117,110,105,48,54,56,54,46,109,101,100,105,7,117,110,105,48,
+54,50,67,12,117,110,105,48,54,50,67,46,105,110,105,116,12,117,110,105,48,
+54,50,67,46,109,101,100,105,12,117,110,105,48,54,50,67,46,102,105,110,97,
+7,117,110,105,48,54,50,69,12,117,110,105,48,54,50,69,46,105,110,105,116,12,
+117,110,105,48,54,50,69,46,109,101,100,105,12,117,110,105,48,54,50,69,46,
+102,105,110,97,7,117,110,105,48,54,51,48,12,117,110,105,48,54,51,48,46,102,
+105,110,97,7,117,110,105,48,54,56,56,12,117,110,105,48,54,56,56,46,102,105,
+110,97,7,117,110,105,48,54,51,50,12,117,110,105,48,54,51,50,46,102,105,110,
+97,7,117,110,105,48,54,57,49,12,117,110,105,48,54,57,49,46,102,105,110,97,
+7,117,110,105,48,54,57,56,12,117,110,105,48,54,57,56,46,102,105,110,97,7,
+117,110,105,48,54,51,52,12,117,110,105,48,54,51,52,46,105,110,105,116,12,
+117,110,105,48,54,51,52,46,109,101,100,105,12,117,110,105,48,54,51,52,46,
+102,105,110,97,7,117,110,105,48,54,51,54,12,117,110,105,48,54,51,54,46,105,
+110,105,116,12,117,110,105,48,54,51,54,46,109,101,100,105,12,117,110,105,
+48,54,51,54,46,102,105,110,97,7,117,110,105,48,54,51,56,12,117,110,105,48,
+54,51,56,46,105,110,105,116,12,117,110,105,48,54,51,56,46,109,101,100,105,
+12,117,110,105,48,54,51,56,46,102,105,110,97,7,117,110,105,48,54,51,65,12,
+117,110,105,48,54,51,65,46,105,110,105,116,12,117,110,105,48,54,51,65,46,
+109,101,100,105,12,117,110,105,48,54,51,65,46,102,105,110,97,12,117,110,105,
+48,54,65,57,46,105,110,105,116,12,117,110,105,48,54,65,57,46,109,101,100,
+105,7,117,110,105,48,54,52,49,12,117,110,105,48,54,52,49,46,105,110,105,116,
+12,117,110,105,48,54,52,49,46,109,101,100,105,12,117,110,105,48,54,52,49,
+46,102,105,110,97,8,118,101,104,46,105,115,111,108,8,118,101,104,46,105,110,
+105,116,8,118,101,104,46,109,101,100,105,8,118,101,104,46,102,105,110,97,
+12,117,110,105,48,54,52,50,46,105,110,105,116,12,117,110,105,48,54,52,50,
+46,109,101,100,105,7,117,110,105,48,54,52,50,12,117,110,105,48,54,52,50,46,
+102,105,110,97,12,117,110,105,48,54,52,54,46,105,110,105,116,12,117,110,105,
+48,54,52,54,46,109,101,100,105,7,117,110,105,48,54,52,54,12,117,110,105,48,
+54,52,54,46,102,105,110,97,7,117,110,105,48,54,68,53,7,117,110,105,48,54,
+67,48,12,117,110,105,48,54,67,48,46,102,105,110,97,7,117,110,105,48,54,50,
+52,12,117,110,105,48,54,50,52,46,102,105,110,97,12,117,110,105,48,54,52,57,
+46,105,110,105,116,12,117,110,105,48,54,52,57,46,109,101,100,105,12,117,110,
+105,48,54,52,65,46,105,110,105,116,12,117,110,105,48,54,52,65,46,109,101,
+100,105,7,117,110,105,48,54,52,65,12,117,110,105,48,54,52,65,46,102,105,110,
+97,7,117,110,105,48,54,67,67,12,117,110,105,48,54,67,67,46,105,110,105,116,
+12,117,110,105,48,54,67,67,46,109,101,100,105,12,117,110,105,48,54,67,67,
+46,102,105,110,97,7,117,110,105,48,54,68,51,12,117,110,105,48,54,68,51,46,
+102,105,110,97,7,117,110,105,48,54,50,54,12,117,110,105,48,54,50,54,46,105,
+110,105,116,12,117,110,105,48,54,50,54,46,109,101,100,105,12,117,110,105,
+48,54,50,54,46,102,105,110,97,16,117,110,105,48,54,52,52,48,54,50,51,46,105,
+115,111,108,16,117,110,105,48,54,52,52,48,54,50,51,46,102,105,110,97,16,117,
+110,105,48,54,52,52,48,54,50,53,46,105,115,111,108,16,117,110,105,48,54,52,
+52,48,54,50,53,46,102,105,110,97,16,117,110,105,48,54,52,52,48,54,50,50,46,
+105,115,111,108,16,117,110,105,48,54,52,52,48,54,50,50,46,102,105,110,97,
+16,117,110,105,48,54,52,52,48,54,55,49,46,105,115,111,108,16,117,110,105,
+48,54,52,52,48,54,55,49,46,102,105,110,97,11,104,101,104,95,97,101,46,102,
+105,110,97,7,117,110,105,48,54,67,50,12,117,110,105,48,54,67,50,46,102,105,
+110,97,7,117,110,105,48,54,67,49,7,117,110,105,48,54,67,51,12,117,110,105,
+48,54,67,51,46,102,105,110,97,12,117,110,105,48,54,66,69,46,102,105,110,97,
+12,117,110,105,48,54,66,69,46,105,110,105,116,12,117,110,105,48,54,66,69,
+46,109,101,100,105,7,117,110,105,48,54,70,48,7,117,110,105,48,54,70,49,7,
+117,110,105,48,54,70,50,7,117,110,105,48,54,70,51,7,117,110,105,48,54,70,
+57,7,117,110,105,48,54,70,55,7,117,110,105,48,54,70,56,12,117,110,105,48,
+54,70,52,46,117,114,100,117,12,117,110,105,48,54,70,55,46,117,114,100,117,
+11,102,97,116,104,97,116,97,110,95,48,49,11,100,97,109,109,97,116,97,110,
+95,48,49,11,107,97,115,114,97,116,97,110,95,48,49,8,102,97,116,104,97,95,
+48,49,8,100,97,109,109,97,95,48,49,8,107,97,115,114,97,95,48,49,9,115,104,
+97,100,100,97,95,48,49,8,115,117,107,117,110,95,48,49,12,71,104,117,110,110,
+97,95,97,98,111,118,101,11,117,110,105,48,54,53,49,48,54,52,67,11,117,110,
+105,48,54,53,49,48,54,52,68,11,117,110,105,48,54,53,49,48,54,52,66,11,117,
+110,105,48,54,53,49,48,54,52,69,11,117,110,105,48,54,53,49,48,54,52,70,11,
+117,110,105,48,54,53,49,48,54,53,48,7,117,110,105,70,67,54,51,11,117,110,
+105,48,54,53,52,48,54,52,66,11,117,110,105,48,54,53,52,48,54,52,69,11,117,
+110,105,48,54,53,52,48,54,52,67,11,117,110,105,48,54,53,52,48,54,52,70,11,
+117,110,105,48,54,53,52,48,54,53,50,11,117,110,105,48,54,53,53,48,54,52,68,
+11,117,110,105,48,54,53,53,48,54,53,48,7,117,110,105,48,54,55,50,12,117,110,
+105,48,54,55,50,46,102,105,110,97,7,117,110,105,48,54,55,51,12,117,110,105,
+48,54,55,51,46,102,105,110,97,7,117,110,105,48,54,55,53,12,117,110,105,48,
+54,55,53,46,102,105,110,97,7,117,110,105,48,54,55,54,12,117,110,105,48,54,
+55,54,46,102,105,110,97,7,117,110,105,48,54,55,55,12,117,110,105,48,54,55,
+55,46,102,105,110,97,7,117,110,105,48,54,55,56,12,117,110,105,48,54,55,56,
+46,102,105,110,97,7,117,110,105,48,54,55,65,12,117,110,105,48,54,55,65,46,
+102,105,110,97,12,117,110,105,48,54,55,65,46,105,110,105,116,12,117,110,105,
+48,54,55,65,46,109,101,100,105,7,117,110,105,48,54,55,66,12,117,110,105,48,
+54,55,66,46,102,105,110,97,12,117,110,105,48,54,55,66,46,105,110,105,116,
+12,117,110,105,48,54,55,66,46,109,101,100,105,7,117,110,105,48,54,55,67,12,
+117,110,105,48,54,55,67,46,102,105,110,97,12,117,110,105,48,54,55,67,46,105,
+110,105,116,12,117,110,105,48,54,55,67,46,109,101,100,105,7,117,110,105,48,
+54,55,68,12,117,110,105,48,54,55,68,46,102,105,110,97,12,117,110,105,48,54,
+55,68,46,105,110,105,116,12,117,110,105,48,54,55,68,46,109,101,100,105,7,
+117,110,105,48,54,55,70,12,117,110,105,48,54,55,70,46,102,105,110,97,12,117,
+110,105,48,54,55,70,46,105,110,105,116,12,117,110,105,48,54,55,70,46,109,
+101,100,105,7,117,110,105,48,54,56,48,12,117,110,105,48,54,56,48,46,102,105,
+110,97,12,117,110,105,48,54,56,48,46,105,110,105,116,12,117,110,105,48,54,
+56,48,46,109,101,100,105,7,117,110,105,48,54,56,49,12,117,110,105,48,54,56,
+49,46,102,105,110,97,12,117,110,105,48,54,56,49,46,105,110,105,116,12,117,
+110,105,48,54,56,49,46,109,101,100,105,7,117,110,105,48,54,56,50,12,117,110,
+105,48,54,56,50,46,102,105,110,97,12,117,110,105,48,54,56,50,46,105,110,105,
+116,12,117,110,105,48,54,56,50,46,109,101,100,105,7,117,110,105,48,54,56,
+51,12,117,110,105,48,54,56,51,46,102,105,110,97,12,117,110,105,48,54,56,51,
+46,105,110,105,116,12,117,110,105,48,54,56,51,46,109,101,100,105,7,117,110,
+105,48,54,56,52,12,117,110,105,48,54,56,52,46,102,105,110,97,12,117,110,105,
+48,54,56,52,46,105,110,105,116,12,117,110,105,48,54,56,52,46,109,101,100,
+105,7,117,110,105,48,54,56,53,12,117,110,105,48,54,56,53,46,102,105,110,97,
+12,117,110,105,48,54,56,53,46,105,110,105,116,12,117,110,105,48,54,56,53,
+46,109,101,100,105,7,117,110,105,48,54,56,55,12,117,110,105,48,54,56,55,46,
+102,105,110,97,12,117,110,105,48,54,56,55,46,105,110,105,116,12,117,110,105,
+48,54,56,55,46,109,101,100,105,7,117,110,105,48,54,56,57,12,117,110,105,48,
+54,56,57,46,102,105,110,97,7,117,110,105,48,54,56,65,12,117,110,105,48,54,
+56,65,46,102,105,110,97,7,117,110,105,48,54,56,66,12,117,110,105,48,54,56,
+66,46,102,105,110,97,7,117,110,105,48,54,56,67,12,117,110,105,48,54,56,67,
+46,102,105,110,97,7,117,110,105,48,54,56,68,12,117,110,105,48,54,56,68,46,
+102,105,110,97,7,117,110,105,48,54,56,69,12,117,110,105,48,54,56,69,46,102,
+105,110,97,7,117,110,105,48,54,56,70,12,117,110,105,48,54,56,70,46,102,105,
+110,97,7,117,110,105,48,54,57,48,12,117,110,105,48,54,57,48,46,102,105,110,
+97,7,117,110,105,48,54,57,50,12,117,110,105,48,54,57,50,46,102,105,110,97,
+7,117,110,105,48,54,57,51,12,117,110,105,48,54,57,51,46,102,105,110,97,7,
+117,110,105,48,54,57,52,12,117,110,105,48,54,57,52,46,102,105,110,97,7,117,
+110,105,48,54,57,53,12,117,110,105,48,54,57,53,46,102,105,110,97,7,117,110,
+105,48,54,57,54,12,117,110,105,48,54,57,54,46,102,105,110,97,7,117,110,105,
+48,54,57,55,12,117,110,105,48,54,57,55,46,102,105,110,97,7,117,110,105,48,
+54,57,57,12,117,110,105,48,54,57,57,46,102,105,110,97,7,117,110,105,48,54,
+57,65,12,117,110,105,48,54,57,65,46,102,105,110,97,12,117,110,105,48,54,57,
+65,46,105,110,105,116,12,117,110,105,48,54,57,65,46,109,101,100,105,7,117,
+110,105,48,54,57,66,12,117,110,105,48,54,57,66,46,102,105,110,97,12,117,110,
+105,48,54,57,66,46,105,110,105,116,12,117,110,105,48,54,57,66,46,109,101,
+100,105,7,117,110,105,48,54,57,67,12,117,110,105,48,54,57,67,46,102,105,110,
+97,12,117,110,105,48,54,57,67,46,105,110,105,116,12,117,110,105,48,54,57,
+67,46,109,101,100,105,7,117,110,105,48,54,57,68,12,117,110,105,48,54,57,68,
+46,102,105,110,97,12,117,110,105,48,54,57,68,46,105,110,105,116,12,117,110,
+105,48,54,57,68,46,109,101,100,105,7,117,110,105,48,54,57,69,12,117,110,105,
+48,54,57,69,46,102,105,110,97,12,117,110,105,48,54,57,69,46,105,110,105,116,
+12,117,110,105,48,54,57,69,46,109,101,100,105,7,117,110,105,48,54,57,70,12,
+117,110,105,48,54,57,70,46,102,105,110,97,7,117,110,105,48,54,65,48,12,117,
+110,105,48,54,65,48,46,102,105,110,97,12,117,110,105,48,54,65,48,46,105,110,
+105,116,12,117,110,105,48,54,65,48,46,109,101,100,105,7,117,110,105,48,54,
+65,49,7,117,110,105,48,54,65,50,12,117,110,105,48,54,65,50,46,102,105,110,
+97,12,117,110,105,48,54,65,50,46,105,110,105,116,12,117,110,105,48,54,65,
+50,46,109,101,100,105,7,117,110,105,48,54,65,51,12,117,110,105,48,54,65,51,
+46,102,105,110,97,12,117,110,105,48,54,65,51,46,105,110,105,116,12,117,110,
+105,48,54,65,51,46,109,101,100,105,12,117,110,105,48,54,65,52,46,102,105,
+110,97,12,117,110,105,48,54,65,52,46,105,110,105,116,12,117,110,105,48,54,
+65,52,46,109,101,100,105,7,117,110,105,48,54,65,53,12,117,110,105,48,54,65,
+53,46,102,105,110,97,12,117,110,105,48,54,65,53,46,105,110,105,116,12,117,
+110,105,48,54,65,53,46,109,101,100,105,7,117,110,105,48,54,65,54,12,117,110,
+105,48,54,65,54,46,102,105,110,97,12,117,110,105,48,54,65,54,46,105,110,105,
+116,12,117,110,105,48,54,65,54,46,109,101,100,105,7,117,110,105,48,54,65,
+55,12,117,110,105,48,54,65,55,46,102,105,110,97,7,117,110,105,48,54,65,56,
+12,117,110,105,48,54,65,56,46,102,105,110,97,7,117,110,105,48,54,65,65,12,
+117,110,105,48,54,65,65,46,102,105,110,97,12,117,110,105,48,54,65,65,46,105,
+110,105,116,12,117,110,105,48,54,65,65,46,109,101,100,105,7,117,110,105,48,
+54,65,66,12,117,110,105,48,54,65,66,46,102,105,110,97,12,117,110,105,48,54,
+65,66,46,105,110,105,116,12,117,110,105,48,54,65,66,46,109,101,100,105,7,
+117,110,105,48,54,65,67,12,117,110,105,48,54,65,67,46,102,105,110,97,12,117,
+110,105,48,54,65,67,46,105,110,105,116,12,117,110,105,48,54,65,67,46,109,
+101,100,105,7,117,110,105,48,54,65,68,12,117,110,105,48,54,65,68,46,102,105,
+110,97,12,117,110,105,48,54,65,68,46,105,110,105,116,12,117,110,105,48,54,
+65,68,46,109,101,100,105,7,117,110,105,48,54,65,69,12,117,110,105,48,54,65,
+69,46,102,105,110,97,12,117,110,105,48,54,65,69,46,105,110,105,116,12,117,
+110,105,48,54,65,69,46,109,101,100,105,7,117,110,105,48,54,66,48,12,117,110,
+105,48,54,66,48,46,102,105,110,97,12,117,110,105,48,54,66,48,46,105,110,105,
+116,12,117,110,105,48,54,66,48,46,109,101,100,105,7,117,110,105,48,54,66,
+49,12,117,110,105,48,54,66,49,46,102,105,110,97,12,117,110,105,48,54,66,49,
+46,105,110,105,116,12,117,110,105,48,54,66,49,46,109,101,100,105,7,117,110,
+105,48,54,66,50,12,117,110,105,48,54,66,50,46,102,105,110,97,12,117,110,105,
+48,54,66,50,46,105,110,105,116,12,117,110,105,48,54,66,50,46,109,101,100,
+105,7,117,110,105,48,54,66,51,12,117,110,105,48,54,66,51,46,102,105,110,97,
+12,117,110,105,48,54,66,51,46,105,110,105,116,12,117,110,105,48,54,66,51,
+46,109,101,100,105,7,117,110,105,48,54,66,52,12,117,110,105,48,54,66,52,46,
+102,105,110,97,12,117,110,105,48,54,66,52,46,105,110,105,116,12,117,110,105,
+48,54,66,52,46,109,101,100,105,7,117,110,105,48,54,66,53,12,117,110,105,48,
+54,66,53,46,102,105,110,97,12,117,110,105,48,54,66,53,46,105,110,105,116,
+12,117,110,105,48,54,66,53,46,109,101,100,105,7,117,110,105,48,54,66,54,12,
+117,110,105,48,54,66,54,46,102,105,110,97,12,117,110,105,48,54,66,54,46,105,
+110,105,116,12,117,110,105,48,54,66,54,46,109,101,100,105,7,117,110,105,48,
+54,66,55,12,117,110,105,48,54,66,55,46,102,105,110,97,12,117,110,105,48,54,
+66,55,46,105,110,105,116,12,117,110,105,48,54,66,55,46,109,101,100,105,7,
+117,110,105,48,54,66,56,12,117,110,105,48,54,66,56,46,102,105,110,97,12,117,
+110,105,48,54,66,56,46,105,110,105,116,12,117,110,105,48,54,66,56,46,109,
+101,100,105,7,117,110,105,48,54,66,57,12,117,110,105,48,54,66,57,46,102,105,
+110,97,12,117,110,105,48,54,66,57,46,105,110,105,116,12,117,110,105,48,54,
+66,57,46,109,101,100,105,7,117,110,105,48,54,66,66,12,117,110,105,48,54,66,
+66,46,102,105,110,97,7,117,110,105,48,54,66,67,12,117,110,105,48,54,66,67,
+46,102,105,110,97,12,117,110,105,48,54,66,67,46,105,110,105,116,12,117,110,
+105,48,54,66,67,46,109,101,100,105,7,117,110,105,48,54,66,68,12,117,110,105,
+48,54,66,68,46,102,105,110,97,7,117,110,105,48,54,66,70,12,117,110,105,48,
+54,66,70,46,102,105,110,97,12,117,110,105,48,54,66,70,46,105,110,105,116,
+12,117,110,105,48,54,66,70,46,109,101,100,105,7,117,110,105,48,54,67,52,12,
+117,110,105,48,54,67,52,46,102,105,110,97,7,117,110,105,48,54,67,53,7,117,
+110,105,48,54,67,68,12,117,110,105,48,54,67,68,46,102,105,110,97,7,117,110,
+105,48,54,68,54,7,117,110,105,48,54,68,55,7,117,110,105,48,54,68,56,7,117,
+110,105,48,54,68,57,7,117,110,105,48,54,68,65,7,117,110,105,48,54,68,66,7,
+117,110,105,48,54,68,67,7,117,110,105,48,54,68,70,7,117,110,105,48,54,69,
+49,7,117,110,105,48,54,69,50,7,117,110,105,48,54,69,51,7,117,110,105,48,54,
+69,52,7,117,110,105,48,54,69,53,7,117,110,105,48,54,69,54,7,117,110,105,48,
+54,69,55,7,117,110,105,48,54,69,56,7,117,110,105,48,54,69,65,7,117,110,105,
+48,54,69,66,7,117,110,105,48,54,69,68,7,117,110,105,48,54,70,66,12,117,110,
+105,48,54,70,66,46,102,105,110,97,12,117,110,105,48,54,70,66,46,105,110,105,
+116,12,117,110,105,48,54,70,66,46,109,101,100,105,7,117,110,105,48,54,70,
+67,12,117,110,105,48,54,70,67,46,102,105,110,97,12,117,110,105,48,54,70,67,
+46,105,110,105,116,12,117,110,105,48,54,70,67,46,109,101,100,105,7,117,110,
+105,48,54,70,68,7,117,110,105,48,54,70,69,15,117,110,105,48,54,65,68,46,109,
+111,114,111,99,99,111,19,117,110,105,48,54,65,68,46,102,105,110,97,109,111,
+114,111,99,99,111,16,117,110,105,48,54,52,52,48,54,55,50,46,105,115,111,108,
+16,117,110,105,48,54,52,52,48,54,55,50,46,102,105,110,97,16,117,110,105,48,
+54,52,52,48,54,55,51,46,105,115,111,108,16,117,110,105,48,54,52,52,48,54,
+55,51,46,102,105,110,97,16,117,110,105,48,54,52,52,48,54,55,53,46,105,115,
+111,108,16,117,110,105,48,54,52,52,48,54,55,53,46,102,105,110,97,16,117,110,
+105,48,54,66,53,48,54,50,55,46,105,115,111,108,16,117,110,105,48,54,66,53,
+48,54,50,55,46,102,105,110,97,16,117,110,105,48,54,66,54,48,54,50,55,46,105,
+115,111,108,16,117,110,105,48,54,66,54,48,54,50,55,46,102,105,110,97,16,117,
+110,105,48,54,66,55,48,54,50,55,46,105,115,111,108,16,117,110,105,48,54,66,
+55,48,54,50,55,46,102,105,110,97,16,117,110,105,48,54,66,56,48,54,50,55,46,
+105,115,111,108,16,117,110,105,48,54,66,56,48,54,50,55,46,102,105,110,97,
+7,117,110,105,48,54,48,48,7,117,110,105,48,54,48,49,7,117,110,105,48,54,48,
+50,7,117,110,105,48,54,48,51,7,117,110,105,48,54,48,69,7,117,110,105,48,54,
+48,70,7,117,110,105,48,54,49,48,7,117,110,105,48,54,49,49,7,117,110,105,48,
+54,49,50,7,117,110,105,48,54,49,51,7,117,110,105,48,54,49,52,7,117,110,105,
+48,54,53,55,7,117,110,105,48,54,53,56,7,117,110,105,48,54,69,69,12,117,110,
+105,48,54,69,69,46,102,105,110,97,7,117,110,105,48,54,69,70,12,117,110,105,
+48,54,69,70,46,102,105,110,97,7,117,110,105,48,54,70,70,12,117,110,105,48,
+54,70,70,46,102,105,110,97,12,117,110,105,48,54,70,70,46,105,110,105,116,
+12,117,110,105,48,54,70,70,46,109,101,100,105,5,97,108,108,97,104,5,114,105,
+121,97,108,7,117,110,105,48,54,48,66,7,117,110,105,48,54,49,69,7,117,110,
+105,48,54,53,57,7,117,110,105,48,54,53,65,7,117,110,105,48,54,53,66,7,117,
+110,105,48,54,53,67,7,117,110,105,48,54,53,68,7,117,110,105,48,54,53,69,7,
+117,110,105,48,55,53,48,12,117,110,105,48,55,53,48,46,102,105,110,97,12,117,
+110,105,48,55,53,48,46,105,110,105,116,12,117,110,105,48,55,53,48,46,109,
+101,100,105,7,117,110,105,48,55,53,49,12,117,110,105,48,55,53,49,46,102,105,
+110,97,12,117,110,105,48,55,53,49,46,105,110,105,116,12,117,110,105,48,55,
+53,49,46,109,101,100,105,7,117,110,105,48,55,53,50,12,117,110,105,48,55,53,
+50,46,102,105,110,97,12,117,110,105,48,55,53,50,46,105,110,105,116,12,117,
+110,105,48,55,53,50,46,109,101,100,105,7,117,110,105,48,55,53,51,12,117,110,
+105,48,55,53,51,46,102,105,110,97,12,117,110,105,48,55,53,51,46,105,110,105,
+116,12,117,110,105,48,55,53,51,46,109,101,100,105,7,117,110,105,48,55,53,
+52,12,117,110,105,48,55,53,52,46,102,105,110,97,12,117,110,105,48,55,53,52,
+46,105,110,105,116,12,117,110,105,48,55,53,52,46,109,101,100,105,7,117,110,
+105,48,55,53,53,12,117,110,105,48,55,53,53,46,102,105,110,97,12,117,110,105,
+48,55,53,53,46,105,110,105,116,12,117,110,105,48,55,53,53,46,109,101,100,
+105,7,117,110,105,48,55,53,54,12,117,110,105,48,55,53,54,46,102,105,110,97,
+12,117,110,105,48,55,53,54,46,105,110,105,116,12,117,110,105,48,55,53,54,
+46,109,101,100,105,7,117,110,105,48,55,53,55,12,117,110,105,48,55,53,55,46,
+102,105,110,97,12,117,110,105,48,55,53,55,46,105,110,105,116,12,117,110,105,
+48,55,53,55,46,109,101,100,105,7,117,110,105,48,55,53,56,12,117,110,105,48,
+55,53,56,46,102,105,110,97,12,117,110,105,48,55,53,56,46,105,110,105,116,
+12,117,110,105,48,55,53,56,46,109,101,100,105,7,117,110,105,48,55,53,57,12,
+117,110,105,48,55,53,57,46,102,105,110,97,7,117,110,105,48,55,53,65,12,117,
+110,105,48,55,53,65,46,102,105,110,97,7,117,110,105,48,55,53,66,12,117,110,
+105,48,55,53,66,46,102,105,110,97,7,117,110,105,48,55,53,67,12,117,110,105,
+48,55,53,67,46,102,105,110,97,12,117,110,105,48,55,53,67,46,105,110,105,116,
+12,117,110,105,48,55,53,67,46,109,101,100,105,7,117,110,105,48,55,53,68,12,
+117,110,105,48,55,53,68,46,102,105,110,97,12,117,110,105,48,55,53,68,46,105,
+110,105,116,12,117,110,105,48,55,53,68,46,109,101,100,105,7,117,110,105,48,
+55,53,69,12,117,110,105,48,55,53,69,46,102,105,110,97,12,117,110,105,48,55,
+53,69,46,105,110,105,116,12,117,110,105,48,55,53,69,46,109,101,100,105,7,
+117,110,105,48,55,53,70,12,117,110,105,48,55,53,70,46,102,105,110,97,12,117,
+110,105,48,55,53,70,46,105,110,105,116,12,117,110,105,48,55,53,70,46,109,
+101,100,105,7,117,110,105,48,55,54,48,12,117,110,105,48,55,54,48,46,102,105,
+110,97,12,117,110,105,48,55,54,48,46,105,110,105,116,12,117,110,105,48,55,
+54,48,46,109,101,100,105,7,117,110,105,48,55,54,49,12,117,110,105,48,55,54,
+49,46,102,105,110,97,12,117,110,105,48,55,54,49,46,105,110,105,116,12,117,
+110,105,48,55,54,49,46,109,101,100,105,7,117,110,105,48,55,54,50,12,117,110,
+105,48,55,54,50,46,102,105,110,97,12,117,110,105,48,55,54,50,46,105,110,105,
+116,12,117,110,105,48,55,54,50,46,109,101,100,105,7,117,110,105,48,55,54,
+51,12,117,110,105,48,55,54,51,46,102,105,110,97,12,117,110,105,48,55,54,51,
+46,105,110,105,116,12,117,110,105,48,55,54,51,46,109,101,100,105,7,117,110,
+105,48,55,54,52,12,117,110,105,48,55,54,52,46,102,105,110,97,12,117,110,105,
+48,55,54,52,46,105,110,105,116,12,117,110,105,48,55,54,52,46,109,101,100,
+105,7,117,110,105,48,55,54,53,12,117,110,105,48,55,54,53,46,102,105,110,97,
+12,117,110,105,48,55,54,53,46,105,110,105,116,12,117,110,105,48,55,54,53,
+46,109,101,100,105,7,117,110,105,48,55,54,54,12,117,110,105,48,55,54,54,46,
+102,105,110,97,12,117,110,105,48,55,54,54,46,105,110,105,116,12,117,110,105,
+48,55,54,54,46,109,101,100,105,7,117,110,105,48,55,54,55,12,117,110,105,48,
+55,54,55,46,102,105,110,97,12,117,110,105,48,55,54,55,46,105,110,105,116,
+12,117,110,105,48,55,54,55,46,109,101,100,105,7,117,110,105,48,55,54,56,12,
+117,110,105,48,55,54,56,46,102,105,110,97,12,117,110,105,48,55,54,56,46,105,
+110,105,116,12,117,110,105,48,55,54,56,46,109,101,100,105,7,117,110,105,48,
+55,54,57,12,117,110,105,48,55,54,57,46,102,105,110,97,12,117,110,105,48,55,
+54,57,46,105,110,105,116,12,117,110,105,48,55,54,57,46,109,101,100,105,7,
+117,110,105,48,55,54,65,12,117,110,105,48,55,54,65,46,102,105,110,97,12,117,
+110,105,48,55,54,65,46,105,110,105,116,12,117,110,105,48,55,54,65,46,109,
+101,100,105,7,117,110,105,48,55,54,66,12,117,110,105,48,55,54,66,46,102,105,
+110,97,7,117,110,105,48,55,54,67,12,117,110,105,48,55,54,67,46,102,105,110,
+97,7,117,110,105,48,55,54,68,12,117,110,105,48,55,54,68,46,102,105,110,97,
+12,117,110,105,48,55,54,68,46,105,110,105,116,12,117,110,105,48,55,54,68,
+46,109,101,100,105,19,116,119,111,100,111,116,115,46,115,109,97,108,108,46,
+97,98,111,118,101,19,116,119,111,100,111,116,115,46,115,109,97,108,108,46,
+98,101,108,111,119,18,116,119,111,100,111,116,115,46,118,101,114,116,46,97,
+98,111,118,101,18,116,119,111,100,111,116,115,46,118,101,114,116,46,98,101,
+108,111,119,24,116,119,111,100,111,116,115,46,118,101,114,116,46,115,109,
+97,108,108,46,97,98,111,118,101,24,116,119,111,100,111,116,115,46,118,101,
+114,116,46,115,109,97,108,108,46,98,101,108,111,119,21,116,104,114,101,101,
+100,111,116,115,46,115,109,97,108,108,46,97,98,111,118,101,21,116,104,114,
+101,101,100,111,116,115,46,115,109,97,108,108,46,98,101,108,111,119,14,102,
+111,117,114,100,111,116,115,46,97,98,111,118,101,14,102,111,117,114,100,111,
+116,115,46,98,101,108,111,119,20,116,104,114,101,101,100,111,116,115,46,104,
+111,114,122,46,98,101,108,111,119,13,115,109,97,108,108,118,46,97,114,97,
+98,105,99,17,99,105,114,99,117,109,102,108,101,120,46,97,114,97,98,105,99,
+12,104,97,109,122,97,95,109,101,100,105,97,108,15,119,97,118,121,104,97,109,
+122,97,95,97,98,111,118,101,15,119,97,118,121,104,97,109,122,97,95,98,101,
+108,111,119,19,116,104,114,101,101,100,111,116,115,46,114,101,118,46,97,98,
+111,118,101,19,116,104,114,101,101,100,111,116,115,46,114,101,118,46,98,101,
+108,111,119,7,117,110,105,48,54,65,52,12,117,110,105,48,54,67,53,46,102,105,
+110,97,7,117,110,105,48,54,67,54,12,117,110,105,48,54,67,54,46,102,105,110,
+97,7,117,110,105,48,54,67,55,12,117,110,105,48,54,67,55,46,102,105,110,97,
+7,117,110,105,48,54,67,56,12,117,110,105,48,54,67,56,46,102,105,110,97,7,
+117,110,105,48,54,67,57,12,117,110,105,48,54,67,57,46,102,105,110,97,7,117,
+110,105,48,54,67,65,12,117,110,105,48,54,67,65,46,102,105,110,97,7,117,110,
+105,48,54,67,66,12,117,110,105,48,54,67,66,46,102,105,110,97,7,117,110,105,
+48,54,67,70,12,117,110,105,48,54,67,70,46,102,105,110,97,12,117,110,105,48,
+54,67,69,46,105,110,105,116,12,117,110,105,48,54,67,69,46,109,101,100,105,
+7,117,110,105,48,54,67,69,12,117,110,105,48,54,67,69,46,102,105,110,97,7,
+117,110,105,48,54,68,48,12,117,110,105,48,54,68,48,46,102,105,110,97,12,117,
+110,105,48,54,68,48,46,105,110,105,116,12,117,110,105,48,54,68,48,46,109,
+101,100,105,7,117,110,105,48,54,68,49,12,117,110,105,48,54,68,49,46,102,105,
+110,97,7,117,110,105,48,54,68,52,7,117,110,105,48,54,70,65,12,117,110,105,
+48,54,70,65,46,102,105,110,97,12,117,110,105,48,54,70,65,46,105,110,105,116,
+12,117,110,105,48,54,70,65,46,109,101,100,105,16,117,110,105,48,55,54,65,
+48,54,50,55,46,105,115,111,108,16,117,110,105,48,55,54,65,48,54,50,55,46,
+102,105,110,97,7,117,110,105,48,54,68,68,7,117,110,105,48,54,68,69,7,117,
+110,105,48,54,69,48,7,117,110,105,48,54,69,57,7,117,110,105,48,54,48,68,10,
+112,97,116,97,104,46,119,105,100,101,18,116,119,111,100,111,116,115,95,97,
+108,116,49,46,98,101,108,111,119,24,116,104,114,101,101,100,111,116,115,46,
+114,101,118,95,97,108,116,49,46,98,101,108,111,119,20,116,104,114,101,101,
+100,111,116,115,95,97,108,116,49,46,98,101,108,111,119,23,116,119,111,100,
+111,116,115,46,118,101,114,116,95,97,108,116,49,46,98,101,108,111,119,20,
+116,104,114,101,101,100,111,116,115,95,97,108,116,50,46,98,101,108,111,119,
+25,116,104,114,101,101,100,111,116,115,46,104,111,114,122,95,97,108,116,49,
+46,98,101,108,111,119,7,117,110,105,70,68,51,69,7,117,110,105,70,68,51,70,
+12,104,97,104,95,97,108,116,46,105,115,111,108,12,104,97,104,95,97,108,116,
+46,102,105,110,97,8,100,105,97,103,111,110,97,108,20,116,104,114,101,101,
+100,111,116,115,95,97,108,116,49,46,97,98,111,118,101,20,116,104,114,101,
+101,100,111,116,115,95,97,108,116,50,46,97,98,111,118,101,18,116,119,111,
+100,111,116,115,95,97,108,116,49,46,97,98,111,118,101,24,116,104,114,101,
+101,100,111,116,115,46,114,101,118,95,97,108,116,50,46,98,101,108,111,119,
+7,117,110,105,50,53,67,67,12,117,110,105,48,54,57,70,46,105,110,105,116,12,
+117,110,105,48,54,57,70,46,109,101,100,105,4,90,87,83,80,7,117,110,105,50,
+48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,50,48,48,69,7,117,110,105,
+50,48,48,70,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,178,0,0,0,2,0,
+27,0,0,0,49,0,1,0,50,0,51,0,2,0,52,0,97,0,1,0,98,0,111,0,3,0,112,0,112,0,
+1,0,113,0,113,0,3,0,114,0,229,0,1,0,230,0,237,0,2,0,238,1,7,0,1,1,8,1,22,
+0,3,1,23,1,239,0,1,1,240,1,251,0,3,1,252,1,253,0,1,1,254,2,2,0,3,2,3,2,14,
+0,1,2,15,2,28,0,2,2,29,2,34,0,1,2,35,2,41,0,3,2,42,2,49,0,1,2,50,2,51,0,2,
+2,52,2,53,0,1,2,54,2,59,0,3,2,60,2,218,0,1,2,219,2,220,0,2,2,221,2,222,0,
+1,2,223,2,223,0,3,2,224,2,249,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,64,0,
+150,0,1,97,114,97,98,0,8,0,16,0,2,70,65,82,32,0,26,85,82,68,32,0,36,0,0,255,
+255,0,2,0,0,0,3,0,0,255,255,0,2,0,1,0,4,0,0,255,255,0,2,0,2,0,5,0,6,109,97,
+114,107,0,38,109,97,114,107,0,46,109,97,114,107,0,54,109,107,109,107,0,62,
+109,107,109,107,0,70,109,107,109,107,0,78,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,
+0,0,0,2,0,0,0,1,0,0,0,2,0,2,0,3,0,0,0,2,0,2,0,3,0,0,0,2,0,2,0,3,0,4,0,10,
+0,18,0,26,0,34,0,4,0,1,0,1,0,32,0,5,0,1,0,1,10,128,0,6,0,1,0,1,13,46,0,6,
+0,1,0,1,15,30,0,1,9,196,9,248,0,2,0,12,0,254,0,60,0,0,15,202,0,1,20,116,0,
+0,15,202,0,0,15,202,0,0,15,202,0,1,20,116,0,0,15,208,0,0,15,214,0,0,15,232,
+0,0,15,232,0,1,20,122,0,0,15,238,0,1,20,146,0,0,24,88,0,0,15,232,0,0,15,208,
+0,0,15,220,0,0,15,208,0,0,15,208,0,0,15,208,0,0,15,226,0,0,15,208,0,0,15,
+232,0,0,15,232,0,0,15,232,0,0,15,232,0,0,15,232,0,1,20,122,0,1,20,122,0,0,
+15,244,0,0,15,250,0,0,16,0,0,0,16,6,0,0,15,250,0,0,16,0,0,0,16,12,0,0,15,
+244,0,0,16,0,0,0,15,244,0,1,20,128,0,0,16,24,0,0,16,30,0,0,16,6,0,1,20,134,
+0,0,16,36,0,1,20,140,0,0,16,42,0,0,16,48,0,0,16,54,0,0,16,54,0,0,16,60,0,
+0,16,54,0,0,16,54,0,0,16,54,0,0,16,36,0,0,16,66,0,1,20,152,0,0,16,72,0,0,
+16,66,0,0,16,18,2,49,15,92,19,172,15,110,19,178,15,110,19,184,16,100,20,162,
+16,118,20,180,16,118,20,180,16,100,20,162,16,142,20,210,16,190,20,240,16,
+190,20,240,16,244,21,32,17,12,21,56,17,12,21,56,16,244,21,32,17,30,21,74,
+17,54,19,214,17,54,19,214,17,30,21,74,17,72,19,214,17,78,21,98,17,78,21,98,
+17,72,19,214,17,102,21,104,17,156,20,180,17,156,20,180,17,102,21,104,18,74,
+20,180,18,74,20,180,18,20,19,214,18,20,19,214,18,128,21,212,18,134,21,224,
+18,134,20,24,18,128,21,212,18,170,21,236,18,182,19,172,18,182,19,172,18,170,
+21,236,18,236,21,140,18,248,21,140,18,248,21,140,18,242,22,28,18,182,22,46,
+18,182,22,46,19,64,22,58,19,64,22,58,19,124,22,94,15,128,19,214,15,128,19,
+214,17,252,21,140,17,252,21,140,17,210,21,116,17,204,21,122,17,204,21,122,
+19,22,22,34,19,28,22,40,18,248,22,28,19,100,22,88,19,106,22,88,18,14,19,214,
+18,14,19,214,18,38,19,214,18,80,20,180,18,80,20,180,18,38,19,214,18,194,22,
+4,18,194,22,4,16,142,20,210,15,206,20,48,15,206,20,54,19,10,21,140,16,100,
+20,162,16,100,20,162,15,104,19,178,15,104,19,184,15,110,19,190,15,110,19,
+190,15,98,19,178,15,98,19,184,15,116,19,178,15,116,19,184,15,128,19,208,15,
+206,20,36,15,206,20,42,15,128,19,208,15,128,19,202,15,128,19,202,15,182,20,
+12,15,188,20,18,15,134,19,214,15,212,20,24,15,218,20,30,15,134,19,214,15,
+140,19,214,15,224,20,24,15,230,20,30,15,140,19,214,15,146,19,214,15,242,20,
+24,15,248,20,30,15,146,19,214,18,224,21,140,18,230,22,28,16,118,20,168,16,
+118,20,168,16,100,20,162,16,118,20,174,16,118,20,174,16,100,20,162,15,212,
+20,162,16,124,20,180,16,124,20,180,15,212,20,162,16,148,20,210,16,148,20,
+210,16,154,20,210,16,154,20,210,15,218,20,240,16,196,20,240,15,248,20,240,
+16,202,20,240,16,178,20,240,16,184,20,240,16,250,21,32,17,18,21,56,17,18,
+21,56,16,250,21,32,17,36,21,74,17,60,19,214,17,60,19,214,17,36,21,74,17,84,
+19,214,17,96,21,98,17,96,21,98,17,90,19,214,17,108,21,104,17,162,20,180,17,
+168,20,180,17,114,21,104,18,74,20,180,18,74,20,180,17,186,21,116,17,174,21,
+140,17,240,21,140,17,186,21,116,17,246,21,140,17,246,21,140,17,192,21,122,
+17,198,21,122,15,236,20,48,15,236,20,54,18,188,22,4,18,188,22,4,18,236,21,
+140,19,4,21,140,19,4,22,28,19,4,22,46,19,4,22,46,15,206,20,48,15,206,20,54,
+15,182,20,60,15,188,20,66,19,64,22,64,19,64,22,64,19,64,22,58,15,182,20,60,
+15,188,20,66,19,64,22,58,19,112,22,88,19,118,22,88,19,70,22,58,15,194,20,
+24,15,200,20,30,19,76,22,58,19,4,21,140,19,16,21,140,18,236,21,140,18,224,
+21,140,15,170,21,140,18,254,22,28,18,248,21,140,18,248,21,140,15,104,19,178,
+15,104,19,184,15,110,19,196,15,110,19,196,15,122,19,178,15,122,19,184,19,
+40,22,46,19,40,22,46,15,110,22,46,15,110,22,46,19,82,22,58,19,88,22,58,15,
+152,19,214,15,152,19,214,15,254,20,24,16,4,20,30,15,128,19,220,15,128,19,
+220,15,206,20,72,15,206,20,72,15,134,19,226,15,134,19,226,15,212,20,78,15,
+218,20,84,15,134,19,214,15,134,19,214,16,10,20,24,16,16,20,30,15,158,19,214,
+15,158,19,214,16,22,20,24,16,28,20,30,15,128,19,232,15,128,19,232,15,182,
+20,90,16,34,20,96,16,82,20,162,16,82,20,162,16,130,20,180,16,130,20,180,16,
+106,20,162,16,106,20,162,16,136,20,180,16,136,20,180,16,100,20,162,16,100,
+20,162,16,118,20,174,16,118,20,174,16,100,20,162,16,100,20,162,16,118,20,
+186,16,118,20,186,15,224,20,162,15,224,20,162,15,224,20,180,15,224,20,180,
+16,100,20,162,16,100,20,162,16,118,20,192,16,118,20,192,16,142,20,216,16,
+142,20,216,16,142,20,222,16,142,20,222,16,154,20,222,16,154,20,222,16,160,
+20,210,16,160,20,210,16,142,20,222,16,142,20,222,16,166,20,210,16,166,20,
+210,16,166,20,210,16,166,20,210,16,166,20,210,16,166,20,210,16,82,20,240,
+16,208,20,240,16,190,20,246,16,190,20,252,16,190,21,2,16,190,21,8,16,190,
+21,14,16,190,21,20,16,190,21,2,16,190,21,8,15,218,20,240,16,196,20,240,16,
+214,20,240,16,220,20,240,17,0,21,38,17,0,21,38,17,24,21,62,17,24,21,62,16,
+244,21,44,16,244,21,44,17,12,21,68,17,12,21,68,17,6,21,44,17,6,21,44,17,18,
+21,68,17,18,21,68,17,30,21,80,17,30,21,80,17,54,20,0,17,54,20,0,17,42,21,
+74,17,42,21,74,17,66,19,214,17,66,19,214,17,18,19,214,17,18,19,214,17,120,
+21,104,17,120,21,104,17,144,20,180,17,120,20,180,17,210,21,116,17,210,21,
+128,17,210,21,128,17,252,21,146,17,252,21,146,17,186,21,128,17,186,21,128,
+17,174,21,146,17,240,21,146,17,216,21,116,18,2,21,140,18,2,21,140,17,210,
+21,134,17,210,21,134,17,252,21,152,17,252,21,152,17,222,21,116,17,222,21,
+116,18,8,21,140,18,8,21,140,17,228,21,122,17,228,21,122,17,234,21,122,17,
+234,21,122,18,116,21,200,18,116,21,200,18,122,21,206,18,122,21,206,18,14,
+19,214,18,14,19,214,18,74,20,180,18,74,20,180,18,26,19,214,18,26,19,214,16,
+154,20,180,16,154,20,180,18,32,19,214,18,32,19,214,18,86,20,180,18,86,20,
+180,18,20,21,158,18,20,21,158,18,74,21,176,18,74,20,168,18,38,19,214,18,38,
+19,214,18,80,20,180,18,80,20,180,18,44,19,214,18,44,19,214,18,92,20,180,18,
+92,20,180,18,38,19,208,18,38,19,208,18,80,21,182,18,80,21,182,18,38,21,164,
+18,38,21,164,18,80,21,188,18,80,21,194,18,50,19,214,18,50,19,214,18,98,20,
+180,18,98,20,180,18,128,21,212,18,128,21,212,18,140,21,224,18,146,20,24,18,
+128,21,212,18,128,21,212,18,152,21,224,18,152,20,24,18,128,21,212,18,128,
+21,212,18,158,21,224,18,164,20,24,18,128,21,218,18,128,21,218,18,134,20,12,
+18,134,21,230,18,188,22,10,18,188,22,10,15,236,20,36,15,236,20,36,18,200,
+22,4,18,200,22,4,18,188,22,16,18,188,22,16,15,236,20,102,15,236,20,108,18,
+206,22,4,18,206,22,4,16,112,20,162,16,112,20,162,15,212,20,198,15,212,20,
+198,18,182,22,52,18,182,22,52,18,182,22,52,19,64,22,70,19,64,22,70,17,48,
+21,86,17,48,21,86,17,60,21,92,17,60,21,92,17,126,21,104,17,132,21,104,17,
+162,21,110,17,168,21,110,18,170,21,242,18,56,19,214,18,56,19,214,16,172,20,
+210,16,172,20,210,16,226,20,240,16,232,20,240,23,108,22,28,19,34,21,140,18,
+68,21,140,18,68,21,140,15,164,19,238,15,164,19,238,16,52,20,114,16,58,20,
+120,15,140,19,244,15,140,19,244,16,10,20,126,16,16,20,132,15,128,19,250,15,
+128,19,250,15,182,20,138,16,34,20,144,15,134,19,250,15,134,19,250,15,212,
+20,138,16,64,20,144,15,170,20,0,15,170,20,0,15,212,20,60,16,70,20,132,15,
+128,20,6,15,128,20,6,15,182,20,150,15,188,20,156,15,176,19,214,15,176,19,
+214,16,76,20,24,16,82,20,30,16,112,20,162,16,112,20,162,16,112,20,180,16,
+112,20,180,16,100,20,162,16,100,20,162,16,118,20,204,16,118,20,204,16,154,
+20,228,16,154,20,228,16,142,20,234,16,142,20,234,16,190,21,26,16,190,21,26,
+17,6,21,32,17,6,21,32,17,18,21,56,17,18,21,56,17,138,21,104,17,138,21,104,
+17,174,20,180,17,174,20,180,17,144,21,104,17,144,21,104,17,144,20,180,17,
+120,20,180,17,150,21,104,17,150,21,104,17,180,20,180,17,180,20,180,17,210,
+21,128,17,210,21,128,17,252,21,146,17,252,21,146,17,210,21,134,17,210,21,
+134,17,252,21,152,17,252,21,152,18,62,19,214,18,62,19,214,18,104,20,180,18,
+104,20,180,18,68,19,214,18,68,19,214,18,110,20,180,18,110,20,180,18,14,21,
+170,18,14,21,170,18,74,20,198,18,74,20,198,18,176,21,236,18,176,21,236,16,
+112,19,172,16,112,19,172,18,170,21,248,18,170,21,248,18,182,21,254,18,182,
+21,254,18,188,22,22,18,188,22,22,15,212,20,60,16,64,20,132,18,212,22,4,18,
+212,22,4,16,88,20,24,16,88,20,54,18,218,22,4,18,218,22,4,16,94,20,24,16,94,
+20,54,18,128,21,212,18,128,21,212,18,134,21,224,18,134,20,24,16,214,20,240,
+16,214,20,240,16,238,20,240,15,194,20,240,17,6,21,32,17,6,21,32,17,18,21,
+56,17,18,21,56,17,216,21,116,18,182,22,52,17,120,22,46,17,120,22,46,19,46,
+22,46,19,46,22,46,19,52,22,46,19,52,22,46,17,120,22,46,17,120,22,46,19,58,
+22,46,19,58,22,46,17,120,22,46,17,120,22,46,17,108,22,46,17,108,22,46,16,
+40,20,60,16,46,20,66,19,94,22,58,17,102,22,58,19,64,22,76,19,64,22,76,15,
+182,23,210,16,34,23,216,19,64,22,82,19,64,22,82,17,6,21,50,17,6,21,50,17,
+18,21,62,17,18,21,62,18,242,21,140,23,252,21,98,23,252,21,98,0,2,0,8,0,98,
+0,111,0,0,0,113,0,113,0,14,1,9,1,22,0,15,1,240,1,251,0,29,1,254,2,2,0,41,
+2,35,2,41,0,46,2,54,2,59,0,53,2,223,2,223,0,59,0,2,0,18,0,4,0,49,0,0,0,52,
+0,56,0,46,0,58,0,60,0,51,0,78,0,90,0,54,0,112,0,112,0,67,0,114,0,115,0,68,
+0,118,0,120,0,70,0,125,0,196,0,73,0,201,0,229,0,145,0,239,0,246,0,174,1,23,
+1,239,0,182,2,3,2,10,1,143,2,12,2,14,1,151,2,42,2,49,1,154,2,60,2,169,1,162,
+2,188,2,213,2,16,2,215,2,218,2,42,2,242,2,244,2,46,0,1,2,96,2,148,0,2,0,12,
+0,254,0,60,0,0,5,98,0,1,10,12,0,0,5,98,0,0,5,98,0,0,5,98,0,1,10,12,0,0,5,
+104,0,0,5,110,0,0,5,128,0,0,5,128,0,1,10,18,0,0,5,134,0,1,10,42,0,0,13,240,
+0,0,5,128,0,0,5,104,0,0,5,116,0,0,5,104,0,0,5,104,0,0,5,104,0,0,5,122,0,0,
+5,104,0,0,5,128,0,0,5,128,0,0,5,128,0,0,5,128,0,0,5,128,0,1,10,18,0,1,10,
+18,0,0,5,140,0,0,5,146,0,0,5,152,0,0,5,158,0,0,5,146,0,0,5,152,0,0,5,164,
+0,0,5,140,0,0,5,152,0,0,5,140,0,1,10,24,0,0,5,176,0,0,5,182,0,0,5,158,0,1,
+10,30,0,0,5,188,0,1,10,36,0,0,5,194,0,0,5,200,0,0,5,206,0,0,5,206,0,0,5,212,
+0,0,5,206,0,0,5,206,0,0,5,206,0,0,5,188,0,0,5,218,0,1,10,48,0,0,5,224,0,0,
+5,218,0,0,5,170,0,28,0,58,0,68,0,78,0,88,0,98,0,108,0,118,0,128,0,138,0,148,
+0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,228,0,238,0,248,1,2,1,12,1,22,
+1,32,1,42,1,60,1,78,1,88,0,2,11,194,11,224,11,200,11,230,0,2,11,184,11,214,
+11,190,11,220,0,2,11,174,11,204,7,184,11,210,0,2,11,164,11,194,7,174,11,200,
+0,2,11,154,11,184,11,160,11,196,0,2,11,144,11,174,11,150,11,186,0,2,11,134,
+11,164,5,26,11,170,0,2,11,124,11,154,5,16,11,160,0,2,11,114,11,144,12,236,
+11,150,0,2,11,104,11,134,12,226,11,140,0,2,11,94,11,124,12,222,11,130,0,2,
+11,84,11,114,12,212,11,120,0,2,11,74,11,104,11,80,12,208,0,2,11,64,11,94,
+11,70,12,198,0,2,12,194,11,84,12,200,11,90,0,2,12,184,11,74,12,190,11,80,
+0,2,11,46,11,64,11,40,11,70,0,2,11,36,11,54,11,30,11,60,0,2,11,32,11,44,11,
+20,11,50,0,2,11,22,11,34,11,10,11,40,0,2,11,18,11,24,11,0,11,30,0,2,11,8,
+11,14,10,246,11,20,0,2,10,230,11,22,10,236,11,28,0,2,10,220,11,12,10,226,
+11,18,0,4,11,224,11,230,11,236,11,242,11,248,11,254,12,4,12,10,0,4,11,254,
+12,4,12,10,12,16,12,22,12,28,5,194,12,34,0,2,10,174,10,204,10,180,10,210,
+0,2,10,164,10,194,10,170,10,200,0,2,0,8,0,98,0,111,0,0,0,113,0,113,0,14,1,
+9,1,22,0,15,1,240,1,251,0,29,1,254,2,2,0,41,2,35,2,41,0,46,2,54,2,59,0,53,
+2,223,2,223,0,59,0,2,0,5,0,50,0,51,0,0,0,230,0,237,0,2,2,15,2,28,0,10,2,50,
+2,51,0,24,2,219,2,220,0,26,0,1,1,60,1,154,0,1,0,12,0,214,0,50,0,0,2,172,0,
+0,2,172,0,0,2,172,0,0,2,172,0,0,2,178,0,0,2,184,0,0,2,202,0,0,2,202,0,0,2,
+208,0,0,11,58,0,0,2,202,0,0,2,178,0,0,2,190,0,0,2,178,0,0,2,178,0,0,2,178,
+0,0,2,196,0,0,2,178,0,0,2,202,0,0,2,202,0,0,2,202,0,0,2,202,0,0,2,202,0,0,
+2,214,0,0,2,220,0,0,2,226,0,0,2,232,0,0,2,220,0,0,2,226,0,0,2,238,0,0,2,214,
+0,0,2,226,0,0,2,214,0,0,2,250,0,0,3,0,0,0,2,232,0,0,3,6,0,0,3,12,0,0,3,18,
+0,0,3,24,0,0,3,24,0,0,3,30,0,0,3,24,0,0,3,24,0,0,3,24,0,0,3,6,0,0,3,36,0,
+0,3,42,0,0,3,36,0,0,2,244,0,50,9,170,9,176,9,170,9,170,9,170,9,182,9,218,
+9,224,9,200,10,214,9,212,9,194,9,200,9,188,9,206,9,194,9,170,9,194,10,46,
+10,40,10,52,10,52,10,52,9,176,9,176,9,230,9,236,9,242,2,84,9,248,9,254,9,
+230,10,4,10,10,10,16,10,22,10,10,10,28,10,28,9,176,10,28,10,34,10,4,2,6,1,
+226,1,226,1,226,9,242,9,236,2,84,0,2,0,15,0,98,0,98,0,0,0,100,0,102,0,1,0,
+104,0,107,0,4,0,109,0,109,0,8,0,111,0,111,0,9,0,113,0,113,0,10,1,9,1,20,0,
+11,1,240,1,249,0,23,1,251,1,251,0,33,1,254,1,255,0,34,2,1,2,1,0,36,2,35,2,
+41,0,37,2,54,2,56,0,44,2,58,2,59,0,47,2,223,2,223,0,49,0,2,0,15,0,98,0,98,
+0,0,0,100,0,102,0,1,0,104,0,107,0,4,0,109,0,109,0,8,0,111,0,111,0,9,0,113,
+0,113,0,10,1,9,1,20,0,11,1,240,1,249,0,23,1,251,1,251,0,33,1,254,1,255,0,
+34,2,1,2,1,0,36,2,35,2,41,0,37,2,54,2,56,0,44,2,58,2,59,0,47,2,223,2,223,
+0,49,0,1,0,76,0,134,0,1,0,12,0,54,0,10,0,0,5,94,0,0,5,94,0,0,5,100,0,0,5,
+124,0,0,5,100,0,0,5,100,0,0,5,106,0,0,5,112,0,0,5,118,0,0,5,130,0,10,8,226,
+8,232,8,238,9,6,9,18,9,6,8,244,8,250,9,0,9,12,0,2,0,9,0,99,0,99,0,0,0,103,
+0,103,0,1,0,108,0,108,0,2,0,110,0,110,0,3,1,21,1,22,0,4,1,250,1,250,0,6,2,
+0,2,0,0,7,2,2,2,2,0,8,2,57,2,57,0,9,0,2,0,9,0,99,0,99,0,0,0,103,0,103,0,1,
+0,108,0,108,0,2,0,110,0,110,0,3,1,21,1,22,0,4,1,250,1,250,0,6,2,0,2,0,0,7,
+2,2,2,2,0,8,2,57,2,57,0,9,0,1,0,0,6,64,0,1,0,0,6,114,0,1,0,0,6,124,0,1,0,
+160,4,146,0,1,0,120,5,100,0,1,0,0,6,24,0,1,0,0,6,104,0,1,0,0,3,232,0,1,0,
+40,3,232,0,1,0,0,3,212,0,1,0,30,3,212,0,1,0,80,3,232,0,1,0,0,4,76,0,1,0,0,
+4,136,0,1,255,226,3,212,0,1,0,0,3,252,0,1,255,236,6,4,0,1,0,0,6,4,0,1,0,0,
+5,0,0,1,0,0,5,180,0,1,0,0,4,56,0,1,0,0,4,176,0,1,1,254,3,232,0,1,1,44,7,108,
+0,1,1,4,8,12,0,1,1,44,6,144,0,1,1,44,7,188,0,1,1,44,6,44,0,1,3,32,3,232,0,
+1,3,12,5,80,0,1,3,12,6,44,0,1,2,188,6,24,0,1,3,12,5,220,0,1,3,12,5,180,0,
+1,3,172,3,232,0,1,3,32,5,80,0,1,3,12,5,120,0,1,1,174,4,76,0,1,1,124,4,76,
+0,1,1,104,6,104,0,1,1,64,6,104,0,1,1,44,4,76,0,1,1,204,5,240,0,1,1,144,5,
+240,0,1,1,204,6,224,0,1,1,154,6,224,0,1,1,104,5,240,0,1,1,114,6,224,0,1,1,
+44,6,224,0,1,1,84,7,68,0,1,1,154,7,68,0,1,1,204,6,244,0,1,1,154,6,244,0,1,
+1,204,7,88,0,1,1,144,7,88,0,1,1,104,4,76,0,1,1,214,7,8,0,1,1,144,7,8,0,1,
+3,32,4,76,0,1,2,168,4,76,0,1,1,154,5,240,0,1,1,164,5,240,0,1,1,214,6,164,
+0,1,1,144,6,164,0,1,0,240,8,52,0,1,1,84,8,52,0,1,1,144,4,136,0,1,1,164,7,
+88,0,1,2,8,5,240,0,1,1,164,4,156,0,1,1,224,5,240,0,1,1,164,6,164,0,1,1,174,
+7,88,0,1,1,94,4,176,0,1,1,104,6,124,0,1,1,44,7,68,0,1,1,104,6,144,0,1,1,104,
+7,88,0,1,1,104,6,244,0,1,1,144,6,224,0,1,1,184,6,224,0,1,1,104,4,96,0,1,1,
+174,5,240,0,1,1,84,6,224,0,1,1,174,6,164,0,1,1,144,7,68,0,1,1,174,7,68,0,
+1,1,124,6,144,0,1,1,164,6,144,0,1,1,44,6,104,0,1,6,144,3,232,0,1,6,164,7,
+8,0,1,6,174,5,240,0,1,6,174,7,8,0,1,3,132,3,232,0,1,3,192,7,8,0,1,3,192,5,
+240,0,1,6,164,4,176,0,1,6,184,5,240,0,1,6,184,7,8,0,1,6,164,5,240,0,1,3,92,
+4,176,0,1,3,142,5,240,0,1,3,242,7,8,0,1,3,92,5,220,0,1,3,32,5,220,0,1,3,172,
+5,220,0,1,3,132,5,220,0,1,3,142,5,220,0,1,2,88,4,176,0,1,2,88,5,240,0,1,2,
+88,6,24,0,1,2,88,7,8,0,1,2,148,5,240,0,1,2,148,6,24,0,1,2,128,5,240,0,1,2,
+128,7,8,0,1,2,108,7,68,0,1,2,48,4,176,0,1,2,68,5,240,0,1,2,68,6,64,0,1,2,
+108,5,240,0,1,2,108,7,88,0,1,5,220,5,240,0,1,4,236,5,240,0,1,5,30,5,240,0,
+1,4,176,4,136,0,1,5,220,4,136,0,1,5,240,6,224,0,1,5,190,7,68,0,1,4,216,5,
+240,0,1,4,236,6,224,0,1,2,138,5,240,0,1,2,168,5,240,0,1,2,88,4,136,0,1,2,
+128,6,224,0,1,2,148,7,68,0,1,2,188,5,220,0,1,2,188,4,76,0,1,3,2,6,64,0,1,
+3,2,6,224,0,1,2,188,6,244,0,1,2,188,7,208,0,1,2,228,8,102,0,1,3,12,7,108,
+0,1,2,188,6,224,0,1,2,248,7,168,0,1,1,4,6,14,0,1,1,4,7,8,0,1,1,4,7,108,0,
+1,1,4,7,248,0,1,1,4,8,152,0,1,0,220,6,224,0,1,1,4,7,168,0,1,3,172,5,120,0,
+1,2,188,5,120,0,1,1,244,5,220,0,1,1,64,6,164,0,1,1,64,8,132,0,1,1,94,8,132,
+0,1,1,84,7,208,0,1,1,64,8,112,0,1,1,84,8,112,0,1,2,188,4,136,0,1,2,188,5,
+240,0,1,2,48,4,136,0,1,2,148,5,80,0,1,2,88,4,76,0,1,2,48,5,220,0,1,2,88,5,
+80,0,1,2,68,7,208,0,1,2,148,7,108,0,1,2,68,6,24,0,1,2,218,6,164,0,1,2,28,
+4,136,0,1,2,88,4,236,0,1,2,188,5,180,0,1,2,248,5,180,0,1,1,224,6,144,0,1,
+2,188,3,192,0,1,3,52,5,180,0,1,1,4,4,136,0,1,2,28,2,88,0,1,3,62,7,168,0,1,
+1,104,4,136,0,1,1,244,6,144,0,1,2,48,6,144,0,1,2,168,6,44,0,1,1,204,2,148,
+0,1,1,164,4,76,0,1,2,8,4,76,0,1,4,226,6,94,0,1,4,136,5,80,0,1,2,18,4,176,
+0,1,2,88,3,32,0,1,1,244,1,124,0,1,1,84,3,152,0,1,1,144,3,32,0,1,0,180,3,32,
+0,1,0,0,255,6,0,1,0,0,255,136,0,1,0,60,0,40,0,1,0,0,254,192,0,1,0,0,255,156,
+0,1,0,0,254,112,0,1,0,0,0,180,0,1,2,8,255,96,0,1,1,44,255,116,0,1,1,144,255,
+116,0,1,1,64,253,168,0,1,1,24,253,168,0,1,3,92,252,244,0,1,3,92,254,12,0,
+1,3,32,255,96,0,1,3,72,252,184,0,1,3,72,254,132,0,1,3,12,252,184,0,1,3,252,
+253,228,0,1,3,12,254,12,0,1,3,32,253,8,0,1,3,72,254,12,0,1,3,72,253,148,0,
+1,1,44,252,244,0,1,1,174,252,244,0,1,1,44,255,96,0,1,1,144,255,96,0,1,1,74,
+254,12,0,1,1,84,254,12,0,1,1,4,255,96,0,1,1,84,255,96,0,1,1,44,254,12,0,1,
+1,164,254,12,0,1,1,84,252,164,0,1,1,44,254,112,0,1,1,174,254,112,0,1,1,44,
+252,204,0,1,1,164,252,204,0,1,1,4,254,112,0,1,1,104,254,112,0,1,2,28,254,
+12,0,1,2,148,254,12,0,1,1,204,254,12,0,1,1,144,254,12,0,1,1,84,253,8,0,1,
+1,144,253,8,0,1,1,24,253,108,0,1,1,144,253,108,0,1,1,144,253,18,0,1,1,244,
+253,8,0,1,1,244,253,248,0,1,1,244,255,96,0,1,1,224,252,124,0,1,1,224,252,
+164,0,1,1,224,253,8,0,1,1,204,253,8,0,1,1,194,255,96,0,1,1,244,254,72,0,1,
+2,8,253,248,0,1,1,244,252,164,0,1,1,244,253,128,0,1,0,200,253,168,0,1,0,40,
+253,28,0,1,0,80,253,28,0,1,1,24,252,84,0,1,1,64,252,84,0,1,0,240,251,120,
+0,1,1,44,251,120,0,1,0,200,253,28,0,1,6,144,255,16,0,1,6,174,254,12,0,1,6,
+174,252,224,0,1,6,194,254,12,0,1,3,152,255,96,0,1,3,192,254,12,0,1,3,192,
+252,224,0,1,6,124,255,96,0,1,6,144,254,12,0,1,6,184,253,148,0,1,3,172,253,
+148,0,1,2,228,255,96,0,1,1,144,252,244,0,1,2,68,254,12,0,1,5,220,255,96,0,
+1,3,132,253,128,0,1,6,4,254,12,0,1,5,220,253,8,0,1,2,88,255,96,0,1,2,148,
+253,248,0,1,2,128,253,8,0,1,3,32,252,224,0,1,3,92,252,124,0,1,3,72,253,28,
+0,1,1,254,253,8,0,1,1,244,254,12,0,1,1,254,252,164,0,1,2,8,252,164,0,1,4,
+176,255,96,0,1,3,132,255,96,0,1,2,188,253,108,0,1,0,160,253,108,0,1,0,230,
+255,96,0,1,1,94,252,244,0,1,2,228,255,56,0,1,2,208,253,88,0,1,2,208,254,12,
+0,1,2,8,254,12,0,1,2,148,253,108,0,1,2,148,252,24,0,1,2,148,252,124,0,1,2,
+188,252,124,0,1,2,188,255,96,0,1,1,44,253,228,0,1,2,168,253,128,0,1,1,244,
+253,168,0,1,1,244,253,68,0,1,3,32,253,108,0,1,3,32,252,64,0,1,4,76,253,108,
+0,1,1,164,253,108,0,1,1,44,253,108,0,1,3,32,253,168,0,1,0,180,255,96,0,1,
+4,36,6,164,0,1,1,44,5,180,0,1,4,56,8,212,0,1,4,76,7,208,0,1,4,76,8,52,0,1,
+4,136,255,96,0,1,1,204,255,96,0,1,2,188,253,68,0,1,2,148,252,244,0,1,0,40,
+255,96,0,1,0,0,8,92,0,1,0,0,7,108,0,1,0,0,8,132,0,1,255,146,10,80,0,1,0,0,
+10,120,0,1,0,0,8,112,0,1,255,176,9,156,0,1,0,0,7,188,0,1,0,0,7,88,0,1,0,0,
+7,248,0,1,0,0,5,220,0,1,0,0,6,164,0,1,0,0,7,8,0,1,0,80,6,144,0,1,0,0,5,80,
+0,1,0,0,6,204,0,1,0,0,5,120,0,1,0,0,5,240,0,1,0,0,6,224,0,1,0,0,7,148,0,1,
+0,0,6,244,0,1,0,0,8,252,0,1,0,0,10,0,0,1,0,0,10,20,0,1,0,0,252,214,0,1,0,
+0,253,188,0,1,0,0,253,168,0,1,0,0,253,228,0,1,0,0,253,68,0,1,0,0,252,244,
+0,1,0,0,252,144,0,1,0,0,255,56,0,1,0,0,251,180,0,1,255,226,4,166,0,1,3,132,
+7,168,0,1,11,104,6,164,0,1,11,104,255,96,0,1,8,212,5,120,0,1,8,192,255,96,
+0,1,6,24,8,212,0,1,6,24,255,96,0,1,2,128,5,20,0,1,2,168,255,96,0,1,11,134,
+4,136,0,1,11,44,253,148,0,1,8,234,4,136,0,1,8,242,253,228,0,1,6,78,6,184,
+0,1,6,164,254,12,0,1,2,148,253,88,0,1,255,206,7,8,0,1,1,204,252,124,0,1,1,
+144,252,124,0,1,1,44,7,8,0,1,0,200,7,108,0,1,2,168,253,68,0,1,4,96,7,8,0,
+1,2,48,7,48,0,1,3,172,7,8,0,1,0,0,0,10,0,90,1,70,0,1,97,114,97,98,0,8,0,16,
+0,2,70,65,82,32,0,34,85,82,68,32,0,52,0,0,255,255,0,6,0,0,0,6,0,13,0,16,0,
+9,0,3,0,0,255,255,0,6,0,1,0,7,0,14,0,17,0,10,0,4,0,0,255,255,0,7,0,2,0,8,
+0,12,0,15,0,18,0,11,0,5,0,19,99,99,109,112,0,116,99,99,109,112,0,122,99,99,
+109,112,0,128,102,105,110,97,0,134,102,105,110,97,0,140,102,105,110,97,0,
+146,105,110,105,116,0,152,105,110,105,116,0,158,105,110,105,116,0,164,108,
+105,103,97,0,170,108,105,103,97,0,178,108,105,103,97,0,186,108,111,99,108,
+0,194,109,101,100,105,0,200,109,101,100,105,0,206,109,101,100,105,0,212,114,
+108,105,103,0,218,114,108,105,103,0,224,114,108,105,103,0,230,0,0,0,1,0,0,
+0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,1,0,3,0,
+0,0,1,0,3,0,0,0,1,0,3,0,0,0,2,0,6,0,7,0,0,0,2,0,6,0,7,0,0,0,2,0,6,0,7,0,0,
+0,1,0,1,0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,5,0,0,0,1,0,5,0,0,0,
+1,0,5,0,8,0,18,0,26,0,34,0,42,0,50,0,58,0,66,0,74,0,4,0,1,0,1,0,64,0,1,0,
+1,0,1,1,90,0,1,0,9,0,1,1,116,0,1,0,9,0,1,6,186,0,1,0,9,0,1,10,78,0,4,0,9,
+0,1,13,226,0,4,0,1,0,1,15,8,0,4,0,9,0,1,15,40,0,1,1,18,0,11,0,28,0,46,0,64,
+0,82,0,100,0,118,0,136,0,194,0,204,0,246,1,8,0,2,0,6,0,12,1,11,0,2,0,104,
+1,16,0,2,0,107,0,2,0,6,0,12,1,10,0,2,0,104,1,21,0,2,0,108,0,2,0,6,0,12,1,
+12,0,2,0,104,1,17,0,2,0,107,0,2,0,6,0,12,1,13,0,2,0,104,1,19,0,2,0,107,0,
+2,0,6,0,12,1,9,0,2,0,104,1,18,0,2,0,107,0,2,0,6,0,12,1,14,0,2,0,104,1,22,
+0,2,0,108,0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,1,12,0,2,0,100,1,11,0,2,
+0,98,1,15,0,2,0,109,1,13,0,2,0,101,1,9,0,2,0,102,1,14,0,2,0,103,1,10,0,2,
+0,99,0,1,0,4,1,20,0,2,0,107,0,5,0,12,0,18,0,24,0,30,0,36,1,17,0,2,0,100,1,
+16,0,2,0,98,1,19,0,2,0,101,1,18,0,2,0,102,1,20,0,2,0,105,0,2,0,6,0,12,1,22,
+0,2,0,103,1,21,0,2,0,99,0,1,0,4,1,15,0,2,0,104,0,2,0,2,0,98,0,105,0,0,0,107,
+0,109,0,8,0,2,0,12,0,3,0,255,0,254,0,71,0,2,0,3,0,72,0,72,0,0,0,75,0,75,0,
+1,0,77,0,77,0,2,0,2,1,96,0,173,0,6,0,10,0,112,0,13,0,17,0,21,0,25,0,29,0,
+33,0,37,0,41,0,45,0,47,0,49,0,54,0,60,0,244,0,82,0,84,0,88,0,90,0,120,0,126,
+0,128,0,130,0,132,0,136,0,138,0,144,0,148,0,152,0,154,0,160,0,164,0,166,0,
+168,0,170,0,172,0,174,0,178,0,182,0,186,0,190,0,196,0,204,0,208,0,45,0,211,
+0,213,0,219,0,223,0,225,0,229,0,240,0,118,0,243,1,24,1,26,1,28,1,30,1,32,
+1,34,1,36,1,40,1,44,1,48,1,52,1,56,1,60,1,64,1,68,1,72,1,76,1,80,1,84,1,86,
+1,88,1,90,1,92,1,94,1,96,1,98,1,100,1,102,1,104,1,106,1,108,1,110,1,112,1,
+114,1,118,1,122,1,126,1,130,1,134,1,136,0,58,1,141,1,145,1,152,1,156,1,160,
+1,162,1,164,1,168,1,172,1,176,1,180,1,184,1,188,1,192,1,196,1,200,1,204,1,
+208,1,212,1,216,1,220,1,224,1,226,1,230,1,232,1,236,2,189,1,239,2,4,2,8,2,
+14,2,43,2,45,2,47,2,61,2,65,2,69,2,73,2,77,2,81,2,85,2,89,2,93,2,97,2,99,
+2,101,2,103,2,107,2,111,2,115,2,119,2,123,2,127,2,131,2,135,2,139,2,143,2,
+147,2,151,2,155,2,159,2,163,2,165,2,167,1,148,2,191,2,193,2,195,2,197,2,199,
+2,201,2,203,2,207,2,209,2,213,2,216,0,2,0,167,0,5,0,5,0,0,0,7,0,7,0,1,0,11,
+0,12,0,2,0,14,0,14,0,4,0,18,0,18,0,5,0,22,0,22,0,6,0,26,0,26,0,7,0,32,0,32,
+0,8,0,34,0,34,0,9,0,38,0,38,0,10,0,42,0,42,0,11,0,46,0,46,0,12,0,48,0,48,
+0,13,0,53,0,53,0,14,0,59,0,59,0,15,0,80,0,81,0,16,0,83,0,83,0,18,0,85,0,85,
+0,19,0,89,0,89,0,20,0,119,0,119,0,21,0,125,0,125,0,22,0,127,0,127,0,23,0,
+129,0,129,0,24,0,131,0,131,0,25,0,133,0,133,0,26,0,137,0,137,0,27,0,141,0,
+141,0,28,0,145,0,145,0,29,0,149,0,149,0,30,0,153,0,153,0,31,0,157,0,157,0,
+32,0,161,0,161,0,33,0,165,0,165,0,34,0,167,0,167,0,35,0,169,0,169,0,36,0,
+171,0,171,0,37,0,173,0,173,0,38,0,175,0,175,0,39,0,179,0,179,0,40,0,183,0,
+183,0,41,0,187,0,187,0,42,0,193,0,193,0,43,0,203,0,203,0,44,0,207,0,207,0,
+45,0,209,0,210,0,46,0,212,0,212,0,48,0,218,0,218,0,49,0,220,0,220,0,50,0,
+224,0,224,0,51,0,226,0,226,0,52,0,239,0,239,0,53,0,241,0,242,0,54,1,23,1,
+23,0,56,1,25,1,25,0,57,1,27,1,27,0,58,1,29,1,29,0,59,1,31,1,31,0,60,1,33,
+1,33,0,61,1,35,1,35,0,62,1,39,1,39,0,63,1,43,1,43,0,64,1,47,1,47,0,65,1,51,
+1,51,0,66,1,55,1,55,0,67,1,59,1,59,0,68,1,63,1,63,0,69,1,67,1,67,0,70,1,71,
+1,71,0,71,1,75,1,75,0,72,1,79,1,79,0,73,1,83,1,83,0,74,1,85,1,85,0,75,1,87,
+1,87,0,76,1,89,1,89,0,77,1,91,1,91,0,78,1,93,1,93,0,79,1,95,1,95,0,80,1,97,
+1,97,0,81,1,99,1,99,0,82,1,101,1,101,0,83,1,103,1,103,0,84,1,105,1,105,0,
+85,1,107,1,107,0,86,1,109,1,109,0,87,1,111,1,111,0,88,1,113,1,113,0,89,1,
+117,1,117,0,90,1,121,1,121,0,91,1,125,1,125,0,92,1,129,1,129,0,93,1,133,1,
+133,0,94,1,135,1,135,0,95,1,139,1,140,0,96,1,144,1,144,0,98,1,151,1,151,0,
+99,1,155,1,155,0,100,1,159,1,159,0,101,1,161,1,161,0,102,1,163,1,163,0,103,
+1,167,1,167,0,104,1,171,1,171,0,105,1,175,1,175,0,106,1,179,1,179,0,107,1,
+183,1,183,0,108,1,187,1,187,0,109,1,191,1,191,0,110,1,195,1,195,0,111,1,199,
+1,199,0,112,1,203,1,203,0,113,1,207,1,207,0,114,1,211,1,211,0,115,1,215,1,
+215,0,116,1,219,1,219,0,117,1,223,1,223,0,118,1,225,1,225,0,119,1,229,1,229,
+0,120,1,231,1,231,0,121,1,235,1,235,0,122,1,237,1,238,0,123,2,3,2,3,0,125,
+2,7,2,7,0,126,2,13,2,13,0,127,2,42,2,42,0,128,2,44,2,44,0,129,2,46,2,46,0,
+130,2,60,2,60,0,131,2,64,2,64,0,132,2,68,2,68,0,133,2,72,2,72,0,134,2,76,
+2,76,0,135,2,80,2,80,0,136,2,84,2,84,0,137,2,88,2,88,0,138,2,92,2,92,0,139,
+2,96,2,96,0,140,2,98,2,98,0,141,2,100,2,100,0,142,2,102,2,102,0,143,2,106,
+2,106,0,144,2,110,2,110,0,145,2,114,2,114,0,146,2,118,2,118,0,147,2,122,2,
+122,0,148,2,126,2,126,0,149,2,130,2,130,0,150,2,134,2,134,0,151,2,138,2,138,
+0,152,2,142,2,142,0,153,2,146,2,146,0,154,2,150,2,150,0,155,2,154,2,154,0,
+156,2,158,2,158,0,157,2,162,2,162,0,158,2,164,2,164,0,159,2,166,2,166,0,160,
+2,188,2,188,0,161,2,190,2,190,0,162,2,192,2,192,0,163,2,194,2,194,0,164,2,
+196,2,196,0,165,2,198,2,198,0,166,2,200,2,200,0,167,2,202,2,202,0,168,2,206,
+2,206,0,169,2,208,2,208,0,170,2,212,2,212,0,171,2,215,2,215,0,172,0,2,0,236,
+0,115,0,8,0,15,0,19,0,23,0,27,0,30,0,35,0,39,0,43,0,214,0,114,0,55,0,245,
+0,191,0,86,0,205,0,155,0,134,0,139,0,142,0,146,0,150,0,158,0,162,0,176,0,
+180,0,184,0,188,0,194,0,201,0,205,0,216,0,221,0,227,0,78,0,227,1,37,1,41,
+1,45,1,49,1,53,1,57,1,61,1,65,1,69,1,73,1,77,1,81,1,115,1,119,1,123,1,127,
+1,131,2,243,1,137,0,55,1,142,1,146,1,153,1,157,0,194,1,149,1,165,1,169,1,
+173,1,177,1,181,1,185,1,189,1,193,1,197,1,201,1,205,1,209,1,213,1,217,1,221,
+0,150,1,227,0,139,1,233,2,5,2,9,1,177,2,48,2,62,2,66,2,70,2,74,2,78,2,82,
+2,86,2,90,2,94,2,104,2,108,2,112,2,116,2,120,2,124,2,128,2,132,2,136,2,140,
+2,144,2,148,2,152,2,156,2,160,2,168,1,149,2,204,2,210,0,139,2,217,0,2,0,114,
+0,7,0,7,0,0,0,14,0,14,0,1,0,18,0,18,0,2,0,22,0,22,0,3,0,26,0,26,0,4,0,32,
+0,32,0,5,0,34,0,34,0,6,0,38,0,38,0,7,0,42,0,42,0,8,0,48,0,48,0,9,0,53,0,53,
+0,10,0,59,0,59,0,11,0,80,0,80,0,12,0,83,0,83,0,13,0,85,0,85,0,14,0,89,0,89,
+0,15,0,119,0,119,0,16,0,133,0,133,0,17,0,137,0,137,0,18,0,141,0,141,0,19,
+0,145,0,145,0,20,0,149,0,149,0,21,0,157,0,157,0,22,0,161,0,161,0,23,0,175,
+0,175,0,24,0,179,0,179,0,25,0,183,0,183,0,26,0,187,0,187,0,27,0,193,0,193,
+0,28,0,203,0,203,0,29,0,207,0,207,0,30,0,218,0,218,0,31,0,220,0,220,0,32,
+0,226,0,226,0,33,0,241,0,241,0,34,1,33,1,33,0,35,1,35,1,35,0,36,1,39,1,39,
+0,37,1,43,1,43,0,38,1,47,1,47,0,39,1,51,1,51,0,40,1,55,1,55,0,41,1,59,1,59,
+0,42,1,63,1,63,0,43,1,67,1,67,0,44,1,71,1,71,0,45,1,75,1,75,0,46,1,79,1,79,
+0,47,1,113,1,113,0,48,1,117,1,117,0,49,1,121,1,121,0,50,1,125,1,125,0,51,
+1,129,1,129,0,52,1,133,1,133,0,53,1,135,1,135,0,54,1,139,1,140,0,55,1,144,
+1,144,0,57,1,151,1,151,0,58,1,155,1,155,0,59,1,159,1,159,0,60,1,161,1,161,
+0,61,1,163,1,163,0,62,1,167,1,167,0,63,1,171,1,171,0,64,1,175,1,175,0,65,
+1,179,1,179,0,66,1,183,1,183,0,67,1,187,1,187,0,68,1,191,1,191,0,69,1,195,
+1,195,0,70,1,199,1,199,0,71,1,203,1,203,0,72,1,207,1,207,0,73,1,211,1,211,
+0,74,1,215,1,215,0,75,1,219,1,219,0,76,1,223,1,223,0,77,1,225,1,225,0,78,
+1,229,1,229,0,79,1,231,1,231,0,80,2,3,2,3,0,81,2,7,2,7,0,82,2,13,2,13,0,83,
+2,46,2,46,0,84,2,60,2,60,0,85,2,64,2,64,0,86,2,68,2,68,0,87,2,72,2,72,0,88,
+2,76,2,76,0,89,2,80,2,80,0,90,2,84,2,84,0,91,2,88,2,88,0,92,2,92,2,92,0,93,
+2,102,2,102,0,94,2,106,2,106,0,95,2,110,2,110,0,96,2,114,2,114,0,97,2,118,
+2,118,0,98,2,122,2,122,0,99,2,126,2,126,0,100,2,130,2,130,0,101,2,134,2,134,
+0,102,2,138,2,138,0,103,2,142,2,142,0,104,2,146,2,146,0,105,2,150,2,150,0,
+106,2,154,2,154,0,107,2,158,2,158,0,108,2,166,2,166,0,109,2,188,2,188,0,110,
+2,206,2,206,0,111,2,208,2,208,0,112,2,212,2,212,0,113,2,215,2,215,0,114,0,
+2,0,236,0,115,0,9,0,16,0,20,0,24,0,28,0,31,0,36,0,40,0,44,0,215,0,115,0,56,
+0,246,0,192,0,87,0,206,0,156,0,135,0,140,0,143,0,147,0,151,0,159,0,163,0,
+177,0,181,0,185,0,189,0,195,0,202,0,206,0,217,0,222,0,228,0,79,0,228,1,38,
+1,42,1,46,1,50,1,54,1,58,1,62,1,66,1,70,1,74,1,78,1,82,1,116,1,120,1,124,
+1,128,1,132,2,244,1,138,0,56,1,143,1,147,1,154,1,158,0,195,1,150,1,166,1,
+170,1,174,1,178,1,182,1,186,1,190,1,194,1,198,1,202,1,206,1,210,1,214,1,218,
+1,222,0,151,1,228,0,140,1,234,2,6,2,10,1,178,2,49,2,63,2,67,2,71,2,75,2,79,
+2,83,2,87,2,91,2,95,2,105,2,109,2,113,2,117,2,121,2,125,2,129,2,133,2,137,
+2,141,2,145,2,149,2,153,2,157,2,161,2,169,1,150,2,205,2,211,0,140,2,218,0,
+2,0,114,0,7,0,7,0,0,0,14,0,14,0,1,0,18,0,18,0,2,0,22,0,22,0,3,0,26,0,26,0,
+4,0,32,0,32,0,5,0,34,0,34,0,6,0,38,0,38,0,7,0,42,0,42,0,8,0,48,0,48,0,9,0,
+53,0,53,0,10,0,59,0,59,0,11,0,80,0,80,0,12,0,83,0,83,0,13,0,85,0,85,0,14,
+0,89,0,89,0,15,0,119,0,119,0,16,0,133,0,133,0,17,0,137,0,137,0,18,0,141,0,
+141,0,19,0,145,0,145,0,20,0,149,0,149,0,21,0,157,0,157,0,22,0,161,0,161,0,
+23,0,175,0,175,0,24,0,179,0,179,0,25,0,183,0,183,0,26,0,187,0,187,0,27,0,
+193,0,193,0,28,0,203,0,203,0,29,0,207,0,207,0,30,0,218,0,218,0,31,0,220,0,
+220,0,32,0,226,0,226,0,33,0,241,0,241,0,34,1,33,1,33,0,35,1,35,1,35,0,36,
+1,39,1,39,0,37,1,43,1,43,0,38,1,47,1,47,0,39,1,51,1,51,0,40,1,55,1,55,0,41,
+1,59,1,59,0,42,1,63,1,63,0,43,1,67,1,67,0,44,1,71,1,71,0,45,1,75,1,75,0,46,
+1,79,1,79,0,47,1,113,1,113,0,48,1,117,1,117,0,49,1,121,1,121,0,50,1,125,1,
+125,0,51,1,129,1,129,0,52,1,133,1,133,0,53,1,135,1,135,0,54,1,139,1,140,0,
+55,1,144,1,144,0,57,1,151,1,151,0,58,1,155,1,155,0,59,1,159,1,159,0,60,1,
+161,1,161,0,61,1,163,1,163,0,62,1,167,1,167,0,63,1,171,1,171,0,64,1,175,1,
+175,0,65,1,179,1,179,0,66,1,183,1,183,0,67,1,187,1,187,0,68,1,191,1,191,0,
+69,1,195,1,195,0,70,1,199,1,199,0,71,1,203,1,203,0,72,1,207,1,207,0,73,1,
+211,1,211,0,74,1,215,1,215,0,75,1,219,1,219,0,76,1,223,1,223,0,77,1,225,1,
+225,0,78,1,229,1,229,0,79,1,231,1,231,0,80,2,3,2,3,0,81,2,7,2,7,0,82,2,13,
+2,13,0,83,2,46,2,46,0,84,2,60,2,60,0,85,2,64,2,64,0,86,2,68,2,68,0,87,2,72,
+2,72,0,88,2,76,2,76,0,89,2,80,2,80,0,90,2,84,2,84,0,91,2,88,2,88,0,92,2,92,
+2,92,0,93,2,102,2,102,0,94,2,106,2,106,0,95,2,110,2,110,0,96,2,114,2,114,
+0,97,2,118,2,118,0,98,2,122,2,122,0,99,2,126,2,126,0,100,2,130,2,130,0,101,
+2,134,2,134,0,102,2,138,2,138,0,103,2,142,2,142,0,104,2,146,2,146,0,105,2,
+150,2,150,0,106,2,154,2,154,0,107,2,158,2,158,0,108,2,166,2,166,0,109,2,188,
+2,188,0,110,2,206,2,206,0,111,2,208,2,208,0,112,2,212,2,212,0,113,2,215,2,
+215,0,114,0,1,1,6,0,12,0,30,0,96,0,162,0,172,0,182,0,192,0,202,0,212,0,222,
+0,232,0,242,0,252,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,234,0,2,0,
+130,0,230,0,2,0,126,0,232,0,2,0,128,0,50,0,2,0,6,0,236,0,2,0,132,2,15,0,2,
+1,24,2,17,0,2,1,26,2,19,0,2,1,28,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,
+60,0,235,0,2,0,130,0,231,0,2,0,126,0,233,0,2,0,128,0,51,0,2,0,6,0,237,0,2,
+0,132,2,16,0,2,1,24,2,18,0,2,1,26,2,20,0,2,1,28,0,1,0,4,2,21,0,2,0,6,0,1,
+0,4,2,22,0,2,0,6,0,1,0,4,2,23,0,2,0,6,0,1,0,4,2,24,0,2,0,6,0,1,0,4,2,25,0,
+2,0,6,0,1,0,4,2,26,0,2,0,6,0,1,0,4,2,27,0,2,0,6,0,1,0,4,2,28,0,2,0,6,0,1,
+0,4,2,219,0,2,0,6,0,1,0,4,2,220,0,2,0,6,0,2,0,6,0,35,0,36,0,0,1,205,1,206,
+0,2,1,209,1,210,0,4,1,213,1,214,0,6,1,217,1,218,0,8,2,160,2,161,0,10,0,1,
+0,34,0,1,0,8,0,2,0,6,0,16,2,50,0,4,0,35,0,36,0,45,2,50,0,4,0,35,0,36,0,118,
+0,1,0,1,0,5,0,1,0,22,0,1,0,8,0,1,0,4,2,51,0,4,0,216,0,6,0,34,0,1,0,1,0,12,
+};
+#endif
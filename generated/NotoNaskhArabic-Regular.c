@@ -0,0 +1,5774 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoNaskhArabic_Regular_ttf_size = 146000;
+asm(".section .rodata");
+asm(".global fz_font_NotoNaskhArabic_Regular_ttf");
+asm(".type fz_font_NotoNaskhArabic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoNaskhArabic_Regular_ttf, 146000");
+asm(".balign 64");
+asm("fz_font_NotoNaskhArabic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoNaskhArabic-Regular.ttf\"");
+#else
+const int fz_font_NotoNaskhArabic_Regular_ttf_size = 146000;
+const char fz_font_NotoNaskhArabic_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,57,100,99,209,0,1,182,76,0,0,25,156,
+71,80,79,83,248,125,182,45,0,1,207,232,0,0,90,92,71,83,85,66,221,108,168,
+80,0,2,42,68,0,0,16,10,79,83,47,50,152,79,236,201,0,0,1,104,0,0,0,96,99,109,
+97,112,245,75,191,214,0,0,25,188,0,0,4,204,103,97,115,112,0,7,0,7,0,1,182,
+64,0,0,0,12,103,108,121,102,232,234,125,60,0,0,42,132,0,1,59,26,104,101,97,
+100,13,168,120,138,0,0,0,236,0,0,0,54,104,104,101,97,23,192,12,204,0,0,1,
+36,0,0,0,36,104,109,116,120,49,145,8,202,0,0,1,200,0,0,23,244,108,111,99,
+97,155,199,226,28,0,0,30,136,0,0,11,252,109,97,120,112,6,61,4,170,0,0,1,72,
+0,0,0,32,110,97,109,101,140,172,185,62,0,1,101,160,0,0,6,6,112,111,115,116,
+176,71,230,7,0,1,107,168,0,0,74,151,0,1,0,0,0,1,15,92,240,160,116,63,95,15,
+60,245,0,11,8,0,0,0,0,0,205,48,84,214,0,0,0,0,210,40,203,221,254,2,251,10,
+17,46,8,115,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,250,238,0,0,17,11,254,2,
+250,213,17,46,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,253,0,1,0,0,5,253,3,151,0,
+18,1,17,0,37,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,1,0,4,6,14,1,144,0,5,0,0,5,
+154,5,51,0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,8,2,2,11,5,2,4,5,4,2,2,4,
+0,0,32,0,128,0,0,0,0,0,0,8,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,250,
+238,0,0,8,141,5,18,0,0,0,65,0,8,0,0,0,0,0,0,0,0,0,32,0,5,5,42,0,6,0,0,0,0,
+1,196,0,0,1,196,0,0,1,165,0,94,1,165,0,94,1,165,0,94,13,86,0,66,4,77,255,
+236,4,77,255,236,6,176,0,139,4,108,0,70,5,200,0,70,3,92,0,33,1,179,0,81,2,
+103,0,84,6,213,0,139,5,47,0,78,0,0,255,235,0,0,255,231,0,0,255,118,0,0,255,
+143,0,0,254,245,0,0,255,93,0,0,254,115,0,0,255,108,0,0,255,144,0,0,255,145,
+0,0,255,144,1,179,0,90,2,218,0,94,3,102,0,113,4,242,0,68,3,126,0,111,1,231,
+255,228,1,231,0,100,3,191,0,70,2,12,0,144,4,242,0,68,1,231,0,157,6,45,0,143,
+3,99,0,86,6,45,0,143,6,45,0,143,5,22,0,128,5,22,0,128,5,22,0,128,3,79,0,70,
+3,79,0,70,2,250,255,186,2,250,255,186,8,27,0,139,8,27,0,139,8,196,0,139,8,
+196,0,139,6,39,0,87,6,39,0,87,4,213,0,128,4,213,0,128,5,198,0,139,5,198,0,
+139,4,242,0,68,4,242,0,68,4,242,0,68,1,174,255,239,6,201,0,139,5,45,0,68,
+4,118,0,35,4,195,0,68,3,233,0,139,4,177,0,68,3,68,0,139,3,191,0,70,4,242,
+0,68,4,242,0,68,0,0,255,212,0,0,255,143,0,0,0,0,0,0,255,234,0,0,255,198,0,
+0,255,234,0,0,255,222,0,0,255,252,0,0,255,116,0,0,255,242,0,0,0,48,0,0,255,
+226,0,0,255,250,0,0,0,21,0,0,0,53,0,0,0,60,0,0,0,60,0,0,255,106,0,0,0,24,
+0,0,0,50,0,0,255,188,2,132,0,156,2,136,0,157,3,78,0,157,3,210,0,157,3,92,
+0,139,3,14,0,96,3,144,0,52,3,125,0,19,3,125,0,17,3,119,0,87,3,54,0,70,1,199,
+0,85,1,73,0,25,3,52,0,38,6,45,0,143,5,45,0,68,0,0,255,226,1,231,0,14,1,231,
+0,0,2,12,0,39,1,4,255,255,2,178,0,157,3,191,0,70,3,191,0,70,5,250,0,68,6,
+45,0,143,6,45,0,143,6,45,0,143,6,45,0,143,6,45,0,143,6,45,0,143,6,45,0,143,
+6,45,0,143,5,22,0,128,5,22,0,128,5,22,0,128,5,22,0,128,5,22,0,128,5,22,0,
+128,5,22,0,128,3,87,0,77,3,79,0,70,3,79,0,70,3,79,0,70,3,79,0,70,3,79,0,70,
+3,79,0,70,3,79,0,70,3,79,0,70,2,250,255,186,2,250,255,186,2,250,255,186,2,
+250,255,186,2,250,255,186,2,250,255,186,2,250,255,186,3,22,255,186,2,250,
+255,186,8,27,0,139,8,27,0,139,8,27,0,139,8,196,0,139,8,196,0,139,6,39,0,87,
+4,213,0,128,6,201,0,139,6,201,0,139,6,201,0,139,6,201,0,139,6,208,0,139,6,
+201,0,139,5,45,0,68,5,45,0,68,5,198,0,139,8,30,0,18,5,127,0,139,4,118,0,35,
+4,118,0,35,4,118,0,35,5,198,0,139,5,198,0,139,5,198,0,139,5,198,0,139,5,198,
+0,139,5,198,0,139,4,195,0,68,4,195,0,68,4,195,0,68,4,195,0,68,4,177,0,68,
+4,177,0,68,4,177,0,68,4,177,0,68,4,177,0,68,5,12,0,35,5,22,0,128,3,68,0,139,
+3,68,0,139,3,68,0,139,3,99,0,87,3,191,0,70,3,191,0,70,3,191,0,70,3,191,0,
+70,3,191,0,70,3,191,0,70,3,191,0,70,3,191,0,70,4,242,0,68,6,7,0,139,4,242,
+0,68,3,191,0,70,4,242,0,68,4,242,0,68,6,47,0,139,6,47,0,139,1,242,0,83,3,
+68,0,139,0,0,254,2,0,0,254,153,0,0,254,115,0,0,255,46,0,0,255,35,0,0,255,
+62,0,0,254,184,9,186,0,100,7,95,0,42,0,0,255,145,0,0,255,145,0,0,255,90,0,
+0,255,126,0,0,254,184,0,0,254,252,1,164,0,43,2,193,0,88,0,0,254,238,0,0,255,
+68,4,21,0,42,0,0,255,122,0,0,255,122,0,0,255,106,0,0,255,126,3,79,0,70,2,
+250,255,186,2,132,0,156,2,136,0,157,3,78,0,157,3,210,0,157,3,186,0,157,3,
+162,0,96,3,141,0,122,3,125,0,19,3,125,0,17,3,111,0,90,8,27,0,139,8,196,0,
+139,4,213,0,128,3,126,0,111,3,233,0,139,5,12,0,35,6,45,0,143,6,45,0,143,6,
+45,0,143,6,45,0,143,6,45,0,143,6,45,0,143,6,45,0,143,5,22,0,128,5,128,0,128,
+3,87,0,77,3,79,0,70,3,96,255,186,8,27,0,139,4,213,0,128,4,213,0,128,4,213,
+0,128,6,201,0,139,6,201,0,139,5,198,0,139,5,198,0,139,5,198,0,139,3,233,0,
+139,3,233,0,139,4,177,0,68,4,177,0,68,4,177,0,68,4,195,0,68,2,250,255,186,
+2,250,255,186,8,27,0,139,5,22,0,128,5,22,0,128,8,27,0,139,2,250,255,186,5,
+22,0,128,1,231,255,172,1,231,255,170,4,242,0,68,4,242,0,68,4,242,0,68,3,191,
+255,255,3,191,255,255,6,97,0,167,6,97,0,167,5,22,0,128,8,27,0,139,8,27,0,
+139,4,118,0,35,0,0,0,0,0,0,255,220,0,0,255,37,0,0,255,220,0,0,254,81,4,211,
+0,98,2,6,255,253,6,137,0,143,2,52,255,239,2,87,255,239,6,137,0,143,2,191,
+255,239,2,226,255,239,6,137,0,143,2,191,255,239,2,226,255,239,6,137,0,143,
+2,191,255,239,2,226,255,239,6,137,0,143,2,191,255,239,2,226,255,239,6,137,
+0,143,2,52,255,241,2,226,255,239,6,138,0,139,3,77,255,239,3,24,255,239,6,
+138,0,139,3,77,255,239,3,24,255,239,5,83,0,133,5,22,255,239,5,83,255,239,
+5,83,0,133,5,22,255,239,5,83,255,239,5,83,0,133,5,22,255,239,5,83,255,239,
+5,83,0,133,5,22,255,239,5,83,255,239,3,202,0,70,3,202,0,70,3,202,0,70,3,202,
+0,70,3,31,255,186,3,31,255,186,6,53,0,137,3,81,255,239,3,172,255,239,6,53,
+0,137,3,81,255,204,3,172,255,167,6,53,0,137,3,81,255,204,3,172,255,167,6,
+53,0,137,3,81,255,204,3,172,255,167,4,175,0,68,4,175,0,68,3,158,0,139,3,102,
+0,139,2,52,255,239,3,41,255,239,5,18,0,35,4,16,255,239,4,27,255,239,4,61,
+0,105,4,26,0,74,3,102,1,8,3,102,0,229,3,102,0,150,3,102,0,115,3,102,0,186,
+3,102,0,171,3,102,0,193,3,102,0,182,3,15,0,160,3,15,0,160,2,148,0,200,1,239,
+0,109,2,5,0,118,1,214,0,132,2,148,0,108,2,148,0,108,5,228,0,139,3,81,255,
+239,3,172,255,239,3,191,0,70,3,191,0,70,3,191,0,70,3,191,0,70,3,191,0,70,
+3,191,0,70,5,127,0,98,2,191,255,239,2,226,255,239,2,52,255,239,2,87,255,239,
+5,127,0,98,2,191,255,239,2,226,255,239,1,144,255,191,1,144,0,1,1,144,0,12,
+1,144,255,245,1,144,0,9,1,144,0,36,4,1,0,17,4,1,0,87,7,228,0,209,1,144,0,
+3,1,144,255,233,1,144,0,10,1,144,0,18,1,144,0,22,1,144,0,18,1,144,0,36,1,
+144,0,102,2,6,255,210,2,6,0,82,3,191,0,70,2,6,0,156,5,127,0,98,2,52,255,239,
+2,87,255,239,2,6,0,156,6,137,0,143,2,52,255,239,2,87,255,239,3,189,0,170,
+6,137,0,143,2,52,255,239,2,226,255,239,6,137,0,143,2,167,255,239,2,226,255,
+239,5,79,0,133,5,22,255,239,5,83,255,239,5,83,0,133,5,22,255,239,5,83,255,
+239,5,79,0,133,5,22,255,239,5,83,255,239,3,202,0,70,3,202,0,70,3,31,255,186,
+3,31,255,186,8,34,0,139,5,67,255,239,5,77,255,239,8,34,0,139,5,67,255,239,
+5,77,255,239,8,203,0,139,6,74,255,239,6,57,255,239,8,203,0,139,6,74,255,239,
+6,57,255,239,6,52,0,87,5,72,255,239,5,9,255,239,6,52,0,87,5,72,255,239,5,
+9,255,239,3,208,0,140,4,10,255,239,3,79,255,239,3,208,0,140,4,10,255,239,
+3,79,255,239,6,138,0,139,3,92,255,239,3,24,255,239,5,34,0,68,3,92,255,239,
+3,24,255,239,5,228,0,139,3,81,255,239,3,172,255,239,4,187,0,68,1,179,255,
+236,1,245,255,239,4,57,0,139,3,165,255,239,3,78,255,239,4,175,0,68,2,52,255,
+239,2,87,255,239,3,158,0,139,4,16,255,239,3,12,255,239,3,191,0,70,5,127,0,
+98,5,127,0,98,2,191,255,239,2,226,255,239,4,36,255,109,4,225,255,169,4,36,
+255,237,4,225,0,42,4,36,0,71,4,225,0,70,4,36,0,71,4,225,0,70,6,201,0,139,
+5,34,0,68,1,231,0,157,2,6,0,160,0,0,0,17,2,52,255,239,6,137,0,143,2,191,255,
+239,2,87,255,239,2,226,255,239,3,24,255,239,6,138,0,139,3,92,255,239,0,0,
+255,111,4,36,255,152,4,225,255,213,0,0,255,104,3,102,0,139,3,102,0,139,3,
+102,0,235,3,219,0,75,2,77,0,92,2,77,0,98,0,0,255,105,0,0,255,195,0,0,255,
+211,0,0,255,149,0,0,255,202,0,0,255,227,0,0,0,48,0,0,0,48,0,0,255,81,0,0,
+255,227,0,0,255,169,0,0,255,178,0,0,255,155,0,0,255,225,3,184,0,167,3,92,
+0,56,2,6,255,238,2,6,0,125,2,6,0,156,3,191,0,70,3,191,0,70,5,127,0,98,6,137,
+0,143,2,52,255,239,2,226,255,239,6,137,0,143,2,191,255,239,2,226,255,239,
+5,83,0,133,5,22,255,239,5,83,255,239,5,79,0,133,5,22,255,239,5,83,255,239,
+5,83,0,133,5,22,255,239,5,83,255,239,3,202,0,70,3,202,0,70,3,202,0,70,3,202,
+0,70,3,202,0,70,3,31,255,186,3,31,255,186,3,31,255,186,3,31,255,186,3,31,
+255,186,3,31,255,186,3,31,255,186,8,34,0,139,5,67,255,239,5,77,255,239,8,
+34,0,139,5,67,255,239,5,77,255,239,8,34,0,139,5,67,255,239,5,77,255,239,8,
+203,0,139,6,74,255,239,6,57,255,239,8,203,0,139,6,74,255,239,6,57,255,239,
+6,52,0,87,5,72,255,239,5,9,255,239,3,208,0,140,4,10,255,239,3,79,255,239,
+6,138,0,139,3,92,255,239,3,24,255,239,6,138,0,139,3,92,255,239,3,24,255,239,
+6,138,0,139,3,92,255,239,3,24,255,239,5,34,0,68,5,34,0,68,8,133,0,18,7,25,
+255,239,7,130,255,239,6,53,0,137,3,81,255,239,3,172,255,239,5,228,0,139,3,
+81,255,239,3,172,255,239,5,228,0,139,3,81,255,239,3,172,255,239,6,53,0,137,
+3,81,255,208,3,172,255,167,6,53,0,137,3,81,255,208,3,172,255,167,6,53,0,137,
+3,81,255,204,3,172,255,167,4,187,0,68,1,179,255,196,1,245,255,196,4,187,0,
+68,1,179,255,236,1,245,255,239,4,187,0,68,1,179,255,154,1,245,255,154,4,187,
+0,68,2,209,255,239,1,245,255,239,4,175,0,68,2,52,255,239,2,87,255,239,4,175,
+0,68,2,52,255,239,2,87,255,239,4,175,0,68,5,83,0,133,5,22,255,239,5,83,255,
+239,3,191,0,70,6,148,0,139,6,74,255,239,6,57,255,239,8,203,0,139,4,10,255,
+239,3,79,255,239,3,208,0,140,4,36,255,137,4,225,255,197,4,36,0,71,4,225,0,
+70,4,36,0,71,4,225,0,70,4,36,0,71,4,225,0,70,4,36,0,71,4,225,0,70,4,36,0,
+71,4,225,0,70,4,43,0,71,4,225,0,70,3,202,0,70,3,31,255,186,5,18,0,35,4,16,
+255,239,4,27,255,239,6,137,0,143,3,217,255,239,3,232,255,239,2,52,255,239,
+2,87,255,239,6,137,0,143,6,137,0,143,2,222,255,239,2,226,255,239,6,137,0,
+143,2,222,255,239,2,226,255,239,6,137,0,143,2,191,255,239,2,226,255,239,6,
+137,0,143,2,191,255,239,2,226,255,239,6,137,0,143,2,191,255,239,2,226,255,
+239,5,79,0,133,5,22,255,239,5,83,255,239,5,83,0,133,5,22,255,239,5,83,255,
+239,3,202,0,70,3,202,0,70,3,31,255,186,8,34,0,139,5,67,255,239,5,77,255,239,
+3,158,0,140,4,10,255,239,3,79,255,239,3,208,0,140,4,10,255,239,3,97,0,0,3,
+208,0,140,4,10,255,239,3,97,0,0,6,138,0,139,3,92,255,239,3,24,255,239,6,138,
+0,139,3,92,255,239,3,24,255,239,6,53,0,137,3,81,255,239,3,172,255,239,6,53,
+0,137,3,81,255,239,3,172,255,239,6,53,0,137,3,81,255,239,3,172,255,239,4,
+62,0,139,3,165,255,239,3,78,255,239,4,62,0,139,3,165,255,239,3,78,255,239,
+4,175,0,68,2,191,255,239,2,226,255,239,4,175,0,68,2,52,255,239,2,70,255,226,
+4,175,0,68,2,52,255,239,2,87,255,239,4,187,0,68,1,179,255,236,1,245,255,239,
+3,31,255,186,3,31,255,186,8,34,0,139,5,67,255,239,5,77,255,239,3,191,0,70,
+3,191,0,70,2,191,255,239,2,226,255,239,5,127,0,98,5,127,0,98,5,67,255,239,
+5,77,255,239,8,34,0,139,4,36,0,71,4,225,0,70,0,0,254,110,0,0,254,137,3,77,
+255,239,2,52,255,239,1,156,0,4,9,133,0,139,2,52,255,239,3,41,255,239,0,0,
+255,222,1,199,0,85,5,127,0,98,2,52,255,239,2,87,255,239,6,53,0,137,3,81,255,
+239,3,172,255,239,6,53,0,137,3,81,255,239,3,172,255,239,5,127,0,98,2,191,
+255,239,2,226,255,239,5,127,0,98,2,52,255,236,2,226,255,239,5,127,0,98,2,
+167,255,237,2,226,255,239,5,83,0,133,5,22,255,239,5,83,255,239,8,34,0,139,
+5,67,255,239,5,77,255,239,3,31,255,186,5,79,0,133,5,22,255,239,5,83,255,239,
+2,6,255,155,2,6,255,153,5,127,0,98,2,158,255,217,2,226,255,239,5,127,0,98,
+2,158,255,216,2,226,255,239,5,127,0,98,2,158,255,239,2,226,255,239,3,191,
+255,255,3,191,255,255,2,158,255,217,2,226,255,239,4,26,0,71,2,158,255,216,
+2,226,255,239,4,26,0,71,5,83,0,133,5,22,255,239,5,83,255,239,8,34,0,139,5,
+67,255,239,5,77,255,239,8,34,0,139,5,67,255,239,5,77,255,239,5,228,0,139,
+3,81,255,239,3,172,255,239,5,83,0,133,5,22,255,239,5,83,255,239,3,152,1,60,
+3,152,1,13,3,152,0,137,3,152,0,77,3,152,0,171,3,152,0,176,3,152,0,56,3,152,
+0,35,3,152,0,38,3,152,0,137,3,152,0,107,3,152,0,97,3,152,0,96,3,152,0,122,
+3,152,0,96,1,231,0,84,1,231,0,45,2,168,255,239,2,208,255,239,0,0,255,239,
+0,0,255,83,0,0,0,0,0,0,0,0,2,13,0,55,1,231,0,67,1,239,0,109,1,174,255,239,
+1,174,255,239,1,174,255,239,1,174,255,239,1,174,255,239,1,174,255,239,0,0,
+0,32,3,217,255,239,3,232,255,239,6,45,0,143,6,137,0,143,2,191,255,241,2,226,
+255,239,5,22,0,128,5,79,0,133,5,22,255,239,5,83,255,239,6,39,0,87,6,52,0,
+87,5,72,255,239,5,9,255,239,6,201,0,139,6,138,0,139,3,77,255,239,3,24,255,
+239,5,45,0,68,5,34,0,68,3,92,255,239,3,24,255,239,4,195,0,68,4,187,0,68,1,
+179,255,236,1,245,255,239,3,233,0,139,4,62,0,139,3,165,255,239,3,78,255,239,
+4,242,0,68,5,127,0,98,2,191,255,239,2,226,255,239,4,242,0,68,5,127,0,98,2,
+191,255,239,2,226,255,239,3,100,0,10,3,138,0,10,3,191,0,40,3,191,0,40,4,139,
+0,129,0,0,255,68,0,0,255,214,0,0,255,68,0,0,254,218,0,0,255,95,0,0,254,248,
+0,0,255,153,0,0,255,61,0,0,255,110,0,0,255,153,0,0,255,61,0,0,255,110,0,0,
+255,234,0,0,255,198,0,0,255,234,0,0,255,99,0,0,255,78,0,0,255,47,0,0,255,
+47,0,0,255,84,0,0,255,56,0,0,255,84,0,0,255,56,0,0,254,215,0,0,254,165,0,
+0,255,14,0,0,255,94,9,188,0,100,8,200,0,100,15,138,0,100,1,156,0,69,1,158,
+0,98,2,30,0,94,2,114,0,94,2,38,0,81,1,245,0,62,2,72,0,26,2,59,0,13,2,59,0,
+11,2,56,0,56,2,98,0,94,2,83,0,62,2,70,0,78,2,98,0,107,2,38,0,37,1,233,0,0,
+2,7,0,0,2,65,0,0,2,98,0,0,7,158,0,139,0,0,3,172,4,77,255,236,0,0,1,130,9,
+51,0,70,9,51,0,70,9,51,0,70,9,51,0,70,13,86,0,66,13,86,0,66,13,86,0,66,13,
+86,0,66,9,197,0,105,9,197,0,105,9,197,0,105,9,197,0,105,8,219,0,70,8,219,
+0,70,8,219,0,70,8,219,0,70,15,177,0,110,15,177,0,110,15,177,0,110,15,177,
+0,110,15,177,0,110,9,186,0,100,9,186,0,100,9,186,0,100,4,36,1,80,0,0,0,70,
+4,225,0,108,0,0,0,69,4,36,1,80,4,36,1,80,4,36,1,80,4,36,1,80,4,36,1,80,0,
+0,255,109,0,0,255,137,0,0,0,70,0,0,255,152,0,0,255,237,0,0,0,70,4,225,0,108,
+4,225,0,108,4,225,0,108,4,225,0,108,4,225,0,108,0,0,255,161,0,0,255,189,0,
+0,0,69,0,0,255,204,0,0,0,33,0,0,255,220,0,0,0,69,1,143,0,0,4,36,1,80,3,191,
+0,40,3,191,0,40,4,139,0,129,0,0,255,157,0,0,0,160,0,0,255,47,4,93,0,156,5,
+189,0,139,6,22,0,70,6,22,0,70,6,22,0,70,6,22,0,70,7,214,0,98,7,214,0,98,5,
+118,255,186,5,118,255,186,6,144,0,139,7,6,0,68,7,214,0,98,7,214,0,98,5,118,
+255,186,5,118,255,186,6,144,0,139,7,6,0,68,7,214,0,98,7,214,0,98,6,1,255,
+186,6,1,255,186,7,27,0,139,7,145,0,68,8,97,0,98,8,97,0,98,6,1,255,186,6,1,
+255,186,7,27,0,139,7,145,0,68,8,97,0,98,8,97,0,98,8,151,0,98,8,151,0,98,8,
+151,0,98,8,151,0,98,5,178,0,156,8,103,0,68,7,229,0,139,9,43,0,98,9,43,0,98,
+6,46,0,139,7,116,0,98,7,116,0,98,5,84,0,156,7,135,0,139,5,118,255,186,5,118,
+255,186,6,144,0,139,7,6,0,68,7,214,0,98,7,214,0,98,5,127,0,98,6,1,255,186,
+6,1,255,186,7,27,0,139,7,145,0,68,8,97,0,98,8,97,0,98,10,136,0,98,10,136,
+0,98,8,206,0,98,8,206,0,98,8,206,0,98,8,206,0,98,10,204,0,98,10,204,0,98,
+10,204,0,98,10,204,0,98,10,210,0,98,10,210,0,98,10,210,0,98,10,210,0,98,10,
+210,0,98,10,210,0,98,11,184,0,98,11,184,0,98,11,184,0,98,11,184,0,98,10,156,
+0,133,10,160,0,133,10,156,0,133,9,134,0,139,8,108,255,186,8,108,255,186,9,
+88,255,186,9,88,255,186,2,6,0,156,5,22,255,239,4,139,255,239,7,135,255,239,
+7,135,255,239,7,135,255,239,5,130,255,239,5,64,255,239,7,135,255,239,7,135,
+255,239,7,135,255,239,5,130,255,239,5,64,255,239,7,241,255,239,7,241,255,
+239,7,241,255,239,5,236,255,239,5,170,255,239,5,245,255,239,10,105,255,239,
+8,100,255,239,10,105,255,239,8,100,255,239,10,105,255,239,8,100,255,239,10,
+150,255,239,10,150,255,239,10,150,255,239,8,145,255,239,11,157,255,239,11,
+157,255,239,9,152,255,239,11,157,255,239,11,157,255,239,11,157,255,239,9,
+152,255,239,10,155,255,239,8,150,255,239,9,93,255,239,7,88,255,239,9,93,255,
+239,7,88,255,239,8,175,255,239,8,175,255,239,8,175,255,239,6,170,255,239,
+8,175,255,239,6,170,255,239,8,164,255,239,8,164,255,239,8,164,255,239,5,70,
+255,239,6,159,255,239,7,6,255,239,7,6,255,239,7,6,255,239,5,1,255,239,4,191,
+255,239,8,248,255,239,8,248,255,239,8,248,255,239,6,243,255,239,7,135,255,
+239,7,135,255,239,7,135,255,239,5,130,255,239,5,64,255,239,9,99,255,239,7,
+94,255,239,4,16,255,239,8,18,255,239,8,18,255,239,8,18,255,239,6,13,255,239,
+5,203,255,239,10,150,255,239,10,150,255,239,10,150,255,239,8,145,255,239,
+8,79,255,239,8,79,255,239,8,150,255,239,4,58,0,156,5,154,0,139,5,243,0,70,
+5,243,0,70,5,243,0,70,5,243,0,70,7,179,0,98,7,179,0,98,7,131,0,133,7,135,
+0,133,6,109,0,139,7,179,0,98,7,179,0,98,7,131,0,133,7,135,0,133,7,131,0,133,
+6,109,0,139,7,179,0,98,7,179,0,98,7,237,0,133,7,241,0,133,7,237,0,133,6,215,
+0,139,8,29,0,98,8,29,0,98,7,246,0,133,6,224,0,139,8,38,0,98,8,38,0,98,10,
+105,0,133,9,79,0,139,10,101,0,133,9,79,0,139,10,101,0,133,10,105,0,133,9,
+79,0,139,10,146,0,133,10,150,0,133,10,146,0,133,9,124,0,139,11,157,0,133,
+10,131,0,139,11,153,0,133,11,157,0,133,11,153,0,133,10,131,0,139,10,155,0,
+133,9,129,0,139,9,129,0,139,9,89,0,133,8,67,0,139,9,89,0,133,8,67,0,139,8,
+171,0,133,8,175,0,133,8,171,0,133,7,149,0,139,8,219,0,98,8,219,0,98,8,175,
+0,133,7,149,0,139,8,219,0,98,8,219,0,98,5,87,0,156,8,160,0,133,8,164,0,133,
+8,160,0,133,8,12,0,68,7,138,0,139,8,208,0,98,8,208,0,98,7,2,0,133,7,6,0,133,
+7,2,0,133,5,236,0,139,7,50,0,98,7,50,0,98,8,244,0,133,8,248,0,133,8,244,0,
+133,7,222,0,139,9,36,0,98,9,36,0,98,7,131,0,133,7,135,0,133,7,131,0,133,6,
+109,0,139,7,179,0,98,7,179,0,98,9,95,0,133,8,73,0,139,9,143,0,98,9,143,0,
+98,8,14,0,133,8,18,0,133,8,14,0,133,6,248,0,139,8,62,0,98,8,62,0,98,3,79,
+0,70,2,250,255,186,4,242,0,68,10,199,0,98,10,199,0,98,9,137,0,98,9,137,0,
+98,9,137,0,98,9,137,0,98,10,194,0,98,10,194,0,98,10,194,0,98,10,194,0,98,
+10,149,0,98,10,149,0,98,10,149,0,98,10,149,0,98,10,149,0,98,10,149,0,98,11,
+201,0,98,11,201,0,98,11,201,0,98,11,201,0,98,10,146,0,133,10,150,0,133,10,
+146,0,133,9,124,0,139,8,98,255,186,8,98,255,186,9,105,255,186,9,105,255,186,
+1,231,0,157,5,165,255,239,5,99,255,239,5,165,255,239,5,99,255,239,6,48,255,
+239,5,238,255,239,6,48,255,239,5,238,255,239,8,155,255,239,8,89,255,239,8,
+155,255,239,8,89,255,239,5,161,255,239,6,250,255,239,5,67,255,239,5,165,255,
+239,5,99,255,239,6,48,255,239,5,238,255,239,10,160,255,239,10,160,255,239,
+10,160,255,239,10,160,255,239,10,160,255,239,10,160,255,239,8,87,255,239,
+8,87,255,239,13,132,0,133,13,244,0,133,14,32,0,98,14,32,0,98,16,31,0,98,13,
+238,0,133,12,212,0,139,16,223,0,133,13,192,0,139,14,217,0,139,16,31,0,98,
+13,234,0,133,12,212,0,139,17,11,0,98,15,197,0,139,13,170,0,133,13,214,0,98,
+12,219,0,139,10,214,0,139,12,28,0,98,10,214,0,139,12,28,0,98,12,28,0,98,12,
+164,0,139,11,185,0,133,10,159,0,139,11,129,0,139,12,199,0,98,12,199,0,98,
+12,151,0,133,11,129,0,139,10,150,0,133,14,32,0,98,13,41,0,98,11,227,0,139,
+13,41,0,98,11,36,0,98,11,36,0,98,10,105,0,139,13,41,0,98,13,180,0,98,13,180,
+0,98,13,180,0,98,13,180,0,98,11,175,0,98,11,175,0,98,14,32,0,98,16,37,0,98,
+14,32,0,98,16,31,0,98,17,11,0,98,16,31,0,98,17,11,0,98,12,199,0,98,10,194,
+0,98,13,180,0,98,13,180,0,98,11,175,0,98,12,27,0,98,11,229,0,98,13,41,0,98,
+12,28,0,98,12,121,0,98,14,32,0,98,11,51,0,139,11,129,0,139,12,253,0,133,16,
+37,0,98,16,37,0,98,14,32,0,98,11,229,0,98,13,41,0,98,16,31,0,98,13,41,0,98,
+11,63,255,239,13,68,255,239,11,63,255,239,11,63,255,239,11,63,255,239,11,
+63,255,239,11,63,255,239,13,183,255,239,15,233,255,239,15,233,255,239,13,
+228,255,239,13,228,255,239,11,223,255,239,16,240,255,239,13,228,255,239,13,
+228,255,239,11,223,255,239,14,235,255,239,13,233,255,239,11,228,255,239,10,
+166,255,239,11,253,255,239,12,89,255,239,10,84,255,239,10,84,255,239,14,75,
+255,239,12,70,255,239,14,75,255,239,12,70,255,239,14,75,255,239,12,70,255,
+239,14,75,255,239,12,177,255,239,10,172,255,239,10,213,255,239,10,213,255,
+239,9,91,255,239,11,253,255,239,10,84,255,239,12,218,255,239,10,84,255,239,
+9,237,255,239,12,171,255,239,12,230,255,239,0,10,0,0,1,174,255,239,1,174,
+255,239,1,174,255,239,4,147,0,100,4,147,0,182,4,147,0,98,4,147,0,92,4,147,
+0,43,4,147,0,129,4,147,0,113,4,147,0,90,4,147,0,100,4,147,0,102,2,4,0,28,
+2,4,0,55,2,4,0,35,2,4,0,25,2,4,0,14,2,4,0,44,2,4,0,30,2,4,0,41,2,4,0,37,2,
+4,0,25,3,92,1,101,2,39,0,147,2,37,0,147,2,37,0,84,3,80,0,120,3,80,0,60,3,
+80,0,129,3,80,0,60,1,227,0,60,1,227,0,60,2,195,0,140,2,147,0,82,2,147,0,82,
+2,37,0,156,2,37,0,152,12,149,0,105,9,167,0,105,10,77,255,186,15,213,0,40,
+15,191,0,109,15,62,0,68,12,142,0,139,14,125,0,139,13,143,0,98,0,0,0,1,0,3,
+0,1,0,0,0,12,0,4,4,192,0,0,0,92,0,64,0,5,0,28,0,0,0,13,0,33,0,44,0,46,0,57,
+0,58,0,160,0,171,0,187,6,4,6,27,6,81,6,82,6,255,7,127,8,160,8,172,8,254,32,
+15,32,17,32,79,37,204,46,65,251,176,251,193,251,255,252,93,252,99,252,150,
+252,222,252,241,252,244,253,16,253,44,253,63,253,143,253,157,253,179,253,
+199,253,253,254,116,254,241,254,252,254,255,255,255,0,0,0,0,0,13,0,32,0,44,
+0,46,0,48,0,58,0,160,0,171,0,187,6,0,6,6,6,30,6,82,6,83,7,80,8,160,8,162,
+8,228,32,11,32,16,32,79,37,204,46,65,251,80,251,177,251,211,252,0,252,94,
+252,100,252,151,252,223,252,242,252,245,253,17,253,45,253,80,253,146,253,
+158,253,180,253,240,254,112,254,118,254,242,254,255,255,255,0,1,255,245,255,
+227,5,188,255,215,5,161,255,204,255,99,5,62,5,47,0,0,250,2,250,0,253,34,250,
+0,249,176,250,215,0,0,250,188,225,37,229,224,229,164,219,105,215,177,0,0,
+5,198,0,0,8,193,5,59,7,180,7,211,8,93,8,220,8,42,7,58,0,0,0,0,0,0,7,224,0,
+0,0,0,0,0,0,0,3,6,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,0,
+0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,1,10,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,82,1,118,1,244,0,0,2,8,2,46,2,72,2,80,0,0,0,0,0,
+0,3,216,0,7,3,224,3,228,3,233,3,123,3,127,3,131,3,135,3,139,3,143,3,147,3,
+151,3,155,3,157,3,159,0,113,1,54,0,123,1,55,1,56,1,57,0,126,1,58,1,59,1,60,
+0,128,1,61,1,62,1,63,0,122,1,64,1,65,1,66,0,127,1,67,1,68,1,69,0,121,1,70,
+1,71,1,72,0,164,1,73,1,74,1,75,0,166,1,76,1,77,1,78,0,132,1,79,1,80,1,81,
+0,131,1,82,1,83,1,84,0,134,1,85,1,86,1,87,0,135,1,88,1,89,1,90,0,141,1,91,
+0,140,1,92,0,142,1,93,0,136,1,94,0,152,1,95,0,145,1,96,0,169,1,97,1,98,1,
+99,0,175,1,100,1,101,1,102,0,178,1,103,1,104,1,105,0,177,1,106,1,107,1,108,
+0,186,1,109,0,187,1,110,1,71,1,72,0,192,1,111,0,193,1,112,1,113,1,114,0,190,
+1,115,1,116,1,117,0,210,1,118,0,211,0,173,1,136,1,137,1,138,0,199,1,139,0,
+198,1,140,0,200,1,141,0,119,0,203,1,142,0,197,1,143,0,201,1,144,0,208,1,145,
+1,146,1,147,1,148,1,149,4,185,4,16,4,186,4,17,4,187,4,18,4,188,4,19,4,189,
+4,20,4,190,4,21,4,191,4,22,4,104,4,192,4,23,4,105,0,204,1,150,1,151,1,152,
+4,178,4,179,4,180,4,181,4,182,4,183,4,184,5,79,5,80,5,81,5,82,5,83,5,84,5,
+85,5,86,4,103,5,59,1,159,1,160,5,161,5,87,5,162,5,163,5,164,5,165,5,166,5,
+167,5,88,5,168,5,89,5,90,5,169,5,170,5,91,5,92,5,171,5,172,5,93,5,173,5,94,
+5,174,5,95,5,96,5,175,5,97,5,98,5,176,5,99,5,177,5,100,5,101,5,178,5,102,
+5,179,5,180,5,103,5,104,5,105,5,181,5,106,5,107,5,108,5,109,5,110,5,182,5,
+111,5,112,5,113,5,114,5,115,5,183,5,116,5,117,5,184,5,118,5,185,5,186,5,187,
+5,119,5,188,5,189,5,190,5,191,5,192,5,193,5,194,5,195,5,120,5,121,5,196,5,
+122,5,123,5,124,5,125,5,197,5,198,5,199,5,148,5,149,5,200,5,150,5,201,5,151,
+5,152,5,153,5,154,5,155,5,156,5,157,5,158,5,202,5,203,5,204,5,159,5,160,5,
+244,5,245,3,17,5,246,5,247,5,248,5,249,5,250,5,251,5,252,3,187,3,188,1,161,
+3,189,1,162,3,110,1,163,5,239,1,164,1,165,3,111,1,166,3,112,1,167,3,113,1,
+168,3,114,1,169,3,115,0,33,0,34,1,170,0,35,1,171,0,36,1,172,0,37,1,173,0,
+38,1,174,1,175,1,176,0,39,1,177,0,40,1,178,1,179,1,180,0,41,1,181,0,42,1,
+182,1,183,1,184,0,43,1,185,1,186,1,187,0,44,1,188,1,189,1,190,0,45,1,191,
+1,192,1,193,0,46,1,194,1,195,1,196,0,47,1,197,0,48,1,198,0,49,1,199,0,50,
+1,200,0,51,1,201,1,202,1,203,0,52,1,204,1,205,1,206,0,53,1,207,1,208,1,209,
+0,54,1,210,1,211,1,212,0,55,1,213,1,214,1,215,0,56,1,216,1,217,1,218,0,57,
+1,219,1,220,1,221,0,58,1,222,1,223,1,224,0,65,1,225,1,226,1,227,0,66,1,228,
+1,229,1,230,0,67,1,231,1,232,1,233,0,68,1,234,1,235,1,236,0,69,1,237,1,238,
+1,239,0,70,1,240,1,241,1,242,0,71,1,243,1,244,1,245,0,72,1,246,0,73,1,247,
+0,74,0,0,0,25,0,25,0,25,0,25,0,65,0,85,0,119,0,238,0,250,1,5,1,97,1,175,2,
+12,2,27,2,58,2,81,2,136,2,246,3,43,3,109,3,185,4,26,4,71,4,127,4,205,5,3,
+5,29,5,83,5,108,5,153,5,169,5,238,5,250,6,90,6,102,6,114,6,126,6,138,6,150,
+6,190,6,202,6,214,6,226,6,238,6,250,7,74,7,86,7,138,7,150,7,199,7,211,8,62,
+8,74,8,166,8,178,9,2,9,14,9,93,9,105,9,117,9,129,9,141,9,153,9,164,9,189,
+9,201,9,213,10,71,10,141,10,206,10,218,11,22,11,97,11,176,11,188,11,226,12,
+45,12,85,12,115,12,178,12,205,13,12,13,66,13,101,13,149,13,197,13,227,14,
+34,14,67,14,93,14,139,14,183,14,210,15,17,15,71,15,141,15,166,15,196,15,243,
+16,57,16,121,16,170,16,213,16,255,17,41,17,92,17,155,17,184,17,213,17,247,
+18,50,18,134,18,165,18,177,18,189,18,201,18,209,18,221,18,233,18,249,19,5,
+19,17,19,29,19,41,19,57,19,69,19,81,19,93,19,105,19,117,19,129,19,141,19,
+153,19,165,19,177,19,189,19,201,19,213,19,224,19,239,19,251,20,6,20,18,20,
+30,20,42,20,54,20,65,20,77,20,89,20,101,20,117,20,129,20,141,20,153,20,169,
+20,181,20,197,20,209,20,221,20,233,20,245,20,253,21,9,21,25,21,37,21,49,21,
+61,21,73,21,85,21,167,21,251,22,7,22,19,22,31,22,42,22,54,22,70,22,86,22,
+102,22,118,22,134,22,146,22,158,22,170,22,182,22,198,22,254,23,10,23,26,23,
+38,23,115,23,131,23,143,23,151,23,163,23,175,23,187,24,22,24,34,24,46,24,
+58,24,70,24,82,24,94,24,102,24,192,24,204,24,216,24,228,24,240,25,48,25,60,
+25,83,25,91,25,202,26,64,26,129,26,207,27,24,27,73,27,165,29,32,29,165,29,
+204,29,240,30,36,30,91,30,180,30,219,31,27,31,80,31,132,31,190,32,25,32,51,
+32,76,32,104,32,158,32,170,32,181,32,189,32,197,32,205,32,213,33,25,33,91,
+33,148,33,156,33,164,33,172,33,188,33,204,33,220,33,232,33,244,34,0,34,12,
+34,28,34,40,34,56,34,72,34,84,34,96,34,108,34,120,34,136,34,148,34,160,34,
+172,34,184,34,196,34,208,34,220,34,232,34,244,35,0,35,12,35,24,35,36,35,52,
+35,68,35,84,35,96,35,108,35,120,35,132,35,144,35,156,35,168,35,180,35,192,
+35,204,35,216,35,228,35,240,35,252,36,8,36,20,36,32,36,44,36,56,36,68,36,
+80,36,92,36,92,36,105,36,134,36,158,36,181,37,95,37,107,37,119,37,130,37,
+141,37,153,37,164,37,175,37,187,37,198,37,209,37,221,37,233,37,245,38,1,38,
+13,38,24,38,36,38,48,38,60,38,72,38,84,38,96,38,108,38,120,38,132,38,144,
+38,156,38,168,38,180,38,192,38,204,38,216,38,228,38,240,38,252,39,8,39,20,
+39,31,39,43,39,55,39,67,39,79,39,91,39,187,39,195,39,203,39,215,39,227,39,
+239,39,255,40,14,40,29,40,45,40,61,40,77,40,143,40,155,40,167,40,211,41,22,
+41,86,41,236,41,244,42,133,42,188,42,200,42,226,43,1,43,44,43,86,43,137,43,
+190,43,243,44,42,44,107,44,173,44,222,45,5,45,47,45,86,45,141,45,195,45,207,
+45,219,45,231,45,243,45,255,46,11,46,23,46,117,46,129,46,141,46,152,46,164,
+46,172,46,180,46,188,46,199,46,210,46,218,46,227,46,235,46,243,46,252,47,
+4,47,112,47,218,48,144,48,152,48,160,48,168,48,176,48,184,48,192,48,200,48,
+208,48,220,48,232,48,244,49,0,49,12,49,23,49,35,49,76,49,88,49,99,49,110,
+49,122,49,134,49,146,49,157,49,169,49,181,49,192,49,204,49,216,49,228,50,
+65,50,134,50,217,50,229,50,241,50,253,51,51,51,63,51,122,51,134,51,255,52,
+97,52,210,52,222,52,234,52,246,53,93,53,171,54,5,54,17,54,29,54,41,54,141,
+54,227,55,69,55,81,55,93,55,105,55,203,56,14,56,96,56,108,56,120,56,132,56,
+144,56,156,56,168,56,180,56,192,56,204,57,69,57,135,57,224,58,51,58,94,58,
+142,58,223,59,28,59,98,59,110,59,122,59,133,59,198,60,23,60,124,60,202,61,
+18,61,30,61,41,61,52,61,63,61,74,61,86,61,98,61,110,61,122,61,216,62,48,62,
+121,62,208,62,245,63,28,63,79,63,124,63,189,63,236,64,32,64,87,64,160,64,
+243,65,55,65,113,65,125,65,136,65,200,65,212,65,224,66,4,66,59,66,104,66,
+147,66,215,67,33,67,94,67,203,68,36,68,114,68,188,68,249,69,121,69,208,70,
+39,70,113,70,225,71,44,71,99,71,151,71,163,71,175,71,187,71,199,71,215,71,
+227,71,243,72,3,72,18,72,30,72,42,72,53,72,65,72,77,72,89,72,101,72,113,72,
+125,72,137,72,149,72,161,72,173,72,184,72,199,72,211,72,223,72,234,72,246,
+73,2,73,14,73,30,73,42,73,54,73,70,73,86,73,102,73,114,73,126,73,138,73,154,
+73,170,73,186,73,198,73,210,73,222,73,234,73,246,74,2,74,14,74,26,74,38,74,
+50,74,62,74,74,74,86,74,97,74,108,74,124,74,139,74,154,74,166,74,177,74,188,
+74,200,74,212,75,52,75,130,75,219,75,231,75,243,75,255,76,11,76,23,76,35,
+76,47,76,58,76,69,76,85,76,101,76,117,76,133,76,149,76,165,76,181,76,197,
+76,213,76,225,76,237,76,249,77,5,77,17,77,29,77,41,77,53,77,65,77,77,77,158,
+77,170,77,186,77,201,77,215,77,231,77,247,78,6,78,18,78,34,78,50,78,66,78,
+78,78,161,78,177,78,193,78,209,78,225,78,240,79,0,79,12,79,24,79,36,79,48,
+79,60,79,72,79,84,79,96,79,108,79,120,79,132,79,144,79,156,79,168,79,180,
+79,191,79,203,79,215,79,227,79,239,79,250,80,5,80,20,80,35,80,51,80,63,80,
+74,80,85,80,101,80,116,80,130,80,146,80,161,80,175,80,187,80,199,80,211,80,
+223,80,234,80,246,81,2,81,14,81,26,81,38,81,50,81,62,81,78,81,90,81,157,81,
+169,81,181,81,193,81,205,81,217,81,229,81,241,81,253,82,9,82,21,82,33,82,
+45,82,57,82,68,82,79,82,91,82,102,82,113,82,125,82,137,82,149,82,161,82,173,
+82,185,82,197,82,208,82,219,82,231,82,243,82,255,83,11,83,22,83,33,83,49,
+83,64,83,78,83,94,83,109,83,124,83,140,83,155,83,170,83,182,83,193,83,204,
+83,216,83,228,83,240,83,252,84,8,84,20,84,32,84,46,84,61,84,73,84,85,84,101,
+84,117,84,133,84,145,84,157,84,189,84,223,85,30,85,71,85,87,85,102,85,113,
+85,125,85,207,85,216,85,228,85,240,85,252,86,8,86,20,86,32,86,44,86,55,86,
+66,86,78,86,92,86,107,86,119,86,135,86,149,86,161,86,177,86,191,86,203,86,
+215,86,227,86,239,86,251,87,7,87,19,87,31,87,43,87,55,87,67,87,79,87,91,87,
+107,87,122,87,134,87,150,87,165,87,177,87,189,87,201,87,213,87,225,87,237,
+87,249,88,5,88,17,88,29,88,41,88,53,88,65,88,77,88,89,88,101,88,113,88,125,
+88,137,88,149,88,161,88,173,88,185,88,197,88,209,88,221,88,230,88,238,89,
+30,89,38,89,99,89,107,89,153,89,161,89,169,89,222,89,230,89,238,89,246,89,
+254,90,52,90,97,90,167,90,183,90,195,90,219,90,251,91,42,91,88,91,172,91,
+231,92,1,92,12,92,23,92,34,92,46,92,57,92,68,92,112,92,160,92,218,92,230,
+92,242,92,253,93,9,93,25,93,41,93,57,93,73,93,85,93,97,93,109,93,121,93,137,
+93,153,93,169,93,184,93,200,93,216,93,231,93,246,94,2,94,14,94,25,94,36,94,
+48,94,60,94,72,94,84,94,100,94,116,94,131,94,146,94,162,94,178,94,193,94,
+207,95,45,95,148,95,159,95,170,95,182,95,244,96,77,96,86,96,98,96,111,96,
+124,96,149,96,158,96,235,96,244,96,253,97,6,97,18,97,30,97,43,97,52,97,145,
+97,156,97,169,97,220,98,18,98,27,98,36,98,48,98,64,98,76,98,87,102,26,105,
+11,109,232,110,1,110,35,110,103,110,198,110,255,111,44,111,84,111,137,111,
+191,112,2,112,92,112,171,112,245,113,45,113,95,113,108,113,127,113,140,113,
+159,114,20,114,101,114,123,114,180,114,188,114,196,114,204,115,7,115,15,115,
+23,115,31,115,39,115,47,115,55,115,63,115,154,115,162,115,170,115,178,116,
+42,116,50,116,58,116,66,116,74,116,255,117,7,117,15,117,23,117,82,117,162,
+117,255,118,43,118,55,118,67,118,79,118,91,118,103,118,114,118,126,118,138,
+118,150,118,162,118,174,118,186,118,198,118,210,118,222,118,234,118,245,119,
+1,119,13,119,24,119,36,119,48,119,60,119,79,119,91,119,182,120,21,120,132,
+120,159,120,184,120,209,120,225,120,241,121,1,121,21,121,41,121,61,121,81,
+121,97,121,113,121,133,121,149,121,169,121,185,121,205,121,221,121,241,122,
+1,122,21,122,37,122,57,122,73,122,93,122,109,122,129,122,145,122,165,122,
+181,122,201,122,217,122,237,122,253,123,17,123,33,123,53,123,69,123,89,123,
+101,123,113,123,125,123,137,123,153,123,165,123,177,123,193,123,205,123,217,
+123,233,123,253,124,13,124,33,124,49,124,69,124,81,124,97,124,117,124,133,
+124,153,124,169,124,189,124,201,124,217,124,229,124,245,125,5,125,25,125,
+37,125,53,125,69,125,89,125,101,125,117,125,133,125,153,125,169,125,189,125,
+201,125,217,125,233,125,253,126,17,126,33,126,53,126,69,126,85,126,97,126,
+109,126,125,126,137,126,157,126,173,126,193,126,209,126,229,126,245,127,5,
+127,25,127,41,127,61,127,77,127,93,127,113,127,129,127,149,127,165,127,181,
+127,197,127,213,127,229,127,245,128,1,128,21,128,37,128,53,128,65,128,81,
+128,93,128,105,128,121,128,133,128,153,128,169,128,189,128,205,128,217,128,
+233,128,249,129,5,129,25,129,41,129,61,129,77,129,97,129,113,129,129,129,
+145,129,161,129,173,129,189,129,201,129,213,129,229,129,241,130,1,130,13,
+130,25,130,41,130,53,130,69,130,81,130,101,130,117,130,137,130,153,130,169,
+130,185,130,197,130,209,130,229,130,245,131,9,131,25,131,41,131,61,131,77,
+131,97,131,113,131,125,131,141,131,153,131,169,131,185,131,201,131,221,131,
+241,132,5,132,25,132,41,132,61,132,77,132,93,132,109,132,129,132,149,132,
+165,132,185,132,201,132,217,132,237,133,1,133,17,133,37,133,53,133,69,133,
+89,133,109,133,125,133,141,133,161,133,177,133,193,133,209,133,221,133,241,
+134,1,134,17,134,33,134,45,134,61,134,73,134,85,134,97,134,117,134,133,134,
+153,134,169,134,181,134,193,134,209,134,225,134,237,135,1,135,17,135,37,135,
+53,135,73,135,89,135,105,135,125,135,141,135,157,135,173,135,193,135,205,
+135,221,135,233,135,249,136,5,136,17,136,29,136,45,136,61,136,73,136,89,136,
+101,136,113,136,129,136,145,136,157,136,173,136,185,136,197,136,213,136,233,
+136,249,137,13,137,29,137,45,137,65,137,81,137,93,137,105,137,121,137,141,
+137,157,137,177,137,193,137,209,137,229,137,245,138,1,138,13,138,25,138,41,
+138,53,138,69,138,85,138,105,138,117,138,133,138,149,138,169,138,181,138,
+197,138,213,138,233,138,249,139,13,139,25,139,41,139,57,139,77,139,97,139,
+113,139,133,139,149,139,165,139,177,139,189,139,205,139,217,139,233,139,249,
+140,9,140,25,140,41,140,57,140,73,140,89,140,101,140,113,140,129,140,145,
+140,157,140,169,140,181,140,197,140,213,140,229,140,245,141,5,141,17,141,
+33,141,53,141,69,141,89,141,101,141,117,141,141,141,161,141,181,141,197,141,
+217,141,233,141,249,142,9,142,25,142,45,142,73,142,97,142,117,142,137,142,
+161,142,177,142,197,142,217,142,233,142,249,143,13,143,37,143,57,143,81,143,
+101,143,121,143,137,143,157,143,173,143,197,143,217,143,233,143,253,144,17,
+144,41,144,65,144,89,144,109,144,129,144,157,144,185,144,209,144,237,145,
+5,145,29,145,49,145,73,145,93,145,113,145,133,145,153,145,177,145,201,145,
+225,145,245,146,13,146,41,146,65,146,85,146,109,146,133,146,153,146,173,146,
+197,146,213,146,233,147,1,147,25,147,49,147,73,147,97,147,121,147,145,147,
+173,147,197,147,221,147,241,148,9,148,33,148,53,148,77,148,97,148,117,148,
+137,148,153,148,173,148,189,148,205,148,225,148,249,149,13,149,37,149,53,
+149,69,149,85,149,109,149,133,149,153,149,169,149,189,149,205,149,225,149,
+245,150,13,150,33,150,57,150,77,150,93,150,113,150,137,150,157,150,177,150,
+193,150,217,150,237,150,253,151,17,151,33,151,33,151,44,151,55,151,67,151,
+113,151,138,151,182,151,242,152,24,152,70,152,128,152,147,152,222,153,25,
+153,64,153,90,153,133,153,185,153,220,154,15,154,70,154,90,154,163,154,216,
+154,248,155,22,155,44,155,62,155,105,155,149,155,197,155,246,156,35,156,79,
+156,116,156,128,156,140,156,162,156,201,156,217,156,237,157,5,157,41,157,
+61,157,81,157,105,157,125,157,141,0,3,0,6,253,213,4,132,8,115,0,3,0,7,0,8,
+0,0,19,17,33,17,37,33,17,33,1,166,3,222,252,182,2,182,253,74,254,204,253,
+213,10,158,245,98,148,9,118,245,246,0,0,2,0,94,255,121,1,85,4,234,0,10,0,
+20,0,0,23,54,54,55,22,22,21,20,7,39,38,19,2,2,39,54,55,18,18,21,21,94,24,
+41,26,84,72,84,47,38,3,23,28,19,53,85,16,7,28,41,80,38,48,61,11,22,124,33,
+27,1,52,1,158,1,84,156,54,61,254,222,254,208,225,164,0,1,0,94,255,121,1,85,
+0,131,0,8,0,0,23,54,54,55,22,21,20,7,38,94,23,42,26,156,84,100,28,41,80,38,
+91,30,23,122,69,0,0,2,0,94,255,121,1,85,3,87,0,8,0,17,0,0,23,54,54,55,22,
+21,20,7,38,3,54,54,55,22,21,20,7,38,94,24,41,26,156,84,89,74,24,41,26,156,
+84,100,29,42,80,38,91,30,23,122,61,3,2,41,80,38,91,30,21,124,69,0,0,8,0,66,
+253,143,12,229,255,191,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,0,1,54,53,
+52,35,34,7,6,4,4,35,34,36,39,38,35,34,14,2,35,34,39,38,38,35,34,6,7,6,6,35,
+34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,23,22,51,50,62,2,51,
+50,23,4,33,50,36,37,54,51,50,22,21,20,7,37,41,5,12,8,124,8,20,50,132,254,
+14,254,35,198,224,254,135,169,25,11,10,32,44,56,34,76,78,52,38,19,45,92,51,
+57,73,34,77,81,72,64,46,42,23,26,59,70,112,113,31,55,34,65,84,33,46,34,27,
+15,9,25,1,49,1,236,226,2,45,1,238,54,32,37,45,166,250,62,2,48,251,160,3,72,
+253,208,4,96,249,112,254,123,124,43,9,16,42,124,69,62,71,10,49,59,49,112,
+74,37,92,93,103,82,134,119,107,142,35,99,59,72,66,73,122,194,57,65,122,51,
+62,51,11,137,85,127,14,51,31,128,161,242,0,255,255,255,236,255,245,4,57,5,
+192,2,38,3,211,0,0,0,7,3,100,1,94,255,165,255,255,255,236,255,245,4,57,5,
+154,2,38,3,211,0,0,0,6,3,212,0,0,0,2,0,139,253,232,6,176,2,184,0,49,0,62,
+0,0,1,22,21,20,6,7,21,20,6,6,4,35,34,38,53,52,55,7,7,38,53,52,55,54,55,23,
+6,21,20,22,51,50,54,54,55,38,39,6,35,34,38,53,52,54,54,51,50,22,23,54,5,50,
+55,46,2,35,34,6,6,21,20,22,6,116,60,149,100,102,194,254,251,119,175,196,14,
+48,224,19,47,83,213,66,40,150,134,107,227,183,49,2,10,157,134,117,139,84,
+136,69,114,199,41,97,254,77,96,114,29,85,101,43,42,83,53,117,1,158,31,52,
+60,109,52,26,129,220,170,101,201,184,102,71,25,122,30,34,57,30,57,106,34,
+160,45,150,167,66,119,78,87,75,58,145,119,104,204,124,234,188,56,163,45,96,
+143,71,64,96,41,75,79,0,0,5,0,70,255,133,4,88,4,139,0,11,0,21,0,31,0,41,0,
+42,0,0,23,38,39,54,0,55,22,22,23,20,7,0,1,54,54,55,22,22,21,20,7,38,1,54,
+54,55,22,22,21,20,7,38,37,54,54,55,22,22,21,20,7,38,1,181,47,26,109,1,51,
+124,24,32,1,7,254,186,254,210,29,50,32,102,86,103,117,1,47,29,51,32,102,86,
+103,100,1,7,29,51,32,102,86,103,100,253,134,123,38,62,232,2,89,226,17,60,
+30,20,14,253,154,1,236,51,96,48,59,75,16,27,148,86,253,142,51,96,48,59,75,
+16,28,148,77,54,51,96,48,59,75,16,28,148,77,4,90,0,0,6,0,70,255,133,5,180,
+4,139,0,11,0,21,0,31,0,41,0,51,0,52,0,0,23,38,39,54,0,55,22,22,23,20,7,0,
+1,54,54,55,22,22,21,20,7,38,1,54,54,55,22,22,21,20,7,38,37,54,54,55,22,22,
+21,20,7,38,55,54,54,55,22,22,21,20,7,38,1,181,47,26,109,1,51,124,24,32,1,
+7,254,186,254,210,29,50,32,102,86,103,117,1,47,29,51,32,102,86,103,100,1,
+7,29,51,32,102,86,103,100,251,29,51,32,102,86,103,100,252,59,123,38,62,232,
+2,89,226,17,60,30,20,14,253,154,1,236,51,96,48,59,75,16,27,148,86,253,142,
+51,96,48,59,75,16,28,148,77,54,51,96,48,59,75,16,28,148,77,54,51,96,48,59,
+75,16,28,148,77,4,90,0,255,255,0,33,253,149,3,38,5,123,0,38,2,15,50,0,0,39,
+1,120,0,41,1,153,0,6,5,229,0,236,0,1,0,81,255,134,1,90,1,163,0,16,0,0,1,6,
+6,21,20,22,23,6,6,35,34,38,38,53,52,54,55,1,90,49,65,61,53,9,77,51,38,58,
+32,122,87,1,117,54,170,54,28,35,17,61,76,38,66,31,77,236,93,0,0,1,0,84,254,
+202,1,211,1,62,0,9,0,0,37,6,6,7,38,38,53,55,54,1,1,211,125,156,45,26,31,4,
+58,1,28,195,123,243,139,9,49,27,29,221,1,37,0,2,0,139,0,0,6,178,2,125,0,19,
+0,32,0,0,1,23,6,7,6,4,33,32,38,53,52,54,51,50,22,21,20,6,7,36,37,52,38,38,
+35,34,6,6,21,20,22,23,54,6,125,53,39,47,99,254,78,254,117,254,198,247,238,
+145,120,143,21,5,2,230,252,223,57,100,58,65,125,81,242,228,16,1,106,42,85,
+45,99,91,128,157,145,207,180,144,33,119,13,10,85,71,105,58,44,72,34,85,91,
+3,64,0,0,5,0,78,253,93,4,154,4,166,0,54,0,66,0,67,0,68,0,69,0,0,1,22,21,20,
+6,6,7,6,0,21,20,23,54,36,51,50,22,21,20,6,6,35,34,38,39,6,7,39,54,55,38,53,
+52,54,55,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,7,20,22,23,54,3,50,54,
+54,53,52,38,35,34,3,22,22,3,1,5,3,174,23,35,57,66,246,254,254,27,143,1,6,
+135,143,153,129,223,121,129,196,59,73,98,60,98,89,36,102,86,115,163,94,152,
+82,68,130,89,37,81,74,44,122,140,187,163,135,32,102,189,93,128,81,245,253,
+60,171,150,2,199,254,27,2,184,31,33,33,50,39,26,99,254,240,164,80,65,180,
+172,169,158,111,186,107,105,97,89,146,44,159,124,96,134,127,234,86,26,172,
+99,87,191,119,69,78,64,31,16,75,128,163,13,86,251,229,64,108,70,64,94,254,
+244,65,67,6,72,249,65,138,0,0,4,255,235,3,169,1,115,5,127,0,21,0,29,0,30,
+0,31,0,0,19,54,51,50,22,21,20,6,35,34,39,20,7,6,7,54,53,52,39,54,55,22,23,
+22,51,50,55,38,35,34,19,3,68,100,97,39,67,116,92,44,40,11,22,31,7,43,24,21,
+24,43,26,48,126,41,22,67,86,46,54,4,165,168,68,37,83,101,10,71,29,37,4,49,
+52,74,95,59,27,68,72,11,63,68,254,199,1,191,0,3,255,231,3,169,1,133,5,123,
+0,40,0,41,0,42,0,0,19,34,39,20,7,54,53,52,39,54,55,30,2,51,51,39,38,53,52,
+54,51,50,22,23,7,38,35,34,7,20,31,2,54,55,22,21,20,6,6,7,3,146,41,27,67,7,
+43,17,26,46,26,31,20,4,10,17,75,46,23,44,40,19,39,38,37,44,78,21,2,72,41,
+6,70,120,13,51,4,39,6,126,6,61,40,74,95,46,38,105,36,14,12,26,29,52,98,21,
+35,28,18,24,78,24,4,1,20,21,15,12,40,40,27,103,1,187,0,4,255,118,3,232,1,
+138,5,201,0,24,0,45,0,46,0,47,0,0,3,52,54,55,39,38,35,34,7,38,53,52,54,51,
+50,23,22,51,55,7,7,35,6,6,7,5,34,38,39,55,22,51,50,54,55,38,39,38,53,52,55,
+23,22,21,20,6,7,19,107,84,77,41,27,24,55,25,20,56,42,45,75,74,48,60,28,49,
+2,109,147,1,1,37,18,79,21,13,61,26,59,76,18,32,21,22,56,23,36,99,238,41,4,
+5,80,128,36,12,8,30,13,25,30,38,26,26,4,75,3,18,122,74,9,38,19,32,15,69,55,
+67,35,39,30,37,25,75,99,34,93,130,20,1,225,0,0,6,255,143,3,157,1,195,5,210,
+0,6,0,28,0,50,0,58,0,59,0,60,0,0,3,55,22,23,6,6,7,1,34,38,39,55,22,51,50,
+55,38,39,38,53,52,54,55,22,23,22,21,20,6,37,54,51,50,22,21,20,6,35,34,39,
+20,7,6,7,54,53,52,39,54,55,22,23,22,51,50,55,38,35,34,19,19,63,46,27,38,10,
+23,14,1,19,19,76,22,12,62,26,112,40,20,32,22,28,28,9,13,36,99,254,135,99,
+97,40,67,117,91,44,39,12,24,28,6,42,20,24,22,45,26,47,126,42,20,69,89,18,
+87,5,101,59,17,41,13,34,10,254,132,38,19,31,14,124,46,56,39,29,23,28,12,38,
+37,91,42,93,130,243,167,69,37,84,99,10,76,24,38,3,70,32,70,98,57,29,63,76,
+12,64,67,254,166,2,53,0,0,3,254,245,4,2,1,185,5,9,0,23,0,24,0,25,0,0,1,6,
+35,34,39,6,6,35,34,38,53,55,23,50,54,54,55,23,21,20,22,51,50,55,5,19,1,185,
+64,96,61,37,44,118,74,105,109,1,79,128,148,81,45,28,40,22,50,60,254,188,44,
+4,196,174,74,35,23,23,40,11,1,14,35,55,11,18,28,46,105,215,1,7,0,4,255,93,
+3,108,1,45,5,51,0,22,0,30,0,31,0,32,0,0,19,34,38,39,55,23,55,39,38,53,52,
+55,23,7,22,23,54,51,50,22,21,20,6,39,50,54,55,38,35,34,7,23,19,80,118,79,
+46,7,116,35,22,18,47,26,19,10,4,88,73,37,80,116,97,50,83,48,39,63,73,97,101,
+52,3,128,30,31,25,24,43,124,96,35,46,9,85,15,104,74,98,64,30,66,75,54,22,
+29,71,119,77,1,199,0,0,4,254,115,3,213,1,102,6,153,0,33,0,45,0,46,0,47,0,
+0,3,54,55,23,22,21,20,6,7,7,6,6,7,22,51,50,36,55,22,21,20,6,4,35,34,38,53,
+52,54,55,54,54,55,38,55,21,7,7,47,2,52,54,55,23,7,3,17,93,25,25,12,6,15,11,
+144,42,86,38,74,234,79,1,3,62,11,47,254,248,105,138,201,14,6,49,144,127,11,
+152,6,35,1,6,14,22,28,28,21,79,6,57,27,16,205,89,73,15,49,19,37,13,29,23,
+23,20,13,13,13,20,25,22,29,18,6,49,10,42,60,23,142,8,43,173,7,71,146,200,
+22,28,7,92,18,253,220,2,196,0,0,4,255,108,3,68,0,128,5,198,0,20,0,27,0,28,
+0,29,0,0,3,34,38,39,55,22,51,50,55,39,38,38,53,52,54,55,23,22,21,20,6,19,
+6,7,38,39,55,22,3,19,46,18,60,24,10,42,32,118,45,24,19,33,24,22,35,24,97,
+50,19,31,35,21,55,30,60,3,3,88,26,18,25,8,136,49,34,66,24,20,23,11,101,65,
+37,92,129,2,10,29,28,28,22,57,33,253,209,2,130,0,0,3,255,144,3,148,0,150,
+4,145,0,8,0,9,0,10,0,0,19,23,20,7,6,7,7,55,54,7,39,148,2,47,95,67,53,10,149,
+47,7,4,95,22,53,19,40,21,18,87,46,163,253,0,0,4,255,145,3,129,0,144,5,5,0,
+20,0,30,0,31,0,32,0,0,3,54,55,38,53,52,54,51,50,22,21,20,7,23,6,6,35,6,35,
+34,38,55,52,35,34,6,21,20,23,55,54,7,3,111,79,35,69,75,38,25,40,11,43,3,37,
+39,68,49,27,32,172,39,14,25,69,4,5,61,1,3,201,19,27,38,56,49,77,50,59,33,
+33,2,31,25,85,27,161,65,22,9,44,26,9,16,197,1,132,0,0,3,255,144,254,126,0,
+150,255,73,0,8,0,9,0,10,0,0,23,23,20,7,6,7,7,55,54,39,23,148,2,47,95,67,53,
+10,149,47,15,193,22,53,19,40,21,18,87,46,50,203,0,2,0,90,255,121,1,99,3,133,
+0,16,0,25,0,0,1,6,6,21,20,22,23,6,6,35,34,38,38,53,52,54,55,3,54,54,55,22,
+21,20,7,38,1,99,49,65,61,53,9,77,51,38,58,32,122,87,205,23,42,26,156,84,100,
+3,87,54,170,54,28,35,17,61,76,38,66,31,77,236,93,252,95,41,80,38,91,30,23,
+122,69,0,255,255,0,94,255,121,2,134,1,135,0,38,0,5,0,0,0,39,0,5,0,148,1,4,
+0,7,0,5,1,49,0,0,0,3,0,113,255,111,2,252,4,139,0,31,0,42,0,43,0,0,37,54,53,
+52,38,39,38,38,53,52,54,54,51,50,23,22,21,20,7,38,38,35,34,6,7,22,23,22,22,
+21,20,7,7,54,54,55,22,22,21,20,7,39,38,3,1,156,14,64,92,79,78,108,177,100,
+150,88,28,62,61,95,71,94,161,34,29,39,183,122,70,207,24,41,26,84,72,84,46,
+47,48,249,84,28,40,64,51,43,111,73,95,195,117,94,30,37,59,54,57,42,124,101,
+18,17,83,126,80,86,140,238,41,80,38,48,61,11,22,124,33,34,4,217,255,255,0,
+68,252,82,4,172,2,184,2,38,0,73,0,0,0,7,0,82,1,173,248,198,0,3,0,111,255,
+80,3,90,2,155,0,61,0,62,0,63,0,0,55,54,55,55,38,39,46,2,53,52,62,2,51,50,
+30,2,21,20,6,7,38,38,39,54,55,53,38,39,38,35,34,14,2,7,30,2,23,22,23,54,55,
+62,2,55,22,21,20,6,7,14,5,7,5,3,111,71,89,27,3,3,29,42,22,47,82,109,62,35,
+59,44,24,13,12,19,25,17,13,4,8,22,28,27,31,59,61,56,23,16,48,70,46,19,20,
+25,29,50,103,94,31,30,57,39,63,98,86,82,96,119,79,1,90,64,10,30,30,9,2,3,
+20,49,55,29,52,116,98,64,18,38,57,39,23,50,19,6,11,9,18,28,5,7,8,8,18,34,
+48,31,37,56,40,14,6,5,7,7,13,19,16,2,34,36,46,50,4,5,9,10,14,20,28,18,100,
+3,75,0,255,255,255,228,255,150,1,238,6,134,2,38,0,39,0,0,0,7,0,83,0,112,1,
+87,255,255,0,100,255,150,1,109,7,71,2,38,0,39,0,0,0,7,0,84,0,114,1,161,255,
+255,0,70,253,252,3,87,4,161,2,38,0,72,0,0,0,7,0,84,1,133,254,251,255,255,
+0,144,254,8,1,150,5,194,0,38,0,39,0,0,0,7,0,85,0,96,255,58,255,255,0,68,253,
+132,4,172,3,174,2,38,0,73,0,0,0,7,2,7,0,233,254,201,0,3,0,157,255,150,1,109,
+5,194,0,16,0,17,0,18,0,0,1,21,20,3,7,2,3,39,52,54,55,22,22,23,7,23,22,3,19,
+1,66,14,94,13,43,1,65,70,3,6,64,55,1,11,72,19,2,170,128,198,254,173,17,2,
+206,1,218,26,65,77,14,13,22,208,47,10,220,2,108,249,212,0,255,255,0,143,254,
+82,5,200,3,68,2,38,0,110,0,0,0,7,1,121,1,146,255,243,255,255,0,86,255,150,
+2,250,4,255,0,38,0,71,31,0,0,7,1,122,255,192,1,16,255,255,0,143,255,150,5,
+200,4,135,2,38,0,110,0,0,0,7,1,122,1,52,0,152,255,255,0,143,255,150,5,200,
+4,224,2,38,0,110,0,0,0,7,1,124,1,43,0,222,255,255,0,128,253,80,4,243,3,112,
+2,38,0,45,0,0,0,7,1,121,1,134,1,1,0,5,0,128,253,80,4,243,3,112,0,43,0,44,
+0,45,0,46,0,47,0,0,1,34,7,7,38,38,53,52,54,51,50,30,2,51,51,55,7,6,35,6,4,
+6,6,21,20,22,51,50,55,23,6,4,35,34,0,53,52,54,54,55,46,2,9,2,3,1,138,97,80,
+48,12,18,138,110,88,170,172,176,95,32,102,58,61,54,128,254,217,224,123,230,
+234,253,248,23,150,254,253,120,254,254,234,126,222,127,13,188,64,1,28,253,
+196,2,121,53,2,97,50,29,11,43,25,77,94,45,53,45,4,157,9,9,105,156,190,101,
+162,171,57,69,83,74,1,2,244,128,251,192,49,5,60,10,1,15,250,119,2,19,253,
+86,255,255,0,128,253,80,4,243,4,209,2,38,0,45,0,0,0,7,1,120,1,33,0,239,0,
+4,0,70,255,150,2,249,3,148,0,27,0,28,0,29,0,30,0,0,33,34,38,53,52,55,22,22,
+51,50,55,38,39,39,38,38,53,52,55,30,3,21,20,6,7,6,3,3,21,1,64,125,125,36,
+51,131,97,136,142,32,53,70,31,25,108,31,70,60,40,38,34,149,92,9,68,62,66,
+42,42,40,42,91,97,128,54,74,38,100,36,84,151,132,114,47,30,113,65,80,3,148,
+252,48,46,0,255,255,0,70,255,150,2,249,4,225,2,38,0,47,0,0,0,7,1,120,0,37,
+0,255,0,3,255,186,253,250,2,146,3,30,0,25,0,26,0,27,0,0,19,34,38,39,55,22,
+51,50,54,55,38,39,38,38,53,52,54,55,30,3,21,20,2,6,19,3,198,49,170,49,28,
+112,81,154,218,58,27,35,72,65,63,56,15,52,52,38,121,211,46,168,254,94,77,
+38,68,23,183,175,66,63,124,151,51,52,63,28,56,137,143,139,58,159,254,239,
+151,4,192,250,220,0,255,255,255,186,253,250,2,146,4,127,2,38,0,49,0,0,0,7,
+1,120,255,217,0,157,0,4,0,139,253,232,7,178,2,184,0,67,0,68,0,69,0,70,0,0,
+33,39,23,20,6,4,35,34,38,53,52,54,55,23,6,21,20,22,51,50,36,55,2,53,52,54,
+55,22,23,23,22,51,50,55,54,55,62,2,51,50,23,6,7,22,22,51,38,39,38,53,52,54,
+55,30,3,21,20,6,7,34,38,39,7,6,6,19,19,21,4,146,75,1,160,254,234,148,175,
+196,15,25,75,23,150,134,152,1,46,51,134,60,74,9,13,29,62,60,115,66,12,12,
+51,41,39,24,28,20,28,60,101,165,94,23,53,41,72,62,9,28,25,18,48,30,132,192,
+110,18,17,150,140,58,4,38,126,230,146,201,184,59,105,101,18,90,56,150,167,
+148,108,1,37,98,53,86,44,72,66,150,19,21,19,39,171,87,23,15,60,199,47,34,
+84,141,106,32,45,92,35,60,118,113,106,47,33,162,57,37,51,33,26,29,2,164,253,
+32,96,0,255,255,0,139,253,232,7,178,4,85,2,38,0,51,0,0,0,7,1,124,3,195,0,
+83,0,5,0,139,253,232,8,91,3,63,0,42,0,52,0,53,0,54,0,55,0,0,1,34,38,53,52,
+54,55,23,6,21,20,22,51,50,36,55,2,53,52,54,55,22,31,2,18,36,51,50,22,22,21,
+20,6,4,35,34,39,22,21,20,6,4,1,32,37,38,38,35,34,4,7,22,19,19,21,1,254,175,
+196,15,25,75,23,150,134,152,1,46,51,134,60,74,8,33,36,10,206,1,73,135,63,
+175,124,159,254,191,179,206,183,5,160,254,234,3,74,1,11,1,24,62,174,84,101,
+254,236,146,168,101,146,253,232,201,184,59,105,101,18,90,56,150,167,148,108,
+1,37,98,53,86,44,60,175,15,3,1,14,251,102,143,53,125,193,115,50,43,41,126,
+230,146,2,180,175,108,121,200,176,28,2,163,252,133,46,0,255,255,0,139,253,
+232,8,91,4,160,2,38,0,53,0,0,0,7,1,120,4,38,0,190,0,5,0,87,255,150,5,191,
+5,94,0,32,0,42,0,43,0,44,0,45,0,0,33,34,46,2,39,55,23,23,54,55,2,53,52,54,
+55,22,23,23,7,19,22,23,21,0,51,50,22,22,21,20,6,4,39,32,37,38,38,35,34,4,
+7,22,1,1,21,3,43,125,240,106,193,60,21,240,70,60,59,133,65,71,25,28,20,55,
+37,20,3,1,35,200,58,170,134,161,254,190,156,1,11,1,24,62,174,85,101,254,230,
+152,154,1,154,254,227,15,20,99,43,71,52,12,78,70,2,208,161,69,78,14,99,81,
+63,47,254,166,172,142,1,1,52,94,148,56,126,193,114,156,175,108,121,205,185,
+14,2,223,252,73,46,0,255,255,0,87,255,150,5,191,5,94,2,38,0,55,0,0,0,7,1,
+120,2,164,0,250,0,5,0,128,253,83,5,9,4,27,0,43,0,44,0,45,0,46,0,47,0,0,1,
+34,36,53,52,55,46,2,53,52,54,54,51,50,22,23,7,38,35,34,7,20,22,23,54,55,22,
+21,20,6,7,14,2,21,20,22,51,50,54,55,23,4,9,2,3,2,250,240,254,223,167,63,118,
+70,94,151,83,72,118,90,35,120,74,126,136,168,150,150,208,23,68,90,188,210,
+101,233,227,141,235,122,23,254,229,253,221,254,181,2,131,49,253,183,240,201,
+231,177,19,88,118,65,88,190,119,62,74,65,37,75,121,159,24,90,70,31,34,42,
+70,36,74,142,161,88,147,159,29,28,69,157,6,100,249,204,1,251,253,113,255,
+255,0,128,253,83,5,9,5,124,2,38,0,57,0,0,0,7,1,120,0,48,1,154,255,255,0,139,
+255,150,5,161,6,34,2,38,0,169,0,0,0,7,3,104,4,150,0,19,255,255,0,139,253,
+241,5,161,5,60,2,38,0,169,0,0,0,7,1,125,1,230,255,250,255,255,0,68,253,132,
+4,172,3,167,2,38,0,73,0,0,0,7,2,25,0,144,254,235,255,255,0,68,253,132,4,172,
+3,88,2,38,0,73,0,0,0,7,1,122,255,236,255,105,255,255,0,68,253,132,4,172,3,
+158,2,38,0,73,0,0,0,6,1,124,226,156,0,3,255,239,254,218,1,193,3,158,0,11,
+0,12,0,13,0,0,49,34,53,53,52,51,33,50,21,21,20,35,3,17,17,17,1,175,18,18,
+228,17,122,17,17,122,17,3,158,251,60,0,255,255,0,139,255,150,6,97,5,158,2,
+38,2,3,0,0,0,7,1,120,3,38,1,188,255,255,0,68,253,132,4,197,4,115,2,38,0,111,
+0,0,0,7,1,122,1,110,0,132,0,4,0,35,255,150,3,252,5,94,0,31,0,32,0,74,0,75,
+0,0,33,34,36,53,52,54,55,22,22,51,50,55,39,3,38,2,53,52,54,55,22,23,23,7,
+19,22,18,21,20,6,7,6,7,19,46,3,53,52,62,2,51,50,23,7,38,35,34,14,2,7,30,3,
+23,22,22,21,20,14,2,35,34,38,53,54,54,55,54,54,3,1,207,130,254,214,20,13,
+80,243,110,220,222,23,62,26,46,62,73,19,18,36,54,27,25,28,41,32,230,180,18,
+54,77,49,23,28,46,57,30,55,13,33,9,14,12,33,31,26,4,19,47,46,43,14,11,8,44,
+69,85,41,25,22,54,100,35,16,23,76,24,16,36,102,20,18,24,40,121,1,110,132,
+1,80,62,67,78,16,75,53,115,46,254,241,208,254,175,48,57,88,42,34,106,2,143,
+1,10,22,37,29,24,55,47,32,57,14,10,18,29,35,18,9,9,7,10,10,7,20,11,18,57,
+52,38,24,17,5,37,24,11,22,1,63,0,5,0,68,253,132,4,67,5,194,0,34,0,35,0,36,
+0,37,0,38,0,0,5,3,2,2,53,52,54,55,22,22,23,7,23,19,18,21,20,6,4,35,34,38,
+53,52,54,55,23,6,21,20,22,51,50,54,54,3,1,1,19,3,247,52,87,55,64,70,3,6,64,
+48,4,67,40,158,254,236,147,175,196,15,25,75,23,150,134,97,210,160,164,253,
+18,1,147,159,111,1,75,2,8,1,153,65,69,76,15,13,22,208,42,32,253,161,254,207,
+179,127,230,145,201,184,59,105,101,18,90,56,150,167,68,118,6,119,248,37,5,
+226,249,187,0,3,0,139,253,143,3,154,3,47,0,35,0,36,0,37,0,0,1,6,7,38,39,38,
+53,52,54,55,54,54,51,39,38,35,34,6,7,39,54,54,51,50,22,23,22,22,23,7,34,4,
+7,23,23,22,19,19,1,59,57,80,1,20,18,40,25,113,236,180,43,128,94,48,89,52,
+67,54,155,86,46,89,52,67,107,54,78,217,254,216,114,14,27,39,158,145,253,220,
+45,32,158,225,207,45,39,98,53,35,34,62,214,71,81,33,138,151,65,69,91,122,
+41,209,39,39,94,145,200,4,190,252,107,0,255,255,0,68,253,132,4,72,3,48,2,
+38,0,186,0,0,0,7,1,120,0,127,255,78,0,5,0,139,255,150,2,219,3,168,0,20,0,
+31,0,32,0,33,0,34,0,0,1,52,54,55,30,2,21,20,6,7,6,35,34,38,53,52,54,55,38,
+38,3,20,22,51,50,54,55,38,39,6,6,19,19,21,1,34,31,24,92,175,119,96,43,86,
+116,115,136,97,105,32,19,57,94,85,55,130,33,42,189,76,90,113,95,2,226,32,
+56,10,32,153,207,84,61,212,30,57,135,123,96,193,100,19,48,254,116,73,82,60,
+31,202,147,71,155,2,47,252,28,46,0,5,0,70,253,252,3,87,4,150,0,28,0,41,0,
+42,0,43,0,44,0,0,1,34,38,39,55,22,51,50,54,55,39,7,6,6,35,34,38,53,52,54,
+54,51,50,22,18,21,20,2,6,3,34,6,6,21,20,22,51,50,54,55,38,38,3,3,19,1,139,
+66,204,55,29,110,139,154,220,56,2,4,55,141,75,118,137,84,136,69,79,145,96,
+130,210,12,42,83,54,118,108,51,85,72,35,144,54,129,118,254,96,83,48,67,38,
+181,175,17,3,53,61,145,119,104,204,124,142,254,251,128,145,254,232,156,3,
+170,63,97,41,74,80,17,30,134,174,1,18,250,224,6,154,0,0,4,0,68,253,132,4,
+172,2,184,0,45,0,46,0,47,0,48,0,0,5,38,39,46,2,53,52,54,54,51,50,22,23,7,
+38,38,35,34,6,6,7,22,23,22,22,21,20,6,4,35,34,38,53,52,54,55,23,6,21,20,22,
+51,50,36,54,1,1,5,4,97,52,56,154,154,79,132,201,79,69,70,19,73,15,26,25,54,
+162,124,17,59,166,157,112,226,254,190,136,175,196,15,25,75,23,150,134,109,
+1,15,193,253,100,254,160,1,236,98,9,5,12,51,116,91,94,241,175,95,83,21,20,
+12,113,162,76,54,23,22,82,93,94,212,134,201,184,59,105,101,18,90,56,150,167,
+79,122,2,147,251,250,99,255,255,0,68,252,76,4,172,2,184,2,38,0,73,0,0,0,7,
+1,123,0,165,253,237,0,4,255,212,3,152,1,94,5,34,0,7,0,15,0,16,0,17,0,0,1,
+23,20,7,6,7,55,54,55,23,20,7,6,7,55,54,19,3,1,92,2,47,120,206,9,148,190,2,
+46,125,199,7,178,34,46,4,109,21,52,21,55,64,87,43,224,22,56,21,53,56,82,54,
+254,232,1,136,0,4,255,143,3,125,1,72,5,11,0,36,0,47,0,48,0,49,0,0,19,34,38,
+53,55,52,35,34,7,39,54,51,50,21,20,7,54,55,38,38,53,52,54,51,50,22,21,20,
+7,22,51,6,6,35,39,6,6,55,52,38,35,34,6,21,20,23,55,54,7,3,34,6,45,8,19,14,
+54,17,61,44,53,8,72,51,40,36,77,42,26,44,8,32,31,2,39,41,28,41,115,160,21,
+23,18,27,80,4,5,37,28,3,125,35,4,54,30,27,21,80,74,25,29,18,38,22,45,31,46,
+79,61,69,36,16,5,32,24,2,41,66,213,27,44,23,9,46,29,9,16,202,1,142,0,4,0,
+0,254,238,1,117,0,17,0,8,0,17,0,18,0,19,0,0,5,23,20,6,6,7,7,55,54,55,23,20,
+6,6,7,7,55,54,39,19,1,116,1,40,170,63,85,6,195,141,1,23,128,124,83,6,195,
+40,47,90,13,32,32,63,18,26,67,56,168,13,25,29,53,37,27,67,56,56,254,226,0,
+5,255,234,3,157,1,95,4,155,0,7,0,8,0,9,0,10,0,11,0,0,1,23,20,7,6,7,55,36,
+7,39,35,23,1,93,2,47,112,214,10,1,3,63,27,100,227,4,115,22,51,21,54,65,87,
+86,174,254,254,0,0,6,255,198,3,101,1,96,5,11,0,22,0,33,0,34,0,35,0,36,0,37,
+0,0,3,54,55,38,53,52,54,51,50,22,21,20,7,23,6,6,35,39,6,6,35,34,38,55,52,
+38,35,34,6,21,20,23,55,54,7,3,51,19,58,105,87,76,78,41,31,39,9,64,3,38,41,
+25,52,104,38,27,32,254,21,23,18,27,80,4,5,44,34,200,34,3,173,19,58,34,63,
+49,77,69,62,27,25,4,32,24,2,52,59,27,190,27,43,22,9,46,29,9,16,206,1,146,
+254,90,0,4,255,234,255,33,1,95,255,246,0,7,0,8,0,9,0,10,0,0,5,23,20,7,6,7,
+55,36,39,23,39,1,93,2,47,112,214,10,1,3,103,32,132,10,21,52,21,54,65,87,86,
+38,211,211,0,3,255,222,3,129,1,48,4,191,0,37,0,38,0,39,0,0,1,22,22,21,20,
+6,35,34,39,6,6,35,34,38,53,52,55,23,6,21,20,51,50,54,53,39,55,22,22,51,50,
+54,55,38,39,39,52,54,3,3,1,15,18,15,59,40,42,23,14,50,27,36,47,23,27,6,43,
+21,28,3,43,8,35,33,11,22,2,3,25,3,30,111,30,4,171,36,70,16,47,68,30,35,36,
+46,44,38,46,5,22,27,51,30,26,64,27,64,43,15,8,18,56,16,17,34,254,219,1,62,
+0,4,255,252,3,140,1,10,4,190,0,19,0,31,0,32,0,33,0,0,1,20,14,2,35,34,46,2,
+53,52,62,2,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,7,3,1,10,21,36,49,
+30,29,50,35,20,20,35,50,30,29,49,36,21,78,32,25,26,33,30,28,27,31,48,9,4,
+34,31,49,32,18,18,32,48,30,31,47,32,18,18,32,46,32,29,30,30,29,26,32,32,122,
+1,50,0,0,3,255,116,4,107,1,126,5,47,0,15,0,16,0,17,0,0,19,34,39,7,39,54,51,
+23,22,51,50,54,55,23,6,6,7,55,194,94,117,98,25,121,14,36,119,52,35,101,28,
+16,40,111,93,1,4,127,44,48,42,98,5,29,23,14,44,42,53,20,196,0,0,3,255,242,
+4,4,0,248,5,166,0,26,0,27,0,28,0,0,19,55,52,38,35,34,6,7,22,51,50,55,7,6,
+6,7,39,55,38,53,52,54,51,50,21,20,7,7,3,171,1,15,11,32,52,12,32,65,37,64,
+4,85,109,59,5,81,75,97,54,80,14,73,20,4,252,8,9,17,46,31,41,13,78,22,45,32,
+79,46,13,69,58,103,76,27,28,208,1,133,0,3,0,48,254,206,1,54,0,92,0,26,0,27,
+0,28,0,0,23,55,52,38,35,34,6,7,22,51,50,55,7,6,6,7,39,55,38,53,52,54,51,50,
+21,20,7,39,19,232,2,15,11,32,53,11,31,62,45,60,5,89,96,68,4,80,74,98,53,79,
+13,98,35,58,9,9,16,45,31,41,13,79,23,39,37,80,45,16,66,60,101,75,27,29,161,
+254,144,0,0,3,255,226,253,231,0,76,255,251,0,12,0,13,0,14,0,0,23,22,22,21,
+20,7,39,52,39,38,53,52,54,19,3,45,16,15,53,13,34,6,41,11,4,35,78,130,99,101,
+74,4,178,139,26,20,40,62,254,23,2,20,0,4,255,250,3,167,1,166,5,123,0,25,0,
+36,0,37,0,38,0,0,1,6,7,7,22,22,21,20,6,35,34,38,53,52,55,38,35,54,54,51,23,
+54,54,51,50,22,5,20,22,51,50,54,53,52,38,39,6,23,19,1,166,131,94,5,42,50,
+92,49,36,47,10,40,36,4,46,48,28,61,126,44,32,39,254,210,26,27,21,31,59,35,
+11,33,7,5,30,23,65,3,18,60,37,56,93,83,73,35,26,6,37,28,2,61,71,33,224,32,
+52,27,11,32,48,8,18,205,1,212,0,3,0,21,4,9,1,104,5,75,0,14,0,15,0,16,0,0,
+1,6,6,35,34,38,38,53,52,54,51,22,51,50,55,3,19,1,104,17,89,66,48,74,45,30,
+18,20,105,100,33,139,20,5,19,121,125,50,97,48,23,34,167,167,254,240,1,66,
+0,3,0,53,3,159,1,206,4,65,0,8,0,9,0,10,0,0,19,55,50,37,20,6,7,6,6,23,39,53,
+17,106,1,30,21,14,81,236,146,6,3,179,70,22,23,43,2,9,15,20,162,0,0,3,0,60,
+2,121,1,167,4,14,0,22,0,23,0,24,0,0,1,22,22,21,20,14,2,7,6,7,38,38,39,55,
+54,51,50,22,22,23,54,54,3,3,1,123,17,27,15,27,38,22,38,62,36,74,51,31,20,
+16,27,45,58,28,9,61,73,27,3,220,2,29,27,13,29,52,83,67,23,10,77,149,69,8,
+5,41,99,68,49,155,254,188,1,149,0,3,0,60,2,164,1,167,4,58,0,21,0,22,0,23,
+0,0,19,38,38,53,52,62,2,55,54,55,22,23,7,6,35,34,38,38,39,6,6,23,3,104,17,
+27,15,28,37,23,41,59,85,75,30,20,17,32,45,41,40,9,60,114,53,2,184,2,29,28,
+12,29,52,83,67,25,9,189,106,7,6,50,68,91,56,146,55,1,150,0,0,3,255,106,253,
+62,0,150,254,156,0,0,0,12,0,13,0,0,17,7,52,54,51,50,22,21,20,6,35,34,38,23,
+150,88,62,62,88,88,62,62,88,150,254,156,180,62,88,88,62,62,88,88,108,0,0,
+4,0,24,3,204,1,196,5,180,0,26,0,36,0,37,0,38,0,0,1,20,6,35,34,38,39,7,34,
+38,39,50,55,39,38,53,52,54,51,50,22,21,20,6,7,23,22,39,52,38,35,34,6,21,20,
+23,54,3,19,1,196,39,32,44,125,61,28,48,47,4,36,41,2,9,47,36,50,91,40,51,4,
+94,65,32,21,27,25,11,94,94,14,4,31,30,33,71,61,2,28,37,5,5,36,22,74,81,93,
+56,35,53,28,2,65,217,11,27,51,32,22,22,35,254,243,1,232,0,0,5,0,50,3,230,
+1,174,5,132,0,6,0,18,0,25,0,26,0,27,0,0,1,55,55,22,23,6,7,37,55,54,55,54,
+55,22,21,20,14,2,39,54,55,22,23,6,7,23,19,1,10,27,26,27,50,32,22,254,220,
+20,91,190,40,27,12,8,165,144,28,8,45,35,41,33,21,52,61,4,57,38,33,18,47,50,
+19,24,82,34,147,31,16,31,26,16,17,109,82,221,14,56,25,41,50,18,230,1,158,
+0,0,3,255,188,255,0,1,75,0,135,0,43,0,44,0,45,0,0,23,50,55,38,53,52,54,54,
+51,50,22,21,20,7,39,55,52,38,35,34,6,7,22,22,51,50,55,7,6,6,35,34,39,38,35,
+34,7,39,54,54,51,50,23,22,19,19,122,20,13,75,47,70,29,34,38,11,36,1,13,11,
+23,52,17,22,66,26,36,45,4,58,116,32,23,27,24,20,30,36,29,21,58,22,20,21,29,
+59,38,155,6,38,59,36,73,48,38,34,25,30,9,8,8,17,40,31,22,30,20,76,34,43,16,
+15,41,23,35,50,9,8,1,34,254,121,0,2,0,156,1,30,1,231,4,139,0,9,0,10,0,0,19,
+54,54,55,22,22,21,20,7,38,19,156,34,55,35,112,95,113,108,2,1,173,55,108,51,
+64,83,16,28,166,82,3,27,0,0,1,0,157,0,0,1,235,4,139,0,14,0,0,19,52,54,55,
+22,18,21,20,7,39,38,2,2,39,38,157,59,52,102,121,28,78,3,33,88,87,17,3,245,
+41,78,31,183,254,85,162,198,193,19,211,1,10,1,35,167,32,0,1,0,157,0,0,3,26,
+4,139,0,26,0,0,19,52,54,55,22,23,22,22,51,50,19,23,16,33,34,39,22,21,20,6,
+7,39,38,2,2,39,38,157,59,52,62,45,22,71,40,178,26,82,254,228,35,37,53,10,
+18,78,3,36,93,79,17,3,245,41,80,29,112,119,17,21,1,11,16,254,89,16,200,147,
+96,156,139,19,227,1,15,1,29,152,32,0,0,1,0,157,0,0,3,158,4,139,0,47,0,0,19,
+52,54,55,22,23,22,51,50,54,53,52,39,55,22,21,21,22,51,50,54,53,52,39,23,22,
+21,20,6,35,34,39,6,6,35,34,39,35,22,21,20,7,39,38,38,2,39,38,157,58,53,60,
+46,49,66,60,55,5,61,29,34,24,43,47,3,83,9,101,76,46,52,21,73,49,34,37,2,52,
+24,78,2,30,86,93,17,3,246,41,78,30,110,122,37,77,78,46,47,21,106,74,12,12,
+74,69,38,19,9,65,43,114,140,29,42,53,16,196,151,202,189,19,198,255,1,41,185,
+32,0,2,0,139,255,252,3,14,4,196,0,39,0,40,0,0,19,52,62,2,55,22,21,20,6,7,
+7,6,7,22,22,23,23,6,6,21,20,22,51,50,55,23,14,3,35,34,38,53,52,54,55,38,38,
+19,139,51,72,146,122,6,33,28,62,123,51,45,120,83,56,63,149,146,101,105,78,
+21,15,32,44,63,47,168,176,80,61,106,133,129,2,229,53,153,101,110,62,19,23,
+44,79,23,49,92,47,49,51,18,121,68,221,48,42,63,21,36,14,51,50,37,104,103,
+58,199,93,44,102,1,208,0,0,3,0,96,0,122,2,174,4,139,0,14,0,28,0,29,0,0,19,
+52,18,54,51,50,22,22,21,20,6,6,35,34,38,37,50,62,2,53,52,38,35,34,6,6,21,
+20,19,96,100,159,68,76,120,67,90,158,83,137,122,1,25,47,77,58,42,127,95,42,
+96,63,90,1,161,132,1,45,205,124,233,124,184,164,104,143,29,31,53,80,24,159,
+218,130,197,70,168,3,101,0,0,2,0,52,255,253,3,14,4,161,0,22,0,23,0,0,5,38,
+2,53,52,54,55,6,35,34,38,39,55,22,51,50,55,23,6,21,20,18,23,1,2,149,76,72,
+26,8,84,126,83,153,49,47,126,112,137,162,25,35,79,77,254,118,3,189,1,68,172,
+66,193,30,12,30,23,173,50,20,33,140,103,240,254,153,152,4,11,0,0,2,0,19,0,
+0,3,107,4,139,0,19,0,20,0,0,33,2,2,39,38,53,52,54,55,22,18,23,54,18,55,23,
+2,2,7,6,3,1,162,106,149,133,11,53,46,94,223,42,43,184,85,86,128,156,63,65,
+195,1,102,1,98,247,20,24,39,83,34,144,253,184,210,246,2,26,154,147,255,0,
+254,83,245,52,4,109,0,2,0,17,0,0,3,107,4,139,0,18,0,19,0,0,1,18,18,23,22,
+21,20,6,7,38,2,39,6,2,7,39,18,18,19,39,1,219,100,152,137,11,53,48,94,223,
+42,45,177,88,88,133,148,67,97,4,135,254,174,254,140,249,21,24,38,81,36,143,
+2,71,211,254,253,249,164,146,1,9,1,151,1,3,86,0,0,3,0,87,255,253,2,245,4,
+175,0,18,0,28,0,29,0,0,5,38,2,39,6,35,34,38,53,52,54,54,51,50,22,21,20,18,
+23,1,34,6,21,20,22,51,55,39,38,37,2,125,75,66,3,53,58,146,149,81,128,59,117,
+123,80,82,254,59,51,77,162,102,46,2,32,254,188,3,195,1,35,155,24,133,125,
+68,155,104,207,224,164,254,200,165,3,125,67,31,58,78,5,13,216,143,0,4,0,70,
+255,133,2,240,4,139,0,12,0,22,0,32,0,33,0,0,23,38,39,54,0,55,22,22,23,20,
+7,6,0,3,54,54,55,22,22,21,20,7,38,1,54,54,55,22,22,21,20,7,38,1,181,47,26,
+80,1,71,133,24,32,1,7,131,254,200,185,29,50,32,102,86,103,117,1,47,29,51,
+32,102,86,103,100,254,231,123,38,62,170,2,134,243,17,60,30,20,14,247,253,
+152,2,229,50,97,48,59,75,16,29,146,86,253,142,50,97,48,59,75,16,28,148,77,
+4,90,0,1,0,85,255,58,1,114,1,39,0,16,0,0,37,20,6,7,53,54,53,52,46,2,53,52,
+54,51,50,22,1,114,144,141,166,40,48,40,65,48,61,73,142,124,174,42,73,53,103,
+26,27,27,41,40,50,53,87,0,0,1,0,25,0,3,1,54,1,240,0,16,0,0,55,52,54,55,21,
+6,21,20,22,23,22,21,20,6,35,34,38,25,147,138,165,29,35,63,65,48,59,75,155,
+125,176,40,73,52,105,20,29,17,33,61,50,53,86,0,0,1,0,38,0,120,3,14,3,59,0,
+14,0,0,1,19,37,23,7,19,7,39,7,39,19,39,55,5,19,1,158,79,1,29,4,239,96,7,225,
+223,6,96,236,4,1,28,78,3,59,254,237,10,8,160,254,243,5,176,176,5,1,13,158,
+10,10,1,19,0,0,4,0,143,255,150,5,200,3,68,0,32,0,33,0,34,0,35,0,0,33,34,36,
+53,52,55,51,6,6,21,20,22,22,51,50,36,55,38,39,38,53,52,54,55,30,3,21,20,7,
+6,4,3,19,21,2,131,241,254,253,28,73,2,5,90,197,162,191,1,108,141,22,52,39,
+70,65,9,26,24,17,71,135,254,123,137,26,174,175,127,98,8,68,25,119,130,68,
+78,67,85,140,104,33,44,92,37,60,118,114,106,47,71,137,87,96,3,48,252,148,
+46,0,5,0,68,253,132,4,197,3,28,0,36,0,49,0,50,0,51,0,52,0,0,5,38,39,7,6,35,
+34,38,53,52,54,54,51,50,22,18,21,20,6,6,4,35,34,38,53,52,54,55,23,6,21,20,
+22,51,50,54,54,3,34,6,6,21,20,22,51,50,55,46,2,3,1,5,4,92,3,19,10,122,149,
+117,139,84,136,69,97,177,101,102,194,254,251,119,192,214,15,25,75,23,164,
+155,107,227,183,253,42,83,53,118,108,105,104,27,85,101,52,253,30,2,15,104,
+127,100,9,114,145,119,104,204,124,174,254,231,157,129,220,170,101,202,183,
+59,105,101,18,90,56,154,163,66,119,2,192,64,96,41,74,80,48,91,144,72,1,18,
+250,203,99,0,0,3,255,226,3,70,0,76,5,90,0,12,0,13,0,14,0,0,19,22,22,21,20,
+7,39,52,39,38,53,52,54,19,3,45,16,15,53,13,34,6,41,11,4,5,60,78,130,99,101,
+74,4,178,139,26,20,40,62,254,23,2,20,0,255,255,0,14,255,150,1,161,6,238,2,
+38,0,39,0,0,0,7,2,16,0,159,1,134,255,255,0,0,255,150,1,142,7,94,2,38,0,39,
+0,0,0,7,2,26,0,151,1,192,255,255,0,39,254,15,1,182,5,194,0,38,0,39,0,0,0,
+7,0,95,0,107,255,15,255,255,255,255,4,73,1,5,5,235,0,6,0,84,13,69,255,255,
+0,157,255,150,2,174,5,235,0,38,0,39,0,0,0,7,0,84,1,182,0,69,255,255,0,70,
+253,252,3,192,4,161,2,38,0,72,0,0,0,7,0,84,2,200,254,251,255,255,0,70,253,
+252,3,192,4,161,2,38,0,72,0,0,0,39,0,79,0,166,255,98,0,7,0,84,2,200,254,251,
+255,255,0,68,253,132,5,174,4,221,0,38,0,73,0,0,0,7,2,7,4,123,255,248,255,
+255,0,143,255,150,5,200,5,39,2,38,0,110,0,0,0,7,2,19,2,138,0,161,255,255,
+0,143,255,150,5,200,5,99,2,38,0,110,0,0,0,7,1,131,1,236,1,14,255,255,0,143,
+253,129,5,200,3,68,2,38,0,110,0,0,0,7,1,132,2,24,255,183,255,255,0,143,254,
+101,5,200,4,135,2,38,0,110,0,0,0,39,0,82,2,131,250,217,0,7,1,122,1,52,0,152,
+255,255,0,143,255,150,5,200,4,246,2,38,0,110,0,0,0,7,1,126,1,26,1,5,255,255,
+0,143,253,239,5,200,3,68,2,38,0,110,0,0,0,7,1,125,1,85,255,248,255,255,0,
+143,255,150,5,200,4,236,2,38,0,110,0,0,0,7,1,128,1,127,0,220,255,255,0,143,
+253,246,5,200,3,68,2,38,0,110,0,0,0,7,1,129,1,155,0,15,255,255,0,128,253,
+80,4,243,5,48,2,38,0,45,0,0,0,7,2,7,2,0,0,75,255,255,0,128,253,80,4,243,5,
+162,2,38,0,45,0,0,0,7,1,131,1,187,1,77,255,255,0,128,253,80,4,243,3,112,2,
+38,0,45,0,0,0,7,1,123,1,106,1,1,255,255,0,128,253,80,4,243,3,112,2,38,0,45,
+0,0,0,7,1,132,2,1,1,37,255,255,0,128,253,80,4,243,5,33,2,38,0,45,0,0,0,7,
+1,124,0,250,1,31,255,255,0,128,253,80,4,243,3,112,2,38,0,45,0,0,0,7,1,125,
+1,68,0,243,255,255,0,128,253,80,4,243,3,112,2,38,0,45,0,0,0,7,1,129,1,143,
+1,56,255,255,0,77,255,150,3,0,5,109,0,38,0,47,7,0,0,7,2,19,1,101,0,231,255,
+255,0,70,254,100,2,249,3,148,2,38,0,47,0,0,0,7,0,82,1,52,250,216,255,255,
+0,70,254,81,2,249,3,148,2,38,0,47,0,0,0,6,1,121,70,242,255,255,0,70,254,81,
+2,249,5,109,2,38,0,47,0,0,0,38,1,121,70,242,0,7,2,19,1,100,0,231,255,255,
+0,70,255,150,2,249,4,235,2,38,0,47,0,0,0,7,1,122,0,8,0,252,255,255,0,70,254,
+94,2,249,3,148,2,38,0,47,0,0,0,6,1,123,44,255,255,255,0,70,255,150,2,249,
+5,69,2,38,0,47,0,0,0,7,1,124,255,254,1,67,255,255,0,70,255,150,2,249,5,90,
+2,38,0,47,0,0,0,7,1,126,255,238,1,105,255,255,0,70,255,150,2,249,5,80,2,38,
+0,47,0,0,0,7,1,128,0,83,1,64,255,255,255,186,253,250,2,146,4,247,2,38,0,49,
+0,0,0,7,2,19,1,19,0,113,255,255,255,186,253,250,2,146,4,213,2,38,0,49,0,0,
+0,6,2,24,35,20,255,255,255,186,252,201,2,146,3,30,2,38,0,49,0,0,0,7,0,82,
+0,72,249,61,255,255,255,186,252,181,2,146,3,30,2,38,0,49,0,0,0,7,1,121,255,
+89,254,86,255,255,255,186,252,121,2,146,3,30,2,38,0,49,0,0,0,7,5,237,255,
+205,254,206,255,255,255,186,252,182,2,146,3,30,2,38,0,49,0,0,0,39,1,121,255,
+144,1,140,0,7,1,121,255,89,254,87,255,255,255,186,253,250,2,146,4,117,2,38,
+0,49,0,0,0,7,1,122,255,188,0,134,255,255,255,186,253,250,2,146,4,207,0,38,
+0,49,0,0,0,7,1,124,255,178,0,205,255,255,255,186,253,250,2,146,4,219,2,38,
+0,49,0,0,0,7,1,128,0,8,0,203,255,255,0,139,253,232,7,178,4,5,2,38,0,51,0,
+0,0,39,1,120,3,234,0,35,0,7,1,121,4,76,255,206,255,255,0,139,253,191,7,178,
+2,184,2,38,0,51,0,0,0,7,1,125,4,14,255,200,255,255,0,139,253,191,7,178,4,
+85,2,38,0,51,0,0,0,39,1,124,3,195,0,83,0,7,1,125,4,15,255,200,255,255,0,139,
+253,232,8,91,3,63,2,38,0,53,0,0,0,7,1,123,4,200,255,254,255,255,0,139,253,
+232,8,91,4,240,2,38,0,53,0,0,0,7,1,124,3,255,0,238,255,255,0,87,255,150,5,
+191,5,94,2,38,0,55,0,0,0,7,1,124,2,125,1,42,255,255,0,128,253,83,5,9,5,204,
+2,38,0,57,0,0,0,7,1,124,0,9,1,202,255,255,0,139,255,150,6,97,4,61,2,6,2,3,
+0,0,255,255,0,139,254,128,6,97,4,61,2,38,2,3,0,0,0,7,1,121,3,186,0,33,255,
+255,0,139,254,128,6,97,5,158,2,38,2,3,0,0,0,39,1,121,3,186,0,33,0,7,1,120,
+3,38,1,188,255,255,0,139,255,150,6,97,5,238,2,38,2,3,0,0,0,7,1,124,2,255,
+1,236,255,255,0,139,253,239,6,97,4,61,0,38,2,3,0,0,0,7,1,125,3,125,255,248,
+255,255,0,139,255,150,6,97,5,249,2,38,2,3,0,0,0,7,1,128,3,84,1,233,255,255,
+0,68,253,132,4,197,4,104,2,38,0,111,0,0,0,7,1,120,1,139,0,134,255,255,0,68,
+253,132,4,197,4,185,2,38,0,111,0,0,0,7,1,124,1,100,0,183,0,5,0,139,255,150,
+5,161,5,60,0,42,0,43,0,44,0,45,0,46,0,0,37,50,54,54,55,38,38,39,6,35,34,38,
+53,52,54,55,36,36,55,22,21,7,6,7,4,7,22,4,22,21,20,4,33,32,38,53,52,55,51,
+6,21,20,22,1,19,1,1,2,136,139,207,153,87,38,206,185,28,23,55,71,43,12,1,19,
+1,18,178,31,1,10,76,254,93,232,160,1,30,167,254,171,254,167,255,0,235,27,
+73,8,190,1,51,193,253,206,2,50,156,28,45,48,114,197,90,7,77,56,45,145,6,142,
+126,72,27,51,18,71,31,174,108,39,178,214,93,164,172,147,141,68,63,36,47,96,
+84,3,254,251,42,3,124,252,86,0,0,4,0,18,255,150,7,182,4,118,0,49,0,50,0,51,
+0,52,0,0,33,35,34,38,38,39,55,22,33,32,36,55,38,38,35,34,5,4,35,34,38,53,
+52,62,2,55,22,21,20,7,14,2,21,20,22,51,50,37,36,51,50,22,22,21,20,7,4,4,3,
+1,21,2,74,83,241,177,66,1,3,232,1,46,1,127,2,214,233,31,139,117,130,254,227,
+254,226,150,137,122,78,161,225,114,5,93,86,220,111,150,73,117,1,28,1,27,125,
+102,171,96,44,254,241,253,26,124,3,25,39,77,54,35,49,33,29,89,79,16,17,87,
+102,79,150,143,118,30,26,24,112,37,36,125,94,28,27,41,15,14,69,128,88,69,
+97,41,49,4,118,251,78,46,255,255,0,139,255,150,5,161,5,60,0,38,0,169,0,0,
+0,7,0,82,4,9,255,200,255,255,0,35,255,150,3,252,5,94,2,38,0,67,0,0,0,7,1,
+120,0,62,0,214,255,255,0,35,255,150,3,252,5,94,2,38,0,67,0,0,0,7,1,124,0,
+23,1,7,255,255,0,35,253,239,3,252,5,94,2,38,0,67,0,0,0,6,1,125,104,248,255,
+255,0,139,255,150,5,161,6,5,2,38,0,169,0,0,0,7,3,12,3,204,255,89,255,255,
+0,139,255,150,5,161,6,5,2,38,0,169,0,0,0,39,0,82,3,243,255,187,0,7,3,12,3,
+200,255,89,255,255,0,139,255,150,5,161,6,235,2,38,0,169,0,0,0,39,3,12,3,200,
+255,89,0,7,3,104,4,110,0,220,255,255,0,139,254,94,5,161,6,5,2,38,0,169,0,
+0,0,39,3,12,3,204,255,89,0,7,1,123,2,12,255,255,255,255,0,139,253,129,5,161,
+6,5,2,38,0,169,0,0,0,39,3,12,3,204,255,89,0,7,1,132,2,171,255,183,255,255,
+0,139,255,150,5,161,7,91,2,38,0,169,0,0,0,39,3,12,3,200,255,89,0,7,3,105,
+3,183,0,118,255,255,0,68,253,132,4,67,7,87,2,38,0,68,0,0,0,7,0,90,2,24,3,
+73,255,255,0,68,253,132,4,67,7,35,2,38,0,68,0,0,0,7,1,120,1,150,3,65,255,
+255,0,68,253,132,4,67,7,115,2,38,0,68,0,0,0,7,1,124,1,112,3,113,255,255,0,
+68,251,221,4,67,5,194,2,38,0,68,0,0,0,7,1,125,0,197,253,230,255,255,0,68,
+252,64,4,72,3,48,2,38,0,186,0,0,0,39,1,120,0,127,255,78,0,7,1,121,0,168,253,
+225,0,4,0,68,253,132,4,72,1,207,0,27,0,28,0,29,0,30,0,0,1,34,38,53,52,54,
+55,23,6,21,20,22,51,50,36,55,2,53,52,54,55,22,23,22,21,20,6,4,3,1,5,1,254,
+175,196,15,25,75,23,150,134,152,1,46,51,134,60,74,9,38,29,160,254,234,120,
+254,42,1,216,253,232,201,184,59,105,101,18,90,56,150,167,148,108,1,37,98,
+53,86,44,72,193,147,85,126,230,146,3,231,252,24,99,0,255,255,0,68,253,132,
+4,72,3,148,2,38,0,186,0,0,0,7,2,19,1,184,255,14,255,255,0,68,252,82,4,72,
+3,48,2,38,0,186,0,0,0,39,1,120,0,127,255,78,0,7,0,82,1,153,248,198,255,255,
+0,68,253,132,4,72,3,128,2,38,0,186,0,0,0,7,1,124,0,88,255,126,0,5,0,35,255,
+119,4,163,3,219,0,22,0,33,0,42,0,43,0,44,0,0,33,34,39,55,22,51,50,55,38,53,
+52,54,55,55,22,4,18,21,20,7,36,39,6,1,52,38,35,34,6,6,7,22,23,54,5,52,2,39,
+22,21,20,7,22,1,19,1,54,91,184,19,85,141,106,101,127,104,77,47,171,1,19,153,
+104,254,246,189,150,1,9,75,45,32,78,64,16,89,117,104,1,79,143,116,45,106,
+153,254,149,108,102,71,17,28,108,132,94,197,38,134,48,199,254,248,138,99,
+176,31,97,91,1,217,59,101,53,95,59,100,71,84,226,134,1,29,99,78,86,154,118,
+62,3,86,251,156,255,255,0,128,253,80,4,243,4,209,2,38,0,45,0,0,0,39,1,125,
+1,68,0,243,0,7,1,120,1,33,0,239,255,255,0,139,255,150,2,219,5,106,2,38,0,
+71,0,0,0,7,2,7,0,159,0,133,255,255,0,139,255,150,2,219,3,168,2,6,0,71,0,0,
+255,255,0,139,255,150,2,219,5,105,2,38,0,71,0,0,0,7,2,7,0,159,0,132,255,255,
+0,87,255,150,2,250,4,254,0,38,0,71,31,0,0,7,1,122,255,193,1,15,255,255,0,
+70,253,252,3,87,4,150,2,38,0,72,0,0,0,7,0,82,1,41,251,23,0,4,0,70,253,252,
+3,87,3,28,0,42,0,55,0,56,0,57,0,0,1,34,38,39,55,22,51,50,55,39,38,35,34,7,
+39,54,54,51,50,23,22,23,54,55,39,7,6,6,35,34,38,53,52,54,54,51,50,22,18,21,
+20,2,6,3,34,6,6,21,20,22,51,50,54,55,38,38,3,3,1,139,66,204,55,29,110,139,
+130,99,50,59,53,37,59,32,52,48,30,46,75,70,48,79,43,2,4,55,141,75,118,137,
+84,136,69,79,145,96,130,210,12,42,83,54,118,108,51,85,72,35,144,54,131,254,
+96,83,48,67,38,65,19,26,26,52,41,21,30,28,8,88,136,17,3,53,61,145,119,104,
+204,124,142,254,251,128,145,254,232,156,3,170,63,97,41,74,80,17,30,134,174,
+1,18,250,224,0,255,255,0,70,253,252,3,87,4,211,2,38,0,72,0,0,0,7,2,24,0,188,
+0,18,255,255,0,70,253,252,3,87,4,174,2,38,0,72,0,0,0,7,0,79,1,117,255,163,
+255,255,0,70,253,252,3,87,5,48,2,38,0,72,0,0,0,7,0,112,1,247,255,214,255,
+255,0,70,253,252,3,87,4,214,2,38,0,72,0,0,0,7,2,25,0,249,0,26,255,255,0,70,
+253,252,3,87,4,150,2,38,0,72,0,0,0,7,1,122,0,85,0,132,255,255,0,70,253,252,
+3,87,4,205,2,38,0,72,0,0,0,7,1,124,0,75,0,203,255,255,0,68,253,132,4,172,
+2,184,2,6,0,73,0,0,0,4,0,139,253,132,5,193,2,184,0,53,0,54,0,55,0,56,0,0,
+5,52,55,7,7,38,53,55,62,2,55,23,6,21,20,22,51,50,36,54,55,38,39,46,2,53,52,
+54,54,51,50,22,23,7,38,38,35,34,6,6,7,22,23,22,22,21,20,6,4,35,34,38,7,1,
+19,1,160,14,48,224,19,2,6,35,205,95,66,40,150,134,109,1,15,193,33,52,56,154,
+154,79,132,201,79,69,70,19,73,15,26,25,54,162,124,17,59,166,157,112,226,254,
+190,136,175,196,128,1,213,30,151,98,75,24,123,30,33,20,29,41,113,48,34,160,
+45,150,167,79,122,68,9,5,12,51,116,91,94,241,175,95,83,21,20,12,113,162,76,
+54,23,22,82,93,94,212,134,201,202,4,156,251,1,0,255,255,0,68,253,132,4,172,
+3,164,2,38,0,73,0,0,0,7,2,24,0,83,254,227,255,255,0,70,253,252,3,87,4,150,
+2,38,0,72,0,0,0,7,1,120,0,114,0,155,255,255,0,68,251,111,4,172,2,184,2,38,
+0,73,0,0,0,7,1,132,1,66,253,165,255,255,0,68,251,221,4,172,2,184,2,38,0,73,
+0,0,0,7,1,125,0,127,253,230,0,4,0,139,255,150,6,11,2,227,0,32,0,33,0,34,0,
+35,0,0,33,34,36,38,53,52,54,55,54,55,54,55,54,54,55,23,6,6,7,6,6,7,22,4,51,
+50,36,55,22,21,20,6,4,1,1,21,3,64,167,254,185,199,48,19,64,104,28,153,70,
+68,19,64,30,84,65,152,121,91,115,1,40,214,156,1,104,144,29,143,254,116,254,
+0,1,188,34,50,23,42,171,19,66,49,13,52,23,63,38,34,91,93,20,45,58,61,46,39,
+51,43,34,33,55,72,56,2,227,252,225,46,255,255,0,139,255,150,6,11,4,164,2,
+38,0,210,0,0,0,7,2,7,1,53,255,191,0,1,0,83,255,255,1,159,0,156,0,11,0,0,37,
+23,23,21,20,35,33,34,53,53,55,55,1,150,8,1,9,254,197,8,1,7,156,3,3,143,8,
+8,143,3,3,0,255,255,0,139,255,150,2,219,3,168,2,6,0,71,0,0,0,4,254,2,3,213,
+1,237,6,171,0,60,0,70,0,71,0,72,0,0,3,7,6,6,7,22,22,51,50,55,22,21,20,14,
+2,35,34,38,53,52,54,55,54,54,55,38,3,54,55,22,23,23,22,51,50,54,55,55,54,
+51,50,23,7,23,54,51,50,22,21,20,6,6,35,34,38,39,7,6,35,34,37,34,6,7,22,51,
+50,55,38,38,1,19,149,47,61,172,45,32,129,66,155,87,11,30,85,122,21,87,171,
+14,6,51,137,130,9,22,27,25,4,2,4,40,40,36,38,11,23,9,16,11,7,23,39,146,105,
+37,99,67,113,68,62,114,32,12,28,58,58,1,202,37,103,57,53,58,102,103,24,68,
+254,165,83,4,163,10,12,53,28,10,13,18,13,13,17,22,10,3,32,15,6,49,10,44,57,
+23,88,1,53,25,18,80,138,222,19,25,19,38,14,8,52,17,197,80,31,53,71,40,25,
+19,16,28,211,72,69,11,66,44,42,254,123,2,214,0,0,6,254,153,3,213,1,117,6,
+162,0,52,0,62,0,68,0,74,0,75,0,76,0,0,19,50,55,39,6,6,35,34,38,53,52,54,51,
+50,22,21,20,7,6,6,35,34,39,6,7,6,7,22,22,51,50,55,22,21,20,6,35,34,38,53,
+52,54,55,54,54,55,38,38,39,54,55,19,22,55,34,6,21,20,51,50,55,38,38,39,6,
+7,38,39,55,23,6,7,38,39,55,1,3,90,156,90,11,20,61,28,35,42,58,39,62,75,28,
+54,123,78,57,32,122,37,117,48,32,129,65,155,87,12,140,119,88,169,14,6,49,
+134,134,10,13,8,23,30,9,40,176,24,32,65,37,44,12,48,52,9,37,35,16,50,163,
+14,32,26,25,50,254,240,192,4,194,41,60,18,24,52,38,61,88,134,89,22,56,35,
+21,28,26,12,35,30,10,13,18,14,13,35,16,32,15,10,48,7,42,57,25,94,203,100,
+22,21,254,72,19,232,41,28,45,19,42,53,156,16,37,27,21,51,35,23,29,18,28,53,
+253,85,2,205,0,4,254,115,3,46,0,144,4,207,0,0,0,1,0,30,0,41,0,0,3,3,7,62,
+3,51,50,30,2,21,20,6,7,34,38,39,14,3,35,34,39,53,50,62,2,23,46,3,35,34,6,
+7,22,22,2,17,54,11,23,28,36,24,18,35,26,16,23,16,43,95,35,20,53,64,77,45,
+32,38,58,95,78,65,190,1,10,15,18,8,18,34,23,32,58,3,132,1,75,187,18,47,43,
+29,33,53,64,31,31,37,12,24,20,30,54,42,24,8,19,28,53,75,19,23,48,39,24,48,
+47,18,18,0,0,4,255,46,3,165,0,122,5,244,0,38,0,45,0,46,0,47,0,0,3,39,52,54,
+51,51,54,55,38,39,7,38,39,52,55,22,22,23,55,54,53,52,39,39,52,55,22,23,7,
+23,20,7,22,21,20,6,7,6,35,55,38,39,6,7,55,54,7,3,132,2,8,4,18,88,34,83,80,
+28,36,1,26,61,129,34,1,14,17,9,53,6,21,20,5,30,58,18,6,68,121,182,16,32,36,
+51,23,58,37,78,3,185,9,13,37,70,46,91,45,1,36,28,33,12,44,119,43,3,30,33,
+36,107,59,39,11,23,69,17,127,62,54,97,17,11,38,3,13,74,31,40,46,39,2,3,85,
+2,79,0,0,4,255,35,3,1,0,205,5,90,0,36,0,43,0,44,0,45,0,0,3,34,6,7,38,53,52,
+54,51,50,23,22,51,51,55,7,7,14,2,21,20,22,51,50,55,23,6,35,34,38,53,52,54,
+55,39,38,19,6,7,38,39,55,22,7,3,125,31,35,19,11,53,40,42,88,87,47,24,27,21,
+38,69,148,80,98,77,93,96,10,113,87,94,106,101,77,62,25,157,21,29,35,20,54,
+30,32,15,4,232,19,13,22,10,29,35,27,27,2,60,3,3,65,96,56,60,72,21,26,59,102,
+94,80,133,29,21,8,254,241,28,29,27,24,56,33,233,2,89,0,0,5,255,62,2,49,0,
+191,3,187,0,7,0,14,0,21,0,22,0,23,0,0,19,6,7,38,39,54,55,22,7,6,7,38,39,54,
+55,5,6,7,38,39,55,55,7,3,76,62,14,45,41,48,33,29,48,37,43,52,38,15,72,1,42,
+42,38,64,27,47,41,108,3,3,56,66,9,26,49,42,39,37,195,53,39,39,43,13,77,62,
+56,36,53,31,47,43,212,1,138,0,0,3,254,184,3,97,1,104,5,63,0,59,0,60,0,61,
+0,0,3,34,38,53,52,55,23,6,21,20,22,51,50,54,55,38,53,52,54,55,22,23,22,51,
+50,55,55,54,54,51,50,23,6,7,7,22,22,51,38,38,53,52,55,22,22,21,20,6,7,34,
+38,39,7,6,35,39,35,23,20,6,33,3,189,72,67,15,28,9,60,47,59,110,21,50,30,20,
+7,10,23,26,43,24,9,21,22,16,11,7,12,19,3,41,53,42,14,30,51,8,21,20,9,46,74,
+44,6,10,92,23,4,1,137,1,1,142,3,97,81,63,46,54,7,34,20,60,59,54,42,107,41,
+25,31,13,53,42,7,8,22,69,36,6,26,64,8,18,11,51,68,17,35,30,45,87,35,17,61,
+17,13,19,11,21,1,29,74,114,1,204,0,13,0,100,252,193,9,86,7,95,0,73,0,97,0,
+109,0,135,0,197,0,221,0,235,1,3,1,4,1,5,1,6,1,7,1,8,0,0,1,20,2,7,54,54,51,
+50,22,23,6,0,5,14,3,7,46,3,39,38,36,38,38,39,54,54,51,50,22,23,46,3,53,52,
+18,55,6,35,34,38,39,62,3,55,62,3,55,30,3,23,30,3,23,6,6,35,34,39,22,18,1,
+54,53,52,38,39,38,38,39,34,14,2,21,20,22,23,22,22,23,22,51,50,54,1,52,38,
+35,34,6,21,20,22,51,50,54,37,38,38,35,6,6,7,6,6,21,20,30,2,51,50,55,62,3,
+55,54,54,53,52,1,38,2,39,6,6,35,46,3,39,38,35,34,6,7,38,38,35,34,7,6,6,7,
+34,38,39,6,2,21,20,18,23,50,54,55,22,22,23,22,51,50,54,55,22,22,51,50,55,
+62,3,55,22,22,51,62,3,1,38,35,34,7,14,3,7,6,6,21,20,30,2,51,54,54,55,54,53,
+52,5,52,46,2,35,34,6,21,20,22,51,50,54,37,54,53,52,38,39,46,3,39,38,35,34,
+6,21,20,22,23,22,22,23,50,54,19,41,3,9,86,68,73,12,21,8,12,20,8,135,254,81,
+254,214,38,66,56,45,16,17,43,51,60,35,155,254,255,211,168,66,7,19,11,8,21,
+11,35,58,42,24,89,70,24,16,11,18,8,65,183,221,253,135,31,58,52,46,19,15,42,
+56,67,41,138,255,221,183,67,8,19,12,16,26,73,68,254,69,17,14,14,86,190,106,
+12,29,25,16,29,20,87,176,74,22,24,12,22,253,190,64,51,48,59,59,48,51,64,254,
+177,7,48,26,106,190,81,15,16,11,17,21,11,24,24,35,82,88,88,41,22,27,4,198,
+3,140,143,20,34,9,43,101,111,118,61,32,32,54,77,26,20,67,54,31,34,133,229,
+83,10,38,18,143,144,143,144,19,36,11,82,215,148,20,18,52,82,34,36,91,49,21,
+24,72,122,105,92,43,11,32,20,71,107,72,36,254,210,21,23,23,24,37,83,87,87,
+42,21,31,16,24,30,14,108,188,83,30,253,167,17,31,42,25,48,59,59,48,51,64,
+254,177,2,30,21,42,88,86,82,37,23,24,25,36,14,14,85,190,107,26,48,228,2,48,
+251,160,3,72,253,208,2,15,160,254,229,137,9,7,10,6,239,254,200,69,9,35,44,
+48,22,23,51,45,34,5,28,112,159,202,119,7,9,7,9,68,139,144,149,80,153,1,27,
+134,8,6,2,119,209,163,109,19,4,34,50,57,26,23,52,49,38,9,29,112,157,202,119,
+2,6,8,134,254,230,2,143,17,26,16,29,7,59,94,38,2,11,21,19,23,42,6,26,88,48,
+23,12,1,9,47,59,59,47,51,62,62,43,28,18,37,95,60,8,30,17,13,23,17,10,24,23,
+47,42,35,12,9,35,22,5,251,235,202,1,78,143,11,6,43,77,63,47,12,7,31,25,23,
+33,7,26,130,86,6,11,143,254,178,202,197,254,170,130,7,5,95,124,37,5,43,28,
+29,45,8,24,50,60,74,48,5,7,65,155,171,184,253,49,24,24,23,47,42,35,12,9,29,
+22,20,25,16,6,38,97,57,21,34,22,240,23,40,30,17,60,50,48,61,61,64,10,4,21,
+31,8,13,37,43,47,24,22,42,26,16,27,8,60,93,36,19,1,234,0,12,0,42,254,125,
+7,53,5,135,0,15,0,18,0,21,0,24,0,27,0,30,0,33,0,36,0,44,0,47,0,59,0,71,0,
+0,1,1,17,33,1,1,33,17,1,1,17,33,1,1,33,17,1,21,51,17,35,21,33,53,35,19,53,
+7,5,23,55,1,7,23,1,39,7,1,1,33,1,17,1,33,1,55,39,17,37,20,6,35,34,38,53,52,
+54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,7,53,254,250,254,137,254,247,
+254,250,254,137,254,248,1,8,1,119,1,6,1,9,1,119,251,68,245,245,4,123,247,
+247,247,254,10,174,175,252,212,173,173,3,44,175,174,2,237,254,176,254,36,
+254,177,1,79,1,220,1,80,236,171,254,57,108,77,74,110,110,74,77,108,63,71,
+51,50,69,69,50,51,71,2,2,254,247,254,140,254,248,1,8,1,116,1,9,1,9,1,116,
+1,8,254,248,254,140,253,176,245,4,122,245,245,251,134,245,245,65,174,174,
+3,43,174,174,3,43,176,176,254,113,1,80,254,176,254,36,254,178,1,78,238,174,
+254,164,174,77,108,108,77,77,108,108,77,51,71,71,51,51,71,71,0,4,255,145,
+3,138,0,111,4,168,0,0,0,1,0,13,0,23,0,0,25,2,34,38,53,52,54,51,50,22,21,20,
+6,39,50,54,53,52,38,35,34,21,20,46,65,65,46,49,62,62,49,24,37,37,24,61,3,
+138,1,30,254,246,56,62,62,56,61,57,57,61,53,30,35,35,30,65,65,0,0,4,255,145,
+3,58,0,111,4,168,0,0,0,8,0,20,0,21,0,0,17,53,34,53,52,51,50,21,20,39,50,54,
+53,52,38,35,34,6,21,20,22,19,111,111,111,111,32,29,29,32,33,28,28,33,3,58,
+20,158,158,158,158,53,49,56,56,49,49,56,56,49,1,37,0,3,255,90,3,137,0,172,
+4,214,0,30,0,31,0,32,0,0,3,62,3,55,46,3,35,34,6,7,38,38,53,52,54,51,50,30,
+2,23,14,3,35,35,23,17,166,52,81,62,47,20,17,26,27,30,19,35,48,14,4,8,57,63,
+28,46,42,43,25,15,45,66,89,57,8,108,3,195,4,18,33,52,38,4,4,2,1,19,16,5,15,
+12,27,45,4,8,12,8,48,85,62,36,20,1,77,0,0,3,255,126,3,15,0,138,5,31,0,30,
+0,31,0,32,0,0,3,6,7,52,38,53,52,55,54,54,55,39,38,38,35,34,7,39,54,51,50,
+30,2,23,7,34,6,7,23,22,23,3,68,16,35,11,26,64,44,61,15,28,28,13,27,36,25,
+44,62,19,29,30,35,26,29,62,90,53,12,12,102,45,3,57,17,25,81,105,33,16,62,
+17,7,3,18,41,26,48,12,105,28,42,48,21,79,11,19,73,63,52,1,230,0,3,254,184,
+253,240,1,104,255,206,0,56,0,57,0,58,0,0,3,34,38,53,52,55,23,6,21,20,22,51,
+50,54,55,38,53,52,55,22,23,22,51,50,55,55,54,54,51,50,23,6,7,22,51,38,38,
+53,52,55,22,22,21,20,6,7,34,38,39,7,6,6,35,39,23,20,6,19,19,189,64,75,15,
+28,9,60,47,61,110,19,50,50,7,11,28,20,43,24,9,19,22,19,10,7,19,14,65,70,14,
+30,51,8,21,22,7,44,70,49,7,5,58,39,27,1,138,105,153,253,240,74,70,42,58,7,
+34,20,60,59,57,40,105,42,39,30,53,42,7,8,22,66,39,5,42,56,30,51,68,17,35,
+30,45,86,36,16,64,15,12,22,13,9,12,2,29,75,114,1,184,254,72,0,0,3,254,252,
+3,184,0,242,4,89,0,18,0,19,0,20,0,0,19,34,38,39,7,39,54,54,51,50,23,22,51,
+50,54,55,23,6,6,39,7,69,38,92,63,122,14,26,104,11,17,67,66,41,52,70,34,14,
+43,97,99,3,3,204,32,26,65,20,26,72,26,26,33,24,23,41,52,141,161,0,0,6,0,43,
+255,63,1,84,3,133,0,23,0,33,0,34,0,35,0,36,0,37,0,0,23,34,38,39,55,22,51,
+50,55,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,3,34,6,21,20,22,51,50,55,
+38,3,19,19,3,166,25,77,21,12,42,51,117,45,1,18,65,30,48,51,68,44,55,76,102,
+41,26,44,47,41,48,40,35,78,17,2,13,43,30,19,27,16,135,7,18,27,53,47,67,96,
+122,78,86,134,1,98,52,23,29,30,18,116,254,8,4,70,254,38,254,22,0,0,3,0,88,
+255,63,2,108,3,133,0,28,0,29,0,30,0,0,33,34,38,53,52,54,55,54,55,55,54,55,
+23,6,6,7,6,6,7,22,51,50,54,55,22,21,20,6,6,7,19,1,93,92,169,17,8,26,38,69,
+43,16,25,11,29,29,66,36,34,76,158,56,142,51,12,44,154,74,6,27,14,14,67,5,
+26,18,24,14,34,14,29,40,8,21,17,23,32,20,16,14,13,16,28,24,193,4,70,0,0,3,
+254,238,3,129,1,1,4,186,0,27,0,28,0,29,0,0,3,34,38,53,52,54,55,54,55,55,54,
+55,23,6,6,7,6,6,7,22,51,50,54,55,22,21,20,6,7,19,13,92,169,17,8,22,42,88,
+26,13,25,10,30,29,62,32,42,72,163,56,141,51,12,190,79,5,3,149,27,14,14,67,
+5,24,20,32,12,28,14,29,40,8,20,14,27,32,20,16,15,12,36,32,20,1,57,0,0,4,255,
+68,3,72,0,172,5,56,0,24,0,31,0,32,0,33,0,0,3,34,38,53,52,54,55,23,6,21,20,
+22,51,50,54,55,38,53,52,55,22,22,21,20,6,3,6,7,38,39,55,22,3,3,49,72,67,3,
+11,28,8,59,48,60,111,18,48,48,8,22,134,20,14,37,38,15,52,43,28,16,3,92,81,
+63,23,31,46,7,40,14,60,59,55,41,106,42,39,29,55,90,43,74,114,1,130,22,34,
+32,18,56,43,254,99,1,240,0,0,7,0,42,255,132,3,235,5,20,0,8,0,17,0,24,0,31,
+0,38,0,45,0,46,0,0,5,33,55,17,39,1,1,7,17,19,1,1,23,17,7,33,39,17,55,7,17,
+33,17,39,9,3,23,17,33,17,55,7,17,35,17,39,55,23,39,7,23,17,51,17,3,3,235,
+252,63,195,195,1,224,1,225,196,130,254,97,254,98,179,136,2,230,136,89,127,
+254,119,128,1,68,1,6,254,250,254,251,106,1,54,32,76,222,75,186,141,141,140,
+62,155,77,124,221,1,246,219,1,226,254,30,219,254,10,2,209,1,160,254,96,202,
+253,232,157,157,2,24,202,145,253,82,2,174,145,1,68,254,188,1,5,254,251,118,
+253,102,2,154,118,82,253,134,2,122,82,189,189,144,144,70,253,159,2,97,254,
+100,0,4,255,122,253,48,0,134,254,110,0,3,0,7,0,8,0,9,0,0,19,7,39,55,23,39,
+7,23,53,3,134,134,134,134,83,83,83,83,3,253,203,135,135,133,133,83,83,84,
+247,254,194,0,0,4,255,122,3,159,0,134,4,241,0,3,0,7,0,8,0,9,0,0,19,7,39,55,
+23,39,7,23,21,17,134,134,134,134,83,83,83,83,4,57,134,134,134,134,82,82,83,
+71,1,82,0,3,255,106,3,112,0,150,4,226,0,11,0,12,0,13,0,0,3,52,54,51,50,22,
+21,20,6,35,34,38,23,19,150,88,62,62,88,88,62,62,88,150,3,4,26,62,88,88,62,
+62,88,88,108,1,114,0,0,3,255,126,253,56,0,138,255,52,0,29,0,30,0,31,0,0,3,
+6,7,52,38,53,52,55,54,54,51,39,38,35,34,7,39,54,51,50,30,2,23,7,34,6,7,23,
+22,19,19,68,16,35,11,26,72,70,28,38,26,21,27,36,25,44,62,19,29,30,35,26,29,
+53,101,52,13,12,72,30,253,98,17,25,81,105,33,16,62,19,8,49,36,48,12,105,28,
+42,48,21,79,10,19,74,63,1,158,254,46,0,255,255,0,70,255,150,2,249,5,78,2,
+38,0,47,0,0,0,7,2,25,0,172,0,146,255,255,255,186,253,250,2,146,4,216,2,38,
+0,49,0,0,0,6,2,25,96,28,255,255,0,156,1,30,1,231,4,139,2,6,0,96,0,0,255,255,
+0,157,0,0,1,235,4,139,2,6,0,97,0,0,255,255,0,157,0,0,3,26,4,139,2,6,0,98,
+0,0,255,255,0,157,0,0,3,158,4,139,2,6,0,99,0,0,0,1,0,157,0,0,3,132,4,156,
+0,44,0,0,19,52,55,22,23,22,23,51,38,53,52,54,54,51,50,23,7,38,35,34,6,7,20,
+23,54,55,22,21,20,6,35,34,39,22,21,20,7,39,38,38,39,38,38,39,38,157,111,78,
+49,49,67,1,49,56,94,55,83,95,47,69,58,27,49,38,168,81,79,14,182,123,75,77,
+46,26,78,2,25,26,23,67,68,17,3,248,86,62,140,147,27,9,38,64,53,114,70,133,
+48,46,19,20,133,14,24,41,36,30,78,87,23,186,137,189,204,19,183,237,100,100,
+179,137,32,0,0,3,0,96,0,15,3,66,4,174,0,21,0,39,0,40,0,0,1,52,55,30,2,21,
+20,6,6,35,34,39,6,35,34,38,53,52,19,55,38,3,20,22,51,50,55,55,20,22,51,50,
+54,53,52,2,39,6,2,1,1,59,42,205,188,84,57,101,65,88,61,54,82,110,120,166,
+68,15,139,82,61,99,12,73,59,63,53,74,184,153,103,136,1,36,4,22,84,68,188,
+242,239,140,99,176,99,75,75,184,166,224,1,18,110,28,253,138,72,111,149,39,
+87,101,88,61,106,1,51,143,119,254,225,2,164,0,0,1,0,122,0,0,3,79,4,137,0,
+35,0,0,55,54,54,55,55,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,7,20,
+22,23,55,54,55,22,22,21,20,7,6,6,7,122,83,96,87,4,112,141,76,132,83,69,128,
+99,38,93,66,45,71,111,55,158,155,8,96,161,8,14,118,186,224,136,99,160,147,
+106,5,28,142,87,96,182,109,64,85,71,35,13,33,39,119,120,7,5,69,73,12,60,18,
+58,78,123,236,233,0,255,255,0,19,0,0,3,107,4,139,2,6,0,103,0,0,255,255,0,
+17,0,0,3,107,4,139,2,6,0,104,0,0,255,255,0,90,255,253,2,248,4,175,0,6,0,105,
+3,0,255,255,0,139,253,232,7,178,4,85,2,38,0,51,0,0,0,39,1,124,3,195,0,83,
+0,7,1,121,4,75,255,195,255,255,0,139,253,232,8,91,4,160,2,38,0,53,0,0,0,39,
+1,120,4,38,0,190,0,7,1,121,4,223,255,243,255,255,0,128,253,83,5,9,5,124,2,
+38,0,57,0,0,0,39,1,120,0,48,1,154,0,7,1,121,1,143,0,233,255,255,0,111,253,
+141,3,90,2,155,2,38,0,33,0,0,0,7,1,130,0,167,255,137,255,255,0,139,253,143,
+3,154,3,47,2,38,0,69,0,0,0,7,1,130,1,26,0,55,255,255,0,35,255,119,4,163,5,
+150,2,38,0,190,0,0,0,7,2,25,1,16,0,218,255,255,0,143,254,93,5,200,3,68,2,
+38,0,110,0,0,0,7,2,23,1,10,0,8,255,255,0,143,254,82,5,200,4,225,2,38,0,110,
+0,0,0,39,1,121,1,146,255,243,0,7,1,124,1,42,0,223,255,255,0,143,253,233,5,
+200,3,68,2,38,0,110,0,0,0,7,1,127,1,73,255,204,255,255,0,143,253,233,5,200,
+4,125,2,38,0,110,0,0,0,39,1,127,1,73,255,204,0,7,1,122,1,52,0,142,255,255,
+0,143,254,93,5,200,4,144,2,38,0,110,0,0,0,39,1,123,1,123,255,254,0,7,1,120,
+1,82,0,174,255,255,0,143,254,21,5,200,3,68,2,38,0,110,0,0,0,7,5,238,2,71,
+0,106,255,255,0,143,255,150,5,200,4,231,2,38,0,110,0,0,0,7,2,24,1,155,0,38,
+255,255,0,128,253,80,4,243,4,198,2,38,0,45,0,0,0,7,1,122,1,4,0,215,255,255,
+0,128,253,80,4,243,3,112,0,38,0,45,0,0,0,7,1,127,1,50,1,55,255,255,0,77,253,
+129,3,0,5,109,0,38,0,47,7,0,0,39,2,19,1,101,0,231,0,7,1,132,0,208,255,183,
+255,255,0,70,254,20,2,249,3,148,2,38,0,47,0,0,0,7,5,238,0,249,0,105,255,255,
+255,186,253,250,2,245,3,30,0,38,0,49,0,0,0,7,3,207,0,180,253,17,255,255,0,
+139,253,232,7,178,4,96,2,38,0,51,0,0,0,7,1,128,4,24,0,80,255,255,0,128,253,
+83,5,9,5,114,2,38,0,57,0,0,0,7,1,122,0,19,1,131,255,255,0,128,253,83,5,9,
+5,225,2,38,0,57,0,0,0,7,1,126,255,250,1,240,255,255,0,128,253,83,5,9,6,77,
+2,38,0,57,0,0,0,7,1,131,0,202,1,248,255,255,0,139,254,93,6,97,4,61,2,38,2,
+3,0,0,0,7,1,123,3,163,255,254,255,255,0,139,253,233,6,97,4,61,2,38,2,3,0,
+0,0,7,1,127,3,113,255,204,255,255,0,139,255,150,5,161,6,125,2,38,0,169,0,
+0,0,7,3,109,3,197,2,40,255,255,0,139,255,150,5,161,6,98,2,38,0,169,0,0,0,
+7,3,106,3,225,0,106,255,255,0,139,253,233,5,161,5,60,2,38,0,169,0,0,0,7,1,
+127,1,220,255,204,255,255,0,139,253,143,3,154,4,144,2,38,0,69,0,0,0,7,1,120,
+0,44,0,174,255,255,0,139,253,143,3,154,3,47,2,38,0,69,0,0,0,7,1,121,0,228,
+0,65,255,255,0,68,252,75,4,72,3,48,2,38,0,186,0,0,0,39,1,120,0,127,255,78,
+0,7,1,123,0,145,253,236,255,255,0,68,253,132,4,72,5,9,2,38,0,186,0,0,0,39,
+1,120,0,127,255,78,0,7,2,19,1,180,0,131,255,255,0,68,253,132,4,72,4,231,2,
+38,0,186,0,0,0,39,1,120,0,127,255,78,0,7,2,24,0,197,0,38,255,255,0,68,253,
+132,4,169,5,194,2,38,0,68,0,0,0,7,3,207,2,104,0,0,255,255,255,186,253,250,
+2,146,5,80,2,38,0,49,0,0,0,7,1,131,0,115,0,251,255,255,255,186,253,250,2,
+146,4,163,2,38,0,49,0,0,0,7,0,84,0,236,254,253,255,255,0,139,253,232,7,178,
+4,214,2,38,0,51,0,0,0,7,1,131,4,132,0,129,255,255,0,128,253,80,4,243,3,112,
+2,38,0,45,0,0,0,7,2,19,2,151,252,151,255,255,0,128,253,80,4,243,3,112,2,38,
+0,45,0,0,0,7,3,107,1,248,252,41,255,255,0,139,253,232,7,178,5,57,2,38,0,51,
+0,0,0,7,3,107,4,104,0,16,255,255,255,186,253,250,2,146,5,179,2,38,0,49,0,
+0,0,7,3,107,0,86,0,138,255,255,0,128,253,80,4,243,5,73,2,38,0,45,0,0,0,7,
+2,19,2,93,0,195,255,255,255,172,255,150,1,108,5,185,2,38,2,5,0,0,0,7,3,99,
+255,88,255,159,255,255,255,170,255,150,1,108,5,186,2,38,2,5,0,0,0,7,3,100,
+255,125,255,159,255,255,0,68,253,132,4,172,3,183,2,38,0,73,0,0,0,7,3,99,0,
+212,253,157,255,255,0,68,253,132,4,172,3,188,2,38,0,73,0,0,0,7,3,100,0,252,
+253,161,255,255,0,68,251,10,4,172,2,184,2,38,0,73,0,0,0,7,3,108,1,52,247,
+149,255,255,255,255,253,252,3,87,4,150,2,38,0,72,0,0,0,7,3,99,255,171,254,
+45,255,255,255,255,253,252,3,87,4,150,2,38,0,72,0,0,0,7,3,100,255,210,254,
+45,255,255,0,167,255,150,6,39,4,150,0,38,0,210,28,0,0,7,3,99,0,87,254,124,
+255,255,0,167,255,150,6,39,4,151,0,38,0,210,28,0,0,7,3,100,0,126,254,124,
+255,255,0,128,253,80,4,243,3,112,2,38,0,45,0,0,0,7,3,108,2,36,251,81,255,
+255,0,139,253,232,7,178,4,202,2,38,0,51,0,0,0,7,3,108,4,153,254,219,255,255,
+0,139,253,232,7,178,4,94,2,38,0,51,0,0,0,7,2,25,4,113,255,162,255,255,0,35,
+255,150,3,252,5,94,2,38,0,67,0,0,0,7,2,22,0,34,0,148,0,1,255,220,255,163,
+0,36,5,111,0,3,0,0,19,17,35,17,36,72,5,111,250,52,5,204,0,1,255,37,255,163,
+0,219,5,111,0,14,0,0,23,35,17,7,39,55,39,55,23,55,23,7,23,7,39,36,72,134,
+49,171,171,49,170,170,49,171,171,49,134,93,4,161,136,49,169,168,49,171,171,
+49,168,169,49,136,0,1,255,220,255,163,1,174,5,111,0,10,0,0,1,7,39,55,33,17,
+35,17,33,39,55,1,174,217,49,137,254,246,71,1,81,137,49,4,152,214,49,130,251,
+46,5,25,130,49,0,1,254,81,255,163,0,35,5,111,0,10,0,0,23,35,17,33,23,7,39,
+55,23,7,33,35,71,254,246,137,49,217,217,49,137,1,81,93,4,210,130,49,214,215,
+49,130,0,18,0,98,254,218,4,94,3,158,0,0,0,1,0,9,0,17,0,25,0,33,0,41,0,49,
+0,57,0,65,0,73,0,81,0,89,0,97,0,105,0,113,0,121,0,129,0,0,1,17,19,20,35,34,
+53,52,51,50,5,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,
+52,51,50,17,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,7,20,35,34,53,52,
+51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,37,20,35,34,53,52,51,
+50,19,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,
+7,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,2,106,
+44,54,53,53,54,1,65,51,55,55,51,147,52,57,57,52,247,55,53,55,53,55,53,53,
+55,100,51,55,55,51,147,52,57,57,52,253,139,53,56,56,53,1,199,54,53,53,54,
+254,92,54,55,55,54,247,55,53,53,55,147,55,54,54,55,147,55,53,53,55,147,55,
+54,54,55,100,52,57,55,54,3,108,51,55,55,51,3,158,251,60,4,61,56,56,53,188,
+54,54,55,43,53,53,55,254,211,55,55,53,254,111,53,53,55,205,53,53,56,154,51,
+51,55,1,111,53,53,53,254,4,55,55,54,227,53,53,55,254,213,55,51,55,43,53,53,
+56,2,176,53,53,55,153,54,51,58,203,55,55,53,227,53,53,53,0,255,255,255,253,
+255,150,2,41,6,238,2,38,1,177,0,0,0,7,2,16,0,142,1,134,255,255,0,143,253,
+129,6,175,2,112,2,38,2,9,0,0,0,7,1,132,2,187,255,183,255,255,255,239,253,
+129,1,204,3,98,2,38,2,8,0,0,0,6,1,132,22,183,255,255,255,239,253,129,2,121,
+2,54,2,38,2,11,0,0,0,6,1,132,109,183,255,255,0,143,253,239,6,175,2,112,2,
+38,2,9,0,0,0,7,1,125,1,248,255,248,255,255,255,239,253,239,2,111,3,98,2,38,
+2,10,0,0,0,6,1,125,183,248,255,255,255,239,253,239,3,5,2,54,2,38,2,12,0,0,
+0,6,1,125,210,248,255,255,0,143,253,247,6,175,2,112,2,38,2,9,0,0,0,7,1,129,
+2,63,0,16,255,255,255,239,253,247,2,87,3,98,2,38,2,10,0,0,0,6,1,129,254,16,
+255,255,255,239,253,247,3,5,2,54,2,38,2,12,0,0,0,6,1,129,25,16,255,255,0,
+143,255,150,6,175,4,161,2,38,2,9,0,0,0,7,1,131,2,59,0,76,255,255,255,239,
+255,150,2,87,5,148,2,38,2,10,0,0,0,7,1,131,0,137,1,63,255,255,255,239,255,
+150,3,5,4,104,2,38,2,12,0,0,0,7,1,131,0,186,0,19,255,255,0,143,255,150,6,
+175,4,44,2,38,2,9,0,0,0,7,1,128,1,207,0,28,255,255,255,239,255,150,2,89,5,
+30,2,38,2,10,0,0,0,7,1,128,0,29,1,14,255,255,255,239,255,150,3,5,3,242,2,
+38,2,12,0,0,0,6,1,128,78,226,255,255,0,143,255,150,6,175,4,73,2,38,2,9,0,
+0,0,7,2,19,2,218,255,195,255,255,255,241,255,150,1,236,5,59,0,38,2,8,2,0,
+0,7,2,19,0,188,0,181,255,255,255,239,255,150,3,5,4,15,2,38,2,12,0,0,0,7,2,
+19,1,89,255,137,255,255,0,139,255,150,6,173,5,54,2,38,2,14,0,0,0,7,1,124,
+3,51,1,52,255,255,255,239,255,150,2,229,5,75,2,38,3,14,0,0,0,7,1,124,255,
+186,1,73,255,255,255,239,255,150,3,59,5,19,2,38,2,13,0,0,0,7,1,124,255,215,
+1,17,255,255,0,139,255,150,6,173,5,65,2,38,2,14,0,0,0,7,1,128,3,136,1,49,
+255,255,255,239,255,150,2,229,5,86,2,38,3,14,0,0,0,7,1,128,0,15,1,70,255,
+255,255,239,255,150,3,59,5,30,2,38,2,13,0,0,0,7,1,128,0,44,1,14,255,255,0,
+133,253,83,5,119,3,68,2,38,1,191,0,0,0,7,1,132,1,173,1,8,255,255,255,239,
+253,129,4,208,3,28,2,38,1,192,0,0,0,7,1,132,1,160,255,183,255,255,255,239,
+253,129,5,118,3,28,2,38,1,193,0,0,0,7,1,132,1,158,255,183,255,255,0,133,253,
+83,5,119,3,68,2,38,1,191,0,0,0,7,1,123,1,23,0,228,255,255,255,239,254,93,
+4,208,3,28,2,38,1,192,0,0,0,7,1,123,1,3,255,254,255,255,255,239,254,93,5,
+118,3,28,2,38,1,193,0,0,0,7,1,123,1,1,255,254,255,255,0,133,253,83,5,119,
+3,68,2,38,1,191,0,0,0,7,1,125,0,241,0,194,255,255,255,239,253,239,4,208,3,
+28,2,38,1,192,0,0,0,7,1,125,0,221,255,248,255,255,255,239,253,239,5,118,3,
+28,2,38,1,193,0,0,0,7,1,125,0,219,255,248,255,255,0,133,253,83,5,119,3,68,
+2,38,1,191,0,0,0,7,1,129,1,59,1,27,255,255,255,239,253,247,4,208,3,28,2,38,
+1,192,0,0,0,7,1,129,1,36,0,16,255,255,255,239,253,247,5,118,3,28,2,38,1,193,
+0,0,0,7,1,129,1,34,0,16,255,255,0,70,254,92,3,237,3,148,2,38,1,197,0,0,0,
+6,1,123,94,253,255,255,0,70,255,150,3,237,4,235,2,38,1,197,0,0,0,7,1,122,
+0,22,0,252,255,255,0,70,255,150,3,237,5,69,2,38,1,197,0,0,0,7,1,124,0,12,
+1,67,255,255,0,70,255,150,3,237,5,109,2,38,1,197,0,0,0,7,2,19,1,108,0,231,
+255,255,255,186,253,250,3,66,4,207,2,38,1,199,0,0,0,7,1,124,255,208,0,205,
+255,255,255,186,253,250,3,66,4,247,2,38,1,199,0,0,0,7,2,19,1,48,0,113,0,4,
+0,137,255,150,6,67,5,60,0,58,0,59,0,60,0,61,0,0,36,21,21,20,35,34,38,39,6,
+33,34,38,53,52,55,51,6,21,20,23,22,51,50,55,54,55,38,38,39,38,38,53,52,54,
+55,54,55,54,55,54,55,55,22,22,21,7,6,7,5,7,22,4,23,22,21,20,7,22,51,1,19,
+21,6,67,18,98,180,71,153,254,57,252,239,27,73,8,95,95,227,250,173,77,86,38,
+210,180,89,85,19,22,32,216,102,51,33,252,120,15,17,1,11,75,253,212,139,148,
+1,17,81,85,12,124,159,252,190,218,156,17,122,17,72,78,150,145,143,68,63,38,
+45,96,42,42,51,23,47,115,200,86,43,75,53,39,55,22,31,107,48,22,14,104,49,
+14,44,21,17,71,31,228,61,37,170,106,109,95,42,40,98,3,255,251,41,46,255,255,
+255,239,255,150,3,45,5,60,2,6,1,232,0,0,255,255,255,239,255,150,3,207,5,60,
+2,6,1,233,0,0,255,255,0,137,255,150,6,67,6,5,2,38,1,97,0,0,0,7,3,13,3,179,
+255,77,255,255,255,204,255,150,3,45,6,5,2,38,1,232,0,0,0,7,3,12,1,94,255,
+89,255,255,255,167,255,150,3,207,6,5,2,38,1,233,0,0,0,7,3,13,1,30,255,77,
+255,255,0,137,254,93,6,67,6,5,2,38,1,97,0,0,0,39,3,13,3,187,255,77,0,7,1,
+123,2,62,255,254,255,255,255,204,254,93,3,45,6,5,2,38,1,232,0,0,0,39,3,12,
+1,94,255,89,0,6,1,123,6,254,255,255,255,167,254,93,3,207,6,5,2,38,1,233,0,
+0,0,39,3,13,1,30,255,77,0,6,1,123,8,254,255,255,0,137,255,150,6,67,7,9,2,
+38,1,97,0,0,0,39,3,13,3,168,255,77,0,7,3,104,4,200,0,250,255,255,255,204,
+255,150,3,45,7,9,2,38,1,232,0,0,0,39,3,12,1,94,255,89,0,7,3,104,2,4,0,250,
+255,255,255,167,255,150,3,207,7,9,2,38,1,233,0,0,0,39,3,13,1,30,255,77,0,
+7,3,104,2,62,0,250,0,4,0,68,253,132,4,210,1,207,0,36,0,37,0,38,0,39,0,0,1,
+34,38,53,52,54,55,23,6,21,20,22,51,50,36,55,2,53,52,54,55,22,23,23,22,51,
+50,21,21,20,35,34,39,23,20,6,4,3,1,5,1,254,175,196,15,25,75,23,150,134,152,
+1,46,51,134,60,74,9,38,1,68,81,17,17,69,55,3,160,254,234,117,254,39,1,216,
+253,232,201,184,59,105,101,18,90,56,150,167,148,108,1,37,98,53,86,44,72,193,
+8,34,17,122,17,25,59,126,230,146,3,181,252,74,99,255,255,0,68,253,132,4,210,
+3,118,2,38,1,109,0,0,0,7,2,19,1,187,254,240,255,255,0,139,255,130,3,192,5,
+144,2,38,1,243,0,0,0,7,2,7,1,31,0,171,0,4,0,139,255,150,3,137,1,228,0,21,
+0,22,0,23,0,24,0,0,33,34,38,38,39,38,35,34,6,7,39,18,51,50,22,23,22,51,50,
+21,21,20,1,19,21,3,114,70,103,78,70,52,37,51,134,94,54,230,171,40,75,45,87,
+95,23,254,77,112,33,53,77,56,103,116,47,1,81,55,59,114,21,113,22,1,228,253,
+224,46,0,4,255,239,253,233,1,204,3,98,0,14,0,38,0,39,0,40,0,0,1,38,38,53,
+52,55,23,6,21,20,22,23,14,2,1,34,53,53,52,51,50,54,55,38,39,38,53,52,54,55,
+22,23,22,21,20,6,7,6,19,3,1,10,42,51,121,56,66,40,45,15,39,41,254,238,17,
+17,93,196,73,26,48,39,73,61,9,39,29,38,34,189,116,61,254,77,5,57,39,123,159,
+34,93,72,29,35,14,31,47,28,1,179,17,122,17,41,34,95,130,106,31,45,94,34,58,
+177,135,75,30,113,65,113,253,233,5,121,0,3,255,239,253,220,3,76,1,120,0,40,
+0,41,0,42,0,0,49,34,53,53,52,51,50,54,55,54,51,50,23,6,21,20,22,23,55,62,
+3,51,50,21,21,20,35,34,7,6,6,21,7,38,38,39,7,6,6,1,3,17,17,70,53,13,28,52,
+36,28,21,86,81,11,17,54,115,122,77,22,22,172,67,30,15,144,123,146,10,5,27,
+67,1,202,177,17,122,17,26,28,66,36,56,64,97,199,87,63,86,118,107,45,21,113,
+22,28,67,165,94,94,93,248,138,2,14,15,1,120,252,100,0,6,0,35,255,130,5,53,
+3,249,0,15,0,37,0,102,0,103,0,104,0,105,0,0,1,52,46,2,35,34,14,2,7,22,22,
+23,54,54,1,50,62,2,53,52,46,2,39,23,22,22,21,20,6,7,30,3,5,34,46,2,39,55,
+30,3,51,50,62,2,55,46,3,53,52,62,2,55,55,30,3,21,20,14,2,21,20,22,51,50,21,
+21,20,6,35,35,34,38,39,14,3,35,34,46,2,39,14,3,19,19,21,2,228,17,31,43,25,
+20,55,55,48,13,42,105,66,51,43,1,21,15,31,26,17,51,84,108,56,18,19,14,45,
+46,12,43,63,81,253,108,26,68,73,74,30,19,43,56,43,39,26,33,70,65,57,21,33,
+55,39,21,24,46,68,45,47,129,222,163,93,3,4,3,51,72,24,10,14,24,86,86,17,12,
+35,37,36,14,32,78,82,82,36,32,78,88,97,221,80,1,244,28,57,47,30,24,50,77,
+52,47,85,37,43,105,254,228,5,15,26,21,80,137,110,84,27,34,35,74,40,75,125,
+55,3,22,24,18,154,19,29,36,18,71,6,7,3,1,4,9,15,12,25,62,68,72,36,39,94,90,
+77,23,134,32,117,150,174,88,30,39,27,22,14,34,31,19,119,8,12,39,35,12,18,
+10,5,12,21,30,18,24,40,30,16,3,249,251,203,66,255,255,255,239,255,110,3,167,
+3,219,2,6,1,244,0,0,0,6,255,239,255,130,4,62,3,249,0,16,0,37,0,99,0,100,0,
+101,0,102,0,0,1,54,53,52,46,2,35,34,14,2,7,22,22,23,54,5,50,62,2,53,52,46,
+2,39,23,22,21,20,6,7,30,3,5,34,38,53,53,52,51,51,50,62,2,55,46,3,53,52,62,
+2,55,55,30,3,21,20,14,2,21,20,22,51,50,21,21,20,6,35,35,34,46,2,39,14,3,35,
+34,46,2,39,6,6,35,1,19,21,1,211,26,17,31,43,25,20,55,55,48,13,42,105,66,46,
+1,69,15,31,26,17,51,84,108,56,22,29,45,46,12,43,63,81,253,50,12,6,18,43,27,
+62,59,51,17,33,55,39,21,24,46,68,45,47,129,222,163,93,3,4,3,51,72,24,10,14,
+24,43,63,45,29,9,12,35,37,36,14,32,78,83,82,36,74,186,102,1,30,80,1,122,60,
+62,28,57,47,30,24,50,77,52,47,85,37,42,178,5,15,26,21,80,137,110,84,27,38,
+64,81,75,125,55,3,22,24,18,154,10,7,124,17,6,11,13,8,25,62,68,72,36,39,94,
+90,77,23,134,32,117,150,174,88,30,39,27,22,14,34,31,19,119,8,12,10,18,28,
+18,12,18,10,5,12,22,30,18,53,58,3,249,251,203,66,0,0,3,0,105,253,250,4,208,
+1,0,0,29,0,30,0,31,0,0,23,22,33,32,37,22,21,20,6,7,6,33,34,38,38,53,52,54,
+55,54,36,33,50,21,21,20,35,34,4,4,19,19,202,211,1,1,1,10,1,11,29,74,55,162,
+254,227,132,252,167,40,11,152,1,196,1,92,22,22,177,254,163,254,248,159,186,
+202,60,48,35,36,41,58,8,26,40,61,22,25,136,10,145,135,23,113,20,37,90,1,127,
+252,250,0,255,255,0,74,253,250,4,177,2,193,0,38,1,118,225,0,0,7,2,7,1,3,253,
+220,0,3,1,8,2,129,2,31,3,226,0,7,0,8,0,9,0,0,1,6,7,38,39,54,55,22,7,3,2,31,
+48,84,91,56,105,38,65,61,4,3,43,69,81,72,61,105,45,71,232,1,97,0,0,5,0,229,
+254,95,1,252,255,193,0,7,0,8,0,9,0,10,0,11,0,0,5,6,7,38,39,54,55,22,7,55,
+19,3,1,252,48,84,88,59,92,51,71,72,1,4,4,247,69,81,69,65,90,60,77,73,170,
+254,188,1,98,0,0,5,0,150,2,132,2,204,3,239,0,7,0,15,0,16,0,17,0,18,0,0,1,
+6,7,38,39,54,55,22,5,6,7,38,39,54,55,22,3,3,19,1,151,37,84,92,44,54,78,24,
+1,154,38,85,87,48,22,110,24,174,10,10,3,36,59,81,74,51,50,88,25,69,61,79,
+69,57,20,118,26,254,225,1,107,254,169,0,0,5,0,115,254,95,2,169,255,152,0,
+7,0,15,0,16,0,17,0,18,0,0,1,6,7,38,39,54,55,22,5,6,7,38,39,54,55,22,7,39,
+19,1,116,37,84,92,44,54,78,18,1,160,37,86,89,46,46,86,18,174,4,6,254,255,
+59,81,74,51,50,88,19,75,58,81,71,54,42,96,20,139,159,254,199,0,0,5,0,186,
+2,55,2,199,4,2,0,7,0,15,0,22,0,23,0,24,0,0,1,6,7,38,39,54,55,22,7,6,7,38,
+39,54,55,22,5,6,7,38,39,54,55,7,3,2,49,59,47,57,59,62,48,38,69,36,73,80,43,
+49,70,22,1,128,39,71,71,50,37,81,148,1,3,95,69,33,35,67,59,54,51,232,56,70,
+63,49,46,79,23,62,60,66,56,57,34,91,238,1,177,0,0,6,0,171,253,247,2,184,255,
+158,0,7,0,14,0,22,0,23,0,24,0,25,0,0,5,6,7,38,39,54,55,22,5,6,7,38,39,54,
+55,3,6,7,38,39,54,55,22,39,39,19,1,146,34,75,75,47,28,91,24,1,126,37,73,76,
+47,54,66,27,66,41,57,59,62,48,31,37,4,16,235,53,72,58,55,25,99,28,57,57,68,
+57,56,48,74,254,211,73,29,35,67,56,58,40,96,131,254,89,0,5,0,193,2,43,2,206,
+3,241,0,7,0,15,0,23,0,24,0,25,0,0,1,6,7,38,39,54,55,22,5,6,7,38,39,54,55,
+22,3,6,7,38,39,54,55,22,7,3,1,169,36,73,82,41,47,72,22,1,128,37,73,71,51,
+34,86,30,64,65,41,64,51,56,53,52,46,10,3,73,56,70,64,49,43,81,23,62,57,68,
+53,59,32,93,33,254,242,71,30,43,58,53,60,65,169,1,198,0,0,7,0,182,254,29,
+2,195,255,202,0,7,0,15,0,22,0,23,0,24,0,25,0,26,0,0,5,6,7,38,39,54,55,22,
+7,6,7,38,39,54,55,22,5,6,7,38,39,54,55,7,3,19,21,2,45,59,47,57,59,62,48,38,
+69,36,73,80,43,49,70,22,1,128,39,71,71,50,37,81,139,10,10,187,69,33,35,67,
+59,54,51,232,56,70,63,49,46,79,23,62,60,66,56,57,34,91,98,1,7,254,93,10,0,
+6,0,160,2,84,2,60,4,16,0,7,0,15,0,22,0,30,0,31,0,32,0,0,1,6,7,38,39,54,55,
+22,55,6,7,38,39,54,55,22,1,6,7,38,39,54,55,55,6,7,38,39,54,55,22,3,3,1,110,
+45,42,64,34,34,61,41,29,31,57,64,34,39,57,24,1,36,34,53,59,39,34,61,70,31,
+57,64,34,14,82,24,121,3,2,205,62,39,49,41,33,67,45,160,48,52,51,39,36,63,
+26,254,245,53,48,45,45,33,67,115,48,52,51,39,13,86,26,254,124,1,188,0,0,7,
+0,160,253,231,2,60,255,134,0,7,0,15,0,22,0,30,0,31,0,32,0,33,0,0,1,6,7,38,
+39,55,55,22,55,6,7,38,39,54,55,22,1,6,7,38,39,63,2,6,7,38,39,55,55,22,7,53,
+19,1,110,40,47,66,32,51,44,24,46,31,57,64,34,34,62,24,1,36,30,57,61,37,51,
+44,70,31,57,64,34,51,45,24,124,3,254,96,56,45,50,41,51,48,26,141,48,52,51,
+39,31,69,27,254,245,46,55,47,44,51,48,115,48,52,51,39,52,48,27,169,196,254,
+97,0,0,4,0,200,254,4,1,184,255,199,0,12,0,25,0,26,0,27,0,0,5,22,22,21,20,
+7,39,52,39,38,53,52,54,39,22,22,21,20,7,39,52,39,38,53,52,54,19,19,1,160,
+12,12,41,10,26,5,32,132,12,12,41,10,26,5,32,79,7,107,60,100,76,78,57,3,137,
+107,20,15,31,47,11,60,100,76,78,57,3,137,107,20,15,31,47,254,122,1,195,0,
+0,4,0,109,2,35,1,110,4,85,0,7,0,15,0,16,0,17,0,0,1,6,7,38,39,54,55,22,55,
+6,7,38,39,54,55,22,19,3,1,110,36,73,77,45,34,85,23,64,37,73,84,38,40,80,23,
+5,28,2,181,56,70,60,52,33,92,25,169,57,68,68,45,36,87,25,254,25,2,50,0,5,
+0,118,253,202,1,119,255,223,0,7,0,15,0,16,0,17,0,18,0,0,1,6,7,38,39,54,55,
+22,55,6,7,38,39,54,55,22,7,3,19,1,119,36,73,85,37,33,86,30,57,37,73,84,38,
+50,70,24,14,10,28,254,92,56,70,69,44,31,93,32,176,57,68,68,45,46,78,28,218,
+1,10,253,235,0,0,2,0,132,2,248,1,85,3,242,0,11,0,24,0,0,19,34,38,53,52,54,
+51,50,22,21,20,6,55,52,38,38,35,34,6,21,20,22,51,50,54,233,45,56,63,40,41,
+65,67,26,21,33,22,16,35,34,29,24,40,2,248,66,50,57,77,77,58,48,67,115,9,32,
+21,26,24,25,29,28,0,2,0,108,2,223,2,52,4,114,0,25,0,34,0,0,19,38,38,53,52,
+54,55,22,23,7,21,23,54,54,51,50,22,21,20,6,35,34,39,55,22,23,23,50,54,55,
+38,38,35,34,7,252,21,28,49,35,12,11,17,5,56,51,20,42,97,120,86,138,112,13,
+36,58,147,48,69,40,35,47,23,59,87,3,109,77,98,20,17,39,10,44,24,13,28,105,
+48,28,83,31,66,85,66,50,8,7,11,18,16,28,16,73,0,2,0,108,253,253,2,52,255,
+144,0,23,0,33,0,0,19,38,53,52,54,55,22,23,7,21,23,54,54,51,50,22,21,20,6,
+35,34,39,55,23,23,50,54,55,38,38,35,34,7,22,252,49,49,35,12,11,17,6,31,71,
+24,42,97,120,86,138,112,13,95,146,48,69,40,35,47,23,60,84,48,254,139,176,
+19,17,39,10,44,24,13,28,105,31,45,83,31,66,85,66,50,15,11,18,16,28,16,72,
+6,0,255,255,0,139,255,150,6,7,5,94,2,38,1,231,0,0,0,7,1,124,1,28,1,7,255,
+255,255,239,255,150,3,45,6,176,2,38,1,232,0,0,0,7,3,105,1,107,255,203,255,
+255,255,239,255,150,3,207,6,176,2,38,1,233,0,0,0,7,3,105,1,175,255,203,255,
+255,0,70,253,252,3,226,4,191,2,38,1,246,0,0,0,7,0,79,1,87,255,180,255,255,
+0,70,253,252,3,226,4,228,2,38,1,246,0,0,0,7,2,24,0,158,0,35,255,255,0,70,
+253,252,3,226,5,65,2,38,1,246,0,0,0,7,0,112,1,217,255,231,255,255,0,70,253,
+252,3,226,4,222,2,38,1,246,0,0,0,7,1,124,0,45,0,220,0,4,0,70,253,252,3,226,
+3,45,0,46,0,59,0,60,0,61,0,0,1,34,38,39,55,22,51,50,55,39,38,35,34,7,39,54,
+54,51,50,23,22,23,54,55,46,2,53,52,54,54,51,50,22,18,21,21,51,50,21,21,20,
+35,35,14,2,19,34,6,6,21,20,22,23,22,22,23,38,38,3,3,1,139,66,204,55,29,110,
+139,130,99,50,59,53,37,59,32,52,48,30,46,75,70,48,45,38,200,199,94,84,136,
+69,84,146,90,122,17,17,144,30,133,178,11,42,85,52,114,109,14,35,176,25,156,
+96,109,254,96,83,48,67,38,65,19,26,26,52,41,21,30,28,8,50,77,7,54,117,100,
+104,204,124,152,254,247,131,9,17,122,17,117,195,104,3,187,65,96,39,72,74,
+20,3,4,8,160,221,1,18,250,207,0,255,255,0,70,253,252,3,226,4,231,2,38,1,246,
+0,0,0,7,2,25,0,218,0,43,255,255,0,98,251,113,5,162,1,64,2,38,1,247,0,0,0,
+7,1,132,1,86,253,167,255,255,255,239,253,129,2,87,3,98,2,38,2,10,0,0,0,6,
+1,132,122,183,255,255,255,239,253,129,3,5,2,54,2,38,2,12,0,0,0,7,1,132,0,
+149,255,183,255,255,255,239,255,150,1,204,3,98,2,6,2,8,0,0,255,255,255,239,
+255,150,2,121,2,54,2,6,2,11,0,0,255,255,0,98,253,134,5,162,1,64,2,6,1,247,
+0,0,255,255,255,239,254,93,2,135,3,98,2,38,2,10,0,0,0,6,1,123,222,254,255,
+255,255,239,254,93,3,5,2,54,2,38,2,12,0,0,0,6,1,123,248,254,255,255,255,191,
+3,139,1,150,6,23,0,6,2,34,110,0,255,255,0,1,3,169,1,135,5,219,0,7,2,35,0,
+30,1,34,255,255,0,12,3,147,1,134,5,123,0,6,2,37,90,10,255,255,255,245,3,146,
+1,134,6,23,0,6,2,38,90,0,255,255,0,9,3,166,1,140,5,130,0,7,2,39,0,40,0,190,
+255,255,0,36,3,150,1,118,6,115,0,6,3,20,70,0,0,5,0,17,253,183,3,170,5,205,
+0,22,0,30,0,47,0,54,0,61,0,0,1,7,6,6,7,3,6,7,7,6,6,35,34,39,54,54,55,55,16,
+55,54,55,55,1,6,7,38,39,54,55,22,5,22,23,22,19,22,22,23,23,7,39,38,39,38,
+39,38,39,1,6,7,38,39,54,55,19,6,7,38,39,54,55,3,134,51,60,49,11,52,4,61,21,
+49,92,20,68,42,89,89,58,1,14,20,176,108,253,187,48,84,88,59,79,64,62,1,126,
+57,27,14,29,13,52,55,51,25,108,176,20,13,5,5,10,1,142,31,30,40,26,17,49,61,
+31,30,47,19,17,49,4,237,18,23,86,91,254,99,28,105,37,36,46,96,20,36,32,102,
+1,15,117,183,59,36,252,168,69,81,69,65,77,73,69,144,98,121,63,255,0,96,85,
+19,17,70,37,59,183,103,226,120,59,252,150,40,28,31,30,15,53,7,88,40,28,39,
+22,15,53,0,5,0,87,253,182,3,240,5,203,0,22,0,30,0,47,0,54,0,60,0,0,19,55,
+54,54,55,19,54,55,55,54,54,51,50,23,6,6,7,7,16,7,6,7,7,1,54,55,22,23,6,7,
+38,37,38,38,39,39,38,38,39,39,55,23,22,23,22,23,22,23,1,54,55,22,23,7,39,
+3,54,55,22,23,7,123,51,55,53,12,53,5,60,20,43,98,20,69,41,87,85,64,1,14,21,
+175,108,2,69,51,82,84,62,79,64,61,254,130,42,51,14,21,12,48,60,51,25,108,
+175,21,13,5,5,10,254,114,20,41,40,26,66,31,30,20,41,38,28,66,254,150,17,19,
+86,96,1,156,32,102,37,32,49,95,20,33,36,63,254,202,116,185,57,37,3,89,73,
+77,67,67,77,73,68,144,71,166,124,177,93,84,23,18,70,37,57,185,103,226,122,
+57,3,105,29,39,30,31,68,33,248,135,29,39,29,31,68,0,0,4,0,209,254,59,7,123,
+5,250,0,104,0,111,0,119,0,120,0,0,37,34,38,53,52,55,23,6,21,20,51,50,54,54,
+55,55,39,38,2,53,52,54,55,22,23,23,7,22,22,19,54,55,3,54,55,22,19,54,54,51,
+50,22,21,20,6,35,38,38,35,34,6,7,18,23,22,51,50,55,38,39,38,53,52,54,55,23,
+22,22,21,20,7,6,6,35,34,38,39,38,3,6,7,18,21,20,6,4,35,34,38,53,52,54,55,
+23,6,21,20,22,51,50,36,55,3,6,6,1,6,7,38,39,54,55,7,6,7,38,39,54,55,23,1,
+2,176,121,128,85,73,62,133,47,93,99,91,2,6,42,61,68,66,20,17,36,49,4,15,41,
+95,96,31,58,80,6,8,61,117,69,69,96,37,20,19,65,51,56,103,58,9,5,74,100,102,
+74,23,52,39,70,65,22,34,20,71,68,97,58,83,138,8,22,29,85,95,35,163,254,233,
+144,175,196,23,31,74,36,150,134,152,1,46,51,59,84,178,4,122,38,84,88,48,56,
+76,183,40,81,90,46,51,82,65,253,207,71,182,178,171,199,22,163,115,249,52,
+102,124,2,42,245,1,189,72,71,76,14,80,49,115,42,27,124,254,134,128,105,1,
+244,59,56,126,254,138,47,42,88,69,35,68,44,33,33,42,254,14,155,52,57,84,141,
+106,31,44,92,37,118,155,121,50,72,137,58,37,108,70,185,1,133,100,158,254,
+209,143,127,231,143,201,184,80,135,117,18,137,77,149,167,148,108,1,115,130,
+142,254,207,61,78,68,58,51,85,153,63,76,72,54,47,91,67,6,44,255,255,0,3,3,
+172,1,141,5,54,0,6,0,75,47,20,255,255,255,233,3,175,1,162,5,61,0,6,0,76,90,
+50,255,255,0,10,254,238,1,127,0,17,0,6,0,77,10,0,255,255,0,18,3,167,1,135,
+4,165,0,6,0,78,40,10,255,255,0,22,3,151,1,176,5,61,0,6,0,79,80,50,255,255,
+0,18,255,33,1,135,255,246,0,6,0,80,40,0,255,255,0,36,3,149,1,118,4,211,0,
+6,0,81,70,20,255,255,0,102,3,152,1,55,4,196,0,6,3,116,70,0,255,255,255,210,
+255,150,2,41,6,134,2,38,1,177,0,0,0,7,0,83,0,94,1,87,255,255,0,82,255,150,
+2,41,7,71,2,38,1,177,0,0,0,7,0,84,0,96,1,161,255,255,0,70,253,252,3,226,4,
+178,2,38,1,246,0,0,0,7,0,84,1,103,255,12,255,255,0,156,254,8,2,41,5,194,2,
+38,1,177,0,0,0,7,0,85,0,182,255,58,255,255,0,98,253,134,5,162,2,247,2,38,
+1,247,0,0,0,7,2,7,1,41,254,18,255,255,255,239,255,150,1,204,5,35,2,38,2,8,
+0,0,0,6,2,7,97,62,255,255,255,239,255,150,2,121,3,247,2,38,2,11,0,0,0,7,2,
+7,0,116,255,18,0,3,0,156,255,150,2,41,5,194,0,17,0,18,0,19,0,0,37,21,20,35,
+34,38,39,2,3,3,54,55,18,19,19,22,51,50,1,19,2,41,17,121,159,10,33,37,20,57,
+81,14,8,7,96,117,17,254,191,123,139,122,17,95,83,1,6,2,35,1,17,58,56,254,
+200,253,197,254,230,53,5,38,249,212,255,255,0,143,254,82,6,175,2,112,2,38,
+2,9,0,0,0,7,1,121,2,53,255,243,255,255,255,239,254,82,1,204,3,98,2,38,2,8,
+0,0,0,6,1,121,144,243,255,255,255,239,254,82,2,121,2,54,2,38,2,11,0,0,0,6,
+1,121,231,243,255,255,0,170,255,130,3,223,5,38,0,38,1,243,31,0,0,7,1,122,
+0,65,1,55,255,255,0,143,255,150,6,175,3,199,2,38,2,9,0,0,0,7,1,122,1,132,
+255,216,255,255,255,239,255,150,2,48,4,185,2,38,2,8,0,0,0,7,1,122,255,100,
+0,202,255,255,255,239,255,150,3,5,3,141,2,38,2,12,0,0,0,6,1,122,3,158,255,
+255,0,143,255,150,6,175,4,33,2,38,2,9,0,0,0,7,1,124,1,122,0,31,255,255,255,
+239,255,150,2,33,5,19,0,38,2,8,0,0,0,7,1,124,255,90,1,17,255,255,255,239,
+255,150,3,5,3,231,2,38,2,12,0,0,0,6,1,124,249,229,255,255,0,133,253,83,5,
+119,3,68,0,38,1,191,0,0,0,7,1,121,1,51,0,228,255,255,255,239,254,82,4,208,
+3,28,2,38,1,192,0,0,0,7,1,121,1,26,255,243,255,255,255,239,254,82,5,118,3,
+28,2,38,1,193,0,0,0,7,1,121,1,24,255,243,0,5,0,133,253,83,5,119,3,68,0,53,
+0,54,0,55,0,56,0,57,0,0,23,52,0,55,39,38,38,35,34,7,7,38,53,52,54,51,50,22,
+23,22,51,51,55,7,6,35,35,7,23,22,22,51,50,21,21,20,35,34,38,38,39,4,0,21,
+20,22,51,50,37,23,4,35,34,38,9,2,3,204,1,24,238,47,116,121,44,99,78,48,30,
+138,110,59,139,121,214,168,32,102,58,61,60,33,74,26,43,161,216,17,17,183,
+188,119,38,254,249,254,199,225,206,175,1,2,30,254,237,239,207,247,1,240,253,
+201,2,33,20,146,191,1,67,83,21,52,41,50,30,30,50,77,94,43,54,98,3,156,9,8,
+61,94,60,17,122,17,67,153,136,60,254,253,160,143,155,73,68,169,242,4,155,
+250,163,1,246,253,118,0,0,4,255,239,255,150,4,208,3,28,0,40,0,41,0,42,0,43,
+0,0,49,34,53,53,52,51,32,55,55,54,55,38,39,38,38,35,34,7,7,38,53,52,54,51,
+50,22,23,30,2,51,7,38,39,39,7,34,6,7,6,6,1,3,21,17,17,1,45,172,114,116,90,
+80,78,83,103,54,98,78,48,30,136,111,65,133,88,107,150,154,147,78,64,51,7,
+42,71,129,136,153,247,1,150,6,17,122,17,52,39,44,16,40,62,65,51,50,30,30,
+50,77,94,56,64,79,79,34,151,8,3,1,1,42,70,79,53,3,28,252,168,46,0,4,255,239,
+255,150,5,118,3,28,0,51,0,52,0,53,0,54,0,0,49,34,53,53,52,51,50,36,55,54,
+55,38,39,38,38,35,34,7,7,38,53,52,54,51,50,22,23,30,2,51,7,38,39,7,23,22,
+22,51,50,21,21,20,35,46,2,39,7,7,6,6,1,3,21,17,17,192,1,26,113,132,73,80,
+77,80,107,53,98,78,48,30,136,111,66,131,89,106,150,152,150,78,98,77,13,8,
+36,144,226,18,18,152,186,118,49,53,168,153,247,1,152,10,17,122,17,43,51,58,
+15,37,57,59,49,50,30,30,50,77,94,51,61,73,75,34,152,5,13,1,13,60,38,17,122,
+17,1,44,95,104,24,88,79,53,3,28,252,168,46,0,255,255,0,133,253,83,5,119,4,
+165,0,38,1,191,0,0,0,7,1,120,1,33,0,195,255,255,255,239,255,150,4,208,4,125,
+2,38,1,192,0,0,0,7,1,120,0,249,0,155,255,255,255,239,255,150,5,118,4,125,
+2,38,1,193,0,0,0,7,1,120,0,251,0,155,0,4,0,70,255,150,3,237,3,148,0,30,0,
+31,0,32,0,33,0,0,33,34,38,39,6,35,34,38,53,52,55,22,22,51,50,55,38,2,53,52,
+55,30,4,51,50,21,21,20,1,19,21,3,219,83,123,47,189,225,125,125,36,51,131,
+97,128,155,78,107,108,42,68,59,84,86,57,18,253,225,27,56,50,106,68,62,66,
+42,42,40,43,136,1,32,57,100,36,154,210,131,119,46,17,122,17,3,148,252,48,
+46,255,255,0,70,255,150,3,237,4,245,2,38,1,197,0,0,0,7,1,120,0,51,1,19,0,
+3,255,186,253,250,3,66,3,30,0,33,0,34,0,35,0,0,33,34,39,6,6,35,34,38,39,55,
+22,51,50,54,55,38,39,38,38,53,52,54,55,22,23,22,22,23,22,51,50,21,21,20,1,
+3,3,49,96,71,35,247,170,49,170,49,28,112,81,154,218,58,27,35,72,65,63,56,
+15,26,65,45,5,69,91,17,254,80,195,50,214,254,77,38,68,23,183,175,66,63,124,
+151,51,52,63,28,56,68,171,154,52,41,17,122,17,3,30,250,220,0,255,255,255,
+186,253,250,3,66,4,127,2,38,1,199,0,0,0,7,1,120,255,247,0,157,0,4,0,139,253,
+232,8,68,2,164,0,78,0,79,0,80,0,81,0,0,33,34,38,39,7,6,6,35,34,39,6,6,7,34,
+39,23,20,6,4,35,34,38,53,52,54,55,23,6,21,20,22,51,50,36,55,2,53,52,54,55,
+22,23,22,51,50,55,54,55,62,2,51,50,23,6,7,7,22,51,50,55,54,55,62,2,51,50,
+23,6,7,7,23,22,51,50,21,21,20,1,19,21,8,51,79,159,53,29,16,109,56,91,73,17,
+128,102,19,73,1,160,254,234,148,175,196,15,25,75,23,150,134,152,1,46,51,134,
+60,74,10,43,55,82,95,65,14,36,14,32,39,45,28,20,28,55,23,52,57,50,63,16,43,
+34,42,38,21,28,21,21,22,60,32,93,120,17,253,137,16,61,50,56,24,31,52,21,29,
+2,8,42,126,230,146,201,184,59,105,101,18,90,56,150,167,148,108,1,37,98,53,
+86,44,80,215,12,21,22,119,49,86,63,15,59,180,75,26,22,25,122,98,86,19,15,
+51,65,174,19,53,17,122,17,2,164,253,32,96,0,0,4,255,239,255,150,4,219,2,184,
+0,61,0,62,0,63,0,64,0,0,33,34,38,39,6,6,35,34,53,53,52,51,50,54,55,54,54,
+55,54,51,50,23,6,7,22,22,51,50,55,54,55,62,2,51,50,23,6,7,23,22,51,38,39,
+38,53,52,54,55,22,23,22,21,20,6,7,34,38,39,7,6,6,19,3,21,1,207,59,151,41,
+29,114,69,17,17,57,75,34,26,25,58,18,45,27,23,64,21,15,102,65,96,65,12,12,
+52,41,39,24,27,21,30,59,52,139,170,25,52,41,72,63,9,40,31,50,29,132,192,110,
+18,13,129,125,6,38,25,29,34,17,122,17,21,26,21,31,96,33,15,156,31,7,19,21,
+19,39,174,84,23,15,64,196,22,58,93,132,105,33,45,91,36,62,172,135,75,36,160,
+56,37,51,33,22,31,2,162,253,32,46,0,0,4,255,239,255,150,5,112,2,164,0,73,
+0,74,0,75,0,76,0,0,33,34,38,39,7,6,6,35,34,39,6,6,7,34,38,39,6,6,35,34,53,
+53,52,51,50,54,55,54,54,55,54,51,50,23,6,7,22,22,51,50,55,54,55,62,2,51,50,
+23,6,7,7,22,22,51,50,55,54,55,62,2,51,50,23,6,7,23,22,51,50,21,21,20,1,3,
+21,5,95,80,157,54,29,16,109,56,91,73,17,128,102,59,151,41,29,114,69,17,17,
+57,75,34,26,25,58,18,45,27,23,64,21,15,102,65,96,65,12,12,52,41,39,24,27,
+21,28,55,23,31,46,32,50,63,16,43,17,36,35,46,29,20,28,74,32,93,120,17,253,
+93,36,61,50,56,24,31,52,21,29,2,38,25,29,34,17,122,17,21,26,21,31,96,33,15,
+156,31,7,19,21,19,39,174,84,23,15,59,180,75,15,11,22,25,122,51,90,62,15,68,
+222,19,53,17,122,17,2,164,253,32,46,0,255,255,0,139,253,232,8,68,4,85,2,38,
+1,201,0,0,0,7,1,124,4,11,0,83,255,255,255,239,255,150,4,219,4,88,2,38,1,202,
+0,0,0,7,1,124,0,246,0,86,255,255,255,239,255,150,5,112,4,81,2,38,1,203,0,
+0,0,7,1,124,1,17,0,79,0,5,0,139,253,232,8,238,3,63,0,53,0,63,0,64,0,65,0,
+66,0,0,33,34,38,39,6,4,35,34,39,22,21,20,6,4,35,34,38,53,52,54,55,23,6,21,
+20,22,51,50,36,55,2,53,52,54,55,22,31,2,18,36,51,50,22,22,21,20,7,22,51,50,
+21,21,20,37,32,37,38,38,35,34,4,7,22,19,19,21,8,221,87,173,50,89,255,0,134,
+206,183,5,160,254,234,148,175,196,15,25,75,23,150,134,152,1,46,51,134,60,
+74,8,33,36,10,206,1,73,135,63,175,124,83,91,122,17,252,238,1,11,1,24,62,174,
+84,101,254,236,146,168,121,147,71,52,56,67,50,43,41,126,230,146,201,184,59,
+105,101,18,90,56,150,167,148,108,1,37,98,53,86,44,60,175,15,3,1,14,251,102,
+143,53,131,94,52,17,122,17,156,175,108,121,200,176,28,2,163,252,133,46,0,
+5,255,239,255,150,5,191,3,63,0,32,0,42,0,43,0,44,0,45,0,0,1,50,23,6,7,22,
+23,0,33,50,22,22,21,20,6,4,35,34,36,39,7,6,35,34,53,53,52,51,50,54,55,55,
+54,1,32,37,38,38,35,34,4,7,22,19,19,21,1,96,29,19,43,18,50,52,1,136,1,20,
+58,170,134,161,254,190,177,148,254,200,92,35,68,156,17,17,92,108,55,32,21,
+2,12,1,11,1,24,62,174,85,97,254,244,157,160,135,165,1,156,19,104,38,24,16,
+2,8,94,148,56,126,193,114,64,51,40,75,17,122,17,67,96,57,36,255,0,175,108,
+121,189,185,30,2,163,252,133,46,0,5,255,239,255,150,6,92,3,63,0,43,0,53,0,
+54,0,55,0,56,0,0,33,34,38,39,6,4,35,34,36,39,7,6,35,34,53,53,52,51,50,54,
+55,55,54,51,50,23,6,7,22,23,0,33,50,22,22,21,20,7,22,51,50,21,21,20,37,32,
+37,38,38,35,34,4,7,22,19,19,21,6,74,87,172,55,91,254,249,131,148,254,200,
+92,35,68,156,17,17,92,108,55,32,21,44,29,19,43,18,50,52,1,136,1,20,58,170,
+134,79,93,125,18,252,228,1,11,1,24,62,174,85,97,254,244,157,160,135,165,70,
+57,59,68,64,51,40,75,17,122,17,67,96,57,36,19,104,38,24,16,2,8,94,148,56,
+124,97,56,17,122,17,156,175,108,121,189,185,30,2,163,252,133,46,0,255,255,
+0,139,253,232,8,238,4,160,2,38,1,207,0,0,0,7,1,120,4,58,0,190,255,255,255,
+239,255,150,5,191,4,160,2,38,1,208,0,0,0,7,1,120,1,165,0,190,255,255,255,
+239,255,150,6,92,4,161,2,38,1,209,0,0,0,7,1,120,1,164,0,191,0,5,0,87,255,
+130,6,87,5,94,0,47,0,57,0,58,0,59,0,60,0,0,33,34,38,39,6,4,35,34,46,2,39,
+55,23,23,54,55,3,38,2,53,52,54,55,22,23,23,7,23,18,23,22,23,0,51,50,22,22,
+21,20,7,23,22,51,50,21,21,20,37,32,37,38,38,35,34,4,7,22,1,3,21,6,69,87,172,
+53,91,254,255,134,125,240,106,193,60,21,240,70,60,59,60,25,47,61,74,25,28,
+20,55,1,36,6,17,2,1,32,201,58,170,134,81,2,93,120,18,252,233,1,11,1,24,62,
+174,85,101,254,230,152,154,1,153,164,71,54,58,67,15,20,99,43,71,52,12,78,
+70,1,95,127,1,76,66,70,80,16,99,81,63,47,9,254,161,42,127,130,1,50,94,148,
+56,127,96,1,53,17,122,17,156,175,108,121,205,185,14,2,223,252,73,66,0,0,5,
+255,239,255,150,4,224,5,94,0,36,0,46,0,47,0,48,0,49,0,0,1,20,4,4,33,34,53,
+53,52,51,55,51,54,55,3,38,2,39,52,54,55,22,23,23,7,23,22,18,23,22,23,54,36,
+51,50,22,22,7,38,38,35,34,4,7,54,36,54,3,3,21,4,224,254,237,253,222,254,85,
+17,17,169,7,65,66,60,27,44,1,62,73,19,18,36,54,1,3,31,7,18,2,145,1,0,94,58,
+170,134,94,60,167,91,93,254,225,166,203,1,38,190,114,131,1,201,147,205,105,
+17,122,17,2,90,82,1,97,134,1,67,73,67,78,16,75,53,115,46,10,39,254,204,46,
+209,47,159,170,94,148,146,103,115,224,201,8,39,69,2,127,252,49,46,0,0,5,255,
+239,255,150,5,43,5,94,0,47,0,57,0,58,0,59,0,60,0,0,1,20,7,22,51,50,21,21,
+20,35,34,38,39,6,4,33,34,53,53,52,51,55,51,54,55,3,38,2,39,52,54,55,22,23,
+23,7,23,22,18,23,22,23,54,36,51,50,22,22,7,38,38,35,34,4,7,54,36,54,3,3,21,
+4,224,144,88,114,17,17,92,181,48,140,254,17,254,162,17,17,169,7,65,66,60,
+27,44,1,62,73,19,18,36,54,1,3,31,7,18,2,145,1,0,94,58,170,134,94,60,167,91,
+93,254,225,166,203,1,38,190,111,134,1,201,151,104,46,17,122,17,79,57,65,71,
+17,122,17,2,90,82,1,97,134,1,67,73,67,78,16,75,53,115,46,10,39,254,204,46,
+209,47,159,170,94,148,146,103,115,224,201,8,39,69,2,127,252,49,46,255,255,
+0,87,255,130,6,87,5,94,2,38,1,213,0,0,0,7,1,120,2,164,0,250,255,255,255,239,
+255,150,4,224,5,94,2,38,1,214,0,0,0,7,1,120,1,196,1,18,255,255,255,239,255,
+150,5,43,5,94,2,38,1,215,0,0,0,7,1,120,1,199,1,18,0,5,0,140,253,83,4,85,3,
+98,0,48,0,60,0,61,0,62,0,63,0,0,1,34,38,53,52,55,55,38,39,38,38,39,7,38,53,
+52,54,54,51,50,22,21,20,6,7,22,51,51,50,21,21,20,35,35,32,39,39,7,6,21,20,
+22,51,50,54,55,23,6,6,3,54,54,53,52,38,35,34,7,22,22,23,19,1,5,2,168,206,
+250,159,63,28,23,80,72,33,32,38,151,167,82,132,175,94,105,97,195,50,20,20,
+50,254,254,140,21,36,188,191,211,98,136,147,29,151,184,221,87,61,85,69,130,
+111,34,83,78,5,254,159,1,201,253,183,216,176,192,137,52,31,33,114,85,27,22,
+41,51,73,96,49,147,109,88,149,74,43,19,118,19,100,16,24,124,159,117,113,22,
+44,68,94,68,3,86,68,87,42,57,74,61,27,86,97,2,28,250,133,148,0,4,255,239,
+255,150,3,214,3,98,0,38,0,39,0,40,0,41,0,0,49,34,53,53,52,51,50,55,38,38,
+53,52,54,54,51,50,22,23,7,38,38,35,34,7,20,22,22,23,54,54,55,22,21,7,6,7,
+6,6,4,1,19,21,17,17,132,123,49,73,95,150,82,71,130,86,36,81,74,44,126,137,
+85,162,110,78,142,128,28,2,12,73,244,250,254,249,1,45,130,17,122,17,6,32,
+112,63,87,192,118,71,75,65,31,16,75,88,145,88,6,16,45,50,26,47,21,69,18,61,
+45,24,3,98,252,98,46,0,0,5,255,239,255,150,3,114,3,98,0,37,0,49,0,50,0,51,
+0,52,0,0,33,32,39,39,7,6,35,34,53,53,52,51,50,55,39,38,38,39,7,38,53,52,54,
+54,51,50,22,21,20,6,6,7,22,51,50,21,21,20,1,52,38,35,34,7,22,23,22,23,54,
+54,3,19,21,3,94,254,254,140,15,20,196,231,19,19,213,138,37,81,74,30,32,37,
+142,170,88,132,175,43,71,70,86,191,20,254,253,86,69,125,116,74,122,23,28,
+68,81,190,19,100,11,11,100,19,118,19,49,47,115,87,24,22,40,51,72,94,53,147,
+109,59,108,93,57,37,19,118,19,1,210,58,73,60,59,152,29,27,46,103,1,191,252,
+98,46,0,255,255,0,140,253,83,4,85,4,195,2,38,1,219,0,0,0,7,1,120,0,95,0,225,
+255,255,255,239,255,150,3,214,4,195,2,38,1,220,0,0,0,7,1,120,0,28,0,225,255,
+255,255,239,255,150,3,114,4,195,2,38,1,221,0,0,0,7,1,120,0,22,0,225,255,255,
+0,139,255,150,6,173,4,230,2,38,2,14,0,0,0,7,1,120,3,90,1,4,255,255,255,239,
+255,150,2,244,5,123,2,38,2,15,0,0,0,7,1,120,255,247,1,153,255,255,255,239,
+255,150,3,59,4,195,2,38,2,13,0,0,0,7,1,120,255,254,0,225,255,255,0,68,253,
+132,5,69,4,132,2,38,2,4,0,0,0,7,1,122,1,69,0,149,255,255,255,239,255,150,
+2,244,5,113,2,38,2,15,0,0,0,7,1,122,255,218,1,130,255,255,255,239,255,150,
+3,59,4,185,2,38,2,13,0,0,0,7,1,122,255,225,0,202,0,4,0,139,255,150,6,7,5,
+94,0,36,0,37,0,79,0,80,0,0,37,21,20,35,34,38,39,39,6,4,35,34,38,38,53,52,
+55,51,6,21,20,22,51,50,55,55,38,3,3,54,55,18,19,19,22,51,50,1,19,46,3,53,
+52,62,2,51,50,23,7,38,35,34,14,2,7,30,3,23,22,22,21,20,14,2,35,34,38,53,54,
+54,55,54,54,3,6,7,18,86,134,38,7,160,254,215,173,188,204,99,28,72,6,189,252,
+226,201,128,28,35,20,59,78,13,8,7,93,121,18,252,245,51,54,77,49,23,28,46,
+57,30,55,13,33,9,14,12,33,31,26,4,19,47,46,43,14,11,8,44,69,85,41,25,22,54,
+100,35,16,23,76,139,122,17,50,47,9,55,51,64,135,100,76,79,34,43,126,95,37,
+27,251,2,4,1,17,60,54,254,231,253,166,254,231,54,254,250,2,143,1,10,22,37,
+29,24,55,47,32,57,14,10,18,29,35,18,9,9,7,10,10,7,20,11,18,57,52,38,24,17,
+5,37,24,11,22,1,63,0,0,4,255,239,255,150,3,45,5,60,0,36,0,37,0,38,0,39,0,
+0,49,34,53,53,52,51,50,54,54,55,38,38,39,6,35,34,38,53,52,54,55,36,36,55,
+22,21,7,6,7,4,7,22,4,22,21,20,4,3,1,21,17,17,141,214,162,87,37,208,183,24,
+27,54,71,43,11,1,17,1,35,164,31,1,10,76,254,93,232,156,1,29,170,254,171,245,
+1,45,17,122,17,29,46,45,114,199,89,7,75,58,45,145,6,141,133,66,27,51,18,71,
+31,175,107,38,174,217,95,164,172,4,156,251,40,46,0,5,255,239,255,150,3,207,
+5,60,0,51,0,52,0,53,0,54,0,55,0,0,36,21,21,20,35,34,38,39,6,33,34,53,53,52,
+51,50,55,54,55,38,38,39,38,38,53,52,54,55,54,55,54,55,54,55,55,22,22,21,7,
+6,7,5,7,22,4,23,22,21,20,7,22,51,1,1,53,21,3,207,18,98,180,71,153,254,57,
+17,17,255,181,79,89,37,211,180,89,85,19,22,32,216,102,51,33,252,120,15,17,
+1,11,75,253,212,139,148,1,17,81,85,12,124,159,252,169,1,48,156,17,122,17,
+72,78,150,17,122,17,52,22,46,115,200,87,43,75,53,39,55,22,31,107,48,22,14,
+104,49,14,44,21,17,71,31,228,61,37,170,106,109,95,44,38,98,3,238,251,58,86,
+132,0,5,0,68,253,132,4,222,5,194,0,45,0,46,0,47,0,48,0,49,0,0,5,3,2,2,53,
+52,54,55,22,22,23,7,23,19,22,23,23,22,51,50,21,21,20,35,34,39,23,20,6,4,35,
+34,38,53,52,54,55,23,6,21,20,22,51,50,54,54,9,2,19,3,247,52,87,55,64,70,3,
+6,64,48,4,67,18,9,1,66,84,17,17,74,66,2,158,254,236,147,175,196,15,25,75,
+23,150,134,97,210,160,252,110,2,248,254,155,159,111,1,75,2,8,1,153,65,69,
+76,15,13,22,208,42,32,253,161,133,122,4,35,17,122,17,33,67,127,230,145,201,
+184,59,105,101,18,90,56,150,167,68,118,254,156,7,219,254,7,249,187,0,4,255,
+236,255,150,1,58,5,194,0,19,0,20,0,21,0,22,0,0,35,34,53,53,52,51,50,55,2,
+3,54,55,22,19,18,23,20,6,7,6,3,19,21,2,18,18,124,103,42,61,59,78,10,23,19,
+3,41,31,37,43,84,17,122,17,54,2,32,1,250,60,54,220,254,153,254,212,219,35,
+115,55,71,5,194,250,2,46,0,3,255,239,255,150,2,24,5,194,0,26,0,27,0,28,0,
+0,49,34,53,53,52,51,50,55,38,3,3,54,55,18,19,19,22,51,50,21,21,20,35,34,39,
+6,6,23,3,17,17,116,108,27,38,20,61,77,13,8,7,93,120,18,18,150,85,75,120,183,
+109,17,122,17,53,216,2,50,1,17,63,51,254,231,253,166,254,231,54,17,122,17,
+73,42,31,106,6,44,0,5,0,139,253,143,4,97,3,28,0,37,0,45,0,46,0,47,0,48,0,
+0,19,22,19,19,6,7,38,39,38,53,52,54,55,62,3,51,50,22,23,22,22,51,50,21,21,
+20,35,34,39,7,34,36,53,52,55,6,37,6,6,7,22,5,38,38,3,19,7,226,15,51,47,60,
+77,13,27,23,23,49,6,167,176,139,42,39,76,53,51,89,49,23,23,102,84,26,211,
+254,196,38,95,1,187,86,161,32,134,1,16,46,70,191,156,30,1,2,171,254,195,254,
+194,45,32,234,247,199,135,24,75,105,14,124,106,58,127,143,140,130,21,113,
+22,89,89,134,106,65,76,64,223,43,150,65,113,27,71,217,1,110,252,168,140,0,
+0,5,255,239,255,130,3,69,3,28,0,24,0,33,0,34,0,35,0,36,0,0,49,34,53,53,52,
+51,50,54,55,55,54,54,51,50,22,22,21,20,6,7,34,36,39,6,6,37,38,38,35,34,6,
+6,7,22,19,19,7,17,17,78,107,39,41,79,151,90,60,119,73,46,58,123,254,235,93,
+48,114,2,98,4,88,43,39,68,68,58,144,42,8,40,17,122,17,75,77,82,168,138,146,
+230,107,63,103,47,68,54,65,57,156,127,232,46,96,114,79,2,104,252,168,66,0,
+5,255,239,255,130,3,113,3,28,0,33,0,41,0,42,0,43,0,44,0,0,49,34,53,53,52,
+51,50,55,38,53,52,54,54,51,50,30,4,51,50,21,21,20,35,34,39,7,34,39,39,6,6,
+1,6,6,7,22,5,38,38,3,19,7,17,17,68,66,16,125,177,81,34,56,52,50,57,66,42,
+23,23,104,83,25,196,156,5,98,126,1,184,77,171,31,133,1,17,44,70,119,136,40,
+17,122,17,21,29,34,85,228,143,80,120,140,120,80,21,113,22,90,90,60,1,36,25,
+2,27,34,157,67,112,27,65,213,1,120,252,168,66,0,255,255,0,68,253,132,4,210,
+2,254,2,38,1,109,0,0,0,7,1,120,0,130,255,28,255,255,255,239,255,150,1,204,
+4,195,2,38,2,8,0,0,0,7,1,120,255,130,0,225,255,255,255,239,255,150,2,121,
+3,151,2,38,2,11,0,0,0,6,1,120,148,181,0,5,0,139,255,130,3,192,3,207,0,27,
+0,34,0,35,0,36,0,37,0,0,37,46,4,53,52,54,55,54,54,55,39,54,55,19,22,51,50,
+21,21,20,35,34,38,39,39,37,22,22,23,3,39,6,19,19,7,2,59,112,84,91,96,49,55,
+18,31,209,117,7,71,78,19,93,120,17,17,124,154,12,7,254,105,82,200,121,53,
+1,245,131,151,40,80,10,19,35,54,50,21,27,132,31,57,149,47,56,64,43,253,103,
+54,17,122,17,93,85,43,143,70,46,2,1,74,4,84,1,223,251,245,66,0,6,255,239,
+255,110,3,167,3,219,0,24,0,35,0,45,0,46,0,47,0,48,0,0,49,34,53,53,52,51,50,
+55,38,53,52,54,55,55,22,4,18,21,20,6,7,36,39,6,6,1,52,38,35,34,6,6,7,22,23,
+54,5,52,38,38,39,22,21,20,7,22,1,19,21,17,17,145,91,128,104,77,47,173,1,18,
+152,58,47,254,245,187,81,182,1,122,76,44,32,78,64,16,95,112,103,1,78,69,122,
+69,46,104,140,254,233,90,17,125,14,26,112,130,94,197,38,134,50,198,254,249,
+138,47,149,79,31,97,48,43,1,217,58,102,53,95,59,101,70,81,223,91,198,173,
+58,84,82,154,117,59,3,82,251,233,86,0,0,5,255,239,253,250,3,47,3,198,0,41,
+0,50,0,61,0,62,0,63,0,0,5,22,22,21,20,6,7,6,6,35,34,38,39,7,39,7,34,53,53,
+52,51,55,55,18,1,23,22,23,22,21,20,6,7,55,54,51,50,21,21,20,35,34,3,39,38,
+39,6,6,7,54,54,19,50,54,55,38,38,35,34,7,22,22,19,19,2,138,48,67,56,14,26,
+96,50,159,201,27,78,22,36,17,17,94,40,42,1,86,73,7,29,26,101,66,45,108,153,
+23,23,78,179,17,39,7,113,93,8,73,145,64,35,78,23,26,190,110,17,63,32,140,
+28,49,14,21,84,40,29,148,18,28,36,189,174,33,90,2,17,122,17,3,3,1,125,1,67,
+20,93,148,138,58,90,140,38,4,11,21,113,22,1,19,103,195,88,160,232,115,8,64,
+254,12,29,25,89,131,12,132,130,4,216,250,52,0,0,5,0,70,253,252,3,226,4,66,
+0,32,0,45,0,46,0,47,0,48,0,0,1,34,38,39,55,22,51,50,54,55,46,2,53,52,54,54,
+51,50,22,18,21,21,51,50,21,21,20,35,35,14,2,19,34,6,6,21,20,22,23,22,22,23,
+38,38,3,3,19,1,139,66,204,55,29,110,139,127,197,67,200,199,94,84,136,69,84,
+146,90,122,17,17,144,30,133,178,11,42,85,52,114,109,14,35,176,25,156,96,50,
+70,254,96,83,48,67,38,125,134,7,54,117,100,104,204,124,152,254,247,131,9,
+17,122,17,117,195,104,3,187,65,96,39,72,74,20,3,4,8,160,221,1,18,250,207,
+6,70,0,0,4,0,98,253,134,5,162,1,64,0,41,0,42,0,43,0,44,0,0,5,20,6,4,35,34,
+38,53,52,54,55,23,6,21,20,22,51,50,54,54,55,39,36,53,52,54,54,51,22,22,51,
+50,21,21,20,35,34,38,39,23,22,22,1,1,5,5,54,226,254,152,168,210,231,15,25,
+75,23,190,164,201,222,179,74,41,254,189,28,36,9,73,244,132,23,23,70,178,68,
+183,31,17,253,121,253,179,1,226,184,79,164,107,201,184,59,105,101,18,90,56,
+150,167,35,78,67,23,171,43,25,66,47,15,19,23,113,20,19,17,99,19,62,1,208,
+252,187,117,255,255,0,98,252,77,5,162,1,64,2,38,1,247,0,0,0,7,1,123,0,186,
+253,238,255,255,255,239,254,93,2,134,3,98,2,38,2,10,0,0,0,6,1,123,221,254,
+255,255,255,239,254,93,3,5,2,54,2,38,2,12,0,0,0,6,1,123,248,254,255,255,255,
+109,255,150,3,187,5,229,2,38,2,1,0,0,0,6,0,83,249,81,255,255,255,169,255,
+150,5,4,5,194,2,38,2,2,0,0,0,6,0,83,53,62,255,255,255,237,255,150,3,187,6,
+65,2,38,2,1,0,0,0,7,0,84,255,251,0,155,255,255,0,42,255,150,5,4,6,46,2,38,
+2,2,0,0,0,7,0,84,0,56,0,136,255,255,0,71,254,8,3,187,5,229,2,38,2,1,0,0,0,
+7,0,85,0,241,255,58,255,255,0,70,254,8,5,4,5,194,2,38,2,2,0,0,0,7,0,85,1,
+55,255,58,0,6,0,71,255,150,3,187,5,229,0,46,0,52,0,53,0,54,0,55,0,56,0,0,
+33,34,53,52,54,51,51,54,54,55,38,38,39,7,38,38,53,52,54,55,30,2,23,55,54,
+53,52,3,38,53,52,55,23,23,7,23,19,20,7,22,22,21,20,6,7,6,55,38,39,6,7,54,
+19,1,1,33,1,24,5,23,8,43,136,132,61,93,228,111,75,53,47,26,44,85,221,189,
+101,3,36,45,22,137,36,37,55,3,12,79,64,91,49,14,191,173,44,86,88,147,180,
+79,253,131,2,154,254,129,22,28,106,106,125,79,106,192,64,5,49,81,46,31,59,
+23,59,185,182,120,8,78,89,86,1,37,140,21,103,25,129,114,47,43,254,219,157,
+149,102,177,25,33,103,3,34,196,82,110,122,106,6,5,63,254,215,250,218,0,0,
+5,0,70,255,150,5,4,5,194,0,45,0,46,0,47,0,48,0,49,0,0,51,39,54,54,55,55,2,
+39,35,38,38,53,52,55,22,18,23,22,23,54,54,18,19,54,55,18,19,19,22,51,50,21,
+21,20,35,34,38,39,38,38,3,2,7,2,7,6,9,2,33,115,7,238,192,68,1,155,217,75,
+42,48,78,121,243,69,26,52,77,88,52,11,57,81,14,8,7,93,120,17,17,121,159,10,
+16,21,18,35,38,94,224,190,2,75,253,31,2,255,254,38,71,59,76,50,1,1,84,207,
+43,82,51,78,35,78,254,184,170,65,149,80,241,1,85,1,39,58,56,254,200,253,197,
+254,231,54,17,122,17,95,83,119,237,1,39,254,196,131,254,183,28,21,5,190,254,
+231,250,237,0,4,0,139,255,150,6,97,4,61,0,32,0,43,0,44,0,45,0,0,33,32,17,
+52,55,51,6,21,20,22,22,51,50,36,55,38,39,6,35,34,38,53,52,54,51,50,22,18,
+21,20,7,6,4,1,34,6,21,20,22,51,50,55,38,38,19,3,2,144,253,251,28,74,8,93,
+205,169,203,1,240,136,10,18,136,154,90,114,151,103,104,165,97,72,136,254,
+8,1,59,60,85,84,91,99,116,40,125,10,109,1,93,127,98,51,50,125,126,66,84,61,
+83,77,112,134,105,157,240,149,254,235,168,70,138,87,96,3,43,113,70,65,59,
+52,124,131,252,107,4,167,0,5,0,68,253,132,5,69,3,45,0,39,0,51,0,52,0,53,0,
+54,0,0,1,34,38,53,52,54,55,23,6,21,20,22,51,50,36,55,39,34,46,2,53,52,54,
+54,51,50,22,18,23,51,50,21,21,20,35,35,6,6,4,19,34,6,6,21,20,30,2,23,38,38,
+3,1,5,2,33,192,214,15,25,75,23,164,155,181,1,47,82,7,107,251,133,61,84,136,
+69,87,165,108,12,114,17,17,116,21,193,254,205,119,42,84,52,39,92,140,177,
+47,144,128,253,71,2,15,253,232,202,183,59,105,101,18,90,56,154,163,141,122,
+106,27,65,106,81,104,204,124,156,254,252,141,17,122,17,152,241,143,4,51,65,
+94,41,42,61,44,29,4,189,191,1,18,250,186,99,0,0,3,0,157,255,150,1,108,4,148,
+0,0,0,16,0,17,0,0,19,19,20,3,7,39,38,2,47,2,52,54,55,23,23,7,3,249,66,14,
+94,3,2,19,7,18,1,64,70,36,37,55,40,4,148,253,81,104,254,148,17,130,96,1,127,
+90,190,27,65,77,14,129,114,47,252,136,0,3,0,160,255,150,2,41,4,154,0,17,0,
+18,0,19,0,0,37,21,20,35,34,38,39,38,39,3,54,55,22,19,23,22,51,50,1,19,2,41,
+18,120,159,11,27,21,37,48,94,9,6,4,96,118,18,254,191,123,139,122,17,95,83,
+197,242,1,147,36,22,187,253,254,167,54,3,254,250,252,0,3,0,17,3,26,1,51,4,
+229,0,28,0,29,0,30,0,0,19,55,52,38,35,34,6,7,22,51,50,55,7,6,6,7,39,55,55,
+38,53,52,54,51,50,22,21,20,7,39,19,221,2,16,14,34,59,12,34,70,50,65,5,82,
+113,85,5,43,46,83,107,60,49,41,16,110,33,4,46,10,9,19,51,35,44,14,88,21,43,
+46,88,26,25,16,75,65,114,49,35,26,35,195,254,63,0,4,255,239,255,150,1,204,
+3,98,0,23,0,24,0,25,0,26,0,0,49,34,53,53,52,51,50,54,55,38,39,38,53,52,54,
+55,22,23,22,21,20,6,7,6,19,3,21,17,17,93,196,73,26,48,39,73,61,9,39,29,38,
+34,189,85,24,17,122,17,41,34,95,130,106,31,45,94,34,58,177,135,75,30,113,
+65,113,3,98,252,98,46,0,3,0,143,255,150,6,175,2,112,0,38,0,39,0,40,0,0,33,
+34,39,6,4,35,34,36,53,52,55,51,6,6,21,20,22,22,51,50,36,55,54,54,55,55,54,
+51,50,23,6,7,22,22,51,50,21,21,20,1,19,6,158,207,143,125,254,149,213,241,
+254,253,28,73,2,5,90,197,162,172,1,130,52,25,29,19,29,19,45,30,19,56,29,68,
+123,77,17,252,141,109,145,67,78,174,175,127,98,8,68,25,119,130,68,76,37,18,
+37,34,53,32,15,137,50,45,40,17,122,17,2,112,253,38,0,4,255,239,255,150,2,
+87,3,98,0,24,0,25,0,26,0,27,0,0,49,34,53,53,52,51,50,36,55,38,39,38,53,52,
+54,55,30,3,21,20,7,6,4,19,3,21,17,17,151,1,22,72,21,53,39,73,61,9,27,24,17,
+71,84,254,215,247,34,17,122,17,41,34,82,143,106,31,45,94,34,60,118,114,106,
+47,71,137,51,62,3,98,252,98,46,0,0,4,255,239,255,150,2,121,2,54,0,29,0,30,
+0,31,0,32,0,0,49,34,53,53,52,51,50,54,54,55,55,54,51,50,23,6,7,22,22,51,50,
+21,21,20,35,34,39,7,6,6,19,19,21,17,17,75,108,60,66,36,18,45,28,22,44,55,
+71,115,71,17,17,190,133,34,21,154,219,44,17,122,17,29,55,127,66,33,16,108,
+109,43,34,17,122,17,120,45,26,49,2,54,253,142,46,0,0,4,255,239,255,150,3,
+5,2,54,0,30,0,31,0,32,0,33,0,0,1,50,23,6,6,7,22,22,51,50,21,21,20,35,34,39,
+7,6,6,35,34,53,53,52,51,50,54,54,55,55,54,39,3,21,2,35,28,22,37,56,6,69,119,
+70,17,17,189,135,33,21,255,123,17,17,127,177,73,71,36,18,59,56,1,210,16,89,
+120,7,44,34,17,122,17,119,44,23,52,17,122,17,22,52,137,66,33,100,253,142,
+46,0,0,5,255,239,255,150,3,59,3,98,0,33,0,44,0,45,0,46,0,47,0,0,55,38,53,
+52,54,55,54,54,51,50,22,22,21,20,7,22,51,50,21,21,20,35,34,39,39,6,6,35,34,
+53,53,52,51,50,37,46,2,35,34,6,7,22,23,54,3,3,21,178,75,24,12,53,172,99,53,
+99,62,88,65,155,18,18,252,159,9,70,186,131,19,19,113,1,226,5,56,70,22,58,
+158,49,85,126,113,94,12,163,88,88,53,139,22,97,116,103,177,87,132,101,10,
+17,122,17,63,3,35,31,19,118,19,180,51,122,83,138,96,99,48,43,2,100,252,98,
+46,0,0,5,0,139,255,150,6,173,3,133,0,39,0,50,0,51,0,52,0,53,0,0,33,34,39,
+6,4,35,32,17,52,55,51,6,21,20,22,22,51,50,55,38,38,53,52,54,55,54,54,51,50,
+22,22,21,20,7,22,51,50,21,21,20,3,46,2,35,34,6,7,22,23,54,3,3,21,6,156,253,
+168,101,254,191,193,253,251,28,74,8,93,205,169,196,171,38,44,24,13,54,170,
+100,53,100,61,118,119,131,17,229,5,52,74,22,58,159,48,83,107,144,127,2,82,
+37,45,1,93,127,98,51,50,125,126,66,35,39,98,46,45,147,22,98,115,107,173,88,
+150,105,22,17,122,17,1,115,51,116,88,139,94,96,54,55,2,91,252,63,46,0,0,5,
+255,239,255,150,2,244,4,26,0,27,0,38,0,39,0,40,0,41,0,0,1,38,39,6,6,35,34,
+38,53,52,54,51,50,22,18,21,20,7,6,4,35,34,53,53,52,51,50,36,3,34,6,21,20,
+22,51,50,55,38,38,3,19,21,2,146,10,18,62,153,76,90,113,151,103,106,164,96,
+72,124,254,204,250,19,19,221,1,50,170,62,83,83,91,100,116,40,125,37,62,1,
+10,84,77,53,60,136,103,157,240,152,254,232,162,70,138,77,71,19,118,19,53,
+2,55,113,70,64,60,52,124,131,1,18,251,170,46,0,0,4,255,111,4,60,1,2,5,104,
+0,22,0,32,0,33,0,34,0,0,19,34,38,39,6,7,39,54,54,51,50,23,23,54,54,51,50,
+22,21,20,7,6,6,39,50,54,55,38,35,34,6,7,22,21,19,114,38,71,52,38,32,28,33,
+55,32,10,15,11,44,72,43,36,52,17,35,54,38,44,33,33,24,45,23,45,39,42,30,4,
+81,22,27,17,32,22,51,52,7,5,65,51,69,51,29,40,25,15,82,8,13,48,22,33,14,103,
+1,44,255,255,255,152,255,150,3,187,5,232,2,38,2,1,0,0,0,7,2,16,0,41,0,128,
+255,255,255,213,255,150,5,4,5,213,2,38,2,2,0,0,0,6,2,16,102,109,0,6,255,104,
+2,143,1,48,4,134,0,24,0,33,0,34,0,35,0,36,0,37,0,0,3,38,53,52,54,55,22,23,
+7,21,23,54,54,51,50,22,21,20,6,35,34,39,55,22,23,23,50,54,55,38,38,35,34,
+7,55,19,3,21,8,49,49,35,12,11,17,5,56,51,20,42,97,120,86,138,112,13,35,60,
+146,48,69,40,35,47,23,59,87,88,61,59,3,79,176,19,17,39,10,44,24,13,28,105,
+48,28,83,31,66,85,66,50,7,8,11,18,16,28,16,73,87,1,15,254,39,30,255,255,0,
+139,255,150,3,137,3,59,2,38,1,112,0,0,0,7,1,122,0,30,255,76,255,255,0,139,
+255,150,3,137,3,165,2,38,1,112,0,0,0,7,2,7,1,27,254,192,0,4,0,235,2,196,2,
+118,3,175,0,6,0,13,0,14,0,15,0,0,1,6,7,38,39,54,55,5,6,7,38,39,54,55,39,23,
+1,158,39,46,66,28,46,46,1,47,49,36,65,30,26,67,120,16,3,38,56,42,52,36,42,
+54,66,65,33,52,36,23,74,30,235,0,0,5,0,75,254,85,3,174,255,152,0,7,0,16,0,
+24,0,25,0,26,0,0,1,6,7,38,39,54,55,22,5,6,7,38,39,54,55,22,22,5,6,7,38,39,
+54,55,22,37,19,2,121,37,84,92,44,54,78,18,1,160,38,84,92,44,51,82,34,61,253,
+188,36,85,86,50,59,73,24,1,21,4,254,255,59,81,74,51,50,88,19,75,61,78,74,
+51,47,91,38,57,83,57,82,66,59,56,81,25,70,254,199,0,0,3,0,92,3,10,1,235,4,
+193,0,21,0,22,0,23,0,0,1,22,22,21,20,7,6,7,6,7,38,38,39,55,54,51,50,22,22,
+23,54,54,3,3,1,189,18,28,30,47,34,40,71,40,82,55,33,22,19,36,59,57,21,12,
+72,86,23,4,143,1,32,31,14,59,93,103,26,10,85,164,76,9,6,69,110,52,64,169,
+254,150,1,183,0,3,0,98,3,2,1,241,4,188,0,20,0,21,0,22,0,0,19,38,38,53,52,
+55,54,55,54,55,22,23,7,6,35,34,38,38,39,6,6,23,3,146,19,29,30,46,37,40,69,
+101,76,33,22,17,33,56,64,23,9,67,103,29,3,25,2,32,30,15,60,88,107,26,9,216,
+108,9,6,56,115,59,58,164,61,1,186,0,0,3,255,105,4,2,0,247,5,158,0,41,0,42,
+0,43,0,0,19,34,39,38,35,34,7,39,54,54,51,23,23,50,55,38,53,52,54,54,51,50,
+22,21,20,7,39,55,52,38,35,34,6,7,22,22,51,50,55,7,6,6,23,19,38,21,29,27,17,
+30,36,29,18,60,23,64,25,15,18,75,46,71,29,33,38,10,36,1,13,11,22,55,15,22,
+67,24,36,45,3,60,118,33,12,4,22,17,15,41,22,32,54,15,3,6,38,59,36,73,49,38,
+34,30,25,9,7,8,18,43,28,22,31,20,75,35,43,20,1,156,0,5,255,195,3,252,0,233,
+6,118,0,26,0,34,0,42,0,43,0,44,0,0,19,55,52,38,35,34,6,7,22,51,50,55,7,6,
+6,7,39,55,38,53,52,54,51,50,21,20,7,19,23,20,6,6,7,55,54,55,23,20,7,6,7,55,
+54,19,3,156,1,15,11,32,52,12,31,62,45,60,4,93,95,65,5,81,75,98,53,80,14,6,
+2,19,111,119,6,85,140,2,31,94,122,5,129,42,64,4,244,8,9,17,45,31,41,13,79,
+24,40,35,80,45,15,67,60,101,75,25,31,1,18,17,18,24,46,37,58,25,152,16,35,
+14,39,34,55,39,253,228,2,102,0,4,255,211,3,252,0,233,6,35,0,7,0,34,0,35,0,
+36,0,0,19,23,20,6,6,7,55,54,23,55,52,38,35,34,6,7,22,51,50,55,7,6,6,7,39,
+55,38,53,52,54,51,50,21,20,7,7,3,202,2,17,110,122,7,176,18,1,15,11,32,52,
+12,31,62,45,60,4,93,95,65,5,81,75,98,53,80,14,77,51,5,251,16,15,26,47,38,
+58,59,238,8,9,17,45,31,41,13,79,24,40,35,80,45,15,67,60,101,75,25,31,217,
+2,19,0,0,5,255,149,3,252,0,233,6,148,0,26,0,61,0,72,0,73,0,74,0,0,19,55,52,
+38,35,34,6,7,22,51,50,55,7,6,6,7,39,55,38,53,52,54,51,50,21,20,7,39,34,38,
+53,55,52,35,34,7,39,54,51,50,21,20,7,54,55,38,53,52,54,51,50,22,21,20,7,23,
+6,6,35,39,6,6,55,52,38,35,34,6,21,20,23,23,54,19,3,156,1,15,11,32,52,12,31,
+62,45,60,4,93,95,65,5,81,75,98,53,80,14,203,4,30,5,12,9,36,12,39,31,35,5,
+41,41,50,52,26,18,30,6,42,2,26,27,19,26,76,105,14,15,12,17,43,9,6,4,73,4,
+244,8,9,17,45,31,41,13,79,24,40,35,80,45,15,67,60,101,75,25,31,145,23,3,36,
+20,18,13,54,49,16,20,10,27,29,36,32,52,40,47,21,14,3,21,16,1,26,45,142,18,
+29,15,6,30,17,4,12,254,21,2,132,0,5,255,202,3,252,0,233,6,148,0,26,0,46,0,
+56,0,57,0,58,0,0,19,55,52,38,35,34,6,7,22,51,50,55,7,6,6,7,39,55,38,53,52,
+54,51,50,21,20,7,39,54,55,38,53,52,54,51,50,22,21,7,23,6,6,35,39,6,35,34,
+55,52,35,34,6,21,20,23,23,54,19,3,156,1,15,11,32,52,12,31,62,45,60,4,93,95,
+65,5,81,75,98,53,80,14,248,73,54,50,52,28,17,29,5,42,2,27,27,15,74,55,40,
+169,30,11,18,44,8,7,5,56,4,244,8,9,17,45,31,41,13,79,24,40,35,80,45,15,67,
+60,101,75,25,31,177,13,38,29,36,32,52,41,46,35,3,21,16,1,74,145,47,15,6,31,
+16,4,14,254,19,2,132,0,5,255,227,3,252,0,233,6,108,0,11,0,22,0,49,0,50,0,
+51,0,0,19,34,38,53,52,54,51,50,22,21,20,6,55,52,38,35,34,6,21,20,51,50,54,
+23,55,52,38,35,34,6,7,22,51,50,55,7,6,6,7,39,55,38,53,52,54,51,50,21,20,7,
+7,3,45,33,35,42,27,28,44,47,19,30,21,11,23,42,20,23,66,1,15,11,32,52,12,31,
+62,45,60,4,93,95,65,5,81,75,98,53,80,14,72,91,5,148,48,30,37,51,50,39,34,
+43,77,10,31,17,16,36,22,231,8,9,17,45,31,41,13,79,24,40,35,80,45,15,67,60,
+101,75,25,31,198,2,73,0,0,5,0,48,254,11,1,62,0,92,0,26,0,34,0,42,0,43,0,44,
+0,0,23,55,52,38,35,34,6,7,22,51,50,55,7,6,6,7,39,55,38,53,52,54,51,50,21,
+20,7,19,23,20,7,6,7,55,54,55,23,20,7,6,7,55,54,3,19,232,2,15,11,32,53,11,
+31,62,45,60,5,89,96,68,4,80,74,98,53,79,13,45,2,31,96,122,6,85,140,2,31,94,
+122,4,142,28,15,58,9,9,16,45,31,41,13,79,23,39,37,80,45,16,66,60,101,75,27,
+29,254,221,16,32,15,43,35,57,26,152,16,35,14,39,34,55,43,1,142,253,175,0,
+0,4,0,48,254,104,1,54,0,92,0,26,0,34,0,35,0,36,0,0,23,55,52,38,35,34,6,7,
+22,51,50,55,7,6,6,7,39,55,38,53,52,54,51,50,21,20,7,23,23,20,6,6,7,55,54,
+3,19,232,2,15,11,32,53,11,31,62,45,60,5,89,96,68,4,80,74,98,53,79,13,32,2,
+17,105,127,7,176,66,12,58,9,9,16,45,31,41,13,79,23,39,37,80,45,16,66,60,101,
+75,27,29,197,16,15,27,45,39,58,59,1,127,254,12,0,0,5,255,81,3,139,1,40,6,
+23,0,38,0,75,0,86,0,87,0,88,0,0,3,34,38,53,55,55,52,35,34,6,7,39,54,54,51,
+50,21,20,7,54,55,38,38,53,52,54,51,50,22,21,20,7,23,6,6,35,39,6,6,37,22,21,
+20,6,35,34,39,6,6,35,34,38,53,52,55,23,6,21,20,51,50,54,53,39,55,22,22,51,
+50,54,55,38,39,39,52,54,39,52,38,35,34,6,21,20,23,55,54,3,3,27,6,45,4,3,18,
+10,27,32,17,32,56,18,52,7,71,52,40,36,77,42,26,44,8,63,3,39,41,27,40,115,
+1,5,33,58,41,43,21,14,51,26,36,47,22,28,7,44,20,28,3,43,7,34,36,11,21,3,3,
+26,3,30,84,20,23,18,27,79,4,5,26,71,4,136,35,4,21,33,31,13,15,20,43,38,73,
+28,26,16,39,22,45,31,47,79,62,69,35,18,4,32,23,2,40,68,53,64,59,45,70,31,
+35,36,46,44,40,44,6,24,24,51,30,26,63,28,60,47,15,8,19,55,16,17,34,166,26,
+44,23,9,45,30,9,16,254,57,2,140,0,5,255,227,2,135,1,105,4,185,0,36,0,44,0,
+52,0,53,0,54,0,0,1,22,21,20,6,35,34,39,6,6,35,34,38,53,52,55,23,6,21,20,51,
+50,54,53,39,55,22,22,51,50,54,55,38,39,39,52,54,19,23,20,6,6,7,55,54,55,23,
+20,6,6,7,55,54,23,3,1,19,34,59,41,43,21,14,50,27,36,47,22,28,7,44,21,27,2,
+43,6,28,42,11,22,3,6,24,3,27,107,1,28,199,131,6,95,241,1,23,173,162,6,95,
+91,64,4,168,63,60,45,70,31,35,36,45,45,40,44,6,32,16,51,30,26,63,28,51,56,
+15,8,28,46,15,16,34,254,169,13,27,30,83,41,67,27,207,13,25,29,73,54,67,27,
+202,2,50,0,0,5,255,169,3,146,1,44,5,218,0,36,0,44,0,52,0,53,0,54,0,0,1,22,
+21,20,6,35,34,39,6,6,35,34,38,53,52,55,23,6,21,20,51,50,54,53,39,55,22,22,
+51,50,54,55,38,39,39,52,54,55,23,20,6,6,7,55,54,55,23,20,6,6,7,55,54,19,3,
+1,11,33,59,41,40,24,14,50,27,36,47,22,28,7,44,21,28,3,43,6,29,41,11,22,3,
+7,23,3,31,37,1,28,199,131,6,95,241,1,23,173,162,6,95,122,57,4,190,64,59,47,
+68,30,35,36,46,44,40,44,5,31,18,50,29,26,64,27,50,56,14,8,31,43,15,18,35,
+142,13,27,30,83,41,67,27,207,13,25,29,73,54,67,27,254,68,2,72,0,0,4,255,178,
+3,137,1,44,5,113,0,36,0,44,0,45,0,46,0,0,1,22,21,20,6,35,34,39,6,6,35,34,
+38,53,52,55,23,6,21,20,51,50,54,53,39,55,22,22,51,50,54,55,38,39,39,52,54,
+55,23,20,7,6,7,55,54,3,3,1,11,33,57,42,43,21,14,50,27,36,48,23,28,7,44,20,
+28,2,42,8,35,33,12,21,3,6,23,3,30,44,2,47,102,223,9,218,13,44,4,180,64,59,
+45,70,31,35,36,45,45,38,46,6,24,24,51,30,26,63,28,64,43,15,8,26,48,16,17,
+34,154,21,53,19,48,72,88,68,254,121,1,232,0,5,255,155,3,146,1,44,6,23,0,25,
+0,62,0,73,0,74,0,75,0,0,3,54,54,55,55,38,38,53,52,54,51,50,22,21,20,7,23,
+6,6,35,39,6,6,35,34,38,37,22,21,20,6,35,34,39,6,6,35,34,38,53,52,55,23,6,
+21,20,51,50,54,53,39,55,22,22,51,50,54,55,38,39,39,52,54,39,52,38,35,34,6,
+21,20,23,55,54,3,3,101,50,103,37,2,31,45,78,41,26,44,9,64,3,38,41,25,53,103,
+38,27,32,1,112,33,59,40,43,22,14,49,27,36,48,23,28,7,43,21,28,3,43,7,36,33,
+12,21,3,6,23,3,29,94,21,23,18,27,80,4,5,20,86,4,186,9,40,25,2,14,52,32,48,
+77,61,69,28,25,4,32,24,2,53,58,28,29,64,59,47,68,30,35,36,46,44,38,46,5,25,
+24,51,30,26,64,27,62,44,14,8,29,45,16,18,34,150,27,44,23,9,46,29,9,16,254,
+78,2,133,0,4,255,225,2,232,1,100,4,196,0,37,0,45,0,46,0,47,0,0,1,22,22,21,
+20,6,35,34,39,6,6,35,34,38,53,52,55,23,6,21,20,51,50,54,53,39,55,22,22,51,
+50,54,55,38,39,39,52,54,23,23,20,7,6,7,55,54,7,3,1,18,18,15,59,40,42,23,14,
+50,27,36,47,23,27,6,43,21,28,3,43,8,35,33,11,22,2,3,25,3,30,99,2,46,104,223,
+10,198,49,26,4,180,36,71,16,46,68,30,35,36,46,43,39,46,5,22,27,51,30,26,63,
+28,64,43,15,7,19,56,16,17,34,242,21,53,19,49,71,88,62,149,1,219,0,1,0,167,
+255,252,3,130,4,182,0,34,0,0,1,38,38,35,34,6,21,20,23,30,2,21,7,38,39,38,
+38,53,52,54,51,50,22,23,54,54,55,22,21,20,7,6,6,7,2,59,31,132,72,34,38,115,
+84,58,32,78,25,84,123,76,110,120,59,128,46,46,111,106,5,62,66,61,46,2,141,
+144,192,39,26,86,230,171,169,174,79,19,161,158,229,211,61,105,242,147,115,
+103,125,77,30,39,130,60,60,87,109,0,0,2,0,56,0,0,2,244,4,139,0,28,0,29,0,
+0,37,20,6,7,6,35,34,38,39,38,38,53,52,18,1,54,55,22,21,20,7,0,6,6,21,22,22,
+51,50,3,2,244,59,48,100,185,78,179,34,11,6,201,1,34,51,51,41,49,254,221,142,
+72,35,169,93,163,52,196,78,89,10,19,21,10,45,55,46,159,1,91,1,77,58,69,43,
+56,64,61,254,156,187,124,37,17,26,3,223,0,255,255,255,238,255,150,2,41,7,
+94,2,38,1,177,0,0,0,7,2,26,0,133,1,192,255,255,0,125,254,15,2,41,5,194,2,
+38,1,177,0,0,0,7,0,95,0,193,255,15,255,255,0,156,255,150,2,125,5,235,2,38,
+1,177,0,0,0,7,0,84,1,133,0,69,255,255,0,70,253,252,3,226,4,136,2,38,1,246,
+0,0,0,7,0,84,2,200,254,226,255,255,0,70,253,252,3,226,4,136,2,38,1,246,0,
+0,0,39,0,79,0,166,255,85,0,7,0,84,2,200,254,226,255,255,0,98,253,134,5,162,
+3,1,2,38,1,247,0,0,0,7,2,7,2,248,254,28,255,255,0,143,254,100,6,175,3,199,
+2,38,2,9,0,0,0,39,1,122,1,132,255,216,0,7,0,82,3,38,250,216,255,255,255,239,
+254,145,2,48,4,185,2,38,2,8,0,0,0,39,0,82,0,129,251,5,0,7,1,122,255,100,0,
+202,255,255,255,239,254,100,3,5,3,141,2,38,2,12,0,0,0,38,1,122,3,158,0,7,
+0,82,1,0,250,216,255,255,0,143,255,150,6,175,4,54,2,38,2,9,0,0,0,7,1,126,
+1,106,0,69,255,255,255,239,255,150,2,134,5,40,2,38,2,10,0,0,0,7,1,126,255,
+184,1,55,255,255,255,239,255,150,3,5,3,252,2,38,2,12,0,0,0,6,1,126,233,11,
+255,255,0,133,253,83,5,119,5,5,2,38,1,191,0,0,0,7,2,7,2,0,0,32,255,255,255,
+239,255,150,4,208,4,221,2,38,1,192,0,0,0,7,2,7,1,216,255,248,255,255,255,
+239,255,150,5,118,4,221,2,38,1,193,0,0,0,7,2,7,1,218,255,248,255,255,0,133,
+253,83,5,119,5,118,0,38,1,191,0,0,0,7,1,131,1,187,1,33,255,255,255,239,255,
+150,4,208,5,78,2,38,1,192,0,0,0,7,1,131,1,147,0,249,255,255,255,239,255,150,
+5,118,5,77,2,38,1,193,0,0,0,7,1,131,1,150,0,248,255,255,0,133,253,83,5,119,
+4,245,2,38,1,191,0,0,0,7,1,124,0,250,0,243,255,255,255,239,255,150,4,208,
+4,205,2,38,1,192,0,0,0,7,1,124,0,210,0,203,255,255,255,239,255,150,5,118,
+4,205,2,38,1,193,0,0,0,7,1,124,0,212,0,203,255,255,0,70,254,100,3,237,3,148,
+2,38,1,197,0,0,0,7,0,82,1,102,250,216,255,255,0,70,254,82,3,237,3,148,2,38,
+1,197,0,0,0,6,1,121,118,243,255,255,0,70,254,82,3,237,5,109,2,38,1,197,0,
+0,0,38,1,121,118,243,0,7,2,19,1,108,0,231,255,255,0,70,255,150,3,237,5,90,
+2,38,1,197,0,0,0,7,1,126,255,252,1,105,255,255,0,70,255,150,3,237,5,80,2,
+38,1,197,0,0,0,7,1,128,0,97,1,64,255,255,255,186,253,250,3,66,4,213,2,38,
+1,199,0,0,0,6,2,24,65,20,255,255,255,186,252,200,3,66,3,30,2,38,1,199,0,0,
+0,7,0,82,0,76,249,60,255,255,255,186,252,182,3,66,3,30,2,38,1,199,0,0,0,7,
+1,121,255,91,254,87,255,255,255,186,252,121,3,66,3,30,2,38,1,199,0,0,0,7,
+5,237,255,208,254,206,255,255,255,186,252,182,3,66,3,30,2,38,1,199,0,0,0,
+39,1,121,255,144,1,140,0,7,1,121,255,91,254,87,255,255,255,186,253,250,3,
+66,4,117,2,38,1,199,0,0,0,7,1,122,255,218,0,134,255,255,255,186,253,250,3,
+66,4,218,2,38,1,199,0,0,0,7,1,128,0,37,0,202,255,255,0,139,253,232,8,68,4,
+5,2,38,1,201,0,0,0,39,1,120,4,50,0,35,0,7,1,121,4,105,255,193,255,255,255,
+239,254,82,4,219,4,5,2,38,1,202,0,0,0,39,1,120,1,28,0,35,0,7,1,121,1,61,255,
+243,255,255,255,239,254,82,5,112,4,5,2,38,1,203,0,0,0,39,1,120,1,50,0,35,
+0,7,1,121,1,53,255,243,255,255,0,139,253,189,8,68,2,164,2,38,1,201,0,0,0,
+7,1,125,4,44,255,198,255,255,255,239,253,239,4,219,2,184,2,38,1,202,0,0,0,
+7,1,125,1,0,255,248,255,255,255,239,253,239,5,112,2,164,2,38,1,203,0,0,0,
+7,1,125,0,248,255,248,255,255,0,139,253,189,8,68,4,85,2,38,1,201,0,0,0,39,
+1,124,4,11,0,83,0,7,1,125,4,44,255,198,255,255,255,239,253,239,4,219,4,85,
+2,38,1,202,0,0,0,39,1,124,0,245,0,83,0,7,1,125,1,0,255,248,255,255,255,239,
+253,239,5,112,4,85,2,38,1,203,0,0,0,39,1,124,1,11,0,83,0,7,1,125,0,248,255,
+248,255,255,0,139,253,232,8,238,3,63,2,38,1,207,0,0,0,7,1,123,4,221,255,254,
+255,255,255,239,254,93,5,191,3,63,2,38,1,208,0,0,0,7,1,123,2,89,255,254,255,
+255,255,239,254,93,6,92,3,63,2,38,1,209,0,0,0,7,1,123,2,90,255,254,255,255,
+0,139,253,232,8,238,4,240,2,38,1,207,0,0,0,7,1,124,4,19,0,238,255,255,255,
+239,255,150,5,191,4,240,2,38,1,208,0,0,0,7,1,124,1,125,0,238,255,255,255,
+239,255,150,6,92,4,241,2,38,1,209,0,0,0,7,1,124,1,125,0,239,255,255,0,87,
+255,130,6,87,5,94,2,38,1,213,0,0,0,7,1,124,2,124,1,42,255,255,255,239,255,
+150,4,224,5,94,2,38,1,214,0,0,0,7,1,124,1,157,1,66,255,255,255,239,255,150,
+5,43,5,94,2,38,1,215,0,0,0,7,1,124,1,160,1,66,255,255,0,140,253,83,4,85,5,
+19,2,38,1,219,0,0,0,7,1,124,0,56,1,17,255,255,255,239,255,150,3,214,5,19,
+2,38,1,220,0,0,0,7,1,124,255,245,1,17,255,255,255,239,255,150,3,114,5,19,
+2,38,1,221,0,0,0,7,1,124,255,239,1,17,255,255,0,139,254,82,6,173,3,133,2,
+38,2,14,0,0,0,7,1,121,3,127,255,243,255,255,255,239,254,82,2,244,4,26,2,38,
+2,15,0,0,0,6,1,121,92,243,255,255,255,239,254,82,3,59,3,98,2,38,2,13,0,0,
+0,6,1,121,25,243,255,255,0,139,254,82,6,173,4,230,2,38,2,14,0,0,0,39,1,120,
+3,90,1,4,0,7,1,121,3,127,255,243,255,255,255,239,254,82,2,244,5,123,2,38,
+2,15,0,0,0,39,1,120,255,247,1,153,0,6,1,121,92,243,255,255,255,239,254,82,
+3,59,4,195,2,38,2,13,0,0,0,39,1,120,255,254,0,225,0,6,1,121,25,243,255,255,
+0,139,253,239,6,173,3,133,2,38,2,14,0,0,0,7,1,125,3,66,255,248,255,255,255,
+239,253,239,2,244,4,26,2,38,2,15,0,0,0,6,1,125,31,248,255,255,255,239,253,
+239,3,59,3,98,2,38,2,13,0,0,0,6,1,125,220,248,255,255,0,68,253,132,5,69,4,
+142,2,38,2,4,0,0,0,7,1,120,1,98,0,172,255,255,0,68,253,132,5,69,4,222,2,38,
+2,4,0,0,0,7,1,124,1,59,0,220,0,4,0,18,255,150,8,168,4,138,0,59,0,60,0,61,
+0,62,0,0,33,35,34,38,38,39,55,22,33,32,36,55,38,38,35,34,5,4,35,34,38,53,
+52,62,2,55,22,21,20,7,14,2,21,20,22,51,50,37,36,51,50,22,22,21,7,23,22,51,
+50,21,21,20,35,34,39,39,4,4,3,1,21,2,74,83,241,177,66,1,3,232,1,46,1,127,
+2,214,233,31,139,117,130,254,227,254,226,150,137,122,78,161,225,114,5,93,
+86,220,111,150,73,117,1,28,1,27,125,102,171,96,4,15,93,121,17,17,141,121,
+10,254,213,253,50,114,3,59,39,77,54,35,49,33,29,89,79,16,17,87,102,79,150,
+143,118,30,26,24,112,37,36,125,94,28,27,41,15,14,69,128,88,39,8,53,17,122,
+17,83,6,43,46,4,138,251,58,46,0,4,255,239,255,150,6,177,4,138,0,46,0,47,0,
+48,0,49,0,0,49,34,53,53,52,51,32,36,55,38,38,35,34,5,4,35,34,38,53,52,54,
+36,55,22,21,20,6,7,14,2,21,20,22,51,50,37,36,51,50,22,22,21,20,7,6,4,19,1,
+21,17,17,2,182,2,241,189,31,139,117,130,254,227,254,226,150,137,122,144,1,
+35,143,5,33,60,86,220,111,150,73,115,1,29,1,29,124,102,171,96,44,245,252,
+67,64,3,47,17,122,17,32,30,89,79,16,17,87,102,108,201,174,37,25,24,37,88,
+25,36,125,94,28,27,41,15,14,69,128,88,69,97,43,47,4,138,251,58,46,0,0,4,255,
+239,255,150,7,165,4,138,0,54,0,55,0,56,0,57,0,0,33,34,39,6,4,33,34,53,53,
+52,51,32,36,55,38,38,35,34,5,4,35,34,38,53,52,54,36,55,22,21,20,6,7,14,2,
+21,20,22,51,50,37,36,51,50,22,22,21,7,22,51,50,21,21,20,1,1,21,7,147,142,
+129,245,252,73,254,40,17,17,2,182,2,241,189,31,139,117,130,254,227,254,226,
+150,137,122,144,1,35,143,5,33,60,86,220,111,150,73,115,1,29,1,29,124,102,
+171,96,3,99,130,18,250,120,3,83,90,43,47,17,122,17,32,30,89,79,16,17,87,102,
+108,201,174,37,25,24,37,88,25,36,125,94,28,27,41,15,14,69,128,88,38,62,17,
+122,17,4,138,251,58,46,0,255,255,0,137,255,150,6,67,5,60,2,38,1,97,0,0,0,
+7,0,82,3,244,255,155,255,255,255,239,255,150,3,45,5,60,2,38,1,232,0,0,0,7,
+0,82,1,115,255,184,255,255,255,239,255,150,3,207,5,60,2,38,1,233,0,0,0,7,
+0,82,1,97,255,152,255,255,0,139,255,150,6,7,5,94,2,38,1,231,0,0,0,7,1,120,
+1,66,0,215,255,255,255,239,255,150,3,45,6,125,2,38,1,232,0,0,0,7,3,109,1,
+81,2,40,255,255,255,239,255,150,3,207,6,125,2,38,1,233,0,0,0,7,3,109,1,149,
+2,40,255,255,0,139,253,239,6,7,5,94,2,38,1,231,0,0,0,7,1,125,1,75,255,248,
+255,255,255,239,253,239,3,45,5,60,2,38,1,232,0,0,0,6,1,125,224,248,255,255,
+255,239,253,239,3,207,5,60,2,38,1,233,0,0,0,6,1,125,229,248,255,255,0,137,
+255,150,6,67,6,5,2,38,1,97,0,0,0,39,0,82,3,244,255,155,0,7,3,13,3,168,255,
+77,255,255,255,208,255,150,3,45,6,5,2,38,1,232,0,0,0,39,3,12,1,98,255,89,
+0,7,0,82,1,120,255,187,255,255,255,167,255,150,3,207,6,5,2,38,1,233,0,0,0,
+39,3,13,1,30,255,77,0,7,0,82,1,115,255,159,255,255,0,137,253,129,6,67,6,5,
+2,38,1,97,0,0,0,39,3,13,3,168,255,77,0,7,1,132,2,219,255,183,255,255,255,
+208,253,129,3,45,6,5,2,38,1,232,0,0,0,39,3,12,1,98,255,89,0,7,1,132,0,163,
+255,183,255,255,255,167,253,129,3,207,6,5,2,38,1,233,0,0,0,39,3,13,1,30,255,
+77,0,7,1,132,0,168,255,183,255,255,0,137,255,150,6,67,7,121,2,38,1,97,0,0,
+0,39,3,13,3,168,255,77,0,7,3,105,4,17,0,148,255,255,255,204,255,150,3,45,
+7,123,2,38,1,232,0,0,0,39,3,12,1,94,255,89,0,7,3,105,1,89,0,150,255,255,255,
+167,255,150,3,207,7,123,2,38,1,233,0,0,0,39,3,13,1,30,255,77,0,7,3,105,1,
+134,0,150,255,255,0,68,253,132,4,222,7,87,2,38,1,234,0,0,0,7,0,90,2,33,3,
+73,255,255,255,196,255,150,1,58,7,87,2,38,1,235,0,0,0,7,0,90,255,136,3,73,
+255,255,255,196,255,150,2,24,7,87,2,38,1,236,0,0,0,7,0,90,255,136,3,73,255,
+255,0,68,253,132,4,222,7,35,2,38,1,234,0,0,0,7,1,120,1,161,3,65,255,255,255,
+236,255,150,1,58,7,35,2,38,1,235,0,0,0,7,1,120,255,7,3,65,255,255,255,239,
+255,150,2,24,7,35,2,38,1,236,0,0,0,7,1,120,255,8,3,65,255,255,0,68,253,132,
+4,222,7,115,2,38,1,234,0,0,0,7,1,124,1,122,3,113,255,255,255,154,255,150,
+1,167,7,115,2,38,1,235,0,0,0,7,1,124,254,224,3,113,255,255,255,154,255,150,
+2,24,7,116,2,38,1,236,0,0,0,7,1,124,254,224,3,114,255,255,0,68,251,221,4,
+222,5,194,2,38,1,234,0,0,0,7,1,125,0,197,253,230,0,6,255,239,253,239,2,64,
+5,194,0,20,0,27,0,35,0,43,0,44,0,45,0,0,49,34,53,53,52,51,50,36,55,2,3,54,
+55,22,19,18,23,20,7,6,4,5,6,7,38,39,54,55,7,6,7,38,39,54,55,22,23,6,7,38,
+39,54,55,22,19,3,17,17,122,1,31,79,38,65,59,78,10,23,19,2,71,15,254,210,1,
+82,37,73,76,47,54,66,181,34,75,75,47,28,91,24,242,66,41,57,59,62,48,31,108,
+131,17,122,17,31,25,1,240,2,40,60,54,220,254,153,254,200,207,68,137,31,40,
+216,57,68,57,56,48,74,137,53,72,58,55,25,99,28,248,73,29,35,67,56,58,40,7,
+15,248,45,255,255,255,239,253,239,2,24,5,194,2,38,1,236,0,0,0,7,1,125,255,
+94,255,248,255,255,0,68,252,64,4,210,2,254,2,38,1,109,0,0,0,39,1,121,0,168,
+253,225,0,7,1,120,0,130,255,28,255,255,255,239,254,83,1,204,4,195,2,38,2,
+8,0,0,0,39,1,120,255,129,0,225,0,6,1,121,144,244,255,255,255,239,254,82,2,
+121,3,151,2,38,2,11,0,0,0,38,1,120,148,181,0,6,1,121,231,243,255,255,0,68,
+252,82,4,210,2,254,2,38,1,109,0,0,0,39,1,120,0,130,255,28,0,7,0,82,1,153,
+248,198,255,255,255,239,254,145,1,204,4,195,2,38,2,8,0,0,0,39,1,120,255,129,
+0,225,0,7,0,82,0,129,251,5,255,255,255,239,254,100,2,121,3,151,2,38,2,11,
+0,0,0,39,0,82,0,217,250,216,0,6,1,120,148,181,255,255,0,68,253,132,4,210,
+3,78,2,38,1,109,0,0,0,7,1,124,0,91,255,76,255,255,0,133,253,83,5,119,4,165,
+2,38,1,191,0,0,0,39,1,125,0,240,0,192,0,7,1,120,1,34,0,195,255,255,255,239,
+253,239,4,208,4,125,2,38,1,192,0,0,0,39,1,120,0,249,0,155,0,7,1,125,0,221,
+255,248,255,255,255,239,253,239,5,118,4,124,2,38,1,193,0,0,0,39,1,120,0,251,
+0,154,0,7,1,125,0,219,255,248,255,255,0,70,253,252,3,226,4,66,2,38,1,246,
+0,0,0,7,0,82,1,34,251,23,0,4,0,139,253,131,6,183,1,61,0,49,0,50,0,51,0,52,
+0,0,5,52,55,7,7,38,53,55,62,2,55,23,6,21,20,22,51,50,54,54,55,39,36,53,52,
+54,54,51,22,22,51,50,21,21,20,35,34,38,39,23,22,22,21,20,6,4,35,34,38,1,1,
+5,1,160,14,48,224,19,2,6,35,205,95,66,40,190,164,201,222,179,74,41,254,189,
+28,36,9,73,244,132,23,23,70,178,68,183,31,17,226,254,152,168,210,231,2,36,
+253,92,2,57,152,98,75,24,123,30,33,20,29,41,113,48,34,160,45,150,167,35,78,
+67,23,171,43,25,66,47,15,19,23,113,20,19,17,99,19,62,40,79,164,107,201,2,
+141,252,170,100,255,255,255,239,254,52,5,191,4,160,2,38,1,208,0,0,0,39,1,
+120,1,165,0,190,0,7,1,121,2,112,255,213,255,255,255,239,254,53,6,92,4,160,
+2,38,1,209,0,0,0,39,1,121,2,113,255,214,0,7,1,120,1,164,0,190,255,255,0,139,
+253,232,8,238,4,160,2,38,1,207,0,0,0,39,1,121,4,244,255,213,0,7,1,120,4,58,
+0,190,255,255,255,239,254,53,3,214,4,195,2,38,1,220,0,0,0,39,1,120,0,28,0,
+225,0,7,1,121,0,197,255,214,255,255,255,239,254,52,3,114,4,195,2,38,1,221,
+0,0,0,39,1,120,0,22,0,225,0,6,1,121,80,213,255,255,0,140,253,83,4,85,4,195,
+2,38,1,219,0,0,0,39,1,120,0,95,0,225,0,7,1,121,1,17,0,66,255,255,255,137,
+255,150,3,187,6,88,2,38,2,1,0,0,0,7,2,26,0,32,0,186,255,255,255,197,255,150,
+5,4,6,69,2,38,2,2,0,0,0,7,2,26,0,92,0,167,255,255,0,71,254,17,3,187,5,229,
+2,38,2,1,0,0,0,7,0,95,0,252,255,17,255,255,0,70,254,15,5,4,5,194,2,38,2,2,
+0,0,0,7,0,95,1,66,255,15,255,255,0,71,255,150,3,187,6,69,2,38,2,1,0,0,0,7,
+0,84,1,30,0,159,255,255,0,70,255,150,5,4,6,51,2,38,2,2,0,0,0,7,0,84,1,63,
+0,141,255,255,0,71,255,150,3,187,7,122,2,38,2,1,0,0,0,7,0,90,1,230,3,108,
+255,255,0,70,255,150,5,4,7,87,2,38,2,2,0,0,0,7,0,90,2,134,3,73,255,255,0,
+71,255,150,3,187,7,70,2,38,2,1,0,0,0,7,1,120,1,101,3,100,255,255,0,70,255,
+150,5,4,7,35,2,38,2,2,0,0,0,7,1,120,2,5,3,65,255,255,0,71,255,150,4,6,7,150,
+2,38,2,1,0,0,0,7,1,124,1,63,3,148,255,255,0,70,255,150,5,4,7,116,2,38,2,2,
+0,0,0,7,1,124,1,221,3,114,255,255,0,71,253,239,4,7,5,229,0,38,2,1,0,0,0,7,
+1,125,1,79,255,248,255,255,0,70,253,239,5,4,5,194,2,38,2,2,0,0,0,7,1,125,
+2,13,255,248,255,255,0,70,255,150,3,237,5,78,2,38,1,197,0,0,0,7,2,25,0,186,
+0,146,255,255,255,186,253,250,3,66,4,216,2,38,1,199,0,0,0,6,2,25,126,28,255,
+255,0,35,255,130,5,53,5,179,2,38,1,115,0,0,0,7,2,25,1,46,0,247,255,255,255,
+239,255,110,3,167,5,149,2,38,1,244,0,0,0,7,2,25,0,92,0,217,255,255,255,239,
+255,130,4,62,5,179,2,38,1,117,0,0,0,7,2,25,0,52,0,247,255,255,0,143,254,93,
+6,175,2,112,2,38,2,9,0,0,0,7,2,23,1,173,0,8,255,255,255,239,254,93,3,107,
+3,98,2,38,3,117,0,0,0,6,2,23,189,8,255,255,255,239,254,93,4,10,2,54,2,38,
+3,118,0,0,0,6,2,23,54,8,255,255,255,239,254,82,2,33,5,19,2,38,2,8,0,0,0,38,
+1,121,144,243,0,7,1,124,255,90,1,17,255,255,255,239,254,82,2,121,3,231,2,
+38,2,11,0,0,0,38,1,121,231,243,0,7,1,124,255,109,255,229,255,255,0,143,254,
+82,6,175,4,33,2,38,2,9,0,0,0,39,1,121,2,53,255,243,0,7,1,124,1,122,0,31,255,
+255,0,143,253,233,6,175,2,112,2,38,2,9,0,0,0,7,1,127,1,236,255,204,255,255,
+255,239,253,233,2,110,3,98,0,38,2,10,0,0,0,6,1,127,171,204,255,255,255,239,
+253,233,3,5,2,54,2,38,2,12,0,0,0,6,1,127,198,204,255,255,0,143,253,233,6,
+175,3,199,2,38,2,9,0,0,0,39,1,127,1,236,255,204,0,7,1,122,1,132,255,216,255,
+255,255,239,253,233,2,158,4,185,0,38,2,10,0,0,0,38,1,127,171,204,0,7,1,122,
+255,210,0,202,255,255,255,239,253,233,3,5,3,141,2,38,2,12,0,0,0,38,1,122,
+3,158,0,6,1,127,198,204,255,255,0,143,254,93,6,175,3,209,2,38,2,9,0,0,0,39,
+1,120,1,161,255,239,0,7,1,123,2,30,255,254,255,255,255,239,254,93,2,134,4,
+195,2,38,2,10,0,0,0,38,1,123,221,254,0,7,1,120,255,239,0,225,255,255,255,
+239,254,93,3,5,3,151,2,38,2,12,0,0,0,38,1,123,248,254,0,6,1,120,32,181,255,
+255,0,143,254,20,6,175,2,112,2,38,2,9,0,0,0,7,5,238,2,235,0,105,255,255,255,
+239,254,20,2,87,3,98,2,38,2,10,0,0,0,7,5,238,0,170,0,105,255,255,255,239,
+254,20,3,5,2,54,2,38,2,12,0,0,0,7,5,238,0,197,0,105,255,255,0,143,255,150,
+6,175,4,39,2,38,2,9,0,0,0,7,2,24,1,235,255,102,255,255,255,239,255,150,2,
+87,5,25,2,38,2,10,0,0,0,6,2,24,57,88,255,255,255,239,255,150,3,5,3,238,2,
+38,2,12,0,0,0,7,2,24,0,106,255,45,255,255,0,133,253,83,5,119,4,155,0,38,1,
+191,0,0,0,7,1,122,1,4,0,172,255,255,255,239,255,150,4,208,4,115,2,38,1,192,
+0,0,0,7,1,122,0,220,0,132,255,255,255,239,255,150,5,118,4,115,2,38,1,193,
+0,0,0,7,1,122,0,221,0,132,255,255,0,133,253,83,5,119,3,68,2,38,1,191,0,0,
+0,7,1,127,0,223,0,252,255,255,255,239,253,233,4,208,3,28,2,38,1,192,0,0,0,
+7,1,127,0,209,255,204,255,255,255,239,253,233,5,118,3,28,2,38,1,193,0,0,0,
+7,1,127,0,207,255,204,255,255,0,70,253,129,3,237,5,109,2,38,1,197,0,0,0,39,
+1,132,0,251,255,183,0,7,2,19,1,108,0,231,255,255,0,70,254,20,3,237,3,148,
+2,38,1,197,0,0,0,7,5,238,1,43,0,105,0,3,255,186,253,250,3,66,3,30,0,39,0,
+40,0,41,0,0,23,33,54,55,38,39,38,38,53,52,54,55,22,23,22,22,23,22,51,50,21,
+21,20,35,34,39,6,6,35,34,38,39,55,22,51,50,54,54,55,33,19,3,181,1,102,24,
+18,27,35,72,65,63,56,15,26,65,45,5,69,91,17,17,96,71,35,247,170,49,170,49,
+28,112,81,73,122,100,31,254,216,206,174,2,48,54,66,63,124,151,51,52,63,28,
+56,68,171,154,52,41,17,122,17,50,214,254,77,38,68,23,40,76,41,3,131,250,220,
+0,255,255,0,139,253,232,8,68,4,96,2,38,1,201,0,0,0,7,1,128,4,96,0,80,255,
+255,255,239,255,150,4,219,4,96,2,38,1,202,0,0,0,7,1,128,1,74,0,80,255,255,
+255,239,255,150,5,112,4,96,2,38,1,203,0,0,0,7,1,128,1,96,0,80,255,255,0,140,
+253,83,4,85,4,185,0,38,1,219,0,0,0,7,1,122,0,66,0,202,255,255,255,239,255,
+150,3,214,4,185,2,38,1,220,0,0,0,7,1,122,255,255,0,202,255,255,255,239,255,
+150,3,114,4,185,2,38,1,221,0,0,0,7,1,122,255,249,0,202,255,255,0,140,253,
+83,4,85,5,40,2,38,1,219,0,0,0,7,1,126,0,40,1,55,255,255,255,239,255,150,3,
+214,5,40,2,38,1,220,0,0,0,7,1,126,255,229,1,55,255,255,0,0,255,150,3,131,
+5,40,0,38,1,221,17,0,0,7,1,126,255,240,1,55,255,255,0,140,253,83,4,85,5,148,
+2,38,1,219,0,0,0,7,1,131,0,249,1,63,255,255,255,239,255,150,3,214,5,148,2,
+38,1,220,0,0,0,7,1,131,0,182,1,63,255,255,0,0,255,150,3,131,5,148,0,38,1,
+221,17,0,0,7,1,131,0,193,1,63,255,255,0,139,254,93,6,173,3,133,2,38,2,14,
+0,0,0,7,1,123,3,103,255,254,255,255,255,239,254,93,2,244,4,26,2,38,2,15,0,
+0,0,6,1,123,69,254,255,255,255,239,254,93,3,59,3,98,2,38,2,13,0,0,0,6,1,123,
+3,254,255,255,0,139,253,233,6,173,3,133,2,38,2,14,0,0,0,7,1,127,3,54,255,
+204,255,255,255,239,253,233,2,244,4,26,2,38,2,15,0,0,0,6,1,127,19,204,255,
+255,255,239,253,233,3,59,3,98,2,38,2,13,0,0,0,6,1,127,210,204,255,255,0,137,
+255,150,6,67,6,125,2,38,1,97,0,0,0,7,3,109,4,31,2,40,255,255,255,239,255,
+150,3,45,6,125,2,38,1,232,0,0,0,7,3,109,1,81,2,40,255,255,255,239,255,150,
+3,207,6,125,2,38,1,233,0,0,0,7,3,109,1,149,2,40,255,255,0,137,255,150,6,67,
+6,176,2,38,1,97,0,0,0,7,3,105,4,57,255,203,255,255,255,239,255,150,3,45,6,
+176,2,38,1,232,0,0,0,7,3,105,1,107,255,203,255,255,255,239,255,150,3,207,
+6,176,2,38,1,233,0,0,0,7,3,105,1,175,255,203,255,255,0,137,253,233,6,67,5,
+60,2,38,1,97,0,0,0,7,1,127,2,12,255,204,255,255,255,239,253,233,3,45,5,60,
+2,38,1,232,0,0,0,6,1,127,212,204,255,255,255,239,253,233,3,207,5,60,2,38,
+1,233,0,0,0,6,1,127,217,204,255,255,0,139,253,143,4,97,4,125,0,38,1,237,0,
+0,0,7,1,120,0,154,0,155,255,255,255,239,255,130,3,69,4,125,2,38,1,238,0,0,
+0,7,1,120,0,95,0,155,255,255,255,239,255,130,3,113,4,125,2,38,1,239,0,0,0,
+7,1,120,255,243,0,155,255,255,0,139,253,143,4,97,3,28,0,38,1,237,0,0,0,7,
+1,121,1,63,255,151,255,255,255,239,254,62,3,69,3,28,2,38,1,238,0,0,0,6,1,
+121,102,223,255,255,255,239,254,62,3,113,3,28,2,38,1,239,0,0,0,6,1,121,123,
+223,255,255,0,68,252,75,4,210,2,254,2,38,1,109,0,0,0,39,1,123,0,145,253,236,
+0,7,1,120,0,130,255,28,255,255,255,239,254,93,2,134,4,195,2,38,2,10,0,0,0,
+38,1,123,221,254,0,7,1,120,255,239,0,225,255,255,255,239,254,93,3,5,3,151,
+2,38,2,12,0,0,0,38,1,120,32,181,0,6,1,123,249,254,255,255,0,68,253,132,4,
+210,4,216,2,38,1,109,0,0,0,39,1,120,0,130,255,28,0,7,2,19,1,183,0,82,255,
+255,255,239,255,150,1,252,5,217,2,38,3,15,0,0,0,38,1,120,151,30,0,7,2,19,
+0,204,1,83,255,255,255,226,255,150,2,108,5,112,0,38,2,11,243,0,0,38,1,120,
+135,181,0,7,2,19,0,188,0,234,255,255,0,68,253,132,4,210,4,163,2,38,1,109,
+0,0,0,39,1,120,0,131,255,10,0,7,2,24,0,201,255,226,255,255,255,239,255,150,
+1,207,5,183,2,38,3,15,0,0,0,38,1,120,151,30,0,7,2,24,255,221,0,246,255,255,
+255,239,255,150,2,121,5,78,2,38,2,11,0,0,0,38,1,120,148,181,0,7,2,24,255,
+218,0,141,255,255,0,68,253,132,4,222,5,194,2,38,1,234,0,0,0,7,3,207,2,104,
+0,0,255,255,255,236,255,150,1,233,5,194,2,38,1,235,0,0,0,6,3,205,0,0,255,
+255,255,239,255,150,2,24,5,194,2,38,1,236,0,0,0,6,3,205,0,0,255,255,255,186,
+253,250,3,66,5,80,2,38,1,199,0,0,0,7,1,131,0,145,0,251,255,255,255,186,253,
+250,3,66,4,163,2,38,1,199,0,0,0,7,0,84,1,10,254,253,255,255,0,139,253,232,
+8,68,4,214,2,38,1,201,0,0,0,7,1,131,4,204,0,129,255,255,255,239,255,150,4,
+219,4,214,2,38,1,202,0,0,0,7,1,131,1,182,0,129,255,255,255,239,255,150,5,
+112,4,214,2,38,1,203,0,0,0,7,1,131,1,204,0,129,255,255,0,70,253,252,3,226,
+4,132,2,38,1,246,0,0,0,7,1,122,0,55,0,149,255,255,0,70,253,252,3,226,4,142,
+2,38,1,246,0,0,0,7,1,120,0,84,0,172,255,255,255,239,254,93,2,134,5,25,2,38,
+2,10,0,0,0,38,1,123,221,254,0,6,2,24,57,88,255,255,255,239,254,93,3,5,3,238,
+2,38,2,12,0,0,0,39,2,24,0,106,255,45,0,6,1,123,249,254,255,255,0,98,253,134,
+5,162,2,247,2,38,1,247,0,0,0,7,2,24,1,94,254,54,255,255,0,98,251,223,5,162,
+1,64,2,38,1,247,0,0,0,7,1,125,0,147,253,232,255,255,255,239,254,82,4,219,
+4,85,2,38,1,202,0,0,0,39,1,124,0,245,0,83,0,7,1,121,1,61,255,243,255,255,
+255,239,254,82,5,112,4,85,2,38,1,203,0,0,0,39,1,124,1,11,0,83,0,7,1,121,1,
+53,255,243,255,255,0,139,253,232,8,68,4,85,2,38,1,201,0,0,0,39,1,124,4,11,
+0,83,0,7,1,121,4,105,255,193,255,255,0,71,255,150,4,25,5,229,2,38,2,1,0,0,
+0,7,3,205,2,48,0,160,255,255,0,70,255,150,5,4,5,194,2,38,2,2,0,0,0,7,3,205,
+2,186,1,1,0,2,254,110,4,192,1,177,6,172,0,13,0,14,0,0,1,38,53,52,55,55,1,
+22,21,7,6,7,7,4,37,254,127,17,4,103,2,183,33,1,9,49,123,254,251,254,220,4,
+192,70,26,10,2,51,1,77,25,37,14,43,23,55,115,95,0,2,254,137,4,178,2,43,6,
+184,0,15,0,16,0,0,1,38,53,52,55,54,55,36,55,22,21,7,6,7,7,4,39,254,153,16,
+4,175,240,1,11,211,33,1,11,48,251,254,227,234,4,178,67,27,12,2,86,106,119,
+99,25,36,15,45,20,110,122,144,0,5,255,239,255,150,2,229,3,154,0,23,0,34,0,
+35,0,36,0,37,0,0,37,38,38,53,52,54,54,51,50,22,22,21,20,7,6,4,33,34,53,53,
+52,51,50,55,19,34,6,6,21,20,22,22,23,38,38,3,19,21,1,96,110,106,78,128,68,
+88,151,92,72,126,254,237,254,246,19,19,193,150,29,42,73,45,90,181,155,32,
+151,77,122,170,25,122,108,99,187,111,138,234,134,70,138,59,49,19,118,19,13,
+1,223,53,87,43,61,92,56,14,179,227,1,18,252,42,46,0,0,4,255,239,255,150,1,
+207,2,159,0,20,0,21,0,22,0,23,0,0,49,34,53,53,52,51,50,54,55,38,39,38,53,
+52,55,22,21,20,6,7,6,19,3,21,17,17,89,202,74,16,31,22,127,40,38,34,214,129,
+84,17,122,17,22,18,62,78,53,20,90,72,212,73,30,113,65,78,2,159,253,37,46,
+0,0,1,0,4,255,66,1,152,1,224,0,3,0,0,1,1,35,1,1,152,254,225,117,1,2,1,224,
+253,98,2,158,0,255,255,0,139,255,150,8,217,7,35,0,38,3,209,0,0,0,38,3,210,
+14,106,0,7,0,39,7,108,0,0,255,255,255,239,253,233,1,204,5,35,2,38,1,113,0,
+0,0,6,2,7,67,62,255,255,255,239,253,220,3,76,3,57,2,38,1,114,0,0,0,7,2,7,
+1,31,254,84,0,4,255,222,3,150,1,48,6,115,0,37,0,50,0,51,0,52,0,0,1,22,22,
+21,20,6,35,34,39,6,6,35,34,38,53,52,55,23,6,21,20,51,50,54,53,39,55,22,22,
+51,50,54,55,38,39,39,52,54,3,22,22,21,20,7,39,52,39,38,53,52,54,19,3,1,15,
+18,15,59,40,42,23,14,50,27,36,47,23,27,6,43,21,28,3,43,7,36,33,11,22,2,3,
+25,3,30,137,19,8,45,11,30,6,36,62,88,4,193,37,70,16,47,68,31,35,37,46,44,
+40,44,5,20,29,50,30,26,63,27,62,44,14,8,19,56,16,17,34,1,133,101,101,59,87,
+63,3,145,125,22,17,35,53,253,96,2,221,0,255,255,0,85,2,230,1,114,4,211,2,
+7,0,107,0,0,3,172,255,255,0,98,252,85,5,162,1,64,2,38,1,247,0,0,0,7,0,82,
+1,193,248,201,255,255,255,239,254,100,1,204,3,98,2,38,2,8,0,0,0,7,0,82,0,
+129,250,216,255,255,255,239,254,100,2,121,2,54,2,38,2,11,0,0,0,7,0,82,0,216,
+250,216,255,255,0,137,255,150,6,67,6,64,2,38,1,97,0,0,0,7,3,104,4,240,0,49,
+255,255,255,239,255,150,3,45,6,64,2,38,1,232,0,0,0,7,3,104,2,34,0,49,255,
+255,255,239,255,150,3,207,6,64,2,38,1,233,0,0,0,7,3,104,2,102,0,49,255,255,
+0,137,253,239,6,67,5,60,2,38,1,97,0,0,0,7,1,125,2,24,255,248,255,255,255,
+239,253,239,3,45,5,60,2,38,1,232,0,0,0,6,1,125,224,248,255,255,255,239,253,
+239,3,207,5,60,2,38,1,233,0,0,0,6,1,125,229,248,255,255,0,98,253,134,5,162,
+2,250,2,38,1,247,0,0,0,7,2,25,1,155,254,62,255,255,255,239,254,93,2,133,5,
+28,2,38,2,10,0,0,0,38,2,25,118,96,0,6,1,123,220,254,255,255,255,239,254,93,
+3,5,3,241,2,38,2,12,0,0,0,39,2,25,0,166,255,53,0,6,1,123,248,254,255,255,
+0,98,253,134,5,162,2,151,2,38,1,247,0,0,0,7,1,122,0,247,254,168,255,255,255,
+236,254,93,2,48,4,185,2,38,2,8,0,0,0,39,1,122,255,100,0,202,0,7,1,123,255,
+121,255,254,255,255,255,239,254,92,3,5,3,141,2,38,2,12,0,0,0,38,1,122,3,158,
+0,6,1,123,248,253,255,255,0,98,253,134,5,162,2,241,2,38,1,247,0,0,0,7,1,124,
+0,237,254,239,255,255,255,237,254,93,2,35,5,19,0,38,2,8,0,0,0,39,1,124,255,
+90,1,17,0,7,1,123,255,122,255,254,255,255,255,239,254,93,3,5,3,231,2,38,2,
+12,0,0,0,38,1,124,249,229,0,6,1,123,247,254,255,255,0,133,253,83,5,119,3,
+68,2,38,1,191,0,0,0,7,3,107,1,177,251,235,255,255,255,239,253,221,4,208,3,
+28,2,38,1,192,0,0,0,7,3,107,2,44,251,73,255,255,255,239,253,221,5,118,3,28,
+2,38,1,193,0,0,0,7,3,107,2,44,251,73,255,255,0,139,253,232,8,68,5,57,2,38,
+1,201,0,0,0,7,3,107,4,174,0,16,255,255,255,239,255,150,4,219,5,57,2,38,1,
+202,0,0,0,7,3,107,1,152,0,16,255,255,255,239,255,150,5,112,5,57,2,38,1,203,
+0,0,0,7,3,107,1,174,0,16,255,255,255,186,253,250,3,66,5,179,2,38,1,199,0,
+0,0,7,3,107,0,115,0,138,255,255,0,133,253,83,5,119,5,29,0,38,1,191,0,0,0,
+7,2,19,2,90,0,151,255,255,255,239,255,150,4,208,4,245,2,38,1,192,0,0,0,7,
+2,19,2,50,0,111,255,255,255,239,255,150,5,118,4,245,2,38,1,193,0,0,0,7,2,
+19,2,52,0,111,255,255,255,155,255,150,2,41,5,192,2,38,2,6,0,0,0,7,3,99,255,
+71,255,166,255,255,255,153,255,150,2,41,5,192,2,38,2,6,0,0,0,7,3,100,255,
+108,255,165,255,255,0,98,253,134,5,162,2,144,2,38,1,247,0,0,0,7,3,99,2,12,
+252,118,255,255,255,217,254,93,2,34,4,145,0,38,2,8,0,0,0,39,1,123,255,121,
+255,254,0,7,3,99,255,133,254,119,255,255,255,239,254,93,3,5,3,226,2,38,2,
+12,0,0,0,38,1,123,249,254,0,7,3,99,0,26,253,200,255,255,0,98,253,134,5,162,
+2,146,2,38,1,247,0,0,0,7,3,100,2,51,252,119,255,255,255,216,254,93,2,34,4,
+146,0,38,2,8,0,0,0,39,1,123,255,121,255,254,0,7,3,100,255,171,254,119,255,
+255,255,239,254,93,3,5,3,228,2,38,2,12,0,0,0,38,1,123,249,254,0,7,3,100,0,
+64,253,201,255,255,0,98,251,12,5,162,1,64,2,38,1,247,0,0,0,7,3,108,1,70,247,
+151,255,255,255,239,253,74,1,204,3,98,0,38,2,8,0,0,0,7,3,108,0,8,249,213,
+255,255,255,239,253,74,3,5,2,54,2,38,2,12,0,0,0,7,3,108,0,134,249,213,255,
+255,255,255,253,252,3,226,4,71,2,38,1,246,0,0,0,7,3,99,255,171,254,45,255,
+255,255,255,253,252,3,226,4,72,2,38,1,246,0,0,0,7,3,100,255,210,254,45,255,
+255,255,217,255,150,1,204,4,145,0,38,2,8,0,0,0,7,3,99,255,133,254,119,255,
+255,255,239,255,150,3,5,3,226,2,38,2,12,0,0,0,7,3,99,0,26,253,200,255,255,
+0,71,253,250,4,174,2,252,0,38,1,118,222,0,0,7,3,99,0,19,252,226,255,255,255,
+216,255,150,1,204,4,146,0,38,2,8,0,0,0,7,3,100,255,171,254,119,255,255,255,
+239,255,150,3,5,3,228,2,38,2,12,0,0,0,7,3,100,0,64,253,201,255,255,0,71,253,
+250,4,174,2,252,0,38,1,118,222,0,0,7,3,100,0,58,252,225,255,255,0,133,253,
+83,5,119,3,68,2,38,1,191,0,0,0,7,3,108,1,173,250,243,255,255,255,239,253,
+201,4,208,3,28,2,38,1,192,0,0,0,7,3,108,2,114,250,84,255,255,255,239,253,
+28,5,118,3,28,2,38,1,193,0,0,0,7,3,108,1,143,249,167,255,255,0,139,253,232,
+8,68,5,30,2,38,1,201,0,0,0,7,3,108,4,196,255,47,255,255,255,239,255,150,4,
+219,5,30,2,38,1,202,0,0,0,7,3,108,1,174,255,47,255,255,255,239,255,150,5,
+112,5,30,2,38,1,203,0,0,0,7,3,108,1,196,255,47,255,255,0,139,253,232,8,68,
+4,94,2,38,1,201,0,0,0,7,2,25,4,185,255,162,255,255,255,239,255,150,4,219,
+4,94,2,38,1,202,0,0,0,7,2,25,1,163,255,162,255,255,255,239,255,150,5,112,
+4,94,2,38,1,203,0,0,0,7,2,25,1,185,255,162,255,255,0,139,255,150,6,7,5,94,
+2,38,1,231,0,0,0,7,2,22,1,38,0,148,255,255,255,239,255,150,3,45,6,64,2,38,
+1,232,0,0,0,7,3,104,2,34,0,49,255,255,255,239,255,150,3,207,6,64,2,38,1,233,
+0,0,0,7,3,104,2,102,0,49,255,255,0,133,253,83,5,119,3,68,2,38,1,191,0,0,0,
+7,2,19,2,70,252,72,255,255,255,239,254,29,4,208,3,28,2,38,1,192,0,0,0,7,2,
+19,1,241,251,142,255,255,255,239,254,29,5,118,3,28,2,38,1,193,0,0,0,7,2,19,
+1,239,251,142,255,255,1,60,1,30,2,135,4,139,0,7,0,96,0,160,0,0,255,255,1,
+13,0,0,2,91,4,139,0,6,0,97,112,0,0,2,0,137,0,0,3,66,4,139,0,25,0,26,0,0,19,
+52,54,55,22,23,23,22,51,50,19,23,16,33,34,39,22,21,20,6,7,39,2,2,39,38,37,
+137,60,51,59,42,1,79,119,178,26,82,254,228,79,55,55,10,18,78,4,105,102,17,
+1,75,3,245,41,81,28,105,109,4,51,1,11,16,254,89,25,220,136,96,156,139,19,
+1,89,1,137,197,31,178,255,255,0,77,0,0,3,78,4,139,0,6,0,99,176,0,0,2,0,171,
+255,252,3,108,4,196,0,37,0,38,0,0,19,52,62,2,55,22,21,14,2,7,6,7,22,23,23,
+6,6,21,20,22,51,50,55,55,23,14,3,35,32,53,52,55,38,38,19,171,51,77,144,119,
+7,1,23,35,123,61,55,83,226,57,112,162,146,101,109,88,48,21,31,57,62,70,43,
+254,168,151,104,145,97,2,229,53,155,105,107,59,22,26,33,63,45,91,45,51,91,
+42,122,67,191,63,42,63,28,13,36,26,60,51,35,207,128,217,41,114,1,204,255,
+255,0,176,0,122,2,254,4,139,0,6,0,101,80,0,0,2,0,56,255,253,3,78,4,161,0,
+24,0,25,0,0,5,38,2,53,52,54,55,6,35,34,38,39,55,22,22,51,50,55,23,6,6,21,
+20,18,23,1,2,213,76,72,21,13,86,154,89,178,48,47,49,156,63,179,150,25,22,
+13,79,77,254,74,3,189,1,68,172,55,176,58,12,31,22,173,20,30,20,33,87,101,
+55,238,254,153,154,4,11,0,255,255,0,35,0,0,3,123,4,139,0,6,0,103,16,0,255,
+255,0,38,0,0,3,128,4,139,0,6,0,104,21,0,0,3,0,137,255,253,3,59,4,175,0,18,
+0,29,0,30,0,0,5,38,2,39,6,35,34,38,53,52,54,54,51,50,22,21,20,18,23,1,34,
+6,21,20,22,51,50,55,55,2,37,2,195,74,63,6,79,72,120,156,87,133,68,117,123,
+80,82,254,59,53,96,137,109,37,50,1,23,254,174,3,192,1,15,142,28,158,123,75,
+167,102,207,224,164,254,200,165,3,125,89,51,57,77,10,1,1,7,143,0,255,255,
+0,107,0,0,3,82,4,156,0,6,0,244,206,0,255,255,0,97,255,252,3,60,4,182,0,6,
+2,40,186,0,255,255,0,96,0,15,3,66,4,174,0,6,0,245,0,0,255,255,0,122,0,0,3,
+79,4,137,0,6,0,246,0,0,0,2,0,96,0,0,3,97,4,169,0,29,0,30,0,0,37,20,6,7,6,
+35,34,38,39,38,38,53,52,18,0,55,54,55,22,21,20,7,0,2,21,22,22,51,50,54,1,
+3,97,59,48,99,225,82,202,37,11,6,120,1,47,109,51,51,41,49,254,177,211,39,
+180,108,73,217,254,127,201,78,88,11,24,20,11,45,55,46,118,1,0,1,135,124,58,
+69,43,59,63,59,254,113,254,212,55,19,24,17,3,206,0,3,0,84,3,140,1,161,6,26,
+0,23,0,24,0,25,0,0,19,52,55,22,23,23,22,51,50,55,23,20,35,34,39,22,21,20,
+7,39,38,38,39,38,55,19,84,55,30,21,3,26,40,89,13,41,142,17,19,27,14,39,4,
+50,52,8,187,146,5,134,44,31,53,54,9,18,133,8,211,8,98,76,85,110,9,179,186,
+103,15,162,254,219,0,3,0,45,3,140,1,174,6,27,0,43,0,44,0,45,0,0,19,52,55,
+22,23,22,51,50,53,39,55,22,21,21,22,51,50,53,53,39,23,23,20,6,35,34,39,6,
+6,35,34,39,35,21,22,21,20,7,39,38,39,38,39,38,55,19,45,56,27,25,23,35,58,
+3,31,14,15,14,45,1,41,5,51,38,21,28,17,32,22,17,19,1,26,12,39,2,24,24,55,
+9,206,129,5,135,43,31,49,67,18,77,47,10,51,39,6,6,72,14,14,4,54,59,68,14,
+26,21,8,1,93,80,112,83,9,171,89,96,112,16,162,254,218,0,255,255,255,239,254,
+218,2,205,4,40,0,38,2,11,0,0,0,39,2,7,1,138,255,67,0,7,3,103,2,102,0,0,255,
+255,255,239,255,150,2,191,5,34,0,38,2,8,0,0,0,7,2,7,1,140,0,61,0,3,255,239,
+254,218,0,103,3,158,0,11,0,12,0,13,0,0,49,34,53,53,52,51,51,50,21,21,20,35,
+19,17,17,17,81,18,18,22,17,122,17,17,122,17,3,158,251,60,0,3,255,83,4,232,
+0,182,6,15,0,6,0,13,0,14,0,0,19,6,7,38,39,54,55,7,6,7,38,39,54,55,55,182,
+49,36,65,30,26,67,89,44,41,66,28,46,46,56,5,164,65,33,52,36,23,74,177,61,
+37,52,36,42,54,111,0,4,0,0,5,85,1,109,6,229,0,6,0,13,0,22,0,23,0,0,1,6,7,
+38,39,54,55,7,6,7,38,39,54,55,55,6,7,39,38,39,54,55,22,39,1,109,49,36,65,
+30,26,67,99,39,46,66,28,46,46,135,45,36,29,46,16,50,36,26,26,6,10,65,33,52,
+36,23,74,170,56,42,52,36,42,54,100,54,26,21,39,20,44,42,34,64,0,4,0,0,4,154,
+1,107,5,248,0,6,0,13,0,21,0,22,0,0,1,6,7,38,39,55,55,7,6,7,38,39,54,55,55,
+6,7,38,39,54,55,22,39,1,107,6,32,66,58,26,20,86,6,32,69,54,10,36,163,30,12,
+50,65,33,10,38,38,5,121,44,80,17,26,65,59,143,47,76,14,26,23,103,110,89,17,
+6,31,77,36,20,50,0,0,6,0,55,2,148,1,222,5,41,0,25,0,32,0,39,0,48,0,49,0,50,
+0,0,19,38,53,52,54,55,22,23,7,21,23,21,54,54,51,50,22,21,20,6,35,34,39,55,
+22,23,5,6,7,38,39,54,55,7,6,7,38,39,54,55,55,50,54,55,38,35,34,7,22,19,3,
+184,44,39,37,10,11,16,4,50,47,18,38,87,107,78,127,98,11,31,53,1,72,49,36,
+65,30,26,67,129,44,41,66,28,46,46,108,42,61,39,50,45,55,77,42,90,43,4,13,
+159,15,15,32,13,40,21,12,26,76,17,43,25,76,27,60,76,60,45,7,8,200,65,33,52,
+36,23,74,107,61,37,52,36,42,54,125,15,16,39,66,4,1,76,253,107,0,3,0,67,3,
+117,1,177,5,239,0,32,0,33,0,34,0,0,1,38,38,35,34,6,21,20,23,22,22,21,7,38,
+39,38,53,52,54,51,50,22,23,54,54,55,23,20,6,7,6,6,7,3,3,1,13,15,67,35,17,
+19,58,52,34,39,11,44,99,56,59,29,64,24,19,56,56,3,16,15,33,32,22,50,12,4,
+210,73,95,19,14,39,119,107,126,63,10,80,80,182,68,54,120,71,60,46,65,41,38,
+25,52,14,29,48,51,254,144,2,122,0,0,3,0,109,3,35,1,85,4,85,0,7,0,8,0,9,0,
+0,1,6,7,38,39,54,55,22,39,19,1,85,37,73,84,38,40,80,23,23,2,3,180,57,68,68,
+45,36,87,25,75,254,206,0,255,255,255,239,254,218,1,193,5,34,2,38,0,64,0,0,
+0,6,0,75,60,0,255,255,255,239,254,218,1,193,4,155,2,38,0,64,0,0,0,6,0,78,
+50,0,255,255,255,239,254,218,1,193,5,11,2,38,0,64,0,0,0,6,0,79,90,0,255,255,
+255,239,254,159,1,193,3,158,2,38,0,64,0,0,0,7,0,80,0,50,255,126,255,255,255,
+239,254,218,1,193,4,191,2,38,0,64,0,0,0,6,0,81,70,0,255,255,255,239,254,218,
+1,193,4,196,2,38,0,64,0,0,0,6,3,116,90,0,0,4,0,32,3,152,0,241,4,196,0,11,
+0,24,0,25,0,26,0,0,19,34,38,53,52,54,51,50,22,21,20,6,55,52,38,38,35,34,6,
+21,20,22,51,50,54,7,17,133,45,56,63,40,41,65,67,26,21,33,22,16,35,34,29,24,
+40,64,3,172,66,50,57,77,77,58,48,67,115,9,32,21,26,24,25,29,28,121,1,44,0,
+3,255,239,255,150,3,92,3,98,0,26,0,27,0,28,0,0,49,34,53,53,52,51,51,50,36,
+55,38,39,38,53,52,54,55,30,3,21,20,7,6,6,4,1,3,17,17,30,216,1,183,77,21,53,
+39,70,65,9,26,24,17,71,54,240,254,153,2,8,214,17,122,17,39,36,82,143,106,
+31,44,92,37,60,118,114,106,47,71,137,33,49,31,3,98,252,52,0,0,3,255,239,255,
+150,4,10,2,54,0,33,0,34,0,35,0,0,1,50,23,6,7,23,22,22,51,50,21,21,20,35,34,
+38,39,7,6,4,35,34,53,53,52,51,50,36,55,54,54,55,55,54,39,3,2,210,27,22,47,
+52,28,48,148,121,17,17,146,198,66,34,16,254,87,132,17,17,186,1,42,29,21,47,
+41,36,18,59,56,1,210,16,113,105,17,30,29,17,122,17,59,61,45,19,56,17,122,
+17,27,20,14,71,79,66,33,100,253,96,255,255,0,143,254,21,5,200,3,68,2,38,0,
+110,0,0,0,7,5,237,2,5,0,106,255,255,0,143,254,21,6,175,2,112,2,38,2,9,0,0,
+0,7,5,237,2,170,0,106,255,255,255,241,254,21,2,89,3,98,0,38,2,10,2,0,0,6,
+5,237,107,106,255,255,255,239,254,21,3,5,2,54,2,38,2,12,0,0,0,7,5,237,0,132,
+0,106,255,255,0,128,253,80,4,243,4,199,2,38,0,45,0,0,0,39,1,122,1,4,0,216,
+0,7,1,121,1,134,1,1,255,255,0,133,253,83,5,119,4,155,0,38,1,191,0,0,0,39,
+1,122,1,4,0,172,0,7,1,121,1,51,0,228,255,255,255,239,254,82,4,208,4,115,2,
+38,1,192,0,0,0,39,1,122,0,220,0,132,0,7,1,121,1,26,255,243,255,255,255,239,
+254,82,5,118,4,115,2,38,1,193,0,0,0,39,1,122,0,222,0,132,0,7,1,121,1,24,255,
+243,255,255,0,87,255,150,5,191,5,94,2,38,0,55,0,0,0,7,1,122,2,135,0,227,255,
+255,0,87,255,130,6,87,5,94,2,38,1,213,0,0,0,7,1,122,2,134,0,227,255,255,255,
+239,255,150,4,224,5,94,2,38,1,214,0,0,0,7,1,122,1,167,0,252,255,255,255,239,
+255,150,5,43,5,94,2,38,1,215,0,0,0,7,1,122,1,170,0,251,255,255,0,139,254,
+82,6,97,5,238,2,38,2,3,0,0,0,39,1,121,3,186,255,243,0,7,1,124,2,255,1,236,
+255,255,0,139,254,82,6,173,5,54,2,38,2,14,0,0,0,39,1,124,3,51,1,52,0,7,1,
+121,3,109,255,243,255,255,255,239,254,82,2,229,5,75,2,38,3,14,0,0,0,39,1,
+124,255,186,1,73,0,7,1,121,0,130,255,243,255,255,255,239,254,82,3,59,5,19,
+2,38,2,13,0,0,0,39,1,124,255,215,1,17,0,6,1,121,25,243,255,255,0,68,252,64,
+4,197,4,115,2,38,0,111,0,0,0,39,1,122,1,110,0,132,0,7,1,121,0,224,253,225,
+255,255,0,68,252,64,5,69,4,152,2,38,2,4,0,0,0,39,1,122,1,69,0,169,0,7,1,121,
+0,224,253,225,255,255,255,239,254,82,2,244,5,113,2,38,2,15,0,0,0,39,1,122,
+255,218,1,130,0,6,1,121,92,243,255,255,255,239,254,82,3,59,4,185,2,38,2,13,
+0,0,0,39,1,122,255,225,0,202,0,6,1,121,25,243,255,255,0,68,253,132,4,202,
+5,194,2,38,0,68,0,0,0,7,3,208,2,104,0,0,255,255,0,68,253,132,4,222,5,194,
+2,38,1,234,0,0,0,7,3,208,2,104,0,0,255,255,255,236,255,150,2,7,5,194,2,38,
+1,235,0,0,0,6,3,206,0,0,255,255,255,239,255,150,2,24,5,194,2,38,1,236,0,0,
+0,6,3,206,0,0,255,255,0,139,253,143,3,154,4,224,2,38,0,69,0,0,0,7,1,124,0,
+5,0,222,255,255,0,139,253,143,4,97,4,205,0,38,1,237,0,0,0,7,1,124,0,115,0,
+203,255,255,255,239,255,130,3,69,4,205,2,38,1,238,0,0,0,7,1,124,0,56,0,203,
+255,255,255,239,255,130,3,113,4,205,2,38,1,239,0,0,0,7,1,124,255,205,0,203,
+255,255,0,68,252,75,4,172,2,184,2,38,0,73,0,0,0,39,1,123,0,165,253,236,0,
+7,2,7,0,224,253,183,255,255,0,98,252,78,5,162,3,1,2,38,1,247,0,0,0,39,1,123,
+0,184,253,239,0,7,2,7,1,244,254,28,255,255,255,239,254,93,2,134,5,35,2,38,
+2,10,0,0,0,38,1,123,221,254,0,7,2,7,0,207,0,62,255,255,255,239,254,93,3,5,
+3,247,2,38,2,12,0,0,0,38,1,123,249,254,0,7,2,7,1,0,255,18,255,255,0,68,252,
+75,4,172,3,77,2,38,0,73,0,0,0,39,1,123,0,165,253,236,0,7,1,120,0,9,255,107,
+255,255,0,98,252,77,5,162,2,161,2,38,1,247,0,0,0,39,1,123,0,185,253,238,0,
+7,1,120,1,20,254,191,255,255,255,239,254,93,2,134,4,195,2,38,2,10,0,0,0,38,
+1,123,221,254,0,7,1,120,255,238,0,225,255,255,255,239,254,93,3,5,3,151,2,
+38,2,12,0,0,0,38,1,123,249,254,0,6,1,120,32,181,0,4,0,10,253,250,3,106,3,
+30,0,44,0,58,0,59,0,60,0,0,1,7,38,38,39,6,6,35,34,46,2,53,52,62,2,51,50,22,
+23,54,54,55,46,3,39,38,38,53,52,54,55,30,3,21,20,6,7,22,22,1,34,6,7,30,3,
+51,50,54,55,38,38,19,3,3,106,51,51,109,57,59,152,91,53,105,84,52,46,72,89,
+43,93,161,71,33,50,19,18,29,30,38,27,20,37,62,57,15,53,51,38,46,43,56,98,
+253,208,54,91,40,16,43,46,47,21,69,115,48,54,109,211,153,254,72,52,50,110,
+51,64,73,37,66,90,53,51,79,54,28,77,62,42,100,57,45,57,54,66,54,40,93,46,
+52,63,28,56,137,143,139,58,98,179,75,61,131,1,11,35,31,18,30,21,11,35,32,
+35,44,3,142,250,220,0,4,0,10,253,250,3,172,3,30,0,53,0,64,0,65,0,66,0,0,1,
+7,39,38,39,6,7,6,35,34,38,38,53,52,54,54,51,50,22,23,22,23,54,55,38,39,38,
+38,53,52,54,55,30,2,23,22,23,22,51,50,21,21,20,35,34,39,6,7,6,7,22,23,22,
+37,38,35,34,7,22,22,51,50,55,38,19,3,3,106,51,83,72,62,31,38,105,128,73,139,
+82,69,118,63,66,118,56,44,41,63,39,29,67,42,61,62,57,15,53,51,19,14,4,74,
+86,17,17,94,74,14,38,13,15,18,14,50,254,229,109,96,100,85,31,97,45,133,99,
+8,56,153,254,72,52,83,74,54,35,26,76,68,114,64,60,97,55,39,36,28,36,81,118,
+73,116,73,143,50,52,63,28,56,137,143,70,50,45,41,17,122,17,50,95,86,29,28,
+18,17,58,100,69,66,34,46,68,5,3,215,250,220,255,255,0,40,253,182,3,87,3,28,
+2,38,4,10,0,0,0,6,4,14,0,0,255,255,0,40,253,182,3,226,3,45,2,38,4,11,0,0,
+0,6,4,14,0,0,255,255,0,129,254,74,4,174,3,133,2,38,4,12,0,0,0,7,1,123,1,100,
+255,235,0,3,255,68,3,240,1,31,5,178,0,36,0,37,0,38,0,0,19,6,6,7,6,6,21,20,
+22,23,7,38,38,53,52,62,2,55,62,3,55,54,54,53,52,39,55,22,22,21,20,14,2,39,
+23,142,57,102,41,31,39,11,8,47,15,17,10,26,43,33,24,45,47,52,30,51,51,30,
+36,29,28,17,36,55,173,90,4,163,16,2,4,3,37,27,19,37,16,18,29,56,29,22,46,
+39,31,7,5,2,1,6,9,15,35,25,25,39,29,20,54,29,26,51,45,36,177,228,0,4,255,
+214,3,100,1,72,5,11,0,45,0,57,0,58,0,59,0,0,19,54,54,55,38,38,53,52,62,2,
+51,50,22,21,20,6,7,22,22,51,6,6,35,34,38,39,14,3,35,34,46,2,53,38,53,52,54,
+55,23,6,21,22,55,52,38,35,34,6,21,20,22,23,54,54,39,19,23,45,69,24,32,45,
+23,34,42,20,26,44,2,6,16,32,15,2,38,42,7,13,8,25,56,54,47,16,2,17,19,16,8,
+16,11,26,3,1,213,21,23,18,27,46,34,6,3,99,47,3,189,10,34,17,14,49,35,25,45,
+34,21,61,69,8,29,16,2,2,32,24,1,1,24,41,30,17,11,14,14,2,40,39,30,65,26,8,
+38,23,51,97,27,44,23,9,28,36,11,11,17,193,254,89,255,255,255,68,252,227,1,
+31,254,165,2,7,3,160,0,0,248,243,255,255,254,218,3,240,1,31,6,147,2,38,3,
+160,0,0,0,7,3,160,255,150,0,225,255,255,255,95,3,100,1,72,6,40,2,38,3,161,
+0,0,16,15,3,161,0,167,9,140,192,0,255,255,254,248,252,194,1,61,255,101,0,
+39,3,160,0,30,248,210,0,7,3,160,255,180,249,179,0,3,255,153,4,249,0,108,6,
+21,0,7,0,8,0,9,0,0,19,6,7,38,39,54,55,22,7,3,108,37,63,69,42,79,29,49,46,
+3,5,126,52,61,54,46,79,35,54,180,1,28,255,255,255,61,5,17,0,200,5,252,0,7,
+2,22,254,82,2,77,0,4,255,110,4,60,0,241,5,103,0,32,0,45,0,46,0,47,0,0,19,
+23,6,6,7,22,22,23,7,38,38,39,6,6,35,34,46,2,53,52,54,55,62,3,51,50,22,23,
+54,54,7,34,14,2,7,22,22,51,50,54,55,38,39,3,182,24,11,27,16,23,45,21,28,23,
+53,27,37,85,46,17,31,25,15,11,6,16,28,28,33,22,30,61,30,18,31,170,21,27,22,
+23,17,11,35,23,28,53,26,43,23,6,5,96,16,20,44,23,18,46,26,22,14,29,12,46,
+66,17,32,44,27,20,35,14,12,15,9,4,20,18,22,42,108,1,5,8,7,22,26,30,23,16,
+132,254,213,0,255,255,255,153,254,4,0,108,255,32,2,7,3,166,0,0,249,11,255,
+255,255,61,254,24,0,200,255,3,0,7,2,22,254,82,251,84,255,255,255,110,253,
+191,0,241,254,234,2,7,3,168,0,0,249,131,255,255,255,234,3,157,2,18,5,136,
+2,38,0,78,0,0,0,7,0,78,0,179,0,237,255,255,255,198,3,101,2,140,5,11,0,39,
+0,79,1,44,0,0,0,6,0,79,0,0,255,255,255,234,254,52,2,18,255,246,2,39,0,80,
+0,0,255,19,0,7,0,80,0,179,0,0,255,255,255,99,2,145,0,140,6,215,0,7,0,229,
+255,56,3,82,0,5,255,78,3,195,0,197,5,54,0,31,0,44,0,57,0,58,0,59,0,0,19,7,
+22,22,21,20,14,2,35,34,38,39,6,6,7,52,54,55,55,38,38,53,52,62,2,51,50,22,
+23,55,7,52,38,39,6,6,7,22,51,50,62,2,39,34,14,2,21,20,23,54,54,55,38,38,39,
+19,192,53,2,2,23,38,47,24,34,56,16,22,41,20,10,19,39,1,1,25,38,44,18,27,61,
+20,76,95,3,4,36,70,33,21,38,21,32,23,11,104,11,24,20,14,2,32,67,34,12,33,
+24,16,4,159,23,10,22,11,33,51,33,17,34,31,12,22,11,24,31,12,24,5,12,7,42,
+63,41,20,35,38,34,128,2,13,8,16,33,17,18,15,20,20,101,12,22,29,16,5,10,18,
+33,16,11,16,122,254,141,0,255,255,255,47,3,134,0,196,5,32,2,38,4,15,0,0,0,
+6,4,13,0,0,255,255,255,47,253,186,0,196,255,93,2,39,4,15,0,0,250,187,0,7,
+4,13,0,58,249,93,0,3,255,84,3,79,0,107,4,248,0,27,0,28,0,29,0,0,19,46,3,39,
+52,54,55,54,54,55,54,51,50,23,14,3,7,22,22,23,30,3,3,17,107,39,65,63,68,44,
+4,9,73,92,27,14,20,22,13,11,44,54,59,26,50,67,33,15,19,11,4,157,3,99,16,26,
+23,18,9,33,46,26,53,86,14,7,33,12,39,42,41,13,9,27,21,10,29,33,33,1,134,254,
+87,0,0,5,255,56,3,124,0,165,5,37,0,26,0,27,0,28,0,29,0,30,0,0,3,38,53,52,
+54,55,30,3,23,6,6,7,6,6,35,34,38,39,62,3,55,38,38,55,51,1,51,60,21,6,5,32,
+54,53,59,37,8,18,17,85,125,26,21,29,1,14,54,65,68,29,45,55,35,120,254,192,
+200,4,114,28,30,24,33,14,27,45,41,39,21,32,43,21,28,62,32,18,8,23,23,20,5,
+24,46,210,254,87,255,255,255,84,253,203,0,107,255,116,2,7,3,179,0,0,250,124,
+255,255,255,56,253,241,0,165,255,154,2,7,3,180,0,0,250,117,255,255,254,215,
+3,91,1,67,5,37,0,38,3,180,159,0,0,7,3,180,0,158,255,223,255,255,254,165,3,
+91,1,67,5,37,0,38,3,180,159,0,0,39,3,180,0,158,255,223,0,7,4,13,255,8,255,
+167,255,255,255,14,3,124,0,165,5,37,2,38,3,180,0,0,0,7,4,13,255,113,255,167,
+255,255,255,94,3,101,1,66,5,11,0,38,0,79,226,0,0,6,4,13,193,167,0,11,0,100,
+254,148,9,88,7,12,1,242,2,25,2,38,2,67,2,85,2,97,2,108,2,122,2,170,2,181,
+2,193,0,0,1,22,22,21,20,14,2,7,34,46,2,39,6,6,7,6,6,35,34,38,39,6,6,7,14,
+3,35,34,38,39,6,6,35,34,38,39,7,34,46,2,53,52,54,55,6,6,7,30,3,23,6,6,7,46,
+3,53,52,55,54,54,55,62,5,51,50,22,23,30,3,23,54,54,55,38,38,39,34,46,2,39,
+39,7,38,38,39,46,3,53,52,62,2,55,62,3,55,39,54,54,55,30,3,23,30,3,51,3,54,
+54,55,20,30,2,21,20,22,21,50,62,2,55,62,3,55,62,3,51,50,22,23,6,7,22,22,51,
+50,62,2,53,38,38,39,39,38,38,39,6,6,35,34,38,39,30,3,21,20,14,2,35,34,46,
+2,53,52,54,55,6,35,34,38,39,6,6,35,34,46,2,39,39,7,38,38,39,46,3,53,52,62,
+2,55,62,3,55,39,54,54,55,30,3,21,22,22,51,50,54,55,46,3,39,54,54,55,30,3,
+23,22,22,51,51,50,55,38,2,39,54,54,55,22,22,23,22,22,21,20,7,6,6,7,51,6,21,
+20,30,2,51,50,62,2,55,39,46,3,53,52,62,2,51,22,22,51,50,54,55,38,2,39,54,
+54,55,30,3,23,22,22,23,52,46,2,39,54,54,55,22,22,23,54,55,62,3,51,50,23,7,
+22,22,23,54,54,51,50,30,2,23,22,21,20,14,4,35,34,46,2,39,6,7,6,6,7,22,22,
+23,22,22,51,50,54,55,38,38,53,52,62,2,51,50,30,2,23,7,38,38,35,34,7,20,22,
+23,62,3,55,22,23,22,22,21,20,6,7,14,3,35,34,38,39,6,6,35,34,38,39,6,6,7,14,
+3,35,22,22,23,22,22,51,50,62,2,55,54,54,55,62,3,51,50,23,6,6,7,22,22,51,50,
+54,55,62,3,51,50,23,6,6,7,22,22,51,46,3,53,52,54,55,22,22,5,22,21,20,14,2,
+35,34,46,2,39,55,22,22,51,50,62,2,55,38,53,6,6,35,34,38,53,52,62,2,51,50,
+30,2,3,54,55,38,38,35,34,6,7,22,22,51,50,1,20,22,21,20,6,7,7,52,46,2,39,46,
+3,53,52,54,55,30,3,23,7,20,22,1,54,54,55,46,3,35,34,14,2,21,20,22,51,50,5,
+22,23,38,38,39,14,3,7,22,3,22,22,23,38,38,39,6,6,7,22,19,22,22,51,38,38,39,
+6,6,7,30,3,19,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,52,38,53,55,22,
+22,51,50,54,55,38,38,39,38,53,52,54,55,22,22,21,20,14,2,35,34,38,39,6,6,1,
+22,22,23,6,6,7,38,39,54,54,55,22,22,23,6,6,7,38,38,39,54,54,7,146,7,9,8,12,
+14,7,43,65,53,45,23,5,3,2,8,72,51,29,77,26,6,18,13,16,79,107,126,63,78,112,
+28,36,67,35,33,47,21,13,43,97,83,55,9,11,23,47,20,5,13,16,17,9,20,35,17,5,
+11,10,7,12,8,14,20,6,32,45,53,55,51,21,16,31,14,12,25,29,36,22,22,57,32,9,
+14,6,42,98,85,60,4,6,37,38,63,42,9,29,27,19,8,12,13,5,12,38,49,57,30,6,21,
+39,22,1,3,3,3,2,9,31,55,84,63,17,20,33,19,4,5,4,1,130,185,128,83,29,24,33,
+24,19,10,6,11,15,20,14,11,15,5,25,27,22,54,33,7,18,15,10,8,12,5,9,29,53,18,
+21,45,22,21,43,17,42,48,25,7,74,116,140,67,48,85,63,36,6,6,27,50,35,66,23,
+27,55,34,19,49,45,34,4,6,37,35,49,31,5,36,40,32,9,13,13,4,7,34,49,60,35,5,
+21,38,23,1,4,4,2,23,52,37,26,39,17,8,12,11,8,3,19,33,20,4,5,1,1,2,23,52,35,
+3,69,50,11,26,17,20,33,19,5,7,5,3,9,12,7,12,10,1,12,32,53,66,35,55,109,96,
+75,21,59,15,45,42,31,6,10,15,8,17,68,32,24,40,24,15,18,11,22,32,19,3,4,3,
+2,2,20,40,26,6,4,3,1,20,33,19,5,5,2,38,29,4,13,16,20,13,16,10,32,13,26,14,
+101,176,75,22,48,46,40,15,20,37,60,76,77,72,26,39,84,79,67,21,9,10,5,32,27,
+1,3,5,23,53,36,35,62,29,31,34,30,49,62,32,16,32,35,42,26,19,37,43,25,69,69,
+93,94,24,43,44,47,26,8,5,1,1,20,26,50,102,112,125,72,35,68,22,12,30,34,42,
+79,29,5,8,5,59,120,150,194,133,2,2,3,25,95,83,54,114,103,80,19,23,38,15,2,
+9,12,16,9,18,13,14,19,12,20,53,23,27,38,20,6,14,21,31,22,14,12,14,23,10,43,
+87,60,9,22,19,12,44,27,5,13,1,188,12,33,63,89,57,20,48,48,42,14,16,29,65,
+37,45,71,56,41,14,1,26,70,49,64,71,26,43,55,28,30,50,39,29,164,73,69,34,94,
+40,53,144,79,42,80,35,73,252,36,2,3,4,49,2,3,4,3,2,6,6,5,40,32,5,9,9,10,5,
+29,4,4,117,13,26,14,8,29,36,41,20,20,35,25,15,64,56,30,248,178,57,62,26,37,
+3,17,44,44,35,7,40,36,16,33,17,6,14,8,50,99,32,60,127,16,33,17,5,14,8,50,
+100,32,18,33,33,37,213,25,31,8,7,19,3,2,18,11,14,18,1,28,5,17,28,8,14,2,2,
+9,8,3,22,11,14,8,9,17,24,16,9,25,8,11,31,1,225,19,31,16,8,31,25,41,31,18,
+39,175,19,32,15,6,33,25,19,36,17,18,38,1,26,29,56,25,11,33,36,38,15,6,12,
+17,11,5,8,4,12,17,17,16,6,11,5,5,17,16,12,11,26,21,17,25,23,48,15,30,48,33,
+16,39,19,14,35,15,60,100,100,110,69,21,27,12,83,128,108,94,50,21,30,20,37,
+16,5,25,31,35,28,19,43,31,27,72,64,47,1,2,10,16,68,166,93,7,19,35,30,38,69,
+1,10,20,4,14,18,21,12,7,25,29,28,11,17,36,35,31,13,44,23,24,14,75,116,92,
+74,34,6,8,5,3,1,38,22,25,14,20,86,96,85,19,13,24,12,8,11,14,7,6,9,15,24,19,
+11,28,27,22,5,3,61,54,17,34,3,9,15,11,66,129,72,143,2,17,18,15,17,8,5,21,
+25,23,26,21,38,74,58,36,23,49,77,54,32,43,27,7,18,20,15,23,7,21,37,29,39,
+70,3,7,11,1,15,22,28,13,8,26,29,28,9,12,35,37,35,13,45,21,26,14,77,116,92,
+72,34,13,14,15,12,62,108,100,99,53,20,27,13,77,124,112,108,61,14,13,28,133,
+1,24,140,21,26,13,85,148,72,72,132,69,21,31,18,30,11,41,36,47,64,39,17,14,
+28,44,30,32,7,26,28,25,7,3,23,25,21,2,10,9,13,133,1,27,138,22,25,14,80,151,
+150,153,81,11,13,2,36,72,65,53,18,22,25,14,85,146,69,11,44,7,24,24,18,10,
+74,6,11,4,133,140,20,31,38,19,28,21,47,69,51,33,19,8,9,16,22,14,12,10,6,22,
+7,105,202,112,13,14,1,1,21,57,31,39,75,59,36,7,17,30,23,34,15,10,39,68,97,
+8,5,12,14,17,11,7,14,5,8,4,18,32,7,13,25,19,12,17,22,15,22,43,25,8,11,5,20,
+29,19,11,81,160,86,15,14,10,15,16,6,7,30,29,4,17,15,12,8,32,46,21,8,5,5,6,
+10,58,62,48,7,31,74,33,20,21,35,59,48,37,12,28,46,17,31,64,108,50,44,50,109,
+90,59,13,21,24,11,36,11,9,28,50,69,42,2,7,25,37,77,62,43,82,64,38,32,53,66,
+3,94,25,44,61,60,101,96,11,5,1,109,42,68,40,56,139,98,9,60,96,82,74,39,25,
+74,81,79,30,39,42,3,24,34,27,26,17,25,27,63,250,182,3,10,6,33,59,44,26,23,
+33,36,13,42,40,13,19,4,43,112,54,8,30,38,41,19,33,4,7,2,2,1,38,86,51,18,55,
+40,49,253,203,2,2,36,87,51,18,55,40,14,18,14,8,4,5,30,30,9,34,12,3,12,14,
+6,21,13,20,17,10,21,11,18,32,39,10,5,8,24,18,6,5,12,22,2,23,48,10,13,27,22,
+14,9,11,23,24,251,40,20,30,15,14,35,25,31,35,18,40,30,20,28,17,14,35,24,15,
+33,18,15,42,0,16,0,100,255,111,8,100,5,145,0,201,0,253,1,20,1,54,1,86,1,120,
+1,134,1,184,1,198,1,212,1,224,1,236,1,249,2,5,2,17,2,29,0,0,0,51,7,46,3,35,
+34,14,2,7,22,22,23,22,22,51,7,38,38,35,34,14,2,7,14,3,35,34,38,39,20,22,21,
+20,6,7,14,5,35,34,38,53,52,54,55,38,38,39,46,3,53,52,62,2,55,54,54,55,39,
+54,54,55,30,3,23,22,22,23,51,54,54,55,38,38,39,38,38,39,7,38,38,39,38,53,
+52,54,55,22,22,23,38,38,39,54,54,55,22,18,23,22,22,23,54,55,62,3,55,46,3,
+53,52,62,2,55,30,3,23,7,30,3,23,30,3,23,22,51,50,54,55,38,38,35,34,14,2,7,
+38,38,53,52,54,51,50,30,2,23,54,54,55,46,3,35,34,14,2,7,38,38,53,52,62,2,
+51,50,30,4,23,0,7,35,46,3,39,39,7,6,6,21,20,30,2,51,50,62,2,55,46,3,39,7,
+14,5,7,39,62,3,55,38,38,39,22,23,20,14,2,7,1,14,3,35,38,38,39,23,22,22,51,
+50,62,4,55,38,38,39,1,54,54,55,38,38,53,52,62,2,51,50,22,21,20,6,7,22,22,
+51,6,6,35,34,38,35,14,3,35,34,38,1,54,54,55,38,38,53,52,62,2,51,50,22,21,
+20,6,7,22,51,6,6,35,34,39,14,3,35,34,38,1,54,54,55,38,38,53,52,62,2,51,50,
+22,21,20,6,7,22,22,51,6,6,35,34,38,39,14,3,35,34,38,0,22,23,38,38,39,14,3,
+7,22,22,23,1,22,22,21,20,14,2,35,34,39,6,6,35,34,38,53,52,54,55,23,6,6,21,
+20,22,51,50,54,53,52,38,53,55,30,3,51,50,54,55,38,38,39,38,38,53,52,54,23,
+62,3,55,22,22,21,20,7,6,6,7,1,62,3,55,22,22,21,20,7,6,6,7,0,22,23,6,6,7,38,
+38,39,54,54,55,4,22,23,6,6,7,38,38,39,54,54,55,1,22,22,21,20,6,7,39,38,38,
+53,52,54,5,20,22,23,54,54,53,52,38,35,34,6,1,20,22,23,54,54,53,52,38,35,34,
+6,5,20,22,23,54,54,53,52,38,35,34,6,8,54,46,46,17,23,16,13,7,23,34,31,31,
+19,37,85,42,17,38,22,46,36,29,10,27,43,48,60,45,51,83,82,93,60,22,39,22,1,
+12,19,25,94,121,139,140,133,53,136,128,31,23,22,40,24,11,42,42,31,15,22,26,
+11,29,97,54,6,25,43,24,3,3,3,2,2,24,57,35,14,35,62,25,8,15,8,76,155,81,44,
+25,35,4,12,15,17,115,192,83,11,22,11,23,37,24,8,22,9,59,110,57,19,18,26,36,
+25,14,4,9,17,12,7,16,25,31,15,7,10,10,11,7,30,3,11,11,10,2,2,8,7,6,3,46,73,
+98,138,54,23,46,24,25,37,30,28,16,5,11,81,67,26,50,50,48,24,17,34,17,34,67,
+67,66,33,24,37,32,28,15,7,11,27,42,53,26,39,72,69,70,76,84,49,250,236,112,
+16,28,54,43,30,5,7,41,15,32,34,61,82,48,57,164,184,189,81,6,16,20,21,11,1,
+11,41,65,88,113,141,85,25,72,112,87,67,27,47,90,47,6,3,8,12,15,8,3,231,45,
+82,84,92,55,31,60,24,7,24,38,24,70,106,82,63,55,52,29,20,35,15,250,124,45,
+76,23,23,35,16,25,32,17,20,33,2,4,13,23,12,2,36,33,2,6,2,15,35,39,39,18,21,
+23,254,227,44,75,25,25,33,17,26,32,16,19,34,4,3,24,24,2,35,35,6,2,15,35,38,
+40,19,20,24,2,240,44,78,23,23,36,17,26,32,15,21,32,3,3,11,25,12,3,33,37,1,
+4,2,13,35,39,41,19,20,24,254,24,71,39,8,16,8,29,59,54,46,18,19,50,26,5,51,
+14,11,10,19,28,17,28,21,11,37,22,25,36,9,8,20,3,1,19,14,17,19,3,33,3,6,11,
+20,17,8,18,2,2,12,8,2,2,27,145,33,75,73,66,24,1,1,35,58,125,63,254,117,34,
+74,72,66,26,1,1,35,58,126,61,1,238,38,21,14,36,29,23,47,19,24,48,15,254,231,
+39,23,11,40,28,23,46,19,23,46,17,254,3,8,2,12,21,10,2,18,27,252,225,35,23,
+6,3,16,19,16,16,1,28,34,26,5,2,16,17,13,21,1,211,36,24,5,2,16,17,14,20,2,
+247,90,2,3,1,1,3,8,13,9,21,25,4,1,1,90,3,3,3,14,26,24,27,37,23,9,11,8,8,14,
+8,32,57,26,34,81,80,75,58,35,120,112,71,116,63,2,10,9,1,21,27,29,11,14,42,
+44,39,11,29,64,21,51,25,28,16,89,130,102,83,40,14,16,1,2,16,14,76,172,93,
+76,120,59,10,17,34,8,25,28,14,29,13,74,140,82,123,243,109,23,29,17,164,254,
+201,153,69,164,104,21,25,35,97,117,134,73,61,111,93,73,22,24,28,15,7,3,24,
+33,30,34,26,25,26,91,98,91,26,30,69,67,56,16,29,33,22,14,20,8,14,17,9,7,23,
+18,46,55,16,26,33,17,8,11,4,16,49,45,32,7,13,17,10,5,29,13,28,39,24,10,28,
+41,50,43,31,2,254,15,2,1,11,25,40,30,42,77,39,92,57,59,74,43,16,52,91,122,
+69,45,110,123,132,66,15,122,180,133,95,75,64,35,34,56,87,72,60,29,80,129,
+54,112,108,12,31,33,32,13,1,30,24,35,23,12,1,12,14,66,12,9,10,21,26,24,21,
+5,10,20,12,2,100,8,34,15,11,38,25,16,34,27,18,41,57,8,23,9,2,2,26,16,1,15,
+29,24,15,22,254,48,8,32,17,12,35,27,17,33,27,17,46,53,4,25,11,3,26,15,1,13,
+29,25,16,19,1,55,8,32,17,12,34,28,18,34,26,16,48,51,5,23,11,2,2,26,15,1,1,
+13,29,25,17,19,253,225,6,2,39,99,59,10,26,33,38,21,17,27,8,3,52,24,55,13,
+14,31,25,17,24,26,28,35,33,11,38,14,3,13,13,11,23,15,25,16,8,25,14,21,17,
+29,21,12,11,6,8,27,20,3,8,3,16,22,225,9,25,26,25,9,5,9,5,34,17,29,42,20,1,
+61,9,24,25,26,11,5,8,5,37,17,27,42,19,252,160,36,18,18,45,27,17,43,21,20,
+51,18,135,41,17,15,49,26,18,43,20,21,49,19,2,115,52,69,21,32,63,32,3,73,106,
+27,27,26,29,24,25,8,8,12,7,20,33,18,1,221,20,29,7,6,16,5,21,32,17,199,23,
+26,8,11,11,5,23,30,16,0,15,0,100,252,193,15,38,7,95,2,6,2,93,2,170,2,203,
+2,234,2,249,3,9,3,24,3,35,3,84,3,97,3,109,3,126,3,138,3,150,0,0,0,22,21,20,
+6,7,14,3,35,34,46,2,39,6,6,7,22,22,23,22,22,51,7,38,38,39,39,34,14,2,7,14,
+3,35,34,38,39,14,3,35,34,38,39,7,34,46,2,53,52,54,55,6,6,7,30,3,23,6,6,7,
+46,3,53,52,62,2,55,54,54,55,62,3,51,50,23,30,3,51,50,54,55,54,54,55,62,3,
+55,50,22,23,6,6,7,22,22,51,50,62,2,55,46,3,35,34,6,7,38,53,52,62,2,51,50,
+22,23,54,54,55,46,3,39,46,3,53,52,54,55,30,3,23,22,22,51,50,54,55,38,38,39,
+38,38,39,33,34,38,39,7,34,46,2,53,52,54,55,6,6,7,30,3,23,22,22,23,22,22,51,
+50,54,55,38,38,53,52,62,2,51,50,22,23,30,3,51,51,50,62,4,55,38,38,39,46,3,
+35,34,14,2,7,38,38,53,52,62,2,51,50,30,2,23,22,22,51,7,38,38,35,34,14,2,7,
+14,3,35,35,34,38,39,7,34,38,39,6,6,35,34,38,39,22,21,20,14,2,35,34,46,2,53,
+52,62,2,55,23,6,6,21,20,30,2,51,50,62,2,55,46,3,39,46,3,53,52,62,2,55,62,
+5,51,50,22,23,30,3,51,33,46,3,39,54,54,55,20,30,4,23,21,51,53,52,46,4,53,
+38,38,53,52,62,2,55,30,3,23,7,20,30,4,23,51,50,62,2,55,62,3,51,50,22,23,6,
+6,7,22,22,51,50,54,55,54,54,55,62,3,51,50,23,6,6,7,22,22,51,50,54,55,54,54,
+55,62,3,51,50,22,23,6,6,7,22,22,51,50,62,2,55,46,3,53,52,62,2,55,22,22,23,
+22,22,21,20,6,7,6,6,7,34,38,39,6,6,7,14,3,35,34,38,39,6,6,35,34,46,2,39,6,
+6,35,35,20,22,21,28,2,6,7,7,46,3,39,35,23,1,46,3,39,38,38,53,52,62,2,55,62,
+3,55,39,54,54,55,30,3,23,22,22,21,22,22,51,50,54,55,46,3,39,54,54,55,30,3,
+23,22,51,51,50,54,55,38,2,39,54,54,55,30,3,23,20,6,7,6,35,34,38,39,14,3,35,
+35,34,46,2,39,39,0,22,23,20,7,14,3,35,34,39,6,35,34,39,14,3,35,34,46,2,39,
+55,30,3,51,50,62,2,55,46,3,39,46,3,53,52,54,55,30,3,23,22,22,23,30,3,23,54,
+51,50,54,55,38,2,39,54,54,55,22,22,23,1,20,30,2,21,20,14,2,7,7,46,3,39,38,
+38,39,52,38,53,52,62,2,55,30,3,23,0,22,21,20,14,2,7,7,52,46,2,39,46,3,53,
+52,54,55,30,3,23,7,22,22,23,36,23,46,3,39,14,3,7,22,22,23,2,22,23,46,3,39,
+14,3,7,22,22,23,0,22,23,46,3,39,14,3,7,22,23,19,22,22,23,38,39,6,6,7,22,22,
+1,22,22,21,20,14,2,35,34,38,39,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,
+50,54,53,52,38,53,55,30,3,51,50,54,55,38,39,38,53,52,54,1,54,54,55,22,22,
+23,6,6,7,38,38,39,36,22,23,6,6,7,38,38,39,54,54,55,1,30,3,21,20,6,7,39,52,
+46,2,53,52,54,2,22,23,6,6,7,38,38,39,54,54,55,22,22,23,6,6,7,38,38,39,54,
+54,55,10,19,10,26,14,5,34,47,56,28,14,43,45,40,10,8,45,35,17,34,19,50,115,
+69,44,17,22,7,25,32,46,44,52,37,47,78,81,92,61,55,88,39,11,46,61,73,37,31,
+52,22,14,42,104,90,61,9,11,27,47,22,7,17,16,17,7,20,35,22,3,12,11,9,7,12,
+14,7,2,33,26,19,61,68,66,24,18,17,23,36,36,41,30,32,91,54,11,20,9,7,12,16,
+21,15,11,16,6,12,26,16,28,69,45,100,131,94,72,42,39,57,50,49,30,41,56,29,
+16,22,37,50,29,25,48,23,46,62,18,8,13,12,13,8,6,19,20,14,37,31,6,27,28,23,
+3,27,66,48,54,84,29,5,13,8,2,5,2,250,53,26,52,17,15,42,103,90,62,10,11,25,
+49,22,4,13,15,18,10,4,10,5,21,39,22,19,36,14,5,4,40,63,76,37,20,31,13,8,26,
+34,43,26,107,69,104,78,60,53,52,31,18,34,14,17,36,39,43,23,25,38,29,23,11,
+8,10,24,39,50,27,44,77,79,86,54,32,59,44,44,30,29,12,32,43,42,52,41,47,80,
+83,91,57,125,28,49,21,15,50,106,45,36,70,41,21,35,18,3,58,94,117,60,54,79,
+51,25,2,5,8,7,43,6,7,24,42,58,35,37,85,80,66,17,12,20,15,10,4,14,17,10,4,
+7,15,22,15,6,35,49,57,58,54,21,19,32,14,9,26,34,42,25,5,186,5,9,9,7,3,21,
+36,20,4,6,6,6,4,1,131,2,3,3,3,3,1,1,9,18,30,21,6,9,10,9,6,31,1,2,2,2,2,1,
+76,28,40,31,24,11,3,9,13,18,13,5,18,5,14,20,13,20,56,26,29,40,21,7,13,8,5,
+11,16,23,18,17,10,16,30,14,17,26,19,11,30,22,4,9,4,9,18,21,24,15,8,19,7,14,
+31,14,29,60,46,4,39,55,67,32,10,22,19,12,14,22,27,13,6,25,7,2,3,29,11,65,
+104,37,49,92,26,5,8,3,4,21,29,33,16,30,42,21,11,75,51,14,37,39,37,15,13,50,
+47,84,2,3,3,51,1,4,6,8,4,130,4,251,46,24,43,44,50,31,20,30,9,14,13,5,10,41,
+54,61,31,5,22,42,23,2,3,2,2,1,1,1,23,58,39,24,64,38,8,14,11,9,3,21,37,20,
+3,4,2,2,2,46,71,3,37,64,26,11,28,17,20,34,23,3,9,9,7,2,26,15,22,115,35,74,
+22,21,35,35,40,27,6,29,54,43,30,4,6,6,82,7,1,12,8,13,31,59,54,8,1,2,8,55,
+39,8,40,64,87,55,12,37,42,42,17,15,20,29,24,22,14,49,77,59,42,14,7,13,13,
+13,8,5,19,20,14,36,32,7,27,28,22,3,12,22,11,7,18,17,12,1,1,8,37,64,26,11,
+29,18,21,35,22,3,10,5,253,17,2,2,2,1,1,3,2,53,2,4,5,4,2,2,8,5,1,14,22,27,
+13,6,11,10,9,6,3,183,2,1,1,3,3,53,3,3,4,2,1,7,7,5,45,31,5,9,10,11,6,31,2,
+1,2,247,57,68,17,24,17,10,3,24,48,43,34,8,20,51,29,116,63,35,16,24,18,11,
+3,17,46,46,38,9,20,50,31,1,90,65,33,16,25,18,11,1,16,46,47,38,9,42,58,152,
+32,65,38,15,15,55,105,35,17,47,2,23,14,10,10,19,26,15,12,26,8,11,33,20,27,
+33,9,8,18,2,2,18,14,14,20,2,30,2,6,12,19,15,8,14,4,4,17,3,27,250,40,22,43,
+16,21,35,20,8,34,32,11,21,11,13,156,34,22,11,34,29,21,45,17,20,46,14,247,
+196,4,7,4,3,15,17,7,8,9,8,24,133,34,16,8,33,28,19,40,17,20,39,16,192,36,16,
+10,33,25,20,40,18,20,40,15,1,179,142,75,23,65,28,9,14,10,6,3,6,10,8,57,97,
+36,11,25,11,32,21,86,3,2,1,2,5,14,25,19,26,29,16,4,33,35,18,36,27,17,27,23,
+50,14,32,51,38,17,40,22,18,36,15,63,108,108,117,73,23,27,11,86,135,112,102,
+57,10,29,31,31,13,5,27,19,14,41,38,27,24,33,95,89,63,26,31,5,32,18,10,30,
+28,22,3,5,3,32,62,31,18,24,21,28,29,8,18,43,37,24,25,20,14,31,23,36,24,12,
+15,12,26,87,58,19,26,22,23,15,8,34,42,46,21,30,33,17,28,69,75,76,34,15,7,
+13,17,72,146,75,17,50,32,29,21,50,14,31,52,38,17,40,22,17,36,16,59,100,101,
+110,68,29,53,26,12,9,7,4,8,17,11,38,90,77,52,48,32,19,74,75,56,9,15,19,19,
+16,6,11,17,11,13,30,25,16,9,14,16,7,8,24,14,24,36,24,12,41,55,55,13,7,5,85,
+4,3,5,14,24,19,26,30,15,4,27,23,50,16,17,12,21,6,10,27,31,58,102,77,45,33,
+58,79,46,19,29,32,39,30,10,22,42,18,46,67,44,21,19,37,53,35,25,57,56,50,19,
+93,140,113,97,52,9,34,39,38,12,5,27,34,37,30,20,46,33,23,75,74,53,52,112,
+101,82,24,23,29,14,15,69,87,97,86,66,13,4,3,6,57,78,89,77,55,5,5,6,4,15,30,
+24,17,2,23,34,30,31,19,26,4,35,53,65,66,63,24,11,19,28,18,6,17,16,12,4,4,
+33,48,25,8,5,4,7,11,44,25,17,39,33,22,8,38,97,42,9,5,3,8,6,17,11,25,58,49,
+32,3,5,34,88,42,18,22,2,7,17,15,40,65,50,37,12,17,29,24,20,7,48,99,46,15,
+27,14,29,61,29,38,23,1,34,28,10,15,6,6,12,8,5,14,15,14,15,4,8,13,9,11,23,
+42,97,35,35,59,71,93,69,9,41,90,117,155,107,63,1,47,2,3,11,20,19,11,27,14,
+8,30,32,29,7,18,40,38,34,13,48,22,26,17,63,100,83,69,31,19,35,18,15,15,11,
+19,66,117,109,104,54,24,29,12,87,134,117,112,65,30,15,16,143,1,42,149,22,
+27,16,90,160,150,144,74,23,65,28,40,18,23,11,16,10,4,11,24,38,27,42,252,109,
+141,74,23,33,20,36,27,17,6,6,29,51,95,74,44,9,17,24,15,37,4,4,3,1,31,54,74,
+43,18,28,24,23,13,9,33,42,45,20,30,35,16,30,70,75,74,34,7,9,2,1,1,2,3,4,7,
+16,14,144,1,42,149,23,28,15,91,160,76,5,26,28,69,64,53,12,35,75,89,108,67,
+10,77,117,101,95,55,58,123,45,3,7,3,24,33,21,11,1,24,36,30,29,18,250,207,
+55,14,36,76,90,106,66,9,65,103,87,79,41,29,80,86,82,31,48,38,6,26,34,29,28,
+21,27,28,67,32,63,5,25,58,59,57,24,11,35,40,42,18,16,27,9,1,243,11,3,23,56,
+59,59,26,8,31,40,45,21,17,27,9,251,251,12,2,24,58,60,57,23,7,31,41,45,21,
+36,17,4,241,8,7,2,82,104,18,59,43,13,28,2,173,24,53,10,14,29,24,15,11,11,
+24,26,34,30,11,34,14,4,12,13,9,21,15,23,16,11,23,11,20,17,27,20,11,9,6,14,
+39,6,8,15,20,250,229,20,47,17,23,34,18,12,45,27,8,19,9,202,37,18,14,41,29,
+17,39,20,19,49,16,5,115,26,42,42,45,30,30,53,24,2,53,73,50,32,12,24,38,246,
+166,32,17,17,36,25,15,34,22,18,41,17,4,31,17,17,37,25,16,34,21,17,43,18,0,
+2,0,69,254,236,1,78,1,182,0,9,0,10,0,0,19,54,54,55,22,22,21,20,7,38,19,69,
+27,43,29,90,76,91,85,48,1,11,44,86,41,51,66,13,25,130,66,254,17,0,0,2,0,98,
+254,236,1,64,2,225,0,16,0,17,0,0,19,52,54,55,22,18,21,20,6,7,39,46,3,39,38,
+19,98,46,42,64,70,9,14,62,3,13,46,47,15,13,114,2,105,33,63,24,114,254,252,
+118,72,98,80,15,127,141,164,105,23,25,252,153,0,2,0,94,254,236,1,252,2,230,
+0,43,0,44,0,0,55,52,46,2,39,46,3,39,38,53,52,54,55,22,22,23,22,22,51,50,62,
+2,55,23,20,14,2,35,34,38,39,22,22,21,20,14,2,7,3,234,1,4,9,9,8,17,23,31,21,
+17,78,14,22,33,14,18,36,16,19,38,33,23,5,65,13,39,71,58,8,16,8,11,8,1,4,7,
+6,25,10,49,88,81,73,35,28,53,57,62,37,31,26,39,63,8,39,79,39,9,6,15,39,67,
+53,13,51,107,86,55,2,3,56,96,37,34,60,60,62,35,254,241,0,2,0,94,254,236,2,
+82,2,228,0,64,0,65,0,0,55,46,3,39,46,3,39,38,53,52,54,55,22,22,23,22,22,51,
+50,54,53,52,38,39,55,22,22,21,22,51,50,62,2,53,52,38,39,23,22,22,21,20,14,
+2,35,34,38,39,6,6,35,34,39,22,22,21,20,6,7,19,234,1,2,4,10,8,7,17,23,30,21,
+17,77,15,21,34,14,15,28,15,28,36,2,2,49,10,13,15,18,8,16,13,8,1,2,67,3,4,
+18,31,42,24,13,33,17,15,44,29,18,18,11,9,6,10,17,10,49,86,79,74,36,29,54,
+56,62,38,32,27,38,62,8,39,80,39,9,5,41,56,13,28,17,17,31,63,31,6,9,21,36,
+27,10,19,8,7,21,40,17,42,67,47,26,9,10,28,33,6,56,97,37,68,118,65,254,241,
+0,2,0,81,254,236,1,245,3,9,0,34,0,35,0,0,19,38,38,53,52,54,54,55,22,21,20,
+6,7,7,22,23,23,6,6,21,20,22,51,50,55,23,7,6,6,35,34,38,53,52,54,19,233,71,
+81,60,106,92,5,47,64,62,40,101,44,40,97,87,63,70,48,14,17,19,58,35,108,120,
+55,76,1,78,38,64,34,45,125,91,46,15,18,44,82,40,39,53,25,97,37,125,25,19,
+33,17,29,33,40,48,67,66,37,125,253,205,0,3,0,62,254,236,1,183,2,159,0,14,
+0,26,0,27,0,0,19,52,54,54,51,50,22,22,21,20,6,6,35,34,38,55,50,54,54,53,52,
+38,35,34,6,21,20,19,62,71,97,40,51,75,43,46,108,58,88,77,183,38,55,33,78,
+58,36,72,123,1,6,91,198,120,82,145,81,104,107,79,92,46,25,39,14,97,128,150,
+66,87,254,25,0,2,0,26,254,236,1,246,2,242,0,21,0,22,0,0,5,38,38,53,52,54,
+55,6,35,34,39,55,22,51,50,55,23,6,21,20,22,23,3,1,149,45,46,13,9,45,75,119,
+71,37,81,72,98,93,20,22,49,48,210,8,114,197,106,37,116,26,7,34,139,32,13,
+27,66,112,136,205,92,254,139,0,0,2,0,13,254,236,2,46,2,228,0,32,0,33,0,0,
+5,46,5,39,38,53,52,54,55,30,5,23,62,3,55,23,14,3,7,6,6,19,1,3,18,34,34,37,
+40,46,27,10,56,24,18,43,42,41,36,27,7,12,40,49,54,27,69,27,53,53,52,26,20,
+44,2,5,68,108,94,83,85,92,55,18,27,38,59,18,32,87,100,108,105,96,38,71,156,
+151,136,50,118,53,114,135,160,98,16,33,254,225,0,2,0,11,254,236,2,49,2,225,
+0,32,0,33,0,0,1,30,5,23,22,21,20,6,7,46,5,39,14,3,7,39,62,3,55,54,54,3,1,
+58,21,35,32,32,39,47,31,10,58,24,21,43,42,39,33,26,8,13,41,50,55,27,70,28,
+54,53,53,27,21,43,5,2,225,67,108,92,82,85,92,55,18,22,39,63,18,32,88,101,
+107,105,94,38,72,156,151,136,51,117,54,113,132,159,101,17,32,252,28,0,0,3,
+0,56,254,236,1,233,2,251,0,26,0,42,0,43,0,0,5,46,3,39,6,6,35,34,46,2,53,52,
+62,2,51,50,30,2,21,20,22,23,1,34,6,21,20,30,2,51,50,54,55,46,3,19,1,137,23,
+34,23,13,1,19,30,14,41,67,47,25,30,49,61,31,49,60,33,12,51,57,254,209,26,
+33,26,41,50,25,4,11,7,4,15,25,36,73,7,56,97,90,87,48,7,3,22,47,73,50,34,74,
+62,40,49,79,99,49,95,192,103,2,11,24,20,20,29,19,9,1,1,22,43,34,20,252,128,
+0,0,2,0,94,254,236,2,70,2,239,0,59,0,60,0,0,55,38,38,39,46,3,39,38,53,52,
+54,55,22,22,23,22,23,38,53,52,62,2,51,50,22,23,7,38,38,35,34,6,7,20,30,2,
+23,54,55,22,21,20,7,6,6,35,34,39,22,22,21,20,14,2,7,19,241,2,15,19,8,15,21,
+29,21,17,78,14,28,42,16,28,26,30,18,34,49,30,29,55,31,38,23,33,17,14,28,17,
+11,24,40,30,39,51,15,58,35,66,35,42,42,11,9,2,5,8,6,2,10,99,158,72,28,51,
+55,62,39,32,27,32,68,8,48,97,48,11,3,25,40,22,53,46,31,43,43,38,9,14,5,6,
+18,31,24,15,1,12,25,36,28,40,37,17,13,9,52,91,35,34,61,59,62,36,254,241,0,
+3,0,62,254,236,2,22,2,250,0,29,0,52,0,53,0,0,19,30,3,21,20,14,2,35,34,39,
+6,6,35,34,46,2,53,52,62,2,55,38,52,54,54,3,20,22,51,50,54,55,55,20,22,51,
+50,54,53,52,46,2,39,14,3,19,229,77,114,76,38,18,35,54,36,55,40,18,46,25,42,
+56,33,14,23,39,50,26,5,7,16,92,38,37,32,33,4,58,36,38,27,40,30,56,77,46,28,
+49,36,21,171,2,250,71,121,120,128,77,41,86,69,44,48,24,24,40,64,80,40,52,
+98,93,88,42,17,41,43,41,254,2,42,47,43,41,32,54,62,34,38,33,76,82,84,41,33,
+73,77,78,253,220,0,2,0,78,254,236,2,34,2,227,0,48,0,49,0,0,55,62,3,55,46,
+3,53,52,62,2,51,50,30,2,23,7,38,38,35,34,6,7,20,22,23,54,54,55,30,3,21,20,
+14,2,7,14,3,7,19,78,26,40,37,39,27,33,58,43,24,24,48,69,45,19,37,44,54,36,
+31,32,58,31,43,63,26,99,114,29,66,39,3,7,5,3,21,32,38,16,48,76,70,74,45,166,
+74,48,69,55,51,31,8,32,42,52,29,41,88,72,47,7,21,37,31,56,9,11,16,17,57,65,
+1,17,34,17,5,18,21,21,7,17,33,29,27,11,33,58,72,98,74,254,241,0,0,2,0,107,
+254,236,2,63,3,0,0,32,0,33,0,0,1,38,38,35,34,21,20,22,23,22,22,21,7,38,39,
+38,38,53,52,54,51,50,22,23,54,54,55,23,20,7,6,6,7,3,1,100,18,85,48,21,31,
+38,58,49,62,17,51,72,51,71,76,37,81,31,24,67,77,4,49,38,35,24,124,1,118,90,
+137,22,26,85,75,117,182,87,15,107,98,136,142,43,71,151,91,76,55,83,57,58,
+101,49,38,54,63,253,87,0,0,2,0,37,254,236,1,231,2,215,0,28,0,29,0,0,37,20,
+6,7,6,35,34,38,39,38,38,53,52,54,55,54,55,22,21,20,7,7,6,6,7,22,22,51,50,
+3,1,231,46,31,54,123,48,115,24,8,1,143,170,33,32,33,39,125,97,82,4,18,109,
+56,110,119,152,70,66,8,14,12,10,26,40,27,107,235,194,37,45,35,45,55,44,143,
+108,106,24,13,22,254,104,0,0,1,0,0,2,226,1,233,3,69,0,3,0,0,17,33,21,33,1,
+233,254,23,3,69,99,0,0,2,0,0,2,27,2,7,3,69,0,3,0,7,0,0,17,33,21,33,23,33,
+21,33,1,233,254,23,30,1,233,254,23,3,69,99,100,99,0,1,0,0,2,139,2,65,2,238,
+0,3,0,0,17,33,21,33,2,65,253,191,2,238,99,0,0,2,0,0,1,196,2,98,2,238,0,3,
+0,7,0,0,17,33,21,33,23,33,21,33,2,65,253,191,33,2,65,253,191,2,238,99,100,
+99,0,8,0,139,255,150,6,241,5,194,0,54,0,61,0,62,0,63,0,64,0,65,0,66,0,67,
+0,0,33,35,34,39,6,6,35,35,34,38,39,39,7,46,4,53,52,62,3,55,39,54,55,19,22,
+51,51,50,55,3,54,55,19,19,22,51,51,50,55,2,3,54,55,19,18,18,23,20,7,6,1,22,
+22,23,3,6,6,1,1,33,1,1,19,5,182,4,147,85,75,120,85,3,124,154,12,12,70,112,
+84,91,96,49,35,53,108,145,83,10,61,95,21,93,116,7,115,106,81,54,84,11,13,
+98,112,7,121,103,38,65,61,77,15,21,16,1,71,39,250,108,81,197,119,55,115,179,
+3,99,2,44,254,16,1,157,251,125,153,73,42,31,93,85,74,132,10,19,35,54,50,21,
+21,95,105,95,90,35,86,55,59,253,28,54,53,2,209,56,59,254,178,254,12,55,54,
+1,242,2,40,63,51,254,209,254,179,254,193,143,68,137,71,1,148,69,47,2,1,76,
+39,113,2,167,251,29,6,44,254,88,251,124,0,4,3,172,4,15,5,43,6,185,0,38,0,
+49,0,50,0,51,0,0,1,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,55,23,6,21,
+20,51,50,54,53,39,55,22,22,51,50,54,55,38,39,39,52,54,3,22,21,20,7,39,38,
+39,39,52,54,19,3,5,5,21,17,66,47,17,42,14,16,57,30,41,53,26,31,8,50,23,32,
+3,48,7,33,47,13,23,4,5,28,4,34,140,12,39,11,2,18,4,32,47,47,5,104,42,78,20,
+51,79,17,18,39,41,53,49,47,48,6,32,23,58,35,28,72,31,56,64,17,8,23,62,18,
+20,37,1,37,81,86,91,59,3,78,126,39,32,31,253,144,2,170,0,1,255,236,255,245,
+4,57,5,91,0,7,0,0,3,55,1,1,33,21,35,1,20,88,1,211,1,16,1,18,168,254,153,5,
+43,48,251,186,2,33,109,253,44,0,0,1,1,130,3,54,2,195,5,154,0,35,0,0,1,52,
+54,54,55,22,21,20,7,6,6,7,22,22,23,23,6,6,21,20,22,51,50,55,23,6,7,6,35,34,
+53,52,54,55,38,38,1,130,39,86,70,4,31,33,54,31,23,59,42,28,29,77,76,47,54,
+38,10,8,7,33,52,172,47,23,57,62,4,170,38,95,72,35,11,13,44,26,27,39,28,25,
+25,9,61,29,115,24,23,30,11,18,7,13,56,103,32,110,33,24,50,0,255,255,0,70,
+254,178,8,221,0,190,2,6,3,216,0,0,255,255,0,70,254,178,8,221,0,190,2,6,3,
+216,0,0,255,255,0,70,254,178,8,221,0,190,2,6,3,216,0,0,0,6,0,70,254,178,8,
+221,0,190,0,27,0,28,0,29,0,30,0,31,0,32,0,0,1,35,32,39,38,53,55,4,33,33,54,
+54,55,22,21,20,7,7,6,21,20,22,51,50,55,6,7,6,37,41,3,4,203,250,253,143,154,
+128,1,1,31,2,168,2,250,4,124,200,11,48,76,136,65,60,121,144,15,45,127,250,
+141,2,48,252,184,2,48,2,48,254,178,24,17,122,21,34,120,154,100,28,29,72,32,
+46,82,34,21,24,33,89,69,31,108,0,255,255,0,66,253,143,12,229,255,191,2,6,
+0,7,0,0,255,255,0,66,253,143,12,229,255,191,2,6,0,7,0,0,255,255,0,66,253,
+143,12,229,255,191,2,6,0,7,0,0,255,255,0,66,253,143,12,229,255,191,2,6,0,
+7,0,0,255,255,0,105,254,174,9,159,0,161,2,6,3,224,0,0,255,255,0,105,254,174,
+9,159,0,161,2,6,3,224,0,0,255,255,0,105,254,174,9,159,0,161,2,6,3,224,0,0,
+0,7,0,105,254,174,9,159,0,161,0,38,0,53,0,54,0,55,0,56,0,57,0,58,0,0,5,20,
+14,2,7,14,4,35,34,4,33,34,46,2,53,52,62,2,51,50,30,2,21,20,6,7,32,36,55,62,
+2,37,52,35,34,14,2,21,20,30,2,23,54,54,5,41,3,9,159,10,29,46,29,32,110,138,
+157,160,77,39,252,194,254,139,55,116,96,61,44,75,98,54,40,71,54,32,27,18,
+1,121,3,70,43,86,205,240,248,206,121,22,60,55,38,53,82,98,44,10,9,2,238,2,
+48,254,232,253,208,4,96,131,31,55,45,31,7,8,11,9,5,4,1,17,50,90,73,52,97,
+75,45,32,55,74,43,36,72,30,1,1,1,8,20,38,136,9,24,40,30,33,39,22,7,1,20,35,
+20,0,255,255,0,70,254,106,8,123,0,168,2,6,3,228,0,0,255,255,0,70,254,106,
+8,123,0,168,2,6,3,228,0,0,255,255,0,70,254,106,8,123,0,168,2,6,3,228,0,0,
+0,7,0,70,254,106,8,123,0,168,0,61,0,73,0,74,0,75,0,76,0,77,0,78,0,0,1,55,
+38,38,39,7,14,3,35,33,34,46,2,39,38,38,53,30,3,51,33,50,62,2,55,54,54,51,
+50,22,23,6,6,7,22,22,23,62,3,51,50,30,2,21,20,14,2,35,34,38,39,7,37,50,54,
+55,38,38,35,34,6,7,22,22,37,41,3,5,200,48,22,42,21,3,14,43,85,102,84,253,
+217,47,86,87,90,53,69,59,92,129,108,101,61,2,89,82,109,67,36,19,9,32,22,13,
+26,11,17,28,14,19,39,20,52,100,92,82,34,43,75,55,31,72,107,123,50,57,107,
+52,60,1,34,62,129,69,42,88,46,43,109,70,36,70,252,160,253,208,1,24,2,48,1,
+24,254,144,84,8,19,11,3,11,31,29,20,3,7,14,11,14,81,69,15,20,11,5,28,56,54,
+29,16,20,8,11,39,60,23,9,14,6,76,122,84,45,36,60,78,42,79,113,73,34,19,17,
+95,216,38,53,63,51,99,95,6,5,44,0,255,255,0,110,253,233,15,27,2,134,2,6,3,
+233,0,0,255,255,0,110,253,233,15,27,2,134,2,6,3,233,0,0,255,255,0,110,253,
+233,15,27,2,134,2,6,3,233,0,0,255,255,0,110,253,233,15,27,2,134,2,6,3,233,
+0,0,0,8,0,110,253,233,15,27,2,134,0,122,0,123,0,124,0,125,0,126,0,127,0,128,
+0,129,0,0,37,50,54,55,62,5,51,50,22,23,6,6,7,30,3,51,46,3,53,52,62,2,55,30,
+3,21,20,14,2,7,34,46,2,39,6,6,7,14,3,35,34,46,4,35,34,14,2,21,20,30,2,23,
+22,22,21,20,6,7,38,39,38,36,38,38,35,33,34,14,4,7,52,54,55,62,2,36,51,33,
+50,30,2,23,38,38,53,52,62,4,51,50,30,4,5,41,5,12,37,51,73,37,12,23,27,32,
+31,33,21,11,27,11,26,43,20,39,78,87,98,59,18,41,36,23,25,39,48,23,9,27,26,
+18,15,23,28,13,81,125,101,86,42,4,8,5,7,43,66,85,48,80,124,98,77,64,55,28,
+31,54,39,23,32,63,93,61,14,8,19,10,30,82,134,254,249,248,228,100,253,151,
+121,186,147,117,106,102,65,59,69,54,151,203,1,4,165,2,105,54,155,179,193,
+93,24,25,24,41,53,57,58,25,37,67,70,77,95,117,245,167,1,24,1,24,1,24,1,24,
+1,24,1,24,106,9,12,19,77,90,89,47,18,8,8,56,137,66,18,30,21,12,66,113,92,
+69,23,28,51,44,36,13,60,118,113,106,47,20,64,72,71,25,12,23,33,20,9,16,8,
+12,20,15,8,25,37,44,37,25,45,64,71,27,60,77,54,42,24,6,25,21,28,75,34,14,
+44,21,31,20,9,4,7,11,14,17,10,69,79,16,12,22,17,9,12,20,29,16,41,95,59,45,
+96,89,79,60,34,28,42,48,40,22,132,0,255,255,0,100,252,193,9,86,7,95,2,6,0,
+221,0,0,255,255,0,100,252,193,9,86,7,95,2,6,0,221,0,0,255,255,0,100,252,193,
+9,86,7,95,2,6,0,221,0,0,0,3,1,80,255,150,3,151,5,229,0,33,0,34,0,35,0,0,1,
+30,2,21,20,14,2,7,39,62,3,53,52,46,3,53,52,62,2,55,22,23,23,22,23,7,22,3,
+19,3,99,3,5,4,70,114,146,76,137,89,160,120,71,14,21,22,9,15,40,54,27,11,25,
+17,9,11,55,2,98,90,4,52,60,117,96,20,110,193,163,132,50,11,69,137,144,156,
+89,36,124,145,148,59,27,22,46,36,20,5,43,86,52,26,36,47,20,1,154,249,177,
+0,0,4,0,70,255,150,3,187,4,188,0,49,0,50,0,51,0,52,0,0,33,38,53,52,62,2,51,
+50,62,2,55,46,3,39,7,38,38,53,52,54,55,30,5,23,30,5,21,20,14,2,7,14,5,5,1,
+1,1,24,6,11,8,9,4,57,137,148,153,73,41,134,166,190,97,75,37,64,27,44,45,114,
+124,127,115,96,32,12,33,36,35,28,17,15,20,22,6,45,113,121,120,106,84,2,43,
+253,41,1,27,7,16,24,51,35,23,3,9,16,12,77,175,170,154,56,5,34,91,46,34,61,
+23,31,89,106,117,118,114,50,19,55,62,65,57,45,11,18,47,42,31,1,8,11,8,4,2,
+1,106,5,38,250,218,0,0,4,0,108,255,150,5,4,5,194,0,54,0,55,0,56,0,57,0,0,
+1,14,2,7,6,6,7,14,3,7,39,62,3,55,62,2,18,55,54,54,55,22,18,18,23,22,23,22,
+23,22,51,50,22,21,21,20,35,34,46,2,39,46,2,39,38,39,6,19,19,33,3,145,9,19,
+23,13,48,159,111,63,102,96,97,58,7,116,183,144,110,44,49,66,41,21,5,38,65,
+35,7,8,5,2,3,4,38,44,55,76,11,6,17,50,99,81,54,6,13,17,12,5,4,4,4,10,110,
+253,214,2,243,69,136,123,45,168,175,14,7,9,5,3,1,71,29,52,63,83,60,68,197,
+237,1,8,136,39,51,24,153,254,221,254,221,148,136,145,22,14,18,10,7,122,17,
+20,43,68,47,100,176,168,84,59,64,36,2,169,249,212,0,3,0,69,255,150,2,171,
+4,164,0,20,0,21,0,22,0,0,37,38,2,39,35,38,38,39,38,53,52,54,55,30,3,23,22,
+22,23,1,1,2,118,80,191,124,75,37,41,4,9,48,31,64,127,114,96,32,26,47,29,254,
+12,1,45,205,187,1,38,118,38,64,16,25,37,42,53,14,41,130,156,170,79,66,134,
+79,3,182,250,242,255,255,1,80,255,150,3,151,7,122,2,38,3,237,0,0,0,7,0,90,
+1,230,3,108,255,255,1,80,255,150,3,151,7,70,2,38,3,237,0,0,0,7,1,120,1,101,
+3,100,255,255,1,80,255,150,4,5,7,150,2,38,3,237,0,0,0,7,1,124,1,62,3,148,
+255,255,1,80,255,150,4,25,5,229,2,38,3,237,0,0,0,7,3,205,2,48,0,160,255,255,
+1,80,253,239,4,17,5,229,2,38,3,237,0,0,0,7,1,125,1,89,255,248,255,255,255,
+109,255,150,3,187,5,128,2,38,3,238,0,0,0,6,0,83,249,81,255,255,255,137,255,
+150,3,187,6,88,2,38,3,238,0,0,0,7,2,26,0,32,0,186,255,255,0,70,254,15,3,187,
+4,188,2,38,3,238,0,0,0,7,0,95,0,252,255,15,255,255,255,152,255,150,3,187,
+5,232,2,38,3,238,0,0,0,7,2,16,0,41,0,128,255,255,255,237,255,150,3,187,6,
+66,2,38,3,238,0,0,0,7,0,84,255,251,0,156,255,255,0,70,254,8,3,187,4,188,2,
+38,3,238,0,0,0,7,0,85,0,241,255,58,255,255,0,108,255,150,5,4,7,87,2,38,3,
+239,0,0,0,7,0,90,2,134,3,73,255,255,0,108,255,150,5,4,7,35,2,38,3,239,0,0,
+0,7,1,120,2,5,3,65,255,255,0,108,255,150,5,4,7,115,2,38,3,239,0,0,0,7,1,124,
+1,222,3,113,255,255,0,108,253,239,5,4,5,194,2,38,3,239,0,0,0,7,1,125,2,43,
+255,248,255,255,0,108,255,150,5,4,5,194,2,38,3,239,0,0,0,7,3,205,2,186,1,
+1,255,255,255,161,255,150,2,171,5,104,2,38,3,240,0,0,0,6,0,83,45,57,255,255,
+255,189,255,150,2,171,6,64,2,38,3,240,0,0,0,7,2,26,0,84,0,162,255,255,0,69,
+254,15,2,171,4,164,2,38,3,240,0,0,0,7,0,95,1,66,255,15,255,255,255,204,255,
+150,2,171,5,208,2,38,3,240,0,0,0,6,2,16,93,104,255,255,0,33,255,150,2,171,
+6,41,2,38,3,240,0,0,0,7,0,84,0,47,0,131,255,255,255,220,255,150,2,171,6,44,
+2,38,3,240,0,0,0,7,0,75,0,8,1,10,255,255,0,69,254,8,2,171,4,164,2,38,3,240,
+0,0,0,7,0,85,1,55,255,58,0,2,0,0,2,227,1,173,4,13,0,3,0,7,0,0,17,33,21,33,
+23,33,21,33,1,143,254,113,30,1,143,254,113,4,13,99,100,99,255,255,1,80,255,
+150,4,15,5,229,2,38,3,237,0,0,0,7,4,8,2,98,0,0,0,4,0,40,253,182,3,87,3,28,
+0,44,0,60,0,61,0,62,0,0,1,34,46,2,39,55,22,51,50,62,2,55,38,38,53,14,3,35,
+34,46,2,53,52,62,2,51,50,30,4,21,20,14,4,19,34,14,2,21,20,22,51,50,54,55,
+46,3,3,3,1,109,35,91,92,82,25,29,111,138,85,146,118,86,25,1,1,24,56,68,80,
+47,60,95,65,35,50,81,104,54,47,84,72,56,40,21,34,63,89,109,126,69,35,65,50,
+29,117,109,59,98,51,17,56,69,76,25,70,254,26,24,38,46,23,67,38,75,120,153,
+78,5,7,5,22,42,33,20,39,70,97,58,82,155,121,74,47,80,106,118,123,57,67,149,
+144,132,100,59,3,240,41,61,70,29,75,79,22,26,67,113,81,46,1,18,250,154,0,
+4,0,40,253,182,3,226,3,45,0,46,0,62,0,63,0,64,0,0,1,34,46,2,39,55,22,51,50,
+62,2,55,38,38,39,38,38,53,52,62,2,51,50,30,4,21,21,51,50,22,21,21,20,35,34,
+6,39,14,3,19,34,14,2,21,20,22,23,22,22,23,46,3,3,3,1,109,35,91,92,82,25,29,
+111,138,72,126,107,86,31,61,121,57,128,127,50,81,104,54,48,85,71,56,39,21,
+122,9,8,17,34,73,38,23,90,121,150,55,35,65,50,29,114,109,35,122,67,12,53,
+73,86,32,70,254,26,24,38,46,23,67,38,54,91,119,65,2,10,9,20,121,116,82,155,
+121,74,48,82,108,122,128,60,9,10,7,122,17,1,1,89,174,138,85,4,1,41,60,70,
+29,72,74,20,7,6,2,79,138,104,60,1,18,250,137,0,4,0,129,254,153,4,174,3,133,
+0,57,0,73,0,74,0,75,0,0,37,54,54,55,38,38,53,52,62,2,55,62,3,51,50,30,2,21,
+20,6,7,22,22,51,50,22,21,21,20,35,34,46,2,39,6,6,7,6,6,21,20,22,23,7,46,3,
+53,52,62,2,37,46,3,35,34,14,2,7,22,22,23,54,54,3,3,1,142,43,82,40,39,50,6,
+10,13,8,26,69,83,95,51,43,77,59,35,59,60,57,125,69,9,8,17,74,123,102,85,35,
+66,150,101,95,90,44,29,64,26,50,39,25,46,76,96,2,110,4,37,47,49,16,28,71,
+73,68,25,42,98,56,63,111,140,30,155,5,15,9,39,100,51,19,61,64,56,14,47,78,
+57,31,66,105,131,66,72,131,51,12,11,10,7,122,17,13,22,29,17,29,38,14,14,82,
+60,50,82,35,36,26,65,73,76,36,59,84,57,31,223,43,90,74,48,36,63,85,49,50,
+75,28,25,64,2,60,251,253,0,3,255,157,4,93,0,26,5,32,0,11,0,12,0,13,0,0,3,
+52,54,51,50,22,21,20,6,35,34,38,55,21,99,36,26,26,37,37,26,26,36,62,4,176,
+26,36,36,26,26,37,37,138,195,0,0,3,0,160,254,240,1,150,0,77,0,7,0,8,0,9,0,
+0,5,6,7,38,39,54,55,22,39,19,1,150,48,69,76,53,90,36,46,46,3,120,65,67,60,
+57,90,42,51,131,254,163,0,3,255,47,3,134,0,196,4,162,0,7,0,8,0,9,0,0,19,23,
+20,7,6,7,55,36,39,19,194,2,47,149,209,10,1,29,122,27,4,122,22,51,21,69,61,
+87,95,82,254,228,255,255,0,156,255,150,4,127,5,194,0,39,2,11,2,6,0,0,0,39,
+2,7,2,122,255,18,0,6,1,177,0,0,255,255,0,139,255,150,5,223,3,247,0,39,2,11,
+3,102,0,0,0,39,2,7,3,218,255,18,0,6,1,112,0,0,255,255,0,70,253,252,6,56,4,
+66,0,39,2,11,3,191,0,0,0,39,2,7,4,51,255,18,0,6,1,246,0,0,255,255,0,70,253,
+252,6,56,4,191,0,39,2,11,3,191,0,0,0,39,2,7,4,51,255,18,0,38,1,246,0,0,0,
+7,0,79,1,87,255,180,255,255,0,70,253,252,6,56,4,228,0,39,2,11,3,191,0,0,0,
+39,2,7,4,51,255,18,0,38,1,246,0,0,0,7,2,24,0,158,0,35,255,255,0,70,253,252,
+6,56,5,65,0,39,2,11,3,191,0,0,0,39,2,7,4,51,255,18,0,38,1,246,0,0,0,7,0,112,
+1,217,255,231,255,255,0,98,251,113,7,248,3,247,0,39,2,11,5,127,0,0,0,39,2,
+7,5,243,255,18,0,38,1,247,0,0,0,7,1,132,1,86,253,167,255,255,0,98,253,134,
+7,248,3,247,0,39,2,11,5,127,0,0,0,39,2,7,5,243,255,18,0,6,1,247,0,0,255,255,
+255,186,253,250,5,152,3,247,0,39,2,11,3,31,0,0,0,39,2,7,3,147,255,18,0,6,
+1,199,0,0,255,255,255,186,253,250,5,152,4,127,0,39,2,11,3,31,0,0,0,39,2,7,
+3,147,255,18,0,39,1,120,255,247,0,157,0,6,1,199,0,0,255,255,0,139,253,143,
+6,178,3,247,0,39,2,11,4,57,0,0,0,39,2,7,4,173,255,18,0,6,1,237,0,0,255,255,
+0,68,253,132,7,40,3,247,0,39,2,11,4,175,0,0,0,39,2,7,5,35,255,18,0,39,1,120,
+0,130,255,28,0,6,1,109,0,0,255,255,0,98,253,134,7,248,3,247,0,39,2,11,5,127,
+0,0,0,39,2,7,5,243,255,18,0,6,1,247,0,0,255,255,0,98,252,77,7,248,3,247,0,
+39,2,11,5,127,0,0,0,39,2,7,5,243,255,18,0,38,1,247,0,0,0,7,1,123,0,185,253,
+238,255,255,255,186,253,250,5,152,3,30,0,39,2,11,3,31,0,0,0,39,1,121,3,6,
+255,243,0,6,1,199,0,0,255,255,255,186,253,250,5,152,4,127,0,39,2,11,3,31,
+0,0,0,39,1,121,3,6,255,243,0,39,1,120,255,247,0,157,0,6,1,199,0,0,255,255,
+0,139,253,143,6,178,3,28,0,39,2,11,4,57,0,0,0,39,1,121,4,32,255,243,0,6,1,
+237,0,0,255,255,0,68,253,132,7,40,2,254,0,39,2,11,4,175,0,0,0,39,1,121,4,
+150,255,243,0,39,1,120,0,130,255,28,0,6,1,109,0,0,255,255,0,98,253,134,7,
+248,2,54,0,39,2,11,5,127,0,0,0,39,1,121,5,102,255,243,0,6,1,247,0,0,255,255,
+0,98,252,77,7,248,2,54,0,39,2,11,5,127,0,0,0,39,1,121,5,102,255,243,0,38,
+1,247,0,0,0,7,1,123,0,185,253,238,255,255,255,186,253,250,6,36,3,141,0,39,
+2,12,3,31,0,0,0,39,1,122,3,34,255,158,0,6,1,199,0,0,255,255,255,186,253,250,
+6,36,4,127,0,39,2,12,3,31,0,0,0,39,1,122,3,34,255,158,0,39,1,120,255,247,
+0,157,0,6,1,199,0,0,255,255,0,139,253,143,7,62,3,141,0,39,2,12,4,57,0,0,0,
+39,1,122,4,60,255,158,0,6,1,237,0,0,255,255,0,68,253,132,7,180,3,141,0,39,
+2,12,4,175,0,0,0,39,1,122,4,178,255,158,0,39,1,120,0,130,255,28,0,6,1,109,
+0,0,255,255,0,98,253,134,8,132,3,141,0,39,2,12,5,127,0,0,0,39,1,122,5,130,
+255,158,0,6,1,247,0,0,255,255,0,98,252,77,8,132,3,141,0,39,2,12,5,127,0,0,
+0,39,1,122,5,130,255,158,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,255,
+186,253,250,6,36,3,231,0,39,2,12,3,31,0,0,0,39,1,124,3,24,255,229,0,6,1,199,
+0,0,255,255,255,186,253,250,6,36,4,127,0,39,2,12,3,31,0,0,0,39,1,124,3,24,
+255,229,0,39,1,120,255,247,0,157,0,6,1,199,0,0,255,255,0,139,253,143,7,62,
+3,231,0,39,2,12,4,57,0,0,0,39,1,124,4,50,255,229,0,6,1,237,0,0,255,255,0,
+68,253,132,7,180,3,211,0,39,2,12,4,175,0,0,0,39,1,124,4,168,255,209,0,39,
+1,120,0,130,255,28,0,6,1,109,0,0,255,255,0,98,253,134,8,132,3,231,0,39,2,
+12,5,127,0,0,0,39,1,124,5,120,255,229,0,6,1,247,0,0,255,255,0,98,252,77,8,
+132,3,231,0,39,2,12,5,127,0,0,0,39,1,124,5,120,255,229,0,38,1,247,0,0,0,7,
+1,123,0,185,253,238,255,255,0,98,253,134,8,186,4,195,0,39,2,13,5,127,0,0,
+0,39,1,120,5,125,0,225,0,6,1,247,0,0,255,255,0,98,252,77,8,186,4,195,0,39,
+2,13,5,127,0,0,0,39,1,120,5,125,0,225,0,38,1,247,0,0,0,7,1,123,0,185,253,
+238,255,255,0,98,253,134,8,186,4,185,0,39,2,13,5,127,0,0,0,39,1,122,5,96,
+0,202,0,6,1,247,0,0,255,255,0,98,252,77,8,186,4,185,0,39,2,13,5,127,0,0,0,
+39,1,122,5,96,0,202,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,156,
+255,150,5,213,5,194,0,39,1,233,2,6,0,0,0,6,1,177,0,0,255,255,0,68,253,132,
+8,138,5,194,0,39,1,233,4,187,0,0,0,6,1,234,0,0,255,255,0,139,253,143,8,8,
+5,60,0,39,1,233,4,57,0,0,0,6,1,237,0,0,255,255,0,98,253,134,9,78,5,60,0,39,
+1,233,5,127,0,0,0,6,1,247,0,0,255,255,0,98,252,77,9,78,5,60,0,39,1,233,5,
+127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,139,253,143,6,81,
+5,194,0,39,1,236,4,57,0,0,0,6,1,237,0,0,255,255,0,98,253,134,7,151,5,194,
+0,39,1,236,5,127,0,0,0,6,1,247,0,0,255,255,0,98,252,77,7,151,5,194,0,39,1,
+236,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,156,255,130,
+5,119,5,194,0,39,1,239,2,6,0,0,0,6,1,177,0,0,255,255,0,139,253,143,7,170,
+3,28,0,39,1,239,4,57,0,0,0,6,1,237,0,0,255,255,255,186,253,250,5,152,3,151,
+0,39,2,11,3,31,0,0,0,39,1,120,2,179,255,181,0,6,1,199,0,0,255,255,255,186,
+253,250,5,152,4,127,0,39,2,11,3,31,0,0,0,39,1,120,2,179,255,181,0,39,1,120,
+255,247,0,157,0,6,1,199,0,0,255,255,0,139,253,143,6,178,3,151,0,39,2,11,4,
+57,0,0,0,39,1,120,3,205,255,181,0,6,1,237,0,0,255,255,0,68,253,132,7,40,3,
+151,0,39,2,11,4,175,0,0,0,39,1,120,4,67,255,181,0,39,1,120,0,130,255,28,0,
+6,1,109,0,0,255,255,0,98,253,134,7,248,3,151,0,39,2,11,5,127,0,0,0,39,1,120,
+5,19,255,181,0,6,1,247,0,0,255,255,0,98,252,77,7,248,3,151,0,39,2,11,5,127,
+0,0,0,39,1,120,5,19,255,181,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,
+0,98,253,134,5,162,3,84,2,38,1,247,0,0,0,7,0,112,2,153,253,250,255,255,255,
+186,253,250,6,36,3,30,0,39,2,12,3,31,0,0,0,39,1,123,3,23,255,254,0,6,1,199,
+0,0,255,255,255,186,253,250,6,36,4,127,0,39,2,12,3,31,0,0,0,39,1,123,3,23,
+255,254,0,39,1,120,255,247,0,157,0,6,1,199,0,0,255,255,0,139,253,143,7,62,
+3,28,0,39,2,12,4,57,0,0,0,39,1,123,4,48,255,254,0,6,1,237,0,0,255,255,0,68,
+253,132,7,180,2,254,0,39,2,12,4,175,0,0,0,39,1,123,4,166,255,254,0,39,1,120,
+0,130,255,28,0,6,1,109,0,0,255,255,0,98,253,134,8,132,2,54,0,39,2,12,5,127,
+0,0,0,39,1,123,5,118,255,254,0,6,1,247,0,0,255,255,0,98,252,77,8,132,2,54,
+0,39,2,12,5,127,0,0,0,39,1,123,5,118,255,254,0,38,1,247,0,0,0,7,1,123,0,185,
+253,238,255,255,0,98,253,134,10,170,5,94,0,39,1,215,5,127,0,0,0,6,1,247,0,
+0,255,255,0,98,252,77,10,170,5,94,0,39,1,215,5,127,0,0,0,38,1,247,0,0,0,7,
+1,123,0,185,253,238,255,255,0,98,253,134,8,241,3,98,0,39,1,221,5,127,0,0,
+0,6,1,247,0,0,255,255,0,98,252,77,8,241,3,98,0,39,1,221,5,127,0,0,0,38,1,
+247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,253,134,8,241,4,195,0,39,1,221,
+5,127,0,0,0,39,1,120,5,149,0,225,0,6,1,247,0,0,255,255,0,98,252,77,8,241,
+4,195,0,39,1,221,5,127,0,0,0,39,1,120,5,149,0,225,0,38,1,247,0,0,0,7,1,123,
+0,185,253,238,255,255,0,98,253,134,10,239,2,164,0,39,1,203,5,127,0,0,0,6,
+1,247,0,0,255,255,0,98,252,77,10,239,2,164,0,39,1,203,5,127,0,0,0,38,1,247,
+0,0,0,7,1,123,0,185,253,238,255,255,0,98,253,134,10,239,4,85,0,39,1,203,5,
+127,0,0,0,39,1,124,6,138,0,83,0,6,1,247,0,0,255,255,0,98,252,77,10,239,4,
+85,0,39,1,203,5,127,0,0,0,39,1,124,6,138,0,83,0,38,1,247,0,0,0,7,1,123,0,
+185,253,238,255,255,0,98,253,134,10,245,3,28,0,39,1,193,5,127,0,0,0,6,1,247,
+0,0,255,255,0,98,252,77,10,245,3,28,0,39,1,193,5,127,0,0,0,38,1,247,0,0,0,
+7,1,123,0,185,253,238,255,255,0,98,253,134,10,245,3,28,0,39,1,193,5,127,0,
+0,0,39,1,121,6,151,255,243,0,6,1,247,0,0,255,255,0,98,252,77,10,245,3,28,
+0,39,1,193,5,127,0,0,0,39,1,121,6,151,255,243,0,38,1,247,0,0,0,7,1,123,0,
+185,253,238,255,255,0,98,253,134,10,245,4,125,0,39,1,193,5,127,0,0,0,39,1,
+120,6,122,0,155,0,6,1,247,0,0,255,255,0,98,252,77,10,245,4,125,0,39,1,193,
+5,127,0,0,0,39,1,120,6,122,0,155,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,
+255,0,98,253,134,11,219,3,63,0,39,1,209,5,127,0,0,0,6,1,247,0,0,255,255,0,
+98,252,77,11,219,3,63,0,39,1,209,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,
+253,238,255,255,0,98,253,134,11,219,4,160,0,39,1,120,7,35,0,190,0,39,1,209,
+5,127,0,0,0,6,1,247,0,0,255,255,0,98,252,77,11,219,4,160,0,39,1,120,7,35,
+0,190,0,39,1,209,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,
+0,133,253,83,10,191,4,85,0,39,1,203,5,79,0,0,0,39,1,124,6,90,0,83,0,38,1,
+191,0,0,0,7,1,121,1,51,0,228,255,255,0,133,253,83,10,195,4,85,0,39,1,203,
+5,83,0,0,0,39,1,124,6,94,0,83,0,6,1,191,0,0,255,255,0,133,253,83,10,191,4,
+165,0,39,1,203,5,79,0,0,0,39,1,124,6,90,0,83,0,38,1,191,0,0,0,7,1,120,1,33,
+0,195,255,255,0,139,253,143,9,169,4,85,0,39,1,203,4,57,0,0,0,39,1,124,5,68,
+0,83,0,6,1,237,0,0,255,255,255,186,253,250,8,143,4,85,0,39,1,203,3,31,0,0,
+0,39,1,124,4,42,0,83,0,6,1,199,0,0,255,255,255,186,253,250,8,143,3,30,0,39,
+1,203,3,31,0,0,0,6,1,199,0,0,255,255,255,186,253,250,9,123,3,63,0,39,1,209,
+3,31,0,0,0,6,1,199,0,0,255,255,255,186,253,250,9,123,4,160,0,39,1,120,4,195,
+0,190,0,39,1,209,3,31,0,0,0,6,1,199,0,0,255,255,0,156,255,150,3,100,5,194,
+2,38,1,177,0,0,0,7,0,75,2,6,0,0,255,255,255,239,253,129,4,174,5,35,0,39,2,
+8,2,226,0,0,0,39,2,7,3,67,0,62,0,38,2,12,0,0,0,7,1,132,0,149,255,183,255,
+255,255,239,255,150,4,35,5,35,0,39,2,8,2,87,0,0,0,39,2,7,2,184,0,62,0,6,2,
+11,0,0,255,255,255,239,254,82,7,31,5,35,0,39,2,8,5,83,0,0,0,39,2,7,5,180,
+0,62,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,150,7,31,5,
+35,0,39,2,8,5,83,0,0,0,39,2,7,5,180,0,62,0,6,1,193,0,0,255,255,255,239,255,
+150,7,31,5,35,0,39,2,8,5,83,0,0,0,39,2,7,5,180,0,62,0,38,1,193,0,0,0,7,1,
+120,0,251,0,155,255,255,255,239,255,130,5,26,5,35,0,39,2,8,3,78,0,0,0,39,
+2,7,3,175,0,62,0,6,1,239,0,0,255,255,255,239,253,250,4,216,5,35,0,39,2,8,
+3,12,0,0,0,39,2,7,3,109,0,62,0,6,1,245,0,0,255,255,255,239,254,82,7,31,3,
+98,0,39,2,8,5,83,0,0,0,39,1,121,4,227,255,243,0,38,1,193,0,0,0,7,1,121,1,
+24,255,243,255,255,255,239,254,82,7,31,3,98,0,39,2,8,5,83,0,0,0,39,1,121,
+4,227,255,243,0,6,1,193,0,0,255,255,255,239,254,82,7,31,4,125,0,39,2,8,5,
+83,0,0,0,39,1,121,4,227,255,243,0,38,1,193,0,0,0,7,1,120,0,251,0,155,255,
+255,255,239,254,82,5,26,3,98,0,39,2,8,3,78,0,0,0,39,1,121,2,222,255,243,0,
+6,1,239,0,0,255,255,255,239,253,250,4,216,3,198,0,39,2,8,3,12,0,0,0,39,1,
+121,2,156,255,243,0,6,1,245,0,0,255,255,255,239,254,82,7,131,4,185,0,39,1,
+122,4,183,0,202,0,39,2,8,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,
+255,255,239,255,150,7,131,4,185,0,39,1,122,4,183,0,202,0,39,2,8,5,83,0,0,
+0,6,1,193,0,0,255,255,255,239,255,150,7,131,4,185,0,39,1,122,4,183,0,202,
+0,39,2,8,5,83,0,0,0,38,1,193,0,0,0,7,1,120,0,251,0,155,255,255,255,239,255,
+130,5,126,4,185,0,39,1,122,2,178,0,202,0,39,2,8,3,78,0,0,0,6,1,239,0,0,255,
+255,255,239,253,250,5,60,4,185,0,39,1,122,2,112,0,202,0,39,2,8,3,12,0,0,0,
+6,1,245,0,0,255,255,255,239,255,130,5,111,5,19,0,39,2,8,3,78,0,0,0,39,1,124,
+2,168,1,17,0,6,1,239,0,0,255,255,255,239,254,82,10,35,3,28,0,39,1,192,5,83,
+0,0,0,39,1,121,6,109,255,243,0,6,1,193,0,0,255,255,255,239,254,82,8,30,3,
+28,0,39,1,192,3,78,0,0,0,39,1,121,4,104,255,243,0,6,1,239,0,0,255,255,255,
+239,254,82,10,35,3,28,0,39,1,192,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,
+243,255,255,255,239,255,130,8,30,3,28,0,39,1,192,3,78,0,0,0,6,1,239,0,0,255,
+255,255,239,254,82,10,35,4,125,0,39,1,192,5,83,0,0,0,39,1,120,6,76,0,155,
+0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,130,8,30,4,125,
+0,39,1,192,3,78,0,0,0,39,1,120,4,71,0,155,0,6,1,239,0,0,255,255,255,239,254,
+82,10,46,3,28,0,39,1,202,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,
+255,255,239,255,150,10,46,3,28,0,39,1,202,5,83,0,0,0,6,1,193,0,0,255,255,
+255,239,255,150,10,46,4,125,0,39,1,202,5,83,0,0,0,38,1,193,0,0,0,7,1,120,
+0,251,0,155,255,255,255,239,255,130,8,41,3,28,0,39,1,202,3,78,0,0,0,6,1,239,
+0,0,255,255,255,239,255,150,11,18,3,63,0,39,1,208,5,83,0,0,0,6,1,193,0,0,
+255,255,255,239,255,150,11,18,4,125,0,39,1,208,5,83,0,0,0,38,1,193,0,0,0,
+7,1,120,0,251,0,155,255,255,255,239,255,130,9,13,3,63,0,39,1,208,3,78,0,0,
+0,6,1,239,0,0,255,255,255,239,254,82,11,18,4,160,0,39,1,208,5,83,0,0,0,39,
+1,120,6,248,0,190,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,
+150,11,18,4,160,0,39,1,208,5,83,0,0,0,39,1,120,6,248,0,190,0,6,1,193,0,0,
+255,255,255,239,255,150,11,18,4,160,0,39,1,208,5,83,0,0,0,39,1,120,6,248,
+0,190,0,38,1,193,0,0,0,7,1,120,0,251,0,155,255,255,255,239,255,130,9,13,4,
+160,0,39,1,208,3,78,0,0,0,39,1,120,4,242,0,190,0,6,1,239,0,0,255,255,255,
+239,255,150,10,51,5,94,0,39,1,214,5,83,0,0,0,6,1,193,0,0,255,255,255,239,
+255,130,8,46,5,94,0,39,1,214,3,78,0,0,0,39,1,120,5,18,1,19,0,6,1,239,0,0,
+255,255,255,239,254,82,9,41,3,98,0,39,1,220,5,83,0,0,0,38,1,193,0,0,0,7,1,
+121,1,24,255,243,255,255,255,239,255,130,7,36,3,98,0,39,1,220,3,78,0,0,0,
+6,1,239,0,0,255,255,255,239,254,82,9,41,4,195,0,39,1,220,5,83,0,0,0,39,1,
+120,5,111,0,225,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,
+130,7,36,4,195,0,39,1,220,3,78,0,0,0,39,1,120,3,106,0,225,0,6,1,239,0,0,255,
+255,255,239,254,82,8,71,5,123,0,39,2,15,5,83,0,0,0,39,1,120,5,74,1,153,0,
+38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,150,8,71,5,123,0,
+39,2,15,5,83,0,0,0,39,1,120,5,74,1,153,0,6,1,193,0,0,255,255,255,239,255,
+150,8,71,5,123,0,39,2,15,5,83,0,0,0,39,1,120,5,74,1,153,0,38,1,193,0,0,0,
+7,1,120,0,251,0,155,255,255,255,239,255,130,6,66,5,123,0,39,2,15,3,78,0,0,
+0,39,1,120,3,69,1,153,0,6,1,239,0,0,255,255,255,239,255,150,8,71,5,113,0,
+39,2,15,5,83,0,0,0,39,1,122,5,45,1,130,0,6,1,193,0,0,255,255,255,239,255,
+130,6,66,5,113,0,39,2,15,3,78,0,0,0,39,1,122,3,40,1,130,0,6,1,239,0,0,255,
+255,255,239,254,82,8,128,5,60,0,39,1,232,5,83,0,0,0,38,1,193,0,0,0,7,1,121,
+1,24,255,243,255,255,255,239,255,150,8,128,5,60,0,39,1,232,5,83,0,0,0,6,1,
+193,0,0,255,255,255,239,255,150,8,128,5,60,0,39,1,232,5,83,0,0,0,38,1,193,
+0,0,0,7,1,120,0,251,0,155,255,255,255,239,255,150,5,34,5,194,0,39,1,232,1,
+245,0,0,0,6,1,236,0,0,255,255,255,239,255,130,6,123,5,60,0,39,1,232,3,78,
+0,0,0,6,1,239,0,0,255,255,255,239,254,82,6,141,5,194,0,39,1,235,5,83,0,0,
+0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,150,6,141,5,194,
+0,39,1,235,5,83,0,0,0,6,1,193,0,0,255,255,255,239,255,150,6,141,5,194,0,39,
+1,235,5,83,0,0,0,38,1,193,0,0,0,7,1,120,0,251,0,155,255,255,255,239,255,130,
+4,136,5,194,0,39,1,235,3,78,0,0,0,6,1,239,0,0,255,255,255,239,253,250,4,70,
+5,194,0,39,1,235,3,12,0,0,0,6,1,245,0,0,255,255,255,239,254,82,8,152,3,28,
+0,39,1,238,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,
+255,130,8,152,3,28,0,39,1,238,5,83,0,0,0,6,1,193,0,0,255,255,255,239,255,
+130,8,152,4,125,0,39,1,238,5,83,0,0,0,38,1,193,0,0,0,7,1,120,0,251,0,155,
+255,255,255,239,255,130,6,147,3,28,0,39,1,238,3,78,0,0,0,6,1,239,0,0,255,
+255,255,239,254,82,7,31,4,195,0,39,2,8,5,83,0,0,0,39,1,120,4,212,0,225,0,
+38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,150,7,31,4,195,0,
+39,2,8,5,83,0,0,0,39,1,120,4,212,0,225,0,6,1,193,0,0,255,255,255,239,255,
+150,7,31,4,195,0,39,2,8,5,83,0,0,0,39,1,120,4,212,0,225,0,38,1,193,0,0,0,
+7,1,120,0,251,0,155,255,255,255,239,255,130,5,26,4,195,0,39,2,8,3,78,0,0,
+0,39,1,120,2,207,0,225,0,6,1,239,0,0,255,255,255,239,253,250,4,216,4,195,
+0,39,2,8,3,12,0,0,0,39,1,120,2,141,0,225,0,6,1,245,0,0,255,255,255,239,254,
+82,8,250,3,219,0,39,1,244,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,
+255,255,255,239,255,110,6,245,3,219,0,39,1,244,3,78,0,0,0,6,1,239,0,0,255,
+255,255,239,255,110,4,92,5,90,2,38,1,244,0,0,0,7,0,112,4,16,0,0,255,255,255,
+239,254,82,7,217,3,98,0,39,2,10,5,83,0,0,0,39,1,123,5,48,255,254,0,38,1,193,
+0,0,0,7,1,121,1,24,255,243,255,255,255,239,254,93,7,217,3,98,0,39,2,10,5,
+83,0,0,0,39,1,123,5,48,255,254,0,6,1,193,0,0,255,255,255,239,254,93,7,217,
+4,125,0,39,2,10,5,83,0,0,0,39,1,123,5,48,255,254,0,38,1,193,0,0,0,7,1,120,
+0,251,0,155,255,255,255,239,254,93,5,212,3,98,0,39,2,10,3,78,0,0,0,39,1,123,
+3,43,255,254,0,6,1,239,0,0,255,255,255,239,253,250,5,146,3,198,0,39,2,10,
+3,12,0,0,0,39,1,123,2,233,255,254,0,6,1,245,0,0,255,255,255,239,254,82,10,
+46,4,85,0,39,1,202,5,83,0,0,0,39,1,124,6,72,0,83,0,38,1,193,0,0,0,7,1,121,
+1,24,255,243,255,255,255,239,255,150,10,46,4,85,0,39,1,202,5,83,0,0,0,39,
+1,124,6,72,0,83,0,6,1,193,0,0,255,255,255,239,255,150,10,46,4,125,0,39,1,
+202,5,83,0,0,0,39,1,124,6,72,0,83,0,38,1,193,0,0,0,7,1,120,0,251,0,155,255,
+255,255,239,255,130,8,41,4,85,0,39,1,202,3,78,0,0,0,39,1,124,4,67,0,83,0,
+6,1,239,0,0,255,255,255,239,253,250,7,231,3,198,0,39,1,202,3,12,0,0,0,6,1,
+245,0,0,255,255,255,239,253,250,7,231,4,85,0,39,1,202,3,12,0,0,0,39,1,124,
+4,1,0,83,0,6,1,245,0,0,255,255,255,239,255,130,8,46,5,94,0,39,1,214,3,78,
+0,0,0,6,1,239,0,0,255,255,0,156,255,150,3,210,5,194,0,39,2,8,2,6,0,0,0,39,
+2,7,2,103,0,62,0,6,1,177,0,0,255,255,0,139,255,150,5,50,5,35,0,39,2,8,3,102,
+0,0,0,39,2,7,3,199,0,62,0,6,1,112,0,0,255,255,0,70,253,252,5,139,5,35,0,39,
+2,8,3,191,0,0,0,39,2,7,4,32,0,62,0,6,1,246,0,0,255,255,0,70,253,252,5,139,
+5,35,0,39,2,8,3,191,0,0,0,39,2,7,4,32,0,62,0,38,1,246,0,0,0,7,0,79,1,87,255,
+180,255,255,0,70,253,252,5,139,5,35,0,39,2,8,3,191,0,0,0,39,2,7,4,32,0,62,
+0,38,1,246,0,0,0,7,2,24,0,158,0,35,255,255,0,70,253,252,5,139,5,65,0,39,2,
+8,3,191,0,0,0,39,2,7,4,32,0,62,0,38,1,246,0,0,0,7,0,112,1,217,255,231,255,
+255,0,98,251,112,7,75,5,35,0,39,2,8,5,127,0,0,0,39,2,7,5,224,0,62,0,38,1,
+247,0,0,0,7,1,132,1,86,253,166,255,255,0,98,253,134,7,75,5,35,0,39,2,8,5,
+127,0,0,0,39,2,7,5,224,0,62,0,6,1,247,0,0,255,255,0,133,253,83,7,27,5,35,
+0,39,2,8,5,79,0,0,0,39,2,7,5,176,0,62,0,38,1,191,0,0,0,7,1,121,1,51,0,228,
+255,255,0,133,253,83,7,31,5,35,0,39,2,8,5,83,0,0,0,39,2,7,5,180,0,62,0,6,
+1,191,0,0,255,255,0,139,253,143,6,5,5,35,0,39,2,8,4,57,0,0,0,39,2,7,4,154,
+0,62,0,6,1,237,0,0,255,255,0,98,253,134,7,75,5,35,0,39,2,8,5,127,0,0,0,39,
+2,7,5,224,0,62,0,6,1,247,0,0,255,255,0,98,252,77,7,75,5,35,0,39,2,8,5,127,
+0,0,0,39,2,7,5,224,0,62,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,
+133,253,83,7,27,3,98,0,39,2,8,5,79,0,0,0,39,1,121,4,223,255,243,0,38,1,191,
+0,0,0,7,1,121,1,51,0,228,255,255,0,133,253,83,7,31,3,98,0,39,2,8,5,83,0,0,
+0,39,1,121,4,227,255,243,0,6,1,191,0,0,255,255,0,133,253,83,7,27,4,165,0,
+39,2,8,5,79,0,0,0,39,1,121,4,223,255,243,0,38,1,191,0,0,0,7,1,120,1,33,0,
+195,255,255,0,139,253,143,6,5,3,98,0,39,2,8,4,57,0,0,0,39,1,121,3,201,255,
+243,0,6,1,237,0,0,255,255,0,98,253,134,7,75,3,98,0,39,2,8,5,127,0,0,0,39,
+1,121,5,15,255,243,0,6,1,247,0,0,255,255,0,98,252,77,7,75,3,98,0,39,2,8,5,
+127,0,0,0,39,1,121,5,15,255,243,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,
+255,0,133,253,83,7,127,4,185,0,39,1,122,4,179,0,202,0,39,2,8,5,79,0,0,0,38,
+1,191,0,0,0,7,1,121,1,51,0,228,255,255,0,133,253,83,7,131,4,185,0,39,1,122,
+4,183,0,202,0,39,2,8,5,83,0,0,0,6,1,191,0,0,255,255,0,133,253,83,7,127,4,
+185,0,39,1,122,4,179,0,202,0,39,2,8,5,79,0,0,0,38,1,191,0,0,0,7,1,120,1,33,
+0,195,255,255,0,139,253,143,6,105,4,185,0,39,1,122,3,157,0,202,0,39,2,8,4,
+57,0,0,0,6,1,237,0,0,255,255,0,98,253,134,7,175,4,185,0,39,1,122,4,227,0,
+202,0,39,2,8,5,127,0,0,0,6,1,247,0,0,255,255,0,98,252,77,7,175,4,185,0,39,
+1,122,4,227,0,202,0,39,2,8,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,
+255,255,0,133,253,83,7,112,5,19,0,39,2,8,5,79,0,0,0,39,1,124,4,169,1,17,0,
+38,1,191,0,0,0,7,1,121,1,51,0,228,255,255,0,139,253,143,6,90,5,19,0,39,2,
+8,4,57,0,0,0,39,1,124,3,147,1,17,0,6,1,237,0,0,255,255,0,98,253,134,7,160,
+5,19,0,39,2,8,5,127,0,0,0,39,1,124,4,217,1,17,0,6,1,247,0,0,255,255,0,98,
+252,77,7,160,5,19,0,39,2,8,5,127,0,0,0,39,1,124,4,217,1,17,0,38,1,247,0,0,
+0,7,1,123,0,185,253,238,255,255,0,133,253,83,10,35,3,68,0,39,1,192,5,83,0,
+0,0,39,1,121,6,109,255,243,0,6,1,191,0,0,255,255,0,139,253,143,9,9,3,28,0,
+39,1,192,4,57,0,0,0,39,1,121,5,83,255,243,0,6,1,237,0,0,255,255,0,133,253,
+83,10,31,3,68,0,39,1,192,5,79,0,0,0,38,1,191,0,0,0,7,1,121,1,51,0,228,255,
+255,0,139,253,143,9,9,3,28,0,39,1,192,4,57,0,0,0,6,1,237,0,0,255,255,0,133,
+253,83,10,31,4,125,0,39,1,192,5,79,0,0,0,39,1,120,6,72,0,155,0,38,1,191,0,
+0,0,7,1,121,1,51,0,228,255,255,0,133,253,83,10,35,4,125,0,39,1,192,5,83,0,
+0,0,39,1,120,6,76,0,155,0,6,1,191,0,0,255,255,0,139,253,143,9,9,4,125,0,39,
+1,192,4,57,0,0,0,39,1,120,5,50,0,155,0,6,1,237,0,0,255,255,0,133,253,83,10,
+42,3,68,0,39,1,202,5,79,0,0,0,38,1,191,0,0,0,7,1,121,1,51,0,228,255,255,0,
+133,253,83,10,46,3,68,0,39,1,202,5,83,0,0,0,6,1,191,0,0,255,255,0,133,253,
+83,10,42,4,165,0,39,1,202,5,79,0,0,0,38,1,191,0,0,0,7,1,120,1,33,0,195,255,
+255,0,139,253,143,9,20,3,28,0,39,1,202,4,57,0,0,0,6,1,237,0,0,255,255,0,133,
+253,83,11,18,3,68,0,39,1,208,5,83,0,0,0,6,1,191,0,0,255,255,0,139,253,143,
+9,248,3,63,0,39,1,208,4,57,0,0,0,6,1,237,0,0,255,255,0,133,253,83,11,14,4,
+160,0,39,1,208,5,79,0,0,0,39,1,120,6,243,0,190,0,38,1,191,0,0,0,7,1,121,1,
+51,0,228,255,255,0,133,253,83,11,18,4,160,0,39,1,208,5,83,0,0,0,39,1,120,
+6,248,0,190,0,6,1,191,0,0,255,255,0,133,253,83,11,14,4,165,0,39,1,208,5,79,
+0,0,0,39,1,120,6,243,0,190,0,38,1,191,0,0,0,7,1,120,1,33,0,195,255,255,0,
+139,253,143,9,248,4,160,0,39,1,208,4,57,0,0,0,39,1,120,5,222,0,190,0,6,1,
+237,0,0,255,255,0,133,253,83,10,51,5,94,0,39,1,214,5,83,0,0,0,6,1,191,0,0,
+255,255,0,139,253,143,9,25,5,94,0,39,1,214,4,57,0,0,0,6,1,237,0,0,255,255,
+0,139,253,143,9,25,5,94,0,39,1,214,4,57,0,0,0,39,1,120,5,253,1,19,0,6,1,237,
+0,0,255,255,0,133,253,83,9,37,3,98,0,39,1,220,5,79,0,0,0,38,1,191,0,0,0,7,
+1,121,1,51,0,228,255,255,0,139,253,143,8,15,3,98,0,39,1,220,4,57,0,0,0,6,
+1,237,0,0,255,255,0,133,253,83,9,37,4,195,0,39,1,220,5,79,0,0,0,39,1,120,
+5,107,0,225,0,38,1,191,0,0,0,7,1,121,1,51,0,228,255,255,0,139,253,143,8,15,
+4,195,0,39,1,220,4,57,0,0,0,39,1,120,4,85,0,225,0,6,1,237,0,0,255,255,0,133,
+253,83,8,67,5,123,0,39,2,15,5,79,0,0,0,39,1,120,5,70,1,153,0,38,1,191,0,0,
+0,7,1,121,1,51,0,228,255,255,0,133,253,83,8,71,5,123,0,39,2,15,5,83,0,0,0,
+39,1,120,5,74,1,153,0,6,1,191,0,0,255,255,0,133,253,83,8,67,5,123,0,39,2,
+15,5,79,0,0,0,39,1,120,5,70,1,153,0,38,1,191,0,0,0,7,1,120,1,33,0,195,255,
+255,0,139,253,143,7,45,5,123,0,39,2,15,4,57,0,0,0,39,1,120,4,48,1,153,0,6,
+1,237,0,0,255,255,0,98,253,134,8,115,5,123,0,39,2,15,5,127,0,0,0,39,1,120,
+5,118,1,153,0,6,1,247,0,0,255,255,0,98,252,77,8,115,5,123,0,39,2,15,5,127,
+0,0,0,39,1,120,5,118,1,153,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,
+0,133,253,83,8,71,5,113,0,39,2,15,5,83,0,0,0,39,1,122,5,45,1,130,0,6,1,191,
+0,0,255,255,0,139,253,143,7,45,5,113,0,39,2,15,4,57,0,0,0,39,1,122,4,19,1,
+130,0,6,1,237,0,0,255,255,0,98,253,134,8,115,5,113,0,39,2,15,5,127,0,0,0,
+39,1,122,5,89,1,130,0,6,1,247,0,0,255,255,0,98,252,77,8,115,5,113,0,39,2,
+15,5,127,0,0,0,39,1,122,5,89,1,130,0,38,1,247,0,0,0,7,1,123,0,185,253,238,
+255,255,0,156,255,150,5,51,5,194,0,39,1,232,2,6,0,0,0,6,1,177,0,0,255,255,
+0,133,253,83,8,124,5,60,0,39,1,232,5,79,0,0,0,38,1,191,0,0,0,7,1,121,1,51,
+0,228,255,255,0,133,253,83,8,128,5,60,0,39,1,232,5,83,0,0,0,6,1,191,0,0,255,
+255,0,133,253,83,8,124,5,60,0,39,1,232,5,79,0,0,0,38,1,191,0,0,0,7,1,120,
+1,33,0,195,255,255,0,68,253,132,7,232,5,194,0,39,1,232,4,187,0,0,0,6,1,234,
+0,0,255,255,0,139,253,143,7,102,5,60,0,39,1,232,4,57,0,0,0,6,1,237,0,0,255,
+255,0,98,253,134,8,172,5,60,0,39,1,232,5,127,0,0,0,6,1,247,0,0,255,255,0,
+98,252,77,8,172,5,60,0,39,1,232,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,
+253,238,255,255,0,133,253,83,6,137,5,194,0,39,1,235,5,79,0,0,0,38,1,191,0,
+0,0,7,1,121,1,51,0,228,255,255,0,133,253,83,6,141,5,194,0,39,1,235,5,83,0,
+0,0,6,1,191,0,0,255,255,0,133,253,83,6,137,5,194,0,39,1,235,5,79,0,0,0,38,
+1,191,0,0,0,7,1,120,1,33,0,195,255,255,0,139,253,143,5,115,5,194,0,39,1,235,
+4,57,0,0,0,6,1,237,0,0,255,255,0,98,253,134,6,185,5,194,0,39,1,235,5,127,
+0,0,0,6,1,247,0,0,255,255,0,98,252,77,6,185,5,194,0,39,1,235,5,127,0,0,0,
+38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,133,253,83,8,148,3,68,0,39,
+1,238,5,79,0,0,0,38,1,191,0,0,0,7,1,121,1,51,0,228,255,255,0,133,253,83,8,
+152,3,68,0,39,1,238,5,83,0,0,0,6,1,191,0,0,255,255,0,133,253,83,8,148,4,165,
+0,39,1,238,5,79,0,0,0,38,1,191,0,0,0,7,1,120,1,33,0,195,255,255,0,139,253,
+143,7,126,3,28,0,39,1,238,4,57,0,0,0,6,1,237,0,0,255,255,0,98,253,134,8,196,
+3,28,0,39,1,238,5,127,0,0,0,6,1,247,0,0,255,255,0,98,252,77,8,196,3,28,0,
+39,1,238,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,133,253,
+83,7,27,4,195,0,39,2,8,5,79,0,0,0,39,1,120,4,208,0,225,0,38,1,191,0,0,0,7,
+1,121,1,51,0,228,255,255,0,133,253,83,7,31,4,195,0,39,2,8,5,83,0,0,0,39,1,
+120,4,212,0,225,0,6,1,191,0,0,255,255,0,133,253,83,7,27,4,195,0,39,2,8,5,
+79,0,0,0,39,1,120,4,208,0,225,0,38,1,191,0,0,0,7,1,120,1,33,0,195,255,255,
+0,139,253,143,6,5,4,195,0,39,2,8,4,57,0,0,0,39,1,120,3,186,0,225,0,6,1,237,
+0,0,255,255,0,98,253,134,7,75,4,195,0,39,2,8,5,127,0,0,0,39,1,120,5,0,0,225,
+0,6,1,247,0,0,255,255,0,98,252,77,7,75,4,195,0,39,2,8,5,127,0,0,0,39,1,120,
+5,0,0,225,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,133,253,83,8,246,
+3,219,0,39,1,244,5,79,0,0,0,38,1,191,0,0,0,7,1,121,1,51,0,228,255,255,0,139,
+253,143,7,224,3,219,0,39,1,244,4,57,0,0,0,6,1,237,0,0,255,255,0,98,253,134,
+9,38,3,219,0,39,1,244,5,127,0,0,0,6,1,247,0,0,255,255,0,98,252,77,9,38,3,
+219,0,39,1,244,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,
+133,253,83,7,213,3,98,0,39,2,10,5,79,0,0,0,39,1,123,5,44,255,254,0,38,1,191,
+0,0,0,7,1,121,1,51,0,228,255,255,0,133,253,83,7,217,3,98,0,39,2,10,5,83,0,
+0,0,39,1,123,5,48,255,254,0,6,1,191,0,0,255,255,0,133,253,83,7,213,4,165,
+0,39,2,10,5,79,0,0,0,39,1,123,5,44,255,254,0,38,1,191,0,0,0,7,1,120,1,33,
+0,195,255,255,0,139,253,143,6,191,3,98,0,39,2,10,4,57,0,0,0,39,1,123,4,22,
+255,254,0,6,1,237,0,0,255,255,0,98,253,134,8,5,3,98,0,39,2,10,5,127,0,0,0,
+39,1,123,5,92,255,254,0,6,1,247,0,0,255,255,0,98,252,77,8,5,3,98,0,39,2,10,
+5,127,0,0,0,39,1,123,5,92,255,254,0,38,1,247,0,0,0,7,1,123,0,185,253,238,
+255,255,0,70,255,150,3,155,5,90,2,38,0,47,0,0,0,39,1,120,0,37,0,255,0,7,0,
+112,3,79,0,0,255,255,255,186,253,250,3,70,5,90,2,38,0,49,0,0,0,7,0,112,2,
+250,0,0,255,255,0,68,253,132,4,172,4,1,2,38,0,73,0,0,0,7,0,112,1,142,254,
+167,255,255,0,98,253,134,10,95,5,94,0,39,1,214,5,127,0,0,0,6,1,247,0,0,255,
+255,0,98,252,77,10,95,5,94,0,39,1,214,5,127,0,0,0,38,1,247,0,0,0,7,1,123,
+0,185,253,238,255,255,0,98,253,134,9,85,3,98,0,39,1,220,5,127,0,0,0,6,1,247,
+0,0,255,255,0,98,252,77,9,85,3,98,0,39,1,220,5,127,0,0,0,38,1,247,0,0,0,7,
+1,123,0,185,253,238,255,255,0,98,253,134,9,85,4,195,0,39,1,220,5,127,0,0,
+0,39,1,120,5,155,0,225,0,6,1,247,0,0,255,255,0,98,252,77,9,85,4,195,0,39,
+1,220,5,127,0,0,0,39,1,120,5,155,0,225,0,38,1,247,0,0,0,7,1,123,0,185,253,
+238,255,255,0,98,253,134,10,90,2,184,0,39,1,202,5,127,0,0,0,6,1,247,0,0,255,
+255,0,98,252,77,10,90,2,184,0,39,1,202,5,127,0,0,0,38,1,247,0,0,0,7,1,123,
+0,185,253,238,255,255,0,98,253,134,10,90,4,86,0,39,1,202,5,127,0,0,0,39,1,
+124,6,117,0,84,0,6,1,247,0,0,255,255,0,98,252,77,10,90,4,86,0,39,1,202,5,
+127,0,0,0,39,1,124,6,117,0,84,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,
+255,0,98,253,134,10,79,3,28,0,39,1,192,5,127,0,0,0,6,1,247,0,0,255,255,0,
+98,252,77,10,79,3,28,0,39,1,192,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,
+253,238,255,255,0,98,253,134,10,79,3,28,0,39,1,192,5,127,0,0,0,39,1,121,6,
+153,255,243,0,6,1,247,0,0,255,255,0,98,252,77,10,79,3,28,0,39,1,192,5,127,
+0,0,0,39,1,121,6,153,255,243,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,
+0,98,253,134,10,79,4,125,0,39,1,192,5,127,0,0,0,39,1,120,6,120,0,155,0,6,
+1,247,0,0,255,255,0,98,252,77,10,79,4,125,0,39,1,192,5,127,0,0,0,39,1,120,
+6,120,0,155,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,253,134,11,
+62,3,63,0,39,1,208,5,127,0,0,0,6,1,247,0,0,255,255,0,98,252,77,11,62,3,63,
+0,39,1,208,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,
+253,134,11,62,4,160,0,39,1,208,5,127,0,0,0,39,1,120,7,35,0,190,0,6,1,247,
+0,0,255,255,0,98,252,77,11,62,4,160,0,39,1,208,5,127,0,0,0,39,1,120,7,35,
+0,190,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,133,253,83,10,42,4,
+88,0,39,1,202,5,79,0,0,0,39,1,124,6,69,0,86,0,38,1,191,0,0,0,7,1,121,1,51,
+0,228,255,255,0,133,253,83,10,46,4,88,0,39,1,202,5,83,0,0,0,39,1,124,6,73,
+0,86,0,6,1,191,0,0,255,255,0,133,253,83,10,42,4,165,0,39,1,202,5,79,0,0,0,
+39,1,124,6,69,0,86,0,38,1,191,0,0,0,7,1,120,1,33,0,195,255,255,0,139,253,
+143,9,20,4,88,0,39,1,202,4,57,0,0,0,39,1,124,5,47,0,86,0,6,1,237,0,0,255,
+255,255,186,253,250,7,250,4,85,0,39,1,202,3,31,0,0,0,39,1,124,4,21,0,83,0,
+6,1,199,0,0,255,255,255,186,253,250,7,250,3,30,0,39,1,202,3,31,0,0,0,6,1,
+199,0,0,255,255,255,186,253,250,8,222,3,63,0,39,1,208,3,31,0,0,0,6,1,199,
+0,0,255,255,255,186,253,250,8,222,4,160,0,39,1,208,3,31,0,0,0,39,1,120,4,
+195,0,190,0,6,1,199,0,0,255,255,0,157,255,150,3,69,5,194,2,38,0,39,0,0,0,
+7,0,75,1,231,0,0,255,255,255,239,255,130,5,199,3,247,0,39,2,11,3,78,0,0,0,
+39,2,7,3,194,255,18,0,6,1,239,0,0,255,255,255,239,253,250,5,133,3,247,0,39,
+2,11,3,12,0,0,0,39,2,7,3,128,255,18,0,6,1,245,0,0,255,255,255,239,254,82,
+5,199,3,28,0,39,2,11,3,78,0,0,0,39,1,121,3,53,255,243,0,6,1,239,0,0,255,255,
+255,239,253,250,5,133,3,198,0,39,2,11,3,12,0,0,0,39,1,121,2,243,255,243,0,
+6,1,245,0,0,255,255,255,239,255,130,6,83,3,141,0,39,2,12,3,78,0,0,0,39,1,
+122,3,81,255,158,0,6,1,239,0,0,255,255,255,239,253,250,6,17,3,198,0,39,2,
+12,3,12,0,0,0,39,1,122,3,15,255,158,0,6,1,245,0,0,255,255,255,239,255,130,
+6,83,3,231,0,39,2,12,3,78,0,0,0,39,1,124,3,71,255,229,0,6,1,239,0,0,255,255,
+255,239,253,250,6,17,3,231,0,39,2,12,3,12,0,0,0,39,1,124,3,5,255,229,0,6,
+1,245,0,0,255,255,255,239,255,130,8,190,3,28,0,39,1,203,3,78,0,0,0,6,1,239,
+0,0,255,255,255,239,253,250,8,124,3,198,0,39,1,203,3,12,0,0,0,6,1,245,0,0,
+255,255,255,239,255,130,8,190,4,81,0,39,1,203,3,78,0,0,0,39,1,124,4,95,0,
+79,0,6,1,239,0,0,255,255,255,239,253,250,8,124,4,85,0,39,1,203,3,12,0,0,0,
+39,1,124,4,23,0,83,0,6,1,245,0,0,255,255,255,239,255,150,5,196,5,194,0,39,
+1,233,1,245,0,0,0,6,1,236,0,0,255,255,255,239,255,130,7,29,5,60,0,39,1,233,
+3,78,0,0,0,6,1,239,0,0,255,255,255,239,255,130,5,102,5,194,0,39,1,236,3,78,
+0,0,0,6,1,239,0,0,255,255,255,239,255,130,5,199,3,151,0,39,2,11,3,78,0,0,
+0,39,1,120,2,226,255,181,0,6,1,239,0,0,255,255,255,239,253,250,5,133,3,198,
+0,39,2,11,3,12,0,0,0,39,1,120,2,160,255,181,0,6,1,245,0,0,255,255,255,239,
+254,93,6,83,3,28,0,39,2,12,3,78,0,0,0,39,1,123,3,69,255,254,0,6,1,239,0,0,
+255,255,255,239,253,250,6,17,3,198,0,39,2,12,3,12,0,0,0,39,1,123,3,3,255,
+254,0,6,1,245,0,0,255,255,255,239,254,82,10,195,3,28,0,39,1,203,5,83,0,0,
+0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,150,10,195,3,28,
+0,39,1,203,5,83,0,0,0,6,1,193,0,0,255,255,255,239,255,150,10,195,4,125,0,
+39,1,203,5,83,0,0,0,38,1,193,0,0,0,7,1,120,0,251,0,155,255,255,255,239,254,
+82,10,195,4,84,0,39,1,203,5,83,0,0,0,39,1,124,6,95,0,82,0,38,1,193,0,0,0,
+7,1,121,1,24,255,243,255,255,255,239,255,150,10,195,4,84,0,39,1,203,5,83,
+0,0,0,39,1,124,6,95,0,82,0,6,1,193,0,0,255,255,255,239,255,150,10,195,4,125,
+0,39,1,203,5,83,0,0,0,39,1,124,6,95,0,82,0,38,1,193,0,0,0,7,1,120,0,251,0,
+155,255,255,255,239,255,130,8,121,5,94,0,39,1,215,3,78,0,0,0,6,1,239,0,0,
+255,255,255,239,255,130,8,121,5,94,0,39,1,120,5,21,1,18,0,39,1,215,3,78,0,
+0,0,6,1,239,0,0,255,255,0,133,253,83,13,167,3,141,0,39,2,12,10,162,0,0,0,
+39,1,122,10,165,255,158,0,39,1,193,5,79,0,0,0,38,1,191,0,0,0,7,1,121,1,51,
+0,228,255,255,0,133,253,83,14,23,3,68,0,39,1,193,8,161,0,0,0,39,1,121,9,185,
+255,243,0,39,1,239,5,83,0,0,0,6,1,191,0,0,255,255,0,98,252,77,14,67,3,28,
+0,39,1,193,8,205,0,0,0,39,1,239,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,
+253,238,255,255,0,98,253,134,14,67,3,28,0,39,1,193,8,205,0,0,0,39,1,239,5,
+127,0,0,0,6,1,247,0,0,255,255,0,98,253,134,16,66,3,28,0,39,1,203,10,210,0,
+0,0,39,1,193,5,127,0,0,0,39,1,121,6,151,255,243,0,6,1,247,0,0,255,255,0,133,
+253,83,14,17,3,68,0,39,1,203,8,161,0,0,0,39,1,239,5,83,0,0,0,6,1,191,0,0,
+255,255,0,139,253,143,12,247,3,28,0,39,1,203,7,135,0,0,0,39,1,239,4,57,0,
+0,0,6,1,237,0,0,255,255,0,133,253,83,17,2,3,68,0,39,1,209,10,166,0,0,0,39,
+1,193,5,83,0,0,0,6,1,191,0,0,255,255,0,139,253,143,13,227,3,63,0,39,1,209,
+7,135,0,0,0,39,1,239,4,57,0,0,0,6,1,237,0,0,255,255,0,139,253,143,14,252,
+4,84,0,39,1,203,9,140,0,0,0,39,1,124,10,151,0,82,0,39,1,193,4,57,0,0,0,6,
+1,237,0,0,255,255,0,98,252,77,16,66,4,85,0,39,1,203,10,210,0,0,0,39,1,124,
+11,220,0,83,0,39,1,193,5,127,0,0,0,39,1,121,6,151,255,243,0,38,1,247,0,0,
+0,7,1,123,0,185,253,238,255,255,0,133,253,83,14,13,4,165,0,39,1,203,8,157,
+0,0,0,39,1,124,9,174,0,79,0,39,1,239,5,79,0,0,0,38,1,191,0,0,0,7,1,120,1,
+33,0,195,255,255,0,139,253,143,12,247,4,85,0,39,1,203,7,135,0,0,0,39,1,124,
+8,146,0,83,0,39,1,239,4,57,0,0,0,6,1,237,0,0,255,255,0,98,253,134,17,46,4,
+160,0,39,1,120,12,118,0,190,0,39,1,209,10,210,0,0,0,39,1,193,5,127,0,0,0,
+6,1,247,0,0,255,255,0,139,253,143,15,232,4,160,0,39,1,120,11,48,0,190,0,39,
+1,209,9,140,0,0,0,39,1,193,4,57,0,0,0,39,1,120,5,52,0,155,0,6,1,237,0,0,255,
+255,0,133,253,83,13,204,5,94,0,39,1,215,8,161,0,0,0,39,1,239,5,83,0,0,0,6,
+1,191,0,0,255,255,0,98,252,77,13,248,5,94,0,39,1,215,8,205,0,0,0,39,1,239,
+5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,139,253,143,12,
+254,3,98,0,39,1,221,9,140,0,0,0,39,1,193,4,57,0,0,0,39,1,121,5,81,255,243,
+0,6,1,237,0,0,255,255,0,139,253,143,10,249,3,98,0,39,1,221,7,135,0,0,0,39,
+1,239,4,57,0,0,0,6,1,237,0,0,255,255,0,98,253,134,12,63,3,98,0,39,1,221,8,
+205,0,0,0,39,1,239,5,127,0,0,0,6,1,247,0,0,255,255,0,139,253,143,10,249,4,
+195,0,39,1,221,7,135,0,0,0,39,1,120,7,157,0,225,0,39,1,239,4,57,0,0,0,6,1,
+237,0,0,255,255,0,98,252,77,12,63,4,195,0,39,1,221,8,205,0,0,0,39,1,120,8,
+227,0,225,0,39,1,239,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,
+255,0,98,253,134,12,63,4,195,0,39,1,221,8,205,0,0,0,39,1,120,8,227,0,225,
+0,39,1,239,5,127,0,0,0,6,1,247,0,0,255,255,0,139,253,143,12,199,4,195,0,39,
+2,13,9,140,0,0,0,39,1,120,9,138,0,225,0,39,1,193,4,57,0,0,0,39,1,120,5,52,
+0,155,0,6,1,237,0,0,255,255,0,133,253,83,11,220,4,184,0,39,2,13,8,161,0,0,
+0,39,1,122,8,129,0,201,0,39,1,239,5,83,0,0,0,6,1,191,0,0,255,255,0,139,253,
+143,10,194,4,184,0,39,2,13,7,135,0,0,0,39,1,122,7,104,0,201,0,39,1,239,4,
+57,0,0,0,6,1,237,0,0,255,255,0,139,253,143,11,164,5,194,0,39,1,236,9,140,
+0,0,0,39,1,193,4,57,0,0,0,6,1,237,0,0,255,255,0,98,252,77,12,234,5,194,0,
+39,1,236,10,210,0,0,0,39,1,193,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,
+238,255,255,0,98,253,134,12,234,5,194,0,39,1,236,10,210,0,0,0,39,1,193,5,
+127,0,0,0,6,1,247,0,0,255,255,0,133,253,83,12,186,5,194,0,39,1,236,10,162,
+0,0,0,39,1,193,5,79,0,0,0,39,1,121,6,103,255,243,0,38,1,191,0,0,0,7,1,121,
+1,51,0,228,255,255,0,139,253,143,11,164,5,194,0,39,1,236,9,140,0,0,0,39,1,
+193,4,57,0,0,0,39,1,120,5,52,0,155,0,6,1,237,0,0,255,255,0,133,253,83,10,
+185,5,194,0,39,1,236,8,161,0,0,0,39,1,239,5,83,0,0,0,6,1,191,0,0,255,255,
+0,98,252,77,14,67,3,28,0,39,1,239,10,210,0,0,0,39,1,193,5,127,0,0,0,38,1,
+247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,253,134,13,75,3,151,0,39,2,11,
+10,210,0,0,0,39,1,120,10,102,255,181,0,39,1,193,5,127,0,0,0,6,1,247,0,0,255,
+255,0,139,253,143,12,5,3,151,0,39,2,11,9,140,0,0,0,39,1,120,9,32,255,181,
+0,39,1,193,4,57,0,0,0,39,1,121,5,81,255,243,0,6,1,237,0,0,255,255,0,98,253,
+134,13,75,3,151,0,39,2,11,10,210,0,0,0,39,1,120,10,102,255,181,0,39,1,193,
+5,127,0,0,0,39,1,121,6,151,255,243,0,6,1,247,0,0,255,255,0,98,252,77,11,70,
+3,151,0,39,2,11,8,205,0,0,0,39,1,120,8,97,255,181,0,39,1,239,5,127,0,0,0,
+38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,253,134,11,70,3,151,0,39,
+2,11,8,205,0,0,0,39,1,120,8,97,255,181,0,39,1,239,5,127,0,0,0,6,1,247,0,0,
+255,255,0,139,253,143,10,140,3,28,0,39,2,12,7,135,0,0,0,39,1,123,7,126,255,
+254,0,39,1,239,4,57,0,0,0,6,1,237,0,0,255,255,0,98,252,77,13,75,4,125,0,39,
+2,11,10,210,0,0,0,39,1,121,10,185,255,243,0,39,1,193,5,127,0,0,0,39,1,120,
+6,122,0,155,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,77,13,
+215,3,141,0,39,2,12,10,210,0,0,0,39,1,122,10,213,255,158,0,39,1,193,5,127,
+0,0,0,39,1,121,6,151,255,243,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,
+0,98,253,134,13,215,3,141,0,39,2,12,10,210,0,0,0,39,1,122,10,213,255,158,
+0,39,1,193,5,127,0,0,0,39,1,121,6,151,255,243,0,6,1,247,0,0,255,255,0,98,
+252,77,13,215,4,125,0,39,2,12,10,210,0,0,0,39,1,122,10,213,255,158,0,39,1,
+193,5,127,0,0,0,39,1,120,6,122,0,155,0,38,1,247,0,0,0,7,1,123,0,185,253,238,
+255,255,0,98,253,134,13,215,4,125,0,39,2,12,10,210,0,0,0,39,1,122,10,213,
+255,158,0,39,1,193,5,127,0,0,0,39,1,120,6,122,0,155,0,6,1,247,0,0,255,255,
+0,98,252,77,11,210,3,141,0,39,2,12,8,205,0,0,0,39,1,122,8,208,255,158,0,39,
+1,239,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,253,134,
+11,210,3,141,0,39,2,12,8,205,0,0,0,39,1,122,8,208,255,158,0,39,1,239,5,127,
+0,0,0,6,1,247,0,0,255,255,0,98,252,77,14,67,3,28,0,39,1,193,8,205,0,0,0,39,
+1,121,9,229,255,243,0,39,1,239,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,
+238,255,255,0,98,253,134,16,72,3,28,0,39,1,193,10,210,0,0,0,39,1,121,11,234,
+255,243,0,39,1,193,5,127,0,0,0,6,1,247,0,0,255,255,0,98,253,134,14,67,3,28,
+0,39,1,193,8,205,0,0,0,39,1,121,9,229,255,243,0,39,1,239,5,127,0,0,0,6,1,
+247,0,0,255,255,0,98,253,134,16,66,4,125,0,39,1,203,10,210,0,0,0,39,1,193,
+5,127,0,0,0,39,1,120,6,122,0,155,0,6,1,247,0,0,255,255,0,98,252,77,17,46,
+3,63,0,39,1,209,10,210,0,0,0,39,1,193,5,127,0,0,0,38,1,247,0,0,0,7,1,123,
+0,185,253,238,255,255,0,98,252,77,16,66,4,85,0,39,1,203,10,210,0,0,0,39,1,
+124,11,221,0,83,0,39,1,193,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,
+255,255,0,98,252,77,17,46,4,160,0,39,1,120,12,118,0,190,0,39,1,209,10,210,
+0,0,0,39,1,193,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,
+98,252,77,12,234,5,194,0,39,1,236,10,210,0,0,0,39,1,193,5,127,0,0,0,39,1,
+121,6,151,255,243,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,
+77,10,229,5,194,0,39,1,236,8,205,0,0,0,39,1,239,5,127,0,0,0,38,1,247,0,0,
+0,7,1,123,0,185,253,238,255,255,0,98,252,77,13,215,3,28,0,39,2,12,10,210,
+0,0,0,39,1,123,10,201,255,254,0,39,1,193,5,127,0,0,0,38,1,247,0,0,0,7,1,123,
+0,185,253,238,255,255,0,98,252,77,13,215,3,28,0,39,2,12,10,210,0,0,0,39,1,
+123,10,201,255,254,0,39,1,193,5,127,0,0,0,39,1,121,6,151,255,243,0,38,1,247,
+0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,77,11,210,3,28,0,39,2,12,8,205,
+0,0,0,39,1,123,8,196,255,254,0,39,1,239,5,127,0,0,0,38,1,247,0,0,0,7,1,123,
+0,185,253,238,255,255,0,98,252,77,12,62,3,28,0,39,1,239,8,205,0,0,0,39,1,
+239,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,77,
+12,8,4,184,0,39,2,13,8,205,0,0,0,39,1,122,8,173,0,201,0,39,1,239,5,127,0,
+0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,77,13,75,3,151,
+0,39,2,11,10,210,0,0,0,39,1,120,10,102,255,181,0,39,1,193,5,127,0,0,0,38,
+1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,77,12,63,3,98,0,39,1,221,
+8,205,0,0,0,39,1,239,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,
+255,0,98,252,77,12,156,5,60,0,39,1,233,8,205,0,0,0,39,1,239,5,127,0,0,0,38,
+1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,77,14,67,4,125,0,39,1,
+239,10,210,0,0,0,39,1,193,5,127,0,0,0,39,1,120,6,122,0,155,0,38,1,247,0,0,
+0,7,1,123,0,185,253,238,255,255,0,139,253,143,11,86,5,60,0,39,1,233,7,135,
+0,0,0,39,1,239,4,57,0,0,0,6,1,237,0,0,255,255,0,139,253,143,11,164,5,194,
+0,39,1,236,9,140,0,0,0,39,1,193,4,57,0,0,0,39,1,121,5,81,255,243,0,6,1,237,
+0,0,255,255,0,133,253,83,13,31,3,151,0,39,2,11,10,166,0,0,0,39,1,120,10,58,
+255,181,0,39,1,193,5,83,0,0,0,39,1,121,6,107,255,243,0,6,1,191,0,0,255,255,
+0,98,252,77,16,72,3,28,0,39,1,193,10,210,0,0,0,39,1,121,11,234,255,243,0,
+39,1,193,5,127,0,0,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,
+77,16,72,3,28,0,39,1,193,10,210,0,0,0,39,1,193,5,127,0,0,0,39,1,121,6,151,
+255,243,0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,77,14,67,
+3,28,0,39,1,239,10,210,0,0,0,39,1,193,5,127,0,0,0,39,1,121,6,151,255,243,
+0,38,1,247,0,0,0,7,1,123,0,185,253,238,255,255,0,98,252,77,12,8,4,195,0,39,
+2,13,8,205,0,0,0,39,1,120,8,203,0,225,0,39,1,239,5,127,0,0,0,38,1,247,0,0,
+0,7,1,123,0,185,253,238,255,255,0,98,252,77,13,75,3,28,0,39,2,11,10,210,0,
+0,0,39,1,121,10,185,255,243,0,39,1,193,5,127,0,0,0,38,1,247,0,0,0,7,1,123,
+0,185,253,238,255,255,0,98,252,77,16,66,4,125,0,39,1,203,10,210,0,0,0,39,
+1,193,5,127,0,0,0,39,1,120,6,122,0,155,0,38,1,247,0,0,0,7,1,123,0,185,253,
+238,255,255,0,98,252,77,13,75,3,151,0,39,2,11,10,210,0,0,0,39,1,120,10,102,
+255,181,0,39,1,193,5,127,0,0,0,39,1,121,6,151,255,243,0,38,1,247,0,0,0,7,
+1,123,0,185,253,238,255,255,255,239,254,82,10,209,4,185,0,39,1,122,8,5,0,
+202,0,39,2,8,8,161,0,0,0,39,1,193,3,78,0,0,0,39,1,121,4,102,255,243,0,6,1,
+239,0,0,255,255,255,239,254,82,12,214,4,185,0,39,1,122,10,10,0,202,0,39,2,
+8,10,166,0,0,0,39,1,193,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,
+255,255,239,255,130,10,209,4,185,0,39,1,122,8,5,0,202,0,39,2,8,8,161,0,0,
+0,39,1,193,3,78,0,0,0,6,1,239,0,0,255,255,255,239,255,130,10,209,4,185,0,
+39,1,122,8,5,0,202,0,39,2,8,8,161,0,0,0,39,1,193,3,78,0,0,0,39,1,120,4,73,
+0,155,0,6,1,239,0,0,255,255,255,239,254,82,10,209,4,185,0,39,1,122,8,5,0,
+202,0,39,2,8,8,161,0,0,0,39,1,239,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,
+255,243,255,255,255,239,255,130,10,209,4,185,0,39,1,122,8,5,0,202,0,39,2,
+8,8,161,0,0,0,39,1,239,5,83,0,0,0,6,1,193,0,0,255,255,255,239,255,130,10,
+209,4,185,0,39,1,122,8,5,0,202,0,39,2,8,8,161,0,0,0,39,1,239,5,83,0,0,0,38,
+1,193,0,0,0,7,1,120,0,251,0,155,255,255,255,239,254,82,13,113,3,28,0,39,1,
+192,8,161,0,0,0,39,1,121,9,187,255,243,0,39,1,239,5,83,0,0,0,6,1,193,0,0,
+255,255,255,239,254,82,15,129,3,28,0,39,1,202,10,166,0,0,0,39,1,193,5,83,
+0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,254,82,15,129,3,
+28,0,39,1,202,10,166,0,0,0,39,1,193,5,83,0,0,0,39,1,121,6,107,255,243,0,6,
+1,193,0,0,255,255,255,239,255,130,13,124,3,28,0,39,1,202,8,161,0,0,0,39,1,
+239,5,83,0,0,0,6,1,193,0,0,255,255,255,239,254,82,13,124,3,28,0,39,1,202,
+8,161,0,0,0,39,1,239,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,
+255,239,255,130,11,119,3,28,0,39,1,202,6,156,0,0,0,39,1,239,3,78,0,0,0,6,
+1,239,0,0,255,255,255,239,255,150,16,101,3,63,0,39,1,208,10,166,0,0,0,39,
+1,193,5,83,0,0,0,6,1,193,0,0,255,255,255,239,255,130,13,124,4,84,0,39,1,202,
+8,161,0,0,0,39,1,124,9,150,0,82,0,39,1,193,3,78,0,0,0,6,1,239,0,0,255,255,
+255,239,255,130,13,124,4,125,0,39,1,202,8,161,0,0,0,39,1,124,9,150,0,83,0,
+39,1,239,5,83,0,0,0,38,1,193,0,0,0,7,1,120,0,251,0,155,255,255,255,239,255,
+130,11,119,4,89,0,39,1,202,6,156,0,0,0,39,1,124,7,146,0,87,0,39,1,239,3,78,
+0,0,0,6,1,239,0,0,255,255,255,239,255,130,14,96,4,160,0,39,1,208,8,161,0,
+0,0,39,1,120,10,69,0,190,0,39,1,193,3,78,0,0,0,39,1,120,4,73,0,155,0,6,1,
+239,0,0,255,255,255,239,255,130,13,129,5,94,0,39,1,214,8,161,0,0,0,39,1,239,
+5,83,0,0,0,6,1,193,0,0,255,255,255,239,255,130,11,124,5,94,0,39,1,214,6,156,
+0,0,0,39,1,239,3,78,0,0,0,6,1,239,0,0,255,255,255,239,255,130,10,114,3,98,
+0,39,1,220,6,156,0,0,0,39,1,239,3,78,0,0,0,6,1,239,0,0,255,255,255,239,255,
+130,11,149,5,123,0,39,2,15,8,161,0,0,0,39,1,120,8,152,1,153,0,39,1,193,3,
+78,0,0,0,39,1,120,4,73,0,155,0,6,1,239,0,0,255,255,255,239,254,82,11,224,
+5,194,0,39,1,235,10,166,0,0,0,39,1,193,5,83,0,0,0,39,1,121,6,107,255,243,
+0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,239,255,130,9,219,5,194,
+0,39,1,235,8,161,0,0,0,39,1,193,3,78,0,0,0,39,1,120,4,73,0,155,0,6,1,239,
+0,0,255,255,255,239,255,130,9,219,5,194,0,39,1,235,8,161,0,0,0,39,1,239,5,
+83,0,0,0,6,1,193,0,0,255,255,255,239,254,82,13,235,3,28,0,39,1,238,10,166,
+0,0,0,39,1,193,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,255,
+239,255,130,11,230,3,28,0,39,1,238,8,161,0,0,0,39,1,193,3,78,0,0,0,6,1,239,
+0,0,255,255,255,239,254,82,13,235,3,28,0,39,1,238,10,166,0,0,0,39,1,193,5,
+83,0,0,0,39,1,121,6,107,255,243,0,6,1,193,0,0,255,255,255,239,254,82,11,230,
+3,28,0,39,1,238,8,161,0,0,0,39,1,193,3,78,0,0,0,39,1,121,4,102,255,243,0,
+6,1,239,0,0,255,255,255,239,254,82,13,235,4,125,0,39,1,238,10,166,0,0,0,39,
+1,193,5,83,0,0,0,39,1,120,6,78,0,155,0,38,1,193,0,0,0,7,1,121,1,24,255,243,
+255,255,255,239,255,130,11,230,4,125,0,39,1,238,8,161,0,0,0,39,1,193,3,78,
+0,0,0,39,1,120,4,73,0,155,0,6,1,239,0,0,255,255,255,239,254,82,13,235,4,125,
+0,39,1,238,10,166,0,0,0,39,1,193,5,83,0,0,0,39,1,121,6,107,255,243,0,38,1,
+193,0,0,0,7,1,120,0,251,0,155,255,255,255,239,254,82,12,72,3,219,0,39,1,244,
+8,161,0,0,0,39,1,239,5,83,0,0,0,38,1,193,0,0,0,7,1,121,1,24,255,243,255,255,
+255,239,255,110,10,67,3,219,0,39,1,244,6,156,0,0,0,39,1,239,3,78,0,0,0,6,
+1,239,0,0,255,255,255,239,255,130,10,109,4,195,0,39,2,8,8,161,0,0,0,39,1,
+120,8,34,0,225,0,39,1,193,3,78,0,0,0,6,1,239,0,0,255,255,255,239,254,82,10,
+109,4,195,0,39,2,8,8,161,0,0,0,39,1,120,8,34,0,225,0,39,1,193,3,78,0,0,0,
+39,1,121,4,102,255,243,0,6,1,239,0,0,255,255,255,239,254,93,9,34,3,98,0,39,
+2,10,6,156,0,0,0,39,1,123,6,121,255,254,0,39,1,239,3,78,0,0,0,6,1,239,0,0,
+255,255,255,239,255,130,11,149,5,113,0,39,2,15,8,161,0,0,0,39,1,122,8,123,
+1,130,0,39,1,239,5,83,0,0,0,6,1,193,0,0,255,255,255,239,255,130,9,219,5,194,
+0,39,1,235,8,161,0,0,0,39,1,193,3,78,0,0,0,6,1,239,0,0,255,255,255,239,254,
+82,12,114,4,195,0,39,2,8,10,166,0,0,0,39,1,120,10,39,0,225,0,39,1,193,5,83,
+0,0,0,39,1,121,6,107,255,243,0,6,1,193,0,0,255,255,255,239,254,82,9,219,5,
+194,0,39,1,235,8,161,0,0,0,39,1,193,3,78,0,0,0,39,1,121,4,102,255,243,0,6,
+1,239,0,0,255,255,255,239,255,130,9,201,5,60,0,39,1,232,6,156,0,0,0,39,1,
+239,3,78,0,0,0,6,1,239,0,0,255,255,255,239,254,82,12,119,3,98,0,39,1,220,
+8,161,0,0,0,39,1,193,3,78,0,0,0,39,1,121,4,102,255,243,0,6,1,239,0,0,255,
+255,255,239,255,130,12,91,3,63,0,39,1,208,6,156,0,0,0,39,1,239,3,78,0,0,0,
+6,1,239,0,0,255,255,255,239,254,218,1,193,5,133,2,38,0,64,0,0,0,6,2,37,98,
+20,255,255,255,239,254,218,1,193,6,34,2,38,0,64,0,0,0,6,2,38,101,11,255,255,
+255,239,254,218,1,193,5,130,2,38,0,64,0,0,0,7,2,39,0,70,0,190,0,2,0,100,255,
+236,4,47,5,205,0,11,0,23,0,0,1,16,2,35,34,2,17,16,18,51,50,18,1,16,18,51,
+50,18,17,16,2,35,34,2,4,47,241,246,238,246,237,247,238,249,252,234,145,158,
+160,145,145,160,160,143,2,221,254,131,254,140,1,127,1,114,1,126,1,114,254,
+128,254,144,254,194,254,230,1,33,1,55,1,52,1,34,254,228,0,1,0,182,0,0,2,215,
+5,182,0,11,0,0,33,35,17,52,55,6,7,6,7,39,1,51,2,215,176,8,28,32,102,121,94,
+1,140,149,3,254,136,116,30,26,85,99,121,1,51,0,0,1,0,98,0,0,4,41,5,203,0,
+26,0,0,33,33,53,1,62,2,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,6,7,1,21,
+33,4,41,252,57,1,127,173,112,55,138,120,90,161,101,96,205,243,204,239,70,
+140,165,254,207,2,227,150,1,131,175,150,140,81,116,130,60,79,121,172,209,
+180,96,179,185,161,254,211,8,0,1,0,92,255,236,4,31,5,203,0,39,0,0,1,20,6,
+7,21,22,22,21,20,4,33,34,38,39,53,22,22,51,32,17,16,33,35,53,51,50,54,53,
+52,38,35,34,6,7,39,54,54,51,50,22,3,242,157,146,175,173,254,222,254,241,116,
+195,91,93,212,99,1,114,254,103,142,144,172,194,141,125,97,165,107,90,90,235,
+132,214,239,4,96,140,180,30,8,22,180,144,209,227,34,45,168,46,50,1,33,1,2,
+153,147,130,105,118,53,70,123,71,81,195,0,2,0,43,0,0,4,106,5,190,0,10,0,19,
+0,0,1,35,17,35,17,33,53,1,51,17,51,33,17,52,55,35,6,6,7,1,4,106,212,175,253,
+68,2,176,187,212,254,125,11,9,11,55,22,254,74,1,76,254,180,1,76,153,3,217,
+252,48,1,204,137,187,26,104,30,253,144,0,0,1,0,129,255,236,4,31,5,182,0,26,
+0,0,1,50,4,21,20,0,33,34,39,53,22,22,51,50,54,53,16,33,34,7,39,19,33,21,33,
+3,54,2,51,229,1,7,254,222,254,255,245,134,74,208,99,172,188,254,146,118,132,
+90,55,2,221,253,189,35,115,3,129,230,200,228,254,253,79,170,44,52,164,152,
+1,40,30,57,2,178,164,254,88,23,0,2,0,113,255,236,4,51,5,203,0,22,0,36,0,0,
+19,16,33,50,23,21,38,35,34,2,3,51,54,51,50,22,21,20,2,35,34,38,2,1,50,54,
+53,52,38,35,34,6,6,21,20,22,22,113,2,157,116,65,76,101,233,247,13,12,110,
+236,198,226,250,215,150,225,122,1,239,139,150,146,137,87,145,87,80,142,2,
+113,3,90,19,153,24,254,228,254,204,172,240,204,227,254,248,152,1,37,254,218,
+178,162,146,157,72,128,68,100,175,100,0,1,0,90,0,0,4,47,5,182,0,6,0,0,33,
+1,33,53,33,21,1,1,23,2,88,252,235,3,213,253,174,5,18,164,139,250,213,0,0,
+3,0,100,255,236,4,45,5,203,0,22,0,34,0,47,0,0,1,50,22,21,20,6,7,22,22,21,
+20,4,35,34,36,53,52,37,38,38,53,52,54,3,20,22,51,50,54,53,52,38,39,6,6,1,
+34,6,21,20,22,22,23,54,54,53,52,38,2,72,200,238,133,146,177,149,254,254,221,
+234,255,0,1,47,136,120,239,110,165,145,143,164,156,184,145,132,1,50,118,140,
+54,102,112,137,115,142,5,203,186,164,110,174,75,86,187,122,182,217,204,189,
+250,141,78,180,113,159,189,251,168,116,132,135,119,96,150,67,62,152,3,93,
+112,99,63,96,76,47,57,136,89,100,111,0,0,2,0,102,255,236,4,41,5,203,0,23,
+0,37,0,0,1,16,33,34,39,53,22,51,50,54,54,55,35,6,35,34,38,53,52,18,51,50,
+22,18,1,34,6,21,20,22,51,50,54,54,53,52,38,38,4,41,253,96,116,68,77,103,163,
+212,111,8,13,112,236,193,227,254,213,150,225,121,254,16,136,152,143,137,90,
+148,84,79,142,3,70,252,166,20,154,27,131,251,208,170,235,207,226,1,12,153,
+254,219,1,38,178,162,146,155,73,124,69,100,174,101,0,3,0,28,254,236,1,231,
+2,161,0,11,0,21,0,22,0,0,19,20,22,51,50,54,53,52,38,35,34,6,5,16,35,34,38,
+53,16,51,50,22,3,135,57,64,65,59,59,65,64,57,1,96,231,113,115,228,115,116,
+231,1,53,131,130,129,134,132,129,129,132,254,146,189,177,1,106,185,253,4,
+0,2,0,55,254,236,1,98,2,148,0,10,0,11,0,0,19,51,17,35,17,52,55,6,6,7,39,19,
+246,108,105,6,22,34,93,51,194,2,148,253,67,1,196,53,92,22,30,75,80,252,239,
+0,0,2,0,35,254,236,1,197,2,163,0,24,0,25,0,0,5,33,53,55,54,54,53,52,38,35,
+34,6,7,39,54,51,50,22,21,20,14,2,7,33,3,1,195,254,96,170,92,51,54,45,45,72,
+38,52,96,113,95,107,18,38,59,175,1,32,208,41,88,184,98,91,55,52,53,39,32,
+75,91,105,89,37,63,65,73,183,254,176,0,2,0,25,254,236,1,217,2,163,0,33,0,
+34,0,0,1,20,7,22,21,20,6,35,34,39,53,22,51,50,53,52,35,35,53,51,50,54,53,
+52,38,35,34,7,39,54,54,51,50,22,3,1,198,109,128,132,123,109,84,102,93,147,
+162,84,84,74,69,56,47,75,89,53,53,104,58,98,113,209,1,238,121,45,36,132,101,
+114,47,103,56,125,112,91,62,52,47,53,62,75,44,37,97,252,170,0,0,3,0,14,254,
+236,1,247,2,152,0,10,0,17,0,18,0,0,37,35,21,35,53,33,53,1,51,17,51,35,53,
+52,55,6,7,7,19,1,247,90,111,254,224,1,35,108,90,201,5,6,65,118,156,116,157,
+157,85,1,207,254,62,153,85,80,14,112,192,254,22,0,0,2,0,44,254,235,1,216,
+2,148,0,30,0,31,0,0,19,50,22,21,20,6,35,34,38,39,53,22,22,51,50,54,53,52,
+38,35,34,6,7,38,39,19,33,21,33,7,54,19,240,105,127,124,121,53,101,29,40,101,
+39,66,79,78,71,39,54,23,20,25,24,1,102,254,239,13,47,45,1,145,118,99,114,
+126,24,19,109,27,30,65,71,63,68,14,6,19,14,1,85,90,179,10,253,90,0,3,0,30,
+254,236,1,234,2,161,0,22,0,34,0,35,0,0,19,16,33,50,23,21,38,35,34,6,7,51,
+54,54,51,50,22,21,20,6,35,34,38,23,50,54,53,52,38,35,34,6,21,20,22,19,30,
+1,62,53,35,39,55,101,106,8,5,21,80,61,88,108,121,102,111,126,234,56,70,62,
+59,57,81,76,60,1,4,1,157,12,97,16,120,131,35,47,118,101,114,133,169,75,73,
+76,62,70,68,48,72,93,254,197,0,2,0,41,254,236,1,221,2,148,0,6,0,7,0,0,23,
+19,33,53,33,21,3,23,117,250,254,186,1,180,252,30,41,2,90,99,80,253,147,235,
+0,4,0,37,254,236,1,224,2,161,0,21,0,34,0,45,0,46,0,0,1,50,22,21,20,7,22,21,
+20,6,35,34,38,53,52,54,55,38,38,53,52,54,3,20,22,51,50,54,53,52,38,39,39,
+6,6,19,34,6,21,20,23,54,54,53,52,38,3,1,3,91,109,107,128,122,99,107,115,53,
+60,51,43,115,34,58,61,63,58,65,57,19,49,50,121,48,52,103,43,55,54,46,2,161,
+94,83,104,61,59,125,91,111,105,92,55,92,36,35,75,56,82,100,253,237,47,58,
+58,47,48,62,21,8,25,67,1,138,47,44,72,45,18,55,44,44,47,252,165,0,0,3,0,25,
+254,236,1,229,2,163,0,21,0,33,0,34,0,0,1,20,6,35,34,39,53,22,51,50,55,35,
+6,35,34,38,53,52,54,51,50,22,39,34,6,21,20,22,51,50,54,53,52,38,3,1,229,160,
+154,57,36,32,67,197,16,8,52,102,94,109,124,99,110,127,237,56,67,59,61,60,
+78,73,59,1,108,215,204,12,99,17,254,81,118,104,108,133,164,70,77,65,63,73,
+69,45,77,87,252,167,0,3,1,101,253,169,1,248,255,248,0,13,0,14,0,15,0,0,5,
+22,22,21,20,6,7,39,52,39,38,53,52,54,19,19,1,207,24,17,32,44,17,45,9,60,11,
+35,38,103,127,70,78,111,52,5,193,161,30,23,45,68,253,223,2,79,0,2,0,147,255,
+227,1,145,5,182,0,3,0,15,0,0,1,35,3,51,3,52,54,51,50,22,21,20,6,35,34,38,
+1,78,117,51,219,238,65,62,62,65,67,60,61,66,1,156,4,26,250,185,66,71,73,64,
+64,76,74,0,0,1,0,147,255,227,1,145,0,248,0,11,0,0,55,52,54,51,50,22,21,20,
+6,35,34,38,147,65,60,61,68,68,61,59,66,111,66,71,71,66,65,75,74,0,0,1,0,84,
+254,248,1,137,0,238,0,6,0,0,37,23,6,3,35,54,55,1,123,14,55,121,133,65,37,
+238,23,214,254,247,250,252,0,2,0,120,0,186,3,20,3,70,0,10,0,21,0,0,37,6,35,
+34,39,3,19,23,3,23,22,5,6,35,34,39,3,19,23,3,23,22,3,20,45,54,41,24,181,244,
+66,180,98,56,254,249,45,54,41,24,180,243,66,180,99,71,238,52,29,1,12,1,99,
+64,254,235,120,71,68,52,29,1,12,1,99,64,254,235,120,89,0,2,0,60,0,164,2,216,
+3,49,0,11,0,22,0,0,19,54,51,22,31,2,3,39,19,39,38,55,54,51,22,23,19,3,39,
+19,39,38,60,46,53,42,23,69,111,243,66,180,49,90,247,46,53,43,23,180,243,67,
+181,99,56,2,253,52,1,29,100,167,254,156,65,1,21,60,112,87,52,1,29,254,245,
+254,156,65,1,21,121,70,0,2,0,129,0,186,3,19,3,70,0,14,0,29,0,0,37,6,6,35,
+34,38,53,52,54,55,23,6,21,20,22,5,6,6,35,34,38,53,52,54,55,23,6,21,20,22,
+1,208,15,55,26,98,141,133,101,66,172,112,1,162,15,55,26,98,141,133,101,66,
+172,112,238,23,29,174,114,94,200,70,64,128,143,83,143,39,23,29,174,114,94,
+200,70,64,128,143,83,143,0,2,0,60,0,165,2,206,3,49,0,14,0,29,0,0,1,54,54,
+51,50,22,21,20,6,7,39,54,53,52,38,37,54,54,51,50,22,21,20,6,7,39,54,53,52,
+38,1,127,15,55,26,98,141,128,106,66,172,112,254,94,15,55,26,98,141,128,106,
+66,172,112,2,253,23,29,174,114,92,197,75,64,128,143,83,143,39,23,29,174,114,
+92,197,75,64,128,143,83,143,0,0,3,0,60,253,171,1,167,255,44,0,21,0,22,0,23,
+0,0,5,22,22,21,20,14,2,7,6,7,38,38,39,55,55,50,22,22,23,54,54,3,3,1,123,17,
+27,15,27,38,22,38,62,36,74,51,32,31,31,45,59,27,11,62,76,27,242,2,29,27,13,
+29,52,83,67,23,10,78,148,69,8,5,40,103,65,58,151,254,183,1,129,0,0,3,0,60,
+253,171,1,167,255,45,0,21,0,22,0,23,0,0,19,38,38,53,52,62,2,55,54,55,22,23,
+6,6,35,34,39,38,39,6,6,23,3,104,17,27,15,27,38,23,41,59,85,75,14,32,16,40,
+25,49,49,9,60,114,53,253,191,2,29,28,12,29,52,84,66,25,9,189,106,3,10,31,
+56,122,56,146,55,1,130,0,0,1,0,140,0,0,2,230,2,62,0,24,0,0,33,34,36,53,52,
+54,55,51,14,3,21,20,30,2,51,51,50,22,21,21,20,35,2,128,241,254,253,20,8,73,
+2,3,1,1,33,96,176,144,42,11,6,17,174,175,84,113,28,8,29,30,27,7,66,116,85,
+50,10,7,122,17,0,1,0,82,0,0,2,66,0,160,0,3,0,0,51,53,33,21,82,1,240,160,160,
+0,0,1,0,82,0,0,2,66,0,160,0,3,0,0,51,53,33,21,82,1,240,160,160,0,0,1,0,156,
+254,248,1,209,0,238,0,9,0,0,37,22,22,23,23,35,38,38,39,55,1,106,13,39,22,
+29,133,62,88,26,14,238,84,205,90,123,137,238,104,23,0,2,0,152,254,248,1,229,
+4,102,0,9,0,21,0,0,37,22,22,23,23,35,38,2,39,55,18,38,53,52,54,51,50,22,21,
+20,6,35,1,125,14,33,29,28,135,49,98,29,14,39,75,75,54,53,72,72,53,238,91,
+167,121,123,110,1,4,109,23,2,98,65,74,76,63,63,76,74,65,0,255,255,0,105,253,
+250,12,10,5,194,0,39,1,236,4,86,0,0,0,39,1,208,6,75,0,0,0,6,1,118,0,0,255,
+255,0,105,253,250,9,63,5,194,0,39,1,236,4,86,0,0,0,38,1,118,0,0,0,39,2,15,
+6,75,0,0,0,7,1,122,6,37,1,130,255,255,255,186,253,250,9,211,5,194,0,39,0,
+39,8,102,0,0,0,39,1,232,5,120,0,0,0,38,1,199,0,0,0,39,2,11,3,52,0,0,0,7,1,
+121,3,27,255,243,255,255,0,40,255,130,15,117,5,184,0,39,1,238,12,48,0,0,0,
+39,1,239,3,172,0,0,0,38,1,197,226,0,0,39,1,193,7,18,0,0,0,39,0,79,12,68,0,
+23,0,39,0,81,4,135,0,57,0,39,0,78,7,211,0,105,0,7,0,78,4,79,1,29,255,255,
+0,109,253,143,15,52,5,194,0,39,1,236,7,128,0,0,0,39,1,208,9,117,0,0,0,39,
+1,221,4,36,0,0,0,6,1,237,226,0,255,255,0,68,253,132,14,214,5,194,0,39,0,49,
+12,68,0,0,0,39,1,202,7,248,0,0,0,39,1,246,4,76,0,0,0,6,0,68,0,0,255,255,0,
+139,254,93,12,90,5,194,0,39,1,220,8,132,0,0,0,39,1,236,6,144,0,0,0,39,2,12,
+3,162,0,0,0,39,1,123,3,154,255,254,0,6,1,243,0,0,255,255,0,139,253,143,14,
+21,5,194,0,39,1,202,6,74,0,0,0,39,0,72,10,190,0,0,0,39,1,236,4,76,0,0,0,6,
+1,237,0,0,255,255,0,98,253,134,13,4,5,194,0,39,1,236,5,80,0,0,0,39,1,208,
+7,69,0,0,0,6,1,247,0,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,
+1,4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,128,0,3,0,1,4,9,0,3,0,72,0,142,
+0,3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,0,30,0,214,0,3,0,1,4,9,0,6,0,30,
+0,244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,9,0,8,0,42,1,86,0,3,0,1,4,9,0,9,
+0,40,1,128,0,3,0,1,4,9,0,10,0,96,1,168,0,3,0,1,4,9,0,11,0,62,2,8,0,3,0,1,
+4,9,0,12,0,60,2,70,0,3,0,1,4,9,0,13,2,150,2,130,0,3,0,1,4,9,0,14,0,52,5,24,
+0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,
+0,52,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,
+0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,78,
+0,97,0,115,0,107,0,104,0,32,0,65,0,114,0,97,0,98,0,105,0,99,0,82,0,101,0,
+103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,
+116,0,111,0,32,0,78,0,97,0,115,0,107,0,104,0,32,0,65,0,114,0,97,0,98,0,105,
+0,99,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,54,0,
+32,0,117,0,104,0,78,0,111,0,116,0,111,0,78,0,97,0,115,0,107,0,104,0,65,0,
+114,0,97,0,98,0,105,0,99,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,
+0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,
+0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,
+111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,
+0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,
+0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,
+0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,
+0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,
+0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,
+112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,
+110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,253,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,
+11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,
+1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,
+1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,
+1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,
+1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,
+1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,
+1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,
+113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,
+1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,
+138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,
+1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,
+163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,
+1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,
+188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,
+1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,
+213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,
+1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,
+238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,
+1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,
+2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,
+2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,
+2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,
+2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,
+2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,
+2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,
+2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,
+113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,
+2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,
+138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,
+2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,
+163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,
+2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,
+188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,
+2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,
+213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,
+2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,
+238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,
+2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,
+3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,
+3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,
+3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,
+3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,
+3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,
+3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,
+3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,3,111,3,112,3,
+113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,
+3,126,3,127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,
+138,3,139,3,140,3,141,3,142,3,143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,
+3,151,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,3,162,3,
+163,3,164,3,165,3,166,3,167,3,168,3,169,3,170,3,171,3,172,3,173,3,174,3,175,
+3,176,3,177,3,178,3,179,3,180,3,181,3,182,3,183,3,184,3,185,3,186,3,187,3,
+188,3,189,3,190,3,191,3,192,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,200,
+3,201,3,202,3,203,3,204,3,205,3,206,3,207,3,208,3,209,3,210,3,211,3,212,3,
+213,3,214,3,215,3,216,3,217,3,218,3,219,3,220,3,221,3,222,3,223,3,224,3,225,
+3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,
+238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,
+3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,
+4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,19,4,20,4,21,4,22,4,23,4,24,4,25,
+4,26,4,27,4,28,4,29,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,
+4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,
+4,56,4,57,4,58,4,59,4,60,4,61,4,62,4,63,4,64,4,65,4,66,4,67,4,68,4,69,4,70,
+4,71,4,72,4,73,4,74,4,75,4,76,4,77,4,78,4,79,4,80,4,81,4,82,4,83,4,84,4,85,
+4,86,4,87,4,88,4,89,4,90,4,91,4,92,4,93,4,94,4,95,4,96,4,97,4,98,4,99,4,100,
+4,101,4,102,4,103,4,104,4,105,4,106,4,107,4,108,4,109,4,110,4,111,4,112,4,
+113,4,114,4,115,4,116,4,117,4,118,4,119,4,120,4,121,4,122,4,123,4,124,4,125,
+4,126,4,127,4,128,4,129,4,130,4,131,4,132,4,133,4,134,4,135,4,136,4,137,4,
+138,4,139,4,140,4,141,4,142,4,143,4,144,4,145,4,146,4,147,4,148,4,149,4,150,
+4,151,4,152,4,153,4,154,4,155,4,156,4,157,4,158,4,159,4,160,4,161,4,162,4,
+163,4,164,4,165,4,166,4,167,4,168,4,169,4,170,4,171,4,172,4,173,4,174,4,175,
+4,176,4,177,4,178,4,179,4,180,4,181,4,182,4,183,4,184,4,185,4,186,4,187,4,
+188,4,189,4,190,4,191,4,192,4,193,4,194,4,195,4,196,4,197,4,198,4,199,4,200,
+4,201,4,202,4,203,4,204,4,205,4,206,4,207,4,208,4,209,4,210,4,211,4,212,4,
+213,4,214,4,215,4,216,4,217,4,218,4,219,4,220,4,221,4,222,4,223,4,224,4,225,
+4,226,4,227,4,228,4,229,4,230,4,231,4,232,4,233,4,234,4,235,4,236,4,237,4,
+238,4,239,4,240,4,241,4,242,4,243,4,244,4,245,4,246,4,247,4,248,4,249,4,250,
+4,251,4,252,4,253,4,254,4,255,5,0,5,1,5,2,5,3,5,4,5,5,5,6,5,7,5,8,5,9,5,10,
+5,11,5,12,5,13,5,14,5,15,5,16,5,17,5,18,5,19,5,20,5,21,5,22,5,23,5,24,5,25,
+5,26,5,27,5,28,5,29,5,30,5,31,5,32,5,33,5,34,5,35,5,36,5,37,5,38,5,39,5,40,
+5,41,5,42,5,43,5,44,5,45,5,46,5,47,5,48,5,49,5,50,5,51,5,52,5,53,5,54,5,55,
+5,56,5,57,5,58,5,59,5,60,5,61,5,62,5,63,5,64,5,65,5,66,5,67,5,68,5,69,5,70,
+5,71,5,72,5,73,5,74,5,75,5,76,5,77,5,78,5,79,5,80,5,81,5,82,5,83,5,84,5,85,
+5,86,5,87,5,88,5,89,5,90,5,91,5,92,5,93,5,94,5,95,5,96,5,97,5,98,5,99,5,100,
+5,101,5,102,5,103,5,104,5,105,5,106,5,107,5,108,5,109,5,110,5,111,5,112,5,
+113,5,114,5,115,5,116,5,117,5,118,5,119,5,120,5,121,5,122,5,123,5,124,5,125,
+5,126,5,127,5,128,5,129,5,130,5,131,5,132,5,133,5,134,5,135,5,136,5,137,5,
+138,5,139,5,140,5,141,5,142,5,143,5,144,5,145,5,146,5,147,5,148,5,149,5,150,
+5,151,5,152,5,153,5,154,5,155,5,156,5,157,5,158,5,159,5,160,5,161,5,162,5,
+163,5,164,5,165,5,166,5,167,5,168,5,169,5,170,5,171,5,172,5,173,5,174,5,175,
+5,176,5,177,5,178,5,179,5,180,5,181,5,182,5,183,5,184,5,185,5,186,5,187,5,
+188,5,189,5,190,5,191,5,192,5,193,5,194,5,195,5,196,5,197,5,198,5,199,5,200,
+5,201,5,202,5,203,5,204,5,205,5,206,5,207,5,208,5,209,5,210,5,211,5,212,5,
+213,5,214,5,215,5,216,5,217,5,218,5,219,5,220,5,221,5,222,5,223,5,224,5,225,
+5,226,5,227,5,228,5,229,5,230,5,231,5,232,5,233,5,234,5,235,5,236,5,237,5,
+238,5,239,5,240,5,241,5,242,5,243,5,244,5,245,5,246,5,247,5,248,5,249,5,250,
+5,251,5,252,5,253,5,254,5,255,6,0,6,1,6,2,6,3,6,4,6,5,6,6,6,7,6,8,6,9,6,10,
+6,11,6,12,6,13,6,14,6,15,6,16,6,17,6,18,6,19,6,20,6,21,6,22,6,23,6,24,6,25,
+6,26,6,27,6,28,6,29,6,30,6,31,6,32,6,33,6,34,6,35,6,36,6,37,6,38,6,39,6,40,
+6,41,6,42,6,43,6,44,6,45,6,46,6,47,6,48,6,49,6,50,6,51,6,52,6,53,6,54,6,55,
+6,56,6,57,6,58,6,59,6,60,6,61,6,62,6,63,6,64,6,65,6,66,6,67,6,68,6,69,6,70,
+6,71,6,72,6,73,6,74,6,75,6,76,6,77,6,78,6,79,6,80,6,81,6,82,6,83,6,84,6,85,
+6,86,6,87,6,88,6,89,6,90,6,91,6,92,6,93,6,94,6,95,6,96,6,97,6,98,6,99,6,100,
+6,101,6,102,6,103,6,104,6,105,6,106,6,107,6,108,6,109,6,110,6,111,6,112,6,
+113,6,114,6,115,6,116,6,117,6,118,6,119,6,120,6,121,6,122,6,123,6,124,6,125,
+6,126,6,127,6,128,6,129,6,130,6,131,6,132,6,133,6,134,6,135,6,136,6,137,6,
+138,6,139,6,140,6,141,6,142,6,143,6,144,6,145,6,146,6,147,6,148,6,149,6,150,
+6,151,6,152,6,153,6,154,6,155,6,156,6,157,6,158,6,159,6,160,6,161,6,162,6,
+163,6,164,6,165,6,166,6,167,6,168,6,169,6,170,6,171,6,172,6,173,6,174,6,175,
+6,176,6,177,6,178,6,179,6,180,6,181,6,182,6,183,6,184,6,185,6,186,6,187,6,
+188,6,189,6,190,6,191,6,192,6,193,6,194,6,195,6,196,6,197,6,198,6,199,6,200,
+6,201,6,202,6,203,6,204,6,205,6,206,6,207,6,208,6,209,6,210,6,211,6,212,6,
+213,6,214,6,215,6,216,6,217,6,218,6,219,6,220,6,221,6,222,6,223,6,224,6,225,
+6,226,6,227,6,228,6,229,6,230,6,231,6,232,6,233,6,234,6,235,6,236,6,237,6,
+238,6,239,6,240,6,241,6,242,6,243,6,244,6,245,6,246,6,247,6,248,6,249,6,250,
+6,251,4,110,117,108,108,10,117,110,105,48,48,50,49,46,97,114,10,117,110,105,
+48,48,50,69,46,97,114,10,117,110,105,48,48,51,65,46,97,114,7,117,110,105,
+48,54,48,49,7,117,110,105,48,54,48,54,7,117,110,105,48,54,48,55,7,117,110,
+105,48,54,48,56,7,117,110,105,48,54,48,57,7,117,110,105,48,54,48,65,7,117,
+110,105,48,54,48,66,7,117,110,105,48,54,48,67,7,117,110,105,48,54,48,68,7,
+117,110,105,48,54,48,69,7,117,110,105,48,54,48,70,7,117,110,105,48,54,49,
+48,7,117,110,105,48,54,49,49,7,117,110,105,48,54,49,50,7,117,110,105,48,54,
+49,51,7,117,110,105,48,54,49,52,7,117,110,105,48,54,49,53,7,117,110,105,48,
+54,49,54,7,117,110,105,48,54,49,55,7,117,110,105,48,54,49,56,7,117,110,105,
+48,54,49,57,7,117,110,105,48,54,49,65,7,117,110,105,48,54,49,66,7,117,110,
+105,48,54,49,69,7,117,110,105,48,54,49,70,7,117,110,105,48,54,50,48,7,117,
+110,105,48,54,50,49,7,117,110,105,48,54,50,50,7,117,110,105,48,54,50,51,7,
+117,110,105,48,54,50,52,7,117,110,105,48,54,50,53,7,117,110,105,48,54,50,
+54,7,117,110,105,48,54,50,55,7,117,110,105,48,54,50,56,7,117,110,105,48,54,
+50,57,7,117,110,105,48,54,50,65,7,117,110,105,48,54,50,66,7,117,110,105,48,
+54,50,67,7,117,110,105,48,54,50,68,7,117,110,105,48,54,50,69,7,117,110,105,
+48,54,50,70,7,117,110,105,48,54,51,48,7,117,110,105,48,54,51,49,7,117,110,
+105,48,54,51,50,7,117,110,105,48,54,51,51,7,117,110,105,48,54,51,52,7,117,
+110,105,48,54,51,53,7,117,110,105,48,54,51,54,7,117,110,105,48,54,51,55,7,
+117,110,105,48,54,51,56,7,117,110,105,48,54,51,57,7,117,110,105,48,54,51,
+65,7,117,110,105,48,54,51,66,7,117,110,105,48,54,51,67,7,117,110,105,48,54,
+51,68,7,117,110,105,48,54,51,69,7,117,110,105,48,54,51,70,7,84,97,116,119,
+101,101,108,7,117,110,105,48,54,52,49,7,117,110,105,48,54,52,50,7,117,110,
+105,48,54,52,51,7,117,110,105,48,54,52,52,7,117,110,105,48,54,52,53,7,117,
+110,105,48,54,52,54,7,117,110,105,48,54,52,55,7,117,110,105,48,54,52,56,7,
+117,110,105,48,54,52,57,7,117,110,105,48,54,52,65,7,117,110,105,48,54,52,
+66,7,117,110,105,48,54,52,67,7,117,110,105,48,54,52,68,7,117,110,105,48,54,
+52,69,7,117,110,105,48,54,52,70,7,117,110,105,48,54,53,48,7,117,110,105,48,
+54,53,49,10,114,105,110,103,65,114,97,98,105,99,7,117,110,105,48,54,53,51,
+7,117,110,105,48,54,53,52,7,117,110,105,48,54,53,53,7,117,110,105,48,54,53,
+54,7,117,110,105,48,54,53,55,7,117,110,105,48,54,53,56,7,117,110,105,48,54,
+53,57,7,117,110,105,48,54,53,65,7,117,110,105,48,54,53,66,7,117,110,105,48,
+54,53,67,7,117,110,105,48,54,53,68,7,117,110,105,48,54,53,69,15,119,97,118,
+121,104,97,109,122,97,95,98,101,108,111,119,7,117,110,105,48,54,54,48,7,117,
+110,105,48,54,54,49,7,117,110,105,48,54,54,50,7,117,110,105,48,54,54,51,7,
+117,110,105,48,54,54,52,7,117,110,105,48,54,54,53,7,117,110,105,48,54,54,
+54,7,117,110,105,48,54,54,55,7,117,110,105,48,54,54,56,7,117,110,105,48,54,
+54,57,7,117,110,105,48,54,54,65,7,117,110,105,48,54,54,66,7,117,110,105,48,
+54,54,67,7,117,110,105,48,54,54,68,7,117,110,105,48,54,54,69,7,117,110,105,
+48,54,54,70,7,117,110,105,48,54,55,48,7,117,110,105,48,54,55,49,7,117,110,
+105,48,54,55,50,7,117,110,105,48,54,55,51,7,117,110,105,48,54,55,52,7,117,
+110,105,48,54,55,53,7,117,110,105,48,54,55,54,7,117,110,105,48,54,55,55,7,
+117,110,105,48,54,55,56,7,117,110,105,48,54,55,57,7,117,110,105,48,54,55,
+65,7,117,110,105,48,54,55,66,7,117,110,105,48,54,55,67,7,117,110,105,48,54,
+55,68,7,117,110,105,48,54,55,69,7,117,110,105,48,54,55,70,7,117,110,105,48,
+54,56,48,7,117,110,105,48,54,56,49,7,117,110,105,48,54,56,50,7,117,110,105,
+48,54,56,51,7,117,110,105,48,54,56,52,7,117,110,105,48,54,56,53,7,117,110,
+105,48,54,56,54,7,117,110,105,48,54,56,55,7,117,110,105,48,54,56,56,7,117,
+110,105,48,54,56,57,7,117,110,105,48,54,56,65,7,117,110,105,48,54,56,66,7,
+117,110,105,48,54,56,67,7,117,110,105,48,54,56,68,7,117,110,105,48,54,56,
+69,7,117,110,105,48,54,56,70,7,117,110,105,48,54,57,48,7,117,110,105,48,54,
+57,49,7,117,110,105,48,54,57,50,7,117,110,105,48,54,57,51,7,117,110,105,48,
+54,57,52,7,117,110,105,48,54,57,53,7,117,110,105,48,54,57,54,7,117,110,105,
+48,54,57,55,7,117,110,105,48,54,57,56,7,117,110,105,48,54,57,57,7,117,110,
+105,48,54,57,65,7,117,110,105,48,54,57,66,7,117,110,105,48,54,57,67,7,117,
+110,105,48,54,57,68,7,117,110,105,48,54,57,69,7,117,110,105,48,54,57,70,7,
+117,110,105,48,54,65,48,7,117,110,105,48,54,65,49,7,117,110,105,48,54,65,
+50,7,117,110,105,48,54,65,51,7,117,110,105,48,54,65,52,7,117,110,105,48,54,
+65,53,7,117,110,105,48,54,65,54,7,117,110,105,48,54,65,55,7,117,110,105,48,
+54,65,56,7,117,110,105,48,54,65,57,7,117,110,105,48,54,65,65,7,117,110,105,
+48,54,65,66,7,117,110,105,48,54,65,67,7,117,110,105,48,54,65,68,7,117,110,
+105,48,54,65,69,7,117,110,105,48,54,65,70,7,117,110,105,48,54,66,48,7,117,
+110,105,48,54,66,49,7,117,110,105,48,54,66,50,7,117,110,105,48,54,66,51,7,
+117,110,105,48,54,66,52,7,117,110,105,48,54,66,53,7,117,110,105,48,54,66,
+54,7,117,110,105,48,54,66,55,7,117,110,105,48,54,66,56,7,117,110,105,48,54,
+66,57,7,117,110,105,48,54,66,65,7,117,110,105,48,54,66,66,7,117,110,105,48,
+54,66,67,7,117,110,105,48,54,66,68,7,117,110,105,48,54,66,69,7,117,110,105,
+48,54,66,70,7,117,110,105,48,54,67,48,7,117,110,105,48,54,67,49,7,117,110,
+105,48,54,67,50,7,117,110,105,48,54,67,51,7,117,110,105,48,54,67,52,7,117,
+110,105,48,54,67,53,7,117,110,105,48,54,67,54,7,117,110,105,48,54,67,55,7,
+117,110,105,48,54,67,56,7,117,110,105,48,54,67,57,7,117,110,105,48,54,67,
+65,7,117,110,105,48,54,67,66,7,117,110,105,48,54,67,67,7,117,110,105,48,54,
+67,68,7,117,110,105,48,54,67,69,7,117,110,105,48,54,67,70,7,117,110,105,48,
+54,68,48,7,117,110,105,48,54,68,49,7,117,110,105,48,54,68,50,7,117,110,105,
+48,54,68,51,7,117,110,105,48,54,68,52,7,117,110,105,48,54,68,53,7,117,110,
+105,48,54,68,54,7,117,110,105,48,54,68,55,7,117,110,105,48,54,68,56,7,117,
+110,105,48,54,68,57,7,117,110,105,48,54,68,65,7,117,110,105,48,54,68,66,7,
+117,110,105,48,54,68,67,7,117,110,105,48,54,68,68,7,117,110,105,48,54,68,
+69,7,117,110,105,48,54,68,70,7,117,110,105,48,54,69,48,7,117,110,105,48,54,
+69,49,7,117,110,105,48,54,69,50,7,117,110,105,48,54,69,51,7,117,110,105,48,
+54,69,52,7,117,110,105,48,54,69,53,7,117,110,105,48,54,69,54,7,117,110,105,
+48,54,69,55,7,117,110,105,48,54,69,56,7,117,110,105,48,54,69,57,7,117,110,
+105,48,54,69,65,7,117,110,105,48,54,69,66,7,117,110,105,48,54,69,67,7,117,
+110,105,48,54,69,68,7,117,110,105,48,54,69,69,7,117,110,105,48,54,69,70,7,
+117,110,105,48,54,70,48,7,117,110,105,48,54,70,49,7,117,110,105,48,54,70,
+50,7,117,110,105,48,54,70,51,7,117,110,105,48,54,70,52,7,117,110,105,48,54,
+70,53,7,117,110,105,48,54,70,54,7,117,110,105,48,54,70,55,7,117,110,105,48,
+54,70,56,7,117,110,105,48,54,70,57,7,117,110,105,48,54,70,65,7,117,110,105,
+48,54,70,66,7,117,110,105,48,54,70,67,7,117,110,105,48,54,70,68,7,117,110,
+105,48,54,70,69,7,117,110,105,48,54,70,70,7,117,110,105,48,55,53,48,7,117,
+110,105,48,55,53,49,7,117,110,105,48,55,53,50,7,117,110,105,48,55,53,51,7,
+117,110,105,48,55,53,52,7,117,110,105,48,55,53,53,7,117,110,105,48,55,53,
+54,7,117,110,105,48,55,53,55,7,117,110,105,48,55,53,56,7,117,110,105,48,55,
+53,57,7,117,110,105,48,55,53,65,7,117,110,105,48,55,53,66,7,117,110,105,48,
+55,53,67,7,117,110,105,48,55,53,68,7,117,110,105,48,55,53,69,7,117,110,105,
+48,55,53,70,7,117,110,105,48,55,54,48,7,117,110,105,48,55,54,49,7,117,110,
+105,48,55,54,50,7,117,110,105,48,55,54,51,7,117,110,105,48,55,54,52,7,117,
+110,105,48,55,54,53,7,117,110,105,48,55,54,54,7,117,110,105,48,55,54,55,7,
+117,110,105,48,55,54,56,7,117,110,105,48,55,54,57,7,117,110,105,48,55,54,
+65,7,117,110,105,48,55,54,66,7,117,110,105,48,55,54,67,7,117,110,105,48,55,
+54,68,7,117,110,105,48,55,54,69,7,117,110,105,48,55,54,70,7,117,110,105,48,
+55,55,48,7,117,110,105,48,55,55,49,7,117,110,105,48,55,55,50,7,117,110,105,
+48,55,55,51,7,117,110,105,48,55,55,52,7,117,110,105,48,55,55,53,7,117,110,
+105,48,55,55,54,7,117,110,105,48,55,55,55,7,117,110,105,48,55,55,56,7,117,
+110,105,48,55,55,57,7,117,110,105,48,55,55,65,7,117,110,105,48,55,55,66,7,
+117,110,105,48,55,55,67,7,117,110,105,48,55,55,68,7,117,110,105,48,55,55,
+69,7,117,110,105,48,55,55,70,4,90,87,83,80,7,117,110,105,50,48,48,67,7,117,
+110,105,50,48,48,68,7,117,110,105,50,48,48,69,7,117,110,105,50,48,48,70,7,
+117,110,105,50,53,67,67,12,117,110,105,48,54,55,49,46,102,105,110,97,12,117,
+110,105,48,54,55,66,46,102,105,110,97,12,117,110,105,48,54,55,66,46,105,110,
+105,116,12,117,110,105,48,54,55,66,46,109,101,100,105,12,117,110,105,48,54,
+55,69,46,102,105,110,97,12,117,110,105,48,54,55,69,46,105,110,105,116,12,
+117,110,105,48,54,55,69,46,109,101,100,105,12,117,110,105,48,54,56,48,46,
+102,105,110,97,12,117,110,105,48,54,56,48,46,105,110,105,116,12,117,110,105,
+48,54,56,48,46,109,101,100,105,12,117,110,105,48,54,55,65,46,102,105,110,
+97,12,117,110,105,48,54,55,65,46,105,110,105,116,12,117,110,105,48,54,55,
+65,46,109,101,100,105,12,117,110,105,48,54,55,70,46,102,105,110,97,12,117,
+110,105,48,54,55,70,46,105,110,105,116,12,117,110,105,48,54,55,70,46,109,
+101,100,105,12,117,110,105,48,54,55,57,46,102,105,110,97,12,117,110,105,48,
+54,55,57,46,105,110,105,116,12,117,110,105,48,54,55,57,46,109,101,100,105,
+12,117,110,105,48,54,65,52,46,102,105,110,97,12,117,110,105,48,54,65,52,46,
+105,110,105,116,12,117,110,105,48,54,65,52,46,109,101,100,105,12,117,110,
+105,48,54,65,54,46,102,105,110,97,12,117,110,105,48,54,65,54,46,105,110,105,
+116,12,117,110,105,48,54,65,54,46,109,101,100,105,12,117,110,105,48,54,56,
+52,46,102,105,110,97,12,117,110,105,48,54,56,52,46,105,110,105,116,12,117,
+110,105,48,54,56,52,46,109,101,100,105,12,117,110,105,48,54,56,51,46,102,
+105,110,97,12,117,110,105,48,54,56,51,46,105,110,105,116,12,117,110,105,48,
+54,56,51,46,109,101,100,105,12,117,110,105,48,54,56,54,46,102,105,110,97,
+12,117,110,105,48,54,56,54,46,105,110,105,116,12,117,110,105,48,54,56,54,
+46,109,101,100,105,12,117,110,105,48,54,56,55,46,102,105,110,97,12,117,110,
+105,48,54,56,55,46,105,110,105,116,12,117,110,105,48,54,56,55,46,109,101,
+100,105,12,117,110,105,48,54,56,68,46,102,105,110,97,12,117,110,105,48,54,
+56,67,46,102,105,110,97,12,117,110,105,48,54,56,69,46,102,105,110,97,12,117,
+110,105,48,54,56,56,46,102,105,110,97,12,117,110,105,48,54,57,56,46,102,105,
+110,97,12,117,110,105,48,54,57,49,46,102,105,110,97,12,117,110,105,48,54,
+65,57,46,102,105,110,97,12,117,110,105,48,54,65,57,46,105,110,105,116,12,
+117,110,105,48,54,65,57,46,109,101,100,105,12,117,110,105,48,54,65,70,46,
+102,105,110,97,12,117,110,105,48,54,65,70,46,105,110,105,116,12,117,110,105,
+48,54,65,70,46,109,101,100,105,12,117,110,105,48,54,66,50,46,102,105,110,
+97,12,117,110,105,48,54,66,50,46,105,110,105,116,12,117,110,105,48,54,66,
+50,46,109,101,100,105,12,117,110,105,48,54,66,49,46,102,105,110,97,12,117,
+110,105,48,54,66,49,46,105,110,105,116,12,117,110,105,48,54,66,49,46,109,
+101,100,105,12,117,110,105,48,54,66,65,46,102,105,110,97,12,117,110,105,48,
+54,66,66,46,102,105,110,97,12,117,110,105,48,54,67,48,46,102,105,110,97,12,
+117,110,105,48,54,67,49,46,102,105,110,97,12,117,110,105,48,54,67,49,46,105,
+110,105,116,12,117,110,105,48,54,67,49,46,109,101,100,105,12,117,110,105,
+48,54,66,69,46,102,105,110,97,12,117,110,105,48,54,66,69,46,105,110,105,116,
+12,117,110,105,48,54,66,69,46,109,101,100,105,12,117,110,105,48,54,68,50,
+46,102,105,110,97,12,117,110,105,48,54,68,51,46,102,105,110,97,7,117,110,
+105,70,66,66,50,7,117,110,105,70,66,66,51,7,117,110,105,70,66,66,52,7,117,
+110,105,70,66,66,53,7,117,110,105,70,66,66,54,7,117,110,105,70,66,66,55,7,
+117,110,105,70,66,66,56,7,117,110,105,70,66,66,57,7,117,110,105,70,66,66,
+65,7,117,110,105,70,66,66,66,7,117,110,105,70,66,66,67,7,117,110,105,70,66,
+66,68,7,117,110,105,70,66,66,69,7,117,110,105,70,66,66,70,7,117,110,105,70,
+66,67,48,7,117,110,105,70,66,67,49,12,117,110,105,48,54,65,68,46,102,105,
+110,97,12,117,110,105,48,54,65,68,46,105,110,105,116,12,117,110,105,48,54,
+65,68,46,109,101,100,105,12,117,110,105,48,54,67,55,46,102,105,110,97,12,
+117,110,105,48,54,67,54,46,102,105,110,97,12,117,110,105,48,54,67,56,46,102,
+105,110,97,12,117,110,105,48,54,67,66,46,102,105,110,97,12,117,110,105,48,
+54,67,53,46,102,105,110,97,12,117,110,105,48,54,67,57,46,102,105,110,97,12,
+117,110,105,48,54,68,48,46,102,105,110,97,12,117,110,105,48,54,68,48,46,105,
+110,105,116,12,117,110,105,48,54,68,48,46,109,101,100,105,12,117,110,105,
+48,54,52,57,46,105,110,105,116,12,117,110,105,48,54,52,57,46,109,101,100,
+105,12,117,110,105,48,54,67,67,46,102,105,110,97,12,117,110,105,48,54,67,
+67,46,105,110,105,116,12,117,110,105,48,54,67,67,46,109,101,100,105,7,117,
+110,105,70,67,53,69,7,117,110,105,70,67,53,70,7,117,110,105,70,67,54,48,7,
+117,110,105,70,67,54,49,7,117,110,105,70,67,54,50,7,117,110,105,70,67,54,
+51,7,117,110,105,70,68,51,69,7,117,110,105,70,68,51,70,5,114,105,121,97,108,
+7,117,110,105,70,69,55,48,7,117,110,105,70,69,55,50,7,117,110,105,70,69,55,
+52,7,117,110,105,70,69,55,54,7,117,110,105,70,69,55,56,7,117,110,105,70,69,
+55,65,7,117,110,105,70,69,55,67,7,117,110,105,70,69,55,69,12,117,110,105,
+48,54,50,50,46,102,105,110,97,12,117,110,105,48,54,50,51,46,102,105,110,97,
+12,117,110,105,48,54,50,52,46,102,105,110,97,12,117,110,105,48,54,50,53,46,
+102,105,110,97,12,117,110,105,48,54,50,54,46,102,105,110,97,12,117,110,105,
+48,54,50,54,46,105,110,105,116,12,117,110,105,48,54,50,54,46,109,101,100,
+105,12,117,110,105,48,54,50,55,46,102,105,110,97,12,117,110,105,48,54,50,
+56,46,102,105,110,97,12,117,110,105,48,54,50,56,46,105,110,105,116,12,117,
+110,105,48,54,50,56,46,109,101,100,105,12,117,110,105,48,54,50,57,46,102,
+105,110,97,12,117,110,105,48,54,50,65,46,102,105,110,97,12,117,110,105,48,
+54,50,65,46,105,110,105,116,12,117,110,105,48,54,50,65,46,109,101,100,105,
+12,117,110,105,48,54,50,66,46,102,105,110,97,12,117,110,105,48,54,50,66,46,
+105,110,105,116,12,117,110,105,48,54,50,66,46,109,101,100,105,12,117,110,
+105,48,54,50,67,46,102,105,110,97,12,117,110,105,48,54,50,67,46,105,110,105,
+116,12,117,110,105,48,54,50,67,46,109,101,100,105,12,117,110,105,48,54,50,
+68,46,102,105,110,97,12,117,110,105,48,54,50,68,46,105,110,105,116,12,117,
+110,105,48,54,50,68,46,109,101,100,105,12,117,110,105,48,54,50,69,46,102,
+105,110,97,12,117,110,105,48,54,50,69,46,105,110,105,116,12,117,110,105,48,
+54,50,69,46,109,101,100,105,12,117,110,105,48,54,50,70,46,102,105,110,97,
+12,117,110,105,48,54,51,48,46,102,105,110,97,12,117,110,105,48,54,51,49,46,
+102,105,110,97,12,117,110,105,48,54,51,50,46,102,105,110,97,12,117,110,105,
+48,54,51,51,46,102,105,110,97,12,117,110,105,48,54,51,51,46,105,110,105,116,
+12,117,110,105,48,54,51,51,46,109,101,100,105,12,117,110,105,48,54,51,52,
+46,102,105,110,97,12,117,110,105,48,54,51,52,46,105,110,105,116,12,117,110,
+105,48,54,51,52,46,109,101,100,105,12,117,110,105,48,54,51,53,46,102,105,
+110,97,12,117,110,105,48,54,51,53,46,105,110,105,116,12,117,110,105,48,54,
+51,53,46,109,101,100,105,12,117,110,105,48,54,51,54,46,102,105,110,97,12,
+117,110,105,48,54,51,54,46,105,110,105,116,12,117,110,105,48,54,51,54,46,
+109,101,100,105,12,117,110,105,48,54,51,55,46,102,105,110,97,12,117,110,105,
+48,54,51,55,46,105,110,105,116,12,117,110,105,48,54,51,55,46,109,101,100,
+105,12,117,110,105,48,54,51,56,46,102,105,110,97,12,117,110,105,48,54,51,
+56,46,105,110,105,116,12,117,110,105,48,54,51,56,46,109,101,100,105,12,117,
+110,105,48,54,51,57,46,102,105,110,97,12,117,110,105,48,54,51,57,46,105,110,
+105,116,12,117,110,105,48,54,51,57,46,109,101,100,105,12,117,110,105,48,54,
+51,65,46,102,105,110,97,12,117,110,105,48,54,51,65,46,105,110,105,116,12,
+117,110,105,48,54,51,65,46,109,101,100,105,12,117,110,105,48,54,52,49,46,
+102,105,110,97,12,117,110,105,48,54,52,49,46,105,110,105,116,12,117,110,105,
+48,54,52,49,46,109,101,100,105,12,117,110,105,48,54,52,50,46,102,105,110,
+97,12,117,110,105,48,54,52,50,46,105,110,105,116,12,117,110,105,48,54,52,
+50,46,109,101,100,105,12,117,110,105,48,54,52,51,46,102,105,110,97,12,117,
+110,105,48,54,52,51,46,105,110,105,116,12,117,110,105,48,54,52,51,46,109,
+101,100,105,12,117,110,105,48,54,52,52,46,102,105,110,97,12,117,110,105,48,
+54,52,52,46,105,110,105,116,12,117,110,105,48,54,52,52,46,109,101,100,105,
+12,117,110,105,48,54,52,53,46,102,105,110,97,12,117,110,105,48,54,52,53,46,
+105,110,105,116,12,117,110,105,48,54,52,53,46,109,101,100,105,12,117,110,
+105,48,54,52,54,46,102,105,110,97,12,117,110,105,48,54,52,54,46,105,110,105,
+116,12,117,110,105,48,54,52,54,46,109,101,100,105,12,117,110,105,48,54,52,
+55,46,102,105,110,97,12,117,110,105,48,54,52,55,46,105,110,105,116,12,117,
+110,105,48,54,52,55,46,109,101,100,105,12,117,110,105,48,54,52,56,46,102,
+105,110,97,12,117,110,105,48,54,52,57,46,102,105,110,97,12,117,110,105,48,
+54,52,65,46,102,105,110,97,12,117,110,105,48,54,52,65,46,105,110,105,116,
+12,117,110,105,48,54,52,65,46,109,101,100,105,16,117,110,105,48,54,52,52,
+48,54,50,50,46,105,115,111,108,16,117,110,105,48,54,52,52,48,54,50,50,46,
+102,105,110,97,16,117,110,105,48,54,52,52,48,54,50,51,46,105,115,111,108,
+16,117,110,105,48,54,52,52,48,54,50,51,46,102,105,110,97,16,117,110,105,48,
+54,52,52,48,54,50,53,46,105,115,111,108,16,117,110,105,48,54,52,52,48,54,
+50,53,46,102,105,110,97,16,117,110,105,48,54,52,52,48,54,50,55,46,105,115,
+111,108,16,117,110,105,48,54,52,52,48,54,50,55,46,102,105,110,97,16,102,101,
+104,95,100,111,116,108,101,115,115,46,105,115,111,108,12,117,110,105,48,54,
+54,70,46,102,105,110,97,13,97,108,101,102,95,97,108,116,46,105,115,111,108,
+13,97,108,101,102,95,97,108,116,46,102,105,110,97,12,104,97,109,122,97,95,
+109,101,100,105,97,108,12,117,110,105,48,54,54,69,46,105,110,105,116,12,117,
+110,105,48,54,54,69,46,102,105,110,97,20,98,101,104,95,100,111,116,108,101,
+115,115,95,97,108,116,46,105,110,105,116,12,117,110,105,48,54,54,69,46,109,
+101,100,105,20,98,101,104,95,100,111,116,108,101,115,115,95,97,108,116,46,
+109,101,100,105,12,117,110,105,48,54,54,70,46,109,101,100,105,12,117,110,
+105,48,54,65,49,46,102,105,110,97,12,117,110,105,48,54,54,70,46,105,110,105,
+116,5,119,97,115,108,97,16,117,110,105,48,54,52,52,48,54,55,49,46,105,115,
+111,108,16,117,110,105,48,54,52,52,48,54,55,49,46,102,105,110,97,8,84,97,
+104,83,109,97,108,108,12,117,110,105,48,54,67,51,46,102,105,110,97,12,117,
+110,105,48,54,67,50,46,102,105,110,97,21,95,100,111,116,115,46,115,109,97,
+108,108,46,97,98,111,118,101,46,48,48,49,16,95,100,111,116,115,46,104,111,
+114,122,46,98,101,108,111,119,13,108,97,114,103,101,118,46,97,114,97,98,105,
+99,17,99,105,114,99,117,109,102,108,101,120,46,97,114,97,98,105,99,15,119,
+97,118,121,104,97,109,122,97,95,97,98,111,118,101,11,117,110,105,48,54,53,
+52,48,54,52,66,11,117,110,105,48,54,53,52,48,54,52,69,11,117,110,105,48,54,
+53,52,48,54,52,67,11,117,110,105,48,54,53,52,48,54,52,70,11,117,110,105,48,
+54,53,52,48,54,53,50,11,117,110,105,48,54,53,53,48,54,52,68,11,117,110,105,
+48,54,53,53,48,54,53,48,11,117,110,105,48,54,53,49,48,54,52,67,11,117,110,
+105,48,54,53,49,48,54,52,68,11,117,110,105,48,54,53,49,48,54,52,66,11,117,
+110,105,48,54,53,49,48,54,52,69,11,117,110,105,48,54,53,49,48,54,52,70,11,
+117,110,105,48,54,53,49,48,54,53,48,12,117,110,105,48,54,70,52,46,117,114,
+100,117,12,117,110,105,48,54,70,55,46,117,114,100,117,12,117,110,105,48,54,
+55,50,46,102,105,110,97,12,117,110,105,48,54,55,51,46,102,105,110,97,12,117,
+110,105,48,54,55,53,46,102,105,110,97,12,117,110,105,48,54,55,54,46,102,105,
+110,97,12,117,110,105,48,54,55,55,46,102,105,110,97,12,117,110,105,48,54,
+55,56,46,102,105,110,97,12,117,110,105,48,54,55,67,46,102,105,110,97,12,117,
+110,105,48,54,55,67,46,105,110,105,116,12,117,110,105,48,54,55,67,46,109,
+101,100,105,12,117,110,105,48,54,55,68,46,102,105,110,97,12,117,110,105,48,
+54,55,68,46,105,110,105,116,12,117,110,105,48,54,55,68,46,109,101,100,105,
+12,117,110,105,48,54,56,49,46,102,105,110,97,12,117,110,105,48,54,56,49,46,
+105,110,105,116,12,117,110,105,48,54,56,49,46,109,101,100,105,12,117,110,
+105,48,54,56,50,46,102,105,110,97,12,117,110,105,48,54,56,50,46,105,110,105,
+116,12,117,110,105,48,54,56,50,46,109,101,100,105,12,117,110,105,48,54,56,
+53,46,102,105,110,97,12,117,110,105,48,54,56,53,46,105,110,105,116,12,117,
+110,105,48,54,56,53,46,109,101,100,105,12,117,110,105,48,54,56,57,46,102,
+105,110,97,12,117,110,105,48,54,56,65,46,102,105,110,97,12,117,110,105,48,
+54,56,66,46,102,105,110,97,12,117,110,105,48,54,56,70,46,102,105,110,97,12,
+117,110,105,48,54,57,48,46,102,105,110,97,12,117,110,105,48,54,57,50,46,102,
+105,110,97,12,117,110,105,48,54,57,51,46,102,105,110,97,12,117,110,105,48,
+54,57,52,46,102,105,110,97,12,117,110,105,48,54,57,53,46,102,105,110,97,12,
+117,110,105,48,54,57,54,46,102,105,110,97,12,117,110,105,48,54,57,55,46,102,
+105,110,97,12,117,110,105,48,54,57,57,46,102,105,110,97,12,117,110,105,48,
+54,57,65,46,102,105,110,97,12,117,110,105,48,54,57,65,46,105,110,105,116,
+12,117,110,105,48,54,57,65,46,109,101,100,105,12,117,110,105,48,54,57,66,
+46,102,105,110,97,12,117,110,105,48,54,57,66,46,105,110,105,116,12,117,110,
+105,48,54,57,66,46,109,101,100,105,12,117,110,105,48,54,57,67,46,102,105,
+110,97,12,117,110,105,48,54,57,67,46,105,110,105,116,12,117,110,105,48,54,
+57,67,46,109,101,100,105,12,117,110,105,48,54,57,68,46,102,105,110,97,12,
+117,110,105,48,54,57,68,46,105,110,105,116,12,117,110,105,48,54,57,68,46,
+109,101,100,105,12,117,110,105,48,54,57,69,46,102,105,110,97,12,117,110,105,
+48,54,57,69,46,105,110,105,116,12,117,110,105,48,54,57,69,46,109,101,100,
+105,12,117,110,105,48,54,57,70,46,102,105,110,97,12,117,110,105,48,54,57,
+70,46,105,110,105,116,12,117,110,105,48,54,57,70,46,109,101,100,105,12,117,
+110,105,48,54,65,48,46,102,105,110,97,12,117,110,105,48,54,65,48,46,105,110,
+105,116,12,117,110,105,48,54,65,48,46,109,101,100,105,12,117,110,105,48,54,
+65,50,46,102,105,110,97,12,117,110,105,48,54,65,50,46,105,110,105,116,12,
+117,110,105,48,54,65,50,46,109,101,100,105,12,117,110,105,48,54,65,51,46,
+102,105,110,97,12,117,110,105,48,54,65,51,46,105,110,105,116,12,117,110,105,
+48,54,65,51,46,109,101,100,105,12,117,110,105,48,54,65,53,46,102,105,110,
+97,12,117,110,105,48,54,65,53,46,105,110,105,116,12,117,110,105,48,54,65,
+53,46,109,101,100,105,12,117,110,105,48,54,65,55,46,102,105,110,97,12,117,
+110,105,48,54,65,56,46,102,105,110,97,12,117,110,105,48,54,65,65,46,102,105,
+110,97,12,117,110,105,48,54,65,65,46,105,110,105,116,12,117,110,105,48,54,
+65,65,46,109,101,100,105,12,117,110,105,48,54,65,66,46,102,105,110,97,12,
+117,110,105,48,54,65,66,46,105,110,105,116,12,117,110,105,48,54,65,66,46,
+109,101,100,105,12,117,110,105,48,54,65,67,46,102,105,110,97,12,117,110,105,
+48,54,65,67,46,105,110,105,116,12,117,110,105,48,54,65,67,46,109,101,100,
+105,12,117,110,105,48,54,65,69,46,102,105,110,97,12,117,110,105,48,54,65,
+69,46,105,110,105,116,12,117,110,105,48,54,65,69,46,109,101,100,105,12,117,
+110,105,48,54,66,48,46,102,105,110,97,12,117,110,105,48,54,66,48,46,105,110,
+105,116,12,117,110,105,48,54,66,48,46,109,101,100,105,12,117,110,105,48,54,
+66,51,46,102,105,110,97,12,117,110,105,48,54,66,51,46,105,110,105,116,12,
+117,110,105,48,54,66,51,46,109,101,100,105,12,117,110,105,48,54,66,52,46,
+102,105,110,97,12,117,110,105,48,54,66,52,46,105,110,105,116,12,117,110,105,
+48,54,66,52,46,109,101,100,105,12,117,110,105,48,54,66,53,46,102,105,110,
+97,12,117,110,105,48,54,66,53,46,105,110,105,116,12,117,110,105,48,54,66,
+53,46,109,101,100,105,12,117,110,105,48,54,66,54,46,102,105,110,97,12,117,
+110,105,48,54,66,54,46,105,110,105,116,12,117,110,105,48,54,66,54,46,109,
+101,100,105,12,117,110,105,48,54,66,55,46,102,105,110,97,12,117,110,105,48,
+54,66,55,46,105,110,105,116,12,117,110,105,48,54,66,55,46,109,101,100,105,
+12,117,110,105,48,54,66,56,46,102,105,110,97,12,117,110,105,48,54,66,56,46,
+105,110,105,116,12,117,110,105,48,54,66,56,46,109,101,100,105,12,117,110,
+105,48,54,66,57,46,102,105,110,97,12,117,110,105,48,54,66,57,46,105,110,105,
+116,12,117,110,105,48,54,66,57,46,109,101,100,105,12,117,110,105,48,54,66,
+67,46,102,105,110,97,12,117,110,105,48,54,66,67,46,105,110,105,116,12,117,
+110,105,48,54,66,67,46,109,101,100,105,12,117,110,105,48,54,66,68,46,102,
+105,110,97,12,117,110,105,48,54,66,70,46,102,105,110,97,12,117,110,105,48,
+54,66,70,46,105,110,105,116,12,117,110,105,48,54,66,70,46,109,101,100,105,
+12,117,110,105,48,54,67,52,46,102,105,110,97,12,117,110,105,48,54,67,68,46,
+102,105,110,97,12,117,110,105,48,54,70,66,46,105,110,105,116,12,117,110,105,
+48,54,70,66,46,109,101,100,105,12,117,110,105,48,54,70,66,46,102,105,110,
+97,12,117,110,105,48,54,70,67,46,105,110,105,116,12,117,110,105,48,54,70,
+67,46,109,101,100,105,12,117,110,105,48,54,70,67,46,102,105,110,97,16,117,
+110,105,48,54,52,52,48,54,55,50,46,105,115,111,108,16,117,110,105,48,54,52,
+52,48,54,55,50,46,102,105,110,97,16,117,110,105,48,54,52,52,48,54,55,51,46,
+105,115,111,108,16,117,110,105,48,54,52,52,48,54,55,51,46,102,105,110,97,
+16,117,110,105,48,54,52,52,48,54,55,53,46,105,115,111,108,16,117,110,105,
+48,54,52,52,48,54,55,53,46,102,105,110,97,16,117,110,105,48,54,66,53,48,54,
+50,55,46,105,115,111,108,16,117,110,105,48,54,66,53,48,54,50,55,46,102,105,
+110,97,16,117,110,105,48,54,66,54,48,54,50,55,46,105,115,111,108,16,117,110,
+105,48,54,66,54,48,54,50,55,46,102,105,110,97,16,117,110,105,48,54,66,55,
+48,54,50,55,46,105,115,111,108,16,117,110,105,48,54,66,55,48,54,50,55,46,
+102,105,110,97,16,117,110,105,48,54,66,56,48,54,50,55,46,105,115,111,108,
+16,117,110,105,48,54,66,56,48,54,50,55,46,102,105,110,97,12,117,110,105,48,
+54,69,69,46,102,105,110,97,12,117,110,105,48,54,69,70,46,102,105,110,97,12,
+117,110,105,48,54,70,70,46,102,105,110,97,12,117,110,105,48,54,70,70,46,105,
+110,105,116,12,117,110,105,48,54,70,70,46,109,101,100,105,12,117,110,105,
+48,55,53,48,46,102,105,110,97,12,117,110,105,48,55,53,48,46,105,110,105,116,
+12,117,110,105,48,55,53,48,46,109,101,100,105,12,117,110,105,48,55,53,49,
+46,105,110,105,116,12,117,110,105,48,55,53,49,46,109,101,100,105,12,117,110,
+105,48,55,53,49,46,102,105,110,97,12,117,110,105,48,55,53,50,46,102,105,110,
+97,12,117,110,105,48,55,53,50,46,105,110,105,116,12,117,110,105,48,55,53,
+50,46,109,101,100,105,12,117,110,105,48,55,53,51,46,102,105,110,97,12,117,
+110,105,48,55,53,51,46,105,110,105,116,12,117,110,105,48,55,53,51,46,109,
+101,100,105,12,117,110,105,48,55,53,52,46,102,105,110,97,12,117,110,105,48,
+55,53,52,46,105,110,105,116,12,117,110,105,48,55,53,52,46,109,101,100,105,
+12,117,110,105,48,55,53,53,46,102,105,110,97,12,117,110,105,48,55,53,53,46,
+105,110,105,116,12,117,110,105,48,55,53,53,46,109,101,100,105,12,117,110,
+105,48,55,53,54,46,102,105,110,97,12,117,110,105,48,55,53,54,46,105,110,105,
+116,12,117,110,105,48,55,53,54,46,109,101,100,105,12,117,110,105,48,55,53,
+55,46,102,105,110,97,12,117,110,105,48,55,53,55,46,105,110,105,116,12,117,
+110,105,48,55,53,55,46,109,101,100,105,12,117,110,105,48,55,53,56,46,102,
+105,110,97,12,117,110,105,48,55,53,56,46,105,110,105,116,12,117,110,105,48,
+55,53,56,46,109,101,100,105,12,117,110,105,48,55,53,57,46,102,105,110,97,
+12,117,110,105,48,55,53,65,46,102,105,110,97,12,117,110,105,48,55,53,66,46,
+102,105,110,97,12,117,110,105,48,55,53,67,46,102,105,110,97,12,117,110,105,
+48,55,53,67,46,105,110,105,116,12,117,110,105,48,55,53,67,46,109,101,100,
+105,12,117,110,105,48,55,53,68,46,102,105,110,97,12,117,110,105,48,55,53,
+68,46,105,110,105,116,12,117,110,105,48,55,53,68,46,109,101,100,105,12,117,
+110,105,48,55,53,69,46,102,105,110,97,12,117,110,105,48,55,53,69,46,105,110,
+105,116,12,117,110,105,48,55,53,69,46,109,101,100,105,12,117,110,105,48,55,
+53,70,46,102,105,110,97,12,117,110,105,48,55,53,70,46,105,110,105,116,12,
+117,110,105,48,55,53,70,46,109,101,100,105,12,117,110,105,48,55,54,48,46,
+102,105,110,97,12,117,110,105,48,55,54,48,46,105,110,105,116,12,117,110,105,
+48,55,54,48,46,109,101,100,105,12,117,110,105,48,55,54,49,46,102,105,110,
+97,12,117,110,105,48,55,54,49,46,105,110,105,116,12,117,110,105,48,55,54,
+49,46,109,101,100,105,12,117,110,105,48,55,54,50,46,102,105,110,97,12,117,
+110,105,48,55,54,50,46,105,110,105,116,12,117,110,105,48,55,54,50,46,109,
+101,100,105,12,117,110,105,48,55,54,51,46,102,105,110,97,12,117,110,105,48,
+55,54,51,46,105,110,105,116,12,117,110,105,48,55,54,51,46,109,101,100,105,
+12,117,110,105,48,55,54,52,46,102,105,110,97,12,117,110,105,48,55,54,52,46,
+105,110,105,116,12,117,110,105,48,55,54,52,46,109,101,100,105,12,117,110,
+105,48,55,54,53,46,102,105,110,97,12,117,110,105,48,55,54,53,46,105,110,105,
+116,12,117,110,105,48,55,54,53,46,109,101,100,105,12,117,110,105,48,55,54,
+54,46,102,105,110,97,12,117,110,105,48,55,54,54,46,105,110,105,116,12,117,
+110,105,48,55,54,54,46,109,101,100,105,12,117,110,105,48,55,54,55,46,102,
+105,110,97,12,117,110,105,48,55,54,55,46,105,110,105,116,12,117,110,105,48,
+55,54,55,46,109,101,100,105,12,117,110,105,48,55,54,56,46,102,105,110,97,
+12,117,110,105,48,55,54,56,46,105,110,105,116,12,117,110,105,48,55,54,56,
+46,109,101,100,105,12,117,110,105,48,55,54,57,46,102,105,110,97,12,117,110,
+105,48,55,54,57,46,105,110,105,116,12,117,110,105,48,55,54,57,46,109,101,
+100,105,12,117,110,105,48,55,54,65,46,102,105,110,97,12,117,110,105,48,55,
+54,65,46,105,110,105,116,12,117,110,105,48,55,54,65,46,109,101,100,105,12,
+117,110,105,48,55,54,66,46,102,105,110,97,12,117,110,105,48,55,54,67,46,102,
+105,110,97,12,117,110,105,48,55,54,68,46,102,105,110,97,12,117,110,105,48,
+55,54,68,46,105,110,105,116,12,117,110,105,48,55,54,68,46,109,101,100,105,
+12,117,110,105,48,54,67,65,46,102,105,110,97,12,117,110,105,48,54,67,70,46,
+102,105,110,97,12,117,110,105,48,54,67,69,46,105,110,105,116,12,117,110,105,
+48,54,67,69,46,109,101,100,105,12,117,110,105,48,54,67,69,46,102,105,110,
+97,12,117,110,105,48,54,68,49,46,102,105,110,97,12,117,110,105,48,54,70,65,
+46,105,110,105,116,12,117,110,105,48,54,70,65,46,109,101,100,105,12,117,110,
+105,48,54,70,65,46,102,105,110,97,16,117,110,105,48,55,54,65,48,54,50,55,
+46,105,115,111,108,16,117,110,105,48,55,54,65,48,54,50,55,46,102,105,110,
+97,15,112,101,114,115,105,97,110,95,104,97,115,104,95,48,49,15,112,101,114,
+115,105,97,110,95,104,97,115,104,95,48,50,20,113,97,102,95,100,111,116,108,
+101,115,115,95,97,108,116,46,105,110,105,116,22,98,101,104,95,100,111,116,
+108,101,115,115,95,97,108,116,95,49,46,105,110,105,116,17,68,101,99,105,109,
+97,108,80,111,105,110,116,70,97,114,115,105,10,68,105,118,105,110,101,78,
+97,109,101,12,117,110,105,48,54,67,50,46,105,110,105,116,12,117,110,105,48,
+54,67,50,46,109,101,100,105,11,117,110,105,48,54,53,49,48,54,55,48,17,84,
+104,111,117,115,97,110,100,115,83,101,112,70,97,114,115,105,12,117,110,105,
+48,54,50,48,46,102,105,110,97,12,117,110,105,48,54,50,48,46,105,110,105,116,
+12,117,110,105,48,54,50,48,46,109,101,100,105,12,117,110,105,48,54,51,66,
+46,102,105,110,97,12,117,110,105,48,54,51,66,46,105,110,105,116,12,117,110,
+105,48,54,51,66,46,109,101,100,105,12,117,110,105,48,54,51,67,46,102,105,
+110,97,12,117,110,105,48,54,51,67,46,105,110,105,116,12,117,110,105,48,54,
+51,67,46,109,101,100,105,12,117,110,105,48,54,51,68,46,102,105,110,97,12,
+117,110,105,48,54,51,68,46,105,110,105,116,12,117,110,105,48,54,51,68,46,
+109,101,100,105,12,117,110,105,48,54,51,69,46,102,105,110,97,12,117,110,105,
+48,54,51,69,46,105,110,105,116,12,117,110,105,48,54,51,69,46,109,101,100,
+105,12,117,110,105,48,54,51,70,46,102,105,110,97,12,117,110,105,48,54,51,
+70,46,105,110,105,116,12,117,110,105,48,54,51,70,46,109,101,100,105,12,117,
+110,105,48,55,54,70,46,102,105,110,97,12,117,110,105,48,55,54,70,46,105,110,
+105,116,12,117,110,105,48,55,54,70,46,109,101,100,105,12,117,110,105,48,55,
+55,48,46,102,105,110,97,12,117,110,105,48,55,55,48,46,105,110,105,116,12,
+117,110,105,48,55,55,48,46,109,101,100,105,12,117,110,105,48,55,55,49,46,
+102,105,110,97,12,117,110,105,48,55,55,50,46,102,105,110,97,12,117,110,105,
+48,55,55,50,46,105,110,105,116,12,117,110,105,48,55,55,50,46,109,101,100,
+105,12,117,110,105,48,55,55,51,46,102,105,110,97,12,117,110,105,48,55,55,
+52,46,102,105,110,97,12,117,110,105,48,55,55,53,46,102,105,110,97,12,117,
+110,105,48,55,55,53,46,105,110,105,116,12,117,110,105,48,55,55,53,46,109,
+101,100,105,12,117,110,105,48,55,55,54,46,102,105,110,97,12,117,110,105,48,
+55,55,54,46,105,110,105,116,12,117,110,105,48,55,55,54,46,109,101,100,105,
+12,117,110,105,48,55,55,55,46,102,105,110,97,12,117,110,105,48,55,55,55,46,
+105,110,105,116,12,117,110,105,48,55,55,55,46,109,101,100,105,12,117,110,
+105,48,55,55,56,46,102,105,110,97,12,117,110,105,48,55,55,57,46,102,105,110,
+97,12,117,110,105,48,55,55,65,46,105,110,105,116,12,117,110,105,48,55,55,
+65,46,109,101,100,105,12,117,110,105,48,55,55,65,46,102,105,110,97,12,117,
+110,105,48,55,55,66,46,105,110,105,116,12,117,110,105,48,55,55,66,46,109,
+101,100,105,12,117,110,105,48,55,55,66,46,102,105,110,97,12,117,110,105,48,
+55,55,67,46,102,105,110,97,12,117,110,105,48,55,55,67,46,105,110,105,116,
+12,117,110,105,48,55,55,67,46,109,101,100,105,12,117,110,105,48,55,55,68,
+46,102,105,110,97,12,117,110,105,48,55,55,68,46,105,110,105,116,12,117,110,
+105,48,55,55,68,46,109,101,100,105,12,117,110,105,48,55,55,69,46,102,105,
+110,97,12,117,110,105,48,55,55,69,46,105,110,105,116,12,117,110,105,48,55,
+55,69,46,109,101,100,105,12,117,110,105,48,55,55,70,46,102,105,110,97,12,
+117,110,105,48,55,55,70,46,105,110,105,116,12,117,110,105,48,55,55,70,46,
+109,101,100,105,12,117,110,105,48,55,54,69,46,102,105,110,97,12,117,110,105,
+48,55,54,69,46,105,110,105,116,12,117,110,105,48,55,54,69,46,109,101,100,
+105,11,117,110,105,48,54,54,48,46,116,97,98,11,117,110,105,48,54,54,49,46,
+116,97,98,11,117,110,105,48,54,54,50,46,116,97,98,11,117,110,105,48,54,54,
+51,46,116,97,98,11,117,110,105,48,54,54,52,46,116,97,98,11,117,110,105,48,
+54,54,53,46,116,97,98,11,117,110,105,48,54,54,54,46,116,97,98,11,117,110,
+105,48,54,54,55,46,116,97,98,11,117,110,105,48,54,54,56,46,116,97,98,11,117,
+110,105,48,54,54,57,46,116,97,98,11,117,110,105,48,54,70,52,46,116,97,98,
+16,117,110,105,48,54,70,52,46,117,114,100,117,46,116,97,98,11,117,110,105,
+48,54,70,53,46,116,97,98,11,117,110,105,48,54,70,54,46,116,97,98,16,117,110,
+105,48,54,70,55,46,117,114,100,117,46,116,97,98,15,117,110,105,48,54,70,50,
+46,115,109,97,108,108,48,49,15,117,110,105,48,54,70,51,46,115,109,97,108,
+108,48,49,12,117,110,105,48,54,55,56,46,109,101,100,105,12,117,110,105,48,
+54,55,56,46,105,110,105,116,6,69,120,116,101,110,100,12,116,119,111,100,111,
+116,115,115,109,97,108,108,14,116,104,114,101,101,100,111,116,115,115,109,
+97,108,108,18,116,104,114,101,101,100,111,116,115,115,109,97,108,108,46,97,
+108,116,15,84,97,104,83,109,97,108,108,84,119,111,68,111,116,115,15,117,110,
+105,48,54,70,52,46,115,109,97,108,108,48,49,12,75,97,102,46,115,109,97,108,
+108,100,111,116,7,117,110,105,70,69,55,49,7,117,110,105,70,69,55,55,7,117,
+110,105,70,69,55,57,7,117,110,105,70,69,55,66,7,117,110,105,70,69,55,68,7,
+117,110,105,70,69,55,70,7,117,110,105,48,54,53,50,21,98,101,104,95,100,111,
+116,108,101,115,115,95,97,108,116,50,46,105,110,105,116,21,98,101,104,95,
+100,111,116,108,101,115,115,95,97,108,116,50,46,109,101,100,105,7,117,110,
+105,48,56,65,48,12,117,110,105,48,56,65,48,46,102,105,110,97,12,117,110,105,
+48,56,65,48,46,105,110,105,116,12,117,110,105,48,56,65,48,46,109,101,100,
+105,7,117,110,105,48,56,65,50,12,117,110,105,48,56,65,50,46,102,105,110,97,
+12,117,110,105,48,56,65,50,46,105,110,105,116,12,117,110,105,48,56,65,50,
+46,109,101,100,105,7,117,110,105,48,56,65,51,12,117,110,105,48,56,65,51,46,
+102,105,110,97,12,117,110,105,48,56,65,51,46,105,110,105,116,12,117,110,105,
+48,56,65,51,46,109,101,100,105,7,117,110,105,48,56,65,52,12,117,110,105,48,
+56,65,52,46,102,105,110,97,12,117,110,105,48,56,65,52,46,105,110,105,116,
+12,117,110,105,48,56,65,52,46,109,101,100,105,7,117,110,105,48,56,65,53,12,
+117,110,105,48,56,65,53,46,102,105,110,97,12,117,110,105,48,56,65,53,46,105,
+110,105,116,12,117,110,105,48,56,65,53,46,109,101,100,105,7,117,110,105,48,
+56,65,54,12,117,110,105,48,56,65,54,46,102,105,110,97,12,117,110,105,48,56,
+65,54,46,105,110,105,116,12,117,110,105,48,56,65,54,46,109,101,100,105,7,
+117,110,105,48,56,65,55,12,117,110,105,48,56,65,55,46,102,105,110,97,12,117,
+110,105,48,56,65,55,46,105,110,105,116,12,117,110,105,48,56,65,55,46,109,
+101,100,105,7,117,110,105,48,56,65,56,12,117,110,105,48,56,65,56,46,102,105,
+110,97,12,117,110,105,48,56,65,56,46,105,110,105,116,12,117,110,105,48,56,
+65,56,46,109,101,100,105,7,117,110,105,48,56,65,57,12,117,110,105,48,56,65,
+57,46,102,105,110,97,12,117,110,105,48,56,65,57,46,105,110,105,116,12,117,
+110,105,48,56,65,57,46,109,101,100,105,7,117,110,105,48,56,65,65,12,117,110,
+105,48,56,65,65,46,102,105,110,97,7,117,110,105,48,56,65,66,12,117,110,105,
+48,56,65,66,46,102,105,110,97,12,117,110,105,48,56,65,67,46,102,105,110,97,
+7,117,110,105,48,56,69,52,7,117,110,105,48,56,69,53,7,117,110,105,48,56,69,
+54,7,117,110,105,48,56,69,55,7,117,110,105,48,56,69,56,7,117,110,105,48,56,
+69,57,7,117,110,105,48,56,69,65,7,117,110,105,48,56,69,66,7,117,110,105,48,
+56,69,67,7,117,110,105,48,56,69,68,7,117,110,105,48,56,69,69,7,117,110,105,
+48,56,69,70,7,117,110,105,48,56,70,48,7,117,110,105,48,56,70,49,7,117,110,
+105,48,56,70,50,7,117,110,105,48,56,70,51,7,117,110,105,48,56,70,52,7,117,
+110,105,48,56,70,53,7,117,110,105,48,56,70,54,7,117,110,105,48,56,70,55,7,
+117,110,105,48,56,70,56,7,117,110,105,48,56,70,57,7,117,110,105,48,56,70,
+65,7,117,110,105,48,56,70,66,7,117,110,105,48,56,70,67,7,117,110,105,48,56,
+70,68,7,117,110,105,48,56,70,69,7,117,110,105,70,68,70,65,7,117,110,105,70,
+68,70,66,7,117,110,105,70,68,70,68,13,117,110,105,48,54,54,48,46,115,109,
+97,108,108,13,117,110,105,48,54,54,49,46,115,109,97,108,108,13,117,110,105,
+48,54,54,50,46,115,109,97,108,108,13,117,110,105,48,54,54,51,46,115,109,97,
+108,108,13,117,110,105,48,54,54,52,46,115,109,97,108,108,13,117,110,105,48,
+54,54,53,46,115,109,97,108,108,13,117,110,105,48,54,54,54,46,115,109,97,108,
+108,13,117,110,105,48,54,54,55,46,115,109,97,108,108,13,117,110,105,48,54,
+54,56,46,115,109,97,108,108,13,117,110,105,48,54,54,57,46,115,109,97,108,
+108,13,117,110,105,48,54,70,52,46,115,109,97,108,108,13,117,110,105,48,54,
+70,53,46,115,109,97,108,108,13,117,110,105,48,54,70,54,46,115,109,97,108,
+108,18,117,110,105,48,54,70,52,46,117,114,100,117,46,115,109,97,108,108,18,
+117,110,105,48,54,70,55,46,117,114,100,117,46,115,109,97,108,108,8,98,97,
+114,115,104,111,114,116,14,100,111,117,98,108,101,98,97,114,115,104,111,114,
+116,7,98,97,114,108,111,110,103,13,100,111,117,98,108,101,98,97,114,108,111,
+110,103,11,117,110,105,70,68,70,50,46,112,116,49,11,117,110,105,70,68,70,
+50,46,112,116,50,14,117,110,105,48,54,48,54,48,54,48,55,46,112,116,10,117,
+110,105,48,54,48,55,46,112,116,11,117,110,105,48,54,48,48,46,97,108,116,12,
+117,110,105,48,54,48,48,46,97,108,116,49,12,117,110,105,48,54,48,48,46,97,
+108,116,50,7,117,110,105,48,54,48,48,11,117,110,105,48,54,48,49,46,97,108,
+116,12,117,110,105,48,54,48,49,46,97,108,116,49,12,117,110,105,48,54,48,49,
+46,97,108,116,50,12,117,110,105,48,54,48,49,46,97,108,116,51,11,117,110,105,
+48,54,48,50,46,97,108,116,12,117,110,105,48,54,48,50,46,97,108,116,49,12,
+117,110,105,48,54,48,50,46,97,108,116,50,7,117,110,105,48,54,48,50,11,117,
+110,105,48,54,48,51,46,97,108,116,12,117,110,105,48,54,48,51,46,97,108,116,
+49,12,117,110,105,48,54,48,51,46,97,108,116,50,7,117,110,105,48,54,48,51,
+11,117,110,105,48,54,48,52,46,97,108,116,12,117,110,105,48,54,48,52,46,97,
+108,116,49,12,117,110,105,48,54,48,52,46,97,108,116,50,12,117,110,105,48,
+54,48,52,46,97,108,116,51,7,117,110,105,48,54,48,52,11,117,110,105,48,54,
+68,68,46,97,108,116,12,117,110,105,48,54,68,68,46,97,108,116,49,12,117,110,
+105,48,54,68,68,46,97,108,116,50,11,76,65,95,76,97,109,46,105,115,111,108,
+12,76,65,95,65,108,101,102,46,105,115,111,108,11,76,65,95,76,97,109,46,102,
+105,110,97,12,76,65,95,65,108,101,102,46,102,105,110,97,22,76,65,95,76,97,
+109,83,109,97,108,108,86,65,98,111,118,101,46,105,115,111,108,19,76,65,95,
+76,97,109,68,111,116,65,98,111,118,101,46,105,115,111,108,25,76,65,95,76,
+97,109,84,104,114,101,101,68,111,116,115,65,98,111,118,101,46,105,115,111,
+108,19,76,65,95,76,97,109,98,97,114,115,104,111,114,116,46,105,115,111,108,
+25,76,65,95,76,97,109,84,104,114,101,101,68,111,116,115,66,101,108,111,119,
+46,105,115,111,108,17,76,65,95,65,108,101,102,77,97,100,100,97,46,105,115,
+111,108,23,76,65,95,65,108,101,102,87,72,97,109,122,97,65,98,111,118,101,
+46,105,115,111,108,23,76,65,95,65,108,101,102,87,72,97,109,122,97,66,101,
+108,111,119,46,105,115,111,108,17,76,65,95,65,108,101,102,87,97,115,108,97,
+46,105,115,111,108,22,76,65,95,65,108,101,102,72,97,109,122,97,65,98,111,
+118,101,46,105,115,111,108,22,76,65,95,65,108,101,102,72,97,109,122,97,66,
+101,108,111,119,46,105,115,111,108,22,76,65,95,76,97,109,83,109,97,108,108,
+86,65,98,111,118,101,46,102,105,110,97,19,76,65,95,76,97,109,68,111,116,65,
+98,111,118,101,46,102,105,110,97,25,76,65,95,76,97,109,84,104,114,101,101,
+68,111,116,115,65,98,111,118,101,46,102,105,110,97,25,76,65,95,76,97,109,
+84,104,114,101,101,68,111,116,115,66,101,108,111,119,46,102,105,110,97,19,
+76,65,95,76,97,109,98,97,114,115,104,111,114,116,46,102,105,110,97,17,76,
+65,95,65,108,101,102,77,97,100,100,97,46,102,105,110,97,23,76,65,95,65,108,
+101,102,87,72,97,109,122,97,65,98,111,118,101,46,102,105,110,97,23,76,65,
+95,65,108,101,102,87,72,97,109,122,97,66,101,108,111,119,46,102,105,110,97,
+17,76,65,95,65,108,101,102,87,97,115,108,97,46,102,105,110,97,22,76,65,95,
+65,108,101,102,72,97,109,122,97,65,98,111,118,101,46,102,105,110,97,20,76,
+65,95,65,108,101,102,70,97,116,104,97,116,97,110,46,102,105,110,97,22,76,
+65,95,65,108,101,102,72,97,109,122,97,66,101,108,111,119,46,102,105,110,97,
+18,100,111,117,98,108,101,98,97,114,115,104,111,114,116,46,97,108,116,20,
+76,65,95,76,97,109,100,111,117,98,108,101,98,97,114,46,105,115,111,108,10,
+117,110,105,48,56,65,66,46,112,116,15,117,110,105,48,56,65,66,46,112,116,
+46,102,105,110,97,15,117,110,105,48,56,65,67,46,112,116,46,102,105,110,97,
+9,99,105,114,99,108,101,100,111,116,11,117,110,105,48,56,65,66,46,100,111,
+116,10,117,110,105,48,56,70,53,46,112,116,7,117,110,105,70,66,69,66,7,117,
+110,105,70,66,69,68,7,117,110,105,70,66,69,70,7,117,110,105,70,66,70,49,7,
+117,110,105,70,66,70,51,7,117,110,105,70,66,70,53,7,117,110,105,70,66,70,
+55,7,117,110,105,70,66,70,65,7,117,110,105,70,67,54,52,7,117,110,105,70,67,
+54,53,7,117,110,105,70,67,54,54,7,117,110,105,70,67,54,55,7,117,110,105,70,
+67,54,56,7,117,110,105,70,67,54,57,7,117,110,105,70,67,54,65,7,117,110,105,
+70,67,54,66,7,117,110,105,70,67,54,67,7,117,110,105,70,67,54,68,7,117,110,
+105,70,67,54,69,7,117,110,105,70,67,54,70,7,117,110,105,70,67,55,48,7,117,
+110,105,70,67,55,49,7,117,110,105,70,67,55,50,7,117,110,105,70,67,55,51,7,
+117,110,105,70,67,55,52,7,117,110,105,70,67,55,53,7,117,110,105,70,67,55,
+54,7,117,110,105,70,67,55,55,7,117,110,105,70,67,55,56,7,117,110,105,70,67,
+55,57,7,117,110,105,70,67,55,65,7,117,110,105,70,67,55,66,7,117,110,105,70,
+67,55,67,7,117,110,105,70,67,55,68,7,117,110,105,70,67,55,69,7,117,110,105,
+70,67,55,70,7,117,110,105,70,67,56,48,7,117,110,105,70,67,56,49,7,117,110,
+105,70,67,56,50,7,117,110,105,70,67,56,51,7,117,110,105,70,67,56,52,7,117,
+110,105,70,67,56,53,7,117,110,105,70,67,56,54,7,117,110,105,70,67,56,55,7,
+117,110,105,70,67,56,56,7,117,110,105,70,67,56,57,7,117,110,105,70,67,56,
+65,7,117,110,105,70,67,56,66,7,117,110,105,70,67,56,67,7,117,110,105,70,67,
+56,68,7,117,110,105,70,67,56,69,7,117,110,105,70,67,56,70,7,117,110,105,70,
+67,57,48,7,117,110,105,70,67,57,49,7,117,110,105,70,67,57,50,7,117,110,105,
+70,67,57,51,7,117,110,105,70,67,57,52,7,117,110,105,70,67,57,53,7,117,110,
+105,70,67,57,54,7,117,110,105,70,68,49,49,7,117,110,105,70,68,49,50,7,117,
+110,105,70,68,49,51,7,117,110,105,70,68,49,52,7,117,110,105,70,68,49,53,7,
+117,110,105,70,68,49,54,7,117,110,105,70,68,49,55,7,117,110,105,70,68,49,
+56,7,117,110,105,70,68,49,57,7,117,110,105,70,68,49,65,7,117,110,105,70,68,
+49,66,7,117,110,105,70,68,49,67,7,117,110,105,70,68,49,68,7,117,110,105,70,
+68,49,69,7,117,110,105,70,68,49,70,7,117,110,105,70,68,50,48,7,117,110,105,
+70,68,50,49,7,117,110,105,70,68,50,50,7,117,110,105,70,68,50,51,7,117,110,
+105,70,68,50,52,7,117,110,105,70,68,50,53,7,117,110,105,70,68,50,54,7,117,
+110,105,70,68,50,55,7,117,110,105,70,68,50,56,7,117,110,105,70,68,50,57,7,
+117,110,105,70,68,50,65,7,117,110,105,70,68,50,66,7,117,110,105,70,68,50,
+67,7,117,110,105,70,68,51,67,7,117,110,105,70,66,70,56,7,117,110,105,70,66,
+70,66,7,117,110,105,70,67,57,55,7,117,110,105,70,67,57,56,7,117,110,105,70,
+67,57,57,7,117,110,105,70,67,57,65,7,117,110,105,70,67,57,66,7,117,110,105,
+70,67,57,67,7,117,110,105,70,67,57,68,7,117,110,105,70,67,57,69,7,117,110,
+105,70,67,57,70,7,117,110,105,70,67,65,48,7,117,110,105,70,67,65,49,7,117,
+110,105,70,67,65,50,7,117,110,105,70,67,65,51,7,117,110,105,70,67,65,52,7,
+117,110,105,70,67,65,53,7,117,110,105,70,67,65,54,7,117,110,105,70,67,65,
+55,7,117,110,105,70,67,65,56,7,117,110,105,70,67,65,57,7,117,110,105,70,67,
+65,65,7,117,110,105,70,67,65,66,7,117,110,105,70,67,65,67,7,117,110,105,70,
+67,65,68,7,117,110,105,70,67,65,69,7,117,110,105,70,67,65,70,7,117,110,105,
+70,67,66,48,7,117,110,105,70,67,66,49,7,117,110,105,70,67,66,50,7,117,110,
+105,70,67,66,51,7,117,110,105,70,67,66,52,7,117,110,105,70,67,66,53,7,117,
+110,105,70,67,66,54,7,117,110,105,70,67,66,55,7,117,110,105,70,67,66,56,7,
+117,110,105,70,67,66,57,7,117,110,105,70,67,66,65,7,117,110,105,70,67,66,
+66,7,117,110,105,70,67,66,67,7,117,110,105,70,67,66,68,7,117,110,105,70,67,
+66,69,7,117,110,105,70,67,66,70,7,117,110,105,70,67,67,48,7,117,110,105,70,
+67,67,49,7,117,110,105,70,67,67,50,7,117,110,105,70,67,67,51,7,117,110,105,
+70,67,67,52,7,117,110,105,70,67,67,53,7,117,110,105,70,67,67,54,7,117,110,
+105,70,67,67,55,7,117,110,105,70,67,67,56,7,117,110,105,70,67,67,57,7,117,
+110,105,70,67,67,65,7,117,110,105,70,67,67,66,7,117,110,105,70,67,67,67,7,
+117,110,105,70,67,67,68,7,117,110,105,70,67,67,69,7,117,110,105,70,67,67,
+70,7,117,110,105,70,67,68,48,7,117,110,105,70,67,68,49,7,117,110,105,70,67,
+68,50,7,117,110,105,70,67,68,51,7,117,110,105,70,67,68,52,7,117,110,105,70,
+67,68,53,7,117,110,105,70,67,68,54,7,117,110,105,70,67,68,55,7,117,110,105,
+70,67,68,56,7,117,110,105,70,67,68,57,7,117,110,105,70,67,68,65,7,117,110,
+105,70,67,68,66,7,117,110,105,70,67,68,67,7,117,110,105,70,67,68,68,7,117,
+110,105,70,67,68,69,7,117,110,105,70,68,50,68,7,117,110,105,70,68,50,69,7,
+117,110,105,70,68,50,70,7,117,110,105,70,68,51,48,7,117,110,105,70,68,51,
+49,7,117,110,105,70,68,51,50,7,117,110,105,70,68,51,51,7,117,110,105,70,66,
+69,65,7,117,110,105,70,66,69,67,7,117,110,105,70,66,69,69,7,117,110,105,70,
+66,70,48,7,117,110,105,70,66,70,50,7,117,110,105,70,66,70,52,7,117,110,105,
+70,66,70,54,7,117,110,105,70,66,70,57,7,117,110,105,70,67,48,48,7,117,110,
+105,70,67,48,49,7,117,110,105,70,67,48,50,7,117,110,105,70,67,48,51,7,117,
+110,105,70,67,48,52,7,117,110,105,70,67,48,53,7,117,110,105,70,67,48,54,7,
+117,110,105,70,67,48,55,7,117,110,105,70,67,48,56,7,117,110,105,70,67,48,
+57,7,117,110,105,70,67,48,65,7,117,110,105,70,67,48,66,7,117,110,105,70,67,
+48,67,7,117,110,105,70,67,48,68,7,117,110,105,70,67,48,69,7,117,110,105,70,
+67,48,70,7,117,110,105,70,67,49,48,7,117,110,105,70,67,49,49,7,117,110,105,
+70,67,49,50,7,117,110,105,70,67,49,51,7,117,110,105,70,67,49,52,7,117,110,
+105,70,67,49,53,7,117,110,105,70,67,49,54,7,117,110,105,70,67,49,55,7,117,
+110,105,70,67,49,56,7,117,110,105,70,67,49,57,7,117,110,105,70,67,49,65,7,
+117,110,105,70,67,49,66,7,117,110,105,70,67,49,67,7,117,110,105,70,67,49,
+68,7,117,110,105,70,67,49,69,7,117,110,105,70,67,49,70,7,117,110,105,70,67,
+50,48,7,117,110,105,70,67,50,49,7,117,110,105,70,67,50,50,7,117,110,105,70,
+67,50,51,7,117,110,105,70,67,50,52,7,117,110,105,70,67,50,53,7,117,110,105,
+70,67,50,54,7,117,110,105,70,67,50,55,7,117,110,105,70,67,50,56,7,117,110,
+105,70,67,50,57,7,117,110,105,70,67,50,65,7,117,110,105,70,67,50,66,7,117,
+110,105,70,67,50,67,7,117,110,105,70,67,50,68,7,117,110,105,70,67,50,69,7,
+117,110,105,70,67,50,70,7,117,110,105,70,67,51,48,7,117,110,105,70,67,51,
+49,7,117,110,105,70,67,51,50,7,117,110,105,70,67,51,51,7,117,110,105,70,67,
+51,52,7,117,110,105,70,67,51,53,7,117,110,105,70,67,51,54,7,117,110,105,70,
+67,51,55,7,117,110,105,70,67,51,56,7,117,110,105,70,67,51,57,7,117,110,105,
+70,67,51,65,7,117,110,105,70,67,51,66,7,117,110,105,70,67,51,67,7,117,110,
+105,70,67,51,68,7,117,110,105,70,67,51,69,7,117,110,105,70,67,51,70,7,117,
+110,105,70,67,52,48,7,117,110,105,70,67,52,49,7,117,110,105,70,67,52,50,7,
+117,110,105,70,67,52,51,7,117,110,105,70,67,52,52,7,117,110,105,70,67,52,
+53,7,117,110,105,70,67,52,54,7,117,110,105,70,67,52,55,7,117,110,105,70,67,
+52,56,7,117,110,105,70,67,52,57,7,117,110,105,70,67,52,65,7,117,110,105,70,
+67,52,66,7,117,110,105,70,67,52,67,7,117,110,105,70,67,52,68,7,117,110,105,
+70,67,52,69,7,117,110,105,70,67,52,70,7,117,110,105,70,67,53,48,7,117,110,
+105,70,67,53,49,7,117,110,105,70,67,53,50,7,117,110,105,70,67,53,51,7,117,
+110,105,70,67,53,52,7,117,110,105,70,67,53,53,7,117,110,105,70,67,53,54,7,
+117,110,105,70,67,53,55,7,117,110,105,70,67,53,56,7,117,110,105,70,67,53,
+57,7,117,110,105,70,67,53,65,7,117,110,105,70,67,53,66,7,117,110,105,70,67,
+53,67,7,117,110,105,70,67,53,68,7,117,110,105,70,67,70,53,7,117,110,105,70,
+67,70,54,7,117,110,105,70,67,70,55,7,117,110,105,70,67,70,56,7,117,110,105,
+70,67,70,57,7,117,110,105,70,67,70,65,7,117,110,105,70,67,70,66,7,117,110,
+105,70,67,70,67,7,117,110,105,70,67,70,68,7,117,110,105,70,67,70,69,7,117,
+110,105,70,67,70,70,7,117,110,105,70,68,48,48,7,117,110,105,70,68,48,49,7,
+117,110,105,70,68,48,50,7,117,110,105,70,68,48,51,7,117,110,105,70,68,48,
+52,7,117,110,105,70,68,48,53,7,117,110,105,70,68,48,54,7,117,110,105,70,68,
+48,55,7,117,110,105,70,68,48,56,7,117,110,105,70,68,48,57,7,117,110,105,70,
+68,48,65,7,117,110,105,70,68,48,66,7,117,110,105,70,68,48,67,7,117,110,105,
+70,68,48,68,7,117,110,105,70,68,48,69,7,117,110,105,70,68,48,70,7,117,110,
+105,70,68,49,48,7,117,110,105,70,68,51,68,7,117,110,105,70,67,68,70,7,117,
+110,105,70,67,69,48,7,117,110,105,70,67,69,49,7,117,110,105,70,67,69,50,7,
+117,110,105,70,67,69,51,7,117,110,105,70,67,69,52,7,117,110,105,70,67,69,
+53,7,117,110,105,70,67,69,54,7,117,110,105,70,67,69,55,7,117,110,105,70,67,
+69,56,7,117,110,105,70,67,69,57,7,117,110,105,70,67,69,65,7,117,110,105,70,
+67,69,66,7,117,110,105,70,67,69,67,7,117,110,105,70,67,69,68,7,117,110,105,
+70,67,69,69,7,117,110,105,70,67,69,70,7,117,110,105,70,67,70,48,7,117,110,
+105,70,67,70,49,7,117,110,105,70,68,51,52,7,117,110,105,70,68,51,53,7,117,
+110,105,70,68,51,54,7,117,110,105,70,68,51,55,7,117,110,105,70,68,51,56,7,
+117,110,105,70,68,51,57,7,117,110,105,70,68,51,65,7,117,110,105,70,68,51,
+66,7,117,110,105,70,68,53,49,7,117,110,105,70,68,53,56,7,117,110,105,70,68,
+53,65,7,117,110,105,70,68,53,66,7,117,110,105,70,68,53,69,7,117,110,105,70,
+68,53,70,7,117,110,105,70,68,54,50,7,117,110,105,70,68,54,52,7,117,110,105,
+70,68,54,54,7,117,110,105,70,68,54,55,7,117,110,105,70,68,54,57,7,117,110,
+105,70,68,54,65,7,117,110,105,70,68,54,67,7,117,110,105,70,68,54,69,7,117,
+110,105,70,68,54,70,7,117,110,105,70,68,55,49,7,117,110,105,70,68,55,52,7,
+117,110,105,70,68,55,53,7,117,110,105,70,68,55,54,7,117,110,105,70,68,55,
+56,7,117,110,105,70,68,55,57,7,117,110,105,70,68,55,65,7,117,110,105,70,68,
+55,66,7,117,110,105,70,68,55,67,7,117,110,105,70,68,55,69,7,117,110,105,70,
+68,55,70,7,117,110,105,70,68,56,48,7,117,110,105,70,68,56,49,7,117,110,105,
+70,68,56,50,7,117,110,105,70,68,56,52,7,117,110,105,70,68,56,53,7,117,110,
+105,70,68,56,55,7,117,110,105,70,68,56,66,7,117,110,105,70,68,57,54,7,117,
+110,105,70,68,57,55,7,117,110,105,70,68,57,57,7,117,110,105,70,68,57,65,7,
+117,110,105,70,68,57,66,7,117,110,105,70,68,57,67,7,117,110,105,70,68,57,
+69,7,117,110,105,70,68,57,70,7,117,110,105,70,68,65,48,7,117,110,105,70,68,
+65,49,7,117,110,105,70,68,65,50,7,117,110,105,70,68,65,51,7,117,110,105,70,
+68,65,52,7,117,110,105,70,68,65,53,7,117,110,105,70,68,65,54,7,117,110,105,
+70,68,65,55,7,117,110,105,70,68,65,56,7,117,110,105,70,68,65,57,7,117,110,
+105,70,68,65,65,7,117,110,105,70,68,65,66,7,117,110,105,70,68,65,67,7,117,
+110,105,70,68,65,68,7,117,110,105,70,68,65,69,7,117,110,105,70,68,65,70,7,
+117,110,105,70,68,66,48,7,117,110,105,70,68,66,49,7,117,110,105,70,68,66,
+50,7,117,110,105,70,68,66,51,7,117,110,105,70,68,66,54,7,117,110,105,70,68,
+66,55,7,117,110,105,70,68,66,57,7,117,110,105,70,68,66,66,7,117,110,105,70,
+68,66,67,7,117,110,105,70,68,66,68,7,117,110,105,70,68,66,69,7,117,110,105,
+70,68,66,70,7,117,110,105,70,68,67,48,7,117,110,105,70,68,67,49,7,117,110,
+105,70,68,67,50,7,117,110,105,70,68,67,54,7,117,110,105,70,68,67,55,7,117,
+110,105,70,68,53,48,7,117,110,105,70,68,53,50,7,117,110,105,70,68,53,51,7,
+117,110,105,70,68,53,52,7,117,110,105,70,68,53,53,7,117,110,105,70,68,53,
+54,7,117,110,105,70,68,53,55,7,117,110,105,70,68,53,57,7,117,110,105,70,68,
+53,67,7,117,110,105,70,68,53,68,7,117,110,105,70,68,54,48,7,117,110,105,70,
+68,54,49,7,117,110,105,70,68,54,51,7,117,110,105,70,68,54,53,7,117,110,105,
+70,68,54,56,7,117,110,105,70,68,54,66,7,117,110,105,70,68,54,68,7,117,110,
+105,70,68,55,48,7,117,110,105,70,68,55,50,7,117,110,105,70,68,55,51,7,117,
+110,105,70,68,55,55,7,117,110,105,70,68,55,68,7,117,110,105,70,68,56,51,7,
+117,110,105,70,68,56,54,7,117,110,105,70,68,56,56,7,117,110,105,70,68,56,
+57,7,117,110,105,70,68,56,65,7,117,110,105,70,68,56,67,7,117,110,105,70,68,
+56,68,7,117,110,105,70,68,56,69,7,117,110,105,70,68,56,70,7,117,110,105,70,
+68,57,50,7,117,110,105,70,68,57,51,7,117,110,105,70,68,57,52,7,117,110,105,
+70,68,57,53,7,117,110,105,70,68,57,56,7,117,110,105,70,68,57,68,7,117,110,
+105,70,68,66,52,7,117,110,105,70,68,66,53,7,117,110,105,70,68,66,56,7,117,
+110,105,70,68,66,65,7,117,110,105,70,68,67,51,7,117,110,105,70,68,67,52,7,
+117,110,105,70,68,67,53,7,98,97,115,101,78,117,109,7,117,110,105,70,67,70,
+50,7,117,110,105,70,67,70,51,7,117,110,105,70,67,70,52,7,117,110,105,48,48,
+51,48,7,117,110,105,48,48,51,49,7,117,110,105,48,48,51,50,7,117,110,105,48,
+48,51,51,7,117,110,105,48,48,51,52,7,117,110,105,48,48,51,53,7,117,110,105,
+48,48,51,54,7,117,110,105,48,48,51,55,7,117,110,105,48,48,51,56,7,117,110,
+105,48,48,51,57,13,117,110,105,50,48,55,48,46,115,109,97,108,108,13,117,110,
+105,48,48,66,57,46,115,109,97,108,108,13,117,110,105,48,48,66,50,46,115,109,
+97,108,108,13,117,110,105,48,48,66,51,46,115,109,97,108,108,13,117,110,105,
+50,48,55,52,46,115,109,97,108,108,13,117,110,105,50,48,55,53,46,115,109,97,
+108,108,13,117,110,105,50,48,55,54,46,115,109,97,108,108,13,117,110,105,50,
+48,55,55,46,115,109,97,108,108,13,117,110,105,50,48,55,56,46,115,109,97,108,
+108,13,117,110,105,50,48,55,57,46,115,109,97,108,108,12,117,110,105,48,54,
+48,68,46,112,97,114,116,7,117,110,105,48,48,50,49,7,117,110,105,48,48,50,
+69,7,117,110,105,48,48,50,67,7,117,110,105,48,48,65,66,7,117,110,105,48,48,
+66,66,11,117,110,105,48,48,65,66,46,102,97,114,11,117,110,105,48,48,66,66,
+46,102,97,114,12,115,109,97,108,108,118,46,98,101,108,111,119,16,99,105,114,
+99,117,109,102,108,101,120,46,98,101,108,111,119,7,117,110,105,70,69,55,51,
+7,117,110,105,50,48,49,48,7,117,110,105,50,48,49,49,13,99,111,109,109,97,
+114,101,118,101,114,115,101,100,17,115,101,109,105,99,111,108,111,110,114,
+101,118,101,114,115,101,100,7,117,110,105,70,68,70,48,7,117,110,105,70,68,
+70,49,7,117,110,105,70,68,70,51,7,117,110,105,70,68,70,52,7,117,110,105,70,
+68,70,53,7,117,110,105,70,68,70,54,7,117,110,105,70,68,70,55,7,117,110,105,
+70,68,70,56,7,117,110,105,70,68,70,57,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,
+0,0,12,1,144,23,36,24,138,0,2,0,64,0,7,0,7,0,1,0,13,0,13,0,1,0,16,0,17,0,
+1,0,18,0,28,0,3,0,32,0,74,0,1,0,75,0,81,0,3,0,83,0,95,0,3,0,110,0,111,0,1,
+0,112,0,112,0,3,0,113,0,115,0,1,0,117,0,211,0,1,0,213,0,213,0,1,0,214,0,220,
+0,3,0,221,0,221,0,1,0,223,0,228,0,3,0,229,0,230,0,1,0,231,0,232,0,3,0,234,
+0,237,0,3,0,238,0,239,0,1,0,250,0,252,0,1,0,255,1,47,0,1,1,53,1,119,0,1,1,
+136,1,152,0,1,1,170,1,250,0,1,1,251,2,2,0,2,2,4,2,6,0,1,2,8,2,15,0,1,2,16,
+2,16,0,3,2,17,2,18,0,2,2,20,2,21,0,1,2,24,2,39,0,3,2,42,2,157,0,1,2,158,2,
+171,0,2,2,172,3,9,0,1,3,10,3,11,0,2,3,14,3,15,0,1,3,18,3,19,0,1,3,20,3,20,
+0,3,3,22,3,83,0,1,3,101,3,102,0,1,3,116,3,116,0,3,3,119,3,159,0,1,3,160,3,
+186,0,3,3,190,3,204,0,3,3,209,3,209,0,2,3,210,3,210,0,3,3,213,3,213,0,1,3,
+214,3,215,0,2,3,216,3,217,0,1,3,218,3,220,0,2,3,221,3,221,0,1,3,222,3,223,
+0,2,3,224,3,225,0,1,3,226,3,227,0,2,3,228,3,229,0,1,3,230,3,232,0,2,3,233,
+3,234,0,1,3,235,3,236,0,2,3,237,4,7,0,1,4,9,4,9,0,1,5,205,5,205,0,1,5,219,
+5,228,0,3,5,237,5,238,0,3,5,239,5,239,0,1,6,254,3,125,7,248,7,254,11,136,
+11,118,19,232,19,172,8,4,9,240,19,232,20,106,8,136,9,240,8,136,8,10,12,186,
+8,16,8,22,13,200,8,28,8,34,8,178,8,40,9,156,17,34,20,248,10,182,10,182,12,
+144,9,132,8,106,10,62,8,46,8,52,8,58,8,64,8,70,12,84,12,102,10,182,8,76,10,
+86,8,82,15,252,8,88,19,106,10,8,8,94,21,4,8,100,19,82,20,0,8,106,9,222,13,
+98,12,180,9,198,8,124,8,112,13,158,19,220,21,100,19,220,8,118,8,124,20,24,
+20,24,8,154,19,202,8,130,8,136,8,142,21,142,8,148,19,202,10,62,15,18,9,210,
+15,84,8,154,8,160,8,166,8,172,8,178,13,116,13,116,12,180,11,94,17,34,8,184,
+8,190,8,196,8,202,14,22,11,88,11,202,19,4,10,182,10,182,11,160,10,182,10,
+182,9,138,8,208,8,214,8,220,8,226,8,232,9,144,8,238,8,244,8,250,16,74,9,0,
+9,6,9,12,9,12,11,10,9,18,11,22,9,24,9,30,9,36,9,42,9,48,18,56,11,160,15,18,
+9,54,21,40,9,60,9,66,9,72,19,166,18,62,10,86,15,84,10,86,9,78,9,84,9,90,9,
+108,9,96,9,108,9,102,9,102,9,108,9,120,9,114,9,120,17,40,9,126,9,132,9,138,
+11,16,9,144,13,116,10,146,9,150,9,222,9,150,9,156,13,98,9,162,13,218,9,168,
+9,174,9,180,16,248,16,26,12,180,21,58,9,186,9,192,9,198,9,204,9,210,9,216,
+9,222,9,228,20,124,10,206,19,232,15,18,21,142,11,178,10,206,9,234,9,240,9,
+240,13,110,9,246,21,100,9,252,20,106,10,2,19,220,19,220,10,8,11,136,10,14,
+10,20,10,26,19,76,12,144,17,198,10,38,10,32,10,38,10,44,14,166,18,236,13,
+254,19,4,10,182,10,50,10,56,10,62,10,68,19,4,11,172,19,4,10,74,10,80,10,86,
+10,86,13,200,10,92,10,98,10,104,10,110,10,116,19,82,11,10,10,122,10,128,10,
+182,10,182,10,134,10,140,10,146,10,152,10,158,19,106,10,164,10,170,13,116,
+13,116,20,248,10,176,10,182,10,188,10,194,10,200,10,206,10,212,10,218,10,
+224,10,230,10,236,10,242,10,248,10,254,11,4,18,98,11,238,11,10,11,250,11,
+16,11,22,13,248,11,28,11,34,11,88,11,40,19,100,11,160,11,46,11,52,11,58,18,
+200,11,64,11,70,18,200,11,64,11,70,18,200,11,76,11,82,18,200,18,134,18,140,
+12,210,11,250,18,236,11,88,20,248,11,94,17,180,18,188,18,194,14,220,14,226,
+14,208,14,214,14,220,14,226,18,188,11,100,11,106,11,112,13,18,11,118,11,124,
+12,180,11,130,11,136,11,142,11,148,18,188,18,194,11,154,11,160,11,166,11,
+172,11,178,11,184,12,198,12,204,12,210,13,12,13,30,12,192,12,204,12,210,11,
+190,11,196,11,202,11,208,13,164,18,224,18,218,13,158,11,214,11,220,11,226,
+11,232,11,238,11,244,11,250,12,0,18,110,18,236,18,200,12,6,12,12,18,200,12,
+18,13,0,12,24,12,30,14,166,13,36,12,36,21,100,20,242,12,42,12,48,12,54,12,
+60,12,66,12,72,12,78,12,84,12,90,12,96,12,102,12,108,12,114,19,88,12,114,
+12,120,14,232,12,120,12,126,13,54,15,84,19,154,12,138,19,166,12,132,12,138,
+12,144,16,92,16,152,19,4,12,150,18,188,18,194,19,88,19,94,20,24,12,180,12,
+156,12,192,12,162,12,168,12,174,17,138,12,180,12,186,19,232,12,192,12,198,
+12,204,12,210,12,216,12,226,15,154,15,164,12,236,12,246,17,118,17,128,13,
+0,13,6,13,158,13,12,13,18,13,24,13,30,13,36,13,42,13,48,13,54,13,60,13,66,
+13,76,13,86,13,92,21,142,20,236,13,98,13,116,13,122,13,104,13,110,20,100,
+13,116,13,122,13,128,13,134,13,134,13,140,19,244,19,232,13,146,13,152,13,
+158,18,104,18,104,13,164,13,170,13,176,13,182,13,188,15,6,13,242,13,194,13,
+200,13,206,19,10,16,86,16,92,13,212,13,218,14,172,13,224,13,230,13,236,13,
+242,13,248,13,254,14,4,14,10,14,16,14,16,17,34,14,22,14,28,14,34,14,40,14,
+46,14,52,14,58,14,64,14,70,14,76,14,82,14,88,14,94,14,100,18,56,14,106,14,
+112,14,250,14,112,14,118,14,124,18,62,14,130,14,136,14,142,14,148,15,108,
+14,154,16,62,16,38,14,160,14,166,14,172,14,178,19,88,14,184,17,180,18,188,
+18,194,14,190,18,188,18,194,14,196,17,192,21,28,14,202,14,226,14,208,14,214,
+14,220,14,226,14,250,15,0,15,6,14,232,14,238,14,244,14,250,15,0,15,6,15,12,
+15,18,15,24,15,30,15,36,15,42,15,48,15,54,15,60,15,66,18,26,15,72,15,78,19,
+232,15,84,15,90,15,96,15,102,15,108,19,46,19,154,15,114,15,124,15,134,15,
+144,15,154,15,164,15,194,15,204,15,174,15,184,15,194,15,204,15,214,15,224,
+15,234,15,240,15,246,15,252,16,2,16,38,16,8,16,14,16,20,16,26,16,32,16,38,
+16,44,16,50,16,56,16,92,16,62,17,204,19,160,19,166,18,242,18,248,18,254,16,
+68,16,74,16,80,19,10,16,86,16,92,18,200,16,98,21,28,18,140,18,254,16,104,
+16,110,16,116,16,122,16,146,16,152,21,4,16,128,16,134,16,140,16,146,16,152,
+21,4,16,158,16,164,16,170,16,176,16,182,16,188,17,180,18,188,18,194,17,180,
+18,188,18,194,16,194,16,200,19,142,16,206,16,212,16,218,16,224,16,230,16,
+236,16,242,19,160,16,248,16,254,17,4,17,10,17,16,17,22,17,28,19,88,19,94,
+20,24,17,34,17,40,17,46,17,52,17,58,17,64,17,70,17,76,17,82,17,88,17,94,17,
+100,17,106,17,112,17,118,17,128,17,138,17,144,17,150,17,156,20,230,17,162,
+17,168,17,174,17,180,18,188,18,194,17,186,17,192,21,28,17,198,17,204,17,210,
+17,216,17,222,17,228,19,118,17,234,17,240,18,200,17,246,17,252,18,2,18,8,
+18,14,18,20,18,26,18,32,18,38,18,44,18,50,19,118,18,56,18,62,18,68,18,74,
+18,80,18,86,18,92,18,98,18,104,18,104,18,110,18,236,18,254,18,116,18,122,
+18,128,18,200,18,134,18,140,18,146,18,152,18,158,18,164,18,170,18,176,18,
+182,18,188,18,194,18,200,18,206,18,212,18,218,18,224,18,230,18,236,18,242,
+18,248,18,254,19,4,19,10,19,16,19,64,19,22,19,34,19,28,19,34,21,46,19,40,
+19,46,19,52,19,58,19,64,19,70,19,76,19,82,19,88,19,94,20,24,19,100,19,106,
+19,112,19,118,19,124,19,130,19,136,19,142,19,148,19,154,19,160,19,166,19,
+172,19,178,19,184,19,190,19,196,19,202,20,6,19,202,19,214,19,208,19,214,19,
+220,19,226,19,232,19,220,19,226,19,232,19,238,19,244,19,250,20,0,20,6,20,
+12,20,18,20,106,20,36,20,24,20,36,20,30,20,30,20,36,21,100,20,42,20,46,20,
+50,20,54,21,126,20,58,21,106,20,78,20,78,20,62,20,66,20,70,20,74,20,78,20,
+82,20,86,20,100,21,122,20,106,20,112,20,120,20,124,20,130,20,138,20,148,20,
+152,20,158,20,166,20,170,20,176,20,184,20,188,20,194,20,202,20,212,20,216,
+20,222,21,100,20,230,21,58,20,236,20,248,20,242,20,248,21,100,20,254,21,4,
+21,10,21,16,21,22,21,28,21,34,21,46,21,40,21,46,21,52,21,58,21,88,21,64,21,
+70,21,76,21,82,21,88,21,94,21,100,21,106,21,110,21,114,21,138,21,118,21,122,
+21,126,21,130,21,134,21,138,21,142,21,142,0,2,0,41,0,13,0,13,0,0,0,17,0,28,
+0,1,0,32,0,81,0,13,0,83,0,95,0,63,0,110,0,115,0,76,0,117,0,211,0,82,0,213,
+0,220,0,177,0,223,0,232,0,185,0,234,0,239,0,195,0,250,0,252,0,201,0,255,1,
+47,0,204,1,53,1,101,0,253,1,103,1,104,1,46,1,106,1,107,1,48,1,109,1,119,1,
+50,1,136,1,152,1,61,1,170,2,2,1,78,2,4,2,6,1,167,2,8,2,18,1,170,2,20,2,21,
+1,181,2,24,2,39,1,183,2,42,2,120,1,199,2,122,2,123,2,22,2,125,2,126,2,24,
+2,128,3,11,2,26,3,14,3,15,2,166,3,18,3,20,2,168,3,22,3,83,2,171,3,101,3,102,
+2,233,3,116,3,116,2,235,3,119,3,186,2,236,3,190,3,204,3,48,3,209,3,210,3,
+63,3,213,3,215,3,65,3,217,3,223,3,68,3,225,3,227,3,75,3,229,3,232,3,78,3,
+234,4,7,3,82,4,9,4,9,3,112,5,219,5,228,3,113,5,237,5,238,3,123,0,2,0,51,0,
+66,0,2,0,67,0,69,0,2,0,24,0,25,0,2,0,46,0,81,0,2,0,18,0,36,0,2,0,18,0,47,
+0,2,0,17,0,47,0,2,0,48,0,78,0,2,0,33,0,46,0,2,0,27,0,37,0,2,0,68,0,70,0,2,
+0,70,0,95,0,2,0,53,0,55,0,2,0,55,0,65,0,2,0,47,0,56,0,2,0,43,0,72,0,2,0,48,
+0,66,0,2,0,44,0,55,0,2,0,32,0,75,0,2,0,30,0,40,0,2,0,48,0,49,0,2,0,38,0,39,
+0,2,0,16,0,17,0,2,0,15,0,16,0,2,0,9,0,10,0,2,0,23,0,24,0,2,0,0,0,13,0,2,0,
+13,0,14,0,2,0,18,0,53,0,2,0,18,0,62,0,2,0,17,0,64,0,2,0,17,0,18,0,2,0,33,
+0,54,0,2,0,68,0,87,0,2,0,35,0,61,0,2,0,33,0,61,0,2,0,28,0,63,0,2,0,28,0,41,
+0,2,0,41,0,78,0,2,0,30,0,48,0,2,0,28,0,49,0,2,0,30,0,56,0,2,0,30,0,63,0,2,
+0,27,0,63,0,2,0,26,0,60,0,2,0,26,0,38,0,2,0,26,0,50,0,2,0,27,0,52,0,2,0,80,
+0,91,0,2,0,68,0,96,0,2,0,95,0,121,0,2,0,53,0,74,0,2,0,55,0,80,0,2,0,45,0,
+56,0,2,0,44,0,70,0,2,0,45,0,71,0,2,0,44,0,78,0,2,0,32,0,85,0,2,0,32,0,100,
+0,2,0,75,0,101,0,2,0,46,0,94,0,2,0,61,0,80,0,2,0,46,0,61,0,2,0,38,0,48,0,
+2,0,38,0,63,0,2,0,40,0,51,0,2,0,28,0,30,0,2,0,30,0,66,0,2,0,30,0,55,0,2,0,
+34,0,64,0,2,0,34,0,52,0,2,0,56,0,57,0,2,0,43,0,80,0,2,0,43,0,59,0,2,0,43,
+0,67,0,2,0,48,0,72,0,2,0,43,0,54,0,2,0,46,0,67,0,2,0,46,0,74,0,2,0,33,0,35,
+0,2,0,35,0,65,0,2,0,32,0,34,0,2,0,71,0,72,0,2,0,0,0,21,0,2,0,31,0,32,0,2,
+0,19,0,20,0,2,0,29,0,30,0,2,0,32,0,33,0,2,0,12,0,13,0,2,0,30,0,53,0,2,0,27,
+0,50,0,2,0,95,0,106,0,2,0,46,0,72,0,2,0,33,0,62,0,2,0,62,0,80,0,2,0,66,0,
+87,0,2,0,28,0,53,0,2,0,26,0,27,0,2,0,70,0,103,0,2,0,45,0,64,0,2,0,45,0,72,
+0,2,0,43,0,46,0,2,0,37,0,47,0,2,0,36,0,48,0,2,0,40,0,59,0,2,0,30,0,76,0,2,
+0,30,0,64,0,2,0,27,0,56,0,2,0,70,0,88,0,2,0,70,0,120,0,2,0,27,0,77,0,2,0,
+47,0,83,0,2,0,17,0,42,0,2,0,17,0,62,0,2,0,48,0,93,0,2,0,46,0,82,0,2,0,35,
+0,80,0,2,0,44,0,47,0,2,0,70,0,105,0,2,0,70,0,93,0,2,0,32,0,90,0,2,0,0,0,1,
+0,2,0,19,0,54,0,2,0,39,0,59,0,2,0,24,0,45,0,2,0,30,0,51,0,2,0,39,0,66,0,2,
+0,25,0,53,0,2,0,31,0,59,0,2,0,39,0,74,0,2,0,25,0,61,0,2,0,27,0,45,0,2,0,40,
+0,73,0,2,0,27,0,60,0,2,0,40,0,76,0,2,0,26,0,62,0,2,0,53,0,78,0,2,0,53,0,86,
+0,2,0,37,0,70,0,2,0,47,0,80,0,2,0,41,0,62,0,2,0,52,0,73,0,2,0,41,0,69,0,2,
+0,52,0,80,0,2,0,33,0,69,0,2,0,35,0,71,0,2,0,39,0,75,0,2,0,37,0,67,0,2,0,22,
+0,24,0,2,0,41,0,42,0,2,0,103,0,105,0,2,0,100,0,102,0,2,0,30,0,31,0,2,0,31,
+0,61,0,2,0,37,0,105,0,2,0,47,0,84,0,2,0,47,0,72,0,2,0,47,0,63,0,2,0,47,0,
+73,0,2,0,60,0,61,0,2,0,47,0,71,0,2,0,19,0,37,0,2,0,19,0,48,0,2,0,47,0,77,
+0,2,0,18,0,48,0,2,0,39,0,51,0,2,0,24,0,37,0,2,0,30,0,43,0,2,0,37,0,55,0,2,
+0,40,0,58,0,2,0,26,0,44,0,2,0,33,0,51,0,2,0,40,0,65,0,2,0,41,0,54,0,2,0,52,
+0,65,0,2,0,41,0,43,0,2,0,57,0,67,0,2,0,43,0,53,0,2,0,33,0,43,0,2,0,79,0,81,
+0,2,0,62,0,64,0,2,0,74,0,76,0,2,0,81,0,106,0,2,0,64,0,89,0,2,0,76,0,101,0,
+2,0,64,0,66,0,2,0,43,0,45,0,2,0,54,0,56,0,2,0,66,0,76,0,2,0,45,0,55,0,2,0,
+56,0,66,0,2,0,58,0,60,0,2,0,60,0,70,0,2,0,61,0,63,0,2,0,53,0,63,0,2,0,41,
+0,51,0,2,0,47,0,57,0,2,0,37,0,80,0,2,0,34,0,36,0,2,0,39,0,49,0,2,0,26,0,36,
+0,2,0,32,0,42,0,2,0,46,0,48,0,2,0,62,0,63,0,2,0,42,0,44,0,2,0,42,0,63,0,2,
+0,25,0,46,0,2,0,31,0,52,0,4,0,53,0,55,0,56,0,74,0,4,0,46,0,48,0,49,0,67,0,
+4,0,53,0,54,0,55,0,85,0,4,0,46,0,47,0,48,0,78,0,2,0,52,0,54,0,2,0,0,0,17,
+0,2,0,24,0,26,0,2,0,39,0,40,0,2,0,25,0,27,0,2,0,30,0,32,0,2,0,31,0,33,0,2,
+0,45,0,47,0,2,0,51,0,53,0,2,0,39,0,41,0,2,0,33,0,34,0,4,0,53,0,55,0,56,0,
+91,0,4,0,46,0,48,0,49,0,84,0,2,0,24,0,42,0,2,0,24,0,54,0,2,0,42,0,43,0,2,
+0,73,0,74,0,2,0,57,0,58,0,2,0,43,0,44,0,2,0,35,0,36,0,2,0,87,0,88,0,2,0,53,
+0,54,0,2,0,45,0,46,0,2,0,19,0,63,0,2,0,18,0,65,0,2,0,18,0,19,0,2,0,44,0,74,
+0,2,0,58,0,92,0,2,0,59,0,78,0,2,0,51,0,85,0,2,0,40,0,66,0,2,0,57,0,87,0,2,
+0,43,0,73,0,2,0,54,0,84,0,2,0,57,0,82,0,2,0,43,0,68,0,2,0,31,0,66,0,2,0,31,
+0,44,0,2,0,44,0,81,0,2,0,33,0,59,0,2,0,33,0,66,0,2,0,35,0,59,0,2,0,34,0,68,
+0,2,0,34,0,46,0,2,0,34,0,58,0,2,0,35,0,68,0,2,0,91,0,102,0,2,0,74,0,85,0,
+2,0,86,0,97,0,2,0,79,0,107,0,2,0,62,0,90,0,2,0,74,0,102,0,2,0,106,0,132,0,
+2,0,89,0,115,0,2,0,101,0,127,0,2,0,64,0,85,0,2,0,43,0,64,0,2,0,54,0,75,0,
+2,0,66,0,91,0,2,0,56,0,81,0,2,0,60,0,85,0,2,0,63,0,88,0,2,0,41,0,66,0,2,0,
+51,0,64,0,2,0,39,0,52,0,2,0,45,0,58,0,2,0,63,0,74,0,2,0,57,0,68,0,2,0,45,
+0,73,0,2,0,54,0,64,0,2,0,54,0,79,0,2,0,60,0,62,0,2,0,55,0,57,0,2,0,37,0,90,
+0,2,0,80,0,106,0,2,0,61,0,111,0,2,0,78,0,97,0,2,0,54,0,73,0,2,0,61,0,78,0,
+2,0,39,0,54,0,2,0,49,0,59,0,2,0,22,0,32,0,2,0,27,0,38,0,2,0,49,0,74,0,2,0,
+22,0,47,0,2,0,27,0,53,0,2,0,47,0,75,0,2,0,44,0,45,0,2,0,28,0,54,0,2,0,50,
+0,61,0,2,0,36,0,47,0,2,0,42,0,53,0,2,0,49,0,82,0,2,0,36,0,69,0,2,0,65,0,75,
+0,2,0,39,0,64,0,2,0,53,0,79,0,2,0,64,0,90,0,2,0,50,0,52,0,2,0,55,0,66,0,2,
+0,67,0,78,0,2,0,77,0,88,0,2,0,51,0,62,0,4,0,53,0,55,0,56,0,100,0,4,0,46,0,
+48,0,49,0,93,0,4,0,53,0,54,0,55,0,102,0,4,0,46,0,47,0,48,0,95,0,4,0,53,0,
+55,0,56,0,85,0,4,0,46,0,48,0,49,0,78,0,4,0,54,0,55,0,56,0,66,0,4,0,47,0,48,
+0,49,0,59,0,4,0,54,0,55,0,56,0,81,0,4,0,47,0,48,0,49,0,74,0,4,0,53,0,54,0,
+56,0,82,0,4,0,46,0,47,0,49,0,75,0,2,0,33,0,56,0,2,0,35,0,58,0,2,0,105,0,128,
+0,2,0,48,0,71,0,2,0,102,0,125,0,2,0,27,0,55,0,2,0,34,0,62,0,2,0,37,0,63,0,
+2,0,43,0,69,0,2,0,51,0,77,0,2,0,39,0,67,0,2,0,25,0,54,0,2,0,31,0,60,0,2,0,
+67,0,85,0,2,0,51,0,79,0,2,0,40,0,64,0,2,0,27,0,51,0,2,0,33,0,57,0,2,0,43,
+0,61,0,2,0,54,0,72,0,2,0,41,0,70,0,2,0,40,0,41,0,2,0,81,0,114,0,2,0,64,0,
+97,0,2,0,76,0,109,0,2,0,63,0,89,0,2,0,41,0,67,0,2,0,52,0,78,0,2,0,63,0,81,
+0,2,0,41,0,59,0,2,0,51,0,72,0,2,0,39,0,60,0,2,0,45,0,66,0,2,0,51,0,80,0,2,
+0,39,0,68,0,2,0,45,0,74,0,2,0,59,0,88,0,2,0,37,0,66,0,2,0,48,0,58,0,2,0,36,
+0,46,0,2,0,44,0,54,0,2,0,46,0,59,0,2,0,34,0,47,0,2,0,42,0,55,0,2,0,58,0,68,
+0,2,0,43,0,62,0,2,0,39,0,85,0,2,0,23,0,69,0,2,0,32,0,78,0,2,0,39,0,73,0,2,
+0,23,0,57,0,2,0,32,0,66,0,2,0,35,0,53,0,2,0,35,0,64,0,2,0,81,0,99,0,2,0,64,
+0,82,0,2,0,76,0,94,0,2,0,47,0,66,0,2,0,47,0,58,0,2,0,46,0,70,0,2,0,57,0,76,
+0,2,0,44,0,68,0,2,0,42,0,70,0,2,0,89,0,100,0,2,0,101,0,112,0,2,0,106,0,117,
+0,4,0,53,0,54,0,55,0,56,0,4,0,46,0,47,0,48,0,49,0,2,0,35,0,37,0,2,0,21,0,
+23,0,2,0,39,0,70,0,2,0,42,0,72,0,2,0,42,0,77,0,2,0,24,0,59,0,2,0,30,0,65,
+0,2,0,59,0,61,0,2,0,59,0,87,0,2,0,37,0,65,0,2,0,44,0,67,0,2,0,50,0,69,0,2,
+0,56,0,75,0,2,0,44,0,62,0,2,0,44,0,64,0,2,0,51,0,71,0,2,0,51,0,70,0,2,0,58,
+0,77,0,2,0,41,0,94,0,2,0,52,0,105,0,2,0,81,0,131,0,2,0,64,0,114,0,2,0,76,
+0,126,0,2,0,35,0,85,0,2,0,57,0,93,0,2,0,43,0,79,0,2,0,54,0,90,0,2,0,19,0,
+44,0,2,0,19,0,64,0,2,0,45,0,70,0,2,0,52,0,77,0,2,0,44,0,89,0,2,0,45,0,90,
+0,2,0,52,0,97,0,2,0,42,0,78,0,2,0,24,0,60,0,2,0,31,0,67,0,2,0,47,0,48,0,2,
+0,26,0,51,0,2,0,26,0,71,0,2,0,33,0,78,0,2,0,31,0,76,0,2,0,41,0,77,0,2,0,52,
+0,88,0,2,0,81,0,116,0,2,0,64,0,99,0,2,0,76,0,111,0,2,0,81,0,104,0,2,0,64,
+0,87,0,2,0,76,0,99,0,2,0,37,0,95,0,2,0,37,0,39,0,2,0,52,0,55,0,2,0,54,0,57,
+0,2,0,41,0,81,0,2,0,52,0,92,0,2,0,32,0,62,0,2,0,26,0,56,0,2,0,25,0,26,0,2,
+0,33,0,58,0,2,0,39,0,63,0,2,0,25,0,50,0,2,0,31,0,56,0,2,0,47,0,65,0,2,0,57,
+0,75,0,2,0,61,0,73,0,2,0,45,0,63,0,2,0,49,0,67,0,2,0,60,0,78,0,2,0,78,0,89,
+0,2,0,62,0,73,0,2,0,72,0,83,0,2,0,70,0,82,0,2,0,72,0,84,0,2,0,59,0,70,0,2,
+0,65,0,76,0,2,0,35,0,38,0,2,0,47,0,49,0,2,0,20,0,22,0,2,0,37,0,62,0,2,0,48,
+0,73,0,2,0,36,0,61,0,2,0,44,0,69,0,2,0,67,0,97,0,2,0,63,0,93,0,2,0,46,0,76,
+0,2,0,52,0,82,0,2,0,67,0,77,0,2,0,63,0,73,0,2,0,46,0,56,0,2,0,52,0,62,0,2,
+0,59,0,60,0,2,0,65,0,66,0,2,0,61,0,62,0,2,0,63,0,64,0,2,0,74,0,94,0,2,0,37,
+0,38,0,2,0,58,0,117,0,2,0,38,0,76,0,2,0,8,0,9,0,2,0,14,0,15,0,2,0,46,0,47,
+0,2,0,11,0,22,0,2,0,74,0,75,0,2,0,9,0,21,0,2,0,36,0,37,0,2,0,58,0,59,0,2,
+0,9,0,22,0,2,0,8,0,23,0,2,0,27,0,28,0,2,0,28,0,60,0,2,0,27,0,30,0,1,0,10,
+0,1,0,17,0,1,0,44,0,1,0,65,0,1,0,27,0,1,0,43,0,1,0,60,0,1,0,53,0,1,0,49,0,
+1,0,33,0,1,0,29,0,6,0,62,0,63,0,64,0,65,0,66,0,67,0,2,0,50,0,51,0,2,0,28,
+0,29,0,3,0,30,0,31,0,32,0,1,0,72,0,2,0,75,0,76,0,3,0,72,0,73,0,74,0,4,0,75,
+0,76,0,77,0,78,0,1,0,56,0,2,0,54,0,55,0,3,0,56,0,57,0,58,0,1,0,74,0,2,0,76,
+0,77,0,3,0,74,0,75,0,78,0,1,0,126,0,2,0,125,0,127,0,3,0,124,0,126,0,128,0,
+4,0,123,0,125,0,127,0,129,0,1,1,4,0,2,1,7,1,8,0,3,1,4,1,5,1,6,0,2,0,51,0,
+52,0,2,0,21,0,22,0,2,0,35,0,45,0,2,0,35,0,60,0,2,0,34,0,61,0,2,0,52,0,70,
+0,2,0,52,0,96,0,2,0,51,0,98,0,2,0,52,0,87,0,2,0,52,0,81,0,2,0,51,0,81,0,2,
+0,56,0,67,0,2,0,56,0,82,0,2,0,55,0,83,0,2,0,55,0,56,0,2,0,22,0,66,0,2,0,21,
+0,68,0,2,0,22,0,57,0,2,0,22,0,51,0,2,0,22,0,40,0,2,0,21,0,51,0,2,0,34,0,35,
+0,1,0,22,0,1,0,11,0,1,0,25,0,1,0,18,0,1,0,31,0,1,0,35,0,1,0,7,0,1,0,46,0,
+1,0,34,0,2,0,22,0,23,0,86,0,41,0,164,0,172,0,164,0,172,0,164,0,172,0,164,
+0,172,0,164,0,172,0,164,0,172,0,164,0,172,0,164,0,172,0,164,0,172,0,164,0,
+172,0,164,0,172,0,156,0,172,0,164,0,172,0,180,0,194,0,202,0,216,0,220,0,234,
+0,254,1,6,1,20,1,28,1,42,1,46,1,60,1,80,1,88,0,2,0,11,1,251,2,2,0,0,2,17,
+2,18,0,8,2,158,2,171,0,10,3,10,3,11,0,24,3,209,3,209,0,26,3,214,3,215,0,27,
+3,218,3,220,0,29,3,222,3,223,0,32,3,226,3,227,0,34,3,230,3,232,0,36,3,235,
+3,236,0,39,0,1,0,4,0,1,2,21,0,1,0,4,0,1,2,18,0,1,0,4,0,1,2,112,0,2,0,6,0,
+10,0,1,5,20,0,1,2,138,0,1,0,4,0,1,4,153,0,2,0,6,0,10,0,1,3,17,0,1,6,34,0,
+1,0,30,0,2,0,6,0,10,0,1,4,114,0,1,8,228,0,3,0,8,0,12,0,16,0,1,3,85,0,1,6,
+171,0,1,10,0,0,1,0,4,0,1,4,226,0,2,0,6,0,10,0,1,3,65,0,1,6,131,0,1,0,4,0,
+1,4,109,0,2,0,6,0,10,0,1,2,243,0,1,5,231,0,1,0,30,0,2,0,6,0,10,0,1,5,59,0,
+1,10,118,0,3,0,8,0,12,0,16,0,1,3,236,0,1,7,216,0,1,11,196,0,1,0,4,0,1,4,221,
+0,2,0,6,0,10,0,1,3,62,0,1,6,124,0,2,0,45,0,18,0,27,0,1,0,28,0,28,0,2,0,75,
+0,76,0,1,0,77,0,77,0,2,0,78,0,79,0,1,0,80,0,80,0,2,0,81,0,81,0,1,0,83,0,84,
+0,1,0,85,0,86,0,2,0,87,0,91,0,1,0,92,0,92,0,2,0,93,0,94,0,1,0,95,0,95,0,2,
+0,112,0,112,0,1,0,214,0,220,0,1,0,223,0,226,0,1,0,227,0,227,0,2,0,228,0,228,
+0,1,0,231,0,232,0,1,0,234,0,234,0,2,0,235,0,236,0,1,0,237,0,237,0,2,2,16,
+2,16,0,1,2,24,2,31,0,1,2,32,2,33,0,2,2,34,2,39,0,1,3,20,3,20,0,1,3,116,3,
+116,0,1,3,160,3,161,0,1,3,162,3,162,0,2,3,163,3,164,0,1,3,165,3,165,0,2,3,
+166,3,168,0,1,3,169,3,171,0,2,3,172,3,173,0,1,3,174,3,174,0,2,3,175,3,177,
+0,1,3,178,3,178,0,2,3,179,3,180,0,1,3,181,3,182,0,2,3,183,3,186,0,1,3,190,
+3,204,0,3,3,210,3,210,0,1,5,219,5,228,0,3,5,237,5,238,0,2,0,1,0,0,0,10,0,
+32,0,70,0,1,97,114,97,98,0,8,0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,109,97,114,
+107,0,14,109,107,109,107,0,30,0,0,0,6,0,0,0,1,0,2,0,3,0,4,0,5,0,0,0,2,0,6,
+0,7,0,8,0,18,33,106,63,206,65,110,72,116,76,134,79,174,87,160,0,4,0,0,0,1,
+0,8,0,1,0,12,0,170,0,1,1,74,4,232,0,1,0,77,0,18,0,19,0,20,0,21,0,22,0,23,
+0,24,0,25,0,26,0,27,0,75,0,76,0,78,0,79,0,81,0,83,0,84,0,87,0,88,0,89,0,90,
+0,91,0,93,0,94,0,112,0,214,0,215,0,216,0,217,0,218,0,219,0,220,0,223,0,224,
+0,225,0,226,0,228,0,231,0,232,0,235,0,236,2,16,2,24,2,25,2,26,2,27,2,28,2,
+29,2,30,2,31,2,34,2,35,2,36,2,37,2,38,2,39,3,20,3,116,3,160,3,161,3,163,3,
+164,3,166,3,167,3,168,3,172,3,173,3,175,3,176,3,177,3,179,3,180,3,183,3,184,
+3,185,3,186,3,210,0,2,0,26,0,13,0,13,0,0,0,17,0,17,0,1,0,32,0,74,0,2,0,110,
+0,111,0,45,0,113,0,115,0,47,0,117,0,211,0,50,0,213,0,213,0,145,0,229,0,230,
+0,146,0,238,0,239,0,148,0,250,0,252,0,150,0,255,1,47,0,153,1,53,1,119,0,202,
+1,136,1,152,1,13,1,170,1,250,1,30,2,4,2,6,1,111,2,8,2,15,1,114,2,20,2,21,
+1,122,2,42,2,157,1,124,2,172,3,9,1,240,3,14,3,15,2,78,3,18,3,19,2,80,3,22,
+3,83,2,82,3,101,3,102,2,144,3,119,3,159,2,146,3,237,4,7,2,187,4,9,4,9,2,214,
+0,77,0,0,1,54,0,0,1,62,0,0,1,70,0,0,1,78,0,0,1,86,0,0,1,94,0,0,1,102,0,0,
+1,110,0,0,1,118,0,0,1,126,0,0,1,134,0,0,1,142,0,0,1,150,0,0,1,158,0,0,1,166,
+0,0,1,174,0,0,1,182,0,0,1,190,0,0,1,198,0,0,1,206,0,0,1,214,0,0,1,222,0,0,
+1,230,0,0,1,238,0,0,1,246,0,0,1,254,0,0,2,6,0,0,2,14,0,0,2,22,0,0,2,30,0,
+0,2,38,0,0,2,46,0,0,2,54,0,0,2,62,0,0,2,70,0,0,2,78,0,0,2,86,0,0,2,94,0,0,
+2,102,0,0,2,110,0,0,2,118,0,0,2,126,0,0,2,134,0,0,2,142,0,0,2,150,0,0,2,158,
+0,0,2,166,0,0,2,174,0,0,2,182,0,0,2,190,0,0,2,198,0,0,2,206,0,0,2,214,0,0,
+2,222,0,0,2,230,0,0,2,238,0,0,2,246,0,0,2,254,0,0,3,6,0,0,3,14,0,0,3,22,0,
+0,3,30,0,0,3,38,0,0,3,46,0,0,3,54,0,0,3,62,0,0,3,70,0,0,3,78,0,0,3,86,0,0,
+3,94,0,0,3,102,0,0,3,110,0,0,3,118,0,0,3,126,0,0,3,134,0,0,3,142,0,0,3,150,
+0,2,0,203,3,192,0,30,0,2,0,186,3,192,0,41,0,2,0,57,3,232,0,46,0,2,0,79,3,
+157,0,59,0,2,0,91,4,2,0,24,0,2,0,98,3,108,0,31,0,2,0,0,3,213,0,46,0,2,0,0,
+3,68,0,28,0,2,0,0,3,148,0,9,0,2,0,0,3,129,0,31,0,2,0,175,3,154,0,16,0,2,0,
+185,3,125,0,48,0,2,0,184,3,157,0,8,0,2,0,152,3,121,0,34,0,2,0,141,3,129,0,
+38,0,2,0,138,4,107,0,16,0,2,0,136,4,33,0,27,0,2,0,153,3,167,0,37,0,2,0,188,
+4,9,0,15,0,2,1,0,3,159,0,9,0,2,1,26,2,121,0,23,0,2,0,243,2,164,0,22,0,2,0,
+162,3,204,0,37,0,2,0,212,3,230,0,26,0,2,0,22,3,70,0,13,0,2,0,19,3,213,0,71,
+0,2,0,0,3,213,0,75,0,2,255,254,3,132,0,0,0,2,0,0,3,165,0,46,0,2,0,0,3,1,0,
+44,0,2,0,0,2,49,0,22,0,2,0,153,3,97,0,60,0,2,0,0,3,138,0,0,0,2,0,0,3,58,0,
+0,0,2,0,0,3,137,0,31,0,2,0,30,3,57,0,31,0,2,0,0,3,184,0,20,0,2,255,244,3,
+129,0,28,0,2,255,237,3,72,0,32,0,2,0,0,3,159,0,8,0,2,0,0,3,112,0,12,0,2,0,
+90,4,60,0,33,0,2,1,81,3,10,0,22,0,2,1,20,3,2,0,21,0,2,0,99,4,2,0,42,0,2,0,
+115,4,16,0,43,0,2,0,117,4,16,0,35,0,2,0,120,4,16,0,73,0,2,0,120,4,16,0,57,
+0,2,0,122,4,35,0,50,0,2,0,134,3,139,0,87,0,2,0,180,2,135,0,53,0,2,0,136,3,
+146,0,53,0,2,0,136,3,137,0,45,0,2,0,133,3,146,0,74,0,2,0,142,2,233,0,46,0,
+2,0,148,3,150,0,51,0,2,0,136,3,152,0,25,0,2,0,96,4,122,0,38,0,2,0,170,3,100,
+0,59,0,2,0,96,4,122,0,38,0,2,0,123,5,11,0,58,0,2,0,8,4,249,0,8,0,2,0,9,5,
+17,0,15,0,2,255,248,4,60,0,47,0,2,1,28,3,157,0,11,0,2,1,96,3,101,0,75,0,2,
+255,252,3,19,0,37,0,2,0,11,3,195,0,59,0,2,255,247,3,134,0,9,0,2,255,206,3,
+79,0,29,0,2,0,0,3,124,0,30,0,2,255,214,3,91,0,60,0,2,255,214,3,91,0,60,0,
+2,0,0,3,124,0,30,0,2,0,122,3,121,0,34,0,2,4,116,4,15,0,50,2,215,5,176,5,184,
+5,192,5,200,5,208,5,216,5,224,5,232,5,240,5,248,6,0,6,8,6,16,6,24,6,32,6,
+40,6,48,6,56,6,64,6,72,6,80,6,88,6,96,6,104,6,112,6,120,6,128,6,136,6,144,
+6,152,6,160,6,168,6,176,6,184,6,192,6,200,6,208,6,216,6,224,6,232,6,240,6,
+248,7,0,7,8,7,16,7,24,7,32,7,40,7,48,7,56,7,64,7,72,7,80,7,88,7,96,7,104,
+7,112,7,120,7,128,7,136,7,144,7,152,7,160,7,168,7,176,7,184,7,192,7,200,7,
+208,7,216,7,224,7,232,7,240,7,248,8,0,8,8,8,16,8,24,8,32,8,40,8,48,8,56,8,
+64,8,72,8,80,8,88,8,96,8,104,8,112,8,120,8,128,8,136,8,144,8,152,8,160,8,
+168,8,176,8,184,8,192,8,200,8,208,8,216,8,224,8,232,8,240,8,248,9,0,9,8,9,
+16,9,24,9,32,9,40,9,48,9,56,9,64,9,72,9,80,9,88,9,96,9,104,9,112,9,120,9,
+128,9,136,9,144,9,152,9,160,9,168,9,176,9,184,9,192,9,200,9,208,9,216,9,224,
+9,232,9,240,9,248,10,0,10,8,10,16,10,24,10,32,10,40,10,48,10,56,10,64,10,
+72,10,80,10,88,10,96,10,104,10,112,10,120,10,128,10,136,10,144,10,152,10,
+160,10,168,10,176,10,184,10,192,10,200,10,208,10,216,10,224,10,232,10,240,
+10,248,11,0,11,8,11,16,11,24,11,32,11,40,11,48,11,56,11,64,11,72,11,80,11,
+88,11,96,11,104,11,112,11,120,11,128,11,136,11,144,11,152,11,160,11,168,11,
+176,11,184,11,192,11,200,11,208,11,216,11,224,11,232,11,240,11,248,12,0,12,
+8,12,16,12,24,12,32,12,40,12,48,12,56,12,64,12,72,12,80,12,88,12,96,12,104,
+12,112,12,120,12,128,12,136,12,144,12,152,12,160,12,168,12,176,12,184,12,
+192,12,200,12,208,12,216,12,224,12,232,12,240,12,248,13,0,13,8,13,16,13,24,
+13,32,13,40,13,48,13,56,13,64,13,72,13,80,13,88,13,96,13,104,13,112,13,120,
+13,128,13,136,13,144,13,152,13,160,13,168,13,176,13,184,13,192,13,200,13,
+208,13,216,13,224,13,232,13,240,13,248,14,0,14,8,14,16,14,24,14,32,14,40,
+14,48,14,56,14,64,14,72,14,80,14,88,14,96,14,104,14,112,14,120,14,128,14,
+136,14,144,14,152,14,160,14,168,14,176,14,184,14,192,14,200,14,208,14,216,
+14,224,14,232,14,240,14,248,15,0,15,8,15,16,15,24,15,32,15,40,15,48,15,56,
+15,64,15,72,15,80,15,88,15,96,15,104,15,112,15,120,15,128,15,136,15,144,15,
+152,15,160,15,168,15,176,15,184,15,192,15,200,15,208,15,216,15,224,15,232,
+15,240,15,248,16,0,16,8,16,16,16,24,16,32,16,40,16,48,16,56,16,64,16,72,16,
+80,16,88,16,96,16,104,16,112,16,120,16,128,16,136,16,144,16,152,16,160,16,
+168,16,176,16,184,16,192,16,200,16,208,16,216,16,224,16,232,16,240,16,248,
+17,0,17,8,17,16,17,24,17,32,17,40,17,48,17,56,17,64,17,72,17,80,17,88,17,
+96,17,104,17,112,17,120,17,128,17,136,17,144,17,152,17,160,17,168,17,176,
+17,184,17,192,17,200,17,208,17,216,17,224,17,232,17,240,17,248,18,0,18,8,
+18,16,18,24,18,32,18,40,18,48,18,56,18,64,18,72,18,80,18,88,18,96,18,104,
+18,112,18,120,18,128,18,136,18,144,18,152,18,160,18,168,18,176,18,184,18,
+192,18,200,18,208,18,216,18,224,18,232,18,240,18,248,19,0,19,8,19,16,19,24,
+19,32,19,40,19,48,19,56,19,64,19,72,19,80,19,88,19,96,19,104,19,112,19,120,
+19,128,19,136,19,144,19,152,19,160,19,168,19,176,19,184,19,192,19,200,19,
+208,19,216,19,224,19,232,19,240,19,248,20,0,20,8,20,16,20,24,20,32,20,40,
+20,48,20,56,20,64,20,72,20,80,20,88,20,96,20,104,20,112,20,120,20,128,20,
+136,20,144,20,152,20,160,20,168,20,176,20,184,20,192,20,200,20,208,20,216,
+20,224,20,232,20,240,20,248,21,0,21,8,21,16,21,24,21,32,21,40,21,48,21,56,
+21,64,21,72,21,80,21,88,21,96,21,104,21,112,21,120,21,128,21,136,21,144,21,
+152,21,160,21,168,21,176,21,184,21,192,21,200,21,208,21,216,21,224,21,232,
+21,240,21,248,22,0,22,8,22,16,22,24,22,32,22,40,22,48,22,56,22,64,22,72,22,
+80,22,88,22,96,22,104,22,112,22,120,22,128,22,136,22,144,22,152,22,160,22,
+168,22,176,22,184,22,192,22,200,22,208,22,216,22,224,22,232,22,240,22,248,
+23,0,23,8,23,16,23,24,23,32,23,40,23,48,23,56,23,64,23,72,23,80,23,88,23,
+96,23,104,23,112,23,120,23,128,23,136,23,144,23,152,23,160,23,168,23,176,
+23,184,23,192,23,200,23,208,23,216,23,224,23,232,23,240,23,248,24,0,24,8,
+24,16,24,24,24,32,24,40,24,48,24,56,24,64,24,72,24,80,24,88,24,96,24,104,
+24,112,24,120,24,128,24,136,24,144,24,152,24,160,24,168,24,176,24,184,24,
+192,24,200,24,208,24,216,24,224,24,232,24,240,24,248,25,0,25,8,25,16,25,24,
+25,32,25,40,25,48,25,56,25,64,25,72,25,80,25,88,25,96,25,104,25,112,25,120,
+25,128,25,136,25,144,25,152,25,160,25,168,25,176,25,184,25,192,25,200,25,
+208,25,216,25,224,25,232,25,240,25,248,26,0,26,8,26,16,26,24,26,32,26,40,
+26,48,26,56,26,64,26,72,26,80,26,88,26,96,26,104,26,112,26,120,26,128,26,
+136,26,144,26,152,26,160,26,168,26,176,26,184,26,192,26,200,26,208,26,216,
+26,224,26,232,26,240,26,248,27,0,27,8,27,16,27,24,27,32,27,40,27,48,27,56,
+27,64,27,72,27,80,27,88,27,96,27,104,27,112,27,120,27,128,27,136,27,144,27,
+152,27,160,27,168,27,176,27,184,27,192,27,200,27,208,27,216,27,224,27,232,
+27,240,27,248,28,0,28,8,28,16,28,24,28,32,28,40,28,48,28,56,28,64,28,72,28,
+80,28,88,28,96,0,2,1,192,5,123,0,51,0,2,1,211,4,166,0,67,0,2,1,164,1,237,
+0,46,0,2,1,165,2,155,0,63,0,2,0,251,6,134,0,36,0,2,0,230,7,71,0,47,0,2,1,
+249,4,161,0,73,0,2,0,250,5,194,0,17,0,2,1,131,3,174,0,78,0,2,0,250,5,194,
+0,17,0,2,2,236,3,48,0,33,0,2,1,110,4,255,0,52,0,2,2,226,4,135,0,53,0,2,2,
+236,4,224,0,60,0,2,2,188,3,112,0,44,0,2,2,188,3,112,0,44,0,2,2,184,4,209,
+0,57,0,2,1,192,3,148,0,28,0,2,1,188,4,225,0,40,0,2,1,116,3,30,0,26,0,2,1,
+112,4,127,0,37,0,2,5,133,2,164,0,68,0,2,5,132,4,85,0,95,0,2,5,193,3,63,0,
+53,0,2,5,189,4,160,0,65,0,2,4,63,3,123,0,43,0,2,4,59,4,220,0,55,0,2,1,203,
+4,27,0,44,0,2,1,203,4,27,0,56,0,2,2,216,4,154,0,43,0,2,2,216,4,154,0,43,0,
+2,1,135,3,167,0,71,0,2,1,154,3,88,0,66,0,2,1,163,3,158,0,73,0,2,0,203,3,158,
+0,12,0,2,4,189,5,158,0,55,0,2,3,28,4,115,0,70,0,2,1,217,3,88,0,75,0,2,3,50,
+5,194,0,35,0,2,1,199,3,47,0,36,0,2,2,22,3,48,0,40,0,2,1,90,3,168,0,32,0,2,
+2,13,3,28,0,42,0,2,1,164,1,237,0,46,0,2,1,164,1,237,0,46,0,2,2,236,3,48,0,
+33,0,2,3,38,3,28,0,50,0,2,1,23,6,238,0,53,0,2,1,6,7,94,0,62,0,2,0,250,5,194,
+0,17,0,2,0,250,5,194,0,17,0,2,2,2,4,150,0,44,0,2,2,2,4,150,0,44,0,2,1,164,
+1,237,0,46,0,2,3,39,5,39,0,71,0,2,2,209,5,99,0,53,0,2,2,236,3,48,0,33,0,2,
+2,226,4,135,0,87,0,2,2,226,4,246,0,61,0,2,2,236,3,48,0,33,0,2,2,233,4,236,
+0,68,0,2,2,236,3,48,0,33,0,2,2,154,5,48,0,77,0,2,2,160,5,162,0,65,0,2,2,188,
+3,112,0,44,0,2,2,188,3,112,0,44,0,2,2,187,5,33,0,72,0,2,2,188,3,112,0,44,
+0,2,2,188,3,112,0,44,0,2,2,2,5,109,0,66,0,2,1,192,3,148,0,28,0,2,1,192,3,
+148,0,28,0,2,2,1,5,109,0,78,0,2,1,182,4,235,0,48,0,2,1,192,3,148,0,28,0,2,
+1,191,5,69,0,55,0,2,1,182,5,90,0,56,0,2,1,189,5,80,0,63,0,2,1,176,4,247,0,
+63,0,2,1,93,4,213,0,51,0,2,1,116,3,30,0,26,0,2,1,116,3,30,0,26,0,2,1,116,
+3,30,0,26,0,2,1,116,3,30,0,26,0,2,1,106,4,117,0,45,0,2,1,115,4,207,0,52,0,
+2,1,114,4,219,0,60,0,2,5,129,4,5,0,80,0,2,5,133,2,164,0,68,0,2,5,132,4,85,
+0,95,0,2,5,193,3,63,0,53,0,2,5,192,4,240,0,80,0,2,4,62,5,44,0,70,0,2,1,202,
+5,204,0,72,0,2,4,193,4,61,0,45,0,2,4,193,4,61,0,45,0,2,4,189,5,158,0,67,0,
+2,4,192,5,238,0,70,0,2,4,193,4,61,0,45,0,2,4,190,5,249,0,78,0,2,3,34,4,104,
+0,62,0,2,3,37,4,185,0,77,0,2,2,216,4,154,0,43,0,2,3,25,4,118,0,50,0,2,2,216,
+4,154,0,43,0,2,1,213,4,184,0,85,0,2,1,216,5,9,0,100,0,2,1,217,3,88,0,75,0,
+2,2,158,5,44,0,61,0,2,3,190,4,205,0,94,0,2,2,154,5,44,0,61,0,2,2,158,5,44,
+0,61,0,2,2,158,5,44,0,61,0,2,2,154,5,44,0,61,0,2,3,23,7,87,0,63,0,2,3,45,
+7,35,0,48,0,2,3,49,7,115,0,63,0,2,3,50,5,194,0,35,0,2,2,22,3,48,0,40,0,2,
+2,26,1,207,0,28,0,2,2,85,3,148,0,66,0,2,2,22,3,48,0,40,0,2,2,25,3,128,0,55,
+0,2,2,36,3,219,0,43,0,2,2,184,4,209,0,83,0,2,1,57,5,106,0,64,0,2,1,90,3,168,
+0,32,0,2,1,57,5,105,0,64,0,2,1,111,4,254,0,52,0,2,2,13,3,28,0,42,0,2,2,13,
+3,28,0,56,0,2,1,246,4,211,0,68,0,2,1,235,4,174,0,80,0,2,2,9,5,48,0,59,0,2,
+1,240,4,214,0,67,0,2,2,3,4,115,0,62,0,2,2,12,4,205,0,69,0,2,1,164,1,237,0,
+46,0,2,2,245,2,131,0,55,0,2,1,141,3,164,0,72,0,2,2,9,4,125,0,54,0,2,1,164,
+1,237,0,46,0,2,1,164,1,237,0,46,0,2,1,240,2,227,0,33,0,2,1,207,4,164,0,65,
+0,2,1,90,3,168,0,32,0,2,0,207,3,133,0,35,0,2,1,98,3,133,0,30,0,2,1,163,5,
+78,0,53,0,2,1,87,4,216,0,50,0,2,5,132,4,85,0,95,0,2,5,189,4,160,0,65,0,2,
+1,199,5,124,0,57,0,2,2,7,5,150,0,67,0,2,2,236,3,48,0,33,0,2,2,235,4,225,0,
+72,0,2,2,236,3,48,0,33,0,2,2,226,4,125,0,80,0,2,2,233,4,144,0,64,0,2,2,236,
+3,48,0,33,0,2,2,213,4,231,0,59,0,2,2,178,4,198,0,65,0,2,2,188,3,112,0,44,
+0,2,2,2,5,109,0,66,0,2,1,192,3,148,0,28,0,2,1,116,3,30,0,26,0,2,5,130,4,96,
+0,103,0,2,1,193,5,114,0,65,0,2,1,194,5,225,0,73,0,2,1,175,6,77,0,65,0,2,4,
+193,4,61,0,45,0,2,4,193,4,61,0,45,0,2,2,216,4,154,0,43,0,2,2,216,4,154,0,
+43,0,2,2,216,4,154,0,43,0,2,1,195,4,144,0,47,0,2,1,199,3,47,0,36,0,2,2,22,
+3,48,0,40,0,2,2,81,5,9,0,76,0,2,1,255,4,231,0,64,0,2,3,50,5,194,0,35,0,2,
+1,88,5,80,0,45,0,2,1,96,4,163,0,56,0,2,5,105,4,214,0,88,0,2,2,188,3,112,0,
+44,0,2,2,188,3,112,0,44,0,2,5,178,5,57,0,120,0,2,1,160,5,179,0,77,0,2,2,250,
+5,73,0,83,0,2,0,103,5,185,0,42,0,2,0,120,5,186,0,62,0,2,1,227,3,183,0,73,
+0,2,1,247,3,188,0,93,0,2,1,164,1,237,0,46,0,2,2,2,4,150,0,44,0,2,2,2,4,150,
+0,44,0,2,1,102,4,150,0,60,0,2,1,121,4,151,0,80,0,2,2,188,3,112,0,44,0,2,5,
+150,4,202,0,105,0,2,5,104,4,94,0,93,0,2,1,201,4,67,0,90,0,2,2,106,3,158,0,
+48,0,2,1,6,6,238,0,54,0,2,3,60,2,112,0,39,0,2,1,28,3,98,0,24,0,2,1,47,2,54,
+0,30,0,2,3,60,2,112,0,39,0,2,1,138,3,98,0,25,0,2,1,187,2,54,0,31,0,2,3,60,
+2,112,0,39,0,2,1,138,3,98,0,25,0,2,1,187,2,54,0,31,0,2,3,32,4,161,0,58,0,
+2,1,110,5,148,0,45,0,2,1,159,4,104,0,51,0,2,3,57,4,44,0,73,0,2,1,135,5,30,
+0,60,0,2,1,184,3,242,0,66,0,2,3,119,4,73,0,76,0,2,1,89,5,59,0,62,0,2,1,246,
+4,15,0,69,0,2,4,244,5,54,0,78,0,2,1,123,5,75,0,62,0,2,1,152,5,19,0,72,0,2,
+4,242,5,65,0,86,0,2,1,121,5,86,0,70,0,2,1,150,5,30,0,80,0,2,2,188,3,68,0,
+54,0,2,2,148,3,28,0,41,0,2,2,150,3,28,0,52,0,2,2,188,3,68,0,54,0,2,2,148,
+3,28,0,41,0,2,2,150,3,28,0,52,0,2,2,188,3,68,0,54,0,2,2,148,3,28,0,41,0,2,
+2,150,3,28,0,52,0,2,2,188,3,68,0,54,0,2,2,148,3,28,0,41,0,2,2,150,3,28,0,
+52,0,2,1,206,3,148,0,31,0,2,1,196,4,235,0,51,0,2,1,205,5,69,0,58,0,2,2,9,
+5,109,0,69,0,2,1,145,4,207,0,60,0,2,1,205,4,247,0,71,0,2,2,239,4,155,0,53,
+0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,2,160,5,32,0,72,0,2,0,48,5,
+44,0,54,0,2,0,34,5,32,0,67,0,2,2,168,5,32,0,72,0,2,0,48,5,44,0,54,0,2,0,34,
+5,32,0,67,0,2,2,149,5,32,0,72,0,2,0,48,5,44,0,54,0,2,0,34,5,32,0,67,0,2,2,
+29,1,157,0,37,0,2,2,88,3,118,0,75,0,2,1,185,5,144,0,67,0,2,1,214,1,228,0,
+22,0,2,0,254,3,98,0,40,0,2,1,218,1,120,0,41,0,2,2,66,3,249,0,103,0,2,1,112,
+3,219,0,46,0,2,1,72,3,249,0,100,0,2,1,221,1,0,0,30,0,2,1,157,2,193,0,61,0,
+2,2,221,5,9,0,105,0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,1,205,4,191,
+0,84,0,2,1,216,4,228,0,72,0,2,1,235,5,65,0,63,0,2,1,238,4,222,0,73,0,2,1,
+239,3,45,0,60,0,2,1,209,4,231,0,71,0,2,2,175,1,64,0,42,0,2,1,138,3,98,0,25,
+0,2,1,187,2,54,0,31,0,2,1,28,3,98,0,24,0,2,1,47,2,54,0,30,0,2,2,175,1,64,
+0,42,0,2,1,138,3,98,0,25,0,2,1,187,2,54,0,31,0,2,0,233,6,134,0,37,0,2,0,212,
+7,71,0,48,0,2,1,219,4,178,0,77,0,2,0,232,5,194,0,18,0,2,1,195,2,247,0,74,
+0,2,0,251,5,35,0,56,0,2,1,14,3,247,0,62,0,2,0,232,5,194,0,18,0,2,3,60,2,112,
+0,39,0,2,1,28,3,98,0,24,0,2,1,47,2,54,0,30,0,2,1,239,5,38,0,55,0,2,3,50,3,
+199,0,58,0,2,1,18,4,185,0,44,0,2,1,177,3,141,0,51,0,2,3,59,4,33,0,65,0,2,
+1,27,5,19,0,51,0,2,1,186,3,231,0,58,0,2,2,188,3,68,0,54,0,2,2,148,3,28,0,
+41,0,2,2,150,3,28,0,52,0,2,2,188,3,68,0,54,0,2,2,148,3,28,0,41,0,2,2,150,
+3,28,0,52,0,2,2,184,4,165,0,67,0,2,2,144,4,125,0,53,0,2,2,146,4,125,0,64,
+0,2,1,206,3,148,0,31,0,2,1,202,4,245,0,43,0,2,1,146,3,30,0,34,0,2,1,142,4,
+127,0,45,0,2,5,205,2,164,0,79,0,2,2,183,2,164,0,62,0,2,2,205,2,164,0,74,0,
+2,5,204,4,85,0,106,0,2,2,183,4,88,0,89,0,2,2,210,4,81,0,101,0,2,5,213,3,63,
+0,64,0,2,3,63,3,63,0,43,0,2,3,63,3,63,0,54,0,2,5,209,4,160,0,76,0,2,3,60,
+4,160,0,55,0,2,3,59,4,161,0,66,0,2,4,62,3,123,0,58,0,2,3,95,3,147,0,47,0,
+2,3,98,3,147,0,58,0,2,4,59,4,220,0,70,0,2,3,91,4,244,0,59,0,2,3,94,4,244,
+0,70,0,2,1,250,3,98,0,61,0,2,1,183,3,98,0,39,0,2,1,177,3,98,0,50,0,2,1,246,
+4,195,0,73,0,2,1,179,4,195,0,51,0,2,1,173,4,195,0,62,0,2,4,241,4,230,0,63,
+0,2,1,142,5,123,0,51,0,2,1,149,4,195,0,57,0,2,2,243,4,132,0,72,0,2,1,136,
+5,113,0,59,0,2,1,143,4,185,0,65,0,2,2,221,3,88,0,80,0,2,0,100,4,156,0,37,
+0,2,0,102,4,138,0,47,0,2,3,60,5,194,0,47,0,2,0,162,5,194,0,20,0,2,0,162,5,
+194,0,28,0,2,2,53,3,28,0,46,0,2,1,250,3,28,0,34,0,2,1,143,3,28,0,42,0,2,2,
+25,2,254,0,49,0,2,1,25,4,195,0,36,0,2,1,43,3,151,0,42,0,2,1,218,3,207,0,35,
+0,2,1,112,3,219,0,46,0,2,1,214,3,198,0,62,0,2,1,239,3,45,0,46,0,2,2,175,1,
+64,0,42,0,2,2,175,1,64,0,42,0,2,1,138,3,98,0,25,0,2,1,187,2,54,0,31,0,2,2,
+253,3,45,0,52,0,2,0,249,4,148,0,0,0,2,0,232,4,154,0,18,0,2,1,28,3,98,0,24,
+0,2,3,60,2,112,0,39,0,2,1,138,3,98,0,25,0,2,1,47,2,54,0,30,0,2,1,187,2,54,
+0,31,0,2,1,153,3,98,0,45,0,2,4,245,3,133,0,51,0,2,1,146,4,26,0,39,0,2,1,204,
+3,59,0,42,0,2,1,181,3,165,0,54,0,2,0,244,7,94,0,63,0,2,0,232,5,194,0,18,0,
+2,0,232,5,194,0,18,0,2,2,3,4,66,0,48,0,2,2,3,4,66,0,48,0,2,3,146,3,1,0,74,
+0,2,3,50,3,199,0,58,0,2,1,18,4,185,0,78,0,2,1,177,3,141,0,51,0,2,3,50,4,54,
+0,66,0,2,1,128,5,40,0,53,0,2,1,177,3,252,0,59,0,2,2,154,5,5,0,87,0,2,2,114,
+4,221,0,73,0,2,2,116,4,221,0,84,0,2,2,160,5,118,0,75,0,2,2,120,5,78,0,61,
+0,2,2,123,5,77,0,72,0,2,2,187,4,245,0,82,0,2,2,147,4,205,0,68,0,2,2,149,4,
+205,0,79,0,2,1,206,3,148,0,31,0,2,1,206,3,148,0,31,0,2,2,9,5,109,0,81,0,2,
+1,196,5,90,0,59,0,2,1,203,5,80,0,66,0,2,1,123,4,213,0,59,0,2,1,146,3,30,0,
+34,0,2,1,146,3,30,0,34,0,2,1,146,3,30,0,34,0,2,1,146,3,30,0,34,0,2,1,136,
+4,117,0,53,0,2,1,143,4,218,0,68,0,2,5,201,4,5,0,91,0,2,2,179,4,5,0,74,0,2,
+2,201,4,5,0,86,0,2,5,205,2,164,0,79,0,2,2,183,2,164,0,62,0,2,2,205,2,164,
+0,74,0,2,5,204,4,85,0,106,0,2,2,182,4,85,0,89,0,2,2,204,4,85,0,101,0,2,5,
+213,3,63,0,64,0,2,3,63,3,63,0,43,0,2,3,63,3,63,0,54,0,2,5,212,4,240,0,91,
+0,2,3,62,4,240,0,70,0,2,3,62,4,241,0,81,0,2,4,61,5,44,0,85,0,2,3,94,5,68,
+0,74,0,2,3,97,5,68,0,85,0,2,1,249,5,19,0,88,0,2,1,182,5,19,0,66,0,2,1,176,
+5,19,0,77,0,2,4,245,3,133,0,51,0,2,1,146,4,26,0,39,0,2,1,153,3,98,0,45,0,
+2,4,241,4,230,0,63,0,2,1,142,5,123,0,51,0,2,1,149,4,195,0,57,0,2,4,245,3,
+133,0,51,0,2,1,146,4,26,0,39,0,2,1,153,3,98,0,45,0,2,2,249,4,142,0,64,0,2,
+2,252,4,222,0,79,0,2,3,28,4,138,0,60,0,2,2,19,4,138,0,47,0,2,2,29,4,138,0,
+55,0,2,2,239,4,155,0,53,0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,2,217,
+4,185,0,90,0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,2,221,3,88,0,80,
+0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,3,127,4,144,0,105,0,2,0,52,
+5,44,0,54,0,2,0,34,5,32,0,67,0,2,2,149,5,32,0,72,0,2,0,52,5,44,0,54,0,2,0,
+34,5,32,0,67,0,2,2,149,5,32,0,72,0,2,0,48,5,44,0,54,0,2,0,34,5,32,0,67,0,
+2,3,32,7,87,0,74,0,2,0,135,7,87,0,47,0,2,0,135,7,87,0,53,0,2,3,56,7,35,0,
+59,0,2,0,158,7,35,0,32,0,2,0,159,7,35,0,38,0,2,3,59,7,115,0,74,0,2,0,161,
+7,115,0,47,0,2,0,161,7,116,0,53,0,2,3,60,5,194,0,47,0,2,1,156,5,194,0,44,
+0,2,0,162,5,194,0,28,0,2,2,25,2,254,0,61,0,2,1,24,4,195,0,36,0,2,1,43,3,151,
+0,42,0,2,2,25,2,254,0,49,0,2,1,24,4,195,0,36,0,2,1,47,2,54,0,75,0,2,2,28,
+3,78,0,64,0,2,2,185,4,165,0,93,0,2,2,144,4,125,0,53,0,2,2,146,4,124,0,64,
+0,2,1,239,3,45,0,46,0,2,3,196,1,61,0,50,0,2,3,60,4,160,0,55,0,2,3,59,4,160,
+0,78,0,2,5,209,4,160,0,88,0,2,1,179,4,195,0,51,0,2,1,173,4,195,0,62,0,2,1,
+246,4,195,0,73,0,2,1,177,5,78,0,56,0,2,1,117,4,216,0,58,0,2,2,37,5,179,0,
+128,0,2,1,83,5,149,0,71,0,2,1,43,5,179,0,125,0,2,3,60,2,112,0,39,0,2,2,144,
+3,98,0,27,0,2,2,105,2,54,0,34,0,2,1,27,5,19,0,63,0,2,1,46,3,231,0,69,0,2,
+3,59,4,33,0,77,0,2,3,60,2,112,0,39,0,2,1,138,3,98,0,25,0,2,1,187,2,54,0,31,
+0,2,3,50,3,199,0,85,0,2,1,128,4,185,0,72,0,2,1,177,3,141,0,51,0,2,3,56,3,
+209,0,50,0,2,1,134,4,195,0,56,0,2,1,183,3,151,0,62,0,2,3,60,2,112,0,39,0,
+2,1,138,3,98,0,25,0,2,1,187,2,54,0,31,0,2,3,37,4,39,0,64,0,2,1,115,5,25,0,
+51,0,2,1,164,3,238,0,57,0,2,2,178,4,155,0,75,0,2,2,138,4,115,0,61,0,2,2,139,
+4,115,0,72,0,2,2,188,3,68,0,54,0,2,2,148,3,28,0,41,0,2,2,150,3,28,0,52,0,
+2,2,9,5,109,0,88,0,2,1,206,3,148,0,31,0,2,1,131,3,30,0,40,0,2,5,202,4,96,
+0,114,0,2,2,180,4,96,0,97,0,2,2,202,4,96,0,109,0,2,1,240,4,185,0,81,0,2,1,
+173,4,185,0,59,0,2,1,167,4,185,0,70,0,2,1,240,5,40,0,89,0,2,1,173,5,40,0,
+67,0,2,1,184,5,40,0,78,0,2,1,222,5,148,0,81,0,2,1,155,5,148,0,59,0,2,1,166,
+5,148,0,70,0,2,4,245,3,133,0,51,0,2,1,146,4,26,0,39,0,2,1,153,3,98,0,45,0,
+2,4,245,3,133,0,51,0,2,1,146,4,26,0,39,0,2,1,153,3,98,0,45,0,2,2,239,4,155,
+0,53,0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,2,239,4,155,0,53,0,2,0,
+100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,2,239,4,155,0,53,0,2,0,100,4,156,
+0,37,0,2,0,102,4,138,0,47,0,2,2,49,4,125,0,58,0,2,1,246,4,125,0,46,0,2,1,
+138,4,125,0,54,0,2,2,53,3,28,0,46,0,2,1,250,3,28,0,34,0,2,1,143,3,28,0,42,
+0,2,2,25,2,254,0,68,0,2,1,134,4,195,0,56,0,2,1,183,3,151,0,43,0,2,2,84,4,
+216,0,85,0,2,1,105,5,217,0,69,0,2,1,89,5,112,0,78,0,2,2,3,4,163,0,73,0,2,
+1,23,5,183,0,57,0,2,1,20,5,78,0,66,0,2,3,60,5,194,0,47,0,2,0,162,5,194,0,
+20,0,2,0,162,5,194,0,28,0,2,1,118,5,80,0,53,0,2,1,126,4,163,0,64,0,2,5,177,
+4,214,0,99,0,2,2,155,4,214,0,82,0,2,2,177,4,214,0,94,0,2,1,229,4,132,0,66,
+0,2,1,235,4,142,0,58,0,2,1,115,5,25,0,70,0,2,1,164,3,238,0,57,0,2,2,152,2,
+247,0,68,0,2,2,175,1,64,0,42,0,2,2,182,4,85,0,89,0,2,2,204,4,85,0,101,0,2,
+5,204,4,85,0,106,0,2,1,124,3,154,0,35,0,2,1,50,2,159,0,21,0,2,0,221,5,35,
+0,70,0,2,1,185,3,57,0,72,0,2,2,175,1,64,0,42,0,2,1,28,3,98,0,24,0,2,1,47,
+2,54,0,30,0,2,2,239,4,155,0,53,0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,
+0,2,2,239,4,155,0,53,0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,2,146,
+2,250,0,67,0,2,1,109,5,28,0,50,0,2,1,157,3,241,0,56,0,2,2,165,2,151,0,62,
+0,2,1,18,4,185,0,44,0,2,1,177,3,141,0,51,0,2,2,174,2,241,0,69,0,2,1,27,5,
+19,0,51,0,2,1,186,3,231,0,58,0,2,2,188,3,68,0,54,0,2,2,148,3,28,0,41,0,2,
+2,150,3,28,0,52,0,2,5,248,5,57,0,131,0,2,2,226,5,57,0,114,0,2,2,248,5,57,
+0,126,0,2,1,189,5,179,0,85,0,2,2,247,5,29,0,93,0,2,2,207,4,245,0,79,0,2,2,
+209,4,245,0,90,0,2,0,86,5,192,0,44,0,2,0,103,5,192,0,64,0,2,3,27,2,144,0,
+69,0,2,0,148,4,145,0,70,0,2,1,41,3,226,0,77,0,2,3,46,2,146,0,89,0,2,0,166,
+4,146,0,90,0,2,1,59,3,228,0,97,0,2,2,175,1,64,0,42,0,2,1,28,3,98,0,24,0,2,
+1,187,2,54,0,31,0,2,2,3,4,66,0,48,0,2,2,3,4,66,0,48,0,2,0,148,4,145,0,51,
+0,2,1,41,3,226,0,58,0,2,1,34,2,252,0,56,0,2,0,166,4,146,0,71,0,2,1,59,3,228,
+0,78,0,2,1,53,2,252,0,76,0,2,2,188,3,68,0,54,0,2,2,148,3,28,0,41,0,2,2,150,
+3,28,0,52,0,2,5,193,5,30,0,116,0,2,2,171,5,30,0,99,0,2,2,193,5,30,0,111,0,
+2,5,176,4,94,0,104,0,2,2,154,4,94,0,87,0,2,2,176,4,94,0,99,0,2,2,205,4,67,
+0,95,0,2,0,100,4,156,0,37,0,2,0,102,4,138,0,47,0,2,2,188,3,68,0,54,0,2,2,
+148,3,28,0,41,0,2,2,150,3,28,0,52,0,2,2,36,4,40,0,62,0,2,2,38,5,34,0,56,0,
+2,2,236,3,48,0,33,0,2,3,60,2,112,0,39,0,2,1,140,3,98,0,25,0,2,1,187,2,54,
+0,31,0,2,2,178,4,199,0,65,0,2,2,178,4,155,0,75,0,2,2,138,4,115,0,61,0,2,2,
+140,4,115,0,72,0,2,4,53,4,210,0,63,0,2,4,52,4,210,0,78,0,2,3,85,4,235,0,67,
+0,2,3,88,4,234,0,78,0,2,4,192,5,238,0,82,0,2,4,244,5,54,0,78,0,2,1,123,5,
+75,0,62,0,2,1,152,5,19,0,72,0,2,3,28,4,115,0,70,0,2,2,243,4,152,0,72,0,2,
+1,136,5,113,0,59,0,2,1,143,4,185,0,65,0,2,3,50,5,194,0,35,0,2,3,60,5,194,
+0,47,0,2,0,162,5,194,0,20,0,2,0,162,5,194,0,28,0,2,1,198,4,224,0,62,0,2,2,
+52,4,205,0,73,0,2,1,249,4,205,0,61,0,2,1,142,4,205,0,69,0,2,1,122,2,156,0,
+97,0,2,2,142,3,1,0,93,0,2,1,105,5,35,0,76,0,2,1,154,3,247,0,82,0,2,1,160,
+3,77,0,77,0,2,2,171,2,161,0,73,0,2,1,133,4,195,0,56,0,2,1,183,3,151,0,62,
+0,2,2,25,3,30,0,59,0,2,2,25,3,30,0,65,0,2,2,3,3,28,0,61,0,2,2,3,3,45,0,63,
+0,2,3,13,3,133,0,74,0,2,3,0,5,229,0,34,0,2,0,131,4,188,0,51,0,2,3,160,5,194,
+0,55,0,2,0,183,4,164,0,21,0,2,2,229,7,122,0,60,0,2,2,252,7,70,0,45,0,2,2,
+255,7,150,0,60,0,2,3,0,5,229,0,34,0,2,3,0,5,229,0,34,0,2,0,132,5,128,0,70,
+0,2,0,143,6,88,0,96,0,2,0,131,4,188,0,51,0,2,0,161,5,232,0,87,0,2,0,111,6,
+66,0,81,0,2,0,131,4,188,0,51,0,2,3,133,7,87,0,82,0,2,3,156,7,35,0,67,0,2,
+3,159,7,115,0,82,0,2,3,160,5,194,0,55,0,2,3,160,5,194,0,55,0,2,0,184,5,104,
+0,40,0,2,0,195,6,64,0,66,0,2,0,183,4,164,0,21,0,2,0,213,5,208,0,57,0,2,0,
+163,6,41,0,51,0,2,0,137,6,44,0,40,0,2,0,183,4,164,0,21,0,2,3,0,5,229,0,34,
+0,4,0,0,0,1,0,8,0,1,0,12,0,62,0,1,0,222,1,244,0,1,0,23,0,28,0,77,0,80,0,85,
+0,86,0,92,0,95,0,227,0,234,0,237,2,32,2,33,3,162,3,165,3,169,3,170,3,171,
+3,174,3,178,3,181,3,182,5,237,5,238,0,2,0,26,0,13,0,13,0,0,0,17,0,17,0,1,
+0,32,0,74,0,2,0,110,0,111,0,45,0,113,0,115,0,47,0,117,0,211,0,50,0,213,0,
+213,0,145,0,229,0,230,0,146,0,238,0,239,0,148,0,250,0,252,0,150,0,255,1,47,
+0,153,1,53,1,119,0,202,1,136,1,152,1,13,1,170,1,250,1,30,2,4,2,6,1,111,2,
+8,2,15,1,114,2,20,2,21,1,122,2,42,2,157,1,124,2,172,3,9,1,240,3,14,3,15,2,
+78,3,18,3,19,2,80,3,22,3,83,2,82,3,101,3,102,2,144,3,119,3,159,2,146,3,237,
+4,7,2,187,4,9,4,9,2,214,0,23,0,0,0,94,0,0,0,102,0,0,0,110,0,0,0,118,0,0,0,
+126,0,0,0,134,0,0,0,142,0,0,0,150,0,0,0,158,0,0,0,166,0,0,0,174,0,0,0,182,
+0,0,0,190,0,0,0,198,0,0,0,206,0,0,0,214,0,0,0,222,0,0,0,230,0,0,0,238,0,0,
+0,246,0,0,0,254,0,0,1,6,0,0,1,14,0,2,0,0,255,73,0,9,0,2,0,161,0,12,0,18,0,
+2,0,144,255,244,0,8,0,2,0,173,0,92,0,27,0,2,0,18,255,251,0,14,0,2,0,0,254,
+156,0,0,0,2,0,162,0,135,0,44,0,2,0,0,255,168,0,57,0,2,0,0,254,110,0,8,0,2,
+0,0,255,52,0,30,0,2,0,173,0,92,0,43,0,2,0,173,0,92,0,35,0,2,0,6,254,81,0,
+37,0,2,255,186,255,17,0,76,0,2,0,5,255,32,0,9,0,2,255,249,255,3,0,14,0,2,
+255,254,254,234,0,46,0,2,0,223,255,244,0,21,0,2,255,220,255,93,0,8,0,2,0,
+107,253,238,0,27,0,2,0,0,255,154,0,27,0,2,0,255,255,44,0,23,0,2,0,190,255,
+45,0,23,2,215,5,176,5,184,5,192,5,200,5,208,5,216,5,224,5,232,5,240,5,248,
+6,0,6,8,6,16,6,24,6,32,6,40,6,48,6,56,6,64,6,72,6,80,6,88,6,96,6,104,6,112,
+6,120,6,128,6,136,6,144,6,152,6,160,6,168,6,176,6,184,6,192,6,200,6,208,6,
+216,6,224,6,232,6,240,6,248,7,0,7,8,7,16,7,24,7,32,7,40,7,48,7,56,7,64,7,
+72,7,80,7,88,7,96,7,104,7,112,7,120,7,128,7,136,7,144,7,152,7,160,7,168,7,
+176,7,184,7,192,7,200,7,208,7,216,7,224,7,232,7,240,7,248,8,0,8,8,8,16,8,
+24,8,32,8,40,8,48,8,56,8,64,8,72,8,80,8,88,8,96,8,104,8,112,8,120,8,128,8,
+136,8,144,8,152,8,160,8,168,8,176,8,184,8,192,8,200,8,208,8,216,8,224,8,232,
+8,240,8,248,9,0,9,8,9,16,9,24,9,32,9,40,9,48,9,56,9,64,9,72,9,80,9,88,9,96,
+9,104,9,112,9,120,9,128,9,136,9,144,9,152,9,160,9,168,9,176,9,184,9,192,9,
+200,9,208,9,216,9,224,9,232,9,240,9,248,10,0,10,8,10,16,10,24,10,32,10,40,
+10,48,10,56,10,64,10,72,10,80,10,88,10,96,10,104,10,112,10,120,10,128,10,
+136,10,144,10,152,10,160,10,168,10,176,10,184,10,192,10,200,10,208,10,216,
+10,224,10,232,10,240,10,248,11,0,11,8,11,16,11,24,11,32,11,40,11,48,11,56,
+11,64,11,72,11,80,11,88,11,96,11,104,11,112,11,120,11,128,11,136,11,144,11,
+152,11,160,11,168,11,176,11,184,11,192,11,200,11,208,11,216,11,224,11,232,
+11,240,11,248,12,0,12,8,12,16,12,24,12,32,12,40,12,48,12,56,12,64,12,72,12,
+80,12,88,12,96,12,104,12,112,12,120,12,128,12,136,12,144,12,152,12,160,12,
+168,12,176,12,184,12,192,12,200,12,208,12,216,12,224,12,232,12,240,12,248,
+13,0,13,8,13,16,13,24,13,32,13,40,13,48,13,56,13,64,13,72,13,80,13,88,13,
+96,13,104,13,112,13,120,13,128,13,136,13,144,13,152,13,160,13,168,13,176,
+13,184,13,192,13,200,13,208,13,216,13,224,13,232,13,240,13,248,14,0,14,8,
+14,16,14,24,14,32,14,40,14,48,14,56,14,64,14,72,14,80,14,88,14,96,14,104,
+14,112,14,120,14,128,14,136,14,144,14,152,14,160,14,168,14,176,14,184,14,
+192,14,200,14,208,14,216,14,224,14,232,14,240,14,248,15,0,15,8,15,16,15,24,
+15,32,15,40,15,48,15,56,15,64,15,72,15,80,15,88,15,96,15,104,15,112,15,120,
+15,128,15,136,15,144,15,152,15,160,15,168,15,176,15,184,15,192,15,200,15,
+208,15,216,15,224,15,232,15,240,15,248,16,0,16,8,16,16,16,24,16,32,16,40,
+16,48,16,56,16,64,16,72,16,80,16,88,16,96,16,104,16,112,16,120,16,128,16,
+136,16,144,16,152,16,160,16,168,16,176,16,184,16,192,16,200,16,208,16,216,
+16,224,16,232,16,240,16,248,17,0,17,8,17,16,17,24,17,32,17,40,17,48,17,56,
+17,64,17,72,17,80,17,88,17,96,17,104,17,112,17,120,17,128,17,136,17,144,17,
+152,17,160,17,168,17,176,17,184,17,192,17,200,17,208,17,216,17,224,17,232,
+17,240,17,248,18,0,18,8,18,16,18,24,18,32,18,40,18,48,18,56,18,64,18,72,18,
+80,18,88,18,96,18,104,18,112,18,120,18,128,18,136,18,144,18,152,18,160,18,
+168,18,176,18,184,18,192,18,200,18,208,18,216,18,224,18,232,18,240,18,248,
+19,0,19,8,19,16,19,24,19,32,19,40,19,48,19,56,19,64,19,72,19,80,19,88,19,
+96,19,104,19,112,19,120,19,128,19,136,19,144,19,152,19,160,19,168,19,176,
+19,184,19,192,19,200,19,208,19,216,19,224,19,232,19,240,19,248,20,0,20,8,
+20,16,20,24,20,32,20,40,20,48,20,56,20,64,20,72,20,80,20,88,20,96,20,104,
+20,112,20,120,20,128,20,136,20,144,20,152,20,160,20,168,20,176,20,184,20,
+192,20,200,20,208,20,216,20,224,20,232,20,240,20,248,21,0,21,8,21,16,21,24,
+21,32,21,40,21,48,21,56,21,64,21,72,21,80,21,88,21,96,21,104,21,112,21,120,
+21,128,21,136,21,144,21,152,21,160,21,168,21,176,21,184,21,192,21,200,21,
+208,21,216,21,224,21,232,21,240,21,248,22,0,22,8,22,16,22,24,22,32,22,40,
+22,48,22,56,22,64,22,72,22,80,22,88,22,96,22,104,22,112,22,120,22,128,22,
+136,22,144,22,152,22,160,22,168,22,176,22,184,22,192,22,200,22,208,22,216,
+22,224,22,232,22,240,22,248,23,0,23,8,23,16,23,24,23,32,23,40,23,48,23,56,
+23,64,23,72,23,80,23,88,23,96,23,104,23,112,23,120,23,128,23,136,23,144,23,
+152,23,160,23,168,23,176,23,184,23,192,23,200,23,208,23,216,23,224,23,232,
+23,240,23,248,24,0,24,8,24,16,24,24,24,32,24,40,24,48,24,56,24,64,24,72,24,
+80,24,88,24,96,24,104,24,112,24,120,24,128,24,136,24,144,24,152,24,160,24,
+168,24,176,24,184,24,192,24,200,24,208,24,216,24,224,24,232,24,240,24,248,
+25,0,25,8,25,16,25,24,25,32,25,40,25,48,25,56,25,64,25,72,25,80,25,88,25,
+96,25,104,25,112,25,120,25,128,25,136,25,144,25,152,25,160,25,168,25,176,
+25,184,25,192,25,200,25,208,25,216,25,224,25,232,25,240,25,248,26,0,26,8,
+26,16,26,24,26,32,26,40,26,48,26,56,26,64,26,72,26,80,26,88,26,96,26,104,
+26,112,26,120,26,128,26,136,26,144,26,152,26,160,26,168,26,176,26,184,26,
+192,26,200,26,208,26,216,26,224,26,232,26,240,26,248,27,0,27,8,27,16,27,24,
+27,32,27,40,27,48,27,56,27,64,27,72,27,80,27,88,27,96,27,104,27,112,27,120,
+27,128,27,136,27,144,27,152,27,160,27,168,27,176,27,184,27,192,27,200,27,
+208,27,216,27,224,27,232,27,240,27,248,28,0,28,8,28,16,28,24,28,32,28,40,
+28,48,28,56,28,64,28,72,28,80,28,88,28,96,0,2,1,172,253,149,0,66,0,2,2,181,
+253,93,0,69,0,2,2,57,252,82,0,81,0,2,1,229,255,80,0,62,0,2,1,13,255,150,0,
+18,0,2,1,13,255,150,0,18,0,2,1,140,253,252,0,43,0,2,1,48,254,38,0,47,0,2,
+2,48,253,132,0,48,0,2,1,13,255,150,0,18,0,2,3,10,254,82,0,46,0,2,1,216,255,
+150,0,34,0,2,3,6,255,150,0,35,0,2,3,6,255,150,0,35,0,2,2,196,253,80,0,47,
+0,2,2,196,253,80,0,47,0,2,2,196,253,80,0,47,0,2,1,183,255,150,0,30,0,2,1,
+183,255,150,0,30,0,2,0,204,253,250,0,27,0,2,0,204,253,250,0,27,0,2,5,191,
+255,100,0,70,0,2,5,191,255,100,0,70,0,2,6,83,255,150,0,55,0,2,6,83,255,150,
+0,55,0,2,3,34,255,150,0,45,0,2,3,34,255,150,0,45,0,2,2,210,253,83,0,47,0,
+2,2,210,253,83,0,47,0,2,3,153,255,150,0,46,0,2,3,167,253,241,0,72,0,2,2,48,
+253,132,0,48,0,2,2,48,253,132,0,48,0,2,2,48,253,132,0,48,0,2,0,203,254,218,
+0,13,0,2,5,46,255,150,0,44,0,2,2,83,253,132,0,52,0,2,2,25,255,150,0,32,0,
+2,2,118,253,132,0,38,0,2,2,88,255,154,0,37,0,2,2,28,253,132,0,30,0,2,1,185,
+255,150,0,34,0,2,1,140,253,252,0,43,0,2,2,48,253,132,0,48,0,2,2,54,252,76,
+0,67,0,2,3,6,255,150,0,35,0,2,2,83,253,132,0,52,0,2,1,13,255,150,0,18,0,2,
+1,13,255,150,0,18,0,2,1,51,254,15,0,64,0,2,1,13,255,150,0,18,0,2,1,140,253,
+252,0,43,0,2,1,140,253,252,0,43,0,2,2,48,253,132,0,48,0,2,3,6,255,150,0,35,
+0,2,3,6,255,150,0,35,0,2,3,34,253,129,0,54,0,2,3,15,254,101,0,68,0,2,3,6,
+255,150,0,35,0,2,3,22,253,239,0,61,0,2,3,6,255,150,0,35,0,2,3,8,253,246,0,
+69,0,2,2,196,253,80,0,47,0,2,2,196,253,80,0,47,0,2,2,196,253,80,0,47,0,2,
+2,196,253,80,0,47,0,2,2,196,253,80,0,47,0,2,2,196,253,80,0,47,0,2,2,196,253,
+80,0,47,0,2,1,190,255,150,0,30,0,2,1,192,254,100,0,63,0,2,1,190,254,81,0,
+41,0,2,1,190,254,81,0,41,0,2,1,183,255,150,0,30,0,2,1,189,254,94,0,49,0,2,
+1,183,255,150,0,30,0,2,1,183,255,150,0,30,0,2,1,183,255,150,0,30,0,2,0,204,
+253,250,0,27,0,2,0,204,253,250,0,27,0,2,0,212,252,201,0,60,0,2,0,209,252,
+181,0,38,0,2,0,231,252,121,0,50,0,2,0,209,252,182,0,50,0,2,0,204,253,250,
+0,27,0,2,0,204,253,250,0,27,0,2,0,204,253,250,0,27,0,2,5,196,254,45,0,91,
+0,2,5,207,253,191,0,96,0,2,5,208,253,191,0,121,0,2,6,89,254,93,0,74,0,2,6,
+83,255,150,0,55,0,2,3,34,255,150,0,45,0,2,2,210,253,83,0,47,0,2,5,46,255,
+150,0,44,0,2,5,50,254,128,0,56,0,2,5,50,254,128,0,56,0,2,5,46,255,150,0,44,
+0,2,5,62,253,239,0,71,0,2,5,46,255,150,0,44,0,2,2,83,253,132,0,52,0,2,2,83,
+253,132,0,52,0,2,3,153,255,150,0,46,0,2,6,50,255,150,0,52,0,2,3,153,255,150,
+0,46,0,2,2,25,255,150,0,32,0,2,2,25,255,150,0,32,0,2,2,41,253,239,0,101,0,
+2,3,153,255,150,0,46,0,2,3,153,255,150,0,46,0,2,3,153,255,150,0,46,0,2,3,
+157,254,94,0,80,0,2,3,181,253,129,0,80,0,2,3,153,255,150,0,46,0,2,2,118,253,
+132,0,38,0,2,2,118,253,132,0,38,0,2,2,118,253,132,0,38,0,2,2,134,251,221,
+0,64,0,2,2,32,252,64,0,51,0,2,2,28,253,132,0,30,0,2,2,28,253,132,0,30,0,2,
+2,37,252,82,0,73,0,2,2,28,253,132,0,30,0,2,2,144,255,119,0,44,0,2,2,196,253,
+80,0,47,0,2,1,185,255,150,0,34,0,2,1,185,255,150,0,34,0,2,1,185,255,150,0,
+34,0,2,1,216,255,150,0,34,0,2,1,140,253,252,0,43,0,2,1,138,253,252,0,57,0,
+2,1,140,253,252,0,43,0,2,1,140,253,252,0,43,0,2,1,140,253,252,0,43,0,2,1,
+140,253,252,0,43,0,2,1,140,253,252,0,43,0,2,1,140,253,252,0,43,0,2,2,48,253,
+132,0,48,0,2,3,19,253,132,0,56,0,2,2,48,253,132,0,48,0,2,1,140,253,252,0,
+43,0,2,2,76,251,111,0,67,0,2,2,64,251,221,0,74,0,2,3,172,255,150,0,35,0,2,
+3,172,255,150,0,35,0,2,1,185,255,150,0,34,0,2,0,190,255,63,0,34,0,2,1,92,
+255,63,0,29,0,2,1,183,255,150,0,30,0,2,0,204,253,250,0,27,0,2,5,195,254,34,
+0,106,0,2,6,87,254,82,0,76,0,2,2,210,253,83,0,47,0,2,2,144,255,119,0,44,0,
+2,3,10,254,93,0,62,0,2,3,10,254,82,0,46,0,2,3,16,253,233,0,62,0,2,3,16,253,
+233,0,62,0,2,3,12,254,93,0,54,0,2,3,58,254,21,0,58,0,2,3,6,255,150,0,35,0,
+2,2,196,253,80,0,47,0,2,2,196,253,80,0,47,0,2,1,218,253,129,0,87,0,2,1,236,
+254,20,0,53,0,2,0,204,253,250,0,27,0,2,5,191,255,100,0,70,0,2,2,210,253,83,
+0,47,0,2,2,210,253,83,0,47,0,2,2,210,253,83,0,47,0,2,5,52,254,93,0,64,0,2,
+5,56,253,233,0,72,0,2,3,153,255,150,0,46,0,2,3,153,255,150,0,46,0,2,3,163,
+253,233,0,73,0,2,2,88,255,154,0,37,0,2,2,92,254,160,0,48,0,2,2,34,252,75,
+0,59,0,2,2,28,253,132,0,30,0,2,2,28,253,132,0,30,0,2,2,118,253,132,0,38,0,
+2,0,204,253,250,0,27,0,2,0,204,253,250,0,27,0,2,5,191,255,100,0,70,0,2,2,
+196,253,80,0,47,0,2,2,196,253,80,0,47,0,2,5,191,255,100,0,70,0,2,0,204,253,
+250,0,27,0,2,2,196,253,80,0,47,0,2,1,13,255,150,0,17,0,2,1,13,255,150,0,17,
+0,2,2,48,253,132,0,48,0,2,2,48,253,132,0,48,0,2,2,61,251,10,0,82,0,2,1,140,
+253,252,0,43,0,2,1,140,253,252,0,43,0,2,3,200,255,150,0,35,0,2,3,200,255,
+150,0,35,0,2,2,196,253,80,0,47,0,2,5,191,255,100,0,70,0,2,5,191,255,100,0,
+70,0,2,2,25,255,150,0,32,0,2,2,106,254,218,0,49,0,2,1,99,255,150,0,19,0,2,
+3,197,253,129,0,59,0,2,1,32,253,129,0,45,0,2,1,119,253,129,0,51,0,2,3,185,
+253,239,0,66,0,2,1,120,253,239,0,53,0,2,1,147,253,239,0,59,0,2,3,172,253,
+247,0,74,0,2,1,107,253,247,0,61,0,2,1,134,253,247,0,67,0,2,3,169,255,150,
+0,40,0,2,1,104,255,150,0,27,0,2,1,131,255,150,0,33,0,2,3,169,255,150,0,40,
+0,2,1,104,255,150,0,27,0,2,1,131,255,150,0,33,0,2,3,169,255,150,0,40,0,2,
+1,6,255,150,0,26,0,2,1,131,255,150,0,33,0,2,4,243,255,150,0,53,0,2,1,246,
+255,150,0,37,0,2,1,141,255,150,0,47,0,2,4,243,255,150,0,53,0,2,1,246,255,
+150,0,37,0,2,1,141,255,150,0,47,0,2,2,146,253,83,0,57,0,2,2,170,253,129,0,
+62,0,2,2,168,253,129,0,73,0,2,2,146,253,83,0,57,0,2,2,148,254,93,0,62,0,2,
+2,146,254,93,0,73,0,2,2,146,253,83,0,57,0,2,2,158,253,239,0,69,0,2,2,156,
+253,239,0,80,0,2,2,146,253,83,0,57,0,2,2,145,253,247,0,77,0,2,2,143,253,247,
+0,88,0,2,1,239,254,92,0,52,0,2,1,233,255,150,0,33,0,2,1,233,255,150,0,33,
+0,2,1,233,255,150,0,33,0,2,0,207,253,250,0,35,0,2,0,207,253,250,0,35,0,2,
+3,201,255,150,0,55,0,2,1,145,255,150,0,39,0,2,1,150,255,150,0,50,0,2,3,201,
+255,150,0,55,0,2,1,145,255,150,0,39,0,2,1,173,255,150,0,50,0,2,3,207,254,
+93,0,91,0,2,1,151,254,93,0,73,0,2,1,176,254,93,0,86,0,2,3,201,255,150,0,55,
+0,2,1,145,255,150,0,39,0,2,1,173,255,150,0,50,0,2,2,28,253,132,0,39,0,2,2,
+28,253,132,0,39,0,2,2,73,255,130,0,37,0,2,2,70,255,150,0,24,0,2,1,59,253,
+233,0,39,0,2,1,41,253,220,0,42,0,2,2,146,255,130,0,105,0,2,1,202,255,110,
+0,48,0,2,1,152,255,130,0,102,0,2,2,151,253,250,0,31,0,2,2,120,253,250,0,31,
+0,2,2,252,255,150,0,37,0,2,1,145,255,150,0,39,0,2,1,150,255,150,0,50,0,2,
+1,189,253,252,0,47,0,2,1,189,253,252,0,47,0,2,1,189,253,252,0,47,0,2,1,189,
+253,252,0,47,0,2,1,130,253,252,0,61,0,2,1,189,253,252,0,47,0,2,2,96,251,113,
+0,63,0,2,1,132,253,129,0,46,0,2,1,159,253,129,0,52,0,2,1,4,255,150,0,26,0,
+2,1,91,255,150,0,32,0,2,2,68,253,134,0,44,0,2,1,111,254,93,0,46,0,2,1,137,
+254,93,0,52,0,2,1,99,255,150,0,19,0,2,1,99,255,150,0,19,0,2,1,189,253,252,
+0,47,0,2,1,134,254,38,0,48,0,2,2,68,253,134,0,44,0,2,1,4,255,150,0,26,0,2,
+1,91,255,150,0,32,0,2,1,99,255,150,0,19,0,2,3,173,254,82,0,51,0,2,1,8,254,
+82,0,37,0,2,1,95,254,82,0,43,0,2,2,104,255,130,0,37,0,2,3,169,255,150,0,40,
+0,2,1,4,255,150,0,26,0,2,1,131,255,150,0,33,0,2,3,169,255,150,0,40,0,2,1,
+4,255,150,0,26,0,2,1,131,255,150,0,33,0,2,2,146,253,83,0,57,0,2,2,146,254,
+82,0,54,0,2,2,144,254,82,0,65,0,2,2,146,253,83,0,57,0,2,2,142,255,150,0,43,
+0,2,2,140,255,150,0,54,0,2,2,146,253,83,0,57,0,2,2,142,255,150,0,43,0,2,2,
+140,255,150,0,54,0,2,1,233,255,150,0,33,0,2,1,233,255,150,0,33,0,2,0,207,
+253,250,0,35,0,2,0,207,253,250,0,35,0,2,5,221,255,100,0,81,0,2,2,177,255,
+150,0,64,0,2,2,169,255,150,0,76,0,2,5,221,255,100,0,81,0,2,2,177,255,150,
+0,64,0,2,2,169,255,150,0,76,0,2,6,104,255,150,0,66,0,2,3,228,255,150,0,45,
+0,2,3,228,255,150,0,56,0,2,6,104,255,150,0,66,0,2,3,228,255,150,0,45,0,2,
+3,228,255,150,0,56,0,2,3,154,255,130,0,60,0,2,2,220,255,150,0,49,0,2,2,220,
+255,150,0,60,0,2,3,154,255,130,0,60,0,2,2,220,255,150,0,49,0,2,2,220,255,
+150,0,60,0,2,2,98,253,83,0,63,0,2,2,57,255,150,0,41,0,2,1,196,255,150,0,52,
+0,2,2,98,253,83,0,63,0,2,2,57,255,150,0,41,0,2,1,196,255,150,0,52,0,2,4,243,
+255,150,0,53,0,2,1,208,255,150,0,41,0,2,1,141,255,150,0,47,0,2,2,83,253,132,
+0,54,0,2,1,208,255,150,0,41,0,2,1,141,255,150,0,47,0,2,2,252,255,150,0,37,
+0,2,1,145,255,150,0,39,0,2,1,150,255,150,0,50,0,2,2,118,253,132,0,49,0,2,
+0,246,255,150,0,22,0,2,1,15,255,150,0,27,0,2,2,179,255,56,0,48,0,2,1,218,
+255,130,0,36,0,2,1,239,255,130,0,44,0,2,2,28,253,132,0,39,0,2,1,4,255,150,
+0,26,0,2,1,91,255,150,0,32,0,2,2,73,255,130,0,37,0,2,1,202,255,110,0,48,0,
+2,2,7,253,250,0,63,0,2,1,189,253,252,0,47,0,2,2,68,253,134,0,44,0,2,2,75,
+252,77,0,63,0,2,1,110,254,93,0,46,0,2,1,137,254,93,0,52,0,2,2,83,253,132,
+0,54,0,2,1,13,255,150,0,17,0,2,1,99,255,150,0,19,0,2,1,4,255,150,0,26,0,2,
+3,169,255,150,0,40,0,2,1,104,255,150,0,27,0,2,1,91,255,150,0,32,0,2,1,131,
+255,150,0,33,0,2,1,141,255,150,0,47,0,2,4,243,255,150,0,53,0,2,1,208,255,
+150,0,41,0,2,2,70,255,150,0,24,0,2,2,70,255,150,0,24,0,2,1,99,255,150,0,19,
+0,2,1,137,254,15,0,65,0,2,1,99,255,150,0,19,0,2,1,189,253,252,0,47,0,2,1,
+189,253,252,0,47,0,2,2,68,253,134,0,44,0,2,3,178,254,100,0,92,0,2,1,13,254,
+145,0,59,0,2,1,140,254,100,0,85,0,2,3,169,255,150,0,40,0,2,1,104,255,150,
+0,27,0,2,1,131,255,150,0,33,0,2,2,146,253,83,0,57,0,2,2,142,255,150,0,43,
+0,2,2,140,255,150,0,54,0,2,2,146,253,83,0,57,0,2,2,142,255,150,0,43,0,2,2,
+140,255,150,0,54,0,2,2,146,253,83,0,57,0,2,2,142,255,150,0,43,0,2,2,140,255,
+150,0,54,0,2,1,242,254,100,0,66,0,2,1,238,254,82,0,44,0,2,1,238,254,82,0,
+44,0,2,1,233,255,150,0,33,0,2,1,233,255,150,0,33,0,2,0,207,253,250,0,35,0,
+2,0,216,252,200,0,68,0,2,0,211,252,182,0,46,0,2,0,234,252,121,0,58,0,2,0,
+211,252,182,0,58,0,2,0,207,253,250,0,35,0,2,0,207,253,250,0,35,0,2,5,225,
+254,32,0,102,0,2,2,181,254,82,0,85,0,2,2,173,254,82,0,97,0,2,5,237,253,189,
+0,107,0,2,2,193,253,239,0,90,0,2,2,185,253,239,0,102,0,2,5,237,253,189,0,
+132,0,2,2,193,253,239,0,115,0,2,2,185,253,239,0,127,0,2,6,110,254,93,0,85,
+0,2,3,234,254,93,0,64,0,2,3,235,254,93,0,75,0,2,6,104,255,150,0,66,0,2,3,
+228,255,150,0,45,0,2,3,228,255,150,0,56,0,2,3,154,255,130,0,60,0,2,2,220,
+255,150,0,49,0,2,2,220,255,150,0,60,0,2,2,98,253,83,0,63,0,2,2,57,255,150,
+0,41,0,2,1,196,255,150,0,52,0,2,4,247,254,82,0,64,0,2,1,212,254,82,0,52,0,
+2,1,145,254,82,0,58,0,2,4,247,254,82,0,74,0,2,1,212,254,82,0,62,0,2,1,145,
+254,82,0,68,0,2,5,3,253,239,0,79,0,2,1,224,253,239,0,67,0,2,1,157,253,239,
+0,73,0,2,2,83,253,132,0,54,0,2,2,83,253,132,0,54,0,2,6,87,255,150,0,62,0,
+2,5,66,255,150,0,49,0,2,5,112,255,150,0,57,0,2,3,201,255,150,0,55,0,2,1,145,
+255,150,0,39,0,2,1,150,255,150,0,50,0,2,2,252,255,150,0,37,0,2,1,145,255,
+150,0,39,0,2,1,150,255,150,0,50,0,2,3,12,253,239,0,106,0,2,1,161,253,239,
+0,65,0,2,1,166,253,239,0,76,0,2,3,201,255,150,0,55,0,2,1,145,255,150,0,39,
+0,2,1,173,255,150,0,50,0,2,3,229,253,129,0,91,0,2,1,173,253,129,0,73,0,2,
+1,201,253,129,0,86,0,2,3,201,255,150,0,55,0,2,1,145,255,150,0,39,0,2,1,173,
+255,150,0,50,0,2,2,118,253,132,0,49,0,2,0,246,255,150,0,22,0,2,1,15,255,150,
+0,27,0,2,2,118,253,132,0,49,0,2,0,246,255,150,0,22,0,2,1,15,255,150,0,27,
+0,2,2,118,253,132,0,49,0,2,0,246,255,150,0,22,0,2,1,15,255,150,0,27,0,2,2,
+134,251,221,0,75,0,2,1,25,253,239,0,45,0,2,1,31,253,239,0,54,0,2,2,32,252,
+64,0,50,0,2,1,8,254,83,0,47,0,2,1,95,254,82,0,53,0,2,2,37,252,82,0,82,0,2,
+1,13,254,145,0,69,0,2,1,101,254,100,0,65,0,2,2,28,253,132,0,39,0,2,2,146,
+253,83,0,57,0,2,2,158,253,239,0,79,0,2,2,156,253,239,0,90,0,2,1,189,253,252,
+0,47,0,2,3,89,253,131,0,52,0,2,3,232,254,52,0,66,0,2,3,233,254,53,0,67,0,
+2,6,108,254,52,0,77,0,2,2,61,254,53,0,62,0,2,1,200,254,52,0,73,0,2,2,98,253,
+83,0,63,0,2,1,233,255,150,0,33,0,2,0,207,253,250,0,35,0,2,2,146,255,130,0,
+105,0,2,1,202,255,110,0,48,0,2,1,152,255,130,0,102,0,2,3,173,254,93,0,67,
+0,2,1,189,254,93,0,55,0,2,2,54,254,93,0,62,0,2,1,8,254,82,0,37,0,2,1,95,254,
+82,0,43,0,2,3,173,254,82,0,51,0,2,3,179,253,233,0,67,0,2,1,114,253,233,0,
+54,0,2,1,141,253,233,0,60,0,2,3,179,253,233,0,67,0,2,1,114,253,233,0,54,0,
+2,1,141,253,233,0,79,0,2,3,175,254,93,0,69,0,2,1,110,254,93,0,46,0,2,1,137,
+254,93,0,52,0,2,3,222,254,20,0,63,0,2,1,157,254,20,0,50,0,2,1,184,254,20,
+0,56,0,2,3,169,255,150,0,40,0,2,1,104,255,150,0,27,0,2,1,131,255,150,0,33,
+0,2,2,146,253,83,0,57,0,2,2,142,255,150,0,43,0,2,2,140,255,150,0,54,0,2,2,
+146,253,83,0,57,0,2,2,152,253,233,0,70,0,2,2,150,253,233,0,81,0,2,2,5,253,
+129,0,52,0,2,2,30,254,20,0,56,0,2,0,213,253,250,0,41,0,2,5,221,255,100,0,
+81,0,2,2,177,255,150,0,64,0,2,2,169,255,150,0,76,0,2,2,98,253,83,0,63,0,2,
+2,57,255,150,0,41,0,2,1,196,255,150,0,52,0,2,2,98,253,83,0,63,0,2,2,57,255,
+150,0,41,0,2,1,213,255,150,0,52,0,2,2,98,253,83,0,63,0,2,2,57,255,150,0,41,
+0,2,1,213,255,150,0,52,0,2,4,248,254,93,0,72,0,2,1,214,254,93,0,60,0,2,1,
+148,254,93,0,66,0,2,4,253,253,233,0,80,0,2,1,218,253,233,0,68,0,2,1,153,253,
+233,0,74,0,2,3,201,255,150,0,55,0,2,1,145,255,150,0,39,0,2,1,150,255,150,
+0,50,0,2,3,201,255,150,0,55,0,2,1,145,255,150,0,39,0,2,1,150,255,150,0,50,
+0,2,3,211,253,233,0,82,0,2,1,155,253,233,0,66,0,2,1,160,253,233,0,77,0,2,
+2,179,255,56,0,48,0,2,1,218,255,130,0,36,0,2,1,239,255,130,0,44,0,2,2,183,
+253,246,0,59,0,2,1,222,254,62,0,47,0,2,1,243,254,62,0,55,0,2,2,34,252,75,
+0,58,0,2,1,110,254,93,0,46,0,2,1,138,254,93,0,62,0,2,2,28,253,132,0,39,0,
+2,0,222,255,150,0,23,0,2,1,78,255,150,0,32,0,2,2,28,253,132,0,39,0,2,0,222,
+255,150,0,23,0,2,1,91,255,150,0,32,0,2,2,118,253,132,0,49,0,2,0,246,255,150,
+0,22,0,2,1,15,255,150,0,27,0,2,0,207,253,250,0,35,0,2,0,207,253,250,0,35,
+0,2,5,221,255,100,0,81,0,2,2,177,255,150,0,64,0,2,2,169,255,150,0,76,0,2,
+1,189,253,252,0,47,0,2,1,189,253,252,0,47,0,2,1,110,254,93,0,46,0,2,1,138,
+254,93,0,76,0,2,2,68,253,134,0,44,0,2,2,84,251,223,0,70,0,2,2,181,254,82,
+0,100,0,2,2,173,254,82,0,112,0,2,5,225,254,32,0,117,0,2,1,246,255,150,0,37,
+0,2,0,222,255,150,0,23,0,2,1,59,253,233,0,39,0,2,1,41,253,220,0,42,0,2,2,
+77,252,85,0,77,0,2,1,13,254,100,0,59,0,2,1,100,254,100,0,65,0,2,3,201,255,
+150,0,55,0,2,1,145,255,150,0,39,0,2,1,150,255,150,0,50,0,2,3,217,253,239,
+0,81,0,2,1,161,253,239,0,65,0,2,1,166,253,239,0,76,0,2,2,68,253,134,0,44,
+0,2,1,109,254,93,0,69,0,2,1,137,254,93,0,75,0,2,2,68,253,134,0,44,0,2,1,10,
+254,93,0,64,0,2,1,137,254,92,0,71,0,2,2,68,253,134,0,44,0,2,1,11,254,93,0,
+70,0,2,1,136,254,93,0,77,0,2,2,146,253,83,0,57,0,2,3,75,253,221,0,94,0,2,
+3,75,253,221,0,105,0,2,5,221,255,100,0,81,0,2,2,177,255,150,0,64,0,2,2,169,
+255,150,0,76,0,2,0,207,253,250,0,35,0,2,2,146,253,83,0,57,0,2,2,142,255,150,
+0,43,0,2,2,140,255,150,0,54,0,2,1,99,255,150,0,19,0,2,1,99,255,150,0,19,0,
+2,2,68,253,134,0,44,0,2,1,10,254,93,0,45,0,2,1,138,254,93,0,52,0,2,2,68,253,
+134,0,44,0,2,1,10,254,93,0,45,0,2,1,138,254,93,0,52,0,2,2,79,251,12,0,78,
+0,2,1,17,253,74,0,60,0,2,1,143,253,74,0,67,0,2,1,189,253,252,0,47,0,2,1,189,
+253,252,0,47,0,2,1,4,255,150,0,26,0,2,1,131,255,150,0,33,0,2,2,117,253,250,
+0,31,0,2,1,4,255,150,0,26,0,2,1,131,255,150,0,33,0,2,2,117,253,250,0,31,0,
+2,2,146,253,83,0,57,0,2,3,123,253,201,0,77,0,2,2,152,253,28,0,88,0,2,5,221,
+255,100,0,81,0,2,2,177,255,150,0,64,0,2,2,169,255,150,0,76,0,2,5,221,255,
+100,0,81,0,2,2,177,255,150,0,64,0,2,2,169,255,150,0,76,0,2,2,252,255,150,
+0,37,0,2,1,145,255,150,0,39,0,2,1,150,255,150,0,50,0,2,2,146,253,83,0,57,
+0,2,2,83,254,29,0,81,0,2,2,81,254,29,0,92,0,2,1,91,255,150,0,32,0,2,1,4,255,
+150,0,26,0,2,3,31,254,21,0,58,0,2,3,196,254,21,0,63,0,2,1,133,254,21,0,50,
+0,2,1,158,254,21,0,56,0,2,2,196,253,80,0,47,0,2,2,146,253,83,0,57,0,2,2,146,
+254,82,0,73,0,2,2,144,254,82,0,84,0,2,3,34,255,150,0,45,0,2,3,154,255,130,
+0,60,0,2,2,220,255,150,0,49,0,2,2,220,255,150,0,60,0,2,5,50,254,82,0,56,0,
+2,4,229,254,82,0,89,0,2,1,250,254,82,0,73,0,2,1,145,254,82,0,83,0,2,2,88,
+252,64,0,82,0,2,2,88,252,64,0,84,0,2,1,208,255,150,0,70,0,2,1,141,255,150,
+0,76,0,2,2,118,253,132,0,38,0,2,2,118,253,132,0,49,0,2,0,246,255,150,0,22,
+0,2,1,15,255,150,0,27,0,2,2,88,255,154,0,37,0,2,2,179,255,56,0,48,0,2,1,218,
+255,130,0,36,0,2,1,239,255,130,0,44,0,2,2,54,252,75,0,67,0,2,2,73,252,78,
+0,63,0,2,1,110,254,93,0,46,0,2,1,138,254,93,0,52,0,2,2,54,252,75,0,67,0,2,
+2,74,252,77,0,63,0,2,1,110,254,93,0,46,0,2,1,138,254,93,0,52,0,2,1,128,253,
+250,0,60,0,2,1,128,253,250,0,66,0,2,1,189,253,182,0,62,0,2,1,189,253,182,
+0,64,0,2,2,245,254,74,0,94,0,2,3,90,255,150,0,35,0,2,1,158,255,150,0,52,0,
+2,4,14,255,150,0,56,0,2,1,228,255,150,0,22,0,2,3,90,255,150,0,35,0,2,3,90,
+255,150,0,35,0,2,3,90,255,150,0,35,0,2,3,90,255,150,0,35,0,2,3,26,253,239,
+0,61,0,2,1,158,255,150,0,52,0,2,1,158,255,150,0,52,0,2,1,196,254,15,0,98,
+0,2,1,158,255,150,0,52,0,2,1,158,255,150,0,52,0,2,1,193,254,38,0,81,0,2,4,
+14,255,150,0,56,0,2,4,14,255,150,0,56,0,2,4,14,255,150,0,56,0,2,3,236,253,
+239,0,83,0,2,4,14,255,150,0,56,0,2,1,228,255,150,0,22,0,2,1,228,255,150,0,
+22,0,2,2,10,254,15,0,68,0,2,1,228,255,150,0,22,0,2,1,228,255,150,0,22,0,2,
+1,228,255,150,0,22,0,2,2,7,254,38,0,51,0,2,3,90,255,150,0,35,0,4,0,0,0,1,
+0,8,0,1,0,12,0,28,0,1,0,44,1,90,0,2,0,2,3,190,3,204,0,0,5,219,5,228,0,15,
+0,1,0,6,3,213,3,217,3,221,3,225,3,229,3,234,0,25,0,0,0,102,0,0,0,110,0,0,
+0,118,0,0,0,126,0,0,0,134,0,0,0,142,0,0,0,150,0,0,0,158,0,0,0,166,0,0,0,174,
+0,0,0,182,0,0,0,190,0,0,0,198,0,0,0,206,0,0,0,214,0,0,0,222,0,0,0,230,0,0,
+0,238,0,0,0,246,0,0,0,254,0,0,1,6,0,0,1,14,0,0,1,22,0,0,1,30,0,0,1,38,0,2,
+0,206,254,236,0,10,0,2,0,212,254,236,0,17,0,2,1,15,254,236,0,44,0,2,1,57,
+254,236,0,65,0,2,1,19,254,236,0,35,0,2,0,250,254,236,0,27,0,2,1,36,254,236,
+0,22,0,2,1,29,254,236,0,33,0,2,1,29,254,236,0,33,0,2,1,28,254,236,0,43,0,
+2,1,49,254,236,0,60,0,2,1,41,254,236,0,53,0,2,1,36,254,236,0,49,0,2,1,49,
+254,236,0,33,0,2,1,19,254,236,0,29,0,2,1,0,254,236,0,22,0,2,0,249,254,236,
+0,11,0,2,0,243,254,236,0,25,0,2,0,245,254,236,0,34,0,2,1,18,254,236,0,18,
+0,2,0,247,254,235,0,31,0,2,1,11,254,236,0,35,0,2,0,255,254,236,0,7,0,2,1,
+3,254,236,0,46,0,2,0,251,254,236,0,34,0,6,0,14,0,22,0,30,0,38,0,46,0,54,0,
+2,3,199,255,30,0,31,0,2,6,125,255,60,0,72,0,2,5,225,255,110,0,56,0,2,3,169,
+255,110,0,74,0,2,4,201,255,230,0,126,0,2,4,221,255,190,1,4,0,5,0,0,0,1,0,
+8,0,1,0,12,0,170,0,1,0,204,4,106,0,1,0,77,0,18,0,19,0,20,0,21,0,22,0,23,0,
+24,0,25,0,26,0,27,0,75,0,76,0,78,0,79,0,81,0,83,0,84,0,87,0,88,0,89,0,90,
+0,91,0,93,0,94,0,112,0,214,0,215,0,216,0,217,0,218,0,219,0,220,0,223,0,224,
+0,225,0,226,0,228,0,231,0,232,0,235,0,236,2,16,2,24,2,25,2,26,2,27,2,28,2,
+29,2,30,2,31,2,34,2,35,2,36,2,37,2,38,2,39,3,20,3,116,3,160,3,161,3,163,3,
+164,3,166,3,167,3,168,3,172,3,173,3,175,3,176,3,177,3,179,3,180,3,183,3,184,
+3,185,3,186,3,210,0,2,0,5,1,251,2,2,0,0,2,17,2,18,0,8,2,158,2,171,0,10,3,
+10,3,11,0,24,3,209,3,209,0,26,0,77,0,0,1,54,0,0,1,62,0,0,1,70,0,0,1,78,0,
+0,1,86,0,0,1,94,0,0,1,102,0,0,1,110,0,0,1,118,0,0,1,126,0,0,1,134,0,0,1,142,
+0,0,1,150,0,0,1,158,0,0,1,166,0,0,1,174,0,0,1,182,0,0,1,190,0,0,1,198,0,0,
+1,206,0,0,1,214,0,0,1,222,0,0,1,230,0,0,1,238,0,0,1,246,0,0,1,254,0,0,2,6,
+0,0,2,14,0,0,2,22,0,0,2,30,0,0,2,38,0,0,2,46,0,0,2,54,0,0,2,62,0,0,2,70,0,
+0,2,78,0,0,2,86,0,0,2,94,0,0,2,102,0,0,2,110,0,0,2,118,0,0,2,126,0,0,2,134,
+0,0,2,142,0,0,2,150,0,0,2,158,0,0,2,166,0,0,2,174,0,0,2,182,0,0,2,190,0,0,
+2,198,0,0,2,206,0,0,2,214,0,0,2,222,0,0,2,230,0,0,2,238,0,0,2,246,0,0,2,254,
+0,0,3,6,0,0,3,14,0,0,3,22,0,0,3,30,0,0,3,38,0,0,3,46,0,0,3,54,0,0,3,62,0,
+0,3,70,0,0,3,78,0,0,3,86,0,0,3,94,0,0,3,102,0,0,3,110,0,0,3,118,0,0,3,126,
+0,0,3,134,0,0,3,142,0,0,3,150,0,2,0,203,3,192,0,30,0,2,0,186,3,192,0,41,0,
+2,0,57,3,232,0,46,0,2,0,79,3,157,0,59,0,2,0,91,4,2,0,24,0,2,0,98,3,108,0,
+31,0,2,0,0,3,213,0,46,0,2,0,0,3,68,0,28,0,2,0,0,3,148,0,9,0,2,0,0,3,129,0,
+31,0,2,0,175,3,154,0,16,0,2,0,185,3,125,0,48,0,2,0,184,3,157,0,8,0,2,0,152,
+3,121,0,34,0,2,0,141,3,129,0,38,0,2,0,138,4,107,0,16,0,2,0,136,4,33,0,27,
+0,2,0,153,3,167,0,37,0,2,0,188,4,9,0,15,0,2,1,0,3,159,0,9,0,2,1,26,2,121,
+0,23,0,2,0,243,2,164,0,22,0,2,0,162,3,204,0,37,0,2,0,212,3,230,0,26,0,2,0,
+22,3,70,0,13,0,2,0,19,3,213,0,71,0,2,0,0,3,213,0,75,0,2,255,254,3,132,0,0,
+0,2,0,0,3,165,0,46,0,2,0,0,3,1,0,44,0,2,0,0,2,49,0,22,0,2,0,153,3,97,0,60,
+0,2,0,0,3,138,0,0,0,2,0,0,3,58,0,0,0,2,0,0,3,137,0,31,0,2,0,30,3,57,0,31,
+0,2,0,0,3,184,0,20,0,2,255,244,3,129,0,28,0,2,255,237,3,72,0,32,0,2,0,0,3,
+159,0,8,0,2,0,0,3,112,0,12,0,2,0,90,4,60,0,33,0,2,1,81,3,10,0,22,0,2,1,20,
+3,2,0,21,0,2,0,99,4,2,0,42,0,2,0,115,4,16,0,43,0,2,0,117,4,16,0,35,0,2,0,
+120,4,16,0,73,0,2,0,120,4,16,0,57,0,2,0,122,4,35,0,50,0,2,0,134,3,139,0,87,
+0,2,0,180,2,135,0,53,0,2,0,136,3,146,0,53,0,2,0,136,3,137,0,45,0,2,0,133,
+3,146,0,74,0,2,0,142,2,233,0,46,0,2,0,148,3,150,0,51,0,2,0,136,3,152,0,25,
+0,2,0,96,4,122,0,38,0,2,0,170,3,100,0,59,0,2,0,96,4,122,0,38,0,2,0,123,5,
+11,0,58,0,2,0,8,4,249,0,8,0,2,0,9,5,17,0,15,0,2,255,248,4,60,0,47,0,2,1,28,
+3,157,0,11,0,2,1,96,3,101,0,75,0,2,255,252,3,19,0,37,0,2,0,11,3,195,0,59,
+0,2,255,247,3,134,0,9,0,2,255,206,3,79,0,29,0,2,0,0,3,124,0,30,0,2,255,214,
+3,91,0,60,0,2,255,214,3,91,0,60,0,2,0,0,3,124,0,30,0,2,0,122,3,121,0,34,0,
+2,4,116,4,15,0,50,0,27,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,110,
+0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,
+188,0,194,0,200,0,206,0,212,0,2,0,164,0,172,0,2,0,174,0,182,0,2,0,184,0,192,
+0,2,0,194,0,202,0,2,0,204,0,212,0,2,0,214,0,222,0,2,0,224,0,232,0,2,0,234,
+0,242,0,2,0,244,0,252,0,2,0,254,1,6,0,2,1,8,1,16,0,2,1,18,1,26,0,2,1,28,1,
+36,0,2,1,38,1,46,0,2,1,48,1,56,0,2,1,58,1,66,0,2,1,68,1,76,0,2,1,78,1,86,
+0,2,1,88,1,96,0,2,1,98,1,106,0,2,1,108,1,116,0,2,1,118,1,126,0,2,1,128,1,
+136,0,2,1,138,1,146,0,2,1,148,1,156,0,2,1,158,1,166,0,3,1,168,1,176,1,184,
+0,2,3,0,5,229,0,53,0,2,0,132,5,128,0,74,0,2,3,160,5,194,0,46,0,2,0,192,5,
+109,0,67,0,2,3,0,5,229,0,53,0,2,0,111,6,65,0,85,0,2,3,160,5,194,0,46,0,2,
+0,172,6,46,0,78,0,2,3,0,5,229,0,53,0,2,0,131,4,188,0,54,0,2,3,160,5,194,0,
+46,0,2,0,191,4,169,0,47,0,2,3,0,5,229,0,53,0,2,0,131,4,188,0,54,0,2,3,160,
+5,194,0,46,0,2,0,191,4,169,0,47,0,2,3,0,5,229,0,53,0,2,0,161,5,232,0,91,0,
+2,3,160,5,194,0,46,0,2,0,222,5,213,0,84,0,2,3,0,5,229,0,53,0,2,0,143,6,88,
+0,100,0,2,3,160,5,194,0,46,0,2,0,203,6,69,0,93,0,2,3,0,5,229,0,53,0,2,0,131,
+4,188,0,54,0,2,3,160,5,194,0,46,0,2,0,191,4,169,0,47,0,2,3,0,5,229,0,53,0,
+2,1,146,6,69,0,85,0,2,3,160,5,194,0,46,0,2,1,179,6,51,0,78,0,2,2,229,7,122,
+0,81,0,2,0,131,4,188,0,54,0,2,3,133,7,87,0,74,0,2,0,191,4,169,0,47,0,2,2,
+252,7,70,0,66,0,2,0,131,4,188,0,54,0,2,3,156,7,35,0,59,0,2,0,191,4,169,0,
+47,0,2,3,0,7,150,0,81,0,2,0,131,4,188,0,54,0,2,3,158,7,116,0,74,0,2,0,191,
+4,169,0,47,0,2,3,0,5,229,0,53,0,2,0,131,4,188,0,54,0,2,3,160,5,194,0,46,0,
+2,0,191,4,169,0,47,0,2,3,0,5,229,0,53,0,2,0,131,4,188,0,54,0,2,3,160,5,194,
+0,46,0,2,0,191,4,169,0,47,0,2,6,91,5,194,0,65,0,2,4,130,4,121,0,62,0,2,1,
+216,4,26,0,66,0,5,0,0,0,1,0,8,0,1,0,12,0,62,0,1,0,96,1,118,0,1,0,23,0,28,
+0,77,0,80,0,85,0,86,0,92,0,95,0,227,0,234,0,237,2,32,2,33,3,162,3,165,3,169,
+3,170,3,171,3,174,3,178,3,181,3,182,5,237,5,238,0,2,0,5,1,251,2,2,0,0,2,17,
+2,18,0,8,2,158,2,171,0,10,3,10,3,11,0,24,3,209,3,209,0,26,0,23,0,0,0,94,0,
+0,0,102,0,0,0,110,0,0,0,118,0,0,0,126,0,0,0,134,0,0,0,142,0,0,0,150,0,0,0,
+158,0,0,0,166,0,0,0,174,0,0,0,182,0,0,0,190,0,0,0,198,0,0,0,206,0,0,0,214,
+0,0,0,222,0,0,0,230,0,0,0,238,0,0,0,246,0,0,0,254,0,0,1,6,0,0,1,14,0,2,0,
+0,255,73,0,9,0,2,0,161,0,12,0,18,0,2,0,144,255,244,0,8,0,2,0,173,0,92,0,27,
+0,2,0,18,255,251,0,14,0,2,0,0,254,156,0,0,0,2,0,162,0,135,0,44,0,2,0,0,255,
+168,0,57,0,2,0,0,254,110,0,8,0,2,0,0,255,52,0,30,0,2,0,173,0,92,0,43,0,2,
+0,173,0,92,0,35,0,2,0,6,254,81,0,37,0,2,255,186,255,17,0,76,0,2,0,5,255,32,
+0,9,0,2,255,249,255,3,0,14,0,2,255,254,254,234,0,46,0,2,0,223,255,244,0,21,
+0,2,255,220,255,93,0,8,0,2,0,107,253,238,0,27,0,2,0,0,255,154,0,27,0,2,0,
+255,255,44,0,23,0,2,0,190,255,45,0,23,0,27,0,56,0,62,0,68,0,74,0,80,0,86,
+0,92,0,98,0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,
+0,170,0,176,0,182,0,188,0,194,0,200,0,206,0,212,0,2,0,164,0,172,0,2,0,174,
+0,182,0,2,0,184,0,192,0,2,0,194,0,202,0,2,0,204,0,212,0,2,0,214,0,222,0,2,
+0,224,0,232,0,2,0,234,0,242,0,2,0,244,0,252,0,2,0,254,1,6,0,2,1,8,1,16,0,
+2,1,18,1,26,0,2,1,28,1,36,0,2,1,38,1,46,0,2,1,48,1,56,0,2,1,58,1,66,0,2,1,
+68,1,76,0,2,1,78,1,86,0,2,1,88,1,96,0,2,1,98,1,106,0,2,1,108,1,116,0,2,1,
+118,1,126,0,2,1,128,1,136,0,2,1,138,1,146,0,2,1,148,1,156,0,2,1,158,1,166,
+0,3,1,168,1,176,1,184,0,2,3,29,255,150,0,55,0,2,1,158,255,150,0,56,0,2,3,
+190,255,150,0,48,0,2,1,228,255,150,0,49,0,2,3,29,255,150,0,55,0,2,1,158,255,
+150,0,56,0,2,3,190,255,150,0,48,0,2,1,228,255,150,0,49,0,2,3,29,255,150,0,
+55,0,2,1,193,254,38,0,85,0,2,3,190,255,150,0,48,0,2,2,7,254,38,0,78,0,2,3,
+29,255,150,0,55,0,2,1,158,255,150,0,56,0,2,3,190,255,150,0,48,0,2,1,228,255,
+150,0,49,0,2,3,29,255,150,0,55,0,2,1,158,255,150,0,56,0,2,3,190,255,150,0,
+48,0,2,1,228,255,150,0,49,0,2,3,29,255,150,0,55,0,2,1,158,255,150,0,56,0,
+2,3,190,255,150,0,48,0,2,1,228,255,150,0,49,0,2,3,29,255,150,0,55,0,2,1,196,
+254,17,0,102,0,2,3,190,255,150,0,48,0,2,2,10,254,15,0,95,0,2,3,29,255,150,
+0,55,0,2,1,158,255,150,0,56,0,2,3,190,255,150,0,48,0,2,1,228,255,150,0,49,
+0,2,3,29,255,150,0,55,0,2,1,158,255,150,0,56,0,2,3,190,255,150,0,48,0,2,1,
+228,255,150,0,49,0,2,3,29,255,150,0,55,0,2,1,158,255,150,0,56,0,2,3,190,255,
+150,0,48,0,2,1,228,255,150,0,49,0,2,3,29,255,150,0,55,0,2,1,158,255,150,0,
+56,0,2,3,190,255,150,0,48,0,2,1,228,255,150,0,49,0,2,3,16,253,239,0,82,0,
+2,1,158,255,150,0,56,0,2,3,206,253,239,0,75,0,2,1,228,255,150,0,49,0,2,3,
+29,255,150,0,55,0,2,1,158,255,150,0,56,0,2,3,190,255,150,0,48,0,2,1,228,255,
+150,0,49,0,2,6,174,255,150,0,63,0,2,4,190,255,150,0,64,0,2,2,113,255,150,
+0,67,0,5,0,0,0,1,0,8,0,1,0,12,0,28,0,1,0,60,1,106,0,2,0,2,3,190,3,204,0,0,
+5,219,5,228,0,15,0,1,0,14,3,214,3,215,3,218,3,219,3,220,3,222,3,223,3,226,
+3,227,3,230,3,231,3,232,3,235,3,236,0,25,0,0,0,102,0,0,0,110,0,0,0,118,0,
+0,0,126,0,0,0,134,0,0,0,142,0,0,0,150,0,0,0,158,0,0,0,166,0,0,0,174,0,0,0,
+182,0,0,0,190,0,0,0,198,0,0,0,206,0,0,0,214,0,0,0,222,0,0,0,230,0,0,0,238,
+0,0,0,246,0,0,0,254,0,0,1,6,0,0,1,14,0,0,1,22,0,0,1,30,0,0,1,38,0,2,0,206,
+254,236,0,10,0,2,0,212,254,236,0,17,0,2,1,15,254,236,0,44,0,2,1,57,254,236,
+0,65,0,2,1,19,254,236,0,35,0,2,0,250,254,236,0,27,0,2,1,36,254,236,0,22,0,
+2,1,29,254,236,0,33,0,2,1,29,254,236,0,33,0,2,1,28,254,236,0,43,0,2,1,49,
+254,236,0,60,0,2,1,41,254,236,0,53,0,2,1,36,254,236,0,49,0,2,1,49,254,236,
+0,33,0,2,1,19,254,236,0,29,0,2,1,0,254,236,0,22,0,2,0,249,254,236,0,11,0,
+2,0,243,254,236,0,25,0,2,0,245,254,236,0,34,0,2,1,18,254,236,0,18,0,2,0,247,
+254,235,0,31,0,2,1,11,254,236,0,35,0,2,0,255,254,236,0,7,0,2,1,3,254,236,
+0,46,0,2,0,251,254,236,0,34,0,14,0,30,0,36,0,44,0,50,0,58,0,68,0,74,0,82,
+0,88,0,96,0,102,0,110,0,120,0,126,0,2,0,104,0,112,0,3,0,114,0,122,0,130,0,
+2,0,130,0,138,0,3,0,140,0,148,0,156,0,4,0,156,0,164,0,172,0,180,0,2,0,178,
+0,186,0,3,0,188,0,196,0,204,0,2,0,204,0,212,0,3,0,214,0,222,0,230,0,2,0,230,
+0,238,0,3,0,240,0,248,1,0,0,4,1,0,1,8,1,16,1,24,0,2,1,22,1,30,0,3,1,32,1,
+40,1,48,0,2,2,175,255,30,0,28,0,2,4,223,255,30,0,29,0,2,1,151,255,30,0,30,
+0,2,3,199,255,30,0,31,0,2,5,247,255,30,0,32,0,2,5,101,255,60,0,76,0,2,7,149,
+255,60,0,75,0,2,4,77,255,60,0,74,0,2,6,125,255,60,0,72,0,2,8,173,255,60,0,
+73,0,2,3,53,255,60,0,78,0,2,5,101,255,60,0,76,0,2,7,149,255,60,0,75,0,2,9,
+197,255,60,0,77,0,2,4,201,255,110,0,54,0,2,6,249,255,110,0,55,0,2,3,177,255,
+110,0,57,0,2,5,225,255,110,0,56,0,2,8,17,255,110,0,58,0,2,2,145,255,110,0,
+76,0,2,4,193,255,110,0,77,0,2,1,121,255,110,0,75,0,2,3,169,255,110,0,74,0,
+2,5,217,255,110,0,78,0,2,3,177,255,230,0,125,0,2,5,225,255,230,0,127,0,2,
+2,153,255,230,0,124,0,2,4,201,255,230,0,126,0,2,6,249,255,230,0,128,0,2,1,
+129,255,230,0,123,0,2,3,177,255,230,0,125,0,2,5,225,255,230,0,127,0,2,8,17,
+255,230,0,129,0,2,3,197,255,190,1,8,0,2,5,245,255,190,1,7,0,2,2,173,255,190,
+1,6,0,2,4,221,255,190,1,4,0,2,7,13,255,190,1,5,0,6,1,0,0,1,0,8,0,1,0,12,0,
+170,0,1,1,72,4,230,0,1,0,77,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,
+0,27,0,75,0,76,0,78,0,79,0,81,0,83,0,84,0,87,0,88,0,89,0,90,0,91,0,93,0,94,
+0,112,0,214,0,215,0,216,0,217,0,218,0,219,0,220,0,223,0,224,0,225,0,226,0,
+228,0,231,0,232,0,235,0,236,2,16,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,
+2,34,2,35,2,36,2,37,2,38,2,39,3,20,3,116,3,160,3,161,3,163,3,164,3,166,3,
+167,3,168,3,172,3,173,3,175,3,176,3,177,3,179,3,180,3,183,3,184,3,185,3,186,
+3,210,0,1,0,77,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,75,0,76,
+0,78,0,79,0,81,0,83,0,84,0,87,0,88,0,89,0,90,0,91,0,93,0,94,0,112,0,214,0,
+215,0,216,0,217,0,218,0,219,0,220,0,223,0,224,0,225,0,226,0,228,0,231,0,232,
+0,235,0,236,2,16,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,34,2,35,2,36,2,
+37,2,38,2,39,3,20,3,116,3,160,3,161,3,163,3,164,3,166,3,167,3,168,3,172,3,
+173,3,175,3,176,3,177,3,179,3,180,3,183,3,184,3,185,3,186,3,210,0,77,0,0,
+1,54,0,0,1,62,0,0,1,70,0,0,1,78,0,0,1,86,0,0,1,94,0,0,1,102,0,0,1,110,0,0,
+1,118,0,0,1,126,0,0,1,134,0,0,1,142,0,0,1,150,0,0,1,158,0,0,1,166,0,0,1,174,
+0,0,1,182,0,0,1,190,0,0,1,198,0,0,1,206,0,0,1,214,0,0,1,222,0,0,1,230,0,0,
+1,238,0,0,1,246,0,0,1,254,0,0,2,6,0,0,2,14,0,0,2,22,0,0,2,30,0,0,2,38,0,0,
+2,46,0,0,2,54,0,0,2,62,0,0,2,70,0,0,2,78,0,0,2,86,0,0,2,94,0,0,2,102,0,0,
+2,110,0,0,2,118,0,0,2,126,0,0,2,134,0,0,2,142,0,0,2,150,0,0,2,158,0,0,2,166,
+0,0,2,174,0,0,2,182,0,0,2,190,0,0,2,198,0,0,2,206,0,0,2,214,0,0,2,222,0,0,
+2,230,0,0,2,238,0,0,2,246,0,0,2,254,0,0,3,6,0,0,3,14,0,0,3,22,0,0,3,30,0,
+0,3,38,0,0,3,46,0,0,3,54,0,0,3,62,0,0,3,70,0,0,3,78,0,0,3,86,0,0,3,94,0,0,
+3,102,0,0,3,110,0,0,3,118,0,0,3,126,0,0,3,134,0,0,3,142,0,0,3,150,0,2,0,203,
+3,192,0,30,0,2,0,186,3,192,0,41,0,2,0,57,3,232,0,46,0,2,0,79,3,157,0,59,0,
+2,0,91,4,2,0,24,0,2,0,98,3,108,0,31,0,2,0,0,3,213,0,46,0,2,0,0,3,68,0,28,
+0,2,0,0,3,148,0,9,0,2,0,0,3,129,0,31,0,2,0,175,3,154,0,16,0,2,0,185,3,125,
+0,48,0,2,0,184,3,157,0,8,0,2,0,152,3,121,0,34,0,2,0,141,3,129,0,38,0,2,0,
+138,4,107,0,16,0,2,0,136,4,33,0,27,0,2,0,153,3,167,0,37,0,2,0,188,4,9,0,15,
+0,2,1,0,3,159,0,9,0,2,1,26,2,121,0,23,0,2,0,243,2,164,0,22,0,2,0,162,3,204,
+0,37,0,2,0,212,3,230,0,26,0,2,0,22,3,70,0,13,0,2,0,19,3,213,0,71,0,2,0,0,
+3,213,0,75,0,2,255,254,3,132,0,0,0,2,0,0,3,165,0,46,0,2,0,0,3,1,0,44,0,2,
+0,0,2,49,0,22,0,2,0,153,3,97,0,60,0,2,0,0,3,138,0,0,0,2,0,0,3,58,0,0,0,2,
+0,0,3,137,0,31,0,2,0,30,3,57,0,31,0,2,0,0,3,184,0,20,0,2,255,244,3,129,0,
+28,0,2,255,237,3,72,0,32,0,2,0,0,3,159,0,8,0,2,0,0,3,112,0,12,0,2,0,90,4,
+60,0,33,0,2,1,81,3,10,0,22,0,2,1,20,3,2,0,21,0,2,0,99,4,2,0,42,0,2,0,115,
+4,16,0,43,0,2,0,117,4,16,0,35,0,2,0,120,4,16,0,73,0,2,0,120,4,16,0,57,0,2,
+0,122,4,35,0,50,0,2,0,134,3,139,0,87,0,2,0,180,2,135,0,53,0,2,0,136,3,146,
+0,53,0,2,0,136,3,137,0,45,0,2,0,133,3,146,0,74,0,2,0,142,2,233,0,46,0,2,0,
+148,3,150,0,51,0,2,0,136,3,152,0,25,0,2,0,96,4,122,0,38,0,2,0,170,3,100,0,
+59,0,2,0,96,4,122,0,38,0,2,0,123,5,11,0,58,0,2,0,8,4,249,0,8,0,2,0,9,5,17,
+0,15,0,2,255,248,4,60,0,47,0,2,1,28,3,157,0,11,0,2,1,96,3,101,0,75,0,2,255,
+252,3,19,0,37,0,2,0,11,3,195,0,59,0,2,255,247,3,134,0,9,0,2,255,206,3,79,
+0,29,0,2,0,0,3,124,0,30,0,2,255,214,3,91,0,60,0,2,255,214,3,91,0,60,0,2,0,
+0,3,124,0,30,0,2,0,122,3,121,0,34,0,2,4,116,4,15,0,50,0,77,0,156,0,164,0,
+172,0,180,0,188,0,196,0,204,0,212,0,220,0,228,0,236,0,244,0,252,1,4,1,12,
+1,20,1,28,1,36,1,44,1,52,1,60,1,68,1,76,1,84,1,92,1,100,1,108,1,116,1,124,
+1,132,1,140,1,148,1,156,1,164,1,172,1,180,1,188,1,196,1,204,1,212,1,220,1,
+228,1,236,1,244,1,252,2,4,2,12,2,20,2,28,2,36,2,44,2,52,2,60,2,68,2,76,2,
+84,2,92,2,100,2,108,2,116,2,124,2,132,2,140,2,148,2,156,2,164,2,172,2,180,
+2,188,2,196,2,204,2,212,2,220,2,228,2,236,2,244,2,252,0,2,0,149,5,127,0,31,
+0,2,0,135,5,123,0,42,0,2,0,98,5,201,0,47,0,2,0,166,5,210,0,60,0,2,0,135,5,
+9,0,25,0,2,0,150,5,51,0,32,0,2,0,0,6,153,0,47,0,2,0,3,5,198,0,29,0,2,255,
+249,4,145,0,10,0,2,255,255,5,5,0,32,0,2,0,129,5,34,0,17,0,2,0,157,5,11,0,
+49,0,2,0,157,4,155,0,9,0,2,0,118,5,11,0,35,0,2,0,111,4,191,0,39,0,2,0,139,
+5,47,0,17,0,2,0,116,5,166,0,28,0,2,0,160,5,123,0,38,0,2,0,208,5,75,0,16,0,
+2,0,250,4,65,0,10,0,2,0,255,4,14,0,24,0,2,0,190,4,58,0,23,0,2,0,176,5,180,
+0,38,0,2,1,17,5,132,0,27,0,2,0,18,5,90,0,14,0,2,0,102,6,171,0,72,0,2,255,
+64,6,162,0,76,0,2,255,237,4,207,0,1,0,2,255,178,5,244,0,47,0,2,255,241,5,
+90,0,45,0,2,255,253,3,187,0,23,0,2,0,11,5,45,0,61,0,2,0,0,4,168,0,1,0,2,0,
+0,4,168,0,21,0,2,0,0,4,214,0,32,0,2,255,241,5,31,0,32,0,2,0,3,4,89,0,19,0,
+2,255,249,4,186,0,29,0,2,255,221,5,56,0,33,0,2,0,0,4,241,0,9,0,2,0,3,4,226,
+0,13,0,2,0,120,5,104,0,34,0,2,1,58,4,193,0,23,0,2,0,247,4,188,0,22,0,2,0,
+111,5,158,0,43,0,2,0,51,6,118,0,44,0,2,0,66,6,35,0,36,0,2,0,47,6,148,0,74,
+0,2,0,64,6,148,0,58,0,2,0,31,6,108,0,51,0,2,0,63,6,23,0,88,0,2,0,116,4,185,
+0,54,0,2,0,79,5,218,0,54,0,2,0,92,5,113,0,46,0,2,0,47,6,23,0,75,0,2,0,116,
+4,196,0,47,0,2,0,60,6,115,0,52,0,2,0,136,4,196,0,26,0,2,0,6,5,94,0,37,0,2,
+0,123,5,11,0,58,0,2,255,156,6,63,0,76,0,2,255,201,5,66,0,117,0,2,0,5,6,21,
+0,9,0,2,255,249,5,252,0,14,0,2,255,254,5,103,0,46,0,2,0,236,5,136,0,22,0,
+2,1,62,5,11,0,74,0,2,0,9,4,253,0,36,0,2,255,251,5,54,0,58,0,2,255,219,5,32,
+0,22,0,2,255,206,4,248,0,28,0,2,0,0,5,37,0,27,0,2,0,23,5,37,0,28,0,2,0,23,
+5,37,0,28,0,2,0,0,5,37,0,27,0,2,0,88,5,11,0,35,0,2,4,69,6,185,0,51,0,6,2,
+0,0,1,0,8,0,1,0,12,0,62,0,1,0,112,1,134,0,1,0,23,0,28,0,77,0,80,0,85,0,86,
+0,92,0,95,0,227,0,234,0,237,2,32,2,33,3,162,3,165,3,169,3,170,3,171,3,174,
+3,178,3,181,3,182,5,237,5,238,0,1,0,23,0,28,0,77,0,80,0,85,0,86,0,92,0,95,
+0,227,0,234,0,237,2,32,2,33,3,162,3,165,3,169,3,170,3,171,3,174,3,178,3,181,
+3,182,5,237,5,238,0,23,0,0,0,94,0,0,0,102,0,0,0,110,0,0,0,118,0,0,0,126,0,
+0,0,134,0,0,0,142,0,0,0,150,0,0,0,158,0,0,0,166,0,0,0,174,0,0,0,182,0,0,0,
+190,0,0,0,198,0,0,0,206,0,0,0,214,0,0,0,222,0,0,0,230,0,0,0,238,0,0,0,246,
+0,0,0,254,0,0,1,6,0,0,1,14,0,2,0,0,255,73,0,9,0,2,0,161,0,12,0,18,0,2,0,144,
+255,244,0,8,0,2,0,173,0,92,0,27,0,2,0,18,255,251,0,14,0,2,0,0,254,156,0,0,
+0,2,0,162,0,135,0,44,0,2,0,0,255,168,0,57,0,2,0,0,254,110,0,8,0,2,0,0,255,
+52,0,30,0,2,0,173,0,92,0,43,0,2,0,173,0,92,0,35,0,2,0,6,254,81,0,37,0,2,255,
+186,255,17,0,76,0,2,0,5,255,32,0,9,0,2,255,249,255,3,0,14,0,2,255,254,254,
+234,0,46,0,2,0,223,255,244,0,21,0,2,255,220,255,93,0,8,0,2,0,107,253,238,
+0,27,0,2,0,0,253,241,0,30,0,2,0,255,255,44,0,23,0,2,0,190,255,45,0,23,0,23,
+0,48,0,56,0,64,0,72,0,80,0,88,0,96,0,104,0,112,0,120,0,128,0,136,0,144,0,
+152,0,160,0,168,0,176,0,184,0,192,0,200,0,208,0,216,0,224,0,2,0,15,254,126,
+0,10,0,2,0,208,254,238,0,19,0,2,0,176,255,33,0,9,0,2,0,208,254,236,0,28,0,
+2,0,22,253,231,0,13,0,2,0,0,253,62,0,13,0,2,0,200,255,0,0,45,0,2,0,153,253,
+240,0,58,0,2,255,253,253,48,0,9,0,2,0,30,253,98,0,31,0,2,0,188,254,11,0,44,
+0,2,0,185,254,104,0,36,0,2,0,96,253,109,0,38,0,2,0,126,253,76,0,38,0,2,0,
+8,254,4,0,8,0,2,0,9,254,24,0,15,0,2,255,248,253,191,0,47,0,2,0,176,254,52,
+0,9,0,2,0,21,253,186,0,23,0,2,255,206,255,116,0,28,0,2,0,0,255,154,0,27,0,
+2,1,26,253,171,0,22,0,2,0,243,253,171,0,22,0,1,0,0,0,10,0,144,1,36,0,2,97,
+114,97,98,0,14,108,97,116,110,0,36,0,26,0,3,70,65,82,32,0,46,83,78,68,32,
+0,68,85,82,68,32,0,90,0,90,0,0,0,0,255,255,0,7,0,0,0,1,0,2,0,3,0,8,0,9,0,
+10,0,0,255,255,0,8,0,0,0,1,0,2,0,3,0,8,0,9,0,5,0,10,0,0,255,255,0,8,0,0,0,
+1,0,2,0,3,0,8,0,9,0,6,0,10,0,0,255,255,0,8,0,0,0,1,0,2,0,3,0,8,0,9,0,4,0,
+10,0,0,255,255,0,1,0,7,0,11,99,99,109,112,0,68,102,105,110,97,0,84,105,110,
+105,116,0,90,108,105,103,97,0,96,108,111,99,108,0,104,108,111,99,108,0,110,
+108,111,99,108,0,116,108,111,99,108,0,122,109,101,100,105,0,128,114,108,105,
+103,0,134,116,110,117,109,0,142,0,0,0,6,0,0,0,1,0,2,0,15,0,19,0,20,0,0,0,
+1,0,3,0,0,0,1,0,4,0,0,0,2,0,10,0,22,0,0,0,1,0,11,0,0,0,1,0,13,0,0,0,1,0,12,
+0,0,0,1,0,21,0,0,0,1,0,5,0,0,0,2,0,6,0,7,0,0,0,1,0,14,0,23,0,48,0,86,1,138,
+1,178,3,224,5,196,7,168,8,210,9,178,9,252,10,70,10,108,10,138,10,164,10,198,
+11,22,11,226,12,12,12,118,13,92,13,244,14,174,14,196,0,2,0,0,0,1,0,8,0,1,
+0,22,0,2,0,10,0,16,0,2,0,39,0,84,0,2,0,39,0,85,0,1,0,2,0,35,0,37,0,4,0,0,
+0,1,0,8,0,1,1,18,0,11,0,28,0,46,0,64,0,82,0,100,0,118,0,136,0,194,0,236,0,
+254,1,8,0,2,0,6,0,12,2,36,0,2,0,81,2,27,0,2,0,84,0,2,0,6,0,12,2,34,0,2,0,
+81,2,29,0,2,0,84,0,2,0,6,0,12,2,35,0,2,0,81,2,32,0,2,0,85,0,2,0,6,0,12,2,
+37,0,2,0,81,2,28,0,2,0,84,0,2,0,6,0,12,2,38,0,2,0,81,2,30,0,2,0,84,0,2,0,
+6,0,12,2,39,0,2,0,81,2,33,0,2,0,85,0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,
+2,36,0,2,0,75,2,34,0,2,0,76,2,35,0,2,0,77,2,37,0,2,0,78,2,38,0,2,0,79,2,39,
+0,2,0,80,3,20,0,2,0,112,0,5,0,12,0,18,0,24,0,30,0,36,2,27,0,2,0,75,2,29,0,
+2,0,76,2,28,0,2,0,78,2,30,0,2,0,79,2,31,0,2,3,116,0,2,0,6,0,12,2,32,0,2,0,
+77,2,33,0,2,0,80,0,1,0,4,3,20,0,2,0,81,0,1,0,4,2,31,0,2,0,84,0,1,0,11,0,75,
+0,76,0,77,0,78,0,79,0,80,0,81,0,84,0,85,0,112,3,116,0,4,0,0,0,1,0,8,0,1,0,
+26,0,1,0,8,0,2,0,6,0,12,0,35,0,2,0,84,0,37,0,2,0,85,0,1,0,1,0,39,0,1,0,0,
+0,1,0,8,0,2,1,164,0,207,3,22,1,170,1,171,1,172,1,173,1,174,1,177,1,178,1,
+181,1,182,1,185,1,188,1,191,1,194,1,197,1,198,1,199,1,200,1,201,1,204,1,207,
+1,210,1,213,1,216,1,219,1,222,3,25,3,28,3,31,3,34,3,37,1,225,1,228,1,231,
+1,234,1,237,1,240,1,243,1,246,1,247,1,248,2,9,2,4,1,54,2,42,2,43,2,44,2,45,
+2,46,2,47,1,70,1,64,1,55,2,48,2,51,1,58,1,67,1,61,2,54,2,57,1,82,1,79,2,60,
+1,85,1,88,1,94,2,63,2,64,2,65,1,92,1,91,1,93,2,66,2,67,1,96,2,68,2,69,2,70,
+2,71,2,72,2,73,1,95,2,74,2,75,2,78,2,81,2,84,2,87,2,90,2,93,2,14,2,96,2,99,
+1,73,2,102,1,76,2,105,2,106,1,97,2,107,2,110,2,113,1,136,2,116,1,100,2,119,
+1,106,1,103,2,122,2,125,2,128,2,131,2,134,2,137,2,140,1,109,1,110,2,143,2,
+146,1,115,2,147,1,111,1,112,2,21,2,20,2,150,1,143,1,140,1,139,1,141,1,144,
+3,1,1,142,1,150,2,151,3,5,3,2,1,145,3,6,1,118,1,119,1,243,2,172,2,173,3,9,
+2,154,2,157,2,174,2,177,2,182,2,183,2,186,2,189,2,192,2,195,2,198,2,201,2,
+204,2,205,2,206,2,207,2,210,2,213,2,216,2,219,2,222,2,225,2,228,2,231,2,234,
+2,237,2,240,2,243,2,246,2,249,2,252,2,253,2,254,3,81,3,40,3,43,3,46,3,47,
+3,50,3,51,3,52,3,55,3,58,3,61,3,62,3,65,3,68,3,69,3,72,3,75,3,78,3,120,3,
+124,3,128,3,132,3,136,3,140,3,144,3,148,3,152,3,156,3,158,0,2,0,21,0,32,0,
+32,0,0,0,34,0,63,0,1,0,65,0,74,0,31,0,110,0,111,0,41,0,113,0,115,0,43,0,117,
+0,211,0,46,0,213,0,213,0,141,0,238,0,239,0,142,0,250,0,252,0,144,0,255,1,
+47,0,147,3,119,3,119,0,196,3,123,3,123,0,197,3,127,3,127,0,198,3,131,3,131,
+0,199,3,135,3,135,0,200,3,139,3,139,0,201,3,143,3,143,0,202,3,147,3,147,0,
+203,3,151,3,151,0,204,3,155,3,155,0,205,3,157,3,157,0,206,0,1,0,0,0,1,0,8,
+0,2,1,36,0,143,3,23,1,175,1,179,1,183,1,186,1,189,1,192,1,195,1,202,1,205,
+1,208,1,211,1,214,1,217,1,220,1,223,3,26,3,29,3,32,3,35,3,38,1,226,1,229,
+1,232,1,235,1,238,1,241,1,244,1,148,1,249,2,8,2,15,3,102,1,71,1,65,1,56,2,
+49,2,52,1,59,1,68,1,62,2,55,2,58,1,83,1,80,2,61,1,86,1,89,2,76,2,79,2,82,
+2,85,2,88,2,91,2,94,2,15,2,97,2,100,1,74,2,103,1,77,1,226,1,74,1,98,2,108,
+2,111,2,114,1,137,2,117,1,101,2,120,1,107,1,104,2,123,2,126,2,129,2,132,2,
+135,2,138,2,141,1,148,1,71,2,144,1,59,1,116,2,148,1,113,3,18,1,151,3,3,1,
+146,1,59,3,7,2,152,2,155,2,175,2,178,2,180,2,184,2,187,2,190,2,193,2,196,
+2,199,2,202,2,208,2,211,2,214,2,217,2,220,2,223,2,226,2,229,2,232,2,235,2,
+238,2,241,2,244,2,247,2,250,2,255,3,82,3,41,3,44,3,48,3,53,3,56,3,59,3,63,
+3,66,3,70,3,73,3,76,3,79,3,121,3,125,3,129,3,133,3,137,3,141,3,145,3,149,
+3,153,0,2,0,30,0,32,0,32,0,0,0,38,0,38,0,1,0,40,0,40,0,2,0,42,0,46,0,3,0,
+51,0,63,0,8,0,65,0,71,0,21,0,73,0,74,0,28,0,110,0,111,0,30,0,120,0,135,0,
+32,0,154,0,191,0,48,0,193,0,194,0,86,0,204,0,204,0,88,0,206,0,206,0,89,0,
+208,0,209,0,90,0,250,0,252,0,92,0,255,1,8,0,95,1,12,1,26,0,105,1,29,1,32,
+0,120,1,34,1,34,0,124,1,37,1,39,0,125,1,42,1,47,0,128,3,119,3,119,0,134,3,
+123,3,123,0,135,3,127,3,127,0,136,3,131,3,131,0,137,3,135,3,135,0,138,3,139,
+3,139,0,139,3,143,3,143,0,140,3,147,3,147,0,141,3,151,3,151,0,142,0,1,0,0,
+0,1,0,8,0,2,1,36,0,143,3,24,1,176,1,180,1,184,1,187,1,190,1,193,1,196,1,203,
+1,206,1,209,1,212,1,215,1,218,1,221,1,224,3,27,3,30,3,33,3,36,3,39,1,227,
+1,230,1,233,1,236,1,239,1,242,1,245,1,149,1,250,2,11,2,13,3,101,1,72,1,66,
+1,57,2,50,2,53,1,60,1,69,1,63,2,56,2,59,1,84,1,81,2,62,1,87,1,90,2,77,2,80,
+2,83,2,86,2,89,2,92,2,95,2,13,2,98,2,101,1,75,2,104,1,78,1,227,1,75,1,99,
+2,109,2,112,2,115,1,138,2,118,1,102,2,121,1,108,1,105,2,124,2,127,2,130,2,
+133,2,136,2,139,2,142,1,149,1,72,2,145,1,60,1,117,2,149,1,114,3,19,1,152,
+3,4,1,147,1,60,3,8,2,153,2,156,2,176,2,179,2,181,2,185,2,188,2,191,2,194,
+2,197,2,200,2,203,2,209,2,212,2,215,2,218,2,221,2,224,2,227,2,230,2,233,2,
+236,2,239,2,242,2,245,2,248,2,251,3,0,3,83,3,42,3,45,3,49,3,54,3,57,3,60,
+3,64,3,67,3,71,3,74,3,77,3,80,3,122,3,126,3,130,3,134,3,138,3,142,3,146,3,
+150,3,154,0,2,0,30,0,32,0,32,0,0,0,38,0,38,0,1,0,40,0,40,0,2,0,42,0,46,0,
+3,0,51,0,63,0,8,0,65,0,71,0,21,0,73,0,74,0,28,0,110,0,111,0,30,0,120,0,135,
+0,32,0,154,0,191,0,48,0,193,0,194,0,86,0,204,0,204,0,88,0,206,0,206,0,89,
+0,208,0,209,0,90,0,250,0,252,0,92,0,255,1,8,0,95,1,12,1,26,0,105,1,29,1,32,
+0,120,1,34,1,34,0,124,1,37,1,39,0,125,1,42,1,47,0,128,3,119,3,119,0,134,3,
+123,3,123,0,135,3,127,3,127,0,136,3,131,3,131,0,137,3,135,3,135,0,138,3,139,
+3,139,0,139,3,143,3,143,0,140,3,147,3,147,0,141,3,151,3,151,0,142,0,4,0,8,
+0,1,0,8,0,1,1,6,0,12,0,30,0,96,0,162,0,172,0,182,0,192,0,202,0,212,0,222,
+0,232,0,242,0,252,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,2,17,0,2,1,
+54,1,251,0,2,1,170,1,253,0,2,1,171,1,255,0,2,1,173,2,1,0,2,1,177,2,158,0,
+2,2,42,2,160,0,2,2,43,2,162,0,2,2,44,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,
+54,0,60,2,18,0,2,1,54,1,252,0,2,1,170,1,254,0,2,1,171,2,0,0,2,1,173,2,2,0,
+2,1,177,2,159,0,2,2,42,2,161,0,2,2,43,2,163,0,2,2,44,0,1,0,4,2,164,0,2,1,
+177,0,1,0,4,2,165,0,2,1,177,0,1,0,4,2,166,0,2,1,177,0,1,0,4,2,167,0,2,1,177,
+0,1,0,4,2,168,0,2,1,177,0,1,0,4,2,169,0,2,1,177,0,1,0,4,2,170,0,2,1,177,0,
+1,0,4,2,171,0,2,1,177,0,1,0,4,3,10,0,2,1,177,0,1,0,4,3,11,0,2,1,177,0,1,0,
+12,1,235,1,236,2,129,2,130,2,132,2,133,2,135,2,136,2,138,2,139,2,250,2,251,
+0,5,0,8,0,1,0,8,0,2,0,16,0,50,0,4,0,0,0,180,0,198,0,0,0,1,0,15,1,235,1,236,
+2,129,2,130,2,132,2,133,2,135,2,136,2,138,2,139,2,250,2,251,3,141,3,142,4,
+103,0,2,0,21,1,54,1,54,0,3,1,170,1,171,0,3,1,173,1,173,0,3,1,177,1,177,0,
+3,1,235,1,235,0,1,1,236,1,236,0,2,2,42,2,43,0,3,2,129,2,129,0,1,2,130,2,130,
+0,2,2,132,2,132,0,1,2,133,2,133,0,2,2,135,2,135,0,1,2,136,2,136,0,2,2,138,
+2,138,0,1,2,139,2,139,0,2,2,250,2,250,0,1,2,251,2,251,0,2,3,141,3,141,0,1,
+3,142,3,142,0,2,4,103,4,103,0,2,5,59,5,59,0,3,0,1,0,4,0,2,0,2,0,3,0,0,0,8,
+0,1,0,8,0,1,0,4,0,2,0,2,0,3,0,0,0,9,0,1,0,9,0,1,0,0,0,1,0,8,0,2,0,34,0,14,
+3,249,3,246,3,250,3,251,3,238,3,237,3,247,3,248,3,241,3,242,3,243,3,245,3,
+244,4,9,0,1,0,14,1,54,1,170,1,171,1,173,1,177,1,235,2,42,2,43,2,129,2,132,
+2,135,2,138,2,250,3,141,0,1,0,0,0,1,0,8,0,2,0,34,0,14,4,4,4,1,4,5,4,7,3,240,
+3,239,4,2,4,3,3,252,3,253,3,254,3,255,4,0,4,6,0,1,0,14,1,54,1,170,1,171,1,
+173,1,177,1,236,2,42,2,43,2,130,2,133,2,136,2,139,2,251,5,59,0,4,0,0,0,1,
+0,8,0,1,0,24,0,1,0,8,0,1,0,4,3,17,0,5,1,235,1,236,3,20,1,243,0,1,0,1,0,39,
+0,1,0,0,0,1,0,8,0,2,0,12,0,3,2,40,0,102,2,41,0,1,0,3,0,244,0,246,0,247,0,
+1,0,0,0,1,0,8,0,2,0,10,0,2,0,102,2,41,0,1,0,2,0,246,0,247,0,1,0,0,0,1,0,8,
+0,2,0,14,0,4,3,16,3,21,5,235,5,236,0,1,0,4,0,107,0,108,5,233,5,234,0,1,0,
+0,0,1,0,8,0,2,0,50,0,22,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,
+3,84,3,85,3,86,3,87,3,94,3,96,3,97,3,91,3,92,3,93,3,95,3,98,0,2,0,3,0,96,
+0,105,0,0,0,240,0,249,0,10,2,40,2,41,0,20,0,5,0,0,0,1,0,8,0,2,0,14,0,30,0,
+3,0,0,0,94,0,0,0,1,0,6,0,7,0,221,3,216,3,224,3,228,3,233,0,2,0,10,0,7,0,7,
+0,1,0,96,0,105,0,2,0,221,0,221,0,1,0,240,0,249,0,2,2,40,2,41,0,2,3,216,3,
+216,0,1,3,224,3,224,0,1,3,228,3,228,0,1,3,233,3,233,0,1,5,209,5,218,0,2,0,
+4,0,10,0,42,0,68,0,88,0,5,0,5,0,2,0,2,0,2,0,2,0,0,0,16,0,1,0,17,0,2,0,17,
+0,3,0,17,0,4,0,17,0,4,0,4,0,2,0,2,0,2,0,0,0,16,0,1,0,17,0,2,0,17,0,3,0,17,
+0,3,0,3,0,2,0,2,0,0,0,16,0,1,0,17,0,2,0,17,0,2,0,2,0,2,0,0,0,16,0,1,0,17,
+0,1,0,0,0,1,0,8,0,2,0,18,0,6,3,217,3,234,3,213,3,221,3,225,3,229,0,1,0,6,
+0,7,0,221,3,216,3,224,3,228,3,233,0,1,0,0,0,1,0,8,0,2,0,70,0,32,3,190,3,191,
+3,192,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,190,3,191,3,192,3,193,3,
+200,3,201,3,202,3,197,3,198,3,199,3,203,3,204,5,219,5,220,5,221,5,222,5,223,
+5,224,5,225,5,226,5,227,5,228,0,2,0,4,0,96,0,105,0,0,0,240,0,249,0,10,2,40,
+2,41,0,20,5,209,5,218,0,22,0,2,0,0,0,1,0,8,0,1,0,206,0,25,0,56,0,62,0,68,
+0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,
+0,152,0,158,0,164,0,170,0,176,0,182,0,188,0,194,0,200,0,2,5,205,3,190,0,2,
+5,205,3,191,0,2,5,205,3,192,0,2,5,205,3,193,0,2,5,205,3,194,0,2,5,205,3,195,
+0,2,5,205,3,196,0,2,5,205,3,197,0,2,5,205,3,198,0,2,5,205,3,199,0,2,5,205,
+3,200,0,2,5,205,3,201,0,2,5,205,3,202,0,2,5,205,3,203,0,2,5,205,3,204,0,2,
+5,205,5,219,0,2,5,205,5,220,0,2,5,205,5,221,0,2,5,205,5,222,0,2,5,205,5,223,
+0,2,5,205,5,224,0,2,5,205,5,225,0,2,5,205,5,226,0,2,5,205,5,227,0,2,5,205,
+5,228,0,2,0,2,3,190,3,204,0,0,5,219,5,228,0,15,0,6,0,0,0,1,0,8,0,2,0,16,0,
+32,0,90,0,0,0,2,0,0,0,106,0,2,0,2,3,190,3,204,0,0,5,219,5,228,0,15,0,2,0,
+9,3,190,3,204,0,2,3,213,3,213,0,1,3,217,3,217,0,1,3,221,3,221,0,1,3,225,3,
+225,0,1,3,229,3,229,0,1,3,234,3,234,0,1,5,205,5,205,0,3,5,219,5,228,0,2,0,
+2,0,2,3,190,3,204,0,1,5,219,5,228,0,1,0,2,0,6,0,22,0,2,0,2,0,1,0,1,0,0,0,
+1,0,0,0,18,0,2,0,2,0,3,0,1,0,0,0,1,0,0,0,18,0,4,0,8,0,1,0,8,0,1,0,162,0,6,
+0,18,0,38,0,70,0,90,0,110,0,142,0,2,0,6,0,14,3,215,0,3,5,205,5,205,3,214,
+0,2,5,205,0,3,0,8,0,18,0,26,3,220,0,4,5,205,5,205,5,205,3,219,0,3,5,205,5,
+205,3,218,0,2,5,205,0,2,0,6,0,14,3,223,0,3,5,205,5,205,3,222,0,2,5,205,0,
+2,0,6,0,14,3,227,0,3,5,205,5,205,3,226,0,2,5,205,0,3,0,8,0,18,0,26,3,232,
+0,4,5,205,5,205,5,205,3,231,0,3,5,205,5,205,3,230,0,2,5,205,0,2,0,6,0,14,
+3,236,0,3,5,205,5,205,3,235,0,2,5,205,0,1,0,6,3,213,3,217,3,221,3,225,3,229,
+3,234,0,1,0,0,0,1,0,8,0,1,0,6,5,226,0,1,0,2,0,4,0,5,0,4,0,8,0,1,0,8,0,1,0,
+20,0,1,0,8,0,1,0,4,3,209,0,3,1,236,1,243,0,1,0,1,1,235,0,0,};
+#endif
@@ -0,0 +1,8188 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSans_Regular_ttf_size = 201644;
+asm(".section .rodata");
+asm(".global fz_font_NotoSans_Regular_ttf");
+asm(".type fz_font_NotoSans_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSans_Regular_ttf, 201644");
+asm(".balign 64");
+asm("fz_font_NotoSans_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSans-Regular.ttf\"");
+#else
+const int fz_font_NotoSans_Regular_ttf_size = 201644;
+const char fz_font_NotoSans_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,52,6,40,27,0,2,99,244,0,0,1,160,71,
+80,79,83,135,253,166,5,0,2,101,148,0,0,164,182,71,83,85,66,70,12,143,35,0,
+3,10,76,0,0,9,96,79,83,47,50,127,162,83,67,0,0,1,104,0,0,0,96,99,109,97,112,
+225,168,8,79,0,0,39,136,0,0,6,104,103,97,115,112,0,8,0,7,0,2,99,232,0,0,0,
+12,103,108,121,102,167,75,62,60,0,0,83,180,0,2,10,57,104,101,97,100,249,1,
+91,114,0,0,0,236,0,0,0,54,104,104,101,97,14,175,12,79,0,0,1,36,0,0,0,36,104,
+109,116,120,61,202,120,153,0,0,1,200,0,0,37,190,108,111,99,97,9,169,241,154,
+0,0,45,240,0,0,37,196,109,97,120,112,9,205,1,180,0,0,1,72,0,0,0,32,110,97,
+109,101,134,166,181,14,0,2,93,240,0,0,5,216,112,111,115,116,255,105,0,102,
+0,2,99,200,0,0,0,32,0,1,0,0,0,1,15,92,148,217,147,89,95,15,60,245,0,11,8,
+0,0,0,0,0,193,154,52,242,0,0,0,0,210,40,203,242,251,141,253,209,10,146,8,
+98,0,0,0,9,0,2,0,1,0,0,0,0,0,1,0,0,8,141,253,168,0,0,10,182,251,141,250,129,
+10,146,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,111,0,1,0,0,9,112,1,82,0,84,0,96,
+0,5,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,4,184,1,144,0,5,0,0,5,154,5,51,
+0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,8,2,2,11,5,2,4,5,4,2,2,4,224,0,2,
+255,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,255,253,8,141,253,168,0,
+0,8,141,2,88,32,0,1,159,223,215,0,0,4,74,5,182,0,0,0,32,0,4,4,205,0,193,0,
+0,0,0,4,20,0,0,2,20,0,0,2,39,0,147,3,68,0,133,5,43,0,51,4,147,0,127,6,166,
+0,100,5,219,0,109,1,205,0,133,2,102,0,82,2,102,0,61,4,104,0,84,4,147,0,102,
+2,37,0,84,2,147,0,82,2,37,0,147,2,250,0,20,4,147,0,100,4,147,0,182,4,147,
+0,98,4,147,0,92,4,147,0,43,4,147,0,129,4,147,0,113,4,147,0,90,4,147,0,100,
+4,147,0,102,2,37,0,147,2,37,0,63,4,147,0,102,4,147,0,115,4,147,0,102,3,121,
+0,25,7,49,0,119,5,29,0,0,5,51,0,199,5,14,0,125,5,215,0,199,4,115,0,199,4,
+39,0,199,5,211,0,125,5,238,0,199,2,182,0,82,2,47,255,96,4,244,0,199,4,49,
+0,199,7,66,0,199,6,20,0,199,6,63,0,125,4,215,0,199,6,63,0,125,4,250,0,199,
+4,100,0,104,4,115,0,20,5,217,0,184,4,205,0,0,7,113,0,25,4,176,0,8,4,135,0,
+0,4,147,0,78,2,162,0,164,2,250,0,20,2,162,0,51,4,147,0,78,3,141,255,252,4,
+164,1,131,4,125,0,94,4,236,0,174,3,215,0,113,4,236,0,113,4,131,0,113,2,193,
+0,31,4,236,0,113,4,242,0,174,2,16,0,160,2,16,255,143,4,70,0,174,2,16,0,174,
+7,123,0,174,4,242,0,174,4,215,0,113,4,236,0,174,4,236,0,113,3,78,0,174,3,
+213,0,104,2,227,0,33,4,242,0,162,4,16,0,0,6,74,0,23,4,59,0,37,4,20,0,2,3,
+195,0,80,3,10,0,57,4,104,1,233,3,10,0,66,4,147,0,102,2,20,0,0,2,39,0,147,
+4,147,0,186,4,147,0,66,4,147,0,121,4,147,0,29,4,104,1,233,4,27,0,121,4,164,
+1,49,6,168,0,100,2,219,0,66,4,18,0,82,4,147,0,102,2,147,0,82,6,168,0,100,
+4,0,255,250,3,109,0,123,4,147,0,102,2,205,0,49,2,205,0,35,4,164,1,131,4,252,
+0,174,5,61,0,113,2,37,0,147,1,205,0,29,2,205,0,76,3,2,0,66,4,18,0,80,6,82,
+0,71,6,82,0,46,6,82,0,32,3,121,0,51,5,29,0,0,5,29,0,0,5,29,0,0,5,29,0,0,5,
+29,0,0,5,29,0,0,7,12,255,254,5,14,0,125,4,115,0,199,4,115,0,199,4,115,0,199,
+4,115,0,199,2,182,0,60,2,182,0,82,2,182,255,253,2,182,0,60,5,215,0,61,6,20,
+0,199,6,63,0,125,6,63,0,125,6,63,0,125,6,63,0,125,6,63,0,125,4,147,0,131,
+6,63,0,125,5,217,0,184,5,217,0,184,5,217,0,184,5,217,0,184,4,135,0,0,4,215,
+0,199,5,12,0,174,4,125,0,94,4,125,0,94,4,125,0,94,4,125,0,94,4,125,0,94,4,
+125,0,94,6,233,0,94,3,215,0,113,4,131,0,113,4,131,0,113,4,131,0,113,4,131,
+0,113,2,16,255,212,2,16,0,167,2,16,255,175,2,16,255,234,4,215,0,113,4,242,
+0,174,4,215,0,113,4,215,0,113,4,215,0,113,4,215,0,113,4,215,0,113,4,147,0,
+102,4,215,0,113,4,242,0,162,4,242,0,162,4,242,0,162,4,242,0,162,4,20,0,2,
+4,236,0,174,4,20,0,2,5,29,0,0,4,125,0,94,5,29,0,0,4,125,0,94,5,29,0,0,4,125,
+0,94,5,14,0,125,3,215,0,113,5,14,0,125,3,215,0,113,5,14,0,125,3,215,0,113,
+5,14,0,125,3,215,0,113,5,215,0,199,4,236,0,113,5,215,0,61,4,240,0,113,4,115,
+0,199,4,131,0,113,4,115,0,199,4,131,0,113,4,115,0,199,4,131,0,113,4,115,0,
+199,4,131,0,113,4,115,0,199,4,131,0,113,5,211,0,125,4,236,0,113,5,211,0,125,
+4,236,0,113,5,211,0,125,4,236,0,113,5,211,0,125,4,236,0,113,5,238,0,199,4,
+242,0,174,5,238,0,0,4,242,0,18,2,182,255,228,2,16,255,146,2,182,0,44,2,16,
+255,220,2,182,0,30,2,16,255,202,2,182,0,82,2,16,0,51,2,182,0,82,2,16,0,174,
+4,229,0,82,4,29,0,160,2,47,255,96,2,16,255,143,4,244,0,199,4,70,0,174,4,70,
+0,174,4,49,0,199,2,16,0,165,4,49,0,199,2,16,0,92,4,49,0,199,2,16,0,174,4,
+49,0,199,2,154,0,174,4,49,0,27,2,16,255,238,6,20,0,199,4,242,0,174,6,20,0,
+199,4,242,0,174,6,20,0,199,4,242,0,174,5,135,0,3,6,20,0,199,4,242,0,174,6,
+63,0,125,4,215,0,113,6,63,0,125,4,215,0,113,6,63,0,125,4,215,0,113,7,109,
+0,125,7,145,0,111,4,250,0,199,3,78,0,174,4,250,0,199,3,78,0,98,4,250,0,199,
+3,78,0,126,4,100,0,104,3,213,0,104,4,100,0,104,3,213,0,104,4,100,0,104,3,
+213,0,104,4,100,0,104,3,213,0,104,4,115,0,20,2,227,0,33,4,115,0,20,2,227,
+0,33,4,115,0,20,2,227,0,33,5,217,0,184,4,242,0,162,5,217,0,184,4,242,0,162,
+5,217,0,184,4,242,0,162,5,217,0,184,4,242,0,162,5,217,0,184,4,242,0,162,5,
+217,0,184,4,242,0,162,7,113,0,25,6,74,0,23,4,135,0,0,4,20,0,2,4,135,0,0,4,
+147,0,78,3,195,0,80,4,147,0,78,3,195,0,80,4,147,0,78,3,195,0,80,2,156,0,174,
+4,147,0,190,5,31,0,0,4,125,0,94,7,12,255,254,6,233,0,94,6,63,0,125,4,215,
+0,113,4,100,0,104,3,213,0,104,4,190,1,4,4,190,1,4,4,182,1,43,4,190,1,31,2,
+16,0,160,4,158,1,109,1,150,0,35,4,190,1,2,4,160,0,223,4,158,1,248,4,158,1,
+16,5,29,0,0,2,37,0,147,4,240,255,208,6,129,255,208,3,164,255,222,6,131,255,
+226,5,147,255,206,6,131,255,226,2,197,255,230,5,29,0,0,5,51,0,199,4,49,0,
+199,4,166,0,41,4,115,0,199,4,147,0,78,5,238,0,199,6,63,0,123,2,182,0,82,4,
+244,0,199,4,221,0,0,7,66,0,199,6,20,0,199,4,113,0,72,6,63,0,125,5,217,0,199,
+4,215,0,199,4,143,0,74,4,115,0,20,4,135,0,0,6,111,0,104,4,176,0,8,6,111,0,
+109,6,66,0,78,2,182,0,60,4,135,0,0,4,236,0,113,3,221,0,88,4,242,0,174,2,197,
+0,168,4,231,0,162,4,236,0,113,5,12,0,174,4,37,0,10,4,213,0,111,3,221,0,88,
+3,223,0,113,4,242,0,174,4,195,0,113,2,197,0,168,4,70,0,174,4,86,255,244,4,
+252,0,174,4,96,0,0,3,209,0,111,4,215,0,113,5,70,0,25,4,215,0,162,3,223,0,
+113,4,240,0,113,3,213,0,20,4,231,0,162,5,205,0,113,4,104,255,233,6,23,0,162,
+6,66,0,115,2,197,255,234,4,231,0,162,4,215,0,113,4,231,0,162,6,66,0,115,4,
+115,0,199,5,238,0,20,4,49,0,199,5,37,0,125,4,100,0,104,2,182,0,82,2,182,0,
+60,2,47,255,96,7,125,0,2,7,170,0,199,5,238,0,20,4,242,0,199,4,254,0,23,5,
+217,0,199,5,29,0,0,4,236,0,199,5,51,0,199,4,49,0,199,5,135,0,12,4,115,0,199,
+6,213,0,2,4,180,0,78,6,37,0,201,6,37,0,201,4,242,0,199,5,170,0,2,7,66,0,199,
+5,238,0,199,6,63,0,125,5,217,0,199,4,215,0,199,5,14,0,125,4,115,0,20,4,254,
+0,23,6,111,0,104,4,176,0,8,5,238,0,199,5,150,0,164,8,76,0,199,8,84,0,199,
+5,137,0,16,6,221,0,199,5,35,0,199,5,16,0,61,8,106,0,199,5,29,0,45,4,125,0,
+94,4,203,0,117,4,156,0,174,3,119,0,174,4,166,0,39,4,131,0,113,6,0,0,2,3,236,
+0,68,5,37,0,174,5,37,0,174,4,59,0,174,4,160,0,14,5,248,0,174,5,25,0,174,4,
+215,0,113,4,254,0,174,4,236,0,174,3,215,0,113,3,207,0,41,4,20,0,2,5,205,0,
+111,4,59,0,37,5,14,0,174,4,231,0,152,7,47,0,174,7,63,0,174,5,145,0,37,6,57,
+0,174,4,193,0,174,3,244,0,59,6,176,0,174,4,121,0,33,4,131,0,113,4,242,0,18,
+3,119,0,174,3,246,0,113,3,213,0,104,2,16,0,160,2,16,255,236,2,16,255,143,
+6,188,0,14,7,23,0,174,4,242,0,18,4,59,0,174,4,20,0,2,5,2,0,174,4,66,0,199,
+3,125,0,174,7,113,0,25,6,74,0,23,7,113,0,25,6,74,0,23,7,113,0,25,6,74,0,23,
+4,135,0,0,4,20,0,2,4,0,0,82,8,0,0,82,8,0,0,82,3,74,255,252,1,102,0,25,1,102,
+0,25,2,0,0,63,1,102,0,25,2,223,0,25,2,223,0,25,3,84,0,27,4,25,0,133,4,25,
+0,123,3,2,0,158,6,84,0,147,9,106,0,100,1,205,0,133,3,68,0,133,2,123,0,82,
+2,123,0,80,3,254,0,147,1,10,254,121,3,45,0,109,4,147,0,92,4,147,0,68,6,53,
+0,156,4,147,0,47,6,145,0,133,4,41,0,111,8,41,0,195,6,47,0,35,6,66,0,78,4,
+244,0,102,6,82,0,69,6,82,0,35,6,82,0,71,6,82,0,102,4,166,0,98,4,166,0,41,
+5,233,0,197,5,12,0,72,4,147,0,102,4,100,0,37,5,164,0,119,3,25,0,10,4,147,
+0,96,4,147,0,102,4,147,0,102,4,147,0,102,4,170,0,106,4,209,0,31,4,209,0,31,
+4,158,0,207,2,16,255,143,4,0,1,133,4,0,1,111,4,0,1,123,2,205,0,20,2,205,0,
+61,2,205,0,57,2,205,0,51,4,0,0,0,8,0,0,0,4,0,0,0,8,0,0,0,2,170,0,0,2,0,0,
+0,1,86,0,0,4,121,0,0,2,37,0,0,1,154,0,0,0,205,0,0,0,0,0,0,0,0,0,0,8,0,0,84,
+8,0,0,84,2,16,255,143,1,102,0,25,5,16,0,12,4,147,0,0,6,217,0,23,7,66,0,199,
+7,123,0,174,5,29,0,0,4,125,0,94,1,10,254,122,2,170,0,115,4,166,0,129,7,145,
+0,31,7,145,0,31,6,70,0,125,4,238,0,113,6,61,0,184,5,100,0,162,0,0,252,77,
+0,0,253,7,0,0,252,19,0,0,253,4,0,0,253,49,4,115,0,199,6,37,0,201,4,131,0,
+113,5,37,0,174,8,39,0,131,6,156,0,0,5,102,0,18,5,20,0,18,7,96,0,199,5,240,
+0,174,5,119,0,0,4,147,0,8,7,111,0,199,6,61,0,174,5,213,0,23,5,31,0,12,7,223,
+0,199,6,203,0,174,4,178,0,61,3,236,0,25,6,111,0,109,6,23,0,162,6,66,0,125,
+4,215,0,113,5,20,0,0,4,33,0,0,5,20,0,0,4,33,0,0,9,195,0,125,8,141,0,113,6,
+145,0,125,5,70,0,113,8,16,0,123,6,135,0,111,8,39,0,131,6,156,0,0,5,37,0,123,
+3,240,0,113,4,223,0,104,4,117,0,201,4,158,0,248,4,158,1,221,4,158,1,223,7,
+233,0,41,7,166,0,41,6,72,0,199,5,70,0,174,4,231,0,47,4,193,0,18,4,231,0,199,
+4,236,0,174,4,61,0,47,3,121,0,16,5,53,0,199,4,68,0,174,7,59,0,2,6,94,0,2,
+4,180,0,78,3,236,0,68,5,92,0,199,4,117,0,174,4,244,0,199,4,82,0,174,4,244,
+0,47,4,70,0,18,5,139,0,14,4,252,0,37,6,10,0,199,5,66,0,174,6,133,0,199,5,
+231,0,174,8,150,0,199,6,240,0,174,6,59,0,125,5,35,0,113,5,14,0,125,3,215,
+0,113,4,115,0,18,3,205,0,41,4,135,0,0,4,16,0,0,4,135,0,0,4,16,0,0,5,12,0,
+8,4,106,0,37,6,229,0,18,5,203,0,41,5,160,0,164,4,248,0,152,5,150,0,164,4,
+217,0,152,5,150,0,199,4,190,0,174,6,203,0,55,5,82,0,45,6,203,0,55,5,82,0,
+45,2,182,0,82,6,213,0,2,6,0,0,2,5,145,0,199,4,123,0,174,5,193,0,2,4,178,0,
+14,5,217,0,199,4,248,0,174,6,12,0,199,5,76,0,174,5,150,0,164,4,231,0,152,
+7,86,0,199,6,10,0,174,2,182,0,82,5,29,0,0,4,125,0,94,5,29,0,0,4,125,0,94,
+7,12,255,254,6,233,0,94,4,115,0,199,4,131,0,113,5,233,0,121,4,131,0,104,5,
+233,0,121,4,131,0,104,6,213,0,2,6,0,0,2,4,180,0,78,3,236,0,68,4,172,0,72,
+3,252,0,29,6,37,0,201,5,37,0,174,6,37,0,201,5,37,0,174,6,63,0,125,4,215,0,
+113,6,66,0,125,4,215,0,113,6,66,0,125,4,215,0,113,5,16,0,61,3,244,0,59,4,
+254,0,23,4,20,0,2,4,254,0,23,4,20,0,2,4,254,0,23,4,20,0,2,5,150,0,164,4,231,
+0,152,4,61,0,199,3,119,0,174,6,221,0,199,6,57,0,174,4,61,0,47,3,121,0,16,
+5,14,0,8,4,102,0,37,4,176,0,6,4,59,0,37,4,236,0,127,4,236,0,113,7,55,0,127,
+7,49,0,111,7,61,0,72,6,121,0,78,5,16,0,72,4,76,0,78,7,227,0,0,6,223,0,14,
+8,31,0,199,7,86,0,174,6,20,0,125,5,35,0,113,5,184,0,18,5,63,0,41,4,182,0,
+109,3,221,0,88,5,178,0,2,4,176,0,14,5,29,0,0,4,125,0,94,5,29,0,0,4,125,0,
+94,5,29,0,0,4,125,0,94,5,29,0,0,4,125,0,37,5,29,0,0,4,125,0,94,5,29,0,0,4,
+125,0,94,5,29,0,0,4,125,0,94,5,29,0,0,4,125,0,94,5,29,0,0,4,125,0,94,5,29,
+0,0,4,125,0,94,5,29,0,0,4,125,0,94,5,29,0,0,4,125,0,94,4,115,0,199,4,131,
+0,113,4,115,0,199,4,131,0,113,4,115,0,199,4,131,0,113,4,115,0,199,4,131,0,
+113,4,115,0,78,4,131,0,63,4,115,0,199,4,131,0,113,4,115,0,199,4,131,0,113,
+4,115,0,199,4,131,0,113,2,182,0,82,2,16,0,123,2,182,0,82,2,16,0,155,6,63,
+0,125,4,215,0,113,6,63,0,125,4,215,0,113,6,63,0,125,4,215,0,113,6,63,0,125,
+4,215,0,84,6,63,0,125,4,215,0,113,6,63,0,125,4,215,0,113,6,63,0,125,4,215,
+0,113,6,70,0,125,4,238,0,113,6,70,0,125,4,238,0,113,6,70,0,125,4,238,0,113,
+6,70,0,125,4,238,0,113,6,70,0,125,4,238,0,113,5,217,0,184,4,242,0,162,5,217,
+0,184,4,242,0,162,6,61,0,184,5,100,0,162,6,61,0,184,5,100,0,162,6,61,0,184,
+5,100,0,162,6,61,0,184,5,100,0,162,6,61,0,184,5,100,0,162,4,135,0,0,4,20,
+0,2,4,135,0,0,4,20,0,2,4,135,0,0,4,20,0,2,4,240,0,113,0,0,251,219,0,0,252,
+106,0,0,251,141,0,0,252,106,0,0,252,102,0,0,252,113,0,0,252,113,0,0,252,113,
+0,0,252,102,1,164,0,45,1,182,0,25,4,115,0,20,2,227,0,33,4,236,0,18,5,215,
+0,20,4,236,0,199,4,236,0,174,5,20,0,184,4,229,0,168,5,14,0,63,5,14,0,125,
+4,6,0,113,5,215,0,61,6,123,0,20,4,236,0,104,4,236,0,113,4,213,0,111,4,115,
+0,123,5,233,0,121,4,180,0,111,4,39,255,233,5,211,0,125,4,143,0,0,7,121,0,
+174,2,201,0,184,2,182,0,70,4,244,0,199,4,70,0,174,2,16,0,31,4,86,255,244,
+8,61,0,184,6,20,255,233,4,242,0,174,6,66,0,125,8,154,0,125,6,195,0,113,5,
+123,0,20,4,236,0,174,4,250,0,199,4,100,0,96,3,213,0,92,4,143,0,74,2,121,255,
+141,2,227,0,33,4,156,0,20,2,227,0,33,4,115,0,20,6,66,0,76,4,205,0,0,4,135,
+0,0,4,86,0,2,4,147,0,78,3,195,0,80,4,172,0,72,4,172,0,113,3,252,0,70,3,252,
+0,57,4,143,0,98,4,172,0,72,3,236,0,68,3,180,0,74,4,178,0,174,4,33,1,193,4,
+33,0,186,4,33,0,133,2,39,0,147,10,86,0,199,9,154,0,199,8,174,0,113,6,96,0,
+199,6,66,0,199,4,33,0,174,8,68,0,199,8,37,0,199,7,2,0,174,5,29,0,0,4,125,
+0,94,2,182,0,3,2,16,255,175,6,63,0,125,4,215,0,113,5,217,0,184,4,242,0,162,
+5,217,0,184,4,242,0,162,5,217,0,184,4,242,0,162,5,217,0,184,4,242,0,162,5,
+217,0,184,4,242,0,162,4,131,0,104,5,29,0,0,4,125,0,94,5,29,0,0,4,125,0,94,
+7,12,255,254,6,233,0,94,5,211,0,125,4,236,0,113,5,211,0,125,4,236,0,113,4,
+244,0,199,4,70,0,174,6,63,0,125,4,215,0,113,6,63,0,125,4,215,0,113,4,172,
+0,72,3,252,0,29,10,86,0,199,9,154,0,199,8,174,0,113,5,211,0,125,4,236,0,113,
+7,129,0,199,5,74,0,199,6,20,0,199,4,242,0,174,5,29,0,0,4,125,0,94,5,29,0,
+0,4,125,0,94,4,115,0,160,4,131,0,113,4,115,0,199,4,131,0,113,2,182,255,133,
+2,16,255,49,2,182,0,29,2,16,255,201,6,63,0,125,4,215,0,113,6,63,0,125,4,215,
+0,113,4,250,0,166,3,78,0,35,4,250,0,199,3,78,0,174,5,217,0,184,4,242,0,162,
+5,217,0,184,4,242,0,162,4,180,0,78,3,252,0,20,5,238,0,199,4,242,0,174,5,238,
+0,199,4,236,0,113,5,94,0,119,4,215,0,113,4,147,0,78,3,195,0,80,5,29,0,0,4,
+125,0,94,4,115,0,199,4,131,0,113,6,63,0,125,4,215,0,113,6,63,0,125,4,215,
+0,113,6,63,0,125,4,215,0,113,6,63,0,125,4,215,0,113,4,135,0,0,4,20,0,2,3,
+12,0,14,5,246,0,174,3,27,0,29,7,199,0,113,7,199,0,113,5,29,0,0,5,14,0,125,
+3,215,0,113,4,49,0,20,4,115,0,20,3,213,0,104,3,195,0,80,3,150,0,4,3,125,0,
+25,5,51,0,31,5,217,0,20,4,221,0,0,4,115,0,199,4,131,0,113,2,47,255,96,2,16,
+255,143,6,35,0,125,4,236,0,113,4,250,0,20,3,78,0,20,4,135,0,0,4,20,0,2,4,
+125,0,166,4,236,0,113,4,236,0,175,4,236,0,174,3,215,0,68,4,63,0,98,4,236,
+0,113,4,236,0,113,4,131,0,104,4,131,0,104,6,27,0,104,3,221,0,88,3,236,0,68,
+5,51,0,68,4,205,0,113,2,16,255,143,4,236,0,111,4,236,0,113,4,152,0,113,4,
+16,0,0,4,16,255,250,4,242,0,166,4,242,0,174,4,242,0,174,2,16,0,20,2,197,0,
+168,2,143,0,74,3,6,0,10,2,205,255,236,2,14,0,174,5,66,0,174,7,123,0,166,7,
+123,0,166,7,123,0,174,4,242,255,197,4,242,0,174,5,14,0,174,4,215,0,113,6,
+233,0,113,6,66,0,115,5,205,0,111,3,78,0,31,3,78,0,31,3,78,0,31,3,78,0,174,
+3,78,0,174,2,197,0,168,2,197,0,37,4,121,0,174,4,121,0,174,3,213,0,104,2,16,
+255,197,2,16,255,197,2,16,255,227,2,16,255,31,2,227,0,45,2,227,0,33,4,242,
+0,20,4,215,0,61,4,231,0,166,4,16,0,0,6,74,0,23,4,20,0,0,3,203,0,0,3,195,0,
+80,4,86,0,80,3,252,0,29,3,252,255,215,3,104,0,25,3,104,0,53,3,104,0,25,3,
+193,0,113,6,63,0,125,4,156,0,174,4,205,0,92,4,152,0,113,5,25,0,174,2,16,255,
+61,4,70,0,18,3,123,0,174,4,236,0,113,3,104,0,25,3,104,0,53,7,174,0,113,7,
+217,0,113,8,66,0,113,6,18,0,33,4,18,0,33,6,229,0,33,6,229,0,31,5,76,0,174,
+4,211,0,174,4,18,0,0,4,184,0,174,5,4,255,215,5,4,255,215,4,25,0,158,4,25,
+0,158,1,240,255,199,2,221,0,158,2,221,0,49,2,221,0,49,3,188,0,158,5,27,0,
+39,3,115,0,20,1,102,0,25,2,223,0,25,1,102,0,25,1,102,0,25,1,53,0,43,1,53,
+0,43,2,80,0,16,2,80,0,33,2,72,0,51,2,72,0,51,2,72,0,39,2,72,0,26,0,250,0,
+43,1,197,0,20,1,197,0,20,0,250,0,43,2,145,0,25,1,197,0,20,1,197,0,20,1,174,
+0,33,1,174,0,33,1,53,0,43,1,53,0,43,1,223,0,25,1,223,0,25,1,223,0,25,1,223,
+0,25,0,0,254,201,1,223,0,31,3,111,0,20,1,240,0,158,3,66,0,106,3,143,0,43,
+2,242,0,68,3,88,0,160,3,88,0,160,3,88,0,160,3,88,0,160,3,88,0,160,3,88,0,
+160,3,88,0,160,4,190,1,4,3,74,255,252,2,223,0,25,2,213,0,20,2,213,0,20,2,
+213,0,104,2,213,0,104,1,178,0,20,3,2,0,20,3,2,0,20,2,248,0,20,2,37,0,147,
+1,125,0,20,1,125,0,20,1,125,0,20,1,125,0,20,3,227,0,41,3,227,0,41,3,244,0,
+41,0,0,254,167,0,0,254,210,0,0,254,86,0,0,254,194,0,0,255,151,0,0,254,224,
+0,0,253,4,0,0,255,32,0,0,254,144,0,0,254,167,0,0,255,174,0,0,255,10,0,0,254,
+193,0,0,254,193,0,0,255,100,0,0,255,102,0,0,255,100,0,0,255,102,0,0,255,51,
+0,0,255,51,0,0,255,76,0,0,255,76,0,0,254,147,0,0,255,45,0,0,255,147,0,0,255,
+41,0,0,255,41,0,0,255,41,0,0,254,210,0,0,254,150,0,0,0,0,0,0,254,224,0,0,
+255,32,0,0,255,126,0,0,255,57,0,0,255,89,0,0,255,174,0,0,254,147,0,0,254,
+125,0,0,254,167,0,0,254,167,0,0,254,194,0,0,254,193,0,0,254,136,0,0,254,210,
+0,0,254,53,0,0,254,89,0,0,254,172,0,0,254,147,0,0,253,31,0,0,254,215,0,0,
+254,106,0,0,255,147,0,0,254,147,0,0,255,53,0,0,254,125,0,0,255,47,0,0,255,
+125,0,0,254,87,0,0,254,183,0,0,255,175,0,0,254,136,0,0,255,126,0,0,254,193,
+0,0,255,177,0,0,254,66,0,0,254,87,0,0,255,10,0,0,255,66,0,0,254,135,0,0,254,
+135,0,0,254,168,0,0,254,154,0,0,255,70,0,0,253,37,0,0,255,84,0,0,255,144,
+0,0,254,193,0,0,255,61,0,0,255,84,0,0,255,84,0,0,254,135,0,0,255,144,0,0,
+1,6,0,0,255,39,0,0,254,119,0,0,255,61,0,0,255,84,0,0,255,84,0,0,255,66,0,
+0,255,66,0,0,255,84,0,0,255,84,0,0,255,84,0,0,254,221,0,0,254,207,0,0,255,
+174,0,0,254,182,0,0,254,209,0,0,254,248,0,0,254,197,0,0,254,211,0,0,254,10,
+0,0,255,41,0,0,254,209,0,0,254,168,0,0,254,174,1,197,0,41,1,197,0,41,1,197,
+0,158,3,215,0,68,3,215,0,113,3,215,0,68,2,37,0,63,4,184,0,102,5,164,255,206,
+4,147,0,0,5,205,0,111,5,51,255,246,6,27,0,125,4,215,0,113,4,231,0,125,4,113,
+0,113,4,70,0,199,3,172,0,176,3,246,255,246,4,115,0,98,4,190,255,236,4,43,
+255,102,8,61,0,184,7,123,0,166,5,100,0,115,4,238,0,113,5,53,0,199,4,94,0,
+174,4,100,0,96,4,51,0,49,4,166,0,41,4,84,0,33,6,27,0,125,4,215,0,113,4,115,
+0,41,3,254,0,31,5,51,255,246,4,215,0,113,3,215,0,113,2,16,255,143,6,66,0,
+125,3,246,0,113,3,244,0,59,4,215,0,199,4,236,0,174,5,14,0,125,7,66,0,199,
+5,207,0,174,4,215,0,8,5,14,0,63,5,14,0,125,5,14,0,63,0,0,254,135,6,63,0,125,
+4,236,0,113,7,113,0,25,6,74,0,23,4,55,0,20,5,172,0,16,6,233,0,104,4,74,0,
+20,4,45,0,121,4,197,0,176,4,197,0,74,3,184,0,176,3,233,0,86,2,51,0,176,2,
+6,255,164,4,25,0,176,3,135,0,43,5,211,0,176,4,242,0,176,5,18,0,121,4,45,0,
+72,4,217,0,51,4,217,0,51,4,217,0,6,7,145,0,106,4,104,0,117,5,18,0,121,5,18,
+0,121,4,4,0,176,4,55,0,49,4,55,0,49,3,184,0,43,4,197,0,166,4,242,0,78,6,76,
+0,78,4,242,0,78,3,252,0,20,5,248,0,41,3,209,0,86,3,236,0,68,3,174,0,100,4,
+10,0,33,3,135,0,176,3,252,0,20,4,197,0,176,4,4,0,176,5,53,0,109,4,162,0,29,
+3,229,0,18,5,63,0,14,3,248,0,164,3,248,0,18,4,104,0,164,3,113,0,164,3,113,
+0,111,4,100,0,113,4,121,0,164,2,59,0,84,1,223,255,170,3,203,0,164,3,68,0,
+164,5,98,0,164,4,147,0,164,4,158,0,164,4,176,0,113,4,20,0,109,3,182,0,164,
+3,207,0,164,3,113,0,39,4,104,0,154,5,133,0,37,3,121,0,90,3,121,0,141,3,197,
+0,104,5,39,0,98,3,197,0,145,3,197,0,104,3,125,0,104,3,125,0,98,3,8,0,88,3,
+20,0,72,3,197,0,102,1,203,0,137,3,82,0,145,5,139,0,145,3,203,0,145,3,182,
+0,104,3,4,0,70,3,182,0,104,3,182,0,104,3,197,0,145,2,92,0,49,3,203,0,139,
+3,203,0,88,5,139,0,139,3,45,0,18,2,217,0,14,3,219,0,145,3,59,0,25,3,180,0,
+102,4,98,0,104,3,104,0,2,1,203,0,137,2,166,0,145,3,203,0,139,3,45,0,18,3,
+219,0,145,3,59,0,25,3,182,0,139,4,98,0,104,3,104,0,2,7,113,0,166,4,236,255,
+188,4,236,0,113,2,193,255,242,7,123,255,225,4,242,255,225,4,236,255,182,3,
+78,255,184,2,197,255,184,3,213,255,244,2,227,255,213,3,195,0,70,4,236,0,176,
+4,37,0,164,4,176,0,86,7,213,0,33,2,16,0,20,2,197,0,10,4,236,0,20,4,197,0,
+20,4,215,0,20,4,236,0,174,4,236,0,113,2,193,0,31,6,61,0,111,4,70,0,174,2,
+16,0,82,7,123,0,174,4,242,0,174,4,236,0,174,3,78,0,82,3,213,0,104,3,100,255,
+197,4,16,0,0,4,59,0,37,3,195,0,80,4,125,0,94,4,236,0,113,4,236,0,113,4,131,
+0,113,3,242,0,88,3,236,0,68,5,49,0,104,2,16,0,160,3,215,0,68,2,16,255,197,
+4,242,0,162,3,236,0,68,3,197,0,145,3,4,0,104,3,78,0,90,3,182,0,104,3,20,0,
+72,2,68,0,47,1,203,255,203,3,197,0,102,3,203,0,141,1,203,0,39,2,72,0,141,
+2,33,0,78,2,33,0,78,1,203,255,145,1,201,0,145,1,201,255,193,2,197,0,145,5,
+139,0,145,5,139,0,139,3,203,255,242,3,203,0,145,3,221,0,145,3,182,0,104,4,
+98,0,102,3,2,0,98,1,203,255,242,2,92,0,49,3,203,0,39,3,182,0,68,3,199,0,139,
+3,195,0,139,3,45,0,18,2,248,0,82,2,248,0,82,3,94,0,82,3,31,0,45,3,168,0,104,
+0,0,254,162,0,0,254,125,0,0,255,133,0,0,254,135,0,0,254,209,0,0,254,201,0,
+0,254,209,0,0,254,201,0,0,254,66,0,0,254,66,0,0,255,90,0,0,255,84,0,0,254,
+135,5,51,0,199,4,236,0,174,5,51,0,199,4,236,0,174,5,51,0,199,4,236,0,174,
+5,14,0,125,3,215,0,113,5,215,0,199,4,236,0,113,5,215,0,199,4,236,0,113,5,
+215,0,199,4,236,0,113,5,215,0,199,4,236,0,113,5,215,0,199,4,236,0,113,4,115,
+0,199,4,131,0,113,4,115,0,199,4,131,0,113,4,115,0,199,4,131,0,113,4,115,0,
+199,4,131,0,113,4,115,0,199,4,131,0,113,4,39,0,199,2,193,0,31,5,211,0,125,
+4,236,0,113,5,238,0,199,4,242,0,174,5,238,0,199,4,242,0,174,5,238,0,199,4,
+242,0,174,5,238,0,90,4,242,0,62,5,238,0,199,4,242,0,174,2,182,255,228,2,16,
+255,144,2,182,0,41,2,16,255,246,4,244,0,199,4,70,0,174,4,244,0,199,4,70,0,
+174,4,244,0,199,4,70,0,174,4,49,0,199,2,16,0,158,4,49,255,245,2,16,255,218,
+4,49,0,199,2,16,255,216,4,49,0,199,2,16,255,175,7,66,0,199,7,123,0,174,7,
+66,0,199,7,123,0,174,6,20,0,199,4,242,0,174,6,20,0,199,4,242,0,174,6,20,0,
+199,4,242,0,174,6,20,0,199,4,242,0,174,6,63,0,125,4,215,0,113,6,63,0,125,
+4,215,0,113,6,63,0,125,4,215,0,113,6,63,0,125,4,215,0,113,4,215,0,199,4,236,
+0,174,4,215,0,199,4,236,0,174,4,250,0,199,3,78,0,174,4,250,0,199,3,78,0,158,
+4,250,0,199,3,78,0,158,4,250,0,199,3,78,255,220,4,100,0,104,3,213,0,104,4,
+100,0,104,3,213,0,104,4,100,0,104,3,213,0,104,4,100,0,104,3,213,0,104,4,100,
+0,104,3,213,0,104,4,115,0,20,2,227,0,33,4,115,0,20,2,227,0,33,4,115,0,20,
+2,227,0,33,4,115,0,20,2,227,0,33,5,217,0,184,4,242,0,162,5,217,0,184,4,242,
+0,162,5,217,0,184,4,242,0,162,5,217,0,184,4,242,0,162,5,217,0,184,4,242,0,
+162,4,205,0,0,4,16,0,0,4,205,0,0,4,16,0,0,7,113,0,25,6,74,0,23,7,113,0,25,
+6,74,0,23,4,176,0,8,4,59,0,37,4,176,0,8,4,59,0,37,4,135,0,0,4,20,0,2,4,147,
+0,78,3,195,0,80,4,147,0,78,3,195,0,80,4,147,0,78,3,195,0,80,4,242,0,174,2,
+227,0,33,6,74,0,23,4,20,0,2,4,125,0,94,2,156,0,174,5,172,0,184,4,236,0,113,
+4,236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,
+236,0,113,5,29,0,0,5,29,0,0,5,236,0,1,6,0,0,1,5,195,0,1,5,195,0,1,5,203,255,
+206,5,203,255,206,3,221,0,88,3,221,0,88,3,221,0,88,3,221,0,88,3,221,0,88,
+3,221,0,88,5,37,0,1,5,25,0,1,6,86,0,1,6,76,0,1,6,35,0,1,6,35,0,1,4,242,0,
+174,4,242,0,174,4,242,0,174,4,242,0,174,4,242,0,174,4,242,0,174,4,242,0,174,
+4,242,0,174,6,160,0,1,6,147,0,1,7,209,0,1,7,199,0,1,7,178,0,1,7,178,0,1,7,
+217,255,206,7,197,255,206,2,197,0,159,2,197,0,149,2,197,255,254,2,197,255,
+251,2,197,0,56,2,197,0,15,2,197,255,175,2,197,255,147,3,166,0,1,3,154,0,1,
+4,184,0,1,4,174,0,1,4,236,0,1,4,236,0,1,4,244,255,206,4,244,255,206,4,215,
+0,113,4,215,0,113,4,215,0,113,4,215,0,113,4,215,0,113,4,215,0,113,6,180,0,
+1,6,199,0,1,7,250,0,1,7,240,0,1,7,178,0,1,7,178,0,1,4,231,0,162,4,231,0,162,
+4,231,0,162,4,231,0,162,4,231,0,162,4,231,0,162,4,231,0,162,4,231,0,162,5,
+188,0,1,6,199,0,1,6,219,0,1,7,23,255,206,6,66,0,115,6,66,0,115,6,66,0,115,
+6,66,0,115,6,66,0,115,6,66,0,115,6,66,0,115,6,66,0,115,6,182,0,1,6,211,0,
+1,7,242,0,1,7,242,0,1,7,190,0,1,7,201,0,1,7,178,255,206,7,178,255,206,4,236,
+0,113,4,236,0,113,3,221,0,88,3,221,0,88,4,242,0,174,4,242,0,174,2,197,0,68,
+2,197,0,160,4,215,0,113,4,215,0,113,4,231,0,162,4,231,0,162,6,66,0,115,6,
+66,0,115,4,236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,236,
+0,113,4,236,0,113,4,236,0,113,7,225,0,0,7,225,0,0,8,176,0,1,8,197,0,1,8,135,
+0,1,8,135,0,1,8,143,255,206,8,143,255,206,4,242,0,174,4,242,0,174,4,242,0,
+174,4,242,0,174,4,242,0,174,4,242,0,174,4,242,0,174,4,242,0,174,9,100,0,1,
+9,88,0,1,10,150,0,1,10,139,0,1,10,119,0,1,10,119,0,1,10,158,255,206,10,137,
+255,206,6,66,0,115,6,66,0,115,6,66,0,115,6,66,0,115,6,66,0,115,6,66,0,115,
+6,66,0,115,6,66,0,115,9,123,0,1,9,152,0,1,10,182,0,1,10,182,0,1,10,131,0,
+1,10,141,0,1,10,119,255,206,10,119,255,206,4,236,0,113,4,236,0,113,4,236,
+0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,5,29,0,0,5,29,0,0,5,
+29,0,0,5,29,0,0,7,225,0,0,2,16,0,145,4,158,1,231,2,16,0,145,4,190,0,232,4,
+164,0,242,4,242,0,174,4,242,0,174,4,242,0,174,4,242,0,174,4,242,0,174,5,33,
+255,205,5,18,255,205,6,156,255,205,6,141,255,205,8,178,0,199,4,158,1,63,4,
+158,1,104,4,190,0,242,2,197,255,212,2,197,255,224,2,197,255,192,2,197,255,
+198,2,197,255,155,2,197,255,165,2,182,0,30,2,182,0,44,3,131,255,205,3,168,
+255,205,4,158,1,43,4,158,1,104,4,190,0,242,4,231,0,162,4,231,0,162,4,231,
+0,162,4,231,0,162,4,215,0,162,4,215,0,162,4,231,0,162,4,231,0,162,4,135,0,
+0,4,135,0,0,5,176,255,205,5,172,255,205,5,135,0,1,4,158,0,252,4,158,0,252,
+4,158,1,147,6,66,0,115,6,66,0,115,6,66,0,115,6,66,0,115,6,66,0,115,6,207,
+255,205,6,131,255,205,6,209,255,205,6,133,255,205,9,6,0,78,4,158,1,233,2,
+16,0,158,0,0,255,213,0,0,255,33,0,0,255,215,0,0,254,76,4,147,0,82,4,104,1,
+9,2,223,0,25,0,0,255,215,0,0,254,78,0,0,255,18,0,0,255,18,0,0,255,18,1,154,
+0,0,4,186,0,133,4,0,255,250,2,37,0,147,0,0,255,18,0,0,255,18,0,0,255,16,0,
+0,255,16,0,0,255,16,0,0,255,18,2,205,0,39,2,205,0,41,2,205,0,35,3,121,0,90,
+3,125,0,104,3,182,0,104,3,76,0,39,3,125,0,98,4,147,0,74,4,147,0,100,4,147,
+0,115,7,123,0,174,4,147,0,20,6,170,0,170,5,92,0,20,4,147,0,31,4,147,0,39,
+7,195,0,49,4,147,0,25,4,147,0,20,5,211,0,125,4,221,0,0,4,100,0,20,5,14,0,
+125,4,147,0,162,0,0,254,34,6,168,0,100,5,223,0,10,3,127,0,61,6,82,0,46,6,
+82,0,49,4,45,0,70,8,0,1,162,4,0,1,16,8,0,1,162,4,0,1,16,8,0,1,162,4,0,1,16,
+4,0,1,16,1,10,254,121,2,37,0,147,7,213,1,152,5,193,1,23,4,170,0,100,4,213,
+0,158,4,147,0,106,4,213,2,35,4,213,1,4,5,170,255,246,5,0,1,215,5,170,2,141,
+5,170,255,246,5,170,2,141,5,170,255,246,5,170,2,141,5,170,255,246,5,170,255,
+246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,1,217,5,170,2,141,5,170,
+1,217,5,170,1,217,5,170,255,246,5,170,255,246,5,170,255,246,5,170,2,141,5,
+170,1,217,5,170,1,217,5,170,255,246,5,170,255,246,5,170,255,246,5,170,2,141,
+5,170,1,217,5,170,1,217,5,170,255,246,5,170,255,246,5,170,255,246,5,170,255,
+246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,255,246,
+5,170,255,246,5,170,255,246,5,170,255,246,5,170,0,0,5,170,0,0,5,170,0,0,5,
+170,0,0,5,170,2,213,5,170,0,102,5,170,0,0,5,213,0,0,4,213,0,123,4,213,0,6,
+2,213,0,109,2,213,0,109,8,0,0,0,7,236,1,158,7,236,1,145,7,236,1,158,7,236,
+1,145,4,213,0,168,4,193,0,98,4,213,0,178,4,213,0,41,4,213,0,41,2,213,0,115,
+8,43,1,176,8,106,1,209,7,86,1,70,6,0,1,217,6,0,1,82,4,63,0,59,5,63,0,59,4,
+193,0,102,4,20,0,66,4,0,0,197,6,0,1,16,4,104,0,102,4,49,0,20,2,16,0,20,4,
+49,255,250,4,215,0,20,4,250,0,199,4,125,0,94,2,227,0,33,6,10,0,199,5,10,0,
+174,5,55,0,199,4,121,0,174,4,147,0,78,3,195,0,80,6,35,0,125,4,37,0,0,7,156,
+0,25,6,111,0,23,4,16,0,20,4,68,0,199,3,182,0,174,5,205,0,113,2,180,0,33,0,
+0,255,147,0,0,255,147,0,0,254,223,0,0,254,240,3,227,0,143,3,227,0,143,2,39,
+0,147,2,39,0,147,2,39,0,147,0,0,254,240,0,0,254,240,0,0,0,249,2,37,0,147,
+3,147,0,102,2,39,0,166,2,39,0,166,0,0,254,223,0,0,254,211,5,12,0,43,0,0,252,
+229,0,0,255,246,0,0,252,236,0,0,0,0,4,86,0,160,4,86,0,160,4,86,0,160,4,86,
+0,160,4,86,0,78,4,86,0,82,4,86,0,78,4,86,0,78,4,86,0,70,3,16,0,70,4,86,0,
+53,4,86,0,53,4,86,0,80,4,86,0,45,4,86,0,72,3,16,0,45,4,86,0,37,4,86,0,37,
+4,86,0,37,4,86,0,39,4,86,0,47,3,16,0,37,4,86,0,29,4,86,0,23,4,86,0,53,4,86,
+0,53,4,86,0,47,3,16,0,41,4,86,0,80,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,94,
+3,16,0,76,4,86,0,160,4,86,0,160,4,86,0,160,4,86,0,160,4,86,0,80,4,86,0,76,
+4,86,0,70,4,86,0,76,4,86,0,76,3,16,0,76,4,86,0,47,4,86,0,57,4,86,0,63,4,86,
+0,63,4,86,0,63,3,16,0,63,4,86,0,53,4,86,0,53,4,86,0,53,4,86,0,53,4,86,0,53,
+3,16,0,53,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,76,3,16,0,104,4,
+86,0,76,4,86,0,70,4,86,0,76,4,86,0,76,4,86,0,76,3,16,0,76,4,86,0,160,4,86,
+0,160,4,86,0,160,4,86,0,160,4,86,0,86,4,86,0,86,4,86,0,88,4,86,0,86,4,86,
+0,86,3,16,0,92,4,86,0,55,4,86,0,55,4,86,0,55,4,86,0,55,4,86,0,55,3,16,0,55,
+4,86,0,72,4,86,0,70,4,86,0,70,4,86,0,70,4,86,0,70,3,16,0,70,4,86,0,129,4,
+86,0,129,4,86,0,57,4,86,0,57,4,86,0,57,3,16,0,57,4,86,0,145,4,86,0,145,4,
+86,0,145,4,86,0,145,4,86,0,145,3,16,0,76,4,86,0,160,4,86,0,160,4,86,0,160,
+4,86,0,160,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,80,3,16,0,80,4,
+86,0,47,4,86,0,53,4,86,0,53,4,86,0,23,4,86,0,29,3,16,0,41,4,86,0,47,4,86,
+0,39,4,86,0,37,4,86,0,37,4,86,0,37,3,16,0,37,4,86,0,72,4,86,0,45,4,86,0,80,
+4,86,0,53,4,86,0,53,3,16,0,45,4,86,0,70,4,86,0,78,4,86,0,78,4,86,0,82,4,86,
+0,78,3,16,0,70,4,86,0,160,4,86,0,160,4,86,0,160,4,86,0,160,4,236,0,113,4,
+236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,236,0,113,4,236,
+0,113,2,197,255,226,2,197,255,226,2,197,255,226,2,197,255,226,2,197,255,214,
+2,197,255,214,2,197,255,214,2,197,255,214,4,231,0,162,4,231,0,162,4,231,0,
+162,4,231,0,162,4,231,0,162,4,231,0,162,4,231,0,162,4,231,0,162,2,197,255,
+226,2,197,255,226,2,197,255,214,2,197,255,214,4,231,0,162,4,231,0,162,4,231,
+0,162,4,231,0,162,5,197,0,201,6,20,0,199,5,174,0,186,5,12,0,174,3,51,0,106,
+3,51,0,106,3,51,0,106,3,51,0,106,0,0,254,244,0,0,254,166,0,0,254,209,0,0,
+254,147,4,100,255,161,0,0,254,168,0,0,254,209,0,0,254,209,0,0,254,166,0,0,
+254,207,0,0,254,168,0,0,254,207,0,0,254,207,3,51,0,94,3,51,0,94,3,51,0,106,
+3,51,0,106,3,51,0,94,3,51,0,94,3,51,0,94,3,51,0,94,7,145,0,0,6,121,0,14,6,
+115,0,199,6,139,0,174,7,68,0,45,7,10,0,33,4,242,0,199,4,59,0,174,8,18,0,2,
+6,147,0,14,8,186,0,199,7,0,0,174,5,246,0,199,5,37,0,174,5,213,0,199,5,35,
+0,174,4,158,0,176,4,147,0,41,7,213,1,117,3,25,0,20,4,147,0,96,4,147,0,102,
+4,213,1,4,2,35,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,6,92,0,0,1,96,1,0,0,7,0,96,
+0,0,0,13,0,126,1,97,1,99,1,127,1,145,1,146,1,159,1,161,1,174,1,176,1,239,
+1,240,1,249,1,255,2,23,2,27,2,54,2,55,2,187,2,188,2,197,2,201,2,215,2,221,
+2,242,2,243,2,255,3,3,3,14,3,15,3,34,3,35,3,111,3,117,3,126,3,138,3,140,3,
+161,3,206,3,214,3,255,4,0,4,12,4,13,4,79,4,80,4,92,4,95,4,134,4,145,5,19,
+5,29,5,39,29,202,30,1,30,61,30,63,30,127,30,133,30,155,30,158,30,241,30,243,
+30,249,31,21,31,29,31,69,31,77,31,87,31,89,31,91,31,93,31,125,31,180,31,196,
+31,211,31,219,31,239,31,244,31,254,32,11,32,15,32,34,32,38,32,47,32,48,32,
+52,32,58,32,60,32,62,32,68,32,94,32,112,32,121,32,127,32,148,32,169,32,172,
+32,181,32,186,32,240,33,5,33,19,33,23,33,34,33,38,33,46,33,78,33,84,33,94,
+33,132,33,149,33,168,34,2,34,6,34,15,34,18,34,21,34,26,34,31,34,41,34,43,
+34,72,34,97,34,101,35,2,35,16,35,33,37,0,37,2,37,12,37,16,37,20,37,24,37,
+28,37,36,37,44,37,52,37,60,37,108,37,128,37,132,37,136,37,140,37,147,37,161,
+37,172,37,178,37,186,37,188,37,196,37,204,37,207,37,217,37,230,38,60,38,64,
+38,66,38,96,38,99,38,102,38,107,38,111,41,245,44,109,44,119,46,23,167,33,
+167,140,251,4,254,35,254,255,255,253,255,255,0,0,0,0,0,13,0,32,0,160,1,98,
+1,100,1,128,1,146,1,147,1,160,1,162,1,175,1,177,1,240,1,241,1,250,2,0,2,24,
+2,28,2,55,2,56,2,188,2,189,2,198,2,202,2,216,2,222,2,243,2,244,3,0,3,4,3,
+15,3,16,3,35,3,36,3,116,3,122,3,132,3,140,3,142,3,163,3,208,3,215,4,0,4,1,
+4,13,4,14,4,80,4,81,4,93,4,96,4,135,4,146,5,20,5,30,29,0,29,254,30,2,30,62,
+30,64,30,128,30,134,30,158,30,160,30,242,30,244,31,0,31,24,31,32,31,72,31,
+80,31,89,31,91,31,93,31,95,31,128,31,182,31,198,31,214,31,221,31,242,31,246,
+32,0,32,12,32,18,32,38,32,42,32,48,32,50,32,57,32,60,32,62,32,68,32,94,32,
+106,32,116,32,127,32,144,32,160,32,171,32,173,32,185,32,240,33,5,33,19,33,
+22,33,34,33,38,33,46,33,77,33,83,33,91,33,132,33,144,33,168,34,2,34,6,34,
+15,34,17,34,21,34,25,34,30,34,41,34,43,34,72,34,96,34,100,35,2,35,16,35,32,
+37,0,37,2,37,12,37,16,37,20,37,24,37,28,37,36,37,44,37,52,37,60,37,80,37,
+128,37,132,37,136,37,140,37,144,37,160,37,170,37,178,37,186,37,188,37,196,
+37,202,37,207,37,216,37,230,38,58,38,64,38,66,38,96,38,99,38,101,38,106,38,
+111,41,245,44,96,44,113,46,23,167,23,167,136,251,1,254,32,254,255,255,252,
+255,255,0,1,255,245,255,227,255,194,2,28,255,194,2,0,255,176,1,255,0,188,
+1,253,0,175,1,251,0,94,1,250,255,73,1,244,0,0,1,240,0,0,1,239,255,147,1,238,
+0,0,1,235,254,118,1,229,255,101,1,228,0,0,1,225,0,100,1,224,255,65,1,223,
+1,219,1,215,253,208,253,207,253,206,253,205,0,0,1,131,254,101,253,155,254,
+89,253,154,254,23,253,153,0,0,254,9,0,0,254,6,0,0,4,64,232,136,0,0,232,83,
+228,21,232,81,227,122,232,75,232,73,228,122,227,14,228,120,231,232,231,230,
+231,228,231,226,231,224,231,223,231,222,231,221,231,220,231,218,231,217,231,
+216,231,214,231,213,231,211,231,210,226,63,231,197,0,0,225,234,231,174,225,
+225,0,0,225,219,225,218,231,161,225,211,231,130,231,119,0,0,225,153,231,90,
+0,0,0,0,231,73,0,0,231,16,225,24,225,11,0,0,224,254,224,251,224,244,230,181,
+230,177,224,200,230,130,230,119,230,101,224,37,224,34,224,26,224,25,229,249,
+0,0,0,0,229,232,224,3,223,231,0,0,223,205,229,17,229,4,228,245,227,23,227,
+22,227,13,227,10,227,7,227,4,227,1,226,250,226,243,226,236,226,229,226,210,
+226,191,226,188,226,185,226,182,226,179,226,167,226,159,226,154,226,147,226,
+146,226,139,0,0,226,131,226,123,226,111,226,28,226,25,226,24,225,251,225,
+249,225,248,225,245,225,242,216,98,220,2,219,255,218,96,97,97,96,251,0,0,
+10,107,3,76,2,80,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,62,0,0,0,0,0,0,0,0,0,0,1,58,0,0,0,0,0,0,0,0,0,0,1,54,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,38,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,36,0,0,1,38,0,0,1,56,0,0,0,0,1,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+22,0,0,0,0,0,0,1,48,0,0,0,0,0,0,0,0,0,0,0,0,1,40,0,0,0,0,1,46,1,64,0,0,1,
+64,0,0,0,0,0,0,1,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,34,1,36,0,0,0,0,0,0,1,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,0,0,
+0,0,0,0,0,0,1,73,1,74,1,36,1,37,1,75,1,76,4,180,1,77,2,96,2,97,4,228,2,98,
+5,86,2,80,2,81,5,87,5,88,5,89,2,82,2,104,1,246,1,247,5,131,2,144,2,145,2,
+146,2,147,2,148,2,149,2,150,2,151,1,248,1,249,9,88,9,89,9,90,9,91,9,92,9,
+93,5,132,5,133,5,134,5,135,6,83,6,84,2,85,2,86,7,213,2,2,2,3,2,4,7,214,2,
+5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,7,215,2,13,2,14,2,15,2,18,2,19,7,222,2,59,
+2,60,7,232,2,61,2,62,7,233,7,239,7,240,7,241,2,25,2,26,7,242,7,243,2,27,7,
+244,7,245,3,114,2,28,7,255,9,105,2,31,8,1,8,15,2,44,2,45,8,16,2,48,8,18,2,
+51,8,80,8,81,2,52,2,53,2,90,2,91,0,0,0,0,0,0,0,41,0,0,0,41,0,0,0,41,0,0,0,
+41,0,0,0,100,0,0,0,144,0,0,1,7,0,0,1,154,0,0,2,52,0,0,2,217,0,0,2,246,0,0,
+3,47,0,0,3,105,0,0,3,176,0,0,3,224,0,0,4,4,0,0,4,29,0,0,4,72,0,0,4,103,0,
+0,4,195,0,0,4,244,0,0,5,76,0,0,5,196,0,0,6,15,0,0,6,107,0,0,6,223,0,0,7,4,
+0,0,7,153,0,0,8,15,0,0,8,89,0,0,8,158,0,0,8,200,0,0,8,239,0,0,9,25,0,0,9,
+144,0,0,10,90,0,0,10,156,0,0,11,9,0,0,11,97,0,0,11,171,0,0,11,219,0,0,12,
+4,0,0,12,106,0,0,12,152,0,0,12,199,0,0,12,249,0,0,13,48,0,0,13,77,0,0,13,
+152,0,0,13,224,0,0,14,68,0,0,14,137,0,0,14,252,0,0,15,77,0,0,15,193,0,0,15,
+228,0,0,16,39,0,0,16,89,0,0,16,185,0,0,16,245,0,0,17,35,0,0,17,80,0,0,17,
+119,0,0,17,149,0,0,17,186,0,0,17,228,0,0,17,255,0,0,18,42,0,0,18,158,0,0,
+19,8,0,0,19,86,0,0,19,188,0,0,20,30,0,0,20,101,0,0,20,222,0,0,21,38,0,0,21,
+94,0,0,21,176,0,0,21,244,0,0,22,12,0,0,22,115,0,0,22,182,0,0,23,14,0,0,23,
+121,0,0,23,221,0,0,24,28,0,0,24,134,0,0,24,209,0,0,25,22,0,0,25,80,0,0,25,
+192,0,0,25,254,0,0,26,81,0,0,26,126,0,0,26,221,0,0,26,247,0,0,27,81,0,0,27,
+160,0,0,27,160,0,0,27,218,0,0,28,50,0,0,28,141,0,0,29,8,0,0,29,88,0,0,29,
+126,0,0,30,41,0,0,30,118,0,0,31,39,0,0,31,144,0,0,31,220,0,0,31,252,0,0,32,
+12,0,0,32,195,0,0,32,222,0,0,33,41,0,0,33,103,0,0,33,184,0,0,34,25,0,0,34,
+68,0,0,34,141,0,0,34,198,0,0,34,242,0,0,35,47,0,0,35,93,0,0,35,170,0,0,35,
+247,0,0,36,23,0,0,36,55,0,0,36,87,0,0,36,201,0,0,36,225,0,0,36,249,0,0,37,
+17,0,0,37,41,0,0,37,65,0,0,37,193,0,0,38,14,0,0,38,38,0,0,38,62,0,0,38,86,
+0,0,38,110,0,0,38,134,0,0,38,158,0,0,38,182,0,0,38,206,0,0,38,230,0,0,39,
+68,0,0,39,92,0,0,39,116,0,0,39,140,0,0,39,164,0,0,39,188,0,0,39,212,0,0,40,
+27,0,0,40,162,0,0,40,186,0,0,40,210,0,0,40,234,0,0,41,2,0,0,41,26,0,0,41,
+102,0,0,41,240,0,0,42,6,0,0,42,28,0,0,42,50,0,0,42,72,0,0,42,94,0,0,42,116,
+0,0,43,39,0,0,43,63,0,0,43,85,0,0,43,107,0,0,43,129,0,0,43,151,0,0,43,175,
+0,0,43,199,0,0,43,223,0,0,43,247,0,0,44,125,0,0,44,147,0,0,44,169,0,0,44,
+191,0,0,44,213,0,0,44,235,0,0,45,1,0,0,45,78,0,0,45,205,0,0,45,227,0,0,45,
+249,0,0,46,15,0,0,46,37,0,0,46,59,0,0,46,168,0,0,46,190,0,0,46,214,0,0,46,
+236,0,0,47,4,0,0,47,26,0,0,47,50,0,0,47,74,0,0,47,98,0,0,47,120,0,0,47,144,
+0,0,47,166,0,0,47,190,0,0,47,214,0,0,47,238,0,0,48,4,0,0,48,28,0,0,48,52,
+0,0,48,68,0,0,48,187,0,0,48,211,0,0,48,233,0,0,49,1,0,0,49,23,0,0,49,47,0,
+0,49,71,0,0,49,95,0,0,49,119,0,0,49,143,0,0,49,165,0,0,49,189,0,0,49,211,
+0,0,49,235,0,0,50,1,0,0,50,25,0,0,50,49,0,0,50,73,0,0,50,97,0,0,50,121,0,
+0,50,145,0,0,50,221,0,0,51,54,0,0,51,78,0,0,51,102,0,0,51,126,0,0,51,150,
+0,0,51,174,0,0,51,198,0,0,51,222,0,0,51,244,0,0,52,12,0,0,52,36,0,0,52,60,
+0,0,52,84,0,0,52,108,0,0,52,132,0,0,52,156,0,0,52,178,0,0,52,240,0,0,53,8,
+0,0,53,32,0,0,53,54,0,0,53,78,0,0,53,102,0,0,53,124,0,0,53,148,0,0,53,172,
+0,0,53,227,0,0,54,21,0,0,54,45,0,0,54,67,0,0,54,91,0,0,54,113,0,0,54,137,
+0,0,54,159,0,0,54,183,0,0,55,13,0,0,55,103,0,0,55,127,0,0,55,149,0,0,55,173,
+0,0,55,195,0,0,55,219,0,0,55,241,0,0,56,98,0,0,57,1,0,0,57,25,0,0,57,47,0,
+0,57,71,0,0,57,95,0,0,57,119,0,0,57,143,0,0,57,167,0,0,57,189,0,0,57,213,
+0,0,57,235,0,0,58,3,0,0,58,27,0,0,58,51,0,0,58,73,0,0,58,95,0,0,58,117,0,
+0,58,141,0,0,58,163,0,0,58,222,0,0,59,54,0,0,59,78,0,0,59,100,0,0,59,124,
+0,0,59,146,0,0,59,170,0,0,59,192,0,0,59,216,0,0,59,238,0,0,60,6,0,0,60,28,
+0,0,60,52,0,0,60,76,0,0,60,100,0,0,60,124,0,0,60,148,0,0,60,170,0,0,60,194,
+0,0,60,218,0,0,60,240,0,0,61,8,0,0,61,32,0,0,61,56,0,0,61,78,0,0,61,129,0,
+0,61,224,0,0,62,125,0,0,63,80,0,0,63,104,0,0,63,128,0,0,63,152,0,0,63,174,
+0,0,63,196,0,0,63,218,0,0,64,16,0,0,64,67,0,0,64,94,0,0,64,147,0,0,64,191,
+0,0,65,11,0,0,65,64,0,0,65,141,0,0,65,213,0,0,66,0,0,0,66,97,0,0,66,121,0,
+0,66,137,0,0,66,161,0,0,66,187,0,0,66,213,0,0,66,237,0,0,67,7,0,0,67,31,0,
+0,67,55,0,0,67,71,0,0,67,87,0,0,67,119,0,0,67,135,0,0,67,151,0,0,67,167,0,
+0,67,183,0,0,68,41,0,0,68,57,0,0,68,73,0,0,68,128,0,0,68,144,0,0,68,160,0,
+0,68,214,0,0,68,230,0,0,69,10,0,0,69,26,0,0,69,86,0,0,69,102,0,0,69,118,0,
+0,69,243,0,0,70,3,0,0,70,91,0,0,70,201,0,0,70,225,0,0,70,249,0,0,71,15,0,
+0,71,37,0,0,71,59,0,0,71,83,0,0,71,105,0,0,71,241,0,0,72,110,0,0,72,189,0,
+0,73,67,0,0,73,177,0,0,74,36,0,0,74,105,0,0,74,212,0,0,75,13,0,0,75,29,0,
+0,75,141,0,0,75,157,0,0,75,219,0,0,76,100,0,0,76,116,0,0,76,184,0,0,77,25,
+0,0,77,128,0,0,77,217,0,0,78,25,0,0,78,98,0,0,78,219,0,0,79,78,0,0,79,174,
+0,0,80,40,0,0,80,64,0,0,80,86,0,0,80,108,0,0,80,130,0,0,80,154,0,0,80,178,
+0,0,81,12,0,0,81,36,0,0,81,128,0,0,81,144,0,0,81,160,0,0,81,184,0,0,81,200,
+0,0,82,65,0,0,82,160,0,0,82,228,0,0,82,252,0,0,83,20,0,0,83,67,0,0,83,83,
+0,0,83,162,0,0,83,178,0,0,83,194,0,0,84,15,0,0,84,31,0,0,84,109,0,0,84,228,
+0,0,85,39,0,0,85,63,0,0,85,112,0,0,85,181,0,0,85,197,0,0,85,213,0,0,85,229,
+0,0,85,245,0,0,86,5,0,0,86,21,0,0,86,37,0,0,86,121,0,0,86,137,0,0,86,153,
+0,0,86,200,0,0,87,9,0,0,87,56,0,0,87,112,0,0,87,190,0,0,88,20,0,0,88,93,0,
+0,88,193,0,0,89,58,0,0,89,139,0,0,89,155,0,0,90,22,0,0,90,130,0,0,90,163,
+0,0,90,239,0,0,90,255,0,0,91,82,0,0,91,185,0,0,91,244,0,0,92,10,0,0,92,61,
+0,0,92,124,0,0,92,208,0,0,93,1,0,0,93,17,0,0,93,53,0,0,93,69,0,0,93,85,0,
+0,93,123,0,0,93,139,0,0,94,0,0,0,94,16,0,0,94,64,0,0,94,129,0,0,94,177,0,
+0,94,235,0,0,95,53,0,0,95,136,0,0,95,207,0,0,96,39,0,0,96,144,0,0,96,222,
+0,0,96,244,0,0,97,100,0,0,97,122,0,0,97,213,0,0,97,229,0,0,97,245,0,0,98,
+13,0,0,98,29,0,0,98,135,0,0,98,223,0,0,99,56,0,0,99,78,0,0,99,100,0,0,99,
+147,0,0,99,185,0,0,99,223,0,0,99,247,0,0,100,13,0,0,100,37,0,0,100,61,0,0,
+100,85,0,0,100,109,0,0,100,133,0,0,100,157,0,0,100,182,0,0,100,207,0,0,100,
+232,0,0,101,15,0,0,101,54,0,0,101,92,0,0,101,129,0,0,101,168,0,0,101,236,
+0,0,102,45,0,0,102,108,0,0,102,165,0,0,103,0,0,0,103,44,0,0,103,148,0,0,104,
+107,0,0,104,123,0,0,104,139,0,0,104,183,0,0,104,228,0,0,104,252,0,0,105,27,
+0,0,105,91,0,0,105,154,0,0,105,253,0,0,106,125,0,0,106,248,0,0,107,136,0,
+0,107,249,0,0,108,130,0,0,108,218,0,0,108,234,0,0,109,84,0,0,109,116,0,0,
+109,148,0,0,109,180,0,0,109,212,0,0,110,87,0,0,110,150,0,0,110,189,0,0,110,
+244,0,0,111,13,0,0,111,56,0,0,111,191,0,0,112,2,0,0,112,147,0,0,112,222,0,
+0,113,21,0,0,113,74,0,0,113,131,0,0,113,155,0,0,113,179,0,0,113,232,0,0,114,
+26,0,0,114,69,0,0,114,112,0,0,114,155,0,0,114,220,0,0,115,61,0,0,115,99,0,
+0,115,238,0,0,115,238,0,0,115,238,0,0,115,238,0,0,115,238,0,0,115,238,0,0,
+115,238,0,0,115,238,0,0,115,238,0,0,115,238,0,0,115,238,0,0,115,238,0,0,115,
+238,0,0,115,238,0,0,117,137,0,0,118,17,0,0,118,41,0,0,118,57,0,0,118,216,
+0,0,119,40,0,0,119,160,0,0,119,184,0,0,119,208,0,0,119,232,0,0,120,0,0,0,
+120,22,0,0,120,98,0,0,120,238,0,0,121,14,0,0,121,46,0,0,121,168,0,0,122,29,
+0,0,122,121,0,0,122,214,0,0,122,232,0,0,122,250,0,0,123,12,0,0,123,71,0,0,
+123,115,0,0,123,139,0,0,123,163,0,0,123,185,0,0,123,207,0,0,124,117,0,0,124,
+238,0,0,125,70,0,0,125,157,0,0,126,20,0,0,126,129,0,0,126,207,0,0,127,27,
+0,0,127,128,0,0,127,228,0,0,128,96,0,0,128,220,0,0,129,100,0,0,129,238,0,
+0,130,192,0,0,131,132,0,0,131,148,0,0,131,164,0,0,132,19,0,0,132,120,0,0,
+132,202,0,0,133,29,0,0,133,53,0,0,133,77,0,0,133,245,0,0,134,13,0,0,134,161,
+0,0,135,49,0,0,136,57,0,0,137,27,0,0,137,51,0,0,137,75,0,0,137,161,0,0,137,
+246,0,0,138,79,0,0,138,145,0,0,138,207,0,0,139,6,0,0,139,61,0,0,140,132,0,
+0,141,95,0,0,141,210,0,0,142,64,0,0,142,151,0,0,142,238,0,0,143,80,0,0,143,
+207,0,0,144,3,0,0,144,56,0,0,144,153,0,0,144,244,0,0,145,76,0,0,145,166,0,
+0,145,190,0,0,145,214,0,0,146,29,0,0,146,90,0,0,146,169,0,0,146,247,0,0,147,
+73,0,0,147,161,0,0,147,223,0,0,148,26,0,0,148,83,0,0,148,142,0,0,148,197,
+0,0,148,252,0,0,149,99,0,0,149,192,0,0,150,105,0,0,151,4,0,0,151,28,0,0,151,
+52,0,0,151,99,0,0,151,146,0,0,151,162,0,0,151,225,0,0,152,35,0,0,152,116,
+0,0,152,187,0,0,153,3,0,0,153,61,0,0,153,121,0,0,153,197,0,0,154,16,0,0,154,
+94,0,0,154,175,0,0,154,239,0,0,155,46,0,0,155,177,0,0,156,39,0,0,156,177,
+0,0,157,47,0,0,157,63,0,0,157,87,0,0,157,111,0,0,157,217,0,0,158,56,0,0,158,
+138,0,0,158,214,0,0,159,35,0,0,159,110,0,0,159,169,0,0,159,230,0,0,160,49,
+0,0,160,124,0,0,160,214,0,0,161,54,0,0,161,70,0,0,161,94,0,0,161,116,0,0,
+161,140,0,0,161,162,0,0,161,178,0,0,161,194,0,0,161,218,0,0,161,240,0,0,162,
+88,0,0,162,104,0,0,162,128,0,0,162,150,0,0,162,174,0,0,162,198,0,0,162,222,
+0,0,162,244,0,0,163,74,0,0,163,157,0,0,163,181,0,0,163,203,0,0,163,227,0,
+0,163,249,0,0,164,17,0,0,164,39,0,0,164,55,0,0,164,71,0,0,164,95,0,0,164,
+117,0,0,164,141,0,0,164,165,0,0,164,189,0,0,164,211,0,0,164,235,0,0,165,1,
+0,0,165,25,0,0,165,47,0,0,165,71,0,0,165,93,0,0,165,134,0,0,165,175,0,0,165,
+199,0,0,165,223,0,0,165,247,0,0,166,72,0,0,166,165,0,0,167,2,0,0,167,82,0,
+0,167,162,0,0,167,231,0,0,167,247,0,0,168,97,0,0,168,233,0,0,169,104,0,0,
+169,217,0,0,170,69,0,0,170,160,0,0,171,10,0,0,171,107,0,0,171,189,0,0,172,
+13,0,0,172,121,0,0,172,210,0,0,173,21,0,0,173,90,0,0,173,207,0,0,173,223,
+0,0,174,67,0,0,174,161,0,0,174,185,0,0,174,209,0,0,174,233,0,0,175,1,0,0,
+175,25,0,0,175,49,0,0,175,73,0,0,175,97,0,0,175,121,0,0,175,145,0,0,176,64,
+0,0,176,88,0,0,176,120,0,0,176,150,0,0,176,174,0,0,176,198,0,0,176,222,0,
+0,176,246,0,0,177,14,0,0,177,38,0,0,177,208,0,0,177,232,0,0,178,8,0,0,178,
+38,0,0,178,62,0,0,178,86,0,0,178,110,0,0,178,134,0,0,178,158,0,0,178,180,
+0,0,178,204,0,0,178,228,0,0,178,252,0,0,179,20,0,0,179,44,0,0,179,68,0,0,
+179,225,0,0,179,249,0,0,180,25,0,0,180,55,0,0,180,79,0,0,180,103,0,0,180,
+127,0,0,180,151,0,0,180,175,0,0,180,199,0,0,180,223,0,0,180,247,0,0,181,15,
+0,0,181,39,0,0,181,63,0,0,181,87,0,0,181,111,0,0,181,135,0,0,182,88,0,0,182,
+112,0,0,182,144,0,0,182,174,0,0,182,198,0,0,182,220,0,0,182,244,0,0,183,10,
+0,0,183,34,0,0,183,58,0,0,183,82,0,0,183,104,0,0,183,128,0,0,183,152,0,0,
+183,176,0,0,183,200,0,0,183,224,0,0,183,248,0,0,184,16,0,0,184,38,0,0,184,
+62,0,0,184,84,0,0,184,108,0,0,184,132,0,0,184,156,0,0,184,178,0,0,184,202,
+0,0,184,226,0,0,184,250,0,0,185,18,0,0,185,42,0,0,185,66,0,0,185,90,0,0,185,
+112,0,0,185,136,0,0,185,209,0,0,186,30,0,0,186,108,0,0,186,207,0,0,187,72,
+0,0,187,149,0,0,187,225,0,0,188,66,0,0,188,182,0,0,188,235,0,0,189,24,0,0,
+189,48,0,0,189,72,0,0,189,195,0,0,190,78,0,0,190,94,0,0,190,205,0,0,191,28,
+0,0,191,127,0,0,191,215,0,0,192,77,0,0,192,179,0,0,192,195,0,0,193,42,0,0,
+193,116,0,0,193,224,0,0,194,102,0,0,194,150,0,0,194,166,0,0,195,26,0,0,195,
+91,0,0,195,220,0,0,196,73,0,0,196,180,0,0,196,237,0,0,197,46,0,0,197,143,
+0,0,197,232,0,0,198,20,0,0,198,145,0,0,198,254,0,0,199,95,0,0,199,111,0,0,
+199,127,0,0,200,10,0,0,200,130,0,0,200,225,0,0,201,108,0,0,201,192,0,0,202,
+49,0,0,202,156,0,0,202,172,0,0,203,19,0,0,203,113,0,0,203,174,0,0,204,19,
+0,0,204,80,0,0,204,189,0,0,205,25,0,0,205,96,0,0,205,203,0,0,206,18,0,0,206,
+85,0,0,206,172,0,0,207,6,0,0,207,89,0,0,207,199,0,0,208,51,0,0,208,138,0,
+0,208,215,0,0,209,60,0,0,209,145,0,0,209,171,0,0,209,197,0,0,210,9,0,0,210,
+25,0,0,210,57,0,0,210,89,0,0,210,121,0,0,210,145,0,0,210,169,0,0,210,193,
+0,0,210,217,0,0,210,241,0,0,211,9,0,0,211,33,0,0,211,55,0,0,211,79,0,0,211,
+103,0,0,211,127,0,0,211,149,0,0,211,173,0,0,211,195,0,0,211,219,0,0,211,243,
+0,0,212,11,0,0,212,35,0,0,212,59,0,0,212,83,0,0,212,107,0,0,212,131,0,0,212,
+230,0,0,212,254,0,0,213,22,0,0,213,46,0,0,213,70,0,0,213,94,0,0,213,118,0,
+0,213,238,0,0,214,120,0,0,214,144,0,0,214,166,0,0,214,190,0,0,214,214,0,0,
+214,238,0,0,215,6,0,0,215,38,0,0,215,68,0,0,215,92,0,0,215,116,0,0,215,140,
+0,0,215,164,0,0,215,188,0,0,215,212,0,0,215,234,0,0,216,60,0,0,216,153,0,
+0,216,177,0,0,216,199,0,0,216,223,0,0,216,247,0,0,217,15,0,0,217,39,0,0,217,
+63,0,0,217,87,0,0,217,111,0,0,217,135,0,0,217,159,0,0,217,183,0,0,217,207,
+0,0,217,231,0,0,217,255,0,0,218,23,0,0,218,47,0,0,218,71,0,0,218,95,0,0,218,
+119,0,0,218,143,0,0,218,167,0,0,218,191,0,0,218,215,0,0,218,239,0,0,219,7,
+0,0,219,23,0,0,219,141,0,0,219,165,0,0,219,189,0,0,220,0,0,0,220,16,0,0,220,
+136,0,0,221,8,0,0,221,32,0,0,221,48,0,0,221,72,0,0,221,96,0,0,221,120,0,0,
+221,144,0,0,221,168,0,0,221,192,0,0,221,216,0,0,221,240,0,0,222,8,0,0,222,
+32,0,0,222,56,0,0,222,80,0,0,222,104,0,0,222,126,0,0,222,219,0,0,223,96,0,
+0,223,209,0,0,224,113,0,0,225,20,0,0,225,128,0,0,226,6,0,0,226,130,0,0,226,
+182,0,0,227,5,0,0,227,151,0,0,227,233,0,0,228,49,0,0,228,114,0,0,228,242,
+0,0,229,84,0,0,229,100,0,0,229,199,0,0,230,98,0,0,230,166,0,0,231,10,0,0,
+231,156,0,0,232,22,0,0,232,113,0,0,232,190,0,0,233,16,0,0,233,128,0,0,233,
+148,0,0,233,242,0,0,234,6,0,0,234,133,0,0,234,213,0,0,235,82,0,0,235,215,
+0,0,236,85,0,0,236,107,0,0,236,206,0,0,237,93,0,0,237,109,0,0,237,125,0,0,
+238,9,0,0,238,121,0,0,238,189,0,0,239,78,0,0,239,94,0,0,239,182,0,0,240,45,
+0,0,240,194,0,0,241,12,0,0,241,105,0,0,241,221,0,0,242,41,0,0,242,57,0,0,
+242,104,0,0,242,193,0,0,243,19,0,0,243,70,0,0,243,166,0,0,243,186,0,0,244,
+43,0,0,244,166,0,0,245,0,0,0,245,97,0,0,245,157,0,0,245,173,0,0,246,30,0,
+0,246,153,0,0,246,169,0,0,246,189,0,0,246,250,0,0,247,85,0,0,247,148,0,0,
+247,233,0,0,248,29,0,0,248,84,0,0,248,164,0,0,248,186,0,0,249,65,0,0,249,
+139,0,0,249,232,0,0,250,51,0,0,250,151,0,0,250,223,0,0,251,40,0,0,251,140,
+0,0,251,240,0,0,252,69,0,0,252,126,0,0,252,233,0,0,253,56,0,0,253,102,0,0,
+253,182,0,0,254,27,0,0,254,43,0,0,254,180,0,0,254,246,0,0,255,12,0,0,255,
+81,0,0,255,164,0,0,255,188,0,0,255,204,0,1,0,59,0,1,0,175,0,1,0,191,0,1,1,
+42,0,1,1,110,0,1,1,141,0,1,2,20,0,1,2,104,0,1,2,189,0,1,3,66,0,1,3,238,0,
+1,4,173,0,1,5,61,0,1,5,196,0,1,6,115,0,1,6,255,0,1,7,114,0,1,7,170,0,1,8,
+15,0,1,8,76,0,1,8,172,0,1,9,33,0,1,9,102,0,1,9,186,0,1,10,8,0,1,10,66,0,1,
+10,123,0,1,10,209,0,1,11,27,0,1,11,122,0,1,11,194,0,1,11,210,0,1,11,226,0,
+1,11,242,0,1,12,2,0,1,12,50,0,1,12,99,0,1,12,161,0,1,12,183,0,1,12,222,0,
+1,13,4,0,1,13,42,0,1,13,81,0,1,13,97,0,1,13,115,0,1,13,133,0,1,13,151,0,1,
+13,169,0,1,13,187,0,1,13,205,0,1,13,246,0,1,14,17,0,1,14,35,0,1,14,53,0,1,
+14,71,0,1,14,89,0,1,14,107,0,1,14,132,0,1,14,186,0,1,14,204,0,1,15,58,0,1,
+15,84,0,1,15,185,0,1,15,243,0,1,16,55,0,1,16,85,0,1,16,120,0,1,16,155,0,1,
+16,190,0,1,16,220,0,1,16,251,0,1,17,31,0,1,17,49,0,1,17,67,0,1,17,83,0,1,
+17,123,0,1,17,163,0,1,17,202,0,1,17,239,0,1,18,26,0,1,18,95,0,1,18,168,0,
+1,18,245,0,1,19,7,0,1,19,36,0,1,19,66,0,1,19,95,0,1,19,125,0,1,19,161,0,1,
+19,193,0,1,19,242,0,1,20,4,0,1,20,22,0,1,20,49,0,1,20,67,0,1,20,85,0,1,20,
+103,0,1,20,119,0,1,20,137,0,1,20,155,0,1,20,173,0,1,20,199,0,1,20,238,0,1,
+21,66,0,1,21,118,0,1,21,154,0,1,21,190,0,1,21,226,0,1,22,6,0,1,22,48,0,1,
+22,90,0,1,22,122,0,1,22,155,0,1,22,188,0,1,22,228,0,1,23,20,0,1,23,52,0,1,
+23,85,0,1,23,125,0,1,23,143,0,1,23,188,0,1,23,233,0,1,23,251,0,1,24,13,0,
+1,24,31,0,1,24,49,0,1,24,67,0,1,24,85,0,1,24,120,0,1,24,188,0,1,24,206,0,
+1,24,224,0,1,24,242,0,1,25,4,0,1,25,22,0,1,25,40,0,1,25,67,0,1,25,85,0,1,
+25,161,0,1,25,188,0,1,25,215,0,1,25,247,0,1,26,22,0,1,26,69,0,1,26,105,0,
+1,26,145,0,1,26,214,0,1,27,9,0,1,27,81,0,1,27,99,0,1,27,117,0,1,27,135,0,
+1,27,153,0,1,27,171,0,1,27,189,0,1,27,207,0,1,27,243,0,1,28,5,0,1,28,23,0,
+1,28,52,0,1,28,142,0,1,29,26,0,1,29,166,0,1,29,209,0,1,29,241,0,1,31,244,
+0,1,32,38,0,1,32,56,0,1,32,140,0,1,32,190,0,1,32,240,0,1,33,36,0,1,33,137,
+0,1,33,155,0,1,33,171,0,1,33,229,0,1,34,99,0,1,34,135,0,1,34,190,0,1,34,208,
+0,1,34,235,0,1,34,253,0,1,35,65,0,1,35,120,0,1,35,155,0,1,36,10,0,1,36,98,
+0,1,36,154,0,1,36,225,0,1,37,32,0,1,37,98,0,1,37,189,0,1,38,1,0,1,38,97,0,
+1,38,154,0,1,38,217,0,1,39,13,0,1,39,64,0,1,39,103,0,1,39,142,0,1,39,160,
+0,1,39,176,0,1,39,200,0,1,39,224,0,1,39,240,0,1,40,141,0,1,40,167,0,1,40,
+191,0,1,40,207,0,1,41,81,0,1,41,185,0,1,42,18,0,1,42,95,0,1,42,200,0,1,42,
+249,0,1,43,42,0,1,43,151,0,1,44,23,0,1,44,125,0,1,44,221,0,1,45,97,0,1,45,
+225,0,1,46,64,0,1,46,164,0,1,47,3,0,1,47,91,0,1,47,224,0,1,48,91,0,1,48,203,
+0,1,49,66,0,1,49,189,0,1,50,46,0,1,50,142,0,1,50,216,0,1,51,68,0,1,51,218,
+0,1,51,234,0,1,51,250,0,1,52,10,0,1,52,26,0,1,52,42,0,1,52,58,0,1,52,74,0,
+1,52,90,0,1,52,165,0,1,52,232,0,1,53,89,0,1,53,105,0,1,53,129,0,1,53,153,
+0,1,53,215,0,1,53,231,0,1,53,247,0,1,54,7,0,1,54,23,0,1,54,92,0,1,54,169,
+0,1,55,93,0,1,55,198,0,1,56,21,0,1,56,91,0,1,56,181,0,1,56,229,0,1,57,80,
+0,1,57,137,0,1,57,184,0,1,57,242,0,1,58,40,0,1,58,110,0,1,58,173,0,1,59,6,
+0,1,59,84,0,1,59,171,0,1,59,249,0,1,60,119,0,1,61,24,0,1,61,130,0,1,61,185,
+0,1,61,240,0,1,62,51,0,1,62,128,0,1,62,205,0,1,62,240,0,1,63,45,0,1,63,113,
+0,1,63,246,0,1,64,93,0,1,64,142,0,1,64,234,0,1,65,23,0,1,65,101,0,1,65,208,
+0,1,66,54,0,1,66,86,0,1,66,134,0,1,66,170,0,1,66,186,0,1,67,12,0,1,67,83,
+0,1,67,154,0,1,67,233,0,1,68,70,0,1,68,175,0,1,68,242,0,1,69,36,0,1,69,85,
+0,1,69,170,0,1,69,218,0,1,70,11,0,1,70,61,0,1,70,121,0,1,70,152,0,1,70,221,
+0,1,71,22,0,1,71,77,0,1,71,161,0,1,72,11,0,1,72,78,0,1,72,154,0,1,72,191,
+0,1,72,249,0,1,73,87,0,1,73,199,0,1,74,55,0,1,74,145,0,1,75,56,0,1,75,149,
+0,1,75,244,0,1,76,77,0,1,76,160,0,1,76,254,0,1,77,89,0,1,77,208,0,1,78,8,
+0,1,78,70,0,1,78,163,0,1,78,245,0,1,79,64,0,1,79,132,0,1,79,179,0,1,79,224,
+0,1,80,63,0,1,80,138,0,1,80,205,0,1,81,15,0,1,81,111,0,1,81,164,0,1,82,11,
+0,1,82,118,0,1,82,187,0,1,83,57,0,1,83,162,0,1,84,17,0,1,84,73,0,1,84,131,
+0,1,84,149,0,1,84,167,0,1,84,185,0,1,84,203,0,1,85,33,0,1,85,51,0,1,85,69,
+0,1,85,204,0,1,86,113,0,1,87,21,0,1,87,154,0,1,88,88,0,1,88,225,0,1,89,136,
+0,1,90,4,0,1,90,116,0,1,91,7,0,1,91,139,0,1,91,250,0,1,92,116,0,1,92,164,
+0,1,93,13,0,1,93,174,0,1,93,218,0,1,94,35,0,1,94,168,0,1,95,4,0,1,95,134,
+0,1,96,13,0,1,96,146,0,1,96,244,0,1,97,143,0,1,97,239,0,1,98,36,0,1,98,169,
+0,1,99,10,0,1,99,144,0,1,99,235,0,1,100,113,0,1,100,222,0,1,101,51,0,1,101,
+141,0,1,101,210,0,1,102,106,0,1,102,231,0,1,103,127,0,1,103,249,0,1,104,130,
+0,1,105,4,0,1,105,133,0,1,105,221,0,1,106,71,0,1,106,170,0,1,107,14,0,1,107,
+119,0,1,107,209,0,1,108,24,0,1,108,145,0,1,109,11,0,1,109,27,0,1,109,95,0,
+1,109,163,0,1,109,179,0,1,109,248,0,1,110,67,0,1,110,118,0,1,110,167,0,1,
+110,230,0,1,111,82,0,1,111,130,0,1,111,181,0,1,111,212,0,1,112,69,0,1,112,
+167,0,1,112,250,0,1,113,81,0,1,113,138,0,1,113,224,0,1,114,73,0,1,114,200,
+0,1,115,15,0,1,115,102,0,1,115,200,0,1,116,39,0,1,116,100,0,1,116,183,0,1,
+116,236,0,1,117,27,0,1,117,105,0,1,117,205,0,1,118,31,0,1,118,135,0,1,118,
+238,0,1,119,78,0,1,119,198,0,1,120,4,0,1,120,39,0,1,120,74,0,1,120,109,0,
+1,120,144,0,1,120,186,0,1,120,228,0,1,121,24,0,1,121,74,0,1,121,174,0,1,121,
+198,0,1,121,222,0,1,121,246,0,1,122,14,0,1,122,38,0,1,122,62,0,1,122,94,0,
+1,122,124,0,1,122,148,0,1,122,172,0,1,122,196,0,1,122,220,0,1,122,244,0,1,
+123,12,0,1,123,36,0,1,123,58,0,1,123,82,0,1,123,106,0,1,123,130,0,1,123,154,
+0,1,123,178,0,1,123,202,0,1,123,226,0,1,123,250,0,1,124,18,0,1,124,42,0,1,
+124,74,0,1,124,104,0,1,124,128,0,1,124,152,0,1,124,176,0,1,124,198,0,1,124,
+222,0,1,124,246,0,1,125,14,0,1,125,38,0,1,125,62,0,1,125,86,0,1,125,108,0,
+1,125,130,0,1,125,154,0,1,125,178,0,1,125,202,0,1,125,226,0,1,125,250,0,1,
+126,18,0,1,126,42,0,1,126,66,0,1,126,90,0,1,126,114,0,1,126,138,0,1,126,162,
+0,1,126,186,0,1,126,210,0,1,126,242,0,1,127,18,0,1,127,42,0,1,127,66,0,1,
+127,90,0,1,127,114,0,1,127,138,0,1,127,162,0,1,127,186,0,1,127,210,0,1,127,
+234,0,1,128,2,0,1,128,26,0,1,128,50,0,1,128,74,0,1,128,98,0,1,128,122,0,1,
+128,146,0,1,128,170,0,1,128,194,0,1,128,218,0,1,128,242,0,1,129,10,0,1,129,
+34,0,1,129,58,0,1,129,82,0,1,129,106,0,1,129,130,0,1,129,154,0,1,129,178,
+0,1,129,202,0,1,129,226,0,1,129,250,0,1,130,18,0,1,130,50,0,1,130,80,0,1,
+130,104,0,1,130,128,0,1,130,152,0,1,130,176,0,1,130,200,0,1,130,224,0,1,130,
+248,0,1,131,16,0,1,131,40,0,1,131,64,0,1,131,96,0,1,131,128,0,1,131,152,0,
+1,131,176,0,1,131,200,0,1,131,224,0,1,131,248,0,1,132,16,0,1,132,40,0,1,132,
+64,0,1,132,88,0,1,132,112,0,1,132,136,0,1,132,160,0,1,132,184,0,1,132,208,
+0,1,132,232,0,1,133,0,0,1,133,24,0,1,133,48,0,1,133,72,0,1,133,94,0,1,133,
+118,0,1,133,142,0,1,133,166,0,1,133,190,0,1,133,214,0,1,133,238,0,1,134,6,
+0,1,134,30,0,1,134,54,0,1,134,76,0,1,134,100,0,1,134,124,0,1,134,148,0,1,
+134,170,0,1,134,194,0,1,134,218,0,1,134,242,0,1,135,10,0,1,135,34,0,1,135,
+58,0,1,135,82,0,1,135,104,0,1,135,128,0,1,135,152,0,1,136,11,0,1,136,35,0,
+1,136,59,0,1,136,81,0,1,136,103,0,1,136,125,0,1,136,147,0,1,136,169,0,1,136,
+191,0,1,136,213,0,1,136,235,0,1,137,5,0,1,137,31,0,1,137,57,0,1,137,83,0,
+1,137,109,0,1,137,135,0,1,137,159,0,1,137,183,0,1,137,205,0,1,137,227,0,1,
+137,249,0,1,138,15,0,1,138,41,0,1,138,67,0,1,138,93,0,1,138,119,0,1,138,145,
+0,1,138,171,0,1,138,195,0,1,138,219,0,1,138,241,0,1,139,7,0,1,139,29,0,1,
+139,51,0,1,139,73,0,1,139,95,0,1,139,121,0,1,139,147,0,1,139,173,0,1,139,
+199,0,1,139,225,0,1,139,251,0,1,140,21,0,1,140,47,0,1,140,69,0,1,140,91,0,
+1,140,115,0,1,140,139,0,1,140,163,0,1,140,187,0,1,140,211,0,1,140,235,0,1,
+141,5,0,1,141,31,0,1,141,57,0,1,141,83,0,1,141,109,0,1,141,135,0,1,141,161,
+0,1,141,187,0,1,141,211,0,1,141,235,0,1,142,1,0,1,142,23,0,1,142,45,0,1,142,
+67,0,1,142,91,0,1,142,117,0,1,142,143,0,1,142,169,0,1,142,195,0,1,142,221,
+0,1,142,245,0,1,143,13,0,1,143,35,0,1,143,57,0,1,143,79,0,1,143,101,0,1,143,
+123,0,1,143,145,0,1,143,171,0,1,143,197,0,1,143,223,0,1,143,249,0,1,144,17,
+0,1,144,41,0,1,144,65,0,1,144,89,0,1,144,113,0,1,144,137,0,1,144,161,0,1,
+144,185,0,1,144,209,0,1,144,235,0,1,145,5,0,1,145,31,0,1,145,57,0,1,145,83,
+0,1,145,109,0,1,145,135,0,1,145,157,0,1,145,179,0,1,145,201,0,1,145,223,0,
+1,145,245,0,1,146,11,0,1,146,35,0,1,146,59,0,1,146,81,0,1,146,103,0,1,146,
+125,0,1,146,147,0,1,146,171,0,1,146,195,0,1,146,225,0,1,146,255,0,1,147,27,
+0,1,147,55,0,1,147,83,0,1,147,111,0,1,147,139,0,1,147,167,0,1,147,197,0,1,
+147,227,0,1,148,5,0,1,148,39,0,1,148,73,0,1,148,107,0,1,148,141,0,1,148,175,
+0,1,148,207,0,1,148,239,0,1,149,13,0,1,149,43,0,1,149,73,0,1,149,103,0,1,
+149,133,0,1,149,163,0,1,149,197,0,1,149,231,0,1,150,9,0,1,150,43,0,1,150,
+77,0,1,150,111,0,1,150,145,0,1,150,179,0,1,150,211,0,1,150,243,0,1,151,19,
+0,1,151,51,0,1,151,83,0,1,151,115,0,1,151,147,0,1,151,179,0,1,151,211,0,1,
+151,245,0,1,152,23,0,1,152,57,0,1,152,91,0,1,152,125,0,1,152,159,0,1,152,
+193,0,1,152,215,0,1,152,237,0,1,153,9,0,1,153,31,0,1,153,59,0,1,153,81,0,
+1,153,109,0,1,153,133,0,1,153,157,0,1,153,181,0,1,153,205,0,1,153,229,0,1,
+154,25,0,1,154,73,0,1,154,89,0,1,154,105,0,1,154,246,0,1,155,20,0,1,155,44,
+0,1,155,74,0,1,155,96,0,1,155,126,0,1,155,152,0,1,155,178,0,1,155,204,0,1,
+155,230,0,1,155,254,0,1,156,75,0,1,156,151,0,1,157,6,0,1,157,30,0,1,157,54,
+0,1,157,78,0,1,157,102,0,1,157,126,0,1,157,150,0,1,157,174,0,1,157,198,0,
+1,157,224,0,1,157,250,0,1,158,71,0,1,158,148,0,1,158,255,0,1,159,21,0,1,159,
+43,0,1,159,65,0,1,159,87,0,1,159,111,0,1,159,135,0,1,159,157,0,1,159,179,
+0,1,159,203,0,1,159,227,0,1,159,253,0,1,160,23,0,1,160,49,0,1,160,150,0,1,
+160,250,0,1,161,31,0,1,161,63,0,1,161,87,0,1,161,119,0,1,161,143,0,1,161,
+175,0,1,161,201,0,1,161,225,0,1,161,251,0,1,162,19,0,1,162,43,0,1,162,80,
+0,1,162,133,0,1,162,159,0,1,162,218,0,1,163,9,0,1,163,55,0,1,163,80,0,1,163,
+106,0,1,163,173,0,1,163,204,0,1,163,236,0,1,164,16,0,1,164,63,0,1,164,110,
+0,1,164,110,0,1,164,134,0,1,164,150,0,1,165,30,0,1,165,83,0,1,165,135,0,1,
+165,169,0,1,165,205,0,1,165,254,0,1,166,47,0,1,166,121,0,1,166,226,0,1,167,
+74,0,1,167,92,0,1,167,110,0,1,167,128,0,1,167,185,0,1,167,203,0,1,168,45,
+0,1,168,210,0,1,169,82,0,1,169,205,0,1,170,97,0,1,171,21,0,1,171,217,0,1,
+172,41,0,1,172,128,0,1,173,56,0,1,173,197,0,1,174,81,0,1,174,209,0,1,175,
+73,0,1,175,213,0,1,176,67,0,1,176,157,0,1,176,175,0,1,177,86,0,1,178,9,0,
+1,178,52,0,1,178,84,0,1,178,116,0,1,178,195,0,1,178,249,0,1,179,47,0,1,179,
+101,0,1,179,154,0,1,179,236,0,1,180,62,0,1,180,157,0,1,180,173,0,1,180,189,
+0,1,180,221,0,1,181,31,0,1,181,84,0,1,181,138,0,1,181,160,0,1,181,231,0,1,
+182,43,0,1,182,68,0,1,182,94,0,1,182,126,0,1,182,157,0,1,182,189,0,1,182,
+220,0,1,183,1,0,1,183,37,0,1,183,73,0,1,183,109,0,1,183,156,0,1,183,195,0,
+1,183,235,0,1,184,21,0,1,184,63,0,1,184,115,0,1,184,156,0,1,184,197,0,1,184,
+249,0,1,185,35,0,1,185,77,0,1,185,129,0,1,185,170,0,1,185,212,0,1,186,6,0,
+1,186,53,0,1,186,104,0,1,186,167,0,1,186,213,0,1,187,7,0,1,187,72,0,1,187,
+122,0,1,187,168,0,1,187,231,0,1,188,25,0,1,188,71,0,1,188,137,0,1,188,204,
+0,1,189,16,0,1,189,104,0,1,189,132,0,1,189,160,0,1,189,188,0,1,189,216,0,
+1,189,244,0,1,191,240,0,1,195,167,0,1,199,36,0,1,199,63,0,1,199,105,0,1,199,
+133,0,1,199,176,0,1,199,202,0,1,199,229,0,1,200,1,0,1,200,29,0,1,200,56,0,
+1,200,155,0,1,201,232,0,1,202,31,0,1,202,101,0,1,202,214,0,1,203,37,0,1,203,
+228,0,1,204,122,0,1,205,28,0,1,205,141,0,1,206,47,0,1,206,154,0,1,207,46,
+0,1,207,128,0,1,207,188,0,1,208,12,0,1,208,114,0,1,208,225,0,1,209,39,0,1,
+209,100,0,1,209,195,0,1,210,27,0,1,210,131,0,1,211,50,0,1,211,158,0,1,211,
+174,0,1,212,1,0,1,212,69,0,1,212,145,0,1,212,194,0,1,212,243,0,1,213,103,
+0,1,213,191,0,1,214,60,0,1,214,192,0,1,215,53,0,1,215,91,0,1,215,129,0,1,
+215,232,0,1,216,23,0,1,216,82,0,1,216,145,0,1,216,204,0,1,216,235,0,1,217,
+17,0,1,217,55,0,1,217,114,0,1,217,172,0,1,217,230,0,1,218,12,0,1,218,48,0,
+1,218,66,0,1,218,141,0,1,218,179,0,1,218,206,0,1,218,233,0,1,219,77,0,1,219,
+177,0,1,219,199,0,1,219,242,0,1,220,29,0,1,220,76,0,1,220,121,0,1,220,166,
+0,1,220,211,0,1,221,0,0,1,221,42,0,1,221,89,0,1,221,135,0,1,221,175,0,1,221,
+223,0,1,222,13,0,1,222,53,0,1,222,100,0,1,222,150,0,1,222,196,0,1,222,244,
+0,1,223,25,0,1,223,65,0,1,223,112,0,1,223,161,0,1,223,211,0,1,224,1,0,1,224,
+46,0,1,224,85,0,1,224,132,0,1,224,181,0,1,224,231,0,1,225,24,0,1,225,64,0,
+1,225,101,0,1,225,142,0,1,225,192,0,1,225,242,0,1,226,34,0,1,226,80,0,1,226,
+117,0,1,226,158,0,1,226,203,0,1,226,248,0,1,227,33,0,1,227,80,0,1,227,130,
+0,1,227,176,0,1,227,216,0,1,228,6,0,1,228,46,0,1,228,93,0,1,228,142,0,1,228,
+192,0,1,228,238,0,1,229,27,0,1,229,67,0,1,229,114,0,1,229,163,0,1,229,213,
+0,1,230,6,0,1,230,46,0,1,230,83,0,1,230,124,0,1,230,174,0,1,230,224,0,1,231,
+17,0,1,231,64,0,1,231,101,0,1,231,138,0,1,231,184,0,1,231,234,0,1,232,28,
+0,1,232,74,0,1,232,113,0,1,232,154,0,1,232,197,0,1,232,242,0,1,233,28,0,1,
+233,74,0,1,233,123,0,1,233,173,0,1,233,219,0,1,234,0,0,1,234,40,0,1,234,87,
+0,1,234,136,0,1,234,186,0,1,234,236,0,1,235,20,0,1,235,57,0,1,235,97,0,1,
+235,147,0,1,235,197,0,1,235,246,0,1,236,37,0,1,236,74,0,1,236,119,0,1,236,
+164,0,1,236,214,0,1,237,7,0,1,237,54,0,1,237,93,0,1,237,139,0,1,237,180,0,
+1,237,226,0,1,238,20,0,1,238,65,0,1,238,105,0,1,238,146,0,1,238,190,0,1,238,
+235,0,1,239,21,0,1,239,67,0,1,239,115,0,1,239,165,0,1,239,215,0,1,240,0,0,
+1,240,37,0,1,240,77,0,1,240,126,0,1,240,176,0,1,240,225,0,1,241,16,0,1,241,
+53,0,1,241,98,0,1,241,143,0,1,241,193,0,1,241,242,0,1,242,33,0,1,242,72,0,
+1,242,109,0,1,242,157,0,1,242,203,0,1,242,253,0,1,243,44,0,1,243,84,0,1,243,
+130,0,1,243,178,0,1,243,218,0,1,244,8,0,1,244,55,0,1,244,95,0,1,244,137,0,
+1,244,181,0,1,244,226,0,1,245,15,0,1,245,39,0,1,245,63,0,1,245,87,0,1,245,
+111,0,1,245,135,0,1,245,159,0,1,245,183,0,1,245,207,0,1,245,231,0,1,245,255,
+0,1,246,23,0,1,246,47,0,1,246,71,0,1,246,95,0,1,246,119,0,1,246,143,0,1,246,
+167,0,1,246,191,0,1,246,215,0,1,246,239,0,1,247,7,0,1,247,31,0,1,247,55,0,
+1,247,79,0,1,247,103,0,1,247,127,0,1,247,151,0,1,247,175,0,1,247,199,0,1,
+247,223,0,1,247,247,0,1,248,15,0,1,248,107,0,1,248,193,0,1,249,42,0,1,249,
+159,0,1,249,253,0,1,250,89,0,1,250,182,0,1,251,20,0,1,251,94,0,1,251,175,
+0,1,252,10,0,1,252,151,0,1,252,173,0,1,253,21,0,1,253,72,0,1,253,129,0,1,
+254,0,0,1,254,91,0,1,254,182,0,1,254,240,0,1,255,42,0,1,255,179,0,2,0,59,
+0,2,0,173,0,2,1,32,0,2,1,152,0,2,2,15,0,2,2,135,0,2,2,254,0,2,3,107,0,2,3,
+207,0,2,4,46,0,2,4,175,0,2,5,24,0,2,5,171,0,2,5,246,0,2,6,64,0,2,6,205,0,
+2,7,67,0,2,7,182,0,2,8,32,0,2,8,80,0,2,8,128,0,2,8,204,0,2,9,31,0,2,9,82,
+0,2,9,181,0,2,9,203,0,2,9,225,0,2,9,247,0,2,10,13,0,2,10,35,0,2,10,57,0,2,
+0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,
+104,2,121,253,135,5,182,250,74,104,4,230,0,2,0,147,255,227,1,145,5,182,0,
+3,0,15,0,0,1,35,3,51,3,52,54,51,50,22,21,20,6,35,34,38,1,78,117,51,219,238,
+65,62,62,65,67,60,61,66,1,156,4,26,250,185,66,71,73,64,64,76,74,0,2,0,133,
+3,166,2,190,5,182,0,3,0,7,0,0,1,3,35,3,33,3,35,3,1,72,41,113,41,2,57,40,113,
+41,5,182,253,240,2,16,253,240,2,16,0,2,0,51,0,0,4,246,5,182,0,27,0,31,0,0,
+1,3,33,21,33,3,35,19,33,3,35,19,33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,
+21,1,33,19,33,3,215,63,1,24,254,205,84,145,84,254,219,80,144,78,254,254,1,
+29,65,254,238,1,43,82,147,82,1,39,82,142,82,1,4,252,235,1,37,64,254,219,3,
+125,254,184,137,254,84,1,172,254,84,1,172,137,1,72,135,1,178,254,78,1,178,
+254,78,135,254,184,1,72,0,3,0,127,255,137,4,16,6,18,0,32,0,38,0,45,0,0,1,
+20,6,7,21,35,53,38,38,39,53,22,22,23,17,38,38,53,52,54,55,53,51,21,22,23,
+7,38,39,17,30,2,7,52,38,39,17,54,1,20,22,23,17,6,6,4,16,203,188,131,114,209,
+68,75,217,99,205,170,202,173,131,190,171,56,155,150,160,157,74,182,94,115,
+209,253,236,86,106,94,98,1,193,137,180,23,228,219,2,35,31,168,35,51,2,1,172,
+65,175,137,132,170,19,180,178,5,71,141,61,11,254,90,54,96,123,100,72,85,40,
+254,137,32,2,253,73,90,38,1,117,16,90,0,5,0,100,255,236,6,66,5,203,0,9,0,
+21,0,32,0,44,0,48,0,0,19,20,22,51,50,17,16,35,34,6,5,20,6,35,34,38,53,52,
+54,51,50,22,1,20,22,51,50,54,53,16,35,34,6,5,20,6,35,34,38,53,52,54,51,50,
+22,1,1,35,1,250,71,78,158,158,78,71,1,201,157,151,142,157,153,146,147,161,
+1,182,71,78,81,77,158,78,71,1,201,158,150,142,157,152,147,147,161,254,245,
+252,213,157,3,43,4,2,165,167,1,76,1,74,165,165,228,233,239,222,229,228,237,
+252,218,167,164,163,168,1,72,163,165,227,233,239,221,229,228,237,3,34,250,
+74,5,182,0,3,0,109,255,236,5,215,5,205,0,11,0,20,0,51,0,0,1,20,22,23,54,54,
+53,52,38,35,34,6,19,50,55,1,6,6,21,20,22,37,52,54,55,46,2,53,52,54,51,50,
+22,21,20,6,7,1,54,55,51,2,7,1,35,39,6,6,35,34,38,1,166,71,80,124,102,102,
+81,89,105,153,227,156,254,86,138,97,154,254,170,134,181,77,65,36,198,179,
+165,189,137,156,1,139,93,51,182,69,140,1,43,244,178,114,243,147,215,245,4,
+143,65,130,79,69,126,81,76,92,94,251,176,146,1,157,83,136,92,113,135,242,
+130,196,104,87,101,107,59,148,172,168,148,109,182,92,254,132,108,217,254,
+227,155,254,221,172,102,90,210,0,1,0,133,3,166,1,72,5,182,0,3,0,0,1,3,35,
+3,1,72,41,113,41,5,182,253,240,2,16,0,1,0,82,254,188,2,41,5,182,0,13,0,0,
+19,16,18,55,51,6,2,21,20,18,23,35,38,2,82,155,146,170,144,145,148,139,168,
+147,154,2,49,1,9,1,206,174,193,254,50,244,240,254,54,189,170,1,198,0,1,0,
+61,254,188,2,20,5,182,0,13,0,0,1,16,2,7,35,54,18,53,52,2,39,51,22,18,2,20,
+155,146,168,139,148,145,144,170,147,154,2,49,254,249,254,58,168,188,1,203,
+240,244,1,206,193,175,254,49,0,1,0,84,2,123,4,16,6,20,0,14,0,0,1,3,37,23,
+5,19,7,3,3,39,19,37,55,5,3,2,147,41,1,138,28,254,136,243,176,174,158,182,
+240,254,139,29,1,133,43,6,20,254,119,111,189,30,254,188,96,1,102,254,154,
+96,1,68,30,189,111,1,137,0,1,0,102,0,227,4,41,4,195,0,11,0,0,1,33,21,33,17,
+35,17,33,53,33,17,51,2,145,1,152,254,104,147,254,104,1,152,147,3,27,146,254,
+90,1,166,146,1,168,0,1,0,84,254,248,1,137,0,238,0,6,0,0,37,23,6,3,35,54,55,
+1,123,14,55,121,133,65,37,238,23,214,254,247,250,252,0,1,0,82,1,213,2,66,
+2,117,0,3,0,0,19,53,33,21,82,1,240,1,213,160,160,0,1,0,147,255,227,1,145,
+0,248,0,11,0,0,55,52,54,51,50,22,21,20,6,35,34,38,147,65,60,61,68,68,61,59,
+66,111,66,71,71,66,65,75,74,0,1,0,20,0,0,2,229,5,182,0,3,0,0,1,1,35,1,2,229,
+253,224,177,2,33,5,182,250,74,5,182,0,2,0,100,255,236,4,47,5,205,0,11,0,23,
+0,0,1,16,2,35,34,2,17,16,18,51,50,18,1,16,18,51,50,18,17,16,2,35,34,2,4,47,
+241,246,238,246,237,247,238,249,252,234,145,158,160,145,145,160,160,143,2,
+221,254,131,254,140,1,127,1,114,1,126,1,114,254,128,254,144,254,194,254,230,
+1,33,1,55,1,52,1,34,254,228,0,1,0,182,0,0,2,215,5,182,0,11,0,0,33,35,17,52,
+55,6,7,6,7,39,1,51,2,215,176,8,28,32,102,121,94,1,140,149,3,254,136,116,30,
+26,85,99,121,1,51,0,1,0,98,0,0,4,41,5,203,0,26,0,0,33,33,53,1,62,2,53,52,
+38,35,34,6,7,39,54,51,50,22,21,20,6,6,7,1,21,33,4,41,252,57,1,127,173,112,
+55,138,120,90,161,101,96,205,243,204,239,70,140,165,254,207,2,227,150,1,131,
+175,150,140,81,116,130,60,79,121,172,209,180,96,179,185,161,254,211,8,0,1,
+0,92,255,236,4,31,5,203,0,39,0,0,1,20,6,7,21,22,22,21,20,4,33,34,38,39,53,
+22,22,51,32,17,16,33,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,
+3,242,157,146,175,173,254,222,254,241,116,195,91,93,212,99,1,114,254,103,
+142,144,172,194,141,125,97,165,107,90,90,235,132,214,239,4,96,140,180,30,
+8,22,180,144,209,227,34,45,168,46,50,1,33,1,2,153,147,130,105,118,53,70,123,
+71,81,195,0,2,0,43,0,0,4,106,5,190,0,10,0,19,0,0,1,35,17,35,17,33,53,1,51,
+17,51,33,17,52,55,35,6,6,7,1,4,106,212,175,253,68,2,176,187,212,254,125,11,
+9,11,55,22,254,74,1,76,254,180,1,76,153,3,217,252,48,1,204,137,187,26,104,
+30,253,144,0,1,0,129,255,236,4,31,5,182,0,26,0,0,1,50,4,21,20,0,33,34,39,
+53,22,22,51,50,54,53,16,33,34,7,39,19,33,21,33,3,54,2,51,229,1,7,254,222,
+254,255,245,134,74,208,99,172,188,254,146,118,132,90,55,2,221,253,189,35,
+115,3,129,230,200,228,254,253,79,170,44,52,164,152,1,40,30,57,2,178,164,254,
+88,23,0,2,0,113,255,236,4,51,5,203,0,22,0,36,0,0,19,16,33,50,23,21,38,35,
+34,2,3,51,54,51,50,22,21,20,2,35,34,38,2,1,50,54,53,52,38,35,34,6,6,21,20,
+22,22,113,2,157,116,65,76,101,233,247,13,12,110,236,198,226,250,215,150,225,
+122,1,239,139,150,146,137,87,145,87,80,142,2,113,3,90,19,153,24,254,228,254,
+204,172,240,204,227,254,248,152,1,37,254,218,178,162,146,157,72,128,68,100,
+175,100,0,1,0,90,0,0,4,47,5,182,0,6,0,0,33,1,33,53,33,21,1,1,23,2,88,252,
+235,3,213,253,174,5,18,164,139,250,213,0,3,0,100,255,236,4,45,5,203,0,22,
+0,34,0,47,0,0,1,50,22,21,20,6,7,22,22,21,20,4,35,34,36,53,52,37,38,38,53,
+52,54,3,20,22,51,50,54,53,52,38,39,6,6,1,34,6,21,20,22,22,23,54,54,53,52,
+38,2,72,200,238,133,146,177,149,254,254,221,234,255,0,1,47,136,120,239,110,
+165,145,143,164,156,184,145,132,1,50,118,140,54,102,112,137,115,142,5,203,
+186,164,110,174,75,86,187,122,182,217,204,189,250,141,78,180,113,159,189,
+251,168,116,132,135,119,96,150,67,62,152,3,93,112,99,63,96,76,47,57,136,89,
+100,111,0,2,0,102,255,236,4,41,5,203,0,23,0,37,0,0,1,16,33,34,39,53,22,51,
+50,54,54,55,35,6,35,34,38,53,52,18,51,50,22,18,1,34,6,21,20,22,51,50,54,54,
+53,52,38,38,4,41,253,96,116,68,77,103,163,212,111,8,13,112,236,193,227,254,
+213,150,225,121,254,16,136,152,143,137,90,148,84,79,142,3,70,252,166,20,154,
+27,131,251,208,170,235,207,226,1,12,153,254,219,1,38,178,162,146,155,73,124,
+69,100,174,101,0,2,0,147,255,227,1,145,4,102,0,11,0,23,0,0,55,52,54,51,50,
+22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,147,65,60,61,68,68,
+61,59,66,63,62,63,66,68,61,59,66,111,66,71,71,66,65,75,74,3,174,66,73,72,
+67,64,75,74,0,2,0,63,254,248,1,141,4,102,0,7,0,18,0,0,37,23,6,3,35,54,18,
+55,3,52,54,51,50,21,20,6,35,34,38,1,104,15,52,124,136,27,65,13,25,63,62,129,
+68,61,59,66,238,23,199,254,232,104,1,50,92,2,237,66,73,139,66,73,74,0,1,0,
+102,0,238,4,43,4,221,0,6,0,0,37,1,53,1,21,1,1,4,43,252,59,3,197,252,252,3,
+4,238,1,168,102,1,225,160,254,148,254,188,0,2,0,115,1,188,4,29,3,229,0,3,
+0,7,0,0,19,53,33,21,1,53,33,21,115,3,170,252,86,3,170,3,84,145,145,254,104,
+146,146,0,1,0,102,0,238,4,43,4,221,0,6,0,0,19,1,1,53,1,21,1,102,3,4,252,252,
+3,197,252,59,1,141,1,66,1,110,160,254,31,102,254,88,0,2,0,25,255,227,3,68,
+5,203,0,28,0,39,0,0,1,53,52,54,55,62,2,53,52,38,35,34,6,7,39,54,51,50,22,
+21,20,6,6,7,6,6,21,21,3,52,51,50,22,21,20,6,35,34,38,1,31,76,96,109,68,28,
+128,120,80,153,95,63,190,213,190,218,40,81,121,99,65,190,127,58,67,68,57,
+56,71,1,156,55,119,149,80,92,80,80,53,99,106,40,46,143,101,189,170,74,114,
+102,101,85,111,91,34,254,211,137,69,68,67,73,66,0,2,0,119,255,74,6,186,5,
+182,0,54,0,64,0,0,1,20,6,6,35,34,38,39,35,6,6,35,34,38,53,52,54,54,51,50,
+22,23,3,21,20,51,50,54,53,52,2,36,35,34,4,2,21,16,0,33,50,55,21,6,35,32,0,
+17,16,18,36,33,50,4,18,1,20,51,50,19,19,38,35,34,6,6,186,89,160,105,85,116,
+14,10,39,150,100,152,174,107,200,128,69,177,67,23,127,89,110,147,254,241,
+174,220,254,185,174,1,62,1,47,212,228,200,240,254,148,254,108,215,1,140,1,
+1,215,1,81,183,251,246,193,205,18,12,73,78,129,148,2,219,140,236,132,99,79,
+83,95,203,178,133,211,117,25,24,254,44,22,176,210,173,179,1,14,145,183,254,
+173,225,254,210,254,187,88,139,84,1,143,1,100,1,3,1,151,223,182,254,178,254,
+166,250,1,53,1,0,21,178,0,2,0,0,0,0,5,27,5,188,0,7,0,13,0,0,33,3,33,3,35,
+1,51,1,1,3,39,6,7,3,4,92,176,253,188,174,186,2,59,166,2,58,254,90,164,70,
+30,33,166,1,197,254,59,5,188,250,68,2,104,1,187,219,120,99,254,69,0,3,0,199,
+0,0,4,197,5,182,0,15,0,24,0,33,0,0,19,33,32,4,21,20,6,7,21,22,22,21,20,4,
+35,33,19,33,50,54,53,52,38,35,35,17,17,33,50,54,53,52,38,35,199,1,161,1,38,
+1,5,142,136,169,159,254,244,240,253,254,184,1,14,172,156,171,185,242,1,39,
+176,170,180,180,5,182,175,187,130,169,25,10,29,176,145,196,220,3,72,110,129,
+120,106,253,149,253,238,136,138,131,125,0,1,0,125,255,236,4,207,5,203,0,23,
+0,0,1,34,0,17,16,0,51,50,55,21,6,6,35,32,0,17,52,18,36,51,50,23,7,38,3,57,
+236,254,242,1,6,242,156,195,93,172,112,254,189,254,163,167,1,63,216,232,172,
+74,175,5,41,254,196,254,238,254,229,254,205,58,160,34,25,1,137,1,104,226,
+1,84,184,86,156,80,0,2,0,199,0,0,5,90,5,182,0,8,0,16,0,0,1,16,0,33,33,17,
+33,32,0,3,16,0,33,35,17,51,32,5,90,254,117,254,143,254,105,1,194,1,85,1,124,
+194,254,237,254,234,240,199,2,82,2,233,254,150,254,129,5,182,254,137,254,
+164,1,23,1,31,251,133,0,1,0,199,0,0,3,248,5,182,0,11,0,0,33,33,17,33,21,33,
+17,33,21,33,17,33,3,248,252,207,3,49,253,135,2,84,253,172,2,121,5,182,162,
+254,56,160,253,246,0,1,0,199,0,0,3,248,5,182,0,9,0,0,33,35,17,33,21,33,17,
+33,21,33,1,127,184,3,49,253,135,2,82,253,174,5,182,162,253,250,161,0,1,0,
+125,255,236,5,59,5,203,0,27,0,0,1,33,17,6,6,35,32,0,17,52,18,36,51,50,23,
+7,38,35,32,0,17,16,0,33,50,55,17,33,3,66,1,249,116,240,158,254,178,254,146,
+182,1,87,233,234,202,70,193,184,254,251,254,218,1,26,1,13,147,140,254,191,
+3,4,253,51,37,38,1,140,1,99,229,1,86,181,86,160,84,254,196,254,238,254,222,
+254,210,35,1,178,0,1,0,199,0,0,5,37,5,182,0,11,0,0,33,35,17,33,17,35,17,51,
+17,33,17,51,5,37,184,253,18,184,184,2,238,184,2,170,253,86,5,182,253,150,
+2,106,0,1,0,82,0,0,2,98,5,182,0,11,0,0,33,33,53,55,17,39,53,33,21,7,17,23,
+2,98,253,240,172,172,2,16,172,172,106,39,4,146,41,106,106,41,251,110,39,0,
+1,255,96,254,123,1,117,5,182,0,13,0,0,3,34,39,53,22,51,50,54,53,17,51,17,
+20,6,8,94,58,71,77,100,100,185,197,254,123,27,155,20,121,114,5,174,250,97,
+198,214,0,1,0,199,0,0,4,244,5,182,0,12,0,0,33,35,1,7,17,35,17,51,17,55,1,
+51,1,4,244,217,253,249,149,184,184,126,2,9,215,253,189,2,186,131,253,201,
+5,182,253,47,139,2,70,253,131,0,1,0,199,0,0,3,254,5,182,0,5,0,0,51,17,51,
+17,33,21,199,184,2,127,5,182,250,238,164,0,1,0,199,0,0,6,123,5,182,0,19,0,
+0,33,1,35,22,21,17,35,17,33,1,51,1,33,17,35,17,52,55,35,1,3,76,254,30,8,15,
+170,1,16,1,195,8,1,203,1,14,182,14,8,254,24,5,2,160,235,252,137,5,182,251,
+82,4,174,250,74,3,131,150,231,251,0,0,1,0,199,0,0,5,78,5,182,0,19,0,0,33,
+35,1,35,23,22,21,17,35,17,51,23,1,19,51,38,2,53,17,51,5,78,215,252,241,8,
+5,12,170,213,45,1,224,255,8,2,12,172,4,190,81,182,134,252,207,5,182,71,253,
+26,254,115,24,1,39,66,3,57,0,2,0,125,255,236,5,195,5,205,0,11,0,23,0,0,1,
+16,0,33,32,0,17,16,0,33,32,0,1,16,18,51,50,18,17,16,2,35,34,2,5,195,254,157,
+254,193,254,189,254,159,1,95,1,71,1,62,1,98,251,124,246,236,235,244,242,235,
+238,246,2,221,254,161,254,110,1,139,1,104,1,101,1,137,254,113,254,159,254,
+222,254,208,1,44,1,38,1,37,1,41,254,211,0,2,0,199,0,0,4,111,5,182,0,9,0,18,
+0,0,1,20,4,33,35,17,35,17,33,32,1,51,50,54,53,52,38,35,35,4,111,254,206,254,
+234,168,184,1,131,2,37,253,16,147,218,196,182,193,186,4,8,224,239,253,199,
+5,182,253,33,141,156,141,140,0,2,0,125,254,164,5,195,5,205,0,15,0,27,0,0,
+1,16,2,7,1,33,1,7,32,0,17,16,0,33,32,0,1,16,18,51,50,18,17,16,2,35,34,2,5,
+195,222,204,1,94,254,248,254,229,51,254,189,254,159,1,95,1,71,1,62,1,98,251,
+124,246,236,235,244,242,235,238,246,2,221,254,235,254,142,70,254,148,1,74,
+2,1,139,1,104,1,101,1,137,254,113,254,159,254,222,254,208,1,44,1,38,1,37,
+1,41,254,211,0,2,0,199,0,0,4,219,5,182,0,8,0,21,0,0,1,51,50,54,53,52,38,35,
+35,17,17,35,17,33,32,4,21,16,5,1,35,1,1,127,219,178,164,166,186,209,184,1,
+147,1,16,1,5,254,219,1,145,215,254,158,2,248,140,138,138,127,253,69,253,164,
+5,182,207,208,254,221,101,253,113,2,92,0,1,0,104,255,236,4,4,5,203,0,37,0,
+0,1,20,4,35,32,39,53,22,22,51,50,54,53,52,38,38,39,38,38,53,52,36,51,50,23,
+7,38,35,34,6,21,20,22,22,23,30,2,4,4,254,236,246,254,252,142,93,221,96,164,
+166,60,141,143,203,174,1,1,210,219,184,57,188,162,130,147,57,127,136,163,
+160,76,1,135,191,220,69,176,40,46,126,110,73,94,82,52,74,201,159,171,202,
+82,158,78,112,101,72,95,78,50,60,113,147,0,1,0,20,0,0,4,92,5,182,0,7,0,0,
+33,35,17,33,53,33,21,33,2,150,185,254,55,4,72,254,58,5,20,162,162,0,1,0,184,
+255,236,5,31,5,182,0,17,0,0,1,17,20,0,33,32,0,53,17,51,17,20,22,51,50,54,
+53,17,5,31,254,210,254,244,254,247,254,220,185,191,192,181,195,5,182,252,
+78,250,254,226,1,33,251,3,174,252,76,179,196,194,183,3,178,0,1,0,0,0,0,4,
+205,5,182,0,10,0,0,17,51,1,22,23,54,55,1,51,1,35,193,1,73,63,29,25,68,1,71,
+195,253,246,185,5,182,252,86,178,141,126,197,3,166,250,74,0,1,0,25,0,0,7,
+86,5,182,0,24,0,0,33,35,1,38,39,6,7,1,35,1,51,19,22,23,54,55,1,51,1,22,23,
+54,55,19,51,5,209,186,254,227,63,11,16,54,254,236,186,254,125,192,227,46,
+24,22,56,1,2,190,1,13,52,28,16,55,226,192,3,190,214,75,115,180,252,72,5,182,
+252,131,175,173,164,195,3,114,252,135,173,179,138,212,3,123,0,1,0,8,0,0,4,
+168,5,182,0,11,0,0,33,35,1,1,35,1,1,51,1,1,51,1,4,168,209,254,125,254,119,
+195,1,230,254,57,205,1,102,1,105,194,254,60,2,123,253,133,2,250,2,188,253,
+195,2,61,253,72,0,1,0,0,0,0,4,135,5,182,0,8,0,0,1,1,51,1,17,35,17,1,51,2,
+68,1,125,198,254,25,185,254,25,201,2,231,2,207,252,129,253,201,2,47,3,135,
+0,1,0,78,0,0,4,68,5,182,0,9,0,0,33,33,53,1,33,53,33,21,1,33,4,68,252,10,3,
+2,253,22,3,201,252,254,3,23,139,4,135,164,139,251,121,0,1,0,164,254,188,2,
+111,5,182,0,7,0,0,1,33,17,33,21,33,17,33,2,111,254,53,1,203,254,229,1,27,
+254,188,6,250,147,250,45,0,1,0,20,0,0,2,231,5,182,0,3,0,0,19,1,35,1,197,2,
+34,178,253,223,5,182,250,74,5,182,0,1,0,51,254,188,1,254,5,182,0,7,0,0,23,
+33,17,33,53,33,17,33,51,1,27,254,229,1,203,254,53,176,5,211,147,249,6,0,1,
+0,78,2,35,4,70,5,193,0,6,0,0,19,1,51,1,35,1,1,78,1,178,102,1,224,160,254,
+143,254,185,2,35,3,158,252,98,2,223,253,33,0,1,255,252,254,197,3,145,255,
+72,0,3,0,0,1,33,53,33,3,145,252,107,3,149,254,197,131,0,1,1,131,4,217,3,31,
+6,33,0,9,0,0,1,35,38,38,39,53,51,22,22,23,3,31,121,75,179,37,215,32,118,47,
+4,217,60,191,56,21,66,183,54,0,2,0,94,255,236,3,215,4,92,0,26,0,37,0,0,33,
+39,35,6,6,35,34,38,53,16,37,55,53,52,38,35,34,6,7,39,54,54,51,50,22,21,17,
+37,50,54,53,53,7,6,6,21,20,22,3,84,35,8,82,163,124,162,184,2,15,186,108,119,
+87,155,68,55,83,196,96,199,194,254,10,151,173,162,189,173,105,156,103,73,
+170,155,1,78,16,7,65,125,119,52,32,135,44,50,176,192,253,20,125,163,150,99,
+7,7,106,114,86,92,0,2,0,174,255,236,4,123,6,20,0,20,0,33,0,0,1,50,18,17,16,
+2,35,34,38,39,35,6,7,35,17,51,17,20,7,51,54,23,34,6,21,21,20,22,51,50,54,
+53,52,38,2,182,217,236,240,213,111,174,55,14,31,6,129,180,10,10,111,199,166,
+144,147,167,148,145,146,4,92,254,213,254,244,254,240,254,215,80,79,120,19,
+6,20,254,134,113,113,164,149,188,224,8,225,193,217,205,208,208,0,1,0,113,
+255,236,3,147,4,94,0,22,0,0,5,34,0,17,16,0,51,50,22,23,7,38,35,34,6,21,20,
+22,51,50,55,21,6,2,102,237,254,248,1,11,247,80,157,51,55,139,98,166,158,158,
+155,145,140,114,20,1,35,1,16,1,20,1,43,33,26,150,52,209,207,199,211,64,160,
+59,0,2,0,113,255,236,4,61,6,20,0,19,0,32,0,0,5,34,2,17,16,18,51,50,23,51,
+38,38,53,17,51,17,35,39,35,6,39,50,54,53,53,52,38,35,34,6,21,20,22,2,51,214,
+236,237,215,221,119,13,3,10,180,145,27,8,115,198,164,151,153,164,139,152,
+151,20,1,40,1,15,1,13,1,46,162,20,121,21,1,182,249,236,147,167,149,179,204,
+33,229,195,221,205,204,210,0,2,0,113,255,236,4,27,4,94,0,20,0,27,0,0,5,34,
+0,17,16,0,51,50,18,21,21,33,22,22,51,50,54,55,21,6,6,3,34,6,7,33,38,38,2,
+129,247,254,231,1,6,223,207,246,253,16,5,180,165,88,158,106,91,160,154,129,
+150,14,2,47,2,138,20,1,43,1,6,1,8,1,57,254,245,228,109,187,194,31,45,158,
+39,32,3,223,166,148,154,160,0,1,0,31,0,0,3,25,6,31,0,21,0,0,1,33,17,35,17,
+35,53,55,53,52,54,51,50,23,7,38,35,34,6,21,21,33,2,168,254,235,180,192,192,
+175,182,105,108,48,93,70,91,88,1,21,3,190,252,66,3,190,84,62,63,200,200,37,
+141,30,120,130,71,0,2,0,113,254,20,4,61,4,94,0,12,0,40,0,0,37,50,54,53,53,
+52,38,35,34,6,21,20,22,5,55,35,6,35,34,2,17,16,18,51,50,23,51,55,51,17,20,
+6,35,34,39,53,22,51,50,54,53,2,80,166,151,152,169,138,151,147,1,205,6,8,111,
+229,213,239,241,209,223,121,11,24,143,239,252,240,155,160,245,140,163,127,
+179,198,43,220,200,219,203,204,214,117,135,165,1,41,1,14,1,9,1,50,166,146,
+251,164,236,238,70,166,86,164,145,0,1,0,174,0,0,4,76,6,20,0,22,0,0,33,17,
+52,38,35,34,6,21,17,35,17,51,17,20,7,51,54,54,51,50,22,21,17,3,154,119,127,
+167,155,180,180,10,12,49,180,113,200,202,2,190,134,131,186,214,253,201,6,
+20,254,56,90,64,80,90,191,210,253,53,0,2,0,160,0,0,1,115,5,229,0,3,0,15,0,
+0,33,35,17,51,3,52,54,51,50,22,21,20,6,35,34,38,1,98,180,180,194,61,45,42,
+63,63,42,45,61,4,74,1,41,60,54,54,60,59,56,56,0,2,255,143,254,20,1,115,5,
+229,0,13,0,25,0,0,19,34,39,53,22,51,50,54,53,17,51,17,20,6,3,52,54,51,50,
+22,21,20,6,35,34,38,45,94,64,69,67,78,73,180,157,37,61,45,42,63,63,42,45,
+61,254,20,25,145,20,85,87,4,244,251,18,164,164,7,95,60,54,54,60,59,56,56,
+0,1,0,174,0,0,4,51,6,20,0,15,0,0,1,55,55,1,51,1,1,35,1,7,17,35,17,51,17,7,
+1,96,61,70,1,95,210,254,68,1,219,217,254,131,125,178,178,8,2,53,78,84,1,115,
+254,43,253,139,2,0,109,254,109,6,20,252,211,178,0,1,0,174,0,0,1,98,6,20,0,
+3,0,0,33,35,17,51,1,98,180,180,6,20,0,1,0,174,0,0,6,213,4,94,0,34,0,0,33,
+17,16,35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,51,32,
+23,51,54,54,51,50,22,21,17,6,35,223,153,144,179,109,116,152,141,180,145,27,
+10,47,171,106,1,2,78,10,53,183,116,186,185,2,195,1,4,178,183,253,162,2,195,
+130,130,186,212,253,199,4,74,150,80,90,184,88,96,192,211,253,53,0,1,0,174,
+0,0,4,76,4,94,0,20,0,0,33,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,51,
+50,22,21,17,3,154,119,127,169,153,180,145,27,10,51,184,111,202,196,2,190,
+134,131,187,211,253,199,4,74,150,81,89,196,207,253,53,0,2,0,113,255,236,4,
+104,4,94,0,12,0,23,0,0,1,16,0,35,34,38,2,53,16,0,51,50,0,1,20,22,51,50,54,
+53,52,38,35,32,4,104,254,240,240,149,230,124,1,12,242,232,1,17,252,195,163,
+159,157,164,165,159,254,193,2,39,254,243,254,210,139,1,4,172,1,12,1,43,254,
+207,254,250,207,215,215,207,207,209,0,2,0,174,254,20,4,123,4,94,0,20,0,33,
+0,0,5,34,39,35,23,22,21,17,35,17,51,23,51,54,54,51,50,18,17,16,2,3,34,6,7,
+21,20,22,51,50,54,53,52,38,2,182,221,119,12,4,8,180,148,24,8,64,168,110,214,
+237,238,245,163,145,2,148,166,138,155,155,20,159,41,78,61,254,61,6,54,150,
+90,80,254,215,254,242,254,243,254,210,3,219,184,197,35,223,199,224,200,201,
+213,0,2,0,113,254,20,4,61,4,94,0,12,0,31,0,0,37,50,54,55,53,52,38,35,34,6,
+21,20,22,23,34,2,17,16,18,51,50,23,51,55,51,17,35,17,52,55,35,6,2,82,161,
+148,4,152,165,141,150,149,111,212,234,239,213,225,117,8,27,143,180,10,12,
+115,129,176,203,37,227,197,222,204,201,213,149,1,44,1,11,1,12,1,47,170,150,
+249,202,1,213,110,60,167,0,1,0,174,0,0,3,47,4,94,0,17,0,0,1,50,23,7,38,35,
+34,6,6,21,17,35,17,51,23,51,54,54,2,174,73,56,22,61,58,87,149,84,180,148,
+20,8,63,172,4,94,12,166,14,96,169,103,253,182,4,74,201,109,112,0,1,0,104,
+255,236,3,121,4,94,0,35,0,0,1,20,6,35,34,39,53,22,51,50,54,53,52,38,39,46,
+2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,30,2,3,121,230,208,217,128,181,
+168,136,124,119,152,155,126,59,220,192,187,163,61,167,134,112,116,100,183,
+137,131,62,1,47,154,169,69,164,88,88,74,65,90,58,60,85,106,76,135,156,74,
+143,70,71,62,60,79,70,51,88,110,0,1,0,33,255,236,2,182,5,70,0,22,0,0,37,50,
+54,55,21,6,6,35,32,17,17,35,53,55,55,51,21,33,21,33,17,20,22,2,29,35,94,24,
+25,105,54,254,190,155,157,72,107,1,61,254,195,91,127,14,9,138,11,21,1,83,
+2,127,86,72,234,252,140,253,134,95,102,0,1,0,162,255,236,4,68,4,74,0,20,0,
+0,1,17,20,22,51,50,54,53,17,51,17,35,39,35,6,6,35,34,38,53,17,1,88,119,125,
+169,154,181,148,26,9,49,180,119,198,201,4,74,253,61,133,129,188,209,2,60,
+251,182,145,79,86,190,209,2,207,0,1,0,0,0,0,4,16,4,74,0,13,0,0,33,1,51,19,
+22,23,51,62,2,55,19,51,1,1,160,254,96,193,233,69,19,8,3,9,12,68,234,192,254,
+95,4,74,253,121,195,96,13,33,39,206,2,135,251,182,0,1,0,23,0,0,6,51,4,74,
+0,31,0,0,33,3,38,39,35,6,7,3,35,1,51,18,18,23,51,55,54,55,19,51,19,30,3,23,
+51,54,55,19,51,1,4,47,188,26,50,8,42,32,197,204,254,211,186,104,109,10,8,
+14,31,29,195,196,189,10,23,20,16,4,9,9,64,154,184,254,207,2,106,77,214,195,
+98,253,152,4,74,254,107,254,90,87,62,143,90,2,107,253,149,35,79,77,73,29,
+76,250,2,74,251,182,0,1,0,37,0,0,4,23,4,74,0,11,0,0,1,1,51,1,1,51,1,1,35,
+1,1,35,1,178,254,133,205,1,27,1,24,203,254,133,1,144,205,254,213,254,209,
+203,2,49,2,25,254,98,1,158,253,231,253,207,1,182,254,74,0,1,0,2,254,20,4,
+20,4,74,0,23,0,0,19,51,19,22,23,51,54,54,55,19,51,1,6,6,35,34,39,53,22,51,
+50,54,55,55,2,193,237,75,17,8,9,64,22,223,194,254,39,69,190,140,75,74,50,
+70,86,120,38,57,4,74,253,143,204,95,37,203,61,2,111,251,30,182,158,17,143,
+12,95,99,146,0,1,0,80,0,0,3,115,4,74,0,9,0,0,33,33,53,1,33,53,33,21,1,33,
+3,115,252,221,2,78,253,213,2,241,253,187,2,84,119,3,71,140,135,252,200,0,
+1,0,57,254,188,2,201,5,182,0,30,0,0,19,54,54,53,17,52,54,51,21,6,6,21,17,
+20,7,21,22,22,21,17,20,22,23,21,38,38,53,17,52,38,35,57,132,118,215,191,116,
+112,223,115,108,118,110,200,206,129,121,2,133,2,93,96,1,47,155,168,147,4,
+94,95,254,217,210,39,13,20,124,106,254,211,100,88,2,148,2,168,156,1,45,104,
+89,0,1,1,233,254,18,2,127,6,20,0,3,0,0,1,51,17,35,1,233,150,150,6,20,247,
+254,0,1,0,66,254,188,2,209,5,182,0,28,0,0,1,6,6,21,17,20,6,35,53,54,53,17,
+52,55,53,38,53,17,52,38,39,53,22,22,21,17,20,22,51,2,209,122,128,213,192,
+227,223,223,118,109,198,207,128,122,1,240,2,86,103,254,207,154,170,148,4,
+188,1,41,211,39,12,39,211,1,43,100,89,2,147,2,165,158,254,213,105,88,0,1,
+0,102,2,76,4,43,3,88,0,23,0,0,1,34,6,7,53,54,51,50,22,23,22,22,51,50,54,55,
+21,6,35,34,38,39,38,38,1,80,53,127,54,100,146,70,119,81,73,94,46,54,128,54,
+102,144,72,126,72,73,94,2,197,67,54,160,108,31,34,31,25,64,57,158,110,33,
+32,32,24,0,2,0,147,254,139,1,145,4,94,0,3,0,15,0,0,19,51,19,35,19,20,6,35,
+34,38,53,52,54,51,50,22,213,119,51,221,239,65,62,62,65,68,59,59,68,2,164,
+251,231,5,72,67,70,69,68,66,73,72,0,1,0,186,255,236,3,225,5,203,0,27,0,0,
+37,6,7,21,35,53,38,2,53,16,37,53,51,21,22,23,7,38,35,34,6,21,20,22,51,50,
+54,55,3,207,113,141,137,204,194,1,142,139,152,118,53,143,101,167,158,160,
+157,89,135,63,240,57,5,198,204,31,1,21,249,1,252,62,172,164,6,53,150,53,208,
+212,213,194,35,26,0,1,0,66,0,0,4,72,5,201,0,29,0,0,1,50,23,7,38,35,34,6,21,
+17,33,21,33,21,20,6,7,33,21,33,53,54,53,53,35,53,51,17,52,54,2,172,190,173,
+64,167,128,117,122,1,161,254,95,65,75,3,19,251,250,202,196,196,225,5,201,
+84,144,78,121,135,254,228,136,213,96,137,45,164,152,47,241,215,136,1,47,181,
+206,0,2,0,121,1,6,4,23,4,160,0,27,0,39,0,0,19,52,55,39,55,23,54,51,50,23,
+55,23,7,22,21,20,7,23,7,39,6,35,34,39,7,39,55,38,55,20,22,51,50,54,53,52,
+38,35,34,6,184,72,135,100,135,100,130,121,104,137,99,132,72,72,129,96,137,
+103,122,132,98,135,98,133,72,138,153,111,111,155,155,111,110,154,2,211,117,
+108,139,97,131,71,71,131,97,137,111,116,130,99,136,96,131,69,71,131,96,136,
+108,119,111,153,152,112,114,154,155,0,1,0,29,0,0,4,115,5,182,0,22,0,0,1,1,
+51,1,51,21,33,21,33,21,33,17,35,17,33,53,33,53,33,53,51,1,51,2,72,1,110,189,
+254,100,254,254,203,1,53,254,203,176,254,202,1,54,254,202,250,254,105,190,
+2,236,2,202,253,0,131,168,131,254,248,1,8,131,168,131,3,0,0,2,1,233,254,18,
+2,127,6,20,0,3,0,7,0,0,1,51,17,35,17,51,17,35,1,233,150,150,150,150,6,20,
+252,244,254,23,252,243,0,2,0,121,255,246,3,147,6,31,0,46,0,58,0,0,19,52,54,
+55,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,22,22,21,20,7,22,
+21,20,6,35,34,39,53,22,22,51,50,54,53,52,38,39,38,38,55,20,22,22,23,54,53,
+52,38,39,6,6,137,86,76,74,82,208,196,92,151,107,55,97,136,74,115,109,116,
+155,182,151,153,151,236,210,210,136,87,190,77,128,138,106,158,197,143,154,
+54,121,163,131,140,182,65,82,3,41,87,135,36,40,112,84,123,141,28,42,137,39,
+28,59,61,56,84,55,67,153,108,180,92,80,145,142,155,67,154,39,45,74,71,61,
+79,61,73,150,133,51,75,70,62,76,111,81,109,58,18,99,0,2,1,49,5,12,3,113,5,
+215,0,11,0,23,0,0,1,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,
+20,6,35,34,38,1,49,56,40,39,58,58,39,40,56,1,129,56,38,39,58,58,39,38,56,
+5,115,53,47,47,53,53,50,50,53,53,47,47,53,53,50,50,0,3,0,100,255,236,6,68,
+5,203,0,22,0,38,0,54,0,0,1,34,6,21,20,22,51,50,55,21,6,6,35,34,38,53,52,54,
+51,50,23,7,38,1,52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,18,4,51,50,
+36,18,53,52,2,36,35,34,4,2,3,125,119,135,117,135,95,120,60,98,65,193,211,
+222,190,130,122,60,106,252,147,200,1,94,202,200,1,94,202,194,254,162,208,
+207,254,162,195,109,172,1,43,172,172,1,42,173,172,254,213,172,172,254,214,
+173,4,31,171,153,157,168,47,131,27,23,240,219,209,248,62,125,54,254,188,200,
+1,94,202,200,254,162,202,197,254,166,208,207,1,90,198,172,254,214,173,172,
+1,43,172,172,1,42,173,172,254,213,0,2,0,66,3,16,2,119,5,199,0,24,0,33,0,0,
+1,39,6,35,34,38,53,52,54,55,55,53,52,38,35,34,7,38,39,54,51,50,22,21,17,37,
+20,51,50,53,53,7,6,6,2,23,25,94,140,97,113,158,165,115,78,68,100,106,26,20,
+122,134,134,135,254,78,110,197,98,111,98,3,29,86,99,100,103,103,106,6,4,45,
+61,60,53,62,38,60,110,122,254,62,190,98,178,47,4,4,57,0,2,0,82,0,115,3,195,
+3,197,0,6,0,13,0,0,19,1,23,1,1,7,1,37,1,23,1,1,7,1,82,1,88,129,254,225,1,
+31,129,254,168,1,149,1,93,127,254,225,1,31,127,254,163,2,41,1,156,74,254,
+162,254,161,75,1,155,27,1,156,74,254,162,254,161,75,1,155,0,1,0,102,1,6,4,
+41,3,27,0,5,0,0,1,17,35,17,33,53,4,41,145,252,206,3,27,253,235,1,131,146,
+255,255,0,82,1,213,2,66,2,117,18,6,0,16,0,0,0,4,0,100,255,236,6,68,5,203,
+0,8,0,22,0,38,0,54,0,0,1,51,50,54,53,52,38,35,35,5,20,6,7,19,35,3,35,17,35,
+17,33,50,22,1,52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,18,4,51,50,36,
+18,53,52,2,36,35,34,4,2,2,215,102,81,89,82,90,100,1,174,86,74,238,176,205,
+127,156,1,7,168,155,251,223,200,1,94,202,200,1,94,202,194,254,162,208,207,
+254,162,195,109,172,1,43,172,172,1,42,173,172,254,213,172,172,254,214,173,
+2,252,80,65,73,65,134,83,121,29,254,115,1,98,254,158,3,127,131,254,196,200,
+1,94,202,200,254,162,202,197,254,166,208,207,1,90,198,172,254,214,173,172,
+1,43,172,172,1,42,173,172,254,213,0,1,255,250,6,20,4,6,6,156,0,3,0,0,1,33,
+53,33,4,6,251,244,4,12,6,20,136,0,2,0,123,3,86,2,242,5,203,0,11,0,23,0,0,
+19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,123,
+184,131,133,183,184,132,130,185,123,115,79,81,110,110,81,80,114,4,143,135,
+181,184,132,131,182,179,134,79,113,114,78,80,113,112,0,2,0,102,0,0,4,41,4,
+201,0,11,0,15,0,0,1,33,21,33,17,35,17,33,53,33,17,51,1,53,33,21,2,145,1,152,
+254,104,147,254,104,1,152,147,253,213,3,195,3,33,146,254,90,1,166,146,1,168,
+251,55,145,145,0,1,0,49,2,74,2,117,5,201,0,24,0,0,1,33,53,55,54,54,53,52,
+38,35,34,6,7,39,54,51,50,22,21,20,14,2,7,33,2,115,253,190,236,127,71,75,62,
+62,100,53,72,133,156,132,149,25,52,83,242,1,144,2,74,110,230,123,113,69,65,
+66,48,40,94,113,131,111,46,79,81,92,228,0,1,0,35,2,57,2,145,5,201,0,33,0,
+0,1,20,7,22,21,20,6,35,34,39,53,22,51,50,53,52,35,35,53,51,50,54,53,52,38,
+35,34,7,39,54,54,51,50,22,2,119,152,178,184,170,152,116,142,128,205,225,117,
+117,103,95,77,66,104,123,74,74,144,81,136,157,4,231,151,57,44,165,127,142,
+58,129,70,156,141,113,78,65,59,66,78,94,55,46,121,0,1,1,131,4,217,3,31,6,
+33,0,9,0,0,1,54,54,55,51,21,6,6,7,35,1,131,38,117,40,217,44,186,63,119,4,
+242,48,177,78,21,64,194,49,0,1,0,174,254,20,4,78,4,74,0,22,0,0,1,16,51,50,
+54,53,17,51,17,35,39,35,6,35,34,39,35,22,21,17,35,17,51,1,98,246,169,153,
+180,146,28,10,109,221,146,90,8,10,180,180,1,133,254,252,187,210,2,60,251,
+182,147,167,92,74,170,254,192,6,54,0,1,0,113,254,252,4,100,6,20,0,15,0,0,
+1,35,17,35,17,35,17,6,35,34,38,53,16,54,51,33,4,100,118,209,119,62,84,216,
+203,218,232,2,49,254,252,6,166,249,90,3,51,18,250,251,1,4,254,0,1,0,147,2,
+72,1,145,3,94,0,11,0,0,19,52,54,51,50,22,21,20,6,35,34,38,147,65,60,62,67,
+68,61,59,66,2,211,65,74,75,64,64,75,74,0,1,0,29,254,20,1,178,0,0,0,17,0,0,
+1,20,6,35,34,39,53,22,51,50,54,53,52,39,55,51,7,22,1,178,151,152,65,37,36,
+72,75,77,187,88,119,53,178,254,227,99,108,11,112,10,39,51,89,24,176,109,38,
+0,1,0,76,2,74,1,236,5,182,0,10,0,0,1,51,17,35,17,52,55,6,6,7,39,1,86,150,
+146,8,31,46,130,71,5,182,252,148,2,53,67,115,28,38,93,100,0,2,0,66,3,16,2,
+195,5,199,0,11,0,23,0,0,1,20,6,35,34,38,53,52,54,51,50,22,5,20,22,51,50,54,
+53,52,38,35,34,6,2,195,173,151,145,172,168,153,149,171,254,0,88,102,100,90,
+90,100,100,90,4,109,163,186,185,164,165,181,182,164,121,119,119,121,121,116,
+116,0,2,0,80,0,115,3,193,3,197,0,6,0,13,0,0,1,1,39,1,1,55,1,5,1,39,1,1,55,
+1,3,193,254,163,127,1,31,254,225,127,1,93,254,104,254,166,127,1,31,254,225,
+127,1,90,2,14,254,101,75,1,95,1,94,74,254,100,27,254,101,75,1,95,1,94,74,
+254,100,255,255,0,71,0,0,5,227,5,182,16,39,2,23,2,137,0,0,16,38,0,123,251,
+0,16,7,2,59,3,41,253,183,255,255,0,46,0,0,5,211,5,182,16,39,2,23,2,76,0,0,
+16,38,0,123,226,0,16,7,0,116,3,94,253,183,255,255,0,32,0,0,6,45,5,201,16,
+39,2,23,2,227,0,0,16,39,2,59,3,115,253,183,16,6,0,117,253,0,0,2,0,51,254,
+119,3,96,4,94,0,26,0,37,0,0,1,21,20,6,7,6,6,21,20,22,51,50,55,23,6,35,34,
+38,53,52,54,54,55,54,54,53,53,19,20,35,34,38,53,52,54,51,50,22,2,90,74,100,
+133,70,127,119,159,171,63,198,201,194,220,40,82,120,103,61,192,127,62,63,
+73,52,54,73,2,164,53,117,150,84,111,110,84,96,109,88,145,98,187,169,73,113,
+102,103,90,111,88,33,1,47,137,71,66,73,66,66,255,255,0,0,0,0,5,27,7,115,18,
+38,0,36,0,0,16,7,0,67,255,202,1,82,255,255,0,0,0,0,5,27,7,115,18,38,0,36,
+0,0,16,7,0,118,0,139,1,82,255,255,0,0,0,0,5,27,7,115,18,38,0,36,0,0,16,7,
+1,75,0,39,1,82,255,255,0,0,0,0,5,27,7,51,18,38,0,36,0,0,16,7,1,82,0,12,1,
+82,255,255,0,0,0,0,5,27,7,41,18,38,0,36,0,0,16,7,0,106,0,57,1,82,0,3,0,0,
+0,0,5,27,7,6,0,18,0,24,0,36,0,0,1,20,6,7,1,35,3,33,3,35,1,38,38,53,52,54,
+51,50,22,19,3,39,6,7,3,1,52,38,35,34,6,21,20,22,51,50,54,3,109,60,51,2,29,
+191,176,253,188,174,186,2,27,53,60,120,103,102,126,8,164,70,30,33,166,1,86,
+65,50,49,65,58,56,51,64,6,49,69,99,24,250,143,1,197,254,59,5,106,25,100,72,
+98,117,118,251,216,1,187,219,120,99,254,69,3,199,54,61,61,54,54,61,61,0,2,
+255,254,0,0,6,145,5,182,0,15,0,19,0,0,33,33,17,33,3,35,1,33,21,33,17,33,21,
+33,17,33,1,33,17,35,6,145,253,7,254,0,220,190,2,182,3,221,253,191,2,26,253,
+230,2,65,251,78,1,185,119,1,197,254,59,5,182,162,254,56,160,253,246,1,198,
+2,170,255,255,0,125,254,20,4,207,5,203,18,38,0,38,0,0,16,7,0,122,2,4,0,0,
+255,255,0,199,0,0,3,248,7,115,18,38,0,40,0,0,16,7,0,67,255,183,1,82,255,255,
+0,199,0,0,3,248,7,115,18,38,0,40,0,0,16,7,0,118,0,66,1,82,255,255,0,199,0,
+0,3,248,7,115,18,38,0,40,0,0,16,7,1,75,255,251,1,82,255,255,0,199,0,0,3,248,
+7,41,18,38,0,40,0,0,16,7,0,106,0,14,1,82,255,255,0,60,0,0,2,98,7,115,18,38,
+0,44,0,0,16,7,0,67,254,185,1,82,255,255,0,82,0,0,2,136,7,115,18,38,0,44,0,
+0,16,7,0,118,255,105,1,82,255,255,255,253,0,0,2,177,7,115,18,38,0,44,0,0,
+16,7,1,75,254,249,1,82,255,255,0,60,0,0,2,124,7,41,18,38,0,44,0,0,16,7,0,
+106,255,11,1,82,0,2,0,61,0,0,5,90,5,182,0,12,0,24,0,0,1,16,0,33,33,17,35,
+53,51,17,33,32,0,3,16,0,33,35,17,33,21,33,17,51,32,5,90,254,119,254,139,254,
+121,152,152,1,180,1,85,1,124,194,254,234,254,237,226,1,109,254,147,185,2,
+82,2,233,254,153,254,126,2,131,160,2,147,254,135,254,166,1,24,1,30,254,10,
+160,254,27,255,255,0,199,0,0,5,78,7,51,18,38,0,49,0,0,16,7,1,82,0,154,1,82,
+255,255,0,125,255,236,5,195,7,115,18,38,0,50,0,0,16,7,0,67,0,119,1,82,255,
+255,0,125,255,236,5,195,7,115,18,38,0,50,0,0,16,7,0,118,1,14,1,82,255,255,
+0,125,255,236,5,195,7,115,18,38,0,50,0,0,16,7,1,75,0,180,1,82,255,255,0,125,
+255,236,5,195,7,51,18,38,0,50,0,0,16,7,1,82,0,158,1,82,255,255,0,125,255,
+236,5,195,7,41,18,38,0,50,0,0,16,7,0,106,0,211,1,82,0,1,0,131,1,14,4,12,4,
+152,0,14,0,0,1,1,23,1,0,23,7,38,39,1,39,54,55,1,55,2,72,1,94,102,254,164,
+1,32,58,102,231,119,254,170,107,131,215,254,164,107,3,57,1,95,105,254,164,
+254,220,56,105,231,115,254,166,105,129,219,1,90,107,0,3,0,125,255,193,5,195,
+5,248,0,19,0,27,0,35,0,0,1,16,0,33,34,39,7,39,55,38,17,16,0,33,50,23,55,23,
+7,22,3,16,39,1,22,51,50,18,1,16,23,1,38,35,34,2,5,195,254,157,254,193,232,
+147,98,125,106,180,1,95,1,71,204,160,95,124,104,193,195,104,253,112,114,167,
+235,244,252,63,97,2,141,109,157,238,246,2,221,254,161,254,110,96,139,81,152,
+198,1,111,1,101,1,137,92,135,84,146,203,254,150,1,8,150,252,94,78,1,44,1,
+38,254,253,146,3,155,72,254,211,255,255,0,184,255,236,5,31,7,115,18,38,0,
+56,0,0,16,7,0,67,0,66,1,82,255,255,0,184,255,236,5,31,7,115,18,38,0,56,0,
+0,16,7,0,118,0,213,1,82,255,255,0,184,255,236,5,31,7,115,18,38,0,56,0,0,16,
+7,1,75,0,127,1,82,255,255,0,184,255,236,5,31,7,41,18,38,0,56,0,0,16,7,0,106,
+0,152,1,82,255,255,0,0,0,0,4,135,7,115,18,38,0,60,0,0,16,7,0,118,0,55,1,82,
+0,2,0,199,0,0,4,111,5,182,0,12,0,21,0,0,1,20,4,33,35,17,35,17,51,21,51,32,
+4,1,51,50,54,53,52,38,35,35,4,111,254,211,254,227,166,184,184,197,1,25,1,
+18,253,16,147,221,193,182,197,182,3,14,226,239,254,195,5,182,254,211,253,
+244,142,157,144,135,0,1,0,174,255,236,4,176,6,31,0,47,0,0,1,20,7,6,6,21,20,
+22,23,22,22,21,20,6,35,34,39,53,22,22,51,50,53,52,38,39,38,38,53,52,54,55,
+54,54,53,52,38,35,32,21,17,35,17,52,54,51,50,22,4,45,143,79,65,64,117,137,
+100,197,184,187,110,64,159,68,211,81,112,118,105,68,72,74,65,133,127,254,
+239,180,228,225,210,232,4,240,139,112,62,73,34,40,66,76,92,157,100,161,172,
+69,162,40,46,176,71,104,71,75,125,87,63,105,53,55,92,51,78,86,221,251,84,
+4,172,181,190,160,255,255,0,94,255,236,3,215,6,33,18,38,0,68,0,0,16,6,0,67,
+144,0,255,255,0,94,255,236,3,215,6,33,18,38,0,68,0,0,16,6,0,118,49,0,255,
+255,0,94,255,236,3,215,6,33,18,38,0,68,0,0,16,6,1,75,220,0,255,255,0,94,255,
+236,3,215,5,225,18,38,0,68,0,0,16,6,1,82,198,0,255,255,0,94,255,236,3,215,
+5,215,18,38,0,68,0,0,16,6,0,106,230,0,255,255,0,94,255,236,3,215,6,137,18,
+38,0,68,0,0,16,6,1,80,253,0,0,3,0,94,255,236,6,129,4,94,0,40,0,51,0,58,0,
+0,19,16,37,55,53,52,38,35,34,7,39,54,54,51,50,22,23,54,54,51,50,18,21,21,
+33,18,33,50,54,55,21,6,6,35,32,39,6,6,35,34,38,55,20,22,51,50,54,53,53,7,
+6,6,1,34,6,7,33,52,38,94,1,244,184,113,116,139,168,56,71,203,103,128,165,
+43,54,170,112,197,233,253,66,8,1,53,88,154,94,88,152,102,254,221,125,82,198,
+136,164,184,187,104,86,140,163,153,177,163,3,184,119,136,11,1,252,125,1,49,
+1,78,16,7,69,122,118,84,135,40,54,83,93,85,93,254,242,221,111,254,129,33,
+43,158,39,32,231,124,107,171,152,92,86,163,150,99,7,7,106,2,42,161,153,152,
+162,255,255,0,113,254,20,3,147,4,94,18,38,0,70,0,0,16,7,0,122,1,76,0,0,255,
+255,0,113,255,236,4,27,6,33,18,38,0,72,0,0,16,6,0,67,181,0,255,255,0,113,
+255,236,4,27,6,33,18,38,0,72,0,0,16,6,0,118,80,0,255,255,0,113,255,236,4,
+27,6,33,18,38,0,72,0,0,16,6,1,75,249,0,255,255,0,113,255,236,4,27,5,215,18,
+38,0,72,0,0,16,6,0,106,10,0,255,255,255,212,0,0,1,112,6,33,18,38,0,243,0,
+0,16,7,0,67,254,81,0,0,255,255,0,167,0,0,2,67,6,33,18,38,0,243,0,0,16,7,0,
+118,255,36,0,0,255,255,255,175,0,0,2,99,6,33,18,38,0,243,0,0,16,7,1,75,254,
+171,0,0,255,255,255,234,0,0,2,42,5,215,18,38,0,243,0,0,16,7,0,106,254,185,
+0,0,0,2,0,113,255,236,4,104,6,31,0,27,0,39,0,0,1,16,0,35,34,0,53,52,0,51,
+50,23,55,38,39,5,39,55,38,39,55,22,23,55,23,7,22,18,3,52,38,35,34,6,21,20,
+22,51,50,54,4,104,254,246,246,225,254,234,1,3,222,225,94,9,59,195,254,245,
+77,229,86,98,73,156,102,236,78,203,151,166,182,175,150,166,160,168,158,169,
+156,2,51,254,230,254,211,1,15,226,229,1,7,119,4,214,177,153,112,131,58,51,
+123,73,75,137,110,117,140,254,117,254,232,143,166,173,179,165,179,198,255,
+255,0,174,0,0,4,76,5,225,18,38,0,81,0,0,16,6,1,82,16,0,255,255,0,113,255,
+236,4,104,6,33,18,38,0,82,0,0,16,6,0,67,208,0,255,255,0,113,255,236,4,104,
+6,33,18,38,0,82,0,0,16,6,0,118,90,0,255,255,0,113,255,236,4,104,6,33,18,38,
+0,82,0,0,16,6,1,75,12,0,255,255,0,113,255,236,4,104,5,225,18,38,0,82,0,0,
+16,6,1,82,245,0,255,255,0,113,255,236,4,104,5,215,18,38,0,82,0,0,16,6,0,106,
+25,0,0,3,0,102,0,248,4,43,4,170,0,3,0,13,0,23,0,0,19,53,33,21,1,52,51,50,
+21,20,6,35,34,38,17,52,51,50,21,20,6,35,34,38,102,3,197,253,170,115,112,66,
+46,48,67,115,112,66,46,48,67,2,137,146,146,254,236,123,123,66,59,59,2,252,
+123,123,66,59,59,0,3,0,113,255,188,4,104,4,135,0,19,0,26,0,34,0,0,1,16,0,
+35,34,39,7,39,55,38,17,16,0,51,50,23,55,23,7,22,5,20,23,1,38,35,32,1,52,39,
+1,22,51,50,54,4,104,254,240,240,151,113,82,118,92,131,1,12,242,151,117,80,
+121,93,129,252,195,49,1,195,73,108,254,193,2,131,47,254,61,69,108,157,164,
+2,39,254,243,254,210,67,115,80,127,156,1,0,1,12,1,43,74,115,78,129,155,246,
+166,96,2,114,52,254,96,152,100,253,141,47,215,255,255,0,162,255,236,4,68,
+6,33,18,38,0,88,0,0,16,6,0,67,194,0,255,255,0,162,255,236,4,68,6,33,18,38,
+0,88,0,0,16,6,0,118,117,0,255,255,0,162,255,236,4,68,6,33,18,38,0,88,0,0,
+16,6,1,75,20,0,255,255,0,162,255,236,4,68,5,215,18,38,0,88,0,0,16,6,0,106,
+33,0,255,255,0,2,254,20,4,20,6,33,18,38,0,92,0,0,16,6,0,118,23,0,0,2,0,174,
+254,20,4,123,6,20,0,21,0,33,0,0,1,54,54,51,50,18,17,16,2,35,34,39,35,22,21,
+17,35,17,51,17,20,7,37,34,6,7,21,20,22,51,32,17,52,38,1,100,67,167,106,213,
+238,238,213,222,120,12,12,180,180,6,1,62,161,149,2,148,166,1,37,143,3,182,
+91,77,254,213,254,244,254,243,254,210,159,132,40,254,53,8,0,254,54,70,78,
+17,179,198,39,223,199,1,168,208,206,255,255,0,2,254,20,4,20,5,215,18,38,0,
+92,0,0,16,6,0,106,185,0,255,255,0,0,0,0,5,27,6,188,18,38,0,36,0,0,16,7,1,
+77,0,66,1,82,255,255,0,94,255,236,3,215,5,106,18,38,0,68,0,0,16,6,1,77,249,
+0,255,255,0,0,0,0,5,27,7,62,18,38,0,36,0,0,16,7,1,78,0,47,1,82,255,255,0,
+94,255,236,3,215,5,236,18,38,0,68,0,0,16,6,1,78,232,0,255,255,0,0,254,61,
+5,27,5,188,18,38,0,36,0,0,16,7,1,81,3,156,0,0,255,255,0,94,254,61,4,6,4,92,
+18,38,0,68,0,0,16,7,1,81,2,145,0,0,255,255,0,125,255,236,4,207,7,115,18,38,
+0,38,0,0,16,7,0,118,1,8,1,82,255,255,0,113,255,236,3,147,6,33,18,38,0,70,
+0,0,16,6,0,118,72,0,255,255,0,125,255,236,4,207,7,115,18,38,0,38,0,0,16,7,
+1,75,0,190,1,82,255,255,0,113,255,236,3,165,6,33,18,38,0,70,0,0,16,6,1,75,
+237,0,255,255,0,125,255,236,4,207,7,55,18,38,0,38,0,0,16,7,1,79,2,18,1,82,
+255,255,0,113,255,236,3,147,5,229,18,38,0,70,0,0,16,7,1,79,1,78,0,0,255,255,
+0,125,255,236,4,207,7,115,18,38,0,38,0,0,16,7,1,76,0,190,1,82,255,255,0,113,
+255,236,3,173,6,33,18,38,0,70,0,0,16,6,1,76,245,0,255,255,0,199,0,0,5,90,
+7,115,18,38,0,39,0,0,16,7,1,76,0,88,1,82,255,255,0,113,255,236,5,143,6,20,
+18,38,0,71,0,0,16,7,2,56,3,20,0,0,255,255,0,61,0,0,5,90,5,182,18,6,0,146,
+0,0,0,2,0,113,255,236,4,217,6,20,0,27,0,40,0,0,5,34,2,17,16,18,51,50,23,51,
+38,38,53,53,33,53,33,53,51,21,51,21,35,17,35,39,35,6,39,50,54,53,53,52,38,
+35,34,6,21,20,22,2,51,214,236,235,215,223,119,13,3,10,254,76,1,180,180,156,
+156,147,27,8,115,194,163,150,152,165,140,149,144,20,1,38,1,13,1,15,1,42,162,
+14,110,40,125,135,182,182,135,251,41,147,167,149,177,202,35,230,190,214,208,
+197,215,255,255,0,199,0,0,3,248,6,188,18,38,0,40,0,0,16,7,1,77,0,4,1,82,255,
+255,0,113,255,236,4,27,5,106,18,38,0,72,0,0,16,6,1,77,8,0,255,255,0,199,0,
+0,3,248,7,62,18,38,0,40,0,0,16,7,1,78,0,12,1,82,255,255,0,113,255,236,4,27,
+5,236,18,38,0,72,0,0,16,6,1,78,253,0,255,255,0,199,0,0,3,248,7,26,18,38,0,
+40,0,0,16,7,1,79,1,102,1,53,255,255,0,113,255,236,4,27,5,229,18,38,0,72,0,
+0,16,7,1,79,1,82,0,0,255,255,0,199,254,61,3,248,5,182,18,38,0,40,0,0,16,7,
+1,81,2,109,0,0,255,255,0,113,254,90,4,27,4,94,18,38,0,72,0,0,16,7,1,81,2,
+98,0,29,255,255,0,199,0,0,3,248,7,115,18,38,0,40,0,0,16,7,1,76,0,12,1,82,
+255,255,0,113,255,236,4,27,6,33,18,38,0,72,0,0,16,6,1,76,253,0,255,255,0,
+125,255,236,5,59,7,115,18,38,0,42,0,0,16,7,1,75,0,248,1,82,255,255,0,113,
+254,20,4,61,6,33,18,38,0,74,0,0,16,6,1,75,10,0,255,255,0,125,255,236,5,59,
+7,62,18,38,0,42,0,0,16,7,1,78,0,248,1,82,255,255,0,113,254,20,4,61,5,236,
+18,38,0,74,0,0,16,6,1,78,14,0,255,255,0,125,255,236,5,59,7,55,18,38,0,42,
+0,0,16,7,1,79,2,88,1,82,255,255,0,113,254,20,4,61,5,229,18,38,0,74,0,0,16,
+7,1,79,1,90,0,0,255,255,0,125,254,59,5,59,5,203,18,38,0,42,0,0,16,7,2,57,
+1,37,0,0,255,255,0,113,254,20,4,61,6,33,18,38,0,74,0,0,16,7,2,58,0,133,0,
+0,255,255,0,199,0,0,5,37,7,115,18,38,0,43,0,0,16,7,1,75,0,150,1,82,255,255,
+0,174,0,0,4,76,7,170,18,38,0,75,0,0,16,7,1,75,0,33,1,137,0,2,0,0,0,0,5,236,
+5,182,0,19,0,23,0,0,19,53,51,21,33,53,51,21,51,21,35,17,35,17,33,17,35,17,
+35,53,1,53,33,21,199,184,2,238,184,199,199,184,253,18,184,199,4,109,253,18,
+4,195,243,243,243,243,148,251,209,2,170,253,86,4,47,148,254,137,227,227,0,
+1,0,18,0,0,4,76,6,20,0,30,0,0,33,17,52,38,35,34,6,21,17,35,17,35,53,51,53,
+51,21,33,21,33,21,20,7,51,54,54,51,50,22,21,17,3,154,119,127,169,153,180,
+156,156,180,1,178,254,78,10,12,53,183,108,199,201,2,150,133,131,185,213,253,
+240,4,213,135,184,184,135,178,88,64,85,85,193,210,253,94,255,255,255,228,
+0,0,2,212,7,51,18,38,0,44,0,0,16,7,1,82,254,226,1,82,255,255,255,146,0,0,
+2,130,5,225,18,38,0,243,0,0,16,7,1,82,254,144,0,0,255,255,0,44,0,0,2,140,
+6,188,18,38,0,44,0,0,16,7,1,77,255,1,1,82,255,255,255,220,0,0,2,60,5,106,
+18,38,0,243,0,0,16,7,1,77,254,177,0,0,255,255,0,30,0,0,2,155,7,62,18,38,0,
+44,0,0,16,7,1,78,254,255,1,82,255,255,255,202,0,0,2,71,5,236,18,38,0,243,
+0,0,16,7,1,78,254,171,0,0,255,255,0,82,254,61,2,98,5,182,18,38,0,44,0,0,16,
+7,1,81,0,145,0,0,255,255,0,51,254,61,1,133,5,229,18,38,0,76,0,0,16,6,1,81,
+16,0,255,255,0,82,0,0,2,98,7,55,18,38,0,44,0,0,16,7,1,79,0,80,1,82,0,1,0,
+174,0,0,1,98,4,74,0,3,0,0,33,35,17,51,1,98,180,180,4,74,255,255,0,82,254,
+123,4,43,5,182,16,38,0,44,0,0,16,7,0,45,2,182,0,0,255,255,0,160,254,20,3,
+127,5,229,16,38,0,76,0,0,16,7,0,77,2,12,0,0,255,255,255,96,254,123,2,117,
+7,115,18,38,0,45,0,0,16,7,1,75,254,189,1,82,255,255,255,143,254,20,2,93,6,
+33,18,38,2,55,0,0,16,7,1,75,254,165,0,0,255,255,0,199,254,59,4,244,5,182,
+18,38,0,46,0,0,16,7,2,57,0,137,0,0,255,255,0,174,254,59,4,51,6,20,18,38,0,
+78,0,0,16,6,2,57,49,0,0,1,0,174,0,0,4,51,4,74,0,14,0,0,1,51,1,1,35,1,7,17,
+35,17,51,17,20,7,55,3,57,217,254,97,1,192,215,254,152,135,191,191,13,84,4,
+74,254,26,253,156,1,240,111,254,127,4,74,254,227,139,137,102,255,255,0,199,
+0,0,3,254,7,115,18,38,0,47,0,0,16,7,0,118,255,110,1,82,255,255,0,165,0,0,
+2,65,7,172,18,38,0,79,0,0,16,7,0,118,255,34,1,139,255,255,0,199,254,59,3,
+254,5,182,18,38,0,47,0,0,16,6,2,57,51,0,255,255,0,92,254,59,1,98,6,20,18,
+38,0,79,0,0,16,7,2,57,254,237,0,0,255,255,0,199,0,0,3,254,5,183,18,38,0,47,
+0,0,16,7,2,56,1,37,255,163,255,255,0,174,0,0,2,182,6,20,18,38,0,79,0,0,16,
+6,2,56,59,0,255,255,0,199,0,0,3,254,5,182,18,38,0,47,0,0,16,7,1,79,2,8,253,
+105,255,255,0,174,0,0,2,191,6,20,16,38,0,79,0,0,16,7,1,79,1,76,253,56,0,1,
+0,27,0,0,3,254,5,182,0,13,0,0,51,17,7,39,55,17,51,17,37,23,5,17,33,21,199,
+101,71,172,184,1,25,73,254,158,2,127,1,250,57,122,103,3,20,253,88,166,129,
+205,254,62,164,0,1,255,238,0,0,2,35,6,20,0,11,0,0,1,55,23,7,17,35,17,7,39,
+55,17,51,1,84,131,76,207,180,105,73,178,180,3,102,91,121,140,253,68,2,72,
+66,121,115,3,34,255,255,0,199,0,0,5,78,7,115,18,38,0,49,0,0,16,7,0,118,1,
+8,1,82,255,255,0,174,0,0,4,76,6,33,18,38,0,81,0,0,16,6,0,118,125,0,255,255,
+0,199,254,59,5,78,5,182,18,38,0,49,0,0,16,7,2,57,0,209,0,0,255,255,0,174,
+254,59,4,76,4,94,18,38,0,81,0,0,16,6,2,57,88,0,255,255,0,199,0,0,5,78,7,115,
+18,38,0,49,0,0,16,7,1,76,0,172,1,82,255,255,0,174,0,0,4,76,6,33,18,38,0,81,
+0,0,16,6,1,76,35,0,255,255,0,3,0,0,4,221,5,182,16,39,0,81,0,145,0,0,16,6,
+2,7,234,0,0,1,0,199,254,123,5,78,5,182,0,25,0,0,1,34,39,53,22,51,50,54,55,
+1,35,22,21,17,35,17,51,1,51,38,53,17,51,17,20,6,3,205,98,58,71,85,102,109,
+2,252,198,8,17,170,213,3,12,8,14,172,199,254,123,27,155,20,117,110,4,190,
+255,166,252,231,5,182,251,109,154,255,2,250,250,86,196,205,0,1,0,174,254,
+20,4,78,4,94,0,29,0,0,1,34,39,53,22,51,50,53,17,52,38,35,34,6,21,17,35,17,
+51,23,51,54,54,51,50,22,21,17,20,6,3,39,86,59,60,62,138,119,125,170,154,180,
+145,29,10,52,180,110,202,200,143,254,20,25,145,20,172,3,107,133,129,187,209,
+253,197,4,74,150,82,88,191,210,252,143,154,174,255,255,0,125,255,236,5,195,
+6,188,18,38,0,50,0,0,16,7,1,77,0,197,1,82,255,255,0,113,255,236,4,104,5,106,
+18,38,0,82,0,0,16,6,1,77,16,0,255,255,0,125,255,236,5,195,7,62,18,38,0,50,
+0,0,16,7,1,78,0,193,1,82,255,255,0,113,255,236,4,104,5,236,18,38,0,82,0,0,
+16,6,1,78,12,0,255,255,0,125,255,236,5,195,7,115,18,38,0,50,0,0,16,7,1,83,
+1,25,1,82,255,255,0,113,255,236,4,104,6,33,18,38,0,82,0,0,16,6,1,83,92,0,
+0,2,0,125,255,236,6,242,5,205,0,20,0,31,0,0,33,33,6,35,32,0,17,16,0,33,50,
+23,33,21,33,17,33,21,33,17,33,1,34,2,17,16,18,51,50,55,17,38,6,242,252,245,
+102,96,254,187,254,161,1,89,1,65,106,90,3,23,253,180,2,37,253,219,2,76,252,
+53,242,248,248,240,117,86,85,20,1,138,1,105,1,103,1,135,23,162,254,56,160,
+253,246,4,137,254,210,254,224,254,223,254,207,35,4,92,33,0,3,0,111,255,236,
+7,39,4,92,0,30,0,42,0,49,0,0,5,32,39,6,6,35,34,0,17,16,0,51,50,22,23,54,54,
+51,50,18,21,21,33,18,33,50,54,55,21,6,6,1,20,22,51,50,54,53,52,38,35,34,6,
+37,34,6,7,33,52,38,5,152,254,222,128,63,209,136,226,254,243,1,8,237,130,204,
+62,60,192,126,205,240,253,39,8,1,68,90,154,104,93,154,251,44,146,163,160,
+147,149,162,161,144,4,61,123,143,12,2,22,129,20,227,113,114,1,52,1,7,1,10,
+1,43,114,111,109,116,254,247,228,109,254,131,31,45,158,40,31,2,59,208,214,
+209,205,214,210,211,213,159,153,151,161,255,255,0,199,0,0,4,219,7,115,18,
+38,0,53,0,0,16,7,0,118,0,123,1,82,255,255,0,174,0,0,3,47,6,33,18,38,0,85,
+0,0,16,6,0,118,226,0,255,255,0,199,254,59,4,219,5,182,18,38,0,53,0,0,16,7,
+2,57,0,129,0,0,255,255,0,98,254,59,3,47,4,94,18,38,0,85,0,0,16,7,2,57,254,
+243,0,0,255,255,0,199,0,0,4,219,7,115,18,38,0,53,0,0,16,7,1,76,0,29,1,82,
+255,255,0,126,0,0,3,50,6,33,18,38,0,85,0,0,16,7,1,76,255,122,0,0,255,255,
+0,104,255,236,4,4,7,115,18,38,0,54,0,0,16,7,0,118,0,78,1,82,255,255,0,104,
+255,236,3,121,6,33,18,38,0,86,0,0,16,6,0,118,239,0,255,255,0,104,255,236,
+4,4,7,115,18,38,0,54,0,0,16,7,1,75,255,234,1,82,255,255,0,104,255,236,3,121,
+6,33,18,38,0,86,0,0,16,6,1,75,153,0,255,255,0,104,254,20,4,4,5,203,18,38,
+0,54,0,0,16,7,0,122,1,43,0,0,255,255,0,104,254,20,3,121,4,94,18,38,0,86,0,
+0,16,7,0,122,0,221,0,0,255,255,0,104,255,236,4,4,7,115,18,38,0,54,0,0,16,
+7,1,76,255,230,1,82,255,255,0,104,255,236,3,121,6,33,18,38,0,86,0,0,16,6,
+1,76,165,0,255,255,0,20,254,59,4,92,5,182,18,38,0,55,0,0,16,6,2,57,25,0,255,
+255,0,33,254,59,2,182,5,70,18,38,0,87,0,0,16,6,2,57,179,0,255,255,0,20,0,
+0,4,92,7,115,18,38,0,55,0,0,16,7,1,76,255,222,1,82,255,255,0,33,255,236,2,
+238,6,20,18,38,0,87,0,0,16,6,2,56,115,0,0,1,0,20,0,0,4,92,5,182,0,15,0,0,
+1,17,33,53,33,21,33,17,33,21,33,17,35,17,33,53,1,219,254,57,4,72,254,55,1,
+48,254,208,184,254,207,3,49,1,225,164,164,254,31,151,253,102,2,154,151,0,
+1,0,33,255,236,2,182,5,70,0,29,0,0,37,50,55,21,6,6,35,32,17,53,35,53,51,53,
+35,53,55,55,51,21,33,21,33,21,33,21,33,21,20,22,2,33,85,64,26,107,57,254,
+196,139,139,155,157,72,107,1,61,254,195,1,43,254,213,85,127,23,138,12,20,
+1,94,243,136,249,86,72,234,252,140,249,136,233,106,107,255,255,0,184,255,
+236,5,31,7,51,18,38,0,56,0,0,16,7,1,82,0,115,1,82,255,255,0,162,255,236,4,
+68,5,225,18,38,0,88,0,0,16,6,1,82,253,0,255,255,0,184,255,236,5,31,6,188,
+18,38,0,56,0,0,16,7,1,77,0,145,1,82,255,255,0,162,255,236,4,68,5,106,18,38,
+0,88,0,0,16,6,1,77,27,0,255,255,0,184,255,236,5,31,7,62,18,38,0,56,0,0,16,
+7,1,78,0,139,1,82,255,255,0,162,255,236,4,68,5,236,18,38,0,88,0,0,16,6,1,
+78,20,0,255,255,0,184,255,236,5,31,7,219,18,38,0,56,0,0,16,7,1,80,0,158,1,
+82,255,255,0,162,255,236,4,68,6,137,18,38,0,88,0,0,16,6,1,80,39,0,255,255,
+0,184,255,236,5,31,7,115,18,38,0,56,0,0,16,7,1,83,0,229,1,82,255,255,0,162,
+255,236,4,68,6,33,18,38,0,88,0,0,16,6,1,83,113,0,255,255,0,184,254,61,5,31,
+5,182,18,38,0,56,0,0,16,7,1,81,2,35,0,0,255,255,0,162,254,61,4,105,4,74,18,
+38,0,88,0,0,16,7,1,81,2,244,0,0,255,255,0,25,0,0,7,86,7,115,18,38,0,58,0,
+0,16,7,1,75,1,86,1,82,255,255,0,23,0,0,6,51,6,33,18,38,0,90,0,0,16,7,1,75,
+0,199,0,0,255,255,0,0,0,0,4,135,7,115,18,38,0,60,0,0,16,7,1,75,255,230,1,
+82,255,255,0,2,254,20,4,20,6,33,18,38,0,92,0,0,16,6,1,75,179,0,255,255,0,
+0,0,0,4,135,7,41,18,38,0,60,0,0,16,7,0,106,255,245,1,82,255,255,0,78,0,0,
+4,68,7,115,18,38,0,61,0,0,16,7,0,118,0,66,1,82,255,255,0,80,0,0,3,115,6,33,
+18,38,0,93,0,0,16,6,0,118,239,0,255,255,0,78,0,0,4,68,7,55,18,38,0,61,0,0,
+16,7,1,79,1,61,1,82,255,255,0,80,0,0,3,115,5,229,18,38,0,93,0,0,16,7,1,79,
+0,219,0,0,255,255,0,78,0,0,4,68,7,115,18,38,0,61,0,0,16,7,1,76,255,239,1,
+82,255,255,0,80,0,0,3,115,6,33,18,38,0,93,0,0,16,6,1,76,136,0,0,1,0,174,0,
+0,2,229,6,31,0,12,0,0,1,34,6,21,17,35,17,16,33,50,23,7,38,2,23,94,87,180,
+1,107,100,104,47,90,5,137,117,118,251,98,4,158,1,129,39,142,31,0,1,0,190,
+254,20,4,20,5,203,0,31,0,0,1,34,39,53,22,51,50,54,53,17,35,53,55,53,52,54,
+51,50,23,7,38,35,34,6,21,21,33,21,33,17,20,6,1,74,73,67,70,59,92,76,215,215,
+162,185,93,117,45,102,57,94,78,1,20,254,240,164,254,20,19,149,18,96,115,3,
+194,84,62,133,193,180,43,140,33,100,121,141,140,252,62,187,174,0,4,0,0,0,
+0,5,31,7,170,0,17,0,24,0,34,0,46,0,0,1,20,6,7,1,35,3,33,3,35,1,38,53,52,54,
+51,50,22,19,3,38,39,6,7,3,19,54,54,55,51,21,6,6,7,35,19,52,38,35,34,6,21,
+20,22,51,50,54,3,113,54,45,2,17,191,168,253,164,160,188,2,16,100,120,103,
+103,127,18,172,27,47,31,40,170,143,57,95,22,217,30,177,63,121,211,64,51,49,
+65,59,55,51,64,5,152,65,94,26,251,33,1,137,254,119,4,221,54,131,98,119,120,
+252,54,1,168,61,146,107,104,254,92,4,135,67,140,39,16,42,164,42,254,244,55,
+59,59,55,54,61,59,0,5,0,94,255,236,3,215,7,170,0,26,0,37,0,49,0,61,0,71,0,
+0,33,39,35,6,6,35,34,38,53,16,37,55,53,52,38,35,34,6,7,39,54,54,51,50,22,
+21,17,37,50,54,53,53,7,6,6,21,20,22,1,20,6,35,34,38,53,52,54,51,50,22,7,52,
+38,35,34,6,21,20,22,51,50,54,3,53,54,54,55,33,21,6,6,7,3,84,35,8,82,163,124,
+162,184,2,15,186,108,119,87,155,68,55,83,196,96,199,194,254,10,151,173,162,
+189,173,105,1,169,125,102,103,121,120,104,101,126,113,65,49,50,65,59,56,51,
+63,227,46,106,22,1,12,21,164,128,156,103,73,170,155,1,78,16,7,65,125,119,
+52,32,135,44,50,176,192,253,20,125,163,150,99,7,7,106,114,86,92,5,55,101,
+118,118,99,97,118,118,97,54,61,61,54,54,61,61,1,93,16,42,120,31,12,24,105,
+68,255,255,255,254,0,0,6,145,7,115,18,38,0,136,0,0,16,7,0,118,2,84,1,82,255,
+255,0,94,255,236,6,129,6,33,18,38,0,168,0,0,16,7,0,118,1,139,0,0,255,255,
+0,125,255,193,5,195,7,115,18,38,0,154,0,0,16,7,0,118,1,27,1,82,255,255,0,
+113,255,188,4,104,6,33,18,38,0,186,0,0,16,6,0,118,88,0,255,255,0,104,254,
+59,4,4,5,203,18,38,0,54,0,0,16,6,2,57,23,0,255,255,0,104,254,59,3,121,4,94,
+18,38,0,86,0,0,16,6,2,57,220,0,0,1,1,4,4,217,3,184,6,33,0,13,0,0,1,54,54,
+55,51,22,23,21,35,38,39,6,7,35,1,4,125,103,24,184,52,204,127,90,133,131,88,
+123,4,240,134,128,43,101,204,23,53,131,128,56,0,1,1,4,4,217,3,184,6,33,0,
+12,0,0,1,51,22,23,54,55,51,21,6,7,35,38,39,1,4,123,114,105,126,97,127,205,
+51,184,60,192,6,33,74,115,126,63,27,205,96,102,199,0,1,1,43,4,217,3,139,5,
+106,0,3,0,0,1,33,21,33,1,43,2,96,253,160,5,106,145,0,1,1,31,4,217,3,156,5,
+236,0,13,0,0,1,34,38,39,51,22,22,51,50,54,55,51,6,6,2,88,141,163,9,110,8,
+84,115,101,98,8,113,13,172,4,217,138,137,71,59,63,67,131,144,0,1,0,160,5,
+0,1,115,5,229,0,11,0,0,19,52,54,51,50,22,21,20,6,35,34,38,160,61,45,42,63,
+63,42,45,61,5,115,60,54,54,60,59,56,56,0,2,1,109,4,217,3,47,6,137,0,11,0,
+23,0,0,1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,
+3,47,125,102,103,120,120,103,101,126,113,65,49,50,65,59,56,51,63,5,180,101,
+118,117,100,98,117,118,97,54,61,61,54,54,61,61,0,1,0,35,254,61,1,117,0,0,
+0,15,0,0,23,20,22,51,50,55,21,6,35,34,53,52,55,51,6,6,182,49,43,44,55,69,
+58,211,160,127,70,70,238,46,46,13,115,19,193,139,119,66,109,0,1,1,2,4,217,
+3,242,5,225,0,23,0,0,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,
+51,6,6,3,18,43,82,79,73,34,49,50,14,104,12,116,97,45,85,78,72,32,48,49,15,
+103,12,116,4,219,37,43,37,59,60,122,140,37,43,37,59,60,119,143,0,2,0,223,
+4,217,3,190,6,33,0,9,0,19,0,0,19,54,54,55,51,21,6,6,7,35,37,54,54,55,51,21,
+6,6,7,35,223,35,104,39,197,33,173,66,103,1,105,47,106,25,196,33,173,66,102,
+4,242,46,177,80,21,56,196,55,25,65,182,56,21,56,196,55,0,1,1,248,4,217,3,
+20,6,113,0,9,0,0,1,54,54,55,51,21,6,6,7,35,1,248,29,53,10,192,15,105,56,108,
+4,246,75,231,73,23,63,234,88,0,3,1,16,5,12,3,141,6,180,0,8,0,19,0,30,0,0,
+1,54,55,51,21,6,6,7,35,39,52,51,50,22,21,20,6,35,34,38,37,52,51,50,22,21,
+20,6,35,34,38,1,254,56,36,197,29,113,61,86,238,95,38,56,56,38,41,54,1,193,
+94,37,57,50,44,42,52,5,133,143,160,20,59,173,75,6,100,47,53,53,50,50,53,100,
+47,53,45,58,50,255,255,0,0,0,0,5,27,6,8,18,38,0,36,0,0,16,7,1,84,254,28,255,
+151,255,255,0,147,2,72,1,145,3,94,18,6,0,121,0,0,255,255,255,208,0,0,4,117,
+6,8,16,38,0,40,125,0,16,7,1,84,253,216,255,151,255,255,255,208,0,0,5,184,
+6,8,16,39,0,43,0,147,0,0,16,7,1,84,253,216,255,151,255,255,255,222,0,0,3,
+80,6,8,16,39,0,44,0,238,0,0,16,7,1,84,253,230,255,151,255,255,255,226,255,
+236,6,7,6,8,16,38,0,50,68,0,16,7,1,84,253,234,255,151,255,255,255,206,0,0,
+5,147,6,8,16,39,0,60,1,12,0,0,16,7,1,84,253,214,255,151,255,255,255,226,0,
+0,6,56,6,8,16,38,1,118,66,0,16,7,1,84,253,234,255,151,255,255,255,230,255,
+236,2,160,6,180,18,38,1,134,0,0,16,7,1,85,254,214,0,0,255,255,0,0,0,0,5,27,
+5,188,18,6,0,36,0,0,255,255,0,199,0,0,4,197,5,182,18,6,0,37,0,0,0,1,0,199,
+0,0,4,0,5,182,0,5,0,0,1,21,33,17,35,17,4,0,253,127,184,5,182,164,250,238,
+5,182,255,255,0,41,0,0,4,125,5,182,18,6,2,40,0,0,255,255,0,199,0,0,3,248,
+5,182,18,6,0,40,0,0,255,255,0,78,0,0,4,68,5,182,18,6,0,61,0,0,255,255,0,199,
+0,0,5,37,5,182,18,6,0,43,0,0,0,3,0,123,255,236,5,195,5,205,0,3,0,15,0,27,
+0,0,1,33,21,33,37,16,0,33,32,0,17,16,0,33,32,0,1,16,18,51,50,18,17,16,2,35,
+34,2,1,233,2,107,253,149,3,218,254,155,254,193,254,187,254,161,1,95,1,71,
+1,61,1,101,251,122,246,236,239,242,244,235,237,247,3,55,159,69,254,161,254,
+110,1,138,1,105,1,101,1,137,254,115,254,157,254,220,254,210,1,45,1,37,1,37,
+1,39,254,216,255,255,0,82,0,0,2,98,5,182,18,6,0,44,0,0,255,255,0,199,0,0,
+4,244,5,182,18,6,0,46,0,0,0,1,0,0,0,0,4,219,5,182,0,10,0,0,1,1,35,1,38,39,
+6,7,1,35,1,2,205,2,14,194,254,188,73,34,20,82,254,191,195,2,12,5,182,250,
+74,3,154,207,133,99,239,252,100,5,182,255,255,0,199,0,0,6,123,5,182,18,6,
+0,48,0,0,255,255,0,199,0,0,5,78,5,182,18,6,0,49,0,0,0,3,0,72,0,0,4,39,5,182,
+0,3,0,7,0,11,0,0,19,33,21,33,3,33,21,33,1,21,33,53,195,2,233,253,23,82,3,
+141,252,115,3,182,252,33,3,76,160,3,10,162,251,142,162,162,255,255,0,125,
+255,236,5,195,5,205,18,6,0,50,0,0,0,1,0,199,0,0,5,16,5,182,0,7,0,0,33,35,
+17,33,17,35,17,33,5,16,182,253,37,184,4,73,5,20,250,236,5,182,255,255,0,199,
+0,0,4,111,5,182,18,6,0,51,0,0,0,1,0,74,0,0,4,94,5,182,0,13,0,0,51,53,1,1,
+53,33,21,33,39,1,1,37,33,21,74,1,223,254,45,3,205,253,102,96,1,205,254,30,
+1,78,1,252,152,2,100,2,33,153,164,2,253,234,253,162,2,162,255,255,0,20,0,
+0,4,92,5,182,18,6,0,55,0,0,255,255,0,0,0,0,4,135,5,182,18,6,0,60,0,0,0,3,
+0,104,255,236,6,4,5,203,0,25,0,34,0,43,0,0,1,51,21,51,50,22,22,21,20,2,4,
+35,35,21,35,53,35,34,36,2,53,52,54,54,51,51,19,51,50,54,53,52,38,43,3,34,
+6,21,20,22,51,51,2,219,182,68,174,253,132,148,254,250,178,39,182,43,178,254,
+252,146,136,254,172,65,182,25,197,219,203,182,56,182,55,181,204,218,200,22,
+5,203,180,139,248,158,165,254,254,130,225,225,133,1,2,162,155,249,141,252,
+77,215,189,180,207,209,178,189,215,255,255,0,8,0,0,4,168,5,182,18,6,0,59,
+0,0,0,1,0,109,0,0,6,2,5,182,0,27,0,0,33,35,17,35,34,36,38,53,17,51,17,16,
+33,51,17,51,17,51,32,17,17,51,17,20,6,4,35,35,3,143,180,45,186,254,255,134,
+184,1,156,26,180,29,1,154,188,142,254,253,179,47,1,188,131,240,164,1,227,
+254,33,254,131,3,92,252,164,1,121,1,227,254,31,166,247,124,0,1,0,78,0,0,5,
+246,5,205,0,31,0,0,1,34,6,21,20,18,23,21,33,53,33,38,2,53,16,0,33,32,0,17,
+20,2,7,33,21,33,53,54,18,53,52,2,3,33,234,241,165,177,253,178,1,108,151,160,
+1,100,1,58,1,62,1,98,161,149,1,107,253,178,177,167,243,5,43,255,247,224,254,
+190,128,147,162,116,1,88,205,1,52,1,94,254,164,254,204,206,254,166,115,162,
+147,127,1,71,220,246,1,0,255,255,0,60,0,0,2,124,7,41,18,38,0,44,0,0,16,7,
+0,106,255,11,1,82,255,255,0,0,0,0,4,135,7,41,18,38,0,60,0,0,16,7,0,106,255,
+243,1,82,255,255,0,113,255,236,4,205,6,113,18,38,1,126,0,0,16,6,1,84,31,0,
+255,255,0,88,255,236,3,152,6,113,18,38,1,130,0,0,16,6,1,84,210,0,255,255,
+0,174,254,20,4,76,6,113,18,38,1,132,0,0,16,6,1,84,63,0,255,255,0,168,255,
+236,2,160,6,113,18,38,1,134,0,0,16,7,1,84,254,204,0,0,255,255,0,162,255,236,
+4,121,6,180,18,38,1,146,0,0,16,6,1,85,59,0,0,2,0,113,255,236,4,205,4,94,0,
+11,0,44,0,0,37,50,54,53,53,52,38,35,32,17,20,22,23,34,2,17,16,18,51,50,22,
+23,51,54,55,51,6,2,21,17,20,22,51,50,55,21,6,6,35,34,38,39,35,6,6,2,82,165,
+146,149,164,254,219,141,123,212,238,244,223,121,160,54,13,24,41,142,24,28,
+49,35,32,30,16,65,34,87,90,17,15,60,165,129,190,216,12,225,195,254,88,206,
+208,149,1,42,1,11,1,18,1,43,84,84,92,56,69,254,253,102,254,86,63,52,10,131,
+9,17,86,81,87,80,0,2,0,174,254,20,4,176,6,31,0,20,0,40,0,0,1,50,22,21,16,
+5,21,22,22,21,20,4,35,34,38,39,17,35,17,52,54,23,32,17,17,22,22,51,32,17,
+52,38,35,35,53,51,50,54,53,52,38,2,152,221,250,254,200,187,190,254,251,239,
+111,161,74,180,254,231,254,207,71,155,104,1,80,184,172,109,88,149,158,152,
+6,31,208,183,254,218,51,8,21,199,187,208,228,33,36,253,227,6,52,224,247,150,
+254,182,252,148,37,47,1,45,152,159,152,142,134,121,129,0,1,0,10,254,20,4,
+27,4,74,0,19,0,0,1,35,52,18,55,1,51,19,22,22,23,51,54,54,55,19,51,1,6,2,2,
+33,195,60,45,254,67,187,231,37,65,9,8,6,65,29,217,187,254,106,45,55,254,20,
+91,1,34,123,4,62,253,192,93,199,48,40,215,77,2,72,251,209,117,254,216,0,2,
+0,111,255,236,4,102,6,20,0,30,0,42,0,0,1,38,38,53,52,54,51,50,22,23,7,38,
+38,35,34,6,21,20,22,23,22,22,21,20,0,35,34,36,53,52,18,1,52,38,39,6,6,21,
+20,22,51,50,54,2,27,139,115,199,169,104,190,128,78,101,164,87,82,96,109,165,
+213,172,254,242,242,229,254,238,224,2,93,119,139,189,194,170,145,158,168,
+3,166,79,159,98,132,154,46,64,141,56,48,76,65,69,107,91,117,244,157,236,254,
+245,248,210,179,1,1,254,119,124,178,73,45,214,161,138,169,181,0,1,0,88,255,
+236,3,152,4,94,0,37,0,0,1,21,35,32,21,20,22,51,50,54,55,21,6,35,34,38,53,
+52,54,55,53,38,38,53,52,54,51,50,22,23,7,38,38,35,34,21,20,33,2,215,149,254,
+202,148,143,85,171,100,139,227,220,241,113,131,99,106,231,191,111,173,87,
+68,99,132,74,248,1,57,2,133,147,189,89,93,39,47,158,75,171,148,99,131,38,
+11,28,128,93,135,156,37,41,143,44,28,156,168,0,1,0,113,254,113,3,168,6,20,
+0,36,0,0,5,20,7,35,54,53,52,38,38,39,38,38,53,52,62,3,55,14,2,7,35,53,33,
+21,6,0,2,21,20,22,22,23,22,22,3,168,129,178,127,49,110,89,202,193,46,84,121,
+157,202,7,57,84,155,246,2,250,215,254,225,135,59,123,166,152,137,82,145,172,
+169,101,40,45,38,16,35,216,198,103,182,166,159,164,182,1,2,3,2,149,135,180,
+254,189,254,228,163,96,118,71,34,31,113,0,1,0,174,254,20,4,76,4,94,0,20,0,
+0,1,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,51,50,22,21,17,3,154,118,
+128,169,153,180,145,27,10,51,184,111,202,196,254,20,4,170,132,133,191,207,
+253,199,4,74,150,81,89,196,207,251,73,0,3,0,113,255,236,4,82,6,31,0,11,0,
+18,0,25,0,0,1,16,2,35,34,2,17,16,18,51,50,18,1,50,18,19,33,18,18,19,34,2,
+3,33,2,2,4,82,249,251,244,249,246,247,247,253,254,12,160,151,7,253,139,4,
+151,156,150,151,10,2,115,13,154,3,4,254,110,254,122,1,147,1,133,1,150,1,133,
+254,108,251,244,1,40,1,40,254,207,254,225,5,12,254,245,254,228,1,32,1,7,0,
+1,0,168,255,236,2,160,4,74,0,15,0,0,1,17,20,22,51,50,54,55,21,6,6,35,34,38,
+53,17,1,90,74,84,44,98,26,27,112,54,164,147,4,74,252,250,99,98,15,8,138,12,
+20,170,172,3,8,255,255,0,174,0,0,4,51,4,74,18,6,0,250,0,0,0,1,255,244,255,
+236,4,86,6,33,0,34,0,0,35,1,39,46,2,35,34,7,53,54,51,50,22,22,23,1,22,22,
+51,50,55,21,6,35,34,38,39,3,38,39,35,6,7,3,12,1,217,55,34,49,67,49,62,53,
+68,67,94,124,91,56,1,98,20,47,36,24,37,50,67,74,90,32,150,85,17,8,33,80,250,
+4,53,154,89,66,33,12,145,17,60,129,155,252,37,57,54,10,133,24,74,91,1,164,
+243,83,126,190,253,193,255,255,0,174,254,20,4,78,4,74,18,6,0,119,0,0,0,1,
+0,0,0,0,4,12,4,74,0,16,0,0,17,51,19,30,3,23,51,54,18,17,51,16,2,7,35,186,
+220,13,35,34,28,8,8,172,154,178,207,225,194,4,74,253,176,37,97,99,91,30,176,
+1,181,1,77,254,148,254,4,226,0,1,0,111,254,113,3,168,6,20,0,48,0,0,19,52,
+54,55,53,38,53,52,54,55,6,35,35,53,33,21,35,34,6,6,21,20,22,51,51,21,35,34,
+6,21,20,30,2,23,22,22,21,20,7,35,54,54,53,52,38,39,38,38,111,155,131,217,
+140,163,144,103,62,2,197,54,130,220,125,162,172,170,176,174,209,50,92,132,
+82,149,132,123,170,55,66,119,131,200,203,1,166,137,208,42,12,62,217,115,157,
+47,12,149,139,78,142,93,112,105,137,170,144,78,97,59,35,17,33,110,89,138,
+179,74,148,50,54,59,24,34,201,255,255,0,113,255,236,4,104,4,94,18,6,0,82,
+0,0,0,1,0,25,255,236,5,4,4,74,0,20,0,0,37,50,55,21,6,35,34,17,17,33,17,35,
+17,35,53,55,33,21,35,17,20,4,139,53,37,49,86,227,254,47,178,223,147,4,88,
+215,127,20,141,26,1,6,2,194,252,76,3,180,78,72,150,253,74,127,0,2,0,162,254,
+20,4,102,4,94,0,16,0,28,0,0,1,16,2,35,34,39,35,22,21,17,35,17,16,18,51,50,
+0,37,34,6,21,17,22,51,50,54,53,52,38,4,102,254,231,176,121,10,10,182,253,
+236,219,1,0,254,29,153,146,116,179,161,142,141,2,37,254,240,254,215,92,68,
+205,254,221,4,31,1,11,1,32,254,208,153,202,204,254,180,100,212,208,210,208,
+0,1,0,113,254,113,3,170,4,94,0,31,0,0,1,20,22,22,23,22,22,21,20,7,35,54,54,
+53,52,38,38,39,38,38,53,16,0,51,50,22,23,7,38,35,34,6,1,43,57,138,159,145,
+138,123,170,52,71,47,113,90,208,195,1,17,255,82,158,57,57,140,108,170,164,
+2,8,128,128,78,34,31,111,92,144,173,69,151,52,38,45,40,16,40,252,214,1,31,
+1,57,34,25,150,52,213,0,2,0,113,255,236,4,190,4,74,0,13,0,25,0,0,1,20,6,6,
+35,34,0,53,16,33,33,21,33,22,1,20,22,51,50,54,53,16,39,35,34,6,4,102,123,
+231,156,237,254,246,2,84,1,249,254,246,178,252,197,165,157,155,166,170,63,
+218,192,1,248,156,239,129,1,33,255,2,62,150,167,254,255,193,202,192,179,1,
+5,187,203,0,1,0,20,255,233,3,158,4,74,0,18,0,0,1,21,33,17,20,51,50,55,21,
+6,6,35,34,38,53,17,33,53,55,3,158,254,84,196,104,70,39,113,48,183,170,254,
+217,150,4,74,152,253,158,213,22,135,15,18,171,169,2,117,80,72,0,1,0,162,255,
+236,4,121,4,74,0,20,0,0,5,34,38,17,17,51,17,16,33,50,54,53,52,38,39,51,22,
+22,21,16,0,2,117,234,233,180,1,45,163,157,27,37,180,39,27,254,251,20,251,
+1,11,2,88,253,174,254,135,234,245,128,209,155,149,227,124,254,194,254,212,
+0,2,0,113,254,20,5,92,4,94,0,24,0,34,0,0,1,17,36,0,17,16,55,23,6,6,21,16,
+5,17,52,54,51,50,18,21,20,2,6,7,17,1,52,38,35,34,6,21,17,54,54,2,131,254,
+251,254,243,209,139,89,79,1,94,170,154,185,220,136,250,167,1,115,120,101,
+71,79,175,196,254,20,1,218,14,1,33,1,14,1,42,255,96,117,223,123,254,127,35,
+2,98,182,197,254,218,249,177,254,252,147,9,254,38,4,41,184,212,114,114,253,
+156,16,232,0,1,255,233,254,20,4,92,4,80,0,32,0,0,19,50,22,22,23,19,1,51,1,
+19,22,22,51,50,55,21,6,35,34,38,39,3,1,35,1,3,38,38,35,34,7,53,54,184,58,
+80,63,45,139,1,58,192,254,82,191,41,81,66,44,48,65,62,115,142,60,146,254,
+156,193,1,211,168,30,69,52,40,28,53,4,80,45,89,116,254,160,2,84,252,254,254,
+28,107,81,8,139,17,118,161,1,125,253,108,3,72,1,180,82,92,12,141,17,0,1,0,
+162,254,20,5,154,6,18,0,25,0,0,1,17,54,54,53,52,38,39,51,18,21,16,0,5,17,
+35,17,36,0,17,17,51,17,16,5,17,3,104,191,194,29,36,178,64,254,226,254,236,
+176,254,246,254,244,178,1,100,6,18,250,115,18,222,200,131,229,165,254,236,
+242,254,235,254,208,17,254,38,1,218,9,1,32,1,18,2,33,253,217,254,121,25,5,
+143,0,1,0,115,255,236,5,207,4,74,0,39,0,0,5,34,2,17,52,18,55,51,6,2,21,20,
+22,51,50,54,53,17,51,17,20,22,51,50,54,53,52,2,39,51,22,18,21,16,2,35,34,
+39,35,6,1,250,183,208,59,62,184,66,59,117,106,95,102,172,101,93,104,122,59,
+66,184,66,55,208,183,222,69,10,65,20,1,40,1,0,161,1,9,140,149,254,252,159,
+189,212,142,124,1,54,254,202,128,138,202,199,157,1,8,147,154,254,254,154,
+254,255,254,217,184,184,255,255,255,234,255,236,2,160,5,215,18,38,1,134,0,
+0,16,7,0,106,254,185,0,0,255,255,0,162,255,236,4,121,5,215,18,38,1,146,0,
+0,16,6,0,106,55,0,255,255,0,113,255,236,4,104,6,113,18,38,0,82,0,0,16,6,1,
+84,35,0,255,255,0,162,255,236,4,121,6,113,18,38,1,146,0,0,16,6,1,84,41,0,
+255,255,0,115,255,236,5,207,6,113,18,38,1,150,0,0,16,7,1,84,0,211,0,0,255,
+255,0,199,0,0,3,248,7,41,18,38,0,40,0,0,16,7,0,106,0,33,1,82,0,1,0,20,255,
+236,5,84,5,182,0,29,0,0,5,34,39,53,22,51,50,54,53,53,52,38,35,33,17,35,17,
+33,53,33,21,33,17,33,50,22,21,21,20,6,3,223,103,52,59,88,99,100,127,135,254,
+135,183,254,172,3,199,254,68,1,135,208,222,197,20,24,160,21,118,110,131,124,
+109,253,33,5,20,162,162,254,109,193,178,143,190,213,255,255,0,199,0,0,4,0,
+7,115,18,38,1,97,0,0,16,7,0,118,0,94,1,82,0,1,0,125,255,236,4,233,5,205,0,
+24,0,0,1,34,4,7,33,21,33,18,0,51,50,55,21,6,35,32,0,17,16,0,33,50,23,7,38,
+3,66,220,254,248,26,2,200,253,51,12,1,5,242,164,202,158,233,254,179,254,161,
+1,120,1,81,235,184,75,175,5,41,245,234,160,254,245,254,238,58,160,59,1,132,
+1,109,1,93,1,147,90,158,84,255,255,0,104,255,236,4,4,5,203,18,6,0,54,0,0,
+255,255,0,82,0,0,2,98,5,182,18,6,0,44,0,0,255,255,0,60,0,0,2,124,7,41,18,
+38,0,44,0,0,16,7,0,106,255,11,1,82,255,255,255,96,254,123,1,117,5,182,18,
+6,0,45,0,0,0,2,0,2,255,233,7,47,5,182,0,26,0,35,0,0,1,20,4,33,33,17,33,2,
+2,6,6,35,34,39,53,22,51,50,54,54,18,19,33,17,51,32,4,1,51,50,54,53,52,38,
+35,35,7,47,254,236,254,249,254,177,254,155,56,85,83,140,109,69,64,52,61,58,
+81,56,71,72,2,184,121,1,24,1,33,253,78,129,190,181,186,216,98,1,172,207,221,
+5,20,254,87,253,240,253,117,25,154,25,108,242,1,197,2,16,253,150,207,254,
+33,133,137,134,122,0,2,0,199,0,0,7,92,5,182,0,18,0,27,0,0,1,20,4,33,33,17,
+33,17,35,17,51,17,33,17,51,17,51,32,4,1,51,50,54,53,52,38,35,35,7,92,254,
+235,254,253,254,174,253,141,184,184,2,115,186,119,1,24,1,33,253,80,129,190,
+179,186,214,98,1,172,209,219,2,170,253,86,5,182,253,150,2,106,253,150,207,
+254,33,133,137,134,122,0,1,0,20,0,0,5,84,5,182,0,19,0,0,1,33,50,22,21,17,
+35,17,52,38,35,33,17,35,17,33,53,33,21,33,2,31,1,141,205,219,184,119,133,
+254,127,185,254,174,4,0,254,11,3,127,188,183,253,244,1,246,123,108,253,35,
+5,18,164,164,255,255,0,199,0,0,4,242,7,115,18,38,1,180,0,0,16,7,0,118,0,170,
+1,82,255,255,0,23,255,236,4,254,7,98,18,38,1,189,0,0,16,7,2,54,0,70,1,82,
+0,1,0,199,254,127,5,16,5,182,0,11,0,0,33,33,17,35,17,33,17,51,17,33,17,51,
+5,16,254,52,189,254,64,184,2,219,182,254,127,1,129,5,182,250,238,5,18,255,
+255,0,0,0,0,5,27,5,188,18,6,0,36,0,0,0,2,0,199,0,0,4,131,5,182,0,12,0,21,
+0,0,1,20,4,33,33,17,33,21,33,17,51,32,4,1,51,50,54,53,52,38,35,35,4,131,254,
+252,254,244,254,84,3,100,253,84,217,1,24,1,19,252,252,225,188,169,176,211,
+195,1,172,216,212,5,182,162,254,56,198,254,24,127,143,140,116,255,255,0,199,
+0,0,4,197,5,182,18,6,0,37,0,0,255,255,0,199,0,0,4,0,5,182,18,6,1,97,0,0,0,
+2,0,12,254,127,5,90,5,182,0,13,0,19,0,0,1,35,17,33,17,35,17,51,54,18,19,33,
+17,51,33,17,33,6,2,7,5,90,176,252,18,176,113,148,216,19,2,164,186,254,143,
+254,181,19,205,127,254,127,1,129,254,127,2,37,252,2,206,1,72,250,238,4,108,
+249,253,104,219,255,255,0,199,0,0,3,248,5,182,18,6,0,40,0,0,0,1,0,2,0,0,6,
+209,5,182,0,17,0,0,1,1,51,1,17,51,17,1,51,1,1,35,1,17,35,17,1,35,2,78,253,
+201,204,2,47,177,2,47,204,253,201,2,74,211,253,197,177,253,195,211,2,240,
+2,198,253,60,2,196,253,60,2,196,253,60,253,14,2,229,253,27,2,229,253,27,0,
+1,0,78,255,236,4,70,5,203,0,39,0,0,1,20,6,7,21,22,22,21,20,4,33,32,39,53,
+22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,33,50,
+4,4,39,182,164,186,191,254,202,254,232,254,249,163,99,227,98,198,201,226,
+224,209,198,217,215,159,135,114,183,109,88,211,1,29,225,1,2,4,96,142,181,
+25,8,25,180,145,205,229,79,168,47,49,146,137,131,135,154,145,123,106,123,
+54,71,125,152,196,0,1,0,201,0,0,5,96,5,182,0,17,0,0,19,51,17,20,2,7,51,1,
+51,17,35,17,52,18,55,35,1,35,201,172,10,5,9,3,36,205,172,14,3,9,252,218,205,
+5,182,252,221,85,254,232,42,4,186,250,74,3,27,104,1,21,41,251,63,255,255,
+0,201,0,0,5,96,7,98,18,38,1,178,0,0,16,7,2,54,0,227,1,82,0,1,0,199,0,0,4,
+242,5,182,0,10,0,0,33,35,1,17,35,17,51,17,1,51,1,4,242,222,253,107,184,184,
+2,133,209,253,133,2,229,253,27,5,182,253,60,2,196,253,58,0,1,0,2,255,233,
+4,227,5,182,0,18,0,0,33,35,17,33,7,2,2,6,35,34,39,53,22,51,50,54,18,19,33,
+4,227,184,254,49,31,63,94,151,130,74,59,52,61,79,93,109,55,3,32,5,20,238,
+254,20,254,86,167,25,154,25,199,2,190,1,174,255,255,0,199,0,0,6,123,5,182,
+18,6,0,48,0,0,255,255,0,199,0,0,5,37,5,182,18,6,0,43,0,0,255,255,0,125,255,
+236,5,195,5,205,18,6,0,50,0,0,255,255,0,199,0,0,5,16,5,182,18,6,1,110,0,0,
+255,255,0,199,0,0,4,111,5,182,18,6,0,51,0,0,255,255,0,125,255,236,4,207,5,
+203,18,6,0,38,0,0,255,255,0,20,0,0,4,92,5,182,18,6,0,55,0,0,0,1,0,23,255,
+236,4,254,5,182,0,22,0,0,5,34,39,53,22,51,50,54,55,1,51,1,22,23,51,55,55,
+1,51,1,14,2,1,37,113,86,91,102,107,131,61,253,205,202,1,162,25,18,8,8,31,
+1,94,195,254,45,83,136,175,20,30,174,41,100,132,4,63,252,211,47,57,24,82,
+3,43,251,234,186,170,80,255,255,0,104,255,236,6,4,5,203,18,6,1,115,0,0,255,
+255,0,8,0,0,4,168,5,182,18,6,0,59,0,0,0,1,0,199,254,127,5,195,5,182,0,11,
+0,0,37,51,17,35,17,33,17,51,17,33,17,51,5,16,179,177,251,181,184,2,219,182,
+162,253,221,1,129,5,182,250,238,5,18,0,1,0,164,0,0,4,207,5,182,0,19,0,0,33,
+35,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,51,4,207,184,149,200,
+104,208,222,184,124,140,95,177,163,184,2,88,53,39,193,178,2,71,253,211,118,
+117,30,54,2,196,0,1,0,199,0,0,7,131,5,182,0,11,0,0,33,33,17,51,17,33,17,51,
+17,33,17,51,7,131,249,68,184,2,72,184,2,74,186,5,182,250,238,5,18,250,238,
+5,18,0,1,0,199,254,127,8,23,5,182,0,15,0,0,51,17,51,17,33,17,51,17,33,17,
+51,17,51,17,35,17,199,184,2,57,187,2,59,184,177,177,5,182,250,238,5,18,250,
+238,5,18,250,236,253,221,1,129,0,2,0,16,0,0,5,33,5,182,0,12,0,21,0,0,1,20,
+4,35,33,17,33,53,33,17,51,32,4,1,51,50,54,53,52,38,35,35,5,33,254,247,253,
+254,73,254,172,2,11,231,1,10,1,21,252,250,237,178,168,175,199,209,1,172,208,
+220,5,20,162,253,150,209,254,35,133,137,134,122,0,3,0,199,0,0,6,23,5,182,
+0,10,0,19,0,23,0,0,1,20,4,35,33,17,51,17,51,32,4,1,51,50,54,53,52,38,35,35,
+1,35,17,51,4,125,254,249,255,254,80,184,225,1,9,1,20,253,2,231,178,166,172,
+198,205,4,152,185,185,1,172,207,221,5,182,253,150,210,254,34,135,137,134,
+120,253,86,5,182,0,2,0,199,0,0,4,186,5,182,0,10,0,18,0,0,1,20,4,35,33,17,
+51,17,33,32,4,1,33,32,17,52,38,35,35,4,186,254,236,254,254,31,184,1,18,1,
+13,1,28,252,197,1,23,1,102,183,202,252,1,172,206,222,5,182,253,150,213,254,
+39,1,14,133,123,0,1,0,61,255,236,4,145,5,203,0,27,0,0,1,34,7,39,54,51,50,
+4,18,21,16,0,33,34,38,39,53,22,22,51,32,0,19,33,53,33,38,36,1,219,167,171,
+76,174,242,217,1,57,162,254,147,254,171,113,175,101,86,175,99,1,8,1,13,8,
+253,57,2,197,20,254,249,5,41,78,154,86,176,254,186,225,254,138,254,110,24,
+35,160,23,35,1,24,1,7,162,222,253,0,2,0,199,255,236,7,236,5,205,0,18,0,30,
+0,0,1,16,0,33,32,0,3,33,17,35,17,51,17,33,18,0,33,32,0,1,16,18,51,50,18,17,
+16,2,35,34,2,7,236,254,172,254,206,254,212,254,171,12,254,166,184,184,1,94,
+23,1,80,1,30,1,50,1,88,251,174,229,225,226,233,229,226,227,231,2,221,254,
+158,254,113,1,110,1,80,253,86,5,182,253,150,1,53,1,76,254,114,254,158,254,
+222,254,208,1,44,1,38,1,37,1,41,254,211,0,2,0,45,0,0,4,86,5,182,0,13,0,21,
+0,0,1,1,35,1,38,38,53,52,36,33,33,17,35,17,17,35,34,6,21,16,33,51,2,127,254,
+133,215,1,154,155,146,1,17,1,17,1,154,184,221,183,178,1,113,213,2,94,253,
+162,2,127,50,206,158,198,211,250,74,2,94,2,187,128,133,254,230,255,255,0,
+94,255,236,3,215,4,92,18,6,0,68,0,0,0,2,0,117,255,236,4,92,6,31,0,24,0,34,
+0,0,19,16,18,55,54,37,23,7,6,7,6,6,7,51,54,54,51,50,18,21,16,0,35,34,0,5,
+32,17,16,33,34,6,6,7,16,117,221,237,223,1,19,31,119,232,141,144,145,10,13,
+58,193,109,202,228,254,246,236,234,254,249,2,0,1,41,254,243,73,137,111,35,
+2,147,1,111,1,141,52,45,47,158,19,38,29,32,229,218,81,97,254,252,234,254,
+251,254,225,1,102,209,1,125,1,106,60,98,59,253,242,0,3,0,174,0,0,4,88,4,74,
+0,14,0,22,0,31,0,0,1,20,6,7,21,22,22,21,20,6,35,33,17,33,32,3,52,38,35,33,
+17,33,32,3,52,38,35,33,17,33,50,54,4,53,120,111,139,127,229,215,254,18,1,
+236,1,155,145,144,139,254,217,1,43,1,23,31,119,120,254,204,1,19,147,125,3,
+53,106,111,20,9,19,127,107,156,166,4,74,253,2,92,74,254,159,2,148,77,66,254,
+211,73,0,1,0,174,0,0,3,76,4,74,0,5,0,0,1,33,17,35,17,33,3,76,254,22,180,2,
+158,3,178,252,78,4,74,0,2,0,39,254,131,4,125,4,74,0,13,0,19,0,0,1,35,17,33,
+17,35,17,51,54,18,19,33,17,51,33,17,35,6,2,7,4,125,174,253,4,172,88,133,148,
+4,2,65,160,254,178,244,15,141,102,254,131,1,125,254,131,2,21,185,1,231,1,
+18,252,78,3,36,221,254,67,138,255,255,0,113,255,236,4,27,4,94,18,6,0,72,0,
+0,0,1,0,2,0,0,5,250,4,74,0,18,0,0,1,51,17,1,51,1,1,35,1,17,35,17,1,35,1,0,
+39,51,1,2,170,168,1,190,195,254,59,1,236,205,254,37,168,254,37,205,1,236,
+254,202,143,197,1,188,4,74,253,235,2,21,253,235,253,203,2,45,253,211,2,45,
+253,211,2,53,1,112,165,253,235,0,1,0,68,255,236,3,143,4,94,0,35,0,0,1,32,
+53,52,35,34,6,7,39,54,51,50,22,21,20,7,21,22,22,21,20,6,35,34,39,53,22,51,
+50,54,53,52,38,35,35,53,1,135,1,55,249,79,136,95,63,171,212,193,218,206,125,
+118,250,219,242,132,183,189,141,152,154,159,148,2,133,168,156,30,40,143,76,
+154,135,187,56,8,36,136,103,151,172,71,162,86,94,92,94,91,147,0,1,0,174,0,
+0,4,117,4,74,0,13,0,0,1,17,7,7,1,51,17,35,17,55,55,1,35,17,1,88,8,4,2,76,
+221,168,3,5,253,184,223,4,74,253,98,194,56,3,152,251,182,2,135,139,132,252,
+106,4,74,255,255,0,174,0,0,4,117,6,16,18,38,1,210,0,0,16,6,2,54,70,0,0,1,
+0,174,0,0,4,35,4,74,0,10,0,0,1,51,1,1,35,1,17,35,17,51,17,3,55,197,254,43,
+1,252,209,254,16,180,180,4,74,253,239,253,199,2,45,253,211,4,74,253,235,0,
+1,0,14,255,242,3,242,4,74,0,16,0,0,33,35,17,33,2,2,6,35,34,39,53,22,51,50,
+18,19,33,3,242,183,254,189,28,95,153,119,65,30,21,35,110,131,37,2,150,3,180,
+254,152,254,101,191,14,135,8,1,208,1,251,0,1,0,174,0,0,5,72,4,74,0,21,0,0,
+37,54,55,1,51,17,35,17,6,7,1,35,1,38,38,39,17,35,17,51,1,22,2,246,30,46,1,
+30,232,162,35,47,254,238,146,254,238,20,39,19,162,225,1,21,37,172,109,116,
+2,189,251,182,3,137,109,120,253,92,2,168,48,114,63,252,119,4,74,253,94,94,
+0,1,0,174,0,0,4,106,4,74,0,11,0,0,1,17,33,17,51,17,35,17,33,17,35,17,1,98,
+2,84,180,180,253,172,180,4,74,254,55,1,201,251,182,1,233,254,23,4,74,255,
+255,0,113,255,236,4,104,4,94,18,6,0,82,0,0,0,1,0,174,0,0,4,78,4,74,0,7,0,
+0,33,35,17,33,17,35,17,33,1,98,180,3,160,180,253,200,4,74,251,182,3,176,255,
+255,0,174,254,20,4,123,4,94,18,6,0,83,0,0,255,255,0,113,255,236,3,147,4,94,
+18,6,0,70,0,0,0,1,0,41,0,0,3,164,4,74,0,7,0,0,1,33,17,35,17,33,53,33,3,164,
+254,153,178,254,158,3,123,3,178,252,78,3,178,152,255,255,0,2,254,20,4,20,
+4,74,18,6,0,92,0,0,0,3,0,111,254,20,5,92,6,20,0,17,0,23,0,28,0,0,1,20,0,5,
+17,35,17,38,0,53,52,0,37,17,51,17,22,0,5,16,5,17,6,6,5,16,37,17,36,5,92,254,
+225,255,0,176,252,254,222,1,32,1,4,170,253,1,34,251,207,1,104,188,172,3,119,
+254,155,1,101,2,37,245,254,212,20,254,36,1,220,21,1,44,244,250,1,39,20,1,
+186,254,70,25,254,212,240,254,131,37,3,66,19,211,186,1,119,39,252,192,39,
+255,255,0,37,0,0,4,23,4,74,18,6,0,91,0,0,0,1,0,174,254,131,4,233,4,74,0,11,
+0,0,1,35,17,33,17,51,17,33,17,51,17,51,4,233,176,252,117,180,2,56,180,155,
+254,131,1,125,4,74,252,78,3,178,252,76,0,1,0,152,0,0,4,57,4,74,0,18,0,0,1,
+17,20,51,50,54,55,17,51,17,35,17,6,6,35,34,38,53,17,1,76,211,92,165,101,180,
+180,110,177,108,164,190,4,74,254,112,188,55,62,1,215,251,182,1,233,71,56,
+172,152,1,156,0,1,0,174,0,0,6,127,4,74,0,11,0,0,37,33,17,51,17,33,17,51,17,
+33,17,51,3,240,1,219,180,250,47,180,1,217,181,152,3,178,251,182,4,74,252,
+78,3,178,0,1,0,174,254,133,7,29,4,74,0,15,0,0,37,33,17,51,17,51,17,35,17,
+33,17,51,17,33,17,51,3,240,1,219,178,160,181,250,70,180,1,217,181,152,3,178,
+252,76,253,239,1,123,4,74,252,78,3,178,0,2,0,37,0,0,5,35,4,74,0,10,0,18,0,
+0,1,33,32,17,16,33,33,17,33,53,33,1,52,38,35,33,17,33,32,2,55,1,47,1,189,
+254,65,254,31,254,162,2,18,2,58,121,152,254,215,1,47,1,11,2,135,254,201,254,
+176,3,178,152,252,252,90,80,254,161,0,3,0,174,0,0,5,139,4,74,0,10,0,18,0,
+22,0,0,1,33,50,22,21,20,6,35,33,17,51,1,52,38,35,33,17,33,32,5,35,17,51,1,
+98,1,29,214,204,216,210,254,55,180,2,13,119,144,254,250,1,4,1,9,2,28,180,
+180,2,135,156,155,167,169,4,74,252,252,89,83,254,159,145,4,74,0,2,0,174,0,
+0,4,84,4,74,0,9,0,18,0,0,1,33,32,17,20,6,35,33,17,51,1,52,38,35,33,17,33,
+50,54,1,98,1,70,1,172,222,214,254,14,180,2,62,124,145,254,207,1,54,127,137,
+2,135,254,201,164,172,4,74,252,252,88,84,254,159,92,0,1,0,59,255,236,3,131,
+4,94,0,24,0,0,5,34,39,53,22,51,32,19,33,53,33,38,38,35,34,7,39,54,54,51,32,
+0,17,16,0,1,94,169,122,154,141,1,80,23,253,227,2,27,14,162,156,105,151,51,
+64,165,76,1,1,1,9,254,225,20,59,156,62,1,103,147,168,156,54,146,29,34,254,
+221,254,234,254,241,254,214,0,2,0,174,255,236,6,63,4,94,0,18,0,30,0,0,1,16,
+0,35,34,2,39,33,17,35,17,51,17,33,54,54,51,50,0,1,20,22,51,50,54,53,52,38,
+35,34,6,6,63,254,253,226,214,253,14,254,233,180,180,1,25,22,252,209,222,1,
+3,252,242,142,157,157,140,142,155,157,142,2,39,254,242,254,211,1,11,242,254,
+23,4,74,254,55,229,248,254,206,254,251,208,214,214,208,205,211,211,0,2,0,
+33,0,0,3,203,4,74,0,13,0,21,0,0,51,35,1,38,38,53,52,54,51,33,17,35,17,33,
+1,20,33,33,17,33,34,6,242,209,1,57,126,130,206,183,1,236,180,254,245,254,
+252,1,12,1,3,254,219,115,119,1,205,32,162,119,152,172,251,182,1,180,1,80,
+186,1,106,90,255,255,0,113,255,236,4,27,5,215,18,38,0,72,0,0,16,6,0,106,6,
+0,0,1,0,18,254,20,4,78,6,20,0,39,0,0,1,34,39,53,22,51,50,53,17,52,38,35,34,
+6,21,17,35,17,35,53,51,53,51,21,33,21,33,21,20,7,51,54,54,51,50,22,21,17,
+20,6,3,49,80,57,55,58,129,119,125,169,153,182,156,156,180,1,138,254,118,8,
+10,49,180,115,200,202,144,254,20,25,148,21,170,3,66,133,129,187,211,253,240,
+4,215,133,184,184,133,180,61,91,78,92,191,210,252,186,160,170,255,255,0,174,
+0,0,3,76,6,33,18,38,1,205,0,0,16,6,0,118,247,0,0,1,0,113,255,236,3,176,4,
+94,0,26,0,0,5,34,0,17,16,0,51,50,22,23,7,38,35,34,6,7,33,21,33,22,22,51,50,
+54,55,21,6,2,123,250,254,240,1,19,253,84,160,59,53,137,117,158,163,17,2,27,
+253,227,9,164,161,93,142,62,120,20,1,33,1,18,1,23,1,40,33,26,148,52,160,164,
+147,184,175,37,25,156,59,255,255,0,104,255,236,3,121,4,94,18,6,0,86,0,0,255,
+255,0,160,0,0,1,115,5,229,18,6,0,76,0,0,255,255,255,236,0,0,2,44,5,215,18,
+38,0,243,0,0,16,7,0,106,254,187,0,0,255,255,255,143,254,20,1,115,5,229,18,
+6,0,77,0,0,0,2,0,14,255,242,6,80,4,74,0,21,0,30,0,0,1,51,32,17,16,33,33,17,
+33,2,2,6,35,34,39,53,22,51,50,18,19,33,1,52,38,35,35,17,51,50,54,3,172,254,
+1,166,254,70,254,96,255,0,27,96,150,118,67,30,29,25,107,136,37,2,80,1,240,
+125,150,221,227,132,137,2,135,254,201,254,176,3,178,254,155,254,99,190,14,
+133,8,1,201,2,4,252,252,89,81,254,161,92,0,2,0,174,0,0,6,168,4,74,0,17,0,
+25,0,0,1,17,51,50,22,21,16,33,33,17,33,17,35,17,51,17,33,17,19,17,51,32,53,
+52,38,35,4,8,246,220,206,254,74,254,92,254,24,184,184,1,236,178,229,1,13,
+125,148,4,74,254,59,155,154,254,176,1,233,254,23,4,74,254,55,1,201,253,166,
+254,161,181,90,80,0,1,0,18,0,0,4,76,6,20,0,30,0,0,33,17,52,38,35,34,6,21,
+17,35,17,35,53,51,53,51,21,33,21,33,21,20,7,51,54,54,51,50,22,21,17,3,154,
+119,127,169,153,180,156,156,180,1,178,254,78,10,12,53,183,108,199,201,2,150,
+133,131,185,213,253,240,4,213,135,184,184,135,178,88,64,85,85,193,210,253,
+94,255,255,0,174,0,0,4,35,6,33,18,38,1,212,0,0,16,6,0,118,63,0,255,255,0,
+2,254,20,4,20,6,16,18,38,0,92,0,0,16,6,2,54,191,0,0,1,0,174,254,133,4,82,
+4,74,0,11,0,0,33,33,17,51,17,33,17,51,17,33,17,35,2,45,254,129,180,2,60,180,
+254,139,176,4,74,252,78,3,178,251,182,254,133,0,1,0,199,0,0,4,18,6,227,0,
+7,0,0,1,17,51,17,33,17,35,17,3,102,172,253,109,184,5,182,1,45,254,47,250,
+238,5,182,0,1,0,174,0,0,3,80,5,137,0,7,0,0,1,33,17,35,17,33,17,51,3,80,254,
+18,180,1,242,176,3,190,252,66,4,74,1,63,255,255,0,25,0,0,7,86,7,115,18,38,
+0,58,0,0,16,7,0,67,1,18,1,82,255,255,0,23,0,0,6,51,6,33,18,38,0,90,0,0,16,
+6,0,67,117,0,255,255,0,25,0,0,7,86,7,115,18,38,0,58,0,0,16,7,0,118,1,176,
+1,82,255,255,0,23,0,0,6,51,6,33,18,38,0,90,0,0,16,7,0,118,1,33,0,0,255,255,
+0,25,0,0,7,86,7,41,18,38,0,58,0,0,16,7,0,106,1,100,1,82,255,255,0,23,0,0,
+6,51,5,215,18,38,0,90,0,0,16,7,0,106,0,211,0,0,255,255,0,0,0,0,4,135,7,115,
+18,38,0,60,0,0,16,7,0,67,255,146,1,82,255,255,0,2,254,20,4,20,6,33,18,38,
+0,92,0,0,16,7,0,67,255,97,0,0,0,1,0,82,1,213,3,174,2,117,0,3,0,0,19,53,33,
+21,82,3,92,1,213,160,160,0,1,0,82,1,213,7,174,2,117,0,3,0,0,19,53,33,21,82,
+7,92,1,213,160,160,0,1,0,82,1,213,7,174,2,117,0,3,0,0,19,53,33,21,82,7,92,
+1,213,160,160,0,2,255,252,254,57,3,78,255,203,0,3,0,7,0,0,1,33,53,33,53,33,
+53,33,3,78,252,174,3,82,252,174,3,82,254,57,131,140,131,0,1,0,25,3,193,1,
+78,5,182,0,7,0,0,19,39,54,18,55,51,6,7,37,12,22,98,56,133,66,37,3,193,22,
+90,1,12,121,254,247,0,1,0,25,3,193,1,78,5,182,0,6,0,0,1,23,6,3,35,18,55,1,
+63,15,52,124,133,70,32,5,182,22,199,254,232,1,29,216,0,1,0,63,254,248,1,117,
+0,238,0,6,0,0,37,23,6,3,35,18,55,1,102,15,48,128,134,67,36,238,23,186,254,
+219,1,3,243,0,1,0,25,3,193,1,80,5,182,0,7,0,0,19,22,23,35,38,2,39,55,233,
+37,66,133,45,109,24,14,5,182,251,250,94,1,28,101,22,0,2,0,25,3,193,2,199,
+5,182,0,7,0,15,0,0,1,39,54,18,55,51,2,7,33,39,54,18,55,51,2,7,1,158,15,27,
+106,46,133,67,36,253,197,12,20,102,54,131,67,36,3,193,22,106,1,21,96,254,
+247,236,22,83,1,26,114,254,247,236,0,2,0,25,3,193,2,199,5,182,0,6,0,14,0,
+0,1,23,6,3,35,18,55,33,23,6,3,35,54,18,55,1,61,15,49,127,131,65,35,2,59,15,
+49,127,136,26,66,13,5,182,22,194,254,227,1,8,237,22,194,254,227,100,1,52,
+93,0,2,0,27,254,248,2,203,0,238,0,6,0,14,0,0,37,23,6,3,35,54,55,33,23,6,3,
+35,54,18,55,1,66,14,48,128,133,65,37,2,59,15,48,128,136,27,62,16,238,23,186,
+254,219,250,252,23,186,254,219,104,1,38,104,0,1,0,133,0,0,3,150,6,20,0,11,
+0,0,1,37,19,35,19,5,53,5,3,51,3,37,3,150,254,161,51,204,49,254,182,1,74,49,
+204,51,1,95,3,223,31,252,2,3,254,31,178,30,1,161,254,95,30,0,1,0,123,0,0,
+3,158,6,20,0,21,0,0,1,37,21,37,19,35,19,5,53,5,3,19,5,53,5,3,51,3,37,21,37,
+19,2,63,1,95,254,161,50,207,49,254,168,1,88,43,43,254,168,1,88,49,207,50,
+1,95,254,161,43,1,238,30,174,29,254,133,1,123,29,174,30,1,36,1,21,31,174,
+30,1,124,254,132,30,174,31,254,235,0,1,0,158,1,238,2,100,3,233,0,11,0,0,19,
+52,54,51,50,22,21,20,6,35,34,38,158,116,111,110,117,119,108,110,117,2,236,
+122,131,131,122,122,132,133,0,3,0,147,255,227,5,193,0,248,0,11,0,22,0,34,
+0,0,55,52,54,51,50,22,21,20,6,35,34,38,37,52,51,50,22,21,20,6,35,34,38,37,
+52,54,51,50,22,21,20,6,35,34,38,147,65,60,61,68,68,61,59,66,2,25,125,60,67,
+68,59,54,71,2,23,66,58,61,69,70,60,52,72,111,66,71,71,66,65,75,74,66,137,
+69,68,67,73,66,74,69,68,69,68,68,72,66,0,7,0,100,255,236,9,6,5,203,0,9,0,
+21,0,32,0,44,0,48,0,58,0,70,0,0,19,20,22,51,50,17,16,35,34,6,5,20,6,35,34,
+38,53,52,54,51,50,22,1,20,22,51,50,54,53,16,35,34,6,5,20,6,35,34,38,53,52,
+54,51,50,22,1,1,35,1,1,20,22,51,50,17,16,35,34,6,5,20,6,35,34,38,53,52,54,
+51,50,22,250,71,78,158,158,78,71,1,201,157,151,142,157,153,146,147,161,1,
+182,71,78,81,77,158,78,71,1,201,158,150,142,157,152,147,147,161,254,245,252,
+213,157,3,43,2,163,71,79,158,158,79,71,1,201,155,152,144,155,152,147,146,
+161,4,2,165,167,1,76,1,74,165,165,228,233,239,222,229,228,237,252,218,167,
+164,163,168,1,72,163,165,227,233,239,221,229,228,237,3,34,250,74,5,182,252,
+2,167,164,1,75,1,72,163,165,226,234,240,220,229,228,237,255,255,0,133,3,166,
+1,72,5,182,18,6,0,10,0,0,255,255,0,133,3,166,2,190,5,182,18,6,0,5,0,0,0,1,
+0,82,0,115,2,43,3,197,0,6,0,0,19,1,23,1,1,7,1,82,1,88,129,254,225,1,31,129,
+254,168,2,41,1,156,74,254,162,254,161,75,1,155,0,1,0,80,0,115,2,41,3,197,
+0,6,0,0,1,1,39,1,1,55,1,2,41,254,166,127,1,31,254,225,127,1,90,2,14,254,101,
+75,1,95,1,94,74,254,100,255,255,0,147,255,227,3,104,5,182,16,39,0,4,1,215,
+0,0,16,6,0,4,0,0,0,1,254,121,0,0,2,143,5,182,0,3,0,0,1,1,35,1,2,143,252,131,
+153,3,125,5,182,250,74,5,182,0,1,0,109,3,29,2,201,5,199,0,18,0,0,1,17,52,
+38,35,34,6,21,17,35,17,51,23,51,54,51,32,21,17,2,76,76,78,111,90,124,102,
+14,13,73,144,1,2,3,29,1,161,85,69,101,124,254,166,2,157,88,101,250,254,80,
+0,1,0,92,0,0,4,35,5,182,0,17,0,0,1,33,21,33,17,35,17,35,53,51,17,33,21,33,
+17,33,21,33,1,188,1,54,254,202,178,174,174,3,25,253,153,2,64,253,192,1,143,
+133,254,246,1,10,133,4,39,162,253,254,161,0,1,0,68,0,0,4,74,5,201,0,33,0,
+0,1,50,23,7,38,35,34,21,21,33,21,33,21,33,21,33,20,6,7,33,21,33,53,54,17,
+35,53,51,53,35,53,51,53,16,2,176,198,165,64,150,147,237,1,157,254,99,1,157,
+254,97,63,77,3,19,251,250,204,198,198,198,198,5,201,80,141,69,254,180,133,
+160,135,113,145,45,164,152,43,1,16,135,160,133,135,1,195,0,3,0,156,255,236,
+5,238,5,182,0,22,0,32,0,41,0,0,37,50,54,55,21,6,35,34,38,53,17,35,53,55,55,
+51,21,51,21,35,17,20,22,1,20,4,33,35,17,35,17,33,32,1,51,50,54,53,52,38,35,
+35,5,102,37,81,18,67,112,118,125,158,160,63,105,225,225,53,254,137,254,233,
+254,244,63,178,1,18,2,2,253,158,53,194,181,167,177,84,125,14,6,133,32,143,
+137,1,193,82,73,195,213,137,254,86,76,82,3,139,228,235,253,199,5,182,253,
+33,141,156,142,139,0,1,0,47,255,236,4,121,5,201,0,38,0,0,1,32,3,33,21,33,
+7,21,23,33,21,33,22,22,51,50,55,21,6,35,34,0,3,35,53,51,39,53,55,35,53,51,
+18,0,51,50,23,7,38,3,10,254,200,75,1,244,253,254,2,2,1,196,254,76,35,199,
+168,152,153,146,170,236,254,221,46,164,148,2,2,148,162,40,1,40,233,205,162,
+76,162,5,43,254,121,133,56,62,44,133,174,191,66,160,65,1,11,1,1,133,42,42,
+78,133,1,8,1,29,95,147,84,0,4,0,133,255,246,6,12,5,193,0,3,0,15,0,25,0,46,
+0,0,1,1,35,1,1,20,6,35,34,38,53,52,54,51,50,22,5,20,22,51,50,54,53,52,35,
+34,37,34,38,53,52,54,51,50,23,7,38,35,34,21,20,51,50,55,21,6,6,5,31,252,213,
+158,3,43,1,139,168,151,142,169,169,148,139,174,254,23,88,86,83,89,172,174,
+253,192,165,185,186,173,103,91,35,83,79,215,211,103,88,31,105,5,182,250,74,
+5,182,251,152,159,185,187,157,163,181,185,159,115,119,119,115,233,217,178,
+162,168,181,37,107,31,234,231,35,107,15,24,0,2,0,111,255,236,3,162,5,203,
+0,28,0,36,0,0,37,50,55,51,6,6,35,34,38,53,53,6,7,53,54,55,17,52,54,51,50,
+22,21,20,2,7,17,20,22,19,52,35,34,6,21,17,54,2,125,170,18,105,8,154,150,153,
+162,80,112,78,114,153,142,120,140,206,181,80,170,123,65,62,250,119,211,169,
+181,183,173,231,30,27,121,21,38,1,234,144,159,162,139,186,254,212,78,254,
+236,103,120,4,33,188,85,103,254,86,131,0,4,0,195,0,0,7,199,5,182,0,15,0,27,
+0,39,0,43,0,0,33,35,1,35,18,21,17,35,17,51,1,51,38,53,17,51,1,20,6,35,34,
+38,53,52,54,51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,3,53,33,21,4,199,201,
+253,94,8,16,161,206,2,154,8,14,162,3,0,163,149,140,163,162,148,138,167,254,
+34,80,90,90,78,78,90,89,81,96,2,15,4,184,254,224,109,252,213,5,182,251,76,
+245,140,3,51,252,185,164,185,188,161,164,182,185,161,113,117,117,113,114,
+109,109,253,31,141,141,0,2,0,35,2,229,5,135,5,182,0,7,0,24,0,0,1,35,17,35,
+53,33,21,35,1,3,35,23,17,35,17,51,19,19,51,17,35,17,55,35,3,1,115,129,207,
+2,33,209,2,84,197,8,6,123,193,192,199,186,131,6,8,207,2,229,2,99,110,110,
+253,157,2,43,127,254,84,2,209,253,213,2,43,253,47,1,162,137,253,213,255,255,
+0,78,0,0,5,246,5,205,18,6,1,118,0,0,0,2,0,102,255,221,4,139,4,72,0,23,0,31,
+0,0,5,34,38,2,53,52,54,54,51,50,22,18,21,33,17,22,22,51,50,54,55,23,6,6,19,
+17,38,38,35,34,7,17,2,121,157,241,133,138,244,149,152,243,135,252,197,49,
+166,82,131,183,81,72,98,217,147,50,163,88,173,122,35,147,1,5,157,171,255,
+140,142,254,253,165,254,156,53,70,105,129,41,155,124,2,139,1,21,53,66,117,
+254,233,255,255,0,69,255,236,6,4,5,182,16,39,2,23,2,100,0,0,16,38,0,123,249,
+0,16,7,2,62,3,106,253,179,255,255,0,35,255,236,6,27,5,201,16,39,2,23,2,170,
+0,0,16,39,2,62,3,129,253,179,16,6,0,117,0,0,255,255,0,71,255,236,6,23,5,182,
+16,39,2,23,2,164,0,0,16,38,2,60,10,0,16,7,2,62,3,125,253,179,255,255,0,102,
+255,236,6,15,5,182,16,39,2,23,2,78,0,0,16,39,2,62,3,117,253,179,16,6,2,61,
+45,0,0,2,0,98,255,236,4,57,5,199,0,26,0,39,0,0,1,16,2,4,35,34,38,53,52,18,
+54,51,50,22,23,55,2,33,34,6,7,53,54,54,51,50,18,1,50,18,55,38,38,35,34,6,
+6,21,20,22,4,57,167,254,236,177,176,187,137,234,152,89,141,46,4,4,254,242,
+58,141,59,61,154,67,210,220,253,158,142,218,35,20,125,80,99,160,97,97,3,164,
+254,249,254,55,232,203,192,170,1,52,159,81,69,76,1,133,42,40,172,29,33,254,
+237,251,207,1,58,233,86,108,130,246,123,116,126,0,2,0,41,0,0,4,125,5,182,
+0,5,0,12,0,0,55,1,51,1,21,33,1,6,7,1,33,1,38,41,1,205,184,1,207,251,172,2,
+39,51,43,254,252,2,196,255,0,67,113,5,69,250,185,111,4,238,200,130,252,254,
+2,250,201,0,1,0,197,254,20,5,37,5,182,0,7,0,0,1,17,33,17,35,17,33,17,4,109,
+253,16,184,4,96,254,20,6,254,249,2,7,162,248,94,0,1,0,72,254,20,4,225,5,182,
+0,11,0,0,19,53,1,1,53,33,21,33,1,1,33,21,72,2,114,253,158,4,72,252,186,2,
+57,253,175,3,159,254,20,113,3,148,3,43,114,162,253,9,252,153,162,0,1,0,102,
+2,137,4,43,3,27,0,3,0,0,19,53,33,21,102,3,197,2,137,146,146,0,1,0,37,255,
+242,4,195,6,158,0,8,0,0,5,35,1,35,53,33,19,1,51,2,115,133,254,235,180,1,37,
+231,2,0,146,14,3,10,143,253,94,5,181,0,3,0,119,1,145,5,45,4,14,0,19,0,31,
+0,43,0,0,1,20,6,35,34,39,6,35,34,38,53,52,54,51,50,23,54,51,50,22,1,50,54,
+55,38,38,35,34,6,21,20,22,1,34,6,7,22,22,51,50,54,53,52,38,5,45,168,129,185,
+124,125,174,136,165,169,132,180,121,124,183,132,165,252,127,63,108,52,49,
+107,69,77,95,94,2,156,63,107,53,49,108,68,76,96,95,2,207,134,184,217,212,
+176,141,137,178,215,211,174,254,191,87,97,94,90,105,81,81,101,1,108,89,95,
+94,90,104,80,78,106,0,1,0,10,254,20,3,0,6,20,0,20,0,0,1,50,23,21,38,35,34,
+21,17,20,6,35,34,39,53,22,51,50,53,17,16,2,127,83,46,59,56,170,168,165,79,
+61,61,62,176,6,20,18,149,24,233,250,229,180,185,21,147,24,233,5,27,1,108,
+0,2,0,96,1,131,4,47,4,35,0,23,0,47,0,0,1,34,6,7,53,54,51,50,22,23,22,22,51,
+50,54,55,21,6,35,34,38,39,38,38,3,34,6,7,53,54,51,50,22,23,22,22,51,50,54,
+55,21,6,35,34,38,39,38,38,1,78,54,127,57,108,148,68,118,83,73,95,47,53,125,
+57,105,151,67,111,88,75,92,48,54,129,55,106,150,63,108,98,65,97,53,60,124,
+51,104,152,69,118,79,89,87,1,252,64,57,158,110,30,35,31,27,66,57,159,109,
+29,37,31,24,1,149,65,55,157,109,25,41,27,28,70,51,158,110,32,33,37,20,0,1,
+0,102,0,162,4,41,5,4,0,19,0,0,37,55,33,53,33,19,33,53,33,19,23,7,33,21,33,
+3,33,21,33,3,1,14,105,254,239,1,84,121,254,51,2,17,135,133,108,1,18,254,172,
+125,1,209,253,235,131,221,223,146,1,6,145,1,31,61,226,145,254,250,146,254,
+230,0,2,0,102,0,0,4,43,4,227,0,6,0,10,0,0,37,1,53,1,21,9,2,53,33,21,4,43,
+252,59,3,197,252,252,3,4,252,59,3,197,244,1,168,102,1,225,159,254,147,254,
+188,254,109,145,145,0,2,0,102,0,0,4,43,4,227,0,6,0,10,0,0,19,1,1,53,1,21,
+1,21,53,33,21,102,3,4,252,252,3,197,252,59,3,197,1,147,1,66,1,111,159,254,
+31,102,254,88,244,145,145,0,2,0,106,0,0,4,61,5,193,0,5,0,9,0,0,19,1,51,1,
+1,35,9,3,106,1,195,78,1,194,254,62,78,1,94,254,201,254,203,1,53,2,223,2,226,
+253,30,253,33,2,223,2,8,253,248,253,248,255,255,0,31,0,0,4,52,6,31,16,38,
+0,73,0,0,16,7,0,76,2,193,0,0,255,255,0,31,0,0,4,35,6,31,16,38,0,73,0,0,16,
+7,0,79,2,193,0,0,0,1,0,207,4,217,3,203,6,16,0,13,0,0,1,34,38,39,51,22,22,
+51,50,54,55,51,6,6,2,72,192,175,10,168,9,91,113,103,99,11,170,15,188,4,217,
+146,165,104,82,88,98,162,149,0,1,255,143,254,20,1,98,4,74,0,13,0,0,19,34,
+39,53,22,51,50,54,53,17,51,17,20,6,45,94,64,69,67,78,73,180,157,254,20,25,
+145,20,85,87,4,244,251,18,164,164,0,1,1,133,4,205,2,123,6,20,0,9,0,0,1,54,
+54,55,51,21,6,6,7,35,1,133,23,39,6,178,13,86,49,98,4,229,66,186,51,18,53,
+184,72,0,1,1,111,254,59,2,117,255,131,0,9,0,0,1,54,54,55,51,21,6,6,7,35,1,
+111,22,54,8,178,16,97,51,98,254,84,51,186,66,18,63,187,60,0,1,1,123,4,217,
+2,131,6,33,0,9,0,0,1,6,6,7,35,53,54,54,55,51,2,131,27,52,7,178,15,99,50,100,
+6,8,59,186,58,19,56,192,61,0,2,0,20,2,74,2,186,5,188,0,10,0,17,0,0,1,35,21,
+35,53,33,53,1,51,17,51,33,53,52,55,6,7,7,2,186,125,153,254,112,1,148,149,
+125,254,234,6,8,90,164,3,14,196,196,107,2,67,253,205,191,107,100,18,140,240,
+0,1,0,61,2,55,2,143,5,182,0,30,0,0,1,50,22,21,20,6,35,34,38,39,53,22,22,51,
+50,54,53,52,38,35,34,6,7,38,39,19,33,21,33,7,54,1,78,145,176,171,169,74,139,
+41,56,140,54,92,109,108,99,54,75,31,29,34,33,1,241,254,133,18,65,4,115,148,
+123,143,158,31,23,137,34,38,81,89,79,85,17,8,24,17,1,170,112,224,13,0,1,0,
+57,2,74,2,150,5,182,0,6,0,0,19,1,33,53,33,21,1,162,1,92,254,59,2,93,254,163,
+2,74,2,241,123,100,252,248,0,3,0,51,2,57,2,154,5,199,0,21,0,34,0,45,0,0,1,
+50,22,21,20,7,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,3,20,22,51,50,
+54,53,52,38,39,39,6,6,19,34,6,21,20,23,54,54,53,52,38,1,104,126,151,148,177,
+169,137,149,160,74,84,71,60,159,47,81,85,87,81,91,79,26,68,70,168,66,73,143,
+60,76,75,5,199,118,104,130,76,74,156,113,139,131,115,69,115,45,44,93,70,103,
+125,253,104,59,72,72,59,60,78,26,10,32,83,1,236,59,54,90,57,23,68,56,54,59,
+0,22,0,84,254,129,7,193,5,238,0,5,0,11,0,17,0,23,0,27,0,31,0,35,0,39,0,43,
+0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,83,0,91,0,107,0,116,0,124,0,137,0,0,
+19,17,33,21,35,21,37,53,33,17,35,53,1,17,51,21,51,21,33,53,51,53,51,17,33,
+53,33,21,33,53,33,21,1,53,33,21,1,35,17,51,17,35,17,51,1,53,33,21,1,35,17,
+51,1,53,33,21,51,53,33,21,1,35,17,51,53,35,17,51,1,35,17,51,5,20,6,35,34,
+38,53,52,54,51,50,22,5,20,51,50,53,52,35,34,37,51,50,22,21,20,6,7,21,22,22,
+21,20,6,35,35,19,51,50,54,53,52,38,35,35,21,21,51,50,54,53,52,35,1,34,39,
+53,22,51,50,53,17,51,17,20,6,84,1,47,192,5,206,1,48,109,249,0,111,192,5,14,
+195,109,253,73,1,17,251,225,1,14,254,242,1,14,4,183,109,109,109,109,251,194,
+1,16,252,48,111,111,2,192,1,16,119,1,17,250,168,111,111,111,111,6,254,109,
+109,251,159,135,127,127,135,135,127,126,136,254,115,135,135,135,135,1,225,
+172,109,112,46,44,61,46,109,94,207,123,66,46,36,42,47,59,74,49,37,90,1,94,
+52,28,43,25,86,125,105,4,190,1,48,111,193,193,111,254,208,193,249,2,1,47,
+194,109,109,194,254,209,109,109,109,109,6,254,111,111,250,168,1,14,2,2,1,
+15,250,59,109,109,1,166,1,14,4,74,111,111,111,111,252,47,1,16,121,1,15,253,
+104,1,16,73,145,156,156,145,146,155,154,147,197,197,196,97,67,83,49,66,8,
+8,14,68,53,81,89,1,98,34,32,34,29,227,154,43,37,74,254,250,10,102,8,86,1,
+146,254,114,95,99,0,3,0,84,254,193,7,170,6,20,0,3,0,30,0,42,0,0,9,3,5,53,
+52,54,55,54,54,53,52,38,35,34,6,7,23,54,51,50,22,21,20,6,7,6,6,21,21,3,20,
+22,51,50,54,53,52,38,35,34,6,3,254,3,172,252,84,252,86,3,235,44,65,103,73,
+187,165,79,186,71,82,160,90,63,62,49,72,84,59,27,71,70,66,73,72,67,72,69,
+6,20,252,86,252,87,3,169,251,47,50,65,49,82,126,88,135,154,56,42,178,80,58,
+47,53,75,54,68,112,74,59,254,237,63,72,73,62,64,73,72,255,255,255,143,254,
+20,2,99,6,33,18,38,2,55,0,0,16,7,1,76,254,171,0,0,255,255,0,25,3,193,1,78,
+5,182,18,6,2,7,0,0,0,2,0,12,255,236,4,242,6,31,0,42,0,52,0,0,1,22,21,16,0,
+33,34,38,53,52,55,54,53,52,35,34,7,39,54,51,50,21,20,7,6,21,20,51,32,17,52,
+39,36,36,53,52,54,51,50,0,19,51,21,37,46,2,35,34,6,21,20,4,4,106,5,254,220,
+254,249,197,201,15,14,68,44,48,39,94,97,182,14,15,230,1,110,4,254,181,254,
+149,187,169,210,1,3,43,144,254,186,19,96,135,78,89,95,1,15,3,70,57,52,254,
+159,254,116,167,175,61,111,111,30,82,27,127,43,186,43,119,119,67,201,2,98,
+59,44,3,222,199,145,160,254,212,254,222,139,139,132,203,107,87,72,134,148,
+0,1,0,0,0,0,4,137,5,195,0,21,0,0,1,55,54,18,54,54,51,50,23,21,38,35,34,6,
+2,2,7,17,35,17,1,51,2,63,69,57,133,76,93,64,58,36,24,35,45,69,164,125,35,
+187,254,35,201,2,219,159,137,1,34,108,50,17,143,6,75,254,187,254,231,97,253,
+225,2,47,3,135,0,2,0,23,255,236,6,154,4,74,0,20,0,40,0,0,5,34,38,53,52,19,
+33,53,55,33,21,35,22,21,20,6,35,34,39,35,6,1,2,21,20,22,51,50,54,53,53,51,
+21,20,22,51,50,54,53,52,39,2,55,189,202,127,254,232,143,5,244,252,112,203,
+190,222,69,8,71,254,204,123,108,116,92,104,174,106,91,116,105,106,20,235,
+240,230,1,7,78,72,150,251,242,240,235,184,184,3,200,254,235,206,173,163,141,
+125,183,183,128,138,168,168,250,233,255,255,0,199,0,0,6,123,7,117,18,38,0,
+48,0,0,16,7,0,118,1,158,1,84,255,255,0,174,0,0,6,213,6,33,18,38,0,80,0,0,
+16,7,0,118,1,207,0,0,255,255,0,0,253,209,5,27,5,188,18,38,0,36,0,0,16,7,2,
+88,1,59,0,0,255,255,0,94,253,209,3,215,4,92,18,38,0,68,0,0,16,7,2,88,0,203,
+0,0,255,255,254,122,0,0,2,144,5,182,16,71,2,23,1,9,0,0,192,0,64,0,0,2,0,115,
+253,209,2,55,255,131,0,11,0,23,0,0,1,20,6,35,34,38,53,52,54,51,50,22,7,52,
+38,35,34,6,21,20,22,51,50,54,2,55,125,104,103,120,122,101,99,130,114,66,49,
+51,64,58,57,51,64,254,172,99,120,117,100,100,117,117,100,56,59,59,56,54,61,
+61,0,2,0,129,255,236,4,102,5,199,0,27,0,44,0,0,0,22,23,7,38,38,35,34,0,3,
+51,54,54,51,50,22,21,20,2,6,35,34,38,53,52,18,0,33,2,38,35,34,14,4,21,20,
+22,51,50,54,54,53,3,216,105,37,36,35,91,55,226,254,248,63,9,58,163,106,154,
+178,132,231,147,184,201,182,1,87,1,20,84,112,97,50,97,81,59,22,21,118,107,
+93,145,76,5,199,14,11,154,11,16,254,247,254,241,77,93,197,172,160,254,219,
+159,234,214,255,1,245,1,39,252,236,124,43,66,74,46,124,46,132,153,131,207,
+106,255,255,0,31,0,0,6,244,6,31,16,38,0,73,0,0,16,39,0,73,2,193,0,0,16,7,
+0,76,5,129,0,0,255,255,0,31,0,0,6,227,6,31,16,38,0,73,0,0,16,39,0,73,2,193,
+0,0,16,7,0,79,5,129,0,0,0,2,0,125,255,236,6,113,6,20,0,20,0,32,0,0,1,16,0,
+33,32,0,17,16,0,33,32,23,54,54,53,51,23,6,6,7,22,5,16,18,51,50,18,17,16,2,
+35,34,2,5,193,254,157,254,195,254,189,254,159,1,97,1,69,1,69,181,68,63,194,
+15,31,134,104,93,251,126,244,238,237,240,239,236,241,243,2,221,254,158,254,
+113,1,137,1,106,1,104,1,134,213,19,124,141,22,160,174,39,174,254,254,221,
+254,209,1,43,1,39,1,36,1,42,254,210,0,2,0,113,255,236,5,43,4,242,0,23,0,35,
+0,0,1,16,0,35,34,38,2,53,16,0,51,50,22,23,62,2,53,51,23,6,6,7,22,5,20,22,
+51,50,54,53,52,38,35,34,6,4,104,254,240,240,149,230,124,1,12,242,108,182,
+66,50,59,28,193,14,32,126,106,69,252,195,158,164,169,152,155,169,169,150,
+2,39,254,243,254,210,139,1,4,172,1,12,1,43,73,68,15,67,101,106,23,161,175,
+39,140,177,216,206,214,208,205,211,211,0,1,0,184,255,236,6,139,6,20,0,26,
+0,0,1,21,54,54,53,51,23,6,6,7,17,16,0,33,32,0,53,17,51,17,20,22,51,50,54,
+53,17,5,31,82,77,191,14,33,176,155,254,223,254,246,254,240,254,212,185,194,
+197,180,188,5,182,198,11,129,152,22,185,186,26,253,147,255,0,254,232,1,32,
+252,3,174,252,74,177,196,190,185,3,180,0,1,0,162,255,236,5,170,4,244,0,29,
+0,0,1,17,20,22,51,50,54,53,17,51,21,54,54,53,51,23,6,6,7,17,35,39,35,6,6,
+35,34,38,53,17,1,88,119,125,169,154,181,80,73,191,14,32,177,149,148,26,9,
+50,178,116,201,202,4,72,253,63,133,129,188,209,2,58,121,13,128,152,23,191,
+189,17,252,176,145,79,86,190,209,2,205,255,255,252,77,4,217,253,233,6,33,
+16,7,0,67,250,202,0,0,255,255,253,7,4,217,254,163,6,33,16,7,0,118,251,132,
+0,0,255,255,252,19,4,217,255,3,5,225,16,7,1,82,251,17,0,0,0,1,253,4,4,184,
+254,119,6,145,0,16,0,0,1,20,7,7,35,39,54,54,53,52,35,34,7,53,54,51,32,254,
+119,166,10,111,14,74,88,134,53,45,37,76,1,2,5,215,140,38,109,174,13,46,48,
+82,8,106,12,0,1,253,49,254,152,254,6,255,125,0,11,0,0,5,52,54,51,50,22,21,
+20,6,35,34,38,253,49,63,44,43,63,59,47,48,59,246,60,55,55,60,53,61,60,255,
+255,0,199,0,0,3,248,7,115,18,38,0,40,0,0,16,7,0,67,255,208,1,82,255,255,0,
+201,0,0,5,96,7,115,18,38,1,178,0,0,16,7,0,67,0,102,1,82,255,255,0,113,255,
+236,4,27,6,33,18,38,0,72,0,0,16,6,0,67,183,0,255,255,0,174,0,0,4,117,6,33,
+18,38,1,210,0,0,16,6,0,67,226,0,0,1,0,131,255,236,7,162,5,201,0,50,0,0,1,
+34,6,7,39,54,51,50,0,17,16,0,33,34,38,39,35,6,6,35,32,0,17,16,0,51,50,23,
+7,38,38,35,34,2,17,16,18,51,50,54,55,17,51,17,22,51,50,18,17,16,2,5,172,60,
+95,44,73,126,154,233,1,5,254,225,254,252,116,174,75,6,73,170,115,254,250,
+254,227,1,3,233,156,124,74,44,94,60,146,161,203,186,62,124,49,185,98,139,
+185,204,163,5,37,43,29,152,84,254,138,254,171,254,141,254,97,50,50,50,50,
+1,157,1,117,1,83,1,120,84,152,29,43,254,220,254,251,254,217,254,182,39,37,
+1,195,254,61,76,1,69,1,44,1,8,1,33,0,1,0,0,0,0,6,45,4,74,0,34,0,0,1,6,7,7,
+35,1,51,23,18,18,23,51,54,55,54,55,3,51,19,30,3,23,51,54,18,17,51,16,2,7,
+35,3,38,3,45,34,117,54,223,254,127,186,88,100,106,22,8,29,75,97,28,166,195,
+201,12,32,32,27,7,8,166,148,180,197,217,190,125,29,1,193,105,233,111,4,74,
+248,254,232,254,181,108,86,156,202,64,1,203,253,174,37,97,99,89,30,180,1,
+175,1,79,254,145,254,6,225,1,80,75,0,2,0,18,0,0,4,252,5,182,0,17,0,26,0,0,
+19,33,53,51,21,33,21,33,21,51,32,17,20,4,33,33,17,33,1,51,50,54,53,52,38,
+35,35,18,1,58,186,1,158,254,98,193,2,53,254,240,254,249,254,103,254,198,1,
+244,203,192,172,184,211,172,4,209,229,229,156,233,254,96,212,216,4,53,252,
+103,135,137,137,117,0,2,0,18,0,0,4,166,5,39,0,17,0,26,0,0,1,33,21,33,17,33,
+32,17,20,6,35,33,17,35,53,51,53,51,17,17,33,50,54,53,52,38,35,1,180,1,90,
+254,166,1,53,1,189,225,224,254,29,240,240,178,1,41,136,143,128,155,4,74,150,
+254,209,254,203,165,171,3,180,150,221,252,201,254,161,92,89,89,81,0,1,0,199,
+255,236,7,37,5,203,0,33,0,0,1,34,6,7,33,21,33,18,0,51,50,55,21,6,6,35,32,
+0,3,33,17,35,17,51,17,33,18,0,37,50,23,7,38,38,5,143,221,255,29,2,180,253,
+71,10,1,6,236,156,197,93,173,113,254,193,254,165,10,254,176,184,184,1,86,
+32,1,111,1,50,218,181,74,105,157,5,41,244,233,160,254,245,254,236,58,160,
+34,25,1,109,1,81,253,86,5,182,253,150,1,47,1,78,2,94,156,51,37,0,1,0,174,
+255,236,5,168,4,94,0,33,0,0,5,34,0,39,33,17,35,17,51,17,33,54,36,51,50,23,
+7,38,35,34,6,7,33,21,33,22,22,51,50,54,55,21,6,6,4,127,237,254,246,13,254,
+231,180,180,1,27,24,1,11,225,163,132,53,128,114,157,159,16,2,13,253,241,9,
+164,159,89,134,60,61,128,20,1,8,245,254,23,4,74,254,55,232,245,59,148,52,
+158,164,152,182,174,37,25,156,31,28,0,2,0,0,0,0,5,119,5,182,0,11,0,18,0,0,
+33,1,35,17,35,17,35,1,35,1,51,1,1,33,39,38,39,6,6,4,180,254,234,144,168,143,
+254,231,190,2,98,178,2,99,252,160,1,73,80,58,28,10,46,2,164,253,92,2,164,
+253,92,5,182,250,74,3,66,198,150,100,39,137,0,2,0,8,0,0,4,137,4,74,0,11,0,
+18,0,0,1,1,35,3,35,17,35,17,35,3,35,1,3,33,38,39,35,6,6,2,182,1,211,184,203,
+108,162,113,198,185,1,209,24,1,14,99,32,8,11,24,4,74,251,182,1,225,254,31,
+1,225,254,31,4,74,254,43,245,103,35,68,0,2,0,199,0,0,7,111,5,182,0,19,0,26,
+0,0,1,35,17,35,17,35,1,35,1,33,17,35,17,51,17,33,1,51,1,35,1,33,39,38,39,
+6,7,5,145,139,166,141,254,233,196,1,28,254,107,184,184,1,217,1,2,180,2,97,
+201,253,108,1,62,74,60,24,23,65,2,170,253,86,2,170,253,86,2,170,253,86,5,
+182,253,150,2,106,250,74,3,74,196,152,92,94,162,0,2,0,174,0,0,6,49,4,74,0,
+19,0,27,0,0,1,1,35,3,35,17,35,17,35,3,35,19,33,17,35,17,51,17,33,19,23,35,
+6,7,7,33,39,38,4,96,1,209,182,205,108,162,107,205,184,207,254,223,176,176,
+1,99,194,115,8,40,36,56,1,11,58,35,4,74,251,182,1,233,254,23,1,233,254,23,
+1,233,254,23,4,74,254,53,1,203,121,128,83,129,145,89,0,2,0,23,0,0,5,188,5,
+182,0,31,0,34,0,0,1,21,1,30,2,18,19,35,3,46,2,35,35,17,35,17,35,34,6,6,7,
+3,35,19,62,2,55,1,53,1,1,33,5,55,254,95,115,153,102,93,87,188,135,32,66,99,
+82,28,185,26,81,97,63,34,133,196,135,46,98,151,114,254,103,2,75,1,111,253,
+35,5,182,135,254,21,7,77,149,254,200,254,221,1,193,105,97,43,253,74,2,182,
+41,93,111,254,63,1,197,155,143,77,8,1,235,135,253,162,1,184,0,2,0,12,0,0,
+5,14,4,74,0,32,0,35,0,0,1,21,1,30,3,23,19,35,3,46,2,35,35,17,35,17,35,34,
+6,6,7,3,35,19,62,2,55,1,53,5,33,1,4,139,254,180,83,108,72,47,24,129,180,129,
+33,55,79,70,11,166,14,66,79,55,35,132,178,129,54,78,113,89,254,180,3,25,253,
+203,1,26,4,74,105,254,158,8,50,78,105,62,254,176,1,76,85,68,29,253,254,2,
+2,28,66,88,254,180,1,80,138,98,57,10,1,98,105,148,254,203,0,2,0,199,0,0,7,
+213,5,182,0,36,0,39,0,0,1,21,1,30,2,23,19,35,3,46,2,35,35,17,35,17,35,34,
+6,7,3,35,55,18,54,55,33,17,35,17,51,17,33,1,53,5,33,1,7,78,254,96,115,153,
+100,46,137,182,137,36,66,101,86,23,186,21,126,115,43,133,193,39,91,81,35,
+254,92,184,184,2,199,254,110,3,187,253,36,1,111,5,182,135,254,19,7,77,142,
+155,254,59,1,193,110,93,40,253,76,2,180,98,145,254,63,128,1,59,202,37,253,
+86,5,182,253,150,1,227,135,166,254,70,0,2,0,174,0,0,6,190,4,74,0,37,0,40,
+0,0,1,21,1,30,3,23,19,35,3,46,2,35,35,17,35,17,35,34,6,6,7,3,35,19,54,55,
+33,17,35,17,51,17,33,1,53,5,33,1,6,59,254,181,83,107,72,47,24,129,180,129,
+33,56,81,67,11,165,11,68,81,56,34,131,179,129,45,37,254,207,176,176,2,43,
+254,182,3,25,253,203,1,26,4,74,105,254,156,8,49,78,104,62,254,176,1,76,84,
+68,28,254,0,2,0,28,66,86,254,180,1,80,116,40,254,20,4,74,254,55,1,96,105,
+148,254,209,0,1,0,61,254,74,4,66,6,211,0,75,0,0,23,20,22,51,50,55,54,51,50,
+23,21,38,35,34,7,6,35,34,38,53,52,54,55,54,54,53,16,33,35,53,51,50,54,53,
+52,38,35,34,6,7,39,54,55,38,39,53,51,22,23,54,54,51,50,23,21,38,35,34,6,7,
+22,22,21,20,6,7,21,22,22,21,20,4,5,14,2,250,84,88,96,120,120,65,153,68,70,
+161,66,108,109,104,182,183,220,233,197,186,254,61,208,200,215,215,159,136,
+109,195,99,90,167,193,51,172,131,92,131,93,131,65,55,48,31,39,44,111,48,173,
+196,191,168,187,203,254,223,254,229,96,118,54,135,53,50,7,6,39,174,51,5,5,
+130,134,131,131,10,6,131,142,1,6,154,145,123,106,123,60,65,125,114,28,58,
+181,27,59,136,117,86,14,117,12,82,71,23,190,142,142,183,25,8,24,180,142,207,
+216,7,3,27,46,0,1,0,25,254,115,3,143,5,80,0,70,0,0,1,50,23,21,38,35,34,6,
+7,22,22,21,20,7,21,22,22,21,20,6,7,6,6,21,20,22,51,50,54,51,50,23,21,38,38,
+35,7,6,35,34,38,53,52,54,55,54,54,53,52,38,35,35,53,51,32,53,52,35,34,7,39,
+54,55,38,39,53,51,22,23,54,54,3,4,58,42,24,43,47,101,45,122,140,210,130,117,
+251,226,131,115,77,87,110,190,75,123,41,27,90,43,177,114,106,149,160,193,
+188,167,160,156,161,144,119,1,55,249,141,169,63,132,118,107,86,131,72,141,
+89,136,5,80,14,117,10,77,60,28,138,107,187,56,8,37,134,100,153,166,2,3,46,
+60,50,42,10,41,151,23,20,5,6,123,117,122,128,4,2,93,91,96,87,147,168,156,
+70,143,54,16,131,82,27,50,139,112,85,255,255,0,109,0,0,6,2,5,182,18,6,1,117,
+0,0,255,255,0,162,254,20,5,154,6,18,18,6,1,149,0,0,0,3,0,125,255,236,5,195,
+5,205,0,11,0,18,0,25,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,50,18,19,33,18,
+18,19,34,6,7,33,38,38,5,195,254,157,254,193,254,189,254,159,1,95,1,71,1,62,
+1,98,253,94,222,243,12,252,68,13,243,225,218,244,19,3,186,19,239,2,221,254,
+161,254,110,1,139,1,104,1,101,1,137,254,113,252,77,1,11,1,4,254,252,254,245,
+4,160,251,247,248,250,0,3,0,113,255,236,4,104,4,94,0,12,0,18,0,24,0,0,1,16,
+0,35,34,38,2,53,16,0,51,50,0,1,50,54,55,33,18,1,34,6,7,33,2,4,104,254,240,
+240,149,230,124,1,12,242,232,1,17,254,5,156,152,11,253,127,18,1,45,152,151,
+14,2,127,30,2,39,254,243,254,210,139,1,4,172,1,12,1,43,254,207,253,84,184,
+176,254,152,3,70,166,162,1,72,0,1,0,0,0,0,5,82,5,195,0,21,0,0,1,34,6,7,1,
+35,1,51,1,22,23,54,55,19,62,2,51,50,23,21,38,4,236,61,78,52,254,180,211,253,
+242,193,1,77,70,33,29,69,164,59,84,110,89,42,87,56,5,43,104,170,251,231,5,
+182,252,88,193,145,139,222,2,6,190,152,66,21,151,20,0,1,0,0,0,0,4,76,4,84,
+0,22,0,0,33,2,1,51,1,22,23,51,54,55,19,54,54,51,50,23,21,38,35,34,6,7,3,1,
+152,140,254,244,188,1,5,66,9,8,31,33,143,54,111,112,38,46,29,41,46,57,28,
+252,1,114,2,216,253,41,191,53,165,95,1,191,167,107,12,140,11,82,86,252,225,
+255,255,0,0,0,0,5,82,7,115,18,38,2,125,0,0,16,7,3,115,4,221,1,82,255,255,
+0,0,0,0,4,76,6,33,18,38,2,126,0,0,16,7,3,115,4,111,0,0,0,3,0,125,254,20,9,
+184,5,205,0,11,0,23,0,46,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,16,18,51,50,
+18,17,16,2,35,34,2,37,51,19,22,23,51,54,55,19,51,1,6,6,35,34,39,53,22,51,
+50,54,55,55,5,90,254,184,254,218,254,214,254,187,1,69,1,44,1,39,1,69,251,
+227,219,212,212,216,216,210,211,222,4,109,190,244,68,24,9,16,78,219,190,254,
+43,69,191,139,78,74,55,66,85,119,42,57,2,221,254,157,254,114,1,135,1,108,
+1,106,1,132,254,115,254,157,254,220,254,210,1,42,1,40,1,39,1,39,254,216,71,
+253,139,177,120,81,218,2,115,251,30,182,158,17,143,12,92,102,146,255,255,
+0,113,254,20,8,139,4,94,16,38,0,82,0,0,16,7,0,92,4,119,0,0,0,2,0,125,255,
+135,6,20,6,45,0,19,0,40,0,0,1,16,0,5,6,35,34,39,36,0,17,16,0,37,54,51,50,
+23,4,0,1,20,18,23,54,54,51,50,23,54,18,53,52,2,39,6,35,34,39,6,2,6,20,254,
+208,254,247,26,119,124,20,254,245,254,206,1,45,1,16,20,124,118,25,1,13,1,
+46,251,41,195,186,17,73,54,105,36,187,192,194,185,31,110,113,31,186,195,2,
+221,254,207,254,117,43,111,111,40,1,136,1,57,1,53,1,130,43,108,108,44,254,
+117,254,211,238,254,213,42,48,38,86,42,1,43,238,240,1,40,40,88,86,40,254,
+214,0,2,0,113,255,147,4,213,4,180,0,23,0,43,0,0,1,20,2,7,6,6,35,34,38,39,
+38,2,53,52,18,55,54,54,51,50,22,23,22,18,5,16,23,54,54,51,50,23,54,17,16,
+39,6,6,35,34,38,39,6,6,4,213,222,210,9,64,56,57,63,9,205,229,227,209,8,62,
+57,54,66,9,205,227,252,86,252,12,60,53,102,25,248,248,14,61,52,54,61,12,131,
+119,2,39,232,254,221,38,53,46,45,56,36,1,40,227,232,1,33,36,54,42,42,56,38,
+254,218,223,254,161,59,42,34,74,60,1,92,1,85,62,42,33,34,43,31,204,0,3,0,
+123,255,236,7,145,8,68,0,19,0,69,0,87,0,0,1,21,35,34,46,2,35,34,21,35,53,
+52,54,51,50,30,2,51,1,50,54,55,22,22,51,50,18,17,16,2,35,34,6,7,38,39,54,
+51,50,0,17,16,0,33,34,38,39,6,6,35,32,0,17,16,0,51,50,23,6,7,38,38,35,34,
+2,17,16,18,1,20,6,7,53,54,54,53,52,46,2,53,52,54,51,50,22,5,172,16,87,144,
+120,99,42,106,131,124,109,58,113,119,132,78,253,35,94,170,59,62,173,89,185,
+206,163,144,60,97,42,45,27,121,156,234,1,3,254,219,254,250,113,166,73,75,
+167,112,254,247,254,224,1,5,232,156,121,27,45,41,95,60,147,163,206,2,132,
+123,120,58,62,31,38,31,53,45,57,68,7,205,127,35,42,35,116,30,110,110,37,45,
+37,248,190,74,63,64,73,1,74,1,39,1,8,1,33,45,29,90,62,86,254,135,254,174,
+254,140,254,98,47,47,48,46,1,156,1,118,1,85,1,118,86,62,90,29,45,254,222,
+254,249,254,217,254,182,6,90,80,117,28,74,18,50,26,20,18,17,26,28,38,39,70,
+0,3,0,111,255,236,6,23,7,12,0,42,0,63,0,78,0,0,5,34,39,6,6,35,34,2,17,16,
+18,51,50,22,23,7,38,35,34,6,21,16,33,50,54,55,22,51,32,17,16,35,34,7,39,54,
+54,51,50,18,17,16,2,3,21,35,34,46,2,35,34,6,21,35,53,52,54,51,50,30,2,51,
+5,20,6,7,53,54,53,52,39,38,53,52,51,50,22,4,55,148,97,47,112,83,230,251,209,
+194,63,120,42,59,91,69,114,109,1,41,57,114,71,116,125,1,39,221,71,91,59,41,
+123,63,193,209,252,82,17,87,144,120,98,42,53,54,131,122,112,58,112,119,131,
+77,254,240,125,119,119,49,49,98,57,68,20,69,32,37,1,39,1,12,1,20,1,43,32,
+25,148,52,209,211,254,100,37,47,84,1,156,1,164,52,148,25,32,254,212,254,237,
+254,243,254,218,6,172,129,36,42,36,55,62,31,110,107,36,44,36,232,81,116,28,
+72,40,58,29,17,16,44,78,70,255,255,0,131,255,236,7,162,7,10,18,38,2,105,0,
+0,16,7,9,104,1,193,1,102,255,255,0,0,0,0,6,45,5,164,18,38,2,106,0,0,16,7,
+9,104,0,211,0,0,0,1,0,123,254,20,4,233,5,203,0,22,0,0,1,34,0,17,16,0,51,50,
+55,17,35,17,32,0,17,52,18,36,51,50,23,7,38,3,72,243,254,234,1,4,255,111,71,
+185,254,166,254,150,176,1,71,218,230,183,75,172,5,39,254,195,254,239,254,
+223,254,217,25,253,106,1,216,1,129,1,110,225,1,88,183,86,158,80,0,1,0,113,
+254,20,3,170,4,94,0,24,0,0,5,38,0,17,16,0,51,50,22,23,7,38,35,34,6,21,20,
+22,51,50,54,55,17,35,17,2,115,254,254,252,1,18,254,77,159,61,53,150,100,170,
+166,168,164,66,89,41,180,20,2,1,31,1,18,1,21,1,42,31,28,150,52,202,214,215,
+197,25,18,253,100,1,216,0,1,0,104,255,252,4,117,5,6,0,19,0,0,1,3,39,19,37,
+55,5,19,37,55,5,19,23,3,5,7,37,3,5,7,2,2,182,123,182,254,225,68,1,33,203,
+254,223,69,1,31,184,121,184,1,33,70,254,227,204,1,30,67,1,55,254,197,67,1,
+64,166,117,168,1,98,166,119,168,1,61,69,254,194,166,117,166,254,160,168,117,
+0,1,0,201,4,143,3,174,5,182,0,19,0,0,1,6,6,35,34,38,53,52,54,51,33,54,54,
+51,50,22,21,20,6,35,1,135,6,42,48,53,41,42,54,1,195,6,44,48,51,45,44,54,4,
+238,45,50,52,53,53,43,47,47,49,53,56,42,0,1,0,248,4,227,3,223,5,221,0,19,
+0,0,1,50,55,54,51,50,22,21,21,35,53,52,35,34,14,2,35,35,53,1,4,120,150,149,
+81,109,122,129,106,43,100,120,143,86,16,5,104,59,58,107,110,33,19,100,36,
+43,36,129,0,1,1,221,4,213,2,211,6,57,0,15,0,0,1,52,54,51,50,22,21,20,14,2,
+21,20,23,21,38,1,221,70,57,47,51,31,36,31,119,246,5,184,57,72,41,39,27,25,
+16,18,20,58,36,76,58,0,1,1,223,4,213,2,211,6,57,0,15,0,0,1,20,7,53,54,53,
+52,46,2,53,52,54,51,50,22,2,211,244,119,31,36,31,52,46,57,68,5,184,169,58,
+76,37,57,20,18,16,25,27,39,41,72,0,8,0,41,254,193,7,193,5,145,0,12,0,26,0,
+40,0,54,0,68,0,82,0,95,0,109,0,0,1,50,22,23,35,38,38,35,34,6,7,35,54,19,50,
+22,23,35,38,38,35,34,6,7,35,54,54,1,50,22,23,35,38,38,35,34,6,7,35,54,54,
+33,50,22,23,35,38,38,35,34,6,7,35,54,54,1,50,22,23,35,38,38,35,34,6,7,35,
+54,54,33,50,22,23,35,38,38,35,34,6,7,35,54,54,1,50,22,23,35,38,38,35,34,6,
+7,35,54,33,50,22,23,35,38,38,35,34,6,7,35,54,54,3,233,93,113,7,79,5,60,69,
+78,50,5,75,11,197,92,115,6,79,5,60,69,78,50,5,75,5,100,2,171,92,115,6,80,
+5,60,68,78,50,5,76,5,101,251,230,92,115,6,80,5,60,68,78,50,5,76,5,101,4,232,
+92,115,6,80,5,60,68,78,50,5,76,5,101,251,230,92,115,6,80,5,60,68,78,50,5,
+76,5,101,5,167,92,115,6,80,5,60,68,78,51,5,75,11,250,212,92,115,6,80,5,60,
+68,78,50,5,76,5,101,5,145,101,93,44,44,41,47,194,249,242,102,92,44,44,41,
+47,89,105,1,23,102,93,45,43,39,49,90,105,102,93,45,43,39,49,90,105,3,219,
+102,93,45,43,39,49,90,105,102,93,45,43,39,49,90,105,254,24,104,90,44,44,40,
+48,194,102,92,45,43,39,49,90,104,0,8,0,41,254,127,7,125,5,211,0,7,0,15,0,
+23,0,31,0,38,0,45,0,53,0,61,0,0,5,23,6,6,7,35,54,55,3,39,54,54,55,51,6,7,
+1,55,22,22,23,21,38,39,5,7,38,38,39,53,22,23,1,52,54,55,23,6,7,1,20,6,7,39,
+54,55,3,34,38,38,39,55,22,23,1,23,22,22,23,7,38,39,4,55,11,17,70,36,97,53,
+17,59,11,19,73,31,97,52,18,2,35,14,71,200,65,221,129,251,104,14,66,191,79,
+221,129,3,166,174,152,69,234,63,252,232,187,139,69,189,107,40,17,56,80,15,
+67,123,76,3,104,19,38,90,23,67,144,55,35,14,66,191,79,221,129,4,152,14,71,
+200,65,220,130,254,22,11,19,73,31,97,53,17,59,11,17,70,36,97,53,17,1,168,
+23,91,56,68,152,46,252,149,23,94,51,68,117,79,2,224,87,192,46,70,198,99,252,
+233,4,66,194,61,70,222,75,0,2,0,199,254,127,6,37,7,98,0,20,0,34,0,0,19,51,
+17,20,7,7,51,1,51,17,51,3,35,19,35,17,52,55,35,1,35,1,34,38,39,51,22,22,51,
+50,54,55,51,6,6,199,172,11,4,9,3,36,203,201,148,211,158,170,19,9,252,215,
+204,2,73,190,173,11,165,10,93,110,105,99,9,170,13,191,5,182,252,219,149,177,
+81,4,188,250,236,253,221,1,129,3,27,169,250,251,66,6,43,143,168,108,78,93,
+93,163,148,0,2,0,174,254,133,5,49,6,16,0,17,0,31,0,0,1,17,20,7,1,51,17,51,
+3,35,19,35,17,55,55,1,35,17,37,34,38,39,51,22,22,51,50,54,55,51,6,6,1,88,
+12,2,76,221,188,129,184,125,168,3,5,253,182,221,1,244,190,174,11,166,8,92,
+113,105,99,9,170,12,190,4,74,253,129,95,186,3,152,252,78,253,237,1,123,2,
+137,143,128,252,104,4,74,143,144,167,103,83,93,93,160,151,0,2,0,47,0,0,4,
+131,5,182,0,17,0,26,0,0,19,51,53,51,21,33,21,33,17,51,32,17,20,4,33,33,17,
+35,1,51,50,54,53,52,38,35,35,47,152,184,1,80,254,176,184,2,76,254,234,254,
+237,254,109,152,1,80,209,189,182,183,196,201,4,254,184,184,160,254,238,254,
+96,209,219,4,94,252,62,135,137,131,123,0,2,0,18,0,0,4,84,6,20,0,17,0,26,0,
+0,1,33,21,33,17,33,32,17,20,6,35,33,17,35,53,51,53,51,17,17,33,50,54,53,52,
+38,35,1,98,1,47,254,209,1,52,1,190,226,225,254,29,156,156,180,1,39,136,143,
+128,155,5,33,137,253,239,254,201,164,172,4,152,137,243,251,220,254,161,91,
+90,89,81,0,2,0,199,0,0,4,125,5,182,0,15,0,28,0,0,1,20,6,7,23,7,39,6,35,35,
+17,35,17,33,32,4,1,51,50,55,39,55,23,54,53,52,38,35,35,4,125,114,105,117,
+105,145,98,138,178,184,1,145,1,15,1,22,253,2,162,95,56,102,113,133,118,187,
+193,195,4,8,129,200,56,153,88,190,27,253,199,5,182,216,253,249,8,135,86,170,
+70,168,141,140,0,2,0,174,254,20,4,123,4,94,0,23,0,40,0,0,5,34,39,35,22,21,
+17,35,17,51,23,51,54,54,51,50,18,17,16,7,23,7,39,6,3,34,6,7,21,20,22,51,50,
+55,39,55,23,54,53,52,38,2,182,221,119,12,12,180,148,26,8,64,166,110,214,237,
+178,112,106,129,68,114,163,145,2,148,166,44,38,119,112,125,93,145,20,159,
+148,32,254,61,6,54,150,89,81,254,215,254,242,254,175,144,154,84,172,24,3,
+219,184,197,35,223,199,12,154,84,162,103,233,208,206,0,1,0,47,0,0,4,14,5,
+182,0,13,0,0,1,21,33,17,33,21,33,17,35,17,35,53,51,17,4,14,253,113,1,166,
+254,90,184,152,152,5,182,164,254,17,160,253,125,2,131,160,2,147,0,1,0,16,
+0,0,3,78,4,74,0,13,0,0,1,33,17,33,21,33,17,35,17,35,53,51,17,33,3,78,254,
+18,1,88,254,168,180,156,156,2,162,3,178,254,182,139,254,35,1,221,139,1,226,
+0,1,0,199,254,0,4,236,5,182,0,27,0,0,1,34,7,17,35,17,33,21,33,17,54,51,32,
+0,17,16,0,33,34,38,39,53,22,51,32,17,52,36,2,55,94,90,184,3,82,253,102,95,
+120,1,62,1,88,254,223,255,0,85,128,70,123,137,1,119,254,255,2,131,12,253,
+137,5,182,164,254,9,10,254,170,254,199,254,197,254,165,21,28,164,49,1,242,
+239,254,0,1,0,174,254,10,4,8,4,74,0,26,0,0,1,34,39,53,22,51,32,17,52,38,35,
+34,7,17,35,17,33,21,33,17,54,51,32,0,17,16,2,2,78,140,106,110,126,1,10,173,
+181,78,60,180,2,170,254,10,82,60,1,13,1,11,234,254,10,60,159,61,1,149,215,
+203,14,254,47,4,74,152,254,191,12,254,225,254,221,254,244,254,219,0,1,0,2,
+254,127,7,20,5,182,0,21,0,0,1,1,51,1,17,51,17,1,51,1,1,51,17,35,17,35,1,17,
+35,17,1,35,2,78,253,201,204,2,47,177,2,47,204,253,201,1,203,194,176,102,253,
+197,177,253,195,211,2,240,2,198,253,60,2,196,253,60,2,196,253,60,253,178,
+253,219,1,129,2,229,253,27,2,229,253,27,0,1,0,2,254,133,6,61,4,74,0,21,0,
+0,1,51,17,1,51,1,1,51,17,35,17,35,1,17,35,17,1,35,1,1,51,1,2,170,168,1,190,
+195,254,59,1,103,200,174,98,254,37,168,254,37,205,1,236,254,59,197,1,188,
+4,74,253,235,2,21,253,235,254,97,253,239,1,123,2,45,253,211,2,45,253,211,
+2,53,2,21,253,235,255,255,0,78,254,61,4,70,5,203,18,38,1,177,0,0,16,7,3,124,
+1,94,0,0,255,255,0,68,254,61,3,143,4,94,18,38,1,209,0,0,16,7,3,124,1,12,0,
+0,0,1,0,199,254,127,5,61,5,182,0,17,0,0,37,51,17,35,17,35,1,7,17,35,17,51,
+17,55,1,51,0,1,4,129,188,176,112,253,247,149,184,184,126,2,9,215,254,209,
+254,236,164,253,219,1,129,2,186,131,253,201,5,182,253,47,139,2,70,254,176,
+254,211,0,1,0,174,254,131,4,86,4,74,0,14,0,0,1,51,1,1,51,17,35,17,35,1,17,
+35,17,51,17,3,55,197,254,43,1,119,184,172,88,254,16,180,180,4,74,253,239,
+254,95,253,235,1,125,2,45,253,211,4,74,253,235,0,1,0,199,0,0,4,244,5,182,
+0,19,0,0,1,7,17,35,17,51,17,55,17,51,21,1,51,0,1,1,35,1,17,35,1,252,125,184,
+184,125,125,1,141,215,254,209,254,236,2,90,217,254,94,125,2,162,107,253,201,
+5,182,253,43,142,1,94,211,1,188,254,176,254,211,252,199,2,70,254,217,0,1,
+0,174,0,0,4,72,4,74,0,20,0,0,1,38,39,17,35,17,51,17,55,17,51,21,1,51,1,21,
+1,35,1,21,35,1,213,78,37,180,180,115,131,1,4,197,254,55,1,240,209,254,225,
+131,1,180,78,41,253,213,4,74,253,233,121,1,74,197,1,25,254,30,108,254,4,1,
+51,215,0,1,0,47,0,0,4,244,5,182,0,22,0,0,19,51,53,51,21,51,21,35,17,1,51,
+0,1,1,35,38,2,39,7,17,35,17,35,47,152,184,213,213,2,135,215,254,209,254,236,
+2,90,221,131,253,131,149,184,152,5,8,174,174,162,254,123,2,213,254,176,254,
+211,252,199,174,1,94,174,129,253,199,4,102,0,1,0,18,0,0,4,49,6,20,0,24,0,
+0,19,51,53,51,21,33,21,33,17,7,51,55,54,55,1,51,1,1,35,1,7,17,35,17,35,18,
+156,178,1,119,254,137,6,8,19,64,44,1,94,213,254,68,1,217,215,254,131,125,
+178,156,5,92,184,184,133,253,252,158,25,91,46,1,115,254,43,253,139,1,254,
+107,254,109,4,215,0,1,0,14,0,0,5,139,5,182,0,13,0,0,19,33,17,1,51,1,1,35,
+1,7,17,35,17,33,14,2,9,2,135,217,253,188,2,88,215,253,250,151,183,254,174,
+5,182,253,43,2,213,253,131,252,199,2,186,131,253,201,5,18,0,1,0,37,0,0,4,
+244,4,74,0,12,0,0,19,33,17,1,51,1,1,35,1,17,35,17,33,37,2,14,1,215,195,254,
+43,1,252,207,254,14,176,254,162,4,74,253,235,2,21,253,237,253,201,2,45,253,
+211,3,182,0,1,0,199,254,127,5,213,5,182,0,15,0,0,37,51,17,35,17,35,17,33,
+17,35,17,51,17,33,17,51,5,37,176,176,182,253,16,184,184,2,240,182,164,253,
+219,1,129,2,170,253,86,5,182,253,150,2,106,0,1,0,174,254,133,5,12,4,74,0,
+15,0,0,1,17,33,17,51,17,51,17,35,17,35,17,33,17,35,17,1,98,2,84,180,162,178,
+164,253,172,180,4,74,254,55,1,201,252,78,253,237,1,123,1,233,254,23,4,74,
+0,1,0,199,0,0,6,117,5,182,0,13,0,0,1,33,17,35,17,33,17,35,17,51,17,33,17,
+33,6,117,254,176,184,253,18,184,184,2,238,2,8,5,18,250,238,2,170,253,86,5,
+182,253,150,2,106,0,1,0,174,0,0,5,201,4,74,0,13,0,0,1,17,33,17,33,21,33,17,
+35,17,33,17,35,17,1,98,2,84,2,19,254,161,180,253,172,180,4,74,254,55,1,201,
+148,252,74,1,233,254,23,4,74,0,1,0,199,254,0,8,41,5,182,0,32,0,0,33,35,17,
+33,17,35,17,33,17,54,51,32,0,17,20,2,6,35,34,38,39,53,22,51,50,54,53,52,38,
+35,34,6,7,4,221,182,253,88,184,4,22,76,127,1,49,1,80,129,244,168,79,135,70,
+134,126,183,189,239,221,43,125,23,5,16,250,240,5,182,253,97,12,254,164,254,
+202,205,254,215,155,21,28,164,49,253,242,246,248,7,7,0,1,0,174,254,10,6,172,
+4,74,0,28,0,0,37,16,2,35,34,39,53,22,51,50,17,52,38,35,34,7,17,35,17,33,17,
+35,17,33,17,54,51,50,0,6,172,215,195,132,99,106,111,240,164,170,71,56,180,
+253,239,180,3,121,77,58,246,1,8,59,254,242,254,221,60,159,61,1,149,215,203,
+18,254,51,3,178,252,78,4,74,254,39,12,254,213,0,2,0,125,255,172,5,227,5,205,
+0,41,0,53,0,0,1,20,2,7,22,51,50,55,21,6,35,34,39,6,35,32,0,17,16,0,33,50,
+23,7,38,38,35,32,17,16,18,51,50,55,38,2,53,52,18,51,50,18,7,52,38,35,34,6,
+21,20,22,23,54,54,5,186,135,114,66,85,78,61,56,93,178,148,102,144,254,202,
+254,161,1,72,1,59,129,92,49,22,102,50,254,63,250,230,50,42,80,94,199,176,
+181,195,186,100,88,89,100,90,78,97,112,2,166,175,254,206,86,31,22,161,25,
+100,36,1,137,1,86,1,121,1,137,35,156,9,20,253,168,254,230,254,210,11,95,1,
+26,159,242,1,6,254,249,255,175,191,191,171,138,247,82,65,249,0,2,0,113,255,
+197,4,215,4,94,0,10,0,52,0,0,1,20,22,23,54,54,53,52,35,34,6,1,34,39,6,35,
+34,38,2,53,16,18,51,50,23,7,38,35,34,6,21,20,22,51,50,55,38,53,52,54,51,50,
+22,21,20,6,7,22,51,50,55,21,6,2,246,67,58,66,81,131,69,72,1,94,150,124,104,
+118,151,226,122,252,227,95,77,39,70,65,151,142,165,159,62,28,133,167,154,
+149,158,105,91,50,62,66,51,44,1,242,92,158,47,42,152,107,225,120,253,102,
+79,40,140,1,2,161,1,20,1,47,24,146,19,208,224,200,206,12,144,219,172,192,
+188,176,126,206,61,25,14,143,16,255,255,0,125,254,61,4,207,5,203,18,38,0,
+38,0,0,16,7,3,124,2,39,0,0,255,255,0,113,254,61,3,147,4,94,18,38,0,70,0,0,
+16,7,3,124,1,133,0,0,0,1,0,18,254,127,4,92,5,182,0,11,0,0,1,33,53,33,21,33,
+17,51,17,35,17,35,1,219,254,55,4,74,254,55,177,177,184,5,16,166,166,251,148,
+253,219,1,129,0,1,0,41,254,133,3,162,4,74,0,11,0,0,1,33,53,33,21,33,17,51,
+17,35,17,35,1,139,254,158,3,121,254,155,162,176,164,3,180,150,150,252,226,
+253,239,1,123,255,255,0,0,0,0,4,135,5,182,18,6,0,60,0,0,0,1,0,0,254,20,4,
+16,4,74,0,14,0,0,1,35,17,1,51,19,22,23,51,54,54,55,19,51,1,2,98,180,254,82,
+188,230,79,19,10,14,61,24,227,188,254,82,254,20,1,232,4,78,253,166,221,95,
+57,195,64,2,90,251,178,0,1,0,0,0,0,4,135,5,182,0,16,0,0,1,1,51,1,21,33,21,
+33,17,35,17,33,53,33,53,1,51,2,68,1,125,198,254,25,1,45,254,211,185,254,209,
+1,47,254,25,201,2,231,2,207,252,129,57,162,254,164,1,92,162,49,3,135,0,1,
+0,0,254,20,4,16,4,74,0,21,0,0,5,17,35,17,33,53,33,1,51,23,18,22,23,51,54,
+19,55,51,3,3,33,21,2,98,180,254,232,1,22,254,84,188,60,167,83,18,8,39,197,
+92,188,213,215,1,19,137,254,157,1,99,137,4,74,158,254,85,249,84,172,1,247,
+243,253,218,253,220,137,0,1,0,8,254,127,4,238,5,182,0,15,0,0,37,51,17,35,
+17,35,1,1,35,1,1,51,1,1,51,1,4,61,177,177,102,254,125,254,119,195,1,230,254,
+57,205,1,102,1,105,194,254,60,164,253,219,1,129,2,123,253,133,2,250,2,188,
+253,195,2,61,253,72,0,1,0,37,254,131,4,76,4,74,0,15,0,0,1,1,51,1,1,51,1,1,
+51,17,35,17,35,1,1,35,1,178,254,133,205,1,27,1,24,203,254,133,1,37,160,176,
+82,254,213,254,209,203,2,49,2,25,254,98,1,158,253,231,254,103,253,235,1,125,
+1,182,254,74,0,1,0,18,254,127,6,182,5,182,0,15,0,0,37,51,17,35,17,33,17,33,
+53,33,21,33,17,33,17,51,6,0,182,174,251,174,254,92,4,48,254,45,2,217,184,
+164,253,219,1,129,5,16,166,166,251,148,5,18,0,1,0,41,254,133,5,166,4,74,0,
+15,0,0,1,33,17,33,17,51,17,51,17,35,17,33,17,33,53,33,3,121,254,158,2,53,
+180,166,176,252,110,254,197,3,80,3,180,252,228,3,178,252,76,253,239,1,123,
+3,180,150,0,1,0,164,254,127,5,127,5,182,0,23,0,0,37,51,17,35,17,35,17,6,6,
+35,34,38,53,17,51,17,20,22,51,50,54,55,17,51,4,207,176,176,184,149,200,104,
+208,222,184,124,140,95,177,163,184,164,253,219,1,129,2,88,53,39,193,178,2,
+71,253,211,118,117,30,54,2,196,0,1,0,152,254,131,4,219,4,74,0,22,0,0,1,17,
+20,51,50,54,55,17,51,17,51,17,35,17,35,17,6,6,35,34,38,53,17,1,76,211,92,
+165,101,180,162,178,164,110,177,108,164,190,4,74,254,112,188,55,62,1,215,
+252,78,253,235,1,125,1,233,71,56,172,152,1,156,0,1,0,164,0,0,4,207,5,182,
+0,22,0,0,1,32,17,17,51,17,20,22,51,17,51,17,54,55,17,51,17,35,17,6,7,17,35,
+2,117,254,47,184,137,144,125,139,151,187,187,174,116,125,1,252,1,115,2,71,
+253,211,122,113,1,90,254,174,14,58,2,200,250,74,2,84,64,16,254,205,0,1,0,
+152,0,0,4,41,4,74,0,24,0,0,1,17,20,23,17,51,17,54,55,17,51,17,35,17,6,7,21,
+35,53,7,35,34,38,53,17,1,76,194,121,112,126,180,180,128,110,121,12,14,164,
+184,4,74,254,110,182,6,1,41,254,227,23,84,1,215,251,182,1,233,87,25,248,233,
+2,173,151,1,158,0,1,0,199,0,0,4,242,5,182,0,18,0,0,19,51,17,36,51,50,22,21,
+17,35,17,52,38,35,34,6,7,17,35,199,184,1,2,195,207,223,185,124,140,102,181,
+151,184,5,182,253,168,92,193,177,253,184,2,45,118,118,34,50,253,59,0,1,0,
+174,0,0,4,78,4,74,0,18,0,0,33,17,52,35,34,6,7,17,35,17,51,17,54,54,51,50,
+22,21,17,3,154,209,95,160,104,180,180,99,187,108,167,187,1,143,187,53,64,
+254,43,4,74,254,20,68,59,171,152,254,102,0,2,0,55,255,236,6,80,5,205,0,31,
+0,37,0,0,19,52,55,51,6,21,20,51,51,18,0,33,32,0,17,21,33,18,0,51,50,54,55,
+21,6,6,35,32,0,3,34,38,1,34,6,7,33,16,55,29,154,21,111,34,41,1,72,1,25,1,
+40,1,52,251,219,14,1,1,241,138,224,95,113,221,143,254,198,254,160,21,146,
+159,3,187,201,236,18,3,96,3,133,77,58,45,67,101,1,71,1,79,254,146,254,161,
+104,254,255,254,246,50,32,168,41,34,1,97,1,75,118,2,27,255,243,1,242,0,2,
+0,45,255,236,4,233,4,92,0,29,0,36,0,0,5,34,0,39,36,53,52,55,51,6,21,20,51,
+51,54,54,51,50,18,21,21,33,18,33,50,54,55,21,6,6,3,34,6,7,33,52,38,3,80,243,
+254,232,8,254,240,27,147,20,104,21,26,252,201,208,246,253,15,8,1,80,100,160,
+100,91,160,158,128,151,12,2,49,138,20,1,23,255,4,221,71,52,37,69,101,221,
+240,254,246,227,109,254,131,32,42,156,39,32,3,221,159,155,152,162,0,2,0,55,
+254,127,6,80,5,205,0,33,0,40,0,0,5,36,0,3,34,38,53,52,55,51,6,21,20,51,51,
+18,0,33,32,0,17,21,33,18,0,51,50,54,55,21,6,7,17,35,19,34,6,7,33,52,38,3,
+162,254,251,254,221,18,146,159,29,154,21,111,34,31,1,80,1,27,1,39,1,53,251,
+219,14,1,1,241,138,224,95,182,234,178,80,201,236,18,3,96,199,10,29,1,93,1,
+40,118,119,77,58,45,67,101,1,63,1,87,254,148,254,165,110,254,255,254,246,
+50,32,168,66,5,254,143,6,170,255,243,255,243,0,2,0,45,254,133,4,233,4,92,
+0,32,0,39,0,0,5,38,2,39,36,53,52,55,51,6,21,20,51,51,54,54,51,50,18,21,21,
+33,18,33,50,54,55,21,6,6,7,17,35,19,34,6,7,33,52,38,2,213,193,209,6,254,240,
+27,147,20,104,21,30,251,198,208,246,253,15,8,1,80,100,160,100,72,144,91,176,
+74,128,151,12,2,49,138,8,31,1,18,217,4,221,71,52,37,69,101,220,241,254,246,
+227,109,254,131,32,42,156,34,30,3,254,149,5,68,159,155,152,162,255,255,0,
+82,0,0,2,98,5,182,18,6,0,44,0,0,255,255,0,2,0,0,6,209,7,98,18,38,1,176,0,
+0,16,7,2,54,1,25,1,82,255,255,0,2,0,0,5,250,6,16,18,38,1,208,0,0,16,7,2,54,
+0,176,0,0,0,1,0,199,254,0,5,39,5,182,0,30,0,0,1,34,7,17,35,17,51,17,55,1,
+51,1,55,32,0,17,20,2,6,35,34,38,39,53,22,51,50,18,53,52,36,2,100,134,95,184,
+184,209,1,172,219,253,139,25,1,73,1,99,135,252,172,83,126,74,123,152,178,
+200,254,239,2,113,31,253,174,5,182,253,60,231,1,221,253,82,2,254,188,254,
+205,207,254,215,155,20,29,164,49,1,3,236,229,249,0,1,0,174,254,10,4,53,4,
+74,0,28,0,0,37,20,6,6,35,34,39,53,22,22,51,50,54,53,52,38,35,34,7,17,35,17,
+51,17,1,51,1,22,0,4,53,111,203,136,135,99,47,108,68,134,149,191,180,81,95,
+178,178,1,223,199,254,53,250,1,0,59,176,253,132,60,155,24,37,213,194,212,
+194,25,254,72,4,74,253,252,2,4,254,28,4,254,232,0,1,0,2,254,127,5,170,5,182,
+0,22,0,0,37,51,3,35,19,35,17,33,7,2,2,6,35,34,39,53,22,51,50,54,18,19,33,
+4,227,199,147,211,159,184,254,49,31,63,94,151,130,74,59,52,61,79,93,109,55,
+3,32,164,253,219,1,129,5,20,238,254,20,254,86,167,25,154,25,199,2,190,1,174,
+0,1,0,14,254,133,4,172,4,74,0,20,0,0,37,51,3,35,19,35,17,33,2,2,6,35,34,39,
+53,22,51,50,18,19,33,3,240,188,131,182,125,181,254,187,26,96,153,118,61,34,
+25,31,108,133,35,2,150,152,253,237,1,123,3,180,254,158,254,97,191,12,137,
+6,1,204,1,251,0,1,0,199,254,0,5,37,5,182,0,21,0,0,37,16,0,33,34,38,39,53,
+22,51,32,17,17,33,17,35,17,51,17,33,17,51,5,37,254,228,254,253,84,125,76,
+123,140,1,127,253,16,184,184,2,240,182,143,254,195,254,174,20,29,162,49,1,
+233,2,31,253,86,5,182,253,150,2,106,0,1,0,174,254,10,4,106,4,74,0,21,0,0,
+1,34,39,53,22,51,50,54,53,17,33,17,35,17,51,17,33,17,51,17,16,2,2,209,134,
+95,110,105,125,116,253,174,180,180,2,82,182,214,254,10,58,159,59,196,197,
+1,184,254,23,4,74,254,55,1,201,251,231,254,244,254,229,0,1,0,199,254,127,
+5,238,5,182,0,15,0,0,37,51,3,35,19,35,17,33,17,35,17,51,17,33,17,51,5,37,
+201,150,211,160,182,253,16,184,184,2,240,182,164,253,219,1,129,2,170,253,
+86,5,182,253,150,2,106,0,1,0,174,254,133,5,39,4,74,0,15,0,0,1,17,33,17,51,
+17,51,3,35,19,35,17,33,17,35,17,1,98,2,84,180,189,131,184,126,180,253,172,
+180,4,74,254,55,1,201,252,78,253,237,1,123,1,233,254,23,4,74,0,1,0,164,254,
+127,4,207,5,182,0,23,0,0,33,35,17,35,17,51,17,6,6,35,34,38,53,17,51,17,20,
+22,51,50,54,55,17,51,4,207,178,176,170,149,200,104,208,222,184,124,140,95,
+177,163,184,254,127,2,37,1,180,53,39,193,178,2,71,253,211,118,117,30,54,2,
+196,0,1,0,152,254,131,4,57,4,74,0,22,0,0,1,17,20,51,50,54,55,17,51,17,35,
+17,35,17,51,17,6,6,35,34,38,53,17,1,76,211,92,165,101,180,161,177,158,110,
+177,108,164,190,4,74,254,112,188,55,62,1,215,251,182,254,131,2,21,1,81,71,
+56,172,152,1,156,0,1,0,199,254,127,7,66,5,182,0,24,0,0,33,1,35,23,22,21,17,
+35,17,33,1,51,1,33,17,51,3,35,19,35,17,52,55,35,1,3,76,254,30,8,7,8,170,1,
+16,1,197,8,1,201,1,14,199,148,213,162,182,14,8,254,24,5,2,132,152,93,252,
+119,5,182,251,82,4,174,250,238,253,219,1,129,3,150,131,231,251,0,0,1,0,174,
+254,133,6,4,4,74,0,25,0,0,37,54,55,1,51,17,51,3,35,19,35,17,7,7,1,35,1,38,
+38,39,17,35,17,51,1,22,2,246,30,46,1,30,232,188,131,184,127,162,19,63,254,
+238,146,254,238,19,52,7,162,225,1,31,37,172,109,116,2,189,252,78,253,237,
+1,123,3,137,59,172,253,94,2,166,45,154,28,252,119,4,74,253,67,93,255,255,
+0,82,0,0,2,98,5,182,18,6,0,44,0,0,255,255,0,0,0,0,5,27,7,98,18,38,0,36,0,
+0,16,7,2,54,0,61,1,82,255,255,0,94,255,236,3,215,6,16,18,38,0,68,0,0,16,6,
+2,54,241,0,255,255,0,0,0,0,5,27,7,41,18,38,0,36,0,0,16,7,0,106,0,63,1,82,
+255,255,0,94,255,236,3,215,5,215,18,38,0,68,0,0,16,6,0,106,245,0,255,255,
+255,254,0,0,6,145,5,182,18,6,0,136,0,0,255,255,0,94,255,236,6,129,4,94,18,
+6,0,168,0,0,255,255,0,199,0,0,3,248,7,98,18,38,0,40,0,0,16,7,2,54,0,14,1,
+82,255,255,0,113,255,236,4,27,6,16,18,38,0,72,0,0,16,6,2,54,12,0,0,2,0,121,
+255,236,5,106,5,205,0,19,0,26,0,0,1,34,7,53,54,54,51,32,0,17,16,0,33,32,0,
+17,53,33,2,0,3,50,18,55,33,20,22,2,168,225,242,125,218,128,1,76,1,114,254,
+165,254,200,254,211,254,207,4,47,17,254,254,190,205,244,16,252,149,201,5,
+43,84,168,44,34,254,112,254,156,254,162,254,113,1,121,1,118,70,1,3,1,7,251,
+98,1,5,237,255,243,255,255,0,104,255,236,4,18,4,94,18,6,4,72,0,0,255,255,
+0,121,255,236,5,106,7,41,18,38,2,222,0,0,16,7,0,106,0,115,1,82,255,255,0,
+104,255,236,4,18,5,215,18,38,4,72,0,0,16,6,0,106,196,0,255,255,0,2,0,0,6,
+209,7,41,18,38,1,176,0,0,16,7,0,106,1,23,1,82,255,255,0,2,0,0,5,250,5,215,
+18,38,1,208,0,0,16,7,0,106,0,172,0,0,255,255,0,78,255,236,4,70,7,41,18,38,
+1,177,0,0,16,7,0,106,255,249,1,82,255,255,0,68,255,236,3,143,5,215,18,38,
+1,209,0,0,16,6,0,106,142,0,0,1,0,72,255,236,4,59,5,182,0,24,0,0,1,4,4,21,
+20,4,33,32,39,53,22,22,51,50,54,53,16,33,35,53,1,33,53,33,21,2,8,1,20,1,31,
+254,202,254,233,254,253,163,100,226,98,199,196,254,65,137,1,225,253,93,3,
+141,3,66,11,212,193,207,231,79,168,48,48,150,139,1,8,150,1,208,164,145,0,
+1,0,29,254,20,3,182,4,74,0,25,0,0,1,22,4,21,20,6,6,35,34,39,53,22,51,50,54,
+53,52,38,35,35,53,1,33,53,33,21,1,190,235,1,13,134,249,159,239,140,183,204,
+162,192,208,206,120,1,192,253,141,3,70,1,211,16,248,201,144,226,124,72,164,
+86,185,155,157,169,125,1,241,152,131,255,255,0,201,0,0,5,96,6,188,18,38,1,
+178,0,0,16,7,1,77,0,182,1,82,255,255,0,174,0,0,4,117,5,106,18,38,1,210,0,
+0,16,6,1,77,55,0,255,255,0,201,0,0,5,96,7,41,18,38,1,178,0,0,16,7,0,106,0,
+193,1,82,255,255,0,174,0,0,4,117,5,215,18,38,1,210,0,0,16,6,0,106,66,0,255,
+255,0,125,255,236,5,195,7,41,18,38,0,50,0,0,16,7,0,106,0,207,1,82,255,255,
+0,113,255,236,4,104,5,215,18,38,0,82,0,0,16,6,0,106,27,0,255,255,0,125,255,
+236,5,195,5,205,18,6,2,123,0,0,255,255,0,113,255,236,4,104,4,94,18,6,2,124,
+0,0,255,255,0,125,255,236,5,195,7,41,18,38,2,123,0,0,16,7,0,106,0,207,1,82,
+255,255,0,113,255,236,4,104,5,215,18,38,2,124,0,0,16,6,0,106,25,0,255,255,
+0,61,255,236,4,145,7,41,18,38,1,199,0,0,16,7,0,106,255,202,1,82,255,255,0,
+59,255,236,3,131,5,215,18,38,1,231,0,0,16,7,0,106,255,83,0,0,255,255,0,23,
+255,236,4,254,6,188,18,38,1,189,0,0,16,7,1,77,0,47,1,82,255,255,0,2,254,20,
+4,20,5,106,18,38,0,92,0,0,16,6,1,77,179,0,255,255,0,23,255,236,4,254,7,41,
+18,38,1,189,0,0,16,7,0,106,0,57,1,82,255,255,0,2,254,20,4,20,5,215,18,38,
+0,92,0,0,16,6,0,106,187,0,255,255,0,23,255,236,4,254,7,115,18,38,1,189,0,
+0,16,7,1,83,0,145,1,82,255,255,0,2,254,20,4,20,6,33,18,38,0,92,0,0,16,6,1,
+83,10,0,255,255,0,164,0,0,4,207,7,41,18,38,1,193,0,0,16,7,0,106,0,104,1,82,
+255,255,0,152,0,0,4,57,5,215,18,38,1,225,0,0,16,6,0,106,23,0,0,1,0,199,254,
+127,4,14,5,182,0,9,0,0,19,33,21,33,17,51,17,35,17,35,199,3,71,253,113,174,
+174,184,5,182,164,251,146,253,219,1,129,0,1,0,174,254,133,3,74,4,74,0,9,0,
+0,19,33,21,33,17,51,17,35,17,35,174,2,156,254,24,162,178,164,4,74,150,252,
+226,253,239,1,123,255,255,0,199,0,0,6,23,7,41,18,38,1,197,0,0,16,7,0,106,
+1,29,1,82,255,255,0,174,0,0,5,139,5,215,18,38,1,229,0,0,16,7,0,106,0,201,
+0,0,255,255,0,47,254,106,4,14,5,182,18,38,2,152,0,0,16,7,3,125,0,156,0,0,
+0,1,0,16,254,106,3,78,4,74,0,25,0,0,1,34,39,53,22,51,50,53,53,35,17,35,53,
+51,17,33,21,33,17,33,21,33,17,51,17,16,1,14,60,63,46,57,98,176,156,156,2,
+162,254,18,1,88,254,168,158,254,106,25,150,19,107,143,1,221,139,1,226,152,
+254,182,139,254,174,254,240,254,239,0,1,0,8,254,106,4,223,5,182,0,23,0,0,
+1,34,39,53,22,51,50,53,53,35,1,1,35,1,1,51,1,1,51,1,1,51,17,16,3,240,60,63,
+46,56,98,102,254,125,254,119,195,1,230,254,57,205,1,102,1,105,194,254,60,
+1,126,160,254,106,25,150,19,107,143,2,123,253,133,2,250,2,188,253,195,2,61,
+253,72,253,166,254,215,254,239,0,1,0,37,254,106,4,72,4,74,0,23,0,0,1,34,39,
+53,22,51,50,53,53,35,1,1,35,1,1,51,1,1,51,1,1,51,17,16,3,88,61,62,46,57,98,
+92,254,213,254,209,203,1,141,254,133,205,1,27,1,24,203,254,133,1,43,150,254,
+106,25,150,19,107,143,1,182,254,74,2,49,2,25,254,98,1,158,253,231,254,90,
+254,240,254,239,0,1,0,6,0,0,4,168,5,182,0,17,0,0,19,33,1,51,1,1,51,1,33,21,
+33,1,35,1,1,35,1,33,125,1,51,254,119,205,1,102,1,103,196,254,117,1,57,254,
+189,1,184,209,254,125,254,119,197,1,184,254,191,3,86,2,96,253,193,2,63,253,
+160,162,253,76,2,123,253,133,2,180,0,1,0,37,0,0,4,23,4,74,0,17,0,0,19,33,
+1,51,1,1,51,1,33,21,33,1,35,1,1,35,1,33,115,1,12,254,184,205,1,27,1,24,203,
+254,182,1,19,254,233,1,99,205,254,213,254,209,203,1,96,254,238,2,123,1,207,
+254,98,1,158,254,49,139,254,16,1,182,254,74,1,240,0,2,0,127,0,0,4,59,5,182,
+0,9,0,18,0,0,19,16,33,51,17,51,17,33,32,36,1,35,34,6,21,20,22,51,51,127,2,
+70,190,184,254,97,254,245,254,238,3,4,176,217,189,183,194,205,1,168,1,164,
+2,106,250,74,212,1,216,121,137,141,127,255,255,0,113,255,236,4,61,6,20,18,
+6,0,71,0,0,0,2,0,127,255,236,6,125,5,182,0,24,0,34,0,0,5,34,38,53,52,36,33,
+51,17,51,17,20,51,50,54,53,17,51,17,20,6,35,34,39,6,19,35,34,6,21,16,33,50,
+54,53,2,76,227,234,1,40,1,34,141,184,224,102,115,182,214,185,232,98,112,34,
+143,207,187,1,23,122,136,18,211,210,217,224,2,106,251,183,226,123,109,1,221,
+254,26,178,204,167,165,2,188,135,146,254,250,116,105,0,2,0,111,255,236,6,
+141,6,20,0,32,0,44,0,0,37,50,54,53,17,51,17,20,6,35,34,38,39,6,6,35,34,2,
+17,16,18,51,50,22,23,51,39,39,17,51,17,20,22,33,50,54,55,53,52,38,35,32,17,
+20,22,4,252,114,105,182,205,192,130,156,46,83,181,125,213,235,231,205,105,
+160,60,13,7,4,179,105,253,188,154,142,3,143,159,254,234,136,129,130,134,1,
+51,254,189,201,194,87,107,110,86,1,41,1,12,1,13,1,48,77,85,78,84,1,182,251,
+136,151,132,176,205,35,226,196,254,88,208,206,0,1,0,72,255,236,6,131,5,203,
+0,42,0,0,1,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,
+21,4,19,22,22,51,50,54,53,17,51,17,20,6,35,34,38,39,38,38,1,168,199,191,189,
+210,147,129,99,179,97,92,97,243,131,217,246,177,155,1,98,6,2,104,122,116,
+109,180,213,192,202,214,2,2,207,2,168,149,143,130,106,123,57,66,123,74,78,
+196,165,141,186,25,8,51,254,211,144,125,120,132,1,199,254,41,200,197,209,
+204,147,140,0,1,0,78,255,236,5,211,4,94,0,37,0,0,37,50,17,17,51,17,20,6,35,
+32,3,38,38,35,35,53,51,32,53,52,35,34,6,7,39,54,54,51,50,22,21,20,7,21,22,
+22,23,22,4,74,215,178,192,199,254,126,14,5,143,146,142,115,1,33,234,78,140,
+79,59,82,170,110,187,215,195,106,118,6,4,131,1,6,1,51,254,189,202,195,1,73,
+100,89,147,168,156,36,34,143,39,37,155,134,186,57,8,21,125,100,201,0,1,0,
+72,254,127,4,225,5,203,0,36,0,0,1,20,6,7,21,22,22,21,21,51,17,35,17,35,17,
+52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,39,54,54,51,50,22,4,12,186,
+162,183,194,184,176,186,230,231,203,207,201,223,160,133,103,187,107,45,47,
+101,251,135,223,254,4,98,141,183,26,8,25,179,146,250,253,219,1,129,1,158,
+131,135,149,143,130,106,123,56,67,63,60,75,77,196,0,1,0,78,254,133,4,43,4,
+92,0,30,0,0,1,52,33,35,53,51,32,53,52,38,35,34,7,39,54,51,50,22,21,20,7,21,
+22,22,21,21,51,17,35,17,35,2,215,254,203,152,121,1,57,130,115,153,159,65,
+170,207,192,217,202,128,109,168,176,164,1,47,193,149,166,78,80,72,143,76,
+155,136,182,57,11,38,137,99,151,253,239,1,123,0,1,0,0,255,233,7,43,5,182,
+0,32,0,0,1,33,2,2,6,6,35,34,39,53,22,51,50,54,18,18,19,33,17,20,22,51,50,
+53,17,51,17,20,6,35,34,38,53,4,6,254,84,57,78,81,141,110,69,66,52,61,59,81,
+62,84,52,2,251,108,112,221,180,207,194,199,205,5,18,254,54,254,18,250,119,
+25,154,27,109,1,23,2,34,1,143,251,205,131,115,252,1,199,254,41,192,205,203,
+196,0,1,0,14,255,236,6,59,4,74,0,29,0,0,1,20,22,51,50,17,17,51,17,20,6,35,
+34,38,53,17,33,2,2,6,35,34,39,53,22,51,50,18,19,33,3,223,102,115,207,180,
+193,192,197,202,254,203,26,96,153,118,61,34,25,31,108,133,35,2,133,1,129,
+130,124,1,4,1,53,254,189,202,195,200,199,2,57,254,158,254,97,191,12,137,6,
+1,204,1,251,0,1,0,199,255,236,7,102,5,182,0,25,0,0,5,34,38,53,17,33,17,35,
+17,51,17,33,17,51,17,20,22,51,50,54,53,17,51,17,20,6,5,215,199,202,253,57,
+184,184,2,199,182,108,111,110,109,180,205,20,203,198,1,45,253,86,5,182,253,
+150,2,106,251,207,131,117,120,132,1,199,254,41,192,205,0,1,0,174,255,236,
+6,176,4,74,0,24,0,0,1,17,33,17,51,17,20,22,51,50,17,17,51,17,20,6,35,34,38,
+53,53,33,17,35,17,1,98,2,62,180,104,115,207,178,192,193,196,203,253,194,180,
+4,74,254,55,1,201,253,57,131,125,1,6,1,51,254,189,202,195,205,194,110,254,
+23,4,74,0,1,0,125,255,236,5,162,5,203,0,29,0,0,1,33,21,16,0,33,32,0,17,52,
+18,36,51,50,22,23,7,38,38,35,32,0,17,16,0,51,50,54,53,33,3,98,2,64,254,204,
+254,197,254,185,254,145,179,1,84,233,121,232,93,70,89,207,97,254,253,254,
+228,1,10,240,210,216,254,129,2,246,88,254,163,254,171,1,144,1,97,229,1,85,
+180,48,42,158,39,47,254,200,254,234,254,228,254,204,228,229,0,1,0,113,255,
+236,4,182,4,94,0,25,0,0,1,33,21,16,33,32,0,17,16,0,33,50,23,7,38,35,34,6,
+21,20,22,51,50,54,53,33,2,176,2,6,253,248,254,236,254,215,1,66,1,34,221,170,
+61,168,166,204,218,198,189,166,172,254,176,2,72,70,253,234,1,41,1,14,1,15,
+1,44,80,141,74,221,203,206,214,156,151,0,1,0,18,255,236,4,254,5,182,0,20,
+0,0,19,53,33,21,33,17,20,22,51,50,53,17,51,17,20,6,35,34,38,53,17,18,4,62,
+254,53,115,112,224,182,211,195,201,210,5,16,166,166,252,115,131,117,252,1,
+201,254,41,192,205,203,196,3,149,0,1,0,41,255,236,4,154,4,74,0,20,0,0,5,34,
+38,53,17,33,53,33,21,33,17,20,22,51,50,54,53,17,51,17,16,3,20,195,206,254,
+166,3,106,254,164,106,115,104,107,179,20,202,197,2,59,148,148,253,205,131,
+125,122,134,1,57,254,189,254,115,0,1,0,109,255,236,4,100,5,203,0,39,0,0,19,
+52,36,51,50,22,23,7,38,38,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,50,
+55,21,6,33,32,36,53,52,54,55,53,38,38,154,1,12,227,137,226,112,98,103,180,
+106,141,154,208,206,207,205,223,234,199,182,237,199,175,254,245,254,243,254,
+214,207,186,170,178,4,92,169,198,69,75,131,66,53,121,108,123,141,152,139,
+133,139,136,92,170,77,220,199,150,191,22,8,25,178,255,255,0,88,255,236,3,
+152,4,94,18,6,1,130,0,0,0,1,0,2,254,106,5,131,5,182,0,30,0,0,1,34,39,53,22,
+51,50,53,53,35,17,33,7,2,2,6,35,34,39,53,22,51,50,54,18,19,33,17,51,17,16,
+4,147,59,63,46,56,98,182,254,49,31,63,94,151,130,74,59,52,61,79,93,109,55,
+3,32,160,254,106,25,150,19,107,143,5,20,238,254,20,254,86,167,25,154,25,199,
+2,190,1,174,250,238,254,215,254,239,0,1,0,14,254,106,4,145,4,74,0,28,0,0,
+1,34,39,53,22,51,50,53,53,35,17,33,2,2,6,35,34,39,53,22,51,50,18,19,33,17,
+51,17,16,3,162,60,63,46,56,99,181,254,189,28,95,153,119,65,30,21,35,110,131,
+37,2,150,159,254,106,25,150,19,107,143,3,180,254,152,254,101,191,14,135,8,
+1,208,1,251,252,65,254,240,254,239,255,255,0,0,254,152,5,27,5,188,18,38,0,
+36,0,0,16,7,2,100,4,242,0,0,255,255,0,94,254,152,3,215,4,92,18,38,0,68,0,
+0,16,7,2,100,4,96,0,0,255,255,0,0,0,0,5,27,7,227,18,38,0,36,0,0,16,7,2,99,
+4,254,1,82,255,255,0,94,255,236,3,215,6,145,18,38,0,68,0,0,16,7,2,99,4,168,
+0,0,255,255,0,0,0,0,5,27,7,209,18,38,0,36,0,0,16,7,3,116,4,233,1,82,255,255,
+0,94,255,236,4,84,6,127,18,38,0,68,0,0,16,7,3,116,4,152,0,0,255,255,0,0,0,
+0,5,27,7,209,18,38,0,36,0,0,16,7,3,117,4,227,1,82,255,255,0,37,255,236,3,
+215,6,127,18,38,0,68,0,0,16,7,3,117,4,152,0,0,255,255,0,0,0,0,5,27,8,74,18,
+38,0,36,0,0,16,7,3,118,4,223,1,82,255,255,0,94,255,236,4,37,6,248,18,38,0,
+68,0,0,16,7,3,118,4,160,0,0,0,4,0,0,0,0,5,27,8,98,0,7,0,13,0,37,0,52,0,0,
+33,3,33,3,35,1,51,1,1,3,39,6,7,3,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,
+51,50,54,55,51,6,6,19,35,38,39,6,7,35,53,55,54,55,51,22,22,23,4,92,176,253,
+188,174,186,2,59,166,2,58,254,90,164,70,30,33,166,1,112,36,71,67,64,28,40,
+42,14,93,13,100,76,37,73,69,62,27,40,42,12,92,11,101,100,98,102,111,92,121,
+98,54,111,54,184,48,119,52,1,197,254,59,5,188,250,68,2,104,1,187,219,120,
+99,254,69,5,29,29,36,29,46,50,106,115,29,36,29,47,49,106,115,254,166,66,98,
+83,81,23,60,121,79,69,133,58,255,255,0,94,255,236,3,215,7,16,18,38,0,68,0,
+0,16,7,3,119,4,150,0,0,255,255,0,0,254,152,5,27,7,115,18,38,0,36,0,0,16,39,
+2,100,4,242,0,0,16,7,1,75,0,47,1,82,255,255,0,94,254,152,3,215,6,33,18,38,
+0,68,0,0,16,39,2,100,4,129,0,0,16,6,1,75,216,0,255,255,0,0,0,0,5,27,8,19,
+18,38,0,36,0,0,16,7,3,120,4,242,1,82,255,255,0,94,255,236,3,215,6,193,18,
+38,0,68,0,0,16,7,3,120,4,158,0,0,255,255,0,0,0,0,5,27,8,19,18,38,0,36,0,0,
+16,7,3,121,4,240,1,82,255,255,0,94,255,236,3,215,6,193,18,38,0,68,0,0,16,
+7,3,121,4,156,0,0,255,255,0,0,0,0,5,27,8,88,18,38,0,36,0,0,16,7,3,122,4,240,
+1,82,255,255,0,94,255,236,3,215,7,6,18,38,0,68,0,0,16,7,3,122,4,164,0,0,0,
+4,0,0,0,0,5,27,8,94,0,7,0,13,0,37,0,50,0,0,33,3,33,3,35,1,51,1,1,3,39,6,7,
+3,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,6,6,3,32,3,51,22,
+22,51,50,54,55,51,6,6,4,92,176,253,188,174,186,2,59,166,2,58,254,90,164,70,
+30,33,166,1,112,36,71,67,64,28,40,42,14,93,13,100,76,37,73,69,62,27,40,42,
+12,92,11,101,221,254,232,19,108,7,79,107,98,88,8,109,13,156,1,197,254,59,
+5,188,250,68,2,104,1,187,219,120,99,254,69,5,29,29,36,29,46,50,104,113,29,
+36,29,47,49,103,114,254,166,1,8,69,60,64,65,130,134,255,255,0,94,255,236,
+3,215,7,12,18,38,0,68,0,0,16,7,3,123,4,156,0,0,255,255,0,0,254,152,5,27,7,
+78,18,38,0,36,0,0,16,39,1,78,0,49,1,98,16,7,2,100,4,242,0,0,255,255,0,94,
+254,152,3,215,5,236,18,38,0,68,0,0,16,38,1,78,220,0,16,7,2,100,4,127,0,0,
+255,255,0,199,254,152,3,248,5,182,18,38,0,40,0,0,16,7,2,100,4,195,0,0,255,
+255,0,113,254,152,4,27,4,94,18,38,0,72,0,0,16,7,2,100,4,186,0,0,255,255,0,
+199,0,0,3,248,7,227,18,38,0,40,0,0,16,7,2,99,4,207,1,82,255,255,0,113,255,
+236,4,27,6,145,18,38,0,72,0,0,16,7,2,99,4,201,0,0,255,255,0,199,0,0,3,248,
+7,51,18,38,0,40,0,0,16,7,1,82,255,230,1,82,255,255,0,113,255,236,4,27,5,225,
+18,38,0,72,0,0,16,6,1,82,214,0,255,255,0,199,0,0,4,122,7,209,18,38,0,40,0,
+0,16,7,3,116,4,190,1,82,255,255,0,113,255,236,4,108,6,127,18,38,0,72,0,0,
+16,7,3,116,4,176,0,0,255,255,0,78,0,0,3,248,7,209,18,38,0,40,0,0,16,7,3,117,
+4,193,1,82,255,255,0,63,255,236,4,27,6,127,18,38,0,72,0,0,16,7,3,117,4,178,
+0,0,255,255,0,199,0,0,4,65,8,74,18,38,0,40,0,0,16,7,3,118,4,188,1,82,255,
+255,0,113,255,236,4,43,6,248,18,38,0,72,0,0,16,7,3,118,4,166,0,0,0,3,0,199,
+0,0,3,248,8,98,0,11,0,35,0,50,0,0,33,33,17,33,21,33,17,33,21,33,17,33,1,34,
+46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,6,6,19,35,38,39,6,7,35,
+53,55,54,55,51,22,22,23,3,248,252,207,3,49,253,135,2,84,253,172,2,121,254,
+237,36,71,67,64,28,40,42,14,93,13,100,76,37,73,69,62,27,40,42,12,92,11,101,
+100,98,102,111,92,121,98,54,111,54,184,48,119,52,5,182,162,254,56,160,253,
+246,6,227,29,36,29,46,50,106,115,29,36,29,47,49,106,115,254,166,66,98,83,
+81,23,60,121,79,69,133,58,255,255,0,113,255,236,4,27,7,16,18,38,0,72,0,0,
+16,7,3,119,4,166,0,0,255,255,0,199,254,152,3,248,7,115,18,38,0,40,0,0,16,
+39,2,100,4,193,0,0,16,7,1,75,0,0,1,82,255,255,0,113,254,152,4,27,6,33,18,
+38,0,72,0,0,16,39,2,100,4,180,0,0,16,6,1,75,243,0,255,255,0,82,0,0,2,98,7,
+227,18,38,0,44,0,0,16,7,2,99,3,203,1,82,255,255,0,123,0,0,1,238,6,145,18,
+38,0,243,0,0,16,7,2,99,3,119,0,0,255,255,0,82,254,152,2,98,5,182,18,38,0,
+44,0,0,16,7,2,100,3,188,0,0,255,255,0,155,254,152,1,115,5,229,18,38,0,76,
+0,0,16,7,2,100,3,106,0,0,255,255,0,125,254,152,5,195,5,205,18,38,0,50,0,0,
+16,7,2,100,5,131,0,0,255,255,0,113,254,152,4,104,4,94,18,38,0,82,0,0,16,7,
+2,100,4,205,0,0,255,255,0,125,255,236,5,195,7,227,18,38,0,50,0,0,16,7,2,99,
+5,143,1,82,255,255,0,113,255,236,4,104,6,145,18,38,0,82,0,0,16,7,2,99,4,217,
+0,0,255,255,0,125,255,236,5,195,7,209,18,38,0,50,0,0,16,7,3,116,5,125,1,82,
+255,255,0,113,255,236,4,131,6,127,18,38,0,82,0,0,16,7,3,116,4,199,0,0,255,
+255,0,125,255,236,5,195,7,209,18,38,0,50,0,0,16,7,3,117,5,125,1,82,255,255,
+0,84,255,236,4,104,6,127,18,38,0,82,0,0,16,7,3,117,4,199,0,0,255,255,0,125,
+255,236,5,195,8,74,18,38,0,50,0,0,16,7,3,118,5,123,1,82,255,255,0,113,255,
+236,4,104,6,248,18,38,0,82,0,0,16,7,3,118,4,199,0,0,0,4,0,125,255,236,5,195,
+8,98,0,11,0,23,0,47,0,62,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,16,18,51,50,
+18,17,16,2,35,34,2,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,
+6,6,19,35,38,39,6,7,35,53,55,54,55,51,22,22,23,5,195,254,157,254,193,254,
+189,254,159,1,95,1,71,1,62,1,98,251,124,246,236,235,244,242,235,238,246,2,
+103,36,71,67,64,28,40,42,14,93,13,100,76,37,73,69,62,27,40,42,12,92,11,101,
+100,98,102,111,92,121,98,54,111,54,184,48,119,52,2,221,254,161,254,110,1,
+139,1,104,1,101,1,137,254,113,254,159,254,222,254,208,1,44,1,38,1,37,1,41,
+254,211,3,135,29,36,29,46,50,106,115,29,36,29,47,49,106,115,254,166,66,98,
+83,81,23,60,121,79,69,133,58,255,255,0,113,255,236,4,104,7,16,18,38,0,82,
+0,0,16,7,3,119,4,197,0,0,255,255,0,125,254,152,5,195,7,115,18,38,0,50,0,0,
+16,39,2,100,5,131,0,0,16,7,1,75,0,193,1,82,255,255,0,113,254,152,4,104,6,
+33,18,38,0,82,0,0,16,39,2,100,4,209,0,0,16,6,1,75,12,0,255,255,0,125,255,
+236,6,113,7,115,18,38,2,92,0,0,16,7,0,118,1,41,1,82,255,255,0,113,255,236,
+5,43,6,33,18,38,2,93,0,0,16,6,0,118,109,0,255,255,0,125,255,236,6,113,7,115,
+18,38,2,92,0,0,16,7,0,67,0,131,1,82,255,255,0,113,255,236,5,43,6,33,18,38,
+2,93,0,0,16,6,0,67,208,0,255,255,0,125,255,236,6,113,7,227,18,38,2,92,0,0,
+16,7,2,99,5,145,1,82,255,255,0,113,255,236,5,43,6,145,18,38,2,93,0,0,16,7,
+2,99,4,217,0,0,255,255,0,125,255,236,6,113,7,51,18,38,2,92,0,0,16,7,1,82,
+0,164,1,82,255,255,0,113,255,236,5,43,5,225,18,38,2,93,0,0,16,6,1,82,249,
+0,255,255,0,125,254,152,6,113,6,20,18,38,2,92,0,0,16,7,2,100,5,127,0,0,255,
+255,0,113,254,152,5,43,4,242,18,38,2,93,0,0,16,7,2,100,4,205,0,0,255,255,
+0,184,254,152,5,31,5,182,18,38,0,56,0,0,16,7,2,100,5,80,0,0,255,255,0,162,
+254,152,4,68,4,74,18,38,0,88,0,0,16,7,2,100,4,195,0,0,255,255,0,184,255,236,
+5,31,7,227,18,38,0,56,0,0,16,7,2,99,5,84,1,82,255,255,0,162,255,236,4,68,
+6,145,18,38,0,88,0,0,16,7,2,99,4,215,0,0,255,255,0,184,255,236,6,139,7,115,
+18,38,2,94,0,0,16,7,0,118,0,242,1,82,255,255,0,162,255,236,5,170,6,33,18,
+38,2,95,0,0,16,6,0,118,125,0,255,255,0,184,255,236,6,139,7,115,18,38,2,94,
+0,0,16,7,0,67,0,82,1,82,255,255,0,162,255,236,5,170,6,33,18,38,2,95,0,0,16,
+6,0,67,185,0,255,255,0,184,255,236,6,139,7,227,18,38,2,94,0,0,16,7,2,99,5,
+96,1,82,255,255,0,162,255,236,5,170,6,145,18,38,2,95,0,0,16,7,2,99,4,221,
+0,0,255,255,0,184,255,236,6,139,7,51,18,38,2,94,0,0,16,7,1,82,0,129,1,82,
+255,255,0,162,255,236,5,170,5,225,18,38,2,95,0,0,16,6,1,82,2,0,255,255,0,
+184,254,152,6,139,6,20,18,38,2,94,0,0,16,7,2,100,5,80,0,0,255,255,0,162,254,
+152,5,170,4,244,18,38,2,95,0,0,16,7,2,100,4,186,0,0,255,255,0,0,254,152,4,
+135,5,182,18,38,0,60,0,0,16,7,2,100,4,164,0,0,255,255,0,2,254,20,4,20,4,74,
+18,38,0,92,0,0,16,7,2,100,5,176,255,255,255,255,0,0,0,0,4,135,7,227,18,38,
+0,60,0,0,16,7,2,99,4,174,1,82,255,255,0,2,254,20,4,20,6,145,18,38,0,92,0,
+0,16,7,2,99,4,111,0,0,255,255,0,0,0,0,4,135,7,51,18,38,0,60,0,0,16,7,1,82,
+255,202,1,82,255,255,0,2,254,20,4,20,5,225,18,38,0,92,0,0,16,6,1,82,148,0,
+255,255,0,113,254,197,4,217,6,20,18,38,0,211,0,0,16,7,0,66,0,182,0,0,0,2,
+251,219,4,217,254,186,6,33,0,9,0,19,0,0,1,35,38,38,39,53,51,22,22,23,5,35,
+38,38,39,53,51,22,22,23,254,186,102,60,176,36,198,28,99,49,254,152,102,65,
+175,33,199,28,99,49,4,217,48,199,60,21,61,174,68,25,52,200,55,21,61,174,68,
+0,2,252,106,4,217,255,188,6,127,0,13,0,21,0,0,1,35,38,39,6,7,35,53,54,54,
+55,51,22,23,39,54,55,51,21,6,7,35,254,217,100,112,99,114,97,101,51,119,48,
+188,71,146,80,73,54,180,81,123,103,4,217,75,91,101,65,25,58,135,69,103,159,
+194,91,112,21,108,98,0,2,251,141,4,217,254,223,6,127,0,13,0,21,0,0,1,35,38,
+39,6,7,35,53,55,54,55,51,22,23,37,35,38,39,53,51,22,23,254,223,102,97,114,
+106,105,100,53,113,51,190,62,155,253,223,98,121,86,178,57,70,4,217,65,101,
+96,70,23,61,127,74,89,173,172,91,115,21,117,88,0,2,252,106,4,217,255,133,
+6,248,0,13,0,30,0,0,1,35,38,39,6,7,35,53,54,54,55,51,22,23,19,20,7,7,35,39,
+54,54,53,52,35,34,7,53,54,51,50,254,217,100,112,99,114,97,101,51,119,48,188,
+71,146,172,127,6,84,10,59,62,99,47,24,24,56,196,4,217,75,91,101,65,25,58,
+135,69,103,159,1,120,102,29,79,129,9,31,37,62,6,84,6,0,2,252,102,4,217,254,
+233,7,16,0,23,0,38,0,0,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,
+51,6,6,19,35,38,39,6,7,35,53,55,54,55,51,22,22,23,254,45,36,71,67,64,28,40,
+42,14,93,13,100,76,37,73,69,62,27,40,42,12,92,11,101,100,98,102,111,92,121,
+98,54,111,54,184,48,119,52,6,51,29,36,29,46,50,106,115,29,36,29,47,49,106,
+115,254,166,66,98,83,81,23,60,121,79,69,133,58,0,2,252,113,4,217,254,205,
+6,193,0,7,0,21,0,0,1,54,55,51,21,6,7,35,19,34,38,39,51,22,22,51,50,54,55,
+51,6,6,253,90,84,43,178,89,116,100,66,146,146,7,108,7,81,105,93,93,8,109,
+13,159,5,244,111,94,21,117,90,254,252,142,126,71,62,67,66,131,137,0,2,252,
+113,4,217,254,205,6,193,0,7,0,20,0,0,1,35,38,39,53,51,22,23,3,32,3,51,22,
+22,51,50,54,55,51,6,6,253,213,98,119,86,178,46,79,57,254,232,19,108,7,81,
+105,96,90,8,109,13,157,5,221,94,113,21,101,104,254,229,1,12,71,62,65,68,132,
+136,0,2,252,113,4,217,254,205,7,6,0,16,0,29,0,0,1,20,7,7,35,39,54,54,53,52,
+35,34,7,53,54,51,50,3,32,3,51,22,22,51,50,54,55,51,6,6,254,49,125,6,84,10,
+57,62,97,37,36,22,62,192,149,254,232,19,108,7,81,105,96,90,8,109,13,157,6,
+121,99,30,41,92,9,32,35,61,6,80,8,253,211,1,12,71,62,65,68,132,136,0,2,252,
+102,4,217,254,233,7,12,0,23,0,36,0,0,1,34,46,2,35,34,6,7,35,54,54,51,50,30,
+2,51,50,54,55,51,6,6,3,32,3,51,22,22,51,50,54,55,51,6,6,254,45,36,71,67,64,
+28,40,42,14,93,13,100,76,37,73,69,62,27,40,42,12,92,11,101,221,254,232,19,
+108,7,79,107,98,88,8,109,13,156,6,51,29,36,29,46,50,104,113,29,36,29,47,49,
+103,114,254,166,1,8,69,60,64,65,130,134,0,1,0,45,254,61,1,113,0,0,0,15,0,
+0,23,52,39,51,22,21,20,6,35,34,39,53,22,51,50,54,221,139,127,160,105,100,
+64,55,35,53,37,51,238,103,135,119,135,91,106,17,115,11,47,0,1,0,25,254,106,
+1,131,0,164,0,11,0,0,19,34,39,53,22,51,50,53,17,51,17,16,147,59,63,46,56,
+98,162,254,106,25,150,19,107,1,51,254,215,254,239,255,255,0,20,254,20,4,92,
+5,182,18,38,0,55,0,0,16,7,0,122,1,70,0,0,255,255,0,33,254,20,2,182,5,70,18,
+38,0,87,0,0,16,7,0,122,0,205,0,0,0,2,0,18,255,236,4,123,6,20,0,28,0,41,0,
+0,1,50,18,17,16,2,35,34,38,39,35,6,7,35,17,35,53,51,53,51,21,33,21,33,21,
+20,7,51,54,23,34,6,21,21,20,22,51,50,54,53,52,38,2,182,217,236,240,213,111,
+174,55,14,31,6,129,156,156,180,1,181,254,75,10,10,111,199,166,144,147,167,
+148,145,146,4,92,254,213,254,244,254,240,254,215,80,79,120,19,4,215,135,182,
+182,135,61,113,113,164,149,188,224,8,225,193,217,205,208,208,0,3,0,20,0,0,
+5,104,5,182,0,27,0,36,0,45,0,0,1,34,21,20,23,35,38,38,53,52,54,51,33,32,4,
+21,20,6,7,21,22,22,21,20,4,35,33,17,19,33,50,54,53,52,38,35,35,17,17,33,50,
+54,53,52,38,35,1,53,125,21,162,9,14,141,148,1,215,1,38,1,5,142,136,167,160,
+254,243,238,253,253,185,1,14,172,156,171,186,241,1,39,176,170,180,181,5,25,
+103,61,49,21,66,25,133,125,175,187,130,169,25,10,29,175,146,197,219,5,25,
+254,47,110,129,120,106,253,149,253,238,136,138,131,125,255,255,0,199,0,0,
+4,131,5,182,18,6,1,171,0,0,0,2,0,174,255,236,4,123,6,20,0,22,0,35,0,0,1,50,
+18,17,16,2,35,34,38,39,35,6,7,35,17,33,21,33,21,20,7,51,54,23,34,6,21,21,
+20,22,51,50,54,53,52,38,2,182,217,236,240,213,111,174,55,14,31,6,129,3,94,
+253,86,10,10,111,199,166,144,147,167,148,145,146,4,92,254,213,254,244,254,
+240,254,215,80,79,120,19,6,20,151,227,113,113,164,149,188,224,8,225,193,217,
+205,208,208,0,2,0,184,255,236,4,172,5,182,0,10,0,22,0,0,1,20,22,51,50,54,
+53,52,38,35,35,3,51,17,33,32,4,21,20,4,35,32,17,1,113,153,174,163,147,197,
+188,252,185,185,1,18,1,9,1,32,254,251,237,253,254,1,174,158,135,146,137,141,
+123,3,10,253,150,217,207,207,233,1,194,0,2,0,168,255,236,4,117,6,20,0,16,
+0,29,0,0,5,34,0,17,17,51,17,20,7,51,54,51,50,18,17,16,2,1,20,22,51,50,54,
+53,52,38,35,34,6,21,2,147,235,255,0,180,10,10,111,229,217,236,251,253,226,
+167,147,147,145,145,152,165,144,20,1,40,1,15,3,241,254,134,113,113,164,254,
+213,254,244,254,238,254,217,2,51,196,218,218,204,208,208,189,223,0,1,0,63,
+255,236,4,145,5,203,0,23,0,0,1,32,0,17,20,2,4,35,34,38,39,53,22,51,50,0,17,
+16,0,35,34,7,39,54,1,242,1,68,1,91,162,254,205,202,113,177,87,193,155,236,
+1,14,254,251,245,157,175,74,172,5,203,254,118,254,152,225,254,173,185,26,
+33,160,58,1,60,1,18,1,25,1,53,80,156,86,0,1,0,125,255,236,5,145,6,221,0,36,
+0,0,1,34,0,17,16,0,51,50,55,21,6,6,35,32,0,17,52,18,36,51,50,23,53,52,54,
+51,50,23,21,38,35,34,21,21,7,38,38,3,57,236,254,242,1,6,242,156,195,93,172,
+112,254,189,254,163,167,1,63,216,124,116,110,126,61,61,49,57,96,74,68,158,
+5,41,254,196,254,238,254,229,254,205,58,160,34,25,1,137,1,104,226,1,84,184,
+29,29,132,142,26,148,21,99,104,160,31,49,0,1,0,113,255,236,4,94,6,31,0,33,
+0,0,5,34,0,17,16,0,51,50,23,53,52,54,51,50,23,21,38,35,34,21,21,7,38,35,34,
+6,21,20,22,51,50,55,21,6,2,102,237,254,248,1,11,247,56,77,109,126,60,63,47,
+59,97,55,139,98,166,158,158,155,145,140,114,20,1,35,1,16,1,20,1,43,12,186,
+132,143,27,149,20,98,254,150,52,209,207,199,211,64,160,59,255,255,0,61,0,
+0,5,90,5,182,18,6,0,146,0,0,0,2,0,20,0,0,5,254,5,182,0,7,0,28,0,0,1,16,0,
+33,35,17,51,32,1,32,0,17,16,0,33,33,17,35,34,21,20,23,35,38,38,53,52,54,51,
+5,59,254,237,254,234,239,198,2,82,253,242,1,88,1,121,254,117,254,143,254,
+104,53,125,21,162,9,14,141,148,2,227,1,23,1,31,251,133,5,24,254,133,254,174,
+254,150,254,129,5,25,103,61,49,21,66,25,133,125,0,2,0,104,0,0,4,37,5,182,
+0,8,0,20,0,0,1,35,34,6,21,20,22,51,51,19,17,33,32,17,52,36,33,51,17,33,53,
+3,109,168,217,197,181,194,207,184,254,104,253,219,1,46,1,26,189,253,84,2,
+174,130,142,129,127,5,24,250,74,1,150,210,228,1,200,162,0,2,0,113,255,236,
+4,61,6,20,0,12,0,34,0,0,37,50,54,53,53,52,38,35,34,6,21,20,22,5,35,39,35,
+6,35,34,2,17,16,18,51,50,23,51,38,38,53,17,33,53,33,2,80,164,151,153,164,
+139,152,151,2,123,145,27,8,115,227,214,236,237,215,221,119,13,3,10,253,86,
+3,94,129,179,204,33,229,195,221,205,204,210,129,147,167,1,40,1,15,1,13,1,
+46,162,20,121,21,1,31,151,0,2,0,111,255,236,4,102,6,20,0,30,0,42,0,0,1,22,
+22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,39,38,38,53,52,0,51,50,
+4,21,20,2,1,20,22,23,54,54,53,52,38,35,34,6,2,186,136,118,196,172,104,190,
+128,78,76,172,104,82,96,109,165,213,172,1,14,242,229,1,18,222,253,161,123,
+135,189,194,170,145,158,168,2,90,77,160,99,132,154,46,64,141,43,61,76,65,
+69,107,91,117,244,157,236,1,11,248,210,179,255,0,1,136,126,180,69,45,214,
+161,138,169,181,0,1,0,123,0,0,3,172,5,182,0,11,0,0,55,33,17,33,53,33,17,33,
+53,33,17,33,123,2,121,253,172,2,84,253,135,3,49,252,207,162,2,10,160,1,200,
+162,250,74,255,255,0,121,255,236,5,106,5,205,18,6,2,222,0,0,0,1,0,111,255,
+236,4,102,5,203,0,39,0,0,19,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,
+51,21,35,34,6,21,20,22,51,50,55,21,6,33,32,36,53,52,54,55,53,38,38,178,249,
+216,132,245,100,88,107,172,106,130,148,197,198,199,209,225,226,198,187,215,
+223,184,254,248,254,236,254,221,191,185,147,162,4,96,167,196,77,75,125,73,
+52,125,104,123,145,154,135,131,137,146,107,168,90,212,207,156,184,25,8,25,
+181,0,1,255,233,254,20,3,248,5,182,0,18,0,0,19,34,39,53,22,51,50,54,53,17,
+33,21,33,17,33,21,33,17,16,92,66,49,42,51,72,57,3,49,253,135,2,82,253,174,
+254,20,27,156,21,83,85,6,88,162,253,250,161,252,233,254,190,0,1,0,125,255,
+236,5,242,6,221,0,39,0,0,1,33,17,6,6,35,32,0,17,52,18,36,51,50,23,53,52,54,
+51,50,23,21,38,35,34,21,21,7,38,35,32,0,17,16,0,33,50,55,17,33,3,66,1,249,
+116,240,158,254,178,254,146,182,1,87,233,146,134,110,126,59,64,49,58,96,70,
+193,184,254,251,254,218,1,26,1,13,147,140,254,191,3,4,253,51,37,38,1,140,
+1,99,229,1,86,181,35,35,132,142,26,148,21,99,108,160,84,254,196,254,238,254,
+222,254,210,35,1,178,0,2,0,0,254,20,4,143,5,182,0,20,0,31,0,0,37,22,22,21,
+20,6,35,34,38,53,52,19,1,51,18,18,23,54,55,1,51,1,52,38,39,6,6,21,20,22,51,
+50,2,172,68,69,131,106,110,128,137,254,29,193,183,193,15,20,82,1,31,194,253,
+254,35,34,39,31,39,31,69,221,134,229,77,121,152,155,118,159,1,23,4,219,254,
+26,254,0,85,104,219,2,248,249,115,54,147,65,77,140,45,63,58,0,1,0,174,255,
+236,6,211,6,20,0,36,0,0,37,50,54,53,17,51,17,20,6,35,34,38,53,17,52,38,35,
+34,6,21,17,35,17,51,17,20,7,51,54,54,51,50,22,21,17,20,22,5,29,137,121,180,
+208,230,226,213,107,116,152,141,180,180,10,12,50,171,99,186,189,125,129,147,
+158,2,152,253,98,234,214,199,202,1,65,134,131,187,213,253,201,6,20,254,56,
+90,64,85,85,191,210,254,190,133,131,0,1,0,184,255,236,2,180,5,182,0,15,0,
+0,1,17,20,22,51,50,54,55,21,6,6,35,34,38,53,17,1,111,74,83,44,94,30,26,112,
+56,164,150,5,182,251,156,99,98,14,9,152,12,20,169,173,4,116,0,1,0,70,0,0,
+2,111,5,182,0,19,0,0,33,33,53,55,17,35,53,51,17,39,53,33,21,7,17,51,21,35,
+17,23,2,98,253,240,172,184,184,172,2,16,172,185,185,172,106,39,2,13,159,1,
+230,41,106,106,41,254,26,159,253,243,39,0,1,0,199,0,0,4,244,5,195,0,27,0,
+0,1,1,35,38,3,38,39,7,17,35,17,51,17,54,55,54,1,54,54,51,50,23,21,38,35,34,
+6,7,2,158,2,86,217,61,187,146,112,162,184,184,57,66,44,1,79,59,105,84,62,
+40,42,48,34,60,45,3,61,252,195,81,1,16,211,136,157,253,225,5,182,253,31,72,
+76,50,1,154,77,65,17,143,6,40,54,0,1,0,174,0,0,4,51,6,31,0,24,0,0,1,7,51,
+55,55,1,51,1,1,35,1,7,17,35,17,16,51,50,23,21,38,35,34,6,21,1,96,8,8,61,70,
+1,95,210,254,68,1,219,217,254,131,125,178,248,67,66,47,59,47,50,2,231,178,
+78,84,1,115,254,43,253,139,2,0,109,254,109,5,0,1,31,27,149,20,54,65,0,1,0,
+31,0,0,1,242,6,20,0,11,0,0,1,51,21,35,17,35,17,35,53,51,17,51,1,98,144,144,
+180,143,143,180,3,92,135,253,43,2,213,135,2,184,0,1,255,244,255,236,4,86,
+6,33,0,38,0,0,35,1,39,7,39,55,38,38,35,34,7,53,54,51,50,22,23,55,23,7,1,22,
+22,51,50,55,21,6,35,34,38,39,3,38,39,35,6,7,3,12,1,217,47,217,39,202,26,68,
+59,62,53,68,67,109,139,51,224,38,208,1,110,20,47,36,24,37,50,67,74,90,32,
+150,85,17,8,33,80,250,4,53,131,65,129,61,46,40,12,145,17,86,99,68,129,66,
+252,5,57,54,10,133,24,74,91,1,164,243,83,126,190,253,193,0,1,0,184,255,236,
+7,117,5,182,0,36,0,0,1,17,20,22,51,50,54,53,17,51,17,20,22,51,50,54,53,17,
+51,17,35,39,35,6,6,35,34,38,39,35,6,6,35,34,38,53,17,1,113,118,129,173,165,
+185,119,133,172,161,185,146,30,11,51,200,119,139,175,45,10,58,211,126,211,
+193,5,182,251,244,143,144,193,205,3,157,251,244,143,144,204,235,3,116,250,
+74,168,87,101,100,104,98,106,216,230,4,12,0,1,255,233,254,20,5,78,5,182,0,
+29,0,0,19,51,23,1,19,51,38,2,53,17,51,17,35,1,35,23,22,21,17,20,6,35,34,39,
+53,22,51,50,54,53,199,213,45,1,224,255,8,2,12,172,215,252,241,8,5,12,139,
+138,66,49,42,51,72,57,5,182,71,253,26,254,115,24,1,39,66,3,57,250,74,4,190,
+81,182,134,252,37,169,153,27,156,21,83,85,255,255,0,174,254,20,4,76,4,94,
+18,6,1,132,0,0,255,255,0,125,255,236,5,195,5,205,18,6,2,123,0,0,0,2,0,125,
+255,236,7,225,5,205,0,27,0,39,0,0,1,16,0,33,32,0,17,16,0,33,32,23,54,54,51,
+50,22,21,17,35,17,52,38,35,34,6,7,22,1,16,18,51,50,18,17,16,2,35,34,2,5,129,
+254,174,254,209,254,205,254,176,1,79,1,54,1,35,168,57,205,123,209,194,184,
+118,130,108,138,39,109,251,190,229,220,219,227,225,219,222,229,2,221,254,
+158,254,113,1,138,1,105,1,101,1,137,187,88,99,216,231,251,242,4,14,144,143,
+62,63,189,254,234,254,222,254,208,1,44,1,38,1,37,1,41,254,211,0,2,0,113,254,
+20,6,29,4,94,0,26,0,37,0,0,1,16,0,35,34,38,2,53,16,18,51,50,23,54,54,51,50,
+22,21,17,35,17,16,35,34,7,22,5,20,22,51,50,54,53,52,38,35,32,4,53,254,253,
+226,142,219,118,255,228,217,129,53,155,87,164,164,179,188,130,62,71,252,246,
+150,145,145,152,151,146,254,217,2,39,254,242,254,211,139,1,6,170,1,11,1,44,
+147,75,72,192,211,251,73,4,175,1,4,90,130,196,207,215,214,208,206,210,0,2,
+0,20,0,0,5,18,5,182,0,8,0,30,0,0,1,51,50,54,53,52,38,35,35,55,32,17,20,4,
+33,35,17,35,17,35,34,21,20,23,35,38,38,53,52,54,51,2,35,147,218,196,182,193,
+186,203,2,36,254,208,254,233,168,185,53,125,21,162,9,14,141,148,2,215,141,
+156,141,140,157,254,82,223,240,253,199,5,25,103,61,49,21,66,25,133,125,0,
+2,0,174,254,20,4,123,6,31,0,32,0,45,0,0,1,50,23,21,38,35,34,6,21,21,20,7,
+7,51,54,54,51,50,18,17,16,2,35,34,39,35,23,22,21,17,35,19,16,1,34,6,7,21,
+20,22,51,50,54,53,52,38,1,168,67,66,47,59,47,50,8,4,12,64,168,110,214,237,
+238,215,221,119,12,4,8,180,2,1,232,163,145,2,148,166,138,155,155,6,31,27,
+149,20,54,65,164,61,78,41,90,80,254,215,254,242,254,243,254,210,159,41,78,
+61,254,61,6,236,1,31,253,168,184,197,35,223,199,224,200,201,213,0,2,0,199,
+255,51,4,219,5,182,0,8,0,23,0,0,1,51,50,54,53,52,38,35,35,17,17,35,17,51,
+21,51,32,4,21,16,5,1,35,1,1,127,219,178,164,166,186,209,184,184,219,1,16,
+1,5,254,219,1,145,215,254,158,2,43,140,139,138,126,253,69,254,113,5,182,205,
+207,208,254,222,101,253,112,2,92,0,1,0,96,255,236,3,254,5,203,0,37,0,0,19,
+52,54,54,55,62,2,53,52,38,35,34,7,39,54,51,50,4,21,20,6,7,14,2,21,20,22,51,
+50,55,21,6,6,35,34,36,96,82,168,170,140,125,55,147,130,147,168,58,175,194,
+209,1,2,170,207,159,143,62,165,164,186,224,69,210,123,245,254,235,1,135,99,
+146,114,63,52,77,95,71,101,112,78,158,82,202,171,156,203,75,58,82,94,67,110,
+126,97,177,34,45,220,0,1,0,92,255,236,3,109,4,94,0,35,0,0,19,52,54,54,55,
+54,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,6,7,14,2,21,20,22,51,50,55,
+21,6,35,32,92,62,129,139,181,102,116,112,103,167,62,165,155,201,211,59,126,
+155,108,115,48,131,129,172,176,128,216,254,74,1,47,76,110,88,52,69,79,61,
+62,71,70,143,74,150,141,76,106,85,60,41,64,63,45,80,82,88,164,69,255,255,
+0,74,0,0,4,94,5,182,18,6,1,112,0,0,0,2,255,141,254,20,2,221,6,31,0,24,0,34,
+0,0,19,34,38,53,52,54,51,50,22,21,17,20,22,51,50,54,55,21,6,6,35,34,38,53,
+17,3,34,6,21,20,51,51,53,52,38,137,123,129,134,122,130,137,74,83,39,101,28,
+31,109,52,163,149,100,44,36,101,79,50,4,86,120,109,110,118,148,141,250,111,
+100,97,13,9,137,14,19,169,173,4,236,1,53,49,31,82,27,72,63,0,1,0,33,254,20,
+2,182,5,70,0,30,0,0,1,34,39,53,22,51,50,53,53,35,32,17,17,35,53,55,55,51,
+21,33,21,33,17,20,22,51,50,54,55,17,16,1,199,60,63,46,56,98,22,254,190,155,
+157,72,107,1,61,254,195,91,81,35,94,24,254,20,25,150,19,107,209,1,83,2,127,
+86,72,234,252,140,253,134,95,102,14,9,254,143,254,239,0,1,0,20,0,0,4,133,
+5,182,0,17,0,0,1,34,21,20,23,35,38,38,53,52,54,51,33,21,33,17,35,17,1,53,
+125,21,162,9,14,141,148,3,80,254,57,184,5,20,98,61,49,21,66,25,133,125,162,
+250,236,5,20,0,1,0,33,255,236,2,182,6,31,0,32,0,0,1,33,21,33,17,20,22,51,
+50,54,55,21,6,6,35,32,17,17,35,53,55,53,16,33,50,23,21,38,38,35,34,6,21,1,
+113,1,61,254,195,91,81,35,94,24,25,105,54,254,190,155,157,1,46,79,78,23,95,
+39,65,58,4,74,140,253,134,95,102,14,9,138,11,21,1,83,2,127,86,72,135,1,60,
+27,149,8,12,70,69,0,1,0,20,254,20,4,92,5,182,0,17,0,0,1,33,53,33,21,33,17,
+20,22,51,50,55,21,6,35,34,38,53,1,221,254,55,4,72,254,58,58,71,50,42,49,80,
+139,138,5,20,162,162,250,74,87,81,21,156,27,153,169,0,1,0,76,255,233,5,244,
+5,182,0,31,0,0,37,50,54,53,52,2,39,53,33,21,33,22,18,21,16,0,33,32,0,17,52,
+18,55,33,53,33,21,6,2,21,20,18,3,33,234,241,166,176,2,78,254,147,151,160,
+254,157,254,198,254,194,254,158,160,149,254,150,2,78,179,165,243,139,255,
+247,225,1,67,126,147,162,116,254,168,205,254,204,254,162,1,92,1,52,205,1,
+92,114,162,147,128,254,186,220,246,255,0,0,1,0,0,0,0,4,145,5,203,0,25,0,0,
+1,20,7,1,35,1,51,1,22,23,54,55,54,55,19,54,53,52,38,35,34,7,53,54,51,32,4,
+145,92,254,142,185,253,246,193,1,75,63,29,17,38,43,23,174,74,66,63,50,42,
+46,83,1,20,4,164,109,213,252,158,5,182,252,70,180,140,61,88,102,65,1,160,
+181,75,80,65,21,156,27,0,1,0,0,0,0,4,135,5,205,0,17,0,0,19,34,7,53,54,51,
+50,22,23,1,1,51,1,17,35,17,1,38,80,43,37,58,65,75,92,38,1,6,1,115,198,254,
+35,184,254,180,36,5,49,16,149,23,71,83,253,180,2,207,252,129,253,201,2,47,
+2,186,72,0,1,0,2,254,20,4,86,4,94,0,31,0,0,1,50,23,21,38,35,34,6,7,1,6,6,
+35,34,39,53,22,51,50,55,55,1,51,19,22,23,51,54,55,19,54,54,3,225,67,50,37,
+24,36,45,22,254,137,65,193,141,75,74,50,70,174,74,53,254,70,193,237,75,17,
+8,17,82,155,39,91,4,94,24,133,10,54,57,252,12,179,161,17,143,12,194,146,4,
+78,253,143,204,95,73,228,1,189,111,87,0,1,0,78,0,0,4,68,5,182,0,17,0,0,19,
+33,1,33,53,33,21,1,51,21,33,1,33,21,33,53,1,33,162,1,121,1,53,253,22,3,201,
+254,186,250,254,166,254,164,3,23,252,10,1,108,254,232,3,66,1,208,164,139,
+254,23,146,253,244,164,139,2,37,0,1,0,80,0,0,3,115,4,74,0,17,0,0,19,33,19,
+33,53,33,21,3,51,21,33,3,33,21,33,53,1,35,117,1,73,224,253,213,2,241,227,
+207,254,203,252,2,84,252,221,1,10,229,2,129,1,61,140,135,254,190,143,254,
+153,139,119,1,123,0,1,0,72,255,236,4,59,5,182,0,26,0,0,1,30,2,21,20,4,33,
+32,39,53,22,22,51,50,54,53,52,38,35,35,53,1,33,53,33,21,2,84,139,224,124,
+254,202,254,233,254,253,163,100,226,98,199,196,202,193,127,1,166,253,90,3,
+141,3,133,4,114,199,131,224,249,79,168,48,48,168,156,142,155,133,1,157,164,
+145,0,1,0,113,255,236,4,100,5,182,0,28,0,0,19,53,33,21,33,1,21,35,34,6,21,
+20,22,51,50,54,55,21,6,6,35,34,38,38,53,52,54,54,55,174,3,141,253,93,1,163,
+159,173,190,202,193,100,225,99,92,218,136,179,254,132,123,222,142,5,37,145,
+164,254,99,133,166,150,145,160,48,48,168,44,35,111,204,137,139,209,117,4,
+0,1,0,70,254,20,3,223,4,74,0,24,0,0,19,53,33,21,33,1,21,35,34,6,21,20,22,
+51,50,55,21,6,33,34,0,53,52,0,55,125,3,70,253,141,1,192,120,206,208,193,161,
+204,183,140,254,251,232,254,224,1,7,240,3,199,131,152,254,15,125,174,168,
+146,178,86,164,72,1,3,210,216,1,1,17,0,1,0,57,254,20,3,152,4,74,0,36,0,0,
+1,50,55,21,6,35,34,38,53,52,54,51,50,54,53,52,38,35,35,53,1,33,53,33,21,1,
+22,22,21,20,6,35,34,6,21,20,22,1,186,172,156,122,208,185,198,190,187,163,
+142,182,201,120,1,118,253,215,3,39,254,129,212,227,244,238,108,103,109,254,
+170,74,164,60,128,116,128,120,112,138,122,115,125,1,78,152,131,254,176,10,
+191,178,195,207,42,56,43,51,0,1,0,98,0,0,4,41,6,31,0,33,0,0,19,33,54,54,53,
+52,38,35,34,6,7,39,54,51,50,22,21,20,6,7,51,21,33,6,6,1,21,33,21,33,53,1,
+55,33,160,1,237,56,49,122,108,93,149,75,96,191,226,192,220,43,51,205,254,
+217,22,52,254,125,2,254,252,57,1,103,96,254,119,3,90,90,155,89,103,114,68,
+67,121,172,199,172,86,161,91,143,33,67,254,49,9,143,150,1,184,125,0,1,0,72,
+255,236,4,59,5,182,0,27,0,0,1,17,51,50,22,22,21,20,4,33,32,39,53,22,22,51,
+50,54,53,52,38,35,35,17,35,53,33,21,1,203,86,158,246,134,254,202,254,233,
+254,253,163,100,226,98,199,196,192,171,254,161,3,141,5,18,254,117,110,204,
+136,224,249,79,168,48,48,168,156,139,158,2,34,164,164,0,1,0,68,255,236,3,
+143,4,74,0,25,0,0,1,21,51,50,22,21,20,6,35,34,39,53,22,51,50,54,53,52,38,
+35,35,17,35,53,33,21,1,150,47,219,239,248,221,242,132,183,189,141,152,154,
+159,195,127,2,234,3,178,239,190,183,167,187,71,162,86,109,108,109,106,1,131,
+152,152,0,1,0,74,255,236,3,88,5,70,0,33,0,0,1,53,35,53,55,55,51,21,33,21,
+33,21,20,22,23,22,22,21,20,6,35,34,39,53,22,51,50,54,53,52,38,39,38,38,1,
+23,187,189,71,107,1,61,254,195,42,54,169,132,230,208,216,128,176,172,136,
+124,99,134,97,73,3,6,184,86,72,234,252,140,188,69,65,18,63,146,106,154,169,
+69,164,88,88,74,60,84,54,41,132,0,2,0,174,254,20,4,80,4,94,0,14,0,24,0,0,
+1,35,17,51,23,51,54,51,50,22,21,20,2,4,7,53,36,0,53,52,38,35,34,6,21,1,98,
+180,148,24,8,112,212,196,230,187,254,167,218,1,12,1,40,148,129,149,138,254,
+20,6,54,150,170,242,214,187,254,211,181,13,147,35,1,24,215,142,168,180,201,
+0,1,1,193,254,20,2,96,6,20,0,3,0,0,1,35,17,51,2,96,159,159,254,20,8,0,255,
+255,0,186,254,20,3,104,6,20,16,39,3,187,254,249,0,0,16,7,3,187,1,8,0,0,0,
+1,0,133,254,20,3,156,6,20,0,19,0,0,19,33,17,51,17,33,21,33,21,33,21,33,17,
+35,17,33,53,33,53,33,133,1,60,159,1,60,254,196,1,60,254,196,159,254,196,1,
+60,254,196,3,55,2,221,253,35,147,254,148,253,2,2,254,148,254,255,255,0,147,
+255,227,1,145,5,182,18,6,0,4,0,0,255,255,0,199,0,0,10,7,7,115,16,38,0,39,
+0,0,16,39,0,61,5,195,0,0,16,7,1,76,5,154,1,82,255,255,0,199,0,0,9,74,6,33,
+16,38,0,39,0,0,16,39,0,93,5,215,0,0,16,7,1,76,5,98,0,0,255,255,0,113,255,
+236,8,95,6,33,16,38,0,71,0,0,16,39,0,93,4,236,0,0,16,7,1,76,4,123,0,0,255,
+255,0,199,254,123,5,166,5,182,16,38,0,47,0,0,16,7,0,45,4,49,0,0,255,255,0,
+199,254,20,5,164,5,229,16,38,0,47,0,0,16,7,0,77,4,49,0,0,255,255,0,174,254,
+20,3,131,6,20,16,38,0,79,0,0,16,7,0,77,2,16,0,0,255,255,0,199,254,123,7,137,
+5,182,16,38,0,49,0,0,16,7,0,45,6,20,0,0,255,255,0,199,254,20,7,135,5,229,
+16,38,0,49,0,0,16,7,0,77,6,20,0,0,255,255,0,174,254,20,6,101,5,229,16,38,
+0,81,0,0,16,7,0,77,4,242,0,0,255,255,0,0,0,0,5,27,7,142,18,38,0,36,0,0,16,
+7,1,76,0,47,1,109,255,255,0,94,255,236,3,215,6,33,18,38,0,68,0,0,16,6,1,76,
+226,0,255,255,0,3,0,0,2,183,7,142,18,38,0,44,0,0,16,7,1,76,254,255,1,109,
+255,255,255,175,0,0,2,99,6,33,18,38,0,243,0,0,16,7,1,76,254,171,0,0,255,255,
+0,125,255,236,5,195,7,142,18,38,0,50,0,0,16,7,1,76,0,193,1,109,255,255,0,
+113,255,236,4,104,6,33,18,38,0,82,0,0,16,6,1,76,12,0,255,255,0,184,255,236,
+5,31,7,142,18,38,0,56,0,0,16,7,1,76,0,141,1,109,255,255,0,162,255,236,4,68,
+6,33,18,38,0,88,0,0,16,6,1,76,27,0,255,255,0,184,255,236,5,31,8,2,18,38,0,
+56,0,0,16,7,9,76,2,242,1,82,255,255,0,162,255,236,4,68,6,176,18,38,0,88,0,
+0,16,7,9,76,2,117,0,0,255,255,0,184,255,236,5,31,8,74,18,38,0,56,0,0,16,7,
+8,136,2,223,1,82,255,255,0,162,255,236,4,68,6,248,18,38,0,88,0,0,16,7,8,136,
+2,115,0,0,255,255,0,184,255,236,5,31,8,94,18,38,0,56,0,0,16,7,9,75,2,233,
+1,82,255,255,0,162,255,236,4,68,7,12,18,38,0,88,0,0,16,7,9,75,2,111,0,0,255,
+255,0,184,255,236,5,31,8,74,18,38,0,56,0,0,16,7,8,137,2,225,1,82,255,255,
+0,162,255,236,4,68,6,248,18,38,0,88,0,0,16,7,8,137,2,117,0,0,0,2,0,104,255,
+236,4,18,4,94,0,20,0,27,0,0,1,50,0,17,16,0,35,34,2,53,53,33,38,38,35,34,6,
+7,53,54,54,19,50,54,55,33,22,22,2,2,248,1,24,254,250,223,207,246,2,240,5,
+180,165,88,158,106,91,160,154,129,150,14,253,209,2,136,4,94,254,213,254,250,
+254,248,254,199,1,11,228,109,186,195,31,45,158,39,32,252,33,166,147,151,162,
+255,255,0,0,0,0,5,27,8,2,18,38,0,36,0,0,16,7,9,76,2,143,1,82,255,255,0,94,
+255,236,3,215,6,176,18,38,0,68,0,0,16,7,9,76,2,74,0,0,255,255,0,0,0,0,5,27,
+8,2,18,38,0,36,0,0,16,7,9,79,2,143,0,0,255,255,0,94,255,236,3,215,6,178,18,
+38,0,68,0,0,16,7,9,78,2,74,0,0,255,255,255,254,0,0,6,145,6,188,18,38,0,136,
+0,0,16,7,1,77,1,156,1,82,255,255,0,94,255,236,6,129,5,106,18,38,0,168,0,0,
+16,7,1,77,1,25,0,0,0,1,0,125,255,236,5,190,5,203,0,35,0,0,1,33,17,51,21,35,
+17,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,32,0,17,16,0,33,50,55,53,33,53,
+33,53,33,3,66,1,249,131,131,116,240,158,254,178,254,146,182,1,87,233,234,
+202,70,193,184,254,251,254,218,1,26,1,13,147,140,254,211,1,45,254,191,3,4,
+254,205,146,254,248,37,38,1,140,1,99,229,1,86,181,86,160,84,254,196,254,238,
+254,222,254,210,35,145,146,143,0,2,0,113,254,20,4,174,4,94,0,34,0,46,0,0,
+37,55,35,6,35,34,2,17,16,18,51,50,23,51,55,51,17,20,7,51,21,35,6,33,34,39,
+53,22,51,50,55,33,53,33,55,37,50,54,53,53,52,38,35,34,6,21,16,3,139,6,8,111,
+229,215,237,238,212,223,121,11,24,143,4,117,147,97,254,152,240,155,160,245,
+157,83,254,207,1,108,4,254,197,171,146,152,169,140,149,31,135,166,1,34,1,
+11,1,7,1,42,166,146,251,164,40,36,146,252,70,166,86,102,146,61,180,175,192,
+33,220,200,208,204,254,104,255,255,0,125,255,236,5,59,7,115,18,38,0,42,0,
+0,16,7,1,76,0,248,1,82,255,255,0,113,254,20,4,61,6,33,18,38,0,74,0,0,16,6,
+1,76,23,0,255,255,0,199,0,0,4,244,7,115,18,38,0,46,0,0,16,7,1,76,0,76,1,82,
+255,255,0,174,0,0,4,51,7,156,18,38,0,78,0,0,16,7,1,76,0,2,1,123,255,255,0,
+125,254,61,5,195,5,205,18,38,0,50,0,0,16,7,1,81,2,125,0,0,255,255,0,113,254,
+61,4,104,4,94,18,38,0,82,0,0,16,7,1,81,1,180,0,0,255,255,0,125,254,61,5,195,
+6,188,18,38,0,50,0,0,16,39,1,77,0,197,1,82,16,7,1,81,2,125,0,0,255,255,0,
+113,254,61,4,104,5,106,18,38,0,82,0,0,16,38,1,77,16,0,16,7,1,81,1,180,0,0,
+255,255,0,72,255,236,4,59,7,115,18,38,3,178,0,0,16,7,1,76,255,206,1,82,255,
+255,0,29,254,20,3,182,6,33,18,38,2,231,0,0,16,7,1,76,255,114,0,0,255,255,
+0,199,0,0,10,7,5,182,16,38,0,39,0,0,16,7,0,61,5,195,0,0,255,255,0,199,0,0,
+9,74,5,182,16,38,0,39,0,0,16,7,0,93,5,215,0,0,255,255,0,113,255,236,8,95,
+6,20,16,38,0,71,0,0,16,7,0,93,4,236,0,0,255,255,0,125,255,236,5,59,7,115,
+18,38,0,42,0,0,16,7,0,118,1,100,1,82,255,255,0,113,254,20,4,61,6,33,18,38,
+0,74,0,0,16,6,0,118,74,0,0,1,0,199,255,238,6,201,5,182,0,25,0,0,1,17,35,17,
+51,17,33,17,51,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,53,17,1,127,184,
+184,2,94,185,94,96,91,97,185,200,179,174,195,2,170,253,86,5,182,253,150,2,
+106,251,154,93,102,103,94,2,248,253,8,165,191,188,170,1,86,0,2,0,199,254,
+20,4,217,5,205,0,14,0,24,0,0,1,50,18,21,16,0,5,17,35,17,51,23,51,54,54,1,
+36,0,17,52,38,35,34,6,21,3,29,210,234,254,75,254,91,184,145,31,10,76,203,
+254,231,1,74,1,88,152,141,193,188,5,205,254,250,236,254,182,254,6,171,254,
+40,7,164,198,113,106,250,203,138,1,170,1,13,166,174,227,242,255,255,0,199,
+0,0,5,78,7,115,18,38,0,49,0,0,16,7,0,67,0,102,1,82,255,255,0,174,0,0,4,76,
+6,33,18,38,0,81,0,0,16,6,0,67,234,0,255,255,0,0,0,0,5,27,7,115,18,38,0,36,
+0,0,16,7,3,115,4,221,1,82,255,255,0,94,255,236,3,215,6,33,18,38,0,68,0,0,
+16,7,3,115,4,152,0,0,255,255,0,0,0,0,5,27,7,62,18,38,0,36,0,0,16,7,4,241,
+2,143,1,82,255,255,0,94,255,236,3,215,5,236,18,38,0,68,0,0,16,7,4,241,2,84,
+0,0,255,255,0,160,0,0,3,248,7,115,18,38,0,40,0,0,16,7,3,115,4,197,1,82,255,
+255,0,113,255,236,4,27,6,33,18,38,0,72,0,0,16,7,3,115,4,184,0,0,255,255,0,
+199,0,0,3,248,7,62,18,38,0,40,0,0,16,7,4,241,2,98,1,82,255,255,0,113,255,
+236,4,27,5,236,18,38,0,72,0,0,16,7,4,241,2,86,0,0,255,255,255,133,0,0,2,100,
+7,115,18,38,0,44,0,0,16,7,3,115,3,170,1,82,255,255,255,49,0,0,2,16,6,33,18,
+38,0,243,0,0,16,7,3,115,3,86,0,0,255,255,0,29,0,0,2,153,7,62,18,38,0,44,0,
+0,16,7,4,241,1,92,1,82,255,255,255,201,0,0,2,69,5,236,18,38,0,243,0,0,16,
+7,4,241,1,8,0,0,255,255,0,125,255,236,5,195,7,115,18,38,0,50,0,0,16,7,3,115,
+5,113,1,82,255,255,0,113,255,236,4,104,6,33,18,38,0,82,0,0,16,7,3,115,4,199,
+0,0,255,255,0,125,255,236,5,195,7,62,18,38,0,50,0,0,16,7,4,241,3,33,1,82,
+255,255,0,113,255,236,4,104,5,236,18,38,0,82,0,0,16,7,4,241,2,109,0,0,255,
+255,0,166,0,0,4,219,7,115,18,38,0,53,0,0,16,7,3,115,4,203,1,82,255,255,0,
+35,0,0,3,47,6,33,18,38,0,85,0,0,16,7,3,115,4,72,0,0,255,255,0,199,0,0,4,219,
+7,62,18,38,0,53,0,0,16,7,4,241,2,125,1,82,255,255,0,174,0,0,3,47,5,236,18,
+38,0,85,0,0,16,7,4,241,1,240,0,0,255,255,0,184,255,236,5,31,7,115,18,38,0,
+56,0,0,16,7,3,115,5,88,1,82,255,255,0,162,255,236,4,68,6,33,18,38,0,88,0,
+0,16,7,3,115,4,199,0,0,255,255,0,184,255,236,5,31,7,62,18,38,0,56,0,0,16,
+7,4,241,2,238,1,82,255,255,0,162,255,236,4,68,5,236,18,38,0,88,0,0,16,7,4,
+241,2,121,0,0,255,255,0,78,255,236,4,70,5,203,18,6,1,177,0,0,0,1,0,20,254,
+20,3,182,4,94,0,40,0,0,1,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,
+6,7,22,22,21,20,6,6,35,34,39,53,22,22,51,50,54,53,52,38,35,35,53,1,139,144,
+170,158,133,61,126,86,61,90,159,95,211,242,130,130,165,164,134,249,159,238,
+150,91,208,97,162,192,208,206,161,1,211,143,113,113,135,30,40,143,43,31,197,
+173,125,180,44,42,205,150,144,226,124,76,164,43,47,185,155,157,169,143,255,
+255,0,199,0,0,5,37,7,115,18,38,0,43,0,0,16,7,1,76,0,152,1,82,255,255,0,174,
+0,0,4,76,7,156,18,38,0,75,0,0,16,7,1,76,0,78,1,123,0,1,0,199,254,20,5,51,
+5,205,0,18,0,0,1,32,17,17,35,17,51,23,51,54,54,51,32,17,17,35,17,52,38,3,
+35,254,92,184,145,31,10,66,249,125,1,250,184,168,5,45,254,53,252,158,5,184,
+188,93,116,253,227,250,100,5,156,199,182,255,255,0,113,254,20,5,39,6,20,18,
+6,4,69,0,0,0,2,0,119,255,236,4,231,5,182,0,27,0,37,0,0,1,50,54,53,53,51,21,
+16,7,22,22,21,20,0,33,34,36,38,53,16,37,38,17,53,51,21,20,22,3,20,22,51,50,
+54,53,16,33,32,2,174,151,160,185,236,151,158,254,207,254,244,165,254,255,
+141,1,49,231,184,160,224,188,185,185,190,254,135,254,141,3,195,168,151,180,
+180,254,216,99,48,209,155,229,254,246,121,227,147,1,65,93,95,1,42,180,180,
+151,168,254,24,167,169,170,166,1,74,0,2,0,113,255,236,4,104,6,20,0,28,0,40,
+0,0,1,50,54,53,17,51,17,20,6,7,22,22,21,20,0,35,34,0,53,16,37,38,38,53,17,
+51,17,20,22,3,20,22,51,50,54,53,52,38,35,34,6,2,109,137,121,180,94,105,134,
+134,254,239,239,228,254,237,1,10,105,92,180,121,184,162,160,157,164,167,157,
+157,162,3,225,147,158,1,2,254,248,158,180,39,51,217,158,239,254,242,1,21,
+232,1,75,98,39,182,153,1,8,254,254,158,147,254,8,176,184,182,178,178,177,
+178,255,255,0,78,254,106,4,68,5,182,18,38,0,61,0,0,16,7,3,125,2,193,0,0,255,
+255,0,80,254,106,3,115,4,74,18,6,6,22,0,0,255,255,0,0,0,0,5,27,7,55,18,38,
+0,36,0,0,16,7,1,79,1,133,1,82,255,255,0,94,255,236,3,215,5,229,18,38,0,68,
+0,0,16,7,1,79,1,53,0,0,255,255,0,199,254,20,3,248,5,182,18,38,0,40,0,0,16,
+7,0,122,1,123,0,0,255,255,0,113,254,20,4,27,4,94,18,38,0,72,0,0,16,7,0,122,
+1,111,0,0,255,255,0,125,255,236,5,195,8,29,18,38,0,50,0,0,16,7,9,76,3,33,
+1,109,255,255,0,113,255,236,4,104,6,176,18,38,0,82,0,0,16,7,9,76,2,109,0,
+0,255,255,0,125,255,236,5,195,8,29,18,38,0,50,0,0,16,7,9,77,3,31,1,109,255,
+255,0,113,255,236,4,104,6,176,18,38,0,82,0,0,16,7,9,77,2,106,0,0,255,255,
+0,125,255,236,5,195,7,55,18,38,0,50,0,0,16,7,1,79,2,23,1,82,255,255,0,113,
+255,236,4,104,5,229,18,38,0,82,0,0,16,7,1,79,1,98,0,0,255,255,0,125,255,236,
+5,195,8,2,18,38,0,50,0,0,16,7,9,79,3,31,0,0,255,255,0,113,255,236,4,104,6,
+178,18,38,0,82,0,0,16,7,9,78,2,109,0,0,255,255,0,0,0,0,4,135,6,188,18,38,
+0,60,0,0,16,7,1,77,255,234,1,82,255,255,0,2,254,20,4,20,5,106,18,38,0,92,
+0,0,16,6,1,77,177,0,0,2,0,14,255,195,2,248,6,20,0,18,0,28,0,0,19,51,17,54,
+51,50,22,21,20,6,35,34,38,39,6,7,39,54,55,5,50,54,53,52,38,35,34,7,22,174,
+180,63,77,124,142,142,131,94,134,38,30,39,138,74,86,1,55,60,51,63,54,62,63,
+7,6,20,251,170,25,137,109,114,131,71,60,61,111,61,200,109,190,61,45,53,54,
+49,164,0,2,0,174,255,195,5,225,4,94,0,34,0,44,0,0,1,54,51,50,22,21,20,6,35,
+34,39,6,7,39,54,55,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,51,50,22,21,
+19,50,54,53,52,38,35,34,7,22,4,76,63,76,124,142,139,133,181,83,30,40,137,
+74,86,119,127,169,153,180,145,27,10,51,184,111,202,196,131,52,58,62,54,62,
+63,7,1,190,25,137,109,114,131,131,57,115,61,200,109,1,137,134,131,187,211,
+253,199,4,74,150,81,89,196,207,253,172,53,53,53,54,49,164,0,2,0,29,255,195,
+3,6,5,70,0,26,0,36,0,0,19,35,53,55,55,51,21,33,21,33,17,54,51,50,22,21,20,
+6,35,34,38,39,6,7,39,54,55,5,50,54,53,52,38,35,34,7,22,188,155,157,72,107,
+1,61,254,195,63,76,124,142,139,133,94,134,38,30,40,137,75,84,1,56,52,58,62,
+54,62,63,7,3,190,86,72,234,252,140,254,0,25,137,109,114,131,71,60,57,115,
+61,203,106,190,53,53,53,54,49,164,0,3,0,113,255,236,7,86,6,20,0,29,0,39,0,
+51,0,0,5,34,2,17,16,18,51,50,23,51,38,38,53,17,51,17,20,7,51,54,51,50,18,
+17,16,2,35,32,3,2,37,32,17,52,38,35,34,6,21,16,33,50,54,53,52,38,35,34,6,
+21,20,22,2,86,235,250,237,215,221,119,13,4,9,180,10,10,111,229,217,236,253,
+236,254,230,114,114,2,0,1,45,146,151,166,144,254,31,145,158,151,166,139,152,
+155,20,1,34,1,21,1,13,1,46,162,26,132,57,1,129,254,134,113,113,164,254,213,
+254,244,254,236,254,219,1,0,255,0,149,1,166,208,208,188,224,254,86,225,201,
+226,188,221,205,204,210,0,3,0,113,254,20,7,86,4,94,0,30,0,40,0,52,0,0,1,50,
+18,17,16,2,35,34,39,35,23,22,21,17,35,17,52,55,35,6,35,34,2,17,16,18,51,32,
+19,54,54,5,32,17,20,22,51,50,54,53,16,33,34,6,21,20,22,51,50,54,53,52,38,
+5,113,235,250,237,216,222,118,12,4,8,180,10,10,107,233,215,237,253,236,1,
+25,114,58,206,253,107,254,211,145,152,165,144,1,225,144,159,149,169,139,152,
+155,4,94,254,222,254,235,254,243,254,210,161,35,75,105,254,94,1,156,112,113,
+163,1,42,1,13,1,20,1,37,255,0,132,124,149,254,90,209,207,189,223,1,170,224,
+202,223,191,221,205,204,210,0,3,0,0,255,102,5,27,6,20,0,15,0,22,0,25,0,0,
+1,3,1,35,3,33,3,35,19,35,3,35,1,51,23,55,1,19,38,39,6,7,3,1,3,51,3,254,152,
+1,181,191,176,254,209,209,137,211,142,174,186,2,59,166,62,86,254,186,158,
+40,26,30,33,166,1,108,92,191,6,20,254,78,251,158,1,197,253,161,2,95,254,59,
+5,188,159,247,252,84,1,199,113,94,120,99,254,69,1,9,254,247,0,2,0,125,255,
+102,4,207,6,20,0,30,0,38,0,0,1,7,22,23,7,38,39,1,22,51,50,55,21,6,6,35,34,
+39,7,35,55,38,2,17,52,18,36,51,50,23,55,7,34,0,17,16,23,1,38,4,121,39,61,
+64,74,73,35,254,122,73,91,156,195,93,172,112,95,98,53,137,67,175,181,167,
+1,63,216,78,74,29,183,236,254,242,222,1,127,40,6,20,112,16,31,156,32,11,251,
+158,21,58,160,34,25,20,154,195,82,1,98,1,0,226,1,84,184,10,83,235,254,196,
+254,238,254,137,141,4,74,8,0,2,0,113,254,86,3,213,6,20,0,27,0,34,0,0,1,3,
+22,23,7,38,39,1,22,51,50,55,21,6,35,34,39,3,35,19,38,17,16,0,51,51,23,19,
+1,20,23,1,35,34,6,3,213,166,57,43,55,63,35,254,233,57,72,145,140,114,169,
+93,93,154,137,174,198,1,11,247,30,29,158,253,223,76,1,0,8,166,158,6,20,254,
+50,16,19,150,23,8,252,242,23,64,160,59,26,254,80,1,233,144,1,80,1,20,1,43,
+2,1,184,252,13,198,103,2,205,209,0,1,0,20,0,0,3,254,5,182,0,13,0,0,19,51,
+17,51,17,33,21,33,17,33,21,33,17,35,20,179,184,1,92,254,164,2,127,252,201,
+179,3,57,2,125,253,131,145,253,252,164,2,168,0,2,0,20,255,102,4,92,6,20,0,
+16,0,19,0,0,1,7,51,21,35,1,17,35,17,3,35,1,17,33,53,33,55,1,19,35,4,41,45,
+96,170,254,228,185,207,143,1,94,254,55,3,89,45,254,252,141,141,6,20,94,162,
+253,156,253,80,1,35,254,67,2,242,2,188,162,94,253,209,1,47,0,1,0,104,254,
+20,3,135,4,94,0,50,0,0,5,22,23,22,51,50,54,55,21,6,35,34,38,39,38,39,38,39,
+53,22,51,50,54,53,52,38,39,46,2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,
+30,2,21,20,6,1,225,37,23,34,181,39,89,19,70,96,163,170,31,27,127,69,44,181,
+168,136,124,119,152,155,126,59,220,192,187,163,61,167,134,112,116,100,183,
+137,131,62,210,18,54,98,172,18,9,148,29,150,172,142,34,18,25,164,88,88,74,
+65,90,58,60,85,106,76,135,156,74,143,70,71,62,60,79,70,51,88,110,77,147,167,
+0,1,0,80,254,20,3,172,4,74,0,24,0,0,37,22,22,23,22,22,51,50,55,21,6,35,34,
+38,39,38,38,35,35,53,1,33,53,33,21,1,31,112,132,36,23,115,100,70,65,59,88,
+167,184,49,26,109,106,72,2,78,253,213,2,241,139,20,147,142,91,81,23,148,25,
+144,178,97,73,119,3,71,140,135,0,1,0,4,0,0,3,76,5,203,0,21,0,0,51,17,54,54,
+53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,2,7,17,254,180,215,138,128,74,
+178,59,68,75,206,106,211,242,208,198,2,147,55,226,145,115,121,56,44,147,54,
+61,209,182,168,254,235,92,253,213,0,1,0,25,0,0,3,51,4,94,0,19,0,0,51,17,54,
+54,53,52,35,34,6,7,39,54,51,50,22,21,20,2,7,21,254,179,202,252,70,156,65,
+67,158,208,204,224,200,185,1,39,55,225,146,248,53,48,136,114,203,188,166,
+254,238,86,201,0,3,0,31,0,0,4,197,5,182,0,19,0,32,0,41,0,0,19,35,53,51,17,
+33,32,4,21,20,6,7,21,22,22,21,20,4,35,33,19,21,33,21,33,21,33,50,54,53,52,
+38,35,37,33,50,54,53,52,38,35,35,199,168,168,1,161,1,38,1,5,142,136,169,159,
+254,244,240,253,254,184,1,47,254,209,1,39,176,170,180,180,254,231,1,14,172,
+156,171,185,242,1,94,160,3,184,175,187,130,169,25,10,29,176,145,196,220,2,
+174,176,160,194,136,138,131,125,154,110,129,120,106,0,2,0,20,255,236,5,197,
+5,182,0,20,0,29,0,0,1,17,51,21,35,21,20,0,33,32,0,53,53,35,53,51,17,51,17,
+33,17,1,50,54,53,53,33,21,20,22,5,31,166,166,254,210,254,244,254,247,254,
+220,164,164,185,2,247,254,136,181,195,253,9,191,5,182,253,191,160,209,250,
+254,226,1,33,251,205,160,2,65,253,191,2,65,250,213,194,183,209,211,179,196,
+255,255,0,0,0,0,4,219,5,182,18,6,1,105,0,0,0,3,0,199,255,102,3,248,6,20,0,
+19,0,23,0,27,0,0,1,7,51,21,35,3,51,21,33,3,33,21,33,7,35,55,35,17,33,55,1,
+51,19,33,17,51,19,35,3,172,25,101,142,116,221,254,250,131,1,174,254,41,39,
+133,39,213,2,71,25,254,88,244,114,254,154,70,133,203,6,20,94,162,254,56,160,
+253,246,162,154,154,5,182,94,253,56,1,200,251,142,2,10,0,4,0,113,254,86,4,
+27,6,20,0,29,0,35,0,39,0,43,0,0,19,19,38,17,16,0,51,50,23,19,51,3,22,22,21,
+21,33,3,22,51,50,54,55,21,6,6,35,34,39,3,1,34,6,7,51,19,19,38,39,3,5,22,23,
+19,158,170,215,1,6,223,31,59,156,137,168,113,125,254,82,123,62,89,88,158,
+106,91,160,109,107,90,149,1,45,129,150,14,229,107,223,4,98,90,254,141,4,84,
+96,254,86,1,236,143,1,76,1,8,1,57,8,1,190,254,27,57,232,159,109,254,158,27,
+31,45,158,39,32,28,254,78,5,117,166,148,1,54,254,202,184,79,254,249,143,180,
+96,1,20,0,1,255,96,254,123,2,27,5,182,0,21,0,0,3,34,39,53,22,51,50,54,53,
+17,35,53,51,17,51,17,51,21,35,17,20,6,8,94,58,71,77,100,100,168,168,185,166,
+166,197,254,123,27,155,20,121,114,2,123,160,2,147,253,109,160,253,148,198,
+214,0,2,255,143,254,20,1,252,5,229,0,21,0,33,0,0,19,34,39,53,22,51,50,54,
+53,17,35,53,51,17,51,17,51,21,35,17,20,6,3,52,54,51,50,22,21,20,6,35,34,38,
+45,94,64,69,67,78,73,154,154,180,154,154,157,37,61,45,42,63,63,42,45,61,254,
+20,25,145,20,85,87,2,166,145,1,189,254,67,145,253,96,164,164,7,95,60,54,54,
+60,59,56,56,0,2,0,125,254,20,6,55,5,203,0,14,0,45,0,0,1,34,2,17,16,18,51,
+50,54,54,53,17,52,38,38,1,52,55,35,6,6,35,34,36,2,53,16,0,33,50,22,23,51,
+55,51,17,20,22,51,50,55,21,6,35,32,17,2,227,199,223,222,202,158,196,91,92,
+198,1,34,8,10,57,229,165,187,254,236,145,1,71,1,35,144,238,59,10,31,145,58,
+71,50,42,47,67,254,221,5,43,254,201,254,231,254,235,254,197,92,182,160,1,
+60,161,182,91,250,254,54,93,96,112,182,1,86,229,1,97,1,141,110,99,188,249,
+168,87,81,21,156,27,1,66,0,2,0,113,254,20,5,8,4,94,0,12,0,40,0,0,37,50,54,
+55,53,52,38,35,34,6,21,20,22,5,52,55,35,6,35,34,2,17,16,18,51,50,23,51,55,
+51,17,20,22,51,50,55,21,6,35,34,17,2,82,161,148,4,152,165,141,150,149,1,201,
+10,12,115,229,212,234,239,213,225,117,8,27,143,45,56,64,38,42,101,240,129,
+176,203,37,227,197,222,204,201,213,152,110,60,167,1,44,1,11,1,12,1,47,170,
+150,251,35,112,85,22,137,33,1,86,0,2,0,20,0,0,4,219,5,182,0,16,0,25,0,0,1,
+17,35,17,35,53,51,17,33,32,4,21,16,5,1,35,1,37,51,50,54,53,52,38,35,35,1,
+127,184,179,179,1,147,1,16,1,5,254,219,1,145,215,254,158,254,221,219,178,
+164,166,186,209,2,92,253,164,2,92,156,2,190,207,208,254,221,101,253,113,2,
+92,156,140,138,138,127,0,1,0,20,0,0,3,47,4,94,0,23,0,0,1,33,17,35,17,35,53,
+51,17,51,23,51,54,54,51,50,23,7,38,35,34,6,7,51,2,100,254,254,180,154,154,
+148,20,8,63,172,101,73,56,22,61,58,117,179,20,254,1,252,254,4,1,252,145,1,
+189,201,109,112,12,166,14,166,135,0,2,0,0,0,0,4,135,5,182,0,17,0,20,0,0,1,
+33,19,51,3,51,21,35,1,17,35,17,1,35,53,51,3,51,1,19,33,1,82,1,227,140,198,
+143,123,209,254,254,185,254,252,207,121,141,201,1,123,157,254,197,4,176,1,
+6,254,250,160,254,39,253,201,2,47,1,225,160,1,6,253,49,1,41,0,2,0,2,254,20,
+4,20,4,74,0,26,0,33,0,0,19,35,53,51,3,51,19,33,19,51,3,51,21,35,1,6,6,35,
+34,39,53,22,51,50,54,63,2,54,19,33,22,22,23,205,185,127,145,193,137,1,131,
+131,194,137,117,172,254,231,69,190,140,75,74,50,70,86,120,38,57,88,25,111,
+254,231,63,61,13,2,78,145,1,107,254,149,1,107,254,149,145,253,26,182,158,
+17,143,12,95,99,146,178,106,1,54,165,178,73,255,255,0,166,255,236,4,31,4,
+92,16,15,0,68,4,125,4,72,192,0,0,2,0,113,255,236,4,61,4,94,0,16,0,29,0,0,
+5,34,2,17,16,18,51,50,23,51,55,51,17,35,39,35,6,39,50,54,53,53,52,38,35,34,
+6,21,20,22,2,51,214,236,237,215,221,119,8,29,143,145,27,8,115,198,164,151,
+153,164,139,152,151,20,1,40,1,15,1,13,1,46,162,142,251,182,147,167,149,179,
+204,33,229,195,221,205,204,210,255,255,0,175,255,236,4,123,4,94,16,15,4,64,
+4,236,4,74,192,0,0,2,0,174,255,236,4,123,6,31,0,29,0,42,0,0,19,16,51,50,23,
+21,38,35,34,6,21,21,20,7,51,54,51,50,18,17,16,2,35,34,38,39,35,6,7,35,1,34,
+6,21,21,20,22,51,50,54,53,52,38,174,248,69,66,47,59,47,50,10,10,111,229,217,
+236,240,213,111,174,55,14,31,6,129,1,234,166,144,147,167,148,145,146,5,0,
+1,31,27,149,20,54,65,114,113,113,164,254,213,254,244,254,240,254,215,80,79,
+120,19,3,199,188,224,8,225,193,217,205,208,208,0,1,0,68,255,236,3,102,4,94,
+0,23,0,0,55,22,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,0,17,16,0,35,34,
+39,86,140,139,165,154,160,162,55,134,50,55,49,160,94,237,1,6,254,245,241,
+162,114,199,64,211,207,198,212,29,25,150,25,34,254,219,254,242,254,233,254,
+216,59,0,2,0,98,255,156,3,233,4,94,0,29,0,39,0,0,5,34,39,6,7,39,54,55,38,
+53,16,0,51,50,22,23,7,38,35,32,17,20,23,54,51,50,22,21,20,6,3,34,7,22,51,
+50,54,53,52,38,2,129,205,125,43,32,138,43,64,78,1,11,247,84,155,50,56,139,
+98,254,188,21,160,194,142,171,199,126,151,119,82,151,87,105,81,20,98,81,97,
+63,126,110,133,211,1,20,1,43,34,25,150,52,254,96,105,78,158,135,115,133,157,
+1,135,148,94,77,60,48,57,0,2,0,113,254,20,5,39,6,20,0,31,0,44,0,0,5,20,22,
+51,50,55,21,6,35,32,17,53,52,54,55,35,6,35,34,2,17,16,18,51,50,23,51,38,38,
+53,17,51,1,50,54,53,53,52,38,35,34,6,21,20,22,4,61,49,68,73,44,47,109,254,
+254,10,3,13,118,222,215,237,237,215,221,119,13,3,10,180,254,19,164,151,153,
+164,139,152,151,147,106,91,22,137,33,1,86,130,24,119,18,161,1,42,1,13,1,13,
+1,46,162,20,121,21,1,182,250,109,179,204,33,229,195,221,205,204,210,0,2,0,
+113,255,236,5,8,6,31,0,28,0,41,0,0,1,16,51,50,23,21,38,35,34,6,21,17,35,39,
+35,6,35,34,2,17,16,18,51,50,23,51,38,38,53,1,50,54,53,53,52,38,35,34,6,21,
+20,22,3,137,248,72,63,47,59,47,50,145,27,8,115,227,214,236,237,215,221,119,
+13,3,10,254,199,164,151,153,164,139,152,151,5,0,1,31,27,149,20,54,65,250,
+244,147,167,1,40,1,15,1,13,1,46,162,20,121,21,252,35,179,204,33,229,195,221,
+205,204,210,255,255,0,104,255,236,4,18,4,94,16,71,0,72,4,131,0,0,192,0,64,
+0,0,2,0,104,255,236,4,18,4,94,0,20,0,27,0,0,1,50,0,17,16,0,35,34,2,53,53,
+33,38,38,35,34,6,7,53,54,54,19,50,54,55,33,22,22,2,2,248,1,24,254,250,223,
+207,246,2,240,5,180,165,88,158,106,91,160,154,129,150,14,253,209,2,136,4,
+94,254,213,254,250,254,248,254,199,1,11,228,109,186,195,31,45,158,39,32,252,
+33,166,147,151,162,0,2,0,104,255,236,6,27,4,94,0,35,0,43,0,0,1,6,35,34,3,
+7,23,21,16,0,35,34,2,53,53,37,38,38,35,34,6,7,53,54,54,51,50,4,23,55,23,22,
+22,51,50,55,1,50,54,54,53,5,22,22,6,27,115,123,183,75,27,2,254,250,223,207,
+246,2,228,28,171,139,88,158,106,91,160,109,196,1,10,44,174,35,23,62,46,82,
+84,252,57,92,135,70,253,207,11,135,1,170,78,1,2,6,21,22,254,248,254,199,1,
+11,228,17,200,133,140,31,45,158,39,32,197,180,47,122,85,75,55,254,78,89,169,
+164,152,130,140,255,255,0,88,255,236,3,152,4,94,18,6,1,130,0,0,255,255,0,
+68,255,236,3,143,4,94,18,6,1,209,0,0,0,1,0,68,255,236,5,51,4,94,0,48,0,0,
+1,32,53,52,35,34,6,7,39,54,51,50,22,23,55,23,22,22,51,50,55,23,6,6,35,34,
+39,6,7,21,22,22,21,20,6,35,34,39,53,22,51,50,54,53,52,38,35,35,53,1,135,1,
+55,249,79,136,95,63,171,212,145,200,42,111,34,23,62,46,79,87,39,49,125,63,
+168,76,47,135,125,118,250,219,242,132,183,189,141,152,154,159,148,2,133,168,
+156,30,40,143,76,91,85,31,123,85,75,55,133,34,46,185,95,36,8,36,136,103,151,
+172,71,162,86,94,92,94,91,147,0,2,0,113,255,236,4,113,4,94,0,17,0,35,0,0,
+1,34,6,21,20,22,51,32,53,52,38,35,35,53,51,32,53,52,37,50,22,21,20,7,21,22,
+22,21,20,6,35,32,0,17,16,0,2,147,183,177,174,189,1,40,154,159,86,57,1,56,
+254,248,204,232,207,127,117,254,226,254,253,254,227,1,32,3,199,208,208,214,
+208,184,94,91,147,168,154,151,153,136,186,57,8,36,136,103,150,173,1,40,1,
+19,1,15,1,40,0,1,255,143,254,20,1,252,4,74,0,21,0,0,19,51,17,51,17,51,21,
+35,17,20,6,35,34,39,53,22,51,50,54,53,17,35,20,154,180,154,154,157,152,94,
+64,69,67,78,73,154,2,141,1,189,254,67,145,253,96,164,164,25,145,20,85,87,
+2,166,0,2,0,111,254,20,5,8,6,31,0,37,0,50,0,0,19,22,51,50,54,53,53,55,35,
+6,35,34,2,17,16,18,51,50,23,51,38,53,53,16,51,50,23,21,38,35,34,21,17,20,
+6,35,34,39,1,50,54,53,53,52,38,35,34,6,21,20,22,197,160,245,140,163,6,8,111,
+229,213,239,241,209,223,121,13,13,250,70,63,47,59,99,239,252,240,155,1,137,
+166,151,152,169,138,151,147,255,0,86,164,145,43,135,165,1,41,1,14,1,9,1,50,
+166,117,64,147,1,31,27,149,20,119,250,226,236,238,70,2,37,179,198,43,220,
+200,219,203,204,214,255,255,0,113,254,20,4,61,4,94,18,6,0,74,0,0,0,1,0,113,
+255,236,4,4,4,94,0,25,0,0,37,6,6,35,34,0,17,16,0,33,50,23,7,38,35,32,17,20,
+22,51,50,55,17,35,53,33,4,4,120,188,106,237,254,248,1,35,1,2,227,123,66,146,
+128,254,139,158,155,131,105,236,1,160,57,43,34,1,35,1,16,1,20,1,43,74,155,
+72,254,96,199,211,29,1,45,145,0,2,0,0,254,25,4,16,4,74,0,24,0,36,0,0,37,22,
+22,21,20,6,35,34,38,53,52,54,55,1,51,19,22,22,23,51,62,2,19,51,1,52,38,39,
+6,6,21,20,22,51,50,54,2,109,81,52,133,103,106,129,57,76,254,96,193,208,60,
+42,11,8,9,36,43,238,192,254,66,41,35,36,40,45,31,31,45,162,159,167,69,111,
+143,143,111,79,176,140,3,168,254,18,141,118,46,33,94,110,2,50,250,209,50,
+131,58,60,127,50,59,52,50,0,2,255,250,255,238,4,20,4,94,0,9,0,49,0,0,37,52,
+39,6,21,20,22,51,50,54,19,22,21,20,6,35,34,38,53,52,54,55,1,38,35,34,7,53,
+54,51,50,22,23,18,22,23,51,54,55,55,54,54,51,50,23,21,38,35,34,7,2,82,76,
+76,45,31,31,45,20,140,128,108,108,127,56,83,254,229,38,46,24,37,46,58,52,
+71,39,195,46,13,8,33,68,155,39,73,50,59,45,37,24,46,34,221,88,103,107,82,
+49,43,41,1,107,191,133,103,126,126,105,72,139,111,1,127,53,10,133,24,41,55,
+254,243,73,33,60,100,215,54,42,24,133,10,47,0,1,0,166,254,20,4,68,4,74,0,
+22,0,0,1,17,20,22,51,50,54,53,17,51,17,35,17,52,55,35,6,6,35,34,38,53,17,
+1,88,119,127,167,154,181,181,11,13,50,179,113,205,196,4,74,253,65,133,131,
+184,215,2,56,249,202,1,234,84,70,81,89,195,206,2,203,0,1,0,174,0,0,4,76,6,
+31,0,31,0,0,19,16,51,50,23,21,38,35,34,6,21,21,20,7,51,54,54,51,50,22,21,
+17,35,17,52,38,35,34,6,21,17,35,174,250,67,66,47,59,47,50,10,12,49,180,113,
+200,202,178,119,127,167,155,180,5,0,1,31,27,149,20,54,65,192,90,64,80,90,
+191,210,253,53,2,190,134,131,186,214,253,201,0,1,0,174,254,20,4,76,6,31,0,
+40,0,0,1,52,38,35,34,6,21,17,35,17,16,51,50,23,21,38,35,34,6,21,21,20,7,51,
+54,54,51,50,22,21,17,16,35,34,39,53,22,51,50,54,53,3,154,119,127,167,155,
+180,250,67,66,47,59,47,50,10,12,49,180,113,200,202,248,67,66,42,64,47,50,
+2,190,134,131,186,214,253,201,5,0,1,31,27,149,20,54,65,192,90,64,80,90,191,
+210,252,104,254,225,27,150,21,54,65,0,2,0,20,0,0,1,252,5,229,0,11,0,23,0,
+0,1,51,21,35,17,35,17,35,53,51,17,51,3,52,54,51,50,22,21,20,6,35,34,38,1,
+98,154,154,180,154,154,180,194,61,45,42,63,63,42,45,61,2,141,145,254,4,1,
+252,145,1,189,1,41,60,54,54,60,59,56,56,255,255,0,168,255,236,2,160,4,74,
+18,6,1,134,0,0,0,1,0,74,0,0,2,70,4,74,0,11,0,0,33,33,53,55,17,39,53,33,21,
+7,17,23,2,70,254,4,164,164,1,252,164,164,106,35,3,45,37,107,107,37,252,211,
+35,0,1,0,10,0,0,2,252,6,20,0,27,0,0,1,34,39,17,35,17,38,35,34,6,7,35,54,54,
+51,50,23,17,51,17,22,51,50,54,55,51,6,6,2,29,29,35,180,43,27,49,49,14,105,
+13,115,98,26,35,180,43,29,48,49,16,102,12,117,2,147,11,253,98,2,246,18,59,
+60,122,141,11,2,135,253,33,18,59,60,123,140,0,2,255,236,0,0,2,184,6,20,0,
+17,0,26,0,0,19,34,38,53,52,54,51,50,23,17,51,17,51,21,35,17,35,17,3,34,6,
+21,20,51,51,53,52,217,116,121,115,104,65,39,180,213,213,180,88,40,32,88,72,
+2,96,111,104,99,114,37,2,45,252,224,148,253,160,2,96,1,25,41,25,67,22,111,
+0,1,0,174,254,20,2,137,6,20,0,13,0,0,1,17,20,22,51,50,55,21,6,35,34,38,53,
+17,1,96,74,84,75,64,68,96,164,147,6,20,249,89,100,97,22,137,33,170,172,6,
+170,0,1,0,174,254,20,4,252,6,20,0,29,0,0,1,33,21,1,22,4,21,20,6,6,35,34,39,
+53,22,51,50,54,53,52,38,35,35,53,1,33,17,35,17,51,1,98,3,99,254,63,235,1,
+13,134,249,160,239,140,183,204,162,193,208,206,121,1,193,253,112,180,180,
+4,74,131,254,12,16,248,201,144,225,125,72,164,86,186,154,157,169,125,1,241,
+252,78,6,20,255,255,0,166,255,236,6,205,4,74,16,15,0,80,7,123,4,74,192,0,
+0,1,0,166,254,20,6,205,4,74,0,37,0,0,1,17,52,54,55,35,6,6,35,32,39,35,6,6,
+35,34,38,53,17,51,17,16,51,50,54,53,17,51,17,20,22,51,50,54,53,17,51,17,6,
+25,9,3,14,50,170,104,254,254,78,10,53,183,116,186,185,178,223,152,145,178,
+110,116,152,141,180,254,20,1,224,15,139,8,83,87,184,88,96,191,212,2,203,253,
+61,254,252,175,186,2,94,253,61,130,130,187,210,2,58,249,202,0,1,0,174,254,
+20,6,213,4,94,0,42,0,0,1,16,35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,
+51,23,51,54,54,51,32,23,51,54,54,51,50,22,21,17,16,35,34,39,53,22,51,50,53,
+6,35,223,153,144,179,109,116,152,141,180,145,27,10,47,171,106,1,2,78,10,53,
+183,116,186,185,248,67,66,42,65,96,2,195,1,4,178,183,253,162,2,195,130,130,
+186,212,253,199,4,74,150,80,90,184,88,96,192,211,252,104,254,225,27,150,21,
+119,0,1,255,197,254,20,4,76,4,94,0,29,0,0,5,16,33,34,39,53,22,51,50,54,53,
+17,51,23,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,1,98,254,242,93,50,
+47,59,72,55,145,27,10,51,184,111,202,196,178,119,127,169,153,150,254,170,
+33,137,22,89,108,4,221,150,81,89,196,207,253,53,2,190,134,131,187,211,0,1,
+0,174,254,20,5,53,4,94,0,32,0,0,5,20,22,51,50,54,55,21,6,6,35,34,38,53,17,
+52,38,35,34,6,21,17,35,17,51,23,51,54,54,51,50,22,21,4,76,53,72,28,63,17,
+21,79,43,137,131,119,127,169,153,180,145,27,10,51,184,111,202,196,147,106,
+91,14,8,137,14,19,173,169,3,84,134,131,187,211,253,199,4,74,150,81,89,196,
+207,0,1,0,174,0,0,4,96,4,74,0,14,0,0,1,17,35,1,22,21,17,35,17,51,1,38,38,
+53,17,4,96,223,253,207,8,170,221,2,56,2,11,4,74,251,182,3,115,160,111,253,
+156,4,74,252,139,26,185,39,2,123,255,255,0,113,255,236,4,104,4,94,18,6,2,
+124,0,0,0,2,0,113,255,236,6,127,4,94,0,23,0,35,0,0,33,33,53,6,35,34,38,2,
+53,16,0,51,50,23,53,33,21,33,17,33,21,33,17,33,1,20,22,51,50,54,53,52,38,
+35,34,6,6,127,253,47,129,197,149,230,124,1,12,242,192,127,2,209,253,217,2,
+6,253,250,2,39,250,172,163,159,157,164,165,159,145,174,111,131,139,1,4,172,
+1,12,1,43,133,113,150,254,211,149,254,164,1,145,207,215,215,207,207,209,226,
+0,2,0,115,255,236,5,207,4,94,0,20,0,37,0,0,1,52,0,35,34,0,21,20,22,51,50,
+54,53,17,51,17,20,22,51,50,54,55,20,2,35,34,39,35,6,35,34,2,53,16,0,33,32,
+0,5,27,254,251,241,243,254,245,118,105,95,102,172,101,93,104,122,180,207,
+184,222,69,10,65,224,183,208,1,103,1,75,1,66,1,104,1,213,240,1,4,254,251,
+239,161,179,142,124,1,13,254,243,128,138,172,164,226,254,253,184,184,1,3,
+226,1,53,1,88,254,165,255,255,0,111,254,20,5,92,6,20,18,6,1,222,0,0,255,255,
+0,31,255,236,2,160,4,74,16,15,0,85,3,78,4,74,192,0,0,1,0,31,255,236,2,160,
+6,20,0,17,0,0,23,34,39,55,22,51,50,54,54,53,17,51,17,35,39,35,6,6,160,73,
+56,22,65,54,87,148,85,180,148,20,8,62,174,20,12,166,15,96,170,103,4,20,249,
+236,201,107,114,0,1,0,31,254,20,3,137,4,74,0,29,0,0,5,20,22,51,50,55,21,6,
+35,32,17,53,52,54,55,35,6,6,35,34,39,55,22,51,50,54,54,53,17,51,2,160,51,
+65,76,41,47,110,255,0,9,3,8,62,174,100,73,56,22,65,54,87,148,85,180,147,108,
+89,22,137,33,1,86,189,15,139,8,107,114,12,166,15,96,170,103,2,74,0,1,0,174,
+254,20,3,47,4,94,0,17,0,0,1,50,23,7,38,35,34,6,6,21,17,35,17,51,23,51,54,
+54,2,174,73,56,22,61,58,87,149,84,180,148,20,8,63,172,4,94,12,166,14,96,169,
+103,251,202,6,54,201,109,112,0,1,0,174,254,20,3,47,4,94,0,27,0,0,19,51,23,
+51,54,54,51,50,23,7,38,35,34,6,6,21,17,20,22,51,50,55,21,6,35,34,38,53,174,
+148,20,8,63,172,101,73,56,22,61,58,87,149,84,72,84,61,64,68,82,164,147,4,
+74,201,109,112,12,166,14,96,169,103,253,35,100,97,22,137,33,170,172,0,1,0,
+168,0,0,2,160,4,94,0,14,0,0,51,17,52,54,51,50,23,7,38,38,35,34,6,21,17,168,
+154,174,82,94,23,26,78,56,72,71,3,8,175,167,33,153,8,23,90,99,252,250,0,1,
+0,37,254,20,2,29,4,94,0,14,0,0,1,17,52,38,35,34,6,7,39,54,51,50,22,21,17,
+1,106,71,72,56,78,26,22,94,82,173,155,254,20,4,242,99,90,23,8,153,33,167,
+175,251,12,0,2,0,174,0,0,4,88,4,74,0,13,0,21,0,0,1,33,17,35,17,33,50,22,21,
+20,6,7,1,35,3,52,38,35,33,17,33,32,2,109,254,245,180,1,236,183,206,130,126,
+1,57,209,22,118,116,254,219,1,2,1,13,1,180,254,76,4,74,172,152,120,161,32,
+254,51,3,4,85,91,254,150,255,255,0,174,0,0,4,88,4,74,16,71,4,111,0,0,4,74,
+64,0,192,0,0,1,0,104,254,20,3,121,4,94,0,47,0,0,1,20,6,35,34,39,21,20,22,
+51,50,55,21,6,35,34,38,53,17,22,51,50,54,53,52,38,39,46,2,53,52,54,51,50,
+23,7,38,35,34,6,21,20,22,23,30,2,3,121,230,208,94,70,72,83,61,64,68,81,163,
+149,181,168,136,124,119,152,155,126,59,220,192,187,163,61,167,134,112,116,
+100,183,137,131,62,1,47,154,169,12,139,100,97,22,137,33,169,173,1,107,88,
+88,74,65,90,58,60,85,106,76,135,156,74,143,70,71,62,60,79,70,51,88,110,0,
+1,255,197,254,20,2,76,6,31,0,22,0,0,5,16,33,34,39,53,22,51,50,54,53,17,16,
+33,50,23,21,38,38,35,34,6,21,1,98,254,242,93,50,47,59,72,55,1,14,92,52,17,
+62,28,72,55,150,254,170,33,137,22,89,108,5,92,1,86,33,137,8,14,89,107,0,1,
+255,197,254,20,2,76,6,31,0,30,0,0,1,51,21,35,17,16,33,34,39,53,22,51,50,54,
+53,17,35,53,51,17,16,33,50,23,21,38,38,35,34,6,21,1,98,154,154,254,242,93,
+50,47,59,72,55,154,154,1,14,92,52,17,62,28,72,55,2,141,145,253,110,254,170,
+33,137,22,89,108,2,143,145,2,60,1,86,33,137,8,14,89,107,0,1,255,227,254,20,
+2,76,4,94,0,23,0,0,19,52,38,35,34,7,53,54,51,50,22,21,17,20,22,51,50,54,55,
+21,6,35,32,17,174,56,55,46,46,47,86,125,125,54,73,28,62,17,52,92,254,242,
+3,20,100,83,23,137,33,163,158,252,80,108,89,14,8,137,33,1,86,0,2,255,31,254,
+20,2,76,6,31,0,25,0,33,0,0,51,17,16,33,50,23,21,38,38,35,34,6,21,17,51,21,
+35,6,6,35,34,38,53,52,54,51,3,50,54,55,35,34,21,20,174,1,14,92,52,17,62,28,
+72,55,154,154,3,140,143,132,161,150,147,19,66,53,2,90,139,4,201,1,86,33,137,
+8,14,89,107,251,57,147,171,174,135,107,123,127,254,168,85,112,99,98,0,1,0,
+45,0,0,2,195,5,90,0,21,0,0,19,34,7,53,54,54,51,32,17,17,51,21,7,7,35,53,33,
+53,33,17,52,38,199,79,75,31,105,48,1,66,156,158,72,106,254,194,1,62,90,4,
+199,23,137,14,19,254,172,253,129,86,72,233,252,139,2,123,92,105,0,1,0,33,
+254,20,2,182,5,70,0,21,0,0,1,50,55,21,6,6,35,32,17,17,35,53,55,55,51,21,33,
+21,33,17,20,22,2,29,96,57,29,102,53,254,190,155,157,72,107,1,61,254,195,91,
+254,168,22,137,13,20,1,84,4,86,86,72,234,252,140,251,175,95,102,0,2,0,20,
+255,236,4,221,4,74,0,23,0,31,0,0,1,17,33,17,51,17,51,21,35,17,35,39,35,6,
+6,35,34,38,53,53,35,53,51,17,1,50,54,55,33,21,20,22,1,88,2,55,181,153,153,
+148,26,9,49,180,119,198,201,142,142,1,170,164,157,2,253,201,119,4,74,254,
+78,1,178,254,78,146,253,250,145,79,86,190,209,139,146,1,178,252,55,182,207,
+127,133,129,0,1,0,61,255,236,4,154,4,74,0,31,0,0,1,22,17,20,0,35,34,38,38,
+53,52,54,55,33,53,33,21,6,6,21,20,22,51,50,54,53,52,2,39,53,33,21,3,143,217,
+254,238,238,146,230,127,109,106,254,245,1,228,111,135,165,157,154,167,144,
+104,1,228,3,180,172,254,234,241,254,235,127,235,154,152,220,80,150,142,50,
+252,158,176,191,191,178,149,1,8,45,142,150,0,1,0,166,255,236,4,72,4,94,0,
+27,0,0,1,52,38,35,34,7,53,54,51,50,22,21,17,20,6,35,34,38,17,17,51,17,20,
+22,51,50,54,53,3,147,61,80,58,59,70,59,167,143,229,236,242,223,180,131,154,
+154,130,3,6,108,81,19,154,20,161,177,254,207,248,247,239,1,0,2,111,253,151,
+190,162,166,186,0,1,0,0,0,0,4,16,4,74,0,12,0,0,1,1,35,3,38,39,35,14,2,3,35,
+1,2,113,1,159,192,234,70,18,8,5,30,41,249,193,1,162,4,74,251,182,2,135,199,
+92,27,96,123,253,76,4,74,0,1,0,23,0,0,6,51,4,74,0,28,0,0,1,19,22,23,51,54,
+55,19,51,1,35,3,38,38,39,35,6,7,3,35,2,2,39,35,6,6,3,35,1,2,27,188,31,45,
+8,40,34,196,205,1,45,186,152,45,21,5,9,29,44,195,196,125,127,11,8,5,38,184,
+184,1,49,4,74,253,149,101,190,188,105,2,105,251,182,2,74,182,105,40,146,149,
+253,150,1,153,1,159,87,38,170,253,65,4,74,0,1,0,0,0,0,4,18,6,31,0,22,0,0,
+33,35,3,38,39,35,6,7,3,35,1,54,54,51,50,23,21,38,35,34,6,7,7,4,18,192,238,
+72,20,8,26,68,223,195,1,217,67,190,142,87,63,53,68,94,116,34,57,2,102,189,
+104,106,189,253,156,4,207,178,158,17,143,12,102,88,144,0,1,0,0,0,0,3,203,
+4,74,0,8,0,0,33,35,17,1,51,1,1,51,1,2,66,181,254,115,205,1,26,1,25,203,254,
+119,1,197,2,133,254,16,1,240,253,123,0,1,0,80,254,20,4,92,4,74,0,23,0,0,33,
+33,53,1,33,53,33,21,1,33,17,20,22,51,50,54,55,21,6,6,35,34,38,53,2,201,253,
+135,2,78,253,213,2,241,253,187,2,84,53,72,23,67,18,22,78,43,135,125,119,3,
+71,140,135,252,200,254,226,106,91,13,9,137,14,19,171,171,0,2,0,80,255,78,
+4,66,4,74,0,21,0,30,0,0,33,6,7,39,55,33,53,1,33,53,33,21,1,51,54,54,51,50,
+22,21,20,33,19,34,6,7,51,50,53,52,38,2,41,30,44,137,49,254,201,2,78,253,213,
+2,241,253,187,170,89,184,118,105,137,254,174,79,55,101,54,141,158,44,60,118,
+57,121,119,3,71,140,135,252,200,176,150,125,88,252,1,70,90,97,109,29,49,255,
+255,0,29,254,20,3,182,4,74,18,6,2,231,0,0,0,2,255,215,254,20,4,31,4,74,0,
+33,0,43,0,0,19,1,33,53,33,21,1,22,4,21,20,7,22,23,7,38,39,6,33,34,38,38,53,
+52,54,51,50,23,54,53,52,38,35,35,19,50,55,38,35,34,6,21,20,22,236,1,192,253,
+141,3,70,254,63,235,1,13,51,102,54,117,79,62,169,254,238,111,181,103,185,
+155,236,221,14,208,206,120,118,200,116,181,186,83,91,124,1,193,1,241,152,
+131,254,12,16,248,201,117,100,100,66,111,90,58,148,70,131,90,114,136,149,
+54,44,157,169,253,102,106,136,57,48,62,75,0,1,0,25,0,0,3,51,6,31,0,19,0,0,
+51,17,54,54,53,52,35,34,6,7,39,54,51,50,22,21,20,2,7,17,254,175,206,252,71,
+157,63,67,156,210,205,223,199,186,2,231,54,224,148,248,54,46,135,115,204,
+187,167,254,239,87,253,119,255,255,0,53,0,0,3,79,6,31,16,71,4,131,3,104,0,
+0,192,0,64,0,0,1,0,25,255,236,3,51,6,20,0,19,0,0,1,17,22,18,21,20,6,35,34,
+39,55,22,22,51,50,53,52,38,39,17,1,178,185,200,224,204,208,158,67,62,159,
+70,252,201,180,6,20,253,109,86,254,238,166,189,202,114,135,46,54,248,146,
+223,57,2,241,0,1,0,113,254,23,3,147,4,94,0,22,0,0,1,34,2,17,16,0,33,50,22,
+23,7,38,35,34,2,17,16,18,51,50,55,21,6,2,102,254,247,1,0,1,2,80,157,51,55,
+139,98,166,158,147,166,145,140,114,254,23,1,130,1,152,1,146,1,155,33,26,150,
+52,254,189,254,183,254,181,254,200,64,160,59,255,255,0,125,255,236,5,195,
+5,205,18,38,0,50,0,0,16,7,0,121,2,14,0,0,255,255,0,174,0,0,4,88,4,74,18,6,
+1,204,0,0,0,2,0,92,255,236,4,92,4,94,0,16,0,34,0,0,1,32,21,20,33,51,21,35,
+32,21,20,33,50,54,53,52,38,39,32,0,17,16,0,33,34,38,53,52,54,55,53,38,53,
+52,54,2,57,254,244,1,55,58,86,254,198,1,41,189,174,177,188,1,8,1,31,254,225,
+254,254,225,254,117,127,207,232,3,199,154,168,147,185,184,208,214,208,208,
+151,254,215,254,242,254,237,254,216,173,150,103,135,37,8,57,186,136,153,0,
+1,0,113,255,236,4,190,6,31,0,37,0,0,37,6,6,35,34,0,17,16,0,33,50,23,53,52,
+54,51,50,23,21,38,35,34,21,17,7,38,35,32,17,20,22,51,50,55,17,35,53,33,4,
+4,120,188,106,237,254,248,1,35,1,2,108,86,110,126,59,63,47,59,96,66,146,128,
+254,139,158,155,131,105,236,1,160,57,43,34,1,35,1,16,1,20,1,43,18,192,132,
+143,27,149,20,98,254,243,155,72,254,96,199,211,29,1,45,145,255,255,0,174,
+0,0,4,106,4,74,18,6,1,215,0,0,0,3,255,61,254,20,1,252,5,229,0,15,0,23,0,35,
+0,0,19,51,17,51,21,35,6,6,35,34,38,53,52,54,51,51,3,50,54,55,35,34,21,20,
+19,52,54,51,50,22,21,20,6,35,34,38,174,180,154,154,3,134,135,122,155,143,
+138,88,104,57,45,2,78,121,185,61,45,42,63,63,42,45,61,4,74,251,182,147,174,
+171,133,109,122,128,254,168,86,111,99,98,6,203,60,54,54,60,59,56,56,0,1,0,
+18,254,20,3,152,4,74,0,15,0,0,1,6,7,1,35,1,1,51,1,55,17,51,17,35,17,55,2,
+229,79,52,254,162,211,1,189,254,36,218,1,124,125,179,179,9,2,20,105,56,254,
+141,1,213,2,117,254,0,108,1,148,249,202,3,78,178,0,1,0,174,0,0,3,86,4,74,
+0,5,0,0,19,51,17,33,21,33,174,180,1,244,253,88,4,74,252,76,150,0,2,0,113,
+254,20,5,39,6,31,0,31,0,44,0,0,1,16,33,50,23,21,38,35,34,6,21,17,35,17,52,
+54,55,35,6,35,34,2,17,16,18,51,50,23,51,38,38,53,1,50,54,53,53,52,38,35,34,
+6,21,20,22,3,137,1,2,109,47,44,73,68,49,180,10,3,13,118,222,215,237,237,215,
+221,119,13,3,10,254,199,164,151,153,164,139,152,151,4,201,1,86,33,137,22,
+91,105,249,77,1,216,24,119,18,161,1,42,1,13,1,13,1,46,162,20,121,21,252,35,
+179,204,33,229,195,221,205,204,210,0,1,0,25,0,0,3,51,6,31,0,27,0,0,33,17,
+35,53,51,17,54,54,53,52,35,34,6,7,39,54,51,50,22,21,20,2,7,21,51,21,35,17,
+1,18,186,186,166,195,252,71,157,63,67,156,210,205,223,191,173,221,221,1,80,
+149,1,2,56,226,144,248,54,46,135,115,204,187,162,254,234,87,164,149,254,176,
+0,1,0,53,0,0,3,80,6,31,0,27,0,0,19,51,53,38,2,53,52,54,51,50,23,7,38,38,35,
+34,21,20,22,23,17,51,21,35,17,35,17,35,197,221,175,190,224,204,211,156,68,
+62,159,70,251,197,163,186,186,180,221,1,229,164,89,1,20,162,187,204,115,135,
+46,54,248,145,226,55,254,254,149,254,176,1,80,0,3,0,113,255,236,7,94,6,20,
+0,24,0,37,0,40,0,0,5,34,2,17,16,18,51,50,23,51,38,38,53,17,51,17,33,21,1,
+33,21,33,39,35,6,39,50,54,53,53,52,38,35,34,6,21,20,22,1,17,1,2,51,214,236,
+237,215,221,119,13,3,10,180,3,19,253,186,2,84,252,78,27,8,115,198,164,151,
+153,164,139,152,151,2,123,2,76,20,1,40,1,15,1,13,1,46,162,20,121,21,1,182,
+254,54,135,252,200,139,147,167,149,179,204,33,229,195,221,205,204,210,3,61,
+252,187,3,69,0,2,0,113,254,20,7,147,6,20,0,45,0,58,0,0,1,22,4,21,20,6,6,35,
+34,39,53,22,51,50,54,53,52,38,35,35,53,1,33,17,35,39,35,6,35,34,2,17,16,18,
+51,50,23,51,38,38,53,17,51,17,33,21,1,50,54,53,53,52,38,35,34,6,21,20,22,
+5,156,235,1,12,134,249,159,239,140,183,204,162,192,208,205,121,1,192,253,
+180,145,27,8,115,227,214,236,237,215,221,119,13,3,10,180,3,31,250,244,164,
+151,153,164,139,152,151,1,211,16,248,201,144,226,124,72,164,86,185,155,157,
+169,125,1,241,252,78,147,167,1,40,1,15,1,13,1,46,162,20,121,21,1,182,254,
+54,131,252,186,179,204,33,229,195,221,205,204,210,0,4,0,113,255,78,8,45,6,
+20,0,37,0,50,0,53,0,62,0,0,37,51,54,54,51,50,22,21,20,33,35,6,7,39,54,55,
+33,39,35,6,35,34,2,17,16,18,51,50,23,51,38,38,53,17,51,17,33,21,1,50,54,53,
+53,52,38,35,34,6,21,20,22,1,17,1,19,34,6,7,51,50,53,52,38,5,10,170,87,185,
+119,105,137,254,174,199,40,33,137,30,19,254,57,27,8,115,227,214,236,237,215,
+221,119,13,3,10,180,3,19,251,0,164,151,153,164,139,152,151,2,123,2,76,162,
+56,101,54,141,158,44,139,172,154,125,88,252,84,94,57,80,41,147,167,1,40,1,
+15,1,13,1,46,162,20,121,21,1,182,254,54,135,252,190,179,204,33,229,195,221,
+205,204,210,3,61,252,187,3,69,253,136,90,97,109,29,49,0,2,0,33,0,0,5,182,
+5,70,0,29,0,47,0,0,1,20,6,35,33,32,17,17,35,53,55,55,51,21,33,54,51,50,23,
+7,38,35,34,6,21,20,22,23,22,22,1,50,54,53,52,38,39,46,2,53,52,55,33,17,20,
+22,51,5,182,224,214,253,254,254,190,155,157,72,107,2,37,84,88,185,165,62,
+167,134,111,116,100,183,190,139,254,78,137,123,116,154,155,126,59,33,254,
+170,96,76,1,47,150,153,1,84,2,106,86,72,234,252,20,74,143,70,71,62,60,79,
+70,71,144,254,245,65,75,64,90,59,60,85,106,76,71,60,253,154,100,97,0,2,0,
+33,254,20,4,78,6,31,0,36,0,44,0,0,5,16,33,34,39,53,22,51,50,54,53,53,6,6,
+35,32,17,17,35,53,55,55,51,21,33,53,16,33,50,23,21,38,38,35,34,6,21,1,50,
+55,17,33,17,20,22,3,100,254,242,93,50,47,59,72,55,25,102,51,254,190,155,157,
+72,107,1,63,1,14,92,52,17,62,28,72,55,254,185,85,62,254,193,91,150,254,170,
+33,137,22,89,108,155,10,18,1,83,2,127,86,72,234,252,127,1,86,33,137,8,14,
+89,107,251,184,20,3,43,253,134,95,102,0,2,0,33,255,236,6,143,5,70,0,47,0,
+58,0,0,1,20,23,54,54,51,50,22,21,20,6,35,32,39,6,6,35,32,17,17,35,53,55,55,
+51,21,33,21,33,17,20,22,51,50,54,55,38,53,16,0,51,50,22,23,7,38,35,32,1,34,
+6,7,22,51,50,54,53,52,38,3,223,15,95,172,93,142,171,199,161,254,245,130,121,
+192,99,254,190,155,157,72,107,1,61,254,195,82,67,75,148,109,45,1,11,247,84,
+155,50,56,139,98,254,188,1,107,62,130,101,82,174,87,105,81,2,33,79,75,70,
+59,135,115,133,157,163,90,73,1,83,2,127,86,72,234,252,140,253,134,88,109,
+59,82,112,163,1,20,1,43,34,25,150,52,253,178,48,71,123,77,60,48,57,0,1,0,
+31,254,20,6,63,6,31,0,49,0,0,1,34,39,53,22,51,50,53,17,52,38,35,34,6,21,17,
+35,17,33,17,35,17,35,53,55,53,52,54,51,50,23,7,38,35,34,6,21,21,33,23,51,
+54,54,51,50,22,21,17,20,6,5,25,87,59,62,61,137,118,125,167,155,180,254,241,
+180,192,192,175,182,105,108,48,93,70,91,88,1,160,29,10,54,180,106,201,200,
+143,254,20,25,145,20,172,3,107,133,129,184,212,253,197,3,190,252,66,3,190,
+84,62,63,200,200,37,141,30,120,130,71,150,86,84,191,210,252,143,154,174,0,
+1,0,174,255,236,4,240,6,20,0,38,0,0,1,20,4,35,34,39,21,35,17,51,17,22,51,
+32,53,52,38,39,46,2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,30,2,4,240,
+254,253,245,234,172,180,180,206,210,1,64,119,152,155,126,59,220,192,187,163,
+61,169,132,112,116,100,183,137,131,62,1,47,158,165,86,66,6,20,250,213,108,
+162,65,90,58,60,85,106,76,135,156,74,143,70,71,62,60,79,70,51,88,110,0,2,
+0,174,0,0,4,131,6,20,0,8,0,11,0,0,33,33,17,51,17,33,21,1,33,1,17,1,4,131,
+252,43,180,3,19,253,186,2,84,252,223,2,76,6,20,254,54,135,252,200,3,51,252,
+187,3,69,0,2,0,0,0,0,4,18,5,182,0,12,0,25,0,0,33,3,3,35,3,51,19,19,51,19,
+19,51,11,3,35,3,51,19,19,51,19,19,51,3,2,174,166,170,149,201,143,136,172,
+143,164,143,141,202,154,166,170,149,201,143,136,172,143,164,143,141,202,2,
+2,253,254,2,176,253,250,2,6,253,248,2,8,253,80,3,6,2,2,253,254,2,176,253,
+250,2,6,253,248,2,8,253,80,0,2,0,174,0,0,4,10,5,182,0,7,0,15,0,0,19,33,17,
+35,17,33,17,35,17,33,17,35,17,33,17,35,174,3,92,180,254,12,180,3,92,180,254,
+12,180,1,221,254,35,1,53,254,203,5,182,254,35,1,53,254,203,0,1,255,215,254,
+20,4,86,4,94,0,32,0,0,19,52,38,35,34,7,53,54,51,50,22,21,17,20,22,51,50,54,
+53,17,51,17,35,17,52,55,35,6,6,35,34,38,53,184,60,58,61,46,44,95,128,136,
+119,127,166,156,180,180,10,12,49,180,113,208,194,3,72,72,59,19,142,24,143,
+133,254,65,133,131,183,216,2,56,249,202,1,234,90,64,80,90,198,203,0,1,255,
+215,254,20,5,33,4,94,0,41,0,0,5,20,22,51,50,55,21,6,35,34,17,53,52,55,35,
+6,6,35,34,38,53,17,52,38,35,34,7,53,54,51,50,22,21,17,20,22,51,50,54,53,17,
+51,4,86,43,57,65,38,45,99,239,10,12,49,180,113,208,194,60,58,61,46,44,95,
+128,136,119,127,166,156,180,147,110,87,22,137,33,1,86,148,90,64,80,90,198,
+203,1,201,72,59,19,142,24,143,133,254,65,133,131,183,216,2,56,0,1,0,158,1,
+135,3,127,6,20,0,20,0,0,1,17,52,35,34,6,21,17,35,17,51,17,20,7,54,54,51,50,
+22,21,17,2,207,162,116,105,178,178,8,38,131,76,160,162,1,135,2,17,178,132,
+145,254,82,4,141,254,164,60,48,60,75,146,161,253,231,0,1,0,158,1,135,3,127,
+6,29,0,28,0,0,19,52,51,50,23,21,38,35,34,21,21,20,7,54,54,51,50,22,21,17,
+35,17,52,35,34,6,21,17,35,158,209,50,72,59,43,51,8,40,133,72,160,162,176,
+162,116,105,178,5,61,224,25,145,26,71,142,60,40,57,70,146,161,253,231,2,17,
+178,132,145,254,82,0,2,255,199,0,33,1,92,5,244,0,12,0,24,0,0,55,34,39,53,
+22,51,50,54,53,17,51,17,20,3,52,54,51,50,22,21,20,6,35,34,38,84,73,68,73,
+50,50,42,178,189,60,43,44,54,53,45,43,60,33,22,140,23,55,56,3,172,252,88,
+254,5,110,53,48,54,47,44,54,49,0,1,0,158,1,135,2,172,4,213,0,15,0,0,1,50,
+23,7,38,35,34,6,21,17,35,17,51,23,54,54,2,51,59,62,20,62,47,93,126,178,153,
+11,48,111,4,213,12,154,16,145,108,254,69,3,64,174,103,85,0,1,0,49,1,121,2,
+63,4,199,0,15,0,0,19,34,39,55,22,51,50,54,53,17,51,17,35,39,6,6,170,59,62,
+21,66,42,93,126,178,153,10,48,116,1,121,12,154,17,146,108,1,187,252,192,174,
+101,87,0,1,0,49,0,33,2,238,4,199,0,27,0,0,1,20,22,51,50,54,55,21,6,35,34,
+17,53,52,55,6,6,35,34,39,55,22,51,50,54,53,17,51,2,63,27,39,25,63,21,47,93,
+213,15,58,107,77,59,62,21,66,42,93,126,178,1,43,66,63,19,12,135,33,1,8,137,
+65,66,104,84,12,154,17,146,108,1,187,0,2,0,158,1,135,3,152,4,199,0,13,0,21,
+0,0,1,51,3,22,22,21,20,6,35,33,17,51,17,51,19,52,35,35,21,51,50,54,2,201,
+207,240,90,92,167,146,254,121,178,166,186,180,172,199,82,71,4,199,254,170,
+27,123,88,118,134,3,64,254,194,254,250,123,236,64,0,1,0,39,1,135,4,242,4,
+199,0,24,0,0,1,3,38,39,6,7,3,35,3,51,19,22,23,54,55,19,51,19,22,23,55,55,
+19,51,3,3,68,144,29,12,15,24,149,189,235,186,117,21,16,7,30,147,182,144,30,
+7,18,21,118,183,238,1,135,1,207,94,70,102,64,254,51,3,64,254,73,73,95,55,
+89,1,207,254,49,103,39,82,84,1,183,252,192,0,1,0,20,0,33,3,92,4,199,0,19,
+0,0,19,51,19,22,23,55,19,51,1,6,6,35,34,39,53,22,51,50,55,55,20,193,180,36,
+17,54,170,190,254,150,54,156,110,81,52,73,40,113,51,38,4,199,254,45,95,69,
+166,1,209,252,90,137,119,16,135,14,133,100,255,255,0,25,3,193,1,78,5,182,
+18,6,2,7,0,0,255,255,0,25,3,193,2,199,5,182,18,6,2,11,0,0,255,255,0,25,3,
+193,1,78,5,182,18,6,2,6,0,0,255,255,0,25,3,193,1,80,5,182,18,6,2,9,0,0,0,
+1,0,43,4,154,1,11,6,74,0,13,0,0,19,50,22,21,20,6,35,53,50,54,53,52,38,35,
+43,104,120,122,102,50,65,59,56,6,74,117,100,101,114,102,59,54,54,58,0,1,0,
+43,4,154,1,11,6,74,0,13,0,0,1,34,38,53,52,54,51,21,34,6,21,20,22,51,1,11,
+102,122,120,104,50,65,59,56,4,154,116,101,97,118,103,58,54,54,59,0,1,0,16,
+3,182,2,39,6,33,0,18,0,0,19,53,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,
+7,21,164,248,82,72,47,108,42,45,110,136,133,156,254,3,182,172,56,147,59,74,
+34,29,106,68,131,111,193,77,107,255,255,0,33,3,182,2,56,6,33,16,71,4,174,
+2,72,0,0,192,0,64,0,0,1,0,51,4,82,2,21,6,73,0,6,0,0,1,37,53,37,21,5,5,2,21,
+254,30,1,226,254,126,1,130,4,82,212,51,240,80,182,162,0,1,0,51,4,82,2,21,
+6,73,0,6,0,0,19,37,37,53,5,21,5,51,1,130,254,126,1,226,254,30,4,161,161,183,
+80,240,51,212,0,1,0,39,4,94,2,31,6,63,0,6,0,0,19,19,51,19,35,3,3,39,213,51,
+240,80,182,162,4,94,1,225,254,31,1,129,254,127,0,1,0,26,4,95,2,18,6,64,0,
+6,0,0,1,3,35,3,51,19,19,2,18,213,51,240,80,182,162,6,64,254,31,1,225,254,
+127,1,129,255,255,0,43,4,197,0,207,6,20,16,6,4,238,125,0,255,255,0,20,4,217,
+1,176,6,33,16,7,0,118,254,145,0,0,255,255,0,20,4,217,1,176,6,33,16,7,0,67,
+254,145,0,0,255,255,0,43,254,95,0,207,255,174,16,7,4,238,0,125,249,154,255,
+255,0,25,254,211,2,121,255,100,16,7,1,77,254,238,249,250,255,255,0,20,254,
+94,1,176,255,166,16,7,4,246,0,225,0,0,255,255,0,20,254,94,1,176,255,166,16,
+7,4,247,0,225,0,0,0,2,0,33,0,0,1,141,4,74,0,2,0,5,0,0,1,3,3,1,33,19,1,141,
+182,182,1,108,254,148,182,4,74,254,227,1,29,251,182,1,29,0,1,0,33,3,45,1,
+141,4,74,0,2,0,0,1,3,3,1,141,182,182,4,74,254,227,1,29,255,255,0,43,1,246,
+1,11,3,166,18,7,4,172,0,0,253,92,255,255,0,43,1,246,1,11,3,166,18,7,4,173,
+0,0,253,92,255,255,0,25,254,86,1,199,255,158,16,7,4,253,0,240,0,0,255,255,
+0,25,254,86,1,199,255,158,16,7,4,254,0,240,0,0,255,255,0,25,254,45,1,199,
+255,199,16,7,4,255,0,240,0,0,0,1,0,25,254,188,1,199,255,55,0,3,0,0,23,33,
+21,33,25,1,174,254,82,201,123,0,1,254,201,1,92,1,55,3,20,0,13,0,0,3,23,22,
+22,51,50,55,23,6,35,34,3,7,39,57,34,23,62,47,81,84,37,112,125,183,75,90,37,
+3,20,122,85,75,55,135,78,1,2,24,139,255,255,0,31,4,145,1,193,6,51,16,7,5,
+28,0,240,0,0,0,2,0,20,0,35,3,90,4,199,0,20,0,32,0,0,1,22,22,21,20,6,35,34,
+38,53,52,54,55,1,51,19,23,54,54,19,51,1,52,38,39,6,6,21,20,22,51,50,54,2,
+27,46,52,111,88,88,110,46,52,254,194,189,198,33,10,23,197,188,254,143,25,
+26,26,25,32,19,22,29,2,12,88,137,63,86,115,112,89,61,132,95,2,187,254,55,
+82,29,61,1,193,252,41,24,84,45,45,84,24,28,38,39,0,1,0,158,1,135,1,80,6,20,
+0,3,0,0,1,35,17,51,1,80,178,178,1,135,4,141,0,1,0,106,1,121,2,225,4,213,0,
+33,0,0,1,20,6,35,34,39,53,22,51,50,53,52,38,39,46,2,53,52,54,51,50,23,7,38,
+35,34,6,21,20,22,23,22,22,2,225,181,169,168,110,162,120,172,77,111,127,95,
+47,178,152,150,139,59,137,101,74,75,66,132,148,112,2,115,119,131,57,156,78,
+104,42,59,41,48,64,81,59,106,121,61,134,58,44,38,37,52,50,56,115,0,1,0,43,
+1,135,3,100,4,199,0,11,0,0,1,1,51,19,19,51,1,1,35,3,3,35,1,96,254,217,201,
+199,196,199,254,217,1,55,200,211,213,201,3,47,1,152,254,229,1,27,254,104,
+254,88,1,43,254,213,0,1,0,68,1,135,2,199,6,29,0,19,0,0,1,17,38,38,53,52,54,
+51,50,23,7,38,38,35,34,21,20,22,23,17,1,100,139,149,174,170,163,136,66,56,
+122,49,168,148,137,1,135,1,225,69,203,120,141,160,97,127,39,45,165,103,157,
+42,253,201,0,1,0,160,0,0,2,184,5,129,0,5,0,0,33,35,17,33,53,33,2,184,135,
+254,111,2,24,4,250,135,0,1,0,160,0,0,2,184,5,129,0,7,0,0,33,35,17,33,53,33,
+17,51,2,184,135,254,111,1,145,135,3,168,135,1,82,0,1,0,160,0,0,2,184,5,129,
+0,7,0,0,33,35,17,33,53,33,17,51,2,184,135,254,111,1,145,135,2,156,135,2,94,
+0,1,0,160,0,0,2,184,5,129,0,7,0,0,33,35,17,33,53,33,17,51,2,184,135,254,111,
+1,145,135,1,86,135,3,164,0,1,0,160,0,0,2,184,5,129,0,5,0,0,33,33,53,33,17,
+51,2,184,253,232,1,145,135,135,4,250,0,1,0,160,0,0,2,184,5,129,0,5,0,0,19,
+51,17,33,21,33,160,135,1,145,253,232,5,129,251,6,135,0,1,0,160,0,0,2,184,
+5,129,0,7,0,0,19,51,17,33,21,33,17,35,160,135,1,145,254,111,135,5,129,253,
+162,135,253,100,255,255,1,4,254,105,3,184,255,177,18,7,1,76,0,0,249,144,255,
+255,255,252,4,202,3,78,6,92,18,7,2,5,0,0,6,145,255,255,0,25,3,193,2,199,5,
+182,18,6,2,11,0,0,0,1,0,20,254,20,2,192,255,219,0,6,0,0,5,1,35,1,51,19,19,
+2,192,254,221,100,254,219,162,180,182,37,254,57,1,199,254,238,1,18,0,1,0,
+20,254,20,2,192,255,215,0,6,0,0,19,1,51,1,35,3,3,20,1,35,100,1,37,162,180,
+182,254,20,1,195,254,61,1,15,254,241,0,1,0,104,254,20,2,106,0,47,0,6,0,0,
+1,37,53,37,21,5,5,2,106,253,254,2,2,254,178,1,78,254,20,220,100,219,141,127,
+129,0,1,0,104,254,20,2,106,0,47,0,6,0,0,55,5,21,5,53,37,37,104,2,2,253,254,
+1,78,254,178,47,219,100,220,142,127,129,0,1,0,20,2,68,1,158,3,139,0,9,0,0,
+1,35,38,38,39,53,51,22,22,23,1,158,119,67,178,30,220,25,104,45,2,68,52,200,
+55,20,54,185,62,0,2,0,20,2,63,2,238,3,135,0,8,0,18,0,0,19,54,55,51,21,6,6,
+7,35,37,54,54,55,51,21,6,6,7,35,20,83,92,219,33,174,66,121,1,80,38,104,32,
+220,30,173,70,121,2,90,106,195,20,59,198,51,27,48,182,71,20,54,198,56,0,2,
+0,20,2,63,2,238,3,135,0,9,0,19,0,0,1,35,38,38,39,53,51,22,22,23,5,35,38,38,
+39,53,51,22,22,23,2,238,121,65,176,32,219,38,99,38,254,176,121,63,180,30,
+220,35,106,33,2,63,51,200,57,20,80,175,46,27,48,206,54,20,77,184,40,0,1,0,
+20,254,125,2,226,255,133,0,23,0,0,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,
+51,50,54,55,51,6,6,2,16,40,79,76,71,31,45,50,14,102,8,113,90,41,81,77,69,
+29,44,45,17,104,13,110,254,127,35,43,35,53,62,124,138,35,41,35,51,62,124,
+138,255,255,0,147,1,145,1,145,6,20,18,7,0,29,0,0,1,174,0,1,0,20,4,31,1,104,
+5,115,0,5,0,0,19,33,21,35,21,35,20,1,84,231,109,5,115,109,231,0,1,0,20,4,
+31,1,104,5,115,0,5,0,0,1,17,35,53,35,53,1,104,109,231,5,115,254,172,231,109,
+0,1,0,20,1,231,1,104,3,59,0,5,0,0,19,17,51,21,51,21,20,109,231,1,231,1,84,
+231,109,0,1,0,20,1,231,1,104,3,59,0,5,0,0,1,33,53,51,53,51,1,104,254,172,
+231,109,1,231,109,231,0,1,0,41,254,86,3,187,255,168,0,7,0,0,1,33,17,51,21,
+33,53,51,3,187,252,110,115,2,170,117,254,86,1,82,203,203,0,1,0,41,254,86,
+3,187,255,168,0,5,0,0,1,33,17,51,21,33,3,187,252,110,115,3,31,254,86,1,82,
+203,0,1,0,41,254,20,3,203,0,154,0,9,0,0,1,1,53,1,21,5,33,21,33,5,2,43,253,
+254,2,2,254,242,2,174,253,82,1,14,254,20,1,17,100,1,17,121,139,123,142,255,
+255,254,167,4,217,1,91,6,33,16,7,1,75,253,163,0,0,255,255,254,210,4,217,1,
+50,5,106,16,7,1,77,253,167,0,0,0,1,254,86,6,43,1,172,6,188,0,3,0,0,1,33,21,
+33,254,86,3,86,252,170,6,188,145,255,255,254,194,4,217,1,63,5,236,16,7,1,
+78,253,163,0,0,255,255,255,151,5,0,0,106,5,229,16,7,1,79,254,247,0,0,255,
+255,254,224,5,12,1,32,5,215,16,7,0,106,253,175,0,0,255,255,253,4,4,184,254,
+119,6,145,18,6,2,99,0,0,255,255,255,32,4,217,0,226,6,137,16,7,1,80,253,179,
+0,0,255,255,254,144,4,217,1,111,6,33,16,7,1,83,253,177,0,0,255,255,254,167,
+4,217,1,91,6,33,16,7,1,76,253,163,0,0,0,1,255,174,4,197,0,82,6,20,0,3,0,0,
+19,17,35,17,82,164,6,20,254,177,1,79,0,2,255,10,4,197,0,246,6,20,0,3,0,7,
+0,0,3,17,35,17,33,17,35,17,82,164,1,236,164,6,20,254,177,1,79,254,177,1,79,
+0,2,254,193,4,217,1,61,6,193,0,13,0,25,0,0,3,34,38,39,51,22,22,51,50,54,55,
+51,6,6,3,52,54,51,50,22,21,20,6,35,34,38,6,141,163,9,110,7,84,116,100,97,
+10,112,10,172,239,61,45,48,56,58,46,45,61,4,217,138,137,70,60,62,68,129,146,
+1,117,60,55,62,53,54,61,56,0,1,254,193,4,217,1,61,5,236,0,13,0,0,19,50,22,
+23,35,38,38,35,34,6,7,35,54,54,4,141,163,9,110,9,85,113,103,96,8,112,11,172,
+5,236,138,137,73,56,64,65,129,146,0,1,255,100,3,193,0,154,5,182,0,6,0,0,3,
+39,54,19,51,6,7,143,13,52,124,134,66,37,3,193,22,199,1,24,254,247,0,1,255,
+102,3,193,0,156,5,182,0,6,0,0,19,23,6,3,35,54,55,143,13,52,124,134,66,37,
+5,182,22,199,254,232,254,247,0,1,255,100,3,193,0,154,5,182,0,6,0,0,19,22,
+23,35,2,39,55,51,37,66,134,124,52,13,5,182,247,254,1,24,199,22,0,1,255,102,
+3,193,0,156,5,182,0,6,0,0,19,23,6,3,35,54,55,143,13,52,124,134,66,37,5,182,
+22,199,254,232,254,247,0,1,255,51,254,94,0,207,255,166,0,9,0,0,19,35,38,38,
+39,53,51,22,22,23,207,121,75,179,37,215,28,118,51,254,94,60,191,56,21,57,
+186,60,0,1,255,51,254,94,0,207,255,166,0,9,0,0,3,54,54,55,51,21,6,6,7,35,
+205,53,109,33,217,44,186,63,119,254,119,68,172,63,21,64,194,49,0,1,255,76,
+254,66,0,180,255,199,0,7,0,0,7,51,53,51,17,35,53,35,180,225,135,135,225,190,
+133,254,123,133,0,1,255,76,254,66,0,180,255,199,0,7,0,0,19,35,21,35,17,51,
+21,51,180,225,135,135,225,254,199,133,1,133,133,0,1,254,147,4,209,1,109,6,
+106,0,5,0,0,1,33,17,35,17,33,254,147,2,218,136,253,174,6,106,254,103,1,31,
+0,1,255,45,4,113,0,221,6,20,0,8,0,0,3,54,54,53,51,23,6,6,7,211,112,115,191,
+14,34,206,192,4,240,15,150,127,22,187,188,22,0,1,255,147,254,51,0,115,255,
+227,0,13,0,0,19,34,38,53,52,54,51,21,34,6,21,20,22,51,115,103,121,120,104,
+50,65,59,56,254,51,118,99,97,118,102,59,54,54,58,0,1,255,41,254,86,0,215,
+255,158,0,7,0,0,23,21,51,21,33,53,51,53,68,147,254,82,147,98,205,123,123,
+205,0,1,255,41,254,86,0,215,255,158,0,7,0,0,3,53,35,53,33,21,35,21,68,147,
+1,174,147,254,86,205,123,123,205,0,1,255,41,254,45,0,215,255,199,0,11,0,0,
+3,53,51,53,51,21,51,21,35,21,35,53,215,147,136,147,147,136,254,188,123,144,
+144,123,143,143,255,255,254,210,254,212,1,50,255,101,16,7,1,77,253,167,249,
+251,0,1,254,150,254,25,0,0,0,86,0,11,0,0,3,34,39,53,22,51,50,53,17,51,17,
+16,240,62,60,46,56,98,162,254,25,24,150,19,107,1,55,254,211,254,240,0,1,0,
+0,254,25,1,106,0,86,0,11,0,0,19,34,17,17,51,17,20,51,50,55,21,6,240,240,162,
+98,56,46,60,254,25,1,16,1,45,254,201,107,19,150,24,255,255,254,224,254,154,
+1,32,255,101,16,7,0,106,253,175,249,142,255,255,255,32,254,48,0,226,255,224,
+16,7,1,80,253,179,249,87,255,255,255,126,254,59,0,132,255,131,16,7,2,57,254,
+15,0,0,255,255,255,57,254,20,0,206,0,0,16,7,0,122,255,28,0,0,255,255,255,
+89,254,61,0,171,0,0,16,7,1,81,255,54,0,0,255,255,255,174,254,96,0,82,255,
+175,16,7,4,238,0,0,249,155,0,1,254,147,254,66,1,109,255,158,0,7,0,0,5,33,
+17,35,53,33,21,35,254,147,2,218,136,254,54,136,98,254,164,225,225,0,1,254,
+125,254,150,1,133,255,131,0,22,0,0,5,20,6,35,34,39,6,35,34,38,53,51,20,51,
+50,54,53,51,20,51,50,54,53,1,133,119,106,111,53,53,111,104,119,111,112,51,
+64,98,115,51,64,125,113,124,71,71,122,115,135,66,69,135,66,69,255,255,254,
+167,254,105,1,91,255,177,16,7,1,76,253,163,249,144,255,255,254,167,254,103,
+1,91,255,175,16,7,1,75,253,163,249,142,255,255,254,194,254,134,1,63,255,153,
+16,7,1,78,253,163,249,173,255,255,254,193,254,132,1,61,255,151,16,7,4,241,
+0,0,249,171,255,255,254,136,254,136,1,120,255,144,16,7,1,82,253,134,249,175,
+255,255,254,210,254,212,1,50,255,101,16,7,1,77,253,167,249,251,0,1,254,53,
+254,197,1,203,255,72,0,3,0,0,1,33,53,33,1,203,252,106,3,150,254,197,131,255,
+255,254,89,254,57,1,171,255,203,16,7,2,5,254,93,0,0,0,1,254,172,1,166,1,78,
+2,174,0,23,0,0,19,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,6,
+6,137,38,72,69,65,30,44,42,13,104,11,101,85,40,75,69,63,29,42,42,14,103,11,
+100,1,168,37,43,37,59,60,122,140,37,43,37,59,60,120,142,0,1,254,147,1,254,
+1,111,2,141,0,3,0,0,1,33,21,33,254,147,2,220,253,36,2,141,143,0,1,253,31,
+1,254,2,225,2,143,0,3,0,0,1,33,53,33,2,225,250,62,5,194,1,254,145,0,1,254,
+215,1,119,1,43,3,43,0,3,0,0,1,1,23,1,254,215,2,8,76,253,246,1,242,1,57,125,
+254,201,0,1,254,106,255,137,1,150,6,16,0,3,0,0,1,1,35,1,1,150,253,112,156,
+2,144,6,16,249,121,6,135,0,1,255,147,254,51,0,115,255,227,0,13,0,0,7,50,22,
+21,20,6,35,53,50,54,53,52,38,35,109,104,120,120,104,50,65,59,56,29,117,100,
+98,117,103,58,54,54,59,0,1,254,147,254,66,1,109,255,158,0,7,0,0,1,33,17,51,
+21,33,53,51,1,109,253,38,136,1,202,136,254,66,1,92,226,226,0,2,255,53,254,
+45,0,207,255,199,0,3,0,7,0,0,19,33,17,33,1,51,53,35,207,254,102,1,154,254,
+217,180,180,254,45,1,154,254,211,192,0,1,254,125,254,150,1,133,255,131,0,
+22,0,0,1,52,54,51,50,23,54,51,50,22,21,35,52,35,34,6,21,35,52,35,34,6,21,
+254,125,119,106,111,53,54,110,104,119,110,113,51,64,98,115,51,63,254,150,
+113,124,72,72,122,115,135,66,69,135,66,69,0,1,255,47,4,145,0,209,6,51,0,11,
+0,0,3,55,23,55,23,7,23,7,39,7,39,55,209,86,123,121,88,123,123,88,121,123,
+86,121,5,219,88,123,123,88,121,123,86,121,121,86,123,0,1,255,125,4,156,0,
+131,6,238,0,23,0,0,3,52,54,51,21,34,6,21,20,30,2,21,20,6,35,53,50,54,53,52,
+46,2,129,146,114,60,59,37,43,37,144,116,60,59,37,43,37,6,70,75,93,103,46,
+28,21,53,62,71,40,76,94,104,44,28,25,56,62,69,255,255,254,87,6,28,1,169,7,
+174,16,7,2,5,254,91,7,227,255,255,254,183,4,217,0,83,6,33,16,7,0,67,253,52,
+0,0,255,255,255,175,4,217,1,75,6,33,16,7,0,118,254,44,0,0,255,255,254,136,
+4,217,1,120,5,225,16,7,1,82,253,134,0,0,255,255,255,126,4,110,0,132,5,182,
+16,7,2,57,254,15,6,51,255,255,254,193,4,208,1,62,6,120,16,7,1,85,253,177,
+255,196,255,255,255,177,254,61,0,208,255,129,16,7,7,151,253,202,0,0,0,1,254,
+66,4,188,1,190,6,25,0,7,0,0,1,33,17,35,53,33,21,35,254,66,3,124,135,253,146,
+135,6,25,254,163,226,226,255,255,254,87,254,57,1,169,255,203,16,7,2,5,254,
+91,0,0,255,255,255,10,254,96,0,246,255,175,16,7,4,239,0,0,249,155,0,1,255,
+66,254,20,0,190,255,133,0,5,0,0,7,33,17,35,53,35,190,1,124,135,245,123,254,
+143,246,0,1,254,135,4,141,1,119,6,45,0,27,0,0,19,34,39,7,39,55,38,35,34,6,
+7,35,54,54,51,50,23,55,23,7,22,51,50,54,55,51,6,6,152,57,91,76,92,74,45,25,
+49,49,14,105,13,115,97,58,76,69,92,67,48,36,48,49,15,103,12,118,4,219,47,
+125,56,120,19,59,60,122,140,39,117,55,115,25,59,60,123,139,0,3,254,135,4,
+158,1,119,7,100,0,23,0,35,0,47,0,0,19,34,46,2,35,34,6,7,35,54,54,51,50,30,
+2,51,50,54,55,51,6,6,5,52,54,51,50,22,21,20,6,35,34,38,19,52,54,51,50,22,
+21,20,6,35,34,38,152,43,83,79,73,34,49,49,14,105,13,115,97,45,85,78,72,32,
+48,49,15,103,13,113,254,167,56,40,46,50,58,38,40,56,2,56,38,46,50,58,38,38,
+56,5,127,37,43,37,59,60,122,140,37,43,37,59,60,120,142,123,54,46,54,46,53,
+49,49,2,49,54,46,54,46,53,49,49,0,2,254,168,4,215,1,88,6,225,0,23,0,47,0,
+0,19,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,6,6,3,34,46,2,35,
+34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,6,6,145,39,77,73,70,31,38,42,15,
+104,10,104,85,42,80,73,67,30,43,38,14,102,11,101,87,39,77,73,70,31,38,42,
+15,104,10,100,89,42,80,73,67,30,43,38,14,102,10,102,4,217,31,36,31,44,56,
+112,122,31,37,31,54,47,112,122,1,31,31,36,31,44,56,107,126,31,36,31,54,46,
+110,123,0,1,254,154,254,63,1,102,255,184,0,9,0,0,1,37,21,51,53,5,5,53,35,
+21,254,154,1,0,204,1,0,255,0,204,254,252,188,127,127,188,189,127,127,0,1,
+255,70,254,20,0,190,255,205,0,6,0,0,3,53,35,55,23,35,21,66,120,188,188,120,
+254,20,246,195,195,246,0,24,253,37,0,0,2,219,5,182,0,5,0,9,0,13,0,19,0,25,
+0,29,0,33,0,39,0,47,0,55,0,65,0,73,0,83,0,93,0,103,0,113,0,121,0,131,0,140,
+0,150,0,158,0,168,0,176,0,186,0,0,1,35,53,35,53,33,5,33,53,33,1,35,17,51,
+1,35,21,35,17,33,1,33,53,51,53,51,37,35,17,51,1,33,53,33,5,33,17,51,21,51,
+1,52,51,50,21,20,35,34,17,52,51,50,21,20,35,34,1,34,53,52,51,50,22,21,20,
+6,33,34,53,52,51,50,21,20,3,52,51,50,21,20,6,35,34,38,17,52,51,50,21,20,6,
+35,34,38,1,52,51,50,21,20,6,35,34,38,17,52,51,50,21,20,6,35,34,38,37,50,21,
+20,35,34,53,52,33,50,21,20,35,34,38,53,52,54,1,50,21,20,35,34,53,52,54,33,
+50,21,20,35,34,38,53,52,54,37,52,51,50,21,20,35,34,17,52,51,50,21,20,6,35,
+34,38,1,52,51,50,21,20,35,34,17,52,51,50,21,20,6,35,34,38,2,219,108,211,1,
+63,253,199,254,188,1,68,2,57,108,108,251,137,209,110,1,63,4,119,254,193,211,
+108,250,184,110,110,3,15,254,188,1,68,253,194,254,193,110,209,1,101,55,55,
+55,55,55,55,55,55,254,121,56,56,27,28,28,3,108,56,56,55,246,56,55,31,24,25,
+31,56,55,31,24,25,31,253,125,55,56,31,25,24,31,55,56,31,25,24,31,3,27,55,
+55,56,252,252,56,56,27,28,28,3,87,55,55,56,28,252,224,56,56,27,28,28,2,46,
+55,55,55,55,55,55,30,25,25,30,254,160,55,55,55,55,55,55,30,25,25,30,4,119,
+209,110,110,110,252,133,1,66,1,203,209,1,63,250,74,111,211,249,1,66,252,131,
+111,111,1,66,211,4,43,55,55,56,252,187,55,55,56,1,191,55,55,30,25,25,30,55,
+55,55,55,1,119,55,55,28,28,28,253,157,55,55,28,28,28,2,155,55,55,28,28,28,
+253,157,55,55,28,28,28,226,55,55,55,55,55,55,30,25,25,30,1,97,56,55,55,25,
+31,56,55,30,25,25,31,182,55,55,55,252,251,56,56,27,28,28,3,87,55,55,55,252,
+251,56,56,27,28,28,0,1,255,84,4,184,0,164,6,82,0,12,0,0,3,22,23,21,6,7,35,
+53,54,55,38,39,53,150,224,90,122,192,22,41,147,105,83,6,82,112,25,140,30,
+103,105,28,72,51,52,102,255,255,255,144,4,195,0,112,6,115,16,7,4,173,255,
+101,0,41,0,2,254,193,4,217,1,61,6,184,0,11,0,25,0,0,3,52,54,51,50,22,21,20,
+6,35,34,38,19,50,22,23,35,38,38,35,34,6,7,35,54,54,106,61,45,48,56,58,46,
+45,61,110,144,160,9,110,9,85,113,98,100,9,112,11,172,5,76,60,54,61,53,54,
+61,56,1,167,139,135,73,56,61,68,128,146,0,1,255,61,254,55,0,195,255,188,0,
+11,0,0,7,55,23,55,23,7,23,7,39,7,39,55,195,86,105,100,97,101,103,86,105,100,
+97,101,154,86,102,100,96,100,105,86,103,101,97,100,0,1,255,84,254,20,0,164,
+255,174,0,12,0,0,19,38,39,53,54,55,51,21,6,7,22,23,21,141,218,95,120,193,
+23,44,145,117,72,254,20,109,29,139,30,103,104,30,71,58,44,103,0,1,255,84,
+254,20,0,164,255,174,0,13,0,0,7,22,23,21,6,6,7,35,53,54,55,38,39,53,150,211,
+103,52,176,86,22,41,147,105,83,82,106,31,139,13,75,46,105,28,72,51,52,102,
+0,2,254,135,254,20,1,143,255,174,0,15,0,29,0,0,3,54,54,55,51,22,22,23,21,
+35,38,39,7,6,7,35,1,22,23,21,6,6,7,35,53,54,55,38,39,53,12,29,89,21,139,21,
+82,30,104,44,58,24,44,33,104,254,170,213,100,47,171,95,23,39,150,110,79,254,
+51,57,228,67,84,218,50,24,61,168,60,115,54,1,147,106,31,139,12,72,50,105,
+26,74,54,49,102,255,255,255,144,4,195,0,112,6,115,16,7,4,172,255,101,0,41,
+255,255,1,6,5,0,1,217,5,229,16,6,1,79,102,0,0,1,255,39,254,20,0,217,255,178,
+0,14,0,0,7,51,7,55,23,7,23,7,39,7,39,55,39,55,23,72,144,27,127,45,143,104,
+115,63,63,115,104,143,45,127,78,143,69,135,20,99,86,132,132,86,99,20,135,
+69,0,3,254,119,254,20,1,135,255,197,0,19,0,31,0,43,0,0,7,50,23,54,51,50,22,
+21,20,6,35,34,39,6,35,34,38,53,52,54,5,20,22,51,50,54,53,52,38,35,34,6,7,
+52,38,35,34,6,21,20,22,51,50,54,170,115,55,53,115,103,120,120,103,115,53,
+57,113,103,120,120,1,70,64,51,56,59,66,49,50,65,108,65,50,50,65,59,56,51,
+64,59,80,80,117,98,101,117,82,82,117,101,98,117,215,54,61,61,54,54,60,60,
+54,54,60,60,54,54,61,61,0,1,255,61,4,197,0,195,6,68,0,7,0,0,19,7,35,55,35,
+55,51,7,195,70,105,37,252,70,105,37,5,186,245,137,246,138,0,1,255,84,254,
+41,5,127,255,170,0,12,0,0,1,32,36,39,51,22,33,50,36,55,51,6,4,2,113,254,209,
+254,103,85,143,156,1,240,232,1,74,79,143,97,254,114,254,41,198,187,238,122,
+116,190,195,255,255,255,84,4,178,5,127,6,51,16,7,5,59,0,0,6,137,0,1,255,66,
+4,215,4,14,5,104,0,3,0,0,1,33,53,33,4,14,251,52,4,204,4,215,145,255,255,255,
+66,254,216,4,14,255,105,16,7,5,61,0,0,250,1,0,1,255,84,4,219,5,127,5,227,
+0,20,0,0,19,50,30,2,51,50,55,51,6,6,35,34,46,2,35,34,7,35,18,190,115,209,
+205,212,118,223,31,104,22,181,157,117,211,205,211,117,223,31,104,46,5,225,
+38,47,38,125,129,133,38,47,38,125,1,6,0,1,255,84,4,178,5,127,6,51,0,12,0,
+0,1,32,4,23,35,38,33,34,4,7,35,54,36,2,98,1,47,1,153,85,143,156,254,16,232,
+254,182,79,143,97,1,142,6,51,198,187,238,122,116,190,195,0,1,255,84,254,63,
+5,127,255,184,0,6,0,0,7,33,53,5,5,53,33,172,5,43,1,0,255,0,250,213,199,127,
+188,189,127,0,2,254,221,2,41,1,37,4,233,0,24,0,35,0,0,19,39,6,6,35,34,38,
+53,52,37,55,53,52,38,35,34,6,7,39,54,51,50,22,21,17,37,50,54,53,53,7,6,6,
+21,20,22,178,16,53,102,66,111,121,1,86,96,63,57,50,103,48,43,119,131,131,
+129,254,184,82,100,81,108,99,60,2,53,101,65,48,110,97,209,12,4,27,75,60,36,
+21,104,63,110,121,254,51,99,90,86,47,4,4,58,63,48,46,0,2,254,207,2,41,1,51,
+4,236,0,19,0,26,0,0,19,34,38,53,52,54,51,50,22,21,21,33,22,51,50,54,55,21,
+6,6,3,34,6,7,33,38,38,37,162,180,169,146,138,159,254,49,14,185,52,100,81,
+56,110,102,68,81,11,1,52,5,71,2,41,186,162,162,197,168,142,78,202,22,33,125,
+25,22,2,82,87,77,74,90,0,2,255,174,2,53,0,82,5,213,0,3,0,15,0,0,19,35,17,
+51,39,52,54,51,50,22,21,20,6,35,34,38,72,146,146,154,49,35,32,48,48,32,35,
+49,2,53,2,170,164,43,39,39,43,40,40,40,0,2,254,182,2,41,1,74,4,236,0,11,0,
+21,0,0,1,20,6,35,34,38,53,52,54,51,50,22,5,20,51,50,54,53,52,38,35,34,1,74,
+175,157,151,177,178,154,148,180,254,2,180,93,87,88,92,180,3,139,164,190,193,
+161,167,186,189,164,239,127,112,111,127,0,1,254,209,2,41,1,47,4,223,0,18,
+0,0,3,17,20,51,50,54,53,17,51,17,35,39,6,6,35,34,38,53,17,156,131,94,89,145,
+125,12,38,107,60,133,131,4,223,254,78,145,108,117,1,98,253,86,99,50,61,119,
+131,1,188,0,1,254,248,2,41,1,10,4,236,0,20,0,0,19,34,38,53,52,54,51,50,23,
+7,38,35,34,21,20,22,51,50,55,21,6,61,155,170,174,160,108,88,41,105,52,183,
+88,86,89,106,78,2,41,185,165,170,187,43,113,35,236,112,119,47,123,43,0,2,
+254,197,2,41,1,61,5,242,0,17,0,29,0,0,3,34,38,53,52,54,51,50,23,38,53,17,
+51,17,35,39,6,6,39,50,54,53,53,52,38,35,34,6,21,20,20,139,156,158,137,117,
+79,4,145,122,13,36,102,46,97,79,85,93,82,80,2,41,184,168,171,184,101,32,60,
+1,15,252,67,101,51,62,115,107,110,18,129,113,131,111,235,0,1,254,211,2,53,
+1,47,5,242,0,20,0,0,19,17,52,35,34,6,21,17,35,17,51,17,20,7,54,54,51,50,22,
+21,17,160,133,94,89,145,145,6,35,111,57,130,132,2,53,1,178,146,105,122,254,
+159,3,189,254,209,42,30,54,56,119,132,254,71,0,1,254,10,2,53,1,246,4,236,
+0,31,0,0,1,17,52,35,34,6,21,17,35,17,52,35,34,6,21,17,35,17,51,23,54,54,51,
+50,23,54,54,51,50,22,21,17,1,102,118,90,76,146,121,84,79,146,125,12,41,95,
+57,150,61,35,118,66,122,122,2,53,1,178,146,105,100,254,137,1,178,146,107,
+120,254,159,2,170,100,63,50,121,60,61,120,134,254,71,0,1,255,41,2,53,0,217,
+4,236,0,15,0,0,19,50,23,7,38,35,34,6,21,17,35,17,51,23,54,54,119,41,57,16,
+65,25,75,106,145,127,8,39,90,4,236,11,127,15,116,93,254,149,2,170,143,84,
+72,0,1,254,209,2,41,1,47,4,223,0,18,0,0,3,17,20,51,50,54,53,17,51,17,35,39,
+6,6,35,34,38,53,17,156,131,94,89,145,125,12,38,107,60,133,131,4,223,254,78,
+145,108,117,1,98,253,86,99,50,61,119,131,1,188,0,1,254,168,2,53,1,88,4,223,
+0,10,0,0,3,1,51,19,22,23,54,55,19,51,1,78,254,246,156,147,30,9,17,26,147,
+156,254,244,2,53,2,170,254,115,87,65,92,60,1,141,253,86,0,1,254,174,2,53,
+1,84,4,223,0,11,0,0,3,3,51,23,55,51,3,1,35,39,7,35,84,242,164,164,162,162,
+242,1,0,166,172,174,166,3,145,1,78,231,231,254,178,254,164,246,246,0,1,0,
+41,4,111,1,156,5,182,0,8,0,0,19,54,55,51,21,6,6,7,35,41,86,68,217,59,137,
+56,119,4,135,133,170,20,101,164,42,0,1,0,41,254,61,1,156,255,133,0,8,0,0,
+5,6,6,7,35,53,54,55,51,1,156,44,88,22,217,121,131,119,147,67,178,59,21,205,
+102,255,255,0,158,254,61,1,189,255,129,16,7,7,151,254,183,0,0,255,255,0,68,
+255,236,3,102,4,94,18,6,4,67,0,0,255,255,0,113,255,236,3,147,4,94,18,38,0,
+70,0,0,16,7,1,79,1,98,252,204,255,255,0,68,255,236,3,102,4,94,18,38,4,67,
+0,0,16,7,1,79,0,100,252,204,255,255,0,63,254,248,1,141,4,102,18,6,0,30,0,
+0,0,3,0,102,255,236,4,74,6,31,0,28,0,40,0,51,0,0,1,6,7,54,54,51,50,22,22,
+21,20,6,6,35,34,2,17,52,18,54,51,50,22,21,20,6,6,35,34,19,50,54,53,52,38,
+35,34,6,7,22,22,19,34,7,22,22,51,50,54,53,52,38,1,82,47,4,51,180,125,127,
+210,118,126,228,148,250,244,136,250,163,166,191,94,165,102,179,128,150,165,
+154,134,116,169,49,13,151,194,163,95,43,144,69,91,102,100,4,115,136,237,71,
+89,111,197,126,158,232,122,1,121,1,135,246,1,117,200,139,125,84,123,68,252,
+125,181,169,136,153,82,70,251,236,5,10,159,36,46,63,51,59,68,255,255,255,
+206,0,0,5,153,6,8,16,39,1,84,253,214,255,151,16,7,2,81,1,16,0,0,255,255,0,
+0,0,0,4,137,7,41,18,38,2,81,0,0,16,7,0,106,255,243,1,82,255,255,0,111,254,
+20,5,92,6,20,18,6,1,222,0,0,0,1,255,246,254,20,5,31,4,94,0,41,0,0,1,34,39,
+53,22,51,50,53,53,36,17,52,55,1,35,54,18,53,52,38,35,34,7,39,54,51,32,17,
+20,7,1,51,6,2,21,20,22,51,50,55,17,16,4,47,60,63,46,57,98,254,221,37,253,
+207,184,72,77,94,86,46,34,49,61,94,1,78,37,2,56,180,68,84,89,94,47,43,254,
+20,25,150,19,107,211,21,1,192,149,117,253,51,152,1,86,161,151,163,17,142,
+24,254,41,146,120,2,205,133,254,156,167,158,155,16,254,148,254,239,0,2,0,
+125,0,0,5,158,5,203,0,15,0,27,0,0,1,36,0,17,16,0,33,50,4,18,21,16,0,5,17,
+35,1,20,22,51,50,54,53,52,38,35,34,6,2,176,254,246,254,215,1,92,1,55,201,
+1,40,157,254,212,254,246,184,254,143,240,223,222,239,237,222,225,240,1,8,
+22,1,65,1,11,1,32,1,65,149,254,235,185,254,252,254,187,23,254,248,3,104,215,
+237,233,219,217,232,234,0,2,0,113,254,20,4,104,4,94,0,14,0,24,0,0,33,38,2,
+53,16,0,51,50,0,17,20,2,7,17,35,3,20,22,51,50,54,53,16,33,32,2,18,191,226,
+1,13,241,232,1,17,218,199,181,231,161,161,158,163,254,188,254,193,27,1,38,
+238,1,13,1,34,254,216,254,249,239,254,221,29,254,20,4,27,205,211,211,205,
+1,152,0,1,0,125,0,0,4,207,5,203,0,20,0,0,1,36,0,17,16,0,33,50,23,7,38,35,
+34,6,21,20,4,51,51,17,35,2,190,254,231,254,216,1,106,1,62,230,196,68,177,
+179,234,254,1,5,243,64,185,1,51,23,1,43,1,6,1,23,1,57,86,160,84,226,206,206,
+224,254,53,0,1,0,113,254,158,4,68,4,94,0,33,0,0,5,22,51,50,54,53,52,38,39,
+38,38,53,16,0,33,50,23,7,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,39,1,
+115,88,92,103,110,85,101,240,225,1,30,1,27,217,193,62,187,165,192,187,122,
+161,190,162,201,170,114,78,182,23,80,66,55,58,9,23,255,241,1,7,1,17,80,155,
+78,176,195,187,160,18,20,133,125,136,165,20,0,1,0,199,0,0,3,227,5,182,0,11,
+0,0,1,17,35,17,33,17,35,17,33,21,33,17,3,178,176,254,125,184,3,28,253,156,
+3,14,254,88,1,7,253,147,5,182,162,253,250,0,1,0,176,254,20,3,106,4,74,0,11,
+0,0,1,35,17,33,21,33,17,33,17,35,17,33,1,100,180,2,186,253,250,1,191,176,
+254,241,254,20,6,54,150,254,82,254,68,1,41,0,1,255,246,255,236,3,205,5,203,
+0,35,0,0,1,33,19,54,53,52,38,35,34,7,39,54,51,50,22,21,20,7,7,33,3,6,21,20,
+22,51,50,55,21,6,35,34,38,53,52,55,2,190,253,134,118,29,52,42,48,36,47,67,
+80,128,132,37,57,2,123,137,29,53,45,57,46,60,63,120,140,37,2,170,1,147,90,
+56,49,47,22,147,31,127,113,81,122,196,254,45,90,56,49,47,19,150,24,127,112,
+81,122,0,1,0,98,254,20,4,16,6,31,0,40,0,0,1,52,38,35,34,7,39,54,51,50,22,
+21,20,6,7,3,37,21,3,6,6,21,20,22,51,50,55,21,6,35,34,38,53,52,54,55,19,5,
+53,18,18,1,111,45,43,45,52,49,79,87,114,134,40,38,145,2,204,237,46,16,65,
+73,62,40,64,67,141,148,31,29,206,253,39,135,130,5,49,42,46,22,141,31,113,
+102,62,149,101,254,131,150,119,253,101,137,73,34,60,61,16,141,25,130,126,
+56,117,79,2,66,156,113,1,92,1,83,0,1,255,236,0,0,4,51,5,205,0,26,0,0,33,18,
+17,52,39,5,39,1,38,39,1,39,1,38,35,34,6,7,39,54,54,51,32,0,17,16,3,2,244,
+125,7,254,123,79,1,190,29,53,254,27,82,1,198,108,146,92,182,63,86,91,206,
+126,1,68,1,92,121,1,47,1,33,82,59,229,137,1,6,139,86,254,228,139,1,10,74,
+54,52,143,68,57,254,44,254,83,254,218,254,218,0,1,255,102,254,20,3,172,6,
+31,0,23,0,0,37,52,39,5,39,37,38,39,5,39,37,38,36,39,39,4,0,0,17,20,2,7,35,
+18,2,248,19,254,31,45,1,240,42,77,254,43,47,1,174,119,254,200,171,58,1,76,
+1,241,1,9,86,76,184,166,248,93,128,158,135,162,145,128,154,139,142,148,203,
+40,168,63,254,148,253,211,254,171,201,254,126,147,1,91,0,1,0,184,254,102,
+7,117,5,182,0,46,0,0,37,35,6,6,35,34,38,39,35,6,6,35,34,38,53,17,51,17,20,
+22,51,50,54,53,17,51,17,20,22,51,50,54,53,17,51,17,20,6,35,33,53,33,50,54,
+53,52,54,6,197,11,51,200,119,139,175,45,10,58,211,126,211,193,185,118,129,
+173,165,185,119,133,172,161,185,235,220,251,10,4,250,122,142,8,168,87,101,
+100,104,98,106,216,230,4,12,251,244,143,144,193,205,3,157,251,244,143,144,
+204,235,3,116,250,99,207,228,162,147,126,42,66,0,1,0,166,254,41,6,205,4,74,
+0,44,0,0,37,6,6,35,32,39,35,6,6,35,34,38,53,17,51,17,16,51,50,54,53,17,51,
+17,20,22,51,50,54,53,17,51,17,20,6,35,33,53,33,50,54,53,53,52,55,6,23,50,
+170,104,254,254,78,10,53,183,116,186,185,178,223,152,145,178,110,116,152,
+141,180,240,252,251,197,4,70,146,157,6,150,83,87,184,88,96,191,212,2,203,
+253,61,254,252,175,186,2,94,253,61,130,130,187,210,2,58,251,184,235,238,149,
+161,149,26,66,70,0,1,0,115,0,0,4,156,5,203,0,30,0,0,1,38,35,34,6,21,20,22,
+51,50,54,53,17,51,17,35,17,52,55,35,6,6,35,34,2,53,52,0,51,50,23,3,59,99,
+110,147,162,146,149,205,186,185,187,11,11,61,216,130,225,246,1,15,235,142,
+120,4,250,47,190,170,171,190,202,236,1,168,250,74,1,240,47,96,92,107,1,17,
+250,236,1,28,49,0,1,0,113,254,20,4,63,4,96,0,31,0,0,1,34,6,21,20,22,51,50,
+54,53,17,51,17,35,17,52,55,35,6,6,35,34,2,17,16,18,51,50,22,23,7,38,2,33,
+121,125,146,141,166,155,180,180,11,13,50,179,113,213,237,224,208,29,89,35,
+47,49,3,203,218,206,203,213,184,215,2,56,249,202,1,234,84,70,81,89,1,40,1,
+15,1,21,1,38,13,13,144,21,0,1,0,199,254,0,4,236,5,182,0,28,0,0,33,35,17,51,
+17,54,54,51,50,22,18,21,16,0,33,34,38,39,53,22,51,32,17,16,2,35,34,6,7,1,
+127,184,184,71,180,93,159,243,131,254,227,254,252,85,128,70,123,137,1,119,
+189,173,94,152,76,5,182,253,166,62,61,168,254,191,215,254,130,254,103,21,
+28,164,49,2,115,1,2,1,26,54,69,0,1,0,174,254,10,4,35,4,74,0,27,0,0,1,54,54,
+51,50,22,18,21,16,2,35,34,39,53,22,51,50,54,53,52,38,35,34,7,17,35,17,51,
+1,98,60,126,83,132,196,108,244,225,140,106,110,126,149,143,141,141,136,100,
+180,180,2,125,46,50,141,254,242,193,254,211,254,182,60,159,61,227,248,212,
+232,98,254,35,4,74,0,1,0,96,255,236,3,254,5,203,0,45,0,0,1,34,6,21,20,22,
+23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,54,55,21,6,35,
+34,36,53,52,54,54,55,62,2,53,52,38,2,72,123,123,19,16,166,22,31,229,197,202,
+240,170,207,159,143,62,165,164,97,214,99,176,238,244,254,246,82,168,170,140,
+125,55,132,5,41,99,114,29,76,28,64,28,109,66,172,197,201,172,156,203,75,58,
+82,94,67,110,126,60,57,176,100,217,194,99,146,114,63,52,77,95,71,103,110,
+0,1,0,49,254,20,3,193,4,94,0,42,0,0,19,38,53,52,54,51,50,22,21,20,6,7,14,
+2,21,20,22,51,50,55,21,6,6,35,34,36,53,52,54,54,55,54,54,53,52,38,35,34,6,
+21,20,23,211,61,218,187,187,219,188,198,132,144,63,161,152,218,194,89,187,
+134,238,254,248,89,182,202,139,115,119,102,112,115,43,2,25,98,129,163,191,
+191,163,156,216,85,59,99,109,81,144,157,94,153,46,45,234,215,110,166,138,
+90,60,137,108,95,110,110,107,82,72,0,2,0,41,0,0,4,125,5,203,0,29,0,32,0,0,
+55,1,46,2,35,34,7,39,54,51,50,22,23,62,2,51,50,23,7,38,35,34,6,7,7,1,21,33,
+1,1,33,41,1,209,85,47,48,35,35,33,47,68,63,88,126,71,56,74,90,60,64,68,48,
+33,34,50,66,46,49,1,215,251,172,2,39,254,168,2,176,113,3,180,176,67,25,14,
+139,29,99,147,111,89,46,29,139,14,69,93,100,252,68,111,3,129,253,33,0,2,0,
+33,0,0,4,51,4,94,0,2,0,34,0,0,55,33,1,1,38,35,34,6,7,7,1,21,33,53,1,39,38,
+38,35,34,7,39,54,54,51,50,22,23,23,55,54,54,51,50,23,246,2,100,254,213,1,
+119,20,31,46,55,34,95,1,166,251,238,1,176,100,36,50,37,24,32,45,25,49,43,
+70,96,41,94,92,38,96,71,56,67,141,1,213,1,90,13,40,50,138,253,150,123,123,
+2,102,146,51,35,13,138,9,15,61,58,133,135,57,60,24,0,2,0,125,255,236,5,158,
+5,203,0,23,0,33,0,0,1,34,6,7,51,54,54,51,32,0,17,16,0,33,32,0,17,16,0,33,
+32,23,7,38,3,32,17,16,33,34,6,21,20,22,3,47,192,221,54,8,84,219,152,1,39,
+1,76,254,171,254,197,254,190,254,177,1,111,1,67,1,39,172,74,175,251,1,205,
+254,66,228,250,242,5,41,168,178,88,78,254,204,254,240,254,240,254,203,1,100,
+1,90,1,117,1,172,86,156,80,251,98,1,166,1,162,203,182,220,235,0,1,0,113,255,
+236,4,98,4,94,0,35,0,0,5,34,0,17,16,0,33,50,23,7,38,38,35,32,17,20,22,51,
+50,54,53,52,33,34,6,7,53,54,54,51,50,22,21,20,6,6,2,109,238,254,242,1,48,
+1,5,196,177,54,73,172,76,254,135,163,159,146,169,254,242,76,160,51,45,157,
+105,204,232,126,228,20,1,38,1,0,1,17,1,59,59,154,29,33,254,80,195,211,140,
+118,225,46,40,152,35,47,192,167,120,195,106,0,1,0,41,0,0,4,74,5,182,0,32,
+0,0,1,50,22,21,20,7,35,54,54,53,52,38,35,35,17,35,17,35,34,6,21,20,23,35,
+38,53,52,54,51,51,17,51,17,3,41,149,140,23,162,7,14,60,65,147,185,147,65,
+60,20,162,22,140,149,147,185,4,74,125,133,57,56,14,63,34,46,56,252,84,3,172,
+56,46,64,47,54,59,133,125,1,108,254,148,0,1,0,31,0,0,3,233,6,20,0,22,0,0,
+1,33,21,33,17,35,17,35,34,6,21,20,22,23,35,38,38,53,52,33,51,17,51,2,119,
+1,114,254,142,180,156,56,53,15,6,154,9,13,1,10,154,180,4,74,150,252,76,3,
+180,51,43,31,59,12,18,70,30,228,1,202,0,1,255,246,255,236,5,31,4,94,0,34,
+0,0,51,54,18,53,52,38,35,34,7,39,54,51,32,17,20,7,1,51,6,2,21,20,22,51,50,
+55,21,6,35,34,38,53,52,55,1,150,72,77,94,86,46,34,49,61,94,1,78,37,2,56,180,
+68,84,89,94,47,43,61,70,154,168,37,253,207,152,1,86,161,151,163,17,142,24,
+254,41,146,120,2,205,133,254,156,167,158,155,16,141,24,228,243,149,117,253,
+51,0,2,0,113,254,20,4,102,4,94,0,33,0,46,0,0,1,54,53,52,38,38,35,34,38,2,
+17,16,0,33,50,0,17,16,2,35,34,38,39,35,30,2,51,50,22,22,21,20,7,1,22,22,51,
+50,54,53,52,38,35,34,2,3,2,246,8,33,85,68,179,196,92,1,19,1,7,219,1,0,254,
+231,108,138,80,10,15,63,114,109,134,137,59,21,253,148,91,154,99,161,142,141,
+158,172,175,1,254,20,22,26,27,19,7,147,1,68,1,29,1,112,1,129,254,208,254,
+247,254,240,254,215,50,76,139,145,64,25,60,64,40,61,2,244,76,59,212,208,210,
+210,254,203,254,219,255,255,0,113,255,236,3,147,4,94,18,6,0,70,0,0,255,255,
+255,143,254,20,1,115,5,229,18,6,0,77,0,0,255,255,0,125,255,236,5,195,5,205,
+18,6,2,123,0,0,255,255,0,113,255,236,3,176,4,94,18,6,1,237,0,0,255,255,0,
+59,255,236,3,131,4,94,18,6,1,231,0,0,255,255,0,199,0,0,4,111,5,182,18,6,0,
+160,0,0,255,255,0,174,254,20,4,123,6,20,18,6,0,192,0,0,255,255,0,125,255,
+236,4,207,5,203,18,6,0,38,0,0,0,1,0,199,0,0,6,123,5,182,0,19,0,0,1,1,35,22,
+21,17,35,17,51,1,51,1,51,17,35,17,52,55,35,1,3,76,254,30,8,15,170,250,1,217,
+8,1,225,248,182,14,8,254,24,1,236,3,22,160,235,252,137,5,182,252,240,3,16,
+250,74,3,131,150,231,252,236,0,1,0,174,254,20,5,33,4,74,0,15,0,0,1,1,22,21,
+17,35,17,51,1,1,51,17,35,17,55,1,2,154,254,188,4,172,213,1,100,1,111,203,
+172,4,254,180,1,133,1,229,80,112,251,106,6,54,253,219,2,37,251,182,2,180,
+185,254,24,0,2,0,8,254,20,4,102,4,94,0,23,0,35,0,0,23,51,17,16,18,51,50,0,
+17,16,2,35,34,39,35,22,23,33,21,33,21,35,53,35,1,34,6,21,17,22,51,50,54,53,
+52,38,8,154,253,236,219,1,0,254,231,176,121,10,5,5,1,139,254,117,182,154,
+2,123,153,146,116,179,161,142,141,176,2,227,1,11,1,32,254,208,254,247,254,
+240,254,215,92,31,217,143,173,173,5,6,202,204,254,180,100,212,208,210,208,
+255,255,0,63,255,236,4,145,5,203,18,6,3,134,0,0,255,255,0,125,255,236,4,207,
+5,203,18,38,0,38,0,0,16,7,0,121,2,14,0,0,255,255,0,63,255,236,4,145,5,203,
+18,38,3,134,0,0,16,7,0,121,0,219,0,0,0,1,254,135,6,20,1,113,7,14,0,19,0,0,
+1,21,35,34,46,2,35,34,21,35,53,52,54,51,50,30,2,51,1,113,17,87,143,120,99,
+42,107,131,124,110,58,112,119,132,78,6,152,127,35,42,35,117,31,110,109,37,
+44,37,255,255,0,125,254,164,5,195,5,205,18,6,0,52,0,0,255,255,0,113,254,20,
+4,61,4,94,18,6,0,84,0,0,255,255,0,25,0,0,7,86,5,182,18,6,0,58,0,0,255,255,
+0,23,0,0,6,51,4,74,18,6,0,90,0,0,0,2,0,20,0,0,4,33,4,78,0,7,0,14,0,0,33,3,
+33,3,35,1,51,1,1,3,38,39,6,7,3,3,102,133,254,111,129,187,1,185,157,1,183,
+254,141,117,21,9,11,18,117,1,74,254,182,4,78,251,178,1,223,1,47,52,57,63,
+46,254,209,0,2,0,16,0,0,5,51,4,74,0,15,0,19,0,0,33,33,17,33,3,35,1,33,21,
+33,17,33,21,33,17,33,1,33,17,35,5,51,253,154,254,166,164,191,2,25,3,10,254,
+80,1,148,254,108,1,176,252,133,1,21,51,1,74,254,182,4,74,148,254,207,145,
+254,159,1,76,1,213,0,3,0,104,255,236,6,139,4,94,0,40,0,51,0,58,0,0,1,16,5,
+7,21,20,22,51,50,55,23,6,6,35,34,38,39,6,6,35,34,2,53,53,33,2,33,34,6,7,53,
+54,54,51,32,23,54,54,51,50,22,7,52,38,35,34,6,21,21,55,54,54,1,50,54,55,33,
+20,22,6,139,254,13,185,112,118,139,168,55,71,203,103,128,164,44,54,170,111,
+198,233,2,191,10,254,204,88,153,94,81,155,106,1,32,127,87,196,133,164,184,
+186,97,94,141,162,154,177,163,252,72,118,137,11,254,4,126,3,25,254,177,16,
+6,69,123,117,84,135,40,54,83,93,85,93,1,12,223,111,1,127,32,44,158,37,34,
+231,128,103,171,152,86,92,166,148,98,6,7,106,253,215,161,152,152,161,0,3,
+0,20,0,0,4,53,4,74,0,19,0,26,0,35,0,0,19,35,53,51,17,33,50,22,21,20,7,51,
+21,35,22,21,20,6,35,33,19,17,51,50,53,52,35,39,51,50,54,53,52,38,35,35,176,
+156,156,1,80,228,210,86,213,174,84,211,192,254,104,182,199,240,250,189,181,
+121,104,118,128,160,1,246,141,1,199,135,146,108,66,141,71,114,149,168,1,246,
+254,153,187,172,141,75,85,80,69,0,1,0,121,255,242,3,231,4,88,0,22,0,0,1,34,
+6,21,20,22,51,50,55,21,6,6,35,34,0,17,16,0,51,50,23,7,38,2,156,168,189,184,
+173,114,168,74,137,92,253,254,239,1,38,255,181,148,69,150,3,197,224,192,201,
+215,49,147,28,21,1,39,1,14,1,4,1,45,72,141,66,0,2,0,176,0,0,4,74,4,74,0,8,
+0,16,0,0,1,16,0,33,33,17,33,32,0,3,52,38,35,35,17,51,32,4,74,254,205,254,
+225,254,184,1,105,1,14,1,35,189,199,194,158,127,1,168,2,47,254,239,254,226,
+4,74,254,226,254,255,197,200,252,217,0,2,0,74,0,0,4,74,4,74,0,12,0,24,0,0,
+1,16,0,33,33,17,35,53,51,17,33,32,0,3,52,38,35,35,17,33,21,33,17,51,32,4,
+74,254,205,254,223,254,198,114,114,1,93,1,11,1,38,189,199,194,147,1,18,254,
+238,116,1,168,2,47,254,239,254,226,1,213,147,1,226,254,227,254,254,197,200,
+254,176,147,254,188,0,1,0,176,0,0,3,66,4,74,0,11,0,0,33,33,17,33,21,33,17,
+33,21,33,17,33,3,66,253,110,2,146,254,36,1,191,254,65,1,220,4,74,148,254,
+207,145,254,159,0,1,0,86,255,242,3,123,4,88,0,36,0,0,1,20,6,7,22,21,20,6,
+35,34,39,53,22,22,51,50,54,53,52,33,35,53,51,50,54,53,52,38,35,34,6,7,39,
+54,51,50,22,3,100,117,100,240,243,220,207,135,79,181,80,137,142,254,194,178,
+170,153,150,107,92,76,138,97,84,171,224,177,208,3,66,101,130,28,52,206,156,
+175,65,158,37,47,100,92,179,143,97,83,72,82,40,61,117,123,149,0,2,0,176,254,
+100,1,131,4,74,0,3,0,15,0,0,19,51,17,35,19,20,6,35,34,38,53,52,54,51,50,22,
+193,180,180,194,61,45,42,63,63,42,45,61,4,74,251,182,254,215,60,55,55,60,
+59,56,56,0,1,255,164,254,227,1,94,4,74,0,12,0,0,19,34,39,53,22,51,50,53,17,
+51,17,20,6,43,70,65,70,61,131,180,160,254,227,27,145,22,155,4,54,251,213,
+153,163,0,1,0,176,0,0,4,12,4,74,0,13,0,0,33,35,1,7,17,35,17,51,17,54,55,1,
+51,1,4,12,211,254,133,88,182,182,42,32,1,123,211,254,63,1,244,76,254,88,4,
+74,254,10,53,35,1,158,254,30,0,1,0,43,0,0,3,70,4,74,0,13,0,0,51,17,7,39,55,
+17,51,17,55,23,5,17,33,21,176,61,72,133,182,197,74,254,241,1,224,1,96,35,
+119,78,2,72,254,32,113,123,151,254,205,150,0,1,0,176,0,0,5,35,4,74,0,17,0,
+0,33,1,22,21,17,35,17,51,1,19,19,51,17,35,17,52,55,1,2,154,254,190,4,172,
+244,1,67,166,164,242,180,4,254,186,3,66,82,90,253,106,4,74,252,184,1,163,
+1,165,251,182,2,160,86,78,252,188,0,1,0,176,0,0,4,66,4,74,0,16,0,0,33,35,
+1,22,21,17,35,17,51,22,22,0,23,38,53,17,51,4,66,197,253,213,10,172,197,6,
+68,1,87,134,6,172,3,70,167,59,253,156,4,74,11,105,253,249,201,72,145,2,107,
+0,2,0,121,255,242,4,154,4,90,0,11,0,23,0,0,1,16,0,35,34,0,17,16,0,51,50,0,
+1,20,22,51,50,54,53,52,38,35,34,6,4,154,254,234,251,255,254,239,1,20,254,
+250,1,21,252,157,172,166,166,172,170,166,166,174,2,39,254,249,254,210,1,41,
+1,12,1,12,1,39,254,211,254,250,203,217,214,206,205,211,211,0,1,0,72,255,242,
+3,180,4,88,0,22,0,0,5,34,39,55,22,51,50,54,53,52,38,35,34,7,53,54,54,51,50,
+0,17,16,0,1,166,208,142,67,150,112,172,187,191,168,114,168,68,138,97,241,
+1,29,254,239,14,71,142,66,216,200,192,224,50,148,26,23,254,209,254,254,254,
+242,254,217,0,2,0,51,0,41,4,166,4,33,0,12,0,23,0,0,37,32,0,53,52,54,36,51,
+32,0,21,20,0,1,34,6,21,20,22,51,50,54,53,16,2,111,254,244,254,208,138,1,4,
+174,1,10,1,45,254,206,254,251,205,217,214,208,204,211,41,1,16,240,149,229,
+126,254,243,241,232,254,238,3,61,161,160,157,165,164,160,1,63,0,1,0,51,0,
+147,4,166,3,182,0,22,0,0,19,52,0,33,32,0,21,20,6,7,39,54,53,52,38,35,34,6,
+21,20,23,35,38,51,1,35,1,16,1,20,1,44,32,28,149,51,208,208,199,210,63,159,
+60,1,193,237,1,8,254,246,248,79,152,58,56,136,101,165,159,158,155,147,138,
+116,0,3,0,6,0,37,4,209,4,29,0,19,0,26,0,34,0,0,37,32,0,53,52,55,39,55,23,
+54,33,32,0,21,20,7,23,7,39,6,3,34,7,1,54,53,16,1,50,55,1,6,21,20,22,2,113,
+254,244,254,208,68,115,80,127,154,1,2,1,10,1,45,74,115,78,129,155,246,167,
+96,2,115,51,254,97,150,102,253,141,47,213,37,1,16,240,149,115,82,119,92,131,
+254,243,241,149,118,79,121,90,129,3,61,49,254,62,71,109,1,63,253,125,47,1,
+195,69,107,155,167,0,3,0,106,255,236,7,35,4,92,0,31,0,43,0,50,0,0,1,32,23,
+54,54,51,50,22,18,21,16,0,35,34,38,39,6,6,35,34,2,53,53,33,2,33,34,6,7,53,
+54,54,1,52,38,35,34,6,21,20,22,51,50,54,5,50,54,55,33,20,22,1,250,1,33,129,
+63,208,136,147,227,122,254,247,237,130,203,62,60,192,127,205,240,2,218,10,
+254,190,92,157,99,80,159,4,219,146,163,160,147,149,162,161,144,251,195,124,
+142,12,253,234,131,4,92,227,112,115,139,254,254,174,254,244,254,215,113,112,
+110,115,1,9,228,109,1,125,32,44,157,37,35,253,197,207,215,210,204,215,209,
+210,212,159,152,151,160,0,2,0,117,255,242,3,244,4,74,0,26,0,35,0,0,1,50,54,
+53,53,51,21,20,6,7,22,21,20,6,35,34,38,53,52,55,38,53,53,51,21,20,22,3,20,
+33,50,54,53,52,33,32,2,51,103,110,180,72,83,211,242,209,200,244,207,152,182,
+109,158,1,2,134,126,254,252,254,254,2,221,113,104,148,148,100,141,43,83,221,
+176,200,206,170,224,82,84,198,148,148,103,114,254,141,231,122,109,226,0,1,
+0,121,2,39,4,154,4,90,0,13,0,0,1,52,38,35,34,6,21,35,16,0,51,50,0,17,3,219,
+170,166,166,174,190,1,20,254,250,1,21,2,39,205,211,211,205,1,12,1,39,254,
+211,254,250,0,1,0,121,255,242,4,154,2,39,0,13,0,0,1,16,0,35,34,0,17,51,20,
+22,51,50,54,53,4,154,254,234,251,255,254,239,190,172,166,166,172,2,39,254,
+249,254,210,1,41,1,12,203,217,214,206,0,2,0,176,0,0,3,154,4,74,0,9,0,18,0,
+0,1,20,6,35,35,17,35,17,33,32,1,51,50,54,53,52,38,35,35,3,154,237,222,105,
+182,1,57,1,177,253,204,88,154,135,124,134,119,3,0,170,182,254,96,4,74,253,
+231,96,105,96,94,0,2,0,49,0,0,3,135,4,74,0,13,0,21,0,0,1,1,35,1,38,38,53,
+52,54,51,33,17,35,17,17,35,34,6,21,20,51,51,2,31,254,227,209,1,57,115,104,
+215,217,1,72,180,145,122,126,254,139,1,186,254,70,1,219,42,155,112,152,162,
+251,182,1,186,1,254,81,93,192,0,2,0,49,0,0,3,135,4,74,0,7,0,21,0,0,1,35,34,
+21,20,22,51,51,17,17,51,17,33,34,38,53,52,54,55,1,51,1,2,211,139,254,126,
+122,145,180,254,184,217,215,104,115,254,199,209,1,29,2,0,193,92,82,1,254,
+1,187,251,182,162,151,112,156,42,1,219,254,69,0,1,0,43,0,0,3,139,4,74,0,7,
+0,0,33,35,17,33,53,33,21,33,2,55,182,254,170,3,96,254,172,3,182,148,148,0,
+1,0,166,255,242,4,31,4,74,0,17,0,0,1,17,20,6,35,34,38,53,17,51,17,20,22,51,
+50,54,53,17,4,31,237,212,209,231,182,130,134,127,135,4,74,253,61,187,218,
+215,194,2,191,253,61,125,135,134,126,2,195,0,1,0,78,0,96,4,172,3,254,0,20,
+0,0,19,33,50,54,53,52,38,35,33,53,33,21,7,21,22,22,21,20,6,35,33,78,2,190,
+133,131,187,210,253,199,4,74,150,81,89,196,207,253,53,1,18,119,127,169,153,
+180,145,27,10,51,184,111,202,196,0,3,0,78,0,96,6,6,3,254,0,20,0,32,0,44,0,
+0,1,33,50,54,53,52,38,35,33,53,33,21,7,21,22,22,21,20,6,35,33,3,50,22,21,
+20,6,35,34,38,53,52,54,19,50,22,21,20,6,35,34,38,53,52,54,1,168,2,190,134,
+131,189,209,253,199,4,74,150,82,88,197,206,253,53,244,54,47,47,54,52,50,50,
+52,54,47,47,54,52,50,50,1,18,121,127,168,152,180,145,27,10,52,183,109,202,
+198,2,238,56,40,39,58,58,39,40,56,254,127,56,38,39,58,58,39,38,56,0,1,0,78,
+255,27,4,172,5,66,0,34,0,0,23,33,50,54,53,52,38,35,33,53,33,32,53,52,38,35,
+33,53,33,21,7,21,22,22,21,16,7,21,22,22,21,20,6,35,33,78,2,194,130,130,175,
+185,253,162,2,194,1,4,186,211,253,199,4,74,150,80,90,184,88,96,192,211,253,
+53,51,108,115,152,145,178,225,153,140,181,146,26,11,47,171,105,254,254,78,
+10,52,183,116,187,185,0,1,0,20,0,0,3,231,4,74,0,10,0,0,19,51,19,22,23,54,
+55,19,51,1,35,20,191,250,35,14,17,32,250,190,254,107,170,4,74,253,71,100,
+70,86,89,2,180,251,182,0,1,0,41,0,0,5,205,4,74,0,24,0,0,33,35,3,38,39,6,7,
+3,35,1,51,19,22,23,54,55,19,51,19,22,23,54,55,19,51,4,160,174,217,27,6,8,
+27,211,174,254,213,190,172,17,16,10,27,197,176,205,22,17,8,24,172,191,2,199,
+85,52,45,96,253,61,4,74,253,104,64,89,75,86,2,144,253,108,71,93,64,96,2,152,
+0,1,0,86,0,0,3,121,4,74,0,9,0,0,33,33,53,1,33,53,33,21,1,33,3,121,252,221,
+2,51,253,223,3,2,253,205,2,66,121,3,59,150,121,252,197,0,1,0,68,255,236,3,
+143,4,74,0,23,0,0,1,33,53,33,21,1,4,17,20,6,35,34,39,53,22,51,50,54,53,52,
+38,35,35,53,2,106,253,238,3,12,254,168,1,131,247,222,242,132,183,189,143,
+150,154,159,148,3,190,140,135,254,215,33,254,198,159,180,71,162,86,103,100,
+102,90,133,0,1,0,100,255,242,3,70,4,88,0,35,0,0,19,52,54,54,55,54,54,53,52,
+38,35,34,7,39,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,21,6,35,34,38,
+100,63,128,137,137,90,93,93,98,152,55,151,150,169,204,133,164,157,103,114,
+113,68,174,86,137,185,194,220,1,45,74,110,87,51,48,82,70,63,79,66,145,68,
+154,133,117,153,59,56,87,64,75,83,44,38,162,65,168,0,1,0,33,255,236,3,233,
+4,90,0,33,0,0,1,22,22,51,50,55,21,6,35,34,38,39,6,6,35,34,39,53,22,22,51,
+50,54,55,38,38,53,52,54,51,50,22,21,20,2,127,68,132,44,55,63,50,85,91,167,
+88,92,169,89,83,54,14,74,22,57,123,74,124,115,200,162,161,200,1,66,92,101,
+21,144,26,118,115,118,115,26,144,7,14,93,100,131,219,100,150,192,191,151,
+193,0,1,0,176,0,0,3,72,4,74,0,5,0,0,1,21,33,17,35,17,3,72,254,30,182,4,74,
+150,252,76,4,74,0,1,0,20,0,0,3,231,4,74,0,10,0,0,33,35,3,38,39,6,7,3,35,1,
+51,3,231,190,250,36,13,17,32,250,191,1,150,170,2,184,106,64,84,90,253,76,
+4,74,0,1,0,176,0,0,4,18,4,74,0,7,0,0,33,35,17,33,17,35,17,33,4,18,178,254,
+6,182,3,98,3,182,252,74,4,74,255,255,0,176,0,0,3,154,4,74,18,6,5,160,0,0,
+0,1,0,109,0,0,4,201,4,74,0,25,0,0,33,35,17,35,34,38,38,53,17,51,17,16,33,
+17,51,17,32,17,17,51,17,20,6,6,35,35,2,242,179,12,146,203,105,182,1,28,179,
+1,30,185,106,203,148,14,1,68,101,182,122,1,113,254,147,254,248,2,117,253,
+139,1,4,1,113,254,145,124,182,101,0,1,0,29,255,240,3,242,4,74,0,19,0,0,33,
+35,17,33,7,2,2,6,35,34,39,53,22,51,50,54,54,18,55,33,3,242,183,254,203,22,
+50,71,118,105,62,61,64,42,42,51,48,73,18,2,131,3,182,171,254,108,254,240,
+119,24,148,31,81,215,2,23,142,0,2,0,18,2,180,3,209,6,176,0,7,0,14,0,0,1,3,
+33,3,35,1,51,1,1,3,38,39,6,7,3,3,37,123,254,141,121,172,1,152,145,1,150,254,
+170,109,18,10,14,13,106,2,180,1,49,254,207,3,252,252,4,1,187,1,24,49,52,69,
+32,254,232,0,2,0,14,2,180,4,207,6,172,0,15,0,19,0,0,1,33,17,33,3,35,1,33,
+21,33,17,33,21,33,17,33,1,33,17,35,4,207,253,201,254,190,152,176,1,242,2,
+207,254,112,1,117,254,139,1,144,252,201,1,0,48,2,180,1,49,254,207,3,248,137,
+254,229,133,254,186,1,50,1,178,0,3,0,164,2,180,3,145,6,172,0,13,0,22,0,29,
+0,0,19,33,50,22,21,20,6,7,22,21,20,6,35,33,19,51,50,54,53,52,38,35,35,17,
+17,51,50,53,52,35,164,1,53,213,193,84,80,198,197,175,254,135,168,166,112,
+97,109,119,147,184,221,231,6,172,126,134,82,114,23,57,187,137,156,2,82,70,
+80,74,63,254,96,254,180,172,160,0,3,0,18,2,180,3,229,6,172,0,19,0,26,0,35,
+0,0,19,35,53,51,17,33,50,22,21,20,7,51,21,35,22,21,20,6,35,33,19,17,51,50,
+53,52,35,39,51,50,54,53,52,38,35,35,164,146,146,1,53,213,193,80,198,161,77,
+197,175,254,135,168,184,221,231,174,166,112,97,109,119,147,4,133,129,1,166,
+126,134,97,65,129,68,104,137,156,1,209,254,180,172,160,129,70,80,74,63,0,
+2,0,164,2,180,3,248,6,172,0,8,0,16,0,0,1,20,0,33,33,17,33,50,0,7,52,38,35,
+35,17,51,32,3,248,254,229,254,246,254,209,1,76,248,1,16,174,191,174,145,117,
+1,137,4,186,252,254,246,3,248,254,249,239,189,178,253,22,0,1,0,164,2,180,
+3,2,6,172,0,11,0,0,1,33,17,33,21,33,17,33,21,33,17,33,3,2,253,162,2,94,254,
+74,1,157,254,99,1,182,2,180,3,248,137,254,229,133,254,186,0,1,0,111,2,180,
+2,207,6,172,0,11,0,0,19,33,17,33,53,33,17,33,53,33,17,33,111,1,182,254,100,
+1,156,254,74,2,96,253,160,3,61,1,70,133,1,27,137,252,8,0,1,0,113,2,168,3,
+227,6,184,0,25,0,0,1,33,17,6,35,34,0,53,52,0,51,50,23,7,38,35,34,6,21,20,
+22,51,50,55,17,35,2,92,1,135,167,210,239,254,246,1,37,251,171,155,59,144,
+129,172,192,185,175,69,111,223,4,217,254,4,53,1,18,246,244,1,20,65,135,65,
+205,180,191,196,18,1,17,0,1,0,164,2,180,3,211,6,172,0,11,0,0,1,35,17,33,17,
+35,17,51,17,33,17,51,3,211,168,254,33,168,168,1,223,168,2,180,1,205,254,51,
+3,248,254,92,1,164,0,1,0,84,2,180,1,233,6,172,0,11,0,0,1,33,53,55,17,39,53,
+33,21,7,17,23,1,233,254,107,119,119,1,149,120,120,2,180,96,27,3,0,29,96,96,
+29,253,0,27,0,1,255,170,1,172,1,68,6,172,0,13,0,0,19,34,39,53,22,51,50,54,
+53,17,51,17,20,6,39,61,64,71,52,60,61,166,146,1,172,25,135,21,74,70,3,229,
+252,37,141,152,0,1,0,164,2,180,3,190,6,172,0,13,0,0,1,35,1,7,17,35,17,51,
+17,54,54,1,51,1,3,190,194,254,162,82,168,168,20,35,1,107,196,254,96,2,180,
+1,207,72,254,121,3,248,254,47,26,43,1,140,254,66,0,1,0,164,2,180,3,6,6,172,
+0,5,0,0,19,17,51,17,33,21,164,168,1,186,2,180,3,248,252,147,139,0,1,0,164,
+2,180,4,193,6,172,0,16,0,0,1,1,22,21,17,35,17,51,1,1,51,17,35,17,52,55,1,
+2,104,254,213,5,158,225,1,43,1,49,224,168,4,254,211,2,180,3,2,92,65,253,155,
+3,248,252,248,3,8,252,8,2,109,81,70,252,252,0,1,0,164,2,180,3,240,6,172,0,
+13,0,0,1,35,1,23,23,17,35,17,51,1,38,53,17,51,3,240,183,254,0,6,3,158,180,
+1,254,6,160,2,180,3,6,98,108,253,200,3,248,252,250,90,111,2,61,0,1,0,164,
+2,180,3,254,6,172,0,13,0,0,19,51,17,20,7,1,51,17,35,17,52,55,1,35,164,160,
+7,2,17,176,160,6,253,240,176,6,172,253,211,133,84,3,6,252,8,2,39,154,69,252,
+250,0,2,0,113,2,168,4,66,6,186,0,11,0,23,0,0,1,20,0,35,34,2,53,52,0,51,50,
+0,5,20,22,51,50,54,53,52,38,35,34,6,4,66,254,252,230,234,253,1,0,233,232,
+1,0,252,223,161,150,154,159,157,154,153,160,4,178,247,254,237,1,16,250,250,
+1,14,254,236,244,193,196,196,193,189,196,194,0,2,0,109,2,168,3,168,6,172,
+0,28,0,36,0,0,1,50,54,53,53,51,21,20,6,7,22,22,21,20,6,35,34,38,53,52,55,
+38,38,53,53,51,21,20,22,3,20,51,50,53,52,35,34,2,8,95,104,166,66,78,90,105,
+223,195,185,224,190,69,70,168,102,147,237,242,242,237,5,90,106,95,137,137,
+93,129,40,35,140,106,162,186,191,157,206,77,38,134,88,137,137,97,104,254,
+170,215,215,207,0,2,0,164,2,180,3,84,6,172,0,9,0,18,0,0,1,20,6,35,35,17,35,
+17,33,32,1,51,50,54,53,52,38,35,35,3,84,222,202,96,168,1,33,1,143,253,248,
+82,135,131,114,124,110,5,123,158,168,254,127,3,248,254,14,86,101,88,88,0,
+2,0,164,2,180,3,174,6,172,0,8,0,21,0,0,1,51,50,54,53,52,38,35,35,17,17,35,
+17,33,50,22,21,20,7,1,35,3,1,76,133,112,103,110,113,125,168,1,45,199,188,
+197,1,31,197,245,4,209,87,87,89,75,254,41,254,104,3,248,145,152,192,76,254,
+61,1,152,0,1,0,39,2,180,3,72,6,172,0,7,0,0,1,35,17,33,53,33,21,33,2,12,168,
+254,195,3,33,254,196,2,180,3,111,137,137,0,1,0,154,2,168,3,207,6,172,0,16,
+0,0,1,17,20,6,35,34,38,53,17,51,17,20,51,50,54,53,17,3,207,217,197,194,213,
+168,245,116,126,6,172,253,115,174,201,200,179,2,137,253,115,242,125,117,2,
+141,0,1,0,37,2,180,5,94,6,172,0,24,0,0,1,35,3,38,39,6,6,3,35,1,51,19,22,23,
+54,55,19,51,19,22,23,55,55,19,51,4,72,162,201,24,7,3,8,216,160,254,234,178,
+158,9,21,13,22,180,164,191,15,20,14,8,168,176,2,180,2,146,82,45,23,38,253,
+44,3,248,253,154,34,108,84,66,2,94,253,158,54,98,74,40,2,136,0,2,0,90,2,168,
+2,236,5,193,0,24,0,35,0,0,1,39,6,6,35,34,38,53,52,37,55,53,52,38,35,34,6,
+7,39,54,51,50,22,21,17,37,50,54,53,53,7,6,6,21,20,22,2,106,18,46,113,91,123,
+137,1,129,111,73,67,55,116,54,49,142,141,148,145,254,143,96,109,92,121,111,
+66,2,180,86,52,46,122,109,238,12,4,31,86,66,41,23,117,72,125,138,253,250,
+113,105,94,51,4,5,66,71,54,50,0,2,0,141,2,167,3,31,5,193,0,24,0,35,0,0,1,
+23,54,54,51,50,22,21,20,5,7,21,20,22,51,50,54,55,23,6,35,34,38,53,17,5,34,
+6,21,21,55,54,54,53,52,38,1,14,21,51,115,84,122,136,254,129,111,73,66,56,
+114,56,49,140,143,148,147,1,115,96,109,90,122,112,66,5,179,84,55,43,124,109,
+238,12,4,31,85,66,40,25,119,71,124,138,2,6,111,106,94,52,4,6,65,71,54,52,
+0,2,0,104,2,168,3,51,5,195,0,15,0,28,0,0,1,34,38,53,52,54,51,50,23,55,51,
+17,35,39,6,6,39,50,54,53,53,52,38,35,34,6,21,20,22,1,180,158,174,177,157,
+132,96,14,139,139,14,41,108,60,109,89,96,104,86,97,92,2,168,208,187,191,209,
+117,104,252,254,105,56,61,127,123,123,20,148,125,142,131,127,139,0,3,0,98,
+2,168,4,203,5,195,0,38,0,49,0,55,0,0,1,20,5,7,21,20,51,50,55,23,6,6,35,34,
+39,6,6,35,34,38,53,53,33,38,35,34,6,7,53,54,54,51,50,22,23,54,51,50,22,7,
+52,38,35,34,6,21,21,55,54,54,1,50,55,33,22,22,4,203,254,145,108,141,93,130,
+51,56,156,72,166,72,38,117,74,145,173,1,232,16,185,69,118,65,65,118,73,96,
+150,43,96,193,121,139,168,62,51,89,101,86,112,105,253,125,143,23,254,198,
+4,76,4,217,240,10,4,33,149,65,116,32,42,119,56,63,185,159,88,231,32,29,137,
+32,24,82,74,156,120,112,54,53,106,93,51,4,4,65,254,144,184,86,98,0,2,0,145,
+2,168,3,94,6,233,0,17,0,29,0,0,1,50,22,21,20,6,35,34,39,7,35,17,51,17,20,
+7,54,54,23,34,6,21,21,20,22,51,50,17,52,38,2,14,157,179,179,157,149,84,23,
+125,166,8,47,102,54,102,93,95,104,182,90,5,193,205,191,189,208,115,103,4,
+53,254,244,85,60,59,58,127,118,136,21,144,120,1,16,133,134,0,2,0,104,2,168,
+3,51,6,233,0,18,0,30,0,0,1,34,38,53,52,54,51,50,22,23,38,53,17,51,17,35,39,
+6,6,39,50,53,53,52,38,35,34,6,21,20,22,1,180,158,174,177,157,78,105,41,9,
+166,139,14,54,107,48,198,96,104,86,97,92,2,168,208,187,191,209,61,56,77,72,
+1,6,251,203,105,64,53,127,213,53,148,125,142,131,127,139,0,2,0,104,2,168,
+3,27,5,195,0,19,0,26,0,0,1,34,38,53,52,54,51,50,22,21,21,33,22,22,51,50,54,
+55,21,6,3,34,6,7,33,38,38,1,236,182,206,192,165,155,179,253,245,8,113,103,
+69,123,72,117,184,78,92,13,1,91,4,79,2,168,208,183,183,221,191,158,88,112,
+117,32,31,141,51,2,156,97,88,84,101,0,2,0,98,2,168,3,20,5,195,0,18,0,24,0,
+0,1,50,22,21,20,6,35,34,38,53,53,33,38,38,35,34,7,53,54,19,50,55,33,22,22,
+1,145,180,207,194,162,155,179,2,8,6,114,103,116,146,112,189,152,30,254,164,
+4,87,5,195,208,184,184,219,188,160,86,113,116,61,139,54,253,98,184,88,96,
+0,1,0,88,2,168,2,197,5,195,0,32,0,0,1,21,35,34,21,20,51,50,55,21,6,35,34,
+38,53,52,55,38,38,53,52,54,51,50,22,23,7,38,35,34,21,20,51,2,57,123,194,182,
+117,149,108,166,160,178,176,66,85,172,141,73,129,81,62,116,107,152,197,4,
+133,129,113,110,72,142,55,122,105,138,49,20,87,63,97,114,25,37,123,56,91,
+98,0,1,0,72,2,168,2,184,5,195,0,31,0,0,1,50,53,52,35,34,6,7,39,54,51,50,22,
+21,20,7,22,21,20,6,35,34,39,53,22,51,50,53,52,35,35,53,1,59,199,154,59,103,
+63,57,134,155,142,163,152,176,179,165,172,108,149,129,185,197,123,4,133,98,
+91,28,26,123,60,112,97,125,41,45,146,106,123,53,141,69,113,110,129,0,2,0,
+102,1,104,3,49,5,195,0,12,0,40,0,0,1,50,54,53,53,52,38,35,34,6,21,20,22,5,
+52,55,6,6,35,34,38,53,52,54,51,50,23,55,51,17,20,6,35,34,39,53,22,51,50,54,
+53,1,199,104,96,96,106,87,96,94,1,33,4,43,106,72,158,176,178,156,140,92,12,
+137,176,184,177,116,136,165,88,100,3,37,116,126,28,142,129,142,131,130,138,
+92,53,27,57,56,207,188,185,215,117,104,253,0,166,168,54,147,72,102,93,0,2,
+0,137,1,158,1,66,5,182,0,3,0,15,0,0,19,51,17,35,23,20,6,35,34,38,53,52,54,
+51,50,22,147,166,166,175,54,41,41,49,55,35,41,54,5,182,252,254,184,50,44,
+51,43,44,46,45,0,1,0,145,2,180,3,55,6,233,0,14,0,0,1,55,55,51,1,1,35,1,7,
+17,35,17,51,17,20,1,51,60,247,193,254,190,1,82,194,255,0,62,166,166,4,113,
+71,254,254,180,254,74,1,80,37,254,213,4,53,253,220,48,0,1,0,145,2,180,4,254,
+5,195,0,30,0,0,1,17,52,35,34,6,21,17,35,17,52,35,34,6,21,17,35,17,51,23,54,
+54,51,50,23,54,51,50,22,21,17,4,92,135,101,85,164,137,94,89,166,142,12,46,
+108,65,173,65,86,159,139,138,2,180,1,236,162,120,112,254,90,1,236,162,120,
+136,254,114,3,2,114,71,56,138,138,136,151,254,16,0,1,0,145,1,104,3,61,5,195,
+0,26,0,0,1,34,39,53,22,51,50,53,17,52,35,34,6,21,17,35,17,51,23,54,51,50,
+22,21,17,20,6,2,94,57,64,65,40,76,150,107,98,166,142,12,98,146,141,145,108,
+1,104,23,127,21,103,2,78,164,119,135,254,112,3,2,106,119,136,149,253,174,
+109,127,0,2,0,104,2,168,3,80,5,195,0,11,0,22,0,0,1,20,6,35,34,38,53,52,54,
+51,50,22,5,20,22,51,50,17,52,38,35,34,6,3,80,199,176,166,203,197,176,170,
+201,253,192,99,104,205,99,106,101,102,4,55,188,211,213,186,186,210,214,182,
+128,144,1,16,125,142,137,0,1,0,70,2,168,2,158,5,195,0,20,0,0,19,54,51,50,
+22,21,20,6,35,34,39,55,22,22,51,50,17,16,35,34,7,86,86,125,181,192,189,178,
+134,99,49,42,99,37,203,201,98,115,5,147,48,211,191,186,207,47,129,20,25,1,
+8,1,10,53,0,1,0,104,4,53,3,80,5,195,0,12,0,0,1,52,38,35,34,17,35,52,54,51,
+50,22,21,2,168,104,101,203,168,198,175,169,202,4,53,132,137,254,243,186,212,
+216,182,0,1,0,104,2,168,3,80,4,53,0,11,0,0,1,16,51,50,17,51,20,6,35,34,38,
+53,1,16,203,205,168,198,177,167,202,4,53,254,242,1,14,186,211,212,185,0,2,
+0,145,1,104,3,94,5,195,0,18,0,30,0,0,1,50,22,21,20,6,35,34,38,39,22,21,17,
+35,17,51,23,54,54,23,34,21,21,20,22,51,50,54,53,52,38,2,16,157,177,179,157,
+77,106,40,8,166,140,14,49,110,50,199,96,105,91,93,93,5,195,206,190,192,207,
+61,56,72,78,254,225,4,78,104,61,56,129,236,29,148,126,148,126,127,138,0,1,
+0,49,2,168,2,35,6,96,0,23,0,0,1,50,54,55,21,6,6,35,34,38,53,17,35,53,55,55,
+51,21,51,21,35,17,20,22,1,164,27,77,23,26,84,38,124,117,109,113,51,109,221,
+221,54,3,37,16,8,122,12,15,122,120,1,161,78,51,164,170,123,254,99,62,59,0,
+1,0,139,2,168,3,53,5,182,0,19,0,0,1,17,20,22,51,50,54,53,17,51,17,35,39,6,
+6,35,34,38,53,17,1,49,72,76,107,97,164,139,12,45,121,68,147,150,5,182,254,
+21,84,80,122,132,1,145,252,254,113,57,68,133,148,1,245,0,1,0,88,2,217,3,102,
+5,131,0,19,0,0,19,33,50,54,53,52,38,35,33,53,33,21,7,22,22,21,20,6,35,33,
+88,1,236,83,80,121,133,254,111,3,2,113,57,68,133,147,254,10,3,127,72,75,107,
+98,164,139,12,45,121,68,148,149,0,1,0,139,2,168,4,250,5,182,0,31,0,0,1,17,
+20,51,50,54,53,17,51,17,20,51,50,54,53,17,51,17,35,39,6,6,35,34,39,6,6,35,
+34,38,53,17,1,47,135,100,87,163,136,95,89,166,141,13,46,108,65,170,67,41,
+132,75,137,140,5,182,254,21,164,119,112,1,168,254,21,164,119,137,1,143,252,
+254,113,71,54,135,68,67,134,151,1,241,0,1,0,18,2,180,3,27,5,182,0,10,0,0,
+1,1,51,19,22,23,54,55,19,51,1,1,61,254,213,175,167,24,22,16,31,165,177,254,
+209,2,180,3,2,254,64,62,110,93,79,1,192,252,254,0,1,0,14,2,168,2,203,5,195,
+0,33,0,0,1,20,6,7,22,51,50,55,21,6,35,34,38,38,39,6,6,35,34,39,53,22,51,50,
+54,54,55,38,53,52,54,51,50,22,2,117,89,77,74,84,50,44,36,69,59,72,73,39,57,
+110,79,70,37,49,41,38,46,53,27,164,146,117,116,146,4,186,69,167,67,100,12,
+119,20,25,56,48,66,63,20,121,14,20,44,36,149,156,115,148,148,0,2,0,145,1,
+104,3,129,6,242,0,17,0,36,0,0,1,50,22,21,20,7,22,21,20,6,35,34,39,17,35,17,
+52,54,23,34,21,17,22,51,50,53,52,38,35,35,53,51,50,54,53,52,38,1,250,161,
+185,195,240,192,173,115,106,166,189,170,193,104,105,213,120,107,94,80,92,
+102,99,6,242,146,133,183,50,47,234,148,157,53,254,139,4,62,158,174,129,209,
+253,184,51,190,98,99,129,88,84,78,78,0,1,0,25,1,104,3,31,5,182,0,16,0,0,1,
+35,52,54,55,1,51,19,22,23,54,55,19,51,1,6,6,1,186,174,39,33,254,197,172,165,
+45,15,15,38,156,168,254,225,33,37,1,104,58,199,96,2,237,254,113,114,70,72,
+108,1,147,253,25,86,200,0,2,0,102,2,168,3,78,6,233,0,29,0,41,0,0,19,52,54,
+55,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,
+38,37,52,38,39,6,6,21,20,22,51,50,54,102,145,134,83,75,149,126,75,150,94,
+72,140,113,53,48,67,111,150,127,199,176,167,202,2,64,86,76,120,124,109,90,
+100,107,3,236,116,175,44,51,104,69,98,108,35,44,125,77,45,34,42,68,58,81,
+168,114,165,187,176,176,88,110,38,26,140,101,89,105,114,0,2,0,104,1,104,3,
+250,5,197,0,23,0,32,0,0,1,17,38,38,53,52,55,23,6,6,21,20,23,17,52,54,51,50,
+22,21,20,6,7,17,19,52,38,35,34,21,17,54,54,1,215,180,187,160,127,57,66,203,
+132,114,138,163,208,175,215,74,57,84,100,115,1,104,1,64,19,207,175,207,189,
+86,70,150,94,236,34,1,143,132,137,210,171,178,220,16,254,192,2,222,125,127,
+138,254,113,18,150,0,1,0,2,1,104,3,72,5,184,0,32,0,0,19,50,22,22,23,23,19,
+51,1,19,22,22,51,50,55,21,6,35,34,38,39,39,3,35,1,3,38,38,35,34,7,53,54,174,
+45,60,46,37,80,203,176,254,207,127,29,48,36,36,48,47,62,89,106,44,84,232,
+174,1,76,115,20,41,31,27,34,47,5,184,28,58,90,198,1,116,253,234,254,190,71,
+48,11,121,17,82,113,221,254,96,2,70,1,33,51,55,8,121,14,0,2,0,137,255,96,
+1,66,3,121,0,3,0,15,0,0,5,35,17,51,39,52,54,51,50,22,21,20,6,35,34,38,1,55,
+166,166,174,54,40,36,55,55,36,40,54,160,3,2,185,49,45,45,49,45,45,45,0,1,
+0,145,255,96,2,121,2,111,0,15,0,0,1,50,23,7,38,35,34,6,21,17,35,17,51,23,
+54,54,2,8,50,63,19,51,49,86,117,166,144,8,47,99,2,111,13,141,14,132,101,254,
+102,3,2,161,99,75,255,255,0,139,255,85,3,53,2,99,16,7,5,224,0,0,252,173,255,
+255,0,18,255,97,3,27,2,99,16,7,5,227,0,0,252,173,255,255,0,145,254,21,3,129,
+3,159,16,7,5,229,0,0,252,173,255,255,0,25,254,21,3,31,2,99,16,7,5,230,0,0,
+252,173,0,2,0,139,254,20,3,78,2,111,0,15,0,27,0,0,37,20,6,35,34,39,22,21,
+21,35,17,52,54,51,50,22,37,34,6,21,21,22,51,50,54,53,52,38,3,78,186,168,110,
+83,6,166,186,173,159,189,254,158,96,91,72,112,101,90,89,225,191,206,47,56,
+100,211,2,213,189,201,212,83,129,134,217,59,137,133,137,132,255,255,0,104,
+254,21,3,250,2,114,16,7,5,232,0,0,252,173,255,255,0,2,254,21,3,72,2,101,16,
+7,5,233,0,0,252,173,0,2,0,166,255,236,7,8,4,94,0,37,0,44,0,0,5,34,38,39,6,
+6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,51,21,54,51,50,18,21,21,33,22,
+22,51,50,54,55,21,6,6,3,34,6,7,33,38,38,5,111,136,202,72,52,193,130,209,231,
+180,132,134,125,135,181,117,178,207,245,253,17,5,180,165,88,155,109,88,162,
+155,129,151,13,2,47,2,138,20,94,106,95,99,215,194,2,191,253,61,125,135,132,
+128,2,195,115,135,254,243,226,109,187,194,31,45,158,38,33,3,223,166,148,154,
+160,0,2,255,188,255,236,4,123,6,20,0,44,0,57,0,0,1,34,39,21,20,7,51,54,51,
+50,18,17,16,2,35,34,38,39,35,6,7,35,17,38,35,34,6,7,35,54,54,51,50,23,53,
+51,21,22,51,50,54,55,51,6,6,23,34,6,21,21,20,22,51,50,54,53,52,38,1,154,28,
+28,10,10,111,229,217,236,240,213,111,174,55,14,31,6,129,33,6,43,43,12,105,
+11,101,85,23,22,180,30,22,41,43,14,102,10,102,170,166,144,147,167,148,145,
+146,4,162,10,18,113,113,164,254,213,254,244,254,240,254,215,80,79,120,19,
+5,14,9,59,60,122,140,6,116,213,14,59,60,122,140,219,188,224,8,225,193,217,
+205,208,208,0,2,0,113,255,236,5,45,6,20,0,43,0,56,0,0,1,34,39,17,35,39,35,
+6,35,34,2,17,16,18,51,50,23,51,38,38,53,53,38,35,34,6,7,35,54,54,51,50,23,
+53,51,21,22,51,50,54,55,51,6,6,1,50,54,53,53,52,38,35,34,6,21,20,22,4,104,
+21,22,145,27,8,115,227,214,236,237,215,221,119,13,3,10,35,16,43,43,12,105,
+11,101,85,29,28,180,16,23,42,43,14,102,10,102,253,147,164,151,153,164,139,
+152,151,4,162,6,251,88,147,167,1,40,1,15,1,13,1,46,162,20,121,21,170,15,59,
+60,122,140,10,120,219,8,59,60,122,140,251,223,179,204,33,229,195,221,205,
+204,210,0,1,255,242,0,0,3,25,6,31,0,45,0,0,1,34,39,17,35,17,38,35,34,6,7,
+35,54,54,51,50,23,17,35,53,55,53,52,54,51,50,23,7,38,35,34,6,21,21,33,21,
+33,17,22,51,50,54,55,51,6,6,1,207,32,28,180,18,17,43,43,12,104,11,100,85,
+20,21,192,192,175,182,105,108,48,93,70,91,88,1,21,254,235,30,26,42,42,14,
+102,10,104,1,168,12,254,76,2,23,6,59,60,122,140,6,1,24,84,62,63,200,200,37,
+141,30,120,130,71,140,254,136,15,59,60,126,136,0,3,255,225,0,0,7,162,4,94,
+0,43,0,52,0,61,0,0,33,17,34,37,17,35,17,36,39,17,35,17,6,6,7,35,54,54,55,
+17,51,23,51,54,54,51,32,23,51,54,54,51,50,22,21,21,54,54,55,51,6,6,7,17,1,
+4,23,53,16,35,34,6,21,37,22,5,53,52,38,35,34,6,6,35,184,254,176,179,254,226,
+232,180,45,47,8,105,16,96,93,145,27,10,47,171,106,1,2,78,10,53,183,116,186,
+185,50,43,9,103,11,97,97,253,70,1,66,198,223,153,144,253,73,193,1,67,109,
+116,135,141,1,147,43,254,66,1,215,42,5,253,250,1,252,11,46,50,96,120,26,1,
+199,150,80,90,184,88,96,192,211,158,12,53,44,97,122,25,254,90,2,80,41,4,160,
+1,4,178,183,58,3,45,91,130,130,146,0,2,255,225,0,0,5,25,4,94,0,32,0,43,0,
+0,33,17,38,39,38,39,17,35,17,6,7,35,54,54,55,17,51,23,51,54,54,51,50,22,21,
+21,54,54,55,51,6,7,17,1,22,23,22,23,53,52,38,35,34,6,3,154,97,186,192,93,
+180,90,10,105,14,99,92,145,27,10,51,184,111,202,196,48,46,8,103,15,190,253,
+24,93,179,198,96,119,127,150,155,1,152,8,41,41,12,254,2,2,4,16,99,112,120,
+20,1,189,150,81,89,196,207,166,6,58,53,216,38,254,100,2,145,9,38,43,12,147,
+134,131,147,0,2,255,182,254,20,4,123,4,94,0,44,0,57,0,0,1,34,39,21,35,53,
+38,35,34,6,7,35,54,54,51,50,23,17,51,23,51,54,54,51,50,18,17,16,2,35,34,39,
+35,23,22,21,21,22,51,50,54,55,51,6,6,19,34,6,7,21,20,22,51,50,54,53,52,38,
+1,147,14,35,180,26,19,43,43,12,105,11,101,85,32,19,148,24,8,64,168,110,214,
+237,238,215,221,119,12,4,8,22,23,42,43,14,102,10,102,176,163,145,2,148,166,
+138,155,155,254,162,8,150,248,11,59,60,122,140,8,4,172,150,90,80,254,215,
+254,242,254,243,254,210,159,41,78,61,154,12,59,60,122,140,5,37,184,197,35,
+223,199,224,200,201,213,0,1,255,184,0,0,3,47,4,94,0,41,0,0,1,34,39,17,35,
+17,38,35,34,6,7,35,54,54,51,50,23,17,51,23,51,54,54,51,50,23,7,38,35,34,6,
+6,21,21,22,51,50,54,55,51,6,6,1,150,27,25,180,23,20,43,43,12,105,11,101,85,
+13,36,148,20,8,63,172,101,73,56,22,61,58,87,149,84,25,22,42,43,14,102,10,
+102,1,106,9,254,141,1,213,10,59,60,122,141,9,1,228,201,109,112,12,166,14,
+96,169,103,68,12,59,60,121,142,0,1,255,184,0,0,2,160,4,94,0,38,0,0,51,17,
+38,35,34,6,7,35,54,54,51,50,23,53,52,54,51,50,23,7,38,38,35,34,6,21,21,22,
+51,50,54,55,51,6,6,35,34,39,17,168,24,13,43,43,12,105,11,101,85,23,20,154,
+174,82,94,23,26,78,56,72,71,33,22,42,43,14,102,10,102,84,29,31,1,215,8,59,
+60,122,141,7,160,175,167,33,153,8,23,90,99,254,14,59,60,121,142,13,254,137,
+0,1,255,244,255,236,3,221,4,94,0,50,0,0,1,20,6,35,34,39,53,22,51,50,54,53,
+52,38,39,39,38,35,34,6,7,35,54,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,
+22,23,22,23,22,51,50,54,55,51,6,7,22,3,121,230,208,217,128,181,168,136,124,
+119,152,6,143,76,55,58,14,104,19,140,43,220,192,187,163,61,167,134,112,116,
+100,183,89,44,38,38,48,54,17,102,19,116,35,1,47,154,169,69,164,88,88,74,65,
+90,58,2,39,49,70,216,38,63,88,135,156,74,143,70,71,62,60,79,70,34,24,4,49,
+70,198,50,56,0,1,255,213,255,236,2,182,5,70,0,44,0,0,1,34,39,21,20,22,51,
+50,54,55,21,6,6,35,32,17,53,39,34,6,7,35,54,54,51,23,17,35,53,55,55,51,21,
+33,21,33,17,22,51,50,54,55,51,6,6,1,178,30,35,91,81,35,94,24,25,105,54,254,
+190,28,44,42,13,104,11,101,85,34,155,157,72,107,1,61,254,195,36,25,42,42,
+14,103,11,100,1,168,14,114,95,102,14,9,138,11,21,1,83,218,4,59,60,122,140,
+4,1,22,86,72,234,252,140,254,140,19,59,60,120,142,0,1,0,70,0,0,3,115,4,74,
+0,33,0,0,1,34,39,3,33,21,33,53,1,38,35,34,6,7,35,54,54,51,50,23,19,33,53,
+33,21,1,22,51,50,54,55,51,6,6,2,170,65,101,229,2,84,252,221,1,29,48,45,43,
+43,12,104,11,100,85,67,111,226,253,213,2,241,254,242,42,38,42,42,14,103,11,
+100,1,168,41,254,186,139,119,1,149,17,59,60,122,140,47,1,65,140,135,254,127,
+11,59,60,120,142,0,2,0,176,254,20,4,125,4,94,0,12,0,40,0,0,1,34,6,21,21,20,
+22,51,50,54,53,52,38,37,7,51,54,51,50,18,17,16,2,35,34,39,35,7,35,17,52,54,
+51,50,23,21,38,35,34,6,21,2,158,165,153,154,168,140,149,148,254,51,6,8,111,
+229,211,242,240,211,223,121,10,25,143,240,252,239,156,162,244,141,162,1,244,
+177,200,43,221,199,223,199,204,214,116,135,166,254,217,254,240,254,246,254,
+206,166,145,4,92,235,238,69,166,86,166,144,0,1,0,164,2,180,3,129,5,182,0,
+11,0,0,1,35,17,33,17,35,17,51,17,33,17,51,3,129,168,254,115,168,168,1,141,
+168,2,180,1,82,254,174,3,2,254,215,1,41,0,2,0,86,254,20,4,78,4,74,0,19,0,
+30,0,0,55,52,54,55,39,53,1,33,53,33,21,1,5,22,17,20,0,35,34,0,55,20,22,51,
+50,54,53,52,38,35,32,86,237,218,201,1,147,253,179,3,110,254,33,1,86,207,254,
+241,241,229,254,237,186,164,158,157,164,165,158,254,192,10,206,248,23,138,
+63,1,2,152,131,254,198,225,136,254,230,233,254,243,1,18,228,173,179,179,173,
+172,174,0,1,0,33,255,102,7,47,6,20,0,53,0,0,33,17,52,38,35,34,6,21,17,35,
+17,1,22,51,50,54,55,21,6,6,35,34,39,7,35,55,38,53,17,35,53,55,55,51,21,33,
+21,33,17,20,23,1,17,51,17,1,51,1,54,51,50,22,21,17,6,125,119,127,168,153,
+181,254,64,31,45,35,94,24,25,105,54,89,65,125,157,182,68,155,157,72,107,1,
+61,254,195,12,2,20,181,1,77,158,254,90,112,163,199,202,2,190,134,131,186,
+214,253,201,2,195,253,202,14,14,9,138,11,21,26,160,232,81,160,2,127,86,72,
+234,252,140,253,134,52,36,2,159,2,137,254,91,1,165,253,236,92,191,210,253,
+53,0,1,0,20,0,0,1,252,4,74,0,11,0,0,1,51,21,35,17,35,17,35,53,51,17,51,1,
+98,154,154,180,154,154,180,2,141,145,254,4,1,252,145,1,189,0,1,0,10,255,236,
+2,160,4,74,0,23,0,0,1,17,51,21,35,21,20,22,51,50,54,55,21,6,6,35,34,38,53,
+53,35,53,51,17,1,90,205,205,74,84,44,98,26,27,112,54,164,147,158,158,4,74,
+254,67,145,184,99,98,15,8,138,12,20,170,172,186,145,1,189,0,3,0,20,254,20,
+4,215,4,94,0,27,0,34,0,41,0,0,19,51,17,51,23,51,54,54,51,50,22,23,51,21,35,
+6,2,35,34,39,35,23,22,21,17,35,17,35,1,50,54,55,33,22,22,19,34,6,7,33,38,
+38,20,154,148,24,8,64,168,110,191,231,23,98,92,10,239,204,221,119,12,4,8,
+180,154,2,136,131,151,8,253,164,7,149,154,146,147,15,2,86,17,150,2,141,1,
+189,150,90,80,239,226,143,253,254,235,159,41,78,61,254,61,3,234,254,131,200,
+181,201,180,3,70,151,163,153,161,0,2,0,20,255,242,4,176,4,74,0,20,0,29,0,
+0,1,17,51,21,35,21,20,6,35,34,38,53,53,35,53,51,17,51,17,33,17,1,50,54,53,
+53,33,21,20,22,4,31,145,145,237,212,209,231,146,146,182,2,14,254,250,127,
+135,253,242,130,4,74,254,67,143,119,187,218,215,194,115,143,1,189,254,67,
+1,189,252,57,134,126,119,119,125,135,0,2,0,20,255,236,4,195,4,74,0,33,0,42,
+0,0,1,22,23,51,21,35,21,20,0,35,34,38,38,53,53,35,53,51,54,55,33,53,33,21,
+6,6,7,33,38,38,39,53,33,21,1,50,54,53,53,33,21,20,22,3,143,150,47,111,91,
+254,238,238,146,230,127,93,111,41,156,254,245,1,228,76,124,28,2,91,30,122,
+74,1,228,253,211,154,167,253,125,165,3,180,122,173,143,12,241,254,235,127,
+235,154,14,143,174,121,150,142,34,154,115,108,164,31,142,150,252,205,191,
+178,12,14,176,191,0,2,0,174,254,106,4,123,6,20,0,32,0,45,0,0,1,34,39,53,22,
+51,50,53,53,6,35,34,38,39,35,6,7,35,17,51,17,20,7,51,54,51,50,18,17,16,7,
+21,16,1,34,6,21,21,20,22,51,50,54,53,52,38,2,250,60,63,46,56,99,76,70,111,
+174,55,14,31,6,129,180,10,10,111,229,217,236,146,254,175,166,144,147,167,
+148,145,146,254,106,25,150,19,107,143,20,80,79,120,19,6,20,254,134,113,113,
+164,254,213,254,244,254,211,150,231,254,239,5,93,188,224,8,225,193,217,205,
+208,208,0,2,0,113,254,106,4,152,6,20,0,31,0,44,0,0,1,34,39,53,22,51,50,53,
+53,35,39,35,6,35,34,2,17,16,18,51,50,23,51,38,38,53,17,51,17,51,17,16,1,50,
+54,53,53,52,38,35,34,6,21,20,22,3,168,60,63,46,56,99,74,27,8,115,227,214,
+236,237,215,221,119,13,3,10,180,91,253,184,164,151,153,164,139,152,151,254,
+106,25,150,19,107,143,147,167,1,40,1,15,1,13,1,46,162,20,121,21,1,182,250,
+130,254,229,254,239,2,23,179,204,33,229,195,221,205,204,210,0,1,0,31,254,
+106,3,25,6,31,0,33,0,0,19,34,39,53,22,51,50,53,53,35,17,35,53,55,53,52,54,
+51,50,23,7,38,35,34,6,21,21,33,21,33,17,51,17,16,254,61,62,46,56,99,109,192,
+192,175,182,105,108,48,93,70,91,88,1,21,254,235,91,254,106,25,150,19,107,
+143,3,190,84,62,63,200,200,37,141,30,120,130,71,140,252,216,254,229,254,239,
+0,2,0,111,254,20,6,12,4,94,0,41,0,54,0,0,37,55,35,6,35,34,2,17,16,18,51,50,
+23,51,55,51,17,33,17,16,35,34,39,53,22,51,50,53,53,33,21,20,6,35,34,39,53,
+22,51,50,54,53,37,50,54,53,53,52,38,35,34,6,21,20,22,3,137,6,8,111,229,213,
+239,241,209,223,121,10,25,143,1,209,239,60,63,46,56,98,254,209,239,252,240,
+155,160,245,140,163,254,197,166,151,152,169,138,151,147,10,135,165,1,41,1,
+14,1,9,1,50,166,146,252,178,254,127,254,239,25,150,19,107,252,127,236,238,
+70,166,86,164,145,160,179,198,43,220,200,219,203,204,214,0,1,0,174,254,106,
+4,29,6,20,0,27,0,0,1,55,55,1,51,1,1,51,17,16,35,34,39,53,22,51,50,53,53,35,
+1,7,17,35,17,51,17,7,1,96,61,70,1,95,210,254,68,1,107,90,240,60,63,46,57,
+98,33,254,131,125,178,178,8,2,53,78,84,1,115,254,43,254,30,254,232,254,239,
+25,150,19,107,143,2,0,109,254,109,6,20,252,211,178,0,1,0,82,254,106,1,188,
+6,20,0,15,0,0,37,51,17,16,35,34,39,53,22,51,50,53,53,35,17,51,1,98,90,239,
+60,63,46,56,99,109,180,147,254,232,254,239,25,150,19,107,143,6,20,0,1,0,174,
+254,106,7,47,4,94,0,46,0,0,1,34,39,53,22,51,50,53,53,35,17,16,35,34,6,21,
+17,35,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,51,32,23,51,54,54,51,50,
+22,21,17,51,17,16,6,63,59,63,46,56,98,106,223,153,144,179,109,116,152,141,
+180,145,27,10,47,171,106,1,2,78,10,53,183,116,186,185,90,254,106,25,150,19,
+107,143,2,195,1,4,178,183,253,162,2,195,130,130,186,212,253,199,4,74,150,
+80,90,184,88,96,192,211,253,200,254,232,254,239,0,1,0,174,254,106,4,166,4,
+94,0,32,0,0,1,34,39,53,22,51,50,53,53,35,17,52,38,35,34,6,21,17,35,17,51,
+23,51,54,54,51,50,22,21,17,51,17,16,3,182,60,63,46,57,98,106,119,127,169,
+153,180,145,27,10,51,184,111,202,196,90,254,106,25,150,19,107,143,2,190,134,
+131,187,211,253,199,4,74,150,81,89,196,207,253,200,254,232,254,239,0,2,0,
+174,254,20,4,123,4,94,0,32,0,45,0,0,5,34,39,35,23,22,21,17,35,17,51,23,51,
+54,54,51,50,18,17,16,7,21,16,35,34,39,53,22,51,50,53,53,6,3,34,6,7,21,20,
+22,51,50,54,53,52,38,2,182,221,119,12,4,8,180,148,24,8,64,168,110,214,237,
+146,239,60,63,46,56,99,76,100,163,145,2,148,166,138,155,155,20,159,41,78,
+61,254,61,6,54,150,90,80,254,215,254,242,254,211,150,233,254,239,25,150,19,
+107,143,20,3,219,184,197,35,223,199,224,200,201,213,0,1,0,82,254,106,3,47,
+4,94,0,29,0,0,1,50,23,7,38,35,34,6,6,21,17,51,17,16,35,34,39,53,22,51,50,
+53,53,35,17,51,23,51,54,54,2,174,73,56,22,61,58,87,149,84,90,239,60,63,46,
+56,99,109,148,20,8,63,172,4,94,12,166,14,96,169,103,254,73,254,232,254,239,
+25,150,19,107,143,4,74,201,109,112,0,1,0,104,254,106,3,121,4,94,0,47,0,0,
+1,20,7,21,16,35,34,39,53,22,51,50,53,53,6,35,34,39,53,22,51,50,54,53,52,38,
+39,46,2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,30,2,3,121,113,239,60,
+63,46,56,98,74,89,217,128,181,168,136,124,119,152,155,126,59,220,192,187,
+163,61,167,134,112,116,100,183,137,131,62,1,47,153,84,199,254,239,25,150,
+19,107,139,16,69,164,88,88,74,65,90,58,60,85,106,76,135,156,74,143,70,71,
+62,60,79,70,51,88,110,0,1,255,197,254,20,3,51,6,31,0,36,0,0,37,33,17,16,35,
+34,39,53,22,51,50,53,53,33,17,16,33,34,39,53,22,51,50,54,53,17,16,33,50,23,
+21,38,38,35,34,6,21,1,98,1,209,239,60,63,46,56,98,254,209,254,242,93,50,47,
+59,72,55,1,14,92,52,17,62,28,72,55,252,254,127,254,239,25,150,19,107,252,
+254,253,254,170,33,137,22,89,108,5,92,1,86,33,137,8,14,89,107,0,1,0,0,254,
+106,4,16,4,74,0,25,0,0,17,51,19,22,23,51,62,2,55,19,51,1,33,17,16,35,34,39,
+53,22,51,50,53,53,33,193,233,69,19,8,3,9,12,68,234,192,254,148,1,31,240,60,
+63,46,56,99,254,127,4,74,253,121,195,96,13,33,39,206,2,135,252,69,254,236,
+254,239,25,150,19,107,143,0,1,0,37,254,106,4,6,4,74,0,23,0,0,1,1,51,1,1,51,
+1,1,51,17,16,35,34,39,53,22,51,50,53,53,35,1,1,35,1,178,254,133,205,1,27,
+1,24,203,254,133,1,37,90,239,61,62,46,56,98,26,254,213,254,209,203,2,49,2,
+25,254,98,1,158,253,231,254,101,254,229,254,239,25,150,19,107,143,1,182,254,
+74,0,1,0,80,254,106,3,115,4,74,0,19,0,0,5,16,35,34,39,53,22,51,50,53,53,33,
+53,1,33,53,33,21,1,33,3,115,240,60,63,46,57,98,253,127,2,78,253,213,2,241,
+253,187,2,84,133,254,239,25,150,19,107,143,119,3,71,140,135,252,200,0,2,0,
+94,254,106,4,250,4,92,0,40,0,51,0,0,1,34,38,53,53,35,39,35,6,6,35,34,38,53,
+16,37,55,53,52,38,35,34,6,7,39,54,54,51,50,22,21,17,51,17,20,22,51,50,55,
+21,6,1,50,54,53,53,7,6,6,21,20,22,4,119,117,115,59,35,8,82,163,124,162,184,
+2,15,186,108,119,87,155,68,55,83,196,96,199,194,90,54,53,46,48,42,253,17,
+151,173,162,189,173,105,254,106,142,135,129,156,103,73,170,155,1,78,16,7,
+65,125,119,52,32,135,44,50,176,192,253,170,254,235,72,59,18,141,25,2,19,163,
+150,99,7,7,106,114,86,92,0,2,0,113,254,106,5,96,4,94,0,29,0,42,0,0,5,34,2,
+17,16,18,51,50,23,51,55,51,17,51,17,20,22,51,50,55,21,6,35,34,17,53,35,39,
+35,6,39,50,54,53,53,52,38,35,34,6,21,20,22,2,51,214,236,237,215,221,119,8,
+29,143,91,53,53,49,45,42,89,231,74,27,8,115,198,164,151,153,164,139,152,151,
+20,1,40,1,15,1,13,1,46,162,142,252,76,254,235,72,59,18,141,25,1,21,129,147,
+167,149,179,204,33,229,195,221,205,204,210,0,2,0,113,254,20,5,8,6,31,0,12,
+0,53,0,0,37,50,54,53,53,52,38,35,34,6,21,20,22,23,34,2,17,16,18,51,50,23,
+51,38,38,53,53,16,51,50,23,21,38,35,34,6,21,17,20,22,51,50,55,21,6,35,34,
+17,53,52,54,55,35,6,2,80,164,151,153,164,139,152,151,115,215,237,237,215,
+221,119,13,3,10,248,72,63,47,59,47,50,45,56,64,38,42,101,240,10,3,13,118,
+129,179,204,33,229,195,221,205,204,210,149,1,42,1,13,1,13,1,46,162,20,121,
+21,162,1,31,27,149,20,54,65,250,97,112,85,22,137,33,1,86,130,24,119,18,161,
+0,2,0,113,254,106,4,178,4,94,0,30,0,37,0,0,5,34,0,17,16,0,51,50,18,21,21,
+33,22,22,51,50,54,55,17,20,22,51,50,55,21,6,35,34,17,53,6,3,34,6,7,33,38,
+38,2,129,247,254,231,1,6,223,207,246,253,16,5,180,165,88,158,106,54,53,49,
+45,42,89,231,90,154,129,150,14,2,47,2,138,20,1,43,1,6,1,8,1,57,254,245,228,
+109,187,194,31,45,254,176,72,59,18,141,25,1,21,127,18,3,223,166,148,154,160,
+0,1,0,88,254,106,4,92,4,94,0,48,0,0,1,21,35,32,21,20,22,51,50,54,55,17,20,
+22,51,50,55,21,6,35,34,17,53,6,35,34,38,53,52,54,55,53,38,38,53,52,54,51,
+50,22,23,7,38,38,35,34,21,20,33,2,215,149,254,202,148,143,85,171,100,54,53,
+49,45,42,89,231,90,115,220,241,113,131,99,106,231,191,111,173,87,68,99,132,
+74,248,1,57,2,133,147,189,89,93,39,47,254,172,72,59,18,141,25,1,21,127,18,
+171,148,99,131,38,11,28,128,93,135,156,37,41,143,44,28,156,168,0,1,0,68,254,
+106,3,143,4,94,0,46,0,0,1,32,53,52,35,34,6,7,39,54,51,50,22,21,20,7,21,22,
+22,21,20,6,35,34,39,21,20,22,51,50,55,21,6,35,34,17,17,22,51,50,54,53,52,
+38,35,35,53,1,135,1,55,249,79,136,95,63,171,212,193,218,206,125,118,250,219,
+117,96,54,53,49,45,42,89,231,183,189,141,152,154,159,148,2,133,168,156,30,
+40,143,76,154,135,187,56,8,36,136,103,151,172,18,125,72,59,18,141,25,1,21,
+1,86,86,94,92,94,91,147,0,2,0,104,254,106,5,117,4,94,0,33,0,40,0,0,1,50,0,
+23,51,17,20,22,51,50,55,21,6,35,34,17,17,6,6,35,34,2,53,53,33,38,38,35,34,
+6,7,53,54,54,19,50,54,55,33,22,22,2,2,239,1,26,7,154,54,53,46,48,42,89,232,
+30,255,192,207,246,2,240,5,180,165,88,158,106,91,160,154,129,150,14,253,209,
+2,136,4,94,254,229,251,253,57,72,59,18,141,25,1,21,2,53,216,240,1,11,228,
+109,186,195,31,45,158,39,32,252,33,166,147,151,162,0,2,0,160,254,106,2,133,
+5,229,0,16,0,28,0,0,37,51,17,20,22,51,50,55,21,6,35,34,17,53,35,17,51,3,52,
+54,51,50,22,21,20,6,35,34,38,1,98,90,54,53,49,45,42,89,231,109,180,194,61,
+45,42,63,63,42,45,61,150,254,235,72,59,18,141,25,1,21,129,4,74,1,41,60,54,
+54,60,59,56,56,0,1,0,68,254,106,3,102,4,94,0,34,0,0,55,22,51,50,54,53,52,
+38,35,34,6,7,39,54,54,51,50,0,17,16,0,35,34,39,21,20,22,51,50,55,21,6,35,
+34,17,86,140,139,165,154,160,162,55,134,50,55,49,160,94,237,1,6,254,245,241,
+72,42,54,52,47,48,42,90,231,199,64,211,207,198,212,29,25,150,25,34,254,219,
+254,242,254,233,254,216,8,115,72,59,18,141,25,1,21,0,1,255,197,254,106,2,
+76,6,31,0,32,0,0,1,20,6,7,21,20,22,51,50,55,21,6,35,34,17,17,22,51,50,54,
+53,17,16,33,50,23,21,38,38,35,34,6,21,1,98,126,126,54,53,49,45,42,89,231,
+49,57,72,55,1,14,92,52,17,62,28,72,55,1,66,159,174,7,109,72,59,18,141,25,
+1,21,1,23,23,89,108,3,133,1,86,33,137,8,14,89,107,0,1,0,162,254,106,5,102,
+4,74,0,33,0,0,1,17,20,22,51,50,54,53,17,51,17,51,17,20,22,51,50,55,21,6,35,
+34,17,53,35,39,35,6,6,35,34,38,53,17,1,88,119,125,169,154,181,90,54,52,49,
+45,42,89,231,76,26,9,49,180,119,198,201,4,74,253,61,133,129,188,209,2,60,
+252,76,254,235,72,59,18,141,25,1,21,129,145,79,86,190,209,2,207,0,1,0,68,
+254,106,3,143,4,74,0,34,0,0,1,33,53,33,21,1,4,17,20,6,35,34,39,21,20,22,51,
+50,55,21,6,35,34,17,17,22,51,50,54,53,52,38,35,35,53,2,106,253,238,3,12,254,
+168,1,131,247,222,117,96,54,53,49,45,42,89,231,183,189,143,150,154,159,148,
+3,190,140,135,254,215,33,254,198,159,180,18,125,72,59,18,141,25,1,21,1,86,
+86,103,100,102,90,133,0,2,0,145,2,168,3,92,5,195,0,15,0,28,0,0,1,50,22,21,
+20,6,35,34,39,7,35,17,51,23,54,54,23,34,6,21,21,20,22,51,50,54,53,52,38,2,
+16,157,175,174,160,135,92,14,140,140,14,40,108,61,104,95,96,105,91,91,91,
+5,195,208,188,189,210,117,105,3,2,104,56,61,129,116,128,21,148,126,148,126,
+127,138,0,1,0,104,2,168,2,190,5,195,0,21,0,0,1,34,38,53,52,54,51,50,22,23,
+7,38,35,34,17,20,22,51,50,55,21,6,1,215,177,190,194,183,60,119,42,47,111,
+67,205,100,97,101,118,85,2,168,207,186,192,210,28,20,127,39,254,246,127,135,
+53,137,47,0,2,0,90,2,104,2,248,5,195,0,29,0,39,0,0,1,34,39,6,7,39,54,55,38,
+53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,3,34,7,22,51,
+50,54,53,52,38,1,236,139,85,16,31,131,42,34,53,197,182,117,106,49,111,68,
+105,99,8,104,127,109,129,150,94,91,75,55,84,50,63,38,2,168,53,30,87,60,106,
+58,98,135,193,209,48,127,39,133,133,37,53,88,99,83,96,113,1,6,84,51,43,35,
+21,36,0,2,0,104,2,168,3,80,6,250,0,27,0,38,0,0,1,20,6,35,34,38,53,52,54,51,
+50,22,23,38,39,7,39,55,38,39,55,22,23,55,23,7,22,18,7,52,38,35,34,6,21,20,
+22,51,50,3,80,193,182,166,203,191,164,57,95,46,51,98,193,71,155,112,11,68,
+106,82,170,72,139,103,110,166,112,95,108,97,110,95,207,4,61,198,207,190,158,
+162,184,26,37,125,94,109,103,88,60,5,109,48,55,99,103,77,99,254,247,183,89,
+103,114,109,106,113,255,255,0,72,2,168,2,184,5,195,18,6,5,212,0,0,0,1,0,47,
+2,180,2,106,6,242,0,20,0,0,1,35,17,35,17,35,53,55,53,16,33,50,23,7,38,35,
+34,6,21,21,51,2,27,195,164,133,133,1,10,76,96,40,71,58,53,52,195,5,59,253,
+121,2,135,80,41,33,1,29,33,121,27,75,81,33,0,1,255,203,1,104,1,162,5,182,
+0,21,0,0,19,51,17,51,17,51,21,35,17,20,6,35,34,39,53,22,51,50,54,53,17,35,
+39,106,166,107,107,112,121,63,68,75,39,39,45,106,4,135,1,47,254,209,125,254,
+74,109,127,21,129,21,43,60,1,186,255,255,0,102,1,104,3,49,5,195,18,6,5,213,
+0,0,0,1,0,141,1,104,3,55,5,182,0,20,0,0,1,17,20,51,50,54,53,17,51,17,35,17,
+52,55,6,6,35,34,38,53,17,1,49,150,105,99,164,164,9,40,125,63,149,150,5,182,
+254,23,166,120,136,1,143,251,178,1,89,51,49,60,65,136,149,1,241,0,2,0,39,
+2,180,1,162,6,205,0,11,0,23,0,0,1,51,21,35,17,35,17,35,53,51,17,51,39,52,
+54,51,50,22,21,20,6,35,34,38,1,55,107,107,166,106,106,166,174,54,40,36,55,
+55,36,40,54,4,135,125,254,170,1,86,125,1,47,185,49,45,45,49,45,46,46,0,1,
+0,141,2,168,2,20,5,182,0,13,0,0,1,17,20,51,50,54,55,21,6,35,34,38,53,17,1,
+49,90,31,84,22,63,90,128,110,5,182,253,232,121,16,8,122,27,122,122,2,26,0,
+1,0,78,2,180,1,213,5,182,0,11,0,0,1,33,53,55,17,39,53,33,21,7,17,23,1,213,
+254,121,112,112,1,135,113,113,2,180,96,25,2,14,27,96,98,25,253,242,25,0,1,
+0,78,2,180,1,213,5,182,0,19,0,0,1,35,21,23,21,33,53,55,53,35,53,51,53,39,
+53,33,21,7,21,51,1,209,109,113,254,121,112,104,104,112,1,135,113,109,4,10,
+221,25,96,96,25,221,125,180,27,96,98,25,180,0,3,255,145,1,104,1,162,6,205,
+0,15,0,24,0,36,0,0,19,51,17,51,21,35,6,6,35,34,38,53,52,54,51,51,7,50,54,
+53,35,34,21,20,22,19,52,54,51,50,22,21,20,6,35,34,38,145,166,107,107,3,106,
+100,102,111,106,111,39,51,25,26,32,64,26,62,54,40,36,55,55,36,40,54,5,182,
+252,254,110,108,114,84,76,89,83,223,50,63,58,26,29,4,154,49,45,45,49,45,46,
+46,0,1,0,145,1,104,2,4,6,233,0,12,0,0,1,17,20,51,50,55,21,6,35,34,38,53,17,
+1,55,88,37,80,63,70,124,114,6,233,251,117,119,23,121,29,122,122,4,141,0,1,
+255,193,1,104,1,51,6,233,0,13,0,0,1,17,20,6,35,34,39,53,22,51,50,54,53,17,
+1,51,115,122,70,63,78,38,47,41,6,233,251,115,122,122,29,121,23,60,59,4,139,
+0,1,0,145,2,180,2,145,5,182,0,5,0,0,19,51,17,33,21,33,145,166,1,90,254,0,
+5,182,253,127,129,0,1,0,145,1,104,4,254,5,195,0,39,0,0,1,20,35,34,39,53,22,
+22,51,50,53,17,52,35,34,6,21,17,35,17,52,35,34,6,21,17,35,17,51,23,54,54,
+51,50,23,54,51,50,22,21,4,254,191,54,58,15,62,17,47,135,101,85,164,137,94,
+89,166,142,12,46,108,65,173,65,86,159,139,138,2,55,207,23,135,7,17,65,2,113,
+162,120,112,254,90,1,236,162,120,136,254,114,3,2,114,71,56,138,138,136,151,
+0,1,0,139,1,104,4,250,5,182,0,32,0,0,1,17,20,51,50,54,53,17,51,17,20,51,50,
+54,53,17,51,17,35,17,52,55,6,6,35,34,39,6,35,34,38,53,17,1,47,135,100,87,
+163,136,95,89,166,166,12,46,108,65,170,67,88,160,137,140,5,182,254,21,164,
+119,112,1,168,254,21,164,119,137,1,143,251,178,1,58,69,62,71,54,135,135,134,
+151,1,241,0,1,255,242,1,104,3,59,5,195,0,26,0,0,1,20,35,34,39,53,22,51,50,
+54,53,17,51,23,54,54,51,32,17,17,35,17,52,35,34,6,21,1,55,207,66,52,60,32,
+38,29,142,12,38,132,82,1,20,161,150,106,99,2,92,244,31,123,27,52,67,3,88,
+116,61,68,254,225,254,16,1,234,164,121,135,0,1,0,145,1,104,3,223,5,195,0,
+28,0,0,1,20,22,51,50,54,55,21,6,6,35,34,53,17,52,35,34,6,21,17,35,17,51,23,
+54,51,50,22,21,3,59,29,41,17,59,18,20,67,34,204,150,106,99,166,142,12,101,
+143,138,146,2,94,63,56,18,9,123,12,19,244,2,66,164,121,135,254,114,3,2,112,
+125,136,151,0,1,0,145,2,180,3,76,5,182,0,13,0,0,1,17,35,1,22,21,17,35,17,
+51,1,38,53,17,3,76,189,254,154,8,160,189,1,104,8,5,182,252,254,2,41,60,85,
+254,104,3,2,253,215,50,85,1,162,0,3,0,104,2,168,3,80,5,195,0,11,0,17,0,23,
+0,0,1,20,6,35,34,38,53,52,54,51,50,22,1,50,54,55,33,22,19,34,6,7,33,38,3,
+80,199,176,166,203,197,176,170,201,254,139,97,95,9,254,110,20,181,94,92,13,
+1,142,23,4,55,188,211,213,186,186,210,214,254,58,109,106,215,2,27,98,97,195,
+0,3,0,102,1,104,3,250,6,233,0,17,0,22,0,29,0,0,1,20,6,7,17,35,17,38,38,53,
+52,54,55,17,51,17,22,22,5,20,23,17,6,5,52,38,39,17,54,54,3,250,195,182,162,
+174,203,196,185,158,177,200,253,22,211,211,2,64,96,111,102,105,4,51,171,205,
+18,254,191,1,65,21,210,163,174,204,17,1,43,254,213,25,211,159,234,31,2,17,
+31,233,115,133,16,253,239,20,135,0,1,0,98,1,104,2,170,5,195,0,44,0,0,1,20,
+6,35,35,39,21,20,51,50,55,21,6,35,34,38,53,17,22,51,50,53,52,38,39,46,2,53,
+52,54,51,50,23,7,38,35,34,6,21,20,22,23,22,22,2,170,170,154,49,45,88,26,81,
+63,60,122,114,150,112,158,80,94,118,87,43,164,141,143,124,54,129,92,68,69,
+73,111,141,99,3,141,111,118,2,76,119,23,121,29,120,124,1,17,72,96,41,56,34,
+44,59,77,52,98,113,58,123,54,41,35,36,52,41,53,108,0,1,255,242,1,104,1,217,
+6,242,0,22,0,0,1,20,35,34,39,53,22,51,50,54,53,17,52,51,50,23,21,38,38,35,
+34,6,21,1,55,207,66,52,60,32,38,29,209,75,44,24,55,15,38,30,2,92,244,31,123,
+27,52,67,3,160,244,31,123,12,15,54,65,0,1,0,49,1,119,2,35,6,109,0,29,0,0,
+1,34,39,53,22,51,50,53,53,34,53,17,35,53,55,55,51,21,51,21,35,17,20,22,51,
+50,55,17,20,6,1,106,51,55,50,42,47,237,109,113,51,109,221,221,54,44,46,81,
+87,1,119,22,131,20,57,127,242,1,164,78,51,162,170,121,254,96,62,57,23,254,
+243,96,102,0,2,0,39,2,168,3,162,5,182,0,22,0,30,0,0,1,17,33,17,51,17,51,21,
+35,17,35,39,6,6,35,34,38,53,53,35,53,51,17,1,50,54,55,33,21,20,22,1,49,1,
+96,164,109,109,139,12,45,121,68,147,150,100,100,1,58,102,97,5,254,160,72,
+5,182,254,217,1,39,254,217,125,254,162,113,57,68,133,148,81,125,1,39,253,
+113,108,127,71,84,80,0,1,0,68,2,168,3,115,5,182,0,31,0,0,1,22,22,21,20,6,
+35,34,38,53,52,54,55,35,53,33,21,6,6,21,20,22,51,50,54,53,52,38,39,53,33,
+21,2,180,75,81,199,176,171,198,82,74,192,1,106,73,85,104,99,98,107,93,69,
+1,109,5,53,45,157,89,168,194,179,155,113,151,55,129,116,32,165,109,111,122,
+122,113,101,175,28,116,129,0,1,0,139,2,168,3,57,5,182,0,17,0,0,1,50,54,53,
+17,51,17,20,6,35,34,38,53,17,51,17,20,22,1,227,92,87,163,161,181,181,163,
+166,87,3,39,105,120,1,174,254,78,182,166,168,180,1,178,254,82,120,105,0,1,
+0,139,2,168,3,57,5,195,0,27,0,0,1,52,38,35,34,7,53,54,51,50,22,21,21,20,6,
+35,34,38,53,17,51,17,20,22,51,50,54,53,2,150,34,44,52,51,66,59,117,102,167,
+175,179,165,166,80,98,97,82,4,205,66,46,14,129,19,118,124,205,176,172,167,
+181,1,178,254,82,118,107,104,121,0,1,0,18,2,180,3,27,5,182,0,10,0,0,1,1,35,
+3,38,39,6,7,3,35,1,1,238,1,45,177,165,31,14,20,28,167,175,1,45,5,182,252,
+254,1,191,87,85,92,80,254,65,3,2,0,1,0,82,2,180,2,166,5,182,0,9,0,0,1,33,
+53,1,33,53,33,21,1,33,2,166,253,172,1,141,254,139,2,52,254,118,1,146,2,180,
+96,2,39,123,108,253,227,0,1,0,82,1,104,3,72,5,182,0,22,0,0,1,33,53,1,33,53,
+33,21,1,33,21,20,22,51,50,54,55,21,6,35,34,38,53,2,14,254,68,1,141,254,139,
+2,52,254,118,1,146,29,38,17,65,13,52,69,99,94,2,180,96,2,39,123,108,253,227,
+207,67,52,20,7,123,31,120,124,0,2,0,82,2,53,3,53,5,182,0,21,0,30,0,0,1,7,
+39,55,55,35,53,1,33,53,33,21,1,51,54,54,51,50,22,21,20,35,55,34,7,51,50,54,
+53,52,38,1,197,54,120,15,15,227,1,141,254,139,2,52,254,118,82,69,128,90,77,
+99,254,56,63,56,69,53,44,26,2,180,127,49,42,36,96,2,39,123,108,253,227,127,
+92,88,67,185,219,98,33,20,20,25,0,1,0,45,1,104,2,213,5,182,0,25,0,0,1,22,
+22,21,20,6,35,34,39,53,22,22,51,50,54,53,52,38,35,35,53,1,33,53,33,21,1,135,
+157,177,217,180,171,112,60,157,72,103,124,138,130,105,1,41,254,93,2,108,4,
+10,18,174,134,155,193,53,145,30,41,120,99,99,106,102,1,61,132,107,0,4,0,104,
+2,168,3,66,6,250,0,11,0,18,0,25,0,26,0,0,1,16,2,35,34,2,17,16,18,51,50,18,
+1,50,54,55,33,22,22,19,34,6,7,33,38,38,55,3,66,183,184,180,183,181,182,181,
+186,254,145,99,95,7,254,114,4,92,101,97,90,10,1,140,10,93,191,4,209,254,229,
+254,242,1,24,1,17,1,26,1,15,254,234,253,65,188,189,188,189,3,86,177,171,171,
+177,119,0,3,254,162,5,12,1,94,6,109,0,9,0,21,0,32,0,0,19,35,38,38,39,53,51,
+22,22,23,37,52,54,51,50,22,21,20,6,35,34,38,37,52,51,50,22,21,20,6,35,34,
+38,123,86,63,113,27,197,13,56,23,254,39,54,40,38,56,56,38,40,54,2,0,94,37,
+57,57,37,42,52,5,25,78,174,55,20,63,180,60,66,54,46,47,53,53,50,50,202,101,
+47,54,52,50,50,0,3,254,125,5,12,1,131,6,109,0,7,0,19,0,30,0,0,3,54,55,51,
+21,6,7,35,39,52,54,51,50,22,21,20,6,35,34,38,37,52,51,50,22,21,20,6,35,34,
+38,139,64,28,197,86,117,86,248,54,40,38,56,56,38,40,54,2,74,94,37,57,57,37,
+42,52,5,49,180,123,20,162,145,90,54,46,47,53,53,50,50,202,101,47,54,52,50,
+50,0,1,255,133,254,78,0,102,255,170,0,43,0,0,19,34,53,52,62,2,53,52,46,2,
+53,52,62,2,53,52,35,34,7,39,54,51,50,21,20,14,2,21,20,30,2,21,20,14,2,21,
+20,23,90,178,33,40,33,33,40,33,35,43,35,50,44,46,8,67,54,104,32,38,32,29,
+36,29,29,36,29,90,254,78,63,16,21,14,11,6,8,9,10,16,16,15,23,18,16,8,17,21,
+55,27,61,25,29,19,13,9,6,7,11,19,18,17,19,12,9,7,14,4,0,1,254,135,4,221,1,
+113,5,215,0,19,0,0,1,34,14,2,35,34,38,53,53,51,20,51,50,62,2,51,51,21,1,100,
+78,132,119,112,58,110,124,131,107,42,99,120,143,87,17,5,84,37,45,37,110,109,
+31,117,35,43,35,127,0,1,254,209,4,217,1,55,5,244,0,5,0,0,1,33,55,23,5,33,
+254,209,1,37,252,69,254,228,254,182,5,106,138,129,154,0,1,254,201,4,217,1,
+47,5,244,0,5,0,0,1,33,37,55,23,33,1,47,254,182,254,228,69,252,1,37,4,217,
+154,129,138,0,1,254,209,4,197,1,55,5,223,0,5,0,0,1,33,5,7,39,33,254,209,1,
+74,1,28,69,252,254,219,5,223,153,129,137,0,1,254,201,4,197,1,47,5,223,0,5,
+0,0,1,33,7,39,37,33,1,47,254,219,252,69,1,28,1,74,5,78,137,129,153,0,1,254,
+66,4,195,1,190,5,225,0,7,0,0,3,37,55,23,37,5,7,39,150,254,216,69,242,1,29,
+1,40,69,242,4,195,155,129,131,133,155,129,131,0,1,254,66,4,195,1,190,5,225,
+0,7,0,0,3,7,39,37,5,55,23,5,135,242,69,1,40,1,29,242,69,254,216,5,72,131,
+129,155,133,131,129,155,0,1,255,90,254,20,0,176,255,190,0,14,0,0,23,50,23,
+7,38,35,34,6,21,21,35,17,51,23,54,100,39,37,14,28,38,74,67,121,105,8,65,66,
+8,110,12,89,91,140,1,160,80,90,0,1,255,84,4,184,0,164,6,82,0,12,0,0,19,38,
+39,53,54,55,51,21,6,7,22,23,21,141,218,95,120,193,23,45,144,117,72,4,184,
+109,29,139,30,103,105,29,71,58,44,103,0,2,254,135,254,20,1,143,255,174,0,
+15,0,29,0,0,5,6,6,7,35,38,38,39,53,51,22,23,55,54,55,51,37,22,23,21,6,6,7,
+35,53,54,55,38,39,53,1,143,32,78,29,139,21,82,30,104,42,61,23,42,35,104,253,
+15,213,100,47,171,95,23,39,150,110,79,133,61,200,91,84,218,50,24,58,171,60,
+113,56,27,106,31,139,12,72,50,105,26,74,54,49,102,255,255,0,199,0,0,4,197,
+7,55,18,38,0,37,0,0,16,7,1,79,1,123,1,82,255,255,0,174,255,236,4,123,6,20,
+18,38,0,69,0,0,16,7,1,79,1,150,0,0,255,255,0,199,254,152,4,197,5,182,18,38,
+0,37,0,0,16,7,2,100,4,211,0,0,255,255,0,174,254,152,4,123,6,20,18,38,0,69,
+0,0,16,7,2,100,5,8,0,0,255,255,0,199,254,212,4,197,5,182,18,38,0,37,0,0,16,
+7,1,77,0,20,249,251,255,255,0,174,254,212,4,123,6,20,18,38,0,69,0,0,16,7,
+1,77,0,47,249,251,255,255,0,125,254,20,4,207,7,115,18,38,0,38,0,0,16,39,0,
+122,2,4,0,0,16,7,0,118,1,23,1,82,255,255,0,113,254,20,3,147,6,33,18,38,0,
+70,0,0,16,39,0,122,1,76,0,0,16,6,0,118,63,0,255,255,0,199,0,0,5,90,7,55,18,
+38,0,39,0,0,16,7,1,79,1,164,1,82,255,255,0,113,255,236,4,61,6,20,18,38,0,
+71,0,0,16,7,1,79,1,27,0,0,255,255,0,199,254,152,5,90,5,182,18,38,0,39,0,0,
+16,7,2,100,5,20,0,0,255,255,0,113,254,152,4,61,6,20,18,38,0,71,0,0,16,7,2,
+100,4,168,0,0,255,255,0,199,254,212,5,90,5,182,18,38,0,39,0,0,16,7,1,77,0,
+61,249,251,255,255,0,113,254,212,4,61,6,20,18,38,0,71,0,0,16,7,1,77,255,243,
+249,251,255,255,0,199,254,59,5,90,5,182,18,38,0,39,0,0,16,7,2,57,0,168,0,
+0,255,255,0,113,254,59,4,61,6,20,18,38,0,71,0,0,16,6,2,57,78,0,255,255,0,
+199,254,103,5,90,5,182,18,38,0,39,0,0,16,7,1,75,0,90,249,142,255,255,0,113,
+254,103,4,61,6,20,18,38,0,71,0,0,16,7,1,75,255,239,249,142,255,255,0,199,
+0,0,3,248,8,94,18,38,0,40,0,0,16,7,9,73,2,96,1,82,255,255,0,113,255,236,4,
+27,7,12,18,38,0,72,0,0,16,7,9,73,2,84,0,0,255,255,0,199,0,0,3,248,8,94,18,
+38,0,40,0,0,16,7,9,74,2,96,1,82,255,255,0,113,255,236,4,27,7,12,18,38,0,72,
+0,0,16,7,9,74,2,84,0,0,255,255,0,199,254,103,3,248,5,182,18,38,0,40,0,0,16,
+7,1,75,0,4,249,142,255,255,0,113,254,103,4,27,4,94,18,38,0,72,0,0,16,7,1,
+75,0,12,249,142,255,255,0,199,254,136,3,248,5,182,18,38,0,40,0,0,16,7,1,82,
+255,226,249,175,255,255,0,113,254,136,4,27,4,94,18,38,0,72,0,0,16,7,1,82,
+255,200,249,175,255,255,0,199,254,20,3,248,7,62,18,38,0,40,0,0,16,39,1,78,
+0,12,1,82,16,7,0,122,1,123,0,0,255,255,0,113,254,20,4,27,5,236,18,38,0,72,
+0,0,16,38,1,78,253,0,16,7,0,122,1,111,0,0,255,255,0,199,0,0,3,248,7,55,18,
+38,0,41,0,0,16,7,1,79,1,92,1,82,255,255,0,31,0,0,3,25,7,96,18,38,0,73,0,0,
+16,7,1,79,1,14,1,123,255,255,0,125,255,236,5,59,6,188,18,38,0,42,0,0,16,7,
+1,77,0,248,1,82,255,255,0,113,254,20,4,61,5,106,18,38,0,74,0,0,16,6,1,77,
+4,0,255,255,0,199,0,0,5,37,7,55,18,38,0,43,0,0,16,7,1,79,1,238,1,82,255,255,
+0,174,0,0,4,76,7,55,18,38,0,75,0,0,16,7,1,79,1,172,1,82,255,255,0,199,254,
+152,5,37,5,182,18,38,0,43,0,0,16,7,2,100,5,90,0,0,255,255,0,174,254,152,4,
+76,6,20,18,38,0,75,0,0,16,7,2,100,4,221,0,0,255,255,0,199,0,0,5,37,7,41,18,
+38,0,43,0,0,16,7,0,106,0,166,1,82,255,255,0,174,0,0,4,76,7,43,18,38,0,75,
+0,0,16,7,0,106,0,100,1,84,255,255,0,90,254,20,5,37,5,182,18,38,0,43,0,0,16,
+6,0,122,61,0,255,255,0,62,254,20,4,76,6,20,18,38,0,75,0,0,16,6,0,122,33,0,
+255,255,0,199,254,134,5,37,5,182,18,38,0,43,0,0,16,7,1,78,0,154,249,173,255,
+255,0,174,254,134,4,76,6,20,18,38,0,75,0,0,16,7,1,78,0,27,249,173,255,255,
+255,228,254,136,2,212,5,182,18,38,0,44,0,0,16,7,1,82,254,226,249,175,255,
+255,255,144,254,136,2,128,5,229,18,38,0,76,0,0,16,7,1,82,254,142,249,175,
+255,255,0,41,0,0,2,119,8,74,18,38,0,44,0,0,16,7,8,136,1,74,1,82,255,255,255,
+246,0,0,2,68,6,248,18,38,0,243,0,0,16,7,8,136,1,23,0,0,255,255,0,199,0,0,
+4,244,7,115,18,38,0,46,0,0,16,7,0,118,0,164,1,82,255,255,0,174,0,0,4,51,7,
+156,18,38,0,78,0,0,16,7,0,118,0,123,1,123,255,255,0,199,254,152,4,244,5,182,
+18,38,0,46,0,0,16,7,2,100,5,16,0,0,255,255,0,174,254,152,4,51,6,20,18,38,
+0,78,0,0,16,7,2,100,4,166,0,0,255,255,0,199,254,212,4,244,5,182,18,38,0,46,
+0,0,16,7,1,77,0,113,249,251,255,255,0,174,254,212,4,51,6,20,18,38,0,78,0,
+0,16,7,1,77,0,4,249,251,255,255,0,199,254,152,3,254,5,182,18,38,0,47,0,0,
+16,7,2,100,4,186,0,0,255,255,0,158,254,152,1,115,6,20,18,38,0,79,0,0,16,7,
+2,100,3,109,0,0,255,255,255,245,254,152,3,254,6,188,18,38,0,47,0,0,16,39,
+1,77,254,202,1,82,16,7,2,100,4,186,0,0,255,255,255,218,254,152,2,58,7,14,
+18,38,0,79,0,0,16,39,1,77,254,175,1,164,16,7,2,100,3,109,0,0,255,255,0,199,
+254,212,3,254,5,182,18,38,0,47,0,0,16,7,1,77,0,4,249,251,255,255,255,216,
+254,212,2,56,6,20,18,38,0,79,0,0,16,7,1,77,254,173,249,251,255,255,0,199,
+254,103,3,254,5,182,18,38,0,47,0,0,16,7,1,75,255,255,249,142,255,255,255,
+175,254,103,2,99,6,20,18,38,0,79,0,0,16,7,1,75,254,171,249,142,255,255,0,
+199,0,0,6,123,7,55,18,38,0,48,0,0,16,7,1,79,2,152,1,82,255,255,0,174,0,0,
+6,213,5,229,18,38,0,80,0,0,16,7,1,79,2,180,0,0,255,255,0,199,254,152,6,123,
+5,182,18,38,0,48,0,0,16,7,2,100,6,4,0,0,255,255,0,174,254,152,6,213,4,94,
+18,38,0,80,0,0,16,7,2,100,6,33,0,0,255,255,0,199,0,0,5,78,7,55,18,38,0,49,
+0,0,16,7,1,79,2,0,1,82,255,255,0,174,0,0,4,76,5,229,18,38,0,81,0,0,16,7,1,
+79,1,141,0,0,255,255,0,199,254,152,5,78,5,182,18,38,0,49,0,0,16,7,2,100,5,
+111,0,0,255,255,0,174,254,152,4,76,4,94,18,38,0,81,0,0,16,7,2,100,4,221,0,
+0,255,255,0,199,254,212,5,78,5,182,18,38,0,49,0,0,16,7,1,77,0,174,249,251,
+255,255,0,174,254,212,4,76,4,94,18,38,0,81,0,0,16,7,1,77,0,29,249,251,255,
+255,0,199,254,103,5,78,5,182,18,38,0,49,0,0,16,7,1,75,0,172,249,142,255,255,
+0,174,254,103,4,76,4,94,18,38,0,81,0,0,16,7,1,75,0,27,249,142,255,255,0,125,
+255,236,5,195,8,94,18,38,0,50,0,0,16,7,9,72,3,31,1,82,255,255,0,113,255,236,
+4,104,7,12,18,38,0,82,0,0,16,7,9,72,2,106,0,0,255,255,0,125,255,236,5,195,
+8,31,18,38,0,50,0,0,16,7,9,70,3,31,1,82,255,255,0,113,255,236,4,104,6,205,
+18,38,0,82,0,0,16,7,9,70,2,106,0,0,255,255,0,125,255,236,5,195,8,94,18,38,
+0,50,0,0,16,7,9,73,3,31,1,82,255,255,0,113,255,236,4,104,7,12,18,38,0,82,
+0,0,16,7,9,73,2,106,0,0,255,255,0,125,255,236,5,195,8,94,18,38,0,50,0,0,16,
+7,9,74,3,31,1,82,255,255,0,113,255,236,4,104,7,12,18,38,0,82,0,0,16,7,9,74,
+2,106,0,0,255,255,0,199,0,0,4,111,7,115,18,38,0,51,0,0,16,7,0,118,0,88,1,
+82,255,255,0,174,254,20,4,123,6,33,18,38,0,83,0,0,16,7,0,118,0,129,0,0,255,
+255,0,199,0,0,4,111,7,55,18,38,0,51,0,0,16,7,1,79,1,98,1,82,255,255,0,174,
+254,20,4,123,5,229,18,38,0,83,0,0,16,7,1,79,1,129,0,0,255,255,0,199,0,0,4,
+219,7,55,18,38,0,53,0,0,16,7,1,79,1,115,1,82,255,255,0,174,0,0,3,47,5,229,
+18,38,0,85,0,0,16,7,1,79,0,219,0,0,255,255,0,199,254,152,4,219,5,182,18,38,
+0,53,0,0,16,7,2,100,4,246,0,0,255,255,0,158,254,152,3,47,4,94,18,38,0,85,
+0,0,16,7,2,100,3,109,0,0,255,255,0,199,254,152,4,219,6,188,18,38,0,53,0,0,
+16,39,1,77,0,33,1,82,16,7,2,100,4,246,0,0,255,255,0,158,254,152,3,47,5,106,
+18,38,0,85,0,0,16,38,1,77,138,0,16,7,2,100,3,109,0,0,255,255,0,199,254,212,
+4,219,5,182,18,38,0,53,0,0,16,7,1,77,0,74,249,251,255,255,255,220,254,212,
+3,47,4,94,18,38,0,85,0,0,16,7,1,77,254,177,249,251,255,255,0,104,255,236,
+4,4,7,55,18,38,0,54,0,0,16,7,1,79,1,61,1,82,255,255,0,104,255,236,3,121,5,
+229,18,38,0,86,0,0,16,7,1,79,0,225,0,0,255,255,0,104,254,152,4,4,5,203,18,
+38,0,54,0,0,16,7,2,100,4,129,0,0,255,255,0,104,254,152,3,121,4,94,18,38,0,
+86,0,0,16,7,2,100,4,57,0,0,255,255,0,104,255,236,4,4,7,115,18,38,0,54,0,0,
+16,7,9,67,2,86,1,82,255,255,0,104,255,236,3,121,6,33,18,38,0,86,0,0,16,7,
+9,67,1,229,0,0,255,255,0,104,255,236,4,4,8,31,18,38,0,54,0,0,16,7,9,68,2,
+70,1,82,255,255,0,104,255,236,3,121,6,205,18,38,0,86,0,0,16,7,9,68,1,250,
+0,0,255,255,0,104,254,152,4,4,7,55,18,38,0,54,0,0,16,39,1,79,1,61,1,82,16,
+7,2,100,4,129,0,0,255,255,0,104,254,152,3,121,5,229,18,38,0,86,0,0,16,39,
+1,79,0,225,0,0,16,7,2,100,4,57,0,0,255,255,0,20,0,0,4,92,7,55,18,38,0,55,
+0,0,16,7,1,79,1,47,1,82,255,255,0,33,255,236,2,182,6,219,18,38,0,87,0,0,16,
+7,1,79,0,43,0,246,255,255,0,20,254,152,4,92,5,182,18,38,0,55,0,0,16,7,2,100,
+4,158,0,0,255,255,0,33,254,152,2,182,5,70,18,38,0,87,0,0,16,7,2,100,4,47,
+0,0,255,255,0,20,254,212,4,92,5,182,18,38,0,55,0,0,16,7,1,77,255,222,249,
+251,255,255,0,33,254,212,2,232,5,70,18,38,0,87,0,0,16,7,1,77,255,93,249,251,
+255,255,0,20,254,103,4,92,5,182,18,38,0,55,0,0,16,7,1,75,255,220,249,142,
+255,255,0,33,254,103,3,9,5,70,18,38,0,87,0,0,16,7,1,75,255,81,249,142,255,
+255,0,184,254,154,5,31,5,182,18,38,0,56,0,0,16,7,0,106,0,156,249,142,255,
+255,0,162,254,154,4,68,4,74,18,38,0,88,0,0,16,7,0,106,0,18,249,142,255,255,
+0,184,254,136,5,31,5,182,18,38,0,56,0,0,16,7,1,82,0,115,249,175,255,255,0,
+162,254,136,4,68,4,74,18,38,0,88,0,0,16,7,1,82,255,234,249,175,255,255,0,
+184,254,103,5,31,5,182,18,38,0,56,0,0,16,7,1,75,0,141,249,142,255,255,0,162,
+254,103,4,68,4,74,18,38,0,88,0,0,16,7,1,75,0,6,249,142,255,255,0,184,255,
+236,5,31,8,94,18,38,0,56,0,0,16,7,9,72,2,236,1,82,255,255,0,162,255,236,4,
+68,7,12,18,38,0,88,0,0,16,7,9,72,2,121,0,0,255,255,0,184,255,236,5,31,8,31,
+18,38,0,56,0,0,16,7,9,69,2,236,1,82,255,255,0,162,255,236,4,68,6,205,18,38,
+0,88,0,0,16,7,9,69,2,119,0,0,255,255,0,0,0,0,4,205,7,51,18,38,0,57,0,0,16,
+7,1,82,255,239,1,82,255,255,0,0,0,0,4,16,5,225,18,38,0,89,0,0,16,6,1,82,144,
+0,255,255,0,0,254,152,4,205,5,182,18,38,0,57,0,0,16,7,2,100,4,203,0,0,255,
+255,0,0,254,152,4,16,4,74,18,38,0,89,0,0,16,7,2,100,4,109,0,0,255,255,0,25,
+0,0,7,86,7,55,18,38,0,58,0,0,16,7,1,79,2,174,1,82,255,255,0,23,0,0,6,51,5,
+229,18,38,0,90,0,0,16,7,1,79,2,27,0,0,255,255,0,25,254,152,7,86,5,182,18,
+38,0,58,0,0,16,7,2,100,6,29,0,0,255,255,0,23,254,152,6,51,4,74,18,38,0,90,
+0,0,16,7,2,100,5,137,0,0,255,255,0,8,0,0,4,168,7,55,18,38,0,59,0,0,16,7,1,
+79,1,78,1,82,255,255,0,37,0,0,4,23,5,229,18,38,0,91,0,0,16,7,1,79,1,20,0,
+0,255,255,0,8,0,0,4,168,7,41,18,38,0,59,0,0,16,7,0,106,0,6,1,82,255,255,0,
+37,0,0,4,23,5,215,18,38,0,91,0,0,16,6,0,106,206,0,255,255,0,0,0,0,4,135,7,
+55,18,38,0,60,0,0,16,7,1,79,1,57,1,82,255,255,0,2,254,20,4,20,5,229,18,38,
+0,92,0,0,16,7,1,79,1,0,0,0,255,255,0,78,0,0,4,68,7,115,18,38,0,61,0,0,16,
+7,1,75,255,237,1,82,255,255,0,80,0,0,3,115,6,33,18,38,0,93,0,0,16,6,1,75,
+153,0,255,255,0,78,254,152,4,68,5,182,18,38,0,61,0,0,16,7,2,100,4,174,0,0,
+255,255,0,80,254,152,3,115,4,74,18,38,0,93,0,0,16,7,2,100,4,70,0,0,255,255,
+0,78,254,212,4,68,5,182,18,38,0,61,0,0,16,7,1,77,255,239,249,251,255,255,
+0,80,254,212,3,115,4,74,18,38,0,93,0,0,16,7,1,77,255,134,249,251,255,255,
+0,174,254,212,4,76,6,20,18,38,0,75,0,0,16,7,1,77,0,29,249,251,255,255,0,33,
+255,236,2,182,6,205,18,38,0,87,0,0,16,7,0,106,254,249,0,246,255,255,0,23,
+0,0,6,51,6,137,18,38,0,90,0,0,16,7,1,80,0,215,0,0,255,255,0,2,254,20,4,20,
+6,137,18,38,0,92,0,0,16,6,1,80,196,0,255,255,0,94,255,236,3,215,6,74,18,38,
+0,68,0,0,16,7,4,172,1,207,0,0,255,255,0,174,0,0,2,229,7,96,18,38,1,65,0,0,
+16,7,1,79,0,211,1,123,0,1,0,184,255,236,5,100,5,203,0,34,0,0,1,1,38,38,35,
+34,6,21,17,35,17,52,0,33,32,19,1,22,22,21,20,4,35,34,39,53,22,22,51,50,54,
+53,16,33,35,2,197,1,63,38,144,119,175,185,183,1,38,1,3,1,126,108,254,221,
+205,239,254,248,246,234,147,85,196,92,167,159,254,160,127,3,57,1,80,79,83,
+197,180,252,78,3,178,251,1,30,254,180,254,203,6,229,185,215,227,79,168,46,
+50,147,146,1,12,255,255,0,113,255,236,4,205,6,49,18,38,1,126,0,0,16,7,7,150,
+1,115,0,0,255,255,0,113,255,236,4,205,6,49,18,38,1,126,0,0,16,7,7,208,1,72,
+0,0,255,255,0,113,255,236,4,205,6,49,18,38,1,126,0,0,16,6,7,165,6,0,255,255,
+0,113,255,236,4,205,6,49,18,38,1,126,0,0,16,6,7,178,20,0,255,255,0,113,255,
+236,4,205,6,49,18,38,1,126,0,0,16,6,7,166,12,0,255,255,0,113,255,236,4,205,
+6,49,18,38,1,126,0,0,16,6,7,179,249,0,255,255,0,113,255,236,4,205,6,225,18,
+38,1,126,0,0,16,6,7,167,23,0,255,255,0,113,255,236,4,205,6,225,18,38,1,126,
+0,0,16,6,7,180,249,0,255,255,0,0,0,0,5,27,5,204,18,38,0,36,0,0,16,6,7,150,
+138,155,255,255,0,0,0,0,5,27,5,204,18,38,0,36,0,0,16,6,7,208,138,155,255,
+255,0,1,0,0,5,234,5,204,16,39,0,36,0,207,0,0,16,7,7,165,254,194,255,155,255,
+255,0,1,0,0,5,254,5,204,16,39,0,36,0,227,0,0,16,7,7,178,254,214,255,155,255,
+255,0,1,0,0,5,193,5,204,16,39,0,36,0,166,0,0,16,7,7,166,254,153,255,155,255,
+255,0,1,0,0,5,193,5,204,16,39,0,36,0,166,0,0,16,7,7,179,254,153,255,155,255,
+255,255,206,0,0,5,201,6,124,16,39,0,36,0,174,0,0,16,7,7,167,254,220,255,155,
+255,255,255,206,0,0,5,201,6,124,16,39,0,36,0,174,0,0,16,7,7,180,254,220,255,
+155,255,255,0,88,255,236,3,152,6,49,18,38,1,130,0,0,16,7,7,150,1,41,0,0,255,
+255,0,88,255,236,3,152,6,49,18,38,1,130,0,0,16,7,7,208,1,8,0,0,255,255,0,
+88,255,236,3,152,6,49,18,38,1,130,0,0,16,6,7,165,210,0,255,255,0,88,255,236,
+3,152,6,49,18,38,1,130,0,0,16,6,7,178,206,0,255,255,0,88,255,236,3,152,6,
+49,18,38,1,130,0,0,16,6,7,166,208,0,255,255,0,88,255,236,3,152,6,49,18,38,
+1,130,0,0,16,6,7,179,187,0,255,255,0,1,0,0,4,170,5,204,16,39,0,40,0,178,0,
+0,16,7,7,150,255,112,255,155,255,255,0,1,0,0,4,158,5,204,16,39,0,40,0,166,
+0,0,16,7,7,208,255,99,255,155,255,255,0,1,0,0,5,219,5,204,16,39,0,40,1,227,
+0,0,16,7,7,165,254,194,255,155,255,255,0,1,0,0,5,209,5,204,16,39,0,40,1,217,
+0,0,16,7,7,178,254,214,255,155,255,255,0,1,0,0,5,168,5,204,16,39,0,40,1,176,
+0,0,16,7,7,166,254,153,255,155,255,255,0,1,0,0,5,168,5,204,16,39,0,40,1,176,
+0,0,16,7,7,179,254,153,255,155,255,255,0,174,254,20,4,76,6,49,18,38,1,132,
+0,0,16,7,7,150,1,180,0,0,255,255,0,174,254,20,4,76,6,49,18,38,1,132,0,0,16,
+7,7,208,1,127,0,0,255,255,0,174,254,20,4,76,6,49,18,38,1,132,0,0,16,6,7,165,
+39,0,255,255,0,174,254,20,4,76,6,49,18,38,1,132,0,0,16,6,7,178,66,0,255,255,
+0,174,254,20,4,76,6,49,18,38,1,132,0,0,16,6,7,166,55,0,255,255,0,174,254,
+20,4,76,6,49,18,38,1,132,0,0,16,6,7,179,37,0,255,255,0,174,254,20,4,76,6,
+225,18,38,1,132,0,0,16,6,7,167,66,0,255,255,0,174,254,20,4,76,6,225,18,38,
+1,132,0,0,16,6,7,180,66,0,255,255,0,1,0,0,5,215,5,204,16,39,0,43,0,178,0,
+0,16,7,7,150,255,112,255,155,255,255,0,1,0,0,5,203,5,204,16,39,0,43,0,166,
+0,0,16,7,7,208,255,99,255,155,255,255,0,1,0,0,7,8,5,204,16,39,0,43,1,227,
+0,0,16,7,7,165,254,194,255,155,255,255,0,1,0,0,6,254,5,204,16,39,0,43,1,217,
+0,0,16,7,7,178,254,214,255,155,255,255,0,1,0,0,6,234,5,204,16,39,0,43,1,197,
+0,0,16,7,7,166,254,153,255,155,255,255,0,1,0,0,6,234,5,204,16,39,0,43,1,197,
+0,0,16,7,7,179,254,153,255,155,255,255,255,206,0,0,7,17,6,124,16,39,0,43,
+1,236,0,0,16,7,7,167,254,220,255,155,255,255,255,206,0,0,6,252,6,124,16,39,
+0,43,1,215,0,0,16,7,7,180,254,220,255,155,255,255,0,159,255,236,2,160,6,49,
+18,38,1,134,0,0,16,6,7,150,14,0,255,255,0,149,255,236,2,160,6,49,18,38,1,
+134,0,0,16,6,7,208,247,0,255,255,255,254,255,236,2,160,6,49,18,38,1,134,0,
+0,16,7,7,165,254,191,0,0,255,255,255,251,255,236,2,160,6,49,18,38,1,134,0,
+0,16,7,7,178,254,208,0,0,255,255,0,56,255,236,2,160,6,49,18,38,1,134,0,0,
+16,7,7,166,254,208,0,0,255,255,0,15,255,236,2,160,6,49,18,38,1,134,0,0,16,
+7,7,179,254,167,0,0,255,255,255,175,255,236,2,160,6,225,18,38,1,134,0,0,16,
+7,7,167,254,189,0,0,255,255,255,147,255,236,2,160,6,225,18,38,1,134,0,0,16,
+7,7,180,254,161,0,0,255,255,0,1,0,0,3,82,5,204,16,39,0,44,0,240,0,0,16,7,
+7,150,255,112,255,155,255,255,0,1,0,0,3,69,5,204,16,39,0,44,0,227,0,0,16,
+7,7,208,255,99,255,155,255,255,0,1,0,0,4,100,5,204,16,39,0,44,2,2,0,0,16,
+7,7,165,254,194,255,155,255,255,0,1,0,0,4,90,5,204,16,39,0,44,1,248,0,0,16,
+7,7,178,254,214,255,155,255,255,0,1,0,0,4,151,5,204,16,39,0,44,2,53,0,0,16,
+7,7,166,254,153,255,155,255,255,0,1,0,0,4,151,5,204,16,39,0,44,2,53,0,0,16,
+7,7,179,254,153,255,155,255,255,255,206,0,0,4,159,6,124,16,39,0,44,2,61,0,
+0,16,7,7,167,254,220,255,155,255,255,255,206,0,0,4,159,6,124,16,39,0,44,2,
+61,0,0,16,7,7,180,254,220,255,155,255,255,0,113,255,236,4,104,6,49,18,38,
+0,82,0,0,16,7,7,150,1,104,0,0,255,255,0,113,255,236,4,104,6,49,18,38,0,82,
+0,0,16,7,7,208,1,92,0,0,255,255,0,113,255,236,4,104,6,49,18,38,0,82,0,0,16,
+6,7,165,27,0,255,255,0,113,255,236,4,104,6,49,18,38,0,82,0,0,16,6,7,178,51,
+0,255,255,0,113,255,236,4,104,6,49,18,38,0,82,0,0,16,6,7,166,23,0,255,255,
+0,113,255,236,4,104,6,49,18,38,0,82,0,0,16,6,7,179,12,0,255,255,0,1,255,236,
+6,56,5,205,16,38,0,50,117,0,16,7,7,150,255,112,255,155,255,255,0,1,255,236,
+6,74,5,205,16,39,0,50,0,135,0,0,16,7,7,208,255,99,255,155,255,255,0,1,255,
+236,7,125,5,205,16,39,0,50,1,186,0,0,16,7,7,165,254,194,255,155,255,255,0,
+1,255,236,7,115,5,205,16,39,0,50,1,176,0,0,16,7,7,178,254,214,255,155,255,
+255,0,1,255,236,7,54,5,205,16,39,0,50,1,115,0,0,16,7,7,166,254,153,255,155,
+255,255,0,1,255,236,7,54,5,205,16,39,0,50,1,115,0,0,16,7,7,179,254,153,255,
+155,255,255,0,162,255,236,4,121,6,49,18,38,1,146,0,0,16,7,7,150,1,123,0,0,
+255,255,0,162,255,236,4,121,6,49,18,38,1,146,0,0,16,7,7,208,1,100,0,0,255,
+255,0,162,255,236,4,121,6,49,18,38,1,146,0,0,16,6,7,165,35,0,255,255,0,162,
+255,236,4,121,6,49,18,38,1,146,0,0,16,6,7,178,59,0,255,255,0,162,255,236,
+4,121,6,49,18,38,1,146,0,0,16,6,7,166,31,0,255,255,0,162,255,236,4,121,6,
+49,18,38,1,146,0,0,16,6,7,179,10,0,255,255,0,162,255,236,4,121,6,225,18,38,
+1,146,0,0,16,6,7,167,51,0,255,255,0,162,255,236,4,121,6,225,18,38,1,146,0,
+0,16,6,7,180,20,0,255,255,0,1,0,0,5,188,5,204,16,39,0,60,1,53,0,0,16,7,7,
+208,255,99,255,155,255,255,0,1,0,0,6,198,5,204,16,39,0,60,2,63,0,0,16,7,7,
+178,254,214,255,155,255,255,0,1,0,0,6,219,5,204,16,39,0,60,2,84,0,0,16,7,
+7,179,254,153,255,155,255,255,255,206,0,0,7,22,6,124,16,39,0,60,2,143,0,0,
+16,7,7,180,254,220,255,155,255,255,0,115,255,236,5,207,6,49,18,38,1,150,0,
+0,16,7,7,150,2,31,0,0,255,255,0,115,255,236,5,207,6,49,18,38,1,150,0,0,16,
+7,7,208,2,18,0,0,255,255,0,115,255,236,5,207,6,49,18,38,1,150,0,0,16,7,7,
+165,0,207,0,0,255,255,0,115,255,236,5,207,6,49,18,38,1,150,0,0,16,7,7,178,
+0,233,0,0,255,255,0,115,255,236,5,207,6,49,18,38,1,150,0,0,16,7,7,166,0,203,
+0,0,255,255,0,115,255,236,5,207,6,49,18,38,1,150,0,0,16,7,7,179,0,182,0,0,
+255,255,0,115,255,236,5,207,6,225,18,38,1,150,0,0,16,7,7,167,0,193,0,0,255,
+255,0,115,255,236,5,207,6,225,18,38,1,150,0,0,16,7,7,180,0,193,0,0,255,255,
+0,1,0,0,6,107,5,205,16,38,1,118,117,0,16,7,7,150,255,112,255,155,255,255,
+0,1,0,0,6,135,5,205,16,39,1,118,0,145,0,0,16,7,7,208,255,99,255,155,255,255,
+0,1,0,0,7,166,5,205,16,39,1,118,1,176,0,0,16,7,7,165,254,194,255,155,255,
+255,0,1,0,0,7,166,5,205,16,39,1,118,1,176,0,0,16,7,7,178,254,214,255,155,
+255,255,0,1,0,0,7,115,5,205,16,39,1,118,1,125,0,0,16,7,7,166,254,153,255,
+155,255,255,0,1,0,0,7,125,5,205,16,39,1,118,1,135,0,0,16,7,7,179,254,153,
+255,155,255,255,255,206,0,0,7,103,6,124,16,39,1,118,1,113,0,0,16,7,7,167,
+254,220,255,155,255,255,255,206,0,0,7,103,6,124,16,39,1,118,1,113,0,0,16,
+7,7,180,254,220,255,155,255,255,0,113,255,236,4,205,6,29,18,38,1,126,0,0,
+16,6,7,196,0,0,255,255,0,113,255,236,4,205,6,29,18,38,1,126,0,0,16,6,7,207,
+253,0,255,255,0,88,255,236,3,152,6,29,18,38,1,130,0,0,16,6,7,196,204,0,255,
+255,0,88,255,236,3,152,6,29,18,38,1,130,0,0,16,6,7,207,200,0,255,255,0,174,
+254,20,4,76,6,29,18,38,1,132,0,0,16,6,7,196,43,0,255,255,0,174,254,20,4,76,
+6,29,18,38,1,132,0,0,16,6,7,207,72,0,255,255,0,68,255,236,2,160,6,29,18,38,
+1,134,0,0,16,7,7,196,254,177,0,0,255,255,0,160,255,236,2,160,6,29,18,38,1,
+134,0,0,16,7,7,207,254,183,0,0,255,255,0,113,255,236,4,104,6,29,18,38,0,82,
+0,0,16,6,7,196,20,0,255,255,0,113,255,236,4,104,6,29,18,38,0,82,0,0,16,6,
+7,207,37,0,255,255,0,162,255,236,4,121,6,29,18,38,1,146,0,0,16,6,7,196,18,
+0,255,255,0,162,255,236,4,121,6,29,18,38,1,146,0,0,16,6,7,207,45,0,255,255,
+0,115,255,236,5,207,6,29,18,38,1,150,0,0,16,7,7,196,0,207,0,0,255,255,0,115,
+255,236,5,207,6,29,18,38,1,150,0,0,16,7,7,207,0,213,0,0,255,255,0,113,254,
+61,4,205,6,49,18,38,1,126,0,0,16,39,7,150,1,115,0,0,16,6,7,151,10,0,255,255,
+0,113,254,61,4,205,6,49,18,38,1,126,0,0,16,39,7,208,1,72,0,0,16,6,7,151,10,
+0,255,255,0,113,254,61,4,205,6,49,18,38,1,126,0,0,16,38,7,165,6,0,16,6,7,
+151,10,0,255,255,0,113,254,61,4,205,6,49,18,38,1,126,0,0,16,38,7,178,20,0,
+16,6,7,151,10,0,255,255,0,113,254,61,4,205,6,49,18,38,1,126,0,0,16,38,7,166,
+12,0,16,6,7,151,10,0,255,255,0,113,254,61,4,205,6,49,18,38,1,126,0,0,16,38,
+7,179,249,0,16,6,7,151,10,0,255,255,0,113,254,61,4,205,6,225,18,38,1,126,
+0,0,16,38,7,167,23,0,16,6,7,151,10,0,255,255,0,113,254,61,4,205,6,225,18,
+38,1,126,0,0,16,38,7,180,249,0,16,6,7,151,10,0,255,255,0,0,255,236,7,189,
+5,204,16,38,7,150,138,155,16,38,0,36,0,0,16,7,1,134,5,29,0,0,255,255,0,0,
+255,236,7,189,5,204,16,38,7,208,138,155,16,38,0,36,0,0,16,7,1,134,5,29,0,
+0,255,255,0,1,255,236,8,140,5,204,16,39,7,165,254,194,255,155,16,39,0,36,
+0,207,0,0,16,7,1,134,5,236,0,0,255,255,0,1,255,236,8,160,5,204,16,39,7,178,
+254,214,255,155,16,39,0,36,0,227,0,0,16,7,1,134,6,0,0,0,255,255,0,1,255,236,
+8,99,5,204,16,39,7,166,254,153,255,155,16,39,0,36,0,166,0,0,16,7,1,134,5,
+195,0,0,255,255,0,1,255,236,8,99,5,204,16,39,7,179,254,153,255,155,16,39,
+0,36,0,166,0,0,16,7,1,134,5,195,0,0,255,255,255,206,255,236,8,107,6,124,16,
+39,7,167,254,220,255,155,16,39,0,36,0,174,0,0,16,7,1,134,5,203,0,0,255,255,
+255,206,255,236,8,107,6,124,16,39,7,180,254,220,255,155,16,39,0,36,0,174,
+0,0,16,7,1,134,5,203,0,0,255,255,0,174,254,20,4,76,6,49,18,38,1,132,0,0,16,
+39,7,150,1,180,0,0,16,7,7,151,254,212,0,0,255,255,0,174,254,20,4,76,6,49,
+18,38,1,132,0,0,16,39,7,208,1,127,0,0,16,7,7,151,254,212,0,0,255,255,0,174,
+254,20,4,76,6,49,18,38,1,132,0,0,16,38,7,165,39,0,16,7,7,151,254,212,0,0,
+255,255,0,174,254,20,4,76,6,49,18,38,1,132,0,0,16,38,7,178,66,0,16,7,7,151,
+254,212,0,0,255,255,0,174,254,20,4,76,6,49,18,38,1,132,0,0,16,38,7,166,55,
+0,16,7,7,151,254,212,0,0,255,255,0,174,254,20,4,76,6,49,18,38,1,132,0,0,16,
+38,7,179,37,0,16,7,7,151,254,212,0,0,255,255,0,174,254,20,4,76,6,225,18,38,
+1,132,0,0,16,38,7,167,66,0,16,7,7,151,254,212,0,0,255,255,0,174,254,20,4,
+76,6,225,18,38,1,132,0,0,16,38,7,180,66,0,16,7,7,151,254,212,0,0,255,255,
+0,1,255,236,9,64,5,204,16,39,0,43,0,178,0,0,16,39,7,150,255,112,255,155,16,
+7,1,134,6,160,0,0,255,255,0,1,255,236,9,51,5,204,16,39,0,43,0,166,0,0,16,
+39,7,208,255,99,255,155,16,7,1,134,6,147,0,0,255,255,0,1,255,236,10,113,5,
+204,16,39,0,43,1,227,0,0,16,39,7,165,254,194,255,155,16,7,1,134,7,209,0,0,
+255,255,0,1,255,236,10,103,5,204,16,39,0,43,1,217,0,0,16,39,7,178,254,214,
+255,155,16,7,1,134,7,199,0,0,255,255,0,1,255,236,10,82,5,204,16,39,0,43,1,
+197,0,0,16,39,7,166,254,153,255,155,16,7,1,134,7,178,0,0,255,255,0,1,255,
+236,10,82,5,204,16,39,0,43,1,197,0,0,16,39,7,179,254,153,255,155,16,7,1,134,
+7,178,0,0,255,255,255,206,255,236,10,121,6,124,16,39,0,43,1,236,0,0,16,39,
+7,167,254,220,255,155,16,7,1,134,7,217,0,0,255,255,255,206,255,236,10,101,
+6,124,16,39,0,43,1,215,0,0,16,39,7,180,254,220,255,155,16,7,1,134,7,197,0,
+0,255,255,0,115,254,61,5,207,6,49,18,38,1,150,0,0,16,39,7,150,2,31,0,0,16,
+7,7,151,0,227,0,0,255,255,0,115,254,61,5,207,6,49,18,38,1,150,0,0,16,39,7,
+208,2,18,0,0,16,7,7,151,0,227,0,0,255,255,0,115,254,61,5,207,6,49,18,38,1,
+150,0,0,16,39,7,165,0,207,0,0,16,7,7,151,0,227,0,0,255,255,0,115,254,61,5,
+207,6,49,18,38,1,150,0,0,16,39,7,178,0,233,0,0,16,7,7,151,0,227,0,0,255,255,
+0,115,254,61,5,207,6,49,18,38,1,150,0,0,16,39,7,166,0,203,0,0,16,7,7,151,
+0,227,0,0,255,255,0,115,254,61,5,207,6,49,18,38,1,150,0,0,16,39,7,179,0,182,
+0,0,16,7,7,151,0,227,0,0,255,255,0,115,254,61,5,207,6,225,18,38,1,150,0,0,
+16,39,7,167,0,193,0,0,16,7,7,151,0,227,0,0,255,255,0,115,254,61,5,207,6,225,
+18,38,1,150,0,0,16,39,7,180,0,193,0,0,16,7,7,151,0,227,0,0,255,255,0,1,255,
+236,9,86,5,205,16,38,1,118,117,0,16,39,7,150,255,112,255,155,16,7,1,134,6,
+182,0,0,255,255,0,1,255,236,9,115,5,205,16,39,1,118,0,145,0,0,16,39,7,208,
+255,99,255,155,16,7,1,134,6,211,0,0,255,255,0,1,255,236,10,146,5,205,16,39,
+1,118,1,176,0,0,16,39,7,165,254,194,255,155,16,7,1,134,7,242,0,0,255,255,
+0,1,255,236,10,146,5,205,16,39,1,118,1,176,0,0,16,39,7,178,254,214,255,155,
+16,7,1,134,7,242,0,0,255,255,0,1,255,236,10,94,5,205,16,39,1,118,1,125,0,
+0,16,39,7,166,254,153,255,155,16,7,1,134,7,190,0,0,255,255,0,1,255,236,10,
+105,5,205,16,39,1,118,1,135,0,0,16,39,7,179,254,153,255,155,16,7,1,134,7,
+201,0,0,255,255,255,206,255,236,10,82,6,124,16,39,1,118,1,113,0,0,16,39,7,
+167,254,220,255,155,16,7,1,134,7,178,0,0,255,255,255,206,255,236,10,82,6,
+124,16,39,1,118,1,113,0,0,16,39,7,180,254,220,255,155,16,7,1,134,7,178,0,
+0,255,255,0,113,255,236,4,205,5,236,18,38,1,126,0,0,16,6,1,78,14,0,255,255,
+0,113,255,236,4,205,5,106,18,38,1,126,0,0,16,6,1,77,253,0,255,255,0,113,254,
+61,4,205,6,29,18,38,1,126,0,0,16,38,7,196,0,0,16,6,7,151,10,0,255,255,0,113,
+254,61,4,205,4,94,18,38,1,126,0,0,16,6,7,151,10,0,255,255,0,113,254,61,4,
+205,6,29,18,38,1,126,0,0,16,38,7,207,253,0,16,6,7,151,10,0,255,255,0,113,
+255,236,4,205,5,225,18,38,1,126,0,0,16,6,1,82,232,0,255,255,0,113,254,61,
+4,205,5,225,18,38,1,126,0,0,16,38,1,82,232,0,16,6,7,151,10,0,255,255,0,0,
+0,0,5,27,7,62,18,38,0,36,0,0,16,7,1,78,0,47,1,82,255,255,0,0,0,0,5,27,6,188,
+18,38,0,36,0,0,16,7,1,77,0,66,1,82,255,255,0,0,0,0,5,27,5,188,18,38,0,36,
+0,0,16,7,7,196,254,151,255,155,255,255,0,0,0,0,5,27,5,188,18,38,0,36,0,0,
+16,7,7,207,254,89,255,155,255,255,0,0,255,236,7,189,5,188,16,38,0,36,0,0,
+16,7,1,134,5,29,0,0,0,1,0,145,4,197,1,115,6,49,0,14,0,0,19,52,54,51,50,22,
+21,20,6,7,53,54,53,34,38,160,61,45,50,55,106,120,121,45,61,5,207,52,46,68,
+53,109,122,12,75,10,85,46,0,1,1,231,254,61,3,6,255,129,0,13,0,0,5,21,20,22,
+51,50,55,21,6,35,34,38,53,53,2,129,30,36,23,44,54,71,74,88,127,111,45,41,
+11,119,19,94,101,129,255,255,0,145,4,89,1,115,5,197,16,6,7,150,0,148,255,
+255,0,232,4,217,3,216,5,225,16,6,1,82,230,0,0,3,0,242,4,238,3,205,6,225,0,
+23,0,35,0,47,0,0,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,6,
+6,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,2,
+248,43,83,78,73,34,50,49,14,94,12,106,97,45,85,78,71,32,47,50,16,92,13,109,
+253,222,56,40,39,58,58,39,40,56,1,129,56,38,39,58,58,39,38,56,5,248,31,36,
+31,54,46,108,125,31,36,31,54,46,113,120,164,54,46,46,54,53,49,49,53,54,46,
+46,54,53,49,49,255,255,0,174,254,20,4,76,6,29,18,38,1,132,0,0,16,38,7,196,
+43,0,16,7,7,151,254,212,0,0,255,255,0,174,254,20,4,76,4,94,18,38,1,132,0,
+0,16,7,7,151,254,212,0,0,255,255,0,174,254,20,4,76,6,29,18,38,1,132,0,0,16,
+38,7,207,72,0,16,7,7,151,254,212,0,0,255,255,0,174,254,20,4,76,5,225,18,38,
+1,132,0,0,16,6,1,82,18,0,255,255,0,174,254,20,4,76,5,225,18,38,1,132,0,0,
+16,38,1,82,18,0,16,7,7,151,254,212,0,0,255,255,255,205,0,0,4,166,5,184,16,
+39,0,40,0,174,0,0,16,7,7,196,254,58,255,155,255,255,255,205,0,0,4,152,5,184,
+16,39,0,40,0,160,0,0,16,7,7,207,253,228,255,155,255,255,255,205,0,0,5,211,
+5,184,16,39,0,43,0,174,0,0,16,7,7,196,254,58,255,155,255,255,255,205,0,0,
+5,197,5,184,16,39,0,43,0,160,0,0,16,7,7,207,253,228,255,155,255,255,0,199,
+255,236,8,142,5,182,16,38,0,43,0,0,16,7,1,134,5,238,0,0,0,2,1,63,4,197,3,
+98,6,49,0,7,0,22,0,0,1,35,38,39,53,51,22,23,37,52,54,51,50,22,21,20,6,7,53,
+54,53,34,38,3,98,86,133,69,196,24,68,253,236,61,45,50,55,106,120,121,45,61,
+4,217,165,138,21,106,193,221,52,46,68,53,109,122,12,75,10,85,46,0,2,1,104,
+4,197,3,150,6,49,0,14,0,22,0,0,1,52,54,51,50,22,21,20,6,7,53,54,53,34,38,
+23,54,55,51,21,6,7,35,1,119,61,45,50,55,106,120,121,45,61,254,68,24,197,80,
+123,86,5,207,52,46,68,53,109,122,12,75,10,85,46,171,193,106,21,150,153,0,
+2,0,242,4,176,3,205,6,225,0,23,0,36,0,0,1,34,46,2,35,34,6,7,35,54,54,51,50,
+30,2,51,50,54,55,51,6,6,5,52,54,51,50,21,20,6,7,53,54,53,34,2,248,43,83,78,
+73,34,50,49,14,94,12,106,97,45,85,78,71,32,47,50,16,92,13,109,254,159,54,
+52,105,113,113,121,106,5,248,31,36,31,54,46,108,125,31,36,31,54,46,113,120,
+115,42,46,106,93,93,9,68,5,54,255,255,255,212,255,236,2,160,5,236,18,38,1,
+134,0,0,16,7,1,78,254,181,0,0,255,255,255,224,255,236,2,160,5,106,18,38,1,
+134,0,0,16,7,1,77,254,181,0,0,255,255,255,192,255,236,2,160,6,57,18,38,1,
+134,0,0,16,7,7,194,254,196,0,0,255,255,255,198,255,236,2,160,6,57,18,38,1,
+134,0,0,16,7,7,195,254,202,0,0,255,255,255,155,255,236,2,160,5,225,18,38,
+1,134,0,0,16,7,1,82,254,153,0,0,255,255,255,165,255,236,2,160,6,225,18,38,
+1,134,0,0,16,7,7,154,254,179,0,0,255,255,0,30,0,0,2,155,7,62,18,38,0,44,0,
+0,16,7,1,78,254,255,1,82,255,255,0,44,0,0,2,140,6,188,18,38,0,44,0,0,16,7,
+1,77,255,1,1,82,255,255,255,205,0,0,3,47,5,184,16,39,0,44,0,205,0,0,16,7,
+7,196,254,58,255,155,255,255,255,205,0,0,3,84,5,184,16,39,0,44,0,242,0,0,
+16,7,7,207,253,228,255,155,0,2,1,43,4,197,3,68,6,49,0,7,0,22,0,0,1,35,38,
+39,53,51,22,23,37,20,6,35,20,23,21,38,38,53,52,54,51,50,22,3,68,86,136,67,
+196,31,62,254,186,62,45,121,119,106,55,49,45,62,4,217,169,134,21,138,161,
+221,50,46,85,10,75,12,122,109,53,68,46,0,2,1,104,4,197,3,150,6,49,0,14,0,
+22,0,0,1,20,6,35,20,23,21,38,38,53,52,54,51,50,22,19,54,55,51,21,6,7,35,2,
+59,61,45,121,120,106,55,50,45,61,58,68,24,197,80,123,86,5,207,50,46,85,10,
+75,12,122,109,53,68,46,254,239,193,106,21,150,153,0,2,0,242,4,176,3,205,6,
+225,0,23,0,35,0,0,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,
+6,6,7,20,35,20,23,21,38,38,53,52,51,50,2,248,43,83,78,73,34,50,49,14,94,12,
+106,97,45,85,78,71,32,47,50,16,92,13,109,149,106,121,114,111,104,106,5,248,
+31,36,31,54,46,108,125,31,36,31,54,46,113,120,115,86,54,5,68,9,94,92,106,
+255,255,0,162,255,236,4,121,5,236,18,38,1,146,0,0,16,6,1,78,43,0,255,255,
+0,162,255,236,4,121,5,106,18,38,1,146,0,0,16,6,1,77,45,0,255,255,0,162,255,
+236,4,121,6,57,18,38,1,146,0,0,16,6,7,194,37,0,255,255,0,162,255,236,4,121,
+6,57,18,38,1,146,0,0,16,6,7,195,37,0,255,255,0,162,254,20,4,102,6,49,18,38,
+1,142,0,0,16,7,7,150,1,145,0,0,255,255,0,162,254,20,4,102,6,49,18,38,1,142,
+0,0,16,7,7,208,1,92,0,0,255,255,0,162,255,236,4,121,5,225,18,38,1,146,0,0,
+16,6,1,82,251,0,255,255,0,162,255,236,4,121,6,225,18,38,1,146,0,0,16,6,7,
+154,20,0,255,255,0,0,0,0,4,135,7,62,18,38,0,60,0,0,16,7,1,78,255,232,1,82,
+255,255,0,0,0,0,4,135,6,188,18,38,0,60,0,0,16,7,1,77,255,232,1,82,255,255,
+255,205,0,0,5,176,5,184,16,39,0,60,1,41,0,0,16,7,7,196,254,58,255,155,255,
+255,255,205,0,0,5,172,5,184,16,39,0,60,1,37,0,0,16,7,7,207,253,228,255,155,
+255,255,0,1,0,0,5,31,5,204,16,39,0,51,0,176,0,0,16,7,7,208,255,99,255,155,
+0,3,0,252,4,227,3,162,6,57,0,8,0,20,0,31,0,0,1,35,38,38,39,53,51,22,23,37,
+52,54,51,50,22,21,20,6,35,34,38,37,52,51,50,22,21,20,6,35,34,38,2,180,86,
+63,113,27,197,28,64,254,72,54,40,38,56,56,38,40,54,1,233,95,37,57,50,44,42,
+53,4,242,78,174,55,20,123,180,64,54,46,47,53,53,50,50,53,100,47,53,45,58,
+50,0,3,0,252,4,227,3,162,6,57,0,8,0,20,0,31,0,0,1,54,55,51,21,6,6,7,35,39,
+52,54,51,50,22,21,20,6,35,34,38,37,52,51,50,22,21,20,6,35,34,38,1,233,58,
+35,196,29,113,61,86,237,54,40,38,56,56,38,40,54,1,233,95,37,57,50,44,42,53,
+5,10,150,153,20,59,173,75,88,54,46,47,53,53,50,50,53,100,47,53,45,58,50,0,
+1,1,147,4,217,2,180,6,29,0,7,0,0,1,35,38,39,53,51,22,23,2,180,86,136,67,197,
+24,68,4,217,169,134,21,106,193,255,255,0,115,254,61,5,207,6,29,18,38,1,150,
+0,0,16,39,7,196,0,207,0,0,16,7,7,151,0,227,0,0,255,255,0,115,254,61,5,207,
+4,74,18,38,1,150,0,0,16,7,7,151,0,227,0,0,255,255,0,115,254,61,5,207,6,29,
+18,38,1,150,0,0,16,39,7,207,0,213,0,0,16,7,7,151,0,227,0,0,255,255,0,115,
+255,236,5,207,5,225,18,38,1,150,0,0,16,7,1,82,0,166,0,0,255,255,0,115,254,
+61,5,207,5,225,18,38,1,150,0,0,16,39,1,82,0,166,0,0,16,7,7,151,0,227,0,0,
+255,255,255,205,255,236,6,82,5,205,16,39,0,50,0,143,0,0,16,7,7,196,254,58,
+255,155,255,255,255,205,255,236,6,7,5,205,16,38,0,50,68,0,16,7,7,207,253,
+228,255,155,255,255,255,205,0,0,6,133,5,205,16,39,1,118,0,143,0,0,16,7,7,
+196,254,58,255,155,255,255,255,205,0,0,6,58,5,205,16,38,1,118,68,0,16,7,7,
+207,253,228,255,155,255,255,0,78,255,236,8,226,5,205,16,38,1,118,0,0,16,7,
+1,134,6,66,0,0,0,1,1,233,4,217,3,10,6,29,0,7,0,0,1,54,55,51,21,6,7,35,1,233,
+62,31,196,67,136,86,4,242,161,138,21,134,169,0,1,0,158,4,197,1,127,6,49,0,
+14,0,0,1,20,6,35,20,23,21,38,38,53,52,54,51,50,22,1,113,62,45,121,120,105,
+55,49,45,62,5,207,50,46,85,10,75,12,122,109,53,68,46,0,1,255,213,254,240,
+0,43,5,6,0,3,0,0,19,17,35,17,43,86,5,6,249,234,6,22,0,1,255,33,254,240,0,
+223,5,133,0,14,0,0,19,35,17,7,39,55,39,55,23,55,23,7,23,7,39,43,86,127,53,
+168,168,53,170,170,53,168,168,53,127,254,240,5,88,127,55,168,166,55,170,170,
+55,166,168,55,127,0,1,255,215,254,240,1,178,5,133,0,10,0,0,1,7,39,55,35,17,
+35,17,33,39,55,1,178,221,55,131,248,82,1,74,131,55,4,170,219,53,125,250,111,
+5,225,125,55,0,1,254,76,254,240,0,41,5,133,0,10,0,0,19,35,17,35,23,7,39,55,
+23,7,33,41,84,248,133,55,223,223,55,133,1,76,254,240,5,145,125,53,219,219,
+55,125,0,1,0,82,2,145,4,66,3,39,0,3,0,0,19,53,33,21,82,3,240,2,145,150,150,
+255,255,1,9,254,18,3,96,6,20,16,39,0,95,255,32,0,0,16,7,0,95,0,225,0,0,0,
+2,0,25,3,193,2,199,5,182,0,7,0,15,0,0,1,22,19,35,38,2,39,55,35,22,19,35,38,
+2,39,55,2,96,36,67,133,45,106,28,15,185,36,67,131,54,101,21,12,5,182,236,
+254,247,94,1,20,109,22,236,254,247,114,1,20,89,22,0,1,255,215,254,240,1,178,
+4,209,0,5,0,0,19,17,35,17,33,21,43,84,1,219,4,129,250,111,5,225,80,0,1,254,
+78,254,240,0,41,4,209,0,5,0,0,1,53,33,17,35,17,254,78,1,219,84,4,129,80,250,
+31,5,145,0,1,255,18,254,240,0,238,5,131,0,7,0,0,19,35,17,35,17,35,17,33,238,
+195,86,195,1,220,3,209,251,31,4,225,1,178,0,1,255,18,254,240,0,238,5,131,
+0,11,0,0,19,35,17,35,17,35,17,33,21,33,17,33,238,195,86,195,1,220,254,116,
+1,140,3,209,251,31,4,225,1,178,80,254,236,0,1,255,18,254,240,0,238,5,131,
+0,11,0,0,3,33,17,33,53,33,17,35,17,35,17,35,238,1,140,254,116,1,220,195,86,
+195,4,31,1,20,80,254,78,251,31,4,225,255,255,0,133,3,166,4,54,5,182,16,38,
+0,5,0,0,16,7,0,10,2,238,0,0,255,255,255,250,6,20,4,6,6,156,18,6,0,113,0,0,
+0,4,0,147,255,227,1,145,5,205,0,11,0,23,0,35,0,47,0,0,55,52,54,51,50,22,21,
+20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,
+6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,147,64,63,61,66,68,59,61,66,
+64,63,61,66,68,59,61,66,65,62,61,66,68,59,61,66,64,63,61,66,68,59,61,66,111,
+66,73,72,67,67,73,74,3,121,66,73,72,67,66,73,74,254,165,68,72,72,68,66,73,
+74,3,121,66,73,72,67,67,73,74,0,1,255,18,254,240,0,238,5,131,0,15,0,0,3,51,
+17,35,53,33,21,35,17,51,21,35,17,35,17,35,238,195,195,1,220,195,195,195,86,
+195,4,31,1,20,80,80,254,236,78,251,31,4,225,0,2,255,18,254,240,0,238,5,131,
+0,3,0,11,0,0,3,33,17,33,3,17,33,17,35,17,35,17,158,1,60,254,196,80,1,220,
+195,86,4,31,1,20,254,158,1,178,254,78,251,31,4,225,0,1,255,16,254,240,0,240,
+5,131,0,5,0,0,19,35,17,3,33,3,43,86,197,1,224,197,254,240,5,36,1,111,254,
+145,0,1,255,16,254,240,0,240,5,137,0,6,0,0,19,17,35,17,35,19,19,43,86,197,
+240,240,3,209,251,31,4,225,1,184,254,72,0,2,255,16,254,240,0,240,5,133,0,
+6,0,10,0,0,19,35,17,39,55,23,7,55,39,7,23,43,86,197,240,240,197,84,127,127,
+127,254,240,5,4,182,219,219,182,182,113,113,113,0,1,255,18,254,240,0,238,
+5,131,0,13,0,0,3,51,17,35,53,33,17,51,21,35,17,35,17,35,238,195,195,1,25,
+195,195,86,195,4,31,1,20,80,254,156,78,251,31,4,225,0,2,0,39,2,57,2,164,5,
+199,0,11,0,21,0,0,19,20,22,51,50,54,53,52,38,35,34,6,5,16,33,34,38,53,16,
+33,50,22,188,79,89,90,82,82,90,89,79,1,232,254,192,158,159,1,61,159,161,4,
+0,164,162,161,167,165,161,161,165,254,55,236,221,1,197,232,0,2,0,41,2,57,
+2,168,5,199,0,22,0,34,0,0,19,16,33,50,23,21,38,35,34,6,7,51,54,54,51,50,22,
+21,20,6,35,34,38,5,50,54,53,52,38,35,34,6,21,20,22,41,1,186,74,49,55,76,140,
+148,11,8,28,111,85,123,149,167,142,155,175,1,70,78,96,85,83,79,112,105,3,
+195,2,4,15,121,19,150,163,43,59,147,127,142,166,211,94,92,94,78,88,85,60,
+90,117,0,2,0,35,2,57,2,162,5,201,0,21,0,33,0,0,1,16,6,35,34,39,53,22,51,32,
+19,35,6,35,34,38,53,52,54,51,50,22,37,34,6,21,20,22,51,50,54,53,52,38,2,162,
+222,214,80,49,44,93,1,18,21,11,71,142,131,151,172,137,153,177,254,182,78,
+92,82,84,84,108,101,4,68,254,244,255,15,123,21,1,62,101,147,130,135,166,205,
+88,96,82,78,92,86,57,96,109,255,255,0,90,255,85,2,236,2,110,16,7,5,203,0,
+0,252,173,255,255,0,104,255,85,3,27,2,112,16,7,5,209,0,0,252,173,255,255,
+0,104,255,85,3,80,2,112,16,7,5,218,0,0,252,173,0,1,0,39,255,96,3,35,2,98,
+0,11,0,0,37,1,51,19,19,51,1,1,35,3,3,35,1,70,254,239,187,182,182,184,254,
+240,1,31,185,196,197,186,231,1,123,254,250,1,6,254,133,254,121,1,21,254,235,
+255,255,0,98,255,85,3,20,2,112,16,7,5,210,0,0,252,173,0,1,0,74,0,0,4,70,5,
+203,0,31,0,0,33,33,17,35,34,2,53,52,18,51,50,23,7,38,35,34,6,21,20,22,51,
+51,17,33,21,33,17,33,21,33,17,33,4,70,253,231,39,221,223,231,201,159,126,
+66,111,102,122,138,140,136,29,2,25,254,143,1,86,254,170,1,113,1,207,1,2,242,
+239,1,25,64,131,58,207,178,180,183,1,164,135,254,227,135,254,186,0,3,0,100,
+255,137,4,104,6,18,0,34,0,42,0,48,0,0,1,7,22,23,7,38,39,3,50,55,21,6,6,35,
+7,35,55,38,39,7,35,19,38,17,52,18,55,55,51,7,55,51,50,23,55,3,34,7,3,22,23,
+19,38,1,20,23,19,6,6,4,10,41,70,65,71,59,37,199,133,176,81,153,106,37,129,
+39,89,71,47,129,60,228,244,225,39,129,35,23,25,72,46,37,151,45,39,191,68,
+88,203,41,253,252,90,161,120,131,6,18,200,23,31,147,28,13,252,45,57,151,33,
+27,180,187,12,31,230,1,37,169,1,126,252,1,83,52,186,170,2,8,176,254,191,6,
+252,82,44,16,3,234,6,254,2,205,129,3,29,57,238,0,1,0,115,255,236,4,76,5,203,
+0,38,0,0,1,50,23,7,38,35,34,6,21,17,54,54,55,21,6,6,35,32,0,17,16,0,33,50,
+23,7,38,38,35,34,2,17,20,18,23,17,51,23,54,3,190,59,62,20,66,43,93,126,74,
+142,95,86,153,98,254,224,254,210,1,64,1,26,217,166,74,59,150,98,193,231,140,
+126,146,10,95,3,139,12,154,17,146,108,254,141,1,24,32,151,35,24,1,133,1,108,
+1,92,1,146,86,148,31,49,254,189,254,237,222,254,210,51,2,225,113,127,0,1,
+0,174,255,31,6,213,5,84,0,39,0,0,1,3,54,51,50,22,21,17,35,17,16,35,34,6,21,
+17,35,17,1,35,1,53,52,38,35,34,6,21,17,35,17,51,23,51,54,54,51,50,23,19,5,
+53,131,82,94,186,185,178,223,153,144,179,254,234,143,1,165,109,116,152,141,
+180,145,27,10,47,171,106,236,85,189,5,84,254,233,33,192,211,253,53,2,195,
+1,4,178,183,253,162,1,117,253,170,3,139,25,130,130,186,212,253,199,4,74,150,
+80,90,155,1,145,0,5,0,20,0,0,4,127,5,182,0,29,0,33,0,37,0,42,0,47,0,0,19,
+53,35,53,51,17,51,22,22,19,51,17,51,17,51,21,35,21,51,21,35,17,35,3,35,17,
+35,17,35,53,37,35,23,51,33,51,39,35,3,22,23,51,39,1,39,35,22,23,180,160,160,
+213,9,52,134,241,162,160,160,160,160,215,194,242,160,160,3,41,194,61,133,
+254,23,192,61,131,16,9,3,86,90,2,0,13,86,71,20,2,145,168,131,1,250,15,134,
+254,155,1,250,254,6,131,168,131,253,242,2,14,253,242,2,14,131,168,168,168,
+1,123,147,101,248,252,123,223,191,32,0,3,0,170,255,236,6,88,5,182,0,13,0,
+22,0,60,0,0,1,17,35,17,33,50,22,21,20,6,7,1,35,1,39,51,50,54,53,52,38,35,
+35,1,20,6,35,34,39,53,22,22,51,50,53,52,38,39,46,2,53,52,54,51,50,22,23,7,
+38,38,35,34,6,21,20,22,23,30,2,1,88,174,1,43,224,216,110,107,1,33,195,255,
+0,186,135,135,115,124,130,131,5,0,181,173,168,94,53,152,57,180,71,111,108,
+94,46,178,148,87,130,59,66,57,101,57,71,78,73,113,106,94,46,2,92,253,164,
+5,182,207,208,143,199,50,253,113,2,92,156,140,138,143,126,252,18,155,166,
+65,166,37,49,162,61,82,64,60,90,110,73,132,159,44,34,137,32,36,73,60,59,82,
+64,59,90,109,0,7,0,20,0,0,5,72,5,182,0,31,0,35,0,39,0,43,0,48,0,53,0,59,0,
+0,19,39,35,53,51,3,51,19,51,19,51,19,51,19,51,3,51,21,35,7,51,21,35,3,35,
+3,35,3,35,3,35,53,33,51,39,35,5,51,55,35,5,51,55,35,1,6,7,51,38,1,54,55,35,
+22,5,54,54,55,35,22,176,29,127,105,88,164,80,219,94,188,97,219,76,161,84,
+101,123,27,150,172,86,185,98,244,92,182,92,181,2,60,194,30,135,1,59,119,24,
+176,253,195,114,31,172,1,131,13,34,88,31,1,45,5,28,73,34,253,162,1,18,14,
+72,32,2,145,168,131,1,250,254,6,1,250,254,6,1,250,254,6,131,168,131,253,242,
+2,14,253,242,2,14,131,168,168,168,168,168,1,189,131,183,162,252,119,99,214,
+219,86,30,187,88,187,0,1,0,31,0,0,4,147,5,182,0,21,0,0,1,33,21,33,1,35,1,
+35,7,17,35,17,35,53,51,17,51,17,51,1,51,1,2,129,1,154,254,188,1,188,206,254,
+86,41,115,174,178,178,174,53,2,0,201,253,254,3,51,135,253,84,2,172,127,253,
+211,2,172,135,2,131,253,125,2,131,253,135,0,1,0,39,0,0,4,111,5,182,0,23,0,
+0,1,55,23,5,21,55,23,5,17,35,17,7,39,37,53,7,39,37,17,33,53,33,21,33,2,168,
+240,73,254,199,240,73,254,199,184,240,74,1,58,240,74,1,58,254,55,4,72,254,
+57,3,197,165,108,215,207,166,109,215,254,70,1,80,164,109,215,204,163,108,
+215,1,184,162,162,0,3,0,49,254,20,7,121,5,203,0,18,0,30,0,57,0,0,1,20,6,6,
+35,34,38,39,35,6,6,3,35,19,54,54,51,50,22,37,34,6,7,7,22,51,50,54,53,52,38,
+1,50,4,18,21,20,2,4,35,35,19,51,3,51,50,36,18,53,52,36,35,34,6,7,39,54,54,
+7,121,101,185,124,53,101,26,8,16,21,72,172,168,37,201,153,153,167,254,192,
+83,106,26,22,40,111,99,131,74,251,84,202,1,52,166,204,254,139,238,234,252,
+176,219,19,194,1,33,153,254,249,226,86,198,74,62,76,228,1,129,111,186,108,
+41,28,94,126,254,191,3,37,179,188,155,12,104,116,106,88,146,114,72,82,3,178,
+154,254,225,190,251,254,122,211,4,160,251,252,174,1,64,208,214,255,38,34,
+146,37,45,0,2,0,25,254,20,4,33,5,205,0,34,0,43,0,0,1,20,2,7,18,18,21,20,6,
+35,34,39,53,22,51,50,54,53,52,11,2,7,35,1,19,19,38,2,53,52,54,51,50,22,7,
+52,35,34,21,20,18,23,54,4,29,118,108,131,99,163,144,72,82,82,72,61,80,168,
+234,170,126,168,1,38,164,174,80,85,150,134,129,148,166,113,117,59,46,125,
+4,164,132,254,179,172,254,212,254,193,106,148,170,21,154,33,89,87,165,1,138,
+254,102,1,19,250,2,31,254,213,1,45,165,1,57,120,164,178,157,157,172,196,82,
+254,253,95,244,0,4,0,20,0,0,4,127,5,182,0,26,0,33,0,38,0,44,0,0,1,35,23,20,
+7,51,21,35,6,4,35,35,17,35,17,35,53,51,53,35,53,51,17,33,32,19,51,5,52,39,
+33,21,33,54,37,33,38,35,35,19,50,54,55,33,21,4,127,133,4,8,137,166,55,255,
+0,191,114,170,179,179,179,179,1,63,1,138,85,154,254,203,6,254,45,1,209,8,
+254,39,1,176,74,215,143,104,121,159,42,254,86,4,37,74,39,69,111,145,146,254,
+35,3,0,111,182,110,1,35,254,221,192,41,41,182,61,231,140,253,86,65,74,139,
+0,3,0,125,255,92,5,59,6,18,0,21,0,28,0,33,0,0,5,53,36,0,17,16,0,37,53,51,
+21,22,23,7,38,39,17,33,17,6,7,21,1,16,18,23,17,6,2,1,17,54,55,17,2,252,254,
+206,254,179,1,82,1,45,131,223,201,70,182,172,1,188,206,238,253,190,227,220,
+212,235,2,66,142,118,164,146,18,1,136,1,83,1,63,1,135,34,79,71,4,82,160,79,
+5,253,219,253,51,67,6,146,3,127,254,250,254,215,27,4,144,32,254,205,254,146,
+254,43,3,32,1,178,0,3,0,0,0,0,4,219,5,182,0,23,0,27,0,34,0,0,1,33,21,33,23,
+51,21,35,19,35,3,33,3,35,19,35,53,51,55,33,53,33,19,51,1,33,39,33,55,51,39,
+38,39,6,6,3,145,1,56,254,248,61,203,156,174,194,170,253,251,167,195,174,154,
+201,60,254,251,1,52,196,193,254,205,1,165,59,254,207,45,215,2,73,34,16,80,
+3,147,131,168,131,254,27,1,229,254,27,1,229,131,168,131,2,35,252,178,168,
+131,7,207,133,79,245,0,1,0,20,255,236,4,80,5,203,0,48,0,0,19,54,54,55,33,
+53,33,54,53,52,38,35,34,7,39,54,51,50,4,21,20,7,51,21,35,6,7,7,33,21,33,6,
+21,20,22,51,50,55,21,6,6,35,34,36,53,52,55,35,53,215,57,155,122,253,239,2,
+250,54,147,130,147,168,58,175,194,209,1,2,25,107,193,90,176,51,1,254,253,
+8,63,165,164,186,224,69,210,123,245,254,235,23,99,2,145,47,76,45,131,57,95,
+101,112,78,158,82,202,171,88,66,131,86,63,19,131,57,94,110,126,97,177,34,
+45,220,191,70,65,131,0,2,0,125,255,92,4,207,6,18,0,22,0,29,0,0,5,53,36,0,
+17,16,0,37,53,51,21,22,23,7,38,39,17,54,55,21,6,7,21,1,20,18,23,17,6,2,2,
+221,254,218,254,198,1,66,1,30,131,212,155,74,155,138,137,173,148,162,253,
+223,213,201,194,220,164,146,19,1,135,1,85,1,64,1,139,29,77,71,10,76,156,70,
+8,251,102,5,53,160,54,3,146,3,127,255,254,210,27,4,144,30,254,203,0,1,0,162,
+0,0,3,242,5,182,0,25,0,0,19,33,38,38,35,35,53,33,21,33,22,23,33,21,33,2,5,
+1,35,1,53,51,50,54,55,33,162,1,139,22,173,155,45,3,80,254,125,98,18,1,15,
+254,245,29,254,165,1,135,209,254,125,45,174,165,13,254,115,4,90,114,103,131,
+131,78,139,131,254,223,49,253,123,2,164,90,100,117,255,255,254,34,3,96,1,
+222,6,249,16,7,0,13,253,206,0,229,0,4,0,100,255,236,6,68,5,203,0,7,0,18,0,
+34,0,50,0,0,1,51,50,53,52,38,35,35,17,17,35,17,33,50,22,21,20,6,35,37,52,
+18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,18,4,51,50,36,18,53,52,2,36,35,
+34,4,2,2,229,144,170,83,89,142,155,1,47,168,155,169,134,252,215,200,1,94,
+202,200,1,94,202,194,254,162,208,207,254,162,195,109,172,1,43,172,172,1,42,
+173,172,254,213,172,172,254,214,173,2,219,162,81,73,254,69,254,191,3,127,
+141,140,130,163,127,200,1,94,202,200,254,162,202,197,254,166,208,207,1,90,
+198,172,254,214,173,172,1,43,172,172,1,42,173,172,254,213,0,4,0,10,255,248,
+5,150,5,182,0,7,0,12,0,50,0,54,0,0,1,39,35,7,35,1,51,1,3,39,39,7,7,1,20,6,
+35,34,38,39,53,22,22,51,50,53,52,38,38,39,38,38,53,52,54,51,50,22,23,7,38,
+38,35,34,6,21,20,22,23,22,22,3,1,35,1,2,31,72,248,73,140,1,17,129,1,16,248,
+69,21,18,70,4,148,163,137,62,116,37,39,130,51,155,27,63,63,105,92,131,119,
+59,121,43,35,38,105,45,57,54,56,92,113,90,150,252,221,149,3,34,2,246,200,
+200,2,192,253,64,1,51,195,67,70,192,252,147,91,105,21,18,125,20,30,78,34,
+33,35,21,36,95,80,91,104,27,20,109,17,24,31,41,43,45,28,38,97,4,163,250,74,
+5,182,0,1,0,61,0,0,2,207,4,74,0,9,0,0,1,51,17,33,53,33,17,33,53,33,2,25,182,
+253,110,1,220,254,67,1,189,4,74,251,182,147,1,95,147,255,255,0,46,255,240,
+6,24,5,182,16,39,2,23,2,96,0,0,16,38,0,123,226,0,16,7,0,117,3,135,253,183,
+255,255,0,49,255,240,6,45,5,201,16,39,2,23,2,158,0,0,16,38,0,116,0,0,16,7,
+0,117,3,156,253,183,0,1,0,70,255,242,3,180,4,88,0,22,0,0,1,34,7,39,54,51,
+50,0,17,16,0,35,34,38,39,53,22,51,50,54,53,52,38,1,145,112,150,69,148,181,
+254,1,39,254,239,253,98,137,68,168,114,173,184,190,3,197,66,141,72,254,212,
+254,251,254,242,254,217,23,26,147,49,216,200,193,223,0,1,1,162,0,100,6,94,
+2,68,0,13,0,0,1,22,23,35,38,39,53,54,55,51,6,7,33,21,2,129,57,62,72,127,143,
+143,127,72,62,57,3,221,1,41,68,129,150,72,36,72,150,129,68,86,0,1,1,16,255,
+195,2,240,4,127,0,13,0,0,1,6,7,53,54,55,51,22,23,21,38,39,17,35,1,213,68,
+129,150,72,36,72,150,129,68,86,3,160,58,61,72,127,143,143,127,72,61,58,252,
+35,0,1,1,162,0,100,6,94,2,68,0,13,0,0,1,38,39,51,22,23,21,6,7,35,54,55,33,
+53,5,127,57,62,72,127,143,143,127,72,62,57,252,35,1,127,68,129,150,72,36,
+72,150,129,68,86,0,1,1,16,255,195,2,240,4,127,0,13,0,0,37,54,55,21,6,7,35,
+38,39,53,22,23,17,51,2,43,68,129,150,72,36,72,150,129,68,86,162,57,62,72,
+127,143,143,127,72,62,57,3,221,0,1,1,162,0,100,6,94,2,68,0,23,0,0,1,22,23,
+35,38,39,53,54,55,51,6,7,33,38,39,51,22,23,21,6,7,35,54,55,2,129,57,62,72,
+127,143,143,127,72,62,57,2,254,57,62,72,127,143,143,127,72,62,57,1,41,68,
+129,150,72,36,72,150,129,68,68,129,150,72,36,72,150,129,68,0,1,1,16,255,195,
+2,240,4,127,0,23,0,0,1,6,7,53,54,55,51,22,23,21,38,39,17,54,55,21,6,7,35,
+38,39,53,22,23,1,213,68,129,150,72,36,72,150,129,68,68,129,150,72,36,72,150,
+129,68,3,160,58,61,72,127,143,143,127,72,61,58,253,2,57,62,72,127,143,143,
+127,72,62,57,0,2,1,16,255,72,2,240,4,127,0,3,0,27,0,0,5,33,21,33,19,6,7,53,
+54,55,51,22,23,21,38,39,17,54,55,21,6,7,35,38,39,53,22,23,1,16,1,224,254,
+32,197,68,129,150,72,36,72,150,129,68,68,129,150,72,36,72,150,129,68,104,
+80,4,88,58,61,72,127,143,143,127,72,61,58,253,2,57,62,72,127,143,143,127,
+72,62,57,255,255,254,121,0,0,2,143,5,182,18,6,2,23,0,0,255,255,0,147,2,72,
+1,145,3,94,18,6,0,121,0,0,0,1,1,152,0,0,6,96,4,199,0,5,0,0,1,51,17,33,21,
+33,1,152,94,4,106,251,56,4,199,251,151,94,0,1,1,23,255,254,4,170,4,8,0,19,
+0,0,5,17,52,54,54,51,50,22,22,21,17,35,17,52,38,35,34,6,21,17,1,23,114,209,
+131,131,211,119,102,197,160,162,192,2,2,0,149,240,133,133,242,147,254,0,2,
+2,190,228,225,195,254,0,0,3,0,100,0,244,4,72,4,80,0,3,0,7,0,11,0,0,19,53,
+33,21,1,53,33,21,1,53,33,21,100,3,228,252,28,3,228,252,28,3,228,3,188,148,
+148,253,56,147,147,1,100,148,148,0,2,0,158,0,0,4,55,4,129,0,4,0,9,0,0,51,
+17,1,1,17,37,33,17,1,1,158,1,204,1,205,252,183,2,249,254,131,254,132,2,123,
+2,6,253,250,253,133,82,2,6,1,170,254,86,255,255,0,106,1,6,4,45,3,27,16,71,
+0,110,4,147,0,0,192,0,64,0,0,1,2,35,254,20,3,211,6,170,0,21,0,0,1,35,17,52,
+54,51,50,22,21,20,6,35,34,39,38,39,38,35,34,7,6,21,2,180,145,168,125,63,76,
+51,37,31,12,17,38,33,17,34,11,6,254,20,6,220,196,246,64,47,41,51,10,9,41,
+39,39,35,105,0,1,1,4,254,20,2,180,6,170,0,20,0,0,1,51,17,20,6,35,34,38,53,
+52,54,51,50,23,22,23,22,51,50,54,53,2,35,145,162,133,57,80,51,35,35,25,10,
+30,31,17,28,25,6,170,249,35,195,246,62,47,39,53,16,4,41,37,51,127,0,1,255,
+246,2,166,5,180,3,55,0,3,0,0,3,53,33,21,10,5,190,2,166,145,145,0,1,1,215,
+254,20,2,104,7,201,0,3,0,0,1,51,17,35,1,215,145,145,7,201,246,75,0,1,2,141,
+254,20,5,180,3,55,0,5,0,0,1,33,21,33,17,35,2,141,3,39,253,107,146,3,55,145,
+251,110,0,1,255,246,254,20,3,31,3,55,0,5,0,0,3,53,33,17,35,17,10,3,41,146,
+2,166,145,250,221,4,146,0,1,2,141,2,166,5,180,7,201,0,5,0,0,1,51,17,33,21,
+33,2,141,146,2,149,252,217,7,201,251,110,145,0,1,255,246,2,166,3,31,7,201,
+0,5,0,0,3,53,33,17,51,17,10,2,151,146,2,166,145,4,146,250,221,0,1,2,141,254,
+20,5,180,7,201,0,7,0,0,1,51,17,33,21,33,17,35,2,141,146,2,149,253,107,146,
+7,201,251,110,145,251,110,0,1,255,246,254,20,3,31,7,201,0,7,0,0,3,53,33,17,
+51,17,35,17,10,2,151,146,146,2,166,145,4,146,246,75,4,146,0,1,255,246,254,
+20,5,180,3,55,0,7,0,0,3,53,33,21,33,17,35,17,10,5,190,253,107,146,2,166,145,
+145,251,110,4,146,0,1,255,246,2,166,5,180,7,201,0,7,0,0,3,53,33,17,51,17,
+33,21,10,2,151,146,2,149,2,166,145,4,146,251,110,145,0,1,255,246,254,20,5,
+180,7,201,0,11,0,0,3,53,33,17,51,17,33,21,33,17,35,17,10,2,151,146,2,149,
+253,107,146,2,166,145,4,146,251,110,145,251,110,4,146,0,2,255,246,1,242,5,
+180,3,236,0,3,0,7,0,0,3,53,33,21,1,53,33,21,10,5,190,250,66,5,190,3,90,146,
+146,254,152,145,145,0,2,1,217,254,20,3,211,7,201,0,3,0,7,0,0,1,51,17,35,1,
+51,17,35,1,217,145,145,1,105,145,145,7,201,246,75,9,181,246,75,0,1,2,141,
+254,20,5,180,3,236,0,9,0,0,1,33,21,33,21,33,21,33,17,35,2,141,3,39,253,107,
+2,149,253,107,146,3,236,146,215,145,252,34,0,1,1,217,254,20,5,180,3,55,0,
+9,0,0,1,21,33,17,35,17,35,17,35,17,5,180,254,31,145,216,145,3,55,145,251,
+110,4,146,251,110,5,35,0,2,1,217,254,20,5,180,3,236,0,5,0,11,0,0,1,33,21,
+33,17,35,1,33,21,33,17,35,1,217,3,219,252,182,145,1,105,2,114,254,31,145,
+3,236,146,250,186,4,111,145,252,34,0,1,255,246,254,20,3,31,3,236,0,9,0,0,
+3,53,33,53,33,53,33,17,35,17,10,2,151,253,105,3,41,146,1,242,145,215,146,
+250,40,3,222,0,1,255,246,254,20,3,211,3,55,0,9,0,0,3,53,33,17,35,17,35,17,
+35,17,10,3,221,145,216,145,2,166,145,250,221,4,146,251,110,4,146,0,2,255,
+246,254,20,3,211,3,236,0,5,0,11,0,0,1,17,35,17,33,53,1,35,17,33,53,33,3,211,
+145,252,180,2,116,145,254,29,2,116,3,236,250,40,5,70,146,250,40,3,222,145,
+0,1,2,141,1,242,5,180,7,201,0,9,0,0,1,51,17,33,21,33,21,33,21,33,2,141,146,
+2,149,253,107,2,149,252,217,7,201,252,35,146,215,145,0,1,1,217,2,166,5,180,
+7,201,0,9,0,0,1,51,17,33,21,33,17,51,17,51,3,66,145,1,225,252,37,145,216,
+7,201,251,110,145,5,35,251,110,0,2,1,217,1,242,5,180,7,201,0,5,0,11,0,0,1,
+51,17,33,21,33,1,51,17,33,21,33,1,217,145,3,74,252,37,1,105,145,1,225,253,
+142,7,201,250,186,145,5,215,252,35,146,0,1,255,246,1,242,3,31,7,201,0,9,0,
+0,3,53,33,53,33,53,33,17,51,17,10,2,151,253,105,2,151,146,1,242,145,215,146,
+3,221,250,41,0,1,255,246,2,166,3,211,7,201,0,9,0,0,1,33,53,33,17,51,17,51,
+17,51,3,211,252,35,1,227,145,216,145,2,166,145,4,146,251,110,4,146,0,2,255,
+246,1,242,3,211,7,201,0,5,0,11,0,0,1,33,53,33,17,51,33,51,17,33,53,33,3,211,
+252,35,3,76,145,254,6,145,253,140,1,227,1,242,145,5,70,251,145,146,0,1,2,
+141,254,20,5,180,7,201,0,11,0,0,1,51,17,33,21,33,21,33,21,33,17,35,2,141,
+146,2,149,253,107,2,149,253,107,146,7,201,252,35,146,215,145,252,34,0,2,1,
+217,254,20,5,180,7,201,0,7,0,11,0,0,1,51,17,33,21,33,17,35,1,51,17,35,3,66,
+145,1,225,254,31,145,254,151,145,145,7,201,251,110,145,251,110,9,181,246,
+75,0,3,1,217,254,20,5,180,7,201,0,3,0,9,0,15,0,0,1,35,17,51,19,33,21,33,17,
+35,17,51,17,33,21,33,2,106,145,145,216,2,114,254,31,145,145,1,225,253,142,
+254,20,9,181,250,186,145,252,34,9,181,252,35,146,0,1,255,246,254,20,3,31,
+7,201,0,11,0,0,3,53,33,53,33,53,33,17,51,17,35,17,10,2,151,253,105,2,151,
+146,146,1,242,145,215,146,3,221,246,75,3,222,0,2,255,246,254,20,3,211,7,201,
+0,7,0,11,0,0,3,53,33,17,51,17,35,17,1,51,17,35,10,1,227,145,145,1,105,145,
+145,2,166,145,4,146,246,75,4,146,5,35,246,75,0,3,255,246,254,20,3,211,7,201,
+0,3,0,9,0,15,0,0,1,51,17,35,1,51,17,33,53,33,19,35,17,33,53,33,3,66,145,145,
+254,151,145,253,140,1,227,145,145,254,29,2,116,7,201,246,75,9,181,251,145,
+146,250,40,3,222,145,0,2,255,246,254,20,5,180,3,236,0,7,0,11,0,0,3,53,33,
+21,33,17,35,17,1,53,33,21,10,5,190,253,107,146,253,105,5,190,1,242,145,145,
+252,34,3,222,1,104,146,146,0,1,255,246,254,20,5,180,3,55,0,11,0,0,3,53,33,
+21,33,17,35,17,35,17,35,17,10,5,190,254,31,145,216,145,2,166,145,145,251,
+110,4,146,251,110,4,146,0,3,255,246,254,20,5,180,3,236,0,5,0,11,0,15,0,0,
+1,35,17,33,53,33,51,33,21,33,17,35,1,21,33,53,2,106,145,254,29,2,116,216,
+2,114,254,31,145,2,114,250,66,254,20,3,222,145,145,252,34,5,216,146,146,0,
+2,255,246,1,242,5,180,7,201,0,7,0,11,0,0,3,53,33,17,51,17,33,21,1,53,33,21,
+10,2,151,146,2,149,250,66,5,190,3,90,146,3,221,252,35,146,254,152,145,145,
+0,1,255,246,2,166,5,180,7,201,0,11,0,0,3,53,33,17,51,17,51,17,51,17,33,21,
+10,1,227,145,216,145,1,225,2,166,145,4,146,251,110,4,146,251,110,145,0,3,
+255,246,1,242,5,180,7,201,0,5,0,11,0,15,0,0,1,51,17,33,21,33,1,51,17,33,53,
+33,1,53,33,21,3,66,145,1,225,253,142,254,151,145,253,140,1,227,254,29,5,190,
+7,201,252,35,146,4,111,251,145,146,254,6,145,145,0,1,255,246,254,20,5,180,
+7,201,0,19,0,0,3,53,33,53,33,53,33,17,51,17,33,21,33,21,33,21,33,17,35,17,
+10,2,151,253,105,2,151,146,2,149,253,107,2,149,253,107,146,1,242,145,215,
+146,3,221,252,35,146,215,145,252,34,3,222,0,1,255,246,254,20,5,180,7,201,
+0,19,0,0,1,51,17,33,21,33,17,35,17,35,17,35,17,33,53,33,17,51,17,51,3,66,
+145,1,225,254,31,145,216,145,254,29,1,227,145,216,7,201,251,110,145,251,110,
+4,146,251,110,4,146,145,4,146,251,110,0,4,255,246,254,20,5,180,7,201,0,5,
+0,11,0,17,0,23,0,0,1,51,17,33,21,33,3,35,17,33,53,33,51,33,21,33,17,35,1,
+51,17,33,53,33,3,66,145,1,225,253,142,216,145,254,29,2,116,216,2,114,254,
+31,145,254,151,145,253,140,1,227,7,201,252,35,146,250,186,3,222,145,145,252,
+34,9,181,251,145,146,0,1,0,0,2,238,5,170,7,201,0,3,0,0,1,33,17,33,5,170,250,
+86,5,170,2,238,4,219,0,1,0,0,254,20,5,170,2,238,0,3,0,0,1,33,17,33,5,170,
+250,86,5,170,254,20,4,218,0,1,0,0,254,20,5,170,7,201,0,3,0,0,1,33,17,33,5,
+170,250,86,5,170,254,20,9,181,0,1,0,0,254,20,2,213,7,201,0,3,0,0,1,33,17,
+33,2,213,253,43,2,213,254,20,9,181,0,1,2,213,254,20,5,170,7,201,0,3,0,0,1,
+33,17,33,5,170,253,43,2,213,254,20,9,181,0,42,0,102,254,119,5,170,7,37,0,
+3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,
+63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,
+119,0,123,0,127,0,131,0,135,0,139,0,143,0,147,0,151,0,155,0,159,0,163,0,167,
+0,0,19,51,21,35,37,51,21,35,37,51,21,35,5,51,21,35,37,51,21,35,37,51,21,35,
+7,51,21,35,37,51,21,35,37,51,21,35,5,51,21,35,37,51,21,35,37,51,21,35,7,51,
+21,35,37,51,21,35,37,51,21,35,23,51,21,35,37,51,21,35,37,51,21,35,7,51,21,
+35,37,51,21,35,37,51,21,35,5,51,21,35,37,51,21,35,37,51,21,35,7,51,21,35,
+37,51,21,35,37,51,21,35,23,51,21,35,37,51,21,35,37,51,21,35,1,51,21,35,37,
+51,21,35,37,51,21,35,1,51,21,35,37,51,21,35,37,51,21,35,1,51,21,35,17,51,
+21,35,17,51,21,35,17,51,21,35,17,51,21,35,17,51,21,35,102,105,105,1,158,105,
+105,1,162,102,102,253,143,105,105,1,160,104,104,1,160,102,102,207,102,102,
+254,94,105,105,254,98,105,105,4,15,102,102,254,96,104,104,254,96,105,105,
+207,105,105,1,158,105,105,1,162,102,102,207,102,102,254,96,104,104,254,96,
+105,105,207,105,105,1,158,105,105,1,162,102,102,253,143,105,105,1,160,104,
+104,1,160,102,102,207,102,102,254,94,105,105,254,98,105,105,207,105,105,1,
+160,104,104,1,160,102,102,252,192,105,105,1,160,104,104,1,160,102,102,251,
+241,105,105,1,158,105,105,1,162,102,102,1,158,102,102,102,102,102,102,102,
+102,102,102,102,102,5,164,98,98,98,98,98,99,94,94,94,94,94,96,96,96,96,96,
+96,101,94,94,94,94,94,96,97,97,97,97,97,100,94,94,94,94,94,96,99,99,99,99,
+99,98,92,92,92,92,92,98,99,99,99,99,99,94,96,96,96,96,96,7,235,98,98,98,98,
+98,1,37,96,96,96,96,96,254,223,98,254,223,96,254,221,97,254,222,99,254,224,
+99,7,240,96,0,84,0,0,254,119,5,170,7,37,0,3,0,7,0,11,0,15,0,19,0,23,0,27,
+0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,
+0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,119,0,123,0,127,0,131,0,135,0,139,
+0,143,0,147,0,151,0,155,0,159,0,163,0,167,0,171,0,175,0,179,0,183,0,187,0,
+191,0,195,0,199,0,203,0,207,0,211,0,215,0,219,0,223,0,227,0,231,0,235,0,239,
+0,243,0,247,0,251,0,255,1,3,1,7,1,11,1,15,1,19,1,23,1,27,1,31,1,35,1,39,1,
+43,1,47,1,51,1,55,1,59,1,63,1,67,1,71,1,75,1,79,0,0,19,51,21,35,55,51,21,
+35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,
+55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,
+51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,51,
+21,35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,51,21,
+35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,37,51,21,35,55,51,21,35,
+55,51,21,35,55,51,21,35,37,51,21,35,5,51,21,35,39,51,21,35,39,51,21,35,39,
+51,21,35,39,51,21,35,39,51,21,35,7,51,21,35,55,51,21,35,55,51,21,35,55,51,
+21,35,55,51,21,35,55,51,21,35,23,51,21,35,39,51,21,35,39,51,21,35,39,51,21,
+35,39,51,21,35,39,51,21,35,7,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,
+55,51,21,35,55,51,21,35,1,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,
+51,21,35,55,51,21,35,1,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,
+21,35,55,51,21,35,19,51,21,35,7,51,21,35,23,51,21,35,7,51,21,35,23,51,21,
+35,7,51,21,35,23,51,21,35,7,51,21,35,23,51,21,35,7,51,21,35,17,51,21,35,19,
+51,21,35,102,105,105,207,105,105,207,105,105,209,104,104,209,102,102,207,
+102,102,251,139,102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,
+105,105,252,90,105,105,207,105,105,207,105,105,209,104,104,209,102,102,207,
+102,102,251,139,102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,
+105,105,252,90,105,105,207,105,105,207,105,105,209,104,104,209,102,102,207,
+102,102,251,139,102,102,1,158,102,102,207,104,104,208,105,105,207,105,105,
+252,195,102,102,3,166,102,102,207,102,102,209,104,104,209,105,105,207,105,
+105,207,105,105,102,102,102,207,102,102,207,102,102,207,104,104,208,105,105,
+207,105,105,105,102,102,207,102,102,209,104,104,209,105,105,207,105,105,207,
+105,105,102,102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,105,
+105,251,244,102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,105,
+105,252,90,105,105,207,105,105,207,105,105,209,104,104,209,102,102,207,102,
+102,207,102,102,105,105,105,105,102,102,105,105,105,105,102,102,105,105,105,
+105,102,102,105,105,105,105,102,102,105,105,105,105,105,105,102,102,5,164,
+98,98,98,98,98,98,98,98,98,98,98,99,94,94,94,94,94,94,94,94,94,94,94,96,96,
+96,96,96,96,96,96,96,96,96,96,101,94,94,94,94,94,94,94,94,94,94,94,96,97,
+97,97,97,97,97,97,97,97,97,97,100,94,94,94,94,94,94,94,94,94,94,94,96,99,
+99,99,99,99,99,99,99,99,99,99,98,92,92,92,92,92,92,92,92,92,92,92,98,99,99,
+99,99,99,99,99,99,99,99,99,94,96,96,96,96,96,96,96,96,96,96,96,7,235,98,98,
+98,98,98,98,98,98,98,98,98,1,37,96,96,96,96,96,96,96,96,96,96,96,254,223,
+98,99,94,96,96,101,94,96,97,100,94,96,99,98,92,98,99,94,96,7,235,98,1,37,
+96,0,67,0,0,254,20,5,213,7,37,0,73,0,77,0,81,0,85,0,89,0,93,0,97,0,101,0,
+105,0,109,0,113,0,117,0,121,0,125,0,129,0,133,0,137,0,141,0,145,0,149,0,153,
+0,157,0,161,0,165,0,169,0,173,0,177,0,181,0,185,0,189,0,193,0,197,0,201,0,
+205,0,209,0,213,0,217,0,221,0,225,0,229,0,233,0,237,0,241,0,245,0,249,0,253,
+1,1,1,5,1,9,1,13,1,17,1,21,1,25,1,29,1,33,1,37,1,41,1,45,1,49,1,53,1,57,1,
+61,1,65,1,69,1,73,1,77,1,81,0,0,1,33,17,51,53,35,17,51,53,35,17,51,53,35,
+17,51,53,35,17,51,53,35,17,51,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,
+51,53,51,21,51,53,51,21,51,53,51,21,35,21,51,17,35,21,51,17,35,21,51,17,35,
+21,51,17,35,21,51,17,35,21,51,1,21,51,53,51,21,51,53,51,21,51,53,51,21,51,
+53,23,35,21,51,39,35,21,51,39,35,21,51,39,35,21,51,7,21,51,53,51,21,51,53,
+51,21,51,53,51,21,51,53,5,35,21,51,55,21,51,53,51,21,51,53,51,21,51,53,5,
+21,51,53,33,21,51,53,7,53,35,21,37,21,51,53,19,53,35,21,35,53,35,21,35,53,
+35,21,35,53,35,21,7,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,19,53,35,
+21,35,53,35,21,35,53,35,21,35,53,35,21,7,21,51,53,51,21,51,53,51,21,51,53,
+51,21,51,53,19,35,21,51,39,35,21,51,39,35,21,51,39,35,21,51,1,35,21,51,39,
+35,21,51,39,35,21,51,39,35,21,51,1,21,51,53,51,21,51,53,23,35,21,51,39,35,
+21,51,7,21,51,53,51,21,51,53,7,35,21,51,55,21,51,53,5,21,51,53,23,53,35,21,
+23,53,35,21,35,53,35,21,7,21,51,53,51,21,51,53,19,53,35,21,35,53,35,21,7,
+21,51,53,51,21,51,53,19,35,21,51,39,35,21,51,19,35,21,51,39,35,21,51,5,213,
+250,43,106,106,106,106,106,106,106,106,106,106,106,107,106,107,106,107,106,
+109,107,106,107,106,106,107,107,107,107,107,107,107,107,107,107,107,107,107,
+250,149,107,106,107,106,107,106,109,107,107,107,216,106,106,213,106,106,213,
+106,106,213,107,106,107,106,107,106,109,253,233,106,106,107,106,107,106,109,
+107,252,169,107,1,63,107,213,107,1,170,109,107,107,109,106,107,106,107,106,
+107,107,106,107,106,107,106,109,107,107,109,106,107,106,107,106,107,107,106,
+107,106,107,106,109,107,107,107,216,106,106,213,106,106,213,106,106,2,23,
+109,109,215,107,107,213,107,107,213,107,107,2,236,106,107,106,106,106,106,
+212,107,107,213,106,107,106,106,107,107,106,106,254,87,106,213,106,212,106,
+106,107,106,106,107,106,106,106,106,107,106,106,107,106,106,106,106,212,107,
+107,106,106,106,213,106,106,254,20,1,33,99,1,32,99,1,34,97,1,32,99,1,33,98,
+1,33,96,96,96,96,96,96,96,96,96,96,96,96,96,195,98,254,223,94,254,219,94,
+254,219,94,254,219,92,254,221,96,6,104,94,94,94,94,94,94,94,94,190,99,99,
+99,99,99,99,99,98,94,94,94,94,94,94,94,94,190,97,97,97,97,97,97,97,97,197,
+94,94,94,94,94,94,94,94,94,94,254,223,99,99,99,99,99,99,99,99,98,92,92,92,
+92,92,92,92,92,254,223,99,99,99,99,99,99,99,99,94,96,96,96,96,96,96,96,96,
+6,205,98,98,98,98,98,98,98,1,32,98,98,98,98,98,98,98,254,223,94,94,94,94,
+190,99,99,99,98,94,94,94,94,190,97,97,97,97,197,94,94,94,94,94,195,99,99,
+99,99,98,92,92,92,92,254,223,99,99,99,99,94,96,96,96,96,6,205,98,98,98,1,
+32,98,98,98,0,1,0,123,0,246,4,90,4,213,0,3,0,0,19,33,17,33,123,3,223,252,
+33,4,213,252,33,0,2,0,6,0,0,4,207,4,201,0,3,0,7,0,0,19,33,17,33,19,17,33,
+17,6,4,201,251,55,76,4,49,4,201,251,55,4,125,251,207,4,49,0,1,0,109,1,127,
+2,104,3,123,0,3,0,0,1,33,17,33,2,104,254,5,1,251,1,127,1,252,0,2,0,109,1,
+127,2,104,3,123,0,3,0,7,0,0,1,33,17,33,3,17,33,17,2,104,254,5,1,251,75,254,
+155,1,127,1,252,254,80,1,98,254,158,0,1,0,0,0,129,8,0,2,233,0,3,0,0,17,33,
+17,33,8,0,248,0,2,233,253,152,0,1,1,158,0,0,6,76,4,174,0,2,0,0,33,1,1,1,158,
+2,88,2,86,4,174,251,82,0,1,1,145,255,229,6,90,4,172,0,2,0,0,9,2,1,145,4,201,
+251,55,4,172,253,158,253,155,0,1,1,158,255,229,6,76,4,147,0,2,0,0,9,2,6,76,
+253,170,253,168,4,147,251,82,4,174,0,1,1,145,255,229,6,90,4,172,0,2,0,0,1,
+17,1,6,90,251,55,4,172,251,57,2,101,0,2,0,168,0,162,4,45,4,41,0,15,0,31,0,
+0,19,52,54,54,51,50,22,22,21,20,6,6,35,34,38,38,55,20,22,22,51,50,54,54,53,
+52,38,38,35,34,6,6,168,119,209,120,123,209,121,121,209,123,120,209,119,86,
+96,168,98,99,170,98,96,172,99,96,170,96,2,100,121,211,121,121,211,121,120,
+209,121,121,206,123,98,170,96,96,170,98,99,170,98,98,168,0,16,0,98,0,86,4,
+94,4,82,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,
+0,111,0,119,0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,
+35,34,53,52,51,50,23,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,
+34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,
+52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,
+50,1,20,35,34,53,52,51,50,37,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,
+39,20,35,34,53,52,51,50,3,215,51,55,55,51,147,52,57,57,52,247,55,53,55,53,
+35,51,55,55,51,254,56,54,53,53,54,173,55,53,53,55,2,82,55,53,53,55,253,27,
+55,54,54,55,2,129,51,55,55,51,147,52,57,57,52,253,174,52,57,55,54,35,53,56,
+56,53,1,199,54,53,53,54,254,92,54,55,55,54,247,55,53,53,55,147,55,54,54,55,
+3,150,54,54,55,43,53,53,55,254,211,55,55,53,227,53,53,53,1,148,56,56,53,90,
+53,53,55,253,119,53,53,55,1,185,54,51,58,253,67,53,53,56,154,51,51,55,2,29,
+55,55,53,227,53,53,53,254,4,55,55,54,227,53,53,55,254,213,55,51,55,43,53,
+53,56,0,1,0,178,0,137,4,35,3,250,0,13,0,0,1,50,22,22,21,20,0,35,34,0,53,52,
+54,54,2,106,109,217,115,254,254,183,182,254,254,111,215,3,250,117,217,106,
+183,254,254,1,2,183,108,213,119,0,2,0,41,0,0,4,172,4,131,0,3,0,19,0,0,51,
+17,33,17,1,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,41,4,131,252,4,119,
+203,118,117,205,119,119,203,119,118,205,117,4,131,251,125,2,66,119,203,119,
+119,205,117,116,205,119,119,205,0,3,0,41,0,0,4,172,4,131,0,3,0,19,0,35,0,
+0,51,17,33,17,1,52,54,54,51,50,22,22,21,20,6,6,35,34,38,38,39,20,22,22,51,
+50,54,54,53,52,38,38,35,34,6,6,41,4,131,252,82,96,170,98,97,170,98,98,170,
+97,98,170,96,78,119,203,118,117,205,119,119,203,119,118,205,117,4,131,251,
+125,2,66,96,170,98,98,170,96,99,170,96,96,170,99,119,203,119,119,205,117,
+116,205,119,119,205,0,2,0,115,1,133,2,98,3,117,0,12,0,24,0,0,1,20,6,35,34,
+38,53,52,54,51,50,23,22,7,52,38,35,34,6,21,20,22,51,50,54,2,98,149,99,102,
+145,147,100,105,70,73,75,103,70,69,103,99,73,78,95,2,125,107,141,144,104,
+102,146,74,72,102,70,102,102,70,72,100,104,0,5,1,176,255,229,6,121,4,172,
+0,11,0,24,0,36,0,48,0,58,0,0,1,20,0,35,34,0,39,52,0,33,32,0,7,52,0,35,34,
+7,6,21,20,0,51,50,0,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,
+52,54,51,50,22,1,22,51,50,55,23,6,35,34,39,6,121,254,151,252,251,254,153,
+2,1,98,1,2,1,3,1,98,90,254,207,218,217,151,154,1,51,215,218,1,49,253,90,45,
+33,33,45,45,33,33,45,1,211,43,33,33,47,47,33,33,43,253,233,76,147,146,76,
+61,96,187,184,98,2,72,254,254,155,1,103,252,250,1,106,254,150,250,217,1,51,
+154,153,217,215,254,204,1,52,1,86,31,47,47,31,32,45,45,32,31,47,47,31,32,
+45,45,254,191,137,137,35,186,186,0,4,1,209,255,229,6,154,4,172,0,11,0,23,
+0,35,0,45,0,0,1,20,0,35,34,0,39,52,0,33,32,0,5,52,38,35,34,6,21,20,22,51,
+50,54,37,52,38,35,34,6,21,20,22,51,50,54,1,22,51,50,55,39,6,35,34,39,6,154,
+254,151,252,254,254,156,2,1,98,1,2,1,2,1,99,253,0,48,30,33,45,45,33,30,48,
+1,211,46,30,33,47,47,33,30,46,253,174,98,184,185,98,62,75,146,147,76,2,72,
+254,254,155,1,103,252,250,1,106,254,150,123,32,45,45,32,31,47,47,31,32,45,
+45,32,31,47,47,254,219,186,186,35,137,137,0,2,1,70,255,115,6,14,4,59,0,41,
+0,53,0,0,1,51,21,22,22,23,55,23,7,22,23,51,21,35,6,7,23,7,39,6,6,7,21,35,
+53,38,39,7,39,55,38,39,35,53,51,54,55,39,55,23,54,55,23,34,6,21,20,22,51,
+50,54,53,52,38,3,137,66,65,101,59,186,45,184,86,6,215,215,16,76,184,49,182,
+50,87,88,66,121,100,188,43,182,78,16,215,215,12,80,180,41,188,111,112,31,
+139,193,195,137,139,195,197,4,59,217,6,39,45,182,45,184,113,116,62,125,96,
+188,43,182,37,42,13,217,217,16,74,180,45,184,100,125,62,129,94,184,49,182,
+78,12,61,199,135,135,197,197,135,135,199,0,2,1,217,0,80,4,39,4,129,0,23,0,
+36,0,0,1,38,38,53,52,54,51,50,23,22,21,20,6,7,21,33,21,33,17,35,17,33,53,
+33,19,34,6,21,20,22,51,50,55,54,53,52,38,2,219,113,137,174,113,119,84,86,
+146,104,1,0,255,0,76,254,254,1,2,37,88,119,123,84,86,59,62,119,2,66,18,162,
+104,125,166,86,84,121,108,162,14,166,70,254,250,1,6,70,2,145,120,85,86,121,
+62,61,84,86,119,0,2,1,82,0,250,4,174,4,129,0,44,0,56,0,0,1,38,39,38,53,52,
+55,54,51,23,22,51,50,55,54,51,50,21,7,6,21,20,23,23,20,7,7,34,38,38,39,7,
+22,21,20,6,35,34,38,53,52,54,51,50,23,7,34,6,21,20,22,51,50,54,53,52,38,4,
+0,147,43,9,6,7,8,33,67,60,88,41,34,15,14,4,16,12,4,4,14,21,37,35,14,235,84,
+177,114,117,172,168,123,69,84,153,90,123,125,88,88,123,125,4,0,43,43,4,14,
+9,8,4,4,17,13,12,14,27,59,99,77,52,32,9,6,6,66,90,49,238,82,108,125,174,164,
+121,120,170,43,32,121,90,95,118,125,88,88,123,0,1,0,59,0,0,4,4,4,207,0,33,
+0,0,1,22,22,23,22,22,23,20,6,35,34,39,30,2,23,23,33,55,50,54,54,53,53,6,35,
+34,38,53,52,54,55,54,54,2,33,24,97,149,141,70,2,129,88,156,100,4,80,162,133,
+6,252,234,6,123,172,88,90,170,91,129,88,101,137,133,4,207,96,168,140,127,
+131,71,97,127,191,160,166,94,8,37,37,96,172,146,14,191,127,93,90,135,82,119,
+186,0,1,0,59,0,0,5,4,4,199,0,51,0,0,33,33,55,62,3,53,39,6,6,35,34,38,53,52,
+54,55,50,23,38,39,38,53,52,54,51,50,22,21,20,7,54,55,54,51,50,23,22,21,20,
+6,35,34,38,38,39,30,3,23,4,70,252,182,8,135,119,94,54,3,57,176,90,115,162,
+148,92,61,101,37,18,11,162,113,116,160,69,84,16,22,39,105,67,74,156,116,56,
+118,95,61,4,49,111,127,112,35,26,56,119,149,76,47,121,117,157,122,115,157,
+2,51,66,39,36,39,121,150,160,107,86,98,39,4,8,78,75,117,117,164,50,81,105,
+125,154,120,54,20,0,1,0,102,255,233,4,90,4,121,0,24,0,0,5,38,38,39,39,38,
+38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,7,6,6,2,98,22,90,176,91,75,
+54,140,100,86,143,39,33,143,88,97,143,88,111,141,129,23,86,183,235,123,101,
+129,65,107,137,115,119,119,117,135,99,86,190,137,179,213,0,1,0,66,255,231,
+3,211,4,199,0,11,0,0,1,22,0,23,6,0,7,38,0,39,54,0,2,6,74,1,8,123,70,254,207,
+84,43,254,250,149,116,1,2,4,199,125,254,151,137,70,254,105,148,82,1,109,178,
+137,1,88,0,1,0,197,0,29,3,59,4,129,0,25,0,0,1,51,21,23,22,21,20,7,35,54,53,
+52,38,39,17,20,6,35,34,38,53,52,54,51,50,23,1,233,76,154,108,94,47,57,114,
+64,147,107,57,57,125,77,43,47,4,129,100,193,147,170,150,121,127,121,119,160,
+10,254,6,123,151,55,45,78,115,19,0,2,1,16,255,213,4,240,4,135,0,26,0,30,0,
+0,1,20,6,35,34,53,52,54,51,50,23,17,5,17,20,6,35,34,38,53,52,54,51,50,23,
+17,37,1,37,53,5,4,240,155,95,115,123,78,47,43,253,217,137,115,57,58,119,74,
+54,46,2,187,253,143,2,39,253,217,1,68,127,148,101,81,111,18,1,192,149,254,
+118,116,156,53,45,76,117,19,2,240,178,254,103,149,117,152,0,2,0,102,255,55,
+4,2,5,205,0,27,0,31,0,0,1,7,17,35,17,5,17,35,17,7,53,55,17,7,53,55,17,51,
+17,37,17,51,17,55,21,7,17,55,5,17,5,17,4,2,201,96,254,182,96,201,201,201,
+201,96,1,74,96,201,201,201,254,215,254,182,1,188,88,254,156,1,61,159,254,
+153,1,64,96,159,94,1,246,96,160,96,1,70,254,225,160,1,92,254,203,94,158,96,
+254,10,90,129,1,246,160,254,10,0,1,0,20,0,0,3,254,5,182,0,21,0,0,19,51,53,
+35,53,51,17,51,17,33,21,33,21,33,21,33,17,33,21,33,17,35,20,179,179,179,184,
+1,92,254,164,1,92,254,164,2,127,252,201,179,2,88,182,146,2,22,253,234,146,
+182,145,254,221,164,1,199,0,1,0,20,0,0,1,252,6,20,0,19,0,0,1,51,21,35,17,
+35,17,35,53,51,53,35,53,51,17,51,17,51,21,35,1,98,154,154,180,154,154,154,
+154,180,154,154,2,141,145,254,4,1,252,145,183,145,2,63,253,193,145,0,1,255,
+250,0,0,3,254,5,182,0,29,0,0,1,34,39,17,33,21,33,17,38,35,34,6,7,35,54,54,
+51,50,23,17,51,17,22,51,50,54,55,51,6,6,1,217,31,18,2,86,252,242,24,19,44,
+42,13,104,11,100,85,15,35,184,23,22,42,42,14,103,11,100,2,78,8,254,78,164,
+2,184,11,59,60,122,140,8,2,108,253,49,10,59,60,120,142,0,2,0,20,0,0,4,111,
+5,182,0,13,0,26,0,0,1,20,4,33,35,17,35,17,35,53,51,17,33,32,1,33,21,33,21,
+51,50,54,53,52,38,35,35,4,111,254,206,254,234,168,184,179,179,1,131,2,37,
+253,16,1,43,254,213,147,218,196,182,193,186,4,8,224,239,253,199,3,168,160,
+1,110,254,146,160,209,141,156,141,140,0,2,0,199,254,20,4,219,5,182,0,8,0,
+30,0,0,1,51,50,54,53,52,38,35,35,17,20,22,51,50,55,21,6,35,32,17,17,33,32,
+4,21,16,5,1,35,1,33,1,127,219,178,164,166,186,209,58,71,50,42,49,66,254,222,
+1,147,1,16,1,5,254,219,1,145,215,254,158,254,221,2,248,140,138,138,127,250,
+71,87,81,21,156,27,1,66,6,96,207,208,254,221,101,253,113,2,92,0,4,0,94,254,
+86,3,215,6,20,0,32,0,40,0,46,0,51,0,0,33,39,35,6,6,35,3,35,19,38,38,53,16,
+37,19,39,35,34,6,7,39,54,54,51,50,23,19,51,3,22,22,21,17,1,35,7,3,54,54,53,
+53,5,20,23,19,6,6,1,52,39,3,55,3,84,35,8,82,163,124,127,137,133,107,108,1,
+164,102,18,18,87,155,68,55,83,196,96,38,34,139,137,150,100,95,254,172,15,
+14,127,150,168,253,244,77,113,94,96,2,14,68,86,154,156,103,73,254,106,1,168,
+31,160,116,1,43,43,1,66,2,52,32,135,44,50,4,1,188,254,41,37,164,136,253,20,
+2,18,2,254,109,2,166,145,99,234,107,44,1,102,21,99,1,81,138,59,254,243,7,
+0,2,0,33,254,86,3,70,6,20,0,29,0,32,0,0,37,50,54,55,21,6,6,35,34,39,3,35,
+19,38,53,17,35,53,55,55,51,21,51,19,51,3,21,35,3,22,3,19,35,2,29,35,94,24,
+25,105,54,95,65,137,137,166,54,155,157,72,107,186,145,138,152,37,243,44,81,
+143,143,127,14,9,138,11,21,28,254,78,2,14,81,138,2,127,86,72,234,252,1,202,
+254,31,117,252,252,59,1,121,1,198,255,255,0,199,254,127,5,213,5,182,18,6,
+2,168,0,0,0,1,0,174,254,131,4,238,6,20,0,26,0,0,37,17,35,17,35,17,52,38,35,
+34,6,21,17,35,17,51,17,20,7,51,54,54,51,50,22,21,17,4,238,179,161,119,127,
+167,155,180,180,10,12,49,180,113,200,202,152,253,235,1,125,2,190,134,131,
+186,214,253,201,6,20,254,56,90,64,80,90,191,210,253,205,0,1,0,199,254,127,
+5,23,5,182,0,16,0,0,33,1,7,17,35,17,51,17,55,1,51,1,1,51,17,35,17,4,27,253,
+249,149,184,184,126,2,9,215,253,189,1,225,156,177,2,186,131,253,201,5,182,
+253,47,139,2,70,253,131,253,107,253,219,1,129,0,1,0,174,254,131,4,96,6,20,
+0,19,0,0,33,1,7,17,35,17,51,17,7,51,55,55,1,51,1,1,51,17,35,17,3,90,254,131,
+125,178,178,8,8,61,70,1,95,210,254,68,1,102,162,178,2,0,109,254,109,6,20,
+252,211,178,78,84,1,115,254,43,254,35,253,235,1,125,0,1,0,78,254,127,4,68,
+5,182,0,11,0,0,51,53,1,33,53,33,21,1,33,17,35,17,78,3,2,253,22,3,201,252,
+254,3,23,177,139,4,135,164,139,251,121,253,219,1,129,0,1,0,80,254,131,3,115,
+4,74,0,11,0,0,51,53,1,33,53,33,21,1,33,17,35,17,80,2,78,253,213,2,241,253,
+187,2,84,178,119,3,71,140,135,252,200,253,248,1,125,0,2,0,125,255,236,5,90,
+5,203,0,14,0,34,0,0,1,34,2,17,16,18,51,50,54,54,53,17,52,38,38,39,50,22,23,
+51,55,51,17,35,39,35,6,6,35,34,36,2,53,16,0,2,227,199,223,222,202,158,196,
+91,92,198,153,144,238,59,10,31,145,145,31,10,57,229,165,187,254,236,145,1,
+71,5,43,254,201,254,231,254,235,254,197,92,182,160,1,60,161,182,91,160,110,
+99,188,250,74,188,96,112,182,1,86,229,1,97,1,141,0,1,0,0,0,0,4,49,4,94,0,
+24,0,0,1,50,23,21,38,35,34,6,7,1,35,1,51,19,30,3,23,51,54,55,19,54,54,3,188,
+67,50,37,24,35,48,20,254,215,206,254,106,193,223,11,27,25,20,5,8,11,52,185,
+30,90,4,94,24,133,10,54,57,252,164,4,74,253,121,34,81,79,72,25,56,162,2,62,
+93,73,0,1,0,25,0,0,7,168,5,195,0,35,0,0,33,35,1,38,39,6,7,1,35,1,51,19,22,
+23,54,55,1,51,1,22,23,54,55,19,54,54,51,50,23,21,38,35,34,6,6,7,5,199,187,
+254,238,63,11,16,54,254,236,186,254,125,192,227,46,24,22,56,1,2,190,1,2,54,
+26,19,53,178,27,114,97,58,36,24,35,37,39,29,10,3,190,214,75,115,180,252,72,
+5,182,252,131,175,173,164,195,3,114,252,135,186,166,144,206,2,199,103,90,
+17,147,10,21,44,39,0,1,0,23,0,0,6,123,4,94,0,40,0,0,33,35,3,38,39,35,6,7,
+3,35,1,51,18,18,23,51,55,54,55,19,51,19,30,3,23,51,54,55,19,54,54,51,50,23,
+21,38,35,34,7,5,2,211,188,26,50,8,42,32,197,204,254,211,186,104,109,10,8,
+14,31,29,195,196,189,10,23,20,16,4,9,8,59,103,18,96,82,67,50,37,25,76,26,
+2,106,77,214,195,98,253,152,4,74,254,107,254,90,87,62,143,90,2,107,253,149,
+35,79,77,73,29,71,255,1,184,84,82,24,133,10,111,0,2,0,20,0,0,4,16,4,104,0,
+10,0,36,0,0,1,20,22,23,54,53,52,38,35,34,6,3,6,35,53,50,55,38,53,52,54,51,
+50,22,21,20,6,7,18,23,51,54,55,19,51,1,35,1,25,19,30,131,50,40,39,51,62,79,
+120,107,41,51,142,114,113,139,127,119,100,25,8,17,75,244,192,254,84,206,3,
+127,39,87,79,64,135,43,57,57,254,84,15,150,6,144,90,112,137,128,105,116,178,
+52,254,246,123,84,207,2,135,251,182,0,1,0,199,0,0,3,242,5,182,0,7,0,0,1,33,
+17,35,17,51,17,33,3,242,253,141,184,184,2,115,2,170,253,86,5,182,253,150,
+0,1,0,174,0,0,3,121,4,74,0,7,0,0,1,33,17,35,17,51,17,33,3,121,253,233,180,
+180,2,23,1,233,254,23,4,74,254,55,0,2,0,113,255,236,5,92,4,94,0,19,0,29,0,
+0,5,32,17,16,55,23,6,6,21,16,5,17,52,54,51,50,18,21,16,0,19,52,38,35,34,6,
+21,17,54,54,2,215,253,154,209,139,89,79,1,94,170,154,185,220,254,172,158,
+120,101,71,79,176,195,20,2,63,1,42,255,96,117,223,123,254,131,35,2,94,182,
+197,254,218,249,254,228,254,201,2,81,184,212,114,114,253,160,16,230,0,2,0,
+33,0,152,2,147,3,236,0,3,0,7,0,0,1,23,1,39,37,23,1,39,2,74,73,253,215,73,
+2,41,73,253,215,73,3,236,109,254,133,109,14,109,254,134,108,0,2,255,147,5,
+33,1,104,7,96,0,3,0,15,0,0,19,17,51,17,1,52,54,51,50,22,21,20,6,35,34,38,
+211,149,254,43,63,44,43,63,58,48,44,63,5,33,2,63,253,193,1,35,59,55,55,59,
+54,61,56,0,2,255,147,4,123,1,203,6,182,0,3,0,15,0,0,3,1,23,1,3,52,54,51,50,
+22,21,20,6,35,34,38,53,1,151,105,254,106,162,63,44,43,63,58,48,44,63,4,227,
+1,152,105,254,105,1,201,59,55,55,59,54,61,56,0,2,254,223,4,217,1,31,6,182,
+0,3,0,15,0,0,1,33,21,33,19,52,54,51,50,22,21,20,6,35,34,38,254,223,2,64,253,
+192,180,63,44,43,63,58,48,44,63,5,111,150,1,107,59,55,55,59,54,61,56,0,1,
+254,240,4,195,1,16,6,23,0,5,0,0,1,53,33,53,51,17,254,240,1,180,108,4,195,
+108,232,254,172,0,1,0,143,4,172,3,84,7,59,0,6,0,0,1,1,33,17,35,17,33,1,242,
+1,98,254,235,155,254,235,7,59,254,123,254,246,1,10,0,1,0,143,4,143,3,84,7,
+31,0,6,0,0,1,1,33,17,51,17,33,1,242,254,157,1,21,155,1,21,4,143,1,133,1,11,
+254,245,0,2,0,147,2,160,1,145,6,244,0,3,0,15,0,0,1,35,3,51,3,52,54,51,50,
+22,21,20,6,35,34,38,1,78,117,51,219,238,65,62,62,65,66,61,61,66,4,88,2,156,
+252,55,66,71,73,64,63,76,74,0,2,0,147,2,180,1,145,7,8,0,3,0,15,0,0,19,51,
+19,35,19,20,6,35,34,38,53,52,54,51,50,22,215,117,51,219,237,67,60,60,67,68,
+59,54,73,5,80,253,100,3,201,70,67,72,65,64,75,66,0,2,0,147,1,88,1,145,5,203,
+0,3,0,15,0,0,19,51,19,35,19,20,6,35,34,38,53,52,54,51,50,22,215,117,51,219,
+237,67,60,60,67,68,59,54,73,4,18,253,70,3,231,70,67,72,65,65,75,66,0,1,254,
+240,4,195,1,16,6,23,0,9,0,0,1,21,35,21,35,53,35,21,35,17,1,16,190,109,137,
+108,6,23,109,231,231,231,1,84,0,1,254,240,0,0,1,16,1,84,0,9,0,0,33,53,51,
+53,51,21,51,53,51,17,254,240,190,109,137,108,109,231,231,231,254,172,255,
+255,0,249,254,83,3,173,255,155,16,7,1,75,255,245,249,122,0,2,0,147,0,176,
+1,145,4,102,0,11,0,23,0,0,19,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,
+50,22,21,20,6,35,34,38,147,65,60,61,68,68,61,59,66,63,62,63,66,68,61,59,66,
+1,59,66,72,72,66,64,75,74,2,225,66,73,72,67,64,75,74,0,2,0,102,1,117,3,45,
+3,160,0,3,0,7,0,0,1,21,33,53,17,53,33,21,3,45,253,57,2,199,2,6,145,145,1,
+8,146,146,0,1,0,166,1,156,1,129,5,182,0,3,0,0,1,35,3,51,1,78,117,51,219,1,
+156,4,26,0,1,0,166,3,53,1,129,5,182,0,3,0,0,1,35,3,51,1,78,117,51,219,3,53,
+2,129,0,3,254,223,4,207,1,45,6,248,0,11,0,23,0,31,0,0,1,20,6,35,34,38,53,
+52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,39,54,55,51,21,6,7,35,1,
+31,51,46,46,50,58,38,41,56,254,127,56,39,46,50,58,38,39,56,13,149,48,215,
+57,234,121,5,51,48,52,54,46,53,50,50,53,53,47,54,46,53,50,50,127,173,100,
+21,89,187,0,3,254,211,4,207,1,31,6,248,0,11,0,23,0,31,0,0,1,20,6,35,34,38,
+53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,55,35,38,39,53,51,22,
+23,1,31,51,46,46,50,58,38,41,56,254,127,56,39,46,50,58,38,39,56,209,121,234,
+57,215,48,149,5,51,48,52,54,46,53,50,50,53,53,47,54,46,53,50,50,103,187,89,
+21,100,173,255,255,0,43,254,20,4,196,5,182,16,71,2,42,5,12,0,0,192,0,64,0,
+0,1,252,229,4,178,0,10,6,51,0,9,0,0,19,35,34,4,7,35,54,36,33,51,10,10,235,
+254,174,78,144,96,1,153,1,34,10,5,160,122,116,189,196,0,1,255,246,4,178,3,
+27,6,51,0,9,0,0,3,51,32,4,23,35,38,36,35,35,10,10,1,35,1,150,98,144,79,254,
+175,235,10,6,51,196,189,116,122,0,1,252,236,4,219,0,0,5,225,0,11,0,0,17,38,
+38,35,34,7,35,18,33,50,22,23,181,170,79,223,31,104,46,1,60,116,207,103,5,
+27,39,22,125,1,6,38,23,0,1,0,0,4,221,3,20,5,227,0,10,0,0,17,22,22,51,50,55,
+51,2,33,34,37,103,210,117,223,31,104,46,254,198,164,254,248,5,164,23,39,125,
+254,250,62,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,
+3,182,135,254,164,254,205,1,100,1,43,135,3,158,1,92,135,254,213,1,43,0,1,
+0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,143,
+254,226,1,100,1,43,135,2,213,2,37,135,254,70,1,186,0,1,0,160,0,0,3,182,5,
+129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,133,254,236,1,110,1,
+33,135,1,160,3,90,135,253,90,2,166,0,1,0,160,0,0,3,182,5,129,0,8,0,0,33,35,
+1,33,53,33,1,17,51,3,182,135,254,127,254,242,1,110,1,33,135,4,250,135,252,
+68,3,188,0,1,0,78,0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,1,1,51,3,182,135,
+254,184,254,103,92,1,61,1,72,135,4,199,254,204,1,134,96,254,213,1,51,0,1,
+0,82,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,55,1,33,17,51,3,182,135,254,148,
+254,143,98,1,72,1,51,135,3,168,1,111,96,254,184,1,82,0,1,0,78,0,0,3,182,5,
+129,0,7,0,0,33,35,17,1,55,1,17,51,3,182,135,253,31,94,2,131,135,2,74,2,205,
+94,253,153,2,115,0,1,0,78,0,0,3,182,5,129,0,9,0,0,33,35,53,1,1,55,1,19,17,
+51,3,182,135,254,184,254,103,82,1,180,219,135,236,2,165,1,134,106,254,104,
+254,48,3,104,0,1,0,70,0,0,3,182,5,129,0,8,0,0,33,35,1,1,55,1,19,17,51,3,182,
+135,254,166,254,113,90,1,174,225,135,3,162,1,121,102,254,107,253,155,3,250,
+0,1,0,70,0,0,2,113,5,129,0,7,0,0,33,35,17,1,55,1,17,51,2,113,138,254,95,90,
+1,71,138,3,158,1,127,100,254,215,1,41,0,1,0,53,0,0,3,182,5,129,0,8,0,0,33,
+35,17,1,1,55,1,1,51,3,182,135,254,180,254,82,107,1,71,1,72,135,4,121,253,
+215,2,227,78,253,223,2,33,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,
+1,1,17,51,3,182,135,254,180,254,82,107,1,96,1,47,135,3,162,254,176,2,227,
+76,253,178,1,45,1,33,0,1,0,80,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,55,1,
+33,17,51,3,182,135,254,168,254,121,115,1,100,1,8,135,2,156,2,157,72,253,162,
+2,94,0,1,0,45,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,23,17,51,3,182,135,
+254,158,254,96,119,1,147,248,135,1,14,1,99,2,202,70,253,70,248,3,178,0,1,
+0,72,0,0,3,182,5,129,0,6,0,0,33,35,1,55,1,17,51,3,182,135,253,25,118,2,113,
+135,5,61,68,251,154,4,102,0,1,0,45,0,0,2,113,5,129,0,7,0,0,33,35,17,1,55,
+1,17,51,2,113,138,254,70,115,1,71,138,2,86,2,227,72,253,223,2,33,0,1,0,37,
+0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,1,1,51,3,182,135,254,184,254,62,123,
+1,71,1,72,135,4,25,252,221,4,90,49,252,221,3,35,0,1,0,37,0,0,3,182,5,129,
+0,9,0,0,33,35,17,1,1,55,1,1,53,51,3,182,135,254,195,254,51,127,1,88,1,51,
+135,3,160,253,133,4,39,53,252,231,2,103,178,0,1,0,37,0,0,3,182,5,129,0,9,
+0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,178,254,68,123,1,114,1,29,135,
+2,86,254,176,4,74,49,252,125,1,18,2,113,0,1,0,39,0,0,3,182,5,129,0,9,0,0,
+33,35,17,33,1,55,1,33,17,51,3,182,135,254,150,254,98,121,1,131,1,12,135,1,
+82,3,254,49,252,88,3,168,0,1,0,47,0,0,3,182,5,129,0,8,0,0,33,35,1,1,55,1,
+23,17,51,3,182,135,254,184,254,72,127,1,172,213,135,1,72,4,2,55,252,21,216,
+4,195,0,1,0,37,0,0,2,113,5,129,0,7,0,0,33,35,53,1,55,1,17,51,2,113,138,254,
+62,123,1,71,138,244,4,92,49,252,221,3,35,0,1,0,29,0,0,3,182,5,129,0,8,0,0,
+33,35,17,1,1,55,1,1,51,3,182,135,254,184,254,54,125,1,77,1,72,135,3,215,252,
+41,5,82,47,252,41,3,215,0,1,0,23,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,
+1,1,53,51,3,182,135,254,184,254,48,127,1,88,1,65,135,3,117,252,139,5,80,47,
+252,23,3,106,129,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,
+51,3,182,135,254,184,254,78,127,1,78,1,45,135,2,143,253,113,5,84,43,251,227,
+2,111,1,176,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,37,17,51,3,
+182,135,254,184,254,78,127,1,117,1,6,135,1,55,254,201,5,84,43,251,125,250,
+3,139,0,1,0,47,0,0,3,182,5,129,0,7,0,0,33,33,1,55,1,51,17,51,3,182,254,43,
+254,78,129,1,148,235,135,5,84,45,251,6,4,250,0,1,0,41,0,0,2,113,5,129,0,6,
+0,0,33,35,1,55,1,17,51,2,113,138,254,66,129,1,61,138,5,84,45,252,41,3,215,
+0,1,0,80,0,0,3,182,5,129,0,7,0,0,33,35,17,33,1,39,1,33,3,182,135,254,205,
+254,180,96,1,115,1,243,4,250,254,182,98,1,111,0,1,0,76,0,0,3,182,5,129,0,
+9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,182,254,195,92,1,155,1,72,135,
+3,145,1,54,254,219,102,1,121,254,205,1,51,0,1,0,76,0,0,3,182,5,129,0,9,0,
+0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,152,254,219,86,1,155,1,72,135,2,
+41,2,129,254,246,104,1,121,253,193,2,63,0,1,0,76,0,0,3,182,5,129,0,9,0,0,
+33,35,53,1,5,39,1,1,17,51,3,182,135,254,131,254,238,84,1,155,1,72,135,233,
+3,173,246,104,1,121,252,211,3,45,0,1,0,94,0,0,3,182,5,129,0,8,0,0,33,35,1,
+5,39,1,1,17,51,3,182,135,254,141,254,242,80,1,156,1,53,135,4,137,231,102,
+1,121,252,61,3,195,0,1,0,76,0,0,2,113,5,129,0,6,0,0,33,35,17,1,39,1,51,2,
+113,138,254,195,94,1,155,138,4,195,254,221,104,1,121,0,1,0,160,0,0,3,182,
+5,129,0,8,0,0,33,35,17,5,33,53,33,1,51,3,182,135,255,0,254,113,1,84,1,59,
+135,4,197,226,135,1,23,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,
+33,1,17,51,3,182,135,254,156,254,213,1,96,1,47,135,2,104,1,123,135,254,195,
+2,84,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,
+135,254,158,254,211,1,127,1,16,135,1,53,2,174,135,253,242,3,37,0,1,0,160,
+0,0,3,182,5,129,0,8,0,0,33,35,1,33,53,33,19,17,51,3,182,135,254,172,254,197,
+1,157,242,135,3,227,135,253,64,3,215,0,1,0,80,0,0,3,182,5,129,0,8,0,0,33,
+35,17,1,1,55,1,1,51,3,182,135,254,184,254,105,96,1,31,1,96,135,4,121,253,
+213,1,160,98,254,219,2,86,0,1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,
+1,1,17,51,3,182,135,254,184,254,101,96,1,59,1,72,135,3,176,254,184,1,156,
+96,254,199,1,70,1,16,0,1,0,70,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,55,1,
+33,17,51,3,182,135,254,103,254,176,98,1,43,1,92,135,2,156,1,116,93,254,182,
+2,94,0,1,0,76,0,0,3,182,5,129,0,7,0,0,33,35,17,1,55,1,17,51,3,182,135,253,
+29,94,2,133,135,1,39,2,227,101,253,122,3,152,0,1,0,76,0,0,3,182,5,129,0,8,
+0,0,33,35,1,1,55,1,19,17,51,3,182,135,254,184,254,101,92,1,174,217,135,2,
+115,1,153,101,254,82,254,100,4,90,0,1,0,76,0,0,2,113,5,129,0,7,0,0,33,35,
+17,1,55,1,17,51,2,113,138,254,101,94,1,61,138,2,100,1,156,100,254,195,2,90,
+0,1,0,47,0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,1,1,51,3,182,135,254,184,
+254,72,117,1,55,1,84,135,4,29,252,229,3,96,72,253,152,3,63,0,1,0,57,0,0,3,
+182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,53,51,3,182,135,254,184,254,82,117,
+1,57,1,72,135,3,158,253,112,3,72,70,253,161,2,144,180,0,1,0,63,0,0,3,182,
+5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,195,254,77,119,1,92,
+1,29,135,2,115,254,164,3,88,61,253,84,1,57,2,72,0,1,0,63,0,0,3,182,5,129,
+0,9,0,0,33,35,17,33,1,55,1,33,17,51,3,182,135,254,164,254,108,119,1,111,1,
+10,135,1,86,3,25,61,253,49,3,164,0,1,0,63,0,0,3,182,5,129,0,8,0,0,33,35,1,
+1,55,1,23,17,51,3,182,135,254,180,254,92,119,1,154,223,135,1,53,3,58,61,252,
+221,203,4,195,0,1,0,63,0,0,2,113,5,129,0,7,0,0,33,35,17,1,55,1,17,51,2,113,
+138,254,88,119,1,49,138,1,45,3,66,61,253,170,3,43,0,1,0,53,0,0,3,182,5,129,
+0,8,0,0,33,35,17,1,1,55,1,1,51,3,182,135,254,184,254,78,125,1,53,1,72,135,
+3,215,252,41,5,8,49,252,113,3,215,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,
+17,1,1,55,1,1,53,51,3,182,135,254,184,254,78,125,1,60,1,65,135,3,117,252,
+139,5,8,49,252,93,3,106,129,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,
+55,1,1,17,51,3,182,135,254,184,254,78,127,1,78,1,45,135,2,143,253,113,5,10,
+45,252,43,2,111,1,176,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,
+37,17,51,3,182,135,254,184,254,78,127,1,117,1,6,135,1,55,254,201,5,10,45,
+251,197,250,3,139,0,1,0,53,0,0,3,182,5,129,0,7,0,0,33,33,1,55,1,51,17,51,
+3,182,254,49,254,78,127,1,156,223,135,5,10,45,251,80,4,250,0,1,0,53,0,0,2,
+113,5,129,0,6,0,0,33,35,1,55,1,17,51,2,113,138,254,78,127,1,51,138,5,10,45,
+252,121,3,209,0,1,0,76,0,0,3,182,5,129,0,7,0,0,33,35,17,33,1,39,1,33,3,182,
+135,254,225,254,170,110,1,119,1,243,4,250,253,194,74,2,123,0,1,0,76,0,0,3,
+182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,209,254,186,110,
+1,155,1,72,135,3,145,1,31,254,12,74,2,123,254,205,1,51,0,1,0,76,0,0,3,182,
+5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,176,254,219,110,1,155,
+1,72,135,2,41,2,84,254,63,74,2,123,253,193,2,63,0,1,0,76,0,0,3,182,5,129,
+0,9,0,0,33,35,53,1,1,39,1,1,17,51,3,182,135,254,156,254,239,110,1,155,1,72,
+135,233,3,117,254,94,74,2,123,252,211,3,45,0,1,0,76,0,0,3,182,5,129,0,8,0,
+0,33,35,1,1,39,1,1,17,51,3,182,135,254,158,254,237,110,1,174,1,53,135,4,82,
+254,106,74,2,123,252,61,3,195,0,1,0,104,0,0,2,113,5,129,0,6,0,0,33,35,17,
+1,39,1,51,2,113,138,254,240,111,1,127,138,4,127,254,59,76,2,123,0,1,0,76,
+0,0,3,182,5,129,0,6,0,0,33,35,17,1,39,1,51,3,182,135,253,107,78,2,227,135,
+4,207,253,209,102,2,123,0,1,0,70,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,39,
+1,33,17,51,3,182,135,254,191,254,186,98,1,106,1,127,135,3,227,254,152,92,
+1,147,1,23,0,1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,
+135,254,182,254,195,92,1,155,1,72,135,2,129,1,53,254,219,103,1,121,254,202,
+2,70,0,1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,
+254,152,254,219,86,1,155,1,72,135,1,25,2,129,254,245,105,1,121,253,192,3,
+80,0,1,0,76,0,0,3,182,5,129,0,8,0,0,33,35,1,3,39,1,1,17,51,3,182,135,254,
+105,230,102,1,114,1,113,135,3,182,254,230,92,1,192,252,164,4,37,0,1,0,76,
+0,0,2,113,5,129,0,7,0,0,33,35,17,1,39,1,53,51,2,113,138,254,195,94,1,155,
+138,3,201,254,192,103,1,155,246,0,1,0,160,0,0,3,182,5,129,0,8,0,0,33,35,17,
+3,33,53,33,1,51,3,182,135,231,254,88,1,86,1,57,135,4,90,254,66,135,2,94,0,
+1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,7,33,53,33,1,17,51,3,182,135,242,
+254,99,1,102,1,41,135,3,154,254,135,1,57,1,37,0,1,0,160,0,0,3,182,5,129,0,
+9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,158,254,211,1,98,1,45,135,
+1,37,1,119,135,254,196,3,154,0,1,0,160,0,0,3,182,5,129,0,8,0,0,33,35,1,33,
+53,33,1,17,51,3,182,135,254,168,254,201,1,137,1,6,135,2,156,135,254,4,4,90,
+0,1,0,86,0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,5,1,51,3,182,135,254,193,
+254,102,94,1,10,1,113,135,4,37,253,16,1,140,94,254,3,96,0,1,0,86,0,0,3,182,
+5,129,0,9,0,0,33,35,17,1,1,55,1,1,53,51,3,182,135,254,184,254,111,94,1,19,
+1,104,135,3,127,253,190,1,132,94,254,248,2,120,242,0,1,0,88,0,0,3,182,5,129,
+0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,184,254,113,92,1,51,1,72,
+135,2,109,254,202,1,131,103,254,213,1,49,2,90,0,1,0,86,0,0,3,182,5,129,0,
+9,0,0,33,35,17,33,1,55,1,33,17,51,3,182,135,254,152,254,143,98,1,76,1,43,
+135,1,86,1,109,92,254,190,3,164,0,1,0,86,0,0,3,182,5,129,0,6,0,0,33,35,1,
+55,1,17,51,3,182,135,253,39,94,2,123,135,2,193,94,253,157,4,197,0,1,0,92,
+0,0,2,113,5,129,0,7,0,0,33,35,17,1,55,1,17,51,2,113,138,254,117,92,1,47,138,
+1,51,1,139,103,254,209,3,139,0,1,0,55,0,0,3,182,5,129,0,8,0,0,33,35,17,1,
+1,55,1,1,51,3,182,135,254,203,254,61,113,1,43,1,92,135,3,195,252,61,2,217,
+76,254,24,4,68,0,1,0,55,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,53,51,
+3,182,135,254,184,254,80,111,1,43,1,94,135,3,45,252,211,2,217,76,254,10,3,
+105,233,0,1,0,55,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,
+135,254,184,254,80,111,1,63,1,74,135,2,63,253,193,2,217,76,253,231,2,76,2,
+41,0,1,0,55,255,254,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,
+254,184,254,80,113,1,88,1,47,135,1,88,254,166,2,219,76,253,184,1,66,3,98,
+0,1,0,55,0,0,3,182,5,129,0,7,0,0,33,33,1,55,1,51,17,51,3,182,254,49,254,80,
+113,1,139,252,135,2,217,76,253,98,4,250,0,1,0,55,0,0,2,113,5,129,0,6,0,0,
+33,35,1,55,1,17,51,2,113,138,254,80,113,1,63,138,2,217,76,253,225,4,123,0,
+1,0,72,0,0,3,182,5,129,0,7,0,0,33,35,17,35,1,39,1,33,3,182,135,237,254,127,
+121,1,153,1,213,4,250,252,92,49,3,250,0,1,0,70,0,0,3,182,5,129,0,9,0,0,33,
+35,17,1,1,39,1,1,17,51,3,182,135,254,227,254,175,123,1,155,1,78,135,3,121,
+1,16,252,205,49,3,250,254,176,1,80,0,1,0,70,0,0,3,182,5,129,0,9,0,0,33,35,
+17,1,1,39,1,1,17,51,3,182,135,254,207,254,195,123,1,161,1,72,135,2,98,1,242,
+253,2,49,3,250,253,231,2,25,0,1,0,70,0,0,3,182,5,131,0,9,0,0,33,35,53,1,1,
+39,1,1,17,51,3,182,135,254,180,254,222,123,1,161,1,72,135,158,3,116,253,68,
+49,3,252,252,162,3,92,0,1,0,70,0,0,3,182,5,129,0,8,0,0,33,35,1,1,39,1,1,17,
+51,3,182,135,254,172,254,230,123,1,161,1,72,135,3,254,253,88,49,3,250,252,
+41,3,215,0,1,0,70,0,0,2,113,5,129,0,6,0,0,33,35,17,1,39,1,51,2,113,138,254,
+218,123,1,161,138,4,29,253,57,49,3,250,0,1,0,129,0,0,3,182,5,129,0,8,0,0,
+33,35,17,7,1,39,1,1,51,3,182,135,223,254,168,119,1,98,1,76,135,4,195,203,
+253,94,61,2,185,1,53,0,1,0,129,0,0,3,182,5,129,0,9,0,0,33,35,17,35,1,39,1,
+33,17,51,3,182,135,233,254,178,119,1,115,1,59,135,3,227,253,115,61,2,215,
+1,23,0,1,0,57,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,
+254,209,254,174,117,1,174,1,72,135,2,88,1,141,253,113,72,3,69,254,84,2,74,
+0,1,0,57,0,0,3,182,5,129,0,9,0,0,33,35,53,1,1,39,1,1,17,51,3,182,135,254,
+176,254,207,117,1,174,1,72,135,180,2,240,253,178,72,3,71,253,31,3,125,0,1,
+0,57,0,0,3,182,5,129,0,8,0,0,33,35,1,1,39,1,1,17,51,3,182,135,254,168,254,
+215,117,1,174,1,72,135,3,147,253,195,72,3,71,252,150,4,6,0,1,0,57,0,0,2,113,
+5,129,0,7,0,0,33,35,17,1,39,1,53,51,2,113,138,254,201,119,1,174,138,3,184,
+253,160,62,3,75,160,0,1,0,145,0,0,3,182,5,129,0,8,0,0,33,35,17,3,1,39,1,1,
+51,3,182,135,217,254,150,91,1,86,1,72,135,4,90,254,100,254,152,98,1,86,2,
+115,0,1,0,145,0,0,3,182,5,129,0,7,0,0,1,1,39,1,53,51,17,35,3,47,253,189,91,
+2,158,135,135,3,219,253,123,98,2,228,229,250,127,0,1,0,145,0,0,3,182,5,129,
+0,9,0,0,33,35,17,33,1,39,1,33,17,51,3,182,135,254,223,254,222,91,1,72,1,86,
+135,2,156,254,186,98,1,107,2,94,0,1,0,145,0,0,3,182,5,129,0,9,0,0,33,35,17,
+1,1,39,1,1,17,51,3,182,135,254,189,255,0,91,1,86,1,72,135,1,66,1,49,254,227,
+98,1,121,254,205,3,131,0,1,0,145,0,0,3,182,5,129,0,8,0,0,33,35,1,7,39,1,1,
+17,51,3,182,135,254,158,221,95,1,86,1,72,135,2,76,248,100,1,121,253,211,4,
+125,0,1,0,76,0,0,2,113,5,129,0,7,0,0,33,35,17,1,39,1,17,51,2,113,138,254,
+195,94,1,155,138,2,147,254,195,100,1,156,2,43,0,1,0,160,0,0,3,182,5,129,0,
+8,0,0,33,35,17,3,33,53,33,1,51,3,182,135,219,254,76,1,82,1,61,135,3,215,253,
+127,135,3,164,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,3,33,53,33,1,17,
+51,3,182,135,240,254,97,1,78,1,65,135,3,37,254,49,135,2,111,1,53,0,1,0,160,
+0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,213,254,
+156,1,30,1,113,135,2,147,254,195,135,1,135,2,29,0,1,0,160,0,0,3,182,5,129,
+0,8,0,0,1,33,53,33,1,17,51,17,35,1,190,254,226,1,100,1,43,135,135,1,86,135,
+254,236,4,184,250,127,0,1,0,76,0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,5,
+1,51,3,182,135,254,184,254,101,92,1,0,1,135,135,3,211,252,45,1,121,102,235,
+4,141,0,1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,5,1,53,51,3,182,135,
+254,184,254,101,92,1,10,1,125,135,3,86,252,170,1,121,102,248,3,218,192,0,
+1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,184,
+254,101,92,1,29,1,106,135,2,63,253,193,1,121,102,254,250,2,127,2,41,0,1,0,
+76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,184,254,
+101,92,1,61,1,74,135,1,51,254,205,1,121,102,254,219,1,54,3,145,0,1,0,80,0,
+0,3,182,5,129,0,7,0,0,33,33,1,55,1,33,17,51,3,182,254,49,254,105,92,1,121,
+1,10,135,1,119,104,254,168,4,250,0,1,0,80,0,0,2,113,5,129,0,6,0,0,33,35,1,
+55,1,17,51,2,113,138,254,105,92,1,59,138,1,119,104,254,223,4,195,0,1,0,47,
+0,0,3,182,5,129,0,7,0,0,33,35,17,35,1,39,1,33,3,182,135,235,254,108,129,1,
+178,1,213,4,250,251,6,45,5,84,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,37,
+1,39,1,1,17,51,3,182,135,254,250,254,139,127,1,178,1,72,135,3,139,250,251,
+123,45,5,84,254,201,1,55,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,
+1,1,17,51,3,182,135,254,219,254,170,127,1,178,1,72,135,2,74,1,237,251,201,
+45,5,84,253,213,2,43,0,1,0,23,0,0,3,182,5,129,0,9,0,0,33,35,53,1,1,39,1,1,
+17,51,3,182,135,254,195,254,164,127,1,208,1,72,135,233,3,17,252,8,47,5,80,
+252,219,3,37,0,1,0,29,0,0,3,182,5,129,0,8,0,0,33,35,1,1,39,1,1,17,51,3,182,
+135,254,184,254,179,125,1,202,1,72,135,3,215,252,41,47,5,82,252,41,3,215,
+0,1,0,41,0,0,2,113,5,129,0,6,0,0,33,35,17,1,39,1,51,2,113,138,254,195,129,
+1,190,138,3,215,252,41,45,5,84,0,1,0,47,0,0,3,182,5,129,0,8,0,0,33,35,17,
+7,1,39,1,1,51,3,182,135,213,254,84,127,1,184,1,72,135,4,195,215,252,20,55,
+4,2,1,72,0,1,0,39,0,0,3,182,5,129,0,9,0,0,33,35,17,35,1,39,1,33,17,51,3,182,
+135,244,254,101,121,1,180,1,84,135,3,227,252,29,49,4,57,1,23,0,1,0,37,0,0,
+3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,227,254,142,123,
+1,188,1,78,135,2,113,1,18,252,125,49,4,74,254,176,2,86,0,1,0,37,0,0,3,182,
+5,129,0,9,0,0,33,35,53,1,1,39,1,1,17,51,3,182,135,254,215,254,158,127,1,215,
+1,51,135,199,2,104,252,209,53,4,64,253,129,3,139,0,1,0,37,0,0,3,182,5,129,
+0,8,0,0,33,35,1,1,39,1,1,17,51,3,182,135,254,184,254,185,123,1,194,1,72,135,
+3,35,252,221,49,4,90,252,221,4,25,0,1,0,37,0,0,2,113,5,129,0,7,0,0,33,35,
+17,1,39,1,53,51,2,113,138,254,185,123,1,194,138,3,121,252,135,49,4,193,143,
+0,1,0,72,0,0,3,182,5,129,0,6,0,0,33,35,17,1,39,1,51,3,182,135,253,143,118,
+2,231,135,4,102,251,154,68,5,61,0,1,0,45,0,0,3,182,5,129,0,9,0,0,33,35,17,
+7,1,39,1,1,17,51,3,182,135,248,254,109,119,1,160,1,98,135,3,178,248,253,70,
+70,2,202,1,99,1,14,0,1,0,80,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,39,1,33,
+17,51,3,182,135,254,248,254,156,115,1,135,1,88,135,2,156,253,100,72,2,219,
+2,94,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,
+254,209,254,160,107,1,174,1,76,135,1,33,1,45,253,178,76,2,227,254,176,3,162,
+0,1,0,53,0,0,3,182,5,129,0,8,0,0,33,35,1,1,39,1,1,17,51,3,182,135,254,184,
+254,185,107,1,174,1,76,135,2,33,253,223,78,2,227,253,215,4,121,0,1,0,45,0,
+0,2,113,5,129,0,7,0,0,33,35,17,1,39,1,17,51,2,113,138,254,185,115,1,186,138,
+2,33,253,223,72,2,227,2,86,0,1,0,70,0,0,3,182,5,129,0,8,0,0,33,35,17,3,1,
+39,1,1,51,3,182,135,225,254,82,90,1,143,1,90,135,3,250,253,156,254,106,102,
+1,121,3,162,0,1,0,78,0,0,3,182,5,129,0,9,0,0,33,35,17,3,1,39,1,1,53,51,3,
+182,135,219,254,76,82,1,153,1,72,135,3,104,254,48,254,104,106,1,134,2,166,
+235,0,1,0,78,0,0,3,182,5,129,0,7,0,0,33,35,17,1,39,1,17,51,3,182,135,253,
+125,94,2,225,135,2,115,253,153,94,2,205,2,74,0,1,0,82,0,0,3,182,5,129,0,9,
+0,0,33,35,17,33,1,39,1,33,17,51,3,182,135,254,205,254,184,98,1,113,1,108,
+135,1,86,254,180,96,1,115,3,164,0,1,0,78,0,0,3,182,5,129,0,8,0,0,33,35,1,
+1,39,1,1,17,51,3,182,135,254,184,254,195,92,1,153,1,72,135,1,51,254,213,96,
+1,134,254,204,4,199,0,1,0,70,0,0,2,113,5,129,0,7,0,0,33,35,17,1,39,1,17,51,
+2,113,138,254,185,90,1,161,138,1,41,254,215,100,1,127,3,158,0,1,0,160,0,0,
+3,182,5,129,0,8,0,0,33,35,17,1,33,53,33,1,51,3,182,135,254,223,254,146,1,
+14,1,129,135,3,188,252,68,135,4,250,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,
+35,17,1,33,53,33,1,53,51,3,182,135,254,223,254,146,1,16,1,127,135,3,39,252,
+217,135,4,41,209,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,
+17,51,3,182,135,254,225,254,144,1,28,1,115,135,2,68,253,188,135,2,244,2,6,
+0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,
+213,254,156,1,51,1,92,135,1,43,254,213,135,1,92,3,158,255,255,0,113,255,236,
+4,205,6,254,18,38,1,126,0,0,16,7,9,63,0,199,0,0,255,255,0,113,255,236,4,205,
+6,254,18,38,1,126,0,0,16,7,9,64,0,197,0,0,255,255,0,113,255,236,4,205,6,254,
+18,38,1,126,0,0,16,7,9,65,0,199,0,0,255,255,0,113,255,236,4,205,6,254,18,
+38,1,126,0,0,16,7,9,66,0,197,0,0,255,255,0,113,255,236,4,205,7,59,18,38,1,
+126,0,0,16,7,9,87,0,199,0,0,255,255,0,113,255,236,4,205,7,59,18,38,1,126,
+0,0,16,7,9,86,0,199,0,0,255,255,0,113,255,236,4,205,7,59,18,38,1,126,0,0,
+16,7,9,85,0,199,0,0,255,255,0,113,255,236,4,205,7,59,18,38,1,126,0,0,16,7,
+9,84,0,199,0,0,255,255,255,226,255,236,2,160,6,254,18,38,1,134,0,0,16,7,9,
+63,255,120,0,0,255,255,255,226,255,236,2,160,6,254,18,38,1,134,0,0,16,7,9,
+64,255,120,0,0,255,255,255,226,255,236,2,160,6,254,18,38,1,134,0,0,16,7,9,
+65,255,120,0,0,255,255,255,226,255,236,2,160,6,254,18,38,1,134,0,0,16,7,9,
+66,255,120,0,0,255,255,255,214,255,236,2,160,7,59,18,38,1,134,0,0,16,7,9,
+87,255,120,0,0,255,255,255,214,255,236,2,160,7,59,18,38,1,134,0,0,16,7,9,
+86,255,120,0,0,255,255,255,214,255,236,2,160,7,59,18,38,1,134,0,0,16,7,9,
+85,255,120,0,0,255,255,255,214,255,236,2,160,7,59,18,38,1,134,0,0,16,7,9,
+84,255,120,0,0,255,255,0,162,255,236,4,121,6,254,18,38,1,146,0,0,16,7,9,63,
+0,217,0,0,255,255,0,162,255,236,4,121,6,254,18,38,1,146,0,0,16,7,9,64,0,215,
+0,0,255,255,0,162,255,236,4,121,6,254,18,38,1,146,0,0,16,7,9,65,0,217,0,0,
+255,255,0,162,255,236,4,121,6,254,18,38,1,146,0,0,16,7,9,66,0,215,0,0,255,
+255,0,162,255,236,4,121,7,59,18,38,1,146,0,0,16,7,9,87,0,217,0,0,255,255,
+0,162,255,236,4,121,7,59,18,38,1,146,0,0,16,7,9,86,0,217,0,0,255,255,0,162,
+255,236,4,121,7,59,18,38,1,146,0,0,16,7,9,85,0,217,0,0,255,255,0,162,255,
+236,4,121,7,59,18,38,1,146,0,0,16,7,9,84,0,217,0,0,255,255,255,226,255,236,
+2,160,7,141,18,38,1,134,0,0,16,7,9,83,255,120,0,0,255,255,255,226,255,236,
+2,160,7,141,18,38,1,134,0,0,16,7,9,82,255,120,0,0,255,255,255,214,255,236,
+2,160,7,141,18,38,1,134,0,0,16,7,9,81,255,120,0,0,255,255,255,214,255,236,
+2,160,7,141,18,38,1,134,0,0,16,7,9,80,255,120,0,0,255,255,0,162,255,236,4,
+121,7,141,18,38,1,146,0,0,16,7,9,83,0,217,0,0,255,255,0,162,255,236,4,121,
+7,141,18,38,1,146,0,0,16,7,9,82,0,217,0,0,255,255,0,162,255,236,4,121,7,141,
+18,38,1,146,0,0,16,7,9,81,0,217,0,0,255,255,0,162,255,236,4,121,7,141,18,
+38,1,146,0,0,16,7,9,80,0,217,0,0,0,1,0,201,254,123,5,10,5,203,0,30,0,0,37,
+20,6,35,34,39,53,22,51,50,54,53,17,52,38,35,34,6,21,17,35,17,51,23,51,54,
+54,51,50,4,21,5,10,207,190,98,58,71,85,102,111,159,181,193,188,184,145,31,
+10,54,228,115,245,1,5,12,193,208,27,155,20,117,110,3,205,190,160,206,228,
+252,135,5,182,188,92,117,253,235,0,1,0,199,254,123,5,78,5,182,0,25,0,0,1,
+34,39,53,22,51,50,54,55,1,35,22,21,17,35,17,51,1,51,38,53,17,51,17,20,6,3,
+205,98,58,71,85,102,109,2,252,198,8,17,170,213,3,12,8,14,172,199,254,123,
+27,155,20,117,110,4,190,255,166,252,231,5,182,251,109,154,255,2,250,250,86,
+196,205,0,1,0,186,255,236,4,252,5,203,0,34,0,0,1,20,0,33,34,0,53,53,51,21,
+20,22,51,50,54,53,17,52,38,35,34,6,21,21,35,17,51,23,51,54,54,51,50,4,21,
+4,252,254,221,254,252,254,254,227,185,182,182,174,183,160,180,193,188,185,
+146,30,11,53,227,117,245,1,5,2,4,249,254,225,1,29,255,21,27,179,196,196,181,
+1,201,190,160,206,228,152,2,213,188,91,118,253,235,0,2,0,174,255,236,4,176,
+6,31,0,19,0,38,0,0,1,16,33,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,32,
+17,39,52,54,51,50,22,21,16,5,21,22,22,21,20,4,35,34,36,53,1,98,1,80,169,161,
+184,172,109,88,149,158,152,139,254,207,180,254,236,221,250,254,200,187,190,
+254,243,245,244,254,244,1,172,254,211,157,144,152,159,152,142,134,121,129,
+254,182,9,224,247,208,183,254,218,51,8,21,199,187,208,228,228,208,0,3,0,106,
+4,201,2,201,6,254,0,7,0,23,0,27,0,0,1,35,38,39,53,51,22,23,37,52,54,51,50,
+22,21,20,6,7,53,54,54,53,34,38,3,33,21,33,2,178,86,136,67,197,25,67,253,236,
+61,45,50,55,106,120,56,65,45,61,52,2,95,253,161,5,166,169,134,20,127,172,
+222,52,46,68,53,109,122,13,76,3,48,43,47,254,240,145,0,3,0,106,4,201,2,207,
+6,254,0,3,0,19,0,27,0,0,19,33,21,33,19,52,54,51,50,22,21,20,6,7,53,54,54,
+53,34,38,23,54,55,51,21,6,7,35,106,2,95,253,161,70,62,45,49,55,105,120,56,
+65,45,62,254,58,34,197,67,136,86,5,90,145,1,211,52,46,68,53,109,122,13,76,
+3,48,43,47,172,149,150,20,134,169,0,3,0,106,4,201,2,201,6,254,0,3,0,11,0,
+27,0,0,19,33,21,33,37,35,38,39,53,51,22,23,37,20,6,35,20,22,23,21,38,38,53,
+52,54,51,50,22,106,2,95,253,161,2,58,86,136,67,197,25,67,254,186,61,45,65,
+56,120,106,55,50,45,61,5,90,145,221,169,134,20,127,172,222,50,47,43,48,3,
+76,13,122,109,53,68,46,0,3,0,106,4,201,2,205,6,254,0,3,0,19,0,27,0,0,19,33,
+21,33,1,20,6,35,20,22,23,21,38,38,53,52,54,51,50,22,19,54,55,51,21,6,7,35,
+106,2,95,253,161,1,9,62,45,65,56,120,105,55,49,45,62,57,58,34,197,67,136,
+86,5,90,145,1,211,50,47,43,48,3,76,13,122,109,53,68,46,254,238,149,150,20,
+134,169,0,2,254,244,4,217,1,104,6,33,0,11,0,21,0,0,1,52,54,51,50,22,21,20,
+6,35,34,38,23,54,54,55,51,21,6,6,7,35,254,244,56,40,46,50,58,38,40,56,217,
+43,114,37,217,41,182,69,119,5,115,53,47,54,46,53,50,50,76,55,175,73,21,61,
+192,54,0,2,254,166,4,217,1,90,6,205,0,11,0,24,0,0,3,52,54,51,50,22,21,20,
+6,35,34,38,7,51,22,23,54,55,51,21,6,7,35,38,39,96,56,40,47,49,58,38,40,56,
+250,123,114,105,126,97,127,205,51,184,60,192,6,104,54,47,56,45,52,50,50,19,
+74,115,126,63,27,205,96,102,199,0,3,254,209,4,248,1,49,6,205,0,11,0,23,0,
+27,0,0,1,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,
+38,5,33,21,33,254,223,56,40,39,58,58,39,40,56,1,129,56,38,39,58,58,39,38,
+56,254,113,2,96,253,160,6,104,54,47,47,54,52,50,50,52,54,47,47,54,52,50,50,
+171,145,0,3,254,147,4,215,1,111,6,205,0,11,0,23,0,47,0,0,1,52,54,51,50,22,
+21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,19,34,46,2,35,34,6,7,
+35,54,54,51,50,30,2,51,50,54,55,51,6,6,254,223,56,40,39,58,58,39,40,56,1,
+129,56,38,39,58,58,39,38,56,58,43,83,79,73,34,49,49,14,95,12,111,92,45,85,
+78,72,32,47,50,15,93,13,110,6,104,54,47,47,54,52,50,50,52,54,47,47,54,52,
+50,50,254,165,31,36,31,54,46,112,122,31,37,31,54,47,114,120,255,255,255,161,
+255,242,4,63,6,158,16,71,2,44,4,100,0,0,192,0,64,0,0,2,254,168,4,215,1,88,
+7,12,0,23,0,32,0,0,19,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,51,
+6,6,1,55,54,55,51,21,6,7,35,145,39,77,73,70,31,38,42,15,104,10,104,85,42,
+80,73,67,30,43,38,14,102,11,101,254,147,49,110,35,218,55,238,119,4,217,31,
+36,31,44,56,112,122,31,37,31,54,47,112,122,1,53,59,126,69,20,79,179,0,2,254,
+209,4,248,1,49,7,12,0,3,0,11,0,0,1,33,21,33,37,35,38,39,53,51,22,23,254,209,
+2,96,253,160,1,182,121,235,55,215,49,147,5,137,145,235,188,89,20,100,172,
+0,2,254,209,4,248,1,49,7,12,0,3,0,13,0,0,1,33,21,33,19,54,54,55,51,21,6,6,
+7,35,254,209,2,96,253,160,170,115,61,18,218,32,164,97,119,5,137,145,1,4,146,
+91,35,20,46,156,75,0,3,254,166,4,207,1,90,7,12,0,11,0,23,0,40,0,0,1,20,6,
+35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,3,51,22,22,23,
+54,54,55,51,21,7,6,7,35,38,39,39,1,31,51,46,46,50,58,38,41,56,254,127,56,
+39,46,50,58,38,39,56,248,123,53,115,51,56,113,54,127,66,150,40,184,44,144,
+64,5,51,48,52,54,46,53,50,50,53,53,47,54,46,53,50,50,1,164,35,78,55,56,77,
+35,26,64,142,75,74,143,64,0,3,254,207,4,207,1,47,6,176,0,11,0,23,0,27,0,0,
+1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,3,33,
+21,33,1,31,51,46,46,50,58,38,41,56,254,127,56,39,46,50,58,38,39,56,207,2,
+96,253,160,5,51,48,52,54,46,53,50,50,53,53,47,54,46,53,50,50,1,72,145,0,2,
+254,168,4,215,1,88,6,176,0,23,0,27,0,0,19,34,46,2,35,34,6,7,35,54,54,51,50,
+30,2,51,50,54,55,51,6,6,1,33,21,33,145,39,77,73,70,31,38,42,15,104,10,104,
+85,42,80,73,67,30,43,38,14,102,11,101,253,231,2,96,253,160,4,217,31,36,31,
+44,56,112,122,31,37,31,54,47,112,122,1,215,145,0,2,254,207,4,217,1,47,6,178,
+0,11,0,15,0,0,3,52,54,51,50,22,21,20,6,35,34,38,3,33,21,33,104,61,45,48,56,
+58,46,45,61,201,2,96,253,160,5,76,60,54,61,53,54,61,56,1,161,145,0,2,254,
+207,6,41,1,47,8,2,0,11,0,15,0,0,3,52,54,51,50,22,21,20,6,35,34,38,3,33,21,
+33,104,61,45,48,56,58,46,45,61,201,2,96,253,160,6,156,60,54,61,53,54,61,56,
+1,161,145,0,4,0,94,4,209,2,213,7,141,0,11,0,23,0,36,0,44,0,0,19,52,54,51,
+50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,19,6,6,35,34,38,
+39,51,22,22,51,50,55,5,54,55,51,21,6,7,35,123,56,40,47,49,58,38,40,56,1,127,
+56,38,47,49,58,38,38,56,219,19,171,132,134,158,17,113,12,86,103,168,32,254,
+209,82,45,178,91,113,101,5,55,54,47,56,45,52,50,50,52,54,47,56,45,52,50,50,
+1,194,120,136,134,122,57,54,111,4,108,96,20,119,88,0,4,0,94,4,209,2,213,7,
+141,0,11,0,23,0,36,0,44,0,0,19,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,
+50,22,21,20,6,35,34,38,19,6,6,35,34,38,39,51,22,22,51,50,55,7,35,38,39,53,
+51,22,23,123,56,40,47,49,58,38,40,56,1,127,56,38,47,49,58,38,38,56,219,19,
+171,132,134,158,17,113,12,86,103,168,32,110,101,113,91,178,51,76,5,55,54,
+47,56,45,52,50,50,52,54,47,56,45,52,50,50,1,194,120,136,134,122,57,54,111,
+27,88,119,20,109,95,0,4,0,106,4,209,2,201,7,141,0,11,0,23,0,27,0,35,0,0,19,
+52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,1,33,21,
+33,55,54,55,51,21,6,7,35,123,56,40,47,49,58,38,40,56,1,127,56,38,47,49,58,
+38,38,56,254,112,2,95,253,161,199,82,45,178,91,113,101,5,55,54,47,56,45,52,
+50,50,52,54,47,56,45,52,50,50,1,106,146,230,108,96,20,119,88,0,4,0,106,4,
+209,2,201,7,141,0,11,0,23,0,27,0,35,0,0,19,52,54,51,50,22,21,20,6,35,34,38,
+37,52,54,51,50,22,21,20,6,35,34,38,1,33,21,33,37,35,38,39,53,51,22,23,123,
+56,40,47,49,58,38,40,56,1,127,56,38,47,49,58,38,38,56,254,112,2,95,253,161,
+1,136,101,113,91,178,51,76,5,55,54,47,56,45,52,50,50,52,54,47,56,45,52,50,
+50,1,106,146,207,88,119,20,109,95,0,3,0,94,4,186,2,213,7,59,0,13,0,29,0,37,
+0,0,1,6,6,35,34,38,39,51,22,22,51,50,54,55,3,20,6,35,20,22,23,21,38,38,53,
+52,54,51,50,22,19,54,55,51,21,6,7,35,2,213,19,170,133,136,156,17,113,11,80,
+110,93,93,14,237,62,45,65,56,120,105,55,49,45,62,57,58,34,197,67,136,86,5,
+176,118,128,126,120,53,47,50,50,1,41,49,47,43,48,3,76,12,122,110,52,68,45,
+254,238,149,150,21,134,169,0,3,0,94,4,186,2,213,7,59,0,13,0,21,0,37,0,0,1,
+6,6,35,34,38,39,51,22,22,51,50,54,55,55,35,38,39,53,51,22,23,37,20,6,35,20,
+22,23,21,38,38,53,52,54,51,50,22,2,213,19,170,133,136,156,17,113,11,80,110,
+93,93,14,68,86,136,67,197,25,67,254,186,61,45,65,56,120,106,55,50,44,62,5,
+176,118,128,126,120,53,47,50,50,51,169,134,21,127,172,221,49,47,43,48,3,76,
+12,122,110,52,68,46,0,3,0,94,4,186,2,213,7,59,0,13,0,29,0,37,0,0,1,6,6,35,
+34,38,39,51,22,22,51,50,54,55,1,52,54,51,50,22,21,20,6,7,53,54,54,53,34,38,
+23,54,55,51,21,6,7,35,2,213,19,170,133,136,156,17,113,11,80,110,93,93,14,
+254,80,62,45,49,55,105,120,56,65,45,62,254,58,34,197,67,136,86,5,176,118,
+128,126,120,53,47,50,50,1,41,53,45,68,52,110,122,12,76,3,48,43,47,172,149,
+150,21,134,169,0,3,0,94,4,186,2,213,7,59,0,13,0,21,0,37,0,0,1,6,6,35,34,38,
+39,51,22,22,51,50,54,55,55,35,38,39,53,51,22,23,37,52,54,51,50,22,21,20,6,
+7,53,54,54,53,34,38,2,213,19,170,133,136,156,17,113,11,80,110,93,93,14,82,
+86,136,67,197,25,67,253,236,62,44,50,55,106,120,56,65,45,61,5,176,118,128,
+126,120,53,47,50,50,51,169,134,21,127,172,221,52,46,68,52,110,122,12,76,3,
+48,43,47,0,1,0,0,255,233,7,137,5,182,0,27,0,0,33,35,1,1,35,1,1,33,2,2,6,6,
+35,34,39,53,22,51,50,54,18,18,19,33,1,1,51,1,7,137,209,254,125,254,119,195,
+1,230,254,164,254,231,57,78,81,141,110,69,66,52,61,59,81,62,84,52,2,18,1,
+102,1,105,194,254,60,2,123,253,133,2,250,2,24,254,54,254,18,250,119,25,154,
+27,109,1,23,2,34,1,143,253,195,2,61,253,72,0,1,0,14,255,244,6,84,4,74,0,24,
+0,0,1,1,35,2,2,6,35,34,39,53,22,51,50,18,19,33,1,1,51,1,1,35,1,1,35,3,240,
+254,239,233,26,95,154,118,61,34,25,31,108,133,35,1,232,1,26,1,25,202,254,
+134,1,143,205,254,213,254,209,203,2,49,1,129,254,158,254,99,191,12,137,6,
+1,204,1,251,254,98,1,158,253,231,253,207,1,182,254,74,0,2,0,199,0,0,6,106,
+5,182,0,16,0,25,0,0,1,21,7,1,51,1,1,35,1,6,33,35,17,35,17,33,32,1,51,50,54,
+53,52,38,35,35,4,111,2,1,38,195,254,45,1,231,208,254,77,149,254,213,168,184,
+1,131,2,37,253,16,147,218,196,182,193,186,4,8,18,17,1,209,253,72,253,2,2,
+193,136,253,199,5,182,253,33,141,156,141,140,0,2,0,174,254,20,6,102,4,94,
+0,26,0,39,0,0,5,34,39,35,23,22,21,17,35,17,51,23,51,54,54,51,50,22,23,1,51,
+1,1,35,1,6,6,3,34,6,7,21,20,22,51,50,54,53,52,38,2,182,221,119,12,4,8,180,
+148,24,8,64,168,110,182,230,29,1,22,203,254,133,1,143,204,254,217,25,233,
+217,163,145,2,148,166,138,155,155,20,159,41,78,61,254,61,6,54,150,90,80,220,
+210,1,154,253,231,253,207,1,174,217,233,3,219,184,197,35,223,199,224,200,
+201,213,0,2,0,45,0,0,6,201,5,182,0,21,0,29,0,0,1,33,17,33,21,33,17,33,21,
+33,17,33,1,35,1,38,38,53,52,36,33,33,5,35,34,6,21,16,33,51,6,201,253,135,
+2,84,253,172,2,121,252,213,254,225,254,133,215,1,154,155,146,1,17,1,17,4,
+13,252,213,221,183,178,1,113,213,5,20,254,56,160,253,246,162,2,94,253,162,
+2,127,50,206,158,198,211,157,128,133,254,230,0,3,0,33,255,236,6,162,4,94,
+0,31,0,39,0,46,0,0,51,35,1,38,38,53,52,54,51,33,21,54,51,50,18,21,21,33,22,
+22,51,50,54,55,21,6,6,35,34,36,39,33,1,20,33,51,17,33,34,6,37,34,6,7,33,38,
+38,242,209,1,57,126,130,206,183,1,205,118,187,207,246,253,16,5,180,165,88,
+156,109,88,162,111,219,254,248,25,255,0,254,252,1,12,238,254,240,115,119,
+3,211,129,150,14,2,47,2,138,1,205,32,162,119,152,172,119,139,254,245,228,
+109,187,194,31,45,158,38,33,239,217,1,80,186,1,106,90,113,166,148,154,160,
+0,1,0,199,0,0,4,242,5,182,0,18,0,0,33,35,1,17,35,17,51,17,1,39,55,23,55,51,
+1,23,7,39,1,4,242,222,253,107,184,184,1,106,176,103,174,182,209,254,236,184,
+105,178,254,252,2,229,253,27,5,182,253,60,1,141,172,109,168,198,254,203,176,
+109,172,254,224,0,1,0,174,0,0,4,35,4,74,0,18,0,0,1,7,1,35,1,17,35,17,51,17,
+19,39,55,23,55,51,7,23,7,2,201,162,1,252,209,254,16,180,180,254,141,90,135,
+131,197,225,159,86,2,240,183,253,199,2,45,253,211,4,74,253,235,1,33,141,88,
+135,150,252,158,90,0,1,0,2,254,0,7,201,5,182,0,44,0,0,1,54,51,32,0,17,20,
+2,6,35,34,38,39,53,22,51,50,54,53,52,38,35,34,6,7,17,35,17,33,2,2,6,6,35,
+34,39,53,22,51,50,54,54,18,19,33,4,125,76,127,1,49,1,80,129,244,168,77,134,
+74,134,126,184,189,240,221,43,122,25,184,254,155,56,85,83,140,109,69,64,52,
+61,58,81,56,71,72,2,184,3,23,12,254,164,254,202,205,254,215,155,21,28,164,
+49,253,242,246,248,7,7,253,141,5,20,254,87,253,240,253,117,25,154,25,108,
+242,1,197,2,16,0,1,0,14,254,10,6,80,4,74,0,36,0,0,1,54,51,32,17,16,2,35,34,
+39,53,22,51,32,17,52,38,35,34,7,17,35,17,33,2,2,6,35,34,39,53,22,51,50,18,
+19,33,3,170,82,59,2,25,234,208,140,106,108,127,1,11,174,181,78,59,180,255,
+0,27,96,150,118,67,30,29,25,107,136,37,2,78,2,113,12,253,190,254,244,254,
+219,60,159,61,1,149,215,203,14,254,47,3,178,254,155,254,99,190,14,133,8,1,
+201,2,4,0,1,0,199,254,0,8,113,5,182,0,36,0,0,1,54,51,32,0,17,20,2,6,35,34,
+38,39,53,22,51,50,54,53,52,38,35,34,6,7,17,35,17,33,17,35,17,51,17,33,17,
+51,5,37,76,127,1,49,1,80,129,244,168,77,134,74,134,126,184,189,240,221,43,
+122,25,184,253,18,184,184,2,238,184,3,23,12,254,164,254,202,205,254,215,155,
+21,28,164,49,253,242,246,248,7,7,253,141,2,170,253,86,5,182,253,150,2,106,
+0,1,0,174,254,10,6,188,4,74,0,32,0,0,1,54,51,32,0,17,16,2,35,34,39,53,22,
+51,32,17,52,38,35,34,7,17,35,17,33,17,35,17,51,17,33,17,51,4,23,82,59,1,13,
+1,11,234,208,140,106,110,126,1,10,173,181,77,60,181,254,0,180,180,2,0,181,
+2,113,12,254,225,254,221,254,244,254,219,60,159,61,1,149,215,203,14,254,47,
+1,233,254,23,4,74,254,55,1,201,0,1,0,199,254,127,5,193,5,182,0,11,0,0,37,
+17,35,17,35,17,33,17,35,17,33,17,5,193,177,182,253,37,184,4,73,164,253,219,
+1,129,5,20,250,236,5,182,250,238,0,1,0,174,254,133,4,240,4,74,0,11,0,0,37,
+17,35,17,35,17,33,17,35,17,33,17,4,240,179,163,253,200,180,3,160,152,253,
+237,1,123,3,176,252,80,4,74,252,78,0,1,0,199,254,127,5,160,5,182,0,22,0,0,
+37,17,35,17,35,17,52,38,35,34,6,7,17,35,17,51,17,36,51,50,22,21,3,5,160,176,
+183,124,140,102,181,151,184,184,1,2,195,206,224,2,164,253,219,1,129,2,45,
+118,118,34,50,253,59,5,182,253,168,92,191,173,254,86,0,1,0,174,254,133,4,
+238,6,20,0,26,0,0,37,17,35,17,35,17,52,38,35,34,6,21,17,35,17,51,17,20,7,
+51,54,54,51,50,22,21,17,4,238,179,161,119,127,167,155,180,180,10,12,49,180,
+113,200,202,152,253,237,1,123,2,190,134,131,186,214,253,201,6,20,254,56,90,
+64,80,90,191,210,253,205,0,1,0,176,4,215,3,236,5,164,0,13,0,0,1,21,7,35,39,
+35,7,35,39,35,7,35,39,53,3,236,82,33,49,187,49,33,49,184,49,33,80,5,164,33,
+172,102,102,102,102,172,33,0,1,0,41,255,236,4,86,5,182,0,28,0,0,1,5,17,50,
+18,17,51,20,2,4,35,34,39,17,7,53,55,53,7,53,55,17,51,17,37,21,5,21,37,3,90,
+254,90,245,253,176,163,254,215,206,116,68,219,219,219,219,176,1,166,254,90,
+1,166,3,106,147,253,168,1,38,1,40,237,254,176,164,20,2,156,76,133,74,162,
+74,133,74,1,112,254,205,145,133,145,162,146,255,255,1,117,0,0,6,61,4,199,
+16,71,8,16,7,213,0,0,192,0,64,0,255,255,0,20,254,20,3,10,6,20,16,71,2,46,
+3,20,0,0,192,0,64,0,255,255,0,96,1,131,4,47,4,35,16,71,2,47,4,143,0,0,192,
+0,64,0,255,255,0,102,0,162,4,41,5,4,16,71,2,48,4,143,0,0,192,0,64,0,255,255,
+1,4,254,20,2,180,6,170,16,71,8,21,4,215,0,0,192,0,64,0,255,255,2,35,254,20,
+3,211,6,170,16,71,8,22,4,215,0,0,192,0,64,0,0,0,0,0,0,0,15,0,186,0,3,0,1,
+4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,18,0,94,0,3,0,1,4,9,0,2,0,14,0,112,0,3,
+0,1,4,9,0,3,0,56,0,126,0,3,0,1,4,9,0,4,0,18,0,94,0,3,0,1,4,9,0,5,0,30,0,182,
+0,3,0,1,4,9,0,6,0,16,0,212,0,3,0,1,4,9,0,7,0,68,0,228,0,3,0,1,4,9,0,8,0,42,
+1,40,0,3,0,1,4,9,0,9,0,40,1,82,0,3,0,1,4,9,0,10,0,96,1,122,0,3,0,1,4,9,0,
+11,0,62,1,218,0,3,0,1,4,9,0,12,0,60,2,24,0,3,0,1,4,9,0,13,2,150,2,84,0,3,
+0,1,4,9,0,14,0,52,4,234,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,
+116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,
+0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,
+116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,
+111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,82,0,101,0,103,0,117,0,108,0,
+97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,
+97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,
+0,97,0,110,0,115,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,
+0,48,0,54,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,
+78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,
+0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,
+0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,
+32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,
+0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,
+0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,
+0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,
+0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,
+0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,
+65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,
+0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,
+0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,
+0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,
+0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,
+115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,
+0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,
+0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,
+101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,
+0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,
+0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,
+0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,
+0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,
+0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,
+0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,
+0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,0,0,0,184,0,226,0,2,0,28,0,0,2,51,0,1,2,52,2,53,0,2,2,54,
+2,54,0,3,2,55,2,55,0,1,2,56,2,58,0,3,2,59,2,89,0,1,2,90,2,91,0,2,2,92,2,95,
+0,1,2,96,2,100,0,3,2,101,2,139,0,1,2,140,2,143,0,3,2,144,3,114,0,1,3,115,
+3,125,0,3,3,126,4,194,0,1,4,195,4,195,0,3,4,196,4,227,0,1,4,228,5,78,0,3,
+5,79,5,130,0,1,5,131,5,131,0,3,5,132,6,71,0,1,6,72,6,84,0,3,6,85,7,255,0,
+1,8,0,8,0,0,3,8,1,8,135,0,1,8,136,8,142,0,3,8,143,9,62,0,1,9,63,9,87,0,3,
+9,88,9,111,0,1,0,12,0,4,0,24,0,24,0,28,0,28,0,1,0,4,2,52,2,53,2,90,2,91,0,
+1,0,10,0,2,0,6,0,10,0,1,2,193,0,1,5,130,0,2,0,31,2,96,2,98,0,2,2,100,2,100,
+0,3,2,140,2,143,0,2,3,115,3,115,0,2,4,228,4,244,0,2,4,246,4,249,0,3,4,250,
+4,250,0,2,4,252,5,0,0,3,5,3,5,5,0,3,5,8,5,18,0,3,5,24,5,27,0,3,5,28,5,30,
+0,2,5,33,5,35,0,2,5,36,5,36,0,3,5,37,5,37,0,2,5,38,5,40,0,3,5,41,5,43,0,2,
+5,44,5,45,0,3,5,47,5,49,0,2,5,50,5,53,0,3,5,54,5,54,0,2,5,56,5,57,0,3,5,58,
+5,58,0,2,5,66,5,78,0,2,6,72,6,73,0,2,6,74,6,74,0,3,6,75,6,81,0,2,6,82,6,82,
+0,3,6,83,6,83,0,2,6,84,6,84,0,3,8,139,8,142,0,1,0,1,0,0,0,10,0,78,0,226,0,
+3,99,121,114,108,0,20,103,114,101,107,0,36,108,97,116,110,0,52,0,4,0,0,0,
+0,255,255,0,3,0,0,0,3,0,6,0,4,0,0,0,0,255,255,0,3,0,1,0,4,0,7,0,4,0,0,0,0,
+255,255,0,3,0,2,0,5,0,8,0,9,107,101,114,110,0,56,107,101,114,110,0,62,107,
+101,114,110,0,68,109,97,114,107,0,74,109,97,114,107,0,80,109,97,114,107,0,
+102,109,107,109,107,0,124,109,107,109,107,0,132,109,107,109,107,0,140,0,0,
+0,1,0,11,0,0,0,1,0,11,0,0,0,1,0,11,0,0,0,1,0,1,0,0,0,9,0,0,0,1,0,2,0,3,0,
+4,0,5,0,6,0,7,0,8,0,0,0,9,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,0,0,2,0,9,
+0,10,0,0,0,2,0,9,0,10,0,0,0,2,0,9,0,10,0,12,0,26,0,42,0,58,0,74,0,90,0,106,
+0,122,0,138,0,154,0,170,0,186,0,202,0,9,0,0,0,1,0,8,0,1,0,4,0,0,0,194,0,9,
+0,0,0,1,0,8,0,1,0,4,0,0,37,126,0,9,0,0,0,1,0,8,0,1,0,4,0,0,38,180,0,9,0,0,
+0,1,0,8,0,1,0,4,0,0,41,96,0,9,0,0,0,1,0,8,0,1,0,4,0,0,43,66,0,9,1,0,0,1,0,
+8,0,1,0,4,0,0,64,34,0,9,0,0,0,1,0,8,0,1,0,4,0,0,80,202,0,9,0,0,0,1,0,8,0,
+1,0,4,0,0,81,228,0,9,0,0,0,1,0,8,0,1,0,4,0,0,94,138,0,9,2,0,0,1,0,8,0,1,0,
+6,0,0,95,86,0,9,3,0,0,1,0,8,0,1,0,6,0,0,98,142,0,9,0,8,0,2,0,10,0,18,0,1,
+0,2,0,0,100,236,0,1,0,2,0,0,101,180,0,1,0,12,0,100,0,3,1,70,2,248,0,2,0,14,
+2,96,2,98,0,0,2,100,2,100,0,3,2,140,2,143,0,4,3,115,3,115,0,8,4,228,4,250,
+0,9,4,252,5,0,0,32,5,3,5,5,0,37,5,8,5,18,0,40,5,24,5,30,0,51,5,33,5,45,0,
+58,5,47,5,54,0,71,5,56,5,58,0,79,5,66,5,78,0,82,6,72,6,84,0,95,0,2,0,37,0,
+36,0,61,0,0,0,68,0,93,0,26,0,130,0,152,0,52,0,154,0,184,0,75,0,186,1,66,0,
+106,1,250,2,1,0,243,2,55,2,55,0,251,2,78,2,78,0,252,2,83,2,86,0,253,2,92,
+2,95,1,1,3,26,3,29,1,5,3,50,3,55,1,9,3,66,3,73,1,15,3,94,3,97,1,23,3,108,
+3,113,1,27,3,126,3,179,1,33,3,183,3,184,1,87,3,186,3,186,1,89,3,191,3,207,
+1,90,3,216,3,216,1,107,3,221,4,25,1,108,4,30,4,31,1,169,4,34,4,158,1,171,
+5,244,6,34,2,40,6,85,6,90,2,87,6,93,6,102,2,93,6,107,6,110,2,103,6,113,6,
+128,2,107,6,131,6,156,2,123,6,165,6,172,2,149,6,175,6,200,2,157,6,205,6,230,
+2,183,8,3,8,3,2,209,8,81,8,81,2,210,8,98,8,104,2,211,8,115,8,115,2,218,8,
+118,8,118,2,219,0,108,0,0,18,220,0,0,18,220,0,0,18,220,0,2,18,226,0,0,18,
+232,0,0,18,238,0,0,18,244,0,0,18,244,0,0,18,220,0,0,18,250,0,0,18,250,0,0,
+19,0,0,0,18,250,0,0,19,6,0,0,18,250,0,0,19,12,0,0,18,250,0,0,19,18,0,0,18,
+250,0,0,19,24,0,0,19,24,0,0,18,250,0,0,18,250,0,0,19,30,0,0,19,30,0,0,19,
+30,0,1,19,36,0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,0,18,250,0,2,19,48,
+0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,2,
+19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,42,0,2,19,
+42,0,2,19,42,0,2,19,42,0,2,19,54,0,2,19,60,0,2,19,42,0,2,19,42,0,2,19,42,
+0,0,19,66,0,0,19,66,0,0,19,0,0,0,18,250,0,0,19,72,0,0,19,78,0,2,19,42,0,0,
+19,78,0,2,19,54,0,2,19,42,0,2,19,42,0,0,18,250,0,0,19,84,0,0,18,250,0,2,19,
+42,0,2,19,42,0,0,19,84,0,0,19,84,0,0,18,250,0,2,19,42,0,2,19,42,0,2,19,42,
+0,2,19,42,0,0,19,90,0,2,19,42,0,2,19,42,0,0,19,84,0,0,19,96,0,0,19,96,0,0,
+19,96,0,0,19,96,0,0,19,96,0,0,19,96,0,0,19,96,0,0,19,96,0,0,19,96,0,0,19,
+96,0,0,19,96,0,0,19,96,0,0,19,96,0,0,19,102,0,0,19,102,0,2,19,42,0,0,18,250,
+0,0,18,250,0,0,18,250,0,0,18,250,0,0,18,250,0,0,18,250,0,0,18,250,0,2,19,
+108,0,0,19,84,0,2,19,42,2,220,17,192,17,198,17,204,17,210,17,216,17,222,17,
+228,17,234,17,240,17,246,17,252,18,2,18,8,17,198,18,14,18,8,17,198,18,14,
+18,20,18,26,18,32,18,38,18,44,18,50,18,56,18,8,18,62,18,68,18,74,18,80,18,
+86,17,234,18,92,18,98,18,104,18,110,18,116,18,122,18,128,18,134,18,140,18,
+146,18,152,18,158,18,164,18,170,17,216,18,176,18,152,18,158,18,182,18,188,
+17,216,18,194,18,98,17,198,18,110,18,200,17,216,18,206,18,212,18,44,18,218,
+18,224,17,234,18,230,18,236,18,242,18,248,18,8,18,254,18,14,18,98,18,254,
+18,110,19,4,19,10,19,16,19,22,19,28,19,34,19,40,18,104,19,46,19,52,19,58,
+19,64,19,70,19,76,17,222,19,82,19,28,18,110,19,88,19,94,19,100,19,52,19,106,
+19,112,19,118,19,124,18,176,19,130,18,74,19,136,19,130,18,74,19,142,19,148,
+19,154,19,34,19,160,18,74,19,136,19,166,19,172,19,178,19,184,19,190,18,176,
+19,184,19,196,18,176,19,202,19,190,19,208,17,60,19,106,19,112,19,214,19,220,
+19,226,19,232,19,238,19,244,19,250,20,0,19,226,19,202,19,190,19,46,20,6,20,
+12,20,18,20,24,20,30,20,36,20,6,20,12,20,18,20,6,20,12,20,42,20,48,19,58,
+20,54,20,60,17,216,17,204,20,60,17,216,17,204,20,60,17,216,17,204,20,66,17,
+216,17,204,20,66,17,216,17,204,20,72,17,216,17,204,20,78,20,84,20,90,17,228,
+17,234,20,96,20,102,17,198,18,14,20,102,17,198,18,14,20,102,17,198,18,14,
+20,108,17,198,18,14,20,114,18,8,18,62,20,114,17,246,18,62,20,114,20,120,18,
+62,20,126,20,120,18,62,17,246,17,252,18,2,20,132,18,140,18,146,20,138,18,
+158,18,164,20,138,18,158,18,164,20,138,18,158,18,164,20,144,18,158,18,164,
+20,144,18,158,18,164,18,152,18,158,18,164,20,150,18,44,18,218,20,150,18,44,
+18,218,20,150,18,44,18,218,20,156,18,44,18,218,20,102,18,254,18,14,18,170,
+20,162,18,176,20,168,20,174,18,14,20,180,20,186,19,34,20,180,20,186,19,34,
+20,180,20,186,19,34,20,192,20,198,19,34,20,204,20,186,18,206,20,210,20,216,
+18,110,19,58,20,222,20,228,19,52,19,58,20,234,20,240,20,186,18,110,20,240,
+20,186,18,110,20,240,20,186,18,110,20,246,20,186,18,110,20,252,21,2,19,136,
+20,252,21,8,19,136,20,252,21,8,19,136,21,14,21,8,19,136,21,20,21,26,21,32,
+21,38,20,162,19,46,21,44,21,50,18,176,21,44,21,50,18,176,21,44,21,50,18,176,
+21,44,21,50,18,176,21,56,21,50,18,176,19,184,19,196,18,176,21,38,20,162,19,
+46,21,38,20,162,19,46,21,38,20,162,19,46,21,62,20,162,19,46,21,68,20,198,
+21,74,19,40,19,190,19,208,21,68,20,198,21,74,21,80,21,86,17,204,21,92,20,
+186,18,110,20,66,21,86,17,204,21,98,20,186,18,110,17,192,17,198,21,104,19,
+82,21,110,21,116,21,122,18,26,17,240,21,128,21,134,19,64,21,140,18,26,21,
+146,21,152,21,158,18,206,20,144,18,26,18,164,18,8,21,158,18,14,21,140,18,
+26,21,146,21,98,21,134,18,110,21,164,17,252,18,2,19,70,18,44,17,222,17,246,
+17,252,18,2,19,70,17,216,17,222,21,170,17,198,18,14,21,176,20,186,21,182,
+20,108,17,198,18,14,21,188,21,134,21,182,21,194,17,198,18,176,21,200,21,134,
+18,14,18,8,17,198,21,206,19,82,21,110,21,116,21,212,21,218,21,224,21,200,
+20,198,18,14,21,230,18,26,21,236,21,200,21,242,21,248,21,254,18,26,20,228,
+21,200,21,242,21,248,22,4,18,26,22,10,22,16,21,242,22,22,18,20,18,26,22,28,
+22,34,21,242,22,40,22,46,18,44,18,50,22,52,22,58,18,176,18,38,18,44,18,50,
+19,118,19,124,18,176,22,64,18,152,18,62,19,130,22,70,19,136,22,76,18,152,
+18,62,22,82,22,70,19,136,20,126,18,152,18,62,19,130,22,70,19,136,18,56,18,
+8,22,88,19,130,18,74,22,94,20,126,18,8,18,62,22,100,22,106,19,136,18,8,21,
+86,22,112,22,118,22,124,22,130,22,136,22,142,22,148,19,130,22,154,19,142,
+18,86,17,234,22,160,19,148,19,154,22,166,19,22,20,186,19,34,22,172,18,104,
+18,110,22,178,22,184,19,136,18,98,18,104,22,190,22,196,18,74,22,94,18,98,
+18,104,18,110,22,196,18,170,19,136,18,98,18,104,18,110,22,196,22,202,19,136,
+18,98,18,104,18,110,22,196,18,74,19,136,22,208,18,140,18,146,22,214,20,162,
+18,176,18,134,18,140,22,220,19,184,20,162,22,226,22,208,18,140,18,146,22,
+214,20,162,18,176,22,232,22,238,22,244,18,134,18,140,22,250,19,184,20,162,
+23,0,23,6,18,158,18,164,23,12,21,50,18,176,20,144,18,158,18,164,22,214,21,
+50,18,176,20,138,18,158,18,164,22,214,23,18,18,176,17,216,23,24,23,30,23,
+36,23,42,23,48,23,54,17,216,18,194,23,60,23,66,19,226,18,188,17,216,23,72,
+19,214,23,78,23,84,23,90,17,216,17,222,23,60,23,96,19,226,22,172,17,198,18,
+110,23,102,21,110,19,244,22,172,17,198,18,110,23,108,23,114,23,120,18,98,
+17,198,22,40,19,232,23,126,23,132,22,172,21,218,18,110,23,138,23,144,23,150,
+18,200,23,156,23,162,19,250,23,168,23,174,23,180,17,216,18,206,19,250,23,
+78,19,226,18,200,17,216,18,206,19,250,23,186,19,226,23,192,18,44,18,218,23,
+198,20,162,19,46,23,204,18,44,18,218,23,210,20,162,19,46,20,156,18,44,18,
+218,23,198,20,162,19,46,23,216,23,222,18,218,23,228,23,234,19,46,20,150,18,
+44,18,218,23,198,20,162,19,46,18,212,18,44,23,240,19,202,20,162,23,246,23,
+252,18,242,18,248,24,2,24,8,20,36,22,172,18,254,18,110,24,14,20,198,20,42,
+24,20,18,254,18,110,24,26,19,10,19,16,24,32,21,110,20,54,24,38,19,10,19,16,
+24,32,24,44,20,54,24,26,19,10,19,16,24,32,24,50,20,54,24,56,18,188,24,62,
+18,152,24,68,21,248,23,252,18,242,18,248,24,74,24,8,20,36,23,252,18,242,18,
+248,24,74,24,8,20,36,24,80,18,242,18,248,24,86,24,8,20,36,22,172,18,254,18,
+110,24,92,20,198,20,42,22,100,24,98,19,142,20,252,22,154,19,142,24,104,18,
+122,18,128,24,110,24,116,24,122,17,192,17,198,24,128,19,82,21,110,24,134,
+18,152,24,140,18,164,19,184,22,238,18,176,18,212,24,146,18,218,19,202,24,
+152,19,46,17,192,17,198,24,158,19,82,21,110,24,164,24,170,24,176,17,204,24,
+182,24,188,18,110,18,8,17,198,24,194,19,82,21,110,24,164,24,200,24,176,18,
+14,24,182,24,188,18,110,20,108,17,216,18,14,20,246,21,50,18,110,24,206,24,
+212,18,62,24,218,24,224,19,136,18,56,18,8,24,230,24,236,18,74,24,242,18,152,
+18,158,24,248,19,184,21,50,24,254,25,4,25,10,18,164,25,16,25,22,18,176,18,
+212,18,44,25,28,19,202,20,162,25,34,25,40,23,222,18,218,25,46,25,52,19,46,
+18,98,18,254,24,164,20,6,20,198,20,42,25,58,25,64,18,110,25,70,25,76,20,42,
+24,20,18,254,18,110,25,82,20,198,20,42,18,200,17,216,25,88,19,250,23,186,
+25,94,23,198,18,104,19,46,17,228,17,234,17,240,25,100,21,218,19,46,22,16,
+17,198,21,224,17,246,25,106,18,2,23,198,25,112,19,46,25,118,21,86,20,18,22,
+142,25,124,25,130,25,136,25,142,19,64,17,246,17,252,18,2,25,148,25,154,21,
+236,17,210,19,10,17,222,25,160,21,86,17,222,22,214,25,106,18,176,25,166,19,
+124,25,172,20,120,25,178,25,184,25,100,25,106,19,46,18,170,17,198,23,0,18,
+152,25,190,18,164,25,196,25,202,22,40,19,154,20,84,23,48,25,208,25,214,25,
+220,25,226,18,8,18,62,18,86,25,232,18,92,25,238,25,112,19,34,19,130,18,74,
+19,136,23,60,18,8,19,64,21,218,25,244,25,250,18,134,18,140,18,146,19,184,
+20,162,23,0,18,152,18,158,18,164,17,198,26,0,26,6,19,220,26,12,18,164,17,
+228,20,78,17,240,23,198,17,216,19,208,25,100,17,216,19,46,25,196,19,76,19,
+34,19,232,26,18,19,244,25,196,21,218,19,34,26,24,26,30,26,36,19,250,23,186,
+26,42,26,48,26,54,21,224,26,60,20,120,26,66,18,200,17,216,25,88,26,72,26,
+78,26,84,18,224,25,202,18,230,18,98,25,202,18,110,20,6,21,50,20,42,19,4,19,
+10,19,16,20,48,24,44,20,54,26,90,17,198,19,64,26,48,17,216,21,224,26,96,26,
+102,26,108,26,114,26,120,26,126,19,82,26,132,22,40,26,138,26,144,26,150,26,
+156,26,162,26,168,26,174,26,180,26,186,26,192,26,198,26,204,26,210,26,216,
+26,222,26,228,26,234,26,240,26,246,26,252,27,2,27,8,27,14,27,20,27,26,27,
+32,27,38,20,60,27,44,17,204,20,240,20,198,18,110,20,114,27,50,18,62,20,252,
+27,56,19,136,20,138,18,44,18,164,21,44,21,134,18,176,20,150,27,62,18,218,
+21,38,20,198,19,46,27,68,21,110,19,34,27,74,26,0,27,80,27,86,27,92,27,98,
+27,104,18,158,27,110,19,52,27,116,19,208,27,122,18,158,27,128,21,44,27,116,
+23,0,27,134,25,178,18,92,27,140,24,68,21,182,18,152,18,44,26,240,19,184,21,
+110,23,0,23,6,18,44,26,240,23,12,21,158,23,0,27,146,27,152,26,108,27,158,
+27,164,27,170,27,176,27,182,27,188,27,194,27,200,26,168,27,206,27,212,27,
+218,27,224,27,230,18,32,21,20,27,116,19,208,17,246,27,236,27,242,20,120,27,
+248,27,254,22,208,28,4,18,146,21,44,28,10,18,176,20,60,28,16,17,204,24,92,
+26,132,18,110,20,66,27,248,17,204,21,98,28,22,18,110,20,102,28,28,18,14,20,
+180,28,34,18,14,20,108,25,232,18,14,18,8,23,144,18,14,20,114,28,40,18,62,
+20,252,28,46,19,136,20,126,18,188,18,62,19,130,28,46,19,136,28,52,28,58,18,
+164,21,98,21,134,18,176,20,144,18,158,18,164,22,214,21,110,18,176,28,64,28,
+70,18,2,28,76,28,82,24,62,28,88,28,94,18,2,23,60,28,82,19,226,28,100,28,106,
+18,218,28,112,28,118,19,46,20,156,28,124,18,218,23,198,28,118,19,46,28,130,
+28,136,28,142,28,148,28,154,28,160,22,46,28,124,18,50,27,134,17,198,18,92,
+28,166,28,172,28,178,19,70,17,198,19,208,28,184,25,112,28,190,19,118,28,196,
+18,176,19,4,28,202,28,208,20,48,21,110,28,214,20,66,27,248,17,204,28,220,
+21,110,28,226,18,8,17,234,21,248,19,82,21,110,22,22,20,144,18,158,18,164,
+21,56,21,110,18,176,28,232,18,44,18,110,28,238,21,134,20,42,22,196,28,244,
+28,250,19,184,21,134,29,0,19,250,29,6,29,12,29,18,29,24,29,30,29,36,27,32,
+29,42,17,192,29,48,29,54,17,228,29,60,29,66,22,202,26,54,29,72,18,98,18,104,
+18,110,18,200,27,62,29,78,19,232,23,126,23,132,20,48,24,44,29,84,26,30,25,
+112,26,66,29,90,29,96,26,66,29,102,17,198,25,184,18,212,18,44,18,218,29,108,
+17,216,29,114,18,8,28,172,29,120,26,90,27,152,29,126,18,68,22,124,29,132,
+21,14,28,244,19,142,29,138,29,144,29,150,19,52,28,118,19,64,18,188,17,234,
+18,2,19,214,29,156,19,226,18,98,18,44,18,110,20,6,21,134,20,42,29,162,21,
+134,18,14,19,22,21,242,18,110,19,202,20,198,19,46,23,198,20,198,19,46,29,
+168,22,70,29,174,19,52,29,180,19,64,21,128,19,76,22,40,26,90,29,186,18,110,
+19,52,21,158,19,64,19,52,21,158,19,64,19,52,29,192,19,64,29,198,23,78,29,
+204,29,210,29,216,24,62,29,210,29,222,24,62,19,82,21,134,18,110,22,100,22,
+106,19,142,26,90,29,186,20,234,19,52,21,242,20,234,19,82,21,110,18,110,25,
+136,21,134,29,228,29,198,20,198,29,204,19,202,20,162,19,208,22,214,21,134,
+18,176,22,214,21,134,23,0,24,236,18,74,19,136,29,234,29,240,29,246,29,252,
+30,2,30,8,30,14,30,20,30,26,30,14,30,20,30,26,19,130,18,74,19,142,30,32,30,
+38,30,44,19,166,30,50,19,178,19,166,30,50,19,178,19,166,24,116,19,178,19,
+184,20,162,23,0,19,184,20,162,23,0,30,56,20,162,30,62,19,184,20,198,18,176,
+19,58,30,68,20,228,19,220,26,12,18,164,30,74,25,178,30,80,29,90,28,46,26,
+66,30,86,18,188,26,66,29,90,28,46,26,42,19,214,23,78,30,92,19,214,23,78,30,
+92,29,168,21,8,29,174,30,98,30,104,26,36,19,22,21,110,19,34,29,162,21,134,
+18,14,19,232,23,126,23,132,26,60,18,8,26,42,26,60,18,8,26,42,30,110,30,116,
+30,122,26,60,18,98,26,42,30,128,30,134,30,140,19,250,23,186,30,146,19,202,
+20,162,19,46,19,184,30,152,18,176,29,162,21,50,18,14,25,136,23,66,23,150,
+20,24,26,12,20,36,30,158,25,112,20,18,30,164,23,114,30,170,20,48,24,44,29,
+84,20,48,24,44,30,176,20,48,23,96,29,84,20,48,23,96,29,84,26,60,18,152,26,
+66,19,88,18,152,19,100,30,182,20,120,30,188,19,52,29,180,20,234,18,152,18,
+158,18,164,19,22,21,110,19,34,19,52,24,44,19,64,25,136,30,194,18,176,30,200,
+21,242,30,206,24,236,18,74,19,142,30,212,21,110,30,218,19,214,28,82,19,226,
+26,90,17,252,22,40,26,60,18,152,26,66,19,88,18,152,19,100,30,224,27,14,30,
+230,30,224,27,14,30,236,30,224,27,14,30,242,30,248,29,192,30,254,30,20,25,
+106,30,92,31,4,31,10,31,16,31,22,31,28,31,34,31,40,22,238,27,128,31,46,31,
+52,31,58,31,64,25,112,31,70,31,76,25,112,31,82,30,56,20,162,31,88,30,56,20,
+162,31,88,19,118,18,104,18,176,19,70,19,76,19,46,19,88,19,94,19,100,19,166,
+31,94,19,178,19,184,20,162,18,176,19,184,20,162,23,0,19,214,23,78,19,226,
+29,168,23,186,29,174,19,232,23,126,19,244,19,250,23,186,25,220,20,48,24,44,
+20,54,19,82,31,100,19,208,25,166,18,104,31,106,19,52,31,112,20,234,31,118,
+31,124,26,6,22,100,22,106,19,136,22,100,22,106,31,130,19,184,20,162,23,0,
+31,136,21,50,21,224,19,202,29,222,19,46,19,118,18,104,31,142,19,70,19,76,
+31,148,19,88,19,94,31,154,19,52,21,242,23,0,19,148,19,154,31,160,22,196,18,
+74,31,166,19,166,31,94,31,172,19,184,20,162,31,142,19,184,20,162,23,0,19,
+214,23,78,31,178,19,232,23,126,31,184,31,190,25,196,31,196,20,6,21,134,31,
+202,19,52,21,158,29,126,20,48,24,44,28,214,19,82,21,110,24,164,19,52,20,162,
+24,254,19,70,31,208,23,0,19,82,21,110,31,148,20,6,23,126,31,214,29,210,23,
+126,31,220,20,6,21,110,24,194,19,130,18,74,31,226,29,90,23,78,31,232,31,238,
+25,196,31,244,19,202,20,162,31,148,30,212,24,44,31,250,32,0,17,216,30,206,
+19,40,18,104,19,46,32,6,17,216,32,12,19,40,32,18,25,34,32,6,17,216,32,12,
+32,24,32,18,25,34,32,30,17,252,25,184,19,70,19,76,19,64,17,246,17,252,32,
+36,19,70,19,76,32,42,17,246,17,252,32,36,19,70,19,76,32,42,17,246,17,252,
+32,48,19,70,19,76,32,54,17,246,17,252,32,60,19,70,19,76,29,126,18,8,17,198,
+32,66,19,82,21,110,31,214,18,8,17,198,32,66,19,82,21,110,31,214,32,72,17,
+198,21,224,32,78,19,94,32,84,32,90,18,26,21,236,32,96,21,242,32,102,32,108,
+18,44,18,50,21,194,19,124,18,176,18,38,18,44,32,114,19,118,19,124,24,254,
+32,108,18,44,18,50,21,194,17,216,18,176,18,38,18,44,32,120,19,118,19,124,
+23,0,18,38,18,44,32,114,19,118,19,124,24,254,18,56,18,8,32,126,24,236,18,
+74,31,166,27,134,17,234,18,92,32,132,32,138,19,34,18,86,17,234,32,144,19,
+148,19,154,32,150,18,86,17,234,32,144,19,148,19,154,32,150,18,98,18,104,24,
+164,22,196,18,74,24,242,32,156,18,104,24,194,32,162,17,246,24,242,18,98,18,
+104,24,194,22,196,18,74,24,242,18,98,18,104,32,66,22,196,18,74,31,166,32,
+168,18,122,18,128,32,174,30,68,19,178,18,116,18,122,32,180,19,166,30,68,31,
+172,20,132,18,140,18,146,22,214,20,162,18,176,18,134,18,140,32,186,19,184,
+20,162,24,254,18,134,18,140,32,186,19,184,20,162,24,254,18,134,18,140,32,
+192,19,184,20,162,31,142,28,64,17,216,18,176,21,38,20,162,19,208,21,194,17,
+216,18,176,23,198,20,162,19,208,28,88,17,216,18,194,32,198,23,78,19,226,18,
+188,17,216,32,204,19,214,23,78,32,210,18,188,17,216,32,204,19,214,23,78,32,
+210,24,20,17,198,18,110,32,216,23,126,19,244,18,98,17,198,32,42,19,232,23,
+126,32,222,22,172,21,218,18,110,32,228,23,114,19,244,32,234,32,240,18,110,
+32,246,32,252,23,150,24,20,21,218,32,42,23,108,23,126,33,2,33,8,17,216,18,
+206,33,14,33,20,24,62,18,200,17,216,33,26,33,32,23,186,33,38,18,200,17,216,
+33,26,33,32,23,186,33,38,18,200,17,216,33,44,33,32,23,186,33,50,18,212,18,
+44,25,28,19,202,20,162,25,34,18,212,18,44,33,56,19,202,20,162,31,148,18,212,
+18,44,33,56,19,202,20,162,31,148,33,62,17,234,18,230,25,82,20,198,20,18,18,
+224,17,234,33,68,20,6,20,198,33,74,24,80,18,242,18,248,24,86,24,8,20,36,18,
+236,18,242,33,80,20,24,24,8,33,86,20,108,18,254,18,14,33,92,20,198,33,98,
+20,108,18,254,18,14,33,92,20,198,33,98,24,20,18,254,18,110,25,82,20,198,20,
+42,33,104,19,10,19,16,33,110,23,114,33,116,19,4,19,10,33,122,20,48,24,44,
+33,128,19,4,19,10,33,122,20,48,24,44,33,128,19,118,19,124,24,254,33,134,20,
+120,24,62,33,140,33,146,20,36,33,152,33,158,20,42,33,164,21,110,33,170,33,
+176,20,120,33,182,29,90,33,188,26,66,29,162,20,12,18,14,18,98,18,104,18,110,
+22,196,18,74,19,136,18,98,18,104,18,110,18,170,17,216,18,176,18,188,17,216,
+33,194,26,90,20,162,20,234,18,68,21,134,33,200,19,82,20,198,18,110,33,188,
+33,206,25,130,0,1,253,139,4,176,0,1,253,139,0,0,0,1,2,58,4,126,0,1,2,58,4,
+176,0,1,2,79,4,176,0,1,0,0,4,176,0,1,0,0,6,4,0,1,0,0,4,206,0,1,253,148,4,
+176,0,1,255,176,4,176,0,1,0,0,4,136,0,1,0,0,3,132,0,1,255,102,3,153,0,1,0,
+0,0,0,0,1,0,20,0,0,0,1,0,0,0,100,0,1,255,236,0,0,0,1,0,0,4,116,0,1,0,0,4,
+76,0,1,0,0,4,196,0,1,0,0,4,126,0,1,0,0,4,156,0,1,0,0,1,224,0,1,0,0,4,226,
+0,1,255,226,0,0,0,1,2,142,6,4,0,1,3,232,6,4,0,1,2,142,0,0,0,1,2,128,6,4,0,
+1,4,76,6,4,0,1,2,128,0,0,0,1,3,12,6,4,0,1,4,176,6,4,0,1,3,12,0,0,0,1,2,168,
+6,4,0,1,4,236,6,4,0,1,2,168,0,0,0,1,2,88,6,4,0,1,2,88,0,0,0,1,3,52,6,4,0,
+1,5,0,6,4,0,1,3,52,0,0,0,1,2,247,6,4,0,1,5,20,6,4,0,1,2,247,0,0,0,1,1,91,
+6,4,0,1,1,91,0,0,0,1,1,24,6,4,0,1,1,124,6,4,0,1,1,24,254,70,0,1,2,178,6,4,
+0,1,2,178,0,0,0,1,2,68,6,4,0,1,3,132,6,4,0,1,2,68,0,0,0,1,3,161,6,4,0,1,6,
+124,6,4,0,1,3,161,0,0,0,1,3,10,6,4,0,1,5,80,6,4,0,1,3,10,0,0,0,1,3,32,6,4,
+0,1,5,60,6,4,0,1,3,32,0,0,0,1,2,108,6,4,0,1,2,108,0,0,0,1,2,138,255,136,0,
+1,2,148,6,4,0,1,2,148,0,0,0,1,2,58,6,4,0,1,2,58,0,0,0,1,2,237,6,4,0,1,2,237,
+0,0,0,1,2,103,6,4,0,1,2,103,0,0,0,1,3,185,6,4,0,1,7,58,6,4,0,1,3,185,0,0,
+0,1,4,106,6,4,0,1,2,73,6,4,0,1,4,16,6,4,0,1,2,73,0,0,0,1,2,48,4,176,0,1,3,
+132,4,176,0,1,2,48,0,0,0,1,2,118,6,104,0,1,2,118,0,0,0,1,2,28,4,176,0,1,3,
+92,4,176,0,1,2,28,0,0,0,1,2,28,6,104,0,1,4,56,6,4,0,1,2,68,4,176,0,1,1,204,
+6,104,0,1,3,2,6,4,0,1,1,204,0,0,0,1,4,56,4,176,0,1,2,128,254,20,0,1,2,108,
+6,104,0,1,3,172,6,4,0,1,1,8,6,44,0,1,1,8,0,0,0,1,1,8,254,20,0,1,2,48,6,104,
+0,1,3,192,6,4,0,1,1,8,6,144,0,1,3,189,4,176,0,1,6,164,4,176,0,1,3,189,0,0,
+0,1,2,108,4,176,0,1,4,76,4,176,0,1,4,26,4,176,0,1,2,118,4,176,0,1,2,118,254,
+20,0,1,1,224,4,176,0,1,3,32,4,176,0,1,1,224,0,0,0,1,1,214,4,176,0,1,3,72,
+4,176,0,1,1,214,0,0,0,1,1,24,5,200,0,1,2,188,4,176,0,1,2,8,4,176,0,1,3,232,
+4,176,0,1,2,8,0,0,0,1,3,37,4,176,0,1,6,14,4,176,0,1,3,37,0,0,0,1,2,8,254,
+20,0,1,1,226,4,176,0,1,1,226,0,0,0,1,2,142,7,148,0,1,2,142,7,108,0,1,2,142,
+7,48,0,1,4,126,6,4,0,1,6,144,6,4,0,1,3,82,0,0,0,1,3,12,254,20,0,1,2,88,7,
+148,0,1,2,88,7,108,0,1,1,91,7,148,0,1,2,188,6,4,0,1,1,91,7,108,0,1,3,10,7,
+108,0,1,3,32,7,148,0,1,3,32,7,108,0,1,2,237,7,148,0,1,2,237,7,108,0,1,4,76,
+4,236,0,1,2,88,6,144,0,1,4,26,5,180,0,1,2,48,6,64,0,1,3,192,4,236,0,1,2,48,
+6,24,0,1,3,232,4,236,0,1,2,58,6,24,0,1,2,68,6,164,0,1,3,172,5,120,0,1,6,64,
+4,176,0,1,3,92,0,0,0,1,2,28,254,20,0,1,2,68,6,64,0,1,2,68,6,24,0,1,1,8,6,
+64,0,1,2,8,4,236,0,1,2,168,4,236,0,1,1,8,6,24,0,1,2,28,6,64,0,1,4,16,4,236,
+0,1,2,138,0,0,0,1,2,118,6,64,0,1,2,108,6,64,0,1,4,26,4,236,0,1,2,108,6,24,
+0,1,2,118,6,24,0,1,2,10,6,64,0,1,2,10,254,20,0,1,2,142,7,8,0,1,4,36,6,4,0,
+1,2,68,5,200,0,1,2,68,6,44,0,1,2,142,254,60,0,1,3,132,4,236,0,1,2,68,254,
+110,0,1,3,12,7,148,0,1,2,28,6,44,0,1,3,212,4,236,0,1,3,22,7,148,0,1,3,22,
+0,0,0,1,2,58,6,44,0,1,3,172,4,236,0,1,2,168,7,148,0,1,2,88,7,8,0,1,2,78,5,
+200,0,1,2,78,0,0,0,1,2,78,6,44,0,1,2,108,7,108,0,1,2,88,6,44,0,1,2,88,254,
+60,0,1,2,98,7,148,0,1,4,26,6,4,0,1,2,98,0,0,0,1,3,72,7,148,0,1,3,72,0,0,0,
+1,4,56,4,236,0,1,2,88,254,20,0,1,3,92,7,108,0,1,3,102,7,108,0,1,3,102,0,0,
+0,1,2,98,6,44,0,1,2,98,254,20,0,1,3,52,254,60,0,1,2,68,6,84,0,1,2,68,254,
+20,0,1,2,247,7,148,0,1,2,108,7,168,0,1,3,252,6,64,0,1,1,91,7,48,0,1,2,208,
+4,236,0,1,1,91,7,8,0,1,1,8,5,200,0,1,1,91,254,60,0,1,1,8,254,60,0,1,1,8,4,
+176,0,1,1,124,4,236,0,1,2,88,254,110,0,1,2,14,6,44,0,1,3,112,6,4,0,1,2,14,
+254,20,0,1,1,24,7,148,0,1,2,208,6,4,0,1,1,24,254,110,0,1,2,108,4,236,0,1,
+2,178,254,60,0,1,2,48,254,60,0,1,2,68,7,148,0,1,1,8,7,188,0,1,2,188,6,104,
+0,1,2,68,254,60,0,1,1,8,6,104,0,1,1,244,6,4,0,1,3,10,7,148,0,1,2,108,6,44,
+0,1,3,10,254,60,0,1,2,108,254,60,0,1,2,253,4,176,0,1,4,176,4,236,0,1,2,253,
+0,0,0,1,3,10,254,110,0,1,2,108,254,20,0,1,3,32,7,8,0,1,2,108,5,200,0,1,4,
+96,4,236,0,1,6,224,6,4,0,1,4,76,0,0,0,1,3,192,4,176,0,1,6,244,4,236,0,1,3,
+192,0,0,0,1,2,148,7,148,0,1,1,224,6,44,0,1,3,52,4,236,0,1,2,148,254,60,0,
+1,3,32,4,236,0,1,1,24,254,60,0,1,2,128,7,148,0,1,3,112,4,236,0,1,1,214,6,
+44,0,1,1,234,6,44,0,1,3,152,4,236,0,1,1,234,0,0,0,1,3,72,4,236,0,1,1,214,
+254,20,0,1,1,244,6,44,0,1,3,162,4,236,0,1,1,244,0,0,0,1,4,160,6,4,0,1,2,58,
+254,62,0,1,2,12,4,236,0,1,1,194,254,62,0,1,2,58,7,148,0,1,2,188,4,236,0,1,
+2,237,7,48,0,1,2,118,6,44,0,1,2,237,7,8,0,1,2,118,5,200,0,1,2,237,7,208,0,
+1,5,20,6,164,0,1,2,118,6,204,0,1,4,76,5,120,0,1,2,237,254,60,0,1,2,118,254,
+60,0,1,3,185,7,148,0,1,3,37,6,44,0,1,6,14,4,236,0,1,2,8,6,44,0,1,2,68,7,108,
+0,1,2,73,7,148,0,1,1,226,6,44,0,1,2,73,7,48,0,1,3,92,4,236,0,1,3,142,4,236,
+0,1,1,184,6,104,0,1,1,184,0,0,0,1,3,152,6,4,0,1,3,37,6,64,0,1,3,185,7,108,
+0,1,3,37,6,24,0,1,2,8,6,64,0,1,1,124,4,176,0,1,3,161,7,148,0,1,3,190,6,64,
+0,1,6,184,4,236,0,1,3,190,0,0,0,1,2,142,253,246,0,1,2,68,253,246,0,1,5,252,
+6,4,0,1,6,36,6,4,0,1,5,40,4,236,0,1,2,142,254,152,0,1,2,68,254,152,0,1,2,
+142,8,12,0,1,3,232,6,164,0,1,2,68,6,184,0,1,3,132,5,80,0,1,2,88,254,152,0,
+1,2,88,8,12,0,1,1,91,8,12,0,1,2,128,6,164,0,1,1,8,6,184,0,1,2,52,5,80,0,1,
+1,91,254,152,0,1,1,8,6,4,0,1,1,8,254,152,0,1,3,32,254,152,0,1,2,108,254,152,
+0,1,3,32,8,12,0,1,5,60,6,164,0,1,2,108,6,184,0,1,4,26,5,80,0,1,2,237,254,
+152,0,1,2,118,254,152,0,1,2,237,8,12,0,1,2,118,6,184,0,1,4,76,5,80,0,1,2,
+68,8,12,0,1,4,106,6,164,0,1,2,8,6,184,0,1,3,232,5,80,0,1,2,8,6,24,0,1,2,58,
+254,20,0,1,1,164,254,20,0,1,2,118,6,4,0,1,3,252,6,4,0,1,3,212,6,4,0,1,2,8,
+6,4,0,1,5,240,6,4,0,1,2,208,0,0,0,1,1,244,4,176,0,1,4,216,4,236,0,1,3,72,
+6,4,0,1,5,140,6,4,0,1,2,128,6,44,0,1,2,18,6,4,0,1,2,18,0,0,0,1,4,216,6,4,
+0,1,2,188,0,0,0,1,6,104,6,4,0,1,2,48,6,4,0,1,4,96,6,4,0,1,1,24,6,44,0,1,1,
+104,6,4,0,1,1,124,0,0,0,1,1,91,6,44,0,1,4,196,6,4,0,1,2,48,6,44,0,1,7,108,
+6,4,0,1,4,26,0,0,0,1,7,118,6,4,0,1,3,232,0,0,0,1,5,120,4,236,0,1,3,119,4,
+236,0,1,1,44,6,104,0,1,1,144,6,4,0,1,1,84,254,20,0,1,1,144,254,20,0,1,2,98,
+6,4,0,1,4,116,6,4,0,1,1,144,6,104,0,1,1,144,0,0,0,1,3,33,6,4,0,1,5,220,6,
+4,0,1,3,33,0,0,0,1,2,28,6,4,0,1,2,38,6,4,0,1,3,218,6,4,0,1,2,38,0,0,0,1,1,
+202,4,176,0,1,3,53,4,236,0,1,1,202,0,0,0,1,3,185,4,236,0,1,8,2,7,148,0,1,
+10,54,6,44,0,1,8,2,0,0,0,1,7,188,6,64,0,1,9,96,4,236,0,1,7,188,0,0,0,1,6,
+205,6,64,0,1,7,250,4,236,0,1,6,205,0,0,0,1,5,70,6,4,0,1,7,239,6,4,0,1,5,70,
+254,112,0,1,5,60,6,24,0,1,6,110,4,236,0,1,5,60,254,20,0,1,3,32,6,24,0,1,3,
+86,4,236,0,1,3,32,254,20,0,1,7,56,6,4,0,1,9,46,6,4,0,1,7,56,254,112,0,1,7,
+28,6,24,0,1,7,68,4,236,0,1,7,28,254,20,0,1,6,4,6,24,0,1,6,0,4,236,0,1,6,4,
+254,20,0,1,4,136,6,4,0,1,2,133,6,4,0,1,2,78,4,236,0,1,5,36,6,4,0,1,2,18,4,
+176,0,1,3,242,7,8,0,1,3,242,0,0,0,1,3,123,5,200,0,1,6,11,4,236,0,1,3,123,
+0,0,0,1,3,53,6,4,0,1,3,53,0,0,0,1,4,6,4,236,0,1,3,73,7,148,0,1,3,73,0,0,0,
+1,2,178,7,148,0,1,2,78,7,188,0,1,2,38,7,148,0,1,4,83,6,4,0,1,1,203,6,64,0,
+1,3,240,4,236,0,1,1,203,254,20,0,1,7,248,6,4,0,1,10,43,6,4,0,1,7,248,0,0,
+0,1,7,188,4,176,0,1,9,57,4,236,0,1,6,208,4,176,0,1,7,228,4,236,0,1,6,208,
+0,0,0,1,3,52,7,148,0,1,4,248,6,4,0,1,7,206,4,236,0,1,2,218,0,0,0,1,4,6,6,
+4,0,1,2,188,254,20,0,1,5,25,6,4,0,1,3,174,4,236,0,1,4,6,6,44,0,1,3,182,4,
+236,0,1,4,196,6,44,0,1,3,163,4,236,0,1,2,148,6,44,0,1,2,148,4,236,0,1,2,248,
+7,148,0,1,5,60,6,44,0,1,2,108,7,148,0,1,4,206,6,44,0,1,1,184,6,64,0,1,3,12,
+4,236,0,1,2,148,7,108,0,1,4,206,6,4,0,1,2,188,7,148,0,1,5,40,6,44,0,1,2,78,
+6,64,0,1,3,242,4,236,0,1,5,40,6,4,0,1,2,34,6,4,0,1,3,92,6,4,0,1,2,34,0,0,
+0,1,1,180,4,176,0,1,2,166,4,236,0,1,1,180,254,20,0,1,2,239,6,4,0,1,4,237,
+6,4,0,1,2,239,0,0,0,1,2,175,6,44,0,1,2,175,0,0,0,1,3,97,6,4,0,1,4,127,6,4,
+0,1,2,73,254,112,0,1,1,226,254,112,0,1,2,67,6,24,0,1,2,67,0,0,0,1,2,68,7,
+8,0,1,2,8,5,200,0,1,1,64,6,4,0,1,1,108,255,216,0,1,2,108,255,216,0,1,1,204,
+5,200,0,1,1,124,255,216,0,1,3,227,6,104,0,1,5,234,6,4,0,1,3,227,0,0,0,1,3,
+227,4,176,0,1,3,227,254,20,0,1,3,141,6,4,0,1,2,142,255,136,0,1,5,113,6,4,
+0,1,3,12,255,136,0,1,1,244,254,112,0,1,2,58,255,156,0,1,1,226,254,20,0,1,
+1,144,4,176,0,1,2,218,4,236,0,1,2,100,6,4,0,1,2,110,6,4,0,1,2,110,0,0,0,1,
+2,88,255,136,0,1,2,28,254,112,0,1,1,24,254,112,0,1,2,222,6,4,0,1,5,47,6,4,
+0,1,2,222,0,0,0,1,2,88,4,236,0,1,2,88,4,176,0,1,1,164,4,176,0,1,1,164,0,0,
+0,1,3,122,4,236,0,1,4,156,6,4,0,1,5,100,4,236,0,1,1,254,4,176,0,1,1,254,0,
+0,0,1,1,184,4,176,0,1,2,248,4,236,0,1,4,126,4,236,0,1,1,244,254,20,0,1,1,
+4,4,176,0,1,1,84,4,236,0,1,1,4,0,0,0,1,1,71,4,176,0,1,2,48,4,236,0,1,1,71,
+0,0,0,1,1,131,6,44,0,1,1,224,6,4,0,1,1,131,0,0,0,1,2,168,6,44,0,1,4,36,4,
+236,0,1,2,168,254,20,0,1,6,204,4,236,0,1,2,135,4,176,0,1,2,135,0,0,0,1,6,
+124,4,236,0,1,2,230,6,44,0,1,2,230,254,20,0,1,1,144,6,44,0,1,1,224,254,20,
+0,1,1,84,4,176,0,1,1,244,4,236,0,1,0,220,4,176,0,1,1,64,4,236,0,1,0,220,254,
+20,0,1,1,64,5,200,0,1,1,224,5,200,0,1,1,64,0,0,0,1,1,124,254,20,0,1,4,106,
+4,236,0,1,2,8,6,104,0,1,1,229,4,176,0,1,1,229,0,0,0,1,1,226,255,86,0,1,1,
+84,6,104,0,1,1,84,0,0,0,1,5,20,4,236,0,1,2,140,4,176,0,1,2,140,0,0,0,1,1,
+204,4,176,0,1,1,204,254,20,0,1,5,140,4,176,0,1,5,140,0,0,0,1,5,140,254,20,
+0,1,5,140,255,86,0,1,3,252,4,176,0,1,3,252,0,0,0,1,4,176,4,176,0,1,5,200,
+4,236,0,1,4,176,0,0,0,1,4,93,4,176,0,1,5,180,4,236,0,1,4,93,254,20,0,1,3,
+73,4,176,0,1,3,7,4,176,0,1,4,116,4,236,0,1,3,7,0,0,0,1,2,9,6,4,0,1,2,9,0,
+0,0,1,2,92,6,4,0,1,2,92,0,0,0,1,2,135,254,20,0,1,6,164,4,236,0,1,3,209,4,
+236,0,1,2,18,2,148,0,1,3,198,4,236,0,1,3,232,6,44,0,1,6,114,6,4,0,1,1,108,
+0,0,0,1,2,98,4,176,0,1,2,108,254,112,0,1,2,118,254,112,0,1,1,64,254,112,0,
+1,2,48,254,112,0,1,1,8,254,112,0,1,3,189,254,152,0,1,1,224,254,112,0,1,1,
+214,254,112,0,1,1,93,6,104,0,1,1,93,254,20,0,1,2,8,254,112,0,1,4,251,6,4,
+0,1,2,68,254,112,0,1,1,224,254,72,0,1,1,8,254,72,0,1,1,144,254,72,0,1,1,124,
+6,104,0,1,1,124,254,72,0,1,1,204,254,72,0,1,2,140,7,108,0,1,2,138,6,4,0,1,
+2,138,254,152,0,1,3,162,6,4,0,1,2,118,6,84,0,1,2,188,7,108,0,1,2,168,254,
+152,0,1,2,28,254,152,0,1,2,168,254,62,0,1,2,28,254,62,0,1,2,168,254,112,0,
+1,2,88,254,112,0,1,2,98,7,108,0,1,1,223,7,148,0,1,1,223,0,0,0,1,3,72,7,8,
+0,1,2,82,5,200,0,1,2,82,254,20,0,1,2,247,7,108,0,1,2,247,254,152,0,1,2,247,
+254,20,0,1,1,91,254,112,0,1,2,48,7,188,0,1,4,26,6,64,0,1,2,178,254,152,0,
+1,2,48,254,152,0,1,1,34,7,8,0,1,1,8,7,88,0,1,3,161,7,108,0,1,3,189,6,44,0,
+1,3,161,254,152,0,1,3,10,254,152,0,1,3,10,254,112,0,1,1,224,6,24,0,1,2,148,
+254,152,0,1,1,24,254,152,0,1,1,214,6,24,0,1,1,214,254,152,0,1,1,214,6,64,
+0,1,2,68,8,52,0,1,4,26,6,204,0,1,1,244,6,244,0,1,3,152,5,140,0,1,1,234,254,
+152,0,1,2,58,7,108,0,1,1,44,7,8,0,1,2,188,5,200,0,1,2,58,254,152,0,1,1,44,
+5,200,0,1,1,204,254,152,0,1,2,58,254,112,0,1,1,184,254,112,0,1,2,237,254,
+112,0,1,2,103,7,108,0,1,2,103,254,152,0,1,2,8,254,152,0,1,3,185,254,152,0,
+1,3,37,254,152,0,1,2,29,6,24,0,1,2,29,0,0,0,1,2,73,7,108,0,1,1,236,6,64,0,
+1,1,236,0,0,0,1,2,73,254,152,0,1,1,226,254,152,0,1,1,74,7,8,0,1,3,37,6,164,
+0,1,6,14,5,100,0,1,2,8,6,164,0,1,3,232,5,100,0,1,2,35,6,144,0,1,2,35,0,0,
+0,1,1,206,7,148,0,1,1,206,0,0,0,1,2,208,4,176,0,1,2,148,254,20,0,1,1,24,254,
+20,0,1,4,185,4,236,0,1,0,12,0,24,0,1,0,80,0,98,0,1,0,4,2,96,2,97,4,229,4,
+237,0,1,0,26,1,156,1,168,1,170,1,175,1,178,1,179,1,184,1,189,1,197,1,199,
+1,200,1,201,1,202,1,207,1,210,1,211,1,216,1,221,1,229,1,231,1,232,1,233,1,
+234,1,246,3,143,3,216,0,4,0,0,0,72,0,0,0,78,0,0,0,84,0,0,0,84,0,26,0,72,0,
+78,0,84,0,90,0,96,0,102,0,108,0,114,0,120,0,126,0,132,0,138,0,144,0,150,0,
+156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,204,0,210,0,216,0,222,0,1,
+253,148,4,156,0,1,253,88,4,156,0,1,0,0,4,156,0,1,2,108,7,48,0,1,2,148,7,108,
+0,1,2,142,6,4,0,1,2,108,6,4,0,1,3,10,6,4,0,1,3,42,7,108,0,1,3,32,6,4,0,1,
+2,148,6,4,0,1,3,92,6,4,0,1,2,8,6,4,0,1,3,172,6,4,0,1,2,198,6,4,0,1,2,43,4,
+176,0,1,2,68,4,176,0,1,2,148,4,176,0,1,2,148,6,44,0,1,2,108,4,176,0,1,2,8,
+4,176,0,1,3,12,4,176,0,1,1,164,4,176,0,1,2,243,4,176,0,1,2,88,4,176,0,1,2,
+78,6,4,0,1,2,8,6,44,0,1,2,188,6,4,0,1,2,48,4,176,0,1,0,12,0,18,0,1,0,148,
+0,154,0,1,0,1,4,195,0,2,0,21,0,36,0,61,0,0,0,68,0,93,0,26,0,162,0,168,0,52,
+0,170,0,177,0,59,0,180,0,184,0,67,0,186,0,191,0,72,0,193,0,193,0,78,0,243,
+0,243,0,79,1,21,1,21,0,80,3,216,3,216,0,81,4,63,4,65,0,82,4,67,4,67,0,85,
+4,71,4,71,0,86,4,74,4,75,0,87,4,77,4,77,0,89,4,83,4,83,0,90,4,87,4,87,0,91,
+4,89,4,89,0,92,4,100,4,101,0,93,4,120,4,121,0,95,4,123,4,123,0,97,0,1,0,0,
+0,204,0,98,0,204,0,210,0,216,0,222,0,228,0,228,0,234,0,240,0,246,0,252,1,
+2,1,8,1,14,1,20,1,26,1,32,1,26,1,32,1,38,1,44,1,50,1,56,1,62,1,68,1,74,1,
+68,1,80,1,86,1,92,1,98,1,104,1,110,1,116,1,86,1,122,1,128,1,134,1,140,1,146,
+1,86,1,152,1,86,1,116,1,158,1,164,1,170,1,176,1,182,1,188,1,194,1,182,1,200,
+1,80,1,80,1,80,1,80,1,80,1,80,1,206,1,104,1,104,1,104,1,104,1,122,1,122,1,
+122,1,122,1,152,1,152,1,152,1,152,1,152,1,152,1,176,1,176,1,176,1,176,1,182,
+1,182,1,212,1,218,1,224,1,152,1,230,1,86,1,236,1,224,1,242,1,248,1,254,2,
+4,1,212,2,10,1,254,2,16,1,176,2,22,2,28,0,1,254,201,2,209,0,1,2,225,5,188,
+0,1,4,96,4,126,0,1,4,100,5,117,0,1,4,237,4,126,0,1,3,211,5,182,0,1,4,188,
+5,117,0,1,4,218,5,182,0,1,1,224,5,182,0,1,1,84,5,182,0,1,4,6,5,182,0,1,1,
+87,5,182,0,1,6,83,5,182,0,1,5,38,5,182,0,1,5,110,4,126,0,1,4,66,4,126,0,1,
+3,132,5,120,0,1,4,62,5,182,0,1,4,246,5,182,0,1,4,126,5,182,0,1,6,244,5,182,
+0,1,3,232,5,182,0,1,3,252,5,182,0,1,3,152,3,132,0,1,4,16,3,132,0,1,3,72,4,
+45,0,1,4,21,6,20,0,1,3,212,3,132,0,1,2,221,6,14,0,1,4,21,4,74,0,1,1,58,4,
+74,0,1,1,64,4,74,0,1,3,92,4,74,0,1,1,58,6,20,0,1,6,154,3,132,0,1,3,232,3,
+132,0,1,2,238,4,74,0,1,2,254,4,20,0,1,2,134,4,74,0,1,4,28,4,74,0,1,3,172,
+4,74,0,1,5,200,4,74,0,1,3,102,4,74,0,1,3,60,4,74,0,1,6,54,3,132,0,1,1,59,
+4,74,0,1,6,224,3,132,0,1,3,172,3,132,0,1,3,252,4,74,0,1,3,12,3,132,0,1,3,
+32,4,16,0,1,3,42,3,132,0,1,4,6,3,132,0,1,3,172,4,94,0,1,1,224,4,74,0,1,6,
+84,4,74,0,1,4,114,4,74,0,1,2,98,4,74,0,1,0,12,0,18,0,1,0,88,0,94,0,1,0,1,
+4,251,0,2,0,11,0,36,0,61,0,0,0,68,0,93,0,26,0,148,0,149,0,52,0,151,0,151,
+0,54,0,155,0,156,0,55,0,180,0,181,0,57,0,183,0,183,0,59,0,187,0,188,0,60,
+1,42,1,43,0,62,3,70,3,73,0,64,3,94,3,97,0,68,0,1,0,0,0,152,0,72,0,152,0,158,
+0,164,0,170,0,176,0,176,0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,
+230,0,236,0,230,0,236,0,242,0,248,0,254,1,4,1,10,1,16,1,16,1,22,1,28,1,34,
+1,40,1,46,1,52,1,58,1,64,1,34,1,70,1,70,1,76,1,82,1,88,1,34,1,94,1,34,1,64,
+1,100,1,106,1,112,1,118,1,124,1,130,1,136,1,124,1,142,0,230,0,230,0,230,0,
+254,0,254,1,94,1,94,1,94,1,118,1,118,0,254,1,118,0,230,1,94,0,230,1,94,0,
+254,1,118,0,254,1,118,0,1,255,45,4,240,0,1,2,221,5,188,0,1,3,232,5,120,0,
+1,4,126,5,130,0,1,3,200,5,120,0,1,3,244,5,182,0,1,4,216,5,130,0,1,5,33,5,
+182,0,1,1,224,5,182,0,1,1,113,5,182,0,1,4,76,5,182,0,1,1,123,5,182,0,1,6,
+119,5,182,0,1,5,74,5,182,0,1,4,120,5,100,0,1,3,152,5,120,0,1,3,168,5,121,
+0,1,4,88,5,182,0,1,5,27,5,182,0,1,4,136,5,182,0,1,7,18,5,182,0,1,4,16,5,182,
+0,1,4,42,5,182,0,1,3,92,3,232,0,1,3,212,3,232,0,1,3,92,4,35,0,1,4,57,6,20,
+0,1,3,112,3,232,0,1,2,233,5,250,0,1,4,56,4,74,0,1,1,94,4,74,0,1,3,92,4,74,
+0,1,1,94,6,20,0,1,6,64,3,232,0,1,3,142,3,232,0,1,3,22,4,82,0,1,3,37,4,20,
+0,1,1,109,5,70,0,1,4,64,4,74,0,1,3,192,4,74,0,1,5,240,4,74,0,1,3,132,4,74,
+0,1,3,96,4,74,0,1,0,12,0,22,0,2,0,176,0,206,0,2,0,1,5,59,5,65,0,0,0,2,0,25,
+0,36,0,61,0,0,0,68,0,93,0,26,0,130,0,152,0,52,0,154,0,184,0,75,0,186,1,66,
+0,106,1,250,2,1,0,243,2,55,2,55,0,251,2,78,2,78,0,252,2,83,2,86,0,253,2,92,
+2,95,1,1,3,26,3,113,1,5,3,126,3,179,1,93,3,183,3,186,1,147,3,191,3,207,1,
+151,3,216,3,216,1,168,3,221,4,25,1,169,4,30,4,31,1,230,4,34,4,158,1,232,5,
+244,6,34,2,101,6,85,6,230,2,148,8,3,8,3,3,38,8,81,8,81,3,39,8,98,8,104,3,
+40,8,115,8,115,3,47,8,118,8,118,3,48,0,7,0,1,12,228,0,0,12,234,0,0,12,240,
+0,1,12,246,0,0,12,234,0,0,12,234,0,1,12,252,3,49,12,228,12,234,12,240,12,
+246,12,252,13,2,13,8,13,14,13,20,13,26,13,32,13,38,13,44,13,50,13,56,13,62,
+13,68,13,74,13,80,13,86,13,92,13,98,13,104,13,110,13,116,13,122,13,128,13,
+134,13,140,13,146,13,152,13,158,13,140,13,146,13,164,13,170,13,176,13,182,
+13,20,13,26,13,188,13,194,13,200,13,206,13,212,13,218,13,224,13,230,13,236,
+13,242,13,248,13,254,14,4,14,10,14,16,14,22,14,28,14,34,14,16,14,22,14,40,
+14,46,14,52,14,58,14,16,14,22,14,64,14,70,14,76,14,82,14,76,14,82,14,88,14,
+94,14,76,14,82,14,100,14,106,14,64,14,70,13,152,13,158,14,16,14,22,14,16,
+14,22,14,112,14,118,14,124,14,130,14,136,14,142,14,64,14,70,14,148,14,154,
+14,160,14,166,14,172,14,178,14,184,14,190,14,196,14,202,14,208,12,234,14,
+208,12,234,14,208,12,234,14,208,12,234,14,208,12,234,14,208,12,234,14,214,
+14,220,14,226,13,2,14,232,13,26,14,232,13,26,14,232,13,26,14,232,13,26,14,
+238,13,74,14,238,13,74,14,238,13,74,14,238,13,74,14,244,13,14,14,250,13,134,
+15,0,13,146,15,0,13,146,15,0,13,146,15,0,13,146,15,0,13,146,15,0,13,146,15,
+6,13,194,15,6,13,194,15,6,13,194,15,6,13,194,15,12,13,242,13,152,13,158,15,
+18,15,24,14,4,14,10,14,4,14,10,14,4,14,10,14,4,14,10,14,4,14,10,14,4,14,10,
+15,30,15,36,14,28,14,34,14,40,14,46,14,40,14,46,14,40,14,46,14,40,14,46,14,
+76,14,82,14,76,14,82,14,76,14,82,14,76,14,82,13,152,13,158,14,64,14,70,13,
+152,13,158,13,152,13,158,13,152,13,158,13,152,13,158,13,152,13,158,13,152,
+13,158,14,64,14,70,14,64,14,70,14,64,14,70,14,64,14,70,14,184,14,190,14,16,
+14,22,14,184,14,190,14,208,12,234,14,4,14,10,14,208,12,234,14,4,14,10,12,
+228,12,234,14,4,14,10,14,226,13,2,14,28,14,34,14,226,13,2,14,28,14,34,14,
+226,13,2,14,28,14,34,14,226,13,2,14,28,14,34,14,244,13,14,14,16,14,22,13,
+8,13,14,15,42,15,48,14,232,13,26,14,40,14,46,14,232,13,26,14,40,14,46,14,
+232,13,26,14,40,14,46,13,20,13,26,14,40,14,46,14,232,13,26,14,40,14,46,15,
+54,13,50,14,16,14,22,15,54,13,50,14,16,14,22,15,54,13,50,14,16,14,22,13,44,
+13,50,14,16,14,22,15,60,13,62,15,66,14,70,13,56,13,62,14,64,14,70,14,238,
+13,74,14,76,14,82,14,238,13,74,14,76,14,82,14,238,13,74,14,76,14,82,13,68,
+13,74,14,76,14,82,14,238,13,74,14,76,14,82,15,72,15,78,15,84,15,90,15,96,
+13,86,14,76,14,82,13,92,13,98,14,88,14,94,14,88,14,94,15,102,13,110,15,108,
+14,82,13,104,13,110,14,76,14,82,13,104,13,110,14,76,14,82,13,104,13,110,15,
+114,15,120,13,104,13,110,14,76,14,82,14,250,13,134,14,64,14,70,13,128,13,
+134,14,64,14,70,14,250,13,134,14,64,14,70,15,126,15,132,13,128,13,134,14,
+64,14,70,15,0,13,146,13,152,13,158,15,0,13,146,13,152,13,158,15,0,13,146,
+13,152,13,158,15,138,15,144,15,150,15,156,15,162,13,170,14,112,14,118,13,
+164,13,170,14,112,14,118,15,162,13,170,14,112,14,118,15,168,13,182,14,124,
+14,130,15,168,13,182,14,124,14,130,13,176,13,182,14,124,14,130,15,168,13,
+182,14,124,14,130,13,20,13,26,14,136,14,142,14,232,13,26,14,136,14,142,13,
+20,13,26,14,136,14,142,15,6,13,194,14,64,14,70,15,6,13,194,14,64,14,70,15,
+6,13,194,14,64,14,70,15,6,13,194,14,64,14,70,15,6,13,194,14,64,14,70,13,188,
+13,194,14,64,14,70,15,174,13,218,14,160,14,166,15,12,13,242,14,184,14,190,
+15,12,13,242,15,180,13,254,14,196,14,202,15,180,13,254,14,196,14,202,15,180,
+13,254,14,196,14,202,15,186,15,192,13,248,13,254,15,174,13,218,14,160,14,
+166,15,174,13,218,14,160,14,166,15,174,13,218,14,160,14,166,15,12,13,242,
+14,184,14,190,14,76,14,82,14,76,14,82,15,198,13,122,14,100,14,106,12,228,
+12,234,14,4,14,10,15,204,15,210,15,216,15,222,15,228,15,234,15,240,15,246,
+12,228,12,234,14,4,14,10,14,208,12,234,15,252,14,10,14,208,12,234,15,252,
+14,10,14,208,12,234,15,252,14,10,14,208,12,234,15,252,14,10,14,208,12,234,
+16,2,14,10,14,208,12,234,14,4,14,10,14,208,12,234,16,2,14,10,14,208,12,234,
+16,2,14,10,14,208,12,234,16,2,14,10,14,208,12,234,16,2,14,10,14,208,12,234,
+14,4,14,10,13,20,13,26,14,40,14,46,14,232,13,26,14,40,14,46,14,232,13,26,
+14,40,14,46,14,232,13,26,16,8,14,46,14,232,13,26,16,8,14,46,14,232,13,26,
+16,8,14,46,14,232,13,26,16,14,14,46,14,232,13,26,14,40,14,46,14,238,13,74,
+14,76,14,82,13,68,13,74,14,76,14,82,13,140,13,146,13,152,13,158,15,0,13,146,
+13,152,13,158,15,0,13,146,16,20,13,158,15,0,13,146,16,20,13,158,15,0,13,146,
+16,20,13,158,15,0,13,146,16,26,13,158,15,0,13,146,13,152,13,158,16,32,15,
+210,15,216,15,222,16,32,15,210,15,216,15,222,16,32,15,210,15,216,15,222,16,
+32,15,210,15,216,15,222,15,204,15,210,15,216,15,222,13,188,13,194,14,64,14,
+70,15,6,13,194,14,64,14,70,16,38,15,234,16,44,16,50,16,38,15,234,16,44,16,
+50,16,38,15,234,16,44,16,50,16,38,15,234,16,44,16,50,15,228,15,234,16,44,
+16,50,13,236,13,242,14,184,14,190,15,12,13,242,14,184,14,190,15,12,13,242,
+14,184,14,190,13,20,13,26,14,136,14,142,14,16,14,22,13,8,13,14,14,16,14,22,
+14,16,14,22,16,56,16,62,15,72,15,78,12,252,13,2,14,226,13,2,16,68,16,74,13,
+8,13,14,16,80,16,86,14,16,14,22,14,16,14,22,16,92,16,98,13,20,13,26,16,104,
+16,110,16,116,16,122,13,32,13,38,15,54,13,50,16,128,16,134,16,140,16,146,
+16,152,16,158,13,68,13,74,13,92,13,98,14,88,14,94,14,76,14,82,16,164,16,170,
+16,176,16,182,13,128,13,134,14,64,14,70,16,188,16,194,16,200,16,206,16,212,
+16,218,16,224,16,230,14,16,14,22,13,164,13,170,13,176,13,182,14,124,14,130,
+16,128,16,134,16,236,16,242,14,136,14,142,16,248,16,254,14,136,14,142,13,
+20,13,26,16,188,16,194,13,200,13,206,13,236,13,242,16,164,16,170,13,248,13,
+254,14,196,14,202,17,4,17,10,17,4,17,10,17,4,17,10,17,16,17,22,17,28,17,34,
+17,40,17,46,17,52,17,58,17,64,17,70,17,76,17,82,17,88,17,94,16,188,16,194,
+17,100,17,106,17,112,17,118,17,124,17,130,17,136,17,142,14,208,12,234,14,
+4,14,10,14,238,13,74,14,76,14,82,15,0,13,146,13,152,13,158,15,6,13,194,14,
+64,14,70,14,40,14,46,14,214,14,220,15,30,15,36,13,44,13,50,14,16,14,22,15,
+54,13,50,14,16,14,22,17,148,13,98,17,154,14,94,13,140,13,146,13,152,13,158,
+15,0,13,146,13,152,13,158,17,160,17,10,17,166,17,172,17,178,17,58,17,64,17,
+70,17,76,17,82,15,54,13,50,14,16,14,22,17,184,17,190,17,196,17,202,14,250,
+13,134,14,64,14,70,14,208,12,234,14,4,14,10,14,208,12,234,14,4,14,10,14,232,
+13,26,14,40,14,46,14,232,13,26,14,40,14,46,14,238,13,74,14,76,14,82,14,238,
+13,74,14,76,14,82,15,0,13,146,13,152,13,158,15,0,13,146,13,152,13,158,15,
+162,13,170,14,112,14,118,15,162,13,170,14,112,14,118,15,6,13,194,14,64,14,
+70,15,6,13,194,14,64,14,70,16,116,16,122,17,166,17,172,15,60,13,62,15,66,
+14,70,13,56,13,62,14,16,14,22,17,208,17,214,13,152,13,158,13,248,13,254,14,
+196,14,202,14,208,12,234,14,4,14,10,13,20,13,26,14,40,14,46,15,0,13,146,13,
+152,13,158,15,12,13,242,14,184,14,190,17,220,17,226,17,232,17,238,17,244,
+17,250,18,0,18,6,18,0,18,6,12,228,12,234,12,252,13,2,14,28,14,34,13,104,13,
+110,13,20,13,26,14,124,14,130,14,196,14,202,18,12,18,18,18,24,18,30,12,240,
+12,246,13,188,13,194,18,36,18,42,13,20,13,26,14,40,14,46,13,80,13,86,14,76,
+14,82,18,48,18,54,14,16,14,22,13,164,13,170,14,112,14,118,13,236,13,242,14,
+184,14,190,14,4,14,10,14,16,14,22,14,16,14,22,14,16,14,22,14,28,14,34,18,
+60,18,66,14,16,14,22,14,16,14,22,14,40,14,46,14,40,14,46,18,72,18,78,18,84,
+18,90,17,16,17,22,12,240,12,246,13,200,13,206,14,76,14,82,14,16,14,22,14,
+16,14,22,18,96,18,102,14,148,14,154,14,148,14,154,14,64,14,70,14,64,14,70,
+14,64,14,70,14,76,14,82,18,108,18,114,18,120,18,126,18,132,18,138,18,144,
+18,150,18,156,18,162,18,168,18,174,14,100,14,106,14,100,14,106,14,100,14,
+106,14,64,14,70,14,64,14,70,12,252,13,2,13,152,13,158,15,30,15,36,16,188,
+16,194,18,180,18,186,14,112,14,118,14,112,14,118,14,112,14,118,14,112,14,
+118,14,112,14,118,18,108,18,114,18,108,18,114,18,192,18,198,18,192,18,198,
+14,124,14,130,14,76,14,82,14,76,14,82,14,76,14,82,14,76,14,82,14,136,14,142,
+14,136,14,142,14,64,14,70,13,152,13,158,18,204,18,210,14,148,14,154,14,160,
+14,166,14,184,14,190,18,216,18,222,14,196,14,202,16,164,16,170,17,166,17,
+172,17,166,17,172,18,228,18,234,18,228,18,234,18,228,18,234,18,240,18,246,
+13,140,13,146,16,248,16,254,13,200,13,206,18,96,18,102,18,252,19,2,14,76,
+14,82,14,88,14,94,19,8,19,14,14,16,14,22,18,228,18,234,18,228,18,234,19,20,
+19,26,19,32,19,38,19,44,19,50,19,56,19,62,19,68,19,74,19,80,19,86,19,80,19,
+86,19,92,19,98,19,104,19,110,19,68,19,74,19,116,19,122,19,128,19,134,19,128,
+19,134,14,16,14,22,14,16,14,22,14,52,14,58,14,100,14,106,14,64,14,70,14,16,
+14,22,14,112,14,118,18,108,18,114,14,124,14,130,14,136,14,142,14,196,14,202,
+14,16,14,22,19,140,19,146,13,224,13,230,19,152,19,158,14,76,14,82,18,108,
+18,114,14,16,14,22,19,164,19,170,13,152,13,158,14,16,14,22,14,16,14,22,14,
+52,14,58,15,228,15,234,14,88,14,94,14,76,14,82,14,100,14,106,14,64,14,70,
+14,16,14,22,14,112,14,118,14,124,14,130,19,176,19,182,14,148,14,154,14,172,
+14,178,14,196,14,202,14,4,14,10,14,16,14,22,14,16,14,22,14,40,14,46,19,188,
+19,194,17,16,17,22,19,200,19,206,14,76,14,82,14,28,14,34,14,76,14,82,14,64,
+14,70,17,16,17,22,19,212,12,246,14,16,14,22,12,240,12,246,14,16,14,22,12,
+240,12,246,14,16,14,22,14,226,13,2,14,28,14,34,14,244,13,14,14,16,14,22,13,
+8,13,14,14,16,14,22,13,8,13,14,14,16,14,22,13,8,13,14,14,16,14,22,13,8,13,
+14,14,16,14,22,14,232,13,26,16,14,14,46,14,232,13,26,16,14,14,46,13,20,13,
+26,14,40,14,46,13,20,13,26,14,40,14,46,14,232,13,26,14,40,14,46,19,218,13,
+38,19,224,14,58,15,54,13,50,14,16,14,22,15,60,13,62,15,66,14,70,13,56,13,
+62,14,64,14,70,15,60,13,62,15,66,14,70,13,56,13,62,14,64,14,70,13,56,13,62,
+14,64,14,70,13,68,13,74,14,76,14,82,14,238,13,74,15,108,14,82,17,148,13,98,
+17,154,14,94,13,92,13,98,14,88,14,94,13,92,13,98,14,88,14,94,13,104,13,110,
+14,76,14,82,15,102,13,110,15,108,14,82,13,104,13,110,14,76,14,82,13,104,13,
+110,14,76,14,82,15,198,13,122,14,100,14,106,13,116,13,122,14,100,14,106,14,
+250,13,134,14,64,14,70,13,128,13,134,14,64,14,70,13,128,13,134,14,64,14,70,
+13,128,13,134,14,64,14,70,15,0,13,146,16,26,13,158,15,0,13,146,16,26,13,158,
+15,0,13,146,16,26,13,158,15,0,13,146,16,26,13,158,16,26,13,158,14,16,14,22,
+16,26,13,158,14,16,14,22,15,162,13,170,14,112,14,118,13,164,13,170,14,112,
+14,118,15,162,13,170,14,112,14,118,13,164,13,170,14,112,14,118,15,168,13,
+182,14,124,14,130,13,176,13,182,14,124,14,130,15,168,13,182,14,124,14,130,
+15,168,13,182,14,124,14,130,15,168,13,182,14,124,14,130,14,232,13,26,19,230,
+14,142,13,20,13,26,14,136,14,142,13,20,13,26,14,136,14,142,13,20,13,26,14,
+136,14,142,13,188,13,194,14,64,14,70,13,188,13,194,14,64,14,70,13,188,13,
+194,14,64,14,70,15,6,13,194,15,66,14,70,15,6,13,194,15,66,14,70,19,236,13,
+206,14,148,14,154,13,200,13,206,14,148,14,154,13,212,13,218,14,160,14,166,
+13,212,13,218,14,160,14,166,19,242,13,230,14,172,14,178,19,242,13,230,14,
+172,14,178,15,12,13,242,14,184,14,190,15,180,13,254,14,196,14,202,13,248,
+13,254,14,196,14,202,13,248,13,254,14,196,14,202,14,64,14,70,19,230,14,142,
+19,248,14,166,19,254,14,190,14,4,14,10,20,4,15,192,20,10,20,16,20,22,20,28,
+13,104,13,110,14,76,14,82,13,104,13,110,13,152,13,158,13,164,13,170,14,4,
+14,10,14,136,14,142,14,148,14,154,18,180,18,186,0,1,2,105,0,60,0,1,2,105,
+4,74,0,1,1,168,4,74,0,1,1,168,0,40,0,1,2,78,0,0,0,1,5,29,6,4,0,1,5,29,254,
+132,0,1,5,51,6,4,0,1,5,51,254,132,0,1,5,14,6,4,0,1,5,14,254,132,0,1,5,215,
+6,4,0,1,5,215,254,132,0,1,4,115,6,4,0,1,4,115,254,132,0,1,4,39,6,4,0,1,4,
+39,254,132,0,1,5,211,6,4,0,1,5,211,254,132,0,1,5,238,6,4,0,1,5,238,254,132,
+0,1,2,182,6,4,0,1,2,182,254,132,0,1,2,47,6,4,0,1,2,47,254,132,0,1,4,244,6,
+4,0,1,4,244,254,132,0,1,4,49,6,4,0,1,4,49,254,132,0,1,7,66,6,4,0,1,7,66,254,
+132,0,1,6,20,6,4,0,1,6,20,254,132,0,1,6,63,6,4,0,1,6,63,254,132,0,1,4,215,
+6,4,0,1,4,215,254,132,0,1,4,250,6,4,0,1,4,250,254,132,0,1,4,100,6,4,0,1,4,
+100,254,132,0,1,5,217,6,4,0,1,5,217,254,132,0,1,4,205,6,4,0,1,4,205,254,132,
+0,1,7,113,6,4,0,1,7,113,254,132,0,1,4,176,6,4,0,1,4,176,254,132,0,1,4,135,
+6,4,0,1,4,135,254,132,0,1,4,147,6,4,0,1,4,147,254,132,0,1,4,125,6,4,0,1,4,
+125,254,132,0,1,4,236,6,4,0,1,4,236,254,132,0,1,3,215,6,4,0,1,3,215,254,132,
+0,1,4,131,6,4,0,1,4,131,254,132,0,1,2,193,6,4,0,1,2,193,254,132,0,1,4,242,
+6,4,0,1,4,242,254,132,0,1,2,16,6,4,0,1,2,16,254,132,0,1,4,70,6,4,0,1,4,70,
+254,132,0,1,7,123,6,4,0,1,7,123,254,132,0,1,3,78,6,4,0,1,3,78,254,132,0,1,
+3,213,6,4,0,1,3,213,254,132,0,1,2,227,6,4,0,1,2,227,254,132,0,1,4,16,6,4,
+0,1,4,16,254,132,0,1,6,74,6,4,0,1,6,74,254,132,0,1,4,59,6,4,0,1,4,59,254,
+132,0,1,4,20,6,4,0,1,4,20,254,132,0,1,3,195,6,4,0,1,3,195,254,132,0,1,5,29,
+7,48,0,1,7,12,7,48,0,1,7,12,254,132,0,1,5,14,7,48,0,1,4,115,7,48,0,1,2,182,
+7,48,0,1,5,215,7,48,0,1,6,20,7,48,0,1,6,63,7,48,0,1,5,217,7,48,0,1,4,135,
+7,48,0,1,5,12,6,4,0,1,5,12,254,132,0,1,6,233,6,4,0,1,6,233,254,132,0,1,4,
+240,6,4,0,1,4,240,254,132,0,1,5,211,7,48,0,1,5,238,7,48,0,1,4,242,7,48,0,
+1,4,229,6,4,0,1,4,229,254,132,0,1,4,29,6,44,0,1,4,29,254,132,0,1,2,47,7,48,
+0,1,4,49,7,48,0,1,2,16,7,48,0,1,2,154,6,4,0,1,2,154,254,132,0,1,5,135,6,4,
+0,1,5,135,254,132,0,1,7,109,6,4,0,1,7,109,254,132,0,1,7,145,6,4,0,1,7,145,
+254,132,0,1,4,250,7,48,0,1,4,100,7,48,0,1,7,113,7,48,0,1,4,147,7,48,0,1,2,
+156,6,4,0,1,2,156,254,132,0,1,7,66,7,48,0,1,6,70,6,4,0,1,6,70,254,132,0,1,
+4,238,6,4,0,1,4,238,254,132,0,1,6,61,6,4,0,1,6,61,254,132,0,1,5,59,6,4,0,
+1,5,59,254,132,0,1,4,125,6,104,0,1,4,125,7,48,0,1,4,131,6,104,0,1,4,131,7,
+48,0,1,4,215,6,104,0,1,4,215,7,48,0,1,6,70,7,48,0,1,6,61,7,48,0,1,5,100,6,
+4,0,1,5,100,254,132,0,1,5,20,6,4,0,1,5,20,254,132,0,1,4,6,6,4,0,1,4,6,254,
+132,0,1,6,123,6,4,0,1,6,123,254,132,0,1,4,213,6,4,0,1,4,213,254,132,0,1,5,
+233,6,4,0,1,5,233,254,132,0,1,4,180,6,4,0,1,4,180,254,132,0,1,4,143,6,4,0,
+1,4,143,254,132,0,1,7,121,6,4,0,1,7,121,254,132,0,1,2,201,6,4,0,1,2,201,254,
+132,0,1,4,86,6,4,0,1,4,86,254,132,0,1,8,61,6,4,0,1,8,61,254,132,0,1,6,66,
+6,4,0,1,6,66,254,132,0,1,8,154,6,4,0,1,8,154,254,132,0,1,6,195,6,4,0,1,6,
+195,254,132,0,1,5,123,6,4,0,1,5,123,254,132,0,1,2,121,6,4,0,1,2,121,254,132,
+0,1,4,156,6,4,0,1,4,156,254,132,0,1,4,172,6,4,0,1,4,172,254,132,0,1,3,236,
+6,4,0,1,3,236,254,132,0,1,3,180,6,4,0,1,3,180,254,132,0,1,4,178,6,4,0,1,4,
+178,254,132,0,1,10,86,7,48,0,1,10,86,254,132,0,1,9,154,6,4,0,1,9,154,254,
+132,0,1,8,174,6,4,0,1,8,174,254,132,0,1,6,96,6,4,0,1,6,96,254,132,0,1,4,33,
+6,4,0,1,4,33,254,132,0,1,8,68,6,4,0,1,8,68,254,132,0,1,8,37,6,4,0,1,8,37,
+254,132,0,1,7,2,6,4,0,1,7,2,254,132,0,1,4,244,7,48,0,1,4,70,7,48,0,1,4,172,
+7,48,0,1,3,252,6,4,0,1,3,252,254,132,0,1,10,86,6,4,0,1,7,129,6,4,0,1,7,129,
+254,132,0,1,5,74,6,4,0,1,5,74,254,132,0,1,5,94,6,4,0,1,5,94,254,132,0,1,3,
+12,6,4,0,1,3,12,254,132,0,1,5,246,6,4,0,1,5,246,254,132,0,1,3,27,6,4,0,1,
+3,27,254,132,0,1,7,199,6,4,0,1,7,199,254,132,0,1,3,150,6,4,0,1,3,150,254,
+132,0,1,3,125,6,4,0,1,3,125,254,132,0,1,4,221,6,4,0,1,4,221,254,132,0,1,6,
+35,6,4,0,1,6,35,254,132,0,1,4,63,6,4,0,1,4,63,254,132,0,1,6,27,6,4,0,1,6,
+27,254,132,0,1,3,221,6,4,0,1,3,221,254,132,0,1,4,152,6,4,0,1,4,152,254,132,
+0,1,2,197,6,4,0,1,2,197,254,132,0,1,2,143,6,4,0,1,2,143,254,132,0,1,3,6,6,
+4,0,1,3,6,254,132,0,1,2,205,6,4,0,1,2,205,254,132,0,1,2,14,6,4,0,1,2,14,254,
+132,0,1,5,66,6,4,0,1,5,66,254,132,0,1,5,205,6,4,0,1,5,205,254,132,0,1,4,121,
+6,4,0,1,4,121,254,132,0,1,4,231,6,4,0,1,4,231,254,132,0,1,3,203,6,4,0,1,3,
+203,254,132,0,1,3,104,6,4,0,1,3,104,254,132,0,1,3,193,6,4,0,1,3,193,254,132,
+0,1,5,25,6,4,0,1,5,25,254,132,0,1,3,123,6,4,0,1,3,123,254,132,0,1,7,174,6,
+4,0,1,7,174,254,132,0,1,7,217,6,4,0,1,7,217,254,132,0,1,8,66,6,4,0,1,8,66,
+254,132,0,1,6,18,6,4,0,1,6,18,254,132,0,1,4,18,6,4,0,1,4,18,254,132,0,1,6,
+229,6,4,0,1,6,229,254,132,0,1,5,76,6,4,0,1,5,76,254,132,0,1,4,211,6,4,0,1,
+4,211,254,132,0,1,4,184,6,4,0,1,4,184,254,132,0,1,5,4,6,4,0,1,5,4,254,132,
+0,1,4,37,6,4,0,1,4,37,254,132,0,1,7,213,6,4,0,1,7,213,254,132,0,1,4,197,6,
+4,0,1,4,197,254,132,0,1,3,100,6,4,0,1,3,100,254,132,0,1,3,242,6,4,0,1,3,242,
+254,132,0,1,5,49,6,4,0,1,5,49,254,132,0,1,5,51,7,48,0,1,4,39,7,48,0,1,2,193,
+7,48,0,1,2,227,7,48,0,1,4,205,7,48,0,1,4,176,7,48,0,1,6,74,6,104,0,1,4,20,
+6,104,0,1,2,156,7,48,0,1,3,127,6,4,0,1,3,127,254,132,0,1,4,193,6,4,0,1,4,
+193,254,132,0,1,0,12,0,22,0,2,0,176,0,194,0,2,0,1,8,139,8,142,0,0,0,2,0,25,
+0,36,0,61,0,0,0,68,0,93,0,26,0,130,0,152,0,52,0,154,0,184,0,75,0,186,1,66,
+0,106,1,250,2,1,0,243,2,55,2,55,0,251,2,78,2,78,0,252,2,83,2,86,0,253,2,92,
+2,95,1,1,3,26,3,113,1,5,3,126,3,179,1,93,3,183,3,186,1,147,3,191,3,207,1,
+151,3,216,3,216,1,168,3,221,4,25,1,169,4,30,4,31,1,230,4,34,4,158,1,232,5,
+244,6,34,2,101,6,85,6,230,2,148,8,3,8,3,3,38,8,81,8,81,3,39,8,98,8,104,3,
+40,8,115,8,115,3,47,8,118,8,118,3,48,0,4,0,0,12,216,0,1,12,216,0,0,12,216,
+0,1,12,216,3,49,12,204,12,210,12,216,12,210,12,222,12,210,12,228,12,210,12,
+234,12,210,12,240,12,210,12,246,12,210,12,252,12,210,13,2,12,210,13,8,12,
+210,13,14,12,210,13,20,12,210,13,26,12,210,13,32,12,210,13,38,12,210,13,44,
+12,210,13,38,12,210,13,50,12,210,13,56,12,210,12,234,12,210,13,62,12,210,
+13,68,12,210,13,74,12,210,13,80,12,210,13,86,12,210,13,92,12,210,13,98,12,
+210,13,104,12,210,13,110,12,210,13,104,12,210,13,116,12,210,13,122,12,210,
+13,104,12,210,13,128,12,210,13,134,12,210,13,134,12,210,13,140,12,210,13,
+134,12,210,13,146,12,210,13,128,12,210,13,44,12,210,13,104,12,210,13,104,
+12,210,13,152,12,210,13,158,12,210,13,164,12,210,13,128,12,210,13,170,12,
+210,13,176,12,210,13,182,12,210,13,188,12,210,13,194,12,210,12,204,12,210,
+12,204,12,210,12,204,12,210,12,204,12,210,12,204,12,210,12,204,12,210,13,
+200,12,210,12,222,12,210,12,234,12,210,12,234,12,210,12,234,12,210,12,234,
+12,210,13,2,12,210,13,2,12,210,13,2,12,210,13,2,12,210,12,228,12,210,13,32,
+12,210,13,38,12,210,13,38,12,210,13,38,12,210,13,38,12,210,13,38,12,210,13,
+38,12,210,13,62,12,210,13,62,12,210,13,62,12,210,13,62,12,210,13,86,12,210,
+13,44,12,210,13,206,12,210,13,98,12,210,13,98,12,210,13,98,12,210,13,98,12,
+210,13,98,12,210,13,98,12,210,13,212,12,210,13,110,12,210,13,116,12,210,13,
+116,12,210,13,116,12,210,13,116,12,210,13,134,12,210,13,134,12,210,13,134,
+12,210,13,134,12,210,13,44,12,210,13,128,12,210,13,44,12,210,13,44,12,210,
+13,44,12,210,13,44,12,210,13,44,12,210,13,44,12,210,13,128,12,210,13,128,
+12,210,13,128,12,210,13,128,12,210,13,188,12,210,13,104,12,210,13,188,12,
+210,12,204,12,210,13,98,12,210,12,204,12,210,13,98,12,210,12,204,12,210,13,
+98,12,210,12,222,12,210,13,110,12,210,12,222,12,210,13,110,12,210,12,222,
+12,210,13,110,12,210,12,222,12,210,13,110,12,210,12,228,12,210,13,104,12,
+210,12,228,12,210,13,218,12,210,12,234,12,210,13,116,12,210,12,234,12,210,
+13,116,12,210,12,234,12,210,13,116,12,210,12,234,12,210,13,116,12,210,12,
+234,12,210,13,116,12,210,12,246,12,210,13,104,12,210,12,246,12,210,13,104,
+12,210,12,246,12,210,13,104,12,210,12,246,12,210,13,104,12,210,12,252,12,
+210,13,128,12,210,12,252,12,210,13,128,12,210,13,2,12,210,13,134,12,210,13,
+2,12,210,13,134,12,210,13,2,12,210,13,134,12,210,13,2,12,210,13,134,12,210,
+13,2,12,210,13,134,12,210,13,224,12,210,13,230,12,210,13,8,12,210,13,134,
+12,210,13,14,12,210,13,140,12,210,13,140,12,210,13,20,12,210,13,134,12,210,
+13,20,12,210,13,134,12,210,13,20,12,210,13,134,12,210,13,20,12,210,13,236,
+12,210,13,20,12,210,13,134,12,210,13,32,12,210,13,128,12,210,13,32,12,210,
+13,128,12,210,13,32,12,210,13,128,12,210,13,242,12,210,13,32,12,210,13,128,
+12,210,13,38,12,210,13,44,12,210,13,38,12,210,13,44,12,210,13,38,12,210,13,
+44,12,210,13,248,12,210,13,254,12,210,13,50,12,210,13,152,12,210,13,50,12,
+210,13,152,12,210,13,50,12,210,13,152,12,210,13,56,12,210,13,158,12,210,13,
+56,12,210,13,158,12,210,13,56,12,210,13,158,12,210,13,56,12,210,13,158,12,
+210,12,234,12,210,13,164,12,210,12,234,12,210,13,164,12,210,12,234,12,210,
+13,164,12,210,13,62,12,210,13,128,12,210,13,62,12,210,13,128,12,210,13,62,
+12,210,13,128,12,210,13,62,12,210,13,128,12,210,13,62,12,210,13,128,12,210,
+13,62,12,210,13,128,12,210,13,74,12,210,13,176,12,210,13,86,12,210,13,188,
+12,210,13,86,12,210,13,92,12,210,13,194,12,210,13,92,12,210,13,194,12,210,
+13,92,12,210,13,194,12,210,14,4,12,210,13,92,12,210,13,74,12,210,13,176,12,
+210,13,74,12,210,13,176,12,210,13,74,12,210,13,176,12,210,13,86,12,210,13,
+188,12,210,13,134,12,210,13,134,12,210,13,26,12,210,13,146,12,210,12,204,
+12,210,13,98,12,210,14,10,12,210,14,16,12,210,14,22,12,210,14,28,12,210,12,
+204,12,210,13,98,12,210,12,204,12,210,13,98,12,210,12,204,12,210,13,98,12,
+210,12,204,12,210,13,98,12,210,12,204,12,210,13,98,12,210,12,204,12,210,13,
+98,12,210,12,204,12,210,13,98,12,210,12,204,12,210,13,98,12,210,12,204,12,
+210,13,98,12,210,12,204,12,210,13,98,12,210,12,204,12,210,13,98,12,210,12,
+204,12,210,13,98,12,210,12,234,12,210,13,116,12,210,12,234,12,210,13,116,
+12,210,12,234,12,210,13,116,12,210,12,234,12,210,13,116,12,210,12,234,12,
+210,13,116,12,210,12,234,12,210,13,116,12,210,12,234,12,210,13,116,12,210,
+12,234,12,210,13,116,12,210,13,2,12,210,13,134,12,210,13,2,12,210,13,134,
+12,210,13,38,12,210,13,44,12,210,13,38,12,210,13,44,12,210,13,38,12,210,13,
+44,12,210,13,38,12,210,13,44,12,210,13,38,12,210,13,44,12,210,13,38,12,210,
+13,44,12,210,13,38,12,210,13,44,12,210,14,10,12,210,14,16,12,210,14,10,12,
+210,14,16,12,210,14,10,12,210,14,16,12,210,14,10,12,210,14,16,12,210,14,10,
+12,210,14,16,12,210,13,62,12,210,13,128,12,210,13,62,12,210,13,128,12,210,
+14,22,12,210,14,34,12,210,14,22,12,210,14,34,12,210,14,22,12,210,14,34,12,
+210,14,22,12,210,14,34,12,210,14,22,12,210,14,34,12,210,13,86,12,210,13,188,
+12,210,13,86,12,210,13,188,12,210,13,86,12,210,13,188,12,210,12,234,12,210,
+13,164,12,210,13,104,12,210,12,228,12,210,13,104,12,210,13,104,12,210,14,
+40,12,210,13,224,12,210,12,222,12,210,12,222,12,210,14,46,12,210,12,228,12,
+210,14,52,12,210,13,104,12,210,13,104,12,210,14,58,12,210,12,234,12,210,14,
+64,12,210,14,70,12,210,12,240,12,210,12,246,12,210,14,76,12,210,14,82,12,
+210,14,88,12,210,13,2,12,210,13,14,12,210,13,140,12,210,13,134,12,210,14,
+94,12,210,14,100,12,210,13,32,12,210,13,128,12,210,14,106,12,210,14,112,12,
+210,14,118,12,210,14,124,12,210,13,104,12,210,13,50,12,210,13,56,12,210,13,
+158,12,210,14,76,12,210,14,130,12,210,13,164,12,210,14,136,12,210,13,164,
+12,210,12,234,12,210,14,106,12,210,13,68,12,210,13,86,12,210,14,94,12,210,
+13,92,12,210,13,194,12,210,14,142,12,210,14,142,12,210,14,142,12,210,14,148,
+12,210,14,154,12,210,14,160,12,210,14,166,12,210,14,172,12,210,14,178,12,
+210,14,184,12,210,14,106,12,210,14,190,12,210,14,196,12,210,14,202,12,210,
+14,208,12,210,12,204,12,210,13,98,12,210,13,2,12,210,13,134,12,210,13,38,
+12,210,13,44,12,210,13,62,12,210,13,128,12,210,13,116,12,210,13,200,12,210,
+13,212,12,210,12,246,12,210,13,104,12,210,12,246,12,210,13,104,12,210,13,
+14,12,210,13,140,12,210,13,38,12,210,13,44,12,210,13,38,12,210,13,44,12,210,
+14,142,12,210,14,214,12,210,14,166,12,210,14,172,12,210,14,178,12,210,12,
+246,12,210,13,104,12,210,14,220,12,210,14,226,12,210,13,32,12,210,13,128,
+12,210,12,204,12,210,13,98,12,210,12,204,12,210,13,98,12,210,12,234,12,210,
+13,116,12,210,12,234,12,210,13,116,12,210,13,2,12,210,13,134,12,210,13,2,
+12,210,13,134,12,210,13,38,12,210,13,44,12,210,13,38,12,210,13,44,12,210,
+13,50,12,210,13,152,12,210,13,50,12,210,13,152,12,210,13,62,12,210,13,128,
+12,210,13,62,12,210,13,128,12,210,14,70,12,210,14,214,12,210,12,252,12,210,
+13,128,12,210,12,252,12,210,13,104,12,210,14,232,12,210,13,44,12,210,13,92,
+12,210,13,194,12,210,12,204,12,210,13,98,12,210,12,234,12,210,13,116,12,210,
+13,38,12,210,13,44,12,210,13,86,12,210,13,188,12,210,14,238,12,210,14,244,
+12,210,14,250,12,210,15,0,12,210,15,0,12,210,12,204,12,210,12,222,12,210,
+13,110,12,210,13,20,12,210,12,234,12,210,13,158,12,210,13,194,12,210,15,6,
+12,210,15,12,12,210,12,216,12,210,13,62,12,210,15,18,12,210,12,234,12,210,
+13,116,12,210,13,8,12,210,13,134,12,210,15,24,12,210,13,104,12,210,13,50,
+12,210,13,152,12,210,13,86,12,210,13,188,12,210,13,98,12,210,13,104,12,210,
+13,104,12,210,13,104,12,210,13,110,12,210,15,30,12,210,13,104,12,210,13,104,
+12,210,13,116,12,210,13,116,12,210,15,36,12,210,15,42,12,210,14,148,12,210,
+12,216,12,210,13,68,12,210,13,134,12,210,13,104,12,210,13,104,12,210,15,48,
+12,210,13,170,12,210,13,170,12,210,13,128,12,210,13,128,12,210,13,128,12,
+210,13,134,12,210,15,54,12,210,15,60,12,210,15,66,12,210,15,72,12,210,15,
+78,12,210,15,84,12,210,13,146,12,210,13,146,12,210,13,146,12,210,13,128,12,
+210,13,128,12,210,12,222,12,210,13,44,12,210,13,212,12,210,14,106,12,210,
+15,90,12,210,13,152,12,210,13,152,12,210,13,152,12,210,13,152,12,210,13,152,
+12,210,15,54,12,210,15,54,12,210,15,96,12,210,15,96,12,210,13,158,12,210,
+13,134,12,210,13,134,12,210,13,134,12,210,13,134,12,210,13,164,12,210,13,
+164,12,210,13,128,12,210,13,44,12,210,15,102,12,210,13,170,12,210,13,176,
+12,210,13,188,12,210,15,108,12,210,13,194,12,210,14,94,12,210,14,214,12,210,
+14,214,12,210,15,114,12,210,15,114,12,210,15,114,12,210,15,120,12,210,13,
+38,12,210,14,136,12,210,13,68,12,210,15,48,12,210,15,126,12,210,13,134,12,
+210,13,140,12,210,15,132,12,210,13,104,12,210,15,114,12,210,15,114,12,210,
+15,138,12,210,15,144,12,210,15,150,12,210,15,156,12,210,15,162,12,210,15,
+168,12,210,15,168,12,210,15,174,12,210,15,180,12,210,15,162,12,210,15,186,
+12,210,15,192,12,210,15,192,12,210,13,104,12,210,13,104,12,210,13,122,12,
+210,13,146,12,210,13,128,12,210,13,104,12,210,13,152,12,210,15,54,12,210,
+13,158,12,210,13,164,12,210,13,194,12,210,13,104,12,210,15,198,12,210,13,
+80,12,210,15,204,12,210,13,134,12,210,15,54,12,210,13,104,12,210,15,210,12,
+210,13,44,12,210,13,104,12,210,13,104,12,210,13,122,12,210,14,22,12,210,13,
+140,12,210,13,134,12,210,13,146,12,210,13,128,12,210,13,104,12,210,13,152,
+12,210,13,158,12,210,15,216,12,210,13,170,12,210,13,182,12,210,13,194,12,
+210,13,98,12,210,13,104,12,210,13,104,12,210,13,116,12,210,15,222,12,210,
+14,148,12,210,15,228,12,210,13,134,12,210,13,110,12,210,13,134,12,210,13,
+128,12,210,14,148,12,210,12,216,12,210,13,104,12,210,12,216,12,210,13,104,
+12,210,12,216,12,210,13,104,12,210,12,222,12,210,13,110,12,210,12,228,12,
+210,13,104,12,210,12,228,12,210,13,104,12,210,12,228,12,210,13,104,12,210,
+12,228,12,210,13,104,12,210,12,228,12,210,13,104,12,210,12,234,12,210,13,
+116,12,210,12,234,12,210,13,116,12,210,12,234,12,210,13,116,12,210,12,234,
+12,210,13,116,12,210,12,234,12,210,13,116,12,210,12,240,12,210,13,122,12,
+210,12,246,12,210,13,104,12,210,12,252,12,210,13,128,12,210,12,252,12,210,
+13,128,12,210,12,252,12,210,13,128,12,210,12,252,12,210,13,128,12,210,12,
+252,12,210,13,128,12,210,13,2,12,210,13,134,12,210,13,2,12,210,13,134,12,
+210,13,14,12,210,13,140,12,210,13,14,12,210,13,140,12,210,13,14,12,210,13,
+140,12,210,13,20,12,210,13,134,12,210,13,20,12,210,13,134,12,210,13,20,12,
+210,13,134,12,210,13,20,12,210,13,134,12,210,13,26,12,210,13,146,12,210,13,
+26,12,210,13,146,12,210,13,32,12,210,13,128,12,210,13,32,12,210,13,128,12,
+210,13,32,12,210,13,128,12,210,13,32,12,210,13,128,12,210,13,38,12,210,13,
+44,12,210,13,38,12,210,13,44,12,210,13,38,12,210,13,44,12,210,13,38,12,210,
+13,44,12,210,13,44,12,210,13,104,12,210,13,44,12,210,13,104,12,210,13,50,
+12,210,13,152,12,210,13,50,12,210,13,152,12,210,13,50,12,210,13,152,12,210,
+13,50,12,210,13,152,12,210,13,56,12,210,13,158,12,210,13,56,12,210,13,158,
+12,210,13,56,12,210,13,158,12,210,13,56,12,210,13,158,12,210,13,56,12,210,
+13,158,12,210,12,234,12,210,13,164,12,210,12,234,12,210,13,164,12,210,12,
+234,12,210,13,164,12,210,12,234,12,210,13,164,12,210,13,62,12,210,13,128,
+12,210,13,62,12,210,13,128,12,210,13,62,12,210,13,128,12,210,13,62,12,210,
+13,128,12,210,13,62,12,210,13,128,12,210,13,68,12,210,13,170,12,210,13,68,
+12,210,13,170,12,210,13,74,12,210,13,176,12,210,13,74,12,210,13,176,12,210,
+13,80,12,210,13,182,12,210,13,80,12,210,13,182,12,210,13,86,12,210,13,188,
+12,210,13,92,12,210,13,194,12,210,13,92,12,210,13,194,12,210,13,92,12,210,
+13,194,12,210,13,128,12,210,13,164,12,210,13,176,12,210,13,188,12,210,13,
+98,12,210,14,4,12,210,15,234,12,210,15,240,12,210,13,20,12,210,13,134,12,
+210,13,20,12,210,13,44,12,210,13,50,12,210,13,98,12,210,13,164,12,210,13,
+170,12,210,15,90,12,210,0,1,0,0,4,74,0,1,5,29,7,48,0,1,0,0,7,48,0,1,5,51,
+7,48,0,1,5,14,7,48,0,1,5,215,7,48,0,1,4,115,7,48,0,1,4,39,7,48,0,1,5,211,
+7,48,0,1,5,238,7,48,0,1,2,182,7,48,0,1,2,47,7,48,0,1,4,244,7,48,0,1,4,49,
+7,48,0,1,7,66,7,48,0,1,6,20,7,48,0,1,6,63,7,48,0,1,4,215,7,48,0,1,4,250,7,
+48,0,1,4,100,7,48,0,1,5,217,7,48,0,1,4,205,7,48,0,1,7,113,7,48,0,1,4,176,
+7,48,0,1,4,135,7,48,0,1,4,147,7,48,0,1,4,125,7,48,0,1,4,236,7,48,0,1,3,215,
+7,48,0,1,4,131,7,48,0,1,2,193,7,48,0,1,4,242,7,48,0,1,2,16,7,48,0,1,4,70,
+7,48,0,1,7,123,7,48,0,1,3,78,7,48,0,1,3,213,7,48,0,1,2,227,7,48,0,1,4,16,
+7,48,0,1,6,74,7,48,0,1,4,59,7,48,0,1,4,20,7,48,0,1,3,195,7,48,0,1,7,12,7,
+48,0,1,5,12,7,48,0,1,6,233,7,48,0,1,4,240,7,48,0,1,4,229,7,48,0,1,4,29,7,
+48,0,1,2,154,7,48,0,1,5,135,7,48,0,1,7,109,7,48,0,1,7,145,7,48,0,1,2,156,
+7,48,0,1,6,70,7,48,0,1,4,238,7,48,0,1,6,61,7,48,0,1,5,59,7,48,0,1,5,100,7,
+48,0,1,5,20,7,48,0,1,4,6,7,48,0,1,6,123,7,48,0,1,4,213,7,48,0,1,5,233,7,48,
+0,1,4,180,7,48,0,1,4,143,7,48,0,1,7,121,7,48,0,1,2,201,7,48,0,1,4,86,7,48,
+0,1,8,61,7,48,0,1,6,66,7,48,0,1,8,154,7,48,0,1,6,195,7,48,0,1,5,123,7,48,
+0,1,2,121,7,48,0,1,4,156,7,48,0,1,4,172,7,48,0,1,3,236,7,48,0,1,3,180,7,48,
+0,1,4,178,7,48,0,1,10,86,7,48,0,1,9,154,7,48,0,1,8,174,7,48,0,1,6,96,7,48,
+0,1,4,33,7,48,0,1,8,68,7,48,0,1,8,37,7,48,0,1,7,2,7,48,0,1,3,252,7,48,0,1,
+7,129,7,48,0,1,5,74,7,48,0,1,5,94,7,48,0,1,3,12,7,48,0,1,5,246,7,48,0,1,3,
+27,7,48,0,1,7,199,7,48,0,1,3,150,7,48,0,1,3,125,7,48,0,1,4,221,7,48,0,1,6,
+35,7,48,0,1,4,63,7,48,0,1,6,27,7,48,0,1,3,221,7,48,0,1,4,152,7,48,0,1,2,197,
+7,48,0,1,2,143,7,48,0,1,3,6,7,48,0,1,2,205,7,48,0,1,2,14,7,48,0,1,5,66,7,
+48,0,1,5,205,7,48,0,1,4,121,7,48,0,1,4,231,7,48,0,1,3,203,7,48,0,1,3,104,
+7,48,0,1,3,193,7,48,0,1,5,25,7,48,0,1,3,123,7,48,0,1,7,174,7,48,0,1,7,217,
+7,48,0,1,8,66,7,48,0,1,6,18,7,48,0,1,4,18,7,48,0,1,6,229,7,48,0,1,5,76,7,
+48,0,1,4,211,7,48,0,1,4,184,7,48,0,1,5,4,7,48,0,1,4,37,7,48,0,1,7,213,7,48,
+0,1,4,197,7,48,0,1,3,100,7,48,0,1,3,242,7,48,0,1,5,49,7,48,0,1,3,127,7,48,
+0,1,4,193,7,48,0,1,0,12,0,18,0,1,0,90,0,96,0,1,0,1,5,6,0,1,0,34,0,36,0,38,
+0,40,0,42,0,44,0,46,0,47,0,49,0,50,0,53,0,54,0,55,0,56,0,68,0,70,0,72,0,74,
+0,76,0,78,0,79,0,81,0,82,0,85,0,86,0,87,0,88,0,144,0,156,0,157,0,175,0,176,
+0,188,0,189,0,252,0,1,0,0,0,76,0,34,0,76,0,82,0,88,0,94,0,100,0,106,0,112,
+0,118,0,124,0,106,0,130,0,136,0,142,0,148,0,154,0,160,0,166,0,172,0,130,0,
+172,0,178,0,112,0,172,0,184,0,190,0,112,0,100,0,142,0,142,0,196,0,196,0,112,
+0,112,0,196,0,1,255,226,0,15,0,1,2,142,0,0,0,1,2,194,0,0,0,1,2,88,0,0,0,1,
+3,32,0,0,0,1,1,44,0,0,0,1,2,148,0,0,0,1,2,68,0,0,0,1,2,228,0,0,0,1,3,12,0,
+0,0,1,2,8,0,0,0,1,1,244,0,0,0,1,2,218,0,0,0,1,1,234,0,0,0,1,2,10,0,0,0,1,
+2,53,0,0,0,1,2,68,254,92,0,1,0,210,0,0,0,1,2,78,0,0,0,1,1,204,0,0,0,1,1,164,
+0,0,0,1,0,230,0,0,0,1,0,12,0,18,0,1,0,172,0,178,0,1,0,1,5,7,0,2,0,25,0,36,
+0,61,0,0,0,68,0,93,0,26,0,130,0,152,0,52,0,154,0,184,0,75,0,186,1,66,0,106,
+1,250,2,1,0,243,2,55,2,55,0,251,2,78,2,78,0,252,2,83,2,86,0,253,2,92,2,95,
+1,1,3,26,3,113,1,5,3,126,3,179,1,93,3,183,3,186,1,147,3,191,3,207,1,151,3,
+216,3,216,1,168,3,221,4,25,1,169,4,30,4,31,1,230,4,34,4,158,1,232,5,244,6,
+34,2,101,6,85,6,230,2,148,8,3,8,3,3,38,8,81,8,81,3,39,8,98,8,104,3,40,8,115,
+8,115,3,47,8,118,8,118,3,48,0,1,0,0,6,106,3,49,6,106,6,112,6,118,6,124,6,
+130,6,136,6,142,6,148,6,154,6,160,6,166,6,130,6,172,6,178,6,184,6,136,6,190,
+6,196,6,202,6,208,6,214,6,220,6,226,6,232,6,238,6,244,6,250,7,0,6,202,6,202,
+7,6,7,12,7,18,7,24,7,30,7,36,7,42,7,30,7,48,7,24,7,6,7,54,7,60,7,30,7,66,
+7,72,7,78,7,84,7,90,7,96,7,102,7,108,6,106,6,106,6,106,6,106,6,106,6,106,
+7,114,7,120,6,130,6,130,6,130,6,130,6,154,6,154,6,154,6,154,6,124,6,178,6,
+184,6,184,6,184,6,184,6,184,6,184,6,214,6,214,6,214,6,214,6,238,6,136,6,184,
+6,250,6,250,6,250,6,250,6,250,6,250,7,126,7,132,7,6,7,6,7,6,7,6,7,30,7,30,
+7,30,7,30,7,6,7,24,7,6,7,6,7,6,7,6,7,6,7,6,7,78,7,78,7,78,7,78,7,102,7,54,
+7,102,6,106,6,250,6,106,6,250,7,138,7,144,6,118,6,202,6,118,6,202,6,118,6,
+202,6,118,6,202,6,124,6,202,6,124,6,202,6,130,7,6,6,130,7,6,6,130,7,6,7,150,
+7,156,6,130,7,6,6,142,7,18,6,142,7,18,6,142,7,18,7,162,7,18,6,148,7,24,6,
+148,7,24,6,154,7,30,6,154,7,30,6,154,7,30,7,168,7,174,6,154,7,30,7,180,7,
+186,6,160,7,36,6,166,7,42,7,96,6,130,7,30,7,192,7,30,6,130,7,30,6,130,7,30,
+6,130,7,30,6,178,7,24,6,178,7,24,6,178,7,24,7,198,7,204,7,210,6,184,7,6,6,
+184,7,6,6,184,7,6,7,216,7,222,6,196,7,30,6,196,7,174,6,196,7,30,6,202,7,66,
+6,202,7,66,7,228,7,234,6,202,7,66,7,240,7,246,6,208,7,72,6,202,7,72,6,214,
+7,78,6,214,7,78,6,214,7,78,6,214,7,78,6,214,7,78,7,252,8,2,6,226,7,90,6,238,
+7,102,6,238,6,244,7,108,6,244,7,108,6,244,7,108,7,30,8,8,6,226,7,90,6,226,
+7,90,6,226,7,90,6,238,7,102,7,36,7,36,6,172,7,48,6,106,7,192,6,184,7,6,8,
+14,7,78,6,106,7,192,6,106,7,192,6,106,7,192,6,106,7,192,6,106,7,192,6,106,
+7,192,6,106,7,192,6,106,7,192,6,106,7,192,6,106,7,192,6,106,7,192,6,106,7,
+192,8,20,8,26,6,130,7,6,6,130,7,6,6,130,7,6,6,130,7,6,6,130,7,6,6,130,7,6,
+8,20,8,32,6,154,7,30,8,38,8,44,8,50,8,56,6,184,7,6,6,184,7,6,6,184,7,6,6,
+184,7,6,6,184,7,6,8,50,8,56,6,184,7,6,6,184,7,6,6,184,7,6,6,184,7,6,8,50,
+8,56,8,62,7,78,6,214,7,78,6,214,7,78,6,214,7,78,6,214,7,78,6,214,7,78,8,62,
+7,78,8,68,7,102,6,238,7,102,6,238,7,102,8,74,8,8,7,0,6,130,6,112,7,0,6,112,
+7,0,6,202,6,118,6,202,6,124,8,80,8,86,6,202,6,202,8,92,8,98,6,112,8,104,7,
+192,7,228,8,110,8,116,6,154,6,166,7,42,7,30,8,122,8,128,6,178,8,134,6,184,
+8,140,8,146,8,152,7,54,8,158,6,202,7,66,6,244,8,164,8,164,6,208,7,72,8,170,
+8,176,6,220,8,182,7,102,6,244,7,108,8,188,6,220,8,194,7,66,8,200,7,54,8,206,
+8,212,8,218,8,224,8,230,7,186,8,236,8,242,8,248,6,106,6,250,6,154,7,30,6,
+184,7,6,6,214,7,78,8,254,9,4,9,10,6,142,7,18,6,142,7,18,6,166,7,42,7,150,
+9,16,7,150,9,16,9,22,8,164,9,28,9,34,9,40,6,142,7,18,9,46,9,52,6,178,7,24,
+6,106,6,250,6,106,6,250,6,130,7,6,6,130,7,6,6,154,7,30,6,154,7,30,6,184,7,
+6,6,184,7,6,6,196,7,30,6,196,7,30,6,214,7,78,6,214,7,78,6,202,9,58,6,148,
+7,24,9,64,9,70,8,92,7,0,9,76,9,82,6,106,6,250,9,88,9,94,6,184,7,6,6,238,7,
+102,9,100,9,106,7,72,9,112,9,118,6,106,6,118,7,6,6,130,6,208,9,124,9,130,
+6,154,9,136,6,112,6,214,9,142,6,130,7,0,6,160,7,36,8,248,9,148,6,196,7,30,
+6,238,7,102,6,202,9,154,7,0,7,0,9,160,9,166,9,148,9,154,6,202,6,202,6,202,
+6,202,7,66,7,66,7,0,7,36,7,18,7,18,7,0,9,172,9,166,9,178,7,24,9,184,7,30,
+9,190,6,154,9,196,9,196,9,202,9,208,9,214,9,220,9,226,7,24,9,232,9,238,7,
+6,9,244,9,250,10,0,6,238,6,238,7,120,7,54,10,6,7,30,10,12,7,24,9,166,10,18,
+10,24,10,24,9,202,10,30,9,196,8,8,7,78,7,0,7,6,6,244,10,36,10,42,10,48,10,
+54,10,60,8,164,8,8,9,136,10,66,10,72,7,186,6,184,10,78,10,78,6,202,6,232,
+7,36,10,84,10,90,7,60,9,136,10,96,10,102,10,108,10,114,10,120,10,126,10,132,
+10,138,6,142,7,42,10,60,10,144,8,134,9,70,7,0,6,202,7,12,7,48,7,24,7,54,7,
+30,7,30,7,66,7,72,7,108,10,150,10,156,7,186,10,162,7,30,9,190,7,54,6,220,
+6,220,10,168,10,174,10,180,7,18,10,186,10,192,10,198,10,174,7,54,10,192,10,
+204,7,36,10,210,10,168,10,216,10,222,10,228,10,234,10,240,10,174,10,246,10,
+252,11,2,10,180,11,8,10,228,10,246,6,112,7,0,11,14,11,20,11,26,11,26,7,120,
+11,32,6,124,6,202,11,38,9,154,11,44,11,50,11,56,9,154,9,16,9,154,6,130,7,
+6,6,130,7,6,7,228,7,228,11,62,11,62,11,68,11,74,6,136,7,12,6,142,7,18,6,148,
+7,24,6,148,7,24,6,148,7,24,6,148,7,24,6,148,7,24,11,80,11,86,6,154,7,30,6,
+166,7,42,6,166,7,42,6,166,11,92,6,142,11,98,6,142,11,98,11,104,11,110,11,
+74,11,116,6,172,7,48,6,172,7,48,6,178,7,24,6,178,7,24,11,122,11,26,11,128,
+11,134,6,184,7,6,6,184,7,6,6,184,7,6,6,184,7,6,6,136,7,54,6,136,7,54,6,196,
+7,30,6,196,11,140,6,196,11,140,11,146,11,110,6,202,7,66,11,152,11,158,6,202,
+7,66,6,202,7,66,11,164,11,158,6,208,7,72,11,170,11,176,11,50,11,182,11,188,
+11,194,11,200,7,18,11,206,11,212,11,218,11,74,6,214,11,224,6,214,11,224,6,
+220,7,84,11,230,11,236,6,226,7,90,6,226,7,90,6,232,7,96,6,232,7,96,6,238,
+7,102,6,244,7,108,6,244,6,190,11,104,11,242,11,26,7,72,7,90,7,102,6,250,7,
+30,6,220,6,142,6,130,7,30,6,130,6,136,6,196,6,250,9,166,11,248,11,254,0,1,
+0,120,0,0,0,1,5,27,0,0,0,1,2,248,0,0,0,1,3,122,0,0,0,1,2,158,0,0,0,1,3,172,
+0,0,0,1,1,127,0,0,0,1,3,192,0,0,0,1,5,37,0,0,0,1,1,182,0,0,0,1,0,150,254,
+172,0,1,4,244,0,0,0,1,6,123,0,0,0,1,5,78,0,0,0,1,3,152,0,0,0,1,3,52,0,0,0,
+1,4,156,0,0,0,1,2,148,0,0,0,1,2,150,0,0,0,1,3,82,0,0,0,1,2,188,0,0,0,1,5,
+200,0,0,0,1,4,106,0,0,0,1,2,160,0,0,0,1,4,6,0,0,0,1,3,215,0,0,0,1,2,208,0,
+0,0,1,2,168,0,0,0,1,1,147,0,0,0,1,2,188,254,72,0,1,4,76,0,0,0,1,1,98,0,0,
+0,1,0,200,254,72,0,1,4,36,0,0,0,1,6,213,0,0,0,1,1,98,254,20,0,1,4,61,254,
+20,0,1,2,38,0,0,0,1,2,8,0,0,0,1,4,68,0,0,0,1,2,98,0,0,0,1,4,246,0,0,0,1,4,
+26,0,0,0,1,1,64,254,72,0,1,2,228,0,0,0,1,6,69,0,0,0,1,3,52,254,72,0,1,5,80,
+0,0,0,1,2,148,254,72,0,1,4,216,254,112,0,1,3,212,254,112,0,1,3,172,254,112,
+0,1,3,152,254,112,0,1,5,0,0,40,0,1,1,182,254,112,0,1,1,98,254,112,0,1,3,92,
+254,172,0,1,2,208,254,72,0,1,3,212,0,0,0,1,4,216,0,0,0,1,4,96,254,172,0,1,
+3,212,254,72,0,1,6,117,0,0,0,1,6,24,0,0,0,1,2,168,254,112,0,1,2,78,254,112,
+0,1,2,68,254,112,0,1,1,224,254,112,0,1,3,92,254,112,0,1,4,68,254,112,0,1,
+2,8,254,72,0,1,3,62,0,0,0,1,3,232,0,0,0,1,3,212,0,50,0,1,3,222,0,40,0,1,1,
+182,254,202,0,1,1,98,254,202,0,1,3,152,254,202,0,1,2,168,254,202,0,1,3,82,
+254,202,0,1,2,160,254,202,0,1,2,138,254,72,0,1,3,102,0,0,0,1,3,12,0,0,0,1,
+3,32,0,0,0,1,3,92,0,0,0,1,0,240,254,72,0,1,5,100,0,0,0,1,2,48,0,0,0,1,4,16,
+0,0,0,1,5,140,0,0,0,1,4,76,254,20,0,1,7,225,0,0,0,1,6,29,254,20,0,1,2,35,
+0,0,0,1,4,196,255,51,0,1,2,68,254,72,0,1,3,13,254,72,0,1,3,132,0,0,0,1,2,
+170,0,0,0,1,2,104,0,0,0,1,2,93,0,0,0,1,2,49,0,0,0,1,9,82,0,0,0,1,8,218,0,
+0,0,1,7,211,0,0,0,1,4,204,254,172,0,1,4,239,254,72,0,1,6,184,254,172,0,1,
+6,204,254,72,0,1,5,180,254,72,0,1,2,126,0,0,0,1,6,28,0,0,0,1,5,95,0,0,0,1,
+3,12,254,112,0,1,2,118,0,0,0,1,9,127,0,0,0,1,8,196,0,0,0,1,7,208,0,0,0,1,
+5,204,0,0,0,1,1,127,254,20,0,1,2,48,254,72,0,1,5,51,254,20,0,1,4,216,254,
+72,0,1,2,2,0,0,0,1,1,138,0,0,0,1,2,205,254,72,0,1,2,169,254,72,0,1,2,12,0,
+0,0,1,5,7,0,0,0,1,5,220,0,0,0,1,5,250,0,0,0,1,2,237,254,72,0,1,3,18,254,72,
+0,1,1,178,0,0,0,1,4,196,0,0,0,1,4,196,254,72,0,1,4,61,0,0,0,1,2,18,0,0,0,
+1,2,108,0,0,0,1,2,108,254,72,0,1,4,68,254,20,0,1,3,232,254,72,0,1,1,244,0,
+0,0,1,1,221,0,0,0,1,1,244,254,72,0,1,3,92,254,72,0,1,6,205,0,0,0,1,6,213,
+254,20,0,1,6,104,254,72,0,1,4,236,254,72,0,1,4,96,0,0,0,1,5,117,0,0,0,1,4,
+146,0,0,0,1,3,61,254,20,0,1,1,229,254,72,0,1,2,29,254,20,0,1,1,204,254,72,
+0,1,0,204,254,72,0,1,0,175,254,72,0,1,6,41,0,0,0,1,4,8,0,0,0,1,2,66,0,0,0,
+1,4,16,254,72,0,1,3,72,0,0,0,1,2,106,0,0,0,1,1,231,0,0,0,1,2,138,0,0,0,1,
+3,152,254,20,0,1,2,215,0,0,0,1,2,76,0,0,0,1,6,224,0,0,0,1,6,9,254,72,0,1,
+7,51,0,0,0,1,4,116,0,0,0,1,2,234,254,72,0,1,5,131,0,0,0,1,5,169,254,72,0,
+1,4,10,0,0,0,1,2,228,254,72,0,1,3,129,2,180,0,1,7,47,0,0,0,1,3,132,254,132,
+0,1,4,26,254,132,0,1,1,124,254,132,0,1,3,152,254,132,0,1,1,64,254,132,0,1,
+6,164,254,132,0,1,2,160,254,132,0,1,3,72,254,132,0,1,2,228,254,132,0,1,4,
+162,254,132,0,1,5,20,254,132,0,1,4,206,254,72,0,1,4,136,254,132,0,1,1,74,
+254,132,0,1,5,51,254,132,0,1,2,68,254,132,0,1,0,200,254,132,0,1,2,228,254,
+202,0,1,2,208,254,202,0,1,2,208,254,232,0,1,2,128,254,72,0,1,2,248,254,202,
+0,1,2,228,254,232,0,1,2,148,254,232,0,1,2,228,254,112,0,1,2,168,254,162,0,
+1,2,218,254,112,0,1,2,188,254,112,0,1,1,182,254,162,0,1,1,98,254,162,0,1,
+2,158,254,232,0,1,1,114,254,202,0,1,2,188,254,232,0,1,1,104,254,232,0,1,1,
+104,254,112,0,1,3,112,254,232,0,1,3,132,254,112,0,1,2,238,254,112,0,1,1,74,
+254,202,0,1,3,12,254,232,0,1,2,128,254,202,0,1,2,48,254,202,0,1,2,108,254,
+202,0,1,2,148,254,202,0,1,2,8,254,202,0,1,2,8,254,232,0,1,2,173,254,112,0,
+1,1,254,254,112,0,1,3,82,254,92,0,1,3,47,254,162,0,1,2,208,254,162,0,1,3,
+52,254,112,0,1,4,58,0,0,0,1,2,188,254,202,0,1,2,98,254,202,0,1,2,68,254,232,
+0,1,2,88,0,0,0,1,3,69,0,0,0,1,0,12,0,20,0,1,0,54,0,64,0,1,0,2,5,1,5,2,0,2,
+0,5,0,69,0,71,0,0,0,73,0,75,0,3,0,77,0,81,0,6,0,83,0,90,0,11,0,93,0,93,0,
+19,0,2,0,0,0,52,0,0,0,58,0,20,0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,96,0,102,
+0,108,0,84,0,54,0,114,0,102,0,120,0,126,0,132,0,138,0,144,0,150,0,1,0,0,0,
+86,0,1,0,162,0,86,0,1,3,212,0,86,0,1,3,32,0,86,0,1,4,61,0,86,0,1,1,147,0,
+86,0,1,3,22,254,112,0,1,4,76,0,86,0,1,1,44,254,132,0,1,4,26,0,0,0,1,1,98,
+0,86,0,1,6,213,0,86,0,1,4,61,254,212,0,1,3,12,0,86,0,1,2,8,0,86,0,1,4,68,
+0,86,0,1,2,98,0,86,0,1,4,236,0,86,0,1,3,115,0,86,0,1,0,12,0,112,0,1,0,212,
+1,214,0,2,0,16,2,96,2,98,0,0,2,140,2,143,0,3,3,115,3,115,0,7,4,228,4,244,
+0,8,4,250,4,250,0,25,5,28,5,30,0,26,5,33,5,35,0,29,5,37,5,37,0,32,5,41,5,
+43,0,33,5,47,5,49,0,36,5,54,5,54,0,39,5,58,5,58,0,40,5,66,5,78,0,41,6,72,
+6,73,0,54,6,75,6,81,0,56,6,83,6,83,0,63,0,2,0,16,2,96,2,98,0,0,2,140,2,143,
+0,3,3,115,3,115,0,7,4,228,4,244,0,8,4,250,4,250,0,25,5,28,5,30,0,26,5,33,
+5,35,0,29,5,37,5,37,0,32,5,41,5,43,0,33,5,47,5,49,0,36,5,54,5,54,0,39,5,58,
+5,58,0,40,5,66,5,78,0,41,6,72,6,73,0,54,6,75,6,81,0,56,6,83,6,83,0,63,0,64,
+0,0,1,132,0,0,1,132,0,0,1,132,0,0,1,138,0,0,1,144,0,0,1,144,0,0,1,144,0,0,
+1,150,0,0,1,156,0,0,1,156,0,0,1,162,0,0,1,156,0,0,1,156,0,0,1,156,0,0,1,168,
+0,0,1,156,0,0,1,174,0,0,1,156,0,0,1,180,0,0,1,180,0,0,1,156,0,0,1,156,0,0,
+1,186,0,0,1,186,0,0,1,186,0,0,1,192,0,0,1,198,0,0,1,204,0,0,1,210,0,0,1,156,
+0,0,1,216,0,0,1,222,0,0,1,156,0,0,1,204,0,0,1,204,0,0,1,156,0,0,1,228,0,0,
+1,228,0,0,1,234,0,0,1,228,0,0,1,192,0,0,1,240,0,0,1,240,0,0,1,240,0,0,1,240,
+0,0,1,240,0,0,1,240,0,0,1,240,0,0,1,240,0,0,1,240,0,0,1,240,0,0,1,240,0,0,
+1,240,0,0,1,240,0,0,1,246,0,0,1,246,0,0,1,156,0,0,1,222,0,0,1,222,0,0,1,222,
+0,0,1,222,0,0,1,252,0,0,1,252,0,0,1,228,0,64,1,0,1,0,1,6,1,12,1,18,1,24,1,
+24,1,0,1,30,0,160,1,36,1,42,1,42,1,42,1,48,1,54,1,30,1,30,1,30,1,30,1,60,
+1,66,1,42,1,42,1,42,1,54,1,30,1,72,1,78,1,42,1,42,1,84,1,30,1,30,1,90,1,72,
+1,84,1,84,1,96,1,84,1,30,1,102,1,102,1,42,1,102,1,102,1,102,1,108,1,108,1,
+102,1,102,1,102,1,102,1,102,1,60,1,60,1,30,1,30,1,30,1,30,1,30,1,30,1,30,
+1,30,0,1,253,120,4,184,0,1,2,58,4,156,0,1,2,79,4,184,0,1,253,162,4,184,0,
+1,0,0,4,184,0,1,0,0,6,4,0,1,253,142,4,184,0,1,255,176,4,184,0,1,0,0,4,144,
+0,1,0,0,3,162,0,1,0,0,4,164,0,1,0,0,4,116,0,1,0,0,4,96,0,1,0,0,5,240,0,1,
+0,0,4,84,0,1,0,0,4,176,0,1,0,0,4,154,0,1,0,0,4,196,0,1,0,0,1,254,0,1,0,0,
+4,216,0,1,0,0,4,156,0,1,253,120,6,144,0,1,253,120,6,64,0,1,2,58,6,24,0,1,
+2,58,6,64,0,1,2,58,6,144,0,1,0,0,6,144,0,1,0,0,7,48,0,1,0,0,6,64,0,1,253,
+142,7,8,0,1,0,0,6,224,0,1,0,0,6,244,0,1,0,0,6,84,0,1,0,0,7,68,0,1,0,0,8,32,
+0,1,0,0,6,184,0,1,0,0,7,158,0,1,0,0,7,8,0,1,0,0,5,100,0,1,0,0,6,44,0,1,0,
+12,0,100,0,1,0,188,1,106,0,2,0,14,2,100,2,100,0,0,4,246,4,249,0,1,4,252,5,
+0,0,5,5,3,5,5,0,10,5,8,5,18,0,13,5,24,5,27,0,24,5,36,5,36,0,28,5,38,5,40,
+0,29,5,44,5,45,0,32,5,50,5,53,0,34,5,56,5,57,0,38,6,74,6,74,0,40,6,82,6,82,
+0,41,6,84,6,84,0,42,0,2,0,14,2,100,2,100,0,0,4,246,4,249,0,1,4,252,5,0,0,
+5,5,3,5,5,0,10,5,8,5,18,0,13,5,24,5,27,0,24,5,36,5,36,0,28,5,38,5,40,0,29,
+5,44,5,45,0,32,5,50,5,53,0,34,5,56,5,57,0,38,6,74,6,74,0,40,6,82,6,82,0,41,
+6,84,6,84,0,42,0,43,0,0,1,6,0,0,1,12,0,0,1,12,0,0,1,18,0,0,1,18,0,0,1,24,
+0,0,1,12,0,0,1,12,0,0,1,18,0,0,1,30,0,0,1,36,0,0,1,42,0,0,1,48,0,0,1,54,0,
+0,1,60,0,0,1,48,0,0,1,12,0,0,1,54,0,0,1,48,0,0,1,48,0,0,1,48,0,0,1,30,0,0,
+1,66,0,0,1,72,0,0,1,78,0,0,1,54,0,0,1,42,0,0,1,48,0,0,1,48,0,0,1,72,0,0,1,
+84,0,0,1,90,0,0,1,54,0,0,1,18,0,0,1,18,0,0,1,54,0,0,1,54,0,0,1,54,0,0,1,54,
+0,0,1,18,0,0,1,54,0,0,1,42,0,0,1,12,0,43,0,178,0,184,0,184,0,190,0,190,0,
+196,0,202,0,202,0,208,0,214,0,220,0,190,0,190,0,202,0,202,0,226,0,184,0,184,
+0,184,0,184,0,184,0,214,0,232,0,190,0,238,0,190,0,244,0,250,0,202,0,190,0,
+202,0,244,0,202,1,0,0,202,0,244,0,244,0,244,0,244,0,244,0,202,0,244,0,190,
+0,1,253,156,255,126,0,1,0,0,255,156,0,1,0,0,255,196,0,1,0,20,255,206,0,1,
+0,0,255,116,0,1,0,0,255,96,0,1,0,0,255,206,0,1,0,0,255,136,0,1,0,0,255,176,
+0,1,0,0,255,166,0,1,0,0,255,86,0,1,0,0,255,216,0,1,255,236,255,216,0,1,0,
+0,255,186,0,1,0,0,255,146,0,1,253,156,254,52,0,1,0,0,253,248,0,1,0,0,253,
+208,0,1,0,20,253,208,0,1,0,0,253,228,0,1,0,0,253,198,0,1,0,0,254,92,0,1,0,
+0,254,22,0,1,0,0,254,52,0,1,0,0,254,72,0,1,255,236,253,208,0,1,0,0,253,188,
+0,1,0,0,254,32,0,1,0,0,253,168,0,1,0,36,0,4,0,0,0,13,0,66,0,72,0,102,0,108,
+0,138,0,144,0,150,0,164,0,186,0,186,0,192,0,192,0,198,0,1,0,13,0,41,0,209,
+0,240,1,0,1,96,1,100,1,111,1,115,1,131,1,148,2,154,2,172,2,201,0,1,0,34,0,
+20,0,7,0,34,0,80,0,69,0,30,0,75,0,30,0,78,0,30,0,79,0,30,0,231,0,30,0,233,
+0,60,0,1,0,45,0,50,0,7,0,34,0,70,0,69,0,30,0,75,0,30,0,78,0,30,0,79,0,30,
+0,231,0,30,0,233,0,70,0,1,1,116,255,236,0,1,1,115,255,226,0,3,1,100,255,246,
+1,116,255,236,1,136,255,236,0,5,1,100,255,226,1,112,255,246,1,113,255,216,
+1,116,255,246,1,136,255,246,0,1,1,129,255,236,0,1,1,163,0,50,0,2,1,163,0,
+50,1,190,255,236,0,1,3,216,0,4,0,0,1,231,7,48,7,48,10,190,10,196,12,226,10,
+196,13,48,14,34,14,244,14,34,15,138,15,144,14,244,16,2,14,34,17,60,14,34,
+17,194,20,236,21,94,21,94,14,244,24,52,27,26,10,190,27,176,27,194,28,8,27,
+194,28,26,27,176,28,44,27,176,27,176,27,194,27,194,28,254,28,8,30,84,30,84,
+28,44,30,84,10,190,13,48,13,48,13,48,13,48,13,48,13,48,15,138,14,244,15,138,
+15,138,15,138,15,138,14,34,14,34,14,34,14,34,14,34,14,34,14,34,20,236,20,
+236,20,236,20,236,24,52,17,60,27,176,27,176,27,176,27,176,27,176,27,176,27,
+194,27,194,27,194,27,194,27,194,27,194,27,194,27,194,30,122,27,194,30,84,
+27,194,30,84,13,48,27,176,13,48,27,176,13,48,27,176,14,244,14,244,14,244,
+14,244,14,34,30,140,14,34,15,138,27,194,15,138,27,194,15,138,27,194,15,138,
+27,194,15,138,27,194,27,176,14,244,28,44,28,44,16,2,16,2,16,2,30,140,16,2,
+16,2,27,176,14,34,14,34,14,34,15,138,28,254,28,254,28,254,17,194,28,8,17,
+194,28,8,17,194,20,236,20,236,20,236,20,236,20,236,20,236,21,94,30,84,24,
+52,30,84,24,52,27,26,27,26,27,26,13,48,27,176,15,138,14,34,30,170,30,220,
+31,34,31,184,30,122,30,170,31,202,31,236,30,170,32,162,30,220,32,172,30,170,
+30,220,32,194,31,236,31,34,32,228,32,172,33,18,31,184,31,34,33,60,27,176,
+33,66,33,60,33,92,33,114,27,176,33,168,33,66,33,186,33,216,33,92,34,22,34,
+22,34,48,34,22,34,66,30,122,34,22,34,128,35,90,37,208,38,66,34,128,34,128,
+34,128,38,76,38,218,40,20,40,210,41,24,35,90,41,66,38,76,41,24,38,76,41,84,
+42,74,37,208,35,90,38,218,42,208,38,76,41,66,41,66,34,128,34,128,41,84,41,
+84,27,176,43,174,43,180,27,176,27,176,44,74,43,174,44,74,44,192,44,192,43,
+180,45,58,44,192,44,74,27,176,27,176,45,104,45,104,44,192,44,192,27,176,46,
+6,43,180,45,104,45,104,46,6,44,74,45,58,35,90,43,180,21,94,30,84,21,94,30,
+84,21,94,30,84,24,52,30,84,12,226,12,226,12,226,7,48,7,48,10,196,7,48,10,
+196,31,184,46,32,31,34,13,48,27,176,46,50,46,124,27,176,41,84,45,58,46,198,
+45,104,37,208,40,20,47,64,40,20,47,64,48,22,48,22,41,24,48,32,44,192,41,84,
+44,192,38,218,45,58,38,218,45,58,45,58,45,58,41,84,44,192,41,84,44,192,41,
+84,45,58,37,208,41,66,27,176,46,198,45,104,42,74,44,192,48,130,50,212,51,
+90,51,240,52,10,52,160,41,24,43,174,52,10,52,160,38,76,44,74,38,76,44,74,
+38,76,44,74,41,66,27,176,48,130,43,180,53,22,53,188,54,34,44,192,37,208,35,
+90,43,180,54,92,56,106,54,92,56,106,52,10,52,160,41,66,27,176,41,66,27,176,
+56,152,57,66,57,144,27,176,57,144,27,176,38,76,44,74,57,178,58,88,41,66,27,
+176,41,66,27,176,41,66,27,176,40,20,27,176,40,20,27,176,27,176,27,176,41,
+84,44,192,41,84,44,192,38,76,44,74,41,24,43,174,46,6,41,84,44,192,41,84,44,
+192,41,84,44,192,41,84,44,192,38,218,45,58,38,218,45,58,38,218,45,58,35,90,
+43,180,48,130,50,212,52,10,52,160,38,76,52,160,58,110,59,112,58,110,59,112,
+41,66,27,176,58,110,59,112,58,110,59,112,59,234,60,72,60,150,59,112,58,88,
+41,66,27,176,13,48,27,176,13,48,27,176,13,48,27,176,13,48,27,176,13,48,27,
+176,13,48,27,176,13,48,27,176,13,48,27,176,13,48,27,176,13,48,27,176,13,48,
+27,176,13,48,27,176,15,138,27,194,15,138,27,194,15,138,27,194,15,138,27,194,
+15,138,27,194,15,138,27,194,15,138,27,194,15,138,27,194,14,34,27,194,14,34,
+27,194,14,34,14,34,14,34,14,34,14,34,46,50,46,50,46,50,46,50,46,50,20,236,
+46,124,46,124,46,124,46,124,46,124,24,52,30,84,24,52,30,84,24,52,30,84,17,
+194,28,8,30,220,0,2,0,142,0,5,0,5,0,0,0,10,0,11,0,1,0,15,0,17,0,3,0,36,0,
+41,0,6,0,46,0,47,0,12,0,50,0,52,0,14,0,55,0,62,0,17,0,68,0,70,0,25,0,72,0,
+73,0,28,0,75,0,75,0,30,0,78,0,78,0,31,0,80,0,83,0,32,0,85,0,85,0,36,0,87,
+0,87,0,37,0,89,0,92,0,38,0,94,0,94,0,42,0,130,0,141,0,43,0,146,0,146,0,55,
+0,148,0,152,0,56,0,154,0,160,0,61,0,162,0,167,0,68,0,170,0,173,0,74,0,178,
+0,178,0,78,0,180,0,182,0,79,0,184,0,184,0,82,0,186,0,186,0,83,0,191,0,200,
+0,84,0,202,0,202,0,94,0,204,0,204,0,95,0,206,0,206,0,96,0,208,0,210,0,97,
+0,212,0,221,0,100,0,231,0,231,0,110,0,248,0,251,0,111,0,253,0,253,0,115,0,
+255,1,1,0,116,1,3,1,3,0,119,1,8,1,8,0,120,1,14,1,14,0,121,1,16,1,16,0,122,
+1,18,1,18,0,123,1,20,1,20,0,124,1,23,1,23,0,125,1,25,1,25,0,126,1,27,1,27,
+0,127,1,36,1,40,0,128,1,42,1,42,0,133,1,44,1,44,0,134,1,46,1,46,0,135,1,48,
+1,48,0,136,1,50,1,50,0,137,1,52,1,52,0,138,1,54,1,59,0,139,1,61,1,61,0,145,
+1,63,1,63,0,146,1,67,1,69,0,147,1,71,1,71,0,150,1,86,1,86,0,151,1,91,1,98,
+0,152,1,100,1,100,0,160,1,102,1,102,0,161,1,104,1,105,0,162,1,109,1,109,0,
+164,1,111,1,111,0,165,1,113,1,118,0,166,1,120,1,121,0,172,1,123,1,124,0,174,
+1,126,1,126,0,176,1,128,1,128,0,177,1,131,1,136,0,178,1,138,1,138,0,184,1,
+140,1,140,0,185,1,142,1,142,0,186,1,144,1,144,0,187,1,147,1,148,0,188,1,151,
+1,151,0,190,1,153,1,153,0,191,1,157,1,160,0,192,1,164,1,168,0,196,1,170,1,
+174,0,201,1,176,1,177,0,206,1,180,1,180,0,208,1,184,1,184,0,209,1,186,1,192,
+0,210,1,195,1,196,0,217,1,198,1,200,0,219,1,202,1,202,0,222,1,204,1,209,0,
+223,1,212,1,212,0,229,1,216,1,216,0,230,1,218,1,218,0,231,1,220,1,224,0,232,
+1,227,1,228,0,237,1,230,1,232,0,239,1,234,1,236,0,242,1,242,1,246,0,245,1,
+248,2,4,0,250,2,6,2,8,1,7,2,10,2,10,1,10,2,12,2,12,1,11,2,33,2,33,1,12,2,
+80,2,81,1,13,2,85,2,86,1,15,2,93,2,93,1,17,2,95,2,95,1,18,2,103,2,103,1,19,
+2,105,2,109,1,20,2,111,2,115,1,25,2,117,2,117,1,30,2,119,2,119,1,31,2,121,
+2,137,1,32,2,146,2,176,1,49,2,178,2,189,1,80,2,192,2,197,1,92,2,199,2,204,
+1,98,2,207,2,208,1,104,2,211,2,212,1,106,2,214,2,217,1,108,2,219,2,219,1,
+112,2,221,2,230,1,113,2,236,2,249,1,123,2,252,2,253,1,137,3,0,3,5,1,139,3,
+8,3,22,1,145,3,24,3,65,1,160,3,70,3,74,1,202,3,76,3,76,1,207,3,78,3,78,1,
+208,3,80,3,80,1,209,3,82,3,82,1,210,3,85,3,85,1,211,3,87,3,87,1,212,3,89,
+3,89,1,213,3,91,3,91,1,214,3,93,3,94,1,215,3,99,3,99,1,217,3,101,3,101,1,
+218,3,103,3,103,1,219,3,105,3,105,1,220,3,107,3,113,1,221,3,126,3,127,1,228,
+7,47,7,47,1,230,0,227,0,36,255,186,0,55,0,20,0,57,0,20,0,58,0,20,0,60,0,10,
+0,68,255,216,0,70,255,196,0,71,255,196,0,72,255,196,0,74,255,226,0,80,255,
+226,0,81,255,226,0,82,255,196,0,83,255,226,0,84,255,196,0,85,255,226,0,86,
+255,226,0,88,255,226,0,130,255,186,0,131,255,186,0,132,255,186,0,133,255,
+186,0,134,255,186,0,135,255,186,0,159,0,10,0,162,255,196,0,163,255,216,0,
+164,255,216,0,165,255,216,0,166,255,216,0,167,255,216,0,168,255,216,0,169,
+255,196,0,170,255,196,0,171,255,196,0,172,255,196,0,173,255,196,0,180,255,
+196,0,181,255,196,0,182,255,196,0,183,255,196,0,184,255,196,0,186,255,196,
+0,187,255,226,0,188,255,226,0,189,255,226,0,190,255,226,0,194,255,186,0,195,
+255,216,0,196,255,186,0,197,255,216,0,198,255,186,0,199,255,216,0,201,255,
+196,0,203,255,196,0,205,255,196,0,207,255,196,0,209,255,196,0,211,255,196,
+0,213,255,196,0,215,255,196,0,217,255,196,0,219,255,196,0,221,255,196,0,223,
+255,226,0,225,255,226,0,227,255,226,0,229,255,226,0,250,255,226,1,6,255,226,
+1,8,255,226,1,13,255,226,1,15,255,196,1,17,255,196,1,19,255,196,1,21,255,
+196,1,23,255,226,1,25,255,226,1,29,255,226,1,33,255,226,1,36,0,20,1,38,0,
+20,1,43,255,226,1,45,255,226,1,47,255,226,1,49,255,226,1,51,255,226,1,53,
+255,226,1,54,0,20,1,56,0,10,1,58,0,10,1,67,255,186,1,68,255,216,1,70,255,
+216,1,72,255,196,1,74,255,226,1,86,255,186,1,95,255,186,1,98,255,186,1,105,
+255,186,1,121,255,216,1,122,255,236,1,123,255,236,1,126,255,216,1,129,255,
+226,1,130,255,236,1,131,255,236,1,132,255,236,1,135,255,236,1,137,255,236,
+1,140,255,216,1,142,255,226,1,143,255,216,1,144,255,216,1,147,255,216,1,153,
+255,216,1,164,255,196,1,170,255,186,1,174,255,196,1,181,255,196,1,202,255,
+236,1,206,255,186,1,207,255,196,1,213,255,186,1,216,255,196,1,219,255,196,
+1,222,255,196,1,234,255,196,1,237,255,196,1,238,255,226,1,242,255,186,1,250,
+0,20,1,252,0,20,1,254,0,20,2,0,0,10,2,84,255,226,2,85,255,186,2,86,255,216,
+2,93,255,196,2,95,255,226,2,103,255,196,2,111,255,186,2,112,255,186,2,122,
+255,246,2,124,255,196,2,130,255,196,2,132,255,196,2,134,255,196,2,138,255,
+196,2,175,255,196,2,177,255,196,2,203,255,196,2,204,255,186,2,214,255,186,
+2,215,255,236,2,216,255,186,2,217,255,236,2,218,255,186,2,219,255,236,2,221,
+255,196,2,223,255,236,2,225,255,236,2,237,255,196,2,239,255,196,2,241,255,
+196,3,6,255,186,3,7,255,196,3,8,255,186,3,9,255,196,3,14,255,196,3,15,255,
+186,3,19,255,196,3,23,255,196,3,24,255,196,3,25,255,186,3,26,255,186,3,27,
+255,216,3,28,255,186,3,29,255,216,3,30,255,186,3,31,255,216,3,32,255,186,
+3,34,255,186,3,35,255,216,3,36,255,186,3,37,255,216,3,38,255,186,3,39,255,
+216,3,40,255,186,3,41,255,216,3,42,255,186,3,43,255,216,3,44,255,186,3,45,
+255,216,3,46,255,186,3,47,255,216,3,48,255,186,3,49,255,216,3,51,255,196,
+3,53,255,196,3,55,255,196,3,57,255,196,3,61,255,196,3,63,255,196,3,65,255,
+196,3,71,255,196,3,73,255,196,3,75,255,196,3,79,255,196,3,81,255,196,3,83,
+255,196,3,85,255,196,3,87,255,196,3,89,255,196,3,91,255,196,3,93,255,196,
+3,95,255,226,3,97,255,226,3,99,255,226,3,101,255,226,3,103,255,226,3,105,
+255,226,3,107,255,226,3,108,0,10,3,110,0,10,3,112,0,10,3,126,0,20,0,1,0,45,
+0,90,0,135,0,38,255,206,0,42,255,206,0,50,255,206,0,52,255,206,0,55,255,186,
+0,56,255,236,0,57,255,196,0,58,255,196,0,60,255,196,0,137,255,206,0,148,255,
+206,0,149,255,206,0,150,255,206,0,151,255,206,0,152,255,206,0,154,255,206,
+0,155,255,236,0,156,255,236,0,157,255,236,0,158,255,236,0,159,255,196,0,200,
+255,206,0,202,255,206,0,204,255,206,0,206,255,206,0,222,255,206,0,224,255,
+206,0,226,255,206,0,228,255,206,1,14,255,206,1,16,255,206,1,18,255,206,1,
+20,255,206,1,36,255,186,1,38,255,186,1,42,255,236,1,44,255,236,1,46,255,236,
+1,48,255,236,1,50,255,236,1,52,255,236,1,54,255,196,1,56,255,196,1,58,255,
+196,1,71,255,206,1,102,255,216,1,109,255,216,1,113,255,186,1,114,255,196,
+1,115,255,206,1,117,255,196,1,120,255,196,1,133,255,236,1,157,255,186,1,159,
+255,206,1,166,255,186,1,184,255,206,1,187,255,206,1,188,255,186,1,190,255,
+216,1,193,255,176,1,196,255,186,1,220,255,206,1,225,255,196,1,228,255,206,
+1,250,255,196,1,252,255,196,1,254,255,196,2,0,255,196,2,81,255,196,2,92,255,
+206,2,94,255,236,2,105,255,206,2,121,255,176,2,123,255,206,2,125,255,196,
+2,127,255,196,2,129,255,206,2,131,255,206,2,133,255,206,2,135,255,206,2,137,
+255,206,2,166,255,186,2,167,255,206,2,174,255,206,2,176,255,206,2,178,255,
+186,2,179,255,206,2,180,255,196,2,182,255,196,2,186,255,186,2,187,255,206,
+2,188,255,176,2,189,255,196,2,190,255,176,2,191,255,196,2,194,255,196,2,196,
+255,196,2,209,255,176,2,210,255,196,2,236,255,206,2,238,255,206,2,240,255,
+206,2,250,255,176,2,251,255,196,3,10,255,196,3,11,255,206,3,12,255,196,3,
+13,255,206,3,18,255,206,3,20,255,186,3,21,255,206,3,70,255,206,3,72,255,206,
+3,74,255,206,3,76,255,206,3,78,255,206,3,80,255,206,3,82,255,206,3,84,255,
+206,3,86,255,206,3,88,255,206,3,90,255,206,3,92,255,206,3,94,255,236,3,96,
+255,236,3,98,255,236,3,100,255,236,3,102,255,236,3,104,255,236,3,106,255,
+236,3,108,255,196,3,110,255,196,3,112,255,196,3,126,255,186,0,19,0,55,255,
+216,1,36,255,216,1,38,255,216,1,113,255,216,1,157,255,216,1,166,255,216,1,
+188,255,216,1,196,255,216,1,220,255,236,1,228,255,236,2,166,255,216,2,167,
+255,236,2,178,255,216,2,179,255,236,2,186,255,216,2,187,255,236,3,20,255,
+216,3,21,255,236,3,126,255,216,0,60,0,5,255,186,0,10,255,186,0,38,255,236,
+0,42,255,236,0,45,0,130,0,50,255,236,0,52,255,236,0,55,255,186,0,57,255,216,
+0,58,255,216,0,60,255,196,0,137,255,236,0,148,255,236,0,149,255,236,0,150,
+255,236,0,151,255,236,0,152,255,236,0,154,255,236,0,159,255,196,0,200,255,
+236,0,202,255,236,0,204,255,236,0,206,255,236,0,222,255,236,0,224,255,236,
+0,226,255,236,0,228,255,236,1,14,255,236,1,16,255,236,1,18,255,236,1,20,255,
+236,1,36,255,186,1,38,255,186,1,54,255,216,1,56,255,196,1,58,255,196,1,71,
+255,236,1,250,255,216,1,252,255,216,1,254,255,216,2,0,255,196,2,7,255,186,
+2,11,255,186,2,92,255,236,3,70,255,236,3,72,255,236,3,74,255,236,3,76,255,
+236,3,78,255,236,3,80,255,236,3,82,255,236,3,84,255,236,3,86,255,236,3,88,
+255,236,3,90,255,236,3,92,255,236,3,108,255,196,3,110,255,196,3,112,255,196,
+3,126,255,186,0,52,0,15,255,216,0,17,255,216,0,36,255,236,0,55,255,226,0,
+57,255,246,0,58,255,246,0,59,255,236,0,60,255,246,0,61,255,246,0,130,255,
+236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,255,236,0,135,255,236,
+0,159,255,246,0,194,255,236,0,196,255,236,0,198,255,236,1,36,255,226,1,38,
+255,226,1,54,255,246,1,56,255,246,1,58,255,246,1,59,255,246,1,61,255,246,
+1,63,255,246,1,67,255,236,1,160,255,246,1,250,255,246,1,252,255,246,1,254,
+255,246,2,0,255,246,2,8,255,216,2,12,255,216,2,85,255,236,3,26,255,236,3,
+28,255,236,3,30,255,236,3,32,255,236,3,34,255,236,3,36,255,236,3,38,255,236,
+3,40,255,236,3,42,255,236,3,44,255,236,3,46,255,236,3,48,255,236,3,108,255,
+246,3,110,255,246,3,112,255,246,3,126,255,226,0,37,0,38,255,236,0,42,255,
+236,0,50,255,236,0,52,255,236,0,137,255,236,0,148,255,236,0,149,255,236,0,
+150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,0,200,255,236,0,202,
+255,236,0,204,255,236,0,206,255,236,0,222,255,236,0,224,255,236,0,226,255,
+236,0,228,255,236,1,14,255,236,1,16,255,236,1,18,255,236,1,20,255,236,1,71,
+255,236,2,92,255,236,3,70,255,236,3,72,255,236,3,74,255,236,3,76,255,236,
+3,78,255,236,3,80,255,236,3,82,255,236,3,84,255,236,3,86,255,236,3,88,255,
+236,3,90,255,236,3,92,255,236,0,1,0,45,0,60,0,28,0,15,255,196,0,17,255,196,
+0,36,255,236,0,130,255,236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,
+255,236,0,135,255,236,0,194,255,236,0,196,255,236,0,198,255,236,1,67,255,
+236,2,8,255,196,2,12,255,196,2,85,255,236,3,26,255,236,3,28,255,236,3,30,
+255,236,3,32,255,236,3,34,255,236,3,36,255,236,3,38,255,236,3,40,255,236,
+3,42,255,236,3,44,255,236,3,46,255,236,3,48,255,236,0,78,0,5,255,176,0,10,
+255,176,0,38,255,236,0,42,255,236,0,50,255,236,0,52,255,236,0,55,255,236,
+0,56,255,246,0,57,255,236,0,58,255,236,0,60,255,226,0,137,255,236,0,148,255,
+236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,
+0,155,255,246,0,156,255,246,0,157,255,246,0,158,255,246,0,159,255,226,0,200,
+255,236,0,202,255,236,0,204,255,236,0,206,255,236,0,222,255,236,0,224,255,
+236,0,226,255,236,0,228,255,236,1,14,255,236,1,16,255,236,1,18,255,236,1,
+20,255,236,1,36,255,236,1,38,255,236,1,42,255,246,1,44,255,246,1,46,255,246,
+1,48,255,246,1,50,255,246,1,52,255,246,1,54,255,236,1,56,255,226,1,58,255,
+226,1,71,255,236,1,250,255,236,1,252,255,236,1,254,255,236,2,0,255,226,2,
+7,255,176,2,11,255,176,2,92,255,236,2,94,255,246,3,70,255,236,3,72,255,236,
+3,74,255,236,3,76,255,236,3,78,255,236,3,80,255,236,3,82,255,236,3,84,255,
+236,3,86,255,236,3,88,255,236,3,90,255,236,3,92,255,236,3,94,255,246,3,96,
+255,246,3,98,255,246,3,100,255,246,3,102,255,246,3,104,255,246,3,106,255,
+246,3,108,255,226,3,110,255,226,3,112,255,226,3,126,255,236,0,33,0,15,255,
+126,0,17,255,126,0,36,255,206,0,59,255,236,0,61,255,246,0,130,255,206,0,131,
+255,206,0,132,255,206,0,133,255,206,0,134,255,206,0,135,255,206,0,194,255,
+206,0,196,255,206,0,198,255,206,1,59,255,246,1,61,255,246,1,63,255,246,1,
+67,255,206,2,8,255,126,2,12,255,126,2,85,255,206,3,26,255,206,3,28,255,206,
+3,30,255,206,3,32,255,206,3,34,255,206,3,36,255,206,3,38,255,206,3,40,255,
+206,3,42,255,206,3,44,255,206,3,46,255,206,3,48,255,206,0,202,0,15,255,196,
+0,16,255,216,0,17,255,196,0,34,0,20,0,36,255,186,0,38,255,236,0,42,255,236,
+0,50,255,236,0,52,255,236,0,55,0,20,0,68,255,176,0,70,255,186,0,71,255,186,
+0,72,255,186,0,74,255,186,0,80,255,206,0,81,255,206,0,82,255,186,0,83,255,
+206,0,84,255,186,0,85,255,206,0,86,255,196,0,88,255,206,0,89,255,236,0,90,
+255,236,0,91,255,236,0,92,255,236,0,93,255,216,0,130,255,186,0,131,255,186,
+0,132,255,186,0,133,255,186,0,134,255,186,0,135,255,186,0,137,255,236,0,148,
+255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,255,
+236,0,162,255,186,0,163,255,176,0,164,255,176,0,165,255,176,0,166,255,176,
+0,167,255,176,0,168,255,176,0,169,255,186,0,170,255,186,0,171,255,186,0,172,
+255,186,0,173,255,186,0,180,255,186,0,181,255,186,0,182,255,186,0,183,255,
+186,0,184,255,186,0,186,255,186,0,187,255,206,0,188,255,206,0,189,255,206,
+0,190,255,206,0,191,255,236,0,194,255,186,0,195,255,176,0,196,255,186,0,197,
+255,176,0,198,255,186,0,199,255,176,0,200,255,236,0,201,255,186,0,202,255,
+236,0,203,255,186,0,204,255,236,0,205,255,186,0,206,255,236,0,207,255,186,
+0,209,255,186,0,211,255,186,0,213,255,186,0,215,255,186,0,217,255,186,0,219,
+255,186,0,221,255,186,0,222,255,236,0,223,255,186,0,224,255,236,0,225,255,
+186,0,226,255,236,0,227,255,186,0,228,255,236,0,229,255,186,0,250,255,206,
+1,6,255,206,1,8,255,206,1,13,255,206,1,14,255,236,1,15,255,186,1,16,255,236,
+1,17,255,186,1,18,255,236,1,19,255,186,1,20,255,236,1,21,255,186,1,23,255,
+206,1,25,255,206,1,29,255,196,1,33,255,196,1,36,0,20,1,38,0,20,1,43,255,206,
+1,45,255,206,1,47,255,206,1,49,255,206,1,51,255,206,1,53,255,206,1,55,255,
+236,1,60,255,216,1,62,255,216,1,64,255,216,1,67,255,186,1,68,255,176,1,70,
+255,176,1,71,255,236,1,72,255,186,1,74,255,196,1,251,255,236,1,253,255,236,
+2,2,255,216,2,3,255,216,2,4,255,216,2,8,255,196,2,12,255,196,2,84,255,206,
+2,85,255,186,2,86,255,176,2,92,255,236,2,93,255,186,2,95,255,206,3,26,255,
+186,3,27,255,176,3,28,255,186,3,29,255,176,3,30,255,186,3,31,255,176,3,32,
+255,186,3,34,255,186,3,35,255,176,3,36,255,186,3,37,255,176,3,38,255,186,
+3,39,255,176,3,40,255,186,3,41,255,176,3,42,255,186,3,43,255,176,3,44,255,
+186,3,45,255,176,3,46,255,186,3,47,255,176,3,48,255,186,3,49,255,176,3,51,
+255,186,3,53,255,186,3,55,255,186,3,57,255,186,3,61,255,186,3,63,255,186,
+3,65,255,186,3,70,255,236,3,71,255,186,3,72,255,236,3,73,255,186,3,74,255,
+236,3,75,255,186,3,76,255,236,3,78,255,236,3,79,255,186,3,80,255,236,3,81,
+255,186,3,82,255,236,3,83,255,186,3,84,255,236,3,85,255,186,3,86,255,236,
+3,87,255,186,3,88,255,236,3,89,255,186,3,90,255,236,3,91,255,186,3,92,255,
+236,3,93,255,186,3,95,255,206,3,97,255,206,3,99,255,206,3,101,255,206,3,103,
+255,206,3,105,255,206,3,107,255,206,3,109,255,236,3,126,0,20,0,28,0,15,255,
+236,0,17,255,236,0,36,255,246,0,130,255,246,0,131,255,246,0,132,255,246,0,
+133,255,246,0,134,255,246,0,135,255,246,0,194,255,246,0,196,255,246,0,198,
+255,246,1,67,255,246,2,8,255,236,2,12,255,236,2,85,255,246,3,26,255,246,3,
+28,255,246,3,30,255,246,3,32,255,246,3,34,255,246,3,36,255,246,3,38,255,246,
+3,40,255,246,3,42,255,246,3,44,255,246,3,46,255,246,3,48,255,246,0,181,0,
+15,255,206,0,17,255,206,0,34,0,20,0,36,255,216,0,38,255,246,0,42,255,246,
+0,50,255,246,0,52,255,246,0,68,255,236,0,70,255,236,0,71,255,236,0,72,255,
+236,0,74,255,246,0,80,255,246,0,81,255,246,0,82,255,236,0,83,255,246,0,84,
+255,236,0,85,255,246,0,86,255,246,0,88,255,246,0,130,255,216,0,131,255,216,
+0,132,255,216,0,133,255,216,0,134,255,216,0,135,255,216,0,137,255,246,0,148,
+255,246,0,149,255,246,0,150,255,246,0,151,255,246,0,152,255,246,0,154,255,
+246,0,162,255,236,0,163,255,236,0,164,255,236,0,165,255,236,0,166,255,236,
+0,167,255,236,0,168,255,236,0,169,255,236,0,170,255,236,0,171,255,236,0,172,
+255,236,0,173,255,236,0,180,255,236,0,181,255,236,0,182,255,236,0,183,255,
+236,0,184,255,236,0,186,255,236,0,187,255,246,0,188,255,246,0,189,255,246,
+0,190,255,246,0,194,255,216,0,195,255,236,0,196,255,216,0,197,255,236,0,198,
+255,216,0,199,255,236,0,200,255,246,0,201,255,236,0,202,255,246,0,203,255,
+236,0,204,255,246,0,205,255,236,0,206,255,246,0,207,255,236,0,209,255,236,
+0,211,255,236,0,213,255,236,0,215,255,236,0,217,255,236,0,219,255,236,0,221,
+255,236,0,222,255,246,0,223,255,246,0,224,255,246,0,225,255,246,0,226,255,
+246,0,227,255,246,0,228,255,246,0,229,255,246,0,250,255,246,1,6,255,246,1,
+8,255,246,1,13,255,246,1,14,255,246,1,15,255,236,1,16,255,246,1,17,255,236,
+1,18,255,246,1,19,255,236,1,20,255,246,1,21,255,236,1,23,255,246,1,25,255,
+246,1,29,255,246,1,33,255,246,1,43,255,246,1,45,255,246,1,47,255,246,1,49,
+255,246,1,51,255,246,1,53,255,246,1,67,255,216,1,68,255,236,1,70,255,236,
+1,71,255,246,1,72,255,236,1,74,255,246,2,8,255,206,2,12,255,206,2,84,255,
+246,2,85,255,216,2,86,255,236,2,92,255,246,2,93,255,236,2,95,255,246,3,26,
+255,216,3,27,255,236,3,28,255,216,3,29,255,236,3,30,255,216,3,31,255,236,
+3,32,255,216,3,34,255,216,3,35,255,236,3,36,255,216,3,37,255,236,3,38,255,
+216,3,39,255,236,3,40,255,216,3,41,255,236,3,42,255,216,3,43,255,236,3,44,
+255,216,3,45,255,236,3,46,255,216,3,47,255,236,3,48,255,216,3,49,255,236,
+3,51,255,236,3,53,255,236,3,55,255,236,3,57,255,236,3,61,255,236,3,63,255,
+236,3,65,255,236,3,70,255,246,3,71,255,236,3,72,255,246,3,73,255,236,3,74,
+255,246,3,75,255,236,3,76,255,246,3,78,255,246,3,79,255,236,3,80,255,246,
+3,81,255,236,3,82,255,246,3,83,255,236,3,84,255,246,3,85,255,236,3,86,255,
+246,3,87,255,236,3,88,255,246,3,89,255,236,3,90,255,246,3,91,255,236,3,92,
+255,246,3,93,255,236,3,95,255,246,3,97,255,246,3,99,255,246,3,101,255,246,
+3,103,255,246,3,105,255,246,3,107,255,246,0,185,0,15,255,196,0,17,255,196,
+0,34,0,20,0,36,255,196,0,38,255,236,0,42,255,236,0,50,255,236,0,52,255,236,
+0,68,255,206,0,70,255,206,0,71,255,206,0,72,255,206,0,74,255,236,0,80,255,
+226,0,81,255,226,0,82,255,206,0,83,255,226,0,84,255,206,0,85,255,226,0,86,
+255,216,0,88,255,226,0,93,255,236,0,130,255,196,0,131,255,196,0,132,255,196,
+0,133,255,196,0,134,255,196,0,135,255,196,0,137,255,236,0,148,255,236,0,149,
+255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,0,162,255,
+206,0,163,255,206,0,164,255,206,0,165,255,206,0,166,255,206,0,167,255,206,
+0,168,255,206,0,169,255,206,0,170,255,206,0,171,255,206,0,172,255,206,0,173,
+255,206,0,180,255,206,0,181,255,206,0,182,255,206,0,183,255,206,0,184,255,
+206,0,186,255,206,0,187,255,226,0,188,255,226,0,189,255,226,0,190,255,226,
+0,194,255,196,0,195,255,206,0,196,255,196,0,197,255,206,0,198,255,196,0,199,
+255,206,0,200,255,236,0,201,255,206,0,202,255,236,0,203,255,206,0,204,255,
+236,0,205,255,206,0,206,255,236,0,207,255,206,0,209,255,206,0,211,255,206,
+0,213,255,206,0,215,255,206,0,217,255,206,0,219,255,206,0,221,255,206,0,222,
+255,236,0,223,255,236,0,224,255,236,0,225,255,236,0,226,255,236,0,227,255,
+236,0,228,255,236,0,229,255,236,0,250,255,226,1,6,255,226,1,8,255,226,1,13,
+255,226,1,14,255,236,1,15,255,206,1,16,255,236,1,17,255,206,1,18,255,236,
+1,19,255,206,1,20,255,236,1,21,255,206,1,23,255,226,1,25,255,226,1,29,255,
+216,1,33,255,216,1,43,255,226,1,45,255,226,1,47,255,226,1,49,255,226,1,51,
+255,226,1,53,255,226,1,60,255,236,1,62,255,236,1,64,255,236,1,67,255,196,
+1,68,255,206,1,70,255,206,1,71,255,236,1,72,255,206,1,74,255,216,2,8,255,
+196,2,12,255,196,2,84,255,226,2,85,255,196,2,86,255,206,2,92,255,236,2,93,
+255,206,2,95,255,226,3,26,255,196,3,27,255,206,3,28,255,196,3,29,255,206,
+3,30,255,196,3,31,255,206,3,32,255,196,3,34,255,196,3,35,255,206,3,36,255,
+196,3,37,255,206,3,38,255,196,3,39,255,206,3,40,255,196,3,41,255,206,3,42,
+255,196,3,43,255,206,3,44,255,196,3,45,255,206,3,46,255,196,3,47,255,206,
+3,48,255,196,3,49,255,206,3,51,255,206,3,53,255,206,3,55,255,206,3,57,255,
+206,3,61,255,206,3,63,255,206,3,65,255,206,3,70,255,236,3,71,255,206,3,72,
+255,236,3,73,255,206,3,74,255,236,3,75,255,206,3,76,255,236,3,78,255,236,
+3,79,255,206,3,80,255,236,3,81,255,206,3,82,255,236,3,83,255,206,3,84,255,
+236,3,85,255,206,3,86,255,236,3,87,255,206,3,88,255,236,3,89,255,206,3,90,
+255,236,3,91,255,206,3,92,255,236,3,93,255,206,3,95,255,226,3,97,255,226,
+3,99,255,226,3,101,255,226,3,103,255,226,3,105,255,226,3,107,255,226,0,37,
+0,38,255,246,0,42,255,246,0,50,255,246,0,52,255,246,0,137,255,246,0,148,255,
+246,0,149,255,246,0,150,255,246,0,151,255,246,0,152,255,246,0,154,255,246,
+0,200,255,246,0,202,255,246,0,204,255,246,0,206,255,246,0,222,255,246,0,224,
+255,246,0,226,255,246,0,228,255,246,1,14,255,246,1,16,255,246,1,18,255,246,
+1,20,255,246,1,71,255,246,2,92,255,246,3,70,255,246,3,72,255,246,3,74,255,
+246,3,76,255,246,3,78,255,246,3,80,255,246,3,82,255,246,3,84,255,246,3,86,
+255,246,3,88,255,246,3,90,255,246,3,92,255,246,0,4,0,5,255,246,0,10,255,246,
+2,7,255,246,2,11,255,246,0,17,0,5,255,246,0,10,255,246,0,89,255,236,0,90,
+255,236,0,91,255,236,0,92,255,236,0,93,255,246,0,191,255,236,1,55,255,236,
+1,60,255,246,1,62,255,246,1,64,255,246,1,251,255,236,1,253,255,236,2,7,255,
+246,2,11,255,246,3,109,255,236,0,4,0,5,0,20,0,10,0,20,2,7,0,20,2,11,0,20,
+0,4,0,5,0,60,0,10,0,60,2,7,0,60,2,11,0,60,0,52,0,70,255,236,0,71,255,236,
+0,72,255,236,0,82,255,236,0,84,255,236,0,162,255,236,0,169,255,236,0,170,
+255,236,0,171,255,236,0,172,255,236,0,173,255,236,0,180,255,236,0,181,255,
+236,0,182,255,236,0,183,255,236,0,184,255,236,0,186,255,236,0,201,255,236,
+0,203,255,236,0,205,255,236,0,207,255,236,0,209,255,236,0,211,255,236,0,213,
+255,236,0,215,255,236,0,217,255,236,0,219,255,236,0,221,255,236,1,15,255,
+236,1,17,255,236,1,19,255,236,1,21,255,236,1,72,255,236,2,93,255,236,3,51,
+255,236,3,53,255,236,3,55,255,236,3,57,255,236,3,61,255,236,3,63,255,236,
+3,65,255,236,3,71,255,236,3,73,255,236,3,75,255,236,3,79,255,236,3,81,255,
+236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,236,3,91,255,236,3,93,
+255,236,0,85,0,5,0,40,0,10,0,40,0,68,255,236,0,70,255,236,0,71,255,236,0,
+72,255,236,0,74,255,246,0,82,255,236,0,84,255,236,0,162,255,236,0,163,255,
+236,0,164,255,236,0,165,255,236,0,166,255,236,0,167,255,236,0,168,255,236,
+0,169,255,236,0,170,255,236,0,171,255,236,0,172,255,236,0,173,255,236,0,180,
+255,236,0,181,255,236,0,182,255,236,0,183,255,236,0,184,255,236,0,186,255,
+236,0,195,255,236,0,197,255,236,0,199,255,236,0,201,255,236,0,203,255,236,
+0,205,255,236,0,207,255,236,0,209,255,236,0,211,255,236,0,213,255,236,0,215,
+255,236,0,217,255,236,0,219,255,236,0,221,255,236,0,223,255,246,0,225,255,
+246,0,227,255,246,0,229,255,246,1,15,255,236,1,17,255,236,1,19,255,236,1,
+21,255,236,1,68,255,236,1,70,255,236,1,72,255,236,2,7,0,40,2,11,0,40,2,86,
+255,236,2,93,255,236,3,27,255,236,3,29,255,236,3,31,255,236,3,35,255,236,
+3,37,255,236,3,39,255,236,3,41,255,236,3,43,255,236,3,45,255,236,3,47,255,
+236,3,49,255,236,3,51,255,236,3,53,255,236,3,55,255,236,3,57,255,236,3,61,
+255,236,3,63,255,236,3,65,255,236,3,71,255,236,3,73,255,236,3,75,255,236,
+3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,
+236,3,91,255,236,3,93,255,236,0,9,0,5,0,40,0,10,0,40,0,15,255,216,0,17,255,
+216,0,34,0,20,2,7,0,40,2,8,255,216,2,11,0,40,2,12,255,216,0,4,0,5,255,236,
+0,10,255,236,2,7,255,236,2,11,255,236,0,7,0,5,0,40,0,10,0,40,0,12,0,70,0,
+64,0,70,0,96,0,70,2,7,0,40,2,11,0,40,0,12,0,5,255,186,0,10,255,186,1,102,
+255,236,1,109,255,236,1,113,255,186,1,114,255,196,1,115,255,236,1,117,255,
+216,1,120,255,196,2,7,255,186,2,11,255,186,2,81,255,196,0,17,0,15,255,216,
+0,17,255,216,1,86,255,236,1,95,255,236,1,98,255,236,1,100,255,246,1,105,255,
+236,1,112,255,246,1,113,255,226,1,114,255,246,1,116,255,236,1,117,255,246,
+1,120,255,246,1,136,255,246,2,8,255,216,2,12,255,216,2,81,255,246,0,37,0,
+15,255,196,0,17,255,196,1,86,255,196,1,95,255,196,1,98,255,196,1,102,255,
+236,1,105,255,196,1,109,255,236,1,115,255,226,1,118,255,246,1,121,255,206,
+1,122,255,216,1,123,255,226,1,124,255,226,1,125,255,226,1,126,255,206,1,129,
+255,226,1,130,255,216,1,132,255,226,1,134,255,226,1,135,255,226,1,137,255,
+226,1,140,255,206,1,142,255,206,1,143,255,206,1,144,255,206,1,146,255,226,
+1,147,255,206,1,149,255,226,1,150,255,226,1,152,255,226,1,153,255,206,1,154,
+255,226,1,155,255,226,2,8,255,196,2,12,255,196,2,33,255,246,0,4,1,113,255,
+236,1,114,255,246,1,120,255,246,2,81,255,246,0,8,0,15,255,216,0,17,255,216,
+1,86,255,236,1,95,255,236,1,98,255,236,1,105,255,236,2,8,255,216,2,12,255,
+216,0,45,0,15,255,196,0,16,255,216,0,17,255,196,1,86,255,176,1,95,255,176,
+1,98,255,176,1,102,255,226,1,105,255,176,1,109,255,226,1,115,255,206,1,118,
+255,226,1,121,255,186,1,122,255,206,1,123,255,206,1,124,255,216,1,125,255,
+206,1,126,255,186,1,128,255,236,1,129,255,226,1,130,255,206,1,132,255,206,
+1,134,255,216,1,135,255,206,1,137,255,206,1,138,255,236,1,140,255,186,1,142,
+255,206,1,143,255,186,1,144,255,186,1,146,255,206,1,147,255,186,1,148,255,
+236,1,149,255,206,1,150,255,206,1,152,255,206,1,153,255,186,1,154,255,206,
+1,155,255,206,2,2,255,216,2,3,255,216,2,4,255,216,2,8,255,196,2,12,255,196,
+2,33,255,226,2,80,255,236,0,2,1,102,255,246,1,109,255,246,0,5,1,102,255,236,
+1,109,255,236,1,115,255,226,1,141,255,246,1,145,255,246,0,8,0,15,255,126,
+0,17,255,126,1,86,255,206,1,95,255,206,1,98,255,206,1,105,255,206,2,8,255,
+126,2,12,255,126,0,11,0,15,255,206,0,17,255,206,1,86,255,236,1,95,255,236,
+1,98,255,236,1,105,255,236,1,114,255,226,1,120,255,226,2,8,255,206,2,12,255,
+206,2,81,255,226,0,10,0,15,255,196,0,17,255,196,1,86,255,216,1,95,255,216,
+1,98,255,216,1,102,255,246,1,105,255,216,1,109,255,246,2,8,255,196,2,12,255,
+196,0,1,1,136,0,20,0,6,0,5,255,216,0,10,255,216,1,141,255,246,1,145,255,246,
+2,7,255,216,2,11,255,216,0,5,0,15,255,216,0,17,255,216,1,136,255,246,2,8,
+255,216,2,12,255,216,0,13,0,16,255,206,1,121,255,236,1,126,255,236,1,140,
+255,236,1,141,255,236,1,143,255,236,1,144,255,236,1,145,255,236,1,147,255,
+236,1,153,255,236,2,2,255,206,2,3,255,206,2,4,255,206,0,4,0,15,255,236,0,
+17,255,236,2,8,255,236,2,12,255,236,0,7,1,121,255,236,1,126,255,236,1,140,
+255,236,1,143,255,236,1,144,255,236,1,147,255,236,1,153,255,236,0,15,0,5,
+255,196,0,10,255,196,1,121,255,246,1,126,255,246,1,128,255,236,1,138,255,
+236,1,140,255,246,1,141,255,236,1,143,255,246,1,144,255,246,1,145,255,236,
+1,147,255,246,1,153,255,246,2,7,255,196,2,11,255,196,0,6,0,5,255,246,0,10,
+255,246,1,128,255,236,1,138,255,236,2,7,255,246,2,11,255,246,0,4,0,15,255,
+246,0,17,255,246,2,8,255,246,2,12,255,246,0,15,0,15,255,226,0,16,255,236,
+0,17,255,226,1,121,255,236,1,126,255,236,1,140,255,236,1,143,255,236,1,144,
+255,236,1,147,255,236,1,153,255,236,2,2,255,236,2,3,255,236,2,4,255,236,2,
+8,255,226,2,12,255,226,0,54,0,5,255,216,0,10,255,216,1,157,255,196,1,166,
+255,196,1,168,255,236,1,188,255,206,1,189,255,236,1,193,255,206,1,196,255,
+196,1,220,255,236,1,221,255,236,1,225,255,236,1,228,255,236,1,246,255,236,
+2,7,255,216,2,11,255,216,2,107,255,216,2,121,255,206,2,125,255,216,2,127,
+255,216,2,148,255,216,2,152,255,216,2,164,255,216,2,166,255,196,2,167,255,
+236,2,178,255,206,2,179,255,236,2,180,255,206,2,181,255,236,2,182,255,206,
+2,183,255,236,2,186,255,196,2,187,255,236,2,188,255,206,2,189,255,236,2,190,
+255,206,2,191,255,236,2,209,255,206,2,210,255,236,2,244,255,236,2,245,255,
+236,2,246,255,236,2,247,255,236,2,248,255,236,2,249,255,236,2,250,255,206,
+2,251,255,236,3,0,255,216,3,10,255,206,3,11,255,226,3,12,255,206,3,13,255,
+226,3,20,255,196,3,21,255,236,0,157,0,15,255,196,0,16,255,216,0,17,255,196,
+1,159,255,236,1,164,255,206,1,170,255,186,1,174,255,206,1,181,255,206,1,184,
+255,236,1,187,255,236,1,188,0,20,1,190,255,216,1,204,255,206,1,205,255,206,
+1,206,255,196,1,207,255,186,1,208,255,236,1,209,255,236,1,210,255,206,1,211,
+255,206,1,212,255,206,1,213,255,196,1,214,255,206,1,215,255,206,1,216,255,
+186,1,217,255,206,1,218,255,206,1,219,255,186,1,220,255,216,1,221,255,216,
+1,222,255,186,1,223,255,236,1,224,255,206,1,225,255,206,1,226,255,206,1,227,
+255,206,1,228,255,216,1,229,255,206,1,230,255,206,1,231,255,236,1,232,255,
+206,1,233,255,226,1,234,255,186,1,236,255,206,1,237,255,186,1,238,255,196,
+1,242,255,196,1,243,255,206,1,245,255,206,1,246,255,216,1,247,255,206,1,249,
+255,206,2,2,255,216,2,3,255,216,2,4,255,216,2,8,255,196,2,12,255,196,2,103,
+255,186,2,104,255,206,2,105,255,236,2,106,255,236,2,110,255,206,2,111,255,
+186,2,112,255,196,2,114,255,206,2,116,255,206,2,118,255,206,2,122,255,206,
+2,123,255,236,2,124,255,186,2,126,255,236,2,128,255,236,2,129,255,236,2,130,
+255,186,2,131,255,236,2,132,255,186,2,133,255,236,2,134,255,186,2,135,255,
+236,2,136,255,236,2,137,255,236,2,138,255,186,2,147,255,206,2,151,255,206,
+2,155,255,206,2,157,255,236,2,159,255,236,2,161,255,206,2,163,255,206,2,167,
+255,216,2,169,255,206,2,171,255,206,2,173,255,206,2,174,255,236,2,175,255,
+186,2,176,255,236,2,177,255,186,2,178,0,20,2,179,255,216,2,181,255,216,2,
+183,255,216,2,185,255,236,2,187,255,216,2,189,255,206,2,191,255,206,2,193,
+255,206,2,194,255,206,2,195,255,186,2,196,255,206,2,197,255,186,2,200,255,
+236,2,202,255,206,2,203,255,206,2,204,255,196,2,206,255,206,2,208,255,206,
+2,210,255,206,2,212,255,206,2,214,255,186,2,216,255,186,2,218,255,186,2,221,
+255,186,2,227,255,236,2,229,255,236,2,231,255,226,2,233,255,206,2,235,255,
+206,2,236,255,236,2,237,255,186,2,238,255,236,2,239,255,186,2,240,255,236,
+2,241,255,186,2,243,255,236,2,245,255,216,2,247,255,216,2,249,255,216,2,251,
+255,206,2,253,255,206,2,255,255,206,3,3,255,236,3,5,255,236,3,6,255,186,3,
+7,255,186,3,8,255,186,3,9,255,186,3,11,255,206,3,13,255,206,3,14,255,206,
+3,15,255,196,3,17,255,206,3,18,255,236,3,19,255,186,3,21,255,216,3,23,255,
+186,3,24,255,206,3,25,255,196,0,28,1,159,255,236,1,184,255,236,1,187,255,
+236,1,190,255,236,1,225,255,236,2,105,255,236,2,123,255,236,2,129,255,236,
+2,131,255,236,2,133,255,236,2,135,255,236,2,137,255,236,2,174,255,236,2,176,
+255,236,2,189,255,236,2,191,255,236,2,194,255,236,2,196,255,236,2,210,255,
+236,2,236,255,236,2,238,255,236,2,240,255,236,2,251,255,236,3,6,255,236,3,
+8,255,236,3,11,255,236,3,13,255,236,3,18,255,236,0,2,3,11,255,236,3,13,255,
+236,0,35,1,159,255,236,1,184,255,236,1,187,255,236,1,190,255,236,1,193,255,
+236,1,225,255,236,2,105,255,236,2,121,255,236,2,123,255,236,2,129,255,236,
+2,131,255,236,2,133,255,236,2,135,255,236,2,137,255,236,2,174,255,236,2,176,
+255,236,2,188,255,236,2,189,255,236,2,190,255,236,2,191,255,236,2,194,255,
+206,2,196,255,206,2,209,255,236,2,210,255,236,2,236,255,236,2,238,255,236,
+2,240,255,236,2,250,255,236,2,251,255,236,3,6,255,236,3,8,255,236,3,11,255,
+236,3,13,255,236,3,18,255,236,3,22,255,246,0,78,0,15,255,196,0,17,255,196,
+1,159,255,246,1,164,255,206,1,170,255,186,1,174,255,206,1,181,255,206,1,184,
+255,246,1,187,255,246,1,190,255,226,1,201,255,246,1,206,255,216,1,207,255,
+236,1,213,255,216,1,216,255,236,1,219,255,236,1,222,255,236,1,225,255,236,
+1,234,255,236,1,235,0,50,1,237,255,236,1,238,255,246,1,242,255,216,1,244,
+0,50,2,8,255,196,2,12,255,196,2,103,255,236,2,105,255,246,2,111,255,186,2,
+112,255,216,2,123,255,246,2,124,255,236,2,129,255,246,2,130,255,236,2,131,
+255,246,2,132,255,236,2,133,255,246,2,134,255,236,2,135,255,246,2,137,255,
+246,2,138,255,236,2,149,0,50,2,165,0,50,2,174,255,246,2,175,255,236,2,176,
+255,246,2,177,255,236,2,189,255,236,2,191,255,236,2,194,255,236,2,195,255,
+226,2,196,255,236,2,197,255,226,2,203,255,206,2,204,255,216,2,210,255,236,
+2,214,255,186,2,216,255,186,2,218,255,186,2,221,255,236,2,236,255,246,2,237,
+255,236,2,238,255,246,2,239,255,236,2,240,255,246,2,241,255,236,2,251,255,
+236,3,6,255,186,3,7,255,236,3,8,255,186,3,9,255,236,3,14,255,206,3,15,255,
+216,3,18,255,246,3,19,255,236,3,23,255,236,3,24,255,206,3,25,255,216,0,47,
+0,5,255,186,0,10,255,186,1,157,255,206,1,166,255,206,1,188,255,186,1,190,
+255,236,1,193,255,206,1,196,255,206,1,220,255,236,1,225,255,236,1,228,255,
+236,2,7,255,186,2,11,255,186,2,107,255,236,2,121,255,206,2,125,255,216,2,
+127,255,216,2,148,255,236,2,152,255,236,2,164,255,236,2,166,255,206,2,167,
+255,236,2,178,255,186,2,179,255,236,2,180,255,196,2,182,255,196,2,186,255,
+206,2,187,255,236,2,188,255,206,2,189,255,236,2,190,255,206,2,191,255,236,
+2,194,255,206,2,196,255,206,2,209,255,206,2,210,255,236,2,222,255,236,2,224,
+255,236,2,250,255,206,2,251,255,236,3,0,255,236,3,10,255,186,3,11,255,236,
+3,12,255,186,3,13,255,236,3,20,255,206,3,21,255,236,0,17,0,5,255,236,0,10,
+255,236,1,170,255,246,1,193,255,236,2,7,255,236,2,11,255,236,2,111,255,246,
+2,121,255,236,2,188,255,236,2,190,255,236,2,194,255,236,2,196,255,236,2,209,
+255,236,2,214,255,246,2,216,255,246,2,218,255,246,2,250,255,236,0,10,0,15,
+255,216,0,17,255,216,2,8,255,216,2,12,255,216,2,125,255,246,2,127,255,246,
+2,180,255,246,2,182,255,246,3,10,255,236,3,12,255,236,0,4,1,163,0,110,2,231,
+0,20,3,11,255,236,3,13,255,236,0,61,0,15,255,216,0,17,255,216,1,157,255,246,
+1,164,255,236,1,166,255,246,1,168,255,236,1,170,255,236,1,174,255,236,1,176,
+255,236,1,177,255,246,1,181,255,236,1,188,255,226,1,189,255,236,1,191,255,
+236,1,193,255,236,1,196,255,246,1,199,255,246,1,206,255,246,1,213,255,246,
+1,242,255,246,2,8,255,216,2,12,255,216,2,111,255,236,2,112,255,246,2,119,
+255,246,2,121,255,236,2,125,255,246,2,127,255,246,2,156,255,236,2,158,255,
+246,2,166,255,246,2,178,255,226,2,180,255,246,2,182,255,246,2,184,255,236,
+2,186,255,246,2,188,255,236,2,190,255,236,2,199,255,236,2,203,255,236,2,204,
+255,246,2,209,255,236,2,214,255,236,2,216,255,236,2,218,255,236,2,226,255,
+236,2,228,255,246,2,242,255,246,2,244,255,236,2,246,255,236,2,248,255,236,
+2,250,255,236,3,2,255,236,3,4,255,236,3,10,255,236,3,12,255,236,3,14,255,
+236,3,15,255,246,3,20,255,246,3,24,255,236,3,25,255,246,0,33,0,15,255,126,
+0,17,255,126,1,164,255,196,1,170,255,206,1,174,255,196,1,176,255,236,1,181,
+255,196,1,191,255,236,1,206,255,206,1,213,255,206,1,242,255,206,2,8,255,126,
+2,12,255,126,2,111,255,206,2,112,255,206,2,115,255,246,2,156,255,236,2,184,
+255,236,2,199,255,236,2,203,255,196,2,204,255,206,2,214,255,206,2,216,255,
+206,2,218,255,206,2,226,255,236,3,2,255,236,3,4,255,236,3,6,255,216,3,8,255,
+216,3,14,255,196,3,15,255,206,3,24,255,196,3,25,255,206,0,55,0,15,255,216,
+0,17,255,216,1,157,255,236,1,164,255,236,1,166,255,236,1,168,255,226,1,170,
+255,236,1,174,255,236,1,176,255,236,1,177,255,236,1,181,255,236,1,188,255,
+226,1,189,255,226,1,191,255,236,1,196,255,236,1,199,255,236,1,206,255,246,
+1,213,255,246,1,242,255,246,2,8,255,216,2,12,255,216,2,111,255,236,2,112,
+255,246,2,119,255,236,2,125,255,246,2,127,255,246,2,156,255,236,2,158,255,
+236,2,166,255,236,2,178,255,226,2,180,255,226,2,182,255,226,2,184,255,236,
+2,186,255,236,2,199,255,236,2,203,255,236,2,204,255,246,2,214,255,236,2,216,
+255,236,2,218,255,236,2,226,255,236,2,228,255,236,2,242,255,236,2,244,255,
+226,2,246,255,226,2,248,255,226,3,2,255,236,3,4,255,236,3,10,255,236,3,12,
+255,236,3,14,255,236,3,15,255,246,3,20,255,236,3,24,255,236,3,25,255,246,
+0,1,1,233,0,20,0,37,0,15,255,206,0,16,255,236,0,17,255,206,1,206,255,226,
+1,207,255,246,1,213,255,226,1,216,255,246,1,219,255,246,1,222,255,246,1,234,
+255,246,1,237,255,246,1,242,255,226,2,2,255,236,2,3,255,236,2,4,255,236,2,
+8,255,206,2,12,255,206,2,103,255,246,2,112,255,226,2,124,255,246,2,130,255,
+246,2,132,255,246,2,134,255,246,2,138,255,246,2,175,255,246,2,177,255,246,
+2,204,255,226,2,221,255,246,2,237,255,246,2,239,255,246,2,241,255,246,3,7,
+255,246,3,9,255,246,3,15,255,226,3,19,255,246,3,23,255,246,3,25,255,226,0,
+29,1,207,255,236,1,216,255,236,1,219,255,236,1,222,255,236,1,225,255,236,
+1,234,255,236,1,237,255,236,2,103,255,236,2,124,255,236,2,130,255,236,2,132,
+255,236,2,134,255,236,2,138,255,236,2,175,255,236,2,177,255,236,2,189,255,
+236,2,191,255,236,2,195,255,236,2,197,255,236,2,210,255,236,2,221,255,236,
+2,237,255,236,2,239,255,236,2,241,255,236,2,251,255,236,3,7,255,236,3,9,255,
+236,3,19,255,236,3,23,255,236,0,30,0,5,255,246,0,10,255,246,1,208,255,236,
+1,220,255,246,1,221,255,246,1,223,255,236,1,225,255,246,1,228,255,246,1,246,
+255,246,2,7,255,246,2,11,255,246,2,157,255,236,2,167,255,246,2,179,255,246,
+2,185,255,236,2,187,255,246,2,189,255,246,2,191,255,246,2,200,255,236,2,210,
+255,246,2,227,255,236,2,245,255,246,2,247,255,246,2,249,255,246,2,251,255,
+246,3,3,255,236,3,5,255,236,3,11,255,246,3,13,255,246,3,21,255,246,0,11,0,
+15,255,216,0,17,255,216,1,206,255,236,1,213,255,236,1,242,255,236,2,8,255,
+216,2,12,255,216,2,112,255,236,2,204,255,236,3,15,255,236,3,25,255,236,0,
+39,0,5,255,196,0,10,255,196,1,208,255,236,1,220,255,206,1,221,255,226,1,223,
+255,236,1,225,255,216,1,228,255,206,1,246,255,226,2,7,255,196,2,11,255,196,
+2,106,255,236,2,126,255,236,2,128,255,236,2,136,255,236,2,157,255,236,2,167,
+255,206,2,179,255,206,2,181,255,226,2,183,255,226,2,185,255,236,2,187,255,
+206,2,189,255,216,2,191,255,216,2,195,255,236,2,197,255,236,2,200,255,236,
+2,210,255,216,2,227,255,236,2,231,255,236,2,245,255,226,2,247,255,226,2,249,
+255,226,2,251,255,216,3,3,255,236,3,5,255,236,3,11,255,206,3,13,255,206,3,
+21,255,206,0,6,0,5,255,246,0,10,255,246,2,7,255,246,2,11,255,246,3,11,255,
+236,3,13,255,236,0,4,0,15,255,226,0,17,255,226,2,8,255,226,2,12,255,226,0,
+18,0,73,0,40,0,87,0,40,0,89,0,50,0,90,0,50,0,91,0,50,0,92,0,50,0,191,0,50,
+1,37,0,40,1,39,0,40,1,55,0,50,1,251,0,50,1,253,0,50,2,52,0,40,2,53,0,40,2,
+90,0,40,2,91,0,40,3,109,0,50,3,127,0,40,0,18,0,73,0,50,0,87,0,50,0,89,0,50,
+0,90,0,50,0,91,0,50,0,92,0,50,0,191,0,50,1,37,0,50,1,39,0,50,1,55,0,50,1,
+251,0,50,1,253,0,50,2,52,0,50,2,53,0,50,2,90,0,50,2,91,0,50,3,109,0,50,3,
+127,0,50,0,30,0,5,255,216,0,10,255,216,1,157,255,236,1,166,255,236,1,188,
+255,216,1,193,255,216,1,196,255,236,1,220,255,236,1,228,255,236,2,7,255,216,
+2,11,255,216,2,121,255,216,2,125,255,226,2,127,255,226,2,166,255,236,2,167,
+255,236,2,178,255,216,2,179,255,236,2,180,255,226,2,182,255,226,2,186,255,
+236,2,187,255,236,2,188,255,216,2,190,255,216,2,209,255,216,2,250,255,216,
+3,10,255,206,3,12,255,206,3,20,255,236,3,21,255,236,0,53,0,5,255,186,0,10,
+255,186,1,207,255,236,1,216,255,236,1,219,255,236,1,220,255,206,1,221,255,
+226,1,222,255,236,1,225,255,226,1,228,255,206,1,234,255,236,1,237,255,236,
+1,246,255,226,2,7,255,186,2,11,255,186,2,103,255,236,2,106,255,236,2,122,
+255,246,2,124,255,236,2,126,255,236,2,128,255,236,2,130,255,236,2,132,255,
+236,2,134,255,236,2,136,255,236,2,138,255,236,2,167,255,206,2,175,255,236,
+2,177,255,236,2,179,255,206,2,181,255,236,2,183,255,236,2,187,255,206,2,189,
+255,226,2,191,255,226,2,195,255,236,2,197,255,236,2,210,255,226,2,221,255,
+236,2,237,255,236,2,239,255,236,2,241,255,236,2,245,255,226,2,247,255,226,
+2,249,255,226,2,251,255,226,3,7,255,236,3,9,255,236,3,11,255,196,3,13,255,
+196,3,19,255,236,3,21,255,206,3,23,255,236,0,2,3,10,255,246,3,12,255,246,
+0,24,0,15,255,186,0,17,255,186,1,164,255,226,1,170,255,216,1,174,255,226,
+1,181,255,226,1,206,255,236,1,213,255,236,1,242,255,236,2,8,255,186,2,12,
+255,186,2,111,255,216,2,112,255,236,2,203,255,226,2,204,255,236,2,214,255,
+216,2,216,255,216,2,218,255,216,3,6,255,216,3,8,255,216,3,14,255,226,3,15,
+255,236,3,24,255,226,3,25,255,236,0,148,0,15,255,206,0,16,255,236,0,17,255,
+206,1,157,0,20,1,159,255,236,1,164,255,216,1,166,0,20,1,170,255,196,1,174,
+255,216,1,181,255,216,1,184,255,236,1,187,255,236,1,188,0,20,1,190,255,226,
+1,196,0,20,1,204,255,226,1,205,255,226,1,206,255,206,1,207,255,216,1,208,
+255,236,1,209,255,236,1,210,255,226,1,211,255,226,1,212,255,226,1,213,255,
+206,1,214,255,226,1,215,255,226,1,216,255,216,1,217,255,226,1,218,255,226,
+1,219,255,216,1,222,255,216,1,223,255,236,1,224,255,226,1,225,255,206,1,226,
+255,226,1,227,255,226,1,229,255,226,1,230,255,226,1,231,255,236,1,232,255,
+226,1,234,255,216,1,235,0,20,1,236,255,226,1,237,255,216,1,238,255,226,1,
+242,255,206,1,243,255,226,1,244,0,20,1,245,255,226,1,247,255,226,1,249,255,
+226,2,2,255,236,2,3,255,236,2,4,255,236,2,8,255,206,2,12,255,206,2,103,255,
+216,2,104,255,226,2,105,255,236,2,110,255,226,2,111,255,196,2,112,255,206,
+2,114,255,226,2,116,255,236,2,118,255,226,2,122,255,226,2,123,255,236,2,124,
+255,216,2,129,255,236,2,130,255,216,2,131,255,236,2,132,255,216,2,133,255,
+236,2,134,255,216,2,135,255,236,2,137,255,236,2,138,255,216,2,147,255,226,
+2,149,0,20,2,151,255,226,2,155,255,226,2,157,255,236,2,159,255,236,2,161,
+255,226,2,163,255,226,2,165,0,20,2,166,0,20,2,169,255,226,2,171,255,226,2,
+173,255,226,2,174,255,236,2,175,255,216,2,176,255,236,2,177,255,216,2,178,
+0,20,2,185,255,236,2,186,0,20,2,189,255,206,2,191,255,206,2,193,255,226,2,
+194,255,236,2,195,255,226,2,196,255,236,2,197,255,226,2,200,255,236,2,202,
+255,226,2,203,255,216,2,204,255,206,2,206,255,226,2,208,255,226,2,210,255,
+206,2,212,255,226,2,214,255,196,2,216,255,196,2,218,255,196,2,221,255,216,
+2,227,255,236,2,229,255,236,2,233,255,226,2,235,255,226,2,236,255,236,2,237,
+255,216,2,238,255,236,2,239,255,216,2,240,255,236,2,241,255,216,2,243,255,
+236,2,251,255,206,2,253,255,226,2,255,255,226,3,3,255,236,3,5,255,236,3,6,
+255,206,3,7,255,216,3,8,255,206,3,9,255,216,3,11,255,236,3,13,255,236,3,14,
+255,216,3,15,255,206,3,17,255,226,3,18,255,236,3,19,255,216,3,20,0,20,3,23,
+255,216,3,24,255,216,3,25,255,206,0,33,0,15,255,226,0,17,255,226,1,206,255,
+226,1,207,255,236,1,213,255,226,1,216,255,236,1,219,255,236,1,222,255,236,
+1,234,255,236,1,237,255,236,1,242,255,226,2,8,255,226,2,12,255,226,2,103,
+255,236,2,112,255,226,2,124,255,236,2,130,255,236,2,132,255,236,2,134,255,
+236,2,138,255,236,2,175,255,236,2,177,255,236,2,204,255,226,2,221,255,236,
+2,237,255,236,2,239,255,236,2,241,255,236,3,7,255,236,3,9,255,236,3,15,255,
+226,3,19,255,236,3,23,255,236,3,25,255,226,0,37,0,5,255,226,0,10,255,226,
+1,157,255,226,1,166,255,226,1,188,255,226,1,193,255,216,1,196,255,226,1,220,
+255,236,1,225,255,236,1,228,255,236,2,7,255,226,2,11,255,226,2,121,255,216,
+2,125,255,226,2,127,255,226,2,166,255,226,2,167,255,236,2,178,255,226,2,179,
+255,236,2,180,255,236,2,182,255,236,2,186,255,226,2,187,255,236,2,188,255,
+216,2,189,255,236,2,190,255,216,2,191,255,236,2,209,255,216,2,210,255,236,
+2,250,255,216,2,251,255,236,3,10,255,236,3,11,255,226,3,12,255,236,3,13,255,
+226,3,20,255,226,3,21,255,236,0,6,0,5,255,226,0,10,255,226,2,7,255,226,2,
+11,255,226,3,11,255,236,3,13,255,236,0,37,1,159,255,236,1,163,0,110,1,184,
+255,236,1,187,255,236,1,190,255,226,1,220,255,236,1,225,255,216,1,228,255,
+236,2,105,255,236,2,120,0,30,2,122,255,246,2,123,255,236,2,129,255,236,2,
+131,255,236,2,133,255,236,2,135,255,236,2,137,255,236,2,167,255,236,2,174,
+255,236,2,176,255,236,2,179,255,236,2,187,255,236,2,189,255,216,2,191,255,
+216,2,194,255,226,2,195,255,236,2,196,255,226,2,197,255,236,2,210,255,216,
+2,236,255,236,2,238,255,236,2,240,255,236,2,251,255,216,3,11,255,236,3,13,
+255,236,3,18,255,236,3,21,255,236,0,29,1,207,255,246,1,216,255,246,1,219,
+255,246,1,222,255,246,1,225,255,246,1,234,255,246,1,237,255,246,2,103,255,
+246,2,124,255,246,2,130,255,246,2,132,255,246,2,134,255,246,2,138,255,246,
+2,175,255,246,2,177,255,246,2,189,255,246,2,191,255,246,2,210,255,246,2,221,
+255,246,2,237,255,246,2,239,255,246,2,241,255,246,2,251,255,246,3,7,255,246,
+3,9,255,246,3,11,255,236,3,13,255,236,3,19,255,246,3,23,255,246,0,41,0,5,
+255,176,0,10,255,176,1,157,255,206,1,166,255,206,1,188,255,166,1,193,255,
+196,1,196,255,206,1,220,255,216,1,225,255,236,1,228,255,216,2,7,255,176,2,
+11,255,176,2,121,255,196,2,125,255,186,2,127,255,186,2,166,255,206,2,167,
+255,216,2,178,255,166,2,179,255,216,2,180,255,206,2,182,255,206,2,186,255,
+206,2,187,255,216,2,188,255,196,2,189,255,236,2,190,255,196,2,191,255,236,
+2,194,255,226,2,195,255,236,2,196,255,226,2,197,255,236,2,209,255,196,2,210,
+255,236,2,250,255,196,2,251,255,236,3,10,255,166,3,11,255,216,3,12,255,166,
+3,13,255,216,3,20,255,206,3,21,255,216,0,25,0,5,255,186,0,10,255,186,1,220,
+255,206,1,225,255,236,1,228,255,206,2,7,255,186,2,11,255,186,2,106,255,236,
+2,126,255,236,2,128,255,236,2,136,255,236,2,167,255,206,2,179,255,206,2,181,
+255,236,2,183,255,236,2,187,255,206,2,189,255,236,2,191,255,236,2,195,255,
+236,2,197,255,236,2,210,255,236,2,251,255,236,3,11,255,186,3,13,255,186,3,
+21,255,206,0,14,1,157,255,236,1,166,255,236,1,188,255,226,1,196,255,236,2,
+125,255,246,2,127,255,246,2,166,255,236,2,178,255,226,2,180,255,246,2,182,
+255,246,2,186,255,236,3,10,255,236,3,12,255,236,3,20,255,236,0,131,0,15,255,
+196,0,17,255,196,1,159,255,236,1,164,255,216,1,170,255,196,1,174,255,216,
+1,181,255,216,1,184,255,236,1,187,255,236,1,190,255,226,1,202,255,216,1,204,
+255,226,1,205,255,226,1,206,255,206,1,207,255,206,1,210,255,226,1,211,255,
+226,1,212,255,226,1,213,255,206,1,214,255,226,1,215,255,226,1,216,255,206,
+1,217,255,226,1,218,255,226,1,219,255,206,1,222,255,206,1,224,255,226,1,225,
+255,216,1,226,255,226,1,227,255,226,1,229,255,226,1,230,255,226,1,232,255,
+226,1,233,255,236,1,234,255,206,1,235,0,20,1,236,255,226,1,237,255,206,1,
+238,255,216,1,242,255,206,1,243,255,226,1,244,0,20,1,245,255,226,1,247,255,
+226,1,249,255,226,2,8,255,196,2,12,255,196,2,103,255,206,2,104,255,226,2,
+105,255,236,2,110,255,226,2,111,255,196,2,112,255,206,2,114,255,226,2,116,
+255,236,2,118,255,226,2,122,255,236,2,123,255,236,2,124,255,206,2,129,255,
+236,2,130,255,206,2,131,255,236,2,132,255,206,2,133,255,236,2,134,255,206,
+2,135,255,236,2,137,255,236,2,138,255,206,2,147,255,226,2,149,0,20,2,151,
+255,226,2,155,255,226,2,161,255,226,2,163,255,226,2,165,0,20,2,169,255,226,
+2,171,255,226,2,173,255,226,2,174,255,236,2,175,255,206,2,176,255,236,2,177,
+255,206,2,189,255,216,2,191,255,216,2,193,255,226,2,195,255,216,2,197,255,
+216,2,202,255,226,2,203,255,216,2,204,255,206,2,206,255,226,2,208,255,226,
+2,210,255,216,2,212,255,226,2,214,255,196,2,215,255,216,2,216,255,196,2,217,
+255,216,2,218,255,196,2,219,255,216,2,221,255,206,2,222,255,246,2,223,255,
+216,2,224,255,246,2,225,255,216,2,233,255,226,2,235,255,226,2,236,255,236,
+2,237,255,206,2,238,255,236,2,239,255,206,2,240,255,236,2,241,255,206,2,251,
+255,216,2,253,255,226,2,255,255,226,3,6,255,216,3,7,255,206,3,8,255,216,3,
+9,255,206,3,11,255,236,3,13,255,236,3,14,255,216,3,15,255,206,3,17,255,226,
+3,18,255,236,3,19,255,206,3,22,255,246,3,23,255,206,3,24,255,216,3,25,255,
+206,0,11,0,15,255,216,0,17,255,216,1,206,255,246,1,213,255,246,1,242,255,
+246,2,8,255,216,2,12,255,216,2,112,255,246,2,204,255,246,3,15,255,246,3,25,
+255,246,0,42,0,5,255,226,0,10,255,226,1,157,255,236,1,166,255,236,1,188,255,
+196,1,193,255,216,1,196,255,236,1,220,255,236,1,221,255,246,1,225,255,246,
+1,228,255,236,1,246,255,246,2,7,255,226,2,11,255,226,2,121,255,216,2,125,
+255,226,2,127,255,226,2,166,255,236,2,167,255,236,2,178,255,196,2,179,255,
+236,2,180,255,206,2,182,255,206,2,186,255,236,2,187,255,236,2,188,255,216,
+2,189,255,246,2,190,255,216,2,191,255,246,2,209,255,216,2,210,255,246,2,245,
+255,246,2,247,255,246,2,249,255,246,2,250,255,216,2,251,255,246,3,10,255,
+216,3,11,255,236,3,12,255,216,3,13,255,236,3,20,255,236,3,21,255,236,0,19,
+0,5,255,206,0,10,255,206,1,220,255,236,1,221,255,236,1,228,255,236,1,246,
+255,236,2,7,255,206,2,11,255,206,2,167,255,236,2,179,255,236,2,181,255,236,
+2,183,255,236,2,187,255,236,2,245,255,236,2,247,255,236,2,249,255,236,3,11,
+255,216,3,13,255,216,3,21,255,236,0,8,1,188,255,236,2,125,255,246,2,127,255,
+246,2,178,255,236,2,180,255,246,2,182,255,246,3,10,255,246,3,12,255,246,0,
+41,0,5,255,226,0,10,255,226,1,188,255,236,1,193,255,216,1,220,255,226,1,225,
+255,236,1,228,255,226,2,7,255,226,2,11,255,226,2,106,255,246,2,121,255,216,
+2,125,255,236,2,126,255,246,2,127,255,236,2,128,255,246,2,136,255,246,2,167,
+255,226,2,178,255,236,2,179,255,226,2,180,255,236,2,181,255,246,2,182,255,
+236,2,183,255,246,2,187,255,226,2,188,255,216,2,189,255,236,2,190,255,216,
+2,191,255,236,2,194,255,226,2,195,255,236,2,196,255,226,2,197,255,236,2,209,
+255,216,2,210,255,236,2,250,255,216,2,251,255,236,3,10,255,236,3,11,255,226,
+3,12,255,236,3,13,255,226,3,21,255,226,0,5,1,225,255,236,2,189,255,236,2,
+191,255,236,2,210,255,236,2,251,255,236,0,64,0,5,255,206,0,10,255,206,1,157,
+255,216,1,166,255,216,1,168,255,226,1,170,255,226,1,176,255,226,1,188,255,
+186,1,189,255,226,1,191,255,226,1,193,255,226,1,196,255,216,1,208,255,236,
+1,220,255,226,1,223,255,236,1,225,255,236,1,228,255,226,2,7,255,206,2,11,
+255,206,2,111,255,226,2,115,255,236,2,121,255,226,2,125,255,226,2,127,255,
+226,2,156,255,226,2,157,255,236,2,166,255,216,2,167,255,226,2,178,255,186,
+2,179,255,226,2,180,255,226,2,182,255,226,2,184,255,226,2,185,255,236,2,186,
+255,216,2,187,255,226,2,188,255,226,2,189,255,236,2,190,255,226,2,191,255,
+236,2,199,255,226,2,200,255,236,2,209,255,226,2,210,255,236,2,214,255,226,
+2,216,255,226,2,218,255,226,2,226,255,226,2,227,255,236,2,244,255,226,2,246,
+255,226,2,248,255,226,2,250,255,226,2,251,255,236,3,2,255,226,3,3,255,236,
+3,4,255,226,3,5,255,236,3,10,255,236,3,11,255,236,3,12,255,236,3,13,255,236,
+3,20,255,216,3,21,255,226,0,30,0,5,255,206,0,10,255,206,1,208,255,236,1,220,
+255,226,1,221,255,236,1,223,255,236,1,225,255,236,1,228,255,226,1,246,255,
+236,2,7,255,206,2,11,255,206,2,157,255,236,2,167,255,226,2,179,255,226,2,
+185,255,236,2,187,255,226,2,189,255,236,2,191,255,236,2,200,255,236,2,210,
+255,236,2,227,255,236,2,245,255,236,2,247,255,236,2,249,255,236,2,251,255,
+236,3,3,255,236,3,5,255,236,3,11,255,206,3,13,255,206,3,21,255,226,0,23,0,
+15,255,216,0,17,255,216,1,170,255,246,1,176,255,236,1,188,255,236,1,191,255,
+236,2,8,255,216,2,12,255,216,2,111,255,246,2,125,255,246,2,127,255,246,2,
+156,255,236,2,178,255,236,2,180,255,246,2,182,255,246,2,184,255,236,2,199,
+255,236,2,214,255,246,2,216,255,246,2,218,255,246,2,226,255,236,3,2,255,236,
+3,4,255,236,0,19,0,5,255,236,0,10,255,236,1,208,255,246,1,221,255,246,1,223,
+255,246,1,246,255,246,2,7,255,236,2,11,255,236,2,157,255,246,2,185,255,246,
+2,200,255,246,2,227,255,246,2,245,255,246,2,247,255,246,2,249,255,246,3,3,
+255,246,3,5,255,246,3,11,255,236,3,13,255,236,0,43,0,5,255,216,0,10,255,216,
+1,157,255,226,1,166,255,226,1,170,255,236,1,176,255,236,1,188,255,226,1,191,
+255,236,1,193,255,236,1,196,255,226,1,220,255,236,1,228,255,236,2,7,255,216,
+2,11,255,216,2,111,255,236,2,121,255,236,2,125,255,236,2,127,255,236,2,156,
+255,236,2,166,255,226,2,167,255,236,2,178,255,226,2,179,255,236,2,180,255,
+236,2,182,255,236,2,184,255,236,2,186,255,226,2,187,255,236,2,188,255,236,
+2,190,255,236,2,199,255,236,2,209,255,236,2,214,255,236,2,216,255,236,2,218,
+255,236,2,226,255,236,2,250,255,236,3,2,255,236,3,4,255,236,3,10,255,236,
+3,12,255,236,3,20,255,226,3,21,255,236,0,0,0,1,0,0,0,10,0,76,0,186,0,3,99,
+121,114,108,0,20,103,114,101,107,0,34,108,97,116,110,0,48,0,4,0,0,0,0,255,
+255,0,2,0,1,0,5,0,4,0,0,0,0,255,255,0,2,0,2,0,6,0,4,0,0,0,0,255,255,0,4,0,
+0,0,3,0,4,0,7,0,8,97,97,108,116,0,50,99,99,109,112,0,56,99,99,109,112,0,66,
+99,99,109,112,0,76,108,105,103,97,0,86,114,116,108,109,0,92,114,116,108,109,
+0,98,114,116,108,109,0,104,0,0,0,1,0,5,0,0,0,3,0,0,0,1,0,2,0,0,0,3,0,0,0,
+1,0,2,0,0,0,3,0,0,0,1,0,2,0,0,0,1,0,4,0,0,0,1,0,3,0,0,0,1,0,3,0,0,0,1,0,3,
+0,7,0,16,0,32,0,48,0,64,0,80,0,96,0,112,0,7,0,0,0,1,0,8,0,1,0,4,0,0,0,104,
+0,7,0,0,0,1,0,8,0,1,0,6,0,0,5,204,0,7,0,0,0,1,0,8,0,1,0,4,0,0,6,60,0,7,0,
+0,0,1,0,8,0,1,0,1,0,0,7,200,0,7,0,0,0,1,0,8,0,1,0,4,0,0,7,230,0,7,0,0,0,1,
+0,8,0,1,0,3,0,0,8,10,0,7,0,0,0,1,0,8,0,1,0,1,0,0,8,24,0,1,0,16,0,5,0,26,0,
+84,0,142,0,200,1,2,0,2,0,1,4,202,4,206,0,0,0,28,1,34,1,42,1,50,1,58,1,66,
+1,74,1,82,1,90,1,98,1,106,1,112,1,120,1,128,1,136,1,144,1,152,1,158,1,166,
+1,174,1,182,1,190,1,198,1,204,1,212,1,220,1,228,1,236,1,244,0,28,1,192,1,
+200,1,208,1,216,1,224,1,232,1,238,1,246,1,254,2,6,2,14,2,22,2,30,2,38,2,46,
+2,54,2,60,2,68,2,76,2,84,2,92,2,100,2,106,2,114,2,122,2,130,2,138,2,146,0,
+28,2,94,2,102,2,110,2,118,2,126,2,134,2,140,2,148,2,156,2,164,2,172,2,180,
+2,186,2,194,2,202,2,210,2,218,2,226,2,234,2,242,2,250,3,2,3,8,3,16,3,24,3,
+32,3,40,3,48,0,28,2,252,3,4,3,12,3,20,3,28,3,36,3,42,3,50,3,58,3,66,3,74,
+3,82,3,88,3,96,3,104,3,112,3,120,3,128,3,134,3,142,3,150,3,158,3,166,3,172,
+3,180,3,188,3,196,3,204,0,28,3,154,3,162,3,170,3,178,3,186,3,194,3,200,3,
+208,3,216,3,224,3,232,3,240,3,246,3,254,4,6,4,14,4,22,4,30,4,36,4,44,4,52,
+4,60,4,68,4,76,4,82,4,90,4,98,4,106,8,143,0,3,4,202,4,203,8,144,0,3,4,202,
+4,204,8,145,0,3,4,202,4,205,8,146,0,3,4,202,4,206,8,147,0,3,4,203,4,202,8,
+148,0,3,4,203,4,203,8,149,0,3,4,203,4,204,8,150,0,3,4,203,4,205,8,151,0,3,
+4,203,4,206,8,152,0,2,4,203,8,153,0,3,4,204,4,202,8,154,0,3,4,204,4,203,8,
+155,0,3,4,204,4,204,8,156,0,3,4,204,4,205,8,157,0,3,4,204,4,206,8,158,0,2,
+4,204,8,159,0,3,4,205,4,202,8,160,0,3,4,205,4,203,8,161,0,3,4,205,4,204,8,
+162,0,3,4,205,4,205,8,163,0,3,4,205,4,206,8,164,0,2,4,205,8,165,0,3,4,206,
+4,202,8,166,0,3,4,206,4,203,8,167,0,3,4,206,4,204,8,168,0,3,4,206,4,205,8,
+169,0,3,4,206,4,206,8,170,0,2,4,206,8,171,0,3,4,202,4,202,8,172,0,3,4,202,
+4,203,8,173,0,3,4,202,4,204,8,174,0,3,4,202,4,205,8,175,0,3,4,202,4,206,8,
+176,0,2,4,202,8,177,0,3,4,203,4,202,8,178,0,3,4,203,4,204,8,179,0,3,4,203,
+4,205,8,180,0,3,4,203,4,206,8,181,0,3,4,204,4,202,8,182,0,3,4,204,4,203,8,
+183,0,3,4,204,4,204,8,184,0,3,4,204,4,205,8,185,0,3,4,204,4,206,8,186,0,2,
+4,204,8,187,0,3,4,205,4,202,8,188,0,3,4,205,4,203,8,189,0,3,4,205,4,204,8,
+190,0,3,4,205,4,205,8,191,0,3,4,205,4,206,8,192,0,2,4,205,8,193,0,3,4,206,
+4,202,8,194,0,3,4,206,4,203,8,195,0,3,4,206,4,204,8,196,0,3,4,206,4,205,8,
+197,0,3,4,206,4,206,8,198,0,2,4,206,8,199,0,3,4,202,4,202,8,200,0,3,4,202,
+4,203,8,201,0,3,4,202,4,204,8,202,0,3,4,202,4,205,8,203,0,3,4,202,4,206,8,
+204,0,2,4,202,8,205,0,3,4,203,4,202,8,206,0,3,4,203,4,203,8,207,0,3,4,203,
+4,204,8,208,0,3,4,203,4,205,8,209,0,3,4,203,4,206,8,210,0,2,4,203,8,211,0,
+3,4,204,4,202,8,212,0,3,4,204,4,203,8,213,0,3,4,204,4,205,8,214,0,3,4,204,
+4,206,8,215,0,3,4,205,4,202,8,216,0,3,4,205,4,203,8,217,0,3,4,205,4,204,8,
+218,0,3,4,205,4,205,8,219,0,3,4,205,4,206,8,220,0,2,4,205,8,221,0,3,4,206,
+4,202,8,222,0,3,4,206,4,203,8,223,0,3,4,206,4,204,8,224,0,3,4,206,4,205,8,
+225,0,3,4,206,4,206,8,226,0,2,4,206,8,227,0,3,4,202,4,202,8,228,0,3,4,202,
+4,203,8,229,0,3,4,202,4,204,8,230,0,3,4,202,4,205,8,231,0,3,4,202,4,206,8,
+232,0,2,4,202,8,233,0,3,4,203,4,202,8,234,0,3,4,203,4,203,8,235,0,3,4,203,
+4,204,8,236,0,3,4,203,4,205,8,237,0,3,4,203,4,206,8,238,0,2,4,203,8,239,0,
+3,4,204,4,202,8,240,0,3,4,204,4,203,8,241,0,3,4,204,4,204,8,242,0,3,4,204,
+4,205,8,243,0,3,4,204,4,206,8,244,0,2,4,204,8,245,0,3,4,205,4,202,8,246,0,
+3,4,205,4,203,8,247,0,3,4,205,4,204,8,248,0,3,4,205,4,206,8,254,0,2,4,206,
+8,249,0,3,4,206,4,202,8,250,0,3,4,206,4,203,8,251,0,3,4,206,4,204,8,252,0,
+3,4,206,4,205,8,253,0,3,4,206,4,206,8,255,0,3,4,202,4,202,9,0,0,3,4,202,4,
+203,9,1,0,3,4,202,4,204,9,2,0,3,4,202,4,205,9,3,0,3,4,202,4,206,9,4,0,2,4,
+202,9,5,0,3,4,203,4,202,9,6,0,3,4,203,4,203,9,7,0,3,4,203,4,204,9,8,0,3,4,
+203,4,205,9,9,0,3,4,203,4,206,9,10,0,2,4,203,9,11,0,3,4,204,4,202,9,12,0,
+3,4,204,4,203,9,13,0,3,4,204,4,204,9,14,0,3,4,204,4,205,9,15,0,3,4,204,4,
+206,9,16,0,2,4,204,9,17,0,3,4,205,4,202,9,18,0,3,4,205,4,203,9,19,0,3,4,205,
+4,204,9,20,0,3,4,205,4,205,9,21,0,3,4,205,4,206,9,22,0,2,4,205,9,23,0,3,4,
+206,4,202,9,24,0,3,4,206,4,203,9,25,0,3,4,206,4,204,9,26,0,3,4,206,4,205,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,6,0,1,0,3,0,76,0,77,4,87,0,2,0,16,2,96,
+2,98,0,0,2,140,2,143,0,3,3,115,3,115,0,7,4,228,4,244,0,8,4,250,4,250,0,25,
+5,28,5,30,0,26,5,33,5,35,0,29,5,37,5,37,0,32,5,41,5,43,0,33,5,47,5,49,0,36,
+5,54,5,54,0,39,5,58,5,58,0,40,5,66,5,78,0,41,6,72,6,73,0,54,6,75,6,81,0,56,
+6,83,6,83,0,63,0,1,0,12,0,3,0,22,0,40,0,66,0,1,0,3,1,126,1,134,1,146,0,8,
+0,70,0,80,0,90,0,100,0,110,0,120,0,130,0,140,0,12,0,132,0,142,0,152,0,162,
+0,172,0,182,0,192,0,202,0,212,0,222,0,232,0,242,0,12,0,226,0,236,0,246,1,
+0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,1,80,9,27,0,4,4,229,4,243,2,96,9,28,
+0,4,4,229,4,243,2,97,9,29,0,4,4,229,4,244,2,96,9,30,0,4,4,229,4,244,2,97,
+9,31,0,4,4,231,4,243,2,96,9,32,0,4,4,231,4,243,2,97,9,33,0,4,4,231,4,244,
+2,96,9,34,0,4,4,231,4,244,2,97,9,35,0,4,4,229,4,243,2,96,9,36,0,4,4,229,4,
+243,2,97,9,37,0,4,4,229,4,244,2,96,9,38,0,4,4,229,4,244,2,97,9,39,0,4,4,231,
+4,243,2,96,9,40,0,4,4,231,4,243,2,97,9,41,0,4,4,231,4,244,2,96,9,42,0,4,4,
+231,4,244,2,97,9,51,0,4,4,233,4,229,2,96,9,52,0,4,4,233,4,229,2,97,9,53,0,
+4,4,233,4,231,2,96,9,54,0,4,4,233,4,231,2,97,9,43,0,4,4,229,4,243,2,96,9,
+44,0,4,4,229,4,243,2,97,9,45,0,4,4,229,4,244,2,96,9,46,0,4,4,229,4,244,2,
+97,9,47,0,4,4,231,4,243,2,96,9,48,0,4,4,231,4,243,2,97,9,49,0,4,4,231,4,244,
+2,96,9,50,0,4,4,231,4,244,2,97,9,55,0,4,4,233,4,229,2,96,9,56,0,4,4,233,4,
+229,2,97,9,57,0,4,4,233,4,231,2,96,9,58,0,4,4,233,4,231,2,97,0,2,0,24,0,9,
+2,89,8,138,9,71,9,107,9,108,9,109,9,106,9,110,9,111,0,1,0,9,2,39,2,42,2,44,
+2,46,2,47,2,48,8,16,8,21,8,22,0,1,0,8,0,1,0,14,0,1,0,1,0,73,0,4,0,10,0,16,
+0,22,0,30,2,52,0,2,0,76,2,53,0,2,0,79,2,90,0,3,0,73,0,76,2,91,0,3,0,73,0,
+79,0,1,0,22,0,2,0,10,0,18,0,3,9,59,9,60,9,61,0,1,9,62,0,1,0,2,1,12,5,86,0,
+2,0,12,0,3,0,243,2,55,6,3,0,1,0,3,0,76,0,77,4,87,};
+#endif
@@ -0,0 +1,674 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansArmenian_Regular_ttf_size = 16720;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansArmenian_Regular_ttf");
+asm(".type fz_font_NotoSansArmenian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansArmenian_Regular_ttf, 16720");
+asm(".balign 64");
+asm("fz_font_NotoSansArmenian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansArmenian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansArmenian_Regular_ttf_size = 16720;
+const char fz_font_NotoSansArmenian_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,16,0,98,0,0,50,16,0,0,0,22,71,80,
+79,83,205,126,235,115,0,0,50,40,0,0,14,148,71,83,85,66,209,58,216,137,0,0,
+64,188,0,0,0,146,79,83,47,50,128,25,107,104,0,0,1,104,0,0,0,96,99,109,97,
+112,7,107,17,5,0,0,3,80,0,0,0,124,103,97,115,112,0,7,0,7,0,0,50,4,0,0,0,12,
+103,108,121,102,168,119,4,72,0,0,4,148,0,0,35,118,104,101,97,100,8,62,69,
+228,0,0,0,236,0,0,0,54,104,104,101,97,19,189,10,8,0,0,1,36,0,0,0,36,104,109,
+116,120,5,215,58,80,0,0,1,200,0,0,1,136,108,111,99,97,154,75,145,192,0,0,
+3,204,0,0,0,198,109,97,120,112,0,106,0,121,0,0,1,72,0,0,0,32,110,97,109,101,
+141,242,185,213,0,0,40,12,0,0,6,12,112,111,115,116,236,216,178,163,0,0,46,
+24,0,0,3,235,0,1,0,0,0,2,7,174,92,10,51,229,95,15,60,245,0,11,8,0,0,0,0,0,
+203,200,40,216,0,0,0,0,210,40,203,225,255,182,253,213,11,119,6,170,0,0,0,
+9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,12,58,255,182,255,195,11,119,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,1,0,0,0,98,0,80,0,3,0,39,0,2,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,5,86,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,34,0,0,2,11,5,2,4,5,4,2,2,4,0,0,4,0,0,0,0,0,
+0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,
+0,0,0,1,0,0,0,0,4,170,6,170,0,0,0,32,0,2,4,225,0,203,0,0,0,0,2,20,0,0,2,20,
+0,0,6,152,0,205,5,167,0,205,6,57,0,133,6,18,0,133,5,187,0,205,5,99,0,160,
+5,36,0,220,5,169,0,205,6,232,0,205,6,44,0,133,5,163,0,220,3,102,0,220,6,219,
+0,220,5,197,0,133,5,198,0,184,4,247,0,175,5,88,0,143,6,15,0,130,5,136,0,140,
+6,111,0,205,5,70,0,130,5,66,0,124,5,60,0,141,5,194,0,205,5,66,0,133,6,124,
+0,160,5,58,0,150,6,141,0,205,5,194,0,205,6,122,0,160,4,180,0,134,5,71,0,205,
+5,106,0,146,4,228,0,220,6,151,0,124,5,74,0,60,6,82,0,145,5,251,0,130,1,176,
+0,44,1,176,0,95,2,48,0,120,2,102,0,120,2,78,0,120,3,146,0,120,3,81,0,90,7,
+152,0,182,4,224,0,194,5,68,0,133,5,84,0,194,4,224,0,182,4,220,0,133,3,241,
+0,194,4,227,0,194,5,153,0,194,5,28,0,133,4,223,0,193,2,52,0,194,7,75,0,194,
+4,241,0,133,4,223,0,182,4,148,0,130,4,206,0,120,4,224,0,194,4,183,0,82,4,
+229,0,182,2,44,0,90,4,219,0,127,3,195,0,52,4,224,0,194,2,191,255,182,7,151,
+0,182,4,173,0,131,5,20,0,194,4,224,0,182,4,223,0,182,7,144,0,182,4,224,0,
+194,4,220,0,133,2,151,0,194,7,139,0,182,4,220,0,48,4,194,0,133,5,70,0,109,
+5,68,0,182,2,39,0,157,3,135,0,112,9,166,0,182,9,217,0,182,9,206,0,182,9,220,
+0,182,12,58,0,182,5,246,0,133,10,147,0,205,7,138,0,194,0,0,0,1,0,3,0,1,0,
+0,0,12,0,4,0,112,0,0,0,24,0,16,0,3,0,8,0,0,0,13,0,32,0,160,5,86,5,95,5,135,
+5,138,5,143,251,23,254,255,255,255,0,0,0,0,0,13,0,32,0,160,5,49,5,89,5,97,
+5,137,5,143,251,19,254,255,255,255,0,1,255,245,255,227,255,99,250,211,250,
+209,250,208,250,207,250,208,5,71,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,72,0,108,0,154,0,191,0,228,1,43,
+1,74,1,109,1,169,1,218,1,255,2,15,2,53,2,119,2,157,2,210,3,50,3,84,3,141,
+3,177,3,239,4,33,4,78,4,111,4,167,4,205,5,19,5,56,5,89,5,128,5,185,5,216,
+6,32,6,65,6,126,6,177,6,226,7,32,7,59,7,85,7,109,7,132,7,155,7,186,7,218,
+8,16,8,56,8,111,8,149,8,189,8,242,9,14,9,51,9,131,9,193,9,232,9,247,10,52,
+10,121,10,159,10,211,11,26,11,62,11,133,11,196,11,230,12,32,12,82,12,116,
+12,167,12,225,13,36,13,80,13,113,13,154,13,209,13,243,14,51,14,66,14,129,
+14,190,14,231,15,42,15,79,15,117,15,141,15,249,16,80,16,166,17,3,17,112,17,
+163,17,175,17,187,0,0,0,2,0,203,0,0,4,20,5,182,0,3,0,7,0,0,19,33,17,33,55,
+33,17,33,203,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,
+0,205,255,236,6,97,5,182,0,33,0,0,1,6,4,35,34,0,17,17,51,17,20,22,51,50,54,
+53,17,51,17,20,7,54,54,51,50,22,21,21,35,53,52,35,35,34,4,215,51,255,0,195,
+254,254,234,182,175,175,173,177,182,3,14,31,17,156,149,176,174,20,13,1,73,
+172,177,1,41,1,20,3,141,252,135,221,214,214,222,3,120,252,115,37,36,2,3,155,
+154,176,129,203,0,1,0,205,0,0,5,5,5,202,0,21,0,0,19,16,0,51,50,0,21,21,35,
+53,52,38,35,34,6,21,21,33,21,33,17,35,205,1,22,255,252,1,22,182,181,168,175,
+175,3,130,252,126,182,3,141,1,18,1,43,254,241,244,44,61,165,175,214,221,188,
+160,253,227,0,2,0,133,0,0,5,253,5,202,0,16,0,27,0,0,1,33,32,36,53,52,0,51,
+50,0,21,21,33,21,33,17,35,17,53,52,38,35,34,6,21,20,22,51,3,235,254,193,254,
+250,254,223,1,55,216,245,1,24,1,92,254,164,182,176,167,151,186,185,176,2,
+29,239,217,209,1,20,254,226,255,240,160,253,227,2,189,246,180,196,182,144,
+146,150,0,1,0,133,0,0,5,214,5,202,0,21,0,0,1,21,33,17,35,17,52,38,35,34,6,
+21,21,35,53,52,0,51,50,0,21,17,5,214,254,164,182,176,151,148,174,182,1,15,
+233,235,1,18,2,189,160,253,227,3,195,173,188,182,153,66,49,237,1,17,254,246,
+234,254,231,0,0,1,0,205,255,236,5,27,5,182,0,21,0,0,19,51,17,33,21,33,17,
+20,22,51,50,54,53,53,51,21,20,0,35,34,0,17,205,182,3,152,252,104,175,175,
+168,181,182,254,234,253,254,254,234,5,182,254,220,160,254,75,221,214,175,
+165,61,44,244,254,241,1,41,1,20,0,0,2,0,160,255,231,5,15,5,203,0,32,0,47,
+0,0,19,51,21,50,36,55,6,6,35,34,36,53,52,0,51,50,0,21,20,2,7,33,50,22,21,
+21,35,53,52,35,33,21,35,1,54,54,53,52,38,35,34,6,21,20,22,51,50,54,168,175,
+116,1,119,89,58,142,100,197,254,246,1,39,221,236,1,24,211,230,1,28,133,127,
+174,127,253,117,175,3,62,9,10,190,159,149,179,173,152,91,166,1,181,111,225,
+117,42,46,246,194,201,1,6,254,252,208,192,254,184,169,116,124,111,115,100,
+215,3,124,30,70,48,142,171,167,141,133,161,68,0,1,0,220,254,225,4,142,5,182,
+0,17,0,0,1,17,33,21,33,17,33,50,22,21,21,35,53,52,38,35,33,17,1,146,2,231,
+253,25,1,174,177,157,182,87,89,253,180,5,182,254,60,160,253,78,136,151,160,
+126,85,76,5,182,0,1,0,205,0,0,5,7,5,202,0,19,0,0,1,52,38,35,34,6,21,17,33,
+21,33,17,16,0,51,50,0,21,21,35,4,62,181,168,175,175,3,132,251,198,1,22,255,
+252,1,22,182,3,216,165,175,214,221,253,39,160,3,141,1,18,1,43,254,241,244,
+44,0,2,0,205,0,0,6,172,5,203,0,27,0,37,0,0,19,16,0,33,32,0,23,51,21,35,16,
+2,35,34,38,53,52,54,51,51,38,38,35,34,6,21,17,35,1,35,34,6,21,20,22,51,50,
+54,205,1,82,1,60,1,24,1,75,24,214,214,212,194,163,210,231,206,160,15,237,
+204,247,222,182,4,83,149,124,134,98,85,118,106,3,121,1,34,1,48,254,251,236,
+160,254,236,254,220,202,152,167,207,166,173,226,229,252,154,3,58,108,106,
+91,106,183,0,0,2,0,133,255,236,5,240,5,183,0,16,0,27,0,0,18,0,33,33,17,51,
+17,33,21,33,17,20,0,35,34,0,53,37,17,33,34,6,21,20,22,51,50,54,133,1,66,1,
+0,1,73,182,1,42,254,214,254,201,246,233,254,213,3,139,254,183,176,212,189,
+153,175,200,2,199,1,45,1,195,254,61,159,254,180,245,254,216,1,22,223,34,1,
+82,211,161,155,189,203,0,0,1,0,220,0,0,5,30,5,182,0,23,0,0,19,51,17,20,6,
+7,51,54,54,51,50,4,21,21,35,53,52,38,35,34,6,21,17,35,220,182,5,5,12,62,232,
+131,224,1,1,182,165,153,168,240,182,5,182,254,48,13,86,77,94,114,248,224,
+19,21,150,163,228,181,254,48,0,1,0,220,0,0,3,42,5,182,0,5,0,0,19,51,17,33,
+21,33,220,182,1,152,253,178,5,182,250,234,160,0,0,1,0,220,0,0,6,59,5,182,
+0,23,0,0,19,51,17,33,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,53,53,33,
+17,35,220,182,2,19,117,125,125,113,182,233,193,192,226,254,163,182,5,182,
+254,220,254,193,133,129,135,127,1,63,254,193,196,223,227,196,156,252,13,0,
+0,2,0,133,255,236,5,49,5,198,0,26,0,38,0,0,1,20,22,23,23,54,36,51,21,34,4,
+7,4,18,21,20,0,35,32,0,53,52,18,55,38,38,53,1,6,2,21,20,22,51,50,54,53,52,
+2,1,51,99,95,120,167,1,116,158,121,254,224,96,1,18,242,254,170,254,254,250,
+254,196,144,167,184,149,1,247,153,138,216,172,184,222,226,5,182,59,83,34,
+44,113,123,155,82,64,104,254,201,214,238,254,182,1,53,245,174,1,36,138,56,
+149,119,254,129,125,254,253,161,179,218,221,188,181,1,3,0,1,0,184,0,0,4,250,
+5,182,0,23,0,0,1,52,54,55,35,6,6,35,34,36,53,17,51,17,20,22,51,50,54,53,53,
+51,17,35,4,68,5,5,12,64,209,130,222,254,231,182,178,153,166,229,182,182,1,
+208,13,86,77,101,107,251,221,2,46,253,208,151,162,221,168,192,251,110,0,3,
+0,175,255,129,4,142,5,202,0,26,0,27,0,28,0,0,5,52,38,39,37,19,54,0,51,50,
+30,2,23,7,38,35,34,6,7,3,5,22,22,21,21,35,1,5,3,153,58,76,253,156,133,40,
+1,6,204,66,115,92,64,15,118,117,117,142,160,33,111,1,214,134,123,174,253,
+118,2,11,87,54,58,17,126,3,41,243,1,6,33,44,44,10,121,94,179,194,253,100,
+100,27,125,118,40,1,175,126,0,3,0,143,255,236,4,224,5,203,0,38,0,50,0,63,
+0,0,1,6,6,35,34,36,53,52,0,51,50,0,21,20,2,7,23,22,22,23,21,39,39,38,39,6,
+6,35,34,38,53,52,54,51,50,22,23,54,54,3,38,38,35,34,6,21,20,22,51,50,54,1,
+53,52,38,35,34,6,21,20,22,51,50,54,3,219,66,190,112,192,254,231,1,40,220,
+246,1,30,91,97,70,23,134,15,138,161,23,15,97,212,127,155,177,204,153,85,176,
+103,45,61,201,84,128,57,75,95,88,67,81,139,1,48,194,161,140,184,176,145,96,
+196,2,225,48,59,234,176,187,1,0,254,220,245,151,254,192,151,41,13,77,12,181,
+80,92,12,9,107,106,147,127,112,156,54,54,66,163,254,149,45,47,67,55,58,63,
+82,2,204,38,163,200,157,131,119,143,85,0,1,0,130,0,0,5,211,5,202,0,19,0,0,
+37,21,33,17,52,38,35,34,6,21,21,35,53,52,0,51,50,0,21,17,5,211,253,238,176,
+151,148,174,182,1,15,233,235,1,18,160,160,3,195,173,188,182,153,66,49,237,
+1,17,254,246,234,252,202,0,0,2,0,140,0,0,4,252,5,198,0,10,0,33,0,0,37,16,
+2,38,39,6,2,21,20,22,51,19,54,36,51,21,34,7,30,2,18,17,33,34,38,53,52,18,
+55,38,39,53,22,4,70,72,168,170,160,194,126,140,33,139,1,61,190,252,211,140,
+178,102,44,253,89,228,229,205,169,169,197,206,160,1,86,1,87,190,55,184,254,
+93,136,98,93,4,83,97,114,155,120,46,157,246,254,122,254,148,164,157,163,1,
+195,196,32,21,155,21,0,1,0,205,255,236,6,81,5,182,0,19,0,0,1,16,0,35,34,0,
+17,17,51,17,20,22,51,50,54,53,17,33,21,33,4,245,254,234,254,254,254,234,182,
+175,175,173,177,2,18,254,164,2,41,254,236,254,215,1,41,1,20,3,141,252,135,
+221,214,214,222,3,120,160,0,1,0,130,255,236,4,197,5,203,0,41,0,0,1,21,22,
+22,21,20,4,35,34,38,39,53,22,22,51,50,54,53,52,38,35,33,53,33,50,54,53,52,
+38,35,34,6,7,39,54,54,51,50,4,21,20,6,3,109,161,183,254,181,247,125,230,78,
+89,231,113,187,201,213,206,254,30,1,216,183,203,158,122,98,177,95,92,98,248,
+117,201,1,12,162,3,0,8,22,189,140,200,229,39,40,176,44,53,147,125,133,127,
+160,146,130,93,126,65,58,131,71,79,209,168,123,183,0,0,1,0,124,255,238,4,
+162,6,20,0,30,0,0,18,18,55,46,2,53,51,20,22,22,51,23,2,2,21,20,22,51,50,54,
+53,17,51,17,20,0,35,34,0,53,171,109,88,94,105,45,184,45,101,146,18,145,112,
+165,149,160,168,183,254,231,229,225,254,232,2,141,1,103,154,7,80,146,157,
+144,77,24,30,254,248,254,146,149,170,193,169,181,1,105,254,127,223,254,252,
+1,29,235,0,1,0,141,255,238,4,173,5,182,0,25,0,0,19,5,7,37,6,2,21,20,22,51,
+50,54,53,53,51,21,20,0,35,34,0,53,52,18,55,37,170,4,3,30,254,130,252,201,
+179,160,160,177,182,254,224,231,230,254,213,225,210,254,76,5,182,190,170,
+73,167,254,191,185,181,182,171,179,114,138,221,254,250,1,30,238,207,1,111,
+139,81,0,0,1,0,205,0,0,4,245,5,202,0,17,0,0,19,16,0,51,50,0,17,17,35,17,52,
+38,35,34,6,21,17,35,205,1,22,255,253,1,22,182,177,173,175,175,182,3,141,1,
+18,1,43,254,215,254,236,252,115,3,120,222,214,214,221,252,135,0,0,1,0,133,
+255,254,4,189,5,201,0,34,0,0,5,38,36,36,39,55,22,22,23,62,2,53,52,38,35,34,
+6,21,21,35,53,52,36,51,32,4,21,20,6,6,7,22,22,23,4,103,92,254,251,254,123,
+252,114,77,173,105,192,154,83,177,179,165,182,182,1,34,241,1,7,1,17,95,166,
+204,93,202,84,2,6,66,196,218,120,69,131,61,168,178,179,100,179,176,155,145,
+45,47,204,252,253,249,129,216,198,171,44,58,10,0,0,1,0,160,0,0,5,175,5,203,
+0,20,0,0,1,52,38,39,17,35,17,6,6,21,21,35,53,16,0,33,32,0,17,17,35,4,249,
+190,184,182,186,189,182,1,98,1,51,1,43,1,79,182,3,84,218,236,19,252,47,3,
+209,19,239,215,188,182,1,36,1,89,254,176,254,211,252,178,0,2,0,150,255,231,
+4,214,5,204,0,32,0,46,0,0,1,50,54,55,52,46,2,53,52,0,51,50,0,21,20,2,7,51,
+50,22,21,21,35,53,52,38,35,33,21,35,17,51,5,54,18,53,52,38,35,34,6,21,20,
+30,2,1,90,68,101,28,95,192,106,1,51,226,237,1,18,226,212,202,141,139,194,
+57,70,253,197,175,175,1,71,159,175,175,157,151,187,93,160,83,1,70,17,14,74,
+113,148,184,129,202,1,21,254,237,224,162,254,166,151,116,124,111,105,50,60,
+215,1,206,11,128,1,19,156,160,181,169,152,95,149,137,124,0,0,1,0,205,0,0,
+6,81,5,202,0,21,0,0,33,35,17,52,38,35,34,6,21,17,35,17,16,0,51,50,0,17,21,
+33,21,33,4,245,182,177,173,175,175,182,1,22,255,253,1,22,1,92,254,164,3,120,
+222,214,214,221,252,135,3,141,1,18,1,43,254,215,254,236,117,160,0,1,0,205,
+255,236,4,245,5,182,0,17,0,0,19,51,17,20,22,51,50,54,53,17,51,17,16,0,35,
+34,0,17,205,182,175,175,173,177,182,254,234,254,254,254,234,5,182,252,135,
+221,214,214,222,3,120,252,115,254,236,254,215,1,41,1,20,0,0,1,0,160,0,0,6,
+62,5,182,0,24,0,0,1,55,35,6,6,35,34,38,38,53,53,51,21,20,22,51,50,54,53,17,
+51,17,33,21,33,4,44,10,12,62,210,131,147,231,125,182,177,154,167,228,182,
+1,92,253,238,1,92,176,99,109,114,213,145,191,193,151,162,220,169,2,88,250,
+234,160,0,1,0,134,255,236,4,65,5,203,0,36,0,0,4,38,39,53,22,22,51,50,54,53,
+52,38,36,38,53,52,36,51,50,22,23,7,38,38,35,34,6,21,20,22,4,22,22,21,20,4,
+35,1,179,197,103,122,200,111,152,179,169,254,95,179,1,26,194,118,202,94,57,
+94,170,97,122,160,131,1,83,194,101,254,217,221,20,40,47,176,60,46,132,103,
+111,133,168,187,137,167,208,40,42,152,39,36,123,92,81,112,135,119,160,110,
+184,228,0,1,0,205,0,0,4,194,5,202,0,17,0,0,19,52,0,51,50,0,21,21,35,53,52,
+38,35,34,6,21,17,35,205,1,17,236,232,1,16,182,174,148,151,176,182,3,214,234,
+1,10,254,240,238,49,66,153,182,188,173,252,61,0,0,2,0,146,255,236,4,237,5,
+203,0,35,0,47,0,0,55,53,22,22,51,50,54,53,52,38,39,5,39,55,53,38,38,53,52,
+36,51,50,4,21,20,6,7,21,22,22,21,20,4,33,34,38,1,54,54,53,52,38,35,34,6,21,
+20,22,189,100,237,127,194,227,197,195,254,49,42,249,136,144,1,44,228,225,
+1,46,144,136,173,167,254,178,254,250,157,224,1,142,175,159,186,156,157,186,
+164,59,175,48,49,152,117,111,161,44,130,140,69,10,48,158,106,166,194,191,
+169,106,158,48,10,62,192,124,197,246,36,3,88,40,126,85,97,113,114,96,81,127,
+0,1,0,220,0,0,4,128,5,182,0,20,0,0,19,51,17,51,50,30,3,51,51,21,35,34,38,
+2,38,35,35,17,35,220,182,87,115,130,98,127,74,77,42,75,123,138,144,103,112,
+55,182,5,182,254,148,59,123,253,85,160,124,1,43,97,252,86,0,3,0,124,255,236,
+6,25,5,203,0,21,0,30,0,39,0,0,37,35,32,0,53,52,0,51,51,53,51,21,51,50,0,21,
+20,0,33,35,21,35,17,17,35,34,6,21,20,22,51,51,50,54,53,52,38,35,35,17,2,239,
+43,254,255,254,185,1,58,248,65,182,68,252,1,52,254,190,254,245,39,182,55,
+176,209,226,192,229,190,226,210,175,56,205,1,52,245,237,1,52,180,180,254,
+209,242,249,254,208,225,1,120,3,23,213,174,188,216,218,186,176,211,252,233,
+0,0,2,0,60,0,0,4,170,5,203,0,20,0,31,0,0,1,35,53,51,17,16,0,51,50,22,21,20,
+4,33,35,21,33,21,33,17,35,1,50,54,53,52,38,35,34,6,21,21,1,1,197,197,1,2,
+231,206,242,254,225,254,231,187,2,242,253,14,182,1,112,205,177,139,122,148,
+159,1,102,160,1,162,1,5,1,30,214,184,198,211,158,160,254,154,3,63,118,136,
+111,130,190,186,119,0,0,2,0,145,255,236,5,195,5,205,0,11,0,23,0,0,4,0,17,
+16,0,33,32,0,17,16,0,33,54,18,17,16,2,35,34,2,17,16,18,51,1,243,254,158,1,
+96,1,60,1,58,1,92,254,163,254,199,227,245,245,227,228,250,249,229,20,1,147,
+1,94,1,93,1,147,254,112,254,160,254,160,254,111,157,1,51,1,33,1,35,1,47,254,
+204,254,226,254,225,254,203,0,3,0,130,255,236,5,136,5,182,0,21,0,28,0,35,
+0,0,4,36,39,53,22,22,23,17,38,38,53,52,36,51,51,17,4,4,21,20,0,33,19,17,54,
+54,53,52,38,37,17,34,6,21,20,22,2,33,254,240,143,125,248,115,237,219,1,5,
+197,180,1,78,1,26,254,145,254,198,65,188,238,185,254,89,124,142,122,20,45,
+54,167,45,59,5,2,70,42,184,162,158,197,253,165,37,192,180,213,254,255,2,207,
+253,206,4,165,133,109,118,221,1,160,113,86,85,110,0,0,1,0,44,3,120,1,81,6,
+20,0,13,0,0,1,38,38,53,52,54,55,23,6,6,21,20,22,51,1,75,130,157,106,132,55,
+57,76,74,53,3,120,2,175,130,114,171,76,82,32,122,88,70,89,0,0,1,0,95,3,120,
+1,132,6,20,0,13,0,0,19,54,54,53,52,38,35,53,22,22,21,20,6,7,95,57,76,73,54,
+130,157,107,131,3,202,32,122,88,70,89,185,2,175,130,115,171,75,0,0,1,0,120,
+4,211,1,154,6,132,0,10,0,0,19,55,55,54,54,55,51,23,6,6,7,120,10,34,14,22,
+5,187,18,26,71,46,4,211,43,166,66,116,42,30,93,193,117,0,0,1,0,120,4,211,
+2,32,6,132,0,12,0,0,19,52,62,2,53,53,51,20,6,6,21,21,120,33,94,111,186,73,
+188,4,211,63,119,79,62,64,46,114,107,114,73,25,0,1,0,120,4,211,1,154,6,132,
+0,9,0,0,1,38,38,39,55,51,22,22,23,23,1,7,46,71,26,18,187,5,22,14,44,4,211,
+117,193,93,30,42,116,66,209,0,0,1,0,120,4,238,3,36,6,162,0,19,0,0,19,52,54,
+51,50,22,21,20,6,35,53,50,54,53,52,38,35,34,6,21,120,233,183,121,147,171,
+142,54,68,46,49,97,124,4,238,187,249,114,92,103,110,138,33,32,31,43,151,143,
+0,1,0,90,4,211,3,38,6,170,0,18,0,0,1,38,35,34,6,21,20,22,51,33,21,33,32,53,
+52,54,51,50,23,1,231,69,44,60,56,64,58,1,170,254,68,254,240,156,120,71,93,
+5,250,29,47,35,55,39,148,240,107,124,32,0,0,1,0,182,255,237,6,214,3,242,0,
+36,0,0,1,20,22,51,50,54,53,17,51,17,20,22,51,50,54,53,17,51,17,35,39,35,6,
+6,35,34,38,39,35,6,6,35,34,38,53,17,51,1,102,123,116,151,130,176,123,116,
+151,130,176,143,25,10,44,170,104,135,176,33,10,49,186,123,164,196,176,1,131,
+128,131,189,186,1,251,253,145,128,131,189,186,1,251,252,14,138,73,84,100,
+93,93,100,191,168,2,158,0,1,0,194,253,222,4,76,4,5,0,24,0,0,1,52,38,35,34,
+6,21,17,33,21,33,17,35,17,51,23,51,54,54,51,50,22,21,17,35,3,122,123,116,
+151,130,2,218,253,38,176,143,25,10,48,174,112,163,197,176,2,111,128,131,189,
+186,254,148,143,253,222,6,20,138,75,82,191,168,254,219,0,0,2,0,133,253,222,
+5,13,4,5,0,24,0,36,0,0,37,51,21,35,17,35,17,52,54,55,35,6,6,35,34,2,53,52,
+18,51,50,23,51,55,51,2,38,35,34,6,21,20,22,51,50,54,53,4,26,243,243,175,6,
+5,12,48,168,103,198,224,224,203,208,106,8,25,143,175,145,147,129,139,135,
+136,155,134,143,143,253,222,2,33,41,70,31,78,81,1,31,234,243,1,27,157,138,
+254,197,185,196,184,181,189,182,189,0,1,0,194,253,222,5,29,4,5,0,24,0,0,19,
+51,23,51,54,54,51,50,22,21,17,51,21,35,17,35,17,52,38,35,34,6,21,17,35,194,
+143,25,10,48,174,112,163,197,243,243,176,123,116,151,130,176,3,242,138,75,
+82,191,168,253,241,143,253,222,4,145,128,131,189,186,254,5,0,1,0,182,255,
+237,4,57,6,20,0,24,0,0,1,51,17,35,39,35,6,6,35,34,38,53,17,51,17,33,21,33,
+17,20,22,51,50,54,53,3,110,176,143,25,10,48,174,112,164,196,176,2,211,253,
+45,123,116,151,130,2,121,253,135,138,75,82,191,168,4,192,253,222,143,254,
+32,128,131,189,186,0,0,2,0,133,253,222,5,13,4,5,0,22,0,34,0,0,5,52,54,55,
+35,6,6,35,34,2,53,52,18,51,50,23,51,55,51,17,51,21,33,16,38,35,34,6,21,20,
+22,51,50,54,53,3,107,6,5,12,48,168,103,198,224,224,203,208,106,8,25,143,243,
+254,94,145,147,129,139,135,136,155,134,1,41,70,31,78,81,1,31,234,243,1,27,
+157,138,250,123,143,4,217,185,196,184,181,189,182,189,0,0,1,0,194,255,92,
+3,135,6,20,0,15,0,0,5,52,38,35,33,17,51,17,33,21,33,17,51,50,22,21,2,207,
+75,105,254,167,176,2,21,253,235,238,153,133,164,98,66,6,20,253,222,143,253,
+44,137,170,0,1,0,194,253,222,4,46,4,5,0,22,0,0,19,51,23,51,54,54,51,50,22,
+21,17,35,17,52,38,35,34,6,21,17,33,21,33,194,143,25,10,48,174,112,163,197,
+176,123,116,151,130,2,188,252,148,3,242,138,75,82,191,168,253,98,2,111,128,
+131,189,186,252,114,143,0,0,2,0,194,253,222,5,106,4,5,0,38,0,52,0,0,1,17,
+35,17,51,23,51,54,54,51,50,0,23,22,22,23,7,39,38,39,6,6,35,34,38,53,52,54,
+51,50,23,23,22,51,38,38,35,34,6,1,53,39,38,38,35,34,6,21,20,22,51,50,54,1,
+114,176,143,25,10,46,176,126,204,1,19,19,42,83,43,45,60,32,29,12,171,148,
+132,166,175,137,12,19,73,15,6,20,186,126,175,151,2,156,67,18,34,12,69,82,
+77,56,78,71,2,21,251,201,6,20,138,75,82,254,244,230,14,32,16,116,23,11,9,
+203,221,168,135,138,164,1,7,2,145,168,163,254,189,36,8,2,2,91,91,70,89,148,
+0,2,0,133,255,238,4,223,6,20,0,21,0,37,0,0,18,0,51,50,22,23,23,22,23,17,51,
+17,23,7,39,17,20,2,35,34,2,53,37,17,38,39,39,38,38,35,34,6,21,20,22,51,50,
+54,133,1,13,230,39,79,32,37,18,17,176,217,30,187,233,207,202,255,2,209,16,
+16,33,29,74,38,157,176,147,134,133,125,2,245,1,16,11,6,8,4,5,2,49,253,162,
+51,132,47,254,205,236,254,223,1,36,229,4,1,90,4,3,6,5,9,190,190,178,191,180,
+0,0,1,0,193,253,222,4,41,6,20,0,23,0,0,1,54,54,51,50,22,21,17,35,17,52,38,
+35,34,6,21,17,35,17,51,17,20,6,7,1,113,48,176,112,163,197,176,123,116,151,
+130,176,175,6,5,3,102,75,84,191,168,253,98,2,111,128,131,189,186,251,227,
+8,54,253,224,42,69,31,0,0,1,0,194,253,222,2,101,3,242,0,5,0,0,19,51,17,51,
+21,33,194,176,243,254,93,3,242,250,123,143,0,1,0,194,253,222,6,135,6,20,0,
+41,0,0,1,53,52,38,35,34,6,21,17,35,17,51,17,20,6,7,51,54,54,51,50,22,21,3,
+20,22,51,50,54,53,17,51,17,35,39,35,6,6,35,34,38,53,3,39,96,90,131,121,175,
+175,6,5,12,45,157,90,149,167,3,123,116,151,130,176,143,25,10,48,174,112,164,
+196,2,99,35,117,119,175,192,251,219,8,54,253,224,42,69,31,78,81,178,158,254,
+206,128,131,189,186,1,251,252,14,138,75,82,191,168,0,0,2,0,133,255,238,4,
+152,6,20,0,30,0,43,0,0,18,54,54,51,51,39,39,38,38,39,55,23,7,23,23,22,31,
+2,33,21,35,22,22,21,20,0,35,34,0,53,36,38,39,35,34,6,21,20,22,51,50,54,53,
+133,138,242,121,26,124,45,16,62,28,233,96,114,93,40,21,22,43,39,1,62,229,
+70,50,254,254,203,212,254,251,2,240,78,52,71,158,211,160,132,129,149,2,121,
+239,138,158,55,19,76,32,206,109,101,119,54,28,28,55,52,143,125,182,83,219,
+254,236,1,21,222,101,216,69,204,184,161,187,184,158,0,0,1,0,182,253,222,4,
+29,6,20,0,23,0,0,19,51,17,20,22,51,50,54,53,17,51,17,35,17,52,54,55,35,6,
+6,35,34,38,53,182,176,123,116,151,130,175,175,6,5,12,48,175,112,164,196,6,
+20,251,111,128,131,189,186,1,251,249,236,2,32,42,69,31,77,82,191,168,0,0,
+1,0,130,0,0,4,24,6,30,0,31,0,0,1,17,35,17,52,38,35,34,6,7,39,53,16,18,0,51,
+50,22,23,7,38,38,35,34,2,17,51,54,54,51,50,22,3,251,176,123,116,99,150,34,
+191,159,1,23,181,90,158,51,118,39,98,54,178,250,12,52,163,121,161,199,1,124,
+254,132,1,77,128,131,105,114,44,56,1,29,2,15,1,25,69,55,113,42,48,253,236,
+254,205,74,85,190,0,2,0,120,255,237,4,154,6,20,0,34,0,44,0,0,18,54,0,54,53,
+52,38,36,38,53,51,20,22,22,23,23,22,22,21,20,6,7,7,19,51,21,35,39,35,6,6,
+35,34,38,53,1,4,6,21,20,22,51,50,54,55,120,179,1,170,157,193,254,197,149,
+158,45,116,150,195,101,88,63,55,120,215,123,233,35,10,46,189,101,194,250,
+2,78,254,250,146,147,123,97,166,24,1,247,245,1,47,104,29,38,23,51,120,140,
+61,50,37,24,31,16,64,42,50,75,40,89,252,190,143,138,71,86,216,179,1,249,198,
+200,105,117,135,91,45,0,0,1,0,194,253,222,5,29,4,5,0,22,0,0,19,51,23,51,54,
+54,51,50,22,21,17,51,21,33,17,52,38,35,34,6,21,17,35,194,143,25,10,48,174,
+112,163,197,243,254,93,123,116,151,130,176,3,242,138,75,82,191,168,251,207,
+143,4,145,128,131,189,186,254,5,0,2,0,82,255,237,4,53,6,30,0,31,0,43,0,0,
+18,54,55,39,53,23,18,0,51,50,22,23,7,38,38,35,34,6,7,4,0,21,17,35,39,35,6,
+6,35,34,2,53,36,36,39,6,6,21,20,22,51,50,54,53,155,20,26,119,161,86,1,19,
+174,90,158,51,118,39,98,54,103,188,60,1,57,1,84,144,25,10,44,165,89,189,249,
+2,227,254,240,242,22,21,153,137,122,145,2,60,198,111,7,142,8,1,3,1,29,69,
+55,113,42,48,218,192,5,254,198,252,254,74,138,73,84,1,17,237,141,232,4,97,
+175,93,186,191,161,126,0,1,0,182,255,237,4,144,6,30,0,43,0,0,1,52,38,38,53,
+52,54,51,50,22,21,35,52,38,35,34,6,21,20,22,23,23,22,22,21,17,35,39,35,6,
+6,35,34,38,53,17,51,17,20,22,51,50,54,53,3,110,74,202,155,122,140,149,167,
+55,68,46,56,41,31,67,63,76,143,25,10,48,174,112,164,196,176,123,116,151,130,
+2,222,104,170,206,103,115,134,152,133,66,81,60,51,34,61,32,70,67,163,100,
+252,234,138,75,82,191,168,2,158,253,145,128,131,189,186,0,0,1,0,90,253,222,
+1,190,3,242,0,20,0,0,19,51,50,54,53,52,39,39,38,38,53,17,51,17,20,22,21,20,
+6,35,35,90,14,85,88,13,28,17,25,168,84,189,137,30,254,103,108,91,48,41,89,
+52,121,80,3,21,252,227,141,194,76,147,201,0,0,1,0,127,255,237,4,25,6,18,0,
+37,0,0,18,18,55,38,38,53,52,54,55,23,7,6,21,20,22,23,23,6,2,21,20,22,51,50,
+54,53,17,51,17,35,39,35,6,6,35,34,38,53,151,125,101,168,82,56,45,142,47,21,
+192,77,8,111,135,140,124,137,139,176,143,25,10,41,168,89,190,232,2,68,1,58,
+148,92,87,58,51,136,88,71,98,45,35,50,104,44,24,176,254,176,117,151,177,188,
+179,2,5,252,14,138,70,87,253,218,0,1,0,52,253,222,3,64,4,5,0,31,0,0,19,39,
+54,51,50,22,21,20,2,7,7,6,6,21,20,22,51,33,21,33,34,38,53,52,0,18,53,52,38,
+35,34,6,116,41,165,172,189,231,161,181,86,68,62,34,35,1,221,253,116,51,65,
+1,160,182,132,108,81,144,3,45,142,74,199,171,145,254,197,238,112,87,99,24,
+21,27,137,50,49,81,2,12,1,84,157,106,123,41,0,1,0,194,0,0,4,42,4,5,0,20,0,
+0,19,51,23,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,35,194,143,25,
+10,48,174,112,163,197,176,123,116,151,130,176,3,242,138,75,82,191,168,253,
+98,2,111,128,131,189,186,254,5,0,0,1,255,182,253,222,2,116,3,242,0,31,0,0,
+1,46,2,53,52,54,55,51,6,6,21,20,22,22,23,6,2,2,21,20,51,33,21,33,34,53,52,
+62,2,0,1,161,161,96,41,34,24,149,15,17,26,56,252,105,208,167,69,1,155,253,
+182,116,12,28,55,1,70,2,17,111,88,88,53,39,78,24,27,63,19,30,59,54,180,180,
+254,125,254,166,36,38,137,89,15,41,66,111,2,123,0,1,0,182,253,222,6,213,3,
+242,0,39,0,0,37,6,6,35,34,38,39,35,6,6,35,34,38,53,17,51,17,20,22,51,50,54,
+53,17,51,17,20,22,51,50,54,53,17,51,17,35,17,52,54,55,6,37,43,168,108,135,
+176,33,10,49,186,123,164,196,176,123,116,151,130,176,123,116,151,130,175,
+175,6,5,140,73,86,100,93,93,100,191,168,2,158,253,145,128,131,189,186,1,251,
+253,145,128,131,189,186,1,251,249,236,2,32,42,69,31,0,2,0,131,253,222,4,42,
+4,5,0,30,0,42,0,0,37,38,38,39,39,38,38,53,52,36,51,50,22,21,20,6,0,6,21,20,
+22,51,33,21,33,34,38,53,52,54,54,2,6,21,20,4,23,54,54,53,52,38,35,2,40,23,
+80,46,95,83,94,1,25,204,196,254,147,254,136,181,34,35,2,76,253,5,51,65,162,
+215,35,169,1,44,36,109,126,147,123,95,44,69,34,69,60,157,105,169,227,220,
+174,124,228,254,140,235,37,21,27,137,50,49,78,218,209,3,56,138,111,162,181,
+90,126,215,94,113,134,0,0,1,0,194,0,0,4,226,4,5,0,28,0,0,19,51,23,51,54,54,
+51,50,22,21,20,6,7,21,33,21,33,53,54,54,53,52,38,35,34,6,21,17,35,194,143,
+25,10,46,171,105,189,232,58,126,1,63,254,14,113,74,148,125,152,144,176,3,
+242,138,74,83,216,176,86,191,207,10,143,117,205,216,82,121,141,170,199,253,
+255,0,0,1,0,182,255,237,4,30,3,242,0,20,0,0,33,35,39,35,6,6,35,34,38,53,17,
+51,17,20,22,51,50,54,53,17,51,4,30,143,25,10,48,174,112,164,196,176,123,116,
+151,130,176,138,75,82,191,168,2,158,253,145,128,131,189,186,1,251,0,1,0,182,
+253,222,5,16,6,20,0,25,0,0,1,17,51,21,33,17,52,54,55,35,6,6,35,34,38,53,17,
+51,17,20,22,51,50,54,53,17,4,29,243,254,94,6,5,12,48,175,112,164,196,176,
+123,116,151,130,6,20,248,89,143,2,32,42,69,31,77,82,191,168,2,158,253,145,
+128,131,189,186,4,29,0,1,0,182,255,237,6,214,4,5,0,37,0,0,33,39,35,6,6,35,
+34,38,53,17,51,17,20,22,51,50,54,53,17,51,23,51,54,54,51,50,22,21,17,35,17,
+52,38,35,34,6,21,17,3,143,25,10,48,174,112,164,196,176,123,116,151,130,143,
+25,10,48,174,112,163,197,176,123,116,151,130,138,75,82,191,168,2,158,253,
+145,128,131,189,186,1,251,138,75,82,191,168,253,98,2,111,128,131,189,186,
+254,5,0,0,1,0,194,253,222,4,42,4,5,0,20,0,0,19,51,23,51,54,54,51,50,22,21,
+17,35,17,52,38,35,34,6,21,17,35,194,143,25,10,48,174,112,163,197,176,123,
+116,151,130,176,3,242,138,75,82,191,168,253,98,2,111,128,131,189,186,251,
+227,0,0,2,0,133,253,213,4,26,4,5,0,31,0,43,0,0,5,20,6,35,34,38,39,53,22,22,
+51,50,54,53,52,54,55,35,6,6,35,34,2,53,52,18,51,50,23,51,55,51,2,38,35,34,
+6,21,20,22,51,50,54,53,4,26,252,238,97,185,72,75,188,100,145,161,4,7,12,48,
+168,103,198,224,224,203,208,106,8,25,143,175,145,147,129,139,134,137,155,
+134,65,240,250,33,32,162,40,39,169,160,102,82,35,78,81,1,31,234,243,1,27,
+157,138,254,197,185,196,184,182,188,182,189,0,1,0,194,0,0,2,100,3,242,0,5,
+0,0,19,51,17,51,21,33,194,175,243,254,94,3,242,252,151,137,0,1,0,182,253,
+222,6,214,6,20,0,43,0,0,37,6,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,
+51,17,20,6,7,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,54,
+55,3,109,48,175,112,164,196,176,123,116,151,130,175,6,5,12,48,176,112,163,
+197,176,123,116,151,130,176,6,5,140,77,82,191,168,2,158,253,145,128,131,189,
+186,4,29,253,224,42,69,31,75,84,191,168,253,98,2,111,128,131,189,186,251,
+227,2,32,42,69,31,0,2,0,48,253,222,4,87,4,5,0,28,0,40,0,0,19,35,53,51,17,
+51,23,51,54,51,50,18,21,20,2,35,34,38,39,35,22,22,21,21,33,21,33,17,35,0,
+38,35,34,6,21,20,22,51,50,54,53,194,146,146,143,25,8,106,208,203,224,224,
+198,103,168,48,12,5,6,2,175,253,81,175,2,223,139,129,147,145,134,155,136,
+135,254,241,143,4,114,138,157,254,229,243,234,254,225,81,78,31,70,41,127,
+143,254,237,4,206,196,185,194,189,182,189,181,0,0,2,0,133,255,238,4,63,4,
+5,0,11,0,22,0,0,4,0,53,52,0,51,50,18,21,20,0,35,54,54,53,52,38,35,32,17,20,
+22,51,1,133,255,0,1,0,223,221,254,254,248,217,154,145,147,150,254,219,145,
+150,18,1,35,234,234,1,32,254,226,236,234,254,221,149,192,184,182,191,254,
+139,184,192,0,0,3,0,109,254,20,4,208,5,192,0,26,0,33,0,40,0,0,5,38,36,39,
+53,22,22,23,17,38,38,53,52,36,51,50,22,23,17,4,22,21,20,4,7,17,35,17,34,6,
+21,20,22,23,19,54,54,53,52,38,39,2,50,117,254,240,64,81,248,124,216,215,1,
+29,208,20,63,30,1,31,208,254,220,203,175,108,138,116,130,175,144,169,155,
+158,14,5,65,37,152,39,62,9,2,68,57,192,147,157,204,5,5,253,132,82,200,150,
+176,225,7,254,34,7,23,118,95,83,113,40,253,29,9,136,108,106,133,40,0,1,0,
+182,255,237,5,17,6,20,0,22,0,0,1,17,20,22,51,50,54,53,17,51,17,51,21,33,39,
+35,6,6,35,34,38,53,17,1,102,123,116,151,130,176,243,254,126,25,10,48,174,
+112,164,196,6,20,251,111,128,131,189,186,1,251,252,151,137,138,75,82,191,
+168,4,192,0,2,0,157,255,227,1,137,4,21,0,11,0,23,0,0,36,22,21,20,6,35,34,
+38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,74,63,63,57,55,61,59,
+57,60,60,63,57,56,60,58,58,227,65,61,61,69,67,63,61,65,3,50,66,63,60,68,68,
+60,63,66,0,1,0,112,1,150,3,45,2,180,0,12,0,0,19,51,20,22,51,50,55,23,6,6,
+35,34,38,112,185,78,81,140,180,37,91,200,102,160,148,2,180,60,75,39,84,54,
+52,139,0,1,0,182,255,237,8,228,6,20,0,76,0,0,1,52,38,38,53,52,54,51,33,23,
+6,6,21,20,22,23,23,6,2,21,20,22,51,50,54,53,17,51,17,35,39,35,6,6,35,34,38,
+53,52,18,55,38,38,53,52,54,55,33,34,6,21,20,22,23,23,22,22,21,17,35,39,35,
+6,6,35,34,38,53,17,51,17,20,22,51,50,54,53,3,110,74,202,149,128,2,64,139,
+26,39,192,77,8,113,133,140,124,137,139,176,143,25,10,41,168,89,190,232,112,
+114,168,82,19,17,254,0,46,56,41,31,67,63,76,143,25,10,48,174,112,164,196,
+176,123,116,151,130,2,222,104,170,206,103,112,127,70,54,92,35,50,104,44,24,
+180,254,179,116,151,177,188,179,2,5,252,14,138,70,87,253,218,116,1,46,172,
+92,87,58,29,68,42,50,51,34,61,32,70,67,163,100,252,234,138,75,82,191,168,
+2,158,253,145,128,131,189,186,0,0,1,0,182,255,237,9,50,6,20,0,62,0,0,1,34,
+6,21,20,22,23,23,22,22,21,17,35,39,35,6,6,35,34,38,53,17,51,17,20,22,51,50,
+54,53,53,52,38,38,53,52,54,51,33,17,33,21,33,17,20,22,51,50,54,53,53,51,17,
+35,39,35,6,6,35,34,38,53,17,3,110,46,56,41,31,67,63,76,143,25,10,48,174,112,
+164,196,176,123,116,151,130,74,202,149,128,2,240,2,211,253,45,123,116,151,
+130,176,143,25,10,48,174,112,164,196,5,138,50,51,34,61,32,70,67,163,100,252,
+234,138,75,82,191,168,2,158,253,145,128,131,189,186,231,104,170,206,103,112,
+127,253,222,143,254,32,128,131,189,186,130,253,135,138,75,82,191,168,4,54,
+0,1,0,182,253,222,9,24,6,20,0,61,0,0,1,34,6,21,20,22,23,23,22,22,21,17,35,
+39,35,6,6,35,34,38,53,17,51,17,20,22,51,50,54,53,53,52,38,38,53,52,54,51,
+33,17,20,6,7,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,3,110,
+46,56,41,31,67,63,76,143,25,10,48,174,112,164,196,176,123,116,151,130,74,
+202,149,128,2,240,6,5,12,48,176,112,163,197,176,123,116,151,130,176,5,138,
+50,51,34,61,32,70,67,163,100,252,234,138,75,82,191,168,2,158,253,145,128,
+131,189,186,231,104,170,206,103,112,127,253,224,42,69,31,75,84,191,168,253,
+98,2,111,128,131,189,186,251,227,7,172,0,1,0,182,253,222,9,26,6,20,0,64,0,
+0,1,51,21,33,17,52,54,55,35,6,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,
+33,23,6,6,21,20,22,23,23,6,2,21,20,22,51,50,54,53,17,51,17,35,39,35,6,6,35,
+34,38,53,52,18,55,38,38,53,52,54,55,33,4,29,243,254,94,6,5,12,48,175,112,
+164,196,176,123,116,151,130,2,119,139,26,39,192,77,8,113,133,140,124,137,
+139,176,143,25,10,41,168,89,190,232,112,114,168,82,19,17,254,121,254,109,
+143,2,32,42,69,31,77,82,191,168,2,158,253,145,128,131,189,186,4,29,70,54,
+92,35,50,104,44,24,180,254,179,116,151,177,188,179,2,5,252,14,138,70,87,253,
+218,116,1,46,172,92,87,58,29,68,42,0,0,1,0,182,253,222,11,119,6,20,0,79,0,
+0,1,34,6,21,20,22,23,23,22,22,21,17,35,39,35,6,6,35,34,38,53,17,51,17,20,
+22,51,50,54,53,53,52,38,38,53,52,54,51,33,17,20,6,7,51,54,54,51,50,22,21,
+3,20,22,51,50,54,53,17,51,17,35,39,35,6,6,35,34,38,53,19,53,52,38,35,34,6,
+21,17,35,17,3,110,46,56,41,31,67,63,76,143,25,10,48,174,112,164,196,176,123,
+116,151,130,74,202,149,128,2,242,6,5,12,45,157,90,149,167,3,123,116,151,130,
+176,143,25,10,48,174,112,164,196,8,96,90,131,121,175,5,138,50,51,34,61,32,
+70,67,163,100,252,234,138,75,82,191,168,2,158,253,145,128,131,189,186,231,
+104,170,206,103,112,127,253,224,42,69,31,78,81,178,158,254,206,128,131,189,
+186,1,251,252,14,138,75,82,191,168,1,15,35,117,119,175,192,251,219,7,172,
+0,1,0,133,0,0,5,186,5,96,0,31,0,0,1,38,38,35,34,6,21,21,35,53,52,0,51,50,
+0,19,33,21,33,21,33,21,33,17,35,17,33,53,33,53,33,53,3,245,9,173,167,168,
+181,182,1,22,252,249,1,21,6,1,15,254,241,1,15,254,241,182,254,241,1,15,254,
+241,3,58,199,193,175,165,61,44,244,1,15,254,226,254,248,150,145,150,254,131,
+1,125,150,145,150,0,255,255,0,205,0,0,10,47,5,202,0,34,0,27,0,0,0,3,0,37,
+5,175,0,0,255,255,0,194,0,0,7,87,4,5,0,34,0,72,0,0,0,3,0,82,4,243,0,0,0,0,
+0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,
+4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,
+3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,32,0,248,0,3,0,1,4,9,0,7,0,68,
+1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,
+0,96,1,174,0,3,0,1,4,9,0,11,0,62,2,14,0,3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,
+4,9,0,13,2,150,2,136,0,3,0,1,4,9,0,14,0,52,5,30,0,67,0,111,0,112,0,121,0,
+114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,52,0,32,0,71,0,111,0,111,
+0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,
+82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,
+0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,
+65,0,114,0,109,0,101,0,110,0,105,0,97,0,110,0,82,0,101,0,103,0,117,0,108,
+0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,
+0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,
+83,0,97,0,110,0,115,0,32,0,65,0,114,0,109,0,101,0,110,0,105,0,97,0,110,0,
+86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,50,0,46,0,48,0,51,0,32,0,117,
+0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,65,0,114,0,109,0,101,
+0,110,0,105,0,97,0,110,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,
+0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,
+0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,
+111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,
+0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,
+0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,
+0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,
+0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,
+0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,
+112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,
+110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,98,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,
+12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,
+1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,
+1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,
+1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,
+1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,
+1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,4,110,117,108,108,7,117,
+110,105,48,53,51,49,7,117,110,105,48,53,51,50,7,117,110,105,48,53,51,51,7,
+117,110,105,48,53,51,52,7,117,110,105,48,53,51,53,7,117,110,105,48,53,51,
+54,7,117,110,105,48,53,51,55,7,117,110,105,48,53,51,56,7,117,110,105,48,53,
+51,57,7,117,110,105,48,53,51,65,7,117,110,105,48,53,51,66,7,117,110,105,48,
+53,51,67,7,117,110,105,48,53,51,68,7,117,110,105,48,53,51,69,7,117,110,105,
+48,53,51,70,7,117,110,105,48,53,52,48,7,117,110,105,48,53,52,49,7,117,110,
+105,48,53,52,50,7,117,110,105,48,53,52,51,7,117,110,105,48,53,52,52,7,117,
+110,105,48,53,52,53,7,117,110,105,48,53,52,54,7,117,110,105,48,53,52,55,7,
+117,110,105,48,53,52,56,7,117,110,105,48,53,52,57,7,117,110,105,48,53,52,
+65,7,117,110,105,48,53,52,66,7,117,110,105,48,53,52,67,7,117,110,105,48,53,
+52,68,7,117,110,105,48,53,52,69,7,117,110,105,48,53,52,70,7,117,110,105,48,
+53,53,48,7,117,110,105,48,53,53,49,7,117,110,105,48,53,53,50,7,117,110,105,
+48,53,53,51,7,117,110,105,48,53,53,52,7,117,110,105,48,53,53,53,7,117,110,
+105,48,53,53,54,7,117,110,105,48,53,53,57,7,117,110,105,48,53,53,65,7,117,
+110,105,48,53,53,66,7,117,110,105,48,53,53,67,7,117,110,105,48,53,53,68,7,
+117,110,105,48,53,53,69,7,117,110,105,48,53,53,70,7,117,110,105,48,53,54,
+49,7,117,110,105,48,53,54,50,7,117,110,105,48,53,54,51,7,117,110,105,48,53,
+54,52,7,117,110,105,48,53,54,53,7,117,110,105,48,53,54,54,7,117,110,105,48,
+53,54,55,7,117,110,105,48,53,54,56,7,117,110,105,48,53,54,57,7,117,110,105,
+48,53,54,65,7,117,110,105,48,53,54,66,7,117,110,105,48,53,54,67,7,117,110,
+105,48,53,54,68,7,117,110,105,48,53,54,69,7,117,110,105,48,53,54,70,7,117,
+110,105,48,53,55,48,7,117,110,105,48,53,55,49,7,117,110,105,48,53,55,50,7,
+117,110,105,48,53,55,51,7,117,110,105,48,53,55,52,7,117,110,105,48,53,55,
+53,7,117,110,105,48,53,55,54,7,117,110,105,48,53,55,55,7,117,110,105,48,53,
+55,56,7,117,110,105,48,53,55,57,7,117,110,105,48,53,55,65,7,117,110,105,48,
+53,55,66,7,117,110,105,48,53,55,67,7,117,110,105,48,53,55,68,7,117,110,105,
+48,53,55,69,7,117,110,105,48,53,55,70,7,117,110,105,48,53,56,48,7,117,110,
+105,48,53,56,49,7,117,110,105,48,53,56,50,7,117,110,105,48,53,56,51,7,117,
+110,105,48,53,56,52,7,117,110,105,48,53,56,53,7,117,110,105,48,53,56,54,7,
+117,110,105,48,53,56,55,7,117,110,105,48,53,56,57,7,117,110,105,48,53,56,
+65,7,117,110,105,70,66,49,51,7,117,110,105,70,66,49,52,7,117,110,105,70,66,
+49,53,7,117,110,105,70,66,49,54,7,117,110,105,70,66,49,55,7,117,110,105,48,
+53,56,70,15,117,110,105,48,53,52,56,95,117,110,105,48,53,53,50,15,117,110,
+105,48,53,55,56,95,117,110,105,48,53,56,50,0,0,0,0,2,0,8,0,2,255,255,0,3,
+0,1,0,0,0,12,0,0,0,0,0,0,0,2,0,1,0,0,0,97,0,1,0,0,0,1,0,0,0,10,0,30,0,44,
+0,1,97,114,109,110,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,107,101,114,110,0,
+8,0,0,0,1,0,0,0,1,0,4,0,2,0,0,0,3,0,12,0,154,2,20,0,1,12,38,0,4,0,0,0,11,
+0,32,0,38,0,44,0,50,0,56,0,70,0,84,0,90,0,96,0,102,0,108,0,1,0,29,255,109,
+0,1,0,29,255,236,0,1,0,29,255,226,0,1,0,29,255,236,0,3,0,62,255,216,0,81,
+255,216,0,85,255,216,0,3,0,62,255,216,0,81,255,216,0,85,255,216,0,1,0,29,
+255,226,0,1,0,29,255,211,0,1,0,19,255,196,0,1,0,29,255,226,0,8,0,19,255,196,
+0,29,255,216,0,50,255,96,0,52,255,96,0,56,255,96,0,57,255,96,0,60,255,96,
+0,66,255,96,0,1,11,178,0,4,0,0,0,14,0,38,0,108,0,126,0,144,0,178,0,200,0,
+214,0,228,1,22,1,52,1,66,1,80,1,102,1,108,0,17,0,4,255,226,0,6,255,121,0,
+7,255,81,0,8,255,226,0,17,255,186,0,18,255,111,0,21,255,81,0,23,255,226,0,
+25,255,204,0,26,255,192,0,28,255,201,0,32,255,226,0,33,255,174,0,38,255,196,
+0,40,255,196,0,71,255,226,0,95,255,81,0,4,0,7,255,221,0,21,255,221,0,73,255,
+216,0,95,255,221,0,4,0,17,255,233,0,25,255,241,0,70,255,216,0,75,255,236,
+0,8,0,6,255,146,0,17,255,231,0,18,255,121,0,25,255,246,0,28,255,231,0,33,
+255,121,0,38,255,231,0,40,255,231,0,5,0,6,255,131,0,18,255,126,0,33,255,126,
+0,71,255,236,0,75,255,216,0,3,0,18,255,241,0,65,255,216,0,70,255,216,0,3,
+0,6,255,136,0,18,255,126,0,33,255,126,0,12,0,13,255,126,0,18,255,216,0,25,
+255,236,0,26,255,231,0,36,255,226,0,51,255,196,0,54,255,196,0,58,255,196,
+0,62,255,196,0,65,255,116,0,81,255,196,0,85,255,196,0,7,0,6,255,211,0,7,255,
+226,0,18,255,226,0,21,255,226,0,25,255,231,0,65,255,226,0,95,255,226,0,3,
+0,44,253,211,0,45,253,143,0,47,252,104,0,3,0,44,253,211,0,45,253,143,0,47,
+252,124,0,5,0,69,0,48,0,71,0,88,0,73,0,198,0,75,0,88,0,84,0,38,0,1,0,86,255,
+216,0,3,0,44,253,211,0,45,253,143,0,47,252,104,0,2,10,88,0,4,0,0,10,206,11,
+142,0,33,0,39,0,0,253,211,253,143,252,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,176,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,253,211,253,143,252,124,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,60,0,100,0,208,0,100,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,253,211,253,143,253,168,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,226,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,253,211,253,143,252,104,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+196,0,0,255,196,255,206,0,0,0,0,0,0,0,0,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,253,211,253,168,253,168,255,176,0,0,255,
+216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,166,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,255,203,0,0,0,0,255,241,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,231,0,
+0,0,0,0,0,255,196,255,236,255,216,255,236,255,216,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,147,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,244,0,0,0,0,0,0,255,
+221,255,216,255,218,255,236,255,241,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,196,
+255,216,0,0,0,0,0,0,255,221,0,0,0,0,0,0,255,226,255,236,0,0,0,0,255,226,255,
+246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,255,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,
+0,0,0,0,0,0,255,141,255,176,0,0,0,0,0,0,0,0,255,231,255,236,255,226,255,216,
+255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,216,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+231,0,0,255,226,0,0,255,241,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,
+0,0,0,0,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,255,216,0,0,255,181,0,0,255,
+186,255,186,0,0,0,0,0,0,255,211,0,0,0,0,0,0,255,216,255,186,255,176,255,236,
+0,0,255,218,0,0,255,216,0,0,0,0,0,0,255,226,255,234,255,226,255,236,255,186,
+255,191,255,216,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,255,216,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+96,255,176,255,96,255,96,255,96,255,96,0,0,0,0,0,60,0,0,255,131,255,211,0,
+0,255,226,255,226,255,226,255,226,255,196,255,221,255,226,255,211,255,216,
+255,206,0,0,0,0,0,0,0,0,255,196,0,0,255,94,0,0,0,0,255,236,255,96,0,0,0,0,
+0,0,0,0,255,236,0,0,0,0,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,211,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,206,255,186,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,146,255,196,0,0,0,0,255,236,0,0,255,226,0,0,0,0,255,216,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,156,255,206,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,11,0,4,
+0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,19,0,23,0,1,0,14,0,4,0,8,0,11,0,
+15,0,21,0,31,0,33,0,35,0,39,0,56,0,59,0,66,0,75,0,85,0,2,0,19,0,5,0,7,0,0,
+0,9,0,17,0,3,0,19,0,26,0,12,0,28,0,28,0,20,0,30,0,31,0,21,0,33,0,34,0,23,
+0,36,0,37,0,25,0,41,0,41,0,27,0,49,0,49,0,28,0,51,0,55,0,29,0,57,0,57,0,34,
+0,59,0,61,0,35,0,70,0,70,0,38,0,72,0,73,0,39,0,76,0,78,0,41,0,80,0,80,0,44,
+0,82,0,83,0,45,0,86,0,87,0,47,0,90,0,97,0,49,0,1,0,5,0,93,0,12,0,13,0,13,
+0,0,0,14,0,15,0,12,0,16,0,11,0,17,0,13,0,18,0,19,0,0,0,20,0,21,0,13,0,22,
+0,23,0,24,0,25,0,26,0,0,0,27,0,0,0,28,0,13,0,0,0,13,0,29,0,0,0,30,0,31,0,
+0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,2,0,3,0,4,0,
+0,0,6,0,0,0,5,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,7,0,0,
+0,0,0,8,0,0,0,3,0,0,0,5,0,0,0,9,0,5,0,0,0,0,0,10,0,9,0,0,0,0,0,0,0,2,0,5,
+0,0,0,0,0,13,0,31,0,9,0,1,0,4,0,94,0,31,0,0,0,20,0,19,0,31,0,23,0,0,0,0,0,
+0,0,15,0,0,0,0,0,0,0,30,0,4,0,0,0,25,0,19,0,26,0,31,0,16,0,14,0,17,0,0,0,
+24,0,0,0,27,0,0,0,31,0,21,0,28,0,0,0,18,0,0,0,22,0,32,0,33,0,29,0,13,0,0,
+0,1,0,2,0,0,0,3,0,0,0,34,0,38,0,10,0,38,0,34,0,10,0,38,0,38,0,38,0,10,0,38,
+0,38,0,38,0,10,0,34,0,35,0,11,0,38,0,37,0,34,0,5,0,36,0,6,0,38,0,7,0,34,0,
+8,0,38,0,34,0,34,0,34,0,38,0,10,0,38,0,34,0,9,0,10,0,12,0,34,0,0,0,0,0,34,
+0,34,0,34,0,34,0,34,0,19,0,0,0,38,0,1,0,0,0,10,0,30,0,44,0,1,97,114,109,110,
+0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,108,105,103,97,0,8,0,0,0,1,0,0,0,1,0,
+4,0,4,0,0,0,1,0,8,0,1,0,78,0,4,0,14,0,24,0,58,0,68,0,1,0,4,0,96,0,2,0,37,
+0,4,0,10,0,16,0,22,0,28,0,91,0,2,0,53,0,92,0,2,0,59,0,94,0,2,0,61,0,90,0,
+2,0,70,0,1,0,4,0,97,0,2,0,82,0,1,0,4,0,93,0,2,0,70,0,1,0,4,0,27,0,68,0,72,
+0,78,0,0,};
+#endif
@@ -0,0 +1,1353 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansBalinese_Regular_ttf_size = 32304;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansBalinese_Regular_ttf");
+asm(".type fz_font_NotoSansBalinese_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansBalinese_Regular_ttf, 32304");
+asm(".balign 64");
+asm("fz_font_NotoSansBalinese_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansBalinese-Regular.ttf\"");
+#else
+const int fz_font_NotoSansBalinese_Regular_ttf_size = 32304;
+const char fz_font_NotoSansBalinese_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,11,86,11,27,0,0,111,88,0,0,0,174,
+71,80,79,83,22,43,120,216,0,0,112,8,0,0,10,146,71,83,85,66,199,55,185,94,
+0,0,122,156,0,0,3,148,79,83,47,50,125,189,113,190,0,0,1,104,0,0,0,96,99,109,
+97,112,66,155,59,209,0,0,4,160,0,0,0,108,103,97,115,112,0,7,0,7,0,0,111,76,
+0,0,0,12,103,108,121,102,170,65,242,112,0,0,6,124,0,0,98,162,104,101,97,100,
+2,25,86,159,0,0,0,236,0,0,0,54,104,104,101,97,11,101,8,135,0,0,1,36,0,0,0,
+36,104,109,116,120,78,80,219,147,0,0,1,200,0,0,2,216,108,111,99,97,106,235,
+81,35,0,0,5,12,0,0,1,110,109,97,120,112,0,207,1,64,0,0,1,72,0,0,0,32,110,
+97,109,101,141,250,185,179,0,0,105,32,0,0,6,12,112,111,115,116,255,184,0,
+50,0,0,111,44,0,0,0,32,0,1,0,0,0,1,7,174,23,25,209,114,95,15,60,245,0,11,
+8,0,0,0,0,0,205,252,59,83,0,0,0,0,210,40,203,225,244,222,250,50,13,247,8,
+141,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,250,50,0,0,14,121,244,222,255,37,
+13,247,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,182,0,1,0,0,0,182,0,143,0,8,0,175,
+0,12,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,4,6,210,1,144,0,5,0,0,5,154,5,
+51,0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,8,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,250,50,0,0,8,
+141,5,206,0,0,0,1,0,0,0,0,4,250,4,250,0,0,0,32,0,2,4,205,0,193,0,0,0,0,2,
+18,0,0,2,18,0,0,0,0,252,67,0,0,252,77,0,0,253,126,0,0,252,32,3,75,0,80,8,
+210,0,100,11,55,0,100,7,118,0,80,10,196,0,80,5,254,0,130,8,128,0,130,6,117,
+0,80,9,192,0,80,7,148,0,80,9,49,0,80,5,191,0,120,9,39,0,80,7,222,0,80,10,
+226,0,80,8,227,0,80,9,12,0,80,8,189,0,80,9,88,0,80,7,118,0,80,6,91,0,80,8,
+107,0,130,7,8,0,80,9,169,0,80,12,18,0,80,8,102,0,80,8,22,0,80,7,121,0,80,
+6,122,0,80,9,197,0,80,9,161,0,80,6,89,0,80,8,147,0,80,7,93,0,80,6,214,0,80,
+6,117,0,80,6,30,0,80,9,113,0,80,7,103,0,80,6,213,0,100,7,172,0,80,6,194,0,
+80,9,201,0,80,6,89,0,80,8,189,0,80,6,117,0,80,6,119,0,80,9,201,0,80,0,0,252,
+192,3,148,0,0,0,0,252,67,0,0,252,67,0,0,252,244,0,0,254,199,0,0,251,190,3,
+148,251,181,0,0,248,195,3,148,248,195,3,222,0,60,3,222,0,60,11,170,0,60,11,
+170,0,60,0,0,249,137,3,148,249,137,2,200,253,128,9,181,0,80,14,121,0,80,9,
+161,0,80,6,117,0,80,6,89,0,80,6,119,0,80,11,178,0,80,3,198,0,120,9,116,0,
+80,7,148,0,80,7,222,0,80,4,16,0,100,5,60,0,100,5,191,0,120,8,190,0,80,6,30,
+0,80,7,55,0,80,9,92,0,80,10,85,0,80,2,245,0,50,3,169,0,130,3,37,0,80,5,35,
+0,80,3,115,0,100,4,115,0,50,3,222,0,60,3,92,0,80,3,214,0,100,4,222,0,80,5,
+79,0,130,7,133,0,80,3,24,0,130,10,109,0,80,3,75,0,80,0,0,253,149,0,0,253,
+149,0,0,251,233,0,0,251,233,0,0,251,132,0,0,251,233,0,0,251,132,0,0,251,227,
+0,0,252,143,4,207,0,60,4,146,0,130,4,207,0,20,4,146,0,70,4,185,0,80,4,253,
+0,100,4,185,0,80,5,17,0,100,3,56,0,200,0,0,0,0,0,0,255,220,0,0,255,37,4,103,
+0,100,0,0,249,222,0,0,248,48,0,0,249,233,0,0,247,143,0,0,249,93,0,0,249,223,
+0,0,249,222,0,0,250,87,2,146,252,50,0,0,245,129,0,0,249,188,0,0,249,154,0,
+0,250,116,0,0,251,105,0,0,248,198,0,0,249,80,0,0,251,214,0,0,250,233,0,0,
+250,146,0,0,250,254,5,35,0,80,4,204,0,80,0,0,248,99,0,0,249,63,0,0,250,212,
+2,83,252,248,0,0,252,28,0,0,247,40,0,0,251,214,0,0,249,233,5,35,0,80,5,35,
+252,244,0,0,248,231,0,0,249,92,0,0,244,222,0,0,249,80,5,35,0,80,0,0,251,214,
+5,35,252,244,0,0,246,191,5,35,0,80,0,0,248,195,8,207,0,60,8,207,0,60,8,120,
+0,60,8,120,0,60,8,207,0,60,8,207,0,60,8,207,0,60,8,207,0,60,8,207,0,60,8,
+207,0,60,9,169,0,80,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,96,0,0,0,20,0,16,0,3,0,
+4,0,0,0,13,0,32,0,160,27,75,27,124,32,13,37,204,254,255,255,255,0,0,0,0,0,
+13,0,32,0,160,27,0,27,80,32,11,37,204,254,255,255,255,0,1,255,245,255,227,
+255,99,229,4,229,0,224,114,218,180,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,75,0,142,0,172,0,196,1,2,1,150,2,48,2,
+169,2,181,3,2,3,14,3,120,3,132,4,9,4,179,4,234,5,136,6,2,6,14,6,149,7,14,
+7,103,7,216,8,36,8,132,8,210,9,33,9,196,10,61,10,175,11,2,11,80,11,146,11,
+245,12,92,12,190,13,30,13,117,13,224,14,29,14,111,14,213,15,64,15,147,15,
+224,16,31,16,127,16,197,17,55,17,145,17,231,18,68,18,122,18,167,18,205,19,
+8,19,48,19,84,19,141,19,156,19,171,19,189,19,237,20,62,20,78,20,94,20,139,
+20,150,20,205,21,108,22,19,22,147,22,236,23,78,23,190,24,67,24,106,24,229,
+25,106,25,228,26,39,26,137,26,192,27,50,27,131,27,228,28,75,29,14,29,53,29,
+126,29,161,29,224,30,26,30,73,30,121,30,163,30,194,30,222,31,11,31,62,31,
+106,31,253,32,59,32,99,32,139,32,189,32,212,32,244,33,54,33,94,33,121,33,
+176,33,213,33,255,34,64,34,133,34,155,34,186,34,235,35,43,35,66,35,66,35,
+79,35,108,35,196,36,39,36,152,36,212,37,70,37,148,37,213,38,18,38,74,38,162,
+39,19,39,85,39,137,39,201,40,2,40,73,40,146,40,210,41,1,41,70,41,139,41,179,
+41,239,42,73,42,160,42,211,43,13,43,47,43,142,43,181,44,8,44,75,44,149,44,
+212,45,77,45,207,46,50,46,117,46,178,47,23,47,148,47,233,48,56,48,68,48,80,
+48,92,48,104,48,116,48,128,48,140,48,152,48,164,48,176,49,81,0,0,0,2,0,193,
+0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,
+121,253,135,5,182,250,74,104,4,230,0,0,2,252,67,4,246,255,86,7,198,0,11,0,
+35,0,0,0,22,21,20,6,35,34,38,53,52,54,51,19,54,54,53,52,38,35,34,6,21,20,
+22,23,7,38,53,52,54,51,50,22,21,20,7,254,5,69,66,49,50,67,69,48,203,66,34,
+160,143,153,171,34,66,50,130,206,191,187,203,130,6,114,67,50,47,69,70,46,
+48,69,254,182,95,104,74,120,127,129,118,76,103,94,50,160,172,188,200,202,
+186,170,162,0,2,252,77,4,246,255,96,7,247,0,30,0,44,0,0,1,22,21,20,6,35,34,
+38,53,52,55,23,6,6,21,20,23,54,54,55,53,51,21,22,22,23,54,53,52,38,39,1,22,
+51,50,55,55,53,52,38,35,34,6,21,20,254,222,130,203,187,191,206,130,50,64,
+36,37,10,134,102,80,97,127,15,25,37,63,254,99,81,129,127,77,2,120,91,91,118,
+7,198,160,172,187,201,200,188,170,162,50,92,102,79,75,57,120,161,14,209,210,
+16,149,112,51,64,77,106,90,254,38,46,49,18,21,99,142,142,99,26,0,1,253,126,
+4,246,255,178,8,22,0,15,0,0,3,3,38,38,35,34,6,7,39,52,54,51,50,22,23,19,150,
+152,54,84,47,41,46,2,66,74,66,59,120,71,174,4,246,1,124,136,113,62,51,5,107,
+172,152,179,254,81,0,1,252,32,4,248,255,249,8,22,0,7,0,0,3,36,0,3,23,18,0,
+5,31,254,187,253,230,98,196,104,1,154,1,19,4,248,21,1,193,1,72,44,254,213,
+254,152,35,0,0,1,0,80,251,162,2,231,4,94,0,40,0,0,19,51,32,17,52,38,35,34,
+6,7,6,35,39,52,54,51,50,22,21,20,6,7,4,17,20,0,21,20,23,23,7,38,38,53,52,
+0,53,52,38,35,35,202,53,1,87,116,96,104,120,2,29,15,36,157,146,143,172,113,
+100,1,2,254,245,27,7,51,31,52,1,11,220,189,42,1,193,1,16,107,120,135,125,
+8,6,197,235,217,187,92,163,50,108,254,239,242,254,14,150,128,65,24,39,42,
+210,63,245,1,189,208,132,142,0,3,0,100,255,236,8,180,4,186,0,52,0,98,0,104,
+0,0,1,54,54,51,50,22,21,20,7,22,22,21,20,6,35,34,0,17,52,18,36,51,50,4,23,
+7,38,38,35,34,0,21,20,22,51,50,54,53,52,38,35,35,55,51,54,54,53,52,38,35,
+34,6,7,1,39,17,35,17,38,39,21,20,6,35,34,38,39,55,22,22,51,50,54,53,53,38,
+35,34,6,21,20,23,7,38,38,53,52,54,51,50,23,17,51,50,22,22,21,21,23,37,23,
+53,16,35,35,1,184,34,131,79,88,120,119,80,87,197,163,204,254,236,147,1,27,
+159,202,1,67,78,70,127,249,155,207,254,228,197,183,139,121,109,106,92,10,
+77,73,99,74,53,70,90,29,6,191,135,80,117,58,184,175,170,199,21,66,16,164,
+144,136,143,44,27,41,54,42,50,58,69,71,55,63,112,47,105,128,55,160,254,97,
+175,149,26,2,214,105,129,111,85,151,77,25,114,76,152,189,1,100,1,5,175,1,
+18,164,199,167,46,188,124,254,233,226,221,234,92,90,65,78,80,8,83,45,45,54,
+43,47,254,158,58,254,108,1,183,51,19,24,254,251,201,189,20,116,124,173,173,
+35,10,44,38,42,44,42,49,120,51,49,60,35,1,219,86,179,200,143,68,174,72,100,
+1,48,0,0,2,0,100,255,235,10,211,4,186,0,54,0,107,0,0,37,39,2,33,34,38,39,
+55,22,22,51,50,19,38,35,34,6,21,20,23,7,38,53,52,54,51,50,23,53,52,0,51,50,
+0,21,16,0,35,34,39,55,22,22,51,50,18,53,52,38,35,34,6,21,21,19,1,54,54,51,
+50,22,21,20,7,22,22,21,20,6,35,34,0,17,52,18,36,51,50,4,23,7,38,38,35,34,
+0,21,20,22,51,50,54,53,52,38,35,35,55,51,50,54,53,52,38,35,34,6,7,7,219,205,
+44,254,204,170,199,21,66,16,164,144,250,26,88,54,35,48,12,63,44,61,50,80,
+132,1,33,217,235,1,41,254,254,181,110,71,51,23,84,34,136,192,234,195,199,
+230,251,249,168,34,131,79,88,120,119,80,87,197,163,204,254,236,147,1,27,159,
+202,1,67,78,70,127,249,155,207,254,228,197,183,139,121,109,106,92,10,77,71,
+101,74,53,70,90,29,138,218,254,136,201,189,20,116,124,1,25,80,49,36,27,31,
+19,88,85,65,79,123,1,251,1,66,254,197,241,254,235,254,207,43,80,11,12,1,3,
+215,181,213,222,184,77,254,248,2,14,105,129,111,85,151,77,25,114,76,152,189,
+1,100,1,5,175,1,18,164,199,167,46,188,124,254,233,226,221,234,92,90,65,78,
+80,89,47,45,54,43,47,0,0,2,0,80,253,48,6,244,4,94,0,54,0,88,0,0,33,17,52,
+38,35,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,
+35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,51,50,23,54,51,50,22,17,17,
+5,38,35,34,6,21,20,4,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,46,2,
+53,52,54,51,50,22,23,6,164,104,126,85,121,9,69,129,86,126,105,47,103,129,
+53,53,66,50,55,22,2,29,15,36,105,101,101,101,77,69,26,144,167,183,66,67,183,
+168,142,254,92,59,98,60,82,1,19,154,149,115,109,218,31,38,27,189,84,78,121,
+87,254,88,133,99,67,87,37,2,104,172,160,116,99,84,131,160,172,253,152,86,
+177,202,195,165,123,46,87,127,8,6,234,198,188,254,235,236,121,126,1,190,1,
+18,228,206,206,228,254,238,253,152,167,37,38,32,48,59,99,88,96,130,138,91,
+26,42,64,50,41,40,54,56,68,49,71,92,26,20,0,255,255,0,80,253,48,10,96,4,94,
+16,34,0,11,0,0,16,3,0,57,7,48,0,0,0,1,0,130,251,162,5,124,4,94,0,50,0,0,1,
+17,52,38,35,34,6,21,17,35,34,38,53,52,18,0,18,53,52,38,35,34,6,7,6,35,39,
+52,54,51,50,22,21,20,2,0,0,6,21,20,22,51,51,53,52,18,51,50,22,17,17,5,44,
+185,205,206,184,47,172,195,213,2,42,185,116,96,104,120,2,29,15,36,157,146,
+143,172,134,254,237,254,132,163,133,75,26,239,230,226,245,251,162,1,36,177,
+161,164,170,254,216,233,209,176,1,83,1,212,1,22,136,107,120,135,125,8,6,197,
+235,217,187,162,254,213,254,234,254,210,240,114,114,153,126,245,1,3,249,255,
+0,254,217,0,255,255,0,130,251,162,8,28,4,94,16,34,0,13,0,0,16,3,0,57,4,236,
+0,0,0,2,0,80,252,254,5,243,4,94,0,42,0,76,0,0,33,17,16,35,35,17,20,2,35,34,
+38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,50,54,53,
+17,51,50,22,22,21,17,5,38,35,34,6,21,20,4,22,21,20,6,35,34,38,39,55,22,22,
+51,50,54,53,52,46,2,53,52,54,51,50,22,23,5,163,149,26,215,214,215,216,53,
+66,50,55,22,2,29,15,36,105,101,101,101,164,186,187,163,47,105,128,55,253,
+235,59,98,60,82,1,19,154,149,115,109,218,31,38,27,189,84,78,121,87,254,88,
+133,99,67,87,37,2,114,1,48,254,64,245,254,255,247,237,196,165,123,46,87,127,
+8,6,234,198,188,254,235,167,180,156,162,170,2,106,86,179,200,253,133,217,
+37,38,32,48,59,99,88,96,130,138,91,26,42,64,50,41,40,54,56,68,49,71,92,26,
+20,0,255,255,0,80,252,254,9,92,4,94,16,34,0,15,0,0,16,3,0,57,6,44,0,0,0,2,
+0,80,251,160,8,42,4,94,0,78,0,89,0,0,1,6,6,35,39,2,3,39,55,38,38,36,36,38,
+53,52,54,51,50,4,23,18,17,16,33,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,
+53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,
+51,50,23,54,51,50,18,17,16,3,23,50,55,1,54,55,38,36,35,34,21,20,4,4,8,42,
+55,154,73,51,65,112,80,10,4,195,254,10,254,231,148,204,159,208,2,58,156,63,
+254,242,85,121,9,69,129,86,126,105,47,103,129,53,53,66,50,55,22,2,29,15,36,
+105,101,101,101,77,69,26,144,167,183,66,67,183,179,191,63,21,174,85,254,6,
+69,39,193,253,152,169,201,1,12,2,215,254,80,37,39,1,254,202,254,209,20,32,
+67,100,114,107,152,100,120,168,235,23,1,97,1,47,2,178,116,99,84,131,160,172,
+253,152,86,177,202,195,165,123,46,87,127,8,6,234,198,188,254,235,236,121,
+126,1,190,1,18,228,206,206,254,77,254,97,254,176,254,173,1,47,253,194,238,
+198,22,187,142,99,150,165,0,2,0,80,251,160,9,149,4,94,0,110,0,121,0,0,1,55,
+38,38,36,36,38,53,52,54,51,50,4,23,18,17,16,33,34,6,7,35,52,38,35,34,6,21,
+17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,
+51,51,17,16,54,51,50,23,54,51,50,18,17,16,3,23,50,54,51,50,22,21,20,7,22,
+22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,35,55,51,50,54,53,52,
+38,35,34,6,35,2,3,39,54,55,38,36,35,34,21,20,4,4,5,220,10,4,195,254,10,254,
+231,148,204,159,208,2,58,156,63,254,242,85,121,9,69,129,86,126,105,47,103,
+129,53,53,66,50,55,22,2,29,15,36,105,101,101,101,77,69,26,144,167,183,66,
+67,183,179,191,63,21,149,188,123,69,91,108,66,77,176,136,101,166,56,62,38,
+130,93,119,103,94,90,78,9,65,62,91,44,52,94,240,141,65,112,29,64,43,166,253,
+127,170,201,1,12,2,215,251,180,32,67,100,114,107,152,100,120,168,235,23,1,
+97,1,47,2,178,116,99,84,131,160,172,253,152,86,177,202,195,165,123,46,87,
+127,8,6,234,198,188,254,235,236,121,126,1,190,1,18,228,206,206,254,77,254,
+97,254,176,254,173,1,178,99,77,126,69,20,108,72,132,165,106,91,59,58,48,79,
+77,56,71,80,82,51,54,45,155,254,205,254,207,185,221,211,16,197,142,99,150,
+165,0,1,0,120,255,232,5,71,4,126,0,34,0,0,5,55,53,52,38,35,34,6,21,21,38,
+2,53,52,18,36,51,50,23,7,38,35,34,0,21,20,23,54,36,51,50,0,21,21,7,4,225,
+2,232,197,199,230,129,144,147,1,27,159,61,66,23,56,46,207,254,228,109,41,
+1,13,180,236,1,40,1,20,32,32,180,207,222,184,49,77,1,45,183,175,1,18,164,
+11,96,7,254,233,226,240,120,188,228,254,202,239,26,25,0,2,0,80,251,162,9,
+39,6,34,0,105,0,113,0,0,1,16,6,35,34,38,35,34,6,35,34,38,53,52,18,0,18,53,
+52,38,35,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,6,6,
+7,6,35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,51,50,23,54,51,50,22,
+21,20,2,0,0,6,21,20,22,51,50,54,54,51,50,22,51,50,54,53,17,38,38,53,52,54,
+51,50,22,23,50,54,55,23,6,6,7,0,22,23,38,38,35,34,21,7,253,151,170,100,123,
+87,87,121,101,168,196,195,2,49,196,119,104,85,121,9,69,129,86,126,105,47,
+103,129,53,53,66,50,55,22,2,29,15,36,105,101,101,101,77,69,26,144,167,183,
+66,67,183,153,170,125,254,246,254,90,139,149,135,69,86,77,57,73,119,98,153,
+108,144,174,91,79,96,127,5,88,131,10,69,13,164,121,254,204,119,109,4,85,55,
+84,253,152,254,253,243,206,206,240,200,168,1,53,1,191,1,51,168,106,121,116,
+99,84,131,160,172,253,152,86,177,202,195,165,123,46,87,127,8,6,234,198,188,
+254,235,236,121,126,1,190,1,18,228,206,206,211,193,179,254,199,254,235,254,
+201,212,105,127,138,76,139,215,162,170,6,123,21,186,136,85,99,205,153,134,
+117,43,171,205,3,1,14,90,9,112,146,83,0,1,0,80,251,162,7,222,4,94,0,87,0,
+0,1,17,52,38,35,34,6,21,17,35,34,38,53,52,18,0,18,53,52,38,35,34,6,7,35,52,
+38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,
+22,17,21,20,22,51,51,17,16,54,51,50,23,54,51,50,22,21,20,2,0,0,6,21,20,22,
+51,51,53,52,18,51,50,22,17,17,7,142,185,205,206,184,47,171,195,197,2,45,198,
+119,104,85,121,9,69,129,86,126,105,47,103,129,53,53,66,50,55,22,2,29,15,36,
+105,101,101,101,77,69,26,144,167,183,66,67,183,153,170,125,254,246,254,90,
+139,121,86,26,239,230,226,245,251,162,1,36,177,161,164,170,254,216,232,210,
+169,1,51,1,189,1,51,169,106,121,116,99,84,131,160,172,253,152,86,177,202,
+195,165,123,46,87,127,8,6,234,198,188,254,235,236,121,126,1,190,1,18,228,
+206,206,211,193,179,254,199,254,235,254,201,212,105,99,166,126,245,1,3,249,
+255,0,254,217,255,255,0,80,251,162,10,126,4,94,16,34,0,21,0,0,16,3,0,57,7,
+78,0,0,0,3,0,80,255,236,8,97,4,94,0,80,0,90,0,98,0,0,33,17,16,35,35,17,20,
+6,35,34,38,53,53,52,38,35,34,6,21,21,4,4,21,20,6,35,34,36,53,53,7,21,20,6,
+35,34,38,53,52,54,55,53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,17,21,54,55,
+53,52,36,51,50,18,21,21,20,22,51,50,54,53,17,51,50,22,22,21,17,1,20,22,51,
+50,54,53,52,36,39,5,6,6,21,20,51,50,17,8,17,149,26,88,76,95,91,195,204,206,
+206,1,32,1,68,147,125,153,254,245,112,112,111,77,98,169,149,71,77,73,73,3,
+29,15,36,119,121,105,112,28,84,1,5,228,237,245,45,64,38,43,47,105,128,55,
+250,120,222,129,69,92,254,229,229,254,240,112,116,89,139,2,114,1,48,253,59,
+111,130,166,226,240,178,158,172,164,4,15,209,181,103,120,242,191,27,5,63,
+204,188,121,88,144,210,43,74,145,143,99,161,8,6,230,202,194,254,241,50,4,
+3,44,219,245,254,254,245,250,134,101,88,65,3,49,86,179,200,253,133,1,151,
+156,171,50,44,106,142,15,16,27,115,79,120,1,29,0,0,3,0,80,255,56,9,62,4,94,
+0,68,0,78,0,86,0,0,5,38,38,35,34,38,53,53,52,38,35,34,6,21,21,4,4,21,20,6,
+35,34,36,53,53,34,7,21,20,6,35,34,38,53,52,54,55,53,52,38,35,34,6,7,6,35,
+39,52,54,51,50,22,17,21,54,51,53,52,36,51,50,18,21,21,20,22,4,22,23,1,20,
+22,51,50,54,53,52,36,39,5,6,6,21,20,51,50,17,8,252,12,159,195,198,196,195,
+204,219,193,1,32,1,68,147,125,153,254,245,72,40,112,111,77,98,169,149,71,
+77,73,73,3,29,15,36,119,121,105,112,40,72,1,5,228,237,245,156,1,100,214,20,
+249,155,222,129,69,92,254,229,229,254,240,112,116,89,139,200,94,96,204,211,
+207,178,158,152,159,29,15,209,181,103,120,242,191,26,4,63,204,188,121,88,
+144,210,43,74,145,143,99,161,8,6,230,202,194,254,241,50,7,44,219,245,254,
+254,245,199,131,123,5,171,166,2,75,156,171,50,44,106,142,15,16,27,115,79,
+120,1,29,0,1,0,80,0,0,8,59,4,94,0,64,0,0,1,20,6,6,35,35,17,52,38,35,34,6,
+21,17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,
+22,51,51,17,52,18,51,50,22,17,17,51,50,54,53,17,51,50,22,22,21,17,35,17,16,
+35,35,7,60,52,129,104,47,188,202,207,183,47,103,129,53,53,66,50,55,22,2,29,
+15,36,105,101,101,101,77,69,26,238,231,226,245,26,70,76,47,105,128,55,80,
+149,26,1,209,203,175,87,2,100,179,157,163,169,253,152,86,177,202,195,165,
+123,46,87,127,8,6,234,198,188,254,235,236,121,126,1,190,244,1,2,247,255,0,
+254,67,126,121,2,171,86,179,200,253,133,2,114,1,48,0,1,0,80,255,236,8,214,
+4,94,0,84,0,0,1,34,17,17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,
+51,50,22,17,21,20,22,51,51,17,52,54,54,51,51,17,20,22,51,50,54,54,51,50,22,
+51,50,54,53,53,52,38,35,54,51,50,22,21,17,35,17,52,38,35,34,7,22,22,21,21,
+16,6,35,34,38,35,34,6,35,34,38,17,17,3,121,149,47,103,129,53,53,66,50,55,
+22,2,29,15,36,105,101,101,101,77,69,26,55,130,103,47,87,104,69,86,77,57,73,
+119,98,104,86,163,145,87,190,167,171,80,112,109,46,33,78,75,117,133,100,123,
+87,87,121,101,135,116,3,162,254,208,253,142,86,177,202,195,165,123,46,87,
+127,8,6,234,198,188,254,235,236,121,126,1,209,202,178,85,253,150,179,153,
+76,139,215,153,179,53,167,228,188,245,238,253,133,2,114,151,171,14,64,174,
+137,77,254,240,230,206,206,236,1,10,1,192,0,1,0,80,0,0,6,244,4,94,0,54,0,
+0,33,17,52,38,35,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,
+34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,51,50,23,54,51,
+50,22,17,17,6,164,104,126,85,121,9,69,129,86,126,105,47,103,129,53,53,66,
+50,55,22,2,29,15,36,105,101,101,101,77,69,26,144,167,183,66,67,183,168,142,
+2,104,172,160,116,99,84,131,160,172,253,152,86,177,202,195,165,123,46,87,
+127,8,6,234,198,188,254,235,236,121,126,1,190,1,18,228,206,206,228,254,238,
+253,152,0,2,0,80,255,236,5,217,4,94,0,60,0,67,0,0,1,6,6,35,34,0,39,21,20,
+6,35,34,38,53,52,54,55,53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,17,21,22,
+22,18,51,50,54,55,53,52,38,35,54,51,50,22,21,17,35,17,52,38,35,34,7,22,22,
+21,5,53,6,21,20,51,50,4,246,3,123,118,134,254,250,93,112,111,77,98,178,140,
+71,77,73,73,3,29,15,36,119,121,105,112,80,154,197,55,82,82,3,163,145,87,190,
+167,171,80,112,109,46,33,78,75,252,211,228,89,139,1,164,229,211,1,113,37,
+14,204,188,121,88,163,209,8,91,145,143,99,161,8,6,230,202,194,254,241,90,
+18,131,254,248,133,167,85,167,228,188,245,238,253,133,2,114,151,171,14,64,
+174,137,194,34,5,194,120,0,0,1,0,130,255,236,7,233,4,94,0,55,0,0,1,16,35,
+35,17,20,2,35,34,38,53,53,52,38,35,34,6,21,21,20,22,51,50,54,54,55,54,51,
+23,20,6,35,34,38,17,53,52,18,51,32,17,21,20,22,51,50,54,53,17,51,50,22,22,
+21,17,35,7,153,149,26,215,214,215,216,164,186,187,163,53,66,54,55,18,2,29,
+15,36,106,100,101,101,215,214,1,175,164,186,187,163,47,105,128,55,80,2,114,
+1,48,254,64,245,254,255,247,237,148,180,156,162,170,178,165,123,66,106,118,
+8,6,245,217,188,1,21,171,245,1,1,254,9,129,180,156,162,170,2,106,86,179,200,
+253,133,0,0,1,0,80,0,0,6,134,4,94,0,57,0,0,33,53,52,38,35,35,55,51,50,54,
+53,52,38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,
+51,50,22,17,21,20,22,51,51,17,52,18,51,50,4,21,20,6,7,22,21,21,6,54,199,190,
+92,10,99,166,186,223,194,221,192,47,103,129,53,53,66,50,55,22,2,29,15,36,
+105,101,101,101,77,69,26,254,239,244,1,17,113,102,215,118,135,142,80,121,
+108,112,132,163,169,253,152,86,177,202,195,165,123,46,87,127,8,6,234,198,
+188,254,235,236,121,126,1,190,245,1,1,209,191,90,154,40,85,237,112,0,0,2,
+0,80,251,162,9,89,6,34,0,110,0,120,0,0,1,16,6,35,34,38,35,34,6,35,34,38,53,
+52,18,0,18,53,52,38,35,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,53,53,52,
+38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,51,50,23,
+54,51,50,22,21,20,2,0,0,6,21,20,22,51,50,54,54,51,50,22,51,50,54,53,17,38,
+38,53,52,54,51,50,22,21,21,22,22,21,21,35,53,52,38,38,47,2,53,52,38,35,34,
+6,21,20,22,7,253,151,170,100,123,87,87,121,101,168,196,195,2,49,196,119,104,
+85,121,9,69,129,86,126,105,47,103,129,53,53,66,50,55,22,2,29,15,36,105,101,
+101,101,77,69,26,144,167,183,66,67,183,153,170,125,254,246,254,90,139,149,
+135,69,86,77,57,73,119,98,153,108,149,169,95,80,112,111,188,160,80,55,68,
+88,57,80,67,72,48,41,114,253,152,254,253,243,206,206,240,200,168,1,53,1,191,
+1,51,168,106,121,116,99,84,131,160,172,253,152,86,177,202,195,165,123,46,
+87,127,8,6,234,198,188,254,235,236,121,126,1,190,1,18,228,206,206,211,193,
+179,254,199,254,235,254,201,212,105,127,138,76,139,215,162,170,6,88,43,196,
+129,83,111,178,199,39,20,180,201,47,38,93,94,37,15,9,175,33,136,134,51,54,
+69,104,0,0,1,0,80,255,236,11,174,4,94,0,88,0,0,1,52,38,35,34,6,7,35,52,38,
+35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,
+17,21,20,22,51,51,17,16,54,51,50,23,54,51,50,22,17,17,51,50,54,53,53,52,0,
+51,50,0,21,16,0,35,34,39,55,22,22,51,50,18,53,52,38,35,34,6,21,21,20,6,6,
+35,35,6,164,104,126,85,121,9,69,129,86,126,105,47,103,129,53,53,66,50,55,
+22,2,29,15,36,105,101,101,101,77,69,26,144,167,183,66,67,183,168,142,26,70,
+76,1,33,217,235,1,41,254,254,181,110,71,51,23,84,34,136,192,234,195,199,230,
+52,129,104,47,2,104,172,160,116,99,84,131,160,172,253,152,86,177,202,195,
+165,123,46,87,127,8,6,234,198,188,254,235,236,121,126,1,190,1,18,228,206,
+206,228,254,238,254,66,126,121,128,251,1,66,254,197,241,254,235,254,207,43,
+80,11,12,1,3,215,181,213,222,184,77,203,175,87,0,3,0,80,253,168,7,228,4,94,
+0,46,0,73,0,81,0,0,5,6,6,35,34,2,53,53,38,38,53,53,52,38,35,34,6,7,6,35,39,
+52,54,51,50,22,21,21,20,22,51,54,54,51,50,22,21,20,6,7,21,20,22,51,50,54,
+55,1,54,54,51,50,23,54,51,50,22,17,17,35,17,52,38,35,34,6,7,35,52,38,35,34,
+6,7,3,54,54,53,52,35,34,6,5,244,22,207,171,185,214,136,174,57,60,70,65,3,
+29,15,36,122,107,93,93,137,93,5,126,97,79,91,176,142,174,145,145,172,17,253,
+185,19,164,153,183,66,67,183,168,142,80,104,126,85,121,9,69,129,86,139,111,
+16,140,110,118,84,55,85,210,189,201,1,16,233,76,4,225,200,249,155,134,92,
+168,8,6,251,181,215,251,213,132,155,152,206,99,85,137,187,19,67,155,191,124,
+116,3,178,184,178,206,206,228,254,238,253,152,2,104,172,160,116,99,84,131,
+102,109,253,183,9,91,75,83,147,0,2,0,80,255,116,7,148,4,94,0,26,0,56,0,0,
+1,54,54,51,50,23,54,51,50,22,17,17,35,17,52,38,35,34,6,7,35,52,38,35,34,6,
+7,1,6,6,35,34,2,53,17,52,38,35,34,6,7,6,35,39,52,54,51,50,22,21,17,20,22,
+51,50,54,55,3,27,19,164,153,183,66,67,183,168,142,80,104,126,85,121,9,69,
+129,86,139,111,16,1,93,22,207,171,185,214,57,60,70,65,3,29,15,36,122,107,
+93,93,174,145,145,172,17,2,244,184,178,206,206,228,254,238,253,152,2,104,
+172,160,116,99,84,131,102,109,254,25,189,201,1,16,233,1,38,155,134,92,168,
+8,6,251,181,215,251,254,236,155,191,124,116,0,1,0,80,255,236,6,247,4,94,0,
+55,0,0,1,50,22,22,21,17,35,17,16,35,35,17,16,6,35,34,38,35,34,6,35,34,38,
+17,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,50,54,54,51,
+50,22,51,50,54,53,17,5,215,105,128,55,80,149,26,117,133,100,124,86,87,121,
+101,135,116,53,66,50,55,22,2,29,15,36,105,101,101,101,87,104,69,86,77,57,
+73,119,98,104,86,4,76,86,179,200,253,133,2,114,1,48,254,64,254,240,230,206,
+206,236,1,10,178,165,123,46,87,127,8,6,234,198,188,254,235,171,179,153,76,
+139,215,153,179,2,106,0,1,0,80,255,236,5,248,4,94,0,45,0,0,1,17,16,6,35,34,
+38,35,34,6,35,34,38,17,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,
+20,22,51,50,54,54,51,50,22,51,50,54,53,17,5,248,117,133,100,124,86,87,121,
+101,135,116,53,66,50,55,22,2,29,15,36,105,101,101,101,87,104,69,86,77,57,
+73,119,98,104,86,4,76,253,150,254,240,230,206,206,236,1,10,178,165,123,46,
+87,127,8,6,234,198,188,254,235,171,179,153,76,139,215,153,179,2,106,0,0,1,
+0,80,255,236,9,67,4,94,0,72,0,0,33,17,16,35,35,17,20,6,35,34,38,53,17,16,
+35,34,14,2,35,34,46,2,35,34,6,2,6,35,34,38,53,55,50,23,30,2,51,50,54,55,55,
+62,2,51,50,30,2,51,50,18,51,50,22,21,17,20,22,51,50,54,53,17,51,50,22,22,
+21,17,8,243,149,26,88,76,95,91,220,66,109,74,88,58,59,87,74,110,66,82,104,
+84,99,80,115,111,36,15,29,2,27,62,57,69,78,18,22,26,59,94,73,68,111,70,90,
+64,97,167,140,144,148,45,64,38,43,47,105,128,55,2,114,1,48,253,59,111,130,
+166,226,1,33,1,31,75,126,107,108,125,75,95,254,242,90,197,235,6,8,129,87,
+44,75,69,84,99,82,46,77,124,107,1,52,235,219,254,213,134,101,88,65,3,49,86,
+179,200,253,133,0,1,0,80,255,236,9,31,4,94,0,77,0,0,33,17,16,35,35,17,20,
+6,35,34,38,53,53,52,38,35,32,21,20,30,2,21,20,4,35,34,38,53,53,52,38,35,34,
+6,7,6,35,39,52,54,51,50,22,21,21,20,22,51,50,54,53,52,46,3,53,52,36,51,50,
+0,21,21,20,22,51,50,54,53,17,51,50,22,22,21,17,8,207,149,26,88,76,95,91,206,
+228,254,133,240,122,75,254,234,219,231,211,57,60,70,65,3,29,15,36,122,107,
+93,93,182,180,183,214,77,190,115,55,1,8,215,245,1,13,45,64,38,43,47,105,128,
+55,2,114,1,48,253,59,111,130,166,226,244,165,167,189,81,37,50,123,103,168,
+217,210,220,249,155,134,92,168,8,6,251,181,215,251,213,149,140,113,103,57,
+59,23,56,122,82,151,202,254,250,240,251,134,101,88,65,3,49,86,179,200,253,
+133,0,0,1,0,80,255,126,5,215,4,94,0,70,0,0,5,39,6,35,34,38,53,53,52,38,35,
+34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,50,55,39,38,38,35,34,6,7,39,
+52,54,51,50,22,23,23,54,53,53,52,38,35,54,51,50,22,21,17,35,17,52,38,35,34,
+7,22,22,21,21,16,7,23,4,106,65,95,131,215,216,53,66,50,55,22,2,29,15,36,105,
+101,101,101,164,186,105,65,48,54,84,47,41,46,2,66,74,66,59,120,71,70,108,
+163,145,87,190,167,171,80,112,109,46,33,78,75,136,70,130,161,51,247,237,196,
+165,123,46,87,127,8,6,234,198,188,254,235,167,180,156,23,120,136,113,62,51,
+5,107,172,152,179,173,78,195,53,167,228,188,245,238,253,133,2,114,151,171,
+14,64,174,137,77,254,233,124,171,0,0,2,0,80,255,236,8,17,4,94,0,55,0,66,0,
+0,1,20,22,51,50,0,55,53,52,18,51,50,22,17,17,35,17,52,38,35,34,6,21,21,54,
+51,50,22,21,20,6,35,34,38,39,6,0,35,34,17,53,52,38,35,34,6,7,6,35,39,52,54,
+51,50,22,17,1,22,22,51,50,54,53,52,38,35,34,2,18,84,82,66,1,10,97,238,231,
+226,245,80,188,202,207,183,33,24,134,165,98,77,109,135,14,51,254,249,124,
+240,67,74,73,73,3,29,15,36,119,121,104,106,2,163,3,92,82,35,54,103,91,35,
+1,219,178,147,1,17,50,143,244,1,2,247,255,0,253,153,2,100,179,157,163,169,
+113,7,175,146,88,121,158,148,35,254,241,1,209,215,153,135,99,161,8,6,230,
+202,188,254,235,254,185,118,128,57,37,79,86,0,0,1,0,80,255,236,6,219,4,94,
+0,63,0,0,1,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,50,54,
+54,51,50,22,51,50,54,53,53,52,38,35,54,51,50,22,21,17,35,17,52,38,35,34,7,
+22,22,21,21,16,6,35,34,38,35,34,6,35,34,38,17,1,152,53,66,50,55,22,2,29,15,
+36,105,101,101,101,87,104,69,86,77,57,73,119,98,104,86,163,145,87,190,167,
+171,80,112,109,46,33,78,75,117,133,100,124,86,87,121,101,135,116,2,148,165,
+123,46,87,127,8,6,234,198,188,254,235,171,179,153,76,139,215,153,179,53,167,
+228,188,245,238,253,133,2,114,151,171,14,64,174,137,77,254,240,230,206,206,
+236,1,10,0,3,0,80,255,236,6,84,4,94,0,57,0,67,0,75,0,0,33,17,52,38,35,34,
+6,21,21,4,4,21,20,6,35,34,36,53,53,34,7,21,20,6,35,34,38,53,52,54,55,53,52,
+38,35,34,6,7,6,35,39,52,54,51,50,22,17,21,54,51,53,52,36,51,50,18,21,17,1,
+20,22,51,50,54,53,52,36,39,5,6,6,21,20,51,50,17,6,4,195,204,219,193,1,32,
+1,68,147,125,153,254,245,72,40,112,111,77,98,169,149,71,77,73,73,3,29,15,
+36,119,121,105,112,40,72,1,5,228,237,245,252,133,222,129,69,92,254,229,229,
+254,240,112,116,89,139,2,100,178,158,152,159,29,15,209,181,103,120,242,191,
+26,4,63,204,188,121,88,144,210,43,74,145,143,99,161,8,6,230,202,194,254,241,
+50,7,44,219,245,254,254,245,253,153,1,151,156,171,50,44,106,142,15,16,27,
+115,79,120,1,29,0,0,1,0,80,255,236,5,243,4,94,0,42,0,0,33,17,16,35,35,17,
+20,2,35,34,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,
+51,50,54,53,17,51,50,22,22,21,17,5,163,149,26,215,214,215,216,53,66,50,55,
+22,2,29,15,36,105,101,101,101,164,186,187,163,47,105,128,55,2,114,1,48,254,
+64,245,254,255,247,237,196,165,123,46,87,127,8,6,234,198,188,254,235,167,
+180,156,162,170,2,106,86,179,200,253,133,0,2,0,80,255,236,6,30,5,150,0,47,
+0,55,0,0,1,17,38,38,53,52,54,51,50,22,23,50,54,55,23,6,6,7,17,20,2,35,34,
+38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,50,54,2,
+22,23,38,38,35,34,21,4,164,144,174,91,79,96,127,5,88,131,10,69,13,164,121,
+215,214,215,216,53,66,50,55,22,2,29,15,36,105,101,101,101,164,186,187,163,
+228,119,109,4,85,55,84,1,226,1,165,21,186,136,85,99,205,153,134,117,43,171,
+205,3,254,93,245,254,255,247,237,196,165,123,46,87,127,8,6,234,198,188,254,
+235,167,180,156,162,3,91,90,9,112,146,83,0,1,0,80,0,0,8,239,4,94,0,75,0,0,
+33,17,16,35,35,17,20,6,6,35,35,17,52,38,35,34,6,7,35,52,38,35,34,6,21,17,
+35,34,38,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,
+51,17,16,54,51,50,23,54,51,50,22,17,17,51,50,54,53,17,51,50,22,22,21,17,8,
+159,149,26,52,129,104,47,104,126,85,121,9,69,129,86,126,105,47,103,129,53,
+53,66,50,55,22,2,29,15,36,105,101,101,101,77,69,26,144,167,183,66,67,183,
+168,142,26,70,76,47,105,128,55,2,114,1,48,254,47,203,175,87,2,104,172,160,
+116,99,84,131,160,172,253,152,86,177,202,195,165,123,46,87,127,8,6,234,198,
+188,254,235,236,121,126,1,190,1,18,228,206,206,228,254,238,254,66,126,121,
+2,171,86,179,200,253,133,0,3,0,80,255,236,6,229,4,94,0,44,0,55,0,73,0,0,1,
+54,51,50,22,21,20,6,35,34,38,39,6,0,35,34,38,53,52,55,23,6,21,20,22,51,50,
+0,55,53,52,18,51,50,22,17,17,35,17,52,38,35,34,6,21,17,22,22,51,50,54,53,
+52,38,35,34,37,39,38,38,35,34,6,7,6,35,39,52,54,51,50,22,23,23,3,137,33,24,
+134,165,98,77,109,135,14,46,254,207,113,102,142,74,62,46,62,59,125,1,22,91,
+238,231,226,245,80,188,202,207,183,3,92,82,35,54,103,91,35,253,249,8,13,51,
+53,70,65,3,29,15,36,122,107,79,84,14,17,1,247,7,175,146,88,121,158,148,33,
+254,239,140,105,92,88,44,63,42,48,58,1,18,49,143,244,1,2,247,255,0,253,153,
+2,100,179,157,163,169,254,222,118,128,57,37,79,86,221,99,173,116,92,168,8,
+6,251,181,157,202,194,0,0,1,0,100,255,236,6,83,4,94,0,58,0,0,19,38,53,52,
+36,33,50,23,7,38,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,32,54,53,17,
+51,50,22,22,21,17,35,17,16,35,35,17,16,33,34,36,53,52,54,55,38,53,52,55,6,
+6,21,20,23,137,37,1,113,1,78,148,102,16,84,150,172,187,184,147,114,114,143,
+188,201,187,1,7,189,47,105,128,55,80,149,26,253,239,231,254,252,91,83,174,
+72,105,111,29,1,215,117,114,203,213,30,154,14,85,76,82,100,78,105,83,88,101,
+161,171,2,106,86,179,200,253,133,2,114,1,48,254,64,254,10,185,160,86,126,
+30,67,167,101,78,41,138,91,109,91,0,0,1,0,80,255,236,7,42,4,94,0,53,0,0,33,
+17,52,38,35,35,17,20,6,35,34,3,2,35,34,38,53,53,52,38,35,34,6,7,6,35,39,52,
+54,51,50,22,21,21,20,22,51,50,18,19,55,51,16,18,51,50,54,53,17,51,50,22,17,
+17,6,218,88,71,46,137,129,226,75,75,226,130,136,57,60,70,65,3,29,15,36,122,
+107,93,93,95,97,117,128,6,2,84,131,122,103,89,67,150,148,2,114,157,147,253,
+248,208,222,1,152,254,104,223,207,249,155,134,92,168,8,6,251,181,215,251,
+213,150,139,1,112,1,84,152,254,58,254,106,149,140,2,149,183,254,230,253,133,
+0,0,1,0,80,0,0,6,64,4,94,0,43,0,0,33,17,52,38,35,34,6,21,21,20,6,6,35,35,
+17,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,17,51,50,54,53,53,52,18,51,
+50,22,17,17,5,240,188,202,207,183,52,129,104,47,53,66,50,55,22,2,29,15,36,
+105,101,101,101,26,70,76,238,231,226,245,2,100,179,157,163,169,151,203,175,
+87,2,148,165,123,46,87,127,8,6,234,198,188,254,235,254,29,126,121,199,244,
+1,2,247,255,0,253,153,0,0,1,0,80,255,236,9,71,4,94,0,70,0,0,33,17,16,35,35,
+17,20,2,35,34,38,53,53,52,38,35,34,6,6,21,17,20,6,35,34,38,53,17,52,38,35,
+34,6,6,7,6,35,39,52,54,51,50,22,17,17,20,22,51,50,53,17,16,54,51,50,22,17,
+21,20,22,51,50,54,53,17,51,50,22,22,21,17,8,247,149,26,215,214,215,216,116,
+144,111,104,45,73,83,89,87,53,66,50,55,22,2,29,15,36,105,101,101,101,40,59,
+73,156,183,184,157,164,186,187,163,47,105,128,55,2,114,1,48,254,64,245,254,
+255,247,237,148,192,144,58,135,139,254,235,197,162,141,202,1,81,165,123,46,
+87,127,8,6,234,198,188,254,235,254,224,145,90,211,1,19,1,19,227,229,254,238,
+129,180,156,162,170,2,106,86,179,200,253,133,0,1,0,80,255,236,5,215,4,94,
+0,50,0,0,33,17,52,38,35,34,7,22,22,21,21,20,2,35,34,38,53,53,52,38,35,34,
+6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,50,54,53,53,52,38,35,54,51,50,
+22,21,17,5,135,112,109,46,33,78,75,215,214,215,216,53,66,50,55,22,2,29,15,
+36,105,101,101,101,164,186,187,163,163,145,87,190,167,171,2,114,151,171,14,
+64,174,137,77,245,254,255,247,237,196,165,123,46,87,127,8,6,234,198,188,254,
+235,167,180,156,162,170,53,167,228,188,245,238,253,133,0,2,0,80,255,205,8,
+59,4,94,0,64,0,80,0,0,37,50,54,53,17,51,50,22,22,21,17,35,17,16,35,35,17,
+20,6,6,35,35,17,52,38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,
+35,39,52,54,51,50,22,17,21,20,22,51,51,17,52,18,51,50,22,17,17,5,3,38,38,
+35,34,6,7,39,54,54,51,50,22,23,19,6,90,70,76,47,105,128,55,80,149,26,52,129,
+104,47,188,202,207,183,47,103,129,53,53,66,50,55,22,2,29,15,36,105,101,101,
+101,77,69,26,238,231,226,245,254,147,42,25,65,55,32,47,11,63,15,100,61,69,
+90,32,52,170,126,121,2,171,86,179,200,253,133,2,114,1,48,254,47,203,175,87,
+2,100,179,157,163,169,253,152,86,177,202,195,165,123,46,87,127,8,6,234,198,
+188,254,235,236,121,126,1,190,244,1,2,247,255,0,254,67,221,1,17,165,123,48,
+44,20,101,141,171,212,254,184,0,0,1,0,80,255,126,5,243,4,94,0,62,0,0,1,52,
+38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,50,55,39,38,38,35,34,
+6,7,39,52,54,51,50,22,23,23,54,53,17,51,50,22,22,21,17,35,17,16,35,35,17,
+16,7,23,7,39,6,35,34,38,53,1,152,53,66,50,55,22,2,29,15,36,105,101,101,101,
+164,186,105,65,48,54,84,47,41,46,2,66,74,66,59,120,71,70,108,47,105,128,55,
+80,149,26,136,70,72,65,95,131,215,216,2,148,165,123,46,87,127,8,6,234,198,
+188,254,235,167,180,156,23,120,136,113,62,51,5,107,172,152,179,173,78,195,
+2,106,86,179,200,253,133,2,114,1,48,254,64,254,233,124,171,38,161,51,247,
+237,0,0,2,0,80,255,236,5,245,4,94,0,52,0,59,0,0,1,6,6,35,34,0,39,21,20,6,
+35,34,38,53,52,54,55,53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,17,21,22,22,
+18,51,50,54,53,17,51,50,22,22,21,17,35,17,16,35,35,1,53,6,21,20,51,50,4,246,
+3,122,119,134,254,250,93,112,111,77,98,178,140,71,77,73,73,3,29,15,36,119,
+121,105,112,80,154,197,55,82,85,47,105,128,55,80,149,26,252,211,228,89,139,
+1,171,236,211,1,113,37,14,204,188,121,88,163,209,8,91,145,143,99,161,8,6,
+230,202,194,254,241,90,18,131,254,248,137,188,2,113,86,179,200,253,133,2,
+114,1,48,253,203,34,5,194,120,0,1,0,80,255,236,9,71,4,94,0,69,0,0,33,17,16,
+35,35,17,20,6,35,34,38,53,17,52,38,35,34,6,21,21,20,6,35,34,2,53,53,52,38,
+35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,50,54,53,53,16,54,51,50,
+22,17,21,20,22,51,50,53,17,51,50,22,22,21,17,8,247,149,26,73,83,89,87,101,
+159,143,117,216,215,214,215,53,66,50,55,22,2,29,15,36,105,101,101,101,163,
+187,186,164,158,183,184,155,40,59,73,47,105,128,55,2,114,1,48,253,177,197,
+162,141,202,1,37,197,135,145,191,148,238,246,1,1,245,178,165,123,46,87,127,
+8,6,234,198,188,254,235,171,171,161,155,181,129,1,19,228,229,254,239,251,
+145,90,211,2,247,86,179,200,253,133,0,3,252,192,4,246,255,156,7,61,0,11,0,
+23,0,35,0,0,0,22,21,20,6,35,34,38,53,52,54,51,2,22,21,20,6,35,34,38,53,52,
+54,51,32,22,21,20,6,35,34,38,53,52,54,51,254,98,75,75,52,54,73,73,54,186,
+75,75,53,54,73,73,54,2,18,75,75,53,53,73,73,53,7,61,75,53,52,75,76,51,52,
+76,254,184,75,52,53,75,76,52,51,76,75,52,53,75,76,52,51,76,0,1,0,0,0,178,
+3,48,4,94,0,29,0,0,17,54,54,51,50,18,21,20,2,35,34,38,53,52,55,23,6,21,20,
+22,51,50,54,53,52,38,35,34,6,7,59,210,119,195,233,206,173,65,104,109,67,43,
+52,40,93,130,174,151,111,166,40,3,82,125,143,254,252,200,219,254,251,74,55,
+125,91,51,43,52,43,43,208,152,139,168,80,74,0,1,252,67,4,246,255,86,7,198,
+0,23,0,0,1,54,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,21,20,
+7,254,162,66,34,160,143,153,171,34,66,50,130,206,191,187,203,130,5,40,95,
+104,74,120,127,129,118,76,103,94,50,160,172,188,200,202,186,170,162,0,2,252,
+67,4,246,255,86,7,198,0,13,0,37,0,0,1,39,38,38,35,34,7,39,54,54,51,50,18,
+23,23,54,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,21,20,7,254,
+50,48,46,38,33,62,10,52,3,66,50,67,123,42,50,66,34,160,143,153,171,34,66,
+50,130,206,191,187,203,130,5,34,106,127,52,87,7,81,135,254,224,102,25,95,
+104,74,120,127,129,118,76,103,94,50,160,172,188,200,202,186,170,162,0,0,1,
+252,244,251,162,255,126,0,30,0,23,0,0,5,6,6,2,21,20,51,50,54,18,53,53,51,
+21,16,2,35,34,38,53,52,0,54,55,254,196,15,118,241,117,93,170,100,80,235,188,
+106,121,1,16,115,21,121,134,240,254,244,85,110,193,1,82,203,254,254,254,104,
+254,26,132,113,125,1,43,233,121,0,1,254,199,251,162,0,78,0,29,0,21,0,0,39,
+6,21,20,30,2,21,20,2,7,39,54,54,53,52,46,2,53,52,55,135,59,105,107,60,170,
+185,36,135,146,74,141,57,100,10,149,87,60,66,54,102,61,135,254,244,146,45,
+107,223,97,54,85,74,60,38,124,240,0,0,1,251,190,251,162,255,126,255,76,0,
+35,0,0,1,39,6,35,34,2,53,17,51,17,16,33,50,55,38,2,35,34,6,7,39,52,54,51,
+50,22,23,23,54,53,17,51,17,16,7,23,254,197,64,104,126,226,255,80,1,144,98,
+73,21,125,72,41,46,2,66,74,66,57,113,80,58,154,80,179,66,251,162,156,46,1,
+1,227,1,88,254,190,254,176,20,50,1,22,62,51,5,107,172,139,192,139,82,201,
+1,70,254,186,254,228,131,159,255,255,251,181,251,162,3,48,4,94,18,34,0,57,
+0,0,16,34,0,62,0,0,16,3,0,128,251,81,0,0,255,255,248,195,251,162,255,126,
+8,141,18,34,0,170,0,0,16,35,0,128,250,187,0,0,16,2,0,70,0,0,255,255,248,195,
+251,162,3,48,8,141,18,34,0,57,0,0,16,34,0,170,0,0,16,35,0,128,250,187,0,0,
+16,2,0,70,0,0,0,1,0,60,251,162,3,122,4,94,0,27,0,0,19,52,18,51,50,18,17,16,
+0,21,20,23,23,7,38,38,53,52,18,18,53,16,33,34,6,7,6,35,60,214,189,206,221,
+254,198,35,9,67,30,47,237,77,254,188,146,178,2,29,15,2,174,173,1,3,254,210,
+254,229,254,139,253,28,233,136,98,32,39,41,210,64,217,2,76,1,111,171,1,152,
+142,118,8,0,0,2,0,60,251,162,3,122,8,114,0,27,0,52,0,0,19,52,18,51,50,18,
+17,16,0,21,20,23,23,7,38,38,53,52,18,18,53,16,33,34,6,7,6,35,19,54,54,53,
+52,46,2,53,52,54,55,7,6,6,21,20,30,3,21,20,6,7,60,214,189,206,221,254,198,
+35,9,67,30,47,237,77,254,188,146,178,2,29,15,176,161,183,153,125,65,216,174,
+7,108,175,55,154,88,46,230,196,2,174,173,1,3,254,210,254,229,254,139,253,
+28,233,136,98,32,39,41,210,64,217,2,76,1,111,171,1,152,142,118,8,2,160,9,
+102,76,47,30,43,110,75,119,179,20,99,14,115,63,38,41,31,47,91,61,128,164,
+16,255,255,0,60,251,162,11,70,4,94,16,34,0,66,0,0,16,35,0,128,3,182,0,0,16,
+3,0,57,8,22,0,0,255,255,0,60,251,162,11,70,8,114,16,34,0,67,0,0,16,35,0,128,
+3,182,0,0,16,3,0,57,8,22,0,0,0,2,249,137,4,246,255,106,8,141,0,15,0,21,0,
+0,1,18,36,51,50,22,23,1,39,1,38,38,35,34,4,7,19,36,39,55,22,19,250,235,187,
+1,82,232,112,209,73,252,230,36,2,97,53,99,64,170,254,195,181,12,254,239,139,
+89,132,234,6,120,1,41,236,122,110,254,183,64,1,4,45,32,194,212,254,159,228,
+174,92,170,254,241,255,255,249,137,0,178,3,48,8,141,16,34,0,70,0,0,16,2,0,
+57,0,0,0,1,253,128,251,162,2,50,8,141,0,28,0,0,1,2,17,16,0,17,52,0,35,34,
+6,3,6,35,39,18,0,33,32,0,17,20,10,2,21,20,22,23,1,24,208,1,114,254,247,221,
+233,241,42,29,15,36,9,1,66,1,6,1,20,1,77,73,211,66,53,91,251,162,1,126,1,
+200,1,135,3,236,1,102,244,1,46,244,255,0,8,6,1,40,1,120,254,113,254,141,236,
+254,82,253,142,254,112,201,120,254,205,0,0,3,0,80,253,248,9,51,4,94,0,99,
+0,109,0,117,0,0,1,21,23,53,52,36,51,50,18,21,21,20,22,51,50,54,53,17,51,50,
+22,22,21,17,35,17,16,35,35,17,20,6,35,34,38,53,53,52,38,35,34,6,21,4,4,21,
+20,6,35,34,36,53,53,38,35,17,20,22,51,50,54,55,23,6,6,35,34,2,53,17,7,21,
+20,6,35,34,38,53,52,54,55,53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,17,21,
+55,53,1,21,20,22,51,50,54,53,52,36,5,53,6,6,21,20,51,50,2,226,121,1,5,228,
+237,245,45,64,38,43,47,105,128,55,80,149,26,88,76,95,91,195,204,203,209,1,
+58,1,42,147,125,153,254,245,39,82,174,145,145,172,17,66,22,207,171,185,214,
+121,112,111,77,98,169,149,71,77,73,73,3,29,15,36,119,121,105,112,121,1,25,
+222,129,69,92,254,229,253,57,112,116,89,139,3,2,155,5,44,219,245,254,254,
+245,250,134,101,88,65,3,49,86,179,200,253,133,2,114,1,48,253,59,111,130,166,
+226,240,178,158,176,169,28,195,177,103,120,242,191,29,3,254,63,155,191,124,
+116,20,189,201,1,16,233,1,202,8,63,204,188,121,88,144,210,43,74,145,143,99,
+161,8,6,230,202,194,254,241,51,11,157,254,179,30,156,171,50,44,106,142,57,
+56,27,115,79,120,0,3,0,80,255,236,13,247,4,94,0,107,0,117,0,125,0,0,33,17,
+16,35,35,17,20,6,35,34,38,53,17,52,38,35,34,6,21,21,20,6,35,34,38,53,53,16,
+33,34,6,21,21,4,4,21,20,6,35,34,36,53,53,34,7,21,20,6,35,34,38,53,52,54,55,
+53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,17,21,54,51,53,52,36,51,50,0,21,
+21,20,22,51,50,54,53,53,16,54,51,50,22,17,21,20,22,51,50,53,17,51,50,22,22,
+21,17,1,20,22,51,50,54,53,52,36,39,5,6,6,21,20,51,50,17,13,167,149,26,73,
+83,89,87,101,159,143,117,226,215,228,229,254,83,219,193,1,32,1,68,147,125,
+153,254,245,72,40,112,111,77,98,169,149,71,77,73,73,3,29,15,36,119,121,105,
+112,40,72,1,5,228,243,1,13,178,200,188,172,158,183,184,155,40,59,73,47,105,
+128,55,244,226,222,129,69,92,254,229,229,254,240,112,116,89,139,2,114,1,48,
+253,177,197,162,141,202,1,37,197,135,145,191,148,237,247,255,247,130,1,80,
+152,159,29,15,209,181,103,120,242,191,26,4,63,204,188,121,88,144,210,43,74,
+145,143,99,161,8,6,230,202,194,254,241,50,7,44,219,245,254,249,240,133,168,
+164,158,178,129,1,19,228,229,254,239,251,145,90,211,2,247,86,179,200,253,
+133,1,151,156,171,50,44,106,142,15,16,27,115,79,120,1,29,0,1,0,80,253,248,
+9,31,4,94,0,96,0,0,33,17,16,35,35,17,20,6,35,34,38,53,53,52,38,35,32,21,20,
+30,2,21,20,4,35,34,39,20,22,51,50,54,55,23,6,6,35,34,2,53,53,38,17,53,52,
+38,35,34,6,7,6,35,39,52,54,51,50,22,21,21,20,23,17,51,17,22,51,50,54,53,52,
+46,3,53,52,36,51,50,0,21,21,20,22,51,50,54,53,17,51,50,22,22,21,17,8,207,
+149,26,88,76,95,91,206,228,254,133,240,122,75,254,234,219,84,65,175,144,145,
+172,17,66,22,207,171,185,214,213,57,60,70,65,3,29,15,36,122,107,93,93,133,
+80,63,86,183,214,77,190,115,55,1,8,215,245,1,13,45,64,38,43,47,105,128,55,
+2,114,1,48,253,59,111,130,166,226,244,165,167,189,81,37,50,123,103,168,217,
+13,153,190,124,116,20,189,201,1,16,233,31,84,1,54,249,155,134,92,168,8,6,
+251,181,215,251,213,179,67,2,65,253,163,15,113,103,57,59,23,56,122,82,151,
+202,254,250,240,251,134,101,88,65,3,49,86,179,200,253,133,0,1,0,80,253,248,
+5,243,4,94,0,61,0,0,1,17,23,50,54,53,17,51,50,22,22,21,17,35,17,16,35,35,
+17,20,2,35,34,39,22,22,51,50,54,55,23,6,6,35,34,2,53,53,36,17,53,52,38,35,
+34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,23,17,3,0,70,187,163,47,105,128,
+55,80,149,26,215,214,37,34,3,171,145,145,172,17,66,22,207,171,185,214,254,
+232,53,66,50,55,22,2,29,15,36,105,101,101,101,96,104,3,2,253,151,3,162,170,
+2,106,86,179,200,253,133,2,114,1,48,254,64,245,254,255,4,147,187,124,116,
+20,189,201,1,16,233,14,76,1,133,196,165,123,46,87,127,8,6,234,198,188,254,
+235,167,142,151,27,2,92,0,1,0,80,253,248,5,215,4,94,0,69,0,0,1,17,23,50,54,
+53,53,52,38,35,54,51,50,22,21,17,35,17,52,38,35,34,7,22,22,21,21,20,2,35,
+34,39,22,22,51,50,54,55,23,6,6,35,34,2,53,53,36,17,53,52,38,35,34,6,6,7,6,
+35,39,52,54,51,50,22,17,21,20,22,23,17,3,0,70,187,163,163,145,87,190,167,
+171,80,112,109,46,33,78,75,215,214,37,34,3,171,145,145,172,17,66,22,207,171,
+185,214,254,232,53,66,50,55,22,2,29,15,36,105,101,101,101,96,104,3,2,253,
+151,3,162,170,53,167,228,188,245,238,253,133,2,114,151,171,14,64,174,137,
+77,245,254,255,4,147,187,124,116,20,189,201,1,16,233,14,76,1,133,196,165,
+123,46,87,127,8,6,234,198,188,254,235,167,142,151,27,2,92,0,2,0,80,253,248,
+5,245,4,94,0,73,0,80,0,0,1,17,23,22,22,51,50,54,53,17,51,50,22,22,21,17,35,
+17,16,35,35,17,16,35,34,38,39,21,20,22,51,50,54,55,23,6,6,35,34,2,53,53,38,
+39,21,20,6,35,34,38,53,52,54,55,53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,
+17,21,22,23,17,3,53,6,21,20,51,50,3,20,68,60,76,31,82,85,47,105,128,55,80,
+149,26,244,57,109,72,174,145,145,172,17,66,22,207,171,185,214,94,77,112,111,
+77,98,178,140,71,77,73,73,3,29,15,36,119,121,105,112,87,84,251,228,89,139,
+3,2,254,125,83,82,68,137,188,2,113,86,179,200,253,133,2,114,1,48,254,9,254,
+65,62,87,133,155,191,124,116,20,189,201,1,16,233,247,122,32,14,204,188,121,
+88,163,209,8,91,145,143,99,161,8,6,230,202,194,254,241,90,20,77,1,48,254,
+107,34,5,194,120,0,2,0,80,255,236,11,48,4,94,0,88,0,95,0,0,33,17,52,38,35,
+35,17,20,6,35,34,3,2,35,34,38,53,53,16,35,35,17,16,35,34,0,39,21,20,6,35,
+34,38,53,52,54,55,53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,17,21,22,22,18,
+51,50,54,53,17,51,50,22,22,21,21,20,22,51,50,18,19,55,51,18,18,22,51,50,54,
+53,17,51,50,22,17,17,1,53,6,21,20,51,50,10,224,88,71,46,137,129,226,75,75,
+226,130,136,149,26,244,134,254,250,93,112,111,77,98,178,140,71,77,73,73,3,
+29,15,36,119,121,105,112,80,154,197,55,82,85,47,105,128,55,95,97,117,128,
+6,2,84,5,64,105,79,103,89,67,150,148,246,153,228,89,139,2,114,157,147,253,
+248,208,222,1,152,254,104,223,207,216,1,48,254,9,254,65,1,113,37,14,204,188,
+121,88,163,209,8,91,145,143,99,161,8,6,230,202,194,254,241,90,18,131,254,
+248,137,188,2,113,86,179,200,196,150,139,1,112,1,84,152,254,124,254,200,160,
+149,140,2,149,183,254,230,253,133,1,109,34,5,194,120,0,0,2,0,120,0,55,3,78,
+3,192,0,11,0,23,0,0,0,22,21,20,6,35,34,38,53,52,18,51,18,54,53,52,38,35,34,
+6,21,20,22,51,2,137,197,197,162,163,204,204,163,115,144,142,121,120,143,144,
+119,3,192,253,204,203,245,248,200,201,1,0,253,33,151,132,132,150,149,133,
+133,150,0,2,0,80,0,0,9,116,5,150,0,80,0,88,0,0,1,6,6,7,17,20,6,6,35,35,17,
+52,38,35,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,6,6,
+7,6,35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,51,50,23,54,51,50,22,
+17,17,51,50,54,53,17,38,38,53,52,54,51,50,22,23,50,54,55,4,22,23,38,38,35,
+34,21,9,116,13,164,121,52,129,104,137,104,126,85,121,9,69,129,86,126,105,
+47,103,129,53,53,66,50,55,22,2,29,15,36,105,101,101,101,77,69,26,144,167,
+183,66,67,183,168,142,116,70,76,144,174,91,79,96,127,5,88,131,10,253,231,
+119,109,4,85,55,84,5,0,171,205,3,254,76,203,175,87,2,104,172,160,116,99,84,
+131,160,172,253,152,86,177,202,195,165,123,46,87,127,8,6,234,198,188,254,
+235,236,121,126,1,190,1,18,228,206,206,228,254,238,254,66,126,121,1,230,21,
+186,136,85,99,205,153,134,117,152,90,9,112,146,83,0,0,2,0,80,251,160,8,42,
+4,94,0,78,0,89,0,0,1,6,6,35,39,2,3,39,55,38,38,36,36,38,53,52,54,51,50,4,
+23,18,17,16,33,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,
+6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,51,50,23,54,51,50,
+18,17,16,3,23,50,55,1,54,55,38,36,35,34,21,20,4,4,8,42,55,154,73,51,65,112,
+80,10,4,195,254,10,254,231,148,204,159,208,2,58,156,63,254,242,85,121,9,69,
+129,86,126,105,47,103,129,53,53,66,50,55,22,2,29,15,36,105,101,101,101,77,
+69,26,144,167,183,66,67,183,179,191,63,21,174,85,254,6,69,39,193,253,152,
+169,201,1,12,2,215,254,80,37,39,1,254,202,254,209,20,32,67,100,114,107,152,
+100,120,168,235,23,1,97,1,47,2,178,116,99,84,131,160,172,253,152,86,177,202,
+195,165,123,46,87,127,8,6,234,198,188,254,235,236,121,126,1,190,1,18,228,
+206,206,254,77,254,97,254,176,254,173,1,47,253,194,238,198,22,187,142,99,
+150,165,0,1,0,80,251,162,7,222,4,94,0,87,0,0,1,17,52,38,35,34,6,21,17,35,
+34,38,53,52,18,0,18,53,52,38,35,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,
+53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,
+51,50,23,54,51,50,22,21,20,2,0,0,6,21,20,22,51,51,53,52,18,51,50,22,17,17,
+7,142,185,205,206,184,47,171,195,197,2,45,198,119,104,85,121,9,69,129,86,
+126,105,47,103,129,53,53,66,50,55,22,2,29,15,36,105,101,101,101,77,69,26,
+144,167,183,66,67,183,153,170,125,254,246,254,90,139,121,86,26,239,230,226,
+245,251,162,1,36,177,161,164,170,254,216,232,210,169,1,51,1,189,1,51,169,
+106,121,116,99,84,131,160,172,253,152,86,177,202,195,165,123,46,87,127,8,
+6,234,198,188,254,235,236,121,126,1,190,1,18,228,206,206,211,193,179,254,
+199,254,235,254,201,212,105,99,166,126,245,1,3,249,255,0,254,217,0,1,0,100,
+255,236,3,172,4,44,0,45,0,0,1,54,54,51,50,22,21,20,7,22,22,21,20,6,35,34,
+0,17,52,54,55,23,6,6,21,20,22,51,50,54,53,52,38,35,35,55,51,54,54,53,52,38,
+35,34,6,7,1,184,34,131,79,88,120,119,80,87,197,163,204,254,236,88,86,77,69,
+82,197,183,139,121,109,106,92,10,77,73,99,74,53,70,90,29,2,214,105,129,111,
+85,151,77,25,114,76,152,189,1,100,1,5,139,242,90,43,77,215,128,221,234,92,
+90,65,78,80,8,83,45,45,54,43,47,0,1,0,100,251,162,4,216,4,186,0,65,0,0,1,
+38,2,53,52,18,17,52,2,35,34,0,21,20,22,51,50,54,53,52,38,35,35,55,51,54,54,
+53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,7,22,22,21,20,6,35,34,0,17,52,
+18,36,51,32,0,17,20,2,21,20,18,23,23,4,149,43,124,124,223,216,207,254,228,
+197,183,139,121,109,106,92,10,77,73,99,74,53,70,90,29,36,34,131,79,88,120,
+119,80,87,197,163,204,254,236,147,1,27,159,1,0,1,29,124,68,54,12,251,162,
+54,1,140,165,247,2,54,1,13,254,1,21,254,233,226,221,234,92,90,65,78,80,8,
+83,45,45,54,43,47,26,105,129,111,85,151,77,25,114,76,152,189,1,100,1,5,175,
+1,18,164,254,178,254,203,195,253,101,218,123,254,229,128,32,0,1,0,120,255,
+232,5,71,4,126,0,34,0,0,5,55,53,52,38,35,34,6,21,21,38,2,53,52,18,36,51,50,
+23,7,38,35,34,0,21,20,23,54,36,51,50,0,21,21,7,4,225,2,232,197,199,230,129,
+144,147,1,27,159,61,66,23,56,46,207,254,228,109,41,1,13,180,236,1,40,1,20,
+32,32,180,207,222,184,49,77,1,45,183,175,1,18,164,11,96,7,254,233,226,240,
+120,188,228,254,202,239,26,25,0,2,0,80,255,236,8,190,5,150,0,73,0,81,0,0,
+1,6,6,7,17,16,6,35,34,38,17,53,52,38,35,34,6,6,21,17,35,34,38,38,53,53,52,
+38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,51,17,16,54,51,50,22,
+17,21,20,22,51,50,54,53,17,38,38,53,52,54,51,50,22,23,50,54,55,5,38,38,35,
+34,21,20,22,8,190,13,164,121,158,183,184,155,116,144,111,104,45,47,103,129,
+53,53,66,50,55,22,2,29,15,36,105,101,101,101,77,69,26,156,183,184,157,101,
+159,143,117,144,174,91,79,96,127,5,88,131,10,254,203,4,85,55,84,119,5,0,171,
+205,3,254,94,254,235,226,229,1,17,130,192,144,58,135,139,253,152,86,177,202,
+195,165,123,46,87,127,8,6,234,198,188,254,235,236,121,126,1,190,1,19,227,
+229,254,238,133,197,135,145,191,1,161,21,186,136,85,99,205,153,134,117,251,
+112,146,83,76,90,0,0,2,0,80,255,236,6,30,5,150,0,47,0,55,0,0,1,6,6,7,17,20,
+2,35,34,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,22,51,
+50,54,53,17,38,38,53,52,54,51,50,22,23,50,54,55,5,38,38,35,34,21,20,22,6,
+30,13,164,121,215,214,215,216,53,66,50,55,22,2,29,15,36,105,101,101,101,164,
+186,187,163,144,174,91,79,96,127,5,88,131,10,254,203,4,85,55,84,119,5,0,171,
+205,3,254,93,245,254,255,247,237,196,165,123,46,87,127,8,6,234,198,188,254,
+235,167,180,156,162,170,1,165,21,186,136,85,99,205,153,134,117,251,112,146,
+83,76,90,0,2,0,80,255,236,7,55,5,150,0,58,0,66,0,0,1,6,6,7,17,20,6,35,34,
+3,2,35,34,38,53,53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,21,21,20,22,51,
+50,18,19,55,51,16,18,51,50,54,53,17,38,38,53,52,54,51,50,22,23,50,54,55,5,
+38,38,35,34,21,20,22,7,55,13,164,121,137,129,226,75,75,226,130,136,57,60,
+70,65,3,29,15,36,122,107,93,93,95,97,117,128,6,2,84,131,122,103,89,144,174,
+91,79,96,127,5,88,131,10,254,203,4,85,55,84,119,5,0,171,205,3,254,21,208,
+222,1,152,254,104,223,207,249,155,134,92,168,8,6,251,181,215,251,213,150,
+139,1,112,1,84,152,254,58,254,106,149,140,1,208,21,186,136,85,99,205,153,
+134,117,251,112,146,83,76,90,0,0,1,0,80,254,192,9,12,4,94,0,75,0,0,1,53,16,
+54,51,50,22,17,17,20,22,51,50,54,54,55,54,51,23,20,6,35,34,38,17,17,52,38,
+35,34,6,21,21,16,6,35,34,38,17,53,52,38,35,34,6,21,21,16,6,35,34,38,53,55,
+50,23,30,2,51,50,54,53,53,16,54,51,50,22,17,21,20,22,51,50,54,5,128,133,158,
+158,131,53,66,54,55,18,2,29,15,36,106,100,101,101,78,132,114,96,133,158,158,
+131,99,111,133,77,102,100,100,106,36,15,29,2,25,54,48,66,53,131,158,159,132,
+78,132,113,97,1,230,129,1,26,221,222,254,232,254,34,165,123,66,106,118,8,
+6,245,217,188,1,21,1,215,188,144,138,198,129,254,228,219,222,1,24,130,201,
+135,143,189,171,254,236,189,216,246,6,8,140,97,53,122,166,178,1,23,223,219,
+254,228,133,188,144,137,0,3,0,80,251,162,9,241,4,94,0,81,0,135,0,142,0,0,
+1,17,38,39,17,20,6,35,34,2,35,34,14,2,35,34,38,53,16,19,23,6,2,21,20,22,51,
+50,54,54,51,50,30,2,51,50,17,17,38,35,34,21,20,22,21,20,6,35,34,38,39,55,
+22,22,51,50,54,53,52,38,53,52,54,51,23,17,51,50,22,22,21,17,22,22,23,7,38,
+38,39,17,1,17,52,38,35,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,53,53,52,
+38,35,34,6,6,7,6,35,39,52,54,51,50,22,17,21,20,51,51,17,16,54,51,50,23,54,
+51,50,22,17,17,23,22,23,17,16,35,35,8,155,76,99,148,144,140,167,97,65,90,
+68,112,68,172,177,156,84,66,74,133,124,69,113,133,81,60,87,72,109,67,220,
+40,41,113,78,131,102,102,173,16,38,25,131,99,68,78,78,122,102,55,47,105,128,
+55,68,118,76,63,39,93,67,253,185,104,126,85,121,9,69,129,86,126,105,47,111,
+122,52,53,66,50,55,22,2,29,15,36,105,101,101,101,146,26,144,167,183,66,67,
+183,168,142,248,94,81,149,26,251,192,3,110,58,25,253,231,219,235,1,52,109,
+121,78,221,203,1,33,1,24,16,99,254,243,129,147,163,78,230,109,124,75,1,31,
+2,36,4,60,32,139,65,93,123,209,145,26,112,118,64,48,39,129,52,84,96,3,4,38,
+86,179,200,252,248,76,223,246,24,129,214,80,252,223,4,164,2,4,172,160,116,
+99,84,131,160,172,253,252,84,158,203,115,165,123,46,87,127,8,6,234,198,188,
+254,235,156,227,1,90,1,18,228,206,206,228,254,238,253,252,77,26,62,2,179,
+1,48,0,0,2,0,50,1,226,2,115,4,215,0,11,0,23,0,0,0,22,21,20,6,35,34,38,53,
+52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,1,217,154,153,132,135,157,159,
+133,95,110,110,99,99,109,110,98,4,215,206,176,173,202,202,173,174,208,253,
+181,110,99,99,109,109,99,98,111,0,0,2,0,130,0,110,3,39,3,194,0,24,0,49,0,
+0,1,6,6,35,34,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,19,
+6,6,35,34,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,3,39,
+51,227,129,114,156,81,70,38,64,18,55,32,49,24,31,100,88,114,165,90,40,51,
+227,129,114,156,81,70,38,64,18,55,32,49,24,31,100,88,114,165,90,3,117,131,
+174,121,95,75,91,40,31,78,29,26,25,38,43,77,123,254,17,131,174,121,95,75,
+91,40,31,78,29,26,25,38,43,77,123,0,0,1,0,80,254,17,3,37,4,176,0,16,0,0,19,
+54,54,51,50,22,22,18,18,23,7,2,0,39,6,6,7,80,32,92,33,37,49,114,150,188,30,
+73,107,254,235,112,24,49,33,3,109,117,206,28,187,254,16,253,0,202,14,2,17,
+3,71,105,6,64,77,0,0,2,0,80,254,17,5,35,4,176,0,16,0,33,0,0,19,54,54,51,50,
+22,22,18,18,23,7,2,0,39,6,6,7,37,54,54,51,50,22,22,18,18,23,7,2,0,39,6,6,
+7,80,32,92,33,37,49,114,150,188,30,73,107,254,235,112,24,49,33,1,204,32,92,
+33,37,49,114,150,188,30,73,117,254,243,110,24,49,33,3,109,117,206,28,187,
+254,16,253,0,202,14,2,17,3,71,105,6,64,77,46,117,206,28,187,254,16,253,0,
+202,14,2,56,3,33,104,6,64,77,0,1,0,100,255,236,3,15,4,94,0,39,0,0,19,22,22,
+51,50,54,53,52,38,35,35,55,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,
+21,20,7,22,22,21,20,6,35,34,38,39,162,6,134,144,112,125,144,127,94,20,44,
+120,102,82,77,64,102,53,41,44,145,91,105,134,119,94,104,192,148,156,177,10,
+1,179,145,140,103,96,91,107,78,88,94,66,75,53,72,27,133,135,162,133,157,66,
+22,145,108,144,201,229,212,0,0,1,0,50,255,236,4,15,4,94,0,29,0,0,19,54,54,
+51,50,0,21,16,2,35,34,38,53,52,55,23,6,21,20,22,51,50,18,53,52,38,35,34,6,
+7,50,72,246,149,231,1,35,246,216,73,116,135,61,51,71,55,119,161,227,192,141,
+209,49,3,38,149,163,254,203,247,254,252,254,190,86,68,130,115,51,53,66,58,
+57,1,9,195,183,211,97,90,0,1,0,60,251,162,3,122,4,94,0,27,0,0,19,52,18,51,
+50,18,17,16,0,21,20,23,23,7,38,38,53,52,18,18,53,16,33,34,6,7,6,35,60,214,
+189,206,221,254,198,35,9,67,30,47,237,77,254,188,146,178,2,29,15,2,174,173,
+1,3,254,210,254,229,254,139,253,28,233,136,98,32,39,41,210,64,217,2,76,1,
+111,171,1,152,142,118,8,0,0,1,0,80,255,196,2,218,4,104,0,23,0,0,1,6,6,2,21,
+20,51,50,54,18,53,17,51,17,16,2,35,34,38,53,52,0,54,55,2,32,16,120,238,117,
+93,170,100,80,235,188,106,121,1,13,117,22,3,209,135,254,254,219,85,110,193,
+1,82,203,1,38,254,218,254,104,254,26,132,113,124,1,70,244,124,0,0,1,0,100,
+255,235,3,134,4,94,0,15,0,0,5,3,38,38,35,34,6,7,39,52,54,51,50,22,19,19,3,
+50,217,77,136,67,61,77,3,80,105,94,81,163,113,246,21,2,29,192,196,108,86,
+7,148,249,207,254,235,253,152,0,0,1,0,80,255,236,4,162,4,110,0,9,0,0,5,36,
+0,0,3,23,18,0,0,23,4,138,254,251,254,29,254,188,14,196,40,1,5,1,123,230,20,
+5,1,72,2,48,1,5,44,254,221,254,32,254,252,19,0,1,0,130,255,236,4,205,4,94,
+0,25,0,0,5,38,2,53,16,0,51,50,0,17,20,2,7,39,54,54,53,52,38,35,34,6,21,20,
+22,23,1,207,156,177,1,47,250,247,1,43,177,153,37,127,140,239,215,202,243,
+144,124,20,58,1,40,210,1,2,1,60,254,194,255,0,201,254,208,59,89,52,250,176,
+189,212,216,185,179,252,44,0,0,2,0,80,255,249,7,53,4,94,0,16,0,23,0,0,1,18,
+0,36,51,50,22,23,1,39,1,38,38,35,34,0,3,19,38,0,39,55,22,1,1,224,175,1,31,
+1,55,181,120,226,65,252,30,37,3,15,53,99,64,214,254,99,228,24,103,254,227,
+82,89,143,1,25,1,157,1,24,1,34,135,128,98,254,36,70,1,129,45,32,254,235,254,
+221,254,125,70,1,28,120,92,192,254,191,0,1,0,130,252,73,2,150,4,131,0,24,
+0,0,1,6,2,21,20,22,23,23,22,22,21,20,2,3,39,54,18,53,52,46,2,53,52,19,1,114,
+34,49,57,62,69,106,81,242,248,42,191,220,98,193,86,138,4,113,112,254,248,
+75,67,101,42,47,74,175,123,255,254,17,254,254,61,203,1,164,183,99,151,133,
+116,72,215,1,197,0,0,1,0,80,251,162,9,235,4,94,0,107,0,0,1,17,16,35,35,17,
+20,6,35,34,46,3,35,34,6,21,17,35,34,38,53,52,18,0,18,53,52,38,35,34,6,7,35,
+52,38,35,34,6,21,17,35,34,38,38,53,53,52,38,35,34,6,6,7,6,35,39,52,54,51,
+50,22,17,21,20,22,51,51,17,16,54,51,50,23,54,51,50,22,21,20,2,0,0,6,21,20,
+22,51,51,53,16,33,50,22,18,22,51,50,54,53,17,51,50,22,22,21,17,9,155,149,
+26,159,155,112,126,76,50,107,95,146,104,47,171,195,197,2,45,198,119,104,85,
+121,9,69,129,86,126,105,47,103,129,53,53,66,50,55,22,2,29,15,36,105,101,101,
+101,77,69,26,144,167,183,66,67,183,153,170,125,254,246,254,90,139,121,86,
+26,1,73,128,147,61,118,116,139,92,47,105,128,55,251,192,6,178,1,48,249,214,
+231,239,111,215,199,93,154,158,254,206,232,210,169,1,51,1,189,1,51,169,106,
+121,116,99,84,131,160,172,253,152,86,177,202,195,165,123,46,87,127,8,6,234,
+198,188,254,235,236,121,126,1,190,1,18,228,206,206,211,193,179,254,199,254,
+235,254,201,212,105,99,166,146,1,216,154,254,173,125,151,149,6,212,86,179,
+200,249,69,0,1,0,80,251,162,2,231,4,94,0,40,0,0,19,51,32,17,52,38,35,34,6,
+7,6,35,39,52,54,51,50,22,21,20,6,7,4,17,20,0,21,20,23,23,7,38,38,53,52,0,
+53,52,38,35,35,202,53,1,87,116,96,104,120,2,29,15,36,157,146,143,172,113,
+100,1,2,254,245,27,7,51,31,52,1,11,220,189,42,1,193,1,16,107,120,135,125,
+8,6,197,235,217,187,92,163,50,108,254,239,242,254,14,150,128,65,24,39,42,
+210,63,245,1,189,208,132,142,0,1,253,149,4,246,255,56,6,178,0,24,0,0,1,38,
+38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,38,53,52,54,51,50,22,23,254,187,
+29,78,29,42,36,72,56,130,43,38,27,125,69,91,107,80,68,52,101,35,5,247,22,
+25,37,26,40,61,66,26,79,101,128,106,92,118,71,79,0,0,1,253,149,253,38,255,
+56,254,226,0,24,0,0,1,38,38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,38,53,
+52,54,51,50,22,23,254,187,29,78,29,42,36,72,56,130,43,38,27,125,69,91,107,
+80,68,52,101,35,254,39,22,25,37,26,40,61,66,26,79,101,128,106,92,118,71,79,
+0,0,1,251,233,4,234,255,102,7,212,0,30,0,0,1,22,23,54,53,52,38,39,7,39,54,
+54,51,50,22,21,20,7,50,55,23,6,7,6,7,39,54,55,35,34,39,252,75,155,151,10,
+42,41,72,35,77,65,19,56,65,16,200,177,26,201,220,15,39,66,16,21,17,190,182,
+6,151,54,13,90,40,70,58,2,62,45,89,52,114,92,85,96,50,65,73,19,86,166,25,
+78,145,50,0,1,251,233,5,226,255,102,6,151,0,10,0,0,1,22,51,50,55,23,6,4,35,
+34,39,252,75,199,192,197,181,26,121,254,225,113,190,182,6,151,70,50,65,44,
+52,50,0,1,251,132,4,236,255,76,7,152,0,13,0,0,1,6,7,22,18,23,7,38,3,2,5,39,
+36,19,253,233,17,36,50,248,110,34,251,196,179,254,238,34,1,50,142,7,152,41,
+72,118,254,195,74,62,151,1,39,254,233,167,62,213,1,130,0,1,251,233,4,234,
+255,102,7,212,0,39,0,0,1,54,54,51,50,22,21,20,7,54,55,23,6,7,22,22,23,7,38,
+39,7,39,54,55,6,6,7,39,54,55,38,39,55,22,23,55,52,38,39,7,252,201,77,65,19,
+56,65,6,201,166,26,175,184,52,157,54,34,162,130,53,66,15,22,61,170,75,34,
+150,119,166,152,98,156,157,3,42,41,72,7,71,89,52,114,92,55,56,2,48,65,64,
+22,75,153,36,62,97,147,246,25,76,148,63,138,46,62,106,149,6,43,131,55,12,
+60,70,58,2,62,0,0,1,251,132,4,236,255,102,7,95,0,20,0,0,1,22,51,50,55,23,
+6,7,22,22,23,7,38,3,2,5,39,54,55,38,39,252,75,199,192,197,181,26,175,197,
+76,193,77,34,250,196,182,254,240,34,218,134,128,123,7,95,70,50,65,64,23,124,
+217,52,62,150,1,40,254,232,166,62,152,237,11,34,0,1,251,227,4,211,255,76,
+7,85,0,10,0,0,1,22,22,23,18,37,23,4,3,38,3,252,88,51,128,93,165,1,53,10,254,
+203,149,254,161,6,247,122,222,89,1,57,214,163,193,254,226,176,1,14,0,3,252,
+143,4,246,255,86,7,193,0,11,0,23,0,35,0,0,0,22,21,20,6,35,34,38,53,52,54,
+51,18,54,53,52,38,35,34,6,21,20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,
+254,133,209,209,145,145,212,211,146,116,157,158,115,115,161,161,115,37,52,
+52,37,37,53,53,37,7,193,215,143,145,212,212,145,143,215,253,136,162,112,113,
+163,161,115,113,161,1,112,53,37,37,53,53,37,37,53,0,0,1,0,60,255,244,4,147,
+4,94,0,18,0,0,1,1,22,21,20,6,35,34,39,1,1,6,35,34,38,53,52,55,1,2,157,1,236,
+10,52,32,40,21,254,102,254,101,23,38,31,53,10,1,236,4,94,252,5,21,19,28,43,
+46,3,84,252,172,46,42,29,19,21,3,251,0,0,2,0,130,255,237,4,16,4,94,0,11,0,
+23,0,0,0,18,17,20,2,35,34,2,53,52,0,51,18,54,53,52,38,35,34,6,21,20,22,51,
+3,21,251,246,204,206,254,1,1,203,158,192,188,165,165,192,192,165,4,94,254,
+197,254,252,255,254,205,1,53,253,250,1,69,252,57,211,185,184,217,219,182,
+180,216,0,0,1,0,20,255,244,4,147,4,151,0,38,0,0,18,23,1,19,51,1,22,21,20,
+6,35,34,39,1,7,23,22,21,20,6,35,34,39,39,1,6,35,34,38,53,52,55,1,1,38,53,
+52,54,51,127,26,1,20,133,107,1,236,10,52,32,40,21,254,102,79,113,25,49,29,
+31,25,74,254,250,23,38,31,53,10,1,33,254,196,23,48,31,4,151,28,254,207,1,
+20,252,5,21,19,28,43,46,3,84,163,124,28,23,33,46,28,81,253,224,46,42,29,19,
+21,2,86,1,92,25,18,37,50,0,0,2,0,70,255,237,4,16,4,151,0,21,0,43,0,0,18,23,
+23,54,51,50,18,17,20,2,35,34,2,53,52,55,39,38,53,52,54,51,0,54,53,52,38,35,
+34,7,1,22,21,20,6,35,34,39,1,6,21,20,22,51,177,26,115,115,157,199,251,246,
+204,206,254,91,128,23,48,31,2,87,192,188,165,93,76,1,26,25,49,29,31,25,254,
+225,74,192,165,4,151,28,127,98,254,197,254,252,255,254,205,1,53,253,208,152,
+142,25,18,37,50,252,0,211,185,184,217,38,254,201,28,23,33,46,28,1,59,104,
+161,180,216,0,0,1,0,80,1,229,4,105,2,143,0,11,0,0,1,50,21,20,6,35,33,34,38,
+53,52,51,4,30,75,39,36,252,125,36,39,75,2,143,87,39,44,45,38,87,0,1,0,100,
+0,0,4,123,4,94,0,16,0,0,55,1,54,51,50,22,21,20,7,1,33,50,21,20,6,35,33,100,
+3,147,23,29,28,52,28,252,219,2,246,75,39,36,252,125,167,3,158,25,48,29,28,
+28,252,209,87,39,44,0,0,1,0,80,0,242,4,105,3,233,0,31,0,0,0,23,1,33,50,21,
+20,6,35,35,23,22,21,20,6,35,34,39,39,33,34,38,53,52,51,33,39,38,53,52,54,
+51,1,147,26,1,34,1,79,75,39,36,180,103,25,49,29,31,25,197,253,252,36,39,75,
+1,105,197,23,48,31,3,233,28,254,194,87,39,44,113,27,24,33,46,28,215,45,38,
+87,216,25,18,37,50,0,1,0,100,0,0,4,123,4,151,0,37,0,0,0,23,1,1,54,51,50,22,
+21,20,7,1,23,22,21,7,20,6,35,34,39,39,1,33,50,21,20,6,35,33,39,1,1,38,53,
+52,54,51,1,41,26,1,101,1,79,23,29,28,52,28,254,175,86,29,1,49,29,32,24,85,
+254,149,2,246,75,39,36,252,125,73,1,219,254,150,23,48,31,4,151,28,254,119,
+1,83,25,48,29,28,28,254,170,93,32,17,6,33,46,28,93,254,145,87,39,44,167,1,
+225,1,141,25,18,37,50,0,0,1,0,200,1,88,2,112,3,0,0,11,0,0,0,22,21,20,6,35,
+34,38,53,52,54,51,1,244,124,123,89,88,124,123,89,3,0,123,89,88,124,123,89,
+88,124,0,0,1,255,220,0,183,0,36,6,131,0,3,0,0,19,17,35,17,36,72,6,131,250,
+52,5,204,0,1,255,37,0,183,0,219,6,131,0,14,0,0,55,35,17,7,39,55,39,55,23,
+55,23,7,23,7,39,36,72,134,49,171,171,49,170,170,49,171,171,49,134,183,4,161,
+136,49,169,168,49,171,171,49,168,169,49,136,0,8,0,100,0,90,4,3,4,64,0,7,0,
+15,0,23,0,31,0,39,0,47,0,55,0,63,0,0,0,51,50,21,20,35,34,53,2,51,50,21,20,
+35,34,53,0,51,50,21,20,35,34,53,36,51,50,21,20,35,34,53,0,51,50,21,20,35,
+34,53,36,51,50,21,20,35,34,53,0,51,50,21,20,35,34,53,36,51,50,21,20,35,34,
+53,1,244,64,63,63,64,10,64,63,63,64,1,154,64,63,63,64,252,224,64,63,63,64,
+2,168,64,63,63,64,253,208,64,63,63,64,2,48,64,63,63,64,253,208,64,63,63,64,
+4,64,64,61,61,252,215,64,61,61,2,5,64,61,61,64,64,61,61,1,78,64,61,61,64,
+64,61,61,254,36,64,61,61,64,64,61,61,0,3,249,222,251,162,255,126,255,118,
+0,51,0,59,0,68,0,0,3,17,52,38,35,34,6,7,22,4,21,20,6,35,34,38,39,35,7,21,
+20,6,35,34,38,53,16,37,52,38,35,34,6,7,6,35,39,52,54,51,50,22,21,54,51,54,
+54,51,50,22,21,17,1,22,22,51,50,53,52,38,37,6,6,21,20,51,50,54,53,210,171,
+183,173,189,13,247,1,17,134,101,160,200,6,56,57,110,113,77,98,1,62,67,81,
+69,58,2,29,15,36,115,105,109,108,33,80,6,244,203,224,213,252,214,6,164,130,
+121,232,254,50,121,107,89,73,66,251,182,1,218,167,149,129,123,13,190,163,
+84,108,213,177,1,17,197,175,121,88,1,23,58,137,127,88,92,8,6,154,198,202,
+221,3,194,226,240,243,254,35,1,111,137,150,64,88,122,11,10,80,75,120,130,
+135,0,0,3,248,48,251,25,0,119,255,118,0,61,0,69,0,78,0,0,19,38,38,35,34,38,
+17,52,38,35,34,6,7,22,4,21,20,6,35,34,38,39,35,7,21,20,6,35,34,38,53,16,37,
+52,38,35,34,6,7,6,35,39,52,54,51,50,22,21,54,51,54,54,51,50,22,21,21,22,22,
+4,22,23,1,22,22,51,50,53,52,38,37,6,6,21,20,51,50,54,53,50,25,151,170,177,
+167,171,183,173,189,13,247,1,17,134,101,160,200,6,56,57,110,113,77,98,1,62,
+67,81,69,58,2,29,15,36,115,105,109,108,33,80,6,244,203,224,213,3,139,1,43,
+208,30,250,47,6,164,130,121,232,254,50,121,107,89,73,66,251,25,74,73,192,
+1,12,191,149,129,123,13,190,163,84,108,213,177,1,17,197,175,121,88,1,23,58,
+137,127,88,92,8,6,154,198,202,221,3,194,226,240,243,53,159,105,2,144,150,
+1,247,137,150,64,88,122,11,10,80,75,120,130,135,0,0,1,249,233,251,182,255,
+126,255,118,0,41,0,0,3,17,52,38,35,34,6,21,17,34,38,38,53,53,52,38,35,34,
+6,7,6,35,39,52,54,51,50,22,22,21,21,20,22,51,17,52,54,51,50,22,21,17,210,
+179,191,194,176,102,126,54,49,70,65,61,2,29,15,36,110,95,73,86,43,68,54,234,
+215,234,217,251,182,1,218,168,148,155,157,254,34,85,174,206,57,157,111,82,
+97,8,6,159,192,83,162,200,98,128,119,1,52,232,250,235,248,254,35,0,0,1,247,
+143,251,162,255,126,255,118,0,83,0,0,1,52,54,54,51,51,17,20,22,51,50,62,2,
+51,50,22,51,50,54,54,38,38,35,54,51,32,17,17,35,17,52,38,35,34,7,22,22,23,
+21,2,6,35,34,38,35,34,6,35,34,38,39,35,17,35,34,6,21,17,34,38,38,53,53,52,
+38,35,34,6,7,6,35,39,52,54,51,50,22,22,21,21,20,22,51,249,160,53,123,112,
+47,64,97,48,80,42,53,46,72,100,98,73,72,23,71,144,101,87,190,1,82,80,109,
+112,46,33,74,74,5,2,97,121,100,103,87,87,103,99,118,98,4,1,26,77,72,102,126,
+54,49,70,65,61,2,29,15,36,110,95,73,86,43,68,54,253,167,202,159,84,254,33,
+172,141,46,88,81,215,82,241,192,107,188,254,49,254,15,1,232,149,163,14,61,
+153,122,16,254,254,196,206,206,186,245,1,105,137,147,254,24,85,174,206,57,
+157,111,82,97,8,6,159,192,83,162,200,98,128,119,0,0,1,249,93,251,162,255,
+126,255,118,0,54,0,0,1,20,22,51,17,16,54,51,50,22,23,54,54,51,50,22,17,17,
+35,17,52,38,35,34,6,7,35,52,38,35,34,6,21,17,34,38,38,53,53,52,38,35,34,6,
+7,6,35,39,52,54,51,50,22,22,21,250,244,68,54,126,155,95,112,32,32,112,96,
+154,126,80,85,105,91,115,9,69,127,88,105,86,102,126,54,49,70,65,61,2,29,15,
+36,110,95,73,86,43,253,87,128,119,1,2,1,50,226,107,99,99,107,226,254,206,
+254,64,1,192,202,160,107,93,83,117,163,199,254,84,85,174,206,57,157,111,82,
+97,8,6,159,192,83,162,200,0,0,2,249,223,251,162,255,126,255,118,0,32,0,42,
+0,0,3,17,52,38,35,34,7,22,22,21,20,6,35,34,38,53,17,51,17,16,33,50,54,53,
+52,38,35,54,51,50,22,21,17,37,54,54,53,17,51,17,20,2,7,210,117,104,46,33,
+68,84,194,170,167,174,80,1,5,152,132,172,135,87,190,167,171,250,97,161,140,
+80,201,180,251,182,1,212,156,176,14,55,203,108,211,229,246,237,1,223,254,
+42,254,190,131,133,154,204,188,245,238,254,35,150,38,213,194,1,91,254,156,
+246,254,193,41,0,0,1,249,222,251,162,255,126,255,118,0,41,0,0,3,20,6,35,32,
+17,52,38,35,34,6,21,21,20,22,51,50,54,55,54,51,23,20,6,35,34,38,38,53,16,
+54,51,50,22,17,16,33,50,54,53,17,51,130,198,192,254,142,148,155,152,145,49,
+70,70,56,2,29,15,36,110,95,74,86,42,203,178,185,194,1,33,168,143,80,253,152,
+248,254,1,231,185,138,155,160,57,157,111,87,92,8,6,159,192,85,161,227,1,0,
+251,230,254,249,254,195,163,169,1,204,0,0,1,250,87,251,162,255,126,255,118,
+0,36,0,0,3,53,52,38,39,22,21,20,4,35,34,38,53,52,0,37,23,6,0,21,20,22,51,
+50,54,53,52,38,35,53,54,54,51,50,22,21,21,210,170,156,65,254,240,233,219,
+254,1,100,1,9,16,239,254,214,188,185,185,220,173,168,61,186,76,213,246,251,
+182,118,136,155,6,57,85,137,156,226,203,199,1,61,35,78,38,254,255,162,132,
+143,80,65,66,71,50,37,45,242,210,112,0,2,252,50,251,162,2,46,6,34,0,51,0,
+61,0,0,1,53,52,38,38,39,39,17,16,6,35,34,38,35,34,6,35,34,38,53,16,55,23,
+6,17,20,22,51,50,54,51,50,22,51,50,54,53,17,38,38,53,52,54,51,50,22,21,21,
+22,22,21,21,1,52,38,35,34,6,21,20,22,23,1,222,55,68,88,57,123,158,100,103,
+87,87,103,99,150,174,149,59,118,134,120,98,106,65,74,110,86,138,83,149,169,
+95,80,112,111,188,160,254,84,67,72,48,41,117,111,2,194,38,93,94,37,15,9,249,
+184,254,229,219,206,206,233,207,1,90,194,60,166,254,232,141,163,215,215,143,
+189,6,88,43,196,129,83,111,178,199,39,20,180,201,47,1,238,136,134,51,54,70,
+103,25,0,1,245,129,251,162,255,126,255,118,0,83,0,0,1,22,22,51,50,54,53,52,
+38,35,34,6,21,20,6,35,17,52,38,35,34,6,7,35,52,38,35,34,6,21,17,34,38,38,
+53,53,52,38,35,34,6,7,6,35,39,52,54,51,50,22,22,21,21,20,22,51,17,16,54,51,
+50,22,23,54,54,51,50,22,17,17,50,54,53,16,18,51,50,22,21,20,6,35,34,39,253,
+121,23,84,34,136,140,182,168,155,171,144,148,85,105,91,115,9,69,127,88,105,
+86,102,126,54,49,70,65,61,2,29,15,36,110,95,73,86,43,68,54,126,155,95,112,
+32,32,112,96,154,126,61,71,215,186,219,236,205,182,110,71,252,29,11,12,206,
+185,152,167,183,190,239,178,1,172,202,160,107,93,83,117,163,199,254,84,85,
+174,206,57,157,111,82,97,8,6,159,192,83,162,200,98,128,119,1,2,1,50,226,107,
+99,99,107,226,254,206,254,254,132,129,1,0,1,17,251,230,244,255,43,0,2,249,
+188,252,24,0,24,255,3,0,34,0,42,0,0,19,6,35,34,39,6,4,35,32,0,17,52,55,23,
+7,20,4,33,50,55,38,53,52,54,51,50,22,21,20,7,22,51,50,54,55,36,21,20,23,54,
+53,52,35,24,114,184,90,94,101,254,242,131,254,243,254,137,11,85,5,1,18,1,
+36,226,150,103,124,89,109,104,118,46,41,90,138,39,253,206,107,129,121,252,
+236,122,44,61,73,1,68,1,25,72,70,12,93,231,241,39,96,144,74,99,89,76,146,
+109,12,55,50,177,88,81,60,55,79,95,0,2,249,154,252,24,255,126,255,13,0,24,
+0,32,0,0,2,22,21,20,6,4,35,32,17,52,55,23,6,21,20,22,4,33,50,55,38,53,52,
+54,51,6,21,20,23,54,53,52,35,234,104,193,254,160,167,252,228,10,85,5,144,
+1,32,1,31,216,160,103,124,89,113,107,129,121,254,134,89,76,130,207,120,2,
+99,68,78,12,42,53,167,215,98,39,96,144,74,99,150,88,81,60,55,79,95,0,0,1,
+250,116,251,162,255,126,255,118,0,44,0,0,5,6,6,21,20,22,51,50,54,51,50,22,
+51,50,54,53,17,51,50,22,22,21,17,35,17,52,38,35,35,17,16,6,35,34,38,35,34,
+6,35,34,2,53,52,54,55,251,83,63,70,77,89,95,106,68,72,100,98,102,58,47,118,
+122,48,80,72,77,26,96,124,100,103,87,87,103,99,107,129,82,82,198,79,215,116,
+176,164,215,215,154,178,1,204,92,157,196,254,15,1,232,146,138,254,222,254,
+218,208,206,206,1,11,240,117,243,113,0,0,1,251,105,251,162,255,126,255,118,
+0,38,0,0,5,22,22,21,20,2,35,34,38,35,34,6,35,34,2,53,52,54,55,23,6,6,21,20,
+22,51,50,54,51,50,22,51,50,54,53,52,38,39,39,254,218,104,60,125,106,100,103,
+87,87,103,99,111,124,90,74,59,64,69,76,89,95,108,66,66,106,98,86,73,61,46,
+24,138,155,201,100,250,254,238,206,206,1,18,250,112,247,97,60,88,213,100,
+185,164,215,215,173,197,84,186,72,38,0,1,248,198,251,160,255,126,255,118,
+0,51,0,0,7,17,20,35,34,38,53,53,52,38,35,34,2,35,34,2,35,34,14,2,35,34,38,
+53,55,50,23,22,22,51,50,62,2,51,50,18,51,50,18,51,50,22,21,21,20,22,51,50,
+53,17,130,144,88,78,74,96,111,93,91,92,99,105,82,103,87,101,76,91,109,36,
+15,29,2,53,67,72,91,67,114,95,119,86,98,100,83,121,129,113,36,48,66,158,253,
+47,241,156,236,133,154,133,254,244,1,12,81,239,75,204,147,6,8,92,87,78,228,
+89,254,244,1,12,215,239,143,127,108,153,2,147,0,1,249,80,251,162,255,126,
+255,118,0,52,0,0,3,17,52,38,35,34,6,21,20,22,22,21,20,6,35,34,38,53,53,52,
+38,35,34,6,7,6,35,39,52,54,51,50,22,22,21,21,20,22,51,50,54,53,52,38,38,53,
+52,54,51,50,22,17,17,210,167,207,157,172,255,112,244,183,229,183,49,70,65,
+61,2,29,15,36,110,95,73,86,43,158,174,147,180,243,124,243,186,240,214,251,
+182,1,202,176,156,99,90,62,31,114,109,116,189,214,216,112,157,111,82,97,8,
+6,159,192,83,162,200,76,156,133,75,61,63,28,111,119,149,204,242,254,252,254,
+54,0,0,1,251,214,251,82,255,126,0,128,0,40,0,0,1,39,6,35,34,0,53,52,54,54,
+55,23,6,4,21,20,22,51,50,55,38,38,35,34,6,7,39,52,54,51,50,18,23,54,53,17,
+51,17,16,7,23,254,234,62,100,139,225,254,250,98,239,43,47,36,254,201,213,
+193,100,75,65,91,54,41,46,2,66,74,66,93,199,8,120,80,142,66,251,82,135,55,
+1,4,224,106,174,180,46,48,58,227,151,159,177,23,141,162,62,51,5,107,172,254,
+90,17,81,193,2,232,253,24,254,240,127,145,0,1,250,233,251,152,255,126,255,
+118,0,28,0,0,3,52,38,35,34,6,7,38,38,53,52,0,51,50,23,7,38,35,34,6,21,20,
+23,54,36,51,50,0,21,230,222,182,185,224,5,131,124,1,64,236,61,66,23,56,46,
+211,247,96,30,1,8,176,234,1,17,251,162,174,207,215,176,78,227,157,245,1,27,
+11,96,7,231,207,175,102,170,216,254,213,244,0,0,1,250,146,251,162,255,126,
+255,118,0,48,0,0,5,6,6,21,20,22,51,50,54,51,50,22,51,50,54,53,52,38,35,54,
+51,32,17,17,35,17,52,38,35,34,7,22,22,21,16,6,35,34,38,35,34,6,35,34,2,53,
+52,54,55,251,113,61,72,78,86,101,102,66,72,100,98,90,70,170,138,87,190,1,
+82,80,109,112,46,33,79,74,99,121,100,103,87,87,103,99,104,130,80,84,198,73,
+223,125,174,155,215,215,119,154,154,195,188,254,49,254,15,1,232,149,163,14,
+65,164,123,254,254,196,206,206,1,17,226,129,234,118,0,2,250,254,251,160,0,
+128,0,28,0,29,0,40,0,0,19,6,6,35,39,2,3,39,55,55,52,38,36,36,38,53,52,54,
+51,50,4,23,54,55,55,6,7,23,50,55,1,54,55,38,36,35,34,21,20,22,4,128,55,154,
+73,44,67,117,80,7,4,131,254,236,254,238,150,204,159,122,1,152,121,41,16,90,
+16,40,13,174,85,254,9,75,43,198,254,97,78,201,182,2,20,254,82,37,39,1,254,
+203,254,206,20,17,16,65,100,85,107,167,117,120,168,228,28,207,207,8,226,207,
+1,47,253,194,243,192,23,187,142,97,149,169,0,1,0,80,255,236,4,161,4,76,0,
+24,0,0,19,22,33,50,54,53,17,51,50,22,22,21,17,35,17,16,35,35,17,20,6,35,34,
+38,39,146,34,1,64,187,163,47,105,128,55,80,149,26,221,218,179,210,22,1,133,
+239,162,170,2,106,86,179,200,253,133,2,114,1,48,254,64,249,253,199,190,0,
+0,2,0,80,255,236,4,204,5,150,0,29,0,37,0,0,1,6,6,7,17,20,6,35,34,38,39,55,
+22,33,50,54,53,17,38,38,53,52,54,51,50,22,23,50,54,55,5,38,38,35,34,21,20,
+22,4,204,13,164,121,221,218,179,210,22,66,34,1,64,187,163,144,174,91,79,96,
+127,5,88,131,10,254,203,4,85,55,84,119,5,0,171,205,3,254,93,249,253,199,190,
+20,239,162,170,1,165,21,186,136,85,99,205,153,134,117,251,112,146,83,76,90,
+0,0,1,248,99,251,160,255,126,255,118,0,66,0,0,3,20,6,35,34,38,53,53,52,38,
+35,34,6,7,35,52,38,35,34,6,21,17,34,38,38,53,53,52,38,35,34,6,7,6,35,39,52,
+54,51,50,22,22,21,21,20,22,51,17,16,54,51,50,22,23,54,54,51,50,22,17,20,22,
+51,50,53,53,51,130,82,72,90,86,85,105,91,115,9,69,127,88,105,86,103,126,53,
+49,70,65,61,2,29,15,36,110,95,73,86,43,68,54,126,155,95,112,32,32,112,96,
+154,126,40,59,71,80,252,145,121,120,149,216,85,202,160,107,93,83,117,163,
+199,254,84,85,178,202,57,157,111,82,97,8,6,159,192,83,162,200,98,128,119,
+1,2,1,50,226,107,99,99,107,226,254,174,178,90,153,89,0,0,2,249,63,251,162,
+255,126,255,118,0,48,0,59,0,0,3,17,52,38,35,34,6,7,54,51,50,22,21,20,6,35,
+34,38,39,6,6,35,34,2,53,52,18,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,
+16,18,51,50,22,17,17,1,22,22,51,50,54,53,52,38,35,34,210,168,181,178,178,
+13,25,30,139,164,108,84,97,136,12,31,255,118,142,176,228,184,82,86,20,75,
+69,150,166,118,103,86,240,72,238,212,223,207,252,224,7,91,79,39,54,103,95,
+35,251,182,1,178,201,155,174,172,6,147,128,85,110,137,109,22,224,1,25,218,
+205,1,0,39,81,34,193,166,159,184,224,37,1,4,1,31,250,254,239,254,75,1,10,
+90,96,46,34,55,64,0,0,1,250,212,251,162,0,50,255,118,0,30,0,0,19,6,4,35,32,
+0,53,52,0,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,4,33,50,36,55,50,
+100,254,115,190,254,217,254,120,1,56,247,154,170,55,48,61,65,132,137,173,
+242,1,77,1,36,148,1,115,89,252,155,102,147,1,29,213,217,1,9,125,110,56,95,
+23,51,46,39,48,55,176,132,157,175,80,69,0,0,1,252,248,251,162,1,209,4,76,
+0,39,0,0,7,20,14,3,21,20,22,51,50,54,53,17,51,50,22,22,21,17,35,17,52,38,
+35,35,17,16,0,35,34,36,53,52,54,36,54,53,53,51,130,81,166,214,105,211,195,
+203,217,47,118,122,48,80,72,77,26,254,253,240,218,254,243,131,1,70,109,80,
+24,96,150,110,99,118,79,132,140,212,200,6,100,92,157,196,249,39,6,208,146,
+138,250,37,254,248,254,227,244,202,117,170,159,125,81,120,0,1,252,28,251,
+162,255,126,0,100,0,19,0,0,5,6,6,21,16,33,50,54,53,17,51,17,20,2,35,34,2,
+53,52,55,253,1,61,77,1,89,179,171,80,222,207,198,239,170,198,71,217,104,254,
+154,176,176,2,184,253,72,252,254,242,1,20,236,245,223,0,1,247,40,251,162,
+255,126,255,118,0,70,0,0,3,17,52,38,35,35,17,20,6,35,32,17,52,38,38,35,34,
+6,21,21,20,6,35,34,38,53,17,52,38,35,34,6,7,6,35,34,39,52,54,51,50,22,22,
+21,21,20,22,51,50,54,53,53,52,54,51,50,22,22,21,16,33,50,54,53,17,51,50,22,
+22,21,17,210,72,77,26,198,192,254,142,44,103,91,121,103,77,78,74,81,49,70,
+65,61,2,29,15,26,30,127,98,73,86,43,35,37,49,29,163,145,112,138,64,1,33,168,
+143,47,118,122,48,251,182,1,232,146,138,254,222,248,254,1,231,153,110,60,
+144,171,103,221,171,122,119,1,45,157,111,82,97,8,6,146,205,83,162,200,232,
+86,67,85,150,116,240,239,98,192,203,254,195,163,169,1,204,92,157,196,254,
+15,0,1,251,214,251,162,255,126,0,128,0,22,0,0,5,6,4,21,20,22,51,50,54,53,
+17,51,17,20,2,35,34,0,53,52,54,54,55,253,129,36,254,201,213,193,194,176,80,
+230,219,225,254,250,98,239,43,176,58,227,151,159,177,166,166,2,232,253,24,
+241,254,251,1,4,224,106,174,180,46,0,0,2,249,233,251,142,255,126,255,118,
+0,41,0,57,0,0,3,17,52,38,35,34,6,21,17,34,38,38,53,53,52,38,35,34,6,7,6,35,
+39,52,54,51,50,22,22,21,21,20,22,51,17,52,54,51,50,22,21,17,5,39,38,38,35,
+34,6,7,39,54,54,51,50,22,23,23,210,179,191,194,176,102,126,54,49,70,65,61,
+2,29,15,36,110,95,73,86,43,68,54,234,215,234,217,254,173,27,25,65,55,32,47,
+11,61,15,100,61,67,90,32,37,251,182,1,218,168,148,155,157,254,34,85,174,206,
+57,157,111,82,97,8,6,159,192,83,162,200,98,128,119,1,52,232,250,235,248,254,
+35,40,177,165,123,48,44,15,101,141,166,212,232,0,1,0,80,255,123,4,161,4,76,
+0,44,0,0,5,39,6,35,34,38,39,55,22,33,50,55,39,38,38,35,34,6,7,39,52,54,51,
+50,22,23,23,54,53,17,51,50,22,22,21,17,35,17,16,35,35,17,20,7,23,3,91,81,
+106,181,179,210,22,66,34,1,64,146,80,37,54,84,47,41,46,2,66,74,66,59,120,
+71,50,61,47,105,128,55,80,149,26,91,92,133,200,87,199,190,20,239,48,92,136,
+113,62,51,5,107,172,152,179,124,80,147,2,106,86,179,200,253,133,2,114,1,48,
+254,64,228,123,226,0,2,252,244,251,162,4,161,4,76,0,24,0,48,0,0,19,22,33,
+50,54,53,17,51,50,22,22,21,17,35,17,16,35,35,17,20,6,35,34,38,39,1,6,6,2,
+21,20,51,50,54,18,53,53,51,21,16,2,35,34,38,53,52,0,54,55,146,34,1,64,187,
+163,47,105,128,55,80,149,26,221,218,179,210,22,254,116,15,118,241,117,93,
+170,100,80,235,188,106,121,1,16,115,21,1,133,239,162,170,2,106,86,179,200,
+253,133,2,114,1,48,254,64,249,253,199,190,254,22,134,240,254,244,85,110,193,
+1,82,203,254,254,254,104,254,26,132,113,125,1,43,233,121,0,1,248,231,251,
+162,255,126,255,118,0,43,0,0,3,17,52,38,35,34,6,21,20,6,35,34,38,17,52,38,
+35,34,6,7,6,35,39,52,54,51,50,22,22,21,20,22,51,50,54,55,53,52,54,51,50,22,
+17,17,210,114,146,141,119,195,186,199,180,49,70,65,61,2,29,15,36,110,95,73,
+86,43,133,167,161,137,2,162,179,180,159,251,182,1,202,197,135,138,187,247,
+238,240,1,26,177,111,82,97,8,6,159,192,84,161,216,188,161,148,171,17,239,
+235,234,254,244,254,54,0,0,3,249,92,250,50,255,126,255,118,0,69,0,77,0,86,
+0,0,1,21,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,7,22,4,21,20,6,35,34,
+38,39,35,17,20,22,51,50,55,23,6,6,35,34,38,53,17,35,7,21,20,6,35,34,38,53,
+16,37,52,38,35,34,6,7,6,35,39,52,54,51,50,22,21,55,53,19,22,22,51,50,53,52,
+38,37,6,6,21,20,51,50,54,53,251,177,83,6,244,203,224,213,80,171,183,173,189,
+13,247,1,17,134,101,160,200,6,83,150,132,224,85,54,34,200,129,169,193,47,
+33,110,113,77,98,1,62,67,81,69,58,2,29,15,36,115,105,109,108,80,243,6,164,
+130,121,232,253,176,121,107,89,73,66,254,76,122,194,226,240,243,254,35,1,
+218,167,149,129,123,13,190,163,84,108,213,177,254,218,141,163,148,20,128,
+160,243,211,1,48,1,17,197,175,121,88,1,23,58,137,127,88,92,8,6,154,198,202,
+221,2,123,254,217,137,150,64,88,122,11,10,80,75,120,130,135,0,0,3,244,222,
+251,162,255,126,255,118,0,76,0,84,0,93,0,0,3,17,52,38,35,34,6,21,20,6,35,
+34,38,39,53,38,38,35,34,6,7,22,4,21,20,6,35,34,38,39,35,7,21,20,6,35,34,38,
+53,16,37,52,38,35,34,6,7,6,35,39,52,54,51,50,22,21,54,51,54,54,51,32,17,20,
+22,51,50,54,55,53,52,54,51,50,22,17,17,1,22,22,51,50,53,52,38,37,6,6,21,20,
+51,50,54,53,210,114,146,141,119,195,186,197,180,2,2,172,180,173,189,13,247,
+1,17,134,101,160,200,6,56,57,110,113,77,98,1,62,67,81,69,58,2,29,15,36,115,
+105,109,108,33,80,6,244,203,1,181,136,164,161,137,2,162,179,180,159,247,214,
+6,164,130,121,232,254,50,121,107,89,73,66,251,182,1,202,197,135,138,187,247,
+238,234,252,16,166,142,129,123,13,190,163,84,108,213,177,1,17,197,175,121,
+88,1,23,58,137,127,88,92,8,6,154,198,202,221,3,194,226,254,33,177,154,148,
+171,17,239,235,234,254,244,254,54,1,111,137,150,64,88,122,11,10,80,75,120,
+130,135,0,1,249,80,250,50,255,126,255,118,0,71,0,0,1,17,22,51,50,54,53,52,
+38,38,53,52,54,51,50,22,17,17,35,17,52,38,35,34,6,21,20,22,22,21,20,6,35,
+34,39,22,22,51,50,55,23,6,6,35,34,38,39,38,38,53,53,52,38,35,34,6,7,6,35,
+39,52,54,51,50,22,22,21,21,20,22,23,17,251,177,55,75,147,180,243,124,243,
+186,240,214,80,167,207,157,172,255,112,244,183,64,57,21,142,110,224,85,54,
+34,200,129,156,190,14,103,101,49,70,65,61,2,29,15,36,110,95,73,86,43,54,68,
+254,6,254,82,12,75,61,63,28,111,119,149,204,242,254,252,254,54,1,202,176,
+156,99,90,62,31,114,109,116,189,9,103,114,148,20,128,160,210,189,39,195,165,
+112,157,111,82,97,8,6,159,192,83,162,200,76,90,126,34,1,147,0,1,0,80,253,
+248,4,161,4,76,0,43,0,0,1,17,23,51,50,54,53,17,51,50,22,22,21,17,35,17,16,
+35,35,17,20,6,35,39,22,22,51,50,54,55,23,6,6,35,34,2,53,53,38,3,55,22,23,
+17,1,192,26,26,187,163,47,105,128,55,80,149,26,221,218,43,5,173,141,145,172,
+17,66,22,207,171,185,214,251,37,66,25,197,3,2,253,149,1,162,170,2,106,86,
+179,200,253,133,2,114,1,48,254,64,249,253,2,152,180,124,116,20,189,201,1,
+16,233,9,62,1,57,20,184,42,2,95,0,0,1,251,214,250,50,0,92,0,128,0,37,0,0,
+1,17,54,54,53,17,51,17,20,2,7,22,22,51,50,55,23,6,6,35,34,38,39,38,2,53,52,
+54,54,55,23,6,4,21,20,22,23,17,253,215,178,165,80,212,200,24,139,108,224,
+85,54,34,200,129,153,185,19,205,233,98,239,43,47,36,254,201,185,168,254,6,
+254,71,5,166,160,2,232,253,24,232,254,254,11,101,108,148,20,128,160,198,172,
+15,1,1,210,106,174,180,46,48,58,227,151,147,176,11,1,184,0,2,252,244,251,
+162,4,161,4,76,0,43,0,67,0,0,1,17,23,51,50,54,53,17,51,50,22,22,21,17,35,
+17,16,35,35,17,20,6,35,39,22,22,51,50,54,55,23,6,6,35,34,2,53,53,38,3,55,
+22,23,17,1,6,6,2,21,20,51,50,54,18,53,53,51,21,16,2,35,34,38,53,52,0,54,55,
+1,192,26,26,187,163,47,105,128,55,80,149,26,221,218,43,5,173,141,145,172,
+17,66,22,207,171,185,214,251,37,66,25,197,253,84,15,118,241,117,93,170,100,
+80,235,188,106,121,1,16,115,21,3,2,253,149,1,162,170,2,106,86,179,200,253,
+133,2,114,1,48,254,64,249,253,2,152,180,124,116,20,189,201,1,16,233,9,62,
+1,57,20,184,42,2,95,252,133,134,240,254,244,85,110,193,1,82,203,254,254,254,
+104,254,26,132,113,125,1,43,233,121,0,2,246,191,251,162,255,126,255,118,0,
+82,0,91,0,0,3,20,6,35,34,38,39,6,6,35,34,38,53,53,52,38,35,35,17,20,6,35,
+34,38,38,39,6,6,35,34,38,53,52,54,55,53,52,38,35,34,6,7,6,35,39,52,54,51,
+50,22,22,21,21,30,3,51,50,54,53,17,51,50,22,22,21,20,22,51,50,19,55,51,23,
+18,18,51,50,54,53,17,51,1,34,6,21,20,22,51,50,54,130,115,121,104,125,42,43,
+125,103,121,115,71,78,26,118,110,64,133,167,51,6,117,100,85,90,180,138,49,
+70,65,61,2,29,15,36,110,95,71,86,45,56,121,123,80,35,75,73,47,106,128,54,
+74,88,210,11,2,84,2,3,111,107,89,73,80,248,136,108,120,40,49,56,83,253,78,
+215,213,176,232,232,176,212,216,60,158,146,254,165,226,219,94,207,13,148,
+166,91,78,135,189,4,61,144,108,82,97,8,6,159,192,81,156,185,67,6,91,156,68,
+133,190,1,213,87,179,219,186,121,2,46,140,151,254,231,254,246,121,166,1,249,
+253,133,86,69,36,36,133,0,2,0,80,252,254,4,161,4,76,0,33,0,58,0,0,5,38,35,
+34,6,21,20,4,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,46,2,53,52,54,
+51,50,22,23,1,22,33,50,54,53,17,51,50,22,22,21,17,35,17,16,35,35,17,20,6,
+35,34,38,39,2,188,59,98,60,82,1,19,154,149,115,109,218,31,38,27,189,84,78,
+121,87,254,88,133,99,67,87,37,253,175,34,1,64,187,163,47,105,128,55,80,149,
+26,221,218,179,210,22,217,37,38,32,48,59,99,88,96,130,138,91,26,42,64,50,
+41,40,54,56,68,49,71,92,26,20,2,23,239,162,170,2,106,86,179,200,253,133,2,
+114,1,48,254,64,249,253,199,190,0,0,1,248,195,251,162,255,126,0,30,0,58,0,
+0,3,20,6,35,34,38,53,52,38,35,34,6,21,21,20,6,35,34,38,53,53,52,38,35,34,
+6,7,6,35,34,39,52,54,51,50,22,17,21,20,22,51,50,54,53,53,16,54,51,50,22,17,
+20,22,51,50,54,53,17,51,130,158,166,172,164,103,127,138,92,88,76,82,84,47,
+52,52,40,2,29,15,6,30,88,83,89,93,33,56,38,43,148,161,170,141,118,141,128,
+113,80,253,140,247,243,226,245,189,138,147,185,225,111,130,142,250,118,152,
+136,92,125,8,6,217,172,194,254,241,118,155,80,88,65,163,1,7,239,213,254,233,
+170,136,159,161,2,146,0,255,255,0,60,251,162,8,77,4,94,16,34,0,66,0,0,16,
+3,0,149,3,172,0,0,255,255,0,60,251,162,8,77,8,114,16,34,0,67,0,0,16,3,0,149,
+3,172,0,0,255,255,0,60,251,162,8,120,5,150,16,34,0,66,0,0,16,3,0,150,3,172,
+0,0,255,255,0,60,251,162,8,120,8,114,16,34,0,67,0,0,16,3,0,150,3,172,0,0,
+255,255,0,60,251,162,8,77,4,94,16,34,0,66,0,0,16,3,0,159,3,172,0,0,255,255,
+0,60,251,162,8,77,8,114,16,34,0,67,0,0,16,3,0,159,3,172,0,0,255,255,0,60,
+251,162,8,77,4,94,16,34,0,66,0,0,16,3,0,165,3,172,0,0,255,255,0,60,251,162,
+8,77,8,114,16,34,0,67,0,0,16,3,0,165,3,172,0,0,255,255,0,60,251,162,8,77,
+4,94,16,34,0,66,0,0,16,3,0,169,3,172,0,0,255,255,0,60,251,162,8,77,8,114,
+16,34,0,67,0,0,16,3,0,169,3,172,0,0,0,2,0,80,254,44,9,89,6,34,0,110,0,120,
+0,0,1,53,52,38,38,39,17,16,6,35,34,38,35,34,6,35,34,38,53,52,54,36,54,53,
+52,38,35,34,6,7,35,52,38,35,34,6,21,17,35,34,38,38,53,52,38,35,34,6,6,7,6,
+35,34,39,52,54,51,50,22,17,20,22,51,51,53,16,54,51,50,23,54,51,50,22,21,20,
+2,7,7,6,6,21,20,22,51,50,62,2,51,50,22,51,50,54,53,17,38,38,53,52,54,51,50,
+22,21,21,22,22,21,21,1,53,52,38,35,34,6,21,20,22,9,9,81,108,79,151,170,100,
+123,87,87,121,101,153,171,184,2,28,181,116,100,85,121,9,69,129,86,126,105,
+47,106,127,52,52,67,50,55,22,2,29,15,6,30,105,101,101,101,77,69,26,141,170,
+183,66,67,183,150,166,208,244,134,201,118,111,95,52,93,64,72,46,73,119,98,
+153,108,149,169,95,80,112,111,179,169,254,84,67,72,48,41,114,2,244,38,75,
+84,27,12,252,66,254,253,243,206,206,198,159,151,210,181,199,144,74,100,116,
+99,84,131,160,172,254,96,83,161,204,177,123,46,87,127,8,6,234,198,188,254,
+202,140,110,246,1,15,231,206,206,185,162,213,254,243,80,44,67,128,90,81,97,
+47,85,83,215,162,170,3,206,43,196,129,83,111,178,199,39,19,162,170,47,1,155,
+33,136,134,51,54,69,104,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,
+0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,
+0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,32,
+0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,9,0,9,
+0,40,1,134,0,3,0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,11,0,62,2,14,0,3,0,1,
+4,9,0,12,0,60,2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,0,1,4,9,0,14,0,52,5,30,
+0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,
+0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,
+0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,
+0,97,0,110,0,115,0,32,0,66,0,97,0,108,0,105,0,110,0,101,0,115,0,101,0,82,
+0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,
+111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,66,0,97,0,108,0,105,0,110,
+0,101,0,115,0,101,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,
+0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,
+66,0,97,0,108,0,105,0,110,0,101,0,115,0,101,0,78,0,111,0,116,0,111,0,32,0,
+105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,
+107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,
+110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,
+109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,
+0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,
+110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,
+0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,
+0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,
+0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,
+0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,
+0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,
+0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,
+105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,
+0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,
+0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,
+0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,
+0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,
+0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,
+0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,
+0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,
+105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,
+44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,
+0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,
+0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,
+103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,
+0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,
+0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,181,0,50,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,
+0,0,0,166,0,0,0,2,0,25,0,0,0,3,0,1,0,4,0,7,0,3,0,8,0,55,0,1,0,56,0,56,0,3,
+0,57,0,57,0,1,0,58,0,62,0,3,0,63,0,63,0,1,0,64,0,64,0,3,0,65,0,69,0,1,0,70,
+0,70,0,3,0,71,0,106,0,1,0,107,0,115,0,3,0,116,0,128,0,1,0,129,0,148,0,3,0,
+149,0,150,0,1,0,151,0,158,0,3,0,159,0,160,0,1,0,161,0,164,0,3,0,165,0,165,
+0,1,0,166,0,166,0,3,0,167,0,167,0,1,0,168,0,168,0,3,0,169,0,169,0,1,0,170,
+0,170,0,3,0,171,0,181,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,54,0,132,0,2,
+68,70,76,84,0,28,98,97,108,105,0,14,0,4,0,0,0,0,255,255,0,2,0,1,0,3,0,4,0,
+0,0,0,255,255,0,3,0,0,0,2,0,4,0,5,100,105,115,116,0,32,109,97,114,107,0,38,
+109,97,114,107,0,50,109,107,109,107,0,62,109,107,109,107,0,70,0,0,0,1,0,0,
+0,0,0,4,0,1,0,2,0,3,0,4,0,0,0,4,0,1,0,2,0,3,0,4,0,0,0,2,0,5,0,6,0,0,0,2,0,
+5,0,6,0,7,0,16,0,24,0,32,0,40,0,48,0,56,0,64,0,2,0,8,0,1,0,56,0,4,0,0,0,1,
+2,98,0,4,0,0,0,1,2,244,0,4,0,0,0,1,3,204,0,4,0,0,0,1,4,84,0,6,0,0,0,1,5,110,
+0,6,0,0,0,1,5,252,0,1,2,28,0,1,0,1,0,41,0,92,0,106,0,120,0,134,0,148,0,162,
+0,176,0,190,0,204,0,218,0,232,0,246,1,4,1,18,1,32,1,46,1,60,1,74,1,88,1,102,
+1,116,1,130,1,144,1,158,1,172,1,186,1,200,1,214,1,60,0,120,1,116,1,228,1,
+214,1,242,2,0,1,46,1,116,1,60,1,228,2,14,0,204,0,2,0,66,3,222,247,29,0,67,
+3,222,247,29,0,2,0,66,3,222,246,244,0,67,3,222,246,244,0,2,0,66,3,222,247,
+67,0,67,3,222,247,67,0,2,0,66,3,222,246,168,0,67,3,222,246,168,0,2,0,66,3,
+222,248,138,0,67,3,222,248,138,0,2,0,66,3,222,249,165,0,67,3,222,249,165,
+0,2,0,66,3,222,247,149,0,67,3,222,247,149,0,2,0,66,3,222,248,248,0,67,3,222,
+248,248,0,2,0,66,3,222,246,87,0,67,3,222,246,87,0,2,0,66,3,222,243,238,0,
+67,3,222,243,238,0,2,0,66,3,222,247,154,0,67,3,222,247,154,0,2,0,66,3,222,
+247,234,0,67,3,222,247,234,0,2,0,66,3,222,248,135,0,67,3,222,248,135,0,2,
+0,66,3,222,249,134,0,67,3,222,249,134,0,2,0,66,3,222,246,59,0,67,3,222,246,
+59,0,2,0,66,3,222,246,95,0,67,3,222,246,95,0,2,0,66,3,222,249,167,0,67,3,
+222,249,167,0,2,0,66,3,222,247,109,0,67,3,222,247,109,0,2,0,66,3,222,248,
+163,0,67,3,222,248,163,0,2,0,66,3,222,249,42,0,67,3,222,249,42,0,2,0,66,3,
+222,249,139,0,67,3,222,249,139,0,2,0,66,3,222,249,226,0,67,3,222,249,226,
+0,2,0,66,3,222,246,143,0,67,3,222,246,143,0,2,0,66,3,222,248,153,0,67,3,222,
+248,153,0,2,0,66,3,222,249,43,0,67,3,222,249,43,0,2,0,66,3,222,248,84,0,67,
+3,222,248,84,0,2,0,66,3,222,249,62,0,67,3,222,249,62,0,2,0,66,3,222,246,55,
+0,67,3,222,246,55,0,2,0,66,3,222,249,137,0,67,3,222,249,137,0,2,0,66,3,222,
+246,75,0,67,3,222,246,75,0,2,0,66,3,222,241,135,0,67,3,222,241,135,0,2,0,
+66,3,222,244,78,0,67,3,222,244,78,0,2,0,3,0,23,0,55,0,0,0,73,0,79,0,33,0,
+181,0,181,0,40,0,1,0,128,0,138,0,2,0,12,0,50,0,9,0,0,4,10,0,1,4,130,0,0,4,
+16,0,0,4,22,0,0,4,28,0,0,4,28,0,0,4,28,0,0,4,28,0,0,4,34,0,19,4,2,4,98,4,
+8,4,104,4,2,4,110,4,14,4,116,4,20,4,98,4,26,4,122,4,32,4,128,4,38,4,134,4,
+44,4,140,4,50,4,146,4,56,4,98,4,62,4,152,4,68,4,98,4,74,4,158,4,74,4,152,
+4,62,4,98,4,2,4,164,4,80,4,98,4,86,4,170,0,2,0,1,0,107,0,115,0,0,0,2,0,2,
+0,97,0,106,0,0,0,116,0,124,0,10,0,1,0,144,0,172,0,1,0,12,0,46,0,8,0,0,4,60,
+0,0,4,60,0,0,4,66,0,0,4,72,0,0,4,78,0,0,4,60,0,0,4,60,0,0,4,84,0,48,4,56,
+4,62,4,56,4,68,4,74,4,80,4,86,4,80,4,92,4,98,4,104,4,110,4,116,4,122,4,128,
+4,134,4,140,4,146,4,152,4,158,4,164,4,170,4,134,4,176,4,152,4,146,4,62,4,
+182,4,92,4,56,4,188,4,194,4,200,4,206,4,212,4,218,4,224,4,230,4,188,4,236,
+6,186,6,192,6,186,6,186,6,186,6,186,6,186,4,92,0,2,0,4,0,4,0,7,0,0,0,56,0,
+56,0,4,0,58,0,59,0,5,0,70,0,70,0,7,0,2,0,8,0,23,0,55,0,0,0,73,0,79,0,33,0,
+149,0,150,0,40,0,159,0,160,0,42,0,165,0,165,0,44,0,167,0,167,0,45,0,169,0,
+169,0,46,0,181,0,181,0,47,0,1,0,112,0,128,0,1,0,12,0,30,0,4,0,0,4,52,0,0,
+4,52,0,0,4,52,0,0,4,52,0,40,4,40,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,
+4,88,4,94,4,100,4,106,4,112,4,118,4,124,4,64,4,130,4,136,4,142,4,148,4,154,
+4,160,4,166,4,142,4,172,4,178,4,184,4,64,4,46,4,148,4,148,4,184,4,190,4,196,
+4,202,4,112,4,208,4,148,4,214,0,2,0,2,0,60,0,62,0,0,0,170,0,170,0,3,0,2,0,
+2,0,23,0,55,0,0,0,73,0,79,0,33,0,1,0,234,1,12,0,1,0,12,0,150,0,34,0,0,4,148,
+0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,
+4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,
+0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,
+4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,0,0,4,148,
+0,0,4,148,0,0,4,148,0,0,4,148,0,41,4,4,4,16,4,22,4,28,4,34,4,40,4,46,4,52,
+4,58,4,64,4,70,4,76,4,82,4,88,4,94,4,100,4,106,4,112,4,118,4,124,4,130,4,
+136,4,142,4,148,4,154,4,160,4,166,4,172,4,106,4,22,4,130,4,178,4,172,4,184,
+4,190,4,196,4,202,4,208,4,214,4,220,4,238,0,2,0,5,0,129,0,148,0,0,0,151,0,
+158,0,20,0,161,0,164,0,28,0,166,0,166,0,32,0,168,0,168,0,33,0,2,0,3,0,23,
+0,55,0,0,0,73,0,79,0,33,0,181,0,181,0,40,0,1,0,100,0,116,0,1,0,12,0,30,0,
+4,0,0,2,130,0,0,2,130,0,0,2,130,0,0,2,130,0,34,3,48,3,48,3,48,3,48,3,48,3,
+48,3,48,3,48,3,54,3,60,3,48,3,48,3,48,3,66,3,48,3,48,3,48,3,48,3,48,3,72,
+3,78,3,48,3,48,3,84,3,48,3,48,3,48,3,48,3,48,3,48,3,48,3,48,3,48,3,48,0,2,
+0,2,0,60,0,62,0,0,0,170,0,170,0,3,0,2,0,5,0,129,0,148,0,0,0,151,0,158,0,20,
+0,161,0,164,0,28,0,166,0,166,0,32,0,168,0,168,0,33,0,1,0,50,0,78,0,1,0,12,
+0,46,0,8,0,0,1,20,0,0,1,20,0,0,1,26,0,0,1,32,0,0,1,38,0,0,1,20,0,0,1,20,0,
+0,1,44,0,1,2,132,0,2,0,4,0,4,0,7,0,0,0,56,0,56,0,4,0,58,0,59,0,5,0,70,0,70,
+0,7,0,1,0,1,0,137,0,1,254,72,4,246,0,1,253,138,4,246,0,1,253,138,5,170,0,
+1,253,108,4,246,0,1,253,248,4,246,0,1,2,18,4,226,0,1,1,204,4,226,0,1,1,43,
+4,226,0,1,0,178,4,226,0,1,2,194,4,226,0,1,3,48,4,226,0,1,1,54,4,226,0,1,4,
+199,4,226,0,1,1,109,4,226,0,1,2,117,4,226,0,1,2,95,4,226,0,1,1,164,4,226,
+0,1,2,73,4,226,0,1,2,161,4,226,0,1,1,131,4,226,0,1,254,42,255,156,0,1,2,148,
+0,0,0,1,3,90,254,212,0,1,1,52,0,0,0,1,1,206,0,0,0,1,2,192,0,0,0,1,3,167,0,
+0,0,1,2,236,254,212,0,1,5,139,252,56,0,1,3,46,254,212,0,1,2,104,0,0,0,1,2,
+82,0,0,0,1,2,27,0,0,0,1,1,184,0,0,0,1,253,218,4,246,0,1,254,212,4,246,0,1,
+254,112,4,246,0,1,254,42,4,246,0,1,253,88,4,246,0,1,6,94,4,246,0,1,4,122,
+4,246,0,1,5,207,4,246,0,1,4,188,4,246,0,1,4,166,4,246,0,1,5,86,4,246,0,1,
+4,177,4,246,0,1,9,151,4,246,0,1,5,185,4,246,0,1,5,97,4,246,0,1,5,163,4,246,
+0,1,4,221,4,246,0,1,7,91,4,246,0,1,7,36,4,246,0,1,4,155,4,246,0,1,6,72,4,
+246,0,1,5,141,4,246,0,1,4,133,4,246,0,1,5,31,4,246,0,1,4,89,5,120,0,1,5,9,
+4,246,0,1,6,149,4,246,0,1,5,42,4,246,0,1,5,53,4,246,0,1,7,124,4,246,0,1,7,
+80,4,246,0,1,11,2,4,246,0,1,7,58,4,246,0,1,4,243,4,246,0,1,4,144,4,246,0,
+1,8,231,4,246,0,1,255,136,0,0,0,1,8,112,0,0,0,1,8,72,0,0,0,1,8,232,0,0,0,
+1,7,5,0,0,0,1,5,230,0,0,0,1,7,247,0,0,0,1,6,144,0,0,0,1,8,12,0,0,0,1,10,40,
+0,0,0,1,7,236,0,0,0,1,7,168,0,0,0,1,6,254,0,0,0,1,5,250,0,0,0,1,9,86,0,0,
+0,1,9,43,0,0,0,1,8,32,0,0,0,1,6,228,0,0,0,1,6,96,0,0,0,1,6,4,0,0,0,1,4,245,
+0,0,0,1,8,244,0,0,0,1,6,239,0,0,0,1,7,49,0,0,0,1,6,74,0,0,0,1,9,87,0,0,0,
+1,9,65,0,0,0,1,14,6,0,0,0,1,9,46,0,0,0,1,5,231,0,0,0,1,11,64,0,0,0,1,0,0,
+6,104,0,1,255,136,252,24,0,1,0,188,252,24,0,1,255,4,252,24,0,1,255,81,252,
+24,0,1,254,149,252,24,0,1,255,113,252,24,0,1,1,214,252,24,0,1,8,227,0,0,0,
+1,0,0,0,0,0,1,9,12,0,0,0,1,8,189,0,0,0,1,9,88,0,0,0,1,7,118,0,0,0,1,6,91,
+0,0,0,1,8,107,0,0,0,1,7,8,0,0,0,1,9,169,0,0,0,1,12,18,0,0,0,1,8,102,254,112,
+0,1,8,22,0,0,0,1,7,121,0,0,0,1,6,122,0,0,0,1,9,197,0,0,0,1,9,161,0,0,0,1,
+6,89,0,0,0,1,8,147,0,0,0,1,7,93,0,0,0,1,6,214,0,0,0,1,6,117,0,0,0,1,6,30,
+0,0,0,1,9,113,0,0,0,1,7,103,0,0,0,1,6,213,0,0,0,1,7,172,0,0,0,1,6,194,0,0,
+0,1,9,201,0,0,0,1,6,119,0,0,0,1,9,181,254,112,0,1,14,121,0,0,0,1,9,161,254,
+112,0,1,6,117,254,112,0,1,6,89,254,112,0,1,6,119,254,112,0,1,11,178,0,0,0,
+1,2,88,4,246,0,1,2,168,5,170,0,1,8,132,254,112,0,0,0,1,0,0,0,10,0,48,0,90,
+0,2,68,70,76,84,0,26,98,97,108,105,0,14,0,4,0,0,0,0,255,255,0,1,0,0,0,4,0,
+0,0,0,255,255,0,1,0,1,0,2,99,99,109,112,0,14,99,99,109,112,0,26,0,0,0,4,0,
+0,0,1,0,2,0,5,0,0,0,6,0,0,0,1,0,2,0,3,0,4,0,5,0,7,0,16,0,24,0,32,0,40,0,48,
+0,56,0,64,0,2,0,0,0,1,0,56,0,4,0,0,0,1,0,126,0,2,0,0,0,1,1,206,0,4,0,0,0,
+1,1,228,0,2,0,0,0,1,2,98,0,6,0,0,0,1,2,186,0,1,0,0,0,1,2,236,0,1,0,56,0,6,
+0,18,0,24,0,30,0,38,0,44,0,50,0,2,0,62,0,57,0,2,0,70,0,170,0,3,0,70,0,170,
+0,57,0,2,0,66,0,57,0,2,0,67,0,57,0,2,0,70,0,57,0,2,0,3,0,63,0,65,0,0,0,68,
+0,69,0,3,0,71,0,71,0,5,0,1,1,82,0,1,0,8,0,41,0,84,0,90,0,96,0,102,0,108,0,
+114,0,120,0,126,0,132,0,138,0,144,0,150,0,156,0,162,0,168,0,174,0,180,0,186,
+0,192,0,198,0,204,0,210,0,216,0,222,0,228,0,234,0,240,0,246,0,252,1,2,1,8,
+1,14,1,20,1,26,1,32,1,38,1,44,1,50,1,56,1,62,1,68,0,129,0,2,0,23,0,130,0,
+2,0,24,0,131,0,2,0,25,0,132,0,2,0,26,0,133,0,2,0,27,0,134,0,2,0,28,0,135,
+0,2,0,29,0,136,0,2,0,30,0,137,0,2,0,31,0,138,0,2,0,32,0,139,0,2,0,33,0,140,
+0,2,0,34,0,141,0,2,0,35,0,142,0,2,0,36,0,143,0,2,0,37,0,144,0,2,0,38,0,145,
+0,2,0,39,0,146,0,2,0,40,0,147,0,2,0,41,0,148,0,2,0,42,0,149,0,2,0,43,0,150,
+0,2,0,44,0,151,0,2,0,45,0,152,0,2,0,46,0,153,0,2,0,47,0,154,0,2,0,48,0,155,
+0,2,0,49,0,156,0,2,0,50,0,157,0,2,0,51,0,158,0,2,0,52,0,159,0,2,0,53,0,161,
+0,2,0,55,0,162,0,2,0,73,0,163,0,2,0,74,0,164,0,2,0,75,0,165,0,2,0,76,0,166,
+0,2,0,77,0,168,0,2,0,79,0,169,0,2,0,15,0,160,0,2,0,54,0,167,0,2,0,78,0,1,
+0,1,0,72,0,1,0,22,0,2,0,10,0,16,0,2,0,60,0,149,0,2,0,60,0,165,0,1,0,2,0,160,
+0,167,0,1,0,106,0,5,0,16,0,34,0,52,0,70,0,88,0,2,0,6,0,12,0,171,0,2,0,66,
+0,172,0,2,0,67,0,2,0,6,0,12,0,173,0,2,0,66,0,174,0,2,0,67,0,2,0,6,0,12,0,
+175,0,2,0,66,0,176,0,2,0,67,0,2,0,6,0,12,0,177,0,2,0,66,0,178,0,2,0,67,0,
+2,0,6,0,12,0,179,0,2,0,66,0,180,0,2,0,67,0,2,0,4,0,149,0,150,0,0,0,159,0,
+159,0,2,0,165,0,165,0,3,0,169,0,169,0,4,0,1,0,86,0,10,0,26,0,32,0,38,0,44,
+0,50,0,56,0,62,0,68,0,74,0,80,0,2,0,66,0,149,0,2,0,67,0,149,0,2,0,66,0,150,
+0,2,0,67,0,150,0,2,0,66,0,159,0,2,0,67,0,159,0,2,0,66,0,165,0,2,0,67,0,165,
+0,2,0,66,0,169,0,2,0,67,0,169,0,2,0,1,0,171,0,180,0,0,0,3,0,0,0,1,0,18,0,
+1,0,24,0,1,0,0,0,6,0,1,0,1,0,31,0,2,0,5,0,129,0,148,0,0,0,151,0,158,0,20,
+0,161,0,164,0,28,0,166,0,166,0,32,0,168,0,168,0,33,0,2,0,8,0,1,0,181,0,1,
+0,1,0,31,};
+#endif
@@ -0,0 +1,5575 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansBamum_Regular_ttf_size = 133764;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansBamum_Regular_ttf");
+asm(".type fz_font_NotoSansBamum_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansBamum_Regular_ttf, 133764");
+asm(".balign 64");
+asm("fz_font_NotoSansBamum_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansBamum-Regular.ttf\"");
+#else
+const int fz_font_NotoSansBamum_Regular_ttf_size = 133764;
+const char fz_font_NotoSansBamum_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,222,3,70,0,2,8,112,0,0,0,42,71,
+80,79,83,43,183,35,170,0,2,8,156,0,0,1,182,71,83,85,66,178,16,174,244,0,2,
+10,84,0,0,0,48,79,83,47,50,125,181,112,206,0,0,1,104,0,0,0,96,99,109,97,112,
+88,208,111,64,0,0,12,28,0,0,0,192,103,97,115,112,0,7,0,7,0,2,8,100,0,0,0,
+12,103,108,121,102,97,10,169,246,0,0,18,8,0,1,240,62,104,101,97,100,9,235,
+205,2,0,0,0,236,0,0,0,54,104,104,101,97,19,175,6,101,0,0,1,36,0,0,0,36,104,
+109,116,120,106,65,37,159,0,0,1,200,0,0,10,84,108,111,99,97,230,91,103,156,
+0,0,12,220,0,0,5,44,109,97,120,112,2,176,1,184,0,0,1,72,0,0,0,32,110,97,109,
+101,139,86,183,248,0,2,2,72,0,0,5,250,112,111,115,116,255,184,0,50,0,2,8,
+68,0,0,0,32,0,1,0,0,0,1,7,174,67,213,241,84,95,15,60,245,0,11,8,0,0,0,0,0,
+205,132,173,177,0,0,0,0,210,40,203,226,0,0,254,123,11,31,8,72,0,0,0,9,0,2,
+0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,11,133,0,0,250,162,11,31,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,149,0,1,0,0,2,149,1,183,0,26,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,155,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,32,2,0,0,0,1,0,0,
+0,0,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,2,88,0,0,0,
+1,0,0,0,0,5,204,8,72,0,0,0,32,0,1,4,205,0,193,0,0,0,0,2,20,0,0,2,20,0,0,5,
+72,0,115,6,37,0,201,4,94,0,113,5,63,0,141,5,168,0,14,4,240,0,199,4,160,0,
+162,4,217,0,37,4,102,0,41,5,205,0,113,5,70,0,41,4,205,0,76,5,74,0,143,4,147,
+0,74,4,100,0,199,4,205,1,25,5,25,0,199,4,102,0,199,4,135,0,0,4,49,0,199,5,
+135,0,33,4,180,0,162,5,238,0,199,5,186,0,51,6,66,0,127,3,215,0,199,4,248,
+0,229,4,242,0,10,5,29,0,139,4,205,0,106,5,238,0,199,4,244,0,115,4,244,0,166,
+4,244,0,166,4,68,0,174,6,41,0,57,5,147,0,199,4,209,0,199,4,141,0,82,4,248,
+0,72,5,92,0,162,4,147,0,78,5,252,0,14,4,129,0,88,3,221,0,88,4,94,0,113,4,
+205,0,0,5,174,0,86,3,184,0,100,4,248,0,229,4,41,0,51,5,111,0,41,5,180,0,166,
+4,41,0,199,4,162,0,199,5,193,0,166,5,190,0,70,4,205,0,76,4,49,0,199,5,53,
+0,199,4,244,0,166,5,88,0,166,4,162,0,199,4,205,0,0,5,25,0,14,7,90,0,92,4,
+63,0,125,4,162,0,162,4,156,0,33,5,41,0,199,3,252,0,102,3,252,0,102,3,236,
+0,123,3,252,0,102,3,252,0,102,4,94,0,76,3,193,0,41,4,94,0,76,4,164,0,41,4,
+100,0,104,0,0,0,74,0,0,0,102,4,244,0,166,2,244,0,70,5,111,0,70,3,252,0,102,
+6,8,0,102,5,168,0,74,5,244,0,102,7,94,0,102,5,233,0,102,4,78,0,102,8,41,0,
+102,5,252,0,102,7,127,0,102,6,55,0,102,5,180,0,102,5,233,0,102,6,41,0,102,
+5,4,0,102,7,25,0,102,5,18,0,102,3,121,0,102,5,197,0,102,6,8,0,102,8,205,0,
+102,7,137,0,102,4,109,0,184,6,150,0,184,5,16,0,102,5,209,0,102,3,221,0,102,
+4,150,0,41,3,143,0,102,5,39,0,102,4,154,0,102,3,102,0,102,6,43,0,102,4,72,
+0,102,6,111,0,102,8,176,0,102,7,244,0,102,4,154,0,184,3,63,0,102,4,221,0,
+102,9,43,0,102,9,106,0,102,4,78,0,102,6,229,0,102,6,80,0,184,5,240,0,102,
+5,145,0,184,4,180,0,102,5,203,0,102,4,76,0,102,5,236,0,102,5,166,0,102,3,
+244,0,184,4,111,0,102,6,160,0,102,3,236,0,102,3,162,0,102,4,225,0,102,4,125,
+0,102,6,246,0,102,5,238,0,102,6,164,0,102,6,70,0,102,5,14,0,102,4,123,0,102,
+5,231,0,102,6,29,0,102,6,70,0,184,9,39,0,102,4,197,0,102,8,86,0,102,5,121,
+0,41,4,221,0,102,6,0,0,102,4,78,0,102,6,29,0,102,3,213,0,61,5,57,0,102,6,
+158,0,102,5,102,0,102,7,43,0,102,6,219,0,102,3,190,0,184,3,113,0,102,4,41,
+0,102,7,72,0,102,4,49,0,184,4,102,0,102,5,94,0,102,5,61,0,184,6,68,0,102,
+6,43,0,102,5,213,0,102,6,82,0,102,7,141,0,102,6,215,0,102,7,76,0,102,7,172,
+0,41,7,37,0,102,5,121,0,41,2,162,0,102,7,16,0,102,7,121,0,102,5,135,0,184,
+4,170,0,102,7,72,0,41,6,86,0,184,6,229,0,102,5,231,0,102,4,35,0,102,8,18,
+0,102,9,14,0,41,5,98,0,102,5,53,0,102,4,102,0,102,4,190,0,102,5,141,0,102,
+4,156,0,102,5,10,0,102,5,182,0,184,6,168,0,102,7,37,0,102,7,188,0,102,7,158,
+0,102,8,104,0,102,6,6,0,102,4,143,0,184,4,238,0,102,6,0,0,102,7,16,0,102,
+5,27,0,102,4,242,0,184,6,4,0,184,5,199,0,102,5,166,0,102,5,229,0,102,8,135,
+0,102,4,4,0,102,5,80,0,102,5,88,0,137,4,37,0,102,6,135,0,102,8,41,0,184,8,
+211,0,102,6,242,0,102,5,217,0,102,4,33,0,102,6,180,0,102,10,125,0,102,7,154,
+0,184,6,158,0,104,3,203,0,102,7,106,0,102,6,219,0,102,7,18,0,102,11,84,0,
+102,10,0,0,184,8,59,0,102,6,115,0,102,4,113,0,184,5,18,0,184,3,88,0,102,3,
+141,0,102,7,186,0,102,6,63,0,184,5,123,0,102,6,231,0,102,5,47,0,102,5,143,
+0,102,4,74,0,184,6,57,0,102,5,254,0,102,6,145,0,184,5,238,0,102,7,12,0,184,
+5,170,0,184,7,166,0,102,5,244,0,102,5,27,0,102,7,88,0,102,5,39,0,184,5,178,
+0,102,4,143,0,102,3,170,0,184,6,215,0,102,6,20,0,102,6,18,0,102,7,199,0,102,
+5,98,0,102,6,152,0,102,5,166,0,102,5,221,0,102,7,96,0,184,7,29,0,102,7,12,
+0,102,6,39,0,102,8,236,0,102,6,90,0,102,4,70,0,184,5,63,0,102,3,154,0,102,
+9,162,0,102,6,188,0,102,7,2,0,102,6,92,0,102,8,18,0,102,7,96,0,102,5,152,
+0,102,5,207,0,184,4,186,0,102,4,43,0,102,7,117,0,102,6,252,0,102,4,121,0,
+102,6,197,0,102,7,172,0,102,5,195,0,184,6,106,0,184,6,84,0,184,8,141,0,104,
+6,45,0,102,4,39,0,102,4,141,0,102,8,123,0,102,6,246,0,102,7,168,0,102,5,74,
+0,184,6,70,0,102,7,154,0,184,3,172,0,102,3,14,0,102,4,164,0,102,7,106,0,102,
+7,76,0,102,6,14,0,102,5,227,0,102,4,188,0,102,5,16,0,102,4,197,0,102,4,143,
+0,102,6,45,0,102,5,63,0,102,6,176,0,184,7,6,0,102,6,57,0,102,6,147,0,102,
+5,209,0,102,6,164,0,102,5,240,0,102,5,197,0,102,5,205,0,102,4,143,0,102,5,
+41,0,102,4,205,0,102,3,188,0,102,4,147,0,102,6,123,0,102,4,70,0,102,5,182,
+0,102,5,39,0,102,4,143,0,102,5,92,0,102,3,233,0,102,6,180,0,102,5,53,0,184,
+7,233,0,102,6,154,0,102,7,231,0,102,4,31,0,102,6,35,0,102,5,227,0,102,5,92,
+0,102,7,172,0,102,4,147,0,102,6,166,0,102,7,47,0,102,5,193,0,102,5,76,0,102,
+7,145,0,102,5,66,0,102,5,238,0,102,5,92,0,98,7,66,0,102,5,31,0,184,5,229,
+0,102,5,129,0,102,7,150,0,102,6,229,0,102,5,59,0,102,6,70,0,102,5,59,0,102,
+5,68,0,102,6,250,0,102,4,156,0,184,3,238,0,102,4,139,0,102,3,238,0,102,5,
+8,0,184,5,158,0,102,5,94,0,184,6,115,0,102,6,193,0,102,7,16,0,102,6,45,0,
+102,5,250,0,102,5,180,0,184,6,53,0,102,4,23,0,102,2,190,0,102,3,190,0,102,
+7,178,0,184,4,188,0,102,4,197,0,102,8,227,0,102,6,100,0,184,5,207,0,102,6,
+27,0,102,5,199,0,184,4,147,0,102,5,215,0,102,6,53,0,102,4,227,0,102,7,41,
+0,102,7,252,0,102,4,63,0,184,7,57,0,102,9,100,0,102,5,174,0,184,5,59,0,184,
+4,147,0,102,4,147,0,102,3,209,0,102,3,229,0,102,8,33,0,102,6,106,0,102,4,
+248,0,102,3,252,0,102,5,129,0,102,3,193,0,184,5,80,0,102,5,25,0,102,4,244,
+0,184,7,43,0,102,6,16,0,102,6,70,0,102,6,199,0,184,4,115,0,102,5,205,0,102,
+6,188,0,102,6,80,0,102,5,6,0,102,6,104,0,102,5,193,0,184,7,115,0,102,8,70,
+0,102,7,55,0,102,7,162,0,104,5,139,0,102,2,254,0,102,7,131,0,102,6,63,0,102,
+6,16,0,102,4,29,0,102,5,41,0,102,4,176,0,102,4,31,0,102,3,168,0,102,6,57,
+0,102,6,133,0,184,3,252,0,184,8,29,0,102,5,86,0,102,5,160,0,102,5,94,0,102,
+4,59,0,102,4,88,0,102,5,10,0,184,11,133,0,102,5,45,0,102,10,106,0,102,6,154,
+0,102,6,57,0,102,5,47,0,102,5,109,0,102,4,217,0,102,3,129,0,102,6,20,0,184,
+4,59,0,184,7,178,0,102,5,121,0,102,6,57,0,102,4,197,0,102,3,104,0,102,7,164,
+0,102,6,4,0,102,6,18,0,102,5,6,0,184,7,250,0,102,3,160,0,102,6,131,0,184,
+6,39,0,102,5,117,0,102,5,248,0,102,5,6,0,184,4,246,0,102,4,229,0,102,5,68,
+0,102,3,72,0,102,3,94,0,102,5,209,0,102,5,164,0,102,5,63,0,104,5,12,0,102,
+6,2,0,102,4,190,0,102,6,193,0,102,4,147,0,102,4,252,0,102,4,211,0,102,8,47,
+0,102,4,127,0,102,6,16,0,102,8,66,0,184,7,72,0,102,4,254,0,102,9,94,0,102,
+3,240,0,102,4,74,0,102,4,135,0,102,5,49,0,102,4,147,0,184,3,244,0,102,6,127,
+0,184,7,80,0,102,6,12,0,102,5,29,0,102,5,6,0,102,6,154,0,102,5,137,0,102,
+7,109,0,102,6,47,0,184,5,209,0,184,6,162,0,102,3,199,0,102,5,88,0,104,7,115,
+0,102,3,125,0,102,4,168,0,102,5,84,0,102,3,205,0,102,4,233,0,102,4,53,0,102,
+4,84,0,102,4,92,0,102,4,203,0,102,5,2,0,102,5,119,0,102,5,94,0,102,6,219,
+0,102,4,244,0,102,6,90,0,102,6,182,0,102,5,68,0,102,6,176,0,102,4,147,0,102,
+4,240,0,184,5,231,0,102,5,236,0,102,6,98,0,102,5,225,0,102,8,164,0,102,5,
+158,0,102,5,37,0,184,3,147,0,184,5,162,0,102,6,55,0,102,4,57,0,102,5,27,0,
+102,4,180,0,184,5,205,0,102,5,170,0,102,5,66,0,102,4,176,0,102,4,123,0,102,
+5,80,0,102,7,92,0,102,5,16,0,102,5,16,0,102,6,12,0,102,6,72,0,102,5,209,0,
+102,5,178,0,102,3,233,0,102,4,92,0,102,6,8,0,102,5,102,0,102,4,219,0,184,
+7,76,0,102,6,139,0,184,3,168,0,102,3,217,0,102,6,57,0,102,3,127,0,184,6,115,
+0,102,6,168,0,102,5,39,0,102,7,109,0,102,4,121,0,102,3,106,0,102,4,59,0,102,
+3,92,0,102,7,150,0,102,4,121,0,102,3,182,0,102,7,162,0,102,5,84,0,102,4,182,
+0,102,3,168,0,102,6,129,0,184,2,246,0,102,6,100,0,102,3,170,0,102,4,199,0,
+102,3,141,0,184,5,6,0,102,4,94,0,102,3,166,0,184,5,55,0,102,6,162,0,98,4,
+182,0,184,4,16,0,184,5,172,0,102,5,43,0,102,6,147,0,180,5,203,0,184,5,227,
+0,102,4,176,0,184,5,86,0,102,5,164,0,102,2,242,0,102,3,166,0,184,3,246,0,
+102,4,150,0,102,4,150,0,102,5,211,0,102,10,61,0,102,6,139,0,184,7,213,0,102,
+4,113,0,102,7,96,0,102,3,131,0,102,4,221,0,102,4,63,0,102,5,47,0,102,5,14,
+0,184,4,104,0,102,4,43,0,184,7,10,0,102,5,209,0,102,5,166,0,102,4,129,0,102,
+3,115,0,102,5,78,0,102,7,88,0,102,4,61,0,102,7,193,0,102,4,129,0,102,4,129,
+0,102,4,25,0,102,4,135,0,102,3,96,0,102,4,102,0,102,0,0,0,2,0,3,0,1,0,0,0,
+20,0,3,0,10,0,0,0,92,0,4,0,72,0,0,0,14,0,8,0,2,0,6,0,0,0,13,0,32,0,160,166,
+247,254,255,255,255,0,0,0,0,0,13,0,32,0,160,166,160,254,255,255,255,0,1,255,
+245,255,227,255,99,89,100,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,
+0,0,100,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,
+0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,166,160,0,0,166,
+247,0,0,0,4,0,0,254,255,0,0,254,255,0,0,0,1,0,1,104,0,0,1,106,56,0,0,0,92,
+0,0,0,21,0,21,0,21,0,21,0,68,0,102,0,156,0,217,1,32,1,81,1,145,1,182,1,209,
+2,26,2,108,2,167,2,237,3,15,3,84,3,134,3,167,3,186,3,225,3,247,4,56,4,91,
+4,142,4,217,5,29,5,49,5,123,5,162,5,222,6,20,6,50,6,96,6,137,6,177,6,204,
+7,3,7,41,7,82,7,129,7,166,7,206,7,229,8,33,8,64,8,150,8,198,8,223,9,32,9,
+68,9,120,9,162,9,223,10,25,10,60,10,81,10,126,10,169,10,210,10,241,11,3,11,
+72,11,138,11,160,11,186,11,218,12,35,12,80,12,101,12,149,12,183,12,220,12,
+254,13,22,13,53,13,91,13,129,13,154,13,203,13,224,14,30,14,52,14,65,14,121,
+14,153,14,211,14,230,15,18,15,60,16,209,17,172,18,45,18,153,19,172,20,128,
+21,123,21,225,22,125,22,235,23,135,23,245,24,118,25,10,25,60,25,198,26,46,
+26,211,27,132,27,204,28,122,28,202,29,107,29,166,29,253,30,88,30,198,31,6,
+31,87,31,175,31,254,32,88,32,209,33,120,33,147,34,2,34,186,35,82,36,62,36,
+139,37,235,38,59,38,161,39,11,39,115,40,6,40,74,40,155,40,242,41,77,41,177,
+42,52,42,115,42,174,42,243,43,48,43,175,43,213,46,34,46,175,46,230,47,67,
+47,128,47,178,48,2,48,66,48,112,49,25,49,154,50,20,50,157,50,211,51,51,52,
+27,52,154,52,203,53,17,53,246,55,130,55,171,56,93,57,5,57,130,57,202,57,227,
+58,113,58,200,60,88,60,163,60,193,61,34,61,144,62,39,62,193,62,254,63,92,
+63,218,63,246,64,68,64,169,65,61,65,148,66,96,67,57,67,244,68,12,68,49,68,
+169,68,223,69,116,69,213,70,101,70,164,71,112,71,172,71,225,72,81,72,242,
+73,225,75,10,75,246,76,205,77,51,77,202,78,98,78,207,79,28,79,76,79,171,80,
+169,81,25,81,157,82,90,84,12,84,90,84,125,84,174,84,220,85,38,86,128,87,136,
+88,33,88,87,88,234,89,92,89,234,90,122,90,228,91,173,92,52,92,206,93,110,
+94,54,94,160,95,180,96,49,96,100,96,162,97,26,97,115,98,7,98,112,98,208,99,
+209,100,78,100,203,101,23,101,53,101,232,102,66,102,130,103,53,103,180,104,
+121,104,185,105,41,106,179,106,251,107,131,107,207,108,102,108,236,109,69,
+110,11,110,196,111,49,111,158,112,30,112,200,113,43,113,196,114,46,114,183,
+116,106,116,183,116,204,117,3,117,90,117,225,118,26,118,145,118,231,119,149,
+120,2,120,89,120,213,121,8,121,89,122,184,123,55,123,117,124,14,125,32,125,
+141,125,236,126,35,127,61,127,200,128,0,128,88,128,203,129,80,129,185,129,
+221,130,90,130,179,131,96,131,140,132,27,133,74,134,99,135,60,135,164,136,
+69,136,181,137,83,137,188,138,84,138,220,139,6,139,85,139,170,140,43,140,
+182,141,74,141,235,142,168,143,11,143,110,144,7,144,114,144,153,145,14,145,
+144,145,218,146,11,146,80,146,253,147,27,147,91,147,187,148,16,148,114,149,
+68,149,230,150,151,151,31,151,92,151,162,152,116,153,23,153,137,153,215,154,
+94,155,23,155,166,156,10,156,111,156,251,158,23,158,86,158,252,159,131,160,
+6,160,139,161,4,161,172,162,13,162,52,162,137,162,183,163,47,163,145,164,
+1,164,38,164,87,164,165,164,230,165,87,165,203,166,56,166,134,166,182,167,
+25,167,85,167,158,168,17,168,66,168,138,168,240,169,146,169,248,170,123,170,
+170,170,211,171,7,171,249,172,43,172,105,172,202,173,28,173,49,173,143,174,
+18,174,86,174,145,174,180,174,227,175,36,175,94,176,5,176,105,176,213,177,
+15,177,252,178,23,178,80,178,139,178,186,179,198,179,241,180,112,180,209,
+181,69,181,213,182,122,183,229,184,45,184,136,184,214,185,57,186,14,186,135,
+187,5,187,75,187,118,188,8,188,105,188,155,188,194,189,29,189,78,189,163,
+189,228,190,25,190,50,190,104,190,154,190,224,191,48,191,115,191,163,191,
+211,191,244,192,165,192,227,193,127,193,221,194,22,194,72,194,122,194,197,
+195,84,195,149,195,202,196,64,196,191,197,17,197,171,197,237,198,84,198,145,
+198,207,198,246,199,107,199,205,199,254,200,52,200,118,200,192,200,228,201,
+8,201,74,201,123,201,199,202,26,202,141,202,220,203,167,203,241,204,63,204,
+118,204,199,204,225,205,107,205,181,206,138,206,177,206,234,207,48,207,117,
+207,201,208,29,208,166,208,220,209,71,209,111,209,187,210,18,210,94,210,149,
+210,202,211,68,211,128,211,183,212,77,212,170,212,207,212,253,213,53,213,
+108,213,201,214,48,214,141,214,200,215,68,215,225,216,29,216,123,216,184,
+216,241,217,64,217,148,217,217,218,18,218,79,218,137,218,206,219,58,219,111,
+219,205,220,19,220,86,220,203,221,76,221,152,221,200,222,25,222,71,222,177,
+222,219,223,43,223,148,223,224,224,58,224,105,224,150,224,242,225,39,225,
+178,225,241,226,48,226,169,226,235,227,41,227,88,227,139,227,207,228,29,228,
+132,228,240,229,77,229,134,229,202,230,103,230,142,230,225,231,33,231,148,
+231,194,232,20,232,110,233,51,233,168,234,6,234,29,234,102,234,251,235,102,
+235,177,235,249,236,85,236,153,236,234,237,34,237,70,237,137,237,190,238,
+15,238,72,238,115,238,143,238,208,239,10,239,76,239,134,239,170,239,195,239,
+243,240,20,240,54,240,80,240,120,240,140,240,207,241,12,241,54,241,90,241,
+129,241,172,241,223,242,9,242,118,242,154,242,202,242,242,243,66,243,115,
+243,160,243,205,244,2,244,57,244,96,244,146,244,224,245,26,245,50,245,150,
+245,198,245,253,246,98,246,148,246,215,247,25,247,84,247,140,247,185,247,
+234,248,31,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,
+3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,0,115,255,236,
+5,49,5,182,0,27,0,0,1,1,7,39,38,38,39,22,18,21,16,33,34,38,53,52,55,51,6,
+21,20,22,51,50,54,53,16,3,3,94,1,211,108,205,21,90,22,54,50,254,60,200,220,
+28,170,18,126,118,139,129,145,5,182,254,58,113,203,20,106,31,151,254,212,
+210,253,154,252,219,109,124,111,106,166,176,214,234,1,176,1,201,0,1,0,201,
+0,0,5,96,5,182,0,17,0,0,19,51,17,20,2,7,51,1,51,17,35,17,52,18,55,35,1,35,
+201,172,10,5,9,3,36,205,172,14,3,9,252,218,205,5,182,252,221,85,254,232,42,
+4,186,250,74,3,27,101,1,21,44,251,63,0,0,4,0,113,255,236,3,238,5,182,0,11,
+0,23,0,27,0,31,0,0,4,2,53,52,18,51,50,18,21,20,2,35,54,54,53,52,38,35,34,
+6,21,20,22,51,1,33,21,33,17,33,21,33,1,99,242,237,211,204,241,242,209,131,
+133,134,128,129,129,131,129,254,207,2,96,253,160,2,96,253,160,20,1,16,229,
+236,1,8,254,242,230,237,254,248,149,179,173,172,176,178,170,171,181,4,64,
+146,1,135,145,0,0,3,0,141,0,0,4,254,5,205,0,13,0,23,0,34,0,0,1,1,35,1,38,
+0,53,52,54,51,50,4,23,19,1,55,38,38,35,34,6,21,20,0,4,22,21,20,6,35,34,38,
+53,52,51,4,231,252,213,211,1,101,168,254,231,150,131,112,1,12,99,143,254,
+146,121,68,236,73,47,58,1,0,2,127,66,68,61,59,66,125,5,182,250,74,2,131,66,
+1,70,167,131,152,157,124,1,2,253,107,217,105,186,59,48,88,254,231,6,73,64,
+64,75,72,67,137,0,2,0,14,255,236,5,180,5,184,0,37,0,49,0,0,36,54,53,52,38,
+35,34,21,21,35,53,52,54,51,50,22,21,20,6,35,32,39,6,6,35,35,53,51,32,18,55,
+51,3,6,21,20,22,51,0,22,21,20,6,35,34,38,53,52,54,51,4,102,152,89,69,149,
+185,179,147,164,184,251,210,254,208,154,55,240,148,84,88,1,54,93,7,184,41,
+12,202,142,254,201,55,58,46,45,62,62,45,129,154,141,96,131,229,33,14,184,
+216,215,174,199,235,245,105,120,160,3,101,69,254,123,134,82,168,196,5,55,
+62,52,54,61,56,59,59,55,0,3,0,199,0,0,4,139,5,182,0,5,0,17,0,29,0,0,1,33,
+17,51,17,33,0,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,
+54,51,4,139,252,60,184,3,12,254,82,55,58,46,45,61,61,45,49,55,58,46,45,61,
+61,45,1,121,4,61,252,101,1,120,62,52,54,61,56,59,59,55,253,82,62,52,54,61,
+56,59,59,55,0,3,0,162,0,0,4,68,5,182,0,17,0,29,0,41,0,0,1,32,22,21,20,4,35,
+33,53,33,50,54,53,52,38,35,33,53,0,22,21,20,6,35,34,38,53,52,54,51,18,22,
+21,20,6,35,34,38,53,52,54,51,2,72,1,4,248,254,251,247,254,90,1,166,167,154,
+152,169,254,90,1,103,57,58,47,45,61,62,44,48,57,58,47,45,61,61,45,4,33,161,
+165,163,165,162,80,86,88,76,162,1,149,60,54,54,61,56,59,59,55,251,47,60,54,
+54,61,56,59,59,55,0,0,1,0,37,0,0,4,213,5,182,0,16,0,0,19,53,33,21,6,3,1,35,
+1,38,39,2,3,35,18,0,19,156,3,190,195,217,2,23,227,254,207,56,51,181,169,211,
+239,1,120,204,5,23,159,88,252,254,170,252,244,1,188,82,88,254,214,254,196,
+1,177,2,84,1,18,0,0,1,0,41,0,0,3,231,5,182,0,12,0,0,1,2,17,20,23,35,38,53,
+16,19,33,53,33,3,231,118,16,182,6,104,252,252,3,190,5,94,253,245,254,32,179,
+192,144,135,2,24,1,232,159,0,0,2,0,113,0,0,5,92,5,205,0,35,0,47,0,0,1,6,6,
+21,20,22,51,50,54,53,52,38,35,34,6,21,20,23,35,38,53,52,54,51,50,18,21,16,
+0,33,32,0,17,52,54,55,0,22,21,20,6,35,34,38,53,52,54,51,1,205,97,71,233,203,
+222,239,106,91,90,98,35,178,33,193,163,179,208,254,165,254,226,254,231,254,
+167,96,113,1,227,55,58,46,45,62,62,45,5,98,128,198,116,206,236,239,234,169,
+199,140,130,156,114,132,138,198,222,254,236,253,254,232,254,180,1,69,1,17,
+141,251,141,251,34,62,52,54,61,56,59,59,55,0,0,4,0,41,0,0,4,238,5,205,0,19,
+0,31,0,43,0,55,0,0,19,22,23,53,52,54,51,50,22,21,20,6,35,34,39,17,35,17,36,
+39,5,22,51,50,54,53,52,38,35,34,6,21,1,20,6,35,34,38,53,52,54,51,50,22,17,
+20,6,35,34,38,53,52,54,51,50,22,113,202,174,195,193,176,209,242,205,61,82,
+183,254,238,174,2,119,61,70,137,139,109,91,108,99,1,104,58,46,45,62,62,45,
+47,57,58,46,45,62,62,45,48,56,4,59,99,42,68,229,246,196,167,169,208,7,253,
+16,3,10,52,110,29,6,122,103,87,108,165,159,252,220,55,60,56,59,59,55,61,1,
+22,54,60,56,58,60,55,62,0,0,3,0,76,0,0,4,164,5,182,0,11,0,23,0,34,0,0,0,22,
+21,20,6,35,34,38,53,52,54,51,0,22,21,20,6,35,34,38,53,52,54,51,3,3,35,19,
+54,55,6,6,5,39,1,1,222,63,59,46,45,61,61,45,2,177,63,63,42,45,61,61,45,145,
+207,188,141,16,48,50,146,254,128,92,2,174,3,125,55,60,53,61,55,59,60,55,1,
+39,55,60,59,56,56,59,60,55,1,18,250,74,3,172,130,200,50,95,242,153,1,170,
+0,2,0,143,0,0,4,248,5,182,0,34,0,46,0,0,0,22,21,20,6,35,34,38,53,55,51,7,
+21,20,22,51,50,54,53,52,38,35,34,6,21,20,19,19,35,3,2,53,16,0,51,36,22,21,
+20,6,35,34,38,53,52,54,51,3,253,251,186,162,149,177,4,182,2,81,69,69,89,152,
+139,168,176,45,45,185,38,50,1,36,247,254,0,55,58,46,45,62,62,45,5,94,234,
+200,174,215,190,172,52,19,28,110,106,130,98,140,155,217,197,172,254,197,254,
+188,1,8,1,74,217,1,10,1,41,88,62,52,54,61,56,59,59,55,0,2,0,74,0,0,3,203,
+5,182,0,8,0,15,0,0,51,53,1,1,53,33,17,51,17,37,37,51,17,33,39,1,74,1,53,254,
+238,2,165,185,253,73,1,78,176,254,142,97,1,13,152,1,139,1,67,154,1,182,250,
+74,160,2,2,186,2,254,199,0,0,3,0,199,0,0,4,8,5,182,0,21,0,33,0,45,0,0,1,50,
+54,53,52,38,35,33,17,51,17,51,32,22,21,20,4,35,35,17,35,17,0,22,21,20,6,35,
+34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,2,12,167,155,152,170,
+254,187,184,141,1,4,248,254,253,249,141,184,1,246,63,63,42,45,61,62,44,42,
+63,63,42,45,61,61,45,2,53,80,86,88,76,2,55,254,107,161,165,162,166,254,109,
+2,53,3,129,55,59,59,56,56,59,59,55,251,47,55,59,59,56,56,59,59,55,0,0,3,1,
+25,0,0,3,246,5,205,0,11,0,15,0,27,0,0,1,22,21,17,35,17,55,1,7,39,38,38,1,
+21,1,53,4,22,21,20,6,35,34,38,53,52,54,51,1,197,12,184,186,2,35,117,233,66,
+72,1,232,253,35,2,46,56,59,45,45,62,62,45,2,182,84,143,254,45,3,27,94,254,
+33,129,198,59,74,3,105,193,254,142,192,84,62,53,53,61,56,58,60,55,0,2,0,199,
+0,0,4,197,5,182,0,6,0,14,0,0,33,35,17,51,1,21,1,1,38,38,37,17,37,54,55,1,
+127,184,159,3,95,252,186,2,119,63,96,254,40,1,111,143,121,5,182,254,142,150,
+254,152,1,182,15,33,194,254,22,152,55,37,0,1,0,199,0,0,4,0,5,182,0,7,0,0,
+1,33,17,35,17,51,17,33,4,0,253,127,184,184,2,129,2,170,253,86,5,182,253,150,
+0,2,0,0,0,0,4,135,5,182,0,8,0,20,0,0,1,1,51,1,17,35,17,1,51,32,22,21,20,6,
+35,34,38,53,52,54,51,2,68,1,125,198,254,25,185,254,25,201,1,174,55,58,46,
+45,62,62,45,2,231,2,207,252,129,253,201,2,47,3,135,62,52,54,61,56,59,59,55,
+0,0,2,0,199,0,0,3,254,5,182,0,5,0,9,0,0,51,17,51,17,33,21,1,17,51,17,199,
+184,2,127,254,98,185,5,182,250,234,160,1,113,4,69,251,187,0,3,0,33,0,0,5,
+53,5,182,0,15,0,27,0,39,0,0,1,54,55,19,51,3,33,21,33,3,35,1,51,19,22,22,36,
+22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,254,
+13,57,219,190,178,2,10,253,203,170,178,254,125,188,219,23,38,2,133,56,58,
+46,45,62,62,45,48,56,58,46,45,62,62,45,1,31,118,220,3,69,253,109,162,253,
+127,5,182,252,174,93,158,174,62,53,54,61,56,59,60,55,2,92,62,53,54,61,56,
+59,60,55,0,1,0,162,0,0,4,18,5,182,0,20,0,0,33,17,38,38,53,17,51,17,20,22,
+51,50,54,53,17,51,17,20,6,7,17,1,254,169,179,182,134,122,138,122,182,180,
+168,2,0,23,214,179,2,22,253,246,133,150,143,140,2,10,253,234,176,213,25,253,
+254,0,0,3,0,199,0,0,5,197,5,182,0,11,0,23,0,31,0,0,0,22,21,20,6,35,34,38,
+53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,3,33,17,51,17,33,17,51,5,141,
+56,58,47,45,61,61,45,48,57,58,47,45,61,61,45,237,252,88,184,2,57,183,4,74,
+63,52,54,61,56,59,60,55,253,245,60,54,54,61,56,59,59,55,253,193,5,182,250,
+236,5,20,0,3,0,51,0,0,5,104,5,182,0,20,0,32,0,44,0,0,1,5,19,35,3,5,39,37,
+3,51,19,37,23,17,54,55,21,6,6,7,39,2,38,53,52,54,51,50,22,21,20,6,35,0,38,
+53,52,54,51,50,22,21,20,6,35,3,145,254,170,140,189,131,254,225,53,1,62,54,
+189,43,1,252,41,122,166,108,162,110,91,111,63,63,42,45,61,61,45,1,125,58,
+57,48,44,62,61,45,4,80,119,252,39,3,154,99,154,108,1,121,254,199,176,117,
+254,148,101,42,194,14,66,76,68,254,176,56,58,60,55,55,60,58,56,3,96,61,54,
+53,61,55,59,59,56,0,0,2,0,127,255,231,5,195,5,205,0,19,0,39,0,0,1,6,6,35,
+32,0,53,52,0,37,23,34,4,21,20,22,51,50,55,55,1,54,54,51,32,0,21,20,0,5,39,
+50,36,53,52,38,35,34,7,7,3,246,109,144,67,254,238,254,219,1,91,1,22,41,196,
+254,228,208,186,115,107,44,254,127,96,147,76,1,18,1,38,254,161,254,238,41,
+192,1,31,209,184,118,104,44,1,213,43,27,1,20,238,249,1,58,9,164,220,171,168,
+197,47,19,1,104,39,31,254,234,236,251,254,200,9,164,219,172,173,192,47,19,
+0,2,0,199,0,0,3,164,5,205,0,3,0,7,0,0,1,17,35,17,53,53,1,21,1,127,184,2,221,
+4,98,251,158,4,98,170,193,254,141,192,0,3,0,229,255,236,4,248,5,205,0,20,
+0,32,0,44,0,0,55,51,32,55,36,36,53,16,37,38,33,35,53,51,32,0,17,16,0,33,35,
+1,7,6,6,21,20,22,23,23,54,53,52,0,38,53,52,54,51,50,22,21,20,6,35,229,60,
+1,83,132,254,254,254,239,2,21,128,254,191,84,80,1,98,1,121,254,120,254,136,
+43,2,78,33,189,181,187,183,33,27,1,18,59,56,48,45,62,62,45,139,211,31,190,
+160,1,61,62,213,162,254,122,254,150,254,147,254,124,3,219,4,22,113,105,89,
+114,20,4,100,137,132,1,1,60,55,53,62,55,60,59,56,0,0,2,0,10,0,0,4,160,5,182,
+0,9,0,21,0,0,1,17,33,17,35,17,33,17,33,21,0,38,53,52,54,51,50,22,21,20,6,
+35,2,197,254,204,184,2,164,1,35,251,169,63,63,42,44,62,61,45,2,18,1,203,252,
+35,4,125,254,53,160,2,191,56,59,59,55,55,59,59,56,0,0,3,0,139,255,236,4,213,
+5,205,0,11,0,23,0,35,0,0,1,1,53,37,54,55,53,38,39,37,53,1,0,22,21,20,6,35,
+34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,4,213,251,182,2,135,
+195,96,104,187,253,121,4,74,253,14,56,58,47,45,61,61,45,49,56,59,46,45,61,
+61,45,2,123,254,96,193,233,69,19,8,25,68,233,193,254,94,2,131,63,52,54,61,
+56,59,60,55,251,4,63,52,53,61,55,59,60,55,0,1,0,106,255,236,4,106,5,182,0,
+32,0,0,1,1,51,3,7,54,51,50,22,21,16,0,33,34,0,53,52,55,23,6,21,20,22,51,50,
+18,53,52,38,35,34,6,7,1,111,1,4,192,131,74,71,108,153,184,254,189,254,252,
+182,254,253,48,176,37,150,124,157,220,114,103,62,104,31,3,80,2,102,254,203,
+166,64,234,176,254,223,254,140,1,1,220,128,109,73,81,120,130,161,1,51,219,
+113,131,59,62,0,1,0,199,0,0,5,39,5,182,0,15,0,0,1,33,17,35,17,33,17,35,17,
+33,17,51,17,33,17,51,3,82,1,213,184,254,227,184,254,45,184,1,27,184,3,76,
+252,180,2,170,253,86,2,170,3,12,253,150,2,106,0,1,0,115,0,0,4,78,5,205,0,
+28,0,0,19,51,38,38,53,52,54,51,50,18,17,20,2,7,35,18,17,16,2,35,34,6,21,20,
+22,51,51,21,33,115,161,48,56,245,187,247,251,61,52,180,111,156,148,115,147,
+145,126,139,253,119,3,76,43,137,74,169,218,254,185,254,173,190,254,71,188,
+1,193,1,114,1,3,1,3,140,112,102,139,162,0,1,0,166,0,0,4,78,5,205,0,22,0,0,
+1,33,17,52,18,51,50,18,17,20,2,7,35,18,17,16,2,35,34,6,21,21,33,2,252,253,
+170,238,210,244,244,61,52,180,111,158,148,128,138,1,160,2,170,1,23,249,1,
+19,254,183,254,175,190,254,71,188,1,193,1,114,1,4,1,2,204,183,106,0,0,1,0,
+166,0,0,4,78,5,205,0,22,0,0,0,2,7,35,18,17,16,2,35,34,6,21,20,23,35,38,53,
+52,18,51,50,18,17,4,78,61,52,180,111,158,148,128,138,43,180,45,238,210,244,
+244,2,117,254,71,188,1,193,1,114,1,4,1,2,204,183,118,148,143,134,249,1,19,
+254,183,254,175,0,3,0,174,0,0,3,242,5,205,0,3,0,7,0,11,0,0,33,35,17,51,19,
+53,37,21,1,53,37,21,1,100,182,182,99,2,43,253,213,2,43,5,182,254,137,173,
+225,172,253,207,172,227,172,0,0,1,0,57,0,0,6,31,5,174,0,28,0,0,1,6,2,3,35,
+3,3,35,7,7,3,35,1,51,19,22,23,51,19,19,51,19,22,23,51,26,2,55,6,31,137,199,
+111,200,121,72,8,22,46,123,204,254,245,187,116,55,17,6,72,119,196,117,51,
+17,6,53,141,196,161,4,203,126,254,9,253,170,1,213,1,47,106,193,254,39,3,193,
+254,63,208,120,1,45,1,220,254,61,193,133,1,123,1,209,1,44,126,0,0,2,0,199,
+0,0,4,238,5,182,0,9,0,17,0,0,1,35,1,17,35,17,51,17,1,51,1,22,4,23,17,6,4,
+7,4,238,103,252,246,182,182,3,10,103,252,143,103,1,184,155,161,254,53,78,
+1,199,1,39,253,18,5,182,254,129,1,41,254,45,21,159,63,1,243,65,166,16,0,2,
+0,199,255,254,4,209,5,182,0,11,0,23,0,0,23,17,51,17,37,17,51,17,35,17,5,17,
+0,22,21,20,6,35,34,38,53,52,54,51,199,184,1,72,184,184,254,184,3,19,63,59,
+46,45,61,61,45,2,4,111,254,110,182,2,37,251,146,1,147,182,253,217,4,125,55,
+60,53,61,55,59,60,55,0,1,0,82,0,0,3,199,5,182,0,29,0,0,19,55,54,54,51,50,
+22,23,51,39,17,51,17,35,52,55,35,6,6,7,39,50,36,53,52,38,35,34,7,7,82,54,
+55,137,73,134,192,55,4,4,185,185,4,4,81,211,146,41,192,1,31,209,184,123,99,
+44,4,23,20,21,28,79,66,155,1,80,250,74,101,108,88,87,3,164,219,172,173,191,
+46,19,0,2,0,72,0,160,4,158,5,182,0,7,0,19,0,0,1,21,1,21,1,21,1,53,36,22,21,
+20,6,35,34,38,53,52,54,51,4,27,252,204,3,183,251,170,3,197,63,63,42,45,61,
+61,45,5,182,200,254,133,9,254,3,205,2,104,203,16,55,59,59,56,56,59,59,55,
+0,2,0,162,0,0,4,186,5,182,0,3,0,21,0,0,1,17,35,17,5,17,35,17,52,38,35,34,
+6,21,17,35,17,52,0,33,50,0,3,10,184,2,104,182,177,161,178,168,182,1,20,1,
+2,245,1,13,3,254,252,2,3,254,59,254,239,1,4,170,193,177,186,254,252,1,17,
+239,1,4,254,252,0,1,0,78,0,0,4,68,5,182,0,9,0,0,33,33,53,1,33,53,33,21,1,
+33,4,68,252,10,3,2,253,22,3,201,252,254,3,23,139,4,135,164,139,251,121,0,
+0,1,0,14,0,2,5,180,5,182,0,39,0,0,0,54,53,52,38,35,34,21,21,35,53,52,54,51,
+50,22,21,20,6,35,34,38,39,2,0,35,35,53,51,50,18,19,19,51,3,6,21,20,22,51,
+4,102,152,89,69,149,185,180,146,164,184,251,210,125,215,65,47,254,255,192,
+84,60,155,186,27,70,184,41,12,202,142,1,238,154,140,97,131,230,32,14,183,
+216,215,174,199,235,97,81,254,255,254,249,160,1,25,1,24,2,227,254,123,134,
+82,166,197,0,0,1,0,88,0,0,4,129,5,182,0,14,0,0,1,33,21,35,3,35,19,54,55,6,
+7,5,39,1,35,1,252,2,133,207,184,189,123,23,41,61,128,254,121,92,2,143,235,
+5,182,145,250,219,3,45,158,172,61,80,246,153,1,152,0,3,0,88,255,236,3,152,
+5,205,0,36,0,48,0,60,0,0,1,32,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,
+7,21,22,22,21,20,6,35,34,39,53,22,51,50,54,53,52,33,35,53,18,22,21,20,6,35,
+34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,139,1,58,140,110,81,
+136,86,68,99,174,98,192,230,205,134,110,242,219,226,141,177,180,138,152,254,
+203,149,243,56,58,47,45,61,61,45,49,56,59,46,45,61,61,45,3,63,125,53,64,28,
+33,133,44,34,132,116,162,53,8,33,113,84,127,145,76,145,74,75,67,145,147,2,
+142,63,52,54,61,56,59,60,55,251,4,63,52,53,61,55,59,60,55,0,0,1,0,113,0,0,
+3,238,5,205,0,30,0,0,19,33,17,51,54,54,53,52,38,35,34,6,7,35,54,54,51,50,
+22,21,20,6,7,21,33,21,33,17,35,17,33,154,1,59,94,121,135,141,121,120,136,
+2,186,2,246,200,197,248,192,165,1,60,254,196,180,254,197,1,184,1,45,5,156,
+136,133,162,158,137,202,245,251,196,173,238,29,158,145,254,217,1,39,0,0,1,
+0,0,0,0,4,205,5,182,0,10,0,0,51,35,1,51,1,35,1,38,39,6,7,195,195,2,10,185,
+2,10,193,254,183,60,33,30,62,5,182,250,74,3,170,171,148,152,171,0,0,3,0,86,
+0,0,5,88,5,182,0,27,0,31,0,35,0,0,1,19,35,3,2,39,35,6,7,3,35,3,38,39,35,6,
+6,3,35,19,51,19,22,23,51,54,55,19,3,35,17,51,1,33,21,33,4,106,238,184,86,
+66,8,8,17,57,113,196,119,20,56,6,9,32,119,186,238,204,121,25,49,8,49,27,113,
+101,182,182,254,113,2,96,253,160,4,199,252,168,1,88,1,3,66,121,172,254,136,
+1,120,62,233,62,144,254,47,3,88,254,137,84,209,208,83,1,121,251,57,1,2,4,
+180,145,0,2,0,100,0,0,3,6,5,182,0,17,0,21,0,0,1,21,35,34,6,21,20,22,51,51,
+21,35,34,36,53,52,36,51,3,35,17,51,3,6,166,167,154,157,164,166,166,247,254,
+251,1,0,252,26,185,185,5,182,162,74,89,87,79,162,165,163,169,156,250,74,2,
+172,0,2,0,229,255,236,4,248,5,205,0,17,0,29,0,0,55,51,32,0,17,16,0,33,35,
+53,51,32,0,17,16,0,33,35,0,38,53,52,54,51,50,22,21,20,6,35,229,60,1,29,1,
+16,254,246,254,245,84,80,1,98,1,121,254,120,254,136,43,3,123,59,56,48,45,
+62,62,45,139,1,38,1,44,1,45,1,33,162,254,122,254,150,254,147,254,124,4,118,
+60,55,53,62,55,60,59,56,0,1,0,51,255,236,3,238,5,203,0,23,0,0,1,54,0,53,52,
+38,35,34,6,7,39,54,51,50,22,21,20,2,7,7,5,21,1,53,1,115,98,1,96,128,107,49,
+78,41,58,90,146,184,226,158,197,145,1,22,253,35,1,137,104,1,134,196,111,135,
+25,20,143,56,212,177,140,254,220,197,146,147,192,1,135,192,0,3,0,41,0,0,4,
+238,5,205,0,22,0,34,0,38,0,0,19,22,22,23,53,52,54,51,50,22,21,20,6,35,34,
+38,39,17,35,17,38,38,39,0,38,35,34,6,21,21,22,51,50,54,53,19,35,17,51,113,
+88,185,103,195,193,177,208,242,205,35,73,35,183,131,233,84,4,14,108,92,108,
+99,61,70,137,139,111,184,184,4,59,43,73,25,68,229,246,198,165,167,210,4,3,
+253,16,3,10,25,84,53,1,19,110,164,160,90,6,122,103,251,150,2,129,0,0,2,0,
+166,0,0,5,14,5,182,0,23,0,35,0,0,1,22,18,21,17,35,17,52,38,39,17,35,17,6,
+6,21,17,35,17,52,18,55,17,51,1,20,6,35,34,38,53,52,54,51,50,22,3,49,237,240,
+188,123,166,184,155,128,184,237,230,184,1,217,58,46,45,62,62,45,47,57,3,143,
+15,254,249,240,254,119,1,139,167,177,15,253,14,2,242,18,168,177,254,121,1,
+129,252,1,1,17,2,39,254,236,55,60,56,59,59,55,61,0,0,1,0,199,0,0,3,164,5,
+182,0,17,0,0,1,22,21,17,20,7,55,54,37,21,1,35,17,51,1,21,37,38,1,123,4,4,
+46,23,1,228,253,141,106,106,2,115,254,143,95,4,213,67,138,253,166,137,68,
+26,13,246,193,254,195,5,182,254,195,193,185,48,0,1,0,199,0,0,4,0,5,182,0,
+9,0,0,33,35,17,33,17,35,17,51,17,33,4,0,184,254,55,184,184,2,129,2,170,253,
+86,5,182,253,150,0,0,1,0,166,0,0,5,27,5,205,0,23,0,0,1,17,6,6,17,16,19,35,
+38,2,53,16,0,33,32,0,17,17,35,17,52,38,39,17,2,141,155,150,111,180,51,62,
+1,29,1,51,1,22,1,15,183,140,146,2,170,2,127,24,215,254,249,254,142,254,63,
+184,1,185,194,1,94,1,60,254,247,254,240,254,246,1,33,162,171,19,253,127,0,
+1,0,70,0,0,5,121,5,182,0,21,0,0,37,54,55,1,51,3,35,19,54,55,39,6,7,1,35,3,
+51,5,21,37,19,22,1,166,60,85,2,154,168,207,188,116,32,26,6,95,71,253,225,
+189,206,170,1,153,254,142,110,29,227,121,127,3,219,250,74,3,6,234,96,2,179,
+112,252,209,5,182,250,200,223,253,31,211,0,1,0,76,0,0,4,205,5,182,0,18,0,
+0,1,3,37,23,5,3,35,19,5,39,37,55,54,55,6,6,5,39,1,3,170,68,1,37,66,254,129,
+115,188,106,254,197,66,1,152,8,16,48,50,146,254,128,92,2,174,5,182,254,41,
+154,129,203,252,211,2,199,166,129,215,51,130,200,50,95,242,153,1,170,0,2,
+0,199,0,0,3,254,5,182,0,5,0,17,0,0,51,17,51,17,33,21,0,22,21,20,6,35,34,38,
+53,52,54,51,199,184,2,127,254,234,63,63,42,45,61,61,45,5,182,250,234,160,
+2,86,55,59,59,56,56,59,59,55,0,1,0,199,0,0,4,111,5,182,0,7,0,0,33,35,17,33,
+17,35,17,33,4,111,183,253,199,184,3,168,5,20,250,236,5,182,0,2,0,166,0,0,
+4,78,5,205,0,34,0,46,0,0,0,22,51,50,54,53,53,39,51,22,21,20,6,35,34,38,53,
+52,54,51,50,18,17,20,2,7,35,18,17,52,38,35,34,6,21,0,22,21,20,6,35,34,38,
+53,52,54,51,1,92,67,52,54,61,2,182,4,158,133,144,165,244,204,244,244,101,
+83,181,183,157,149,126,140,1,52,63,63,42,45,61,61,45,2,143,131,106,109,29,
+18,24,27,174,188,212,177,199,235,254,226,254,218,143,254,178,139,1,87,1,17,
+217,216,154,143,2,221,55,60,59,56,56,59,60,55,0,3,0,166,0,0,5,102,5,205,0,
+16,0,28,0,40,0,0,0,2,7,35,18,19,6,35,34,2,53,52,18,51,50,18,17,39,38,38,35,
+34,6,21,20,22,51,50,54,0,22,21,20,6,35,34,38,53,52,54,51,4,78,118,105,191,
+177,42,125,168,197,251,252,196,244,244,182,5,156,145,123,143,147,126,77,154,
+1,218,56,58,46,44,63,62,45,2,117,254,76,193,1,91,1,46,114,1,10,203,221,1,
+4,254,183,254,175,25,247,246,181,150,150,174,80,1,76,62,53,54,61,56,59,60,
+55,0,0,1,0,199,0,0,4,0,5,182,0,9,0,0,1,33,17,35,17,33,17,33,53,33,4,0,253,
+127,184,2,129,253,127,3,57,2,170,253,86,3,76,1,200,162,0,1,0,0,0,0,4,205,
+5,182,0,10,0,0,1,51,1,35,1,51,1,22,23,54,55,4,10,195,253,246,185,253,246,
+193,1,73,63,29,29,64,5,182,250,74,5,182,252,86,178,141,151,172,0,2,0,14,0,
+0,4,197,5,182,0,10,0,13,0,0,1,17,35,17,5,39,1,17,51,1,21,39,37,17,2,129,184,
+254,161,92,1,187,159,2,93,197,254,129,2,61,253,195,1,203,219,153,1,21,3,24,
+254,137,149,72,231,254,49,0,0,3,0,92,0,141,7,39,5,182,0,27,0,40,0,44,0,0,
+1,7,6,35,34,2,53,52,18,51,50,22,23,1,23,1,22,22,51,50,54,55,23,6,6,35,34,
+38,36,22,51,50,54,55,53,38,38,35,34,6,21,19,33,21,33,3,215,97,150,212,194,
+238,246,194,157,229,104,1,55,125,254,154,81,157,96,80,122,27,168,41,218,138,
+143,220,252,227,141,122,127,191,46,98,168,98,124,139,45,4,220,251,36,3,8,
+114,175,1,9,221,223,1,10,182,201,1,127,102,254,74,156,129,106,99,70,126,159,
+144,186,180,235,58,4,213,166,181,159,253,86,150,0,1,0,125,255,236,3,240,5,
+203,0,25,0,0,18,0,55,53,38,38,37,53,1,21,35,34,4,21,20,22,51,50,54,55,21,
+6,35,32,0,17,125,1,10,223,54,115,254,235,3,0,125,234,254,254,224,205,58,142,
+60,129,138,254,225,254,183,3,31,1,66,42,4,14,34,96,172,254,248,172,248,221,
+209,230,27,24,159,51,1,60,1,23,0,1,0,162,0,0,3,219,5,182,0,9,0,0,19,51,17,
+33,17,35,17,33,17,35,162,184,2,129,184,254,55,184,5,182,255,0,251,74,4,20,
+254,246,0,2,0,33,0,0,4,84,5,182,0,10,0,28,0,0,19,18,17,20,7,35,54,53,52,2,
+3,33,32,4,21,20,4,7,7,53,51,50,54,53,52,38,35,35,53,213,219,39,180,37,92,
+125,2,22,1,3,1,26,254,217,246,90,74,173,198,189,182,74,5,182,253,242,254,
+37,250,211,226,204,248,1,209,1,63,206,175,168,217,4,2,150,130,117,109,117,
+149,0,0,1,0,199,0,0,4,197,5,182,0,20,0,0,1,21,35,34,6,21,20,22,51,51,21,35,
+32,39,35,17,35,17,33,54,33,4,197,146,168,153,157,164,146,146,254,72,60,192,
+184,1,120,55,1,189,5,182,162,74,89,87,79,162,250,251,221,4,197,241,0,1,0,
+102,0,0,3,193,5,182,0,21,0,0,33,54,54,53,52,33,33,53,33,17,33,53,33,21,33,
+17,22,22,21,20,6,7,2,113,84,67,254,221,254,129,1,60,254,196,3,48,254,196,
+174,185,85,71,106,160,90,246,150,2,49,149,149,253,207,12,198,169,100,183,
+90,0,0,1,0,102,0,0,3,193,5,182,0,19,0,0,33,54,54,53,52,33,33,53,33,17,33,
+53,33,17,22,22,21,20,6,7,2,113,84,67,254,221,254,129,1,60,254,196,1,244,174,
+185,85,71,106,160,90,246,150,2,49,149,253,58,12,198,169,100,183,90,0,1,0,
+123,0,0,3,195,5,182,0,11,0,0,19,33,17,33,21,33,53,33,17,35,17,35,123,2,10,
+1,62,252,184,1,82,189,149,5,182,250,224,150,150,4,139,254,223,0,0,1,0,102,
+0,0,3,193,5,182,0,17,0,0,33,54,54,53,52,33,33,53,33,17,51,17,22,22,21,20,
+6,7,2,113,84,67,254,221,254,129,1,60,184,174,185,85,71,106,160,90,246,150,
+2,198,253,58,12,198,169,100,183,90,0,1,0,102,0,0,3,193,5,182,0,21,0,0,1,7,
+7,53,37,51,17,22,22,21,20,6,7,35,54,54,53,52,33,33,53,33,1,162,178,138,1,
+136,108,174,185,85,71,180,84,67,254,221,254,129,1,60,4,238,95,69,168,196,
+253,58,12,198,169,100,183,90,106,160,90,246,150,0,0,1,0,76,0,0,3,238,5,205,
+0,22,0,0,1,17,35,17,51,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,
+2,137,180,94,121,135,145,131,99,161,88,119,105,222,138,217,248,192,2,86,253,
+170,2,229,5,156,136,138,157,91,116,101,142,116,247,200,173,238,0,0,1,0,41,
+0,0,3,90,5,182,0,11,0,0,1,5,21,39,39,17,33,21,33,53,33,17,1,211,1,135,137,
+178,1,59,252,207,1,61,5,182,196,168,69,95,251,168,150,150,5,32,0,1,0,76,0,
+0,3,238,5,205,0,29,0,0,1,37,17,35,17,37,55,23,53,51,54,54,53,52,38,35,34,
+6,7,39,54,54,51,50,22,21,20,6,7,5,3,170,254,223,180,254,195,65,252,94,121,
+135,145,131,99,161,88,119,105,222,138,217,248,171,151,1,64,1,76,151,254,29,
+2,66,165,129,133,2,5,156,136,138,157,91,116,101,142,116,247,200,162,217,32,
+166,0,1,0,41,0,0,3,221,5,182,0,9,0,0,51,53,33,17,33,17,35,17,33,17,41,1,39,
+2,141,184,254,227,162,5,20,250,74,5,20,250,236,0,0,1,0,104,255,238,4,14,5,
+203,0,42,0,0,1,22,21,20,6,35,34,38,53,52,54,54,36,54,53,52,38,35,34,6,21,
+23,35,39,52,54,51,50,22,21,20,6,4,6,21,20,22,51,50,54,53,52,39,4,4,10,252,
+223,223,236,101,203,1,17,128,122,105,102,124,4,184,4,223,187,190,221,188,
+254,146,150,139,137,136,153,10,1,223,40,50,189,218,189,189,116,182,126,105,
+124,97,103,106,102,89,47,49,158,195,197,174,156,209,142,119,113,112,120,139,
+126,37,36,0,1,0,74,6,133,5,94,8,72,0,6,0,0,19,1,51,1,33,1,1,74,2,43,184,2,
+49,254,230,254,139,254,147,6,133,1,195,254,61,1,51,254,205,0,0,1,0,102,6,
+197,5,66,7,90,0,3,0,0,19,33,21,33,102,4,220,251,36,7,90,149,0,2,0,166,0,0,
+4,78,5,205,0,11,0,35,0,0,0,22,21,20,6,35,34,38,53,52,54,51,2,38,53,52,55,
+51,6,21,20,22,51,50,54,53,52,2,39,51,22,18,21,20,0,35,2,171,56,58,46,45,62,
+62,45,223,246,45,180,43,148,129,144,151,179,200,207,171,183,255,0,221,5,205,
+62,53,54,61,56,59,60,55,250,51,234,206,136,143,148,116,141,167,200,185,146,
+1,62,192,159,254,164,179,231,254,241,0,0,2,0,70,0,0,2,209,5,182,0,3,0,15,
+0,0,1,1,35,1,0,22,21,20,6,35,34,38,53,52,54,51,2,14,254,244,188,1,24,1,52,
+63,63,42,45,61,61,45,5,182,250,74,5,182,253,131,55,59,59,56,56,59,59,55,0,
+4,0,70,0,0,5,76,5,182,0,3,0,15,0,19,0,31,0,0,1,1,35,1,0,22,21,20,6,35,34,
+38,53,52,54,51,1,1,35,1,0,22,21,20,6,35,34,38,53,52,54,51,2,14,254,244,188,
+1,24,1,52,63,63,42,45,61,61,45,2,33,254,244,188,1,24,1,52,63,63,42,45,61,
+61,45,5,182,250,74,5,182,253,131,55,59,59,56,56,59,59,55,2,125,250,74,5,182,
+253,131,55,59,59,56,56,59,59,55,0,1,0,102,0,0,3,150,3,76,0,7,0,0,33,19,33,
+53,33,21,33,3,1,35,127,254,196,3,48,254,196,127,2,182,150,150,253,74,0,3,
+0,102,0,0,5,223,3,76,0,7,0,19,0,23,0,0,33,19,33,53,33,21,33,3,0,22,21,20,
+6,35,34,38,53,52,54,51,3,3,35,19,1,35,127,254,196,3,48,254,196,127,3,205,
+55,58,46,45,62,62,45,148,155,189,162,2,182,150,150,253,74,2,12,62,52,54,61,
+56,59,59,55,1,64,252,180,3,76,0,0,2,0,74,255,236,5,94,5,182,0,9,0,21,0,0,
+1,5,17,51,17,37,33,1,35,1,0,22,21,20,6,35,34,38,53,52,54,51,1,98,1,19,184,
+1,23,1,26,253,207,184,253,213,2,183,56,59,45,44,63,62,45,2,215,231,3,198,
+252,60,229,254,61,1,195,253,250,62,53,53,61,55,59,60,55,0,0,14,0,102,254,
+188,5,141,6,182,0,138,0,150,0,162,0,174,0,186,0,198,0,210,0,222,0,234,0,246,
+1,2,1,14,1,26,1,38,0,0,0,23,53,55,39,6,35,34,38,53,52,54,51,50,22,23,37,54,
+53,52,38,39,38,53,52,54,53,52,38,39,55,22,22,21,20,6,6,21,20,22,23,22,21,
+20,7,5,54,54,51,50,22,21,20,6,35,34,39,7,23,54,54,51,50,22,21,20,6,35,34,
+38,39,7,23,54,54,51,50,22,21,20,6,35,34,38,39,5,53,6,21,20,22,23,22,21,20,
+6,21,20,23,23,7,39,38,53,52,54,55,54,53,52,38,39,38,53,52,55,37,6,6,35,34,
+38,53,52,54,51,50,23,55,39,6,6,35,34,38,53,52,54,51,1,13,5,45,4,0,22,21,20,
+6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,
+34,38,53,52,54,51,4,54,53,52,38,35,34,6,21,20,22,51,0,54,53,52,38,35,34,6,
+21,20,22,51,0,54,53,52,38,35,34,6,21,20,22,51,0,54,53,52,38,35,34,6,21,20,
+22,51,0,54,53,52,38,35,34,6,21,20,22,51,32,54,53,52,38,35,34,6,21,20,22,51,
+0,54,53,52,38,35,34,6,21,20,22,51,0,54,53,52,38,35,34,6,21,20,22,51,4,54,
+53,52,38,35,34,6,21,20,22,51,1,40,42,176,180,40,63,54,75,75,54,39,61,15,1,
+137,25,8,9,94,105,33,29,47,67,50,29,57,8,9,90,35,1,72,14,64,40,54,75,75,54,
+72,36,195,191,17,60,35,54,75,75,54,40,61,15,193,201,17,57,34,54,75,75,54,
+42,62,14,254,88,7,8,9,90,105,26,60,28,50,110,40,40,14,9,9,96,34,254,201,15,
+61,39,54,75,75,54,63,40,186,178,17,58,36,54,75,75,54,2,7,254,184,1,2,254,
+254,1,8,254,248,1,72,1,79,254,242,1,14,254,248,1,8,254,235,75,75,54,54,75,
+75,54,54,75,75,54,54,75,75,54,54,75,75,54,54,75,75,54,254,5,21,21,16,15,21,
+21,15,4,53,21,21,16,15,22,22,15,253,245,22,22,15,16,21,21,16,2,42,21,21,16,
+15,22,22,15,251,235,21,21,16,15,21,21,15,4,53,21,21,16,15,22,22,15,253,245,
+22,22,15,16,21,21,16,254,5,21,21,16,15,21,21,15,2,26,22,22,15,16,21,21,16,
+3,47,55,2,123,151,49,75,54,54,75,39,32,217,14,8,2,4,3,27,54,45,40,9,5,27,
+11,78,28,59,38,25,38,26,3,2,3,2,16,61,36,35,179,34,44,75,54,54,75,60,162,
+133,27,36,75,54,54,75,40,34,131,168,26,31,75,54,54,75,45,35,229,2,6,5,2,4,
+2,16,58,54,40,6,8,8,19,80,13,25,77,29,42,13,4,4,2,3,2,16,61,41,25,170,32,
+40,75,54,54,75,49,158,123,28,36,75,54,54,75,1,209,182,221,183,186,227,183,
+183,227,186,183,221,253,110,75,54,54,75,75,54,54,75,2,242,75,54,54,75,75,
+54,54,75,254,133,75,54,54,75,75,54,54,75,166,22,15,16,21,21,16,15,22,1,174,
+22,15,16,21,21,16,15,22,252,219,22,15,16,21,21,16,15,22,1,119,22,15,16,21,
+21,16,15,22,254,86,22,15,16,21,21,16,15,22,22,15,16,21,21,16,15,22,1,170,
+22,15,16,21,21,16,15,22,1,174,22,15,16,21,21,16,15,22,51,21,16,15,22,22,15,
+16,21,0,11,0,102,255,133,6,248,6,20,0,31,0,59,0,99,0,106,0,113,0,120,0,127,
+0,134,0,141,0,148,0,155,0,0,0,14,5,35,34,46,5,53,52,62,5,51,50,30,5,21,1,
+23,22,22,51,50,54,55,55,62,2,53,52,46,3,35,34,14,3,21,20,22,22,37,22,21,20,
+6,35,34,38,53,52,55,6,35,34,38,53,52,54,51,50,23,38,53,52,54,51,50,22,21,
+20,7,54,51,50,22,21,20,6,35,34,37,33,22,22,51,50,54,37,33,38,38,35,34,6,37,
+17,6,6,21,20,22,19,17,54,54,53,52,38,3,17,6,6,21,20,22,19,17,54,54,53,52,
+38,55,33,38,38,35,34,6,5,33,22,22,51,50,54,6,248,105,166,137,25,110,183,114,
+115,188,110,18,149,164,98,94,159,155,25,107,186,116,113,185,109,26,152,158,
+97,251,103,16,30,178,113,113,174,33,16,25,221,155,156,224,61,181,115,113,
+183,61,236,146,153,225,2,101,6,149,107,107,149,4,19,40,131,176,179,128,39,
+20,4,149,107,107,149,4,31,22,128,180,178,130,31,254,107,254,141,22,100,69,
+59,106,254,156,1,115,16,110,54,64,107,1,171,45,53,53,149,47,60,60,151,45,
+53,53,149,45,62,60,33,1,111,20,106,65,55,106,1,96,254,145,16,101,59,69,100,
+2,90,183,109,24,142,163,104,109,169,132,24,115,181,108,107,181,117,31,134,
+164,107,104,162,144,26,114,182,109,254,85,57,109,142,142,109,54,91,43,177,
+119,119,184,40,245,151,146,247,48,185,113,114,182,43,91,22,35,128,180,180,
+128,35,24,8,149,107,107,149,10,19,42,128,179,179,128,35,22,6,149,107,108,
+148,201,45,54,57,146,46,60,59,57,1,88,21,100,69,54,83,1,71,254,168,16,84,
+54,65,105,252,49,1,88,17,82,54,70,99,1,66,254,168,20,104,67,54,84,218,46,
+60,61,149,42,57,54,0,4,0,102,0,94,5,131,5,68,0,44,0,59,0,71,0,87,0,0,1,6,
+6,35,34,38,53,52,36,33,50,4,22,21,20,6,35,34,38,39,22,21,20,7,54,54,51,50,
+22,21,20,4,33,34,36,38,53,52,51,50,22,23,38,53,52,38,51,55,54,54,51,50,5,
+55,38,36,35,34,4,21,1,54,54,53,52,38,35,6,6,21,20,22,36,35,34,6,6,35,34,38,
+39,7,22,4,51,50,36,53,2,35,80,225,39,45,54,1,96,1,15,166,1,47,215,32,21,49,
+231,101,76,86,78,227,39,45,53,254,156,254,245,169,254,205,208,62,42,248,83,
+76,254,12,88,86,227,123,198,1,81,2,100,254,213,154,215,254,207,2,45,78,108,
+111,89,79,108,111,2,121,13,3,172,222,127,98,237,199,5,95,1,44,160,215,1,50,
+3,233,25,124,56,53,148,239,146,237,45,35,31,97,34,115,149,160,121,25,125,
+56,53,150,237,149,237,52,56,106,25,110,154,163,72,49,50,71,151,6,122,142,
+177,95,253,213,4,178,121,122,181,4,178,121,122,181,67,98,72,63,91,6,115,151,
+179,93,0,3,0,102,255,158,3,231,5,125,0,47,0,59,0,71,0,0,37,53,5,14,2,7,39,
+62,2,53,53,37,21,35,17,5,38,53,52,55,5,3,51,23,55,38,53,52,54,55,22,22,21,
+20,7,23,55,51,3,37,22,21,20,7,37,17,36,54,53,52,38,35,34,6,21,20,22,51,18,
+54,53,52,38,39,6,6,21,20,22,51,3,129,254,233,6,71,68,106,62,86,56,53,254,
+217,103,1,29,55,49,254,252,19,103,10,193,58,113,88,87,114,58,193,10,102,18,
+254,252,49,55,1,28,254,100,81,91,28,26,89,83,30,50,52,49,49,44,54,54,46,207,
+194,96,107,143,76,77,82,62,61,109,76,7,102,194,1,74,101,117,145,135,113,88,
+1,41,164,56,45,75,53,139,46,45,140,53,75,45,56,164,254,215,88,109,139,145,
+117,101,254,182,190,165,134,136,174,172,138,145,154,2,185,43,30,23,71,29,
+26,70,27,30,43,0,17,0,102,255,166,7,195,6,51,0,19,0,22,0,25,0,28,0,31,0,43,
+0,55,0,67,0,79,0,91,0,103,0,115,0,127,0,139,0,151,0,163,0,175,0,0,1,1,7,5,
+1,23,1,39,3,1,7,1,55,37,1,39,1,23,19,1,1,37,3,1,1,5,1,1,3,19,19,37,18,6,35,
+34,38,53,52,54,51,50,22,21,0,38,53,52,54,51,50,22,21,20,6,35,38,38,53,52,
+54,51,50,22,21,20,6,35,0,22,21,20,6,35,34,38,53,52,54,51,0,54,51,50,22,21,
+20,6,35,34,38,53,0,22,21,20,6,35,34,38,53,52,54,51,4,6,35,34,38,53,52,54,
+51,50,22,21,0,38,53,52,54,51,50,22,21,20,6,35,0,54,51,50,22,21,20,6,35,34,
+38,53,0,22,21,20,6,35,34,38,53,52,54,51,0,54,51,50,22,21,20,6,35,34,38,53,
+0,6,35,34,38,53,52,54,51,50,22,21,6,186,1,9,66,253,18,1,207,29,253,149,28,
+21,253,207,67,254,247,66,2,244,254,43,29,2,106,29,21,2,49,254,31,2,159,172,
+251,23,1,227,253,115,1,80,1,151,16,127,16,1,135,236,35,25,24,33,33,24,25,
+35,253,204,34,34,25,25,33,33,25,25,34,34,25,25,33,33,25,254,80,35,35,24,25,
+33,33,25,254,163,35,25,25,32,32,25,25,35,2,1,34,34,25,25,33,33,25,3,28,34,
+25,25,32,32,25,25,34,254,148,35,35,24,25,33,33,25,252,209,35,25,25,32,32,
+25,25,35,1,128,34,34,25,25,33,33,25,253,221,35,24,25,33,33,25,24,35,4,190,
+34,25,25,32,32,25,25,34,5,100,253,113,29,2,254,51,67,255,0,65,2,158,254,21,
+27,2,129,27,2,1,211,67,1,0,65,253,106,1,236,253,213,2,1,174,252,69,1,164,
+4,2,82,254,107,2,55,252,196,253,201,162,2,160,35,35,24,25,33,33,25,253,0,
+35,25,24,33,33,24,25,35,189,34,25,25,32,32,25,25,34,3,209,35,25,25,32,32,
+25,25,35,252,203,34,34,25,25,33,33,25,2,205,35,25,25,32,32,25,25,35,154,35,
+35,25,24,33,33,24,252,176,34,25,25,32,32,25,25,34,1,168,34,34,25,25,32,32,
+25,2,254,35,24,25,33,33,25,24,35,253,27,34,34,25,25,32,32,25,1,29,35,35,24,
+25,33,33,25,0,0,10,0,102,0,0,5,150,6,176,0,44,0,51,0,64,0,74,0,89,0,99,0,
+112,0,119,0,131,0,143,0,0,33,33,53,18,19,38,38,53,52,54,55,38,53,52,54,55,
+23,6,6,21,20,22,23,23,55,54,54,53,52,39,55,22,22,21,20,7,22,22,21,20,6,7,
+22,18,23,37,33,38,38,35,34,6,19,51,23,38,38,53,52,55,39,6,6,21,20,19,54,55,
+38,35,34,6,21,20,22,1,54,54,51,50,23,2,39,6,3,54,51,50,22,23,19,50,54,53,
+52,38,35,34,7,22,19,7,22,21,20,6,7,55,51,54,53,52,38,3,33,38,38,35,34,6,2,
+22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,5,78,251,
+94,157,165,179,213,99,84,68,177,157,37,43,45,111,104,51,51,104,111,88,47,
+156,168,68,84,99,216,176,97,154,69,251,225,1,82,20,93,57,57,91,72,21,61,46,
+34,49,4,57,66,242,67,56,133,135,91,120,196,1,127,23,155,99,51,37,201,182,
+182,201,37,51,100,154,23,223,162,194,121,90,135,133,56,186,5,50,34,46,61,
+21,75,68,253,1,82,20,91,57,57,93,252,39,39,28,28,38,38,28,1,44,40,40,28,28,
+37,37,28,72,1,104,1,4,11,136,95,68,99,23,110,126,148,200,4,53,75,135,75,83,
+177,80,39,39,80,178,82,131,154,53,8,204,140,126,110,23,99,68,99,137,6,149,
+254,197,156,30,44,55,55,3,229,6,66,112,57,124,95,4,34,130,71,124,254,69,91,
+56,100,59,47,55,86,253,77,90,111,22,1,157,185,185,254,99,22,111,90,2,179,
+86,55,47,59,100,56,2,199,4,97,122,57,112,66,6,92,125,72,131,250,75,44,55,
+55,1,155,40,28,27,38,38,27,28,40,40,28,27,38,38,27,28,40,0,10,0,102,0,0,7,
+25,5,203,0,60,0,74,0,83,0,91,0,110,0,129,0,138,0,147,0,159,0,171,0,0,1,38,
+38,53,52,0,51,50,22,23,54,54,51,50,0,21,20,6,7,39,54,54,53,52,38,35,34,6,
+7,23,54,51,50,22,21,20,6,7,0,23,21,33,53,18,19,38,38,53,52,54,51,50,23,55,
+38,35,34,6,21,20,23,1,6,3,55,51,50,22,23,51,54,54,51,23,2,1,38,38,39,38,35,
+34,6,7,35,38,38,35,34,7,6,7,1,23,54,51,50,18,21,20,6,7,23,54,54,53,52,38,
+35,34,6,0,22,23,55,38,53,52,18,51,50,22,23,55,38,38,35,34,6,21,4,22,51,55,
+38,35,34,6,21,37,23,50,54,53,52,38,35,34,0,22,21,20,6,35,34,38,53,52,54,51,
+32,22,21,20,6,35,34,38,53,52,54,51,1,102,111,145,1,14,220,94,173,102,92,175,
+99,221,1,13,146,110,64,25,22,174,151,55,133,9,53,63,74,88,99,85,75,1,39,51,
+251,29,121,225,74,86,100,87,74,63,53,60,137,151,174,47,2,27,75,249,16,17,
+132,148,4,7,2,148,134,37,226,1,154,28,64,31,33,63,84,97,3,211,6,97,81,58,
+32,63,62,2,118,2,52,82,197,231,20,5,8,38,46,221,188,55,125,252,104,45,39,
+8,25,230,198,22,83,20,2,45,116,52,191,218,1,162,57,51,64,45,43,44,40,1,245,
+64,47,61,40,44,43,254,208,40,40,27,28,38,38,28,1,3,40,40,28,28,37,37,28,2,
+16,47,245,141,239,1,27,71,91,87,75,254,229,239,145,238,50,37,87,131,85,157,
+202,9,1,99,43,97,79,71,99,12,253,156,119,72,72,1,15,1,204,10,101,71,80,96,
+43,99,10,202,157,143,160,2,47,131,254,13,2,205,189,186,208,4,1,201,252,177,
+63,133,62,33,158,133,143,148,26,129,136,4,187,4,20,254,255,204,33,116,23,
+2,56,152,59,189,230,40,254,68,145,57,2,106,66,202,1,3,14,6,4,29,38,234,185,
+15,47,127,33,45,29,41,125,49,35,29,45,254,145,39,28,28,38,38,28,28,39,39,
+28,28,38,38,28,28,39,0,0,7,0,102,0,4,5,209,5,106,0,29,0,32,0,35,0,38,0,41,
+0,44,0,47,0,0,1,37,55,19,7,33,5,23,1,39,3,19,7,37,55,19,5,7,3,55,5,37,39,
+1,23,19,3,55,5,7,3,37,39,5,3,7,1,37,23,37,19,55,1,19,39,3,3,23,3,164,1,121,
+69,111,70,254,70,1,125,51,254,213,49,215,2,19,254,105,18,213,254,142,70,111,
+70,1,168,254,145,51,1,41,51,217,2,19,1,151,18,164,1,119,51,253,114,188,137,
+1,16,254,143,46,2,141,188,135,254,101,184,184,101,182,184,3,66,215,18,254,
+104,18,217,51,254,213,51,1,117,254,88,70,109,67,1,119,213,18,1,149,19,3,216,
+51,1,43,51,254,133,1,180,69,108,70,254,47,2,185,101,1,70,133,254,133,2,186,
+92,254,190,136,2,12,1,63,52,253,10,254,192,51,0,8,0,102,0,0,5,78,6,176,0,
+24,0,31,0,44,0,54,0,71,0,78,0,90,0,102,0,0,1,6,6,21,20,22,4,0,19,21,33,53,
+18,55,38,38,53,52,54,55,38,53,52,54,55,3,33,38,38,35,34,6,19,51,23,38,38,
+53,52,55,39,6,6,21,20,19,54,55,38,35,34,6,21,20,22,1,54,54,51,50,23,38,2,
+39,6,2,7,54,51,50,22,23,51,33,38,38,35,34,6,2,22,21,20,6,35,34,38,53,52,54,
+51,32,22,21,20,6,35,34,38,53,52,54,51,2,76,43,45,121,1,28,1,45,152,251,94,
+176,146,187,205,99,84,68,177,157,248,1,82,20,93,57,57,91,72,21,61,46,34,49,
+4,57,66,242,67,56,133,135,91,120,196,1,127,23,155,99,51,37,88,201,100,88,
+180,109,37,51,100,154,23,143,1,82,20,91,57,57,93,252,39,39,28,28,38,38,28,
+1,44,40,40,28,28,37,37,28,6,123,75,135,75,96,161,219,254,31,254,167,72,72,
+1,137,227,13,129,100,68,99,23,110,126,148,200,4,249,182,44,55,55,3,229,6,
+66,112,57,124,95,4,34,130,71,124,254,69,91,56,100,59,47,55,86,253,77,90,111,
+22,181,1,52,102,90,254,236,225,22,111,90,44,55,55,1,155,40,28,27,38,38,27,
+28,40,40,28,27,38,38,27,28,40,0,4,0,102,0,117,5,131,5,68,0,37,0,52,0,64,0,
+73,0,0,18,51,50,22,23,38,53,52,55,6,6,35,34,38,53,52,36,33,50,4,22,21,20,
+6,35,34,38,39,22,21,16,7,6,35,34,38,38,53,18,51,55,54,54,51,50,5,55,38,36,
+35,34,4,21,0,54,53,52,38,35,6,6,21,20,22,51,21,38,37,7,22,22,51,50,54,102,
+62,42,248,83,76,86,80,225,39,45,54,1,96,1,15,166,1,47,215,32,21,49,231,101,
+76,183,43,190,110,242,183,105,12,88,86,227,123,198,1,81,2,100,254,213,154,
+215,254,207,2,120,111,111,89,79,108,109,88,207,254,195,5,95,227,88,39,65,
+2,76,106,25,110,154,163,117,25,124,56,53,148,239,146,237,45,35,31,97,34,115,
+149,254,214,83,223,142,222,51,1,168,49,50,71,151,6,122,142,177,95,253,213,
+179,124,122,181,4,178,121,120,183,103,10,144,6,111,135,54,0,3,0,102,255,188,
+5,195,5,125,0,82,0,93,0,105,0,0,1,21,22,51,50,55,38,17,52,54,55,7,39,39,55,
+23,39,55,23,55,23,7,23,55,38,53,52,54,55,22,22,21,20,7,23,55,39,55,23,55,
+23,7,55,23,7,7,39,22,21,16,7,22,51,50,55,53,51,21,54,55,23,6,7,23,7,39,6,
+35,34,39,6,35,34,39,7,39,55,38,39,55,22,23,53,0,6,6,21,20,23,54,53,52,38,
+35,54,54,53,52,38,39,6,6,21,20,22,51,1,117,68,59,117,102,152,28,23,253,58,
+184,29,124,57,76,51,45,76,70,21,227,57,114,86,86,115,57,227,21,70,76,45,51,
+76,58,125,29,184,58,254,52,150,98,121,57,68,84,64,63,60,94,48,129,32,187,
+77,87,164,127,127,161,93,73,187,32,129,73,69,60,65,62,1,228,57,46,118,119,
+91,30,48,53,49,50,42,56,56,45,1,47,180,21,86,198,1,42,63,146,53,84,123,68,
+75,49,119,37,123,115,29,172,47,68,44,76,55,139,44,44,139,55,76,44,68,47,172,
+29,115,123,37,119,49,75,68,123,84,116,146,254,215,199,86,21,180,153,45,67,
+57,91,34,70,78,93,25,113,113,25,93,78,70,53,72,57,70,42,153,2,191,77,151,
+94,252,166,167,251,135,187,88,44,29,23,71,29,26,70,27,30,43,0,0,3,0,102,0,
+0,4,158,6,92,0,48,0,59,0,71,0,0,1,6,7,23,51,21,33,3,3,33,53,51,55,38,39,53,
+1,39,34,7,39,54,51,50,23,55,38,38,53,52,54,51,50,22,21,20,6,7,23,54,51,50,
+23,7,38,35,35,7,1,37,22,23,19,51,19,54,55,38,2,39,54,54,53,52,38,35,34,6,
+21,20,22,51,4,102,159,129,61,234,254,204,176,172,254,205,233,60,148,139,1,
+57,34,154,125,74,153,200,31,51,30,42,50,97,69,69,99,52,40,31,48,33,200,153,
+74,128,151,16,16,1,73,252,193,111,90,104,102,103,120,83,73,223,69,25,39,40,
+26,27,36,36,27,1,82,35,12,189,102,2,45,253,211,102,191,15,30,72,2,135,2,125,
+74,153,8,61,26,106,65,92,125,127,90,65,103,26,64,8,153,74,125,2,253,121,8,
+23,6,1,60,254,198,12,15,150,1,172,145,155,70,45,47,68,69,46,46,69,0,8,0,102,
+0,0,6,178,4,150,0,29,0,38,0,44,0,50,0,62,0,75,0,78,0,81,0,0,19,52,54,55,38,
+38,53,52,54,51,50,22,23,54,51,50,23,54,54,51,50,22,21,20,6,7,22,17,17,33,
+55,33,53,16,0,35,34,0,17,5,3,53,33,21,3,33,3,53,33,21,3,0,38,35,34,6,21,20,
+22,51,50,54,53,36,21,20,22,51,50,55,55,54,53,52,38,35,1,23,55,33,23,55,221,
+62,67,111,137,91,77,100,178,15,155,189,187,157,18,178,99,76,92,143,107,131,
+250,162,103,4,145,254,178,252,251,254,180,1,61,113,1,70,111,1,74,112,1,69,
+110,1,180,31,33,66,132,34,29,66,133,250,129,133,65,24,13,19,8,131,68,3,27,
+61,62,253,213,61,62,1,0,144,221,94,23,177,91,77,91,153,114,92,94,118,151,
+90,78,98,172,21,177,254,236,254,250,102,152,1,28,1,103,254,158,254,231,74,
+1,115,74,74,254,141,1,115,74,74,254,141,3,81,34,130,69,35,28,133,66,63,63,
+69,130,8,17,13,25,67,132,253,238,207,207,207,207,0,0,4,0,102,255,164,4,233,
+6,59,0,65,0,77,0,87,0,99,0,0,37,6,6,35,34,38,39,7,39,55,23,55,38,39,7,39,
+55,23,55,38,53,7,39,55,23,55,54,55,7,3,55,23,55,55,54,55,53,6,35,34,39,7,
+39,55,35,53,51,39,55,23,54,51,50,22,23,17,22,22,21,20,6,7,22,51,50,55,4,54,
+53,52,38,35,34,6,21,20,22,51,1,22,51,50,54,55,55,38,35,34,1,6,35,39,22,51,
+50,55,39,6,35,34,4,233,25,180,118,110,194,36,219,209,65,140,157,25,22,153,
+203,74,139,113,11,131,182,78,133,111,9,19,119,165,90,114,230,2,36,46,70,68,
+110,90,127,66,121,199,199,121,66,129,93,105,59,127,54,120,163,67,56,38,62,
+49,90,254,160,133,134,93,91,132,131,92,254,164,79,76,38,82,26,2,74,74,75,
+1,135,45,64,18,74,102,92,68,2,31,27,75,145,107,130,131,104,215,183,77,122,
+153,36,50,117,209,70,143,86,53,55,65,219,65,157,57,54,54,63,1,27,53,197,125,
+2,25,10,238,41,84,127,67,121,82,123,65,131,84,74,65,254,88,24,255,174,109,
+184,63,18,32,14,209,147,146,211,209,148,147,209,4,166,84,48,34,2,80,250,196,
+29,1,70,55,5,7,0,1,0,102,0,0,3,18,6,63,0,31,0,0,33,33,53,19,38,38,53,52,54,
+55,38,38,53,52,54,55,53,51,21,22,22,21,20,6,7,22,22,21,20,6,7,19,3,0,253,
+121,164,82,101,88,70,80,78,164,127,103,125,165,80,79,72,87,100,84,166,72,
+1,200,34,122,78,68,114,29,34,113,66,97,148,15,153,153,14,151,95,64,115,32,
+28,121,64,78,122,34,254,56,0,3,0,102,255,78,5,94,6,104,0,75,0,87,0,97,0,0,
+1,23,51,50,54,53,52,38,36,38,53,52,54,55,53,35,6,6,35,34,38,53,52,54,51,50,
+22,23,33,21,22,22,21,20,6,35,34,53,53,6,6,21,20,22,23,23,55,23,7,22,23,55,
+23,7,22,23,51,21,35,6,7,23,7,39,6,7,23,7,39,6,35,35,7,39,55,39,18,54,53,52,
+38,35,34,6,21,20,22,51,5,21,20,22,51,50,54,53,52,38,1,8,142,241,174,209,135,
+254,214,112,129,103,168,18,123,80,93,133,135,91,77,126,18,1,14,98,111,79,
+62,170,60,69,79,128,94,207,73,180,54,26,213,53,219,9,5,244,248,16,8,231,53,
+231,30,38,186,77,199,107,137,246,137,82,135,135,194,77,76,49,49,74,74,49,
+1,235,32,40,23,22,67,1,66,197,166,143,108,125,71,129,114,97,142,17,125,75,
+99,130,95,97,130,99,77,225,11,98,75,66,88,195,45,15,86,59,68,87,31,29,203,
+74,180,38,34,129,86,133,34,58,103,65,19,139,90,137,38,27,230,65,244,43,197,
+57,189,188,4,6,71,52,52,73,73,52,52,71,145,55,48,45,35,17,42,48,0,4,0,102,
+0,0,5,162,5,49,0,31,0,43,0,57,0,70,0,0,1,38,2,39,6,35,34,38,53,52,54,51,50,
+23,54,51,50,23,54,51,50,22,21,20,6,35,34,39,6,7,17,35,19,54,18,53,52,38,35,
+34,6,21,20,18,1,22,21,20,7,22,51,50,54,53,52,38,35,34,1,52,55,38,35,34,6,
+21,20,22,51,50,55,2,209,95,148,32,40,33,113,158,158,113,106,80,95,118,120,
+91,80,108,114,157,156,115,42,33,69,204,102,51,110,140,148,102,103,147,127,
+1,152,67,6,21,32,68,100,101,67,69,253,86,67,49,65,69,99,99,69,32,19,1,55,
+115,1,5,112,11,159,112,113,157,76,72,72,76,160,110,110,161,11,240,248,254,
+201,1,145,138,1,57,119,106,146,147,105,115,254,218,2,108,94,117,35,37,8,97,
+71,72,96,255,0,117,94,45,99,69,69,99,8,0,0,6,0,102,0,0,8,102,5,78,0,28,0,
+40,0,64,0,87,0,100,0,115,0,0,33,2,39,6,35,34,0,53,52,0,51,50,23,54,51,50,
+23,54,51,50,0,21,20,0,35,34,39,2,7,39,54,18,53,52,38,35,34,6,21,20,18,3,54,
+55,38,35,34,6,21,20,22,51,50,54,55,39,6,35,34,38,53,52,54,51,50,1,7,22,51,
+50,54,53,52,38,35,34,7,22,23,54,51,50,22,21,20,6,35,34,37,38,53,53,38,35,
+34,6,21,20,22,51,50,1,23,21,20,7,22,22,51,50,54,53,52,38,35,34,4,55,118,62,
+130,181,202,254,228,1,27,203,159,132,84,163,164,84,132,159,200,1,29,254,226,
+199,181,130,87,93,48,100,124,117,107,106,117,128,214,9,5,103,140,157,226,
+225,158,81,143,52,20,69,93,110,156,156,110,72,2,143,23,112,167,158,225,226,
+157,137,107,3,10,63,74,110,156,156,110,97,253,111,16,45,74,66,98,98,66,84,
+2,172,2,16,21,72,42,66,98,99,65,70,1,7,204,109,1,30,200,201,1,32,96,121,121,
+96,254,225,202,202,254,228,109,254,254,209,123,224,1,196,141,152,163,163,
+152,144,254,53,2,251,36,11,84,225,162,158,225,60,54,84,53,156,110,111,156,
+254,32,84,114,225,158,162,225,86,4,39,37,156,111,110,156,174,88,72,45,51,
+95,69,68,95,1,20,22,23,72,88,32,39,95,68,69,95,0,6,0,102,255,123,7,35,5,205,
+0,42,0,54,0,77,0,101,0,114,0,127,0,0,1,54,51,50,22,21,20,6,35,34,39,6,7,7,
+20,22,21,20,6,7,39,54,54,53,52,38,53,55,38,39,6,35,34,38,53,52,54,51,50,23,
+54,51,50,0,18,23,54,18,53,52,38,35,34,6,21,39,54,55,38,35,34,6,21,20,22,51,
+50,55,39,6,35,34,38,53,52,54,51,50,1,6,7,22,51,50,54,53,52,38,35,34,7,22,
+23,54,51,50,22,21,20,6,35,34,37,38,53,53,38,35,34,6,21,20,22,51,50,37,21,
+20,7,22,51,50,54,53,52,38,35,34,4,188,85,100,175,255,253,177,126,100,62,95,
+1,40,55,46,73,34,37,43,4,73,78,105,123,177,253,255,175,98,85,99,151,148,254,
+116,125,125,117,128,138,109,108,140,90,9,23,59,68,137,190,191,136,104,77,
+43,53,72,91,128,129,90,42,2,158,23,17,81,99,134,193,192,135,68,61,20,12,40,
+44,92,128,129,91,76,253,97,23,31,38,49,68,67,50,53,2,205,23,33,59,49,68,68,
+49,37,5,90,41,254,180,177,253,59,123,151,16,27,139,37,62,139,45,74,34,96,
+42,34,134,31,38,112,146,61,254,176,180,254,41,115,253,245,254,191,203,194,
+1,71,104,142,177,176,143,125,41,55,25,195,137,134,194,53,101,39,127,92,93,
+128,254,109,65,36,51,195,133,135,197,25,45,51,16,130,91,89,130,143,86,70,
+16,23,71,48,46,71,211,14,68,88,41,71,46,48,71,0,0,3,0,184,0,0,4,6,6,37,0,
+29,0,36,0,44,0,0,33,1,17,35,17,51,23,17,7,35,17,51,17,55,17,51,50,22,21,20,
+6,7,7,22,22,21,20,6,7,5,1,17,54,54,53,52,38,39,55,54,54,53,52,38,39,3,213,
+253,74,103,64,246,246,64,103,207,71,91,225,75,79,49,135,160,107,180,1,88,
+254,78,167,107,147,127,102,44,36,113,69,1,129,254,127,2,10,137,2,70,131,2,
+49,254,86,112,1,234,169,95,65,99,45,29,68,214,121,115,171,103,189,3,137,253,
+115,90,134,102,99,176,196,61,26,45,29,44,99,19,0,9,0,184,0,0,5,221,6,123,
+0,10,0,67,0,70,0,73,0,85,0,97,0,109,0,113,0,117,0,0,33,33,17,52,18,36,51,
+50,4,18,21,5,53,35,6,6,35,34,38,53,52,54,51,50,22,23,51,17,39,6,2,21,17,1,
+33,1,17,52,2,39,7,17,51,54,54,51,50,22,21,20,6,35,34,38,39,35,21,22,22,21,
+20,6,35,34,38,53,52,54,1,7,51,37,21,51,18,54,53,52,38,35,34,6,21,20,22,51,
+36,6,21,20,22,51,50,54,53,52,38,35,2,54,53,52,38,35,34,6,21,20,22,51,19,38,
+39,21,39,6,7,23,5,221,250,219,183,1,48,173,175,1,47,179,253,55,61,16,93,61,
+76,102,104,74,60,95,15,61,239,124,138,1,94,1,156,1,94,141,121,246,65,17,94,
+61,74,105,103,76,62,93,17,65,58,71,103,75,76,102,69,2,154,203,203,251,168,
+202,99,45,45,31,32,44,44,32,2,28,44,44,31,32,44,44,32,255,45,45,31,32,44,
+44,32,205,74,82,103,77,72,149,3,70,226,1,125,214,218,254,132,223,228,189,
+57,70,101,77,76,102,71,56,1,88,199,101,254,192,185,254,127,254,161,1,95,1,
+129,185,1,68,99,207,254,174,56,71,103,75,74,104,71,56,189,17,96,57,74,104,
+101,77,59,94,254,224,203,203,203,2,160,44,32,31,45,45,31,32,44,152,45,31,
+32,44,44,32,31,45,253,207,43,32,31,45,45,31,32,43,4,116,39,10,178,176,9,38,
+123,0,0,4,0,102,255,154,4,170,5,205,0,20,0,27,0,34,0,44,0,0,5,53,52,38,39,
+39,38,2,53,52,0,51,50,0,21,20,2,6,2,21,21,1,37,17,6,6,21,20,1,17,5,54,53,
+52,38,3,54,55,55,54,55,37,5,22,18,2,92,80,61,68,185,108,1,42,247,241,1,50,
+105,162,220,254,71,1,76,177,216,1,239,1,76,60,221,209,32,42,89,113,45,254,
+178,254,180,44,250,102,18,76,173,79,88,225,1,9,126,243,1,38,254,213,238,126,
+255,0,231,254,191,106,10,3,32,117,2,53,12,236,184,126,2,46,253,203,117,138,
+112,178,240,251,27,66,60,128,156,81,121,119,73,254,202,0,0,6,0,102,255,61,
+5,106,5,205,0,44,0,67,0,77,0,88,0,97,0,107,0,0,1,7,22,23,54,54,51,50,22,21,
+20,6,7,22,21,20,2,7,22,51,21,34,36,0,53,52,55,38,38,53,52,54,51,50,22,23,
+54,55,39,55,23,53,51,21,55,1,22,23,54,54,55,38,38,53,52,54,55,38,38,35,34,
+6,7,22,22,21,20,6,1,6,6,21,20,22,23,54,53,52,37,54,55,38,38,35,34,6,21,20,
+22,37,22,23,54,53,52,38,35,34,1,54,54,53,52,38,39,6,21,20,3,199,142,55,52,
+54,130,66,91,113,101,99,55,194,177,175,176,230,254,63,254,242,47,106,111,
+114,91,57,126,63,53,56,140,78,98,93,98,254,49,98,246,90,155,50,132,75,78,
+96,61,156,78,77,145,52,93,75,86,2,30,68,58,65,80,33,252,254,42,58,35,87,40,
+46,56,85,2,216,67,43,156,55,47,75,253,52,80,57,52,60,41,5,117,221,16,27,69,
+88,108,88,85,119,26,114,117,164,254,168,145,72,103,222,1,109,204,143,121,
+25,121,88,88,108,76,77,27,14,219,49,166,205,205,166,251,203,206,136,69,178,
+93,67,115,74,91,136,72,75,88,89,81,71,132,89,79,117,1,151,51,100,60,47,78,
+39,92,82,95,228,72,49,47,64,52,42,51,71,103,54,63,35,101,41,53,253,45,42,
+70,46,57,94,49,102,125,69,0,2,0,102,255,236,3,119,5,86,0,18,0,37,0,0,4,38,
+53,52,54,54,53,52,38,53,52,54,51,50,18,17,16,0,35,2,6,21,20,22,22,21,20,6,
+21,20,22,51,50,18,17,52,2,35,1,31,154,63,121,215,170,142,223,250,254,241,
+196,99,116,144,71,184,93,91,146,216,195,173,20,149,131,73,125,157,59,78,221,
+114,130,149,254,160,254,205,254,193,254,104,5,4,96,81,65,155,119,74,102,223,
+89,78,100,1,107,1,10,241,1,56,0,2,0,41,255,236,4,47,6,82,0,37,0,56,0,0,4,
+38,53,52,54,54,53,52,38,53,52,55,39,55,23,54,55,39,55,23,55,53,51,17,23,55,
+23,7,22,23,55,23,7,22,17,16,0,35,2,6,21,20,22,22,21,20,6,21,20,22,51,50,18,
+17,52,2,35,1,172,154,87,98,215,8,211,74,190,7,40,110,102,113,49,115,38,121,
+101,113,29,10,190,74,182,139,254,241,196,99,116,154,61,184,93,91,148,215,
+198,171,20,149,131,82,147,131,54,79,218,116,29,45,187,88,168,8,33,229,51,
+235,10,254,255,0,8,235,53,223,16,9,168,88,160,176,254,187,254,193,254,104,
+5,4,96,81,67,163,114,69,102,223,89,78,100,1,107,1,10,240,1,57,0,7,0,102,255,
+145,3,41,6,76,0,29,0,36,0,43,0,46,0,49,0,52,0,55,0,0,5,1,53,51,53,38,38,53,
+52,54,55,53,35,53,1,51,1,21,35,21,22,22,21,20,6,7,21,51,21,1,19,17,54,54,
+53,52,38,3,17,6,6,21,20,22,19,21,51,3,21,55,7,53,35,19,53,7,1,156,254,241,
+254,127,166,168,125,254,1,15,71,1,13,254,135,176,178,133,254,254,243,15,89,
+120,117,195,84,106,105,188,129,129,129,232,129,129,129,111,1,95,59,111,20,
+196,132,133,195,20,108,60,1,82,254,174,60,106,16,199,135,136,200,14,109,59,
+254,161,4,93,254,16,14,142,92,91,141,254,36,1,231,20,135,88,87,136,3,159,
+166,251,201,174,174,174,174,4,55,166,166,0,0,4,0,102,0,0,4,193,5,74,0,27,
+0,40,0,61,0,73,0,0,19,52,54,51,50,4,21,20,6,7,22,22,21,20,6,35,34,39,6,7,
+7,6,7,35,53,16,2,39,23,18,18,23,54,54,55,55,18,19,6,35,34,1,7,22,51,50,54,
+53,52,38,35,35,7,54,51,50,22,21,20,6,35,34,2,54,53,52,38,35,34,6,21,20,22,
+51,102,254,181,177,1,3,17,36,124,173,185,133,44,34,13,9,216,122,53,103,115,
+84,154,75,69,4,57,146,89,15,34,85,121,176,162,1,219,19,32,36,89,126,126,89,
+2,27,13,16,32,46,46,32,31,197,189,183,140,142,178,184,136,4,162,68,100,99,
+69,13,40,144,8,181,126,132,186,9,130,165,13,7,50,78,1,49,2,90,176,104,254,
+255,254,61,228,28,13,2,185,1,170,1,32,45,254,106,143,10,126,89,89,126,144,
+7,46,32,32,46,2,12,40,26,26,39,39,26,26,40,0,3,0,102,255,164,3,225,5,205,
+0,13,0,24,0,34,0,0,19,54,36,51,51,22,22,21,16,3,35,2,0,39,5,6,6,7,22,18,23,
+55,18,17,52,39,38,39,6,4,7,22,23,54,54,102,154,1,237,156,45,19,24,186,102,
+66,254,205,230,3,17,119,209,102,121,153,31,44,85,14,10,9,141,254,139,115,
+84,90,113,231,5,55,59,91,79,226,109,254,71,253,46,1,163,2,172,253,97,23,106,
+71,206,254,70,210,241,1,204,1,5,50,151,67,41,4,61,37,94,131,78,116,0,3,0,
+102,255,143,3,0,5,205,0,24,0,38,0,52,0,0,19,55,4,0,17,16,7,22,21,20,6,35,
+34,38,53,52,55,38,38,53,52,18,53,52,38,18,22,51,50,54,53,52,2,39,22,21,20,
+2,21,19,6,21,20,22,51,50,54,53,52,39,6,35,34,102,72,1,17,1,65,139,24,122,
+82,82,123,16,69,82,145,82,39,128,99,109,119,203,176,69,145,143,8,62,41,42,
+60,14,40,59,52,5,137,68,140,254,16,254,232,254,240,109,42,54,86,119,119,86,
+42,38,42,147,100,131,1,86,96,99,208,252,43,129,182,160,201,1,138,139,124,
+149,127,254,189,119,254,184,14,27,43,59,61,41,21,26,14,0,0,4,0,102,0,0,5,
+197,4,240,0,34,0,37,0,44,0,51,0,0,1,38,38,35,34,7,19,33,17,35,1,33,1,35,17,
+33,19,38,38,35,34,6,7,39,54,54,51,50,22,23,54,51,50,22,23,1,33,3,1,54,54,
+55,35,21,20,1,23,22,23,38,53,53,5,98,24,149,99,161,87,223,1,123,102,254,180,
+254,57,254,179,103,1,123,223,46,138,82,102,145,23,99,25,203,141,95,169,60,
+113,200,143,202,24,252,180,1,76,166,253,200,25,50,147,215,3,137,135,65,21,
+6,3,168,103,122,129,254,137,253,111,2,43,253,213,2,145,1,117,63,68,122,103,
+20,126,182,74,70,144,187,121,254,213,1,21,253,8,49,89,243,225,89,1,58,225,
+111,45,52,104,225,0,4,0,102,255,236,3,225,5,182,0,21,0,33,0,39,0,50,0,0,1,
+17,33,17,54,51,50,22,21,20,7,22,22,21,20,4,35,34,36,53,52,54,0,54,53,52,38,
+35,34,6,21,20,22,51,19,23,17,35,17,55,23,22,23,54,54,53,52,38,35,34,7,1,152,
+1,22,20,25,74,108,53,62,71,254,253,187,183,254,250,168,1,165,200,204,140,
+140,202,200,142,18,19,74,19,157,47,29,22,27,48,32,26,19,2,139,3,43,253,180,
+7,107,76,74,53,48,127,72,141,203,200,144,111,180,253,235,143,99,101,142,141,
+102,101,141,2,76,2,2,180,253,76,2,19,12,12,8,39,24,32,48,16,0,4,0,102,255,
+236,6,8,5,0,0,15,0,28,0,42,0,52,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,
+36,51,18,36,54,53,52,0,35,34,0,21,20,0,51,1,38,38,35,34,6,7,39,54,36,51,50,
+4,23,39,38,38,35,34,7,54,54,51,50,3,254,1,78,188,189,254,176,196,195,254,
+177,191,191,1,77,197,164,1,33,166,254,147,254,254,254,148,1,109,253,1,170,
+78,215,125,137,203,94,80,37,1,12,195,206,1,12,38,133,51,196,130,249,121,102,
+164,100,215,5,0,179,254,210,170,172,254,211,176,175,1,45,173,172,1,45,178,
+251,82,147,254,146,226,1,67,254,189,226,225,254,190,1,168,56,63,59,60,51,
+179,214,212,181,90,96,105,201,45,35,0,0,7,0,102,255,236,8,74,4,74,0,20,0,
+41,0,45,0,49,0,53,0,65,0,77,0,0,1,7,22,22,21,20,6,35,34,38,53,52,54,55,39,
+33,53,33,55,51,1,33,1,51,23,33,21,33,7,22,22,21,20,6,35,34,38,53,52,54,55,
+39,5,55,39,7,33,39,7,23,1,17,35,17,0,6,21,20,22,51,50,54,53,52,38,35,4,54,
+53,52,38,35,34,6,21,20,22,51,3,199,197,59,72,131,96,94,131,69,57,178,254,
+217,1,39,240,72,1,2,1,34,1,0,72,242,1,39,254,217,180,57,72,133,93,96,131,
+72,57,195,253,185,180,180,180,4,213,181,180,180,254,125,102,1,182,74,75,50,
+51,72,73,50,252,199,74,74,51,50,73,72,51,2,94,196,28,109,68,92,133,131,94,
+68,109,28,180,102,242,255,0,1,0,242,102,180,28,109,68,95,130,133,92,68,109,
+28,196,145,180,180,180,180,180,180,2,125,253,139,2,117,253,0,74,51,50,73,
+72,51,51,74,248,73,50,51,74,75,50,51,72,0,0,4,0,102,255,119,7,141,6,12,0,
+15,0,31,0,70,0,108,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,18,36,18,
+53,52,2,36,35,34,4,2,21,20,18,4,51,1,33,22,51,50,54,55,23,6,35,34,2,17,52,
+18,51,50,22,23,7,38,35,34,6,7,33,21,33,7,33,21,33,21,33,21,33,22,23,33,5,
+33,22,51,50,55,23,6,35,34,2,17,52,18,51,50,22,23,7,38,35,34,6,7,33,21,33,
+7,33,21,33,21,33,21,33,22,23,33,4,240,1,167,246,248,254,89,244,244,254,91,
+251,248,1,164,248,219,1,120,218,221,254,137,217,214,254,138,225,221,1,121,
+215,1,196,254,201,56,92,31,52,25,80,74,106,148,170,164,137,60,92,37,78,42,
+69,38,69,26,1,49,254,170,18,1,104,254,142,1,114,254,150,6,10,1,90,253,244,
+254,201,56,91,66,43,80,74,106,148,170,164,137,60,91,38,78,42,69,38,69,26,
+1,49,254,170,18,1,104,254,141,1,115,254,150,6,10,1,90,6,12,225,254,123,229,
+229,254,121,222,221,1,133,232,230,1,132,225,249,209,199,1,85,200,202,1,87,
+196,192,254,167,204,201,254,168,195,1,156,131,31,42,55,121,1,46,1,10,253,
+1,58,45,57,62,62,64,55,103,90,102,90,103,46,44,102,131,73,55,121,1,46,1,10,
+253,1,58,45,57,62,62,64,55,103,90,102,90,103,46,44,0,0,1,0,184,255,236,4,
+51,5,213,0,11,0,0,23,17,51,5,21,5,5,21,5,5,21,1,184,60,3,63,253,137,2,119,
+253,166,2,90,252,193,20,5,233,229,74,227,179,73,209,180,74,254,244,0,0,1,
+0,102,255,109,2,217,6,90,0,70,0,0,19,55,38,39,55,23,55,23,7,22,23,55,23,7,
+22,23,55,23,7,23,51,21,35,6,7,23,7,39,6,7,23,7,39,6,7,23,7,39,6,7,39,55,39,
+55,23,54,55,39,55,23,54,55,39,55,23,55,35,53,51,39,7,39,55,38,39,7,39,55,
+38,39,7,102,148,30,42,82,76,153,60,162,38,26,167,39,174,9,26,187,18,191,11,
+186,186,7,4,191,18,187,14,21,174,39,167,24,42,164,60,155,34,40,82,72,148,
+60,137,30,25,168,39,162,15,16,174,18,170,8,178,178,8,170,18,174,9,22,162,
+39,170,33,22,139,5,80,98,52,55,61,110,104,84,111,72,71,70,92,72,33,121,33,
+100,33,143,103,114,31,31,100,30,86,65,72,92,68,66,78,108,84,104,56,54,61,
+104,101,84,94,56,71,69,92,67,46,83,30,101,29,127,103,127,29,100,29,48,83,
+68,93,69,84,41,94,0,7,0,102,255,100,4,119,6,74,0,40,0,68,0,83,0,98,0,110,
+0,120,0,130,0,0,19,33,54,54,51,50,18,21,20,7,22,21,20,7,22,21,20,2,35,34,
+38,39,33,53,55,39,53,55,39,53,55,39,53,55,39,53,55,39,53,55,39,1,38,53,53,
+35,21,7,23,21,7,23,21,7,23,21,7,23,21,7,23,21,51,53,52,55,38,53,52,19,22,
+22,51,50,54,53,52,39,6,7,21,20,6,35,19,22,23,54,53,52,38,35,34,6,7,51,50,
+22,21,18,54,53,52,38,35,34,6,21,20,22,51,3,50,54,53,53,38,39,6,21,21,17,21,
+20,23,54,55,53,52,38,35,102,1,179,22,165,105,123,178,55,68,70,57,178,123,
+105,164,23,254,77,125,125,125,125,125,125,125,125,125,125,125,125,1,226,56,
+149,121,121,121,121,121,123,123,121,121,121,149,58,66,119,21,104,65,82,117,
+41,32,68,95,67,162,49,53,39,117,82,65,105,20,86,68,94,27,126,124,85,85,123,
+124,84,106,25,34,61,51,41,39,53,61,34,25,4,225,155,206,254,236,195,150,121,
+59,78,78,63,125,150,195,254,236,205,156,76,57,53,60,47,49,59,47,49,60,47,
+49,60,47,49,59,47,54,254,204,123,150,8,60,43,47,59,51,47,60,47,47,59,52,47,
+59,47,55,60,8,159,118,62,77,71,253,171,115,143,219,149,121,101,14,13,143,
+68,94,2,233,5,21,92,123,150,218,144,114,95,67,254,35,71,50,50,71,71,50,49,
+72,254,209,35,23,145,6,23,96,128,8,3,72,8,125,92,22,6,137,25,35,0,0,7,0,102,
+0,0,8,197,5,2,0,27,0,44,0,61,0,65,0,75,0,85,0,95,0,0,1,33,17,33,4,0,17,21,
+33,39,54,54,53,52,38,35,34,6,21,20,23,7,33,53,16,0,37,33,19,6,2,7,33,38,53,
+52,18,55,38,39,6,6,35,34,38,1,38,2,39,6,6,35,34,38,39,6,7,22,18,21,20,7,1,
+33,53,33,5,22,22,51,50,54,55,38,35,34,7,6,7,22,22,51,50,54,53,52,5,38,39,
+6,21,20,22,51,50,54,1,43,6,213,254,90,1,31,1,76,253,0,74,14,19,152,110,108,
+155,33,74,253,0,1,76,1,27,254,94,174,112,140,14,2,110,20,206,146,105,77,31,
+151,92,73,121,6,91,14,139,111,40,118,71,94,152,31,80,102,145,207,20,251,163,
+6,9,249,247,2,72,2,109,78,77,109,4,112,81,81,213,185,145,26,82,50,77,113,
+3,135,149,179,16,113,78,48,80,5,2,254,234,138,253,235,254,199,20,84,32,92,
+44,141,209,208,142,99,69,84,20,1,59,2,21,136,254,208,118,254,207,175,69,81,
+182,1,9,6,4,67,86,104,62,253,222,174,1,48,118,52,60,104,88,69,4,6,254,246,
+181,81,69,3,236,74,197,70,106,103,73,21,48,59,125,38,46,110,79,43,152,130,
+56,38,39,79,110,45,0,14,0,102,255,127,9,4,6,147,0,30,0,53,0,81,0,89,0,97,
+0,101,0,105,0,109,0,114,0,120,0,125,0,135,0,145,0,155,0,0,1,6,6,7,7,3,54,
+0,55,38,38,53,52,54,51,50,22,21,20,7,7,22,0,23,3,39,38,38,39,17,33,55,33,
+17,52,38,53,52,54,54,53,52,38,35,34,6,21,20,22,22,21,20,6,21,23,38,53,52,
+54,51,50,22,21,20,7,22,21,20,7,22,21,20,6,35,34,38,53,52,55,38,53,52,3,6,
+7,23,54,55,54,54,37,20,22,23,22,23,55,38,5,7,23,55,5,39,7,23,37,7,23,55,5,
+54,55,39,7,5,7,7,23,23,55,5,55,55,39,7,0,54,53,52,38,35,34,21,20,51,18,54,
+53,52,38,35,34,21,20,51,22,54,53,52,38,35,34,21,20,51,3,156,88,196,169,143,
+226,199,1,149,187,43,62,236,180,192,226,74,30,191,1,147,196,225,146,184,184,
+82,253,205,102,1,102,51,130,57,169,147,142,171,55,131,51,92,26,64,48,48,67,
+29,29,29,29,67,48,48,64,24,24,121,166,193,113,92,115,9,30,1,213,28,11,97,
+110,112,197,1,9,119,61,121,251,13,119,64,123,5,113,123,61,121,249,215,40,
+20,121,60,6,224,117,2,33,32,111,248,223,31,33,119,55,3,212,19,19,14,30,30,
+14,19,19,14,30,30,14,19,19,14,30,30,2,133,87,161,125,108,1,43,205,1,10,53,
+43,153,83,190,227,226,191,132,108,39,55,254,245,202,254,213,108,136,156,81,
+252,250,102,2,220,59,98,41,57,111,129,66,146,169,172,143,63,131,112,57,36,
+103,59,150,50,67,75,103,103,75,70,47,47,70,70,46,47,70,73,103,102,74,70,47,
+46,70,71,1,136,33,120,148,77,122,28,49,25,25,49,28,106,93,148,121,167,155,
+49,161,112,155,43,161,112,161,46,158,158,28,18,161,49,53,154,2,20,25,148,
+148,24,21,156,53,254,168,43,41,40,46,86,84,1,231,44,40,40,46,86,84,244,44,
+40,41,45,86,84,0,0,4,0,102,255,172,3,231,6,61,0,22,0,26,0,38,0,45,0,0,0,22,
+21,20,6,7,17,33,17,35,3,35,3,35,17,33,17,38,38,53,52,54,51,1,33,53,33,0,54,
+53,52,38,35,34,6,21,20,22,51,19,54,54,19,33,19,22,2,140,147,108,89,1,141,
+190,201,102,203,201,1,142,86,113,145,103,254,168,2,180,253,76,1,148,87,86,
+61,62,84,85,61,8,11,38,94,254,226,94,31,6,61,144,105,87,138,19,254,203,254,
+204,253,197,2,59,1,52,1,53,16,136,92,106,143,252,17,102,1,254,83,63,61,86,
+88,59,61,85,251,144,45,113,1,7,254,248,89,0,0,18,0,102,0,0,6,127,5,174,0,
+88,0,116,0,120,0,124,0,136,0,148,0,154,0,160,0,166,0,172,0,178,0,184,0,190,
+0,196,0,202,0,208,0,220,0,232,0,0,1,55,55,39,6,7,17,35,21,51,21,33,53,51,
+53,35,17,38,39,7,23,23,21,39,7,23,7,39,6,7,7,39,55,38,39,7,39,55,38,53,55,
+39,55,23,55,39,55,23,19,38,38,53,52,0,51,50,0,21,20,6,7,19,51,55,23,7,23,
+55,23,7,23,20,7,23,7,39,6,7,23,7,39,38,39,7,39,55,38,53,7,1,51,53,38,38,53,
+52,54,51,50,22,21,20,6,7,21,51,54,54,53,52,38,35,34,6,21,20,22,23,17,51,17,
+3,51,17,35,0,6,21,20,22,51,50,54,53,52,38,35,4,54,53,52,38,35,34,6,21,20,
+22,51,1,22,23,51,38,39,5,54,55,39,6,7,5,6,7,23,54,55,3,22,23,55,38,39,5,54,
+55,39,6,7,19,38,39,35,22,23,23,38,39,7,22,23,37,6,7,21,54,55,1,54,55,53,6,
+7,23,22,23,55,38,39,0,22,21,20,6,35,34,38,53,52,54,51,4,38,53,52,54,51,50,
+22,21,20,6,35,4,172,117,14,170,41,33,149,96,254,219,94,147,30,46,172,15,118,
+106,8,90,49,93,18,33,6,82,6,31,6,86,45,91,3,3,91,13,116,31,45,74,57,180,65,
+72,1,33,203,204,1,33,74,65,178,2,58,73,45,31,117,12,90,2,4,92,45,88,9,28,
+8,82,8,31,20,90,49,88,6,107,254,84,63,35,42,74,55,55,76,45,35,63,47,58,128,
+91,91,126,56,212,47,195,45,45,254,30,38,38,26,24,37,37,24,4,108,37,37,26,
+25,37,37,25,255,0,16,6,70,6,27,253,94,4,17,60,24,6,2,192,6,18,59,29,6,195,
+42,22,59,37,53,254,31,34,29,35,57,31,23,21,4,69,10,24,154,33,18,58,40,69,
+1,193,20,30,62,45,254,82,41,41,60,55,197,42,38,34,60,54,2,8,18,18,14,14,19,
+19,14,251,172,19,19,14,14,19,19,14,1,43,4,23,243,25,14,254,236,152,102,102,
+152,1,20,12,29,245,23,4,82,4,26,76,66,76,13,7,101,4,107,17,5,51,70,55,9,20,
+20,19,82,23,23,79,37,102,1,0,65,172,99,200,1,27,254,227,198,99,172,65,255,
+0,102,37,79,23,23,82,19,20,17,12,55,70,51,9,13,107,4,101,7,13,76,66,76,18,
+8,4,2,55,64,14,63,42,56,75,77,54,42,63,14,64,28,97,60,91,122,122,91,60,97,
+130,254,186,1,70,254,186,1,70,254,135,37,26,25,37,37,25,26,37,125,37,25,26,
+37,37,26,25,37,3,142,39,45,63,55,118,41,43,34,55,63,82,44,40,35,59,60,1,41,
+32,30,35,51,35,121,41,21,59,45,41,254,158,52,32,62,57,84,26,23,33,53,41,127,
+25,24,76,35,57,2,11,16,6,68,6,25,37,6,16,59,26,5,251,198,18,14,14,19,19,14,
+14,18,65,19,14,14,18,18,14,14,19,0,9,0,184,0,0,5,152,6,29,0,10,0,14,0,18,
+0,21,0,24,0,27,0,30,0,33,0,40,0,0,19,33,54,54,51,50,22,23,33,17,33,37,51,
+17,35,1,22,19,17,33,17,19,5,17,33,33,17,1,1,17,19,1,17,35,37,51,38,38,35,
+34,6,184,1,150,2,114,101,97,116,4,1,152,251,32,1,252,230,230,1,137,54,190,
+251,238,243,1,238,1,14,253,64,254,241,2,193,254,253,80,252,1,98,230,2,61,
+52,54,59,4,248,135,158,158,135,251,8,102,4,43,254,2,93,254,196,3,41,252,215,
+1,153,100,254,55,1,199,254,57,4,43,254,95,1,161,254,97,1,159,103,86,104,106,
+0,3,0,102,255,180,5,137,6,29,0,32,0,53,0,65,0,0,1,38,39,23,20,2,35,34,2,53,
+53,55,6,7,35,53,16,0,55,38,53,52,54,51,50,22,21,20,7,22,0,17,21,1,6,21,20,
+22,51,50,54,53,52,39,22,23,2,0,35,34,6,2,7,54,0,54,53,52,38,35,34,6,21,20,
+22,51,5,47,95,102,3,220,151,153,222,2,100,96,91,1,30,224,26,103,73,74,102,
+29,221,1,31,252,125,29,161,112,109,159,29,170,144,12,254,191,220,148,251,
+150,8,135,1,197,43,43,31,31,43,43,31,1,61,95,51,53,205,254,231,1,29,201,28,
+25,50,96,105,1,55,1,231,72,43,54,74,102,103,73,56,41,70,254,27,254,197,105,
+1,52,116,99,156,227,222,161,112,103,49,115,1,62,1,177,195,254,165,209,113,
+2,229,43,31,31,42,42,31,31,43,0,0,4,0,184,255,236,4,217,6,131,0,17,0,33,0,
+49,0,61,0,0,0,22,21,20,7,5,17,35,37,5,35,17,37,38,53,52,54,51,1,37,17,5,17,
+37,17,5,21,37,21,5,21,37,21,5,1,37,17,5,17,37,17,5,53,37,53,5,53,37,53,5,
+0,54,53,52,38,35,34,6,21,20,22,51,3,12,94,47,1,158,96,254,80,254,80,97,1,
+158,45,92,68,1,53,254,254,1,119,254,137,1,2,254,254,1,2,254,254,1,2,253,149,
+1,3,254,137,1,119,254,253,1,3,254,253,1,3,254,253,1,82,39,39,28,28,38,38,
+28,6,131,95,67,67,45,158,251,25,163,163,4,231,158,43,69,67,95,251,41,98,254,
+219,145,4,53,146,254,233,98,109,99,90,99,108,98,90,98,1,141,98,1,23,146,251,
+203,145,1,37,98,109,98,90,98,108,99,90,99,2,103,37,28,28,40,40,28,28,37,0,
+3,0,102,0,0,4,78,5,190,0,57,0,68,0,72,0,0,55,62,2,55,35,34,38,53,52,54,51,
+51,54,54,55,23,6,6,7,51,54,54,51,50,22,21,35,52,38,35,34,6,7,35,22,23,23,
+51,22,22,51,50,54,53,51,20,6,35,34,38,39,35,6,7,19,21,33,19,51,38,38,53,35,
+34,6,21,20,22,19,6,7,33,127,143,84,64,2,86,97,135,135,97,28,5,47,71,86,61,
+42,3,65,28,149,104,132,159,103,99,89,79,106,5,154,4,21,24,105,5,105,80,89,
+99,103,159,132,103,150,28,8,5,66,233,253,211,207,80,23,26,31,54,75,75,117,
+38,89,1,13,72,216,139,167,76,134,97,97,135,92,139,106,57,92,118,70,97,109,
+170,139,97,110,120,87,53,80,125,86,121,110,97,139,170,109,98,121,143,254,
+178,72,3,4,112,115,31,75,54,54,75,254,41,71,128,0,6,0,102,255,236,5,100,4,
+207,0,54,0,73,0,80,0,86,0,94,0,102,0,0,1,21,35,22,23,22,22,21,20,6,35,34,
+38,39,38,35,34,7,6,6,35,34,38,53,52,54,55,54,53,52,39,38,38,53,52,54,51,50,
+22,23,22,51,50,55,54,54,51,50,22,21,20,6,7,6,7,33,51,54,55,6,35,34,39,22,
+21,20,7,54,51,50,23,38,39,35,1,38,38,35,34,21,20,5,54,53,52,35,34,1,6,6,21,
+20,51,50,54,37,22,22,51,50,53,52,38,5,37,238,5,16,135,145,70,57,78,124,35,
+143,132,133,141,35,121,82,57,70,146,135,20,20,138,143,69,58,82,121,35,124,
+150,149,126,35,123,79,58,69,141,139,17,4,254,176,234,4,12,124,128,130,124,
+19,19,119,135,133,119,12,4,234,254,125,24,64,35,28,3,153,152,29,72,252,203,
+69,82,28,35,64,3,26,23,66,34,29,83,2,150,103,141,76,37,125,82,52,66,145,135,
+25,25,131,149,67,51,82,125,37,124,140,140,122,38,124,82,51,68,150,131,24,
+24,134,147,68,51,81,125,38,97,109,98,84,21,21,103,135,134,107,22,22,91,103,
+1,162,74,77,34,69,48,48,69,34,252,129,21,60,35,35,76,75,75,76,35,35,60,0,
+0,2,0,102,255,231,3,229,5,250,0,26,0,38,0,0,5,1,55,1,17,1,39,37,38,38,53,
+52,54,51,50,22,21,20,6,7,5,7,1,17,1,23,1,18,54,53,52,38,35,34,6,21,20,22,
+51,2,2,254,102,62,1,76,254,178,62,1,45,73,88,175,132,129,180,89,75,1,47,61,
+254,176,1,80,61,254,101,49,121,121,86,87,118,118,87,25,1,64,82,254,250,3,
+12,254,248,82,235,37,148,88,127,182,180,129,87,146,40,235,82,1,6,252,246,
+1,8,82,254,190,4,17,117,88,87,119,122,84,86,119,0,3,0,102,255,236,5,133,5,
+254,0,41,0,48,0,55,0,0,1,52,38,35,34,6,21,21,22,22,21,20,6,7,21,20,6,35,34,
+38,53,51,20,22,51,50,54,53,53,38,38,53,52,54,55,53,52,54,51,50,22,21,5,17,
+54,54,53,52,38,3,17,6,6,21,20,22,5,31,143,115,113,135,128,173,171,130,195,
+157,157,194,103,132,116,114,135,129,170,171,128,200,151,160,200,253,160,85,
+114,114,188,86,110,110,4,88,144,176,160,135,27,18,198,132,131,198,19,29,187,
+218,217,186,136,165,158,139,35,18,199,131,130,200,18,27,179,218,234,188,106,
+254,24,18,136,90,90,136,254,42,1,232,18,138,88,88,138,0,0,7,0,102,255,156,
+5,63,6,86,0,18,0,21,0,24,0,27,0,30,0,33,0,36,0,0,23,1,5,39,1,5,39,1,51,1,
+7,37,1,7,37,1,7,37,5,1,17,5,5,17,5,5,17,5,1,17,1,1,17,1,1,17,1,102,1,215,
+254,86,45,1,215,254,86,45,2,58,102,2,57,45,254,86,1,215,45,254,86,1,215,45,
+253,193,253,192,2,115,1,96,254,160,1,96,254,160,1,96,254,58,254,159,1,97,
+254,159,1,97,254,159,41,2,47,127,60,2,47,127,59,2,168,253,88,59,127,253,209,
+60,127,253,209,59,172,172,6,22,254,199,103,79,254,202,102,80,254,203,103,
+2,82,1,58,254,96,254,123,1,57,254,96,4,62,1,55,254,98,0,0,4,0,184,0,0,3,205,
+5,225,0,28,0,38,0,48,0,60,0,0,0,22,21,20,6,7,21,23,22,22,21,20,6,7,6,6,35,
+34,39,39,17,35,17,38,38,53,52,54,51,19,5,22,51,50,54,53,52,38,39,21,21,23,
+22,51,50,54,55,38,39,2,54,53,52,38,35,34,6,21,20,22,51,1,176,100,69,53,166,
+143,254,42,32,4,86,55,89,104,151,103,56,67,102,72,52,1,26,83,44,22,27,210,
+248,202,89,44,17,26,5,73,85,248,43,43,29,29,42,42,29,5,225,103,71,60,90,16,
+26,88,76,145,89,49,84,24,77,97,71,101,253,186,4,141,17,91,58,72,102,253,170,
+188,55,45,26,36,126,127,242,75,136,59,31,20,13,57,2,115,42,29,29,43,43,29,
+29,42,0,4,0,102,255,236,4,8,5,215,0,36,0,47,0,54,0,64,0,0,1,7,22,21,20,2,
+4,7,39,54,54,53,52,38,39,7,39,55,38,53,52,55,38,38,53,52,54,51,50,22,21,20,
+7,55,50,23,55,1,54,0,53,52,39,5,22,22,21,20,3,37,38,35,34,6,21,18,53,52,38,
+35,34,21,20,22,51,4,8,145,96,173,254,161,248,31,107,129,108,21,135,50,156,
+4,72,54,65,78,61,86,123,4,41,124,97,170,253,150,237,1,23,86,254,94,19,122,
+162,1,97,53,64,106,130,97,62,35,47,62,35,4,127,80,131,201,175,254,165,217,
+20,67,94,205,74,81,198,51,72,90,84,16,39,115,88,31,116,70,75,93,145,97,16,
+12,2,78,92,251,139,51,1,122,210,173,110,223,50,226,103,171,2,144,189,30,124,
+93,1,25,65,50,90,66,51,88,0,9,0,102,255,236,6,57,5,172,0,20,0,25,0,30,0,42,
+0,54,0,57,0,60,0,72,0,84,0,0,1,1,51,1,21,33,21,33,21,20,2,4,35,34,36,2,53,
+53,33,53,33,1,54,36,55,33,33,22,4,23,17,4,22,21,20,6,35,34,38,53,52,54,51,
+32,22,21,20,6,35,34,38,53,52,54,51,3,51,17,51,17,51,0,54,53,52,38,35,34,6,
+21,20,22,51,32,54,53,52,38,35,34,6,21,20,22,51,1,150,1,135,102,1,135,254,
+121,2,182,190,254,169,214,211,254,170,191,2,183,254,121,1,237,240,1,77,11,
+253,184,253,82,8,1,76,244,1,100,94,93,64,66,90,92,64,254,92,92,92,66,66,89,
+90,65,59,252,102,252,253,244,32,32,23,23,30,30,23,1,253,32,32,23,23,31,31,
+23,3,61,2,111,253,145,71,162,35,166,254,245,148,147,1,13,165,35,162,253,94,
+14,236,160,159,237,14,1,154,27,89,69,68,87,90,65,68,90,92,66,65,90,89,66,
+67,91,1,137,1,148,254,108,253,164,30,23,23,33,33,23,23,30,30,23,23,33,33,
+23,23,30,0,3,0,102,255,238,3,133,6,55,0,19,0,31,0,39,0,0,1,17,22,22,21,20,
+6,7,22,21,20,6,35,34,38,53,52,54,55,17,18,54,53,52,38,35,34,6,21,20,22,51,
+19,22,23,54,53,52,38,39,1,240,187,218,83,85,58,203,142,140,204,166,125,153,
+142,142,100,100,141,141,100,50,93,75,135,167,136,6,55,254,49,7,168,132,75,
+159,71,94,96,144,200,200,144,128,192,20,3,157,250,29,142,100,101,140,140,
+101,99,143,2,70,14,60,111,118,89,111,5,0,0,3,0,102,1,18,3,59,4,172,0,35,0,
+39,0,43,0,0,1,21,33,53,51,21,51,21,35,21,51,21,35,21,51,21,35,21,35,53,33,
+21,35,53,35,53,51,53,35,53,51,53,35,53,51,53,19,33,53,33,53,33,53,33,1,72,
+1,18,103,122,122,122,122,122,122,103,254,238,103,123,123,123,123,123,123,
+103,1,18,254,238,1,18,254,238,4,172,174,174,174,102,134,102,133,102,175,175,
+175,175,102,133,102,134,102,174,253,123,133,102,134,0,0,2,0,102,0,145,4,123,
+5,61,0,28,0,40,0,0,1,39,55,23,54,55,3,55,19,55,51,23,19,23,3,22,23,55,23,
+7,22,21,20,0,35,34,0,53,52,0,54,53,52,38,35,34,6,21,20,22,51,1,20,174,82,
+166,61,60,100,98,102,26,26,51,106,97,103,64,59,166,84,176,106,254,244,186,
+188,254,247,2,87,206,205,147,145,206,207,144,3,123,250,57,237,45,20,1,27,
+32,254,222,2,4,1,36,32,254,229,21,44,237,57,250,130,163,188,254,247,1,11,
+186,165,253,253,205,145,146,206,209,143,143,207,0,0,4,0,102,255,141,4,23,
+6,63,0,9,0,19,0,26,0,33,0,0,1,39,55,23,17,51,17,55,23,7,17,23,7,39,17,35,
+17,7,39,55,39,7,39,55,39,55,23,33,55,23,7,23,7,39,2,27,250,69,166,103,166,
+69,252,252,69,166,103,166,69,250,117,246,74,211,211,74,246,1,49,246,74,211,
+211,74,246,3,127,246,73,161,2,34,253,222,161,73,246,254,207,246,74,160,253,
+223,2,33,160,74,246,115,250,69,217,217,70,252,252,70,217,217,69,250,0,18,
+0,102,255,215,6,143,6,0,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,
+0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,0,19,33,17,33,17,33,17,33,17,33,
+17,33,37,33,17,33,19,21,51,53,5,51,53,35,17,51,53,35,19,51,53,35,17,51,53,
+35,5,21,51,53,1,51,53,35,53,51,53,35,3,53,35,21,1,53,35,21,5,51,53,35,37,
+51,53,35,23,51,53,35,53,51,53,35,7,51,53,35,1,51,53,35,102,1,236,2,82,1,235,
+254,21,253,174,254,20,2,82,1,133,254,123,246,143,254,123,144,144,144,144,
+246,143,143,143,143,1,236,143,254,123,143,143,143,143,103,143,2,123,143,253,
+30,144,144,254,21,143,143,246,143,143,143,143,246,143,143,1,235,144,144,4,
+20,1,236,254,20,253,175,254,20,1,236,102,1,133,1,236,144,144,144,144,254,
+122,144,252,143,144,2,81,144,246,143,143,254,123,143,103,143,252,143,144,
+144,1,236,143,143,246,144,102,143,143,143,103,143,143,143,252,143,144,0,0,
+2,0,102,0,0,5,135,5,188,0,13,0,17,0,0,1,52,0,35,34,0,17,35,16,0,33,32,0,17,
+37,17,35,17,5,33,254,200,243,245,254,204,103,1,109,1,35,1,27,1,118,253,162,
+102,3,0,255,1,87,254,170,255,0,1,45,1,143,254,111,254,213,123,252,133,3,123,
+0,11,0,102,255,10,6,61,6,188,0,49,0,104,0,158,0,205,0,252,1,41,1,86,1,128,
+1,172,1,177,1,182,0,0,0,6,7,22,21,20,6,7,22,21,20,6,7,22,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,55,38,38,53,52,55,38,38,53,52,55,38,38,53,52,54,36,
+51,50,4,22,21,38,36,39,22,22,51,55,50,30,3,51,55,50,22,51,50,54,51,50,22,
+21,20,35,34,38,39,39,38,35,34,6,35,34,38,39,7,35,34,38,38,39,39,46,2,39,7,
+22,22,51,50,54,53,1,39,6,7,7,6,20,14,3,35,35,39,6,6,35,34,38,35,34,6,35,34,
+53,52,54,51,50,22,51,50,54,51,23,50,54,55,55,54,54,51,23,50,54,55,6,4,21,
+20,22,51,50,54,19,53,39,7,6,6,7,22,21,20,35,7,7,39,20,6,35,39,34,6,35,34,
+53,52,54,51,50,23,52,51,51,38,53,52,54,54,55,39,14,2,21,20,22,51,50,18,4,
+38,38,39,7,23,22,22,21,20,7,51,50,21,54,51,50,22,21,20,35,34,38,35,7,34,38,
+53,7,39,39,34,53,52,55,38,38,39,39,7,21,20,18,51,50,54,53,1,22,22,51,55,50,
+22,51,55,50,23,54,51,50,22,21,20,35,34,39,39,6,35,34,39,6,35,34,38,39,6,35,
+34,38,39,21,22,22,51,50,54,53,52,36,39,35,6,4,21,20,22,51,50,54,55,53,6,6,
+35,34,39,6,6,35,34,39,6,35,34,39,7,6,35,34,53,52,54,51,50,23,54,51,23,50,
+54,51,23,50,54,55,3,39,6,6,15,2,14,2,35,39,34,6,6,35,34,38,53,52,54,54,51,
+50,62,4,55,39,6,7,7,6,6,21,20,22,51,50,54,4,38,39,39,38,38,39,7,30,4,51,50,
+22,22,21,20,6,35,34,38,38,35,7,34,38,39,39,38,38,35,39,38,38,39,7,22,22,51,
+50,54,53,1,6,7,54,51,51,50,23,38,39,6,61,115,106,162,83,73,101,89,73,84,124,
+97,109,178,47,51,176,107,98,123,84,75,87,100,72,83,162,106,116,207,1,95,190,
+191,1,94,206,102,254,210,208,17,22,16,27,22,23,13,47,26,4,31,37,28,7,8,27,
+14,24,29,35,13,12,3,5,3,7,8,22,11,20,29,14,15,18,41,31,43,10,20,9,11,52,45,
+4,94,221,100,73,81,253,47,4,27,14,24,35,34,58,20,30,20,18,15,14,29,20,11,
+22,8,10,12,21,35,28,25,14,27,8,7,28,37,31,5,28,24,18,7,25,28,26,14,22,20,
+213,254,215,80,73,101,221,121,4,15,10,26,23,8,47,26,12,7,27,24,37,10,39,13,
+20,41,25,23,11,68,14,4,67,27,21,4,74,219,68,66,53,120,165,1,246,68,220,73,
+4,14,23,78,4,14,67,11,24,24,42,21,13,38,10,37,23,28,7,13,25,47,8,23,27,9,
+15,4,166,119,52,67,254,110,44,101,3,28,15,49,18,45,37,12,15,30,30,50,28,26,
+15,11,28,21,46,17,16,29,16,36,14,32,5,15,49,73,89,216,105,55,70,254,216,239,
+102,240,254,217,69,56,106,217,87,75,44,18,5,32,13,37,16,29,16,17,46,22,28,
+20,9,22,28,49,30,32,13,12,38,45,17,52,13,28,8,85,55,8,7,65,32,15,15,21,40,
+14,5,28,25,21,16,30,25,16,19,46,13,44,16,8,15,80,6,60,69,9,56,119,93,81,77,
+61,54,104,196,2,134,80,77,92,48,92,37,8,116,12,85,17,5,19,44,12,47,19,16,
+25,30,16,21,25,18,11,1,4,4,62,8,15,14,34,65,6,57,196,104,54,60,253,187,107,
+114,113,108,102,108,113,114,107,4,140,119,7,97,150,72,95,16,90,121,79,107,
+14,100,132,94,117,144,122,125,141,119,92,132,100,13,110,77,120,91,16,95,72,
+150,97,7,118,107,116,211,127,128,210,116,121,198,25,21,16,4,45,37,8,59,2,
+91,13,52,34,53,18,12,20,9,10,31,51,2,70,14,10,19,8,38,19,47,2,200,230,67,
+64,1,43,2,29,10,14,17,20,43,24,50,18,2,51,31,10,59,53,34,52,13,91,2,62,3,
+6,2,76,4,12,25,26,197,121,63,68,230,252,7,10,3,69,48,51,15,19,26,57,2,3,1,
+37,43,4,61,26,44,65,4,73,13,18,40,40,64,75,2,105,139,113,73,46,62,1,10,84,
+114,136,106,2,48,86,42,43,18,13,73,4,64,45,26,61,4,41,39,1,3,2,57,26,19,15,
+52,47,69,3,10,228,254,245,62,46,4,49,9,52,4,59,4,58,15,58,28,41,33,18,23,
+68,6,24,21,8,53,16,4,116,130,47,42,110,139,2,2,139,110,42,47,132,114,4,16,
+53,8,20,25,6,68,23,35,16,41,28,58,15,58,4,59,4,50,11,254,166,2,68,85,13,3,
+1,2,33,51,2,48,30,15,12,21,20,76,15,55,13,13,72,65,4,56,56,44,39,91,60,43,
+61,232,65,89,38,44,22,53,37,4,111,38,13,46,25,75,21,21,12,15,30,48,2,15,13,
+26,26,7,3,12,87,67,2,168,231,61,43,3,234,181,94,21,21,94,181,0,7,0,102,255,
+172,5,223,6,55,0,64,0,67,0,70,0,73,0,76,0,79,0,82,0,0,19,1,51,5,17,39,38,
+39,7,33,53,1,51,5,37,51,1,21,33,39,7,6,7,17,37,51,1,21,33,39,6,6,7,17,37,
+51,1,21,33,39,6,6,7,17,51,21,33,53,51,17,38,38,39,7,33,53,1,51,5,17,38,38,
+39,7,33,1,23,51,3,23,51,1,51,55,33,23,51,1,51,55,3,51,55,102,1,37,99,1,2,
+76,166,33,35,254,172,1,37,99,1,53,1,53,98,1,37,254,172,37,69,146,57,1,2,98,
+1,37,254,172,37,50,159,63,1,2,98,1,37,254,172,37,50,164,58,203,254,4,203,
+59,154,62,35,254,172,1,37,99,1,2,64,149,62,35,254,172,4,109,20,101,121,20,
+101,251,174,100,21,3,96,20,101,251,174,100,21,121,100,21,3,92,1,17,148,1,
+86,41,97,18,254,90,1,16,172,172,254,240,90,254,39,88,29,254,170,148,254,239,
+90,254,26,96,34,254,170,146,254,239,90,254,26,100,29,254,122,102,102,1,134,
+30,92,33,254,90,1,17,146,1,86,33,90,33,254,2,164,115,254,168,115,254,52,114,
+114,3,151,115,253,194,115,0,0,3,0,102,0,0,4,168,5,12,0,25,0,28,0,31,0,0,1,
+17,33,17,51,1,17,38,38,53,52,54,55,53,51,17,35,34,6,21,20,22,51,51,17,1,7,
+5,41,2,37,4,168,251,190,72,1,166,131,174,165,140,102,75,97,133,133,97,75,
+1,166,30,254,213,1,43,252,139,1,41,254,215,1,244,254,12,1,244,254,170,2,16,
+4,115,86,86,114,7,194,254,215,62,42,43,60,253,138,1,86,154,244,244,0,3,0,
+102,255,236,4,20,4,227,0,13,0,36,0,57,0,0,36,0,35,34,0,53,52,18,18,51,50,
+18,18,21,1,55,39,53,55,39,53,55,39,53,55,39,53,55,39,53,55,39,6,2,21,20,22,
+1,21,7,23,21,7,23,21,7,23,21,7,23,21,54,54,53,52,2,39,7,4,20,254,252,213,
+212,254,255,151,239,81,81,235,155,254,11,22,127,127,127,127,127,127,127,127,
+127,92,67,97,161,185,1,73,123,123,123,125,125,123,123,123,105,118,134,103,
+125,255,254,237,1,17,222,149,1,101,1,14,254,249,254,151,152,254,119,12,64,
+69,56,57,68,57,57,70,55,60,67,55,60,67,72,35,95,254,154,135,171,212,3,6,65,
+64,53,72,53,57,70,59,54,71,53,66,20,42,191,133,129,1,59,115,98,0,4,0,102,
+0,170,5,129,4,229,0,27,0,31,0,35,0,39,0,0,19,51,53,35,53,51,17,51,17,33,17,
+51,17,51,21,35,21,51,21,35,17,35,17,33,17,35,17,35,37,33,53,33,19,17,51,25,
+2,35,17,102,246,246,246,103,2,98,102,246,246,246,246,102,253,158,103,246,
+1,93,2,98,253,158,254,102,102,2,137,133,103,1,112,254,144,1,112,254,144,103,
+133,102,254,135,1,121,254,135,1,121,102,133,253,156,1,49,254,207,4,59,254,
+215,1,41,0,4,0,102,0,0,5,182,5,20,0,12,0,16,0,19,0,23,0,0,19,1,1,7,39,17,
+51,21,33,53,51,17,7,1,33,17,33,3,33,1,1,33,53,33,111,2,159,2,160,53,154,215,
+250,176,215,153,1,0,2,213,253,43,41,3,39,254,108,254,150,2,213,253,43,3,100,
+1,176,254,80,86,99,252,245,102,102,3,9,97,253,88,1,220,1,86,1,2,254,14,137,
+0,0,3,0,184,0,0,5,223,5,221,0,32,0,44,0,51,0,0,0,22,21,20,6,7,17,51,55,51,
+23,55,51,23,55,23,3,35,39,7,35,39,7,35,17,33,17,38,38,53,52,54,51,18,54,53,
+52,38,35,34,6,21,20,22,51,19,17,6,35,34,39,17,2,147,195,70,59,104,78,72,90,
+92,72,90,92,88,145,66,96,92,68,94,55,162,254,98,59,68,193,141,98,136,137,
+97,97,134,134,97,105,50,55,56,48,5,221,197,139,81,138,45,254,184,140,187,
+187,187,187,51,254,251,187,187,185,115,254,41,3,133,47,136,81,141,195,253,
+201,135,96,97,137,137,97,97,134,252,192,2,232,15,15,253,24,0,0,4,0,102,0,
+0,8,193,5,135,0,17,0,24,0,28,0,32,0,0,1,33,17,33,17,33,53,52,18,36,51,50,
+0,23,17,33,17,33,1,33,38,0,35,34,0,1,33,17,33,33,17,33,17,6,154,252,2,253,
+202,1,207,158,1,31,168,248,1,104,6,1,193,253,217,252,2,3,254,6,254,210,204,
+207,254,214,254,44,1,104,254,152,6,51,1,90,2,199,253,57,2,41,248,161,1,27,
+170,254,163,253,254,252,253,215,3,45,210,1,34,254,218,252,107,1,93,254,163,
+1,93,0,0,3,0,102,0,0,4,94,5,37,0,12,0,15,0,22,0,0,1,1,21,33,53,1,38,53,52,
+54,55,33,17,1,33,1,37,53,33,6,21,20,23,2,84,1,96,252,178,1,103,49,41,32,2,
+121,252,129,2,90,254,211,1,236,254,31,21,18,3,244,252,84,72,72,3,196,53,74,
+38,89,27,254,207,252,114,3,48,196,100,25,26,26,23,0,0,1,0,102,255,158,7,240,
+6,86,0,112,0,0,1,51,21,35,21,51,21,35,17,36,55,23,7,39,7,23,7,39,7,23,7,39,
+7,23,7,39,7,35,17,36,37,23,7,39,7,23,7,39,7,23,7,39,7,23,7,39,7,23,7,39,7,
+17,51,21,33,53,51,17,39,7,39,55,39,7,39,55,38,39,7,39,55,39,7,39,55,39,7,
+39,55,4,5,17,35,39,7,39,55,39,7,39,55,39,7,39,55,38,39,7,39,55,22,22,23,53,
+35,53,51,53,35,53,51,53,35,3,182,230,62,158,158,1,45,221,197,82,139,49,90,
+94,93,53,49,98,49,55,16,102,17,21,22,1,155,1,25,222,74,160,59,125,88,129,
+60,82,94,84,61,45,103,47,57,18,102,19,47,219,253,238,209,47,19,102,18,59,
+45,103,46,36,26,84,94,82,60,129,88,123,57,160,74,222,1,25,1,155,22,23,15,
+102,14,55,47,98,47,53,91,94,90,22,27,139,82,197,112,254,156,135,135,148,148,
+66,6,86,102,62,102,254,215,8,150,250,66,176,26,201,41,203,17,217,20,217,8,
+228,8,227,2,254,177,15,210,242,69,176,35,195,55,203,25,213,37,219,16,223,
+21,224,9,225,8,225,2,253,254,102,102,2,2,2,225,8,225,9,224,21,223,7,9,219,
+37,213,25,203,55,195,35,176,69,242,212,13,1,79,2,227,8,228,8,217,20,217,17,
+203,41,201,10,16,176,66,250,76,77,5,110,103,84,102,62,0,0,3,0,41,255,61,5,
+18,6,125,0,73,0,83,0,95,0,0,19,51,38,53,35,53,33,21,20,22,51,51,53,52,54,
+51,50,22,21,20,6,35,35,21,32,0,21,20,22,51,50,54,53,52,38,35,34,6,7,54,51,
+50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,0,35,32,0,53,52,0,55,53,35,
+34,39,33,53,51,39,35,5,51,50,54,53,52,38,35,34,21,2,54,53,52,38,35,34,6,21,
+20,22,51,55,197,4,207,1,55,191,186,33,122,109,102,115,176,147,23,254,254,
+254,209,254,215,183,241,174,127,51,110,27,18,27,85,117,121,90,89,119,206,
+154,175,228,254,209,223,254,248,254,205,1,61,244,33,242,129,255,0,191,23,
+215,3,41,23,101,120,63,52,129,78,66,64,45,46,60,61,45,5,207,34,38,102,59,
+214,231,90,151,156,123,88,128,160,213,254,228,234,195,221,206,167,133,157,
+36,25,8,119,82,85,123,124,101,138,202,217,176,216,254,252,1,21,242,253,1,
+87,18,117,155,103,71,227,104,82,48,61,205,251,244,60,46,45,64,65,44,45,61,
+0,0,3,0,102,254,195,4,119,6,125,0,58,0,68,0,78,0,0,1,39,55,23,55,38,53,52,
+54,51,50,22,21,20,7,30,2,21,20,3,22,23,7,38,39,22,21,35,39,52,55,3,39,54,
+19,39,5,39,55,23,37,39,5,3,55,23,55,38,53,52,55,7,39,55,23,55,54,55,19,18,
+53,52,38,39,6,6,21,20,19,54,53,52,38,35,34,6,21,20,1,106,124,90,84,202,110,
+90,68,72,114,70,123,94,52,220,136,180,74,105,145,12,102,1,9,223,86,34,243,
+33,254,125,166,82,110,1,43,30,254,241,127,90,80,174,94,17,222,125,91,83,226,
+29,34,195,184,83,146,36,144,163,47,46,37,26,30,4,18,252,45,172,66,101,118,
+88,121,133,111,84,104,99,125,145,94,232,254,177,162,174,74,105,174,194,191,
+90,132,181,254,211,57,49,1,39,41,252,232,57,153,202,47,143,1,2,45,164,93,
+175,140,72,63,78,252,45,170,80,53,41,252,185,1,37,190,93,168,120,36,220,127,
+194,2,210,66,59,65,77,59,48,79,0,0,5,0,102,0,0,5,154,7,27,0,53,0,58,0,70,
+0,82,0,88,0,0,0,23,38,3,39,33,53,54,55,39,55,23,55,39,55,23,51,55,23,7,55,
+23,7,22,23,23,22,22,23,54,51,50,22,21,20,6,35,34,39,22,23,23,21,33,53,1,6,
+35,34,38,53,52,54,51,1,39,38,39,1,18,55,55,38,38,35,34,6,21,20,22,51,37,22,
+23,22,51,50,54,53,52,38,35,34,1,51,38,38,35,34,2,116,87,21,1,3,254,119,47,
+37,88,78,94,6,47,98,49,2,41,103,43,112,78,116,39,4,6,5,8,7,102,164,161,190,
+190,161,96,78,40,120,64,252,161,1,39,50,62,166,185,193,158,2,36,60,119,60,
+254,170,155,70,51,17,136,90,105,143,140,108,1,129,11,17,72,145,109,139,143,
+105,168,254,35,232,16,59,38,60,3,121,66,142,1,22,141,72,67,33,103,65,108,
+2,170,27,179,183,21,186,133,66,137,55,51,151,252,149,59,64,107,92,89,107,
+24,107,218,121,72,72,1,176,10,107,89,91,108,252,237,115,222,177,253,254,1,
+238,33,78,35,44,56,40,37,57,117,35,37,45,56,38,40,56,2,189,29,36,0,0,1,0,
+102,0,2,3,231,5,23,0,36,0,0,1,35,17,35,17,35,6,6,7,38,38,53,52,54,55,22,22,
+23,51,53,52,54,51,50,22,21,21,35,53,52,38,35,34,6,21,21,51,2,236,146,102,
+88,43,107,53,45,62,63,44,49,109,45,88,143,107,105,144,102,86,61,66,82,146,
+3,111,252,147,3,109,53,73,12,34,99,56,57,97,34,11,71,55,45,122,155,147,103,
+58,58,61,86,97,77,45,0,0,6,0,102,0,0,5,182,5,201,0,30,0,39,0,48,0,52,0,61,
+0,65,0,0,33,17,33,17,35,17,35,34,38,53,52,54,51,51,53,52,54,51,50,22,21,21,
+51,50,22,21,20,6,35,35,17,1,17,35,34,6,21,20,22,51,1,17,51,50,54,53,52,38,
+35,1,33,17,33,53,33,53,52,38,35,34,6,21,17,33,53,33,3,152,254,237,102,74,
+166,201,198,169,74,132,107,106,134,74,174,192,200,164,76,254,33,74,127,137,
+146,118,2,41,74,124,140,138,126,254,61,1,19,254,237,1,19,75,63,62,75,1,19,
+254,237,1,63,254,193,2,113,132,107,113,127,14,166,197,197,164,16,130,110,
+106,133,253,143,2,215,1,18,73,64,62,75,1,18,254,238,76,61,63,74,254,238,1,
+18,103,16,114,144,141,119,253,72,203,0,12,0,61,255,236,3,111,5,111,0,79,0,
+107,0,112,0,117,0,121,0,129,0,133,0,140,0,144,0,151,0,159,0,163,0,0,1,55,
+54,51,50,21,20,7,7,23,55,55,50,21,20,35,7,21,20,7,54,51,50,22,21,20,6,35,
+35,7,21,55,54,51,50,21,20,6,7,7,22,23,7,38,38,53,52,54,53,52,39,39,35,34,
+7,39,54,55,55,38,35,34,7,39,54,51,50,23,54,54,51,50,22,21,20,7,22,21,20,6,
+7,23,22,21,20,6,7,55,55,54,54,53,52,38,53,52,55,38,53,52,54,53,52,35,34,6,
+21,20,19,7,22,23,55,23,38,39,7,22,19,55,39,7,23,55,54,53,52,35,34,7,3,55,
+39,7,55,23,54,54,53,52,35,3,51,39,7,55,23,51,50,53,52,35,3,21,51,50,54,53,
+52,35,7,51,53,7,2,61,140,28,22,83,101,147,12,144,40,85,107,139,27,114,19,
+41,37,62,53,143,2,158,29,21,71,52,53,141,32,56,49,149,197,53,12,62,6,67,58,
+70,79,112,4,17,17,47,46,51,60,76,33,32,26,101,71,53,68,47,37,10,203,29,14,
+50,3,120,13,24,29,64,15,49,63,39,61,82,141,108,6,16,86,68,46,16,65,51,113,
+79,6,84,152,20,33,30,9,22,144,80,4,82,142,4,34,21,22,113,69,4,71,131,6,12,
+35,29,84,8,19,24,27,147,62,49,4,82,31,6,94,91,6,12,39,27,4,90,99,2,2,79,91,
+16,34,51,49,50,24,53,36,7,86,54,49,2,6,80,61,49,39,236,140,118,222,58,35,
+40,191,92,45,125,4,51,5,34,66,47,8,55,68,52,47,44,42,30,25,8,20,144,93,45,
+48,74,205,102,41,50,71,105,60,76,215,27,36,35,9,43,38,56,16,23,96,74,54,253,
+66,37,40,38,54,232,84,80,39,78,3,92,7,51,19,28,2,3,30,30,6,252,182,4,48,19,
+31,57,5,18,22,20,1,246,49,14,26,59,37,26,254,162,55,20,17,21,58,47,6,0,0,
+2,0,102,255,236,4,211,6,39,0,61,0,82,0,0,1,35,6,2,7,3,35,38,38,39,39,38,38,
+39,39,7,39,55,39,7,39,55,39,7,53,55,55,39,55,23,55,39,55,23,55,39,55,23,55,
+53,51,21,23,55,23,7,23,55,23,7,23,55,23,7,22,23,55,23,7,20,7,51,5,23,22,18,
+23,51,38,53,52,62,2,53,52,38,35,34,6,21,20,22,4,211,188,20,171,8,12,111,61,
+49,11,10,9,28,25,139,141,62,138,23,155,33,157,6,166,172,13,160,45,160,30,
+126,69,131,41,74,91,77,45,103,37,63,94,61,41,104,78,104,28,138,49,137,2,10,
+147,25,158,4,164,253,63,54,91,39,31,5,5,41,111,76,171,124,129,178,53,3,100,
+50,254,191,255,254,250,93,135,85,90,79,91,25,127,109,82,106,41,51,98,52,49,
+2,102,2,49,74,94,73,41,126,74,131,25,157,45,163,10,172,170,6,162,37,156,20,
+125,66,125,35,78,90,78,4,33,37,98,39,27,22,252,47,81,254,144,106,58,73,107,
+222,218,155,68,121,166,181,127,66,122,0,0,2,0,102,255,236,6,55,4,100,0,23,
+0,27,0,0,1,17,35,38,36,35,32,4,21,20,22,51,51,23,35,34,0,53,52,0,33,32,23,
+37,7,22,23,53,6,55,71,191,254,143,212,254,254,254,227,247,193,60,2,62,239,
+254,208,1,85,1,42,1,12,236,1,19,140,93,26,4,100,254,170,93,90,237,206,189,
+251,102,1,47,239,249,1,40,70,127,170,35,12,103,0,3,0,102,0,0,5,0,4,115,0,
+18,0,33,0,45,0,0,0,22,21,20,7,54,51,51,17,33,17,51,50,23,38,53,52,54,51,1,
+33,17,35,34,6,7,6,35,34,38,39,38,35,35,4,54,53,52,38,35,34,6,21,20,22,51,
+3,26,148,27,84,144,137,251,102,107,163,95,27,146,104,254,27,3,205,29,102,
+166,65,67,59,29,61,32,127,218,18,2,35,88,89,61,59,88,85,62,4,115,200,138,
+81,73,31,253,90,2,166,31,77,77,138,200,251,243,1,217,37,36,37,18,19,73,8,
+137,97,96,139,135,100,99,135,0,0,6,0,102,255,174,6,197,6,16,0,114,0,118,0,
+130,0,142,0,154,0,166,0,0,1,22,21,20,7,33,38,53,52,55,23,6,21,20,23,54,54,
+51,50,22,21,20,6,7,22,51,50,55,23,6,6,35,34,39,17,54,51,50,22,23,7,38,35,
+34,7,22,22,21,20,6,35,34,38,39,6,21,20,23,7,38,53,52,55,33,22,21,20,7,39,
+54,53,52,39,6,6,35,34,38,53,52,55,38,35,34,7,39,54,54,51,50,23,17,6,35,34,
+38,39,55,22,51,50,55,38,38,53,52,54,51,50,22,23,54,53,52,39,19,33,17,33,0,
+54,53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,36,6,21,
+20,22,51,50,54,53,52,38,35,2,6,21,20,22,51,50,54,53,52,38,35,2,135,119,53,
+1,153,53,119,69,86,19,15,61,39,56,77,37,29,23,55,124,85,74,53,146,84,92,78,
+78,92,84,146,53,74,86,123,57,21,29,37,80,53,39,61,15,19,86,69,119,53,254,
+103,53,119,69,86,19,15,61,39,53,80,66,21,57,123,86,74,53,146,84,92,78,78,
+92,84,146,53,74,85,124,55,23,29,37,78,55,39,61,15,19,86,79,2,9,253,247,2,
+161,34,34,23,23,33,33,23,23,34,34,23,23,33,33,23,252,222,34,34,23,23,33,33,
+23,23,34,34,23,23,33,33,23,6,16,115,161,98,97,88,107,161,115,73,88,115,49,
+51,34,41,82,51,35,58,17,11,93,70,59,66,39,254,113,40,66,58,70,92,10,17,59,
+35,53,80,42,34,52,48,117,86,74,115,162,108,86,95,99,162,115,74,86,117,48,
+52,34,42,78,55,71,40,10,92,70,58,66,40,1,143,39,66,59,70,93,11,17,58,35,51,
+82,41,34,51,49,115,88,252,37,1,231,253,84,34,23,23,33,33,23,23,34,3,0,32,
+23,23,35,35,23,23,32,113,35,23,23,32,32,23,23,35,253,0,33,23,23,34,34,23,
+23,33,0,0,11,0,102,255,236,6,117,5,106,0,206,0,216,0,225,0,235,0,243,0,252,
+1,6,1,16,1,25,1,35,1,44,0,0,37,54,54,55,7,35,34,38,53,52,54,51,50,22,23,54,
+53,52,39,6,35,34,38,53,52,54,51,50,23,55,52,39,6,35,34,38,53,52,54,51,50,
+23,38,38,35,7,22,21,20,6,35,34,38,53,52,54,55,38,35,34,7,22,21,20,6,35,34,
+38,53,52,55,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,39,6,6,21,20,
+23,54,51,50,22,21,20,35,34,39,6,21,20,22,23,38,53,52,54,51,50,22,21,20,6,
+7,22,51,50,54,55,6,35,34,38,53,52,54,51,50,23,54,53,52,39,6,35,34,38,53,52,
+54,51,50,22,23,54,55,23,6,7,22,21,20,7,23,20,6,35,34,38,39,35,34,38,53,52,
+55,38,53,52,54,55,38,53,52,54,51,50,23,54,51,50,22,23,54,51,50,22,21,20,7,
+22,21,20,7,22,21,20,6,7,6,6,7,3,38,35,34,6,21,20,22,51,50,1,22,51,50,53,52,
+38,35,34,1,6,21,20,22,51,50,54,53,52,1,22,51,50,53,52,35,34,1,6,21,20,22,
+51,50,54,53,1,38,38,35,34,21,20,22,51,50,5,54,53,52,38,35,34,6,21,20,1,38,
+35,34,21,20,22,51,50,37,38,35,34,6,21,20,22,51,50,23,38,35,34,6,21,20,51,
+50,4,96,143,142,22,18,18,80,109,72,74,55,92,25,30,8,63,72,73,81,80,62,83,
+64,2,33,56,107,69,91,87,64,61,54,3,103,84,62,6,78,69,51,70,78,63,49,119,35,
+34,26,76,61,58,73,55,32,64,85,103,4,60,26,83,118,88,74,59,109,31,49,49,33,
+74,94,65,88,164,69,64,10,83,75,4,78,61,57,72,60,53,66,121,81,104,13,50,52,
+76,86,96,72,82,63,11,9,76,75,65,79,84,74,34,85,37,16,31,90,25,47,27,59,4,
+162,143,106,147,40,17,133,155,30,78,94,80,6,155,136,123,78,74,77,97,127,32,
+46,49,135,157,4,95,27,33,60,51,4,168,221,215,28,62,35,35,39,31,51,254,16,
+40,79,53,61,47,32,1,63,56,23,14,20,27,254,43,42,44,72,55,60,2,250,82,16,13,
+28,27,1,62,13,56,32,39,57,40,28,252,107,80,18,17,16,33,1,186,41,47,57,30,
+17,52,2,24,47,44,21,36,38,28,56,81,38,54,17,26,57,45,78,44,92,52,2,86,60,
+46,64,48,48,40,52,25,32,34,60,54,50,65,35,25,51,39,72,64,55,51,66,17,63,85,
+4,35,35,80,94,67,60,51,97,32,72,6,51,68,75,95,88,74,75,60,8,105,77,34,28,
+9,83,59,58,73,68,74,26,78,40,51,45,72,70,51,127,37,34,38,71,84,9,16,35,74,
+86,80,57,50,81,23,51,67,68,24,75,60,60,75,61,31,30,15,36,37,63,56,57,64,34,
+32,16,48,53,43,47,48,61,89,77,43,127,147,72,59,142,124,76,59,78,94,68,129,
+39,39,53,116,168,40,30,80,63,12,149,105,25,22,74,112,53,52,57,80,59,109,35,
+106,158,69,1,172,53,25,20,20,21,2,63,82,35,21,30,1,23,36,62,32,32,40,40,50,
+253,183,22,37,26,1,199,38,56,14,17,53,35,253,53,31,37,22,16,34,47,23,53,16,
+21,33,35,30,1,102,35,31,14,13,246,15,12,11,14,15,217,25,11,10,24,0,0,2,0,
+184,0,0,3,88,6,98,0,20,0,24,0,0,19,33,53,35,53,51,53,39,55,23,55,23,7,21,
+51,21,35,21,51,17,33,55,33,17,33,184,1,60,205,205,254,69,236,235,70,254,248,
+248,146,253,204,103,1,102,254,154,3,229,133,103,90,238,73,219,219,73,238,
+90,103,133,252,27,102,3,25,0,0,9,0,102,0,0,3,10,5,199,0,43,0,63,0,76,0,88,
+0,95,0,103,0,112,0,116,0,121,0,0,55,55,38,38,53,52,54,55,17,52,38,35,34,7,
+35,52,54,51,50,22,21,35,38,38,35,34,6,21,21,55,51,50,22,21,20,7,22,21,20,
+6,7,23,21,33,1,23,53,52,54,51,50,23,38,38,35,34,6,7,55,50,22,21,21,55,7,22,
+23,54,51,50,23,55,38,38,35,34,6,1,39,6,35,34,39,7,22,22,51,50,54,5,7,33,39,
+6,35,34,3,22,51,50,55,38,35,34,19,23,54,53,52,38,35,34,7,19,39,7,23,37,23,
+55,39,7,102,125,57,68,104,89,23,22,36,32,71,184,147,145,183,72,12,37,18,22,
+23,13,15,59,75,56,86,68,59,127,253,92,1,104,21,68,59,21,18,26,113,68,73,114,
+26,35,64,69,22,177,47,8,70,73,74,70,53,31,104,62,63,104,1,108,53,70,74,73,
+70,53,31,103,62,62,103,254,224,71,1,133,72,61,62,64,20,46,38,39,45,47,37,
+36,182,37,32,26,17,15,11,90,2,31,31,254,43,2,31,31,2,72,188,48,136,80,97,
+164,44,1,5,31,22,37,164,209,210,163,15,22,22,31,56,2,83,70,77,58,97,127,80,
+136,48,188,72,3,94,2,221,72,86,4,62,79,79,62,4,85,73,221,2,213,47,6,63,63,
+53,50,61,61,254,208,60,70,70,60,48,58,58,138,107,107,23,1,80,45,45,45,1,6,
+22,34,44,31,28,8,254,100,29,31,30,16,16,30,31,13,0,2,0,102,255,41,3,195,6,
+170,0,67,0,113,0,0,5,39,22,23,7,38,35,34,6,7,39,52,54,18,55,7,39,55,39,7,
+39,55,38,38,53,52,54,55,38,53,52,54,55,55,54,55,51,22,22,21,20,7,55,23,7,
+23,55,23,7,23,55,23,7,22,21,20,7,23,7,39,7,23,7,39,6,21,21,23,1,55,38,53,
+52,54,55,39,38,39,7,22,22,21,20,6,21,20,18,21,20,6,7,6,7,54,51,50,23,38,53,
+52,54,54,53,52,39,7,39,55,39,7,39,55,39,7,3,125,148,39,39,73,219,89,55,129,
+51,74,52,164,9,180,61,229,16,166,62,197,15,26,40,50,98,59,74,60,28,14,86,
+18,208,62,178,37,211,19,168,37,175,17,119,37,130,48,39,102,37,110,31,182,
+41,190,6,225,254,108,82,18,30,23,56,32,33,120,38,41,125,103,70,71,58,16,95,
+99,100,115,51,105,65,41,94,37,107,19,88,37,97,19,78,27,62,118,87,45,219,101,
+87,30,110,171,1,1,97,143,82,180,62,132,82,156,56,119,63,63,131,86,58,94,40,
+81,57,48,23,19,31,134,99,58,67,74,95,88,55,70,95,71,58,50,95,53,199,77,85,
+87,43,95,45,49,75,95,80,21,20,20,92,4,141,33,65,62,37,69,19,38,19,27,99,27,
+67,49,51,215,88,100,254,206,94,64,178,113,93,54,102,106,109,81,62,161,144,
+68,82,153,39,94,43,60,37,94,39,55,30,0,0,2,0,102,255,170,6,225,6,111,0,72,
+0,77,0,0,1,35,3,39,19,35,3,39,19,35,3,39,19,6,6,7,39,54,54,51,33,55,52,39,
+33,53,54,55,39,55,23,55,39,55,23,51,55,23,7,55,23,7,22,22,21,21,33,50,22,
+23,7,38,38,39,19,7,3,35,19,7,3,35,19,7,3,35,17,23,7,39,7,39,55,1,51,38,35,
+34,3,113,78,6,103,6,77,15,102,14,78,34,103,33,69,61,3,103,7,165,164,1,187,
+1,5,254,114,44,40,88,78,94,6,47,99,49,2,41,102,43,113,78,117,27,26,1,186,
+165,164,7,102,5,59,69,33,103,37,76,15,103,14,80,8,102,8,76,225,73,203,203,
+74,226,254,252,229,36,75,61,3,25,254,213,4,1,39,254,217,4,1,35,254,208,13,
+1,16,28,141,109,4,209,186,200,68,49,72,62,38,103,65,108,2,170,26,176,181,
+21,184,131,66,139,41,103,212,117,186,209,4,109,141,28,254,240,13,1,48,254,
+221,4,1,39,254,217,4,1,43,253,192,229,74,205,205,74,229,4,74,65,0,4,0,184,
+255,236,3,121,5,180,0,22,0,30,0,39,0,48,0,0,19,51,39,55,52,54,51,50,22,21,
+21,51,17,35,21,20,6,35,34,38,53,53,35,1,17,51,17,33,17,51,17,19,51,53,52,
+38,35,34,6,21,19,53,35,21,20,22,51,50,54,184,201,1,1,88,64,64,89,199,199,
+89,64,64,88,201,1,148,198,254,13,198,2,101,31,20,20,30,101,101,30,20,21,30,
+4,123,9,20,120,164,167,117,29,252,166,27,117,165,161,121,27,2,37,254,65,2,
+141,253,115,1,191,1,53,29,78,104,99,83,252,110,27,27,82,98,102,0,0,1,0,102,
+0,0,4,0,3,236,0,8,0,0,19,1,1,23,1,17,35,17,1,172,1,135,1,135,70,254,102,102,
+254,102,3,236,254,135,1,121,74,254,119,253,231,2,25,1,137,0,0,4,0,102,255,
+94,4,248,6,72,0,62,0,74,0,85,0,94,0,0,5,39,35,23,35,55,7,39,55,39,5,3,55,
+23,55,38,39,7,3,55,23,55,38,53,53,55,7,3,55,23,55,54,55,7,39,55,23,55,54,
+55,38,38,53,52,51,50,4,21,21,7,54,51,50,22,21,20,7,22,21,20,2,7,23,38,18,
+53,52,2,35,34,2,21,20,18,51,3,54,53,52,38,35,34,21,20,22,23,23,22,23,54,53,
+52,38,35,34,3,238,138,2,8,102,6,137,82,133,20,254,198,225,78,168,223,18,17,
+207,247,77,195,143,43,2,235,150,91,112,197,9,5,141,152,86,115,137,43,68,145,
+173,158,138,1,5,2,69,97,87,110,152,43,111,98,133,168,142,141,97,96,139,139,
+96,20,6,208,89,55,202,132,182,66,40,90,52,42,65,129,201,234,234,201,61,177,
+16,197,1,4,66,193,140,24,31,102,1,26,66,221,67,129,141,34,32,53,1,8,49,199,
+46,49,16,39,248,53,182,37,88,55,84,194,85,129,230,135,26,31,47,95,71,119,
+57,117,156,172,254,236,64,174,238,1,7,185,186,1,7,254,249,186,186,254,250,
+3,229,34,36,104,164,26,64,180,68,51,54,75,30,50,28,35,0,13,0,184,0,248,4,
+133,4,197,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,
+0,0,19,33,17,33,37,51,17,35,1,17,51,17,1,51,17,35,1,51,53,35,53,51,53,35,
+5,51,53,35,53,51,53,35,37,51,53,35,1,51,53,35,5,53,35,21,1,51,53,35,53,51,
+53,35,184,3,205,252,51,1,123,215,215,1,41,215,252,215,215,215,2,82,215,215,
+215,215,253,174,215,215,215,215,1,41,215,215,254,215,215,215,3,41,215,254,
+215,215,215,215,215,4,197,252,51,82,1,108,1,189,254,149,1,107,254,149,1,107,
+253,106,68,82,67,217,68,82,67,230,67,253,107,65,65,65,65,1,190,66,231,66,
+0,20,0,102,255,236,5,221,5,98,0,11,0,20,0,67,0,79,0,89,0,101,0,113,0,122,
+0,131,0,183,0,195,0,207,0,219,0,231,0,243,0,255,1,11,1,23,1,35,1,47,0,0,0,
+22,21,20,6,35,34,38,53,52,54,51,22,53,52,35,34,21,20,22,51,4,54,51,50,22,
+22,51,50,54,54,51,50,22,21,20,14,2,21,20,30,2,21,20,6,35,34,46,2,35,34,6,
+6,35,34,38,53,52,54,54,53,52,38,38,53,18,38,53,52,54,51,50,22,21,20,6,35,
+38,21,20,22,51,50,53,52,38,35,36,22,21,20,6,35,34,38,53,52,54,51,0,22,21,
+20,6,35,34,38,53,52,54,51,22,53,52,35,34,6,21,20,51,0,53,52,35,34,6,21,20,
+51,0,62,2,51,50,30,2,51,50,54,53,52,46,2,53,52,62,2,53,52,38,35,34,14,2,35,
+34,46,2,35,34,6,21,20,30,2,21,20,14,2,21,20,22,51,2,38,53,52,54,51,50,22,
+21,20,6,35,38,6,21,20,22,51,50,54,53,52,38,35,0,22,21,20,6,35,34,38,53,52,
+54,51,22,54,53,52,38,35,34,6,21,20,22,51,4,22,21,20,6,35,34,38,53,52,54,51,
+22,54,53,52,38,35,34,6,21,20,22,51,4,38,53,52,54,51,50,22,21,20,6,35,38,6,
+21,20,22,51,50,54,53,52,38,35,0,22,21,20,6,35,34,38,53,52,54,51,22,54,53,
+52,38,35,34,6,21,20,22,51,3,75,58,60,40,40,59,59,40,24,24,23,13,10,253,69,
+184,130,132,175,8,70,72,6,177,132,130,183,67,127,172,171,129,66,184,129,88,
+138,84,8,69,71,7,174,133,131,183,167,200,200,167,59,59,59,42,39,59,59,39,
+25,14,11,22,13,9,4,215,59,58,42,39,59,59,39,253,209,59,58,42,40,59,60,39,
+24,24,10,13,23,2,112,24,9,14,23,252,127,120,5,99,73,72,100,10,114,91,88,123,
+120,152,95,96,151,120,123,88,92,113,10,100,72,73,99,5,120,88,88,123,120,153,
+93,91,159,116,123,88,56,77,78,55,53,78,77,54,13,18,18,13,12,16,16,12,1,189,
+77,78,55,55,76,76,55,12,19,19,12,13,16,16,13,1,183,77,78,55,55,76,76,55,12,
+19,19,12,13,16,16,13,252,197,78,77,56,54,77,78,53,13,18,18,13,12,16,16,12,
+3,59,78,77,56,56,75,77,54,12,19,19,12,13,16,16,13,5,80,58,42,40,59,60,39,
+41,59,123,23,24,24,10,13,43,184,179,204,203,180,184,129,79,130,93,17,66,69,
+16,94,129,79,130,183,81,132,169,203,179,184,129,128,173,15,71,70,13,174,128,
+254,27,59,41,39,59,59,39,41,59,122,22,11,14,25,9,13,76,59,39,42,58,59,41,
+39,59,253,187,59,40,42,58,60,40,40,59,123,24,23,13,10,24,2,69,25,22,13,9,
+25,253,195,119,164,100,98,166,119,123,88,88,118,8,100,73,72,99,9,116,89,88,
+123,118,167,98,100,164,119,123,88,88,118,8,101,72,69,99,14,116,87,88,123,
+3,84,77,54,55,78,76,57,57,74,162,19,12,12,17,17,12,12,19,254,227,77,54,55,
+78,77,56,56,75,162,19,12,12,17,17,12,12,19,223,77,54,55,78,77,56,56,75,162,
+19,12,12,17,17,12,12,19,104,78,55,55,76,75,56,57,76,162,17,12,13,18,18,13,
+12,17,3,108,78,55,55,76,76,55,56,77,162,17,12,12,19,19,12,12,17,0,0,6,0,102,
+1,20,5,197,4,252,0,10,0,21,0,27,0,30,0,36,0,39,0,0,19,52,18,36,51,50,4,18,
+21,17,33,55,33,53,52,2,36,35,34,4,2,21,5,3,53,33,21,3,3,23,55,1,3,53,33,21,
+3,3,23,55,102,185,1,59,186,186,1,63,184,250,161,103,4,145,155,254,240,159,
+157,254,241,155,1,61,112,1,69,110,113,61,62,1,63,112,1,69,110,113,62,61,2,
+76,185,1,64,183,183,254,193,186,254,200,103,209,155,1,17,158,157,254,240,
+157,123,1,115,73,73,254,141,1,96,207,207,254,160,1,115,73,73,254,141,1,96,
+207,207,0,0,1,0,102,0,0,5,111,4,141,0,11,0,0,1,5,17,33,17,1,55,1,17,33,17,
+1,2,119,254,86,4,59,254,80,53,1,226,250,247,1,220,4,51,254,253,49,2,205,1,
+4,86,254,224,252,147,3,109,1,28,0,0,7,0,102,0,0,5,236,6,12,0,34,0,37,0,41,
+0,45,0,49,0,53,0,57,0,0,0,23,19,19,54,54,51,21,34,6,7,1,35,39,33,23,35,39,
+35,7,35,55,33,7,35,1,3,6,35,34,38,53,52,54,51,1,33,3,19,51,39,35,5,51,55,
+35,37,51,39,35,5,51,55,35,19,51,39,35,1,33,39,233,234,48,228,189,154,179,
+36,2,113,117,103,254,248,70,109,69,176,68,109,68,254,250,103,114,1,96,199,
+37,51,52,71,70,53,1,189,1,78,166,161,248,71,224,253,242,246,47,221,1,166,
+206,73,181,254,187,203,49,178,157,113,47,19,4,207,55,254,174,1,229,114,111,
+102,77,77,250,244,215,215,215,215,215,215,2,223,1,31,37,74,49,48,75,254,104,
+1,92,252,170,150,150,150,102,152,152,152,254,108,150,0,6,0,102,255,94,7,39,
+6,31,0,23,0,31,0,38,0,46,0,53,0,60,0,0,19,33,3,55,5,17,51,17,37,23,3,33,21,
+33,19,7,37,17,35,17,5,39,19,33,1,7,39,23,7,55,23,39,55,51,19,5,21,55,23,19,
+38,3,35,19,7,39,21,1,55,23,53,37,19,51,3,19,35,3,37,53,7,102,1,109,184,49,
+2,71,103,2,69,52,185,1,109,254,147,185,52,253,187,103,253,185,49,184,254,
+147,4,58,217,217,61,61,217,217,62,117,121,160,254,10,252,47,199,56,100,121,
+78,47,252,254,110,48,251,254,17,151,121,76,76,119,153,1,239,251,2,242,2,69,
+51,184,1,109,254,147,184,51,253,187,103,253,187,50,183,254,147,1,109,183,
+50,2,69,1,17,66,66,222,221,66,66,221,52,1,245,159,119,80,47,252,168,171,1,
+70,255,0,47,82,121,2,189,47,82,121,155,254,15,254,153,1,0,254,19,151,119,
+80,0,7,0,102,255,236,6,113,5,16,0,32,0,44,0,56,0,68,0,80,0,92,0,104,0,0,1,
+6,21,20,4,33,32,36,53,52,39,55,22,21,20,7,22,21,20,2,4,35,34,36,2,53,52,55,
+38,53,52,54,55,19,21,20,0,51,50,0,53,53,6,33,32,4,22,21,20,6,35,34,38,53,
+52,54,51,36,22,21,20,6,35,34,38,53,52,54,51,22,22,21,20,6,35,34,38,53,52,
+54,51,4,38,53,52,54,51,50,22,21,20,6,35,54,38,53,52,54,51,50,22,21,20,6,35,
+1,111,162,1,102,1,55,1,56,1,104,164,54,213,146,4,171,254,221,168,168,254,
+218,169,4,148,112,99,35,1,54,219,215,1,57,208,254,189,254,190,1,96,38,38,
+27,28,36,36,28,254,201,38,38,27,28,36,36,28,183,38,38,28,28,35,35,28,1,83,
+38,38,28,28,35,35,28,128,38,38,28,27,36,36,27,4,186,102,125,163,187,186,164,
+124,103,86,132,181,177,114,34,40,171,254,215,170,170,1,41,171,49,23,113,180,
+93,160,60,253,103,13,217,254,193,1,60,220,13,101,75,38,28,28,35,35,28,28,
+38,37,38,28,28,36,36,28,28,38,158,38,28,28,35,35,28,28,38,129,35,28,28,38,
+38,28,28,35,157,36,28,28,38,38,28,28,36,0,7,0,102,255,236,6,229,6,16,0,43,
+0,55,0,66,0,77,0,84,0,91,0,98,0,0,0,22,21,20,7,51,50,22,21,20,7,1,7,37,5,
+39,54,54,55,38,38,39,6,6,7,22,22,23,7,37,5,39,1,38,53,52,54,51,51,38,53,52,
+54,51,18,54,53,52,38,35,34,6,21,20,22,51,1,54,54,53,52,38,35,34,6,21,20,5,
+54,53,52,38,35,34,6,21,20,22,1,55,23,55,38,39,7,33,39,6,7,23,55,23,1,54,55,
+7,35,39,22,4,23,159,69,14,115,139,70,1,174,57,254,143,254,215,57,55,138,32,
+127,128,21,21,125,133,30,132,66,58,254,215,254,144,58,1,174,69,139,115,12,
+67,155,115,73,99,100,72,71,97,96,72,254,194,125,101,69,54,70,82,2,174,52,
+83,69,54,69,104,253,13,164,161,5,71,61,200,4,94,201,60,71,4,162,164,253,211,
+9,24,17,34,17,23,6,16,165,115,105,82,168,131,181,173,254,123,63,120,118,63,
+76,219,70,117,177,82,82,171,123,60,213,92,63,118,120,63,1,133,167,187,131,
+168,82,105,115,165,254,56,103,73,74,104,104,74,73,103,253,182,121,159,64,
+57,72,107,90,139,137,145,131,89,108,72,57,64,164,254,40,53,72,4,80,119,180,
+178,117,80,4,72,53,3,0,36,37,2,2,32,0,4,0,41,0,0,7,131,4,231,0,11,0,25,0,
+28,0,31,0,0,1,5,17,33,17,37,53,37,17,33,17,5,1,17,6,6,35,34,38,39,17,54,54,
+51,50,22,19,21,37,5,53,5,7,131,253,178,253,66,253,178,2,78,2,190,2,78,253,
+76,65,134,49,51,140,59,61,138,51,49,137,164,1,111,251,211,254,145,2,72,193,
+254,121,1,135,195,71,191,1,151,254,105,193,253,248,3,217,156,176,185,151,
+252,31,152,184,181,1,197,239,121,121,239,118,0,0,1,0,102,255,176,6,190,6,
+8,0,60,0,0,1,21,55,23,7,21,55,23,7,21,37,23,5,21,33,21,35,23,7,39,35,23,7,
+39,35,19,7,3,35,17,35,53,7,39,55,53,7,39,55,53,5,39,37,53,35,37,53,51,39,
+55,23,51,39,55,23,51,3,55,19,51,17,3,199,129,53,182,190,53,243,1,12,53,254,
+191,2,247,151,82,86,115,98,119,86,154,123,170,86,203,28,103,129,53,182,190,
+53,243,254,244,53,1,65,49,253,55,150,80,86,113,100,119,86,152,123,168,86,
+200,33,6,8,151,82,86,115,98,118,86,153,123,170,86,203,31,102,129,53,182,191,
+53,244,254,244,54,1,66,253,8,150,80,86,112,101,119,86,152,122,168,87,200,
+31,2,102,127,54,183,191,53,244,1,13,53,254,190,2,250,0,3,0,41,254,160,5,18,
+5,242,0,73,0,82,0,91,0,0,1,33,21,35,1,17,33,54,54,51,50,22,21,20,6,35,35,
+22,23,7,38,39,33,17,51,54,54,51,50,22,21,20,6,35,35,22,23,7,38,39,35,21,20,
+6,35,34,38,53,53,51,21,20,22,51,50,54,53,17,51,1,17,33,21,33,21,51,21,35,
+21,51,21,35,21,33,3,51,50,53,52,38,35,34,6,1,51,50,53,52,38,35,34,6,4,225,
+254,224,103,254,119,1,246,3,99,84,65,80,114,103,4,28,126,41,191,26,254,4,
+172,3,98,85,66,80,112,105,4,25,128,41,191,26,178,115,96,95,118,102,60,51,
+54,54,103,1,137,1,135,254,224,225,225,225,225,1,32,180,12,115,27,24,33,40,
+254,179,13,114,26,23,34,41,3,172,129,2,23,253,28,108,126,87,73,86,90,131,
+56,94,85,196,254,160,107,126,87,73,84,92,127,59,94,84,196,158,112,131,140,
+112,22,22,68,82,80,61,6,95,253,233,2,23,103,57,102,58,102,58,254,76,84,21,
+26,66,253,249,84,18,29,67,0,1,0,102,255,236,2,59,5,225,0,14,0,0,0,22,21,20,
+6,7,17,35,17,38,38,53,52,54,51,1,178,137,102,82,102,81,102,138,96,5,225,138,
+97,86,124,18,251,218,4,38,18,123,87,100,135,0,0,4,0,102,255,186,6,170,5,88,
+0,18,0,37,0,40,0,43,0,0,4,38,53,52,55,3,1,35,17,33,21,1,19,22,22,21,20,6,
+35,0,22,21,20,7,19,1,51,17,33,53,1,3,38,38,53,52,54,51,19,33,17,37,33,17,
+6,32,59,19,201,254,232,72,2,184,254,230,233,33,51,60,38,250,168,59,18,198,
+1,27,72,253,71,1,27,234,35,49,59,40,67,1,207,3,41,254,49,70,60,39,30,25,1,
+211,253,217,5,18,71,253,211,253,223,4,56,36,40,59,5,158,59,39,29,29,254,45,
+2,41,250,238,72,2,43,2,32,7,55,37,39,59,251,14,3,152,174,252,104,0,0,4,0,
+102,255,236,7,18,5,70,0,36,0,43,0,55,0,67,0,0,1,53,33,21,22,22,21,20,6,35,
+34,38,53,52,54,55,53,52,18,36,51,50,4,18,21,21,22,22,21,20,6,35,34,38,53,
+52,54,37,33,38,0,35,34,0,0,54,53,52,38,35,34,6,21,20,22,51,32,54,53,52,38,
+35,34,6,21,20,22,51,5,195,251,225,102,131,161,115,116,159,121,94,173,1,32,
+168,170,1,36,169,102,131,161,115,116,158,118,252,66,4,29,14,254,205,206,208,
+254,208,4,146,104,102,72,74,98,100,72,251,193,104,102,72,74,98,100,72,2,12,
+129,127,16,152,104,116,158,158,116,99,151,20,195,172,1,39,164,170,254,219,
+168,193,16,152,104,116,158,158,116,97,152,253,204,1,31,254,222,252,149,98,
+74,72,102,104,70,72,100,98,74,72,102,104,70,72,100,0,0,25,0,184,255,154,4,
+207,6,37,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,
+55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,0,19,33,17,33,
+37,51,53,35,53,51,53,35,53,51,53,35,53,51,53,35,53,51,53,35,53,51,53,35,53,
+51,53,35,53,51,53,35,1,51,53,35,53,21,51,53,5,51,53,35,1,51,53,35,1,51,53,
+35,1,51,53,35,53,51,53,35,19,53,35,21,37,51,53,35,53,51,53,35,53,51,53,35,
+1,51,53,35,1,51,53,35,53,51,53,35,53,51,53,35,1,51,53,35,184,4,23,251,233,
+1,160,215,215,215,215,215,215,215,215,215,215,215,215,215,215,215,215,1,62,
+210,210,210,252,183,211,211,2,119,210,210,253,137,211,211,2,119,210,210,210,
+210,210,210,253,137,211,211,211,211,211,211,2,119,210,210,253,137,211,211,
+211,211,211,211,2,119,210,210,6,37,249,117,102,94,103,94,102,94,103,94,102,
+95,102,94,103,94,102,94,254,222,94,196,94,94,94,94,251,203,94,254,25,94,1,
+240,94,102,95,252,143,94,94,197,94,102,94,103,94,254,25,94,1,239,95,102,94,
+103,94,254,221,94,0,7,0,102,255,227,4,68,5,219,0,14,0,20,0,26,0,30,0,34,0,
+40,0,45,0,0,1,3,6,2,21,16,23,7,6,35,34,36,2,2,39,19,22,23,37,52,55,1,23,23,
+33,54,55,7,33,23,33,7,33,23,33,19,38,39,7,22,51,3,39,5,22,23,3,240,33,19,
+34,170,35,58,53,178,254,214,229,134,5,224,40,54,1,143,4,253,156,4,6,2,146,
+9,5,29,253,140,18,2,86,12,253,204,21,2,22,136,74,41,234,149,179,115,10,254,
+156,48,38,5,219,255,0,131,254,206,177,254,162,226,71,11,237,1,216,2,106,201,
+253,82,147,123,94,92,84,2,72,43,49,50,42,195,92,102,93,252,183,99,159,105,
+153,1,106,99,84,93,49,0,0,9,0,41,255,98,7,31,6,88,0,82,0,88,0,94,0,100,0,
+106,0,113,0,119,0,126,0,134,0,0,1,55,23,7,39,17,54,55,54,54,51,50,22,21,20,
+5,6,7,33,39,55,23,7,39,55,33,22,23,22,22,21,20,6,35,34,38,39,38,39,17,55,
+23,7,39,55,23,17,6,7,6,6,35,34,38,53,52,54,55,54,55,33,23,7,39,55,23,7,33,
+38,39,38,38,53,52,54,51,50,22,23,22,23,17,7,1,38,39,35,21,22,5,54,55,53,35,
+6,1,6,7,21,51,54,37,22,23,51,53,38,39,38,38,35,34,21,20,5,54,53,52,35,34,
+1,6,6,21,20,51,50,37,22,22,51,50,53,52,38,2,238,182,182,57,78,135,92,34,122,
+82,58,69,254,231,16,4,1,131,68,58,176,176,58,76,254,117,4,16,137,144,69,58,
+82,122,34,125,102,78,57,182,182,57,70,111,109,35,121,81,58,69,147,133,17,
+4,254,115,77,57,176,176,57,69,1,131,4,15,139,141,69,58,81,121,35,102,118,
+70,1,121,13,4,188,115,254,96,87,112,183,5,1,239,85,120,188,4,254,19,11,5,
+183,89,241,25,64,34,29,3,154,151,28,72,252,203,69,83,29,73,3,52,23,66,34,
+28,83,5,168,176,176,57,75,254,99,4,20,131,150,68,51,166,78,90,117,70,57,182,
+182,57,78,137,80,38,125,81,51,68,150,131,22,3,254,100,76,58,176,176,58,70,
+1,148,4,19,131,150,68,51,82,126,36,99,118,78,57,182,182,57,70,124,83,38,125,
+81,51,68,150,131,18,6,1,149,67,252,125,101,93,174,5,15,15,5,174,132,1,161,
+16,5,162,89,94,58,125,162,4,150,74,77,34,69,48,49,68,34,252,129,21,60,35,
+35,151,75,76,35,35,60,0,19,0,184,255,33,5,158,6,154,0,3,0,9,0,15,0,19,0,23,
+0,35,0,47,0,59,0,71,0,74,0,77,0,80,0,83,0,86,0,89,0,101,0,113,0,125,0,137,
+0,0,19,33,17,33,1,33,55,39,33,7,19,33,55,39,33,7,19,33,3,33,17,33,19,33,0,
+22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,18,22,
+21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,17,55,3,
+17,19,1,17,3,19,17,7,1,21,55,5,53,7,0,54,53,52,38,35,34,6,21,20,22,51,18,
+54,53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,18,54,
+53,52,38,35,34,6,21,20,22,51,184,4,230,251,26,1,80,2,68,213,213,253,190,213,
+211,2,68,213,213,253,190,213,53,3,130,168,253,206,2,50,165,252,132,1,250,
+85,85,60,61,84,85,60,61,84,85,60,61,84,83,62,61,84,85,60,60,85,85,60,61,84,
+85,60,60,85,85,60,253,244,151,151,151,3,129,153,153,153,252,129,139,3,141,
+139,254,144,26,26,17,17,26,26,17,17,26,26,17,17,26,26,17,17,26,26,17,17,26,
+26,17,17,26,26,17,17,26,26,17,6,154,248,135,3,239,187,166,166,253,127,168,
+184,184,253,149,1,92,3,244,1,92,252,88,85,60,59,87,88,58,60,85,1,199,88,57,
+59,87,88,58,58,87,1,197,88,58,60,85,85,60,59,87,250,176,88,58,60,85,85,60,
+59,87,5,32,254,80,125,252,207,254,84,1,47,3,49,1,172,254,207,251,41,1,168,
+125,2,82,246,123,123,246,123,2,125,26,17,17,26,26,17,17,26,254,60,26,17,17,
+26,26,17,17,26,252,116,26,17,17,26,26,17,17,26,1,197,26,17,17,26,26,17,17,
+26,0,9,0,102,255,141,6,127,6,70,0,39,0,57,0,75,0,87,0,91,0,95,0,99,0,103,
+0,115,0,0,1,55,38,39,35,53,51,54,55,39,55,23,54,55,53,51,21,22,23,55,23,7,
+22,23,51,21,35,6,7,23,7,39,6,7,21,35,53,38,39,7,5,54,18,53,52,2,39,55,37,
+23,3,22,21,20,7,19,7,37,1,3,55,5,23,6,2,21,20,18,23,7,5,39,19,38,53,52,0,
+54,53,52,38,35,34,6,21,20,22,51,1,6,7,5,1,54,55,39,19,38,39,7,1,22,23,55,
+0,22,21,20,6,35,34,38,53,52,54,51,1,195,145,52,14,206,206,14,52,145,73,144,
+76,87,103,86,76,145,74,146,57,11,203,203,12,54,144,74,145,72,90,103,90,73,
+148,2,53,238,201,211,228,19,1,252,51,170,133,133,170,51,254,4,252,190,168,
+52,1,247,19,225,211,198,240,19,254,5,50,168,133,3,85,149,151,105,105,149,
+147,107,2,24,77,87,1,5,251,108,64,96,254,254,93,69,92,3,242,96,65,95,253,
+166,44,44,31,31,45,45,31,1,133,143,69,93,103,91,70,146,74,146,57,11,205,205,
+11,57,146,74,146,76,85,103,91,71,143,74,144,54,12,205,205,12,54,144,229,160,
+1,54,189,189,1,71,144,68,133,52,254,132,195,234,239,189,254,129,49,133,4,
+132,1,124,52,133,68,143,254,187,194,190,254,206,161,68,133,49,1,123,196,234,
+238,254,23,148,105,108,148,147,109,107,146,254,247,83,60,68,4,226,73,70,68,
+250,141,66,75,209,5,113,69,74,211,253,114,45,31,30,45,45,30,31,45,0,0,1,0,
+102,0,0,5,129,5,27,0,11,0,0,19,33,17,51,17,33,21,33,17,35,17,33,102,2,91,
+102,2,90,253,166,102,253,165,2,193,2,90,253,166,103,253,166,2,90,0,2,0,102,
+0,0,3,188,5,29,0,13,0,16,0,0,1,17,55,23,7,1,21,33,53,1,39,55,23,17,3,33,1,
+2,68,147,74,213,1,112,252,170,1,109,211,74,147,246,2,84,254,215,5,29,254,
+182,147,73,213,253,0,72,72,3,0,213,73,147,1,74,251,73,2,115,0,4,0,102,0,0,
+7,172,5,102,0,59,0,63,0,73,0,83,0,0,1,6,6,21,21,54,54,51,50,22,21,20,6,7,
+22,51,50,55,23,6,35,34,39,17,33,17,6,35,34,39,55,22,51,50,55,38,38,53,52,
+54,51,50,22,23,53,52,38,39,55,22,22,21,20,7,33,38,53,52,54,55,1,33,17,33,
+36,21,20,22,51,50,53,52,38,35,4,54,53,52,35,34,6,21,20,51,6,82,102,125,48,
+138,76,81,89,175,120,93,122,87,85,49,101,120,170,129,252,203,129,170,121,
+101,50,85,87,120,93,119,174,89,81,74,138,50,125,102,36,132,161,14,2,27,15,
+160,133,252,168,2,104,253,152,254,133,145,82,68,147,78,4,135,145,69,81,145,
+68,5,8,41,179,110,8,60,67,76,71,79,164,11,70,47,90,59,112,253,152,2,104,112,
+59,90,47,70,11,163,80,72,75,68,59,8,109,180,41,94,51,232,141,51,61,49,63,
+140,232,52,251,0,2,129,236,49,46,114,45,57,107,209,113,47,49,108,56,45,0,
+1,0,41,255,193,8,229,6,72,0,24,0,0,1,19,19,23,3,35,3,1,35,3,1,35,3,1,35,3,
+55,19,1,51,19,1,51,19,1,7,123,143,121,98,172,71,174,254,186,72,121,254,66,
+72,172,254,185,72,211,94,170,1,82,53,152,1,196,72,146,1,69,6,45,254,164,1,
+119,33,253,229,1,146,254,110,1,74,250,107,1,151,254,105,2,45,36,254,60,1,
+166,254,147,5,166,254,113,1,143,0,0,6,0,102,255,137,4,252,6,37,0,73,0,81,
+0,85,0,89,0,93,0,97,0,0,37,7,35,39,53,55,38,39,7,17,35,53,6,7,21,35,53,38,
+39,21,35,17,39,6,7,23,21,7,35,39,53,55,54,55,38,39,39,53,55,51,23,21,7,22,
+23,55,17,51,21,54,55,53,51,21,22,23,53,51,17,23,54,55,39,53,55,51,23,21,7,
+6,7,22,23,23,1,38,35,34,7,22,51,50,19,23,55,39,1,39,7,23,17,7,23,55,1,55,
+39,7,4,252,166,72,161,145,4,64,20,103,37,53,102,48,42,103,22,62,4,148,164,
+72,168,154,4,98,98,4,152,166,72,164,148,4,62,22,103,46,44,102,46,44,103,20,
+64,4,150,164,72,168,152,4,98,98,4,152,254,137,93,118,116,95,92,119,121,166,
+96,98,98,253,98,96,98,98,98,98,96,2,158,98,98,96,82,199,197,72,176,173,134,
+25,254,246,193,20,11,232,232,9,22,193,1,10,25,139,168,174,72,201,199,72,178,
+230,167,165,232,176,72,199,199,72,174,168,139,23,1,12,192,22,6,234,234,6,
+22,192,254,244,23,134,173,174,72,201,199,71,179,224,173,175,222,176,2,61,
+123,123,123,2,221,116,116,117,250,199,116,116,117,5,174,117,116,116,250,199,
+117,116,116,0,0,2,0,102,255,236,4,207,6,147,0,39,0,64,0,0,5,17,55,39,53,55,
+39,53,55,39,53,55,39,53,55,39,6,6,7,39,54,54,55,55,39,53,55,23,7,23,21,22,
+0,21,20,6,35,34,39,17,3,22,51,50,54,53,52,38,35,35,7,23,21,7,23,21,7,23,21,
+7,23,21,7,23,21,2,53,37,92,90,90,92,92,90,90,92,35,112,180,78,95,95,242,157,
+4,90,158,53,86,92,216,1,32,230,188,69,76,2,93,54,146,169,236,173,15,16,39,
+92,92,90,90,90,90,90,90,20,3,53,16,45,47,41,47,47,43,46,47,41,47,47,43,16,
+33,185,169,45,204,220,29,6,47,47,98,73,54,45,14,3,254,229,187,182,219,26,
+253,99,3,8,31,159,140,149,222,2,17,47,47,41,47,45,43,47,45,43,47,45,43,48,
+0,5,0,102,0,0,4,0,5,178,0,76,0,83,0,90,0,97,0,105,0,0,1,50,22,21,20,6,7,21,
+22,22,21,20,6,35,35,21,39,39,22,23,51,21,35,22,21,33,21,33,7,51,21,35,6,7,
+55,55,21,51,50,22,21,20,6,7,21,22,22,21,20,6,35,35,17,7,6,6,35,34,39,55,22,
+51,50,17,2,35,34,7,39,54,54,51,50,22,23,23,17,19,21,51,50,53,52,35,3,21,51,
+50,53,52,35,3,50,53,52,35,35,21,17,21,51,50,54,53,52,35,3,88,77,81,28,28,
+35,31,80,67,56,69,209,6,14,156,152,4,1,52,254,204,4,152,156,6,14,209,69,35,
+77,81,28,28,35,31,80,67,158,213,29,91,52,162,70,99,50,83,135,6,129,83,50,
+99,35,119,78,52,91,29,213,102,56,45,45,56,56,45,45,21,55,55,35,45,19,26,55,
+5,178,69,60,25,48,11,4,11,59,28,59,66,49,2,98,28,115,92,34,26,92,59,93,76,
+65,98,2,49,69,60,23,50,11,4,11,59,28,59,66,1,115,103,60,63,224,32,153,1,246,
+1,206,153,33,112,111,65,60,103,1,115,254,246,82,43,39,252,6,82,43,39,4,86,
+41,41,82,252,88,82,23,18,41,0,0,2,0,102,255,236,4,88,5,43,0,26,0,37,0,0,1,
+37,23,5,23,55,51,50,22,21,20,6,35,35,7,5,7,37,53,55,36,39,53,54,54,55,39,
+3,22,4,51,50,54,53,52,38,35,34,1,76,1,119,41,254,233,225,18,17,167,216,216,
+167,35,225,1,23,41,254,137,225,254,220,163,102,214,139,225,119,126,1,29,119,
+108,159,160,107,242,4,141,158,94,109,182,2,165,124,124,165,180,108,94,157,
+68,180,87,138,82,79,108,39,180,254,65,84,102,111,75,76,111,0,0,10,0,102,255,
+125,5,39,6,123,0,47,0,51,0,63,0,75,0,87,0,99,0,111,0,123,0,135,0,147,0,0,
+0,22,21,20,6,7,21,54,51,50,22,21,20,6,35,34,39,17,35,22,21,20,6,35,34,38,
+53,52,54,55,17,6,35,34,38,53,52,54,51,50,23,17,51,38,53,52,54,51,3,51,17,
+35,0,54,53,52,38,35,34,6,21,20,22,51,2,54,53,52,38,35,34,6,21,20,22,51,0,
+54,53,52,38,35,34,6,21,20,22,51,0,54,53,52,38,35,34,6,21,20,22,51,0,54,51,
+50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,18,54,51,50,
+22,21,20,6,35,34,38,53,0,54,51,50,22,21,20,6,35,34,38,53,3,188,134,67,54,
+57,66,94,133,131,96,69,54,217,22,131,96,94,131,59,51,50,54,93,133,135,91,
+50,54,240,35,132,93,190,194,194,1,215,74,76,49,49,74,73,50,177,72,74,51,51,
+72,70,53,254,29,74,76,49,49,74,72,51,1,11,77,76,49,49,74,74,49,1,231,35,25,
+24,33,33,24,25,35,253,4,35,25,24,33,33,24,25,35,219,35,25,25,32,32,25,25,
+35,1,60,34,25,25,33,33,25,25,34,6,123,134,93,67,105,29,232,37,133,94,92,133,
+34,254,84,46,50,92,133,131,94,62,104,29,1,63,24,130,95,97,130,26,1,43,52,
+71,94,133,250,170,3,145,253,248,73,50,52,73,73,52,54,69,2,111,71,52,50,74,
+75,49,51,72,253,145,73,50,52,73,73,52,51,72,253,53,71,52,52,73,73,52,52,71,
+3,95,34,34,25,25,32,32,25,25,34,34,25,25,32,32,25,253,78,35,35,25,25,32,32,
+25,5,82,35,35,24,25,33,33,25,0,2,0,102,255,236,4,53,5,84,0,28,0,32,0,0,1,
+1,7,39,7,23,21,7,23,21,7,23,21,5,39,55,39,53,55,39,53,55,39,53,55,39,7,39,
+1,19,55,3,3,2,111,1,198,86,164,241,153,118,118,118,153,254,176,22,174,133,
+125,125,121,121,67,172,164,86,1,199,37,176,180,180,5,84,253,82,57,243,250,
+79,66,61,60,65,66,94,68,75,100,37,69,66,59,66,65,60,61,74,63,166,245,57,2,
+174,253,174,182,1,15,254,239,0,0,3,0,102,0,0,4,164,5,248,0,17,0,22,0,25,0,
+0,19,1,39,1,23,55,23,1,1,55,23,7,39,1,17,35,17,7,37,33,55,38,39,17,21,55,
+102,1,19,197,1,13,196,225,74,254,152,1,69,66,213,213,144,254,193,102,234,
+1,80,1,39,31,203,123,182,2,238,1,22,201,1,12,199,230,74,254,145,254,207,66,
+213,211,143,254,221,254,236,3,143,235,4,31,184,121,254,74,166,166,0,17,0,
+184,255,141,4,254,6,29,0,3,0,7,0,11,0,15,0,19,0,22,0,25,0,28,0,31,0,34,0,
+37,0,40,0,43,0,46,0,49,0,52,0,55,0,0,19,33,17,33,1,51,17,35,37,33,53,33,53,
+33,53,33,1,53,33,21,1,17,7,5,17,7,37,17,7,5,17,7,5,17,55,37,17,55,5,17,55,
+37,17,55,1,21,55,19,53,7,1,21,55,19,53,7,184,4,70,251,186,1,242,98,98,254,
+117,3,121,252,135,3,121,252,135,3,121,252,135,3,121,189,254,105,189,3,17,
+189,254,105,189,1,236,176,252,252,176,1,164,174,252,254,174,1,166,153,140,
+156,253,35,153,140,156,6,29,249,112,1,43,3,115,102,97,102,94,250,62,94,94,
+1,139,1,39,148,147,1,39,148,222,1,36,145,147,1,36,145,47,254,238,137,137,
+254,238,137,234,254,238,137,137,254,238,137,2,211,121,121,252,141,121,121,
+3,115,121,121,252,141,121,121,0,13,0,102,255,80,6,66,6,182,0,47,0,51,0,55,
+0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,0,1,7,23,7,39,7,17,23,
+55,23,7,23,7,39,7,39,55,39,33,7,23,7,39,7,39,55,39,55,23,55,17,39,7,39,55,
+39,55,23,55,23,7,23,33,55,39,55,23,55,1,53,33,21,53,33,53,33,17,33,53,33,
+1,33,53,33,53,33,53,33,17,33,53,33,1,33,53,33,53,33,53,33,1,33,53,33,53,33,
+53,33,1,21,33,53,5,33,53,33,6,66,132,132,74,131,99,99,131,74,132,132,74,131,
+133,74,133,98,253,24,98,133,74,133,133,74,134,132,74,131,99,99,131,74,132,
+134,74,133,133,74,133,98,2,232,98,133,74,133,131,254,180,254,219,1,37,254,
+219,1,37,254,219,254,119,1,35,254,221,1,35,254,221,1,35,254,221,1,137,1,37,
+254,219,1,37,254,219,254,119,1,35,254,221,1,35,254,221,1,137,1,37,253,82,
+1,35,254,221,6,106,131,131,73,131,99,251,144,99,132,74,131,131,74,131,133,
+74,133,98,98,133,74,133,133,74,133,131,74,132,99,4,112,99,131,73,131,134,
+73,133,133,73,134,98,98,134,73,133,131,250,51,97,97,199,96,1,240,96,252,137,
+97,102,96,1,240,96,254,23,94,102,95,254,221,94,102,95,1,135,90,90,90,90,0,
+0,5,0,102,255,236,6,190,5,186,0,77,0,129,0,141,0,153,0,165,0,0,37,39,7,35,
+39,7,35,39,6,6,35,34,38,53,52,54,51,50,22,23,55,39,55,23,39,55,23,39,55,23,
+39,55,23,39,55,38,53,52,54,51,50,22,21,20,7,23,7,55,23,7,55,23,7,55,23,7,
+55,23,7,23,54,51,50,22,21,20,6,35,34,38,39,7,35,39,7,35,39,7,3,39,23,7,39,
+23,7,7,22,23,23,55,51,23,55,51,23,55,51,23,55,51,23,55,54,55,39,39,55,7,39,
+55,7,39,55,7,39,55,7,39,55,6,35,34,39,23,7,39,23,7,39,23,0,54,53,52,38,35,
+34,6,21,20,22,51,32,54,53,52,38,35,34,6,21,20,22,51,0,54,53,52,38,35,34,6,
+21,20,22,51,3,123,49,49,56,55,45,57,48,31,105,68,93,133,135,91,14,54,12,63,
+102,24,133,88,25,127,80,25,129,82,24,135,45,37,45,133,92,93,135,47,39,46,
+136,24,82,129,25,80,127,25,88,133,24,102,63,33,45,94,133,131,96,69,105,29,
+47,49,55,45,58,51,45,211,133,86,24,138,90,24,86,31,16,45,66,49,53,45,53,51,
+52,51,53,47,58,57,43,14,33,86,25,91,138,24,86,133,25,90,135,27,90,137,22,
+73,39,49,50,36,74,22,138,90,26,135,90,254,131,74,74,51,50,73,72,51,4,200,
+72,73,52,52,71,71,52,253,235,72,74,51,51,71,70,52,47,125,125,123,123,59,59,
+67,130,95,97,130,7,7,4,123,45,10,98,47,10,100,45,8,98,49,14,45,72,60,77,96,
+131,132,95,74,63,72,45,14,49,98,8,45,100,10,47,98,10,45,123,4,14,133,94,92,
+133,68,58,59,125,125,125,125,2,68,14,104,45,10,103,45,8,38,64,58,146,121,
+121,121,121,121,121,142,52,70,34,8,45,103,10,45,104,14,47,100,14,51,100,12,
+45,88,18,16,86,45,12,100,51,14,100,253,176,73,50,51,74,75,50,51,72,74,49,
+49,76,77,48,49,74,4,10,74,49,52,73,74,51,50,73,0,0,11,0,102,255,195,7,86,
+5,254,0,111,0,122,0,126,0,130,0,136,0,148,0,160,0,172,0,184,0,196,0,208,0,
+0,1,19,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,23,19,38,39,6,35,34,38,
+53,52,54,51,50,22,21,20,7,22,23,19,51,19,54,55,38,53,52,54,51,50,22,21,20,
+6,35,34,39,6,7,19,54,55,54,54,51,50,22,21,20,6,35,34,39,6,7,19,7,33,7,20,
+23,22,22,21,20,6,35,34,38,53,52,54,55,38,53,55,33,23,20,7,22,21,20,6,35,34,
+38,53,52,54,55,54,53,39,33,19,22,23,33,54,55,3,6,35,34,39,1,51,38,39,5,6,
+7,51,1,7,22,51,50,55,0,54,53,52,38,35,34,6,21,20,22,51,0,54,53,52,38,35,34,
+6,21,20,22,51,0,54,53,52,38,35,34,6,21,20,22,51,0,6,21,20,22,51,50,54,53,
+52,38,35,2,54,53,52,38,35,34,6,21,20,22,51,0,54,53,52,38,35,34,6,21,20,22,
+51,1,106,156,56,61,20,74,45,67,93,92,68,61,93,6,75,70,158,84,68,32,33,67,
+93,92,68,68,94,21,57,68,156,71,166,66,53,18,95,67,67,92,93,66,36,32,66,75,
+178,74,83,8,91,61,68,94,95,67,90,49,75,52,166,35,254,188,4,9,65,92,93,69,
+68,91,36,31,12,2,254,180,3,11,68,93,69,69,91,90,68,8,4,254,186,250,113,45,
+1,113,37,108,199,72,79,71,73,254,185,200,30,72,3,10,54,38,191,254,8,92,37,
+55,58,40,2,162,35,35,25,25,32,32,25,252,54,34,34,25,25,32,32,25,254,78,35,
+35,25,25,32,32,25,4,119,35,35,25,24,33,33,24,148,35,35,25,24,33,33,24,253,
+44,34,34,25,25,32,32,25,1,207,1,33,39,24,35,43,93,67,67,95,83,61,27,46,1,
+30,38,59,13,93,67,67,95,95,67,42,36,47,28,1,30,254,228,28,45,34,44,68,94,
+93,69,69,91,13,57,35,254,210,55,29,60,84,95,67,68,92,78,31,41,254,234,66,
+55,42,42,2,93,67,67,92,92,67,42,70,21,55,62,51,57,53,60,46,85,67,92,93,66,
+66,94,2,44,41,54,1,119,109,163,142,118,1,80,19,17,253,174,86,92,12,60,106,
+3,88,168,8,8,254,162,32,25,25,34,34,25,25,32,252,225,33,24,25,35,35,25,24,
+33,3,31,32,25,25,34,34,25,25,32,2,80,35,25,25,32,32,25,25,35,250,145,33,24,
+25,35,35,25,24,33,4,250,32,25,25,35,35,25,25,32,0,15,0,102,255,121,7,55,6,
+123,0,62,0,66,0,72,0,79,0,88,0,92,0,96,0,100,0,104,0,109,0,114,0,126,0,138,
+0,144,0,151,0,0,1,54,51,50,30,2,23,23,5,38,38,39,17,51,1,23,1,22,22,21,20,
+6,35,34,38,53,52,55,33,22,21,20,6,35,34,38,53,52,54,55,1,55,1,51,17,6,6,7,
+37,55,54,54,51,50,23,53,52,54,51,50,22,21,3,51,17,35,1,54,55,39,6,7,37,54,
+55,38,35,34,7,37,21,51,53,52,38,35,34,6,1,23,55,39,3,55,39,7,37,55,39,7,23,
+23,55,39,23,51,55,39,7,5,55,39,7,23,4,54,53,52,38,35,34,6,21,20,22,51,32,
+54,53,52,38,35,34,6,21,20,22,51,19,38,39,7,22,23,3,38,35,34,7,22,23,4,121,
+65,37,74,129,110,106,27,46,254,188,89,124,57,29,1,176,241,254,215,34,42,103,
+73,73,101,14,253,137,15,103,73,75,99,39,34,254,217,242,1,174,21,58,122,91,
+254,189,38,83,235,135,38,65,96,78,78,98,248,145,145,254,90,37,37,123,54,36,
+1,16,83,89,45,43,100,92,1,141,145,39,34,34,38,2,152,81,62,82,104,59,82,59,
+251,149,82,59,82,125,61,80,59,53,127,6,61,82,3,180,8,82,59,4,252,238,42,42,
+31,31,41,41,31,3,215,43,43,31,31,41,41,31,154,41,50,122,31,42,24,94,99,45,
+43,89,83,5,156,14,57,98,151,52,88,168,188,172,31,252,8,2,12,194,254,153,23,
+75,45,74,100,100,74,42,28,30,40,74,100,101,73,45,76,24,1,101,194,253,244,
+3,248,32,168,191,168,73,167,206,14,28,85,110,113,82,251,27,4,74,254,178,76,
+63,78,69,74,149,105,30,15,78,192,51,51,45,49,49,252,35,67,73,70,254,217,74,
+67,73,84,67,74,68,151,74,68,71,227,4,74,68,10,10,68,74,4,244,41,31,31,43,
+43,31,31,41,41,31,31,43,43,31,31,41,4,58,79,64,78,54,85,1,39,78,15,30,105,
+0,5,0,102,255,31,8,2,6,184,0,115,0,127,0,139,0,151,0,163,0,0,37,51,54,55,
+38,38,39,6,7,21,35,53,35,21,35,17,51,50,54,53,52,38,35,35,17,51,21,51,53,
+51,21,22,23,54,54,55,38,39,35,53,51,53,35,53,33,21,20,22,23,50,54,53,53,33,
+21,35,21,51,21,35,6,7,22,22,23,54,55,53,51,21,51,53,51,17,35,34,6,21,20,22,
+51,51,17,35,53,35,21,35,53,38,39,6,6,7,22,23,51,21,35,21,51,21,33,53,52,38,
+6,7,6,21,21,33,53,51,53,35,1,34,0,21,20,0,51,50,0,53,52,0,19,20,6,35,34,38,
+53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,39,20,6,35,34,38,53,52,
+54,51,50,22,1,252,205,43,110,109,165,43,73,122,102,47,103,123,117,166,164,
+119,123,103,47,102,125,70,43,165,109,112,41,205,184,184,1,31,161,121,118,
+165,1,31,185,185,207,38,114,109,163,44,75,119,103,47,102,115,124,166,162,
+120,123,102,47,103,122,72,44,163,109,112,40,207,185,185,254,225,176,228,80,
+81,254,225,184,184,2,57,194,254,241,1,15,194,197,1,12,254,244,127,188,136,
+136,187,188,135,137,187,103,129,92,92,129,130,91,93,128,129,52,40,40,52,53,
+39,39,53,27,123,69,43,167,110,113,43,205,184,184,1,31,163,120,119,163,1,31,
+184,184,207,46,108,110,165,43,72,122,103,47,102,123,116,162,4,164,118,123,
+102,47,103,119,75,43,164,109,114,38,207,184,184,254,225,160,122,120,163,254,
+225,184,184,205,43,111,110,165,43,72,120,103,47,102,123,122,162,6,80,81,117,
+123,102,47,5,8,254,240,192,187,254,234,1,22,187,194,1,14,254,48,133,191,189,
+135,135,188,191,132,92,129,129,92,94,128,130,92,38,55,55,38,39,53,53,0,6,
+0,102,255,236,5,160,4,195,0,11,0,23,0,35,0,47,0,59,0,71,0,0,0,22,21,20,6,
+35,34,38,53,52,54,51,22,54,53,52,38,35,34,6,21,20,22,51,36,22,21,20,6,35,
+34,38,53,52,54,51,22,54,53,52,38,35,34,6,21,20,22,51,0,22,21,20,6,35,34,38,
+53,52,54,51,22,54,53,52,38,35,34,6,21,20,22,51,1,95,102,105,72,72,102,100,
+74,31,43,43,31,30,41,41,30,4,38,102,105,71,74,100,98,76,31,42,42,31,31,41,
+41,31,254,92,102,103,73,73,101,100,74,31,43,43,31,31,41,41,31,1,74,101,75,
+76,98,99,75,73,103,248,41,31,31,42,42,31,31,41,248,103,73,76,98,100,74,72,
+104,248,41,31,31,42,42,31,31,41,4,113,103,74,74,100,100,74,74,103,248,40,
+31,31,43,43,31,31,40,0,0,9,0,184,255,74,3,215,6,104,0,11,0,23,0,35,0,47,0,
+59,0,71,0,83,0,95,0,107,0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,
+6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,
+34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,0,22,21,20,6,35,34,38,
+53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,
+52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,58,55,55,38,39,53,53,39,38,
+55,54,39,39,53,53,39,38,55,55,38,39,53,53,39,39,54,55,38,39,53,51,41,38,55,
+55,38,39,53,53,39,2,143,52,53,39,39,53,51,41,39,53,53,39,39,53,53,39,39,53,
+53,39,39,53,53,39,39,53,53,39,39,53,53,39,6,104,51,41,40,52,53,39,39,53,254,
+103,51,41,39,53,53,39,39,53,254,102,51,41,40,52,53,39,39,53,254,103,54,39,
+40,52,53,39,38,55,254,102,51,41,40,52,53,39,39,53,5,154,55,38,39,53,53,39,
+38,55,254,102,53,39,39,53,53,39,39,53,254,102,53,39,39,53,53,39,39,53,254,
+103,53,39,39,53,53,39,39,53,0,9,0,102,0,213,4,135,4,246,0,11,0,23,0,35,0,
+47,0,59,0,71,0,83,0,95,0,107,0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,22,
+21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,0,54,51,50,
+22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,18,22,21,20,6,35,
+34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,0,22,21,20,6,35,34,38,
+53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,2,166,63,64,46,47,66,64,49,
+46,64,64,46,47,66,65,48,44,66,65,45,46,67,68,45,253,239,64,49,47,64,65,46,
+49,64,3,64,65,48,48,64,65,47,47,66,38,64,64,46,47,66,65,48,46,64,62,48,48,
+65,66,47,253,227,64,65,46,47,66,65,48,47,64,64,47,48,65,66,47,4,246,66,47,
+46,64,62,48,48,65,254,96,64,47,48,64,62,50,48,63,254,96,64,48,47,66,65,48,
+49,63,1,94,66,66,45,46,66,65,47,46,65,66,45,46,66,65,47,1,148,64,47,48,64,
+62,50,48,63,253,180,64,46,47,66,64,49,47,63,2,76,66,45,46,66,62,50,48,63,
+253,180,66,44,45,68,64,49,47,63,0,0,2,0,102,0,51,5,154,5,102,0,67,0,71,0,
+0,19,23,51,17,35,7,39,55,39,55,23,51,53,39,55,23,55,23,7,21,33,53,39,55,23,
+55,23,7,21,51,55,23,7,23,7,39,35,17,51,55,23,7,23,7,39,35,21,23,7,39,7,39,
+55,53,33,21,23,7,39,7,39,55,53,35,7,39,55,39,5,33,17,33,168,199,120,120,199,
+66,164,164,66,199,120,147,78,123,131,78,160,1,84,148,78,123,131,78,160,135,
+199,66,164,164,66,201,133,135,199,66,164,166,66,201,135,160,78,131,123,78,
+148,254,172,160,78,131,123,78,147,120,199,66,164,164,1,232,1,84,254,172,2,
+190,147,1,68,160,78,131,123,77,147,137,199,65,163,163,65,201,135,137,199,
+65,163,163,65,201,135,147,77,123,131,78,160,254,188,147,77,123,131,78,160,
+138,198,66,164,164,66,198,138,138,198,66,164,164,66,198,138,160,78,131,123,
+70,1,68,0,4,0,102,255,186,6,170,5,88,0,18,0,37,0,40,0,43,0,0,1,3,1,21,33,
+17,51,1,19,38,53,52,54,51,50,22,21,20,6,1,19,1,53,33,17,35,1,3,22,21,20,6,
+35,34,38,53,52,54,37,17,33,5,17,33,6,86,233,1,26,253,72,72,1,24,201,19,59,
+40,39,59,51,250,67,234,254,229,2,185,72,254,229,198,18,60,38,40,59,49,2,68,
+254,49,3,41,1,207,4,150,253,223,253,211,72,5,18,253,218,1,210,27,29,39,59,
+59,39,36,56,251,229,2,33,2,43,71,250,238,2,41,254,45,27,30,40,59,60,39,37,
+55,155,3,152,174,252,104,0,2,0,102,0,0,4,180,6,0,0,15,0,20,0,0,1,5,17,51,
+17,37,23,5,22,18,19,33,18,18,55,37,1,2,1,0,3,1,80,1,10,103,1,10,61,254,210,
+217,225,32,251,178,32,222,219,254,211,3,48,66,254,141,254,142,66,5,61,197,
+1,136,254,121,196,81,224,216,254,33,254,171,1,81,1,225,218,224,251,122,1,
+249,1,108,254,145,254,10,0,6,0,184,255,92,4,57,6,104,0,25,0,29,0,33,0,45,
+0,57,0,61,0,0,0,22,21,20,7,33,17,33,22,21,20,6,35,34,38,53,52,55,33,17,33,
+38,53,52,54,51,1,33,17,33,23,33,17,33,18,54,53,52,38,35,34,6,21,20,22,51,
+18,54,53,52,38,35,34,6,21,20,22,51,3,51,53,35,2,228,147,80,1,18,254,238,80,
+149,105,105,149,78,254,239,1,17,78,147,107,254,166,2,180,253,76,211,1,14,
+254,242,185,101,86,65,63,89,99,53,63,88,100,51,54,98,89,63,39,78,78,6,104,
+149,105,142,99,252,211,99,143,105,149,149,105,146,96,3,45,96,145,105,149,
+251,74,2,96,108,254,119,2,92,143,98,62,90,89,63,96,145,251,74,88,63,97,145,
+146,96,64,87,2,174,225,0,0,14,0,184,255,25,5,76,6,164,0,31,0,45,0,57,0,69,
+0,81,0,93,0,105,0,117,0,129,0,137,0,149,0,161,0,173,0,185,0,0,37,37,22,22,
+21,20,6,35,34,38,53,52,55,5,35,17,51,5,38,53,52,54,51,50,22,21,20,6,7,37,
+51,17,39,17,5,6,35,34,38,37,17,37,54,51,50,22,18,54,53,52,38,35,34,6,21,20,
+22,51,4,54,51,50,22,21,20,6,35,34,38,53,20,54,51,50,22,21,20,6,35,34,38,53,
+36,54,51,50,22,21,20,6,35,34,38,53,20,54,51,50,22,21,20,6,35,34,38,53,2,54,
+53,52,38,35,34,6,21,20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,18,53,52,
+35,34,21,20,51,4,6,35,34,38,53,52,54,51,50,22,21,52,6,35,34,38,53,52,54,51,
+50,22,21,4,6,35,34,38,53,52,54,51,50,22,21,52,6,35,34,38,53,52,54,51,50,22,
+21,4,250,254,205,33,24,147,107,107,147,62,254,202,84,84,1,49,57,149,105,105,
+149,24,33,1,51,82,103,254,148,73,44,20,50,254,97,1,108,78,43,13,33,2,102,
+89,63,62,90,100,52,254,115,34,25,25,32,32,25,25,34,34,25,25,32,32,25,25,34,
+2,166,32,25,25,34,34,25,25,32,32,25,25,34,34,25,25,32,218,89,102,50,51,101,
+89,63,76,80,81,75,76,80,81,75,53,53,53,53,254,231,32,25,25,34,34,25,25,32,
+32,25,25,34,34,25,25,32,2,166,34,25,25,32,32,25,25,34,34,25,25,32,32,25,25,
+34,178,58,56,99,58,105,149,149,105,121,96,62,4,88,57,88,125,105,149,149,105,
+58,100,55,57,251,168,113,3,119,62,14,5,73,252,133,63,15,3,3,72,143,99,64,
+87,86,65,98,144,151,34,34,25,25,32,32,25,180,35,35,25,24,33,33,24,230,34,
+34,25,25,32,32,25,180,35,35,25,24,33,33,24,252,72,89,63,99,142,144,97,63,
+89,4,84,129,115,114,132,132,114,114,130,254,125,141,144,142,143,176,35,35,
+24,25,33,33,25,180,34,34,25,25,32,32,25,229,35,35,24,25,33,33,25,180,34,34,
+25,25,32,32,25,0,0,2,0,102,255,217,5,96,5,203,0,69,0,77,0,0,1,7,23,21,7,23,
+21,7,23,7,37,53,55,39,53,55,39,53,55,39,35,7,23,21,7,23,21,7,23,21,5,39,55,
+39,53,55,39,53,55,39,53,55,53,52,38,35,34,6,7,35,54,54,51,50,23,33,54,54,
+51,50,22,23,35,38,35,34,6,21,21,23,37,51,53,52,55,35,22,21,4,123,125,174,
+172,172,186,180,66,254,250,182,182,182,182,133,129,254,129,133,182,182,182,
+182,254,250,65,180,186,172,172,174,125,184,85,79,65,79,3,103,3,135,112,190,
+56,1,31,29,129,100,107,123,3,102,6,129,84,92,184,253,239,242,4,250,4,3,49,
+78,118,48,108,117,47,117,145,78,211,43,113,116,43,113,123,39,82,86,86,82,
+39,123,113,43,116,113,43,211,78,145,117,47,117,108,48,118,78,47,127,92,145,
+152,100,90,125,168,213,99,114,156,137,190,161,136,92,127,168,51,57,27,40,
+44,0,3,0,102,254,250,5,63,6,176,0,69,0,79,0,89,0,0,1,33,23,33,21,33,7,33,
+21,33,7,22,22,23,33,21,35,22,23,7,38,39,7,39,19,38,39,6,6,35,34,38,53,52,
+54,51,50,23,54,55,52,39,6,35,34,38,53,52,54,51,50,22,23,54,55,3,55,23,54,
+55,23,6,7,51,21,33,6,7,23,33,1,38,35,34,6,21,20,22,51,50,19,38,35,34,6,21,
+20,22,51,50,3,147,254,224,4,1,28,254,228,4,1,32,254,220,13,105,196,111,1,
+65,227,72,69,86,63,82,61,99,78,167,183,33,143,105,96,115,145,120,82,61,13,
+5,18,71,72,120,145,115,96,104,141,34,181,171,78,99,61,82,63,86,69,72,227,
+254,191,199,213,13,1,36,254,89,67,58,76,86,55,53,129,50,51,128,53,55,86,76,
+66,3,86,78,102,78,102,107,36,124,108,103,87,111,54,105,96,227,29,1,30,164,
+66,142,155,109,93,109,129,14,97,193,203,131,12,129,109,93,109,155,144,63,
+169,1,30,29,227,96,105,54,111,87,103,199,69,107,253,123,13,74,62,40,60,4,
+27,223,60,40,62,74,0,7,0,102,255,236,5,127,5,4,0,15,0,29,0,85,0,97,0,109,
+0,121,0,133,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,18,0,53,52,0,35,
+34,6,2,21,20,22,22,51,0,54,51,50,22,23,51,53,38,38,53,52,54,51,50,22,21,20,
+6,7,21,51,54,54,51,50,22,21,20,6,35,34,38,39,35,21,22,22,21,20,6,35,34,38,
+53,52,54,55,53,35,6,6,35,34,38,53,36,54,53,52,38,35,34,6,21,20,22,51,18,54,
+53,52,38,35,34,6,21,20,22,51,2,38,35,34,6,21,20,22,51,50,54,53,36,38,35,34,
+6,21,20,22,51,50,54,53,3,161,1,47,175,171,254,210,180,175,254,208,173,174,
+1,47,175,226,1,69,254,187,226,147,255,147,147,255,147,254,34,103,74,57,91,
+17,84,54,66,98,76,74,102,71,56,88,17,91,62,74,100,101,73,62,91,17,88,56,71,
+105,71,74,100,66,54,84,15,90,60,73,104,1,255,42,42,31,31,41,41,31,31,42,42,
+31,31,41,41,31,232,40,31,31,43,43,31,31,40,2,99,41,31,31,43,43,31,31,41,5,
+4,175,254,209,175,172,254,212,179,175,1,46,174,175,1,46,176,251,78,1,66,227,
+226,1,69,148,255,0,147,147,255,147,2,111,102,68,57,86,17,91,60,72,104,103,
+73,62,91,15,86,54,71,103,73,75,99,67,56,86,16,93,59,76,98,100,74,60,91,17,
+86,56,67,99,75,233,41,31,31,43,43,31,31,41,253,158,41,31,31,42,42,31,31,41,
+1,152,43,43,31,31,41,41,31,31,43,43,31,31,41,41,31,0,0,13,0,102,255,2,8,33,
+6,188,0,188,0,200,0,212,0,224,0,236,0,248,1,4,1,16,1,28,1,37,1,46,1,53,1,
+62,0,0,1,39,6,7,21,35,53,38,39,7,39,55,38,39,35,53,51,54,55,39,55,23,54,55,
+53,51,21,22,23,55,23,7,22,23,51,53,52,54,51,50,22,21,21,51,17,38,39,7,39,
+55,39,35,53,51,54,55,39,55,23,54,55,53,51,21,22,23,55,23,7,22,23,51,21,35,
+6,7,23,7,39,6,7,21,51,50,22,21,20,6,35,35,21,33,54,55,39,55,23,54,55,53,51,
+21,22,23,55,23,7,23,51,21,35,6,7,23,7,39,6,7,21,35,53,39,7,39,55,38,39,35,
+21,20,6,35,34,38,53,53,35,17,22,23,55,23,7,22,23,51,21,35,6,7,23,7,39,6,7,
+21,35,53,38,39,7,39,55,38,39,35,53,51,54,55,39,55,23,54,55,53,35,34,38,53,
+52,54,51,51,53,33,6,7,23,0,54,53,52,38,35,34,6,21,20,22,51,0,38,35,34,6,21,
+20,22,51,50,54,53,36,38,35,34,6,21,20,22,51,50,54,53,0,54,53,52,38,35,34,
+6,21,20,22,51,0,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,
+34,38,53,0,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,
+51,1,51,53,52,38,35,34,6,21,19,51,53,35,34,6,21,20,22,19,21,51,50,53,52,35,
+19,53,35,21,20,22,51,50,54,2,98,88,17,24,102,29,12,88,74,86,13,7,140,138,
+5,11,80,74,76,27,26,102,42,14,73,74,76,13,6,73,73,54,55,72,93,27,27,82,73,
+86,17,123,125,7,10,88,73,86,11,39,102,18,23,82,74,76,16,6,107,105,13,9,74,
+74,76,19,28,51,59,76,78,55,53,1,151,10,9,76,74,74,16,39,102,27,27,75,74,82,
+17,139,139,11,10,86,74,88,12,29,102,43,86,74,82,15,10,61,70,57,53,74,92,26,
+21,76,74,74,6,16,105,107,5,17,76,74,82,26,15,102,26,24,86,73,88,10,7,125,
+123,6,11,86,73,82,28,26,60,57,76,74,61,58,254,90,5,18,82,1,201,57,58,42,39,
+53,53,39,253,200,57,43,40,52,53,39,43,57,5,35,53,39,43,57,58,42,39,53,253,
+64,57,57,43,40,52,53,39,253,59,24,17,19,24,24,19,17,24,5,41,25,18,17,24,24,
+17,18,25,253,174,25,25,18,17,24,24,17,18,25,25,18,17,24,24,17,254,217,49,
+14,11,11,13,184,60,58,14,19,19,174,53,31,33,193,50,14,11,11,14,1,225,86,9,
+7,123,125,8,8,88,74,86,19,30,103,20,21,81,74,76,18,5,106,104,15,8,74,74,75,
+25,22,59,59,76,78,55,61,1,151,8,17,82,74,86,43,102,26,15,88,74,86,6,14,139,
+139,3,13,82,74,76,25,28,102,41,15,73,74,76,12,7,61,73,54,55,72,92,31,16,75,
+74,74,11,12,104,106,6,17,76,74,81,41,103,30,19,86,74,88,8,8,125,123,16,86,
+74,82,23,30,51,55,78,74,61,49,254,92,6,12,76,74,74,11,44,102,26,28,75,74,
+82,14,3,139,139,8,13,86,74,88,15,26,102,20,21,88,74,82,17,5,76,73,54,53,74,
+92,26,27,82,2,229,57,44,40,52,53,39,44,57,254,1,57,58,43,39,53,53,39,44,57,
+57,44,40,52,53,39,253,9,53,39,43,57,58,42,39,53,3,10,24,24,19,17,24,24,17,
+19,24,24,19,17,24,24,17,2,185,24,17,19,24,24,19,17,24,250,215,25,18,17,24,
+24,17,18,25,2,164,61,14,17,19,14,254,106,50,14,11,11,14,2,78,49,25,24,254,
+115,51,49,14,19,19,0,0,3,0,102,255,236,3,76,5,154,0,30,0,41,0,53,0,0,37,54,
+54,53,52,39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,39,55,22,17,20,7,22,
+21,20,6,7,3,38,38,35,34,6,21,20,22,51,50,38,54,51,50,22,21,20,6,35,34,38,
+53,2,98,58,73,22,121,195,132,169,168,129,198,124,20,65,58,82,144,56,56,81,
+71,18,47,143,83,87,109,114,82,175,214,33,25,25,34,34,25,25,33,45,73,217,118,
+81,76,143,151,109,119,147,159,64,85,115,197,73,66,183,254,244,146,118,126,
+140,130,255,88,2,231,81,87,89,75,70,88,185,34,34,25,25,32,32,25,0,1,0,102,
+255,236,4,233,5,37,0,19,0,0,1,17,22,4,21,20,6,35,34,39,6,6,35,34,38,53,52,
+36,55,17,2,219,245,1,25,141,131,193,112,63,147,95,133,140,1,26,245,5,37,253,
+2,10,180,150,113,118,182,97,85,121,110,151,179,10,2,254,0,2,0,137,0,0,4,242,
+5,147,0,20,0,24,0,0,19,1,51,1,54,54,51,50,22,21,20,6,35,34,38,39,1,17,35,
+17,9,4,137,1,137,72,1,82,22,80,50,72,102,102,72,47,76,23,254,184,102,254,
+133,1,174,1,62,254,194,254,195,4,6,1,141,254,175,38,50,102,72,73,102,43,35,
+254,187,253,186,2,70,1,120,254,232,1,61,1,64,254,194,0,0,1,0,102,255,127,
+3,190,6,61,0,27,0,0,37,52,37,17,35,17,39,38,38,53,52,54,55,55,17,51,17,54,
+54,53,51,20,6,7,17,22,22,21,3,88,254,170,102,17,160,133,137,156,17,102,178,
+164,102,216,228,231,213,29,245,142,253,223,2,72,6,52,126,96,98,127,50,6,2,
+69,253,224,74,194,121,169,247,86,254,100,87,245,167,0,0,3,0,102,1,215,6,33,
+3,213,0,25,0,37,0,49,0,0,0,22,23,33,54,54,51,50,22,21,20,6,35,34,38,39,33,
+6,6,35,34,38,53,52,54,51,0,54,53,52,38,35,34,6,21,20,22,51,32,54,53,52,38,
+35,34,6,21,20,22,51,1,193,141,16,1,201,19,140,91,106,150,151,105,91,141,18,
+254,55,16,141,93,105,149,148,106,3,251,91,92,61,62,90,89,63,252,130,91,92,
+62,63,88,86,65,3,213,118,87,90,115,150,106,106,148,113,90,86,117,149,105,
+105,151,254,104,88,64,64,90,91,63,63,89,89,63,62,92,92,62,62,90,0,0,18,0,
+184,255,33,7,113,6,154,0,3,0,119,0,122,0,125,0,128,0,131,0,134,0,137,0,140,
+0,143,0,155,0,167,0,179,0,191,0,203,0,215,0,227,0,239,0,0,19,33,17,33,0,22,
+21,20,6,7,23,33,3,6,6,35,34,38,53,52,54,51,50,22,23,55,39,6,6,35,34,38,53,
+52,54,51,50,22,23,55,39,6,6,35,34,38,53,52,54,51,50,22,23,19,33,7,22,22,21,
+20,6,35,34,38,53,52,54,55,39,33,19,54,54,51,50,22,21,20,6,35,34,38,39,7,23,
+54,54,51,50,22,21,20,6,35,34,38,39,7,23,54,54,51,50,22,21,20,6,35,34,38,39,
+3,33,55,38,38,53,52,54,51,1,17,55,3,17,19,1,17,3,19,17,7,1,21,55,5,53,7,1,
+35,23,17,7,51,18,6,21,20,22,51,50,54,53,52,38,35,2,6,21,20,22,51,50,54,53,
+52,38,35,4,54,53,52,38,35,34,6,21,20,22,51,36,54,53,52,38,35,34,6,21,20,22,
+51,18,54,53,52,38,35,34,6,21,20,22,51,0,6,21,20,22,51,50,54,53,52,38,35,0,
+54,53,52,38,35,34,6,21,20,22,51,0,54,53,52,38,35,34,6,21,20,22,51,184,6,185,
+249,71,3,152,86,45,35,188,1,172,198,14,75,48,59,87,88,58,46,72,17,254,252,
+14,75,48,59,87,86,60,48,75,14,252,254,17,73,45,60,86,86,60,47,76,14,196,254,
+86,188,35,45,88,58,58,87,45,35,191,254,89,194,16,75,48,60,86,86,60,46,73,
+16,254,250,16,75,48,60,86,88,58,48,75,16,250,254,16,73,46,59,87,88,58,48,
+75,16,197,1,170,191,35,45,86,59,253,11,176,176,176,5,59,176,176,176,250,197,
+174,5,61,174,254,51,245,122,122,245,207,26,26,17,17,26,26,17,17,26,26,17,
+17,26,26,17,254,182,26,26,17,17,26,26,17,254,183,26,26,17,17,26,26,17,17,
+26,26,17,17,26,26,17,2,164,26,26,17,17,26,26,17,254,182,26,26,17,17,26,26,
+17,254,183,26,26,17,17,26,26,17,6,154,248,135,2,84,86,60,43,69,19,217,1,156,
+44,54,85,60,61,84,52,42,109,188,43,55,85,60,60,86,57,44,191,104,40,50,86,
+59,60,86,57,43,1,157,219,19,68,42,61,84,83,62,42,68,19,219,254,99,43,57,86,
+60,59,86,52,40,106,189,44,55,86,60,61,84,55,43,188,107,40,52,85,60,61,84,
+54,44,254,100,217,19,69,43,60,86,4,114,254,74,70,253,18,254,78,1,109,2,237,
+1,178,254,148,251,100,1,174,69,2,20,246,123,123,246,123,3,86,139,250,106,
+139,5,12,26,17,17,26,26,17,17,26,252,234,26,17,17,26,26,17,17,26,197,26,17,
+17,26,26,17,17,26,111,26,17,17,26,26,17,17,26,3,22,26,17,17,26,26,17,17,26,
+254,203,26,17,17,26,26,17,17,26,1,164,26,17,17,26,26,17,17,26,254,6,26,17,
+17,26,26,17,17,26,0,10,0,102,254,201,8,109,6,207,0,85,0,97,0,109,0,121,0,
+133,0,145,0,157,0,169,0,181,0,193,0,0,1,38,39,6,35,34,39,6,6,35,34,38,53,
+52,54,51,50,22,23,54,51,50,23,54,55,38,53,52,54,55,38,53,52,54,51,50,22,21,
+20,7,22,22,21,20,7,22,23,54,51,50,22,23,54,51,50,22,21,20,6,35,34,39,6,6,
+35,34,39,6,7,22,21,20,7,22,21,20,6,35,34,38,53,52,55,38,53,52,2,22,51,50,
+54,53,52,38,35,34,6,21,38,38,35,34,6,21,20,22,51,50,54,53,0,54,53,52,38,35,
+34,6,21,20,22,51,0,38,35,34,6,21,20,22,51,50,54,53,0,54,53,52,38,35,34,6,
+21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,0,38,35,34,6,21,20,22,51,50,
+54,53,0,54,53,52,38,35,34,6,21,20,22,51,0,38,35,34,6,21,20,22,51,50,54,53,
+3,205,96,48,65,94,106,66,31,90,51,93,131,131,93,51,90,31,69,103,89,68,50,
+96,66,43,37,80,129,92,93,131,82,37,45,68,99,49,68,89,51,90,31,69,103,93,131,
+131,93,106,66,31,90,51,96,63,53,93,68,82,82,131,93,92,129,80,80,14,138,97,
+98,140,140,98,98,137,102,73,48,48,73,73,48,49,72,1,133,69,69,52,49,69,69,
+49,253,86,72,48,48,73,73,48,48,72,2,222,69,70,51,51,67,70,48,50,71,70,51,
+49,69,69,49,2,70,73,48,47,74,71,50,49,72,253,237,70,70,51,49,69,70,48,3,158,
+73,48,50,71,72,49,49,72,1,158,49,96,65,79,37,42,127,94,91,132,45,37,82,68,
+96,50,66,94,51,90,31,67,105,91,132,130,93,103,69,31,90,51,92,68,51,95,68,
+45,37,82,130,93,92,129,79,37,42,65,98,47,68,90,103,69,69,103,91,132,132,91,
+105,67,67,105,92,1,15,140,140,96,97,140,139,100,52,71,71,50,50,69,69,50,253,
+188,72,49,47,74,72,49,48,73,2,120,69,71,50,50,69,69,50,1,84,72,49,48,72,71,
+49,50,71,251,16,71,50,47,74,71,50,49,72,3,206,71,70,49,49,72,69,50,2,172,
+71,50,49,71,72,48,52,69,253,134,71,72,49,49,70,69,50,0,0,11,0,102,255,104,
+6,139,6,41,0,32,0,39,0,49,0,52,0,57,0,62,0,69,0,75,0,81,0,86,0,90,0,0,1,1,
+21,33,22,23,33,17,33,6,7,33,21,20,2,4,35,34,36,2,53,53,33,38,39,33,17,33,
+54,55,33,53,1,1,33,22,22,51,50,54,1,17,22,51,50,55,17,38,35,34,37,1,1,19,
+17,6,21,20,1,22,23,33,53,37,17,54,54,53,52,38,19,6,7,33,54,55,33,22,23,33,
+38,39,3,52,55,35,21,35,51,53,35,3,158,1,164,254,253,58,35,1,239,254,49,12,
+43,1,23,139,254,252,142,148,254,249,142,1,23,44,12,254,49,1,238,32,62,254,
+254,1,166,1,147,253,29,60,200,117,106,197,254,158,21,24,23,22,19,26,26,1,
+50,254,234,254,229,133,77,2,30,5,6,1,100,253,231,35,43,43,19,86,101,1,148,
+16,6,252,144,7,13,1,149,107,79,127,8,159,205,102,102,6,41,254,104,71,58,96,
+254,221,116,84,35,159,255,0,155,153,1,2,159,35,86,114,1,35,87,67,71,1,152,
+250,111,93,108,110,4,9,253,36,6,9,2,217,8,98,1,6,254,250,253,12,2,56,110,
+173,175,1,32,21,65,86,170,253,202,51,147,85,84,148,253,157,90,6,47,49,58,
+38,6,90,1,150,27,59,86,86,0,4,0,102,255,150,5,115,6,27,0,16,0,19,0,22,0,25,
+0,0,1,1,21,33,17,33,21,33,17,35,1,53,33,17,33,53,1,23,17,33,1,17,33,1,17,
+1,3,18,2,97,253,172,2,84,253,172,72,253,143,2,82,253,174,2,101,84,1,162,253,
+247,254,99,1,157,254,99,6,27,253,157,71,254,217,103,253,179,2,108,72,1,39,
+71,2,99,160,254,92,252,113,1,155,1,244,1,156,254,100,0,0,7,0,102,255,29,3,
+186,6,199,0,33,0,45,0,57,0,69,0,81,0,93,0,105,0,0,1,53,33,53,33,53,38,38,
+53,52,54,51,50,22,21,20,6,7,21,33,21,33,21,22,22,21,20,6,35,34,38,53,52,54,
+0,54,53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,18,22,
+21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,18,54,53,
+52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,1,221,254,189,
+1,67,161,214,249,177,177,249,214,160,1,67,254,189,161,213,248,178,176,250,
+215,1,91,188,189,135,135,188,187,136,136,188,189,135,135,188,187,136,89,124,
+124,89,89,124,124,89,89,124,124,89,89,124,124,89,47,64,64,47,46,64,64,46,
+47,64,64,47,46,64,64,46,2,109,81,103,80,18,240,166,178,248,249,177,164,243,
+17,80,103,81,18,242,162,178,248,247,179,163,241,1,126,188,136,136,187,188,
+135,135,189,251,170,188,136,136,187,188,135,135,189,6,111,124,89,89,124,124,
+89,89,124,251,170,124,89,89,124,124,89,89,124,254,188,64,47,46,64,64,46,47,
+64,4,86,64,47,46,64,64,46,47,64,0,0,5,0,102,0,0,6,78,5,66,0,54,0,57,0,60,
+0,63,0,75,0,0,1,35,21,23,21,1,1,35,39,35,21,35,53,35,21,35,53,35,7,35,1,1,
+53,55,53,35,53,51,53,35,53,51,53,39,53,1,39,53,52,54,51,50,22,21,20,7,1,21,
+7,21,51,21,35,21,51,1,33,3,1,17,37,5,17,5,38,54,53,52,38,35,34,6,21,20,22,
+51,6,78,203,203,253,82,1,139,113,102,94,103,106,103,94,100,113,1,135,253,
+84,203,203,203,203,203,203,2,64,2,101,81,82,102,4,2,64,203,203,203,203,252,
+69,1,142,199,254,62,1,51,2,82,254,207,112,48,48,34,32,48,47,33,2,199,78,115,
+121,1,135,252,236,203,203,203,203,203,203,3,18,254,123,121,115,78,102,107,
+102,76,114,123,254,174,29,31,128,161,166,123,30,28,1,80,123,114,76,102,107,
+254,4,1,144,1,77,254,166,168,172,1,94,176,41,99,71,70,100,97,73,73,97,0,0,
+3,0,102,255,162,10,23,6,68,0,62,0,74,0,86,0,0,5,1,1,35,1,1,37,55,5,55,37,
+55,5,55,37,55,5,55,37,55,5,19,38,38,53,52,54,51,50,22,21,20,6,7,1,1,38,38,
+53,52,54,51,50,22,21,20,6,7,19,37,23,5,23,37,23,5,23,37,23,5,23,37,23,0,54,
+53,52,38,35,34,6,21,20,22,51,32,54,53,52,38,35,34,6,21,20,22,51,7,227,254,
+201,254,199,103,254,199,254,199,253,204,27,1,209,27,254,47,24,1,209,27,254,
+49,24,1,209,27,254,49,25,1,209,161,55,67,108,80,79,111,69,56,1,43,1,43,55,
+67,111,77,79,111,69,55,161,1,211,25,254,45,27,1,211,24,254,47,27,1,211,24,
+254,45,27,1,211,25,249,225,51,51,37,37,49,49,37,2,254,51,51,37,37,49,49,37,
+92,4,151,251,105,4,151,251,103,151,99,125,100,125,98,125,99,125,98,125,100,
+127,99,127,2,98,20,95,63,81,110,110,81,63,95,20,251,149,4,107,20,95,63,82,
+109,110,81,63,95,20,253,158,127,99,125,102,125,98,125,99,125,98,125,100,125,
+99,4,246,49,37,37,51,51,37,37,49,49,37,37,51,51,37,37,49,0,21,0,184,255,203,
+6,225,5,244,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,
+59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,0,19,33,17,33,17,33,17,33,17,
+33,17,33,1,21,51,53,5,51,53,35,17,51,53,35,19,51,53,35,17,51,53,35,5,21,51,
+53,1,51,53,35,53,51,53,35,3,53,35,21,1,53,35,21,5,51,53,35,37,51,53,35,23,
+51,53,35,53,51,53,35,7,51,53,35,1,51,53,35,19,21,51,53,1,51,53,35,53,51,53,
+35,1,53,35,21,184,1,236,2,82,1,235,254,21,253,174,254,20,3,72,143,254,123,
+144,144,144,144,246,143,143,143,143,1,236,143,254,123,143,143,143,143,103,
+143,2,123,143,253,30,144,144,254,21,143,143,245,144,144,144,144,245,143,143,
+1,235,144,144,246,143,254,123,144,144,144,144,1,133,143,4,8,1,236,254,20,
+253,174,254,21,1,235,3,215,143,143,143,143,254,123,144,252,143,143,2,82,144,
+246,144,144,254,123,143,102,144,252,143,144,144,1,236,143,143,246,143,103,
+143,143,143,102,144,144,144,252,143,144,2,225,144,144,254,123,143,102,144,
+254,123,143,143,0,0,3,0,104,255,236,6,55,5,49,0,50,0,62,0,73,0,0,19,19,38,
+38,53,52,54,51,50,22,21,20,7,23,33,17,22,22,21,20,6,35,34,38,53,52,54,55,
+17,33,7,50,22,21,20,6,7,39,54,54,53,52,38,35,35,53,55,35,34,39,3,4,54,53,
+52,38,35,34,6,21,20,22,51,1,54,53,52,38,35,34,6,21,20,22,123,203,108,114,
+96,80,87,104,16,29,3,161,81,97,133,94,93,130,93,77,254,55,47,74,94,111,106,
+45,73,86,40,54,92,57,227,46,46,207,4,174,74,74,51,51,70,70,51,252,16,13,48,
+42,32,40,80,1,10,2,29,36,154,111,103,118,149,117,73,107,2,254,55,19,125,77,
+94,129,130,93,80,122,19,1,98,108,83,67,71,130,49,95,34,82,39,28,25,72,133,
+6,253,213,147,68,53,53,72,74,51,51,70,3,55,69,87,74,92,64,52,76,104,0,0,13,
+0,102,255,141,3,100,6,51,0,17,0,20,0,23,0,26,0,38,0,50,0,62,0,74,0,86,0,98,
+0,110,0,122,0,134,0,0,37,33,53,1,33,53,1,33,53,1,51,1,21,33,1,21,33,1,39,
+3,3,1,3,3,1,3,3,54,54,51,50,22,21,20,6,35,34,38,53,16,54,51,50,22,21,20,6,
+35,34,38,53,16,54,51,50,22,21,20,6,35,34,38,53,16,54,51,50,22,21,20,6,35,
+34,38,53,16,54,51,50,22,21,20,6,35,34,38,53,0,54,51,50,22,21,20,6,35,34,38,
+53,16,54,51,50,22,21,20,6,35,34,38,53,0,54,51,50,22,21,20,6,35,34,38,53,16,
+54,51,50,22,21,20,6,35,34,38,53,3,98,253,4,1,43,254,213,1,41,254,215,1,91,
+71,1,90,254,215,1,41,254,215,1,41,157,224,223,1,191,224,223,1,191,224,223,
+166,33,24,25,35,35,25,24,33,33,24,25,35,35,25,24,33,33,24,25,35,35,25,24,
+33,33,24,25,35,35,25,24,33,33,24,25,35,35,25,24,33,1,68,32,25,25,34,34,25,
+25,32,32,25,25,34,34,25,25,32,253,120,33,25,25,34,34,25,25,33,33,25,25,34,
+34,25,25,33,59,72,1,105,71,1,105,71,1,164,254,92,71,254,151,71,254,151,31,
+1,16,254,240,1,176,1,16,254,240,1,176,1,16,254,240,125,35,35,25,24,33,33,
+24,1,171,34,34,25,25,33,33,25,251,43,35,35,25,25,32,32,25,1,203,35,35,25,
+24,33,33,24,253,35,35,35,24,25,33,33,25,1,192,35,35,24,25,33,33,25,1,213,
+34,34,25,25,32,32,25,254,92,35,35,24,25,33,33,25,1,213,34,34,25,25,32,32,
+25,0,0,7,0,102,0,0,7,4,5,39,0,55,0,59,0,63,0,74,0,84,0,89,0,95,0,0,1,53,51,
+21,55,51,50,22,21,20,6,35,35,17,33,17,6,35,34,38,53,52,54,51,23,53,51,21,
+22,21,20,7,17,33,17,38,38,53,52,54,55,53,51,21,22,22,21,20,6,7,17,33,53,38,
+53,52,19,53,33,21,33,33,53,33,2,55,53,38,35,34,6,21,20,22,51,5,21,23,51,50,
+54,53,52,38,35,5,53,6,21,20,55,21,54,53,52,38,5,195,102,10,10,81,118,117,
+82,20,251,41,12,25,83,116,118,81,37,102,60,60,1,209,65,84,84,65,103,66,79,
+78,67,1,211,76,76,254,45,253,200,1,209,254,47,120,18,14,23,38,58,56,40,4,
+252,10,10,41,56,59,38,253,76,47,150,43,25,3,100,144,103,2,118,80,82,117,253,
+254,3,49,4,116,83,82,116,4,113,166,60,81,86,56,254,21,1,14,16,106,71,69,107,
+16,103,105,17,109,64,65,108,20,254,242,176,59,99,96,253,61,174,174,174,2,
+127,9,176,8,56,40,41,56,108,189,2,58,39,38,58,51,166,31,51,57,135,158,29,
+51,23,42,0,6,0,102,255,227,6,117,5,242,0,39,0,49,0,59,0,69,0,79,0,91,0,0,
+19,4,23,54,55,38,3,55,5,37,23,2,7,22,23,54,37,23,3,19,7,36,39,6,7,22,19,7,
+37,5,39,18,55,38,39,6,5,39,19,3,5,38,39,23,7,54,55,38,53,52,19,22,23,54,51,
+50,23,54,55,7,19,38,39,6,35,34,39,6,7,55,1,6,7,22,21,20,7,22,23,39,4,54,53,
+52,38,35,34,6,21,20,22,51,133,1,67,218,14,21,98,58,47,1,23,1,22,47,58,99,
+20,16,216,1,67,31,123,123,31,254,188,215,15,19,96,59,47,254,234,254,233,47,
+59,97,19,16,223,254,194,31,123,123,2,13,188,191,90,90,199,180,13,64,40,83,
+37,41,37,40,85,38,200,200,39,84,33,44,41,37,83,40,201,2,116,197,177,12,12,
+170,204,90,254,41,96,96,67,66,96,96,66,4,47,58,100,21,16,220,1,65,31,123,
+123,31,254,192,221,14,21,97,59,47,254,233,254,234,47,58,97,19,15,219,254,
+192,31,123,123,31,1,71,212,14,20,98,57,47,1,22,1,23,201,85,38,201,200,40,
+83,37,40,40,2,79,201,176,13,11,183,192,90,251,111,195,182,13,13,179,198,90,
+2,227,39,82,39,41,43,36,80,41,200,161,93,68,68,96,95,69,69,92,0,4,0,102,255,
+76,6,172,6,117,0,60,0,72,0,86,0,100,0,0,5,1,23,21,20,6,35,34,38,53,53,55,
+1,39,1,53,38,39,1,39,1,38,53,52,55,1,55,1,54,55,1,55,1,39,53,52,54,51,50,
+22,21,20,7,1,23,1,22,23,1,23,1,22,21,20,7,1,7,1,6,7,1,0,54,53,52,38,35,34,
+6,21,20,22,51,7,6,21,20,22,51,50,54,53,52,39,6,35,34,19,54,53,52,38,35,34,
+6,21,20,23,54,51,50,5,164,254,166,2,105,92,95,99,2,254,170,74,1,188,67,43,
+254,67,73,1,221,4,4,254,26,74,1,195,39,69,254,68,74,1,90,2,102,92,94,103,
+4,1,96,74,254,63,70,41,1,194,74,254,27,6,6,1,225,74,254,62,44,69,1,195,253,
+244,132,131,92,90,127,127,90,69,23,52,40,39,55,26,35,33,36,104,26,56,38,39,
+53,23,27,42,41,66,1,89,37,37,176,209,201,184,37,37,254,170,73,1,189,4,39,
+69,254,68,74,1,221,28,31,34,19,1,230,74,254,61,71,44,1,188,74,254,164,43,
+45,186,199,196,189,46,42,1,96,74,254,64,41,72,1,193,74,254,28,27,28,33,28,
+254,33,74,1,190,68,40,254,63,1,252,126,91,91,132,131,92,90,127,96,98,117,
+127,156,157,126,113,102,6,2,125,104,113,126,156,152,130,117,100,8,0,0,8,0,
+102,255,205,10,238,6,133,0,64,0,67,0,72,0,77,0,85,0,94,0,106,0,118,0,0,55,
+54,0,55,39,38,53,52,36,37,23,6,2,3,33,2,2,39,55,4,4,21,20,7,7,22,0,23,7,38,
+39,7,23,7,39,7,23,7,39,7,22,23,7,2,2,39,1,35,1,6,2,7,39,54,55,39,7,39,55,
+39,7,39,55,39,7,9,2,5,4,7,5,54,5,38,37,22,23,1,18,55,6,6,21,20,22,1,22,18,
+23,54,54,53,52,38,0,22,21,20,6,35,34,38,53,52,54,51,22,38,53,52,54,51,50,
+22,21,20,6,35,102,191,1,113,221,47,97,1,20,1,15,25,127,142,12,3,72,13,144,
+124,25,1,15,1,20,97,47,213,1,114,198,103,47,98,80,110,102,108,74,71,94,73,
+56,14,5,103,16,85,65,254,105,72,254,103,74,81,11,103,8,11,58,71,95,72,74,
+108,103,111,82,143,3,88,1,133,1,133,252,129,254,211,217,1,90,49,6,117,222,
+254,216,123,49,251,82,33,159,133,147,40,3,128,76,94,20,48,42,147,253,208,
+40,40,28,28,38,38,28,226,40,40,28,28,37,37,28,223,247,1,46,102,63,129,157,
+198,230,18,67,114,254,187,254,244,1,19,1,65,111,67,18,230,198,153,132,64,
+97,254,211,253,37,59,111,30,183,37,183,29,194,35,194,20,127,88,41,1,18,1,
+69,134,253,45,2,211,151,254,169,239,41,138,77,20,194,35,196,27,183,37,183,
+30,170,2,95,253,81,2,175,5,137,215,129,251,124,217,137,232,249,2,162,1,117,
+186,30,165,122,69,110,1,240,91,254,239,195,60,110,72,122,165,252,237,40,28,
+28,37,37,28,28,40,133,37,28,28,40,40,28,28,37,0,0,7,0,184,0,0,9,72,5,133,
+0,21,0,32,0,36,0,40,0,44,0,48,0,60,0,0,19,33,53,52,18,36,51,50,4,18,21,21,
+33,17,33,17,4,33,32,37,17,33,1,4,33,32,37,53,52,0,35,34,0,1,33,53,33,1,53,
+33,21,1,33,53,33,1,53,33,21,0,22,21,20,6,35,34,38,53,52,54,51,184,1,211,169,
+1,33,171,171,1,35,167,1,211,253,198,255,0,254,240,254,247,254,253,253,198,
+2,58,1,5,1,7,1,11,1,5,254,202,216,221,254,207,254,45,1,108,254,148,1,108,
+254,148,6,86,1,108,254,148,1,108,254,148,253,180,63,61,43,43,61,64,40,2,246,
+10,175,1,44,170,173,254,212,172,10,253,10,2,96,213,213,253,160,2,236,250,
+250,10,234,1,63,254,193,253,206,225,253,215,226,226,1,72,225,253,215,226,
+226,3,134,60,45,43,61,61,43,46,59,0,0,3,0,102,255,221,7,213,6,184,0,159,0,
+171,0,183,0,0,1,23,54,55,17,7,39,7,7,39,23,7,39,23,7,39,23,7,7,23,7,7,23,
+7,7,23,21,7,23,21,5,39,55,39,53,55,39,55,55,39,55,55,39,55,55,39,55,23,39,
+55,23,39,55,23,55,55,23,55,17,51,17,23,55,23,23,55,23,7,55,23,7,55,23,7,23,
+23,7,23,23,7,23,23,7,23,21,7,23,7,37,53,55,39,53,55,39,39,55,39,39,55,39,
+39,55,7,39,55,7,39,55,7,39,39,7,39,17,23,55,23,7,23,55,23,7,22,23,55,23,7,
+7,51,21,39,7,7,23,7,39,6,7,23,7,39,38,39,7,39,55,39,7,39,55,53,52,55,39,55,
+23,54,55,39,0,54,53,52,38,35,34,6,21,20,22,51,18,22,21,20,6,35,34,38,53,52,
+54,51,3,76,106,30,24,46,75,6,66,96,30,53,121,70,41,147,104,22,144,119,14,
+160,147,6,162,158,172,172,254,174,33,191,184,153,149,6,172,156,12,189,152,
+23,176,121,35,182,84,49,170,36,65,137,15,71,105,33,102,31,104,72,14,137,66,
+37,170,49,84,182,35,121,177,22,151,188,12,155,172,6,150,154,184,190,33,254,
+174,172,172,158,162,6,148,160,15,119,143,23,105,148,41,70,121,53,31,97,65,
+6,76,43,24,70,90,69,34,115,72,125,12,6,131,45,165,9,152,205,14,15,123,67,
+146,33,32,74,91,102,38,36,59,94,71,32,140,45,160,6,156,31,164,25,24,98,1,
+112,113,113,77,77,108,108,77,37,53,53,37,37,51,51,37,3,199,138,12,3,1,96,
+2,102,116,23,76,111,43,49,106,57,16,102,68,8,86,70,37,69,72,51,66,71,43,91,
+71,111,98,62,96,72,37,61,72,55,82,70,45,114,70,6,125,64,13,148,49,59,155,
+33,96,147,12,116,84,1,26,254,224,78,116,12,147,96,33,155,59,49,148,13,64,
+125,6,70,114,45,70,82,55,72,61,37,72,96,62,98,111,71,91,43,71,66,51,72,69,
+37,70,86,8,68,102,16,57,106,49,43,111,76,23,116,102,2,254,160,4,147,43,147,
+29,111,76,119,21,24,66,91,82,53,102,2,16,15,104,76,123,13,4,137,47,189,11,
+19,149,37,184,55,69,90,80,20,31,30,44,98,45,38,21,127,253,240,109,75,75,116,
+115,76,76,108,1,18,53,37,37,51,51,37,37,53,0,3,0,102,255,133,6,12,6,78,0,
+56,0,66,0,77,0,0,19,19,23,3,37,23,7,1,1,39,55,5,3,55,19,7,39,1,19,23,54,51,
+50,22,21,20,6,35,34,39,6,7,39,54,55,39,3,3,22,23,7,38,39,6,35,34,38,53,52,
+54,51,50,22,23,19,1,7,1,22,51,50,54,53,52,38,35,34,5,38,35,34,6,21,20,22,
+51,50,54,203,190,99,136,1,101,53,227,1,30,1,31,227,53,1,100,135,98,191,55,
+195,254,201,221,20,111,102,97,110,114,93,113,98,44,68,94,60,79,41,197,239,
+58,83,94,57,58,98,111,92,115,111,96,59,104,48,242,254,201,193,3,166,74,75,
+50,55,56,49,68,252,210,86,64,50,54,55,49,44,72,4,2,2,76,33,254,94,221,86,
+141,254,82,1,174,141,86,221,1,162,33,253,180,43,119,254,45,254,180,33,129,
+111,91,85,116,100,74,145,45,135,125,64,1,39,254,153,88,172,45,122,97,100,
+116,85,92,110,73,56,1,109,1,211,119,252,227,88,60,39,45,55,111,111,55,45,
+39,60,50,0,2,0,184,255,223,4,10,5,231,0,19,0,31,0,0,1,17,5,54,51,50,22,21,
+20,6,35,34,38,53,52,55,37,17,35,17,0,54,53,52,38,35,34,6,21,20,22,51,1,31,
+1,104,60,77,111,139,139,111,110,139,45,254,219,103,2,153,83,83,65,67,80,81,
+66,5,231,254,179,232,43,172,135,137,170,172,135,106,78,189,251,192,6,8,251,
+246,116,89,88,117,109,96,94,111,0,5,0,184,255,152,4,90,6,49,0,21,0,24,0,27,
+0,30,0,33,0,0,1,17,35,1,17,35,17,51,1,17,1,35,17,51,17,1,51,17,35,37,17,37,
+3,51,53,17,53,35,19,53,35,19,51,53,4,90,72,253,13,103,72,1,117,254,139,72,
+103,2,243,72,72,254,201,1,55,211,181,181,181,178,2,176,2,61,253,91,2,65,254,
+137,2,17,254,227,3,29,254,227,2,16,254,138,2,65,253,90,238,252,215,237,254,
+226,137,2,121,137,251,135,135,4,88,136,0,7,0,102,255,104,2,242,6,63,0,35,
+0,42,0,49,0,56,0,63,0,70,0,77,0,0,1,38,38,53,52,54,51,50,22,21,20,6,7,22,
+22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,55,17,6,6,
+21,20,22,19,17,6,6,21,20,22,19,17,54,54,53,52,38,3,17,6,6,21,20,22,19,17,
+54,54,53,52,38,3,17,54,54,53,52,38,1,2,72,84,192,134,134,192,85,71,74,82,
+83,71,71,83,191,135,135,191,83,71,71,83,82,193,75,97,98,74,75,97,98,176,75,
+97,99,175,75,97,96,178,75,97,99,73,77,95,99,3,229,44,145,88,133,192,188,137,
+88,145,44,43,144,87,88,143,43,44,144,87,135,191,191,135,87,144,44,43,143,
+88,87,144,101,1,180,18,122,77,80,121,253,199,1,180,18,122,77,80,121,1,162,
+254,76,18,122,79,78,122,252,58,1,178,18,122,77,78,121,5,236,254,76,18,122,
+79,78,122,251,197,254,78,19,121,77,78,122,0,0,1,0,102,255,236,3,39,3,141,
+0,66,0,0,1,35,21,22,51,50,22,21,20,6,21,20,22,21,20,6,21,20,22,21,20,6,35,
+34,38,35,34,6,35,34,38,35,34,7,7,6,6,35,34,53,52,54,53,52,39,39,38,38,53,
+52,54,53,52,39,39,38,38,53,52,54,51,50,23,53,35,53,33,2,236,238,25,51,100,
+86,59,94,102,73,22,17,28,79,34,51,22,58,49,43,39,21,18,39,20,47,29,60,123,
+13,30,16,27,99,11,24,13,22,89,79,13,59,238,2,66,3,39,166,4,29,30,29,36,19,
+19,33,28,37,45,21,21,60,29,20,23,59,237,253,8,18,10,17,49,36,57,18,11,6,12,
+7,21,21,25,49,18,11,7,16,8,22,18,28,35,8,160,102,0,2,0,102,255,166,7,84,6,
+78,0,43,0,94,0,0,1,5,22,23,55,23,5,21,16,2,4,35,34,36,2,17,53,37,55,23,54,
+55,37,55,23,54,55,39,55,5,54,51,50,23,54,51,50,23,37,23,7,22,23,55,1,17,7,
+39,55,53,7,39,55,53,7,39,55,53,7,39,55,38,35,34,2,21,20,18,22,51,50,54,18,
+53,52,2,35,34,7,23,7,39,21,23,7,39,21,23,7,39,21,23,7,39,17,7,27,254,241,
+22,9,236,61,254,225,157,254,224,155,152,254,225,161,254,225,62,233,15,16,
+254,244,61,246,31,47,238,62,1,4,66,75,153,66,66,153,74,68,1,4,61,239,45,34,
+246,252,205,147,70,217,147,70,217,147,70,217,147,70,211,28,134,121,157,129,
+242,126,126,239,133,156,123,137,24,210,69,148,217,69,148,217,69,148,217,69,
+148,5,57,209,70,83,182,82,223,37,254,254,254,103,238,234,1,156,1,3,35,225,
+82,184,93,60,211,82,192,68,53,184,82,201,39,111,111,39,201,82,184,49,70,190,
+250,242,1,6,147,73,215,88,147,74,213,90,148,74,213,90,147,73,209,140,254,
+226,249,227,254,148,212,210,1,108,229,249,1,30,140,209,73,147,86,217,74,148,
+86,217,74,147,88,215,73,147,254,250,0,0,3,0,184,0,0,5,135,5,115,0,56,0,70,
+0,82,0,0,19,51,50,23,53,52,54,51,50,22,21,21,54,51,51,21,35,21,51,21,35,21,
+51,21,35,21,51,21,35,21,51,21,35,21,51,21,33,53,51,53,35,53,51,53,35,53,51,
+53,35,53,51,53,35,53,51,53,35,5,38,39,17,33,17,6,7,7,6,6,35,34,38,4,54,53,
+52,38,35,34,6,21,20,22,51,184,133,125,105,145,107,105,149,99,99,164,153,153,
+153,153,153,153,153,153,153,153,251,49,154,154,154,154,154,154,154,154,154,
+154,1,127,80,47,2,207,38,31,58,27,126,80,80,125,1,12,88,89,62,62,88,88,62,
+4,35,33,25,143,201,198,146,23,31,103,88,102,90,103,88,102,90,103,88,102,102,
+88,103,90,102,88,103,90,102,88,41,27,6,252,178,3,78,3,9,18,92,117,115,13,
+141,99,103,138,139,102,99,141,0,10,0,102,255,236,5,20,5,207,0,21,0,25,0,28,
+0,31,0,34,0,37,0,40,0,43,0,46,0,49,0,0,19,37,37,53,37,37,53,33,21,5,5,21,
+5,5,21,5,5,21,33,53,37,37,1,51,17,35,5,17,55,5,17,7,19,17,7,37,17,55,1,53,
+7,37,21,51,3,21,55,5,53,35,102,1,66,254,190,1,50,254,206,4,174,254,207,1,
+49,254,191,1,65,254,191,1,65,251,82,1,66,254,190,1,222,243,243,1,90,243,253,
+76,244,244,237,2,174,237,253,82,172,2,109,170,170,166,253,153,166,2,29,192,
+211,72,194,174,103,103,174,194,72,211,192,72,201,186,102,102,186,201,254,
+125,5,22,251,254,204,154,154,1,52,154,253,145,1,33,141,141,254,223,148,254,
+90,98,98,98,98,5,22,98,98,98,98,0,0,3,0,102,255,43,6,129,6,174,0,69,0,123,
+0,178,0,0,37,39,53,55,39,53,55,39,53,55,39,53,55,39,53,55,39,53,55,39,53,
+55,39,53,55,39,53,55,39,53,37,23,7,23,21,7,23,21,7,23,21,7,23,21,7,23,21,
+7,23,21,7,23,21,7,23,21,7,23,21,7,23,21,7,23,21,5,39,55,39,53,1,22,18,21,
+20,6,7,22,23,7,38,35,34,6,21,20,22,51,50,55,23,6,35,34,2,53,52,54,55,39,55,
+23,54,55,39,55,23,54,55,35,53,51,38,39,7,39,55,38,39,7,39,55,38,39,1,7,22,
+22,21,20,2,35,34,38,39,55,22,51,50,54,53,52,38,35,34,7,39,54,55,38,38,53,
+52,18,55,23,6,7,23,7,39,6,7,23,7,39,6,7,51,21,35,22,23,55,23,7,22,23,55,3,
+98,131,131,131,125,125,121,121,121,121,121,121,121,121,121,121,123,123,123,
+123,1,31,20,139,129,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+121,121,119,119,119,131,254,213,20,141,131,2,15,173,187,77,77,101,76,91,75,
+101,83,111,121,98,99,69,94,94,168,143,179,148,119,125,45,143,36,13,180,25,
+192,9,10,209,211,3,12,198,21,182,13,34,151,49,124,47,75,253,92,125,119,147,
+178,143,81,130,52,95,69,99,98,121,111,84,101,75,90,74,102,75,79,191,170,41,
+74,49,125,49,152,28,21,184,20,201,9,5,213,209,6,12,193,24,182,36,15,144,123,
+43,70,34,43,70,35,41,71,37,41,72,37,41,71,37,45,68,37,41,73,37,41,72,37,41,
+74,34,37,80,90,98,33,43,72,41,36,72,39,39,72,41,38,72,39,39,72,41,36,72,41,
+37,72,41,36,72,39,31,78,38,35,72,39,33,73,95,99,32,43,70,6,84,77,254,225,
+183,120,226,94,36,128,53,131,204,138,179,227,168,41,229,1,28,224,177,251,
+14,82,92,94,58,26,55,97,58,35,64,102,53,45,55,100,50,28,45,78,91,65,37,39,
+252,227,82,14,251,177,222,254,226,108,121,41,168,231,175,133,209,131,53,128,
+36,88,224,128,186,1,30,75,94,37,39,65,91,78,35,38,50,100,55,35,63,102,53,
+46,58,97,55,63,21,94,0,4,0,102,255,197,4,201,5,53,0,50,0,62,0,74,0,85,0,0,
+55,17,23,38,38,53,52,55,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,
+6,35,35,22,21,20,6,7,55,17,35,17,5,7,23,7,39,21,35,53,7,39,55,39,37,17,1,
+54,54,53,52,38,39,6,6,21,20,22,2,54,55,38,38,35,34,6,21,20,22,51,36,6,7,22,
+51,50,54,53,52,38,35,205,254,25,39,45,32,134,172,177,129,72,135,49,41,131,
+82,136,171,172,135,31,45,39,25,254,102,254,254,35,221,69,164,103,163,70,221,
+35,254,254,1,103,66,97,86,79,85,81,97,117,102,32,21,102,81,83,120,119,84,
+1,174,102,21,52,153,84,118,118,84,68,1,206,94,53,118,75,136,114,111,90,87,
+113,54,46,40,60,113,87,90,111,114,136,75,118,53,94,254,50,1,63,98,25,203,
+73,147,194,194,147,73,203,25,98,254,193,1,14,56,200,88,135,175,22,25,176,
+131,94,191,2,125,46,57,40,54,59,39,40,59,197,54,40,103,59,40,39,59,0,2,0,
+102,255,236,5,41,5,213,0,71,0,83,0,0,19,55,39,53,39,55,23,54,55,39,55,23,
+54,55,38,53,52,54,55,23,6,6,21,20,23,54,51,50,23,54,53,52,38,39,55,22,22,
+21,20,7,22,23,55,23,7,22,23,55,23,7,21,7,23,7,39,6,7,23,7,39,6,6,35,34,38,
+39,7,39,55,38,39,7,4,54,53,52,38,35,34,6,21,20,22,51,104,232,2,232,17,227,
+9,16,228,45,226,28,39,96,91,97,62,75,73,74,70,78,79,68,76,72,76,62,97,91,
+98,32,36,225,45,227,15,11,227,17,232,2,238,21,233,12,15,240,53,234,51,147,
+86,87,147,51,229,54,236,15,10,227,2,185,161,162,112,113,160,158,115,1,123,
+47,27,51,37,102,35,48,40,95,94,94,45,41,120,144,93,184,75,82,60,141,69,111,
+90,39,41,94,109,69,141,60,82,75,184,93,141,123,32,54,104,94,105,38,50,43,
+102,43,27,53,47,103,48,46,36,148,86,144,81,91,91,81,144,86,148,37,45,48,194,
+232,165,166,232,237,161,161,236,0,0,2,0,184,255,125,4,33,5,254,0,35,0,47,
+0,0,1,6,6,7,21,5,5,21,5,5,21,5,39,37,37,53,37,37,53,37,53,6,35,34,38,53,52,
+54,51,50,22,21,21,54,54,55,5,53,52,38,35,34,6,21,20,22,51,50,4,33,63,149,
+85,254,188,1,76,254,180,1,76,253,221,37,1,113,254,186,1,68,254,188,1,174,
+54,60,165,194,172,131,139,134,65,116,50,254,178,83,87,86,114,136,120,57,4,
+72,50,106,37,172,164,61,68,168,77,70,254,94,174,78,66,159,72,66,215,75,12,
+186,150,146,196,192,201,123,32,88,40,203,166,159,132,138,102,107,127,0,0,
+1,0,102,0,0,5,211,4,164,0,13,0,0,19,17,33,17,7,1,17,33,21,33,53,33,17,1,102,
+5,109,59,253,184,1,156,252,98,1,155,253,179,2,195,1,225,254,31,45,1,167,252,
+41,102,102,3,215,254,84,0,0,8,0,102,255,236,5,152,5,4,0,36,0,56,0,68,0,80,
+0,92,0,103,0,114,0,126,0,0,1,21,20,4,35,34,39,6,35,34,36,53,53,38,38,53,52,
+54,55,53,52,36,51,50,23,54,51,50,22,22,21,21,22,22,21,20,6,37,22,22,23,54,
+54,55,38,53,52,55,38,38,39,6,6,7,22,21,20,6,54,53,52,38,35,34,6,21,20,22,
+51,0,6,21,20,22,51,50,54,53,52,38,35,36,54,53,52,38,35,34,6,21,20,22,51,0,
+38,35,34,21,20,22,51,50,54,53,36,6,21,20,22,51,50,54,53,52,35,0,22,51,50,
+54,53,52,38,35,34,6,21,4,254,254,251,138,72,41,41,70,139,254,252,66,88,86,
+68,1,5,138,66,45,43,70,85,189,125,66,88,90,252,139,81,168,60,52,174,83,33,
+33,81,175,53,58,171,80,35,157,54,54,38,38,54,55,37,3,134,54,55,37,38,54,54,
+38,253,49,199,36,26,90,207,36,28,1,39,197,98,64,203,94,26,36,1,41,197,36,
+26,92,205,64,254,217,200,95,28,36,208,89,26,36,1,72,15,111,222,32,32,222,
+111,15,19,171,113,110,171,24,14,111,223,33,33,100,162,72,14,24,169,112,115,
+169,110,11,109,81,73,117,11,81,93,92,84,9,115,75,81,109,9,78,98,98,109,121,
+86,88,121,121,88,88,119,1,160,121,88,88,119,121,86,88,121,67,160,72,21,22,
+164,68,21,22,253,55,162,43,68,163,21,22,231,162,69,22,21,162,69,43,2,199,
+160,22,21,69,163,22,21,0,0,3,0,184,255,150,5,217,6,33,0,51,0,55,0,59,0,0,
+19,33,53,33,53,33,17,33,17,33,21,33,21,33,21,33,21,33,21,33,17,33,21,33,21,
+33,21,33,21,33,21,33,17,33,17,33,53,33,53,33,53,33,53,33,53,33,17,33,53,33,
+53,33,1,33,53,33,53,33,53,33,186,1,148,254,106,1,252,1,41,1,252,254,107,1,
+149,254,107,1,149,254,107,1,149,254,107,1,149,254,107,1,149,254,4,254,215,
+254,4,1,150,254,108,1,148,254,108,1,148,254,108,1,148,254,108,1,250,1,41,
+254,215,1,41,254,215,5,92,94,103,253,178,2,78,103,192,103,192,102,254,24,
+102,94,103,94,102,2,77,253,179,102,192,103,192,103,1,231,103,94,253,84,94,
+102,95,0,0,5,0,102,0,180,5,135,5,35,0,27,0,30,0,33,0,36,0,39,0,0,19,51,17,
+35,53,51,53,51,21,33,53,51,21,51,21,35,17,51,21,35,21,35,53,33,21,35,53,35,
+37,17,5,37,17,37,55,37,33,1,7,33,102,195,195,195,102,2,207,103,194,194,194,
+194,103,253,49,102,195,3,248,254,238,254,67,1,17,86,1,0,254,0,1,0,254,1,252,
+1,238,1,251,103,211,211,211,211,103,254,5,103,211,211,211,211,152,1,151,205,
+203,254,107,202,64,192,254,193,188,0,0,11,0,184,255,252,6,84,5,215,0,43,0,
+61,0,79,0,85,0,91,0,94,0,97,0,100,0,103,0,106,0,109,0,0,1,23,21,7,23,21,7,
+23,21,7,23,21,7,23,21,7,23,21,7,23,21,7,33,39,53,55,39,53,55,39,53,55,39,
+53,55,39,53,55,39,53,55,39,53,55,23,21,7,23,21,7,23,21,7,23,21,7,23,21,7,
+23,21,1,1,53,1,1,53,55,39,53,55,39,53,55,39,53,55,39,53,55,1,35,1,1,35,3,
+3,1,51,19,19,51,33,51,39,17,55,35,5,23,39,33,7,55,3,23,55,5,55,7,5,168,172,
+145,145,145,145,145,145,145,145,145,145,145,145,133,251,110,133,146,146,146,
+146,146,146,146,146,146,146,146,146,172,131,127,127,133,133,133,133,135,135,
+133,133,1,97,1,221,254,158,1,98,135,135,135,135,133,133,133,133,127,252,239,
+151,1,137,1,137,151,240,2,254,123,147,244,240,149,254,4,236,117,119,238,254,
+56,137,78,4,6,78,138,109,62,45,251,180,59,104,5,215,121,69,64,70,69,64,69,
+70,63,70,70,63,70,69,64,70,69,64,69,70,92,92,70,69,64,69,70,64,69,70,63,70,
+70,63,70,69,64,69,70,64,69,121,246,45,67,62,74,63,66,73,64,65,74,66,63,74,
+57,72,24,1,247,1,205,45,254,6,254,7,26,72,57,74,63,66,74,65,64,73,66,63,74,
+62,1,0,253,206,2,50,254,168,254,118,253,211,1,88,254,168,168,3,191,168,45,
+66,111,111,66,251,98,88,37,37,88,51,0,0,2,0,184,255,236,4,242,5,215,0,77,
+0,89,0,0,37,17,35,21,7,23,21,7,23,21,7,23,21,5,39,55,39,53,55,39,53,55,39,
+53,55,39,53,55,33,38,53,52,54,51,50,22,21,20,7,33,23,21,7,23,21,7,23,21,7,
+23,21,7,23,7,37,53,55,39,53,55,39,53,55,39,53,35,17,22,22,21,20,6,35,34,38,
+53,52,54,18,54,53,52,38,35,34,6,21,20,22,51,2,162,166,133,133,133,133,135,
+135,254,227,39,166,145,145,145,145,145,145,145,41,1,80,68,122,89,89,124,70,
+1,80,41,145,145,145,145,145,145,145,166,39,254,227,135,135,133,133,133,133,
+166,35,47,77,56,56,75,45,132,65,66,45,45,64,62,47,233,3,21,66,43,45,73,43,
+45,74,45,43,74,127,84,80,43,70,49,43,69,49,43,70,49,43,70,18,60,98,90,123,
+124,89,97,61,18,70,43,49,70,43,49,69,43,49,70,43,80,84,127,74,43,45,74,45,
+43,73,45,43,66,252,235,15,65,42,55,76,76,55,42,65,3,188,64,44,45,66,65,46,
+45,63,0,0,9,0,102,255,131,7,63,6,70,0,72,0,84,0,96,0,108,0,120,0,125,0,130,
+0,135,0,140,0,0,0,22,21,20,6,7,21,33,23,6,7,51,54,54,51,50,22,21,20,6,35,
+34,38,39,35,22,23,7,33,21,22,22,21,20,6,35,34,38,53,52,54,55,53,33,39,54,
+54,55,35,6,6,35,34,38,53,52,54,51,50,22,23,51,38,39,55,33,53,38,38,53,52,
+54,51,18,54,53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,
+51,0,54,53,52,38,35,34,6,21,20,22,51,32,54,53,52,38,35,34,6,21,20,22,51,5,
+38,39,35,21,35,53,35,6,7,1,21,51,54,55,33,22,23,51,53,4,38,116,82,66,1,47,
+33,110,27,237,17,104,70,82,116,114,84,71,104,16,237,25,112,33,254,209,66,
+82,115,84,84,113,82,64,254,209,33,57,68,12,240,16,105,69,84,113,114,83,69,
+105,16,238,27,108,33,1,47,64,82,114,83,40,56,56,40,40,54,54,40,40,56,56,40,
+40,54,54,40,253,128,56,56,40,40,54,54,40,5,118,56,56,40,40,54,54,40,254,55,
+60,18,92,102,94,15,61,1,16,94,14,62,254,70,59,17,94,6,70,116,83,67,108,15,
+142,51,116,115,64,83,116,83,82,114,80,65,115,118,51,144,17,108,65,83,114,
+113,84,70,104,16,144,51,60,124,49,65,80,113,83,84,115,85,62,115,116,51,142,
+14,105,71,84,115,254,219,54,40,40,56,56,40,40,54,250,200,54,41,40,56,56,40,
+41,54,2,158,54,40,41,56,56,41,40,54,54,40,41,56,56,41,40,54,139,81,101,182,
+182,98,84,1,209,180,93,87,84,96,180,0,1,0,102,255,219,5,141,6,37,0,33,0,0,
+1,33,21,33,17,1,23,1,33,21,33,1,7,1,17,35,17,1,39,1,33,53,33,1,55,1,17,33,
+53,33,53,33,53,33,3,45,254,203,1,53,1,123,74,254,133,2,22,253,234,1,123,74,
+254,133,102,254,133,74,1,123,253,233,2,23,254,133,74,1,123,253,194,1,8,254,
+248,2,164,5,190,188,253,234,1,122,73,254,133,103,254,134,74,1,123,253,233,
+2,23,254,133,74,1,122,103,1,123,73,254,134,1,176,102,188,103,0,0,10,0,102,
+255,100,4,180,6,168,0,19,0,24,0,27,0,30,0,36,0,39,0,43,0,47,0,51,0,55,0,0,
+55,54,54,53,52,39,53,1,51,1,7,6,6,21,20,23,21,1,35,1,19,22,23,37,3,19,19,
+5,19,5,5,1,37,37,22,21,20,19,19,5,1,38,39,7,3,6,7,37,1,54,55,37,19,19,54,
+55,102,120,97,118,2,51,72,1,112,26,130,143,103,254,14,72,254,176,205,69,27,
+1,7,246,248,206,254,148,244,254,235,1,88,254,86,1,66,254,211,6,43,164,254,
+143,2,115,80,4,230,198,36,85,1,12,1,27,12,72,254,250,241,74,52,73,215,154,
+237,131,200,202,71,1,238,254,113,66,37,154,102,140,110,71,252,243,1,43,3,
+252,115,137,86,1,11,252,41,1,67,133,4,59,241,21,253,13,120,179,47,52,111,
+253,101,1,2,74,2,19,107,153,72,254,121,93,132,53,2,184,109,78,18,1,64,254,
+225,45,25,0,0,9,0,102,254,217,6,242,7,4,0,52,0,82,0,112,0,142,0,172,0,197,
+0,222,0,247,1,16,0,0,1,23,55,23,7,22,4,22,21,20,6,35,34,0,39,17,54,0,51,50,
+22,21,20,6,4,7,23,7,39,7,39,55,38,36,38,53,52,54,51,50,0,23,17,6,0,35,34,
+38,53,52,0,37,39,1,22,51,55,50,22,23,22,23,23,22,23,23,22,51,55,50,22,22,
+51,50,54,51,50,22,23,54,53,52,36,1,6,6,35,34,38,35,34,6,6,35,39,34,7,7,6,
+7,7,34,6,7,6,35,39,34,7,54,36,53,52,1,38,35,7,34,38,39,38,39,39,38,39,39,
+38,35,7,34,38,38,35,34,6,35,34,38,53,6,21,20,4,1,52,54,51,50,22,51,50,54,
+54,51,23,50,55,55,54,55,55,50,54,55,54,51,23,50,55,6,4,21,20,5,38,38,39,34,
+6,35,34,38,39,35,46,6,39,39,7,22,0,51,50,5,22,22,23,50,54,51,22,22,23,51,
+30,6,23,23,55,38,0,35,34,1,23,55,62,6,55,51,54,54,55,50,22,51,50,54,55,38,
+35,34,0,3,39,7,14,6,7,35,6,6,7,34,38,35,34,6,7,22,51,50,0,2,209,219,219,74,
+176,194,1,79,192,137,103,127,254,203,111,109,1,51,131,105,135,197,254,173,
+202,193,74,219,219,74,191,202,254,175,197,135,105,125,1,49,117,115,254,205,
+125,103,137,1,160,1,49,176,1,174,38,30,43,28,46,18,7,7,28,37,23,9,4,6,37,
+30,37,20,9,9,34,18,31,37,2,10,254,168,1,78,2,39,29,18,34,9,9,20,37,30,37,
+6,4,9,23,37,28,3,7,4,35,57,43,31,37,253,1,89,252,152,37,31,43,28,46,18,7,
+7,27,38,23,9,4,6,37,30,37,20,9,9,34,18,31,39,10,1,85,254,181,39,31,18,34,
+9,9,20,37,30,37,6,4,9,23,38,27,3,7,4,35,57,43,30,38,255,254,169,5,104,9,8,
+9,11,32,13,33,52,7,43,25,45,17,87,26,9,70,24,41,10,84,1,56,124,33,250,254,
+8,11,9,11,32,13,34,51,7,43,24,45,20,76,33,5,71,29,43,8,86,254,202,124,29,
+2,191,8,45,25,72,6,27,85,19,45,24,43,7,50,35,13,32,11,9,8,9,23,28,125,254,
+198,235,8,45,26,71,5,30,83,18,45,25,43,7,52,33,13,32,11,9,11,8,19,34,122,
+1,52,7,4,217,217,74,174,13,150,241,130,103,137,1,11,196,252,68,190,1,16,137,
+102,134,242,149,12,188,74,215,215,74,188,12,149,242,134,102,137,254,251,201,
+3,188,200,254,249,137,103,201,1,55,22,174,254,234,55,4,49,49,20,3,8,5,54,
+20,9,4,43,76,12,66,46,24,29,159,248,252,160,51,62,13,76,43,4,8,20,55,5,8,
+12,10,99,4,57,23,250,159,29,254,51,57,4,49,50,19,3,8,5,55,20,8,4,43,76,13,
+66,47,24,29,157,250,3,96,48,64,12,76,43,4,9,20,54,5,8,13,10,98,4,55,23,248,
+159,29,100,11,64,1,13,80,51,2,35,66,41,67,13,14,37,57,4,199,254,181,246,10,
+63,1,12,3,77,51,2,33,68,34,59,27,13,38,60,5,199,1,77,253,233,4,62,34,18,13,
+66,40,68,33,2,49,79,3,12,62,12,10,254,174,4,80,2,55,38,13,16,66,39,66,35,
+2,51,79,1,13,67,9,8,1,67,0,0,2,0,184,255,111,4,193,6,96,0,47,0,51,0,0,1,21,
+51,21,35,21,51,21,35,21,51,21,33,17,5,33,17,33,5,17,33,21,35,21,51,21,35,
+21,51,21,35,21,35,37,21,51,21,35,21,33,21,33,21,51,21,35,21,37,5,51,17,35,
+3,246,203,203,203,203,203,254,206,254,211,254,86,1,170,1,45,1,50,203,203,
+203,203,203,70,254,178,195,195,1,80,254,176,195,195,1,78,253,111,221,221,
+1,197,103,102,94,103,94,102,1,223,164,4,123,164,1,223,102,94,103,94,102,103,
+178,217,102,94,103,94,102,226,179,181,3,174,0,0,5,0,102,255,164,5,76,6,102,
+0,75,0,79,0,83,0,87,0,91,0,0,37,7,35,39,53,55,53,6,6,35,34,39,55,22,51,50,
+54,55,7,35,39,53,55,51,23,38,38,35,34,7,39,54,51,50,22,23,53,39,53,55,51,
+23,21,7,21,54,54,51,50,23,7,38,35,34,6,7,55,51,23,21,7,35,39,22,22,51,50,
+55,23,6,35,34,38,39,21,23,7,55,39,7,19,55,39,7,1,39,7,23,37,39,7,23,3,164,
+166,74,164,150,56,160,93,154,113,74,84,109,114,173,14,176,72,197,201,72,168,
+22,165,110,109,84,74,115,152,93,160,56,148,162,72,166,150,56,160,94,151,115,
+74,84,108,108,168,21,172,71,197,201,71,173,14,173,115,108,84,74,113,153,94,
+160,56,152,201,96,98,98,100,96,98,98,1,229,117,120,116,254,97,117,121,117,
+104,196,196,72,182,99,76,88,113,73,84,184,134,144,164,72,168,142,125,166,
+86,74,115,89,75,125,182,72,198,202,72,178,125,75,89,115,74,86,164,129,142,
+164,72,166,142,135,181,84,73,113,88,76,101,180,153,116,121,117,4,117,117,
+121,117,253,135,96,98,98,100,96,98,98,0,6,0,102,0,0,4,41,5,162,0,26,0,29,
+0,32,0,35,0,38,0,41,0,0,1,5,21,5,21,5,21,5,21,5,21,5,21,35,53,5,39,37,53,
+37,53,37,53,37,53,37,17,23,55,39,17,21,55,3,21,55,5,53,7,19,53,7,2,66,1,231,
+254,55,1,201,254,55,1,201,254,55,102,254,135,27,1,148,254,123,1,133,254,123,
+1,133,102,209,209,193,193,180,254,230,135,135,133,5,162,156,72,116,123,121,
+72,116,123,123,72,127,221,193,105,98,113,164,106,72,102,154,109,71,101,1,
+8,238,53,70,252,131,106,55,1,229,98,49,250,70,33,1,139,70,33,0,0,8,0,184,
+255,109,3,68,6,45,0,40,0,52,0,64,0,69,0,75,0,82,0,94,0,106,0,0,1,38,53,52,
+54,55,53,38,53,52,54,55,38,53,52,54,51,50,22,21,20,6,7,21,22,22,21,20,6,7,
+21,22,22,21,20,6,35,34,38,53,52,0,54,53,52,38,35,34,6,21,20,22,51,18,54,53,
+52,38,35,34,6,21,20,22,51,19,21,54,53,52,1,53,6,21,20,22,19,53,6,6,21,20,
+22,18,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,
+1,29,101,114,124,238,52,49,72,150,110,109,151,116,93,160,152,146,166,94,115,
+150,110,108,152,1,70,92,89,69,69,89,92,66,66,92,92,66,66,92,92,66,51,209,
+254,201,135,71,64,61,74,63,151,38,38,28,28,37,37,28,28,38,38,28,28,37,37,
+28,1,37,45,104,84,87,10,186,15,167,48,79,21,74,108,109,151,150,110,95,142,
+19,156,4,92,96,94,96,3,157,19,141,94,110,150,149,111,106,254,248,92,66,63,
+94,94,63,66,92,4,184,92,66,66,92,92,66,66,92,254,156,180,6,84,84,254,80,153,
+11,69,31,39,2,27,154,3,39,32,34,39,1,212,37,28,28,38,38,28,28,37,251,72,37,
+28,28,38,38,28,28,37,0,8,0,102,255,203,6,113,5,213,0,15,0,28,0,42,0,52,0,
+62,0,67,0,72,0,77,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,1,3,22,21,
+20,6,7,3,36,0,17,52,38,5,3,6,6,21,20,18,4,23,3,38,38,53,52,19,19,54,51,50,
+23,19,38,35,34,3,23,22,51,50,55,55,38,35,34,19,39,19,19,7,1,7,54,53,52,5,
+39,6,21,20,4,59,1,103,207,212,254,154,205,209,254,155,206,203,1,101,212,1,
+205,110,157,148,147,159,1,2,1,104,114,252,114,108,97,112,161,1,32,169,161,
+140,153,129,123,113,140,142,110,123,170,205,206,13,80,64,75,73,65,82,101,
+119,118,68,50,100,101,49,1,10,66,154,253,111,66,86,5,213,208,254,155,209,
+213,254,154,201,206,1,101,209,206,1,101,211,254,225,254,201,62,114,78,112,
+25,254,59,20,1,129,1,7,145,249,218,1,55,93,251,143,172,254,214,186,12,1,197,
+21,111,83,118,1,183,254,160,26,24,1,94,115,253,204,231,6,6,231,21,254,151,
+2,254,226,1,30,2,1,56,183,41,62,45,148,183,37,43,62,0,2,0,102,0,0,5,174,5,
+117,0,53,0,57,0,0,33,53,16,2,35,34,2,17,21,35,53,52,18,55,53,16,2,35,34,2,
+17,21,22,18,21,21,35,53,16,2,35,34,2,17,21,35,53,16,18,51,50,23,18,18,51,
+50,18,19,54,51,50,18,17,21,1,17,35,17,5,72,104,91,87,105,103,59,50,105,90,
+88,104,53,57,102,105,90,87,105,103,151,144,46,38,12,149,134,132,150,13,39,
+47,143,154,253,141,102,53,1,13,1,100,254,175,254,224,53,53,215,1,57,74,15,
+1,21,1,91,254,173,254,227,17,82,254,203,209,53,53,1,23,1,90,254,175,254,224,
+53,53,1,107,1,108,22,1,58,1,69,254,196,254,189,22,254,138,254,159,53,3,254,
+254,125,1,131,0,4,0,102,255,250,5,172,5,135,0,97,0,109,0,122,0,135,0,0,1,
+39,6,7,23,23,7,23,23,7,23,23,7,23,23,7,23,23,7,23,7,39,39,55,39,39,55,39,
+39,55,39,39,55,39,39,55,39,6,35,34,39,7,23,7,7,23,7,7,23,7,7,23,7,7,23,7,
+7,39,55,39,55,55,39,55,55,39,55,55,39,55,55,39,55,55,38,39,7,35,34,38,53,
+52,54,51,50,23,54,51,50,23,54,51,50,22,21,20,6,35,6,54,53,52,38,35,34,6,21,
+20,22,51,1,22,21,20,7,51,50,54,53,52,38,35,34,5,52,55,38,35,34,6,21,20,22,
+51,51,39,4,53,22,28,46,78,14,63,80,14,70,86,15,72,86,12,69,86,14,70,97,21,
+231,15,72,78,14,63,80,16,70,82,15,66,80,16,65,80,16,35,23,22,80,66,17,79,
+65,14,82,69,16,80,64,15,77,71,14,232,20,96,69,14,86,70,13,86,72,14,86,69,
+14,80,64,15,71,42,29,21,22,145,210,147,128,112,97,87,103,105,86,99,112,127,
+147,213,141,232,121,123,88,87,122,121,88,1,6,52,5,13,102,150,95,77,80,253,
+135,49,60,77,78,94,151,101,10,2,3,186,2,52,40,18,72,57,21,75,56,20,68,61,
+19,71,60,16,70,61,17,108,57,70,51,23,73,51,23,80,45,25,73,51,27,72,53,27,
+4,4,27,53,72,27,51,73,25,45,80,23,51,73,23,51,70,57,108,17,61,70,16,60,71,
+19,61,68,20,56,75,21,57,72,18,38,54,2,152,98,91,110,53,63,65,55,110,91,98,
+152,61,123,86,88,123,122,89,88,121,1,125,77,95,17,28,89,58,47,52,201,93,79,
+29,52,47,59,88,22,0,1,0,102,0,0,7,96,5,88,0,119,0,0,1,23,55,51,17,6,4,7,39,
+55,39,55,23,55,39,55,23,55,39,55,23,55,39,55,23,55,39,55,23,55,51,53,51,21,
+51,23,55,23,7,23,55,23,7,23,55,23,7,23,55,23,7,23,55,23,7,23,7,38,36,39,17,
+51,23,55,23,7,23,55,23,7,23,55,23,7,23,55,23,7,23,55,23,7,23,7,38,36,39,17,
+23,7,39,21,35,53,7,39,55,17,6,4,7,39,55,39,55,23,55,39,55,23,55,39,55,23,
+55,39,55,23,55,39,3,100,27,25,26,203,254,135,210,54,78,74,87,75,62,76,94,
+76,57,63,96,68,59,47,98,47,54,25,100,27,25,26,103,24,25,28,101,25,51,50,98,
+49,59,70,96,66,58,78,94,78,61,78,86,76,74,53,209,254,138,201,24,25,28,101,
+25,51,50,98,49,59,70,96,66,58,78,94,78,61,78,86,76,74,53,208,254,144,208,
+213,70,143,103,143,70,213,210,254,141,209,54,78,74,87,75,62,76,94,76,57,63,
+96,68,59,47,98,47,54,25,3,156,217,2,1,82,5,111,130,86,47,121,53,127,31,145,
+49,155,20,176,35,180,12,199,22,202,6,213,12,217,2,219,219,2,217,12,213,6,
+202,22,199,14,182,35,176,22,157,49,147,31,129,53,123,45,86,129,112,5,254,
+174,2,217,13,213,6,203,23,198,15,183,35,176,23,158,49,148,30,129,54,122,46,
+86,128,113,5,254,234,197,74,133,190,190,133,74,197,1,22,5,111,130,86,48,120,
+54,127,30,146,49,156,21,176,35,180,12,198,23,203,6,213,0,6,0,102,255,139,
+4,252,6,59,0,44,0,48,0,54,0,58,0,62,0,66,0,0,1,33,17,51,21,35,21,51,21,33,
+17,54,54,53,52,38,35,34,6,21,20,22,23,17,33,53,51,53,35,53,51,17,33,39,19,
+3,55,33,19,51,19,33,23,3,19,1,22,23,55,37,7,54,51,50,23,1,6,7,51,1,54,55,
+35,19,38,39,7,4,219,254,184,181,181,181,254,229,77,91,170,123,118,173,96,
+74,254,230,180,180,180,254,182,33,177,177,31,1,92,172,70,170,1,96,31,176,
+176,254,221,48,26,71,254,70,70,34,36,34,38,1,45,25,45,139,252,213,26,46,139,
+131,42,24,69,2,68,254,135,103,114,103,3,31,29,138,87,121,172,172,121,89,146,
+19,252,225,103,114,103,1,121,53,1,49,1,49,55,1,41,254,215,53,254,205,254,
+205,2,53,54,71,125,252,123,6,6,253,246,67,54,1,137,69,52,253,254,50,69,119,
+0,1,0,102,255,236,6,49,5,190,0,80,0,0,37,54,54,53,52,38,35,34,6,21,17,35,
+17,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,23,17,52,38,35,34,6,21,
+20,22,23,7,38,38,53,52,54,51,50,23,53,51,21,54,54,51,50,22,21,20,6,7,39,54,
+54,53,52,38,35,34,6,21,17,54,51,50,22,21,20,6,7,4,225,48,59,121,86,108,146,
+102,145,109,86,121,58,48,45,73,91,181,129,171,83,184,140,108,156,67,60,56,
+83,91,213,154,211,113,102,48,166,110,151,215,90,84,55,60,67,156,108,140,184,
+90,164,128,181,91,73,225,25,93,60,85,118,163,113,254,162,1,94,112,164,117,
+86,60,93,25,90,37,143,88,128,178,125,1,135,143,213,154,112,69,121,37,86,49,
+165,99,154,215,172,208,208,77,95,216,153,99,165,49,86,37,121,69,112,154,211,
+145,254,121,125,178,128,91,140,37,0,10,0,102,255,176,5,63,6,68,0,7,0,11,0,
+15,0,19,0,23,0,27,0,39,0,51,0,63,0,75,0,0,1,1,35,1,53,1,51,9,2,33,7,7,39,
+33,1,3,55,17,1,37,23,33,1,3,55,39,7,6,22,21,20,6,35,34,38,53,52,54,51,0,22,
+21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,0,22,21,20,
+6,35,34,38,53,52,54,51,5,63,253,185,72,253,182,2,74,72,2,71,253,199,1,176,
+254,228,148,102,150,254,234,1,172,150,150,254,80,2,22,148,1,30,254,78,51,
+113,113,111,63,41,41,29,29,38,38,29,1,166,41,41,29,29,38,38,29,254,148,41,
+41,29,29,38,38,29,1,166,41,41,29,29,38,38,29,2,213,252,219,3,39,72,3,37,252,
+217,253,88,2,80,211,4,215,253,176,2,182,213,1,127,253,172,213,213,2,84,252,
+213,164,164,162,191,40,29,29,39,39,29,29,40,1,248,40,29,29,39,39,29,29,40,
+40,29,29,39,39,29,29,40,254,8,40,29,29,39,39,29,29,40,0,0,6,0,102,255,219,
+5,119,5,205,0,51,0,97,0,104,0,111,0,118,0,125,0,0,37,6,6,35,34,38,53,52,54,
+55,54,53,52,39,38,38,53,52,54,51,50,22,23,22,51,50,55,54,54,51,50,22,21,20,
+6,7,6,21,20,23,22,22,21,20,6,35,34,38,39,38,35,34,55,35,7,54,51,50,23,38,
+39,35,53,51,39,35,53,51,53,35,53,51,55,35,53,51,54,54,55,6,35,34,39,22,23,
+51,21,35,23,51,21,35,21,51,21,35,7,51,1,22,51,50,53,52,38,37,6,6,21,20,51,
+50,1,54,53,52,35,34,6,5,38,38,35,34,21,20,1,225,46,111,76,71,75,137,154,39,
+39,155,136,72,72,76,112,47,120,147,152,120,47,113,77,69,73,133,158,39,39,
+157,134,74,72,75,112,46,120,152,147,56,139,20,97,153,159,97,5,14,141,129,
+2,127,123,123,127,4,131,143,5,7,7,100,158,153,97,12,6,141,131,2,129,122,122,
+127,4,131,1,224,50,66,43,84,252,177,76,84,43,62,3,57,161,39,35,63,252,230,
+23,63,35,39,248,151,134,78,63,82,112,40,181,214,196,181,41,112,80,63,79,131,
+154,18,18,154,131,79,63,80,110,43,174,203,214,181,42,111,81,63,78,134,151,
+18,193,107,17,17,22,85,102,41,103,40,103,41,102,25,57,23,17,17,55,50,102,
+41,103,40,103,41,254,174,157,38,36,62,21,21,62,36,38,4,135,44,74,39,85,72,
+72,85,39,74,0,4,0,184,255,236,6,250,5,203,0,22,0,28,0,53,0,65,0,0,5,17,35,
+17,33,17,33,17,51,54,54,51,50,22,21,20,6,35,34,38,39,35,17,1,51,53,33,17,
+33,39,39,53,55,39,53,55,39,53,55,39,53,55,23,7,23,21,7,23,21,7,23,21,7,23,
+0,54,53,52,38,35,34,6,21,20,22,51,4,143,149,252,190,4,62,127,15,108,69,82,
+115,114,83,65,100,19,135,254,157,252,252,144,2,116,245,189,115,115,117,117,
+117,117,193,61,131,117,117,117,117,117,117,131,3,125,55,56,38,38,54,53,39,
+20,4,88,251,168,5,223,254,223,72,86,116,81,80,114,72,59,251,168,4,190,186,
+250,238,78,149,72,88,90,72,92,92,72,92,92,70,151,82,104,90,72,92,90,72,92,
+94,72,90,104,3,57,54,38,38,56,55,39,39,53,0,10,0,102,0,0,6,182,5,139,0,39,
+0,45,0,51,0,57,0,63,0,67,0,72,0,77,0,80,0,92,0,0,1,6,4,7,1,7,39,35,21,35,
+53,35,21,35,53,35,21,35,53,35,7,39,1,36,1,19,22,23,38,53,52,54,51,50,22,21,
+20,7,54,55,1,34,39,3,33,3,55,54,55,39,6,7,5,22,23,55,38,39,5,54,55,39,6,7,
+5,23,55,39,1,54,55,39,7,5,22,23,55,39,1,51,39,54,54,53,52,38,35,34,6,21,20,
+22,51,6,182,138,254,219,177,1,57,94,98,76,102,92,103,92,102,78,99,94,1,58,
+254,169,254,250,254,196,251,47,88,65,64,90,47,255,189,253,217,63,31,180,2,
+35,181,64,66,65,76,45,88,254,146,65,66,77,88,45,3,19,46,40,113,43,33,251,
+148,88,102,78,3,164,63,40,105,71,252,229,49,51,76,74,1,80,92,45,22,30,30,
+22,21,30,30,21,3,254,136,156,32,253,115,45,205,205,205,205,205,205,205,205,
+45,2,141,62,1,6,1,25,207,35,62,89,86,121,119,88,86,65,38,204,253,145,4,254,
+135,1,121,111,10,18,156,13,10,133,18,10,161,10,13,21,34,36,125,36,23,66,70,
+136,59,254,215,27,22,137,32,105,27,22,154,32,254,252,99,227,61,43,44,61,61,
+44,43,61,0,1,0,102,255,143,6,166,6,8,0,75,0,0,0,22,21,20,7,22,22,23,54,51,
+50,22,21,20,6,35,34,39,6,7,22,21,20,6,7,39,54,54,53,52,39,53,54,54,53,52,
+38,35,34,6,21,20,22,23,21,6,21,20,22,23,7,38,38,53,52,55,38,39,6,35,34,38,
+53,52,54,51,50,23,54,54,55,38,53,52,54,51,3,225,121,49,101,153,37,60,75,90,
+121,121,90,75,60,55,154,55,88,78,45,50,59,78,116,144,224,155,155,224,143,
+117,77,57,51,45,78,88,55,152,58,60,78,90,119,121,88,78,60,37,151,104,47,120,
+89,6,8,121,90,75,60,36,151,106,49,121,90,87,121,47,160,92,74,100,88,143,38,
+95,23,92,59,97,64,72,33,199,124,159,220,224,155,123,199,34,72,63,98,59,92,
+23,95,37,145,87,98,78,91,161,49,124,84,88,123,49,105,151,37,63,72,89,122,
+0,0,6,0,102,255,236,5,193,5,78,0,47,0,51,0,64,0,77,0,90,0,103,0,0,1,33,53,
+52,54,51,50,22,21,20,6,35,35,17,51,50,22,21,20,6,35,34,38,53,53,33,21,20,
+6,35,34,38,53,52,54,51,51,17,35,34,38,53,52,54,51,50,22,21,3,33,17,33,7,51,
+53,51,53,52,38,35,34,6,21,20,22,33,51,50,54,53,52,38,35,34,6,21,21,51,3,21,
+20,22,51,50,54,53,52,38,35,35,21,37,35,34,6,21,20,22,51,50,54,53,53,35,2,
+109,1,77,153,107,106,153,151,108,6,6,107,152,154,105,106,154,254,179,153,
+108,106,152,150,108,7,7,108,150,151,107,108,153,152,2,125,253,131,109,7,151,
+92,66,64,91,92,3,143,6,64,92,91,65,65,92,151,151,93,64,65,91,90,66,6,252,
+183,7,65,90,90,65,65,93,151,4,66,8,107,153,151,109,108,150,254,170,150,108,
+111,149,151,109,8,8,109,151,150,110,108,150,1,86,150,108,108,152,153,107,
+253,20,2,125,45,148,8,64,93,92,65,66,90,92,64,63,94,93,64,8,252,182,8,65,
+93,95,63,63,92,147,147,89,66,65,93,93,65,8,0,26,0,102,255,4,8,133,6,170,0,
+29,0,39,0,48,0,56,0,60,0,72,0,84,0,96,0,108,0,120,0,132,0,144,0,156,0,168,
+0,180,0,192,0,204,0,216,0,228,0,240,0,252,1,8,1,20,1,32,1,44,1,56,0,0,1,6,
+7,5,35,17,51,23,4,51,51,50,37,55,51,17,35,37,38,39,21,20,18,19,21,33,53,18,
+18,53,1,2,2,53,17,35,17,20,2,3,1,54,36,55,17,38,38,39,39,33,7,4,7,17,22,5,
+23,37,51,53,35,22,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,
+53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,38,22,21,20,6,35,34,38,53,
+52,54,51,4,22,21,20,6,35,34,38,53,52,54,51,4,22,21,20,6,35,34,38,53,52,54,
+51,36,22,21,20,6,35,34,38,53,52,54,51,4,38,53,52,54,51,50,22,21,20,6,35,32,
+38,53,52,54,51,50,22,21,20,6,35,54,38,53,52,54,51,50,22,21,20,6,35,4,38,53,
+52,54,51,50,22,21,20,6,35,6,38,53,52,54,51,50,22,21,20,6,35,4,38,53,52,54,
+51,50,22,21,20,6,35,0,6,35,34,38,53,52,54,51,50,22,21,52,6,35,34,38,53,52,
+54,51,50,22,21,2,54,51,50,22,21,20,6,35,34,38,53,16,54,51,50,22,21,20,6,35,
+34,38,53,6,54,51,50,22,21,20,6,35,34,38,53,18,54,51,50,22,21,20,6,35,34,38,
+53,54,54,51,50,22,21,20,6,35,34,38,53,18,54,51,50,22,21,20,6,35,34,38,53,
+3,160,191,187,254,136,72,72,142,2,84,171,113,184,2,76,141,72,72,254,138,187,
+192,74,114,252,228,93,87,1,243,107,67,223,80,88,253,111,129,1,179,159,84,
+242,207,190,7,82,174,254,167,204,216,1,79,172,251,231,223,223,132,30,30,21,
+22,29,29,22,254,206,29,29,22,22,29,29,22,254,188,29,29,22,22,29,29,22,122,
+30,30,21,22,30,30,22,1,81,29,29,22,22,29,29,22,254,218,30,30,21,22,30,30,
+22,1,81,29,29,22,22,29,29,22,3,40,30,30,21,22,30,30,22,1,69,30,30,22,21,30,
+30,21,121,29,29,22,22,29,29,22,254,175,30,30,21,22,30,30,22,21,30,30,21,22,
+30,30,22,1,38,29,29,22,22,29,29,22,253,6,29,22,22,29,29,22,22,29,29,22,22,
+29,29,22,22,29,102,29,22,22,29,29,22,22,29,29,22,22,29,29,22,22,29,121,29,
+22,22,29,29,22,22,29,45,29,22,22,29,29,22,22,29,151,30,22,21,30,30,21,22,
+30,45,30,22,21,30,30,21,22,30,4,45,29,43,86,3,27,32,140,140,32,252,229,86,
+43,29,248,175,254,93,254,103,70,72,1,55,1,228,206,252,53,1,148,1,141,170,
+1,6,254,250,216,254,45,254,224,4,152,25,101,24,1,12,8,49,49,41,39,81,27,254,
+242,27,82,41,162,246,70,30,21,22,29,29,22,21,30,30,21,22,29,29,22,21,30,30,
+21,22,29,29,22,21,30,121,30,21,22,30,30,22,21,30,45,30,22,21,30,30,21,22,
+30,197,29,22,22,29,29,22,22,29,45,29,22,22,29,29,22,22,29,26,29,22,21,30,
+30,21,22,29,29,22,21,30,30,21,22,29,120,30,22,21,30,30,21,22,30,45,30,21,
+22,30,30,22,21,30,151,29,22,22,29,29,22,22,29,45,29,22,22,29,29,22,22,29,
+254,72,29,29,22,22,29,29,22,216,30,30,21,22,30,30,22,254,59,30,30,22,21,30,
+30,21,254,165,30,30,21,22,30,30,22,122,30,30,22,21,30,30,21,1,81,30,30,21,
+22,29,29,22,21,30,30,21,22,29,29,22,254,218,30,30,22,21,30,30,21,0,1,0,102,
+255,223,5,244,5,188,0,41,0,0,1,23,39,55,19,23,55,19,23,7,55,23,5,7,17,37,
+19,23,7,23,7,37,1,21,23,7,39,7,39,55,53,1,5,39,55,39,55,19,5,17,39,37,1,55,
+224,33,102,37,172,170,39,102,32,223,12,254,242,193,1,68,104,94,86,224,13,
+254,240,254,137,178,77,152,151,78,178,254,135,254,242,13,224,86,94,102,1,
+70,195,254,244,4,225,26,233,12,254,234,170,170,1,22,12,233,26,102,31,192,
+254,190,225,1,7,37,217,29,102,34,254,248,223,219,66,189,189,66,219,223,1,
+8,34,102,29,217,37,254,249,225,1,66,192,31,0,2,0,184,0,0,3,141,3,158,0,3,
+0,7,0,0,1,17,35,17,1,17,51,17,1,31,103,2,111,102,3,158,252,98,3,158,252,98,
+3,158,252,98,0,3,0,102,255,236,4,217,5,229,0,27,0,30,0,33,0,0,19,51,17,35,
+53,51,17,51,17,33,17,51,17,51,21,35,17,51,21,35,17,35,17,33,17,35,17,35,1,
+19,33,17,33,3,102,215,215,215,103,1,248,102,215,215,215,215,102,254,8,103,
+215,2,56,254,254,8,1,248,254,1,82,3,45,102,1,0,255,0,1,0,255,0,102,252,211,
+102,255,0,1,0,255,0,1,0,2,26,1,121,252,211,1,121,0,3,0,102,255,47,3,51,6,
+141,0,32,0,45,0,58,0,0,36,6,7,21,33,21,33,53,38,38,53,52,54,54,38,53,52,54,
+55,53,33,53,33,21,22,22,21,20,6,21,20,22,21,2,38,39,17,54,54,53,52,38,53,
+52,54,53,1,17,6,6,21,20,22,21,20,6,21,20,22,3,14,150,120,1,51,254,103,119,
+152,73,3,76,151,120,254,204,1,154,121,149,73,73,102,92,76,76,92,74,74,254,
+242,77,91,73,73,91,240,223,21,102,103,205,20,222,161,105,174,95,201,99,157,
+222,23,100,102,202,23,223,156,102,185,57,51,175,104,3,14,164,25,251,10,25,
+167,107,89,179,62,70,183,91,252,51,4,246,26,162,109,89,184,71,65,176,89,110,
+163,0,0,16,0,102,0,0,9,59,4,180,0,9,0,13,0,17,0,21,0,25,0,29,0,33,0,37,0,
+41,0,45,0,49,0,53,0,57,0,61,0,65,0,69,0,0,9,3,17,33,17,9,3,7,23,55,37,55,
+39,7,39,55,39,7,5,23,55,39,1,23,55,39,5,33,53,33,1,53,33,21,1,55,39,7,37,
+23,55,39,55,23,55,39,1,33,53,33,17,33,53,33,37,55,35,7,33,51,39,35,5,51,55,
+35,6,186,2,129,254,170,253,226,254,18,253,227,254,170,2,129,5,121,202,75,
+203,254,14,201,74,202,74,203,74,205,252,68,200,76,201,254,142,203,73,200,
+2,253,1,33,254,223,1,33,254,223,3,13,203,74,203,250,135,203,74,201,219,203,
+74,201,1,67,1,33,254,223,1,33,254,223,1,62,172,166,49,254,205,43,51,162,1,
+63,51,50,152,4,180,253,148,254,155,2,17,253,12,2,240,253,243,1,101,2,108,
+253,215,209,71,209,75,211,72,209,72,209,71,207,8,209,74,207,254,154,209,73,
+207,137,104,253,252,105,105,1,156,209,72,209,137,209,72,209,215,209,71,209,
+252,252,103,1,53,102,103,176,176,176,176,176,0,1,0,102,255,135,6,86,6,100,
+0,29,0,0,19,22,5,19,17,3,4,7,39,54,36,51,50,4,23,7,38,37,3,17,19,36,55,23,
+6,4,35,34,36,39,176,193,1,22,166,166,254,231,190,74,150,1,140,216,215,1,140,
+147,74,194,254,237,164,164,1,16,197,74,146,254,117,217,218,254,116,148,1,
+16,203,63,1,31,3,162,1,30,66,200,70,156,167,165,154,70,200,62,254,226,252,
+94,254,223,61,203,69,152,168,169,155,0,0,3,0,102,255,236,6,156,5,0,0,60,0,
+70,0,81,0,0,37,39,7,39,19,51,23,55,51,23,54,55,38,53,52,39,6,35,34,38,53,
+52,54,51,50,23,54,55,23,55,51,23,55,23,3,35,39,7,35,39,6,7,22,21,20,23,54,
+51,50,22,21,20,6,35,34,38,39,6,7,39,7,1,38,35,34,6,21,20,22,51,50,19,22,22,
+51,50,54,53,52,38,35,34,1,172,127,108,91,158,72,125,92,72,116,78,51,20,15,
+64,45,126,152,123,84,186,70,88,78,123,98,72,127,109,90,158,72,125,92,71,117,
+66,63,20,15,62,60,119,146,124,85,98,122,32,90,78,123,98,1,57,46,116,46,58,
+91,71,45,227,24,77,59,46,60,85,64,51,53,223,243,45,1,102,225,215,180,58,28,
+115,200,131,107,23,124,108,72,114,246,51,78,176,219,223,244,45,254,153,226,
+215,180,52,34,131,150,171,101,22,127,104,72,114,122,123,51,78,176,219,3,166,
+191,56,41,52,64,253,73,95,93,54,42,49,68,0,0,7,0,102,255,164,5,246,6,70,0,
+18,0,23,0,28,0,33,0,38,0,41,0,44,0,0,5,1,53,33,17,33,54,18,36,51,50,4,18,
+23,33,17,33,21,1,19,38,39,17,51,1,6,7,17,51,33,38,38,39,17,33,17,6,6,7,1,
+17,33,33,17,1,3,8,254,55,1,187,253,108,12,199,1,66,178,181,1,67,197,12,253,
+106,1,189,254,51,223,99,108,207,254,203,108,99,207,2,131,25,120,86,253,47,
+87,118,25,2,27,254,248,1,110,1,8,92,1,203,71,1,232,185,1,59,180,182,254,198,
+184,254,24,71,254,53,6,0,47,10,254,39,1,217,10,47,254,96,106,183,65,254,158,
+1,98,65,183,106,252,68,1,8,254,246,1,10,0,0,10,0,102,255,74,7,172,6,143,0,
+47,0,58,0,63,0,67,0,71,0,76,0,86,0,96,0,106,0,116,0,0,1,6,35,34,38,53,52,
+54,51,50,23,17,33,38,53,52,54,51,50,22,21,20,7,33,17,54,51,50,22,21,20,6,
+35,34,39,17,33,22,21,20,6,35,34,38,53,52,55,33,37,54,54,55,38,38,39,6,6,7,
+22,37,54,54,55,33,17,33,38,39,1,17,6,7,17,22,22,23,17,19,22,51,50,54,53,52,
+38,35,34,1,6,21,20,22,51,50,54,53,52,1,38,35,34,6,21,20,22,51,50,1,54,53,
+52,38,35,34,6,21,20,1,223,109,94,81,93,94,80,82,121,1,185,66,90,78,75,87,
+68,1,182,142,94,80,94,95,79,108,128,254,72,70,87,75,80,88,68,254,69,2,25,
+73,202,106,83,216,80,81,208,86,214,254,237,85,189,74,254,164,1,90,147,199,
+3,102,200,148,78,201,69,137,114,87,34,38,41,31,79,253,75,62,36,30,28,31,253,
+148,114,71,30,41,39,32,75,2,155,63,31,28,31,35,2,133,55,90,78,73,89,64,1,
+178,126,89,81,93,95,79,90,125,254,72,70,89,73,80,88,67,254,70,135,88,80,94,
+95,79,91,132,156,104,200,77,57,210,114,113,206,64,161,245,64,190,100,252,
+153,199,152,254,161,1,91,144,203,3,103,106,191,51,1,92,254,78,62,36,30,28,
+31,253,131,115,73,34,38,41,31,75,2,173,65,31,28,31,35,2,117,115,69,31,41,
+39,33,75,0,3,0,102,255,121,6,250,6,154,0,55,0,58,0,70,0,0,1,5,21,33,17,35,
+17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,1,7,1,1,39,1,17,
+35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,33,17,51,5,5,
+37,37,22,22,21,20,6,35,34,38,53,52,54,51,6,31,253,196,3,23,103,55,102,56,
+102,57,103,55,102,56,1,86,82,254,201,254,201,82,1,86,55,103,57,103,55,102,
+56,102,55,103,3,23,72,2,90,253,196,1,117,254,139,112,30,30,22,21,30,30,21,
+5,156,201,129,253,221,1,189,254,139,1,117,254,139,1,117,254,139,1,117,254,
+139,1,117,253,145,254,57,61,1,158,254,98,61,1,199,2,111,254,139,1,117,254,
+139,1,117,254,139,1,117,254,139,1,117,254,71,2,31,2,72,183,164,123,107,62,
+29,22,21,30,30,21,22,29,0,0,1,0,102,255,100,5,49,6,55,0,57,0,0,19,33,39,55,
+1,33,38,39,39,38,53,52,54,53,52,39,39,55,30,2,21,20,6,6,21,20,22,22,21,20,
+6,6,21,20,22,22,21,20,6,6,7,39,55,54,53,52,38,38,53,52,54,55,33,1,39,55,33,
+102,1,11,215,73,1,29,2,172,9,15,61,56,172,96,107,61,91,92,61,62,110,77,75,
+55,97,112,60,51,79,114,61,107,96,113,59,129,14,253,82,254,227,73,217,254,
+243,3,10,223,70,254,219,22,19,80,72,69,79,157,41,51,67,76,80,60,68,92,54,
+50,90,101,36,37,94,114,70,59,116,114,41,36,101,89,50,49,85,66,75,80,77,66,
+52,37,104,86,49,73,160,48,254,217,70,225,0,7,0,184,255,236,5,23,5,190,0,3,
+0,7,0,21,0,35,0,49,0,63,0,77,0,0,19,33,17,33,55,33,17,33,1,38,38,35,34,6,
+7,39,54,54,51,50,22,23,3,38,38,35,34,6,7,39,54,54,51,50,22,23,3,38,38,35,
+34,6,7,39,54,54,51,50,22,23,3,38,38,35,34,6,7,39,54,54,51,50,22,23,3,38,38,
+35,34,6,7,39,54,54,51,50,22,23,184,4,95,251,161,103,3,145,252,111,2,219,47,
+143,85,85,142,45,82,60,185,109,112,185,60,82,47,143,85,85,142,45,82,63,186,
+105,112,185,60,82,47,143,85,85,142,45,82,63,186,105,112,185,60,82,47,143,
+85,85,142,45,82,60,185,109,112,185,60,82,47,143,85,85,142,45,82,60,185,109,
+112,185,60,5,190,250,46,102,5,6,254,170,65,76,76,63,57,85,100,99,84,254,246,
+65,77,77,63,58,88,96,99,83,254,245,65,77,77,63,58,88,96,99,83,254,246,65,
+76,76,63,57,85,99,98,84,254,246,65,76,76,63,57,85,100,99,84,0,0,3,0,102,255,
+229,4,84,5,240,0,11,0,15,0,19,0,0,19,5,37,23,1,1,7,37,5,39,9,3,37,5,1,1,5,
+37,141,1,205,1,205,45,254,68,1,188,45,254,51,254,51,39,1,187,254,69,1,246,
+254,193,1,61,1,64,254,194,1,62,254,192,254,195,5,240,172,170,54,253,52,253,
+49,54,170,172,56,2,204,2,207,252,209,253,254,117,117,2,195,2,4,117,117,0,
+0,2,0,102,255,190,3,197,5,225,0,26,0,52,0,0,0,22,21,20,6,7,23,21,7,23,21,
+7,23,7,37,53,55,39,53,55,39,38,38,53,52,54,51,3,53,55,39,53,55,39,55,5,21,
+7,23,21,7,23,54,54,53,52,38,35,34,6,21,20,22,2,199,254,175,139,49,165,165,
+165,184,57,255,0,165,165,163,82,168,217,254,176,126,151,151,151,176,49,1,
+14,151,151,149,2,135,174,193,137,136,191,111,5,225,254,178,146,229,39,32,
+72,117,110,72,109,127,86,181,71,107,108,72,117,55,18,243,167,180,252,253,
+33,2,86,90,72,86,100,90,155,72,86,80,72,83,3,12,188,128,134,196,195,135,102,
+165,0,0,11,0,102,255,158,7,14,6,70,0,14,0,26,0,52,0,79,0,106,0,133,0,160,
+0,185,0,212,0,234,0,246,0,0,1,20,2,4,35,34,36,2,53,16,0,33,50,4,18,5,52,38,
+35,34,6,21,20,22,51,50,54,1,38,2,53,52,54,51,54,54,55,38,38,35,34,6,6,21,
+20,30,4,23,22,23,1,54,36,51,50,22,21,20,7,22,22,23,54,54,53,52,38,35,34,14,
+6,7,1,54,54,51,50,4,21,20,6,7,22,22,23,54,54,53,52,46,4,35,34,7,6,7,3,38,
+38,53,52,18,51,50,22,23,54,54,55,38,38,35,34,14,4,21,20,23,22,23,1,22,22,
+21,20,2,35,38,38,39,6,6,7,22,22,51,50,62,5,53,52,38,39,1,22,18,21,20,6,35,
+34,39,6,6,7,22,22,51,50,54,53,52,46,4,39,19,6,6,35,34,36,53,53,52,54,55,38,
+39,6,6,21,21,20,30,4,51,50,54,55,1,6,4,35,34,38,39,38,39,6,6,21,22,22,51,
+50,62,4,55,37,20,6,35,34,38,53,52,54,51,50,22,7,14,225,254,118,233,233,254,
+120,227,1,238,1,102,235,1,137,224,253,105,110,79,79,109,109,79,80,109,254,
+139,145,176,122,101,3,16,26,16,38,20,54,124,84,34,67,74,18,82,50,26,36,253,
+242,72,1,15,154,111,160,2,34,48,26,16,23,228,155,46,80,89,94,122,8,49,33,
+15,1,61,60,111,52,197,1,31,28,38,15,24,6,66,69,37,72,102,145,176,63,32,93,
+54,49,219,23,14,218,130,56,65,27,24,53,31,3,87,82,65,125,115,92,65,32,39,
+23,31,4,229,22,17,219,129,52,64,34,23,54,29,2,92,84,57,104,101,86,68,46,21,
+61,31,254,66,160,180,125,88,17,8,2,15,24,16,40,28,90,170,27,51,94,12,108,
+113,221,51,107,50,198,254,226,22,35,38,15,57,64,41,80,115,136,175,33,33,123,
+77,1,59,61,254,227,150,123,145,2,64,48,14,19,2,236,151,64,120,117,104,25,
+71,27,253,105,38,28,27,38,38,27,28,38,2,242,235,254,117,222,221,1,138,237,
+1,102,1,238,224,254,119,235,79,109,109,79,79,110,109,253,129,73,1,30,134,
+125,158,28,50,35,14,16,94,180,115,65,140,135,98,20,43,15,9,9,3,162,148,167,
+124,91,15,8,6,18,19,17,42,23,96,170,10,26,44,78,13,78,79,52,1,163,20,17,218,
+130,51,69,31,23,54,28,2,87,83,62,117,108,89,75,39,38,22,31,251,234,66,113,
+54,197,1,31,32,30,16,22,5,65,68,41,81,118,141,170,44,47,86,53,50,3,51,59,
+117,49,198,254,227,2,24,37,17,22,6,65,70,30,61,88,114,126,144,34,41,147,44,
+1,56,76,254,231,147,116,159,2,22,49,37,14,25,232,155,68,120,119,135,7,61,
+31,250,184,20,17,215,123,11,37,64,35,50,61,8,88,73,9,64,118,111,89,63,32,
+48,44,1,201,155,189,121,108,9,32,16,46,20,100,158,28,51,73,28,137,97,174,
+28,38,38,28,28,37,37,0,12,0,102,0,0,6,150,4,172,0,18,0,22,0,26,0,30,0,34,
+0,38,0,42,0,46,0,50,0,56,0,60,0,64,0,0,19,33,21,33,22,0,19,33,52,2,35,34,
+2,21,33,16,18,55,33,1,3,6,7,1,37,38,39,3,19,6,7,1,5,38,39,1,37,3,6,1,33,38,
+39,5,54,55,7,33,39,22,23,1,7,54,51,50,23,37,7,22,23,37,23,54,55,109,6,34,
+254,33,226,1,0,4,253,210,128,105,102,131,253,208,244,223,254,52,1,118,245,
+29,4,3,80,1,10,161,206,217,101,212,155,3,8,1,23,54,86,251,160,1,25,142,86,
+3,218,1,24,6,27,252,39,8,35,250,4,48,250,34,11,254,180,68,38,32,34,32,1,18,
+178,49,29,253,186,100,36,42,4,172,102,119,253,184,254,121,253,1,73,254,182,
+252,1,123,2,64,139,252,32,1,0,131,125,2,109,147,195,25,254,145,1,111,28,190,
+254,138,29,181,130,254,201,29,1,24,136,253,228,126,132,194,116,109,14,14,
+117,104,2,215,225,12,12,37,97,53,59,209,207,68,42,0,0,1,0,102,0,0,4,18,6,
+31,0,38,0,0,55,19,3,53,33,21,3,37,53,16,0,35,34,6,21,20,22,51,50,55,23,6,
+35,34,38,53,52,54,51,50,4,18,21,17,35,37,19,21,33,125,192,190,2,29,150,1,
+166,254,247,206,128,136,82,71,41,17,41,40,50,122,143,198,169,164,1,8,145,
+71,254,61,148,253,225,68,1,135,1,131,72,72,254,215,168,67,1,37,1,131,98,78,
+67,74,8,94,17,130,114,129,150,203,254,151,219,253,168,183,254,217,72,0,0,
+6,0,102,255,211,6,94,5,203,0,39,0,51,0,63,0,75,0,87,0,99,0,0,19,51,54,55,
+39,55,23,54,55,53,51,21,22,23,55,23,7,22,23,51,21,35,6,7,23,7,39,6,7,21,35,
+53,38,39,7,39,55,38,39,35,5,7,22,23,53,38,38,39,35,22,23,55,1,55,38,39,21,
+22,22,23,51,38,39,7,37,6,7,51,54,54,55,53,6,7,23,7,1,23,54,55,35,6,6,7,21,
+54,55,39,38,54,53,52,38,35,34,6,21,20,22,51,102,203,16,111,143,73,144,136,
+173,103,175,132,145,74,146,113,16,203,203,16,113,146,74,145,132,175,103,172,
+137,144,73,143,111,16,203,2,29,63,105,130,63,93,16,235,16,82,63,2,6,64,104,
+129,65,90,14,236,16,82,64,253,113,82,16,235,16,93,63,129,106,65,74,2,78,64,
+82,16,236,14,92,63,130,103,64,169,73,73,52,51,74,76,49,3,2,175,132,146,73,
+145,113,16,203,203,16,113,145,73,146,132,175,102,174,136,143,74,144,111,16,
+203,203,16,111,144,74,143,136,174,246,64,82,16,236,15,94,63,131,105,64,2,
+6,63,83,16,236,15,93,62,131,103,64,64,103,131,63,93,14,236,16,83,63,74,254,
+70,66,105,131,63,94,15,236,16,82,66,170,74,51,49,76,74,51,52,73,0,0,21,0,
+102,255,111,7,70,6,66,0,32,0,38,0,47,0,53,0,62,0,71,0,80,0,85,0,90,0,98,0,
+104,0,110,0,114,0,118,0,123,0,128,0,132,0,138,0,142,0,146,0,158,0,0,1,5,19,
+51,19,37,23,3,37,23,7,5,7,5,19,7,37,3,7,39,7,39,3,5,39,19,37,39,37,39,55,
+37,3,1,22,23,55,38,39,37,23,54,51,23,55,38,35,34,7,6,7,23,54,55,5,20,7,23,
+54,53,52,39,15,2,35,39,7,22,51,50,55,1,55,39,53,55,39,6,21,20,5,7,23,54,55,
+37,22,23,55,39,1,6,7,23,7,23,55,39,5,38,39,23,55,39,37,38,39,7,55,53,3,38,
+53,7,1,22,23,55,3,6,7,51,23,19,20,7,55,39,1,22,23,55,5,54,51,50,23,39,1,54,
+55,39,3,54,55,35,4,6,21,20,22,51,50,54,53,52,38,35,2,14,1,27,137,72,139,1,
+21,59,47,1,74,30,213,1,13,13,254,189,141,55,254,209,45,70,211,213,68,45,254,
+205,53,139,254,191,13,1,21,221,30,1,76,51,2,127,25,22,217,59,113,254,172,
+90,16,19,31,90,58,63,67,152,111,59,219,13,30,1,78,4,213,20,14,217,176,29,
+17,18,84,56,63,66,49,253,235,213,2,2,219,12,2,84,37,86,107,59,253,16,56,108,
+86,35,1,127,75,91,13,4,131,28,2,254,230,88,78,28,129,2,254,246,67,45,84,194,
+174,25,167,4,145,44,17,133,210,46,65,2,190,11,25,187,158,254,196,72,62,28,
+254,41,38,44,41,35,80,254,154,59,72,162,129,19,40,188,2,96,61,64,40,43,62,
+60,45,5,195,181,1,52,254,204,181,43,254,182,2,60,251,170,70,94,254,209,52,
+91,254,192,20,243,243,18,1,68,93,52,1,49,92,68,174,247,62,2,1,70,253,225,
+21,28,86,115,63,37,215,4,4,217,16,57,64,112,86,20,25,162,21,18,92,69,62,63,
+45,83,230,2,2,215,16,14,1,37,94,17,28,10,86,51,55,68,63,35,219,56,104,2,99,
+61,219,35,254,147,32,11,8,4,149,200,2,41,10,35,204,147,4,123,52,71,182,57,
+2,1,0,79,83,105,1,129,76,73,154,253,184,70,51,57,1,219,74,84,55,101,1,241,
+32,56,193,62,7,7,175,254,206,53,33,103,254,57,78,65,174,61,43,46,59,61,44,
+41,63,0,0,9,0,184,255,193,5,10,5,246,0,35,0,39,0,43,0,46,0,49,0,52,0,55,0,
+58,0,61,0,0,1,39,17,55,51,17,35,37,33,5,35,17,51,23,17,7,35,17,51,23,17,7,
+35,17,51,5,33,37,51,17,35,39,17,55,51,17,1,33,17,33,1,17,33,17,1,23,53,1,
+21,55,3,21,55,1,23,53,1,21,55,33,23,53,4,195,215,215,71,71,254,233,254,107,
+254,233,72,72,215,215,72,72,215,215,72,72,1,23,1,147,1,25,71,71,215,215,71,
+253,51,1,72,254,184,1,72,254,184,1,222,137,252,123,137,137,137,2,115,137,
+252,123,137,2,115,137,1,252,131,254,121,133,254,68,169,169,1,188,133,1,135,
+131,1,188,133,1,137,131,1,189,172,172,254,67,131,254,119,133,254,68,1,16,
+1,215,251,238,1,213,254,43,4,70,86,172,251,135,172,86,4,207,172,86,251,135,
+86,172,2,59,172,86,86,172,0,13,0,184,255,217,5,178,5,168,0,7,0,11,0,15,0,
+19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,0,19,33,17,33,17,33,17,
+33,19,51,53,35,17,51,53,35,1,51,53,35,17,51,53,35,1,51,53,35,1,51,53,35,1,
+51,53,35,1,21,51,53,1,21,51,53,1,51,53,35,19,53,35,21,1,53,35,21,184,2,74,
+2,176,253,182,253,80,103,194,194,194,194,2,73,195,195,195,195,253,183,194,
+194,2,73,195,195,254,224,186,186,2,73,187,252,252,186,1,143,187,187,187,187,
+254,113,186,2,244,2,180,252,229,253,76,2,51,129,254,152,129,3,27,129,254,
+151,129,251,229,127,2,54,127,253,178,129,3,156,129,129,253,75,129,129,1,76,
+129,254,154,127,127,253,75,127,127,0,0,2,0,184,0,0,5,156,5,139,0,22,0,31,
+0,0,33,17,33,17,35,17,33,17,35,17,33,17,35,17,52,18,36,51,50,4,18,21,17,1,
+33,53,52,0,35,32,4,21,5,53,254,232,103,254,232,103,254,232,103,161,1,30,178,
+169,1,27,175,251,131,4,22,254,241,253,254,255,254,247,1,96,254,160,1,96,254,
+160,1,96,254,160,2,125,217,1,105,204,203,254,138,205,253,131,1,199,80,245,
+1,4,252,247,0,25,0,104,254,252,8,37,6,184,0,3,0,7,0,60,0,66,0,72,0,78,0,84,
+0,88,0,92,0,96,0,100,0,104,0,108,0,112,0,116,0,120,0,124,0,128,0,132,0,136,
+0,140,0,144,0,148,0,152,0,156,0,0,1,54,55,39,39,6,7,55,5,21,16,0,35,34,0,
+39,6,6,21,20,22,23,7,35,32,0,53,52,0,55,38,33,34,7,39,53,16,0,51,50,0,23,
+54,54,53,52,39,55,51,32,0,21,20,0,7,22,22,51,50,54,55,1,39,7,21,20,23,3,23,
+55,39,35,34,5,55,53,52,39,7,1,39,7,23,51,50,1,38,39,23,3,6,7,55,1,23,54,55,
+1,22,23,39,1,22,23,39,1,38,39,23,5,54,55,7,1,6,7,55,1,7,54,55,1,39,22,23,
+1,38,39,23,1,38,39,7,1,55,6,7,1,22,23,55,3,55,38,39,1,22,23,55,3,23,54,55,
+1,6,7,55,1,139,47,52,54,86,103,32,29,7,45,254,210,227,207,254,249,17,76,84,
+104,113,26,7,254,235,254,163,1,17,229,145,254,245,196,185,72,1,46,227,200,
+1,1,26,72,82,217,26,7,1,23,1,91,254,227,231,68,219,149,97,187,97,250,242,
+148,2,35,133,82,117,19,18,87,4,38,2,35,115,1,2,82,116,19,17,86,253,60,64,
+108,59,90,94,43,182,2,115,45,94,43,254,182,64,108,59,253,12,72,47,37,3,115,
+75,44,37,253,80,5,9,116,2,155,5,9,117,1,211,107,103,32,251,230,234,107,151,
+2,37,109,149,25,254,86,18,5,74,3,244,45,52,46,254,162,16,6,74,238,113,47,
+62,254,176,49,62,2,160,39,27,47,1,121,29,47,113,3,205,16,6,74,51,105,153,
+25,160,7,254,235,254,163,1,30,241,68,217,143,97,187,97,72,1,45,227,204,1,
+3,21,145,217,27,7,1,20,1,93,254,247,228,67,215,140,196,185,71,254,207,223,
+208,254,250,15,80,90,104,113,253,202,117,19,18,84,78,4,72,115,148,2,82,19,
+18,86,76,82,251,239,115,147,2,3,110,94,43,182,254,51,64,108,60,2,35,113,64,
+108,253,63,92,45,182,2,84,5,9,117,253,100,5,10,117,84,72,47,37,3,114,72,46,
+36,253,185,234,107,151,253,80,107,103,32,6,79,104,32,29,249,246,52,46,53,
+1,33,96,18,5,3,224,47,52,53,252,95,37,23,50,1,121,26,50,113,254,154,113,51,
+57,1,80,53,57,2,0,0,8,0,102,255,199,5,199,5,231,0,47,0,63,0,67,0,71,0,77,
+0,83,0,89,0,95,0,0,1,38,38,53,52,51,50,22,23,22,51,50,55,54,54,51,50,21,20,
+6,7,6,21,20,23,22,22,21,20,35,34,38,39,38,35,34,7,6,6,35,34,53,52,54,55,54,
+53,52,19,54,51,50,23,38,53,52,55,6,35,34,39,22,21,20,19,33,17,33,55,51,17,
+35,1,6,21,20,51,50,1,54,53,52,35,34,3,22,51,50,53,52,1,38,35,34,21,20,1,131,
+143,142,146,81,121,25,127,193,167,144,26,121,80,146,142,143,25,25,143,142,
+146,80,121,26,126,185,194,126,26,121,80,146,142,143,25,75,117,191,182,117,
+27,27,117,182,191,117,27,90,1,117,254,139,103,167,167,254,170,160,43,74,3,
+127,159,43,74,42,43,73,43,252,13,43,74,43,4,106,31,126,75,149,155,133,23,
+23,139,149,149,77,124,31,157,250,242,157,31,125,76,149,149,139,23,23,139,
+149,149,78,123,31,154,247,248,253,131,20,20,170,217,225,170,20,20,170,223,
+219,1,219,254,4,102,1,48,253,96,43,72,47,4,178,47,68,47,251,78,162,47,68,
+4,63,162,47,71,0,0,1,0,102,255,119,3,193,5,221,0,33,0,0,1,17,20,2,7,5,17,
+35,37,21,35,17,51,5,53,37,53,54,0,53,52,38,35,34,6,7,39,54,54,51,50,22,23,
+53,3,193,214,184,1,90,71,254,18,102,71,1,238,254,67,236,1,4,159,124,97,183,
+111,82,123,226,124,91,146,46,5,221,254,76,162,254,208,105,58,254,76,90,227,
+1,80,88,237,76,72,112,1,45,156,114,144,143,172,61,189,167,64,58,198,0,0,2,
+0,102,255,229,4,39,5,229,0,50,0,62,0,0,1,21,55,53,38,38,53,52,54,51,50,22,
+21,20,6,7,21,23,53,51,21,23,7,39,21,35,53,39,17,23,53,51,21,23,7,39,21,35,
+53,39,17,35,17,7,21,35,53,7,39,55,53,0,54,53,52,38,35,34,6,21,20,22,51,1,
+61,207,97,118,156,108,111,156,122,91,198,103,133,41,92,103,198,200,103,133,
+41,92,103,200,103,207,102,72,41,113,1,172,94,95,69,68,93,92,69,3,51,121,90,
+195,19,147,94,112,154,156,110,95,147,18,2,86,121,164,57,95,39,96,141,84,254,
+152,86,121,164,57,95,39,96,141,86,254,88,2,191,90,140,97,31,94,47,166,1,6,
+96,66,66,98,96,68,67,95,0,9,0,102,255,6,8,20,6,221,0,39,0,42,0,45,0,48,0,
+51,0,54,0,57,0,60,0,63,0,0,19,19,51,19,19,51,19,17,51,17,33,21,3,35,3,3,35,
+3,17,33,21,3,35,3,3,35,3,17,35,17,33,53,19,51,19,19,51,19,17,33,1,51,39,3,
+51,39,1,51,39,3,51,39,1,35,23,37,35,23,1,35,23,37,35,23,102,213,72,193,190,
+72,192,103,3,163,213,71,195,188,72,192,3,163,213,71,195,188,72,192,103,252,
+92,213,72,193,190,72,192,252,92,2,84,220,111,109,220,111,253,205,219,111,
+108,219,111,6,39,219,111,254,166,220,111,2,51,219,111,254,166,220,111,4,246,
+1,121,254,176,1,80,254,176,1,190,252,72,62,254,136,1,79,254,177,1,77,254,
+103,62,254,136,1,79,254,177,1,77,254,76,3,176,62,1,121,254,176,1,80,254,176,
+1,155,254,101,190,1,68,190,253,64,190,1,68,190,252,225,190,190,190,254,188,
+190,190,190,0,7,0,102,255,186,6,143,6,86,0,46,0,50,0,54,0,58,0,62,0,74,0,
+86,0,0,1,33,53,51,21,33,17,33,21,22,0,19,22,22,21,20,6,35,34,38,53,52,54,
+55,38,0,35,34,0,7,22,22,21,20,6,35,34,38,53,52,54,55,18,0,55,53,33,37,53,
+33,21,33,33,53,33,37,21,33,53,5,33,53,33,2,54,53,52,38,35,34,6,21,20,22,51,
+36,6,21,20,22,51,50,54,53,52,38,35,1,76,1,252,102,1,254,254,2,223,1,66,20,
+73,99,118,84,84,121,74,59,19,254,215,198,199,254,212,15,59,74,121,84,84,119,
+97,75,20,1,62,228,254,4,3,250,254,104,254,4,1,150,254,106,1,252,1,152,252,
+108,1,150,254,106,87,61,62,41,41,59,58,42,4,109,64,64,39,42,58,60,40,5,225,
+117,117,254,35,47,21,254,144,255,0,12,114,77,83,120,118,85,65,104,22,238,
+1,63,254,190,235,22,104,65,85,118,119,84,76,115,12,1,0,1,110,23,47,102,89,
+89,89,184,82,82,82,82,250,166,60,40,41,62,62,41,42,58,203,60,43,43,57,58,
+42,42,61,0,0,3,0,102,255,168,7,66,6,72,0,43,0,46,0,58,0,0,5,1,1,37,55,5,55,
+37,55,5,55,37,55,5,19,39,55,1,38,38,53,52,54,51,50,22,21,20,6,7,1,7,37,19,
+37,23,5,23,37,23,5,23,37,23,1,19,7,0,54,53,52,38,35,34,6,21,20,22,51,5,14,
+254,199,254,199,253,202,25,1,211,27,254,47,24,1,211,27,254,45,24,1,211,74,
+248,15,1,102,46,56,111,77,80,111,61,48,1,129,61,254,206,179,1,211,24,254,
+47,25,1,213,24,254,45,27,1,211,25,251,223,78,226,1,111,51,51,37,37,49,49,
+37,88,4,162,251,94,149,99,125,100,123,98,123,99,125,98,125,1,21,208,72,1,
+4,23,90,57,82,109,111,80,59,90,23,254,228,82,223,253,96,125,98,125,99,123,
+98,123,100,125,99,2,244,1,35,164,1,131,49,37,37,51,51,37,37,49,0,4,0,184,
+255,150,4,145,6,37,0,3,0,7,0,11,0,15,0,0,19,33,17,33,19,33,17,33,1,17,33,
+17,17,33,53,33,184,3,217,252,39,103,3,12,252,244,3,12,252,244,3,12,252,244,
+6,37,249,113,3,243,2,53,250,62,2,53,253,203,2,156,139,0,0,6,0,102,255,236,
+5,223,5,100,0,13,0,29,0,41,0,53,0,65,0,77,0,0,0,0,17,16,0,33,34,36,2,53,52,
+18,36,51,18,36,18,53,52,2,36,35,34,4,2,21,20,18,4,51,18,0,21,20,0,35,34,0,
+53,52,0,51,18,54,53,52,38,35,34,6,21,20,22,51,18,22,21,20,6,35,34,38,53,52,
+54,51,18,54,53,52,38,35,34,6,21,20,22,51,4,70,1,153,254,105,254,219,190,254,
+187,186,186,1,70,189,162,1,21,159,159,254,235,162,162,254,235,159,159,1,21,
+162,188,1,10,254,246,188,188,254,245,1,10,189,145,207,207,145,147,205,205,
+147,88,121,121,88,88,121,121,88,45,61,61,45,45,62,61,46,5,100,254,105,254,
+219,254,221,254,103,186,1,68,190,190,1,68,186,250,238,159,1,21,162,162,1,
+21,159,159,254,235,162,162,254,235,159,4,29,254,247,190,191,254,248,1,10,
+189,188,1,11,252,217,204,148,148,204,205,147,147,205,2,49,121,88,88,121,121,
+88,88,121,254,196,63,44,45,61,62,44,43,64,0,6,0,184,0,0,6,225,5,133,0,33,
+0,37,0,40,0,43,0,46,0,49,0,0,1,22,4,51,50,36,55,23,6,6,7,33,17,35,17,3,35,
+3,3,35,3,3,35,3,3,35,3,17,35,17,33,38,38,39,3,33,53,33,1,55,35,7,55,35,5,
+55,35,5,55,35,1,201,117,1,22,115,116,1,25,129,86,99,228,109,2,106,102,141,
+72,133,137,72,133,135,72,133,131,72,141,103,2,95,111,228,85,80,5,92,250,164,
+3,90,102,205,239,102,205,3,17,102,203,252,99,100,203,5,131,209,254,249,216,
+53,166,242,57,252,129,1,139,254,228,1,20,254,236,1,20,254,236,1,16,254,240,
+1,28,254,117,3,127,59,252,156,252,246,209,253,247,209,209,209,207,207,207,
+207,0,8,0,102,255,158,3,70,5,236,0,35,0,53,0,71,0,82,0,92,0,100,0,110,0,120,
+0,0,37,22,21,20,6,35,34,38,53,52,55,38,53,52,55,38,53,52,55,38,53,52,54,51,
+50,22,21,20,7,22,21,20,7,22,21,20,1,54,51,50,23,54,53,52,39,6,6,35,34,38,
+39,6,21,20,5,6,35,34,39,6,21,20,23,54,54,51,50,22,23,54,53,52,1,54,51,50,
+23,53,52,38,35,34,6,1,6,35,34,39,20,22,51,50,54,1,22,51,50,55,38,35,34,3,
+22,51,50,55,38,38,35,34,6,1,38,35,34,7,22,22,51,50,54,2,227,11,162,117,117,
+164,9,97,60,60,97,9,163,116,117,164,11,99,62,62,253,163,98,140,136,98,30,
+47,38,113,68,68,113,38,45,1,244,98,138,135,101,28,45,38,115,68,66,115,38,
+45,254,70,78,98,93,85,103,75,72,104,1,98,81,95,92,86,103,75,72,102,254,166,
+73,97,97,75,79,91,100,47,64,83,81,64,24,76,45,46,77,1,10,67,78,78,67,23,76,
+46,45,77,254,37,35,117,163,164,116,37,35,106,146,109,94,92,110,146,106,34,
+38,119,162,164,117,32,42,103,147,110,92,96,107,149,1,175,84,84,55,68,82,68,
+48,57,55,50,65,85,65,217,84,82,58,63,87,65,50,57,57,48,65,85,67,2,150,45,
+47,2,74,104,102,251,149,43,45,74,104,100,2,93,62,62,61,254,25,43,43,34,41,
+41,3,50,43,43,36,40,40,0,0,2,0,102,255,211,2,168,6,0,0,14,0,26,0,0,1,17,22,
+22,21,20,6,35,34,38,53,52,54,55,17,18,54,53,52,38,35,34,6,21,20,22,51,1,186,
+101,137,171,118,119,170,136,102,127,111,108,79,77,109,111,75,6,0,252,145,
+22,195,131,150,204,205,149,130,196,22,3,111,250,57,146,106,104,148,147,105,
+106,146,0,0,3,0,102,255,225,4,61,6,133,0,32,0,68,0,100,0,0,1,51,54,53,51,
+20,7,51,50,22,21,20,6,7,7,22,18,21,20,0,35,34,38,38,53,52,54,54,55,34,38,
+53,52,1,7,6,21,20,23,23,22,21,20,6,7,7,6,21,20,22,22,21,21,6,6,21,20,22,22,
+21,20,6,7,51,50,54,53,52,2,1,54,54,55,54,53,52,38,38,53,52,54,53,52,38,38,
+53,52,55,55,54,53,52,38,38,39,14,2,21,20,22,1,199,53,59,103,49,65,57,54,32,
+37,42,186,213,254,223,198,129,231,136,93,190,31,41,53,1,12,22,13,17,40,88,
+28,62,29,12,77,63,6,136,91,44,108,12,16,157,228,211,254,213,14,52,38,15,83,
+52,141,88,51,57,63,11,66,72,6,128,75,38,153,5,37,161,191,201,151,46,35,32,
+44,17,21,112,254,171,180,224,254,216,149,249,133,119,228,243,49,50,34,94,
+254,250,12,8,11,11,10,24,52,69,26,51,42,20,8,13,14,41,57,49,7,69,69,19,14,
+52,58,42,53,70,12,237,180,167,1,49,252,157,28,49,22,9,11,17,41,63,33,74,80,
+16,17,45,56,37,64,41,45,7,11,17,29,53,38,159,130,133,75,130,231,0,0,11,0,
+102,255,147,7,4,6,49,0,106,0,118,0,129,0,140,0,151,0,162,0,174,0,186,0,198,
+0,210,0,222,0,0,1,38,35,35,22,21,20,6,35,34,38,53,52,54,55,38,39,55,22,23,
+51,50,23,54,54,51,50,23,54,53,53,6,35,34,38,53,52,54,51,50,22,23,54,55,23,
+6,7,21,20,7,22,22,21,20,7,22,51,51,38,53,52,54,51,50,22,21,20,6,7,22,23,7,
+38,39,35,34,39,6,6,35,34,39,6,21,21,54,51,50,22,21,20,6,35,34,38,39,7,39,
+54,55,53,52,55,38,38,53,52,4,54,53,52,38,35,34,6,21,20,22,51,37,6,6,21,20,
+22,51,50,54,53,52,1,38,38,35,34,6,21,20,22,51,50,1,54,54,53,52,38,35,34,6,
+21,20,1,22,22,51,50,54,53,52,38,35,34,0,22,21,20,6,35,34,38,53,52,54,51,0,
+54,51,50,22,21,20,6,35,34,38,53,2,6,35,34,38,53,52,54,51,50,22,21,18,22,21,
+20,6,35,34,38,53,52,54,51,36,38,53,52,54,51,50,22,21,20,6,35,2,190,54,64,
+9,9,142,120,86,134,190,161,12,29,94,36,13,29,75,93,34,102,60,21,43,8,50,69,
+146,171,126,103,117,161,21,62,69,37,69,89,12,43,51,8,67,52,8,8,141,121,85,
+134,187,165,17,26,94,24,26,28,78,90,35,104,60,33,30,6,50,68,145,173,129,101,
+118,160,23,129,37,108,50,10,43,49,1,59,93,92,62,63,88,88,63,254,37,122,144,
+70,51,72,81,2,21,16,107,74,60,69,126,112,38,1,203,123,146,69,52,73,81,253,
+236,14,105,77,63,66,124,113,51,253,209,36,36,25,26,36,36,26,2,168,37,24,26,
+36,36,26,24,37,137,37,25,26,35,35,26,25,37,92,37,37,25,26,35,35,26,2,76,37,
+37,25,26,35,35,26,3,33,8,56,63,146,171,129,100,117,161,21,46,85,37,103,55,
+12,43,51,8,51,68,8,8,142,120,85,134,190,162,15,28,94,27,22,29,80,88,35,104,
+60,39,24,6,50,68,145,173,128,102,118,160,23,63,66,36,61,96,10,43,49,6,65,
+51,8,8,141,121,87,133,187,164,41,94,37,12,29,76,90,35,103,60,38,189,87,64,
+62,92,92,62,63,88,217,16,105,76,63,66,124,114,48,1,193,123,146,69,52,73,81,
+253,236,14,106,76,60,69,126,111,42,254,54,122,144,70,51,72,81,1,144,37,25,
+26,35,35,26,25,37,253,250,36,36,25,26,35,35,26,4,174,37,37,25,26,35,35,26,
+253,217,37,25,26,35,35,26,25,37,8,37,24,26,36,36,26,24,37,0,10,0,102,255,
+102,6,229,6,147,0,91,0,103,0,116,0,127,0,138,0,150,0,162,0,175,0,187,0,197,
+0,0,37,38,39,6,35,34,38,53,52,54,51,50,23,54,55,38,38,53,52,54,51,50,22,23,
+54,55,53,52,55,38,38,39,55,22,22,23,54,54,51,50,22,21,20,6,35,34,39,7,21,
+22,23,54,54,51,50,22,21,20,6,7,22,23,54,51,50,22,21,20,6,35,34,39,6,7,22,
+21,20,6,35,34,38,39,7,35,39,6,6,35,34,38,53,52,4,0,53,52,0,35,34,0,21,20,
+0,51,19,23,55,23,3,35,39,7,35,3,55,23,55,37,22,23,54,54,53,52,38,35,34,6,
+5,54,55,38,38,35,34,6,21,20,22,1,22,51,50,54,53,52,38,35,34,7,6,5,38,39,38,
+35,34,6,21,20,22,51,50,23,6,6,21,20,22,51,50,54,53,53,39,38,37,6,7,21,20,
+22,51,50,54,53,52,38,1,22,51,50,54,53,52,38,35,34,2,2,27,22,65,74,93,131,
+130,94,25,26,6,12,75,99,130,93,69,106,26,101,124,4,84,154,56,82,43,120,66,
+27,119,83,82,96,122,107,43,51,2,136,112,26,108,68,93,131,100,77,15,6,24,27,
+94,129,130,93,82,57,44,7,88,129,94,91,131,2,29,61,29,4,129,90,94,129,2,182,
+1,17,254,241,190,191,254,242,1,15,190,35,73,76,99,140,71,72,72,71,138,99,
+77,68,1,154,80,43,49,65,69,52,42,63,252,142,51,72,11,62,42,51,69,63,4,41,
+36,54,50,71,70,51,21,24,6,251,203,39,4,22,23,51,70,69,52,52,214,29,33,72,
+49,51,70,2,98,2,90,80,98,70,51,50,70,35,254,197,40,42,59,68,35,41,97,248,
+29,34,47,129,94,94,130,6,44,44,16,122,81,93,130,70,57,61,15,63,64,28,37,124,
+77,61,58,104,32,117,122,99,83,87,116,11,31,92,10,68,57,70,129,94,80,124,15,
+41,47,6,131,93,93,130,47,57,8,68,108,93,131,124,93,2,2,93,124,131,93,111,
+17,1,15,190,189,1,15,254,239,187,188,254,239,2,143,203,211,32,254,143,205,
+205,1,113,32,209,201,228,76,80,2,69,50,49,72,49,193,88,68,37,49,72,49,49,
+70,254,22,36,69,51,51,70,8,105,92,97,98,10,70,51,50,70,191,15,57,34,52,69,
+70,51,7,9,28,62,62,28,16,51,70,69,52,34,57,4,226,10,56,44,32,48,0,14,0,102,
+0,0,5,168,6,121,0,35,0,59,0,84,0,89,0,93,0,98,0,103,0,107,0,111,0,115,0,120,
+0,124,0,129,0,135,0,0,1,22,22,23,54,54,55,23,7,22,21,20,7,22,18,19,21,33,
+53,52,38,35,34,6,21,21,33,53,18,18,55,38,53,52,55,39,19,55,53,55,39,53,55,
+39,53,55,39,53,55,39,53,55,39,53,6,6,21,20,22,23,51,54,54,53,52,38,39,7,23,
+21,7,23,21,7,23,21,7,23,21,7,23,21,7,23,50,7,6,6,7,23,37,38,39,23,1,6,7,51,
+39,19,6,6,7,55,1,38,39,7,55,38,39,7,7,22,23,55,37,22,22,23,55,1,54,55,7,19,
+23,55,54,55,55,39,7,54,51,50,2,111,35,78,38,40,79,35,45,109,201,82,219,239,
+7,254,2,90,74,75,87,254,2,6,240,217,80,201,108,96,43,39,39,39,39,39,39,39,
+39,39,39,58,71,53,35,198,36,53,71,65,32,34,34,34,34,34,34,34,34,34,34,34,
+21,127,84,171,73,236,2,8,145,181,99,253,73,21,3,215,195,123,31,58,13,205,
+3,127,3,16,197,175,32,71,102,88,14,8,129,254,252,19,45,14,76,253,227,8,15,
+152,105,77,4,32,42,199,70,65,31,32,46,6,121,19,40,25,25,40,19,90,58,163,222,
+125,104,88,254,98,254,209,90,66,171,197,198,170,66,90,1,28,1,170,97,103,124,
+222,163,58,253,125,8,41,24,21,43,22,21,43,22,21,43,22,21,43,22,21,39,53,133,
+91,65,101,32,32,103,63,76,147,60,18,25,43,21,22,43,21,22,43,21,22,43,21,24,
+41,21,24,101,8,87,85,51,53,162,16,231,254,217,94,109,172,1,60,44,141,61,49,
+254,221,87,87,174,242,136,110,197,82,41,114,116,220,13,59,35,147,254,136,
+111,44,39,1,4,147,12,60,35,32,164,162,11,0,0,5,0,102,0,14,5,125,5,37,0,15,
+0,28,0,41,0,54,0,67,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,19,35,
+21,51,53,51,21,51,38,0,39,21,51,1,51,53,35,21,35,53,35,22,0,23,53,35,3,21,
+51,53,35,53,51,53,6,0,7,51,53,1,53,35,21,51,21,35,21,54,0,55,35,21,3,161,
+1,46,174,174,254,211,176,177,254,211,174,175,1,44,177,186,135,237,103,153,
+18,254,233,196,135,254,139,135,237,103,155,18,1,25,196,135,102,237,135,135,
+196,254,231,18,155,2,168,237,135,135,196,1,23,18,153,5,37,175,254,210,174,
+177,254,211,174,175,1,44,177,176,1,45,174,254,149,237,153,153,194,1,25,18,
+153,253,88,237,153,153,196,254,232,19,155,2,84,153,237,103,153,18,254,234,
+197,153,254,103,153,237,103,155,18,1,26,195,153,0,0,7,0,102,255,8,4,86,6,
+184,0,42,0,55,0,67,0,79,0,85,0,97,0,109,0,0,19,17,33,17,22,22,21,20,6,7,21,
+37,51,17,22,22,21,20,6,7,17,35,53,7,39,21,35,17,38,38,53,52,54,55,53,5,35,
+17,38,38,53,52,54,19,17,7,35,39,17,37,51,17,55,23,17,5,0,54,53,52,38,35,34,
+6,21,20,22,51,0,54,53,52,38,35,34,6,21,20,22,51,3,55,50,23,53,35,0,22,21,
+20,6,35,34,38,53,52,54,51,0,22,21,20,6,35,34,38,53,52,54,51,221,1,17,49,61,
+61,49,1,170,71,54,65,65,54,102,31,37,102,51,60,60,51,254,86,72,54,65,65,224,
+19,35,13,1,170,71,37,31,254,86,1,201,88,89,61,60,87,86,61,254,68,88,89,61,
+60,87,86,61,28,28,21,18,67,2,91,31,31,22,21,32,32,21,254,28,32,32,22,21,32,
+32,21,5,162,1,22,254,228,34,110,65,66,109,34,180,245,253,131,32,112,69,68,
+113,32,254,244,234,2,4,236,1,17,32,110,66,65,110,34,199,235,2,94,34,112,69,
+68,113,253,62,1,21,2,2,254,74,239,254,213,4,2,1,207,244,253,152,86,61,61,
+89,88,62,61,86,3,225,86,62,62,87,87,62,62,86,1,142,2,4,143,250,215,32,21,
+22,32,32,22,21,32,3,225,31,22,22,31,31,22,22,31,0,11,0,102,255,158,4,88,6,
+6,0,18,0,30,0,34,0,38,0,42,0,46,0,51,0,55,0,59,0,62,0,74,0,0,1,5,17,33,17,
+33,21,22,22,21,20,6,35,34,38,53,52,55,17,0,54,53,52,38,35,34,6,21,20,22,51,
+1,51,53,35,17,51,53,35,53,51,53,35,53,51,53,35,1,54,55,53,35,55,51,53,35,
+7,51,53,35,53,51,39,18,22,21,20,6,35,34,38,53,52,54,51,1,4,1,139,1,201,253,
+178,108,130,195,135,137,191,86,1,82,131,132,95,93,132,131,94,1,72,252,252,
+252,252,252,252,252,252,254,45,57,72,129,231,133,133,231,129,129,141,141,
+168,41,41,29,29,41,41,29,4,121,193,2,78,252,135,108,32,176,108,136,191,190,
+137,127,97,2,180,251,139,133,92,93,135,133,95,94,131,5,62,94,253,84,94,102,
+95,102,94,253,53,28,3,94,103,94,94,94,102,70,253,45,41,29,29,40,40,29,29,
+41,0,19,0,102,254,223,4,94,6,137,0,15,0,19,0,23,0,27,0,31,0,38,0,45,0,49,
+0,53,0,57,0,61,0,65,0,69,0,73,0,77,0,81,0,85,0,89,0,93,0,0,1,1,21,33,17,33,
+21,1,35,1,53,33,17,33,53,1,3,51,53,35,17,51,53,35,53,51,53,35,17,51,53,35,
+19,51,38,38,35,34,6,19,35,22,22,51,50,54,7,7,23,53,17,53,7,23,51,55,39,21,
+17,21,55,39,55,21,23,55,17,39,7,21,1,55,39,35,17,51,55,39,19,7,23,55,17,39,
+7,23,37,23,55,39,17,55,39,7,2,133,1,217,254,213,1,43,254,39,72,254,41,1,43,
+254,213,1,215,69,213,213,213,213,213,213,213,213,14,184,17,54,19,20,56,166,
+184,16,57,21,19,56,146,58,76,76,58,139,57,75,75,57,125,110,50,50,110,254,
+12,111,2,158,158,2,111,150,86,45,53,53,45,86,1,45,8,88,47,47,88,8,6,137,253,
+158,72,253,170,71,253,157,2,99,71,2,86,72,2,98,251,0,74,1,20,74,103,71,254,
+90,72,1,197,40,64,64,252,181,39,66,67,151,104,96,188,4,180,189,97,104,104,
+97,189,251,76,188,96,104,189,4,60,64,3,35,63,59,4,252,157,60,4,3,35,4,59,
+252,62,50,59,92,4,4,92,59,49,16,16,49,57,251,72,57,50,17,0,4,0,102,254,231,
+4,41,6,166,0,43,0,55,0,63,0,71,0,0,1,53,34,39,55,22,51,54,54,51,50,22,21,
+20,6,7,21,22,22,21,20,6,7,21,22,23,7,38,39,6,6,35,34,38,53,52,54,55,53,38,
+38,53,52,54,0,54,53,52,38,35,34,6,21,20,22,51,3,6,6,21,20,22,51,50,19,54,
+54,53,52,38,35,34,2,20,241,189,17,191,222,10,149,122,88,107,197,176,120,163,
+165,118,250,180,16,167,249,10,143,126,88,106,199,173,120,160,158,1,14,135,
+135,96,94,136,135,95,54,124,144,52,40,160,121,124,146,52,40,162,4,16,189,
+28,103,29,189,182,102,82,121,157,11,189,18,187,124,126,185,17,190,5,24,103,
+23,6,184,187,103,82,120,157,9,193,18,187,123,122,188,253,228,135,95,96,135,
+135,96,94,136,254,119,9,100,75,38,44,5,231,9,101,75,38,43,0,0,8,0,102,255,
+236,5,199,5,227,0,49,0,65,0,69,0,82,0,88,0,94,0,100,0,106,0,0,1,38,38,53,
+52,51,50,22,23,22,51,50,55,54,54,51,50,21,20,6,7,6,21,20,22,23,22,22,21,20,
+35,34,38,39,38,35,34,7,6,6,35,34,53,52,54,55,54,54,53,52,19,54,51,50,23,38,
+53,52,55,6,35,34,39,22,21,20,19,33,17,33,19,51,53,35,17,51,53,35,34,38,53,
+52,54,1,6,21,20,51,50,1,54,53,52,35,34,5,38,35,34,21,20,1,22,51,50,53,52,
+1,131,143,142,146,81,121,25,127,193,167,144,26,121,80,146,142,143,25,11,10,
+143,146,146,80,121,26,126,185,194,126,26,121,80,146,148,143,12,7,82,115,186,
+178,117,23,27,117,182,191,117,27,90,1,117,254,139,209,61,167,167,61,26,35,
+35,254,90,160,43,74,3,127,159,43,74,252,130,43,74,43,3,244,43,73,43,4,102,
+31,125,76,149,155,133,23,23,139,149,149,78,123,31,157,250,149,150,60,31,125,
+75,149,149,139,23,23,139,149,149,77,123,31,85,146,130,248,253,172,20,20,141,
+205,225,170,20,20,170,223,205,1,246,253,219,1,84,106,254,168,113,35,26,26,
+38,253,203,43,72,47,4,137,47,68,47,162,162,47,71,251,237,162,47,68,0,3,0,
+102,255,111,4,217,6,47,0,79,0,86,0,93,0,0,1,23,55,23,7,21,54,51,51,55,23,
+7,23,7,39,35,34,7,17,22,51,51,55,23,7,23,7,39,35,34,39,21,22,22,21,20,6,7,
+21,23,7,39,7,39,55,53,6,35,35,7,39,55,39,55,23,51,50,55,17,38,35,35,7,39,
+55,39,55,23,51,50,23,53,38,38,53,52,54,55,53,39,19,21,54,54,53,52,38,3,53,
+6,6,21,20,22,2,31,129,129,73,151,68,79,148,149,74,129,129,74,149,148,82,65,
+57,90,148,149,74,129,129,74,149,148,93,54,121,137,133,125,151,73,129,129,
+74,152,56,92,149,148,74,129,129,74,148,149,90,58,69,79,149,148,74,129,129,
+74,148,149,78,70,125,134,136,123,152,254,71,85,85,173,73,83,83,6,47,129,129,
+74,151,82,10,141,73,119,119,74,142,13,254,213,10,142,74,119,119,74,142,8,
+82,35,127,75,76,120,32,141,152,73,129,129,73,152,121,8,142,74,119,118,74,
+141,10,1,43,12,141,74,119,118,74,141,10,79,32,120,76,75,126,36,105,151,252,
+93,250,21,64,36,35,69,1,86,250,25,69,35,35,64,0,5,0,184,0,0,5,248,5,63,0,
+3,0,7,0,11,0,15,0,19,0,0,19,33,17,33,37,33,17,41,2,17,33,3,33,17,41,2,17,
+33,184,5,64,250,192,1,209,1,158,254,98,1,159,1,106,254,150,1,254,98,1,158,
+254,97,254,150,1,106,5,63,250,193,102,1,107,1,158,1,106,254,150,254,98,0,
+0,4,0,102,0,0,6,160,6,164,0,18,0,25,0,32,0,43,0,0,51,1,38,38,53,52,54,55,
+51,22,22,21,20,6,7,1,35,9,3,35,1,1,35,1,19,19,35,39,7,35,19,19,6,6,21,20,
+23,54,54,53,52,38,102,2,222,56,65,74,63,88,63,74,65,56,2,228,123,253,92,253,
+96,2,185,2,0,123,254,98,254,102,122,1,251,54,243,122,150,149,123,243,27,34,
+44,80,41,37,45,4,100,75,144,78,85,147,47,46,148,85,78,144,75,251,156,4,6,
+251,250,3,0,253,0,2,106,253,150,3,0,254,117,254,139,231,231,1,117,4,207,31,
+96,56,97,114,57,93,61,56,96,0,0,6,0,102,0,0,5,211,4,250,0,21,0,29,0,33,0,
+37,0,42,0,47,0,0,1,17,54,55,17,51,17,22,23,17,51,17,22,18,21,21,33,53,52,
+18,55,17,3,1,51,1,38,38,35,34,3,7,1,51,1,39,1,51,33,51,39,6,21,5,52,39,7,
+51,2,88,62,83,103,84,61,103,186,209,250,147,215,181,111,1,141,31,1,139,80,
+212,121,236,242,47,1,21,108,2,152,45,254,180,107,252,178,217,191,26,4,160,
+27,182,209,4,250,254,117,19,7,1,72,254,184,7,19,1,139,254,76,92,254,140,233,
+141,154,231,1,109,88,1,180,253,125,253,239,2,11,86,94,255,0,82,254,147,1,
+101,82,254,73,252,89,111,13,100,103,242,0,3,0,102,0,0,6,45,4,195,0,74,0,86,
+0,98,0,0,37,33,53,35,53,51,53,35,53,51,17,52,38,35,34,6,21,20,23,54,54,51,
+50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,
+38,53,52,54,51,50,22,23,54,53,52,38,35,34,6,21,17,51,21,35,21,51,21,35,21,
+33,21,33,2,54,53,52,38,35,34,6,21,20,22,51,36,6,21,20,22,51,50,54,53,52,38,
+35,1,207,1,72,177,177,132,132,181,141,112,152,26,16,84,66,73,97,103,79,120,
+163,218,149,127,191,55,55,192,125,152,215,163,120,77,105,98,72,66,85,15,27,
+155,110,141,180,129,129,174,174,1,70,253,12,41,43,43,31,31,41,41,31,3,102,
+42,42,31,31,41,41,31,102,109,102,109,102,1,6,143,187,157,99,92,43,57,68,95,
+69,68,94,192,144,141,218,116,116,117,115,219,140,144,192,93,69,67,97,68,57,
+44,91,101,155,186,144,254,250,102,109,102,109,102,2,115,34,25,25,37,37,25,
+25,34,121,37,25,25,34,34,25,25,37,0,0,4,0,102,255,199,5,106,6,70,0,35,0,68,
+0,78,0,90,0,0,19,16,0,55,38,53,52,54,51,50,22,21,20,7,22,0,17,21,35,38,39,
+22,19,35,38,38,39,6,6,7,35,18,55,6,7,35,1,22,22,23,53,52,2,39,6,6,35,34,38,
+39,6,2,21,21,54,54,55,23,6,3,54,54,51,50,22,23,38,38,39,1,22,22,51,50,54,
+55,38,35,34,54,54,53,52,38,35,34,6,21,20,22,51,102,1,24,222,18,92,65,65,95,
+20,236,1,11,71,111,149,87,21,71,99,194,56,57,188,101,71,21,87,133,127,72,
+3,97,143,113,61,98,88,66,181,106,108,180,66,89,97,75,119,123,53,96,33,83,
+171,43,45,174,78,16,59,52,254,62,52,145,85,84,144,53,132,149,150,171,35,35,
+23,23,32,32,23,2,41,1,58,1,187,62,34,40,67,93,94,66,38,36,76,254,77,254,206,
+147,78,75,240,254,134,112,172,25,26,169,114,1,122,240,65,88,1,41,60,55,37,
+45,145,1,21,98,72,83,83,72,99,254,237,146,45,44,57,51,48,249,254,249,86,123,
+126,83,148,231,133,2,19,57,66,66,57,102,101,32,23,23,34,34,23,23,32,0,0,2,
+0,102,255,236,6,61,5,195,0,99,0,103,0,0,18,54,51,50,23,38,38,35,53,50,22,
+23,1,38,38,53,51,20,22,23,38,53,52,54,51,50,22,21,20,7,54,54,53,51,20,6,7,
+1,54,54,51,21,34,6,7,54,51,50,22,21,20,6,35,34,39,22,22,51,21,34,38,39,1,
+22,22,21,35,52,38,39,22,21,20,6,35,34,38,53,52,55,6,6,21,35,52,54,55,1,6,
+6,35,53,50,54,55,6,35,34,38,53,9,3,162,83,56,29,28,39,138,79,124,207,40,1,
+0,118,148,102,85,75,12,83,56,58,81,14,77,85,102,152,118,1,0,37,206,127,79,
+140,39,33,27,58,81,79,60,32,28,39,141,78,125,206,39,255,0,120,150,102,86,
+76,14,79,60,59,80,12,75,85,102,151,115,254,254,39,205,125,79,137,40,24,33,
+59,80,2,176,1,94,254,162,254,162,3,22,78,14,78,84,102,148,122,1,0,38,205,
+128,79,140,39,27,32,61,78,81,58,26,33,39,140,79,128,207,36,255,0,118,152,
+102,84,78,14,81,58,56,83,12,76,84,102,146,120,255,0,39,207,124,79,139,38,
+30,28,56,83,80,59,32,26,39,139,78,129,202,37,1,2,119,147,102,83,77,12,80,
+59,254,160,1,94,1,94,254,162,0,5,0,102,255,236,5,137,5,14,0,15,0,31,0,53,
+0,75,0,103,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,18,36,18,53,52,
+2,36,35,34,4,2,21,20,18,4,51,3,7,23,21,7,23,21,7,23,21,7,39,55,39,53,55,39,
+53,55,39,53,55,5,7,23,21,7,23,21,7,23,21,7,39,55,39,53,55,39,53,55,39,53,
+55,39,23,7,23,21,7,23,21,7,23,21,7,23,21,7,39,55,39,53,55,39,53,55,39,53,
+55,39,53,3,168,1,48,177,179,254,208,174,175,254,208,179,177,1,47,178,147,
+1,2,150,149,254,254,148,147,254,254,150,149,1,2,148,152,78,68,68,68,68,68,
+119,76,82,67,67,67,67,67,114,2,72,78,68,68,68,68,68,119,76,82,67,67,67,67,
+67,114,249,71,80,70,68,68,68,68,68,68,113,75,75,67,67,67,67,67,67,67,5,14,
+177,254,209,177,176,254,205,174,174,1,51,176,176,1,48,177,251,68,149,1,2,
+148,147,1,2,150,149,254,254,148,147,254,254,150,3,108,77,66,72,67,66,71,68,
+68,71,117,72,82,65,72,67,68,72,65,68,72,114,74,77,66,72,67,66,71,68,68,71,
+117,72,82,65,72,67,68,72,65,68,72,114,103,72,78,65,72,68,65,72,68,65,72,67,
+68,72,110,72,75,66,72,67,68,71,66,67,72,66,67,72,0,0,8,0,102,255,119,5,94,
+6,82,0,50,0,62,0,74,0,86,0,99,0,110,0,120,0,130,0,0,1,38,38,53,52,54,51,50,
+22,23,54,51,50,18,17,20,2,7,22,21,20,7,22,23,7,38,39,6,7,39,54,55,38,53,52,
+55,38,39,6,35,34,38,53,52,54,55,38,38,53,52,54,0,18,53,52,2,35,34,2,21,20,
+18,51,18,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,
+51,37,55,38,53,52,55,38,35,34,6,21,20,22,19,51,54,55,38,35,34,6,21,20,22,
+19,38,39,6,6,21,20,22,51,50,5,54,53,52,38,35,34,6,21,20,1,145,71,66,132,102,
+85,163,65,75,75,169,244,150,124,18,78,82,138,37,160,102,106,157,36,123,94,
+76,16,41,24,125,123,103,131,79,63,135,177,162,3,57,183,183,128,128,184,183,
+129,106,137,138,105,106,138,137,107,57,84,84,57,58,84,84,58,254,32,70,4,16,
+60,22,115,161,159,222,2,45,96,110,121,56,75,125,192,82,33,83,111,76,55,84,
+1,115,55,29,26,26,30,4,164,54,129,56,84,107,60,51,43,254,131,254,244,215,
+254,184,69,32,40,82,78,51,49,94,61,70,71,60,94,46,54,74,86,38,34,26,23,70,
+107,84,68,133,40,12,140,92,91,135,252,208,1,65,226,226,1,65,254,190,225,225,
+254,190,3,127,202,146,147,201,202,146,149,199,253,174,143,103,103,143,142,
+104,103,143,144,4,33,65,96,86,9,86,62,61,84,1,129,154,102,76,48,41,63,140,
+252,216,116,156,42,132,55,42,46,254,53,47,19,22,22,19,50,0,4,0,102,255,121,
+5,102,6,76,0,29,0,43,0,52,0,61,0,0,1,33,21,33,21,33,21,16,2,35,34,0,53,16,
+1,38,53,52,54,51,50,23,54,55,23,4,7,22,23,33,37,39,6,35,34,39,6,17,20,22,
+51,50,18,17,1,54,55,38,35,34,6,21,20,5,38,39,6,7,22,51,50,54,4,244,254,200,
+1,56,254,200,176,188,221,254,243,1,2,71,240,133,188,59,210,235,28,254,251,
+191,21,5,1,56,254,98,2,115,151,74,68,239,207,180,139,123,254,94,158,223,45,
+110,90,181,1,201,5,7,183,123,28,28,87,106,3,25,146,102,31,254,180,254,195,
+1,54,247,1,82,1,4,82,125,134,251,246,87,69,99,75,84,120,249,25,47,43,32,229,
+254,207,208,247,1,6,1,56,2,37,129,104,186,189,93,83,69,101,43,89,98,6,26,
+0,3,0,102,255,109,4,41,6,39,0,50,0,58,0,67,0,0,19,54,55,53,52,38,39,53,55,
+39,53,55,54,54,53,53,38,38,53,52,54,51,50,22,23,50,55,23,6,35,21,20,7,23,
+21,7,22,22,21,21,22,22,21,20,6,35,34,38,39,6,7,37,18,51,50,54,53,52,38,3,
+38,38,35,34,6,21,20,22,102,181,249,102,135,221,221,81,79,77,177,195,108,86,
+127,142,10,220,196,16,189,241,174,231,225,81,87,174,199,107,88,122,149,10,
+247,166,2,4,16,162,40,52,146,229,8,92,76,40,52,145,1,41,24,5,24,51,91,73,
+72,70,84,71,45,42,85,49,19,11,158,120,83,101,187,184,29,103,28,23,139,104,
+95,71,84,53,111,72,26,11,155,121,82,102,181,189,6,22,26,254,246,44,38,75,
+100,3,226,136,131,44,38,75,102,0,0,3,0,102,255,139,4,195,6,102,0,82,0,94,
+0,106,0,0,1,55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,23,54,54,51,50,22,
+23,7,38,38,35,34,6,21,21,23,22,18,21,16,7,22,22,51,50,54,55,23,6,6,35,34,
+38,39,6,35,34,38,39,55,22,22,51,50,55,39,55,23,54,55,39,55,23,55,53,39,7,
+39,55,38,39,7,39,55,38,39,7,38,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,
+6,35,34,38,53,52,54,51,1,211,143,88,98,89,130,16,94,25,188,134,43,47,10,160,
+109,97,150,23,98,14,97,61,71,106,2,128,167,147,4,105,67,67,97,10,103,18,157,
+102,92,152,24,68,76,89,156,41,90,28,103,65,86,64,156,56,163,31,21,207,8,213,
+2,4,211,10,211,19,10,193,28,188,27,34,150,137,43,43,29,29,40,40,29,91,43,
+43,29,29,41,41,29,4,94,92,88,129,92,44,40,37,64,57,133,191,15,105,147,125,
+92,20,59,76,102,74,13,14,91,254,115,222,254,191,152,69,95,85,62,16,102,132,
+114,89,33,95,81,45,54,64,57,106,84,110,53,94,27,100,26,40,42,67,26,100,24,
+97,33,60,96,60,61,53,96,121,43,29,29,40,40,29,29,43,253,55,42,29,29,41,41,
+29,29,42,0,0,1,0,102,255,131,4,102,5,233,0,78,0,0,1,22,22,51,50,54,53,53,
+6,6,35,34,38,53,53,51,21,20,22,51,50,54,53,53,52,54,51,50,22,21,35,52,38,
+35,34,6,21,17,20,2,35,34,39,55,22,51,50,54,55,6,35,34,38,39,55,22,51,50,54,
+53,6,6,35,34,38,39,55,22,22,51,50,54,53,6,6,35,34,38,39,1,4,40,122,72,79,
+95,29,95,52,114,165,102,104,73,72,104,121,108,95,134,102,75,52,61,66,224,
+188,151,105,58,82,116,109,155,29,90,172,67,145,42,58,79,140,114,146,35,121,
+57,87,159,55,75,41,115,60,99,120,22,90,69,93,167,55,3,86,71,81,103,82,31,
+39,39,162,116,62,62,72,104,104,72,123,133,139,134,95,52,75,87,83,252,141,
+227,255,0,72,86,56,124,118,86,44,30,82,53,129,92,35,49,67,62,67,43,51,107,
+86,25,43,108,95,0,0,1,0,102,255,236,3,86,4,94,0,18,0,0,1,6,2,6,7,6,6,7,39,
+54,18,19,51,6,2,7,54,18,19,3,86,7,97,204,171,28,97,78,70,130,95,3,102,2,12,
+19,178,168,7,4,94,246,254,233,189,60,117,175,72,73,123,1,143,2,31,208,254,
+191,124,78,1,26,1,37,0,6,0,102,255,117,4,45,6,90,0,27,0,44,0,52,0,56,0,60,
+0,68,0,0,5,54,55,0,17,16,1,38,39,55,22,23,54,55,23,6,7,0,17,16,1,22,23,7,
+38,39,6,7,3,22,51,50,54,55,54,53,52,39,6,35,34,39,6,21,20,1,6,7,22,51,50,
+55,38,1,33,21,33,5,33,53,33,1,22,23,54,55,6,35,34,1,8,144,84,254,122,1,134,
+99,129,45,155,122,118,158,45,125,102,1,133,254,123,89,138,45,160,116,121,
+156,63,150,194,87,176,73,41,113,121,149,148,121,110,1,125,122,85,93,116,112,
+93,85,254,224,1,78,254,178,1,78,254,178,1,78,254,116,86,142,154,73,104,119,
+128,45,67,50,1,25,1,134,1,133,1,25,59,60,94,73,76,75,74,94,57,62,254,229,
+254,125,254,124,254,229,54,63,94,75,72,73,74,2,149,139,70,69,96,125,191,162,
+76,76,164,189,125,2,222,84,92,54,54,92,254,159,102,242,103,254,170,102,97,
+111,88,51,0,9,0,102,255,137,6,20,6,47,0,55,0,58,0,61,0,64,0,67,0,70,0,73,
+0,76,0,79,0,0,1,53,7,35,3,3,35,3,53,33,53,52,54,51,50,22,21,35,52,38,35,34,
+6,21,21,33,21,3,35,3,3,35,39,21,33,21,3,35,3,3,35,39,17,33,21,33,53,33,17,
+7,35,3,3,35,3,53,5,35,23,19,35,23,37,35,23,1,55,35,5,55,35,1,55,35,5,55,35,
+1,35,23,3,10,63,72,151,144,72,174,2,164,160,137,137,156,102,101,90,89,105,
+2,163,174,71,146,149,72,63,2,163,174,71,146,149,72,63,1,24,253,105,1,24,63,
+72,151,144,72,174,3,179,134,64,70,134,64,1,180,133,64,251,247,64,133,1,180,
+63,133,254,215,64,133,1,180,63,133,3,37,133,64,2,94,252,135,1,6,254,250,1,
+49,62,124,173,196,202,175,125,150,142,125,124,62,254,207,1,6,254,250,135,
+252,61,254,207,1,6,254,250,135,254,121,103,103,1,135,135,1,6,254,250,1,49,
+61,102,119,2,90,119,119,119,254,29,119,119,119,1,108,119,119,119,254,29,119,
+0,5,0,102,255,145,3,223,6,53,0,22,0,27,0,32,0,37,0,42,0,0,0,0,21,20,6,7,21,
+33,17,33,17,35,17,33,53,33,53,38,38,53,52,0,51,7,6,6,7,33,33,38,38,39,17,
+17,54,54,55,33,33,22,22,23,17,2,219,1,4,224,169,1,64,254,192,102,1,63,254,
+193,168,226,1,7,182,51,114,161,14,1,33,1,133,16,159,112,111,159,17,254,225,
+254,123,16,161,110,6,53,254,251,183,167,255,21,65,254,100,254,176,1,183,207,
+167,20,253,170,184,1,4,106,18,162,111,111,162,18,254,221,254,125,16,163,106,
+109,160,16,1,29,0,1,0,102,0,0,4,254,5,61,0,23,0,0,1,33,17,35,17,33,23,7,5,
+5,7,5,1,23,5,39,37,37,53,37,37,55,37,39,1,166,3,88,102,253,157,203,20,254,
+202,1,41,14,254,74,2,6,2,253,168,17,1,150,254,22,1,207,254,219,23,1,72,236,
+5,61,250,195,4,215,199,67,115,203,67,137,254,243,71,111,102,74,254,72,145,
+201,70,118,240,0,0,3,0,102,255,123,4,193,6,49,0,19,0,33,0,40,0,0,23,33,17,
+33,53,33,21,33,21,4,0,17,20,2,4,7,21,33,21,33,1,21,22,22,21,20,6,7,21,54,
+0,53,52,0,7,17,54,54,53,52,38,102,1,119,254,137,3,86,254,136,1,14,1,111,166,
+254,215,174,1,120,252,170,1,222,159,224,221,162,225,1,53,254,203,225,118,
+162,163,31,5,234,102,102,72,21,254,114,254,245,175,254,206,191,12,72,102,
+5,162,154,18,245,167,166,246,18,152,18,1,81,227,226,1,82,236,253,114,18,184,
+124,123,187,0,9,0,102,254,231,4,41,6,166,0,43,0,50,0,57,0,65,0,73,0,85,0,
+97,0,109,0,121,0,0,1,53,34,39,55,22,51,54,54,51,50,22,21,20,6,7,21,22,22,
+21,20,6,7,21,22,23,7,38,39,6,6,35,34,38,53,52,54,55,53,38,38,53,52,54,5,17,
+54,54,53,52,38,3,17,6,6,21,20,22,19,6,6,21,20,22,51,50,19,54,54,53,52,38,
+35,34,2,22,21,20,6,35,34,38,53,52,54,51,22,22,21,20,6,35,34,38,53,52,54,51,
+36,22,21,20,6,35,34,38,53,52,54,51,22,22,21,20,6,35,34,38,53,52,54,51,2,20,
+241,189,17,191,222,10,149,122,88,107,197,176,167,226,226,167,250,180,16,167,
+249,10,143,126,88,106,199,173,167,224,225,1,13,127,164,168,226,120,168,165,
+121,124,144,52,40,160,121,124,146,52,40,162,207,37,37,26,26,38,38,26,26,37,
+37,26,26,38,38,26,1,102,37,37,26,26,38,38,26,26,37,37,26,26,38,38,26,4,127,
+78,28,103,29,189,182,102,82,121,157,11,78,19,255,166,170,251,20,77,5,24,103,
+23,6,184,187,103,82,120,157,9,80,20,250,171,169,253,84,253,92,19,193,126,
+126,194,253,110,2,164,18,192,128,129,191,254,209,9,100,75,38,44,5,231,9,101,
+75,38,43,253,78,37,26,26,38,38,26,26,37,211,37,26,26,38,38,26,26,37,142,38,
+26,26,37,37,26,26,38,211,38,26,26,37,37,26,26,38,0,2,0,102,255,231,4,246,
+5,49,0,6,0,10,0,0,23,39,1,51,1,7,1,3,9,2,160,58,2,35,72,2,37,60,253,244,2,
+254,121,1,137,1,139,25,41,5,33,250,223,41,1,154,2,252,252,86,1,47,254,203,
+0,2,0,102,255,236,3,131,5,205,0,26,0,40,0,0,1,51,50,22,21,20,6,35,34,0,17,
+52,18,55,55,54,54,51,50,22,21,20,6,7,6,21,20,3,52,55,38,53,52,55,6,6,21,20,
+18,23,39,2,121,10,72,102,103,71,229,254,200,207,242,22,45,125,66,47,43,102,
+146,55,127,63,38,38,176,151,143,123,2,1,72,102,72,74,100,1,116,1,0,251,1,
+39,87,6,112,126,57,43,49,111,58,184,240,217,254,140,81,54,207,247,216,163,
+73,230,211,161,254,253,65,16,0,4,0,102,255,236,6,78,5,178,0,32,0,43,0,54,
+0,60,0,0,1,1,7,1,17,23,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+54,51,50,23,55,17,1,39,1,19,22,22,51,50,54,53,52,38,35,34,5,38,35,34,6,21,
+20,22,51,50,54,19,22,23,54,55,39,3,125,1,207,74,254,139,219,71,67,147,201,
+200,148,111,189,110,108,194,103,148,201,203,146,59,76,221,254,139,74,1,207,
+111,93,149,90,104,141,139,110,154,254,182,174,153,104,142,143,103,81,140,
+18,91,77,93,73,166,5,178,254,49,73,1,116,253,150,221,20,143,105,103,144,75,
+101,98,78,143,104,105,143,20,221,2,106,254,140,73,1,207,251,49,84,61,82,63,
+60,86,146,146,85,61,63,82,54,1,20,47,68,77,38,168,0,6,0,184,255,141,4,125,
+6,29,0,3,0,7,0,19,0,31,0,43,0,55,0,0,19,33,17,33,55,33,17,33,4,22,21,20,6,
+35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,
+34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,184,3,197,252,59,103,
+2,248,253,8,1,162,53,54,38,39,52,52,39,40,52,54,38,39,52,52,39,39,53,54,38,
+39,52,52,39,39,53,54,38,39,52,52,39,6,29,249,112,103,5,194,84,53,39,38,52,
+52,38,38,54,254,138,55,38,38,52,52,38,39,54,254,137,53,39,39,52,52,39,38,
+54,254,137,53,39,38,52,52,38,38,54,0,0,4,0,102,255,92,7,131,6,201,0,39,0,
+51,0,56,0,61,0,0,1,33,54,54,51,50,22,21,20,6,35,34,38,39,33,22,17,7,33,17,
+33,7,22,22,21,35,52,38,38,35,7,6,7,39,36,0,53,52,2,39,4,54,53,52,38,35,34,
+6,21,20,22,51,1,6,7,33,53,37,6,7,33,53,1,242,3,92,18,158,104,118,167,167,
+118,104,158,18,253,26,158,2,2,64,252,251,38,154,130,102,37,92,88,64,117,157,
+62,1,43,1,15,98,115,4,231,107,107,76,74,108,107,75,252,82,35,18,2,90,254,
+27,11,14,1,254,5,223,101,133,167,118,118,167,134,100,243,254,253,55,253,241,
+51,7,177,246,159,116,55,6,117,113,82,216,1,175,240,117,1,9,169,180,106,76,
+74,108,107,75,75,107,253,26,79,29,108,213,65,45,110,0,0,10,0,102,255,2,6,
+49,6,199,0,39,0,52,0,62,0,72,0,82,0,94,0,106,0,118,0,130,0,142,0,0,1,54,51,
+50,22,21,20,6,35,34,39,1,39,1,39,6,35,34,38,53,52,54,51,50,23,55,1,55,1,54,
+51,50,22,21,20,6,35,34,39,7,19,3,19,1,7,19,3,7,23,22,19,3,23,1,22,51,50,54,
+53,52,38,35,34,19,34,7,22,51,50,54,53,52,38,1,38,35,34,6,21,20,22,51,50,0,
+22,21,20,6,35,34,38,53,52,54,51,6,22,21,20,6,35,34,38,53,52,54,51,18,22,21,
+20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,54,22,21,20,
+6,35,34,38,53,52,54,51,4,182,123,82,82,92,97,81,109,112,252,145,55,1,100,
+159,81,94,77,95,94,80,90,83,159,254,156,55,3,111,112,109,81,97,91,83,85,120,
+188,102,233,233,253,137,4,242,168,43,10,5,196,242,4,3,17,67,61,40,41,36,36,
+55,53,61,72,78,57,35,37,36,251,216,56,51,34,37,40,29,50,2,49,35,35,23,23,
+32,32,23,108,34,34,23,23,32,32,23,58,34,34,23,23,32,32,23,23,34,34,23,23,
+32,32,23,119,35,35,23,23,32,32,23,1,254,72,93,71,73,83,117,253,135,47,2,111,
+243,79,91,70,72,86,78,244,2,111,47,253,135,117,83,73,71,93,70,228,254,228,
+1,28,1,27,1,203,4,254,98,254,250,64,12,7,254,208,254,98,4,1,178,67,30,23,
+26,35,2,125,69,46,36,26,21,30,254,139,56,31,25,26,33,1,72,35,23,23,32,32,
+23,23,35,213,35,23,23,32,32,23,23,35,1,174,35,23,23,32,32,23,23,35,252,164,
+33,23,23,34,34,23,23,33,217,33,23,23,34,34,23,23,33,0,0,4,0,102,255,45,7,
+129,6,43,0,71,0,83,0,93,0,103,0,0,1,2,2,35,34,6,17,22,22,21,20,6,7,2,2,35,
+34,2,3,38,38,53,52,55,55,22,22,23,54,54,55,23,22,21,20,6,7,18,18,51,50,54,
+19,38,38,53,52,54,55,16,18,51,50,18,19,22,22,21,20,7,7,38,38,39,6,6,7,39,
+38,53,52,54,0,54,53,52,38,35,34,6,21,20,22,51,37,38,38,39,6,6,7,54,55,22,
+1,22,22,23,54,54,55,6,7,38,6,47,7,143,122,122,126,90,113,114,89,4,179,167,
+177,195,5,111,123,9,69,40,120,49,54,119,36,70,8,126,112,7,145,123,117,127,
+4,88,113,112,89,176,174,174,195,8,109,124,8,70,39,125,45,51,119,39,69,8,123,
+254,117,87,86,65,61,89,89,61,3,39,10,98,77,78,98,8,64,120,121,249,242,9,95,
+80,78,97,9,62,122,120,3,102,1,45,1,50,241,254,249,23,165,105,104,167,20,254,
+188,254,236,1,111,1,86,58,226,150,65,58,16,64,109,21,24,111,59,16,51,72,146,
+232,58,254,210,254,209,223,1,19,20,165,106,107,164,22,1,61,1,33,254,151,254,
+164,57,228,149,72,51,16,63,114,18,23,111,61,16,51,72,146,229,254,186,114,
+81,78,119,117,80,80,115,2,94,157,44,39,159,97,61,54,56,1,79,97,154,44,40,
+156,99,59,56,54,0,5,0,102,255,162,3,184,6,39,0,75,0,87,0,99,0,111,0,123,0,
+0,19,51,54,55,39,55,23,54,55,53,51,21,22,23,55,23,7,22,23,51,21,35,6,7,23,
+7,39,6,7,17,22,23,55,23,7,22,23,51,21,35,6,7,23,7,39,6,7,21,35,53,38,39,7,
+39,55,38,39,35,53,51,54,55,39,55,23,54,55,17,38,39,7,39,55,38,39,35,4,54,
+53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,18,22,21,
+20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,102,168,17,22,
+119,74,119,43,49,103,46,46,121,73,121,28,9,172,172,9,28,121,73,121,36,56,
+46,46,121,73,121,28,9,172,172,9,28,121,73,121,36,56,103,44,48,119,74,119,
+23,16,168,168,17,22,119,74,119,43,49,44,48,119,74,119,23,16,168,1,233,93,
+93,65,64,93,93,64,65,93,92,66,65,92,93,64,26,38,38,26,26,37,37,26,26,38,38,
+26,26,37,37,26,4,176,60,32,121,74,121,27,10,172,172,9,28,121,74,121,41,51,
+102,51,41,121,74,121,25,14,254,203,9,28,121,74,121,43,49,102,51,42,120,74,
+121,25,14,168,168,9,28,119,74,118,37,58,102,60,32,121,74,121,27,10,1,53,9,
+28,119,74,119,34,60,107,93,65,65,93,92,66,65,93,252,205,93,65,64,93,93,64,
+65,93,4,16,37,26,26,38,38,26,26,37,252,205,37,26,26,38,38,26,26,37,0,6,0,
+102,255,236,5,188,5,66,0,15,0,46,0,56,0,66,0,76,0,86,0,0,0,4,18,21,20,2,4,
+35,34,36,2,53,52,18,36,51,5,6,7,22,22,21,20,6,7,22,23,54,54,51,50,22,23,55,
+38,38,53,52,54,55,38,39,6,6,35,34,38,3,54,54,53,52,38,39,6,21,20,1,38,38,
+35,34,6,7,22,51,50,1,6,6,21,20,22,23,54,53,52,1,22,22,51,50,54,55,38,35,34,
+3,199,1,60,185,181,254,193,184,187,254,196,179,182,1,61,183,254,131,25,30,
+84,94,96,84,30,25,69,197,117,115,199,69,54,82,95,97,82,32,24,68,197,116,115,
+198,188,63,76,74,63,82,3,110,54,154,91,92,153,54,133,166,164,1,78,62,73,72,
+63,84,252,145,54,154,91,91,152,54,139,160,157,5,66,181,254,193,184,183,254,
+197,184,185,1,60,181,182,1,63,183,246,22,34,68,197,115,116,198,69,34,22,84,
+94,96,84,56,68,197,118,114,197,69,36,20,82,94,96,253,112,54,155,93,91,154,
+54,135,166,163,254,177,62,75,74,63,82,3,108,54,151,91,91,155,54,139,161,160,
+1,83,63,74,72,63,84,0,2,0,102,1,180,5,125,3,242,0,21,0,36,0,0,18,38,53,52,
+18,36,51,50,4,18,21,20,6,35,34,38,38,35,34,6,6,35,37,23,55,38,36,35,34,4,
+7,23,54,36,51,50,4,144,42,193,1,33,170,170,1,32,193,42,34,42,203,241,89,89,
+243,202,42,4,37,39,4,78,254,225,163,165,254,227,79,4,119,1,33,117,89,1,9,
+1,180,47,29,68,1,13,161,159,254,240,67,29,47,170,84,85,169,169,32,2,142,190,
+191,141,2,111,109,80,0,4,0,102,255,25,4,246,6,186,0,11,0,18,0,25,0,29,0,0,
+1,1,23,1,1,7,1,1,39,1,1,55,1,23,9,2,19,55,19,7,35,39,3,9,2,39,7,23,2,174,
+2,12,60,254,121,1,135,60,253,244,253,242,58,1,134,254,122,58,2,49,102,1,2,
+254,117,254,119,254,102,174,102,72,102,254,1,137,1,139,254,197,82,82,82,5,
+33,1,153,41,252,88,252,89,41,1,153,254,103,41,3,167,3,168,41,253,168,243,
+2,102,254,203,1,47,253,158,245,254,2,243,245,253,158,1,47,254,203,2,235,197,
+197,196,0,15,0,102,255,94,7,70,6,47,0,45,0,49,0,61,0,69,0,77,0,81,0,85,0,
+92,0,99,0,105,0,110,0,114,0,118,0,123,0,128,0,0,37,1,35,1,53,55,6,35,34,38,
+38,53,52,18,55,23,6,21,20,22,23,38,53,52,54,51,50,22,21,20,7,36,53,52,39,
+55,22,18,21,20,6,6,35,34,39,23,9,3,0,54,53,52,38,35,34,6,21,20,22,51,7,38,
+39,5,22,51,50,54,5,37,6,7,22,22,51,50,37,22,23,55,5,54,55,39,19,38,39,22,
+21,21,7,37,52,55,6,7,23,39,7,55,38,39,6,21,33,52,39,7,23,5,38,39,7,37,6,7,
+23,19,6,6,7,23,37,38,38,39,7,5,94,254,158,72,254,158,108,36,35,142,244,143,
+217,189,53,92,161,161,17,119,88,86,123,19,1,68,92,53,190,216,143,245,141,
+31,42,114,254,121,1,31,254,225,254,225,1,73,62,59,47,45,59,61,43,68,66,77,
+254,231,64,78,90,154,2,88,254,231,65,78,37,153,92,73,251,118,54,105,62,4,
+72,105,54,221,217,59,98,38,2,251,52,39,102,56,121,2,158,113,53,48,16,6,18,
+16,101,113,251,197,68,51,45,3,135,45,74,164,115,11,26,37,189,251,61,39,27,
+8,114,233,254,117,1,139,72,137,6,147,253,139,205,1,66,81,47,230,130,123,170,
+41,43,53,99,141,138,102,55,41,83,251,132,228,47,82,254,190,204,139,253,147,
+6,137,254,160,1,63,1,95,254,163,2,17,78,57,54,83,81,56,58,77,88,3,13,172,
+20,95,75,172,10,6,80,96,254,121,68,207,207,68,121,18,1,125,129,82,132,95,
+28,28,41,121,121,82,129,72,21,223,137,27,32,62,77,77,62,59,137,154,22,35,
+155,155,33,24,98,1,92,26,43,50,21,21,52,48,19,140,0,12,0,102,255,117,4,45,
+6,90,0,27,0,36,0,42,0,48,0,54,0,59,0,65,0,70,0,75,0,80,0,85,0,90,0,0,5,54,
+55,0,17,16,1,38,39,55,22,23,54,55,23,6,7,0,17,16,1,22,23,7,38,39,6,7,1,54,
+53,52,39,6,21,20,22,19,6,7,23,55,38,3,54,55,39,7,22,3,54,55,39,6,7,5,55,38,
+39,7,3,38,39,7,22,23,37,7,23,54,55,1,55,39,6,7,5,7,23,54,55,39,23,51,38,39,
+1,39,35,22,23,1,8,144,84,254,122,1,134,99,129,45,155,122,118,158,45,125,102,
+1,133,254,123,89,138,45,160,116,121,156,1,21,61,61,62,30,32,58,55,113,110,
+20,90,58,52,110,111,44,48,22,13,111,60,48,1,157,183,42,67,108,160,7,28,182,
+38,70,1,47,34,108,63,44,254,55,10,190,31,6,2,29,11,189,29,10,228,11,217,12,
+25,254,16,8,217,6,31,45,67,50,1,25,1,134,1,133,1,25,59,60,94,73,76,75,74,
+94,57,62,254,229,254,125,254,124,254,229,54,63,94,75,72,73,74,2,172,85,111,
+108,91,90,109,61,91,2,251,38,48,197,197,18,251,129,40,44,195,197,39,3,2,38,
+17,193,62,79,107,105,70,73,190,253,243,9,49,107,66,75,246,56,190,65,76,1,
+107,55,110,75,90,103,57,111,77,91,158,55,101,64,254,187,57,90,78,0,0,4,0,
+102,255,236,6,63,5,37,0,44,0,56,0,68,0,80,0,0,0,22,21,20,6,35,34,39,6,7,22,
+21,20,6,35,34,38,53,52,54,55,38,39,6,35,34,38,53,52,54,51,50,22,21,20,7,22,
+23,54,55,38,53,52,54,51,1,6,6,21,20,22,51,50,54,53,52,38,0,54,53,52,38,35,
+34,6,21,20,22,51,32,54,53,52,38,35,34,6,21,20,22,51,5,163,156,158,112,114,
+78,138,71,180,147,101,113,153,82,94,71,136,78,114,112,157,155,114,112,158,
+23,136,94,60,173,20,155,113,254,33,69,85,92,72,61,85,87,254,35,97,97,71,70,
+96,96,70,4,5,97,97,71,70,96,96,70,5,37,159,111,113,156,78,89,54,175,229,144,
+185,180,149,113,197,94,55,88,78,157,112,111,159,157,113,56,51,85,73,48,112,
+42,63,110,160,253,94,66,162,106,101,126,129,98,106,162,1,48,99,67,67,100,
+99,68,69,97,99,67,67,100,99,68,69,97,0,7,0,102,255,211,6,201,5,201,0,14,0,
+19,0,22,0,25,0,28,0,31,0,34,0,0,1,55,1,1,23,3,1,7,33,3,35,3,33,39,1,19,33,
+55,39,7,1,5,23,3,19,35,1,19,55,1,33,39,5,37,7,1,104,54,1,235,1,230,57,178,
+1,211,21,253,199,172,70,200,253,190,25,1,201,219,1,37,78,242,223,2,90,254,
+223,185,244,102,225,254,221,121,172,254,27,1,78,70,3,137,254,248,57,5,152,
+45,254,172,1,88,39,253,211,254,192,65,253,223,2,33,65,1,70,254,223,242,166,
+158,1,172,207,127,252,254,1,68,3,8,254,188,121,254,41,189,189,180,180,0,0,
+7,0,102,255,248,5,90,5,0,0,11,0,23,0,37,0,51,0,63,0,75,0,89,0,0,0,22,21,20,
+6,35,34,38,53,52,54,51,22,54,53,52,38,35,34,6,21,20,22,51,1,38,36,35,34,4,
+7,39,54,36,51,50,4,23,1,54,54,53,52,38,39,55,22,22,21,20,6,7,0,38,53,52,54,
+51,50,22,21,20,6,35,38,6,21,20,22,51,50,54,53,52,38,35,3,38,38,53,52,54,55,
+23,6,6,21,20,22,23,1,40,81,81,56,57,81,80,58,14,20,20,14,14,21,21,14,4,0,
+95,254,231,153,153,254,234,95,82,105,1,64,183,181,1,66,108,252,40,81,96,93,
+90,66,104,115,116,97,2,238,82,82,55,55,82,82,55,14,21,21,14,14,21,21,14,189,
+97,116,115,105,65,91,91,96,80,2,78,80,57,57,81,81,57,56,81,172,21,14,14,20,
+20,14,14,21,1,233,129,142,142,129,62,145,166,165,146,252,125,66,193,115,109,
+198,74,78,84,239,136,139,233,80,1,67,79,59,58,79,79,58,59,79,172,20,14,14,
+21,21,14,14,20,254,17,80,233,139,134,241,84,78,75,198,108,115,193,66,0,0,
+4,0,102,255,147,4,229,6,117,0,95,0,101,0,109,0,119,0,0,1,23,54,51,50,23,55,
+23,7,22,21,7,55,23,7,6,6,21,20,22,23,55,23,7,23,55,23,7,23,55,23,7,22,21,
+21,23,7,39,6,7,23,7,39,7,23,7,39,6,7,23,7,39,35,39,7,39,55,39,7,39,55,38,
+39,7,39,55,38,39,7,39,55,52,55,39,55,23,54,55,39,55,23,54,55,39,55,23,55,
+39,55,23,55,39,55,23,55,39,3,17,6,2,21,20,1,17,54,54,53,52,38,39,3,21,54,
+54,53,52,38,35,34,6,2,227,47,14,17,23,18,121,70,101,21,6,116,25,254,34,34,
+24,17,228,57,231,45,223,45,221,39,209,22,201,11,204,4,213,6,8,195,50,192,
+29,146,78,148,34,21,59,98,63,31,25,57,98,55,59,158,78,154,20,17,193,49,205,
+6,6,215,9,220,6,215,4,227,15,6,209,45,192,22,7,186,61,166,43,156,62,143,49,
+127,78,113,26,53,14,70,133,1,49,92,125,61,101,55,25,112,21,26,34,56,6,117,
+131,4,4,110,73,93,29,46,37,30,98,67,10,28,24,17,46,31,141,86,145,82,113,91,
+112,90,51,103,47,53,37,10,4,102,4,31,23,110,90,108,39,159,70,164,20,7,205,
+28,215,2,226,25,219,23,174,69,168,18,31,110,90,117,20,41,25,103,24,45,52,
+20,103,23,73,21,101,90,92,66,15,136,82,119,92,115,82,105,80,143,66,129,26,
+150,250,139,3,219,130,254,125,183,249,2,247,252,223,12,169,122,69,167,168,
+1,141,47,26,47,37,13,24,58,0,0,10,0,102,255,123,7,43,6,63,0,11,0,18,0,30,
+0,37,0,44,0,51,0,58,0,65,0,72,0,79,0,0,0,22,21,20,6,35,34,38,53,52,54,51,
+39,19,51,19,7,39,7,18,54,53,52,38,35,34,6,21,20,22,51,7,23,55,23,3,35,3,3,
+1,55,1,7,39,23,1,23,39,55,1,7,1,17,1,23,1,39,55,7,1,7,55,23,1,39,1,39,37,
+53,37,23,7,23,33,55,39,55,5,21,5,4,30,117,118,84,84,119,119,84,131,100,63,
+101,103,30,29,71,58,59,41,43,58,59,42,29,29,30,103,101,63,100,215,254,223,
+45,1,174,64,180,140,1,233,178,137,82,1,31,45,254,81,1,175,45,254,225,82,137,
+178,254,23,140,180,64,254,82,45,1,33,13,254,4,1,252,13,226,226,2,180,225,
+225,12,1,252,254,4,3,168,121,82,83,120,119,84,84,119,156,1,251,254,5,13,226,
+226,254,66,58,42,40,61,61,40,41,59,246,225,225,12,254,4,1,252,2,6,1,174,45,
+254,225,82,138,179,254,23,139,180,63,254,82,45,1,33,2,180,1,33,45,254,82,
+63,181,140,254,23,178,137,82,254,225,45,1,174,29,100,64,100,102,31,28,28,
+31,102,100,64,100,0,4,0,102,255,184,4,219,6,51,0,50,0,57,0,64,0,69,0,0,1,
+7,22,22,21,20,6,7,21,33,21,33,17,38,38,35,34,6,21,21,35,53,52,54,51,50,22,
+23,54,54,51,50,22,21,21,35,53,52,38,35,34,6,21,21,50,22,21,20,6,7,23,1,21,
+54,54,53,52,38,3,21,54,54,53,52,38,3,35,21,51,55,4,86,252,75,73,175,139,2,
+39,253,115,4,107,82,83,109,103,162,133,81,125,38,37,125,82,133,162,103,108,
+84,86,107,133,181,69,75,248,254,94,96,115,121,90,91,120,116,91,4,2,244,2,
+115,113,25,93,54,88,117,4,102,103,5,62,99,116,119,98,35,35,142,177,71,60,
+60,71,178,141,35,35,97,120,123,100,76,125,84,54,92,26,107,1,129,213,6,61,
+40,41,61,253,138,213,4,62,40,40,61,1,69,219,113,0,9,0,102,255,156,5,135,6,
+70,0,5,0,20,0,27,0,34,0,41,0,45,0,49,0,53,0,56,0,0,1,1,21,33,53,1,19,54,54,
+55,3,33,3,22,22,23,54,54,51,50,22,1,33,38,38,35,34,6,5,33,39,38,35,34,6,37,
+7,33,38,38,35,34,19,33,39,33,55,33,39,33,55,51,39,35,55,51,39,3,25,2,110,
+250,223,2,107,235,34,103,62,125,253,223,125,60,105,34,34,103,60,62,103,254,
+203,1,35,6,84,57,54,84,1,134,1,30,96,18,21,59,86,253,73,96,1,27,6,88,56,19,
+187,1,211,26,254,98,39,1,80,27,254,229,39,205,26,152,39,74,37,6,70,249,157,
+71,71,6,99,250,141,71,85,2,1,71,254,185,3,86,71,72,88,87,254,232,113,151,
+151,113,252,12,152,142,254,113,151,2,21,69,103,69,103,71,103,96,0,2,0,98,
+255,215,4,250,5,199,0,75,0,87,0,0,1,23,55,51,23,55,23,7,23,55,23,7,22,23,
+55,23,7,22,23,55,23,7,22,21,23,7,39,7,23,7,39,6,7,23,7,39,6,7,23,7,39,35,
+7,39,55,38,39,7,39,55,38,39,7,39,55,38,39,7,39,55,52,55,39,55,23,54,55,39,
+55,23,55,39,55,23,55,39,0,2,3,2,2,21,20,22,51,50,54,53,1,168,141,84,72,84,
+143,70,162,41,186,54,199,22,15,192,45,206,15,9,219,17,219,6,221,12,215,15,
+199,53,185,20,19,144,74,147,21,33,39,102,39,72,37,102,39,33,22,146,74,144,
+21,18,184,54,199,3,11,215,13,221,7,220,17,219,15,8,205,45,190,37,196,53,184,
+43,162,2,84,119,145,141,123,138,126,124,140,5,174,127,152,152,127,78,145,
+88,119,86,125,49,46,97,90,105,48,44,43,100,45,41,37,35,102,34,67,123,86,115,
+36,22,158,69,160,13,14,190,21,188,188,21,190,12,15,160,69,158,27,31,115,86,
+123,11,52,30,102,33,33,51,41,102,43,69,23,103,90,97,95,125,86,117,86,145,
+253,96,1,105,1,12,255,0,254,144,136,150,173,171,152,0,0,11,0,102,255,172,
+6,219,6,33,0,89,0,92,0,95,0,107,0,119,0,131,0,143,0,155,0,167,0,179,0,191,
+0,0,1,23,39,55,23,39,39,55,7,39,55,7,39,55,7,39,19,23,7,55,23,7,55,23,7,55,
+23,7,55,39,55,23,55,23,7,23,39,55,23,39,55,23,39,55,23,39,55,19,7,39,23,7,
+39,23,7,39,23,7,7,55,23,7,55,23,7,55,23,5,39,55,7,39,55,7,39,55,39,7,23,7,
+39,23,7,39,23,7,37,55,23,39,1,23,55,7,55,7,18,22,21,20,6,35,34,38,53,52,54,
+51,22,54,53,52,38,35,34,6,21,20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,
+22,54,53,52,38,35,34,6,21,20,22,51,0,54,51,50,22,21,20,6,35,34,38,53,54,38,
+35,34,6,21,20,22,51,50,54,53,36,54,51,50,22,21,20,6,35,34,38,53,54,38,35,
+34,6,21,20,22,51,50,54,53,1,115,176,64,54,184,49,31,80,197,53,78,191,55,80,
+195,53,127,98,69,176,53,61,178,53,63,176,55,63,39,7,54,47,47,53,8,41,64,56,
+176,64,54,178,62,54,176,70,98,127,53,194,79,55,190,77,53,196,79,32,47,184,
+53,63,176,53,63,167,54,254,190,53,80,195,55,76,189,53,31,88,88,30,53,188,
+76,56,194,80,54,254,191,53,168,64,2,138,37,77,231,39,121,224,87,85,64,63,
+87,89,61,18,29,29,18,19,28,28,19,61,88,86,63,61,89,89,61,18,29,29,18,19,28,
+28,19,252,196,89,61,62,87,85,64,63,87,197,29,18,19,28,28,19,18,29,4,133,89,
+61,62,87,85,64,63,87,197,29,18,19,28,28,19,18,29,1,145,94,201,51,104,174,
+30,228,119,51,221,112,51,223,115,52,1,108,33,202,98,51,207,96,49,205,99,54,
+209,21,27,51,27,27,51,25,23,209,54,99,205,49,96,207,51,98,202,33,254,148,
+52,115,223,51,112,221,51,119,228,30,174,104,51,201,94,51,211,103,86,195,51,
+232,123,51,219,110,51,96,49,51,94,51,110,219,51,123,232,51,195,86,103,211,
+1,115,113,45,51,119,72,3,152,89,61,59,90,89,60,61,89,197,29,18,19,28,28,19,
+18,29,251,123,88,61,60,90,89,61,62,87,197,29,19,18,29,29,18,19,29,3,16,89,
+89,61,59,90,89,60,19,28,28,19,18,29,29,18,61,89,89,61,59,90,89,60,19,28,28,
+19,18,29,29,18,0,0,4,0,184,0,0,4,102,5,47,0,5,0,10,0,22,0,34,0,0,1,1,17,33,
+17,1,1,33,17,1,1,36,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,
+6,21,20,22,51,2,178,1,180,252,82,1,178,254,181,2,225,254,143,254,144,1,199,
+120,121,86,87,119,121,85,43,62,60,45,43,61,64,40,5,47,254,178,252,31,3,225,
+1,78,251,55,3,72,1,29,254,227,115,121,86,87,120,121,86,87,120,254,200,61,
+44,41,63,61,43,46,59,0,0,6,0,102,255,203,5,127,6,39,0,64,0,71,0,79,0,88,0,
+97,0,101,0,0,1,3,55,19,54,51,50,23,19,23,6,7,22,22,21,20,6,7,23,55,23,7,23,
+55,23,7,23,7,39,7,39,55,39,7,39,55,39,6,35,34,39,7,23,7,39,7,23,7,39,7,39,
+55,39,55,23,55,39,55,23,55,38,38,53,52,54,1,19,54,54,53,52,39,1,19,3,6,6,
+21,20,22,1,23,19,38,35,34,7,19,55,17,39,3,22,51,50,55,3,7,39,55,39,7,1,92,
+129,94,125,137,181,173,142,127,94,82,49,103,116,132,115,18,152,40,151,20,
+154,41,154,39,94,39,153,41,153,22,154,41,154,15,127,157,160,127,14,153,41,
+153,21,152,41,152,39,94,39,156,41,154,22,153,41,153,17,116,130,115,2,182,
+152,86,100,164,253,74,147,172,77,85,99,1,203,96,139,129,141,151,120,138,96,
+90,119,110,136,133,110,118,90,35,71,71,72,4,236,1,14,45,254,250,67,67,1,6,
+45,174,96,76,224,143,153,235,75,39,68,94,68,49,68,95,67,90,41,90,68,94,68,
+49,67,94,67,33,53,53,35,65,94,65,49,66,94,66,88,41,90,67,95,68,49,68,94,68,
+39,75,235,153,143,224,254,131,254,162,62,185,117,216,130,253,58,1,92,1,104,
+60,175,109,117,185,2,126,225,1,35,59,59,254,223,223,253,104,187,254,239,47,
+47,1,21,191,168,148,168,168,0,7,0,102,255,35,5,27,6,193,0,48,0,56,0,64,0,
+68,0,72,0,75,0,79,0,0,1,19,23,3,37,54,54,51,50,22,21,20,6,7,17,22,22,21,20,
+6,35,34,38,39,37,19,7,3,55,5,53,1,7,39,55,39,7,39,55,39,55,23,55,39,55,23,
+1,53,5,1,22,22,51,50,53,52,38,3,54,54,53,52,35,34,6,1,55,53,1,17,1,53,39,
+23,17,7,39,7,23,55,1,14,238,90,180,1,119,32,207,107,76,92,236,186,192,230,
+92,76,109,206,31,254,137,180,90,238,41,1,215,254,152,123,70,117,63,111,70,
+105,105,70,111,63,117,70,123,1,104,254,41,2,80,28,139,69,65,173,128,122,179,
+65,70,138,254,144,219,254,228,1,28,219,219,145,215,64,64,65,5,4,1,189,50,
+254,174,43,146,190,79,62,106,160,23,251,205,22,161,104,62,79,191,145,43,254,
+174,49,1,190,56,54,4,1,70,113,74,107,59,100,73,97,96,74,103,60,108,74,113,
+1,70,4,53,251,162,95,125,39,60,100,5,29,20,101,61,39,125,253,96,201,119,254,
+252,255,0,254,252,118,201,63,1,8,131,59,59,60,60,0,0,1,0,102,255,123,7,47,
+6,68,0,91,0,0,5,38,2,53,52,55,6,21,20,23,7,38,38,53,52,54,55,38,35,34,6,7,
+39,54,36,51,50,23,38,35,34,7,39,54,54,51,50,22,23,54,53,52,38,39,55,22,18,
+21,20,7,54,53,52,38,39,55,22,22,21,20,6,7,22,51,50,54,55,23,6,4,35,34,39,
+22,22,51,50,55,23,6,35,34,38,39,6,21,20,23,53,22,22,23,4,195,171,210,18,133,
+108,77,63,70,131,118,102,109,147,248,55,94,64,1,34,190,71,77,148,178,176,
+137,66,78,195,106,122,248,105,39,176,139,37,165,216,19,133,55,53,78,65,68,
+117,125,107,100,159,244,50,94,62,254,209,182,71,74,75,170,80,181,133,65,162,
+217,127,247,105,41,61,45,134,75,121,64,1,32,191,67,80,149,185,165,138,65,
+78,190,100,140,251,99,41,175,142,36,172,211,18,133,111,78,63,72,121,124,107,
+100,155,243,52,94,62,254,219,189,64,88,154,188,81,157,63,66,79,195,105,127,
+245,105,37,183,134,37,171,212,17,65,66,110,78,135,118,128,106,109,125,111,
+2,77,109,29,0,4,0,102,255,215,6,127,5,254,0,45,0,60,0,75,0,90,0,0,1,38,36,
+53,52,36,51,50,23,54,53,52,38,53,52,54,54,53,52,38,39,55,22,22,21,20,6,7,
+22,22,21,20,7,54,51,50,4,21,20,4,7,6,2,35,34,2,55,17,6,6,21,20,22,51,50,54,
+53,52,38,39,17,1,51,54,55,38,35,34,6,21,20,22,23,54,55,35,33,35,22,23,54,
+54,53,52,38,35,34,7,22,23,51,2,68,201,254,235,1,52,219,111,108,26,102,49,
+92,84,65,20,115,117,41,74,45,31,8,76,92,219,1,51,254,236,201,12,175,116,116,
+176,240,65,86,121,82,81,121,85,66,253,213,254,34,54,44,48,177,247,214,159,
+7,15,221,3,239,221,17,4,161,214,244,180,49,46,52,39,253,1,174,10,176,119,
+125,180,26,33,30,30,72,50,40,31,11,26,34,51,14,98,20,105,80,39,55,21,35,63,
+39,21,32,16,181,124,119,175,11,197,254,238,1,15,6,2,147,35,224,151,177,247,
+247,177,145,228,37,253,109,2,38,88,58,6,121,82,76,117,10,93,59,76,76,11,117,
+75,82,121,6,56,90,0,0,3,0,102,255,209,4,213,5,242,0,73,0,77,0,89,0,0,1,17,
+38,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,6,35,34,38,53,52,54,51,50,
+23,17,39,53,55,51,23,21,7,17,22,51,50,54,53,52,38,35,34,6,21,21,35,53,52,
+54,51,50,22,21,20,6,35,34,39,17,22,22,21,20,6,35,34,38,53,52,54,19,55,39,
+7,18,54,53,52,38,35,34,6,21,20,22,51,2,111,51,101,57,93,116,67,56,48,56,103,
+120,87,101,125,175,137,83,126,134,148,72,149,133,113,88,93,116,66,57,47,58,
+102,121,86,101,124,174,137,78,123,54,65,99,71,69,97,64,102,80,80,80,108,39,
+39,28,26,38,38,26,1,25,1,182,18,29,97,79,61,66,59,51,19,19,97,116,128,102,
+125,153,43,1,21,164,71,185,185,71,164,254,198,40,97,79,59,68,61,50,18,18,
+100,113,127,102,124,155,37,254,111,17,91,54,68,98,96,70,57,88,3,168,103,102,
+102,251,32,38,26,28,39,39,28,26,38,0,15,0,102,255,225,5,223,5,90,0,15,0,31,
+0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,86,0,89,0,92,0,95,0,0,0,4,
+18,21,20,2,4,35,34,36,2,53,52,18,36,51,18,36,18,53,52,2,36,35,34,4,2,21,20,
+18,4,51,1,17,51,5,3,53,33,21,3,37,51,17,35,37,19,21,33,53,19,5,1,39,35,7,
+1,55,53,39,1,23,51,55,1,7,21,23,1,35,23,51,17,35,7,51,1,53,39,21,33,53,7,
+21,39,35,23,3,51,39,39,21,55,5,53,7,3,222,1,69,188,188,254,189,189,188,254,
+187,188,187,1,71,187,160,1,22,160,161,254,235,160,160,254,235,161,161,1,22,
+159,254,22,37,1,160,92,1,2,94,1,161,37,37,254,95,94,254,254,92,254,96,2,17,
+15,123,14,254,147,64,64,1,109,14,123,15,1,108,63,63,254,121,100,14,72,72,
+14,100,254,199,64,2,143,63,242,47,25,25,47,22,215,125,1,49,125,5,90,187,254,
+187,188,189,254,187,187,187,1,69,189,188,1,68,188,250,238,161,1,22,159,159,
+1,23,160,159,254,233,160,160,254,234,160,1,213,1,2,94,1,161,37,37,254,95,
+94,254,254,92,254,96,37,37,1,160,92,254,200,64,64,1,109,14,123,14,1,109,63,
+63,254,147,16,121,14,1,147,63,253,240,64,1,37,70,14,101,101,14,70,250,125,
+254,207,125,114,49,25,25,47,22,0,3,0,102,255,227,4,213,5,201,0,42,0,53,0,
+64,0,0,1,5,53,38,37,55,4,23,53,16,51,50,22,21,20,6,35,34,39,21,5,7,37,21,
+22,22,23,7,36,39,21,16,35,34,38,53,52,54,51,50,23,53,37,1,22,51,50,54,53,
+52,38,35,34,21,3,53,38,35,34,6,21,20,22,51,50,1,104,1,2,193,254,189,54,1,
+19,187,240,106,134,144,131,59,43,1,35,33,254,254,87,224,205,53,254,210,161,
+240,105,134,143,131,48,54,254,222,1,137,48,54,82,90,76,61,137,103,50,52,82,
+90,76,61,137,3,125,92,172,61,193,90,167,69,56,1,88,146,112,136,151,10,182,
+105,98,92,174,28,107,119,90,177,59,56,254,168,145,113,136,151,10,184,105,
+1,0,13,98,87,68,87,241,252,202,86,13,98,87,68,87,0,0,1,0,102,255,211,4,221,
+6,0,0,23,0,0,55,1,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,
+34,39,1,102,2,68,73,91,134,163,168,139,110,69,36,93,122,185,224,224,175,46,
+67,253,228,4,3,236,27,127,98,103,125,27,94,35,182,148,145,182,10,252,90,0,
+2,0,102,0,0,6,66,4,233,0,46,0,58,0,0,1,23,53,51,21,55,23,7,33,17,35,17,35,
+17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,33,17,38,38,53,52,54,51,50,22,
+21,20,6,7,21,51,17,33,39,4,54,53,52,38,35,34,6,21,20,22,51,3,119,137,102,
+142,73,211,1,216,103,135,102,136,102,135,103,133,102,254,194,59,72,104,77,
+75,105,71,56,215,1,213,207,254,14,45,45,32,32,46,46,32,4,178,141,196,198,
+143,69,215,252,106,3,47,254,88,1,168,254,88,1,168,254,88,1,168,252,209,2,
+25,1,28,19,96,59,76,105,106,75,62,93,17,184,1,23,215,215,45,32,32,46,46,32,
+32,45,0,0,1,0,184,255,37,4,53,5,225,0,28,0,0,37,7,51,21,35,23,7,39,33,17,
+33,21,33,21,51,50,22,23,7,38,35,35,17,33,21,33,17,33,55,4,23,140,170,170,
+140,74,207,253,186,1,209,254,150,239,145,169,34,98,54,196,239,1,106,254,150,
+1,223,207,252,150,102,150,69,219,5,225,102,148,143,139,25,205,254,219,102,
+253,112,220,0,8,0,102,255,188,3,135,6,12,0,14,0,24,0,31,0,41,0,48,0,55,0,
+62,0,74,0,0,0,22,21,20,6,7,17,35,17,38,38,53,52,54,51,19,23,54,53,52,39,7,
+22,21,20,39,22,23,55,38,38,39,1,55,38,53,52,55,39,6,21,20,5,6,7,21,54,54,
+55,37,38,39,7,22,22,23,3,54,55,53,6,6,7,4,54,53,52,38,35,34,6,21,20,22,51,
+2,155,236,201,149,102,149,200,235,165,137,137,25,25,137,6,108,39,28,135,35,
+106,61,254,202,135,4,7,136,24,1,143,28,39,61,106,35,254,240,39,29,137,35,
+107,63,68,29,39,63,105,35,1,13,42,42,31,31,43,43,31,6,12,237,164,152,227,
+18,252,206,3,50,18,228,151,164,237,254,72,80,64,55,65,54,80,18,21,21,160,
+13,28,80,48,63,8,254,98,78,12,27,21,20,78,56,63,62,38,28,11,156,8,61,48,39,
+10,29,78,48,61,8,1,139,29,10,158,8,63,48,252,43,31,31,43,43,31,31,43,0,0,
+2,0,102,254,197,4,37,6,123,0,45,0,54,0,0,1,37,17,4,23,7,38,39,6,6,35,34,38,
+53,52,54,55,17,5,39,1,53,5,39,1,53,5,39,1,53,5,39,1,1,7,37,21,1,7,37,21,1,
+7,37,21,1,1,6,6,21,20,22,51,50,54,3,213,254,152,1,3,181,21,180,242,9,142,
+108,87,104,194,156,254,154,58,1,160,254,154,58,1,160,254,154,58,1,160,254,
+154,58,1,211,1,213,57,254,152,1,161,57,254,152,1,161,57,254,152,1,161,253,
+246,114,132,49,40,63,86,1,76,250,254,90,4,35,103,35,4,166,206,109,85,111,
+153,15,1,168,250,86,1,33,180,250,86,1,33,180,250,86,1,33,180,250,86,1,70,
+254,186,86,250,180,254,223,86,250,180,254,223,86,250,180,254,223,254,147,
+13,94,67,40,52,148,0,7,0,102,255,188,3,135,6,12,0,14,0,22,0,29,0,36,0,48,
+0,60,0,72,0,0,0,22,21,20,6,7,17,35,17,38,38,53,52,54,51,1,37,37,38,39,6,21,
+20,19,5,38,38,35,34,6,1,5,22,22,51,50,54,2,22,21,20,6,35,34,38,53,52,54,51,
+6,22,21,20,6,35,34,38,53,52,54,51,22,22,21,20,6,35,34,38,53,52,54,51,2,155,
+236,201,149,102,149,200,235,165,254,248,1,221,254,152,61,56,33,74,2,6,18,
+167,110,66,115,1,220,253,250,42,115,66,109,168,202,27,27,20,20,27,27,20,195,
+27,27,20,20,27,27,20,235,27,27,20,20,27,27,20,6,12,237,164,152,227,18,252,
+206,3,50,18,228,151,164,237,253,230,135,106,18,15,64,73,77,1,20,152,107,145,
+54,254,216,146,46,54,141,1,148,27,20,20,28,28,20,20,27,199,27,20,20,27,27,
+20,20,27,199,27,20,20,27,27,20,20,27,0,3,0,184,0,0,4,80,5,4,0,3,0,7,0,19,
+0,0,19,33,17,33,55,33,17,33,0,22,21,20,6,35,34,38,53,52,54,51,184,3,152,252,
+104,103,2,202,253,54,1,145,62,60,45,43,61,64,40,5,4,250,252,102,4,56,254,
+78,61,44,41,63,61,43,46,59,0,3,0,102,0,0,5,55,5,223,0,11,0,17,0,23,0,0,1,
+19,33,21,33,17,35,17,1,53,37,19,1,33,17,35,17,33,37,51,3,7,7,5,2,68,215,2,
+28,253,185,103,253,221,1,50,100,3,59,254,133,102,1,225,253,82,37,135,62,188,
+1,92,5,223,253,193,103,252,199,2,254,1,0,72,86,1,67,252,142,253,147,2,211,
+205,1,108,200,50,161,0,0,6,0,184,255,197,4,166,6,12,0,24,0,27,0,31,0,34,0,
+37,0,44,0,0,1,3,17,35,20,6,35,34,38,53,35,17,3,55,19,51,17,51,17,51,17,51,
+17,51,19,1,17,1,19,53,33,21,19,5,53,17,53,5,19,35,20,22,51,50,54,4,166,148,
+174,105,75,75,105,174,150,95,143,106,103,114,103,104,144,253,108,1,170,78,
+254,8,119,1,129,254,156,182,156,46,32,32,46,5,123,254,192,252,62,72,108,108,
+72,3,188,1,70,41,254,201,1,159,254,97,1,159,254,97,1,55,254,53,253,236,1,
+10,254,16,94,94,3,39,239,239,253,158,225,225,254,213,32,46,46,0,0,2,0,102,
+0,20,6,12,5,133,0,27,0,37,0,0,19,22,23,54,54,55,22,0,19,7,2,3,6,6,7,18,21,
+20,6,35,34,38,53,52,18,55,38,39,1,2,21,20,22,51,50,54,53,52,172,216,181,100,
+207,87,145,1,17,167,90,249,255,75,172,74,229,159,130,123,155,118,95,184,222,
+1,215,176,98,78,85,102,5,133,199,237,146,221,53,137,254,123,254,182,45,1,
+247,1,9,61,204,110,254,182,217,147,175,179,147,96,1,35,152,250,204,253,222,
+254,220,165,92,121,120,99,168,0,0,3,0,102,255,236,6,90,5,223,0,15,0,31,0,
+72,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,18,36,18,53,52,2,36,35,
+34,4,2,21,20,18,4,51,3,17,38,38,53,52,54,51,50,22,21,20,6,7,17,33,54,54,51,
+50,22,21,20,6,35,34,38,39,33,17,22,22,21,20,6,35,34,38,53,52,54,4,45,1,98,
+203,203,254,159,206,206,254,159,203,203,1,98,205,178,1,49,177,177,254,206,
+177,177,254,206,176,177,1,50,176,51,28,33,65,47,46,67,36,26,1,7,14,54,32,
+46,67,69,44,32,54,14,254,249,26,36,67,46,47,65,33,5,223,204,254,159,205,206,
+254,161,204,204,1,95,206,205,1,98,203,250,115,177,1,49,177,177,1,50,177,177,
+254,206,177,177,254,206,176,1,94,2,107,14,54,32,45,68,67,46,32,54,14,254,
+254,26,35,67,46,47,65,33,28,254,254,14,54,32,46,67,69,44,32,54,0,0,2,0,102,
+0,0,6,170,4,186,0,41,0,69,0,0,1,1,22,21,20,4,33,32,36,53,52,55,1,55,1,55,
+3,55,19,55,3,55,19,55,17,51,17,51,23,17,51,17,23,19,23,3,23,19,23,3,23,1,
+0,36,53,52,39,7,39,55,38,39,21,35,53,39,7,21,35,53,6,7,23,7,39,6,21,20,4,
+51,6,170,254,242,131,254,129,254,231,254,234,254,127,133,254,241,78,1,25,
+41,187,93,192,31,101,101,98,35,102,37,41,103,34,99,100,100,28,191,92,184,
+41,1,24,254,19,1,73,88,98,78,84,100,137,103,41,37,102,137,103,86,78,100,90,
+1,73,232,3,133,254,176,95,116,144,210,209,145,118,95,1,82,66,254,162,18,1,
+170,45,254,74,6,1,225,25,254,26,4,1,252,254,13,2,1,245,254,4,6,1,230,25,254,
+33,8,1,182,45,254,86,19,1,93,252,159,150,102,74,61,120,65,105,43,18,137,143,
+2,2,143,137,16,43,107,65,123,61,77,103,149,0,5,0,102,255,205,5,199,6,10,0,
+33,0,43,0,55,0,58,0,70,0,0,1,3,7,17,20,6,35,34,38,53,52,54,37,17,51,19,0,
+55,23,6,5,19,51,50,22,21,20,6,35,34,38,53,52,54,5,17,6,6,21,20,22,51,50,54,
+4,54,53,52,38,35,34,6,21,20,22,51,1,39,17,0,22,21,20,6,35,34,38,53,52,54,
+51,4,68,215,170,169,143,137,156,224,1,22,72,237,1,122,63,57,135,254,197,231,
+14,114,159,160,113,113,159,84,254,98,206,193,101,89,98,111,2,160,100,99,71,
+70,100,99,71,254,135,122,2,13,38,38,26,26,37,37,26,1,213,1,180,123,254,76,
+179,218,153,136,134,252,210,2,200,254,25,1,18,43,86,91,234,254,41,159,114,
+114,158,159,113,79,136,84,1,97,158,220,89,87,100,161,161,99,71,70,100,99,
+71,70,100,3,180,252,254,170,253,144,38,26,26,37,37,26,26,38,0,7,0,102,255,
+117,5,147,6,61,0,18,0,21,0,25,0,29,0,33,0,37,0,40,0,0,19,17,51,1,1,51,17,
+1,7,37,17,33,17,33,17,33,17,37,1,55,1,37,1,51,53,35,17,51,53,35,5,53,7,21,
+17,21,55,53,1,23,17,102,72,1,176,1,60,71,1,178,53,254,131,1,68,253,16,1,70,
+254,237,254,70,31,1,61,254,195,1,207,223,223,223,223,2,34,221,221,253,254,
+191,3,86,2,231,254,254,1,2,254,23,254,254,86,225,254,135,253,17,2,239,1,183,
+163,254,152,158,1,4,188,251,107,223,253,221,221,221,223,2,221,2,35,223,2,
+221,3,6,115,1,15,0,3,0,184,0,0,4,252,4,39,0,19,0,22,0,25,0,0,33,17,5,21,35,
+17,51,21,5,17,51,17,37,53,51,17,35,53,37,17,1,17,5,37,17,37,2,166,254,121,
+103,103,1,135,102,1,138,102,102,254,118,1,138,254,161,253,232,1,90,1,184,
+243,197,4,39,199,243,1,186,254,72,243,197,251,217,197,243,254,72,1,59,1,177,
+218,215,254,82,215,0,3,0,102,255,203,5,207,6,102,0,47,0,54,0,61,0,0,1,3,35,
+38,36,39,17,22,22,21,20,6,7,21,23,7,39,7,39,55,53,38,38,53,52,18,55,53,51,
+21,50,23,55,23,7,22,23,55,23,7,22,23,55,23,7,22,23,55,1,17,6,6,21,20,22,19,
+17,54,54,53,52,38,5,207,232,71,41,254,213,205,138,157,163,132,225,73,203,
+203,74,226,195,240,235,200,102,24,60,57,99,56,60,45,110,92,110,43,49,141,
+82,153,25,36,166,252,152,153,179,185,249,86,106,97,4,145,254,248,183,221,
+4,254,211,4,139,119,106,157,16,225,226,73,203,203,73,226,223,14,245,183,203,
+1,11,28,90,84,6,229,24,223,17,20,202,51,200,28,44,178,65,193,37,69,188,253,
+106,2,220,26,210,158,141,186,1,69,254,178,13,100,62,69,86,0,0,2,0,102,255,
+127,3,174,6,61,0,28,0,35,0,0,1,21,20,6,7,17,22,22,23,35,38,38,39,39,17,35,
+17,38,38,53,16,37,17,51,17,54,54,53,53,1,17,6,6,21,20,22,3,174,215,207,247,
+168,7,102,7,96,129,88,102,185,131,1,60,102,165,155,254,90,104,109,97,5,184,
+8,198,248,27,254,31,64,214,199,143,152,51,26,253,242,2,45,56,152,109,1,2,
+66,2,16,254,2,27,191,150,9,252,90,1,181,28,116,78,75,102,0,0,3,0,102,255,
+57,2,88,6,137,0,25,0,37,0,49,0,0,1,17,38,38,53,52,54,51,50,22,21,20,6,7,17,
+22,22,21,20,6,35,34,38,53,52,54,18,54,53,52,38,35,34,6,21,20,22,51,18,54,
+53,52,38,35,34,6,21,20,22,51,1,43,85,112,143,105,103,147,113,86,89,110,146,
+104,105,143,111,199,86,86,62,61,84,84,61,62,86,86,62,61,84,84,61,1,37,3,119,
+16,135,92,105,145,144,106,91,136,16,252,137,19,138,87,105,143,143,105,90,
+136,254,141,83,62,62,86,85,63,62,83,5,94,83,62,62,86,85,63,62,83,0,3,0,102,
+255,57,3,88,6,137,0,49,0,61,0,73,0,0,1,37,21,22,22,21,20,6,35,34,38,53,52,
+54,55,53,5,39,1,53,5,39,1,53,5,39,1,53,38,38,53,52,54,51,50,22,21,20,6,7,
+21,1,7,37,21,1,7,37,21,1,0,54,53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,
+35,34,6,21,20,22,51,3,23,254,251,89,110,146,104,105,143,111,86,254,252,66,
+1,70,254,252,66,1,70,254,252,66,1,70,85,112,143,105,103,147,113,86,1,70,65,
+254,251,1,70,65,254,251,1,70,254,197,86,86,62,61,84,84,61,62,86,86,62,61,
+84,84,61,1,2,217,182,19,138,87,105,143,143,105,90,136,18,182,217,78,1,14,
+137,217,78,1,14,138,219,77,1,17,37,16,135,92,105,145,144,106,91,136,16,37,
+254,239,77,219,138,254,242,78,217,137,254,242,254,80,83,62,62,86,85,63,62,
+83,5,94,83,62,62,86,85,63,62,83,0,0,4,0,184,255,119,6,250,6,27,0,11,0,15,
+0,19,0,23,0,0,19,33,17,33,17,33,17,33,17,33,17,33,37,33,17,33,1,33,17,33,
+37,33,17,33,184,1,244,2,90,1,244,253,166,254,114,253,166,4,78,1,141,254,115,
+252,25,1,141,254,115,1,243,1,142,254,114,2,252,3,31,252,225,252,123,3,31,
+252,225,102,2,185,253,71,2,185,102,2,184,0,0,4,0,102,255,96,4,86,6,117,0,
+22,0,33,0,36,0,40,0,0,1,1,21,5,21,22,22,21,20,2,6,35,34,38,53,52,54,55,38,
+37,39,37,17,19,6,6,21,20,22,51,50,18,53,16,1,55,39,1,22,23,53,2,199,1,125,
+254,161,189,180,118,198,102,135,199,100,158,178,254,187,11,2,25,76,160,94,
+138,93,114,202,254,245,205,205,254,148,150,112,6,117,254,235,71,154,248,73,
+239,173,153,254,247,160,253,163,132,226,224,53,24,72,234,1,176,252,174,230,
+208,109,121,192,1,29,190,1,14,2,64,90,149,254,2,23,32,168,0,0,3,0,102,255,
+221,4,94,5,215,0,47,0,57,0,67,0,0,19,21,20,23,54,54,55,17,38,38,39,6,6,21,
+21,35,53,52,0,51,50,0,21,21,35,53,52,38,39,6,6,7,17,22,22,23,54,53,53,51,
+21,20,0,35,34,0,53,53,1,38,38,35,34,6,7,22,51,50,1,22,22,51,50,54,55,38,35,
+34,205,82,33,146,91,94,144,32,46,36,103,1,37,213,207,1,47,102,46,40,33,145,
+93,91,147,33,86,102,254,220,218,214,254,220,2,234,18,135,87,92,133,14,102,
+137,134,254,139,14,137,88,86,136,18,108,132,136,2,10,18,165,110,87,113,13,
+2,62,14,117,84,63,128,79,23,23,232,1,46,254,220,232,33,23,94,127,51,86,117,
+14,253,194,14,115,88,114,157,26,18,235,254,208,1,46,239,16,254,135,86,113,
+116,83,77,4,221,86,111,111,88,78,0,1,0,102,254,244,8,125,6,176,0,114,0,0,
+1,23,53,51,17,54,55,23,7,17,20,18,51,50,54,53,52,38,35,34,7,39,54,55,39,51,
+23,22,23,55,23,7,22,23,55,23,7,22,23,55,23,7,6,7,23,7,39,6,7,23,7,39,6,7,
+23,7,39,35,34,39,7,39,55,38,39,7,39,55,38,39,7,39,55,38,39,7,39,55,39,7,53,
+55,53,35,53,51,53,35,53,51,53,1,35,53,35,53,51,53,35,53,51,53,35,53,51,53,
+35,53,51,53,51,17,1,53,39,3,39,125,102,33,131,70,234,247,212,152,192,152,
+112,60,36,52,20,58,2,103,2,39,36,107,90,106,51,20,187,61,195,20,13,236,8,
+234,4,16,207,45,203,28,38,121,86,118,51,60,29,103,26,25,47,43,68,98,63,51,
+45,139,78,131,41,22,174,58,176,9,17,201,24,198,10,207,203,205,205,205,205,
+253,231,71,222,222,222,222,222,222,222,222,102,1,250,199,6,70,125,231,254,
+170,28,118,78,207,253,82,245,254,235,181,140,108,177,21,88,15,12,211,205,
+4,12,200,49,196,41,25,133,82,137,41,51,22,102,20,59,52,102,91,99,46,36,178,
+58,176,28,12,197,8,188,6,188,33,178,16,25,156,70,145,39,31,113,86,115,17,
+48,47,99,47,63,2,103,2,73,103,71,103,254,254,41,88,102,72,102,72,102,72,102,
+101,253,123,1,186,53,199,0,4,0,184,255,254,5,172,5,188,0,33,0,43,0,55,0,67,
+0,0,19,17,51,22,23,38,53,52,54,51,50,22,21,20,7,54,55,51,17,35,38,39,22,21,
+20,6,35,34,38,53,52,55,6,7,1,6,33,32,39,17,36,33,32,5,0,54,53,52,38,35,34,
+6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,184,72,190,175,62,147,113,
+110,150,63,146,218,72,72,196,168,63,146,114,111,149,62,165,200,4,70,255,254,
+236,254,233,253,1,5,1,15,1,12,1,7,254,50,89,94,64,63,94,90,67,66,92,92,66,
+67,90,92,65,1,152,2,137,52,22,92,123,116,154,153,117,124,93,16,60,253,119,
+54,21,93,122,114,156,153,117,123,92,21,54,2,20,72,72,254,98,72,72,254,86,
+96,72,94,134,131,97,72,96,3,103,133,94,73,95,97,71,93,134,0,0,4,0,102,255,
+207,5,104,6,16,0,63,0,75,0,87,0,91,0,0,19,54,51,50,23,53,38,38,35,34,7,39,
+55,55,1,51,17,54,51,50,23,7,38,35,34,6,7,19,55,51,50,22,21,20,6,35,34,38,
+53,52,54,55,39,7,22,22,21,20,6,35,34,38,53,52,54,51,51,23,19,53,38,35,34,
+7,0,54,53,52,38,35,34,6,21,20,22,51,32,54,53,52,38,35,34,6,21,20,22,51,1,
+22,23,53,102,143,187,156,104,41,124,66,132,128,35,20,21,2,4,72,112,148,186,
+143,77,118,134,56,126,78,213,12,12,83,120,119,84,83,118,43,35,166,165,37,
+44,116,86,85,116,118,83,11,11,213,152,108,134,118,1,64,57,58,42,40,59,57,
+42,2,105,59,62,39,42,56,56,42,253,205,133,90,3,25,163,135,246,41,47,45,66,
+14,12,1,94,253,31,141,163,70,131,91,95,254,196,2,118,84,85,116,116,85,49,
+84,28,248,248,28,84,49,83,118,116,85,86,116,2,1,62,4,180,131,253,98,59,40,
+42,58,57,43,42,57,58,41,42,58,58,42,42,57,4,180,5,64,217,0,0,3,0,102,255,
+197,5,180,5,211,0,14,0,17,0,20,0,0,23,39,1,53,1,39,1,51,1,7,1,21,1,7,1,19,
+21,5,5,21,5,162,51,2,106,253,189,48,2,129,72,2,133,47,253,186,2,109,51,253,
+147,51,1,87,254,169,1,64,59,53,3,110,125,254,181,55,3,2,252,254,55,1,77,127,
+252,146,53,1,229,3,121,197,198,218,188,248,0,5,0,184,0,156,5,14,4,242,0,3,
+0,6,0,9,0,12,0,15,0,0,19,33,17,33,55,33,1,53,1,33,1,17,1,1,17,1,184,4,86,
+251,170,176,2,246,254,133,1,123,253,10,3,64,254,133,253,242,1,123,4,242,251,
+170,102,1,123,147,1,123,252,193,2,246,254,133,1,123,253,10,1,123,0,1,0,102,
+0,0,4,45,5,41,0,31,0,0,1,21,55,23,7,17,33,55,23,7,51,21,35,23,7,39,33,17,
+23,7,39,21,35,53,7,39,55,17,39,55,23,53,1,176,158,69,227,1,74,213,74,148,
+168,168,148,74,213,254,182,227,69,158,102,158,70,228,228,70,158,5,41,172,
+147,73,211,254,211,227,70,157,103,157,70,227,254,209,211,74,146,166,166,146,
+74,211,2,195,211,73,147,172,0,13,0,102,255,72,5,113,6,168,0,27,0,39,0,51,
+0,63,0,75,0,87,0,99,0,111,0,123,0,135,0,147,0,159,0,171,0,0,1,17,33,21,35,
+17,54,51,50,23,17,35,53,33,17,22,22,21,20,2,4,35,34,36,2,53,52,54,0,0,53,
+52,0,35,34,0,21,20,0,51,18,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,
+35,34,6,21,20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,
+38,53,52,54,51,6,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,
+52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,22,38,53,52,54,51,50,22,21,20,
+6,35,0,22,21,20,6,35,34,38,53,52,54,51,4,38,53,52,54,51,50,22,21,20,6,35,
+2,54,53,52,38,35,34,6,21,20,22,51,1,27,1,57,211,161,202,202,158,211,1,57,
+85,98,169,254,212,176,175,254,211,170,96,3,8,1,60,254,196,226,227,254,196,
+1,62,225,167,236,239,164,165,239,237,167,124,177,178,123,126,176,177,125,
+67,94,93,68,68,94,95,67,15,38,38,26,26,37,37,26,174,37,37,26,26,38,38,26,
+226,38,38,26,26,37,37,26,26,38,38,26,26,37,37,26,175,38,38,26,26,37,37,26,
+254,137,37,37,26,26,38,38,26,1,119,38,38,26,26,37,37,26,166,35,35,24,25,35,
+35,25,3,143,3,25,102,253,161,111,109,2,93,102,252,233,88,231,133,174,254,
+214,173,172,1,42,175,133,229,252,119,1,61,226,226,1,61,254,194,225,227,254,
+196,3,178,236,167,169,235,235,169,166,237,253,64,177,124,124,177,178,123,
+123,178,1,207,95,67,68,94,95,67,68,94,3,73,37,26,26,38,38,26,26,37,161,38,
+26,26,37,37,26,26,38,1,94,38,26,26,37,37,26,26,38,254,135,38,26,26,37,37,
+26,26,38,100,37,26,26,38,38,26,26,37,1,90,38,26,26,37,37,26,26,38,127,37,
+26,26,38,38,26,26,37,252,30,35,25,25,34,34,25,25,35,0,2,0,102,0,0,5,207,5,
+252,0,21,0,25,0,0,0,22,21,20,6,35,35,39,1,19,21,33,53,1,51,19,1,38,53,52,
+54,51,1,33,3,1,5,129,78,77,56,15,14,254,162,242,251,165,2,11,71,238,1,53,
+20,77,54,251,149,3,105,111,254,186,5,227,78,55,55,76,2,254,19,253,90,74,74,
+5,178,253,102,1,181,27,44,56,77,250,131,1,58,3,143,0,0,2,0,102,255,219,4,
+125,5,207,0,25,0,38,0,0,37,55,17,38,38,53,52,36,51,50,22,21,20,6,7,21,36,
+55,23,6,5,17,23,7,39,7,19,17,50,54,53,52,38,35,34,6,21,20,22,1,29,231,188,
+226,1,31,189,154,190,170,134,1,0,201,74,233,254,214,232,70,213,213,162,123,
+180,133,108,149,224,170,41,209,1,160,15,209,157,185,255,150,120,97,139,16,
+197,18,207,69,239,21,254,98,209,78,191,191,3,37,1,35,88,70,76,91,195,142,
+114,152,0,7,0,102,1,29,6,113,5,0,0,22,0,28,0,33,0,38,0,50,0,54,0,58,0,0,0,
+22,21,17,33,53,52,18,36,51,50,0,23,33,17,6,35,34,38,53,52,54,51,1,23,55,38,
+35,34,7,6,7,51,55,5,38,39,7,23,0,54,53,52,38,35,34,6,21,20,22,51,1,7,51,53,
+23,51,39,7,6,0,113,249,245,154,1,15,157,227,1,76,21,1,26,44,48,81,113,114,
+80,252,8,246,246,115,131,131,201,127,18,98,152,2,192,18,127,105,150,1,176,
+53,51,41,40,52,53,39,252,115,115,203,102,203,117,86,5,0,114,81,252,224,53,
+152,1,12,155,254,209,223,2,14,22,113,81,82,113,253,231,147,147,68,133,121,
+170,227,227,170,121,64,227,2,94,53,39,38,55,55,38,39,53,254,80,174,123,123,
+174,53,0,0,5,0,102,255,121,7,150,6,47,0,23,0,29,0,35,0,41,0,47,0,0,1,53,52,
+38,39,17,33,17,6,6,21,21,35,53,52,18,55,17,33,17,22,18,21,21,1,17,6,6,21,
+17,3,52,38,39,17,33,1,22,22,23,17,33,33,17,54,54,55,17,7,47,187,151,252,74,
+155,191,103,253,196,3,182,195,246,253,225,136,186,102,182,140,1,66,254,190,
+101,171,50,254,190,1,168,53,170,99,1,170,39,178,232,16,251,254,4,0,15,225,
+172,51,41,223,1,32,13,2,80,253,178,17,254,226,213,51,254,53,3,152,20,210,
+133,253,211,2,10,150,222,24,252,106,3,254,13,108,80,2,181,253,75,94,98,11,
+1,234,0,2,0,184,1,18,3,135,4,135,0,3,0,7,0,0,19,33,17,33,55,33,17,33,184,
+2,207,253,49,103,2,2,253,254,4,135,252,139,103,2,168,0,0,3,0,102,255,150,
+6,211,5,219,0,33,0,45,0,57,0,0,1,17,51,5,7,37,17,22,22,21,20,7,1,7,5,39,37,
+37,6,6,35,34,38,39,1,39,3,55,19,37,38,53,52,54,0,54,53,52,38,35,34,6,21,20,
+22,51,18,22,21,20,6,35,34,38,53,52,54,51,3,121,72,1,114,41,254,213,136,186,
+27,1,205,35,254,193,60,1,0,254,160,53,153,91,88,152,51,254,53,36,52,101,43,
+1,94,29,186,1,42,159,161,109,108,162,160,110,41,63,61,43,43,61,64,40,3,203,
+2,16,153,95,123,254,109,20,211,138,71,66,254,248,64,243,83,197,203,68,80,
+77,63,254,247,62,1,141,12,254,193,203,66,77,140,209,253,149,160,110,112,158,
+158,112,111,159,1,119,60,45,43,61,61,43,46,59,0,7,0,102,0,0,8,254,5,162,0,
+65,0,69,0,73,0,76,0,80,0,84,0,87,0,0,33,3,33,17,35,37,53,1,17,52,38,35,34,
+6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,51,50,22,21,21,33,53,52,54,
+51,50,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,21,17,1,21,
+5,55,17,39,17,37,53,39,21,55,21,55,5,17,7,17,39,53,7,21,37,23,53,5,72,2,254,
+219,72,252,141,3,84,72,69,66,90,36,26,36,61,11,80,23,107,59,67,96,151,107,
+113,131,1,37,130,113,107,151,95,68,62,104,21,74,14,58,41,27,34,90,66,69,72,
+3,82,252,145,121,92,1,31,92,194,205,251,188,92,102,92,254,204,205,3,184,252,
+72,102,72,1,105,2,143,69,80,72,55,23,38,53,35,68,52,70,98,65,101,129,139,
+119,129,129,119,139,129,101,66,97,73,56,67,37,57,38,23,55,72,80,69,253,113,
+254,151,72,102,119,1,8,41,254,197,30,164,37,211,131,108,22,65,1,59,41,254,
+248,10,211,37,164,35,22,108,0,0,5,0,184,255,115,5,72,6,51,0,23,0,26,0,29,
+0,32,0,35,0,0,19,17,51,5,37,53,35,53,33,21,35,17,35,53,37,5,35,17,51,5,37,
+53,37,5,1,17,5,1,17,5,5,55,39,17,55,39,184,72,1,98,1,162,219,2,31,222,102,
+254,92,254,160,72,72,1,94,1,166,254,94,254,158,3,4,254,195,1,61,254,197,254,
+86,221,221,217,217,3,18,2,25,209,246,125,102,102,249,166,135,246,205,2,20,
+207,246,142,245,207,253,97,1,112,184,2,57,1,113,184,129,129,131,252,14,127,
+129,0,0,7,0,184,255,152,4,131,6,39,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,19,
+33,17,33,19,37,53,33,1,17,5,21,17,37,53,5,17,37,53,5,17,37,53,5,17,37,53,
+5,184,3,203,252,53,103,2,254,253,2,2,254,253,2,2,254,253,2,2,254,253,2,2,
+254,253,2,2,254,253,2,6,39,249,113,5,16,170,111,250,61,1,22,170,108,2,192,
+170,140,170,253,139,170,139,170,2,84,170,137,170,253,142,170,137,170,0,2,
+0,102,255,115,4,45,6,51,0,14,0,17,0,0,19,33,17,51,1,21,33,17,51,21,33,53,
+51,17,33,1,17,33,102,1,164,72,1,219,254,68,221,253,225,219,254,92,2,11,1,
+53,3,16,3,35,252,191,72,253,47,102,102,2,209,2,133,253,225,0,0,1,0,102,0,
+0,4,45,5,150,0,27,0,0,1,53,33,17,35,1,55,23,17,33,38,2,35,34,2,17,21,35,53,
+52,18,54,51,50,22,18,21,21,3,199,254,114,71,254,245,86,150,1,240,20,215,142,
+158,223,103,126,225,133,132,224,127,2,119,86,253,51,1,160,53,233,2,71,223,
+1,29,254,170,254,254,117,117,196,1,67,184,182,254,190,191,104,0,1,0,102,255,
+236,3,106,5,63,0,40,0,0,1,33,21,33,6,7,33,21,33,21,33,21,33,22,23,33,21,33,
+22,22,51,50,54,55,23,6,35,34,0,17,16,0,51,50,23,7,38,38,35,34,6,1,164,1,166,
+254,65,7,5,1,203,254,47,1,209,254,51,8,6,1,191,254,90,25,94,77,48,81,60,69,
+124,158,232,254,254,1,1,233,158,124,69,60,80,49,77,93,4,45,102,46,90,102,
+135,102,99,37,102,86,86,37,57,74,122,1,100,1,70,1,70,1,99,122,74,57,37,86,
+0,2,0,102,255,240,3,127,5,178,0,13,0,27,0,0,1,7,22,23,21,1,39,1,37,53,55,
+1,55,9,2,39,1,37,53,55,39,55,1,21,7,23,23,3,51,192,83,185,254,33,70,1,176,
+254,242,199,254,8,69,2,35,254,221,254,193,70,1,17,254,231,221,250,70,1,39,
+221,67,215,3,113,176,54,131,71,254,47,73,1,166,183,71,185,1,210,74,254,6,
+253,230,254,209,73,1,2,195,72,211,235,74,254,239,71,205,45,150,0,0,1,0,102,
+255,211,7,186,5,233,0,116,0,0,1,34,6,21,20,22,51,54,51,50,23,51,50,54,53,
+52,38,35,53,50,22,21,20,6,7,22,23,37,23,5,23,20,7,23,7,39,6,7,39,54,18,53,
+52,2,35,34,6,2,7,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,39,7,35,34,39,
+39,35,34,6,21,20,22,23,7,38,38,53,52,54,55,38,53,52,18,55,1,39,1,38,38,39,
+55,22,23,55,23,7,23,20,2,21,20,22,51,50,54,18,55,38,53,52,54,51,4,227,48,
+68,69,47,51,31,25,43,11,55,73,67,50,91,128,61,49,96,39,1,10,45,254,220,2,
+37,217,49,201,38,83,90,89,89,138,114,92,141,185,108,51,130,89,51,45,49,24,
+23,47,70,35,31,18,19,183,67,10,10,50,69,35,31,45,59,64,121,92,4,107,14,254,
+188,66,1,125,26,128,59,49,170,72,156,65,180,2,131,92,88,82,126,163,98,90,
+127,92,5,68,71,46,48,69,8,8,67,50,46,71,102,127,92,62,101,28,92,166,138,91,
+151,45,178,142,116,91,107,109,149,49,162,1,22,189,131,1,0,126,254,111,65,
+60,81,92,127,24,90,12,69,48,32,58,14,2,131,2,67,47,35,58,14,94,28,111,62,
+89,123,5,28,31,98,1,10,62,254,238,77,1,66,43,111,34,90,104,109,134,78,152,
+20,94,254,190,84,94,98,124,1,103,78,66,112,91,128,0,0,4,0,102,0,0,6,4,5,12,
+0,27,0,45,0,63,0,67,0,0,33,53,52,2,36,35,34,4,2,21,21,35,53,16,0,37,39,53,
+55,51,23,21,7,22,4,18,21,21,33,53,52,38,35,34,6,21,21,35,53,52,0,51,50,0,
+21,21,33,53,52,38,35,34,6,21,21,35,53,52,54,51,50,22,21,21,1,23,55,39,5,158,
+162,254,223,166,165,254,226,165,103,1,118,1,26,154,180,72,184,155,180,1,52,
+167,254,170,222,155,156,221,102,1,24,199,199,1,24,254,168,77,58,56,79,102,
+138,99,99,139,254,158,116,119,119,29,181,1,37,169,166,254,217,182,29,29,1,
+42,1,161,26,209,72,241,243,72,207,15,201,254,184,197,29,39,171,220,222,169,
+39,39,211,1,26,254,231,212,39,47,60,81,80,61,47,47,106,138,138,106,47,3,246,
+154,154,153,0,2,0,102,254,252,4,63,6,184,0,67,0,79,0,0,1,50,22,21,20,6,7,
+22,21,20,6,7,22,22,21,20,7,22,21,20,7,22,21,20,6,35,33,53,33,50,53,52,38,
+35,33,53,33,50,54,53,52,38,35,33,53,33,50,54,53,52,35,33,53,33,38,53,52,54,
+51,51,50,54,53,52,38,35,33,53,0,54,53,52,38,35,34,6,21,20,22,51,3,35,125,
+159,78,65,94,54,48,40,46,74,74,74,74,127,113,253,88,2,168,138,68,59,254,223,
+1,33,59,68,72,60,254,228,1,28,64,68,146,253,254,1,62,70,157,107,31,82,100,
+98,88,254,131,1,164,98,97,67,68,94,96,66,6,184,144,118,77,122,32,96,136,74,
+123,42,28,88,52,97,63,63,97,96,63,61,97,95,116,102,109,51,55,103,62,46,49,
+60,102,58,51,106,103,74,124,128,177,85,73,66,94,102,252,99,117,83,82,121,
+119,84,84,116,0,4,0,102,0,0,3,150,5,141,0,17,0,20,0,23,0,26,0,0,1,1,21,33,
+1,21,33,1,21,33,53,1,33,53,1,33,53,1,3,33,3,3,33,3,3,33,3,2,33,1,117,254,
+210,1,46,254,210,1,46,252,208,1,45,254,211,1,45,254,211,1,115,217,1,250,252,
+254,1,250,252,254,1,250,252,5,141,254,52,72,254,139,72,254,140,72,72,1,116,
+72,1,117,72,1,204,254,82,1,56,253,12,1,55,253,12,1,56,0,0,8,0,102,255,115,
+5,27,6,137,0,104,0,116,0,126,0,136,0,146,0,155,0,165,0,175,0,0,0,22,21,20,
+7,54,51,50,22,21,20,6,35,34,38,39,6,21,21,54,51,50,22,21,20,6,35,34,38,39,
+6,6,21,21,54,54,51,50,22,21,20,6,35,34,38,39,6,6,21,21,51,21,33,53,51,53,
+52,38,39,6,6,35,34,38,53,52,54,51,50,23,53,52,38,39,6,6,35,34,38,53,52,54,
+51,50,23,53,52,38,39,6,6,35,34,38,53,52,54,51,50,23,38,53,52,54,51,18,54,
+53,52,38,35,34,6,21,20,22,51,1,39,34,6,21,20,22,51,50,54,19,39,34,6,21,20,
+22,51,50,54,19,39,34,6,21,20,22,51,50,54,1,22,51,50,54,53,52,38,35,3,22,22,
+51,50,54,53,52,38,35,3,22,22,51,50,54,53,52,38,35,3,10,99,68,99,128,122,149,
+83,69,89,136,51,123,99,181,122,149,84,68,90,136,52,65,56,47,145,88,122,149,
+84,68,95,135,48,64,57,221,253,225,219,57,64,53,134,91,68,84,150,121,180,100,
+51,70,54,136,88,68,84,150,121,181,99,64,59,49,135,92,68,84,150,121,135,92,
+68,99,74,27,42,41,28,30,40,41,29,254,239,59,76,92,26,23,55,87,36,59,76,92,
+26,23,57,86,35,59,76,92,26,23,57,86,2,66,69,111,23,26,95,73,61,34,87,59,23,
+26,92,76,61,34,87,59,23,26,92,76,6,137,168,119,139,88,60,121,78,62,86,100,
+111,58,140,123,96,121,78,62,85,100,111,31,95,79,117,47,50,121,78,62,85,103,
+107,30,91,89,191,102,102,193,84,95,27,108,100,85,62,79,120,97,117,75,97,33,
+110,101,85,62,79,120,96,123,79,92,27,108,103,85,63,79,120,62,88,141,118,169,
+254,43,104,78,75,110,111,74,77,105,254,60,4,60,37,18,27,65,254,224,4,58,38,
+19,26,66,3,24,4,58,38,19,26,66,254,223,138,27,18,40,57,1,100,68,69,26,19,
+38,58,253,43,68,69,26,19,38,58,0,0,1,0,184,255,221,3,90,5,217,0,14,0,0,1,
+17,54,51,50,22,21,20,6,35,34,39,17,35,17,1,31,92,110,152,217,220,149,113,
+89,103,5,217,254,53,62,220,149,152,217,60,254,55,5,252,0,2,0,102,255,207,
+4,152,5,223,0,18,0,30,0,0,1,17,35,17,1,35,1,53,1,51,1,17,51,17,7,9,3,36,22,
+21,20,6,35,34,38,53,52,54,51,4,152,103,254,70,72,254,55,1,201,72,1,186,103,
+60,254,0,254,113,1,143,2,0,254,29,53,53,37,37,51,51,37,2,82,253,125,2,8,254,
+158,2,61,72,2,63,254,158,2,8,253,125,43,1,154,254,10,254,14,1,154,240,53,
+38,37,51,51,37,38,53,0,2,0,102,255,158,4,178,6,39,0,7,0,31,0,0,19,1,51,1,
+21,1,35,1,1,23,1,1,7,21,23,21,7,23,21,7,23,21,7,23,21,7,23,21,7,23,21,7,102,
+2,2,72,2,2,253,252,72,254,0,2,21,16,1,195,254,61,16,80,80,100,102,102,100,
+100,100,100,100,80,80,3,4,3,35,252,223,72,252,224,3,30,253,131,26,2,188,2,
+191,27,59,60,71,74,62,71,74,59,72,74,59,72,74,59,72,73,62,71,74,0,0,1,0,184,
+255,131,4,59,6,2,0,27,0,0,1,17,33,17,33,17,35,17,51,17,33,17,51,17,35,17,
+33,17,33,17,51,17,35,17,33,17,35,17,1,31,1,39,254,217,103,103,2,182,102,102,
+254,215,1,41,102,102,253,74,103,2,72,254,209,3,84,254,208,2,197,254,209,1,
+47,253,59,1,48,252,172,1,47,253,59,1,47,254,209,2,197,0,0,2,0,102,255,195,
+6,197,6,49,0,171,0,183,0,0,1,52,55,39,55,55,54,55,39,55,23,54,63,2,23,55,
+51,23,55,23,23,22,23,55,23,7,23,55,23,7,22,23,22,23,54,55,39,39,55,47,2,55,
+39,35,39,55,39,7,39,55,39,7,47,2,7,39,39,35,15,2,39,15,2,39,7,23,7,39,7,23,
+15,2,23,7,7,6,21,35,52,55,39,55,55,54,55,39,55,23,55,39,55,23,63,2,23,54,
+63,2,23,50,23,55,31,2,55,23,7,22,23,55,23,7,23,51,23,7,31,2,7,21,7,23,7,7,
+6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,39,7,39,55,39,7,47,2,35,7,7,39,
+15,2,39,7,23,7,7,6,21,0,54,53,52,38,35,34,6,21,20,22,51,1,213,14,61,24,82,
+10,27,22,47,96,37,29,18,72,67,43,16,15,61,70,6,27,37,69,56,23,33,74,39,35,
+30,11,31,30,39,16,65,2,67,2,73,21,53,4,77,37,37,7,77,54,6,8,67,68,22,29,55,
+72,49,16,17,31,71,64,43,16,62,82,28,16,47,82,20,36,32,86,13,54,19,76,16,102,
+47,56,25,84,22,11,35,41,88,45,10,55,90,66,34,70,62,35,42,31,74,51,41,41,57,
+72,20,66,84,61,16,31,20,86,43,41,25,80,30,55,14,80,11,70,2,68,13,80,28,25,
+43,53,165,117,117,164,124,95,13,46,74,45,25,8,72,64,4,4,4,47,72,49,8,10,62,
+84,10,29,37,78,27,3,132,106,106,74,74,104,105,73,1,233,82,56,49,74,6,20,43,
+88,54,19,25,14,90,19,62,2,2,66,17,80,10,18,41,45,82,39,20,63,103,84,73,4,
+13,55,119,54,71,41,10,17,72,59,14,66,72,10,17,54,86,6,43,33,83,9,62,6,70,
+2,74,14,55,14,88,35,29,25,84,53,12,31,79,68,14,35,70,74,18,82,98,169,152,
+66,72,12,46,17,86,62,4,53,90,45,24,36,97,24,59,10,6,76,6,74,6,64,17,84,30,
+35,43,80,29,23,11,60,71,43,74,60,59,22,72,41,44,22,49,71,27,87,38,43,119,
+69,121,178,175,124,109,167,23,97,87,12,59,76,6,37,31,74,2,66,2,61,2,80,38,
+22,10,82,59,9,83,83,254,64,116,81,84,120,120,84,82,115,0,0,1,0,102,0,0,5,
+170,5,68,0,23,0,0,1,33,6,6,7,17,35,17,38,38,39,33,53,33,54,54,55,17,51,17,
+22,22,23,33,5,170,254,125,16,125,95,102,93,127,18,254,127,1,129,19,131,88,
+102,91,128,17,1,131,2,111,89,130,19,254,127,1,129,19,128,91,102,95,126,15,
+1,131,254,125,16,128,92,0,0,3,0,102,255,236,5,223,5,100,0,15,0,69,0,81,0,
+0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,1,55,23,7,22,23,55,23,7,22,23,
+53,51,21,54,55,39,55,23,54,55,39,55,23,54,53,52,39,7,39,55,38,39,7,39,55,
+38,39,21,35,53,6,7,23,7,39,6,7,23,7,39,6,21,20,36,22,21,20,6,35,34,38,53,
+52,54,51,3,221,1,70,188,186,254,186,192,189,254,190,186,185,1,66,190,253,
+186,238,28,237,53,107,149,82,150,118,143,102,132,122,143,86,141,112,54,236,
+33,233,17,17,233,29,232,57,105,141,82,141,121,139,102,131,115,141,86,139,
+107,55,231,32,232,18,2,143,86,88,59,61,85,83,63,5,100,188,254,187,191,189,
+254,190,185,181,1,68,191,190,1,71,187,252,195,76,99,75,135,91,205,61,205,
+70,12,248,248,10,68,207,57,205,93,126,82,99,82,72,65,71,66,74,99,73,133,89,
+195,57,195,74,12,244,244,11,65,203,57,201,91,128,78,99,78,71,76,64,211,86,
+61,62,84,85,61,60,87,0,0,4,0,184,0,0,6,14,5,51,0,27,0,31,0,46,0,61,0,0,1,
+7,23,21,7,23,21,7,23,21,7,23,21,33,53,55,39,53,55,39,53,55,39,53,55,39,53,
+33,1,33,17,33,1,51,17,35,23,21,7,23,21,7,23,21,7,23,21,1,55,35,17,51,39,53,
+55,39,53,55,39,53,55,39,6,4,213,213,211,211,207,207,207,217,250,170,217,206,
+206,206,211,211,213,213,5,65,252,221,1,4,254,252,254,219,191,211,123,209,
+209,205,205,207,207,2,129,121,209,188,100,207,207,205,205,209,209,4,236,142,
+114,72,129,113,72,118,109,72,122,125,72,72,125,122,72,109,118,72,113,129,
+72,114,142,71,251,51,4,103,251,153,4,103,80,72,114,125,72,113,121,71,109,
+121,71,3,221,80,251,153,58,71,121,109,71,121,113,72,125,114,0,1,0,102,255,
+123,4,12,6,74,0,75,0,0,19,54,54,55,53,33,53,33,53,38,38,39,55,22,22,23,53,
+38,38,39,55,22,22,23,17,51,17,54,54,55,23,6,6,7,21,54,54,55,23,6,6,7,21,33,
+21,33,21,22,22,23,7,38,38,39,21,22,22,23,7,38,38,39,17,35,17,6,6,7,39,54,
+54,55,53,6,6,7,104,70,222,122,254,100,1,156,120,220,74,86,58,176,94,132,219,
+65,91,51,168,106,103,106,168,51,90,67,217,131,91,174,62,86,73,221,119,1,155,
+254,101,120,223,70,86,62,174,91,127,220,68,90,53,171,101,103,103,170,52,91,
+66,222,128,98,174,56,1,29,104,137,13,147,102,146,13,134,109,57,87,111,13,
+187,14,153,117,49,92,125,14,1,29,254,227,14,125,92,49,120,150,14,187,13,107,
+91,57,108,136,12,146,102,147,13,138,103,58,90,107,12,184,13,150,122,49,98,
+120,11,254,232,1,24,12,120,97,49,120,152,13,184,13,112,84,0,0,10,0,102,255,
+160,5,102,5,244,0,35,0,47,0,58,0,62,0,66,0,78,0,82,0,86,0,90,0,94,0,0,1,22,
+23,53,52,54,51,50,22,21,20,6,35,35,21,33,21,7,23,21,33,17,35,39,7,35,17,33,
+53,55,39,53,33,53,38,39,0,6,21,20,22,51,50,54,53,52,38,35,19,51,50,54,53,
+52,38,35,34,6,21,19,22,23,55,5,54,55,35,4,22,21,20,6,35,34,38,53,52,54,51,
+5,6,7,51,33,38,39,7,5,6,7,23,37,38,39,21,1,104,134,194,131,88,101,110,180,
+141,6,2,79,221,221,254,170,71,228,225,72,254,170,222,222,2,74,221,115,1,40,
+136,135,96,95,133,134,94,48,6,99,120,58,51,49,67,192,61,21,143,252,234,22,
+60,224,1,237,40,40,28,27,40,40,27,1,74,6,37,180,253,13,37,6,134,2,150,60,
+71,131,254,250,80,49,4,188,13,5,78,120,132,107,98,104,123,234,72,227,225,
+72,254,154,221,221,1,102,72,227,225,72,234,5,13,254,160,132,96,96,135,137,
+94,94,134,1,180,68,57,49,53,81,68,253,252,68,82,150,148,84,64,160,40,28,27,
+40,40,27,28,40,92,79,60,60,79,139,103,44,15,125,125,18,39,182,0,13,0,102,
+255,236,6,86,5,20,0,15,0,22,0,29,0,41,0,53,0,65,0,77,0,81,0,85,0,89,0,95,
+0,101,0,105,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,3,17,6,0,21,20,
+0,1,17,54,0,53,52,0,0,22,21,20,6,35,34,38,53,52,54,51,0,38,53,52,54,51,50,
+22,21,20,6,35,36,54,53,52,38,35,34,6,21,20,22,51,36,6,21,20,22,51,50,54,53,
+52,38,35,37,51,53,35,17,51,53,35,17,51,53,35,19,34,7,21,51,53,3,55,53,35,
+21,23,3,51,53,35,4,42,1,96,204,203,254,158,203,205,254,158,201,201,1,99,204,
+168,212,254,235,1,18,2,39,216,1,18,254,237,253,80,107,105,78,75,105,107,73,
+2,173,105,106,76,73,107,106,74,253,38,48,48,32,32,46,46,32,2,218,48,48,32,
+32,46,46,32,254,66,131,131,131,131,131,131,65,35,30,131,33,33,131,32,32,131,
+131,5,20,177,254,204,176,177,254,208,178,178,1,49,176,176,1,50,179,251,80,
+4,56,48,254,212,193,191,254,213,4,7,251,200,49,1,46,188,190,1,45,254,203,
+106,76,73,107,106,74,77,105,254,150,107,73,75,107,105,77,75,105,102,46,32,
+32,48,48,32,32,46,158,48,32,32,46,46,32,32,48,174,102,253,58,102,1,47,101,
+1,151,4,96,96,251,168,2,98,98,2,1,151,99,0,0,21,0,102,255,236,5,233,5,111,
+0,15,0,31,0,43,0,55,0,67,0,79,0,91,0,103,0,115,0,127,0,139,0,151,0,163,0,
+175,0,187,0,199,0,211,0,223,0,235,0,247,1,3,0,0,0,4,18,21,20,2,4,35,34,36,
+2,53,52,18,36,51,18,36,18,53,52,2,36,35,34,4,2,21,20,18,4,51,0,54,51,50,22,
+21,20,6,35,34,38,53,4,38,53,52,54,51,50,22,21,20,6,35,18,6,35,34,38,53,52,
+54,51,50,22,21,0,54,51,50,22,21,20,6,35,34,38,53,2,38,53,52,54,51,50,22,21,
+20,6,35,0,6,35,34,38,53,52,54,51,50,22,21,36,54,51,50,22,21,20,6,35,34,38,
+53,0,38,53,52,54,51,50,22,21,20,6,35,0,6,35,34,38,53,52,54,51,50,22,21,0,
+38,53,52,54,51,50,22,21,20,6,35,2,38,53,52,54,51,50,22,21,20,6,35,6,54,51,
+50,22,21,20,6,35,34,38,53,22,38,53,52,54,51,50,22,21,20,6,35,36,54,51,50,
+22,21,20,6,35,34,38,53,18,38,53,52,54,51,50,22,21,20,6,35,22,38,53,52,54,
+51,50,22,21,20,6,35,32,38,53,52,54,51,50,22,21,20,6,35,6,54,51,50,22,21,20,
+6,35,34,38,53,4,38,53,52,54,51,50,22,21,20,6,35,3,230,1,71,188,188,254,185,
+191,189,254,187,191,191,1,68,190,162,1,25,161,162,254,231,161,161,254,233,
+162,160,1,23,163,254,86,41,29,29,40,40,29,29,41,2,92,41,41,29,29,40,40,29,
+221,41,29,29,40,40,29,29,41,253,65,41,29,29,41,41,29,29,41,110,41,41,29,29,
+40,40,29,3,18,41,29,29,40,40,29,29,41,252,113,40,29,29,41,41,29,29,40,1,198,
+41,41,29,29,41,41,29,1,225,40,29,29,41,41,29,29,40,254,2,41,41,29,29,41,41,
+29,29,41,41,29,29,41,41,29,70,41,29,29,41,41,29,29,41,219,40,40,29,29,41,
+41,29,254,84,41,29,29,40,40,29,29,41,221,41,41,29,29,41,41,29,175,41,41,29,
+29,41,41,29,254,72,41,41,29,29,41,41,29,43,41,29,29,40,40,29,29,41,1,143,
+40,40,29,29,41,41,29,5,111,189,254,186,192,190,254,187,189,185,1,71,192,193,
+1,72,186,250,227,161,1,24,161,162,1,24,162,161,254,232,163,162,254,233,161,
+1,168,41,41,29,29,40,40,29,219,41,29,29,40,40,29,29,41,2,92,41,41,29,29,41,
+41,29,253,234,40,40,29,29,41,41,29,1,235,41,29,29,40,40,29,29,41,254,143,
+40,40,29,29,41,41,29,234,41,41,29,29,41,41,29,254,31,40,29,29,41,41,29,29,
+40,1,198,41,41,29,29,41,41,29,254,234,40,29,29,41,41,29,29,40,1,157,41,29,
+29,41,41,29,29,41,108,41,41,29,29,41,41,29,174,41,29,29,40,40,29,29,41,99,
+40,40,29,29,41,41,29,1,191,41,29,29,41,41,29,29,41,57,41,29,29,41,41,29,29,
+41,41,29,29,41,41,29,29,41,154,40,40,29,29,41,41,29,70,41,29,29,40,40,29,
+29,41,0,5,0,102,255,223,4,160,5,236,0,28,0,32,0,36,0,40,0,44,0,0,1,19,7,3,
+7,21,51,17,35,21,35,53,35,17,51,53,39,6,6,7,39,1,51,23,19,51,19,54,55,3,53,
+35,21,39,51,53,35,51,21,51,53,1,51,53,35,3,162,254,86,215,189,213,213,102,
+213,213,186,57,105,56,86,1,7,71,66,104,72,104,29,47,53,111,213,111,111,213,
+111,254,188,111,111,4,215,254,98,57,1,90,192,228,253,240,199,199,2,16,228,
+190,85,174,85,57,1,158,82,1,103,254,155,28,52,252,53,111,111,213,111,111,
+111,254,188,111,0,4,0,102,0,23,6,2,5,37,0,25,0,36,0,44,0,48,0,0,1,1,54,55,
+23,6,17,16,23,7,38,39,1,35,1,6,7,39,54,17,16,39,55,22,23,1,1,53,55,1,1,22,
+21,20,7,1,1,37,55,51,23,21,7,35,39,37,39,7,23,3,78,1,176,39,121,86,160,174,
+82,125,45,254,74,72,254,86,49,117,82,174,159,86,115,40,1,160,1,232,2,254,
+59,254,76,4,6,1,182,1,199,253,75,201,72,203,201,72,203,1,107,125,125,125,
+5,37,254,82,213,180,57,242,254,225,254,205,240,61,175,202,254,72,1,170,196,
+167,61,240,1,51,1,29,244,57,172,205,1,158,253,145,31,31,1,194,254,78,36,42,
+63,58,254,74,1,199,115,202,200,72,203,201,37,125,125,125,0,9,0,184,255,141,
+5,8,6,55,0,3,0,6,0,9,0,14,0,19,0,23,0,27,0,31,0,35,0,0,19,33,17,33,55,33,
+9,2,25,2,39,7,19,1,23,37,39,35,1,37,39,7,39,55,39,5,39,37,39,5,1,55,39,5,
+184,4,80,251,176,103,2,88,253,168,1,98,2,33,111,254,183,253,51,98,1,2,119,
+237,1,133,1,0,49,254,49,254,48,255,0,49,1,2,47,254,254,1,82,254,45,255,0,
+6,55,249,86,103,4,88,1,133,252,12,3,244,250,35,1,16,205,137,254,172,5,47,
+185,138,221,252,131,135,90,137,90,137,88,135,90,136,88,138,253,148,135,86,
+137,0,0,9,0,102,255,160,7,12,6,70,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,
+0,47,0,0,18,18,36,51,50,4,18,21,20,2,4,35,34,36,2,53,1,54,55,1,1,6,7,33,1,
+38,39,17,5,38,39,1,5,22,23,1,1,22,23,17,1,54,55,33,3,6,7,1,102,228,1,139,
+229,230,1,139,225,227,254,117,228,227,254,118,231,3,134,248,194,254,70,253,
+153,166,16,2,112,2,101,189,251,2,184,18,164,254,71,252,154,16,164,1,184,254,
+146,192,248,2,107,162,18,253,149,180,248,190,1,182,3,216,1,137,229,231,254,
+118,227,227,254,116,227,225,1,138,231,253,22,16,166,1,187,2,100,192,248,2,
+2,164,18,253,146,74,250,190,254,72,103,251,189,1,184,253,254,164,16,2,109,
+254,147,190,248,3,31,18,164,254,76,0,0,5,0,102,255,31,7,223,6,152,0,114,0,
+126,0,138,0,150,0,162,0,0,1,21,51,53,35,53,51,53,7,39,55,38,38,53,52,54,51,
+50,22,21,20,6,7,23,7,39,21,51,21,35,21,51,53,51,21,51,39,55,23,54,54,51,50,
+22,21,20,6,35,34,38,39,35,7,39,55,35,21,35,53,35,21,51,21,35,21,55,23,7,22,
+22,21,20,6,35,34,38,53,52,54,55,39,55,23,53,35,53,51,53,35,21,35,53,35,23,
+7,39,35,6,6,35,34,38,53,52,54,51,50,22,23,51,55,23,7,51,53,0,54,53,52,38,
+35,34,6,21,20,22,51,0,38,35,34,6,21,20,22,51,50,54,53,36,38,35,34,6,21,20,
+22,51,50,54,53,0,54,53,52,38,35,34,6,21,20,22,51,3,80,160,82,82,136,73,207,
+59,75,108,79,77,111,74,59,207,74,137,86,86,160,102,137,127,74,191,17,101,
+64,77,109,107,79,65,100,17,5,188,74,125,133,102,160,86,86,137,74,207,59,74,
+110,78,79,108,74,60,207,73,136,82,82,160,103,133,127,73,191,6,17,100,61,79,
+110,111,78,62,99,17,2,193,73,129,137,1,93,51,51,35,35,49,49,35,253,84,49,
+35,35,51,51,35,35,49,6,2,49,35,35,51,51,35,35,49,252,205,51,51,35,35,49,49,
+35,3,98,86,162,102,138,131,73,195,16,101,63,78,111,111,78,65,96,17,195,73,
+133,142,102,162,86,86,138,73,211,60,78,110,79,78,108,75,60,209,74,135,82,
+82,158,102,144,134,74,193,18,100,62,77,109,108,78,63,100,17,195,74,131,139,
+102,158,82,82,135,74,209,63,72,109,77,77,112,76,62,211,73,138,86,252,35,49,
+35,35,51,51,35,35,49,3,119,51,51,35,35,49,49,35,35,51,51,35,35,49,49,35,2,
+174,49,35,35,51,51,35,35,49,0,5,0,102,255,152,6,209,6,2,0,63,0,68,0,73,0,
+78,0,83,0,0,37,53,38,38,39,35,6,6,35,34,38,53,52,54,51,50,22,23,51,54,54,
+55,53,38,38,53,52,54,51,50,22,21,20,6,7,21,22,22,23,51,54,51,50,22,21,20,
+6,35,34,39,35,6,6,7,21,22,21,20,6,35,34,38,53,52,1,38,38,39,21,39,6,6,7,51,
+19,54,54,55,35,33,22,22,23,53,3,104,133,188,16,234,14,49,29,43,64,65,42,28,
+48,14,236,16,185,136,24,29,63,42,43,63,30,25,133,184,19,237,32,58,44,63,62,
+45,63,29,235,18,187,131,55,63,43,43,62,1,131,16,126,89,103,91,124,18,233,
+103,91,124,16,231,254,176,18,124,91,92,236,16,191,131,25,31,61,44,44,62,30,
+23,129,188,19,235,14,50,29,45,61,63,43,29,51,13,235,18,184,134,53,64,42,43,
+62,56,135,187,16,236,31,59,43,63,62,44,59,2,195,90,126,15,231,231,17,125,
+89,254,176,18,128,88,89,127,18,234,0,1,0,104,255,133,7,57,6,109,0,83,0,0,
+1,16,2,35,34,7,23,7,39,6,7,23,7,39,6,7,23,7,39,7,51,21,33,53,52,18,51,50,
+23,38,35,34,2,17,35,53,16,18,51,50,0,17,21,16,18,51,50,55,39,55,23,54,55,
+39,55,23,54,55,39,55,23,55,35,53,33,21,20,2,35,34,39,22,51,50,18,17,51,21,
+16,2,35,34,0,17,3,158,118,106,16,16,102,45,119,30,21,145,30,142,16,4,156,
+9,157,6,161,254,248,169,142,25,23,84,101,161,197,103,250,211,201,1,6,116,
+107,17,16,102,45,119,28,23,146,31,141,16,5,156,8,158,6,162,1,9,170,142,25,
+22,83,102,161,197,102,252,208,202,254,251,3,76,1,9,1,3,4,92,51,108,30,42,
+67,64,66,51,29,20,70,22,73,103,52,245,1,49,6,78,254,142,254,208,11,1,91,1,
+163,254,98,254,125,166,254,250,254,250,4,92,51,108,28,43,68,63,65,40,40,20,
+70,23,74,102,51,247,254,208,6,77,1,114,1,47,11,254,165,254,94,1,159,1,130,
+0,0,3,0,102,255,231,5,37,5,199,0,36,0,39,0,42,0,0,19,17,51,5,37,51,17,35,
+37,17,33,21,33,21,33,21,33,20,7,33,21,33,6,6,35,34,38,53,51,20,22,51,50,54,
+53,17,5,55,45,2,5,5,225,72,1,217,1,219,72,72,254,88,1,123,254,133,1,205,254,
+51,8,1,70,254,159,40,161,110,168,205,103,142,128,112,132,254,90,31,1,53,254,
+203,3,118,254,201,1,55,3,207,1,248,197,197,254,8,176,254,57,102,98,103,61,
+37,102,109,109,220,206,150,173,171,150,2,240,176,123,129,129,2,131,127,0,
+2,0,102,255,221,2,152,5,207,0,14,0,26,0,0,1,17,35,17,38,38,53,52,54,51,50,
+22,21,20,6,39,54,54,53,52,38,35,34,6,21,20,22,1,178,102,95,135,164,117,117,
+164,139,142,77,101,103,75,75,103,101,3,33,252,188,3,68,59,217,109,128,173,
+174,127,111,216,28,51,167,81,81,117,115,83,81,167,0,5,0,102,255,115,7,29,
+6,41,0,55,0,67,0,79,0,91,0,103,0,0,18,54,51,50,22,23,33,17,38,38,53,52,54,
+51,50,22,21,20,6,7,17,33,54,54,51,50,22,21,20,6,35,34,38,39,33,17,22,22,21,
+20,6,35,34,38,53,52,54,55,17,33,6,6,35,34,38,53,0,54,53,52,38,35,34,6,21,
+20,22,51,0,38,35,34,6,21,20,22,51,50,54,53,0,54,53,52,38,35,34,6,21,20,22,
+51,0,38,35,34,6,21,20,22,51,50,54,53,102,130,92,75,120,18,1,118,76,94,129,
+91,92,129,95,73,1,116,19,122,75,92,127,127,92,79,120,19,254,142,71,97,130,
+91,92,128,94,76,254,138,17,119,77,93,129,3,140,69,71,47,49,68,68,49,2,245,
+68,48,48,71,69,50,49,67,253,60,69,71,47,49,68,68,49,253,247,68,48,48,71,69,
+50,49,67,3,42,128,95,73,1,115,16,122,77,93,128,129,92,77,120,16,254,139,74,
+94,129,92,92,127,93,77,254,137,18,120,77,92,127,127,92,75,121,19,1,119,76,
+94,128,91,253,12,68,49,49,70,69,50,50,67,3,38,69,70,49,49,68,67,50,2,10,68,
+49,49,70,69,50,50,67,254,40,69,70,49,49,68,67,50,0,4,0,102,255,236,5,217,
+5,170,0,31,0,43,0,55,0,67,0,0,1,51,54,54,51,50,22,21,20,6,35,34,38,39,35,
+17,37,23,5,6,6,35,34,38,53,51,20,22,51,50,54,53,0,54,53,52,38,35,34,6,21,
+20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,22,54,53,52,38,35,34,6,21,20,
+22,51,2,43,221,18,205,136,149,213,214,148,136,204,19,119,1,5,53,254,194,18,
+137,111,125,160,103,103,79,77,91,2,175,153,153,107,108,153,153,108,67,96,
+96,67,68,96,96,68,24,37,37,24,25,37,37,25,4,115,134,177,213,150,150,212,177,
+134,253,80,168,86,205,119,126,186,141,98,127,111,98,2,24,153,107,108,153,
+153,108,107,153,1,168,96,68,67,96,96,67,68,96,225,37,24,25,37,37,25,24,37,
+0,1,0,102,1,168,5,170,3,174,0,34,0,0,19,20,22,51,50,62,2,51,50,30,2,51,50,
+54,53,51,20,2,35,34,46,3,35,34,14,2,35,34,2,53,205,92,80,52,69,81,110,87,
+87,111,77,71,54,81,91,102,138,134,62,100,66,48,68,56,76,69,65,114,79,132,
+141,3,174,195,221,80,207,98,98,202,85,222,194,234,254,228,59,107,128,91,136,
+155,94,1,27,235,0,1,0,102,0,0,3,182,3,223,0,19,0,0,1,23,53,51,21,55,23,7,
+21,1,23,1,17,35,17,1,55,1,53,39,1,53,166,103,165,70,235,1,47,69,254,140,103,
+254,139,70,1,47,235,3,195,162,190,190,162,74,227,142,1,41,74,254,150,254,
+131,1,125,1,106,74,254,215,142,227,0,3,0,102,255,193,4,195,6,0,0,34,0,46,
+0,58,0,0,1,6,21,20,22,51,50,18,19,6,35,34,36,53,52,54,51,50,18,19,54,54,55,
+23,6,6,7,2,0,35,34,38,53,52,55,1,53,52,2,35,34,6,21,20,4,51,50,2,22,21,20,
+6,35,34,38,53,52,54,51,1,57,98,89,83,160,207,18,27,61,228,254,158,190,142,
+190,249,6,72,121,69,78,84,165,93,19,254,251,210,124,150,131,2,20,190,142,
+107,132,1,34,189,50,254,50,50,38,37,49,49,37,1,168,87,106,92,100,1,147,1,
+64,4,254,196,145,183,254,156,254,221,25,93,85,66,104,116,26,254,125,254,56,
+157,137,147,120,1,112,6,247,1,59,124,102,152,196,1,164,51,37,37,49,49,37,
+37,51,0,0,2,0,102,255,164,4,74,6,39,0,21,0,25,0,0,1,1,17,20,6,35,34,38,53,
+51,20,22,51,50,54,53,17,1,53,1,51,9,4,4,74,254,110,151,137,132,174,103,116,
+87,86,100,254,113,1,157,72,1,162,254,59,1,84,254,172,254,174,4,63,254,113,
+254,66,149,185,198,154,110,140,124,108,1,190,1,141,72,1,162,254,96,254,137,
+1,82,1,84,254,172,0,3,0,102,255,125,3,184,6,96,0,28,0,46,0,58,0,0,1,17,33,
+53,33,21,33,17,22,22,21,20,6,7,17,35,17,6,35,34,39,17,35,17,38,38,53,52,54,
+3,53,52,54,51,50,22,21,21,54,53,52,38,35,34,6,21,20,5,53,52,38,35,34,6,21,
+21,22,51,50,1,219,254,139,3,82,254,138,153,209,103,92,102,56,61,58,56,103,
+93,103,210,14,116,101,98,121,93,184,128,129,182,1,172,64,53,52,62,51,63,58,
+4,139,1,111,102,102,254,145,19,234,156,108,186,59,253,236,1,231,16,16,254,
+25,2,18,58,190,107,160,232,253,152,125,112,144,135,108,136,89,133,129,182,
+181,130,136,153,203,63,78,86,68,192,21,0,0,4,0,102,0,0,3,66,4,201,0,20,0,
+35,0,38,0,41,0,0,0,22,21,20,6,7,21,51,21,1,35,1,53,51,53,38,38,53,52,54,51,
+3,53,51,21,54,54,53,52,38,35,34,6,21,20,22,19,21,55,7,53,35,2,106,216,179,
+137,254,254,244,72,254,242,254,137,177,215,150,51,102,92,121,154,110,110,
+152,118,195,96,198,97,4,201,216,151,136,205,19,103,71,254,188,1,68,71,103,
+18,206,136,152,215,253,143,195,195,18,146,94,108,156,155,109,94,146,254,187,
+115,115,115,115,0,2,0,102,0,0,5,211,4,156,0,26,0,30,0,0,1,17,51,17,51,17,
+33,39,39,55,19,21,33,17,35,17,35,17,35,17,33,53,19,23,3,33,17,19,51,53,35,
+2,164,235,103,1,96,81,79,90,195,254,35,103,235,103,254,41,193,90,158,1,90,
+103,235,235,4,133,254,170,1,86,254,170,160,160,45,254,116,71,253,55,1,135,
+254,121,2,201,71,1,140,45,254,192,1,86,253,105,219,0,0,1,0,184,0,0,5,205,
+3,188,0,11,0,0,37,17,33,17,35,17,33,17,35,17,33,17,3,14,254,17,103,5,21,103,
+254,15,236,2,106,252,170,3,188,252,68,3,86,253,150,0,0,3,0,184,0,0,3,150,
+5,147,0,19,0,22,0,25,0,0,1,5,5,7,37,5,17,5,37,23,5,5,7,37,5,35,17,51,5,37,
+5,21,55,3,21,55,3,150,254,239,1,17,60,254,211,254,242,1,14,1,45,60,254,241,
+1,15,60,254,211,254,211,72,72,1,45,1,45,253,197,180,180,180,5,63,192,193,
+84,213,192,254,135,186,209,84,187,186,84,207,207,5,147,213,213,149,254,127,
+253,10,248,125,0,1,0,102,0,0,7,182,3,182,0,25,0,0,37,51,19,3,1,33,53,51,1,
+51,19,19,51,1,51,21,33,1,3,19,51,21,33,3,3,33,2,84,238,147,190,254,124,254,
+211,236,1,162,71,211,211,72,1,160,237,254,211,254,123,190,149,238,254,211,
+144,139,254,211,102,1,45,1,134,252,231,102,3,80,254,82,1,174,252,176,102,
+3,25,254,122,254,211,102,1,31,254,225,0,1,0,102,255,236,4,240,5,14,0,43,0,
+0,1,55,39,55,6,6,7,39,54,36,51,50,4,23,7,38,38,39,7,23,21,7,23,7,6,6,21,20,
+22,51,50,54,55,23,6,6,35,34,38,53,52,54,55,39,2,63,197,199,43,145,224,46,
+99,62,1,66,198,193,1,63,68,95,53,243,150,33,221,202,209,31,177,151,83,75,
+54,113,46,82,59,157,79,119,141,131,147,160,2,193,149,94,240,20,184,134,33,
+180,231,223,182,37,144,184,10,182,105,72,151,111,65,71,130,72,71,78,67,60,
+62,78,89,136,115,93,154,71,84,0,0,2,0,102,255,193,5,57,6,0,0,43,0,51,0,0,
+1,35,34,4,7,22,17,16,7,22,4,51,51,21,35,34,36,39,6,4,35,35,53,51,50,54,55,
+38,17,16,55,38,38,35,35,53,51,50,4,23,54,36,51,51,1,6,21,20,23,54,53,52,5,
+57,51,139,254,253,100,166,166,96,1,0,146,51,51,160,254,218,113,110,254,224,
+167,52,52,146,255,96,166,166,96,255,146,52,52,167,1,32,110,110,1,40,161,51,
+253,150,131,131,133,5,154,110,101,216,254,240,254,239,214,97,112,102,120,
+113,109,124,102,112,97,217,1,14,1,13,219,97,114,102,126,110,112,124,254,119,
+184,224,225,182,182,225,224,0,0,2,0,102,255,186,4,248,5,199,0,27,0,38,0,0,
+1,1,7,3,3,38,39,6,2,7,39,54,18,55,38,38,53,52,54,51,50,22,21,20,7,22,23,1,
+1,54,53,52,38,35,34,6,21,20,22,3,209,1,39,94,236,233,106,87,43,164,114,86,
+104,167,42,147,173,121,96,115,131,30,58,52,1,4,254,47,23,77,67,49,65,127,
+5,109,253,75,41,2,45,253,224,11,34,207,254,100,164,58,150,1,153,211,80,248,
+135,117,141,186,154,159,169,24,9,2,99,253,239,151,128,109,128,83,72,102,192,
+0,0,3,0,102,255,199,3,213,6,2,0,13,0,18,0,22,0,0,1,3,33,21,1,35,1,53,33,3,
+53,19,51,19,3,55,18,55,33,37,55,39,7,3,0,141,1,98,254,109,72,254,108,1,101,
+142,189,72,190,227,77,186,46,253,149,1,56,129,129,129,4,92,254,242,72,252,
+193,3,63,72,1,16,72,1,92,254,162,251,196,160,1,133,90,162,248,236,236,0,0,
+3,0,102,0,0,3,242,5,70,0,17,0,20,0,23,0,0,9,2,21,33,53,1,1,53,33,53,51,21,
+51,53,51,21,33,5,9,3,33,3,242,254,123,1,133,252,116,1,131,254,127,1,13,102,
+164,102,1,13,253,16,1,41,1,43,254,213,254,215,2,84,4,12,254,29,254,31,72,
+72,1,225,1,223,76,242,242,242,242,102,254,141,1,115,253,233,254,143,0,1,0,
+184,0,0,4,82,4,197,0,17,0,0,33,17,52,2,35,34,2,21,17,35,17,16,0,51,50,0,21,
+17,3,236,208,151,152,206,103,1,10,195,194,1,11,2,137,194,1,19,254,254,211,
+253,119,2,137,1,3,1,57,254,175,235,253,119,0,5,0,102,1,8,11,31,4,33,0,78,
+0,90,0,102,0,114,0,126,0,0,19,54,54,51,50,23,53,52,55,38,38,35,34,6,7,39,
+54,54,51,50,22,23,54,54,51,50,22,23,54,54,51,50,23,54,54,51,50,22,23,7,38,
+38,35,34,6,7,22,21,21,54,51,50,22,23,7,38,38,35,34,6,7,6,6,35,34,38,39,6,
+6,35,34,38,39,38,38,35,34,6,7,4,54,53,52,38,35,34,6,21,20,22,51,0,6,21,20,
+22,51,50,54,53,52,38,35,2,38,53,52,54,51,50,22,21,20,6,35,36,22,21,20,6,35,
+34,38,53,52,54,51,102,81,222,95,125,125,41,91,134,66,72,174,70,82,81,222,
+95,84,156,110,53,147,87,105,180,53,50,181,106,169,118,108,156,86,97,219,82,
+82,70,174,72,81,140,71,43,121,128,97,219,82,82,70,174,72,78,133,69,47,192,
+118,104,181,52,55,178,105,119,193,45,87,125,68,72,174,70,4,47,168,168,118,
+119,166,167,118,2,45,168,169,117,118,167,165,120,40,56,56,40,41,54,54,41,
+253,133,56,56,40,41,54,54,41,1,217,109,137,76,8,96,80,70,57,113,91,61,109,
+137,62,84,59,70,104,90,89,105,129,84,62,136,110,61,91,113,71,56,86,90,8,76,
+136,110,61,91,113,66,52,108,126,104,89,90,103,127,107,65,53,113,91,45,168,
+116,119,168,169,118,117,167,2,59,168,119,118,166,167,117,118,169,254,131,
+54,40,41,56,56,41,40,54,191,56,41,40,54,54,40,41,56,0,0,2,0,102,255,115,4,
+117,6,29,0,29,0,38,0,0,1,17,35,17,1,35,17,7,35,34,38,39,55,22,22,51,50,55,
+17,52,54,51,50,22,21,20,6,7,17,1,37,54,54,53,52,38,35,34,21,4,117,103,254,
+113,72,30,33,111,196,95,74,79,159,90,43,20,101,98,87,112,162,133,1,143,254,
+113,85,107,54,42,96,3,207,251,164,3,137,253,240,2,176,2,82,92,73,77,68,4,
+1,0,135,146,131,97,123,225,43,254,15,2,14,82,38,157,85,57,68,178,0,7,0,102,
+255,109,10,4,4,254,0,32,0,41,0,50,0,60,0,72,0,84,0,96,0,0,1,22,21,20,2,7,
+35,38,2,53,52,55,6,4,35,34,39,39,18,0,33,50,22,23,54,51,32,0,19,7,6,35,32,
+37,2,0,33,34,7,0,33,50,37,22,51,32,1,38,35,32,0,1,54,18,53,16,3,6,2,21,16,
+18,22,21,20,6,35,34,38,53,52,54,51,0,22,21,20,6,35,34,38,53,52,54,51,4,38,
+53,52,54,51,50,22,21,20,6,35,6,104,17,131,156,72,151,137,14,121,254,212,189,
+97,180,35,135,1,220,1,96,45,134,89,178,91,1,95,1,219,136,35,180,96,254,149,
+2,43,121,254,95,254,207,63,101,1,14,2,33,89,247,183,106,87,2,33,1,14,103,
+61,254,206,254,94,3,224,119,102,221,112,109,254,51,51,35,35,49,49,35,253,
+179,51,51,35,36,48,48,36,4,194,51,51,35,35,49,49,35,2,195,76,94,164,254,184,
+192,177,1,78,173,89,79,111,117,33,63,1,112,1,81,11,12,23,254,175,254,144,
+63,33,121,1,39,1,27,11,253,183,18,18,2,73,11,254,228,252,101,153,1,17,142,
+1,27,1,48,156,254,231,150,254,216,1,134,51,35,35,49,49,35,35,51,1,94,51,35,
+35,49,49,35,35,51,170,49,35,35,51,51,35,35,49,0,0,2,0,102,255,236,6,51,5,
+184,0,67,0,71,0,0,37,51,50,54,53,52,38,35,33,21,20,6,35,34,38,53,53,51,21,
+20,22,51,50,54,53,17,35,34,38,53,52,54,51,51,21,35,34,6,21,20,22,51,33,53,
+52,54,51,50,22,21,21,35,53,52,38,35,34,6,21,17,51,50,22,21,20,6,35,35,1,33,
+17,33,4,254,33,75,99,95,77,253,69,140,114,108,148,103,87,66,70,82,135,118,
+157,157,120,33,33,75,99,96,76,2,186,140,114,108,148,102,89,65,68,83,135,121,
+153,155,121,33,253,104,1,205,254,51,84,87,67,68,83,135,121,153,154,122,33,
+33,75,99,97,75,2,186,139,115,111,145,102,88,66,68,83,135,121,153,154,122,
+33,33,74,100,96,76,253,70,140,114,110,146,1,254,1,204,0,3,0,102,0,0,5,211,
+5,35,0,23,0,26,0,29,0,0,33,17,33,17,35,17,33,53,1,51,1,21,33,17,33,17,33,
+53,1,51,1,21,33,17,3,33,3,1,33,3,4,88,253,137,102,254,235,1,35,72,1,37,254,
+235,2,119,254,236,1,34,72,1,37,254,235,233,1,106,180,252,109,1,106,180,1,
+162,254,94,3,49,72,1,170,254,86,72,254,215,1,41,72,1,170,254,86,72,252,207,
+3,152,1,8,254,248,1,8,0,2,0,102,0,176,4,201,5,18,0,27,0,31,0,0,19,33,53,33,
+53,33,17,51,17,51,17,51,17,33,21,33,21,33,21,33,17,35,17,35,17,35,17,33,37,
+51,53,35,102,1,84,254,172,1,84,103,239,103,1,82,254,174,1,82,254,174,103,
+239,103,254,172,1,187,239,239,2,104,240,102,1,84,254,172,1,84,254,172,102,
+240,102,254,174,1,82,254,174,1,82,102,240,0,3,0,102,0,0,4,180,5,252,0,13,
+0,17,0,24,0,0,1,7,39,1,39,53,1,51,1,21,7,33,17,33,19,17,33,17,1,21,55,39,
+7,23,53,1,123,203,74,1,7,252,1,28,72,1,12,239,2,194,252,199,102,2,109,253,
+147,150,201,211,160,3,29,215,69,1,23,229,72,1,45,254,229,71,252,252,98,3,
+55,253,47,2,209,1,109,133,159,209,227,141,133,0,0,2,0,102,255,197,4,115,5,
+225,0,37,0,49,0,0,55,55,17,38,38,53,52,0,51,50,0,21,20,6,7,21,23,7,39,21,
+35,53,7,39,55,53,6,35,34,39,17,23,7,39,21,35,53,7,0,54,53,52,38,35,34,6,21,
+20,22,51,102,199,87,99,1,43,209,209,1,42,98,88,195,54,141,102,146,53,199,
+101,118,122,98,195,53,142,102,145,2,122,238,239,166,169,237,238,168,119,129,
+1,186,63,185,109,189,1,13,254,241,187,105,187,65,151,127,86,94,187,189,96,
+86,129,90,43,43,254,127,127,86,94,186,188,96,2,145,210,147,146,210,212,144,
+147,210,0,0,4,0,102,255,147,3,25,5,246,0,74,0,84,0,93,0,103,0,0,23,54,54,
+55,6,35,34,38,53,52,54,51,50,22,23,54,54,53,52,39,6,35,34,38,53,52,54,51,
+50,23,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,7,39,
+54,54,51,50,22,21,20,7,22,22,21,20,7,22,22,21,20,6,7,2,5,1,38,38,35,34,21,
+20,22,51,50,19,38,35,34,6,21,20,51,50,19,38,35,34,6,21,20,22,51,50,102,177,
+212,29,16,37,97,126,85,74,82,110,23,36,36,28,98,105,93,106,106,87,119,92,
+16,76,46,131,73,84,90,116,99,90,84,9,143,116,45,91,23,49,30,122,56,164,197,
+21,59,64,45,27,29,89,71,21,254,27,1,145,11,63,51,57,59,62,34,11,52,65,52,
+60,71,87,149,57,80,47,44,56,41,69,10,42,139,89,4,88,66,72,81,77,62,37,92,
+37,40,54,63,73,66,66,73,65,30,35,96,60,53,62,71,60,69,85,33,24,23,80,104,
+25,16,91,21,32,165,122,52,44,45,127,72,82,59,40,92,38,76,160,47,254,226,128,
+1,220,42,52,41,23,39,2,236,16,28,23,29,254,230,37,22,15,18,19,0,4,0,184,255,
+236,5,92,4,68,0,18,0,22,0,26,0,38,0,0,19,33,17,33,21,22,22,21,20,6,35,34,
+38,53,52,54,55,53,33,1,17,33,17,1,33,17,33,0,54,53,52,38,35,34,6,21,20,22,
+51,184,4,164,253,225,74,90,126,89,89,126,91,73,253,225,2,133,1,185,252,41,
+1,184,254,72,2,25,67,69,44,46,66,65,47,4,68,253,229,150,19,118,71,89,126,
+126,89,73,116,19,150,1,180,254,178,1,78,254,178,1,78,252,117,67,46,47,65,
+66,46,45,68,0,0,3,0,184,0,0,3,213,5,147,0,10,0,15,0,27,0,0,51,17,51,5,7,37,
+1,1,37,23,5,1,38,0,39,17,18,22,21,20,6,35,34,38,53,52,54,51,184,72,2,197,
+17,253,187,2,102,253,154,2,69,17,253,59,2,66,147,254,225,113,245,56,56,38,
+39,56,56,39,5,147,110,103,93,253,176,253,174,94,102,113,2,203,138,1,26,110,
+251,219,2,113,56,38,38,56,56,38,38,56,0,3,0,102,255,236,7,76,4,242,0,53,0,
+64,0,75,0,0,5,2,3,2,3,39,18,1,39,38,39,6,35,34,38,53,52,54,51,50,22,23,54,
+55,23,6,7,22,23,54,54,55,38,39,55,22,23,54,54,51,50,22,21,20,6,35,34,38,39,
+6,7,7,0,19,1,38,38,35,34,6,21,20,22,51,50,37,22,51,50,54,53,52,38,35,34,6,
+5,25,85,235,239,80,101,85,1,14,13,159,50,163,168,116,149,150,117,86,158,77,
+42,79,90,58,79,58,163,53,109,57,73,62,90,50,69,78,158,88,117,149,151,113,
+83,160,91,84,123,14,1,10,90,252,246,68,126,62,75,91,94,72,125,3,79,133,123,
+73,93,93,75,60,125,20,1,15,1,66,254,184,254,247,22,1,39,1,104,17,193,53,183,
+142,108,114,144,94,76,57,134,49,112,104,62,200,65,136,61,96,120,49,96,95,
+76,94,144,114,109,141,84,99,90,156,17,254,158,254,211,3,225,65,83,89,67,60,
+87,153,153,88,59,68,88,84,0,4,0,102,255,236,5,18,5,143,0,66,0,72,0,79,0,86,
+0,0,55,36,55,38,39,35,34,38,53,52,54,55,38,53,51,53,52,38,35,34,6,21,21,35,
+53,52,54,51,50,23,54,51,50,22,21,21,35,53,52,38,35,34,6,21,21,51,20,7,22,
+22,21,20,6,35,35,6,7,22,4,23,7,38,36,39,6,4,7,1,22,18,23,54,19,1,38,39,6,
+21,20,22,37,6,7,50,54,53,52,102,1,93,186,53,45,17,112,101,77,67,7,203,52,
+46,48,54,103,110,95,95,54,52,98,94,111,103,54,48,45,53,202,8,68,78,99,114,
+19,35,63,92,1,24,164,24,175,254,214,101,102,254,215,174,1,168,6,82,61,129,
+21,254,166,23,14,55,41,1,225,8,29,50,42,78,90,235,81,114,92,94,65,95,17,59,
+65,134,45,57,59,50,32,32,88,123,59,59,123,88,32,32,49,60,55,47,134,57,67,
+17,94,66,92,94,97,98,115,168,42,98,43,172,122,123,171,43,3,235,118,254,249,
+106,215,1,16,254,229,75,85,22,54,42,42,160,49,111,41,43,54,0,0,1,0,102,254,
+123,5,211,6,147,0,50,0,0,5,1,38,38,53,52,18,53,52,38,39,39,55,22,18,21,20,
+2,21,20,22,51,50,54,53,52,2,53,52,18,55,23,7,6,6,21,20,18,21,20,6,7,1,7,1,
+7,17,35,17,39,1,1,20,1,41,163,154,135,154,105,30,41,159,192,136,187,252,246,
+192,135,192,158,41,29,107,153,135,154,165,1,43,74,254,154,37,103,38,254,155,
+238,1,50,27,179,168,173,1,120,166,144,222,52,14,94,70,254,234,178,186,254,
+138,155,154,134,131,157,153,1,121,185,180,1,21,69,94,14,53,221,144,166,254,
+140,177,166,181,27,254,206,73,1,108,2,254,72,1,184,2,254,148,0,0,10,0,102,
+255,147,4,94,6,102,0,41,0,48,0,54,0,60,0,64,0,70,0,74,0,78,0,82,0,88,0,0,
+1,6,21,20,22,22,18,21,21,7,7,6,5,39,54,53,52,2,39,7,39,55,38,39,39,55,23,
+54,55,39,55,23,54,55,39,55,23,54,51,50,22,23,3,6,7,54,55,54,53,1,22,23,37,
+38,39,3,22,23,37,38,39,37,37,39,5,19,37,52,39,5,23,1,22,23,55,39,6,7,23,39,
+6,7,23,55,23,54,55,38,35,3,160,109,184,84,31,2,6,177,254,163,54,62,215,10,
+248,17,224,13,4,205,13,205,10,33,117,45,143,22,48,76,70,116,49,56,65,111,
+31,244,11,24,230,133,4,254,94,18,29,1,53,24,35,223,6,8,1,57,7,11,254,82,1,
+29,29,254,182,217,1,64,4,254,194,2,254,232,4,12,232,203,22,13,242,76,26,21,
+157,17,51,12,21,25,55,5,141,100,80,56,241,224,254,228,143,58,66,134,111,33,
+68,208,169,231,1,126,18,39,102,35,39,63,29,102,28,37,55,55,94,67,19,28,70,
+77,104,12,33,22,250,238,108,83,28,68,64,108,1,236,34,81,139,65,56,254,152,
+23,53,100,63,50,170,141,39,51,253,82,76,48,46,100,31,3,47,37,33,35,201,28,
+34,34,196,9,15,74,125,45,17,18,10,0,0,3,0,102,255,236,3,2,5,68,0,17,0,29,
+0,41,0,0,1,19,51,1,7,39,3,22,22,21,20,6,35,34,38,53,52,54,0,54,53,52,38,35,
+34,6,21,20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,1,129,2,72,1,53,66,213,
+2,118,165,195,139,138,196,164,1,11,135,137,95,94,137,135,96,43,62,61,44,43,
+59,59,43,2,131,2,193,254,245,77,180,253,227,18,186,126,138,195,197,136,125,
+187,253,225,137,94,95,137,135,97,96,135,1,80,61,44,42,60,59,43,43,62,0,3,
+0,102,255,236,7,61,5,68,0,43,0,54,0,65,0,0,1,6,7,18,21,20,6,35,34,38,53,52,
+19,38,38,39,55,22,22,23,54,54,55,22,22,23,54,54,55,23,6,6,7,18,21,20,6,35,
+34,38,53,52,19,38,0,3,6,6,21,20,22,51,50,54,53,36,3,6,6,21,20,22,51,50,54,
+53,3,209,200,140,229,166,127,127,165,229,84,227,97,66,82,234,89,80,226,98,
+83,228,94,93,229,84,65,103,228,76,229,166,127,127,165,229,135,1,133,191,88,
+102,107,83,84,107,252,215,191,88,102,107,83,84,107,4,186,189,185,254,188,
+221,146,165,165,146,221,1,68,111,241,82,78,63,246,115,105,239,80,66,239,119,
+119,241,64,78,88,245,101,254,188,221,146,165,165,146,221,1,68,179,253,228,
+1,19,127,240,92,98,111,113,96,184,1,19,127,240,92,98,111,113,96,0,0,1,0,102,
+255,236,5,158,5,41,0,39,0,0,1,7,17,20,6,35,34,17,17,52,38,35,34,6,21,17,23,
+7,39,7,39,55,17,52,54,51,50,17,17,20,22,51,50,54,53,17,39,55,23,55,5,158,
+224,136,111,248,74,72,65,80,223,76,198,199,76,224,136,111,248,74,72,67,78,
+223,76,198,199,4,227,227,253,203,114,144,1,49,1,33,108,94,86,69,253,200,225,
+69,200,200,69,225,2,56,114,144,254,207,254,223,108,95,89,67,2,53,227,70,201,
+201,0,3,0,102,255,223,5,172,5,188,0,16,0,25,0,32,0,0,19,33,17,54,36,51,50,
+22,21,20,2,0,7,21,35,17,33,5,6,0,7,17,36,0,53,52,1,54,0,55,35,34,1,102,1,
+248,161,1,34,114,136,145,231,254,95,198,102,254,110,4,160,65,254,65,168,1,
+19,1,213,253,24,154,1,85,79,9,215,254,162,5,188,254,117,156,166,133,119,124,
+254,162,254,129,118,201,5,119,100,115,254,48,124,254,240,178,2,9,159,79,253,
+234,126,1,102,114,254,144,0,1,0,184,0,0,4,160,5,20,0,22,0,0,1,17,54,36,51,
+50,22,21,20,6,7,53,54,54,53,52,38,35,32,3,17,35,17,1,31,112,1,13,143,171,
+202,126,93,49,67,147,119,254,225,241,103,5,20,254,7,160,151,160,131,91,136,
+6,102,9,72,52,83,104,254,133,253,143,5,20,0,5,0,102,255,227,7,147,5,203,0,
+32,0,44,0,56,0,68,0,80,0,0,9,2,22,22,21,20,6,35,34,38,53,52,54,51,50,23,1,
+51,1,54,51,50,22,21,20,6,35,34,38,53,52,54,0,54,53,52,38,35,34,6,21,20,22,
+51,32,54,53,52,38,35,34,6,21,20,22,51,0,22,21,20,6,35,34,38,53,52,54,51,32,
+22,21,20,6,35,34,38,53,52,54,51,5,121,254,131,254,131,77,89,207,145,144,207,
+207,144,45,47,1,182,72,1,184,43,49,146,206,207,145,145,205,90,1,107,147,147,
+103,104,144,144,104,251,248,147,146,103,104,144,144,104,4,147,53,53,37,37,
+51,51,37,251,183,53,53,37,38,50,50,38,2,106,2,201,253,55,48,158,90,146,205,
+205,146,145,207,12,3,53,252,203,12,205,147,146,205,205,146,94,156,254,14,
+145,103,102,147,146,103,103,145,144,104,103,146,146,103,103,145,1,82,53,37,
+38,51,51,38,37,53,53,37,38,51,51,38,37,53,0,0,3,0,102,255,139,3,57,6,12,0,
+44,0,56,0,68,0,0,0,22,21,20,6,35,35,21,37,23,7,6,6,21,20,51,50,54,53,52,38,
+39,55,22,22,21,20,6,35,34,38,53,52,54,55,55,7,35,17,38,38,53,52,54,51,18,
+54,53,52,38,35,34,6,21,20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,2,89,210,
+208,146,11,1,54,47,127,236,116,182,90,127,77,71,25,105,120,181,136,147,140,
+102,117,148,170,72,110,134,210,145,103,149,149,103,103,149,149,103,34,48,
+48,34,34,46,46,34,6,12,208,146,144,210,201,115,84,138,253,161,46,86,81,72,
+46,72,19,99,26,123,87,120,136,102,93,57,161,126,162,70,1,88,37,186,113,145,
+209,253,162,149,103,103,149,149,103,103,149,1,78,48,34,34,46,46,34,34,48,
+0,0,1,0,184,0,0,5,203,5,20,0,25,0,0,1,17,1,51,17,35,17,1,21,1,7,1,17,35,17,
+37,17,35,17,51,17,5,53,39,55,17,2,172,2,184,103,103,253,72,1,141,61,254,176,
+102,254,217,103,103,1,39,2,2,5,20,253,238,2,18,252,115,3,12,253,238,254,254,
+207,82,1,2,254,254,1,80,227,253,205,5,20,253,160,227,221,4,2,2,96,0,0,1,0,
+102,255,236,5,193,5,184,0,35,0,0,1,33,17,54,54,53,51,20,2,35,34,2,53,51,20,
+22,23,17,33,6,6,35,34,38,53,53,51,21,20,51,50,54,53,33,17,33,2,27,2,2,150,
+167,103,249,223,224,247,103,166,151,254,180,12,131,110,127,136,103,160,78,
+81,1,170,254,101,5,184,250,156,15,219,186,249,254,237,1,22,246,186,218,16,
+3,63,140,122,170,148,47,45,217,107,155,1,88,0,2,0,102,0,0,5,14,5,203,0,31,
+0,41,0,0,1,23,17,51,21,55,23,7,17,35,38,38,39,19,33,53,33,3,36,38,53,52,54,
+51,50,22,21,21,22,23,17,39,3,53,52,38,35,34,6,21,20,22,3,51,166,102,134,73,
+207,71,142,134,48,2,253,176,1,234,2,254,250,215,143,111,156,169,173,120,235,
+160,114,109,70,82,165,5,98,155,1,4,248,141,69,222,253,179,24,31,16,253,201,
+102,1,246,89,206,141,99,145,253,195,164,49,19,1,223,222,253,170,129,161,185,
+83,63,97,154,0,5,0,102,0,0,5,145,5,43,0,23,0,28,0,33,0,38,0,43,0,0,1,21,22,
+22,23,51,21,35,6,6,7,21,35,53,38,38,39,35,53,51,54,54,55,53,1,38,38,39,17,
+17,54,54,55,33,33,22,22,23,17,17,6,6,7,33,3,49,160,219,16,213,213,16,224,
+155,102,155,225,18,215,215,18,221,159,1,139,18,160,115,115,160,18,254,219,
+254,115,16,162,117,116,163,16,1,39,5,43,215,18,222,155,103,156,223,18,213,
+213,18,222,157,103,155,222,18,215,253,158,114,160,19,254,219,254,114,18,163,
+114,111,165,19,1,39,1,140,18,164,111,0,0,1,0,184,255,201,4,78,5,229,0,19,
+0,0,5,17,33,17,35,17,33,17,33,17,51,17,33,17,51,17,33,17,33,17,3,231,253,
+56,103,1,152,254,104,103,2,200,103,254,104,1,152,55,1,143,254,113,1,245,2,
+50,1,245,254,113,1,143,254,11,253,206,254,11,0,2,0,102,0,0,4,143,5,25,0,10,
+0,13,0,0,33,33,53,1,1,55,1,1,23,9,3,33,4,143,251,215,1,213,254,146,86,1,88,
+1,88,86,254,145,1,213,253,236,254,129,2,254,72,2,147,2,4,58,254,26,1,230,
+58,253,252,253,109,2,57,253,229,0,0,1,0,102,255,53,4,127,6,141,0,38,0,0,1,
+37,37,53,1,23,1,5,21,5,22,4,22,21,20,0,35,34,36,53,52,54,55,23,7,6,6,21,20,
+22,51,50,54,53,52,38,38,37,39,1,127,1,195,254,10,1,250,61,254,92,2,15,254,
+63,71,1,92,175,254,207,242,215,254,225,58,49,76,16,29,35,232,167,198,247,
+89,190,254,247,122,3,59,224,186,72,1,112,82,254,207,196,72,223,27,147,213,
+133,212,254,242,241,179,98,176,52,58,27,46,128,67,135,182,210,171,76,135,
+116,101,47,0,1,0,102,0,0,4,221,3,250,0,26,0,0,1,7,39,38,38,39,19,33,21,33,
+3,35,3,33,53,33,19,6,6,7,7,39,54,36,51,50,4,4,184,80,31,49,156,89,168,1,18,
+254,156,191,49,190,254,155,1,19,166,89,155,48,32,80,114,1,1,164,161,1,0,2,
+227,65,38,63,105,21,252,225,102,3,147,252,109,102,3,31,21,105,63,38,65,145,
+134,131,0,2,0,102,255,233,2,225,5,168,0,39,0,51,0,0,19,33,53,38,38,53,52,
+54,55,55,35,53,55,35,53,51,21,7,51,21,7,22,22,21,20,6,7,21,33,21,33,21,23,
+7,39,7,39,55,53,33,0,54,53,52,38,35,34,6,21,20,22,51,102,1,11,97,122,134,
+99,43,158,76,53,219,78,152,78,84,100,122,97,1,10,254,246,223,69,205,205,70,
+224,254,245,1,131,99,97,71,72,96,99,69,1,244,102,19,148,99,101,154,14,51,
+72,86,102,72,86,71,95,27,142,87,98,150,18,102,103,127,219,74,201,201,74,221,
+125,1,47,99,69,68,100,101,67,69,99,0,0,2,0,102,255,209,2,248,5,246,0,42,0,
+54,0,0,19,23,53,38,38,53,52,54,51,50,22,21,20,6,7,21,55,23,7,23,7,39,17,55,
+23,7,23,7,39,21,35,53,7,39,55,39,55,23,17,7,39,55,39,36,54,53,52,38,35,34,
+6,21,20,22,51,147,232,111,145,175,132,129,180,144,114,234,45,219,219,45,234,
+234,45,219,219,45,234,102,232,45,220,220,45,232,232,45,220,220,1,158,121,
+121,86,87,118,118,87,3,170,121,96,18,168,118,127,182,180,129,116,169,19,96,
+121,90,113,112,91,121,254,213,121,90,113,112,90,120,237,235,118,90,112,113,
+90,121,1,41,119,91,112,113,164,117,88,87,119,122,84,86,119,0,0,2,0,102,255,
+236,5,106,5,215,0,38,0,77,0,0,1,5,22,22,21,20,6,35,34,38,53,52,54,51,50,23,
+7,38,35,34,6,21,20,22,51,50,54,53,52,38,39,53,37,39,53,1,23,1,5,51,37,1,55,
+1,21,7,5,21,6,6,21,20,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,
+35,34,38,53,52,54,55,37,2,123,255,0,129,158,165,134,109,156,129,88,69,54,
+53,28,42,48,66,93,73,88,104,167,160,1,22,252,1,76,74,254,221,1,2,219,1,2,
+254,221,74,1,76,252,1,22,151,176,103,89,73,93,68,47,41,28,53,54,68,88,129,
+157,107,134,165,158,129,255,0,3,125,209,67,223,115,138,161,130,111,106,122,
+35,86,18,70,55,62,77,107,90,102,188,70,72,215,184,72,1,57,76,254,246,188,
+188,1,10,76,254,199,72,184,215,72,63,189,108,91,106,77,62,56,69,18,86,35,
+123,105,113,128,161,138,115,223,67,209,0,0,3,0,102,255,162,5,61,6,0,0,35,
+0,44,0,53,0,0,19,21,54,33,51,53,33,53,33,17,51,21,51,32,23,53,51,17,35,53,
+6,33,35,17,33,21,33,17,35,17,35,32,39,21,35,17,1,17,51,50,54,53,52,38,35,
+3,51,17,35,34,6,21,20,22,205,113,1,30,64,253,202,2,54,102,70,1,30,113,102,
+102,113,254,226,70,2,59,253,197,102,64,254,226,113,103,2,156,70,178,184,183,
+179,236,64,64,179,183,183,2,254,201,101,231,102,2,25,143,101,201,253,70,200,
+98,253,143,102,254,248,1,8,98,200,2,186,2,12,254,221,76,70,70,75,252,6,1,
+35,75,70,71,75,0,0,7,0,104,255,74,4,215,6,137,0,71,0,83,0,95,0,107,0,119,
+0,131,0,143,0,0,37,53,37,53,55,39,53,55,39,53,55,39,53,37,53,16,35,34,6,21,
+7,52,54,51,50,23,54,51,50,22,21,39,52,38,35,34,17,21,5,21,7,23,21,7,23,21,
+7,23,21,5,21,16,51,50,54,53,55,20,6,35,34,39,6,35,34,38,53,23,20,22,51,50,
+3,7,23,21,7,23,21,7,5,17,5,23,33,55,37,17,37,39,53,55,39,53,55,39,18,22,21,
+20,6,35,34,38,53,52,54,51,0,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,
+35,34,38,53,52,54,51,0,22,21,20,6,35,34,38,53,52,54,51,2,109,254,10,186,186,
+186,186,188,188,1,246,201,103,110,103,163,153,177,75,70,182,149,166,102,111,
+102,201,1,246,189,189,187,187,187,187,254,10,201,103,110,102,162,153,182,
+70,75,177,151,165,103,109,104,201,132,184,184,186,186,153,1,29,254,229,151,
+1,109,152,254,229,1,29,154,186,186,184,184,102,45,45,32,32,44,44,32,254,40,
+46,46,32,32,44,44,32,2,24,45,45,32,32,44,44,32,254,40,46,46,32,32,44,44,32,
+182,84,113,72,81,80,70,78,80,69,78,82,72,112,56,1,6,159,132,2,179,216,125,
+125,212,183,2,134,157,254,250,56,112,72,82,78,69,80,78,70,80,81,72,113,84,
+254,250,157,134,2,180,215,125,125,211,184,2,133,158,4,10,82,77,70,78,80,71,
+64,63,3,12,62,63,63,62,252,244,63,64,71,80,78,70,77,82,253,4,45,32,32,44,
+44,32,32,45,4,240,46,32,32,44,44,32,32,46,46,32,32,44,44,32,32,46,251,16,
+45,32,32,44,44,32,32,45,0,0,3,0,102,255,236,4,166,5,109,0,29,0,38,0,47,0,
+0,19,33,17,55,53,52,54,51,50,22,21,20,5,21,1,21,33,17,7,21,20,6,35,34,38,
+53,52,37,53,1,1,53,6,6,21,20,22,51,50,1,54,54,53,52,38,35,34,21,174,1,107,
+219,124,115,89,106,254,180,1,4,254,150,219,126,114,91,104,1,76,254,252,1,
+4,109,120,50,44,135,1,168,107,122,50,44,135,5,88,253,66,149,234,164,176,118,
+100,218,187,61,253,135,72,2,178,147,224,162,177,118,99,218,187,62,2,120,252,
+47,168,67,156,67,55,60,3,31,65,155,70,55,60,237,0,3,0,102,255,211,5,156,5,
+227,0,26,0,38,0,50,0,0,19,33,53,33,53,33,17,33,21,33,17,16,33,50,18,53,53,
+51,21,20,0,35,32,0,17,17,33,0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,
+38,35,34,6,21,20,22,51,102,1,95,254,161,1,197,1,203,254,53,1,160,153,209,
+103,254,253,206,255,0,254,250,254,161,3,176,111,113,79,79,114,113,80,37,53,
+53,37,38,53,53,38,4,166,215,102,254,195,103,254,152,253,98,1,2,174,54,56,
+215,254,195,1,139,1,121,1,104,254,105,114,79,80,112,111,81,80,113,254,229,
+53,37,38,53,53,38,37,53,0,3,0,102,255,236,4,88,5,184,0,13,0,20,0,27,0,0,0,
+22,18,21,20,2,6,35,34,0,17,16,0,51,1,33,2,2,35,34,2,1,33,22,18,51,50,18,2,
+239,232,129,129,234,143,217,254,225,1,28,220,254,111,3,35,13,225,164,165,
+225,3,24,252,221,11,225,165,164,225,5,184,192,254,165,204,208,254,171,192,
+1,161,1,68,1,64,1,167,253,76,1,3,1,75,254,174,254,158,252,254,176,1,72,0,
+4,0,102,0,0,6,90,5,47,0,30,0,34,0,38,0,44,0,0,1,18,23,33,54,19,51,1,21,33,
+6,7,22,22,23,21,38,36,39,6,4,7,53,54,54,55,38,39,33,53,1,5,6,7,41,2,38,39,
+19,22,22,23,54,55,2,106,12,70,1,72,70,12,72,1,188,253,244,62,112,99,250,132,
+155,254,231,109,112,254,234,155,129,247,104,105,69,253,245,1,189,2,143,23,
+42,1,77,251,68,1,78,47,19,209,26,74,29,78,51,5,47,254,204,228,240,1,40,253,
+201,72,178,156,117,129,6,102,5,141,126,127,140,5,102,6,125,121,146,188,72,
+2,55,194,194,148,161,181,254,67,67,140,43,114,136,0,0,1,0,102,0,0,4,45,5,
+4,0,9,0,0,33,1,55,1,17,51,17,1,23,1,2,39,254,63,74,1,103,102,1,102,74,254,
+64,1,188,74,254,154,4,100,251,156,1,102,74,254,68,0,0,5,0,102,255,236,4,150,
+5,150,0,54,0,67,0,78,0,90,0,98,0,0,0,23,55,38,53,52,55,38,38,53,52,54,51,
+50,22,23,51,50,55,23,6,35,35,7,21,20,23,54,51,50,22,21,20,6,35,34,39,22,21,
+20,6,35,34,38,53,52,55,6,35,34,38,53,52,54,51,19,6,21,20,22,51,50,54,53,52,
+39,38,39,6,54,55,38,35,34,6,21,20,22,51,37,22,23,22,51,50,54,53,52,38,35,
+34,3,2,35,34,6,21,20,22,2,0,121,29,13,4,186,193,113,86,115,146,18,61,198,
+126,18,117,225,59,2,4,63,80,114,161,143,122,39,34,6,111,96,90,117,14,27,38,
+119,156,158,117,229,76,60,45,51,53,14,41,49,209,104,39,90,102,75,97,99,73,
+1,145,31,6,44,50,77,85,105,67,65,185,36,140,41,55,138,2,236,121,32,72,88,
+75,62,20,147,124,74,109,194,185,22,100,25,70,55,67,35,27,120,89,96,111,10,
+47,41,127,147,157,115,53,35,8,124,83,87,122,254,198,93,89,72,98,91,81,50,
+89,25,49,33,59,54,98,63,43,44,61,184,130,31,23,56,49,46,60,1,158,1,12,47,
+33,74,96,0,0,2,0,102,255,199,4,109,5,197,0,37,0,49,0,0,1,6,6,21,20,31,2,22,
+21,20,4,7,39,54,54,53,52,38,38,53,52,55,33,22,21,20,6,35,34,38,53,52,54,51,
+50,23,33,0,54,53,52,38,35,34,6,21,20,22,51,4,57,134,105,94,40,83,74,254,221,
+238,37,214,249,162,129,183,254,161,23,145,101,101,145,146,100,92,70,2,59,
+253,96,83,84,60,58,85,84,59,5,51,160,189,60,87,94,39,88,87,115,123,250,96,
+94,95,198,84,92,153,161,102,146,232,58,64,125,172,172,125,125,174,74,254,
+92,116,79,80,116,115,81,80,115,0,0,4,0,102,255,182,7,201,6,47,0,86,0,141,
+0,151,0,161,0,0,1,51,55,38,38,39,55,22,22,23,54,51,50,22,21,20,6,35,34,39,
+17,33,17,6,35,34,38,53,52,54,51,50,23,54,55,23,6,6,7,23,51,21,35,21,51,21,
+35,21,51,21,35,21,51,21,35,21,51,21,35,21,51,21,35,21,33,53,35,53,51,53,35,
+53,51,53,35,53,51,53,35,53,51,53,35,53,51,53,35,3,7,23,21,7,23,21,7,23,21,
+7,23,21,7,23,21,7,23,21,7,23,21,7,23,21,7,39,55,39,53,55,39,53,55,39,53,55,
+39,53,55,39,53,55,39,53,55,39,53,55,39,53,55,39,55,23,1,22,51,50,54,53,52,
+38,35,34,5,38,35,34,6,21,20,22,51,50,5,55,187,2,66,113,36,90,24,87,38,55,
+171,103,116,111,104,82,72,251,127,72,82,103,112,118,102,168,57,89,60,90,37,
+116,64,4,187,187,187,187,187,187,187,187,187,187,187,187,3,181,187,187,187,
+187,187,187,187,187,187,187,187,133,110,110,110,110,110,110,110,110,110,110,
+110,110,110,110,108,108,248,45,115,131,111,111,111,111,111,111,111,111,111,
+111,111,109,111,111,123,109,45,248,1,180,70,70,53,59,66,50,102,251,63,34,
+99,50,67,61,51,70,3,244,45,43,122,62,53,40,100,30,162,109,69,84,92,29,251,
+202,4,54,29,92,84,70,108,162,71,99,53,62,123,42,45,103,61,103,61,102,62,102,
+62,102,61,103,61,61,103,61,102,62,102,62,102,61,103,61,1,232,41,41,72,41,
+41,71,41,41,72,41,41,72,41,41,71,41,41,72,41,41,71,41,41,72,117,94,54,49,
+71,39,43,72,39,43,72,39,43,71,39,43,72,39,43,71,39,43,72,41,41,72,43,51,94,
+115,254,154,33,39,35,32,44,117,117,44,32,36,38,0,0,1,0,102,0,0,4,25,5,4,0,
+15,0,0,33,1,55,1,17,1,39,1,51,1,7,1,17,1,23,1,2,29,254,73,62,1,104,254,152,
+62,1,183,69,1,183,62,254,152,1,104,62,254,73,1,61,82,254,252,3,238,254,252,
+82,1,61,254,195,82,1,4,252,18,1,4,82,254,195,0,0,1,0,102,255,176,5,170,5,
+242,0,33,0,0,1,1,7,1,17,33,21,33,21,33,21,33,21,33,21,33,21,35,53,33,53,33,
+53,33,53,33,53,33,53,33,17,1,39,1,3,45,2,125,74,253,219,1,148,254,108,1,148,
+254,108,1,148,254,108,102,254,109,1,147,254,109,1,147,254,109,1,147,253,219,
+74,2,127,5,242,253,131,74,2,37,253,215,102,164,103,164,102,252,252,102,164,
+103,164,102,2,41,253,219,74,2,125,0,0,2,0,184,255,43,7,217,6,72,0,42,0,46,
+0,0,1,14,2,21,21,33,17,52,54,51,50,22,21,21,35,53,52,38,35,34,6,21,17,51,
+50,54,55,55,23,14,3,35,35,17,33,17,52,54,54,55,1,17,33,17,1,242,99,73,39,
+4,0,178,164,173,183,102,135,119,116,124,57,120,65,14,14,103,15,25,57,115,
+104,57,251,51,67,114,133,3,45,252,0,3,20,17,47,88,71,90,3,29,161,175,207,
+200,15,11,156,152,120,113,252,227,72,134,124,10,126,150,99,47,253,182,3,10,
+105,130,70,21,252,22,1,228,254,28,0,3,0,102,255,227,6,225,5,213,0,27,0,31,
+0,35,0,0,1,19,38,0,35,34,0,7,19,21,3,35,3,53,19,54,18,36,51,50,4,18,23,19,
+21,3,35,3,37,39,7,23,37,39,7,23,5,6,193,24,254,191,200,202,254,186,19,191,
+203,70,203,181,11,195,1,29,160,158,1,33,195,9,176,202,70,203,1,121,139,140,
+140,251,235,139,139,139,1,147,1,89,239,1,148,254,95,233,254,174,71,254,151,
+1,105,71,1,68,182,1,117,211,213,254,134,183,254,196,71,254,151,1,105,37,249,
+249,250,250,249,249,250,0,0,3,0,102,0,0,4,152,5,205,0,32,0,44,0,56,0,0,0,
+22,21,20,6,35,34,39,3,17,35,17,3,6,35,34,38,53,52,54,51,50,22,21,20,7,19,
+19,38,53,52,54,51,0,54,53,52,38,35,34,6,21,20,22,51,32,54,53,52,38,35,34,
+6,21,20,22,51,4,18,134,134,94,42,34,182,102,182,38,38,94,134,134,94,95,132,
+65,147,145,63,132,95,253,199,76,76,49,52,73,74,51,2,158,73,74,51,49,76,76,
+49,5,205,134,94,93,134,12,254,168,253,70,2,186,1,88,12,134,93,94,134,135,
+93,92,67,254,233,1,23,67,92,93,135,254,160,73,51,52,73,74,51,50,74,74,50,
+52,73,73,52,51,73,0,0,2,0,102,255,236,8,248,3,252,0,39,0,48,0,0,19,1,4,5,
+54,36,51,50,23,21,6,4,33,6,21,20,22,51,33,1,23,7,33,21,33,23,7,1,33,34,38,
+53,52,55,36,39,5,39,37,37,5,54,36,55,38,38,35,34,6,168,1,70,1,3,1,25,102,
+1,49,183,205,139,136,254,40,254,242,52,103,170,2,57,1,53,74,235,1,12,254,
+244,235,74,254,203,253,166,210,132,35,254,235,188,254,172,62,1,41,254,213,
+4,31,190,1,108,126,39,121,61,132,235,3,225,254,250,48,3,163,177,107,71,110,
+154,79,44,42,26,1,49,74,231,102,232,73,1,49,82,88,63,62,9,34,250,82,219,241,
+233,8,104,78,21,25,125,0,6,0,102,255,166,3,137,6,12,0,35,0,47,0,59,0,71,0,
+82,0,93,0,0,19,38,38,53,52,54,51,50,22,23,22,22,21,20,6,7,22,22,21,20,6,7,
+6,6,35,34,38,53,52,54,55,38,38,53,52,54,0,54,53,52,38,35,34,6,21,20,22,51,
+18,54,53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,55,
+6,7,22,22,23,54,54,53,52,38,3,6,7,22,22,23,54,54,53,52,38,215,53,60,150,104,
+92,141,17,140,159,75,85,86,74,156,145,20,136,92,104,150,60,53,53,60,60,1,
+2,88,90,62,65,86,86,65,64,88,89,63,63,88,86,65,63,89,88,64,65,86,89,62,250,
+16,92,43,57,8,95,102,101,98,23,83,45,59,6,96,99,108,3,217,42,134,80,129,178,
+141,113,20,166,125,90,127,45,46,126,90,125,165,24,102,133,178,129,81,133,
+42,42,134,80,81,133,252,93,122,83,83,122,123,82,82,123,2,0,122,83,84,121,
+119,86,82,123,2,0,119,86,84,121,123,82,88,117,154,132,73,35,109,65,17,110,
+80,78,110,254,5,124,67,37,115,69,20,110,77,79,110,0,0,2,0,102,255,236,3,227,
+5,180,0,20,0,32,0,0,1,1,17,22,22,21,20,6,35,34,38,53,52,54,55,17,51,1,17,
+51,17,0,54,53,52,38,35,34,6,21,20,22,51,3,156,254,71,122,155,195,135,137,
+191,158,121,72,1,184,102,254,43,131,132,95,93,132,131,94,2,201,1,73,254,103,
+21,187,118,136,191,190,137,124,184,18,2,49,254,182,2,84,253,21,253,137,133,
+92,93,135,133,95,94,131,0,4,0,102,255,236,4,33,5,123,0,28,0,48,0,59,0,69,
+0,0,55,54,55,38,53,52,54,55,38,53,52,54,51,50,18,21,20,6,7,22,21,20,6,35,
+34,38,39,6,7,1,6,7,23,22,23,54,54,53,52,38,35,34,6,21,20,23,54,54,55,1,22,
+22,51,50,54,53,52,39,6,6,3,6,21,20,23,54,36,55,38,39,102,57,85,35,86,80,166,
+236,171,190,249,51,54,107,236,166,105,184,59,47,72,2,9,75,97,133,140,64,39,
+39,191,145,127,178,131,70,138,46,254,195,43,144,89,128,171,80,89,249,71,154,
+13,131,1,14,72,53,87,37,82,90,72,96,130,250,107,107,143,121,168,254,205,178,
+87,135,59,119,158,160,200,64,59,50,93,4,4,24,93,66,66,52,42,95,74,133,249,
+110,76,90,82,74,85,9,252,113,45,52,145,113,118,87,72,140,1,202,202,232,51,
+35,129,162,55,36,44,0,0,2,0,102,255,246,4,203,5,203,0,16,0,19,0,0,1,17,35,
+53,1,17,33,53,51,17,35,53,33,21,1,1,53,1,17,1,4,78,103,253,183,254,200,209,
+209,4,101,253,22,2,6,253,183,2,98,2,182,254,0,215,1,101,253,4,102,5,8,103,
+72,253,191,254,194,178,2,174,254,43,1,213,0,5,0,184,255,154,4,45,6,23,0,24,
+0,33,0,36,0,39,0,42,0,0,23,1,33,53,1,33,53,1,53,6,33,53,32,55,54,54,51,50,
+22,21,20,6,7,17,33,1,54,54,53,52,38,35,34,6,3,53,5,1,53,5,1,53,7,211,1,76,
+254,180,1,76,254,180,1,199,185,254,215,1,55,173,3,121,107,76,94,162,139,253,
+211,2,47,92,105,40,28,58,64,111,255,0,1,0,255,0,1,0,254,31,1,19,71,1,19,72,
+1,114,53,22,102,25,171,198,93,71,107,154,30,251,74,5,30,23,101,63,31,30,131,
+250,211,211,211,1,90,211,211,1,90,209,209,0,0,2,0,102,255,195,3,59,6,43,0,
+48,0,60,0,0,1,17,51,1,17,52,38,35,34,6,21,20,22,51,50,54,53,52,39,55,22,21,
+20,6,35,34,38,53,52,54,51,50,18,17,17,35,1,17,22,22,21,20,6,35,34,38,53,52,
+54,22,54,53,52,38,35,34,6,21,20,22,51,1,127,70,1,16,153,152,102,113,62,65,
+51,57,41,82,62,119,92,104,126,165,145,204,211,69,254,239,67,95,124,89,89,
+124,92,144,32,32,23,23,32,32,23,1,102,1,209,254,236,1,205,242,227,107,67,
+70,88,66,51,52,60,62,84,90,95,125,141,120,107,169,254,224,254,229,253,125,
+1,20,254,229,15,114,77,89,124,124,89,75,115,246,33,23,23,32,32,23,23,33,0,
+4,0,184,255,127,5,199,5,254,0,27,0,31,0,35,0,43,0,0,5,3,1,35,17,33,17,6,35,
+35,53,51,50,55,18,51,50,22,21,20,6,7,17,33,17,35,1,19,3,17,33,17,1,17,1,17,
+1,54,53,52,38,35,34,6,3,14,2,253,242,70,2,84,134,167,186,186,183,118,20,216,
+76,100,152,157,2,84,72,253,244,2,105,254,19,2,84,1,237,254,21,205,40,34,57,
+65,129,1,88,254,168,3,143,1,21,17,103,16,1,117,102,76,112,135,34,254,219,
+252,113,1,88,254,168,1,211,1,86,253,102,2,154,254,172,254,186,2,154,1,244,
+49,125,34,44,115,0,3,0,102,0,0,6,233,4,86,0,25,0,28,0,31,0,0,1,1,17,33,53,
+51,17,33,17,51,17,51,17,51,17,33,17,51,21,33,17,1,35,17,35,17,39,53,35,5,
+55,35,2,242,254,188,254,184,226,1,139,102,222,102,1,139,225,254,185,254,188,
+71,222,102,225,2,139,225,225,1,20,1,80,253,156,102,2,177,1,63,254,193,1,63,
+254,193,253,79,102,2,100,254,176,1,156,254,100,181,231,231,231,0,0,2,0,102,
+255,80,5,166,6,100,0,22,0,26,0,0,1,21,35,17,33,17,35,53,33,21,1,7,1,1,39,
+1,53,33,17,51,17,33,17,9,3,4,55,254,2,47,102,254,55,2,109,70,253,166,253,
+166,70,2,109,253,209,102,1,201,1,145,254,162,254,162,1,94,6,100,102,254,27,
+254,159,250,233,252,205,70,1,211,254,45,70,3,51,233,1,107,254,252,2,75,250,
+50,1,206,254,50,1,16,0,6,0,102,255,102,4,182,6,82,0,32,0,39,0,46,0,54,0,66,
+0,78,0,0,1,53,38,38,53,52,54,51,50,22,23,51,54,55,21,7,6,6,7,35,21,22,0,21,
+20,0,35,34,36,2,53,52,0,5,17,54,54,53,52,2,1,17,6,2,21,20,22,19,2,35,34,6,
+21,20,22,0,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,
+51,2,90,178,195,118,85,118,139,13,35,207,184,62,66,164,99,32,211,1,34,254,
+189,230,148,255,0,147,1,34,1,57,169,230,233,254,243,169,228,228,167,20,148,
+43,57,144,1,215,59,59,44,43,59,59,43,254,56,59,59,44,43,59,59,43,3,178,197,
+19,141,116,88,111,184,193,3,18,103,5,6,8,1,193,19,254,192,210,224,254,185,
+147,1,0,148,214,1,60,83,252,133,18,255,171,171,1,2,252,151,3,123,19,254,252,
+168,171,254,4,251,1,13,52,45,68,89,253,6,59,44,43,59,59,43,44,59,59,44,43,
+59,59,43,44,59,0,0,3,0,102,255,199,4,160,6,39,0,25,0,32,0,35,0,0,19,37,51,
+21,33,17,51,21,35,21,51,21,35,17,35,38,0,53,52,0,55,53,33,21,35,37,1,17,6,
+2,21,20,22,1,23,53,102,1,45,72,2,0,197,197,197,197,51,224,254,195,1,30,208,
+254,98,72,254,211,3,19,168,223,223,254,24,140,5,88,207,189,253,80,102,168,
+102,254,129,2,1,60,226,211,1,56,20,254,192,204,251,29,3,115,20,255,0,165,
+169,252,4,243,96,193,0,4,0,102,0,0,6,51,5,23,0,14,0,17,0,20,0,23,0,0,37,1,
+33,53,1,51,1,1,51,1,21,33,1,21,33,19,1,33,51,33,1,3,1,1,1,193,1,49,253,116,
+1,105,69,1,56,1,57,70,1,104,253,113,1,51,252,234,49,254,252,2,4,180,2,6,254,
+252,90,254,254,254,254,72,2,20,72,2,115,253,225,2,31,253,141,72,253,236,72,
+4,133,254,62,1,194,251,225,1,191,254,65,0,0,5,0,102,255,201,5,35,6,27,0,57,
+0,69,0,81,0,93,0,105,0,0,1,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,
+6,7,22,22,21,20,7,22,22,23,7,38,38,39,22,21,20,6,35,34,38,53,52,55,6,6,7,
+39,54,54,55,38,53,52,54,55,38,38,53,52,54,0,54,53,52,38,35,34,6,21,20,22,
+51,18,54,53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,
+18,54,53,52,38,35,34,6,21,20,22,51,2,45,38,46,137,99,99,136,46,38,48,59,54,
+45,56,67,84,145,217,46,94,38,181,117,12,112,76,76,111,13,122,180,36,95,44,
+220,144,84,67,56,45,51,56,1,20,104,107,73,73,108,104,77,68,87,89,66,63,91,
+88,66,55,78,78,55,56,78,78,56,35,51,47,39,38,46,49,35,4,121,32,94,56,98,138,
+139,97,56,94,32,35,109,65,63,106,34,38,123,72,117,84,31,163,107,37,83,130,
+27,32,36,76,112,110,78,38,30,26,131,83,37,106,165,30,80,121,72,123,38,34,
+106,63,65,109,252,233,107,74,73,107,107,73,73,108,1,207,91,63,63,93,91,65,
+66,88,1,156,78,55,55,78,78,55,56,77,251,133,51,35,32,52,50,34,35,51,0,0,3,
+0,102,255,238,7,6,5,199,0,40,0,52,0,64,0,0,5,17,52,38,35,34,6,21,20,22,23,
+7,38,38,53,52,36,51,50,22,23,54,54,51,50,4,21,20,6,7,39,54,54,53,52,38,35,
+34,6,21,17,0,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,
+54,51,3,131,180,172,144,198,52,38,80,51,62,1,6,183,141,207,55,55,208,141,
+181,1,7,60,52,80,41,49,196,146,166,187,254,90,39,39,28,28,38,38,28,3,56,40,
+40,27,28,38,38,28,18,3,247,148,231,190,150,58,131,50,66,66,165,74,196,247,
+128,126,125,129,246,197,74,162,69,66,56,128,55,149,191,220,159,252,9,4,98,
+40,28,28,37,37,28,28,40,40,28,28,37,37,28,28,40,0,1,0,184,255,236,5,119,5,
+193,0,19,0,0,1,33,53,19,38,53,17,33,17,33,17,51,17,33,17,33,21,20,18,23,4,
+18,254,31,201,21,2,146,251,65,103,3,241,254,60,88,110,1,86,72,1,184,106,156,
+1,101,250,43,5,210,250,148,5,8,254,188,254,215,217,0,0,1,0,184,0,0,5,106,
+3,195,0,27,0,0,19,51,23,7,39,17,51,17,51,23,7,39,17,51,17,51,23,7,39,17,51,
+17,51,23,7,39,17,33,184,72,221,53,137,200,72,221,53,137,201,71,221,53,137,
+201,71,221,53,137,252,12,3,195,136,86,86,253,43,2,185,135,86,86,253,206,2,
+21,135,86,86,254,114,1,99,135,86,86,254,190,0,1,0,102,255,231,6,59,5,188,
+0,31,0,0,1,39,33,17,23,7,39,7,39,55,17,33,7,39,55,39,55,23,33,17,39,55,23,
+55,23,7,17,33,55,23,7,23,5,242,226,254,117,223,69,205,205,70,224,254,112,
+223,74,203,203,74,225,1,142,224,70,205,205,69,223,1,139,226,73,202,202,1,
+190,224,254,116,225,74,203,203,74,225,1,140,221,69,205,203,69,223,1,141,226,
+73,202,202,73,226,254,115,223,69,205,205,0,3,0,102,1,63,3,96,4,57,0,11,0,
+23,0,35,0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,
+22,51,18,22,21,20,6,35,34,38,53,52,54,51,2,128,224,224,157,157,224,224,157,
+114,165,164,115,116,162,165,113,35,49,49,35,35,49,49,35,4,57,224,157,157,
+224,224,157,157,224,253,109,162,116,115,164,166,113,115,163,1,106,48,36,35,
+49,49,35,36,48,0,0,1,0,104,0,92,4,242,4,127,0,66,0,0,19,53,16,0,33,32,0,21,
+20,0,35,34,2,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,7,
+39,54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,
+54,53,52,38,35,34,0,21,104,1,68,1,6,1,13,1,51,254,235,213,213,254,214,169,
+163,206,169,120,113,147,94,84,75,93,33,94,25,28,34,37,43,90,68,78,108,145,
+121,129,151,196,168,159,228,250,221,215,254,242,2,25,6,1,15,1,81,254,207,
+221,218,254,197,1,1,198,164,235,184,144,127,192,134,106,90,106,81,66,61,33,
+30,29,31,15,34,49,37,63,83,125,92,97,129,170,133,146,200,250,180,179,245,
+254,219,219,0,0,7,0,102,0,0,7,12,4,219,0,14,0,18,0,26,0,35,0,43,0,51,0,58,
+0,0,1,21,22,4,18,23,51,21,33,53,51,18,0,37,53,1,33,21,33,1,38,0,39,21,22,
+18,23,1,6,0,7,51,52,54,54,55,21,6,6,21,51,54,54,55,5,38,38,39,21,22,22,23,
+33,51,38,38,35,34,6,3,236,172,1,26,173,5,168,249,90,166,3,1,94,1,24,252,225,
+6,166,249,90,5,152,8,254,220,230,185,201,9,254,14,234,254,219,3,135,91,182,
+122,140,153,135,3,86,69,1,139,11,153,128,68,86,3,254,197,213,3,57,47,47,56,
+4,219,250,12,180,254,194,180,102,102,1,3,1,156,19,250,251,139,102,1,47,225,
+1,88,19,135,18,254,252,175,2,76,19,254,160,217,89,221,134,11,105,15,218,117,
+80,114,15,209,148,186,16,141,15,115,79,52,61,59,0,6,0,102,255,156,3,23,6,
+35,0,29,0,47,0,50,0,54,0,57,0,60,0,0,5,1,53,51,53,38,38,53,52,54,55,53,35,
+53,1,51,1,21,35,21,22,22,21,20,6,7,21,51,21,1,3,53,51,21,54,54,53,52,38,39,
+21,35,53,6,6,21,20,22,19,53,7,17,22,23,53,51,21,55,3,21,51,1,156,254,241,
+254,124,169,168,125,254,1,15,69,1,15,254,125,168,169,124,254,254,241,86,103,
+82,108,108,82,103,81,109,109,81,96,52,44,103,94,94,94,100,1,63,72,102,18,
+194,130,128,194,18,105,71,1,64,254,192,71,105,18,194,128,129,195,18,102,72,
+254,193,2,88,168,168,16,132,87,85,132,19,168,168,18,132,86,87,132,2,254,111,
+111,251,186,64,46,110,108,108,4,179,109,0,3,0,102,255,137,4,66,6,51,0,21,
+0,25,0,29,0,0,1,1,51,17,19,21,3,35,3,53,19,53,1,35,17,3,53,19,51,19,21,3,
+1,39,7,23,1,7,23,55,1,135,1,154,102,187,203,70,203,187,254,102,102,187,203,
+70,203,187,2,88,139,139,139,254,0,139,139,139,2,55,1,234,254,102,254,178,
+71,254,151,1,105,71,1,78,252,254,25,1,153,1,78,72,1,104,254,152,72,254,178,
+253,226,249,249,250,5,131,250,250,250,0,0,5,0,102,255,211,4,238,5,227,0,43,
+0,56,0,64,0,74,0,83,0,0,37,7,37,6,7,39,54,55,38,38,53,52,54,55,36,53,52,54,
+51,50,22,21,7,7,22,23,54,54,51,50,22,21,20,7,51,50,22,21,20,6,7,6,6,7,39,
+54,54,53,52,38,39,7,6,21,20,22,22,3,53,16,35,34,6,21,20,5,22,23,54,54,53,
+52,38,35,34,19,22,23,54,53,52,38,35,34,4,74,62,254,230,131,158,62,123,148,
+161,97,24,19,254,155,120,85,128,136,1,1,63,44,45,143,70,76,90,27,14,82,93,
+123,117,12,92,87,79,90,84,196,173,12,27,40,71,160,162,41,61,2,53,65,56,41,
+65,29,34,75,104,50,13,133,38,42,62,37,82,219,104,115,82,86,119,152,192,98,
+52,183,87,110,197,75,119,197,188,27,16,17,18,85,108,97,73,46,46,88,78,93,
+139,32,76,144,81,65,85,138,72,133,195,45,69,143,75,57,103,98,2,164,14,1,27,
+54,38,117,195,32,51,30,88,31,24,44,254,213,78,107,58,100,35,28,0,8,0,102,
+254,236,3,102,6,125,0,47,0,62,0,69,0,76,0,83,0,90,0,97,0,104,0,0,1,38,38,
+53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,7,22,22,21,20,6,7,22,22,21,20,6,
+35,34,38,53,52,54,55,38,38,53,52,54,55,38,38,53,52,54,0,54,53,52,38,39,21,
+35,53,6,6,21,20,22,51,19,17,54,54,53,52,38,3,17,54,54,53,52,38,3,17,54,54,
+53,52,38,3,17,6,6,21,20,22,19,17,6,6,21,20,22,19,17,6,6,21,20,22,1,70,53,
+60,156,116,114,161,62,53,53,62,62,53,53,62,50,42,95,107,225,160,163,220,106,
+95,42,48,60,53,53,60,60,1,75,164,131,100,103,100,129,163,117,52,52,68,65,
+55,52,68,65,55,52,68,68,155,52,67,67,52,54,65,67,52,55,64,67,4,141,37,115,
+69,112,163,161,114,69,117,37,37,115,69,69,117,37,37,115,69,62,106,37,39,144,
+85,128,173,173,128,84,144,40,37,106,62,69,116,38,37,115,69,69,116,250,235,
+118,81,73,111,12,250,250,12,112,72,82,117,5,0,254,184,17,88,59,55,90,254,
+87,254,184,17,88,59,55,90,3,139,254,185,17,88,58,57,91,253,12,1,72,17,90,
+57,59,88,1,172,1,71,17,93,54,58,88,252,118,1,72,19,91,54,59,88,0,0,1,0,102,
+255,104,4,49,6,78,0,35,0,0,19,5,33,17,33,5,39,55,35,53,51,39,55,5,33,17,33,
+5,39,55,35,53,51,39,55,5,33,17,33,5,39,55,35,53,51,39,164,1,43,1,252,253,
+254,254,219,62,187,176,176,187,62,1,37,2,104,253,152,254,219,62,187,176,176,
+187,62,1,37,2,2,253,250,254,223,62,181,170,180,191,3,246,232,1,246,227,82,
+145,102,146,82,228,250,226,228,82,146,102,146,82,228,1,246,223,82,141,102,
+150,0,3,0,102,255,68,3,207,6,27,0,43,0,55,0,64,0,0,1,21,51,50,22,21,20,6,
+35,34,39,21,1,7,3,3,39,1,17,38,38,53,52,55,38,38,53,52,54,51,50,22,21,20,
+6,35,34,39,6,21,20,22,23,53,38,54,53,52,38,35,34,6,21,20,22,51,19,21,22,51,
+50,54,53,52,35,2,125,57,134,147,135,101,65,37,1,20,73,254,254,74,1,21,181,
+176,47,55,68,188,132,136,185,187,134,55,50,36,119,135,21,127,127,92,92,125,
+125,92,215,27,73,60,75,178,3,117,232,122,109,102,136,21,39,254,227,69,1,4,
+254,252,69,1,29,1,129,4,123,125,98,86,45,131,78,135,187,189,133,132,187,16,
+59,76,80,68,2,232,139,125,92,92,127,128,91,91,126,254,39,246,18,75,60,129,
+0,2,0,102,255,205,3,238,5,229,0,26,0,38,0,0,1,6,6,35,34,38,53,52,54,51,50,
+0,17,16,2,35,34,38,39,55,22,22,51,50,18,17,52,39,38,38,35,34,6,21,20,22,51,
+50,54,3,119,90,215,107,168,205,236,160,237,1,15,240,201,155,188,19,98,35,
+134,95,151,187,41,48,183,125,131,170,145,125,107,213,3,152,73,81,194,156,
+173,220,254,66,254,176,254,180,254,66,186,103,20,103,104,1,137,1,27,97,212,
+182,189,162,127,118,132,102,0,1,0,102,0,0,3,246,5,20,0,36,0,0,19,5,53,38,
+38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,7,21,
+33,21,33,17,35,17,37,102,1,150,129,174,157,121,19,82,113,148,104,103,149,
+109,86,19,124,154,173,130,1,148,254,108,102,254,106,1,211,2,139,18,197,135,
+126,194,26,100,19,137,90,103,149,148,104,90,135,21,100,22,198,126,134,198,
+18,139,103,254,150,1,106,3,0,3,0,102,255,188,4,100,5,252,0,22,0,34,0,47,0,
+0,19,33,53,38,0,53,52,0,51,50,0,21,20,0,7,21,33,21,33,17,35,17,33,0,54,53,
+52,38,35,34,6,21,20,22,51,19,23,55,23,3,35,39,7,35,3,55,23,55,160,1,145,191,
+254,244,1,42,212,212,1,44,254,245,193,1,145,254,111,103,254,111,2,110,240,
+241,169,166,241,239,168,35,74,76,98,139,72,72,71,72,137,98,78,67,1,113,143,
+20,1,34,198,210,1,46,254,210,210,197,254,221,20,143,103,254,178,1,78,1,90,
+242,166,166,244,240,170,167,241,2,97,203,211,33,254,143,205,205,1,113,33,
+209,201,0,0,1,0,102,0,0,4,156,5,41,0,56,0,0,1,54,51,50,22,21,20,7,62,2,53,
+52,38,39,55,22,22,21,20,6,6,7,19,51,21,33,3,3,33,53,51,19,38,38,53,52,38,
+35,34,6,7,39,54,54,51,50,22,23,54,54,53,52,38,35,34,7,1,88,76,108,117,162,
+45,15,115,89,75,64,37,96,108,150,188,38,249,224,254,221,248,248,254,221,224,
+249,9,5,94,72,49,88,22,95,38,134,82,99,142,19,21,29,104,73,63,47,4,215,72,
+173,134,72,78,10,14,76,62,70,112,29,94,42,158,105,102,138,17,32,253,143,102,
+2,104,253,152,102,2,111,17,40,41,66,121,73,56,37,89,105,131,113,28,74,34,
+88,116,39,0,7,0,102,255,27,5,16,4,162,0,14,0,18,0,22,0,26,0,30,0,33,0,36,
+0,0,1,33,7,23,7,39,7,39,55,1,51,19,19,51,19,37,39,35,7,33,33,39,35,37,35,
+7,51,33,51,39,35,37,51,39,33,7,51,5,16,252,117,53,131,90,92,92,91,123,1,29,
+80,209,209,79,209,253,160,24,224,24,1,237,1,17,25,223,254,188,118,27,172,
+1,68,169,24,119,254,41,68,33,1,240,35,67,1,20,217,239,49,168,168,49,229,4,
+113,252,194,3,62,252,186,31,100,100,100,203,100,100,102,138,138,0,0,2,0,102,
+254,227,4,248,6,168,0,20,0,23,0,0,19,1,17,51,1,1,23,1,1,7,1,1,17,1,7,1,1,
+39,1,17,1,1,55,39,117,1,196,72,1,41,1,4,74,254,252,1,4,76,254,254,254,246,
+1,211,74,254,68,254,67,74,1,211,254,133,1,226,194,194,2,57,1,199,2,168,254,
+203,1,4,74,254,250,254,242,72,1,12,254,244,253,53,254,39,74,1,193,254,63,
+74,1,217,2,100,254,134,2,118,195,205,0,2,0,102,255,182,6,117,6,0,0,28,0,31,
+0,0,9,2,7,1,7,17,20,0,35,34,38,39,55,22,22,51,50,54,53,53,1,39,1,17,51,22,
+23,1,1,55,39,6,117,254,245,1,11,74,254,248,252,254,249,229,182,254,33,103,
+26,200,140,183,207,254,120,73,1,209,71,147,136,1,8,253,252,178,178,5,156,
+254,243,254,236,70,1,19,254,254,162,254,254,200,212,175,17,138,163,250,219,
+241,254,119,74,1,211,2,137,155,138,1,10,253,248,180,187,0,0,3,0,102,255,127,
+4,141,6,14,0,21,0,25,0,29,0,0,5,17,3,53,19,51,19,21,3,17,33,19,17,51,17,19,
+21,3,35,3,33,17,1,39,7,23,1,7,23,55,1,33,187,203,70,203,187,1,51,179,102,
+186,202,70,195,254,205,2,164,139,140,140,253,180,139,139,139,129,3,145,1,
+78,72,1,104,254,152,72,254,178,254,47,1,60,3,147,252,109,254,180,72,254,152,
+1,90,254,166,1,141,250,250,250,5,105,250,250,250,0,0,2,0,102,255,236,5,244,
+4,231,0,27,0,38,0,0,1,16,18,51,50,18,17,51,16,2,7,6,2,35,34,2,39,38,2,17,
+51,16,18,51,50,18,17,53,1,38,3,6,6,7,22,18,51,50,18,3,96,143,136,132,146,
+103,173,161,9,201,169,168,204,9,158,170,103,146,132,133,146,1,69,192,82,40,
+143,98,9,148,122,118,147,4,231,254,228,254,211,1,55,1,18,254,213,254,149,
+22,240,254,161,1,94,241,25,1,107,1,40,254,238,254,201,1,31,1,18,24,253,84,
+32,1,5,127,150,16,187,254,210,1,34,0,0,3,0,102,0,0,6,80,5,123,0,61,0,67,0,
+73,0,0,37,50,54,55,38,38,53,52,55,38,38,35,34,6,7,22,22,21,20,7,22,22,51,
+21,34,38,39,6,6,35,53,50,54,55,38,38,53,52,55,62,2,51,50,0,23,22,22,21,20,
+7,22,22,51,21,35,34,38,39,6,6,35,1,17,34,6,21,20,5,17,34,6,21,20,4,82,61,
+92,35,74,81,166,44,234,169,186,230,30,84,82,150,35,88,61,80,108,66,79,103,
+74,61,88,40,74,82,172,19,151,233,148,223,1,29,43,82,90,149,42,85,57,22,53,
+107,72,73,106,77,253,20,52,68,4,100,47,74,102,69,36,93,202,96,230,57,204,
+211,242,171,24,151,114,200,191,38,67,102,61,68,75,54,102,64,41,94,204,93,
+232,57,131,254,131,254,228,230,16,155,120,201,190,46,59,102,55,74,70,59,1,
+29,1,252,105,90,153,160,1,252,94,101,158,0,0,2,0,102,0,127,4,221,4,246,0,
+15,0,27,0,0,0,4,18,21,20,2,4,35,34,36,2,53,52,18,36,51,18,0,53,52,0,35,34,
+0,21,20,0,51,3,59,1,10,152,153,254,247,153,154,254,247,153,153,1,10,153,191,
+1,22,254,235,192,193,254,236,1,21,192,4,246,154,254,246,152,152,254,247,154,
+154,1,10,151,152,1,11,153,251,239,1,19,194,191,1,22,254,235,192,192,254,235,
+0,0,3,0,102,255,47,6,74,6,123,0,40,0,52,0,62,0,0,1,1,17,22,22,21,20,6,35,
+34,38,53,53,33,17,35,17,33,17,51,1,17,38,38,53,52,54,51,50,22,21,20,6,7,21,
+33,17,51,17,33,17,18,54,53,52,38,35,34,6,21,20,22,51,1,21,20,22,51,50,54,
+53,52,38,3,238,254,110,214,241,137,119,131,170,254,215,103,1,144,71,1,146,
+112,146,181,128,128,183,145,115,1,174,103,253,235,36,122,124,85,87,120,121,
+86,254,90,113,94,66,79,172,1,102,1,160,254,94,16,161,126,115,139,219,187,
+53,254,45,2,57,2,78,254,97,1,251,18,172,116,130,181,183,128,113,174,19,243,
+1,221,253,188,254,174,3,15,120,87,85,123,123,85,87,120,252,135,47,145,158,
+83,68,73,110,0,0,2,0,102,255,213,4,45,6,27,0,31,0,43,0,0,37,39,21,33,53,33,
+53,36,2,53,52,18,51,50,22,23,54,53,52,38,39,39,55,22,22,21,20,6,7,17,22,23,
+37,17,38,38,39,2,35,34,6,21,20,18,3,221,219,253,213,1,197,254,194,248,197,
+143,129,149,13,234,101,68,14,58,130,97,157,142,63,205,254,142,16,19,4,33,
+154,103,134,211,74,121,238,102,195,192,1,110,220,208,1,34,250,250,18,183,
+58,133,49,10,82,96,158,78,126,159,18,253,153,38,111,211,2,41,7,50,43,1,143,
+232,163,191,254,200,0,5,0,184,0,0,4,55,5,229,0,16,0,21,0,26,0,29,0,32,0,0,
+1,55,39,55,5,21,7,23,21,7,33,17,33,17,51,55,39,1,53,1,21,9,2,53,1,35,33,1,
+17,1,33,1,1,86,197,191,49,1,64,191,215,114,1,196,252,129,222,174,238,2,123,
+253,78,2,39,253,217,2,178,253,215,137,1,53,1,125,253,78,1,123,254,133,4,225,
+70,100,90,168,71,64,98,72,55,252,43,3,213,88,109,251,204,68,2,0,172,254,104,
+2,195,254,0,172,1,154,254,231,1,25,252,247,1,23,0,4,0,102,255,125,5,129,5,
+250,0,44,0,56,0,64,0,76,0,0,19,37,38,53,53,55,33,53,33,18,18,51,50,22,21,
+20,6,7,7,21,16,18,51,50,54,53,53,51,21,20,0,35,34,38,39,5,39,37,38,39,5,39,
+37,39,5,0,22,21,20,6,35,34,38,53,52,54,51,1,54,54,53,52,38,35,34,0,54,53,
+52,38,35,34,6,21,20,22,51,102,1,66,25,2,254,217,1,44,18,131,127,89,124,192,
+199,2,211,225,163,206,102,254,251,202,115,164,61,254,189,52,1,54,13,20,254,
+205,43,1,51,19,254,201,3,98,113,114,80,82,113,114,81,254,100,155,130,66,45,
+141,1,163,52,53,39,38,55,54,39,1,94,105,135,174,68,65,102,1,9,1,10,152,104,
+178,193,6,64,69,254,164,254,145,244,192,43,43,231,254,205,62,59,199,86,188,
+19,39,138,95,137,57,100,1,178,113,81,82,113,114,81,82,112,1,59,10,130,133,
+61,92,251,252,55,38,39,53,52,40,39,54,0,5,0,102,0,84,5,133,4,205,0,48,0,58,
+0,68,0,78,0,87,0,0,1,6,7,22,23,54,51,50,22,21,20,6,35,34,39,7,7,22,21,20,
+6,35,34,38,53,52,55,38,38,39,6,35,34,38,53,52,54,51,50,23,54,55,38,39,51,
+22,23,54,55,1,38,35,34,6,21,20,22,51,50,37,22,51,50,54,53,52,38,35,34,1,6,
+21,20,22,51,50,54,53,52,3,7,22,23,54,55,38,38,39,3,166,12,103,66,61,156,123,
+87,101,108,80,145,138,74,43,107,94,78,85,93,106,14,73,30,136,134,85,114,105,
+94,118,152,61,64,102,12,102,7,67,58,15,254,168,112,84,45,41,51,35,99,2,126,
+100,97,35,51,41,45,80,254,125,74,48,28,26,43,118,60,54,51,88,20,27,56,23,
+4,205,115,170,90,61,114,94,84,74,104,108,69,47,139,121,95,104,106,93,125,
+135,18,72,24,106,100,78,83,95,112,61,88,164,121,61,121,109,73,254,8,80,45,
+31,34,42,72,72,42,34,31,45,254,166,104,83,47,39,41,45,86,1,181,66,50,56,88,
+16,31,64,32,0,0,1,0,102,0,0,5,252,4,33,0,52,0,0,1,39,38,38,53,52,54,51,50,
+22,23,17,51,17,54,54,51,50,22,21,20,14,3,7,7,39,54,54,53,52,38,35,34,6,21,
+17,33,21,33,53,33,17,52,38,35,34,6,21,20,22,23,1,23,39,58,80,204,145,100,
+172,43,102,43,171,102,142,206,10,21,36,52,19,38,49,56,67,143,103,135,181,
+1,144,252,123,1,143,182,133,103,143,66,57,1,37,26,37,151,93,150,204,88,73,
+1,8,254,248,72,89,203,151,37,64,54,62,53,12,25,90,35,115,67,107,145,200,140,
+254,102,102,102,1,154,143,197,145,107,68,115,34,0,3,0,102,255,133,5,123,6,
+49,0,14,0,17,0,20,0,0,1,1,5,17,35,17,5,39,1,17,51,1,1,51,17,1,1,17,1,55,39,
+5,51,254,74,254,242,103,254,148,54,1,162,72,1,55,1,172,72,254,94,1,59,253,
+91,188,188,3,63,1,111,166,251,125,4,68,221,86,1,0,1,239,254,250,1,6,253,14,
+1,166,254,250,1,199,254,217,117,157,0,3,0,102,0,0,8,61,5,106,0,35,0,38,0,
+47,0,0,1,54,51,50,22,23,7,39,38,38,35,34,4,7,1,21,33,53,1,38,36,35,34,6,7,
+7,39,54,54,51,50,23,54,51,50,22,1,1,33,1,22,23,54,55,38,35,34,6,5,164,142,
+128,115,202,78,88,42,52,136,77,112,254,244,163,2,76,250,230,2,75,161,254,
+246,115,78,136,51,43,88,67,207,122,129,133,129,211,105,184,254,229,254,14,
+3,228,253,8,122,140,132,122,100,160,75,134,4,219,90,165,173,49,79,97,109,
+190,199,252,254,72,72,3,2,199,190,110,96,79,49,155,183,84,137,77,253,217,
+253,114,4,60,94,170,161,99,100,49,0,2,0,102,255,168,5,55,5,254,0,19,0,28,
+0,0,1,17,35,53,6,33,35,17,35,17,33,53,33,17,51,21,51,32,23,53,5,17,51,50,
+54,53,52,38,35,5,55,102,107,254,213,55,102,253,200,2,56,102,99,1,10,96,254,
+51,74,140,200,168,172,5,225,253,70,213,119,252,35,3,221,103,2,18,135,107,
+213,209,254,220,81,72,66,73,0,6,0,184,255,205,4,109,5,233,0,18,0,36,0,40,
+0,44,0,56,0,68,0,0,5,33,17,33,21,7,23,21,7,23,21,7,23,21,7,23,21,7,23,1,55,
+35,17,51,39,53,55,39,53,55,39,53,55,39,53,55,39,1,33,17,33,53,33,17,33,18,
+22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,4,109,
+252,75,3,181,158,158,160,160,160,160,158,158,158,158,254,225,84,246,248,86,
+155,155,155,155,155,155,158,158,253,209,1,39,254,217,1,39,254,217,181,46,
+46,34,34,46,46,34,34,46,46,34,34,46,46,34,51,6,28,71,125,111,71,111,115,67,
+111,115,65,113,114,66,111,127,5,52,59,250,176,64,69,107,117,69,107,114,70,
+109,114,72,108,111,251,49,2,117,102,2,117,252,62,46,34,34,46,46,34,34,46,
+2,217,46,34,34,46,46,34,34,46,0,2,0,184,255,236,3,45,5,205,0,14,0,25,0,0,
+1,17,54,51,50,22,21,20,6,35,34,39,17,35,17,19,17,22,51,50,54,53,52,38,35,
+34,1,31,82,92,151,201,199,153,92,82,103,103,74,98,112,140,140,112,82,5,205,
+254,71,41,192,162,163,191,41,254,74,5,225,253,225,254,88,39,137,115,115,137,
+0,3,0,102,0,147,5,59,4,139,0,25,0,35,0,47,0,0,1,54,54,55,23,6,0,33,32,0,3,
+55,22,22,23,38,38,53,52,54,51,50,22,21,20,6,5,22,4,51,50,36,55,6,33,32,0,
+38,35,34,6,21,20,22,51,50,54,53,3,131,83,236,74,47,23,254,196,254,233,254,
+248,254,191,34,48,73,237,83,34,38,138,112,112,138,38,253,60,44,1,1,195,196,
+1,2,44,217,254,231,254,233,1,170,83,64,64,84,85,63,60,87,2,166,7,54,31,45,
+251,254,185,1,43,1,23,45,31,54,7,47,95,63,124,156,160,124,63,92,87,190,197,
+200,187,70,1,139,99,98,80,71,142,129,84,0,0,1,0,102,255,190,5,209,6,14,0,
+59,0,0,1,39,7,7,39,7,7,39,22,23,35,2,3,39,7,7,37,55,23,55,38,2,39,37,23,5,
+23,37,23,5,23,37,23,5,23,23,55,55,23,19,23,3,7,39,7,7,39,22,22,23,23,19,55,
+23,55,55,23,55,23,3,5,70,140,32,70,158,35,67,148,28,5,102,10,95,10,57,72,
+254,227,62,225,86,24,120,30,1,197,37,254,159,19,1,98,37,254,158,18,1,98,37,
+254,152,16,180,49,68,201,39,102,57,70,205,51,70,137,14,45,9,151,41,70,158,
+37,69,141,43,103,70,1,98,164,223,21,193,246,24,125,202,186,1,115,1,133,41,
+151,15,219,82,172,199,100,1,67,62,168,96,129,49,129,96,129,52,129,98,131,
+55,166,223,25,197,1,2,16,254,135,18,194,223,17,125,39,205,61,131,1,19,16,
+186,229,14,178,221,20,254,168,0,0,4,0,102,255,162,3,211,5,242,0,21,0,29,0,
+37,0,43,0,0,5,1,1,39,1,17,33,21,33,21,22,22,21,20,7,22,21,20,6,7,21,1,1,21,
+22,23,54,53,52,38,19,6,7,21,54,54,53,52,37,54,55,38,38,39,2,188,255,0,255,
+0,86,1,35,1,207,254,152,239,244,29,29,246,237,1,34,254,222,255,119,7,197,
+190,123,251,184,197,254,131,211,94,45,138,122,94,1,114,254,142,57,1,166,4,
+113,103,92,5,143,128,65,50,47,64,131,142,3,164,254,90,4,238,123,10,78,21,
+16,77,91,254,149,77,5,123,3,92,79,12,40,5,54,25,32,6,0,5,0,102,255,201,4,
+180,5,250,0,29,0,36,0,43,0,50,0,57,0,0,19,33,38,38,53,52,54,51,50,22,21,20,
+6,7,33,21,33,22,22,21,20,6,35,34,38,53,52,54,55,33,1,17,6,6,21,20,22,19,17,
+54,54,53,52,38,39,17,6,6,21,20,22,19,17,54,54,53,52,38,102,1,62,59,64,209,
+147,148,209,64,61,1,63,254,193,60,65,208,149,147,209,65,60,254,192,1,244,
+87,116,112,194,90,112,116,189,88,115,112,194,92,110,115,3,20,51,170,95,175,
+251,251,175,92,172,52,102,52,170,95,173,251,250,174,93,172,52,253,135,2,121,
+23,178,116,113,178,2,96,253,135,25,179,112,116,178,125,2,121,22,179,116,113,
+176,2,94,253,135,29,174,113,115,180,0,4,0,184,255,227,4,78,5,215,0,11,0,14,
+0,17,0,20,0,0,23,17,51,1,21,5,5,21,5,5,21,1,19,37,37,17,17,37,1,17,37,184,
+72,3,78,253,102,2,154,253,102,2,154,252,178,31,2,69,253,187,2,65,253,191,
+2,61,29,5,244,255,0,72,202,195,74,194,201,72,254,254,4,35,172,176,252,84,
+254,162,176,2,125,254,176,168,0,1,0,102,0,0,5,102,5,229,0,28,0,0,33,33,53,
+1,23,21,51,21,35,21,51,21,35,21,51,21,35,21,51,21,35,21,35,17,1,33,1,55,1,
+5,102,251,0,1,217,87,178,178,178,178,178,178,178,178,103,254,182,4,4,253,
+185,94,2,102,72,4,6,19,94,102,82,103,81,103,82,102,127,2,108,253,43,5,86,
+41,250,99,0,8,0,102,255,213,4,242,5,209,0,14,0,21,0,25,0,30,0,34,0,38,0,41,
+0,44,0,0,19,33,55,22,18,21,20,2,7,39,33,53,1,2,1,1,18,53,52,2,39,1,1,33,7,
+33,1,22,23,33,55,1,33,55,33,1,33,7,33,1,7,33,3,55,33,102,4,4,78,31,27,24,
+32,65,251,237,1,236,211,254,231,4,7,30,18,12,254,98,1,14,253,103,74,3,45,
+252,211,34,38,2,155,74,253,156,1,151,57,253,248,1,209,254,105,56,2,6,254,
+254,131,1,4,131,129,254,252,5,197,12,202,254,144,235,213,254,205,207,10,72,
+2,172,1,34,1,136,251,20,1,34,249,140,1,96,120,253,193,253,219,102,5,24,52,
+50,102,254,230,77,252,207,78,1,105,180,1,98,180,0,0,1,0,102,0,156,4,219,5,
+16,0,43,0,0,1,51,53,51,21,51,21,35,21,51,53,51,21,51,21,35,21,35,53,35,21,
+51,21,35,21,35,53,35,53,51,53,35,21,35,53,35,53,51,53,51,21,51,53,35,1,221,
+146,102,145,145,229,103,186,186,103,229,145,145,102,146,146,232,102,187,187,
+102,232,146,4,86,186,186,102,232,146,146,102,146,146,230,102,186,186,102,
+230,146,146,102,146,146,232,0,0,5,0,102,254,248,4,74,6,150,0,53,0,67,0,81,
+0,88,0,95,0,0,1,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,21,
+21,22,0,21,20,0,7,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,
+53,53,38,0,53,52,0,5,21,22,22,21,20,6,7,21,54,54,53,52,38,7,53,6,6,21,20,
+22,23,53,38,38,53,52,54,19,54,54,53,52,38,39,35,6,6,21,20,22,23,2,35,89,79,
+74,92,34,29,73,40,52,151,117,120,150,188,1,5,254,250,187,92,82,70,90,35,28,
+73,40,52,148,114,124,152,186,254,253,1,0,1,35,96,127,126,97,148,198,201,247,
+146,196,196,146,92,125,121,198,53,68,65,56,102,51,64,64,51,4,180,197,85,97,
+94,70,46,77,22,70,32,118,65,117,150,155,122,205,18,254,229,192,193,254,227,
+18,195,86,96,95,69,44,77,24,70,33,118,64,115,151,153,123,203,20,1,30,190,
+190,1,27,82,123,18,149,101,100,149,18,127,18,227,149,149,224,107,125,20,225,
+146,147,225,20,125,18,150,99,96,151,254,103,15,88,59,55,88,18,17,87,57,57,
+88,15,0,0,1,0,102,255,121,4,20,6,53,0,36,0,0,19,33,21,33,22,22,51,21,5,5,
+21,5,5,21,5,22,22,23,33,21,33,53,33,38,38,39,53,37,37,53,37,37,53,37,38,39,
+33,102,3,174,253,187,16,177,190,254,141,1,86,254,170,1,86,254,211,123,138,
+11,1,0,252,82,2,70,17,210,178,1,122,254,170,1,84,254,174,1,25,217,23,255,
+0,6,53,102,106,107,72,172,176,72,164,163,76,139,36,139,98,102,102,94,104,
+5,74,174,160,73,170,176,76,129,64,221,0,3,0,102,255,236,4,233,5,37,0,19,0,
+29,0,39,0,0,1,17,22,4,21,20,6,35,34,39,6,6,35,34,38,53,52,36,55,17,19,21,
+20,22,51,50,54,53,52,38,5,53,6,6,21,20,22,51,50,54,2,219,245,1,25,141,131,
+193,112,63,147,95,133,140,1,26,245,102,145,109,82,88,243,254,229,193,231,
+88,82,106,148,5,37,253,2,10,180,150,113,118,182,97,85,121,110,151,179,10,
+2,254,252,153,67,147,150,68,61,96,130,64,73,12,131,92,61,68,147,0,0,4,0,102,
+255,236,6,246,4,199,0,47,0,65,0,74,0,82,0,0,1,6,7,51,55,51,19,7,39,7,35,6,
+21,20,22,23,22,22,21,20,6,35,34,3,38,35,34,7,6,6,35,34,38,53,52,54,55,54,
+17,52,38,39,55,22,51,50,54,55,3,38,53,52,55,6,6,35,34,38,39,22,21,20,7,54,
+51,50,5,6,6,21,20,22,51,50,54,37,22,51,50,54,53,52,38,4,199,19,8,147,156,
+72,211,82,164,137,211,4,11,11,133,156,73,60,174,72,141,176,177,141,32,127,
+86,60,74,155,134,25,20,21,49,175,200,86,214,72,73,17,27,49,181,79,81,185,
+44,29,16,138,159,159,253,172,73,84,16,17,34,65,3,132,52,71,17,16,81,4,147,
+117,87,221,254,221,61,223,195,64,75,165,142,70,34,125,74,60,75,1,28,25,25,
+134,150,74,61,73,126,34,94,1,27,116,191,139,52,35,20,15,252,172,146,208,169,
+216,10,15,16,9,232,153,202,152,20,155,24,66,31,13,20,78,73,151,20,13,30,64,
+0,2,0,102,255,145,4,170,6,20,0,31,0,41,0,0,19,33,38,53,52,54,51,50,18,17,
+16,0,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,18,17,52,39,33,37,33,38,38,
+35,34,6,21,20,22,102,1,158,113,175,139,225,252,255,0,233,135,158,175,152,
+37,126,136,104,93,180,201,9,252,43,2,58,1,141,33,179,140,94,117,99,4,6,97,
+149,126,154,254,101,254,104,254,100,254,76,159,128,132,216,51,94,47,160,98,
+88,96,1,121,1,112,59,132,102,203,221,101,81,71,140,0,0,3,0,102,0,0,4,170,
+5,113,0,18,0,22,0,34,0,0,1,1,54,51,50,22,21,20,6,35,34,39,1,17,35,17,1,53,
+1,23,9,2,22,54,53,52,38,35,34,6,21,20,22,51,2,57,1,72,50,79,71,97,99,69,81,
+48,254,201,103,254,131,1,142,35,254,192,1,64,1,65,198,38,38,28,26,37,37,26,
+5,113,254,184,61,97,71,70,95,59,254,203,253,225,2,31,1,125,69,1,144,113,254,
+190,254,193,1,63,63,37,26,28,38,38,28,26,37,0,0,3,0,102,0,0,5,166,5,59,0,
+7,0,10,0,22,0,0,1,1,7,1,33,1,39,1,3,33,1,2,22,21,20,6,35,34,38,53,52,54,51,
+3,41,2,125,90,254,246,253,135,254,248,91,2,125,231,2,18,254,248,81,38,38,
+27,28,36,36,28,5,59,250,242,45,2,27,253,229,45,5,14,253,70,2,27,252,196,37,
+28,28,36,36,28,28,37,0,3,0,102,255,236,5,225,5,55,0,17,0,21,0,25,0,0,19,33,
+17,23,55,17,33,17,33,7,1,7,1,1,39,1,39,33,1,35,21,51,33,51,53,35,150,1,169,
+228,229,1,170,254,160,229,2,116,73,253,139,253,141,74,2,115,227,254,160,4,
+182,221,221,251,176,221,221,5,55,254,160,229,229,1,96,254,86,229,253,141,
+73,2,114,253,142,73,2,115,229,1,68,221,221,0,0,1,0,102,0,0,5,106,5,145,0,
+50,0,0,33,17,16,38,35,34,6,21,20,22,51,50,54,53,51,20,6,35,34,38,53,52,54,
+51,50,22,23,54,51,50,22,21,20,6,35,34,38,53,51,20,51,50,54,53,52,38,35,34,
+6,21,17,2,176,130,132,95,126,70,53,48,50,102,105,95,99,127,184,138,152,190,
+20,94,191,139,176,121,100,104,111,103,112,56,63,124,99,120,150,3,74,1,15,
+210,132,108,80,104,76,119,167,130,162,124,146,196,207,196,139,198,146,132,
+159,159,144,200,100,88,106,136,161,126,252,252,0,10,0,102,255,129,5,76,6,
+6,0,5,0,8,0,12,0,16,0,20,0,24,0,28,0,32,0,36,0,40,0,0,5,33,53,1,51,1,1,3,
+33,1,53,33,7,37,33,21,33,37,33,53,41,2,21,33,1,7,33,53,23,33,39,33,53,51,
+39,35,5,51,53,35,5,76,251,26,2,80,70,2,80,253,141,213,1,168,254,250,254,90,
+35,3,211,254,92,1,201,252,82,1,127,254,164,3,28,254,166,1,127,253,8,34,1,
+53,102,1,54,37,254,239,234,35,199,254,174,236,199,127,72,6,61,249,195,5,116,
+253,197,252,229,97,97,97,97,199,96,96,1,39,96,96,96,96,102,97,97,97,0,3,0,
+102,255,129,3,49,6,23,0,48,0,60,0,72,0,0,1,17,51,1,17,52,38,35,34,6,21,20,
+22,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,51,50,18,17,17,35,1,
+21,22,22,21,20,6,35,34,38,53,52,54,18,54,53,52,38,35,34,6,21,20,22,51,54,
+22,21,20,6,35,34,38,53,52,54,51,1,123,72,1,8,155,152,91,112,68,59,49,59,47,
+82,68,119,92,102,128,174,126,207,208,72,254,248,89,110,146,104,105,143,111,
+198,87,86,62,61,84,85,60,26,36,36,26,26,35,35,26,1,109,1,163,254,248,1,234,
+230,216,101,79,69,83,67,52,60,47,61,75,99,90,125,142,110,127,158,254,231,
+254,244,253,96,1,10,239,19,138,87,105,143,143,105,90,136,254,140,85,61,61,
+86,85,62,63,83,207,35,26,26,36,36,26,26,35,0,0,1,0,102,255,236,3,246,5,182,
+0,75,0,0,1,6,6,35,34,39,55,22,51,50,55,38,35,34,7,39,54,51,50,23,54,53,52,
+36,35,34,7,39,54,51,32,4,21,20,7,22,21,20,7,22,21,20,4,5,34,39,55,22,51,50,
+36,53,52,39,6,6,35,34,39,55,22,51,50,55,38,35,34,7,39,54,51,50,23,54,53,52,
+3,47,79,210,125,133,166,21,149,129,149,144,139,154,132,146,21,162,137,241,
+173,96,254,210,208,137,141,21,167,132,1,10,1,91,109,109,109,109,254,173,254,
+238,138,161,21,143,135,208,1,46,96,57,215,142,137,162,21,135,143,140,153,
+134,159,146,132,21,151,148,241,173,96,3,90,41,47,31,98,27,46,47,27,98,31,
+90,65,74,95,149,27,99,30,206,140,108,90,88,109,109,90,85,111,138,205,3,30,
+99,27,149,95,72,65,31,57,31,98,27,45,47,26,98,31,90,65,74,72,0,0,4,0,102,
+255,168,5,162,6,8,0,44,0,48,0,51,0,54,0,0,1,23,19,51,19,55,23,7,23,5,7,39,
+19,22,21,20,6,35,34,38,53,52,54,55,3,37,5,3,22,22,21,20,6,35,34,38,53,52,
+55,19,7,39,37,55,39,5,23,55,3,3,7,55,51,23,39,1,90,205,186,70,186,205,53,
+223,92,1,66,53,211,149,41,86,61,62,86,74,55,164,254,246,254,246,164,56,73,
+86,61,62,86,43,148,211,54,1,64,92,221,1,90,133,133,133,170,41,113,196,111,
+41,4,147,122,1,239,254,17,122,86,133,243,191,86,125,254,117,43,60,61,86,86,
+61,58,82,6,1,180,158,158,254,76,6,85,55,61,86,86,61,62,43,1,137,125,86,191,
+243,133,90,80,80,1,101,254,59,108,67,67,108,0,3,0,102,255,242,5,0,5,205,0,
+19,0,26,0,33,0,0,1,33,17,35,53,34,36,53,52,54,55,38,53,52,54,55,53,51,17,
+33,1,17,6,6,21,20,22,19,17,6,6,21,20,22,5,0,253,207,103,210,254,208,139,136,
+150,195,194,103,2,49,253,104,179,232,246,165,158,128,149,2,217,253,25,143,
+179,173,115,161,40,77,162,137,158,10,144,253,114,253,168,1,242,6,127,115,
+124,126,2,88,1,152,11,109,83,85,106,0,0,4,0,184,255,197,4,35,5,221,0,20,0,
+32,0,41,0,45,0,0,19,51,50,55,54,54,51,50,22,21,20,6,7,21,51,17,33,17,51,53,
+35,19,33,17,35,21,35,53,35,21,35,53,35,1,54,54,53,52,38,35,34,6,7,7,21,51,
+184,119,227,121,2,130,114,73,89,157,148,235,252,219,236,236,103,2,88,133,
+103,129,102,133,1,211,95,107,38,29,53,76,109,129,129,4,80,16,176,205,102,
+84,104,145,34,190,252,123,3,133,159,252,66,2,184,174,174,174,174,1,144,22,
+93,65,40,40,135,248,10,164,0,5,0,102,0,0,6,229,5,135,0,81,0,85,0,88,0,98,
+0,106,0,0,19,38,38,53,52,54,51,50,23,54,54,51,50,23,54,54,51,50,23,17,51,
+17,54,51,50,22,23,54,51,50,22,23,54,51,50,22,21,20,6,7,39,54,53,52,35,34,
+15,2,39,55,54,53,52,38,35,34,6,7,39,1,21,33,53,1,7,38,38,35,34,6,21,20,23,
+7,39,38,35,34,21,20,23,1,17,1,7,1,17,33,0,23,55,39,35,38,38,35,34,21,5,54,
+53,52,35,34,6,7,203,47,54,88,72,68,51,9,73,53,75,52,4,70,45,70,51,102,49,
+72,45,69,5,52,75,54,72,9,51,68,72,87,53,47,57,55,68,69,33,14,9,98,14,19,25,
+28,41,55,17,84,1,162,251,2,1,162,84,17,56,40,29,24,33,99,22,33,70,67,55,2,
+111,254,172,82,2,12,1,166,253,83,5,139,21,1,18,40,14,50,1,163,5,50,13,38,
+44,1,119,37,130,68,84,109,53,45,57,76,52,71,72,2,76,253,180,72,67,56,76,57,
+45,53,109,84,70,128,37,82,63,86,94,138,56,31,25,53,62,53,32,50,96,126,9,254,
+47,72,72,1,209,9,127,95,50,32,51,117,25,88,137,94,86,63,254,157,1,211,254,
+137,92,1,211,254,45,1,238,43,154,29,24,37,152,92,43,49,152,34,56,0,0,2,0,
+184,0,0,5,211,4,92,0,10,0,20,0,0,1,51,17,33,17,51,22,4,51,50,36,19,17,14,
+2,35,34,36,39,17,5,139,72,250,229,72,119,1,58,149,149,1,56,90,37,197,215,
+102,159,254,196,76,4,92,251,164,4,92,180,236,234,252,192,3,33,50,163,92,206,
+99,252,223,0,6,0,102,255,221,3,66,5,205,0,22,0,28,0,32,0,36,0,40,0,44,0,0,
+1,39,39,55,5,39,55,22,4,18,21,20,2,4,7,39,55,5,39,55,55,39,53,5,54,53,52,
+39,7,19,38,39,7,17,23,54,55,1,23,54,55,17,38,39,7,2,66,244,23,154,254,188,
+39,152,147,1,23,154,152,254,232,148,152,39,1,68,154,23,244,220,1,107,10,10,
+234,209,33,75,133,133,75,33,254,74,49,89,71,71,89,49,3,131,35,67,205,30,57,
+252,9,186,254,174,227,227,254,177,189,9,252,57,30,205,67,35,139,70,182,68,
+79,79,68,147,1,8,121,92,180,253,174,180,92,121,254,211,84,19,46,4,144,46,
+19,84,0,2,0,102,255,102,3,115,6,2,0,29,0,41,0,0,1,54,54,55,23,6,6,21,20,22,
+23,7,38,38,39,17,35,17,38,38,53,52,54,51,50,22,21,20,6,7,54,54,53,52,38,35,
+34,6,21,20,22,51,1,229,27,193,137,41,138,167,169,136,41,139,192,26,102,123,
+158,194,138,138,194,157,124,43,136,135,95,96,133,134,95,1,242,109,192,63,
+94,62,190,102,103,191,61,94,63,194,108,254,28,4,9,18,186,123,138,194,194,
+138,122,186,19,98,134,95,94,136,135,95,95,134,0,4,0,102,0,0,5,211,4,133,0,
+54,0,63,0,72,0,77,0,0,1,51,54,54,55,38,39,6,35,34,38,53,52,54,51,50,23,54,
+55,23,7,22,23,54,55,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,6,7,22,18,
+23,33,22,51,51,21,35,34,38,39,35,19,38,35,34,6,21,20,51,50,37,22,51,50,53,
+52,38,35,34,1,6,7,33,38,1,184,103,19,99,72,46,54,136,165,110,120,122,110,
+146,145,20,31,86,62,42,55,65,31,29,33,87,22,27,149,144,107,124,119,110,169,
+132,40,63,74,130,7,254,162,38,240,54,54,179,196,10,172,117,114,109,62,67,
+127,127,2,63,103,125,127,67,62,112,254,161,98,44,1,27,50,1,137,60,200,109,
+67,60,125,104,90,92,107,123,24,48,53,90,44,69,82,31,36,54,53,37,35,123,105,
+94,90,104,125,42,85,109,254,238,88,189,102,169,122,2,155,97,49,45,95,92,92,
+95,45,49,254,125,158,117,126,0,3,0,184,255,242,3,25,5,205,0,15,0,18,0,21,
+0,0,19,51,17,1,51,17,35,1,17,1,51,17,35,1,17,35,19,5,17,1,5,17,184,103,1,
+178,72,72,254,78,1,178,72,72,254,78,103,203,1,47,254,209,1,47,5,205,254,215,
+1,41,253,59,1,41,253,92,1,41,253,60,1,41,254,215,4,120,208,1,159,252,27,209,
+1,160,0,2,0,102,255,236,6,12,5,178,0,45,0,55,0,0,19,22,22,51,50,54,53,17,
+33,21,33,17,20,7,33,53,52,54,51,50,22,21,20,6,35,21,20,0,33,34,36,39,55,22,
+22,51,50,0,53,53,33,6,35,34,38,39,5,50,54,53,52,38,35,34,6,21,201,47,166,
+104,117,127,2,246,253,112,14,1,47,113,86,89,107,150,143,254,200,254,249,179,
+254,217,89,94,72,245,152,216,1,1,254,172,84,211,138,210,68,4,129,95,96,49,
+39,47,56,3,113,142,147,161,142,2,51,102,254,51,61,72,61,105,129,101,84,104,
+109,57,252,254,142,192,158,47,133,162,1,56,208,57,170,171,188,86,51,59,35,
+47,73,58,0,6,0,102,255,238,6,66,5,201,0,23,0,30,0,36,0,41,0,46,0,50,0,0,1,
+4,22,21,20,6,5,2,6,35,34,38,3,36,38,53,52,54,37,18,54,51,50,22,3,33,22,22,
+51,50,54,1,17,4,21,20,22,1,17,36,53,52,37,33,2,35,34,3,33,17,33,4,82,1,7,
+233,239,254,253,6,119,127,130,118,6,254,253,237,228,1,12,6,120,128,130,119,
+97,254,208,3,75,74,74,74,254,110,254,119,198,2,191,1,137,252,225,1,48,10,
+142,145,7,1,48,254,208,3,215,6,118,128,132,119,3,254,254,237,232,1,7,6,118,
+130,127,119,6,1,10,232,234,252,254,195,198,186,1,54,1,47,7,145,77,73,1,46,
+254,209,3,148,145,109,1,137,252,226,1,47,0,10,0,102,255,188,4,193,5,244,0,
+26,0,38,0,50,0,62,0,74,0,86,0,98,0,110,0,122,0,134,0,0,37,3,6,7,17,35,17,
+38,39,3,39,19,38,38,53,52,18,36,51,50,4,18,21,20,6,7,19,0,0,53,52,0,35,34,
+0,21,20,0,51,18,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,
+20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,
+54,51,0,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,
+18,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,3,236,
+119,87,87,103,92,82,119,98,125,111,129,150,1,4,147,148,1,4,150,132,108,125,
+254,255,1,13,254,242,185,186,254,244,1,10,188,94,128,130,92,91,130,129,92,
+48,71,70,49,48,70,71,47,28,38,38,28,27,38,38,27,28,38,38,28,27,38,38,27,1,
+53,38,38,28,28,38,38,28,253,235,37,37,28,28,38,38,28,28,37,37,28,28,38,38,
+28,2,77,38,38,28,28,38,38,28,29,1,172,39,6,254,32,1,224,6,39,254,84,26,1,
+197,76,243,140,148,1,4,149,149,254,253,149,139,246,74,254,59,1,201,1,13,186,
+187,1,11,254,245,187,184,254,241,2,164,130,91,92,130,130,92,92,129,254,172,
+70,49,48,70,70,48,49,70,2,8,38,27,28,38,38,28,27,38,253,96,37,28,28,38,38,
+28,28,37,1,250,37,28,28,38,38,28,28,37,37,28,28,38,38,28,28,37,254,172,37,
+28,28,38,38,28,28,37,37,28,28,38,38,28,28,37,0,0,5,0,102,255,137,7,6,6,45,
+0,41,0,51,0,62,0,72,0,83,0,0,1,54,51,50,22,21,20,6,35,34,39,22,21,20,6,35,
+34,38,53,52,54,55,6,35,34,38,53,52,54,51,50,23,38,38,53,52,54,51,50,22,21,
+20,2,54,53,52,39,6,21,20,22,51,3,38,38,35,34,6,21,20,22,51,50,36,38,35,34,
+7,22,51,50,54,53,37,54,54,53,52,38,35,34,6,21,20,4,104,175,163,141,191,188,
+142,169,171,91,153,116,115,153,54,34,171,161,144,192,189,143,166,170,34,54,
+153,115,116,153,198,95,166,166,95,71,78,150,202,86,97,132,132,99,195,4,41,
+134,100,189,245,241,204,92,131,253,22,80,86,95,71,72,94,3,141,90,151,117,
+116,152,88,165,167,148,190,189,145,102,166,68,88,150,118,116,152,90,68,167,
+103,145,189,189,143,177,251,192,134,99,193,241,241,195,98,133,2,235,98,68,
+95,71,71,95,237,95,166,166,96,70,80,113,231,98,94,132,136,100,191,0,4,0,102,
+255,115,4,18,6,63,0,29,0,40,0,47,0,59,0,0,0,23,53,39,55,1,7,39,21,22,22,21,
+20,6,7,21,55,23,1,39,55,53,6,35,34,0,53,52,0,51,18,55,17,38,35,34,6,21,20,
+22,51,19,17,54,54,53,52,38,4,22,21,20,6,35,34,38,53,52,54,51,2,108,46,244,
+45,2,63,45,229,126,148,145,129,229,45,253,193,45,244,37,58,194,254,237,1,
+22,191,48,47,34,61,152,214,215,151,197,83,89,91,254,142,62,60,45,43,61,64,
+40,4,180,10,195,116,94,254,236,94,110,178,58,231,139,136,231,59,188,110,94,
+254,236,94,117,202,8,1,20,193,196,1,19,252,187,12,2,199,12,221,148,150,216,
+2,165,253,148,53,164,92,92,168,155,61,44,41,63,61,43,46,59,0,1,0,102,1,152,
+3,4,4,53,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,2,62,198,199,137,140,
+194,196,138,4,53,198,138,138,195,195,138,139,197,0,0,4,0,102,0,0,3,213,5,
+217,0,14,0,23,0,35,0,47,0,0,19,1,23,7,17,51,50,4,21,20,4,35,35,17,7,5,17,
+51,50,54,53,52,38,35,22,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,
+34,38,53,52,54,51,102,1,224,65,198,43,213,1,20,254,234,211,146,178,1,25,43,
+172,215,213,174,168,42,42,31,31,43,43,31,31,42,42,31,31,43,43,31,4,53,1,164,
+78,174,254,168,241,205,204,251,4,131,156,200,253,71,192,161,158,186,125,45,
+31,31,43,43,31,31,45,254,217,45,31,31,43,43,31,31,45,0,6,0,102,254,244,2,
+246,6,203,0,47,0,59,0,71,0,83,0,95,0,107,0,0,1,38,53,52,54,51,50,22,21,20,
+7,22,21,20,7,22,22,21,20,6,7,22,21,20,7,22,21,20,6,35,34,38,53,52,55,38,53,
+52,55,38,38,53,52,54,55,38,53,52,0,54,53,52,38,35,34,6,21,20,22,51,18,54,
+53,52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,18,54,53,
+52,38,35,34,6,21,20,22,51,18,54,53,52,38,35,34,6,21,20,22,51,1,31,76,127,
+92,92,129,80,80,65,82,90,89,83,65,80,80,129,92,92,127,76,76,63,82,90,90,80,
+61,1,57,131,130,95,95,130,130,95,50,69,70,49,48,69,70,47,50,69,68,51,49,68,
+70,47,50,69,68,51,49,68,70,47,50,69,68,51,48,69,70,47,5,70,63,105,92,129,
+129,92,107,61,65,105,95,61,45,155,89,90,155,46,61,94,107,61,65,105,92,127,
+127,92,103,67,63,105,96,59,44,155,92,91,154,44,61,95,103,252,251,131,94,93,
+133,133,93,96,129,3,123,67,50,48,70,69,49,51,66,254,174,65,52,48,70,70,48,
+51,66,251,51,68,49,49,70,70,49,51,66,1,82,67,50,49,70,69,50,51,66,0,0,2,0,
+102,255,236,7,47,4,229,0,56,0,66,0,0,1,19,54,51,17,51,17,50,23,19,23,3,22,
+23,55,23,7,22,23,55,23,3,38,36,39,17,22,22,23,7,38,39,6,6,35,34,38,53,52,
+54,51,51,17,6,4,7,3,55,23,54,55,39,55,23,54,55,3,1,35,34,6,21,20,22,51,50,
+54,2,205,67,85,51,102,48,85,70,98,66,73,50,121,92,118,52,60,174,78,240,109,
+254,233,189,133,231,66,66,143,221,6,131,119,104,127,185,167,33,195,254,233,
+104,240,78,174,58,55,119,92,119,59,66,66,1,46,25,121,137,70,59,68,80,4,207,
+254,242,8,1,28,254,228,8,1,14,21,254,248,14,17,244,41,241,25,43,211,66,254,
+226,99,94,5,254,88,17,99,66,78,124,32,173,185,125,96,109,141,1,159,5,97,96,
+1,30,66,211,41,27,241,41,244,19,12,1,8,252,162,77,70,51,68,132,0,2,0,102,
+255,225,4,18,5,213,0,35,0,47,0,0,1,19,7,3,7,21,35,17,37,17,35,17,51,5,17,
+38,38,53,52,54,51,50,22,21,20,6,7,21,55,51,19,7,3,7,17,55,2,54,53,52,38,35,
+34,6,21,20,22,51,3,2,213,86,170,109,102,254,201,103,72,1,86,78,98,134,93,
+94,136,101,78,138,69,217,90,180,154,80,78,74,75,52,52,73,72,53,1,145,254,
+170,53,1,17,123,187,1,193,203,255,0,1,141,221,1,243,18,123,83,97,132,134,
+95,83,123,18,161,108,254,113,49,1,73,120,254,75,90,2,226,72,53,52,75,75,52,
+51,74,0,3,0,102,255,209,3,80,5,246,0,23,0,33,0,47,0,0,0,6,7,22,22,21,20,6,
+35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,21,4,23,54,53,52,38,35,34,6,
+21,19,14,2,21,20,22,51,50,54,53,52,38,38,3,0,95,114,184,105,206,167,168,205,
+118,171,114,95,161,132,136,157,254,29,190,191,102,89,88,102,190,122,93,55,
+151,119,118,152,53,93,4,82,183,96,134,217,120,169,234,235,164,136,215,124,
+96,186,105,139,173,179,135,175,146,147,168,99,118,114,95,254,60,92,99,133,
+84,125,174,172,125,83,133,101,0,0,2,0,102,0,242,7,59,4,43,0,47,0,59,0,0,9,
+2,23,7,33,54,54,51,50,22,21,20,6,35,34,38,39,33,23,7,1,1,39,55,33,34,38,53,
+52,54,51,50,22,23,7,39,38,38,35,34,6,21,20,22,51,33,39,0,54,53,52,38,35,34,
+6,21,20,22,51,2,197,1,10,1,10,74,215,1,43,16,123,84,95,134,136,93,84,123,
+16,254,215,213,74,254,246,254,246,74,213,254,61,136,159,161,110,55,104,56,
+68,14,23,72,38,71,97,103,89,1,197,215,4,16,74,75,52,52,73,71,54,3,147,254,
+248,1,8,73,213,75,103,134,95,96,132,100,76,211,73,1,6,254,250,73,211,145,
+126,117,153,38,56,72,13,22,29,98,70,77,91,213,254,123,72,53,52,75,74,53,53,
+72,0,2,0,102,255,215,4,156,5,205,0,32,0,44,0,0,5,17,33,53,33,6,6,35,34,38,
+53,52,54,51,50,22,23,33,17,33,21,35,17,33,17,33,53,33,17,35,17,33,17,0,54,
+53,52,38,35,34,6,21,20,22,51,2,160,1,149,254,6,18,128,85,98,140,137,101,83,
+130,18,1,250,254,209,102,1,149,254,107,1,252,103,254,209,254,132,81,81,54,
+54,81,81,54,41,2,4,96,80,106,140,98,95,142,105,81,1,47,209,1,55,1,47,103,
+250,10,1,158,254,98,2,16,79,57,56,79,79,56,57,79,0,2,0,102,255,193,4,80,6,
+0,0,47,0,50,0,0,19,54,54,51,50,22,21,20,6,7,19,7,3,6,7,3,39,19,6,6,21,20,
+22,51,50,55,23,6,6,35,34,38,53,52,54,55,19,51,19,54,54,53,52,38,35,34,6,7,
+1,55,39,229,80,245,140,188,222,133,133,163,98,162,72,96,149,98,127,122,126,
+169,128,161,82,80,47,172,106,170,228,200,190,137,69,107,95,101,168,141,110,
+193,74,1,37,101,45,4,225,136,151,226,147,129,205,61,253,250,33,2,0,21,20,
+254,41,33,1,147,46,175,117,122,154,102,63,65,76,213,165,170,237,50,1,176,
+254,174,47,151,99,110,161,122,116,254,117,26,146,0,0,2,0,102,255,236,3,66,
+5,219,0,26,0,36,0,0,0,23,54,54,53,17,51,17,20,6,7,22,22,21,17,35,17,52,39,
+6,35,34,38,53,52,54,51,23,38,35,34,6,21,20,22,51,50,2,34,120,28,37,103,54,
+49,49,54,103,67,117,166,114,165,161,116,229,93,128,76,106,104,78,127,3,219,
+143,75,197,90,1,37,254,219,119,248,98,96,245,121,254,213,1,45,195,159,143,
+136,111,106,142,246,144,84,62,63,82,0,1,0,184,0,0,6,27,5,2,0,19,0,0,1,1,35,
+17,51,17,1,51,17,33,21,33,21,33,21,33,21,33,21,33,3,205,253,51,72,103,2,205,
+71,1,232,254,24,1,232,254,24,1,232,253,178,4,86,253,72,3,100,253,70,2,186,
+253,186,102,197,102,197,102,0,2,0,102,255,186,2,143,6,2,0,38,0,50,0,0,1,21,
+51,21,35,21,51,21,35,21,51,21,35,21,22,22,21,20,6,35,34,38,53,52,54,55,53,
+35,53,51,53,35,53,51,53,35,53,51,53,18,54,53,52,38,35,34,6,21,20,22,51,1,
+174,205,205,205,205,205,205,98,127,160,116,116,161,128,98,205,205,205,205,
+205,205,123,102,102,72,72,102,102,72,6,2,207,102,193,102,193,102,160,18,153,
+101,116,161,160,117,101,152,19,160,102,193,102,193,102,207,250,31,102,72,
+72,102,102,72,72,102,0,0,2,0,102,0,0,5,254,4,236,0,22,0,29,0,0,19,5,54,51,
+50,18,17,21,5,7,39,17,35,17,1,6,21,17,35,17,52,55,37,5,1,53,52,2,35,34,164,
+1,65,125,178,200,247,1,43,61,238,102,253,147,68,102,88,254,184,1,209,2,54,
+191,154,130,4,236,240,154,254,150,254,255,88,221,82,176,254,172,1,160,1,200,
+142,175,253,213,2,43,213,166,244,217,254,94,12,213,1,47,0,3,0,102,255,84,
+3,68,6,0,0,27,0,39,0,51,0,0,19,33,53,38,38,53,52,54,51,50,22,21,20,6,7,21,
+33,21,33,17,1,7,3,3,39,1,17,33,0,54,53,52,38,35,34,6,21,20,22,51,18,22,21,
+20,6,35,34,38,53,52,54,51,131,1,31,135,181,216,151,151,216,181,135,1,31,254,
+225,1,23,90,240,240,90,1,23,254,225,1,189,157,156,108,108,156,156,108,37,
+51,51,37,37,51,51,37,2,190,105,18,206,138,151,216,216,151,138,206,18,105,
+102,254,227,254,78,53,1,121,254,135,53,1,178,1,29,1,49,156,108,110,155,157,
+108,107,157,1,96,50,38,37,51,51,37,38,50,0,0,2,0,102,255,102,4,96,6,2,0,23,
+0,35,0,0,37,39,33,17,35,17,38,38,53,52,54,51,50,22,21,20,6,7,17,33,55,23,
+7,23,0,54,53,52,38,35,34,6,21,20,22,51,4,23,222,254,172,102,123,158,194,138,
+138,194,157,124,1,84,222,73,198,198,253,176,136,135,95,96,133,134,95,231,
+222,253,161,4,9,18,186,123,138,194,194,138,122,186,19,254,188,221,74,198,
+199,2,160,134,95,94,136,135,95,95,134,0,0,1,0,184,255,236,3,39,5,205,0,27,
+0,0,19,22,51,50,54,53,52,38,35,34,7,39,17,51,17,54,51,50,22,21,20,6,35,34,
+39,17,35,17,246,119,90,101,149,146,104,95,114,62,103,75,93,141,211,209,143,
+91,77,103,2,16,49,137,115,113,139,49,35,2,4,254,82,30,192,160,159,197,31,
+254,84,2,2,0,0,1,0,102,255,236,4,160,5,205,0,13,0,0,1,33,17,33,53,33,17,33,
+21,33,17,35,17,33,1,141,1,97,253,120,2,238,1,76,254,180,102,254,159,3,113,
+1,245,103,253,164,103,252,226,3,30,0,0,3,0,102,255,125,3,248,6,16,0,25,0,
+32,0,41,0,0,5,17,6,33,35,53,51,32,55,54,54,51,50,22,21,20,6,7,21,22,22,21,
+20,6,7,25,2,54,54,53,52,38,3,54,54,53,52,38,35,34,6,2,76,143,254,243,74,74,
+1,12,144,11,117,103,80,88,162,135,149,177,175,151,108,115,114,107,90,103,
+36,32,55,64,131,4,180,20,102,23,188,186,93,83,105,149,30,189,7,168,140,139,
+175,10,254,117,3,164,254,78,8,115,98,96,109,1,151,24,92,58,35,41,128,0,0,
+1,0,184,0,0,3,63,5,78,0,39,0,0,1,54,53,52,38,35,34,6,21,17,35,17,52,54,51,
+50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,21,54,54,51,50,22,21,20,6,7,2,199,
+18,92,100,118,132,103,179,165,142,161,16,16,88,18,92,100,130,120,34,131,85,
+139,155,18,14,2,197,34,29,51,64,126,108,253,115,4,10,158,166,119,94,37,47,
+29,45,34,30,51,63,109,122,129,40,54,120,93,37,50,25,0,0,2,0,102,255,184,4,
+209,5,211,0,36,0,40,0,0,19,33,17,51,17,51,17,51,17,33,21,33,17,33,21,33,17,
+35,17,35,17,35,17,35,23,21,7,5,7,37,53,55,39,55,33,17,33,1,51,17,35,238,1,
+32,103,213,102,1,33,254,223,1,33,254,223,102,213,103,215,105,191,1,125,49,
+254,57,205,182,33,1,112,254,224,1,135,213,213,4,70,1,141,254,115,1,141,254,
+115,103,254,213,102,254,115,1,141,254,115,1,141,107,71,197,197,90,236,72,
+213,182,61,1,43,254,213,1,43,0,0,2,0,98,255,236,6,55,5,57,0,28,0,32,0,0,1,
+33,17,1,23,3,19,7,1,17,20,6,35,34,38,53,53,51,21,20,22,51,32,17,17,39,51,
+17,33,19,39,55,5,5,104,253,246,2,180,35,108,110,35,253,74,198,181,175,210,
+103,156,126,1,21,2,2,2,112,60,70,68,254,57,4,211,254,37,1,86,27,254,146,254,
+145,27,1,86,254,238,182,221,224,144,58,58,106,160,1,70,1,43,2,2,116,252,168,
+228,225,225,0,0,3,0,184,0,0,4,80,5,193,0,8,0,11,0,14,0,0,51,17,51,1,21,1,
+1,21,1,19,1,37,17,17,37,184,72,3,80,253,47,2,209,252,176,31,2,127,253,129,
+2,127,5,193,254,235,72,254,123,254,123,72,254,238,3,33,1,88,209,253,84,253,
+215,209,0,1,0,184,0,172,3,88,4,236,0,11,0,0,1,17,35,17,33,17,35,17,51,17,
+33,17,3,88,102,254,45,103,103,1,211,4,236,251,192,1,246,254,10,4,64,254,28,
+1,228,0,0,3,0,102,255,236,5,70,5,199,0,21,0,24,0,27,0,0,19,33,21,1,17,20,
+6,35,34,38,53,53,51,21,20,22,51,50,54,53,17,1,1,53,33,33,21,37,172,4,154,
+253,229,191,163,163,192,103,128,124,119,133,253,231,2,25,254,188,1,170,1,
+66,5,199,72,254,109,253,124,173,207,186,160,65,65,115,129,149,129,2,132,1,
+147,254,238,243,243,243,0,2,0,102,255,133,4,197,5,59,0,13,0,17,0,0,19,33,
+21,35,17,51,17,35,53,33,53,51,17,35,1,33,17,33,102,4,95,217,210,102,252,14,
+238,238,1,84,1,203,254,53,5,59,102,252,16,254,160,250,102,3,240,252,16,3,
+240,0,0,1,0,180,0,184,5,215,4,231,0,17,0,0,37,1,17,35,17,51,1,17,51,17,33,
+17,51,17,35,17,33,17,3,113,253,170,103,58,2,86,102,1,199,102,102,254,57,184,
+3,64,252,192,4,47,252,193,3,63,254,33,1,223,251,209,1,234,254,22,0,1,0,184,
+0,0,5,18,4,123,0,11,0,0,1,17,33,17,33,17,35,17,33,17,33,17,1,31,1,147,2,96,
+102,254,109,253,159,4,123,251,235,4,21,251,133,4,20,251,236,4,123,0,0,1,0,
+102,0,0,5,125,4,156,0,23,0,0,19,33,17,51,17,33,17,51,17,51,17,33,21,33,17,
+35,17,33,17,35,17,35,17,33,102,1,7,102,1,80,237,103,1,6,254,250,103,254,172,
+233,102,254,249,3,94,1,62,254,194,254,70,2,248,253,8,103,254,195,1,61,1,187,
+253,8,2,248,0,1,0,184,0,0,4,74,5,10,0,6,0,0,1,1,7,1,17,35,17,1,0,3,74,62,
+253,19,103,5,10,253,140,82,2,47,251,141,5,10,0,3,0,102,255,236,4,240,5,61,
+0,27,0,34,0,41,0,0,0,0,21,20,2,7,21,20,6,35,34,38,53,53,51,21,20,22,51,32,
+17,53,38,2,53,52,0,51,3,17,6,6,21,20,22,19,17,54,54,53,52,38,3,234,1,6,230,
+168,198,181,166,219,103,156,126,1,21,171,231,1,7,188,49,129,170,171,230,127,
+168,167,5,61,254,247,185,173,255,0,20,59,182,221,215,153,58,27,137,160,1,
+70,34,18,1,3,172,185,1,9,252,228,2,178,18,195,131,131,197,2,160,253,80,18,
+199,127,126,197,0,1,0,102,255,236,5,61,5,205,0,39,0,0,1,55,37,17,20,6,35,
+34,38,53,53,51,21,20,22,51,50,54,53,17,51,21,5,21,7,23,21,7,23,21,7,5,7,37,
+53,55,39,53,55,39,3,139,144,254,159,149,143,139,165,103,107,94,93,97,102,
+2,52,185,244,229,229,236,1,0,36,254,108,236,236,223,217,3,250,78,63,252,217,
+177,195,188,162,51,51,115,133,138,132,4,109,219,105,71,99,92,70,90,86,69,
+111,96,94,145,72,112,95,69,86,84,0,1,0,102,255,236,2,139,5,205,0,22,0,0,1,
+55,37,17,51,17,5,21,7,23,21,7,23,21,5,17,35,17,37,39,53,55,39,1,39,184,254,
+135,103,1,190,209,209,209,209,254,66,103,1,121,184,205,205,3,147,101,127,
+1,86,254,244,152,72,114,113,72,110,115,72,151,254,246,1,83,127,101,71,113,
+113,0,0,1,0,184,0,0,3,63,4,229,0,22,0,0,33,35,17,51,17,54,54,51,50,22,21,
+20,6,7,39,54,53,52,38,35,34,6,21,1,31,103,103,34,131,85,139,155,18,14,88,
+18,92,100,118,132,4,229,254,154,40,54,120,93,37,50,25,45,34,29,51,64,126,
+108,0,3,0,102,0,25,3,143,5,154,0,11,0,15,0,19,0,0,55,33,17,33,17,33,21,33,
+17,33,17,33,1,35,17,51,1,51,17,35,102,1,146,254,213,2,194,254,207,1,49,252,
+215,2,195,203,203,254,10,197,197,127,2,39,2,244,103,253,217,253,13,2,141,
+253,217,2,141,2,39,0,0,2,0,102,255,117,3,221,6,43,0,15,0,25,0,0,19,51,38,
+53,52,54,51,50,18,17,17,35,17,52,39,33,37,33,38,38,35,34,6,21,20,22,102,207,
+100,164,131,237,248,102,8,252,247,1,99,1,151,37,187,136,87,106,95,4,35,116,
+125,116,163,254,90,254,166,252,74,3,184,69,74,103,205,213,100,77,66,138,0,
+3,0,102,255,117,3,221,6,43,0,13,0,22,0,30,0,0,19,51,38,53,52,54,51,50,18,
+17,17,35,17,33,19,33,38,38,35,34,6,21,20,23,22,22,23,33,53,52,39,102,197,
+111,178,146,232,245,102,252,239,199,2,53,33,177,134,109,122,39,22,60,30,1,
+189,6,3,43,137,223,190,218,254,114,254,142,252,74,3,80,1,94,205,213,160,146,
+62,153,50,76,19,2,69,74,0,1,0,102,255,221,5,109,5,43,0,26,0,0,1,33,21,20,
+6,35,34,38,53,53,51,21,20,22,51,32,17,17,33,21,33,21,33,21,33,21,33,5,109,
+253,245,195,184,176,209,103,156,126,1,21,2,113,253,245,2,11,253,245,2,11,
+2,111,254,180,224,226,143,57,57,106,160,1,69,3,162,102,197,102,197,0,0,2,
+0,102,255,246,9,215,5,45,0,49,0,61,0,0,37,1,1,35,39,5,39,37,39,5,39,37,39,
+5,39,9,2,51,9,2,55,1,55,54,54,51,50,22,21,20,6,35,34,38,39,7,5,7,37,7,5,7,
+37,7,5,7,37,7,1,22,51,50,54,53,52,38,35,34,6,7,5,147,254,220,254,221,72,82,
+254,191,54,1,72,53,254,184,53,1,76,52,254,177,52,1,164,1,31,1,35,71,1,37,
+1,82,254,96,70,1,139,35,89,166,103,124,151,196,150,91,140,58,57,1,88,53,254,
+172,52,1,82,53,254,180,51,1,74,53,254,186,80,1,178,109,131,103,141,94,78,
+73,124,72,74,2,30,253,226,153,237,88,241,99,244,90,244,98,248,91,1,53,253,
+235,2,31,253,227,2,138,1,114,78,254,160,63,159,124,147,111,143,199,57,39,
+113,253,89,250,98,248,88,244,98,244,88,239,155,3,67,88,138,100,71,87,99,129,
+0,1,0,184,0,182,5,211,4,246,0,18,0,0,1,17,35,17,1,17,35,17,33,17,35,17,51,
+17,33,17,51,17,1,5,211,102,253,235,102,254,45,103,103,1,211,102,2,64,4,246,
+251,192,3,160,254,102,253,250,1,246,254,10,4,64,254,28,1,228,254,71,1,185,
+0,3,0,102,255,96,7,111,6,100,0,7,0,11,0,23,0,0,5,1,53,1,51,1,21,1,39,9,2,
+36,22,21,20,6,35,34,38,53,52,54,51,3,199,252,159,3,97,71,3,97,252,155,33,
+3,23,252,233,252,236,3,63,62,60,45,43,61,64,40,160,3,97,71,3,92,252,164,71,
+252,159,113,3,18,3,19,252,237,105,61,44,41,63,61,43,46,59,0,0,3,0,102,255,
+236,4,10,5,205,0,9,0,12,0,15,0,0,5,33,53,1,1,53,33,21,9,3,33,9,2,4,10,252,
+92,1,150,254,106,3,164,254,105,1,151,254,45,254,185,2,145,253,111,1,71,1,
+74,20,71,2,168,2,170,72,72,253,86,253,88,2,70,253,217,5,20,253,217,2,39,0,
+0,1,0,102,255,236,6,250,5,205,0,55,0,0,1,33,53,51,21,33,21,33,21,33,21,33,
+17,20,22,51,50,54,53,52,38,39,55,22,22,21,20,2,35,34,38,39,6,6,35,34,2,53,
+52,54,55,23,6,21,20,22,51,50,54,53,17,33,53,33,53,33,1,254,1,127,102,1,127,
+254,129,1,127,254,129,196,152,151,189,42,39,73,51,60,244,205,127,204,62,62,
+204,127,204,245,61,50,74,82,189,151,148,200,254,129,1,127,254,129,4,229,232,
+232,102,254,102,254,163,158,206,204,132,62,119,48,70,51,161,87,171,254,245,
+124,119,120,123,1,10,172,87,163,49,70,96,133,131,205,208,156,1,93,102,254,
+0,3,0,102,255,236,2,203,5,205,0,14,0,21,0,28,0,0,5,53,38,36,53,52,37,38,53,
+52,54,55,53,51,17,39,17,34,6,21,20,22,19,17,6,6,21,20,22,2,100,249,254,251,
+1,19,156,230,161,103,103,177,230,242,165,133,155,166,20,133,17,185,154,232,
+81,83,155,134,159,10,162,250,31,235,1,244,125,121,118,130,2,86,1,144,11,106,
+82,83,106,0,0,2,0,102,255,236,4,119,5,205,0,17,0,21,0,0,1,19,7,3,7,17,35,
+17,39,3,39,19,51,23,19,51,19,55,5,23,55,3,3,121,254,86,215,168,103,168,215,
+86,254,72,51,92,105,90,51,254,242,76,73,73,4,203,254,110,53,1,84,164,252,
+56,3,200,160,254,176,53,1,146,47,1,49,254,207,47,109,65,65,1,0,0,0,2,0,102,
+255,150,3,217,6,25,0,18,0,27,0,0,5,17,38,38,53,52,54,51,50,22,23,22,51,51,
+21,35,34,39,17,3,38,38,35,34,6,21,20,22,1,150,145,159,96,81,108,112,7,127,
+147,205,217,154,106,107,6,52,64,36,38,93,106,4,192,38,141,89,81,102,173,194,
+20,103,19,251,84,5,45,116,123,47,29,43,89,0,0,2,0,102,255,246,4,201,5,190,
+0,17,0,29,0,0,19,33,21,33,22,17,16,7,33,21,33,53,33,38,17,16,55,33,0,2,35,
+34,2,17,16,18,51,50,18,17,102,4,99,254,213,186,190,1,47,251,157,1,45,188,
+186,254,213,3,140,181,165,162,185,185,162,160,186,5,190,102,186,254,63,254,
+51,180,102,102,183,1,202,1,193,186,254,189,1,67,254,191,254,198,254,197,254,
+186,1,67,1,62,0,3,0,184,255,127,4,168,6,12,0,20,0,24,0,33,0,0,19,33,17,6,
+35,35,53,51,50,55,54,54,51,50,22,21,20,6,7,17,33,55,33,17,33,1,54,54,53,52,
+38,35,34,6,184,2,97,124,173,195,195,185,112,4,120,105,78,92,156,141,253,57,
+103,1,250,254,6,2,96,91,104,36,32,51,67,3,14,1,33,16,102,19,171,201,96,74,
+106,148,34,251,61,102,2,195,2,4,25,94,63,29,39,127,0,1,0,102,255,236,4,2,
+5,205,0,23,0,0,5,53,7,39,55,17,51,21,33,21,33,21,33,21,33,21,33,21,33,17,
+23,7,39,21,1,72,152,74,226,102,2,84,253,172,1,248,254,8,1,148,254,108,225,
+73,152,20,213,152,74,225,4,121,109,102,184,103,199,102,254,166,225,74,152,
+213,0,2,0,184,255,238,3,195,5,199,0,22,0,32,0,0,23,17,33,21,33,17,33,53,52,
+54,51,50,22,21,20,6,35,35,17,35,17,33,17,1,51,50,53,52,38,35,34,6,21,184,
+2,246,253,113,1,32,103,92,87,106,136,122,27,103,254,224,1,135,27,155,45,45,
+42,50,18,5,217,103,253,170,62,106,127,109,81,96,111,253,74,2,182,253,74,3,
+28,101,40,52,67,68,0,2,0,102,0,66,6,164,5,41,0,36,0,48,0,0,1,55,55,52,2,36,
+35,34,7,19,35,3,6,2,21,21,22,22,21,20,6,35,34,38,53,52,54,55,53,16,0,33,32,
+0,17,20,7,0,54,53,52,38,35,34,6,21,20,22,51,6,53,2,6,153,254,239,163,53,37,
+204,106,199,188,219,96,121,153,109,109,154,117,88,1,142,1,47,1,45,1,135,8,
+251,20,92,93,66,67,93,92,68,1,236,23,114,162,1,16,156,7,253,48,2,186,59,254,
+206,196,43,19,146,93,109,153,152,110,93,143,20,45,1,38,1,142,254,115,254,
+217,81,56,254,188,95,65,66,93,93,66,65,95,0,0,3,0,102,255,233,5,106,5,190,
+0,22,0,25,0,34,0,0,1,17,51,17,51,17,51,50,22,21,20,6,35,34,38,39,35,17,35,
+3,33,53,1,7,1,33,5,20,22,51,50,54,53,52,38,3,90,178,103,14,110,123,90,71,
+93,94,2,178,102,4,253,118,2,172,36,254,43,1,215,1,131,40,44,28,33,62,5,190,
+253,111,1,217,254,39,95,91,76,100,135,125,253,34,2,222,71,2,176,184,254,39,
+102,79,79,39,33,43,43,0,0,2,0,102,0,0,5,63,5,121,0,5,0,8,0,0,33,33,53,1,51,
+1,37,33,1,5,63,251,39,2,74,70,2,73,251,166,3,217,254,21,72,5,49,250,207,30,
+4,101,0,3,0,102,255,6,4,27,6,205,0,45,0,57,0,69,0,0,1,21,20,2,7,17,22,22,
+21,20,6,35,34,38,53,52,54,55,17,38,2,53,53,51,21,20,22,23,17,38,38,53,52,
+54,51,50,22,21,20,6,7,17,54,54,53,53,4,54,53,52,38,35,34,6,21,20,22,51,18,
+54,53,52,38,35,34,6,21,20,22,51,4,27,243,181,117,161,193,137,137,192,161,
+117,182,240,103,172,147,119,159,193,136,137,193,158,120,145,176,254,233,134,
+135,93,92,135,135,92,94,134,135,93,92,135,135,92,4,174,20,215,254,238,17,
+254,237,18,184,121,134,190,189,135,123,182,18,1,19,17,1,19,214,20,20,168,
+215,19,1,62,16,182,121,135,193,194,134,119,181,19,254,194,20,213,169,20,6,
+129,92,93,132,130,95,93,128,250,197,129,92,93,132,130,95,93,128,0,0,1,0,102,
+255,236,3,12,4,147,0,32,0,0,1,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,
+6,35,34,38,53,52,54,51,51,23,53,33,17,51,21,33,17,2,59,38,84,118,126,142,
+114,103,114,102,167,150,153,208,192,144,46,40,254,240,102,1,17,2,66,6,123,
+107,124,148,113,112,70,68,155,174,202,172,159,173,2,221,1,10,163,254,125,
+0,0,2,0,102,255,236,4,231,5,4,0,17,0,29,0,0,1,22,18,23,18,1,23,0,17,21,35,
+53,52,2,39,3,39,1,0,22,21,20,6,35,34,38,53,52,54,51,1,182,148,183,48,90,1,
+15,77,254,123,102,182,174,224,82,1,9,1,233,53,53,39,39,53,53,39,5,4,144,254,
+218,176,1,57,1,45,70,254,88,254,33,47,47,245,1,179,178,254,215,62,1,94,251,
+160,53,39,39,53,53,39,39,53,0,0,7,0,102,255,127,6,242,6,51,0,14,0,17,0,20,
+0,23,0,35,0,47,0,59,0,0,19,1,17,51,1,21,1,17,4,23,21,1,35,17,1,55,5,17,55,
+37,37,17,17,37,0,22,21,20,6,35,34,38,53,52,54,51,0,22,21,20,6,35,34,38,53,
+52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,102,3,27,72,3,41,252,245,2,65,
+202,252,215,72,252,229,215,2,68,102,2,54,253,202,2,52,252,206,37,37,26,26,
+36,36,26,1,225,37,37,26,26,36,36,26,26,37,37,26,26,36,36,26,2,252,1,16,2,
+39,254,230,72,254,244,254,41,201,68,71,254,229,2,35,1,18,37,201,1,144,145,
+195,196,251,199,254,123,196,2,89,40,26,26,35,35,26,26,40,2,28,37,26,26,36,
+36,26,26,37,251,199,38,26,26,35,35,26,26,38,0,2,0,102,255,223,3,217,5,231,
+0,22,0,32,0,0,1,51,17,51,17,51,50,22,21,20,6,35,34,3,35,17,51,21,33,53,51,
+17,51,1,20,22,51,50,54,53,52,38,35,1,168,211,102,15,111,122,92,70,185,3,211,
+219,253,227,220,102,1,57,39,45,29,33,62,73,3,37,1,213,254,43,96,91,76,100,
+1,4,253,136,103,103,5,161,252,215,77,80,41,30,43,43,0,1,0,102,255,236,7,90,
+5,47,0,44,0,0,1,33,17,54,54,51,50,22,23,19,22,51,50,54,55,51,6,6,35,34,38,
+39,3,38,38,35,34,6,7,21,20,6,35,34,38,53,51,20,22,51,50,54,53,17,33,5,115,
+253,235,64,142,67,102,107,16,47,24,154,82,90,23,102,19,158,114,117,148,19,
+50,10,54,58,57,153,63,206,175,187,192,103,141,135,133,146,2,123,4,201,253,
+248,44,52,106,103,254,215,182,104,94,136,165,135,121,1,53,69,54,65,47,183,
+193,230,250,178,140,186,170,151,3,156,0,2,0,102,255,236,4,27,5,215,0,31,0,
+43,0,0,1,21,20,0,35,34,0,53,53,51,21,20,22,23,17,38,38,53,52,54,51,50,22,
+21,20,6,7,17,54,54,53,53,0,54,53,52,38,35,34,6,21,20,22,51,4,27,254,232,196,
+193,254,232,103,174,145,116,162,192,137,135,195,160,118,142,179,254,233,134,
+134,94,93,134,132,95,1,252,21,233,254,238,1,14,237,21,21,169,215,17,2,250,
+15,181,123,136,192,193,135,119,182,18,253,6,17,214,170,21,1,182,131,90,92,
+134,132,94,91,130,0,2,0,102,255,236,4,27,5,205,0,29,0,36,0,0,1,21,20,0,35,
+34,0,53,53,51,21,20,22,23,17,38,38,53,52,54,55,53,33,53,33,17,54,54,53,53,
+37,17,6,6,21,20,22,4,27,254,232,196,193,254,232,103,174,145,152,208,202,158,
+254,94,2,9,142,179,254,88,112,146,161,1,252,21,233,254,238,1,14,237,21,21,
+169,215,17,1,215,30,175,117,115,175,31,182,103,250,137,17,214,170,21,154,
+1,178,26,119,72,77,122,0,0,4,0,102,255,236,3,178,5,203,0,19,0,26,0,30,0,34,
+0,0,19,33,17,54,54,53,53,51,21,20,2,35,34,38,53,52,54,55,53,33,1,17,6,6,21,
+20,22,19,53,35,21,17,51,53,35,102,1,172,133,181,102,245,226,156,202,195,116,
+254,186,1,70,92,117,117,92,223,223,223,5,203,250,137,5,198,157,43,43,201,
+254,249,178,133,140,177,4,174,253,66,1,170,8,119,88,83,118,3,27,194,194,1,
+41,194,0,1,0,102,0,0,4,33,5,203,0,26,0,0,1,1,17,22,18,21,21,35,53,52,38,35,
+34,6,21,21,35,53,52,18,55,17,51,1,17,51,3,3,209,254,162,184,240,103,215,158,
+160,210,103,238,184,76,1,98,103,4,2,236,2,2,253,32,20,254,239,213,20,20,187,
+219,223,183,20,20,214,1,16,20,3,189,253,248,2,8,253,33,0,2,0,102,255,236,
+2,250,5,47,0,17,0,29,0,0,1,5,7,39,17,22,22,21,20,6,35,34,38,53,52,54,55,17,
+18,54,53,52,38,35,34,6,21,20,22,51,1,197,1,47,66,207,119,160,194,136,136,
+194,159,120,146,132,133,94,92,135,134,93,5,47,248,80,168,253,228,18,186,120,
+133,190,188,135,121,185,18,2,188,251,35,131,90,91,134,130,95,93,128,0,0,2,
+0,102,0,0,4,0,5,205,0,24,0,32,0,0,37,33,17,52,39,32,17,52,54,51,50,22,23,
+51,21,35,23,21,33,17,35,17,35,17,33,1,2,35,34,6,21,20,22,1,92,1,25,4,253,
+245,143,103,151,188,30,135,123,2,1,37,102,191,254,129,1,8,49,215,65,78,212,
+102,3,13,48,46,1,39,92,121,208,198,102,46,239,253,76,2,78,253,178,4,55,1,
+47,65,51,90,97,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,
+0,1,0,30,0,94,0,3,0,1,4,9,0,2,0,14,0,124,0,3,0,1,4,9,0,3,0,68,0,138,0,3,0,
+1,4,9,0,4,0,30,0,94,0,3,0,1,4,9,0,5,0,30,0,206,0,3,0,1,4,9,0,6,0,26,0,236,
+0,3,0,1,4,9,0,7,0,68,1,6,0,3,0,1,4,9,0,8,0,42,1,74,0,3,0,1,4,9,0,9,0,40,1,
+116,0,3,0,1,4,9,0,10,0,96,1,156,0,3,0,1,4,9,0,11,0,62,1,252,0,3,0,1,4,9,0,
+12,0,60,2,58,0,3,0,1,4,9,0,13,2,150,2,118,0,3,0,1,4,9,0,14,0,52,5,12,0,67,
+0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,
+0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,
+65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,
+115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,
+97,0,110,0,115,0,32,0,66,0,97,0,109,0,117,0,109,0,82,0,101,0,103,0,117,0,
+108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,
+109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,
+32,0,83,0,97,0,110,0,115,0,32,0,66,0,97,0,109,0,117,0,109,0,86,0,101,0,114,
+0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,
+111,0,116,0,111,0,83,0,97,0,110,0,115,0,66,0,97,0,109,0,117,0,109,0,78,0,
+111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,
+101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,
+112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,
+99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,
+0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,
+0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,
+0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,
+0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,
+0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,
+0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,
+83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,
+0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,
+0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,
+0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,
+0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,
+115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,
+0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,
+0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,
+0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,
+0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,
+0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,
+0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,
+0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+181,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,0,0,0,34,0,0,0,2,0,3,0,0,0,83,0,1,0,84,0,85,0,3,0,86,2,148,
+0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,48,0,74,0,2,68,70,76,84,0,26,98,97,
+109,117,0,14,0,4,0,0,0,0,255,255,0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,1,0,2,
+109,97,114,107,0,14,109,97,114,107,0,20,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,4,0,
+4,0,0,0,1,0,8,0,1,0,184,0,192,0,1,0,12,0,22,0,2,0,0,0,196,0,0,0,196,0,80,
+0,180,0,180,0,192,0,198,0,180,0,204,0,204,0,198,0,210,0,180,0,180,0,216,0,
+180,0,210,0,222,0,198,0,228,0,234,0,222,0,240,0,246,0,252,0,240,0,180,0,180,
+1,2,0,246,1,8,0,228,0,204,0,180,1,8,0,216,0,198,0,246,0,180,0,228,0,198,0,
+222,1,14,0,240,0,222,0,198,0,180,1,20,0,222,1,8,1,26,1,2,1,32,0,216,1,38,
+1,44,1,14,0,198,0,180,0,180,0,228,1,32,0,240,1,8,0,216,1,8,1,32,1,8,1,50,
+1,14,0,246,1,56,0,198,1,62,1,68,1,56,1,2,1,62,1,14,1,14,1,14,0,204,1,32,0,
+1,0,2,0,84,0,85,0,2,0,1,0,4,0,83,0,0,0,1,2,238,6,134,0,1,2,208,6,134,0,1,
+2,48,6,134,0,1,2,134,6,134,0,1,2,173,6,134,0,1,1,247,6,134,0,1,2,121,6,134,
+0,1,2,69,6,134,0,1,2,147,6,134,0,1,2,43,6,134,0,1,2,160,6,134,0,1,2,82,6,
+134,0,1,2,88,6,134,0,1,2,17,6,134,0,1,2,108,6,134,0,1,2,56,6,134,0,1,1,221,
+6,134,0,1,2,199,6,134,0,1,2,95,6,134,0,1,3,112,6,134,0,1,2,212,6,134,0,1,
+3,138,6,134,0,1,2,4,6,134,0,1,2,30,6,134,0,1,1,156,6,134,0,0,0,1,0,0,0,10,
+0,44,0,46,0,2,68,70,76,84,0,24,98,97,109,117,0,14,0,4,0,0,0,0,255,255,0,0,
+0,4,0,0,0,0,255,255,0,0,0,0,0,0,};
+#endif
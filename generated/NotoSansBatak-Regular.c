@@ -0,0 +1,542 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansBatak_Regular_ttf_size = 13404;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansBatak_Regular_ttf");
+asm(".type fz_font_NotoSansBatak_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansBatak_Regular_ttf, 13404");
+asm(".balign 64");
+asm("fz_font_NotoSansBatak_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansBatak-Regular.ttf\"");
+#else
+const int fz_font_NotoSansBatak_Regular_ttf_size = 13404;
+const char fz_font_NotoSansBatak_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,1,104,1,92,0,0,44,136,0,0,0,66,71,
+80,79,83,38,55,78,203,0,0,44,204,0,0,3,84,71,83,85,66,23,192,36,254,0,0,48,
+32,0,0,4,58,79,83,47,50,123,3,108,200,0,0,1,104,0,0,0,96,99,109,97,112,28,
+208,27,192,0,0,2,188,0,0,0,92,103,97,115,112,0,7,0,7,0,0,44,124,0,0,0,12,
+103,108,121,102,240,142,154,178,0,0,3,148,0,0,32,128,104,101,97,100,2,85,
+178,171,0,0,0,236,0,0,0,54,104,104,101,97,12,163,4,229,0,0,1,36,0,0,0,36,
+104,109,116,120,104,166,2,95,0,0,1,200,0,0,0,244,108,111,99,97,240,100,248,
+233,0,0,3,24,0,0,0,124,109,97,120,112,0,67,0,135,0,0,1,72,0,0,0,32,110,97,
+109,101,139,51,183,240,0,0,36,20,0,0,5,250,112,111,115,116,53,134,255,179,
+0,0,42,16,0,0,2,108,0,1,0,0,0,1,12,205,134,182,1,100,95,15,60,245,0,11,8,
+0,0,0,0,0,204,181,105,183,0,0,0,0,210,109,241,205,251,90,254,121,8,185,6,
+227,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,9,39,251,90,253,216,
+8,185,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,0,1,0,0,0,61,0,134,0,5,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,7,18,1,144,0,5,0,0,5,154,5,51,0,0,
+1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,
+0,0,0,0,0,0,0,2,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,4,4,0,0,129,0,0,0,0,4,20,0,0,2,
+20,0,0,9,3,0,110,9,39,0,110,8,81,0,110,8,114,0,110,8,118,0,110,8,143,0,140,
+7,236,0,140,6,184,0,110,7,139,0,110,7,235,0,110,7,165,0,110,8,0,0,140,8,114,
+0,110,6,77,0,130,7,135,0,110,8,114,0,110,8,48,0,130,6,124,0,130,7,159,0,130,
+7,228,0,110,8,110,0,80,8,181,0,130,6,98,0,140,8,150,0,110,7,175,0,110,8,114,
+0,110,8,114,0,110,8,144,0,110,8,144,0,110,6,13,0,110,7,115,0,110,8,114,0,
+110,7,87,0,110,8,34,0,130,6,255,0,110,7,236,0,140,7,77,0,110,7,77,0,110,0,
+0,251,130,2,140,0,30,0,0,254,61,0,0,251,90,3,221,0,30,2,198,0,30,4,67,0,50,
+0,0,251,239,0,0,0,30,0,0,252,174,0,0,255,26,0,0,255,26,4,101,0,30,3,142,0,
+30,8,144,0,220,8,220,0,230,6,207,0,250,5,129,1,14,0,0,0,0,0,0,0,1,0,3,0,1,
+0,0,0,12,0,4,0,80,0,0,0,16,0,16,0,3,0,0,0,0,0,13,0,32,0,160,27,243,27,255,
+254,255,255,255,0,0,0,0,0,13,0,32,0,160,27,192,27,252,254,255,255,255,0,1,
+255,245,255,227,255,99,228,68,228,60,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,21,0,21,0,21,0,21,0,92,0,182,1,11,1,102,1,194,2,18,2,68,2,110,2,
+168,2,250,3,101,3,161,3,252,4,71,4,126,4,194,5,38,5,110,5,205,6,46,6,136,
+6,235,7,55,7,140,7,207,8,19,8,81,8,159,8,249,9,53,9,111,9,179,10,0,10,89,
+10,161,10,227,11,69,11,167,11,219,12,1,12,46,12,79,12,122,12,179,12,246,13,
+62,13,99,13,131,13,164,13,216,13,251,14,29,14,226,15,113,16,14,16,64,16,64,
+0,2,0,129,0,0,3,129,6,102,0,3,0,7,0,0,19,33,17,33,37,17,33,17,129,3,0,253,
+0,2,127,254,0,6,102,249,154,129,5,102,250,154,0,1,0,110,255,225,8,149,3,107,
+0,47,0,0,37,6,4,7,6,35,34,38,53,52,55,54,36,55,38,38,35,34,15,2,6,35,34,46,
+2,39,38,53,52,54,51,50,23,30,2,51,50,55,55,62,2,51,50,18,8,149,174,254,203,
+84,238,35,36,48,65,82,1,165,148,44,146,116,95,184,75,231,228,231,90,137,115,
+108,62,17,69,39,29,27,101,108,97,53,157,210,247,125,123,119,69,235,250,94,
+12,39,19,55,60,40,57,24,29,69,7,248,192,176,69,205,205,52,94,131,80,23,30,
+37,58,33,131,107,54,191,223,114,84,43,254,147,0,2,0,110,255,245,8,185,3,107,
+0,41,0,61,0,0,1,50,22,19,23,20,6,35,34,38,39,38,38,35,34,15,2,6,35,34,46,
+2,39,38,53,52,54,51,50,23,30,2,51,50,55,55,62,2,1,20,6,35,39,38,35,34,7,7,
+34,38,53,52,54,51,50,22,23,22,6,147,189,238,52,1,50,41,45,47,11,44,139,103,
+95,184,75,231,228,231,90,137,115,108,62,17,69,39,29,27,101,108,97,53,157,
+210,247,125,123,119,2,107,48,36,106,75,59,68,73,101,36,48,111,215,84,150,
+19,71,3,107,239,254,255,12,35,49,28,43,188,153,176,69,205,205,52,94,131,80,
+23,30,37,58,33,131,107,54,191,223,114,84,43,252,227,36,53,6,5,5,6,53,36,49,
+53,13,7,28,0,1,0,110,255,226,7,207,3,212,0,57,0,0,1,54,51,50,22,21,20,6,6,
+7,6,6,7,6,35,34,38,53,52,54,55,54,53,52,38,35,34,14,2,7,6,6,35,34,38,53,52,
+18,0,55,38,38,35,34,6,7,6,35,34,38,53,52,55,54,33,50,22,4,124,220,252,174,
+205,52,91,122,50,96,37,20,44,38,65,72,139,210,115,98,114,222,216,221,156,
+46,40,24,39,72,209,1,19,63,80,121,103,128,184,160,16,13,28,46,36,243,1,40,
+121,241,3,80,132,139,124,75,142,139,137,56,110,57,31,54,34,30,96,146,222,
+135,54,59,83,160,246,234,69,38,58,33,39,1,31,1,49,39,41,28,50,82,8,54,31,
+42,27,166,69,0,0,3,0,110,255,245,8,4,3,107,0,25,0,43,0,61,0,0,1,32,4,23,22,
+21,20,6,35,34,39,39,36,33,34,4,7,6,35,34,38,53,52,55,54,36,1,20,6,35,34,38,
+35,34,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,35,34,6,35,34,38,53,52,
+54,51,50,22,4,55,1,48,2,0,126,31,47,34,14,42,16,254,198,254,6,241,254,120,
+211,31,15,35,44,38,185,2,4,4,150,48,36,30,102,58,69,93,30,36,48,111,165,163,
+111,252,104,48,36,30,102,58,69,93,30,36,48,111,165,163,111,3,107,79,71,17,
+52,40,56,18,6,111,79,80,12,55,37,51,18,89,101,252,227,36,53,11,11,53,36,49,
+53,53,49,36,53,11,11,53,36,49,53,53,0,2,0,110,255,226,7,244,3,212,0,37,0,
+59,0,0,1,38,36,33,34,6,4,7,6,35,34,38,53,52,55,54,36,33,50,4,22,22,21,20,
+6,7,6,2,7,6,6,35,34,38,53,52,18,54,5,20,7,6,2,7,6,6,35,34,38,53,52,62,5,55,
+50,22,7,40,144,254,172,254,243,184,242,254,250,156,31,15,35,44,38,191,1,228,
+1,0,247,1,77,255,122,35,46,117,246,54,12,49,20,35,67,179,208,253,111,20,84,
+211,73,12,28,26,39,67,3,31,74,111,151,65,31,37,57,2,186,53,49,31,69,59,12,
+55,37,51,18,94,96,38,78,85,47,39,65,49,127,254,190,91,22,47,60,35,33,1,7,
+253,81,36,20,86,254,245,114,19,21,54,33,9,14,57,108,144,171,56,2,50,0,2,0,
+140,255,236,8,3,3,212,0,23,0,50,0,0,5,34,38,38,53,52,54,36,33,50,4,23,22,
+17,20,6,6,35,34,38,39,37,5,6,37,50,54,53,52,38,39,38,36,35,32,7,6,21,20,22,
+51,50,55,37,54,54,51,50,23,23,22,1,252,95,173,100,225,1,187,1,33,231,1,137,
+144,186,97,176,105,73,145,99,254,251,254,201,126,3,240,90,111,70,57,120,254,
+177,189,254,122,248,134,107,95,51,92,1,27,28,82,34,77,59,227,129,20,107,188,
+123,234,216,132,93,89,115,254,250,134,198,109,45,62,162,192,77,180,143,125,
+73,121,33,70,75,142,78,152,129,139,46,182,18,25,41,146,84,0,2,0,140,255,236,
+7,96,3,212,0,13,0,25,0,0,1,20,0,33,32,0,53,52,54,36,33,32,4,22,7,52,36,33,
+32,4,21,20,4,33,32,36,7,96,254,47,254,103,254,98,254,52,205,1,147,1,10,1,
+15,1,144,203,194,254,147,254,197,254,196,254,148,1,105,1,63,1,56,1,112,1,
+224,237,254,249,1,5,239,151,224,125,124,222,154,151,169,167,153,155,165,166,
+0,1,0,110,2,130,6,74,3,107,0,24,0,0,1,20,6,35,39,38,33,34,14,2,35,34,38,53,
+52,54,55,54,36,51,32,23,22,22,6,74,48,36,54,212,254,113,154,233,163,98,19,
+36,48,34,37,81,1,122,221,1,212,210,38,33,2,243,36,53,5,24,17,19,17,53,36,
+29,47,9,22,37,35,6,50,0,0,1,0,110,0,250,7,29,2,143,0,37,0,0,1,20,6,35,34,
+39,38,38,35,34,6,7,6,6,35,34,38,39,38,53,52,54,51,50,23,22,22,51,50,54,55,
+54,54,51,50,22,23,22,7,29,69,39,32,24,57,137,98,78,172,127,121,200,95,135,
+220,90,17,69,39,32,24,57,137,98,79,176,122,116,202,98,135,220,90,17,1,119,
+37,58,33,79,83,52,60,59,54,106,121,23,30,37,58,33,79,83,54,59,56,56,106,121,
+23,0,0,3,0,110,255,236,7,95,4,106,0,11,0,23,0,49,0,0,1,20,4,33,32,36,53,52,
+36,33,32,4,7,52,36,35,34,4,21,20,4,51,50,36,1,50,4,23,22,22,21,20,6,35,34,
+39,38,33,32,7,6,35,34,38,53,52,54,55,54,36,7,95,254,139,254,180,254,177,254,
+142,1,133,1,60,1,63,1,130,194,254,243,239,246,254,244,1,14,244,243,1,9,252,
+122,152,1,106,94,38,32,42,34,20,37,197,254,164,254,185,221,42,21,26,44,30,
+24,103,1,92,1,122,187,211,212,186,186,216,213,188,104,117,117,104,105,114,
+114,3,88,26,20,8,45,23,35,61,6,32,32,6,51,38,29,48,4,21,27,0,0,3,0,110,255,
+236,7,55,5,62,0,36,0,60,0,72,0,0,1,22,22,21,20,6,6,35,34,46,2,53,52,54,55,
+38,39,38,38,53,52,54,51,50,4,23,54,36,51,50,22,21,20,6,35,32,3,20,6,35,39,
+36,35,34,4,7,7,34,38,53,52,62,3,51,32,23,22,22,1,6,6,21,20,22,51,50,54,53,
+52,38,4,75,151,166,109,225,179,130,191,113,58,158,159,179,221,37,41,45,30,
+37,1,157,141,212,1,204,183,41,35,35,31,254,176,176,42,34,65,254,121,46,121,
+254,212,53,37,26,44,21,32,225,242,61,1,78,174,38,32,254,154,139,167,136,174,
+148,159,162,2,160,88,204,108,112,123,57,35,65,105,87,97,201,99,67,43,7,47,
+30,38,53,117,68,100,111,54,35,41,50,1,178,35,61,7,17,19,10,3,51,38,23,43,
+18,27,12,32,8,45,253,100,72,168,77,56,56,58,54,74,164,0,1,0,140,255,236,7,
+116,3,212,0,38,0,0,1,20,6,33,34,38,53,52,51,50,54,54,53,52,38,36,35,34,4,
+6,21,20,22,51,50,21,20,6,35,32,38,53,52,18,36,51,32,4,18,7,116,217,254,245,
+72,49,125,108,124,54,181,254,194,191,193,254,195,180,131,155,125,49,72,254,
+250,222,227,1,151,250,1,1,1,149,222,1,54,179,151,45,52,83,29,62,59,128,229,
+133,133,230,127,87,63,83,52,45,148,182,183,1,57,174,174,254,202,0,0,3,0,110,
+255,245,8,4,3,107,0,17,0,35,0,61,0,0,37,20,6,35,34,38,35,34,6,35,34,38,53,
+52,54,51,50,22,5,20,6,35,34,38,35,34,6,35,34,38,53,52,54,51,50,22,1,32,4,
+23,22,21,20,6,35,34,39,39,36,33,34,4,7,6,35,34,38,53,52,55,54,36,7,251,48,
+36,30,102,58,69,93,30,36,48,111,165,163,111,250,202,48,36,30,102,58,69,93,
+30,36,48,111,165,163,111,1,114,1,48,2,0,126,31,47,34,14,42,16,254,198,254,
+6,241,254,120,211,31,15,35,44,38,185,2,4,78,36,53,11,11,53,36,49,53,53,49,
+36,53,11,11,53,36,49,53,53,2,236,79,71,17,52,40,56,18,6,111,79,80,12,55,37,
+51,18,89,101,0,0,1,0,130,255,226,5,223,3,212,0,51,0,0,1,38,38,35,32,7,30,
+2,23,30,2,23,23,20,6,35,34,38,39,46,9,53,52,54,55,36,51,32,22,22,21,20,6,
+7,6,6,35,34,38,53,52,55,4,31,30,197,89,254,227,135,18,140,234,197,187,244,
+142,20,2,51,40,45,47,11,17,86,124,153,165,171,159,140,104,60,49,42,1,8,244,
+1,6,210,93,43,21,64,65,38,36,51,34,3,19,3,10,15,115,151,75,24,23,72,147,111,
+20,31,46,30,41,60,76,49,28,26,30,51,80,126,179,124,33,50,5,22,27,64,59,39,
+57,19,60,60,53,35,37,29,0,1,0,110,0,234,7,5,3,107,0,33,0,0,1,38,33,34,4,7,
+6,35,34,38,53,52,54,55,54,36,51,32,4,22,21,20,6,7,6,7,6,35,34,38,53,52,55,
+54,6,8,153,254,74,161,254,108,94,75,25,35,49,27,30,141,1,193,196,1,14,1,131,
+187,25,23,223,129,22,49,38,55,31,93,2,139,44,61,34,25,55,38,20,47,12,57,71,
+41,76,66,39,41,17,160,171,30,55,33,40,36,113,0,0,2,0,110,255,245,8,4,3,107,
+0,17,0,43,0,0,37,20,6,35,34,38,35,34,6,35,34,38,53,52,54,51,50,22,1,32,4,
+23,22,21,20,6,35,34,39,39,36,33,34,4,7,6,35,34,38,53,52,55,54,36,7,231,48,
+36,30,102,58,69,93,30,36,48,111,165,163,111,252,80,1,48,2,0,126,31,47,34,
+14,42,16,254,198,254,6,241,254,120,211,31,15,35,44,38,185,2,4,78,36,53,11,
+11,53,36,49,53,53,2,236,79,71,17,52,40,56,18,6,111,79,80,12,55,37,51,18,89,
+101,0,0,3,0,130,255,236,7,174,3,212,0,23,0,43,0,64,0,0,37,20,6,35,34,38,39,
+38,38,39,39,38,38,53,52,54,51,50,4,23,23,30,2,1,20,6,35,39,38,35,34,7,7,34,
+38,53,52,54,54,51,50,22,22,1,20,6,7,6,4,4,7,6,35,34,38,53,52,55,54,36,36,
+51,50,22,5,250,56,39,21,60,49,123,221,165,164,35,32,52,32,53,1,45,84,83,114,
+186,60,1,180,48,36,39,123,143,154,115,38,36,48,57,213,121,142,200,47,254,
+42,33,31,142,254,68,254,124,157,64,21,36,50,53,105,1,217,2,25,113,35,50,62,
+34,48,29,27,66,99,61,61,13,46,23,38,54,110,38,35,48,95,64,1,168,36,53,3,15,
+15,3,53,36,40,47,22,26,45,1,65,28,51,4,15,80,107,62,25,54,37,47,31,60,135,
+98,51,0,0,2,0,130,255,236,5,250,3,212,0,23,0,44,0,0,37,20,6,35,34,38,39,38,
+38,39,39,38,38,53,52,54,51,50,4,23,23,30,2,3,20,6,7,6,4,4,7,6,35,34,38,53,
+52,55,54,36,36,51,50,22,5,250,56,39,21,60,49,123,221,165,164,35,32,52,32,
+53,1,45,84,83,114,186,60,34,33,31,142,254,68,254,124,157,64,21,36,50,53,105,
+1,217,2,25,113,35,50,62,34,48,29,27,66,99,61,61,13,46,23,38,54,110,38,35,
+48,95,64,3,15,28,51,4,15,80,107,62,25,54,37,47,31,60,135,98,51,0,0,2,0,130,
+255,226,7,29,3,212,0,33,0,61,0,0,1,38,33,34,4,7,6,35,34,38,53,52,54,55,54,
+36,51,32,4,22,21,20,6,7,6,7,6,35,34,38,53,52,55,54,1,20,6,35,34,39,38,38,
+36,35,34,4,7,6,35,34,38,53,52,54,55,54,36,51,50,4,22,22,6,28,153,254,74,161,
+254,108,94,75,25,35,49,27,30,141,1,193,196,1,14,1,131,187,25,23,223,129,22,
+49,38,55,31,93,1,188,48,36,33,30,78,173,254,193,131,175,254,115,87,75,25,
+35,49,27,30,131,1,198,201,200,1,98,223,71,1,131,44,61,34,25,55,38,20,47,12,
+57,71,41,76,66,39,41,17,160,171,30,55,33,40,36,113,2,66,37,57,9,21,21,18,
+49,31,25,55,38,20,47,12,54,59,23,40,48,0,3,0,110,255,245,7,118,3,107,0,22,
+0,46,0,64,0,0,1,20,6,35,39,38,35,34,7,7,34,38,53,52,54,54,36,51,50,30,3,1,
+20,6,35,39,36,35,34,7,5,34,38,53,52,54,54,36,36,51,50,4,4,22,22,17,20,6,35,
+34,38,35,34,6,35,34,38,53,52,54,51,50,22,4,186,48,36,64,248,153,164,240,63,
+36,48,43,109,1,10,133,82,179,166,89,33,2,188,48,36,51,254,41,143,139,251,
+254,235,36,48,28,54,1,11,1,88,58,64,1,65,1,33,49,26,48,36,30,102,58,69,93,
+30,36,48,111,165,163,111,2,254,36,53,3,15,15,3,53,36,34,46,16,13,6,12,14,
+48,254,136,36,53,2,23,12,13,53,36,26,44,20,17,9,9,18,18,45,254,145,36,53,
+11,11,53,36,49,53,53,0,0,1,0,80,255,206,7,236,3,107,0,59,0,0,1,20,6,35,39,
+38,36,35,7,30,2,51,50,55,55,54,36,51,50,22,21,20,7,6,6,7,7,4,5,23,22,21,20,
+6,35,34,36,39,6,35,34,38,2,39,6,7,7,34,38,53,52,62,3,51,50,22,22,4,165,42,
+34,32,27,254,142,23,130,5,75,131,85,150,133,104,143,1,106,192,63,54,120,173,
+243,112,97,1,2,1,125,38,68,59,46,150,254,74,184,150,178,137,216,121,3,120,
+39,37,26,44,21,32,225,242,61,132,237,159,2,255,35,61,4,3,17,3,171,238,123,
+180,139,193,203,46,29,96,9,15,138,146,125,87,60,5,9,69,42,49,100,71,141,169,
+1,63,215,10,7,3,51,38,23,43,18,27,12,16,29,0,0,3,0,130,255,236,8,51,3,212,
+0,20,0,42,0,64,0,0,1,50,21,20,6,7,4,5,6,5,6,35,34,38,53,52,55,54,44,2,5,20,
+6,35,39,38,35,34,4,7,6,35,34,38,53,52,54,36,51,50,22,22,1,20,6,35,34,39,38,
+37,46,2,53,52,54,51,50,30,5,7,228,70,39,67,254,241,254,219,141,254,200,60,
+51,34,38,31,61,1,118,1,111,1,54,253,53,39,32,33,122,165,140,254,242,125,48,
+33,30,45,182,1,89,164,181,136,74,3,119,58,35,48,24,166,254,252,101,72,28,
+51,33,22,106,138,169,119,118,36,3,212,69,44,41,16,68,156,76,205,42,51,36,
+32,31,58,235,176,98,88,48,60,3,13,72,77,31,41,45,49,129,96,17,36,252,171,
+36,58,16,111,90,35,31,49,23,38,56,32,53,76,57,70,41,0,0,2,0,140,255,226,5,
+214,3,212,0,37,0,46,0,0,1,38,38,53,52,62,2,51,32,4,21,20,6,7,4,7,22,5,22,
+22,21,20,6,35,34,36,39,4,7,6,35,34,38,53,52,54,36,1,38,38,35,34,7,22,23,36,
+2,63,212,223,69,183,251,159,1,48,1,132,31,46,254,252,255,153,1,35,32,31,52,
+34,38,254,163,199,254,249,163,45,30,34,52,44,1,7,3,26,97,247,105,230,199,
+184,180,1,23,1,132,136,207,58,36,67,58,30,100,91,41,56,23,132,150,87,127,
+14,48,22,36,56,170,120,162,123,32,56,36,24,49,180,1,183,22,24,46,154,115,
+164,0,1,0,110,255,236,8,20,3,107,0,59,0,0,5,34,38,2,39,7,34,38,53,52,55,54,
+33,32,23,22,21,20,6,35,34,38,35,30,2,51,50,55,55,54,54,51,50,22,22,21,20,
+6,6,35,34,38,53,52,51,50,54,54,53,52,38,38,35,34,6,7,7,6,6,3,27,138,216,122,
+1,124,36,48,71,55,1,14,1,12,55,71,48,36,30,152,131,3,76,130,87,150,133,104,
+109,208,123,123,203,116,91,201,192,72,49,125,118,117,51,67,118,67,75,128,
+67,107,120,214,20,170,1,67,217,8,53,36,58,27,19,19,27,58,36,53,13,171,239,
+125,180,139,147,119,121,211,123,119,132,59,45,52,83,22,51,57,70,128,77,82,
+87,138,154,124,0,1,0,110,255,226,7,65,4,16,0,40,0,0,37,20,6,35,34,39,37,38,
+53,52,55,54,37,38,36,39,38,39,38,53,52,54,51,50,4,23,23,36,51,50,22,21,20,
+6,7,6,4,4,7,5,22,4,64,55,38,25,23,254,29,89,63,161,1,52,181,254,199,213,37,
+10,43,71,64,201,1,168,240,11,1,101,232,85,62,80,85,190,254,77,254,124,82,
+1,148,87,63,36,57,10,181,35,78,36,69,184,165,76,63,12,3,5,19,54,39,41,96,
+109,5,150,34,34,48,48,9,21,155,235,102,140,40,0,0,2,0,110,255,245,8,4,3,107,
+0,17,0,43,0,0,37,20,6,35,34,38,35,34,6,35,34,38,53,52,54,51,50,22,1,32,4,
+23,22,21,20,6,35,34,39,39,36,33,34,4,7,6,35,34,38,53,52,55,54,36,5,74,48,
+36,30,102,58,69,93,30,36,48,111,165,163,111,254,237,1,48,2,0,126,31,47,34,
+14,42,16,254,198,254,6,241,254,120,211,31,15,35,44,38,185,2,4,78,36,53,11,
+11,53,36,49,53,53,2,236,79,71,17,52,40,56,18,6,111,79,80,12,55,37,51,18,89,
+101,0,0,1,0,110,255,226,8,4,3,107,0,38,0,0,1,32,4,23,22,21,20,6,35,34,39,
+39,36,33,34,7,22,0,21,20,6,35,34,39,46,2,39,6,7,6,35,34,38,53,52,55,54,36,
+4,55,1,48,2,0,126,31,47,34,14,42,16,254,198,254,6,158,149,179,1,37,58,36,
+56,32,86,120,127,183,134,177,31,15,35,44,38,185,2,4,3,107,79,71,17,52,40,
+56,18,6,111,18,192,254,128,52,36,43,46,125,157,142,194,32,66,12,55,37,51,
+18,89,101,0,1,0,110,255,236,8,34,3,107,0,52,0,0,1,34,6,7,7,6,6,35,34,38,2,
+39,7,34,38,53,52,55,54,33,32,23,22,21,20,6,35,34,38,35,30,2,51,50,55,55,54,
+54,51,50,22,18,21,20,6,35,34,38,39,46,2,6,86,75,128,67,107,120,214,116,138,
+216,122,1,124,36,48,71,55,1,14,1,12,55,71,48,36,30,152,131,3,76,130,87,150,
+133,104,109,208,123,133,200,123,48,39,41,48,10,16,74,110,2,53,82,87,138,154,
+124,170,1,67,217,8,53,36,58,27,19,19,27,58,36,53,13,171,239,125,180,139,147,
+119,135,254,242,101,35,46,50,51,73,155,78,0,2,0,110,255,236,8,34,3,107,0,
+40,0,60,0,0,37,20,6,35,34,38,39,46,2,35,34,6,7,7,6,6,35,34,38,2,53,52,54,
+51,50,22,23,30,2,51,50,55,55,54,54,51,50,22,18,1,34,7,7,34,38,53,52,55,54,
+33,32,23,22,21,20,6,35,34,38,8,34,48,39,41,48,10,16,74,110,74,75,128,67,107,
+120,214,116,132,204,123,48,39,40,48,12,15,70,115,76,150,133,104,109,208,123,
+133,200,123,249,216,144,129,39,36,48,71,55,1,14,1,12,55,71,48,36,30,147,239,
+35,46,50,51,73,155,78,82,87,138,154,124,142,1,17,103,35,46,49,51,73,159,87,
+180,139,147,119,135,254,242,1,99,11,2,53,36,58,27,19,19,27,58,36,53,13,0,
+0,1,0,110,255,236,5,159,3,212,0,34,0,0,1,50,22,21,20,6,7,6,4,4,7,22,12,2,
+23,22,22,21,20,6,35,34,38,36,36,39,38,53,52,55,54,44,2,5,74,35,50,27,28,142,
+254,190,254,91,78,57,1,38,1,65,1,12,23,28,27,52,33,33,252,254,122,254,33,
+40,50,45,31,1,25,1,112,1,215,3,212,54,37,26,46,7,36,93,152,49,32,115,100,
+77,5,6,47,26,38,54,67,125,198,31,38,48,40,32,23,121,139,138,0,1,0,110,0,183,
+7,5,3,107,0,35,0,0,1,22,23,22,21,20,6,35,34,39,38,39,38,38,53,52,54,54,36,
+51,32,4,23,22,22,21,20,6,35,34,39,38,36,35,34,4,1,107,203,99,31,56,37,48,
+23,137,237,23,25,103,243,1,108,134,1,16,1,144,114,30,27,48,36,25,75,80,254,
+89,156,135,254,148,2,109,155,119,36,40,34,54,30,183,169,17,41,39,50,66,58,
+39,51,47,12,47,20,38,55,25,27,38,47,0,0,2,0,110,255,245,8,4,3,107,0,25,0,
+43,0,0,1,32,4,23,22,21,20,6,35,34,39,36,33,34,6,4,7,6,35,34,38,53,52,55,54,
+36,3,20,6,35,34,38,35,34,6,35,34,38,53,52,54,51,50,22,4,55,1,3,2,14,157,31,
+47,34,14,42,254,139,254,49,181,236,254,255,170,31,15,35,44,38,194,1,190,99,
+48,36,30,102,58,69,93,30,36,48,111,165,163,111,3,107,105,91,19,44,40,56,18,
+157,28,70,65,12,55,37,51,18,95,99,252,227,36,53,11,11,53,36,49,53,53,0,0,
+2,0,110,255,231,6,233,3,107,0,29,0,48,0,0,1,30,2,21,20,6,35,34,39,38,38,39,
+38,38,53,52,54,55,54,36,36,33,50,21,20,6,7,4,4,1,20,6,35,34,38,39,38,39,38,
+38,53,52,54,51,50,30,2,1,89,69,251,125,55,38,32,16,96,192,155,42,54,38,25,
+157,1,195,2,55,1,18,147,74,64,254,79,253,154,2,221,53,34,17,53,64,77,85,73,
+47,50,38,39,124,170,82,1,54,15,100,91,36,36,57,10,53,86,53,14,64,39,16,62,
+23,141,214,125,96,47,33,2,18,191,254,246,31,53,28,45,52,36,31,41,36,39,47,
+53,100,77,0,0,2,0,130,255,236,7,180,3,106,0,46,0,59,0,0,1,20,7,6,6,35,34,
+39,38,38,35,34,6,7,14,2,35,34,38,38,53,52,54,54,51,50,22,23,54,54,51,50,22,
+23,22,22,51,50,54,54,55,54,54,51,50,22,1,50,54,54,55,38,38,35,34,6,21,20,
+22,7,180,12,38,188,118,171,102,64,64,40,40,79,53,86,130,155,90,112,190,110,
+116,205,131,121,195,60,45,107,69,77,124,53,59,76,44,46,74,44,12,12,45,40,
+39,48,250,132,42,78,76,64,27,143,90,108,131,132,2,92,54,42,137,170,172,106,
+65,83,95,156,152,78,118,207,122,127,206,114,143,131,54,70,85,86,98,74,62,
+98,43,52,49,46,254,33,48,92,107,130,157,150,118,117,149,0,0,2,0,110,255,226,
+6,145,3,212,0,21,0,43,0,0,1,20,6,35,34,39,38,0,39,39,46,2,53,52,54,51,22,
+4,0,23,22,1,52,54,55,54,36,51,50,22,21,20,7,6,7,14,2,7,6,35,34,38,6,145,50,
+37,30,56,129,253,55,248,79,68,34,17,58,47,117,2,5,2,72,103,35,249,221,40,
+19,110,1,217,62,32,52,63,48,88,103,186,104,32,24,47,36,57,1,139,41,52,31,
+69,1,51,65,20,17,24,36,20,42,47,11,178,255,0,71,25,254,135,31,36,12,71,199,
+54,38,59,27,21,29,35,84,57,21,16,57,0,0,3,0,140,255,236,7,96,3,212,0,11,0,
+25,0,37,0,0,1,52,54,51,50,22,21,20,6,35,34,38,37,20,0,33,32,0,53,52,54,36,
+33,32,4,22,7,52,36,33,32,4,21,20,4,33,32,36,3,107,81,58,58,81,81,58,58,81,
+3,245,254,47,254,103,254,98,254,52,205,1,147,1,10,1,15,1,144,203,194,254,
+147,254,197,254,196,254,148,1,105,1,63,1,56,1,112,1,239,58,81,81,58,58,81,
+81,43,237,254,249,1,5,239,151,224,125,124,222,154,151,169,167,153,155,165,
+166,0,3,0,110,255,245,6,223,4,56,0,26,0,48,0,66,0,0,1,34,4,7,6,35,34,38,53,
+52,54,54,36,51,50,4,23,22,22,21,20,6,35,34,39,38,36,3,34,7,7,34,38,53,52,
+62,2,51,50,22,23,22,21,20,6,35,39,38,19,20,6,35,34,38,35,34,6,35,34,38,53,
+52,54,51,50,22,3,165,179,254,142,90,75,25,35,49,138,226,1,62,141,235,1,170,
+94,35,36,48,36,30,56,110,254,126,163,140,175,47,36,48,30,60,226,130,117,228,
+28,71,48,36,48,184,148,48,36,30,102,58,69,93,30,36,48,111,165,163,111,3,132,
+49,31,25,55,38,52,66,48,26,58,48,19,37,29,37,57,20,38,47,254,63,19,4,53,36,
+27,40,27,20,19,10,27,58,36,53,4,19,254,139,36,53,11,11,53,36,49,53,53,0,0,
+3,0,110,255,236,6,223,4,47,0,26,0,48,0,66,0,0,37,50,36,55,54,51,50,22,21,
+20,6,7,6,4,35,34,36,38,38,53,52,54,51,50,23,22,4,19,50,55,55,50,22,21,20,
+7,6,6,35,34,46,2,53,52,54,51,23,22,1,20,6,35,34,38,53,52,54,51,50,22,51,50,
+54,51,50,22,3,165,160,1,130,110,56,30,36,48,36,35,94,254,86,235,141,254,194,
+226,138,49,35,25,75,90,1,114,176,128,184,48,36,48,71,28,228,117,130,226,60,
+30,48,36,47,175,1,160,111,163,165,111,48,36,30,93,69,58,102,30,36,48,160,
+47,38,20,57,37,29,37,19,48,58,26,48,66,52,38,55,25,31,49,1,193,19,4,53,36,
+58,27,10,19,20,27,40,27,36,53,4,19,1,117,49,53,53,49,36,53,11,11,53,0,0,2,
+251,130,4,106,253,168,6,37,0,17,0,35,0,0,1,20,35,34,38,35,34,6,35,34,53,52,
+54,54,51,50,22,22,53,20,35,34,38,35,34,6,35,34,53,52,54,54,51,50,22,22,253,
+168,84,30,102,58,69,93,30,84,72,113,91,80,120,74,84,30,102,58,69,93,30,84,
+72,113,91,80,120,74,4,172,66,11,11,66,36,40,16,15,41,249,66,11,11,66,36,40,
+16,15,41,0,0,1,0,30,0,0,2,40,3,21,0,22,0,0,1,38,38,39,38,53,52,54,51,50,22,
+22,21,20,6,6,35,34,38,53,52,55,54,1,99,42,151,92,40,48,35,40,225,174,170,
+231,38,35,48,40,188,1,135,51,129,59,27,49,39,44,168,186,41,39,184,171,44,
+39,49,27,119,0,0,1,254,61,4,106,0,0,6,227,0,27,0,0,3,38,38,39,38,53,52,54,
+51,50,22,22,21,20,6,7,6,7,6,35,34,38,53,52,55,55,54,54,177,43,118,63,50,44,
+32,39,203,133,27,20,168,105,24,31,32,44,33,17,34,132,5,171,49,77,38,30,40,
+37,41,136,134,42,23,45,14,114,103,22,41,37,22,33,18,36,103,0,0,1,251,90,4,
+106,253,168,5,8,0,20,0,0,1,20,35,39,38,35,34,6,35,34,53,52,62,2,51,50,30,
+3,253,168,84,91,63,56,69,113,30,84,20,63,121,92,48,88,82,57,19,4,172,66,6,
+5,11,66,22,27,29,14,5,11,28,26,0,2,0,30,0,0,3,121,3,40,0,14,0,26,0,0,1,20,
+6,6,35,34,38,38,53,52,54,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,3,
+121,117,205,124,119,190,104,115,203,123,183,235,182,139,104,105,149,136,102,
+113,146,1,163,115,195,109,100,181,107,116,194,110,218,177,98,127,143,102,
+96,127,141,0,0,2,0,30,0,208,2,98,2,189,0,19,0,39,0,0,1,20,35,39,38,35,34,
+6,35,34,53,52,54,54,51,50,30,3,17,20,35,39,38,35,34,6,35,34,53,52,54,54,51,
+50,30,3,2,98,84,91,63,56,69,103,30,84,74,120,92,48,88,82,57,19,84,91,63,56,
+69,103,30,84,74,120,92,48,88,82,57,19,1,18,66,6,5,11,66,36,41,15,5,11,28,
+26,1,57,66,6,5,11,66,36,41,15,5,11,28,26,0,1,0,50,0,1,3,223,3,89,0,43,0,0,
+1,20,7,6,7,22,22,21,20,6,35,34,46,2,39,6,6,35,34,38,53,52,54,55,54,55,36,
+39,38,53,52,54,51,50,22,23,54,55,55,54,55,50,22,3,201,13,68,207,157,153,48,
+30,22,59,84,116,78,148,232,44,29,45,23,45,134,169,254,235,50,50,50,32,42,
+237,148,144,106,34,13,35,32,44,3,8,22,19,104,207,139,162,40,35,37,42,77,107,
+65,137,164,46,33,26,29,31,89,149,213,29,29,39,34,47,152,118,139,132,40,18,
+3,47,0,2,251,239,4,106,0,0,6,227,0,20,0,48,0,0,1,20,35,39,38,35,34,6,35,34,
+53,52,62,2,51,50,30,3,5,38,38,39,38,53,52,54,51,50,22,22,21,20,6,7,6,7,6,
+35,34,38,53,52,55,55,54,54,254,61,84,91,63,56,69,113,30,84,20,63,121,92,48,
+88,82,57,19,1,18,43,118,63,50,44,32,39,203,133,27,20,168,105,24,31,32,44,
+33,17,34,132,5,187,66,6,5,11,66,22,27,29,14,5,11,28,26,38,49,77,38,30,40,
+37,41,136,134,42,23,45,14,114,103,22,41,37,22,33,18,36,103,0,0,1,0,30,254,
+121,2,40,1,142,0,22,0,0,33,38,38,39,38,53,52,54,51,50,22,22,21,20,6,6,35,
+34,38,53,52,55,54,1,99,42,151,92,40,48,35,40,225,174,170,231,38,35,48,40,
+188,51,129,59,27,49,39,44,168,186,41,39,184,171,44,39,49,27,119,0,0,1,252,
+174,4,106,255,49,5,227,0,18,0,0,1,52,62,2,51,50,22,21,20,7,14,2,7,6,35,34,
+38,252,174,100,210,212,46,31,44,56,57,167,194,32,22,42,32,41,4,181,34,77,
+107,84,35,32,64,14,14,70,112,22,14,42,0,1,255,26,4,106,1,104,5,8,0,20,0,0,
+1,20,35,39,38,35,34,6,35,34,53,52,62,2,51,50,30,3,1,104,84,91,63,56,69,113,
+30,84,20,63,121,92,48,88,82,57,19,4,172,66,6,5,11,66,22,27,29,14,5,11,28,
+26,0,2,255,26,4,106,1,64,6,37,0,17,0,35,0,0,1,20,35,34,38,35,34,6,35,34,53,
+52,54,54,51,50,22,22,53,20,35,34,38,35,34,6,35,34,53,52,54,54,51,50,22,22,
+1,64,84,30,102,58,69,93,30,84,72,113,91,80,120,74,84,30,102,58,69,93,30,84,
+72,113,91,80,120,74,4,172,66,11,11,66,36,40,16,15,41,249,66,11,11,66,36,40,
+16,15,41,0,0,1,0,30,0,0,4,1,3,16,0,18,0,0,37,20,6,35,34,39,38,0,39,38,38,
+53,52,54,51,50,4,0,22,4,1,47,35,26,18,145,254,62,208,39,27,44,33,51,1,28,
+1,149,178,90,37,53,16,155,1,80,115,21,30,31,31,49,167,254,204,179,0,1,0,30,
+1,72,3,42,2,4,0,19,0,0,1,20,6,35,39,38,35,34,7,7,34,38,53,52,54,54,51,50,
+22,22,3,42,48,36,39,123,143,154,115,38,36,48,65,216,110,138,197,54,1,161,
+36,53,3,15,15,3,53,36,38,40,21,24,38,0,0,5,0,220,255,206,7,180,6,64,0,104,
+0,112,0,120,0,126,0,133,0,0,1,54,51,50,22,22,23,55,54,54,53,52,38,39,38,38,
+53,52,54,51,50,22,22,21,20,6,7,7,22,22,21,20,6,7,30,2,21,20,6,6,35,34,38,
+53,52,54,55,54,53,52,38,39,39,6,6,35,34,39,7,6,6,21,20,23,22,22,21,20,6,35,
+34,38,38,53,52,54,55,38,38,53,52,54,54,55,39,38,38,53,52,54,54,51,50,22,21,
+20,6,7,6,6,21,20,22,23,5,34,6,7,5,37,38,38,3,50,54,55,37,5,22,22,1,52,39,
+5,5,54,37,20,23,37,37,6,6,2,124,205,239,88,151,132,87,147,54,63,70,58,81,
+35,51,41,79,162,81,112,132,17,147,114,114,136,66,127,57,83,160,79,41,51,33,
+30,181,63,54,149,116,215,125,240,202,131,54,63,181,30,33,51,41,79,161,82,
+107,133,127,113,55,100,115,26,134,110,81,162,79,41,51,35,81,58,70,63,54,2,
+61,67,137,96,1,60,1,45,99,146,72,68,148,99,254,213,254,198,91,141,3,20,255,
+254,234,1,34,243,250,124,232,1,45,254,244,124,141,4,100,199,45,80,83,81,29,
+59,43,30,56,21,29,28,34,30,45,82,127,79,82,129,72,10,60,116,73,71,119,55,
+33,96,97,60,81,127,81,45,30,33,28,11,58,69,43,59,29,82,113,93,196,72,29,59,
+43,69,58,11,28,33,30,45,82,127,80,83,123,75,53,119,69,52,84,69,48,15,74,126,
+83,80,126,82,45,30,33,29,29,21,55,31,43,59,29,33,50,68,174,166,71,55,252,
+252,54,70,165,173,64,52,1,123,76,83,154,160,79,67,75,77,166,148,37,86,0,5,
+0,230,255,124,7,246,6,140,0,39,0,52,0,65,0,78,0,91,0,0,1,34,39,22,21,20,2,
+7,38,2,53,52,55,6,35,34,36,39,54,36,51,50,23,38,53,52,18,55,22,18,21,20,7,
+54,51,50,4,23,6,4,1,55,54,54,53,52,38,39,6,6,21,20,22,5,34,6,7,7,22,22,51,
+50,54,55,38,38,1,50,54,55,38,39,38,35,34,6,7,22,22,37,6,6,21,20,22,23,54,
+54,53,52,39,38,5,248,54,48,15,162,145,148,158,11,49,50,150,254,245,93,93,
+1,14,147,49,51,12,158,148,144,163,16,50,53,146,1,15,93,93,254,246,253,227,
+35,58,50,85,62,62,84,87,1,200,69,121,69,35,60,164,70,91,171,45,46,173,252,
+142,65,160,67,42,23,109,118,88,173,46,45,171,1,234,67,81,84,62,61,86,83,25,
+1,210,12,51,49,147,254,242,93,93,1,10,151,50,49,11,158,148,145,162,15,48,
+54,150,1,11,93,92,254,241,147,53,50,16,163,144,148,158,1,153,35,69,121,69,
+88,173,46,45,171,91,70,165,15,50,58,35,63,87,84,62,61,86,254,219,81,67,37,
+25,83,85,62,62,84,41,67,159,66,91,171,45,46,173,88,118,109,23,0,0,3,0,250,
+255,226,5,213,6,64,0,39,0,79,0,119,0,0,1,20,14,2,35,34,38,53,52,62,4,53,52,
+39,39,38,53,52,62,2,51,50,22,21,20,14,4,21,20,23,23,22,5,20,14,2,35,34,38,
+53,52,62,4,53,52,39,39,38,53,52,62,2,51,50,22,21,20,14,4,21,20,23,23,22,5,
+20,14,2,35,34,38,53,52,62,4,53,52,39,39,38,53,52,62,2,51,50,22,21,20,14,4,
+21,20,23,23,22,2,151,52,93,116,47,35,47,29,44,50,44,29,59,85,75,52,93,116,
+47,35,47,29,44,50,44,29,59,85,75,1,174,52,93,116,47,35,47,29,44,50,44,29,
+59,85,75,52,93,116,47,35,47,29,44,50,44,29,59,85,75,1,144,52,93,116,47,35,
+47,29,44,50,44,29,59,85,75,52,93,116,47,35,47,29,44,50,44,29,59,85,75,1,144,
+81,154,120,75,47,39,18,31,35,45,65,90,63,122,131,189,165,160,81,154,120,75,
+47,39,18,31,35,45,65,90,63,122,131,189,165,160,81,154,120,75,47,39,18,31,
+35,45,65,90,63,122,131,189,165,160,81,154,120,75,47,39,18,31,35,45,65,90,
+63,122,131,189,165,160,81,154,120,75,47,39,18,31,35,45,65,90,63,122,131,189,
+165,160,81,154,120,75,47,39,18,31,35,45,65,90,63,122,131,189,165,0,0,1,1,
+14,255,226,4,55,6,64,0,28,0,0,1,52,54,51,50,4,22,18,21,20,2,6,4,35,34,38,
+53,52,55,55,54,18,17,52,2,38,39,38,38,1,14,48,40,129,1,30,203,103,108,207,
+254,227,121,40,48,76,76,231,246,120,220,201,33,55,5,229,38,53,129,219,254,
+222,179,174,254,214,220,121,55,39,59,21,15,43,1,63,1,6,179,1,17,158,31,5,
+41,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,30,0,94,0,
+3,0,1,4,9,0,2,0,14,0,124,0,3,0,1,4,9,0,3,0,68,0,138,0,3,0,1,4,9,0,4,0,30,
+0,94,0,3,0,1,4,9,0,5,0,30,0,206,0,3,0,1,4,9,0,6,0,26,0,236,0,3,0,1,4,9,0,
+7,0,68,1,6,0,3,0,1,4,9,0,8,0,42,1,74,0,3,0,1,4,9,0,9,0,40,1,116,0,3,0,1,4,
+9,0,10,0,96,1,156,0,3,0,1,4,9,0,11,0,62,1,252,0,3,0,1,4,9,0,12,0,60,2,58,
+0,3,0,1,4,9,0,13,2,150,2,118,0,3,0,1,4,9,0,14,0,52,5,12,0,67,0,111,0,112,
+0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,
+111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,
+0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,
+0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,
+0,32,0,66,0,97,0,116,0,97,0,107,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,
+105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,
+0,115,0,32,0,66,0,97,0,116,0,97,0,107,0,86,0,101,0,114,0,115,0,105,0,111,
+0,110,0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,
+83,0,97,0,110,0,115,0,66,0,97,0,116,0,97,0,107,0,78,0,111,0,116,0,111,0,32,
+0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,
+0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,
+39,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,0,0,1,2,0,2,0,3,1,3,
+1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,
+1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,
+1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,4,110,117,108,108,7,117,
+110,105,49,66,67,48,7,117,110,105,49,66,67,49,7,117,110,105,49,66,67,50,7,
+117,110,105,49,66,67,51,7,117,110,105,49,66,67,52,7,117,110,105,49,66,67,
+53,7,117,110,105,49,66,67,54,7,117,110,105,49,66,67,55,7,117,110,105,49,66,
+67,56,7,117,110,105,49,66,67,57,7,117,110,105,49,66,67,65,7,117,110,105,49,
+66,67,66,7,117,110,105,49,66,67,67,7,117,110,105,49,66,67,68,7,117,110,105,
+49,66,67,69,7,117,110,105,49,66,67,70,7,117,110,105,49,66,68,48,7,117,110,
+105,49,66,68,49,7,117,110,105,49,66,68,50,7,117,110,105,49,66,68,51,7,117,
+110,105,49,66,68,52,7,117,110,105,49,66,68,53,7,117,110,105,49,66,68,54,7,
+117,110,105,49,66,68,55,7,117,110,105,49,66,68,56,7,117,110,105,49,66,68,
+57,7,117,110,105,49,66,68,65,7,117,110,105,49,66,68,66,7,117,110,105,49,66,
+68,67,7,117,110,105,49,66,68,68,7,117,110,105,49,66,68,69,7,117,110,105,49,
+66,68,70,7,117,110,105,49,66,69,48,7,117,110,105,49,66,69,49,7,117,110,105,
+49,66,69,50,7,117,110,105,49,66,69,51,7,117,110,105,49,66,69,52,7,117,110,
+105,49,66,69,53,7,117,110,105,49,66,69,54,7,117,110,105,49,66,69,55,7,117,
+110,105,49,66,69,56,7,117,110,105,49,66,69,57,7,117,110,105,49,66,69,65,7,
+117,110,105,49,66,69,66,7,117,110,105,49,66,69,67,7,117,110,105,49,66,69,
+68,7,117,110,105,49,66,69,69,7,117,110,105,49,66,69,70,7,117,110,105,49,66,
+70,48,7,117,110,105,49,66,70,49,7,117,110,105,49,66,70,50,7,117,110,105,49,
+66,70,51,7,117,110,105,49,66,70,67,7,117,110,105,49,66,70,68,7,117,110,105,
+49,66,70,69,7,117,110,105,49,66,70,70,10,98,97,116,97,107,95,110,117,108,
+108,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,58,0,0,0,2,0,7,0,0,0,41,
+0,1,0,42,0,42,0,3,0,43,0,43,0,1,0,44,0,45,0,3,0,46,0,48,0,1,0,49,0,53,0,3,
+0,54,0,60,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,32,0,60,0,1,68,70,76,84,
+0,8,0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,109,97,114,107,0,14,109,107,109,107,
+0,22,0,0,0,2,0,0,0,1,0,0,0,1,0,2,0,3,0,8,2,88,2,154,0,4,0,0,0,1,0,8,0,1,0,
+12,0,32,0,2,0,42,0,118,0,1,0,8,0,42,0,44,0,45,0,49,0,50,0,51,0,52,0,53,0,
+2,0,1,0,4,0,41,0,0,0,8,0,0,0,34,0,0,0,40,0,0,0,46,0,0,0,52,0,1,0,58,0,0,0,
+64,0,0,0,70,0,0,0,70,0,1,255,16,3,232,0,1,252,64,4,76,0,1,254,252,3,232,0,
+1,253,188,4,76,0,1,0,0,0,120,0,1,254,52,3,232,0,1,253,128,3,232,0,38,1,144,
+0,154,1,144,0,160,0,166,0,172,1,144,0,178,0,184,0,190,1,144,0,196,0,202,1,
+204,0,208,0,214,1,168,0,220,0,226,0,232,0,238,0,244,1,132,0,250,1,156,1,0,
+1,6,1,12,1,18,1,24,1,156,1,30,1,168,1,36,1,168,1,36,1,168,1,42,1,144,1,48,
+1,144,1,54,1,60,1,66,1,72,1,78,1,84,1,90,1,132,1,96,1,144,1,102,1,144,1,108,
+1,144,1,114,1,144,1,114,1,120,1,126,1,132,1,138,1,144,1,204,1,168,1,150,1,
+156,1,162,1,168,1,174,1,180,1,186,1,198,1,192,1,198,1,204,0,1,7,203,0,0,0,
+1,7,203,255,136,0,1,4,236,4,76,0,1,6,9,0,0,0,1,7,83,255,136,0,1,4,56,4,76,
+0,1,6,24,0,0,0,1,7,68,0,0,0,1,4,16,4,76,0,1,3,132,4,76,0,1,5,160,0,0,0,1,
+6,129,0,135,0,1,4,176,4,176,0,1,6,99,0,0,0,1,3,192,5,70,0,1,6,69,2,178,0,
+1,6,219,0,0,0,1,7,128,255,121,0,1,2,228,4,76,0,1,4,236,255,151,0,1,3,172,
+4,76,0,1,5,25,0,105,0,1,7,83,255,121,0,1,5,85,255,121,0,1,5,160,255,241,0,
+1,6,234,255,136,0,1,7,23,255,106,0,1,4,136,4,76,0,1,7,128,255,136,0,1,3,12,
+4,76,0,1,4,156,255,151,0,1,4,116,4,76,0,1,7,158,0,0,0,1,5,190,0,0,0,1,6,114,
+0,0,0,1,6,174,0,0,0,1,7,148,0,0,0,1,3,52,4,76,0,1,4,221,255,121,0,1,3,232,
+4,76,0,1,2,43,0,0,0,1,4,76,4,76,0,1,6,64,0,0,0,1,4,36,4,76,0,1,7,23,0,150,
+0,1,3,212,4,76,0,1,6,4,0,180,0,1,3,252,4,76,0,1,6,104,0,0,0,1,6,39,0,0,0,
+1,3,152,4,176,0,1,6,84,0,0,0,4,0,0,0,1,0,8,0,1,0,78,0,12,0,1,0,104,0,24,0,
+1,0,4,0,43,0,46,0,47,0,48,0,4,0,10,0,16,0,22,0,28,0,1,0,230,3,82,0,1,1,209,
+3,102,0,1,1,64,3,32,0,1,2,13,3,162,0,6,0,0,0,1,0,8,0,1,0,12,0,20,0,1,0,38,
+0,60,0,1,0,2,0,52,0,53,0,1,0,7,0,42,0,44,0,45,0,49,0,51,0,52,0,53,0,2,0,0,
+0,10,0,0,0,16,0,1,0,80,4,16,0,1,0,60,4,16,0,7,0,16,0,22,0,28,0,34,0,40,0,
+46,0,52,0,1,252,164,6,84,0,1,254,252,7,68,0,1,252,144,5,120,0,1,253,8,7,8,
+0,1,253,228,6,164,0,1,0,60,5,180,0,1,0,50,6,124,0,1,0,0,0,10,0,30,0,78,0,
+1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,0,8,0,0,0,
+18,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,
+0,16,0,17,0,36,0,74,0,104,0,134,0,164,0,194,0,224,0,254,1,28,1,58,1,88,1,
+118,1,148,1,178,1,208,1,238,2,12,2,42,2,72,2,108,2,130,2,152,2,174,2,196,
+2,218,2,240,3,6,3,28,3,56,3,76,3,96,3,116,3,136,3,156,3,176,3,196,3,216,0,
+6,0,0,0,1,0,8,0,3,0,3,2,20,2,244,2,20,0,1,2,218,0,0,0,1,0,0,0,18,0,6,0,0,
+0,1,0,8,0,3,0,3,1,246,2,234,1,246,0,1,2,188,0,0,0,1,0,0,0,19,0,6,0,0,0,1,
+0,8,0,3,0,3,1,216,2,224,1,216,0,1,2,158,0,0,0,1,0,0,0,20,0,6,0,0,0,1,0,8,
+0,3,0,3,1,186,2,214,1,186,0,1,2,128,0,0,0,1,0,0,0,21,0,6,0,0,0,1,0,8,0,3,
+0,3,1,156,2,204,1,156,0,1,2,98,0,0,0,1,0,0,0,22,0,6,0,0,0,1,0,8,0,3,0,3,1,
+126,2,194,1,126,0,1,2,68,0,0,0,1,0,0,0,23,0,6,0,0,0,1,0,8,0,3,0,3,1,96,2,
+224,1,96,0,1,2,38,0,0,0,1,0,0,0,24,0,6,0,0,0,1,0,8,0,3,0,3,1,66,2,174,1,66,
+0,1,2,8,0,0,0,1,0,0,0,25,0,6,0,0,0,1,0,8,0,3,0,3,1,36,2,124,1,36,0,1,1,234,
+0,0,0,1,0,0,0,26,0,6,0,0,0,1,0,8,0,3,0,0,0,1,1,230,0,3,1,6,1,230,1,204,0,
+1,0,0,0,27,0,6,0,0,0,1,0,8,0,3,0,0,0,1,1,220,0,3,0,232,1,220,1,174,0,1,0,
+0,0,28,0,6,0,0,0,1,0,8,0,3,0,0,0,1,1,210,0,3,0,202,1,210,1,144,0,1,0,0,0,
+29,0,6,0,0,0,1,0,8,0,3,0,0,0,1,1,200,0,3,0,172,1,200,1,114,0,1,0,0,0,30,0,
+6,0,0,0,1,0,8,0,3,0,0,0,1,1,190,0,3,0,142,1,190,1,84,0,1,0,0,0,31,0,6,0,0,
+0,1,0,8,0,3,0,0,0,1,1,180,0,3,0,112,1,180,1,54,0,1,0,0,0,32,0,6,0,0,0,1,0,
+8,0,3,0,0,0,1,1,170,0,3,0,82,1,170,1,24,0,1,0,0,0,33,0,6,0,0,0,1,0,8,0,3,
+0,0,0,1,1,160,0,3,0,52,1,160,0,250,0,1,0,0,0,34,0,6,0,0,0,1,0,8,0,3,0,0,0,
+1,1,150,0,3,0,22,1,150,0,220,0,1,0,0,0,35,0,1,0,1,0,4,0,2,0,0,0,1,0,8,0,1,
+0,184,0,1,0,8,0,2,0,43,0,54,0,2,0,0,0,1,0,8,0,1,0,162,0,1,0,8,0,2,0,44,0,
+54,0,2,0,0,0,1,0,8,0,1,0,140,0,1,0,8,0,2,0,45,0,54,0,2,0,0,0,1,0,8,0,1,0,
+118,0,1,0,8,0,2,0,46,0,54,0,2,0,0,0,1,0,8,0,1,0,96,0,1,0,8,0,2,0,47,0,54,
+0,2,0,0,0,1,0,8,0,1,0,74,0,1,0,8,0,2,0,48,0,54,0,2,0,0,0,1,0,8,0,1,0,52,0,
+1,0,8,0,2,0,49,0,54,0,2,0,0,0,1,0,8,0,1,0,30,0,1,0,8,0,2,0,51,0,54,0,2,0,
+0,0,1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,0,54,0,2,0,50,0,54,0,1,0,0,0,1,0,8,0,1,
+0,6,0,17,0,1,0,1,0,43,0,1,0,0,0,1,0,8,0,1,0,6,0,16,0,1,0,1,0,44,0,1,0,0,0,
+1,0,8,0,1,0,6,0,15,0,1,0,1,0,45,0,1,0,0,0,1,0,8,0,1,0,6,0,14,0,1,0,1,0,46,
+0,1,0,0,0,1,0,8,0,1,0,6,0,13,0,1,0,1,0,47,0,1,0,0,0,1,0,8,0,1,0,6,0,12,0,
+1,0,1,0,48,0,1,0,0,0,1,0,8,0,1,0,6,0,10,0,1,0,1,0,50,0,1,0,0,0,1,0,8,0,1,
+0,6,0,9,0,1,0,1,0,51,0,1,0,0,0,1,0,8,0,1,0,6,0,11,0,1,0,1,0,49,0,0,};
+#endif
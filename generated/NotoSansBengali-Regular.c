@@ -0,0 +1,4192 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansBengali_Regular_ttf_size = 102860;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansBengali_Regular_ttf");
+asm(".type fz_font_NotoSansBengali_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansBengali_Regular_ttf, 102860");
+asm(".balign 64");
+asm("fz_font_NotoSansBengali_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansBengali-Regular.ttf\"");
+#else
+const int fz_font_NotoSansBengali_Regular_ttf_size = 102860;
+const char fz_font_NotoSansBengali_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,209,200,203,190,0,1,80,8,0,0,7,116,
+71,80,79,83,6,114,248,105,0,1,87,124,0,0,22,78,71,83,85,66,116,157,100,12,
+0,1,109,204,0,0,35,254,79,83,47,50,120,206,105,227,0,0,1,104,0,0,0,96,99,
+109,97,112,238,31,224,71,0,0,10,204,0,0,1,68,103,97,115,112,0,7,0,7,0,1,79,
+252,0,0,0,12,103,108,121,102,78,69,230,179,0,0,16,148,0,1,57,62,104,101,97,
+100,4,51,1,173,0,0,0,236,0,0,0,54,104,104,101,97,13,244,7,154,0,0,1,36,0,
+0,0,36,104,109,116,120,236,81,142,37,0,0,1,200,0,0,9,4,108,111,99,97,4,126,
+82,255,0,0,12,16,0,0,4,132,109,97,120,112,2,91,1,3,0,0,1,72,0,0,0,32,110,
+97,109,101,140,240,185,38,0,1,73,212,0,0,6,6,112,111,115,116,255,105,0,102,
+0,1,79,220,0,0,0,32,0,1,0,0,0,1,7,174,64,193,149,180,95,15,60,245,0,11,8,
+0,0,0,0,0,204,79,228,239,0,0,0,0,210,40,203,226,250,103,252,218,12,52,7,86,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,86,252,188,0,0,12,31,250,103,252,125,12,
+52,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,65,0,1,0,0,2,65,0,136,0,10,0,121,0,12,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,5,163,1,144,0,5,0,0,5,153,5,51,0,
+0,0,191,5,153,5,51,0,0,2,130,0,102,2,129,0,0,2,11,5,2,4,5,4,2,2,4,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,86,252,188,0,0,7,86,
+3,68,0,0,0,1,0,0,0,0,4,250,4,250,0,0,0,32,0,4,4,205,0,193,0,0,0,0,2,20,0,
+0,2,20,0,0,0,0,253,135,3,170,0,169,3,170,0,181,7,36,255,235,9,67,255,235,
+4,61,255,235,5,131,255,235,5,179,255,235,6,211,255,235,6,210,0,100,5,28,0,
+114,6,17,0,94,6,252,0,94,5,231,0,58,6,254,0,58,6,117,255,235,5,145,0,100,
+5,64,0,46,5,13,255,235,5,201,0,59,4,138,255,235,5,126,255,235,7,85,255,235,
+6,90,255,235,8,39,0,94,4,138,255,235,4,186,255,235,5,179,255,235,4,138,255,
+235,4,210,0,92,5,167,255,235,5,40,0,78,4,211,255,235,4,197,0,75,4,212,255,
+235,5,187,0,45,6,180,255,235,4,197,255,235,5,196,255,235,4,249,255,235,5,
+2,255,235,4,197,255,235,5,218,255,235,5,106,255,238,5,16,255,235,5,117,255,
+235,4,61,255,235,0,0,252,239,4,61,255,235,2,33,255,235,2,33,255,235,2,33,
+251,214,0,0,252,161,0,0,253,140,0,0,253,43,0,0,253,43,2,196,255,235,2,196,
+255,190,7,160,255,235,7,160,255,235,0,0,254,133,4,96,0,100,2,33,253,22,5,
+179,255,235,4,138,255,235,5,2,255,235,6,210,0,100,5,28,0,114,0,0,253,41,0,
+0,251,154,4,188,0,147,4,188,0,249,4,188,0,134,4,188,0,59,4,188,0,128,4,188,
+0,100,4,188,0,43,4,188,0,144,4,188,0,45,4,188,0,55,4,197,255,235,4,197,255,
+235,4,183,0,145,5,22,0,15,4,183,0,145,5,167,0,123,5,209,0,99,2,96,0,225,5,
+115,0,94,3,222,0,120,5,105,0,156,2,84,0,116,6,117,255,235,5,145,0,100,5,64,
+0,46,5,13,255,235,5,201,0,59,4,138,255,235,5,126,255,235,7,85,255,235,6,90,
+255,235,8,39,0,94,4,138,255,235,4,186,255,235,4,210,0,92,5,167,255,235,5,
+40,0,78,4,211,255,235,4,197,0,75,4,212,255,235,5,187,0,45,6,180,255,235,5,
+196,255,235,4,249,255,235,5,218,255,235,5,106,255,238,5,16,255,235,5,117,
+255,235,4,61,255,235,4,197,255,235,4,197,255,235,7,154,255,236,7,203,255,
+235,0,0,253,249,0,0,250,103,0,0,252,78,5,117,255,235,5,145,0,100,3,244,0,
+46,5,13,255,235,5,0,255,235,3,246,255,235,5,126,255,235,7,85,255,235,6,90,
+255,235,8,39,0,94,3,246,255,235,4,186,255,235,4,235,255,235,3,246,255,235,
+3,61,0,92,5,167,255,235,5,40,0,78,4,60,255,235,4,197,0,75,2,244,255,235,4,
+111,0,45,6,180,255,235,4,21,255,235,5,196,255,235,4,144,255,236,5,2,255,235,
+4,76,255,235,4,112,255,238,4,10,255,235,5,114,255,236,4,61,255,235,4,197,
+255,235,4,197,255,235,7,154,255,236,7,203,255,235,6,117,255,235,5,145,0,100,
+5,64,0,46,5,13,255,235,5,201,0,59,4,138,255,235,5,126,255,235,7,85,255,235,
+6,90,255,235,8,39,0,94,4,138,255,235,4,186,255,235,4,235,255,235,3,246,255,
+235,4,210,0,92,5,167,255,235,5,40,0,78,4,211,255,235,4,197,0,75,4,212,255,
+235,5,187,0,45,6,180,255,235,4,197,255,235,5,196,255,235,4,249,255,235,5,
+2,255,235,5,218,255,235,5,106,255,238,5,16,255,235,5,117,255,235,4,61,255,
+235,4,197,255,235,4,197,255,235,2,11,255,192,7,113,255,236,5,145,0,94,5,209,
+0,94,5,133,255,235,5,201,0,59,5,153,255,235,5,103,255,235,6,15,255,235,7,
+85,255,235,6,226,255,235,8,39,0,94,5,103,255,235,5,209,255,235,5,179,255,
+235,5,103,255,235,4,253,0,94,5,185,255,236,5,107,0,94,5,195,255,235,5,77,
+0,94,5,77,255,235,6,11,0,92,7,50,255,235,5,77,255,235,5,165,255,235,5,174,
+255,236,5,128,255,235,5,77,255,235,5,209,255,235,5,106,255,238,5,142,255,
+235,5,194,255,236,5,25,255,235,5,77,255,235,5,77,255,234,5,179,255,235,5,
+153,255,235,5,93,255,235,5,113,255,235,5,128,255,235,7,154,255,236,7,203,
+255,235,5,214,255,235,5,145,0,100,5,64,0,46,5,13,255,235,5,201,0,59,4,138,
+255,235,5,126,255,235,7,208,255,235,6,90,255,235,8,39,0,94,4,138,255,235,
+4,186,255,235,5,179,255,235,4,138,255,235,4,210,0,92,4,255,255,235,5,40,0,
+78,4,239,255,235,7,209,0,75,4,229,255,235,5,187,0,45,6,180,255,235,7,209,
+255,235,5,196,255,235,4,232,255,236,5,2,255,235,7,209,255,235,5,203,255,235,
+5,106,255,238,5,16,255,235,5,194,255,236,7,116,255,235,4,197,255,235,4,197,
+255,235,5,179,255,235,4,179,255,235,5,2,255,235,7,154,255,236,7,203,255,235,
+6,39,255,235,5,199,255,235,5,199,255,235,7,113,255,236,7,113,255,236,7,113,
+255,236,5,222,255,235,7,72,255,235,6,78,255,235,7,72,255,235,7,154,255,236,
+8,208,255,236,5,104,0,46,8,12,0,46,6,141,0,46,5,64,0,46,7,74,0,46,5,64,0,
+46,4,239,255,234,4,239,255,234,5,117,255,235,6,81,255,235,8,107,255,235,5,
+206,255,235,9,106,255,235,7,157,255,235,12,31,255,235,6,229,255,235,7,222,
+255,235,8,78,255,235,4,82,255,235,7,222,255,235,7,222,255,235,10,150,255,
+235,9,122,255,234,11,27,255,235,6,193,0,91,5,244,0,93,6,234,0,58,7,202,0,
+94,5,57,255,235,6,32,255,235,9,207,255,235,9,47,255,235,7,34,255,235,9,110,
+255,235,6,200,0,92,5,210,0,92,5,232,0,58,6,200,0,92,4,210,0,92,4,210,0,92,
+6,220,0,92,6,200,0,92,5,232,0,58,5,200,255,236,6,31,0,81,4,255,255,235,7,
+63,255,235,5,49,255,235,5,200,255,236,8,216,255,235,8,165,255,235,6,168,255,
+235,6,179,255,235,4,239,255,235,6,60,255,235,6,60,255,235,5,206,255,235,5,
+160,255,235,6,191,255,235,4,147,0,75,6,157,0,75,5,231,255,236,4,236,255,236,
+4,236,255,236,5,234,255,234,6,115,255,235,6,115,255,235,7,43,255,235,6,50,
+255,235,4,212,255,235,6,106,255,235,7,25,255,235,5,231,255,236,5,123,255,
+236,6,200,255,235,6,201,255,236,7,44,255,235,7,72,255,235,6,139,255,235,8,
+11,0,45,5,217,0,45,5,187,0,45,6,6,0,65,7,197,0,45,5,187,0,45,8,133,255,235,
+6,188,255,235,6,153,255,235,7,218,255,235,7,1,255,235,5,187,255,235,5,156,
+255,235,4,210,255,235,7,1,255,235,5,62,255,235,5,201,255,235,7,231,255,236,
+4,232,255,235,9,46,255,236,8,185,255,236,5,247,255,235,7,8,255,236,5,5,255,
+235,8,179,255,236,9,46,255,236,5,77,255,235,5,160,255,235,7,51,255,235,5,
+252,255,234,8,8,255,235,7,119,255,235,5,173,255,235,8,42,255,235,7,25,255,
+235,5,252,255,234,9,12,255,234,7,169,255,235,5,218,255,235,8,8,255,235,7,
+119,255,235,7,212,255,238,8,204,255,238,5,141,255,238,5,106,255,238,7,116,
+255,238,5,106,255,238,5,153,255,235,4,133,255,235,5,161,255,235,7,32,255,
+235,8,153,255,235,8,33,255,235,6,142,255,235,7,9,255,235,5,33,255,235,6,157,
+255,236,7,90,255,235,7,252,255,235,7,222,255,235,5,215,255,235,5,215,255,
+235,5,196,255,235,5,194,255,236,10,16,255,236,9,155,255,236,7,239,255,236,
+5,117,255,235,7,222,255,235,5,210,255,235,10,16,255,236,4,182,255,235,6,2,
+255,235,7,182,255,236,5,5,255,235,2,196,0,100,2,196,255,190,6,153,0,58,6,
+207,255,235,6,109,255,235,6,109,255,235,6,153,0,58,4,208,255,235,5,179,255,
+235,5,179,255,235,5,179,255,235,5,179,255,235,4,138,255,235,4,138,255,235,
+4,138,255,235,4,138,255,235,7,119,0,94,7,95,255,236,7,17,0,94,7,97,255,235,
+6,243,0,94,5,166,255,236,6,243,255,235,7,75,255,236,7,16,255,238,5,220,255,
+235,7,94,255,236,7,28,255,235,6,38,255,235,6,38,255,235,7,50,0,94,6,204,0,
+94,7,30,255,235,6,174,0,94,7,6,255,236,6,203,255,238,7,25,255,236,5,182,255,
+235,0,0,253,135,0,0,252,191,2,33,251,214,2,33,251,214,2,33,251,214,2,33,252,
+82,2,33,252,82,2,33,252,82,2,33,252,82,2,33,252,98,2,33,252,98,2,33,252,98,
+2,33,252,98,2,33,251,214,2,33,251,214,2,33,253,22,2,33,252,166,0,0,0,0,0,
+0,252,161,0,0,253,140,0,0,253,43,0,0,254,133,0,0,252,161,0,0,253,140,0,0,
+253,43,0,0,254,133,0,0,252,161,0,0,253,140,0,0,253,26,0,0,254,128,5,153,255,
+235,5,113,255,235,0,0,252,161,0,0,253,140,0,0,252,161,0,0,253,140,3,17,1,
+43,4,4,0,235,5,57,0,70,6,159,0,117,2,156,0,235,2,212,0,140,2,212,0,120,4,
+219,0,150,4,104,0,102,2,0,0,63,2,184,0,100,2,37,0,147,3,111,0,86,4,104,0,
+98,4,104,0,178,4,104,0,96,4,104,0,82,4,104,0,23,4,104,0,131,4,104,0,113,4,
+104,0,90,4,104,0,106,4,104,0,106,2,91,0,175,2,91,0,91,4,188,0,144,4,188,0,
+144,4,188,0,144,4,36,0,146,2,217,0,221,3,111,0,86,2,217,0,110,4,188,0,102,
+3,74,255,252,3,32,0,90,4,81,0,240,3,2,0,110,4,188,0,144,2,184,0,100,4,0,0,
+82,8,0,0,82,2,127,0,168,2,126,0,166,3,255,0,169,3,255,0,166,6,111,0,147,4,
+188,0,183,4,188,0,144,4,188,0,144,4,104,0,147,3,8,1,142,4,202,1,142,0,0,0,
+0,0,0,255,202,0,0,254,213,4,20,0,106,0,0,252,239,0,0,0,1,0,3,0,1,0,0,0,12,
+0,4,1,56,0,0,0,72,0,64,0,5,0,8,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,160,0,
+173,0,215,0,247,9,101,9,131,9,140,9,144,9,168,9,176,9,178,9,185,9,196,9,200,
+9,206,9,215,9,221,9,227,9,251,32,13,32,20,32,25,32,29,32,38,32,185,34,18,
+37,204,254,255,255,255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,173,
+0,215,0,247,9,100,9,129,9,133,9,143,9,147,9,170,9,178,9,182,9,188,9,199,9,
+203,9,215,9,220,9,223,9,230,32,11,32,19,32,24,32,28,32,38,32,185,34,18,37,
+204,254,255,255,255,0,1,255,245,0,0,1,230,1,229,1,202,1,175,255,99,1,129,
+1,95,1,64,248,214,246,131,246,130,246,128,246,126,246,125,246,124,246,121,
+246,119,246,117,246,115,246,107,246,103,246,102,246,100,226,49,226,28,226,
+25,226,23,226,15,225,128,224,38,220,115,3,61,0,1,0,0,0,0,0,68,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,8,2,9,2,10,0,0,0,21,0,
+21,0,21,0,21,0,69,0,123,0,194,1,23,1,130,1,236,2,99,2,195,3,48,3,141,3,230,
+4,53,4,165,4,240,5,89,5,161,5,232,6,43,6,105,6,202,7,15,7,115,7,215,8,27,
+8,159,8,247,9,73,9,141,9,199,9,247,10,52,10,115,10,168,10,230,11,22,11,100,
+11,178,11,222,12,35,12,102,12,158,12,170,12,235,13,52,13,113,13,183,14,7,
+14,30,14,98,14,132,14,176,14,232,15,32,15,85,15,117,15,167,15,210,16,29,16,
+45,16,61,16,84,16,151,16,202,16,214,16,226,16,238,16,250,17,6,17,85,17,98,
+17,140,17,205,18,8,18,66,18,138,18,215,19,29,19,86,19,157,19,233,20,30,20,
+87,20,114,20,186,20,212,21,6,21,75,21,87,21,138,21,177,21,226,22,1,22,13,
+22,25,22,37,22,49,22,61,22,73,22,85,22,97,22,109,22,121,22,133,22,145,22,
+157,22,169,22,181,22,193,22,205,22,217,22,229,22,241,22,253,23,9,23,21,23,
+33,23,45,23,57,23,69,23,81,23,93,23,209,24,84,24,108,24,151,24,184,24,251,
+25,7,25,57,25,69,25,155,25,220,25,232,25,244,26,0,26,12,26,94,26,106,26,166,
+26,215,26,249,27,5,27,17,27,60,27,72,27,112,27,172,27,184,27,228,27,240,28,
+50,28,62,28,120,28,178,28,234,29,34,29,46,29,58,29,70,29,82,29,94,29,110,
+29,126,29,142,29,158,29,174,29,190,29,206,29,222,29,238,29,254,30,14,30,30,
+30,42,30,54,30,70,30,86,30,102,30,118,30,134,30,150,30,166,30,182,30,198,
+30,214,30,230,30,246,31,6,31,22,31,38,31,54,31,70,31,86,31,102,31,147,32,
+4,32,111,32,209,33,52,33,185,34,62,34,179,35,70,35,217,36,65,36,77,36,211,
+37,80,37,198,38,46,38,124,38,210,39,54,39,143,39,242,40,62,40,168,41,32,41,
+113,41,186,42,41,42,135,42,236,43,78,43,179,44,22,44,120,44,244,45,78,45,
+176,46,42,46,54,46,160,46,172,47,29,47,188,47,200,48,37,48,49,48,138,48,150,
+48,162,48,174,48,186,49,60,49,72,49,84,49,96,49,108,49,120,49,132,49,205,
+50,37,50,126,50,193,51,34,51,100,51,112,51,124,51,202,51,214,52,58,52,70,
+52,82,52,172,53,12,53,24,53,111,53,216,53,228,53,240,54,0,54,103,54,119,54,
+131,54,143,55,11,55,149,56,64,56,168,56,180,56,192,57,34,57,137,57,253,58,
+103,59,2,59,157,60,12,60,107,60,225,61,62,61,162,62,13,62,102,62,208,63,68,
+63,224,64,112,64,221,65,100,65,243,66,178,67,41,67,190,68,122,68,238,68,250,
+69,193,70,98,70,241,71,170,72,39,72,205,73,109,74,34,74,146,75,23,75,145,
+76,2,76,116,76,250,77,107,77,214,78,50,78,134,78,211,79,32,79,116,80,16,80,
+155,80,238,81,60,81,155,81,250,82,102,82,114,82,215,83,58,83,130,83,223,84,
+38,84,134,84,248,85,88,85,200,86,24,86,112,86,220,87,74,87,194,88,92,88,202,
+89,33,89,156,89,236,90,73,90,145,90,229,91,70,91,208,92,86,92,201,93,103,
+93,220,94,60,94,192,95,74,95,205,96,50,96,172,97,28,97,142,98,11,98,162,99,
+27,99,144,99,223,100,64,100,169,100,252,101,110,101,228,102,90,102,191,103,
+38,103,171,104,47,104,170,105,28,105,144,106,9,106,174,107,59,107,192,108,
+55,108,164,109,42,109,154,110,8,110,103,110,224,111,90,111,208,112,51,112,
+156,113,76,113,224,114,86,114,237,115,99,115,200,116,52,116,166,117,24,117,
+151,118,11,118,129,118,252,119,120,119,224,120,132,121,36,121,150,122,57,
+122,174,123,59,123,165,123,177,124,40,124,134,125,1,125,123,125,227,126,91,
+127,18,127,154,128,53,128,173,129,17,129,139,130,17,130,55,130,124,130,226,
+131,134,131,227,132,56,132,165,132,250,133,10,133,26,133,42,133,58,133,74,
+133,90,133,106,133,122,133,247,134,103,134,231,135,87,135,215,136,92,136,
+204,137,52,137,179,138,53,138,175,139,70,139,157,139,236,140,99,140,222,141,
+78,141,200,142,43,142,167,143,28,143,123,143,168,143,225,143,237,143,249,
+144,9,144,53,144,65,144,77,144,93,144,148,144,160,144,172,144,188,145,7,145,
+19,145,31,145,47,145,47,145,107,145,164,145,198,145,224,146,29,146,87,146,
+125,146,155,146,213,147,13,147,45,147,71,147,179,148,18,148,78,148,131,148,
+191,148,245,149,19,149,47,149,106,149,178,149,198,149,236,150,18,150,59,150,
+86,150,105,150,121,150,143,150,168,150,214,150,237,151,27,151,86,151,125,
+151,171,151,231,151,250,152,66,152,127,152,169,152,207,152,231,152,254,153,
+23,153,82,153,109,153,134,153,160,153,181,153,195,153,250,154,16,154,72,154,
+114,154,122,154,138,154,154,154,178,154,203,154,239,155,20,155,73,155,110,
+155,158,155,174,155,223,155,236,155,255,155,255,156,12,156,42,156,136,156,
+159,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,
+252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,4,253,135,4,250,0,88,
+7,86,0,10,0,24,0,25,0,26,0,0,1,34,38,53,52,54,51,50,21,20,6,37,6,6,35,34,
+38,39,55,22,22,51,50,54,55,1,19,254,240,45,46,46,42,92,49,1,64,17,181,157,
+159,189,18,142,11,108,98,99,110,10,254,216,84,6,77,51,42,36,46,88,39,48,150,
+181,179,184,175,18,127,114,121,121,254,5,2,92,0,3,0,169,255,172,3,121,4,250,
+0,11,0,23,0,31,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,38,35,
+34,6,21,20,22,7,22,0,23,7,38,0,39,1,213,122,166,165,123,124,164,164,124,63,
+85,84,64,64,84,84,132,176,1,69,115,134,148,254,252,178,4,250,159,120,120,
+160,160,120,118,161,254,86,84,63,62,85,84,63,64,83,204,108,254,164,204,68,
+227,1,4,108,0,0,4,0,181,0,0,2,245,4,250,0,11,0,23,0,35,0,47,0,0,1,50,22,21,
+20,6,35,34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,19,50,22,21,20,
+6,35,34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,1,213,122,166,165,
+123,124,164,164,124,63,85,84,64,64,84,84,64,122,166,165,123,124,164,164,124,
+63,85,84,64,64,84,84,4,250,159,120,120,160,160,120,118,161,254,86,84,63,62,
+85,84,63,64,83,254,223,159,120,120,160,160,120,118,161,254,86,84,63,62,85,
+84,63,64,83,0,0,3,255,235,0,0,7,57,4,250,0,37,0,51,0,52,0,0,33,38,39,6,6,
+35,34,0,3,55,18,0,51,50,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,55,38,
+39,33,53,33,21,35,17,1,22,22,23,38,53,17,33,22,23,22,22,21,20,1,5,197,103,
+212,61,201,129,245,254,168,123,150,108,1,8,194,149,162,133,108,62,61,24,155,
+35,69,67,37,118,253,210,7,78,215,254,104,79,138,40,6,253,71,52,21,178,211,
+254,215,205,148,82,85,1,103,1,104,50,254,193,254,217,146,117,124,152,55,45,
+47,42,36,74,74,67,99,28,93,38,146,146,251,152,1,227,51,140,68,81,93,2,218,
+43,62,8,236,176,59,1,225,0,0,4,255,235,0,0,9,88,5,129,0,53,0,67,0,68,0,69,
+0,0,33,35,17,38,38,35,35,17,35,38,39,6,6,35,34,0,3,55,18,0,51,50,54,53,52,
+38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,33,53,33,50,22,23,38,53,53,51,
+23,51,21,35,1,22,22,23,38,53,17,33,22,23,22,22,21,20,1,5,8,129,157,33,86,
+64,203,157,103,212,61,201,129,245,254,168,123,150,108,1,8,194,149,162,133,
+108,62,61,24,155,35,69,67,37,118,253,210,7,68,50,102,36,7,108,47,217,215,
+252,73,79,138,40,6,253,71,52,21,178,211,2,141,252,74,3,212,75,73,251,152,
+205,148,82,85,1,103,1,104,50,254,193,254,217,146,117,124,152,55,45,47,42,
+36,74,74,67,99,28,93,38,146,62,67,48,63,153,135,146,253,123,51,140,68,81,
+93,2,218,43,62,8,236,176,59,2,218,249,0,4,255,235,255,126,4,83,7,86,0,65,
+0,66,0,67,0,68,0,0,1,33,22,23,30,2,21,20,6,7,4,5,7,36,36,37,55,22,22,51,50,
+54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,35,53,33,38,38,35,35,
+34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,51,1,19,3,4,83,253,94,
+50,22,133,203,109,202,189,1,17,1,18,95,254,245,254,130,254,245,29,70,134,
+95,182,184,154,129,103,101,13,149,23,100,99,42,110,211,2,242,4,75,84,149,
+191,171,79,11,151,9,55,112,110,116,123,146,81,5,226,254,38,40,107,4,104,43,
+61,2,92,168,97,155,191,25,99,216,109,203,181,61,142,22,17,124,114,103,121,
+59,63,34,32,30,67,58,78,113,27,87,36,146,87,71,85,142,100,47,62,10,46,32,
+74,90,37,47,131,127,2,92,249,186,2,241,0,3,255,235,255,241,5,152,7,86,0,78,
+0,79,0,80,0,0,1,21,33,22,23,22,22,23,54,55,23,6,6,21,20,22,23,7,38,53,52,
+55,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,54,53,52,38,35,34,6,21,20,23,7,
+38,53,52,55,38,39,35,53,33,38,38,35,33,34,38,38,53,52,55,23,6,21,20,22,22,
+51,51,50,22,22,23,1,3,5,152,251,226,52,21,140,175,21,135,212,146,57,50,34,
+37,154,76,70,98,158,86,97,134,77,73,127,62,115,35,62,42,44,92,89,128,104,
+62,67,18,149,29,157,42,110,156,3,231,4,75,84,254,233,191,171,79,11,151,9,
+55,112,110,246,123,146,81,5,254,19,67,4,250,146,45,60,11,162,136,162,101,
+132,106,197,131,99,182,110,35,248,212,208,140,60,172,125,140,109,93,99,76,
+59,53,83,138,70,104,144,54,46,50,44,32,77,72,148,52,87,36,146,87,71,85,142,
+100,47,62,10,46,32,74,90,37,47,131,127,2,92,252,171,0,2,255,235,0,50,5,200,
+7,86,0,61,0,62,0,0,1,20,22,22,51,50,54,55,55,22,21,20,4,35,32,0,3,55,18,0,
+51,50,54,53,52,39,6,6,35,34,38,38,53,17,33,53,33,38,38,35,33,34,38,38,53,
+52,55,23,6,21,20,22,22,51,51,50,22,22,23,33,21,33,3,2,216,13,35,28,61,134,
+85,122,138,254,248,227,254,213,254,133,116,155,101,1,37,237,159,185,56,81,
+167,79,78,110,47,253,176,4,37,4,75,84,254,225,191,171,79,11,151,9,55,112,
+110,254,123,146,81,5,1,36,253,16,95,2,250,45,41,29,115,124,20,203,202,202,
+249,1,193,1,197,42,254,111,254,124,160,133,128,89,112,107,70,120,104,1,82,
+146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,146,2,238,0,0,2,255,
+235,0,50,6,232,7,86,0,68,0,69,0,0,1,21,33,17,20,22,22,51,50,54,55,55,22,21,
+20,4,35,32,0,3,55,18,0,23,55,38,2,39,55,18,0,51,50,54,53,52,39,6,35,34,38,
+38,53,17,33,53,33,38,38,35,33,34,38,38,53,52,55,23,6,21,20,22,22,51,33,50,
+22,22,23,1,6,232,253,14,11,39,26,60,134,86,123,138,254,249,248,254,119,254,
+2,159,152,105,1,6,177,6,111,182,61,153,104,1,0,215,161,180,58,164,161,73,
+111,51,252,146,5,47,4,75,84,254,132,191,171,79,11,151,9,55,112,110,1,91,123,
+146,81,5,252,203,4,250,146,254,157,40,45,31,115,124,20,197,209,216,244,1,
+165,1,164,48,254,220,254,184,102,6,100,1,95,227,44,254,116,254,168,160,135,
+130,94,218,66,115,113,1,72,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,
+131,127,2,92,0,3,0,100,0,0,6,24,5,129,0,46,0,55,0,56,0,0,1,22,23,17,51,23,
+17,22,22,23,38,53,17,51,23,17,35,38,39,17,35,38,36,39,39,54,36,55,38,39,6,
+6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,1,6,4,7,22,4,23,38,53,1,2,253,
+134,78,108,49,77,155,43,6,108,49,157,92,177,157,93,254,155,210,80,160,1,52,
+147,43,76,75,179,105,126,148,45,157,36,56,51,88,134,52,1,74,149,254,238,126,
+162,1,58,80,7,1,35,5,1,136,168,1,176,135,253,135,48,155,75,67,97,3,114,135,
+251,156,184,139,254,39,174,251,34,189,91,144,53,86,83,112,112,130,112,84,
+80,44,56,56,51,53,122,104,254,83,50,121,72,37,197,125,79,82,3,123,0,0,4,0,
+114,0,0,4,193,7,86,0,55,0,56,0,57,0,58,0,0,37,54,54,53,52,38,38,39,46,2,53,
+52,54,55,23,6,6,21,20,30,2,23,30,3,21,20,4,33,35,39,54,54,53,52,38,35,34,
+6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,3,3,1,2,156,186,195,90,186,162,
+193,195,93,74,84,112,56,50,25,77,175,128,152,200,114,52,254,125,254,169,39,
+46,100,97,92,83,70,74,24,155,35,159,145,147,191,43,26,4,254,189,150,25,155,
+122,89,113,97,56,68,100,114,91,62,127,77,85,51,74,32,34,48,57,73,42,51,104,
+113,133,94,220,235,139,36,101,71,72,82,51,48,51,39,36,80,68,102,119,156,118,
+71,104,4,54,2,92,249,60,0,2,0,94,0,0,5,85,5,6,0,53,0,54,0,0,1,17,35,38,38,
+35,34,6,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,52,38,
+38,35,34,6,6,21,20,51,50,55,23,6,35,34,38,53,52,54,54,51,50,22,22,37,5,85,
+153,25,109,92,40,71,92,134,92,223,240,25,155,23,148,167,66,120,121,72,183,
+80,32,66,57,89,174,109,122,34,52,14,52,81,111,139,150,247,130,112,137,69,
+253,73,3,245,252,11,91,87,6,11,18,214,213,71,131,23,95,80,140,140,18,17,111,
+2,224,85,69,33,105,163,68,99,7,144,16,132,117,108,232,144,69,112,169,0,2,
+0,94,0,0,6,166,7,86,0,77,0,78,0,0,1,17,35,38,38,35,34,6,7,6,35,34,38,53,52,
+55,23,6,21,20,22,51,50,55,54,51,50,23,17,52,38,38,35,34,6,6,21,20,51,50,55,
+23,6,35,34,38,53,52,54,54,51,50,22,22,21,21,54,53,52,38,39,39,38,38,53,52,
+55,23,6,21,20,22,23,5,4,17,20,6,1,5,85,153,25,109,92,40,71,92,134,92,223,
+240,25,155,23,148,167,66,120,121,72,183,80,32,66,57,89,174,109,122,34,52,
+14,52,81,111,139,150,247,130,112,137,69,177,136,179,251,189,162,8,152,7,89,
+104,1,63,1,156,166,252,158,2,254,253,2,91,87,6,11,18,214,213,71,131,23,95,
+80,140,140,18,17,111,2,224,85,69,33,105,163,68,99,7,144,16,132,117,108,232,
+144,69,112,92,84,90,148,98,124,26,35,26,159,157,48,38,9,35,36,87,95,13,43,
+56,254,175,125,198,1,174,0,2,0,58,0,86,5,115,5,8,0,45,0,46,0,0,1,22,21,20,
+6,35,32,0,3,55,18,0,33,50,54,53,52,39,6,7,39,54,54,53,52,38,35,34,6,6,21,
+20,22,22,23,7,38,53,52,54,54,51,50,22,21,20,1,4,232,139,254,214,254,195,254,
+84,124,154,122,1,81,1,4,142,157,101,55,91,63,153,137,85,82,90,171,105,19,
+51,43,43,234,154,246,130,155,176,254,8,2,220,103,169,170,204,1,220,1,221,
+45,254,72,254,109,118,107,104,74,32,34,146,50,126,87,76,79,78,118,47,25,33,
+26,6,151,44,181,93,194,118,158,140,148,1,176,0,0,1,0,58,0,86,6,168,7,86,0,
+69,0,0,1,22,21,20,6,35,32,0,3,55,18,0,33,50,54,53,52,39,6,7,39,54,54,53,52,
+38,35,34,6,6,21,20,22,22,23,7,38,53,52,54,54,51,50,22,21,20,7,54,53,52,38,
+39,39,38,38,53,52,55,23,6,21,20,22,22,23,5,4,17,20,6,4,246,125,254,214,254,
+195,254,84,124,154,122,1,81,1,4,142,157,100,67,80,63,153,137,85,82,90,171,
+105,19,51,43,43,234,154,246,130,151,180,15,185,136,179,251,188,163,8,152,
+7,51,94,88,1,22,1,157,205,2,209,101,160,170,204,1,220,1,221,45,254,72,254,
+109,118,107,103,75,37,29,146,50,126,87,76,79,78,118,47,25,33,26,6,151,44,
+181,93,194,118,159,129,48,39,104,150,98,124,26,35,26,158,158,24,62,9,46,25,
+66,85,37,12,38,56,254,177,138,213,0,0,3,255,235,0,0,6,138,4,250,0,32,0,41,
+0,42,0,0,1,55,22,51,50,54,53,52,38,39,17,35,38,0,39,39,54,36,55,53,33,53,
+33,21,33,21,22,4,21,20,6,35,34,1,6,4,7,22,4,23,38,53,17,4,136,11,35,35,79,
+80,200,194,157,96,254,128,214,80,197,1,131,190,252,154,6,159,253,100,251,
+1,46,146,134,76,254,158,124,254,221,168,171,1,78,85,7,1,77,147,4,59,71,106,
+150,32,252,130,193,1,20,29,197,113,175,61,84,146,146,79,36,254,170,120,146,
+2,50,40,131,91,35,223,143,84,81,3,119,0,0,2,0,100,0,0,5,166,5,129,0,44,0,
+45,0,0,1,22,21,20,6,7,22,4,23,38,53,17,51,23,51,21,35,17,35,38,36,39,39,54,
+54,53,52,39,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,37,2,247,163,
+209,197,179,1,25,102,4,108,47,217,215,157,142,254,145,225,49,238,239,47,67,
+174,107,125,148,45,157,36,56,51,88,134,52,1,46,5,1,154,165,147,196,41,50,
+190,140,54,143,3,246,135,146,251,152,203,244,41,189,18,139,120,79,63,108,
+107,129,113,84,80,44,56,56,51,53,122,104,21,0,0,2,0,46,0,0,5,85,5,129,0,42,
+0,43,0,0,1,17,35,17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,54,54,53,52,
+38,35,34,6,7,39,54,54,51,50,22,23,38,38,53,53,51,23,51,21,37,4,126,157,136,
+205,113,83,137,70,74,120,123,142,161,174,104,140,135,73,61,48,90,61,165,102,
+236,139,133,225,119,1,6,108,47,217,254,15,4,104,251,152,3,32,186,152,79,101,
+39,141,101,119,191,93,149,58,120,68,48,59,22,29,134,178,173,131,144,26,92,
+68,210,135,146,146,0,0,3,255,235,0,0,5,34,4,250,0,17,0,35,0,36,0,0,19,35,
+53,33,21,35,17,35,38,36,39,39,54,55,38,38,53,52,1,6,6,7,22,4,23,38,53,17,
+33,6,21,20,22,51,50,55,5,180,201,5,55,215,157,114,254,135,209,73,109,129,
+142,151,2,139,106,205,100,179,1,32,125,4,253,202,96,95,83,109,111,254,192,
+4,104,146,146,251,152,153,200,14,178,79,83,14,132,107,93,254,240,64,139,74,
+34,146,135,118,30,3,23,70,92,67,72,76,212,0,0,4,0,59,0,0,5,86,5,8,0,50,0,
+61,0,62,0,63,0,0,1,22,23,54,54,51,50,22,21,20,6,35,34,39,21,20,22,51,50,54,
+55,55,22,21,20,4,35,34,36,2,3,55,18,18,22,51,50,54,53,52,39,6,6,35,34,38,
+38,53,53,38,39,5,22,51,50,54,53,52,38,35,34,6,55,19,1,111,127,105,33,181,
+120,120,144,179,136,79,71,44,42,71,138,96,124,119,254,242,238,213,254,216,
+213,77,156,67,169,233,172,168,189,49,88,170,82,80,114,48,194,147,1,241,68,
+78,77,83,61,51,77,101,35,120,4,252,165,71,117,131,120,105,113,135,17,141,
+62,52,96,110,6,187,172,184,227,198,1,139,1,34,43,254,252,254,169,168,141,
+122,96,87,97,97,70,119,106,166,97,207,219,21,61,53,41,46,99,221,251,6,0,4,
+255,235,0,0,4,160,4,250,0,22,0,41,0,42,0,43,0,0,1,22,22,51,51,50,22,22,21,
+20,2,4,35,34,38,38,53,17,35,53,33,21,33,7,20,23,17,20,22,22,51,50,54,54,53,
+52,38,35,35,34,38,38,19,19,1,95,74,173,141,34,94,119,72,141,254,245,162,92,
+126,76,215,4,181,252,191,1,1,25,62,58,102,189,108,55,88,9,96,127,128,131,
+116,4,68,131,95,41,108,90,126,254,249,188,66,134,142,2,224,146,146,245,12,
+13,254,73,94,84,45,133,191,86,51,58,34,76,1,193,251,6,0,5,255,235,255,155,
+5,147,4,250,0,46,0,62,0,63,0,64,0,65,0,0,1,22,22,51,51,55,54,51,50,22,22,
+21,20,6,7,22,4,23,7,38,36,37,55,22,51,50,36,53,52,38,39,22,21,20,6,6,35,34,
+38,38,53,17,35,53,33,21,33,7,22,21,21,20,22,22,51,50,54,53,52,38,35,35,34,
+19,19,39,1,89,63,144,110,100,24,49,31,126,177,91,195,178,121,1,1,136,72,217,
+253,250,254,210,19,141,141,244,1,10,99,93,10,119,211,126,85,122,70,209,5,
+168,251,198,3,3,22,53,57,121,168,37,69,13,187,240,159,166,4,89,76,52,1,3,
+92,169,93,162,214,42,27,98,70,123,117,147,30,146,27,182,141,90,113,15,30,
+29,97,161,92,50,117,124,1,137,146,146,169,64,34,125,61,55,34,129,72,27,32,
+1,172,251,6,166,0,3,255,235,255,241,7,106,4,250,0,62,0,63,0,64,0,0,1,22,22,
+51,50,55,23,6,6,21,20,22,23,7,38,53,52,55,38,36,39,6,6,21,20,22,51,50,54,
+55,23,22,21,20,6,35,32,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,53,52,54,
+55,6,35,33,53,33,21,37,19,4,114,53,201,147,51,60,81,45,45,33,38,154,77,66,
+203,254,240,85,141,160,59,48,66,119,93,177,42,242,226,254,233,254,138,110,
+156,98,1,32,226,151,156,16,81,153,84,123,148,142,133,57,137,253,137,7,127,
+253,246,174,4,104,94,93,6,144,82,177,124,99,185,115,36,253,217,209,131,1,
+135,151,71,146,87,51,55,57,82,63,103,125,179,212,1,160,1,150,45,254,146,254,
+166,132,133,58,51,70,62,140,120,103,180,62,3,146,146,146,251,6,0,3,255,235,
+0,0,6,111,5,129,0,28,0,37,0,38,0,0,1,22,22,23,38,53,17,51,23,51,21,35,17,
+35,38,39,17,35,38,0,39,39,54,36,55,53,33,53,33,3,6,4,7,22,4,23,38,53,1,3,
+238,77,155,43,6,108,47,217,215,157,92,177,157,95,254,132,219,80,213,1,131,
+174,252,154,4,3,157,147,254,221,145,171,1,78,85,7,1,45,2,129,48,155,75,67,
+97,3,114,135,146,252,46,184,139,254,39,190,1,22,30,197,125,182,57,69,146,
+254,137,52,138,86,35,223,143,83,83,3,118,0,0,4,0,94,0,0,7,184,5,6,0,70,0,
+90,0,91,0,92,0,0,1,17,35,38,38,35,34,6,7,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,55,54,51,50,23,17,52,38,38,35,34,6,6,21,20,51,50,55,23,6,35,34,38,53,
+52,54,54,51,50,22,23,54,54,51,50,22,21,20,7,22,21,20,6,35,34,38,39,22,19,
+54,53,52,38,35,34,6,7,23,22,22,51,50,54,53,52,39,6,7,1,1,5,85,153,25,109,
+92,40,71,92,134,92,223,240,25,157,23,147,166,66,120,121,72,183,80,32,66,57,
+89,174,109,122,34,52,14,52,81,111,139,150,247,130,137,155,15,78,159,97,125,
+152,96,107,161,139,100,159,59,7,243,202,71,62,86,157,72,1,46,164,107,62,79,
+78,39,62,254,78,1,98,1,154,254,102,91,87,6,11,18,214,213,71,131,23,95,80,
+142,138,18,17,111,2,224,85,69,33,105,163,68,99,7,144,16,132,117,108,232,144,
+113,92,85,77,130,103,130,80,80,124,111,141,88,89,47,1,113,33,117,50,58,120,
+120,69,151,157,64,54,81,49,15,13,2,58,254,85,0,3,255,235,0,0,4,160,7,86,0,
+56,0,57,0,58,0,0,1,21,33,17,20,22,22,51,50,54,54,53,52,38,35,34,7,39,54,51,
+50,22,21,20,2,4,35,34,38,38,53,17,35,53,33,38,38,35,35,34,38,38,53,52,55,
+23,6,21,20,22,22,51,51,50,22,22,23,1,3,4,160,252,191,28,63,56,92,177,131,
+69,72,46,61,23,79,90,126,136,155,254,249,151,93,127,75,215,3,62,4,75,84,193,
+191,171,79,11,151,9,55,112,110,160,123,146,81,5,254,194,193,4,250,146,253,
+59,98,83,42,109,201,107,68,64,14,146,21,142,135,134,254,246,171,67,135,140,
+2,224,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,251,6,7,86,
+0,0,4,255,235,0,0,4,207,7,86,0,35,0,49,0,50,0,51,0,0,3,53,33,38,38,53,52,
+54,55,23,6,6,21,20,22,23,33,21,33,34,39,22,18,21,20,0,35,34,36,39,55,54,54,
+53,52,39,23,22,21,20,6,7,22,22,51,50,54,53,52,38,3,3,21,1,175,80,67,88,95,
+105,67,59,74,96,2,124,254,155,66,59,183,150,254,238,241,165,254,245,61,45,
+208,212,43,153,32,222,222,42,175,111,166,186,129,89,83,4,104,146,104,145,
+67,79,140,69,114,51,90,58,55,128,108,146,4,182,254,213,159,226,254,246,185,
+159,161,20,195,198,106,104,81,106,109,185,237,52,98,108,192,156,142,253,252,
+129,6,196,0,3,255,235,0,0,5,200,4,250,0,38,0,39,0,40,0,0,1,20,22,22,51,50,
+54,55,55,22,21,20,4,35,32,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,38,53,
+17,33,53,33,21,33,55,19,2,216,13,35,28,61,134,85,122,138,254,248,227,254,
+213,254,133,116,155,101,1,37,237,159,185,56,81,167,79,78,110,47,253,176,5,
+221,253,16,21,140,2,250,45,41,29,115,124,20,203,202,202,249,1,193,1,197,42,
+254,111,254,124,160,133,128,89,112,107,70,120,104,1,82,146,146,146,251,6,
+0,3,255,235,0,0,4,160,4,250,0,33,0,34,0,35,0,0,1,39,54,51,50,22,21,20,2,4,
+35,34,38,38,53,17,35,53,33,21,33,17,20,22,22,51,50,54,54,53,52,38,35,34,3,
+19,2,138,23,79,90,126,136,155,254,249,151,93,127,75,215,4,181,252,191,28,
+63,56,92,177,131,69,72,46,188,116,2,219,146,21,142,135,134,254,246,171,67,
+135,140,2,224,146,146,253,59,98,83,42,109,201,107,68,64,2,17,251,6,0,0,2,
+0,92,0,0,4,231,5,129,0,29,0,30,0,0,1,38,53,53,51,23,51,21,35,17,35,17,38,
+38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,39,3,122,7,108,47,217,215,
+157,119,223,104,81,96,86,91,79,130,136,191,140,126,222,13,3,246,65,101,229,
+135,146,251,152,3,41,164,165,83,72,61,89,35,146,54,175,108,136,163,130,116,
+0,4,255,235,0,0,5,188,4,250,0,3,0,33,0,34,0,35,0,0,3,53,33,21,5,55,18,0,51,
+50,54,53,52,38,35,34,21,20,23,7,38,53,52,54,51,50,22,22,21,20,4,35,32,0,1,
+19,21,5,209,250,127,155,105,1,30,225,168,176,153,122,144,27,156,41,169,133,
+127,205,113,254,247,234,254,229,254,132,2,92,100,4,104,146,146,174,42,254,
+129,254,157,164,148,132,177,115,42,65,35,96,78,106,123,120,215,128,205,254,
+1,173,2,230,251,6,0,2,0,78,0,0,5,61,5,129,0,39,0,40,0,0,1,22,4,23,38,53,17,
+51,23,51,21,35,17,35,38,36,39,39,54,54,53,52,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,21,20,6,19,1,160,181,1,22,98,4,108,47,217,215,157,142,254,
+145,225,47,232,233,113,112,92,99,70,90,139,192,162,181,206,209,234,2,66,53,
+190,137,54,143,3,246,135,146,251,152,203,244,41,189,17,138,122,89,94,72,54,
+63,34,128,91,140,115,149,182,149,139,195,2,146,0,3,255,235,255,241,4,232,
+4,250,0,26,0,27,0,28,0,0,3,53,33,21,33,17,54,36,55,23,6,6,21,20,22,23,7,38,
+53,52,54,55,6,4,7,39,17,37,1,21,4,253,252,93,124,1,67,200,133,57,50,33,38,
+154,77,39,35,151,254,200,160,121,1,225,1,2,4,104,146,146,253,230,129,203,
+74,132,106,205,133,99,185,115,36,253,217,99,190,68,66,227,161,82,2,176,146,
+251,6,0,0,2,0,75,0,0,4,218,5,8,0,29,0,38,0,0,33,35,38,0,39,39,54,55,38,53,
+52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,55,53,33,21,35,7,6,4,7,22,4,23,
+38,53,4,3,157,100,254,131,234,80,144,135,130,142,125,60,49,13,32,41,62,66,
+51,54,186,193,1,116,215,157,168,254,210,134,196,1,75,84,7,191,1,12,39,197,
+85,67,96,130,93,122,10,147,4,50,42,43,60,27,85,61,215,146,229,58,138,80,46,
+215,140,83,83,0,1,255,235,0,0,4,233,4,250,0,30,0,0,1,38,53,17,33,53,33,21,
+35,17,35,17,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,54,51,50,22,3,122,
+5,252,118,4,254,215,157,114,229,99,82,99,86,91,79,130,136,85,153,86,124,227,
+2,108,55,85,1,112,146,146,251,152,1,170,142,150,83,73,61,89,35,146,54,175,
+108,88,136,74,114,0,4,0,45,0,0,5,208,5,129,0,29,0,44,0,45,0,46,0,0,1,38,39,
+1,39,55,54,53,52,38,35,34,7,39,54,36,51,50,22,23,38,53,17,51,23,51,21,35,
+17,35,1,54,55,55,38,38,35,34,6,7,54,51,50,22,21,1,1,4,92,74,48,253,237,122,
+63,44,62,59,63,63,156,146,1,7,141,147,238,143,7,109,46,217,215,157,253,237,
+48,58,204,70,135,79,101,178,90,58,57,108,120,1,150,253,123,2,229,104,57,254,
+9,114,59,63,67,54,60,38,148,191,171,149,185,72,116,1,11,135,146,251,152,2,
+201,51,55,192,66,61,104,111,29,120,103,2,33,253,20,0,0,2,255,235,0,0,6,201,
+4,250,0,48,0,49,0,0,33,35,38,36,39,39,54,54,55,38,39,55,35,53,33,21,33,22,
+22,23,23,6,6,7,22,4,23,38,53,17,51,50,4,22,21,20,6,35,34,39,55,22,51,50,54,
+53,52,38,39,3,4,44,157,144,254,158,241,74,77,209,132,170,248,45,164,6,222,
+250,93,108,219,68,10,134,205,71,196,1,38,136,4,27,208,1,48,172,147,133,76,
+43,10,35,35,78,81,212,182,157,196,199,39,186,52,116,64,126,51,99,146,146,
+38,137,69,114,60,103,43,46,167,149,118,30,2,182,116,210,129,121,145,10,147,
+4,58,72,105,158,19,1,130,0,0,2,255,235,0,0,4,218,4,250,0,14,0,23,0,0,33,35,
+38,0,39,39,54,36,55,53,33,53,33,21,35,7,6,4,7,22,4,23,38,53,4,3,157,100,254,
+131,234,80,207,1,142,190,252,133,4,239,215,157,168,254,210,134,196,1,75,84,
+7,191,1,12,39,197,122,182,60,69,146,146,229,58,138,80,46,215,140,83,83,0,
+0,4,255,235,0,0,5,217,4,250,0,3,0,38,0,39,0,40,0,0,3,53,33,21,5,22,21,20,
+4,35,32,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,54,55,1,19,21,5,238,254,223,151,254,246,229,254,208,254,129,118,155,
+102,1,50,238,158,186,67,76,169,106,128,149,47,162,38,58,53,90,133,65,254,
+219,103,4,104,146,146,153,223,207,205,251,1,174,1,177,42,254,131,254,143,
+165,138,136,98,104,96,129,113,83,89,49,60,55,51,53,120,108,1,63,251,6,0,2,
+255,235,0,0,5,14,4,250,0,31,0,43,0,0,1,38,38,39,55,35,53,33,21,35,17,35,17,
+38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,54,51,51,22,23,21,20,7,22,23,38,
+53,17,33,22,22,1,232,29,185,209,18,104,5,35,215,157,114,229,99,82,99,86,91,
+79,129,137,85,153,86,17,8,157,1,144,146,4,253,64,203,216,3,2,114,101,26,117,
+146,146,251,152,1,75,142,150,83,73,61,89,35,146,54,176,107,88,136,74,1,10,
+11,5,6,54,158,55,94,1,197,29,196,0,2,255,235,0,0,5,23,4,250,0,17,0,31,0,0,
+3,33,21,35,17,35,38,36,39,39,54,54,55,38,38,39,55,35,1,6,6,7,22,4,23,38,53,
+17,33,22,22,23,21,5,44,215,157,151,254,146,242,74,77,209,132,85,209,124,45,
+164,2,208,134,205,71,190,1,59,141,4,253,131,108,219,68,4,250,146,251,152,
+199,200,35,186,52,116,64,63,88,26,99,254,154,60,103,43,35,171,156,118,30,
+3,10,38,137,69,255,255,255,235,255,244,4,218,4,250,2,34,0,41,0,0,0,3,2,64,
+4,19,1,107,0,1,255,235,0,0,5,239,4,250,0,44,0,0,33,35,17,38,38,35,34,6,21,
+20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,
+22,23,38,53,53,33,53,33,21,35,5,24,157,52,91,52,68,69,5,133,14,141,95,79,
+97,116,116,55,168,176,190,141,101,146,63,26,105,60,58,100,66,3,251,112,6,
+4,215,2,136,70,60,77,73,39,35,9,120,142,89,70,78,118,41,151,53,206,137,131,
+168,68,75,52,59,38,54,62,63,172,146,146,0,0,2,255,238,0,0,5,127,5,129,0,47,
+0,48,0,0,3,54,51,50,22,23,54,54,51,50,22,23,38,53,53,51,23,51,21,35,17,35,
+17,38,38,35,34,6,21,20,22,23,7,38,38,39,6,6,35,39,54,54,53,52,38,35,34,7,
+37,18,94,82,104,162,39,35,148,93,86,155,59,4,108,48,216,215,157,62,145,84,
+84,95,142,138,14,139,181,41,40,186,133,13,133,140,112,104,76,81,3,145,4,245,
+19,94,86,87,93,77,76,36,73,165,135,146,251,152,3,162,104,104,92,82,88,97,
+7,158,8,100,92,95,105,158,2,101,83,86,94,22,158,0,0,3,255,235,0,0,5,37,4,
+250,0,17,0,24,0,35,0,0,19,35,53,33,21,35,17,35,38,36,39,39,54,54,55,38,38,
+39,55,22,4,23,38,53,53,19,38,53,53,38,39,6,6,7,22,4,141,162,5,58,215,157,
+174,254,154,241,74,100,222,122,115,222,107,175,180,1,103,137,4,4,4,102,152,
+127,200,74,179,1,67,4,104,146,146,251,152,206,193,35,186,64,119,54,63,86,
+23,99,56,209,128,57,97,239,252,98,118,30,203,110,103,57,101,44,34,168,0,2,
+255,235,0,0,5,138,4,250,0,32,0,45,0,0,19,55,35,53,33,21,35,17,35,17,38,38,
+35,34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,55,46,2,39,22,22,23,54,54,51,
+50,22,23,38,53,53,77,22,120,5,159,215,157,45,74,35,33,47,58,51,98,129,91,
+93,147,74,126,53,73,45,46,85,51,25,80,177,48,224,184,17,45,94,66,51,92,59,
+6,3,245,115,146,146,251,152,2,140,56,61,37,89,94,179,109,121,118,75,93,62,
+80,84,189,143,74,138,33,168,188,90,92,48,60,45,81,189,0,0,5,255,235,255,126,
+4,83,4,250,0,43,0,44,0,45,0,46,0,47,0,0,1,38,39,35,53,33,21,33,22,23,30,2,
+21,20,6,7,22,4,23,7,36,36,37,55,22,22,51,50,54,53,52,38,35,34,6,21,20,23,
+7,38,53,52,54,27,2,3,1,86,42,110,211,4,104,253,94,50,22,133,203,109,202,189,
+136,1,18,137,95,254,245,254,130,254,245,29,70,134,95,182,184,154,129,103,
+101,13,149,23,100,235,71,124,107,3,237,87,36,146,146,43,61,2,92,168,97,155,
+191,25,50,157,108,109,203,181,61,142,22,17,124,114,103,121,59,63,34,32,30,
+67,58,78,113,1,40,251,6,1,16,2,241,0,0,1,252,239,254,137,253,227,255,122,
+0,11,0,0,1,34,38,53,52,54,51,50,22,21,20,6,253,107,50,74,71,53,50,70,70,254,
+137,68,52,51,70,70,51,52,68,0,0,3,255,235,255,126,4,82,4,250,0,38,0,39,0,
+40,0,0,1,53,33,53,33,21,22,22,21,20,6,7,22,4,23,7,36,36,37,55,22,22,51,50,
+54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,1,3,1,153,254,82,2,75,183,201,
+202,189,136,1,18,137,95,254,245,254,130,254,245,29,70,134,95,182,184,154,
+129,103,101,13,149,23,138,1,196,107,3,251,109,146,253,18,202,136,155,191,
+25,50,157,108,109,203,181,61,142,22,17,124,114,103,121,59,63,34,32,30,67,
+58,93,122,253,38,2,241,0,0,2,255,235,0,0,2,54,5,129,0,19,0,20,0,0,33,35,17,
+38,38,35,35,53,51,50,22,23,38,53,53,51,23,51,21,35,37,1,95,157,29,101,67,
+18,33,54,103,32,7,109,46,217,215,254,230,3,192,81,87,146,69,60,48,63,153,
+135,146,146,0,1,255,235,0,0,5,164,7,86,0,25,0,0,19,38,39,54,36,51,50,4,5,
+7,38,36,35,34,6,7,22,23,51,21,35,17,35,17,35,53,167,94,32,132,1,25,188,178,
+1,104,1,8,87,238,254,214,156,147,214,87,30,80,239,215,157,215,4,250,110,57,
+238,199,163,217,111,194,147,145,163,58,88,146,251,152,4,104,146,0,0,1,251,
+214,0,0,2,54,7,86,0,37,0,0,33,35,17,35,53,51,38,36,33,34,6,21,20,22,51,51,
+50,22,22,21,35,46,2,35,35,34,38,53,52,36,33,32,0,19,51,21,35,1,95,157,215,
+215,16,254,155,254,174,187,201,65,93,197,144,138,63,137,2,39,71,67,202,174,
+169,1,20,1,6,1,170,1,183,20,209,215,4,104,146,229,233,60,55,28,30,70,125,
+109,68,66,24,95,104,124,138,254,211,254,209,146,0,4,252,161,253,213,0,184,
+0,16,0,20,0,31,0,32,0,33,0,0,19,38,39,6,6,35,34,38,53,52,54,51,50,23,53,51,
+21,20,7,22,23,37,38,35,34,6,21,20,22,51,50,54,19,1,92,190,134,45,176,130,
+111,169,162,141,103,106,157,5,137,246,253,216,104,97,71,76,70,63,83,107,42,
+1,187,253,213,159,79,114,114,126,110,106,124,34,129,112,46,36,72,195,195,
+39,55,47,51,54,84,1,78,254,89,0,0,4,253,140,253,213,1,80,0,16,0,27,0,28,0,
+29,0,30,0,0,19,38,39,6,6,35,34,38,53,52,54,55,53,51,21,7,38,35,34,21,20,22,
+51,50,54,55,22,23,1,1,37,249,152,141,64,158,94,111,157,153,124,157,66,29,
+47,143,62,53,83,138,68,219,192,253,81,2,168,254,128,253,213,111,70,59,60,
+116,105,85,111,3,89,130,95,5,83,37,42,78,80,105,134,1,191,254,89,83,0,2,253,
+43,253,213,0,74,0,51,0,12,0,13,0,0,5,54,37,23,6,7,22,4,23,7,38,36,39,1,253,
+43,244,1,12,53,252,112,149,1,34,159,74,149,254,203,197,1,48,163,119,95,134,
+80,53,19,101,102,117,96,110,22,1,71,0,2,253,43,252,218,0,59,0,51,0,23,0,24,
+0,0,1,54,55,38,39,39,54,37,23,4,7,4,5,7,38,39,6,7,22,23,7,38,38,39,1,253,
+44,176,122,101,128,70,244,1,12,53,254,255,111,1,65,1,10,63,115,128,182,101,
+247,219,63,100,242,190,1,52,254,24,83,41,26,11,164,119,95,134,82,52,58,158,
+102,64,49,65,45,39,129,106,57,84,26,2,127,0,0,1,255,235,255,246,3,16,4,250,
+0,26,0,0,1,21,35,14,2,21,20,22,51,50,54,55,23,6,35,34,38,38,53,52,18,55,6,
+35,33,53,2,217,42,98,208,119,161,124,50,74,41,72,98,146,128,201,111,170,153,
+68,88,254,224,4,250,146,24,179,251,138,191,203,23,24,126,73,135,247,161,188,
+1,59,98,6,146,0,0,2,255,190,255,246,3,16,7,86,0,49,0,50,0,0,1,38,38,35,35,
+34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,51,21,35,14,2,21,20,
+22,51,50,54,55,23,6,35,34,38,38,53,52,18,55,6,35,33,53,1,2,67,2,81,80,41,
+191,171,79,11,151,9,55,112,110,8,123,145,82,5,2,42,98,208,119,161,124,50,
+74,41,72,98,146,128,201,111,170,153,68,88,254,224,1,78,4,250,85,73,85,142,
+100,47,62,10,46,32,74,90,37,47,128,130,146,24,179,251,138,191,203,23,24,126,
+73,135,247,161,188,1,59,98,6,146,2,92,255,255,255,235,255,246,7,181,5,129,
+0,34,0,60,0,0,0,35,0,53,5,127,0,0,0,3,0,51,6,185,3,151,255,255,255,235,255,
+246,7,181,7,86,0,34,0,60,0,0,0,35,0,66,5,127,0,0,0,3,0,51,6,185,3,151,0,4,
+254,133,253,213,0,232,0,0,0,3,0,4,0,5,0,6,0,0,5,1,7,1,55,19,53,254,240,1,
+248,89,253,246,28,200,35,254,108,110,1,127,166,253,213,136,0,2,0,100,255,
+235,4,129,5,7,0,42,0,43,0,0,1,22,22,51,50,54,53,52,38,35,34,6,21,20,22,22,
+23,30,2,23,7,46,3,39,36,38,53,52,54,54,51,50,22,21,20,6,35,34,38,39,19,1,
+171,44,84,56,72,86,102,97,139,172,76,172,167,184,179,85,31,154,22,40,70,135,
+140,254,236,216,119,216,139,170,185,164,143,106,164,51,182,3,206,67,49,71,
+61,71,81,154,112,93,129,118,74,80,126,132,109,36,70,71,68,77,62,120,246,185,
+110,191,108,163,134,129,149,89,87,1,130,0,0,2,253,22,0,0,2,54,7,86,0,30,0,
+31,0,0,1,21,35,17,35,17,35,53,51,38,38,35,33,34,38,38,53,52,55,23,6,21,20,
+22,22,51,33,50,22,22,23,1,2,54,215,157,215,224,4,75,84,254,167,191,171,79,
+11,151,9,55,112,110,1,56,123,146,81,5,253,100,4,250,146,251,152,4,104,146,
+87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,2,92,255,255,255,235,
+254,207,5,200,4,250,2,34,0,31,0,0,0,3,0,51,5,126,0,70,255,255,255,235,254,
+137,4,160,4,250,2,34,0,32,0,0,0,3,0,51,4,215,0,0,255,255,255,235,255,244,
+5,23,4,250,2,34,0,44,0,0,0,3,2,64,4,8,1,107,255,255,0,100,253,213,6,24,5,
+129,2,34,0,13,0,0,0,3,0,58,5,50,0,0,255,255,0,114,253,168,4,193,7,86,2,34,
+0,14,0,0,0,3,0,72,3,247,0,40,0,6,253,41,253,128,0,19,0,27,0,45,0,46,0,47,
+0,48,0,49,0,50,0,0,1,54,54,53,52,38,39,38,38,53,52,55,23,6,21,20,22,23,22,
+22,21,20,6,35,35,39,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,
+20,3,35,3,55,39,254,171,111,110,115,119,137,78,21,114,9,39,97,162,164,246,
+221,50,25,105,46,51,35,45,15,124,23,109,99,106,116,54,230,8,228,160,253,240,
+14,68,63,62,72,37,42,71,53,36,37,27,15,18,17,26,29,48,120,108,125,134,100,
+26,76,30,39,22,21,26,26,23,45,42,64,75,90,75,59,1,229,253,213,42,125,255,
+255,251,154,252,220,0,249,0,27,0,35,0,72,254,113,255,92,0,3,0,72,0,230,0,
+0,0,3,0,147,0,186,4,41,4,250,0,12,0,24,0,25,0,0,19,52,54,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,19,147,114,211,142,218,233,
+251,220,210,237,165,144,135,144,165,144,132,145,167,34,2,144,128,214,116,
+248,222,205,253,243,208,144,161,179,152,145,160,177,1,227,0,2,0,249,0,0,3,
+246,5,13,0,41,0,42,0,0,1,23,6,6,21,20,22,51,50,54,53,52,38,39,46,2,53,52,
+54,55,23,6,6,21,20,22,22,23,30,2,21,20,6,6,35,34,38,53,52,54,55,1,223,59,
+62,56,88,77,121,144,103,160,140,141,57,58,50,131,29,38,34,116,128,139,125,
+51,111,196,120,159,176,113,214,1,242,156,15,44,38,43,49,121,96,88,134,112,
+99,119,102,60,49,112,48,73,30,59,33,38,60,92,86,93,131,139,94,108,167,90,
+136,114,91,124,204,0,0,2,0,134,255,203,4,109,5,13,0,34,0,35,0,0,1,22,22,23,
+7,38,36,37,55,22,22,51,50,54,53,52,38,39,38,38,53,52,55,23,6,21,20,22,22,
+23,22,22,21,20,6,7,2,136,123,243,119,94,196,254,140,254,175,29,87,146,85,
+189,189,112,164,169,153,87,130,45,36,88,103,191,174,200,62,1,98,50,148,98,
+111,162,195,75,146,27,20,102,103,80,82,32,34,106,86,85,105,73,46,50,32,33,
+27,20,36,150,143,125,180,44,0,2,0,59,0,79,4,109,4,250,0,34,0,35,0,0,19,55,
+18,18,22,51,50,54,53,52,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,18,
+21,20,2,35,34,38,38,2,1,59,152,52,124,176,138,133,135,68,120,70,54,60,39,
+162,51,152,115,131,200,112,217,205,133,192,153,126,1,115,3,236,41,254,246,
+254,155,188,187,184,120,201,116,54,49,64,76,44,106,96,108,121,145,254,243,
+167,251,254,237,94,206,1,103,2,24,0,3,0,128,0,0,4,61,4,250,0,24,0,36,0,48,
+0,0,1,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,54,51,50,22,21,20,
+6,37,54,54,53,52,38,35,34,6,21,20,22,23,6,6,21,20,22,51,50,54,53,52,38,3,
+37,152,128,239,239,225,254,137,140,140,114,104,202,137,228,241,123,254,180,
+130,160,159,143,120,160,140,150,163,150,165,148,154,162,171,2,166,60,151,
+111,178,178,192,164,102,152,57,67,131,100,81,142,86,166,133,100,142,11,33,
+119,69,76,87,90,74,78,104,184,43,121,88,90,110,106,103,82,130,0,3,0,100,0,
+0,4,136,5,14,0,27,0,47,0,48,0,0,1,6,21,20,22,51,51,50,55,23,6,6,21,20,22,
+51,50,55,23,6,4,35,34,0,53,52,0,37,7,6,2,21,20,22,51,50,54,55,38,38,53,52,
+54,55,38,38,53,52,39,3,160,40,95,78,15,8,7,69,195,162,104,101,52,22,67,102,
+254,251,144,246,254,216,1,102,1,134,95,242,245,211,179,74,115,87,138,147,
+126,139,74,87,92,4,154,54,62,58,72,1,114,106,168,93,75,82,4,171,62,66,1,17,
+235,220,1,120,184,213,126,254,215,164,165,177,13,24,18,139,115,103,179,96,
+21,112,72,27,229,0,0,2,0,43,0,79,4,121,4,250,0,42,0,43,0,0,1,20,22,51,50,
+54,55,55,22,22,21,20,6,35,34,38,2,3,55,18,18,51,50,54,53,52,39,6,6,35,34,
+38,38,53,53,52,38,38,39,55,22,22,21,1,2,126,45,30,63,91,41,113,58,66,227,
+208,175,248,181,63,153,80,233,191,138,152,29,51,132,81,72,101,43,26,59,56,
+18,141,139,254,168,3,25,80,41,114,111,28,79,207,91,218,251,192,1,123,1,20,
+46,254,135,254,151,167,153,81,79,94,94,69,116,109,103,62,50,21,2,157,4,101,
+146,1,54,0,0,2,0,144,0,0,4,58,4,250,0,22,0,36,0,0,1,6,35,34,38,53,52,54,54,
+51,50,22,22,21,17,20,22,22,23,7,38,38,53,3,53,52,38,38,35,34,6,6,21,20,22,
+51,50,3,16,118,117,196,209,127,220,117,118,147,68,26,59,56,18,142,138,1,24,
+75,76,73,141,85,120,115,133,2,32,37,173,161,113,200,120,84,133,126,253,129,
+62,50,21,2,157,4,101,145,1,203,190,90,84,55,81,136,79,85,88,0,0,2,0,45,0,
+0,4,177,4,253,0,35,0,47,0,0,1,54,54,51,50,23,22,22,51,50,54,55,23,6,35,34,
+39,22,21,20,6,6,35,34,38,38,53,17,52,38,38,39,55,22,22,21,17,21,20,22,51,
+50,54,53,52,38,35,34,1,87,51,115,42,54,36,68,82,44,96,91,31,148,75,221,12,
+12,37,111,200,122,92,128,79,26,59,56,18,143,137,75,69,121,145,101,90,118,
+2,216,19,22,7,13,11,60,59,72,187,2,70,93,127,200,110,66,138,132,2,137,62,
+50,21,2,157,4,102,145,254,62,232,122,76,169,119,93,96,0,0,1,0,55,0,0,4,119,
+5,13,0,52,0,0,37,54,54,53,52,38,38,39,46,2,53,52,55,23,6,21,20,30,2,23,30,
+2,21,20,4,33,35,39,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,
+21,20,6,2,82,187,194,79,175,159,179,208,104,98,129,56,24,67,152,146,172,225,
+115,254,129,254,156,29,46,100,97,88,80,67,70,24,155,35,158,143,142,184,41,
+150,25,147,117,85,108,89,46,50,87,107,87,104,91,73,57,39,32,40,43,55,40,47,
+120,168,137,217,225,139,36,101,71,71,83,51,48,48,42,36,80,68,101,120,155,
+119,68,104,0,0,3,255,235,0,0,4,218,4,250,0,14,0,19,0,29,0,0,33,35,38,0,39,
+39,54,36,55,53,33,53,33,21,35,7,6,7,22,23,21,38,37,6,7,22,4,23,38,53,4,3,
+157,102,254,132,233,80,207,1,142,190,252,133,4,239,215,157,143,154,176,121,
+181,254,250,72,92,196,1,79,83,7,192,1,11,39,197,122,182,60,69,146,146,230,
+44,70,62,111,164,194,73,37,55,46,215,139,61,107,0,3,255,235,255,255,4,218,
+4,250,0,14,0,23,0,30,0,0,33,35,38,0,39,39,54,36,55,53,33,53,33,21,35,7,6,
+4,7,22,4,23,38,53,5,22,4,23,7,38,37,4,3,157,100,254,131,234,80,207,1,142,
+190,252,133,4,239,215,157,168,254,210,134,189,1,80,86,7,253,74,149,1,5,94,
+95,171,254,242,191,1,12,39,197,122,182,60,69,146,146,229,58,138,80,43,215,
+143,83,83,8,28,152,116,85,185,50,0,0,2,0,145,0,203,4,38,4,250,0,7,0,8,0,0,
+19,4,0,19,7,2,0,37,19,208,1,86,1,131,125,159,135,254,171,254,230,36,4,29,
+105,254,140,254,195,56,1,52,1,48,75,1,128,0,0,2,0,15,0,0,4,194,5,253,0,48,
+0,49,0,0,1,39,54,51,50,22,21,20,6,6,35,34,38,38,53,17,35,53,51,53,52,38,38,
+35,34,7,39,54,51,50,22,22,21,21,33,21,33,17,20,22,22,51,50,54,54,53,52,35,
+34,3,2,254,21,79,78,118,126,131,246,146,98,122,51,199,199,26,59,57,62,79,
+54,125,117,87,112,53,2,197,253,59,18,55,55,79,154,116,118,58,88,2,42,139,
+20,121,112,106,218,156,72,115,113,2,61,146,149,90,86,43,33,127,52,72,146,
+139,157,146,253,202,61,68,37,83,157,82,102,2,197,0,0,2,0,145,0,203,4,38,4,
+29,0,7,0,8,0,0,19,36,0,19,23,2,0,5,39,145,1,21,1,88,137,159,128,254,125,254,
+173,32,1,110,73,1,46,1,56,56,254,190,254,144,104,8,0,1,0,123,0,203,5,56,4,
+29,0,29,0,0,1,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,
+7,54,18,55,23,2,0,5,1,167,89,82,87,81,67,70,24,155,35,156,145,142,184,27,
+146,206,102,159,125,254,128,254,167,1,103,29,101,87,72,82,52,47,43,47,36,
+78,70,100,120,155,118,74,49,87,1,5,228,56,254,197,254,143,110,0,0,2,0,99,
+0,0,5,93,5,4,0,42,0,43,0,0,1,2,0,33,34,38,53,52,54,55,54,54,53,52,38,35,34,
+6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,6,7,6,6,21,20,22,51,32,0,19,7,5,
+93,80,254,51,254,136,165,192,138,166,127,91,89,79,67,70,24,155,35,156,145,
+142,184,64,132,136,113,76,104,101,1,48,1,117,76,51,4,242,253,134,253,136,
+146,118,93,108,23,16,58,70,60,83,52,47,43,47,36,78,70,100,120,155,118,84,
+116,76,20,17,44,45,44,51,2,50,2,62,10,0,1,0,225,0,0,1,126,4,250,0,3,0,0,33,
+35,17,51,1,126,157,157,4,250,0,2,0,94,255,250,5,21,4,253,0,26,0,27,0,0,19,
+22,22,21,17,18,37,23,17,20,22,22,23,7,38,38,53,17,6,4,7,39,17,52,38,38,39,
+37,112,143,137,248,1,143,121,26,59,56,18,142,138,168,254,206,173,121,26,59,
+56,1,100,4,253,4,102,147,254,48,1,2,148,82,253,172,62,50,21,2,159,5,103,147,
+2,33,74,218,174,82,2,63,62,50,21,2,154,0,0,2,0,120,1,70,3,102,4,1,0,11,0,
+23,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,
+22,1,239,163,212,211,164,165,210,211,164,95,122,122,95,96,121,121,4,1,196,
+153,154,196,197,153,152,197,253,213,117,89,89,117,117,89,90,116,0,0,3,0,156,
+2,252,4,235,6,4,0,13,0,25,0,26,0,0,1,2,0,35,34,2,39,55,18,33,50,54,54,55,
+1,34,38,53,52,54,51,50,22,21,20,6,7,4,235,108,254,214,243,198,240,16,167,
+21,1,9,129,164,124,66,254,59,50,74,71,53,50,70,70,79,5,219,254,113,254,176,
+1,5,240,13,254,162,122,254,236,254,44,68,52,51,70,70,51,52,68,162,0,1,0,116,
+254,221,2,250,3,60,0,15,0,0,1,38,2,38,53,52,54,55,23,6,6,21,20,22,18,23,2,
+114,150,242,118,123,127,89,82,88,69,206,202,254,221,168,1,47,226,104,117,
+142,59,151,33,84,57,57,150,254,248,213,255,255,255,235,255,244,6,138,4,250,
+2,34,0,19,0,0,0,3,2,64,4,9,1,107,255,255,0,100,255,244,5,166,5,129,2,34,0,
+20,0,0,0,3,2,64,4,164,1,107,255,255,0,46,255,196,5,85,5,129,2,34,0,21,0,0,
+0,3,0,51,4,122,1,59,255,255,255,235,255,244,5,34,4,250,2,34,0,22,0,0,0,3,
+2,64,4,19,1,107,255,255,0,59,254,137,5,86,5,8,2,34,0,23,0,0,0,3,0,51,5,123,
+0,0,255,255,255,235,254,137,4,160,4,250,2,34,0,24,0,0,0,3,0,51,4,215,0,0,
+255,255,255,235,254,209,5,147,4,250,2,34,0,25,0,0,0,3,0,51,5,77,0,72,255,
+255,255,235,254,217,7,106,4,250,2,34,0,26,0,0,0,3,0,51,6,65,0,80,255,255,
+255,235,255,244,6,111,5,129,2,34,0,27,0,0,0,3,2,64,4,19,1,107,255,255,0,94,
+254,217,7,184,5,6,2,34,0,28,0,0,0,3,0,51,5,189,0,80,255,255,255,235,254,137,
+4,160,7,86,2,34,0,29,0,0,0,3,0,51,4,215,0,0,255,255,255,235,254,137,4,207,
+7,86,2,34,0,30,0,0,0,3,0,51,4,244,0,0,255,255,0,92,255,246,4,231,5,129,2,
+34,0,33,0,0,0,3,2,64,4,88,1,109,255,255,255,235,254,187,5,188,4,250,2,34,
+0,34,0,0,0,3,0,51,5,111,0,50,255,255,0,78,255,244,5,61,5,129,2,34,0,35,0,
+0,0,3,2,64,4,72,1,107,255,255,255,235,255,3,4,232,4,250,2,34,0,36,0,0,0,3,
+0,51,4,181,0,122,255,255,0,75,255,244,4,218,5,8,2,34,0,37,0,0,0,3,2,64,4,
+19,1,107,255,255,255,235,255,69,4,233,4,250,2,34,0,38,0,0,0,3,0,51,4,100,
+0,188,255,255,0,45,255,244,5,208,5,129,2,34,0,39,0,0,0,3,2,64,4,177,1,107,
+255,255,255,235,255,244,6,201,4,250,2,34,0,40,0,0,0,3,2,64,4,7,1,107,255,
+255,255,235,254,187,5,217,4,250,2,34,0,42,0,0,0,3,0,51,5,122,0,50,255,255,
+255,235,254,255,5,14,4,250,2,34,0,43,0,0,0,3,0,51,4,100,0,118,255,255,255,
+235,255,244,5,239,4,250,2,34,0,46,0,0,0,3,2,64,5,63,1,107,255,255,255,238,
+255,244,5,127,5,129,2,34,0,47,0,0,0,3,2,64,4,140,1,107,255,255,255,235,255,
+244,5,37,4,250,2,34,0,48,0,0,0,3,2,64,4,8,1,107,255,255,255,235,255,132,5,
+138,4,250,2,34,0,49,0,0,0,3,0,51,4,102,0,251,255,255,255,235,255,33,4,83,
+4,250,2,34,0,50,0,0,0,3,0,51,4,75,0,152,255,255,255,235,255,244,4,218,4,250,
+2,34,0,84,0,0,0,3,2,64,4,19,1,107,255,255,255,235,255,79,4,218,4,250,2,34,
+0,85,0,0,0,3,0,51,3,184,0,198,0,4,255,236,0,0,7,175,4,250,0,54,0,71,0,77,
+0,78,0,0,33,53,38,38,35,34,6,21,20,23,7,38,53,52,54,55,38,38,35,34,6,21,20,
+23,7,38,53,52,54,55,38,39,33,53,33,21,33,21,4,4,21,20,6,35,34,39,55,22,51,
+50,53,52,38,39,17,3,38,38,53,52,55,33,22,23,22,22,23,22,22,23,38,53,3,7,6,
+22,23,53,53,4,139,111,192,98,71,73,36,152,52,140,119,37,165,101,71,73,35,
+151,52,147,123,22,57,254,207,7,195,253,121,1,25,1,2,141,128,73,42,11,34,35,
+145,178,202,157,186,186,2,254,184,45,4,140,197,9,86,154,67,4,215,1,5,86,135,
+168,160,142,63,54,56,49,62,86,98,98,128,15,112,128,63,54,54,51,62,87,97,100,
+127,14,79,57,146,146,225,6,192,149,113,140,10,147,4,106,94,101,4,253,7,2,
+250,5,169,151,27,14,71,77,38,215,127,23,117,95,31,105,2,115,16,84,117,6,223,
+146,0,6,255,235,0,0,7,223,4,250,0,49,0,60,0,82,0,83,0,84,0,85,0,0,1,21,20,
+22,23,54,54,51,50,22,21,20,7,22,21,20,6,35,34,39,6,6,35,32,0,3,55,18,0,51,
+50,54,53,52,39,6,6,35,34,38,53,52,54,55,6,35,33,53,33,21,1,38,39,6,6,21,20,
+22,51,50,54,5,54,53,52,38,35,34,6,7,23,30,3,51,50,54,53,52,39,6,7,1,1,19,
+4,58,64,57,94,186,117,125,152,97,107,159,140,216,122,43,219,166,254,233,254,
+138,110,156,99,1,34,230,146,154,18,82,149,85,124,147,142,133,57,137,253,137,
+7,244,252,54,94,16,122,127,57,50,66,108,2,41,202,71,62,90,163,73,2,4,53,87,
+115,68,64,76,77,39,62,254,78,1,118,6,4,104,21,66,145,66,126,107,130,103,129,
+81,79,125,112,140,208,122,121,1,160,1,150,45,254,144,254,168,132,132,55,58,
+71,64,141,119,103,180,62,3,146,146,254,169,136,137,66,137,77,51,55,48,57,
+33,117,50,58,130,129,13,24,143,116,62,63,55,82,48,15,13,2,238,251,6,2,155,
+0,4,253,249,4,250,0,228,7,86,0,3,0,4,0,5,0,6,0,0,1,1,23,1,23,19,23,253,249,
+2,156,79,253,113,76,84,6,5,168,1,174,116,254,68,44,2,92,130,0,1,250,103,254,
+34,255,52,1,120,0,27,0,0,3,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,
+22,51,50,55,54,51,50,23,17,55,204,153,25,109,91,76,124,123,91,212,225,19,
+157,16,137,142,68,115,115,72,184,79,157,254,34,91,87,17,18,167,163,65,58,
+19,54,44,94,95,18,17,111,1,255,129,0,2,252,78,253,220,255,52,0,137,0,9,0,
+16,0,0,39,17,35,38,38,39,39,54,36,55,21,6,7,22,23,38,53,204,157,97,240,175,
+73,144,1,65,120,216,181,247,157,7,137,253,83,99,124,28,164,82,148,40,147,
+83,94,57,139,84,68,0,0,2,255,235,0,255,5,138,4,250,0,32,0,41,0,0,1,21,22,
+22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,39,17,35,38,36,39,39,54,36,55,
+53,33,53,33,21,5,6,6,7,22,22,23,38,53,3,130,226,254,134,119,63,44,9,31,27,
+67,69,168,155,157,94,254,218,201,77,164,1,77,169,253,6,5,159,253,91,118,230,
+111,138,233,95,7,4,104,69,40,205,148,106,129,10,143,4,45,56,82,123,26,253,
+111,146,172,26,184,83,135,51,76,146,146,228,37,91,53,30,133,102,130,41,0,
+255,255,0,100,253,213,6,121,5,129,2,34,0,20,0,0,0,3,0,64,5,145,0,0,0,1,0,
+46,1,228,4,89,5,8,0,31,0,0,19,54,54,53,52,38,35,34,6,7,39,54,54,51,50,4,23,
+7,38,38,35,34,6,7,54,51,50,22,21,20,6,7,242,134,121,60,48,49,87,63,144,105,
+239,133,157,1,9,168,120,139,204,118,77,124,63,73,71,117,132,168,159,2,115,
+48,95,54,36,41,21,29,117,160,160,171,222,95,191,147,58,68,26,119,83,111,168,
+73,255,255,255,235,253,213,5,245,4,250,2,34,0,22,0,0,0,3,0,64,5,13,0,0,0,
+2,255,235,0,255,5,20,4,250,0,47,0,58,0,0,1,22,21,20,6,35,34,39,6,21,20,22,
+51,50,54,55,23,22,21,20,6,35,34,0,3,55,18,18,51,50,54,53,52,39,6,6,35,34,
+38,53,52,55,6,35,33,53,33,21,5,22,51,50,54,53,52,38,35,34,6,4,38,8,150,135,
+83,80,2,52,57,70,146,94,112,66,252,220,244,254,169,99,151,81,255,204,149,
+166,13,70,154,101,117,137,89,58,57,254,44,5,41,253,117,68,70,69,74,52,45,
+59,97,4,104,26,30,100,116,23,26,25,61,57,76,82,5,126,128,164,190,1,80,1,80,
+43,254,223,254,236,110,102,40,46,61,73,154,125,170,113,3,146,146,129,20,53,
+47,39,40,84,0,2,255,235,0,255,4,10,4,250,0,23,0,43,0,0,1,22,22,51,51,50,30,
+2,21,20,6,6,35,34,38,38,53,17,35,53,33,21,33,7,22,21,17,20,22,22,51,50,54,
+54,53,52,38,38,35,35,34,38,38,1,69,61,145,113,61,83,87,58,29,137,244,143,
+97,117,56,189,4,31,253,59,4,4,23,54,49,90,164,94,25,47,52,12,91,103,110,4,
+66,78,59,29,54,83,54,106,223,149,68,111,122,2,60,146,146,199,55,50,254,250,
+72,62,32,101,148,65,36,41,20,22,60,0,255,255,255,235,253,213,5,147,4,250,
+2,34,0,25,0,0,0,3,0,64,4,119,0,0,255,255,255,235,253,213,7,106,4,250,2,34,
+0,26,0,0,0,3,0,64,5,242,0,0,255,255,255,235,253,213,6,111,5,129,2,34,0,27,
+0,0,0,3,0,64,4,175,0,0,255,255,0,94,253,213,7,184,5,6,2,34,0,28,0,0,0,3,0,
+64,6,37,0,0,0,2,255,235,0,255,4,10,7,86,0,55,0,56,0,0,1,21,33,17,20,22,22,
+51,50,54,54,53,52,35,34,7,39,54,51,50,22,21,20,6,6,35,34,38,38,53,17,35,53,
+33,38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,1,4,10,
+253,59,18,55,55,79,154,116,118,58,44,21,79,78,118,126,131,246,146,98,122,
+51,189,3,22,4,75,84,153,191,171,79,11,151,9,55,112,110,120,123,146,81,5,253,
+232,4,250,146,253,202,61,68,37,83,157,82,102,11,139,20,121,112,106,218,156,
+72,115,113,2,61,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,2,
+92,255,255,255,235,253,213,4,207,7,86,2,34,0,30,0,0,0,3,0,64,3,206,0,0,0,
+1,255,235,1,24,4,255,4,250,0,37,0,0,1,20,22,51,50,54,55,55,22,21,20,6,35,
+32,0,3,55,18,18,51,50,54,53,52,39,6,6,35,34,38,38,53,53,33,53,33,21,33,2,
+143,38,26,53,110,75,117,125,241,207,254,254,254,177,99,151,81,255,200,139,
+159,40,72,152,81,70,92,39,253,249,5,20,253,144,3,100,52,33,93,103,19,173,
+169,168,208,1,92,1,88,42,254,213,254,228,120,108,88,73,91,91,63,97,83,247,
+146,146,0,0,1,255,235,0,255,4,10,4,250,0,32,0,0,1,39,54,51,50,22,21,20,6,
+6,35,34,38,38,53,17,35,53,33,21,33,17,20,22,22,51,50,54,54,53,52,35,34,2,
+70,21,79,78,118,126,131,246,146,98,122,51,189,4,31,253,59,18,55,55,79,154,
+116,118,58,3,41,139,20,121,112,106,218,156,72,115,113,2,61,146,146,253,202,
+61,68,37,83,157,82,102,0,1,0,92,2,176,3,162,5,7,0,19,0,0,1,7,38,38,35,34,
+6,21,20,22,23,7,38,38,53,52,54,51,50,22,3,162,114,108,193,93,73,89,72,77,
+79,117,121,175,122,142,219,3,190,101,143,138,73,66,55,78,32,146,52,166,100,
+128,153,129,255,255,255,235,253,213,5,188,4,250,2,34,0,34,0,0,0,3,0,64,4,
+194,0,0,255,255,0,78,253,213,6,16,5,129,2,34,0,35,0,0,0,3,0,64,5,40,0,0,0,
+1,255,235,0,241,4,81,4,250,0,24,0,0,3,53,33,21,33,17,54,36,55,23,6,21,20,
+23,7,38,38,53,52,55,6,4,7,39,17,21,4,102,252,244,130,1,27,154,119,79,55,152,
+29,34,45,133,254,242,136,110,4,104,146,146,254,139,97,140,44,119,134,196,
+154,159,33,85,189,78,175,92,48,165,117,70,2,16,255,255,0,75,253,213,5,173,
+5,8,2,34,0,37,0,0,0,3,0,64,4,197,0,0,0,2,255,235,1,149,3,109,4,250,0,3,0,
+23,0,0,3,53,33,21,3,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,
+21,3,28,6,93,175,77,74,88,72,77,73,118,126,176,130,117,212,148,4,104,146,
+146,254,31,104,105,75,65,55,78,32,146,51,165,102,127,154,107,141,0,3,0,45,
+1,244,4,212,5,8,0,19,0,32,0,33,0,0,1,38,39,1,39,55,54,53,52,38,35,34,7,39,
+54,36,51,50,4,19,5,21,20,7,37,38,35,34,7,54,51,50,22,1,4,92,87,59,253,227,
+107,62,54,53,50,77,67,146,146,1,7,141,164,1,14,207,253,104,1,1,42,121,144,
+185,178,63,68,96,104,254,245,2,229,121,68,254,82,123,45,54,63,48,55,40,145,
+155,140,184,254,244,12,14,7,6,236,105,153,31,104,254,227,0,255,255,255,235,
+253,213,6,201,4,250,2,34,0,40,0,0,0,3,0,64,4,251,0,0,0,2,255,235,0,255,4,
+42,4,250,0,14,0,23,0,0,1,17,35,38,36,39,39,54,36,55,53,33,53,33,21,5,6,6,
+7,22,22,23,38,53,3,153,157,98,254,206,208,77,175,1,89,169,252,239,4,63,254,
+210,123,242,119,145,246,100,7,4,104,252,151,146,172,26,184,86,134,49,76,146,
+146,228,37,90,54,30,133,102,130,41,255,255,255,235,253,213,5,217,4,250,2,
+34,0,42,0,0,0,3,0,64,4,64,0,0,0,2,255,236,2,7,4,165,4,250,0,31,0,44,0,0,1,
+22,21,20,6,35,34,38,39,38,38,35,34,6,21,20,23,7,38,53,52,54,51,51,50,23,38,
+39,35,53,33,21,33,33,22,22,21,21,23,22,22,51,50,53,52,4,13,69,152,144,86,
+146,98,63,51,30,37,45,74,112,130,134,102,9,4,4,27,138,194,4,185,254,176,254,
+71,46,44,68,84,92,50,154,4,104,107,116,141,150,59,75,47,22,37,37,55,57,112,
+105,132,96,111,1,122,44,146,146,39,104,80,3,46,61,35,145,109,0,255,255,255,
+235,253,213,5,234,4,250,2,34,0,44,0,0,0,3,0,64,5,2,0,0,0,2,255,235,1,100,
+4,194,4,250,0,3,0,37,0,0,3,53,33,21,3,38,35,34,6,21,20,23,7,38,38,35,34,6,
+21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,23,21,4,117,21,88,
+108,52,71,5,133,19,128,82,74,88,96,121,55,165,164,183,130,94,138,61,26,98,
+61,93,152,88,4,104,146,146,254,73,130,65,61,22,27,7,97,114,74,63,70,95,39,
+151,50,182,133,117,158,66,76,52,58,80,99,0,1,255,238,2,102,4,183,5,8,0,37,
+0,0,3,54,51,50,22,23,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,7,38,38,
+39,6,6,35,39,54,54,53,52,38,35,34,7,18,94,82,104,162,39,35,145,102,126,212,
+124,121,105,153,84,84,95,142,138,14,139,181,41,40,186,133,13,133,140,112,
+104,76,81,4,245,19,94,86,88,92,144,176,94,156,108,92,82,88,97,7,158,8,100,
+92,95,105,158,2,101,83,86,94,22,0,3,255,235,2,28,4,30,4,250,0,17,0,26,0,35,
+0,0,1,22,21,20,6,6,35,34,38,53,52,55,6,35,35,53,33,21,5,22,23,54,53,52,38,
+35,34,19,38,39,6,21,20,22,51,50,3,143,63,123,224,132,179,222,99,35,83,96,
+4,51,253,75,245,185,29,130,128,119,249,201,225,18,139,121,106,4,104,81,119,
+114,176,98,192,161,138,99,2,146,146,42,108,154,54,58,95,104,254,107,159,94,
+40,50,95,112,0,2,255,236,2,102,5,135,4,250,0,26,0,35,0,0,1,22,21,20,6,35,
+34,38,39,6,6,35,34,38,39,55,30,2,51,50,54,55,33,53,33,21,33,33,22,22,51,50,
+54,53,52,4,239,69,164,145,124,189,57,36,126,88,101,150,77,126,35,57,50,38,
+87,82,4,253,194,5,155,254,176,254,130,41,165,123,72,78,4,104,107,116,137,
+154,125,121,120,126,116,123,75,61,67,27,179,176,146,146,184,184,76,69,109,
+0,255,255,255,235,253,213,4,145,4,250,2,34,0,50,0,0,0,3,0,64,3,169,0,0,255,
+255,255,235,253,213,5,173,4,250,2,34,0,84,0,0,0,3,0,64,4,197,0,0,255,255,
+255,235,253,213,5,173,4,250,2,34,0,85,0,0,0,3,0,64,4,197,0,0,255,255,255,
+236,253,213,7,175,4,250,2,34,0,125,0,0,0,3,0,64,5,231,0,0,255,255,255,235,
+253,213,7,223,4,250,2,34,0,126,0,0,0,3,0,64,5,57,0,0,255,255,255,235,253,
+213,6,138,4,250,2,34,0,19,0,0,0,35,0,64,4,178,0,0,0,3,2,64,4,9,1,107,255,
+255,0,100,253,213,6,121,5,129,2,34,0,20,0,0,0,35,0,64,5,145,0,0,0,3,2,64,
+4,164,1,107,255,255,0,46,253,213,6,40,5,129,2,34,0,21,0,0,0,35,0,64,5,64,
+0,0,0,3,0,51,4,52,1,62,255,255,255,235,253,213,5,245,4,250,2,34,0,22,0,0,
+0,35,0,64,5,13,0,0,0,3,2,64,4,19,1,107,255,255,0,59,253,213,6,87,5,8,2,34,
+0,23,0,0,0,35,0,64,5,111,0,0,0,3,0,51,5,113,0,0,255,255,255,235,253,213,5,
+30,4,250,2,34,0,24,0,0,0,35,0,64,4,54,0,0,0,3,0,51,4,75,0,0,255,255,255,235,
+253,213,5,147,4,250,2,34,0,25,0,0,0,35,0,64,4,139,0,0,0,3,0,51,4,103,0,72,
+255,255,255,235,253,213,7,106,4,250,2,34,0,26,0,0,0,35,0,64,6,26,0,0,0,3,
+0,51,5,251,0,80,255,255,255,235,253,213,6,111,5,129,2,34,0,27,0,0,0,35,0,
+64,4,175,0,0,0,3,2,64,4,19,1,107,255,255,0,94,253,213,7,184,5,6,2,34,0,28,
+0,0,0,35,0,64,6,37,0,0,0,3,0,51,5,189,0,80,255,255,255,235,253,213,5,30,7,
+86,2,34,0,29,0,0,0,35,0,51,4,75,0,0,0,3,0,64,4,54,0,0,255,255,255,235,253,
+213,5,52,7,86,2,34,0,30,0,0,0,35,0,64,4,76,0,0,0,3,0,51,4,54,0,0,255,255,
+255,235,255,161,4,255,4,250,2,34,0,142,0,0,0,3,0,51,5,52,1,24,255,255,255,
+235,255,149,4,10,4,250,2,34,0,143,0,0,0,3,0,51,4,141,1,12,255,255,0,92,253,
+213,5,186,5,129,2,34,0,33,0,0,0,35,0,64,4,210,0,0,0,3,2,64,4,88,1,109,255,
+255,255,235,253,213,6,44,4,250,2,34,0,34,0,0,0,35,0,64,5,68,0,0,0,3,0,51,
+5,36,0,50,255,255,0,78,253,213,6,16,5,129,2,34,0,35,0,0,0,35,0,64,5,40,0,
+0,0,3,2,64,4,72,1,107,255,255,255,235,253,213,5,177,4,250,2,34,0,36,0,0,0,
+35,0,64,4,201,0,0,0,3,0,51,4,181,0,122,255,255,0,75,253,213,5,173,5,8,2,34,
+0,37,0,0,0,35,0,64,4,197,0,0,0,3,2,64,4,19,1,107,255,255,255,235,253,213,
+5,188,4,250,2,34,0,38,0,0,0,35,0,64,4,212,0,0,0,3,0,51,4,100,0,188,255,255,
+0,45,253,213,6,163,5,129,2,34,0,39,0,0,0,35,0,64,5,187,0,0,0,3,2,64,4,177,
+1,107,255,255,255,235,253,213,6,201,4,250,2,34,0,40,0,0,0,35,2,64,4,7,1,107,
+0,3,0,64,4,251,0,0,255,255,255,235,253,213,5,172,4,250,2,34,0,41,0,0,0,35,
+0,64,4,196,0,0,0,3,2,64,4,19,1,107,255,255,255,235,253,213,5,217,4,250,2,
+34,0,42,0,0,0,35,0,64,4,175,0,0,0,3,0,51,4,148,0,100,255,255,255,235,253,
+213,5,225,4,250,2,34,0,43,0,0,0,35,0,64,4,249,0,0,0,3,0,51,4,100,0,118,255,
+255,255,235,253,213,5,234,4,250,2,34,0,44,0,0,0,35,0,64,5,2,0,0,0,3,2,64,
+4,8,1,107,255,255,255,235,253,213,6,194,4,250,2,34,0,46,0,0,0,35,0,64,5,218,
+0,0,0,3,2,64,5,63,1,107,255,255,255,238,253,213,6,82,5,129,2,34,0,47,0,0,
+0,35,0,64,5,106,0,0,0,3,2,64,4,140,1,107,255,255,255,235,253,213,5,248,4,
+250,2,34,0,48,0,0,0,35,0,64,5,16,0,0,0,3,2,64,4,8,1,107,255,255,255,235,253,
+213,6,93,4,250,2,34,0,49,0,0,0,35,0,64,5,117,0,0,0,3,0,51,4,102,0,251,255,
+255,255,235,253,213,4,145,4,250,2,34,0,50,0,0,0,35,0,64,3,169,0,0,0,3,0,51,
+3,251,0,152,255,255,255,235,253,213,5,173,4,250,2,34,0,84,0,0,0,35,0,64,4,
+197,0,0,0,3,2,64,4,19,1,107,255,255,255,235,253,213,5,173,4,250,2,34,0,85,
+0,0,0,35,0,64,4,197,0,0,0,3,0,51,3,184,0,198,0,1,255,192,255,149,2,31,4,250,
+0,28,0,0,3,33,21,35,6,6,21,20,23,22,21,20,6,6,7,39,62,3,53,52,39,38,53,52,
+54,55,33,21,2,52,73,69,77,34,34,97,186,129,44,84,122,62,27,34,34,55,64,254,
+209,4,250,146,61,129,129,71,149,149,101,137,174,108,27,142,20,59,73,87,71,
+92,144,145,79,107,143,73,0,3,255,236,0,0,7,133,4,250,0,3,0,79,0,80,0,0,3,
+53,33,21,1,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,23,17,52,38,38,35,34,6,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,
+54,51,50,22,22,21,21,20,7,54,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,
+6,3,20,7,153,253,114,153,23,101,83,68,114,114,65,237,219,20,155,18,134,150,
+59,109,109,65,164,73,25,67,57,72,139,88,53,54,42,49,14,50,86,106,131,131,
+215,116,102,132,70,3,62,138,87,123,152,159,159,49,106,106,74,62,73,131,221,
+4,104,146,146,253,135,254,17,93,85,17,18,197,195,88,99,23,65,91,125,124,18,
+17,111,2,40,69,64,33,73,117,49,43,37,7,144,16,114,103,91,190,119,61,106,105,
+28,35,36,84,76,141,112,122,170,48,147,27,88,61,62,66,115,2,149,0,4,0,94,252,
+218,5,166,5,129,0,69,0,70,0,71,0,72,0,0,1,35,17,35,38,38,35,34,7,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,36,39,39,54,54,53,52,
+39,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,55,22,21,20,6,7,22,4,23,
+38,53,17,51,23,51,33,19,7,5,166,215,153,29,117,96,57,118,118,68,175,206,19,
+157,16,107,115,57,99,98,57,192,95,142,254,145,225,49,238,239,47,67,174,107,
+125,148,45,157,36,56,51,88,134,52,112,163,209,197,179,1,25,102,4,108,47,217,
+254,15,143,100,4,104,250,168,94,84,17,18,161,157,68,67,19,58,52,91,86,18,
+17,121,36,203,244,41,189,18,139,120,79,63,108,107,129,113,84,80,44,56,56,
+51,53,122,104,28,154,165,147,196,41,50,190,140,54,143,3,246,135,247,236,12,
+0,2,0,94,255,167,5,230,5,129,0,67,0,68,0,0,1,17,35,38,38,35,34,7,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,17,38,38,35,34,6,7,54,51,
+50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,38,38,53,
+53,51,23,51,21,37,5,15,153,28,117,83,67,122,122,68,218,223,19,157,16,138,
+146,59,109,109,65,90,119,49,136,205,113,83,137,70,74,120,123,142,148,165,
+104,142,111,73,61,48,90,61,165,102,236,139,133,225,119,1,6,108,47,217,254,
+15,4,104,251,63,86,92,17,18,193,188,95,57,19,55,80,117,115,18,17,55,56,2,
+163,186,152,79,101,39,141,101,117,181,93,149,62,108,64,48,59,22,29,134,178,
+173,131,144,26,92,68,210,135,146,146,0,5,255,235,252,218,5,154,4,250,0,42,
+0,60,0,61,0,62,0,63,0,0,5,53,38,36,39,39,54,55,38,38,53,52,55,33,53,33,21,
+35,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,
+3,6,6,7,22,4,23,38,53,17,33,6,21,20,22,51,50,55,5,1,55,4,38,114,254,135,209,
+73,109,129,142,151,66,254,191,5,175,215,153,27,115,97,56,117,117,66,174,203,
+19,157,16,103,116,56,97,96,57,189,83,106,205,100,179,1,32,125,4,253,202,96,
+95,83,109,111,254,27,2,187,128,36,36,153,200,14,178,82,80,14,132,107,93,75,
+146,146,250,168,91,87,17,18,155,149,65,64,19,55,47,84,81,18,17,2,184,64,139,
+74,34,146,135,118,30,3,23,70,92,67,72,76,212,250,39,12,0,0,4,0,59,254,72,
+5,86,5,8,0,78,0,89,0,90,0,91,0,0,5,17,6,35,34,36,2,3,55,18,18,22,51,50,54,
+53,52,39,6,35,34,38,38,53,53,38,39,55,22,23,54,54,51,50,22,21,20,6,35,34,
+39,21,20,22,51,50,54,55,55,22,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,
+52,55,23,6,21,20,22,51,50,55,54,51,50,1,22,51,50,54,53,52,38,35,34,6,55,1,
+4,96,114,147,212,254,216,215,77,156,67,169,233,172,168,189,49,175,165,80,
+114,48,194,147,126,127,105,33,181,120,120,144,179,136,79,71,44,42,71,138,
+96,124,119,45,44,153,29,122,101,59,124,125,69,184,216,24,157,21,113,122,59,
+106,105,67,193,254,230,68,78,77,83,61,51,77,101,35,1,75,226,1,36,47,195,1,
+139,1,37,43,254,252,254,169,168,141,122,96,87,194,70,119,106,166,97,207,85,
+165,71,117,131,120,105,113,135,17,141,62,52,96,110,6,187,172,74,126,53,253,
+151,92,86,17,18,185,176,85,94,19,82,77,109,106,18,17,4,63,21,61,53,41,46,
+99,221,251,6,0,0,4,255,235,255,167,5,174,4,250,0,79,0,90,0,91,0,92,0,0,1,
+23,22,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,
+50,55,54,51,50,22,23,53,52,55,6,35,34,0,3,55,18,18,51,50,54,53,52,39,6,6,
+35,34,38,53,52,55,6,35,33,53,33,21,33,22,21,20,6,35,34,39,6,21,20,22,51,50,
+54,37,22,51,50,54,53,52,38,35,34,6,55,1,4,95,112,66,34,34,153,61,110,77,47,
+115,115,70,176,211,24,157,21,110,119,57,101,100,59,75,131,66,2,104,145,244,
+254,169,99,151,81,255,204,149,166,13,70,154,101,117,137,91,63,94,254,4,5,
+195,254,200,8,150,135,83,80,2,52,57,70,146,254,216,68,70,69,74,52,45,59,97,
+22,1,37,3,100,5,126,128,58,102,44,254,18,75,53,17,18,157,150,74,77,19,63,
+61,84,84,18,17,56,63,135,47,47,41,1,80,1,80,43,254,223,254,236,110,102,40,
+46,61,73,154,125,170,115,5,146,146,26,30,100,116,23,26,25,61,57,76,213,20,
+53,47,39,40,84,200,251,6,0,0,7,255,235,252,218,5,124,4,250,0,53,0,72,0,73,
+0,74,0,75,0,76,0,77,0,0,1,22,22,51,51,50,22,22,21,20,6,7,17,35,38,38,35,34,
+7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,52,55,6,6,35,
+34,38,38,53,17,33,53,33,21,33,7,22,21,17,20,22,22,51,50,54,54,53,52,38,35,
+35,34,38,38,19,1,3,3,7,2,59,74,173,141,34,98,116,71,50,49,153,26,113,92,54,
+113,114,64,167,199,24,157,21,101,111,54,93,92,55,190,82,3,74,159,84,93,126,
+75,254,77,5,145,252,191,2,2,26,63,56,100,186,113,58,83,11,96,127,126,129,
+1,23,210,10,2,4,88,131,95,41,107,88,76,149,73,253,26,93,85,17,18,195,187,
+91,97,19,88,84,115,117,18,17,111,210,86,72,56,56,65,129,135,2,207,146,146,
+224,30,40,254,118,93,79,42,127,190,85,54,53,34,75,1,174,251,6,252,218,2,43,
+79,0,0,8,255,235,252,218,6,37,4,250,0,76,0,92,0,93,0,94,0,95,0,96,0,97,0,
+98,0,0,1,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,23,53,38,37,55,22,51,50,36,53,52,38,39,22,21,20,6,6,35,34,38,38,53,17,
+33,53,33,21,33,21,22,22,51,51,55,54,51,50,22,22,21,20,6,7,22,4,23,7,38,39,
+22,21,1,22,21,21,20,22,22,51,50,54,53,52,38,35,35,34,19,19,3,3,7,3,4,139,
+153,25,109,91,53,110,110,63,164,191,19,157,16,96,108,52,90,90,53,184,79,249,
+254,193,19,141,141,244,1,10,99,93,10,119,211,126,85,122,70,254,157,6,58,251,
+198,63,144,110,100,24,49,31,126,177,91,195,178,121,1,1,136,72,137,180,5,253,
+93,3,22,53,57,121,168,37,69,13,187,240,160,164,10,2,97,254,182,91,87,17,18,
+183,176,79,71,19,71,60,106,106,18,17,111,205,72,32,146,27,182,141,89,113,
+16,30,29,97,161,92,50,117,124,1,137,146,146,15,76,52,1,3,92,169,93,162,214,
+42,27,98,70,123,76,65,57,55,4,7,64,34,125,61,55,34,129,72,27,32,1,172,251,
+6,252,218,2,43,79,1,240,0,6,255,235,252,218,7,106,4,250,0,91,0,92,0,93,0,
+94,0,95,0,96,0,0,1,22,22,51,50,55,23,6,6,21,20,22,23,7,39,46,2,35,34,6,7,
+6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,54,51,50,22,23,38,53,16,55,
+38,36,39,6,6,21,20,22,51,50,54,55,23,22,21,20,6,35,32,0,3,55,18,0,51,50,54,
+53,52,39,6,6,35,34,38,53,52,54,55,6,35,33,53,33,21,37,19,1,7,1,4,114,53,201,
+147,51,60,81,64,57,49,53,154,94,45,85,89,53,52,120,95,184,155,217,225,16,
+157,13,140,146,145,171,85,121,58,86,156,98,60,97,205,254,241,84,141,160,59,
+48,66,119,93,177,42,242,226,254,233,254,138,110,157,98,1,32,226,150,156,16,
+81,153,84,123,148,142,133,57,137,253,137,7,127,253,246,174,254,54,100,1,118,
+4,104,94,93,6,144,117,238,158,136,252,147,35,57,27,34,17,23,24,48,191,187,
+79,71,24,55,76,111,111,48,23,24,49,63,228,216,1,23,178,1,135,151,71,146,87,
+51,55,57,82,63,103,125,179,212,1,160,1,150,45,254,145,254,167,132,133,58,
+51,70,62,140,120,103,180,62,3,146,146,146,251,6,252,230,12,2,54,0,5,255,235,
+252,218,6,247,5,129,0,53,0,62,0,63,0,64,0,65,0,0,1,22,22,23,38,53,17,51,23,
+51,21,35,17,35,38,39,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,55,54,51,50,23,53,38,0,39,39,54,36,55,53,33,53,33,3,6,4,7,22,4,23,38,
+53,1,3,7,4,118,77,155,43,6,108,47,217,215,157,92,177,153,25,109,91,52,103,
+104,66,165,179,19,157,16,93,102,49,87,86,50,175,88,95,254,132,219,80,213,
+1,131,174,252,18,4,139,157,147,254,221,145,171,1,78,85,7,1,45,194,100,2,129,
+48,155,75,67,97,3,114,135,146,252,46,184,139,253,55,91,87,17,18,162,156,68,
+67,19,58,52,91,86,18,17,121,36,190,1,22,30,197,125,182,57,69,146,254,137,
+52,138,86,35,223,143,83,83,3,118,247,236,12,255,255,0,94,254,34,7,184,5,6,
+2,34,0,28,0,0,0,3,0,128,6,33,0,0,0,6,255,235,252,218,5,124,7,86,0,86,0,87,
+0,88,0,89,0,90,0,91,0,0,1,39,54,51,50,22,21,20,6,7,17,35,38,38,35,34,7,6,
+35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,52,55,6,6,35,34,38,
+38,53,17,33,53,33,38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,
+22,22,23,51,21,33,17,20,22,22,51,50,18,53,52,38,35,34,19,1,1,3,7,3,102,23,
+79,90,125,137,50,49,153,26,113,92,54,113,114,64,167,199,24,157,21,101,111,
+54,93,92,55,190,82,3,73,159,85,93,126,75,254,77,4,26,4,75,84,193,191,171,
+79,11,151,9,55,112,110,160,123,146,81,5,227,252,191,19,64,63,147,254,70,72,
+46,92,253,192,1,140,10,2,2,253,146,21,149,139,75,148,72,253,29,93,85,17,18,
+195,187,91,97,19,88,84,115,117,18,17,111,248,45,74,56,55,65,129,135,2,207,
+146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,146,253,80,75,89,
+50,1,6,152,72,67,252,245,7,86,245,132,2,43,79,0,0,6,255,235,252,218,5,231,
+7,86,0,65,0,79,0,80,0,81,0,82,0,83,0,0,3,53,33,38,38,53,52,54,55,23,6,6,21,
+20,22,23,33,21,33,34,39,22,18,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,
+52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,6,6,35,34,36,39,55,54,54,53,52,
+39,23,22,21,20,6,7,22,22,51,50,54,53,52,38,19,3,3,7,21,2,199,80,67,88,95,
+105,67,59,74,96,2,124,254,155,66,59,184,149,67,67,153,29,119,95,57,119,119,
+68,176,209,24,157,21,108,117,57,99,99,58,199,90,51,112,61,166,254,246,61,
+45,209,211,43,153,32,220,219,41,168,114,167,185,131,5,229,10,2,4,104,146,
+104,145,67,79,140,69,114,51,90,58,55,128,108,146,4,171,254,236,148,105,166,
+61,253,173,94,84,17,18,195,187,91,97,19,88,84,117,115,18,17,103,1,26,17,17,
+170,146,161,18,179,182,96,96,81,98,101,170,219,49,82,91,173,139,131,231,252,
+113,252,218,2,43,79,0,6,255,235,252,218,5,200,4,250,0,70,0,71,0,72,0,73,0,
+74,0,75,0,0,1,20,22,22,51,50,54,55,55,22,21,20,6,7,17,35,38,38,35,34,7,6,
+35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,52,55,6,6,35,32,0,
+3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,38,53,17,33,53,33,21,33,55,1,1,3,
+7,2,216,13,35,28,61,134,85,122,138,45,44,153,29,117,96,57,119,119,67,175,
+209,24,157,21,108,116,57,99,99,57,200,88,2,54,128,74,254,224,254,127,112,
+155,96,1,44,232,159,188,55,81,168,79,78,110,47,253,176,5,221,253,16,21,1,
+93,255,0,10,2,2,250,45,41,29,115,124,20,197,195,80,134,55,253,101,94,84,17,
+18,184,177,85,94,19,82,77,108,107,18,17,111,248,64,24,25,24,1,181,1,180,42,
+254,124,254,140,152,126,124,81,113,108,70,120,104,1,82,146,146,146,251,6,
+252,218,2,43,79,0,0,6,255,235,252,218,5,124,4,250,0,63,0,64,0,65,0,66,0,67,
+0,68,0,0,1,39,54,51,50,22,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,
+55,23,6,21,20,22,51,50,55,54,51,50,23,53,52,55,6,6,35,34,38,38,53,17,33,53,
+33,21,33,17,20,22,22,51,50,18,53,52,38,35,34,3,1,3,3,7,3,102,23,79,90,125,
+137,50,49,153,26,113,92,54,113,114,64,167,199,24,157,21,101,111,54,93,92,
+55,190,82,3,73,159,85,93,126,75,254,77,5,145,252,191,19,64,63,147,254,70,
+72,46,187,1,23,180,10,2,2,253,146,21,149,139,75,148,72,253,29,93,85,17,18,
+195,187,91,97,19,88,84,115,117,18,17,111,248,45,74,56,55,65,129,135,2,207,
+146,146,253,80,75,89,50,1,6,152,72,67,1,239,251,6,252,218,2,43,79,0,2,0,94,
+255,167,5,18,5,129,0,53,0,54,0,0,1,38,53,53,51,23,51,21,35,17,35,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,38,38,35,34,
+6,21,20,22,23,7,38,38,53,52,54,51,50,22,39,3,165,7,108,47,217,215,153,23,
+99,83,48,101,101,57,149,175,19,157,16,88,94,45,83,83,51,156,72,119,223,104,
+81,96,86,91,79,130,136,191,140,126,222,13,3,246,126,60,209,135,146,251,63,
+92,86,17,18,162,156,68,67,19,58,52,90,87,18,17,111,2,172,164,165,83,72,61,
+89,35,146,54,175,108,136,163,130,116,0,3,255,236,0,0,5,205,4,250,0,53,0,57,
+0,58,0,0,1,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,23,17,52,38,38,35,34,6,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,
+54,51,50,22,22,37,53,33,21,37,4,247,153,23,101,83,65,119,119,76,219,219,20,
+155,18,134,150,59,109,109,65,164,73,25,67,57,72,139,88,53,54,42,49,14,50,
+86,106,131,131,215,116,102,132,70,250,245,5,225,254,141,3,41,252,215,93,85,
+17,18,196,197,87,99,23,65,91,125,124,18,17,111,2,40,69,64,33,73,117,49,43,
+37,7,144,16,114,103,91,190,119,61,106,214,146,146,146,0,0,4,0,94,252,218,
+5,128,5,129,0,64,0,65,0,66,0,67,0,0,1,35,17,35,38,38,35,34,7,6,35,34,38,53,
+52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,36,39,39,54,54,53,52,38,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,22,4,23,38,53,17,51,23,51,
+33,19,7,5,128,215,153,25,109,91,55,115,115,66,172,198,19,157,16,104,113,55,
+95,95,57,175,88,142,254,145,225,47,232,233,113,112,92,99,70,90,139,192,162,
+181,206,209,194,181,1,22,98,4,108,47,217,254,15,181,100,4,104,250,168,91,
+87,17,18,162,156,68,67,19,58,52,91,86,18,17,121,36,203,244,41,189,17,138,
+122,89,94,72,54,63,34,128,91,140,115,149,182,149,139,195,38,53,190,137,54,
+143,3,246,135,247,236,12,0,0,4,255,235,255,136,5,216,4,250,0,53,0,54,0,55,
+0,56,0,0,3,53,33,21,33,17,54,36,55,23,6,6,21,20,22,23,7,38,38,35,34,6,7,6,
+35,34,38,38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,23,38,53,52,54,55,
+6,4,7,39,17,37,19,7,21,5,237,252,93,124,1,67,200,133,55,52,30,41,154,27,136,
+101,48,98,51,131,74,112,185,98,19,157,16,112,106,45,89,51,126,81,135,107,
+28,40,34,151,254,200,160,121,1,225,253,112,4,104,146,146,253,230,129,203,
+74,132,92,213,158,130,208,144,39,89,89,17,10,28,79,153,106,68,67,19,58,52,
+98,99,16,12,27,84,144,191,96,193,67,66,227,161,82,2,176,146,251,6,89,0,4,
+0,94,252,218,5,98,5,8,0,54,0,63,0,64,0,65,0,0,5,35,38,38,35,34,7,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,0,39,39,54,55,38,53,
+52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,55,53,33,21,35,7,6,4,7,22,4,23,
+38,53,19,7,4,139,153,25,109,91,53,110,110,63,165,190,19,157,16,97,107,52,
+90,90,53,175,88,100,254,131,234,80,144,135,130,142,125,60,49,13,32,41,62,
+66,51,54,186,193,1,116,215,157,168,254,210,134,189,1,80,86,7,86,100,240,91,
+87,17,18,162,156,68,67,19,58,52,90,87,18,17,121,36,191,1,12,39,197,85,67,
+96,130,93,122,10,147,4,50,42,43,60,27,85,61,215,146,229,58,138,80,43,215,
+143,83,83,251,98,12,0,1,255,235,255,167,5,98,4,250,0,53,0,0,1,38,53,53,33,
+53,33,21,35,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,23,17,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,3,242,
+4,251,253,5,119,215,153,25,109,91,53,110,110,63,165,190,19,157,16,97,107,
+52,90,90,53,184,79,89,177,78,74,88,72,77,73,118,126,175,122,100,184,3,36,
+48,80,196,146,146,251,63,91,87,17,18,162,156,68,67,19,58,52,90,87,18,17,111,
+1,249,99,109,75,65,55,78,32,146,51,165,102,128,153,86,0,4,0,92,255,167,6,
+32,5,129,0,52,0,67,0,68,0,69,0,0,5,35,38,35,34,7,6,35,34,38,53,52,55,23,6,
+21,20,22,51,50,55,54,51,50,23,17,38,39,1,39,55,54,53,52,38,35,34,7,39,54,
+36,51,50,22,23,38,53,17,51,23,51,21,35,1,54,55,55,38,38,35,34,6,7,54,51,50,
+22,21,1,1,5,73,153,59,169,67,138,138,78,229,230,19,157,16,145,153,62,129,
+129,68,167,91,74,48,253,237,122,63,44,62,59,63,63,156,146,1,7,141,147,238,
+143,7,109,46,217,215,253,80,48,58,204,70,135,79,101,178,90,58,57,108,120,
+1,150,253,103,89,178,17,18,193,188,95,57,19,55,80,117,115,18,17,111,2,104,
+104,57,254,9,114,59,63,67,54,60,38,148,191,171,149,185,72,116,1,11,135,146,
+254,97,51,55,192,66,61,104,111,29,120,103,2,33,253,20,0,0,5,255,235,252,218,
+7,71,4,250,0,74,0,75,0,76,0,77,0,78,0,0,5,35,38,38,35,34,7,6,35,34,38,53,
+52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,36,37,39,54,54,55,38,38,39,
+55,33,53,33,21,33,22,22,23,23,6,6,7,22,4,23,38,53,17,51,50,4,22,21,20,6,35,
+34,39,55,22,51,50,54,53,52,38,39,3,17,19,7,4,170,153,25,114,94,55,113,113,
+65,171,197,19,157,16,102,111,54,93,94,55,183,94,146,254,172,255,0,74,77,209,
+132,85,209,124,45,254,222,7,92,250,93,108,219,68,10,134,205,71,196,1,38,136,
+4,27,208,1,48,172,147,133,76,43,10,35,35,78,81,212,182,157,55,100,240,91,
+87,17,18,162,156,68,67,19,58,52,91,86,18,17,124,41,191,199,42,186,52,116,
+64,63,88,26,99,146,146,38,137,69,114,60,103,43,46,167,149,118,30,2,182,116,
+210,129,121,145,10,147,4,58,72,105,158,19,1,130,251,6,252,230,12,0,0,4,255,
+235,252,218,5,98,4,250,0,39,0,48,0,49,0,50,0,0,5,35,38,38,35,34,7,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,0,39,39,54,36,55,53,
+33,53,33,21,35,7,6,4,7,22,4,23,38,53,19,7,4,139,153,25,109,91,53,110,110,
+63,165,190,19,157,16,97,107,52,90,90,53,175,88,100,254,131,234,80,207,1,142,
+190,251,253,5,119,215,157,168,254,210,134,189,1,80,86,7,86,100,240,91,87,
+17,18,162,156,68,67,19,58,52,90,87,18,17,121,36,191,1,12,39,197,122,182,60,
+69,146,146,229,58,138,80,43,215,143,83,83,251,98,12,0,0,2,255,235,0,0,5,186,
+4,250,0,3,0,50,0,0,3,53,33,21,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,
+6,21,20,22,51,50,55,54,51,50,23,17,52,55,6,6,35,34,38,53,52,55,23,6,21,20,
+22,51,50,54,55,21,5,207,215,153,22,98,83,63,117,118,74,215,214,20,155,18,
+129,148,59,106,105,64,161,71,5,81,166,109,128,149,47,162,38,58,53,90,143,
+64,4,104,146,146,200,252,96,91,87,17,18,196,197,87,99,23,65,91,124,125,18,
+17,111,1,194,73,51,113,98,129,113,83,89,49,60,55,51,53,130,115,0,4,255,236,
+0,0,5,195,4,250,0,60,0,74,0,75,0,76,0,0,1,38,53,52,54,51,51,50,23,38,39,33,
+53,33,21,35,22,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,
+20,22,51,50,55,54,51,50,23,17,6,35,34,38,39,38,38,35,34,6,21,20,23,1,33,22,
+22,21,21,23,22,22,51,50,54,53,52,3,17,1,166,130,134,102,9,4,4,27,138,254,
+112,5,215,232,69,31,31,153,29,119,98,57,123,124,75,174,204,19,157,16,106,
+113,63,103,103,58,204,89,36,41,86,146,98,63,51,30,37,45,74,2,13,254,71,46,
+44,68,84,92,50,77,77,63,2,7,105,132,96,111,1,122,44,146,146,107,116,64,100,
+37,253,64,94,84,17,18,162,156,68,67,19,58,52,90,87,18,17,111,1,150,6,59,75,
+47,22,37,37,55,57,1,241,39,104,80,3,46,61,35,72,73,109,1,4,251,6,0,0,4,255,
+235,252,218,5,149,4,250,0,42,0,56,0,57,0,58,0,0,3,33,21,35,17,35,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,36,39,39,
+54,54,55,38,38,39,55,33,1,6,6,7,22,4,23,38,53,17,33,22,22,23,1,7,21,5,170,
+215,153,26,116,96,56,115,116,66,174,202,19,157,16,104,114,55,96,97,56,187,
+94,151,254,146,242,74,77,209,132,85,209,124,45,254,222,3,78,134,205,71,190,
+1,59,141,4,253,131,108,219,68,1,21,100,4,250,146,250,168,91,87,17,18,161,
+156,69,67,19,58,52,90,87,18,17,121,36,199,200,35,186,52,116,64,63,88,26,99,
+254,154,60,103,43,35,171,156,118,30,3,10,38,137,69,249,114,12,0,0,6,255,235,
+252,218,5,98,4,250,0,39,0,48,0,60,0,61,0,62,0,63,0,0,1,35,38,38,35,34,7,6,
+35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,0,39,39,54,36,
+55,53,33,53,33,21,35,7,6,4,7,22,4,23,38,53,1,34,38,53,52,54,51,50,22,21,20,
+6,1,3,7,4,139,153,25,109,91,53,110,110,63,165,190,19,157,16,97,107,52,90,
+90,53,184,79,100,254,131,234,80,207,1,142,190,251,253,5,119,215,157,168,254,
+210,134,189,1,80,86,7,254,15,50,74,71,53,50,70,70,1,27,10,2,254,183,91,87,
+17,18,162,156,68,67,19,58,52,90,87,18,17,111,115,191,1,12,39,197,122,182,
+60,69,146,146,229,58,138,80,43,215,143,83,83,254,190,68,52,51,70,70,51,52,
+68,252,152,2,43,79,0,3,255,235,252,218,5,230,4,250,0,66,0,67,0,68,0,0,3,53,
+33,21,35,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,
+51,50,23,17,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,22,23,54,54,51,50,23,38,53,53,3,7,21,5,251,215,153,26,113,92,61,
+155,155,60,186,200,24,157,21,107,133,42,135,135,60,190,82,59,61,52,71,5,133,
+19,128,82,74,88,96,121,55,165,164,183,130,94,138,61,26,98,61,71,70,3,46,100,
+4,104,146,146,250,168,93,85,17,18,166,165,79,84,19,70,70,101,87,18,17,111,
+3,22,55,65,61,22,27,7,97,114,74,63,70,95,39,151,50,182,133,117,158,66,76,
+52,58,51,28,87,100,248,126,12,0,0,2,255,238,255,167,5,126,5,129,0,70,0,71,
+0,0,3,54,51,50,22,23,54,54,51,50,22,23,38,53,53,51,23,51,21,35,17,35,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,38,38,35,34,
+6,21,20,22,23,7,38,38,39,6,6,35,39,54,54,53,52,38,35,34,7,37,18,94,82,104,
+162,39,35,148,93,86,155,59,4,108,48,215,214,153,49,168,60,115,115,64,151,
+186,19,157,16,82,99,53,101,102,46,182,79,62,145,84,84,95,142,138,14,139,181,
+41,40,186,133,13,133,140,112,104,76,81,3,145,4,245,19,94,86,87,93,77,76,36,
+73,165,135,146,251,63,178,17,18,166,155,74,58,19,52,57,92,86,18,17,111,3,
+37,104,104,92,82,88,97,7,158,8,100,92,95,105,158,2,101,83,86,94,22,158,0,
+5,255,235,252,218,5,163,4,250,0,42,0,49,0,60,0,61,0,62,0,0,1,33,53,33,21,
+35,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,
+23,53,38,36,39,39,54,54,55,38,38,39,55,22,4,23,38,53,53,19,38,53,53,38,39,
+6,6,7,22,4,19,7,1,11,254,224,5,184,215,153,27,117,97,57,118,118,66,176,205,
+19,157,16,107,115,56,98,97,58,190,96,174,254,154,241,74,100,222,122,115,222,
+107,175,180,1,103,137,4,4,4,102,152,127,200,74,179,1,67,174,100,4,104,146,
+146,250,168,91,87,17,18,162,156,68,67,19,58,52,91,86,18,17,121,36,206,193,
+35,186,64,119,54,63,86,23,99,56,209,128,57,97,239,252,98,118,30,203,110,103,
+57,101,44,34,168,251,124,12,0,0,4,255,236,255,167,5,215,4,250,0,55,0,64,0,
+65,0,66,0,0,19,30,2,51,50,54,55,33,53,33,21,35,22,21,20,6,7,17,35,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,6,35,34,38,
+39,6,6,35,34,38,39,1,33,22,22,51,50,54,53,52,3,17,201,35,57,50,38,87,82,4,
+253,194,5,235,232,69,31,31,153,28,119,97,55,123,122,75,172,202,19,157,16,
+105,111,64,101,100,58,202,88,42,48,124,189,57,36,126,88,101,150,77,3,236,
+254,130,41,165,123,72,78,63,3,160,61,67,27,179,176,146,146,107,116,59,97,
+37,252,223,93,85,17,18,162,156,68,67,19,58,52,90,87,18,17,111,1,242,9,125,
+121,120,126,116,123,1,19,184,184,76,69,109,1,4,251,6,0,7,255,235,252,218,
+5,47,4,250,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,0,1,33,22,23,30,2,21,20,6,
+7,22,4,23,7,38,39,22,21,21,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,
+22,51,50,55,54,51,50,23,53,38,36,39,55,22,22,51,50,54,53,52,38,35,34,6,21,
+20,23,7,38,53,52,54,55,38,39,33,53,33,33,19,3,3,7,3,5,47,253,94,50,22,133,
+203,109,202,189,136,1,18,137,95,126,52,4,153,23,103,88,51,97,96,56,151,175,
+19,157,16,87,96,52,87,87,50,137,80,125,254,242,190,29,70,134,95,182,184,154,
+129,103,101,13,149,23,100,99,42,110,254,81,5,68,253,139,202,58,10,2,157,4,
+104,43,61,2,92,168,97,155,191,25,50,157,108,109,94,34,52,83,193,93,85,17,
+18,162,156,68,67,19,58,52,91,86,18,17,111,211,73,103,44,142,22,17,124,114,
+103,121,59,63,34,32,30,67,58,78,113,27,87,36,146,251,6,252,218,2,43,79,2,
+91,0,0,5,255,235,252,218,5,98,4,250,0,39,0,44,0,54,0,55,0,56,0,0,5,35,38,
+38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,0,
+39,39,54,36,55,53,33,53,33,21,35,7,6,7,22,23,21,38,37,6,7,22,4,23,38,53,19,
+7,4,139,153,25,109,91,53,110,110,63,165,190,19,157,16,97,107,52,90,90,53,
+175,88,102,254,132,233,80,207,1,142,190,251,253,5,119,215,157,143,154,176,
+121,181,254,250,72,92,196,1,79,83,7,86,100,240,91,87,17,18,162,156,68,67,
+19,58,52,90,87,18,17,121,36,192,1,11,39,197,122,182,60,69,146,146,230,44,
+70,62,111,164,194,73,37,55,46,215,139,61,107,251,96,12,0,6,255,234,252,218,
+5,98,4,250,0,39,0,48,0,55,0,56,0,57,0,58,0,0,1,35,38,38,35,34,7,6,35,34,38,
+53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,0,39,39,54,36,55,53,33,
+53,33,21,35,7,6,4,7,22,4,23,38,53,5,22,4,23,7,38,37,1,3,7,4,139,153,25,109,
+91,53,110,110,63,165,190,19,157,16,97,107,52,90,90,53,184,79,100,254,131,
+234,80,207,1,142,190,251,252,5,120,215,157,168,254,210,134,189,1,80,86,7,
+253,74,149,1,5,94,95,171,254,242,2,50,10,2,254,140,91,87,17,18,154,146,65,
+63,19,54,46,82,80,18,17,111,158,191,1,12,39,197,122,182,60,69,146,146,229,
+58,138,80,43,215,143,83,83,8,28,152,116,85,185,50,251,240,2,43,79,0,0,3,255,
+235,253,213,5,200,4,250,0,70,0,82,0,83,0,0,1,20,22,22,51,50,54,55,55,22,21,
+20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,
+51,50,23,17,52,55,6,6,35,32,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,38,
+53,17,33,53,33,21,33,3,34,38,53,52,54,51,50,22,21,20,6,3,2,216,13,35,28,61,
+134,85,122,138,45,44,153,29,117,96,57,119,119,67,175,209,24,157,21,108,116,
+57,99,99,57,200,88,2,54,128,74,254,224,254,127,112,155,97,1,44,231,159,188,
+55,81,168,79,78,110,47,253,176,5,221,253,16,59,50,74,71,53,50,70,70,20,3,
+39,45,41,29,115,124,20,197,195,80,134,55,252,179,94,84,17,18,184,177,85,94,
+19,82,77,108,107,18,17,111,1,170,64,24,25,24,1,158,1,158,42,254,146,254,163,
+152,126,124,81,113,108,70,120,104,1,37,146,146,250,238,68,52,51,70,70,51,
+52,68,5,164,255,255,255,235,254,207,5,174,4,250,2,34,2,2,0,0,0,3,0,51,4,26,
+0,70,0,3,255,235,253,213,5,114,4,250,0,61,0,73,0,74,0,0,1,39,54,51,50,22,
+21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,23,17,6,6,35,34,38,38,53,17,33,53,33,21,33,17,20,22,22,51,50,54,
+53,52,38,35,34,1,34,38,53,52,54,51,50,22,21,20,6,19,3,92,23,79,90,124,138,
+50,49,153,26,113,92,54,113,114,64,167,199,24,157,21,101,111,54,93,92,55,190,
+82,74,157,83,93,126,75,254,87,5,135,252,191,19,64,63,149,252,71,71,46,254,
+221,50,74,71,53,50,70,70,54,2,253,146,21,139,134,71,139,69,252,89,93,85,17,
+18,195,187,91,97,19,88,84,115,117,18,17,111,2,57,52,51,65,129,135,2,162,146,
+146,253,125,75,89,50,242,138,67,61,252,73,68,52,51,70,70,51,52,68,5,166,255,
+255,255,235,254,207,5,134,4,250,2,34,2,3,0,0,0,3,0,51,3,242,0,70,0,6,255,
+235,252,218,5,149,4,250,0,42,0,56,0,68,0,69,0,70,0,71,0,0,3,33,21,35,17,35,
+38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,
+36,39,39,54,54,55,38,38,39,55,33,1,6,6,7,22,4,23,38,53,17,33,22,22,23,1,34,
+38,53,52,54,51,50,22,21,20,6,19,3,7,21,5,170,215,153,26,116,96,56,115,116,
+66,174,202,19,157,16,104,114,55,96,97,56,187,94,151,254,146,242,74,77,209,
+132,85,209,124,45,254,222,3,78,134,205,71,190,1,59,141,4,253,131,108,219,
+68,254,237,50,74,71,53,50,70,70,252,10,2,4,250,146,250,79,91,87,17,18,162,
+156,68,67,19,58,52,90,87,18,17,121,125,199,200,35,186,52,116,64,63,88,26,
+99,254,154,60,103,43,35,171,156,118,30,3,10,38,137,69,252,175,68,52,51,70,
+70,51,52,68,252,183,2,43,79,0,0,8,255,236,252,218,7,175,4,250,0,78,0,96,0,
+102,0,103,0,104,0,105,0,106,0,107,0,0,1,35,38,38,35,34,7,6,35,34,38,53,52,
+55,23,6,21,20,22,51,50,55,54,51,50,23,17,38,38,35,34,6,21,20,23,7,38,53,52,
+54,55,38,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,33,53,33,21,33,21,4,4,
+21,20,6,35,34,39,55,22,51,50,53,52,38,39,39,38,38,53,53,52,55,33,22,23,22,
+22,23,22,22,23,38,53,3,7,6,22,23,53,53,17,1,3,7,5,40,153,29,119,95,62,130,
+131,80,176,209,24,157,21,109,116,66,111,111,65,199,90,111,192,98,71,73,36,
+152,52,140,119,37,165,101,71,73,35,151,52,147,123,22,57,254,207,7,195,253,
+121,1,25,1,2,141,128,73,42,11,34,35,145,175,205,157,186,186,1,254,185,45,
+4,140,197,9,86,154,67,4,215,1,5,86,135,254,191,10,2,254,183,94,84,17,18,177,
+170,80,93,19,77,74,103,100,18,17,103,1,19,160,142,63,54,56,49,62,86,98,98,
+128,15,112,128,63,54,54,51,62,87,97,100,127,14,79,57,146,146,225,6,192,149,
+113,140,10,147,4,106,94,100,4,2,5,169,151,19,11,11,71,77,38,215,127,23,117,
+95,31,105,2,115,16,84,117,6,223,146,251,6,252,218,2,43,79,255,255,255,235,
+253,221,7,223,4,250,2,34,0,126,0,0,0,3,0,128,7,88,255,187,0,5,255,235,255,
+167,5,235,4,250,0,38,0,47,0,55,0,56,0,57,0,0,1,21,22,22,21,20,6,35,34,39,
+55,22,51,50,54,53,52,38,39,17,35,38,38,39,39,54,55,38,38,39,39,54,36,55,53,
+33,53,33,21,5,6,6,7,22,22,23,54,55,21,6,7,22,22,23,38,53,17,17,3,171,227,
+254,134,119,63,44,9,31,27,67,69,169,155,157,97,240,175,73,128,177,73,169,
+97,77,179,1,92,169,252,221,6,0,253,35,132,248,115,95,178,82,61,79,201,197,
+123,203,79,7,4,104,69,40,205,148,106,129,10,143,4,45,56,82,124,25,252,23,
+99,124,28,164,74,81,41,52,11,184,91,142,50,76,146,146,228,42,97,56,21,81,
+61,25,29,147,77,101,29,98,68,84,68,4,22,251,6,0,255,255,0,100,253,220,5,166,
+5,129,2,34,0,20,0,0,0,3,0,129,5,155,0,0,0,3,0,46,255,167,5,85,5,129,0,48,
+0,57,0,58,0,0,19,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,38,53,53,51,
+23,51,21,35,17,35,38,38,39,39,54,36,55,53,38,38,35,34,6,7,54,51,50,22,21,
+20,6,7,5,6,6,7,22,22,23,38,53,3,242,134,121,60,48,49,87,63,144,105,239,133,
+135,227,115,7,108,47,217,215,157,97,240,175,73,144,1,65,120,139,204,118,77,
+124,63,73,71,117,132,168,159,2,147,101,199,98,123,203,79,7,125,2,115,48,95,
+54,36,41,21,29,117,160,160,132,143,91,95,210,135,146,251,63,99,124,28,164,
+82,148,40,204,191,147,58,68,26,119,83,111,168,73,35,39,89,50,29,98,68,84,
+68,4,22,255,255,255,235,253,220,5,34,4,250,2,34,0,22,0,0,0,3,0,129,5,23,0,
+0,255,255,0,59,254,4,5,86,5,8,2,34,0,23,0,0,0,3,0,129,5,82,0,40,255,255,255,
+235,254,79,4,160,4,250,2,34,0,24,0,0,0,3,0,129,4,74,0,115,255,255,255,235,
+253,220,5,147,4,250,2,34,0,25,0,0,0,3,0,129,5,17,0,0,0,7,255,235,252,218,
+7,229,4,250,0,43,0,66,0,75,0,76,0,77,0,78,0,79,0,0,1,22,22,51,50,55,23,51,
+17,35,38,38,39,39,6,6,35,32,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,53,
+52,54,55,6,35,33,53,33,21,5,6,6,21,20,22,51,50,54,55,23,22,21,20,6,7,54,54,
+55,17,7,6,36,1,6,6,7,22,22,23,38,53,1,1,19,7,4,105,61,227,167,59,67,95,1,
+157,97,240,175,72,52,121,70,254,233,254,138,110,156,98,1,32,226,151,156,16,
+81,153,84,123,148,142,133,57,137,253,137,7,250,251,240,143,152,59,48,66,119,
+93,177,42,64,63,138,243,105,32,212,254,189,2,55,101,199,98,123,203,79,7,254,
+239,1,17,113,100,4,104,94,93,6,139,251,232,99,124,28,161,22,21,1,160,1,150,
+45,254,146,254,166,132,133,58,51,70,62,140,120,103,180,62,3,146,146,49,73,
+144,84,51,55,57,82,63,103,125,93,145,52,72,107,36,1,95,1,7,129,253,149,39,
+89,50,29,97,69,84,68,4,173,251,6,252,230,12,255,255,255,235,253,220,6,111,
+5,129,2,34,0,27,0,0,0,3,0,129,4,186,0,0,255,255,0,94,253,220,7,184,5,6,2,
+34,0,28,0,0,0,3,0,129,6,33,0,0,255,255,255,235,254,80,4,160,7,86,2,34,0,29,
+0,0,0,3,0,129,4,74,0,116,255,255,255,235,253,248,4,207,7,86,2,34,0,30,0,0,
+0,3,0,129,4,81,0,28,255,255,255,235,254,15,5,200,4,250,2,34,0,31,0,0,0,3,
+0,129,5,31,0,51,255,255,255,235,254,80,4,160,4,250,2,34,0,32,0,0,0,3,0,129,
+4,74,0,116,0,3,0,92,0,0,4,231,5,129,0,36,0,45,0,46,0,0,1,38,38,35,34,6,21,
+20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,53,51,23,51,21,35,17,35,38,38,
+39,39,54,36,55,21,6,6,7,22,22,23,38,53,3,3,115,119,223,104,81,96,86,91,79,
+130,136,191,140,126,222,119,7,108,47,217,215,157,97,240,175,73,121,1,78,130,
+101,199,98,123,203,79,7,125,3,41,164,165,83,72,61,89,35,146,54,175,108,136,
+163,130,144,52,114,229,135,146,251,152,99,124,28,164,70,157,43,147,39,89,
+50,29,98,68,84,68,3,189,0,6,255,235,255,167,5,20,4,250,0,3,0,41,0,50,0,51,
+0,52,0,53,0,0,3,53,33,21,1,17,35,38,38,39,39,54,54,55,38,0,39,55,22,22,51,
+50,54,53,52,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,7,22,22,
+23,38,53,3,19,3,21,5,41,254,255,157,97,240,175,73,51,137,87,181,254,253,77,
+148,82,237,192,142,149,119,100,123,17,146,31,148,125,174,210,61,217,101,199,
+98,123,203,79,7,197,197,158,4,104,146,146,253,164,253,155,99,124,28,164,29,
+65,36,36,1,20,240,43,245,222,93,89,78,100,81,36,36,29,70,66,87,95,183,134,
+76,120,118,39,89,50,29,98,68,84,68,4,22,251,6,1,186,0,5,0,78,252,218,5,61,
+5,129,0,44,0,53,0,54,0,55,0,56,0,0,1,51,23,51,21,35,17,35,38,38,39,39,54,
+54,55,38,38,39,39,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,
+20,6,7,22,22,23,55,21,6,6,7,22,22,23,38,53,3,19,7,3,201,108,47,217,215,157,
+97,240,175,73,89,190,101,121,233,152,47,218,224,219,93,104,70,90,139,194,
+160,182,205,193,181,127,237,110,50,101,199,98,123,203,79,7,125,248,100,5,
+129,135,146,250,167,99,124,28,164,51,95,44,74,72,20,189,11,126,114,167,66,
+47,49,34,125,85,119,115,146,172,141,130,178,34,23,100,77,18,147,39,89,50,
+29,97,69,84,68,4,174,247,236,12,0,5,255,235,252,218,5,4,4,250,0,24,0,33,0,
+34,0,35,0,36,0,0,1,6,4,7,39,17,35,53,33,21,33,17,54,36,55,23,17,35,38,38,
+39,39,54,36,55,21,6,6,7,22,22,23,38,53,3,19,7,3,144,151,254,200,160,121,189,
+5,25,252,65,124,1,67,200,97,157,97,240,175,73,144,1,65,120,101,199,98,123,
+203,79,7,233,253,100,3,44,66,227,161,82,2,176,146,146,253,230,129,203,74,
+97,251,141,99,124,28,164,82,148,40,147,39,89,50,29,97,69,84,68,4,173,247,
+236,12,0,4,0,75,0,0,7,230,5,8,0,34,0,40,0,49,0,58,0,0,33,35,38,0,39,17,35,
+38,0,39,39,54,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,55,53,33,
+21,35,1,54,36,55,53,33,7,6,4,7,22,4,23,38,53,1,6,4,7,22,4,23,38,53,7,15,157,
+89,254,180,202,157,100,254,131,234,80,144,135,130,142,125,60,49,13,32,41,
+62,66,51,54,186,193,4,128,215,252,244,163,1,55,149,253,145,157,168,254,210,
+134,196,1,75,84,7,3,12,168,254,210,134,196,1,75,84,7,170,1,0,53,254,33,191,
+1,12,39,197,85,67,96,130,93,122,10,147,4,50,42,43,60,27,85,61,215,146,254,
+176,87,133,47,69,229,58,138,80,46,215,140,83,83,1,255,58,138,80,46,215,140,
+83,83,0,2,255,235,0,0,4,250,4,250,0,32,0,41,0,0,1,55,17,33,53,33,21,35,17,
+35,38,38,39,39,54,54,55,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,19,
+6,6,7,22,22,23,38,53,3,131,3,252,101,5,15,215,157,106,226,197,76,96,230,134,
+92,181,89,61,72,83,98,153,163,119,131,249,146,118,212,94,133,215,83,7,2,239,
+1,1,120,146,146,251,152,110,131,39,181,57,116,58,103,103,54,47,69,49,126,
+102,149,111,131,139,254,205,49,101,52,33,111,77,132,44,255,255,0,45,254,182,
+5,208,5,129,2,34,0,39,0,0,0,3,0,129,5,197,0,218,255,255,255,235,253,220,6,
+201,4,250,2,34,0,40,0,0,0,3,0,129,4,248,0,0,0,4,255,235,0,0,7,230,4,250,0,
+19,0,25,0,34,0,43,0,0,33,35,38,0,39,17,35,38,0,39,39,54,36,55,53,33,53,33,
+21,35,33,17,54,36,55,53,5,6,4,7,22,4,23,38,53,1,6,4,7,22,4,23,38,53,7,15,
+157,89,254,180,202,157,100,254,131,234,80,207,1,142,190,252,133,7,251,215,
+252,244,163,1,55,149,252,244,168,254,210,134,196,1,75,84,7,3,12,168,254,210,
+134,196,1,75,84,7,170,1,0,53,254,33,191,1,12,39,197,122,182,60,69,146,146,
+254,176,87,133,47,69,229,58,138,80,46,215,140,83,83,1,255,58,138,80,46,215,
+140,83,83,255,255,255,235,254,66,5,217,4,250,2,34,0,42,0,0,0,3,0,129,5,55,
+0,102,0,5,255,236,0,0,4,253,4,250,0,40,0,53,0,62,0,63,0,64,0,0,1,22,21,20,
+6,7,17,35,38,38,39,39,54,54,55,38,38,39,38,38,35,34,6,21,20,23,7,38,53,52,
+54,51,51,50,23,38,39,35,53,33,21,33,33,22,22,21,21,23,22,22,51,50,53,52,3,
+6,6,7,22,22,23,38,53,17,3,4,13,69,27,27,157,97,240,175,73,108,240,133,81,
+146,84,66,51,27,37,45,74,112,130,134,102,9,4,4,27,138,194,5,17,254,88,254,
+71,46,44,68,84,92,50,154,55,101,199,98,123,203,79,7,44,4,104,107,116,54,89,
+35,253,41,99,124,28,164,61,106,45,3,56,62,49,20,37,37,55,57,112,105,132,96,
+111,1,122,44,146,146,39,104,80,3,46,61,35,145,109,254,36,39,89,50,29,98,68,
+84,68,3,189,253,108,0,255,255,255,235,253,220,5,23,4,250,2,34,0,44,0,0,0,
+3,0,129,5,12,0,0,255,255,255,235,255,244,7,230,4,250,2,34,1,7,0,0,0,3,2,64,
+4,19,1,107,0,2,255,235,255,167,5,224,4,250,0,51,0,60,0,0,1,38,38,35,34,6,
+21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,
+50,22,23,38,53,53,33,53,33,21,35,17,35,38,38,39,39,54,36,55,21,6,6,7,22,22,
+23,38,53,4,108,55,104,48,69,76,5,133,19,128,82,74,88,96,121,55,165,164,183,
+130,93,138,62,26,109,65,61,106,67,2,251,127,5,245,215,157,97,240,175,73,116,
+1,36,177,101,199,98,123,203,79,7,2,205,60,51,64,62,22,27,7,97,114,74,63,70,
+95,39,151,50,182,133,117,158,65,77,49,61,39,49,62,63,118,146,146,251,63,99,
+124,28,164,70,135,65,147,39,89,50,29,98,68,84,68,0,3,255,238,255,167,5,126,
+5,129,0,54,0,61,0,62,0,0,3,54,51,50,22,23,54,54,51,50,22,23,38,53,53,51,23,
+51,21,35,17,35,38,38,39,39,54,36,55,17,38,38,35,34,6,21,20,22,23,7,38,38,
+39,6,6,35,39,54,54,53,52,38,35,34,7,1,6,7,22,23,38,53,3,18,94,82,104,162,
+39,35,148,93,86,155,59,4,108,48,215,214,157,97,240,175,73,144,1,65,120,62,
+145,84,84,95,105,105,14,110,146,36,42,186,130,13,133,140,112,104,76,81,4,
+13,201,197,247,158,7,124,4,245,19,94,86,87,93,77,76,36,73,165,135,146,251,
+63,99,124,28,164,82,148,40,1,78,104,104,92,82,85,96,11,158,16,99,83,96,102,
+158,2,101,83,86,94,22,253,101,77,101,58,137,84,68,4,22,0,255,255,255,235,
+253,220,5,37,4,250,2,34,0,48,0,0,0,3,0,129,5,26,0,0,0,4,255,236,0,0,5,215,
+4,250,0,35,0,44,0,53,0,54,0,0,19,30,2,51,50,54,55,33,53,33,21,35,22,21,20,
+6,7,17,35,38,38,39,39,54,54,55,38,38,39,6,6,35,34,38,39,1,33,22,22,51,50,
+54,53,52,3,6,6,7,22,22,23,38,53,17,201,35,57,50,38,87,82,4,253,194,5,235,
+232,69,31,31,157,97,240,175,73,96,223,128,107,161,54,36,126,88,101,150,77,
+3,236,254,130,41,165,123,72,78,63,101,199,98,123,203,79,7,3,160,61,67,27,
+179,176,146,146,107,116,59,97,38,253,57,99,124,28,164,55,103,49,5,119,114,
+120,126,116,123,1,19,184,184,76,69,109,254,36,39,89,50,29,98,68,84,68,3,189,
+0,0,5,255,235,255,126,7,137,4,250,0,42,0,52,0,61,0,62,0,63,0,0,1,38,39,35,
+53,33,21,35,17,35,38,0,39,6,6,7,22,4,23,7,36,36,37,55,22,22,51,50,54,53,52,
+38,35,34,6,21,20,23,7,38,53,52,54,55,22,23,22,22,23,54,36,55,53,21,6,4,7,
+22,4,23,38,53,5,3,1,86,42,110,211,7,158,215,157,93,254,167,214,45,173,128,
+136,1,18,137,95,254,245,254,130,254,245,29,70,134,95,182,184,154,129,103,
+101,13,149,23,100,190,50,22,153,221,47,161,1,59,155,168,254,210,134,189,1,
+80,86,7,252,136,68,3,237,87,36,146,146,251,152,177,1,2,50,78,96,17,50,157,
+108,109,203,181,61,142,22,17,124,114,103,121,59,63,34,32,30,67,58,78,113,
+150,43,61,1,122,113,86,136,49,69,229,58,138,80,43,215,143,83,83,116,2,241,
+0,255,255,255,235,253,220,4,218,4,250,2,34,0,84,0,0,0,3,0,129,4,207,0,0,255,
+255,255,235,253,220,4,218,4,250,2,34,0,85,0,0,0,3,0,129,4,207,0,0,255,255,
+255,235,254,15,5,200,4,250,2,34,0,31,0,0,0,35,0,51,3,191,1,39,0,3,0,129,5,
+114,0,51,0,6,255,235,253,213,4,200,4,250,0,32,0,42,0,51,0,63,0,64,0,65,0,
+0,1,39,54,51,50,22,21,20,6,4,35,34,38,38,53,17,35,53,33,21,33,17,20,22,22,
+51,50,18,53,52,38,35,34,1,17,35,38,38,39,39,54,36,55,21,6,6,7,22,22,23,38,
+53,37,34,38,53,52,54,51,50,22,21,20,6,1,19,2,148,23,79,90,125,137,148,254,
+245,155,93,126,75,225,4,221,252,161,19,64,63,147,254,70,72,46,1,110,157,97,
+240,175,73,144,1,65,120,105,199,94,123,202,80,7,253,22,50,74,71,53,50,70,
+70,1,44,213,2,253,146,21,149,139,128,254,182,65,129,135,2,207,146,146,253,
+80,75,89,50,1,6,152,72,67,253,126,253,83,99,124,28,164,82,148,40,147,40,89,
+48,28,98,70,84,68,86,68,52,51,70,70,51,52,68,5,139,248,219,255,255,255,235,
+253,220,5,23,4,250,2,34,0,44,0,0,0,35,0,129,5,12,0,0,0,3,2,64,4,8,1,107,255,
+255,255,236,253,220,7,175,4,250,2,34,0,125,0,0,0,3,0,129,5,244,0,0,255,255,
+255,235,253,220,7,223,4,250,2,34,0,126,0,0,0,3,0,129,7,88,0,0,0,7,255,235,
+255,167,6,60,4,250,0,44,0,56,0,65,0,74,0,75,0,76,0,77,0,0,1,21,22,4,21,20,
+6,7,22,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,39,17,35,38,38,39,39,54,
+55,38,38,39,39,54,36,55,53,33,53,33,21,5,17,22,23,55,22,51,50,54,53,52,38,
+37,6,6,7,22,22,23,54,55,21,6,6,7,22,22,23,38,53,17,17,1,3,171,242,1,13,79,
+73,60,61,134,119,63,44,9,31,27,67,69,168,155,157,97,240,175,73,128,177,73,
+169,97,77,179,1,92,169,252,221,6,81,253,111,92,86,2,27,25,60,62,185,254,186,
+132,248,115,95,178,82,61,79,101,199,98,123,203,79,7,1,170,4,104,69,41,205,
+147,83,112,20,52,122,71,106,129,10,143,4,45,56,82,123,26,253,227,99,124,28,
+164,74,81,41,52,11,184,91,142,50,76,146,146,216,254,199,17,30,32,4,46,55,
+82,123,14,42,97,56,21,81,61,25,29,147,39,89,50,29,98,68,84,68,4,22,251,6,
+1,175,0,0,4,255,235,255,232,5,220,7,86,0,81,0,92,0,93,0,94,0,0,1,21,22,22,
+21,20,6,35,34,39,55,22,51,50,54,53,52,38,39,21,20,6,7,7,6,6,21,20,22,51,50,
+54,53,52,39,55,22,21,20,6,6,35,34,38,53,52,55,38,38,39,39,54,36,55,53,33,
+53,33,38,38,35,33,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,51,
+21,1,22,22,23,55,54,54,53,53,6,6,1,1,3,130,214,225,122,102,43,68,9,42,31,
+53,51,147,143,31,44,41,66,35,111,112,118,165,52,96,118,108,208,137,173,199,
+48,83,210,127,77,164,1,77,169,253,6,4,121,4,75,84,254,229,191,171,79,11,151,
+9,55,112,110,250,123,146,81,5,228,251,62,96,179,82,43,35,24,118,230,2,74,
+253,235,4,104,62,41,186,131,88,113,10,143,4,34,39,66,100,26,115,73,101,71,
+67,109,78,46,70,69,101,62,54,32,111,70,117,82,146,91,158,130,92,85,63,79,
+16,184,83,135,51,76,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,
+146,254,103,21,85,63,74,61,80,74,61,37,91,252,252,7,86,0,3,255,235,254,32,
+5,220,7,86,0,110,0,121,0,122,0,0,1,21,22,22,21,20,6,35,34,39,55,22,51,50,
+54,53,52,38,39,21,20,6,7,7,6,6,21,20,22,51,50,54,53,52,39,55,22,21,20,6,7,
+17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,
+17,6,6,35,34,38,53,52,55,38,38,39,39,54,36,55,53,33,53,33,38,38,35,33,34,
+38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,51,21,1,22,22,23,55,54,
+54,53,53,6,6,19,3,130,214,225,122,102,43,68,9,42,31,53,51,147,143,31,44,41,
+66,35,111,112,118,165,52,96,118,37,37,153,26,113,92,54,113,114,64,167,199,
+24,157,21,101,111,54,93,92,55,190,82,51,111,60,173,199,48,83,210,127,77,164,
+1,77,169,253,6,4,121,4,75,84,254,229,191,171,79,11,151,9,55,112,110,250,123,
+146,81,5,228,251,62,96,179,82,43,35,24,118,230,53,4,104,62,41,186,131,88,
+113,10,143,4,34,39,66,100,26,115,73,101,71,67,109,78,46,70,69,101,62,54,32,
+111,70,117,49,90,40,253,172,93,85,17,18,195,187,91,97,19,88,84,115,117,18,
+17,111,1,24,19,19,158,130,92,85,63,79,16,184,83,135,51,76,146,87,71,85,142,
+100,47,62,10,46,32,74,90,37,47,131,127,146,254,103,21,85,63,74,61,80,74,61,
+37,91,4,82,0,4,255,236,0,0,7,133,4,250,0,3,0,65,0,66,0,67,0,0,3,53,33,21,
+1,55,18,0,51,50,54,53,52,39,6,7,39,54,54,53,52,35,34,6,6,21,20,22,23,7,38,
+53,52,54,54,51,50,22,23,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,
+6,7,22,21,20,6,35,32,0,1,19,20,7,153,248,181,154,107,1,57,254,135,153,87,
+61,90,62,152,128,164,86,162,99,58,45,41,224,142,244,128,138,159,17,104,142,
+123,152,159,159,49,106,106,73,63,76,120,77,23,32,128,243,212,254,206,254,
+105,2,200,46,4,104,146,146,254,238,47,254,124,254,154,102,95,85,62,32,32,
+143,48,101,77,131,66,96,39,37,32,6,151,39,170,86,171,107,113,104,105,141,
+112,122,170,48,147,27,88,61,62,66,81,95,35,30,94,144,161,187,1,171,3,79,251,
+6,255,255,255,236,253,242,7,133,4,250,2,34,1,27,0,0,0,3,0,129,5,110,0,22,
+255,255,255,236,254,56,7,133,4,250,2,34,1,27,0,0,0,3,0,128,5,247,0,22,0,4,
+255,235,255,166,5,243,4,250,0,53,0,62,0,63,0,64,0,0,1,21,22,22,21,20,6,35,
+34,39,55,22,51,50,54,53,52,38,39,17,35,53,38,38,35,34,6,21,20,22,23,7,38,
+38,53,52,54,51,50,22,23,53,38,36,39,39,54,36,55,53,33,53,33,21,5,6,6,7,22,
+22,23,38,53,17,17,3,180,226,254,134,119,63,44,9,31,27,67,69,168,155,157,112,
+200,95,61,63,64,66,72,107,117,156,111,114,212,109,102,254,192,201,77,175,
+1,92,172,252,212,6,8,253,36,141,246,106,147,239,114,7,4,104,69,40,205,148,
+106,129,10,143,4,45,56,82,123,26,252,23,83,142,133,52,45,41,56,24,141,40,
+142,83,106,134,111,119,71,132,169,28,184,89,141,53,76,146,146,228,44,98,53,
+31,122,112,130,41,2,151,251,6,0,3,255,235,255,138,7,93,4,250,0,30,0,58,0,
+67,0,0,1,38,36,39,39,54,36,55,53,33,53,33,21,35,17,35,53,38,38,35,34,6,21,
+20,22,23,7,38,38,53,52,1,33,21,22,22,21,20,6,35,34,39,55,22,51,50,54,53,52,
+38,39,17,54,51,50,22,23,38,53,1,6,6,7,22,22,23,38,53,2,223,94,254,220,197,
+77,164,1,77,169,253,6,7,114,215,157,144,244,118,69,71,64,66,72,107,117,3,
+44,253,153,225,247,131,116,63,42,9,31,27,67,69,165,158,47,50,136,252,132,
+2,252,252,118,230,111,138,233,95,7,1,8,142,167,26,184,83,135,51,76,146,146,
+251,63,14,164,152,52,45,41,56,24,141,40,142,83,65,3,148,69,39,195,143,102,
+124,10,138,4,43,52,77,115,25,253,229,12,125,133,46,115,2,100,37,91,53,30,
+133,102,130,41,0,0,4,255,235,255,84,6,99,4,250,0,67,0,76,0,77,0,78,0,0,37,
+38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,
+23,54,54,51,50,22,23,53,38,36,39,39,54,36,55,53,33,53,33,21,33,21,22,22,21,
+20,6,35,34,39,55,22,51,50,54,53,52,38,39,17,35,17,6,6,7,22,22,23,38,53,17,
+17,3,115,50,48,41,44,5,125,13,110,83,55,67,86,86,59,136,136,153,115,84,132,
+49,22,71,49,35,57,29,106,254,200,206,77,175,1,92,172,252,120,6,120,253,173,
+226,254,134,119,63,44,9,31,27,67,69,168,155,157,141,246,106,147,239,114,7,
+128,47,59,56,27,26,6,111,124,60,45,54,81,29,139,50,154,105,101,137,76,75,
+44,45,32,30,4,135,165,30,184,89,141,53,76,146,146,69,40,205,148,106,129,10,
+143,4,45,56,82,123,26,252,23,3,221,44,98,53,31,122,112,130,41,2,151,251,6,
+0,0,3,255,235,0,0,7,93,4,250,0,33,0,60,0,69,0,0,37,38,38,35,34,6,7,6,6,35,
+34,38,39,55,22,22,51,50,55,38,36,39,39,54,36,55,53,33,53,33,21,35,17,35,1,
+21,22,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,39,17,54,54,51,50,22,23,
+17,5,6,6,7,22,22,23,38,53,5,233,97,146,75,42,96,95,130,120,61,91,144,74,126,
+53,73,45,63,74,99,254,200,213,77,164,1,77,169,253,6,7,114,215,157,253,153,
+231,241,132,115,63,42,9,31,27,68,68,166,157,103,124,58,76,128,126,252,252,
+118,230,111,138,233,95,7,15,117,107,40,61,84,54,120,118,75,93,62,42,172,200,
+27,184,83,135,51,76,146,146,251,152,4,104,69,41,194,139,102,122,10,143,4,
+42,50,74,112,24,253,133,68,46,66,118,3,153,228,37,91,53,30,133,102,130,41,
+0,0,8,255,236,252,218,7,175,4,250,0,74,0,92,0,98,0,99,0,100,0,101,0,102,0,
+103,0,0,1,38,38,53,52,54,51,50,22,23,53,38,38,35,34,6,21,20,23,7,38,53,52,
+54,55,38,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,33,53,33,21,33,21,4,4,
+21,20,6,35,34,39,55,22,51,50,53,52,38,39,17,35,53,38,38,35,34,6,21,20,22,
+23,1,38,38,53,53,52,55,33,22,23,22,22,23,22,22,23,38,53,3,7,6,22,23,53,53,
+17,3,7,1,2,219,107,117,150,111,102,193,100,111,192,98,71,73,36,152,52,133,
+112,42,153,94,71,73,35,151,52,147,123,22,57,254,207,7,195,253,121,1,25,1,
+2,141,128,73,42,11,34,35,145,178,202,157,104,183,88,57,58,64,66,1,104,186,
+186,1,254,185,45,4,132,190,20,88,156,68,5,215,1,5,86,135,71,100,253,138,254,
+241,40,142,83,108,132,109,114,227,160,142,63,54,56,49,62,86,98,94,127,18,
+80,92,63,54,54,51,62,87,97,100,127,14,79,57,146,146,225,6,192,149,113,140,
+10,147,4,106,94,101,4,252,24,54,142,131,52,45,41,56,24,3,124,5,169,151,19,
+11,11,71,75,33,173,105,22,119,97,30,118,2,35,16,84,117,6,223,146,251,6,252,
+230,12,3,224,0,6,255,236,252,218,8,229,4,250,0,52,0,79,0,97,0,103,0,104,0,
+105,0,0,1,21,35,17,35,53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,55,38,38,
+35,34,6,21,20,23,7,38,53,52,54,55,38,38,35,34,6,21,20,23,7,38,53,52,54,55,
+38,39,33,53,5,33,21,22,22,21,20,6,35,34,39,55,22,51,50,53,52,38,39,17,54,
+51,50,22,23,38,53,1,38,38,53,53,52,55,33,22,23,22,22,23,22,22,23,38,53,3,
+7,6,22,23,53,1,7,8,229,215,157,144,244,118,69,71,64,66,72,107,117,66,109,
+190,98,71,73,36,152,52,140,119,37,165,101,71,73,35,151,52,147,123,22,57,254,
+207,7,133,253,183,248,223,128,118,67,38,11,30,32,129,146,176,33,34,136,252,
+132,2,253,26,186,186,1,254,185,45,4,140,197,9,86,154,67,4,215,1,5,86,135,
+2,147,100,4,250,146,250,168,35,164,152,52,45,41,56,24,141,40,142,83,92,64,
+157,140,63,54,56,49,62,86,98,98,128,15,112,128,63,54,54,51,62,87,97,100,127,
+14,79,57,146,146,225,7,179,138,105,131,10,142,4,94,81,90,4,254,1,6,125,133,
+46,115,2,92,5,169,151,19,11,11,71,77,38,215,127,23,117,95,31,105,2,115,16,
+84,117,6,223,248,126,12,0,3,0,46,255,165,5,125,5,129,0,54,0,75,0,76,0,0,33,
+17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,
+55,39,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,38,53,53,51,23,51,21,
+35,17,1,54,51,50,22,23,39,53,38,38,35,34,6,7,54,51,50,22,21,20,6,1,4,9,92,
+163,92,71,108,74,66,74,113,124,168,153,87,135,114,56,44,55,84,52,139,59,63,
+71,125,100,60,48,49,87,63,144,111,237,140,136,233,137,7,108,47,217,215,253,
+168,46,35,98,169,96,1,153,220,121,81,128,62,73,71,117,132,36,1,27,1,58,117,
+104,46,70,27,112,81,117,164,63,136,48,87,56,35,41,22,25,121,78,56,119,48,
+86,51,34,43,21,29,117,167,153,138,152,98,88,225,135,146,251,152,2,154,13,
+83,98,53,241,193,153,58,68,26,119,83,50,85,2,61,0,3,0,46,255,241,8,33,5,8,
+0,58,0,59,0,60,0,0,1,17,54,36,55,23,6,6,21,20,22,23,7,38,53,52,54,55,6,4,
+7,39,17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,
+39,54,54,51,50,22,23,38,53,53,33,21,37,1,4,126,124,1,67,200,133,57,50,33,
+38,154,77,39,35,151,254,200,160,121,136,205,113,83,137,70,74,120,123,142,
+161,174,104,140,135,73,61,48,90,61,165,102,236,139,133,225,119,7,4,64,253,
+161,1,2,4,104,253,230,129,203,74,132,106,205,133,99,185,115,36,253,217,99,
+190,68,66,227,161,82,1,104,186,152,79,101,39,141,101,119,191,93,149,58,120,
+68,48,59,22,29,134,178,173,131,144,81,105,75,146,146,251,6,0,0,4,0,46,255,
+167,6,163,5,129,0,66,0,75,0,76,0,77,0,0,19,54,54,53,52,38,35,34,6,7,39,54,
+54,51,50,22,23,38,53,53,51,23,33,21,33,17,54,54,55,23,6,21,20,23,7,38,38,
+53,52,55,6,6,7,17,35,38,38,39,39,54,36,55,53,38,38,35,34,6,7,54,51,50,22,
+21,20,6,7,1,38,53,53,6,6,7,22,22,3,19,242,134,121,60,48,49,87,63,144,105,
+239,133,135,227,115,7,108,47,2,39,253,219,82,162,81,112,64,47,144,24,31,37,
+46,129,83,157,97,240,175,73,121,1,36,172,139,204,118,77,124,63,73,71,117,
+132,168,159,2,154,7,108,199,90,124,202,54,125,2,115,48,95,54,34,43,21,29,
+117,160,160,132,143,100,86,210,135,146,254,36,28,48,20,112,153,185,155,157,
+33,82,193,77,153,123,13,39,26,253,176,99,124,28,164,71,136,64,203,191,147,
+58,68,26,119,83,111,168,73,254,104,84,68,219,40,88,48,29,98,4,106,251,6,0,
+2,0,46,255,167,5,85,5,129,0,63,0,64,0,0,19,54,54,53,52,38,35,34,6,7,39,54,
+54,51,50,22,23,38,53,53,51,23,51,21,35,17,35,53,38,38,35,34,6,21,20,22,23,
+7,38,38,53,52,54,51,50,22,23,38,53,17,38,38,35,34,6,7,54,51,50,22,21,20,6,
+7,1,242,134,121,60,48,49,87,63,144,105,239,133,135,227,115,7,108,47,217,215,
+157,112,200,95,61,63,64,66,72,107,117,156,111,117,206,109,2,139,204,118,77,
+124,63,73,71,117,132,168,159,2,22,2,115,48,95,54,36,41,21,29,117,160,160,
+132,143,67,119,210,135,146,251,63,84,142,133,52,45,41,56,24,141,40,142,83,
+106,134,105,121,47,115,1,192,191,147,58,68,26,119,83,111,168,73,3,22,0,0,
+3,0,46,0,0,7,95,5,129,0,58,0,66,0,67,0,0,37,38,38,53,52,54,55,17,38,38,35,
+34,6,7,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,
+23,38,53,53,51,23,33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,1,33,17,22,
+22,23,38,53,37,4,18,107,117,91,84,136,205,113,83,137,70,74,120,123,142,161,
+174,104,140,135,73,61,48,90,61,165,102,236,139,133,225,119,7,108,47,2,227,
+215,157,117,197,93,61,63,64,66,1,145,254,147,90,177,100,2,254,107,2,40,142,
+83,80,119,26,1,52,186,152,79,101,39,141,101,119,191,93,149,58,120,68,48,59,
+22,29,134,178,173,131,144,92,94,210,135,146,251,152,83,148,130,52,45,41,56,
+24,3,217,253,141,11,100,111,47,115,66,0,2,0,46,255,164,5,85,5,129,0,74,0,
+75,0,0,37,38,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,22,23,54,51,50,23,17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,54,
+54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,38,53,53,51,23,51,21,35,17,35,
+3,3,225,31,59,33,48,52,5,125,15,106,78,59,70,86,86,59,136,136,156,121,82,
+135,39,44,106,70,77,139,204,118,77,124,63,73,71,117,132,168,159,92,134,121,
+60,48,49,87,63,144,105,239,133,135,227,115,7,108,47,217,215,157,125,215,28,
+32,57,58,27,26,6,101,114,58,47,54,82,28,139,50,154,105,102,136,68,63,89,50,
+1,181,191,147,58,68,26,119,83,111,168,73,143,48,95,54,36,41,21,29,117,160,
+160,132,143,111,75,210,135,146,251,152,4,250,0,0,3,255,234,255,126,5,3,4,
+250,0,38,0,57,0,58,0,0,5,38,38,53,52,54,51,50,22,23,53,38,36,39,39,54,55,
+38,38,53,52,55,35,53,33,21,35,3,35,53,38,38,35,34,6,21,20,22,23,19,6,6,7,
+22,4,23,38,53,17,33,6,21,20,22,51,50,54,55,7,1,182,107,117,156,111,114,212,
+109,137,254,206,231,64,78,108,122,134,48,178,5,25,214,1,157,112,200,95,61,
+63,64,66,234,93,180,86,155,1,9,110,3,253,207,82,82,63,69,120,66,68,130,40,
+142,83,106,134,111,119,128,131,114,2,158,54,57,10,118,91,65,55,146,146,251,
+63,43,142,133,52,45,41,56,24,3,89,49,105,56,13,108,95,91,37,2,46,51,75,47,
+52,43,42,221,0,3,255,234,255,84,5,3,4,250,0,51,0,70,0,71,0,0,37,38,35,34,
+6,21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,23,54,54,51,
+50,22,23,53,38,36,39,39,54,55,38,38,53,52,55,35,53,33,21,35,17,35,3,6,6,7,
+22,4,23,38,53,17,33,6,21,20,22,51,50,54,55,7,3,144,50,48,41,44,5,125,13,110,
+83,55,67,86,86,59,136,136,153,115,168,97,21,73,42,37,60,30,142,254,203,225,
+64,78,108,122,134,48,178,5,25,214,157,168,93,180,86,155,1,9,110,3,253,207,
+82,82,63,69,120,66,68,128,47,59,56,27,26,6,111,124,60,45,54,81,29,139,50,
+154,105,101,137,151,41,43,31,29,23,137,110,2,158,54,57,10,118,91,65,55,146,
+146,251,63,3,189,49,105,56,13,108,95,91,37,2,46,51,75,47,52,43,42,221,0,0,
+4,255,235,0,0,5,138,4,250,0,59,0,66,0,75,0,76,0,0,1,35,21,20,6,35,34,38,39,
+35,22,23,22,22,23,22,4,21,20,6,35,34,39,55,22,51,50,54,53,52,38,39,17,35,
+38,36,39,39,54,36,55,38,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,35,53,
+33,5,33,22,51,50,54,53,1,6,6,7,22,22,23,38,53,17,5,138,108,159,131,115,193,
+61,226,54,19,134,185,21,229,1,0,134,119,63,44,9,31,27,67,69,168,155,157,136,
+254,251,140,74,108,1,97,148,17,115,89,63,70,18,150,31,84,81,41,109,203,5,
+159,254,251,254,185,63,119,68,77,254,41,123,214,92,115,218,103,7,4,104,5,
+113,128,128,118,47,59,13,152,116,39,207,148,106,129,10,143,4,45,56,82,123,
+26,253,175,138,138,17,181,60,149,46,73,80,48,41,40,41,36,75,65,71,100,22,
+82,37,146,146,117,63,51,253,224,41,87,46,25,120,96,84,68,3,188,0,7,255,235,
+252,218,6,102,4,250,0,84,0,91,0,100,0,101,0,102,0,103,0,104,0,0,1,35,21,20,
+6,35,34,38,39,35,22,23,22,22,23,22,4,21,20,6,35,34,39,55,22,51,50,54,53,52,
+38,39,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,23,53,38,36,39,39,54,36,55,38,38,35,34,6,21,20,23,7,38,53,52,54,55,38,
+39,33,53,33,5,33,22,51,50,54,53,1,6,6,7,22,22,23,38,53,17,3,3,7,6,102,108,
+159,131,115,193,61,226,54,19,134,185,21,229,1,0,134,119,63,44,9,31,27,67,
+69,168,155,153,23,103,88,51,97,96,56,151,175,19,157,16,87,96,52,87,87,50,
+137,80,136,254,251,140,74,108,1,97,148,17,115,89,63,70,18,150,31,84,81,41,
+109,254,89,6,123,254,251,254,185,63,119,68,77,254,41,123,214,92,115,218,103,
+7,64,10,2,4,104,5,113,128,128,118,47,59,13,152,116,39,207,148,106,129,10,
+143,4,45,56,82,123,26,252,101,93,85,17,18,162,156,68,67,19,58,52,91,86,18,
+17,111,116,138,138,17,181,60,149,46,73,80,48,41,40,41,36,75,65,71,100,22,
+82,37,146,146,117,63,51,253,224,41,87,46,25,120,96,84,68,3,188,247,224,2,
+43,79,0,5,255,235,252,218,8,128,5,129,0,82,0,93,0,94,0,95,0,96,0,0,1,35,17,
+35,38,36,39,39,54,54,53,52,39,6,6,7,6,6,35,34,0,3,55,18,18,51,50,54,53,52,
+39,6,6,35,34,38,53,52,55,6,35,33,53,33,50,22,21,20,6,35,34,39,6,21,20,22,
+51,50,54,55,23,22,21,21,6,21,54,54,55,55,22,21,20,6,7,4,23,38,53,17,51,23,
+51,1,22,51,50,54,53,52,38,35,34,6,37,19,7,8,128,215,157,114,254,205,194,46,
+177,178,49,56,139,83,56,221,149,244,254,169,99,151,81,255,204,149,166,13,
+70,154,101,117,137,89,58,57,254,44,3,83,117,123,150,135,83,80,2,52,57,70,
+146,94,112,66,1,49,80,32,112,163,144,137,1,2,179,4,108,47,217,250,9,68,70,
+69,74,52,45,59,97,3,234,13,100,4,104,250,168,129,157,29,180,13,125,111,80,
+64,91,105,15,90,92,1,80,1,80,43,254,223,254,236,110,102,40,46,61,73,154,125,
+170,113,3,146,110,92,100,116,23,26,25,61,57,76,82,5,126,128,4,2,3,23,102,
+78,28,154,165,126,177,39,62,169,54,143,4,249,135,254,237,20,53,47,39,40,84,
+200,247,236,12,0,0,4,255,235,255,241,5,227,4,250,0,63,0,70,0,71,0,72,0,0,
+1,35,21,20,6,35,34,38,39,35,22,23,22,22,23,54,54,55,23,6,21,20,23,7,38,53,
+52,55,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,54,53,52,38,35,34,6,21,20,23,
+7,38,53,52,54,55,38,39,35,53,33,5,33,22,51,50,54,53,37,1,5,227,230,159,131,
+115,193,61,240,53,20,139,181,20,77,221,144,122,107,71,154,76,68,114,195,81,
+97,134,77,73,127,62,115,35,62,42,47,89,68,128,108,62,67,18,149,29,78,79,42,
+110,156,5,248,254,129,254,185,63,119,68,77,254,163,1,126,4,104,5,113,128,
+128,118,46,60,11,181,151,78,108,31,111,185,207,178,195,35,232,205,166,146,
+31,149,118,140,109,93,99,76,59,53,86,103,68,131,151,54,46,56,38,32,77,72,
+74,100,26,87,36,146,146,117,63,51,149,251,6,0,4,255,235,0,0,9,127,4,250,0,
+61,0,72,0,90,0,91,0,0,1,23,22,21,20,6,35,34,0,3,55,18,18,51,50,54,53,52,39,
+6,6,35,34,38,53,52,55,6,35,33,53,33,21,35,17,35,38,36,39,39,54,55,38,38,53,
+52,55,35,22,21,20,6,35,34,39,6,21,20,22,51,50,54,37,22,51,50,54,53,52,38,
+35,34,6,1,6,6,7,22,4,23,38,53,17,33,6,21,20,22,51,50,55,5,4,15,112,66,252,
+220,244,254,169,99,151,81,255,204,149,166,13,70,154,101,117,137,89,58,57,
+254,44,9,148,215,157,114,254,135,209,73,109,129,142,151,66,235,8,150,135,
+83,80,2,52,57,70,146,254,216,68,70,69,74,52,45,59,97,4,181,106,205,100,179,
+1,32,125,4,253,202,96,95,83,109,111,254,132,3,100,5,126,128,164,190,1,80,
+1,80,43,254,223,254,236,110,102,40,46,61,73,154,125,170,113,3,146,146,251,
+152,153,200,14,178,82,80,14,132,107,93,75,26,30,100,116,23,26,25,61,57,76,
+213,20,53,47,39,40,84,254,219,64,139,74,34,146,135,118,30,3,23,70,92,67,72,
+76,212,0,5,255,235,252,218,7,178,4,250,0,53,0,64,0,96,0,97,0,98,0,0,1,38,
+38,53,52,54,51,51,22,51,38,39,6,6,35,34,0,3,55,18,18,51,50,54,53,52,39,6,
+6,35,34,38,53,52,55,6,35,33,53,33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,
+1,22,51,50,54,53,52,38,35,34,6,5,23,22,21,20,6,7,22,21,21,20,7,22,23,38,53,
+17,33,22,21,20,6,35,34,39,6,21,20,22,51,50,54,1,7,4,121,107,117,156,111,5,
+2,2,20,55,64,188,125,244,254,169,99,151,81,255,204,149,166,13,70,154,101,
+117,137,89,58,57,254,44,7,199,215,157,108,189,90,61,63,64,66,253,200,68,70,
+69,74,52,45,59,97,1,106,112,66,7,7,140,1,128,130,2,253,232,8,150,135,83,80,
+2,52,57,70,146,2,235,100,254,253,40,142,83,106,132,1,89,45,61,61,1,80,1,80,
+43,254,223,254,236,110,102,40,46,61,73,154,125,170,113,3,146,146,250,168,
+88,132,120,52,45,41,56,24,4,93,20,53,47,39,40,84,206,5,126,128,27,50,23,103,
+171,8,4,4,41,138,47,114,3,159,26,30,100,116,23,26,25,61,57,76,249,212,12,
+0,5,255,235,0,0,12,52,4,250,0,98,0,109,0,127,0,133,0,134,0,0,1,23,22,21,20,
+6,35,34,0,3,55,18,18,51,50,54,53,52,39,6,6,35,34,38,53,52,55,6,35,33,53,33,
+21,33,21,4,4,21,20,6,35,34,39,55,22,51,50,53,52,38,39,17,35,53,38,38,35,34,
+6,21,20,23,7,38,53,52,54,55,38,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,
+33,22,21,20,6,35,34,39,6,21,20,22,51,50,54,37,22,51,50,54,53,52,38,35,34,
+6,1,38,38,53,53,52,55,33,22,23,22,22,23,22,22,23,38,53,3,7,6,22,23,53,53,
+4,15,112,66,252,220,244,254,169,99,151,81,255,204,149,166,13,70,154,101,117,
+137,89,58,57,254,44,12,73,253,121,1,25,1,2,141,128,73,42,11,34,35,145,175,
+205,157,111,192,98,71,73,36,152,52,140,119,37,165,101,71,73,35,151,52,147,
+123,22,57,254,132,8,150,135,83,80,2,52,57,70,146,254,216,68,70,69,74,52,45,
+59,97,6,107,186,186,1,254,185,45,4,140,197,9,86,154,67,4,215,1,5,84,137,3,
+100,5,126,128,164,190,1,80,1,80,43,254,223,254,236,110,102,40,46,61,73,154,
+125,170,113,3,146,146,225,6,192,149,113,140,10,147,4,106,94,100,4,253,8,168,
+160,142,63,54,56,49,62,86,98,98,128,15,112,128,63,54,54,51,62,87,97,100,127,
+14,79,57,26,30,100,116,23,26,25,61,57,76,213,20,53,47,39,40,84,254,200,5,
+169,151,19,11,11,71,77,38,215,127,23,117,95,31,105,2,115,16,81,120,6,223,
+146,0,6,255,235,0,0,6,251,4,250,0,30,0,39,0,59,0,78,0,79,0,80,0,0,3,33,21,
+33,21,22,22,51,51,50,22,22,21,20,2,4,35,34,38,38,53,53,6,6,35,34,38,38,53,
+17,35,5,22,22,51,51,50,23,53,33,7,22,21,17,20,22,22,51,50,54,54,53,52,38,
+38,35,35,34,38,38,5,20,23,17,20,22,22,51,50,54,54,53,52,38,35,35,34,38,38,
+19,19,21,7,16,252,191,74,173,141,34,94,119,72,141,254,245,162,92,126,76,79,
+180,100,97,117,56,189,1,90,61,145,113,40,67,46,254,40,4,4,23,54,49,90,164,
+94,25,47,52,12,91,103,110,2,82,1,25,62,58,102,189,108,55,88,9,96,127,128,
+131,116,4,250,146,36,131,95,41,108,90,126,254,249,188,66,134,142,13,75,75,
+68,111,122,2,60,38,78,59,12,187,199,55,50,254,250,72,62,32,101,148,65,36,
+41,20,22,60,6,12,13,254,73,94,84,45,133,191,86,51,58,34,76,1,193,251,6,0,
+0,7,255,235,255,155,7,244,4,250,0,52,0,61,0,77,0,97,0,98,0,99,0,100,0,0,3,
+33,21,33,21,22,22,51,51,55,54,51,50,22,22,21,20,6,7,22,4,23,7,38,36,37,55,
+22,51,50,36,53,52,38,39,22,21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,17,35,
+5,22,22,51,51,50,23,53,33,5,22,21,21,20,22,22,51,50,54,53,52,38,35,35,34,
+37,22,21,17,20,22,22,51,50,54,54,53,52,38,38,35,35,34,38,38,1,19,39,21,8,
+9,251,198,63,144,110,100,24,49,31,126,177,91,195,178,121,1,1,136,72,217,253,
+250,254,210,19,141,141,244,1,10,99,93,10,119,211,126,66,97,31,74,236,132,
+97,117,56,189,1,90,61,145,113,40,67,46,254,40,2,114,3,22,53,57,121,168,37,
+69,13,187,253,20,4,23,54,49,90,164,94,25,46,53,12,91,103,110,3,182,158,174,
+4,250,146,15,76,52,1,3,92,169,93,162,214,42,27,98,70,123,117,147,30,146,27,
+182,141,90,113,15,30,29,97,161,92,30,31,118,132,68,111,122,2,60,38,78,59,
+12,187,169,64,34,125,61,55,34,129,72,27,32,83,55,50,254,250,72,62,32,101,
+148,65,36,41,20,22,60,1,129,251,6,166,0,0,8,255,235,252,218,8,99,4,250,0,
+53,0,73,0,106,0,127,0,128,0,129,0,130,0,131,0,0,5,35,38,38,35,34,7,6,35,34,
+38,38,39,46,2,53,17,35,53,33,21,33,21,22,22,51,51,50,22,22,23,54,51,50,22,
+23,54,54,51,50,22,21,20,7,22,21,20,6,35,34,39,22,21,1,22,21,17,20,22,22,51,
+50,54,54,53,52,38,38,35,35,34,38,38,1,6,6,7,30,2,51,50,55,54,51,50,23,17,
+52,38,38,35,34,6,6,21,20,22,51,50,55,23,6,35,34,38,37,54,54,53,52,38,35,34,
+6,7,21,22,22,51,50,54,53,52,39,6,7,1,17,3,7,5,161,153,23,94,77,63,107,107,
+62,175,176,77,1,54,78,26,189,8,120,248,226,61,145,113,61,74,100,69,10,97,
+96,117,140,22,75,162,87,117,139,76,87,159,138,167,120,4,251,160,4,23,54,49,
+90,164,94,25,46,53,12,91,103,110,1,125,64,129,64,3,62,105,94,55,101,100,61,
+152,68,25,61,52,67,127,83,50,49,40,45,14,48,82,77,102,3,123,112,94,53,48,
+85,161,67,44,146,102,63,70,45,59,75,254,109,2,100,240,94,84,17,18,89,161,
+117,16,81,104,85,2,60,146,146,38,78,59,27,78,65,55,86,86,77,77,116,96,94,
+66,72,96,99,132,138,47,80,3,101,55,50,254,250,72,62,32,101,148,65,36,41,20,
+22,60,253,243,48,54,5,80,91,37,18,17,111,2,52,72,62,32,74,121,51,45,38,7,
+140,16,71,176,21,62,50,36,40,103,99,41,125,125,49,48,58,39,24,16,3,164,251,
+6,252,230,12,0,7,255,235,252,218,4,103,4,250,0,52,0,72,0,73,0,74,0,75,0,76,
+0,77,0,0,1,38,38,53,52,54,51,50,22,23,38,53,53,52,55,6,6,35,34,38,38,53,17,
+35,53,33,21,33,21,22,22,51,51,50,30,2,21,20,6,7,17,35,53,38,38,35,34,6,21,
+20,22,23,19,22,21,17,20,22,22,51,50,54,54,53,52,38,38,35,35,34,38,38,19,19,
+3,3,7,1,16,107,117,156,111,114,210,110,2,3,63,136,73,97,117,56,229,4,124,
+253,6,61,145,113,61,83,87,58,29,50,50,157,112,200,95,61,63,64,66,17,4,23,
+54,49,90,164,94,25,46,53,12,91,103,110,130,218,115,10,2,254,184,40,142,83,
+106,134,108,121,47,118,71,79,71,40,39,68,111,122,2,60,146,146,38,78,59,29,
+54,83,54,66,132,65,252,226,84,142,133,52,45,41,56,24,4,92,55,50,254,250,72,
+62,32,101,148,65,36,41,20,22,60,1,129,251,6,252,218,2,43,79,255,255,255,235,
+253,220,7,244,4,250,2,34,1,52,0,0,0,3,0,129,7,114,0,0,0,10,255,235,252,218,
+7,244,4,250,0,84,0,93,0,109,0,129,0,130,0,131,0,132,0,133,0,134,0,135,0,0,
+1,35,38,38,35,34,7,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,55,54,51,50,
+23,53,38,36,39,55,22,51,50,36,53,52,38,39,22,21,20,6,6,35,34,38,39,6,6,35,
+34,38,38,53,17,35,53,33,21,33,21,22,22,51,51,55,54,51,50,22,22,21,20,6,7,
+22,4,23,7,38,39,22,21,1,22,22,51,51,50,23,53,33,5,22,21,21,20,22,22,51,50,
+54,53,52,38,35,35,34,37,22,21,17,20,22,22,51,50,54,54,53,52,38,38,35,35,34,
+38,38,1,19,1,3,7,1,6,90,153,25,109,91,53,110,110,63,169,186,10,4,157,11,93,
+111,52,90,90,53,184,79,125,254,228,159,19,141,141,244,1,10,99,93,10,119,211,
+126,66,97,31,74,236,132,97,117,56,189,8,9,251,198,63,144,110,100,24,49,31,
+126,177,91,195,178,121,1,1,136,72,137,180,5,250,235,61,145,113,40,67,46,254,
+40,2,114,3,22,53,57,121,168,37,69,13,187,253,20,4,23,54,49,90,164,94,25,46,
+53,12,91,103,110,3,182,160,253,141,10,2,1,142,254,182,91,87,17,18,147,144,
+31,79,11,14,40,56,80,75,18,17,111,205,36,52,16,146,27,182,141,90,113,15,30,
+29,97,161,92,30,31,118,132,68,111,122,2,60,146,146,15,76,52,1,3,92,169,93,
+162,214,42,27,98,70,123,76,65,57,83,4,166,78,59,12,187,169,64,34,125,61,55,
+34,129,72,27,32,83,55,50,254,250,72,62,32,101,148,65,36,41,20,22,60,1,129,
+251,6,252,218,2,43,79,1,240,0,4,255,235,255,241,10,171,4,250,0,73,0,108,0,
+109,0,110,0,0,1,22,22,51,50,55,22,22,51,50,55,23,6,6,21,20,22,23,7,38,53,
+52,55,6,35,34,37,6,6,21,20,22,51,50,54,55,23,22,21,20,6,35,34,36,39,6,35,
+32,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,53,52,54,55,6,35,33,53,33,21,
+1,22,22,51,50,54,53,52,39,6,6,35,34,38,53,52,55,35,34,38,39,14,2,21,20,22,
+51,50,54,55,23,22,21,20,1,1,4,117,48,164,116,111,117,179,216,112,112,149,
+99,46,44,33,38,154,77,62,65,109,239,254,248,65,75,54,45,61,108,87,177,42,
+233,214,169,254,251,101,120,250,254,238,254,164,104,156,85,1,15,217,140,146,
+15,80,144,78,117,141,129,126,54,130,253,177,10,192,250,32,80,224,155,143,
+148,15,80,144,78,117,141,72,31,150,246,73,128,140,50,54,45,61,108,87,177,
+42,2,177,1,208,4,104,76,75,34,80,48,29,146,81,167,117,95,177,108,36,240,209,
+196,121,14,115,45,100,60,47,54,56,83,61,100,121,175,205,147,151,152,1,135,
+1,135,45,254,169,254,183,126,127,56,45,71,61,139,119,97,169,61,3,146,146,
+253,143,164,161,126,127,56,45,71,61,139,119,98,78,139,127,63,108,90,46,47,
+54,56,83,61,100,121,23,2,236,251,6,0,7,255,234,252,218,9,143,4,250,0,40,0,
+55,0,77,0,86,0,87,0,88,0,89,0,0,1,17,35,38,39,17,35,38,38,39,39,6,6,35,32,
+0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,53,52,54,55,6,35,33,53,33,21,5,
+23,51,17,22,22,23,38,53,17,33,22,22,51,50,37,6,6,21,20,22,51,50,54,55,23,
+22,21,20,6,7,36,55,17,7,6,36,1,6,6,7,22,22,23,38,53,21,3,7,8,184,157,92,177,
+157,97,240,175,72,50,122,71,254,233,254,138,110,156,98,1,32,226,151,156,16,
+81,153,84,123,148,142,133,57,137,253,136,9,165,253,31,95,1,80,153,42,6,252,
+78,61,227,167,59,253,106,143,152,59,48,66,119,93,177,42,66,64,1,15,218,32,
+212,254,189,2,55,101,199,98,123,203,79,7,157,100,4,104,251,32,184,139,254,
+68,99,124,28,161,21,21,1,160,1,150,45,254,146,254,166,132,133,58,51,70,62,
+140,120,103,180,62,3,146,146,181,139,254,75,50,157,72,67,97,3,104,94,93,138,
+73,144,84,51,55,57,82,63,103,125,91,150,52,143,74,1,96,1,7,129,253,148,39,
+89,50,29,97,69,84,68,76,252,230,12,0,0,7,255,235,252,218,11,48,4,250,0,51,
+0,87,0,109,0,118,0,119,0,120,0,121,0,0,1,22,22,51,50,55,22,22,51,50,55,23,
+17,35,38,38,39,39,6,35,34,36,39,6,35,32,0,3,55,18,0,51,50,54,53,52,39,6,6,
+35,34,38,53,52,54,55,6,35,33,53,33,21,1,22,22,51,50,54,53,52,39,6,6,35,34,
+38,53,52,55,7,6,38,38,39,14,2,21,20,22,51,50,54,55,23,22,21,20,1,6,6,21,20,
+22,51,50,54,55,23,22,21,20,7,54,55,17,6,35,34,36,1,6,6,7,22,22,23,38,53,1,
+1,7,4,117,48,164,116,107,121,208,244,143,110,148,99,157,97,240,175,34,106,
+153,170,254,251,101,120,250,254,238,254,164,104,156,85,1,15,217,140,146,15,
+80,144,78,117,141,129,126,54,130,253,177,11,69,249,155,80,224,155,143,148,
+15,80,144,78,117,141,72,16,57,181,185,61,128,140,50,54,45,61,108,87,177,42,
+1,215,68,74,54,45,61,108,87,177,42,20,212,167,75,122,147,254,232,2,112,101,
+199,98,123,203,79,7,253,195,2,61,100,4,104,76,75,34,80,48,29,146,252,18,99,
+124,28,71,59,147,151,152,1,135,1,135,45,254,169,254,183,126,127,56,45,71,
+61,139,119,97,169,61,3,146,146,253,143,164,161,126,127,56,45,71,61,139,119,
+98,79,1,3,36,126,107,63,108,90,46,47,54,56,83,61,100,121,23,1,71,47,99,60,
+47,54,56,83,61,100,121,66,57,109,56,1,50,14,54,254,19,39,89,50,29,97,69,84,
+68,4,173,247,236,12,0,0,5,0,91,0,0,6,82,5,129,0,51,0,71,0,80,0,81,0,82,0,
+0,1,20,7,54,54,51,50,22,21,20,7,22,21,20,6,35,34,38,39,22,21,17,35,38,36,
+39,39,54,36,55,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,38,53,53,
+51,23,19,54,53,52,38,35,34,6,7,21,22,22,51,50,54,53,52,39,6,7,37,6,4,7,22,
+4,23,38,53,17,1,3,239,3,74,157,95,125,152,96,107,161,139,101,159,59,8,157,
+93,254,155,210,80,166,1,54,144,59,176,88,71,75,67,107,130,162,132,140,235,
+95,5,108,49,243,202,71,62,85,156,71,47,161,107,62,79,78,39,62,254,78,149,
+254,238,126,162,1,58,80,7,1,106,4,163,58,40,80,74,130,103,130,80,80,124,111,
+141,89,89,60,58,254,108,174,251,34,189,94,145,50,95,105,52,46,55,40,121,100,
+121,109,128,135,135,58,90,250,135,254,81,33,117,50,58,118,117,81,147,154,
+64,54,81,49,15,13,120,50,121,72,37,197,125,79,82,3,123,254,85,0,0,8,0,93,
+255,21,5,139,5,4,0,75,0,95,0,107,0,108,0,109,0,110,0,111,0,112,0,0,37,22,
+22,23,7,38,36,37,55,22,51,32,53,52,39,6,6,35,34,38,53,52,54,55,54,54,53,52,
+38,35,34,6,6,21,20,23,7,38,38,53,52,54,54,51,50,22,23,54,54,51,50,22,21,20,
+7,22,21,20,6,35,34,38,39,6,7,6,21,20,22,23,30,2,21,20,6,19,54,54,53,52,38,
+35,34,6,7,22,22,51,50,54,53,52,39,6,7,1,38,38,53,53,6,6,21,20,22,51,50,19,
+3,39,7,5,3,40,128,236,108,65,190,253,244,254,247,15,126,153,1,65,60,59,160,
+93,131,156,129,183,104,82,77,78,70,129,76,68,109,62,64,122,210,124,101,146,
+23,77,166,90,117,139,76,87,159,138,125,205,70,14,29,2,54,49,93,84,46,99,143,
+112,94,53,48,87,160,73,47,146,106,63,70,45,59,75,254,116,79,63,108,90,72,
+63,131,93,59,38,10,2,160,55,29,86,58,117,99,136,23,147,28,162,63,60,75,82,
+134,103,89,145,95,54,88,58,47,53,51,81,33,54,36,124,35,105,60,74,156,95,85,
+76,81,82,116,96,94,66,72,96,99,132,159,147,15,22,8,26,33,69,40,75,84,95,46,
+89,129,3,80,21,62,50,36,40,108,107,141,137,49,48,58,39,24,16,254,214,57,90,
+50,1,53,84,51,50,60,3,98,251,6,15,104,19,0,4,0,58,255,241,6,109,5,4,0,88,
+0,108,0,109,0,110,0,0,1,23,22,21,20,6,35,32,0,3,55,22,18,22,22,51,50,54,53,
+52,39,6,35,34,38,53,52,54,54,55,54,54,53,52,38,35,34,6,6,21,20,23,7,38,38,
+53,52,54,54,51,50,23,54,54,51,50,22,21,20,7,22,21,20,7,23,6,21,20,23,7,38,
+53,52,55,6,35,34,38,39,6,7,6,6,21,20,22,51,50,54,1,54,54,53,52,38,35,34,6,
+7,22,22,51,50,54,53,52,39,6,7,1,1,3,234,155,32,218,193,254,232,254,166,94,
+157,47,117,132,159,108,122,135,8,110,113,115,141,47,85,87,101,48,67,63,63,
+121,76,68,109,62,64,124,197,106,222,41,82,160,87,117,139,76,87,66,32,90,67,
+149,73,31,24,25,130,200,69,28,61,95,60,48,43,55,98,1,68,112,94,53,48,87,160,
+73,47,146,106,63,70,45,59,75,254,150,1,223,2,66,55,79,121,149,174,1,158,1,
+139,45,196,254,240,157,74,101,92,30,29,69,124,95,53,100,83,63,73,74,33,46,
+54,50,81,34,54,36,124,35,105,60,73,155,97,158,85,75,116,96,94,66,72,96,90,
+63,34,112,151,138,138,33,191,171,84,84,2,152,153,28,46,70,69,39,41,45,48,
+1,152,21,62,50,36,40,108,107,141,137,49,48,58,39,24,16,1,212,251,6,0,10,0,
+94,252,218,7,91,5,7,0,75,0,95,0,105,0,114,0,115,0,116,0,117,0,118,0,119,0,
+120,0,0,1,54,54,51,50,22,21,20,7,22,21,20,6,7,17,35,38,39,17,35,38,38,39,
+39,54,36,55,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,
+23,17,52,38,38,35,34,6,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,54,51,50,
+22,1,54,53,52,38,35,34,6,7,21,22,22,51,50,54,53,52,39,6,7,19,38,53,53,38,
+38,39,17,22,22,37,6,6,7,22,22,23,38,53,17,17,1,3,7,1,4,238,79,158,96,125,
+152,96,107,91,85,157,92,187,157,97,240,175,73,134,1,12,134,49,105,70,112,
+112,67,237,219,20,155,18,134,150,59,109,109,65,164,73,25,67,57,74,139,86,
+56,51,42,49,14,50,86,107,130,129,217,116,133,151,1,8,202,71,62,86,156,71,
+45,163,108,62,79,78,39,62,7,6,86,139,54,83,160,254,112,101,199,98,122,202,
+81,7,254,240,10,2,2,150,4,58,85,76,130,103,130,80,80,124,82,125,27,253,168,
+186,145,254,89,99,124,28,164,76,124,49,50,18,19,198,196,88,99,23,65,91,125,
+123,18,17,111,2,39,69,64,33,72,111,47,43,34,7,144,16,112,101,88,186,118,108,
+254,176,33,117,50,58,119,118,76,148,156,64,54,81,49,15,13,253,35,67,97,210,
+6,84,77,254,254,50,160,164,39,89,50,27,97,71,84,68,5,7,251,6,252,218,2,43,
+79,4,153,0,3,255,235,255,202,5,78,7,86,0,74,0,75,0,76,0,0,1,39,54,51,50,22,
+21,20,6,7,22,21,20,6,35,34,0,3,55,22,22,51,50,54,53,52,39,6,6,35,34,38,38,
+53,17,33,53,33,38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,
+22,23,33,21,33,17,20,22,51,50,54,54,53,52,38,35,34,3,1,3,79,23,91,73,115,
+121,69,67,49,232,210,226,254,181,99,151,79,238,198,125,154,17,67,139,72,88,
+126,77,254,93,3,186,4,75,84,203,191,171,79,11,151,9,55,112,110,170,123,146,
+81,5,1,21,252,221,70,70,93,172,104,55,56,50,194,254,149,3,58,142,21,115,108,
+70,155,72,80,107,157,179,1,21,1,14,49,226,220,98,88,50,39,41,40,69,145,143,
+1,225,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,146,254,24,
+127,77,94,148,64,53,45,252,184,7,86,0,0,5,255,235,252,218,6,53,7,86,0,56,
+0,87,0,88,0,89,0,90,0,0,1,38,38,53,52,54,55,38,39,6,6,35,34,38,38,53,17,35,
+53,33,38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,33,
+21,35,17,35,53,38,38,35,34,6,21,20,22,23,1,33,17,20,22,22,51,50,54,54,53,
+52,35,34,7,39,54,51,50,22,21,20,6,7,22,23,22,22,23,38,53,19,7,1,2,232,107,
+117,146,116,19,41,65,141,77,98,122,51,189,3,22,4,75,84,153,191,171,79,11,
+151,9,55,112,110,120,123,146,81,5,2,160,215,157,115,198,94,61,63,64,66,1,
+145,252,132,18,55,55,79,154,116,118,58,44,21,79,78,118,126,69,61,98,6,73,
+142,70,4,15,100,253,82,254,244,40,142,83,102,132,4,60,47,44,43,72,115,113,
+2,61,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,146,250,168,
+54,145,132,52,45,41,56,24,4,231,253,202,61,68,37,83,157,82,102,11,139,20,
+121,112,77,156,67,105,118,24,102,79,57,137,252,29,12,10,124,0,0,3,255,235,
+0,0,9,228,5,129,0,41,0,80,0,81,0,0,1,17,35,17,38,38,35,34,6,7,54,51,50,22,
+21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,38,53,53,51,23,
+51,21,1,20,22,22,51,50,54,55,55,22,21,20,4,35,32,0,3,55,18,0,51,50,54,53,
+52,39,6,6,35,34,38,38,53,17,33,53,33,21,33,37,9,13,157,136,205,113,83,137,
+70,74,120,123,142,161,174,104,140,135,73,61,48,90,61,165,102,236,139,133,
+225,119,7,108,47,217,248,244,13,35,28,61,134,85,122,138,254,248,227,254,213,
+254,133,116,155,101,1,37,237,159,185,56,81,167,79,78,110,47,253,176,4,237,
+254,0,5,27,4,104,251,152,3,32,186,152,79,101,39,141,101,119,191,93,149,58,
+120,68,48,59,22,29,134,178,173,131,144,100,86,210,135,146,254,146,45,41,29,
+115,124,20,203,202,202,249,1,193,1,197,42,254,111,254,124,160,133,128,89,
+112,107,70,120,104,1,82,146,146,146,0,0,4,255,235,0,0,9,68,4,250,0,43,0,70,
+0,71,0,72,0,0,1,20,22,22,51,50,54,55,55,22,21,20,4,35,34,36,39,6,6,35,32,
+0,3,55,18,18,51,50,54,53,52,39,6,35,34,38,38,53,53,33,53,33,21,33,1,20,22,
+51,50,54,55,55,22,23,22,4,51,50,54,53,52,39,6,6,35,34,38,38,53,17,33,37,19,
+6,84,13,35,28,61,134,85,122,138,254,248,227,207,254,220,107,55,200,133,254,
+254,254,177,99,151,81,255,200,140,158,40,143,162,70,92,39,253,249,9,89,253,
+16,252,59,38,26,53,110,75,117,99,15,91,1,9,193,158,186,56,81,167,79,78,110,
+47,252,216,3,218,140,2,250,45,41,29,115,124,20,203,203,201,249,206,209,89,
+96,1,92,1,88,42,254,213,254,228,121,107,90,72,183,63,97,83,247,146,146,254,
+252,52,33,93,103,19,136,151,255,251,162,131,129,88,112,107,70,120,104,1,82,
+146,251,6,0,0,4,255,235,252,218,7,55,4,250,0,50,0,72,0,73,0,74,0,0,1,38,38,
+53,52,54,51,51,22,51,38,39,6,6,35,32,0,3,55,18,18,51,50,54,53,52,39,6,35,
+34,38,38,53,53,33,53,33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,1,20,22,
+51,50,54,55,55,22,21,20,6,7,22,23,22,22,23,38,53,17,33,1,7,3,234,107,117,
+156,111,6,3,3,17,36,54,127,72,254,254,254,177,99,151,81,255,200,139,159,40,
+143,162,70,92,39,253,249,7,76,215,157,115,198,94,61,63,64,66,254,93,38,26,
+53,110,75,117,125,41,40,91,3,66,133,68,4,252,204,3,69,100,254,244,40,142,
+83,106,132,1,56,43,27,26,1,92,1,88,42,254,213,254,228,120,108,88,73,182,63,
+97,83,247,146,146,250,168,54,145,132,52,45,41,56,24,3,227,52,33,93,103,19,
+173,169,68,117,48,108,109,24,100,75,57,137,3,159,248,126,12,0,0,4,255,235,
+255,184,9,131,5,129,0,41,0,78,0,90,0,91,0,0,1,17,35,17,38,38,35,34,6,7,54,
+51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,38,53,
+53,51,23,51,21,1,20,22,51,50,54,55,55,22,21,20,6,35,32,0,3,55,18,18,51,50,
+54,53,52,39,6,35,34,38,38,53,53,33,53,33,21,33,19,34,38,53,52,54,51,50,22,
+21,20,6,1,8,172,157,136,205,113,83,137,70,74,120,123,142,161,174,104,140,
+135,73,61,48,90,61,165,102,236,139,133,225,119,7,108,47,217,249,12,38,26,
+53,110,75,117,125,241,207,254,254,254,177,99,151,81,255,200,139,159,40,143,
+162,70,92,39,253,249,4,20,254,144,13,50,74,71,53,50,70,70,4,196,4,104,251,
+152,3,32,186,152,79,101,39,141,101,119,191,93,149,58,120,68,48,59,22,29,134,
+178,173,131,144,92,94,210,135,146,254,252,52,33,93,103,19,173,169,168,208,
+1,92,1,88,42,254,213,254,228,120,108,88,73,182,63,97,83,247,146,146,251,80,
+68,52,51,70,70,51,52,68,5,66,0,0,3,0,92,0,0,6,222,7,86,0,76,0,77,0,78,0,0,
+1,39,54,51,50,22,21,20,2,4,35,34,38,38,53,17,38,38,35,34,6,21,20,22,23,7,
+38,38,53,52,54,51,50,22,23,38,53,53,33,38,38,35,35,34,38,38,53,52,55,23,6,
+21,20,22,22,51,51,50,22,22,23,51,21,33,17,20,22,22,51,50,54,54,53,52,38,35,
+34,3,1,4,200,23,79,90,126,136,155,254,249,151,93,127,75,94,173,79,74,88,72,
+77,73,118,126,175,122,104,183,95,3,2,103,4,75,84,193,191,171,79,11,151,9,
+55,112,110,160,123,146,81,5,227,252,191,28,63,56,92,177,131,69,72,46,72,254,
+145,2,219,146,21,142,135,134,254,246,171,67,135,140,2,13,111,111,75,65,55,
+78,32,146,51,165,102,128,153,90,101,51,52,75,87,71,85,142,100,47,62,10,46,
+32,74,90,37,47,131,127,146,253,59,98,83,42,109,201,107,68,64,253,23,7,86,
+0,4,0,92,0,0,5,231,7,86,0,52,0,66,0,67,0,68,0,0,1,23,6,6,21,20,22,23,33,21,
+33,34,39,22,18,21,20,0,35,34,36,39,55,54,54,55,38,38,35,34,6,21,20,22,23,
+7,38,38,53,52,54,51,50,22,23,38,38,39,38,38,53,52,54,1,22,21,20,6,7,22,22,
+51,50,54,53,52,38,3,3,2,214,105,67,59,74,96,2,124,254,155,66,59,183,150,254,
+238,241,165,254,245,61,45,195,208,14,107,197,90,74,88,72,77,73,118,126,175,
+122,118,192,107,13,64,66,71,49,88,1,42,32,222,221,42,174,111,166,186,129,
+89,143,7,86,114,51,90,58,55,128,108,146,4,182,254,213,159,226,254,246,185,
+159,161,19,175,156,142,142,76,65,54,78,32,146,51,165,102,128,153,112,122,
+45,106,94,100,132,60,79,140,253,6,106,109,184,237,53,97,109,192,156,142,253,
+252,129,6,196,0,0,3,0,58,0,0,5,115,5,4,0,55,0,56,0,57,0,0,1,55,55,22,22,21,
+20,6,7,22,22,21,20,4,35,32,0,3,55,18,0,33,50,54,53,52,39,6,6,7,39,54,54,53,
+52,39,7,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,39,19,3,196,
+121,125,80,84,51,50,61,61,254,255,218,254,191,254,89,118,154,111,1,75,1,15,
+145,160,71,36,88,52,64,159,140,61,159,125,15,112,80,55,64,51,67,71,102,109,
+160,114,114,145,108,150,4,75,146,29,63,160,87,75,132,56,49,133,84,166,203,
+1,232,1,229,47,254,70,254,89,118,107,90,67,25,45,20,148,60,144,97,88,64,193,
+6,110,120,58,44,47,66,32,145,45,148,96,111,131,93,83,251,6,0,3,0,92,0,0,6,
+222,5,7,0,53,0,54,0,55,0,0,1,39,54,51,50,22,21,20,2,4,35,34,38,38,53,17,38,
+38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,53,33,21,33,17,
+20,22,22,51,50,54,54,53,52,38,35,34,3,19,4,200,23,79,90,126,136,155,254,249,
+151,93,127,75,94,173,79,74,88,72,77,73,118,126,175,122,104,182,96,3,3,222,
+252,191,28,63,56,95,179,126,70,73,45,187,116,2,219,146,21,142,135,134,254,
+246,171,67,135,140,2,13,111,111,75,65,55,78,32,146,51,165,102,128,153,90,
+101,50,53,75,146,253,59,98,83,42,116,197,104,69,63,2,17,251,6,0,0,2,0,92,
+0,0,4,231,5,129,0,51,0,52,0,0,1,38,53,17,38,38,35,34,6,21,20,22,23,7,38,38,
+53,52,54,51,50,22,23,38,53,53,51,23,51,21,35,17,35,17,38,38,35,34,6,21,20,
+22,23,7,38,38,53,52,54,51,50,22,3,3,118,3,119,223,104,81,96,86,91,79,130,
+136,191,140,126,222,119,7,108,47,217,215,157,94,173,79,74,88,72,77,73,118,
+126,175,122,104,182,32,1,180,50,53,1,14,164,165,83,72,61,89,35,146,54,175,
+108,136,163,130,144,52,114,229,135,146,251,152,1,1,111,111,75,65,55,78,32,
+146,51,165,102,128,153,90,2,225,0,2,0,92,0,0,4,231,5,129,0,51,0,52,0,0,1,
+38,53,17,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,53,
+51,23,51,21,35,17,35,53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,
+22,3,3,117,2,119,223,104,81,96,86,91,79,130,136,191,140,126,222,119,7,108,
+47,217,215,157,115,198,94,61,63,64,66,72,107,117,156,111,114,208,17,1,23,
+36,37,1,201,164,165,83,72,61,89,35,146,54,175,108,136,163,130,144,52,114,
+229,135,146,251,152,83,146,130,52,45,41,56,24,141,40,142,83,106,134,106,3,
+107,0,0,3,0,92,0,0,6,241,5,129,0,46,0,54,0,55,0,0,37,38,38,53,52,54,55,17,
+38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,53,51,23,33,
+21,35,17,35,53,38,38,35,34,6,21,20,22,23,1,33,17,22,22,23,38,53,37,3,164,
+107,117,91,84,119,223,104,81,96,86,91,79,130,136,191,140,126,222,119,7,108,
+47,2,227,215,157,117,197,93,61,63,64,66,1,145,254,147,90,177,100,2,254,113,
+2,40,142,83,80,119,26,1,61,164,165,83,72,61,89,35,146,54,175,108,136,163,
+130,144,52,114,229,135,146,251,152,83,148,130,52,45,41,56,24,3,217,253,141,
+11,100,111,47,115,66,0,5,0,92,252,218,6,222,7,86,0,106,0,107,0,108,0,109,
+0,110,0,0,1,39,54,51,50,22,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,
+55,23,6,21,20,22,51,50,55,54,51,50,23,53,52,55,6,6,35,34,38,38,53,17,38,38,
+35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,53,33,38,38,35,35,
+34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,51,21,33,17,20,22,22,
+51,50,18,53,52,38,35,34,3,3,7,1,4,200,23,79,90,125,137,50,49,153,26,113,92,
+54,113,114,64,167,199,24,157,21,101,111,54,93,92,55,190,82,3,73,159,85,93,
+126,75,94,173,79,74,88,72,77,73,118,126,175,122,103,182,96,2,2,103,4,75,84,
+193,191,171,79,11,151,9,55,112,110,160,123,146,81,5,227,252,191,19,64,63,
+147,254,70,72,46,172,10,2,254,228,2,253,146,21,149,139,75,148,72,253,29,93,
+85,17,18,195,187,91,97,19,88,84,115,117,18,17,111,248,45,74,56,55,65,129,
+135,1,252,111,111,75,65,55,78,32,146,51,165,102,128,153,89,101,50,50,77,87,
+71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,146,253,80,75,89,50,1,6,
+152,72,67,249,207,2,43,79,8,160,0,0,6,0,58,252,218,5,115,5,4,0,85,0,86,0,
+87,0,88,0,89,0,90,0,0,1,55,55,22,22,21,20,6,7,22,22,21,20,6,7,17,35,38,38,
+35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,52,55,6,
+35,32,0,3,55,18,0,33,50,54,53,52,39,6,7,39,54,54,53,52,39,7,7,38,38,35,34,
+6,21,20,22,23,7,38,38,53,52,54,51,50,22,39,1,1,3,7,3,196,121,125,79,85,60,
+59,70,70,69,68,153,29,117,96,57,119,119,67,175,209,24,157,21,108,116,57,99,
+99,57,200,88,2,83,100,254,192,254,88,118,154,115,1,76,1,10,145,160,95,75,
+77,64,158,141,60,160,125,15,112,80,55,64,51,67,71,102,109,160,114,114,145,
+108,1,37,254,253,10,2,4,75,146,29,59,150,83,76,132,57,44,124,79,76,121,45,
+253,211,94,84,17,18,184,177,85,94,19,82,77,108,107,18,17,111,168,83,28,20,
+1,192,1,191,47,254,99,254,138,98,88,83,60,42,28,148,54,130,89,80,56,194,6,
+110,120,58,44,47,66,32,145,45,148,96,111,131,93,83,251,6,252,218,2,43,79,
+0,0,4,255,236,0,0,5,221,4,250,0,3,0,49,0,50,0,51,0,0,3,53,33,21,1,55,18,0,
+51,50,54,53,52,39,6,7,39,54,54,53,52,35,34,6,6,21,20,22,23,7,38,53,52,54,
+54,51,50,22,21,20,6,7,22,22,21,20,6,35,32,0,1,19,20,5,241,250,93,154,107,
+1,57,254,135,153,86,62,90,62,152,128,164,86,162,99,58,45,41,224,142,244,128,
+153,170,53,52,63,63,243,212,254,206,254,105,2,200,46,4,104,146,146,254,238,
+47,254,124,254,154,102,95,84,63,32,32,143,48,101,77,131,66,96,39,37,32,6,
+151,39,170,86,171,107,143,128,64,113,48,48,118,71,161,187,1,171,3,79,251,
+6,0,2,0,81,0,0,6,52,5,129,0,49,0,50,0,0,1,55,55,22,21,20,6,7,22,4,23,38,53,
+17,51,23,51,21,35,17,35,38,36,39,39,54,54,53,52,39,7,7,38,38,35,34,6,21,20,
+22,23,7,38,38,53,52,54,51,50,22,37,2,150,121,125,156,209,198,179,1,25,103,
+4,108,47,217,215,157,142,254,145,225,49,238,239,60,154,125,15,112,80,55,64,
+51,67,71,102,109,160,114,114,145,1,221,4,75,146,29,151,161,147,196,40,49,
+191,141,54,143,3,246,135,146,251,152,203,244,41,189,18,139,120,87,70,190,
+6,110,120,58,44,47,66,32,145,45,148,96,111,131,93,83,0,4,255,235,255,137,
+5,20,4,250,0,3,0,61,0,62,0,63,0,0,3,53,33,21,3,17,35,53,38,38,35,34,6,21,
+20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,53,52,55,6,35,34,0,3,55,22,22,
+51,50,54,53,52,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,20,6,1,19,21,5,
+41,244,157,112,200,95,61,63,64,66,72,107,117,156,111,118,207,109,2,3,76,100,
+247,254,182,92,148,82,237,192,142,149,119,100,123,17,146,31,148,125,174,210,
+54,254,91,210,4,104,146,146,253,170,253,149,54,142,133,52,45,41,56,24,141,
+40,142,83,106,134,106,122,37,36,130,41,53,21,1,34,1,28,43,245,222,93,89,78,
+100,81,36,36,29,70,66,87,95,183,134,73,116,2,188,251,6,0,0,1,255,235,255,
+167,7,84,4,250,0,66,0,0,1,33,53,33,21,35,17,35,53,38,38,35,34,6,21,20,22,
+23,7,38,38,53,52,54,51,51,38,39,6,6,35,34,0,3,55,22,22,51,50,54,53,52,38,
+35,34,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,22,23,22,22,23,38,53,5,224,
+250,11,7,105,215,157,115,198,94,61,63,64,66,72,107,117,156,111,6,13,34,58,
+153,94,247,254,182,92,148,82,237,192,142,149,119,100,123,17,146,31,148,125,
+174,210,19,18,104,1,68,137,69,2,4,104,146,146,251,63,84,145,132,52,45,41,
+56,24,141,40,142,83,106,132,48,48,39,39,1,34,1,28,43,245,222,93,89,78,100,
+81,36,36,29,70,66,87,95,183,134,40,74,34,107,118,23,100,77,47,115,0,4,255,
+235,255,95,5,70,4,250,0,3,0,70,0,71,0,72,0,0,3,53,33,21,1,38,35,34,6,21,20,
+23,7,38,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,51,50,22,23,53,
+6,6,35,34,0,3,55,22,22,51,50,54,53,52,38,35,34,21,20,23,7,38,53,52,54,51,
+50,22,21,20,6,7,17,35,1,1,21,5,91,254,130,62,61,48,52,5,125,15,106,78,59,
+70,172,59,136,136,156,121,82,135,39,45,95,47,74,41,50,123,72,247,254,182,
+92,148,82,237,192,142,149,119,100,123,17,146,31,148,125,174,210,20,19,157,
+254,233,1,23,4,104,146,146,252,35,67,57,58,27,26,6,101,114,58,47,107,57,139,
+50,154,105,102,136,68,63,89,31,39,205,23,22,1,34,1,28,43,245,222,93,89,78,
+100,81,36,36,29,70,66,87,95,183,134,42,77,34,253,69,5,83,251,6,0,255,255,
+255,236,253,242,5,221,4,250,2,34,1,79,0,0,0,3,0,129,5,110,0,22,0,2,255,235,
+255,241,8,237,5,129,0,67,0,68,0,0,3,53,33,21,33,17,54,36,55,23,54,54,51,50,
+22,23,38,53,53,51,23,51,21,35,17,35,17,38,38,35,34,6,7,54,51,50,22,21,20,
+6,7,39,54,54,53,52,38,35,34,6,7,39,6,6,21,20,22,23,7,38,53,52,55,6,4,7,39,
+17,37,21,3,186,253,160,110,1,67,212,19,96,227,131,133,225,119,7,108,47,217,
+215,157,136,205,113,83,137,70,74,120,123,142,163,172,104,140,135,73,61,48,
+90,61,41,46,46,33,38,154,77,66,159,254,205,149,121,6,84,4,104,146,146,253,
+200,125,218,93,20,156,156,131,144,79,107,210,135,146,251,152,3,32,186,152,
+79,101,39,141,101,121,193,89,149,58,120,68,48,59,22,29,33,89,193,134,99,185,
+115,36,253,217,209,131,77,238,162,82,2,216,146,0,4,255,235,255,241,8,186,
+4,250,0,31,0,48,0,58,0,59,0,0,3,53,33,21,35,17,35,38,36,39,39,54,55,38,38,
+39,6,6,21,20,22,23,7,38,53,52,55,6,4,7,39,17,1,6,7,22,4,23,38,53,17,33,6,
+21,20,22,51,50,55,1,54,36,55,23,39,38,54,55,33,1,21,8,207,215,157,114,254,
+135,209,73,97,126,81,115,35,45,38,33,38,154,77,66,159,254,205,149,121,5,237,
+158,252,186,1,29,120,4,253,202,96,95,83,109,111,251,7,110,1,67,212,65,1,4,
+33,37,252,249,5,3,4,104,146,146,251,152,153,200,14,178,79,81,10,56,45,94,
+184,118,99,185,115,36,253,217,209,131,77,238,162,82,2,216,254,165,94,184,
+35,149,130,118,30,3,23,70,92,67,72,76,254,169,125,218,93,64,14,49,91,42,254,
+75,0,3,255,235,255,243,6,189,4,250,0,40,0,41,0,42,0,0,1,54,36,55,23,6,21,
+20,23,7,38,38,53,52,55,6,6,7,39,38,53,52,55,6,6,7,39,17,35,53,33,21,33,17,
+54,36,55,23,6,21,20,19,1,3,138,119,1,12,149,119,79,55,152,29,34,41,111,238,
+126,118,28,38,109,231,155,117,189,6,210,250,136,120,1,13,148,119,79,197,1,
+22,1,245,109,165,57,119,144,212,165,172,33,92,203,85,194,84,52,178,125,74,
+133,96,162,91,50,171,152,75,2,68,146,146,254,91,108,165,56,119,133,210,38,
+2,226,251,6,0,0,6,255,235,252,218,6,200,4,250,0,40,0,48,0,49,0,50,0,51,0,
+52,0,0,1,54,36,55,23,17,35,38,38,39,39,54,36,55,17,6,6,7,39,38,53,52,55,6,
+6,7,39,17,35,53,33,21,33,17,54,36,55,23,6,21,20,1,6,7,22,22,23,38,53,1,1,
+3,7,3,138,119,1,12,149,79,157,97,240,175,73,136,1,72,121,112,238,126,118,
+28,38,109,231,155,117,189,6,221,250,125,120,1,13,148,119,79,1,206,201,197,
+122,202,81,7,254,247,254,255,10,2,1,245,109,165,57,80,251,199,99,124,28,164,
+79,151,40,1,34,53,178,125,74,133,96,162,91,50,171,152,75,2,68,146,146,254,
+91,108,165,56,119,133,210,38,254,185,77,101,27,97,71,84,68,5,6,247,224,2,
+43,79,0,4,255,235,252,218,5,4,4,250,0,39,0,40,0,41,0,42,0,0,3,53,33,21,33,
+17,54,36,55,23,17,35,53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,
+22,23,38,53,17,6,4,7,39,17,37,19,7,21,5,25,252,65,124,1,67,200,97,157,112,
+200,95,61,63,64,66,72,107,117,156,111,114,208,110,2,151,254,200,160,121,1,
+225,243,100,4,104,146,146,253,230,129,203,74,97,251,141,84,142,133,52,45,
+41,56,24,141,40,142,83,106,134,106,120,36,37,2,188,66,227,161,82,2,176,146,
+247,236,12,0,0,6,255,235,252,218,6,82,4,250,0,42,0,51,0,52,0,53,0,54,0,55,
+0,0,3,53,33,21,33,17,54,36,55,23,17,54,54,55,23,6,21,20,23,7,38,38,53,52,
+55,6,6,7,17,35,38,38,39,39,54,36,55,17,6,4,7,39,17,1,38,53,53,6,6,7,22,22,
+19,17,3,7,21,6,103,250,243,124,1,67,200,97,82,162,81,112,64,47,144,24,31,
+37,46,129,83,157,97,240,175,73,121,1,36,172,151,254,200,160,121,2,239,7,108,
+199,90,124,202,71,20,100,4,104,146,146,253,230,129,203,74,97,254,114,28,48,
+20,112,153,185,155,157,33,82,193,77,153,123,13,39,26,253,176,99,124,28,164,
+71,136,64,1,110,66,227,161,82,2,176,251,77,84,68,219,40,88,48,29,97,5,0,251,
+6,252,230,12,0,0,4,255,235,253,250,6,82,4,250,0,49,0,58,0,68,0,69,0,0,3,53,
+33,21,33,17,54,36,55,23,17,54,54,55,23,6,6,21,20,23,7,38,38,53,52,55,6,6,
+7,17,35,38,38,39,39,54,55,38,38,39,39,54,36,55,17,6,4,7,39,17,1,6,6,7,22,
+22,23,54,55,21,6,6,7,55,22,22,23,38,53,17,21,6,103,250,243,138,1,69,187,94,
+82,162,81,112,30,34,47,144,24,31,37,46,129,83,157,89,244,131,72,146,146,50,
+134,84,73,121,1,36,172,157,254,197,158,114,2,232,116,202,86,84,152,67,58,
+43,105,188,82,21,92,197,72,7,4,104,146,146,254,29,116,174,57,93,254,204,28,
+48,20,72,72,201,105,155,157,33,82,193,77,153,123,13,39,26,252,64,92,127,22,
+156,85,63,23,37,14,164,71,136,64,1,23,59,197,137,78,2,116,253,26,44,90,45,
+18,61,42,23,14,135,40,85,45,11,22,98,62,84,68,5,195,0,0,3,255,235,255,167,
+5,227,4,250,0,58,0,59,0,60,0,0,1,6,21,20,22,51,50,55,38,53,52,55,6,4,7,39,
+17,33,53,33,21,33,17,54,36,55,23,6,21,20,23,54,55,55,22,22,21,20,6,35,32,
+0,3,55,18,0,51,50,54,53,52,39,6,35,34,38,53,52,55,19,19,3,36,18,58,46,33,
+31,22,45,126,255,0,130,137,254,163,5,248,252,2,131,1,27,153,119,85,8,30,19,
+120,69,55,248,213,254,241,254,93,175,135,170,1,80,218,145,167,36,132,178,
+120,141,29,175,130,2,65,41,37,47,52,8,106,90,171,85,46,153,108,79,1,240,146,
+146,254,136,98,142,44,119,134,184,61,43,37,57,18,89,152,82,172,201,1,56,1,
+57,79,254,219,254,253,123,104,66,63,160,126,111,56,74,2,136,251,6,0,5,255,
+235,252,218,5,181,4,250,0,69,0,70,0,71,0,72,0,73,0,0,1,17,35,38,38,35,34,
+7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,52,55,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,55,38,53,52,55,6,4,7,39,17,33,53,33,21,33,
+17,54,36,55,23,6,21,20,23,54,55,1,1,3,7,4,222,148,22,98,83,63,117,118,74,
+215,214,20,155,18,129,148,59,106,105,64,161,71,3,113,158,120,141,36,150,25,
+60,49,35,36,34,45,126,255,0,130,137,254,223,5,202,251,244,131,1,27,153,119,
+85,16,24,19,254,186,1,79,2,100,1,225,253,47,91,87,17,18,180,181,79,92,23,
+58,80,109,111,18,17,111,250,45,46,127,126,111,64,81,49,50,43,48,51,12,153,
+106,171,85,46,153,108,79,1,240,146,146,254,136,98,142,44,119,134,184,89,64,
+31,42,2,243,251,6,252,230,12,0,3,255,235,255,168,6,212,4,250,0,32,0,49,0,
+50,0,0,5,38,38,53,52,54,55,38,53,52,55,6,4,7,39,17,35,53,33,21,35,17,35,53,
+38,38,35,34,6,21,20,22,23,1,33,17,54,36,55,23,6,6,21,20,23,22,22,23,38,53,
+37,3,135,107,117,103,91,12,42,148,254,205,159,121,189,6,233,215,157,115,198,
+94,61,63,64,66,1,145,251,229,124,1,67,200,128,37,42,9,90,174,84,2,254,108,
+86,40,142,83,85,122,23,74,64,167,94,66,225,159,82,2,176,146,146,251,64,84,
+145,132,52,45,41,56,24,4,49,253,230,129,203,74,125,64,159,107,65,66,15,110,
+94,47,115,66,0,2,0,75,255,121,4,168,5,8,0,49,0,58,0,0,5,38,38,53,52,54,51,
+50,22,23,53,38,36,39,39,54,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,
+54,55,53,33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,1,6,4,7,22,4,23,38,53,
+1,91,107,117,156,111,114,212,109,128,254,177,207,80,110,111,102,142,125,60,
+49,13,32,41,62,66,78,184,202,1,116,215,157,115,198,94,61,63,64,66,1,145,115,
+254,238,159,159,1,34,106,7,135,40,142,83,106,134,111,119,71,149,178,28,198,
+57,49,88,115,93,122,10,147,4,50,42,70,45,75,56,215,146,251,63,37,146,130,
+52,45,41,56,24,3,125,29,105,76,29,152,112,83,83,0,6,0,75,252,218,6,178,5,
+8,0,46,0,54,0,63,0,64,0,65,0,66,0,0,5,38,38,53,52,54,55,38,36,39,39,54,55,
+38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,55,53,33,21,35,17,35,53,
+38,38,35,34,6,21,20,22,23,1,33,17,22,22,23,38,53,1,6,4,7,22,4,23,38,53,1,
+7,1,3,101,107,117,62,57,117,254,208,188,80,112,110,103,142,125,60,49,13,32,
+41,62,66,39,40,196,189,3,126,215,157,115,198,94,61,63,64,66,1,145,254,147,
+90,177,100,2,253,246,120,254,236,157,193,1,24,87,7,1,216,100,254,251,238,
+40,142,83,65,104,32,131,169,38,198,56,49,88,116,93,122,10,147,4,50,42,37,
+55,24,80,52,215,146,250,168,84,145,132,52,45,41,56,24,4,201,252,157,11,100,
+111,47,115,2,186,30,105,75,57,172,116,83,83,250,232,12,4,49,0,5,255,236,255,
+167,5,252,4,250,0,67,0,68,0,69,0,70,0,71,0,0,1,22,21,20,6,7,22,22,21,20,6,
+35,32,0,3,55,18,0,51,50,54,53,52,38,35,34,21,20,22,23,7,38,53,52,54,55,38,
+39,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,53,
+52,39,33,53,33,21,37,3,19,39,5,19,69,111,103,105,114,231,204,254,239,254,
+94,177,135,171,1,74,223,140,149,119,95,128,10,10,147,33,92,92,62,106,65,47,
+26,39,50,38,47,112,141,137,94,68,114,86,78,91,57,74,76,97,251,145,6,16,253,
+216,1,89,63,4,104,107,116,114,139,20,41,177,115,175,213,1,66,1,71,79,254,
+203,254,245,129,108,99,130,95,16,52,18,25,71,70,77,95,17,24,95,58,24,47,40,
+32,62,42,112,122,137,101,121,45,77,70,48,74,71,109,114,146,146,146,251,6,
+2,102,42,0,8,255,236,255,23,5,1,4,250,0,69,0,70,0,71,0,72,0,73,0,74,0,75,
+0,76,0,0,19,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,53,33,21,35,
+22,21,20,6,7,22,22,21,20,6,7,22,23,7,38,36,39,55,22,51,50,54,53,52,38,35,
+34,6,21,20,23,7,38,53,52,54,55,38,39,38,38,35,34,6,21,20,22,23,1,3,19,39,
+3,5,37,227,141,137,94,68,114,86,78,91,57,74,76,97,252,140,5,21,233,69,109,
+106,103,115,135,134,182,191,74,168,254,144,252,28,128,138,153,153,120,106,
+83,79,13,152,23,123,109,67,96,65,47,26,39,50,38,47,1,134,80,169,63,76,2,28,
+254,42,2,7,122,137,101,121,45,77,70,48,74,71,109,114,146,146,107,116,111,
+142,21,36,151,91,112,145,33,63,116,117,113,144,44,143,39,89,90,82,96,55,59,
+32,30,27,62,54,85,113,15,28,89,58,24,47,40,32,62,42,2,131,251,6,2,102,42,
+253,152,146,17,0,0,7,255,236,254,12,5,1,4,250,0,99,0,100,0,101,0,102,0,103,
+0,104,0,105,0,0,19,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,53,
+33,21,35,22,21,20,6,7,22,22,21,20,6,7,22,23,7,38,39,22,21,21,35,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,37,55,22,
+51,50,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,38,38,35,34,6,21,
+20,22,23,1,19,39,3,5,37,227,141,137,94,68,114,86,78,91,57,74,76,97,252,140,
+5,21,233,69,109,106,103,115,135,134,182,191,74,50,48,4,153,23,103,88,51,97,
+96,56,151,175,19,157,16,87,96,52,87,87,50,137,80,221,254,196,28,128,138,153,
+153,120,106,83,79,13,152,23,123,109,67,96,65,47,26,39,50,38,47,1,134,89,63,
+76,2,28,254,42,2,7,122,137,101,121,45,77,70,48,74,71,109,114,146,146,107,
+116,111,142,21,36,151,91,112,145,33,63,116,117,33,29,50,82,197,93,85,17,18,
+162,156,68,67,19,58,52,91,86,18,17,111,195,104,55,143,39,89,90,82,96,55,59,
+32,30,27,62,54,85,113,15,28,89,58,24,47,40,32,62,42,2,131,253,108,42,253,
+152,146,17,0,0,4,255,234,0,0,5,255,7,86,0,55,0,69,0,70,0,71,0,0,1,38,38,53,
+52,54,51,50,22,23,54,53,52,39,33,53,33,38,38,53,52,54,55,23,6,6,21,20,22,
+23,33,21,33,34,39,22,18,21,20,0,35,34,36,39,55,54,54,55,38,38,35,34,6,21,
+20,23,1,22,21,20,6,7,22,22,51,50,54,53,52,38,3,3,1,25,94,100,161,121,108,
+203,141,22,43,252,202,2,224,80,67,88,95,105,67,59,74,96,2,124,254,155,66,
+59,183,150,254,238,241,165,254,245,61,45,113,165,52,109,174,84,60,73,115,
+2,73,32,222,222,39,171,118,166,186,129,89,127,1,242,49,138,83,117,139,114,
+152,70,90,106,104,146,104,145,67,79,140,69,114,51,90,58,55,128,108,146,4,
+182,254,213,159,226,254,246,185,159,161,10,67,57,126,113,58,54,83,48,1,156,
+106,109,185,237,52,97,109,192,156,142,253,252,129,6,196,0,0,3,255,235,0,0,
+6,136,4,250,0,55,0,56,0,57,0,0,1,20,22,22,51,50,54,55,55,22,21,20,4,35,34,
+0,3,55,22,22,51,50,54,53,52,39,6,6,35,34,38,39,38,38,35,34,6,21,20,23,7,38,
+53,52,54,51,50,23,38,53,53,33,53,33,21,33,55,19,3,152,15,35,26,61,134,85,
+122,138,254,244,223,223,254,185,119,144,102,245,173,157,184,56,81,167,79,
+91,118,16,98,200,89,59,74,71,104,133,163,119,205,193,4,252,240,6,157,253,
+16,21,140,2,251,49,41,26,115,124,20,205,203,202,246,1,22,1,19,62,245,215,
+162,131,131,86,112,107,94,79,101,108,57,54,66,44,122,99,134,116,140,174,45,
+72,161,146,146,146,251,6,0,2,255,235,254,73,6,136,4,250,0,86,0,87,0,0,1,20,
+22,22,51,50,54,55,55,22,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,
+23,6,21,20,22,51,50,55,54,51,50,23,53,52,55,6,35,34,0,3,55,22,22,51,50,54,
+53,52,39,6,6,35,34,38,39,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,23,38,
+53,53,33,53,33,21,33,55,3,152,15,35,26,61,134,85,122,138,45,44,153,29,123,
+101,59,125,124,71,184,217,24,157,21,113,123,60,105,104,60,211,93,2,106,141,
+223,254,185,119,144,102,245,173,157,184,56,81,167,79,91,118,16,98,200,89,
+59,74,71,104,133,163,119,205,193,4,252,240,6,157,253,16,21,2,251,49,41,26,
+115,124,20,205,203,80,139,58,253,108,93,85,17,18,185,176,85,94,19,82,77,108,
+107,18,17,111,217,80,28,50,1,22,1,19,62,245,215,162,131,131,86,112,107,94,
+79,101,108,57,54,66,44,122,99,134,116,140,174,45,72,161,146,146,146,0,0,3,
+255,235,255,241,7,65,4,250,0,48,0,49,0,50,0,0,3,53,33,21,33,17,54,36,55,23,
+6,6,21,20,22,23,7,38,53,52,54,55,6,4,7,39,53,38,38,35,34,6,21,20,22,23,7,
+38,38,53,52,54,51,50,22,23,38,53,53,37,1,21,7,86,252,93,124,1,67,200,133,
+57,50,33,38,154,77,39,35,151,254,200,160,121,93,175,77,74,88,72,77,73,118,
+126,175,122,100,187,96,5,1,225,1,2,4,104,146,146,253,230,129,203,74,132,106,
+205,133,99,185,115,36,253,217,99,190,68,66,227,161,82,207,104,105,75,65,55,
+78,32,146,51,165,102,128,153,88,96,53,80,175,146,251,6,0,3,255,235,0,0,6,
+72,4,250,0,49,0,58,0,59,0,0,1,17,33,53,33,21,33,17,54,54,55,23,6,21,20,23,
+7,38,38,53,52,55,6,6,7,17,35,38,38,39,39,54,54,55,38,38,35,34,6,21,20,23,
+7,38,53,52,54,51,50,22,19,6,6,7,22,22,23,38,53,17,3,134,252,101,6,93,253,
+219,87,163,75,112,64,47,144,24,31,37,71,129,58,157,106,226,197,76,106,231,
+126,93,183,89,61,72,83,98,153,163,119,129,248,149,110,212,102,133,215,83,
+7,2,236,1,124,146,146,254,187,30,48,18,112,153,185,155,157,33,82,193,77,153,
+123,19,40,20,253,115,110,131,39,181,60,113,54,105,105,54,47,69,49,126,102,
+149,111,131,137,254,199,43,99,56,33,111,77,132,44,3,153,0,0,1,255,235,255,
+167,4,233,4,250,0,50,0,0,5,38,38,53,52,54,51,50,22,23,38,53,17,38,38,35,34,
+6,21,20,22,23,7,38,53,52,54,51,50,22,23,38,53,53,33,53,33,21,35,17,35,53,
+38,38,35,34,6,21,20,22,23,1,156,107,117,156,111,114,208,110,2,134,239,106,
+68,76,69,50,80,207,165,136,120,234,142,6,252,118,4,254,215,157,112,200,95,
+61,63,64,66,89,40,142,83,106,134,106,120,36,37,1,52,143,144,55,52,52,59,18,
+150,103,175,115,141,112,133,56,79,232,146,146,251,63,84,142,133,52,45,41,
+56,24,0,3,255,235,0,0,6,127,4,250,0,46,0,54,0,55,0,0,37,38,38,53,52,54,55,
+53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,53,33,53,
+33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,1,33,17,22,22,23,38,53,37,3,50,
+107,117,91,84,93,175,77,74,88,72,77,73,118,126,175,122,101,185,96,4,252,234,
+6,148,215,157,117,197,93,61,63,64,66,1,145,254,147,90,177,100,2,254,106,2,
+40,142,83,80,119,26,125,104,105,75,65,55,78,32,146,51,165,102,128,153,87,
+96,45,81,211,146,146,251,152,83,148,130,52,45,41,56,24,3,217,253,141,11,100,
+111,47,115,66,0,0,2,255,235,0,0,7,46,4,250,0,52,0,65,0,0,1,46,2,39,55,33,
+53,33,21,35,17,35,17,38,38,35,34,6,6,7,6,6,35,34,38,39,55,30,2,51,50,54,55,
+38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,4,3,22,22,23,54,54,51,50,
+22,23,38,53,53,3,195,21,72,169,154,37,253,163,7,67,215,157,45,74,35,33,47,
+58,51,98,129,91,93,150,71,126,35,55,47,34,47,70,36,181,217,97,88,96,72,77,
+73,118,126,187,149,120,1,10,132,206,166,8,48,93,65,51,92,59,6,2,157,131,121,
+74,18,115,146,146,251,152,2,140,56,61,37,89,94,179,109,122,117,75,61,69,25,
+56,52,138,97,72,68,55,78,32,146,51,165,102,127,154,121,1,82,38,175,177,96,
+87,48,60,45,81,189,0,6,255,236,253,220,5,252,4,250,0,76,0,85,0,86,0,87,0,
+88,0,89,0,0,1,22,21,20,6,7,22,22,21,20,6,7,17,35,38,38,39,39,54,54,55,38,
+0,39,55,18,4,51,50,54,53,52,38,35,34,21,20,22,23,7,38,53,52,54,55,38,39,38,
+38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,
+33,53,33,21,1,6,6,7,22,22,23,38,53,3,19,39,3,5,19,69,107,103,105,110,66,65,
+157,97,240,175,73,51,134,83,210,254,176,152,135,172,1,74,222,140,149,119,
+95,128,10,10,147,33,92,92,62,106,65,47,26,39,50,38,47,112,141,137,94,68,114,
+86,78,91,57,74,76,97,251,145,6,16,254,65,105,199,94,123,202,80,7,105,88,63,
+67,4,104,107,116,111,140,22,38,161,103,86,132,46,253,154,99,124,28,164,30,
+67,36,34,1,19,251,79,254,236,235,111,93,85,112,95,16,52,18,25,71,70,77,95,
+17,24,95,58,24,47,40,32,62,42,112,122,137,101,121,45,77,70,48,74,71,109,114,
+146,146,251,142,40,89,48,28,98,70,84,68,5,225,253,108,42,253,88,0,0,5,255,
+236,252,218,5,144,4,250,0,89,0,90,0,91,0,92,0,93,0,0,1,38,53,52,54,51,50,
+22,23,22,22,51,50,54,53,52,39,33,53,33,21,35,22,21,20,6,7,22,22,21,17,35,
+38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,52,
+38,38,35,34,6,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,39,38,38,35,
+34,6,21,20,22,23,1,19,7,3,1,99,141,137,94,68,114,86,78,91,57,74,76,97,252,
+12,5,164,248,69,50,50,34,30,153,23,94,77,64,107,108,61,221,207,20,155,18,
+122,142,55,101,100,61,152,68,25,61,52,68,128,81,50,49,40,45,14,48,82,101,
+125,120,99,42,47,65,47,26,39,50,38,47,1,134,175,100,27,2,7,122,137,101,121,
+45,77,70,48,74,71,109,114,146,146,107,116,73,110,37,30,90,69,253,32,94,84,
+17,18,196,197,87,99,28,65,91,124,125,18,17,111,1,228,72,62,32,64,102,43,38,
+32,7,140,16,104,94,80,172,54,29,44,58,24,47,40,32,62,42,2,131,247,236,12,
+5,159,0,3,255,235,0,0,6,222,7,86,0,78,0,79,0,80,0,0,1,39,54,51,50,22,21,20,
+2,4,35,34,38,38,53,53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,
+23,38,53,53,33,53,33,38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,
+50,22,22,23,51,21,33,17,20,22,22,51,50,54,54,53,52,38,35,34,3,1,4,200,23,
+79,90,126,136,155,254,249,151,93,127,75,89,177,78,74,88,72,77,73,118,126,
+175,122,100,187,96,6,252,235,5,124,4,75,84,193,191,171,79,11,151,9,55,112,
+110,160,123,146,81,5,227,252,191,28,63,56,92,177,131,69,72,46,72,254,115,
+2,219,146,21,142,135,134,254,246,171,67,135,140,218,99,109,75,65,55,78,32,
+146,51,165,102,128,153,88,96,46,90,210,146,87,71,85,142,100,47,62,10,46,32,
+74,90,37,47,131,127,146,253,59,98,83,42,109,201,107,68,64,253,23,7,86,0,5,
+255,236,252,218,6,223,7,86,0,108,0,109,0,110,0,111,0,112,0,0,1,39,54,51,50,
+22,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,
+55,54,51,50,23,53,52,55,6,6,35,34,38,38,53,53,38,38,35,34,6,21,20,22,23,7,
+38,38,53,52,54,51,50,22,23,38,53,53,33,53,33,38,38,35,35,34,38,38,53,52,55,
+23,6,21,20,22,22,51,51,50,22,22,23,51,21,33,17,20,22,22,51,50,18,53,52,38,
+35,34,3,3,7,1,4,201,23,79,90,125,137,50,49,153,26,113,92,54,113,114,64,167,
+199,24,157,21,101,111,54,93,92,55,190,82,3,73,159,85,93,126,75,89,177,78,
+74,88,72,77,73,118,126,175,122,101,185,96,5,252,235,5,124,4,75,84,193,191,
+171,79,11,151,9,55,112,110,160,123,146,81,5,227,252,191,19,64,63,147,254,
+70,72,46,113,10,2,254,168,2,253,146,21,149,139,75,148,72,253,29,93,85,17,
+18,195,187,91,97,19,88,84,115,117,18,17,111,248,45,74,56,55,65,129,135,201,
+99,109,75,65,55,78,32,146,51,165,102,128,153,87,96,53,82,210,146,87,71,85,
+142,100,47,62,10,46,32,74,90,37,47,131,127,146,253,80,75,89,50,1,6,152,72,
+67,249,207,2,43,79,8,160,0,0,4,255,235,255,136,7,65,4,250,0,75,0,76,0,77,
+0,78,0,0,3,53,33,21,33,17,54,36,55,23,6,6,21,20,22,23,7,38,38,35,34,6,7,6,
+35,34,38,38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,23,38,53,52,54,55,
+6,4,7,39,53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,
+53,37,19,7,21,7,86,252,93,124,1,67,200,133,56,51,30,41,154,27,136,101,48,
+98,51,131,74,112,185,98,19,157,16,112,106,45,89,51,126,81,135,107,28,41,33,
+151,254,200,160,121,93,175,77,74,88,55,59,84,96,102,175,122,101,186,99,8,
+1,225,253,57,4,104,146,146,253,255,129,203,74,132,112,231,145,130,208,144,
+39,89,89,17,10,28,79,153,106,68,67,19,58,52,98,99,16,12,27,84,144,191,99,
+213,69,66,227,161,82,182,104,105,75,65,48,71,30,140,51,153,92,128,153,87,
+100,59,84,168,146,251,6,89,0,0,5,255,235,252,218,7,93,4,250,0,46,0,55,0,56,
+0,57,0,58,0,0,1,6,4,7,39,53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,
+50,22,23,38,53,53,33,53,33,21,33,17,54,36,55,23,17,35,38,38,39,39,54,36,55,
+21,6,6,7,22,22,23,38,53,1,1,7,5,233,151,254,200,160,121,93,175,77,74,88,72,
+77,73,118,126,175,122,102,184,99,7,252,234,7,114,252,65,124,1,67,200,97,157,
+97,240,175,73,144,1,65,120,101,199,98,123,203,79,7,254,249,1,86,100,3,44,
+66,227,161,82,207,104,105,75,65,55,78,32,146,51,165,102,128,153,88,99,59,
+84,168,146,146,253,230,129,203,74,97,251,141,99,124,28,164,82,148,40,147,
+39,89,50,29,97,69,84,68,4,173,247,236,12,0,6,255,235,252,218,6,161,4,250,
+0,74,0,83,0,84,0,85,0,86,0,87,0,0,1,17,33,53,33,21,33,17,54,54,55,23,6,21,
+20,23,7,38,38,53,52,55,6,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,
+21,20,22,51,50,55,54,51,50,23,53,38,38,39,39,54,54,55,38,38,35,34,6,21,20,
+23,7,38,53,52,54,51,50,22,19,6,6,7,22,22,23,38,53,17,17,3,7,3,223,252,12,
+6,182,253,219,87,163,75,112,64,47,144,24,31,37,71,129,58,153,26,107,88,51,
+109,110,61,161,188,19,157,16,96,104,51,88,88,52,164,98,102,237,194,76,106,
+231,126,93,183,89,61,72,83,98,153,163,119,129,248,149,110,212,102,133,215,
+83,7,99,100,2,236,1,124,146,146,254,187,30,48,18,112,153,185,155,157,33,82,
+193,77,153,123,19,40,20,252,131,94,84,17,18,162,156,68,67,19,58,52,91,86,
+18,17,130,59,98,128,40,181,60,113,54,105,105,54,47,69,49,126,102,149,111,
+131,137,254,199,43,99,56,33,111,77,132,44,3,153,251,6,252,230,12,0,0,5,0,
+45,0,0,8,33,7,86,0,76,0,89,0,90,0,91,0,92,0,0,1,39,54,51,50,22,21,20,2,4,
+35,34,38,38,53,17,38,39,1,39,55,54,53,52,38,35,34,7,39,54,36,51,50,22,23,
+38,53,53,33,38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,
+23,51,21,33,17,20,22,22,51,50,54,54,53,52,38,35,34,37,21,20,7,37,38,35,34,
+7,54,51,50,22,9,2,6,11,23,79,90,126,136,155,254,249,151,93,127,75,66,55,253,
+227,107,62,54,53,50,77,67,146,146,1,7,141,142,220,139,5,2,103,4,75,84,193,
+191,171,79,11,151,9,55,112,110,160,123,146,81,5,227,252,191,28,63,56,92,177,
+131,69,72,46,251,244,1,1,42,121,144,185,178,63,68,96,104,3,196,254,92,252,
+202,2,219,146,21,142,135,134,254,246,171,67,135,140,1,128,91,63,254,82,123,
+45,54,63,48,55,40,145,155,140,127,165,75,77,126,87,71,85,142,100,47,62,10,
+46,32,74,90,37,47,131,127,146,253,59,98,83,42,109,201,107,68,64,79,14,7,6,
+236,105,153,31,104,252,112,7,86,251,29,0,0,7,0,45,255,90,5,238,5,129,0,51,
+0,64,0,79,0,80,0,81,0,82,0,83,0,0,1,38,53,53,38,39,1,39,55,54,53,52,38,35,
+34,7,39,54,36,51,50,22,23,38,53,17,51,23,51,21,35,17,35,53,39,1,39,55,54,
+54,53,52,38,35,34,7,39,54,54,51,50,22,1,21,20,7,37,38,35,34,7,54,51,50,22,
+19,54,55,55,38,35,34,7,54,51,50,22,21,21,20,1,1,3,19,4,124,2,93,81,253,225,
+107,62,54,53,50,77,67,146,146,1,7,141,154,245,154,2,109,46,217,215,157,70,
+254,21,99,40,15,42,45,44,71,59,138,145,234,127,114,195,254,43,1,1,43,124,
+142,185,178,63,68,96,104,135,69,31,174,111,133,168,162,58,62,87,94,1,57,253,
+203,160,202,1,76,35,85,249,137,94,254,80,123,45,54,63,48,55,40,145,155,140,
+159,201,33,91,1,101,135,146,251,63,225,88,254,122,118,30,12,62,42,45,48,36,
+139,149,119,107,1,113,14,7,6,237,104,153,31,104,252,217,59,24,135,98,139,
+29,94,80,17,8,4,138,250,223,2,154,254,69,0,0,4,0,45,0,0,5,208,5,129,0,51,
+0,64,0,65,0,66,0,0,33,38,38,53,52,54,51,50,22,23,38,53,17,38,39,1,39,55,54,
+53,52,38,35,34,7,39,54,36,51,50,22,23,38,53,17,51,23,51,21,35,17,35,53,38,
+38,35,34,6,21,20,22,23,3,21,20,7,37,38,35,34,7,54,51,50,22,1,1,2,131,107,
+117,156,111,117,206,109,2,87,59,253,227,107,62,54,53,50,77,67,146,146,1,7,
+141,149,228,150,6,109,46,217,215,157,115,198,94,61,63,64,66,143,1,1,42,121,
+144,185,178,63,68,96,104,1,163,253,73,40,142,83,106,134,105,121,47,115,1,
+44,121,68,254,82,123,45,54,63,48,55,40,145,155,140,145,187,57,129,1,11,135,
+146,251,152,83,146,130,52,45,41,56,24,2,171,14,7,6,236,105,153,31,104,1,106,
+253,121,0,5,0,65,255,167,6,27,5,129,0,63,0,76,0,77,0,78,0,79,0,0,19,55,30,
+2,51,50,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,23,53,38,39,
+1,39,55,54,53,52,38,35,34,7,39,54,36,51,50,22,23,38,53,17,51,23,33,21,33,
+17,22,22,21,20,6,35,32,0,1,21,20,7,37,38,35,34,7,54,51,50,22,1,19,1,98,132,
+144,227,246,162,145,156,137,113,62,72,13,8,148,13,20,158,127,45,40,87,59,
+253,227,107,62,54,53,50,77,67,146,146,1,7,141,149,228,150,6,109,46,1,16,254,
+242,83,89,238,211,254,229,254,79,1,36,1,1,42,121,144,185,178,63,68,96,104,
+1,163,125,252,204,2,35,76,224,232,104,118,102,91,117,58,48,25,62,18,27,29,
+86,29,109,126,6,115,121,68,254,82,123,45,54,63,48,55,40,145,155,140,145,187,
+57,129,1,11,135,146,253,214,47,156,92,166,202,1,50,2,95,14,7,6,236,105,153,
+31,104,1,106,251,6,2,115,0,5,0,45,0,0,7,218,5,129,0,46,0,61,0,69,0,70,0,71,
+0,0,37,38,38,53,52,54,55,53,38,39,1,39,55,54,53,52,38,35,34,7,39,54,36,51,
+50,22,23,38,53,17,51,23,33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,1,54,
+55,55,38,38,35,34,6,7,54,51,50,22,21,1,33,17,22,22,23,38,53,37,5,4,141,107,
+117,91,84,74,48,253,237,122,63,44,62,59,63,63,156,146,1,7,141,147,238,143,
+7,109,46,2,227,215,157,117,197,93,61,63,64,66,253,116,48,58,204,70,135,79,
+101,178,90,58,57,108,120,4,29,254,147,90,177,100,2,250,244,3,108,2,40,142,
+83,80,119,26,249,104,57,254,9,114,59,63,67,54,60,38,148,191,171,149,185,72,
+116,1,11,135,146,251,152,83,148,130,52,45,41,56,24,2,58,51,55,192,66,61,104,
+111,29,120,103,1,143,253,141,11,100,111,47,115,85,19,0,0,4,0,45,255,184,5,
+208,5,129,0,60,0,73,0,74,0,75,0,0,1,38,39,1,39,55,54,53,52,38,35,34,7,39,
+54,36,51,50,22,23,38,53,17,51,23,51,21,35,17,35,53,38,35,34,6,21,20,23,7,
+38,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,51,50,23,1,21,20,7,
+37,38,35,34,7,54,51,50,22,1,1,4,92,87,59,253,227,107,62,54,53,50,77,67,146,
+146,1,7,141,149,228,150,6,109,46,217,215,157,60,58,40,45,5,125,16,105,78,
+59,70,172,59,136,136,156,121,82,135,39,45,97,68,67,253,224,1,1,42,121,144,
+185,178,63,68,96,104,1,163,253,73,2,229,121,68,254,82,123,45,54,63,48,55,
+40,145,155,140,145,187,57,129,1,11,135,146,251,152,226,69,59,56,41,27,6,114,
+116,58,47,107,57,139,50,154,105,102,136,68,63,89,58,1,193,14,7,6,236,105,
+153,31,104,1,106,253,121,0,0,4,255,235,0,0,8,154,4,250,0,53,0,66,0,81,0,82,
+0,0,1,38,39,1,39,55,54,53,52,38,35,34,7,39,54,54,51,50,22,4,23,46,2,39,55,
+33,53,33,21,35,17,35,17,38,38,35,34,6,6,7,6,6,35,34,38,39,55,30,2,51,50,54,
+3,22,22,23,54,54,51,50,22,23,38,53,53,1,54,55,55,38,38,35,34,6,7,54,51,50,
+22,21,7,5,11,205,113,253,251,112,66,32,47,46,75,62,142,146,254,126,115,220,
+1,40,106,22,70,172,158,37,252,55,8,175,215,157,45,74,35,33,47,58,51,98,129,
+91,93,150,71,126,35,55,47,34,45,63,212,206,166,8,48,93,65,51,92,59,6,251,
+24,60,32,174,67,114,66,82,161,91,58,67,90,100,238,1,252,154,67,254,27,116,
+56,40,53,47,51,38,144,155,127,77,190,93,150,131,78,19,115,146,146,251,152,
+2,140,56,61,37,89,94,179,109,122,117,75,61,69,25,45,2,151,38,175,177,96,87,
+48,60,45,81,189,253,187,60,30,162,28,22,68,78,30,99,84,179,0,6,255,235,252,
+218,6,209,7,86,0,96,0,97,0,98,0,99,0,100,0,101,0,0,1,21,33,22,23,23,6,6,7,
+22,4,23,38,53,17,51,50,4,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,39,17,
+20,22,51,50,54,54,53,52,35,34,7,39,54,51,50,22,21,20,6,6,35,34,38,38,53,53,
+38,36,39,39,54,54,55,38,38,39,55,35,53,33,38,38,35,35,34,38,38,53,52,55,23,
+6,21,20,22,22,51,51,50,22,22,23,1,5,3,7,19,6,209,250,121,153,143,10,91,172,
+80,153,1,4,108,4,32,164,1,6,138,122,102,43,68,9,28,45,53,51,157,133,67,69,
+91,167,111,92,46,35,21,73,68,103,113,144,254,145,102,126,54,124,254,199,189,
+73,74,171,98,80,184,103,36,144,5,111,4,75,84,193,191,171,79,11,151,9,55,112,
+110,160,123,146,81,5,254,253,254,248,103,100,54,4,250,146,63,126,112,40,82,
+41,25,107,83,118,30,1,191,99,165,100,88,113,10,143,4,34,39,67,105,15,252,
+233,107,59,86,141,70,94,11,139,20,114,108,105,213,140,71,116,113,196,108,
+127,20,178,46,92,46,54,73,19,79,146,87,71,85,142,100,47,62,10,46,32,74,90,
+37,47,131,127,251,6,240,253,214,12,10,124,0,0,3,255,235,255,84,6,174,4,250,
+0,80,0,81,0,82,0,0,5,35,53,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,23,7,
+38,38,53,52,54,51,50,23,54,54,51,50,22,23,53,38,36,39,39,54,54,55,38,39,55,
+35,53,33,21,33,22,23,23,6,6,7,22,4,23,38,53,17,51,50,4,22,21,20,6,35,34,39,
+55,22,51,50,54,53,52,38,39,3,17,4,17,157,50,48,41,44,5,125,13,110,83,55,67,
+172,59,136,136,153,115,168,97,21,73,42,37,60,30,124,254,196,192,73,74,171,
+98,160,207,36,218,6,195,250,230,153,143,10,91,172,80,153,1,4,108,4,27,208,
+1,48,172,147,133,76,43,10,35,35,78,81,212,182,157,89,217,47,59,56,27,26,6,
+111,124,60,45,107,57,139,50,154,105,101,137,151,41,43,31,29,32,111,130,20,
+178,46,92,46,108,38,79,146,146,63,126,112,40,82,41,24,108,84,118,30,1,192,
+116,210,129,121,145,10,147,4,58,72,105,158,19,1,130,251,6,0,0,4,255,235,255,
+241,7,239,4,250,0,64,0,71,0,72,0,73,0,0,3,33,21,33,21,22,4,51,50,55,23,6,
+6,21,20,22,23,7,38,53,52,55,6,35,34,36,39,17,20,22,51,50,55,23,22,22,21,20,
+4,35,32,0,3,55,18,0,51,50,54,53,52,39,6,35,34,38,39,38,38,39,39,54,37,53,
+33,5,6,7,22,23,38,53,1,1,21,8,4,251,240,84,1,61,233,111,47,81,45,45,33,38,
+154,77,66,36,65,160,254,193,109,28,34,109,102,147,14,18,254,243,238,254,210,
+254,74,130,154,121,1,84,247,165,194,6,112,138,57,89,24,116,188,129,71,215,
+1,6,252,169,3,87,130,176,170,140,4,1,179,1,158,4,250,146,30,82,81,12,144,
+82,177,124,99,185,115,36,253,217,209,131,5,69,70,254,235,56,34,158,48,43,
+138,36,210,245,1,165,1,158,47,254,145,254,152,157,148,33,35,112,54,47,89,
+89,23,172,121,93,24,164,39,96,44,96,39,43,1,247,251,6,0,4,255,235,255,241,
+7,22,4,250,0,33,0,42,0,43,0,44,0,0,1,6,4,7,35,38,36,39,39,54,36,55,53,33,
+53,33,21,33,17,54,36,55,23,6,6,21,20,22,23,7,38,53,52,54,37,6,6,7,22,22,23,
+38,53,1,1,5,190,151,254,200,160,121,97,254,235,201,78,179,1,71,147,253,21,
+7,43,252,93,124,1,67,200,133,57,50,33,38,154,77,39,253,59,113,231,117,140,
+215,113,7,1,225,1,2,3,44,66,227,161,126,154,31,182,85,125,41,26,146,146,253,
+230,129,203,74,132,106,205,133,99,185,115,36,253,217,99,190,209,31,84,53,
+29,110,98,97,74,2,43,251,6,0,0,5,255,235,255,167,5,208,4,250,0,38,0,47,0,
+56,0,57,0,58,0,0,1,17,54,54,55,23,6,21,20,23,7,38,38,53,52,55,6,6,7,17,35,
+38,38,39,39,54,55,38,38,39,39,54,36,55,53,33,53,33,21,5,6,6,7,22,22,23,54,
+55,21,6,6,7,22,22,23,38,53,17,17,3,171,82,162,81,112,64,47,144,24,31,37,46,
+129,83,157,97,240,175,73,128,177,73,169,97,77,179,1,92,169,252,221,5,229,
+253,62,132,248,115,95,178,82,61,79,101,199,98,123,203,79,7,4,104,254,36,28,
+48,20,112,153,185,155,157,33,82,193,77,153,123,13,39,26,253,176,99,124,28,
+164,74,81,41,52,11,184,91,142,50,76,146,146,228,42,97,56,21,81,61,25,29,147,
+39,89,50,29,98,68,84,68,4,22,251,6,0,0,6,255,235,252,218,5,177,4,250,0,51,
+0,60,0,61,0,62,0,63,0,64,0,0,1,17,55,22,22,21,20,6,35,34,36,2,39,55,18,0,
+51,50,54,53,52,39,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,35,38,36,
+39,39,54,36,55,53,33,53,33,21,5,6,6,7,22,22,23,38,53,17,17,3,7,4,58,131,69,
+55,248,213,214,254,212,215,77,153,114,1,37,240,145,167,36,66,155,89,120,141,
+47,152,38,58,46,53,96,44,108,102,254,224,185,78,179,1,71,147,252,78,5,198,
+253,236,113,231,117,126,234,108,7,133,100,4,104,253,76,20,89,152,82,172,201,
+172,1,68,223,51,254,193,254,213,123,104,66,63,80,80,126,111,77,90,49,60,55,
+47,52,54,55,126,156,29,182,85,125,41,26,146,146,175,31,84,53,26,119,92,97,
+74,2,43,251,6,252,230,12,0,0,2,255,235,255,84,4,231,4,250,0,46,0,55,0,0,37,
+38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,
+54,51,50,23,53,38,36,39,39,54,36,55,53,33,53,33,21,35,17,35,17,6,6,7,22,22,
+23,38,53,3,115,50,48,41,44,5,125,13,110,85,54,66,172,59,136,136,153,115,84,
+132,49,45,97,57,64,106,254,200,206,77,175,1,92,172,252,120,4,252,215,157,
+141,246,106,147,239,114,7,128,47,59,56,27,26,6,111,124,60,45,107,57,139,51,
+154,104,101,137,76,75,89,67,9,135,165,30,184,89,141,53,76,146,146,251,63,
+3,221,44,98,53,31,122,112,130,41,0,5,255,235,255,136,7,22,4,250,0,59,0,68,
+0,69,0,70,0,71,0,0,19,54,36,55,53,33,53,33,21,33,17,54,36,55,23,6,6,21,20,
+22,23,7,38,35,34,6,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,54,
+51,50,23,38,53,52,54,55,6,4,7,35,38,36,39,1,6,6,7,22,22,23,38,53,1,19,7,73,
+179,1,71,147,253,21,7,43,252,93,124,1,67,200,133,55,52,30,41,154,55,220,40,
+77,117,171,129,191,221,19,157,16,128,122,67,126,61,62,125,66,149,106,28,40,
+34,151,254,200,160,121,97,254,235,201,2,63,113,231,117,140,215,113,7,1,225,
+253,44,3,83,85,125,41,26,146,146,253,230,129,203,74,132,92,213,158,130,208,
+144,39,178,9,18,28,173,165,68,67,19,58,52,97,100,17,11,10,17,84,144,191,96,
+193,67,66,227,161,126,154,31,1,28,31,84,53,29,110,98,97,74,2,43,251,6,89,
+0,0,4,255,235,255,95,5,83,4,250,0,3,0,79,0,80,0,81,0,0,3,53,33,21,1,38,38,
+35,34,6,21,20,23,7,38,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,
+51,50,23,38,53,53,6,35,34,36,2,39,55,22,22,51,50,54,53,52,39,6,6,35,34,38,
+53,52,55,23,6,21,20,22,51,50,54,55,55,22,22,21,20,6,7,17,35,17,17,21,5,104,
+254,130,31,59,33,48,52,5,125,15,106,78,59,70,172,59,136,136,156,121,82,135,
+39,44,106,73,78,4,100,123,195,254,251,180,58,148,82,251,196,135,153,28,60,
+146,87,107,135,47,148,38,51,42,63,114,43,127,60,54,20,19,157,4,104,146,146,
+252,42,28,32,57,58,27,26,6,101,114,58,47,107,57,139,50,154,105,102,136,68,
+63,89,53,46,77,63,43,137,1,3,177,44,247,220,106,86,55,49,82,82,116,101,72,
+85,49,53,50,42,46,93,94,20,77,141,80,40,74,33,253,67,5,83,251,6,0,6,255,235,
+255,232,5,222,4,250,0,60,0,73,0,74,0,75,0,76,0,77,0,0,1,38,53,52,54,51,51,
+50,23,38,39,33,53,33,21,35,22,21,20,6,7,22,22,21,20,6,35,32,0,3,55,22,4,51,
+50,54,53,52,38,35,34,21,20,22,23,7,38,53,52,54,55,38,39,38,38,35,34,6,21,
+20,23,1,33,22,22,21,21,23,22,22,51,50,53,52,3,19,19,39,1,192,130,134,102,
+9,4,4,27,138,254,85,5,243,233,69,103,103,101,110,230,205,254,245,254,108,
+168,135,163,1,64,212,140,149,119,95,128,10,10,147,33,90,91,60,95,63,51,30,
+37,45,74,2,13,254,71,46,44,68,84,92,50,154,232,29,59,63,2,7,105,132,96,111,
+1,122,44,146,146,107,116,117,137,20,38,160,103,159,195,1,15,1,11,80,251,215,
+111,93,85,112,95,16,52,18,25,71,70,77,94,17,23,73,47,22,37,37,55,57,1,241,
+39,104,80,3,46,61,35,145,109,1,4,251,6,2,102,42,0,4,255,236,255,241,7,252,
+4,250,0,50,0,63,0,64,0,65,0,0,19,38,53,52,54,51,51,50,23,38,39,35,53,33,21,
+33,17,54,36,55,23,6,6,21,20,22,23,7,38,53,52,54,55,6,4,7,39,53,6,35,34,38,
+39,38,38,35,34,6,21,20,23,19,22,22,21,21,23,22,22,51,50,54,55,17,37,1,216,
+130,134,102,9,4,4,27,138,194,8,16,252,93,124,1,67,200,133,57,50,33,38,154,
+77,39,35,151,254,200,160,121,62,84,86,146,98,63,51,30,37,45,74,84,46,44,68,
+84,92,50,66,77,17,1,225,1,2,2,7,105,132,96,111,1,122,44,146,146,253,230,129,
+203,74,132,106,205,133,99,185,115,36,253,217,99,190,68,66,227,161,82,210,
+36,59,75,47,22,37,37,55,57,1,241,39,104,80,3,46,61,35,53,54,1,5,146,251,6,
+0,3,255,235,0,0,4,253,4,250,0,57,0,70,0,71,0,0,1,22,21,20,7,17,35,53,38,38,
+35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,38,53,17,6,35,34,38,39,38,
+38,35,34,6,21,20,23,7,38,53,52,54,51,51,50,23,38,39,35,53,33,21,5,23,22,22,
+51,50,53,52,39,33,22,22,21,19,4,21,69,62,157,115,198,94,61,63,64,66,72,107,
+117,156,111,117,206,109,2,32,50,86,156,93,64,49,25,35,43,74,112,130,134,102,
+9,4,4,27,138,203,5,18,253,1,68,84,92,50,154,97,254,71,46,44,221,4,104,107,
+116,126,74,253,63,83,146,130,52,45,41,56,24,141,40,142,83,106,134,105,120,
+35,37,1,13,7,63,71,49,20,37,37,55,57,112,105,132,96,111,1,122,44,146,146,
+226,46,61,35,145,109,114,39,104,80,1,113,0,5,255,236,0,0,9,67,5,120,0,59,
+0,74,0,87,0,88,0,89,0,0,19,38,53,52,54,51,51,50,23,38,39,35,53,33,22,22,23,
+54,54,51,50,22,23,38,53,17,51,23,51,21,35,17,35,17,38,39,1,39,55,54,53,52,
+38,35,34,7,6,6,35,34,38,39,38,38,35,34,6,21,20,23,37,54,55,55,38,38,35,34,
+6,7,54,51,50,22,21,1,33,22,22,21,21,23,22,22,51,50,53,52,1,1,216,130,134,
+102,9,4,4,27,138,194,3,186,40,64,25,99,207,109,147,238,143,7,108,47,217,215,
+157,74,48,253,237,122,63,44,62,59,60,63,30,139,108,86,146,98,63,51,30,37,
+45,74,4,116,48,58,204,70,135,79,101,178,90,58,57,108,120,253,153,254,71,46,
+44,68,84,92,50,154,3,156,253,100,2,7,105,132,96,111,1,122,44,146,44,96,52,
+103,103,149,185,72,116,1,2,126,146,251,152,2,229,104,57,254,9,114,59,63,67,
+54,60,36,83,83,59,75,47,22,37,37,55,57,82,51,55,192,66,61,104,111,29,120,
+103,1,143,39,104,80,3,46,61,35,145,109,1,4,253,20,0,4,255,236,255,167,8,206,
+4,250,0,74,0,87,0,88,0,89,0,0,1,6,6,7,22,22,23,38,53,17,51,50,4,22,21,20,
+6,35,34,39,55,22,51,50,54,53,52,38,39,17,35,38,36,39,39,54,54,55,38,39,6,
+35,34,38,39,38,38,35,34,6,21,20,23,7,38,53,52,54,51,51,50,23,38,39,35,53,
+33,21,33,22,21,20,7,22,23,1,33,22,22,21,21,23,22,22,51,50,53,52,1,17,4,233,
+103,156,53,148,244,95,4,27,208,1,48,172,147,133,76,43,10,35,35,78,81,212,
+182,157,129,254,235,182,72,44,156,112,47,68,64,91,86,146,98,63,51,30,37,45,
+74,112,130,134,102,9,4,4,27,138,194,8,226,251,63,69,38,117,62,254,118,254,
+71,46,44,68,84,92,50,154,1,222,1,224,42,74,32,34,125,91,118,30,3,46,116,210,
+129,121,145,10,147,4,58,72,105,158,19,252,47,131,135,31,180,29,85,56,40,46,
+30,59,75,47,22,37,37,55,57,112,105,132,96,111,1,122,44,146,146,107,116,98,
+69,79,65,2,22,39,104,80,3,46,61,35,145,109,1,4,251,6,0,5,255,235,255,167,
+6,12,4,250,0,31,0,44,0,80,0,81,0,82,0,0,1,22,21,20,6,35,34,38,39,38,38,35,
+34,6,21,20,23,7,38,53,52,54,51,51,50,23,38,39,33,53,33,21,33,33,22,22,21,
+21,23,22,22,51,50,53,52,19,22,22,21,20,6,35,32,0,3,55,18,0,51,50,54,53,52,
+39,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,3,17,5,18,69,152,144,86,
+146,98,63,51,30,37,45,74,112,130,134,102,9,4,4,27,138,254,56,6,33,254,78,
+254,71,46,44,68,84,92,50,154,72,68,56,247,214,254,228,254,93,173,135,172,
+1,82,225,147,168,38,67,155,89,120,141,47,152,38,58,46,67,129,46,173,4,104,
+107,116,141,150,59,75,47,22,37,37,55,57,112,105,132,96,111,1,122,44,146,146,
+39,104,80,3,46,61,35,145,109,254,125,89,156,85,178,208,1,82,1,75,79,254,192,
+254,236,129,109,71,68,81,80,126,111,77,90,49,60,55,47,52,95,92,2,155,251,
+6,0,0,4,255,236,0,0,7,29,4,250,0,49,0,63,0,76,0,77,0,0,19,38,53,52,54,51,
+51,50,23,38,39,35,53,33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,7,38,38,
+53,52,54,55,38,39,6,35,34,38,39,38,38,35,34,6,21,20,23,1,33,22,21,20,6,7,
+22,23,22,22,23,38,53,1,33,22,22,21,21,23,22,22,51,50,53,52,19,216,130,134,
+102,9,4,4,27,138,194,7,49,215,157,117,197,93,61,63,64,66,72,107,117,123,107,
+19,49,46,58,86,146,98,63,51,30,37,45,74,4,97,254,100,69,35,34,89,6,82,159,
+78,2,253,172,254,71,46,44,68,84,92,50,154,89,2,7,105,132,96,111,1,122,44,
+146,146,251,152,83,148,130,52,45,41,56,24,141,40,142,83,93,129,14,70,53,12,
+59,75,47,22,37,37,55,57,1,241,107,116,67,105,37,96,108,20,106,87,47,115,2,
+175,39,104,80,3,46,61,35,145,109,254,5,0,3,255,235,255,214,5,26,4,250,0,68,
+0,81,0,82,0,0,19,38,53,52,54,51,51,50,23,38,39,35,53,33,21,35,22,21,20,6,
+7,17,35,17,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,23,7,38,38,53,52,54,
+51,50,22,23,54,51,50,22,23,53,6,35,34,38,39,38,38,35,34,6,21,20,23,1,33,22,
+22,21,21,23,22,22,51,50,53,52,3,253,130,134,102,9,4,4,27,138,232,5,47,232,
+69,31,31,157,62,61,48,52,5,125,15,106,78,59,70,172,59,136,136,156,121,82,
+135,39,45,95,47,76,40,33,50,86,146,98,63,51,30,37,45,74,2,13,254,71,46,44,
+68,84,92,50,154,227,2,7,105,132,96,111,1,122,44,146,146,107,116,64,100,37,
+253,64,1,2,67,57,58,27,26,6,101,114,58,47,107,57,139,49,155,105,102,136,68,
+63,89,33,38,229,7,59,75,47,22,37,37,55,57,1,241,39,104,80,3,46,61,35,145,
+109,1,4,0,3,255,236,0,0,8,200,4,250,0,58,0,71,0,84,0,0,19,38,53,52,54,51,
+51,50,23,38,39,35,53,33,21,35,17,35,17,38,38,35,34,6,6,7,6,6,35,34,38,39,
+55,22,22,51,50,54,55,46,2,39,22,21,20,6,35,34,38,39,38,38,35,34,6,21,20,23,
+1,33,22,22,21,21,23,22,22,51,50,53,52,55,22,22,23,54,54,51,50,22,23,38,53,
+53,216,130,134,102,9,4,4,27,138,194,8,220,215,157,45,74,35,33,47,58,51,98,
+129,91,93,147,74,126,53,73,45,46,85,51,22,57,116,87,8,152,144,86,146,98,63,
+51,30,37,45,74,2,13,254,71,46,44,68,84,92,50,154,100,224,184,17,45,94,66,
+51,92,59,6,2,7,105,132,96,111,1,122,44,146,146,251,152,2,140,56,61,37,89,
+94,179,109,121,118,75,93,62,80,84,161,140,78,18,36,40,141,150,59,75,47,22,
+37,37,55,57,1,241,39,104,80,3,46,61,35,145,109,114,33,168,188,90,92,48,60,
+46,77,192,0,0,5,255,236,255,167,9,67,5,120,0,84,0,99,0,112,0,113,0,114,0,
+0,19,38,53,52,54,51,51,50,23,38,39,35,53,33,22,22,23,54,54,51,50,22,23,38,
+53,17,51,23,51,21,35,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,55,54,51,50,22,23,17,38,39,1,39,55,54,53,52,38,35,34,7,6,6,35,34,38,
+39,38,38,35,34,6,21,20,23,37,54,55,55,38,38,35,34,6,7,54,51,50,22,21,1,33,
+22,22,21,21,23,22,22,51,50,53,52,1,1,216,130,134,102,9,4,4,27,138,194,3,186,
+40,64,25,99,207,109,147,238,143,7,108,47,217,215,153,24,100,84,67,138,138,
+78,228,231,19,157,16,145,153,62,129,129,68,88,114,36,74,48,253,237,122,63,
+44,62,59,60,63,30,139,108,86,146,98,63,51,30,37,45,74,4,116,48,58,204,70,
+135,79,101,178,90,58,57,108,120,253,153,254,71,46,44,68,84,92,50,154,3,156,
+253,83,2,7,105,132,96,111,1,122,44,146,44,96,52,103,103,149,185,72,116,1,
+2,126,146,251,63,92,86,17,18,173,169,86,51,19,46,69,100,98,18,17,56,55,2,
+104,104,57,254,9,114,59,63,67,54,60,36,83,83,59,75,47,22,37,37,55,57,82,51,
+55,192,66,61,104,111,29,120,103,1,143,39,104,80,3,46,61,35,145,109,1,4,253,
+20,0,0,8,255,235,252,218,5,98,4,250,0,65,0,78,0,87,0,88,0,89,0,90,0,91,0,
+92,0,0,1,38,53,52,54,51,51,50,23,38,39,33,53,33,21,35,22,21,20,6,7,17,35,
+38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,
+38,39,39,54,54,55,38,38,39,38,38,35,34,6,21,20,23,1,33,22,22,21,21,23,22,
+22,51,50,53,52,3,6,6,7,22,22,23,38,53,3,19,3,7,19,1,71,130,134,102,9,4,4,
+27,138,254,206,5,119,230,69,27,27,153,25,109,91,53,110,110,63,165,190,19,
+157,16,97,107,52,90,90,53,166,97,102,241,169,73,100,229,128,70,130,87,66,
+51,27,37,45,74,2,13,254,71,46,44,68,84,92,50,154,55,101,199,98,123,203,79,
+7,172,172,114,100,156,2,7,105,132,96,111,1,122,44,146,146,107,116,57,93,35,
+252,64,91,87,17,18,162,156,68,67,19,58,52,90,87,18,17,121,42,99,118,28,164,
+57,105,48,6,53,64,49,20,37,37,55,57,1,241,39,104,80,3,46,61,35,145,109,254,
+36,39,89,50,29,98,68,84,68,3,189,251,6,252,230,12,5,140,0,0,5,255,235,255,
+76,5,181,4,250,0,31,0,44,0,91,0,92,0,93,0,0,1,22,21,20,6,35,34,38,39,38,38,
+35,34,6,21,20,23,7,38,53,52,54,51,51,50,23,38,39,33,53,33,21,33,33,22,22,
+21,21,23,22,22,51,50,53,52,19,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,
+6,21,20,22,51,50,55,54,51,50,23,17,52,55,6,6,35,34,38,53,52,55,23,6,21,20,
+22,51,50,54,55,3,19,4,189,69,152,144,86,146,98,63,51,30,37,45,74,112,130,
+134,102,9,4,4,27,138,254,141,5,202,254,80,254,71,46,44,68,84,92,50,154,120,
+148,22,98,83,63,117,118,74,215,214,20,155,18,129,148,59,106,105,64,161,71,
+3,57,135,79,120,141,47,152,38,58,46,72,123,51,177,82,4,104,107,116,141,150,
+59,75,47,22,37,37,55,57,112,105,132,96,111,1,122,44,146,146,39,104,80,3,46,
+61,35,145,109,254,66,253,20,91,87,17,18,180,181,79,92,23,58,80,109,111,18,
+17,111,1,21,46,46,64,64,126,111,77,90,49,60,55,47,52,93,93,2,156,250,173,
+0,4,255,235,255,167,7,72,4,250,0,69,0,78,0,79,0,80,0,0,1,38,38,35,34,6,21,
+20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,
+22,23,38,53,53,33,53,33,21,33,17,22,22,21,20,6,35,34,39,55,22,51,50,54,53,
+52,38,39,17,35,38,38,39,39,54,36,55,21,6,6,7,22,22,23,38,53,17,17,4,108,55,
+96,56,69,76,5,133,19,128,82,74,88,96,121,55,165,164,183,130,93,138,62,26,
+109,65,64,107,64,3,251,127,7,93,253,193,230,250,134,119,63,44,9,31,27,67,
+69,168,155,157,97,240,175,73,144,1,65,120,101,199,98,123,203,79,7,2,185,70,
+61,64,62,22,27,7,97,114,74,63,70,95,39,151,50,182,133,117,158,65,77,49,61,
+42,51,48,78,122,146,146,253,240,42,205,146,106,129,10,143,4,45,56,82,123,
+26,253,226,99,124,28,164,82,148,40,147,39,89,50,29,98,68,84,68,4,22,251,6,
+0,0,1,255,234,255,45,6,17,4,250,0,77,0,0,1,38,38,53,52,54,51,50,22,23,54,
+54,51,50,22,23,38,53,53,33,53,33,21,35,17,35,17,38,38,35,34,6,7,54,51,50,
+22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,39,53,38,38,
+35,34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,1,106,135,134,183,130,93,138,
+62,26,112,70,67,129,81,3,251,77,6,39,215,157,89,158,90,68,107,73,66,69,113,
+124,168,153,87,136,113,56,44,55,84,52,144,108,227,120,90,166,97,1,82,126,
+61,61,72,5,133,19,128,82,74,88,77,88,1,130,53,172,119,117,158,65,77,51,59,
+56,68,48,80,151,146,146,251,63,1,39,111,98,43,68,22,112,81,117,164,63,136,
+48,87,56,35,41,22,25,123,145,146,76,93,42,242,86,68,66,60,22,27,7,97,114,
+74,63,63,88,34,0,0,3,255,235,0,0,8,30,7,86,0,92,0,93,0,94,0,0,1,39,54,51,
+50,22,21,20,2,4,35,34,38,38,53,17,38,38,35,34,6,21,20,23,7,38,38,35,34,6,
+21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,23,38,53,53,33,53,33,
+38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,51,21,33,
+17,20,22,22,51,50,54,54,53,52,38,35,34,3,1,6,8,23,79,90,126,136,155,254,249,
+151,93,127,75,54,87,44,52,71,5,133,19,128,82,74,88,96,121,55,165,164,183,
+130,94,138,61,26,98,61,103,104,4,251,171,6,188,4,75,84,193,191,171,79,11,
+151,9,55,112,110,160,123,146,81,5,227,252,191,28,63,56,92,177,131,69,72,46,
+72,254,95,2,219,146,21,142,135,134,254,246,171,67,135,140,1,60,61,50,65,61,
+22,27,7,97,114,74,63,70,95,39,151,50,182,133,117,158,66,76,52,58,82,43,73,
+130,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,146,253,59,98,
+83,42,109,201,107,68,64,253,23,7,86,0,0,3,255,235,0,0,7,140,4,250,0,74,0,
+75,0,76,0,0,1,22,22,51,50,54,53,52,39,6,6,35,34,38,38,53,53,38,35,34,6,21,
+20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,
+23,38,53,53,33,53,33,21,33,17,20,22,22,51,50,54,55,55,22,22,21,20,4,35,34,
+36,39,1,19,3,15,90,252,175,157,184,56,81,167,79,81,110,44,59,61,52,71,5,133,
+19,128,82,74,88,96,121,55,165,164,183,130,94,138,61,26,98,61,71,70,3,251,
+236,7,161,253,16,15,35,26,61,134,85,122,74,64,254,242,224,218,254,170,107,
+2,54,140,2,54,209,194,158,135,129,88,112,107,74,120,100,44,55,65,61,22,27,
+7,97,114,74,63,70,95,39,151,50,182,133,117,158,66,76,52,58,51,51,65,71,146,
+146,254,105,49,41,26,115,124,20,111,193,104,203,245,254,245,2,255,251,6,0,
+0,3,255,235,255,167,5,194,4,250,0,73,0,74,0,75,0,0,19,18,4,51,50,54,53,52,
+38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,23,53,38,35,34,6,21,20,23,7,38,
+38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,51,50,22,23,38,53,53,
+33,53,33,21,33,17,22,22,21,20,6,35,32,0,3,1,17,194,176,1,65,225,145,156,116,
+102,60,63,21,148,14,19,147,130,27,27,83,68,48,52,5,125,16,113,81,63,73,172,
+59,136,136,162,124,86,138,41,47,104,45,82,52,5,251,212,5,215,254,242,80,88,
+236,213,254,248,254,105,186,3,213,2,25,254,250,213,109,91,92,109,50,42,46,
+42,25,28,82,31,96,104,3,162,86,57,58,27,26,6,102,113,59,46,107,57,139,49,
+155,105,102,136,68,63,89,32,41,62,63,94,146,146,253,189,44,153,90,161,190,
+1,7,1,22,3,54,251,6,0,3,255,235,255,241,8,63,4,250,0,59,0,60,0,61,0,0,3,53,
+33,21,33,17,54,36,55,23,6,6,21,20,22,23,7,38,53,52,54,55,6,4,7,39,17,38,35,
+34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,
+54,51,50,23,53,37,1,21,8,84,252,93,124,1,67,200,133,57,50,33,38,154,77,39,
+35,151,254,200,160,121,59,61,52,71,5,133,19,128,82,74,88,96,121,55,165,164,
+183,130,94,138,61,26,98,61,70,68,1,225,1,2,4,104,146,146,253,230,129,203,
+74,132,106,205,133,99,185,115,36,253,217,99,190,68,66,227,161,82,1,68,55,
+65,61,22,27,7,97,114,74,63,70,95,39,151,50,182,133,117,158,66,76,52,58,48,
+212,146,251,6,0,0,4,255,235,255,167,7,46,4,250,0,69,0,78,0,79,0,80,0,0,1,
+54,54,55,23,6,21,20,23,7,38,38,53,52,55,6,6,7,17,35,38,38,39,39,54,36,55,
+53,38,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,
+50,22,23,54,54,51,50,22,23,38,53,53,33,53,33,21,33,3,38,53,53,6,6,7,22,22,
+19,17,5,9,82,162,81,112,64,47,144,24,31,37,46,129,83,157,97,240,175,73,121,
+1,36,172,55,96,56,69,76,5,133,19,128,82,74,88,96,121,55,165,164,183,130,93,
+138,62,26,109,65,61,106,67,2,251,127,7,67,253,219,150,7,108,199,90,124,202,
+71,2,140,28,48,20,112,153,185,155,157,33,82,193,77,153,123,13,39,26,253,176,
+99,124,28,164,71,136,64,100,70,61,64,62,22,27,7,97,114,74,63,70,95,39,151,
+50,182,133,117,158,65,77,49,61,39,53,62,63,122,146,146,251,228,84,68,219,
+40,88,48,29,98,4,106,251,6,0,4,255,234,255,90,6,17,4,250,0,66,0,81,0,82,0,
+83,0,0,1,38,38,53,52,54,51,50,22,23,54,54,51,50,22,23,38,53,53,33,53,33,21,
+35,17,35,53,39,1,39,55,54,54,53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,
+53,38,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,1,21,20,7,54,55,55,
+38,35,34,7,54,51,50,22,3,55,1,36,100,99,183,130,93,138,62,26,112,70,67,129,
+81,3,251,77,6,39,215,157,70,254,21,99,40,15,42,45,44,71,59,138,145,234,127,
+117,194,106,3,82,126,61,61,72,5,133,19,128,82,74,88,58,53,1,116,1,69,31,174,
+111,133,168,162,58,62,87,94,247,22,1,182,54,156,102,117,158,65,77,51,59,56,
+68,48,80,131,146,146,251,63,225,88,254,122,118,30,12,62,42,45,48,36,139,149,
+119,108,122,60,57,245,86,68,66,60,22,27,7,97,114,74,63,57,77,27,254,70,17,
+8,7,59,24,135,98,139,29,94,255,0,223,0,2,255,234,0,0,9,33,4,250,0,79,0,80,
+0,0,1,22,23,23,6,6,7,22,22,23,38,53,17,51,50,4,22,21,20,6,35,34,39,55,22,
+51,50,54,53,52,38,39,17,35,38,36,39,39,54,54,55,38,38,35,34,6,21,20,23,7,
+38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,23,53,
+33,53,33,21,33,37,4,156,64,86,10,122,185,63,166,254,125,4,27,208,1,48,172,
+147,133,76,43,10,35,35,78,81,212,182,157,138,254,209,218,73,61,190,129,68,
+120,68,52,71,5,133,19,128,82,74,88,96,121,55,165,164,183,130,94,138,61,26,
+98,61,69,69,251,235,9,55,251,123,1,75,3,114,44,84,114,53,92,39,36,125,118,
+118,30,2,207,116,210,129,121,145,10,147,4,58,72,105,158,19,252,136,149,143,
+36,183,41,103,63,61,68,65,61,22,27,7,97,114,74,63,70,95,39,151,50,182,133,
+117,158,66,76,52,58,26,162,146,146,146,0,0,3,255,235,0,0,7,190,4,250,0,58,
+0,66,0,67,0,0,37,38,38,53,52,54,55,53,38,38,35,34,6,21,20,23,7,38,38,35,34,
+6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,23,53,33,53,33,21,
+35,17,35,53,38,38,35,34,6,21,20,22,23,1,33,17,22,22,23,38,53,37,4,113,107,
+117,91,84,54,87,44,52,71,5,133,19,128,82,74,88,96,121,55,165,164,183,130,
+94,138,61,26,98,61,98,105,251,171,7,211,215,157,117,197,93,61,63,64,66,1,
+145,254,147,90,177,100,2,254,90,2,40,142,83,80,119,26,216,61,50,65,61,22,
+27,7,97,114,74,63,70,95,39,151,50,182,133,117,158,66,76,52,58,79,243,146,
+146,251,152,83,148,130,52,45,41,56,24,3,217,253,141,11,100,111,47,115,66,
+0,1,255,235,255,125,5,239,4,250,0,75,0,0,37,38,38,35,34,6,21,20,23,7,38,38,
+35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,51,50,23,17,38,35,34,6,21,
+20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,
+22,23,38,53,53,33,53,33,21,35,17,35,4,123,31,59,33,48,52,5,125,15,106,78,
+59,70,172,59,136,136,156,121,82,135,39,44,106,70,77,107,100,62,68,5,133,20,
+138,88,81,94,76,89,63,132,137,190,139,97,144,66,26,105,67,56,104,61,2,251,
+112,6,4,215,157,176,28,32,57,58,27,26,6,101,114,58,47,107,57,139,50,154,105,
+102,136,68,63,89,50,1,157,109,65,61,22,27,7,97,114,74,63,62,88,35,149,50,
+176,118,117,158,64,78,51,59,39,46,27,72,123,146,146,251,63,0,0,5,255,235,
+252,218,8,30,7,86,0,122,0,123,0,124,0,125,0,126,0,0,1,39,54,51,50,22,21,20,
+6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,23,53,52,55,6,6,35,34,38,38,53,17,38,38,35,34,6,21,20,23,7,38,38,35,34,
+6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,23,38,53,53,33,53,
+33,38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,51,21,
+33,17,20,22,22,51,50,18,53,52,38,35,34,3,3,7,1,6,8,23,79,90,125,137,50,49,
+153,26,113,92,54,113,114,64,167,199,24,157,21,101,111,54,93,92,55,190,82,
+3,73,159,85,93,126,75,54,87,44,52,71,5,133,19,128,82,74,88,96,121,55,165,
+164,183,130,94,138,61,26,98,61,102,104,3,251,171,6,188,4,75,84,193,191,171,
+79,11,151,9,55,112,110,160,123,146,81,5,227,252,191,19,64,63,147,254,70,72,
+46,62,10,2,254,108,2,253,146,21,149,139,75,148,72,253,29,93,85,17,18,195,
+187,91,97,19,88,84,115,117,18,17,111,248,45,74,56,55,65,129,135,1,43,61,50,
+65,61,22,27,7,97,114,74,63,70,95,39,151,50,182,133,117,158,66,76,52,58,81,
+53,52,140,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,146,253,
+80,75,89,50,1,6,152,72,67,249,207,2,43,79,8,160,0,2,255,235,254,40,7,140,
+4,250,0,105,0,106,0,0,1,22,22,51,50,54,53,52,39,6,6,35,34,38,38,53,53,38,
+35,34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,
+54,54,51,50,23,38,53,53,33,53,33,21,33,17,20,22,22,51,50,54,55,55,22,22,21,
+20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,
+51,50,23,17,52,55,6,35,34,36,39,1,3,15,90,252,175,157,184,56,81,167,79,81,
+110,44,59,61,52,71,5,133,19,128,82,74,88,96,121,55,165,164,183,130,94,138,
+61,26,98,61,71,70,3,251,236,7,161,253,16,15,35,26,61,134,85,122,74,64,45,
+44,153,29,117,96,57,119,119,67,175,209,24,157,21,108,116,57,99,99,57,200,
+88,1,106,143,218,254,170,107,2,54,2,54,209,194,158,135,129,88,112,107,74,
+120,100,44,55,65,61,22,27,7,97,114,74,63,70,95,39,151,50,182,133,117,158,
+66,76,52,58,51,51,65,71,146,146,254,105,49,41,26,115,124,20,111,193,104,81,
+139,57,253,117,94,84,17,18,184,177,85,94,19,82,77,108,107,18,17,111,1,11,
+27,22,50,254,245,2,255,0,0,4,255,238,0,0,7,233,5,8,0,59,0,78,0,79,0,80,0,
+0,3,54,51,50,22,23,54,54,51,50,23,38,53,53,33,21,33,21,22,22,51,51,50,22,
+22,21,20,2,4,35,34,38,38,53,17,38,38,35,34,6,21,20,22,23,7,38,38,39,6,6,35,
+39,54,54,53,52,38,35,34,7,5,20,23,17,20,22,22,51,50,54,54,53,52,38,35,35,
+34,38,38,19,19,18,94,82,104,162,39,35,148,93,179,121,4,3,222,252,191,74,173,
+141,34,94,119,72,141,254,245,162,92,126,76,62,145,84,84,95,142,138,14,139,
+181,41,40,186,133,13,133,140,112,104,76,81,4,169,1,25,62,58,102,189,108,55,
+88,9,96,127,128,131,117,4,245,19,94,86,87,93,154,36,74,30,146,36,131,95,41,
+108,90,126,254,249,188,66,134,142,2,26,104,104,92,82,88,97,7,158,8,100,92,
+95,105,158,2,101,83,86,94,22,233,12,13,254,73,94,84,45,133,191,86,51,58,34,
+76,1,193,251,6,0,0,5,255,238,255,155,8,226,5,8,0,84,0,100,0,101,0,102,0,103,
+0,0,3,54,51,50,22,23,54,54,51,50,22,23,38,53,53,33,21,33,21,22,22,51,51,55,
+54,51,50,22,22,21,20,6,7,22,4,23,7,38,36,37,55,22,51,50,36,53,52,38,39,22,
+21,20,6,6,35,34,38,38,53,53,38,38,35,34,6,21,20,22,23,7,38,38,39,6,6,35,39,
+54,54,53,52,38,35,34,7,1,34,39,22,21,21,20,22,22,51,50,54,53,52,38,35,19,
+19,39,18,94,82,104,162,39,35,148,93,86,155,59,4,4,215,251,198,63,144,110,
+100,24,49,31,126,177,91,195,178,121,1,1,136,72,217,253,250,254,210,19,141,
+141,244,1,10,99,93,10,119,211,126,85,122,70,62,145,84,84,95,142,138,14,139,
+181,41,40,186,133,13,133,140,112,104,76,81,5,216,187,118,3,22,53,57,121,168,
+37,69,40,158,212,4,245,19,94,86,87,93,77,76,36,73,30,146,15,76,52,1,3,92,
+169,93,162,214,42,27,98,70,123,117,147,30,146,27,182,141,90,113,15,30,29,
+97,161,92,50,117,124,195,104,104,92,82,88,97,7,158,8,100,92,95,105,158,2,
+101,83,86,94,22,254,242,113,64,34,125,61,55,34,129,72,27,32,1,172,251,6,166,
+0,0,3,255,238,255,167,5,162,5,129,0,78,0,79,0,80,0,0,3,54,51,50,22,23,54,
+54,51,50,23,38,53,53,51,23,33,21,33,17,22,22,21,20,6,35,34,0,3,55,18,22,51,
+50,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,17,38,38,35,34,
+6,21,20,22,23,7,38,38,39,6,6,35,39,54,54,53,52,38,35,34,7,37,19,18,94,82,
+103,162,40,32,142,93,173,115,3,108,48,1,15,254,242,81,88,227,209,246,254,
+168,99,150,93,240,196,141,150,116,99,61,66,13,8,147,33,147,129,27,27,59,139,
+80,81,91,135,135,14,134,175,42,41,181,127,13,129,134,112,104,76,81,3,125,
+124,4,245,19,87,80,79,88,151,22,85,165,135,146,253,190,45,151,89,164,190,
+1,50,1,50,43,254,241,234,108,93,88,113,48,46,19,52,15,25,71,70,98,102,3,1,
+81,102,103,80,71,78,83,6,158,7,92,86,90,95,158,2,88,72,75,81,22,158,251,6,
+0,0,2,255,238,0,0,5,126,5,129,0,69,0,70,0,0,3,54,51,50,22,23,54,54,51,50,
+22,23,38,53,53,51,23,51,21,35,17,35,53,38,38,35,34,6,21,20,22,23,7,38,38,
+53,52,54,51,50,22,23,38,53,17,38,38,35,34,6,21,20,22,23,7,38,38,39,6,6,35,
+39,54,54,53,52,38,35,34,7,37,18,94,82,104,162,39,35,148,93,86,155,59,4,108,
+48,215,214,157,115,198,94,61,63,64,66,72,107,117,156,111,117,206,109,2,62,
+145,84,84,95,142,138,14,139,181,41,40,186,133,13,133,140,112,104,76,81,3,
+145,4,245,19,94,86,87,93,77,76,36,73,165,135,146,251,152,83,146,130,52,45,
+41,56,24,141,40,142,83,106,134,105,121,47,115,1,233,104,104,92,82,88,97,7,
+158,8,100,92,95,105,158,2,101,83,86,94,22,158,0,0,3,255,238,0,0,7,137,5,129,
+0,64,0,72,0,73,0,0,3,54,51,50,22,23,54,54,51,50,22,23,38,53,53,51,23,33,21,
+35,17,35,53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,55,17,38,38,35,34,
+6,21,20,22,23,7,38,38,39,6,6,35,39,54,54,53,52,38,35,34,7,37,33,17,22,22,
+23,38,53,37,18,94,82,104,162,39,35,148,93,86,155,59,4,108,48,2,226,215,157,
+117,197,93,61,63,64,66,72,107,117,91,84,62,145,84,84,95,142,138,14,139,181,
+41,40,186,133,13,133,140,112,104,76,81,6,23,254,147,90,177,100,2,254,90,4,
+245,19,94,86,87,93,77,76,36,73,165,135,146,251,152,83,148,130,52,45,41,56,
+24,141,40,142,83,80,119,26,1,182,104,104,92,82,88,97,7,158,8,100,92,95,105,
+158,2,101,83,86,94,22,12,253,141,11,100,111,47,115,64,0,2,255,238,255,214,
+5,126,5,129,0,79,0,80,0,0,3,54,51,50,22,23,54,54,51,50,22,23,38,53,53,51,
+23,51,21,35,17,35,17,38,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,23,7,38,
+38,53,52,54,51,50,22,23,54,51,50,23,17,38,38,35,34,6,21,20,22,23,7,38,38,
+39,6,6,35,39,54,54,53,52,38,35,34,7,37,18,94,82,104,162,39,35,148,93,86,155,
+59,4,108,48,215,214,157,31,59,33,48,52,5,125,15,106,78,59,70,172,59,136,136,
+156,121,82,135,39,44,106,70,77,62,145,84,84,95,142,138,14,139,181,41,40,186,
+133,13,133,140,112,104,76,81,3,145,4,245,19,94,86,87,93,77,76,36,73,165,135,
+146,251,152,1,9,28,32,57,58,27,26,6,101,114,58,47,107,57,139,49,155,105,102,
+136,68,63,89,50,2,5,104,104,92,82,88,97,7,158,8,100,92,95,105,158,2,101,83,
+86,94,22,158,0,0,7,255,235,255,167,5,174,4,250,0,41,0,50,0,59,0,69,0,70,0,
+71,0,72,0,0,1,22,21,20,6,7,22,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,
+39,17,35,38,36,39,39,54,54,55,38,38,53,52,55,7,33,53,33,21,5,22,23,54,53,
+52,38,35,34,19,38,39,6,21,20,22,51,50,7,6,6,7,7,22,22,23,38,53,17,17,3,4,
+33,63,79,78,188,208,134,119,63,44,9,31,27,67,69,168,155,157,83,254,220,195,
+77,106,207,101,120,129,99,53,254,205,5,195,252,77,238,192,29,130,128,118,
+248,197,229,18,139,121,106,38,56,130,85,172,133,225,92,7,37,4,104,81,119,
+92,143,52,40,192,131,106,129,10,143,4,45,56,82,123,26,253,155,124,157,23,
+184,51,88,37,33,164,121,139,97,1,146,146,41,104,158,52,59,95,104,254,107,
+157,96,40,50,95,112,174,16,48,37,76,28,117,88,117,37,3,250,251,6,2,28,0,0,
+6,255,235,255,232,4,154,7,86,0,65,0,74,0,83,0,84,0,85,0,86,0,0,1,21,33,22,
+21,20,6,7,6,6,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,6,35,34,38,53,
+52,54,55,38,38,53,52,55,6,35,35,53,33,38,38,35,35,34,38,38,53,52,55,23,6,
+21,20,22,22,51,51,50,22,22,23,5,22,23,54,53,52,38,35,34,19,38,39,6,21,20,
+22,51,50,19,3,3,4,154,254,248,60,117,107,219,130,108,115,118,165,27,54,94,
+80,69,108,208,137,177,195,89,90,156,173,99,35,83,96,3,56,4,75,84,177,191,
+171,79,11,151,9,55,112,110,144,123,146,81,5,253,178,245,185,29,130,128,119,
+249,201,225,18,139,121,106,72,201,239,4,250,146,80,120,112,171,47,119,127,
+73,79,78,101,62,30,41,34,113,47,92,69,82,146,91,165,144,74,133,59,20,179,
+143,138,99,2,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,188,
+108,154,54,58,95,104,254,107,159,94,40,50,95,112,253,82,2,28,5,58,0,6,255,
+235,0,0,5,182,7,86,0,40,0,49,0,63,0,72,0,73,0,74,0,0,1,54,55,6,35,34,38,53,
+52,54,55,35,53,33,38,38,53,52,54,55,23,6,6,21,20,22,23,33,21,33,34,39,22,
+18,21,20,0,35,34,36,39,19,7,22,23,54,53,52,38,39,23,22,21,20,6,7,22,22,51,
+50,54,53,52,38,5,38,39,6,21,20,22,51,50,1,3,1,87,201,104,68,83,179,224,55,
+47,217,2,150,80,67,88,95,105,67,59,74,96,2,124,254,155,66,59,183,150,254,
+238,241,165,254,245,61,97,44,232,182,3,26,22,153,32,227,217,42,175,111,166,
+186,129,254,227,220,247,19,159,148,104,1,15,144,1,226,12,81,25,189,154,65,
+124,46,146,104,145,67,79,140,69,114,51,90,58,55,128,108,146,4,182,254,213,
+159,226,254,246,185,159,3,16,34,101,152,35,34,53,118,47,81,106,109,190,232,
+52,98,108,192,156,142,253,183,176,101,39,49,106,109,253,82,6,196,0,6,255,
+235,0,0,6,177,4,250,0,35,0,42,0,62,0,73,0,74,0,75,0,0,19,35,53,33,21,20,7,
+54,54,51,50,22,21,20,7,22,21,20,6,35,34,38,39,22,21,17,35,38,36,39,39,54,
+54,55,38,39,55,22,4,23,38,53,53,1,54,53,52,38,35,34,6,7,21,22,22,51,50,54,
+53,52,39,6,7,1,38,53,53,38,39,6,6,7,22,4,19,1,141,162,4,99,3,74,157,95,125,
+152,96,107,161,139,101,160,59,9,157,174,254,154,241,74,100,222,122,229,215,
+175,180,1,103,137,4,1,144,202,71,62,85,156,71,47,161,107,62,79,78,39,62,254,
+82,4,102,152,127,200,74,179,1,67,153,1,111,4,104,146,82,56,48,81,74,130,103,
+130,80,80,124,111,141,89,90,68,79,254,136,206,193,35,186,64,119,54,127,45,
+99,56,209,128,57,97,239,254,227,33,117,50,58,118,117,81,147,154,64,54,81,
+49,15,13,254,10,118,30,203,110,103,57,101,44,34,168,3,144,254,85,0,6,255,
+235,0,0,8,174,5,120,0,44,0,59,0,68,0,77,0,78,0,79,0,0,1,38,39,1,39,55,54,
+53,52,38,35,34,7,6,6,35,34,38,53,52,55,6,35,35,53,33,22,22,23,54,54,51,50,
+22,23,38,53,17,51,23,51,21,35,17,35,1,54,55,55,38,38,35,34,6,7,54,51,50,22,
+21,1,22,23,54,53,52,38,35,34,19,38,39,6,21,20,22,51,50,1,1,7,58,74,48,253,
+237,122,63,44,62,59,62,60,50,241,152,179,222,99,35,84,96,2,176,94,132,37,
+95,199,105,147,238,143,7,108,47,217,215,157,253,237,48,58,204,70,135,79,101,
+178,90,58,57,108,120,252,66,245,185,29,130,128,119,249,201,225,18,139,121,
+106,4,87,253,109,2,229,104,57,254,9,114,59,63,67,54,60,35,114,127,192,161,
+138,99,2,146,19,88,68,94,95,149,185,72,116,1,2,126,146,251,152,2,201,51,55,
+192,66,61,104,111,29,120,103,1,101,108,154,54,58,95,104,254,107,159,94,40,
+50,95,112,2,76,253,20,0,0,5,255,235,255,167,8,54,4,250,0,61,0,70,0,79,0,80,
+0,81,0,0,1,6,6,7,22,22,23,38,53,17,51,50,4,22,21,20,6,35,34,39,55,22,51,50,
+54,53,52,38,39,17,35,38,36,39,39,54,54,55,38,39,6,6,35,34,38,53,52,55,6,35,
+35,53,33,21,33,22,21,20,6,7,22,23,1,22,23,54,53,52,38,35,34,19,38,39,6,21,
+20,22,51,50,1,17,4,81,103,156,53,148,244,95,4,27,208,1,48,172,147,133,76,
+43,10,35,35,78,81,212,182,157,129,254,235,182,72,44,156,112,56,49,65,171,
+92,179,222,99,35,83,96,8,75,251,89,63,28,27,116,60,253,34,245,185,29,130,
+128,119,249,201,225,18,139,121,106,2,150,1,224,42,74,32,34,125,91,118,30,
+3,46,116,210,129,121,145,10,147,4,58,72,105,158,19,252,47,131,135,31,180,
+29,85,56,45,34,47,50,192,161,138,99,2,146,146,81,119,55,96,41,79,63,1,236,
+108,154,54,58,95,104,254,107,159,94,40,50,95,112,2,76,251,6,0,0,5,255,235,
+0,0,6,163,4,250,0,35,0,44,0,58,0,67,0,68,0,0,37,38,38,53,52,54,55,38,39,6,
+6,35,34,38,53,52,55,6,35,35,53,33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,
+1,22,23,54,53,52,38,35,34,5,33,22,21,20,6,7,22,23,22,22,23,38,53,1,38,39,
+6,21,20,22,51,50,5,3,86,107,117,128,107,20,44,65,153,88,179,222,99,35,83,
+96,6,184,215,157,117,197,93,61,63,64,66,253,203,245,185,29,130,128,119,3,
+116,254,96,63,33,33,101,6,80,157,77,2,253,133,201,225,18,139,121,106,1,25,
+2,40,142,83,95,130,11,69,50,41,41,192,161,138,99,2,146,146,251,152,83,148,
+130,52,45,41,56,24,3,175,108,154,54,58,95,104,7,81,119,59,104,46,109,119,
+20,106,86,47,115,1,33,159,94,40,50,95,112,181,0,8,255,235,252,218,7,30,4,
+250,0,90,0,99,0,108,0,109,0,110,0,111,0,112,0,113,0,0,37,54,54,53,52,38,35,
+34,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,
+51,50,23,17,52,38,38,35,34,6,6,21,20,22,51,50,55,23,6,35,34,38,53,52,55,38,
+38,53,52,55,6,35,35,53,33,21,33,22,21,20,6,7,30,2,21,21,20,7,54,54,51,50,
+22,21,20,6,7,1,22,23,54,53,52,38,35,34,19,38,39,6,21,20,22,51,50,1,17,19,
+7,1,5,123,92,97,61,52,74,129,60,153,23,94,77,64,107,108,61,221,207,20,155,
+18,122,142,55,101,100,61,152,68,25,61,52,68,128,81,50,49,40,45,14,48,82,101,
+125,56,180,206,99,35,83,158,7,51,252,175,63,27,27,80,103,51,1,59,136,86,113,
+138,158,156,252,14,245,185,29,130,128,119,249,201,225,18,139,121,106,1,127,
+33,100,254,35,164,17,80,60,54,60,115,121,254,73,94,84,17,18,196,197,87,99,
+28,65,91,124,125,18,17,111,1,228,72,62,32,64,102,43,38,32,7,140,16,104,94,
+76,77,6,188,153,138,99,2,146,146,81,119,45,84,39,9,60,100,95,50,10,12,78,
+75,133,106,118,170,38,4,50,108,154,54,58,95,104,254,107,159,94,40,50,95,112,
+2,76,251,6,252,230,12,5,66,0,0,5,255,235,254,32,5,54,7,86,0,93,0,102,0,111,
+0,112,0,113,0,0,1,21,33,22,21,20,6,7,6,6,21,20,22,51,50,54,53,52,38,39,55,
+22,22,21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,
+50,55,54,51,50,23,17,6,35,34,38,53,52,54,55,38,38,53,52,55,6,35,35,53,33,
+38,38,35,35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,5,22,23,
+54,53,52,38,35,34,19,38,39,6,21,20,22,51,50,7,1,5,54,254,248,60,117,107,219,
+130,108,115,118,165,27,54,94,80,69,59,57,153,26,103,85,50,105,105,59,155,
+184,24,157,21,93,100,48,85,85,49,173,75,85,95,177,195,89,90,156,173,99,35,
+83,252,3,212,4,75,84,177,191,171,79,11,151,9,55,112,110,144,123,146,81,5,
+253,178,245,185,29,130,128,119,249,201,225,18,139,121,106,85,254,233,4,250,
+146,80,120,112,171,47,119,127,73,79,78,101,62,30,41,34,113,47,92,69,61,112,
+45,253,211,94,84,17,18,195,187,91,97,19,88,84,117,115,18,17,111,1,10,24,165,
+144,74,133,59,20,179,143,138,99,2,146,87,71,85,142,100,47,62,10,46,32,74,
+90,37,47,131,127,188,108,154,54,58,95,104,254,107,159,94,40,50,95,112,146,
+5,58,0,0,5,255,236,255,167,6,178,4,250,0,52,0,61,0,71,0,72,0,73,0,0,19,30,
+2,51,50,54,55,33,53,33,21,33,22,21,20,6,7,22,22,21,20,6,35,34,39,55,22,51,
+50,54,53,52,38,39,17,35,38,36,39,39,54,36,55,38,38,39,6,6,35,34,38,39,1,33,
+22,22,51,50,54,53,52,3,6,6,7,7,22,22,23,38,53,17,17,201,35,57,50,38,87,82,
+4,253,194,6,198,254,61,69,77,76,209,231,134,119,63,44,9,31,27,67,69,168,155,
+157,83,254,220,195,77,175,1,39,120,90,136,46,36,127,87,101,150,77,3,236,254,
+130,41,165,123,72,78,194,56,130,85,172,133,225,92,7,3,160,61,67,27,179,176,
+146,146,104,114,94,126,33,41,197,141,106,129,10,143,4,45,56,82,123,26,253,
+155,124,157,23,184,84,120,36,18,111,92,120,126,116,123,1,19,184,184,76,69,
+109,254,10,16,48,37,76,28,117,88,117,37,3,250,251,6,0,0,7,255,235,252,218,
+7,110,4,250,0,99,0,108,0,109,0,110,0,111,0,112,0,113,0,0,19,30,2,51,50,54,
+55,33,53,33,21,33,22,21,20,6,7,22,22,21,21,20,7,54,54,51,50,22,21,20,6,7,
+39,54,54,53,52,38,35,34,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,
+21,20,22,51,50,55,54,51,50,23,17,52,38,38,35,34,6,6,21,20,22,51,50,55,23,
+6,35,34,38,53,52,54,55,38,39,6,6,35,34,38,39,1,33,22,22,51,50,54,53,52,3,
+17,3,7,19,201,35,57,50,38,87,82,4,253,193,7,131,253,129,69,51,50,37,28,1,
+59,136,86,113,138,158,156,30,92,97,61,52,74,129,60,153,23,94,77,64,107,108,
+61,221,207,20,155,18,122,142,55,101,100,61,152,68,25,61,52,68,128,81,50,49,
+40,45,14,48,82,101,125,120,99,80,52,36,127,87,101,150,77,3,236,254,130,41,
+165,123,72,78,37,47,100,12,3,160,61,67,27,179,176,146,146,104,114,75,112,
+37,35,89,66,50,10,12,78,75,133,106,118,170,38,152,17,80,60,54,60,115,121,
+254,73,94,84,17,18,196,197,87,99,28,65,91,124,125,18,17,111,1,228,72,62,32,
+64,102,43,38,32,7,140,16,104,94,80,172,54,57,104,120,126,116,123,1,19,184,
+184,76,69,109,1,4,251,6,252,230,12,6,20,0,4,255,235,252,218,8,17,4,250,0,
+67,0,76,0,77,0,78,0,0,19,30,2,51,50,54,55,33,53,33,21,35,17,35,38,36,39,39,
+54,54,53,52,39,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,55,22,21,20,
+6,7,22,22,23,38,53,17,33,22,21,20,6,35,34,38,39,6,6,35,34,38,39,1,33,22,22,
+51,50,54,53,52,1,7,201,35,57,50,38,87,82,4,253,193,8,38,215,157,120,254,235,
+227,49,161,176,38,62,167,116,121,136,15,155,9,56,48,88,131,50,97,163,123,
+121,119,215,96,4,254,85,66,173,136,114,184,58,28,141,95,101,150,77,3,241,
+254,125,41,165,123,72,78,1,160,100,3,160,61,67,27,179,176,146,146,250,168,
+104,118,30,189,13,114,96,71,57,102,99,123,108,53,56,33,26,43,46,51,120,114,
+25,154,165,109,160,44,21,98,76,54,143,3,239,98,105,116,150,113,105,126,137,
+116,123,1,19,162,161,67,62,95,248,225,12,0,0,4,255,235,0,0,7,244,7,86,0,81,
+0,94,0,95,0,96,0,0,1,39,54,51,50,22,21,20,2,4,35,34,38,38,53,17,38,38,35,
+34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,55,46,2,39,55,35,53,33,38,38,35,
+35,34,38,38,53,52,55,23,6,21,20,22,22,51,51,50,22,22,23,51,21,33,17,20,22,
+22,51,50,54,54,53,52,38,35,34,1,22,22,23,54,54,51,50,22,23,38,53,53,1,1,5,
+222,23,79,90,126,136,155,254,249,151,93,127,75,45,74,35,33,47,58,51,98,129,
+91,93,147,74,126,53,73,45,46,85,51,25,80,177,191,37,135,6,146,4,75,84,193,
+191,171,79,11,151,9,55,112,110,160,123,146,81,5,227,252,191,28,63,56,92,177,
+131,69,72,46,250,196,220,186,16,45,94,66,53,86,60,3,1,189,254,87,2,219,146,
+21,142,135,134,254,246,171,67,135,140,1,4,56,61,37,89,94,179,109,121,118,
+75,93,62,80,84,189,143,74,23,115,146,87,71,85,142,100,47,62,10,46,32,74,90,
+37,47,131,127,146,253,59,98,83,42,109,201,107,68,64,1,127,33,168,188,90,92,
+47,60,25,79,210,251,152,7,86,0,5,255,235,255,232,5,236,4,250,0,56,0,65,0,
+66,0,67,0,68,0,0,19,22,4,51,50,54,53,52,38,35,34,21,20,22,23,7,38,53,52,54,
+55,38,38,39,6,6,35,34,38,39,55,30,2,51,50,54,55,33,53,33,21,35,22,21,20,6,
+7,22,22,21,20,6,35,32,0,3,1,33,22,22,51,50,54,53,52,3,19,3,218,163,1,64,212,
+140,149,119,95,128,10,10,147,33,91,92,68,105,37,36,126,88,101,150,77,126,
+35,57,50,38,87,82,4,253,173,6,1,233,69,107,106,105,113,230,205,254,245,254,
+108,168,3,248,254,130,41,165,123,72,78,232,30,7,2,82,251,215,111,93,85,112,
+95,16,52,18,25,71,70,77,94,17,27,104,77,120,126,116,123,75,61,67,27,179,176,
+146,146,107,116,109,139,24,38,159,106,159,195,1,15,1,11,2,102,184,184,76,
+69,109,1,4,251,6,2,144,255,255,255,235,253,220,5,236,4,250,2,34,1,175,0,0,
+0,3,0,129,5,130,0,0,0,8,255,235,255,23,5,217,4,250,0,59,0,68,0,69,0,70,0,
+71,0,72,0,73,0,74,0,0,19,30,2,51,50,54,55,33,53,33,21,35,22,21,20,6,7,22,
+22,21,20,6,7,22,22,23,7,38,36,39,55,22,51,50,54,53,52,38,35,34,6,21,20,23,
+7,38,53,52,54,55,38,38,39,6,6,35,34,38,39,1,33,22,22,51,50,54,53,52,3,3,19,
+3,5,37,201,35,57,50,38,87,82,4,253,193,5,238,234,69,111,107,106,115,135,134,
+91,186,96,74,168,254,144,252,28,128,138,153,153,120,106,83,79,13,152,23,120,
+109,66,102,35,36,126,88,101,150,77,3,236,254,130,41,165,123,72,78,232,87,
+118,76,2,28,254,42,3,160,61,67,27,179,176,146,146,107,116,112,140,21,36,153,
+90,112,145,33,32,89,58,117,113,144,44,143,39,89,90,82,96,55,59,32,30,27,62,
+54,85,112,16,27,103,75,120,126,116,123,1,19,184,184,76,69,109,1,4,251,6,2,
+144,253,152,146,17,0,0,3,255,236,0,0,5,215,4,250,0,53,0,62,0,63,0,0,19,30,
+2,51,50,54,55,33,53,33,21,35,22,21,20,6,7,17,35,53,38,38,35,34,6,21,20,22,
+23,7,38,38,53,52,54,51,50,22,23,38,53,17,6,35,34,38,39,6,6,35,34,38,39,1,
+33,22,22,51,50,54,53,52,3,201,35,57,50,38,87,82,4,253,194,5,235,232,69,31,
+31,157,115,198,94,61,63,64,66,72,107,117,156,111,117,206,109,2,42,48,124,
+189,57,36,126,88,101,150,77,3,236,254,130,41,165,123,72,78,232,3,160,61,67,
+27,179,176,146,146,107,116,59,97,37,253,56,83,146,130,52,45,41,56,24,141,
+40,142,83,106,134,105,120,35,37,1,15,9,125,121,120,126,116,123,1,19,184,184,
+76,69,109,1,4,0,0,5,255,236,0,0,10,37,5,129,0,54,0,69,0,78,0,79,0,80,0,0,
+19,30,2,51,50,54,55,33,53,33,22,23,54,54,51,50,22,23,38,53,17,51,23,51,21,
+35,17,35,17,38,39,1,39,55,54,53,52,38,35,34,7,39,6,6,35,34,38,39,6,6,35,34,
+38,39,5,54,55,55,38,38,35,34,6,7,54,51,50,22,21,1,33,22,22,51,50,54,53,52,
+1,1,201,35,57,50,38,87,82,4,253,194,4,156,84,45,98,211,106,147,238,143,7,
+109,46,217,215,157,74,48,253,237,122,63,44,62,59,63,63,1,33,148,105,129,180,
+57,38,128,87,104,154,71,6,83,48,58,204,70,135,79,101,178,90,58,57,108,120,
+253,153,254,130,45,163,121,72,78,3,156,253,104,3,160,61,67,27,179,176,146,
+92,99,102,103,149,185,72,116,1,11,135,146,251,152,2,229,104,57,254,9,114,
+59,63,67,54,60,38,1,81,84,118,122,116,124,120,119,140,51,55,192,66,61,104,
+111,29,120,103,1,143,186,182,76,69,109,1,4,253,20,0,4,255,236,255,167,9,176,
+4,250,0,69,0,78,0,79,0,80,0,0,1,6,6,7,22,22,23,38,53,17,51,50,4,22,21,20,
+6,35,34,39,55,22,51,50,54,53,52,38,39,17,35,38,36,39,39,54,54,55,38,39,6,
+35,34,38,39,6,6,35,34,38,39,55,30,2,51,50,54,55,33,53,33,21,33,22,21,20,7,
+22,23,1,33,22,22,51,50,54,53,52,1,17,5,203,103,156,53,152,244,91,4,27,208,
+1,48,172,147,133,76,43,10,35,35,78,81,212,182,157,132,254,254,198,72,44,156,
+112,40,80,69,94,124,189,57,36,126,88,101,150,77,126,35,57,50,38,87,82,4,253,
+194,9,196,251,63,69,42,109,74,254,118,254,130,41,165,123,72,78,1,222,1,224,
+42,74,32,35,123,87,118,30,3,41,116,210,129,121,145,10,147,4,58,72,105,158,
+19,252,47,134,128,35,180,29,85,56,33,56,33,125,121,120,126,116,123,75,61,
+67,27,179,176,146,146,107,116,96,68,72,75,2,22,184,184,76,69,109,1,4,251,
+6,0,4,255,236,0,0,8,4,4,250,0,44,0,58,0,67,0,68,0,0,19,30,2,51,50,54,55,33,
+53,33,21,35,17,35,53,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,55,38,39,
+6,35,34,38,39,6,6,35,34,38,39,1,33,22,21,20,6,7,22,23,22,22,23,38,53,1,33,
+22,22,51,50,54,53,52,19,201,35,57,50,38,87,82,4,253,194,8,24,215,157,117,
+197,93,61,63,64,66,72,107,117,124,101,19,52,51,63,124,189,57,36,126,88,101,
+150,77,6,69,254,95,69,37,36,93,6,82,162,80,2,253,167,254,130,41,165,123,72,
+78,89,3,160,61,67,27,179,176,146,146,251,152,83,148,130,52,45,41,56,24,141,
+40,142,83,94,128,13,69,58,15,125,121,120,126,116,123,1,19,107,116,64,103,
+38,98,109,18,107,89,47,115,2,175,184,184,76,69,109,254,3,0,3,255,235,255,
+134,5,138,4,250,0,47,0,60,0,83,0,0,37,38,35,34,6,21,20,23,7,38,38,35,34,6,
+21,20,23,7,38,38,53,52,54,55,34,38,39,55,30,2,51,50,54,55,46,3,39,55,35,53,
+33,21,35,17,35,1,22,22,23,54,54,51,50,22,23,38,53,53,17,38,38,35,34,6,7,6,
+6,7,50,55,51,50,22,23,54,51,50,22,23,38,53,4,22,50,48,41,44,5,125,15,106,
+78,59,70,172,59,136,136,66,62,96,142,68,116,35,55,49,35,47,83,51,21,52,92,
+162,145,37,135,5,159,215,157,252,228,191,180,20,53,95,61,51,83,65,3,45,74,
+35,42,68,91,71,78,34,6,6,13,82,135,39,45,97,35,55,28,3,198,47,59,56,27,26,
+6,101,114,58,47,107,57,139,50,154,105,64,107,33,123,116,74,60,68,26,64,68,
+111,102,64,39,15,115,146,146,251,64,4,192,30,143,147,81,82,42,65,25,77,162,
+254,86,56,61,62,127,100,85,21,1,68,63,89,27,27,29,90,0,6,255,235,252,218,
+7,244,7,86,0,111,0,124,0,125,0,126,0,127,0,128,0,0,1,39,54,51,50,22,21,20,
+6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,23,53,52,55,6,6,35,34,38,38,53,53,38,38,35,34,6,6,7,6,6,35,34,38,39,55,
+22,22,51,50,54,55,46,2,39,55,35,53,33,38,38,35,35,34,38,38,53,52,55,23,6,
+21,20,22,22,51,51,50,22,22,23,51,21,33,17,20,22,22,51,50,18,53,52,38,35,34,
+1,22,22,23,54,54,51,50,22,23,38,53,53,1,3,7,1,5,222,23,79,90,125,137,50,49,
+153,26,113,92,54,113,114,64,167,199,24,157,21,101,111,54,93,92,55,190,82,
+3,73,159,85,93,126,75,45,74,35,33,47,58,51,98,129,91,93,147,74,126,53,73,
+45,46,85,51,25,80,177,191,37,135,6,146,4,75,84,193,191,171,79,11,151,9,55,
+112,110,160,123,146,81,5,227,252,191,19,64,63,147,254,70,72,46,250,197,220,
+186,16,45,94,66,53,86,60,3,1,140,10,2,254,198,2,253,146,21,149,139,75,148,
+72,253,29,93,85,17,18,195,187,91,97,19,88,84,115,117,18,17,111,248,45,74,
+56,55,65,129,135,243,56,61,37,89,94,179,109,121,118,75,93,62,80,84,189,143,
+74,23,115,146,87,71,85,142,100,47,62,10,46,32,74,90,37,47,131,127,146,253,
+80,75,89,50,1,6,152,72,67,1,93,33,168,188,90,92,47,60,51,53,210,248,114,2,
+43,79,8,160,0,7,255,235,252,218,5,231,4,250,0,78,0,87,0,88,0,89,0,90,0,91,
+0,92,0,0,5,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,
+51,50,23,17,52,38,38,35,34,6,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,
+38,38,39,6,6,35,34,38,39,55,30,2,51,50,54,55,33,53,33,21,35,22,21,20,6,7,
+22,22,21,3,33,22,22,51,50,54,53,52,3,19,3,7,19,5,16,153,23,94,77,64,107,108,
+61,221,207,20,155,18,122,142,55,101,100,61,152,68,25,61,52,68,128,81,50,49,
+40,45,14,48,82,101,125,120,99,40,66,26,36,127,87,101,150,77,126,35,57,50,
+38,87,82,4,253,193,5,252,247,68,51,50,37,28,217,254,130,41,165,123,72,78,
+232,195,47,100,12,240,94,84,17,18,196,197,87,99,28,65,91,124,125,18,17,111,
+1,228,72,62,32,64,102,43,38,32,7,140,16,104,94,80,172,54,28,81,52,120,126,
+116,123,75,61,67,27,179,176,146,146,108,110,75,112,37,35,89,66,2,120,184,
+184,76,69,109,1,4,251,6,252,230,12,6,20,0,5,255,236,255,167,10,37,5,129,0,
+79,0,94,0,103,0,104,0,105,0,0,19,30,2,51,50,54,55,33,53,33,22,23,54,54,51,
+50,22,23,38,53,17,51,23,51,21,35,17,35,38,38,35,34,7,6,35,34,38,53,52,55,
+23,6,21,20,22,51,50,55,54,51,50,22,23,17,38,39,1,39,55,54,53,52,38,35,34,
+7,39,6,6,35,34,38,39,6,6,35,34,38,39,5,54,55,55,38,38,35,34,6,7,54,51,50,
+22,21,1,33,22,22,51,50,54,53,52,1,1,201,35,57,50,38,87,82,4,253,194,4,156,
+84,45,98,211,106,147,238,143,7,109,46,217,215,153,24,100,84,67,138,138,78,
+228,231,19,157,16,145,153,62,129,129,68,88,114,36,74,48,253,237,122,63,44,
+62,59,63,63,1,33,148,105,124,189,57,39,124,86,100,150,79,6,83,48,58,204,70,
+135,79,101,178,90,58,57,108,120,253,153,254,130,41,165,123,72,78,3,156,253,
+98,3,160,61,67,27,179,176,146,92,99,102,103,149,185,72,116,1,11,135,146,251,
+63,92,86,17,18,173,169,86,51,19,46,69,100,98,18,17,56,55,2,104,104,57,254,
+9,114,59,63,67,54,60,38,1,81,84,125,121,123,123,114,125,140,51,55,192,66,
+61,104,111,29,120,103,1,143,184,184,76,69,109,1,4,253,20,0,0,7,255,235,252,
+218,4,204,4,250,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,0,1,38,39,33,53,33,21,
+33,22,23,30,2,21,20,6,7,22,4,23,7,38,39,22,21,17,35,53,38,38,35,34,6,21,20,
+22,23,7,38,38,53,52,54,51,50,22,23,39,53,38,37,55,22,22,51,50,54,53,52,38,
+35,34,6,21,20,23,7,38,53,52,54,19,19,3,3,7,19,1,207,42,110,254,180,4,225,
+253,94,50,22,133,203,109,202,189,136,1,18,137,95,162,120,3,157,100,188,88,
+61,63,64,66,72,107,117,158,118,98,191,104,3,193,254,225,29,70,134,95,182,
+184,154,129,103,101,13,149,23,100,235,97,134,10,2,23,3,237,87,36,146,146,
+43,61,2,92,168,97,155,191,25,50,157,108,109,122,74,66,66,254,249,105,106,
+105,52,45,41,56,24,141,40,142,83,107,133,86,93,87,110,97,67,142,22,17,124,
+114,103,121,59,63,34,32,30,67,58,78,113,1,40,251,6,252,218,2,43,79,2,90,0,
+0,4,255,235,255,126,6,22,4,250,0,60,0,61,0,62,0,63,0,0,1,33,22,23,22,22,23,
+54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,6,6,7,22,4,23,7,36,36,37,
+55,22,22,51,50,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,35,53,
+33,33,19,3,6,22,251,155,50,22,166,229,37,103,148,123,152,159,159,49,106,106,
+74,62,68,126,52,38,184,145,136,1,18,137,95,254,245,254,130,254,245,29,70,
+134,95,182,184,154,129,103,101,13,149,23,100,99,42,110,211,6,43,251,200,71,
+76,4,104,43,61,1,142,126,115,141,112,122,170,48,147,27,88,61,62,66,100,99,
+98,118,19,50,157,108,109,203,181,61,142,22,17,124,114,103,121,59,63,34,32,
+30,67,58,78,113,27,87,36,146,251,6,1,16,0,6,255,236,0,0,7,203,4,250,0,53,
+0,65,0,76,0,77,0,78,0,79,0,0,33,53,38,38,35,34,6,21,20,23,7,38,53,52,54,55,
+38,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,33,53,33,21,33,21,54,55,23,
+6,21,20,22,23,7,38,53,52,55,6,7,17,1,22,23,22,23,22,22,51,51,50,55,17,17,
+35,34,39,22,23,22,22,23,38,53,17,1,1,4,139,111,192,98,71,73,36,152,52,140,
+119,37,165,101,71,73,35,151,52,147,123,22,57,254,207,7,223,253,93,200,188,
+125,93,33,38,154,77,49,138,171,252,169,45,4,49,37,110,249,155,25,12,12,45,
+155,160,51,6,86,154,67,4,254,118,254,147,168,160,142,63,54,56,49,62,86,98,
+98,128,15,112,128,63,54,54,51,62,87,97,100,127,14,79,57,146,146,249,28,90,
+124,170,233,99,185,115,36,253,217,164,138,57,18,253,36,4,104,71,77,13,19,
+41,42,1,1,6,254,106,47,80,89,23,117,95,31,105,3,5,253,108,1,125,0,7,255,235,
+252,218,5,27,4,250,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,0,1,33,22,23,30,2,
+21,20,6,7,22,4,23,7,38,39,22,21,21,35,53,38,35,34,6,21,20,23,7,38,38,35,34,
+6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,51,50,22,23,53,38,36,39,55,22,
+22,51,50,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,55,38,39,33,53,33,33,
+19,3,3,7,3,5,27,253,94,50,22,133,203,109,202,189,136,1,18,137,95,125,84,5,
+157,60,58,41,44,5,125,15,106,78,59,70,172,59,136,136,156,121,82,135,39,45,
+97,39,64,38,124,254,255,180,29,70,134,95,182,184,154,129,103,101,13,149,23,
+100,99,42,110,254,101,5,48,253,139,172,68,10,2,127,4,104,43,61,2,92,168,97,
+155,191,25,50,157,108,109,94,55,68,97,183,224,68,59,56,27,26,6,101,114,58,
+47,107,57,139,50,154,105,102,136,68,63,89,34,41,83,70,94,42,142,22,17,124,
+114,103,121,59,63,34,32,30,67,58,78,113,27,87,36,146,251,6,252,218,2,43,79,
+2,90,0,1,0,100,255,246,3,16,4,250,0,21,0,0,1,21,35,14,2,21,20,22,51,50,54,
+55,23,6,35,34,2,53,16,0,55,2,227,51,99,208,119,161,124,50,74,41,72,96,149,
+194,245,1,43,240,4,250,146,24,179,251,138,191,203,23,24,126,73,1,43,244,1,
+3,1,141,85,0,0,2,255,190,255,246,3,16,7,86,0,44,0,45,0,0,1,21,35,14,2,21,
+20,22,51,50,54,55,23,6,35,34,2,53,52,0,55,53,52,38,35,35,34,38,38,53,52,55,
+23,6,21,20,22,22,51,51,50,22,22,23,1,2,227,51,99,208,119,161,124,50,74,41,
+72,96,149,194,245,1,2,221,76,87,41,191,171,79,11,151,9,55,112,110,8,123,146,
+81,5,253,157,4,250,146,24,179,251,138,191,203,23,24,126,73,1,43,244,240,1,
+122,99,14,90,78,85,142,100,47,62,10,46,32,74,90,37,47,131,127,2,92,0,2,0,
+58,0,66,6,36,5,4,0,65,0,66,0,0,19,55,18,0,33,50,54,53,52,39,6,7,39,54,54,
+53,52,39,7,7,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,
+6,7,39,54,54,51,50,22,23,55,55,22,22,21,20,6,7,22,21,20,4,35,32,0,1,58,151,
+127,1,152,1,58,166,183,71,72,104,64,159,140,61,159,125,15,120,90,75,123,79,
+73,80,113,124,168,153,87,135,114,56,44,55,84,52,141,113,234,120,123,156,48,
+121,125,80,84,52,51,124,254,233,231,254,141,254,10,2,208,3,182,47,254,118,
+254,130,118,107,89,68,49,41,148,60,144,97,88,64,193,6,110,120,56,75,37,112,
+81,117,164,63,136,48,87,56,35,41,22,25,122,146,146,94,91,146,29,63,160,87,
+75,133,57,103,161,165,204,1,186,2,254,0,3,255,235,253,213,6,228,4,250,0,111,
+0,112,0,113,0,0,19,55,18,0,33,50,54,53,52,39,6,7,39,54,54,53,52,39,7,7,38,
+38,35,34,6,7,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,54,51,
+50,22,23,38,53,53,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,22,23,7,38,38,
+53,52,54,51,50,22,23,54,54,51,50,22,23,38,53,53,33,53,33,21,33,17,20,7,55,
+55,22,21,20,6,7,22,21,20,4,35,32,0,1,3,174,151,127,1,152,1,58,163,186,66,
+69,112,64,160,139,60,160,125,15,120,90,75,123,79,73,80,113,124,168,153,87,
+135,114,56,44,55,84,52,141,113,234,120,80,104,40,7,107,100,62,68,5,133,20,
+138,88,81,94,76,89,63,132,137,190,139,97,144,66,26,105,67,56,104,61,2,251,
+112,6,249,254,52,4,78,125,164,49,49,119,254,234,228,254,146,254,0,3,75,65,
+1,21,47,254,148,254,159,108,100,78,62,46,44,148,57,136,92,83,60,193,6,110,
+120,56,75,37,112,81,117,164,63,136,48,87,56,35,41,22,25,122,146,146,48,46,
+78,44,98,109,65,61,22,27,7,97,114,74,63,62,88,35,149,50,176,118,117,158,64,
+78,51,59,39,46,27,72,123,146,146,253,251,53,103,117,29,127,173,72,126,54,
+96,151,156,194,1,160,5,126,248,219,0,0,4,255,235,255,244,6,129,4,250,0,35,
+0,44,0,56,0,57,0,0,1,22,22,21,20,6,35,34,38,39,22,21,17,35,38,0,39,39,54,
+36,55,53,33,53,33,21,33,17,22,22,51,50,54,53,52,39,37,6,4,7,22,4,23,38,53,
+1,34,38,53,52,54,51,50,22,21,20,6,1,4,224,152,170,145,118,88,141,53,2,157,
+100,254,131,234,80,207,1,142,190,252,133,6,150,253,130,43,130,87,56,72,196,
+254,163,168,254,210,134,189,1,80,86,7,254,24,50,74,71,53,50,70,70,1,182,3,
+176,28,173,131,125,151,75,76,45,43,254,113,191,1,12,39,197,122,182,60,69,
+146,146,254,146,142,142,68,64,151,36,102,58,138,80,43,215,143,83,83,254,112,
+68,52,51,70,70,51,52,68,5,6,0,0,4,255,235,0,0,6,129,4,250,0,35,0,40,0,50,
+0,51,0,0,1,22,22,21,20,6,35,34,38,39,22,21,17,35,38,0,39,39,54,36,55,53,33,
+53,33,21,33,17,22,22,51,50,54,53,52,39,37,6,7,22,23,21,38,37,6,7,22,4,23,
+38,53,17,4,224,152,170,145,118,88,141,53,2,157,102,254,132,233,80,207,1,142,
+190,252,133,6,150,253,130,43,130,87,56,72,196,254,163,143,154,176,121,181,
+254,250,72,92,196,1,79,83,7,3,176,28,173,131,125,151,75,76,45,43,254,113,
+192,1,11,39,197,122,182,60,69,146,146,254,146,142,142,68,64,151,36,101,44,
+70,62,111,164,194,73,37,55,46,215,139,61,107,3,116,0,0,2,0,58,0,66,6,36,5,
+8,0,70,0,71,0,0,19,55,18,0,33,50,54,53,52,39,6,7,39,54,54,53,52,39,7,7,38,
+38,35,34,6,21,20,22,23,7,38,39,6,6,35,39,54,54,53,52,38,35,34,7,39,54,51,
+50,22,23,54,54,51,50,22,23,55,55,22,22,21,20,6,7,22,21,20,4,35,32,0,1,58,
+151,127,1,152,1,58,166,183,73,71,103,64,159,140,61,142,125,21,82,65,61,73,
+107,103,11,206,76,37,144,100,13,99,104,91,84,62,66,16,81,71,80,132,38,31,
+121,78,88,112,50,108,125,80,84,52,51,124,254,233,231,254,140,254,10,2,209,
+3,182,47,254,118,254,130,118,107,88,67,47,41,148,60,144,97,88,64,173,6,107,
+101,74,64,70,78,5,153,13,135,74,79,153,1,82,68,69,76,22,148,19,69,66,65,70,
+85,91,133,29,63,160,87,75,133,57,103,161,165,204,1,186,2,254,0,4,255,235,
+255,72,4,230,4,250,0,3,0,48,0,49,0,50,0,0,1,33,53,33,1,7,7,38,38,35,34,6,
+21,20,22,23,7,38,38,53,52,54,51,50,22,23,55,55,22,22,21,20,6,7,22,4,23,7,
+36,36,37,55,22,22,51,50,54,53,52,1,3,4,230,251,5,4,251,254,121,154,125,15,
+112,80,55,64,51,67,71,102,109,160,114,114,145,48,121,125,89,87,207,192,137,
+1,22,140,95,254,244,254,121,254,230,29,60,147,120,178,192,254,194,102,4,104,
+146,254,110,190,6,110,120,58,44,47,66,32,145,45,148,96,111,131,93,92,146,
+29,86,195,99,166,215,28,49,158,110,113,202,186,64,146,19,23,158,135,116,1,
+237,251,232,0,255,255,255,235,253,213,6,77,4,250,2,34,0,31,0,0,0,35,0,56,
+5,149,0,0,0,3,0,51,4,12,0,187,255,255,255,235,253,213,6,229,4,250,2,34,0,
+31,0,0,0,35,0,51,4,202,0,125,0,3,0,57,5,149,0,0,255,255,255,235,253,213,5,
+223,4,250,2,34,0,31,0,0,0,35,0,58,5,149,0,0,0,3,0,51,4,87,0,153,255,255,255,
+235,253,213,5,200,4,250,2,34,0,31,0,0,0,35,0,64,4,105,0,0,0,3,0,51,4,87,0,
+153,255,255,255,235,253,213,5,156,4,250,2,34,0,32,0,0,0,35,0,56,4,228,0,0,
+0,3,0,51,3,109,0,96,255,255,255,235,253,213,5,208,4,250,2,34,0,32,0,0,0,35,
+0,51,3,167,0,32,0,3,0,57,4,128,0,0,255,255,255,235,253,213,5,6,4,250,2,34,
+0,32,0,0,0,35,0,58,4,188,0,0,0,3,0,51,3,167,0,32,255,255,255,235,253,213,
+5,104,4,250,2,34,0,32,0,0,0,35,0,64,4,128,0,0,0,3,0,51,4,165,0,0,0,2,0,94,
+255,167,7,139,5,129,0,87,0,88,0,0,1,22,22,21,20,6,35,34,38,39,22,21,17,35,
+38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,17,
+38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,54,
+51,50,22,23,38,53,53,51,23,33,21,33,17,22,22,51,50,54,53,52,39,1,5,236,152,
+170,145,118,88,142,53,3,153,28,117,83,67,122,122,68,218,223,19,157,16,138,
+146,59,109,109,65,90,119,49,136,205,113,83,137,70,74,120,123,142,148,165,
+104,142,111,73,61,48,90,61,165,102,236,139,133,225,119,7,108,47,2,126,253,
+132,43,130,87,56,72,196,254,38,3,176,28,173,131,125,151,76,76,52,53,254,40,
+86,92,17,18,193,188,95,57,19,55,80,117,115,18,17,55,56,2,163,186,152,79,101,
+39,141,101,117,181,93,149,62,108,64,48,59,22,29,134,178,173,131,144,79,107,
+210,135,146,254,146,142,142,68,64,151,36,1,221,0,0,3,255,236,0,0,7,115,4,
+250,0,3,0,78,0,79,0,0,3,53,33,21,5,22,22,21,20,6,35,34,38,39,22,21,17,35,
+38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,52,
+38,38,35,34,6,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,54,51,50,22,22,21,
+21,22,22,51,50,54,53,52,39,1,20,7,135,254,97,152,170,145,118,89,142,53,4,
+153,23,101,83,65,119,119,76,219,219,20,155,18,134,150,59,109,109,65,164,73,
+25,67,57,72,139,88,53,54,42,49,14,50,86,106,131,131,215,116,102,132,70,43,
+130,87,56,72,196,254,163,4,104,146,146,184,28,173,131,125,151,77,77,39,66,
+254,127,93,85,17,18,196,197,87,99,23,65,91,125,124,18,17,111,2,40,69,64,33,
+73,117,49,43,37,7,144,16,114,103,91,190,119,61,106,105,47,142,142,68,64,151,
+36,1,221,0,0,4,0,94,252,218,7,37,5,129,0,85,0,86,0,87,0,88,0,0,1,22,22,21,
+20,6,35,34,38,39,22,21,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,
+22,51,50,55,54,51,50,23,53,38,36,39,39,54,54,53,52,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,21,20,6,7,22,4,23,38,53,17,51,23,33,21,33,17,22,22,51,
+50,54,53,52,39,1,19,7,5,134,152,170,145,118,88,142,53,3,153,25,109,91,55,
+115,115,66,172,198,19,157,16,104,113,55,95,95,57,175,88,142,254,145,225,47,
+232,233,113,112,92,99,70,90,139,192,162,181,206,209,194,181,1,22,98,4,108,
+47,2,126,253,132,43,130,87,56,72,196,254,38,181,100,3,176,28,173,131,125,
+151,76,76,52,54,253,146,91,87,17,18,162,156,68,67,19,58,52,91,86,18,17,121,
+36,203,244,41,189,17,138,122,89,94,72,54,63,34,128,91,140,115,149,182,149,
+139,195,38,53,190,137,54,143,3,246,135,146,254,146,142,142,68,64,151,36,1,
+221,247,236,12,0,3,255,235,255,136,7,117,4,250,0,72,0,73,0,74,0,0,1,22,22,
+21,20,6,35,34,38,39,6,21,20,22,23,7,38,38,35,34,6,7,6,35,34,38,38,53,52,55,
+23,6,21,20,22,51,50,54,55,54,51,50,23,38,53,52,54,55,6,4,7,39,17,33,53,33,
+21,33,17,54,36,55,23,6,7,22,22,51,50,54,53,52,39,1,19,5,212,152,170,145,118,
+100,154,54,5,30,41,154,27,136,101,48,98,51,131,74,112,185,98,19,157,16,112,
+106,45,89,51,126,81,135,107,28,41,33,151,254,200,160,121,254,83,7,138,250,
+192,124,1,67,200,133,40,24,44,125,81,56,72,196,253,194,141,3,176,28,173,131,
+125,151,96,96,50,77,130,208,144,39,89,89,17,10,28,79,153,106,68,67,19,58,
+52,98,99,16,12,27,84,144,191,99,213,69,66,227,161,82,2,151,146,146,253,255,
+129,203,74,132,79,80,126,126,68,64,151,36,1,221,250,173,0,4,0,94,252,218,
+7,7,5,8,0,75,0,84,0,85,0,86,0,0,1,22,22,21,20,6,35,34,38,39,22,21,17,35,38,
+38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,0,
+39,39,54,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,55,53,33,21,
+33,17,22,22,51,50,54,53,52,39,37,6,4,7,22,4,23,38,53,19,7,5,104,152,170,145,
+118,89,141,53,3,153,25,109,91,53,110,110,63,165,190,19,157,16,97,107,52,90,
+90,53,175,88,100,254,131,234,80,144,135,130,142,125,60,49,13,32,41,62,66,
+51,54,186,193,3,25,253,132,43,130,87,56,72,196,254,163,168,254,210,134,189,
+1,80,86,7,86,100,3,176,28,173,131,125,151,76,77,54,53,253,146,91,87,17,18,
+162,156,68,67,19,58,52,90,87,18,17,121,36,191,1,12,39,197,85,67,96,130,93,
+122,10,147,4,50,42,43,60,27,85,61,215,146,254,146,142,142,68,64,151,36,102,
+58,138,80,43,215,143,83,83,251,98,12,0,0,6,255,236,252,218,5,187,4,250,0,
+82,0,83,0,84,0,85,0,86,0,87,0,0,19,55,18,0,51,50,54,53,52,39,6,7,39,54,54,
+53,52,38,35,35,34,6,6,21,20,23,7,38,53,52,54,55,38,39,38,38,35,34,6,21,20,
+22,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,53,33,21,33,22,
+21,20,6,7,22,22,21,20,7,22,22,21,20,6,35,32,0,1,1,3,7,3,75,153,103,1,42,241,
+131,144,73,69,65,59,124,122,75,80,32,43,142,94,102,41,221,110,103,47,44,65,
+47,26,39,50,38,47,112,141,137,94,68,114,86,78,91,57,74,76,97,252,0,5,207,
+254,233,69,36,35,51,52,95,58,58,238,201,254,219,254,117,2,179,1,33,71,100,
+41,1,203,47,254,209,254,235,92,84,71,54,35,22,145,35,96,63,55,60,43,86,46,
+68,15,151,45,180,73,136,48,33,42,58,24,47,40,32,62,42,112,122,137,101,121,
+45,77,70,48,74,71,109,114,146,146,107,116,64,101,36,32,94,62,116,89,45,112,
+67,142,174,1,89,4,134,250,22,253,214,12,5,159,0,5,255,235,252,218,7,7,4,250,
+0,60,0,69,0,70,0,71,0,72,0,0,1,22,22,21,20,6,35,34,38,39,22,21,17,35,38,38,
+35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,0,39,
+39,54,36,55,53,33,53,33,21,33,17,22,22,51,50,54,53,52,39,37,6,4,7,22,4,23,
+38,53,17,19,7,5,104,152,170,145,118,88,142,53,3,153,25,109,91,53,110,110,
+63,165,190,19,157,16,97,107,52,90,90,53,175,88,100,254,131,234,80,207,1,142,
+190,251,253,7,28,253,132,43,130,87,56,72,196,254,163,168,254,210,134,189,
+1,80,86,7,86,100,3,176,28,173,131,125,151,76,76,54,53,253,147,91,87,17,18,
+162,156,68,67,19,58,52,90,87,18,17,121,36,191,1,12,39,197,122,182,60,69,146,
+146,254,146,142,142,68,64,151,36,102,58,138,80,43,215,143,83,83,3,118,247,
+236,12,0,0,3,255,236,0,0,7,95,4,250,0,3,0,71,0,72,0,0,3,53,33,21,1,35,38,
+38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,52,55,
+6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,23,21,22,22,51,50,54,53,52,
+39,55,22,22,21,20,6,35,34,38,39,22,21,3,20,7,115,253,132,153,22,98,83,63,
+117,118,74,215,214,20,155,18,129,148,59,106,105,64,161,71,5,81,166,109,128,
+149,47,162,38,58,53,90,143,64,206,43,130,87,56,72,196,29,152,170,145,118,
+89,141,53,3,157,4,104,146,146,251,152,91,87,17,18,196,197,87,99,23,65,91,
+124,125,18,17,111,1,194,73,51,113,98,129,113,83,89,49,60,55,51,53,130,115,
+44,166,142,142,68,64,151,36,147,28,173,131,125,151,75,76,51,52,3,122,0,0,
+2,255,238,255,167,7,36,5,129,0,89,0,90,0,0,3,54,51,50,22,23,54,54,51,50,22,
+23,38,53,53,51,23,33,21,33,17,22,22,51,50,54,53,52,39,55,22,22,21,20,6,35,
+34,38,39,17,35,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,23,17,38,38,35,34,6,21,20,22,23,7,38,38,39,6,6,35,39,54,54,53,52,38,35,
+34,7,37,18,94,82,104,162,39,35,148,93,86,155,59,4,108,48,2,125,253,132,43,
+130,87,56,72,196,29,152,170,145,118,87,140,53,153,49,168,60,115,115,64,151,
+186,19,157,16,82,99,53,101,102,46,182,79,62,145,84,84,95,142,138,14,139,181,
+41,40,186,133,13,133,140,112,104,76,81,3,145,4,245,19,94,86,87,93,77,76,36,
+73,165,135,146,254,147,143,142,68,64,151,36,147,28,173,131,125,151,74,74,
+253,195,178,17,18,166,155,74,58,19,52,57,92,86,18,17,111,3,37,104,104,92,
+82,88,97,7,158,8,100,92,95,105,158,2,101,83,86,94,22,158,0,0,7,255,235,252,
+218,5,241,4,250,0,69,0,77,0,78,0,79,0,80,0,81,0,82,0,0,19,30,2,51,50,54,55,
+33,53,33,21,33,22,21,20,6,7,22,22,21,20,6,7,22,22,21,20,6,35,32,0,3,55,18,
+0,51,50,54,53,52,39,6,7,39,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,55,
+38,38,39,6,6,35,34,38,39,1,33,18,51,50,54,53,52,3,19,3,7,19,201,35,57,50,
+38,87,82,4,253,193,6,6,254,254,69,42,42,48,48,48,47,58,58,238,201,254,219,
+254,117,108,153,103,1,42,241,131,144,73,69,65,59,124,122,156,128,182,102,
+41,221,119,107,38,64,25,36,127,87,101,150,77,3,236,254,130,83,246,72,78,227,
+214,71,100,34,3,160,61,67,27,179,176,146,146,104,114,68,105,37,32,92,60,58,
+103,44,45,112,67,142,174,1,89,1,87,47,254,209,254,235,92,84,71,54,35,22,145,
+35,96,63,116,110,66,68,15,151,45,180,75,142,46,27,79,51,120,126,116,123,1,
+19,254,144,76,69,109,1,4,250,22,253,214,12,6,22,0,0,3,255,236,255,167,7,114,
+4,250,0,75,0,84,0,85,0,0,19,30,2,51,50,54,55,33,53,33,21,33,22,21,20,6,7,
+22,22,51,50,54,53,52,39,55,22,22,21,20,6,35,34,38,39,22,21,17,35,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,6,35,34,38,
+39,6,6,35,34,38,39,1,33,22,22,51,50,54,53,52,3,201,35,57,50,38,87,82,4,253,
+194,7,134,253,125,69,26,25,44,122,83,56,72,196,29,152,170,145,118,89,141,
+53,3,153,28,119,97,55,123,122,75,172,202,19,157,16,105,111,64,101,100,58,
+202,88,42,48,124,189,57,36,126,88,101,150,77,3,236,254,130,41,165,123,72,
+78,63,3,160,61,67,27,179,176,146,146,107,116,53,89,36,124,125,68,64,151,36,
+147,28,173,131,125,151,75,76,52,52,254,40,93,85,17,18,162,156,68,67,19,58,
+52,90,87,18,17,111,1,242,9,125,121,120,126,116,123,1,19,184,184,76,69,109,
+1,4,0,0,4,255,235,255,134,7,48,4,250,0,68,0,81,0,104,0,105,0,0,1,22,22,21,
+20,6,35,34,38,39,22,21,17,35,17,38,35,34,6,21,20,23,7,38,38,35,34,6,21,20,
+23,7,38,38,53,52,54,55,34,38,39,55,30,2,51,50,54,55,46,3,39,55,35,53,33,21,
+33,17,22,22,51,50,54,53,52,39,1,22,22,23,54,54,51,50,22,23,38,53,53,19,38,
+53,53,38,38,35,34,6,7,6,6,7,50,55,51,50,22,23,54,51,50,22,19,5,144,152,170,
+145,118,88,142,53,3,157,50,48,41,44,5,125,15,106,78,59,70,172,59,136,136,
+66,62,96,142,68,116,35,55,49,35,47,83,51,21,52,92,162,145,37,135,7,69,253,
+131,43,130,87,56,72,196,251,135,191,180,20,53,95,61,51,83,65,3,3,3,45,74,
+35,42,68,91,71,78,34,6,6,13,82,135,39,45,97,35,55,25,3,176,28,173,131,125,
+151,76,76,71,36,254,42,1,31,47,59,56,27,26,6,101,114,58,47,107,57,139,50,
+154,105,64,107,33,123,116,74,60,68,26,64,68,111,102,64,39,15,115,146,146,
+254,146,142,142,68,64,151,36,1,75,30,143,147,81,82,42,65,25,77,162,252,225,
+29,90,254,56,61,62,127,100,85,21,1,68,63,89,27,3,150,0,4,255,235,255,244,
+6,59,4,250,0,30,0,39,0,51,0,52,0,0,33,35,38,0,39,39,54,36,55,53,33,53,33,
+21,33,17,54,55,23,6,21,20,23,7,38,38,53,52,55,6,7,3,6,4,7,22,4,23,38,53,1,
+34,38,53,52,54,51,50,22,21,20,6,1,4,3,157,100,254,131,234,80,207,1,142,190,
+252,133,6,80,253,200,174,171,119,79,55,144,29,34,39,114,158,157,168,254,210,
+134,189,1,80,86,7,254,24,50,74,71,53,50,70,70,1,182,191,1,12,39,197,122,182,
+60,69,146,146,254,157,73,55,119,134,196,154,159,33,85,189,78,159,107,38,70,
+1,27,58,138,80,43,215,143,83,83,254,112,68,52,51,70,70,51,52,68,5,6,0,0,4,
+255,235,0,0,6,59,4,250,0,30,0,35,0,45,0,46,0,0,33,35,38,0,39,39,54,36,55,
+53,33,53,33,21,33,17,54,55,23,6,21,20,23,7,38,38,53,52,55,6,7,3,6,7,22,23,
+21,38,37,6,7,22,4,23,38,53,17,4,3,157,102,254,132,233,80,207,1,142,190,252,
+133,6,80,253,200,174,171,119,79,55,144,29,34,39,114,158,157,143,154,176,121,
+181,254,250,72,92,196,1,79,83,7,192,1,11,39,197,122,182,60,69,146,146,254,
+157,73,55,119,134,196,154,159,33,85,189,78,159,107,38,70,1,26,44,70,62,111,
+164,194,73,37,55,46,215,139,61,107,3,116,0,0,2,0,94,255,167,7,71,5,129,0,
+82,0,83,0,0,1,17,54,55,23,6,21,20,23,7,38,38,53,52,55,6,7,17,35,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,17,38,38,35,
+34,6,7,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,
+23,38,53,53,51,23,33,21,37,5,15,174,171,119,79,55,144,29,34,39,114,158,153,
+28,117,83,67,122,122,68,218,223,19,157,16,138,146,59,109,109,65,90,119,49,
+136,205,113,83,137,70,74,120,123,142,148,165,104,142,111,73,61,48,90,61,165,
+102,236,139,133,225,119,7,108,47,2,58,252,174,4,104,254,157,73,55,119,134,
+196,154,159,33,85,189,78,159,107,38,70,253,63,86,92,17,18,193,188,95,57,19,
+55,80,117,115,18,17,55,56,2,163,186,152,79,101,39,141,101,117,181,93,149,
+62,108,64,48,59,22,29,134,178,173,131,144,79,107,210,135,146,146,0,4,0,94,
+252,218,6,225,5,129,0,80,0,81,0,82,0,83,0,0,1,33,17,54,55,23,6,21,20,23,7,
+38,38,53,52,55,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,55,54,51,50,23,53,38,36,39,39,54,54,53,52,38,35,34,6,21,20,23,7,38,
+53,52,54,51,50,22,21,20,6,7,22,4,23,38,53,17,51,23,33,33,19,7,6,225,253,200,
+174,171,119,79,55,144,29,34,39,114,158,153,25,109,91,55,115,115,66,172,198,
+19,157,16,104,113,55,95,95,57,175,88,142,254,145,225,47,232,233,113,112,92,
+99,70,90,139,192,162,181,206,209,194,181,1,22,98,4,108,47,2,58,252,174,181,
+100,4,104,254,157,73,55,119,134,196,154,159,33,85,189,78,159,107,38,70,252,
+168,91,87,17,18,162,156,68,67,19,58,52,91,86,18,17,121,36,203,244,41,189,
+17,138,122,89,94,72,54,63,34,128,91,140,115,149,182,149,139,195,38,53,190,
+137,54,143,3,246,135,247,236,12,0,0,3,255,235,255,136,7,51,4,250,0,71,0,72,
+0,73,0,0,3,53,33,21,33,17,54,36,55,23,6,7,54,54,55,23,6,21,20,23,7,38,38,
+53,52,55,6,6,7,6,21,20,22,23,7,38,38,35,34,6,7,6,35,34,38,38,53,52,55,23,
+6,21,20,22,51,50,54,55,54,51,50,23,38,53,52,54,55,6,4,7,39,17,37,19,21,7,
+72,251,2,124,1,67,200,133,37,26,66,198,74,119,79,55,144,29,34,39,75,170,56,
+8,30,41,154,27,136,101,48,98,51,131,74,112,185,98,19,157,16,112,106,45,89,
+51,126,81,135,107,28,41,33,151,254,200,160,121,1,225,141,4,104,146,146,253,
+255,129,203,74,132,68,82,45,94,23,119,134,196,154,159,33,85,189,78,173,102,
+27,94,44,69,98,130,208,144,39,89,89,17,10,28,79,153,106,68,67,19,58,52,98,
+99,16,12,27,84,144,191,99,213,69,66,227,161,82,2,151,146,250,173,0,0,4,0,
+94,252,218,6,195,5,8,0,70,0,79,0,80,0,81,0,0,5,35,38,38,35,34,7,6,35,34,38,
+53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,53,38,0,39,39,54,55,38,53,52,
+54,51,50,23,7,38,35,34,6,21,20,22,23,54,55,53,33,21,33,17,54,55,23,6,21,20,
+23,7,38,38,53,52,55,6,7,3,6,4,7,22,4,23,38,53,19,7,4,139,153,25,109,91,53,
+110,110,63,165,190,19,157,16,97,107,52,90,90,53,175,88,100,254,131,234,80,
+144,135,130,142,125,60,49,13,32,41,62,66,51,54,186,193,2,213,253,200,174,
+171,119,79,55,144,29,34,39,114,158,157,168,254,210,134,189,1,80,86,7,86,100,
+240,91,87,17,18,162,156,68,67,19,58,52,90,87,18,17,121,36,191,1,12,39,197,
+85,67,96,130,93,122,10,147,4,50,42,43,60,27,85,61,215,146,254,157,73,55,119,
+134,196,154,159,33,85,189,78,159,107,38,70,1,27,58,138,80,43,215,143,83,83,
+251,98,12,0,3,255,236,0,0,7,27,4,250,0,3,0,66,0,67,0,0,3,53,33,21,1,35,38,
+38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,52,55,
+6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,23,21,54,55,23,6,21,20,23,
+7,38,38,53,52,55,6,7,3,20,7,47,253,200,153,22,98,83,63,117,118,74,215,214,
+20,155,18,129,148,59,106,105,64,161,71,5,81,166,109,128,149,47,162,38,58,
+53,90,143,64,206,174,171,119,79,55,144,29,34,39,114,158,157,4,104,146,146,
+251,152,91,87,17,18,196,197,87,99,23,65,91,124,125,18,17,111,1,194,73,51,
+113,98,129,113,83,89,49,60,55,51,53,130,115,44,155,73,55,119,134,196,154,
+159,33,85,189,78,159,107,38,70,2,146,0,0,2,255,238,255,167,6,224,5,129,0,
+86,0,87,0,0,3,54,51,50,22,23,54,54,51,50,22,23,38,53,53,51,23,33,21,33,17,
+54,55,23,6,21,20,23,7,38,38,53,52,55,6,7,17,35,38,35,34,7,6,35,34,38,53,52,
+55,23,6,21,20,22,51,50,55,54,51,50,23,17,38,38,35,34,6,21,20,22,23,7,38,38,
+39,6,6,35,39,54,54,53,52,38,35,34,7,37,18,94,82,104,162,39,35,148,93,86,155,
+59,4,108,48,2,57,253,200,174,171,119,79,55,144,29,34,39,114,158,153,49,168,
+60,115,115,64,151,186,19,157,16,82,99,53,101,102,46,182,79,62,145,84,84,95,
+142,138,14,139,181,41,40,186,133,13,133,140,112,104,76,81,3,145,4,245,19,
+94,86,87,93,77,76,36,73,165,135,146,254,157,73,55,119,134,196,154,159,33,
+85,189,78,159,107,38,70,253,63,178,17,18,166,155,74,58,19,52,57,92,86,18,
+17,111,3,37,104,104,92,82,88,97,7,158,8,100,92,95,105,158,2,101,83,86,94,
+22,158,0,3,255,236,255,167,7,46,4,250,0,70,0,79,0,80,0,0,19,30,2,51,50,54,
+55,33,53,33,21,33,22,21,20,6,7,54,55,23,6,21,20,23,7,38,38,53,52,55,6,7,17,
+35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,17,
+6,35,34,38,39,6,6,35,34,38,39,1,33,22,22,51,50,54,53,52,3,201,35,57,50,38,
+87,82,4,253,194,7,66,253,193,69,11,10,139,165,119,79,55,144,29,34,39,114,
+158,153,28,119,97,55,123,122,75,172,202,19,157,16,105,111,64,101,100,58,202,
+88,42,48,124,189,57,36,126,88,101,150,77,3,236,254,130,41,165,123,72,78,63,
+3,160,61,67,27,179,176,146,146,107,116,34,60,27,65,52,119,134,196,154,159,
+33,85,189,78,159,107,38,70,253,63,93,85,17,18,162,156,68,67,19,58,52,90,87,
+18,17,111,1,242,9,125,121,120,126,116,123,1,19,184,184,76,69,109,1,4,0,0,
+3,255,235,255,126,5,203,4,250,0,57,0,58,0,59,0,0,1,38,39,35,53,33,21,33,22,
+23,22,22,23,54,55,23,6,21,20,23,7,38,38,53,52,55,6,7,6,6,7,22,4,23,7,36,36,
+37,55,22,22,51,50,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,19,3,1,86,42,
+110,211,5,224,251,230,50,22,158,224,43,181,149,119,79,55,144,29,34,39,93,
+145,12,199,179,136,1,18,137,95,254,245,254,130,254,245,29,70,134,95,182,184,
+154,129,103,101,13,149,23,100,235,5,3,237,87,36,146,146,43,61,1,129,116,75,
+48,119,134,196,154,159,33,85,189,78,159,107,31,62,141,172,24,50,157,108,109,
+203,181,61,142,22,17,124,114,103,121,59,63,34,32,30,67,58,78,113,1,40,252,
+22,0,0,3,253,135,5,84,0,88,7,86,0,10,0,24,0,25,0,0,1,34,38,53,52,54,51,50,
+21,20,6,37,6,6,35,34,38,39,55,22,22,51,50,54,55,1,254,240,45,46,46,42,92,
+49,1,64,17,181,157,159,189,18,142,11,108,98,99,110,10,254,216,6,167,51,42,
+36,46,88,39,48,150,181,179,184,175,18,127,114,121,121,254,5,0,5,252,191,4,
+250,1,98,7,86,0,10,0,14,0,28,0,29,0,30,0,0,1,34,38,53,52,54,51,50,21,20,6,
+23,1,23,1,19,6,6,35,34,38,39,55,22,22,51,50,54,55,3,1,254,40,45,46,46,42,
+92,49,39,2,156,79,253,112,190,17,181,157,159,189,18,142,11,108,98,99,110,
+10,96,2,78,6,167,51,42,36,46,88,39,48,255,1,174,116,254,72,2,19,181,179,184,
+175,18,127,114,121,121,253,171,1,218,255,255,251,214,0,0,2,196,7,86,2,34,
+0,55,0,0,0,3,1,228,2,108,0,0,255,255,251,214,0,0,2,54,7,86,2,34,0,55,0,0,
+0,3,0,127,1,34,0,0,255,255,251,214,0,0,3,253,7,86,2,34,0,55,0,0,0,35,0,4,
+3,165,0,0,0,3,0,127,1,34,0,0,0,1,252,82,0,0,2,54,7,86,0,27,0,0,33,35,17,35,
+53,51,38,36,33,34,6,21,20,22,51,21,33,38,53,52,54,51,32,0,19,51,21,35,1,95,
+157,216,216,15,254,172,254,203,138,177,50,68,254,249,12,250,221,1,136,1,161,
+19,209,215,4,104,146,230,232,63,52,29,29,14,27,43,119,140,254,208,254,212,
+146,0,255,255,252,82,0,0,2,196,7,86,2,34,1,233,0,0,0,3,1,228,2,108,0,0,255,
+255,252,82,0,0,2,54,7,86,2,34,1,233,0,0,0,3,0,127,1,34,0,0,255,255,252,82,
+0,0,3,253,7,86,2,34,1,233,0,0,0,35,0,4,3,165,0,0,0,3,0,127,1,34,0,0,0,1,252,
+98,0,0,2,54,7,86,0,37,0,0,33,35,17,35,53,51,38,36,33,34,6,21,20,22,51,51,
+50,22,22,21,35,46,2,35,35,34,38,53,52,54,51,32,0,19,51,21,35,1,95,157,216,
+216,17,254,168,254,205,143,150,65,93,69,144,138,63,137,2,39,71,67,72,146,
+197,225,215,1,143,1,168,20,209,215,4,104,146,231,231,50,65,28,30,70,125,109,
+68,66,24,100,99,125,137,254,207,254,213,146,255,255,252,98,0,0,2,206,7,86,
+2,34,1,237,0,0,0,3,1,228,2,118,0,0,255,255,252,98,0,0,2,54,7,86,2,34,1,237,
+0,0,0,3,0,127,1,44,0,0,255,255,252,98,0,0,4,7,7,86,2,34,1,237,0,0,0,35,0,
+4,3,175,0,0,0,3,0,127,1,44,0,0,0,2,251,214,0,0,2,54,7,86,0,38,0,48,0,0,1,
+55,39,38,38,53,52,36,33,50,23,55,23,22,18,23,51,21,35,17,35,17,35,53,51,38,
+38,39,5,22,22,21,35,46,2,35,35,7,19,37,38,35,34,6,21,20,22,51,252,8,63,18,
+44,51,1,20,1,6,203,158,66,45,192,207,14,209,215,157,216,216,12,179,166,254,
+232,118,120,137,2,39,71,67,182,221,187,1,92,63,65,187,201,65,93,5,148,30,
+9,22,75,52,124,138,35,35,66,66,254,243,203,146,251,152,4,104,146,159,209,
+50,138,16,133,146,68,66,24,119,1,9,168,5,60,55,28,30,255,255,251,214,0,0,
+2,206,7,86,2,34,1,241,0,0,0,3,1,228,2,118,0,0,255,255,253,22,0,0,2,121,7,
+86,2,34,0,66,0,0,0,3,1,228,2,33,0,0,255,255,252,166,0,0,2,121,7,86,2,34,0,
+66,0,0,0,35,1,228,2,33,0,0,0,3,0,127,254,173,0,0,0,6,252,161,253,125,0,184,
+0,0,0,20,0,31,0,32,0,33,0,34,0,35,0,0,19,38,39,6,6,35,34,38,53,52,54,51,50,
+23,53,51,21,20,7,22,23,37,38,35,34,6,21,20,22,51,50,54,19,21,35,1,92,190,
+134,45,176,130,111,169,162,141,103,106,157,5,137,246,253,216,104,97,71,76,
+70,63,83,107,42,157,2,168,253,125,159,79,114,114,126,110,106,124,34,129,112,
+46,36,72,195,195,39,55,47,51,54,84,1,166,88,254,89,0,0,5,253,140,253,125,
+1,80,0,0,0,27,0,28,0,29,0,30,0,31,0,0,19,38,39,6,6,35,34,38,53,52,54,55,53,
+51,21,7,38,35,34,21,20,22,51,50,54,55,22,23,1,1,37,1,249,152,141,64,158,94,
+111,157,153,124,157,66,29,47,143,62,53,83,138,68,219,192,253,81,2,168,254,
+108,254,79,253,125,111,70,59,60,116,105,85,111,3,89,130,95,5,83,37,42,78,
+80,105,134,2,23,254,1,83,1,84,0,0,3,253,43,253,125,0,74,0,0,0,12,0,13,0,14,
+0,0,5,54,37,23,6,7,22,4,23,7,38,36,39,1,21,253,43,244,1,12,53,252,112,149,
+1,34,159,74,149,254,203,197,1,48,251,119,95,134,80,53,19,101,102,117,96,110,
+22,1,159,88,0,5,254,133,253,125,0,232,0,0,0,3,0,4,0,5,0,6,0,7,0,0,5,1,7,1,
+55,21,1,39,254,240,1,248,89,253,246,28,1,187,249,123,254,108,110,1,127,254,
+88,253,213,136,0,6,252,161,252,218,0,184,0,0,0,20,0,31,0,32,0,33,0,34,0,35,
+0,0,19,38,39,6,6,35,34,38,53,52,54,51,50,23,53,51,21,20,7,22,23,37,38,35,
+34,6,21,20,22,51,50,54,19,7,1,5,92,190,134,45,176,130,111,169,162,141,103,
+106,157,5,137,246,253,216,104,97,71,76,70,63,83,107,42,200,2,211,254,232,
+252,230,159,79,114,114,126,110,106,124,34,129,112,46,36,72,195,195,39,55,
+47,51,54,84,2,61,239,254,89,144,0,6,253,140,252,218,1,80,0,0,0,27,0,28,0,
+29,0,30,0,31,0,32,0,0,19,38,39,6,6,35,34,38,53,52,54,55,53,51,21,7,38,35,
+34,21,20,22,51,50,54,55,22,23,1,21,19,37,37,249,152,141,64,158,94,111,157,
+153,124,157,66,29,47,143,62,53,83,138,68,219,192,253,81,243,1,184,254,112,
+252,230,111,70,59,60,116,105,85,111,3,89,130,95,5,83,37,42,78,83,105,137,
+2,174,239,253,201,144,83,0,0,4,253,43,252,218,0,74,0,0,0,12,0,13,0,14,0,15,
+0,0,1,54,37,23,6,7,22,4,23,7,38,36,39,1,53,3,253,43,244,1,12,53,252,112,149,
+1,34,159,74,149,254,203,197,1,48,17,254,110,119,95,134,80,53,19,101,102,117,
+96,110,22,1,71,239,252,218,0,0,6,254,133,252,218,0,232,0,0,0,3,0,4,0,5,0,
+6,0,7,0,8,0,0,1,1,7,1,55,53,19,37,5,254,240,1,248,89,253,246,28,133,1,184,
+254,220,254,238,254,108,110,1,127,166,239,252,218,144,132,0,0,5,252,161,252,
+218,0,184,0,0,0,20,0,31,0,32,0,33,0,34,0,0,19,38,39,6,6,35,34,38,53,52,54,
+51,50,23,53,51,21,20,7,22,23,37,38,35,34,6,21,20,22,51,50,54,19,7,1,92,190,
+134,45,176,130,111,169,162,141,103,106,157,5,137,246,253,216,104,97,71,76,
+70,63,83,107,42,217,2,228,252,218,159,79,114,114,126,110,106,124,34,45,28,
+46,36,72,195,195,39,55,47,51,54,84,2,73,251,254,89,0,5,253,140,252,218,1,
+80,0,0,0,27,0,28,0,29,0,30,0,31,0,0,19,38,39,6,6,35,34,38,53,52,54,55,53,
+51,21,7,38,35,34,21,20,22,51,50,54,55,22,23,1,7,1,5,249,152,141,64,158,94,
+111,157,153,124,157,66,29,47,143,62,53,83,138,68,219,192,253,81,137,1,157,
+1,148,252,218,111,70,59,60,116,105,85,111,3,16,93,59,5,83,37,42,78,80,105,
+134,2,186,251,254,172,83,0,0,3,253,26,252,218,255,225,0,0,0,10,0,11,0,12,
+0,0,1,54,37,23,6,7,4,23,7,38,37,1,7,253,26,172,1,55,58,237,107,1,33,225,63,
+251,254,185,1,65,217,254,48,86,119,128,77,54,37,134,117,144,34,2,116,251,
+0,4,254,128,252,218,0,233,0,0,0,3,0,4,0,5,0,6,0,0,1,1,7,1,19,5,1,254,205,
+2,28,66,253,217,33,1,7,1,15,254,111,254,232,125,1,4,2,34,251,254,87,0,0,3,
+255,235,255,167,5,174,4,250,0,70,0,71,0,72,0,0,1,20,22,51,50,54,55,55,22,
+21,20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,22,23,53,52,55,6,6,35,32,0,3,55,18,18,51,50,54,53,52,39,6,6,35,34,
+38,38,53,53,33,53,33,21,33,55,1,2,224,38,26,53,110,75,117,125,26,25,153,61,
+110,77,47,115,115,70,176,211,24,157,21,110,119,57,101,100,59,75,131,66,3,
+52,121,70,254,254,254,177,99,151,81,255,200,139,159,40,72,152,81,70,92,39,
+253,168,5,195,253,50,21,1,59,3,100,52,33,93,103,19,173,169,53,96,42,253,214,
+75,53,17,18,157,150,74,77,19,63,61,84,84,18,17,56,63,135,64,63,25,24,1,92,
+1,88,42,254,213,254,228,120,108,88,73,91,91,63,97,83,247,146,146,146,251,
+6,0,0,3,255,235,255,167,5,134,4,250,0,63,0,64,0,65,0,0,1,39,54,51,50,22,21,
+20,6,7,17,35,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,
+51,50,22,23,53,52,55,6,6,35,34,38,38,53,17,33,53,33,21,33,17,20,22,22,51,
+50,54,53,52,35,34,3,1,3,90,21,79,78,117,127,25,24,153,61,110,77,44,109,109,
+66,168,198,24,157,21,101,111,54,93,92,55,75,131,66,3,73,160,87,97,119,55,
+254,47,5,155,252,211,17,54,57,132,217,118,58,189,1,63,3,41,139,20,116,109,
+43,90,46,253,115,75,53,17,18,186,176,87,91,19,82,77,107,108,18,17,56,63,187,
+64,72,55,55,66,111,114,2,45,146,146,253,221,57,65,38,195,108,96,1,198,251,
+6,0,4,252,161,253,213,0,184,0,106,0,23,0,34,0,35,0,36,0,0,19,38,39,6,6,35,
+34,38,38,53,52,54,51,50,23,54,53,53,51,21,20,7,22,23,37,38,35,34,6,21,20,
+22,51,50,54,19,1,92,203,130,42,173,131,69,134,73,162,141,106,101,2,147,6,
+146,248,253,212,98,99,71,76,70,63,82,105,45,2,11,253,213,169,74,116,117,59,
+106,71,106,124,33,47,54,117,167,71,41,73,199,196,38,55,47,51,54,85,1,77,254,
+89,0,0,4,253,140,253,213,1,80,0,106,0,27,0,28,0,29,0,30,0,0,19,38,39,6,6,
+35,34,38,53,52,54,55,53,51,21,7,38,35,34,21,20,22,51,50,54,55,22,23,1,1,37,
+249,152,141,64,158,94,111,157,153,124,147,56,29,47,143,62,53,83,138,68,219,
+192,253,81,2,168,254,114,253,213,111,70,59,60,116,105,85,111,3,179,233,82,
+5,83,37,42,78,80,105,134,1,191,254,89,83,0,4,252,161,253,213,0,184,0,166,
+0,23,0,34,0,35,0,36,0,0,19,38,39,6,6,35,34,38,38,53,52,54,51,50,23,54,53,
+53,51,21,20,7,22,23,37,38,35,34,6,21,20,22,51,50,54,19,1,92,203,130,42,173,
+131,69,134,73,162,141,106,101,2,147,6,146,248,253,212,98,99,71,76,70,63,82,
+105,45,2,11,253,213,169,74,116,117,59,106,71,106,124,33,47,54,177,227,71,
+41,73,199,196,38,55,47,51,54,85,1,77,254,89,0,0,4,253,140,253,213,1,80,0,
+166,0,27,0,28,0,29,0,30,0,0,19,38,39,6,6,35,34,38,53,52,54,55,53,51,17,7,
+38,35,34,21,20,22,51,50,54,55,22,23,1,1,37,249,152,141,64,158,94,111,157,
+153,124,147,56,29,47,143,62,53,83,138,68,219,192,253,81,2,171,254,112,253,
+213,111,70,59,60,116,105,85,111,3,239,254,219,82,5,83,37,42,78,80,105,134,
+1,191,254,89,83,0,0,2,1,43,255,227,2,41,5,182,0,3,0,15,0,0,1,35,3,51,3,50,
+22,21,20,6,35,34,38,53,52,54,1,232,121,51,223,113,61,66,67,60,60,67,66,1,
+158,4,24,251,68,71,68,67,73,74,66,67,72,0,0,4,0,235,3,197,3,54,7,86,0,3,0,
+7,0,8,0,9,0,0,1,3,35,3,33,3,35,3,7,19,1,206,51,125,51,2,75,51,124,51,86,46,
+5,213,253,240,2,16,253,240,2,16,219,2,92,0,0,2,0,70,0,0,4,243,5,15,0,27,0,
+31,0,0,1,3,33,21,33,3,35,19,33,3,35,19,35,53,33,19,33,53,33,19,51,3,33,19,
+51,3,33,21,1,33,19,33,3,215,59,1,16,254,213,69,144,71,254,227,70,141,66,255,
+1,25,62,254,243,1,37,68,144,67,1,31,69,141,69,1,1,252,252,1,30,60,254,227,
+3,39,254,201,135,254,151,1,105,254,151,1,105,135,1,55,134,1,98,254,158,1,
+98,254,158,134,254,201,1,55,0,5,0,117,255,236,6,42,5,14,0,10,0,20,0,24,0,
+35,0,45,0,0,1,34,38,53,16,33,50,22,21,20,6,39,50,53,52,35,34,6,21,20,22,1,
+1,35,1,19,34,38,53,16,33,50,22,21,20,6,39,50,53,52,35,34,6,21,20,22,1,157,
+142,154,1,40,145,156,151,150,153,153,78,70,70,3,221,252,235,160,3,23,112,
+143,153,1,40,146,154,153,147,153,153,78,70,70,2,42,191,180,1,113,190,179,
+184,187,131,240,240,120,120,120,120,2,77,251,6,4,250,250,242,194,177,1,113,
+190,179,187,184,132,239,240,119,121,120,119,0,3,0,235,3,197,1,206,7,86,0,
+3,0,4,0,5,0,0,1,3,35,3,23,3,1,206,51,125,51,152,7,5,213,253,240,2,16,219,
+2,92,0,4,0,140,253,213,2,179,7,86,0,12,0,13,0,14,0,15,0,0,1,51,0,17,16,18,
+23,35,38,2,17,16,18,23,19,3,1,180,166,254,225,146,143,168,143,153,153,213,
+185,191,6,167,254,56,253,210,254,233,253,241,221,197,2,18,1,46,1,48,2,3,236,
+2,92,246,127,0,0,4,0,120,253,213,2,72,7,86,0,12,0,13,0,14,0,15,0,0,1,35,0,
+17,16,2,39,51,22,18,17,16,2,3,19,19,1,32,166,1,31,146,143,168,143,153,153,
+246,6,129,254,174,1,200,2,46,1,23,2,15,221,197,253,238,254,210,254,208,253,
+253,7,231,253,164,248,219,0,3,0,150,2,88,4,88,7,86,0,14,0,15,0,16,0,0,1,3,
+37,23,5,19,7,3,3,39,19,37,55,5,11,2,2,220,43,1,141,26,254,134,245,178,176,
+158,184,242,254,137,29,1,135,43,73,25,5,245,254,119,111,193,28,254,186,96,
+1,102,254,154,96,1,70,28,193,111,1,137,1,97,253,164,0,2,0,102,0,199,4,2,4,
+250,0,11,0,12,0,0,1,33,53,33,17,51,17,33,21,33,17,35,3,1,233,254,125,1,131,
+150,1,131,254,125,150,169,2,73,150,1,132,254,124,150,254,126,4,51,0,1,0,63,
+254,248,1,121,0,238,0,6,0,0,37,23,6,3,35,18,55,1,106,15,51,125,138,67,34,
+238,23,197,254,230,1,23,223,0,0,2,0,100,2,12,2,84,4,250,0,3,0,4,0,0,19,53,
+33,21,1,100,1,240,254,141,2,12,168,168,2,238,0,1,0,147,255,227,1,145,0,250,
+0,11,0,0,37,50,22,21,20,6,35,34,38,53,52,54,1,18,61,66,67,60,60,67,66,250,
+71,68,67,73,74,66,67,72,0,4,0,86,253,213,3,25,7,86,0,3,0,4,0,5,0,6,0,0,1,
+1,35,1,3,19,3,3,25,253,231,170,2,27,193,49,197,6,169,248,4,7,252,254,81,2,
+92,246,127,0,0,2,0,98,255,236,4,8,5,205,0,11,0,23,0,0,5,34,2,17,16,18,51,
+50,18,17,16,2,39,50,18,17,16,2,35,34,2,17,16,18,2,51,229,236,229,236,232,
+237,232,237,147,138,138,147,148,132,133,20,1,131,1,110,1,126,1,114,254,125,
+254,147,254,128,254,143,155,1,25,1,61,1,59,1,25,254,230,254,198,254,197,254,
+229,0,0,1,0,178,0,0,2,199,5,182,0,10,0,0,33,35,17,52,55,6,7,7,39,1,51,2,199,
+176,8,39,82,148,96,1,127,150,3,145,123,238,43,70,121,123,1,43,0,1,0,96,0,
+0,3,240,5,203,0,28,0,0,33,33,53,1,62,4,53,52,38,35,34,6,7,39,54,51,50,22,
+21,20,6,6,7,1,21,33,3,240,252,112,1,94,118,86,64,36,16,128,108,95,153,69,
+102,191,230,194,224,72,128,150,254,231,2,177,156,1,125,128,102,102,89,82,
+45,114,130,77,60,119,172,212,179,96,183,178,162,254,213,8,0,1,0,82,255,236,
+3,238,5,203,0,40,0,0,1,21,22,22,21,20,4,33,34,39,53,22,22,51,50,54,53,52,
+38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,2,133,177,
+184,254,236,254,251,242,145,87,203,93,173,181,192,189,133,133,160,176,136,
+114,107,163,74,92,89,225,122,206,231,164,3,2,6,22,181,145,203,233,79,170,
+46,50,144,145,127,131,151,152,125,102,119,67,54,125,72,78,198,165,138,185,
+0,2,0,23,0,0,4,63,5,190,0,10,0,20,0,0,1,35,17,35,17,33,53,1,51,17,51,33,17,
+52,55,55,35,6,6,7,1,4,63,213,176,253,93,2,151,188,213,254,123,10,3,9,17,54,
+19,254,101,1,72,254,184,1,72,159,3,215,252,48,1,100,153,194,85,49,103,28,
+253,160,0,1,0,131,255,236,3,246,5,182,0,28,0,0,55,53,22,22,51,50,54,53,52,
+38,35,34,7,39,19,33,21,33,3,54,51,50,4,21,20,4,35,34,38,131,65,208,88,167,
+168,176,168,89,142,90,55,2,178,253,236,39,107,102,210,1,3,254,236,251,103,
+188,59,172,45,51,162,152,143,151,26,57,2,176,166,254,93,20,229,199,234,255,
+40,0,0,2,0,113,255,236,4,10,5,203,0,23,0,37,0,0,1,21,38,35,34,2,3,51,54,51,
+50,22,21,20,2,35,34,38,2,53,16,0,33,50,19,52,38,35,34,6,6,21,20,22,22,51,
+50,54,3,156,71,95,224,225,10,12,95,212,195,221,241,203,133,215,129,1,64,1,
+63,104,2,137,127,86,141,72,63,136,94,126,144,5,184,155,24,254,230,254,206,
+170,238,206,228,254,249,136,1,38,215,1,180,1,166,252,12,145,156,80,123,63,
+88,170,115,172,0,1,0,90,0,0,4,6,5,182,0,6,0,0,33,1,33,53,33,21,1,1,25,2,51,
+253,14,3,172,253,213,5,16,166,145,250,219,0,0,3,0,106,255,236,4,0,5,205,0,
+22,0,34,0,47,0,0,1,22,22,21,20,6,35,34,38,53,16,37,38,38,53,52,54,51,50,22,
+21,20,6,37,54,54,53,52,38,35,34,6,21,20,22,23,6,6,21,20,22,51,50,54,53,52,
+38,39,2,203,162,147,252,207,217,242,1,27,126,109,233,178,182,230,126,254,
+228,126,106,126,110,106,125,99,108,126,128,143,133,136,149,126,151,3,6,86,
+191,116,181,220,207,186,1,1,136,79,182,108,161,189,189,163,114,177,6,57,132,
+89,101,106,106,101,90,125,215,60,155,110,116,124,131,117,90,139,74,0,0,2,
+0,106,255,236,4,4,5,203,0,24,0,38,0,0,23,53,22,51,50,54,54,55,35,6,35,34,
+38,53,52,18,51,50,0,17,16,0,33,34,38,19,20,22,51,50,54,54,53,52,38,38,35,
+34,6,217,67,99,167,198,85,9,13,95,212,195,221,239,206,220,1,1,254,192,254,
+193,51,103,48,137,127,88,140,71,65,135,93,128,142,2,156,25,149,246,193,170,
+238,206,226,1,10,254,170,254,209,254,75,254,91,12,3,231,145,156,82,122,62,
+90,172,111,174,0,0,3,0,175,255,227,1,173,4,250,0,11,0,23,0,24,0,0,1,50,22,
+21,20,6,35,34,38,53,52,54,19,50,22,21,20,6,35,34,38,53,52,54,19,1,46,63,64,
+68,59,60,67,63,64,61,66,67,60,60,67,66,77,4,102,72,67,66,73,73,66,67,72,252,
+148,71,68,67,73,74,66,67,72,4,0,0,0,3,0,91,254,248,1,173,4,250,0,11,0,18,
+0,19,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,23,6,3,35,18,55,19,1,46,63,
+64,68,59,60,67,63,152,15,51,125,138,67,34,139,4,102,72,67,66,73,73,66,67,
+72,252,136,23,197,254,230,1,23,223,4,12,0,2,0,144,0,157,4,44,4,250,0,6,0,
+7,0,0,37,1,53,1,21,9,2,4,44,252,100,3,156,253,33,2,223,254,7,157,1,168,102,
+1,225,160,254,148,254,190,3,188,0,3,0,144,1,125,4,44,4,150,0,3,0,7,0,8,0,
+0,19,53,33,21,1,53,33,21,1,144,3,156,252,100,3,156,253,216,3,23,149,149,254,
+102,150,150,3,25,0,2,0,144,0,157,4,44,4,250,0,6,0,7,0,0,19,1,1,53,1,21,1,
+1,144,2,224,253,32,3,156,252,100,1,185,1,62,1,66,1,108,160,254,31,102,254,
+88,4,93,0,0,2,0,146,255,227,3,146,5,203,0,27,0,39,0,0,1,53,52,54,55,62,2,
+53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,7,6,6,21,21,7,50,22,21,20,6,35,
+34,38,53,52,54,1,134,79,91,81,67,32,119,109,83,150,70,63,199,167,187,215,
+79,136,109,61,60,61,66,67,60,60,67,66,1,158,37,129,143,76,69,82,94,64,97,
+118,52,34,145,101,200,173,109,166,118,94,105,86,18,164,71,68,67,73,74,66,
+67,72,0,4,0,221,253,213,2,106,7,86,0,7,0,8,0,9,0,10,0,0,1,33,17,33,21,35,
+17,51,11,2,2,106,254,115,1,141,232,232,145,8,152,254,173,7,251,143,249,35,
+5,190,2,92,246,127,0,4,0,86,253,213,3,25,7,86,0,3,0,4,0,5,0,6,0,0,19,1,35,
+1,1,3,3,254,2,27,168,253,229,1,210,124,37,6,167,248,6,7,250,254,83,2,92,246,
+127,0,0,4,0,110,253,213,1,252,7,86,0,7,0,8,0,9,0,10,0,0,23,51,17,35,53,33,
+17,33,27,2,110,231,231,1,142,254,114,90,80,7,196,6,220,143,248,6,6,77,2,92,
+246,127,0,1,0,102,2,37,4,86,5,193,0,6,0,0,19,1,51,1,35,1,1,102,1,203,102,
+1,191,161,254,175,254,163,2,37,3,156,252,100,2,223,253,33,0,1,255,252,254,
+188,3,78,255,72,0,3,0,0,1,33,53,33,3,78,252,174,3,82,254,188,140,0,0,4,0,
+90,253,213,2,179,7,86,0,29,0,30,0,31,0,32,0,0,5,20,22,23,21,38,38,53,17,52,
+38,35,53,50,54,53,17,52,54,55,21,6,6,21,17,20,7,21,22,21,1,19,19,1,251,78,
+106,172,178,129,122,122,129,178,172,106,78,216,216,254,162,37,86,37,78,75,
+2,147,3,147,138,1,216,101,84,152,84,101,1,217,136,148,3,146,2,75,78,254,41,
+203,41,11,41,202,3,73,2,92,246,127,0,4,0,240,253,213,2,114,7,86,0,3,0,4,0,
+5,0,6,0,0,1,51,17,35,3,19,3,1,223,147,147,239,74,20,6,167,248,6,6,77,2,92,
+246,127,0,4,0,110,253,213,2,199,7,86,0,29,0,30,0,31,0,32,0,0,1,52,55,53,38,
+53,17,52,38,39,53,22,22,21,17,20,22,51,21,34,6,21,17,20,6,7,53,54,54,53,1,
+19,3,1,37,217,217,77,106,173,177,123,128,123,128,178,172,106,77,1,72,11,107,
+1,177,202,41,11,41,203,1,215,79,74,2,146,3,148,136,254,39,98,87,152,84,101,
+254,40,137,148,3,147,2,74,79,5,31,2,92,246,127,0,0,2,0,144,2,13,4,44,4,250,
+0,23,0,24,0,0,19,53,54,51,50,22,23,22,22,51,50,54,55,21,6,35,34,38,39,38,
+38,35,34,6,1,144,100,148,54,91,103,80,76,45,51,122,54,99,149,59,96,93,81,
+73,46,50,119,1,150,2,13,162,108,19,44,34,22,65,56,162,108,23,40,35,21,63,
+2,179,255,255,0,100,2,12,2,84,4,250,2,2,2,18,0,0,0,2,0,82,2,23,3,174,4,250,
+0,3,0,4,0,0,19,53,33,21,1,82,3,92,254,150,2,23,168,168,2,227,0,2,0,82,2,23,
+7,174,4,250,0,3,0,4,0,0,19,53,33,21,1,82,7,92,250,90,2,23,168,168,2,227,0,
+3,0,168,3,224,1,225,7,86,0,6,0,7,0,8,0,0,19,39,54,19,51,6,7,19,3,182,14,54,
+122,137,62,38,41,54,3,224,22,208,1,15,255,246,3,118,253,164,0,3,0,166,3,224,
+1,223,7,86,0,6,0,7,0,8,0,0,1,23,6,3,35,18,55,19,19,1,209,14,50,126,137,70,
+30,38,45,5,213,22,197,254,230,1,47,198,1,129,253,164,0,4,0,169,3,224,3,99,
+7,86,0,6,0,13,0,14,0,15,0,0,1,39,54,19,51,6,7,33,39,54,19,51,6,7,19,3,2,56,
+14,54,122,137,62,38,253,184,14,54,122,137,62,38,175,6,3,224,22,208,1,15,255,
+246,22,208,1,15,255,246,3,118,253,164,0,4,0,166,3,224,3,96,7,86,0,6,0,13,
+0,14,0,15,0,0,1,23,6,3,35,18,55,33,23,6,3,35,18,55,3,3,1,209,14,50,126,137,
+70,30,2,72,14,50,126,137,70,30,112,31,5,213,22,197,254,230,1,47,198,22,197,
+254,230,1,47,198,1,129,253,164,0,3,0,147,255,227,5,219,0,250,0,11,0,23,0,
+35,0,0,37,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,
+54,33,50,22,21,20,6,35,34,38,53,52,54,1,18,61,66,67,60,60,67,66,2,98,61,66,
+67,60,60,67,66,2,98,61,66,67,60,54,73,67,250,71,68,67,73,74,66,67,72,71,68,
+67,73,74,66,67,72,71,68,67,73,66,74,70,69,0,2,0,183,0,236,4,7,4,250,0,11,
+0,12,0,0,1,1,55,1,1,23,1,1,7,1,1,39,1,1,245,254,194,105,1,61,1,66,104,254,
+191,1,63,102,254,190,254,195,103,1,138,2,146,1,63,105,254,194,1,62,103,254,
+191,254,192,102,1,61,254,197,103,3,165,0,0,4,0,144,0,195,4,44,4,250,0,11,
+0,15,0,27,0,28,0,0,1,50,22,21,20,6,35,34,38,53,52,54,1,53,33,21,5,50,22,21,
+20,6,35,34,38,53,52,54,17,2,93,55,60,62,53,54,60,59,254,106,3,156,254,49,
+55,60,62,53,54,60,59,4,119,64,61,60,65,67,58,61,64,253,210,150,150,140,64,
+61,60,65,67,58,61,64,3,61,0,2,0,144,2,73,4,44,4,250,0,3,0,4,0,0,19,53,33,
+21,1,144,3,156,253,239,2,73,150,150,2,177,0,1,0,147,0,0,3,243,4,250,0,28,
+0,0,1,6,6,7,1,35,1,55,51,50,54,54,55,33,53,33,46,2,35,35,53,33,21,33,22,23,
+33,21,2,206,14,181,167,1,177,210,254,80,20,92,104,111,66,11,254,108,1,146,
+11,64,99,92,136,3,96,254,128,71,19,1,38,3,56,133,158,25,254,4,1,249,146,35,
+79,59,146,53,75,30,146,146,52,106,146,0,0,1,1,142,0,0,2,51,4,250,0,3,0,0,
+33,17,51,17,1,142,165,4,250,251,6,0,0,2,1,142,0,0,3,245,4,250,0,3,0,7,0,0,
+33,17,51,17,33,17,51,17,3,80,165,253,153,165,4,250,251,6,4,250,251,6,0,1,
+255,202,254,173,0,54,6,77,0,3,0,0,3,17,51,17,54,108,254,173,7,160,248,96,
+0,1,254,213,254,174,1,43,6,77,0,14,0,0,19,23,7,39,17,35,17,7,39,55,39,55,
+23,55,23,74,225,75,170,108,170,75,225,225,75,224,224,75,5,43,220,73,169,249,
+255,6,1,169,73,220,217,73,220,220,74,0,0,8,0,106,0,222,3,170,4,29,0,10,0,
+18,0,26,0,34,0,42,0,50,0,58,0,68,0,0,1,20,6,35,34,53,52,54,51,50,22,5,20,
+35,34,53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,5,20,35,
+34,53,52,51,50,19,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,5,20,6,35,34,
+53,52,51,50,22,2,69,29,31,58,28,30,31,29,254,247,59,59,59,59,2,18,59,59,59,
+59,92,60,59,59,60,253,54,59,59,59,59,92,59,59,59,59,2,18,59,59,59,59,254,
+247,29,31,58,58,31,29,3,227,30,29,59,30,28,28,132,59,59,59,59,59,59,59,254,
+198,59,59,59,59,59,59,59,254,198,59,59,59,59,59,59,59,161,30,29,59,59,29,
+0,1,252,239,254,137,253,227,255,122,0,11,0,0,1,34,38,53,52,54,51,50,22,21,
+20,6,253,107,50,74,71,53,50,70,70,254,137,68,52,51,70,70,51,52,68,0,0,0,0,
+0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,
+9,0,2,0,14,0,128,0,3,0,1,4,9,0,3,0,72,0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,
+0,1,4,9,0,5,0,30,0,214,0,3,0,1,4,9,0,6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,
+18,0,3,0,1,4,9,0,8,0,42,1,86,0,3,0,1,4,9,0,9,0,40,1,128,0,3,0,1,4,9,0,10,
+0,96,1,168,0,3,0,1,4,9,0,11,0,62,2,8,0,3,0,1,4,9,0,12,0,60,2,70,0,3,0,1,4,
+9,0,13,2,150,2,130,0,3,0,1,4,9,0,14,0,52,5,24,0,67,0,111,0,112,0,121,0,114,
+0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,
+0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,
+0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,66,0,
+101,0,110,0,103,0,97,0,108,0,105,0,82,0,101,0,103,0,117,0,108,0,97,0,114,
+0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,
+0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,
+110,0,115,0,32,0,66,0,101,0,110,0,103,0,97,0,108,0,105,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,
+0,116,0,111,0,83,0,97,0,110,0,115,0,66,0,101,0,110,0,103,0,97,0,108,0,105,
+0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,
+100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,
+110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,
+97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,
+0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,
+119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,
+0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,
+0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,
+0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,
+0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,
+0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,
+0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,
+0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,
+0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,
+0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,
+0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,
+0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,
+0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,
+76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,
+0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,
+0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,
+0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,
+0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,
+0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,
+0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,
+0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,
+0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,
+0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,
+0,2,255,255,0,3,0,1,0,0,0,12,0,166,0,0,0,0,0,2,0,25,0,4,0,4,0,3,0,5,0,50,
+0,1,0,51,0,51,0,3,0,52,0,55,0,1,0,56,0,59,0,3,0,60,0,61,0,1,0,64,0,64,0,3,
+0,65,0,71,0,1,0,72,0,73,0,3,0,84,0,85,0,1,0,96,0,126,0,2,0,127,0,129,0,3,
+0,130,1,189,0,2,1,190,1,191,0,1,1,192,1,227,0,2,1,228,1,229,0,3,1,230,1,232,
+0,2,1,233,1,233,0,1,1,234,1,236,0,2,1,237,1,237,0,1,1,238,1,244,0,2,1,245,
+2,1,0,3,2,2,2,3,0,2,2,4,2,7,0,3,2,61,2,63,0,1,2,82,1,39,3,250,5,48,5,112,
+6,122,4,42,4,152,4,48,5,38,3,254,4,172,4,172,4,52,4,4,6,58,5,44,4,22,4,10,
+4,58,4,10,5,58,4,16,4,152,4,66,4,22,4,72,4,28,4,34,6,174,6,202,6,162,4,38,
+6,182,4,48,6,70,6,74,5,112,6,122,4,232,4,42,4,152,4,48,4,162,4,134,6,94,4,
+172,4,52,5,12,4,58,5,58,4,62,4,152,4,66,6,70,4,72,4,76,4,80,6,44,6,182,4,
+86,6,98,5,48,4,92,4,98,4,226,4,104,4,110,4,116,5,12,6,146,6,150,6,186,6,192,
+4,148,6,154,5,122,5,20,5,48,5,182,5,182,6,62,4,122,5,182,6,126,6,186,5,132,
+6,192,4,128,6,126,5,88,4,152,6,154,4,162,4,134,6,94,5,106,4,138,5,12,6,70,
+6,74,6,122,4,142,4,148,6,74,4,152,6,66,6,70,4,156,4,162,4,166,6,70,4,188,
+6,106,6,126,5,182,5,178,5,254,6,50,6,50,4,172,5,126,4,178,4,184,5,72,5,106,
+4,188,5,8,4,192,4,198,4,204,6,186,4,208,6,16,4,214,4,220,4,226,4,232,4,236,
+5,244,6,146,4,242,4,246,4,252,5,244,5,2,5,8,6,130,6,186,5,12,5,16,6,142,5,
+88,5,20,6,118,6,118,5,26,5,32,5,44,5,38,6,186,5,44,5,48,5,52,6,66,5,58,5,
+62,5,68,5,72,5,216,5,78,5,216,5,84,6,98,5,88,6,146,5,94,5,100,6,86,6,102,
+6,82,5,106,5,112,5,116,6,102,6,150,5,122,5,126,5,132,5,136,5,158,5,238,5,
+140,5,146,6,32,6,4,5,232,5,188,6,192,5,152,6,78,6,22,5,158,5,164,5,170,6,
+22,5,174,6,16,5,178,5,182,5,188,5,194,6,16,5,200,5,206,6,16,5,210,6,16,6,
+98,6,150,5,216,5,222,6,90,5,226,6,106,5,232,5,244,5,238,5,244,5,250,5,254,
+6,50,6,4,6,10,6,82,6,16,6,22,6,28,6,186,6,32,6,38,6,44,6,50,6,54,6,58,6,138,
+6,62,6,66,6,70,6,70,6,70,6,70,6,74,6,74,6,74,6,74,6,78,6,82,6,86,6,90,6,94,
+6,126,6,98,6,134,6,102,6,106,6,110,6,114,6,118,6,122,6,126,6,130,6,134,6,
+138,6,142,6,146,6,150,6,154,6,158,6,174,6,202,6,162,6,182,6,174,6,202,6,166,
+6,170,6,174,6,202,6,178,6,182,6,186,6,192,6,198,6,202,6,198,6,202,0,2,0,70,
+0,4,0,4,0,0,0,8,0,8,0,1,0,14,0,14,0,2,0,17,0,17,0,3,0,19,0,21,0,4,0,23,0,
+36,0,7,0,39,0,40,0,21,0,42,0,42,0,23,0,47,0,47,0,24,0,50,0,50,0,25,0,53,0,
+53,0,26,0,56,0,59,0,27,0,64,0,65,0,31,0,67,0,68,0,33,0,71,0,73,0,35,0,96,
+0,98,0,38,0,100,0,105,0,41,0,108,0,108,0,47,0,110,0,111,0,48,0,114,0,116,
+0,50,0,119,0,119,0,53,0,122,0,122,0,54,0,125,0,127,0,55,0,199,0,201,0,58,
+0,203,0,217,0,61,0,220,0,221,0,76,0,224,0,224,0,78,0,228,0,228,0,79,0,230,
+0,231,0,80,0,234,0,237,0,82,0,239,0,243,0,86,0,245,0,250,0,91,0,253,1,2,0,
+97,1,5,1,6,0,103,1,8,1,9,0,105,1,13,1,13,0,107,1,15,1,15,0,108,1,19,1,20,
+0,109,1,22,1,25,0,111,1,27,1,30,0,115,1,32,1,32,0,119,1,34,1,34,0,120,1,36,
+1,39,0,121,1,41,1,41,0,125,1,44,1,47,0,126,1,50,1,64,0,130,1,66,1,67,0,145,
+1,69,1,75,0,147,1,78,1,81,0,154,1,83,1,85,0,158,1,87,1,93,0,161,1,97,1,104,
+0,168,1,108,1,110,0,176,1,112,1,118,0,179,1,120,1,120,0,186,1,122,1,127,0,
+187,1,129,1,136,0,193,1,138,1,138,0,201,1,140,1,143,0,202,1,145,1,149,0,206,
+1,151,1,151,0,211,1,155,1,159,0,212,1,161,1,167,0,217,1,169,1,169,0,224,1,
+171,1,172,0,225,1,174,1,180,0,227,1,184,1,189,0,234,1,192,1,227,0,240,1,229,
+1,229,1,20,1,246,2,7,1,21,0,1,0,25,0,2,0,42,0,43,0,2,0,2,0,91,0,2,0,34,0,
+35,0,2,0,27,0,28,0,2,0,39,0,40,0,2,0,44,0,45,0,1,0,20,0,1,0,24,0,2,0,11,0,
+42,0,1,0,43,0,2,0,17,0,38,0,1,0,30,0,1,0,27,0,2,0,1,0,49,0,1,0,48,0,1,0,44,
+0,2,0,0,0,78,0,2,0,6,0,80,0,2,0,90,0,91,0,2,0,91,0,92,0,2,0,93,0,94,0,2,0,
+92,0,93,0,2,0,42,0,63,0,2,0,65,0,66,0,2,0,103,0,104,0,1,0,42,0,1,0,38,0,2,
+0,51,0,52,0,1,0,54,0,1,0,45,0,2,0,7,0,63,0,1,0,62,0,2,0,19,0,54,0,2,0,63,
+0,64,0,2,0,99,0,100,0,1,0,76,0,1,0,64,0,2,0,33,0,76,0,2,0,58,0,101,0,1,0,
+94,0,2,0,52,0,134,0,2,0,98,0,99,0,2,0,128,0,129,0,2,0,73,0,74,0,1,0,98,0,
+2,0,130,0,131,0,1,0,119,0,2,0,22,0,81,0,2,0,108,0,109,0,2,0,115,0,116,0,1,
+0,75,0,1,0,91,0,1,0,77,0,2,0,54,0,55,0,2,0,86,0,87,0,2,0,50,0,51,0,2,0,62,
+0,63,0,1,0,50,0,1,0,68,0,2,0,41,0,42,0,1,0,40,0,2,0,52,0,53,0,1,0,69,0,2,
+0,59,0,60,0,2,0,68,0,69,0,1,0,100,0,2,0,56,0,57,0,2,0,49,0,50,0,2,0,26,0,
+59,0,2,0,76,0,77,0,1,0,56,0,2,0,84,0,85,0,1,0,65,0,2,0,77,0,78,0,1,0,74,0,
+1,0,97,0,2,0,43,0,44,0,2,0,57,0,58,0,2,0,6,0,71,0,2,0,81,0,82,0,2,0,22,0,
+82,0,1,0,113,0,1,0,92,0,1,0,93,0,2,0,75,0,76,0,2,0,74,0,75,0,2,0,60,0,61,
+0,2,0,33,0,80,0,1,0,106,0,2,0,101,0,102,0,2,0,70,0,71,0,1,0,84,0,2,0,26,0,
+74,0,2,0,80,0,81,0,2,0,72,0,73,0,2,0,109,0,110,0,1,0,95,0,2,0,66,0,67,0,2,
+0,69,0,70,0,2,0,19,0,63,0,2,0,79,0,80,0,2,0,88,0,89,0,1,0,104,0,2,0,61,0,
+62,0,2,0,0,0,77,0,2,0,83,0,84,0,1,0,66,0,1,0,112,0,1,0,57,0,1,0,71,0,1,0,
+49,0,1,0,39,0,1,0,34,0,1,0,88,0,1,0,79,0,1,0,86,0,1,0,73,0,1,0,63,0,1,0,70,
+0,1,0,90,0,1,0,78,0,1,0,85,0,1,0,105,0,1,0,52,0,1,0,46,0,1,0,83,0,1,0,81,
+0,1,0,72,0,1,0,51,0,1,0,67,0,1,0,87,0,1,0,80,0,1,0,58,0,1,0,29,0,1,0,13,0,
+1,0,14,0,1,0,5,0,1,0,32,0,1,0,11,0,1,0,4,0,2,0,71,0,72,0,2,0,64,0,65,0,1,
+0,35,0,1,0,28,0,1,0,0,0,10,0,58,0,122,0,2,98,101,110,103,0,14,98,110,103,
+50,0,18,0,8,0,0,0,16,0,0,0,0,255,255,0,3,0,0,0,1,0,2,0,0,255,255,0,4,0,0,
+0,1,0,3,0,4,0,5,97,98,118,109,0,32,98,108,119,109,0,38,100,105,115,116,0,
+44,100,105,115,116,0,52,107,101,114,110,0,58,0,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,2,0,2,0,4,0,0,0,1,0,2,0,0,0,1,0,4,0,5,0,12,11,234,19,192,21,0,21,32,0,4,
+0,0,0,1,0,8,0,1,0,12,0,22,0,1,1,214,1,252,0,1,0,3,0,4,0,127,1,229,0,2,0,74,
+0,8,0,8,0,0,0,14,0,14,0,1,0,17,0,17,0,2,0,19,0,21,0,3,0,23,0,28,0,6,0,31,
+0,36,0,12,0,39,0,40,0,18,0,42,0,42,0,20,0,47,0,47,0,21,0,50,0,50,0,22,0,53,
+0,53,0,23,0,65,0,65,0,24,0,67,0,68,0,25,0,71,0,71,0,27,0,96,0,98,0,28,0,100,
+0,105,0,31,0,108,0,108,0,37,0,110,0,111,0,38,0,114,0,116,0,40,0,119,0,119,
+0,43,0,122,0,122,0,44,0,125,0,126,0,45,0,199,0,201,0,47,0,203,0,209,0,50,
+0,212,0,217,0,57,0,220,0,221,0,63,0,224,0,224,0,65,0,228,0,228,0,66,0,230,
+0,231,0,67,0,234,0,237,0,69,0,239,0,243,0,73,0,245,0,250,0,78,0,253,1,2,0,
+84,1,5,1,6,0,90,1,8,1,9,0,92,1,13,1,13,0,94,1,15,1,15,0,95,1,19,1,20,0,96,
+1,22,1,24,0,98,1,27,1,30,0,101,1,32,1,32,0,105,1,34,1,34,0,106,1,36,1,39,
+0,107,1,41,1,41,0,111,1,44,1,47,0,112,1,50,1,57,0,116,1,59,1,63,0,124,1,66,
+1,67,0,129,1,69,1,69,0,131,1,72,1,75,0,132,1,78,1,81,0,136,1,83,1,85,0,140,
+1,87,1,93,0,143,1,97,1,99,0,150,1,101,1,104,0,153,1,108,1,109,0,157,1,112,
+1,114,0,159,1,116,1,118,0,162,1,120,1,120,0,165,1,123,1,127,0,166,1,129,1,
+136,0,171,1,138,1,138,0,179,1,140,1,143,0,180,1,146,1,149,0,184,1,151,1,151,
+0,188,1,155,1,159,0,189,1,161,1,162,0,194,1,165,1,167,0,196,1,169,1,169,0,
+199,1,171,1,172,0,200,1,175,1,180,0,202,1,184,1,189,0,208,1,192,1,227,0,214,
+2,2,2,3,0,250,0,3,0,0,0,14,0,0,0,22,0,0,0,30,0,2,254,161,4,250,0,25,0,2,254,
+161,4,250,0,4,0,2,254,161,4,250,0,29,0,252,1,250,2,2,2,10,2,18,2,26,2,34,
+2,42,2,50,2,58,2,66,2,74,2,82,2,90,2,98,2,106,2,114,2,122,2,130,2,138,2,146,
+2,154,2,162,2,170,2,178,2,186,2,194,2,202,2,210,2,218,2,226,2,234,2,242,2,
+250,3,2,3,10,3,18,3,26,3,34,3,42,3,50,3,58,3,66,3,74,3,82,3,90,3,98,3,106,
+3,114,3,122,3,130,3,138,3,146,3,154,3,162,3,170,3,178,3,186,3,194,3,202,3,
+210,3,218,3,226,3,234,3,242,3,250,4,2,4,10,4,18,4,26,4,34,4,42,4,50,4,58,
+4,66,4,74,4,82,4,90,4,98,4,106,4,114,4,122,4,130,4,138,4,146,4,154,4,162,
+4,170,4,178,4,186,4,194,4,202,4,210,4,218,4,226,4,234,4,242,4,250,5,2,5,10,
+5,18,5,26,5,34,5,42,5,50,5,58,5,66,5,74,5,82,5,90,5,98,5,106,5,114,5,122,
+5,130,5,138,5,146,5,154,5,162,5,170,5,178,5,186,5,194,5,202,5,210,5,218,5,
+226,5,234,5,242,5,250,6,2,6,10,6,18,6,26,6,34,6,42,6,50,6,58,6,66,6,74,6,
+82,6,90,6,98,6,106,6,114,6,122,6,130,6,138,6,146,6,154,6,162,6,170,6,178,
+6,186,6,194,6,202,6,210,6,218,6,226,6,234,6,242,6,250,7,2,7,10,7,18,7,26,
+7,34,7,42,7,50,7,58,7,66,7,74,7,82,7,90,7,98,7,106,7,114,7,122,7,130,7,138,
+7,146,7,154,7,162,7,170,7,178,7,186,7,194,7,202,7,210,7,218,7,226,7,234,7,
+242,7,250,8,2,8,10,8,18,8,26,8,34,8,42,8,50,8,58,8,66,8,74,8,82,8,90,8,98,
+8,106,8,114,8,122,8,130,8,138,8,146,8,154,8,162,8,170,8,178,8,186,8,194,8,
+202,8,210,8,218,8,226,8,234,8,242,8,250,9,2,9,10,9,18,9,26,9,34,9,42,9,50,
+9,58,9,66,9,74,9,82,9,90,9,98,9,106,9,114,9,122,9,130,9,138,9,146,9,154,9,
+162,9,170,9,178,9,186,9,194,9,202,9,210,0,2,7,103,4,250,0,68,0,2,2,175,4,
+250,0,56,0,2,3,102,4,250,0,46,0,2,3,81,4,250,0,42,0,2,3,181,4,250,0,45,0,
+2,3,100,4,250,0,43,0,2,3,21,4,250,0,62,0,2,2,11,4,250,0,42,0,2,2,188,4,250,
+0,63,0,2,5,96,4,250,0,63,0,2,4,126,4,250,0,38,0,2,4,184,4,250,0,91,0,2,2,
+237,4,250,0,39,0,2,2,11,4,250,0,34,0,2,2,246,4,250,0,30,0,2,3,6,4,250,0,34,
+0,2,3,76,4,250,0,40,0,2,2,137,4,250,0,27,0,2,3,223,4,250,0,45,0,2,3,143,4,
+250,0,49,0,2,3,18,4,250,0,39,0,2,3,143,4,250,0,48,0,2,1,222,4,250,0,44,0,
+2,0,69,4,250,0,20,0,2,1,227,4,250,0,43,0,2,2,237,4,250,0,39,0,2,2,11,4,250,
+0,34,0,2,2,175,4,250,0,56,0,2,3,81,4,250,0,42,0,2,3,181,4,250,0,45,0,2,3,
+100,4,250,0,43,0,2,3,21,4,250,0,62,0,2,2,11,4,250,0,42,0,2,2,188,4,250,0,
+63,0,2,5,96,4,250,0,63,0,2,4,126,4,250,0,38,0,2,4,184,4,250,0,91,0,2,2,246,
+4,250,0,30,0,2,3,76,4,250,0,40,0,2,2,137,4,250,0,27,0,2,3,223,4,250,0,45,
+0,2,3,143,4,250,0,49,0,2,3,18,4,250,0,39,0,2,3,143,4,250,0,48,0,2,1,222,4,
+250,0,44,0,2,4,139,4,250,0,78,0,2,4,96,4,250,0,83,0,2,4,90,4,250,0,80,0,2,
+3,181,4,250,0,70,0,2,3,245,4,250,0,68,0,2,3,21,4,250,0,90,0,2,3,11,4,250,
+0,91,0,2,2,231,4,250,0,73,0,2,3,78,4,250,0,93,0,2,5,96,4,250,0,92,0,2,5,6,
+4,250,0,63,0,2,4,184,4,250,0,91,0,2,2,237,4,250,0,71,0,2,2,231,4,250,0,64,
+0,2,3,33,4,250,0,54,0,2,4,90,4,250,0,58,0,2,3,143,4,250,0,65,0,2,3,121,4,
+250,0,54,0,2,4,47,4,250,0,68,0,2,4,13,4,250,0,75,0,2,4,69,4,250,0,75,0,2,
+3,143,4,250,0,71,0,2,4,89,4,250,0,65,0,2,2,186,4,250,0,75,0,2,2,187,4,250,
+0,83,0,2,2,245,4,250,0,71,0,2,2,221,4,250,0,74,0,2,2,201,4,250,0,64,0,2,4,
+139,4,250,0,103,0,2,4,96,4,250,0,83,0,2,3,14,4,250,0,56,0,2,3,181,4,250,0,
+45,0,2,3,100,4,250,0,58,0,2,3,21,4,250,0,62,0,2,2,11,4,250,0,42,0,2,2,188,
+4,250,0,63,0,2,5,96,4,250,0,76,0,2,4,126,4,250,0,38,0,2,4,184,4,250,0,91,
+0,2,2,237,4,250,0,39,0,2,2,11,4,250,0,34,0,2,2,246,4,250,0,46,0,2,2,177,4,
+250,0,51,0,2,3,76,4,250,0,54,0,2,2,167,4,250,0,34,0,2,3,223,4,250,0,45,0,
+2,3,143,4,250,0,49,0,2,3,18,4,250,0,39,0,2,3,127,4,250,0,63,0,2,3,143,4,250,
+0,62,0,2,4,89,4,250,0,54,0,2,2,237,4,250,0,39,0,2,2,21,4,250,0,64,0,2,4,139,
+4,250,0,78,0,2,4,96,4,250,0,83,0,2,3,14,4,250,0,75,0,2,3,115,4,250,0,66,0,
+2,3,115,4,250,0,66,0,2,3,115,4,250,0,66,0,2,3,23,4,250,0,63,0,2,3,115,4,250,
+0,77,0,2,4,139,4,250,0,99,0,2,3,140,4,250,0,76,0,2,5,194,4,250,0,59,0,2,3,
+100,4,250,0,76,0,2,3,100,4,250,0,64,0,2,3,100,4,250,0,75,0,2,2,174,4,250,
+0,76,0,2,3,138,4,250,0,101,0,2,6,143,4,250,0,94,0,2,3,7,4,250,0,71,0,2,9,
+16,4,250,0,134,0,2,4,102,4,250,0,79,0,2,5,29,4,250,0,98,0,2,5,4,4,250,0,128,
+0,2,2,17,4,250,0,73,0,2,5,29,4,250,0,98,0,2,5,29,4,250,0,130,0,2,7,127,4,
+250,0,109,0,2,7,127,4,250,0,119,0,2,3,82,4,250,0,81,0,2,2,196,4,250,0,108,
+0,2,3,181,4,250,0,109,0,2,4,90,4,250,0,115,0,2,7,243,4,250,0,81,0,2,6,105,
+4,250,0,71,0,2,7,146,4,250,0,91,0,2,3,40,4,250,0,56,0,2,4,73,4,250,0,54,0,
+2,2,246,4,250,0,52,0,2,2,246,4,250,0,52,0,2,3,40,4,250,0,86,0,2,3,115,4,250,
+0,50,0,2,4,67,4,250,0,50,0,2,2,177,4,250,0,62,0,2,2,177,4,250,0,71,0,2,3,
+115,4,250,0,50,0,2,6,252,4,250,0,68,0,2,4,75,4,250,0,41,0,2,4,75,4,250,0,
+49,0,2,2,137,4,250,0,40,0,2,3,144,4,250,0,52,0,2,3,144,4,250,0,69,0,2,3,61,
+4,250,0,59,0,2,2,247,4,250,0,70,0,2,3,212,4,250,0,68,0,2,2,217,4,250,0,70,
+0,2,2,217,4,250,0,100,0,2,3,173,4,250,0,56,0,2,3,173,4,250,0,87,0,2,4,226,
+4,250,0,49,0,2,3,134,4,250,0,59,0,2,3,212,4,250,0,86,0,2,3,89,4,250,0,90,
+0,2,4,226,4,250,0,76,0,2,4,226,4,250,0,56,0,2,3,223,4,250,0,84,0,2,3,253,
+4,250,0,80,0,2,3,223,4,250,0,65,0,2,3,243,4,250,0,77,0,2,3,223,4,250,0,74,
+0,2,3,116,4,250,0,81,0,2,4,245,4,250,0,72,0,2,4,183,4,250,0,43,0,2,3,14,4,
+250,0,57,0,2,3,157,4,250,0,61,0,2,4,183,4,250,0,69,0,2,3,213,4,250,0,80,0,
+2,3,182,4,250,0,74,0,2,5,157,4,250,0,64,0,2,2,219,4,250,0,71,0,2,7,82,4,250,
+0,88,0,2,5,148,4,250,0,88,0,2,3,211,4,250,0,81,0,2,2,248,4,250,0,82,0,2,7,
+82,4,250,0,113,0,2,3,66,4,250,0,88,0,2,3,131,4,250,0,92,0,2,4,108,4,250,0,
+79,0,2,4,177,4,250,0,75,0,2,4,23,4,250,0,74,0,2,5,224,4,250,0,60,0,2,4,108,
+4,250,0,79,0,2,5,231,4,250,0,80,0,2,4,177,4,250,0,106,0,2,5,84,4,250,0,79,
+0,2,6,11,4,250,0,101,0,2,3,123,4,250,0,79,0,2,3,143,4,250,0,70,0,2,3,143,
+4,250,0,80,0,2,2,210,4,250,0,70,0,2,3,177,4,250,0,74,0,2,6,189,4,250,0,78,
+0,2,4,252,4,250,0,80,0,2,4,35,4,250,0,109,0,2,3,214,4,250,0,72,0,2,4,115,
+4,250,0,109,0,2,3,196,4,250,0,66,0,2,3,196,4,250,0,66,0,2,3,176,4,250,0,69,
+0,2,3,176,4,250,0,63,0,2,8,52,4,250,0,79,0,2,6,118,4,250,0,79,0,2,3,176,4,
+250,0,88,0,2,8,52,4,250,0,104,0,2,2,87,4,250,0,71,0,2,1,222,4,250,0,61,0,
+2,4,139,4,250,0,77,0,2,2,166,4,250,0,83,0,2,3,141,4,250,0,66,0,2,4,123,4,
+250,0,112,0,2,3,102,4,250,0,57,0,2,3,102,4,250,0,51,0,2,3,141,4,250,0,71,
+0,2,2,113,4,250,0,49,0,2,2,237,4,250,0,39,0,2,2,237,4,250,0,39,0,2,2,237,
+4,250,0,39,0,2,2,237,4,250,0,39,0,2,2,11,4,250,0,34,0,2,2,11,4,250,0,34,0,
+2,2,11,4,250,0,34,0,2,2,11,4,250,0,34,0,2,3,245,4,250,0,88,0,2,4,90,4,250,
+0,79,0,2,3,143,4,250,0,86,0,2,3,121,4,250,0,73,0,2,3,238,4,250,0,63,0,2,3,
+106,4,250,0,83,0,2,3,238,4,250,0,70,0,2,4,70,4,250,0,72,0,2,3,143,4,250,0,
+90,0,2,3,181,4,250,0,78,0,2,4,89,4,250,0,85,0,2,4,22,4,250,0,105,0,2,3,102,
+4,250,0,52,0,2,3,102,4,250,0,46,0,2,3,245,4,250,0,83,0,2,3,143,4,250,0,81,
+0,2,3,121,4,250,0,72,0,2,3,238,4,250,0,51,0,2,4,70,4,250,0,67,0,2,3,143,4,
+250,0,87,0,2,4,89,4,250,0,80,0,2,1,222,4,250,0,58,0,2,2,245,4,250,0,71,0,
+2,2,201,4,250,0,64,0,4,0,0,0,1,0,8,0,1,0,12,0,46,0,1,1,72,2,94,0,2,0,5,0,
+56,0,59,0,0,0,64,0,64,0,4,0,72,0,73,0,5,1,246,2,1,0,7,2,4,2,7,0,19,0,1,0,
+139,0,19,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,34,0,36,0,40,
+0,42,0,50,0,96,0,103,0,104,0,115,0,125,0,126,0,199,0,203,0,204,0,205,0,206,
+0,207,0,208,0,210,0,211,0,212,0,213,0,217,0,221,0,224,0,230,0,231,0,235,0,
+237,0,239,0,241,0,248,1,0,1,9,1,15,1,24,1,25,1,27,1,30,1,32,1,34,1,37,1,38,
+1,44,1,45,1,47,1,50,1,51,1,52,1,53,1,54,1,56,1,57,1,58,1,60,1,61,1,62,1,63,
+1,64,1,67,1,70,1,71,1,72,1,73,1,78,1,79,1,81,1,83,1,87,1,90,1,92,1,93,1,97,
+1,98,1,100,1,101,1,103,1,104,1,110,1,112,1,114,1,115,1,118,1,122,1,123,1,
+124,1,125,1,126,1,127,1,129,1,130,1,131,1,132,1,133,1,135,1,136,1,138,1,141,
+1,143,1,145,1,146,1,147,1,148,1,149,1,151,1,156,1,157,1,158,1,162,1,163,1,
+164,1,165,1,167,1,169,1,171,1,172,1,174,1,175,1,177,1,178,1,180,1,184,1,186,
+1,187,1,188,1,189,2,2,2,3,0,23,0,0,0,94,0,0,0,102,0,0,0,110,0,0,0,118,0,0,
+0,126,0,0,0,134,0,0,0,142,0,0,0,150,0,0,0,158,0,0,0,166,0,0,0,174,0,0,0,182,
+0,0,0,190,0,0,0,198,0,0,0,206,0,0,0,214,0,0,0,222,0,0,0,230,0,0,0,238,0,0,
+0,246,0,0,0,254,0,0,1,6,0,0,1,14,0,2,254,161,0,0,0,32,0,2,254,161,0,0,0,28,
+0,2,254,161,0,0,0,13,0,2,254,161,0,0,0,24,0,2,254,161,0,0,0,4,0,2,254,161,
+0,0,0,46,0,2,254,161,0,0,0,98,0,2,254,161,0,0,0,32,0,2,254,161,0,0,0,28,0,
+2,254,161,0,0,0,13,0,2,254,161,0,0,0,4,0,2,254,161,0,0,0,32,0,2,254,161,0,
+0,0,28,0,2,254,161,0,0,0,14,0,2,254,161,0,0,0,5,0,2,254,161,0,0,0,32,0,2,
+254,161,0,0,0,28,0,2,254,161,0,0,0,11,0,2,254,161,0,0,0,4,0,2,254,161,0,0,
+0,35,0,2,254,161,0,0,0,28,0,2,254,161,0,0,0,35,0,2,254,161,0,0,0,28,0,139,
+1,24,1,32,1,40,1,48,1,56,1,64,1,72,1,80,1,88,1,96,1,104,1,112,1,120,1,128,
+1,136,1,144,1,152,1,160,1,168,1,176,1,184,1,192,1,200,1,208,1,216,1,224,1,
+232,1,240,1,248,2,0,2,8,2,16,2,24,2,32,2,40,2,48,2,56,2,64,2,72,2,80,2,88,
+2,96,2,104,2,112,2,120,2,128,2,136,2,144,2,152,2,160,2,168,2,176,2,184,2,
+192,2,200,2,208,2,216,2,224,2,232,2,240,2,248,3,0,3,8,3,16,3,24,3,32,3,40,
+3,48,3,56,3,64,3,72,3,80,3,88,3,96,3,104,3,112,3,120,3,128,3,136,3,144,3,
+152,3,160,3,168,3,176,3,184,3,192,3,200,3,208,3,216,3,224,3,232,3,240,3,248,
+4,0,4,8,4,16,4,24,4,32,4,40,4,48,4,56,4,64,4,72,4,80,4,88,4,96,4,104,4,112,
+4,120,4,128,4,136,4,144,4,152,4,160,4,168,4,176,4,184,4,192,4,200,4,208,4,
+216,4,224,4,232,4,240,4,248,5,0,5,8,5,16,5,24,5,32,5,40,5,48,5,56,5,64,5,
+72,5,80,5,88,5,96,5,104,0,2,3,81,0,0,0,11,0,2,3,141,0,0,0,63,0,2,2,127,0,
+0,0,43,0,2,3,91,0,0,0,64,0,2,6,14,0,0,0,64,0,2,3,81,0,0,0,17,0,2,4,188,0,
+0,0,2,0,2,2,127,0,0,0,57,0,2,2,187,0,0,0,50,0,2,3,121,0,0,0,40,0,2,2,127,
+0,0,0,35,0,2,3,106,0,0,0,35,0,2,3,139,0,0,0,28,0,2,3,143,0,0,0,1,0,2,3,121,
+0,0,0,40,0,2,2,37,0,0,0,45,0,2,3,81,0,0,0,11,0,2,6,14,0,0,0,64,0,2,3,81,0,
+0,0,17,0,2,3,143,0,0,0,1,0,2,4,139,0,0,0,0,0,2,5,214,0,0,0,84,0,2,4,94,0,
+0,0,6,0,2,4,96,0,0,0,91,0,2,4,48,0,0,0,92,0,2,3,254,0,0,0,74,0,2,3,238,0,
+0,0,94,0,2,6,14,0,0,0,93,0,2,3,217,0,0,0,42,0,2,3,254,0,0,0,87,0,2,4,47,0,
+0,0,80,0,2,4,74,0,0,0,72,0,2,3,254,0,0,0,65,0,2,4,118,0,0,0,55,0,2,4,13,0,
+0,0,76,0,2,4,69,0,0,0,76,0,2,4,89,0,0,0,66,0,2,3,132,0,0,0,76,0,2,4,48,0,
+0,0,72,0,2,4,8,0,0,0,65,0,2,4,139,0,0,0,104,0,2,3,14,0,0,0,57,0,2,6,113,0,
+0,0,77,0,2,3,118,0,0,0,52,0,2,3,127,0,0,0,7,0,2,4,89,0,0,0,19,0,2,3,14,0,
+0,0,76,0,2,3,211,0,0,0,93,0,2,3,161,0,0,0,67,0,2,3,23,0,0,0,64,0,2,3,115,
+0,0,0,78,0,2,4,139,0,0,0,100,0,2,6,196,0,0,0,60,0,2,3,225,0,0,0,77,0,2,2,
+174,0,0,0,33,0,2,3,138,0,0,0,58,0,2,4,133,0,0,0,72,0,2,9,16,0,0,0,52,0,2,
+4,218,0,0,0,80,0,2,5,187,0,0,0,99,0,2,5,4,0,0,0,129,0,2,2,235,0,0,0,74,0,
+2,5,189,0,0,0,131,0,2,9,79,0,0,0,110,0,2,6,113,0,0,0,87,0,2,3,82,0,0,0,22,
+0,2,2,137,0,0,0,109,0,2,5,148,0,0,0,110,0,2,4,90,0,0,0,116,0,2,2,197,0,0,
+0,75,0,2,6,245,0,0,0,72,0,2,4,189,0,0,0,77,0,2,3,211,0,0,0,67,0,2,3,190,0,
+0,0,57,0,2,4,189,0,0,0,55,0,2,4,77,0,0,0,87,0,2,3,161,0,0,0,51,0,2,3,131,
+0,0,0,63,0,2,3,200,0,0,0,72,0,2,5,97,0,0,0,42,0,2,3,144,0,0,0,53,0,2,3,191,
+0,0,0,60,0,2,4,70,0,0,0,71,0,2,3,211,0,0,0,69,0,2,2,137,0,0,0,71,0,2,3,235,
+0,0,0,70,0,2,4,57,0,0,0,57,0,2,5,228,0,0,0,50,0,2,3,134,0,0,0,26,0,2,4,189,
+0,0,0,79,0,2,5,223,0,0,0,77,0,2,3,223,0,0,0,85,0,2,6,0,0,0,0,90,0,2,4,112,
+0,0,0,78,0,2,4,235,0,0,0,97,0,2,3,116,0,0,0,82,0,2,6,147,0,0,0,73,0,2,5,185,
+0,0,0,44,0,2,3,14,0,0,0,58,0,2,3,157,0,0,0,62,0,2,5,180,0,0,0,70,0,2,3,213,
+0,0,0,81,0,2,3,211,0,0,0,75,0,2,6,159,0,0,0,65,0,2,3,127,0,0,0,6,0,2,5,148,
+0,0,0,89,0,2,3,211,0,0,0,82,0,2,3,156,0,0,0,22,0,2,3,238,0,0,0,89,0,2,4,108,
+0,0,0,80,0,2,5,253,0,0,0,93,0,2,5,61,0,0,0,76,0,2,4,23,0,0,0,75,0,2,6,226,
+0,0,0,61,0,2,4,108,0,0,0,80,0,2,5,231,0,0,0,33,0,2,5,201,0,0,0,80,0,2,6,169,
+0,0,0,102,0,2,3,247,0,0,0,80,0,2,2,210,0,0,0,71,0,2,2,174,0,0,0,84,0,2,3,
+162,0,0,0,73,0,2,3,177,0,0,0,26,0,2,4,252,0,0,0,81,0,2,4,35,0,0,0,110,0,2,
+3,214,0,0,0,73,0,2,4,115,0,0,0,110,0,2,5,211,0,0,0,95,0,2,3,226,0,0,0,67,
+0,2,3,89,0,0,0,70,0,2,4,89,0,0,0,19,0,2,6,118,0,0,0,80,0,2,4,115,0,0,0,89,
+0,2,2,184,0,0,0,72,0,2,2,37,0,0,0,62,0,2,4,139,0,0,0,0,0,2,3,82,0,0,0,84,
+0,2,4,48,0,0,0,72,0,2,4,8,0,0,0,65,0,8,0,0,0,1,0,8,0,2,0,16,0,26,1,14,1,30,
+0,2,0,0,1,38,0,1,0,3,0,59,0,72,0,73,0,2,0,40,0,200,0,200,0,1,0,202,0,202,
+0,1,0,205,0,208,0,1,0,210,0,213,0,1,0,216,0,216,0,1,0,218,0,218,0,1,0,221,
+0,222,0,1,0,225,0,227,0,1,0,229,0,229,0,1,0,231,0,233,0,1,0,238,0,239,0,1,
+0,248,0,248,0,1,1,1,1,2,0,1,1,5,1,5,0,1,1,34,1,35,0,1,1,45,1,46,0,1,1,49,
+1,49,0,1,1,53,1,54,0,1,1,56,1,56,0,1,1,58,1,59,0,1,1,63,1,63,0,1,1,65,1,65,
+0,1,1,68,1,68,0,1,1,77,1,78,0,1,1,88,1,90,0,1,1,93,1,93,0,1,1,96,1,96,0,1,
+1,98,1,98,0,1,1,109,1,109,0,1,1,111,1,111,0,1,1,113,1,114,0,1,1,122,1,122,
+0,1,1,127,1,127,0,1,1,141,1,142,0,1,1,154,1,154,0,1,1,169,1,169,0,1,1,172,
+1,173,0,1,1,183,1,184,0,1,1,186,1,186,0,1,1,189,1,189,0,1,0,2,0,2,0,59,0,
+59,0,1,0,72,0,73,0,1,0,1,0,1,0,1,0,1,0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,3,
+0,1,0,0,0,1,0,8,0,2,0,14,0,1,0,3,1,84,1,204,1,24,0,1,0,3,0,59,0,72,0,73,0,
+2,0,0,0,1,0,8,0,1,0,12,0,4,0,0,0,1,0,18,0,1,0,1,0,5,0,38,0,13,255,156,0,15,
+255,196,0,16,255,206,0,20,255,156,0,21,255,206,0,28,255,206,0,33,255,176,
+0,35,255,191,0,37,255,186,0,39,255,211,0,70,255,156,0,131,255,156,0,132,255,
+206,0,139,255,206,0,144,255,176,0,146,255,191,0,148,255,186,0,150,255,211,
+0,242,255,156,0,243,255,206,0,250,255,206,0,255,255,176,1,1,255,191,1,3,255,
+186,1,36,255,206,1,37,255,206,1,38,255,206,1,39,255,206,1,40,255,206,1,70,
+255,176,1,71,255,176,1,73,255,176,1,76,255,176,1,96,255,186,1,115,255,211,
+1,117,255,211,1,119,255,211,1,120,255,211,0,0,0,1,0,0,0,10,0,92,1,74,0,2,
+98,101,110,103,0,14,98,110,103,50,0,18,0,8,0,0,0,34,0,0,0,0,255,255,0,12,
+0,8,0,10,0,1,0,16,0,2,0,6,0,13,0,17,0,11,0,0,0,4,0,15,0,0,255,255,0,12,0,
+10,0,1,0,16,0,3,0,7,0,14,0,5,0,9,0,12,0,0,0,4,0,15,0,18,97,98,118,115,0,110,
+97,107,104,110,0,118,98,108,119,102,0,124,98,108,119,102,0,130,98,108,119,
+115,0,136,99,106,99,116,0,150,104,97,108,102,0,156,104,97,108,102,0,162,105,
+110,105,116,0,168,105,110,105,116,0,174,110,117,107,116,0,180,112,114,101,
+115,0,186,112,114,101,115,0,194,112,115,116,102,0,204,112,115,116,102,0,210,
+112,115,116,115,0,216,114,112,104,102,0,226,118,97,116,117,0,232,0,0,0,2,
+0,15,0,16,0,0,0,1,0,2,0,0,0,1,0,4,0,0,0,1,0,5,0,0,0,5,0,18,0,19,0,20,0,23,
+0,27,0,0,0,1,0,10,0,0,0,1,0,6,0,0,0,1,0,7,0,0,0,1,0,0,0,0,0,1,0,11,0,0,0,
+1,0,1,0,0,0,2,0,13,0,14,0,0,0,3,0,12,0,13,0,14,0,0,0,1,0,8,0,0,0,1,0,9,0,
+0,0,3,0,30,0,32,0,34,0,0,0,1,0,3,0,0,0,1,0,12,0,43,0,88,0,110,2,24,2,74,2,
+120,2,180,2,228,6,80,7,124,7,156,7,188,9,14,9,36,11,34,13,68,19,48,19,182,
+21,240,22,22,25,26,25,88,28,254,29,22,30,136,30,190,30,224,31,2,31,36,32,
+36,32,58,32,80,32,198,32,232,33,16,33,50,33,182,33,216,33,250,34,22,34,56,
+34,84,34,118,34,152,0,1,0,0,0,1,0,8,0,1,0,6,1,130,0,1,0,2,0,60,0,61,0,4,0,
+0,0,1,0,8,0,1,1,134,0,32,0,70,0,80,0,90,0,100,0,110,0,120,0,130,0,140,0,150,
+0,160,0,170,0,180,0,190,0,200,0,210,0,220,0,230,0,240,0,250,1,4,1,14,1,24,
+1,34,1,44,1,54,1,64,1,74,1,84,1,94,1,104,1,114,1,124,0,1,0,4,0,96,0,2,0,51,
+0,1,0,4,0,97,0,2,0,51,0,1,0,4,0,98,0,2,0,51,0,1,0,4,0,99,0,2,0,51,0,1,0,4,
+0,100,0,2,0,51,0,1,0,4,0,101,0,2,0,51,0,1,0,4,0,102,0,2,0,51,0,1,0,4,0,103,
+0,2,0,51,0,1,0,4,0,104,0,2,0,51,0,1,0,4,0,105,0,2,0,51,0,1,0,4,0,106,0,2,
+0,51,0,1,0,4,0,107,0,2,0,51,0,1,0,4,0,67,0,2,0,51,0,1,0,4,0,68,0,2,0,51,0,
+1,0,4,0,108,0,2,0,51,0,1,0,4,0,109,0,2,0,51,0,1,0,4,0,110,0,2,0,51,0,1,0,
+4,0,111,0,2,0,51,0,1,0,4,0,112,0,2,0,51,0,1,0,4,0,113,0,2,0,51,0,1,0,4,0,
+114,0,2,0,51,0,1,0,4,0,115,0,2,0,51,0,1,0,4,0,116,0,2,0,51,0,1,0,4,0,117,
+0,2,0,51,0,1,0,4,0,69,0,2,0,51,0,1,0,4,0,118,0,2,0,51,0,1,0,4,0,119,0,2,0,
+51,0,1,0,4,0,120,0,2,0,51,0,1,0,4,0,121,0,2,0,51,0,1,0,4,0,122,0,2,0,51,0,
+1,0,4,0,123,0,2,0,51,0,1,0,4,0,124,0,2,0,51,0,2,0,4,0,19,0,40,0,0,0,42,0,
+44,0,22,0,46,0,50,0,25,0,84,0,85,0,30,0,4,0,0,0,1,0,8,0,1,0,34,0,2,0,10,0,
+22,0,1,0,4,0,125,0,3,0,64,0,48,0,1,0,4,0,126,0,3,0,64,0,28,0,1,0,2,0,19,0,
+26,0,4,0,0,0,1,0,8,0,1,0,30,0,2,0,10,0,20,0,1,0,4,0,127,0,2,0,64,0,1,0,4,
+0,127,0,2,0,64,0,1,0,2,0,45,0,84,0,4,0,0,0,1,0,8,0,1,0,42,0,3,0,12,0,22,0,
+32,0,1,0,4,0,129,0,2,0,64,0,1,0,4,0,128,0,2,0,64,0,1,0,4,0,128,0,2,0,64,0,
+1,0,3,0,41,0,45,0,84,0,4,0,0,0,1,0,8,0,1,0,34,0,1,0,8,0,3,0,8,0,14,0,20,0,
+129,0,2,0,41,0,128,0,2,0,45,0,128,0,2,0,84,0,1,0,1,0,64,0,4,0,0,0,1,0,8,0,
+1,3,72,0,68,0,142,0,152,0,162,0,172,0,182,0,192,0,202,0,212,0,222,0,232,0,
+242,0,252,1,6,1,16,1,26,1,36,1,56,1,66,1,76,1,86,1,96,1,106,1,116,1,126,1,
+136,1,146,1,156,1,174,1,184,1,194,1,204,1,214,1,224,1,234,1,244,1,254,2,8,
+2,18,2,28,2,38,2,48,2,58,2,68,2,78,2,88,2,98,2,108,2,118,2,128,2,138,2,148,
+2,158,2,168,2,178,2,188,2,198,2,208,2,218,2,228,2,238,2,248,3,2,3,12,3,22,
+3,32,3,42,3,52,3,62,0,1,0,4,0,130,0,2,0,64,0,1,0,4,0,131,0,2,0,64,0,1,0,4,
+0,132,0,2,0,64,0,1,0,4,0,133,0,2,0,64,0,1,0,4,0,134,0,2,0,64,0,1,0,4,0,135,
+0,2,0,64,0,1,0,4,0,136,0,2,0,64,0,1,0,4,0,137,0,2,0,64,0,1,0,4,0,138,0,2,
+0,64,0,1,0,4,0,139,0,2,0,64,0,1,0,4,0,140,0,2,0,64,0,1,0,4,0,141,0,2,0,64,
+0,1,0,4,0,142,0,2,0,64,0,1,0,4,0,143,0,2,0,64,0,1,0,4,0,144,0,2,0,64,0,2,
+0,6,0,14,0,65,0,3,0,64,2,62,0,145,0,2,0,64,0,1,0,4,0,146,0,2,0,64,0,1,0,4,
+0,147,0,2,0,64,0,1,0,4,0,148,0,2,0,64,0,1,0,4,0,149,0,2,0,64,0,1,0,4,0,150,
+0,2,0,64,0,1,0,4,0,151,0,2,0,64,0,1,0,4,0,152,0,2,0,64,0,1,0,4,0,153,0,2,
+0,64,0,1,0,4,0,154,0,2,0,64,0,1,0,4,0,155,0,2,0,64,0,2,0,6,0,12,0,187,0,2,
+0,64,0,187,0,2,0,64,0,1,0,4,0,156,0,2,0,64,0,1,0,4,0,157,0,2,0,64,0,1,0,4,
+0,158,0,2,0,64,0,1,0,4,0,159,0,2,0,64,0,1,0,4,0,160,0,2,0,64,0,1,0,4,0,177,
+0,2,0,64,0,1,0,4,0,178,0,2,0,64,0,1,0,4,0,190,0,2,0,64,0,1,0,4,0,161,0,2,
+0,64,0,1,0,4,0,162,0,2,0,64,0,1,0,4,0,165,0,2,0,64,0,1,0,4,0,166,0,2,0,64,
+0,1,0,4,0,167,0,2,0,64,0,1,0,4,0,168,0,2,0,64,0,1,0,4,0,169,0,2,0,64,0,1,
+0,4,0,170,0,2,0,64,0,1,0,4,0,171,0,2,0,64,0,1,0,4,0,172,0,2,0,64,0,1,0,4,
+0,173,0,2,0,64,0,1,0,4,0,174,0,2,0,64,0,1,0,4,0,175,0,2,0,64,0,1,0,4,0,176,
+0,2,0,64,0,1,0,4,0,179,0,2,0,64,0,1,0,4,0,180,0,2,0,64,0,1,0,4,0,181,0,2,
+0,64,0,1,0,4,0,182,0,2,0,64,0,1,0,4,0,183,0,2,0,64,0,1,0,4,0,184,0,2,0,64,
+0,1,0,4,0,185,0,2,0,64,0,1,0,4,0,186,0,2,0,64,0,1,0,4,0,188,0,2,0,64,0,1,
+0,4,0,189,0,2,0,64,0,1,0,4,0,191,0,2,0,64,0,1,0,4,0,192,0,2,0,64,0,1,0,4,
+0,193,0,2,0,64,0,1,0,4,0,194,0,2,0,64,0,1,0,4,0,195,0,2,0,64,0,1,0,4,0,196,
+0,2,0,64,0,1,0,4,0,197,0,2,0,64,0,1,0,4,0,163,0,2,0,64,0,1,0,4,0,164,0,2,
+0,64,0,2,0,4,0,19,0,50,0,0,0,67,0,69,0,32,0,84,0,85,0,35,0,96,0,126,0,37,
+0,4,0,0,0,1,0,8,0,1,0,248,0,20,0,46,0,56,0,66,0,76,0,86,0,96,0,106,0,116,
+0,126,0,138,0,148,0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,228,0,238,0,
+1,0,4,0,130,0,2,0,64,0,1,0,4,0,132,0,2,0,64,0,1,0,4,0,134,0,2,0,64,0,1,0,
+4,0,135,0,2,0,64,0,1,0,4,0,140,0,2,0,64,0,1,0,4,0,142,0,2,0,64,0,1,0,4,0,
+143,0,2,0,64,0,1,0,4,0,144,0,2,0,64,0,1,0,4,0,65,0,3,0,64,2,62,0,1,0,4,0,
+147,0,2,0,64,0,1,0,4,0,149,0,2,0,64,0,1,0,4,0,150,0,2,0,64,0,1,0,4,0,152,
+0,2,0,64,0,1,0,4,0,154,0,2,0,64,0,1,0,4,0,156,0,2,0,64,0,1,0,4,0,157,0,2,
+0,64,0,1,0,4,0,158,0,2,0,64,0,1,0,4,0,159,0,2,0,64,0,1,0,4,0,177,0,2,0,64,
+0,1,0,4,0,178,0,2,0,64,0,1,0,20,0,19,0,21,0,23,0,24,0,29,0,31,0,32,0,33,0,
+34,0,36,0,38,0,39,0,41,0,43,0,46,0,47,0,48,0,49,0,67,0,68,0,4,0,0,0,1,0,8,
+0,1,0,18,0,1,0,8,0,1,0,4,0,198,0,2,0,64,0,1,0,1,0,44,0,4,0,0,0,1,0,8,0,1,
+0,18,0,1,0,8,0,1,0,4,0,198,0,2,0,44,0,1,0,1,0,64,0,4,0,0,0,1,0,8,0,1,1,50,
+0,10,0,26,0,48,0,70,0,112,0,164,0,186,0,208,0,230,0,242,1,28,0,2,0,6,0,14,
+1,42,0,3,0,64,0,38,1,43,0,3,0,64,0,46,0,2,0,6,0,14,1,57,0,3,0,64,0,26,1,58,
+0,3,0,64,0,27,0,4,0,10,0,18,0,26,0,34,1,60,0,3,0,64,0,24,1,61,0,3,0,64,0,
+25,1,62,0,3,0,64,0,26,1,63,0,3,0,64,0,27,0,5,0,12,0,20,0,28,0,36,0,44,1,79,
+0,3,0,64,0,34,1,80,0,3,0,64,0,35,1,81,0,3,0,64,0,38,1,82,0,3,0,64,0,43,1,
+83,0,3,0,64,0,46,0,2,0,6,0,14,1,95,0,3,0,64,0,38,1,96,0,3,0,64,0,43,0,2,0,
+6,0,14,1,122,0,3,0,64,0,29,1,123,0,3,0,64,0,46,0,2,0,6,0,14,1,127,0,3,0,64,
+0,42,1,129,0,3,0,64,0,217,0,1,0,4,1,130,0,3,0,64,0,46,0,4,0,10,0,18,0,26,
+0,34,1,186,0,3,0,64,0,33,1,187,0,3,0,64,0,38,1,188,0,3,0,64,0,43,1,189,0,
+3,0,64,0,46,0,2,0,6,0,14,1,34,0,3,0,64,0,33,1,35,0,3,0,64,0,43,0,1,0,10,0,
+22,0,26,0,28,0,34,0,37,0,40,0,41,0,42,0,50,0,125,0,1,0,0,0,1,0,8,0,1,0,6,
+1,130,0,1,0,2,0,60,0,61,0,4,0,0,0,1,0,8,0,1,1,218,0,39,0,84,0,94,0,104,0,
+114,0,124,0,134,0,144,0,154,0,164,0,174,0,184,0,194,0,204,0,214,0,224,0,234,
+0,244,0,254,1,8,1,18,1,28,1,38,1,48,1,58,1,68,1,78,1,88,1,98,1,108,1,118,
+1,128,1,138,1,148,1,158,1,168,1,178,1,188,1,198,1,208,0,1,0,4,0,199,0,2,0,
+128,0,1,0,4,0,200,0,2,0,128,0,1,0,4,0,201,0,2,0,128,0,1,0,4,0,202,0,2,0,128,
+0,1,0,4,0,203,0,2,0,128,0,1,0,4,0,205,0,2,0,128,0,1,0,4,0,206,0,2,0,128,0,
+1,0,4,0,207,0,2,0,128,0,1,0,4,0,208,0,2,0,128,0,1,0,4,0,209,0,2,0,128,0,1,
+0,4,0,210,0,2,0,128,0,1,0,4,0,211,0,2,0,128,0,1,0,4,0,212,0,2,0,128,0,1,0,
+4,0,213,0,2,0,128,0,1,0,4,0,214,0,2,0,128,0,1,0,4,0,215,0,2,0,128,0,1,0,4,
+0,216,0,2,0,128,0,1,0,4,0,217,0,2,0,128,0,1,0,4,0,218,0,2,0,128,0,1,0,4,0,
+219,0,2,0,128,0,1,0,4,0,220,0,2,0,128,0,1,0,4,0,221,0,2,0,128,0,1,0,4,0,222,
+0,2,0,128,0,1,0,4,0,223,0,2,0,128,0,1,0,4,0,224,0,2,0,128,0,1,0,4,0,225,0,
+2,0,128,0,1,0,4,0,226,0,2,0,128,0,1,0,4,0,227,0,2,0,128,0,1,0,4,0,228,0,2,
+0,128,0,1,0,4,0,229,0,2,0,128,0,1,0,4,0,230,0,2,0,128,0,1,0,4,0,231,0,2,0,
+128,0,1,0,4,0,234,0,2,0,128,0,1,0,4,0,236,0,2,0,128,0,1,0,4,0,238,0,2,0,128,
+0,1,0,4,0,232,0,2,0,128,0,1,0,4,0,233,0,2,0,128,0,1,0,4,0,239,0,2,0,128,0,
+1,0,4,0,240,0,2,0,128,0,2,0,4,0,19,0,50,0,0,0,67,0,69,0,32,0,84,0,85,0,35,
+0,125,0,126,0,37,0,4,0,0,0,1,0,8,0,1,1,242,0,41,0,88,0,98,0,108,0,118,0,128,
+0,138,0,148,0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,228,0,238,0,248,1,
+2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,1,92,1,102,1,112,1,122,1,132,1,
+142,1,152,1,162,1,172,1,182,1,192,1,202,1,212,1,222,1,232,0,1,0,4,0,241,0,
+2,0,129,0,1,0,4,0,242,0,2,0,129,0,1,0,4,0,243,0,2,0,129,0,1,0,4,0,244,0,2,
+0,129,0,1,0,4,0,245,0,2,0,129,0,1,0,4,0,246,0,2,0,129,0,1,0,4,0,247,0,2,0,
+129,0,1,0,4,0,248,0,2,0,129,0,1,0,4,0,249,0,2,0,129,0,1,0,4,0,250,0,2,0,129,
+0,1,0,4,0,251,0,2,0,129,0,1,0,4,0,252,0,2,0,129,0,1,0,4,0,253,0,2,0,129,0,
+1,0,4,0,254,0,2,0,129,0,1,0,4,0,255,0,2,0,129,0,1,0,4,1,0,0,2,0,129,0,1,0,
+4,1,1,0,2,0,129,0,1,0,4,1,2,0,2,0,129,0,1,0,4,1,3,0,2,0,129,0,1,0,4,1,4,0,
+2,0,129,0,1,0,4,1,5,0,2,0,129,0,1,0,4,1,6,0,2,0,129,0,1,0,4,1,7,0,2,0,129,
+0,1,0,4,1,8,0,2,0,129,0,1,0,4,1,9,0,2,0,129,0,1,0,4,1,10,0,2,0,129,0,1,0,
+4,1,11,0,2,0,129,0,1,0,4,1,12,0,2,0,129,0,1,0,4,1,13,0,2,0,129,0,1,0,4,1,
+14,0,2,0,129,0,1,0,4,1,15,0,2,0,129,0,1,0,4,1,16,0,2,0,129,0,1,0,4,1,19,0,
+2,0,129,0,1,0,4,1,20,0,2,0,129,0,1,0,4,1,21,0,2,0,129,0,1,0,4,1,17,0,2,0,
+129,0,1,0,4,1,18,0,2,0,129,0,1,0,4,1,22,0,2,0,129,0,1,0,4,1,23,0,2,0,129,
+0,1,0,4,1,59,0,2,0,129,0,1,0,4,1,84,0,2,0,129,0,2,0,6,0,19,0,50,0,0,0,67,
+0,69,0,32,0,84,0,85,0,35,0,125,0,126,0,37,1,57,1,57,0,39,1,79,1,79,0,40,0,
+4,0,0,0,1,0,8,0,1,5,170,0,27,0,60,0,142,0,192,0,210,1,12,1,62,1,88,1,122,
+1,140,1,166,1,240,2,34,2,116,2,134,3,24,3,82,3,100,3,150,3,160,4,2,4,108,
+4,158,4,232,5,98,5,132,5,150,5,160,0,10,0,22,0,28,0,34,0,40,0,46,0,52,0,58,
+0,64,0,70,0,76,1,24,0,2,0,19,1,25,0,2,0,29,1,27,0,2,0,34,1,30,0,2,0,38,1,
+31,0,2,0,43,1,32,0,2,0,46,1,33,0,2,0,49,1,26,0,2,0,210,1,29,0,2,0,215,1,28,
+0,2,1,0,0,6,0,14,0,20,0,26,0,32,0,38,0,44,1,36,0,2,0,21,1,37,0,2,0,36,1,38,
+0,2,0,37,1,39,0,2,0,38,1,40,0,2,0,43,1,41,0,2,0,46,0,2,0,6,0,12,1,42,0,2,
+0,38,1,43,0,2,0,46,0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,1,44,0,2,0,19,1,
+46,0,2,0,20,1,47,0,2,0,21,1,48,0,2,0,22,1,49,0,2,0,43,1,50,0,2,0,125,1,45,
+0,2,0,199,0,6,0,14,0,20,0,26,0,32,0,38,0,44,1,51,0,2,0,24,1,52,0,2,0,25,1,
+53,0,2,0,28,1,54,0,2,0,38,1,56,0,2,0,206,1,55,0,2,0,247,0,3,0,8,0,14,0,20,
+1,57,0,2,0,26,1,58,0,2,0,27,1,59,0,2,0,248,0,4,0,10,0,16,0,22,0,28,1,60,0,
+2,0,24,1,61,0,2,0,25,1,62,0,2,0,26,1,63,0,2,0,27,0,2,0,6,0,12,1,64,0,2,0,
+29,1,65,0,2,0,43,0,3,0,8,0,14,0,20,1,66,0,2,0,21,1,67,0,2,0,31,1,68,0,2,0,
+43,0,9,0,20,0,26,0,32,0,38,0,44,0,50,0,56,0,62,0,68,1,70,0,2,0,29,1,71,0,
+2,0,30,1,72,0,2,0,31,1,73,0,2,0,32,1,74,0,2,0,33,1,75,0,2,0,38,1,76,0,2,0,
+43,1,77,0,2,0,210,1,78,0,2,0,212,0,6,0,14,0,20,0,26,0,32,0,38,0,44,1,79,0,
+2,0,34,1,80,0,2,0,35,1,81,0,2,0,38,1,82,0,2,0,43,1,83,0,2,0,46,1,84,0,2,1,
+0,0,10,0,22,0,28,0,34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,1,85,0,2,0,21,1,
+86,0,2,0,22,1,87,0,2,0,36,1,90,0,2,0,37,1,89,0,2,0,38,1,92,0,2,0,42,1,94,
+0,2,0,43,1,93,0,2,0,223,1,88,0,2,1,2,1,91,0,2,1,3,0,2,0,6,0,12,1,95,0,2,0,
+38,1,96,0,2,0,43,0,18,0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,
+98,0,104,0,110,0,116,0,122,0,128,0,134,0,140,1,110,0,2,0,29,1,100,0,2,0,30,
+1,101,0,2,0,31,1,97,0,2,0,34,1,98,0,2,0,35,1,103,0,2,0,36,1,104,0,2,0,37,
+1,105,0,2,0,38,1,106,0,2,0,43,1,107,0,2,0,49,1,111,0,2,0,210,1,102,0,2,0,
+212,1,109,0,2,0,215,1,99,0,2,0,216,1,112,0,2,0,217,1,114,0,2,0,218,1,108,
+0,2,1,0,1,113,0,2,1,2,0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,1,115,0,2,0,
+29,1,118,0,2,0,34,1,117,0,2,0,38,1,116,0,2,0,39,1,119,0,2,0,43,1,120,0,2,
+0,46,1,121,0,2,0,49,0,2,0,6,0,12,1,122,0,2,0,29,1,123,0,2,0,46,0,6,0,14,0,
+20,0,26,0,32,0,38,0,44,1,124,0,2,0,26,1,125,0,2,0,36,1,126,0,2,0,37,1,127,
+0,2,0,42,1,128,0,2,0,46,1,129,0,2,0,217,0,1,0,4,1,130,0,2,0,46,0,12,0,26,
+0,32,0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,1,131,0,2,0,34,1,132,
+0,2,0,36,1,133,0,2,0,38,1,134,0,2,0,39,1,135,0,2,0,40,1,136,0,2,0,42,1,137,
+0,2,0,43,1,138,0,2,0,46,1,139,0,2,0,49,1,140,0,2,0,220,1,141,0,2,0,222,1,
+142,0,2,0,223,0,13,0,28,0,34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,0,82,0,88,
+0,94,0,100,1,143,0,2,0,19,1,144,0,2,0,21,1,145,0,2,0,29,1,146,0,2,0,31,1,
+147,0,2,0,34,1,148,0,2,0,36,1,149,0,2,0,37,1,150,0,2,0,39,1,151,0,2,0,40,
+1,152,0,2,0,43,1,153,0,2,0,46,1,154,0,2,0,210,1,155,0,2,0,212,0,6,0,14,0,
+20,0,26,0,32,0,38,0,44,1,156,0,2,0,24,1,157,0,2,0,25,1,158,0,2,0,34,1,159,
+0,2,0,38,1,160,0,2,0,43,1,161,0,2,0,46,0,9,0,20,0,26,0,32,0,38,0,44,0,50,
+0,56,0,62,0,68,1,162,0,2,0,19,1,163,0,2,0,29,1,164,0,2,0,30,1,165,0,2,0,33,
+1,166,0,2,0,39,1,167,0,2,0,40,1,168,0,2,0,43,1,169,0,2,0,199,1,170,0,2,0,
+210,0,15,0,32,0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,
+0,110,0,116,1,171,0,2,0,19,1,173,0,2,0,20,1,174,0,2,0,29,1,175,0,2,0,34,1,
+177,0,2,0,35,1,178,0,2,0,38,1,179,0,2,0,39,1,180,0,2,0,40,1,181,0,2,0,43,
+1,182,0,2,0,46,1,172,0,2,0,199,1,183,0,2,0,210,1,184,0,2,0,215,1,185,0,2,
+0,220,1,176,0,2,1,0,0,4,0,10,0,16,0,22,0,28,1,186,0,2,0,33,1,187,0,2,0,38,
+1,188,0,2,0,43,1,189,0,2,0,46,0,2,0,6,0,12,1,34,0,2,0,33,1,35,0,2,0,43,0,
+1,0,4,1,69,0,2,0,21,0,1,0,4,1,141,0,2,0,128,0,1,0,27,0,130,0,132,0,133,0,
+134,0,135,0,137,0,139,0,140,0,142,0,144,0,145,0,147,0,148,0,149,0,150,0,151,
+0,152,0,153,0,154,0,156,0,157,0,158,0,159,0,160,0,163,0,177,1,9,0,4,0,0,0,
+1,0,8,0,1,0,116,0,3,0,12,0,48,0,58,0,4,0,10,0,16,0,22,0,30,1,230,0,2,0,55,
+1,243,0,2,0,66,1,244,0,3,0,127,0,66,1,229,0,2,0,127,0,1,0,4,1,230,0,2,0,4,
+0,6,0,14,0,22,0,30,0,36,0,44,0,50,1,232,0,3,0,4,0,55,1,244,0,3,0,4,0,66,1,
+229,0,2,0,4,1,232,0,3,0,55,0,4,1,231,0,2,0,55,1,244,0,3,0,66,0,4,0,1,0,3,
+0,4,0,55,0,127,0,6,0,0,0,1,0,8,0,2,0,18,0,32,1,188,1,210,0,3,0,0,1,218,2,
+32,0,1,0,5,0,4,0,55,1,230,1,231,1,232,0,2,0,68,0,9,0,12,0,2,0,16,0,16,0,2,
+0,18,0,18,0,2,0,19,0,19,0,4,0,23,0,25,0,4,0,29,0,29,0,3,0,30,0,38,0,4,0,41,
+0,45,0,4,0,50,0,50,0,4,0,54,0,54,0,5,0,56,0,59,0,1,0,66,0,66,0,2,0,67,0,69,
+0,4,0,72,0,73,0,1,0,84,0,85,0,4,0,106,0,106,0,3,0,205,0,205,0,4,0,210,0,210,
+0,3,0,211,0,214,0,4,0,222,0,222,0,4,0,231,0,231,0,4,0,234,0,234,0,4,0,236,
+0,236,0,4,0,238,0,238,0,4,0,241,0,241,0,4,0,245,0,247,0,4,0,251,0,251,0,3,
+0,252,1,0,0,4,1,2,1,2,0,4,1,4,1,4,0,4,1,8,1,10,0,4,1,14,1,14,0,4,1,16,1,16,
+0,4,1,18,1,21,0,4,1,24,1,24,0,4,1,25,1,26,0,3,1,30,1,30,0,4,1,32,1,32,0,4,
+1,44,1,45,0,4,1,47,1,47,0,4,1,54,1,54,0,4,1,61,1,61,0,4,1,64,1,64,0,3,1,70,
+1,70,0,3,1,74,1,75,0,4,1,77,1,77,0,3,1,79,1,79,0,4,1,81,1,81,0,4,1,83,1,84,
+0,4,1,89,1,89,0,4,1,95,1,95,0,4,1,98,1,99,0,4,1,105,1,105,0,4,1,110,1,111,
+0,3,1,115,1,115,0,3,1,122,1,122,0,3,1,126,1,128,0,4,1,133,1,133,0,4,1,138,
+1,138,0,4,1,145,1,145,0,3,1,154,1,154,0,3,1,162,1,162,0,4,1,163,1,163,0,3,
+1,170,1,170,0,3,1,174,1,174,0,3,1,183,1,183,0,3,1,186,1,187,0,4,1,189,1,189,
+0,4,0,2,0,3,0,4,0,4,0,1,0,55,0,55,0,2,1,230,1,232,0,2,0,1,0,1,0,1,0,1,0,4,
+0,10,0,26,0,40,0,54,0,2,0,1,0,2,0,1,0,0,0,1,0,0,0,17,0,1,0,2,0,1,0,0,0,1,
+0,0,0,17,0,1,0,3,0,1,0,0,0,1,0,0,0,17,0,2,0,4,0,5,0,1,0,0,0,1,0,0,0,17,0,
+1,0,4,0,1,0,3,0,1,0,0,0,1,0,0,0,17,0,1,0,0,0,1,0,8,0,2,0,16,0,5,1,228,1,233,
+1,234,1,235,1,236,0,1,0,5,0,4,0,55,1,230,1,231,1,232,0,4,0,0,0,1,0,8,0,1,
+2,190,0,29,0,64,0,84,0,122,0,142,0,180,0,214,0,248,1,30,1,56,1,70,1,96,1,
+122,1,148,1,162,1,188,1,214,1,240,2,2,2,12,2,30,2,48,2,66,2,76,2,94,2,112,
+2,130,2,150,2,160,2,180,0,2,0,6,0,12,1,192,0,2,0,56,1,192,0,3,2,62,0,56,0,
+4,0,10,0,16,0,22,0,30,1,194,0,2,0,56,1,218,0,2,0,57,1,194,0,3,2,62,0,56,1,
+218,0,3,2,62,0,57,0,2,0,6,0,12,1,196,0,2,0,56,1,196,0,3,2,62,0,56,0,4,0,10,
+0,16,0,22,0,30,1,197,0,2,0,56,1,227,0,2,0,58,1,197,0,3,2,62,0,56,1,227,0,
+3,2,62,0,58,0,4,0,10,0,16,0,22,0,28,1,198,0,2,0,56,1,199,0,2,0,57,1,200,0,
+2,0,58,1,201,0,2,0,64,0,4,0,10,0,16,0,22,0,28,1,202,0,2,0,56,1,203,0,2,0,
+57,1,204,0,2,0,58,1,205,0,2,0,64,0,4,0,10,0,16,0,22,0,30,1,195,0,2,0,56,1,
+219,0,2,0,57,1,195,0,3,2,62,0,56,1,219,0,3,2,62,0,57,0,2,0,6,0,16,1,206,0,
+4,0,45,2,62,0,56,1,220,0,4,0,45,2,62,0,57,0,1,0,4,1,207,0,4,0,45,2,62,0,56,
+0,2,0,6,0,16,1,208,0,4,0,45,2,62,0,56,1,221,0,4,0,45,2,62,0,57,0,2,0,6,0,
+16,1,209,0,4,0,45,2,62,0,56,1,222,0,4,0,45,2,62,0,57,0,2,0,6,0,16,1,210,0,
+4,0,45,2,62,0,56,1,223,0,4,0,45,2,62,0,57,0,1,0,4,1,212,0,4,0,45,2,62,0,56,
+0,2,0,6,0,16,1,213,0,4,0,45,2,62,0,56,1,224,0,4,0,45,2,62,0,57,0,2,0,6,0,
+16,1,214,0,4,0,45,2,62,0,56,1,225,0,4,0,45,2,62,0,57,0,2,0,6,0,16,1,216,0,
+4,0,45,2,62,0,56,1,226,0,4,0,45,2,62,0,57,0,2,0,6,0,12,1,206,0,2,0,56,1,220,
+0,2,0,57,0,1,0,4,1,207,0,2,0,56,0,2,0,6,0,12,1,208,0,2,0,56,1,221,0,2,0,57,
+0,2,0,6,0,12,1,209,0,2,0,56,1,222,0,2,0,57,0,2,0,6,0,12,1,210,0,2,0,56,1,
+223,0,2,0,57,0,1,0,4,1,212,0,2,0,56,0,2,0,6,0,12,1,213,0,2,0,56,1,224,0,2,
+0,57,0,2,0,6,0,12,1,214,0,2,0,56,1,225,0,2,0,57,0,2,0,6,0,12,1,216,0,2,0,
+56,1,226,0,2,0,57,0,2,0,6,0,12,1,211,0,2,0,56,1,211,0,3,2,62,0,56,0,1,0,4,
+1,193,0,2,0,56,0,2,0,6,0,12,1,215,0,2,0,56,1,215,0,3,2,62,0,56,0,1,0,4,1,
+217,0,2,0,56,0,1,0,29,0,21,0,45,0,47,0,50,0,67,0,68,0,84,0,132,0,145,0,146,
+0,147,0,148,0,152,0,153,0,157,0,159,0,201,0,215,0,216,0,217,0,218,0,222,0,
+223,0,228,0,230,1,97,1,144,1,175,1,182,0,4,0,0,0,1,0,8,0,1,0,46,0,2,0,10,
+0,28,0,2,0,6,0,12,0,209,0,2,0,128,0,250,0,2,0,129,0,2,0,6,0,12,0,229,0,2,
+0,128,1,14,0,2,0,129,0,1,0,2,0,28,0,48,0,6,0,0,0,1,0,8,0,2,0,20,0,108,2,152,
+3,50,0,4,0,0,3,72,3,122,3,140,0,1,0,42,0,56,0,57,0,58,0,64,0,203,0,234,0,
+236,0,240,0,242,0,244,0,245,0,246,0,247,0,249,0,250,0,251,0,252,0,253,0,254,
+1,6,1,8,1,10,1,14,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,26,1,28,1,29,1,55,
+1,84,1,91,1,99,1,102,1,108,1,155,1,170,1,176,0,2,0,92,0,200,0,200,0,2,0,201,
+0,201,0,1,0,202,0,202,0,2,0,204,0,204,0,1,0,205,0,206,0,3,0,207,0,208,0,2,
+0,210,0,213,0,3,0,214,0,214,0,1,0,216,0,216,0,2,0,217,0,217,0,1,0,218,0,218,
+0,2,0,219,0,220,0,1,0,221,0,222,0,2,0,225,0,225,0,2,0,226,0,226,0,3,0,227,
+0,227,0,2,0,228,0,228,0,1,0,229,0,229,0,2,0,230,0,230,0,1,0,231,0,231,0,3,
+0,232,0,232,0,2,0,233,0,233,0,3,0,235,0,235,0,1,0,237,0,237,0,1,0,238,0,239,
+0,3,0,241,0,241,0,1,0,243,0,243,0,1,0,248,0,248,0,2,1,0,1,0,0,1,1,1,1,2,0,
+2,1,5,1,5,0,3,1,12,1,13,0,1,1,24,1,24,0,1,1,30,1,32,0,1,1,34,1,35,0,2,1,38,
+1,39,0,1,1,42,1,43,0,1,1,45,1,45,0,3,1,46,1,46,0,2,1,49,1,49,0,2,1,53,1,53,
+0,2,1,54,1,54,0,3,1,56,1,56,0,3,1,58,1,59,0,2,1,61,1,61,0,1,1,63,1,63,0,3,
+1,65,1,65,0,2,1,68,1,68,0,2,1,77,1,78,0,3,1,81,1,83,0,1,1,88,1,88,0,3,1,89,
+1,90,0,2,1,92,1,92,0,1,1,93,1,93,0,2,1,94,1,95,0,1,1,96,1,96,0,2,1,97,1,98,
+0,1,1,105,1,105,0,1,1,109,1,109,0,2,1,111,1,111,0,3,1,112,1,112,0,1,1,113,
+1,114,0,2,1,116,1,116,0,1,1,118,1,118,0,1,1,122,1,122,0,2,1,123,1,123,0,1,
+1,126,1,126,0,1,1,127,1,127,0,2,1,128,1,130,0,1,1,135,1,136,0,1,1,140,1,140,
+0,1,1,141,1,141,0,2,1,142,1,144,0,1,1,147,1,147,0,1,1,149,1,150,0,1,1,153,
+1,153,0,1,1,154,1,154,0,2,1,158,1,158,0,1,1,162,1,162,0,1,1,167,1,167,0,1,
+1,169,1,169,0,2,1,171,1,171,0,1,1,172,1,173,0,2,1,177,1,177,0,1,1,180,1,180,
+0,1,1,182,1,182,0,1,1,183,1,183,0,3,1,184,1,184,0,2,1,185,1,185,0,1,1,186,
+1,186,0,3,1,187,1,187,0,1,1,189,1,189,0,3,0,2,0,25,0,56,0,58,0,1,0,64,0,64,
+0,1,0,203,0,203,0,2,0,234,0,234,0,2,0,236,0,236,0,2,0,240,0,240,0,3,0,242,
+0,242,0,3,0,244,0,247,0,3,0,249,0,254,0,3,1,6,1,6,0,3,1,8,1,8,0,3,1,10,1,
+10,0,3,1,14,1,14,0,3,1,17,1,23,0,3,1,26,1,26,0,3,1,28,1,29,0,3,1,55,1,55,
+0,3,1,84,1,84,0,3,1,91,1,91,0,3,1,99,1,99,0,3,1,102,1,102,0,3,1,108,1,108,
+0,3,1,155,1,155,0,3,1,170,1,170,0,3,1,176,1,176,0,3,0,2,0,3,0,56,0,59,0,1,
+0,64,0,64,0,1,0,72,0,73,0,1,0,3,0,8,0,22,0,36,0,1,0,1,0,1,0,0,0,1,0,0,0,24,
+0,1,0,2,0,1,0,0,0,1,0,0,0,25,0,1,0,3,0,1,0,0,0,1,0,0,0,26,0,1,0,4,0,0,0,1,
+0,1,0,1,0,1,0,0,0,21,0,1,0,4,0,0,0,1,0,1,0,1,0,1,0,0,0,22,0,1,0,0,0,1,0,8,
+0,1,0,6,0,1,0,1,0,3,0,203,0,234,0,236,0,2,0,0,0,1,0,8,0,1,1,32,0,35,0,76,
+0,82,0,88,0,94,0,100,0,106,0,112,0,118,0,124,0,130,0,136,0,142,0,148,0,154,
+0,160,0,166,0,172,0,178,0,184,0,190,0,196,0,202,0,208,0,214,0,220,0,226,0,
+232,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,26,0,2,0,137,0,209,0,2,0,131,0,
+41,0,2,0,133,0,41,0,2,0,134,0,41,0,2,0,135,0,41,0,2,0,136,0,41,0,2,0,138,
+0,41,0,2,0,139,0,41,0,2,0,140,0,41,0,2,0,141,0,41,0,2,0,142,0,41,0,2,0,143,
+0,41,0,2,0,151,0,41,0,2,0,153,0,41,0,2,0,155,0,41,0,2,0,158,0,41,0,2,0,161,
+0,41,0,2,0,162,0,41,0,2,0,177,0,41,0,2,0,178,0,41,0,2,0,190,0,41,0,2,0,163,
+0,41,0,2,0,164,0,41,0,2,0,130,0,210,0,2,0,130,1,0,0,2,0,130,0,215,0,3,0,135,
+0,136,0,41,0,2,0,145,1,0,0,2,0,147,1,3,0,2,0,149,0,216,0,2,0,149,0,212,0,
+2,0,149,1,0,0,2,0,156,0,212,0,2,0,158,0,210,0,2,0,159,1,0,0,1,0,35,0,240,
+0,242,0,244,0,245,0,246,0,247,0,249,0,250,0,251,0,252,0,253,0,254,1,6,1,8,
+1,10,1,14,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,26,1,28,1,29,1,55,1,84,1,91,
+1,99,1,102,1,108,1,155,1,170,1,176,0,4,0,0,0,1,0,8,0,1,0,38,0,2,0,10,0,20,
+0,1,0,4,1,207,0,2,0,56,0,2,0,6,0,12,1,208,0,2,1,250,1,221,0,2,1,251,0,1,0,
+2,0,215,0,216,0,1,0,0,0,1,0,8,0,2,0,14,0,4,1,246,1,247,1,248,1,249,0,1,0,
+4,0,56,0,57,0,58,0,64,0,1,0,0,0,1,0,8,0,2,0,14,0,4,1,250,1,251,1,252,1,253,
+0,1,0,4,0,56,0,57,0,58,0,64,0,1,0,0,0,1,0,8,0,2,0,14,0,4,1,254,1,255,2,0,
+2,1,0,1,0,4,0,56,0,57,0,58,0,64,0,6,0,0,0,1,0,8,0,2,0,16,0,24,0,196,0,206,
+0,2,0,0,0,214,0,1,0,2,0,56,0,57,0,2,0,28,0,23,0,23,0,1,0,24,0,24,0,2,0,25,
+0,25,0,1,0,29,0,29,0,2,0,30,0,31,0,1,0,32,0,32,0,2,0,34,0,34,0,2,0,42,0,42,
+0,2,0,50,0,50,0,2,1,25,1,25,0,1,1,27,1,27,0,1,1,51,1,51,0,2,1,52,1,52,0,1,
+1,67,1,67,0,1,1,70,1,70,0,2,1,71,1,72,0,1,1,73,1,73,0,2,1,79,1,79,0,1,1,100,
+1,101,0,1,1,110,1,110,0,2,1,115,1,115,0,2,1,145,1,145,0,2,1,146,1,146,0,1,
+1,156,1,156,0,2,1,157,1,157,0,1,1,164,1,164,0,1,1,174,1,174,0,2,1,187,1,187,
+0,2,0,1,0,56,0,2,0,1,0,1,0,1,0,1,0,1,0,1,0,2,0,6,0,20,0,1,0,1,0,1,0,0,0,1,
+0,0,0,28,0,1,0,2,0,1,0,0,0,1,0,0,0,29,0,1,0,0,0,1,0,8,0,1,0,6,1,204,0,1,0,
+2,0,56,0,57,0,1,0,0,0,1,0,8,0,1,0,6,1,206,0,1,0,2,0,56,0,57,0,6,0,0,0,1,0,
+8,0,2,0,16,0,28,0,68,0,84,0,2,0,0,0,92,0,1,0,4,0,55,1,230,1,231,1,232,0,2,
+0,6,0,30,0,30,0,1,0,211,0,211,0,1,0,252,0,252,0,1,1,71,1,71,0,1,1,100,1,100,
+0,1,1,164,1,164,0,1,0,2,0,2,0,55,0,55,0,1,1,230,1,232,0,1,0,1,0,1,0,1,0,1,
+0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,31,0,1,0,0,0,1,0,8,0,2,0,14,0,4,1,237,1,
+238,1,239,1,240,0,1,0,4,0,55,1,230,1,231,1,232,0,5,0,0,0,1,0,8,0,1,0,8,0,
+1,0,14,0,1,0,1,0,45,0,1,0,4,0,4,0,1,2,62,0,64,0,44,0,1,0,33,0,4,0,0,0,1,0,
+8,0,1,0,20,0,1,0,8,0,1,0,4,0,198,0,3,0,64,0,44,0,1,0,1,2,62,0,5,0,0,0,1,0,
+8,0,1,0,14,0,4,0,26,0,46,0,84,0,104,0,1,0,4,0,4,0,127,1,228,1,229,0,1,0,4,
+0,3,0,2,0,198,0,55,0,0,0,35,0,0,0,37,0,2,0,6,0,22,0,3,0,2,0,198,0,55,0,0,
+0,38,0,0,0,39,0,3,0,2,0,198,1,230,0,0,0,40,0,0,0,42,0,1,0,4,0,3,0,2,0,198,
+0,55,0,0,0,36,0,0,0,37,0,1,0,4,0,3,0,2,0,198,0,55,0,0,0,41,0,0,0,42,0,4,0,
+0,0,1,0,8,0,1,0,20,0,1,0,8,0,1,0,4,1,245,0,3,0,198,0,55,0,1,0,1,0,4,0,4,0,
+0,0,1,0,8,0,1,0,20,0,1,0,8,0,1,0,4,1,245,0,3,0,198,0,55,0,1,0,1,1,228,0,2,
+0,0,0,1,0,8,0,1,0,14,0,1,0,8,0,2,0,198,1,230,0,1,0,1,1,245,0,4,0,0,0,1,0,
+8,0,1,0,20,0,1,0,8,0,1,0,4,1,245,0,3,0,198,0,55,0,1,0,1,0,127,0,2,0,0,0,1,
+0,8,0,1,0,14,0,1,0,8,0,2,0,198,1,241,0,1,0,1,1,245,0,4,0,0,0,1,0,8,0,1,0,
+20,0,1,0,8,0,1,0,4,1,245,0,3,0,198,1,230,0,1,0,1,0,127,0,4,0,0,0,1,0,8,0,
+1,0,20,0,1,0,8,0,1,0,4,1,245,0,3,0,198,0,55,0,1,0,1,1,229,0,2,0,0,0,1,0,8,
+0,1,0,14,0,1,0,8,0,2,0,198,1,242,0,1,0,1,1,245,0,0,};
+#endif
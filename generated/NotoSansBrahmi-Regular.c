@@ -0,0 +1,962 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansBrahmi_Regular_ttf_size = 23660;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansBrahmi_Regular_ttf");
+asm(".type fz_font_NotoSansBrahmi_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansBrahmi_Regular_ttf, 23660");
+asm(".balign 64");
+asm("fz_font_NotoSansBrahmi_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansBrahmi-Regular.ttf\"");
+#else
+const int fz_font_NotoSansBrahmi_Regular_ttf_size = 23660;
+const char fz_font_NotoSansBrahmi_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,1,160,1,248,0,0,79,52,0,0,0,60,71,
+80,79,83,126,61,108,185,0,0,79,112,0,0,9,138,71,83,85,66,227,183,243,115,
+0,0,88,252,0,0,3,112,79,83,47,50,122,231,109,180,0,0,1,104,0,0,0,96,99,109,
+97,112,0,221,65,88,0,0,4,160,0,0,0,184,103,97,115,112,0,22,0,35,0,0,79,36,
+0,0,0,16,103,108,121,102,188,77,18,125,0,0,6,200,0,0,66,60,104,101,97,100,
+3,152,173,128,0,0,0,236,0,0,0,54,104,104,101,97,13,230,1,219,0,0,1,36,0,0,
+0,36,104,109,116,120,105,180,85,123,0,0,1,200,0,0,2,216,108,111,99,97,48,
+81,31,128,0,0,5,88,0,0,1,110,109,97,120,112,0,193,1,34,0,0,1,72,0,0,0,32,
+110,97,109,101,140,51,184,130,0,0,73,4,0,0,6,0,112,111,115,116,255,105,0,
+102,0,0,79,4,0,0,0,32,0,1,0,0,0,1,7,174,193,10,249,178,95,15,60,245,0,11,
+8,0,0,0,0,0,204,181,105,204,0,0,0,0,210,109,241,206,253,198,253,208,7,144,
+7,106,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,8,68,253,198,251,
+56,7,144,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,182,0,1,0,0,0,182,1,33,0,10,0,
+0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,75,1,144,0,5,0,0,5,154,5,
+51,0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,
+0,2,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,
+8,141,2,88,0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,3,4,0,0,129,0,0,0,0,4,20,
+0,0,2,20,0,0,1,118,0,20,1,38,0,20,1,38,0,20,4,106,0,60,5,128,0,160,4,190,
+0,160,5,24,0,160,4,90,0,200,5,24,0,200,3,255,0,200,3,255,0,200,4,226,0,120,
+5,112,0,120,4,153,0,160,4,210,0,160,5,69,0,100,5,69,0,100,4,218,0,100,4,218,
+0,100,6,8,0,160,4,223,0,160,5,69,0,100,5,158,0,200,4,59,0,200,4,86,0,160,
+4,224,0,130,4,8,0,160,4,192,0,200,5,45,0,100,3,247,0,160,6,140,0,160,3,226,
+0,160,4,205,0,130,4,78,0,100,4,255,0,60,6,140,0,160,3,178,0,200,4,222,0,200,
+4,78,0,100,4,223,0,200,4,156,0,200,6,47,0,200,7,28,0,200,5,150,0,160,6,116,
+0,130,2,152,0,240,5,220,0,100,4,18,0,130,5,69,0,60,4,223,0,200,7,6,0,160,
+5,220,0,200,7,233,0,100,4,168,0,130,4,52,0,130,5,5,0,100,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,253,198,
+0,0,253,218,0,0,0,0,0,0,0,0,0,0,0,0,2,194,1,24,3,238,1,24,4,46,1,44,4,46,
+1,44,7,178,0,100,7,42,0,100,7,120,0,60,6,38,0,200,6,38,0,200,6,84,0,198,6,
+88,0,200,4,222,1,44,4,212,0,180,4,196,0,180,4,210,0,180,3,241,0,200,8,68,
+0,180,6,158,0,180,6,227,0,0,6,95,0,140,5,119,0,109,4,100,0,180,4,252,0,180,
+7,254,0,180,6,174,0,180,6,28,0,60,4,152,0,180,3,6,1,4,6,27,0,100,5,45,0,180,
+4,228,0,180,6,97,0,160,6,42,0,120,4,202,0,180,5,114,0,180,4,38,0,130,5,159,
+0,177,5,158,0,200,5,158,0,200,4,59,0,200,4,59,0,200,4,86,0,160,4,86,0,160,
+4,224,0,130,4,224,0,130,4,190,0,160,5,191,0,50,5,191,0,50,4,8,0,160,4,8,0,
+160,6,192,0,50,6,192,0,50,5,45,0,100,5,45,0,100,3,247,0,160,3,247,0,160,6,
+140,0,35,6,140,0,35,6,140,0,160,6,140,0,160,4,205,0,130,4,205,0,130,4,78,
+0,100,4,78,0,100,6,140,0,35,6,140,0,35,6,140,0,160,6,140,0,160,5,202,0,50,
+5,202,0,50,4,78,0,100,4,78,0,100,4,223,0,200,4,223,0,200,4,156,0,200,4,156,
+0,200,7,151,0,50,7,151,0,50,6,47,0,200,6,47,0,200,7,190,0,50,7,190,0,50,5,
+150,0,160,5,150,0,160,6,116,0,130,6,116,0,130,5,220,0,100,5,220,0,100,4,18,
+0,130,4,18,0,130,4,223,0,200,4,223,0,200,7,6,0,160,7,6,0,160,5,220,0,200,
+5,220,0,200,7,233,0,100,7,233,0,100,6,206,0,50,6,206,0,50,4,102,0,50,4,102,
+0,50,6,132,0,50,6,132,0,50,5,5,0,100,5,5,0,100,0,0,0,0,0,0,0,2,0,3,0,1,0,
+0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,0,12,0,8,0,2,0,4,0,0,0,13,0,32,0,160,
+254,255,255,255,0,0,0,0,0,13,0,32,0,160,254,255,255,255,0,1,255,245,255,227,
+255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,100,0,0,0,0,0,0,0,7,
+0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,
+3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,254,255,0,0,254,255,0,0,0,1,0,1,16,0,0,
+1,16,77,0,0,0,4,0,1,16,82,0,1,16,111,0,0,0,82,0,0,0,21,0,21,0,21,0,21,0,43,
+0,65,0,102,0,134,0,207,0,247,1,36,1,90,1,159,1,174,1,195,1,226,2,16,2,79,
+2,146,2,167,2,193,2,212,2,236,3,4,3,39,3,59,3,99,3,117,3,150,3,204,3,253,
+4,30,4,63,4,98,4,152,4,171,4,224,4,248,5,14,5,84,5,119,5,154,5,173,5,209,
+5,251,6,16,6,40,6,111,6,157,6,169,6,207,6,253,7,25,7,67,7,116,7,152,7,204,
+8,7,8,52,8,87,8,100,8,116,8,132,8,152,8,164,8,183,8,218,9,12,9,70,9,132,9,
+146,9,166,9,186,9,211,9,224,9,237,10,1,10,15,10,35,10,48,10,103,11,245,12,
+3,12,23,12,49,12,73,12,104,12,170,12,214,13,0,13,43,13,109,13,164,13,210,
+14,3,14,46,14,65,14,113,14,172,14,239,15,43,15,97,15,120,15,153,15,198,16,
+2,16,63,16,124,16,171,16,223,16,252,17,46,17,95,17,155,17,178,17,206,17,248,
+18,41,18,113,18,203,19,11,19,79,19,153,19,209,20,15,20,56,20,102,20,146,20,
+195,20,238,21,31,21,105,21,184,21,250,22,70,22,140,22,219,22,247,23,24,23,
+114,23,209,24,35,24,127,24,172,24,222,24,244,25,15,25,59,25,114,25,168,25,
+230,26,0,26,31,26,59,26,92,26,174,27,3,27,82,27,170,27,235,28,53,28,100,28,
+157,28,225,29,45,29,96,29,157,29,221,30,39,30,82,30,136,30,201,31,19,31,98,
+31,184,31,243,32,56,32,107,32,163,32,211,33,8,33,30,0,0,0,2,0,129,0,0,3,129,
+6,102,0,3,0,7,0,0,19,33,17,33,37,17,33,17,129,3,0,253,0,2,127,254,0,6,102,
+249,154,129,5,102,250,154,0,1,0,20,3,216,1,18,4,238,0,11,0,0,19,52,54,51,
+50,22,21,20,6,35,34,38,20,63,62,63,66,68,61,59,66,4,99,66,73,72,67,64,75,
+74,0,1,0,20,6,84,1,18,7,106,0,11,0,0,19,52,54,51,50,22,21,20,6,35,34,38,20,
+63,62,63,66,68,61,59,66,6,223,66,73,72,67,64,75,74,0,2,0,20,255,227,1,18,
+4,238,0,11,0,23,0,0,55,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,
+21,20,6,35,34,38,20,65,60,61,68,68,61,59,66,63,62,63,66,68,61,59,66,111,66,
+71,71,66,65,75,74,4,54,66,73,72,67,64,75,74,0,3,0,60,0,0,4,46,4,148,0,5,0,
+8,0,11,0,0,1,1,33,1,1,33,37,33,3,53,19,33,1,201,254,133,3,203,254,133,1,144,
+252,14,1,46,1,149,201,183,254,144,2,87,2,61,253,195,253,169,156,1,64,246,
+1,38,0,5,0,160,255,232,4,224,4,172,0,13,0,19,0,25,0,31,0,37,0,0,1,16,0,33,
+34,38,2,53,16,0,33,50,22,18,5,20,23,19,3,6,5,52,39,3,19,54,1,19,38,35,34,
+7,19,22,51,50,55,3,4,224,254,223,254,252,160,245,134,1,33,1,2,162,246,133,
+252,120,58,195,198,55,2,208,57,197,195,59,254,154,189,80,114,110,78,4,77,
+111,106,81,186,2,76,254,225,254,187,149,1,20,187,1,30,1,66,147,254,235,184,
+172,109,1,20,1,24,106,169,166,108,254,233,254,238,110,1,31,1,22,50,47,252,
+222,47,48,1,18,0,1,0,160,0,0,3,246,5,182,0,25,0,0,1,35,34,6,6,21,21,35,53,
+52,18,55,38,2,53,53,51,21,20,22,51,51,17,51,17,35,3,62,17,131,217,121,184,
+168,142,137,153,184,234,195,37,184,184,2,147,141,246,144,128,132,183,1,61,
+89,67,1,3,163,252,248,182,217,2,135,250,74,0,1,0,160,0,0,4,240,5,182,0,29,
+0,0,1,35,17,35,17,35,34,6,6,21,21,35,53,52,18,55,38,2,53,53,51,21,20,22,51,
+51,17,51,17,51,4,240,250,184,17,131,217,121,184,168,142,137,153,184,234,195,
+37,184,250,2,147,253,109,2,147,141,246,144,128,132,183,1,61,89,67,1,3,163,
+252,248,182,217,2,135,253,121,0,3,0,200,255,227,3,146,4,238,0,11,0,23,0,35,
+0,0,55,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,
+1,52,54,51,50,22,21,20,6,35,34,38,200,65,60,61,68,68,61,59,66,63,62,63,66,
+68,61,59,66,1,204,63,62,63,66,68,61,59,66,111,66,71,71,66,65,75,74,4,54,66,
+73,72,67,64,75,74,254,70,66,73,72,67,64,75,74,0,0,4,0,200,255,227,4,80,5,
+2,0,11,0,23,0,35,0,47,0,0,55,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,
+50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,
+21,20,6,35,34,38,200,65,60,61,68,68,61,59,66,63,62,63,66,68,61,59,66,2,138,
+65,60,61,68,68,61,59,66,63,62,63,66,68,61,59,66,111,66,71,71,66,65,75,74,
+4,74,66,73,72,67,64,75,74,252,57,66,71,71,66,65,75,74,4,74,66,73,72,67,64,
+75,74,0,1,0,200,0,0,3,155,5,182,0,5,0,0,51,17,51,17,33,21,200,184,2,27,5,
+182,250,238,164,0,0,1,0,200,0,0,3,155,5,182,0,9,0,0,1,21,33,21,33,17,51,17,
+33,21,1,128,2,27,253,45,184,2,27,1,134,226,164,5,182,252,116,164,0,1,0,120,
+0,0,4,106,4,148,0,11,0,0,1,1,51,1,1,51,1,1,35,1,1,35,2,5,254,133,205,1,27,
+1,24,203,254,133,1,144,205,254,213,254,209,203,2,87,2,61,254,62,1,194,253,
+195,253,169,1,220,254,36,0,1,0,120,255,232,5,82,4,148,0,22,0,0,37,6,35,34,
+38,39,3,1,35,1,1,51,1,1,51,1,19,22,22,51,50,54,55,5,82,117,134,84,129,59,
+213,254,209,203,1,141,254,133,205,1,27,1,24,203,254,133,203,57,82,43,47,68,
+29,110,134,78,91,1,75,254,36,2,87,2,61,254,62,1,194,253,195,254,201,87,63,
+53,33,0,0,1,0,160,255,226,3,249,5,206,0,42,0,0,37,6,6,35,34,38,38,53,52,54,
+55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,16,3,14,2,21,
+20,22,51,50,55,55,3,247,82,164,112,87,112,60,85,127,104,108,121,104,123,130,
+15,181,18,244,196,192,225,217,57,97,64,38,44,94,74,36,212,133,109,69,111,
+63,67,148,150,123,241,124,112,136,120,116,62,57,24,63,74,188,226,219,186,
+254,249,254,249,69,119,104,47,42,42,111,50,0,0,1,0,160,255,226,4,150,5,206,
+0,46,0,0,37,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,21,20,7,23,7,39,14,3,21,20,22,51,50,55,55,3,247,82,164,
+112,87,112,60,85,127,104,108,121,104,123,130,15,181,18,244,196,192,225,83,
+240,95,228,46,96,78,49,38,44,94,74,36,212,133,109,69,111,63,67,148,150,123,
+241,124,112,136,120,116,62,57,24,63,74,188,226,219,186,163,162,164,134,165,
+65,112,100,89,41,42,42,111,50,0,2,0,100,0,0,4,225,5,192,0,3,0,6,0,0,1,51,
+1,33,55,33,1,2,70,185,1,226,251,131,252,2,130,254,192,5,192,250,64,164,4,
+49,0,2,0,100,0,0,4,225,5,182,0,5,0,8,0,0,19,33,1,33,1,33,19,33,1,213,2,42,
+1,226,251,131,1,172,254,197,139,2,130,254,192,5,182,250,74,5,18,251,146,4,
+39,0,0,1,0,100,0,0,4,118,5,182,0,7,0,0,1,17,33,21,33,17,33,53,2,91,2,27,253,
+45,254,193,5,182,250,238,164,5,18,164,0,1,0,100,0,0,4,118,5,182,0,11,0,0,
+1,17,33,21,33,21,33,21,33,17,33,53,2,91,2,27,253,229,2,27,253,45,254,193,
+5,182,252,116,164,226,164,5,18,164,0,1,0,160,0,0,5,104,5,182,0,11,0,0,33,
+17,33,53,33,17,51,17,33,21,33,17,2,168,253,248,2,8,184,2,8,253,248,2,170,
+162,2,106,253,150,162,253,86,0,0,1,0,160,0,0,4,23,5,206,0,21,0,0,19,53,52,
+54,54,51,50,22,22,21,17,35,17,52,38,38,35,34,6,6,21,21,160,91,196,163,158,
+191,88,184,47,109,98,99,115,51,3,177,6,208,217,110,109,222,209,252,78,3,184,
+160,138,64,68,142,153,6,0,1,0,100,0,0,4,225,5,182,0,6,0,0,1,51,1,35,1,1,35,
+2,70,185,1,226,205,254,142,254,141,203,5,182,250,74,4,203,251,53,0,1,0,200,
+255,232,4,254,5,182,0,24,0,0,1,21,20,6,6,35,34,38,38,53,17,51,17,20,22,22,
+23,17,51,17,62,2,53,53,4,254,116,242,193,187,231,109,184,51,115,97,184,102,
+111,50,2,55,56,212,220,103,113,225,202,3,178,252,72,134,142,75,8,1,154,254,
+104,11,73,141,133,56,0,1,0,200,0,0,3,155,5,182,0,7,0,0,51,17,33,21,33,17,
+33,21,200,2,211,253,229,2,27,5,182,164,251,146,164,0,0,2,0,160,0,0,3,142,
+5,182,0,10,0,18,0,0,33,33,34,38,53,52,36,33,51,17,51,3,34,6,6,21,20,22,51,
+3,142,254,248,231,255,1,13,1,23,18,184,184,152,152,67,186,185,179,158,190,
+179,2,244,252,104,35,83,79,96,85,0,3,0,130,255,232,4,94,5,182,0,16,0,23,0,
+30,0,0,19,52,18,55,17,51,17,22,18,21,20,6,6,35,34,38,38,37,52,38,39,17,54,
+54,37,20,22,23,17,6,6,130,229,173,184,173,229,132,229,133,134,229,131,3,36,
+122,96,97,121,253,148,122,96,98,120,1,198,178,1,6,30,2,26,253,230,30,254,
+249,177,130,222,126,128,222,132,104,164,30,253,164,32,170,104,102,172,31,
+2,90,31,165,0,1,0,160,0,0,3,134,5,182,0,34,0,0,33,35,34,38,38,53,52,54,55,
+38,38,53,52,54,54,51,51,21,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,
+51,3,134,247,153,223,119,109,97,98,108,127,233,155,227,242,139,166,183,196,
+130,130,190,189,157,137,253,96,175,113,120,182,52,51,173,116,109,177,98,164,
+118,103,136,121,164,131,140,105,116,0,0,1,0,200,0,0,4,32,5,182,0,19,0,0,51,
+17,51,17,22,22,51,50,54,53,17,51,17,20,6,35,34,38,39,17,200,184,42,126,74,
+135,111,184,208,200,75,140,49,5,182,253,190,36,50,126,139,1,143,254,78,210,
+191,37,33,253,71,0,0,1,0,100,0,0,4,141,5,182,0,19,0,0,1,17,54,51,50,22,21,
+17,35,53,52,38,35,34,7,17,35,17,33,53,2,91,75,79,200,208,184,112,134,73,59,
+184,254,193,5,182,254,62,23,191,210,254,227,250,139,126,19,252,179,5,18,164,
+0,1,0,160,0,0,3,127,5,182,0,17,0,0,33,35,32,0,17,16,0,33,51,21,35,34,0,17,
+16,0,51,51,3,127,63,254,184,254,168,1,115,1,75,33,35,240,254,246,1,3,245,
+37,1,122,1,99,1,85,1,132,164,254,214,254,243,254,240,254,217,0,0,2,0,160,
+0,56,5,236,5,132,0,15,0,31,0,0,1,20,22,22,51,50,54,54,53,52,38,38,35,34,6,
+6,7,52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,1,99,127,223,133,131,225,127,
+127,224,132,133,222,128,195,174,1,57,191,191,1,58,173,174,254,200,192,192,
+254,200,174,2,223,137,234,136,136,233,138,136,234,135,134,235,137,187,1,57,
+178,178,254,198,186,187,254,199,178,178,1,56,0,1,0,160,0,0,3,66,5,182,0,7,
+0,0,1,17,35,17,33,17,51,17,1,88,184,1,234,184,2,168,253,88,3,76,2,106,252,
+242,0,1,0,130,255,232,4,75,5,182,0,35,0,0,1,54,54,51,50,22,21,20,4,35,34,
+38,38,53,52,54,54,55,17,51,17,35,34,6,21,20,22,51,50,54,53,52,38,35,34,7,
+1,242,35,152,119,133,162,255,0,229,136,224,124,104,191,118,184,92,130,180,
+164,146,130,150,54,43,105,44,1,142,96,118,153,128,169,186,118,207,128,115,
+199,133,20,2,54,253,48,181,128,133,152,93,90,60,59,132,0,1,0,100,0,0,3,234,
+5,182,0,11,0,0,1,21,33,17,33,21,33,53,33,17,33,53,3,234,254,153,1,103,252,
+122,1,103,254,153,5,182,164,251,146,164,164,4,110,164,0,1,0,60,0,0,4,195,
+5,182,0,8,0,0,33,35,1,17,51,17,1,35,1,1,5,201,1,231,185,1,231,198,254,131,
+3,135,2,47,253,201,252,129,2,207,0,3,0,160,0,56,5,236,5,132,0,15,0,31,0,43,
+0,0,1,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,7,52,18,36,51,50,4,18,21,
+20,2,4,35,34,36,2,37,52,54,51,50,22,21,20,6,35,34,38,1,99,127,223,133,131,
+225,127,127,224,132,133,222,128,195,174,1,57,191,191,1,58,173,174,254,200,
+192,192,254,200,174,2,39,63,62,63,66,68,61,59,66,2,223,137,234,136,136,233,
+138,136,234,135,134,235,137,187,1,57,178,178,254,198,186,187,254,199,178,
+178,1,56,195,66,73,72,67,64,75,74,0,1,0,200,0,0,3,18,5,182,0,20,0,0,1,22,
+18,21,20,6,7,21,35,17,51,50,54,54,53,52,38,35,35,17,51,1,128,177,225,223,
+179,184,64,92,156,90,189,149,64,184,4,130,15,255,0,189,178,251,22,243,1,131,
+78,143,90,137,175,1,196,0,0,2,0,200,0,0,4,62,5,182,0,8,0,16,0,0,51,17,51,
+32,0,17,16,0,33,39,51,50,0,17,16,0,35,200,184,1,74,1,116,254,168,254,184,
+30,4,244,1,4,254,245,241,5,182,254,124,254,171,254,157,254,134,164,1,38,1,
+17,1,12,1,43,0,1,0,100,0,0,3,234,5,182,0,7,0,0,1,17,33,21,33,53,33,17,2,131,
+1,103,252,122,1,103,5,182,250,238,164,164,5,18,0,1,0,200,255,232,4,63,5,182,
+0,21,0,0,1,21,20,6,6,35,34,38,38,53,17,51,17,20,22,22,51,50,54,54,53,53,4,
+63,91,196,163,159,190,88,184,47,109,98,99,114,52,2,5,6,208,217,110,109,221,
+210,3,178,252,72,160,138,64,69,140,154,6,0,0,1,0,200,255,232,4,26,5,182,0,
+26,0,0,1,54,51,50,22,21,20,6,6,35,34,38,53,17,51,17,20,22,22,51,50,17,52,
+38,35,34,7,1,211,82,89,188,224,106,197,132,214,201,184,47,101,83,241,111,
+88,57,57,3,16,35,220,179,126,202,116,230,235,3,253,252,3,116,119,58,1,14,
+101,128,17,0,0,2,0,200,0,144,5,103,5,56,0,3,0,7,0,0,55,17,33,17,37,33,17,
+33,200,4,159,252,25,3,47,252,209,144,4,168,251,88,164,3,96,0,0,1,0,200,0,
+0,6,164,5,182,0,11,0,0,33,17,33,17,35,17,33,17,51,17,33,17,4,135,252,249,
+184,5,36,184,254,155,3,93,252,163,4,1,1,181,253,167,252,163,0,2,0,160,255,
+232,4,246,5,182,0,36,0,48,0,0,1,20,30,2,23,62,3,53,53,51,21,20,14,2,7,22,
+22,21,20,6,35,34,38,53,52,54,55,46,2,53,53,51,1,6,6,21,20,22,51,50,54,53,
+52,38,1,88,62,104,134,71,71,134,103,63,184,41,79,135,140,147,130,229,212,
+208,224,134,144,164,153,80,184,1,118,124,121,127,111,117,129,116,5,100,95,
+140,108,88,44,44,88,108,140,95,82,82,89,149,125,123,85,97,221,134,182,199,
+200,181,137,219,93,98,157,193,126,82,253,22,77,170,104,110,107,106,111,104,
+169,0,0,1,0,130,255,232,5,242,5,182,0,31,0,0,1,21,20,22,51,50,54,53,17,51,
+17,20,22,22,51,50,54,53,53,51,21,20,6,35,34,39,6,35,34,38,53,53,1,58,90,116,
+120,94,184,43,88,83,116,90,184,192,209,205,90,91,204,208,193,2,3,69,166,132,
+130,148,4,12,251,244,103,121,54,132,166,69,69,252,218,109,109,217,253,69,
+0,1,0,240,0,0,1,168,5,182,0,3,0,0,51,17,51,17,240,184,5,182,250,74,0,1,0,
+100,255,232,5,20,5,182,0,22,0,0,1,20,22,22,51,50,54,54,53,17,51,17,20,6,6,
+35,34,38,38,39,33,53,33,2,84,52,116,98,96,110,48,184,89,192,156,139,186,101,
+17,254,192,1,240,2,3,154,141,70,68,138,158,3,180,252,82,210,223,111,83,160,
+140,164,0,2,0,130,255,232,3,144,5,182,0,16,0,28,0,0,19,52,54,55,17,51,17,
+22,22,21,20,6,6,35,34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,130,165,134,
+184,134,165,103,184,104,105,183,103,184,119,88,87,120,118,89,89,118,1,95,
+130,204,31,2,234,253,23,31,204,131,102,172,101,101,172,102,87,126,125,88,
+89,125,125,0,0,1,0,60,0,0,5,9,5,182,0,11,0,0,33,17,7,1,35,1,51,1,35,1,39,
+17,2,80,42,254,215,193,2,15,175,2,15,195,254,219,50,4,76,176,252,100,5,182,
+250,74,3,144,209,251,159,0,0,1,0,200,255,232,4,63,5,182,0,25,0,0,1,21,20,
+6,6,35,34,38,38,53,17,51,17,37,23,5,21,20,22,22,51,50,54,54,53,53,4,63,91,
+196,163,159,190,88,184,2,8,50,253,198,47,109,98,99,114,52,2,5,6,208,217,110,
+109,221,210,3,178,253,224,170,154,186,238,160,138,64,69,140,154,6,0,1,0,160,
+255,232,6,132,5,182,0,32,0,0,1,21,20,6,6,35,34,2,17,53,38,35,34,6,21,17,35,
+17,52,54,51,50,23,17,51,17,20,22,51,50,54,53,53,6,132,101,211,168,242,225,
+56,75,135,111,184,208,200,78,75,184,132,152,153,142,2,5,6,192,226,117,1,2,
+1,26,30,18,126,139,254,213,1,78,210,191,23,2,238,252,72,202,160,168,195,6,
+0,1,0,200,255,232,5,120,5,182,0,20,0,0,1,33,6,6,35,34,38,38,53,17,51,17,20,
+22,22,51,50,54,54,53,33,5,120,254,192,22,214,207,159,190,88,184,47,109,98,
+100,114,52,1,240,1,103,202,181,109,221,210,3,178,252,72,160,138,64,70,147,
+158,0,0,1,0,100,255,232,7,73,5,182,0,34,0,0,1,54,51,50,22,21,17,35,17,52,
+38,35,34,7,21,20,6,6,35,34,38,39,33,53,33,20,22,22,51,50,54,54,53,17,51,5,
+20,75,82,200,208,184,112,134,78,57,89,191,157,206,215,22,254,192,1,240,51,
+115,100,98,109,47,184,2,199,24,191,210,254,178,1,43,139,126,20,28,210,221,
+109,181,202,164,155,149,71,64,138,160,3,184,0,3,0,130,0,0,4,68,5,202,0,20,
+0,27,0,34,0,0,19,52,54,54,51,50,22,22,21,20,6,7,17,33,17,35,17,33,53,38,38,
+37,52,38,39,17,54,54,37,20,22,23,17,6,6,250,112,198,111,113,196,112,187,142,
+254,63,184,1,193,141,188,2,155,88,72,74,86,254,20,86,74,72,88,4,53,111,186,
+108,108,186,111,146,219,30,254,196,254,146,2,18,152,30,218,146,84,125,26,
+254,45,26,125,81,81,125,26,1,211,25,127,0,0,1,0,130,0,0,3,108,5,182,0,31,
+0,0,33,35,17,38,35,34,6,21,21,35,17,52,54,51,50,23,53,38,38,53,52,54,51,51,
+21,35,34,6,21,20,51,51,3,108,184,59,73,138,108,184,197,211,77,77,182,196,
+203,183,176,172,109,97,206,172,1,229,19,120,135,249,1,28,200,191,23,234,2,
+143,134,150,147,164,59,74,115,0,0,1,0,100,0,0,4,101,5,206,0,21,0,0,1,53,52,
+38,35,34,6,21,17,33,21,33,53,51,17,52,54,51,50,22,21,21,3,173,90,116,120,
+94,2,91,252,0,237,183,204,208,193,3,219,29,166,132,133,163,252,168,162,162,
+3,82,254,220,217,253,29,0,0,1,0,0,5,18,2,58,5,182,0,3,0,0,17,33,21,33,2,58,
+253,198,5,182,164,0,0,1,0,0,5,18,2,73,6,183,0,5,0,0,17,33,17,35,17,33,2,73,
+174,254,101,6,183,254,91,1,1,0,0,1,0,0,5,18,2,73,6,183,0,5,0,0,17,33,17,51,
+17,33,1,155,174,253,183,5,182,1,1,254,91,0,0,1,0,0,5,18,2,134,6,183,0,9,0,
+0,17,53,51,17,51,17,51,17,51,17,162,174,136,174,5,18,164,1,1,254,255,1,1,
+254,91,0,0,1,0,0,0,0,2,38,0,164,0,3,0,0,53,33,21,33,2,38,253,218,164,164,
+0,2,0,0,254,192,2,38,0,164,0,3,0,7,0,0,21,33,21,33,17,33,21,33,2,38,253,218,
+2,38,253,218,156,164,1,228,164,0,0,1,0,0,253,208,1,180,0,10,0,21,0,0,1,6,
+35,34,38,53,52,54,51,50,23,21,38,35,34,6,21,20,22,51,50,55,1,152,45,51,146,
+166,160,120,98,58,56,78,62,87,93,66,46,28,253,223,15,153,136,120,161,26,135,
+19,78,61,64,83,10,0,0,1,0,0,253,208,2,84,0,10,0,32,0,0,1,6,35,34,38,53,52,
+54,51,50,23,21,38,39,22,22,51,50,55,23,6,35,34,38,39,6,6,21,20,22,51,50,55,
+1,152,45,51,146,166,160,120,98,58,24,27,5,52,58,46,28,22,45,51,137,125,6,
+37,42,93,66,46,28,253,223,15,153,136,120,161,26,135,8,5,48,37,10,137,15,112,
+106,17,66,41,64,83,10,0,1,0,0,253,208,4,38,0,10,0,39,0,0,5,22,21,20,6,35,
+34,38,39,38,38,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,51,50,23,
+22,22,51,50,54,53,52,38,39,3,204,90,115,99,73,134,74,77,123,65,62,87,93,66,
+46,28,22,45,51,146,166,164,129,190,146,90,82,43,29,36,35,26,68,61,140,90,
+111,83,86,89,80,78,61,64,83,10,137,15,153,136,125,156,169,104,65,34,35,26,
+62,20,0,0,1,0,0,253,208,4,38,0,12,0,42,0,0,5,22,21,20,6,35,34,38,39,38,38,
+35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,51,50,23,55,23,7,22,22,51,
+50,54,53,52,38,39,3,204,90,115,99,73,134,74,77,123,65,62,87,93,66,46,28,22,
+45,51,146,166,164,129,162,133,101,106,114,40,77,46,29,36,35,26,68,61,140,
+90,111,83,86,89,80,78,61,64,83,10,137,15,153,136,125,156,128,130,82,148,45,
+65,34,35,26,62,20,0,1,253,198,5,18,0,0,5,182,0,3,0,0,1,33,21,33,253,198,2,
+58,253,198,5,182,164,0,0,2,253,218,5,18,0,0,6,254,0,3,0,7,0,0,1,33,21,33,
+17,33,21,33,253,218,2,38,253,218,2,38,253,218,5,182,164,1,236,164,0,2,0,0,
+4,110,4,200,5,182,0,3,0,7,0,0,17,33,21,33,1,33,21,33,2,58,253,198,2,142,2,
+58,253,198,5,18,164,1,72,164,0,3,0,0,3,202,4,200,5,182,0,3,0,7,0,11,0,0,17,
+33,21,33,17,33,21,41,2,21,33,2,58,253,198,2,58,253,198,2,142,2,58,253,198,
+4,110,164,1,236,164,164,0,1,0,0,6,104,2,82,7,12,0,3,0,0,17,33,21,33,2,82,
+253,174,7,12,164,0,0,1,1,24,0,0,1,170,6,154,0,3,0,0,1,51,17,35,1,24,146,146,
+6,154,249,102,0,2,1,24,0,0,2,214,6,154,0,3,0,7,0,0,1,51,17,35,1,51,17,35,
+1,24,146,146,1,44,146,146,6,154,249,102,6,154,249,102,0,1,1,44,2,168,3,2,
+3,76,0,3,0,0,1,33,21,33,1,44,1,214,254,42,3,76,164,0,0,2,1,44,2,4,3,2,3,240,
+0,3,0,7,0,0,1,33,21,33,21,33,21,33,1,44,1,214,254,42,1,214,254,42,3,240,164,
+164,164,0,0,1,0,100,2,168,7,78,3,76,0,3,0,0,19,33,21,33,100,6,234,249,22,
+3,76,164,0,1,0,100,255,236,6,198,5,205,0,28,0,0,1,18,33,50,18,19,33,53,33,
+2,33,32,7,39,54,36,51,32,0,19,33,21,33,2,0,33,34,36,39,1,64,103,1,82,225,
+242,11,251,141,4,111,47,254,87,254,229,119,179,80,1,39,206,1,34,1,92,29,1,
+48,254,211,12,254,157,254,207,240,254,194,69,1,190,254,205,1,18,1,13,162,
+1,223,209,62,149,160,254,177,254,206,162,254,182,254,140,216,207,0,10,0,60,
+255,63,7,60,6,72,0,64,0,184,0,196,0,208,0,220,0,232,0,246,1,4,1,18,1,32,0,
+0,1,50,23,54,54,55,22,22,23,54,51,50,30,2,51,23,20,7,30,2,23,14,5,7,22,21,
+7,6,6,35,34,39,6,6,7,38,38,39,6,35,34,38,39,39,52,55,38,38,39,54,54,55,38,
+53,55,50,62,2,1,54,54,53,52,38,39,6,6,21,20,22,23,7,38,39,38,38,35,34,7,6,
+21,20,22,23,22,22,23,7,38,39,38,35,34,6,7,22,22,51,50,54,55,23,6,7,7,6,6,
+21,20,23,22,51,50,54,55,54,55,23,6,6,21,20,22,23,54,54,53,52,38,39,55,23,
+23,30,2,51,50,55,54,53,52,38,39,39,38,39,55,22,22,51,50,54,55,38,38,35,34,
+7,6,7,39,54,54,55,54,54,53,52,39,38,35,34,6,6,7,6,7,7,52,54,51,50,22,21,20,
+6,35,34,38,21,52,54,51,50,22,21,20,6,35,34,38,55,50,22,21,20,6,35,34,38,53,
+52,54,35,50,22,21,20,6,35,34,38,53,52,54,37,50,23,22,21,20,6,6,35,34,53,52,
+54,54,7,50,23,22,21,20,6,6,35,39,38,53,52,54,55,20,7,7,34,38,38,53,52,55,
+55,50,22,22,23,20,35,34,38,38,53,52,55,54,51,50,22,22,1,213,147,88,26,155,
+71,41,173,39,81,152,26,50,41,29,5,5,30,33,100,124,27,4,30,44,56,60,61,26,
+27,5,10,114,27,152,81,28,179,46,77,156,22,116,116,31,109,10,5,27,58,191,32,
+54,170,60,30,5,5,29,41,49,2,75,52,58,124,60,56,129,58,52,66,83,33,36,138,
+51,50,37,6,22,16,34,165,70,15,170,54,52,13,32,160,36,43,154,31,41,153,76,
+47,182,86,14,15,23,6,33,54,58,146,21,21,95,66,52,58,126,59,61,123,59,51,66,
+37,62,23,38,111,71,54,33,5,22,15,14,98,170,46,85,147,39,32,155,41,41,155,
+32,13,52,54,170,16,70,166,34,15,22,5,38,49,62,106,50,25,27,72,171,17,14,13,
+19,18,14,14,17,17,14,13,19,18,14,14,17,179,44,71,69,46,47,66,66,250,44,71,
+69,46,47,66,66,1,110,5,3,4,62,69,19,11,56,74,183,6,3,3,61,70,20,7,4,118,43,
+3,8,19,74,57,4,7,19,77,54,203,12,20,70,60,3,3,6,18,67,65,5,70,23,57,167,57,
+18,199,68,27,2,2,2,148,156,79,14,80,127,33,4,34,47,56,53,45,12,85,152,147,
+2,5,27,52,212,21,61,173,53,29,5,2,147,152,85,26,182,43,67,160,27,79,156,148,
+2,2,2,254,176,90,143,37,33,153,42,38,158,32,33,148,89,45,166,105,18,25,6,
+27,55,66,128,16,31,66,15,82,63,25,13,132,52,61,123,64,46,67,91,24,11,15,138,
+68,54,27,7,25,15,74,201,45,88,149,34,31,157,40,43,154,31,37,146,88,45,80,
+139,48,28,20,7,30,51,76,131,14,11,30,85,67,50,60,126,58,55,129,13,25,63,82,
+14,67,31,15,122,73,52,30,6,16,25,54,67,152,113,44,71,69,46,47,66,66,250,44,
+71,69,46,48,65,65,228,17,14,13,19,18,14,13,18,17,14,13,19,18,14,13,18,165,
+4,4,6,21,84,54,12,20,79,62,218,4,3,7,22,83,54,2,3,7,32,126,60,7,3,2,61,79,
+19,7,3,4,65,77,237,12,55,83,21,7,3,4,56,84,0,1,0,200,2,104,5,94,3,12,0,3,
+0,0,1,33,53,33,5,94,251,106,4,150,2,104,164,0,0,2,0,200,1,159,5,94,3,211,
+0,3,0,7,0,0,1,33,53,33,17,33,53,33,5,94,251,106,4,150,251,106,4,150,3,47,
+164,253,204,164,0,3,0,198,0,216,5,92,4,156,0,3,0,7,0,11,0,0,1,33,53,33,53,
+33,53,33,17,33,53,33,5,92,251,106,4,150,251,106,4,150,251,106,4,150,2,104,
+164,236,164,252,60,164,0,1,0,200,0,74,5,144,5,18,0,11,0,0,37,17,33,53,33,
+17,51,17,33,21,33,17,2,208,253,248,2,8,184,2,8,253,248,74,2,30,164,2,6,253,
+250,164,253,226,0,1,1,44,0,0,4,22,5,182,0,17,0,0,1,17,54,51,50,22,21,17,35,
+53,52,38,35,34,7,17,35,17,1,228,75,79,200,208,184,112,134,73,59,184,5,182,
+254,62,23,191,210,254,227,250,139,126,19,252,179,5,182,0,0,1,0,180,255,236,
+4,32,5,201,0,43,0,0,1,38,38,35,34,6,21,20,22,22,23,23,21,39,38,35,34,6,21,
+20,22,33,50,55,21,6,35,32,36,53,52,54,55,38,38,53,52,54,54,51,50,22,22,23,
+3,125,65,134,85,91,116,70,121,75,98,98,37,26,99,141,226,1,1,102,106,113,106,
+254,176,254,191,118,107,108,81,99,176,118,96,146,112,81,4,182,57,54,105,85,
+77,116,78,14,20,164,20,7,130,95,158,158,14,166,12,231,234,104,167,47,80,162,
+119,89,168,100,40,66,81,0,0,1,0,180,0,0,4,16,5,206,0,26,0,0,51,1,18,18,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,6,7,3,184,1,2,224,188,
+128,104,123,133,15,183,18,244,198,193,225,87,150,183,216,1,63,1,13,1,93,139,
+110,136,118,116,62,57,24,63,74,185,219,222,183,113,231,241,227,254,243,0,
+0,1,0,180,0,0,4,30,5,182,0,25,0,0,1,20,22,51,51,50,22,21,20,6,7,3,35,1,54,
+54,53,52,38,35,35,34,38,53,17,51,1,108,105,131,199,117,138,94,143,217,219,
+1,32,112,87,57,45,188,208,190,184,4,188,143,119,130,107,89,177,178,254,243,
+1,101,137,149,52,43,50,186,203,1,29,0,0,1,0,200,0,0,3,61,5,182,0,27,0,0,19,
+51,50,22,21,20,14,2,7,6,6,21,17,35,17,52,54,54,55,62,2,53,52,38,35,35,200,
+216,202,211,37,62,89,100,69,65,184,41,76,94,92,76,42,122,129,193,5,182,147,
+146,85,120,86,64,54,37,93,65,253,203,2,118,55,84,67,51,50,69,85,57,82,68,
+0,2,0,180,255,226,7,144,4,106,0,28,0,40,0,0,37,34,38,39,6,4,35,34,36,2,53,
+52,18,36,51,50,4,23,54,54,51,21,34,6,21,20,22,22,51,1,20,4,51,50,36,53,52,
+36,35,34,4,7,144,160,235,72,85,254,199,208,199,254,199,171,168,1,57,209,206,
+1,57,81,73,236,156,177,203,91,170,119,249,223,1,6,240,238,1,7,254,245,237,
+236,254,249,50,100,90,131,139,144,1,9,172,175,1,8,140,147,128,92,101,162,
+182,159,98,151,84,1,83,197,220,219,198,200,215,215,0,3,0,180,255,236,5,234,
+5,205,0,11,0,18,0,24,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,50,18,19,33,18,
+18,19,34,6,7,33,2,5,234,254,162,254,196,254,191,254,165,1,91,1,67,1,60,1,
+92,253,102,225,242,11,252,65,11,246,226,214,243,22,3,183,47,2,221,254,156,
+254,115,1,134,1,109,1,106,1,132,254,116,252,74,1,18,1,13,254,245,254,236,
+4,160,244,235,1,223,0,0,1,0,0,255,36,6,47,5,18,0,27,0,0,1,33,22,21,20,6,6,
+7,4,6,6,21,35,52,54,54,55,62,2,53,52,38,38,39,33,53,33,6,47,253,235,204,118,
+232,184,254,244,175,91,186,115,221,198,232,201,101,72,129,82,254,247,4,39,
+4,110,160,252,117,189,143,71,105,107,130,80,118,186,136,75,87,120,152,97,
+69,152,127,35,164,0,1,0,140,255,36,5,251,5,18,0,29,0,0,5,52,46,2,35,35,39,
+1,7,32,36,53,51,20,22,22,51,50,54,55,55,51,1,51,50,4,22,22,21,5,43,69,141,
+241,251,121,93,1,219,97,254,197,254,182,186,92,203,203,99,115,48,235,210,
+252,125,114,225,1,21,173,88,220,117,157,93,42,164,1,236,5,229,229,102,130,
+62,22,29,243,252,79,69,138,218,148,0,1,0,109,255,16,4,186,5,18,0,26,0,0,1,
+14,7,35,34,38,53,52,55,23,6,21,20,33,50,54,18,19,33,53,33,4,186,6,14,25,39,
+65,93,131,173,113,199,243,18,183,15,1,0,165,189,104,26,253,10,3,165,4,133,
+113,240,239,230,205,174,125,71,219,185,74,63,24,57,62,226,218,1,233,1,239,
+164,0,0,1,0,180,0,74,3,116,5,18,0,7,0,0,37,17,33,53,33,17,51,17,2,188,253,
+248,2,8,184,74,2,30,164,2,6,251,56,0,0,1,0,180,255,16,4,72,5,18,0,25,0,0,
+1,1,22,22,21,20,2,7,39,54,53,52,39,1,39,1,36,3,51,22,22,51,50,54,55,55,4,
+72,254,157,120,145,126,121,147,209,172,254,193,150,2,9,254,149,33,187,12,
+136,101,22,42,6,134,4,187,253,194,49,210,118,129,255,0,115,87,215,187,163,
+76,253,251,88,3,76,31,1,108,105,127,9,7,216,0,3,0,180,255,236,7,74,4,106,
+0,15,0,22,0,29,0,0,1,20,6,4,35,34,36,2,53,52,18,36,51,50,4,18,5,20,4,5,17,
+4,4,5,52,36,37,17,36,36,7,74,194,254,116,254,252,254,121,199,207,1,136,245,
+243,1,137,206,250,36,1,44,1,9,254,242,254,217,5,34,254,218,254,241,1,7,1,
+46,2,39,170,255,146,146,1,0,169,174,1,4,145,145,254,252,174,174,213,17,3,
+48,17,214,181,178,214,20,252,208,17,215,0,5,0,180,255,236,5,250,5,205,0,11,
+0,16,0,21,0,26,0,31,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,54,18,55,33,33,22,
+18,23,17,37,38,38,39,17,3,6,6,7,33,5,250,254,157,254,193,254,189,254,159,
+1,95,1,71,1,62,1,98,253,185,183,202,11,254,116,253,187,10,202,185,2,64,21,
+200,171,184,178,195,20,1,137,2,221,254,161,254,110,1,139,1,104,1,101,1,137,
+254,113,252,83,25,1,16,240,234,254,237,28,2,25,162,210,240,23,254,39,1,216,
+26,245,201,0,1,0,60,0,0,5,104,5,206,0,37,0,0,19,54,54,51,50,23,54,54,51,50,
+22,21,20,6,6,7,3,35,1,18,18,53,52,38,35,34,6,7,7,54,55,54,53,52,38,35,34,
+7,60,63,169,95,160,76,57,179,107,193,225,87,150,183,216,220,1,2,224,188,128,
+104,124,148,3,185,2,6,5,82,60,110,79,4,220,70,86,70,72,84,222,183,113,231,
+241,227,254,243,1,63,1,13,1,93,139,110,136,164,130,19,34,36,33,35,39,50,96,
+0,0,2,0,180,255,236,3,228,5,202,0,19,0,32,0,0,55,54,0,55,6,35,34,38,53,52,
+54,54,51,50,22,21,20,2,0,7,1,52,38,35,34,6,21,20,22,51,50,55,54,180,251,1,
+27,54,91,44,160,150,91,162,108,157,155,181,254,163,243,2,75,65,75,82,85,57,
+70,55,117,8,131,156,1,75,195,16,141,169,99,176,100,179,189,222,254,89,254,
+150,127,4,139,90,83,113,111,69,60,21,76,0,0,1,1,4,2,108,2,2,3,129,0,11,0,
+0,1,52,54,51,50,22,21,20,6,35,34,38,1,4,65,60,61,68,68,61,59,66,2,248,66,
+71,71,66,65,75,74,0,0,1,0,100,255,247,5,183,5,203,0,18,0,0,19,30,7,23,7,46,
+2,37,39,38,38,39,243,19,115,166,200,209,202,168,119,22,171,22,135,209,255,
+0,204,176,180,10,5,203,74,157,165,173,179,186,191,197,100,70,105,213,223,
+221,175,150,235,93,0,1,0,180,255,246,4,171,5,203,0,25,0,0,19,54,54,51,50,
+22,21,16,7,22,0,23,7,38,2,36,39,53,54,54,53,52,38,35,34,7,180,48,157,93,162,
+181,237,239,1,65,51,151,29,225,254,189,169,157,181,94,70,110,61,5,40,76,87,
+160,143,254,253,160,104,254,135,230,60,151,1,54,206,26,95,52,218,135,63,83,
+119,0,0,1,0,180,255,236,4,48,5,203,0,39,0,0,19,62,2,51,50,22,22,21,20,6,7,
+22,21,20,7,22,22,23,7,38,0,39,53,36,53,52,38,35,35,53,51,50,54,53,52,35,34,
+6,7,180,51,75,94,66,94,133,71,47,57,136,179,167,225,63,154,75,254,163,223,
+1,84,93,91,64,64,69,83,119,56,76,33,5,80,51,45,27,64,109,62,73,104,42,72,
+150,185,80,78,246,178,60,208,1,17,24,106,43,162,63,67,150,78,64,111,38,38,
+0,0,2,0,160,0,225,5,253,5,202,0,25,0,37,0,0,1,30,2,23,4,22,22,23,7,38,39,
+6,6,35,34,38,38,53,52,54,55,38,38,53,55,1,52,38,35,34,6,21,20,22,51,50,54,
+1,64,5,113,212,177,1,10,222,166,52,156,93,218,14,214,175,131,179,94,128,114,
+186,155,3,2,208,111,109,109,110,116,103,104,116,5,202,130,213,161,85,130,
+147,179,108,104,206,148,143,158,85,151,96,95,144,35,107,240,153,57,252,182,
+71,84,84,71,80,87,87,0,1,0,120,255,249,5,158,5,182,0,39,0,0,1,30,2,23,30,
+2,21,21,7,7,55,52,2,3,39,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,
+53,52,39,38,53,3,102,8,61,92,140,113,101,53,1,186,2,126,188,89,55,165,106,
+193,211,131,103,61,64,46,116,103,97,123,31,31,5,182,86,179,188,241,195,222,
+198,94,23,23,20,46,144,1,72,1,56,154,69,73,176,156,101,159,32,141,31,71,60,
+80,87,103,84,32,95,94,64,0,1,0,180,255,231,4,22,5,182,0,27,0,0,1,6,6,21,20,
+22,51,50,54,53,52,2,0,39,51,0,0,21,20,6,6,35,34,38,53,52,54,55,1,209,43,52,
+108,126,122,135,165,254,181,185,179,1,73,1,102,106,205,141,195,214,116,106,
+1,185,15,68,45,90,94,135,127,115,1,82,1,180,182,254,204,253,209,210,124,186,
+100,175,156,101,148,36,0,1,0,180,255,251,4,190,5,202,0,31,0,0,1,14,3,35,34,
+38,38,53,52,54,54,51,50,4,18,17,7,7,16,2,2,38,35,34,6,21,20,22,51,55,2,124,
+22,34,31,33,21,86,147,82,108,194,123,200,1,16,137,4,139,46,111,177,119,121,
+132,75,64,77,3,28,5,8,4,2,82,146,92,102,179,104,252,253,253,254,74,248,34,
+1,117,1,202,1,81,165,121,106,74,96,5,0,0,1,0,130,1,196,3,114,5,182,0,15,0,
+0,19,33,21,33,6,6,21,20,22,23,21,36,17,52,55,35,130,2,200,255,0,77,93,228,
+238,253,117,126,227,5,182,164,40,145,85,109,185,79,203,228,1,89,158,115,0,
+1,0,177,1,43,4,235,5,202,0,31,0,0,1,55,53,16,2,35,34,6,21,20,22,51,50,54,
+53,23,6,6,35,34,38,53,52,54,54,51,50,4,18,17,21,7,4,50,1,225,220,123,145,
+75,64,64,77,165,5,161,144,137,183,112,211,146,192,1,17,148,1,1,43,84,62,1,
+170,1,201,143,117,96,111,97,76,23,144,160,195,150,119,197,114,233,254,45,
+254,195,70,77,0,1,0,200,254,187,4,254,5,182,0,31,0,0,1,17,46,3,53,17,51,17,
+20,30,2,23,17,51,17,62,3,53,53,51,21,20,14,2,7,17,2,145,123,174,109,51,184,
+26,62,100,75,184,78,101,60,24,184,52,110,174,121,254,187,1,47,8,69,130,196,
+135,3,178,252,72,93,131,85,44,6,1,154,254,104,8,45,85,128,92,56,56,138,194,
+126,65,9,254,208,0,0,1,0,200,254,187,4,254,5,182,0,40,0,0,1,17,6,6,35,34,
+38,35,17,35,17,46,3,53,17,51,17,20,30,2,23,17,51,17,62,3,53,53,51,21,20,14,
+2,7,17,3,34,18,37,20,14,25,12,164,81,118,77,36,184,26,62,100,75,184,78,101,
+60,24,184,37,77,117,81,254,187,1,47,1,1,1,254,210,1,69,20,80,125,175,116,
+3,178,252,72,93,131,85,44,6,1,154,254,104,8,45,85,128,92,56,56,120,174,120,
+74,21,254,185,0,1,0,200,254,187,3,155,5,182,0,9,0,0,1,17,33,17,33,21,33,17,
+33,17,2,247,253,209,2,211,253,229,2,27,254,187,1,69,5,182,164,251,146,254,
+23,0,0,1,0,200,254,187,3,155,5,182,0,13,0,0,1,17,35,17,35,17,33,17,33,21,
+33,17,33,17,2,247,126,164,254,243,2,211,253,229,2,27,254,187,1,69,254,187,
+1,69,5,182,164,251,146,254,23,0,0,2,0,160,254,187,3,142,5,182,0,14,0,23,0,
+0,1,17,38,39,38,53,52,36,33,51,17,51,17,35,17,19,34,7,6,6,21,20,22,51,2,33,
+161,97,127,1,13,1,23,18,184,201,17,152,76,76,67,186,185,254,187,1,73,17,68,
+90,158,190,179,2,244,250,74,254,187,3,99,18,17,83,79,96,85,0,0,2,0,160,254,
+187,3,142,5,182,0,20,0,29,0,0,1,17,35,34,39,17,35,17,38,39,38,53,52,36,33,
+51,17,51,17,35,17,3,34,7,6,6,21,20,22,51,2,177,43,44,39,164,65,47,127,1,13,
+1,23,18,184,57,127,152,76,76,67,186,185,254,187,1,69,3,254,184,1,103,21,34,
+90,158,190,179,2,244,250,74,254,187,3,99,18,17,83,79,96,85,0,3,0,130,254,
+187,4,94,5,182,0,25,0,36,0,47,0,0,1,17,46,3,53,52,62,2,55,17,51,17,30,3,21,
+20,14,2,7,17,19,17,62,3,53,52,46,2,39,14,3,21,20,30,2,23,2,30,87,151,111,
+63,61,108,147,86,184,84,147,109,62,60,109,152,91,10,52,81,56,29,32,58,80,
+232,48,81,57,32,32,58,80,48,254,187,1,51,13,84,126,160,89,89,158,124,84,15,
+2,26,253,230,15,84,125,158,88,86,159,126,87,14,254,205,4,57,253,164,16,61,
+82,96,51,51,95,79,58,14,16,59,79,93,50,51,96,81,61,16,0,3,0,130,254,187,4,
+94,5,182,0,38,0,49,0,60,0,0,1,17,6,6,35,34,38,39,17,35,17,39,46,3,53,52,62,
+2,55,17,51,17,30,3,21,20,14,2,7,6,6,7,17,3,17,62,3,53,52,46,2,39,14,3,21,
+20,30,2,23,2,175,16,31,16,17,31,15,164,22,57,90,64,34,61,108,147,86,184,84,
+147,109,62,34,65,91,57,5,10,5,135,48,81,57,32,32,58,80,232,48,81,57,32,32,
+58,80,48,254,187,1,49,2,2,2,2,254,207,1,97,12,32,89,107,122,64,89,158,124,
+84,15,2,26,253,230,15,84,125,158,88,65,122,108,89,31,3,5,3,254,159,4,57,253,
+164,16,61,82,96,51,51,95,79,58,14,16,59,79,93,50,51,96,81,61,16,0,1,0,160,
+0,0,4,140,5,182,0,45,0,0,1,53,6,6,21,20,22,51,51,21,35,34,46,2,53,52,54,55,
+38,38,53,52,62,2,51,51,21,35,34,7,6,21,20,30,2,23,53,51,21,33,21,33,21,2,
+209,184,182,156,138,253,247,114,184,128,69,109,97,99,107,74,135,190,116,227,
+242,139,83,83,43,90,138,95,164,1,23,254,233,2,4,140,2,131,138,106,115,164,
+56,102,141,85,121,181,52,51,172,117,82,140,103,59,164,59,59,103,67,96,63,
+30,1,130,130,164,140,0,0,1,0,50,0,0,5,141,5,182,0,48,0,0,19,33,62,3,51,51,
+21,35,34,7,6,21,20,30,2,23,53,51,21,33,21,33,21,35,53,6,6,21,20,22,51,51,
+21,35,34,46,2,53,52,54,55,38,38,39,33,50,1,139,25,91,124,156,91,227,242,139,
+83,83,43,90,138,95,164,1,23,254,233,164,184,182,156,138,253,247,114,184,128,
+69,109,97,93,105,7,254,144,4,188,55,92,66,37,164,59,59,103,67,96,63,30,1,
+130,130,164,140,140,2,131,138,106,115,164,56,102,141,85,121,181,52,48,156,
+106,0,0,1,0,50,0,0,5,141,5,182,0,53,0,0,19,33,38,52,53,52,55,33,53,33,54,
+54,51,51,21,35,34,7,6,21,20,30,2,23,53,51,21,33,21,33,21,35,53,6,6,21,20,
+22,51,51,21,35,34,46,2,53,52,54,55,38,39,33,50,1,112,1,29,254,116,2,33,66,
+169,102,227,242,139,83,83,43,90,138,95,164,1,23,254,233,164,184,182,156,138,
+253,247,114,184,128,69,109,97,106,52,254,97,4,25,7,14,8,71,64,164,40,45,164,
+59,59,103,67,96,63,30,1,130,130,164,140,140,2,131,138,106,115,164,56,102,
+141,85,121,181,52,55,92,0,1,0,160,254,187,3,134,5,182,0,39,0,0,1,17,35,34,
+46,2,53,52,54,55,38,38,53,52,62,2,51,51,21,35,34,7,6,21,20,22,51,51,21,35,
+34,6,21,20,22,51,51,17,2,226,83,114,184,128,69,109,97,99,107,74,135,190,116,
+227,242,139,83,83,183,196,130,130,191,188,156,138,253,254,187,1,69,56,102,
+141,85,121,181,52,51,172,117,82,140,103,59,164,59,59,103,136,121,164,130,
+141,106,115,254,23,0,1,0,160,254,187,3,134,5,182,0,43,0,0,1,17,38,38,53,52,
+54,55,38,38,53,52,62,2,51,51,21,35,34,7,6,21,20,22,51,51,21,35,34,6,21,20,
+22,51,51,17,35,17,35,34,34,39,17,1,192,137,151,109,97,99,107,74,135,190,116,
+227,242,139,83,83,183,196,130,130,191,188,156,138,253,164,83,11,21,11,254,
+187,1,97,42,186,128,121,181,52,51,172,117,82,140,103,59,164,59,59,103,136,
+121,164,130,141,106,115,254,23,1,69,1,254,186,0,0,1,0,50,0,0,6,142,5,182,
+0,24,0,0,33,17,33,53,33,17,22,22,51,50,55,54,53,17,33,21,33,17,20,6,35,34,
+38,39,17,1,180,254,126,2,58,42,125,75,134,56,56,2,58,254,126,208,200,75,140,
+49,5,18,164,253,190,36,50,63,64,138,1,143,164,254,242,210,191,37,33,253,71,
+0,0,1,0,50,0,0,6,142,5,182,0,28,0,0,33,17,33,53,33,53,33,53,33,17,22,22,51,
+50,55,54,53,17,33,21,33,17,20,6,35,34,38,39,17,1,180,254,126,1,130,254,126,
+2,58,42,125,75,134,56,56,2,58,254,126,208,200,75,140,49,3,202,164,164,164,
+253,190,36,50,63,64,138,1,143,164,254,242,210,191,37,33,253,71,0,0,1,0,100,
+0,0,4,141,5,182,0,28,0,0,19,33,53,33,53,33,21,33,21,33,21,54,51,50,22,21,
+17,35,53,52,39,38,35,34,7,17,35,17,33,100,1,63,254,193,1,247,1,202,254,54,
+77,77,200,208,184,56,56,134,75,57,184,254,193,4,100,174,164,174,164,112,23,
+191,210,254,227,250,138,64,63,19,252,179,3,192,0,1,0,100,0,0,4,141,5,182,
+0,32,0,0,19,33,53,33,53,33,53,33,53,33,21,33,21,33,21,54,51,50,22,21,17,35,
+53,52,39,38,35,34,7,17,35,17,33,100,1,63,254,193,1,63,254,193,1,247,1,202,
+254,54,77,77,200,208,184,56,56,134,75,57,184,254,193,3,28,164,164,174,164,
+174,164,112,23,191,210,254,227,250,138,64,63,19,252,179,2,120,0,1,0,160,254,
+187,3,127,5,182,0,26,0,0,1,17,46,2,2,53,52,18,54,36,51,51,21,35,34,14,2,21,
+20,30,2,51,51,17,2,219,140,214,144,73,95,181,1,5,165,33,35,120,188,130,68,
+65,127,188,124,37,254,187,1,74,14,109,185,1,2,162,170,1,15,188,100,164,77,
+145,211,134,135,211,145,76,254,23,0,1,0,160,254,187,3,127,5,182,0,30,0,0,
+1,17,38,2,53,52,18,54,36,51,51,21,35,34,14,2,21,20,30,2,51,51,17,35,17,38,
+38,39,17,1,185,141,140,95,181,1,5,165,33,35,120,188,130,68,65,127,188,124,
+37,164,34,63,29,254,187,1,167,86,1,67,226,170,1,15,188,100,164,77,145,211,
+134,135,211,145,76,254,23,1,74,3,11,8,254,160,0,2,0,35,0,56,6,105,5,132,0,
+29,0,49,0,0,19,33,54,54,51,50,22,23,33,21,33,22,18,21,20,14,2,35,34,46,4,
+53,52,18,55,33,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,35,2,189,25,51,
+26,26,49,25,2,191,254,168,102,117,98,178,250,152,95,174,151,123,87,48,115,
+103,254,169,1,64,72,129,177,105,99,175,132,77,72,129,177,105,98,175,132,78,
+5,125,3,4,4,3,164,91,254,253,157,138,246,186,108,46,84,121,151,177,99,152,
+1,5,94,254,6,102,183,140,82,78,137,185,107,100,182,140,83,77,135,185,0,0,
+2,0,35,0,56,6,105,5,132,0,34,0,54,0,0,19,51,54,55,33,53,33,54,54,51,50,22,
+23,33,21,33,22,18,21,20,14,2,35,34,46,4,53,52,54,55,35,5,20,30,2,51,50,62,
+2,53,52,46,2,35,34,14,2,35,213,52,78,254,169,2,189,25,51,26,26,49,25,2,191,
+254,168,102,117,98,178,250,152,95,174,151,123,87,48,11,11,147,1,64,72,129,
+177,105,99,175,132,77,72,129,177,105,98,175,132,78,4,53,94,70,164,3,4,4,3,
+164,91,254,253,157,138,246,186,108,46,84,121,151,177,99,47,89,43,178,102,
+183,140,82,78,137,185,107,100,182,140,83,77,135,185,0,0,2,0,160,254,187,5,
+236,5,132,0,24,0,44,0,0,1,17,46,3,53,52,62,2,51,50,30,4,21,20,14,2,7,17,1,
+20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,2,244,128,218,159,91,100,180,249,
+149,94,174,151,123,88,48,85,156,220,135,253,203,72,129,177,105,99,175,132,
+77,72,129,177,105,98,175,132,78,254,187,1,129,14,111,177,235,137,140,247,
+184,107,46,85,121,150,178,98,129,231,182,117,15,254,127,4,36,102,183,140,
+82,78,137,185,107,100,182,140,83,77,135,185,0,0,2,0,160,254,187,5,236,5,132,
+0,32,0,52,0,0,1,17,6,35,34,34,39,17,35,17,46,3,53,52,62,2,51,50,30,4,21,20,
+14,2,7,17,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,3,133,32,31,17,30,16,
+164,99,166,120,66,100,180,249,149,94,174,151,123,88,48,63,118,167,103,253,
+58,72,129,177,105,99,175,132,77,72,129,177,105,98,175,132,78,254,187,1,128,
+3,2,254,129,1,161,33,121,166,205,117,140,247,184,107,46,85,121,150,178,98,
+110,203,169,127,34,254,96,4,36,102,183,140,82,78,137,185,107,100,182,140,
+83,77,135,185,0,0,1,0,130,254,187,4,75,5,182,0,48,0,0,1,17,46,3,53,52,62,
+2,55,17,51,17,35,34,14,2,21,20,30,2,51,50,54,53,52,38,35,34,7,39,54,54,51,
+50,30,2,21,20,14,2,7,17,2,37,97,155,109,58,64,111,151,87,184,92,65,113,84,
+48,43,80,115,72,130,150,54,43,106,43,171,35,152,119,66,109,77,43,52,99,144,
+91,254,187,1,49,10,80,123,158,89,84,153,122,83,14,2,54,253,48,49,84,113,63,
+67,106,73,39,93,90,60,59,132,80,96,118,40,74,104,63,75,121,89,56,9,254,206,
+0,0,1,0,130,254,187,4,75,5,182,0,55,0,0,1,17,6,6,35,34,38,39,17,35,17,46,
+3,53,52,62,2,55,17,51,17,35,34,14,2,21,20,30,2,51,50,54,53,52,38,35,34,7,
+39,54,54,51,50,30,2,21,20,6,7,17,2,182,20,40,20,12,23,11,164,65,101,71,37,
+64,111,151,87,184,92,65,113,84,48,43,80,115,72,130,150,54,43,106,43,171,35,
+152,119,66,109,77,43,125,116,254,187,1,49,2,2,1,1,254,209,1,86,27,86,109,
+130,71,84,153,122,83,14,2,54,253,48,49,84,113,63,67,106,73,39,93,90,60,59,
+132,80,96,118,40,74,104,63,118,161,40,254,175,0,1,0,100,254,187,3,234,5,182,
+0,13,0,0,1,17,33,53,33,17,33,53,33,21,33,17,33,17,3,70,253,30,1,103,254,153,
+3,134,254,153,1,103,254,187,1,69,164,4,110,164,164,251,146,254,23,0,0,1,0,
+100,254,187,3,234,5,182,0,17,0,0,1,17,35,17,35,17,33,53,33,17,33,53,33,21,
+33,17,33,17,3,70,126,164,254,64,1,103,254,153,3,134,254,153,1,103,254,187,
+1,69,254,187,1,69,164,4,110,164,164,251,146,254,23,0,0,3,0,35,0,56,6,105,
+5,132,0,29,0,49,0,61,0,0,19,33,54,54,51,50,22,23,33,21,33,22,18,21,20,14,
+2,35,34,46,4,53,52,18,55,33,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,5,
+52,54,51,50,22,21,20,6,35,34,38,35,2,189,25,51,26,26,49,25,2,191,254,168,
+102,117,98,178,250,152,95,174,151,123,87,48,115,103,254,169,1,64,72,129,177,
+105,99,175,132,77,72,129,177,105,98,175,132,78,1,100,62,63,63,66,68,61,60,
+65,5,125,3,4,4,3,164,91,254,253,157,138,246,186,108,46,84,121,151,177,99,
+152,1,5,94,254,6,102,183,140,82,78,137,185,107,100,182,140,83,77,135,185,
+102,66,73,72,67,64,75,73,0,0,3,0,35,0,56,6,105,5,132,0,34,0,54,0,66,0,0,19,
+51,54,55,33,53,33,54,54,51,50,22,23,33,21,33,22,18,21,20,14,2,35,34,46,4,
+53,52,54,55,35,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,5,52,54,51,50,22,
+21,20,6,35,34,38,35,213,52,78,254,169,2,189,25,51,26,26,49,25,2,191,254,168,
+102,117,98,178,250,152,95,174,151,123,87,48,11,11,147,1,64,72,129,177,105,
+99,175,132,77,72,129,177,105,98,175,132,78,1,100,62,63,63,66,68,61,60,65,
+4,53,94,70,164,3,4,4,3,164,91,254,253,157,138,246,186,108,46,84,121,151,177,
+99,47,89,43,178,102,183,140,82,78,137,185,107,100,182,140,83,77,135,185,102,
+66,73,72,67,64,75,73,0,0,3,0,160,254,187,5,236,5,132,0,24,0,44,0,56,0,0,1,
+17,46,3,53,52,62,2,51,50,30,4,21,20,14,2,7,17,1,20,30,2,51,50,62,2,53,52,
+46,2,35,34,14,2,5,52,54,51,50,22,21,20,6,35,34,38,2,244,128,218,159,91,100,
+180,249,149,94,174,151,123,88,48,85,156,220,135,253,203,72,129,177,105,99,
+175,132,77,72,129,177,105,98,175,132,78,1,100,62,63,63,66,68,61,60,65,254,
+187,1,129,14,111,177,235,137,140,247,184,107,46,85,121,150,178,98,129,231,
+182,117,15,254,127,4,36,102,183,140,82,78,137,185,107,100,182,140,83,77,135,
+185,102,66,73,72,67,64,75,73,0,0,3,0,160,254,187,5,236,5,132,0,32,0,52,0,
+64,0,0,1,17,6,35,34,34,39,17,35,17,46,3,53,52,62,2,51,50,30,4,21,20,14,2,
+7,17,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,5,52,54,51,50,22,21,20,6,
+35,34,38,3,133,32,31,17,30,16,164,99,166,120,66,100,180,249,149,94,174,151,
+123,88,48,63,118,167,103,253,58,72,129,177,105,99,175,132,77,72,129,177,105,
+98,175,132,78,1,100,62,63,63,66,68,61,60,65,254,187,1,128,3,2,254,129,1,161,
+33,121,166,205,117,140,247,184,107,46,85,121,150,178,98,110,203,169,127,34,
+254,96,4,36,102,183,140,82,78,137,185,107,100,182,140,83,77,135,185,102,66,
+73,72,67,64,75,73,0,0,2,0,50,0,0,5,164,5,182,0,15,0,26,0,0,33,17,33,53,33,
+53,33,21,33,22,18,21,16,7,6,33,39,51,50,62,2,53,16,39,38,35,1,180,254,126,
+1,130,3,240,254,173,116,101,172,173,254,185,30,4,122,188,128,66,134,134,240,
+4,114,164,160,164,114,254,231,170,254,156,188,189,164,75,144,211,137,1,12,
+149,150,0,0,2,0,50,0,0,5,164,5,182,0,19,0,30,0,0,19,33,21,33,30,3,21,16,7,
+6,33,35,17,33,53,33,53,33,1,51,50,62,2,53,16,39,38,35,50,5,114,254,173,62,
+83,51,21,172,173,254,185,214,254,126,1,130,254,126,2,58,4,122,188,128,66,
+134,134,240,5,182,164,61,128,139,152,85,254,156,188,189,3,202,164,164,251,
+146,75,144,211,137,1,12,149,150,0,1,0,100,254,187,3,234,5,182,0,9,0,0,1,17,
+33,53,33,17,51,17,33,17,3,70,253,30,1,103,184,1,103,254,187,1,69,164,5,18,
+250,238,254,23,0,1,0,100,254,187,3,234,5,182,0,13,0,0,1,17,35,17,35,17,33,
+53,33,17,51,17,33,17,3,70,126,164,254,64,1,103,184,1,103,254,187,1,69,254,
+187,1,69,164,5,18,250,238,254,23,0,1,0,200,254,187,4,63,5,182,0,28,0,0,1,
+17,46,3,53,17,51,17,20,30,2,51,50,62,2,53,53,51,21,20,14,2,7,17,2,48,100,
+137,85,38,184,22,57,98,77,76,102,62,25,184,39,86,139,99,254,187,1,49,10,68,
+129,194,135,3,178,252,72,106,139,83,34,37,85,139,102,6,6,132,190,128,69,11,
+254,206,0,1,0,200,254,187,4,63,5,182,0,36,0,0,1,17,6,35,34,38,39,17,35,17,
+46,3,53,17,51,17,20,30,2,51,50,62,2,53,53,51,21,20,14,2,7,17,2,193,33,35,
+15,29,14,164,57,81,53,24,184,22,57,98,77,76,102,62,25,184,25,52,83,58,254,
+187,1,48,3,1,1,254,209,1,83,26,79,118,166,113,3,178,252,72,106,139,83,34,
+37,85,139,102,6,6,110,163,117,79,25,254,170,0,0,1,0,200,254,187,4,26,5,182,
+0,35,0,0,1,17,38,38,53,17,51,17,20,30,2,51,50,17,52,46,2,35,34,7,39,54,51,
+50,30,2,21,20,14,2,7,17,2,34,178,168,184,24,55,88,64,241,29,53,73,44,55,59,
+76,84,87,95,152,107,58,48,89,125,78,254,187,1,49,17,229,215,3,253,252,3,80,
+111,70,32,1,14,49,84,62,34,17,154,35,59,106,150,90,82,143,113,76,15,254,202,
+0,1,0,200,254,187,4,26,5,182,0,41,0,0,1,17,6,35,34,38,39,17,35,17,38,38,53,
+17,51,17,20,30,2,51,50,17,52,46,2,35,34,7,39,54,51,50,30,2,21,20,6,7,17,2,
+179,38,38,14,24,12,164,103,98,184,24,55,88,64,241,29,53,73,44,55,59,76,84,
+87,95,152,107,58,103,92,254,187,1,51,6,1,1,254,209,1,86,48,210,166,3,253,
+252,3,80,111,70,32,1,14,49,84,62,34,17,154,35,59,106,150,90,122,195,57,254,
+147,0,2,0,50,0,144,7,101,5,56,0,7,0,11,0,0,37,17,33,53,33,21,33,17,37,33,
+17,33,1,124,254,182,7,51,254,182,252,25,3,47,252,209,144,4,4,164,164,251,
+252,164,3,96,0,2,0,50,0,144,7,101,5,56,0,11,0,15,0,0,37,17,33,53,33,53,33,
+53,33,21,33,17,37,33,17,33,1,124,254,182,1,74,254,182,7,51,254,182,252,25,
+3,47,252,209,144,2,188,164,164,164,164,251,252,164,3,96,0,2,0,200,255,31,
+5,103,5,56,0,7,0,11,0,0,5,17,33,17,33,17,33,17,1,33,17,33,2,197,254,3,4,159,
+254,2,254,23,3,47,252,209,225,1,113,4,168,251,88,254,143,2,21,3,96,0,0,2,
+0,200,255,31,5,103,5,56,0,11,0,15,0,0,5,17,35,17,35,17,33,17,33,17,33,17,
+1,33,17,33,3,86,126,164,254,148,4,159,254,147,253,134,3,47,252,209,225,1,
+113,254,143,1,113,4,168,251,88,254,143,2,21,3,96,0,0,2,0,50,255,232,7,140,
+5,182,0,43,0,55,0,0,1,33,21,33,14,3,7,22,22,21,20,14,2,35,34,46,2,53,52,54,
+55,38,39,38,38,39,33,53,33,21,20,30,2,23,62,3,53,1,6,6,21,20,22,51,50,54,
+53,52,38,5,82,2,58,254,121,9,47,90,141,103,147,130,58,113,164,106,104,161,
+110,57,134,144,165,76,63,77,12,254,122,2,58,62,104,134,71,71,134,103,63,254,
+144,124,121,127,111,117,129,116,5,182,164,77,124,114,111,63,97,221,134,91,
+142,97,51,51,98,142,90,137,219,93,98,78,66,153,97,164,82,96,139,108,88,44,
+44,88,108,140,95,253,104,77,170,104,110,107,106,111,104,169,0,2,0,50,255,
+232,7,140,5,182,0,46,0,58,0,0,19,33,38,38,39,33,53,33,21,20,30,2,23,62,3,
+53,53,33,21,33,14,3,7,22,22,21,20,14,2,35,34,46,2,53,52,54,55,38,39,33,5,
+6,6,21,20,22,51,50,54,53,52,38,50,1,180,17,24,5,254,122,2,58,62,104,134,71,
+71,134,103,63,2,58,254,121,9,47,90,141,103,147,130,58,113,164,106,104,161,
+110,57,134,144,153,76,253,214,3,176,124,121,127,111,117,129,116,4,110,37,
+81,46,164,82,96,139,108,88,44,44,88,108,140,95,82,164,77,124,114,111,63,97,
+221,134,91,142,97,51,51,98,142,90,137,219,93,91,73,254,77,170,104,110,107,
+106,111,104,169,0,2,0,160,254,187,4,246,5,182,0,41,0,53,0,0,1,17,38,38,53,
+52,54,55,38,38,39,38,38,53,53,51,21,20,30,2,23,62,3,53,53,51,21,20,14,2,7,
+22,22,21,20,6,7,17,3,6,6,21,20,22,51,50,54,53,52,38,2,121,172,182,134,144,
+82,121,38,76,80,184,62,104,134,71,71,134,103,63,184,42,94,150,109,147,130,
+183,172,79,124,121,127,111,117,129,116,254,187,1,49,18,194,165,137,219,93,
+49,88,39,79,193,126,82,82,96,139,108,88,44,44,88,108,140,95,82,82,97,153,
+132,123,66,97,221,134,164,193,19,254,206,4,17,77,170,104,110,107,106,111,
+104,169,0,0,2,0,160,254,187,4,246,5,182,0,48,0,60,0,0,1,17,6,35,34,39,17,
+35,17,38,38,53,52,54,55,38,38,39,38,38,53,53,51,21,20,30,2,23,62,3,53,53,
+51,21,20,14,2,7,22,22,21,20,6,7,17,3,6,6,21,20,22,51,50,54,53,52,38,3,10,
+33,34,31,28,164,103,106,134,144,82,121,38,76,80,184,62,104,134,71,71,134,
+103,63,184,42,94,150,109,147,130,107,103,224,124,121,127,111,117,129,116,
+254,187,1,48,3,3,254,208,1,84,44,173,125,137,219,93,49,88,39,79,193,126,82,
+82,96,139,108,88,44,44,88,108,140,95,82,82,97,153,132,123,66,97,221,134,125,
+172,43,254,170,4,17,77,170,104,110,107,106,111,104,169,0,0,1,0,130,254,187,
+5,242,5,182,0,45,0,0,1,17,38,39,6,35,34,46,2,53,53,51,21,20,30,2,51,50,62,
+2,53,17,51,17,20,30,2,51,50,62,2,53,53,51,21,20,14,2,7,17,4,22,148,72,91,
+204,105,152,97,47,184,21,48,79,58,60,82,50,22,184,21,49,82,62,58,79,48,21,
+184,37,77,118,80,254,187,1,49,16,89,109,52,113,178,127,69,69,84,114,70,30,
+31,67,106,74,4,12,251,244,78,106,65,29,30,70,114,84,69,69,113,166,112,63,
+10,254,205,0,0,1,0,130,254,187,5,242,5,182,0,52,0,0,1,17,6,6,35,34,38,39,
+17,35,17,38,39,6,35,34,46,2,53,53,51,21,20,30,2,51,50,62,2,53,17,51,17,20,
+30,2,51,50,62,2,53,53,51,21,20,6,7,17,4,167,17,35,18,15,27,14,164,44,31,91,
+204,105,152,97,47,184,21,48,79,58,60,82,50,22,184,21,49,82,62,58,79,48,21,
+184,83,84,254,187,1,49,2,2,1,1,254,209,1,92,24,38,109,52,113,178,127,69,69,
+84,114,70,30,31,67,106,74,4,12,251,244,78,106,65,29,30,70,114,84,69,69,168,
+201,50,254,160,0,1,0,100,254,187,5,20,5,182,0,29,0,0,1,17,46,3,39,33,53,33,
+21,20,30,2,51,50,62,2,53,17,51,17,20,14,2,7,17,3,5,81,123,86,52,11,254,192,
+1,240,25,62,102,77,75,99,57,23,184,39,87,138,99,254,187,1,50,9,52,92,134,
+91,164,8,101,140,86,38,36,85,140,103,3,180,252,82,136,195,130,69,10,254,207,
+0,0,1,0,100,254,187,5,20,5,182,0,37,0,0,1,17,6,6,35,34,39,17,35,17,46,3,39,
+33,53,33,21,20,30,2,51,50,62,2,53,17,51,17,20,14,2,7,17,3,150,14,27,14,38,
+33,164,46,70,51,32,9,254,192,1,240,25,62,102,77,75,99,57,23,184,25,53,83,
+57,254,187,1,47,1,1,3,254,208,1,87,21,59,83,108,70,164,8,101,140,86,38,36,
+85,140,103,3,180,252,82,112,167,121,80,25,254,172,0,2,0,130,254,187,3,144,
+5,182,0,25,0,45,0,0,1,17,46,3,53,52,62,2,55,17,51,17,30,3,21,20,14,2,7,17,
+1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,183,71,114,81,43,43,79,110,67,
+184,66,110,79,44,44,81,114,70,254,223,32,55,76,44,43,76,56,32,32,55,76,44,
+44,76,55,32,254,187,1,53,14,70,98,120,65,65,118,97,69,16,2,234,253,23,16,
+69,97,119,65,65,120,98,70,14,254,203,2,164,44,77,58,34,34,58,77,44,44,78,
+58,34,34,58,78,0,2,0,130,254,187,3,144,5,182,0,30,0,50,0,0,1,17,6,6,35,34,
+38,39,17,35,17,38,38,53,52,62,2,55,17,51,17,30,3,21,20,6,7,17,1,20,30,2,51,
+50,62,2,53,52,46,2,35,34,14,2,2,72,16,31,16,17,31,15,164,78,86,43,79,110,
+67,184,66,110,79,44,87,77,254,78,32,55,76,44,43,76,56,32,32,55,76,44,44,76,
+55,32,254,187,1,50,2,3,3,2,254,206,1,113,53,160,94,65,118,97,69,16,2,234,
+253,23,16,69,97,119,65,93,161,52,254,142,2,164,44,77,58,34,34,58,77,44,44,
+78,58,34,34,58,78,0,0,1,0,200,254,187,4,63,5,182,0,32,0,0,1,17,46,3,53,17,
+51,17,37,23,5,21,20,30,2,51,50,62,2,53,53,51,21,20,14,2,7,17,2,48,100,137,
+85,38,184,2,8,50,253,198,22,57,98,77,76,102,62,25,184,39,86,139,99,254,187,
+1,49,10,68,129,194,135,3,178,253,224,170,154,186,238,106,139,83,34,37,85,
+139,102,6,6,132,190,128,69,11,254,206,0,0,1,0,200,254,187,4,63,5,182,0,40,
+0,0,1,17,6,35,34,38,39,17,35,17,46,3,53,17,51,17,37,23,5,21,20,30,2,51,50,
+62,2,53,53,51,21,20,14,2,7,17,2,193,33,35,15,29,14,164,57,81,53,24,184,2,
+8,50,253,198,22,57,98,77,76,102,62,25,184,25,52,83,58,254,187,1,48,3,1,1,
+254,209,1,83,26,79,118,166,113,3,178,253,224,170,154,186,238,106,139,83,34,
+37,85,139,102,6,6,110,163,117,79,25,254,170,0,1,0,160,254,187,6,132,5,182,
+0,44,0,0,1,17,46,3,53,53,38,35,34,14,2,21,17,35,17,52,54,51,50,23,17,51,17,
+20,30,2,51,50,62,2,53,53,51,21,20,14,2,7,17,4,86,101,147,95,46,56,75,68,94,
+58,26,184,208,200,76,77,184,32,69,107,76,76,112,72,35,184,45,96,149,104,254,
+187,1,49,10,72,132,192,130,30,18,31,64,100,70,254,213,1,78,210,191,23,2,238,
+252,72,102,139,85,36,40,87,138,98,6,6,126,189,131,74,11,254,207,0,0,1,0,160,
+254,187,6,132,5,182,0,52,0,0,1,17,6,35,34,38,39,17,35,17,46,3,53,53,38,35,
+34,14,2,21,17,35,17,52,54,51,50,23,17,51,17,20,30,2,51,50,62,2,53,53,51,21,
+20,14,2,7,17,4,231,33,34,16,29,14,164,63,92,60,29,56,75,68,94,58,26,184,208,
+200,76,77,184,32,69,107,76,76,112,72,35,184,30,62,93,64,254,187,1,48,3,1,
+1,254,209,1,82,26,85,124,164,104,30,18,31,64,100,70,254,213,1,78,210,191,
+23,2,238,252,72,102,139,85,36,40,87,138,98,6,6,105,161,121,84,26,254,173,
+0,1,0,200,254,187,5,120,5,182,0,26,0,0,1,17,46,3,53,17,51,17,20,30,2,51,50,
+62,2,53,33,21,33,6,6,7,17,2,50,101,138,85,38,184,22,57,98,77,78,102,61,25,
+1,240,254,192,20,171,163,254,187,1,48,10,69,129,194,135,3,178,252,72,106,
+139,83,34,38,88,144,105,164,180,181,17,254,206,0,1,0,200,254,187,5,120,5,
+182,0,34,0,0,1,17,6,35,34,38,39,17,35,17,46,3,53,17,51,17,20,30,2,51,50,62,
+2,53,33,21,33,6,6,7,17,2,195,35,35,15,27,14,164,57,83,52,25,184,22,57,98,
+77,78,102,61,25,1,240,254,192,15,103,91,254,187,1,48,3,1,1,254,209,1,82,24,
+79,121,167,112,3,178,252,72,106,139,83,34,38,88,144,105,164,136,167,39,254,
+170,0,0,1,0,100,254,187,7,73,5,182,0,44,0,0,1,17,46,3,39,33,53,33,20,30,2,
+51,50,62,2,53,17,51,17,54,51,50,22,21,17,35,17,52,46,2,35,34,7,21,20,14,2,
+7,17,3,5,81,123,87,52,10,254,192,1,240,25,61,103,77,77,99,57,21,184,75,82,
+200,208,184,27,58,94,67,77,58,39,87,138,99,254,187,1,50,9,52,92,134,91,164,
+105,143,89,38,35,84,139,104,3,184,253,17,24,191,210,254,178,1,43,69,101,64,
+31,20,28,135,195,129,68,9,254,207,0,1,0,100,254,187,7,73,5,182,0,50,0,0,1,
+17,6,6,35,34,39,17,35,17,38,38,39,33,53,33,20,30,2,51,50,62,2,53,17,51,17,
+54,51,50,22,21,17,35,17,52,46,2,35,34,7,21,20,14,2,7,17,3,150,14,27,14,38,
+33,164,89,104,15,254,192,1,240,25,61,103,77,77,99,57,21,184,75,82,200,208,
+184,27,58,94,67,77,58,25,54,82,57,254,187,1,47,1,1,3,254,208,1,86,39,167,
+136,164,105,143,89,38,35,84,139,104,3,184,253,17,24,191,210,254,178,1,43,
+69,101,64,31,20,28,113,167,119,79,24,254,173,0,0,3,0,50,0,0,6,156,5,202,0,
+32,0,41,0,50,0,0,19,33,62,3,51,50,30,2,23,33,21,33,14,3,7,17,33,17,35,17,
+33,53,46,3,39,33,37,20,22,23,17,14,3,5,52,46,2,39,17,54,54,50,1,153,15,76,
+110,136,75,77,137,109,75,14,1,153,254,104,11,58,86,107,59,254,63,184,1,193,
+58,107,86,60,11,254,105,2,63,85,75,36,59,42,23,1,236,23,42,59,36,75,85,4,
+138,68,117,86,49,50,86,117,67,164,60,104,83,57,12,254,196,254,146,2,18,152,
+12,57,83,104,60,78,81,125,26,1,211,13,45,62,74,41,42,74,61,45,13,254,45,26,
+125,0,0,3,0,50,0,0,6,156,5,202,0,37,0,46,0,55,0,0,19,33,62,3,51,50,30,2,23,
+33,21,33,14,3,7,17,33,17,35,17,33,53,38,39,39,33,53,33,38,53,52,55,33,5,20,
+22,23,17,14,3,5,52,46,2,39,17,54,54,50,1,231,29,76,87,95,47,77,137,109,75,
+14,1,153,254,104,11,58,86,107,59,254,63,184,1,193,141,94,11,254,29,1,151,
+7,9,254,103,2,63,85,75,36,59,42,23,1,236,23,42,59,36,75,85,5,46,36,58,41,
+21,50,86,117,67,164,60,104,83,57,12,254,196,254,146,2,18,152,30,109,13,164,
+35,44,43,42,86,81,125,26,1,211,13,45,62,74,41,42,74,61,45,13,254,45,26,125,
+0,0,1,0,50,0,0,3,158,5,182,0,39,0,0,19,33,54,54,51,51,21,35,34,6,7,33,21,
+33,22,22,51,51,17,35,17,38,35,34,7,6,21,21,35,17,52,54,51,50,23,53,38,38,
+39,33,50,1,65,23,196,160,176,172,83,95,17,1,111,254,145,19,97,79,172,184,
+57,75,138,54,54,184,197,211,76,78,161,190,21,254,192,4,159,138,141,164,56,
+59,164,56,63,252,124,1,229,19,60,60,135,249,1,28,200,191,23,84,2,150,131,
+0,0,1,0,50,0,0,3,158,5,182,0,47,0,0,19,33,38,53,52,54,55,33,53,33,54,54,51,
+51,21,35,34,6,7,33,21,33,22,22,51,51,17,35,17,38,35,34,7,6,21,21,35,17,52,
+54,51,50,23,53,38,38,39,33,50,1,64,6,3,4,254,191,1,139,50,152,103,176,172,
+83,95,17,1,111,254,145,19,97,79,172,184,57,75,138,54,54,184,197,211,76,78,
+102,150,48,254,120,3,251,36,40,23,44,21,164,57,58,164,56,59,164,56,63,252,
+124,1,229,19,60,60,135,249,1,28,200,191,23,84,1,61,57,0,1,0,50,0,0,6,82,5,
+206,0,33,0,0,19,33,62,3,51,50,30,2,23,33,21,33,53,52,46,2,35,34,14,2,21,17,
+33,21,33,53,51,17,33,50,1,142,11,55,93,132,88,88,136,97,59,12,1,143,253,194,
+21,48,79,58,60,81,51,22,2,91,252,0,237,254,122,4,127,88,126,82,39,38,81,127,
+89,164,29,84,114,70,30,31,69,114,82,252,168,162,162,3,57,0,0,1,0,50,0,0,6,
+82,5,206,0,37,0,0,19,33,53,52,54,55,33,53,33,54,51,50,30,2,23,33,21,33,53,
+52,46,2,35,34,14,2,21,17,33,21,33,53,51,17,33,50,1,134,3,5,254,114,1,186,
+82,253,88,136,97,59,12,1,143,253,194,21,48,79,58,60,81,51,22,2,91,252,0,237,
+254,122,3,219,25,38,69,32,164,171,38,81,127,89,164,29,84,114,70,30,31,69,
+114,82,252,168,162,162,2,149,0,1,0,100,254,187,4,101,5,206,0,31,0,0,1,17,
+33,53,51,17,52,62,2,51,50,30,2,21,21,35,53,52,46,2,35,34,14,2,21,17,33,17,
+3,192,252,164,237,44,94,147,102,103,151,99,48,184,21,48,79,58,60,81,51,22,
+2,91,254,187,1,69,162,3,82,127,180,114,53,51,113,179,127,29,29,84,114,70,
+30,31,69,114,82,252,168,254,25,0,0,1,0,100,254,187,4,101,5,206,0,35,0,0,1,
+17,35,17,35,17,33,53,51,17,52,62,2,51,50,30,2,21,21,35,53,52,46,2,35,34,14,
+2,21,17,33,17,3,192,126,164,253,198,237,44,94,147,102,103,151,99,48,184,21,
+48,79,58,60,81,51,22,2,91,254,187,1,69,254,187,1,69,162,3,82,127,180,114,
+53,51,113,179,127,29,29,84,114,70,30,31,69,114,82,252,168,254,25,0,0,1,0,
+0,3,216,0,254,4,238,0,11,0,0,17,52,54,51,50,22,21,20,6,35,34,38,63,62,63,
+66,68,61,59,66,4,99,66,73,72,67,64,75,74,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,
+0,94,0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,1,4,9,0,2,0,14,0,126,0,3,0,1,4,9,
+0,3,0,70,0,140,0,3,0,1,4,9,0,4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,0,210,0,3,0,
+1,4,9,0,6,0,28,0,240,0,3,0,1,4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,8,0,42,1,80,
+0,3,0,1,4,9,0,9,0,40,1,122,0,3,0,1,4,9,0,10,0,96,1,162,0,3,0,1,4,9,0,11,0,
+62,2,2,0,3,0,1,4,9,0,12,0,60,2,64,0,3,0,1,4,9,0,13,2,150,2,124,0,3,0,1,4,
+9,0,14,0,52,5,18,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,
+0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,66,0,114,0,97,0,104,0,109,0,105,0,82,
+0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,
+111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,66,0,114,0,97,0,104,0,109,
+0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,
+32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,66,0,114,0,
+97,0,104,0,109,0,105,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,
+32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,
+32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,
+0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,
+0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,
+0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,
+0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,
+0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,
+0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,
+0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,
+0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,
+0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,
+101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,
+115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,
+46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,
+0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,
+0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,
+83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,
+0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,
+0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,
+0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,
+101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,
+0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,
+0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,
+0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,
+0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,
+0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,
+0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,
+117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,15,0,1,0,0,0,12,0,0,0,52,
+0,0,0,2,0,6,0,0,0,4,0,1,0,5,0,5,0,3,0,6,0,59,0,1,0,60,0,74,0,3,0,75,0,180,
+0,1,0,181,0,181,0,3,0,4,0,0,0,1,0,0,0,1,0,0,0,10,0,34,0,78,0,1,68,70,76,84,
+0,8,0,4,0,0,0,0,255,255,0,3,0,0,0,1,0,2,0,3,100,105,115,116,0,20,109,97,114,
+107,0,26,109,107,109,107,0,38,0,0,0,1,0,0,0,0,0,4,0,1,0,2,0,3,0,4,0,0,0,1,
+0,5,0,7,0,16,1,26,3,58,7,84,7,174,8,174,9,32,0,8,0,0,0,8,0,22,0,48,0,74,0,
+100,0,126,0,152,0,178,0,204,0,3,0,2,0,20,0,208,0,1,9,12,0,0,0,1,0,0,0,6,0,
+1,0,1,0,63,0,3,0,2,0,20,0,182,0,1,8,242,0,0,0,1,0,0,0,6,0,1,0,1,0,62,0,3,
+0,2,0,20,0,156,0,1,8,216,0,0,0,1,0,0,0,6,0,1,0,1,0,60,0,3,0,2,0,20,0,130,
+0,1,8,190,0,0,0,1,0,0,0,6,0,1,0,1,0,70,0,3,0,2,0,20,0,104,0,1,8,164,0,0,0,
+1,0,0,0,6,0,1,0,1,0,72,0,3,0,2,0,20,0,78,0,1,8,138,0,0,0,1,0,0,0,6,0,1,0,
+1,0,73,0,3,0,2,0,20,0,52,0,1,8,112,0,0,0,1,0,0,0,6,0,1,0,1,0,64,0,3,0,2,0,
+20,0,26,0,1,8,86,0,0,0,1,0,0,0,6,0,1,0,1,0,65,0,1,0,16,0,24,0,28,0,31,0,33,
+0,34,0,35,0,36,0,39,0,47,0,49,0,50,0,51,0,52,0,57,0,58,0,59,0,4,0,0,0,1,0,
+8,0,1,0,12,8,16,0,3,0,22,0,60,0,2,0,1,0,64,0,69,0,0,0,6,0,0,0,26,0,0,0,26,
+0,1,1,240,0,1,1,240,0,2,0,32,0,2,0,32,0,1,0,0,0,0,0,1,2,18,0,50,0,37,0,224,
+1,148,1,148,1,130,0,230,0,230,1,208,0,236,1,22,1,202,0,242,1,184,1,202,1,
+130,1,58,1,202,1,112,0,248,1,202,1,64,1,70,1,202,1,112,1,214,1,46,1,52,1,
+214,0,254,1,4,1,100,1,202,1,166,1,58,1,202,1,142,1,40,1,10,1,16,1,118,1,202,
+1,22,1,154,1,202,1,160,1,118,1,28,1,34,1,154,1,202,1,40,1,40,1,46,1,52,1,
+202,1,202,1,196,1,58,1,202,1,160,1,58,1,202,1,64,1,70,1,202,1,64,1,70,1,202,
+1,76,1,148,1,82,1,88,1,148,1,202,1,148,1,94,1,202,1,136,1,100,1,202,1,106,
+1,106,1,202,1,130,1,112,1,202,1,196,1,118,1,208,1,136,1,124,1,202,1,130,1,
+154,1,202,1,136,1,142,1,202,1,148,1,154,1,202,1,160,1,166,1,172,1,178,1,196,
+1,184,1,190,1,196,1,202,1,208,1,214,0,1,2,208,0,0,0,1,3,192,0,0,0,1,4,126,
+0,0,0,1,2,248,0,0,0,1,2,68,0,0,0,1,1,204,0,0,0,1,2,8,0,0,0,1,0,200,0,0,0,
+1,1,4,0,0,0,1,2,168,0,0,0,1,4,36,0,0,0,1,4,116,0,0,0,1,3,82,0,0,0,1,0,240,
+0,0,0,1,1,44,0,0,0,1,2,48,0,0,0,1,2,148,0,0,0,1,2,108,0,0,0,1,4,176,0,160,
+0,1,4,156,0,0,0,1,4,236,0,0,0,1,2,188,0,0,0,1,3,52,0,0,0,1,1,84,0,0,0,1,3,
+92,0,0,0,1,2,28,0,0,0,1,2,158,0,0,0,1,3,132,0,0,0,1,4,176,0,0,0,1,3,72,0,
+0,0,1,3,2,0,0,0,1,2,128,0,0,0,1,3,212,0,0,0,1,3,112,0,0,0,1,0,160,0,0,0,1,
+0,220,0,0,0,1,2,228,0,0,0,1,3,32,0,0,0,1,1,244,0,0,0,1,1,144,0,0,0,1,4,76,
+0,0,0,1,2,88,0,0,0,4,0,0,0,1,0,8,0,1,0,12,5,240,0,5,0,34,0,118,0,2,0,3,0,
+5,0,5,0,0,0,60,0,63,0,1,0,70,0,74,0,5,0,10,0,4,5,122,0,1,0,42,0,2,0,48,0,
+0,0,54,0,0,0,54,0,3,0,60,0,3,0,66,0,3,0,72,0,3,0,72,0,4,0,78,0,1,255,241,
+5,190,0,1,1,239,5,15,0,1,255,246,5,190,0,1,0,20,5,190,0,1,0,20,7,8,0,1,2,
+103,5,190,0,1,1,41,6,74,0,37,1,218,1,218,1,116,1,116,2,154,1,122,1,128,1,
+134,1,140,3,228,1,236,1,236,1,236,3,96,3,234,3,60,3,60,3,60,3,60,3,240,2,
+76,1,146,3,42,1,152,1,158,2,208,2,208,3,42,3,36,2,70,3,108,3,108,1,164,1,
+170,1,176,1,206,1,206,3,42,1,182,5,98,1,188,1,188,1,194,3,60,3,228,1,200,
+1,200,1,206,1,212,2,202,1,218,1,224,3,36,1,230,3,228,2,46,2,52,2,58,2,64,
+2,70,1,236,1,236,1,242,3,30,1,248,3,108,3,108,2,34,2,34,2,40,1,254,2,4,2,
+10,2,16,2,22,2,28,2,28,2,34,3,96,2,40,2,46,2,52,2,58,2,64,2,70,3,54,3,54,
+3,60,2,76,2,82,3,108,3,108,2,88,2,94,2,100,2,106,2,106,2,112,2,118,3,222,
+3,12,3,12,3,60,3,60,3,66,2,124,2,124,3,60,3,60,3,66,2,130,2,136,2,142,2,148,
+2,154,2,160,2,172,2,166,2,172,2,178,2,184,2,184,2,190,2,196,2,202,2,208,2,
+208,3,42,3,42,3,48,2,214,2,214,2,220,2,220,2,226,2,232,2,232,2,238,3,78,3,
+84,2,244,2,244,2,244,2,244,2,250,3,108,3,108,3,0,3,96,3,6,3,12,3,12,3,60,
+3,18,3,24,3,30,3,30,3,36,3,42,3,48,3,54,3,54,3,60,3,60,3,66,3,72,3,72,3,78,
+3,78,3,84,3,90,3,90,3,96,3,102,3,216,3,108,3,108,3,114,3,120,3,216,3,126,
+3,132,3,138,3,144,3,150,0,1,3,2,5,190,0,1,2,198,5,190,0,1,3,12,5,190,0,1,
+3,32,5,120,0,1,3,192,3,32,0,1,1,64,3,92,0,1,1,64,3,132,0,1,2,38,6,74,0,1,
+2,98,5,190,0,1,2,118,5,190,0,1,2,108,6,74,0,1,1,44,4,126,0,1,3,112,5,190,
+0,1,3,182,5,190,0,1,1,244,5,40,0,1,1,244,5,190,0,1,2,13,3,232,0,1,2,188,5,
+190,0,1,1,26,3,32,0,1,1,29,3,92,0,1,2,168,5,190,0,1,2,218,5,190,0,1,2,218,
+6,74,0,1,1,204,5,190,0,1,1,204,3,92,0,1,3,142,5,190,0,1,2,48,3,182,0,1,2,
+48,6,74,0,1,2,68,5,190,0,1,2,128,5,190,0,1,2,128,6,74,0,1,3,232,5,120,0,1,
+5,50,3,132,0,1,3,232,5,60,0,1,2,88,5,120,0,1,3,42,6,74,0,1,1,64,5,190,0,1,
+1,24,6,74,0,1,2,168,5,80,0,1,1,124,5,190,0,1,2,8,6,74,0,1,1,224,5,190,0,1,
+2,38,5,190,0,1,2,48,5,190,0,1,0,240,5,190,0,1,1,84,5,60,0,1,4,176,5,60,0,
+1,5,0,5,60,0,1,1,104,5,60,0,1,3,2,6,74,0,1,1,164,4,26,0,1,6,64,5,190,0,1,
+4,246,2,88,0,1,3,62,6,74,0,1,4,76,5,190,0,1,4,146,5,190,0,1,1,84,5,190,0,
+1,2,188,6,74,0,1,2,248,5,190,0,1,1,4,5,190,0,1,1,74,5,190,0,1,1,74,6,74,0,
+1,4,106,5,190,0,1,4,176,5,190,0,1,1,254,5,190,0,1,1,254,6,74,0,1,2,158,5,
+190,0,1,2,158,6,74,0,1,0,210,5,190,0,1,1,34,5,190,0,1,1,34,6,74,0,1,2,228,
+5,190,0,1,3,42,5,190,0,1,3,52,5,190,0,1,3,52,6,74,0,1,0,220,5,190,0,1,1,44,
+5,190,0,1,1,44,6,74,0,1,4,196,5,190,0,1,4,186,5,190,0,1,4,186,6,74,0,1,3,
+192,4,176,0,1,2,148,5,190,0,1,1,144,5,20,0,1,2,88,5,190,0,1,3,32,5,190,0,
+1,1,244,5,140,0,1,1,144,5,210,0,1,3,192,4,136,0,1,3,132,5,120,0,1,1,244,4,
+176,0,1,2,208,6,74,0,4,0,0,0,1,0,8,0,1,1,102,0,12,0,1,1,124,0,22,0,2,0,1,
+0,9,0,22,0,0,0,14,0,42,0,42,0,42,0,30,0,36,0,36,0,42,0,42,0,42,0,42,0,48,
+0,48,0,54,0,54,0,1,2,148,6,74,0,1,2,28,6,74,0,1,2,88,6,74,0,1,2,168,6,74,
+0,1,2,228,6,74,0,4,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,74,0,86,0,1,0,1,0,181,
+0,1,0,26,0,13,0,14,0,15,0,16,0,21,0,22,0,23,0,26,0,27,0,29,0,32,0,33,0,36,
+0,37,0,38,0,40,0,42,0,43,0,44,0,46,0,48,0,51,0,53,0,54,0,55,0,56,0,1,0,0,
+0,6,0,1,0,0,3,212,0,26,0,114,0,114,0,54,0,54,0,108,0,108,0,60,0,150,0,78,
+0,66,0,72,0,78,0,84,0,90,0,96,0,102,0,108,0,150,0,114,0,120,0,126,0,132,0,
+138,0,144,0,150,0,156,0,1,3,152,1,214,0,1,3,252,3,212,0,1,3,32,3,212,0,1,
+2,208,4,136,0,1,2,88,2,128,0,1,3,52,3,212,0,1,2,248,2,128,0,1,3,72,3,212,
+0,1,1,244,4,136,0,1,2,248,3,212,0,1,2,28,3,212,0,1,5,130,1,124,0,1,4,116,
+3,212,0,1,2,188,3,212,0,1,2,28,4,116,0,1,4,76,3,212,0,1,2,88,3,212,0,1,5,
+140,3,212,0,6,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,34,0,46,0,1,0,1,0,5,0,2,0,2,
+0,60,0,63,0,0,0,70,0,73,0,4,0,1,0,0,0,6,0,1,0,140,6,74,0,8,0,18,0,24,0,30,
+0,36,0,42,0,48,0,54,0,54,0,1,1,4,6,74,0,1,1,44,7,88,0,1,1,4,7,28,0,1,1,94,
+7,28,0,1,254,232,6,74,0,1,254,232,7,108,0,1,2,68,6,74,0,1,0,0,0,1,0,8,0,1,
+0,10,0,5,1,44,1,44,0,2,0,1,0,23,0,59,0,0,0,0,0,1,0,0,0,10,0,30,0,46,0,1,68,
+70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,0,8,0,0,0,2,0,
+0,0,1,0,3,0,8,2,220,3,46,0,4,0,0,0,1,0,8,0,1,2,158,0,28,0,62,0,80,0,98,0,
+116,0,134,0,176,0,194,0,212,0,230,1,8,1,26,1,44,1,78,1,96,1,114,1,132,1,150,
+1,184,1,218,1,236,1,254,2,16,2,34,2,52,2,70,2,88,2,106,2,124,0,2,0,6,0,12,
+0,112,0,2,0,64,0,113,0,2,0,65,0,2,0,6,0,12,0,114,0,2,0,64,0,115,0,2,0,65,
+0,2,0,6,0,12,0,116,0,2,0,64,0,117,0,2,0,65,0,2,0,6,0,12,0,118,0,2,0,64,0,
+119,0,2,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,120,0,2,0,60,0,121,0,2,0,72,0,
+122,0,2,0,73,0,123,0,2,0,64,0,124,0,2,0,65,0,2,0,6,0,12,0,125,0,2,0,72,0,
+126,0,2,0,73,0,2,0,6,0,12,0,127,0,2,0,72,0,128,0,2,0,73,0,2,0,6,0,12,0,129,
+0,2,0,64,0,130,0,2,0,65,0,4,0,10,0,16,0,22,0,28,0,131,0,2,0,72,0,132,0,2,
+0,73,0,133,0,2,0,64,0,134,0,2,0,65,0,2,0,6,0,12,0,135,0,2,0,64,0,136,0,2,
+0,65,0,2,0,6,0,12,0,137,0,2,0,64,0,138,0,2,0,65,0,4,0,10,0,16,0,22,0,28,0,
+139,0,2,0,72,0,140,0,2,0,73,0,141,0,2,0,64,0,142,0,2,0,65,0,2,0,6,0,12,0,
+143,0,2,0,72,0,144,0,2,0,73,0,2,0,6,0,12,0,145,0,2,0,64,0,146,0,2,0,65,0,
+2,0,6,0,12,0,147,0,2,0,64,0,148,0,2,0,65,0,2,0,6,0,12,0,149,0,2,0,64,0,150,
+0,2,0,65,0,4,0,10,0,16,0,22,0,28,0,151,0,2,0,72,0,152,0,2,0,73,0,153,0,2,
+0,64,0,154,0,2,0,65,0,4,0,10,0,16,0,22,0,28,0,155,0,2,0,72,0,156,0,2,0,73,
+0,157,0,2,0,64,0,158,0,2,0,65,0,2,0,6,0,12,0,159,0,2,0,64,0,160,0,2,0,65,
+0,2,0,6,0,12,0,161,0,2,0,64,0,162,0,2,0,65,0,2,0,6,0,12,0,163,0,2,0,64,0,
+164,0,2,0,65,0,2,0,6,0,12,0,165,0,2,0,64,0,166,0,2,0,65,0,2,0,6,0,12,0,167,
+0,2,0,64,0,168,0,2,0,65,0,2,0,6,0,12,0,169,0,2,0,64,0,170,0,2,0,65,0,2,0,
+6,0,12,0,171,0,2,0,64,0,172,0,2,0,65,0,2,0,6,0,12,0,173,0,2,0,72,0,174,0,
+2,0,73,0,2,0,6,0,12,0,175,0,2,0,72,0,176,0,2,0,73,0,4,0,10,0,16,0,22,0,28,
+0,177,0,2,0,72,0,178,0,2,0,73,0,179,0,2,0,64,0,180,0,2,0,65,0,2,0,7,0,26,
+0,34,0,0,0,36,0,37,0,9,0,39,0,39,0,11,0,41,0,45,0,12,0,47,0,48,0,17,0,50,
+0,51,0,19,0,53,0,59,0,21,0,6,0,0,0,1,0,8,0,3,0,1,0,18,0,1,0,88,0,0,0,1,0,
+0,0,2,0,1,0,26,0,13,0,14,0,15,0,16,0,21,0,22,0,23,0,26,0,27,0,29,0,32,0,33,
+0,36,0,37,0,38,0,40,0,42,0,43,0,44,0,46,0,48,0,51,0,53,0,54,0,55,0,56,0,1,
+0,0,0,1,0,8,0,1,0,6,0,177,0,1,0,1,0,4,};
+#endif
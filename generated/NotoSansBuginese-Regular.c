@@ -0,0 +1,349 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansBuginese_Regular_ttf_size = 8512;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansBuginese_Regular_ttf");
+asm(".type fz_font_NotoSansBuginese_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansBuginese_Regular_ttf, 8512");
+asm(".balign 64");
+asm("fz_font_NotoSansBuginese_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansBuginese-Regular.ttf\"");
+#else
+const int fz_font_NotoSansBuginese_Regular_ttf_size = 8512;
+const char fz_font_NotoSansBuginese_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,184,0,192,0,0,29,244,0,0,0,54,71,
+80,79,83,49,227,37,95,0,0,30,44,0,0,1,132,71,83,85,66,41,241,37,68,0,0,31,
+176,0,0,1,144,79,83,47,50,125,43,111,62,0,0,1,104,0,0,0,96,99,109,97,112,
+188,4,137,185,0,0,2,196,0,0,0,122,103,97,115,112,0,7,0,7,0,0,29,232,0,0,0,
+12,103,108,121,102,226,196,63,77,0,0,3,192,0,0,17,104,104,101,97,100,4,226,
+179,217,0,0,0,236,0,0,0,54,104,104,101,97,15,48,10,165,0,0,1,36,0,0,0,36,
+104,109,116,120,210,74,3,151,0,0,1,200,0,0,0,252,108,111,99,97,156,150,161,
+32,0,0,3,64,0,0,0,128,109,97,120,112,0,87,0,219,0,0,1,72,0,0,0,32,110,97,
+109,101,142,4,185,216,0,0,21,40,0,0,6,12,112,111,115,116,112,100,83,220,0,
+0,27,52,0,0,2,177,0,1,0,0,0,1,12,205,115,212,138,17,95,15,60,245,0,11,8,0,
+0,0,0,0,204,181,105,224,0,0,0,0,210,109,241,206,248,242,254,131,13,174,7,
+221,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,13,205,248,242,254,
+240,13,174,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,1,0,0,0,63,0,128,0,16,0,
+89,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,8,83,1,144,0,5,0,0,5,154,5,
+51,0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,
+8,141,2,88,0,0,0,1,0,0,0,0,5,129,7,221,0,0,0,32,0,4,4,205,0,193,0,0,0,0,4,
+20,0,0,2,20,0,0,5,106,0,6,8,94,0,39,4,215,0,47,6,10,0,39,8,94,0,39,5,106,
+0,47,7,143,0,31,7,6,0,47,7,143,0,31,7,143,0,31,7,143,0,31,8,94,0,39,8,94,
+0,35,6,70,0,35,9,197,0,31,10,154,0,31,9,193,0,31,5,131,0,31,9,252,0,31,9,
+193,0,31,4,156,0,31,9,186,0,25,8,70,0,31,0,0,253,104,0,0,253,96,2,219,0,111,
+4,82,0,51,0,0,248,242,4,8,0,66,4,78,0,98,0,0,0,0,9,193,0,31,8,55,0,111,11,
+145,0,111,8,10,0,111,9,0,0,111,11,145,0,111,8,158,0,111,10,92,0,111,10,57,
+0,111,10,195,0,111,10,92,0,111,10,195,0,111,11,145,0,111,11,145,0,111,9,121,
+0,111,12,43,0,111,13,205,0,111,12,244,0,111,7,233,0,111,12,201,0,111,12,244,
+0,111,6,217,0,111,12,238,0,111,10,131,0,111,3,172,0,126,0,0,0,0,0,0,255,220,
+4,193,0,98,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,110,0,0,0,22,0,16,0,3,0,6,0,0,0,
+13,0,32,0,160,26,27,26,31,32,13,37,204,169,207,254,255,255,255,0,0,0,0,0,
+13,0,32,0,160,26,0,26,30,32,11,37,204,169,207,254,255,255,255,0,1,255,245,
+255,227,255,99,230,4,230,2,0,0,218,114,86,108,1,2,0,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,10,0,0,0,0,0,0,0,0,0,60,0,61,0,34,0,0,0,0,0,21,0,21,0,21,0,21,0,46,
+0,128,0,153,0,209,1,24,1,80,1,117,1,175,1,211,1,223,1,235,2,74,2,154,2,210,
+3,52,3,120,3,219,4,26,4,106,4,182,4,244,5,74,5,182,5,200,5,218,5,254,6,31,
+6,64,6,106,6,168,6,168,6,180,6,192,6,204,6,216,6,228,6,240,6,252,7,8,7,20,
+7,32,7,48,7,64,7,76,7,88,7,100,7,112,7,124,7,136,7,148,7,160,7,172,7,184,
+7,196,7,208,8,0,8,0,8,13,8,180,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,
+17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,
+0,0,2,0,6,0,2,5,102,4,135,0,3,0,7,0,0,19,1,23,1,5,1,23,1,6,3,94,121,252,162,
+1,16,3,93,122,252,164,1,135,3,0,137,253,2,119,2,254,137,253,4,0,2,0,39,0,
+0,7,193,5,18,0,43,0,52,0,0,55,1,54,54,51,50,22,23,23,22,22,51,50,54,55,55,
+54,53,52,38,38,1,55,1,22,22,21,20,14,3,7,34,38,39,39,38,38,35,34,6,7,1,37,
+52,51,50,21,20,6,35,34,39,1,252,76,129,86,73,119,78,199,65,90,54,53,90,65,
+9,67,24,60,254,6,115,2,18,62,68,41,84,150,102,82,90,117,62,198,66,90,53,53,
+88,68,254,31,2,47,125,129,76,53,125,135,1,205,68,81,71,94,228,78,77,59,66,
+10,67,60,35,55,74,2,63,100,253,166,69,107,71,68,94,90,131,52,4,96,70,227,
+78,80,63,64,254,78,139,137,137,73,66,0,1,0,47,0,0,5,18,4,96,0,7,0,0,1,1,7,
+1,1,39,1,1,1,156,3,118,110,254,63,253,197,121,2,62,254,188,4,96,252,0,96,
+2,0,254,0,135,2,0,1,119,0,1,0,39,0,0,6,45,3,174,0,29,0,0,1,1,38,38,35,34,
+6,7,7,22,22,23,1,7,1,38,38,35,34,7,1,39,1,54,54,51,50,22,23,1,5,188,254,230,
+68,88,53,53,88,68,16,75,97,55,1,63,110,254,217,66,90,53,66,88,254,142,121,
+2,123,76,129,86,65,115,90,1,90,1,18,1,70,76,82,64,63,15,6,82,57,254,152,111,
+1,80,76,80,76,254,176,135,2,64,67,84,63,103,254,121,0,1,0,39,0,0,7,193,5,
+18,0,43,0,0,55,1,54,54,51,50,22,23,23,22,22,51,50,54,55,55,54,53,52,38,38,
+1,55,1,22,22,21,20,14,3,7,34,38,39,39,38,38,35,34,6,7,1,39,1,252,76,129,86,
+73,119,78,199,65,90,54,53,90,65,9,67,24,60,254,6,115,2,18,62,68,41,84,150,
+102,82,90,117,62,198,66,90,53,53,88,68,254,31,135,1,205,68,81,71,94,228,78,
+77,59,66,10,67,60,35,55,74,2,63,100,253,166,69,107,71,68,94,90,131,52,4,96,
+70,227,78,80,63,64,254,78,0,0,1,0,47,0,0,5,137,5,133,0,31,0,0,55,1,39,38,
+38,53,52,62,2,51,50,22,22,1,7,39,38,38,35,34,6,7,6,21,20,22,23,1,7,1,1,47,
+2,57,65,62,71,74,213,110,64,49,80,71,1,82,117,210,58,90,49,47,64,65,115,64,
+65,2,55,110,254,61,253,199,135,1,254,78,70,106,76,74,133,182,49,31,59,254,
+127,102,241,68,80,33,59,93,77,50,90,75,253,116,96,1,254,254,2,0,0,1,0,31,
+0,0,7,113,3,174,0,17,0,0,19,1,22,22,51,50,54,55,1,23,1,6,6,35,34,38,39,1,
+145,2,15,65,88,54,53,88,67,2,183,123,253,45,76,129,86,70,110,90,253,178,3,
+174,253,168,76,82,64,63,2,119,135,253,111,68,82,61,105,2,160,0,0,1,0,47,0,
+0,6,195,4,96,0,31,0,0,55,1,1,55,1,22,22,51,50,62,2,55,52,38,38,1,55,1,22,
+22,21,14,3,35,34,38,39,1,1,47,2,62,254,188,115,2,157,60,92,53,39,61,119,39,
+2,26,66,254,168,113,1,123,71,58,5,45,153,142,86,69,107,96,254,223,253,197,
+135,2,0,1,119,98,252,250,67,78,30,103,55,53,31,64,84,1,149,94,254,78,82,108,
+66,76,100,145,95,58,108,1,76,254,0,0,0,1,0,31,0,0,7,113,3,174,0,17,0,0,33,
+1,38,38,35,34,6,7,1,39,1,54,54,51,50,22,23,1,6,254,253,242,66,88,53,53,89,
+67,253,74,123,2,209,75,131,86,66,107,98,2,78,2,88,76,82,64,63,253,137,135,
+2,144,67,84,57,109,253,94,255,255,0,31,0,0,7,113,3,174,2,38,0,10,0,0,0,7,
+0,28,5,174,4,12,255,255,0,31,255,254,7,113,3,174,2,38,0,12,0,0,0,7,0,28,6,
+45,1,123,0,2,0,39,255,227,7,193,5,18,0,43,0,59,0,0,55,1,54,54,51,50,22,23,
+23,22,22,51,50,54,55,55,54,53,52,38,38,1,55,1,22,22,21,20,14,3,7,34,38,39,
+39,38,38,35,34,6,7,1,5,39,38,38,35,34,6,7,39,55,54,54,51,50,22,19,39,1,252,
+76,129,86,73,119,78,199,65,90,54,53,90,65,9,67,24,60,254,6,115,2,18,62,68,
+41,84,150,102,82,90,117,62,198,66,90,53,53,88,68,254,31,3,123,119,27,31,18,
+10,23,170,123,205,33,43,35,33,51,235,135,1,205,68,81,71,94,228,76,79,59,66,
+10,67,60,35,55,74,2,63,100,253,166,69,107,71,68,94,90,131,52,4,96,70,227,
+78,80,63,64,254,78,29,140,28,29,12,156,133,193,28,29,45,254,246,0,0,2,0,35,
+255,233,7,193,5,18,0,28,0,46,0,0,1,23,22,22,51,50,54,55,54,53,52,38,38,1,
+55,1,22,22,21,20,14,3,35,34,38,39,1,5,3,38,38,35,34,6,7,1,39,1,54,54,51,50,
+22,23,1,4,37,215,65,89,53,51,88,111,67,24,60,254,6,115,2,18,62,68,27,62,182,
+143,76,65,115,90,254,231,2,47,229,66,90,53,53,88,68,253,68,121,2,215,76,129,
+86,65,107,98,1,39,2,55,248,75,80,57,111,67,60,35,55,74,2,63,100,253,166,69,
+107,71,60,76,82,172,82,64,102,1,66,119,1,6,76,82,64,63,253,147,138,2,133,
+67,82,57,109,254,177,0,0,1,0,35,0,18,6,41,3,166,0,34,0,0,55,39,1,54,54,51,
+50,22,22,19,22,21,20,7,7,6,6,35,34,38,38,39,55,22,51,50,54,55,39,38,38,35,
+34,6,7,156,121,2,160,118,146,78,59,96,90,226,57,55,181,110,146,84,53,86,74,
+98,115,94,92,68,135,176,59,78,107,65,64,110,86,18,138,2,92,106,68,37,78,254,
+254,57,35,29,51,168,100,74,29,55,109,102,111,101,168,65,92,91,74,78,0,2,0,
+31,0,0,9,166,3,176,0,44,0,60,0,0,1,34,6,7,1,39,1,54,54,51,50,22,23,23,22,
+22,51,50,54,55,54,54,51,50,22,23,1,7,1,38,38,35,34,6,7,7,6,6,35,34,38,39,
+39,38,38,19,23,22,51,50,54,55,55,23,7,6,6,35,34,39,39,2,246,53,89,67,254,
+113,119,1,168,75,129,86,66,107,98,131,37,41,28,25,61,215,76,129,88,66,104,
+99,1,98,109,254,217,67,88,53,52,90,67,215,54,75,43,43,68,41,168,55,82,123,
+108,113,108,86,134,67,88,129,137,76,162,110,180,131,154,2,248,64,63,254,153,
+138,1,125,69,82,57,109,145,45,45,49,201,69,82,55,111,254,103,93,1,70,74,84,
+64,63,197,51,41,51,47,193,61,64,254,192,129,131,88,70,90,129,137,76,86,160,
+176,0,0,1,0,31,0,0,10,123,3,174,0,37,0,0,33,1,1,39,1,38,38,35,34,6,7,1,39,
+1,54,54,51,50,22,22,23,54,54,51,50,22,23,1,7,1,38,38,35,34,6,7,7,1,6,254,
+254,131,254,35,123,1,223,100,80,51,53,89,67,253,74,123,2,209,75,131,86,50,
+80,79,150,225,117,78,65,107,98,2,78,115,253,242,66,88,53,53,88,68,104,1,127,
+1,178,254,78,135,1,180,117,70,64,63,253,137,135,2,144,67,84,29,65,172,201,
+65,57,109,253,94,102,2,88,76,82,64,63,94,254,77,0,3,0,31,0,41,9,162,3,20,
+0,44,0,53,0,62,0,0,1,34,6,7,1,39,1,54,54,51,50,22,23,23,22,22,51,50,54,55,
+19,54,54,51,50,22,23,1,7,1,38,38,35,34,6,7,3,6,6,35,34,38,39,1,38,3,52,51,
+50,21,20,6,35,34,37,52,51,50,21,20,6,35,34,2,203,33,61,64,254,121,135,1,172,
+76,106,57,64,90,63,187,80,45,20,27,63,49,248,76,109,57,63,91,65,1,115,117,
+254,203,55,62,33,35,61,61,236,70,104,63,56,84,84,254,254,30,183,125,129,76,
+53,125,4,150,125,129,76,53,125,2,92,55,74,254,80,123,1,215,84,67,81,84,240,
+107,34,67,53,1,19,84,67,81,86,254,22,88,1,147,76,82,59,70,254,252,78,94,66,
+112,1,86,41,254,88,137,137,74,65,139,137,137,74,65,0,2,0,31,0,31,5,100,3,
+231,0,17,0,33,0,0,1,39,38,38,35,34,6,7,1,39,1,54,54,51,50,22,23,1,3,3,38,
+38,35,34,7,5,39,1,54,54,51,50,22,1,4,242,217,66,88,53,54,88,67,254,29,119,
+1,250,75,131,86,74,119,78,1,24,172,231,27,28,21,24,74,254,233,123,1,123,33,
+43,35,37,61,1,78,1,150,251,78,80,63,64,254,78,135,1,205,68,81,71,94,254,186,
+254,35,1,10,31,26,69,254,133,1,92,31,26,57,254,129,0,0,2,0,31,0,166,9,223,
+4,25,0,17,0,47,0,0,37,1,38,38,35,34,6,7,7,39,55,54,54,51,50,22,23,1,1,34,
+6,1,39,1,54,54,51,50,22,23,23,22,22,51,50,54,55,23,7,6,6,35,34,38,39,39,38,
+38,9,111,254,47,66,90,53,51,88,68,160,121,185,75,132,86,65,107,96,2,16,249,
+23,49,82,254,35,119,1,168,75,129,86,74,111,86,153,66,90,53,58,102,186,129,
+172,71,133,88,66,109,94,178,53,84,176,2,19,77,80,63,64,143,135,170,68,82,
+56,108,253,170,1,116,57,254,86,135,1,127,68,84,62,98,178,78,80,78,186,129,
+170,71,78,59,107,203,61,63,0,1,0,31,0,43,9,162,3,20,0,44,0,0,1,34,6,7,1,39,
+1,54,54,51,50,22,23,23,22,22,51,50,54,55,19,54,54,51,50,22,23,1,7,1,38,38,
+35,34,6,7,3,6,6,35,34,38,39,1,38,2,203,33,61,64,254,121,135,1,172,76,106,
+57,64,90,63,187,80,45,20,27,63,49,248,76,109,57,63,91,65,1,115,117,254,203,
+55,62,33,35,61,61,236,70,104,63,56,84,84,254,254,30,2,92,55,74,254,80,123,
+1,215,84,67,81,84,240,107,34,67,53,1,19,84,67,81,86,254,22,88,1,147,76,82,
+59,70,254,252,78,94,66,112,1,86,41,0,2,0,31,0,47,4,127,3,180,0,24,0,38,0,
+0,1,20,7,7,6,6,35,34,38,38,39,38,38,53,52,55,62,2,51,50,22,23,23,22,5,30,
+2,51,50,54,54,55,38,38,35,34,6,4,127,55,197,111,145,84,53,86,74,98,174,43,
+53,195,143,137,64,75,125,113,160,55,252,109,131,75,70,37,35,65,76,219,106,
+141,62,57,101,1,227,28,52,182,100,74,29,55,109,190,64,18,31,49,178,125,53,
+65,125,187,55,33,153,66,33,25,55,201,127,125,59,0,0,2,0,25,0,41,9,156,3,20,
+0,42,0,51,0,0,1,34,7,1,39,0,0,51,50,22,23,23,22,22,51,50,54,55,19,54,54,51,
+50,22,23,1,7,1,38,38,35,34,6,7,3,6,6,35,34,38,39,1,38,1,52,51,50,21,20,6,
+35,34,2,195,43,60,254,68,135,1,24,1,33,98,64,90,63,185,77,46,24,27,63,49,
+248,76,108,56,63,92,66,1,115,119,254,205,56,61,33,35,61,62,235,72,102,64,
+55,84,84,254,252,31,3,228,125,129,76,53,125,2,92,69,254,20,123,1,55,1,55,
+81,84,240,102,39,67,53,1,19,84,67,81,86,254,22,88,1,147,76,82,59,70,254,252,
+78,94,66,112,1,86,41,254,88,137,137,74,65,0,3,0,31,0,47,8,41,3,178,0,41,0,
+56,0,70,0,0,1,20,7,7,6,6,35,34,38,38,39,39,4,6,6,35,34,38,38,39,38,38,53,
+52,55,62,2,51,50,22,22,23,55,54,54,51,50,22,23,23,22,5,22,22,51,50,54,54,
+55,39,38,38,35,34,6,7,5,22,22,51,50,54,54,55,38,38,35,34,6,7,8,41,55,197,
+111,145,84,53,86,74,98,125,254,252,101,92,55,55,86,78,92,181,30,53,192,150,
+156,41,61,102,95,176,172,121,141,78,76,124,113,152,55,252,111,151,105,55,
+35,65,76,219,49,78,110,64,63,113,86,251,197,129,110,68,41,82,112,162,119,
+123,63,64,112,84,1,227,28,52,182,100,74,29,55,109,139,232,67,33,33,61,103,
+200,52,16,31,49,178,129,47,41,82,205,154,109,65,65,125,185,55,35,180,70,25,
+55,201,66,90,94,74,80,127,155,95,41,99,145,141,105,70,82,0,1,253,104,5,16,
+254,102,6,37,0,8,0,0,1,52,51,50,21,20,6,35,34,253,104,125,129,75,54,125,5,
+156,137,137,74,66,0,1,253,96,254,131,254,94,255,152,0,8,0,0,5,52,51,50,21,
+20,6,35,34,253,96,125,129,76,53,125,242,138,138,73,66,0,0,1,0,111,255,170,
+3,12,4,2,0,17,0,0,19,52,54,55,1,23,7,6,6,21,20,22,23,1,7,1,38,38,111,49,57,
+1,64,122,229,57,66,43,39,1,135,121,254,50,43,43,2,66,43,71,49,1,29,133,205,
+51,59,27,27,49,41,254,90,98,1,250,47,70,0,1,0,51,0,4,5,98,3,197,0,15,0,0,
+37,7,1,38,35,6,6,1,39,1,54,54,51,50,22,23,5,98,114,253,155,78,26,27,67,254,
+233,123,1,51,58,69,37,41,72,49,106,102,2,156,92,2,49,254,243,136,1,32,54,
+43,43,58,0,1,248,242,4,106,251,29,7,221,0,15,0,0,1,1,22,21,20,6,6,7,39,55,
+54,55,55,52,38,1,249,98,1,117,70,23,104,215,117,162,82,2,2,11,254,179,7,221,
+254,84,78,41,28,47,84,177,138,137,61,27,8,10,19,1,127,0,0,3,0,66,0,2,3,203,
+4,39,0,8,0,17,0,26,0,0,19,52,51,50,21,20,6,35,34,1,52,51,50,21,20,6,35,34,
+1,52,51,50,21,20,6,35,34,66,124,129,75,54,124,2,139,125,129,76,53,125,254,
+184,125,129,76,53,125,3,158,137,137,74,66,253,123,138,138,73,66,2,23,137,
+137,74,66,0,0,2,0,98,255,168,3,233,4,221,0,19,0,37,0,0,1,39,38,38,35,34,6,
+7,7,39,55,54,55,53,51,21,22,22,23,23,5,22,22,51,50,54,55,55,23,7,6,7,21,35,
+53,38,38,3,3,121,96,66,88,53,54,88,67,156,121,183,127,88,149,60,86,51,157,
+252,236,184,76,43,53,88,68,154,120,180,133,88,152,47,75,226,2,88,109,77,80,
+63,64,139,135,166,119,20,205,205,16,84,53,187,165,213,54,64,63,140,136,166,
+118,25,178,182,17,63,1,4,255,255,0,31,0,41,9,162,4,122,2,34,0,20,0,0,0,3,
+0,27,3,123,254,85,255,255,0,111,255,170,8,51,4,135,0,34,0,29,0,0,0,3,0,4,
+2,205,0,0,255,255,0,111,255,170,10,244,5,18,0,34,0,29,0,0,0,3,0,5,3,51,0,
+0,255,255,0,111,255,170,8,69,4,96,0,34,0,29,0,0,0,3,0,6,3,51,0,0,255,255,
+0,111,255,170,9,35,4,2,0,34,0,29,0,0,0,3,0,7,2,246,0,0,255,255,0,111,255,
+170,10,244,5,18,0,34,0,29,0,0,0,3,0,8,3,51,0,0,255,255,0,111,255,170,8,188,
+5,133,0,34,0,29,0,0,0,3,0,9,3,51,0,0,255,255,0,111,255,170,10,62,4,2,0,34,
+0,29,0,0,0,3,0,10,2,205,0,0,255,255,0,111,255,170,9,246,4,96,0,34,0,29,0,
+0,0,3,0,11,3,51,0,0,255,255,0,111,255,170,10,164,4,2,0,34,0,29,0,0,0,3,0,
+12,3,51,0,0,255,255,0,111,255,170,10,62,4,2,0,38,0,29,0,0,0,39,0,10,2,205,
+0,0,0,7,0,27,8,115,253,130,255,255,0,111,255,170,10,164,4,2,0,38,0,29,0,0,
+0,39,0,12,3,51,0,0,0,7,0,28,9,96,1,123,255,255,0,111,255,170,10,244,5,18,
+0,34,0,29,0,0,0,3,0,15,3,51,0,0,255,255,0,111,255,170,10,244,5,18,0,34,0,
+29,0,0,0,3,0,16,3,51,0,0,255,255,0,111,255,170,9,92,4,2,0,34,0,29,0,0,0,3,
+0,17,3,51,0,0,255,255,0,111,255,170,12,12,4,2,0,34,0,29,0,0,0,3,0,18,2,102,
+0,0,255,255,0,111,255,170,13,174,4,2,0,34,0,29,0,0,0,3,0,19,3,51,0,0,255,
+255,0,111,255,170,12,213,4,2,0,34,0,29,0,0,0,3,0,20,3,51,0,0,255,255,0,111,
+255,170,7,202,4,2,0,34,0,29,0,0,0,3,0,21,2,102,0,0,255,255,0,111,255,170,
+12,172,4,25,0,34,0,29,0,0,0,3,0,22,2,205,0,0,255,255,0,111,255,170,12,213,
+4,2,0,34,0,29,0,0,0,3,0,23,3,51,0,0,255,255,0,111,255,170,6,188,4,2,0,34,
+0,29,0,0,0,3,0,24,2,61,0,0,255,255,0,111,255,170,12,207,4,2,0,34,0,29,0,0,
+0,3,0,25,3,51,0,0,255,255,0,111,255,170,10,102,4,2,0,34,0,29,0,0,0,3,0,26,
+2,61,0,0,0,1,0,126,255,236,3,47,4,106,0,30,0,0,1,20,6,35,34,39,22,18,21,20,
+7,6,35,34,39,54,53,52,2,39,38,53,52,55,4,51,50,53,54,51,50,3,47,142,129,67,
+80,87,99,36,24,36,35,26,40,180,148,12,12,1,21,137,142,24,37,37,4,94,128,138,
+19,127,254,201,168,143,129,13,13,126,131,205,1,135,121,42,34,33,42,96,96,
+12,0,1,255,220,0,183,0,36,6,131,0,3,0,0,19,17,35,17,36,72,6,131,250,52,5,
+204,0,16,0,98,0,86,4,94,4,82,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,
+0,79,0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,
+34,53,52,51,50,19,20,35,34,53,52,51,50,23,20,35,34,53,52,51,50,1,20,35,34,
+53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,
+51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,
+7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,37,20,35,34,53,52,51,50,19,
+20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,3,215,51,55,55,51,147,52,57,
+57,52,247,55,53,55,53,35,51,55,55,51,254,56,54,53,53,54,173,55,53,53,55,2,
+82,55,53,53,55,253,27,55,54,54,55,2,129,51,55,55,51,147,52,57,57,52,253,174,
+52,57,55,54,35,53,56,56,53,1,199,54,53,53,54,254,92,54,55,55,54,247,55,53,
+53,55,147,55,54,54,55,3,150,54,54,55,43,53,53,55,254,211,55,55,53,227,53,
+53,53,1,148,56,56,53,90,53,53,55,253,119,53,53,55,1,185,54,51,58,253,67,53,
+53,56,154,51,51,55,2,29,55,55,53,227,53,53,53,254,4,55,55,54,227,53,53,55,
+254,213,55,51,55,43,53,53,56,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,
+3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,
+144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,
+0,32,0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,
+9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,11,0,62,2,14,0,
+3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,0,1,4,9,0,14,0,
+52,5,30,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,
+48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,
+0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,
+82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,
+0,32,0,83,0,97,0,110,0,115,0,32,0,66,0,117,0,103,0,105,0,110,0,101,0,115,
+0,101,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,
+0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,66,0,117,0,
+103,0,105,0,110,0,101,0,115,0,101,0,86,0,101,0,114,0,115,0,105,0,111,0,110,
+0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,
+0,110,0,115,0,66,0,117,0,103,0,105,0,110,0,101,0,115,0,101,0,78,0,111,0,116,
+0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,
+0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,
+110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,
+0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,
+0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,
+0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,
+0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,
+0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,181,
+0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,1,2,0,2,0,3,1,3,1,4,
+1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,
+1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,
+1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,
+1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,4,110,117,108,108,
+7,117,110,105,49,65,48,48,7,117,110,105,49,65,48,49,7,117,110,105,49,65,48,
+50,7,117,110,105,49,65,48,51,7,117,110,105,49,65,48,52,7,117,110,105,49,65,
+48,53,7,117,110,105,49,65,48,54,7,117,110,105,49,65,48,55,7,117,110,105,49,
+65,48,56,7,117,110,105,49,65,48,57,7,117,110,105,49,65,48,65,7,117,110,105,
+49,65,48,66,7,117,110,105,49,65,48,67,7,117,110,105,49,65,48,68,7,117,110,
+105,49,65,48,69,7,117,110,105,49,65,48,70,7,117,110,105,49,65,49,48,7,117,
+110,105,49,65,49,49,7,117,110,105,49,65,49,50,7,117,110,105,49,65,49,51,7,
+117,110,105,49,65,49,52,7,117,110,105,49,65,49,53,7,117,110,105,49,65,49,
+54,7,117,110,105,49,65,49,55,7,117,110,105,49,65,49,56,7,117,110,105,49,65,
+49,57,7,117,110,105,49,65,49,65,7,117,110,105,49,65,49,66,7,117,110,105,49,
+65,49,69,7,117,110,105,49,65,49,70,7,117,110,105,50,48,48,68,12,105,121,97,
+46,108,105,103,97,116,117,114,101,9,117,110,105,49,65,48,48,95,101,9,117,
+110,105,49,65,48,49,95,101,9,117,110,105,49,65,48,50,95,101,9,117,110,105,
+49,65,48,51,95,101,9,117,110,105,49,65,48,52,95,101,9,117,110,105,49,65,48,
+53,95,101,9,117,110,105,49,65,48,54,95,101,9,117,110,105,49,65,48,55,95,101,
+9,117,110,105,49,65,48,56,95,101,9,117,110,105,49,65,48,57,95,101,9,117,110,
+105,49,65,48,65,95,101,9,117,110,105,49,65,48,66,95,101,9,117,110,105,49,
+65,48,67,95,101,9,117,110,105,49,65,48,68,95,101,9,117,110,105,49,65,48,69,
+95,101,9,117,110,105,49,65,48,70,95,101,9,117,110,105,49,65,49,48,95,101,
+9,117,110,105,49,65,49,49,95,101,9,117,110,105,49,65,49,50,95,101,9,117,110,
+105,49,65,49,51,95,101,9,117,110,105,49,65,49,52,95,101,9,117,110,105,49,
+65,49,53,95,101,9,117,110,105,49,65,49,54,95,101,14,106,118,95,80,97,110,
+103,114,97,110,103,107,101,112,4,122,119,115,112,4,122,119,110,106,7,117,
+110,105,50,53,67,67,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,
+46,0,0,0,2,0,5,0,0,0,26,0,1,0,27,0,28,0,3,0,29,0,30,0,1,0,31,0,31,0,3,0,32,
+0,62,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,30,0,44,0,1,68,70,76,84,0,8,0,
+4,0,0,0,0,255,255,0,1,0,0,0,1,109,97,114,107,0,8,0,0,0,1,0,0,0,1,0,4,0,4,
+0,0,0,1,0,8,0,1,0,12,0,22,0,2,0,32,0,64,0,1,0,3,0,27,0,28,0,31,0,2,0,1,0,
+4,0,26,0,0,0,3,0,0,0,14,0,1,0,20,0,0,0,26,0,1,254,192,4,216,0,1,253,68,255,
+226,0,1,251,80,4,136,0,23,0,94,0,238,0,178,0,124,0,100,0,106,0,112,0,118,
+0,178,0,124,0,130,0,214,0,136,0,166,0,142,0,148,0,154,1,6,0,160,0,166,0,178,
+1,6,0,178,0,172,0,178,0,172,0,178,0,184,0,190,0,250,0,196,0,202,0,244,0,250,
+0,208,0,214,0,220,0,226,0,244,0,250,0,232,0,238,0,244,0,250,1,0,1,6,0,1,4,
+6,4,176,0,1,1,104,4,176,0,1,4,236,255,226,0,1,1,244,3,232,0,1,5,120,255,226,
+0,1,6,164,255,226,0,1,2,8,5,60,0,1,2,188,3,232,0,1,1,124,4,176,0,1,5,250,
+255,226,0,1,2,48,3,232,0,1,2,188,4,116,0,1,6,104,255,226,0,1,6,184,255,226,
+0,1,2,88,3,232,0,1,5,60,255,226,0,1,5,20,4,116,0,1,5,60,4,116,0,1,8,152,255,
+226,0,1,1,184,3,232,0,1,4,216,255,226,0,1,4,56,4,76,0,1,7,128,255,226,0,1,
+1,184,4,76,0,1,3,132,255,226,0,1,5,20,3,232,0,1,7,248,255,226,0,1,1,244,4,
+76,0,1,7,8,255,226,0,1,0,0,0,10,0,32,0,58,0,1,68,70,76,84,0,8,0,4,0,0,0,0,
+255,255,0,2,0,0,0,1,0,2,99,99,109,112,0,14,108,105,103,97,0,20,0,0,0,1,0,
+0,0,0,0,1,0,1,0,2,0,6,1,50,0,4,0,0,0,1,0,8,0,1,1,26,0,23,0,52,0,62,0,72,0,
+82,0,92,0,102,0,112,0,122,0,132,0,142,0,152,0,162,0,172,0,182,0,192,0,202,
+0,212,0,222,0,232,0,242,0,252,1,6,1,16,0,1,0,4,0,36,0,2,0,29,0,1,0,4,0,37,
+0,2,0,29,0,1,0,4,0,38,0,2,0,29,0,1,0,4,0,39,0,2,0,29,0,1,0,4,0,40,0,2,0,29,
+0,1,0,4,0,41,0,2,0,29,0,1,0,4,0,42,0,2,0,29,0,1,0,4,0,43,0,2,0,29,0,1,0,4,
+0,44,0,2,0,29,0,1,0,4,0,45,0,2,0,29,0,1,0,4,0,46,0,2,0,29,0,1,0,4,0,47,0,
+2,0,29,0,1,0,4,0,48,0,2,0,29,0,1,0,4,0,49,0,2,0,29,0,1,0,4,0,50,0,2,0,29,
+0,1,0,4,0,51,0,2,0,29,0,1,0,4,0,52,0,2,0,29,0,1,0,4,0,53,0,2,0,29,0,1,0,4,
+0,54,0,2,0,29,0,1,0,4,0,55,0,2,0,29,0,1,0,4,0,56,0,2,0,29,0,1,0,4,0,57,0,
+2,0,29,0,1,0,4,0,58,0,2,0,29,0,2,0,1,0,4,0,26,0,0,0,4,0,0,0,1,0,8,0,1,0,22,
+0,1,0,8,0,1,0,4,0,35,0,4,0,27,0,34,0,20,0,1,0,1,0,25,};
+#endif
@@ -0,0 +1,1905 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansCanadianAboriginal_Regular_ttf_size = 46456;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansCanadianAboriginal_Regular_ttf");
+asm(".type fz_font_NotoSansCanadianAboriginal_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansCanadianAboriginal_Regular_ttf, 46456");
+asm(".balign 64");
+asm("fz_font_NotoSansCanadianAboriginal_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansCanadianAboriginal-Regular.ttf\"");
+#else
+const int fz_font_NotoSansCanadianAboriginal_Regular_ttf_size = 46456;
+const char fz_font_NotoSansCanadianAboriginal_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,3,24,5,210,0,0,180,140,0,0,0,36,71,
+80,79,83,179,14,175,244,0,0,180,176,0,0,0,48,71,83,85,66,176,215,173,122,
+0,0,180,224,0,0,0,152,79,83,47,50,157,187,140,254,0,0,1,104,0,0,0,96,99,109,
+97,112,31,174,31,190,0,0,13,104,0,0,0,124,103,97,115,112,0,7,0,7,0,0,180,
+128,0,0,0,12,103,108,121,102,0,210,209,182,0,0,19,184,0,0,154,92,104,101,
+97,100,10,120,167,53,0,0,0,236,0,0,0,54,104,104,101,97,19,229,11,176,0,0,
+1,36,0,0,0,36,104,109,116,120,245,92,38,243,0,0,1,200,0,0,11,160,108,111,
+99,97,1,146,217,242,0,0,13,228,0,0,5,210,109,97,120,112,2,245,0,178,0,0,1,
+72,0,0,0,32,110,97,109,101,150,44,192,71,0,0,174,20,0,0,6,76,112,111,115,
+116,255,42,0,150,0,0,180,96,0,0,0,32,0,1,0,0,0,1,7,174,194,145,130,88,95,
+15,60,245,0,11,8,0,0,0,0,0,205,219,136,214,0,0,0,0,210,40,203,228,0,15,253,
+221,11,70,7,242,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,11,190,
+0,15,255,97,11,70,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,232,0,1,0,0,2,232,0,81,
+0,4,0,95,0,5,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,5,215,1,144,0,5,0,0,
+5,154,5,51,0,0,1,31,5,154,5,51,0,0,3,209,0,150,2,124,0,0,2,11,5,2,4,5,4,2,
+2,4,0,0,0,0,0,0,0,0,32,0,32,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,
+253,168,0,0,8,141,2,88,0,0,0,1,0,0,0,0,5,143,7,242,0,0,0,32,0,2,4,205,0,193,
+0,0,0,0,2,88,0,0,2,88,0,0,2,18,0,174,4,158,1,2,4,158,1,33,2,18,0,160,4,158,
+1,109,1,123,0,31,3,146,0,80,6,54,0,100,6,54,0,100,6,54,0,100,6,54,0,100,5,
+217,0,140,5,217,0,100,5,217,0,140,5,217,0,140,5,217,0,140,5,217,0,80,5,217,
+0,80,6,144,0,50,6,144,0,100,6,144,0,50,6,144,0,100,6,144,0,50,6,144,0,100,
+6,241,0,50,7,55,0,140,7,85,0,50,7,55,0,100,5,217,0,140,7,55,0,50,7,55,0,80,
+7,55,0,50,7,55,0,80,5,217,0,80,4,186,0,80,4,110,0,80,3,217,0,50,2,117,0,50,
+2,117,0,50,3,60,0,80,3,60,0,80,2,232,0,80,3,95,0,80,3,176,0,50,2,112,0,80,
+1,186,0,100,3,146,0,80,3,146,0,80,3,106,0,80,8,81,0,100,6,93,0,100,7,7,0,
+140,7,217,0,80,6,54,0,100,6,134,0,100,6,134,0,100,6,134,0,100,5,177,0,100,
+5,177,0,100,5,177,0,100,5,177,0,100,5,177,0,100,5,177,0,80,5,177,0,80,6,124,
+0,50,6,124,0,100,6,164,0,50,6,164,0,100,6,164,0,50,6,164,0,100,6,111,0,50,
+6,236,0,100,6,111,0,50,6,236,0,100,6,236,0,50,6,111,0,80,6,236,0,50,6,111,
+0,80,5,217,0,80,2,236,0,50,1,138,0,120,2,206,0,80,6,32,0,140,6,32,0,140,6,
+32,0,140,6,32,0,140,5,116,0,100,5,116,0,100,5,116,0,100,5,116,0,100,5,116,
+0,100,5,116,0,140,5,116,0,140,7,86,0,50,7,86,0,140,7,86,0,50,7,86,0,140,7,
+86,0,50,7,86,0,140,6,50,0,50,6,161,0,100,6,50,0,50,6,161,0,100,6,160,0,50,
+6,50,0,140,6,160,0,50,6,50,0,140,6,160,0,50,2,122,0,80,7,122,0,140,7,122,
+0,140,6,198,0,100,6,198,0,140,4,188,0,120,4,188,0,140,4,188,0,140,4,188,0,
+140,4,188,0,120,4,188,0,120,4,188,0,120,4,188,0,140,4,188,0,102,6,16,0,50,
+6,16,0,120,6,16,0,50,6,16,0,140,6,16,0,50,6,16,0,140,6,16,0,50,6,16,0,120,
+6,16,0,50,6,16,0,120,6,16,0,50,6,16,0,140,6,16,0,50,6,16,0,102,6,16,0,50,
+3,33,0,120,3,33,0,80,6,28,0,120,6,28,0,140,6,28,0,120,6,28,0,140,5,16,0,120,
+5,16,0,140,5,16,0,140,5,16,0,140,5,16,0,120,5,16,0,120,5,16,0,120,5,16,0,
+140,5,16,0,100,6,100,0,50,6,100,0,120,6,100,0,50,6,100,0,140,6,100,0,50,6,
+100,0,140,6,100,0,50,6,100,0,120,6,100,0,50,6,100,0,120,6,100,0,50,6,100,
+0,140,6,100,0,50,6,100,0,100,6,100,0,50,3,13,0,100,3,13,0,100,4,187,0,100,
+4,187,0,140,4,187,0,140,4,187,0,140,4,187,0,100,4,187,0,100,4,187,0,100,4,
+187,0,140,4,187,0,100,5,71,0,50,6,15,0,100,6,15,0,50,5,71,0,140,6,15,0,50,
+5,71,0,140,5,71,0,50,6,15,0,100,5,71,0,50,6,15,0,100,6,15,0,50,5,71,0,140,
+6,15,0,50,5,71,0,100,6,15,0,50,2,214,0,80,2,232,0,80,2,214,0,80,2,245,0,80,
+4,174,0,120,7,60,0,100,7,60,0,120,7,60,0,120,7,60,0,120,7,60,0,100,7,60,0,
+100,7,60,0,100,7,60,0,120,7,60,0,120,8,114,0,50,8,114,0,100,8,114,0,50,7,
+60,0,120,8,114,0,50,7,60,0,120,7,60,0,120,4,162,0,80,3,133,0,100,4,162,0,
+50,7,20,0,100,7,20,0,120,7,20,0,120,7,20,0,120,7,20,0,100,7,20,0,100,7,20,
+0,100,7,20,0,120,7,20,0,120,8,104,0,50,8,104,0,100,8,104,0,50,8,104,0,120,
+8,104,0,50,8,104,0,120,7,20,0,100,8,104,0,100,7,20,0,100,8,104,0,100,8,104,
+0,50,7,20,0,120,8,104,0,50,7,20,0,120,4,45,0,80,2,222,0,80,4,242,0,120,4,
+158,0,120,4,158,0,140,4,158,0,140,4,158,0,140,4,158,0,120,4,158,0,120,4,158,
+0,120,4,158,0,140,4,158,0,100,5,202,0,50,5,202,0,120,5,202,0,50,5,202,0,140,
+5,202,0,50,5,202,0,140,5,202,0,50,5,202,0,120,5,202,0,50,5,202,0,120,5,202,
+0,50,5,202,0,140,5,202,0,50,5,202,0,100,5,202,0,50,2,208,0,80,2,237,0,80,
+2,208,0,80,3,113,0,80,2,208,0,80,2,208,0,80,2,198,0,80,5,177,0,80,7,244,0,
+80,7,60,0,80,7,144,0,80,6,194,0,120,6,194,0,120,6,194,0,120,7,225,0,120,7,
+225,0,120,7,225,0,120,7,225,0,120,7,238,0,50,7,238,0,120,7,238,0,50,7,238,
+0,120,7,238,0,50,7,238,0,120,9,13,0,50,9,13,0,120,9,13,0,50,9,13,0,120,9,
+13,0,50,9,13,0,120,9,13,0,50,9,13,0,120,5,0,0,80,4,127,0,80,4,127,0,120,4,
+127,0,120,4,127,0,120,4,127,0,80,4,127,0,80,4,127,0,80,4,127,0,120,4,127,
+0,80,5,171,0,50,5,171,0,80,5,171,0,50,5,171,0,120,5,171,0,50,5,171,0,120,
+5,171,0,50,5,171,0,80,5,171,0,50,5,171,0,80,5,171,0,50,5,171,0,120,5,171,
+0,50,5,171,0,80,5,171,0,50,2,193,0,100,4,103,0,80,3,6,0,80,3,47,0,80,7,40,
+0,120,7,40,0,100,7,40,0,100,7,40,0,120,7,40,0,120,7,40,0,120,4,168,0,140,
+4,168,0,140,4,168,0,140,4,168,0,100,4,168,0,100,4,168,0,100,5,212,0,50,5,
+212,0,100,2,184,0,80,3,26,0,80,4,242,0,120,6,77,0,120,6,77,0,120,6,77,0,120,
+6,77,0,120,6,96,0,100,6,96,0,100,6,96,0,80,6,96,0,80,7,140,0,50,7,140,0,80,
+4,43,0,80,6,32,0,140,6,32,0,140,6,32,0,140,6,32,0,140,6,32,0,140,6,32,0,140,
+5,228,0,100,5,228,0,100,5,228,0,120,5,228,0,120,7,16,0,50,7,16,0,120,3,167,
+0,80,6,32,0,140,6,32,0,140,5,116,0,100,5,116,0,140,6,244,0,80,6,32,0,140,
+6,32,0,140,5,116,0,100,5,116,0,140,6,118,0,120,6,118,0,50,6,118,0,50,6,118,
+0,120,6,118,0,120,6,118,0,50,6,118,0,50,4,5,0,80,5,66,0,140,3,47,0,80,7,80,
+0,80,7,80,0,80,7,80,0,80,7,80,0,100,7,80,0,100,7,80,0,100,7,80,0,100,5,171,
+0,80,4,188,0,120,4,188,0,140,4,188,0,120,4,188,0,140,6,198,0,120,6,198,0,
+50,6,198,0,120,6,198,0,50,9,112,0,100,9,112,0,100,9,112,0,100,7,84,0,100,
+7,84,0,100,9,112,0,100,9,112,0,100,4,180,0,100,6,230,0,100,4,188,0,120,4,
+188,0,140,4,188,0,120,4,188,0,140,7,60,0,100,7,60,0,120,7,60,0,100,7,60,0,
+120,4,192,0,80,7,20,0,120,7,20,0,120,7,20,0,100,7,20,0,100,7,20,0,120,7,20,
+0,120,4,138,0,80,4,227,0,80,4,227,0,100,4,227,0,100,4,227,0,80,4,227,0,80,
+4,227,0,100,4,227,0,100,2,246,0,80,4,188,0,140,4,41,0,140,4,41,0,120,4,41,
+0,140,4,41,0,120,4,122,0,140,4,122,0,100,4,122,0,140,4,122,0,100,5,121,0,
+140,5,121,0,100,5,121,0,140,5,121,0,100,5,103,0,140,5,103,0,80,5,103,0,140,
+5,103,0,80,5,118,0,80,5,118,0,140,5,118,0,80,5,118,0,140,6,134,0,100,6,134,
+0,100,5,177,0,100,5,177,0,100,5,177,0,90,5,177,0,80,6,134,0,100,6,134,0,100,
+5,177,0,100,5,177,0,100,5,177,0,100,5,177,0,80,6,54,0,100,6,54,0,100,5,177,
+0,100,5,177,0,100,5,177,0,100,5,177,0,80,6,54,0,100,6,54,0,100,5,177,0,100,
+5,177,0,100,5,177,0,100,5,177,0,80,6,32,0,140,6,32,0,140,5,235,0,140,5,235,
+0,140,5,235,0,140,5,235,0,120,6,32,0,140,6,32,0,140,5,195,0,100,5,195,0,100,
+5,195,0,100,5,195,0,120,6,32,0,140,6,32,0,140,5,65,0,100,5,65,0,100,5,65,
+0,100,5,65,0,120,3,106,0,80,7,42,0,140,7,42,0,140,4,142,0,100,4,142,0,100,
+4,142,0,100,4,142,0,120,7,42,0,140,7,42,0,140,5,98,0,140,5,98,0,140,5,98,
+0,140,5,98,0,120,7,162,0,140,7,162,0,140,5,88,0,100,5,88,0,100,5,88,0,100,
+5,88,0,120,3,201,0,50,5,96,0,140,5,96,0,100,6,171,0,100,6,171,0,100,6,171,
+0,100,6,171,0,120,7,42,0,140,7,42,0,140,4,142,0,100,4,142,0,100,4,142,0,100,
+4,142,0,120,5,208,0,140,5,208,0,140,5,140,0,100,5,140,0,100,5,140,0,100,5,
+140,0,120,4,216,0,120,4,216,0,120,4,216,0,120,7,37,0,140,7,37,0,140,7,37,
+0,140,7,37,0,140,7,37,0,140,5,65,0,80,5,65,0,100,6,242,0,120,6,242,0,120,
+6,242,0,120,6,242,0,120,7,106,0,80,7,106,0,120,4,213,0,120,4,213,0,120,4,
+213,0,120,4,233,0,120,7,125,0,100,7,125,0,120,5,67,0,80,5,67,0,80,5,67,0,
+80,5,67,0,120,6,171,0,100,6,171,0,100,4,213,0,120,4,213,0,120,4,213,0,120,
+4,213,0,120,8,71,0,80,8,71,0,80,5,67,0,80,5,67,0,80,5,67,0,80,5,67,0,120,
+9,44,0,80,9,44,0,80,4,192,0,50,4,192,0,50,4,192,0,50,4,192,0,120,6,64,0,100,
+6,64,0,100,5,174,0,80,5,174,0,80,5,174,0,80,5,174,0,120,3,11,0,80,3,11,0,
+80,6,64,0,100,6,64,0,100,5,174,0,80,5,174,0,80,5,174,0,80,5,174,0,120,7,96,
+0,100,7,96,0,100,4,232,0,100,4,232,0,100,4,232,0,100,4,232,0,120,7,96,0,100,
+7,96,0,100,4,232,0,100,4,232,0,100,4,232,0,100,4,232,0,120,2,219,0,80,7,96,
+0,100,7,96,0,100,5,67,0,100,5,67,0,100,5,67,0,100,5,67,0,120,7,96,0,100,7,
+92,0,100,4,232,0,100,4,232,0,100,4,232,0,100,4,232,0,120,7,96,0,100,7,96,
+0,100,4,232,0,100,4,232,0,100,4,232,0,100,4,232,0,120,4,166,0,80,2,250,0,
+80,7,80,0,80,9,132,0,100,11,190,0,100,11,190,0,100,9,242,0,100,9,242,0,100,
+11,190,0,100,11,190,0,100,5,152,0,80,5,252,0,100,5,252,0,100,5,152,0,80,5,
+152,0,80,5,232,0,100,5,232,0,100,3,146,0,80,3,146,0,80,5,217,0,117,5,217,
+0,80,5,217,0,80,7,55,0,50,5,177,0,75,5,177,0,80,6,111,0,50,5,116,0,140,4,
+188,0,35,6,16,0,50,4,187,0,35,7,60,0,100,7,60,0,120,7,20,0,120,4,158,0,120,
+4,158,0,35,7,225,0,120,7,225,0,120,9,13,0,50,4,127,0,80,4,127,0,15,4,168,
+0,100,8,144,0,50,8,144,0,120,8,144,0,50,8,144,0,120,7,60,0,100,8,144,0,100,
+7,60,0,100,8,144,0,100,8,84,0,50,8,84,0,50,8,84,0,50,5,232,0,50,5,232,0,50,
+5,212,0,50,3,99,0,50,3,133,0,100,3,33,0,120,3,53,0,120,2,214,0,80,4,162,0,
+80,2,208,0,80,5,0,0,80,4,81,0,50,4,81,0,50,3,216,1,44,3,74,1,44,8,134,0,100,
+4,168,0,100,4,168,0,100,7,120,0,140,7,16,0,120,7,120,0,140,5,116,0,100,5,
+116,0,140,6,20,0,120,4,188,0,120,6,20,0,120,4,188,0,120,5,118,0,80,8,130,
+0,140,4,142,0,100,4,142,0,120,5,196,0,120,4,216,0,120,8,146,0,140,1,98,0,
+100,2,125,0,100,2,219,0,80,3,216,1,44,3,244,0,140,3,74,1,44,1,98,0,100,3,
+74,1,44,3,74,1,44,3,74,0,231,5,105,0,120,5,105,0,120,5,105,0,120,5,105,0,
+120,6,149,0,50,6,149,0,120,6,149,0,50,6,149,0,120,6,149,0,50,6,149,0,120,
+6,149,0,50,6,149,0,120,4,154,0,100,5,105,0,120,5,105,0,120,6,149,0,50,2,18,
+0,160,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,112,0,0,0,24,0,16,0,3,0,8,0,0,0,13,0,
+32,0,160,1,49,2,199,2,219,3,7,22,127,24,245,254,255,255,255,0,0,0,0,0,13,
+0,32,0,160,1,49,2,199,2,216,3,7,20,0,24,176,254,255,255,255,0,1,255,245,255,
+227,255,99,254,211,253,62,253,46,255,224,236,10,233,218,1,2,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,33,0,66,0,
+93,0,116,0,155,0,187,0,206,0,230,0,242,1,10,1,22,1,47,1,59,1,71,1,83,1,95,
+1,120,1,132,1,144,1,156,1,168,1,180,1,196,1,212,1,225,1,237,1,254,2,14,2,
+30,2,43,2,55,2,72,2,88,2,104,2,150,2,221,2,246,3,5,3,21,3,52,3,83,3,111,3,
+150,3,173,3,192,3,214,3,227,3,251,4,14,4,26,4,38,4,50,4,62,4,86,4,98,4,120,
+4,132,4,155,4,167,4,179,4,191,4,202,4,225,4,237,4,249,5,5,5,17,5,29,5,45,
+5,61,5,74,5,86,5,102,5,118,5,131,5,143,5,160,5,176,5,192,5,212,5,225,6,1,
+6,43,6,55,6,96,6,108,6,150,6,161,6,172,6,184,6,195,6,238,6,250,7,7,7,19,7,
+32,7,44,7,61,7,77,7,90,7,102,7,119,7,134,7,147,7,159,7,176,7,192,7,205,7,
+230,7,242,7,254,8,10,8,22,8,68,8,80,8,125,8,137,8,183,8,195,8,207,8,254,9,
+10,9,23,9,35,9,48,9,60,9,77,9,93,9,106,9,118,9,135,9,151,9,164,9,176,9,193,
+9,209,9,222,10,6,10,46,10,58,10,70,10,82,10,94,10,130,10,142,10,178,10,190,
+10,226,10,238,10,250,11,30,11,42,11,55,11,67,11,80,11,92,11,109,11,125,11,
+138,11,150,11,167,11,183,11,196,11,208,11,225,11,241,11,254,12,27,12,56,12,
+71,12,82,12,98,12,110,12,125,12,137,12,149,12,165,12,177,12,190,12,202,12,
+215,12,227,12,244,13,4,13,17,13,29,13,46,13,62,13,75,13,87,13,104,13,120,
+13,133,13,149,13,178,13,194,13,234,14,21,14,68,14,80,14,127,14,139,14,185,
+14,197,14,209,14,255,15,11,15,24,15,36,15,49,15,61,15,78,15,94,15,106,15,
+148,15,182,15,224,15,254,16,10,16,40,16,52,16,81,16,93,16,105,16,134,16,146,
+16,159,16,171,16,184,16,196,16,213,16,229,16,241,16,253,17,13,17,29,17,42,
+17,54,17,71,17,87,17,117,17,148,17,183,17,212,17,224,17,253,18,9,18,36,18,
+48,18,60,18,88,18,100,18,113,18,125,18,138,18,150,18,167,18,183,18,196,18,
+208,18,225,18,241,18,254,19,10,19,26,19,42,19,55,19,81,19,124,19,150,19,174,
+19,217,20,5,20,62,20,137,20,149,20,161,20,173,20,220,21,12,21,24,21,82,21,
+94,21,152,21,164,21,177,21,189,21,202,21,214,21,231,21,247,22,4,22,16,22,
+33,22,49,22,62,22,74,22,91,22,107,22,161,22,184,22,196,22,219,22,230,22,253,
+23,9,23,21,23,43,23,55,23,68,23,80,23,93,23,105,23,122,23,137,23,150,23,162,
+23,179,23,195,23,208,23,220,23,236,23,252,24,9,24,31,24,62,24,84,24,110,24,
+146,24,182,24,217,24,229,25,7,25,19,25,53,25,64,25,97,25,131,25,143,25,176,
+25,193,25,209,25,240,26,15,26,50,26,99,26,111,26,161,26,173,26,226,26,237,
+27,33,27,45,27,62,27,78,27,126,27,193,28,4,28,70,28,136,28,148,28,160,28,
+225,28,237,29,46,29,58,29,75,29,91,29,142,29,191,29,239,30,32,30,81,30,135,
+30,206,31,20,31,87,31,154,31,206,32,2,32,14,32,67,32,79,32,131,32,143,32,
+190,32,214,32,240,33,0,33,12,33,28,33,40,33,56,33,68,33,84,33,96,33,145,33,
+194,33,244,34,39,34,81,34,123,34,165,34,208,34,224,34,236,34,252,35,79,35,
+91,35,103,35,119,35,175,36,2,36,44,36,86,36,129,36,172,36,227,37,26,37,79,
+37,133,37,182,37,218,37,230,38,10,38,22,38,58,38,70,38,105,38,137,38,168,
+38,179,38,211,38,223,38,255,39,10,39,39,39,84,39,109,39,136,39,163,39,189,
+39,210,39,231,39,252,40,17,40,50,40,83,40,116,40,149,40,174,40,198,40,223,
+40,247,41,26,41,60,41,96,41,132,41,164,41,194,41,225,41,237,41,249,42,24,
+42,55,42,84,42,114,42,126,42,138,42,168,42,197,42,227,42,254,43,10,43,21,
+43,49,43,93,43,136,43,177,43,189,43,200,43,241,44,26,44,66,44,109,44,121,
+44,133,44,177,44,230,45,25,45,78,45,90,45,102,45,156,45,201,45,244,46,32,
+46,44,46,56,46,100,46,119,46,177,46,234,47,25,47,37,47,48,47,97,47,160,47,
+221,48,19,48,31,48,43,48,97,48,166,48,234,49,39,49,51,49,63,49,125,49,147,
+49,179,49,211,49,244,50,0,50,12,50,45,50,102,50,160,50,207,50,219,50,230,
+51,22,51,85,51,148,51,206,51,218,51,230,52,32,52,83,52,134,52,185,52,251,
+53,7,53,19,53,86,53,154,53,219,54,28,54,93,54,105,54,117,54,182,54,220,55,
+2,55,39,55,51,55,63,55,100,55,142,55,185,55,226,55,238,55,250,56,35,56,96,
+56,156,56,193,56,205,56,216,56,254,57,44,57,89,57,129,57,141,57,153,57,194,
+58,5,58,74,58,133,58,145,58,157,58,216,59,23,59,85,59,143,59,155,59,167,59,
+226,59,249,60,23,60,98,60,172,60,242,60,254,61,10,61,81,61,164,61,246,62,
+64,62,76,62,87,62,161,63,3,63,102,63,183,63,195,63,207,64,32,64,84,64,184,
+65,28,65,117,65,129,65,141,65,230,66,61,66,147,66,226,66,238,66,250,67,73,
+67,177,68,25,68,118,68,130,68,142,68,235,69,14,69,39,69,51,69,63,69,75,69,
+91,69,201,69,213,69,225,69,241,69,253,70,9,70,24,70,36,70,52,70,64,70,79,
+70,111,70,130,70,142,70,154,70,170,70,187,70,199,70,211,70,227,70,239,70,
+251,71,11,71,23,71,35,71,47,71,59,71,71,71,83,71,95,71,107,71,124,71,136,
+71,148,71,160,71,173,71,185,71,202,71,218,71,230,71,242,72,2,72,18,72,31,
+72,44,72,61,72,74,72,91,72,104,72,125,72,159,72,198,72,227,72,243,73,29,73,
+55,73,109,73,121,73,133,73,172,73,195,73,207,73,219,73,231,73,243,73,255,
+74,11,74,23,74,35,74,47,74,59,74,71,74,83,74,95,74,107,74,118,74,130,74,142,
+74,154,74,166,74,179,74,206,74,250,75,33,75,71,75,110,75,123,75,146,75,169,
+75,192,75,240,75,252,76,44,76,56,76,69,76,81,76,98,76,114,76,127,76,139,76,
+156,76,172,76,238,76,250,77,6,77,23,77,46,0,0,0,2,0,193,0,0,4,10,5,182,0,
+3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,
+250,74,104,4,230,0,0,1,0,174,0,0,1,100,4,74,0,3,0,0,33,35,17,51,1,100,182,
+182,4,74,0,1,1,2,4,217,3,154,6,33,0,17,0,0,1,6,6,7,35,38,38,39,39,53,51,22,
+22,23,54,54,55,51,3,154,6,200,30,192,20,102,54,60,121,51,106,54,52,108,51,
+121,6,6,7,227,67,45,128,61,67,27,34,97,56,56,97,34,0,1,1,33,4,217,3,123,5,
+238,0,13,0,0,1,6,6,35,34,38,39,51,22,22,51,50,54,55,3,123,8,162,135,140,151,
+6,108,6,69,116,99,85,6,5,238,125,152,145,132,67,58,63,62,0,0,1,0,160,5,0,
+1,117,5,229,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,1,60,57,63,44,45,61,
+61,45,5,229,60,54,58,57,56,59,59,55,0,0,2,1,109,4,217,3,49,6,135,0,11,0,23,
+0,0,0,38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,1,
+230,121,121,102,100,129,125,104,50,63,57,56,49,63,63,49,4,217,116,99,99,116,
+117,96,97,120,1,72,60,53,53,60,60,53,53,60,0,0,1,0,31,254,66,1,94,0,0,0,18,
+0,0,0,54,55,21,6,6,35,34,38,53,52,54,55,51,6,21,20,22,51,1,35,45,14,26,64,
+29,100,100,84,75,129,139,52,34,254,186,5,4,113,8,8,104,90,67,131,54,133,105,
+45,43,0,2,0,80,2,20,3,66,3,202,0,3,0,7,0,0,19,33,21,33,21,33,21,33,80,2,242,
+253,14,2,242,253,14,3,202,138,162,138,0,2,0,100,255,231,5,210,5,182,0,5,0,
+8,0,0,19,53,33,21,1,35,9,2,100,5,110,253,93,40,254,71,1,205,1,205,5,162,20,
+20,250,69,5,62,251,247,4,9,255,255,0,100,0,0,5,210,7,242,18,38,0,13,0,0,16,
+7,2,208,1,40,0,0,0,2,0,100,0,0,5,210,5,207,0,5,0,8,0,0,37,21,33,53,1,51,9,
+2,5,210,250,146,2,163,40,1,185,254,51,254,51,20,20,20,5,187,250,194,4,9,251,
+247,255,255,0,100,0,0,5,210,7,100,18,38,0,13,0,0,16,7,2,212,1,116,0,0,0,2,
+0,140,255,235,5,137,5,204,0,5,0,8,0,0,1,21,1,35,17,51,19,1,1,5,137,251,23,
+20,20,140,3,92,252,164,2,234,30,253,31,5,225,251,36,1,235,1,236,0,255,255,
+0,100,255,235,5,137,7,100,18,38,0,15,0,0,16,7,2,212,255,56,0,0,255,255,0,
+140,255,235,5,137,7,100,18,38,0,15,0,0,16,7,2,209,0,178,0,0,255,255,0,140,
+255,235,5,137,5,204,18,38,0,15,0,0,16,7,2,211,1,95,254,4,255,255,0,140,255,
+235,5,137,5,204,18,38,0,15,0,0,16,7,2,213,0,166,0,0,0,2,0,80,255,235,5,77,
+5,204,0,5,0,8,0,0,1,51,17,35,1,53,9,2,5,57,20,20,251,23,4,93,252,164,3,92,
+5,204,250,31,2,225,30,1,221,254,20,254,21,0,255,255,0,80,255,235,5,117,7,
+100,18,38,0,20,0,0,16,7,2,212,3,87,0,0,255,255,0,50,255,231,6,44,5,182,16,
+38,0,11,90,0,16,7,2,213,255,6,0,0,255,255,0,100,255,231,6,44,5,182,16,38,
+0,11,0,0,16,7,2,213,4,14,0,0,255,255,0,50,0,0,6,44,5,207,16,38,0,13,90,0,
+16,7,2,213,255,6,0,0,255,255,0,100,0,0,6,44,5,207,16,38,0,13,0,0,16,7,2,213,
+4,14,0,0,255,255,0,50,0,0,6,44,7,100,16,38,0,13,90,0,16,39,2,213,255,6,0,
+0,16,7,2,212,1,206,0,0,255,255,0,100,0,0,6,44,7,100,16,38,0,13,0,0,16,39,
+2,213,4,14,0,0,16,7,2,212,1,116,0,0,255,255,0,50,255,235,6,161,5,204,16,39,
+2,213,255,6,0,0,16,7,0,15,1,24,0,0,255,255,0,140,255,235,7,5,5,204,16,39,
+2,213,4,231,0,0,16,6,0,15,0,0,255,255,0,50,255,235,7,5,7,100,16,39,2,213,
+255,6,0,0,16,39,0,15,1,124,0,0,16,7,2,212,0,180,0,0,255,255,0,100,255,235,
+7,5,7,100,16,39,2,213,4,231,0,0,16,39,2,212,255,56,0,0,16,6,0,15,0,0,255,
+255,0,140,255,235,5,137,6,206,18,38,0,15,0,0,16,39,2,212,0,60,255,106,16,
+7,2,212,2,138,254,42,255,255,0,50,255,235,6,171,5,204,16,39,2,213,255,6,0,
+0,16,7,0,20,1,94,0,0,255,255,0,80,255,235,7,5,5,204,16,39,2,213,4,231,0,0,
+16,6,0,20,0,0,255,255,0,50,255,235,6,211,7,100,16,39,2,213,255,6,0,0,16,39,
+0,20,1,94,0,0,16,7,2,212,4,181,0,0,255,255,0,80,255,235,7,5,7,100,16,39,2,
+213,4,231,0,0,16,38,0,20,0,0,16,7,2,212,3,87,0,0,255,255,0,80,255,235,5,77,
+6,206,18,38,0,20,0,0,16,39,2,212,2,83,255,106,16,7,2,212,0,5,254,42,0,1,0,
+80,2,173,4,106,5,182,0,29,0,0,1,17,16,33,34,39,6,35,34,38,53,17,51,17,20,
+22,51,50,54,53,17,51,17,20,22,51,50,54,53,17,4,106,254,226,141,99,96,134,
+146,148,154,77,75,69,73,154,78,75,72,69,5,182,254,166,254,81,148,148,216,
+212,1,93,254,155,133,149,145,173,1,65,254,191,168,150,154,164,1,65,0,4,0,
+80,2,168,4,30,5,207,0,11,0,23,0,35,0,47,0,0,0,22,21,20,6,35,34,38,53,52,54,
+51,18,54,53,52,38,35,34,6,21,20,22,51,0,22,21,20,6,35,34,38,53,52,54,51,18,
+54,53,52,38,35,34,6,21,20,22,51,1,141,132,134,91,94,130,128,96,49,68,68,49,
+49,68,69,48,2,106,132,134,91,94,130,128,96,49,68,68,49,49,68,69,48,4,105,
+132,93,96,128,130,94,91,134,254,170,68,49,49,68,68,49,48,69,2,188,132,93,
+96,128,130,94,91,134,254,170,68,49,49,68,68,49,48,69,0,2,0,50,2,188,3,167,
+5,227,0,5,0,8,0,0,19,1,51,1,21,33,1,3,33,50,1,165,43,1,165,252,139,1,186,
+224,1,193,2,233,2,250,253,6,45,2,30,254,108,0,0,1,0,50,2,188,2,67,5,182,0,
+3,0,0,19,1,51,1,50,1,101,172,254,153,2,188,2,250,253,6,0,1,0,50,2,188,2,67,
+5,182,0,3,0,0,1,1,51,1,1,153,254,153,172,1,101,2,188,2,250,253,6,0,0,1,0,
+80,3,17,2,236,5,182,0,17,0,0,1,17,20,6,35,34,38,53,17,51,17,20,22,51,50,54,
+53,17,2,236,164,173,169,162,154,87,90,93,90,5,182,254,212,200,177,178,199,
+1,44,254,226,129,124,121,132,1,30,0,0,1,0,80,3,32,2,236,5,197,0,17,0,0,1,
+17,52,38,35,34,6,21,17,35,17,52,54,51,50,22,21,17,2,82,90,93,90,87,154,162,
+169,174,163,3,32,1,30,131,122,123,130,254,226,1,44,199,178,178,199,254,212,
+0,0,1,0,80,2,188,2,152,5,182,0,17,0,0,19,51,50,54,53,52,38,35,35,53,51,50,
+22,21,20,6,35,35,80,92,201,137,140,159,131,128,227,229,224,251,109,3,70,123,
+139,113,111,138,175,187,211,189,0,2,0,80,3,17,3,15,5,197,0,11,0,23,0,0,0,
+22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,2,63,208,
+206,146,145,206,209,142,82,116,118,80,81,116,114,83,5,197,202,145,142,203,
+203,142,144,203,253,218,123,82,84,119,118,85,83,122,0,0,2,0,50,2,189,3,126,
+5,182,0,3,0,7,0,0,19,1,51,1,51,1,51,1,50,1,101,172,254,153,145,1,101,172,
+254,153,2,189,2,249,253,7,2,249,253,7,0,2,0,80,2,188,2,32,5,182,0,3,0,7,0,
+0,19,17,51,17,51,17,51,17,80,154,156,154,2,188,2,250,253,6,2,250,253,6,0,
+1,0,100,2,103,1,86,3,89,0,11,0,0,18,38,53,52,54,51,50,22,21,20,6,35,171,71,
+71,50,50,71,71,50,2,103,71,50,50,71,71,50,50,71,0,1,0,80,4,1,3,66,4,139,0,
+3,0,0,19,33,21,33,80,2,242,253,14,4,139,138,0,1,0,80,2,188,3,66,5,182,0,11,
+0,0,19,33,17,51,17,33,21,33,17,35,17,33,80,1,44,154,1,44,254,212,154,254,
+212,4,139,1,43,254,213,138,254,187,1,69,0,1,0,80,2,188,3,26,5,182,0,7,0,0,
+1,17,33,53,33,21,33,17,1,104,254,232,2,202,254,232,2,188,2,112,138,138,253,
+144,255,255,0,100,255,231,8,31,5,182,16,38,0,11,0,0,16,7,0,42,5,220,0,0,255,
+255,0,100,0,0,6,43,5,207,16,38,0,13,0,0,16,7,0,42,3,232,0,0,255,255,0,140,
+255,235,6,213,5,204,16,38,0,15,0,0,16,7,0,42,4,146,0,0,255,255,0,80,255,235,
+7,167,5,204,16,39,0,42,5,100,0,0,16,6,0,20,0,0,0,1,0,100,255,231,5,210,5,
+182,0,8,0,0,1,21,1,35,1,53,51,1,1,5,210,253,93,40,253,93,170,2,13,2,13,5,
+182,20,250,69,5,187,20,251,102,4,154,0,255,255,0,100,0,0,6,34,7,242,16,39,
+2,208,1,84,0,0,16,6,0,59,0,0,0,1,0,100,0,0,6,34,5,207,0,8,0,0,1,1,35,53,1,
+51,1,21,35,3,67,253,202,169,2,203,40,2,203,172,4,154,251,102,20,5,187,250,
+69,20,255,255,0,100,0,0,6,34,7,100,18,38,0,59,0,0,16,7,2,212,1,158,0,0,0,
+1,0,100,255,235,5,97,5,204,0,8,0,0,55,1,1,53,51,1,21,1,35,100,3,252,252,4,
+20,4,233,251,23,20,151,2,68,2,69,172,253,30,30,253,31,0,255,255,0,100,255,
+235,5,97,7,100,18,38,0,61,0,0,16,7,2,212,255,56,0,0,255,255,0,100,255,235,
+5,97,7,100,18,38,0,61,0,0,16,7,2,209,0,178,0,0,255,255,0,100,255,235,5,97,
+5,204,18,38,0,61,0,0,16,7,2,211,1,28,254,4,255,255,0,100,255,235,5,97,5,204,
+18,38,0,61,0,0,16,6,2,213,216,0,0,1,0,80,255,235,5,77,5,204,0,8,0,0,5,35,
+1,53,1,51,21,1,1,5,77,20,251,23,4,233,20,252,4,3,252,21,2,225,30,2,226,172,
+253,187,253,188,255,255,0,80,255,235,5,77,7,100,18,38,0,66,0,0,16,7,2,212,
+3,47,0,0,255,255,0,50,255,231,6,24,5,182,16,38,0,57,70,0,16,7,2,213,255,6,
+0,0,255,255,0,100,255,231,6,74,5,182,16,38,0,57,0,0,16,7,2,213,4,44,0,0,255,
+255,0,50,0,0,6,64,5,207,16,39,2,213,255,6,0,0,16,6,0,59,30,0,255,255,0,100,
+0,0,6,114,5,207,16,39,2,213,4,84,0,0,16,6,0,59,0,0,255,255,0,50,0,0,6,64,
+7,100,16,39,2,213,255,6,0,0,16,38,0,59,30,0,16,7,2,212,1,188,0,0,255,255,
+0,100,0,0,6,114,7,100,16,39,2,213,4,84,0,0,16,38,0,59,0,0,16,7,2,212,1,158,
+0,0,255,255,0,50,255,235,6,31,5,204,16,39,0,61,0,190,0,0,16,7,2,213,255,6,
+0,0,255,255,0,100,255,235,6,186,5,204,16,38,0,61,0,0,16,7,2,213,4,156,0,0,
+255,255,0,50,255,235,6,31,7,100,16,39,0,61,0,190,0,0,16,38,2,212,246,0,16,
+7,2,213,255,6,0,0,255,255,0,100,255,235,6,186,7,100,16,38,0,61,0,0,16,39,
+2,212,255,56,0,0,16,7,2,213,4,156,0,0,255,255,0,50,255,235,6,136,5,204,16,
+39,0,66,1,59,0,0,16,7,2,213,255,6,0,0,255,255,0,80,255,235,6,61,5,204,16,
+38,0,66,0,0,16,7,2,213,4,31,0,0,255,255,0,50,255,235,6,136,7,100,16,39,0,
+66,1,59,0,0,16,39,2,212,4,106,0,0,16,7,2,213,255,6,0,0,255,255,0,80,255,235,
+6,61,7,100,16,38,0,66,0,0,16,39,2,212,3,47,0,0,16,7,2,213,4,31,0,0,255,255,
+0,80,255,235,5,77,6,206,16,39,2,212,2,83,255,106,16,39,2,212,0,5,254,42,16,
+6,0,66,0,0,0,1,0,50,2,167,2,156,5,209,0,6,0,0,19,1,21,5,5,21,1,50,2,106,254,
+131,1,125,253,150,4,73,1,136,170,235,235,170,1,136,0,1,0,120,2,188,1,18,5,
+182,0,3,0,0,19,17,51,17,120,154,2,188,2,250,253,6,0,1,0,80,2,188,2,128,5,
+182,0,18,0,0,19,51,17,54,51,50,22,21,17,35,17,52,38,35,34,6,7,17,35,80,154,
+88,91,105,122,154,55,61,40,59,37,154,5,182,254,253,42,118,99,254,184,1,12,
+75,61,18,18,254,144,0,0,1,0,140,255,231,5,148,5,182,0,21,0,0,1,17,16,2,4,
+35,34,36,2,17,17,51,17,16,18,22,51,50,54,18,17,17,5,148,132,254,230,236,225,
+254,231,132,160,97,211,171,177,218,94,5,182,253,100,254,191,254,174,160,160,
+1,84,1,63,2,156,253,110,254,221,254,245,126,131,1,9,1,32,2,146,0,255,255,
+0,140,0,0,5,148,7,242,18,38,0,88,0,0,16,7,2,208,1,40,0,0,0,1,0,140,0,0,5,
+148,5,207,0,21,0,0,33,17,16,2,38,35,34,6,2,17,17,35,17,16,18,36,51,50,4,18,
+17,17,4,244,97,219,173,171,213,95,160,132,1,25,225,236,1,26,132,2,146,1,38,
+1,8,126,128,254,246,254,222,253,110,2,156,1,61,1,85,161,160,254,174,254,191,
+253,100,0,255,255,0,140,0,0,5,148,7,100,18,38,0,88,0,0,16,7,2,212,1,99,0,
+0,0,1,0,100,0,0,4,232,5,182,0,21,0,0,19,33,32,4,18,17,16,2,4,33,33,53,33,
+32,36,54,53,52,38,36,33,33,100,1,43,1,112,1,87,146,154,254,165,254,156,254,
+213,1,43,1,59,1,7,114,112,254,244,254,200,254,213,5,182,143,254,196,254,240,
+254,225,254,201,133,145,96,236,254,245,240,101,255,255,0,100,0,0,4,232,7,
+100,18,38,0,90,0,0,16,6,2,212,55,0,255,255,0,100,0,0,4,232,7,100,18,38,0,
+90,0,0,16,6,2,209,30,0,255,255,0,100,0,0,4,232,5,182,18,38,0,90,0,0,16,7,
+2,211,1,108,254,4,255,255,0,100,0,0,4,232,5,182,18,38,0,90,0,0,16,6,2,213,
+113,0,0,1,0,140,0,0,5,16,5,182,0,21,0,0,1,33,32,4,6,21,20,22,4,33,33,21,33,
+32,36,2,17,16,18,36,33,33,5,16,254,213,254,200,254,247,115,114,1,7,1,59,1,
+43,254,213,254,155,254,166,154,153,1,91,1,101,1,43,5,37,99,239,248,253,236,
+97,145,133,1,55,1,31,1,25,1,56,138,0,255,255,0,140,0,0,5,16,7,100,18,38,0,
+95,0,0,16,7,2,212,1,244,0,0,255,255,0,50,255,231,6,202,5,182,16,39,0,86,1,
+54,0,0,16,7,2,213,255,6,0,0,255,255,0,140,255,231,7,36,5,182,16,38,0,86,0,
+0,16,7,2,213,5,6,0,0,255,255,0,50,0,0,6,202,5,207,16,39,0,88,1,54,0,0,16,
+7,2,213,255,6,0,0,255,255,0,140,0,0,7,36,5,207,16,38,0,88,0,0,16,7,2,213,
+5,6,0,0,255,255,0,50,0,0,6,202,7,100,16,39,0,88,1,54,0,0,16,39,2,212,2,153,
+0,0,16,7,2,213,255,6,0,0,255,255,0,140,0,0,7,36,7,100,16,38,0,88,0,0,16,39,
+2,212,1,99,0,0,16,7,2,213,5,6,0,0,255,255,0,50,0,0,5,166,5,182,16,39,0,90,
+0,190,0,0,16,7,2,213,255,6,0,0,255,255,0,100,0,0,6,111,5,182,16,38,0,90,0,
+0,16,7,2,213,4,81,0,0,255,255,0,50,0,0,5,166,7,100,16,39,0,90,0,190,0,0,16,
+39,2,213,255,6,0,0,16,7,2,212,0,245,0,0,255,255,0,100,0,0,6,111,7,100,16,
+38,0,90,0,0,16,39,2,213,4,81,0,0,16,6,2,212,55,0,255,255,0,50,0,0,6,60,5,
+182,16,39,0,95,1,44,0,0,16,7,2,213,255,6,0,0,255,255,0,140,0,0,6,0,5,182,
+16,38,0,95,0,0,16,7,2,213,3,226,0,0,255,255,0,50,0,0,6,60,7,100,16,39,0,95,
+1,44,0,0,16,39,2,213,255,6,0,0,16,7,2,212,3,32,0,0,255,255,0,140,0,0,6,0,
+7,100,16,38,0,95,0,0,16,39,2,213,3,226,0,0,16,7,2,212,1,244,0,0,255,255,0,
+50,0,0,6,60,5,182,16,39,0,95,1,44,0,0,16,7,2,210,255,6,0,0,0,1,0,80,2,188,
+2,42,5,182,0,13,0,0,1,34,38,53,52,54,51,21,34,6,21,20,22,23,2,42,252,222,
+232,242,174,146,130,190,2,188,190,210,184,178,138,110,114,136,123,3,255,255,
+0,140,255,231,6,238,5,182,16,38,0,86,0,0,16,7,0,84,5,220,0,0,255,255,0,140,
+0,0,6,238,5,207,16,38,0,88,0,0,16,7,0,84,5,220,0,0,255,255,0,100,0,0,6,58,
+5,182,16,38,0,90,0,0,16,7,0,84,5,40,0,0,255,255,0,140,0,0,6,58,5,182,16,38,
+0,95,0,0,16,7,0,84,5,40,0,0,0,2,0,120,0,0,4,48,5,207,0,14,0,27,0,0,33,17,
+6,6,35,34,0,53,52,18,51,50,18,17,17,3,52,38,35,34,6,21,20,22,51,50,54,53,
+3,144,69,151,93,222,254,255,247,229,233,243,160,174,139,152,167,173,165,122,
+172,2,21,52,44,1,32,241,248,1,17,254,235,254,241,252,85,3,239,143,192,196,
+172,187,205,183,137,0,255,255,0,140,0,0,4,68,7,242,18,38,0,119,0,0,16,7,2,
+208,0,130,0,0,0,2,0,140,0,0,4,68,5,207,0,14,0,27,0,0,51,17,16,18,51,50,18,
+21,20,0,35,34,38,39,17,17,20,22,51,50,54,53,52,38,35,34,6,21,140,244,232,
+229,247,254,253,220,92,152,69,170,124,164,174,167,152,140,173,3,171,1,16,
+1,20,254,239,248,244,254,227,43,53,253,235,3,134,136,184,205,187,173,195,
+193,142,0,255,255,0,140,0,0,4,68,7,100,18,38,0,119,0,0,16,7,2,212,0,197,0,
+0,0,2,0,120,255,231,4,48,5,182,0,14,0,27,0,0,1,17,16,2,35,34,2,53,52,0,51,
+50,22,23,17,17,52,38,35,34,6,21,20,22,51,50,54,53,4,48,244,232,229,247,1,
+3,220,92,152,69,171,123,164,174,166,153,140,173,5,182,252,85,254,240,254,
+236,1,17,248,244,1,29,43,53,2,21,252,122,136,184,205,187,171,197,193,142,
+255,255,0,120,255,231,4,78,7,100,18,38,0,121,0,0,16,7,2,212,2,48,0,0,255,
+255,0,120,255,231,5,75,7,100,18,38,0,121,0,0,16,7,2,209,1,227,0,0,0,2,0,140,
+255,231,4,68,5,182,0,14,0,27,0,0,1,17,54,54,51,50,0,21,20,2,35,34,2,17,17,
+19,20,22,51,50,54,53,52,38,35,34,6,21,1,44,69,151,93,222,1,1,247,229,233,
+243,160,174,139,152,167,173,165,124,170,5,182,253,235,53,43,254,224,241,248,
+254,239,1,21,1,15,3,171,252,17,143,192,196,172,187,205,184,136,0,255,255,
+0,102,255,231,4,68,7,100,18,38,0,124,0,0,16,7,2,212,255,58,0,0,255,255,0,
+50,0,0,5,132,5,207,16,39,0,117,1,84,0,0,16,7,2,213,255,6,0,0,255,255,0,120,
+0,0,5,222,5,207,16,38,0,117,0,0,16,7,2,213,3,192,0,0,255,255,0,50,0,0,5,152,
+5,207,16,39,0,119,1,84,0,0,16,7,2,213,255,6,0,0,255,255,0,140,0,5,5,222,5,
+212,16,38,0,119,0,5,16,7,2,213,3,192,0,0,255,255,0,50,0,0,5,152,7,100,16,
+39,0,119,1,84,0,0,16,39,2,213,255,6,0,0,16,7,2,212,2,25,0,0,255,255,0,140,
+0,5,5,222,7,100,16,38,0,119,0,5,16,39,2,213,3,192,0,0,16,7,2,212,0,197,0,
+0,255,255,0,50,255,231,5,132,5,182,16,39,0,121,1,84,0,0,16,7,2,213,255,6,
+0,0,255,255,0,120,255,231,5,222,5,182,16,38,0,121,0,0,16,7,2,213,3,192,0,
+0,255,255,0,50,255,231,5,162,7,100,16,39,0,121,1,84,0,0,16,39,2,213,255,6,
+0,0,16,7,2,212,3,132,0,0,255,255,0,120,255,231,5,222,7,100,16,38,0,121,0,
+0,16,39,2,213,3,192,0,0,16,7,2,212,2,48,0,0,255,255,0,50,255,231,5,152,5,
+182,16,39,0,124,1,84,0,0,16,7,2,213,255,6,0,0,255,255,0,140,255,231,5,222,
+5,182,16,38,0,124,0,0,16,7,2,213,3,192,0,0,255,255,0,50,255,231,5,152,7,100,
+16,39,0,124,1,84,0,0,16,39,2,213,255,6,0,0,16,7,2,212,0,142,0,0,255,255,0,
+102,255,231,5,222,7,100,16,38,0,124,0,0,16,39,2,213,3,192,0,0,16,7,2,212,
+255,58,0,0,255,255,0,50,255,231,5,152,5,182,16,39,2,210,255,6,0,0,16,7,0,
+124,1,84,0,0,0,2,0,120,2,173,2,209,5,182,0,13,0,24,0,0,1,21,54,51,50,22,21,
+20,6,35,34,38,53,17,18,6,21,20,22,51,50,54,53,52,35,1,18,56,92,133,166,173,
+128,149,151,234,80,74,72,64,83,147,5,182,249,35,155,126,122,160,180,161,1,
+180,254,162,77,62,80,70,69,72,148,0,0,2,0,80,2,173,2,169,5,182,0,13,0,24,
+0,0,1,17,20,6,35,34,38,53,52,54,51,50,23,53,2,54,53,52,38,35,34,21,20,22,
+51,2,169,151,149,129,172,166,133,92,56,74,74,81,65,147,83,64,5,182,254,76,
+161,180,159,123,126,155,35,249,253,129,70,80,62,77,148,72,69,0,255,255,0,
+120,0,0,5,144,5,207,16,38,0,117,0,0,16,7,0,84,4,126,0,0,255,255,0,140,0,5,
+5,144,5,212,16,38,0,119,0,5,16,7,0,84,4,126,0,0,255,255,0,120,255,231,5,144,
+5,182,16,38,0,121,0,0,16,7,0,84,4,126,0,0,255,255,0,140,255,231,5,144,5,182,
+16,38,0,124,0,0,16,7,0,84,4,126,0,0,0,1,0,120,0,0,4,132,5,207,0,20,0,0,19,
+16,18,54,51,50,30,2,21,17,35,17,52,38,38,35,34,6,6,7,120,102,228,192,148,
+193,114,59,160,72,155,127,144,147,64,7,3,74,1,1,1,6,126,88,148,235,242,252,
+250,3,61,213,200,100,85,185,230,0,255,255,0,140,0,0,4,152,7,242,18,38,0,149,
+0,0,16,7,2,208,0,173,0,0,0,1,0,140,0,0,4,152,5,207,0,20,0,0,1,46,2,35,34,
+6,6,21,17,35,17,52,62,2,51,50,22,18,17,3,248,7,65,147,143,126,153,75,160,
+58,112,196,148,194,227,101,3,74,231,185,84,97,198,218,252,195,3,6,242,232,
+149,90,127,254,250,255,0,0,255,255,0,140,0,0,4,152,7,100,18,38,0,149,0,0,
+16,7,2,212,0,237,0,0,0,1,0,120,255,231,4,132,5,182,0,20,0,0,1,30,2,51,50,
+54,54,53,17,51,17,20,14,2,35,34,38,2,17,1,24,7,65,147,143,126,153,75,160,
+58,112,196,148,194,227,101,2,108,231,185,84,97,198,218,3,61,252,250,242,232,
+149,90,127,1,6,1,0,0,255,255,0,120,255,231,4,162,7,100,18,38,0,151,0,0,16,
+7,2,212,2,132,0,0,255,255,0,120,255,231,5,159,7,100,18,38,0,151,0,0,16,7,
+2,209,2,55,0,0,0,1,0,140,255,231,4,152,5,182,0,20,0,0,1,16,2,6,35,34,46,2,
+53,17,51,17,20,22,22,51,50,54,54,55,4,152,102,228,192,148,193,114,59,160,
+72,155,127,144,147,64,7,2,108,254,255,254,250,126,88,148,235,242,3,6,252,
+195,213,200,100,85,185,230,255,255,0,100,255,231,4,152,7,100,18,38,0,154,
+0,0,16,7,2,212,255,56,0,0,255,255,0,50,0,0,5,216,5,207,16,39,0,147,1,84,0,
+0,16,7,2,213,255,6,0,0,255,255,0,120,0,0,6,50,5,207,16,38,0,147,0,0,16,7,
+2,213,4,20,0,0,255,255,0,50,0,0,5,236,5,207,16,39,0,149,1,84,0,0,16,7,2,213,
+255,6,0,0,255,255,0,140,0,0,6,50,5,207,16,38,0,149,0,0,16,7,2,213,4,20,0,
+0,255,255,0,50,0,0,5,236,7,100,16,39,0,149,1,84,0,0,16,39,2,213,255,6,0,0,
+16,7,2,212,2,65,0,0,255,255,0,140,0,0,6,50,7,100,16,38,0,149,0,0,16,39,2,
+213,4,20,0,0,16,7,2,212,0,237,0,0,255,255,0,50,255,231,5,216,5,182,16,39,
+0,151,1,84,0,0,16,7,2,213,255,6,0,0,255,255,0,120,255,231,6,50,5,182,16,38,
+0,151,0,0,16,7,2,213,4,20,0,0,255,255,0,50,255,231,5,246,7,100,16,39,0,151,
+1,84,0,0,16,39,2,212,3,216,0,0,16,7,2,213,255,6,0,0,255,255,0,120,255,231,
+6,50,7,100,16,38,0,151,0,0,16,39,2,212,2,132,0,0,16,7,2,213,4,20,0,0,255,
+255,0,50,255,231,5,236,5,182,16,39,0,154,1,84,0,0,16,7,2,213,255,6,0,0,255,
+255,0,140,255,231,6,50,5,182,16,38,0,154,0,0,16,7,2,213,4,20,0,0,255,255,
+0,50,255,231,5,236,7,100,16,39,0,154,1,84,0,0,16,39,2,212,0,140,0,0,16,7,
+2,213,255,6,0,0,255,255,0,100,255,231,6,50,7,100,16,38,0,154,0,0,16,39,2,
+213,4,20,0,0,16,7,2,212,255,56,0,0,255,255,0,50,255,231,5,236,5,182,16,39,
+0,154,1,84,0,0,16,7,2,210,255,6,0,0,0,1,0,100,2,173,2,189,5,182,0,17,0,0,
+19,20,22,51,50,54,53,53,51,21,20,6,35,34,38,53,17,51,254,72,74,70,77,154,
+160,141,149,151,154,4,21,122,100,99,98,45,52,156,172,180,161,1,180,0,0,1,
+0,100,2,173,2,189,5,182,0,17,0,0,1,20,6,35,34,38,53,53,51,21,20,22,51,50,
+54,53,17,51,2,189,151,149,141,160,154,76,71,74,72,154,4,2,161,180,171,157,
+52,45,97,100,99,123,1,161,0,1,0,100,0,0,4,47,5,182,0,5,0,0,33,35,17,33,53,
+33,4,47,160,252,213,3,203,5,37,145,255,255,0,140,0,0,4,87,7,242,18,38,0,175,
+0,0,16,6,2,208,127,0,0,1,0,140,0,0,4,87,5,182,0,5,0,0,19,33,21,33,17,35,140,
+3,203,252,213,160,5,182,145,250,219,0,255,255,0,140,0,0,4,87,7,100,18,38,
+0,175,0,0,16,7,2,212,0,200,0,0,0,1,0,100,0,0,4,47,5,182,0,5,0,0,33,33,53,
+33,17,51,4,47,252,53,3,43,160,145,5,37,255,255,0,100,0,0,4,87,7,100,18,38,
+0,177,0,0,16,7,2,212,2,57,0,0,255,255,0,100,0,0,5,86,7,100,18,38,0,177,0,
+0,16,7,2,209,1,238,0,0,0,1,0,140,0,0,4,87,5,182,0,5,0,0,19,51,17,33,21,33,
+140,160,3,43,252,53,5,182,250,219,145,0,255,255,0,100,0,0,4,87,7,100,18,38,
+0,180,0,0,16,7,2,212,255,56,0,0,255,255,0,50,0,0,4,187,5,182,16,39,0,173,
+0,140,0,0,16,7,2,213,255,6,0,0,255,255,0,100,0,0,5,221,5,182,16,38,0,173,
+0,0,16,7,2,213,3,191,0,0,255,255,0,50,0,0,5,171,5,182,16,39,0,175,1,84,0,
+0,16,7,2,213,255,6,0,0,255,255,0,140,0,0,5,21,5,182,16,38,0,175,0,0,16,7,
+2,213,2,247,0,0,255,255,0,50,0,0,5,171,7,100,16,39,0,175,1,84,0,0,16,39,2,
+212,2,28,0,0,16,7,2,213,255,6,0,0,255,255,0,140,0,0,5,21,7,100,16,38,0,175,
+0,0,16,39,2,213,2,247,0,0,16,7,2,212,0,200,0,0,255,255,0,50,0,0,4,187,5,182,
+16,39,0,177,0,140,0,0,16,7,2,213,255,6,0,0,255,255,0,100,0,0,5,221,5,182,
+16,38,0,177,0,0,16,7,2,213,3,191,0,0,255,255,0,50,0,0,4,227,7,100,16,39,0,
+177,0,140,0,0,16,39,2,212,2,197,0,0,16,7,2,213,255,6,0,0,255,255,0,100,0,
+0,5,221,7,100,16,38,0,177,0,0,16,39,2,213,3,191,0,0,16,7,2,212,2,57,0,0,255,
+255,0,50,0,0,5,171,5,182,16,39,0,180,1,84,0,0,16,7,2,213,255,6,0,0,255,255,
+0,140,0,0,5,21,5,182,16,38,0,180,0,0,16,7,2,213,2,247,0,0,255,255,0,50,0,
+0,5,171,7,100,16,39,0,180,1,84,0,0,16,39,2,213,255,6,0,0,16,7,2,212,0,140,
+0,0,255,255,0,100,0,0,5,21,7,100,16,38,0,180,0,0,16,39,2,213,2,247,0,0,16,
+7,2,212,255,56,0,0,255,255,0,50,255,246,5,171,5,172,16,39,0,180,1,84,255,
+246,16,7,2,210,255,6,0,0,0,1,0,80,2,188,2,134,5,182,0,5,0,0,19,51,17,33,21,
+33,80,154,1,156,253,202,5,182,253,144,138,0,0,1,0,80,2,188,2,152,5,182,0,
+17,0,0,1,35,34,38,53,52,54,51,51,21,35,34,6,21,20,22,51,51,2,152,109,250,
+225,229,227,128,131,159,140,138,200,92,2,188,189,211,187,175,138,111,113,
+139,123,0,0,1,0,80,2,188,2,134,5,182,0,5,0,0,1,33,53,33,17,51,2,134,253,202,
+1,156,154,2,188,138,2,112,0,1,0,80,2,188,2,165,5,197,0,24,0,0,1,33,53,55,
+54,54,53,52,38,35,34,6,21,35,54,54,51,50,22,21,20,6,7,7,33,2,165,253,189,
+232,131,60,81,58,73,81,148,7,163,135,123,167,47,66,208,1,67,2,188,85,207,
+119,94,36,44,54,64,61,126,137,132,98,68,93,59,189,0,1,0,120,0,0,4,54,5,207,
+0,25,0,0,33,33,53,1,62,2,53,52,38,35,34,6,21,35,54,54,51,50,4,21,20,2,7,1,
+33,4,54,252,97,1,131,187,124,65,175,147,147,165,160,9,245,220,228,1,0,141,
+234,254,210,2,165,113,1,90,168,163,158,91,139,164,131,122,192,206,236,205,
+154,254,237,205,254,245,0,2,0,100,255,231,6,196,4,1,0,15,0,27,0,0,1,50,0,
+21,20,0,35,34,0,53,52,54,55,55,33,53,4,6,21,20,22,51,50,54,53,52,38,35,4,
+173,244,1,35,254,232,236,226,254,219,56,47,39,253,29,3,180,191,212,155,156,
+192,205,152,4,1,254,234,243,242,254,225,1,28,218,122,183,51,47,145,145,217,
+182,162,199,211,176,171,202,255,255,0,120,255,231,6,216,6,93,18,38,0,204,
+0,0,16,7,2,208,1,59,254,107,0,2,0,120,255,231,6,216,4,1,0,15,0,27,0,0,1,21,
+33,23,22,22,21,20,0,35,34,0,53,52,0,51,18,54,53,52,38,35,34,6,21,20,22,51,
+6,216,253,29,40,46,56,254,219,226,237,254,233,1,35,244,128,212,191,167,152,
+205,190,158,4,1,145,47,51,183,122,218,254,228,1,31,242,243,1,22,252,119,199,
+162,182,217,202,171,173,214,255,255,0,120,255,231,6,216,5,207,18,38,0,204,
+0,0,16,7,2,212,1,127,254,107,0,2,0,100,0,0,6,196,4,26,0,15,0,27,0,0,51,53,
+33,39,38,38,53,52,0,51,50,0,21,20,0,35,2,6,21,20,22,51,50,54,53,52,38,35,
+100,2,227,39,47,56,1,37,226,237,1,23,254,221,244,128,212,191,167,152,205,
+190,158,145,47,51,183,122,218,1,28,254,225,242,243,254,234,3,137,199,162,
+182,217,202,171,173,214,0,255,255,0,100,0,0,6,196,5,207,18,38,0,206,0,0,16,
+7,2,212,3,12,254,107,255,255,0,100,0,0,6,196,5,207,18,38,0,206,0,0,16,7,2,
+209,2,198,254,107,0,2,0,120,0,0,6,216,4,26,0,15,0,27,0,0,33,34,0,53,52,0,
+51,50,0,21,20,6,7,7,33,21,36,54,53,52,38,35,34,6,21,20,22,51,2,143,244,254,
+221,1,24,236,226,1,37,56,46,40,2,227,252,76,191,212,155,156,192,205,152,1,
+22,243,242,1,31,254,228,218,122,183,51,47,145,145,217,182,162,199,211,176,
+171,202,255,255,0,120,0,0,6,216,5,207,18,38,0,209,0,0,16,7,2,212,0,220,254,
+107,255,255,0,50,255,231,8,24,4,1,16,39,0,202,1,84,0,0,16,7,2,213,255,6,0,
+0,255,255,0,100,255,231,8,64,4,1,16,38,0,202,0,0,16,7,2,213,6,34,0,0,255,
+255,0,50,0,0,8,44,4,26,16,39,0,209,1,84,0,0,16,7,2,213,255,6,0,0,255,255,
+0,120,0,0,6,216,4,26,18,38,0,209,0,0,16,7,2,213,4,140,0,0,255,255,0,50,0,
+0,8,44,5,207,16,39,0,209,1,84,0,0,16,39,2,213,255,6,0,0,16,7,2,212,2,48,254,
+107,255,255,0,120,0,0,6,216,5,207,18,38,0,209,0,0,16,39,2,213,4,140,0,0,16,
+7,2,212,0,220,254,107,255,255,0,120,0,0,6,216,5,207,18,38,0,209,0,0,16,7,
+2,209,0,141,254,107,0,2,0,80,3,32,4,112,5,192,0,13,0,25,0,0,1,33,21,33,34,
+38,53,52,54,51,50,22,21,20,0,6,21,20,22,51,50,54,53,52,38,35,2,158,1,210,
+253,29,131,186,189,138,138,188,254,113,100,101,72,73,99,98,74,3,170,138,205,
+138,137,192,192,137,117,1,52,109,79,80,111,112,79,78,110,0,0,1,0,100,2,173,
+3,33,5,182,0,19,0,0,1,17,20,6,35,34,38,53,17,51,17,20,22,22,51,50,54,54,53,
+17,3,33,183,168,189,161,154,34,83,79,75,84,38,5,182,254,173,243,195,197,241,
+1,83,254,203,156,113,61,64,120,146,1,53,0,0,2,0,50,3,32,4,82,5,192,0,13,0,
+25,0,0,0,22,21,20,6,35,33,53,33,38,53,52,54,51,18,54,53,52,38,35,34,6,21,
+20,22,51,3,148,190,185,132,253,29,1,210,63,188,138,72,101,100,73,74,98,98,
+74,5,192,193,136,137,206,138,88,117,137,192,253,251,111,80,79,109,109,79,
+78,113,0,0,1,0,100,0,0,6,156,4,1,0,16,0,0,1,32,17,20,0,35,35,53,51,50,54,
+53,52,38,35,33,53,4,105,2,51,254,229,233,204,212,157,191,210,215,252,17,4,
+1,253,252,230,254,233,145,204,163,191,177,145,0,255,255,0,120,0,0,6,176,6,
+93,18,38,0,223,0,0,16,7,2,208,1,59,254,107,0,1,0,120,0,0,6,176,4,1,0,16,0,
+0,1,34,6,21,20,22,51,51,21,35,34,0,53,16,33,33,21,2,193,215,210,190,158,212,
+204,232,254,228,2,51,4,5,3,112,177,191,164,203,145,1,23,230,2,4,145,0,255,
+255,0,120,0,0,6,176,5,207,18,38,0,223,0,0,16,7,2,212,1,124,254,107,0,1,0,
+100,0,0,6,156,4,1,0,16,0,0,37,50,54,53,52,38,35,35,53,51,50,0,21,16,33,33,
+53,4,83,215,210,190,158,212,204,232,1,28,253,205,251,251,145,177,191,164,
+203,145,254,233,230,253,252,145,255,255,0,100,0,0,6,156,5,207,18,38,0,225,
+0,0,16,7,2,212,2,248,254,107,255,255,0,100,0,0,6,156,5,207,18,38,0,225,0,
+0,16,7,2,209,2,198,254,107,0,1,0,120,0,0,6,176,4,1,0,16,0,0,37,21,33,32,17,
+52,0,51,51,21,35,34,6,21,20,22,51,6,176,251,251,253,205,1,27,233,204,212,
+157,191,210,215,145,145,2,4,230,1,23,145,204,163,191,177,255,255,0,120,0,
+0,6,176,5,207,18,38,0,228,0,0,16,7,2,212,0,210,254,107,255,255,0,50,0,0,7,
+240,4,1,16,39,0,221,1,84,0,0,16,7,2,213,255,6,0,0,255,255,0,100,0,0,8,54,
+4,1,16,38,0,221,0,0,16,7,2,213,6,24,0,0,255,255,0,50,0,0,8,4,4,1,16,39,2,
+213,255,6,0,0,16,7,0,223,1,84,0,0,255,255,0,120,0,0,8,54,4,1,16,39,2,213,
+6,24,0,0,16,6,0,223,0,0,255,255,0,50,0,0,8,4,5,207,16,39,2,213,255,6,0,0,
+16,39,0,223,1,84,0,0,16,7,2,212,2,208,254,107,255,255,0,120,0,0,8,54,5,207,
+16,39,2,213,6,24,0,0,16,38,0,223,0,0,16,7,2,212,1,124,254,107,255,255,0,100,
+0,0,6,156,4,1,18,38,0,225,0,0,16,7,2,213,255,62,0,0,255,255,0,100,0,0,8,54,
+4,1,16,38,0,225,0,0,16,7,2,213,6,24,0,0,255,255,0,100,0,0,6,156,5,207,18,
+38,0,225,0,0,16,39,2,213,255,62,0,0,16,7,2,212,2,248,254,107,255,255,0,100,
+0,0,8,54,5,207,16,38,0,225,0,0,16,39,2,213,6,24,0,0,16,7,2,212,2,248,254,
+107,255,255,0,50,0,0,8,4,4,1,16,39,2,213,255,6,0,0,16,7,0,228,1,84,0,0,255,
+255,0,120,0,0,6,176,4,1,18,38,0,228,0,0,16,7,2,213,4,140,0,0,255,255,0,50,
+0,0,8,4,5,207,16,39,2,213,255,6,0,0,16,39,0,228,1,84,0,0,16,7,2,212,2,38,
+254,107,255,255,0,120,0,0,6,176,5,207,18,38,0,228,0,0,16,39,2,212,0,210,254,
+107,16,7,2,213,4,140,0,0,0,1,0,80,3,32,3,221,5,182,0,17,0,0,1,33,34,38,53,
+52,54,51,51,21,35,34,6,21,20,22,51,33,3,221,253,210,164,187,187,151,54,45,
+87,106,105,93,2,45,3,32,180,161,145,176,138,103,80,94,109,0,0,1,0,80,2,133,
+2,142,5,207,0,14,0,0,1,51,21,5,5,21,5,5,21,35,37,53,37,37,53,2,111,31,254,
+121,1,135,254,121,1,135,29,253,223,1,105,254,151,5,207,117,118,127,103,138,
+121,118,190,105,131,128,105,0,0,1,0,120,255,231,4,122,5,207,0,14,0,0,9,2,
+21,35,1,53,1,1,53,1,51,21,1,1,4,122,252,208,3,48,20,252,18,2,227,253,29,3,
+238,20,252,208,3,48,2,174,254,222,254,248,157,1,82,154,1,8,1,8,154,1,82,157,
+254,248,254,222,0,1,0,120,0,0,4,18,5,182,0,13,0,0,1,21,16,0,33,51,17,35,17,
+35,32,0,17,53,1,24,1,35,1,55,160,160,41,254,163,254,140,5,182,137,254,165,
+254,204,253,98,2,13,1,141,1,110,174,0,255,255,0,140,0,0,4,68,7,242,18,38,
+0,249,0,0,16,7,2,208,1,152,0,0,0,1,0,140,0,0,4,38,5,182,0,13,0,0,1,21,16,
+0,33,35,17,35,17,51,32,0,17,53,4,38,254,140,254,163,41,160,160,1,54,1,36,
+5,182,174,254,146,254,115,253,243,2,158,1,51,1,92,137,0,255,255,0,140,0,0,
+4,57,7,100,18,38,0,249,0,0,16,7,2,212,2,27,0,0,0,1,0,120,0,0,4,18,5,182,0,
+13,0,0,51,53,16,0,33,51,17,51,17,35,32,0,17,21,120,1,116,1,93,41,160,160,
+254,202,254,220,174,1,110,1,141,2,13,253,98,254,205,254,164,137,255,255,0,
+120,0,0,4,58,7,100,18,38,0,251,0,0,16,7,2,212,2,28,0,0,255,255,0,120,0,0,
+5,49,7,100,18,38,0,251,0,0,16,7,2,209,1,201,0,0,0,1,0,140,0,0,4,38,5,182,
+0,13,0,0,33,53,16,0,33,35,17,51,17,51,32,0,17,21,3,134,254,221,254,201,160,
+160,41,1,93,1,116,137,1,91,1,52,2,158,253,243,254,115,254,146,174,0,255,255,
+0,100,0,0,4,38,7,100,18,38,0,254,0,0,16,7,2,212,255,56,0,0,255,255,0,50,0,
+0,5,62,5,182,16,39,0,247,1,44,0,0,16,7,2,213,255,6,0,0,255,255,0,120,0,0,
+5,152,5,182,16,38,0,247,0,0,16,7,2,213,3,122,0,0,255,255,0,50,0,0,5,82,5,
+182,16,39,0,249,1,44,0,0,16,7,2,213,255,6,0,0,255,255,0,140,0,0,5,152,5,182,
+16,38,0,249,0,0,16,7,2,213,3,122,0,0,255,255,0,50,0,0,5,101,7,100,16,39,0,
+249,1,44,0,0,16,39,2,213,255,6,0,0,16,7,2,212,3,71,0,0,255,255,0,140,0,0,
+5,152,7,100,16,38,0,249,0,0,16,39,2,213,3,122,0,0,16,7,2,212,2,27,0,0,255,
+255,0,50,0,0,5,62,5,182,16,39,0,251,1,44,0,0,16,7,2,213,255,6,0,0,255,255,
+0,120,0,0,5,152,5,182,16,38,0,251,0,0,16,7,2,213,3,122,0,0,255,255,0,50,0,
+0,5,102,7,100,16,39,0,251,1,44,0,0,16,39,2,212,3,72,0,0,16,7,2,213,255,6,
+0,0,255,255,0,120,0,0,5,152,7,100,16,38,0,251,0,0,16,39,2,213,3,122,0,0,16,
+7,2,212,2,28,0,0,255,255,0,50,0,0,5,82,5,182,16,39,0,254,1,44,0,0,16,7,2,
+213,255,6,0,0,255,255,0,140,0,0,5,152,5,182,16,38,0,254,0,0,16,7,2,213,3,
+122,0,0,255,255,0,50,0,0,5,82,7,100,16,39,0,254,1,44,0,0,16,39,2,213,255,
+6,0,0,16,6,2,212,100,0,255,255,0,100,0,0,5,152,7,100,16,38,0,254,0,0,16,39,
+2,213,3,122,0,0,16,7,2,212,255,56,0,0,255,255,0,50,0,0,5,82,5,182,16,39,0,
+254,1,44,0,0,16,7,2,210,255,6,0,0,0,1,0,80,2,188,2,128,5,182,0,14,0,0,1,53,
+52,38,38,35,35,17,51,17,51,50,22,21,21,1,230,49,106,135,116,154,32,195,179,
+2,188,85,107,118,50,1,146,254,248,189,201,108,0,1,0,80,2,174,2,157,5,197,
+0,27,0,0,19,22,51,50,54,53,52,36,38,53,52,54,51,50,23,7,38,35,34,21,20,4,
+22,21,20,33,34,39,220,48,80,72,86,254,219,124,164,148,181,87,140,47,81,158,
+1,34,127,254,191,172,87,3,119,63,48,44,56,80,113,84,107,121,136,65,63,91,
+60,78,107,78,239,136,0,1,0,80,2,188,2,128,5,182,0,14,0,0,19,53,52,54,51,51,
+17,51,17,35,34,6,6,21,21,80,179,195,32,154,116,134,107,49,2,188,108,202,188,
+1,8,254,110,50,117,108,85,0,0,1,0,80,2,188,3,33,5,158,0,11,0,0,1,33,34,38,
+53,17,51,17,20,22,51,33,3,33,254,148,177,180,154,98,101,1,112,2,188,178,176,
+1,128,254,124,99,113,0,0,2,0,80,2,21,2,128,5,182,0,17,0,27,0,0,19,51,17,50,
+22,21,20,6,35,34,38,53,52,54,51,38,35,35,5,34,6,21,20,22,51,50,54,53,80,154,
+190,216,129,118,90,118,151,115,54,189,128,1,152,69,80,33,31,40,47,5,182,254,
+248,196,177,140,152,128,95,94,129,81,204,58,49,35,43,80,71,0,0,2,0,80,2,21,
+2,128,5,182,0,17,0,27,0,0,1,35,34,7,50,22,21,20,6,35,34,38,53,52,54,51,17,
+51,1,20,22,51,50,54,53,52,38,35,2,128,128,189,54,116,150,118,90,118,129,216,
+190,154,254,102,46,41,31,33,80,69,4,36,81,128,95,94,129,152,140,177,196,1,
+8,253,128,71,80,43,35,49,58,0,0,3,0,80,1,137,2,118,6,148,0,13,0,25,0,37,0,
+0,1,53,52,38,35,35,17,51,21,51,50,22,21,21,0,22,21,20,6,35,34,38,53,52,54,
+51,0,22,21,20,6,35,34,38,53,52,54,51,1,177,67,83,156,154,52,126,128,254,176,
+71,71,50,50,71,71,50,1,102,71,71,50,50,71,71,50,2,203,70,126,89,1,106,224,
+169,187,67,3,201,71,50,50,71,71,50,50,71,251,231,71,50,50,71,71,50,50,71,
+0,4,0,80,255,235,5,77,7,110,0,13,0,22,0,34,0,46,0,0,1,53,52,38,35,35,17,51,
+21,51,50,22,21,21,1,35,1,53,1,51,21,1,1,0,22,21,20,6,35,34,38,53,52,54,51,
+0,22,21,20,6,35,34,38,53,52,54,51,2,90,67,83,156,154,52,126,128,2,89,20,251,
+23,4,233,20,252,4,3,252,254,251,71,71,50,50,71,71,50,252,248,71,71,50,50,
+71,71,50,4,231,70,126,89,1,106,224,169,187,67,251,4,2,225,30,2,226,172,253,
+187,253,188,6,55,71,50,50,71,71,50,50,71,254,36,71,50,50,71,71,50,50,71,0,
+255,255,0,80,0,0,7,144,6,148,16,38,1,21,0,0,16,7,0,95,2,128,0,0,255,255,0,
+80,255,231,6,196,6,148,16,39,0,124,2,128,0,0,16,6,1,21,0,0,255,255,0,80,255,
+231,7,24,6,148,16,38,1,21,0,0,16,7,0,154,2,128,0,0,0,1,0,120,255,231,6,74,
+5,207,0,31,0,0,19,53,16,54,51,50,22,17,17,20,22,51,50,54,53,53,51,21,16,6,
+35,34,38,17,17,52,38,35,34,6,21,21,120,211,214,202,198,113,124,137,131,160,
+211,214,202,198,113,124,137,131,3,116,94,1,6,247,246,255,0,254,8,196,165,
+165,192,101,94,254,250,247,246,1,0,1,248,196,165,164,193,101,0,1,0,120,255,
+231,6,74,5,207,0,31,0,0,1,53,52,38,35,34,6,21,17,16,6,35,34,38,17,53,51,21,
+20,22,51,50,54,53,17,16,54,51,50,22,17,21,5,170,131,137,125,112,198,202,214,
+211,160,131,137,125,112,198,202,214,211,3,116,101,192,165,166,195,254,8,255,
+0,246,247,1,6,94,101,192,165,166,195,1,248,1,0,246,247,254,250,94,0,255,255,
+0,120,255,231,6,74,7,100,18,38,1,27,0,0,16,7,2,212,2,248,0,0,0,1,0,120,255,
+221,7,105,3,111,0,35,0,0,5,38,2,53,52,54,51,50,4,0,22,51,50,54,53,52,38,39,
+55,22,18,21,20,6,35,34,36,0,38,35,34,6,21,20,22,23,1,151,141,146,205,156,
+149,1,14,1,76,200,98,99,103,117,81,74,130,159,205,156,149,254,240,254,189,
+201,104,99,103,106,90,35,100,1,4,150,181,214,183,254,84,138,134,122,112,214,
+51,125,83,254,236,149,181,214,179,1,165,149,134,122,109,199,69,0,255,255,
+0,120,255,221,7,105,5,207,18,38,1,29,0,0,16,7,2,212,2,75,254,107,0,1,0,120,
+255,221,7,105,3,111,0,35,0,0,37,54,54,53,52,38,35,34,6,0,4,35,34,38,53,52,
+18,55,23,6,6,21,20,22,51,50,54,0,36,51,50,22,21,20,2,7,6,0,90,106,105,97,
+103,203,254,192,254,239,150,156,205,159,130,74,82,116,105,97,99,200,1,81,
+1,10,147,156,205,144,143,92,68,200,109,125,131,150,254,94,181,214,181,148,
+1,21,83,125,52,214,111,125,131,140,1,175,178,214,181,149,254,253,102,0,255,
+255,0,120,255,221,7,105,5,207,18,38,1,31,0,0,16,7,2,212,2,75,254,107,255,
+255,0,50,255,231,7,118,5,207,16,39,1,26,1,44,0,0,16,7,2,213,255,6,0,0,255,
+255,0,120,255,231,7,188,5,207,16,38,1,26,0,0,16,7,2,213,5,158,0,0,255,255,
+0,50,255,231,7,118,5,207,16,39,1,27,1,44,0,0,16,7,2,213,255,6,0,0,255,255,
+0,120,255,231,7,188,5,207,16,38,1,27,0,0,16,7,2,213,5,158,0,0,255,255,0,50,
+255,231,7,118,7,100,16,39,1,27,1,44,0,0,16,39,2,212,4,36,0,0,16,7,2,213,255,
+6,0,0,255,255,0,120,255,231,7,188,7,100,16,38,1,27,0,0,16,39,2,212,2,248,
+0,0,16,7,2,213,5,158,0,0,255,255,0,50,255,221,8,149,3,111,16,39,1,29,1,44,
+0,0,16,7,2,213,255,6,0,0,255,255,0,120,255,221,8,219,3,111,16,38,1,29,0,0,
+16,7,2,213,6,189,0,0,255,255,0,50,255,221,8,149,5,207,16,39,1,29,1,44,0,0,
+16,39,2,213,255,6,0,0,16,7,2,212,3,119,254,107,255,255,0,120,255,221,8,219,
+5,207,16,38,1,29,0,0,16,39,2,213,6,189,0,0,16,7,2,212,2,75,254,107,255,255,
+0,50,255,221,8,149,3,111,16,39,1,31,1,44,0,0,16,7,2,213,255,6,0,0,255,255,
+0,120,255,221,8,219,3,111,16,38,1,31,0,0,16,7,2,213,6,189,0,0,255,255,0,50,
+255,221,8,149,5,207,16,39,1,31,1,44,0,0,16,39,2,213,255,6,0,0,16,7,2,212,
+3,119,254,107,255,255,0,120,255,221,8,219,5,207,16,38,1,31,0,0,16,39,2,213,
+6,189,0,0,16,7,2,212,2,75,254,107,0,1,0,80,2,252,4,176,5,220,0,34,0,0,1,54,
+54,53,52,35,34,6,2,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,18,54,
+51,50,22,21,20,6,7,3,168,48,62,93,50,114,188,177,100,105,139,103,84,77,48,
+62,52,41,53,120,197,164,95,108,136,100,87,3,118,44,154,83,172,109,254,213,
+146,172,139,119,219,66,122,48,145,88,89,85,119,1,50,129,168,138,120,215,72,
+0,0,1,0,80,0,0,4,7,5,207,0,8,0,0,1,17,35,17,33,53,1,23,1,4,7,160,252,233,
+2,211,115,253,188,2,175,253,81,2,30,55,3,122,90,253,58,0,255,255,0,120,0,
+0,4,47,7,242,18,38,1,50,0,0,16,7,2,208,255,115,0,0,0,1,0,120,0,0,4,47,5,207,
+0,8,0,0,1,1,55,1,21,33,17,35,17,3,45,253,188,115,2,211,252,233,160,2,175,
+2,198,90,252,134,55,253,226,2,175,0,255,255,0,120,0,0,4,47,7,100,18,38,1,
+50,0,0,16,6,2,212,185,0,0,1,0,80,255,231,4,7,5,182,0,8,0,0,1,1,7,1,53,33,
+17,51,17,1,82,2,68,115,253,45,3,23,160,3,7,253,58,90,3,122,55,2,30,253,81,
+0,255,255,0,80,255,231,4,37,7,100,18,38,1,52,0,0,16,7,2,212,2,7,0,0,255,255,
+0,80,255,231,5,30,7,100,18,38,1,52,0,0,16,7,2,209,1,182,0,0,0,1,0,120,255,
+231,4,47,5,182,0,8,0,0,19,17,51,17,33,21,1,39,1,120,160,3,23,253,45,115,2,
+68,3,7,2,175,253,226,55,252,134,90,2,198,255,255,0,80,255,231,4,47,7,100,
+18,38,1,55,0,0,16,7,2,212,255,36,0,0,255,255,0,50,0,0,5,51,5,207,16,39,1,
+48,1,44,0,0,16,7,2,213,255,6,0,0,255,255,0,80,0,0,5,121,5,207,16,38,1,48,
+0,0,16,7,2,213,3,91,0,0,255,255,0,50,0,0,5,91,5,207,16,39,1,50,1,44,0,0,16,
+7,2,213,255,6,0,0,255,255,0,120,0,0,5,121,5,207,16,38,1,50,0,0,16,7,2,213,
+3,91,0,0,255,255,0,50,0,0,5,91,7,100,16,39,1,50,1,44,0,0,16,39,2,212,0,229,
+0,0,16,7,2,213,255,6,0,0,255,255,0,120,0,0,5,121,7,100,16,38,1,50,0,0,16,
+38,2,212,185,0,16,7,2,213,3,91,0,0,255,255,0,50,255,231,5,51,5,182,16,39,
+1,52,1,44,0,0,16,7,2,213,255,6,0,0,255,255,0,80,255,231,5,121,5,182,16,38,
+1,52,0,0,16,7,2,213,3,91,0,0,255,255,0,50,255,231,5,81,7,100,16,39,1,52,1,
+44,0,0,16,39,2,212,3,51,0,0,16,7,2,213,255,6,0,0,255,255,0,80,255,231,5,121,
+7,100,16,38,1,52,0,0,16,39,2,212,2,7,0,0,16,7,2,213,3,91,0,0,255,255,0,50,
+255,231,5,91,5,182,16,39,1,55,1,44,0,0,16,7,2,213,255,6,0,0,255,255,0,120,
+255,231,5,121,5,182,16,38,1,55,0,0,16,7,2,213,3,91,0,0,255,255,0,50,255,231,
+5,91,7,100,16,39,1,55,1,44,0,0,16,38,2,212,80,0,16,7,2,213,255,6,0,0,255,
+255,0,80,255,231,5,121,7,100,16,38,1,55,0,0,16,39,2,212,255,36,0,0,16,7,2,
+213,3,91,0,0,255,255,0,50,255,231,5,91,5,182,16,39,1,55,1,44,0,0,16,7,2,210,
+255,6,0,0,0,1,0,100,2,155,2,113,5,182,0,8,0,0,19,51,17,33,21,1,39,19,33,100,
+154,1,115,254,127,118,245,254,245,5,182,254,241,60,254,48,90,1,40,0,0,1,0,
+80,2,188,4,23,5,182,0,14,0,0,1,21,35,3,3,35,3,3,35,53,19,51,19,19,51,4,23,
+132,102,215,65,221,100,132,146,125,217,204,125,2,227,38,2,9,253,247,2,3,253,
+252,36,2,214,253,245,2,11,0,0,1,0,80,1,164,2,182,4,60,0,11,0,0,19,51,17,51,
+17,51,21,35,17,35,17,35,80,230,154,230,230,154,230,3,52,1,8,254,248,138,254,
+250,1,6,0,1,0,80,1,166,2,223,4,60,0,11,0,0,19,19,3,51,23,55,51,3,19,35,39,
+7,80,242,242,172,155,156,172,242,242,170,158,157,1,166,1,74,1,76,214,214,
+254,180,254,182,215,215,0,1,0,120,255,231,6,196,4,1,0,19,0,0,1,17,20,22,51,
+50,54,53,17,33,21,33,17,20,0,35,34,0,53,17,1,24,200,183,183,199,2,175,253,
+241,254,225,255,253,254,222,4,1,253,244,182,199,199,182,2,12,145,254,129,
+243,254,233,1,20,247,2,15,0,0,1,0,100,255,231,6,176,4,1,0,19,0,0,1,17,20,
+0,35,34,0,53,17,33,53,33,17,20,22,51,50,54,53,17,6,176,254,224,255,255,254,
+225,253,241,2,175,199,183,183,200,4,1,253,241,246,254,235,1,23,243,1,127,
+145,253,244,182,199,199,182,2,12,0,0,1,0,100,0,0,6,176,4,26,0,19,0,0,33,17,
+52,38,35,34,6,21,17,33,53,33,17,52,0,51,50,0,21,17,6,16,200,183,183,199,253,
+81,2,15,1,31,255,253,1,34,2,12,182,199,199,182,253,244,145,1,127,243,1,23,
+254,236,247,253,241,0,255,255,0,120,0,0,6,196,6,93,18,38,1,80,0,0,16,7,2,
+208,0,180,254,107,0,1,0,120,0,0,6,196,4,26,0,19,0,0,51,17,52,0,51,50,0,21,
+17,33,21,33,17,52,38,35,34,6,21,17,120,1,32,255,255,1,31,2,15,253,81,199,
+183,183,200,2,15,246,1,21,254,233,243,254,129,145,2,12,182,199,199,182,253,
+244,255,255,0,120,0,0,6,196,5,207,18,38,1,80,0,0,16,7,2,212,0,240,254,107,
+0,1,0,140,0,0,4,68,5,182,0,18,0,0,19,33,50,4,21,20,4,35,33,17,35,17,33,50,
+54,53,16,33,33,140,1,197,237,1,6,254,251,238,254,219,160,1,178,178,180,254,
+154,254,78,5,182,244,229,223,246,253,248,2,153,165,159,1,72,0,255,255,0,140,
+0,0,4,68,7,100,18,38,1,82,0,0,16,6,2,212,10,0,0,1,0,140,0,0,4,68,5,182,0,
+18,0,0,55,33,32,17,52,38,35,33,17,51,17,33,50,4,21,20,4,35,33,140,1,178,1,
+102,180,178,254,78,160,1,37,238,1,5,254,251,238,254,59,145,1,72,159,165,2,
+153,253,248,247,222,228,245,0,1,0,100,0,0,4,28,5,182,0,18,0,0,1,33,32,17,
+20,22,51,33,17,35,17,33,34,36,53,52,36,51,33,4,28,254,78,254,154,180,178,
+1,178,160,254,219,238,254,251,1,5,238,1,197,5,37,254,184,159,165,253,103,
+2,8,247,222,228,245,255,255,0,100,0,0,4,28,7,100,18,38,1,85,0,0,16,7,2,212,
+1,84,0,0,0,1,0,100,0,0,4,28,5,182,0,18,0,0,33,33,34,36,53,52,36,51,33,17,
+51,17,33,34,6,21,16,33,33,4,28,254,59,237,254,250,1,5,238,1,37,160,254,78,
+178,180,1,102,1,178,244,229,223,246,2,8,253,103,165,159,254,184,255,255,0,
+50,0,0,5,72,7,100,16,39,1,85,1,44,0,0,16,39,2,212,2,128,0,0,16,7,2,213,255,
+6,0,0,255,255,0,100,0,0,5,162,7,100,16,38,1,85,0,0,16,39,2,212,1,84,0,0,16,
+7,2,213,3,132,0,0,0,1,0,80,2,188,2,84,5,182,0,19,0,0,1,53,35,34,38,53,52,
+54,51,51,21,35,34,6,21,20,22,51,51,17,1,186,52,148,162,164,146,206,189,104,
+69,64,109,189,2,188,254,129,125,122,132,138,58,57,59,58,254,120,0,1,0,80,
+2,133,2,142,5,207,0,14,0,0,1,21,5,5,21,5,35,53,37,37,53,37,37,53,51,2,142,
+254,151,1,105,253,223,29,1,135,254,121,1,135,254,121,31,5,24,105,128,131,
+105,190,118,121,138,103,127,118,117,0,0,1,0,120,255,231,4,122,5,207,0,14,
+0,0,19,1,1,53,51,1,21,1,1,21,1,35,53,1,1,120,3,48,252,208,20,3,238,253,29,
+2,227,252,18,20,3,48,252,208,3,8,1,34,1,8,157,254,174,154,254,248,254,248,
+154,254,174,157,1,8,1,34,0,2,0,120,255,231,5,253,5,207,0,18,0,28,0,0,5,35,
+1,38,38,53,52,54,51,50,22,21,20,6,7,1,1,51,21,1,36,53,52,38,35,34,6,21,20,
+2,236,40,254,66,91,51,197,184,174,202,233,198,1,18,2,138,163,251,110,1,98,
+121,92,108,116,25,2,250,154,161,68,158,209,215,162,169,202,14,254,44,4,181,
+20,253,194,2,248,106,118,118,104,103,255,255,0,120,255,231,5,253,7,242,18,
+38,1,95,0,0,16,7,2,208,0,244,0,0,0,2,0,120,255,231,5,253,5,207,0,18,0,28,
+0,0,33,1,1,22,22,21,20,6,35,34,38,53,52,54,55,1,51,1,21,1,6,21,20,22,51,50,
+54,53,52,5,90,253,118,254,238,203,228,202,174,183,198,51,91,1,190,40,3,17,
+251,110,83,117,107,91,122,4,181,254,43,16,202,166,163,214,209,158,68,163,
+152,2,250,250,69,20,2,82,149,103,106,116,116,108,248,0,255,255,0,120,255,
+231,5,253,7,100,18,38,1,95,0,0,16,7,2,212,1,64,0,0,0,2,0,100,255,231,6,16,
+5,207,0,18,0,30,0,0,1,1,35,53,1,1,6,6,35,34,38,53,52,54,51,50,22,23,1,1,38,
+35,34,6,21,20,22,51,50,54,53,6,16,250,139,20,4,138,254,95,19,205,170,182,
+204,208,169,81,183,119,2,180,252,196,138,109,105,112,120,99,125,120,3,61,
+252,170,163,2,216,1,28,199,211,198,178,174,197,68,80,254,42,1,132,85,120,
+109,103,125,190,173,255,255,0,100,255,231,6,16,7,100,18,38,1,97,0,0,16,6,
+2,212,123,0,0,2,0,80,255,231,5,252,5,207,0,18,0,30,0,0,5,35,1,53,1,54,54,
+51,50,22,21,20,6,35,34,38,39,9,2,20,22,51,50,54,53,52,38,35,34,7,5,217,20,
+250,139,2,180,121,183,79,169,208,204,182,171,205,19,254,96,4,138,253,179,
+120,125,99,120,113,104,114,133,25,3,86,40,1,214,81,67,197,174,179,197,211,
+199,254,228,253,40,4,86,173,190,125,103,111,118,85,255,255,0,80,255,231,5,
+252,7,100,18,38,1,99,0,0,16,7,2,212,2,155,0,0,255,255,0,50,255,231,7,40,7,
+100,16,39,1,99,1,44,0,0,16,39,2,212,3,199,0,0,16,7,2,213,255,6,0,100,255,
+255,0,80,255,231,7,90,7,100,16,38,1,99,0,0,16,39,2,212,2,155,0,0,16,7,2,213,
+5,60,0,100,0,2,0,80,2,133,3,219,5,207,0,17,0,27,0,0,1,35,1,53,1,54,54,51,
+50,22,21,20,6,35,34,39,7,1,1,22,51,50,54,53,52,38,35,34,3,151,39,252,224,
+1,187,53,121,50,100,140,145,96,178,59,202,2,100,254,236,4,100,43,52,50,45,
+48,2,133,1,154,32,1,60,39,45,127,100,96,134,201,143,254,204,2,26,153,55,38,
+44,50,0,2,0,140,255,231,5,148,5,207,0,29,0,41,0,0,1,17,16,2,4,35,34,36,2,
+17,53,16,18,51,50,22,21,20,4,35,35,30,2,51,50,54,18,17,17,1,51,50,54,53,52,
+38,35,34,6,6,21,5,148,132,254,231,225,236,254,230,132,188,193,164,195,255,
+0,251,73,7,103,213,166,171,213,95,252,56,64,191,165,110,77,89,100,44,5,182,
+253,100,254,195,254,171,161,160,1,82,1,65,148,1,28,1,5,193,164,202,208,246,
+240,114,128,1,10,1,34,2,146,253,171,130,143,88,116,78,151,193,0,2,0,140,255,
+231,5,148,5,207,0,29,0,41,0,0,1,17,16,18,22,51,50,54,54,55,35,34,38,53,52,
+54,51,50,18,17,21,16,2,4,35,34,36,2,17,17,1,52,38,38,35,34,6,21,20,22,51,
+51,1,44,97,211,171,166,211,104,7,72,252,255,195,164,193,188,132,254,230,236,
+225,254,231,132,4,104,45,99,89,77,110,166,190,64,5,182,253,110,254,221,254,
+245,126,113,236,251,209,201,164,193,254,250,254,229,148,254,191,254,174,160,
+160,1,84,1,63,2,156,253,226,196,148,78,116,88,143,130,0,2,0,140,255,231,5,
+148,5,207,0,29,0,41,0,0,33,17,16,2,38,35,34,6,6,7,51,50,22,21,20,6,35,34,
+2,17,53,16,18,36,51,50,4,18,17,17,1,20,22,22,51,50,54,53,52,38,35,35,4,244,
+97,211,171,168,212,104,5,73,252,255,195,164,193,188,132,1,26,236,225,1,25,
+132,251,152,45,99,89,77,110,166,190,64,2,146,1,35,1,11,126,115,246,239,209,
+201,164,193,1,6,1,27,148,1,65,1,82,160,160,254,172,254,193,253,100,2,30,196,
+148,78,116,88,143,130,0,2,0,140,255,231,5,148,5,207,0,29,0,41,0,0,51,17,16,
+18,36,51,50,4,18,17,21,16,2,35,34,38,53,52,36,51,51,46,2,35,34,6,2,17,17,
+1,35,34,6,21,20,22,51,50,54,54,53,140,132,1,25,225,236,1,26,132,188,193,164,
+195,1,0,251,73,7,103,213,166,171,213,95,3,200,64,191,165,110,77,89,100,44,
+2,156,1,61,1,85,161,160,254,174,254,191,148,254,228,254,251,193,164,202,208,
+246,240,114,128,254,246,254,222,253,110,2,85,130,143,88,116,78,151,193,0,
+255,255,0,140,255,231,5,148,7,100,18,38,1,106,0,0,16,7,2,212,1,114,0,0,255,
+255,0,140,255,231,5,148,7,100,18,38,1,107,0,0,16,7,2,212,1,100,0,0,0,2,0,
+100,0,0,5,108,5,182,0,26,0,38,0,0,37,32,36,18,53,52,2,39,21,16,6,35,34,38,
+53,52,36,33,32,0,17,16,2,4,33,33,53,1,34,6,6,21,20,22,51,50,54,53,53,1,194,
+1,61,1,65,140,186,155,207,197,180,203,1,3,1,49,1,115,1,97,167,254,147,254,
+106,254,212,2,25,200,148,79,122,96,134,115,145,114,1,3,235,229,1,37,25,71,
+254,228,223,195,164,191,190,254,147,254,168,254,237,254,187,153,145,4,148,
+44,99,87,97,123,160,206,84,0,255,255,0,100,0,0,5,108,7,100,18,38,1,110,0,
+0,16,7,2,212,1,53,0,0,0,2,0,120,0,0,5,128,5,182,0,26,0,38,0,0,37,21,33,32,
+36,2,17,16,0,33,32,4,21,20,6,35,34,38,17,53,6,2,21,20,18,4,33,1,21,20,22,
+51,50,54,53,52,38,38,35,5,78,254,212,254,109,254,144,167,1,98,1,115,1,48,
+1,3,204,179,197,207,156,185,141,1,66,1,59,254,235,114,135,96,122,137,196,
+94,145,145,152,1,68,1,21,1,87,1,110,190,191,165,194,224,1,27,71,25,254,218,
+228,236,254,253,113,4,148,84,206,160,123,97,116,101,13,0,255,255,0,120,0,
+0,5,128,7,100,18,38,1,112,0,0,16,7,2,212,1,101,0,0,255,255,0,50,0,0,6,172,
+7,100,16,39,1,112,1,44,0,0,16,39,2,212,2,145,0,0,16,7,2,213,255,6,0,0,255,
+255,0,120,0,0,6,222,7,100,16,38,1,112,0,0,16,39,2,212,1,101,0,0,16,7,2,213,
+4,192,0,0,0,2,0,80,2,189,3,77,5,197,0,23,0,33,0,0,1,35,32,38,53,52,54,51,
+50,22,21,20,6,35,34,17,6,6,21,20,22,22,51,51,1,20,51,50,54,53,52,38,35,35,
+3,62,214,254,210,234,254,227,130,154,139,104,248,65,55,66,138,178,214,254,
+176,103,46,50,70,76,53,2,189,176,193,191,216,119,100,100,128,1,28,37,121,
+86,89,94,38,1,206,143,50,39,47,35,0,2,0,140,255,231,5,148,5,182,0,21,0,25,
+0,0,1,17,16,2,4,35,34,36,2,17,17,51,17,16,18,22,51,50,54,18,17,17,1,17,51,
+17,5,148,132,254,230,236,225,254,231,132,160,97,211,171,177,218,94,253,196,
+160,5,182,253,100,254,191,254,174,160,160,1,84,1,63,2,156,253,110,254,221,
+254,245,126,131,1,9,1,32,2,146,253,41,2,215,253,41,0,2,0,140,0,0,5,148,5,
+207,0,21,0,25,0,0,33,17,16,2,38,35,34,6,2,17,17,35,17,16,18,36,51,50,4,18,
+17,17,1,17,35,17,4,244,97,219,173,171,213,95,160,132,1,25,225,236,1,26,132,
+253,196,160,2,146,1,38,1,8,126,128,254,246,254,222,253,110,2,156,1,61,1,85,
+161,160,254,174,254,191,253,100,2,215,253,41,2,215,0,2,0,100,0,0,4,232,5,
+182,0,21,0,25,0,0,19,33,32,4,18,17,16,2,4,33,33,53,33,32,36,54,53,52,38,36,
+33,33,17,33,21,33,100,1,43,1,112,1,87,146,154,254,165,254,156,254,213,1,43,
+1,59,1,7,114,112,254,244,254,200,254,213,2,132,253,124,5,182,143,254,196,
+254,240,254,225,254,201,133,145,96,236,254,245,240,101,253,255,145,0,0,2,
+0,140,0,0,5,16,5,182,0,21,0,25,0,0,1,33,32,4,6,21,20,22,4,33,33,21,33,32,
+36,2,17,16,18,36,33,33,17,33,53,33,5,16,254,213,254,200,254,245,113,114,1,
+7,1,59,1,43,254,213,254,155,254,166,154,153,1,91,1,101,1,43,253,124,2,132,
+5,37,100,241,245,253,236,97,145,133,1,55,1,31,1,25,1,56,138,252,221,145,0,
+2,0,80,2,253,6,164,5,182,0,14,0,29,0,0,1,7,39,55,39,55,23,17,51,17,55,23,
+7,23,7,37,7,39,55,39,55,23,17,51,17,55,23,7,23,7,1,204,179,124,172,249,80,
+223,154,223,80,249,172,124,2,169,179,124,172,249,80,223,154,223,80,249,172,
+124,3,229,232,77,229,152,113,135,1,5,254,251,135,113,152,229,77,232,232,77,
+229,152,113,135,1,5,254,251,135,113,152,229,77,0,0,2,0,140,255,231,5,148,
+5,182,0,23,0,43,0,0,1,17,20,2,2,4,35,34,36,2,2,53,17,51,17,16,18,22,51,50,
+54,18,17,17,35,17,20,6,6,35,34,38,38,53,17,51,17,20,22,51,50,54,53,17,5,148,
+22,117,254,231,230,220,254,239,118,27,160,88,210,181,185,216,88,180,65,136,
+104,105,135,63,154,64,85,81,70,5,182,254,98,208,254,166,254,184,191,185,1,
+58,1,75,243,1,158,254,108,254,93,254,159,166,168,1,96,1,162,1,148,254,223,
+178,174,86,88,170,180,1,33,254,213,164,126,120,170,1,43,0,0,2,0,140,0,0,5,
+148,5,207,0,23,0,43,0,0,33,17,16,2,38,35,34,6,2,17,17,35,17,52,18,18,36,51,
+50,4,18,18,21,17,33,17,52,38,35,34,6,21,17,35,17,52,54,54,51,50,22,22,21,
+17,4,244,90,216,183,183,208,88,160,25,118,1,18,221,229,1,24,117,24,254,18,
+69,82,85,64,154,62,135,106,104,135,66,1,148,1,165,1,95,166,166,254,162,254,
+90,254,108,1,158,236,1,77,1,61,187,190,254,192,254,176,227,254,98,1,43,170,
+120,125,165,254,213,1,33,176,174,88,85,174,179,254,223,0,2,0,100,0,0,4,232,
+5,182,0,21,0,41,0,0,19,33,32,4,18,17,16,2,4,33,33,53,33,32,36,54,53,52,38,
+36,33,33,17,51,50,54,54,53,52,38,35,35,53,51,50,22,21,20,6,6,35,35,100,1,
+43,1,112,1,87,146,154,254,165,254,156,254,213,1,43,1,59,1,7,114,112,254,244,
+254,200,254,213,102,102,168,78,120,189,141,138,253,213,90,191,204,119,5,182,
+143,254,196,254,240,254,225,254,201,133,145,96,236,254,245,240,101,252,234,
+16,101,100,99,95,138,158,174,137,151,67,0,0,2,0,140,0,0,5,16,5,182,0,21,0,
+41,0,0,1,33,32,4,6,21,20,22,4,33,33,21,33,32,36,2,17,16,18,36,33,33,17,35,
+34,38,38,53,52,54,51,51,21,35,34,6,21,20,22,22,51,51,5,16,254,213,254,200,
+254,245,113,114,1,7,1,59,1,43,254,213,254,155,254,166,154,153,1,91,1,101,
+1,43,119,201,192,92,212,254,138,141,189,120,78,168,102,102,5,37,100,241,245,
+253,236,97,145,133,1,55,1,31,1,25,1,56,138,251,207,66,152,137,174,158,138,
+95,99,100,101,16,0,2,0,120,0,0,6,68,5,207,0,17,0,30,0,0,33,17,6,6,35,34,0,
+53,52,18,51,50,18,17,17,1,23,1,3,52,38,35,34,6,21,20,22,51,50,54,53,3,144,
+69,151,93,222,254,255,247,229,233,243,1,182,94,253,236,160,174,139,152,167,
+173,165,122,172,2,21,52,44,1,32,241,248,1,17,254,235,254,241,253,13,1,84,
+125,254,113,3,239,143,192,196,172,187,205,183,137,0,2,0,50,0,0,5,254,5,207,
+0,17,0,30,0,0,33,1,55,1,17,16,18,51,50,18,21,20,0,35,34,38,39,17,17,20,22,
+51,50,54,53,52,38,35,34,6,21,2,70,253,236,94,1,182,244,232,229,247,254,253,
+220,92,152,69,170,124,164,174,167,152,140,173,1,143,125,254,172,2,243,1,16,
+1,20,254,239,248,244,254,227,43,53,253,235,3,134,136,184,205,187,173,195,
+193,142,0,255,255,0,50,0,0,5,254,7,100,18,38,1,127,0,0,16,7,2,212,2,130,0,
+0,0,2,0,120,255,231,6,68,5,182,0,17,0,30,0,0,1,1,7,1,17,16,2,35,34,2,53,52,
+0,51,50,22,23,17,17,52,38,35,34,6,21,20,22,51,50,54,53,4,48,2,20,94,254,74,
+244,232,229,247,1,3,220,92,152,69,171,123,164,174,166,153,140,173,5,182,254,
+113,125,1,84,253,13,254,240,254,236,1,17,248,244,1,29,43,53,2,21,252,122,
+136,184,205,187,171,197,193,142,0,255,255,0,120,255,231,6,68,7,100,18,38,
+1,129,0,0,16,7,2,212,2,63,0,0,0,2,0,50,255,231,5,254,5,182,0,17,0,30,0,0,
+1,54,54,51,50,0,21,20,2,35,34,2,17,17,1,39,1,51,17,20,22,51,50,54,53,52,38,
+35,34,6,21,2,230,69,151,93,222,1,1,247,229,233,243,254,74,94,2,20,160,174,
+139,152,167,173,165,124,170,3,161,53,43,254,224,241,248,254,239,1,21,1,15,
+2,243,254,172,125,1,143,252,17,143,192,196,172,187,205,184,136,255,255,0,
+50,255,231,5,254,7,100,18,38,1,131,0,0,16,7,2,212,0,243,0,0,0,2,0,80,2,173,
+3,181,5,182,0,16,0,29,0,0,1,54,51,50,22,21,20,6,35,34,38,53,17,7,39,37,51,
+17,20,22,51,50,54,53,52,38,35,34,6,21,2,0,62,84,133,158,155,135,146,155,200,
+78,1,46,130,83,63,64,78,77,75,56,80,4,186,35,148,127,130,155,169,156,1,25,
+152,101,222,254,9,59,77,78,66,67,73,76,56,0,0,1,0,140,0,0,4,182,5,182,0,11,
+0,0,19,51,17,33,17,51,17,35,17,33,17,35,140,160,2,234,160,160,253,22,160,
+5,182,253,186,2,70,250,74,2,223,253,33,0,0,1,0,80,3,32,2,223,5,183,0,11,0,
+0,19,19,3,51,23,55,51,3,19,35,39,7,80,242,242,172,155,156,172,242,242,170,
+158,157,3,32,1,76,1,75,214,214,254,181,254,180,215,215,255,255,0,80,0,0,6,
+216,7,242,16,38,1,90,0,0,16,39,0,119,2,148,0,0,16,7,2,208,3,22,0,0,255,255,
+0,80,0,0,6,216,5,207,16,38,1,90,0,0,16,7,0,119,2,148,0,0,255,255,0,80,0,0,
+6,216,7,100,16,38,1,90,0,0,16,39,0,119,2,148,0,0,16,7,2,212,3,94,0,0,255,
+255,0,100,255,231,6,196,5,182,16,38,1,90,20,0,16,7,0,121,2,148,0,0,255,255,
+0,100,255,231,6,226,7,100,16,38,1,90,20,0,16,39,0,121,2,148,0,0,16,7,2,212,
+4,196,0,0,255,255,0,100,255,231,6,216,5,182,16,38,1,90,20,0,16,7,0,124,2,
+148,0,0,255,255,0,100,255,231,6,216,7,100,16,38,1,90,20,0,16,39,0,124,2,148,
+0,0,16,7,2,212,1,199,0,0,255,255,0,80,2,173,5,91,5,182,16,38,1,90,0,0,16,
+7,0,141,2,138,0,0,0,2,0,120,0,0,4,48,5,207,0,17,0,29,0,0,51,1,38,38,53,52,
+54,51,50,18,17,17,35,17,6,6,7,3,18,6,21,20,22,51,50,54,53,52,38,35,200,1,
+2,160,178,249,227,233,243,160,80,139,85,253,94,169,165,173,142,152,164,149,
+2,40,37,239,188,224,247,254,235,254,241,252,85,2,121,58,35,3,253,231,5,62,
+168,150,162,180,168,152,160,180,0,2,0,140,0,0,4,68,5,207,0,17,0,29,0,0,33,
+3,34,38,39,17,35,17,16,18,51,50,22,21,20,6,7,1,2,54,53,52,38,35,34,6,21,20,
+22,51,3,89,253,80,140,84,160,244,232,227,249,178,160,1,2,245,165,169,150,
+149,164,153,141,2,25,37,59,253,135,3,171,1,16,1,20,246,225,188,239,37,253,
+216,2,170,180,162,149,169,180,160,151,169,0,2,0,120,255,231,4,48,5,182,0,
+17,0,29,0,0,1,19,50,22,23,17,51,17,16,2,35,34,38,53,52,54,55,1,18,6,21,20,
+22,51,50,54,53,52,38,35,1,99,253,80,140,84,160,244,232,227,249,179,159,254,
+254,245,165,169,150,149,164,152,142,5,182,253,231,37,59,2,121,252,85,254,
+240,254,236,246,225,186,242,36,2,40,253,86,180,162,149,169,180,160,152,168,
+0,2,0,140,255,231,4,68,5,182,0,17,0,29,0,0,1,1,22,22,21,20,6,35,34,2,17,17,
+51,17,54,54,55,19,2,54,53,52,38,35,34,6,21,20,22,51,3,244,254,254,159,179,
+249,227,233,243,160,80,139,85,253,94,169,165,173,141,153,164,149,5,182,253,
+216,36,242,186,224,247,1,21,1,15,3,171,253,135,58,35,3,2,25,250,194,168,150,
+162,180,169,151,160,180,0,0,1,0,120,0,0,6,148,5,207,0,23,0,0,19,16,18,54,
+51,50,30,2,21,17,1,23,1,35,17,52,38,38,35,34,6,6,7,120,102,228,192,148,193,
+114,59,1,178,94,253,240,160,72,155,127,144,147,64,7,3,74,1,1,1,6,126,88,148,
+235,242,253,181,1,81,125,254,113,3,61,213,200,100,85,185,230,0,1,0,50,0,0,
+6,78,5,207,0,23,0,0,1,46,2,35,34,6,6,21,17,35,1,55,1,17,52,62,2,51,50,22,
+18,17,5,174,7,65,147,143,126,153,75,160,253,240,94,1,178,58,112,196,148,194,
+227,101,3,74,231,185,84,97,198,218,252,195,1,143,125,254,175,2,75,242,232,
+149,90,127,254,250,255,0,0,1,0,120,255,231,6,148,5,182,0,23,0,0,1,30,2,51,
+50,54,54,53,17,51,1,7,1,17,20,14,2,35,34,38,2,17,1,24,7,65,147,143,126,153,
+75,160,2,16,94,254,78,58,112,196,148,194,227,101,2,108,231,185,84,97,198,
+218,3,61,254,113,125,1,81,253,181,242,232,149,90,127,1,6,1,0,0,1,0,50,255,
+231,6,78,5,182,0,23,0,0,1,16,2,6,35,34,46,2,53,17,1,39,1,51,17,20,22,22,51,
+50,54,54,55,6,78,102,228,192,148,193,114,59,254,78,94,2,16,160,72,155,127,
+144,147,64,7,2,108,254,255,254,250,126,88,148,235,242,2,75,254,175,125,1,
+143,252,195,213,200,100,85,185,230,0,255,255,0,100,0,0,8,248,7,242,16,38,
+1,159,0,0,16,39,0,149,4,96,0,0,16,7,2,208,5,10,0,0,255,255,0,100,0,0,8,248,
+5,207,16,38,1,159,0,0,16,7,0,149,4,96,0,0,255,255,0,100,0,0,8,248,7,100,16,
+38,1,159,0,0,16,39,0,149,4,96,0,0,16,7,2,212,5,91,0,0,0,3,0,100,255,231,6,
+200,5,207,0,18,0,47,0,58,0,0,1,22,22,51,50,54,54,53,17,51,17,20,14,2,35,34,
+38,3,1,20,6,35,34,38,53,53,35,34,38,53,52,54,51,50,22,21,20,7,51,21,20,22,
+51,50,53,53,51,36,54,53,52,35,34,6,21,20,22,51,3,100,14,155,185,126,153,75,
+160,58,112,196,148,253,250,13,1,142,124,127,118,116,246,131,142,140,102,104,
+135,34,216,46,49,102,144,253,48,52,94,42,56,56,42,1,204,195,145,97,198,218,
+3,61,252,250,242,232,149,90,228,1,1,1,193,142,127,137,157,91,124,119,91,128,
+125,94,68,45,184,105,96,139,31,217,57,42,101,55,44,42,59,0,255,255,0,100,
+255,231,6,235,7,100,18,38,1,155,0,0,16,7,2,212,4,205,0,0,255,255,0,100,255,
+231,8,248,5,207,16,38,1,159,0,0,16,7,0,154,4,96,0,0,255,255,0,100,255,231,
+8,248,7,100,16,38,1,159,0,0,16,39,0,154,4,96,0,0,16,7,2,212,3,152,0,0,0,2,
+0,100,2,148,4,80,5,207,0,28,0,39,0,0,1,20,6,35,34,38,53,53,35,34,38,53,52,
+54,51,50,22,21,20,7,51,21,20,22,51,50,53,53,51,36,54,53,52,35,34,6,21,20,
+22,51,4,80,124,127,118,116,246,131,142,140,102,104,135,34,216,46,49,102,144,
+253,48,52,94,42,56,56,42,3,161,142,127,137,157,71,124,119,91,128,125,94,68,
+45,164,105,96,139,31,197,57,42,101,55,44,42,59,0,0,3,0,100,2,148,6,130,5,
+207,0,39,0,50,0,61,0,0,1,20,6,35,34,38,53,53,33,34,38,53,52,54,51,50,22,21,
+20,7,51,38,53,52,54,51,50,22,21,20,7,51,21,20,22,51,50,53,53,51,36,54,53,
+52,35,34,6,21,20,22,51,32,54,53,52,35,34,6,21,20,22,51,6,130,124,127,118,
+116,252,216,131,142,140,102,104,135,34,137,22,140,102,104,135,34,216,46,49,
+102,144,253,48,52,94,42,56,56,42,253,248,52,94,42,56,56,42,3,161,142,127,
+137,157,71,124,119,91,128,125,94,68,45,47,66,91,128,125,94,68,45,164,105,
+96,139,31,197,57,42,101,55,44,42,59,57,42,101,55,44,42,59,0,1,0,120,0,0,4,
+48,5,207,0,26,0,0,33,17,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,
+53,52,18,51,32,17,17,3,144,181,159,144,148,97,85,75,91,16,159,12,182,142,
+158,189,246,209,1,241,3,173,184,217,172,167,131,153,109,129,22,168,193,227,
+207,213,1,10,253,220,252,85,0,1,0,140,0,0,4,68,5,207,0,26,0,0,51,17,16,33,
+50,18,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,21,17,140,1,
+241,210,245,189,158,143,181,12,159,16,91,75,85,97,148,144,159,181,3,171,2,
+36,254,247,214,207,227,194,167,22,128,110,152,132,168,171,217,184,252,83,
+0,0,1,0,120,255,231,4,48,5,182,0,26,0,0,1,16,33,34,2,53,52,54,51,50,22,23,
+7,38,38,35,34,6,21,20,22,51,50,54,53,17,51,4,48,254,15,210,245,189,158,143,
+181,12,159,16,91,75,85,97,148,144,159,181,160,2,11,253,220,1,9,214,205,229,
+194,167,22,128,110,152,132,168,171,217,184,3,173,0,0,1,0,140,255,231,4,68,
+5,182,0,26,0,0,36,2,35,32,17,17,51,17,20,22,51,50,54,53,52,38,35,34,6,7,39,
+54,54,51,50,22,21,4,68,246,209,254,15,160,181,159,144,148,97,85,75,91,16,
+159,12,182,142,158,189,241,254,246,2,36,3,171,252,83,184,217,172,167,131,
+153,109,129,22,168,193,229,205,0,0,3,0,100,255,231,6,196,5,110,0,15,0,27,
+0,31,0,0,1,50,0,21,20,0,35,34,0,53,52,54,55,55,33,53,4,6,21,20,22,51,50,54,
+53,52,38,35,1,33,53,33,4,173,244,1,35,254,232,236,226,254,219,56,47,39,253,
+29,3,180,191,212,155,156,192,205,152,1,175,249,246,6,10,4,1,254,234,243,242,
+254,225,1,28,218,122,183,51,47,145,145,217,182,162,199,211,176,171,202,1,
+109,145,0,0,3,0,120,255,231,6,216,5,110,0,15,0,27,0,31,0,0,1,21,33,23,22,
+22,21,20,0,35,34,0,53,52,0,51,18,54,53,52,38,35,34,6,21,20,22,51,1,33,21,
+33,6,216,253,29,40,46,56,254,219,226,237,254,233,1,35,244,128,212,191,167,
+152,205,190,158,254,90,6,10,249,246,4,1,145,47,51,183,122,218,254,228,1,31,
+242,243,1,22,252,119,199,162,182,217,202,171,173,214,4,246,145,0,0,3,0,100,
+0,0,6,196,5,110,0,15,0,27,0,31,0,0,51,53,33,39,38,38,53,52,0,51,50,0,21,20,
+0,35,2,6,21,20,22,51,50,54,53,52,38,35,1,33,53,33,100,2,227,39,47,56,1,37,
+226,237,1,23,254,221,244,128,212,191,167,152,205,190,158,1,166,249,246,6,
+10,145,47,51,183,122,218,1,28,254,225,242,243,254,234,3,137,199,162,182,217,
+202,171,173,214,1,84,145,0,3,0,120,0,0,6,216,5,110,0,15,0,27,0,31,0,0,33,
+34,0,53,52,0,51,50,0,21,20,6,7,7,33,21,36,54,53,52,38,35,34,6,21,20,22,51,
+1,33,21,33,2,143,244,254,221,1,24,236,226,1,37,56,46,40,2,227,252,76,191,
+212,155,156,192,205,152,254,81,6,10,249,246,1,22,243,242,1,31,254,228,218,
+122,183,51,47,145,145,217,182,162,199,211,176,171,202,4,221,145,0,0,3,0,80,
+3,32,4,112,6,190,0,13,0,25,0,29,0,0,1,33,21,33,34,38,53,52,54,51,50,22,21,
+20,0,6,21,20,22,51,50,54,53,52,38,35,3,33,21,33,2,158,1,210,253,29,131,186,
+189,138,138,188,254,113,100,101,72,73,99,98,74,221,3,182,252,74,3,170,138,
+205,138,137,192,192,137,117,1,52,109,79,80,111,112,79,78,110,1,136,138,0,
+0,1,0,120,0,0,6,176,6,36,0,19,0,0,1,1,21,33,34,6,21,20,22,51,51,21,35,34,
+0,53,16,33,33,1,5,27,1,149,252,17,215,210,190,158,212,204,232,254,228,2,51,
+3,65,254,178,6,36,253,221,145,177,191,164,203,145,1,23,230,2,4,1,207,255,
+255,0,120,0,0,6,176,7,100,18,38,1,170,0,0,16,7,2,212,2,249,0,0,0,1,0,100,
+253,221,6,156,4,1,0,19,0,0,1,1,53,33,50,54,53,52,38,35,35,53,51,50,0,21,16,
+33,33,1,1,249,254,107,3,239,215,210,190,158,212,204,232,1,28,253,205,252,
+191,1,78,253,221,2,35,145,177,191,164,203,145,254,233,230,253,252,254,49,
+255,255,0,100,253,221,6,156,5,207,18,38,1,172,0,0,16,7,2,212,2,208,254,107,
+0,1,0,120,253,221,6,176,4,1,0,19,0,0,1,1,33,32,17,52,0,51,51,21,35,34,6,21,
+20,22,51,33,21,1,4,158,1,78,252,191,253,205,1,27,233,204,212,157,191,210,
+215,3,239,254,107,254,49,1,207,2,4,230,1,23,145,204,163,191,177,145,253,221,
+255,255,0,120,253,221,6,176,5,207,18,38,1,174,0,0,16,7,2,212,0,250,254,107,
+0,1,0,80,1,237,4,58,5,182,0,20,0,0,1,3,39,55,33,34,38,53,52,54,51,51,21,35,
+34,6,21,20,22,51,33,4,58,212,128,169,254,32,164,187,187,151,54,45,87,106,
+105,93,2,138,3,32,254,205,86,221,180,161,145,176,138,103,80,94,109,0,0,1,
+0,80,0,0,4,127,5,207,0,16,0,0,1,33,53,33,53,1,23,1,33,17,51,21,35,21,35,53,
+33,1,82,2,21,252,233,2,211,115,253,188,2,181,120,120,160,253,235,1,96,190,
+55,3,122,90,253,58,254,177,145,207,207,0,0,1,0,100,0,0,4,147,5,207,0,16,0,
+0,37,33,21,35,53,35,53,51,17,33,1,55,1,21,33,21,33,3,145,253,235,160,120,
+120,2,181,253,188,115,2,211,252,233,2,21,207,207,207,145,1,79,2,198,90,252,
+134,55,190,255,255,0,100,0,0,4,147,7,100,18,38,1,178,0,0,16,6,2,212,147,0,
+0,1,0,80,255,231,4,127,5,182,0,16,0,0,1,33,53,51,21,51,21,35,17,33,1,7,1,
+53,33,53,33,1,82,2,21,160,120,120,253,75,2,68,115,253,45,3,23,253,235,4,231,
+207,207,145,254,177,253,58,90,3,122,55,190,0,255,255,0,80,255,231,4,127,7,
+100,18,38,1,180,0,0,16,7,2,212,2,14,0,0,0,1,0,100,255,231,4,147,5,182,0,16,
+0,0,1,33,21,33,21,1,39,1,33,17,35,53,51,53,51,21,33,3,145,253,235,3,23,253,
+45,115,2,68,253,75,120,120,160,2,21,4,86,190,55,252,134,90,2,198,1,79,145,
+207,207,0,255,255,0,100,255,231,4,147,7,100,18,38,1,182,0,0,16,6,2,212,129,
+0,0,1,0,80,2,155,2,166,5,182,0,16,0,0,19,35,53,51,53,51,21,51,21,35,21,33,
+21,1,39,19,33,153,73,73,154,255,255,1,115,254,127,118,245,254,245,5,5,116,
+61,61,116,94,60,254,48,90,1,40,0,2,0,140,255,231,4,68,5,182,0,15,0,28,0,0,
+51,17,51,17,54,54,51,50,0,21,20,0,35,34,39,21,17,20,22,51,50,54,53,52,38,
+35,34,6,21,140,160,55,164,94,215,1,8,255,0,220,192,124,180,133,147,172,176,
+152,123,181,5,182,253,202,61,68,254,217,234,217,254,208,137,112,1,199,130,
+205,202,166,179,213,203,137,0,1,0,140,0,0,3,177,5,207,0,14,0,0,51,17,51,21,
+54,51,50,22,21,20,6,35,34,39,17,140,160,103,164,176,202,201,177,169,98,5,
+182,65,90,203,175,160,193,88,252,180,0,1,0,120,255,231,3,157,5,182,0,14,0,
+0,1,17,35,53,6,35,34,38,53,52,54,51,50,23,17,3,157,160,103,164,176,202,201,
+177,169,98,5,182,250,74,65,90,203,175,160,193,88,3,76,0,0,1,0,140,255,231,
+3,177,5,182,0,14,0,0,1,17,54,51,50,22,21,20,6,35,34,39,21,35,17,1,44,98,169,
+176,202,203,175,164,103,160,5,182,252,180,88,193,160,176,202,90,65,5,182,
+0,0,1,0,120,0,0,3,157,5,207,0,14,0,0,33,17,6,35,34,38,53,52,54,51,50,23,53,
+51,17,2,253,98,169,176,202,203,175,164,103,160,3,76,88,193,160,176,202,90,
+65,250,74,0,0,1,0,140,0,0,4,22,5,182,0,9,0,0,19,33,21,33,17,33,21,33,17,35,
+140,3,138,253,22,2,234,253,22,160,5,182,145,254,75,145,253,33,0,1,0,100,0,
+0,3,238,5,182,0,9,0,0,33,33,53,33,17,33,53,33,17,51,3,238,252,118,2,234,253,
+22,2,234,160,145,1,181,145,2,223,0,0,1,0,140,0,0,4,22,5,182,0,9,0,0,19,51,
+17,33,21,33,17,33,21,33,140,160,2,234,253,22,2,234,252,118,5,182,253,33,145,
+254,75,145,0,1,0,100,0,0,3,238,5,182,0,9,0,0,33,35,17,33,53,33,17,33,53,33,
+3,238,160,253,22,2,234,253,22,3,138,2,223,145,1,181,145,0,0,1,0,140,0,0,5,
+21,5,182,0,20,0,0,19,33,21,20,22,51,50,54,53,53,51,21,20,2,35,34,38,39,35,
+17,35,140,1,140,146,141,153,165,160,246,229,205,233,11,77,160,5,182,97,172,
+189,189,168,101,94,243,254,246,242,216,250,219,0,1,0,100,0,0,4,237,5,182,
+0,20,0,0,33,33,53,52,38,35,34,6,21,21,35,53,52,18,51,50,22,23,51,17,51,4,
+237,254,116,146,141,153,165,160,246,229,205,233,11,77,160,97,172,189,189,
+168,101,94,243,1,10,242,216,5,37,0,0,1,0,140,0,0,5,21,5,182,0,20,0,0,19,51,
+17,51,54,54,51,50,18,21,21,35,53,52,38,35,34,6,21,21,33,140,160,77,11,233,
+205,228,247,160,165,153,141,146,254,116,5,182,250,219,216,242,254,246,243,
+94,101,169,188,189,172,97,0,1,0,100,0,0,4,237,5,182,0,20,0,0,33,35,17,35,
+6,6,35,34,2,53,53,51,21,20,22,51,50,54,53,53,33,4,237,160,77,11,233,205,228,
+247,160,165,153,141,146,1,140,5,37,216,242,1,10,243,94,101,168,189,189,172,
+97,0,0,1,0,140,0,0,5,23,5,182,0,9,0,0,19,51,1,1,51,1,35,1,17,35,140,250,1,
+112,1,113,176,253,241,35,254,71,160,5,182,253,129,2,127,252,133,2,233,250,
+220,0,0,1,0,80,0,0,4,219,5,182,0,9,0,0,33,35,1,1,35,1,51,1,17,51,4,219,250,
+254,144,254,143,176,2,15,35,1,185,160,2,127,253,129,3,123,253,23,5,36,0,1,
+0,140,0,0,5,23,5,182,0,9,0,0,19,51,17,1,51,1,35,1,1,35,140,160,1,185,35,2,
+15,176,254,143,254,144,250,5,182,250,220,2,233,252,133,2,127,253,129,0,0,
+1,0,80,0,0,4,219,5,182,0,9,0,0,33,35,17,1,35,1,51,1,1,51,4,219,160,254,71,
+35,253,241,176,1,113,1,112,250,5,36,253,23,3,123,253,129,2,127,0,1,0,80,0,
+0,4,234,5,182,0,21,0,0,33,35,3,46,2,35,34,6,21,21,35,53,52,54,51,50,22,23,
+19,17,51,4,234,237,216,35,77,125,89,106,133,160,216,187,152,220,90,153,160,
+2,7,84,166,111,166,141,41,34,209,250,194,233,254,118,4,234,0,1,0,140,0,0,
+5,38,5,182,0,19,0,0,19,51,17,19,54,54,51,50,22,21,21,35,53,52,38,35,34,2,
+3,35,140,160,153,89,219,154,187,216,160,133,106,171,195,176,237,5,182,251,
+22,1,138,232,195,250,209,34,41,140,167,254,57,254,87,0,0,1,0,80,0,0,4,234,
+5,182,0,21,0,0,33,35,17,3,6,6,35,34,38,53,53,51,21,20,22,51,50,54,54,55,19,
+51,4,234,160,153,89,221,152,187,216,160,132,107,68,101,83,74,216,237,4,234,
+254,118,232,195,250,209,34,41,142,165,63,119,179,2,7,0,0,1,0,140,0,0,5,38,
+5,182,0,21,0,0,19,51,19,30,2,51,50,54,53,53,51,21,20,6,35,34,38,39,3,17,35,
+140,237,216,74,84,99,69,106,133,160,216,187,153,219,90,153,160,5,182,253,
+249,180,119,62,167,140,41,34,209,250,194,233,1,138,251,22,0,0,2,0,100,255,
+241,6,34,5,182,0,9,0,12,0,0,1,19,33,19,51,21,1,35,1,53,1,33,1,1,13,225,2,
+167,225,172,253,53,40,253,53,3,236,253,228,1,15,5,182,254,40,1,216,20,250,
+79,5,177,20,253,151,253,202,0,0,2,0,100,0,0,6,34,5,197,0,9,0,12,0,0,51,53,
+1,51,1,21,35,3,33,3,1,1,33,100,2,203,40,2,203,172,225,253,89,225,2,54,254,
+241,2,28,20,5,177,250,79,20,1,216,254,40,4,159,253,202,0,2,0,100,255,235,
+5,97,5,204,0,9,0,12,0,0,55,37,17,37,53,51,1,21,1,35,1,17,1,100,1,127,254,
+129,20,4,233,251,23,20,2,31,1,221,151,218,2,213,218,172,253,30,30,253,31,
+4,0,253,225,1,15,0,255,255,0,100,255,235,5,97,5,204,18,38,1,208,0,0,16,7,
+2,211,0,40,254,7,255,255,0,90,255,235,5,97,5,204,18,38,1,208,0,0,16,7,2,213,
+255,46,0,0,0,2,0,80,255,235,5,77,5,204,0,9,0,12,0,0,5,35,1,53,1,51,21,5,17,
+5,1,1,17,5,77,20,251,23,4,233,20,254,129,1,127,252,4,1,221,21,2,225,30,2,
+226,172,218,253,43,218,2,68,254,241,2,31,0,2,0,100,255,241,6,34,5,182,0,9,
+0,12,0,0,1,23,33,55,51,21,1,35,1,53,1,33,1,1,13,70,3,221,70,172,253,53,40,
+253,53,4,135,252,173,1,171,5,182,147,147,20,250,79,5,177,20,254,220,252,133,
+0,0,2,0,100,0,0,6,34,5,197,0,9,0,12,0,0,51,53,1,51,1,21,35,39,33,7,1,1,33,
+100,2,203,40,2,203,172,70,252,35,70,2,54,254,85,3,83,20,5,177,250,79,20,147,
+147,4,159,252,133,0,2,0,100,255,235,5,97,5,204,0,9,0,12,0,0,55,55,17,39,53,
+51,1,21,1,35,1,17,1,100,120,120,20,4,233,251,23,20,1,24,2,228,151,68,4,0,
+69,172,253,30,30,253,31,4,149,252,182,1,165,0,255,255,0,100,255,235,5,97,
+5,204,18,38,1,214,0,0,16,7,2,211,1,121,254,7,255,255,0,100,255,235,5,97,5,
+204,18,38,1,214,0,0,16,7,2,213,0,205,0,0,0,2,0,80,255,235,5,77,5,204,0,9,
+0,12,0,0,5,35,1,53,1,51,21,7,17,23,1,1,17,5,77,20,251,23,4,233,20,120,120,
+252,4,2,228,21,2,225,30,2,226,172,69,252,0,68,2,68,254,91,3,74,0,1,0,100,
+255,241,5,210,5,182,0,13,0,0,1,51,21,1,35,1,53,51,1,23,17,51,17,55,5,43,167,
+253,93,40,253,93,161,1,160,40,160,36,5,182,20,250,79,5,177,20,252,87,106,
+4,19,251,249,96,0,1,0,100,0,0,5,210,5,197,0,13,0,0,1,17,35,17,7,1,35,53,1,
+51,1,21,35,1,3,109,160,40,254,96,161,2,163,40,2,163,167,254,102,4,7,251,249,
+4,19,106,252,87,20,5,177,250,79,20,3,167,0,1,0,100,255,235,5,97,5,204,0,11,
+0,0,19,33,1,53,51,1,21,1,35,53,1,33,100,3,144,252,112,20,4,233,251,23,20,
+3,146,252,110,3,36,1,252,172,253,30,30,253,31,171,1,253,255,255,0,100,255,
+235,5,97,5,204,18,38,1,220,0,0,16,7,2,211,0,127,253,249,255,255,0,100,255,
+235,5,97,5,204,16,38,2,214,178,0,16,6,1,220,0,0,0,1,0,80,255,235,5,77,5,204,
+0,11,0,0,1,33,1,21,35,1,53,1,51,21,1,33,5,77,252,110,3,146,20,251,23,4,233,
+20,252,112,3,144,2,147,254,3,171,2,225,30,2,226,172,254,4,0,0,3,0,100,255,
+241,5,210,5,182,0,13,0,17,0,21,0,0,1,17,33,19,51,21,1,35,1,53,51,19,33,25,
+2,35,19,1,35,17,55,3,109,1,25,165,167,253,93,40,253,93,161,166,1,34,224,184,
+1,160,216,36,5,182,254,145,1,111,20,250,79,5,177,20,254,145,1,111,251,237,
+2,19,254,87,1,169,253,249,96,0,0,3,0,100,0,0,5,210,5,197,0,13,0,17,0,21,0,
+0,33,17,33,3,35,53,1,51,1,21,35,3,33,17,1,51,17,7,55,17,51,3,2,205,254,222,
+166,161,2,163,40,2,163,167,165,254,231,254,128,224,40,200,216,180,1,111,254,
+145,20,5,177,250,79,20,1,111,254,145,2,0,2,19,106,94,253,249,1,167,0,3,0,
+100,255,235,5,97,5,204,0,13,0,16,0,19,0,0,19,33,17,37,53,51,1,21,1,35,53,
+37,17,33,33,21,37,1,21,33,100,1,170,254,86,20,4,233,251,23,20,1,170,254,86,
+2,68,1,78,254,178,1,76,3,36,1,14,238,172,253,30,30,253,31,171,237,1,16,186,
+186,1,74,185,0,255,255,0,100,255,235,5,97,5,204,18,38,1,226,0,0,16,7,2,211,
+0,127,253,249,255,255,0,100,255,235,5,97,5,204,18,38,1,226,0,0,16,6,2,214,
+153,0,0,3,0,80,255,235,5,77,5,204,0,13,0,16,0,19,0,0,1,33,17,5,21,35,1,53,
+1,51,21,5,17,33,5,5,53,37,33,53,5,77,254,86,1,170,20,251,23,4,233,20,254,
+86,1,170,252,110,1,78,254,180,1,76,2,147,254,240,237,171,2,225,30,2,226,172,
+238,254,242,145,186,186,145,185,0,2,0,140,255,231,5,148,5,182,0,10,0,19,0,
+0,1,16,2,6,6,35,32,0,17,17,33,5,17,16,18,51,32,18,17,17,5,148,82,145,243,
+178,254,194,254,190,5,8,251,152,225,255,1,2,230,3,136,254,213,254,197,199,
+116,1,161,1,212,2,90,145,254,75,254,105,254,159,1,93,1,155,1,181,0,2,0,140,
+0,0,5,148,5,207,0,10,0,19,0,0,33,33,17,16,0,33,50,22,22,18,17,3,17,16,2,33,
+34,2,17,17,5,148,250,248,1,64,1,64,178,243,145,82,160,230,254,254,255,225,
+2,90,1,211,1,162,117,195,254,193,254,214,254,99,1,181,1,155,1,93,254,160,
+254,104,254,75,0,2,0,140,0,0,5,115,5,182,0,10,0,21,0,0,51,17,33,32,4,18,17,
+16,2,4,33,37,33,32,54,54,17,52,38,36,33,33,140,1,162,1,106,1,77,142,145,254,
+175,254,157,254,254,1,2,1,53,253,110,109,254,254,254,207,254,254,5,182,139,
+254,199,254,233,254,222,254,204,133,145,92,230,1,8,255,235,96,255,255,0,140,
+0,0,5,115,5,182,18,38,1,232,0,0,16,7,2,211,2,34,253,249,255,255,0,140,0,0,
+5,115,5,182,18,38,1,232,0,0,16,7,2,213,1,47,0,0,0,2,0,120,0,0,5,95,5,182,
+0,10,0,21,0,0,33,32,36,2,17,16,18,36,33,33,17,3,33,32,4,6,21,16,22,22,33,
+33,3,189,254,157,254,175,145,142,1,76,1,107,1,162,160,254,254,254,205,255,
+0,109,111,253,1,52,1,2,133,1,54,1,32,1,21,1,58,140,250,74,5,37,97,237,252,
+254,249,230,93,0,0,2,0,140,255,231,5,148,5,207,0,13,0,26,0,0,1,16,2,4,35,
+34,36,2,17,17,51,1,1,51,1,35,1,17,16,18,22,51,50,54,18,17,17,5,148,132,254,
+230,236,225,254,231,132,20,2,112,2,112,20,253,134,20,254,38,97,211,171,177,
+218,94,3,26,254,191,254,174,160,160,1,84,1,63,2,181,254,147,1,109,253,231,
+1,20,254,90,254,221,254,245,126,131,1,9,1,32,1,166,0,2,0,140,255,231,5,148,
+5,207,0,13,0,24,0,0,5,1,1,35,17,16,0,33,50,22,22,18,17,17,3,16,2,33,34,2,
+17,17,1,51,1,5,128,253,144,253,144,20,1,64,1,64,178,243,145,82,160,230,254,
+254,255,225,1,218,20,1,218,25,1,109,254,147,2,115,1,211,1,162,117,195,254,
+193,254,214,253,185,2,95,1,155,1,93,254,160,254,104,254,166,1,20,254,236,
+0,2,0,100,0,0,5,75,5,182,0,13,0,26,0,0,1,32,4,18,17,16,2,4,33,33,53,1,1,53,
+1,21,1,51,32,54,54,17,52,38,36,33,35,2,6,1,106,1,77,142,145,254,175,254,157,
+254,94,1,71,254,185,1,235,254,250,189,1,53,253,110,109,254,254,254,207,189,
+5,182,139,254,199,254,233,254,222,254,204,133,20,2,199,2,199,20,253,48,22,
+253,193,92,230,1,8,255,235,96,255,255,0,100,0,0,5,75,5,182,18,38,1,238,0,
+0,16,7,2,211,2,164,253,249,255,255,0,100,0,0,5,75,5,182,18,38,1,238,0,0,16,
+7,2,213,1,192,0,0,0,2,0,120,0,0,5,95,5,182,0,13,0,26,0,0,1,33,21,1,1,21,33,
+32,36,2,17,16,18,36,1,51,1,53,1,35,32,4,6,21,16,22,22,3,189,1,162,254,185,
+1,71,254,94,254,157,254,175,145,142,1,76,1,107,189,254,250,1,6,189,254,205,
+255,0,109,111,253,5,182,20,253,57,253,57,20,133,1,54,1,32,1,21,1,58,140,250,
+219,2,63,22,2,63,97,237,252,254,249,230,93,0,2,0,140,255,231,5,148,5,182,
+0,14,0,22,0,0,1,17,16,2,4,35,34,36,2,17,17,51,17,33,17,3,33,18,18,51,50,54,
+54,5,148,132,254,230,236,225,254,231,132,160,3,200,1,252,57,4,232,243,164,
+214,104,5,182,253,100,254,191,254,174,160,160,1,84,1,63,2,156,253,176,2,80,
+253,31,254,170,254,249,114,240,0,0,2,0,140,0,0,5,148,5,207,0,14,0,22,0,0,
+1,17,35,17,16,18,36,51,50,4,18,17,17,35,17,39,46,2,35,34,2,3,1,44,160,132,
+1,25,225,236,1,26,132,160,1,6,104,214,164,245,231,3,2,80,253,176,2,156,1,
+61,1,85,161,160,254,174,254,191,253,100,2,80,145,253,239,113,254,246,254,
+173,0,2,0,100,0,0,4,201,5,182,0,14,0,23,0,0,19,51,32,4,18,17,16,2,4,33,35,
+53,51,17,35,1,62,2,53,52,38,38,39,100,228,1,107,1,112,166,166,254,148,254,
+145,228,210,208,1,112,243,239,108,108,240,242,5,182,141,254,196,254,238,254,
+234,254,197,138,145,4,148,251,110,9,115,244,216,212,243,117,11,0,255,255,
+0,100,0,0,4,201,5,182,18,38,1,244,0,0,16,7,2,211,2,60,253,249,255,255,0,100,
+0,0,4,201,5,182,18,38,1,244,0,0,16,7,2,213,1,71,0,0,0,2,0,120,0,0,4,221,5,
+182,0,14,0,23,0,0,1,35,17,51,21,35,32,36,2,17,16,18,36,33,51,5,14,2,21,20,
+22,22,23,4,219,208,210,228,254,148,254,146,167,159,1,109,1,117,228,254,142,
+243,238,109,107,238,245,5,37,251,108,145,137,1,59,1,23,1,12,1,62,145,148,
+11,116,243,213,216,243,115,10,0,0,1,0,80,2,188,3,26,5,182,0,7,0,0,1,17,33,
+21,33,53,33,17,2,2,1,24,253,54,1,24,5,182,253,144,138,138,2,112,0,1,0,140,
+255,231,6,158,5,182,0,34,0,0,1,17,16,2,6,35,34,39,6,6,35,34,38,2,17,17,51,
+17,16,18,51,50,18,17,17,51,17,16,18,51,50,54,54,17,17,6,158,90,191,147,251,
+98,52,172,124,152,191,86,160,126,143,136,132,160,128,141,93,119,56,5,182,
+253,76,254,183,254,197,151,213,109,104,157,1,61,1,65,2,180,253,76,254,149,
+254,225,1,2,1,106,2,210,253,46,254,170,254,234,121,248,1,25,2,180,0,1,0,140,
+0,0,6,158,5,207,0,34,0,0,33,17,16,38,38,35,34,2,17,17,35,17,16,2,35,34,2,
+17,17,35,17,16,18,54,51,50,22,23,54,51,50,22,18,17,17,5,254,56,118,94,141,
+128,160,133,135,142,127,160,90,191,148,124,171,53,98,251,149,190,89,2,180,
+1,30,243,121,254,234,254,170,253,46,2,210,1,107,1,1,254,225,254,149,253,76,
+2,180,1,72,1,59,152,103,110,213,153,254,198,254,184,253,76,0,1,0,100,0,0,
+4,22,5,182,0,30,0,0,51,53,33,50,54,53,52,38,35,33,53,33,50,54,53,52,38,35,
+33,53,33,50,4,21,16,7,22,17,20,4,35,100,1,182,182,166,169,179,254,124,1,132,
+179,169,167,181,254,74,1,182,242,1,10,205,205,254,246,242,145,120,126,134,
+133,146,134,133,127,119,145,196,176,254,239,86,90,254,243,175,197,0,255,255,
+0,100,0,0,4,22,5,182,18,38,1,251,0,0,16,7,2,211,0,211,253,249,255,255,0,100,
+0,0,4,22,5,182,18,38,1,251,0,0,16,6,2,214,247,0,0,1,0,120,0,0,4,42,5,182,
+0,30,0,0,1,33,34,6,21,20,22,51,33,21,33,34,6,21,20,22,51,33,21,33,34,36,53,
+16,55,38,17,52,36,51,33,4,42,254,74,182,166,169,179,1,132,254,124,179,169,
+167,181,1,182,254,74,242,254,246,205,205,1,10,242,1,182,5,37,120,126,133,
+134,146,134,133,127,119,145,196,176,1,13,90,86,1,17,175,197,0,0,3,0,140,255,
+231,6,158,5,182,0,15,0,25,0,34,0,0,1,17,16,2,6,35,34,39,6,6,35,34,38,2,17,
+17,1,17,33,17,16,18,51,50,54,54,37,17,33,17,16,18,51,50,18,6,158,90,191,147,
+251,98,52,172,124,152,191,86,5,114,253,231,128,141,93,119,56,253,71,253,231,
+126,143,136,132,5,182,253,76,254,183,254,197,151,213,109,104,157,1,61,1,65,
+2,180,253,76,2,35,253,191,254,170,254,234,121,248,251,2,65,253,221,254,149,
+254,225,1,2,0,0,3,0,140,0,0,6,158,5,207,0,15,0,25,0,34,0,0,51,17,16,18,54,
+51,50,22,23,54,51,50,22,18,17,17,3,16,38,38,35,34,2,17,17,33,1,16,2,35,34,
+2,17,17,33,140,90,191,148,124,171,53,98,251,149,190,89,160,56,118,94,141,
+128,2,25,253,71,133,135,142,127,2,25,2,180,1,72,1,59,152,103,110,213,153,
+254,198,254,184,253,76,2,180,1,30,243,121,254,234,254,170,253,191,2,65,1,
+107,1,1,254,225,254,149,253,221,0,3,0,140,0,0,4,234,5,182,0,14,0,23,0,32,
+0,0,1,22,22,21,20,6,33,33,17,33,50,22,21,20,6,1,33,50,54,53,52,38,35,33,53,
+33,50,54,53,52,38,35,33,4,24,108,102,221,254,255,253,128,2,128,255,223,102,
+252,168,1,224,188,130,160,158,254,32,1,224,158,160,126,192,254,32,2,219,50,
+175,141,187,178,5,182,177,188,141,177,253,134,118,123,134,138,146,139,133,
+120,121,0,255,255,0,140,0,0,4,234,5,182,18,38,2,1,0,0,16,7,2,211,1,203,253,
+249,255,255,0,140,0,0,4,234,5,182,18,38,2,1,0,0,16,7,2,214,0,222,0,0,0,3,
+0,120,0,0,4,214,5,182,0,14,0,23,0,32,0,0,33,33,32,38,53,52,54,55,38,38,53,
+52,54,51,33,1,34,6,21,20,22,51,33,17,1,34,6,21,20,22,51,33,17,4,214,253,128,
+254,248,214,102,108,107,103,223,255,2,128,253,128,158,160,126,192,1,224,254,
+32,189,129,160,158,1,224,181,184,141,175,50,48,177,141,188,177,252,220,139,
+133,120,121,2,1,2,147,119,122,134,138,2,1,0,3,0,140,255,231,7,22,5,207,0,
+19,0,28,0,37,0,0,1,21,1,51,17,16,2,35,32,39,6,33,34,38,2,17,17,51,1,53,5,
+5,17,16,18,51,50,18,17,1,17,16,18,51,50,18,17,17,4,33,2,225,20,223,235,254,
+244,111,107,254,241,157,207,95,20,2,225,2,245,253,171,146,153,150,148,250,
+182,143,156,149,149,5,182,253,1,22,253,51,254,77,254,152,250,250,166,1,69,
+1,48,2,205,254,234,253,198,224,254,213,254,198,254,205,1,54,1,84,1,238,254,
+18,254,182,254,192,1,48,1,67,1,37,0,3,0,140,255,231,7,22,5,207,0,19,0,28,
+0,37,0,0,33,53,1,35,17,16,18,54,51,32,23,54,33,50,18,17,17,35,1,21,1,16,2,
+35,34,2,17,17,5,37,17,16,2,35,34,2,17,17,3,129,253,31,20,98,204,157,1,15,
+107,111,1,12,227,231,20,253,31,2,85,148,150,153,146,2,85,253,11,149,149,156,
+143,253,254,234,2,205,1,53,1,66,164,250,250,254,167,254,62,253,51,1,22,253,
+2,180,1,85,1,53,254,205,254,198,254,213,224,224,1,37,1,67,1,48,254,192,254,
+182,254,18,0,3,0,100,0,0,4,224,5,182,0,20,0,29,0,38,0,0,19,53,33,1,53,33,
+50,22,21,20,6,7,22,22,21,20,6,33,33,53,1,3,33,50,54,53,52,38,35,35,53,51,
+50,54,53,52,38,35,33,128,1,7,254,221,2,158,255,223,102,108,108,102,221,254,
+255,253,98,1,35,57,1,180,188,130,160,158,209,209,158,160,126,192,254,76,2,
+146,146,2,126,20,177,188,141,177,48,50,175,141,187,178,20,2,126,253,255,118,
+123,134,138,146,139,133,120,121,255,255,0,100,0,0,4,224,5,182,18,38,2,7,0,
+0,16,7,2,211,2,70,253,249,255,255,0,100,0,0,4,224,5,182,18,38,2,7,0,0,16,
+7,2,214,1,113,0,0,0,3,0,120,0,0,4,244,5,182,0,20,0,29,0,38,0,0,1,33,21,33,
+1,21,33,32,38,53,52,54,55,38,38,53,52,54,51,33,21,1,35,34,6,21,20,22,51,33,
+17,33,34,6,21,20,22,51,51,3,209,1,7,254,249,1,35,253,98,254,248,214,102,108,
+107,103,223,255,2,158,254,51,209,158,160,126,192,1,180,254,76,189,129,160,
+158,209,3,36,146,253,130,20,181,184,141,175,50,48,177,141,188,177,20,252,
+240,139,133,120,121,4,148,119,122,134,138,0,0,1,0,50,2,188,3,151,5,182,0,
+6,0,0,1,1,51,1,1,51,1,1,133,254,173,172,1,6,1,7,172,254,173,2,188,2,250,253,
+171,2,85,253,6,0,0,1,0,140,255,231,4,252,5,182,0,14,0,0,1,16,0,33,32,0,17,
+17,51,17,16,33,50,54,19,4,252,254,233,254,219,254,230,254,230,160,1,148,224,
+179,9,2,108,254,164,254,215,1,89,1,112,3,6,252,195,253,255,216,1,28,0,1,0,
+100,0,0,4,212,5,207,0,14,0,0,19,16,0,33,32,0,17,17,35,17,16,33,34,6,3,100,
+1,23,1,37,1,26,1,26,160,254,108,224,179,9,3,74,1,92,1,41,254,167,254,144,
+252,250,3,61,2,1,216,254,228,0,0,1,0,100,0,0,6,51,4,96,0,15,0,0,37,36,54,
+53,52,38,33,33,53,33,32,0,17,16,0,33,3,174,1,15,209,240,254,254,252,200,3,
+6,1,135,1,66,254,216,254,163,145,9,184,234,199,204,145,254,235,254,241,254,
+221,254,231,0,255,255,0,100,0,0,6,51,4,96,18,38,2,14,0,0,16,7,2,211,3,20,
+253,106,255,255,0,100,0,0,6,51,4,96,18,38,2,14,0,0,16,7,2,213,2,32,255,106,
+0,1,0,120,0,0,6,71,4,96,0,15,0,0,1,4,6,21,20,22,33,33,21,33,32,0,17,16,0,
+33,2,253,254,242,210,240,1,2,3,56,252,250,254,121,254,190,1,40,1,93,3,207,
+9,183,235,199,204,145,1,21,1,15,1,35,1,25,0,1,0,140,255,231,6,158,5,182,0,
+34,0,0,1,21,16,2,6,35,34,39,6,6,35,34,38,2,17,17,51,17,16,18,51,50,18,17,
+17,51,17,16,18,51,50,54,54,17,53,6,158,90,191,147,251,98,52,172,124,152,191,
+86,160,126,143,136,132,160,128,141,93,119,56,3,32,30,254,183,254,197,151,
+213,109,104,157,1,61,1,65,2,180,253,76,254,149,254,225,1,2,1,106,1,29,254,
+227,254,170,254,234,121,248,1,25,30,0,1,0,140,255,231,6,158,5,182,0,35,0,
+0,19,53,16,18,54,51,50,22,23,54,54,51,50,22,18,17,17,35,17,16,2,35,34,2,17,
+17,35,17,16,2,35,34,6,6,17,21,140,87,189,152,125,172,52,52,172,124,152,191,
+86,160,127,142,137,131,160,128,141,94,119,55,2,125,30,1,70,1,57,156,104,109,
+109,104,157,254,195,254,191,253,76,2,180,1,107,1,31,254,249,254,155,254,227,
+1,29,1,86,1,22,122,249,254,233,30,0,1,0,100,0,0,4,22,5,182,0,30,0,0,33,53,
+51,50,54,53,52,38,35,33,53,33,50,54,53,52,38,35,33,53,33,50,4,21,16,7,22,
+17,20,4,35,1,194,88,182,166,169,179,254,254,1,2,179,169,167,181,254,74,1,
+182,242,1,10,205,205,254,246,242,145,120,126,134,133,146,134,133,127,119,
+145,196,176,254,239,86,90,254,243,175,197,0,255,255,0,100,0,0,4,22,5,182,
+18,38,2,20,0,0,16,7,2,211,0,172,253,249,255,255,0,100,0,0,4,22,5,182,18,38,
+2,20,0,0,16,6,2,214,24,0,0,1,0,120,0,0,4,42,5,182,0,30,0,0,1,35,34,6,21,20,
+22,51,33,21,33,34,6,21,20,22,51,33,21,33,34,36,53,16,55,38,17,52,36,51,51,
+2,204,88,182,166,169,179,1,32,254,224,179,169,167,181,1,182,254,74,242,254,
+246,205,205,1,10,242,88,5,37,120,126,133,134,146,134,133,127,119,145,196,
+176,1,17,86,90,1,13,175,197,0,0,1,0,140,255,231,5,68,5,207,0,39,0,0,1,38,
+38,53,52,54,51,50,18,17,21,16,2,4,35,34,36,2,17,17,51,17,16,22,22,51,50,54,
+54,17,53,52,38,35,34,6,21,20,22,23,3,58,146,144,207,178,217,210,126,254,246,
+218,216,254,251,121,160,86,194,159,167,197,85,133,137,106,116,87,83,2,150,
+34,215,187,163,226,254,246,254,230,145,254,181,254,178,154,147,1,62,1,98,
+2,156,253,110,254,200,251,121,124,247,1,57,137,215,186,132,117,120,155,18,
+0,0,1,0,140,255,231,5,68,5,207,0,39,0,0,1,22,22,21,20,6,35,34,2,17,53,16,
+18,36,51,50,4,18,17,17,35,17,16,38,38,35,34,6,6,17,21,20,22,51,50,54,53,52,
+38,39,2,150,146,144,207,178,217,210,126,1,10,218,216,1,5,121,160,86,194,159,
+167,197,85,133,137,106,116,87,83,3,32,34,215,187,163,226,1,10,1,26,145,1,
+75,1,78,154,147,254,194,254,158,253,100,2,146,1,56,251,121,124,247,254,199,
+137,215,186,132,117,120,155,18,0,0,1,0,100,0,0,5,20,5,182,0,35,0,0,1,38,35,
+34,6,21,20,22,51,51,50,18,17,52,2,36,33,35,53,51,32,4,18,17,16,0,33,35,34,
+0,53,52,54,51,50,23,2,141,56,106,106,125,184,155,59,235,247,141,254,190,254,
+197,182,182,1,147,1,112,167,254,177,254,208,90,207,254,248,219,177,125,86,
+2,138,48,134,112,143,164,1,38,1,14,236,1,3,113,145,152,254,188,254,235,254,
+179,254,136,1,0,202,167,218,44,255,255,0,100,0,0,5,20,5,182,18,38,2,26,0,
+0,16,7,2,211,1,243,253,249,255,255,0,100,0,0,5,20,5,182,18,38,2,26,0,0,16,
+7,2,214,0,202,0,0,0,1,0,120,0,0,5,40,5,182,0,35,0,0,1,22,51,50,54,53,52,38,
+35,35,34,2,17,20,18,4,33,51,21,35,32,36,2,17,16,0,33,51,50,0,21,20,6,35,34,
+39,2,255,55,107,106,125,184,155,59,235,247,141,1,66,1,59,182,182,254,109,
+254,144,167,1,79,1,48,90,207,1,8,219,177,125,86,3,44,48,134,112,143,164,254,
+218,254,242,236,254,253,113,145,152,1,68,1,21,1,77,1,120,255,0,202,166,219,
+44,0,1,0,120,255,231,4,96,5,182,0,31,0,0,1,51,50,22,21,20,6,35,32,36,53,52,
+18,55,37,33,53,33,21,1,6,6,21,20,22,51,32,53,52,38,35,35,2,139,114,161,194,
+246,225,254,242,254,254,160,211,1,89,253,51,3,200,254,59,213,141,173,190,
+1,60,103,92,112,2,215,178,176,194,204,234,253,202,1,15,144,238,145,135,254,
+197,147,223,180,181,161,245,100,117,0,0,1,0,120,255,231,4,96,5,182,0,31,0,
+0,1,35,34,6,21,20,33,50,54,53,52,38,39,1,53,33,21,33,5,22,18,21,20,4,33,34,
+38,53,52,54,51,51,2,75,112,92,103,1,60,189,174,140,214,254,59,3,200,253,51,
+1,89,220,151,254,254,254,242,224,247,193,162,114,2,70,116,101,245,161,181,
+179,224,147,1,59,135,145,238,152,254,244,197,252,235,204,194,173,181,0,0,
+1,0,120,0,0,4,96,5,207,0,31,0,0,1,35,34,38,53,52,54,51,32,4,21,20,2,7,5,33,
+21,33,53,1,54,54,53,52,38,35,32,21,20,22,51,51,2,77,114,161,194,246,225,1,
+14,1,2,157,214,254,167,2,205,252,56,1,197,213,141,173,190,254,196,103,92,
+112,2,223,178,176,194,204,234,253,200,254,242,147,238,145,135,1,59,147,223,
+180,181,161,245,100,117,0,0,1,0,140,255,231,6,173,4,21,0,42,0,0,1,19,54,36,
+51,32,0,17,16,2,35,34,38,53,53,52,54,51,50,23,7,38,38,35,34,6,21,21,20,22,
+51,50,54,53,52,38,35,32,0,7,35,17,51,1,44,209,145,1,60,185,1,2,1,40,226,210,
+186,199,143,104,85,64,46,34,36,27,41,52,119,114,133,135,207,187,254,214,253,
+223,13,159,160,1,36,1,67,223,207,254,227,255,0,255,0,254,239,191,134,44,95,
+147,29,137,14,7,60,43,38,96,84,192,187,190,211,252,145,21,4,1,255,255,0,140,
+255,231,6,173,4,21,18,38,2,33,0,0,16,7,2,211,4,87,253,17,255,255,0,140,255,
+231,6,173,4,21,18,38,2,33,0,0,16,7,2,214,3,60,255,23,0,1,0,140,255,236,6,
+173,4,26,0,43,0,0,33,35,17,51,1,22,4,51,50,54,53,52,38,35,34,6,21,21,20,22,
+51,50,54,55,23,6,35,34,38,53,53,52,54,51,50,18,17,16,0,33,34,36,39,3,1,44,
+160,159,1,22,150,1,23,149,187,207,136,132,113,120,53,40,25,37,35,46,64,85,
+103,144,199,186,210,226,254,216,254,254,185,254,194,148,204,4,1,254,65,242,
+211,211,190,187,192,83,97,38,44,59,7,14,137,29,146,96,44,134,191,254,239,
+255,0,255,0,254,227,208,228,1,61,0,0,1,0,140,255,236,6,173,4,26,0,43,0,0,
+1,3,6,4,35,32,0,17,16,18,51,50,22,21,21,20,6,35,34,39,55,22,22,51,50,54,53,
+53,52,38,35,34,6,21,20,22,51,50,36,55,1,51,17,35,6,13,209,146,254,195,183,
+254,254,254,216,226,210,186,199,143,104,85,64,46,34,36,27,40,53,119,114,133,
+135,207,187,147,1,25,150,1,22,159,160,2,221,254,189,224,206,1,29,1,0,1,0,
+1,17,191,134,44,95,147,29,137,14,7,58,45,38,96,84,192,187,190,211,210,243,
+1,191,251,255,0,0,1,0,80,0,0,4,221,5,207,0,40,0,0,1,54,54,51,50,22,21,20,
+4,35,35,32,0,17,16,55,39,55,23,54,36,51,33,21,33,32,0,17,16,22,51,51,50,54,
+53,52,38,35,34,6,7,2,35,34,186,118,167,193,254,247,206,90,254,240,254,220,
+180,220,106,224,115,1,47,160,1,1,254,255,254,197,254,119,211,196,59,155,184,
+106,89,72,93,18,2,66,122,143,203,182,204,254,1,84,1,66,1,63,202,205,99,204,
+85,94,145,254,176,254,193,254,248,253,164,143,114,130,85,67,0,1,0,100,255,
+231,4,241,5,182,0,40,0,0,1,6,6,35,34,38,53,52,36,51,51,32,0,17,16,7,23,7,
+39,6,4,35,33,53,33,32,0,17,16,38,35,35,34,6,21,20,22,51,50,54,55,3,30,34,
+186,118,167,193,1,9,206,90,1,16,1,36,181,221,106,225,114,254,207,158,254,
+255,1,1,1,59,1,137,211,196,59,155,184,103,92,72,93,18,3,116,122,143,203,182,
+204,254,254,172,254,190,254,194,203,205,99,203,84,94,145,1,80,1,63,1,8,253,
+164,143,112,132,85,67,0,1,0,120,255,231,6,122,4,87,0,42,0,0,1,54,33,32,0,
+17,20,0,35,34,38,53,52,54,51,23,21,39,35,34,21,20,22,51,50,54,53,53,52,38,
+33,34,4,2,21,21,35,53,52,18,55,39,55,1,224,215,1,40,1,66,1,89,254,242,203,
+182,203,155,140,40,16,18,139,107,122,144,163,243,254,248,210,254,196,179,
+160,135,114,255,99,3,98,184,254,228,254,222,238,254,249,162,144,142,156,2,
+144,1,149,83,82,176,152,55,210,192,221,254,110,200,82,82,166,1,116,139,246,
+106,255,255,0,120,255,231,6,122,4,87,18,38,2,40,0,0,16,7,2,211,3,230,253,
+17,255,255,0,120,255,231,6,122,4,87,18,38,2,40,0,0,16,7,2,214,2,255,255,23,
+0,1,0,120,255,170,6,122,4,26,0,42,0,0,37,6,33,32,0,17,52,0,51,50,22,21,20,
+6,35,39,53,23,51,50,53,52,38,35,34,6,21,21,20,22,33,50,36,18,53,53,51,21,
+20,2,7,23,7,5,18,213,254,214,254,190,254,167,1,14,203,182,203,155,140,40,
+17,17,139,107,122,144,163,243,1,8,210,1,60,179,160,135,114,255,99,159,184,
+1,28,1,34,238,1,7,162,144,142,156,2,144,1,149,82,83,176,152,55,210,192,221,
+1,146,200,82,82,166,254,140,139,246,106,0,0,1,0,80,255,231,6,242,4,1,0,19,
+0,0,1,20,4,51,50,36,53,17,51,17,16,0,33,32,0,17,17,33,53,33,2,101,1,9,237,
+232,1,15,160,254,149,254,212,254,209,254,153,254,139,2,21,2,59,202,249,244,
+207,1,198,254,55,254,241,254,190,1,71,1,9,1,57,145,0,1,0,120,0,0,7,26,4,26,
+0,19,0,0,1,52,36,35,34,4,21,17,35,17,16,0,33,32,0,17,17,33,21,33,5,5,254,
+244,234,235,254,244,160,1,107,1,44,1,47,1,103,1,117,253,235,1,198,204,247,
+248,203,254,58,1,201,1,15,1,66,254,185,254,247,254,199,145,0,1,0,120,0,0,
+4,93,5,182,0,19,0,0,1,51,32,0,17,16,0,33,33,53,33,50,54,53,52,38,35,33,17,
+51,1,24,238,1,28,1,59,254,196,254,229,254,114,1,141,207,233,233,207,254,115,
+160,4,101,254,214,254,242,254,247,254,220,145,219,197,199,220,1,226,0,255,
+255,0,120,0,0,4,93,5,182,18,38,2,46,0,0,16,7,2,211,1,66,253,88,255,255,0,
+120,0,0,4,93,5,182,18,38,2,46,0,0,16,7,2,213,0,90,255,96,0,1,0,120,0,0,4,
+93,5,182,0,19,0,0,1,51,17,33,34,6,21,20,22,51,33,21,33,32,0,17,16,0,33,51,
+3,189,160,254,115,207,233,233,207,1,141,254,114,254,229,254,196,1,59,1,28,
+238,5,182,254,30,220,199,198,218,145,1,36,1,9,1,14,1,42,0,0,1,0,100,255,231,
+7,5,4,151,0,23,0,0,19,17,51,21,33,17,20,4,51,50,36,53,17,51,17,16,0,33,32,
+0,17,17,35,21,100,160,1,116,1,9,237,232,1,15,160,254,149,254,212,254,209,
+254,153,212,2,213,1,194,150,254,58,202,249,244,207,1,198,254,55,254,241,254,
+190,1,71,1,9,1,57,155,0,1,0,120,255,106,7,25,4,26,0,23,0,0,1,17,35,53,33,
+17,52,36,35,34,4,21,17,35,17,16,0,33,32,0,17,17,51,53,7,25,160,254,140,254,
+244,234,235,254,244,160,1,107,1,44,1,47,1,103,212,1,44,254,62,150,1,198,204,
+247,248,203,254,58,1,201,1,15,1,66,254,185,254,247,254,199,155,0,0,1,0,80,
+0,0,4,203,5,182,0,23,0,0,1,35,21,51,32,0,17,16,0,33,33,53,33,50,54,53,52,
+38,35,33,17,35,53,33,2,28,150,238,1,28,1,59,254,196,254,229,254,114,1,141,
+207,233,233,207,254,115,150,1,204,5,37,192,254,214,254,242,254,247,254,220,
+145,219,197,199,220,1,81,145,255,255,0,80,0,0,4,203,5,182,18,38,2,52,0,0,
+16,7,2,211,1,176,253,88,255,255,0,80,0,0,4,203,5,182,18,38,2,52,0,0,16,7,
+2,213,0,200,255,96,0,1,0,120,0,0,4,243,5,182,0,23,0,0,1,33,21,35,17,33,34,
+6,21,20,22,51,33,21,33,32,0,17,16,0,33,51,53,35,3,39,1,204,150,254,115,207,
+233,233,207,1,141,254,114,254,229,254,196,1,59,1,28,238,150,5,182,145,254,
+175,220,199,198,218,145,1,36,1,9,1,14,1,42,192,0,1,0,100,255,231,6,71,5,182,
+0,35,0,0,1,33,22,18,21,21,16,0,33,32,0,17,53,52,18,55,33,53,33,21,6,2,21,
+21,16,18,51,50,18,17,53,52,2,39,53,33,6,71,254,224,82,93,254,179,254,202,
+254,207,254,179,93,82,254,224,2,52,130,161,245,237,236,243,157,134,2,52,5,
+37,89,254,221,160,87,254,181,254,128,1,129,1,74,87,162,1,33,89,145,115,35,
+254,173,197,76,254,225,254,219,1,39,1,29,76,189,1,88,38,115,0,0,1,0,100,0,
+0,6,71,5,207,0,35,0,0,33,33,53,54,18,53,53,16,2,35,34,2,17,21,20,18,23,21,
+33,53,33,38,2,53,53,16,0,33,32,0,17,21,20,2,7,33,6,71,253,204,132,159,243,
+236,237,245,161,130,253,204,1,32,82,93,1,78,1,48,1,55,1,76,93,82,1,32,115,
+36,1,87,192,76,1,29,1,39,254,219,254,225,76,197,254,173,35,115,145,89,1,35,
+160,87,1,74,1,129,254,129,254,180,87,162,254,223,89,0,0,1,0,120,0,0,4,93,
+5,182,0,21,0,0,51,17,33,50,54,53,52,38,35,33,17,51,21,51,32,0,17,16,0,33,
+35,21,120,1,141,207,233,233,207,254,115,160,238,1,28,1,59,254,196,254,229,
+238,1,54,219,197,199,220,1,61,172,254,214,254,242,254,247,254,220,165,255,
+255,0,120,0,0,4,93,5,182,18,38,2,58,0,0,16,7,2,211,1,66,253,253,255,255,0,
+120,0,0,4,93,5,182,18,38,2,58,0,0,16,6,2,213,90,7,0,1,0,120,0,0,4,93,5,182,
+0,21,0,0,33,53,35,32,0,17,16,0,33,51,53,51,17,33,34,6,21,20,22,51,33,17,3,
+189,238,254,229,254,196,1,59,1,28,238,160,254,115,207,233,233,207,1,141,165,
+1,36,1,9,1,14,1,42,172,254,195,220,199,198,218,254,202,0,0,1,0,80,255,231,
+7,247,4,151,0,25,0,0,1,53,35,17,16,0,33,32,0,17,17,33,53,33,17,20,4,51,50,
+36,53,17,33,53,51,17,7,87,212,254,155,254,207,254,210,254,151,254,250,1,166,
+1,14,233,234,1,12,1,116,160,2,213,155,254,199,254,248,254,184,1,66,1,15,1,
+56,145,254,58,205,246,247,204,1,198,150,254,62,0,0,1,0,80,255,106,7,247,4,
+26,0,25,0,0,19,21,51,17,16,0,33,32,0,17,17,33,21,33,17,52,36,35,34,4,21,17,
+33,21,35,17,240,212,1,101,1,49,1,46,1,105,1,6,254,90,254,240,231,235,254,
+245,254,140,160,1,44,155,1,57,1,8,1,72,254,190,254,241,254,200,145,1,198,
+205,246,248,203,254,58,150,1,194,0,1,0,80,0,0,4,203,5,182,0,25,0,0,51,17,
+33,50,54,53,52,38,35,33,17,35,53,33,21,35,21,51,32,0,21,20,4,33,35,21,230,
+1,141,217,223,224,216,254,115,150,1,204,150,238,1,31,1,56,254,201,254,224,
+238,1,54,180,171,172,182,1,46,145,145,157,255,0,247,239,253,165,255,255,0,
+80,0,0,4,203,5,182,18,38,2,64,0,0,16,7,2,211,1,191,253,183,255,255,0,80,0,
+0,4,203,5,182,18,38,2,64,0,0,16,7,2,213,0,205,255,183,0,1,0,120,0,0,4,243,
+5,182,0,25,0,0,33,53,35,32,36,53,52,0,33,51,53,35,53,33,21,35,17,33,34,6,
+21,20,22,51,33,17,3,189,238,254,225,254,200,1,55,1,32,238,150,1,204,150,254,
+115,216,224,223,217,1,141,165,250,242,247,1,0,157,145,145,254,210,182,172,
+171,180,254,202,0,0,1,0,80,255,231,8,220,6,76,0,42,0,0,37,6,6,35,34,38,2,
+17,17,33,53,33,17,16,18,51,50,18,17,17,51,17,16,18,51,50,54,54,17,17,33,53,
+51,17,35,53,35,17,16,2,6,35,34,4,95,52,172,124,152,191,86,254,250,1,166,126,
+143,136,132,160,128,141,93,119,56,1,116,160,160,212,90,191,147,251,188,109,
+104,157,1,61,1,65,2,35,145,253,76,254,149,254,225,1,2,1,106,2,210,253,46,
+254,170,254,234,121,248,1,25,2,180,150,254,62,155,253,221,254,183,254,197,
+151,0,1,0,80,255,106,8,220,5,207,0,43,0,0,1,54,54,51,50,22,18,17,17,33,21,
+33,17,16,2,35,34,2,17,17,35,17,16,2,35,34,6,6,17,17,33,21,35,17,51,21,51,
+17,16,18,54,51,50,22,4,205,52,172,124,152,191,86,1,6,254,90,127,142,137,131,
+160,128,141,94,119,55,254,140,160,160,212,87,189,152,125,172,4,250,109,104,
+157,254,195,254,191,253,221,145,2,180,1,107,1,31,254,249,254,155,253,46,2,
+210,1,86,1,22,122,249,254,233,253,76,150,1,194,155,2,35,1,70,1,57,156,104,
+0,1,0,50,255,91,4,72,5,182,0,40,0,0,1,50,54,53,52,38,35,33,17,35,53,33,21,
+35,21,51,32,22,21,20,6,7,22,22,21,20,6,33,35,21,35,17,33,50,54,53,52,38,35,
+33,53,2,56,203,165,156,192,254,124,150,1,204,150,228,1,16,236,79,78,78,79,
+236,254,240,228,160,1,132,192,156,165,203,254,194,2,132,93,94,87,79,1,64,
+145,145,175,152,160,95,119,45,45,119,95,160,152,165,1,54,79,87,94,93,146,
+0,255,255,0,50,255,91,4,72,5,182,18,38,2,70,0,0,16,7,2,211,0,132,253,95,255,
+255,0,50,255,91,4,72,5,182,18,38,2,70,0,0,16,7,2,214,255,252,255,98,0,1,0,
+120,255,91,4,142,5,182,0,40,0,0,1,21,33,34,6,21,20,22,51,33,17,35,53,35,32,
+38,53,52,54,55,38,38,53,52,54,33,51,53,35,53,33,21,35,17,33,34,6,21,20,22,
+51,3,198,254,194,203,165,156,192,1,132,160,228,254,240,236,79,78,78,79,236,
+1,16,228,150,1,204,150,254,124,192,156,165,203,2,132,146,93,94,87,79,254,
+202,165,152,160,95,119,45,45,119,95,160,152,175,145,145,254,192,79,87,94,
+93,0,0,1,0,100,255,231,5,220,5,182,0,41,0,0,1,34,6,21,20,18,21,16,0,33,32,
+0,17,52,18,53,52,38,35,35,53,51,50,22,21,20,2,21,20,22,51,50,36,53,52,2,53,
+52,54,51,51,21,5,167,71,75,146,254,146,254,227,254,214,254,167,146,75,71,
+53,72,129,158,146,252,235,226,1,5,146,158,129,72,5,37,65,59,117,254,197,152,
+254,213,254,177,1,98,1,24,151,1,61,116,59,65,145,146,115,134,254,196,135,
+241,255,252,245,134,1,60,134,115,146,145,0,1,0,100,0,0,5,220,5,207,0,41,0,
+0,33,35,34,38,53,52,18,53,52,36,35,34,6,21,20,18,21,20,6,35,35,53,51,50,54,
+53,52,2,53,16,0,33,32,0,17,20,2,21,20,22,51,51,5,220,72,129,158,146,254,251,
+226,236,251,146,158,129,72,53,71,75,146,1,88,1,43,1,28,1,111,146,75,71,53,
+146,115,134,1,60,135,245,251,254,243,134,254,196,134,115,146,145,65,59,117,
+1,59,153,1,23,1,98,254,178,254,213,152,254,195,116,59,65,0,1,0,80,255,231,
+5,54,5,207,0,37,0,0,0,0,17,16,0,33,34,38,35,34,6,21,35,52,54,51,50,22,51,
+50,18,17,16,2,35,34,6,35,34,38,53,51,20,22,51,50,54,51,4,13,1,41,254,224,
+254,228,88,216,79,68,71,160,165,126,89,204,107,205,198,204,199,110,202,88,
+124,167,160,71,68,79,216,88,5,150,254,164,254,183,254,147,254,156,74,71,60,
+120,156,73,1,20,1,43,1,5,1,14,73,154,122,60,71,74,255,255,0,80,255,231,5,
+54,5,207,18,38,2,76,0,0,16,7,2,211,1,227,253,250,255,255,0,80,255,231,5,54,
+5,207,18,38,2,76,0,0,16,7,2,213,0,237,255,243,0,1,0,120,255,231,5,94,5,207,
+0,37,0,0,0,2,17,16,18,51,50,54,51,50,22,21,35,52,38,35,34,6,35,32,0,17,16,
+0,33,50,22,51,50,54,53,51,20,6,35,34,38,35,1,229,205,197,206,108,203,89,124,
+167,160,71,68,79,216,88,254,228,254,224,1,41,1,19,88,216,79,68,71,160,167,
+124,87,202,111,5,4,254,243,254,250,254,213,254,236,73,155,121,60,71,74,1,
+100,1,109,1,73,1,92,74,71,60,121,155,73,0,0,1,0,80,2,188,2,187,5,182,0,9,
+0,0,19,1,33,53,33,21,1,33,21,33,80,1,155,254,101,2,105,254,101,1,157,253,
+149,3,17,2,27,138,85,253,229,138,0,1,0,80,2,88,2,187,6,36,0,17,0,0,19,1,33,
+53,51,53,51,21,51,21,1,33,21,35,21,35,53,35,80,1,155,254,101,227,154,236,
+254,101,1,157,238,154,227,3,17,2,27,138,110,110,85,253,229,138,100,100,0,
+2,0,100,255,231,5,220,5,182,0,41,0,49,0,0,1,34,6,21,20,18,21,16,0,33,32,0,
+17,52,18,53,52,38,35,35,53,51,50,22,21,20,2,21,20,22,51,50,36,53,52,2,53,
+52,54,51,51,21,1,17,35,53,33,21,35,17,5,167,71,75,146,254,146,254,227,254,
+214,254,167,146,75,71,53,72,129,158,146,252,235,226,1,5,146,158,129,72,252,
+247,180,2,2,180,5,37,65,59,117,254,197,152,254,213,254,177,1,98,1,24,151,
+1,61,116,59,65,145,146,115,134,254,196,135,241,255,252,245,134,1,60,134,115,
+146,145,254,95,1,168,138,138,254,88,0,2,0,100,0,0,5,220,5,207,0,41,0,49,0,
+0,33,35,34,38,53,52,18,53,52,36,35,34,6,21,20,18,21,20,6,35,35,53,51,50,54,
+53,52,2,53,16,0,33,32,0,17,20,2,21,20,22,51,51,1,17,51,21,33,53,51,17,5,220,
+72,129,158,146,254,251,226,236,251,146,158,129,72,53,71,75,146,1,88,1,43,
+1,28,1,111,146,75,71,53,253,145,180,253,254,180,146,115,134,1,60,135,245,
+251,254,243,134,254,196,134,115,146,145,65,59,117,1,59,153,1,23,1,98,254,
+178,254,213,152,254,195,116,59,65,1,161,254,88,138,138,1,168,0,2,0,80,255,
+231,5,54,5,207,0,37,0,45,0,0,19,20,22,51,50,54,51,32,0,17,16,0,33,34,38,35,
+34,6,21,35,52,54,51,50,22,51,50,18,17,16,2,35,34,6,35,34,38,53,1,33,21,35,
+17,51,21,33,240,71,68,79,216,88,1,19,1,41,254,224,254,228,88,216,79,68,71,
+160,165,126,89,204,107,205,198,204,199,110,202,88,124,167,2,100,254,104,154,
+154,1,152,5,207,60,71,74,254,164,254,183,254,147,254,156,74,71,60,120,156,
+73,1,20,1,43,1,5,1,14,73,154,122,252,198,180,1,242,180,255,255,0,80,255,231,
+5,54,5,207,18,38,2,84,0,0,16,7,2,211,2,237,253,250,255,255,0,80,255,231,5,
+54,5,207,18,38,2,84,0,0,16,7,2,213,1,251,255,243,0,2,0,120,255,231,5,94,5,
+207,0,37,0,45,0,0,1,20,6,35,34,38,35,34,2,17,16,18,51,50,54,51,50,22,21,35,
+52,38,35,34,6,35,32,0,17,16,0,33,50,22,51,50,54,53,1,33,53,51,17,35,53,33,
+5,94,167,124,87,202,111,198,205,197,206,108,203,89,124,167,160,71,68,79,216,
+88,254,228,254,224,1,41,1,19,88,216,79,68,71,254,60,1,152,154,154,254,104,
+5,207,121,155,73,254,243,254,250,254,213,254,236,73,155,121,60,71,74,1,100,
+1,109,1,73,1,92,74,71,60,253,80,180,254,14,180,0,0,1,0,100,255,231,6,252,
+5,182,0,56,0,0,1,35,34,6,21,20,18,21,16,2,35,34,38,39,6,6,35,34,2,17,52,18,
+53,52,38,35,35,53,51,50,22,21,20,2,21,16,22,51,50,18,17,17,51,17,16,18,51,
+50,54,17,52,2,53,52,54,51,51,6,252,55,54,49,91,212,216,124,168,57,60,166,
+123,216,212,91,49,54,55,97,104,117,91,138,130,143,126,160,126,143,131,137,
+91,119,102,97,5,37,45,61,63,254,173,144,254,127,254,207,108,126,128,106,1,
+49,1,129,144,1,83,63,60,46,145,128,112,75,254,159,129,254,189,222,1,32,1,
+106,2,180,253,76,254,149,254,225,222,1,67,129,1,97,75,113,127,0,0,1,0,100,
+0,0,6,252,5,207,0,56,0,0,33,35,34,38,53,52,18,53,16,38,35,34,2,17,17,35,17,
+16,2,35,34,6,17,20,18,21,20,6,35,35,53,51,50,54,53,52,2,53,16,18,51,50,22,
+23,54,54,51,50,18,17,20,2,21,20,22,51,51,6,252,97,104,117,91,138,130,142,
+127,160,127,142,130,138,91,119,102,97,55,54,49,91,212,216,121,168,60,56,169,
+124,216,212,91,49,54,55,128,112,75,1,97,129,1,65,224,254,225,254,149,253,
+76,2,180,1,107,1,31,220,254,187,129,254,159,75,113,127,145,45,61,63,1,83,
+144,1,127,1,51,106,128,125,109,254,207,254,127,144,254,173,63,60,46,0,0,1,
+0,100,0,0,4,112,5,182,0,54,0,0,55,52,33,50,22,51,50,54,53,52,38,35,33,53,
+33,50,54,53,52,38,35,34,6,35,32,53,53,51,21,20,22,51,50,36,51,50,22,21,20,
+6,7,22,22,21,20,6,35,34,36,35,34,6,21,21,35,100,1,0,84,244,52,130,110,150,
+208,254,84,1,172,210,148,110,130,55,245,80,255,0,160,55,41,49,1,24,73,179,
+199,86,99,104,81,199,179,69,254,231,52,41,55,160,34,214,51,106,118,120,118,
+145,119,118,118,106,51,214,34,25,38,40,51,182,168,111,161,57,62,155,112,168,
+182,51,40,38,25,0,255,255,0,100,0,0,4,112,5,182,18,38,2,90,0,0,16,7,2,211,
+1,15,253,249,255,255,0,100,0,0,4,112,5,182,18,38,2,90,0,0,16,6,2,214,61,0,
+0,1,0,120,0,0,4,132,5,182,0,54,0,0,33,35,53,52,38,35,34,4,35,34,38,53,52,
+54,55,38,38,53,52,54,51,50,4,51,50,54,53,53,51,21,20,33,34,38,35,34,6,21,
+20,22,51,33,21,33,34,6,21,20,22,51,50,54,51,32,21,4,132,160,55,41,52,254,
+231,69,179,199,83,102,99,86,199,179,74,1,24,48,41,55,160,255,0,79,245,56,
+130,110,146,212,1,172,254,84,209,149,110,130,53,245,82,1,0,25,38,40,51,182,
+168,115,155,59,57,161,111,168,182,51,40,38,25,34,214,51,106,118,118,119,145,
+118,120,118,106,51,214,0,0,3,0,100,255,231,6,252,5,182,0,44,0,54,0,65,0,0,
+1,35,34,6,21,20,18,21,16,2,35,34,38,39,6,6,35,34,2,17,52,18,53,52,38,35,35,
+53,51,50,22,21,20,7,33,17,51,17,33,38,53,52,54,51,51,1,33,21,16,18,51,50,
+54,17,52,5,53,33,6,6,21,16,22,51,50,18,6,252,55,54,49,91,212,216,124,168,
+57,60,166,123,216,212,91,49,54,55,97,104,117,11,1,201,160,1,200,10,119,102,
+97,254,237,254,23,126,143,131,137,253,71,254,22,17,30,138,130,143,126,5,37,
+45,61,63,254,173,144,254,127,254,207,108,126,128,106,1,49,1,129,144,1,83,
+63,60,46,145,128,112,43,55,1,82,254,174,52,46,113,127,254,29,209,254,149,
+254,225,222,1,67,117,12,209,74,158,82,254,189,222,1,32,0,0,3,0,100,255,231,
+6,252,5,182,0,44,0,54,0,65,0,0,5,35,34,38,53,52,55,33,17,35,17,33,22,21,20,
+6,35,35,53,51,50,54,53,52,2,53,16,18,51,50,22,23,54,54,51,50,18,17,20,2,21,
+20,22,51,51,0,2,17,21,33,54,53,16,38,35,0,22,23,33,53,16,2,35,34,6,17,6,252,
+97,104,117,10,254,56,160,254,55,11,119,102,97,55,54,49,91,212,216,121,168,
+60,56,169,124,216,212,91,49,54,55,253,131,127,1,233,48,138,130,252,58,30,
+17,1,234,127,142,130,138,25,128,112,46,52,254,174,1,82,55,43,113,127,145,
+45,61,63,1,83,144,1,127,1,51,106,128,125,109,254,207,254,127,144,254,173,
+63,60,46,4,173,254,225,254,149,209,197,117,1,65,224,253,141,158,74,209,1,
+107,1,31,220,254,187,0,0,3,0,100,0,0,4,112,5,182,0,34,0,45,0,56,0,0,1,22,
+22,21,20,6,35,34,36,35,34,6,21,21,35,53,52,55,17,38,53,53,51,21,20,22,51,
+50,36,51,50,22,21,20,6,1,22,22,51,50,54,53,52,38,35,35,55,50,54,53,52,38,
+35,34,6,7,17,3,183,104,81,199,179,69,254,231,52,41,55,160,173,173,160,55,
+41,49,1,24,73,179,199,86,253,151,61,184,58,130,110,150,208,185,185,210,148,
+110,130,58,194,51,2,219,62,155,112,168,182,51,40,38,25,34,175,32,3,212,32,
+175,34,25,38,40,51,182,168,111,161,253,224,7,40,106,118,120,118,145,119,118,
+118,106,42,5,254,98,255,255,0,100,0,0,4,112,5,182,18,38,2,96,0,0,16,7,2,211,
+1,195,253,249,255,255,0,100,0,0,4,112,5,182,18,38,2,96,0,0,16,7,2,214,0,241,
+0,0,0,3,0,120,0,0,4,132,5,182,0,34,0,45,0,56,0,0,33,35,53,52,38,35,34,4,35,
+34,38,53,52,54,55,38,38,53,52,54,51,50,4,51,50,54,53,53,51,21,20,7,17,22,
+21,37,17,35,34,6,21,20,22,51,50,54,3,51,17,38,38,35,34,6,21,20,22,4,132,160,
+55,41,52,254,231,69,179,199,83,102,99,86,199,179,74,1,24,48,41,55,160,173,
+173,254,179,185,209,149,110,130,59,181,122,185,53,190,60,130,110,146,25,38,
+40,51,182,168,115,155,59,57,161,111,168,182,51,40,38,25,34,175,32,252,44,
+32,175,210,1,159,118,120,118,106,40,2,55,1,158,5,42,106,118,118,119,0,0,1,
+0,80,2,87,2,139,6,44,0,34,0,0,1,53,38,39,53,22,51,50,54,53,52,36,38,53,52,
+54,55,53,51,21,22,23,21,38,35,34,6,21,20,4,22,21,20,7,21,1,41,117,62,89,112,
+107,71,254,219,124,112,105,154,97,65,89,92,114,84,1,34,127,200,2,87,86,3,
+8,141,14,43,50,56,80,113,84,91,112,17,111,104,2,8,141,14,44,47,60,78,107,
+78,187,42,97,0,3,0,100,255,231,6,252,5,182,0,48,0,59,0,69,0,0,1,35,34,6,21,
+20,18,21,16,2,35,34,38,39,6,6,35,34,2,17,52,18,53,52,38,35,35,53,51,50,22,
+21,20,7,33,53,35,53,33,21,35,21,33,38,53,52,54,51,51,1,6,6,21,16,22,51,50,
+18,17,53,51,21,16,18,51,50,54,17,52,39,6,252,55,54,49,91,212,216,124,168,
+57,60,166,123,216,212,91,49,54,55,97,104,117,11,1,201,200,2,48,200,1,200,
+10,119,102,97,250,122,17,30,138,130,143,126,160,126,143,131,137,48,5,37,45,
+61,63,254,173,144,254,127,254,207,108,126,128,106,1,49,1,129,144,1,83,63,
+60,46,145,128,112,43,55,193,145,145,193,52,46,113,127,254,29,74,158,82,254,
+189,222,1,32,1,106,209,209,254,149,254,225,222,1,67,117,197,0,3,0,100,0,0,
+6,252,5,207,0,48,0,59,0,69,0,0,33,35,34,38,53,52,55,33,21,51,21,33,53,51,
+53,33,22,21,20,6,35,35,53,51,50,54,53,52,2,53,16,18,51,50,22,23,54,54,51,
+50,18,17,20,2,21,20,22,51,51,1,16,2,35,34,6,17,20,22,23,33,33,54,53,16,38,
+35,34,2,17,21,6,252,97,104,117,10,254,56,200,253,208,200,254,55,11,119,102,
+97,55,54,49,91,212,216,121,168,60,56,169,124,216,212,91,49,54,55,252,100,
+127,142,130,138,30,17,1,234,2,137,48,138,130,142,127,128,112,46,52,193,145,
+145,193,55,43,113,127,145,45,61,63,1,83,144,1,127,1,51,106,128,125,109,254,
+207,254,127,144,254,173,63,60,46,2,35,1,107,1,31,220,254,187,82,158,74,197,
+117,1,65,224,254,225,254,149,209,0,3,0,100,0,0,4,203,5,182,0,42,0,53,0,64,
+0,0,1,22,22,21,20,6,35,34,36,35,34,6,21,21,35,53,52,55,17,35,21,35,17,51,
+21,51,17,38,53,53,51,21,20,22,51,50,36,51,50,22,21,20,6,1,22,22,51,50,54,
+53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,4,18,104,81,199,179,69,254,
+231,52,41,55,160,173,110,154,154,110,173,160,55,41,49,1,24,73,179,199,86,
+253,151,61,184,58,130,110,150,208,185,185,210,148,110,130,58,194,51,2,219,
+62,155,112,168,182,51,40,38,25,34,175,32,1,162,180,1,249,180,1,161,32,175,
+34,25,38,40,51,182,168,111,161,253,224,7,40,106,118,120,118,145,119,118,118,
+106,42,5,255,255,0,100,0,0,4,203,5,182,18,38,2,103,0,0,16,7,2,211,2,30,253,
+249,255,255,0,100,0,0,4,203,5,182,18,38,2,103,0,0,16,7,2,214,1,76,0,0,0,3,
+0,120,0,0,4,223,5,182,0,42,0,53,0,64,0,0,1,38,38,53,52,54,51,50,4,51,50,54,
+53,53,51,21,20,7,17,51,53,51,17,35,53,35,17,22,21,21,35,53,52,38,35,34,4,
+35,34,38,53,52,54,5,35,34,6,21,20,22,51,50,54,55,17,38,38,35,34,6,21,20,22,
+51,51,1,49,99,86,199,179,74,1,24,48,41,55,160,173,110,154,154,110,173,160,
+55,41,52,254,231,69,179,199,83,2,108,185,209,149,110,130,58,184,61,51,194,
+58,130,110,146,212,185,2,219,57,161,111,168,182,51,40,38,25,34,175,32,254,
+95,180,254,7,180,254,94,32,175,34,25,38,40,51,182,168,115,155,13,118,120,
+118,106,40,7,3,206,5,42,106,118,118,119,0,1,0,100,255,231,6,252,5,182,0,60,
+0,0,1,35,17,16,18,51,50,54,17,52,2,53,52,54,51,51,21,35,34,6,21,20,18,21,
+16,2,35,34,38,39,6,6,35,34,2,17,52,18,53,52,38,35,35,53,51,50,22,21,20,2,
+21,16,22,51,50,18,17,17,35,53,33,4,200,200,126,143,131,137,91,119,102,97,
+55,54,49,91,212,216,124,168,57,60,166,123,216,212,91,49,54,55,97,104,117,
+91,138,130,143,126,200,2,48,5,37,253,221,254,149,254,225,222,1,67,129,1,97,
+75,113,127,145,45,61,63,254,173,144,254,127,254,207,108,126,128,106,1,49,
+1,129,144,1,83,63,60,46,145,128,112,75,254,159,129,254,189,222,1,32,1,106,
+2,35,145,0,1,0,100,0,0,6,252,5,207,0,60,0,0,33,33,53,51,17,16,2,35,34,6,17,
+20,18,21,20,6,35,35,53,51,50,54,53,52,2,53,16,18,51,50,22,23,54,54,51,50,
+18,17,20,2,21,20,22,51,51,21,35,34,38,53,52,18,53,16,38,35,34,2,17,17,51,
+4,200,253,208,200,127,142,130,138,91,119,102,97,55,54,49,91,212,216,121,168,
+60,56,169,124,216,212,91,49,54,55,97,104,117,91,138,130,142,127,200,145,2,
+35,1,107,1,31,220,254,187,129,254,159,75,113,127,145,45,61,63,1,83,144,1,
+127,1,51,106,128,125,109,254,207,254,127,144,254,173,63,60,46,145,128,112,
+75,1,97,129,1,65,224,254,225,254,149,253,221,0,1,0,100,0,0,4,112,5,182,0,
+58,0,0,1,33,50,54,53,52,38,35,34,6,35,32,53,53,51,21,20,22,51,50,36,51,50,
+22,21,20,6,7,22,22,21,20,6,35,34,36,35,34,6,21,21,35,53,52,33,50,22,51,50,
+54,53,52,38,35,33,21,35,17,51,1,48,1,58,210,148,110,130,55,245,80,255,0,160,
+55,41,49,1,24,73,179,199,86,99,104,81,199,179,69,254,231,52,41,55,160,1,0,
+84,244,52,130,110,150,208,254,198,154,154,3,36,119,118,118,106,51,214,34,
+25,38,40,51,182,168,111,161,57,62,155,112,168,182,51,40,38,25,34,214,51,106,
+118,120,118,180,1,249,255,255,0,100,0,0,4,112,5,182,18,38,2,109,0,0,16,7,
+2,211,1,145,253,249,255,255,0,100,0,0,4,112,5,182,18,38,2,109,0,0,16,7,2,
+214,0,150,0,0,0,1,0,120,0,0,4,132,5,182,0,58,0,0,1,51,17,35,53,33,34,6,21,
+20,22,51,50,54,51,32,21,21,35,53,52,38,35,34,4,35,34,38,53,52,54,55,38,38,
+53,52,54,51,50,4,51,50,54,53,53,51,21,20,33,34,38,35,34,6,21,20,22,51,33,
+3,184,154,154,254,198,209,149,110,130,53,245,82,1,0,160,55,41,52,254,231,
+69,179,199,83,102,99,86,199,179,74,1,24,48,41,55,160,255,0,79,245,56,130,
+110,146,212,1,58,3,216,254,7,180,118,120,118,106,51,214,34,25,38,40,51,182,
+168,115,155,59,57,161,111,168,182,51,40,38,25,34,214,51,106,118,118,119,0,
+3,0,100,255,231,6,252,5,182,0,44,0,57,0,69,0,0,1,35,21,37,54,54,51,51,21,
+35,34,6,21,20,18,21,16,2,35,34,38,39,6,6,35,34,2,17,52,18,53,52,38,35,35,
+53,51,50,22,23,5,53,35,53,33,5,23,21,20,2,21,16,22,51,50,18,17,53,23,16,18,
+51,50,54,17,52,2,53,53,1,4,200,200,1,143,100,113,55,97,55,54,49,91,212,216,
+124,168,57,60,166,123,216,212,91,49,54,55,97,72,133,67,1,139,200,2,48,252,
+217,1,91,138,130,143,126,160,126,143,131,137,91,254,66,5,44,195,236,59,38,
+145,45,61,63,254,173,144,254,127,254,207,108,126,128,106,1,49,1,129,144,1,
+83,63,60,46,145,58,39,233,192,138,222,9,9,75,254,159,129,254,189,222,1,32,
+1,106,213,213,254,149,254,225,222,1,67,129,1,97,75,14,255,0,0,0,3,0,100,0,
+0,6,252,5,207,0,44,0,57,0,69,0,0,33,33,53,51,53,5,6,6,35,35,53,51,50,54,53,
+52,2,53,16,18,51,50,22,23,54,54,51,50,18,17,20,2,21,20,22,51,51,21,35,34,
+38,39,37,21,51,1,16,2,35,34,6,17,20,18,21,21,7,1,5,53,52,18,53,16,38,35,34,
+2,17,21,4,200,253,208,200,254,117,67,133,72,97,55,54,49,91,212,216,121,168,
+60,56,169,124,216,212,91,49,54,55,97,53,113,102,254,113,200,254,152,127,142,
+130,138,91,1,1,191,2,94,91,138,130,142,127,138,192,233,39,58,145,45,61,63,
+1,83,144,1,127,1,51,106,128,125,109,254,207,254,127,144,254,173,63,60,46,
+145,37,60,236,195,2,42,1,107,1,31,220,254,187,129,254,159,75,9,9,1,1,253,
+14,75,1,97,129,1,65,224,254,225,254,149,210,0,0,3,0,100,0,0,4,112,5,182,0,
+42,0,53,0,64,0,0,1,51,3,38,53,53,51,21,20,22,51,50,36,51,50,22,21,20,6,7,
+22,22,21,20,6,35,34,36,35,34,6,21,21,35,53,52,55,19,35,21,35,17,51,1,3,22,
+22,51,50,54,53,52,38,35,3,19,51,50,54,53,52,38,35,34,6,1,8,191,214,141,160,
+55,41,49,1,24,73,179,199,86,99,104,81,199,179,69,254,231,52,41,55,160,140,
+215,191,154,154,1,94,207,50,225,54,130,110,150,208,211,207,4,210,148,110,
+130,54,225,3,36,1,168,43,157,34,25,38,40,51,182,168,111,161,57,62,155,112,
+168,182,51,40,38,25,34,156,43,1,170,180,1,249,254,187,254,99,3,46,106,118,
+120,118,2,45,254,100,119,118,118,106,46,255,255,0,100,0,0,4,112,5,182,18,
+38,2,115,0,0,16,7,2,211,2,52,253,249,255,255,0,100,0,0,4,112,5,182,18,38,
+2,115,0,0,16,7,2,214,1,82,0,0,0,3,0,120,0,0,4,132,5,182,0,42,0,53,0,64,0,
+0,1,20,7,3,51,53,51,17,35,53,35,19,22,21,21,35,53,52,38,35,34,4,35,34,38,
+53,52,54,55,38,38,53,52,54,51,50,4,51,50,54,53,53,51,1,34,6,21,20,22,51,50,
+54,55,3,19,38,38,35,34,6,21,20,22,51,51,4,132,141,214,191,154,154,191,215,
+140,160,55,41,52,254,231,69,179,199,83,102,99,86,199,179,74,1,24,48,41,55,
+160,253,250,209,149,110,130,52,229,48,207,207,48,229,52,130,110,146,212,4,
+5,148,157,43,254,88,180,254,7,180,254,86,43,156,34,25,38,40,51,182,168,115,
+155,59,57,161,111,168,182,51,40,38,25,252,221,118,120,118,106,46,3,1,157,
+2,45,3,46,106,118,118,119,0,0,1,0,80,0,0,4,86,5,182,0,15,0,0,1,1,35,53,1,
+1,53,51,1,1,51,21,1,1,21,35,2,83,254,166,169,1,168,254,88,169,1,90,1,90,169,
+254,87,1,169,169,2,67,253,189,20,2,199,2,199,20,253,188,2,68,20,253,57,253,
+57,20,0,1,0,80,0,0,2,170,2,88,0,11,0,0,51,19,3,51,23,55,51,3,19,35,39,7,80,
+223,223,157,144,144,157,223,223,155,146,146,1,44,1,44,195,195,254,212,254,
+212,196,196,255,255,0,80,0,0,6,196,5,207,16,38,1,90,0,0,16,7,0,117,2,148,
+0,0,255,255,0,100,0,0,8,248,5,207,16,38,1,159,0,0,16,7,0,147,4,116,0,0,255,
+255,0,100,0,0,11,70,5,207,16,38,1,160,0,0,16,7,0,149,6,174,0,0,255,255,0,
+100,0,0,11,70,7,100,16,38,1,160,0,0,16,39,0,149,6,174,0,0,16,7,2,212,7,155,
+0,0,0,4,0,100,255,231,9,102,5,207,0,18,0,58,0,69,0,80,0,0,1,22,22,51,50,54,
+54,53,17,51,17,20,14,2,35,34,38,3,1,20,6,35,34,38,53,53,33,34,38,53,52,54,
+51,50,22,21,20,7,51,38,53,52,54,51,50,22,21,20,7,51,21,20,22,51,50,53,53,
+51,36,54,53,52,35,34,6,21,20,22,51,32,54,53,52,35,34,6,21,20,22,51,6,2,14,
+155,185,126,153,75,160,58,112,196,148,253,250,13,1,34,124,127,118,116,252,
+216,131,142,140,102,104,135,34,137,22,140,102,104,135,34,216,46,49,102,144,
+253,48,52,94,42,56,56,42,253,248,52,94,42,56,56,42,1,204,195,145,97,198,218,
+3,61,252,250,242,232,149,90,228,1,1,1,213,142,127,137,157,71,124,119,91,128,
+125,94,68,45,47,66,91,128,125,94,68,45,164,105,96,139,31,197,57,42,101,55,
+44,42,59,57,42,101,55,44,42,59,255,255,0,100,255,231,9,132,7,100,18,38,2,
+125,0,0,16,7,2,212,7,102,0,0,255,255,0,100,255,231,11,70,5,207,16,38,1,160,
+0,0,16,7,0,154,6,174,0,0,255,255,0,100,255,231,11,70,7,100,16,38,1,160,0,
+0,16,39,0,154,6,174,0,0,16,7,2,212,5,230,0,0,255,255,0,80,0,0,5,102,5,207,
+16,38,1,177,0,0,16,7,2,213,3,72,0,0,255,255,0,100,0,0,5,202,5,207,16,38,1,
+178,0,0,16,7,2,213,3,172,0,0,255,255,0,100,0,0,5,202,7,100,16,38,1,178,0,
+0,16,39,2,213,3,172,0,0,16,6,2,212,147,0,255,255,0,80,255,231,5,102,5,182,
+16,38,1,180,0,0,16,7,2,213,3,72,0,0,255,255,0,80,255,231,5,102,7,100,16,38,
+1,180,0,0,16,39,2,213,3,72,0,0,16,7,2,212,2,14,0,0,255,255,0,100,255,231,
+5,182,5,182,16,38,1,182,0,0,16,7,2,213,3,152,0,0,255,255,0,100,255,231,5,
+182,7,100,16,38,1,182,0,0,16,39,2,213,3,152,0,0,16,6,2,212,129,0,0,1,0,80,
+2,188,3,66,5,182,0,19,0,0,19,33,53,51,21,33,21,33,21,33,21,33,21,35,53,33,
+53,33,53,33,80,1,44,154,1,44,254,212,1,44,254,212,154,254,212,1,44,254,212,
+5,13,169,169,138,162,138,155,155,138,162,0,2,0,80,3,87,3,66,5,13,0,3,0,7,
+0,0,19,33,21,33,21,33,21,33,80,2,242,253,14,2,242,253,14,5,13,138,162,138,
+255,255,0,117,255,235,5,137,7,212,18,38,0,15,0,0,16,7,2,208,255,73,255,226,
+255,255,0,80,255,235,5,153,7,212,18,38,0,20,0,0,16,7,2,208,2,237,255,226,
+255,255,0,80,255,235,5,117,7,172,18,38,0,20,0,0,16,39,2,212,3,87,0,0,16,7,
+2,208,0,159,255,186,255,255,0,50,255,235,6,247,7,212,16,39,2,213,255,6,0,
+0,16,39,0,20,1,94,0,0,16,7,2,208,4,75,255,226,255,255,0,75,255,235,5,97,7,
+212,18,38,0,61,0,0,16,7,2,208,255,31,255,226,255,255,0,80,255,235,5,79,7,
+212,18,38,0,66,0,0,16,7,2,208,2,163,255,226,255,255,0,50,255,235,6,31,7,212,
+16,39,0,61,0,190,0,0,16,39,2,213,255,6,0,0,16,6,2,208,221,226,255,255,0,140,
+0,0,5,16,7,242,18,38,0,95,0,0,16,7,2,208,1,99,0,0,255,255,0,35,255,231,4,
+68,7,242,18,38,0,124,0,0,16,7,2,208,254,247,0,0,255,255,0,50,255,231,5,152,
+7,242,16,39,0,124,1,84,0,0,16,39,2,213,255,6,0,0,16,6,2,208,75,0,255,255,
+0,35,0,0,4,87,7,242,18,38,0,180,0,0,16,7,2,208,254,247,0,0,255,255,0,100,
+0,0,6,196,6,93,18,38,0,206,0,0,16,7,2,208,2,213,254,107,255,255,0,120,0,0,
+6,216,6,93,18,38,0,209,0,0,16,7,2,208,0,143,254,107,255,255,0,120,0,0,6,176,
+6,93,18,38,0,228,0,0,16,7,2,208,0,143,254,107,255,255,0,120,0,0,4,123,7,242,
+18,38,0,251,0,0,16,7,2,208,1,207,0,0,255,255,0,35,0,0,4,38,7,242,18,38,0,
+254,0,0,16,7,2,208,254,247,0,0,255,255,0,120,255,221,7,105,6,93,18,38,1,29,
+0,0,16,7,2,208,1,252,254,107,255,255,0,120,255,221,7,105,6,93,18,38,1,31,
+0,0,16,7,2,208,1,252,254,107,255,255,0,50,255,221,8,149,6,93,16,39,1,29,1,
+44,0,0,16,39,2,213,255,6,0,0,16,7,2,208,3,40,254,107,255,255,0,80,255,231,
+4,112,7,242,18,38,1,52,0,0,16,7,2,208,1,196,0,0,255,255,0,15,255,231,4,47,
+7,242,18,38,1,55,0,0,16,7,2,208,254,227,0,0,255,255,0,100,0,0,4,28,7,242,
+18,38,1,85,0,0,16,7,2,208,0,250,0,0,255,255,0,50,255,231,8,44,4,1,16,39,0,
+204,1,84,0,0,16,7,2,213,255,6,0,0,255,255,0,120,255,231,8,94,4,1,16,38,0,
+204,0,0,16,7,2,213,6,64,0,0,255,255,0,50,255,231,8,44,5,207,16,39,0,204,1,
+84,0,0,16,39,2,212,2,211,254,107,16,7,2,213,255,6,0,0,255,255,0,120,255,231,
+8,94,5,207,16,38,0,204,0,0,16,39,2,212,1,127,254,107,16,7,2,213,6,64,0,0,
+255,255,0,100,0,0,6,196,4,26,18,38,0,206,0,0,16,7,2,213,255,101,0,0,255,255,
+0,100,0,0,8,94,4,26,16,38,0,206,0,0,16,7,2,213,6,64,0,0,255,255,0,100,0,0,
+6,196,5,207,18,38,0,206,0,0,16,39,2,212,3,22,254,107,16,7,2,213,255,101,0,
+0,255,255,0,100,0,0,8,94,5,207,16,38,0,206,0,0,16,39,2,212,3,22,254,107,16,
+7,2,213,6,64,0,0,255,255,0,50,255,231,7,220,4,1,16,39,1,77,1,44,0,0,16,7,
+2,213,255,6,0,0,255,255,0,50,0,0,7,240,4,26,16,39,1,80,1,44,0,0,16,7,2,213,
+255,6,0,0,255,255,0,50,0,0,7,240,5,207,16,39,1,80,1,44,0,0,16,39,2,212,2,
+28,254,107,16,7,2,213,255,6,0,0,255,255,0,50,0,0,5,112,5,182,16,39,1,82,1,
+44,0,0,16,7,2,213,255,6,0,0,255,255,0,50,0,0,5,112,7,100,16,39,1,82,1,44,
+0,0,16,39,2,212,1,54,0,0,16,7,2,213,255,6,0,0,255,255,0,50,0,0,5,72,5,182,
+16,39,1,85,1,44,0,0,16,7,2,213,255,6,0,0,0,1,0,50,2,188,3,49,5,217,0,8,0,
+0,1,21,35,3,3,35,53,1,51,3,49,175,209,208,175,1,105,45,2,213,25,1,232,254,
+24,25,3,4,0,1,0,100,2,188,3,33,5,197,0,19,0,0,1,17,52,38,38,35,34,6,6,21,
+17,35,17,52,54,51,50,22,21,17,2,135,39,84,74,78,84,34,154,162,188,170,181,
+2,188,1,53,146,120,64,61,116,153,254,203,1,83,240,198,198,240,254,173,0,0,
+2,0,120,2,188,2,209,5,197,0,13,0,24,0,0,19,17,52,54,51,50,22,21,20,6,35,34,
+39,21,18,6,21,20,22,51,50,53,52,38,35,120,153,147,128,173,166,133,92,56,74,
+74,81,65,147,83,64,2,188,1,180,164,177,159,123,126,155,35,249,2,127,70,80,
+62,77,148,72,69,0,1,0,120,2,188,2,209,5,197,0,17,0,0,1,35,17,52,54,51,50,
+22,21,21,35,53,52,38,35,34,6,21,1,18,154,153,147,141,160,154,76,71,74,72,
+2,188,1,180,164,177,171,157,52,45,97,100,99,123,0,1,0,80,2,188,2,134,5,182,
+0,5,0,0,19,33,21,33,17,35,80,2,54,254,100,154,5,182,138,253,144,0,0,2,0,80,
+3,22,4,112,5,182,0,13,0,25,0,0,0,38,53,52,54,51,33,21,33,22,21,20,6,35,2,
+6,21,20,22,51,50,54,53,52,38,35,1,13,189,185,132,2,227,254,46,63,188,138,
+72,101,98,75,75,97,99,73,3,22,192,137,137,206,138,88,117,137,192,2,5,111,
+80,79,109,109,79,79,112,0,0,1,0,80,2,188,2,128,5,182,0,14,0,0,1,21,20,6,35,
+35,17,35,17,51,50,54,54,53,53,2,128,179,195,32,154,116,134,107,49,5,182,108,
+201,189,254,248,1,146,50,117,108,85,0,1,0,80,2,252,4,176,5,220,0,34,0,0,1,
+38,38,53,52,54,51,50,22,18,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,
+38,2,38,35,34,21,20,22,23,1,11,88,99,136,108,95,165,194,121,54,41,52,62,48,
+77,85,102,139,105,100,178,191,111,49,93,62,48,2,252,73,213,121,137,169,129,
+254,208,121,85,89,88,145,48,122,66,221,117,138,173,149,1,45,104,172,82,156,
+43,0,255,255,0,50,2,188,4,31,5,227,16,38,0,40,120,0,16,7,2,212,255,6,254,
+107,255,255,0,50,2,188,4,31,5,227,16,38,0,40,0,0,16,7,2,212,2,1,254,107,0,
+2,1,44,6,114,2,172,7,242,0,11,0,23,0,0,0,22,21,20,6,35,34,38,53,52,54,51,
+18,54,53,52,38,35,34,6,21,20,22,51,2,60,112,113,79,80,112,113,79,43,57,58,
+42,41,59,58,42,7,242,113,79,80,112,113,79,80,112,254,220,59,41,42,58,58,42,
+42,58,0,0,1,1,44,6,114,2,30,7,100,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,
+51,1,215,71,71,50,50,71,71,50,7,100,71,50,50,71,71,50,50,71,0,255,255,0,100,
+255,231,8,84,4,1,16,38,1,77,0,0,16,7,2,213,6,54,0,0,255,255,0,100,0,0,4,68,
+7,100,18,38,1,84,0,0,16,7,2,212,255,56,0,0,255,255,0,100,0,0,4,68,7,100,18,
+38,1,87,0,0,16,7,2,212,2,38,0,0,255,255,0,140,255,231,7,70,5,207,16,38,1,
+104,0,0,16,7,2,213,5,40,0,0,255,255,0,120,0,0,6,222,5,182,16,38,1,112,0,0,
+16,7,2,213,4,192,0,0,255,255,0,140,255,231,7,70,5,182,16,38,1,117,0,0,16,
+7,2,213,5,40,0,0,255,255,0,100,0,0,4,232,7,100,18,38,1,119,0,0,16,7,2,212,
+0,145,0,0,255,255,0,140,0,0,5,16,7,100,18,38,1,120,0,0,16,7,2,212,1,152,0,
+0,255,255,0,120,0,0,5,226,5,207,16,38,1,144,0,0,16,7,2,213,3,196,0,0,255,
+255,0,120,255,231,4,48,7,100,18,38,1,146,0,0,16,7,2,212,0,230,0,0,255,255,
+0,120,0,0,5,226,5,207,16,38,1,161,0,0,16,7,2,213,3,196,0,0,255,255,0,120,
+255,231,4,88,7,100,18,38,1,163,0,0,16,7,2,212,2,58,0,0,255,255,0,80,0,0,5,
+18,7,100,18,38,1,204,0,0,16,7,2,212,2,244,0,0,255,255,0,140,255,231,8,80,
+5,182,16,38,1,249,0,0,16,7,2,213,6,50,0,0,255,255,0,100,0,0,4,22,7,100,18,
+38,1,251,0,0,16,6,2,212,65,0,255,255,0,120,0,0,4,42,7,100,18,38,1,254,0,0,
+16,7,2,212,1,3,0,0,255,255,0,120,0,0,5,146,5,182,16,38,1,254,0,0,16,7,2,213,
+3,116,0,0,255,255,0,120,255,231,4,96,7,100,18,38,2,31,0,0,16,7,2,212,0,226,
+0,0,255,255,0,140,255,236,8,96,4,26,16,38,2,37,0,0,16,7,2,213,6,66,0,0,0,
+1,0,100,2,188,0,254,5,182,0,3,0,0,19,51,17,35,100,154,154,5,182,253,6,0,0,
+1,0,100,2,188,2,45,5,192,0,14,0,0,1,38,35,34,6,21,17,35,17,51,21,54,51,50,
+23,1,243,35,54,73,83,154,154,68,88,83,64,5,25,29,168,136,254,182,2,250,58,
+68,30,0,0,1,0,80,2,173,2,139,5,197,0,28,0,0,18,4,22,21,20,33,34,39,53,22,
+51,50,54,53,52,36,38,53,52,54,51,50,23,21,38,35,34,6,21,234,1,34,127,254,
+191,131,81,89,112,107,71,254,219,124,166,155,131,81,89,92,114,84,4,164,78,
+107,78,240,11,141,14,43,50,56,80,113,84,109,119,11,141,14,44,47,0,2,1,44,
+6,114,2,172,7,242,0,11,0,23,0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,
+52,38,35,34,6,21,20,22,51,2,60,112,113,79,80,112,113,79,43,57,58,42,41,59,
+58,42,7,242,113,79,80,112,113,79,80,112,254,220,59,41,42,58,58,42,42,58,0,
+0,2,0,140,6,114,3,104,7,100,0,11,0,23,0,0,0,22,21,20,6,35,34,38,53,52,54,
+51,32,22,21,20,6,35,34,38,53,52,54,51,1,55,71,71,50,50,71,71,50,2,28,71,71,
+50,50,71,71,50,7,100,71,50,50,71,71,50,50,71,71,50,50,71,71,50,50,71,0,2,
+1,44,1,39,2,30,4,173,0,11,0,23,0,0,0,38,53,52,54,51,50,22,21,20,6,35,2,38,
+53,52,54,51,50,22,21,20,6,35,1,115,71,71,50,50,71,71,50,50,71,71,50,50,71,
+71,50,3,187,71,50,50,71,71,50,50,71,253,108,71,50,50,71,71,50,50,71,0,0,1,
+0,100,4,12,0,254,5,182,0,3,0,0,19,17,51,17,100,154,4,12,1,170,254,86,0,1,
+1,44,6,114,2,30,7,100,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,1,215,71,
+71,50,50,71,71,50,7,100,71,50,50,71,71,50,50,71,0,0,1,1,44,2,113,2,30,3,99,
+0,11,0,0,0,38,53,52,54,51,50,22,21,20,6,35,1,115,71,71,50,50,71,71,50,2,113,
+71,50,50,71,71,50,50,71,0,0,1,0,231,2,29,2,99,3,153,0,11,0,0,0,38,53,52,54,
+51,50,22,21,20,6,35,1,86,111,110,80,79,111,110,80,2,29,110,80,79,111,110,
+80,79,111,0,0,1,0,120,0,0,4,241,5,182,0,31,0,0,1,32,22,21,20,6,33,35,34,6,
+21,20,22,51,33,21,33,32,38,53,52,54,33,51,50,54,53,52,38,35,33,53,2,234,1,
+14,249,248,254,234,102,194,163,172,189,2,12,253,240,254,244,249,249,1,19,
+102,194,165,172,191,253,246,5,182,198,202,205,197,126,137,129,123,145,196,
+204,207,198,122,138,129,123,145,255,255,0,120,0,0,4,241,7,100,18,38,2,215,
+0,0,16,7,2,212,1,14,0,0,0,1,0,120,0,0,4,241,5,182,0,31,0,0,1,21,33,34,6,21,
+20,22,51,51,32,22,21,20,6,33,33,53,33,50,54,53,52,38,35,35,32,38,53,52,54,
+33,4,141,253,246,190,173,166,193,102,1,19,249,250,254,245,253,240,2,12,190,
+171,165,192,102,254,234,248,250,1,13,5,182,145,123,129,138,122,198,207,204,
+196,145,123,129,138,125,197,205,202,198,255,255,0,120,0,0,4,241,7,100,18,
+38,2,217,0,0,16,7,2,212,1,14,0,0,255,255,0,50,0,0,6,29,5,182,16,39,2,215,
+1,44,0,0,16,7,2,213,255,6,0,0,255,255,0,120,0,0,6,99,5,182,16,38,2,215,0,
+0,16,7,2,213,4,69,0,0,255,255,0,50,0,0,6,29,7,100,16,39,2,215,1,44,0,0,16,
+39,2,212,2,58,0,0,16,7,2,213,255,6,0,0,255,255,0,120,0,0,6,99,7,100,16,38,
+2,215,0,0,16,39,2,212,1,14,0,0,16,7,2,213,4,69,0,0,255,255,0,50,0,0,6,29,
+5,182,16,39,2,217,1,44,0,0,16,7,2,213,255,6,0,0,255,255,0,120,0,0,6,99,5,
+182,16,38,2,217,0,0,16,7,2,213,4,69,0,0,255,255,0,50,0,0,6,29,7,100,16,39,
+2,217,1,44,0,0,16,39,2,213,255,6,0,0,16,7,2,212,2,58,0,0,255,255,0,120,0,
+0,6,99,7,100,16,38,2,217,0,0,16,39,2,213,4,69,0,0,16,7,2,212,1,14,0,0,0,3,
+0,100,2,181,4,54,5,207,0,23,0,34,0,45,0,0,1,50,22,21,20,6,35,34,38,53,52,
+55,33,34,38,53,52,54,51,50,22,21,20,7,38,54,53,52,35,34,6,21,20,22,51,4,6,
+21,20,51,50,54,53,52,38,35,3,37,131,142,140,102,104,135,34,254,254,131,142,
+140,102,104,135,34,163,52,94,42,56,56,42,1,196,52,94,42,56,56,42,4,131,124,
+119,91,128,125,94,68,45,124,119,91,128,125,94,68,45,2,57,42,101,55,44,42,
+59,134,57,42,101,55,44,42,59,0,255,255,0,120,0,0,4,241,7,212,18,38,2,215,
+0,0,16,7,2,208,0,220,255,226,255,255,0,120,0,0,4,241,7,212,18,38,2,217,0,
+0,16,7,2,208,0,200,255,226,255,255,0,50,0,0,6,29,7,212,16,39,2,215,1,44,0,
+0,16,39,2,213,255,6,0,0,16,7,2,208,2,8,255,226,0,1,0,160,5,0,1,117,5,229,
+0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,1,60,57,63,44,45,61,61,45,5,229,
+60,54,58,57,56,59,59,55,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,
+4,9,0,1,0,58,0,94,0,3,0,1,4,9,0,2,0,14,0,152,0,3,0,1,4,9,0,3,0,96,0,166,0,
+3,0,1,4,9,0,4,0,58,0,94,0,3,0,1,4,9,0,5,0,30,1,6,0,3,0,1,4,9,0,6,0,52,1,36,
+0,3,0,1,4,9,0,7,0,68,1,88,0,3,0,1,4,9,0,8,0,42,1,156,0,3,0,1,4,9,0,9,0,40,
+1,198,0,3,0,1,4,9,0,10,0,96,1,238,0,3,0,1,4,9,0,11,0,62,2,78,0,3,0,1,4,9,
+0,12,0,60,2,140,0,3,0,1,4,9,0,13,2,150,2,200,0,3,0,1,4,9,0,14,0,52,5,94,0,
+67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,
+51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,
+0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,
+0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,
+0,97,0,110,0,115,0,32,0,67,0,97,0,110,0,97,0,100,0,105,0,97,0,110,0,32,0,
+65,0,98,0,111,0,114,0,105,0,103,0,105,0,110,0,97,0,108,0,82,0,101,0,103,0,
+117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,67,0,97,0,110,0,97,0,100,0,105,0,97,
+0,110,0,32,0,65,0,98,0,111,0,114,0,105,0,103,0,105,0,110,0,97,0,108,0,86,
+0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,
+104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,67,0,97,0,110,0,97,0,100,
+0,105,0,97,0,110,0,65,0,98,0,111,0,114,0,105,0,103,0,105,0,110,0,97,0,108,
+0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,
+100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,
+110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,
+97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,
+0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,
+119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,
+0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,
+0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,
+0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,
+0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,
+0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,
+0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,
+0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,
+0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,
+0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,
+0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,
+0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,
+0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,
+76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,
+0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,
+0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,
+0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,
+0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,
+0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,
+0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,
+0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,
+0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,
+0,0,255,39,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,
+255,255,0,3,0,1,0,0,0,12,0,0,0,28,0,0,0,2,0,2,0,0,2,230,0,1,2,231,2,231,0,
+3,0,4,0,0,0,1,0,0,0,1,0,0,0,10,0,44,0,46,0,2,68,70,76,84,0,24,99,97,110,115,
+0,14,0,4,0,0,0,0,255,255,0,0,0,4,0,0,0,0,255,255,0,0,0,0,0,0,0,1,0,0,0,10,
+0,48,0,74,0,2,68,70,76,84,0,26,99,97,110,115,0,14,0,4,0,0,0,0,255,255,0,1,
+0,0,0,4,0,0,0,0,255,255,0,1,0,1,0,2,115,97,108,116,0,14,115,97,108,116,0,
+20,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,4,0,1,0,0,0,1,0,8,0,2,0,38,0,16,2,215,2,
+216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,
+2,229,2,230,0,2,0,4,1,29,1,32,0,0,1,39,1,46,0,4,1,159,1,159,0,12,2,154,2,
+156,0,13,};
+#endif
@@ -0,0 +1,266 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansCarian_Regular_ttf_size = 6260;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansCarian_Regular_ttf");
+asm(".type fz_font_NotoSansCarian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansCarian_Regular_ttf, 6260");
+asm(".balign 64");
+asm("fz_font_NotoSansCarian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansCarian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansCarian_Regular_ttf_size = 6260;
+const char fz_font_NotoSansCarian_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,122,231,111,200,0,0,1,56,0,0,0,96,
+99,109,97,112,0,219,5,91,0,0,2,108,0,0,0,172,103,97,115,112,0,8,0,22,0,0,
+24,104,0,0,0,12,103,108,121,102,243,110,2,31,0,0,3,132,0,0,14,196,104,101,
+97,100,4,237,195,216,0,0,0,188,0,0,0,54,104,104,101,97,15,234,5,89,0,0,0,
+244,0,0,0,36,104,109,116,120,24,15,21,226,0,0,1,152,0,0,0,212,108,111,99,
+97,90,211,94,179,0,0,3,24,0,0,0,108,109,97,120,112,0,59,0,45,0,0,1,24,0,0,
+0,32,110,97,109,101,140,51,184,116,0,0,18,72,0,0,6,0,112,111,115,116,255,
+105,0,102,0,0,24,72,0,0,0,32,0,1,0,0,0,1,12,205,56,160,244,19,95,15,60,245,
+0,11,8,0,0,0,0,0,204,74,160,112,0,0,0,0,210,40,203,228,0,0,255,236,7,91,5,
+205,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,7,121,0,0,0,2,7,91,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,1,0,0,0,53,0,44,0,5,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,98,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,
+0,0,0,2,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,2,88,0,
+0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,0,4,0,0,102,0,0,0,0,4,20,0,0,2,20,0,0,
+5,29,0,0,5,52,0,200,5,14,0,125,4,204,0,60,4,153,0,200,4,153,0,200,4,1,0,100,
+5,238,0,200,6,64,0,125,4,153,0,200,6,39,0,200,6,63,0,125,5,176,0,200,5,168,
+0,125,4,240,0,125,4,240,0,200,7,121,0,30,4,132,0,30,4,215,0,40,5,172,0,125,
+4,180,0,10,5,99,0,40,6,52,0,70,7,121,0,30,6,64,0,125,4,202,0,125,4,188,0,
+140,4,188,0,140,4,204,0,60,4,182,0,60,5,81,0,20,7,88,0,200,4,240,0,40,4,240,
+0,40,6,8,0,80,5,44,0,125,6,97,0,20,7,60,0,200,6,91,0,60,5,121,0,40,5,232,
+0,200,5,35,0,125,6,9,0,80,6,9,0,80,4,219,0,160,5,147,0,200,5,67,0,20,5,238,
+0,200,5,242,0,200,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,
+0,12,0,8,0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,0,
+160,254,255,255,255,0,1,255,245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,12,0,0,0,0,0,88,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,
+0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,
+0,254,255,0,0,254,255,0,0,0,1,0,1,2,160,0,1,2,208,0,0,0,4,0,0,0,20,0,20,0,
+20,0,20,0,53,0,108,0,152,0,184,0,217,0,243,1,11,1,40,1,107,1,126,1,158,1,
+208,1,241,2,35,2,70,2,112,2,160,2,178,2,201,3,3,3,33,3,65,3,119,3,170,3,226,
+4,9,4,31,4,58,4,88,4,117,4,156,4,180,4,213,4,244,5,45,5,108,5,152,5,186,5,
+232,6,3,6,31,6,89,6,137,6,185,6,235,7,12,7,45,7,68,7,98,0,2,0,102,0,0,3,154,
+5,182,0,3,0,7,0,0,51,17,33,17,37,33,17,33,102,3,52,253,47,2,110,253,146,5,
+182,250,74,98,4,242,0,2,0,0,0,0,5,27,5,188,0,7,0,13,0,0,33,3,33,3,35,1,51,
+1,1,3,39,6,7,3,4,92,176,253,188,174,186,2,59,166,2,58,254,90,164,70,35,28,
+166,1,201,254,55,5,188,250,68,2,104,1,187,219,139,80,254,69,0,3,0,200,0,0,
+4,198,5,182,0,15,0,24,0,33,0,0,19,33,32,4,21,20,6,7,21,22,22,21,20,4,35,33,
+19,33,50,54,53,52,38,35,35,17,33,50,54,53,52,38,35,33,200,1,161,1,38,1,5,
+142,136,169,159,254,244,240,253,254,184,1,14,174,154,171,185,242,1,39,174,
+172,176,184,254,231,5,182,175,187,130,169,25,10,29,176,145,196,220,3,73,110,
+128,120,105,251,134,134,138,129,126,0,0,1,0,125,255,236,4,207,5,203,0,23,
+0,0,1,34,0,17,16,0,51,50,55,21,6,6,35,32,0,17,52,18,36,51,50,23,7,38,3,57,
+236,254,242,1,6,242,156,195,93,172,112,254,189,254,163,167,1,63,216,232,172,
+74,175,5,41,254,196,254,238,254,229,254,205,58,160,34,25,1,137,1,104,226,
+1,84,184,86,156,80,0,2,0,60,0,0,4,144,5,182,0,5,0,12,0,0,55,1,51,1,21,33,
+1,6,7,1,33,1,38,60,1,205,184,1,207,251,172,2,39,51,43,254,250,2,200,254,254,
+67,113,5,69,250,185,111,4,238,200,130,252,250,2,254,200,0,0,1,0,200,255,236,
+4,53,5,182,0,14,0,0,1,5,7,37,17,5,7,37,17,5,7,37,21,35,17,1,128,2,181,35,
+253,110,2,16,35,254,19,2,181,35,253,110,184,5,182,157,158,149,254,101,118,
+158,110,254,88,157,158,149,129,5,182,0,0,1,0,200,0,0,4,53,5,182,0,10,0,0,
+1,5,7,37,17,5,7,37,17,35,17,1,128,2,181,35,253,110,2,16,35,254,19,184,5,182,
+157,158,149,254,101,118,158,110,253,49,5,182,0,1,0,100,0,0,3,157,5,182,0,
+11,0,0,37,33,21,33,53,33,17,33,53,33,21,33,2,92,1,65,252,199,1,64,254,192,
+3,57,254,191,158,158,158,4,122,158,158,0,0,3,0,200,0,0,5,38,5,182,0,3,0,7,
+0,11,0,0,33,33,17,33,1,33,17,33,37,17,33,17,5,38,251,162,4,94,252,90,2,238,
+253,18,2,238,253,18,5,182,250,232,2,15,156,1,207,254,49,0,0,5,0,125,255,236,
+5,195,5,205,0,11,0,16,0,21,0,26,0,31,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,
+54,18,55,33,33,22,18,23,17,37,38,38,39,17,3,6,6,7,33,5,195,254,157,254,193,
+254,189,254,159,1,95,1,71,1,62,1,98,253,185,181,202,10,254,119,253,190,8,
+202,184,2,61,19,197,173,184,172,200,18,1,134,2,221,254,161,254,110,1,139,
+1,104,1,101,1,137,254,113,252,77,26,1,20,244,237,254,231,27,2,33,156,212,
+245,25,254,30,1,225,25,248,208,0,1,0,200,0,0,4,53,5,182,0,6,0,0,1,5,7,37,
+17,35,17,1,128,2,181,35,253,110,184,5,182,157,158,149,250,240,5,182,0,1,0,
+200,0,0,5,95,5,182,0,16,0,0,1,35,1,35,22,21,17,35,17,51,1,51,38,2,53,17,51,
+5,95,185,252,209,8,17,184,187,3,42,8,2,12,184,1,124,3,76,204,213,252,217,
+5,182,252,174,24,1,75,60,1,179,0,2,0,125,255,236,5,195,5,205,0,11,0,23,0,
+0,1,16,0,33,32,0,17,16,0,33,32,0,1,16,18,51,50,18,17,16,2,35,34,2,5,195,254,
+157,254,193,254,189,254,159,1,95,1,71,1,62,1,98,251,124,246,236,235,244,242,
+235,238,246,2,221,254,161,254,110,1,139,1,104,1,101,1,137,254,113,254,159,
+254,222,254,208,1,44,1,38,1,37,1,41,254,211,0,1,0,200,0,0,5,76,5,205,0,17,
+0,0,1,53,52,38,35,34,6,21,17,35,17,52,36,33,32,0,17,21,4,148,219,209,194,
+166,184,1,28,1,4,1,42,1,58,3,62,43,223,227,179,191,252,71,3,232,230,255,254,
+211,254,201,43,0,0,2,0,125,0,0,5,43,5,205,0,16,0,28,0,0,1,20,0,7,17,35,17,
+46,2,53,52,54,36,51,32,0,1,20,22,51,50,54,53,52,38,35,34,6,5,43,254,240,237,
+180,157,232,120,144,1,16,184,1,23,1,63,252,20,207,196,196,211,204,200,200,
+206,3,162,236,254,220,23,254,133,1,123,15,146,239,152,165,253,136,254,215,
+254,254,193,200,198,195,190,203,202,0,0,2,0,125,0,0,4,40,5,182,0,11,0,20,
+0,0,33,35,17,35,32,36,53,16,33,51,53,51,3,35,34,6,21,20,22,51,51,4,40,184,
+166,254,227,254,208,2,46,197,184,184,182,196,183,192,222,147,1,59,232,225,
+1,181,253,254,101,135,144,157,142,0,0,2,0,200,0,0,4,115,5,182,0,13,0,22,0,
+0,1,32,17,20,6,4,35,35,1,7,1,17,35,17,19,51,50,54,53,52,38,35,35,2,75,2,40,
+133,254,250,192,136,1,158,95,254,161,184,184,147,218,196,182,193,186,5,182,
+254,82,145,207,112,254,209,130,1,1,254,120,5,182,253,32,141,156,141,140,0,
+0,1,0,30,0,0,7,91,5,182,0,24,0,0,33,35,3,38,39,6,7,1,35,3,38,39,6,7,3,35,
+1,51,1,22,23,54,55,1,51,7,91,195,223,55,16,28,52,254,247,198,254,56,22,22,
+48,224,195,1,131,191,1,15,58,12,11,63,1,24,191,3,118,212,138,179,173,252,
+140,3,109,195,164,156,192,252,136,5,182,252,78,208,87,75,214,3,184,0,0,1,
+0,30,0,0,4,102,5,182,0,7,0,0,33,35,17,33,53,33,21,33,2,159,184,254,55,4,72,
+254,57,5,24,158,158,0,0,1,0,40,0,0,4,175,5,182,0,8,0,0,1,1,51,1,17,35,17,
+1,51,2,108,1,125,198,254,24,184,254,25,201,2,231,2,207,252,129,253,201,2,
+47,3,135,0,3,0,125,0,0,5,47,5,182,0,18,0,25,0,32,0,0,1,20,0,7,21,35,53,46,
+2,53,52,0,55,53,51,21,22,0,5,20,22,23,17,6,6,5,52,38,39,17,54,54,5,47,254,
+243,240,184,157,232,120,1,14,239,184,237,1,16,252,12,161,158,153,166,3,54,
+165,154,157,162,2,238,231,254,219,26,200,199,15,146,239,152,231,1,37,25,162,
+162,23,254,219,234,166,205,23,3,19,22,200,171,167,204,22,252,238,25,205,0,
+0,1,0,10,0,0,4,170,5,182,0,11,0,0,33,35,1,1,35,1,1,51,1,1,51,1,4,170,209,
+254,125,254,119,195,1,230,254,57,205,1,102,1,105,194,254,60,2,123,253,133,
+2,250,2,188,253,195,2,61,253,72,0,1,0,40,0,0,5,59,5,182,0,14,0,0,1,17,54,
+55,19,51,1,17,35,17,1,51,19,23,17,3,13,66,72,232,188,253,210,184,253,211,
+188,246,123,5,182,253,138,123,120,1,131,252,119,253,211,2,45,3,137,254,103,
+217,2,114,0,1,0,70,0,0,5,238,5,205,0,31,0,0,33,33,53,54,18,53,52,2,35,34,
+6,21,20,18,23,21,33,53,33,38,2,53,16,0,33,32,0,17,20,2,7,33,5,238,253,178,
+177,167,243,236,234,241,165,177,253,178,1,108,148,163,1,100,1,58,1,62,1,98,
+163,147,1,107,147,127,1,71,220,246,1,0,255,247,224,254,190,128,147,158,114,
+1,91,208,1,52,1,94,254,164,254,204,208,254,162,113,0,3,0,30,0,0,7,91,5,182,
+0,10,0,17,0,24,0,0,33,33,1,51,1,22,23,54,55,1,51,7,6,7,3,33,3,38,37,6,7,3,
+33,3,38,7,91,248,195,1,131,191,1,15,58,12,11,63,1,24,191,100,28,52,218,2,
+40,183,55,252,133,22,48,184,2,28,208,56,5,182,252,78,208,87,75,214,3,184,
+226,179,173,253,42,2,216,212,138,156,192,253,38,2,207,195,0,3,0,125,255,236,
+5,195,5,205,0,11,0,18,0,25,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,54,18,17,
+16,2,39,7,6,2,17,16,18,23,5,195,254,157,254,193,254,189,254,159,1,95,1,71,
+1,62,1,98,253,184,191,207,203,195,184,193,203,202,194,2,221,254,161,254,110,
+1,139,1,104,1,101,1,137,254,113,252,69,28,1,53,1,9,1,6,1,51,29,2,31,254,205,
+254,254,254,255,254,199,31,0,3,0,125,0,0,4,2,5,182,0,8,0,12,0,16,0,0,33,35,
+32,0,17,16,0,33,51,1,18,5,17,17,4,3,33,4,2,137,254,143,254,117,1,123,1,86,
+180,253,62,26,1,240,254,41,47,2,6,1,126,1,107,1,86,1,119,252,247,254,20,33,
+2,13,2,107,12,254,61,0,0,2,0,140,2,20,4,48,5,182,0,3,0,7,0,0,1,17,33,17,19,
+33,17,33,4,48,252,92,184,2,52,253,204,5,182,252,94,3,162,252,252,2,102,0,
+0,2,0,140,0,0,4,48,5,182,0,7,0,11,0,0,1,17,33,17,35,17,33,17,19,33,17,33,
+4,48,254,138,184,254,138,184,2,52,253,204,5,182,252,94,253,236,2,20,3,162,
+252,252,2,102,0,2,0,60,0,0,4,144,5,182,0,5,0,12,0,0,33,35,1,53,33,21,5,1,
+22,23,54,55,1,2,193,184,254,51,4,84,252,113,1,4,43,51,31,67,1,0,5,69,113,
+111,47,252,250,130,200,138,200,2,254,0,0,2,0,60,0,0,4,122,5,182,0,7,0,10,
+0,0,1,1,17,35,17,1,53,33,5,1,1,4,122,254,61,184,254,61,4,62,252,166,1,59,
+1,59,5,71,253,57,253,128,2,128,2,197,113,158,254,8,1,248,0,2,0,20,255,236,
+5,61,5,182,0,6,0,13,0,0,1,1,7,1,1,39,1,19,1,7,1,1,39,1,2,241,2,76,117,253,
+224,253,225,117,2,76,145,2,76,117,253,224,253,225,117,2,76,2,183,253,167,
+114,2,44,253,212,114,2,89,2,255,253,167,114,2,44,253,212,114,2,89,0,0,1,0,
+200,0,0,6,144,5,182,0,11,0,0,33,35,17,33,17,35,17,33,17,35,17,33,6,144,184,
+254,48,184,254,48,184,5,200,5,24,250,232,5,24,250,232,5,182,0,0,3,0,40,0,
+0,4,200,5,182,0,5,0,8,0,11,0,0,33,33,1,1,33,1,1,33,1,55,1,33,4,200,251,96,
+1,230,254,57,4,94,254,60,254,111,2,67,254,225,6,1,1,253,255,2,250,2,188,253,
+72,253,160,1,221,254,1,159,0,2,0,40,0,0,4,200,5,182,0,8,0,11,0,0,33,35,1,
+1,35,1,1,33,1,39,1,33,4,200,209,254,125,254,119,195,1,230,254,57,4,94,254,
+60,103,1,1,253,255,2,123,253,133,2,250,2,188,253,72,123,1,159,0,2,0,80,255,
+236,5,184,5,202,0,13,0,27,0,0,19,4,0,17,16,0,5,39,54,18,53,52,2,39,33,6,2,
+21,20,18,23,7,36,0,17,16,0,37,113,1,29,1,40,254,209,254,234,33,218,202,209,
+211,5,104,212,208,201,219,33,254,234,254,209,1,40,1,29,5,202,62,254,126,254,
+206,254,207,254,129,60,158,64,1,28,242,244,1,36,60,60,254,219,243,241,254,
+228,65,158,60,1,127,1,49,1,50,1,130,62,0,0,2,0,125,0,0,4,175,5,182,0,21,0,
+43,0,0,1,35,34,6,6,21,20,22,22,51,51,21,35,34,38,38,53,52,54,54,51,51,3,51,
+50,54,54,53,52,38,38,35,35,53,51,50,22,22,21,20,6,6,35,35,2,164,40,99,142,
+76,76,143,98,40,46,150,230,125,125,229,151,46,28,40,99,142,76,76,143,98,40,
+46,150,230,125,125,229,151,46,5,24,82,145,93,90,145,82,158,122,220,134,136,
+219,122,250,232,82,145,93,90,145,82,158,122,220,134,136,219,122,0,0,1,0,20,
+0,0,6,77,5,182,0,17,0,0,19,1,51,1,1,51,1,7,3,1,1,35,1,1,35,1,1,3,20,1,69,
+114,1,102,1,105,110,1,69,142,235,254,196,1,231,209,254,125,254,119,195,1,
+230,254,196,231,3,183,1,255,253,195,2,61,254,1,80,1,124,254,27,253,2,2,123,
+253,133,2,250,1,228,254,137,0,0,1,0,200,0,0,6,116,5,182,0,19,0,0,33,35,17,
+33,17,35,17,33,17,35,17,51,17,33,17,51,17,33,17,51,6,116,184,254,62,184,254,
+62,184,184,1,194,184,1,194,184,2,173,253,83,2,173,253,83,5,182,253,147,2,
+109,253,147,2,109,0,1,0,60,255,236,5,247,5,202,0,25,0,0,1,20,22,51,50,54,
+55,23,6,4,35,34,38,38,53,52,55,33,53,33,1,55,1,7,6,6,2,224,166,140,109,176,
+50,150,50,254,247,169,147,230,124,102,253,184,2,189,254,141,130,1,190,23,
+93,114,1,228,162,180,121,111,81,141,172,116,215,142,167,145,156,1,206,99,
+253,210,105,37,183,0,0,1,0,40,0,0,5,81,5,183,0,9,0,0,1,1,7,1,17,35,17,1,39,
+1,3,5,2,76,117,254,61,184,254,60,117,2,76,5,183,253,167,114,1,211,251,65,
+4,193,254,43,114,2,89,0,0,3,0,200,0,0,5,32,5,183,0,3,0,7,0,11,0,0,1,17,35,
+17,1,17,35,17,33,17,35,17,3,80,184,254,232,184,4,88,184,3,54,252,202,3,54,
+2,129,252,202,3,54,252,202,3,54,0,0,1,0,125,255,236,4,166,5,182,0,36,0,0,
+1,54,51,50,22,22,21,20,6,6,35,32,0,17,52,18,36,51,51,21,35,32,0,17,20,22,
+22,51,50,54,53,52,38,38,35,34,7,1,227,105,110,139,226,127,121,226,154,254,
+233,254,227,187,1,85,210,155,135,254,245,254,215,90,165,112,153,157,83,147,
+98,74,60,3,122,37,124,220,132,136,215,120,1,92,1,79,233,1,109,201,158,254,
+174,254,209,170,232,119,156,152,102,142,71,26,0,1,0,80,0,0,5,145,5,202,0,
+25,0,0,1,22,21,16,0,0,33,35,53,50,54,18,53,52,2,39,55,4,17,20,2,7,0,17,52,
+39,5,85,60,254,170,253,175,254,146,44,130,218,122,121,114,102,1,71,105,85,
+2,166,54,5,202,179,178,254,209,253,239,254,219,158,164,1,28,172,186,1,27,
+91,144,230,254,48,167,254,216,92,1,48,2,70,153,180,0,1,0,80,255,236,5,145,
+5,182,0,25,0,0,37,54,53,16,1,22,18,21,16,5,39,54,18,53,52,2,38,35,53,51,32,
+0,0,17,20,7,4,154,54,253,90,84,106,254,185,102,114,121,122,218,130,44,1,109,
+2,81,1,87,60,10,180,153,2,70,1,48,90,254,216,169,254,46,228,144,91,1,27,186,
+170,1,30,164,158,254,219,253,240,254,208,179,178,0,0,1,0,160,0,0,4,99,5,182,
+0,28,0,0,1,2,17,21,54,55,21,6,7,18,19,35,2,3,6,35,34,38,53,17,51,17,20,33,
+50,55,53,16,19,4,33,78,66,78,55,84,16,57,195,54,16,98,91,211,232,184,1,21,
+80,84,77,5,182,254,178,254,135,38,14,27,159,20,21,254,228,254,242,1,7,1,1,
+12,195,176,2,71,253,211,235,10,71,1,123,1,76,0,0,1,0,200,0,0,4,243,5,182,
+0,19,0,0,19,51,17,22,22,51,50,54,53,17,51,17,20,6,35,34,38,39,17,35,200,184,
+166,175,94,140,124,184,221,209,103,201,149,184,5,182,253,60,54,30,117,118,
+2,45,253,185,178,193,39,53,253,168,0,2,0,20,0,0,5,47,5,188,0,3,0,13,0,0,37,
+33,53,33,1,6,7,1,35,1,51,1,35,1,3,188,253,198,2,58,254,227,42,21,254,110,
+186,2,59,166,2,58,191,254,117,184,156,3,170,168,51,251,221,5,188,250,68,4,
+35,0,0,1,0,200,0,0,5,38,5,182,0,11,0,0,33,35,17,33,17,35,17,51,17,33,17,51,
+5,38,184,253,18,184,184,2,238,184,2,173,253,83,5,182,253,147,2,109,0,1,0,
+200,0,0,5,42,5,182,0,15,0,0,1,33,17,51,17,33,17,35,17,33,17,51,17,33,17,51,
+3,87,1,27,184,254,45,184,254,41,184,1,31,184,3,72,2,110,252,244,253,86,2,
+170,3,12,253,146,2,110,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,
+9,0,1,0,32,0,94,0,3,0,1,4,9,0,2,0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,
+0,1,4,9,0,4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,
+0,3,0,1,4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,
+1,122,0,3,0,1,4,9,0,10,0,96,1,162,0,3,0,1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,
+12,0,60,2,64,0,3,0,1,4,9,0,13,2,150,2,124,0,3,0,1,4,9,0,14,0,52,5,18,0,67,
+0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,
+0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,
+65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,
+115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,
+97,0,110,0,115,0,32,0,67,0,97,0,114,0,105,0,97,0,110,0,82,0,101,0,103,0,117,
+0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,
+0,32,0,83,0,97,0,110,0,115,0,32,0,67,0,97,0,114,0,105,0,97,0,110,0,86,0,101,
+0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,104,0,
+78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,67,0,97,0,114,0,105,0,97,0,110,
+0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,
+100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,
+110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,
+97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,
+0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,
+119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,
+0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,
+0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,
+0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,
+0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,
+0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,
+0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,
+0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,
+0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,
+0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,
+0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,
+0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,
+0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,
+76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,
+0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,
+0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,
+0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,
+0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,
+0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,
+0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,
+0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,
+0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,
+0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,8,0,5,
+255,255,0,15,};
+#endif
@@ -0,0 +1,972 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansCham_Regular_ttf_size = 23604;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansCham_Regular_ttf");
+asm(".type fz_font_NotoSansCham_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansCham_Regular_ttf, 23604");
+asm(".balign 64");
+asm("fz_font_NotoSansCham_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansCham-Regular.ttf\"");
+#else
+const int fz_font_NotoSansCham_Regular_ttf_size = 23604;
+const char fz_font_NotoSansCham_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,38,0,132,0,0,90,52,0,0,0,30,71,
+80,79,83,124,0,120,3,0,0,90,84,0,0,0,72,71,83,85,66,108,209,98,55,0,0,90,
+156,0,0,1,150,79,83,47,50,112,38,72,20,0,0,1,104,0,0,0,86,99,109,97,112,238,
+227,10,229,0,0,3,188,0,0,1,114,103,97,115,112,255,255,0,3,0,0,90,44,0,0,0,
+8,103,108,121,102,98,78,106,32,0,0,6,48,0,0,74,224,104,101,97,100,251,83,
+76,156,0,0,0,236,0,0,0,54,104,104,101,97,13,121,5,240,0,0,1,36,0,0,0,36,104,
+109,116,120,78,159,231,229,0,0,1,192,0,0,1,252,108,111,99,97,89,7,106,227,
+0,0,5,48,0,0,1,0,109,97,120,112,0,133,0,134,0,0,1,72,0,0,0,32,110,97,109,
+101,121,44,167,156,0,0,81,16,0,0,5,88,112,111,115,116,219,87,110,113,0,0,
+86,104,0,0,3,193,0,1,0,0,0,1,5,31,8,178,38,127,95,15,60,245,0,11,8,0,0,0,
+0,0,195,243,28,203,0,0,0,0,210,255,223,209,251,142,254,12,9,180,7,215,0,0,
+0,9,0,1,0,0,0,0,0,0,0,1,0,0,8,52,253,218,0,0,10,24,251,142,253,126,9,180,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,1,0,0,0,127,0,132,0,5,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,4,166,1,144,0,5,0,0,5,154,5,51,0,0,1,
+27,5,154,5,51,0,0,3,209,0,102,2,18,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,64,0,0,71,79,79,71,0,64,0,32,170,95,8,52,253,218,0,0,7,208,1,
+244,96,0,1,159,223,247,0,0,0,0,6,0,1,0,0,0,0,0,2,57,0,0,2,57,0,0,2,39,0,147,
+3,55,0,133,5,43,0,51,4,104,0,123,6,154,0,102,5,158,0,109,1,207,0,133,2,104,
+0,82,2,104,0,61,4,104,0,82,4,104,0,102,2,0,0,63,2,147,0,82,2,37,0,147,2,252,
+0,20,4,104,0,98,4,104,0,178,4,104,0,96,4,104,0,82,4,104,0,23,4,104,0,131,
+4,104,0,113,4,104,0,90,4,104,0,106,4,104,0,106,2,37,0,147,2,37,0,63,4,104,
+0,102,4,104,0,102,4,104,0,102,3,104,0,37,6,238,0,109,7,108,0,100,6,164,0,
+100,4,26,0,100,6,60,0,100,6,164,0,100,4,26,0,100,6,164,0,77,9,86,0,77,6,164,
+0,100,9,236,0,100,5,180,0,100,5,180,0,100,6,164,0,100,9,152,0,100,10,20,0,
+100,7,189,254,212,9,96,0,100,9,96,0,100,9,96,0,100,6,164,0,100,6,240,0,100,
+6,235,0,100,6,185,0,100,6,224,0,100,6,224,0,100,6,224,0,100,6,235,254,212,
+6,254,0,100,7,124,254,212,7,22,0,100,10,24,0,100,6,185,0,100,7,18,0,100,7,
+18,0,100,9,206,0,100,4,37,254,212,6,84,0,100,6,185,0,100,7,18,0,100,6,205,
+254,212,6,175,254,212,0,0,253,211,0,0,252,192,0,0,252,192,0,0,252,192,0,0,
+253,253,0,0,254,92,3,242,0,100,3,192,0,100,0,0,253,115,0,0,254,177,3,82,255,
+21,1,141,255,211,0,0,253,141,0,0,254,148,6,164,0,77,6,164,0,100,6,44,0,100,
+0,0,254,110,6,164,0,100,6,164,0,100,6,224,0,100,6,235,254,212,9,206,0,100,
+4,37,254,212,6,84,0,100,7,18,0,100,0,2,254,187,4,26,0,100,4,176,0,100,4,26,
+0,50,7,158,0,100,6,164,0,100,5,9,0,100,4,57,0,100,4,37,254,212,4,76,254,212,
+6,164,0,100,7,118,0,100,5,11,0,100,1,201,0,100,2,245,0,100,4,39,0,100,0,0,
+253,141,0,0,254,90,0,0,251,142,0,0,253,115,0,0,253,57,0,0,254,92,0,4,252,
+196,0,103,253,211,0,0,0,2,0,1,0,0,0,0,0,20,0,3,0,1,0,0,1,26,0,0,1,6,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,4,5,6,7,8,
+9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,
+34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,4,0,88,0,0,0,18,0,16,0,3,0,2,0,64,0,160,0,173,3,126,170,
+54,170,77,170,89,170,95,255,255,0,0,0,32,0,160,0,173,3,126,170,0,170,64,170,
+80,170,92,255,255,255,227,255,99,255,99,252,160,86,36,86,27,86,25,86,23,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,61,0,
+83,0,143,0,238,1,78,1,198,1,213,1,247,2,25,2,61,2,85,2,110,2,123,2,155,2,
+171,2,234,3,9,3,64,3,144,3,188,3,252,4,84,4,103,4,209,5,39,5,96,5,147,5,168,
+5,188,5,209,6,37,6,182,7,66,7,171,7,220,8,65,8,155,8,245,9,44,9,142,9,216,
+10,55,10,142,10,253,11,73,11,209,12,45,12,191,13,64,13,224,14,151,14,234,
+15,69,15,149,15,234,16,76,16,233,17,106,17,196,18,39,18,175,18,243,19,68,
+19,163,20,63,20,211,21,46,21,124,21,209,22,93,22,191,23,36,23,137,23,170,
+23,236,24,68,24,144,24,194,24,221,25,9,25,97,25,166,25,190,25,243,26,69,26,
+119,26,181,26,238,27,58,27,170,27,189,28,13,28,97,28,198,29,33,29,125,29,
+205,30,36,30,136,30,164,30,210,31,6,31,68,31,163,32,12,32,111,32,188,33,10,
+33,98,33,201,34,40,34,179,34,202,35,54,35,112,35,161,35,224,36,58,36,149,
+36,187,36,235,37,67,37,112,0,2,1,0,0,0,5,0,5,0,0,3,0,7,0,0,33,17,33,17,37,
+33,17,33,1,0,4,0,252,32,3,192,252,64,5,0,251,0,32,4,192,0,0,2,0,147,255,227,
+1,145,5,182,0,3,0,23,0,0,1,35,3,51,3,52,62,2,51,50,30,2,21,20,14,2,35,34,
+46,2,1,80,121,51,223,240,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,
+1,158,4,24,250,185,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,0,2,0,133,
+3,166,2,178,5,182,0,3,0,7,0,0,1,3,35,3,33,3,35,3,1,74,41,115,41,2,45,41,114,
+41,5,182,253,240,2,16,253,240,2,16,0,2,0,51,0,0,4,248,5,182,0,27,0,31,0,0,
+1,3,33,21,33,3,35,19,33,3,35,19,33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,
+21,1,33,19,33,3,215,63,1,24,254,205,82,147,84,254,221,82,144,78,254,254,1,
+29,65,254,238,1,43,82,147,82,1,37,84,144,84,1,6,252,235,1,35,64,254,221,3,
+125,254,184,137,254,84,1,172,254,84,1,172,137,1,72,137,1,176,254,80,1,176,
+254,80,137,254,184,1,72,0,0,3,0,123,255,137,3,217,6,18,0,45,0,54,0,63,0,0,
+1,20,14,2,7,21,35,53,34,46,2,39,53,30,3,51,17,46,3,53,52,62,2,55,53,51,21,
+22,22,23,7,38,38,39,17,30,3,7,52,46,2,39,17,54,54,1,20,30,2,23,17,6,6,3,217,
+50,93,133,84,138,50,102,96,84,32,33,87,96,101,47,89,131,86,42,49,91,129,79,
+138,100,169,67,66,56,140,74,88,135,91,46,176,20,43,70,51,93,91,254,18,17,
+40,66,49,89,83,1,190,70,114,84,55,12,230,221,9,18,26,17,172,16,33,26,17,1,
+178,30,66,85,110,74,67,111,83,53,9,180,176,5,42,31,145,25,41,6,254,90,31,
+66,83,107,72,33,55,45,38,18,254,139,14,98,2,163,36,57,47,38,17,1,113,16,89,
+0,0,5,0,102,255,236,6,51,5,203,0,9,0,29,0,39,0,59,0,63,0,0,19,20,22,51,50,
+17,16,35,34,6,5,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,20,22,51,50,17,
+16,35,34,6,5,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,1,35,1,250,71,80,
+156,156,80,71,1,199,36,74,115,79,73,112,76,38,35,73,113,78,75,113,77,39,1,
+172,71,80,156,156,80,71,1,198,35,74,115,79,74,112,75,38,35,73,113,78,75,113,
+76,39,255,0,252,213,158,3,44,4,2,165,165,1,74,1,72,163,165,108,172,118,63,
+63,118,172,108,108,170,117,62,62,117,170,253,74,165,164,1,73,1,72,163,165,
+108,171,118,63,63,118,171,108,108,170,117,62,62,117,170,3,146,250,74,5,182,
+0,3,0,109,255,236,5,125,5,205,0,17,0,33,0,83,0,0,1,20,30,2,23,62,3,53,52,
+46,2,35,34,6,19,50,62,2,55,1,14,3,21,20,30,2,37,52,62,2,55,46,3,53,52,62,
+2,51,50,30,2,21,20,14,2,7,1,62,3,55,51,14,3,7,1,35,39,14,3,35,34,46,2,1,166,
+16,33,52,36,59,86,56,28,25,47,66,42,86,100,135,58,98,84,72,32,254,125,52,
+80,55,28,35,66,96,254,125,40,77,111,71,31,60,45,28,50,94,138,88,83,131,91,
+48,50,84,109,60,1,96,27,43,34,27,10,184,15,41,53,65,39,1,21,225,168,49,96,
+108,124,78,105,167,115,61,4,141,34,65,65,67,37,35,62,64,70,41,36,61,44,25,
+89,251,175,23,40,54,31,1,151,33,63,72,85,56,54,91,65,36,240,78,122,100,86,
+42,36,77,87,99,57,75,119,83,43,43,83,119,75,64,109,93,79,36,254,140,29,60,
+68,78,47,66,111,98,85,41,254,219,172,45,71,49,27,53,103,149,0,1,0,133,3,166,
+1,74,5,182,0,3,0,0,1,3,35,3,1,74,41,115,41,5,182,253,240,2,16,0,0,1,0,82,
+254,188,2,43,5,182,0,19,0,0,19,52,62,2,55,51,6,2,21,20,30,2,23,35,46,3,82,
+36,74,113,78,172,140,145,37,71,106,69,170,78,113,74,36,2,49,125,243,229,211,
+93,193,254,50,244,119,236,226,212,94,90,206,225,240,0,0,1,0,61,254,188,2,
+23,5,182,0,19,0,0,1,20,14,2,7,35,62,3,53,52,2,39,51,30,3,2,23,36,75,113,78,
+170,69,106,72,36,144,141,172,78,113,75,36,2,49,124,240,225,206,90,94,212,
+226,236,119,244,1,206,193,93,211,229,243,0,0,1,0,82,2,119,4,20,6,20,0,14,
+0,0,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,2,152,43,1,141,26,254,134,245,178,
+176,158,184,242,254,137,29,1,135,43,6,20,254,119,111,193,28,254,186,96,1,
+102,254,154,96,1,70,28,193,111,1,137,0,0,1,0,102,1,6,4,2,4,162,0,11,0,0,1,
+33,53,33,17,51,17,33,21,33,17,35,1,233,254,125,1,131,150,1,131,254,125,150,
+2,135,150,1,133,254,123,150,254,127,0,1,0,63,254,248,1,121,0,238,0,12,0,0,
+37,23,14,3,7,35,62,3,55,1,106,15,14,39,47,51,25,138,15,29,27,22,8,238,23,
+54,122,124,123,56,61,132,131,125,53,0,0,1,0,82,1,209,2,66,2,121,0,3,0,0,19,
+53,33,21,82,1,240,1,209,168,168,0,0,1,0,147,255,227,1,145,0,250,0,19,0,0,
+55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,20,20,
+34,47,26,27,46,34,20,111,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,0,
+1,0,20,0,0,2,231,5,182,0,3,0,0,1,1,35,1,2,231,253,224,179,2,33,5,182,250,
+74,5,182,0,0,2,0,98,255,236,4,8,5,205,0,19,0,39,0,0,1,20,2,6,6,35,34,38,38,
+2,53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,
+2,4,8,51,113,178,127,118,175,115,57,51,111,177,126,119,176,116,58,253,19,
+30,66,107,77,77,108,69,31,31,69,108,77,77,107,66,30,2,221,177,254,232,194,
+102,102,194,1,24,177,177,1,24,193,102,101,193,254,232,178,150,224,149,75,
+74,148,225,151,150,224,148,74,74,148,224,0,0,1,0,178,0,0,2,199,5,182,0,16,
+0,0,33,35,17,52,62,2,55,14,3,7,7,39,1,51,2,199,176,1,3,3,1,17,26,27,30,21,
+148,96,1,127,150,3,145,43,98,97,89,34,18,26,24,27,18,121,123,1,43,0,0,1,0,
+96,0,0,3,240,5,203,0,35,0,0,33,33,53,1,62,3,53,52,46,2,35,34,6,7,39,62,3,
+51,50,30,2,21,20,14,2,7,1,21,33,3,240,252,112,1,94,75,118,83,44,34,63,86,
+53,95,153,69,102,40,92,106,118,65,96,155,108,59,53,93,129,75,254,231,2,177,
+156,1,125,81,134,128,129,76,59,90,63,32,77,60,119,36,63,46,27,54,101,145,
+91,85,154,149,150,81,254,213,8,0,0,1,0,82,255,236,3,238,5,203,0,57,0,0,1,
+20,14,2,7,21,22,22,21,20,14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,46,2,
+35,35,53,51,50,62,2,53,52,46,2,35,34,6,7,39,62,3,51,50,30,2,3,193,46,83,116,
+71,177,184,65,132,202,138,109,193,85,87,203,93,92,134,87,41,53,98,141,89,
+133,133,81,126,85,44,36,66,92,56,107,163,74,92,38,93,110,125,70,108,163,110,
+56,4,96,73,120,88,57,12,6,22,181,145,96,160,116,64,34,45,170,46,50,40,74,
+108,67,68,97,63,30,151,40,74,102,61,52,82,57,30,67,54,125,31,54,41,24,54,
+97,133,0,0,2,0,23,0,0,4,63,5,190,0,10,0,24,0,0,1,35,17,35,17,33,53,1,51,17,
+51,33,17,52,62,2,55,35,14,3,7,1,4,63,213,176,253,93,2,151,188,213,254,123,
+3,4,5,1,9,7,21,25,26,11,254,101,1,72,254,184,1,72,159,3,215,252,48,1,100,
+56,123,117,102,34,20,49,49,46,16,253,160,0,0,1,0,131,255,236,3,246,5,182,
+0,42,0,0,1,50,30,2,21,20,14,2,35,34,46,2,39,53,30,3,51,50,62,2,53,52,38,35,
+34,14,2,7,39,19,33,21,33,3,54,54,2,33,99,171,127,72,68,134,197,128,51,99,
+91,82,33,33,89,98,99,42,79,124,86,46,176,168,27,63,63,57,21,90,55,2,178,253,
+236,39,32,105,3,129,55,108,160,105,114,182,126,67,10,19,30,20,172,23,36,24,
+13,37,78,118,81,143,151,5,8,9,4,57,2,176,166,254,93,6,14,0,0,2,0,113,255,
+236,4,10,5,203,0,43,0,63,0,0,19,52,62,4,51,50,30,2,23,21,38,38,35,34,14,4,
+7,51,62,3,51,50,30,2,21,20,14,2,35,34,46,2,1,50,62,2,53,52,46,2,35,34,14,
+2,21,20,30,2,113,21,53,92,142,198,133,19,46,47,43,17,35,88,43,90,137,100,
+67,42,20,3,12,20,57,76,95,59,95,154,108,59,62,116,164,102,100,175,128,74,
+1,219,60,99,72,39,33,66,99,66,67,111,78,43,37,73,110,2,113,105,208,191,164,
+121,69,2,5,7,5,155,12,12,43,78,108,131,148,80,36,63,45,26,59,114,165,106,
+114,182,127,68,78,160,242,254,185,41,83,127,87,70,111,78,42,47,75,96,48,67,
+133,106,67,0,0,1,0,90,0,0,4,6,5,182,0,6,0,0,33,1,33,53,33,21,1,1,25,2,51,
+253,14,3,172,253,213,5,16,166,145,250,219,0,0,3,0,106,255,236,4,0,5,205,0,
+39,0,58,0,74,0,0,1,50,30,2,21,20,14,2,7,30,3,21,20,14,2,35,34,46,2,53,52,
+62,2,55,46,3,53,52,62,2,3,20,30,2,51,50,62,2,53,52,46,2,39,39,6,6,1,34,6,
+21,20,30,2,23,62,3,53,52,38,2,53,84,149,113,66,40,70,96,56,58,111,87,53,67,
+121,169,102,110,171,117,61,45,76,104,58,49,86,63,37,67,114,149,199,32,68,
+104,72,70,107,72,36,39,73,102,63,30,126,128,1,22,106,125,35,62,87,51,48,85,
+63,36,126,5,205,44,88,132,88,67,108,87,69,28,31,76,95,118,73,92,149,104,56,
+54,101,146,92,75,120,96,74,28,31,73,90,109,66,87,131,88,44,251,166,53,89,
+63,35,35,65,92,56,52,84,72,64,31,14,60,155,3,84,106,101,57,82,64,51,24,22,
+52,66,84,54,101,106,0,0,2,0,106,255,236,4,4,5,203,0,41,0,61,0,0,1,20,14,4,
+35,34,46,2,39,53,22,22,51,50,62,2,55,35,14,3,35,34,46,2,53,52,62,2,51,50,
+30,2,1,34,14,2,21,20,30,2,51,50,62,2,53,52,46,2,4,4,21,53,92,142,198,133,
+19,46,46,44,17,35,88,43,135,174,102,43,5,13,20,56,76,96,59,95,154,108,59,
+63,115,165,102,101,174,128,74,254,37,60,99,72,39,33,66,99,66,68,110,78,43,
+37,73,110,3,70,105,209,190,165,120,69,2,5,6,5,156,13,12,94,161,214,119,36,
+62,46,26,59,114,165,106,114,183,127,68,78,160,243,1,71,40,84,127,87,70,111,
+78,42,47,75,96,48,67,133,107,66,0,2,0,147,255,227,1,145,4,102,0,19,0,39,0,
+0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,17,52,62,2,51,50,30,2,21,20,
+14,2,35,34,46,2,147,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,20,34,
+46,27,26,47,34,20,20,34,47,26,27,46,34,20,111,38,53,33,15,15,33,53,38,37,
+53,34,16,16,34,53,3,145,39,53,33,14,14,33,53,39,37,52,34,16,16,34,52,0,2,
+0,63,254,248,1,145,4,102,0,12,0,32,0,0,37,23,14,3,7,35,62,3,55,3,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,1,106,15,14,39,47,51,25,138,15,29,27,22,
+8,17,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,238,23,54,122,124,123,
+56,61,132,131,125,53,2,237,39,53,33,14,14,33,53,39,37,52,34,16,16,34,52,0,
+0,1,0,102,0,238,4,2,4,221,0,6,0,0,37,1,53,1,21,1,1,4,2,252,100,3,156,253,
+33,2,223,238,1,168,102,1,225,160,254,148,254,190,0,2,0,102,1,186,4,2,3,233,
+0,3,0,7,0,0,19,53,33,21,1,53,33,21,102,3,156,252,100,3,156,3,84,149,149,254,
+102,150,150,0,0,1,0,102,0,238,4,2,4,221,0,6,0,0,19,1,1,53,1,21,1,102,2,224,
+253,32,3,156,252,100,1,143,1,66,1,108,160,254,31,102,254,88,0,2,0,37,255,
+227,3,37,5,203,0,39,0,59,0,0,1,53,52,62,2,55,62,3,53,52,46,2,35,34,6,7,39,
+54,54,51,50,30,2,21,20,14,2,7,14,3,21,21,3,52,62,2,51,50,30,2,21,20,14,2,
+35,34,46,2,1,25,15,39,66,50,48,68,43,21,30,57,85,56,83,150,70,63,81,188,97,
+93,149,104,56,27,54,80,54,52,66,38,14,187,20,34,46,27,26,47,34,20,20,34,47,
+26,27,46,34,20,1,158,37,57,92,80,77,42,41,67,69,79,53,48,79,57,31,52,34,145,
+42,59,51,96,139,87,67,105,90,84,47,45,67,63,66,44,18,254,209,38,53,33,15,
+15,33,53,38,37,53,34,16,16,34,53,0,2,0,109,255,74,6,129,5,182,0,86,0,103,
+0,0,1,20,14,4,35,34,46,2,39,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,3,
+6,6,21,21,20,30,2,51,50,62,2,53,52,46,2,35,34,4,6,2,21,20,30,2,51,50,62,2,
+55,21,6,6,35,34,36,38,2,53,52,18,54,36,51,50,4,22,18,1,20,22,51,50,62,2,55,
+55,38,38,35,34,14,2,6,129,19,37,57,76,97,58,45,73,52,33,6,4,18,54,71,89,53,
+77,119,82,43,59,111,158,98,45,90,82,69,23,23,1,1,21,34,43,23,46,70,47,24,
+86,152,209,123,169,254,254,175,90,79,153,227,147,61,119,111,100,43,86,216,
+130,179,254,231,195,102,118,219,1,55,193,156,1,6,191,106,252,21,101,85,55,
+78,50,26,4,14,28,77,42,74,101,63,28,2,219,62,125,113,97,72,41,30,50,65,35,
+37,66,49,28,56,101,142,86,101,168,122,68,8,14,17,8,254,96,22,27,8,19,53,68,
+40,15,61,104,140,78,142,221,152,79,111,199,254,239,162,151,234,160,82,14,
+24,31,17,141,38,44,102,195,1,25,179,188,1,69,238,136,101,189,254,241,254,
+213,133,119,45,83,115,69,253,8,13,58,94,120,0,2,0,100,0,0,7,8,4,176,0,9,0,
+98,0,0,37,38,35,6,7,6,21,20,51,50,19,6,7,22,23,22,21,20,7,22,22,23,7,38,39,
+6,35,38,53,52,55,54,51,50,23,53,52,39,38,39,53,54,53,52,33,34,17,20,23,54,
+54,51,50,22,22,21,20,6,6,35,32,17,16,33,32,19,22,23,22,23,54,53,52,39,38,
+53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,23,22,21,20,7,6,7,39,38,3,60,
+47,41,50,10,1,57,57,120,39,99,127,44,40,1,41,119,71,49,81,118,53,205,131,
+161,17,17,38,35,22,26,169,170,254,237,255,57,30,41,22,31,60,34,33,60,32,254,
+192,1,169,1,163,6,49,55,57,32,21,22,42,1,94,1,94,144,106,80,180,190,24,27,
+3,26,126,97,37,165,5,20,30,4,4,23,2,57,61,47,61,81,73,61,7,7,14,58,60,102,
+82,39,147,9,131,130,20,2,10,6,26,43,47,66,163,42,125,230,254,232,202,49,35,
+16,32,60,33,33,59,33,1,194,1,194,254,123,45,62,65,80,39,21,45,45,97,64,1,
+74,254,182,178,130,75,75,158,160,160,62,55,70,55,21,18,125,92,49,127,0,1,
+0,100,254,12,6,64,4,176,0,72,0,0,19,16,37,54,51,50,23,22,51,50,55,54,51,32,
+17,16,5,4,21,20,51,50,18,51,50,23,22,21,20,7,39,54,55,53,52,35,34,7,6,2,35,
+34,17,16,37,36,17,52,35,34,7,6,35,34,39,38,35,34,17,20,23,54,54,51,50,22,
+22,21,20,6,6,35,32,100,1,85,27,17,144,116,57,58,58,58,116,143,1,109,254,18,
+254,16,66,117,245,135,165,19,5,94,124,70,1,63,7,8,69,207,185,224,2,108,1,
+105,198,129,103,51,92,91,51,103,120,225,71,23,44,32,31,60,34,33,60,32,254,
+172,2,238,1,153,37,4,70,35,35,70,254,105,254,105,213,218,155,140,1,94,138,
+38,34,140,137,48,103,88,2,67,1,10,254,192,1,44,1,45,234,176,1,9,254,60,30,
+30,60,254,232,232,19,36,15,32,60,33,33,59,33,0,0,1,0,100,0,0,3,182,4,176,
+0,29,0,0,0,1,6,21,20,51,50,55,23,16,35,34,53,52,55,36,53,52,33,34,21,20,23,
+7,36,17,16,33,32,17,3,182,254,123,110,94,114,25,115,254,254,202,1,41,254,
+247,255,140,53,254,255,1,169,1,169,2,128,254,229,94,63,60,176,20,254,216,
+200,134,158,240,118,180,200,152,41,112,45,1,4,1,114,254,162,0,0,1,0,100,0,
+0,6,60,7,58,0,70,0,0,1,6,21,20,23,7,38,17,16,33,32,17,20,7,6,6,21,22,23,38,
+53,52,54,53,52,39,38,53,52,51,50,23,54,53,52,38,53,16,33,32,17,20,7,39,54,
+53,52,35,34,21,20,18,21,20,7,22,21,20,6,21,20,23,7,36,3,52,54,55,54,53,52,
+1,169,165,96,78,178,1,60,1,79,1,30,79,20,236,20,221,14,144,125,85,27,13,254,
+1,74,1,74,123,98,61,170,170,254,103,16,214,27,51,253,244,20,79,30,2,4,5,14,
+185,172,40,95,47,1,4,1,111,254,195,19,21,135,188,117,178,57,55,49,75,242,
+43,35,37,11,113,125,81,48,83,141,248,145,1,60,254,196,150,104,48,74,132,146,
+146,109,254,254,167,230,54,58,51,115,171,148,56,25,92,70,1,74,113,198,129,
+16,15,147,0,0,1,0,100,254,12,6,64,4,176,0,61,0,0,19,16,37,54,51,50,23,22,
+51,50,55,54,51,32,17,16,5,4,21,20,51,50,53,52,39,55,22,21,20,33,32,17,16,
+37,36,17,52,35,34,7,6,35,34,39,38,35,34,17,20,23,54,54,51,50,22,22,21,20,
+6,6,35,32,100,1,85,27,17,144,116,57,58,58,58,116,143,1,109,254,18,254,16,
+122,180,62,93,129,254,172,254,232,2,108,1,112,205,129,103,51,92,91,51,103,
+120,235,81,23,44,32,31,60,34,33,60,32,254,172,2,238,1,153,37,4,70,35,35,70,
+254,102,254,108,213,218,175,140,110,83,67,87,118,119,250,1,24,1,65,234,176,
+1,23,240,60,30,30,60,254,232,232,19,36,15,32,60,33,33,59,33,0,2,0,100,0,0,
+4,57,4,176,0,7,0,61,0,0,37,38,35,34,21,20,51,50,1,16,33,32,17,20,7,22,21,
+20,7,22,23,7,38,39,6,35,34,39,38,53,52,55,54,51,51,22,23,54,53,52,39,53,54,
+53,52,33,32,17,20,23,54,54,51,50,22,22,21,20,6,6,35,32,3,0,47,51,90,60,93,
+253,135,1,169,1,169,125,125,5,70,66,26,44,83,53,235,180,9,1,53,60,75,3,77,
+69,3,150,150,254,252,254,242,67,30,41,22,31,60,34,33,60,32,254,192,165,5,
+25,25,2,118,1,194,254,112,171,99,83,127,23,37,17,52,100,42,14,147,104,13,
+13,84,41,45,1,7,17,11,142,38,76,59,165,230,254,232,172,49,35,16,32,60,33,
+33,59,33,0,0,1,0,77,255,232,6,64,4,176,0,35,0,0,0,35,34,21,20,23,22,21,20,
+7,6,7,39,54,53,52,38,53,16,33,50,23,54,33,32,17,16,7,39,54,53,52,33,34,7,
+35,2,203,222,233,51,24,13,31,112,102,94,71,1,121,255,88,91,1,20,1,157,213,
+75,128,254,249,254,64,92,4,6,230,122,165,95,85,64,58,137,98,42,173,145,144,
+210,110,1,144,179,179,254,112,254,251,129,110,95,185,230,200,0,2,0,77,255,
+232,8,242,4,176,0,6,0,66,0,0,1,6,21,20,51,50,54,0,35,34,21,20,23,22,21,20,
+7,6,7,39,54,53,52,38,53,16,33,50,23,54,51,32,17,20,7,54,55,18,33,32,17,20,
+7,39,54,53,52,35,34,7,2,7,2,6,35,34,39,54,55,55,54,53,52,35,34,7,35,5,38,
+166,45,43,61,253,162,202,233,51,24,13,31,112,102,94,71,1,121,245,88,91,246,
+1,107,3,63,20,2,1,92,1,94,203,79,122,190,174,16,19,245,30,168,91,191,10,10,
+254,75,15,213,214,74,92,1,180,111,115,59,168,2,199,230,122,165,95,85,64,58,
+137,98,42,173,145,144,210,110,1,144,179,179,254,112,51,72,27,126,1,114,254,
+182,158,125,98,67,118,160,200,254,254,81,254,216,195,210,210,142,44,97,97,
+230,200,0,1,0,100,255,255,6,64,4,176,0,48,0,0,1,20,7,39,54,53,52,33,34,7,
+35,38,35,34,17,20,22,23,39,54,54,55,54,51,50,23,22,22,23,22,21,20,7,6,6,7,
+6,35,34,39,38,53,16,33,50,23,54,33,32,6,64,148,102,90,254,249,254,64,92,52,
+222,233,98,92,1,10,53,29,10,11,18,20,30,41,6,2,6,11,48,30,34,32,220,112,86,
+1,121,255,88,91,1,20,1,157,3,32,201,166,89,113,165,230,200,200,254,109,165,
+254,41,6,51,29,6,2,6,11,52,33,12,12,21,24,37,44,6,4,231,178,219,2,61,179,
+179,0,0,1,0,100,0,0,9,136,4,176,0,65,0,0,0,35,34,21,20,22,21,20,6,21,20,23,
+7,36,3,52,54,55,54,53,52,39,6,21,20,23,7,38,17,16,33,32,17,20,7,6,6,21,22,
+23,38,53,52,54,53,52,38,53,16,33,50,23,54,33,32,17,16,7,39,54,53,52,35,34,
+7,35,6,59,212,233,113,214,27,51,253,244,20,79,30,2,167,165,96,78,178,1,60,
+1,79,1,30,79,20,236,20,221,108,1,121,245,88,91,1,0,1,137,213,75,128,243,234,
+64,92,4,6,160,42,181,82,83,201,108,56,25,92,70,1,74,113,198,129,16,15,147,
+11,14,185,172,40,95,47,1,4,1,111,254,195,19,21,135,188,117,178,57,55,39,85,
+202,44,44,156,80,1,74,179,179,254,112,254,251,129,110,95,185,230,200,0,1,
+0,100,0,0,5,180,4,176,0,57,0,0,1,52,35,34,21,20,23,7,36,17,16,33,32,17,20,
+7,22,21,20,7,36,17,53,6,35,34,38,53,52,54,54,51,50,22,23,54,55,54,55,23,6,
+7,21,16,5,7,7,39,54,55,54,53,52,39,39,52,55,54,2,148,195,195,140,53,254,255,
+1,104,1,104,106,184,15,1,31,24,36,39,51,40,72,38,58,77,13,53,12,25,22,30,
+61,69,254,120,141,24,112,44,23,6,215,4,1,144,3,82,180,200,152,41,112,45,1,
+4,1,114,254,162,145,128,87,141,65,62,179,1,243,9,9,91,59,39,72,39,56,41,37,
+14,25,21,151,56,45,48,253,145,199,67,11,95,74,88,23,22,130,79,99,1,1,99,0,
+1,0,100,254,112,5,180,4,176,0,79,0,0,37,6,21,20,51,50,55,54,51,50,21,20,7,
+39,54,53,52,35,34,7,6,35,34,53,52,55,54,55,54,53,52,39,39,52,55,54,53,52,
+35,34,21,20,23,7,36,17,16,33,32,17,20,7,22,21,20,7,36,17,53,6,35,34,38,53,
+52,54,54,51,50,22,23,54,55,54,55,23,6,7,21,16,3,29,156,101,111,37,57,172,
+192,133,100,93,52,83,20,78,196,251,170,44,23,6,215,4,1,144,195,195,140,53,
+254,255,1,104,1,104,106,184,15,1,31,24,36,39,51,40,72,38,58,77,13,53,12,25,
+22,30,61,69,11,122,89,60,110,150,164,104,126,68,98,54,54,69,211,200,145,150,
+74,88,23,22,130,79,99,1,1,99,139,180,200,152,41,112,45,1,4,1,114,254,162,
+145,128,87,141,65,62,164,2,2,9,9,91,59,39,72,39,56,41,37,14,25,21,151,56,
+45,48,253,45,0,0,2,0,100,0,0,6,64,4,176,0,6,0,48,0,0,1,6,21,20,51,50,54,19,
+20,7,54,55,18,33,32,17,20,7,39,54,53,52,35,34,7,2,7,2,6,35,34,39,54,55,55,
+54,53,52,35,34,21,20,23,7,36,17,16,33,32,2,116,166,45,43,61,209,3,63,20,2,
+1,92,1,94,203,79,122,190,174,16,19,245,30,168,91,191,10,10,254,75,15,195,
+195,140,53,254,255,1,104,1,104,1,180,111,115,59,168,1,225,51,72,27,126,1,
+114,254,182,158,125,98,67,118,160,200,254,254,81,254,216,195,210,210,142,
+44,97,97,230,200,152,41,112,45,1,4,1,114,0,2,0,100,0,0,9,52,4,176,0,6,0,94,
+0,0,1,6,21,20,51,50,54,1,34,7,2,7,2,6,35,34,39,54,55,55,54,53,52,35,34,21,
+20,23,7,36,17,16,33,32,17,20,7,54,55,18,33,32,17,20,6,21,22,51,50,53,38,39,
+38,53,52,55,54,51,50,23,54,53,52,39,38,53,16,33,32,17,20,7,39,54,53,52,35,
+34,21,20,23,22,21,20,7,7,21,16,33,32,3,52,54,53,52,2,116,166,45,43,61,2,77,
+124,16,19,245,30,168,91,191,10,10,254,75,15,195,195,140,53,254,255,1,104,
+1,104,3,63,20,2,1,42,1,17,230,16,182,182,117,25,5,77,26,23,59,30,45,16,44,
+1,94,1,74,161,55,66,185,185,58,18,81,58,254,173,254,173,2,230,1,180,111,115,
+59,168,2,199,200,254,254,81,254,216,195,210,210,142,44,97,147,180,200,152,
+41,112,45,1,4,1,114,254,162,101,72,27,126,1,114,254,182,168,222,150,180,212,
+11,102,21,18,68,19,6,44,23,39,23,29,77,130,1,60,254,196,150,86,106,38,92,
+146,146,78,134,44,41,84,72,29,40,254,150,1,74,206,226,108,160,0,0,1,0,100,
+0,0,9,176,4,176,0,63,0,0,1,20,5,7,39,54,55,54,53,52,39,39,52,55,54,53,52,
+35,34,21,20,23,7,36,17,16,33,32,17,20,7,22,21,20,7,54,53,52,38,53,16,33,50,
+23,54,33,32,17,16,7,39,54,53,52,35,34,7,35,38,35,34,21,20,22,4,201,254,84,
+24,112,44,23,6,215,4,1,144,195,195,140,53,254,255,1,104,1,104,106,164,25,
+208,71,1,121,255,88,91,1,20,1,147,213,75,128,253,254,64,92,52,222,233,75,
+1,140,249,136,11,95,74,88,23,22,130,79,99,1,1,99,139,180,200,152,41,112,45,
+1,4,1,114,254,162,145,128,87,171,85,32,89,105,104,190,110,1,144,179,179,254,
+112,254,251,129,110,95,185,230,200,200,230,102,220,0,3,254,212,0,0,7,89,4,
+176,0,15,0,31,0,106,0,0,3,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,5,20,
+22,22,51,50,54,54,53,52,38,38,35,34,6,6,19,20,7,50,22,22,21,20,7,54,53,52,
+38,53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,22,21,16,33,35,34,38,38,53,
+52,55,54,55,54,53,52,35,34,21,20,22,21,16,33,35,34,38,38,53,52,54,54,51,50,
+22,22,21,20,7,54,53,52,38,53,16,33,32,150,40,71,39,39,71,40,40,72,38,38,71,
+41,3,142,40,71,39,39,71,40,40,72,38,38,71,41,231,81,75,144,81,39,144,124,
+1,89,1,89,157,63,70,195,195,124,254,62,105,78,143,79,41,34,57,99,210,210,
+104,254,92,105,78,143,79,81,143,76,75,144,81,39,114,104,1,104,1,104,1,44,
+39,71,40,40,71,39,39,72,39,39,72,39,39,71,40,40,71,39,39,72,39,39,72,1,239,
+152,82,77,145,78,78,71,56,253,110,184,130,1,60,254,196,150,79,91,46,92,146,
+146,78,206,140,254,52,79,143,78,78,73,61,37,168,117,196,146,78,226,120,254,
+52,79,143,78,78,145,77,77,145,78,78,71,76,233,110,204,110,1,60,0,0,2,0,100,
+255,255,8,252,4,176,0,6,0,88,0,0,1,6,21,20,51,50,54,1,20,22,23,39,54,54,55,
+54,51,50,23,22,22,23,22,21,20,7,6,6,7,6,35,34,39,38,53,16,37,54,51,50,23,
+22,51,50,55,54,51,32,17,20,7,54,55,18,33,32,17,20,7,39,54,53,52,35,34,7,2,
+7,2,6,35,34,39,54,55,55,54,53,52,35,34,7,6,35,34,39,38,35,34,5,48,166,45,
+43,61,251,229,98,92,1,10,53,29,10,11,18,20,30,41,6,2,6,11,48,30,34,32,220,
+112,86,1,67,25,16,137,110,54,54,55,55,110,135,1,90,3,63,20,2,1,92,1,94,203,
+79,122,190,174,16,19,245,30,168,91,191,10,10,254,75,15,186,122,97,48,88,86,
+48,97,114,214,1,180,111,115,59,168,1,52,165,254,41,6,51,29,6,2,6,11,52,33,
+12,12,21,24,37,44,6,4,231,178,219,2,20,37,4,70,35,35,70,254,112,51,72,27,
+126,1,114,254,182,158,125,98,67,118,160,200,254,254,81,254,216,195,210,210,
+142,44,97,97,230,60,30,30,60,0,2,0,100,254,112,8,252,4,176,0,6,0,114,0,0,
+1,6,21,20,51,50,54,5,38,39,54,55,55,54,53,52,35,34,7,6,35,34,39,38,35,34,
+17,20,22,23,39,54,54,55,54,51,50,23,22,22,23,22,21,20,7,6,6,7,6,35,34,39,
+38,53,16,37,54,51,50,23,22,51,50,55,54,51,32,17,20,7,54,55,18,33,32,17,20,
+7,39,54,53,52,35,34,7,2,7,2,6,35,35,6,21,20,51,50,55,54,51,50,21,20,7,39,
+54,53,52,35,34,7,6,35,34,53,52,5,48,166,45,43,61,254,248,37,4,10,254,75,15,
+186,122,97,48,88,86,48,97,114,214,98,92,1,10,53,29,10,11,18,20,30,41,6,2,
+6,11,48,30,34,32,220,112,86,1,67,25,16,137,110,54,54,55,55,110,135,1,90,3,
+63,20,2,1,92,1,94,203,79,122,190,174,16,19,245,30,168,91,10,142,101,111,37,
+57,172,192,133,100,93,52,83,20,78,196,251,1,180,111,115,59,168,250,52,89,
+210,142,44,97,97,230,60,30,30,60,254,109,165,254,41,6,51,29,6,2,6,11,52,33,
+12,12,21,24,37,44,6,4,231,178,219,2,20,37,4,70,35,35,70,254,112,51,72,27,
+126,1,114,254,182,158,125,98,67,118,160,200,254,254,81,254,216,195,115,85,
+60,110,150,164,104,126,68,98,54,54,69,211,200,133,0,0,2,0,100,254,112,8,252,
+4,176,0,6,0,131,0,0,1,6,21,20,51,50,54,19,6,21,20,51,50,55,54,51,50,21,20,
+7,39,54,53,52,35,34,7,6,35,34,53,52,55,6,7,6,21,20,6,35,34,39,39,54,54,53,
+52,55,54,55,38,39,54,55,55,54,53,52,35,34,7,6,35,34,39,38,35,34,17,20,22,
+23,39,54,54,55,54,51,50,23,22,22,23,22,21,20,7,6,6,7,6,35,34,39,38,53,16,
+37,54,51,50,23,22,51,50,55,54,51,32,17,20,7,54,55,18,33,32,17,20,7,39,54,
+53,52,35,34,7,2,7,2,7,6,5,48,166,45,43,61,14,150,101,111,37,57,172,192,133,
+100,93,52,83,20,78,196,251,94,115,33,40,105,43,42,25,16,55,35,50,45,137,14,
+2,10,254,75,15,186,122,97,48,88,86,48,97,114,214,98,92,1,10,53,29,10,11,18,
+20,30,41,6,2,6,11,48,30,34,32,220,112,86,1,67,25,16,137,110,54,54,55,55,110,
+135,1,90,3,63,20,2,1,92,1,94,203,79,122,190,174,16,19,245,30,84,28,1,180,
+111,115,59,168,254,236,168,75,60,110,150,164,104,126,68,98,54,54,69,211,200,
+108,110,39,46,55,103,103,72,6,100,19,78,69,68,68,61,48,40,53,210,142,44,97,
+97,230,60,30,30,60,254,109,165,254,41,6,51,29,6,2,6,11,52,33,12,12,21,24,
+37,44,6,4,231,178,219,2,20,37,4,70,35,35,70,254,112,51,72,27,126,1,114,254,
+182,158,125,98,67,118,160,200,254,254,81,254,216,97,33,0,2,0,100,0,0,6,64,
+4,176,0,15,0,55,0,0,1,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,7,2,53,16,
+33,50,23,54,33,32,17,16,7,39,54,53,52,33,34,7,35,38,35,34,17,20,23,54,54,
+51,50,22,22,21,20,6,6,35,34,38,1,114,53,95,52,52,95,53,54,96,50,50,96,54,
+194,76,1,121,255,88,91,1,20,1,157,213,75,128,254,249,254,64,92,52,222,233,
+17,57,147,89,88,167,95,92,167,91,141,187,1,94,52,95,53,53,95,52,52,96,52,
+52,96,109,1,0,171,1,224,179,179,254,112,254,251,129,110,95,185,230,200,200,
+254,202,82,82,74,70,90,169,91,91,167,92,112,0,0,1,0,100,0,0,6,140,4,176,0,
+63,0,0,1,52,35,34,21,20,23,7,38,53,16,33,32,17,20,2,21,22,51,50,53,38,39,
+38,53,52,55,54,51,50,23,54,53,52,39,38,53,16,33,32,17,20,7,39,54,53,52,35,
+34,21,20,23,22,21,20,7,7,21,16,33,32,3,52,18,2,128,175,195,120,53,237,1,104,
+1,84,207,16,152,182,117,25,5,77,26,23,59,30,45,16,44,1,94,1,74,161,55,66,
+185,185,58,18,81,58,254,173,254,203,2,197,3,102,160,200,122,31,112,35,230,
+1,114,254,182,148,254,220,120,160,212,11,102,21,18,68,19,6,44,23,39,23,29,
+77,130,1,60,254,196,150,86,106,38,92,146,146,78,134,44,41,84,72,29,40,254,
+150,1,54,176,1,40,0,1,0,100,0,0,6,135,4,176,0,54,0,0,36,5,7,39,54,55,54,53,
+52,39,39,52,55,54,53,52,35,34,21,20,23,7,36,17,16,33,32,17,20,7,22,21,20,
+7,54,53,52,38,53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,22,21,4,201,254,
+84,24,112,44,23,6,215,4,1,144,195,195,140,53,254,255,1,104,1,104,106,164,
+25,222,94,1,89,1,89,157,63,70,195,195,94,147,136,11,95,74,88,23,22,130,79,
+99,1,1,99,139,180,200,152,41,112,45,1,4,1,114,254,162,145,128,87,171,85,32,
+89,169,110,184,130,1,60,254,196,150,79,91,46,92,146,146,78,206,140,0,0,1,
+0,100,0,0,6,85,4,176,0,57,0,0,0,6,21,20,23,7,36,3,52,54,55,54,53,52,39,6,
+21,20,23,7,38,17,16,33,32,17,20,7,6,6,21,22,23,38,53,52,55,54,53,52,38,53,
+16,33,32,17,20,7,39,54,53,52,35,34,21,20,22,21,4,151,176,27,51,254,38,20,
+79,30,2,167,165,96,78,178,1,60,1,79,1,30,79,20,186,9,80,107,94,1,89,1,89,
+157,63,70,195,195,94,1,216,171,78,106,25,92,70,1,74,113,198,129,16,15,147,
+11,14,185,172,40,95,47,1,4,1,111,254,195,19,21,135,188,117,178,57,39,36,106,
+73,97,84,80,144,100,1,20,254,196,150,79,91,46,92,146,106,68,146,110,0,2,0,
+100,0,0,6,124,4,176,0,6,0,66,0,0,1,6,21,20,51,50,54,55,6,7,6,35,34,39,54,
+55,55,54,53,52,35,34,21,20,23,7,36,17,16,33,32,17,20,7,22,23,22,23,54,53,
+52,39,38,53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,23,22,21,20,7,6,7,39,
+38,2,116,166,45,43,61,177,29,77,84,91,191,10,10,254,75,15,195,195,140,53,
+254,255,1,104,1,104,16,64,46,57,32,21,22,42,1,94,1,94,144,106,80,180,190,
+24,27,3,26,126,97,34,1,180,111,115,59,168,109,241,89,98,210,210,142,44,97,
+97,230,200,152,41,112,45,1,4,1,114,254,112,39,173,12,52,65,80,39,21,45,45,
+97,164,1,154,254,182,178,130,75,75,158,160,240,162,55,70,55,21,18,125,92,
+49,118,0,0,2,0,100,254,109,6,124,4,176,0,6,0,110,0,0,1,6,21,20,51,50,54,5,
+6,21,20,23,22,51,50,55,54,18,55,54,51,50,23,22,23,22,21,20,7,39,54,53,52,
+39,53,38,35,34,7,6,7,6,2,7,6,35,34,39,38,53,52,55,38,39,6,7,6,35,34,39,54,
+55,55,54,53,52,35,34,21,20,23,7,36,17,16,33,32,17,20,7,22,23,22,23,54,53,
+52,39,38,53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,23,22,21,20,7,6,7,2,
+116,166,45,43,61,1,123,134,4,32,54,7,7,113,147,130,40,33,100,40,15,9,14,34,
+132,27,8,14,42,10,12,7,7,65,118,178,36,31,163,64,10,203,37,75,29,77,84,91,
+191,10,10,254,75,15,195,195,140,53,254,255,1,104,1,104,16,64,46,57,32,21,
+22,42,1,94,1,94,144,106,80,180,190,24,27,3,22,78,1,180,111,115,59,168,177,
+141,92,16,14,120,2,30,1,145,35,10,96,36,33,53,56,87,95,14,77,63,33,30,2,52,
+3,2,3,28,254,150,48,9,242,36,38,174,205,83,53,241,89,98,210,210,142,44,97,
+97,230,200,152,41,112,45,1,4,1,114,254,112,39,173,12,52,65,80,39,21,45,45,
+97,164,1,154,254,182,178,130,75,75,158,160,240,162,55,70,55,21,18,104,81,
+0,0,2,0,100,254,112,6,124,4,176,0,6,0,91,0,0,1,6,21,20,51,50,54,3,38,39,54,
+55,55,54,53,52,35,34,21,20,23,7,36,17,16,33,32,17,20,7,22,23,22,23,54,53,
+52,39,38,53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,23,22,21,20,7,6,7,39,
+38,39,6,7,6,7,6,21,20,51,50,55,54,51,50,21,20,7,39,54,53,52,35,34,7,6,35,
+34,53,52,2,116,166,45,43,61,237,62,6,10,254,75,15,195,195,140,53,254,255,
+1,104,1,104,16,64,46,57,32,21,22,42,1,94,1,94,144,106,80,180,190,24,27,3,
+26,126,97,34,97,29,77,56,59,156,101,111,37,57,172,192,133,100,93,52,83,20,
+78,196,251,1,180,111,115,59,168,254,233,52,118,210,142,44,97,97,230,200,152,
+41,112,45,1,4,1,114,254,112,39,173,12,52,65,80,39,21,45,45,97,164,1,154,254,
+182,178,130,75,75,158,160,240,162,55,70,55,21,18,125,92,49,118,69,241,89,
+65,22,122,89,60,110,150,164,104,126,68,98,54,54,69,211,200,118,0,0,2,254,
+212,0,0,6,135,4,176,0,15,0,62,0,0,2,21,20,22,22,51,50,54,54,53,52,38,38,35,
+34,6,1,20,22,21,16,33,35,34,38,38,53,52,54,54,51,50,22,22,21,20,7,54,53,52,
+38,53,16,33,50,23,54,33,32,17,16,7,39,54,53,52,35,34,7,35,38,35,34,150,40,
+71,39,39,71,40,40,72,38,38,71,1,234,134,254,102,105,78,143,79,81,143,76,75,
+144,81,19,84,144,1,111,255,88,91,1,0,1,137,213,75,128,243,234,64,92,52,222,
+223,1,83,39,39,71,40,40,71,39,39,72,39,39,1,157,58,226,120,254,92,79,143,
+78,78,145,77,77,145,78,58,51,36,193,110,204,90,1,120,179,179,254,112,254,
+251,129,110,95,185,230,200,200,0,0,1,0,100,0,0,6,154,4,176,0,71,0,0,37,54,
+53,52,39,39,52,55,54,53,52,35,34,21,20,23,7,36,17,16,33,32,17,20,7,22,21,
+20,7,22,51,50,54,55,54,53,53,38,38,53,16,33,32,17,20,7,39,54,53,52,35,34,
+21,20,22,23,21,20,7,6,7,6,35,34,39,6,35,34,53,52,51,50,2,122,50,165,4,1,144,
+195,195,121,34,254,255,1,104,1,104,106,134,69,26,30,46,127,20,18,2,54,1,94,
+1,94,144,106,80,180,190,53,3,53,71,127,53,51,71,68,49,51,232,129,57,227,61,
+54,90,79,99,1,1,99,139,180,200,152,46,107,45,1,4,1,114,254,162,145,128,87,
+141,116,74,12,76,57,51,49,10,53,183,164,1,154,254,182,178,130,75,75,158,160,
+240,162,184,93,8,89,83,111,42,18,35,35,100,150,0,2,254,212,0,0,7,24,4,176,
+0,15,0,99,0,0,2,21,20,22,22,51,50,54,54,53,52,38,38,35,34,6,0,35,34,21,20,
+22,21,16,33,35,34,38,38,53,52,54,54,51,50,22,22,21,20,7,54,53,52,38,53,16,
+33,32,17,20,6,21,22,51,50,53,38,39,38,53,52,55,54,51,50,23,54,53,52,39,38,
+53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,23,22,21,20,7,7,21,16,33,32,3,
+52,54,53,150,40,71,39,39,71,40,40,72,38,38,71,3,194,216,216,104,254,92,105,
+78,143,79,81,143,76,75,144,81,39,114,104,1,110,1,110,230,16,182,182,117,25,
+5,77,26,23,59,30,45,16,44,1,64,1,34,161,55,66,145,155,58,18,81,58,254,173,
+254,173,2,230,1,83,39,39,71,40,40,71,39,39,72,39,39,2,107,146,78,226,120,
+254,52,79,143,78,78,145,77,77,145,78,78,71,76,233,110,204,110,1,60,254,162,
+148,222,150,180,212,11,102,21,18,68,19,6,44,23,39,23,29,77,130,1,60,254,196,
+150,86,106,38,92,146,146,78,134,44,41,84,72,29,40,254,150,1,74,206,226,88,
+0,1,0,100,0,0,6,178,4,176,0,45,0,0,1,52,35,34,21,20,23,7,38,53,16,33,32,17,
+20,2,21,22,51,50,53,52,38,53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,22,
+21,16,33,32,3,52,18,2,128,175,195,120,53,237,1,104,1,84,207,16,232,232,89,
+1,109,1,109,157,63,70,215,215,89,254,123,254,123,2,197,3,102,160,200,122,
+31,112,35,230,1,114,254,182,148,254,220,120,160,212,208,184,130,1,60,254,
+196,150,79,91,46,92,146,146,78,206,238,254,150,1,54,176,1,40,0,0,1,0,100,
+0,0,9,180,4,176,0,54,0,0,1,52,35,34,21,20,23,7,38,53,16,33,32,17,20,2,21,
+22,51,50,53,52,38,53,16,33,50,23,54,33,32,17,16,7,39,54,53,52,33,34,7,35,
+38,35,34,21,20,18,21,16,33,32,3,52,18,2,128,175,195,120,53,237,1,104,1,84,
+207,16,232,222,79,1,121,255,88,91,1,20,1,157,213,75,128,254,249,254,64,92,
+52,222,233,69,254,133,254,123,2,197,3,102,160,200,122,31,112,35,230,1,114,
+254,182,148,254,220,120,160,186,144,210,110,1,144,179,179,254,112,254,251,
+129,110,95,185,230,200,200,230,122,254,252,82,254,176,1,54,176,1,40,0,0,1,
+0,100,0,0,6,85,4,176,0,64,0,0,1,54,53,52,38,53,16,33,32,17,20,7,39,54,53,
+52,35,34,21,20,22,21,20,7,23,7,39,6,21,20,23,7,36,3,52,54,55,54,53,52,39,
+6,21,20,23,7,38,17,16,33,32,17,20,7,6,6,21,22,23,38,53,52,55,39,55,3,239,
+18,94,1,89,1,89,157,63,70,195,195,94,46,154,90,161,33,27,51,254,38,20,79,
+30,2,167,165,96,78,178,1,60,1,79,1,30,79,20,186,9,73,125,90,2,16,37,35,80,
+144,100,1,20,254,196,150,79,91,46,92,146,106,68,146,110,93,70,115,120,120,
+51,48,106,25,92,70,1,74,113,198,129,16,15,147,11,14,185,172,40,95,47,1,4,
+1,111,254,195,19,21,135,188,117,178,57,39,36,101,72,93,120,0,1,0,100,255,
+12,6,174,4,176,0,111,0,0,1,39,55,23,54,53,52,38,53,16,33,32,17,20,7,39,54,
+53,52,35,34,21,20,22,21,20,7,22,23,22,21,20,7,6,21,20,23,22,51,50,55,54,54,
+55,54,51,50,23,22,21,20,7,39,54,53,52,39,38,35,34,7,6,6,7,6,35,34,39,38,53,
+52,55,54,53,52,39,38,39,6,21,20,7,36,3,52,54,55,54,53,52,39,6,21,20,23,7,
+38,17,16,33,32,17,20,7,6,6,21,22,23,38,53,52,3,145,93,41,142,22,44,1,109,
+1,108,157,63,70,214,215,44,50,41,17,12,3,17,9,11,29,12,16,61,34,106,46,39,
+105,43,6,44,120,30,2,10,24,9,11,41,48,106,53,43,114,43,16,20,3,9,4,7,42,24,
+254,38,20,79,30,2,167,165,96,78,178,1,60,1,79,1,30,79,20,186,9,1,158,43,128,
+63,40,38,80,144,100,1,20,254,196,150,79,91,46,92,146,106,68,146,110,96,72,
+47,54,41,45,23,25,108,69,49,29,34,6,23,245,40,17,134,19,25,68,114,48,77,36,
+9,7,30,4,16,250,40,20,137,51,71,78,102,25,23,38,29,14,11,58,54,106,117,70,
+1,74,113,198,129,16,15,147,11,14,185,172,40,95,47,1,4,1,111,254,195,19,21,
+135,188,117,178,57,39,36,102,0,0,2,0,100,255,7,6,174,4,176,0,14,0,102,0,0,
+1,6,21,20,23,6,21,20,23,51,50,53,52,39,38,3,51,22,23,55,23,7,22,23,22,21,
+20,7,6,7,6,35,34,3,53,52,55,38,39,6,7,6,21,20,23,7,36,3,52,54,55,54,53,52,
+39,6,21,20,23,7,38,17,16,33,32,17,20,7,6,6,21,22,23,38,53,52,55,54,55,39,
+55,23,38,39,38,53,16,33,32,17,20,7,39,54,53,52,35,34,21,20,22,21,20,4,241,
+44,3,1,65,5,51,5,25,140,1,32,31,38,95,39,129,25,9,143,22,25,9,9,187,22,94,
+25,18,18,24,88,27,51,254,38,20,79,30,2,167,165,96,78,178,1,60,1,79,1,30,79,
+20,186,9,80,52,27,146,64,108,4,11,17,1,89,1,118,157,63,70,224,195,34,1,34,
+77,117,32,34,13,12,106,5,103,31,41,149,1,96,19,43,60,76,68,179,157,56,47,
+187,38,5,3,1,1,4,18,220,151,22,15,27,23,86,78,106,25,92,70,1,74,113,198,129,
+16,15,147,11,14,185,172,40,95,47,1,4,1,111,254,195,19,21,135,188,117,178,
+57,39,36,106,73,47,44,74,126,58,52,48,72,100,1,20,254,196,150,79,91,46,92,
+146,106,68,146,110,15,0,0,1,0,100,0,0,9,106,4,176,0,59,0,0,0,23,22,21,20,
+7,6,7,6,5,35,39,54,18,55,38,35,34,21,20,23,7,38,17,16,33,32,19,16,7,54,55,
+54,53,52,39,38,53,16,33,50,23,54,33,32,17,16,7,39,54,53,52,33,34,7,35,38,
+35,34,21,4,46,14,9,9,20,50,92,254,174,112,27,100,45,10,10,170,170,103,57,
+196,1,74,1,54,10,85,168,60,49,7,25,1,121,255,88,91,1,20,1,157,213,75,128,
+254,249,254,64,92,52,222,233,2,186,105,51,49,50,47,94,86,161,55,121,118,1,
+84,211,240,200,172,43,115,70,1,4,1,114,254,102,254,62,184,27,112,91,107,40,
+42,155,70,1,144,179,179,254,112,254,251,129,110,95,185,230,200,200,230,0,
+0,2,254,212,0,0,3,193,4,176,0,15,0,53,0,0,3,20,22,22,51,50,54,54,53,52,38,
+38,35,34,6,6,1,20,22,21,16,33,35,34,38,38,53,52,54,54,51,50,22,22,21,20,7,
+54,53,52,38,53,16,33,32,17,20,7,39,54,53,52,35,34,150,40,71,39,39,71,40,40,
+72,38,38,71,41,2,59,104,254,92,105,78,143,79,81,143,76,75,144,81,39,114,104,
+1,89,1,89,157,63,70,195,195,1,44,39,71,40,40,71,39,39,72,39,39,72,2,33,78,
+226,120,254,52,79,143,78,78,145,77,77,145,78,78,71,76,233,110,204,110,1,60,
+254,196,150,79,91,46,92,146,0,1,0,100,255,255,5,240,4,176,0,57,0,0,1,20,22,
+23,39,54,54,55,54,51,50,23,22,22,23,22,21,20,7,6,6,7,6,35,34,39,38,53,16,
+37,54,51,50,23,22,51,50,55,54,51,32,17,20,7,39,54,53,52,35,34,7,6,35,34,39,
+38,35,34,1,4,98,92,1,10,53,29,10,11,18,20,30,41,6,2,6,11,48,30,34,32,220,
+112,86,1,67,25,16,137,110,54,54,55,55,110,135,1,90,148,102,90,186,122,97,
+48,88,86,48,97,114,214,2,115,165,254,41,6,51,29,6,2,6,11,52,33,12,12,21,24,
+37,44,6,4,231,178,219,2,20,37,4,70,35,35,70,254,112,201,166,89,113,165,230,
+60,30,30,60,0,0,2,0,100,255,7,6,85,4,176,0,14,0,97,0,0,1,6,21,20,23,6,21,
+20,23,51,50,53,52,39,38,3,22,23,55,23,7,22,23,22,21,20,7,6,7,6,35,34,3,53,
+52,55,38,39,6,7,6,21,20,23,7,36,3,52,54,55,54,53,52,39,6,21,20,23,7,38,17,
+16,33,32,17,20,7,6,6,21,22,23,38,53,52,55,54,53,52,38,53,16,33,32,17,20,7,
+39,54,53,52,35,34,21,20,22,21,20,4,241,44,3,1,65,5,51,5,25,140,36,28,38,95,
+39,129,25,9,143,22,25,9,9,187,22,94,21,21,18,25,88,27,51,254,38,20,79,30,
+2,167,165,96,78,178,1,60,1,79,1,30,79,20,186,9,80,107,94,1,89,1,89,157,63,
+70,195,195,94,1,34,77,117,32,34,13,12,106,5,103,31,41,149,1,100,28,38,60,
+76,68,179,157,56,47,187,38,5,3,1,1,4,18,220,151,24,15,28,24,86,78,106,25,
+92,70,1,74,113,198,129,16,15,147,11,14,185,172,40,95,47,1,4,1,111,254,195,
+19,21,135,188,117,178,57,39,36,106,73,97,84,80,144,100,1,20,254,196,150,79,
+91,46,92,146,106,68,146,110,13,0,0,1,0,100,0,0,6,174,4,176,0,69,0,0,1,34,
+21,20,51,50,55,54,54,51,50,22,22,21,20,6,6,35,32,53,16,33,32,17,20,7,6,6,
+21,22,23,38,53,52,55,54,53,52,38,53,16,33,32,17,20,7,39,54,53,52,35,34,21,
+20,22,21,20,6,21,20,23,7,36,3,52,54,55,54,53,52,1,210,216,7,3,3,12,50,32,
+31,60,34,33,60,32,254,255,1,114,1,114,1,30,79,20,186,9,80,107,94,1,89,1,89,
+157,63,70,195,195,94,176,27,51,254,38,20,79,30,2,4,6,200,47,5,18,22,32,60,
+33,33,59,33,252,1,114,254,192,19,21,135,188,117,178,57,39,36,106,73,97,84,
+80,144,100,1,20,254,196,150,79,91,46,92,146,106,68,146,110,128,171,78,106,
+25,92,70,1,74,113,198,129,16,15,159,0,2,254,212,0,0,6,105,4,176,0,15,0,71,
+0,0,2,21,20,22,22,51,50,54,54,53,52,38,38,35,34,6,1,20,22,21,16,33,35,34,
+38,38,53,52,54,54,51,50,22,22,21,20,7,54,53,52,38,53,16,37,54,51,50,23,22,
+51,50,55,54,51,32,17,20,7,39,54,53,52,35,34,7,6,35,34,39,38,35,34,150,40,
+71,39,39,71,40,40,72,38,38,71,1,234,134,254,102,105,78,143,79,81,143,76,75,
+144,81,19,84,144,1,67,25,16,137,110,54,54,55,55,110,135,1,90,148,102,90,186,
+122,97,48,88,86,48,97,114,214,1,83,39,39,71,40,40,71,39,39,72,39,39,1,157,
+58,226,120,254,92,79,143,78,78,145,77,77,145,78,58,51,36,193,110,204,90,1,
+79,37,4,70,35,35,70,254,112,201,166,89,113,165,230,60,30,30,60,0,0,2,254,
+212,0,0,6,75,4,176,0,15,0,72,0,0,2,21,20,22,22,51,50,54,54,53,52,38,38,35,
+34,6,36,33,34,38,38,53,52,54,54,51,50,22,23,54,53,52,35,34,7,35,38,35,34,
+21,20,22,21,16,33,35,34,38,38,53,52,54,54,51,50,22,22,21,20,7,54,53,52,38,
+53,16,33,50,23,54,51,32,17,150,40,71,39,39,71,40,40,72,38,38,71,6,184,254,
+142,32,60,33,34,60,41,42,60,13,85,213,224,64,92,52,202,223,134,254,102,105,
+78,143,79,81,143,76,75,144,81,19,84,144,1,111,235,88,91,246,1,107,1,83,39,
+39,71,40,40,71,39,39,72,39,39,29,33,59,33,33,60,32,46,46,50,182,200,200,200,
+206,58,226,120,254,92,79,143,78,78,145,77,77,145,78,58,51,36,193,110,204,
+90,1,120,179,179,254,142,0,0,1,253,211,4,121,0,63,7,198,0,19,0,0,0,53,16,
+33,32,17,20,35,39,54,53,52,35,34,21,20,4,23,35,52,253,211,1,59,1,49,236,18,
+104,170,150,1,51,2,152,5,180,220,1,54,254,232,245,109,14,122,110,140,158,
+200,177,125,0,2,252,192,4,176,255,174,7,189,0,19,0,42,0,0,1,54,53,52,39,38,
+35,34,7,6,21,20,23,22,51,50,55,54,51,50,37,38,53,16,37,54,51,32,19,22,21,
+20,7,6,7,35,38,35,34,7,6,35,34,254,231,35,4,32,163,24,28,172,9,14,76,24,31,
+38,36,85,254,48,12,1,56,40,37,1,43,55,7,24,39,24,99,65,139,45,53,47,39,137,
+5,145,59,82,28,30,188,4,27,157,35,42,84,8,11,1,70,61,1,66,40,5,254,169,46,
+44,80,73,114,81,142,15,13,0,0,3,252,192,4,176,255,174,7,189,0,15,0,35,0,58,
+0,0,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,19,54,53,52,39,38,35,34,
+7,6,21,20,23,22,51,50,55,54,51,50,37,38,53,16,37,54,51,32,19,22,21,20,7,6,
+7,35,38,35,34,7,6,35,34,254,85,28,53,30,29,53,29,29,54,29,30,54,174,35,4,
+32,163,24,28,172,9,14,76,24,31,38,36,85,254,48,12,1,56,40,37,1,43,55,7,24,
+39,24,99,65,139,45,53,47,39,137,6,182,26,48,26,26,48,26,26,48,26,26,48,26,
+254,219,59,82,28,30,188,4,27,157,35,42,84,8,11,1,70,61,1,66,40,5,254,169,
+46,44,80,73,114,81,142,15,13,0,0,2,252,192,4,176,0,170,7,189,0,22,0,49,0,
+0,3,6,7,39,54,55,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,54,55,54,55,
+23,6,7,21,20,7,6,7,35,38,35,34,7,6,35,34,39,38,53,16,37,54,51,32,247,42,45,
+27,50,46,46,134,24,28,172,9,14,76,24,31,38,36,85,75,29,147,151,65,59,89,163,
+24,39,24,99,65,139,45,53,47,39,137,27,12,1,56,40,37,1,9,6,2,3,1,139,5,6,128,
+4,27,157,35,42,84,8,11,57,49,237,32,45,115,78,34,13,80,73,114,81,142,15,13,
+169,70,61,1,66,40,5,0,0,1,253,253,0,67,0,56,2,18,0,30,0,0,3,55,22,21,20,7,
+14,2,7,6,7,6,21,20,23,7,38,53,52,55,54,55,54,54,55,54,55,54,53,52,82,120,
+18,1,7,104,235,29,32,13,10,1,121,20,2,6,42,55,244,31,33,13,9,2,4,14,41,56,
+16,16,97,70,26,21,23,24,18,23,8,9,15,46,57,14,15,74,30,40,22,22,25,39,27,
+20,10,0,0,1,254,92,5,130,0,146,7,44,0,13,0,0,1,55,54,53,52,39,23,22,21,6,
+7,6,35,35,254,92,190,227,6,152,3,2,212,199,78,10,6,19,37,48,145,24,27,18,
+20,19,248,62,59,0,0,1,0,100,1,44,3,142,4,176,0,27,0,0,19,16,33,32,17,20,7,
+39,54,53,52,35,34,17,20,23,54,54,51,50,22,22,21,20,6,6,35,32,100,1,149,1,
+149,250,35,135,255,245,81,23,44,32,31,60,34,33,60,32,254,172,2,238,1,194,
+254,162,201,49,100,55,95,180,254,232,232,19,36,15,32,60,33,33,59,33,0,2,0,
+100,255,240,3,142,4,176,0,27,0,58,0,0,19,16,33,32,17,20,7,39,54,53,52,35,
+34,17,20,23,54,54,51,50,22,22,21,20,6,6,35,32,37,55,22,21,20,7,14,2,7,6,7,
+6,21,20,23,7,38,53,52,55,54,55,54,54,55,54,55,54,53,52,100,1,149,1,149,250,
+35,135,255,245,81,23,44,32,31,60,34,33,60,32,254,172,2,160,120,18,1,7,104,
+235,29,32,13,10,1,121,20,2,6,42,55,244,31,33,13,9,2,238,1,194,254,162,201,
+49,100,55,95,180,254,232,232,19,36,15,32,60,33,33,59,33,133,14,41,56,16,16,
+97,70,26,21,23,24,18,23,8,9,15,46,57,14,15,74,30,40,22,22,25,39,27,20,10,
+0,0,1,253,115,4,208,0,9,7,205,0,46,0,0,3,23,20,7,6,35,34,39,38,35,34,7,6,
+21,20,23,22,51,50,55,54,55,23,22,21,20,7,7,54,55,6,7,6,35,34,39,38,53,52,
+55,54,51,50,23,22,51,50,90,91,83,35,101,27,33,53,40,61,31,30,35,39,49,35,
+41,96,30,172,5,47,144,15,15,10,35,97,94,85,82,98,59,67,183,25,28,17,16,89,
+7,205,39,109,128,49,4,8,19,44,50,53,59,68,35,83,120,28,33,34,115,169,18,92,
+82,29,31,100,79,95,112,88,97,113,2,6,0,0,1,254,177,255,173,255,198,1,231,
+0,12,0,0,1,52,51,50,21,21,16,7,39,54,54,53,34,254,177,145,132,247,23,86,37,
+130,1,107,124,142,106,254,220,30,114,14,128,66,0,1,255,21,1,36,2,238,4,176,
+0,33,0,0,3,22,22,23,54,53,52,39,38,53,16,33,32,17,20,7,39,54,53,52,35,34,
+21,20,23,22,21,20,7,6,7,39,38,39,206,121,155,23,21,22,42,1,94,1,94,144,106,
+80,180,190,24,27,3,26,126,97,71,173,2,186,12,127,80,39,21,45,45,97,124,1,
+94,254,182,178,130,75,75,158,160,180,122,55,70,55,21,18,125,92,49,202,21,
+0,0,1,255,211,254,89,4,15,6,67,0,53,0,0,18,55,54,55,38,39,38,35,34,7,6,21,
+21,35,54,54,51,50,22,23,22,51,50,55,23,6,2,2,17,16,18,23,54,51,50,22,22,51,
+50,55,23,6,6,35,34,38,38,35,34,7,39,38,2,17,100,52,51,149,115,29,25,34,8,
+8,44,134,5,126,63,62,102,50,12,16,52,93,131,86,202,109,95,148,56,35,35,61,
+68,45,91,5,130,3,134,97,31,71,63,45,45,75,23,193,159,3,64,162,161,213,15,
+40,33,2,9,45,2,106,99,62,20,5,48,80,41,254,212,254,168,254,252,254,251,254,
+196,191,31,16,58,100,30,113,108,31,26,42,20,244,1,134,1,37,0,1,253,141,254,
+28,0,24,0,147,0,31,0,0,1,54,51,51,22,23,22,21,20,6,34,38,52,54,4,51,50,54,
+55,23,6,6,7,6,35,34,39,38,35,34,21,20,254,67,20,51,12,61,29,11,62,204,100,
+103,1,7,50,50,40,4,141,1,78,89,47,53,49,53,11,9,81,254,252,30,4,62,27,26,
+36,99,142,180,147,1,106,57,20,131,145,12,6,5,1,76,11,0,0,2,254,148,254,56,
+0,56,0,232,0,14,0,39,0,0,7,6,7,6,21,20,23,22,51,50,55,54,55,53,52,55,22,23,
+22,21,20,7,6,7,35,34,39,38,53,52,55,54,55,54,55,38,39,55,22,23,97,79,34,22,
+6,12,35,14,19,63,5,107,21,3,3,64,76,92,2,90,51,45,1,9,57,80,81,18,27,122,
+33,25,33,53,73,48,40,20,18,38,7,22,147,5,49,130,60,51,33,30,140,85,93,1,62,
+53,81,13,14,99,79,111,39,42,49,46,59,55,0,1,0,77,255,232,6,64,4,176,0,35,
+0,0,0,35,34,21,20,23,22,21,20,7,6,7,39,54,53,52,38,53,16,33,50,23,54,33,32,
+17,16,5,39,54,17,16,33,34,7,35,2,203,222,233,51,24,13,31,112,102,94,71,1,
+121,255,88,91,1,20,1,157,254,202,85,235,254,249,254,64,92,4,6,230,122,165,
+95,85,64,58,137,98,42,173,145,144,210,110,1,144,179,179,254,12,254,51,239,
+108,207,1,129,1,74,200,0,0,1,0,100,255,255,6,64,4,176,0,48,0,0,1,16,5,39,
+54,17,16,33,34,7,35,38,35,34,17,20,22,23,39,54,54,55,54,51,50,23,22,22,23,
+22,21,20,7,6,6,7,6,35,34,39,38,53,16,33,50,23,54,33,32,6,64,254,202,85,235,
+254,249,254,64,92,52,222,233,98,92,1,10,53,29,10,11,18,20,30,41,6,2,6,11,
+48,30,34,32,220,112,86,1,121,255,88,91,1,20,1,157,2,188,254,51,239,108,207,
+1,129,1,74,200,200,254,109,165,254,41,6,51,29,6,2,6,11,52,33,12,12,21,24,
+37,44,6,4,231,178,219,2,61,179,179,0,0,2,0,100,255,225,5,200,4,176,0,13,0,
+75,0,0,1,38,35,34,7,6,21,20,23,22,23,54,53,52,1,39,54,55,54,53,52,39,39,52,
+55,54,53,52,35,34,21,20,23,7,36,17,16,33,32,17,20,7,22,21,20,7,54,19,38,39,
+38,53,53,54,51,50,23,22,21,20,7,22,21,20,7,2,7,39,54,54,55,54,53,52,39,2,
+4,178,10,30,30,3,2,17,22,26,12,254,81,112,44,23,6,215,4,1,144,195,195,140,
+53,254,255,1,104,1,104,106,184,10,211,75,87,41,50,15,158,158,19,1,9,142,13,
+57,136,116,64,77,34,13,37,103,3,236,46,20,15,14,43,33,45,8,36,53,20,252,43,
+95,74,88,23,22,130,79,99,1,1,99,139,180,200,152,41,112,45,1,4,1,114,254,162,
+145,128,87,141,54,52,154,1,74,32,68,82,114,9,168,183,23,23,83,79,49,204,63,
+76,254,173,109,99,40,166,186,68,44,76,4,254,34,0,1,254,110,5,87,0,172,7,169,
+0,5,0,0,1,0,55,23,6,1,254,110,1,128,57,133,22,254,80,5,221,1,51,153,48,223,
+254,189,0,2,0,100,255,155,6,64,4,176,0,6,0,48,0,0,1,6,21,20,51,50,54,19,20,
+7,54,55,18,33,32,17,16,1,39,0,17,16,35,34,7,2,7,2,6,35,34,39,54,55,55,54,
+53,52,35,34,21,20,23,7,36,17,16,33,32,2,116,166,45,43,61,209,3,63,20,2,1,
+92,1,94,254,31,85,1,150,190,174,16,19,245,30,168,91,191,10,10,254,75,15,195,
+195,140,53,254,255,1,104,1,104,1,180,111,115,59,168,1,225,51,72,27,126,1,
+114,254,12,254,51,254,172,108,1,52,1,129,1,74,200,254,254,81,254,216,195,
+210,210,142,44,97,97,230,200,152,41,112,45,1,4,1,114,0,0,2,0,100,0,0,6,64,
+4,176,0,15,0,55,0,0,1,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,7,2,53,16,
+33,50,23,54,33,32,17,16,5,39,54,17,16,33,34,7,35,38,35,34,17,20,23,54,54,
+51,50,22,22,21,20,6,6,35,34,38,1,114,53,95,52,52,95,53,54,96,50,50,96,54,
+194,76,1,121,255,88,91,1,20,1,157,254,202,85,235,254,249,254,64,92,52,222,
+233,17,57,147,89,88,167,95,92,167,91,141,187,1,94,52,95,53,53,95,52,52,96,
+52,52,96,109,1,0,171,1,224,179,179,254,12,254,51,239,108,207,1,129,1,74,200,
+200,254,202,82,82,74,70,90,169,91,91,167,92,112,0,2,0,100,255,155,6,124,4,
+176,0,6,0,66,0,0,1,6,21,20,51,50,54,55,6,7,6,35,34,39,54,55,55,54,53,52,35,
+34,21,20,23,7,36,17,16,33,32,17,20,7,22,23,22,23,54,53,52,39,38,53,16,33,
+32,17,16,1,39,0,17,16,35,34,21,20,23,22,21,20,7,6,7,39,38,2,116,166,45,43,
+61,177,29,77,84,91,191,10,10,254,75,15,195,195,140,53,254,255,1,104,1,104,
+16,64,46,57,32,21,22,42,1,94,1,94,254,31,85,1,140,180,190,24,27,3,26,126,
+97,34,1,180,111,115,59,168,109,241,89,98,210,210,142,44,97,97,230,200,152,
+41,112,45,1,4,1,114,254,112,39,173,12,52,65,80,39,21,45,45,97,164,1,154,254,
+12,254,51,254,172,108,1,52,1,129,1,74,240,162,55,70,55,21,18,125,92,49,118,
+0,2,254,212,0,0,6,135,4,176,0,15,0,62,0,0,2,21,20,22,22,51,50,54,54,53,52,
+38,38,35,34,6,1,20,22,21,16,33,35,34,38,38,53,52,54,54,51,50,22,22,21,20,
+7,54,53,52,38,53,16,33,50,23,54,33,32,17,16,5,39,54,17,16,35,34,7,35,38,35,
+34,150,40,71,39,39,71,40,40,72,38,38,71,1,234,134,254,102,105,78,143,79,81,
+143,76,75,144,81,19,84,144,1,111,255,88,91,1,0,1,137,254,202,85,235,243,234,
+64,92,52,222,223,1,83,39,39,71,40,40,71,39,39,72,39,39,1,157,58,226,120,254,
+92,79,143,78,78,145,77,77,145,78,58,51,36,193,110,204,90,1,120,179,179,254,
+12,254,51,239,108,207,1,129,1,74,200,200,0,1,0,100,0,0,9,106,4,176,0,59,0,
+0,0,23,22,21,20,7,6,7,6,5,35,39,54,18,55,38,35,34,21,20,23,7,38,17,16,33,
+32,19,16,7,54,55,54,53,52,39,38,53,16,33,50,23,54,33,32,17,16,5,39,54,17,
+16,33,34,7,35,38,35,34,21,4,46,14,9,9,20,50,92,254,174,112,27,100,45,10,10,
+170,170,103,57,196,1,74,1,54,10,85,168,60,49,7,25,1,121,255,88,91,1,20,1,
+157,254,202,85,235,254,249,254,64,92,52,222,233,2,186,105,51,49,50,47,94,
+86,161,55,121,118,1,84,211,240,200,172,43,115,70,1,4,1,114,254,102,254,62,
+184,27,112,91,107,40,42,155,70,1,144,179,179,254,12,254,51,239,108,207,1,
+129,1,74,200,200,230,0,2,254,212,255,155,3,193,4,176,0,15,0,51,0,0,3,20,22,
+22,51,50,54,54,53,52,38,38,35,34,6,6,1,20,22,21,20,0,35,34,38,38,53,52,54,
+54,51,50,22,22,21,54,53,52,38,53,16,33,32,17,16,1,39,0,17,16,35,34,150,40,
+71,39,39,71,40,40,72,38,38,71,41,2,59,104,254,192,205,78,143,79,81,143,76,
+75,144,81,75,104,1,89,1,89,254,61,85,1,110,175,195,1,44,39,71,40,40,71,39,
+39,72,39,39,72,2,33,78,186,90,200,254,182,79,143,78,78,145,77,77,145,78,67,
+163,80,164,110,1,60,254,12,254,51,254,172,108,1,52,1,129,1,74,0,0,1,0,100,
+255,255,5,240,4,176,0,57,0,0,1,20,22,23,39,54,54,55,54,51,50,23,22,22,23,
+22,21,20,7,6,6,7,6,35,34,39,38,53,16,37,54,51,50,23,22,51,50,55,54,51,32,
+17,16,5,39,54,17,16,35,34,7,6,35,34,39,38,35,34,1,4,98,92,1,10,53,29,10,11,
+18,20,30,41,6,2,6,11,48,30,34,32,220,112,86,1,67,25,16,137,110,54,54,55,55,
+110,135,1,90,254,202,85,235,186,122,97,48,88,86,48,97,114,214,2,115,165,254,
+41,6,51,29,6,2,6,11,52,33,12,12,21,24,37,44,6,4,231,178,219,2,20,37,4,70,
+35,35,70,254,12,254,51,239,108,207,1,129,1,74,60,30,30,60,0,0,1,0,100,0,0,
+6,174,4,176,0,69,0,0,1,34,21,20,51,50,55,54,54,51,50,22,22,21,20,6,6,35,32,
+53,16,33,32,17,20,7,6,6,21,22,23,38,53,52,55,54,53,52,38,53,16,33,32,17,16,
+5,39,54,17,52,35,34,21,20,22,21,20,6,21,20,23,7,36,3,52,54,55,54,53,52,1,
+210,216,7,3,3,12,50,32,31,60,34,33,60,32,254,255,1,114,1,114,1,30,79,20,186,
+9,80,107,94,1,89,1,89,254,202,85,235,185,195,94,176,27,51,254,38,20,79,30,
+2,4,6,200,47,5,18,22,32,60,33,33,59,33,252,1,114,254,192,19,21,135,188,117,
+178,57,39,36,106,73,97,84,80,144,100,1,20,254,112,253,207,239,108,207,1,229,
+230,106,68,146,110,128,171,78,106,25,92,70,1,74,113,198,129,16,15,159,0,0,
+1,254,187,4,226,255,181,5,220,0,15,0,0,3,50,22,22,21,20,6,6,35,34,38,38,53,
+52,54,54,200,31,60,34,32,60,33,32,60,33,34,60,5,220,32,60,33,32,60,33,33,
+60,32,33,60,32,0,1,0,100,255,101,3,182,4,176,0,27,0,0,19,38,53,16,33,32,17,
+20,0,21,21,20,23,7,38,53,53,52,0,53,52,33,32,21,22,23,7,38,142,42,1,169,1,
+169,254,175,59,149,60,1,81,254,237,254,237,10,139,42,127,2,157,64,97,1,114,
+254,162,210,254,252,130,125,125,118,37,45,235,125,182,1,4,158,180,200,134,
+52,91,14,0,2,0,100,0,0,4,76,4,176,0,15,0,31,0,0,0,6,6,21,20,22,22,51,50,54,
+54,53,52,38,38,35,53,50,22,18,21,20,2,6,35,34,38,2,53,52,18,54,2,0,168,94,
+92,167,91,91,167,92,94,168,88,126,239,135,132,238,130,130,238,132,134,239,
+4,6,95,210,125,125,208,97,97,208,125,125,210,95,170,155,254,224,157,157,254,
+227,158,158,1,29,157,157,1,32,155,0,0,1,0,50,255,101,3,182,4,176,0,39,0,0,
+1,52,33,32,21,20,23,54,51,50,23,22,21,20,35,34,39,6,7,39,54,55,38,53,16,33,
+32,17,20,0,21,21,20,23,7,38,53,53,52,0,3,32,254,237,254,237,37,45,41,13,12,
+52,100,86,54,62,40,58,26,66,42,1,169,1,169,254,175,59,149,60,1,81,3,82,180,
+200,74,42,12,1,5,80,81,35,4,49,44,55,29,64,97,1,114,254,162,210,254,252,130,
+125,125,118,37,45,235,125,182,1,4,0,0,1,0,100,0,0,7,58,6,164,0,64,0,0,0,35,
+32,17,16,33,32,17,16,35,34,7,6,35,34,39,38,35,34,17,20,23,53,52,54,51,50,
+22,22,21,20,6,6,35,32,17,16,33,50,23,22,51,50,55,54,51,32,17,16,33,32,17,
+16,33,50,23,22,51,50,19,23,0,35,34,39,3,130,198,254,62,2,213,2,213,255,162,
+91,46,46,45,46,91,163,255,85,73,52,31,60,34,33,60,32,254,152,1,149,133,106,
+53,53,53,54,106,132,1,149,252,149,252,149,2,88,226,120,58,58,183,192,133,
+254,246,235,87,82,5,70,253,168,253,168,2,98,1,14,60,30,30,60,254,202,182,
+49,6,33,42,32,60,33,33,59,33,1,144,1,224,70,35,35,70,254,72,253,8,2,238,2,
+238,65,30,1,39,104,254,158,48,0,1,0,100,254,12,6,64,4,176,0,72,0,0,19,16,
+37,54,51,50,23,22,51,50,55,54,51,32,17,16,5,4,21,20,51,50,18,51,50,23,22,
+21,20,7,39,54,55,53,52,35,34,7,6,2,35,34,17,16,37,36,17,52,35,34,7,6,35,34,
+39,38,35,34,17,20,23,54,54,51,50,22,22,21,20,6,6,35,32,100,1,85,27,17,144,
+116,57,58,58,58,116,143,1,109,254,18,254,16,66,117,245,135,165,19,5,94,124,
+70,1,63,7,8,69,207,185,224,2,108,1,105,198,129,103,51,92,91,51,103,120,225,
+71,23,44,32,31,60,34,33,60,32,254,172,2,238,1,153,37,4,70,35,35,70,254,105,
+254,105,213,218,155,140,1,94,138,38,34,140,137,48,103,88,2,67,1,10,254,192,
+1,44,1,45,234,176,1,9,254,60,30,30,60,254,232,232,19,36,15,32,60,33,33,59,
+33,0,0,2,0,100,255,216,4,251,4,6,0,50,0,67,0,0,55,38,39,38,53,52,55,54,55,
+54,51,50,23,22,51,50,55,23,2,35,34,39,38,35,34,7,6,7,6,21,20,23,54,54,55,
+51,50,23,22,21,21,6,7,6,35,34,39,38,39,7,39,55,22,23,22,51,50,55,54,55,53,
+52,39,38,35,34,7,6,190,75,13,2,47,68,159,49,54,121,148,91,77,157,93,111,132,
+222,105,126,124,81,43,31,90,36,18,22,21,137,81,2,80,70,71,1,89,68,80,26,26,
+111,50,63,90,219,21,71,40,31,22,17,39,2,68,26,22,37,24,39,174,130,146,26,
+26,117,109,154,65,20,102,51,216,81,254,213,67,71,19,58,108,52,57,65,72,70,
+72,1,67,69,120,2,122,70,54,5,22,74,137,102,148,27,25,15,8,18,80,4,77,19,7,
+22,34,0,0,2,0,100,0,0,4,57,4,176,0,7,0,51,0,0,37,38,35,34,21,20,51,50,0,53,
+16,33,32,17,20,7,22,21,20,7,22,23,7,38,39,6,35,34,39,38,53,52,55,54,51,51,
+22,23,54,53,52,39,53,54,53,52,33,32,17,20,23,7,3,0,47,51,90,60,93,253,135,
+1,169,1,169,125,125,5,70,66,26,44,83,53,235,180,9,1,53,60,75,3,77,69,3,150,
+150,254,252,254,242,45,103,165,5,25,25,1,218,156,1,194,254,112,171,99,83,
+127,23,37,17,52,100,42,14,147,104,13,13,84,41,45,1,7,17,11,142,38,76,59,165,
+230,254,232,141,59,59,0,0,2,254,212,0,0,3,193,4,176,0,15,0,53,0,0,3,20,22,
+22,51,50,54,54,53,52,38,38,35,34,6,6,1,20,22,21,16,33,35,34,38,38,53,52,54,
+54,51,50,22,22,21,20,7,54,53,52,38,53,16,33,32,17,20,7,39,54,53,52,35,34,
+150,40,71,39,39,71,40,40,72,38,38,71,41,2,59,104,254,92,105,78,143,79,81,
+143,76,75,144,81,39,114,104,1,89,1,89,157,63,70,195,195,1,44,39,71,40,40,
+71,39,39,72,39,39,72,2,33,78,226,120,254,52,79,143,78,78,145,77,77,145,78,
+78,71,76,233,110,204,110,1,60,254,196,150,79,91,46,92,146,0,2,254,212,254,
+12,4,76,4,176,0,7,0,60,0,0,3,20,51,50,53,52,35,34,1,20,22,21,16,33,35,32,
+17,16,33,32,17,20,7,54,53,52,38,53,16,33,32,17,16,0,21,20,51,50,54,51,50,
+21,20,7,39,54,55,53,52,35,34,6,35,34,17,52,0,17,16,35,34,150,120,120,120,
+120,1,255,104,254,152,135,254,242,1,14,1,14,39,114,104,1,149,1,128,254,22,
+66,67,175,115,167,72,124,60,1,53,54,167,115,224,1,242,234,255,1,44,150,150,
+150,1,178,78,226,120,254,52,1,44,1,44,254,212,78,71,76,233,110,204,110,1,
+60,254,82,254,188,254,71,245,100,240,155,155,87,78,83,43,1,42,250,1,4,241,
+1,254,1,3,1,4,0,0,2,0,100,254,12,6,64,4,176,0,6,0,69,0,0,1,6,21,20,51,50,
+54,19,20,7,54,55,18,33,32,17,16,0,21,20,51,50,54,51,50,21,20,7,39,54,55,53,
+52,35,34,6,35,34,17,52,0,17,52,35,34,7,2,7,2,6,35,34,39,54,55,55,54,53,52,
+35,34,21,20,23,7,36,17,16,33,32,2,116,166,45,43,61,209,3,63,20,2,1,92,1,94,
+253,58,66,67,175,115,167,72,124,60,1,53,54,167,115,224,2,196,190,174,16,19,
+245,30,168,91,191,10,10,254,75,15,195,195,140,53,254,255,1,104,1,104,1,180,
+111,115,59,168,1,225,51,72,27,126,1,114,254,112,254,158,254,41,215,100,240,
+155,155,87,78,83,43,1,42,250,1,4,241,2,28,1,3,230,200,254,254,81,254,216,
+195,210,210,142,44,97,97,230,200,152,41,112,45,1,4,1,114,0,1,0,100,254,12,
+7,18,4,176,0,66,0,0,1,52,35,34,21,20,23,7,38,53,16,33,32,17,20,2,21,22,51,
+50,53,52,38,53,16,33,32,17,16,0,21,20,51,50,54,51,50,21,20,7,39,54,55,53,
+52,35,34,6,35,34,17,52,0,17,52,35,34,21,20,18,21,16,33,32,3,52,18,2,128,175,
+195,120,53,237,1,104,1,84,207,16,232,222,39,1,120,1,154,253,188,66,47,165,
+115,167,72,124,60,1,53,34,177,95,224,2,66,250,216,29,254,133,254,123,2,197,
+3,102,160,200,122,31,112,35,230,1,114,254,182,148,254,220,120,160,186,144,
+210,110,1,144,254,112,254,158,253,217,135,100,240,155,155,87,78,83,43,1,42,
+250,1,4,181,2,88,1,3,230,230,122,254,252,82,254,176,1,54,176,1,40,0,1,0,100,
+0,0,4,167,5,127,0,97,0,0,19,55,18,51,50,55,50,55,54,55,54,55,53,52,39,38,
+39,6,7,6,21,20,23,30,3,51,50,54,54,53,52,38,39,38,35,34,7,6,21,21,54,51,50,
+22,22,21,20,6,6,35,34,38,38,39,38,53,52,55,54,55,54,51,50,23,22,22,21,20,
+6,6,35,34,38,38,39,38,53,52,55,54,18,37,4,23,22,17,21,2,7,6,7,6,35,34,38,
+38,100,5,246,196,16,15,190,137,7,6,141,5,95,100,253,228,78,71,2,9,74,103,
+97,59,60,108,61,62,72,39,31,28,22,44,14,15,33,60,34,34,60,33,33,60,63,1,1,
+38,39,85,23,24,67,81,110,87,94,170,92,91,149,127,58,56,1,2,248,1,7,1,53,135,
+131,5,177,47,50,146,188,89,149,160,1,99,195,254,107,3,144,7,7,159,221,20,
+208,157,165,25,25,119,106,117,15,14,133,138,110,34,68,122,68,67,146,32,17,
+13,27,51,9,4,38,68,38,37,69,36,36,138,90,3,3,86,73,76,20,5,38,52,216,104,
+105,191,105,71,123,124,118,178,8,8,188,1,12,14,14,209,202,254,240,19,254,
+228,204,52,39,112,58,141,0,1,0,100,0,0,1,101,4,176,0,9,0,0,51,18,17,16,3,
+51,18,21,16,3,100,115,84,155,71,189,1,26,1,71,1,23,1,56,254,232,241,254,121,
+254,224,0,0,5,0,100,0,0,2,145,6,143,0,11,0,21,0,37,0,53,0,69,0,0,55,54,53,
+16,3,51,22,23,22,21,16,3,23,18,17,16,3,51,18,21,16,3,1,50,22,22,21,20,6,6,
+35,34,38,38,53,52,54,54,37,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,39,
+50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,180,48,118,158,52,23,17,115,155,
+115,84,155,71,189,254,244,25,48,27,26,48,26,26,48,26,27,48,1,21,25,48,27,
+26,48,26,26,48,26,27,48,117,25,48,27,26,48,26,26,48,26,27,48,100,221,216,
+1,82,1,69,157,145,108,109,254,229,254,214,100,1,26,1,71,1,23,1,56,254,232,
+241,254,121,254,224,5,160,26,48,26,26,48,26,26,48,26,26,48,26,5,26,48,26,
+26,48,26,26,48,26,26,48,26,234,26,48,26,26,48,26,26,48,26,26,48,26,0,0,3,
+0,100,0,0,3,195,4,176,0,10,0,22,0,32,0,0,1,53,16,3,51,22,23,22,21,20,7,23,
+54,53,16,3,51,22,23,22,21,20,7,23,18,17,16,3,51,18,21,16,3,1,37,193,161,30,
+23,75,25,142,36,126,158,52,23,19,97,135,115,84,155,71,189,1,144,27,1,125,
+1,136,70,67,221,207,120,115,200,163,171,1,64,1,90,157,145,118,112,251,217,
+200,1,26,1,71,1,23,1,56,254,232,241,254,121,254,224,0,0,1,253,141,255,142,
+0,24,2,5,0,31,0,0,37,54,51,51,22,23,22,21,20,6,34,38,52,54,4,51,50,54,55,
+23,6,6,7,6,35,34,39,38,35,34,21,20,254,67,20,51,12,61,29,11,62,204,100,103,
+1,7,50,50,40,4,141,1,78,89,47,53,49,53,11,9,81,110,30,4,62,27,26,36,99,142,
+180,147,1,106,57,20,131,145,12,6,5,1,76,11,0,2,254,90,255,103,255,254,2,23,
+0,14,0,39,0,0,3,6,7,6,21,20,23,22,51,50,55,54,55,53,52,55,22,23,22,21,20,
+7,6,7,35,34,39,38,53,52,55,54,55,54,55,38,39,55,22,23,155,79,34,22,6,12,35,
+14,19,63,5,107,21,3,3,64,76,92,2,90,51,45,1,9,57,80,81,18,27,122,33,25,1,
+14,53,73,48,40,20,18,38,7,22,147,5,49,130,60,51,33,30,140,85,93,1,62,53,81,
+13,14,99,79,111,39,42,49,46,59,55,0,0,2,251,142,4,208,0,9,7,215,0,13,0,60,
+0,0,1,55,54,53,52,39,23,22,21,6,7,6,35,35,1,23,20,7,6,35,34,39,38,35,34,7,
+6,21,20,23,22,51,50,55,54,55,23,22,21,20,7,7,54,55,6,7,6,35,34,39,38,53,52,
+55,54,51,50,23,22,51,50,251,142,190,227,6,152,3,2,212,199,78,10,3,215,91,
+83,35,101,27,33,53,40,61,31,30,35,39,49,35,41,96,30,172,5,47,144,15,15,10,
+35,97,94,85,82,98,59,67,183,25,28,17,16,89,6,190,37,48,145,24,27,18,20,19,
+248,62,59,1,160,39,109,128,49,4,8,19,44,50,53,59,68,35,83,120,28,33,34,115,
+169,18,92,82,29,31,100,79,95,112,88,97,113,2,6,0,0,2,253,115,4,178,0,9,7,
+205,0,15,0,62,0,0,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,23,23,20,7,
+6,35,34,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,23,22,21,20,7,7,54,55,
+6,7,6,35,34,39,38,53,52,55,54,51,50,23,22,51,50,254,190,24,44,25,24,44,25,
+24,44,25,26,44,255,91,83,35,101,27,33,53,40,61,31,30,35,39,49,35,41,96,30,
+172,5,47,144,15,15,10,35,97,94,85,82,98,59,67,183,25,28,17,16,89,7,205,25,
+45,25,25,45,25,25,45,25,25,45,25,30,39,109,128,49,4,8,19,44,50,53,59,68,35,
+83,120,28,33,34,115,169,18,92,82,29,31,100,79,95,112,88,97,113,2,6,0,0,2,
+253,57,5,110,0,146,7,203,0,13,0,19,0,0,1,55,54,53,52,39,23,22,21,6,7,6,35,
+35,37,36,55,23,6,5,254,92,190,227,6,152,3,2,212,199,78,10,254,156,1,183,87,
+120,67,254,23,5,255,37,48,145,24,27,18,20,19,248,62,59,246,221,138,74,214,
+227,0,2,254,92,5,130,0,146,7,81,0,15,0,29,0,0,3,50,22,22,21,20,6,6,35,34,
+38,38,53,52,54,54,3,55,54,53,52,39,23,22,21,6,7,6,35,35,224,25,48,27,26,48,
+26,26,48,26,27,48,171,190,227,6,152,3,2,212,199,78,10,7,81,26,48,26,26,48,
+26,26,48,26,26,48,26,254,194,37,48,145,24,27,18,20,19,248,62,59,0,3,252,196,
+4,176,0,164,7,189,0,15,0,35,0,58,0,0,19,50,22,22,21,20,6,6,35,34,38,38,53,
+52,54,54,1,54,53,52,39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,37,38,53,
+16,37,54,51,32,19,22,21,20,7,6,7,35,38,35,34,7,6,35,34,64,25,48,27,26,48,
+26,26,48,26,27,48,254,196,35,4,32,163,24,28,172,9,14,76,24,31,38,36,85,254,
+48,12,1,56,40,37,1,43,55,7,24,39,24,99,65,139,45,53,47,39,137,6,164,26,48,
+26,26,48,26,26,48,26,26,48,26,254,237,59,82,28,30,188,4,27,157,35,42,84,8,
+11,1,70,61,1,66,40,5,254,169,46,44,80,73,114,81,142,15,13,0,0,1,253,211,3,
+187,0,238,7,198,0,28,0,0,19,54,55,23,6,35,34,39,39,54,53,52,35,34,21,20,4,
+23,21,35,53,52,36,53,16,33,32,17,20,48,67,42,81,96,199,54,62,18,104,170,150,
+1,51,2,152,254,205,1,59,1,49,6,65,6,49,73,127,9,109,14,122,110,140,158,200,
+177,190,190,125,190,220,1,54,254,232,62,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,
+94,0,0,0,3,0,1,4,9,0,1,0,28,0,94,0,3,0,1,4,9,0,2,0,14,0,122,0,3,0,1,4,9,0,
+3,0,54,0,136,0,3,0,1,4,9,0,4,0,28,0,94,0,3,0,1,4,9,0,5,0,30,0,190,0,3,0,1,
+4,9,0,6,0,24,0,220,0,3,0,1,4,9,0,7,0,68,0,244,0,3,0,1,4,9,0,8,0,18,1,56,0,
+3,0,1,4,9,0,9,0,18,1,56,0,3,0,1,4,9,0,10,0,28,1,74,0,3,0,1,4,9,0,11,0,62,
+1,102,0,3,0,1,4,9,0,12,0,48,1,164,0,3,0,1,4,9,0,13,2,150,1,212,0,3,0,1,4,
+9,0,14,0,52,4,106,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,
+32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,67,0,104,0,97,0,109,0,82,0,101,
+0,103,0,117,0,108,0,97,0,114,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,
+0,115,0,32,0,67,0,104,0,97,0,109,0,58,0,86,0,101,0,114,0,115,0,105,0,111,
+0,110,0,32,0,49,0,46,0,48,0,48,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,
+32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,
+0,110,0,115,0,67,0,104,0,97,0,109,0,78,0,111,0,116,0,111,0,32,0,105,0,115,
+0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,
+111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,
+46,0,68,0,97,0,110,0,104,0,32,0,72,0,111,0,110,0,103,0,68,0,97,0,116,0,97,
+0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,107,0,104,0,109,0,101,0,114,0,116,0,121,0,112,0,101,0,46,0,111,0,114,0,
+103,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,
+102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,
+101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,
+0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,
+65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,
+0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,
+0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,
+0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,
+0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,
+115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,
+0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,
+0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,
+101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,
+0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,
+0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,
+0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,
+0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,
+0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,
+0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,
+0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,
+39,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,1,0,2,0,3,0,
+4,1,93,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,
+0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,
+0,35,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,
+1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,
+1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,
+1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,
+1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,
+1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,93,1,93,1,93,1,93,1,93,1,93,1,93,
+1,93,0,7,117,110,105,65,65,48,48,7,117,110,105,65,65,48,49,7,117,110,105,
+65,65,48,50,7,117,110,105,65,65,48,51,7,117,110,105,65,65,48,52,7,117,110,
+105,65,65,48,53,7,117,110,105,65,65,48,54,7,117,110,105,65,65,48,55,7,117,
+110,105,65,65,48,56,7,117,110,105,65,65,48,57,7,117,110,105,65,65,48,65,7,
+117,110,105,65,65,48,66,7,117,110,105,65,65,48,67,7,117,110,105,65,65,48,
+68,7,117,110,105,65,65,48,69,7,117,110,105,65,65,48,70,7,117,110,105,65,65,
+49,48,7,117,110,105,65,65,49,49,7,117,110,105,65,65,49,50,7,117,110,105,65,
+65,49,51,7,117,110,105,65,65,49,52,7,117,110,105,65,65,49,53,7,117,110,105,
+65,65,49,54,7,117,110,105,65,65,49,55,7,117,110,105,65,65,49,56,7,117,110,
+105,65,65,49,57,7,117,110,105,65,65,49,65,7,117,110,105,65,65,49,66,7,117,
+110,105,65,65,49,67,7,117,110,105,65,65,49,68,7,117,110,105,65,65,49,69,7,
+117,110,105,65,65,49,70,7,117,110,105,65,65,50,48,7,117,110,105,65,65,50,
+49,7,117,110,105,65,65,50,50,7,117,110,105,65,65,50,51,7,117,110,105,65,65,
+50,52,7,117,110,105,65,65,50,53,7,117,110,105,65,65,50,54,7,117,110,105,65,
+65,50,55,7,117,110,105,65,65,50,56,7,117,110,105,65,65,50,57,7,117,110,105,
+65,65,50,65,7,117,110,105,65,65,50,66,7,117,110,105,65,65,50,67,7,117,110,
+105,65,65,50,68,7,117,110,105,65,65,50,69,7,117,110,105,65,65,50,70,7,117,
+110,105,65,65,51,48,7,117,110,105,65,65,51,49,7,117,110,105,65,65,51,50,7,
+117,110,105,65,65,51,51,7,117,110,105,65,65,51,52,7,117,110,105,65,65,51,
+53,7,117,110,105,65,65,51,54,7,117,110,105,65,65,52,48,7,117,110,105,65,65,
+52,49,7,117,110,105,65,65,52,50,7,117,110,105,65,65,52,51,7,117,110,105,65,
+65,52,52,7,117,110,105,65,65,52,53,7,117,110,105,65,65,52,54,7,117,110,105,
+65,65,52,55,7,117,110,105,65,65,52,56,7,117,110,105,65,65,52,57,7,117,110,
+105,65,65,52,65,7,117,110,105,65,65,52,66,7,117,110,105,65,65,52,67,7,117,
+110,105,65,65,52,68,7,117,110,105,65,65,53,48,7,117,110,105,65,65,53,49,7,
+117,110,105,65,65,53,50,7,117,110,105,65,65,53,51,7,117,110,105,65,65,53,
+52,7,117,110,105,65,65,53,53,7,117,110,105,65,65,53,54,7,117,110,105,65,65,
+53,55,7,117,110,105,65,65,53,56,7,117,110,105,65,65,53,57,7,117,110,105,65,
+65,53,67,7,117,110,105,65,65,53,68,7,117,110,105,65,65,53,69,7,117,110,105,
+65,65,53,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,255,255,0,2,0,1,0,0,0,12,0,0,0,
+22,0,0,0,2,0,1,0,0,0,126,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,68,0,70,0,
+2,99,104,97,109,0,14,107,104,109,114,0,36,0,10,0,1,122,122,48,49,0,16,0,0,
+255,255,0,0,0,0,255,255,0,0,0,10,0,1,122,122,48,49,0,16,0,0,255,255,0,0,0,
+0,255,255,0,0,0,0,0,0,0,1,0,0,0,10,0,82,0,150,0,2,99,104,97,109,0,14,107,
+104,109,114,0,44,0,10,0,1,122,122,48,49,0,20,0,0,255,255,0,2,0,0,0,2,0,0,
+255,255,0,2,0,3,0,4,0,10,0,1,122,122,48,49,0,18,0,0,255,255,0,1,0,1,0,0,255,
+255,0,2,0,3,0,4,0,5,99,108,105,103,0,32,99,108,105,103,0,40,108,105,103,97,
+0,48,122,122,48,49,0,56,122,122,48,50,0,62,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,
+1,0,0,0,2,0,0,0,1,0,0,0,1,0,0,0,0,0,1,0,1,0,3,0,8,0,16,0,24,0,4,0,0,0,1,0,
+24,0,6,0,0,0,1,0,176,0,1,0,0,0,1,0,212,0,1,0,126,0,6,0,18,0,22,0,26,0,36,
+0,42,0,46,0,1,0,102,0,1,0,80,0,4,0,34,0,52,0,64,0,88,0,2,0,18,0,30,0,1,0,
+42,0,3,0,26,0,50,0,62,0,121,0,2,0,82,0,121,0,2,0,85,0,122,0,2,0,103,0,122,
+0,2,0,85,0,123,0,2,0,94,0,123,0,2,0,82,0,124,0,2,0,103,0,124,0,2,0,82,0,125,
+0,2,0,103,0,125,0,2,0,78,0,126,0,2,0,77,0,126,0,2,0,82,0,2,0,5,0,77,0,78,
+0,0,0,82,0,82,0,2,0,85,0,85,0,3,0,94,0,94,0,4,0,103,0,103,0,5,0,3,0,1,0,28,
+0,1,0,18,0,0,0,1,0,0,0,2,0,2,0,1,0,89,0,90,0,0,0,2,0,2,0,42,0,45,0,0,0,48,
+0,76,0,4,0,2,0,10,0,2,0,119,0,120,0,2,0,1,0,89,0,90,0,0,0,0,};
+#endif
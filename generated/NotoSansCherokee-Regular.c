@@ -0,0 +1,1438 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansCherokee_Regular_ttf_size = 35428;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansCherokee_Regular_ttf");
+asm(".type fz_font_NotoSansCherokee_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansCherokee_Regular_ttf, 35428");
+asm(".balign 64");
+asm("fz_font_NotoSansCherokee_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansCherokee-Regular.ttf\"");
+#else
+const int fz_font_NotoSansCherokee_Regular_ttf_size = 35428;
+const char fz_font_NotoSansCherokee_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,38,0,94,0,0,56,216,0,0,0,30,71,
+80,79,83,194,72,75,39,0,0,56,248,0,0,81,60,71,83,85,66,170,13,175,251,0,0,
+138,52,0,0,0,48,79,83,47,50,140,146,147,100,0,0,1,104,0,0,0,96,99,109,97,
+112,6,183,49,39,0,0,3,44,0,0,0,254,103,97,115,112,0,7,0,7,0,0,56,204,0,0,
+0,12,103,108,121,102,188,33,191,67,0,0,4,224,0,0,42,90,104,101,97,100,7,178,
+255,171,0,0,0,236,0,0,0,54,104,104,101,97,17,167,7,101,0,0,1,36,0,0,0,36,
+104,109,116,120,245,117,28,243,0,0,1,200,0,0,1,100,108,111,99,97,146,107,
+157,166,0,0,4,44,0,0,0,180,109,97,120,112,0,94,0,81,0,0,1,72,0,0,0,32,110,
+97,109,101,141,234,185,204,0,0,47,60,0,0,6,12,112,111,115,116,182,102,171,
+55,0,0,53,72,0,0,3,129,0,1,0,0,0,1,7,174,36,151,205,123,95,15,60,245,0,11,
+8,0,0,0,0,0,205,82,227,81,0,0,0,0,210,40,203,228,0,10,254,20,9,14,5,182,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,9,74,0,10,0,25,9,14,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,0,1,0,0,0,89,0,80,0,4,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,178,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,1,241,8,2,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,0,16,
+0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,32,0,
+1,159,0,0,0,0,4,72,5,182,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,
+0,5,148,0,115,5,58,0,115,5,90,0,100,5,135,0,30,5,16,0,115,8,75,0,76,7,30,
+0,115,6,6,0,115,5,152,0,115,4,201,0,115,5,135,0,30,4,206,0,115,5,10,0,115,
+4,214,0,115,5,53,0,115,4,87,0,115,7,207,0,115,2,110,0,75,5,77,0,115,4,171,
+0,130,5,98,0,50,5,200,0,20,7,135,0,115,5,173,0,70,5,20,0,115,7,68,0,60,5,
+129,0,115,5,62,0,70,6,118,0,115,8,31,0,115,5,188,0,115,4,214,0,70,4,50,0,
+115,4,232,0,135,5,27,0,92,4,70,0,90,4,87,0,50,4,196,0,115,5,100,0,115,5,184,
+0,115,6,10,0,115,6,49,0,115,6,121,0,115,5,49,0,115,4,142,0,100,5,179,0,150,
+7,160,0,60,6,137,0,71,6,90,0,10,6,31,0,60,5,155,0,115,4,191,0,50,4,13,0,50,
+5,211,0,100,4,239,0,115,4,142,0,30,4,254,0,50,5,134,0,60,4,194,0,115,6,19,
+0,50,5,230,0,101,7,162,0,115,5,151,0,50,5,223,0,50,5,49,0,67,5,77,0,67,6,
+1,0,70,5,228,0,60,7,18,0,40,6,70,0,70,6,6,0,100,7,10,0,30,9,74,0,30,5,6,0,
+50,5,210,0,29,5,141,0,50,5,138,0,30,7,158,0,110,4,137,0,125,5,147,0,70,7,
+141,0,70,7,104,0,70,7,164,0,70,7,174,0,70,5,210,0,70,0,0,0,1,0,3,0,1,0,0,
+0,12,0,4,0,242,0,0,0,14,0,8,0,2,0,6,0,0,0,13,0,32,0,160,19,244,254,255,255,
+255,0,0,0,0,0,13,0,32,0,160,19,160,254,255,255,255,0,1,255,245,255,227,255,
+99,0,0,1,2,0,1,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,4,0,5,0,6,0,70,0,20,0,21,0,37,
+0,64,0,28,0,24,0,7,0,39,0,8,0,75,0,23,0,66,0,19,0,41,0,51,0,9,0,83,0,55,0,
+47,0,10,0,61,0,72,0,26,0,11,0,78,0,25,0,12,0,79,0,43,0,67,0,30,0,13,0,77,
+0,33,0,49,0,85,0,53,0,76,0,86,0,62,0,27,0,84,0,59,0,58,0,60,0,73,0,42,0,40,
+0,29,0,38,0,57,0,68,0,69,0,14,0,36,0,81,0,88,0,35,0,15,0,16,0,63,0,52,0,17,
+0,22,0,74,0,32,0,34,0,56,0,45,0,46,0,50,0,54,0,65,0,48,0,82,0,87,0,80,0,71,
+0,31,0,44,0,18,0,0,0,0,0,21,0,21,0,21,0,21,0,64,0,134,0,164,0,207,0,247,1,
+60,1,120,1,166,1,221,1,249,2,31,2,57,2,105,2,148,2,209,2,244,3,66,3,101,3,
+163,3,215,4,15,4,64,4,124,4,174,4,222,5,16,5,67,5,135,5,201,6,15,6,68,6,115,
+6,177,7,15,7,84,7,126,7,176,7,203,7,254,8,55,8,121,8,193,9,20,9,83,9,145,
+9,181,10,32,10,114,10,195,11,23,11,92,11,144,11,199,12,0,12,44,12,84,12,163,
+12,232,13,41,13,110,13,186,14,16,14,93,14,152,14,206,15,4,15,83,15,166,16,
+19,16,124,16,159,16,231,17,84,17,152,17,221,18,13,18,97,18,179,18,249,19,
+66,19,157,19,234,20,71,20,184,21,45,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,
+19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,
+4,230,0,0,2,0,115,0,0,5,33,5,44,0,12,0,21,0,0,1,16,0,33,33,53,55,17,39,53,
+33,32,0,3,16,2,35,35,17,51,50,18,5,33,254,169,254,188,253,237,152,152,2,58,
+1,41,1,75,174,245,235,224,197,252,255,2,161,254,186,254,165,105,15,4,50,15,
+115,254,170,254,197,1,0,1,15,251,216,1,18,0,0,2,0,115,255,249,4,234,5,44,
+0,33,0,43,0,0,55,55,17,39,53,33,32,17,16,5,21,22,22,23,23,22,22,51,55,23,
+6,35,34,39,38,38,39,38,39,33,17,23,21,33,1,51,50,54,53,52,38,38,35,35,115,
+151,151,2,19,1,245,254,251,67,95,20,32,10,60,51,26,11,40,88,102,51,24,27,
+17,37,133,254,207,164,254,29,1,63,252,144,143,63,139,136,201,105,15,4,60,
+15,105,254,166,254,233,59,7,26,135,106,162,48,36,2,105,24,72,34,124,98,228,
+28,254,55,15,105,2,190,123,129,96,100,44,0,0,1,0,100,0,0,4,246,5,44,0,15,
+0,0,1,17,23,21,33,53,55,17,33,7,35,17,33,17,35,39,3,1,185,253,229,186,254,
+155,15,129,4,146,130,14,4,170,251,206,15,105,105,15,4,50,207,1,81,254,175,
+207,0,2,0,30,0,0,5,105,5,44,0,15,0,21,0,0,1,33,3,23,21,33,53,55,1,51,1,23,
+21,33,53,55,1,33,2,39,35,6,3,194,253,250,100,162,254,36,149,1,186,203,1,155,
+150,254,17,162,253,205,1,176,170,33,4,36,1,151,254,225,15,105,105,15,4,180,
+251,76,15,105,105,15,1,161,2,28,127,123,0,1,0,115,0,0,4,157,5,44,0,23,0,0,
+33,33,53,55,17,39,53,33,17,35,39,33,17,33,55,51,17,35,39,33,17,33,55,51,4,
+157,251,214,151,151,4,25,134,10,253,184,1,52,9,120,120,9,254,204,2,89,10,
+134,105,15,4,60,15,105,254,192,190,254,63,138,254,109,138,254,24,190,0,1,
+0,76,0,0,7,251,5,44,0,40,0,0,1,53,33,21,7,19,22,23,51,54,54,19,39,53,33,21,
+7,1,35,3,38,39,35,6,7,3,35,1,39,53,33,21,7,19,22,23,51,54,54,19,39,3,54,1,
+222,154,175,37,49,10,29,63,219,157,1,216,150,254,124,202,165,36,39,10,57,
+69,165,202,254,179,151,1,226,149,176,58,28,10,23,57,219,6,4,194,106,105,15,
+253,77,142,231,112,226,2,214,15,105,105,15,251,76,2,113,134,208,226,218,253,
+245,4,180,15,105,105,15,253,76,232,137,92,205,2,226,26,0,1,0,115,0,0,6,171,
+5,44,0,35,0,0,33,1,35,22,17,17,23,21,33,53,55,17,39,53,33,19,22,23,51,54,
+54,1,33,21,7,17,23,21,33,53,55,17,16,55,35,1,3,46,254,130,25,11,128,254,81,
+150,150,1,204,237,70,19,8,11,39,1,46,1,190,150,150,254,66,130,4,25,254,126,
+4,162,192,254,171,253,235,15,105,105,15,4,60,15,105,252,205,246,91,43,135,
+3,210,105,15,251,196,15,105,105,15,2,24,1,33,240,251,95,0,1,0,115,0,0,5,147,
+5,44,0,27,0,0,1,21,7,17,23,21,33,53,55,17,33,17,23,21,33,53,55,17,39,53,33,
+21,7,17,33,17,39,53,5,147,150,150,254,42,150,253,97,151,254,40,151,151,1,
+216,151,2,159,150,5,44,105,15,251,196,15,105,105,15,1,243,254,13,15,105,105,
+15,4,60,15,105,105,15,254,57,1,199,15,105,0,3,0,115,255,238,5,37,5,64,0,11,
+0,18,0,25,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,50,18,55,33,22,18,19,34,6,
+7,33,38,38,5,37,254,191,254,232,254,222,254,201,1,64,1,28,1,27,1,59,253,167,
+201,216,11,252,167,10,219,203,191,216,22,3,83,23,216,2,151,254,201,254,142,
+1,96,1,74,1,64,1,104,254,154,252,159,1,2,240,241,254,255,4,60,228,215,217,
+226,0,0,1,0,115,0,0,4,86,5,44,0,13,0,0,33,33,53,1,33,7,35,17,33,21,1,33,55,
+51,4,80,252,35,3,42,253,115,15,129,3,214,252,213,2,149,15,129,126,4,44,207,
+1,81,127,251,213,207,0,1,0,30,0,0,5,105,5,44,0,19,0,0,1,39,53,33,21,7,1,35,
+1,39,53,33,21,7,19,19,23,51,54,54,4,47,162,1,220,149,254,70,203,254,101,150,
+1,239,162,223,95,16,4,13,67,4,180,15,105,105,15,251,76,4,180,15,105,105,15,
+253,58,254,196,58,44,206,0,1,0,115,0,0,4,106,5,44,0,13,0,0,51,53,55,17,39,
+53,33,21,7,17,33,55,51,17,115,152,152,1,237,173,2,38,16,129,105,15,4,60,15,
+105,105,15,251,206,242,254,140,0,0,1,0,115,255,236,4,151,5,64,0,26,0,0,1,
+34,2,17,16,33,50,54,55,51,6,4,35,32,0,17,16,0,33,50,22,23,21,35,39,38,38,
+2,223,221,225,1,156,135,172,20,147,9,254,253,214,254,229,254,217,1,75,1,33,
+122,244,59,145,11,49,142,4,180,254,234,254,240,253,234,125,116,173,208,1,
+84,1,73,1,71,1,112,88,68,252,188,40,40,0,2,0,115,0,0,4,124,5,44,0,15,0,24,
+0,0,1,16,33,35,17,23,21,33,53,55,17,39,53,33,32,4,1,51,50,54,53,52,38,35,
+35,4,124,253,249,193,164,254,27,151,151,1,236,1,18,1,11,253,56,192,180,171,
+174,195,174,3,174,254,102,254,100,15,105,105,15,4,60,15,105,185,254,35,133,
+142,130,127,0,3,0,115,0,0,4,194,5,44,0,19,0,28,0,37,0,0,55,55,17,39,53,33,
+32,4,21,20,6,7,21,22,22,21,20,4,33,33,1,17,51,50,54,53,52,38,35,37,33,50,
+54,53,52,38,35,35,115,173,173,1,203,1,75,1,18,126,112,138,139,254,246,254,
+233,253,210,1,87,215,188,182,154,159,254,240,1,5,153,137,161,198,192,105,
+15,4,60,15,105,156,174,113,153,22,10,29,155,136,189,187,2,112,254,18,119,
+138,123,114,130,105,118,113,104,0,0,1,0,115,0,0,3,228,5,44,0,19,0,0,1,21,
+7,17,33,55,51,17,35,39,33,17,23,21,33,53,55,17,39,53,2,74,150,1,165,9,130,
+130,9,254,91,150,254,41,151,151,5,44,105,15,254,57,171,254,38,165,254,21,
+15,105,105,15,4,60,15,105,0,2,0,115,255,236,7,137,5,64,0,37,0,47,0,0,1,50,
+54,53,52,35,34,6,21,21,35,38,53,52,54,51,50,22,21,20,2,35,34,38,39,2,0,35,
+32,0,17,16,0,33,32,19,22,22,37,16,18,51,50,18,17,16,33,32,5,250,130,128,151,
+70,61,122,6,135,118,142,156,206,180,102,142,53,23,254,228,252,254,229,254,
+223,1,45,1,20,1,166,113,34,163,251,145,201,197,199,195,254,123,254,109,2,
+81,173,185,252,90,94,66,27,77,130,146,201,181,238,254,247,74,74,254,212,254,
+196,1,96,1,76,1,70,1,98,254,54,140,153,70,254,244,254,237,1,14,1,17,2,29,
+0,0,2,0,75,0,0,2,35,5,64,0,7,0,19,0,0,1,17,23,21,33,53,55,17,3,52,54,51,50,
+22,21,20,6,35,34,38,1,139,152,254,40,152,19,59,44,43,60,60,43,44,59,3,105,
+253,15,15,105,105,15,2,241,1,99,60,56,56,60,59,59,58,0,1,0,115,255,236,5,
+7,5,64,0,39,0,0,37,50,54,55,38,38,53,52,54,51,50,22,21,20,6,6,35,32,0,17,
+52,18,36,51,50,22,22,23,23,21,33,53,55,52,38,35,32,17,20,18,2,194,139,177,
+34,50,56,62,54,57,76,122,230,149,254,232,254,209,145,1,21,189,111,208,112,
+12,118,254,76,152,159,124,254,81,216,130,97,92,5,51,44,45,62,80,82,110,174,
+100,1,94,1,68,208,1,58,168,90,143,93,15,105,103,16,79,98,253,234,255,254,
+237,0,1,0,130,0,0,4,59,5,170,0,33,0,0,37,23,21,33,53,55,17,39,53,33,21,7,
+21,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,4,21,20,4,33,35,1,194,152,254,
+40,152,152,1,203,139,95,194,186,193,178,86,176,65,53,65,210,113,234,1,31,
+254,242,254,249,100,120,15,105,105,15,3,10,15,105,105,15,196,159,161,140,
+148,37,31,112,45,51,229,192,220,237,0,0,1,0,50,255,236,5,68,5,44,0,34,0,0,
+1,39,53,33,21,7,1,14,3,35,34,38,53,52,54,51,50,22,21,20,7,23,51,50,54,55,
+1,39,53,33,21,7,1,4,45,161,1,184,110,254,151,42,89,114,149,102,85,102,65,
+50,39,54,12,10,10,51,112,58,254,55,124,1,223,158,1,102,4,180,15,105,105,15,
+253,23,87,171,136,85,78,66,54,60,50,41,29,12,2,98,102,3,132,15,105,105,15,
+253,23,0,0,1,0,20,255,236,5,170,5,44,0,27,0,0,5,34,38,39,39,53,33,21,7,20,
+22,51,50,54,55,1,53,51,1,1,39,53,33,21,7,1,6,6,1,203,146,159,6,128,1,137,
+107,79,78,63,118,64,253,188,196,1,222,1,89,172,1,219,133,254,101,100,212,
+20,166,158,15,105,105,15,89,100,97,109,3,228,7,252,185,2,207,15,105,105,15,
+252,191,205,186,0,0,2,0,115,255,238,6,201,5,64,0,18,0,30,0,0,1,17,51,17,35,
+17,33,2,0,33,32,0,17,16,0,33,32,0,19,5,16,18,51,50,18,17,16,2,35,34,2,6,33,
+168,168,254,243,12,254,199,254,247,254,227,254,202,1,57,1,28,1,0,1,50,25,
+252,14,217,204,206,215,214,205,211,212,2,237,2,62,250,213,2,107,254,217,254,
+170,1,97,1,73,1,67,1,101,254,202,254,227,86,254,249,254,233,1,19,1,11,1,8,
+1,22,254,232,0,2,0,70,255,239,5,103,5,44,0,20,0,29,0,0,1,7,17,20,4,35,32,
+38,53,17,39,53,33,21,7,17,33,17,39,53,33,1,50,54,53,53,33,21,20,22,5,103,
+150,254,253,243,254,252,251,150,1,214,152,2,165,152,1,214,253,116,172,162,
+253,91,167,4,195,15,252,234,207,224,217,228,3,8,15,105,105,15,254,88,1,168,
+15,105,251,79,148,164,215,206,169,152,0,1,0,115,0,0,4,251,5,44,0,28,0,0,1,
+37,23,22,22,51,50,54,55,23,6,6,35,34,38,39,7,17,23,21,33,53,55,17,39,53,33,
+21,7,1,179,1,79,8,39,87,69,67,88,25,122,22,154,135,105,134,38,252,150,254,
+42,152,152,1,214,150,2,213,204,3,159,140,110,140,12,200,182,124,119,149,254,
+55,15,105,105,15,4,60,15,105,105,15,0,1,0,60,0,0,7,18,5,44,0,24,0,0,37,54,
+18,1,51,1,35,3,3,35,1,51,1,22,23,51,19,3,51,19,19,51,3,18,23,4,170,7,118,
+1,54,181,253,243,211,161,188,211,254,58,189,1,9,75,40,8,207,214,177,135,159,
+166,252,116,55,118,23,1,92,3,67,250,212,1,224,254,32,5,44,252,198,244,136,
+2,56,2,126,254,52,1,204,253,115,254,154,195,0,1,0,115,0,0,5,69,5,44,0,33,
+0,0,37,21,33,53,55,17,52,38,35,34,6,21,21,23,21,33,53,55,17,39,53,33,21,7,
+17,20,7,51,54,51,50,22,21,17,5,69,254,41,151,122,133,171,168,151,254,41,152,
+152,1,227,163,8,12,103,250,204,201,105,105,105,15,1,76,155,162,195,201,253,
+15,105,105,15,4,60,15,105,105,15,254,201,111,56,183,219,229,254,171,0,0,1,
+0,70,0,0,5,2,5,64,0,47,0,0,19,16,18,51,50,22,22,21,20,6,35,34,38,53,52,55,
+38,38,35,34,6,21,21,20,7,51,54,51,50,22,21,21,23,21,33,53,55,53,16,35,32,
+17,21,23,21,33,53,55,222,250,240,124,189,105,63,50,51,57,57,23,127,103,153,
+170,8,12,90,241,202,203,152,254,40,152,255,254,195,151,254,41,152,3,14,1,
+17,1,33,66,122,75,71,66,57,40,65,29,34,41,199,181,52,57,84,176,214,228,251,
+15,105,105,15,243,1,60,254,150,197,15,105,105,15,0,0,1,0,115,0,0,6,88,5,44,
+0,43,0,0,37,17,6,4,6,21,17,23,21,33,53,55,17,39,53,33,21,7,17,20,7,51,54,
+36,51,50,4,21,20,6,35,34,38,53,52,55,38,38,35,17,23,21,33,53,3,179,117,254,
+239,122,151,254,41,152,152,1,215,151,10,10,101,1,73,202,237,1,64,66,50,51,
+57,59,14,205,125,154,254,38,120,2,95,5,106,138,83,254,237,15,105,105,15,4,
+60,15,105,105,15,254,115,98,68,112,118,163,129,72,69,54,42,68,26,41,58,253,
+161,15,105,105,0,2,0,115,255,238,7,252,5,64,0,27,0,37,0,0,5,32,0,17,16,0,
+33,50,0,19,37,23,22,22,51,50,54,55,23,6,6,35,34,38,39,7,2,0,1,16,18,51,50,
+18,17,16,33,32,2,175,254,235,254,217,1,45,1,20,252,1,26,21,1,36,9,42,87,64,
+68,88,25,122,21,155,135,104,133,41,207,15,254,214,253,122,201,197,197,197,
+254,123,254,109,18,1,90,1,80,1,70,1,98,254,204,254,226,179,3,171,128,112,
+138,12,197,185,124,119,122,254,222,254,180,2,169,254,243,254,239,1,10,1,20,
+2,30,0,0,1,0,115,0,0,5,73,5,44,0,29,0,0,1,55,1,39,53,33,21,7,1,1,23,21,33,
+53,55,1,7,7,17,23,21,33,53,55,17,39,53,33,21,7,1,180,161,1,147,144,1,202,
+128,254,107,1,185,131,254,29,147,254,159,123,105,151,254,40,152,152,1,216,
+151,2,58,190,1,193,10,105,105,11,254,75,253,118,16,105,105,15,2,13,134,104,
+254,225,15,105,105,15,4,60,15,105,105,15,0,1,0,70,0,0,4,84,5,64,0,29,0,0,
+19,16,18,51,50,22,22,21,20,6,35,34,38,53,52,55,38,38,35,34,6,21,17,33,55,
+51,17,33,53,55,221,249,236,112,186,104,64,50,52,54,61,29,116,89,161,163,2,
+59,16,129,251,243,151,3,24,1,16,1,24,76,129,72,73,70,57,41,67,26,37,52,188,
+182,253,64,242,254,140,105,15,0,0,1,0,115,255,236,3,182,5,60,0,41,0,0,1,34,
+6,21,20,22,22,23,30,2,21,20,6,35,34,38,39,53,51,23,22,51,32,53,52,38,38,39,
+38,38,53,52,54,51,50,22,23,21,35,39,38,2,49,124,138,55,114,131,143,138,70,
+241,213,112,210,59,129,12,84,161,1,24,50,105,155,185,148,235,189,105,196,
+59,129,12,71,4,182,110,95,58,85,73,53,58,102,130,86,174,202,57,44,253,163,
+51,221,57,83,70,64,72,178,129,155,191,48,43,253,166,44,0,0,1,0,135,255,236,
+4,97,5,64,0,68,0,0,1,50,22,23,53,38,38,53,52,54,51,50,22,22,21,20,6,35,34,
+38,53,52,54,55,38,38,35,34,6,21,20,22,23,33,21,35,34,38,39,21,22,22,21,20,
+6,35,34,38,38,53,52,54,51,50,22,21,20,7,22,22,51,50,54,53,52,38,39,33,53,
+1,10,25,95,20,107,83,230,190,112,179,100,62,48,50,56,24,26,20,119,88,124,
+134,119,156,1,214,163,25,95,20,129,87,246,222,115,175,95,65,48,51,55,61,28,
+122,76,147,158,141,144,254,62,2,215,6,4,10,69,132,82,154,180,68,119,70,66,
+62,51,42,23,51,15,29,41,97,91,91,125,67,118,6,4,10,83,129,83,161,186,65,116,
+71,61,68,54,43,59,27,28,34,108,100,91,134,59,119,0,1,0,92,255,236,4,168,5,
+64,0,47,0,0,1,51,21,35,6,4,35,34,38,39,53,51,23,22,51,50,54,53,52,38,38,39,
+46,2,53,52,54,51,32,19,51,21,33,53,52,38,35,34,6,21,20,22,22,23,30,2,3,192,
+232,231,20,254,253,209,104,216,61,129,12,97,148,153,166,59,119,167,141,130,
+66,241,184,1,102,53,241,254,134,141,134,121,143,50,106,148,152,133,81,1,158,
+130,143,161,60,45,253,163,59,115,107,52,81,73,67,57,99,130,87,158,202,254,
+249,130,36,105,116,113,94,58,83,70,60,63,86,103,0,1,0,90,255,236,4,20,5,44,
+0,26,0,0,1,53,33,21,7,17,20,2,35,34,38,38,53,52,54,51,50,22,21,20,7,22,51,
+50,54,53,17,2,52,1,224,150,217,211,109,173,94,63,54,49,55,58,43,162,137,131,
+4,195,105,105,15,253,60,252,254,248,70,125,74,69,81,52,41,69,25,97,186,184,
+2,207,0,1,0,50,255,236,4,17,5,44,0,33,0,0,37,50,54,53,52,35,34,6,7,7,35,38,
+53,52,54,51,50,22,21,20,6,35,34,38,17,17,39,53,33,21,7,17,20,22,2,107,131,
+140,102,49,45,1,3,121,5,121,104,124,128,227,197,211,204,152,1,216,152,122,
+116,169,156,188,72,68,117,49,72,129,142,173,157,211,243,248,1,11,2,197,15,
+105,105,15,253,43,182,181,0,1,0,115,0,0,4,106,5,44,0,13,0,0,1,17,35,39,33,
+17,23,21,33,53,55,17,39,53,4,106,136,11,253,222,173,254,17,152,152,5,44,254,
+148,234,251,206,15,105,105,15,4,60,15,105,0,1,0,115,0,0,5,30,5,44,0,30,0,
+0,1,23,54,53,52,38,35,35,17,23,21,33,53,55,17,39,53,33,50,4,21,20,6,7,19,
+23,21,33,53,55,1,3,34,26,202,174,203,218,160,254,32,152,152,2,49,254,1,19,
+167,158,245,185,254,28,107,254,222,2,226,51,42,216,132,117,251,206,15,105,
+105,15,4,60,15,105,182,171,154,200,29,254,41,12,105,105,10,2,111,0,0,1,0,
+115,255,238,5,69,5,64,0,35,0,0,33,53,6,35,32,0,17,52,18,36,51,50,22,23,21,
+35,39,38,38,35,34,2,17,20,18,51,50,54,55,53,39,53,33,21,7,17,4,19,124,251,
+254,251,254,220,153,1,32,198,129,251,57,146,10,47,151,83,227,238,207,186,
+138,202,21,159,1,209,150,154,172,1,96,1,60,211,1,61,166,83,67,253,183,38,
+42,254,235,254,240,249,254,227,141,113,90,15,105,105,15,254,47,0,0,1,0,115,
+255,236,5,196,5,64,0,41,0,0,1,55,51,23,7,35,39,7,35,38,38,35,34,2,17,20,18,
+51,50,54,55,53,39,53,33,21,7,17,35,53,6,35,32,0,17,16,0,33,50,23,55,51,5,
+14,98,4,80,177,4,119,117,4,83,160,108,197,219,208,191,133,205,23,160,1,210,
+151,154,128,247,254,246,254,219,1,57,1,20,250,121,107,4,4,123,143,99,240,
+159,159,141,112,254,223,254,249,251,254,231,151,120,78,16,103,103,16,254,
+43,186,206,1,92,1,63,1,69,1,116,198,149,0,1,0,115,255,236,5,190,5,64,0,45,
+0,0,19,52,18,36,51,50,23,55,51,23,55,51,23,7,35,39,7,35,38,38,35,34,2,17,
+16,18,51,50,54,55,51,23,55,51,23,7,35,39,7,35,39,6,6,35,32,0,115,139,1,8,
+179,253,119,108,4,108,97,4,80,176,4,120,117,4,76,165,111,194,214,197,189,
+119,181,75,4,116,120,4,176,80,4,97,115,4,120,63,198,119,254,242,254,227,2,
+144,208,1,57,167,198,149,154,143,99,239,165,160,136,117,254,220,254,251,254,
+253,254,240,128,127,160,166,228,100,131,153,148,96,103,1,92,0,0,1,0,115,255,
+236,6,71,5,64,0,55,0,0,1,34,2,17,20,18,51,50,54,55,53,39,53,33,21,7,21,20,
+22,51,50,54,55,55,51,23,21,20,6,35,34,38,39,6,33,32,0,17,52,18,36,51,50,22,
+22,21,20,6,35,34,38,53,52,55,38,38,2,239,222,240,204,187,136,189,22,160,1,
+210,151,76,72,74,69,4,2,125,3,150,118,102,130,36,126,254,234,254,252,254,
+220,153,1,33,194,120,212,122,63,51,51,58,55,28,160,4,180,254,229,254,243,
+248,254,228,131,114,104,16,103,103,16,77,140,128,87,93,65,87,19,123,142,74,
+85,177,1,94,1,61,210,1,60,171,74,130,78,72,71,56,42,61,29,43,54,0,0,1,0,115,
+255,236,4,190,5,64,0,39,0,0,1,20,6,6,35,32,0,17,52,18,36,51,50,22,23,21,35,
+39,38,38,35,34,2,17,16,18,51,50,54,53,52,38,35,7,35,17,51,23,22,22,4,190,
+124,227,147,254,226,254,197,147,1,28,195,123,254,59,136,10,43,161,86,222,
+230,224,212,154,186,93,114,5,130,130,5,178,178,1,127,116,184,103,1,92,1,65,
+211,1,58,170,88,68,229,165,36,44,254,231,254,243,254,251,254,239,137,116,
+103,105,172,1,202,159,5,160,0,2,0,100,255,236,4,27,5,64,0,28,0,39,0,0,37,
+50,54,55,38,36,38,53,52,54,54,51,50,18,17,20,2,6,35,34,38,53,52,55,51,7,21,
+20,22,19,34,6,21,20,22,5,54,53,52,38,2,15,108,156,35,223,254,234,130,102,
+187,123,220,224,129,230,164,206,222,6,146,1,139,215,105,140,228,1,20,20,137,
+116,132,112,86,182,198,129,108,179,102,254,206,254,218,218,254,149,183,225,
+210,38,25,17,16,161,168,4,73,148,107,143,206,112,116,137,242,221,0,1,0,150,
+0,0,5,29,5,44,0,19,0,0,1,33,7,35,17,33,17,35,39,33,17,33,55,51,17,33,17,51,
+23,33,2,128,254,166,15,129,4,90,129,15,254,200,1,101,15,129,251,155,129,15,
+1,57,4,170,207,1,81,254,175,207,251,216,207,254,175,1,81,207,0,3,0,60,255,
+236,7,60,5,64,0,48,0,59,0,71,0,0,37,32,55,38,2,53,52,54,51,32,17,20,2,14,
+2,35,34,39,6,6,35,34,38,53,52,55,51,7,21,20,22,51,50,54,55,38,2,53,52,54,
+51,50,22,21,20,2,7,22,1,16,23,54,18,53,52,38,35,34,6,5,20,18,23,54,18,53,
+52,38,35,34,6,4,100,1,4,138,128,142,161,136,1,47,84,139,165,213,135,227,156,
+63,159,85,172,194,9,141,2,115,103,54,113,46,116,128,179,158,155,171,125,103,
+116,254,125,175,79,82,84,79,81,92,3,78,104,88,45,57,71,74,69,80,120,201,108,
+1,68,209,163,204,254,116,138,254,165,246,147,75,144,66,78,211,189,47,51,33,
+33,137,155,53,54,137,1,101,188,202,233,223,196,170,254,132,140,115,3,23,254,
+169,235,134,1,49,149,141,147,157,89,160,254,234,82,96,1,21,120,142,126,130,
+0,2,0,71,255,236,6,107,5,64,0,42,0,54,0,0,37,50,54,55,39,53,33,21,7,6,6,35,
+34,39,6,6,35,34,38,53,52,55,51,7,21,20,22,51,50,55,38,2,53,52,54,51,50,22,
+21,20,2,7,22,1,20,18,23,54,18,53,52,38,35,34,6,4,90,113,121,12,166,1,193,
+137,16,204,170,183,162,72,168,87,180,193,7,141,2,117,111,117,108,124,141,
+202,173,165,190,148,117,115,254,98,106,97,87,111,98,95,96,112,118,124,147,
+14,105,105,14,195,214,150,73,77,207,188,63,41,22,16,159,164,114,146,1,94,
+171,203,242,224,189,165,254,127,141,122,3,35,148,254,200,128,129,1,70,133,
+140,147,159,0,0,2,0,10,255,238,6,30,5,65,0,41,0,53,0,0,1,34,6,7,23,21,33,
+53,55,54,54,51,50,23,54,51,50,22,21,20,7,35,55,53,52,38,35,34,7,22,18,21,
+20,6,35,34,38,53,52,18,55,38,1,52,2,39,6,2,21,20,22,51,50,54,2,17,112,120,
+8,170,254,63,137,13,197,174,175,161,155,174,178,192,8,141,2,118,107,120,106,
+124,136,205,175,162,190,155,118,120,1,154,99,91,90,120,98,94,98,110,4,183,
+121,129,11,105,105,14,186,199,153,153,206,197,61,32,32,23,147,156,114,146,
+254,164,168,200,249,223,190,164,1,132,135,125,252,239,146,1,43,119,118,254,
+185,135,142,144,164,0,0,2,0,60,255,236,5,227,5,64,0,43,0,55,0,0,1,54,54,53,
+52,38,35,34,7,18,17,20,6,35,34,38,53,52,18,55,38,38,35,34,6,7,21,23,35,39,
+52,54,51,50,22,23,54,51,50,22,21,20,6,7,1,52,2,39,6,2,21,20,22,51,50,54,4,
+224,48,56,119,94,147,120,250,211,168,169,184,149,129,56,124,52,114,116,3,
+3,141,5,200,184,82,174,73,170,198,168,198,138,121,254,218,89,98,94,120,101,
+94,95,111,3,87,16,91,67,82,95,114,254,208,254,142,194,244,225,198,175,1,109,
+147,61,55,160,139,31,37,60,210,235,78,72,150,172,143,122,167,15,254,203,167,
+1,25,127,109,254,186,150,144,146,162,0,0,3,0,115,255,238,5,40,5,64,0,11,0,
+23,0,35,0,0,5,32,0,17,16,0,33,32,0,17,16,0,37,50,54,55,33,39,3,33,6,21,16,
+18,19,34,6,7,33,23,19,33,54,53,16,2,2,204,254,224,254,199,1,63,1,29,1,32,
+1,57,254,193,254,227,158,209,43,254,50,5,31,254,176,5,221,211,154,205,46,
+1,192,7,33,1,87,3,222,18,1,100,1,67,1,63,1,108,254,156,254,189,254,193,254,
+148,139,167,163,5,1,54,57,49,254,245,254,240,4,60,158,151,7,254,204,26,59,
+1,10,1,17,0,0,1,0,50,0,0,4,101,5,64,0,33,0,0,1,52,38,35,34,6,21,17,23,21,
+33,53,55,17,16,18,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,54,3,
+199,154,136,154,154,153,254,40,151,246,233,194,251,175,138,57,69,50,48,26,
+48,11,47,51,3,165,128,147,203,186,253,69,15,105,105,15,2,181,1,2,1,17,226,
+178,170,231,57,48,40,60,30,32,26,130,0,0,2,0,50,255,236,3,217,5,44,0,21,0,
+34,0,0,1,50,22,23,51,38,38,53,17,39,53,33,21,7,17,16,33,34,38,53,52,54,19,
+50,54,53,52,38,35,34,6,6,21,20,22,1,170,81,123,36,10,2,7,152,1,214,150,254,
+103,171,205,206,176,110,122,126,97,73,106,56,122,3,14,61,56,18,132,44,1,89,
+15,105,105,15,253,100,253,212,216,178,186,222,253,100,162,138,105,129,61,
+125,83,122,143,0,0,2,0,100,255,236,5,96,5,44,0,24,0,36,0,0,1,33,17,7,51,54,
+54,51,50,22,21,20,6,35,34,46,2,53,17,33,7,35,17,33,1,50,54,53,52,38,35,34,
+6,21,20,22,4,224,254,23,6,10,37,136,79,171,190,216,172,93,144,107,53,254,
+165,15,129,4,124,254,251,105,127,113,110,105,130,119,4,170,254,134,154,63,
+59,211,185,178,230,60,122,171,178,2,171,207,1,81,251,72,148,128,134,122,138,
+107,137,150,0,2,0,115,0,0,4,124,5,44,0,16,0,25,0,0,1,20,4,33,33,53,55,17,
+39,53,33,21,7,17,51,32,22,1,51,50,54,53,52,38,35,35,4,124,254,230,254,233,
+254,40,151,151,1,227,164,183,1,21,254,253,54,176,195,174,161,202,182,1,139,
+196,199,105,15,4,60,15,105,105,15,254,76,184,254,58,132,129,132,115,0,2,0,
+30,0,0,4,42,5,48,0,14,0,21,0,0,1,35,21,23,21,33,53,55,53,33,53,1,51,17,51,
+33,53,19,55,35,7,1,4,42,197,150,254,44,150,253,97,2,117,210,197,254,147,9,
+2,8,117,254,134,1,78,214,15,105,105,15,214,129,3,97,252,168,65,2,40,83,180,
+253,248,0,0,1,0,50,0,0,4,204,5,44,0,54,0,0,1,54,51,50,22,21,20,6,35,34,38,
+53,52,54,55,38,38,35,34,6,7,17,23,21,33,53,55,17,6,6,35,34,38,53,52,54,51,
+50,22,21,20,6,7,22,22,51,50,54,55,17,39,53,33,21,7,2,211,114,116,127,148,
+70,60,45,56,45,44,4,74,63,53,129,40,152,254,41,151,47,124,59,127,148,70,59,
+43,59,41,48,3,77,61,54,126,42,151,1,215,152,3,49,81,134,111,65,88,49,42,34,
+48,5,45,47,65,47,253,230,15,105,105,15,1,173,37,45,134,111,67,86,49,42,32,
+51,4,45,47,62,51,1,240,15,105,105,15,0,0,1,0,60,0,0,5,84,5,64,0,46,0,0,1,
+22,22,51,50,54,55,53,52,38,35,34,6,7,22,21,20,6,35,34,38,53,52,54,54,51,50,
+18,17,17,23,21,33,53,55,17,6,35,34,38,39,35,7,35,17,51,23,1,234,19,99,93,
+116,182,46,167,169,57,106,22,53,55,45,52,62,99,171,95,252,233,151,254,29,
+164,136,209,127,162,42,170,9,130,130,9,2,194,101,91,102,86,78,230,200,33,
+23,27,58,43,51,60,54,77,115,63,254,234,254,211,253,123,15,105,105,15,1,131,
+132,96,101,175,1,218,165,0,0,1,0,115,255,236,4,79,5,64,0,46,0,0,5,34,36,53,
+52,54,55,53,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,20,33,51,21,35,34,
+6,21,20,22,51,50,54,53,52,35,35,53,55,50,22,21,20,4,2,107,244,254,252,159,
+136,120,124,247,209,255,155,64,60,182,90,143,163,1,88,248,248,177,210,172,
+168,147,174,123,33,47,129,135,254,245,20,201,183,138,194,30,10,24,143,106,
+152,183,91,119,31,39,108,98,195,140,149,131,130,133,87,76,85,121,4,112,105,
+134,162,0,3,0,50,255,236,5,225,5,44,0,25,0,35,0,45,0,0,1,35,34,38,53,52,54,
+51,50,22,21,21,33,17,39,53,33,21,7,17,16,6,35,34,38,53,1,50,54,54,53,53,33,
+21,20,22,1,20,22,51,51,53,52,35,34,6,2,26,60,213,215,192,140,152,162,1,233,
+150,1,214,152,203,222,201,189,1,136,99,104,52,254,23,110,253,161,128,128,
+83,161,79,99,2,75,170,164,145,183,180,168,176,1,223,15,105,105,15,253,59,
+254,241,244,224,232,254,192,74,162,137,98,132,181,158,3,45,99,105,184,209,
+105,0,0,2,0,101,255,236,5,115,5,64,0,35,0,47,0,0,1,20,6,7,22,51,50,54,54,
+53,52,0,35,34,6,7,39,54,54,51,32,0,17,20,2,4,35,34,36,2,53,52,54,51,50,22,
+37,34,6,21,20,22,23,54,54,53,52,38,3,27,187,170,100,182,144,228,129,254,232,
+242,102,216,65,81,79,250,142,1,66,1,111,167,254,202,198,184,254,229,152,200,
+166,154,174,254,192,100,107,44,36,132,149,81,2,131,155,229,62,77,133,254,
+173,245,1,23,71,55,105,74,87,254,160,254,200,206,254,192,174,142,1,0,160,
+197,236,180,56,161,142,79,136,41,42,190,122,93,112,0,0,2,0,115,255,241,7,
+47,5,64,0,44,0,56,0,0,37,50,36,18,53,52,38,35,34,6,21,20,22,23,21,38,38,53,
+52,54,54,51,50,22,22,21,20,2,4,33,34,36,2,53,52,18,51,50,22,21,20,6,6,7,22,
+1,16,23,62,2,53,52,38,35,34,6,3,197,213,1,68,177,114,117,83,107,72,70,136,
+152,85,152,98,126,176,90,209,254,115,254,242,254,254,130,212,217,187,162,
+192,67,143,116,184,254,68,161,94,111,52,98,92,111,117,130,165,1,58,210,187,
+182,102,83,75,91,6,140,4,165,134,92,153,85,121,225,150,251,254,129,209,210,
+1,129,239,247,1,22,235,200,149,212,200,90,128,2,188,254,219,190,79,174,179,
+129,146,154,189,0,0,2,0,50,255,246,5,21,5,64,0,38,0,48,0,0,1,50,22,18,17,
+16,2,35,34,38,53,52,54,51,50,22,23,54,54,55,33,14,3,35,34,38,53,52,54,51,
+50,22,23,54,18,19,18,19,33,46,2,35,34,6,6,7,3,98,146,195,94,168,155,65,80,
+56,42,32,54,7,49,56,3,253,197,26,78,90,108,63,67,79,55,44,34,53,5,71,84,27,
+35,116,2,47,3,54,116,100,90,114,61,13,5,64,142,254,211,254,238,254,202,254,
+185,63,53,46,58,41,48,11,233,187,193,221,99,49,63,53,45,61,44,48,18,1,66,
+1,108,2,8,253,106,212,213,101,85,169,173,0,0,1,0,50,255,244,5,173,5,64,0,
+38,0,0,37,23,21,33,53,55,17,52,38,35,34,6,6,7,14,4,35,34,38,53,52,54,51,50,
+22,21,21,54,18,19,18,18,51,50,22,21,5,21,152,254,40,150,123,134,90,125,66,
+14,16,39,71,89,105,63,67,79,55,44,41,52,69,86,24,19,223,202,222,214,120,15,
+105,105,15,2,208,192,172,84,176,186,205,243,183,92,47,69,54,45,61,51,43,8,
+18,1,62,1,88,1,17,1,20,239,254,0,0,1,0,67,255,232,4,190,5,44,0,33,0,0,37,
+52,54,55,35,6,0,35,34,38,53,52,54,51,50,22,21,20,7,23,50,36,18,55,17,39,53,
+33,21,7,17,23,21,33,3,127,7,3,8,96,254,175,182,96,119,66,48,49,55,19,40,113,
+1,6,205,9,162,1,225,151,151,254,193,190,49,240,21,234,254,222,83,75,55,69,
+49,42,34,24,3,237,1,123,137,1,89,15,105,105,15,251,196,15,105,0,0,1,0,67,
+255,232,5,17,5,44,0,33,0,0,1,6,0,35,34,38,53,52,54,51,50,22,21,20,7,23,50,
+36,18,55,17,33,7,35,17,33,21,35,17,35,53,52,54,55,3,170,97,254,145,192,96,
+119,66,48,49,55,19,30,124,1,28,223,9,254,70,15,129,3,179,193,168,7,3,1,244,
+237,254,225,83,75,55,69,49,42,34,24,3,225,1,118,139,1,94,231,1,105,130,251,
+86,190,49,240,21,0,0,2,0,70,255,235,5,197,5,44,0,39,0,51,0,0,1,50,23,62,3,
+55,53,39,53,33,21,7,21,4,0,21,20,0,7,53,36,17,52,38,39,6,7,22,22,21,20,6,
+35,34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,1,197,34,36,36,78,75,
+53,2,157,1,217,157,1,13,1,26,254,237,232,1,87,238,228,89,84,80,81,206,176,
+180,203,207,176,107,119,119,107,106,121,119,3,70,6,16,50,68,66,34,138,15,
+105,105,15,183,65,254,245,210,210,254,240,18,132,60,1,51,176,207,44,79,48,
+57,178,109,187,232,216,188,188,231,253,73,154,133,133,146,153,133,130,150,
+0,0,1,0,60,255,241,5,168,5,44,0,56,0,0,55,54,54,53,52,38,39,53,22,23,54,54,
+55,53,39,53,33,21,7,21,4,0,21,20,6,6,35,34,38,53,52,54,55,21,6,6,21,20,22,
+51,50,54,54,53,52,46,2,39,6,6,7,22,21,20,6,7,60,96,105,86,88,159,93,156,199,
+4,157,1,217,157,1,46,1,33,117,210,134,164,186,165,134,68,76,107,85,85,135,
+73,60,114,182,121,67,220,112,7,191,156,253,2,107,88,84,103,8,122,4,108,109,
+219,84,137,15,105,105,15,182,47,254,239,242,131,220,124,159,134,128,154,2,
+122,3,81,67,81,93,88,157,93,113,146,99,68,15,101,199,70,38,36,140,174,4,0,
+0,2,0,40,255,241,6,214,5,44,0,65,0,77,0,0,19,62,2,51,23,54,54,53,53,39,53,
+33,21,7,21,22,51,50,54,55,62,2,51,50,22,21,20,6,7,53,54,54,53,52,38,35,34,
+6,6,7,14,2,35,34,39,6,7,22,22,21,20,6,35,34,38,53,52,55,39,35,34,6,7,5,52,
+38,39,6,6,21,20,22,51,50,54,40,8,111,185,113,75,44,30,157,1,217,153,13,83,
+41,104,90,99,98,101,54,134,164,172,146,75,98,87,69,40,74,74,87,96,85,85,43,
+78,42,22,44,124,135,169,152,143,159,129,11,11,89,142,20,2,102,103,82,75,60,
+80,74,78,88,1,199,94,155,86,5,59,149,83,132,5,111,111,5,168,40,52,71,78,56,
+33,149,125,128,171,18,127,14,97,66,73,69,25,45,67,75,49,29,42,82,64,53,200,
+131,176,206,165,144,193,176,1,115,94,88,103,144,27,91,149,85,94,105,128,0,
+0,3,0,70,255,241,6,10,5,64,0,47,0,59,0,72,0,0,1,34,6,7,6,6,7,7,51,32,17,20,
+6,35,34,38,53,52,54,55,32,17,52,54,51,50,22,21,7,54,54,55,62,2,51,50,22,21,
+20,6,7,53,54,54,53,52,38,1,6,21,20,22,51,50,54,53,52,38,35,3,51,55,54,53,
+52,38,35,34,6,21,20,22,4,215,54,111,119,114,161,76,55,40,1,118,174,132,143,
+163,25,61,254,145,162,123,134,147,5,56,103,50,112,112,117,63,136,166,171,
+147,77,94,87,252,235,15,80,77,68,81,119,143,119,17,17,14,63,68,62,82,106,
+4,121,55,94,92,88,14,231,254,202,116,160,172,150,65,161,253,1,30,114,158,
+154,146,102,19,80,44,96,70,39,149,125,128,171,18,127,16,98,63,61,81,253,77,
+71,67,108,94,86,71,93,90,1,208,2,81,43,89,88,84,60,79,80,0,0,1,0,100,0,0,
+5,212,5,44,0,17,0,0,1,33,7,35,17,33,21,35,17,20,3,51,54,19,1,51,1,35,2,71,
+254,173,15,129,3,97,218,27,8,12,168,1,145,183,253,60,201,4,170,207,1,81,130,
+254,84,181,254,66,45,1,88,3,28,250,212,0,0,2,0,30,0,0,6,236,5,44,0,35,0,47,
+0,0,33,35,17,7,6,6,35,34,38,53,52,54,51,50,22,23,55,17,39,53,33,21,7,17,20,
+2,7,51,54,19,55,39,53,33,21,7,5,52,38,35,34,6,21,20,22,51,50,54,4,88,182,
+224,18,182,138,155,183,185,157,132,175,24,227,182,1,244,160,16,11,8,68,168,
+148,150,1,213,152,251,223,101,90,92,102,100,90,93,102,2,160,142,140,164,201,
+167,164,205,151,136,138,1,134,15,105,105,15,254,74,72,254,120,173,146,1,10,
+234,14,105,105,14,181,119,126,127,118,117,127,131,0,0,1,0,30,0,0,9,14,5,44,
+0,76,0,0,1,51,21,22,22,51,50,54,51,50,22,21,20,6,35,34,38,39,55,22,51,50,
+54,53,52,38,35,34,6,35,34,39,1,35,3,35,6,6,35,34,38,38,53,52,54,54,51,50,
+22,21,20,6,35,34,38,53,55,6,6,21,20,22,51,50,54,54,55,3,51,19,19,51,54,19,
+19,54,55,5,132,160,10,56,41,49,215,84,127,164,179,139,119,151,22,125,37,130,
+79,97,80,76,75,199,63,91,58,254,128,206,149,7,59,230,150,90,147,82,75,130,
+73,74,102,54,45,39,49,2,62,68,105,91,96,166,99,1,128,174,197,81,5,24,85,168,
+53,26,5,44,48,25,29,101,155,125,140,172,114,106,40,133,98,79,67,84,95,50,
+251,139,2,59,144,163,71,131,86,83,140,80,72,59,47,57,45,42,23,4,89,73,74,
+86,116,201,112,1,235,252,179,254,145,88,1,22,2,17,164,105,0,1,0,50,0,0,4,
+212,5,64,0,45,0,0,37,52,55,35,6,6,35,34,38,39,39,53,33,21,7,22,22,51,50,54,
+54,53,53,16,33,34,6,7,23,21,33,53,55,62,2,51,50,18,17,17,23,21,33,53,55,3,
+151,9,10,50,182,124,164,210,20,118,1,175,152,2,142,116,95,150,85,254,202,
+115,161,4,152,254,81,118,13,116,201,108,235,244,151,254,40,155,244,129,85,
+75,80,175,153,12,104,104,11,87,106,90,174,120,6,1,123,109,84,10,105,105,11,
+97,145,86,254,248,254,255,253,65,15,105,105,15,0,1,0,29,255,236,5,140,5,44,
+0,45,0,0,1,34,38,39,55,22,22,51,50,62,2,55,53,39,53,33,21,7,21,4,4,21,20,
+6,6,35,34,38,38,53,51,20,22,22,51,50,54,53,52,38,39,6,7,6,6,1,78,99,160,46,
+86,60,100,66,41,86,93,164,3,157,1,217,156,1,10,1,10,138,247,150,147,211,118,
+153,83,143,97,166,201,206,195,41,93,122,179,2,122,88,80,84,58,46,28,59,144,
+16,175,15,105,105,15,172,28,255,251,143,239,136,99,204,136,87,142,70,216,
+177,190,192,4,4,76,103,82,0,0,1,0,50,255,113,5,111,5,44,0,31,0,0,1,35,17,
+35,17,35,6,6,35,34,38,53,17,35,53,51,55,51,21,33,21,33,17,20,22,51,32,17,
+53,35,53,33,5,111,250,149,8,58,155,103,176,192,250,254,6,158,1,64,254,192,
+112,108,1,48,250,2,137,1,187,253,182,1,20,80,73,201,210,2,37,130,254,254,
+130,253,225,135,142,1,61,6,130,0,0,2,0,30,254,20,5,23,5,64,0,31,0,55,0,0,
+19,22,22,23,17,52,54,51,50,22,22,21,20,6,7,7,21,22,22,21,20,4,35,34,38,39,
+17,35,17,38,2,53,1,50,54,53,52,38,39,38,38,53,52,54,55,54,54,53,52,38,35,
+34,6,21,17,22,174,4,143,127,235,207,109,183,101,77,81,134,162,150,254,229,
+247,35,103,21,166,211,207,2,227,173,196,86,92,55,58,43,91,84,54,121,108,130,
+146,77,2,61,144,211,49,2,192,220,251,79,139,83,78,124,59,93,10,58,150,107,
+178,206,9,4,254,27,2,1,63,1,16,217,254,59,126,108,62,90,36,20,53,49,37,60,
+72,68,86,51,78,92,162,139,252,248,11,0,0,2,0,110,255,236,7,98,5,64,0,43,0,
+53,0,0,1,22,51,50,54,53,52,38,35,34,6,6,7,35,39,46,2,39,17,20,6,35,32,17,
+52,18,36,51,32,19,51,54,54,51,50,22,22,21,20,6,35,34,39,1,50,54,53,17,6,2,
+21,20,22,5,219,41,67,63,75,110,99,81,127,74,5,143,2,2,59,130,97,177,167,254,
+150,160,1,43,205,1,84,76,5,42,178,123,107,160,85,158,124,130,66,252,86,91,
+85,172,196,88,3,131,48,92,71,91,101,91,173,128,72,85,149,82,4,253,41,244,
+255,2,75,230,1,98,193,254,253,124,135,81,146,93,129,171,87,253,77,166,181,
+2,219,37,254,173,252,250,200,0,0,2,0,125,255,240,4,12,5,64,0,33,0,46,0,0,
+19,16,0,51,50,22,22,21,20,6,35,34,38,53,52,55,38,35,34,6,2,7,51,54,54,51,
+50,22,21,20,4,35,34,2,5,50,54,53,52,38,35,34,6,6,21,20,22,125,1,22,248,104,
+166,97,61,47,50,51,51,56,148,114,164,90,4,10,47,175,106,186,228,254,252,202,
+215,234,1,198,128,165,145,125,88,135,76,152,2,38,1,113,1,169,67,119,66,67,
+65,55,37,59,30,69,141,254,255,168,86,92,229,180,185,244,1,30,152,160,137,
+126,148,73,131,77,128,162,0,2,0,70,255,236,5,97,5,64,0,36,0,49,0,0,1,52,54,
+51,50,22,22,21,20,6,35,34,38,53,52,55,38,38,35,34,6,21,19,16,2,35,34,38,53,
+52,18,51,50,22,23,51,38,3,50,54,53,52,38,35,34,6,6,21,20,22,2,190,185,166,
+94,149,81,62,57,47,55,67,5,88,75,99,94,7,219,214,170,196,215,176,88,121,31,
+10,9,240,114,133,130,103,74,107,59,119,3,184,184,208,78,135,77,81,82,54,41,
+67,32,61,72,128,115,254,73,254,239,254,229,238,197,201,1,1,71,60,86,253,50,
+189,163,126,153,75,150,96,148,162,0,2,0,70,255,236,7,11,5,64,0,47,0,59,0,
+0,19,52,54,51,50,22,23,55,55,39,53,33,21,7,17,20,22,51,50,54,53,16,0,33,34,
+4,7,39,62,2,51,32,0,17,16,2,35,34,38,39,39,7,6,6,35,34,38,37,52,38,35,34,
+6,21,20,22,51,50,54,70,206,176,152,197,26,249,3,155,1,196,142,73,84,115,124,
+254,194,254,212,141,254,235,90,87,46,191,234,125,1,114,1,164,223,193,154,
+154,2,1,244,15,203,161,180,203,2,96,119,107,107,118,119,107,107,118,1,128,
+187,232,158,151,101,108,15,105,105,15,254,198,147,132,249,236,1,35,1,52,100,
+81,100,58,108,65,254,116,254,156,254,224,254,188,180,197,116,124,172,197,
+216,199,132,148,154,133,132,148,154,0,0,1,0,70,255,236,6,245,5,64,0,50,0,
+0,1,21,20,22,22,51,50,18,17,52,2,35,34,6,7,39,54,54,51,50,4,18,21,16,0,33,
+34,38,39,35,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,52,55,3,
+206,65,125,90,178,175,236,198,101,189,58,108,69,242,152,177,1,19,149,254,
+239,254,250,145,189,35,9,48,193,147,200,210,48,33,141,25,35,132,120,127,165,
+30,11,2,203,243,103,159,90,1,28,1,10,234,1,36,83,76,77,111,119,170,254,204,
+196,254,170,254,164,137,124,121,140,223,215,91,185,41,6,48,150,86,166,159,
+167,161,124,143,0,1,0,70,255,236,7,49,5,64,0,62,0,0,1,50,22,21,20,6,35,34,
+38,39,6,6,21,20,22,22,51,50,18,17,52,38,38,35,34,6,7,39,54,54,51,50,4,18,
+21,16,0,33,34,38,39,35,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,
+55,54,54,4,95,69,85,58,52,39,48,2,48,52,66,126,90,194,217,121,213,128,107,
+195,61,100,70,248,152,182,1,32,159,254,193,254,236,141,200,31,11,53,195,126,
+203,216,48,33,141,25,35,134,123,128,169,35,35,149,3,11,72,56,45,62,41,41,
+14,112,89,80,131,80,1,45,1,3,153,240,131,75,66,87,92,102,168,254,206,190,
+254,190,254,134,128,112,117,123,231,208,90,186,40,6,48,149,82,159,171,177,
+172,165,145,0,0,1,0,70,255,236,7,59,5,64,0,76,0,0,1,34,6,7,39,54,36,51,50,
+4,18,21,16,0,33,34,38,39,35,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,
+54,55,38,38,39,34,6,7,39,54,51,50,22,23,51,54,54,51,50,23,22,51,50,55,23,
+6,35,34,39,6,6,7,22,22,51,50,18,53,52,38,36,4,92,131,235,67,85,72,1,22,175,
+209,1,79,184,254,203,254,246,138,172,45,10,61,213,132,207,228,50,31,141,24,
+36,143,129,135,177,44,8,83,43,20,129,47,12,102,96,76,105,34,9,34,75,55,20,
+51,51,44,39,54,10,59,63,81,62,31,67,12,16,154,113,184,214,143,254,252,4,180,
+71,57,102,77,89,172,254,202,192,254,194,254,140,126,121,118,129,228,210,86,
+193,38,6,49,160,80,152,168,158,138,65,139,12,28,18,127,52,84,92,86,85,18,
+18,15,132,22,42,22,139,61,127,158,1,32,246,160,251,139,0,4,0,70,255,236,5,
+140,5,64,0,45,0,57,0,69,0,79,0,0,1,52,55,38,39,6,7,7,22,22,21,20,6,6,35,34,
+38,53,52,54,54,55,38,53,52,54,54,51,50,22,22,21,20,6,7,30,3,21,20,6,6,35,
+34,38,1,20,22,23,54,54,53,52,38,35,34,6,1,52,38,39,6,6,21,20,22,51,50,54,
+37,52,39,6,21,20,22,51,50,54,3,69,183,211,74,58,139,74,87,102,80,136,78,133,
+156,96,209,227,157,81,140,79,79,139,82,72,88,206,205,89,35,79,133,83,136,
+152,254,255,87,78,78,87,94,71,68,97,2,188,68,71,79,85,80,68,69,86,253,1,163,
+140,82,67,69,85,1,3,201,89,100,42,33,65,38,46,137,105,89,129,69,151,131,106,
+161,140,107,124,155,87,130,72,72,130,87,79,132,64,94,129,106,112,69,91,130,
+69,150,3,167,72,98,45,45,98,72,68,86,86,252,164,75,102,37,26,120,79,73,83,
+90,71,160,59,72,142,78,88,88,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,
+0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,
+74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,
+0,6,0,32,0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,
+1,4,9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,11,0,62,2,
+14,0,3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,0,1,4,9,0,
+14,0,52,5,30,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,
+50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,67,0,104,0,101,0,114,0,111,0,107,0,
+101,0,101,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,67,0,104,
+0,101,0,114,0,111,0,107,0,101,0,101,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,
+0,97,0,110,0,115,0,67,0,104,0,101,0,114,0,111,0,107,0,101,0,101,0,78,0,111,
+0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,
+0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,
+0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,
+46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,
+105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,
+0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,
+0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,
+0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,
+0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,
+0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,
+0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,0,0,1,2,0,2,0,3,1,3,1,
+4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,
+20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,
+1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,
+1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,
+1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,4,110,117,108,108,7,117,110,105,49,
+51,65,48,7,117,110,105,49,51,65,49,7,117,110,105,49,51,65,50,7,117,110,105,
+49,51,65,65,7,117,110,105,49,51,65,67,7,117,110,105,49,51,66,51,7,117,110,
+105,49,51,66,55,7,117,110,105,49,51,66,66,7,117,110,105,49,51,66,69,7,117,
+110,105,49,51,67,51,7,117,110,105,49,51,68,57,7,117,110,105,49,51,68,69,7,
+117,110,105,49,51,68,70,7,117,110,105,49,51,69,50,7,117,110,105,49,51,70,
+52,7,117,110,105,49,51,66,48,7,117,110,105,49,51,65,52,7,117,110,105,49,51,
+65,53,7,117,110,105,49,51,69,51,7,117,110,105,49,51,65,69,7,117,110,105,49,
+51,65,57,7,117,110,105,49,51,66,68,7,117,110,105,49,51,66,65,7,117,110,105,
+49,51,67,67,7,117,110,105,49,51,65,56,7,117,110,105,49,51,68,52,7,117,110,
+105,49,51,67,50,7,117,110,105,49,51,70,50,7,117,110,105,49,51,69,53,7,117,
+110,105,49,51,67,53,7,117,110,105,49,51,69,54,7,117,110,105,49,51,68,68,7,
+117,110,105,49,51,68,65,7,117,110,105,49,51,65,54,7,117,110,105,49,51,68,
+53,7,117,110,105,49,51,65,66,7,117,110,105,49,51,68,51,7,117,110,105,49,51,
+66,49,7,117,110,105,49,51,68,50,7,117,110,105,49,51,67,48,7,117,110,105,49,
+51,70,51,7,117,110,105,49,51,69,56,7,117,110,105,49,51,69,57,7,117,110,105,
+49,51,66,54,7,117,110,105,49,51,69,68,7,117,110,105,49,51,67,54,7,117,110,
+105,49,51,69,65,7,117,110,105,49,51,66,50,7,117,110,105,49,51,69,49,7,117,
+110,105,49,51,67,56,7,117,110,105,49,51,69,66,7,117,110,105,49,51,66,53,7,
+117,110,105,49,51,69,55,7,117,110,105,49,51,68,54,7,117,110,105,49,51,67,
+70,7,117,110,105,49,51,67,69,7,117,110,105,49,51,68,48,7,117,110,105,49,51,
+66,56,7,117,110,105,49,51,67,66,7,117,110,105,49,51,69,48,7,117,110,105,49,
+51,65,55,7,117,110,105,49,51,69,67,7,117,110,105,49,51,65,70,7,117,110,105,
+49,51,67,49,7,117,110,105,49,51,68,55,7,117,110,105,49,51,68,56,7,117,110,
+105,49,51,65,51,7,117,110,105,49,51,70,49,7,117,110,105,49,51,66,57,7,117,
+110,105,49,51,68,49,7,117,110,105,49,51,69,52,7,117,110,105,49,51,65,68,7,
+117,110,105,49,51,67,57,7,117,110,105,49,51,67,52,7,117,110,105,49,51,66,
+67,7,117,110,105,49,51,66,70,7,117,110,105,49,51,70,48,7,117,110,105,49,51,
+68,66,7,117,110,105,49,51,69,69,7,117,110,105,49,51,66,52,7,117,110,105,49,
+51,67,68,7,117,110,105,49,51,67,55,7,117,110,105,49,51,67,65,7,117,110,105,
+49,51,69,70,7,117,110,105,49,51,68,67,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,
+1,0,0,0,12,0,0,0,22,0,0,0,2,0,1,0,0,0,88,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,
+0,10,0,48,0,74,0,2,68,70,76,84,0,26,99,104,101,114,0,14,0,4,0,0,0,0,255,255,
+0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,1,0,2,107,101,114,110,0,14,107,101,114,
+110,0,20,0,0,0,1,0,0,0,0,0,1,0,0,0,1,0,4,0,2,0,8,0,1,0,8,0,1,80,220,0,4,0,
+0,0,85,0,180,1,190,2,112,3,90,4,52,4,234,5,240,5,240,6,126,7,128,8,42,9,44,
+10,46,10,244,11,158,12,20,13,74,13,244,14,214,15,156,16,130,17,140,18,146,
+19,196,20,114,21,168,22,178,23,160,24,150,25,224,27,30,28,0,28,242,29,196,
+31,14,32,48,32,134,33,124,34,102,35,64,36,114,37,156,38,218,40,40,41,2,41,
+180,42,110,43,96,44,170,45,116,46,74,47,80,48,66,49,0,49,242,51,44,52,90,
+53,144,54,82,55,52,55,186,56,188,57,198,58,180,59,142,60,32,60,210,61,188,
+62,178,63,212,64,162,65,172,66,234,68,52,69,14,70,20,71,102,71,232,72,254,
+74,20,75,46,76,56,77,66,78,84,79,142,0,66,0,4,255,226,0,5,255,226,0,6,255,
+216,0,7,255,166,0,8,255,226,0,9,255,176,0,10,255,226,0,11,255,226,0,13,255,
+236,0,14,255,176,0,15,255,226,0,17,255,226,0,18,255,226,0,19,255,226,0,23,
+255,246,0,24,255,196,0,25,0,60,0,27,255,246,0,28,255,226,0,29,255,196,0,30,
+255,226,0,32,255,226,0,33,0,10,0,34,255,226,0,38,0,15,0,39,255,196,0,40,255,
+246,0,41,255,226,0,42,255,226,0,48,0,10,0,49,255,226,0,50,0,10,0,51,255,206,
+0,52,0,50,0,53,0,40,0,56,0,50,0,57,255,216,0,58,255,226,0,59,0,50,0,60,0,
+40,0,61,0,40,0,62,255,246,0,63,0,50,0,64,0,10,0,66,255,166,0,67,255,156,0,
+68,255,176,0,69,255,166,0,70,0,30,0,71,0,50,0,72,0,40,0,73,255,216,0,74,255,
+216,0,75,0,60,0,76,0,80,0,77,0,50,0,78,0,30,0,79,255,246,0,80,0,50,0,81,0,
+30,0,83,0,20,0,84,0,50,0,85,0,50,0,86,0,50,0,87,0,30,0,88,0,5,0,44,0,6,255,
+216,0,9,255,206,0,12,255,186,0,14,255,206,0,16,255,186,0,20,255,186,0,22,
+255,186,0,24,255,216,0,25,0,30,0,26,255,186,0,27,255,236,0,29,255,206,0,31,
+0,20,0,33,255,186,0,35,0,20,0,39,255,236,0,40,255,236,0,43,255,206,0,44,255,
+186,0,45,255,196,0,46,255,196,0,47,255,186,0,48,255,246,0,53,255,236,0,54,
+255,186,0,55,0,20,0,57,255,216,0,60,255,236,0,61,255,236,0,62,255,246,0,63,
+255,236,0,64,255,186,0,65,255,216,0,66,255,236,0,72,255,196,0,73,255,216,
+0,74,255,206,0,76,255,226,0,77,255,236,0,78,255,216,0,79,255,216,0,81,255,
+206,0,82,255,196,0,83,255,246,0,58,0,7,255,66,0,9,0,20,0,12,255,196,0,14,
+0,20,0,16,255,196,0,20,255,196,0,21,255,196,0,22,255,196,0,24,0,30,0,26,255,
+196,0,29,0,20,0,31,255,156,0,33,255,196,0,35,255,186,0,36,255,216,0,37,255,
+216,0,38,255,216,0,39,255,66,0,43,255,196,0,44,255,196,0,45,255,196,0,46,
+255,196,0,47,255,196,0,48,255,186,0,50,255,96,0,51,255,86,0,52,0,40,0,53,
+0,40,0,54,255,196,0,55,255,186,0,56,255,126,0,59,255,166,0,60,255,216,0,61,
+255,216,0,62,255,206,0,63,0,10,0,64,255,196,0,66,255,46,0,67,255,66,0,68,
+255,66,0,69,255,86,0,70,255,96,0,71,255,126,0,72,255,126,0,75,255,206,0,76,
+255,166,0,77,0,10,0,78,255,216,0,79,0,40,0,80,255,126,0,81,255,196,0,82,255,
+196,0,83,255,126,0,84,255,126,0,85,255,126,0,86,255,116,0,87,255,126,0,88,
+255,126,0,54,0,6,255,66,0,7,0,60,0,9,255,46,0,12,255,186,0,14,255,56,0,16,
+255,186,0,20,255,176,0,21,0,20,0,22,255,186,0,24,255,186,0,25,0,20,0,26,255,
+176,0,27,255,156,0,29,255,66,0,33,255,186,0,37,255,226,0,38,0,10,0,39,0,10,
+0,40,255,156,0,43,255,186,0,44,255,186,0,45,255,186,0,46,255,186,0,47,255,
+186,0,48,255,246,0,50,0,20,0,51,0,40,0,52,255,86,0,53,255,86,0,54,255,186,
+0,56,0,20,0,57,254,242,0,59,255,216,0,60,255,156,0,61,255,176,0,63,255,96,
+0,64,255,186,0,65,255,136,0,66,0,60,0,67,0,60,0,68,0,60,0,69,0,30,0,71,0,
+10,0,72,255,166,0,73,255,66,0,74,255,56,0,75,255,216,0,76,255,186,0,77,255,
+176,0,78,255,86,0,79,255,66,0,81,255,186,0,82,255,186,0,87,0,10,0,45,0,7,
+0,15,0,12,255,226,0,16,255,226,0,20,255,226,0,22,255,226,0,25,0,50,0,26,255,
+236,0,33,255,226,0,39,255,226,0,43,255,226,0,44,255,226,0,45,255,226,0,46,
+255,226,0,47,255,226,0,48,255,236,0,50,0,15,0,51,0,15,0,52,0,10,0,53,255,
+231,0,54,255,226,0,57,255,246,0,59,255,236,0,60,255,216,0,61,255,226,0,62,
+255,236,0,64,255,226,0,65,255,231,0,66,255,246,0,67,0,15,0,68,0,15,0,69,0,
+15,0,71,0,50,0,72,255,206,0,73,0,10,0,75,255,226,0,76,255,226,0,78,255,196,
+0,79,255,216,0,80,0,30,0,81,255,226,0,82,255,226,0,83,0,10,0,84,0,10,0,87,
+0,10,0,88,255,246,0,65,0,6,0,20,0,7,254,242,0,9,0,30,0,12,255,156,0,13,255,
+236,0,14,0,30,0,16,255,156,0,20,255,156,0,21,255,156,0,22,255,156,0,24,0,
+40,0,25,0,10,0,26,255,156,0,29,0,30,0,31,255,116,0,33,255,156,0,35,255,106,
+0,36,255,186,0,37,255,136,0,38,255,186,0,39,254,242,0,43,255,156,0,44,255,
+156,0,45,255,156,0,46,255,156,0,47,255,156,0,48,255,136,0,50,255,36,0,51,
+255,36,0,52,255,226,0,53,255,226,0,54,255,156,0,55,255,126,0,56,255,96,0,
+57,0,20,0,59,255,86,0,60,255,156,0,61,255,176,0,62,255,186,0,63,255,236,0,
+64,255,156,0,65,255,206,0,66,254,232,0,67,254,242,0,68,254,212,0,69,255,46,
+0,70,255,76,0,71,255,106,0,72,255,96,0,73,0,20,0,74,0,20,0,75,255,156,0,76,
+255,96,0,77,255,236,0,78,255,156,0,79,255,176,0,80,255,66,0,81,255,156,0,
+82,255,136,0,83,255,76,0,84,255,96,0,85,255,96,0,86,255,96,0,87,255,86,0,
+88,255,66,0,35,0,12,255,226,0,16,255,226,0,20,255,226,0,22,255,226,0,26,255,
+226,0,33,255,226,0,39,255,226,0,43,255,226,0,44,255,226,0,45,255,226,0,46,
+255,226,0,47,255,226,0,48,255,236,0,52,255,246,0,53,255,231,0,54,255,226,
+0,57,255,246,0,59,255,236,0,60,255,216,0,61,255,246,0,62,255,236,0,63,0,10,
+0,64,255,226,0,65,255,231,0,66,255,246,0,70,255,226,0,72,255,186,0,75,255,
+226,0,76,255,216,0,78,255,196,0,79,255,216,0,81,255,226,0,82,255,226,0,83,
+255,246,0,88,255,236,0,64,0,4,255,226,0,5,255,226,0,6,255,216,0,7,255,186,
+0,8,255,226,0,9,255,176,0,10,255,226,0,11,255,226,0,13,255,236,0,14,255,176,
+0,15,255,226,0,17,255,226,0,18,255,226,0,19,255,226,0,23,255,226,0,24,255,
+196,0,25,0,40,0,27,255,246,0,28,255,226,0,29,255,196,0,30,255,226,0,32,255,
+226,0,33,0,10,0,34,255,226,0,38,0,15,0,39,255,206,0,40,255,246,0,41,255,226,
+0,42,255,226,0,48,0,10,0,49,255,216,0,50,0,30,0,51,0,10,0,52,0,50,0,53,0,
+40,0,56,0,50,0,57,255,216,0,58,255,226,0,59,0,50,0,60,0,60,0,61,0,80,0,62,
+255,246,0,63,0,50,0,64,0,10,0,66,255,176,0,67,255,186,0,68,255,176,0,69,255,
+186,0,70,0,30,0,71,0,50,0,72,0,50,0,73,255,216,0,74,255,216,0,75,0,60,0,76,
+0,80,0,77,0,50,0,78,0,70,0,80,0,50,0,81,0,30,0,83,0,50,0,84,0,50,0,85,0,50,
+0,86,0,50,0,87,0,50,0,42,0,6,255,236,0,12,255,206,0,13,0,30,0,16,255,206,
+0,20,255,206,0,22,255,206,0,24,0,30,0,25,0,60,0,26,255,206,0,33,255,206,0,
+38,0,30,0,43,255,206,0,44,255,206,0,45,255,206,0,46,255,206,0,47,255,206,
+0,50,0,30,0,51,0,30,0,54,255,206,0,56,0,10,0,57,255,236,0,59,0,40,0,60,255,
+206,0,61,255,246,0,64,255,206,0,65,255,236,0,70,0,10,0,71,0,20,0,72,0,10,
+0,73,255,246,0,74,255,246,0,78,255,206,0,79,255,246,0,80,0,10,0,81,255,226,
+0,82,255,206,0,83,0,20,0,84,0,10,0,85,0,10,0,86,0,10,0,87,0,10,0,88,0,10,
+0,64,0,6,0,20,0,7,255,6,0,9,0,40,0,12,255,156,0,14,0,40,0,16,255,156,0,20,
+255,156,0,21,255,216,0,22,255,156,0,24,0,40,0,25,0,10,0,26,255,156,0,29,0,
+40,0,31,255,156,0,33,255,156,0,35,255,116,0,36,255,206,0,37,255,186,0,38,
+255,206,0,39,255,6,0,43,255,156,0,44,255,156,0,45,255,156,0,46,255,156,0,
+47,255,156,0,48,255,196,0,50,255,56,0,51,255,86,0,52,255,236,0,53,0,30,0,
+54,255,156,0,55,255,156,0,56,255,96,0,57,0,20,0,59,255,106,0,60,255,156,0,
+61,255,176,0,62,255,196,0,63,255,236,0,64,255,156,0,65,255,226,0,66,254,232,
+0,67,255,6,0,68,255,6,0,69,255,6,0,70,255,86,0,71,255,96,0,72,255,96,0,73,
+0,20,0,74,0,20,0,75,255,156,0,76,255,156,0,77,255,236,0,78,255,156,0,79,0,
+20,0,80,255,76,0,81,255,156,0,82,255,156,0,83,255,96,0,84,255,96,0,85,255,
+96,0,86,255,96,0,87,255,96,0,88,255,56,0,64,0,6,255,126,0,7,0,20,0,9,255,
+106,0,12,255,226,0,14,255,106,0,16,255,226,0,20,255,226,0,21,0,20,0,22,255,
+226,0,24,255,216,0,25,0,60,0,26,255,226,0,27,255,176,0,29,255,106,0,31,0,
+20,0,33,255,226,0,35,0,20,0,36,0,10,0,37,255,246,0,38,0,50,0,39,0,20,0,40,
+255,196,0,43,255,226,0,44,255,226,0,45,255,226,0,46,255,226,0,47,255,226,
+0,50,0,60,0,51,0,60,0,52,255,96,0,53,255,106,0,54,255,226,0,55,0,20,0,56,
+0,40,0,57,255,46,0,59,0,20,0,60,255,166,0,61,0,30,0,63,255,86,0,64,255,226,
+0,65,255,196,0,66,0,40,0,67,0,20,0,68,0,40,0,69,0,40,0,70,0,40,0,71,0,60,
+0,72,255,226,0,73,255,126,0,74,255,46,0,75,0,30,0,76,0,20,0,77,255,196,0,
+78,255,116,0,79,255,126,0,80,0,40,0,81,255,236,0,82,255,226,0,83,0,41,0,84,
+0,30,0,85,0,40,0,86,0,40,0,87,0,40,0,88,0,40,0,49,0,7,255,196,0,12,255,236,
+0,16,255,236,0,20,255,236,0,25,0,60,0,26,255,236,0,27,0,10,0,33,255,236,0,
+38,0,30,0,39,255,246,0,40,0,10,0,43,255,236,0,44,255,236,0,45,255,236,0,46,
+255,246,0,47,255,236,0,48,0,10,0,50,0,40,0,51,0,30,0,52,0,60,0,53,0,60,0,
+54,255,236,0,56,0,20,0,59,0,30,0,60,255,226,0,61,255,246,0,63,0,30,0,64,255,
+236,0,66,255,196,0,67,255,196,0,68,255,196,0,69,255,206,0,70,0,20,0,71,0,
+20,0,72,0,20,0,73,0,20,0,75,0,10,0,76,0,10,0,77,0,30,0,78,255,236,0,80,0,
+41,0,81,255,236,0,82,255,236,0,83,0,20,0,84,0,10,0,85,0,20,0,86,0,40,0,87,
+0,20,0,88,0,20,0,42,0,7,255,46,0,9,0,10,0,14,0,10,0,21,255,236,0,24,255,246,
+0,25,255,216,0,29,0,10,0,31,255,226,0,35,255,226,0,38,0,20,0,39,255,46,0,
+50,255,166,0,51,255,176,0,52,0,100,0,53,0,100,0,55,255,226,0,56,255,211,0,
+59,255,236,0,60,0,50,0,61,0,50,0,63,0,70,0,65,0,20,0,66,255,46,0,67,255,56,
+0,68,255,46,0,69,255,46,0,70,255,236,0,71,255,236,0,72,255,236,0,73,0,15,
+0,75,0,40,0,76,0,40,0,77,0,90,0,78,0,80,0,79,0,30,0,80,255,236,0,83,255,236,
+0,84,255,216,0,85,255,236,0,86,255,236,0,87,255,236,0,88,255,136,0,29,0,9,
+255,196,0,14,255,226,0,25,0,50,0,29,255,226,0,38,0,20,0,50,0,40,0,51,0,40,
+0,52,0,30,0,53,0,30,0,56,0,50,0,59,0,70,0,60,0,10,0,61,0,50,0,63,0,50,0,70,
+0,60,0,71,0,70,0,72,0,60,0,75,0,50,0,76,0,50,0,77,0,50,0,78,0,10,0,80,0,60,
+0,81,0,20,0,83,0,60,0,84,0,60,0,85,0,60,0,86,0,60,0,87,0,60,0,88,0,20,0,77,
+0,4,255,226,0,5,255,226,0,6,255,226,0,7,255,156,0,8,255,226,0,9,255,166,0,
+10,255,226,0,11,255,226,0,12,0,20,0,14,255,186,0,15,255,226,0,16,0,20,0,17,
+255,226,0,18,255,226,0,19,255,226,0,20,0,20,0,22,0,20,0,23,255,226,0,24,255,
+216,0,25,0,50,0,26,0,20,0,28,255,226,0,29,255,206,0,30,255,226,0,32,255,226,
+0,33,0,20,0,34,255,226,0,37,0,10,0,38,0,10,0,39,255,176,0,41,255,226,0,42,
+255,226,0,43,0,20,0,44,0,20,0,45,0,20,0,46,0,20,0,47,0,20,0,48,0,20,0,49,
+255,226,0,50,0,40,0,51,0,20,0,52,0,80,0,53,0,30,0,54,0,20,0,56,0,60,0,57,
+255,226,0,58,255,226,0,59,0,60,0,60,0,60,0,61,0,60,0,62,0,20,0,63,0,90,0,
+64,0,30,0,65,0,20,0,66,255,156,0,67,255,146,0,68,255,146,0,69,255,156,0,70,
+0,50,0,71,0,60,0,72,0,60,0,73,255,246,0,74,255,216,0,75,0,70,0,76,0,90,0,
+77,0,90,0,78,0,60,0,79,0,20,0,80,0,80,0,81,0,30,0,82,0,20,0,83,0,40,0,84,
+0,30,0,85,0,60,0,86,0,60,0,87,0,60,0,88,255,246,0,42,0,7,255,46,0,14,0,10,
+0,21,255,226,0,24,255,246,0,26,0,20,0,29,0,10,0,31,255,226,0,35,255,226,0,
+37,255,246,0,39,255,46,0,50,255,186,0,51,255,166,0,52,0,90,0,53,0,90,0,55,
+255,226,0,56,255,211,0,57,0,30,0,59,255,236,0,60,0,50,0,61,0,50,0,63,0,70,
+0,65,0,20,0,66,255,46,0,67,255,56,0,68,255,56,0,69,255,86,0,70,255,246,0,
+71,0,10,0,72,255,246,0,73,0,30,0,75,0,40,0,76,0,40,0,77,0,90,0,78,0,50,0,
+79,0,50,0,80,255,236,0,83,255,246,0,84,255,216,0,85,255,246,0,86,255,246,
+0,87,255,236,0,88,255,176,0,56,0,6,255,196,0,7,0,20,0,9,255,166,0,12,255,
+226,0,14,255,216,0,16,255,226,0,20,255,206,0,22,255,226,0,24,255,246,0,25,
+0,50,0,26,255,226,0,29,255,216,0,32,255,236,0,33,255,226,0,39,255,226,0,43,
+255,226,0,44,255,226,0,45,255,226,0,46,255,226,0,47,255,226,0,48,255,236,
+0,50,0,20,0,51,0,20,0,52,255,246,0,53,255,231,0,54,255,226,0,56,0,10,0,57,
+255,246,0,59,255,236,0,60,255,216,0,61,255,246,0,62,255,236,0,63,255,236,
+0,64,255,236,0,65,255,231,0,66,255,246,0,67,0,20,0,68,0,20,0,69,0,20,0,70,
+255,226,0,71,0,10,0,72,255,216,0,73,255,196,0,74,255,196,0,75,255,226,0,76,
+255,216,0,78,255,226,0,79,255,216,0,80,0,40,0,82,255,236,0,83,255,246,0,84,
+0,10,0,85,0,10,0,86,0,10,0,87,0,20,0,88,255,236,0,49,0,7,255,196,0,12,255,
+236,0,20,255,236,0,22,255,236,0,24,255,246,0,25,0,60,0,26,255,236,0,27,0,
+10,0,33,255,236,0,38,0,30,0,39,255,246,0,40,0,10,0,43,255,236,0,44,255,236,
+0,45,255,236,0,46,255,246,0,47,255,236,0,48,0,10,0,50,0,40,0,51,0,30,0,52,
+0,90,0,53,0,90,0,54,255,236,0,56,0,20,0,59,0,30,0,60,0,20,0,61,0,50,0,63,
+0,70,0,64,255,236,0,66,255,196,0,67,255,196,0,68,255,196,0,69,255,206,0,70,
+0,20,0,71,0,20,0,72,0,20,0,73,0,20,0,75,0,40,0,76,0,40,0,77,0,90,0,78,0,70,
+0,79,0,70,0,80,0,41,0,82,255,236,0,83,0,30,0,84,0,10,0,85,0,20,0,86,0,40,
+0,87,0,20,0,57,0,7,255,16,0,9,255,236,0,12,255,236,0,14,0,20,0,16,255,236,
+0,20,255,236,0,21,255,196,0,22,255,236,0,24,0,10,0,25,255,216,0,26,255,236,
+0,29,0,20,0,31,255,186,0,33,255,236,0,35,255,186,0,38,0,10,0,39,255,16,0,
+43,255,236,0,44,255,236,0,45,255,236,0,46,255,236,0,47,255,236,0,50,255,66,
+0,51,255,116,0,52,0,100,0,53,0,50,0,54,255,236,0,55,255,226,0,56,255,186,
+0,59,255,186,0,60,0,50,0,61,0,50,0,63,0,60,0,64,255,236,0,65,0,20,0,66,255,
+16,0,67,255,56,0,68,255,16,0,69,255,106,0,70,255,186,0,71,255,226,0,72,255,
+216,0,73,0,15,0,75,0,20,0,76,0,40,0,77,0,90,0,78,0,20,0,79,0,30,0,80,255,
+166,0,81,255,226,0,82,255,226,0,83,255,176,0,84,255,156,0,85,255,216,0,86,
+255,216,0,87,255,196,0,88,255,106,0,66,0,6,0,30,0,7,254,252,0,9,0,50,0,12,
+255,166,0,14,0,50,0,16,255,146,0,20,255,166,0,21,255,216,0,22,255,156,0,24,
+0,50,0,25,0,10,0,26,255,166,0,27,0,20,0,29,0,50,0,31,255,136,0,33,255,166,
+0,35,255,116,0,36,255,216,0,37,255,166,0,38,255,216,0,39,254,252,0,40,0,20,
+0,43,255,166,0,44,255,166,0,45,255,166,0,46,255,146,0,47,255,166,0,48,255,
+166,0,50,255,36,0,51,255,16,0,52,255,246,0,53,0,10,0,54,255,166,0,55,255,
+156,0,56,255,86,0,57,0,30,0,59,255,86,0,60,255,146,0,61,255,186,0,62,255,
+166,0,63,255,236,0,64,255,166,0,65,255,206,0,66,254,252,0,67,254,222,0,68,
+254,172,0,69,255,66,0,70,255,56,0,71,255,76,0,72,255,76,0,73,0,30,0,74,0,
+30,0,75,255,136,0,76,255,96,0,77,255,236,0,78,255,146,0,79,0,30,0,80,255,
+76,0,81,255,166,0,82,255,166,0,83,255,66,0,84,255,46,0,85,255,76,0,86,255,
+56,0,87,255,56,0,88,254,242,0,65,0,6,0,30,0,7,254,192,0,9,0,50,0,12,255,166,
+0,14,0,50,0,16,255,146,0,20,255,166,0,21,255,216,0,22,255,156,0,24,0,50,0,
+25,0,10,0,26,255,166,0,27,0,20,0,29,0,50,0,31,255,136,0,33,255,166,0,35,255,
+116,0,36,255,216,0,37,255,166,0,38,255,216,0,39,254,192,0,40,0,20,0,43,255,
+166,0,44,255,166,0,45,255,166,0,46,255,126,0,47,255,166,0,48,255,166,0,50,
+255,16,0,51,254,242,0,52,255,246,0,53,0,10,0,54,255,166,0,55,255,156,0,56,
+255,86,0,57,0,30,0,59,255,86,0,60,255,146,0,61,255,186,0,62,255,166,0,64,
+255,166,0,65,255,206,0,66,254,192,0,67,254,222,0,68,254,122,0,69,255,86,0,
+70,255,26,0,71,255,66,0,72,255,66,0,73,0,30,0,74,0,30,0,75,255,136,0,76,255,
+86,0,77,255,236,0,78,255,146,0,79,255,226,0,80,255,36,0,81,255,166,0,82,255,
+166,0,83,255,66,0,84,255,46,0,85,255,66,0,86,255,56,0,87,255,56,0,88,254,
+242,0,76,0,4,255,246,0,5,255,246,0,6,255,166,0,7,255,206,0,8,255,246,0,9,
+255,136,0,10,255,246,0,11,255,246,0,12,255,226,0,13,255,246,0,14,255,216,
+0,15,255,246,0,16,255,236,0,17,255,246,0,18,255,246,0,19,255,246,0,20,255,
+216,0,22,255,226,0,23,255,246,0,24,255,206,0,25,0,20,0,26,255,226,0,27,255,
+226,0,28,255,246,0,29,255,216,0,30,255,246,0,32,255,246,0,34,255,246,0,35,
+255,226,0,36,255,236,0,37,255,236,0,38,255,236,0,39,255,206,0,40,255,226,
+0,41,255,246,0,42,255,246,0,43,255,226,0,44,255,226,0,45,255,226,0,46,255,
+226,0,47,255,226,0,49,255,246,0,50,0,20,0,51,0,20,0,52,255,216,0,53,255,236,
+0,54,255,226,0,56,0,10,0,57,255,126,0,58,255,246,0,59,0,30,0,61,0,50,0,64,
+255,226,0,65,255,236,0,66,255,226,0,67,255,186,0,68,255,226,0,69,255,226,
+0,70,0,20,0,71,0,10,0,72,255,246,0,73,255,206,0,74,255,156,0,75,0,60,0,76,
+0,60,0,78,255,226,0,79,255,226,0,80,0,20,0,81,255,226,0,82,255,226,0,83,0,
+20,0,84,0,20,0,85,0,20,0,86,0,20,0,87,0,20,0,88,255,231,0,43,0,7,255,146,
+0,12,255,246,0,16,255,246,0,20,255,236,0,22,255,246,0,25,0,40,0,26,255,246,
+0,29,0,30,0,31,255,206,0,33,255,246,0,35,255,216,0,37,255,246,0,38,0,20,0,
+39,255,146,0,43,255,246,0,44,255,246,0,45,255,246,0,46,255,246,0,47,255,246,
+0,48,255,236,0,50,0,10,0,51,255,236,0,52,0,20,0,53,0,20,0,54,255,246,0,57,
+0,20,0,61,0,50,0,63,0,30,0,64,255,246,0,66,255,156,0,67,255,146,0,68,255,
+146,0,69,255,146,0,70,255,236,0,72,255,236,0,73,0,10,0,77,0,30,0,81,255,246,
+0,82,255,246,0,84,255,236,0,86,255,236,0,87,255,236,0,88,255,236,0,77,0,4,
+255,236,0,5,255,236,0,6,255,226,0,7,255,136,0,8,255,236,0,9,255,166,0,10,
+255,236,0,11,255,236,0,12,0,50,0,14,255,186,0,15,255,236,0,16,0,40,0,17,255,
+236,0,18,255,236,0,19,255,236,0,20,0,40,0,22,0,50,0,23,255,226,0,24,255,226,
+0,25,0,50,0,26,0,50,0,28,255,236,0,29,255,206,0,30,255,236,0,32,255,236,0,
+33,0,50,0,34,255,236,0,37,0,40,0,38,0,20,0,39,255,156,0,41,255,236,0,42,255,
+236,0,43,0,50,0,44,0,50,0,45,0,50,0,46,0,50,0,47,0,40,0,48,0,20,0,49,255,
+236,0,50,255,136,0,51,255,246,0,52,0,140,0,53,0,90,0,54,0,40,0,56,0,60,0,
+57,255,226,0,58,255,236,0,59,0,60,0,60,0,80,0,61,0,80,0,62,0,20,0,63,0,90,
+0,64,0,60,0,65,0,45,0,66,255,136,0,67,255,146,0,68,255,106,0,69,255,136,0,
+70,0,40,0,71,0,70,0,72,0,60,0,73,0,10,0,74,255,216,0,75,0,120,0,76,0,100,
+0,77,0,90,0,78,0,80,0,79,0,40,0,80,0,80,0,81,0,40,0,82,0,50,0,83,0,40,0,84,
+0,30,0,85,0,60,0,86,0,60,0,87,0,60,0,88,255,216,0,66,0,6,0,20,0,7,255,6,0,
+9,0,50,0,12,255,176,0,14,0,50,0,16,255,186,0,20,255,176,0,21,255,216,0,22,
+255,176,0,24,0,40,0,25,0,10,0,26,255,176,0,27,0,20,0,29,0,50,0,31,255,156,
+0,33,255,196,0,35,255,146,0,36,255,206,0,37,255,186,0,38,255,226,0,39,255,
+6,0,40,0,20,0,43,255,176,0,44,255,176,0,45,255,176,0,46,255,176,0,47,255,
+186,0,48,255,176,0,50,255,86,0,51,255,96,0,52,0,20,0,53,0,30,0,54,255,176,
+0,55,255,156,0,56,255,136,0,57,0,20,0,59,255,116,0,60,255,176,0,61,255,207,
+0,62,255,196,0,63,0,20,0,64,255,166,0,65,255,226,0,66,255,16,0,67,255,6,0,
+68,255,6,0,69,255,116,0,70,255,86,0,71,255,116,0,72,255,116,0,73,0,20,0,74,
+0,20,0,75,255,186,0,76,255,156,0,77,0,10,0,78,255,206,0,79,0,20,0,80,255,
+116,0,81,255,176,0,82,255,176,0,83,255,116,0,84,255,126,0,85,255,136,0,86,
+255,136,0,87,255,136,0,88,255,76,0,59,0,6,255,126,0,7,0,20,0,9,255,106,0,
+12,255,236,0,14,255,106,0,16,255,236,0,20,255,236,0,22,255,236,0,24,255,216,
+0,25,0,50,0,26,255,236,0,27,255,176,0,29,255,106,0,31,0,20,0,33,255,236,0,
+35,0,20,0,39,0,20,0,40,255,176,0,43,255,236,0,44,255,236,0,45,255,236,0,46,
+255,236,0,47,255,236,0,50,0,40,0,51,0,20,0,52,255,176,0,53,255,146,0,54,255,
+236,0,55,0,20,0,56,0,30,0,57,255,46,0,59,0,20,0,61,0,10,0,63,255,186,0,64,
+255,236,0,65,255,226,0,66,0,40,0,67,0,20,0,68,0,40,0,69,0,40,0,70,0,30,0,
+71,0,40,0,72,255,226,0,73,255,126,0,74,255,106,0,75,0,30,0,76,0,20,0,77,255,
+196,0,78,255,206,0,79,255,126,0,80,0,30,0,81,255,236,0,82,255,236,0,83,0,
+30,0,84,0,30,0,85,0,30,0,86,0,30,0,87,0,30,0,88,0,30,0,61,0,6,255,216,0,7,
+0,30,0,9,255,186,0,12,255,226,0,13,0,20,0,14,255,216,0,16,255,226,0,20,255,
+226,0,22,255,226,0,24,255,216,0,25,0,60,0,26,255,226,0,27,255,236,0,29,255,
+186,0,33,255,236,0,36,0,30,0,37,0,30,0,38,0,80,0,39,0,30,0,40,255,236,0,43,
+255,226,0,44,255,226,0,45,255,226,0,46,255,226,0,47,255,226,0,50,0,30,0,51,
+0,40,0,52,255,226,0,53,255,216,0,54,255,226,0,56,0,20,0,57,255,216,0,59,0,
+20,0,60,255,236,0,61,255,236,0,63,255,246,0,64,255,226,0,65,255,196,0,66,
+0,40,0,67,0,30,0,68,0,40,0,69,0,30,0,70,0,20,0,71,0,45,0,72,0,20,0,73,255,
+206,0,74,255,216,0,75,0,10,0,76,0,10,0,77,255,246,0,78,255,236,0,79,255,216,
+0,80,0,20,0,81,255,246,0,82,255,236,0,83,0,20,0,84,0,20,0,85,0,20,0,86,0,
+20,0,87,0,20,0,88,0,20,0,82,0,4,255,226,0,5,255,226,0,6,255,186,0,7,255,176,
+0,8,255,216,0,9,255,166,0,10,255,226,0,11,255,226,0,12,0,50,0,13,255,236,
+0,14,255,156,0,15,255,226,0,16,0,50,0,17,255,226,0,18,255,226,0,19,255,226,
+0,20,0,50,0,22,0,50,0,23,255,226,0,24,255,186,0,25,0,50,0,26,0,50,0,28,255,
+226,0,29,255,206,0,30,255,226,0,31,0,20,0,32,255,226,0,33,0,70,0,34,255,226,
+0,35,0,20,0,36,0,20,0,37,0,30,0,38,0,30,0,39,255,216,0,41,255,226,0,42,255,
+226,0,43,0,60,0,44,0,50,0,45,0,50,0,46,0,50,0,47,0,50,0,48,0,30,0,49,255,
+226,0,50,0,80,0,51,0,70,0,52,0,30,0,53,0,30,0,54,0,50,0,55,0,20,0,56,0,100,
+0,57,255,186,0,58,255,226,0,59,0,110,0,60,0,120,0,61,0,110,0,62,0,30,0,63,
+0,50,0,64,0,70,0,65,0,40,0,66,255,176,0,67,255,146,0,68,255,146,0,69,255,
+186,0,70,0,50,0,71,0,100,0,72,0,90,0,73,255,246,0,74,255,156,0,75,0,140,0,
+76,0,150,0,77,0,100,0,78,0,80,0,79,0,20,0,80,0,110,0,81,0,80,0,82,0,50,0,
+83,0,100,0,84,0,30,0,85,0,100,0,86,0,100,0,87,0,100,0,88,0,50,0,79,0,4,255,
+226,0,5,255,226,0,6,255,226,0,7,255,66,0,8,255,226,0,9,255,156,0,10,255,226,
+0,11,255,226,0,12,0,35,0,14,255,166,0,15,255,226,0,16,0,35,0,17,255,226,0,
+18,255,226,0,19,255,226,0,20,0,35,0,22,0,35,0,23,255,226,0,24,255,116,0,26,
+0,45,0,27,255,216,0,28,255,226,0,29,255,206,0,30,255,206,0,31,255,226,0,32,
+255,226,0,33,0,35,0,34,255,226,0,37,0,40,0,38,0,10,0,39,255,176,0,40,255,
+216,0,41,255,226,0,42,255,216,0,43,0,35,0,44,0,35,0,45,0,35,0,46,0,35,0,47,
+0,35,0,48,0,20,0,49,255,226,0,50,0,20,0,51,255,66,0,52,0,120,0,53,0,90,0,
+54,0,35,0,56,0,60,0,57,255,206,0,58,255,226,0,59,0,60,0,60,0,100,0,61,0,120,
+0,62,0,20,0,63,0,110,0,64,0,30,0,65,0,20,0,66,255,66,0,67,255,96,0,68,255,
+146,0,69,255,66,0,70,0,30,0,71,0,60,0,72,0,60,0,73,255,246,0,74,255,236,0,
+75,0,110,0,76,0,130,0,77,0,120,0,78,0,110,0,79,0,20,0,80,0,80,0,81,0,65,0,
+82,0,35,0,83,0,40,0,84,0,30,0,85,0,60,0,86,0,60,0,87,0,60,0,88,255,206,0,
+56,0,6,255,196,0,9,255,206,0,12,255,106,0,14,255,206,0,16,255,106,0,20,255,
+116,0,22,255,106,0,24,255,206,0,25,255,226,0,26,255,126,0,27,255,186,0,29,
+255,206,0,33,255,106,0,36,255,216,0,37,255,176,0,39,255,206,0,40,255,186,
+0,42,255,226,0,43,255,126,0,44,255,106,0,45,255,106,0,46,255,106,0,47,255,
+106,0,48,255,176,0,50,255,226,0,52,255,136,0,53,255,156,0,54,255,106,0,56,
+255,196,0,57,255,196,0,59,255,166,0,60,255,86,0,61,255,106,0,62,255,176,0,
+63,255,116,0,64,255,106,0,65,255,96,0,70,255,196,0,71,255,196,0,72,255,136,
+0,73,255,196,0,74,255,196,0,75,255,126,0,76,255,126,0,77,255,116,0,78,255,
+86,0,79,255,126,0,80,255,196,0,81,255,166,0,82,255,126,0,83,255,206,0,84,
+255,196,0,85,255,196,0,86,255,216,0,87,255,196,0,88,255,196,0,60,0,6,255,
+216,0,7,255,236,0,9,255,226,0,12,255,226,0,13,0,20,0,14,255,246,0,16,255,
+226,0,20,255,226,0,21,0,20,0,22,255,226,0,24,255,216,0,25,0,50,0,26,255,226,
+0,27,255,236,0,29,255,236,0,33,0,10,0,36,0,30,0,37,0,30,0,38,0,80,0,39,255,
+236,0,43,255,226,0,44,255,226,0,45,255,226,0,46,255,226,0,47,255,226,0,50,
+0,20,0,51,0,40,0,53,0,30,0,54,255,226,0,56,0,20,0,57,255,216,0,59,0,40,0,
+60,255,236,0,61,0,20,0,63,0,10,0,64,255,226,0,65,255,226,0,66,0,40,0,67,255,
+236,0,68,0,40,0,69,0,20,0,70,0,20,0,71,0,45,0,72,0,20,0,73,255,216,0,74,255,
+216,0,75,0,10,0,76,0,10,0,77,0,10,0,78,255,236,0,79,255,246,0,80,0,20,0,81,
+255,246,0,82,255,236,0,83,0,20,0,84,0,40,0,85,0,20,0,86,0,30,0,87,0,20,0,
+88,0,20,0,52,0,6,255,216,0,7,255,216,0,9,255,236,0,12,255,236,0,13,255,246,
+0,16,255,236,0,20,255,226,0,22,255,236,0,25,0,50,0,26,255,236,0,33,255,236,
+0,37,255,226,0,38,0,20,0,39,255,216,0,43,255,246,0,44,255,236,0,45,255,236,
+0,46,255,236,0,47,255,246,0,50,0,40,0,51,0,20,0,54,255,236,0,56,0,30,0,57,
+255,216,0,59,0,50,0,61,0,50,0,63,0,10,0,64,255,236,0,65,255,236,0,66,255,
+216,0,67,255,216,0,68,255,216,0,69,255,236,0,70,0,20,0,71,0,40,0,72,0,20,
+0,73,255,226,0,74,255,216,0,75,0,40,0,76,0,40,0,77,0,10,0,78,255,236,0,79,
+255,236,0,80,0,60,0,81,255,246,0,82,255,236,0,83,0,20,0,84,0,20,0,85,0,20,
+0,86,0,40,0,87,0,20,0,88,0,20,0,82,0,4,255,226,0,5,255,226,0,6,255,166,0,
+7,255,166,0,8,255,226,0,9,255,136,0,10,255,226,0,11,255,226,0,12,255,226,
+0,13,255,216,0,14,255,156,0,15,255,226,0,16,255,236,0,17,255,226,0,18,255,
+226,0,19,255,226,0,20,255,236,0,21,255,236,0,22,255,236,0,23,255,226,0,24,
+255,186,0,25,0,10,0,26,255,236,0,27,255,226,0,28,255,226,0,29,255,156,0,30,
+255,226,0,31,255,246,0,32,255,226,0,33,255,226,0,34,255,226,0,35,255,226,
+0,36,255,236,0,37,255,236,0,39,255,166,0,40,255,226,0,41,255,226,0,42,255,
+226,0,43,255,236,0,44,255,226,0,45,255,226,0,46,255,226,0,47,255,226,0,48,
+255,236,0,49,255,226,0,50,255,226,0,51,255,206,0,53,255,226,0,54,255,236,
+0,55,255,246,0,56,0,20,0,57,255,166,0,58,255,226,0,59,0,30,0,61,0,40,0,62,
+255,236,0,63,0,30,0,64,255,226,0,65,255,226,0,66,255,166,0,67,255,186,0,68,
+255,156,0,69,255,186,0,70,0,20,0,71,0,10,0,72,0,20,0,73,255,206,0,74,255,
+176,0,75,0,60,0,76,0,60,0,77,0,30,0,78,255,226,0,79,255,166,0,80,0,20,0,81,
+255,226,0,82,255,226,0,83,0,20,0,84,0,20,0,85,0,20,0,86,0,20,0,87,0,20,0,
+88,255,236,0,72,0,4,255,226,0,5,255,226,0,7,255,156,0,8,255,226,0,9,255,176,
+0,10,255,226,0,11,255,226,0,12,0,10,0,15,255,226,0,16,0,10,0,17,255,226,0,
+18,255,226,0,19,255,226,0,20,0,10,0,22,0,10,0,23,255,226,0,24,255,176,0,25,
+0,60,0,26,0,10,0,27,0,10,0,28,255,226,0,29,255,226,0,30,255,226,0,32,255,
+226,0,33,0,10,0,34,255,226,0,38,0,30,0,39,255,206,0,40,0,10,0,41,255,226,
+0,42,255,226,0,43,0,10,0,44,0,10,0,45,0,10,0,46,255,246,0,47,0,10,0,48,0,
+10,0,49,255,226,0,50,0,40,0,51,0,60,0,52,0,60,0,53,0,40,0,54,0,10,0,56,0,
+40,0,58,255,226,0,59,0,70,0,61,0,60,0,62,0,10,0,63,0,30,0,64,0,10,0,66,255,
+196,0,67,255,156,0,68,255,206,0,69,255,236,0,70,0,40,0,71,0,40,0,72,0,40,
+0,73,0,50,0,75,0,30,0,76,0,30,0,77,0,30,0,78,255,236,0,79,0,10,0,80,0,41,
+0,81,0,10,0,82,0,10,0,83,0,40,0,84,0,10,0,85,0,40,0,86,0,40,0,87,0,40,0,88,
+0,40,0,21,0,7,255,156,0,25,0,40,0,31,255,206,0,37,255,246,0,38,0,20,0,39,
+255,156,0,50,0,10,0,51,255,236,0,52,0,20,0,53,0,20,0,57,0,20,0,61,0,20,0,
+63,0,30,0,66,255,156,0,67,255,156,0,68,255,156,0,69,255,156,0,70,255,226,
+0,77,0,30,0,84,255,236,0,88,255,236,0,61,0,6,255,146,0,9,255,116,0,12,0,35,
+0,13,0,20,0,14,255,116,0,16,0,35,0,20,0,35,0,22,0,35,0,24,255,216,0,25,0,
+110,0,26,0,35,0,27,255,236,0,29,255,136,0,31,0,30,0,33,0,35,0,35,0,30,0,36,
+0,40,0,37,0,40,0,38,0,70,0,39,0,30,0,43,0,35,0,44,0,35,0,45,0,35,0,46,0,35,
+0,47,0,35,0,48,0,70,0,50,0,90,0,51,0,70,0,52,255,216,0,53,255,206,0,54,0,
+35,0,55,0,30,0,56,0,100,0,57,255,126,0,59,0,110,0,60,0,80,0,61,0,110,0,62,
+0,40,0,64,0,35,0,65,0,30,0,68,0,20,0,69,0,20,0,70,0,90,0,71,0,90,0,72,0,90,
+0,73,255,156,0,74,255,96,0,75,0,90,0,76,0,130,0,77,0,50,0,78,0,10,0,79,255,
+196,0,80,0,100,0,81,0,55,0,82,0,35,0,83,0,101,0,84,0,90,0,85,0,90,0,86,0,
+90,0,87,0,80,0,88,0,85,0,58,0,7,255,56,0,9,0,20,0,12,255,226,0,14,0,20,0,
+16,255,226,0,20,255,226,0,21,255,196,0,22,255,226,0,24,0,30,0,26,255,226,
+0,29,0,20,0,31,255,156,0,33,255,226,0,35,255,166,0,36,255,216,0,37,255,216,
+0,38,255,216,0,39,255,6,0,43,255,216,0,44,255,226,0,45,255,226,0,46,255,226,
+0,47,255,206,0,48,255,196,0,50,255,106,0,51,255,96,0,52,0,40,0,53,0,40,0,
+54,255,226,0,55,255,186,0,56,255,126,0,59,255,156,0,60,255,216,0,62,255,216,
+0,63,0,40,0,64,255,226,0,66,255,46,0,67,255,56,0,68,255,56,0,69,255,96,0,
+70,255,96,0,71,255,126,0,72,255,126,0,73,0,30,0,75,255,206,0,76,255,166,0,
+77,0,40,0,78,255,216,0,79,0,60,0,80,255,126,0,81,255,226,0,82,255,226,0,83,
+255,116,0,84,255,126,0,85,255,126,0,86,255,116,0,87,255,126,0,88,255,126,
+0,54,0,6,255,216,0,9,255,206,0,12,255,206,0,14,255,206,0,16,255,206,0,20,
+255,206,0,22,255,206,0,24,255,216,0,25,0,30,0,26,255,206,0,27,255,236,0,29,
+255,206,0,31,0,10,0,33,255,206,0,35,0,20,0,38,0,30,0,39,255,236,0,40,255,
+236,0,43,255,206,0,44,255,206,0,45,255,196,0,46,255,196,0,47,255,206,0,48,
+255,226,0,52,0,10,0,53,255,236,0,54,255,206,0,55,0,20,0,56,255,246,0,57,255,
+186,0,59,255,226,0,60,255,216,0,61,255,216,0,62,255,246,0,63,255,246,0,64,
+255,206,0,65,255,196,0,66,0,20,0,69,0,40,0,70,255,226,0,71,0,20,0,72,255,
+196,0,73,255,226,0,74,255,196,0,76,255,206,0,78,255,236,0,79,255,236,0,80,
+255,216,0,81,255,226,0,82,255,196,0,83,255,246,0,84,255,246,0,86,255,236,
+0,87,255,236,0,76,0,4,255,226,0,5,255,226,0,6,255,166,0,7,255,206,0,8,255,
+226,0,9,255,136,0,10,255,226,0,11,255,226,0,12,255,226,0,13,255,216,0,14,
+255,156,0,15,255,226,0,16,255,236,0,17,255,226,0,18,255,226,0,19,255,226,
+0,20,255,216,0,22,255,226,0,23,255,226,0,24,255,206,0,25,0,25,0,26,255,226,
+0,27,255,226,0,28,255,226,0,29,255,156,0,30,255,226,0,32,255,226,0,33,255,
+226,0,34,255,226,0,35,255,226,0,36,255,236,0,37,255,236,0,38,255,236,0,39,
+255,206,0,40,255,226,0,41,255,226,0,42,255,226,0,43,255,226,0,44,255,226,
+0,45,255,226,0,46,255,226,0,47,255,226,0,49,255,226,0,50,0,20,0,51,0,20,0,
+52,255,216,0,53,255,196,0,54,255,226,0,56,0,20,0,57,255,126,0,58,255,226,
+0,59,0,30,0,61,0,50,0,64,255,226,0,65,255,236,0,66,255,206,0,67,255,186,0,
+68,255,186,0,69,255,206,0,70,0,20,0,71,0,10,0,72,0,20,0,73,255,166,0,74,255,
+156,0,75,0,60,0,76,0,60,0,78,255,226,0,79,255,166,0,80,0,20,0,82,255,226,
+0,83,0,20,0,84,0,20,0,85,0,20,0,86,0,20,0,87,0,20,0,88,255,231,0,74,0,4,255,
+236,0,5,255,236,0,7,255,116,0,8,255,236,0,10,255,236,0,11,255,236,0,12,255,
+206,0,15,255,236,0,16,255,206,0,17,255,236,0,18,255,236,0,19,255,236,0,20,
+255,206,0,22,255,206,0,23,255,236,0,25,0,60,0,26,255,206,0,27,0,10,0,28,255,
+236,0,30,255,236,0,31,255,186,0,32,255,236,0,33,255,206,0,34,255,236,0,35,
+255,166,0,36,255,226,0,37,255,226,0,38,0,10,0,39,255,246,0,40,0,20,0,41,255,
+236,0,42,255,236,0,43,255,206,0,44,255,196,0,45,255,206,0,46,255,246,0,47,
+255,206,0,48,255,206,0,49,255,236,0,50,255,186,0,51,255,176,0,52,0,20,0,53,
+0,20,0,54,255,196,0,55,255,186,0,56,255,201,0,58,255,236,0,59,255,236,0,60,
+255,226,0,61,255,246,0,62,255,216,0,64,255,196,0,65,255,216,0,66,255,116,
+0,67,255,116,0,68,255,96,0,69,255,206,0,70,255,221,0,71,255,216,0,72,255,
+236,0,73,0,20,0,75,0,10,0,76,255,236,0,77,0,30,0,78,255,236,0,80,255,241,
+0,81,255,206,0,82,255,206,0,83,255,206,0,84,255,211,0,85,255,221,0,86,0,40,
+0,87,255,221,0,88,255,191,0,79,0,4,255,216,0,5,255,216,0,6,255,226,0,7,255,
+206,0,8,255,216,0,9,255,216,0,10,255,216,0,11,255,216,0,12,255,176,0,14,255,
+236,0,15,255,216,0,16,255,156,0,17,255,216,0,18,255,216,0,19,255,216,0,20,
+255,176,0,22,255,176,0,23,255,216,0,24,255,236,0,25,0,60,0,26,255,176,0,27,
+0,10,0,28,255,216,0,29,255,236,0,30,255,216,0,32,255,216,0,33,255,176,0,34,
+255,216,0,36,255,226,0,37,255,186,0,38,0,30,0,39,255,246,0,40,255,246,0,41,
+255,216,0,42,255,216,0,43,255,176,0,44,255,176,0,45,255,176,0,46,255,246,
+0,47,255,176,0,48,0,10,0,49,255,216,0,50,255,246,0,51,255,246,0,52,255,196,
+0,53,255,196,0,54,255,176,0,56,0,10,0,57,255,226,0,58,255,216,0,59,255,206,
+0,60,255,116,0,61,255,196,0,63,255,206,0,64,255,176,0,65,255,206,0,66,255,
+236,0,67,255,206,0,68,255,236,0,69,255,236,0,70,0,20,0,71,0,20,0,72,255,186,
+0,73,255,236,0,74,255,226,0,75,255,236,0,76,255,216,0,77,255,226,0,78,255,
+186,0,79,255,226,0,80,0,41,0,81,255,196,0,82,255,176,0,83,0,20,0,84,255,246,
+0,85,0,20,0,86,0,40,0,87,0,20,0,88,255,246,0,83,0,4,255,246,0,5,255,246,0,
+6,255,146,0,7,0,20,0,8,255,246,0,9,255,76,0,10,255,246,0,11,255,246,0,13,
+0,20,0,14,255,86,0,15,255,246,0,16,0,35,0,17,255,246,0,18,255,246,0,19,255,
+246,0,20,0,35,0,22,0,35,0,23,255,246,0,24,255,216,0,25,0,110,0,26,0,35,0,
+27,255,236,0,28,255,246,0,29,255,116,0,30,255,246,0,31,0,70,0,32,255,246,
+0,33,0,35,0,34,255,246,0,35,0,70,0,36,0,40,0,37,0,40,0,38,0,60,0,39,0,50,
+0,40,255,236,0,41,255,246,0,42,255,246,0,43,0,35,0,44,0,35,0,45,0,35,0,46,
+0,35,0,47,0,35,0,48,0,70,0,49,255,246,0,50,0,100,0,51,0,101,0,52,255,136,
+0,53,255,156,0,54,0,35,0,55,0,70,0,56,0,100,0,57,255,126,0,58,255,246,0,59,
+0,110,0,60,255,236,0,61,0,60,0,62,0,40,0,63,255,136,0,64,0,35,0,65,255,226,
+0,66,0,50,0,67,0,40,0,68,0,50,0,69,0,40,0,70,0,90,0,71,0,90,0,72,0,90,0,73,
+255,136,0,74,255,96,0,75,0,90,0,76,0,80,0,77,255,216,0,78,255,186,0,79,255,
+156,0,80,0,100,0,81,0,55,0,82,0,35,0,83,0,101,0,84,0,90,0,85,0,90,0,86,0,
+90,0,87,0,80,0,88,0,85,0,54,0,7,255,186,0,12,0,20,0,16,0,20,0,20,0,20,0,22,
+0,20,0,25,0,70,0,26,0,20,0,29,255,246,0,31,255,236,0,33,0,20,0,36,0,10,0,
+37,255,246,0,38,0,20,0,39,255,226,0,43,0,20,0,44,0,20,0,45,0,20,0,46,0,10,
+0,47,0,20,0,48,0,20,0,50,0,60,0,51,0,60,0,52,0,20,0,53,0,20,0,54,0,20,0,56,
+0,80,0,57,0,20,0,59,0,50,0,60,0,10,0,61,0,40,0,62,0,20,0,63,0,30,0,64,0,20,
+0,66,255,186,0,67,255,246,0,68,255,246,0,69,0,11,0,70,0,40,0,71,0,30,0,72,
+0,30,0,75,0,60,0,76,0,60,0,77,0,30,0,78,0,10,0,79,0,20,0,80,0,50,0,81,0,40,
+0,82,0,20,0,83,0,20,0,84,0,30,0,85,0,30,0,86,0,30,0,87,0,30,0,88,0,10,0,44,
+0,6,255,236,0,7,255,166,0,9,255,226,0,14,255,226,0,25,0,40,0,27,0,5,0,29,
+255,226,0,38,0,10,0,39,255,186,0,40,0,5,0,48,0,20,0,50,0,40,0,51,255,226,
+0,52,0,40,0,53,0,40,0,56,0,30,0,57,255,236,0,59,0,60,0,60,0,30,0,61,0,50,
+0,62,0,20,0,63,0,80,0,66,255,166,0,67,255,166,0,68,255,166,0,69,255,186,0,
+70,0,30,0,71,0,30,0,72,0,10,0,73,0,10,0,74,255,236,0,75,0,70,0,76,0,70,0,
+77,0,80,0,78,0,50,0,79,0,10,0,80,0,50,0,81,0,10,0,83,0,30,0,84,0,30,0,85,
+0,30,0,86,0,30,0,87,0,40,0,88,0,10,0,46,0,6,255,186,0,12,255,206,0,16,255,
+206,0,20,255,206,0,22,255,206,0,25,0,40,0,26,255,206,0,33,255,206,0,39,255,
+226,0,43,255,206,0,44,255,206,0,45,255,206,0,46,255,206,0,47,255,206,0,48,
+255,236,0,50,0,20,0,52,255,226,0,53,255,231,0,54,255,206,0,56,0,10,0,57,255,
+246,0,59,255,236,0,60,255,206,0,61,255,246,0,62,255,236,0,63,255,226,0,64,
+255,206,0,65,255,231,0,70,255,226,0,71,0,10,0,72,255,186,0,73,255,186,0,74,
+255,186,0,75,255,226,0,76,255,216,0,78,255,196,0,79,255,216,0,80,0,10,0,81,
+255,206,0,82,255,206,0,83,255,246,0,84,0,10,0,85,0,10,0,86,0,10,0,87,0,10,
+0,88,255,236,0,60,0,6,255,246,0,7,255,106,0,9,255,236,0,12,0,10,0,14,255,
+236,0,16,0,10,0,20,0,10,0,22,0,10,0,25,0,50,0,26,0,10,0,27,0,5,0,29,255,246,
+0,33,0,10,0,35,255,206,0,38,0,20,0,39,255,156,0,40,0,5,0,43,0,10,0,44,0,10,
+0,45,0,10,0,46,0,10,0,47,0,10,0,48,0,20,0,50,255,236,0,51,255,236,0,52,0,
+90,0,53,0,50,0,54,0,10,0,56,0,10,0,57,255,246,0,59,0,30,0,60,0,40,0,61,0,
+90,0,62,0,20,0,63,0,70,0,64,0,10,0,65,0,10,0,66,255,106,0,67,255,106,0,68,
+255,106,0,69,255,186,0,70,0,10,0,71,0,20,0,72,0,10,0,73,0,30,0,74,255,246,
+0,75,0,80,0,76,0,80,0,77,0,80,0,78,0,60,0,79,0,40,0,80,0,30,0,81,0,10,0,82,
+0,10,0,83,0,10,0,84,0,30,0,85,0,10,0,86,0,10,0,87,0,40,0,88,255,226,0,82,
+0,4,255,231,0,5,255,231,0,6,255,136,0,7,255,236,0,8,255,231,0,9,255,96,0,
+10,255,231,0,11,255,231,0,12,0,50,0,13,255,226,0,14,255,76,0,15,255,231,0,
+16,0,60,0,17,255,231,0,18,255,231,0,19,255,231,0,20,0,50,0,22,0,50,0,23,255,
+231,0,24,255,156,0,25,0,121,0,26,0,50,0,28,255,231,0,29,255,126,0,30,255,
+231,0,32,255,231,0,33,0,40,0,34,255,231,0,35,0,30,0,36,0,20,0,37,0,20,0,38,
+0,60,0,39,0,10,0,40,255,236,0,41,255,231,0,42,255,231,0,43,0,50,0,44,0,60,
+0,45,0,40,0,46,0,40,0,47,0,60,0,48,0,100,0,49,255,231,0,50,0,125,0,51,0,90,
+0,52,255,156,0,53,255,186,0,54,0,50,0,55,0,30,0,56,0,120,0,57,255,86,0,58,
+255,231,0,59,0,130,0,60,0,60,0,61,0,130,0,62,0,60,0,63,255,216,0,64,0,50,
+0,65,0,20,0,66,255,226,0,67,255,236,0,68,255,236,0,69,0,20,0,70,0,100,0,71,
+0,100,0,72,0,110,0,73,255,146,0,74,255,76,0,75,0,140,0,76,0,150,0,77,0,40,
+0,78,255,226,0,79,255,196,0,80,0,160,0,81,0,110,0,82,0,50,0,83,0,101,0,84,
+0,110,0,85,0,110,0,86,0,110,0,87,0,110,0,88,0,70,0,50,0,6,0,60,0,7,255,46,
+0,9,0,20,0,13,0,50,0,14,0,50,0,24,0,30,0,25,0,20,0,27,0,30,0,29,0,50,0,31,
+255,216,0,35,255,216,0,36,0,20,0,37,0,20,0,38,0,40,0,39,255,66,0,40,0,30,
+0,50,255,166,0,51,255,166,0,52,0,150,0,53,0,150,0,55,255,216,0,56,255,226,
+0,57,0,60,0,59,255,236,0,60,0,40,0,61,0,80,0,63,0,100,0,65,0,40,0,66,255,
+46,0,67,255,66,0,68,255,46,0,69,255,106,0,70,255,206,0,71,255,226,0,72,255,
+226,0,73,0,60,0,74,0,60,0,75,0,20,0,76,0,10,0,77,0,120,0,78,0,100,0,79,0,
+70,0,80,255,226,0,81,0,10,0,83,255,246,0,84,255,226,0,85,255,226,0,86,255,
+226,0,87,255,226,0,88,255,136,0,53,0,6,0,60,0,7,255,46,0,9,0,20,0,13,0,50,
+0,14,0,50,0,21,255,216,0,23,0,30,0,24,0,30,0,25,0,20,0,27,0,30,0,29,0,60,
+0,31,255,216,0,35,255,206,0,36,0,20,0,37,255,236,0,38,0,40,0,39,255,66,0,
+40,0,40,0,49,0,10,0,50,255,176,0,51,255,166,0,52,0,150,0,53,0,123,0,55,255,
+216,0,56,255,206,0,57,0,60,0,59,255,206,0,60,0,60,0,61,0,80,0,63,0,100,0,
+65,0,40,0,66,255,46,0,67,255,66,0,68,255,36,0,69,255,126,0,70,255,206,0,71,
+255,216,0,72,255,206,0,73,0,81,0,74,0,60,0,75,0,20,0,76,0,10,0,77,0,120,0,
+78,0,70,0,79,0,70,0,80,255,196,0,81,0,10,0,83,255,216,0,84,255,206,0,85,255,
+216,0,86,255,216,0,87,255,216,0,88,255,136,0,65,0,4,255,226,0,5,255,226,0,
+6,255,216,0,7,255,186,0,8,255,226,0,9,255,176,0,10,255,226,0,11,255,226,0,
+13,255,236,0,14,255,176,0,15,255,226,0,17,255,226,0,18,255,226,0,19,255,226,
+0,23,255,226,0,24,255,196,0,25,0,60,0,27,255,246,0,28,255,226,0,29,255,196,
+0,30,255,226,0,32,255,226,0,33,0,10,0,34,255,226,0,37,0,10,0,38,0,15,0,39,
+255,216,0,40,255,246,0,41,255,226,0,42,255,226,0,48,0,10,0,49,255,216,0,50,
+0,30,0,51,0,30,0,52,0,50,0,53,0,40,0,56,0,50,0,57,255,216,0,58,255,226,0,
+59,0,50,0,60,0,60,0,61,0,80,0,63,0,60,0,64,0,10,0,66,255,156,0,67,255,186,
+0,68,255,176,0,69,255,186,0,70,0,30,0,71,0,50,0,72,0,50,0,73,255,226,0,74,
+255,216,0,75,0,70,0,76,0,80,0,77,0,60,0,78,0,70,0,80,0,50,0,81,0,30,0,83,
+0,50,0,84,0,50,0,85,0,50,0,86,0,50,0,87,0,50,0,88,0,50,0,60,0,6,0,40,0,7,
+255,46,0,12,0,20,0,13,0,30,0,14,0,10,0,16,0,20,0,20,0,20,0,21,255,236,0,22,
+0,20,0,24,255,246,0,25,255,237,0,26,0,20,0,29,0,10,0,31,255,226,0,33,0,20,
+0,35,255,226,0,38,0,40,0,39,255,46,0,40,0,20,0,43,0,20,0,44,0,20,0,45,0,20,
+0,46,0,20,0,47,0,20,0,49,0,20,0,50,255,196,0,51,255,166,0,52,0,110,0,53,0,
+90,0,54,0,20,0,55,255,226,0,56,255,211,0,57,0,40,0,59,255,236,0,60,0,50,0,
+61,0,60,0,63,0,70,0,64,0,20,0,65,0,20,0,66,255,46,0,67,255,66,0,68,255,26,
+0,69,255,136,0,70,255,216,0,72,255,236,0,73,0,60,0,74,0,40,0,75,0,50,0,76,
+0,30,0,77,0,110,0,78,0,70,0,79,0,60,0,81,0,20,0,82,0,20,0,83,255,236,0,84,
+255,226,0,85,255,236,0,86,255,236,0,87,255,236,0,88,255,166,0,47,0,7,255,
+156,0,12,255,236,0,16,255,236,0,20,255,236,0,21,255,216,0,22,255,236,0,24,
+0,30,0,25,0,40,0,26,255,236,0,31,255,206,0,33,255,236,0,35,255,226,0,37,255,
+246,0,38,0,20,0,39,255,156,0,43,255,236,0,44,255,236,0,45,255,236,0,46,255,
+236,0,47,255,236,0,50,255,156,0,51,255,236,0,52,0,20,0,53,0,30,0,54,255,236,
+0,56,255,246,0,57,0,20,0,61,0,20,0,63,0,30,0,64,255,236,0,66,255,136,0,67,
+255,156,0,68,255,156,0,69,255,156,0,70,255,226,0,71,255,246,0,72,255,236,
+0,77,0,30,0,80,255,246,0,81,255,236,0,82,255,236,0,83,255,246,0,84,255,236,
+0,85,255,246,0,86,255,246,0,87,255,246,0,88,255,236,0,60,0,6,255,206,0,7,
+255,226,0,9,255,211,0,12,255,246,0,14,255,211,0,16,255,246,0,20,255,246,0,
+22,255,246,0,24,255,236,0,25,0,75,0,26,255,246,0,29,255,211,0,31,0,20,0,33,
+255,236,0,35,0,20,0,36,0,20,0,37,255,226,0,38,0,20,0,39,255,226,0,43,255,
+246,0,44,255,246,0,45,255,246,0,46,255,246,0,47,255,236,0,48,0,20,0,50,0,
+30,0,51,0,50,0,52,255,236,0,53,255,226,0,54,255,246,0,55,0,20,0,56,0,40,0,
+57,255,206,0,59,0,90,0,60,0,10,0,61,0,50,0,62,0,20,0,64,255,246,0,65,255,
+226,0,66,255,246,0,67,255,226,0,68,255,246,0,70,0,40,0,71,0,40,0,72,0,30,
+0,73,255,196,0,74,255,146,0,75,0,40,0,76,0,30,0,78,255,226,0,79,255,206,0,
+80,0,80,0,81,0,20,0,82,255,226,0,83,0,50,0,84,0,40,0,85,0,40,0,86,0,50,0,
+87,0,40,0,88,0,30,0,78,0,4,255,226,0,5,255,226,0,6,255,126,0,7,255,226,0,
+8,255,226,0,9,255,86,0,10,255,226,0,11,255,226,0,12,255,236,0,14,255,106,
+0,15,255,226,0,16,255,236,0,17,255,226,0,18,255,226,0,19,255,226,0,20,255,
+236,0,22,255,236,0,23,255,226,0,24,255,176,0,25,0,71,0,26,255,236,0,27,255,
+176,0,28,255,226,0,29,255,106,0,30,255,226,0,31,0,20,0,32,255,226,0,33,255,
+236,0,34,255,226,0,35,0,20,0,38,0,10,0,39,255,246,0,40,255,196,0,41,255,226,
+0,42,255,226,0,43,255,236,0,44,255,236,0,45,255,236,0,46,255,236,0,47,255,
+236,0,49,255,226,0,50,0,80,0,51,0,40,0,52,255,166,0,53,255,146,0,54,255,236,
+0,55,0,20,0,56,0,80,0,57,255,46,0,58,255,226,0,59,0,70,0,60,0,10,0,61,0,61,
+0,63,255,196,0,64,255,236,0,65,255,226,0,66,0,40,0,67,255,246,0,68,255,246,
+0,69,0,40,0,70,0,60,0,71,0,40,0,72,0,30,0,73,255,116,0,74,255,86,0,75,0,40,
+0,76,0,80,0,78,255,236,0,79,255,126,0,80,0,60,0,81,0,30,0,82,255,236,0,83,
+0,30,0,84,0,50,0,85,0,60,0,86,0,60,0,87,0,30,0,88,0,30,0,75,0,4,255,226,0,
+5,255,226,0,6,255,166,0,7,255,206,0,8,255,226,0,9,255,136,0,10,255,226,0,
+11,255,226,0,13,0,10,0,14,255,156,0,15,255,226,0,16,255,236,0,17,255,226,
+0,18,255,226,0,19,255,226,0,20,255,216,0,22,255,226,0,23,255,226,0,24,255,
+236,0,25,0,80,0,26,255,226,0,27,255,226,0,28,255,226,0,29,255,177,0,30,255,
+226,0,31,0,10,0,32,255,226,0,33,255,226,0,34,255,226,0,35,255,226,0,37,255,
+236,0,38,0,40,0,39,255,246,0,40,255,236,0,41,255,226,0,42,255,226,0,43,255,
+226,0,44,255,226,0,45,255,226,0,46,255,226,0,47,255,246,0,48,0,40,0,50,0,
+60,0,51,0,80,0,52,255,216,0,53,255,196,0,54,255,226,0,56,0,60,0,57,255,126,
+0,58,255,226,0,59,0,90,0,61,0,60,0,62,0,40,0,65,255,236,0,67,255,226,0,68,
+255,246,0,69,255,246,0,70,0,60,0,71,0,10,0,72,0,70,0,73,255,176,0,74,255,
+156,0,75,0,60,0,76,0,60,0,78,255,226,0,79,255,166,0,80,0,80,0,81,0,20,0,82,
+0,10,0,83,0,30,0,84,0,60,0,85,0,60,0,86,0,80,0,87,0,80,0,88,255,231,0,77,
+0,4,255,226,0,5,255,226,0,6,255,226,0,7,255,156,0,8,255,226,0,9,255,166,0,
+10,255,226,0,11,255,226,0,12,0,60,0,14,255,186,0,15,255,226,0,16,0,60,0,17,
+255,226,0,18,255,226,0,19,255,226,0,20,0,60,0,22,0,60,0,23,255,226,0,24,255,
+196,0,25,0,60,0,26,0,60,0,28,255,226,0,29,255,216,0,30,255,226,0,32,255,226,
+0,33,0,60,0,34,255,226,0,37,0,10,0,38,0,20,0,39,255,176,0,41,255,226,0,42,
+255,226,0,43,0,60,0,44,0,60,0,45,0,60,0,46,0,60,0,47,0,40,0,48,0,50,0,49,
+255,226,0,50,0,40,0,51,0,20,0,52,0,80,0,53,0,40,0,54,0,30,0,56,0,80,0,57,
+255,226,0,58,255,226,0,59,0,70,0,60,0,130,0,61,0,120,0,62,0,20,0,63,0,90,
+0,64,0,30,0,65,0,40,0,66,255,141,0,67,255,146,0,68,255,146,0,69,255,166,0,
+70,0,50,0,71,0,80,0,72,0,70,0,73,255,246,0,74,255,216,0,75,0,90,0,76,0,120,
+0,77,0,90,0,78,0,100,0,79,0,20,0,80,0,110,0,81,0,30,0,82,0,60,0,83,0,40,0,
+84,0,70,0,85,0,80,0,86,0,70,0,87,0,80,0,88,0,20,0,48,0,6,255,226,0,7,0,20,
+0,9,255,196,0,13,0,20,0,14,255,196,0,20,255,246,0,21,0,20,0,22,255,236,0,
+25,0,60,0,29,255,206,0,38,0,30,0,39,0,20,0,43,255,236,0,46,255,246,0,47,255,
+236,0,50,0,80,0,51,0,30,0,53,0,10,0,56,0,40,0,57,255,196,0,59,0,20,0,60,0,
+10,0,61,0,50,0,63,0,30,0,64,255,236,0,66,0,20,0,67,0,70,0,68,0,50,0,69,0,
+40,0,70,0,40,0,71,0,60,0,72,0,40,0,73,255,226,0,74,255,226,0,75,0,40,0,76,
+0,40,0,77,0,30,0,78,0,20,0,79,255,226,0,80,0,40,0,81,0,10,0,82,255,236,0,
+83,0,40,0,84,0,40,0,85,0,40,0,86,0,40,0,87,0,40,0,88,0,40,0,56,0,6,255,206,
+0,9,255,211,0,12,255,216,0,14,255,211,0,16,255,216,0,20,255,216,0,22,255,
+216,0,24,255,236,0,25,0,50,0,26,255,216,0,29,255,211,0,31,0,20,0,33,255,236,
+0,35,0,20,0,36,0,20,0,37,255,216,0,38,0,20,0,43,255,216,0,44,255,216,0,45,
+255,216,0,46,255,216,0,47,255,236,0,48,0,20,0,50,0,60,0,51,0,60,0,52,255,
+236,0,53,255,236,0,54,255,216,0,55,0,20,0,56,0,40,0,57,255,206,0,59,0,54,
+0,60,255,236,0,61,0,40,0,62,0,20,0,64,255,226,0,65,255,226,0,66,255,246,0,
+70,0,40,0,71,0,40,0,72,0,30,0,73,255,216,0,74,255,206,0,75,0,40,0,76,0,30,
+0,78,255,216,0,79,255,206,0,80,0,40,0,81,255,236,0,82,255,226,0,83,0,40,0,
+84,0,40,0,85,0,40,0,86,0,40,0,87,0,40,0,88,0,40,0,33,0,6,0,30,0,7,255,156,
+0,9,0,50,0,13,0,30,0,14,0,50,0,24,0,40,0,25,0,40,0,29,0,60,0,31,255,206,0,
+37,255,246,0,38,0,40,0,39,255,186,0,50,0,10,0,51,255,246,0,52,0,20,0,53,0,
+40,0,57,0,20,0,60,0,20,0,61,0,40,0,63,0,40,0,66,255,156,0,67,255,156,0,68,
+255,156,0,69,255,206,0,70,255,226,0,73,0,30,0,74,0,30,0,77,0,40,0,78,0,20,
+0,79,0,30,0,84,255,236,0,87,0,10,0,88,255,236,0,64,0,4,255,226,0,5,255,226,
+0,6,255,216,0,7,255,186,0,8,255,226,0,9,255,176,0,10,255,226,0,11,255,226,
+0,13,255,236,0,14,255,176,0,15,255,226,0,17,255,226,0,18,255,226,0,19,255,
+226,0,23,255,226,0,24,255,196,0,25,0,40,0,27,255,246,0,28,255,226,0,29,255,
+186,0,30,255,226,0,32,255,226,0,33,0,10,0,34,255,226,0,39,255,206,0,40,255,
+246,0,41,255,226,0,42,255,226,0,48,0,10,0,49,255,216,0,50,0,30,0,51,0,10,
+0,52,0,60,0,53,0,40,0,56,0,50,0,57,255,206,0,58,255,226,0,59,0,50,0,60,0,
+60,0,61,0,70,0,63,0,50,0,64,0,10,0,66,255,176,0,67,255,166,0,68,255,156,0,
+69,255,186,0,70,0,30,0,71,0,50,0,72,0,50,0,73,255,226,0,74,255,196,0,75,0,
+70,0,76,0,80,0,77,0,50,0,78,0,70,0,79,255,216,0,80,0,50,0,81,0,20,0,82,0,
+10,0,83,0,30,0,84,0,50,0,85,0,50,0,86,0,50,0,87,0,40,0,66,0,4,255,211,0,5,
+255,211,0,6,255,236,0,7,255,106,0,8,255,211,0,9,255,226,0,10,255,211,0,11,
+255,211,0,14,255,226,0,15,255,211,0,17,255,211,0,18,255,211,0,19,255,211,
+0,23,255,231,0,24,255,216,0,25,0,40,0,27,0,5,0,28,255,211,0,29,255,216,0,
+30,255,211,0,31,255,216,0,32,255,211,0,34,255,211,0,36,255,226,0,37,255,226,
+0,38,0,10,0,39,255,156,0,40,0,5,0,41,255,211,0,42,255,211,0,48,255,236,0,
+49,255,211,0,50,255,236,0,51,0,30,0,52,0,40,0,53,0,40,0,56,0,30,0,57,255,
+236,0,58,255,211,0,59,0,50,0,60,0,50,0,61,0,60,0,62,0,20,0,63,0,80,0,66,255,
+106,0,67,255,106,0,68,255,106,0,69,255,116,0,70,0,30,0,71,0,30,0,72,0,20,
+0,73,0,10,0,74,255,236,0,75,0,70,0,76,0,70,0,77,0,80,0,78,0,50,0,79,0,10,
+0,80,0,10,0,81,0,10,0,83,0,30,0,84,0,30,0,85,0,30,0,86,0,20,0,87,0,40,0,88,
+255,216,0,59,0,6,255,246,0,7,255,186,0,9,255,196,0,12,0,20,0,13,0,20,0,14,
+255,196,0,16,0,20,0,20,255,246,0,21,0,20,0,22,0,20,0,25,0,60,0,26,0,20,0,
+29,255,221,0,33,0,20,0,38,0,50,0,39,255,186,0,40,0,20,0,43,0,20,0,44,0,20,
+0,45,0,20,0,46,255,246,0,47,0,20,0,48,0,20,0,50,0,20,0,51,0,20,0,52,0,40,
+0,53,0,10,0,54,0,20,0,56,0,40,0,57,255,216,0,59,0,60,0,60,0,40,0,61,0,110,
+0,62,0,20,0,63,0,60,0,64,0,20,0,66,255,186,0,67,255,196,0,68,255,196,0,69,
+0,50,0,70,0,30,0,71,0,60,0,72,0,30,0,73,255,251,0,74,255,196,0,75,0,80,0,
+76,0,80,0,77,0,60,0,78,0,40,0,79,0,40,0,80,0,50,0,81,0,10,0,82,0,20,0,83,
+0,40,0,84,0,50,0,85,0,30,0,86,0,30,0,87,0,40,0,88,255,246,0,54,0,6,255,226,
+0,7,0,20,0,9,255,196,0,12,255,236,0,13,0,20,0,14,255,196,0,16,255,236,0,20,
+255,246,0,21,0,20,0,22,255,236,0,25,0,60,0,26,255,236,0,29,255,206,0,33,255,
+236,0,39,0,20,0,43,255,236,0,44,255,236,0,45,255,236,0,46,255,246,0,47,255,
+236,0,50,0,20,0,51,0,40,0,53,0,10,0,54,255,236,0,56,0,30,0,57,255,196,0,59,
+0,10,0,60,0,10,0,61,0,20,0,63,0,30,0,64,255,236,0,66,0,20,0,67,0,70,0,68,
+0,50,0,69,0,50,0,70,0,30,0,71,0,60,0,72,0,30,0,73,255,226,0,74,255,226,0,
+75,0,40,0,76,0,40,0,77,0,30,0,78,0,10,0,79,255,226,0,80,0,30,0,81,0,10,0,
+82,255,236,0,83,0,40,0,84,0,30,0,85,0,30,0,86,0,30,0,87,0,30,0,88,0,30,0,
+36,0,12,255,226,0,16,255,226,0,20,255,226,0,22,255,226,0,25,0,30,0,26,255,
+226,0,33,255,226,0,39,255,226,0,43,255,226,0,44,255,226,0,45,255,226,0,46,
+255,226,0,47,255,226,0,48,255,236,0,51,0,20,0,52,255,246,0,53,255,231,0,54,
+255,226,0,57,255,246,0,59,255,236,0,60,255,216,0,61,255,246,0,62,255,236,
+0,63,255,246,0,64,255,226,0,65,255,231,0,66,255,246,0,70,255,226,0,72,255,
+186,0,75,255,226,0,76,255,216,0,78,255,196,0,79,255,216,0,82,255,226,0,83,
+255,246,0,88,255,236,0,44,0,7,255,216,0,12,255,211,0,16,255,211,0,20,255,
+211,0,22,255,211,0,24,0,10,0,26,255,211,0,33,255,211,0,35,255,216,0,39,255,
+196,0,43,255,211,0,44,255,211,0,45,255,211,0,46,255,211,0,47,255,211,0,48,
+255,236,0,50,255,216,0,51,255,216,0,52,255,246,0,53,255,241,0,54,255,211,
+0,57,0,20,0,59,255,236,0,60,255,226,0,61,255,246,0,62,255,236,0,63,0,10,0,
+64,255,211,0,65,255,231,0,66,255,186,0,67,255,216,0,68,255,216,0,69,255,216,
+0,70,255,226,0,72,255,186,0,73,0,20,0,75,255,246,0,76,255,216,0,78,255,236,
+0,79,255,236,0,81,255,211,0,82,255,211,0,83,255,226,0,88,255,216,0,58,0,6,
+255,176,0,7,255,226,0,9,255,156,0,12,0,50,0,14,255,156,0,16,0,50,0,20,0,50,
+0,22,0,50,0,24,255,216,0,25,0,120,0,26,0,50,0,29,255,156,0,31,0,20,0,33,0,
+50,0,35,0,20,0,37,0,40,0,43,0,50,0,44,0,50,0,45,0,50,0,46,0,50,0,47,0,50,
+0,48,0,50,0,50,0,110,0,51,0,80,0,52,0,30,0,53,0,30,0,54,0,50,0,55,0,20,0,
+56,0,110,0,57,255,176,0,59,0,110,0,60,0,70,0,61,0,100,0,62,0,20,0,63,0,20,
+0,64,0,50,0,66,255,226,0,67,255,246,0,68,255,226,0,70,0,110,0,71,0,110,0,
+72,0,110,0,73,255,176,0,74,255,146,0,75,0,120,0,76,0,120,0,77,0,60,0,78,0,
+70,0,79,255,176,0,80,0,110,0,81,0,50,0,82,0,50,0,83,0,110,0,84,0,110,0,85,
+0,110,0,86,0,110,0,87,0,110,0,88,0,110,0,61,0,6,255,176,0,7,255,226,0,9,255,
+156,0,12,0,50,0,14,255,156,0,16,0,50,0,20,0,50,0,22,0,50,0,24,255,216,0,25,
+0,120,0,26,0,50,0,29,255,176,0,31,0,20,0,33,0,50,0,35,0,20,0,37,0,40,0,38,
+0,30,0,39,0,30,0,43,0,50,0,44,0,50,0,45,0,50,0,46,0,50,0,47,0,50,0,48,0,70,
+0,50,0,110,0,51,0,80,0,52,0,30,0,53,0,30,0,54,0,50,0,55,0,20,0,56,0,110,0,
+57,255,176,0,59,0,110,0,60,0,90,0,61,0,120,0,62,0,40,0,63,0,40,0,64,0,50,
+0,65,0,40,0,66,255,236,0,67,255,226,0,69,0,10,0,70,0,110,0,71,0,110,0,72,
+0,110,0,73,255,176,0,74,255,146,0,75,0,120,0,76,0,120,0,77,0,70,0,78,0,90,
+0,79,255,206,0,80,0,130,0,81,0,80,0,82,0,50,0,83,0,110,0,84,0,110,0,85,0,
+110,0,86,0,110,0,87,0,110,0,88,0,80,0,72,0,4,255,246,0,5,255,246,0,6,0,40,
+0,7,254,252,0,8,255,246,0,9,0,20,0,10,255,246,0,11,255,246,0,13,0,50,0,14,
+0,40,0,15,255,246,0,17,255,246,0,18,255,246,0,19,255,246,0,21,255,226,0,23,
+255,246,0,24,0,10,0,25,0,20,0,27,0,30,0,28,255,246,0,29,0,40,0,30,255,246,
+0,31,255,216,0,32,255,246,0,34,255,246,0,35,255,216,0,36,0,20,0,37,255,226,
+0,38,0,40,0,39,254,232,0,40,0,30,0,41,255,246,0,42,255,246,0,48,255,236,0,
+49,0,10,0,50,255,126,0,51,255,116,0,52,0,130,0,53,0,120,0,55,255,216,0,56,
+255,186,0,57,0,40,0,58,255,246,0,59,255,186,0,60,0,40,0,61,0,80,0,62,255,
+246,0,63,0,110,0,65,0,40,0,66,254,252,0,67,255,16,0,68,254,252,0,69,255,96,
+0,70,255,136,0,71,255,236,0,72,255,226,0,73,0,80,0,74,0,40,0,75,0,20,0,76,
+255,236,0,77,0,120,0,78,0,70,0,79,0,100,0,80,255,196,0,81,0,10,0,82,255,246,
+0,83,255,196,0,84,255,206,0,85,255,206,0,86,255,190,0,87,255,216,0,88,255,
+156,0,51,0,6,0,50,0,7,255,6,0,9,0,10,0,13,0,20,0,14,0,30,0,21,255,236,0,23,
+0,20,0,25,255,246,0,27,0,30,0,29,0,30,0,31,255,186,0,35,255,206,0,36,0,20,
+0,38,0,20,0,39,255,66,0,40,0,30,0,50,255,136,0,51,255,116,0,52,0,110,0,53,
+0,90,0,54,0,10,0,55,255,216,0,56,255,176,0,57,0,20,0,59,255,176,0,60,0,30,
+0,61,0,60,0,63,0,80,0,65,0,30,0,66,255,6,0,67,255,66,0,68,254,222,0,69,255,
+126,0,70,255,186,0,71,255,216,0,72,255,216,0,73,0,80,0,74,0,40,0,75,0,20,
+0,76,255,236,0,77,0,120,0,78,0,70,0,79,0,70,0,80,255,186,0,82,255,236,0,83,
+255,246,0,84,255,186,0,85,255,206,0,86,255,206,0,87,255,226,0,88,255,126,
+0,66,0,6,0,30,0,7,254,212,0,9,0,50,0,12,255,156,0,14,0,50,0,16,255,136,0,
+20,255,136,0,21,255,176,0,22,255,136,0,24,0,50,0,25,0,10,0,26,255,156,0,27,
+0,20,0,29,0,20,0,31,255,136,0,33,255,156,0,35,255,116,0,36,255,196,0,37,255,
+136,0,38,255,196,0,39,254,212,0,40,0,20,0,43,255,156,0,44,255,156,0,45,255,
+156,0,46,255,146,0,47,255,156,0,48,255,166,0,50,255,56,0,51,255,56,0,52,255,
+246,0,53,0,10,0,54,255,156,0,55,255,156,0,56,255,86,0,57,0,30,0,59,255,86,
+0,60,255,146,0,61,255,186,0,62,255,166,0,63,255,236,0,64,255,166,0,65,255,
+206,0,66,254,212,0,67,254,222,0,68,254,152,0,69,255,36,0,70,255,56,0,71,255,
+66,0,72,255,66,0,73,0,30,0,74,0,30,0,75,255,136,0,76,255,96,0,77,255,236,
+0,78,255,146,0,79,255,226,0,80,255,56,0,81,255,156,0,82,255,136,0,83,255,
+66,0,84,255,46,0,85,255,66,0,86,255,56,0,87,255,56,0,88,255,6,0,79,0,4,255,
+216,0,5,255,216,0,6,255,226,0,7,255,86,0,8,255,216,0,9,255,166,0,10,255,216,
+0,11,255,216,0,12,0,40,0,13,0,20,0,14,255,226,0,15,255,216,0,16,0,40,0,17,
+255,216,0,18,255,216,0,19,255,216,0,20,0,40,0,22,0,40,0,23,255,216,0,24,255,
+216,0,25,0,5,0,26,0,40,0,28,255,216,0,29,255,246,0,30,255,236,0,32,255,216,
+0,33,0,40,0,34,255,216,0,36,0,20,0,37,0,10,0,38,0,10,0,39,255,176,0,41,255,
+216,0,42,255,216,0,43,0,40,0,44,0,40,0,45,0,40,0,46,0,40,0,47,0,40,0,48,0,
+20,0,49,255,216,0,50,0,40,0,51,255,156,0,52,0,140,0,53,0,30,0,54,0,40,0,56,
+255,246,0,57,255,226,0,58,255,216,0,59,0,10,0,60,0,100,0,61,0,110,0,62,0,
+20,0,63,0,120,0,64,0,30,0,65,0,70,0,66,255,56,0,67,255,146,0,68,255,146,0,
+69,255,86,0,70,255,246,0,71,0,70,0,72,0,60,0,73,0,60,0,74,255,216,0,75,0,
+70,0,76,0,70,0,77,0,110,0,78,0,120,0,79,0,70,0,80,0,60,0,81,0,30,0,82,0,40,
+0,83,255,246,0,84,0,60,0,85,0,60,0,86,0,60,0,87,0,20,0,88,255,186,0,82,0,
+4,255,231,0,5,255,231,0,6,0,50,0,7,254,212,0,8,255,231,0,9,0,20,0,10,255,
+231,0,11,255,231,0,12,255,246,0,13,0,50,0,14,0,50,0,15,255,231,0,16,255,246,
+0,17,255,231,0,18,255,231,0,19,255,251,0,20,255,246,0,21,255,186,0,22,255,
+246,0,23,255,231,0,24,0,10,0,26,255,246,0,27,0,30,0,28,255,231,0,29,0,50,
+0,30,255,231,0,31,255,196,0,32,255,231,0,33,255,246,0,34,255,231,0,35,255,
+176,0,36,0,20,0,37,255,216,0,38,0,40,0,39,255,66,0,40,0,40,0,41,255,231,0,
+42,255,231,0,43,255,246,0,44,255,246,0,45,255,246,0,46,255,246,0,47,255,246,
+0,49,255,241,0,50,255,106,0,51,255,116,0,52,0,130,0,53,0,95,0,54,255,246,
+0,55,255,226,0,56,255,166,0,57,0,50,0,58,255,231,0,59,255,196,0,60,0,40,0,
+61,0,60,0,63,0,100,0,64,255,246,0,65,0,30,0,66,254,242,0,67,254,232,0,68,
+254,212,0,69,255,76,0,70,255,166,0,71,255,196,0,72,255,176,0,73,0,80,0,74,
+0,60,0,75,0,20,0,76,255,246,0,77,0,120,0,78,0,80,0,79,0,80,0,80,255,176,0,
+81,0,10,0,82,255,236,0,83,255,166,0,84,255,186,0,85,255,196,0,86,255,196,
+0,87,255,186,0,88,255,76,0,54,0,6,255,216,0,7,0,20,0,9,255,186,0,12,255,236,
+0,13,0,30,0,14,255,186,0,16,255,236,0,20,255,246,0,21,0,20,0,22,255,236,0,
+25,0,60,0,26,255,236,0,29,255,206,0,33,255,246,0,39,0,20,0,43,255,236,0,44,
+255,236,0,45,255,236,0,46,255,246,0,47,255,236,0,50,0,50,0,51,0,50,0,53,0,
+10,0,54,255,236,0,56,0,30,0,57,255,196,0,59,0,20,0,60,0,10,0,61,0,20,0,63,
+0,50,0,64,255,236,0,66,0,20,0,67,0,60,0,68,0,70,0,69,0,50,0,70,0,30,0,71,
+0,60,0,72,0,30,0,73,255,216,0,74,255,216,0,75,0,40,0,76,0,40,0,77,0,50,0,
+78,0,10,0,79,255,216,0,80,0,30,0,81,0,10,0,82,255,236,0,83,0,50,0,84,0,30,
+0,85,0,30,0,86,0,30,0,87,0,30,0,88,0,30,0,65,0,6,255,176,0,7,255,226,0,9,
+255,156,0,12,0,50,0,14,255,156,0,16,0,50,0,20,0,50,0,22,0,50,0,24,255,216,
+0,25,0,110,0,26,0,50,0,27,0,10,0,29,255,226,0,31,0,20,0,33,0,50,0,35,0,20,
+0,36,0,20,0,37,0,30,0,38,0,50,0,39,255,226,0,40,0,20,0,43,0,50,0,44,0,50,
+0,45,0,50,0,46,0,50,0,47,0,50,0,48,0,50,0,49,0,20,0,50,0,110,0,51,0,80,0,
+52,0,30,0,53,0,20,0,54,0,50,0,55,0,20,0,56,0,130,0,57,255,176,0,59,0,110,
+0,60,0,90,0,61,0,131,0,62,0,60,0,63,0,20,0,64,0,50,0,65,0,20,0,66,255,246,
+0,67,255,246,0,68,255,246,0,69,255,226,0,70,0,130,0,71,0,130,0,72,0,120,0,
+73,255,236,0,74,255,146,0,75,0,120,0,76,0,120,0,77,0,120,0,78,0,90,0,80,0,
+130,0,81,0,50,0,82,0,50,0,83,0,130,0,84,0,100,0,85,0,130,0,86,0,130,0,87,
+0,130,0,88,0,80,0,84,0,4,255,236,0,5,255,236,0,6,255,146,0,7,255,186,0,8,
+255,236,0,9,255,116,0,10,255,236,0,11,255,236,0,12,0,70,0,13,0,20,0,14,255,
+116,0,15,255,236,0,16,0,70,0,17,255,236,0,18,255,236,0,19,255,236,0,20,0,
+40,0,22,0,70,0,23,255,236,0,24,255,156,0,25,0,120,0,26,0,40,0,27,255,236,
+0,28,255,236,0,29,255,136,0,30,255,236,0,31,0,20,0,32,255,236,0,33,0,70,0,
+34,255,236,0,35,0,30,0,36,0,20,0,37,0,20,0,38,0,70,0,39,255,226,0,40,255,
+236,0,41,255,236,0,42,255,236,0,43,0,70,0,44,0,70,0,45,0,70,0,46,0,70,0,47,
+0,80,0,48,0,70,0,49,255,236,0,50,0,110,0,51,0,90,0,52,255,216,0,53,255,186,
+0,54,0,70,0,55,0,30,0,56,0,100,0,57,255,116,0,58,255,236,0,59,0,130,0,60,
+0,80,0,61,0,130,0,62,0,40,0,63,0,50,0,64,0,50,0,65,0,30,0,66,255,216,0,67,
+255,186,0,68,0,20,0,69,0,20,0,70,0,120,0,71,0,120,0,72,0,130,0,73,255,156,
+0,74,255,96,0,75,0,140,0,76,0,130,0,77,0,80,0,78,0,10,0,79,255,196,0,80,0,
+140,0,81,0,55,0,82,0,70,0,83,0,101,0,84,0,110,0,85,0,120,0,86,0,120,0,87,
+0,110,0,88,0,100,0,32,0,9,255,196,0,14,255,226,0,25,0,80,0,29,255,226,0,38,
+0,40,0,50,0,70,0,51,0,40,0,52,0,30,0,53,0,30,0,56,0,50,0,59,0,70,0,60,0,10,
+0,61,0,60,0,63,0,50,0,68,255,246,0,70,0,60,0,71,0,70,0,72,0,60,0,74,255,226,
+0,75,0,50,0,76,0,50,0,77,0,50,0,78,0,10,0,79,0,35,0,80,0,60,0,81,0,20,0,83,
+0,60,0,84,0,60,0,85,0,60,0,86,0,60,0,87,0,60,0,88,0,20,0,69,0,4,255,236,0,
+5,255,236,0,6,0,50,0,7,254,252,0,8,255,236,0,9,0,20,0,10,255,236,0,11,255,
+236,0,13,0,20,0,14,0,50,0,15,255,236,0,17,255,236,0,18,255,236,0,19,255,236,
+0,21,255,206,0,23,0,10,0,24,0,30,0,25,255,216,0,27,0,30,0,28,255,236,0,29,
+0,40,0,30,255,236,0,31,255,186,0,32,255,236,0,34,255,236,0,35,255,216,0,37,
+255,226,0,38,0,30,0,39,255,66,0,40,0,30,0,41,255,236,0,42,255,236,0,48,255,
+226,0,50,255,106,0,51,255,106,0,52,0,90,0,53,0,100,0,55,255,216,0,56,255,
+166,0,57,0,50,0,58,255,236,0,59,255,156,0,60,0,20,0,61,0,50,0,62,255,246,
+0,63,0,90,0,65,0,40,0,66,254,252,0,67,255,66,0,68,254,252,0,69,255,56,0,70,
+255,206,0,71,255,186,0,72,255,226,0,73,0,70,0,74,0,10,0,75,0,20,0,76,0,20,
+0,77,0,120,0,78,0,60,0,79,0,90,0,80,255,176,0,81,0,10,0,83,255,216,0,84,255,
+156,0,85,255,186,0,86,255,186,0,87,255,186,0,88,255,56,0,69,0,4,255,241,0,
+5,255,241,0,7,255,186,0,8,255,241,0,9,255,226,0,10,255,241,0,11,255,241,0,
+12,255,246,0,15,255,241,0,16,255,246,0,17,255,241,0,18,255,241,0,19,255,241,
+0,20,255,246,0,21,255,236,0,23,255,241,0,25,0,50,0,26,255,246,0,28,255,241,
+0,30,255,241,0,31,255,236,0,32,255,241,0,33,255,246,0,34,255,241,0,37,255,
+246,0,38,0,20,0,39,255,226,0,41,255,241,0,42,255,241,0,43,255,246,0,44,255,
+246,0,45,255,246,0,46,255,246,0,47,255,246,0,48,0,10,0,49,255,241,0,50,0,
+60,0,51,0,40,0,52,0,20,0,53,0,20,0,54,255,246,0,56,0,10,0,57,0,20,0,58,255,
+241,0,59,0,60,0,60,0,30,0,61,0,40,0,63,0,20,0,64,255,246,0,66,255,196,0,67,
+255,186,0,68,255,186,0,69,255,186,0,70,255,226,0,71,0,40,0,72,0,20,0,75,0,
+30,0,76,0,80,0,77,0,40,0,78,0,30,0,80,0,60,0,81,255,246,0,82,255,246,0,83,
+0,10,0,84,255,236,0,85,0,10,0,86,0,10,0,87,0,10,0,88,255,236,0,70,0,4,255,
+246,0,5,255,246,0,6,0,60,0,7,255,6,0,8,255,246,0,9,0,10,0,10,255,246,0,11,
+255,246,0,13,0,50,0,14,0,50,0,15,255,246,0,17,255,246,0,18,255,246,0,19,255,
+246,0,21,255,226,0,23,255,246,0,24,0,30,0,25,255,226,0,27,0,30,0,28,255,246,
+0,29,0,50,0,30,255,246,0,31,255,216,0,32,255,246,0,34,255,246,0,35,255,216,
+0,36,0,20,0,37,255,226,0,38,0,40,0,39,255,66,0,40,0,30,0,41,255,246,0,42,
+255,246,0,49,0,20,0,50,255,136,0,51,255,96,0,52,0,130,0,53,0,110,0,55,255,
+216,0,56,255,136,0,57,0,60,0,58,255,246,0,59,255,186,0,60,0,10,0,61,0,40,
+0,63,0,110,0,64,255,236,0,65,0,40,0,66,255,6,0,67,255,26,0,68,255,6,0,69,
+255,126,0,70,255,166,0,71,255,196,0,72,255,176,0,73,0,60,0,74,0,60,0,75,0,
+10,0,76,255,246,0,77,0,120,0,78,0,30,0,79,0,70,0,80,255,166,0,81,0,10,0,83,
+255,116,0,84,255,166,0,85,255,186,0,86,255,166,0,87,255,186,0,88,255,96,0,
+66,0,4,255,216,0,5,255,216,0,6,255,216,0,7,255,186,0,8,255,216,0,9,255,166,
+0,10,255,216,0,11,255,216,0,13,255,236,0,14,255,166,0,15,255,216,0,17,255,
+216,0,18,255,216,0,19,255,216,0,23,255,216,0,24,255,196,0,25,0,40,0,27,255,
+246,0,28,255,216,0,29,255,196,0,30,255,216,0,32,255,216,0,33,0,10,0,34,255,
+216,0,38,0,15,0,39,255,206,0,40,255,236,0,41,255,216,0,42,255,216,0,48,0,
+10,0,49,255,216,0,50,0,30,0,51,0,30,0,52,0,50,0,53,0,40,0,56,0,50,0,57,255,
+206,0,58,255,216,0,59,0,50,0,60,0,60,0,61,0,70,0,62,0,10,0,63,0,50,0,64,0,
+10,0,66,255,176,0,67,255,186,0,68,255,176,0,69,255,206,0,70,0,30,0,71,0,50,
+0,72,0,50,0,73,255,216,0,74,255,186,0,75,0,90,0,76,0,80,0,77,0,50,0,78,0,
+70,0,79,0,10,0,80,0,50,0,81,0,30,0,83,0,50,0,84,0,50,0,85,0,50,0,86,0,50,
+0,87,0,50,0,88,0,50,0,66,0,4,255,226,0,5,255,226,0,6,255,216,0,7,255,186,
+0,8,255,226,0,9,255,166,0,10,255,226,0,11,255,226,0,13,255,236,0,14,255,166,
+0,15,255,226,0,17,255,226,0,18,255,226,0,19,255,226,0,23,255,226,0,24,255,
+196,0,25,0,40,0,27,255,246,0,28,255,226,0,29,255,206,0,30,255,226,0,32,255,
+226,0,33,0,10,0,34,255,226,0,38,0,15,0,39,255,206,0,40,255,236,0,41,255,226,
+0,42,255,226,0,48,0,10,0,49,255,216,0,50,0,50,0,51,0,30,0,52,0,70,0,53,0,
+50,0,56,0,50,0,57,255,216,0,58,255,226,0,59,0,80,0,60,0,60,0,61,0,80,0,62,
+255,246,0,63,0,50,0,64,0,10,0,66,255,176,0,67,255,186,0,68,255,176,0,69,255,
+186,0,70,0,30,0,71,0,50,0,72,0,50,0,73,255,216,0,74,255,206,0,75,0,90,0,76,
+0,80,0,77,0,70,0,78,0,70,0,79,0,10,0,80,0,70,0,81,0,30,0,83,0,50,0,84,0,50,
+0,85,0,50,0,86,0,50,0,87,0,50,0,88,0,50,0,68,0,4,255,226,0,5,255,226,0,6,
+255,216,0,7,255,146,0,8,255,226,0,9,255,176,0,10,255,226,0,11,255,226,0,13,
+255,236,0,14,255,176,0,15,255,226,0,17,255,226,0,18,255,226,0,19,255,226,
+0,23,255,226,0,24,255,196,0,25,0,40,0,27,255,246,0,28,255,226,0,29,255,196,
+0,30,255,226,0,32,255,226,0,33,0,10,0,34,255,226,0,38,0,25,0,39,255,196,0,
+40,255,236,0,41,255,226,0,42,255,226,0,48,0,30,0,49,255,216,0,50,0,60,0,51,
+0,30,0,52,0,50,0,53,0,50,0,56,0,50,0,57,255,216,0,58,255,226,0,59,0,80,0,
+60,0,70,0,61,0,80,0,62,255,246,0,63,0,50,0,64,0,30,0,65,0,10,0,66,255,156,
+0,67,255,146,0,68,255,176,0,69,255,176,0,70,0,30,0,71,0,50,0,72,0,50,0,73,
+255,246,0,74,255,206,0,75,0,90,0,76,0,80,0,77,0,70,0,78,0,70,0,79,0,10,0,
+80,0,70,0,81,0,30,0,82,0,10,0,83,0,50,0,84,0,50,0,85,0,50,0,86,0,50,0,87,
+0,60,0,88,0,50,0,78,0,4,255,226,0,5,255,226,0,6,255,216,0,7,255,176,0,8,255,
+226,0,9,255,166,0,10,255,226,0,11,255,226,0,12,0,10,0,13,255,236,0,14,255,
+166,0,15,255,226,0,16,0,10,0,17,255,226,0,18,255,226,0,19,255,226,0,20,0,
+10,0,22,0,10,0,23,255,226,0,24,255,196,0,25,0,40,0,26,0,10,0,27,255,246,0,
+28,255,226,0,29,255,196,0,30,255,226,0,32,255,226,0,33,0,10,0,34,255,226,
+0,38,0,15,0,39,255,206,0,40,255,236,0,41,255,226,0,42,255,226,0,43,0,10,0,
+44,0,10,0,45,0,10,0,46,0,10,0,47,0,10,0,48,0,10,0,49,255,216,0,50,0,40,0,
+51,0,30,0,52,0,50,0,53,0,50,0,54,0,10,0,56,0,50,0,57,255,216,0,58,255,226,
+0,59,0,80,0,60,0,60,0,61,0,80,0,62,0,20,0,63,0,50,0,64,0,10,0,66,255,176,
+0,67,255,176,0,68,255,176,0,69,255,176,0,70,0,30,0,71,0,50,0,72,0,50,0,73,
+255,216,0,74,255,206,0,75,0,60,0,76,0,80,0,77,0,70,0,78,0,70,0,79,0,10,0,
+80,0,70,0,81,0,30,0,82,0,10,0,83,0,50,0,84,0,50,0,85,0,50,0,86,0,50,0,87,
+0,50,0,88,0,50,0,83,0,4,255,236,0,5,255,236,0,6,255,146,0,8,255,236,0,9,255,
+76,0,10,255,236,0,11,255,236,0,12,0,20,0,13,0,20,0,14,255,76,0,15,255,236,
+0,16,0,20,0,17,255,236,0,18,255,236,0,19,255,236,0,20,0,20,0,22,0,20,0,23,
+255,236,0,24,255,216,0,25,0,110,0,26,0,20,0,27,255,236,0,28,255,236,0,29,
+255,106,0,30,255,236,0,31,0,30,0,32,255,236,0,33,0,20,0,34,255,236,0,35,0,
+30,0,36,0,40,0,37,0,40,0,38,0,70,0,39,0,30,0,40,255,236,0,41,255,236,0,42,
+255,236,0,43,0,20,0,44,0,20,0,45,0,20,0,46,0,20,0,47,0,20,0,48,0,70,0,49,
+255,236,0,50,0,90,0,51,0,90,0,52,255,136,0,53,255,166,0,54,0,20,0,55,0,30,
+0,56,0,80,0,57,255,66,0,58,255,236,0,59,0,110,0,60,0,20,0,61,0,70,0,62,0,
+40,0,63,255,176,0,64,0,20,0,65,255,226,0,66,0,40,0,67,0,40,0,68,0,20,0,69,
+0,60,0,70,0,90,0,71,0,90,0,72,0,90,0,73,255,156,0,74,255,56,0,75,0,90,0,76,
+0,110,0,77,0,50,0,78,0,10,0,79,255,196,0,80,0,100,0,81,0,55,0,82,0,20,0,83,
+0,101,0,84,0,90,0,85,0,90,0,86,0,90,0,87,0,80,0,88,0,75,0,2,0,1,0,4,0,88,
+0,0,0,1,0,0,0,10,0,44,0,46,0,2,68,70,76,84,0,24,99,104,101,114,0,14,0,4,0,
+0,0,0,255,255,0,0,0,4,0,0,0,0,255,255,0,0,0,0,0,0,};
+#endif
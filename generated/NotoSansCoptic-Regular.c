@@ -0,0 +1,1059 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansCoptic_Regular_ttf_size = 26436;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansCoptic_Regular_ttf");
+asm(".type fz_font_NotoSansCoptic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansCoptic_Regular_ttf, 26436");
+asm(".balign 64");
+asm("fz_font_NotoSansCoptic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansCoptic-Regular.ttf\"");
+#else
+const int fz_font_NotoSansCoptic_Regular_ttf_size = 26436;
+const char fz_font_NotoSansCoptic_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,4,165,4,245,0,0,77,172,0,0,0,100,
+71,80,79,83,155,7,186,64,0,0,78,16,0,0,14,56,71,83,85,66,237,120,9,61,0,0,
+92,72,0,0,10,252,79,83,47,50,126,62,142,216,0,0,1,104,0,0,0,96,99,109,97,
+112,106,254,78,218,0,0,4,200,0,0,0,186,103,97,115,112,0,7,0,7,0,0,77,160,
+0,0,0,12,103,108,121,102,222,172,101,191,0,0,7,8,0,0,55,240,104,101,97,100,
+255,227,134,236,0,0,0,236,0,0,0,54,104,104,101,97,10,15,2,121,0,0,1,36,0,
+0,0,36,104,109,116,120,176,57,169,210,0,0,1,200,0,0,3,0,108,111,99,97,157,
+31,142,199,0,0,5,132,0,0,1,130,109,97,120,112,0,209,0,129,0,0,1,72,0,0,0,
+32,110,97,109,101,140,78,184,148,0,0,62,248,0,0,6,0,112,111,115,116,71,138,
+2,39,0,0,68,248,0,0,8,168,0,1,0,0,0,1,7,174,102,51,245,150,95,15,60,245,0,
+11,8,0,0,0,0,0,204,248,172,247,0,0,0,0,210,76,134,219,249,102,254,20,8,25,
+8,90,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,8,92,249,102,251,180,
+8,25,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,0,1,0,0,0,192,0,128,0,16,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,234,1,144,0,5,0,0,5,154,5,51,
+0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,185,0,0,2,11,5,2,4,5,4,2,2,4,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,
+8,141,2,88,32,60,1,131,4,0,0,0,4,74,5,182,0,0,0,32,0,2,4,205,0,193,0,0,0,
+0,4,20,0,0,2,20,0,0,1,197,0,41,1,197,0,41,0,0,252,76,0,0,253,6,0,0,254,166,
+0,0,252,55,0,0,253,128,0,0,255,150,0,0,253,215,8,66,0,125,6,135,0,113,5,115,
+0,100,4,244,0,113,5,53,0,199,4,94,0,174,4,100,0,80,4,51,0,102,6,135,0,33,
+5,66,0,25,5,158,0,125,4,205,0,113,4,225,0,23,4,137,0,33,0,0,249,102,5,16,
+0,43,4,152,0,41,5,51,0,199,4,156,0,174,4,49,0,199,3,119,0,174,6,131,0,33,
+5,68,0,20,5,37,0,125,3,246,0,113,4,115,0,92,3,213,0,98,4,147,0,78,3,162,0,
+80,5,238,0,199,5,25,0,174,6,66,0,125,4,215,0,113,2,70,0,199,2,16,0,174,4,
+244,0,199,4,70,0,174,4,166,255,252,3,188,255,225,6,102,0,199,5,248,0,123,
+6,20,0,199,5,14,0,174,4,147,0,78,3,195,0,84,6,63,0,125,4,215,0,113,5,217,
+0,199,4,254,0,174,4,215,0,199,4,61,0,176,5,14,0,125,3,215,0,113,4,225,0,23,
+4,137,0,33,4,135,0,0,4,16,255,170,6,111,0,104,5,205,0,111,4,176,0,8,4,59,
+0,37,6,172,0,98,5,154,0,80,8,66,0,125,6,135,0,113,5,45,0,20,4,12,0,20,4,111,
+0,68,4,147,0,158,5,10,0,57,4,106,0,70,4,147,0,78,3,195,0,66,5,45,0,20,4,12,
+0,20,6,78,0,199,5,166,0,174,6,135,0,199,5,246,0,174,5,49,0,4,4,78,255,252,
+8,66,0,125,6,135,0,113,4,172,0,72,3,252,0,29,3,135,0,29,3,10,0,20,4,100,0,
+80,4,51,0,102,4,147,0,92,4,147,0,104,4,180,0,78,4,20,0,57,4,240,0,14,4,102,
+255,209,4,49,0,199,3,123,0,174,4,147,0,82,4,147,0,106,2,219,0,23,2,244,0,
+39,4,203,255,244,4,35,255,244,5,217,0,199,4,254,0,174,6,131,0,33,5,68,0,20,
+4,213,0,106,4,213,0,111,4,115,0,199,3,195,0,174,6,152,0,143,5,211,0,135,5,
+68,0,92,4,174,0,82,4,70,0,174,5,254,0,41,5,211,0,102,6,248,0,98,5,139,0,25,
+5,139,0,16,8,92,0,113,6,139,0,82,4,188,0,70,6,20,0,199,5,74,0,174,0,0,252,
+57,0,0,252,84,0,0,252,84,5,215,0,199,4,236,0,174,6,176,0,49,4,111,0,51,4,
+111,0,49,6,176,0,51,2,197,0,61,3,104,0,72,2,102,0,100,0,0,252,204,0,0,0,0,
+0,0,253,128,0,0,254,172,0,0,253,228,0,0,252,254,0,0,252,154,0,0,251,180,0,
+0,0,0,0,0,253,128,0,0,254,172,0,0,253,228,0,0,252,254,0,0,252,154,0,0,251,
+180,0,0,254,172,0,0,253,228,0,0,252,254,0,0,252,154,0,0,251,180,0,0,252,204,
+0,0,0,0,0,0,253,128,0,0,254,172,0,0,253,228,0,0,252,254,0,0,252,154,0,0,251,
+180,0,0,253,128,0,0,254,172,0,0,253,228,0,0,252,254,0,0,252,154,0,0,251,180,
+0,0,254,172,0,0,253,228,0,0,252,254,0,0,252,154,0,0,251,180,0,0,253,128,5,
+218,0,50,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,174,0,0,0,38,0,32,0,4,0,6,0,0,0,13,
+0,32,0,160,3,2,3,5,3,8,3,35,3,63,3,97,3,117,3,239,29,205,37,204,44,243,44,
+255,254,38,254,255,255,255,0,0,0,0,0,13,0,32,0,160,3,0,3,4,3,7,3,35,3,63,
+3,97,3,116,3,226,29,205,37,204,44,128,44,249,254,36,254,255,255,255,0,1,255,
+245,255,227,255,99,253,6,253,5,253,4,253,124,253,97,252,186,252,144,252,43,
+226,78,218,243,211,156,211,151,0,0,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,152,0,151,0,153,0,0,0,0,0,
+21,0,21,0,21,0,21,0,40,0,60,0,86,0,112,0,148,0,162,0,176,0,198,0,237,1,69,
+1,150,1,192,1,233,2,29,2,78,2,141,2,202,2,255,3,51,3,120,3,180,3,210,3,244,
+4,26,4,85,4,142,4,197,4,251,5,20,5,44,5,89,5,131,5,177,5,223,6,36,6,106,6,
+135,6,168,6,191,6,216,7,16,7,67,7,79,7,91,7,119,7,149,7,197,7,240,8,23,8,
+78,8,111,8,134,8,199,9,5,9,55,9,99,9,117,9,135,9,170,9,205,9,249,10,32,10,
+60,10,89,10,112,10,135,10,198,11,1,11,31,11,62,11,105,11,147,11,218,12,29,
+12,48,12,67,12,103,12,140,12,167,12,194,12,225,13,3,13,17,13,31,13,57,13,
+83,13,122,13,161,13,207,13,252,14,134,15,8,15,52,15,93,15,109,15,125,15,196,
+16,9,16,57,16,106,16,166,16,222,16,254,17,30,17,45,17,61,17,109,17,160,17,
+189,17,216,18,1,18,41,18,60,18,79,18,147,18,208,19,22,19,89,19,108,19,127,
+19,180,19,233,20,41,20,104,20,142,20,222,21,15,21,115,21,160,21,216,22,34,
+22,103,22,167,22,206,22,244,23,15,23,33,23,51,23,112,23,173,23,221,24,8,24,
+51,24,98,24,136,24,190,24,210,24,224,24,237,24,251,25,9,25,23,25,37,25,51,
+25,65,25,86,25,106,25,120,25,134,25,148,25,162,25,176,25,196,25,216,25,236,
+26,0,26,20,26,34,26,47,26,61,26,75,26,89,26,103,26,117,26,131,26,151,26,165,
+26,179,26,193,26,207,26,221,26,241,27,5,27,25,27,45,27,65,27,79,27,248,0,
+0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,0,41,4,111,1,156,5,182,
+0,8,0,0,18,55,51,21,6,6,7,35,53,131,64,217,52,133,67,119,5,16,166,20,88,168,
+51,24,0,1,0,41,254,61,1,156,255,133,0,8,0,0,0,7,35,53,54,54,55,51,21,1,68,
+66,217,51,133,68,119,254,227,166,21,88,168,51,24,0,0,1,252,76,4,217,253,232,
+6,33,0,13,0,0,1,35,46,3,39,53,51,30,3,23,253,232,121,35,87,82,69,18,215,17,
+48,53,55,24,4,217,28,82,87,82,28,21,35,82,82,76,28,0,0,1,253,6,4,217,254,
+162,6,33,0,13,0,0,1,62,3,55,51,21,14,3,7,35,253,6,22,53,54,48,18,217,19,69,
+83,86,36,119,4,242,28,76,82,82,35,21,28,82,87,82,28,0,0,1,254,166,4,217,1,
+90,6,33,0,20,0,0,1,62,3,55,51,30,3,23,21,35,38,38,39,6,6,7,35,254,166,28,
+71,71,62,20,184,18,63,72,74,29,127,54,113,56,56,109,54,123,4,240,30,76,83,
+81,35,35,82,82,77,29,23,32,97,55,55,95,34,0,0,1,252,55,4,217,254,151,5,106,
+0,3,0,0,1,33,21,33,252,55,2,96,253,160,5,106,145,0,0,1,253,128,6,166,2,128,
+7,5,0,3,0,0,1,33,21,33,253,128,5,0,251,0,7,5,95,0,0,1,255,150,5,0,0,105,5,
+229,0,11,0,0,3,52,54,51,50,22,21,20,6,35,34,38,106,61,45,42,63,63,42,45,61,
+5,115,60,54,54,60,59,56,56,0,2,253,215,5,12,0,23,5,215,0,11,0,23,0,0,1,52,
+54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,253,215,56,
+40,39,58,58,39,40,56,1,129,56,38,39,58,58,39,38,56,5,115,53,47,47,53,53,50,
+50,53,53,47,47,53,53,50,50,0,0,1,0,125,254,113,7,197,5,217,0,55,0,0,5,34,
+38,2,53,16,37,23,6,2,21,20,18,22,51,50,54,17,17,51,17,16,22,51,50,54,18,53,
+52,2,39,55,22,18,21,16,2,0,33,34,39,53,22,51,50,36,55,39,6,6,35,34,38,39,
+35,2,2,156,163,246,134,1,174,104,176,166,89,163,105,156,133,184,139,152,109,
+160,87,182,168,135,199,211,195,254,140,254,255,124,76,86,112,187,1,17,89,
+6,70,143,94,127,175,40,6,102,20,177,1,78,228,2,22,240,123,106,254,194,227,
+175,254,252,137,245,1,5,3,0,253,0,254,247,241,133,1,1,182,224,1,85,96,117,
+118,254,115,251,254,165,254,1,254,240,26,164,27,172,179,6,78,63,154,155,254,
+203,0,1,0,113,254,123,6,23,4,123,0,53,0,0,1,16,2,4,35,34,39,53,22,51,50,54,
+55,39,6,6,35,34,39,35,6,6,35,34,38,2,53,52,18,55,23,6,6,21,20,22,51,50,54,
+53,17,51,17,20,22,51,50,54,54,53,16,39,55,4,6,23,157,254,211,186,88,63,59,
+90,149,201,76,6,48,112,75,197,63,7,35,161,125,115,181,101,142,142,129,123,
+110,124,109,107,117,172,109,97,70,115,65,227,133,1,19,2,33,254,236,254,91,
+237,20,164,18,148,171,4,58,62,233,108,125,137,1,1,173,189,1,48,107,100,97,
+242,161,190,218,170,148,2,129,253,127,152,166,100,187,127,1,36,202,100,229,
+0,0,1,0,100,0,0,4,172,5,205,0,23,0,0,1,6,6,35,32,0,17,16,0,51,21,6,6,21,20,
+22,51,50,54,55,17,51,17,35,3,242,75,177,86,254,244,254,208,1,36,249,165,181,
+203,186,97,169,60,186,186,1,121,41,47,1,54,1,15,1,25,1,78,160,8,229,197,205,
+235,50,36,3,157,250,74,0,0,1,0,113,254,20,4,70,4,96,0,24,0,0,37,6,6,35,34,
+38,38,53,52,0,55,21,6,6,21,20,22,51,50,54,55,17,51,17,35,3,145,81,150,84,
+147,219,119,1,13,239,157,165,168,147,85,138,76,181,181,125,53,43,134,240,
+152,249,1,44,16,149,15,215,182,172,205,47,58,3,43,249,202,0,0,1,0,199,254,
+37,5,14,5,182,0,33,0,0,1,20,6,6,7,6,6,21,35,52,62,6,53,52,38,35,34,6,7,17,
+35,17,51,17,54,54,51,32,0,5,14,90,174,221,122,103,185,60,99,126,131,126,99,
+60,208,181,84,175,67,186,186,69,188,81,1,11,1,48,2,80,155,252,204,154,84,
+139,79,92,136,107,90,91,102,134,175,119,208,233,46,40,252,98,5,182,254,135,
+40,49,254,203,0,1,0,174,254,20,4,35,4,74,0,32,0,0,1,52,38,35,34,7,17,35,17,
+51,17,54,54,51,50,22,21,20,6,6,7,6,6,21,35,52,62,6,3,104,141,119,144,114,
+180,180,76,144,85,184,216,82,156,144,94,83,185,48,78,100,105,100,78,48,1,
+23,134,162,98,254,35,4,74,254,51,54,42,241,199,131,207,151,84,56,97,59,71,
+102,77,61,63,72,98,134,0,1,0,80,255,53,4,61,5,203,0,37,0,0,19,38,38,53,52,
+54,54,51,50,22,22,21,16,0,5,18,33,50,55,21,6,6,35,32,0,3,36,0,53,52,38,35,
+34,6,21,20,22,23,141,29,32,126,230,148,155,226,120,254,137,254,124,79,1,148,
+145,97,49,148,49,254,214,254,153,44,1,152,1,125,171,147,141,160,24,17,3,70,
+48,120,53,127,192,105,116,213,138,254,255,254,157,111,254,192,31,172,15,20,
+1,55,1,31,93,1,29,210,160,178,143,125,35,85,30,0,0,1,0,102,254,238,3,219,
+4,94,0,37,0,0,19,38,53,52,54,54,51,50,22,22,21,20,6,4,5,18,33,50,54,55,21,
+6,6,35,32,0,3,36,36,53,52,38,35,34,6,21,20,23,184,55,106,195,133,130,180,
+96,136,254,244,254,240,80,1,96,61,153,48,56,159,72,255,0,254,216,46,1,107,
+1,65,124,111,116,128,37,2,59,89,98,101,165,94,93,160,101,136,202,153,80,254,
+194,29,24,153,22,27,1,26,1,29,81,212,157,102,126,112,105,59,62,0,2,0,33,0,
+0,6,100,5,182,0,2,0,29,0,0,37,33,1,1,51,1,1,22,22,51,21,33,34,38,53,51,20,
+22,51,1,3,38,38,35,53,51,50,22,23,23,2,78,2,176,254,178,1,27,221,254,131,
+1,59,70,96,88,250,219,145,141,174,68,102,1,194,168,62,114,94,41,130,164,69,
+155,162,2,59,2,215,253,191,253,235,116,72,162,139,152,72,57,2,194,1,13,97,
+66,162,88,106,246,0,2,0,25,0,0,5,59,4,76,0,2,0,28,0,0,37,33,3,1,21,33,34,
+53,51,20,22,51,1,39,38,38,35,53,51,50,22,23,23,19,51,1,1,22,22,1,250,1,244,
+250,2,71,251,181,215,149,51,74,1,96,159,50,80,71,49,99,133,63,125,246,198,
+254,180,1,2,59,84,145,1,99,254,157,145,244,51,48,1,222,221,69,45,142,75,93,
+180,1,90,254,49,254,153,82,49,0,0,2,0,125,255,236,5,143,6,74,0,27,0,40,0,
+0,1,23,54,54,51,50,22,22,21,20,2,4,35,34,36,2,53,16,0,37,36,55,21,6,6,7,6,
+4,1,50,54,53,52,38,35,34,6,21,20,22,22,1,90,4,77,245,135,166,248,135,162,
+254,220,179,178,254,240,148,1,130,1,136,1,114,150,80,205,253,221,254,244,
+1,75,202,232,205,194,204,239,105,186,3,197,4,85,95,138,255,162,171,254,232,
+155,164,1,47,200,1,139,1,174,46,40,52,168,23,35,32,26,191,252,28,235,201,
+189,215,224,188,119,197,112,0,0,2,0,113,255,236,5,49,5,109,0,22,0,35,0,0,
+5,34,38,38,53,16,0,37,54,36,55,21,6,6,7,6,7,22,18,21,20,6,6,19,52,38,35,7,
+6,6,21,20,22,51,50,54,2,109,157,230,121,1,80,1,63,216,1,14,75,94,252,178,
+108,23,213,243,129,234,173,225,205,35,94,82,173,149,148,171,20,130,238,158,
+1,2,1,96,76,51,95,51,162,53,82,43,31,8,20,254,236,222,142,236,134,1,243,209,
+220,1,71,193,127,179,208,190,0,1,0,23,0,0,4,203,5,182,0,19,0,0,33,35,17,35,
+34,21,35,16,33,51,53,51,21,51,32,17,35,52,35,35,2,205,185,208,125,176,1,34,
+219,185,219,1,35,176,125,209,4,55,131,1,37,221,221,254,219,131,0,1,0,33,254,
+223,4,104,5,84,0,21,0,0,1,50,22,21,35,52,35,35,17,35,17,35,34,21,35,52,54,
+51,51,17,51,17,3,117,116,127,161,97,198,183,198,96,162,127,116,213,183,4,
+74,124,124,96,251,45,4,211,96,123,125,1,10,254,246,0,0,1,249,102,4,217,255,
+172,6,70,0,21,0,0,1,46,3,35,34,14,2,7,35,62,2,36,51,50,4,22,22,23,254,207,
+21,86,140,200,135,135,199,140,86,21,222,33,124,194,1,16,180,180,1,16,194,
+124,33,4,217,44,81,61,37,37,61,81,44,72,133,100,60,60,100,133,72,0,0,2,0,
+43,255,227,5,41,5,182,0,24,0,32,0,0,1,53,51,50,22,23,1,22,22,51,21,35,34,
+38,39,39,6,6,35,32,3,1,3,38,38,19,50,54,55,3,1,22,22,1,25,38,176,194,69,1,
+104,42,98,63,39,107,133,43,18,96,253,143,254,189,123,2,152,111,53,133,82,
+119,218,84,137,254,21,26,122,5,14,168,121,157,252,200,93,91,176,84,88,37,
+115,123,1,4,2,70,1,10,126,89,251,125,109,102,1,51,254,84,38,52,0,2,0,41,255,
+236,4,162,4,74,0,25,0,32,0,0,1,53,51,50,22,23,1,22,22,51,21,35,34,38,38,39,
+6,6,35,34,38,39,1,39,38,38,19,50,55,39,1,22,22,1,16,31,143,175,65,1,68,35,
+77,64,41,58,87,71,55,104,211,127,138,206,47,2,63,79,50,120,98,187,157,125,
+254,109,20,112,3,176,154,94,121,253,159,65,57,152,28,58,82,101,87,121,104,
+1,182,148,88,65,252,211,150,235,254,207,31,49,0,3,0,199,0,0,4,197,5,182,0,
+15,0,24,0,33,0,0,19,33,32,4,21,20,6,7,21,22,22,21,20,4,35,33,19,33,50,54,
+53,52,38,35,35,17,17,33,50,54,53,52,38,35,199,1,161,1,38,1,5,142,136,169,
+159,254,244,240,253,254,184,1,14,172,156,171,185,242,1,39,176,170,180,180,
+5,182,175,187,130,169,25,10,29,176,145,196,220,3,72,110,129,120,106,253,149,
+253,238,136,138,131,125,0,0,3,0,174,0,0,4,88,4,74,0,14,0,22,0,31,0,0,1,20,
+6,7,21,22,22,21,20,6,35,33,17,33,32,3,52,38,35,33,17,33,32,3,52,38,35,33,
+17,33,50,54,4,53,120,111,139,127,229,215,254,18,1,236,1,155,145,144,139,254,
+217,1,43,1,23,31,119,120,254,204,1,19,147,125,3,53,106,111,20,9,19,127,107,
+156,166,4,74,253,2,92,74,254,159,2,148,77,66,254,211,73,0,1,0,199,0,0,4,41,
+5,182,0,12,0,0,1,50,22,22,21,35,52,38,35,33,17,35,17,2,246,118,131,58,174,
+83,110,254,197,184,5,182,59,115,141,86,65,250,238,5,182,0,0,1,0,174,0,0,3,
+80,4,74,0,12,0,0,1,50,22,22,21,35,52,38,35,35,17,35,17,2,59,107,118,52,158,
+74,98,164,180,4,74,55,107,129,78,61,252,78,4,74,0,2,0,33,0,0,6,100,5,182,
+0,2,0,26,0,0,37,33,1,39,46,2,35,53,51,50,22,23,1,30,2,51,21,33,34,38,53,51,
+20,22,51,2,49,2,219,254,158,84,42,68,101,88,39,173,191,70,1,117,34,54,68,
+79,250,219,145,141,174,68,102,162,3,41,164,83,59,23,162,123,159,252,186,76,
+73,31,162,139,152,72,57,0,0,2,0,20,0,0,5,47,4,76,0,2,0,24,0,0,37,33,1,39,
+38,38,35,53,51,50,22,23,1,30,2,51,21,33,34,53,51,20,22,51,1,229,2,17,255,
+0,88,35,94,121,80,126,163,61,1,27,24,49,58,63,251,189,216,154,51,74,145,2,
+15,151,80,51,146,105,123,253,172,51,56,24,145,244,51,48,0,1,0,125,255,236,
+4,233,5,205,0,24,0,0,1,34,4,7,33,21,33,18,0,51,50,55,21,6,35,32,0,17,16,0,
+33,50,23,7,38,3,66,220,254,248,26,2,200,253,51,12,1,5,242,164,202,158,233,
+254,179,254,161,1,120,1,81,235,184,75,175,5,41,245,234,160,254,245,254,238,
+58,160,59,1,132,1,109,1,93,1,147,90,158,84,0,1,0,113,255,236,3,176,4,94,0,
+26,0,0,5,34,0,17,16,0,51,50,22,23,7,38,35,34,6,7,33,21,33,22,22,51,50,54,
+55,21,6,2,123,250,254,240,1,19,253,84,160,59,53,137,117,158,163,17,2,27,253,
+227,9,164,161,93,142,62,120,20,1,33,1,18,1,23,1,40,33,26,148,52,160,164,147,
+184,175,37,25,156,59,0,0,1,0,92,255,113,4,164,5,250,0,50,0,0,37,22,51,50,
+54,53,52,46,6,53,52,54,54,51,50,23,22,51,50,54,55,23,6,6,35,34,39,38,35,34,
+6,21,20,30,6,21,20,6,35,35,39,1,184,46,63,104,123,59,96,123,128,123,96,59,
+119,221,141,80,86,85,40,78,87,32,127,56,147,115,59,91,91,68,131,151,59,96,
+122,128,122,96,59,233,187,51,50,23,7,113,98,66,99,80,69,71,82,106,137,91,
+128,203,114,16,17,44,46,90,85,75,17,16,151,132,67,101,81,69,70,79,102,131,
+88,169,216,2,0,1,0,98,254,152,4,27,4,145,0,49,0,0,1,20,22,22,23,30,2,21,20,
+6,6,35,34,39,53,22,51,50,54,53,52,46,6,53,52,54,51,50,23,22,51,50,54,55,23,
+6,6,35,34,39,38,35,34,6,1,14,56,101,145,123,117,62,98,176,113,35,22,32,23,
+94,111,51,83,107,111,106,83,51,230,178,64,81,81,46,50,73,31,119,53,123,82,
+62,89,89,43,110,130,2,211,64,97,83,79,68,108,129,81,99,174,101,4,155,4,115,
+92,58,87,71,62,65,74,97,125,84,171,216,13,14,38,46,82,83,66,13,12,133,0,1,
+0,78,255,70,4,112,5,182,0,15,0,0,37,33,50,22,21,35,38,38,35,33,53,1,33,53,
+33,21,1,45,2,14,180,129,177,2,67,108,253,64,3,2,253,22,3,201,164,163,187,
+95,91,139,4,135,164,139,0,1,0,80,255,70,3,160,4,74,0,17,0,0,37,50,22,22,23,
+35,52,38,38,35,33,53,1,33,53,33,21,1,2,129,109,120,54,4,164,27,63,74,253,
+248,2,78,253,213,2,241,253,187,139,52,118,155,84,72,30,119,3,71,140,135,252,
+200,0,1,0,199,0,0,5,37,5,182,0,11,0,0,33,35,17,33,17,35,17,51,17,33,17,51,
+5,37,184,253,18,184,184,2,238,184,2,170,253,86,5,182,253,150,2,106,0,1,0,
+174,0,0,4,106,4,74,0,11,0,0,1,17,33,17,51,17,35,17,33,17,35,17,1,98,2,84,
+180,180,253,172,180,4,74,254,55,1,201,251,182,1,233,254,23,4,74,0,0,3,0,125,
+255,236,5,195,5,205,0,11,0,18,0,25,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,50,
+18,19,33,18,18,19,34,6,7,33,38,38,5,195,254,157,254,193,254,189,254,159,1,
+95,1,71,1,62,1,98,253,94,222,243,12,252,68,13,243,225,218,244,19,3,186,19,
+239,2,221,254,161,254,110,1,139,1,104,1,101,1,137,254,113,252,77,1,11,1,4,
+254,252,254,245,4,160,251,247,248,250,0,0,3,0,113,255,236,4,104,4,94,0,12,
+0,18,0,24,0,0,1,16,0,35,34,38,2,53,16,0,51,50,0,1,50,54,55,33,18,1,34,6,7,
+33,2,4,104,254,240,240,149,230,124,1,12,242,232,1,17,254,5,156,152,11,253,
+127,18,1,45,152,151,14,2,127,30,2,39,254,243,254,210,139,1,4,172,1,12,1,43,
+254,207,253,84,184,176,254,152,3,70,166,162,1,72,0,0,1,0,199,0,0,1,127,5,
+182,0,3,0,0,33,35,17,51,1,127,184,184,5,182,0,1,0,174,0,0,1,98,4,74,0,3,0,
+0,33,35,17,51,1,98,180,180,4,74,0,1,0,199,0,0,4,244,5,182,0,12,0,0,33,35,
+1,7,17,35,17,51,17,55,1,51,1,4,244,217,253,249,149,184,184,126,2,9,215,253,
+189,2,186,131,253,201,5,182,253,47,139,2,70,253,131,0,0,1,0,174,0,0,4,51,
+4,72,0,13,0,0,1,51,1,1,35,1,7,17,35,17,51,17,20,7,3,57,217,254,97,1,192,215,
+254,152,135,191,191,13,4,72,254,26,253,158,1,240,111,254,127,4,72,254,227,
+137,137,0,0,1,255,252,255,236,4,172,5,203,0,27,0,0,35,1,39,38,38,35,34,7,
+39,54,51,50,22,23,1,22,22,51,50,55,21,6,35,34,38,39,3,1,4,2,20,53,30,81,55,
+36,37,41,65,86,107,141,53,1,111,25,56,40,24,37,50,71,86,102,39,236,254,93,
+4,4,137,80,76,16,149,29,119,137,252,63,68,71,10,133,24,93,109,2,131,252,199,
+0,0,1,255,225,0,0,3,197,4,74,0,23,0,0,19,51,50,22,22,23,1,22,22,51,21,35,
+34,38,38,39,3,1,35,1,39,38,38,35,207,37,91,93,68,34,1,33,34,55,57,29,82,85,
+65,57,160,254,177,183,1,183,35,32,63,71,4,74,33,78,74,253,129,77,54,143,33,
+82,129,1,102,253,166,3,6,74,68,40,0,1,0,199,0,0,5,160,5,182,0,21,0,0,1,17,
+35,17,6,6,35,34,38,39,17,35,17,51,17,16,0,51,50,18,17,17,5,160,185,88,201,
+149,143,225,66,184,184,1,3,181,183,249,5,182,250,74,1,182,205,188,201,192,
+254,74,5,182,254,168,254,155,253,247,2,39,1,67,1,92,0,1,0,123,255,240,5,133,
+4,74,0,30,0,0,5,34,38,39,35,6,7,7,35,54,18,55,3,51,3,18,51,50,54,19,3,51,
+3,18,19,35,2,39,35,6,6,2,248,146,187,36,4,13,52,27,172,40,97,43,10,205,11,
+84,191,105,156,58,4,201,12,44,103,174,67,9,4,59,190,16,233,221,140,192,106,
+126,1,70,214,1,176,254,80,254,18,236,1,2,1,176,254,80,254,178,254,180,1,16,
+166,232,222,0,0,1,0,199,0,0,5,61,5,182,0,17,0,0,33,35,1,35,23,22,21,17,35,
+17,51,1,51,38,2,53,17,51,5,61,215,253,17,8,5,11,184,213,2,237,8,2,12,186,
+4,190,81,167,149,252,207,5,182,251,70,24,1,39,66,3,57,0,0,1,0,174,0,0,4,106,
+4,74,0,10,0,0,33,35,17,51,1,17,51,17,35,53,1,1,98,180,180,2,84,180,180,253,
+172,4,74,253,88,2,168,251,182,170,2,147,0,1,0,78,255,70,4,112,5,182,0,40,
+0,0,1,32,4,21,20,4,5,21,54,54,55,55,50,55,50,22,21,35,38,38,35,33,53,36,36,
+53,52,38,35,35,53,1,53,6,6,35,35,53,33,21,1,1,213,1,61,1,27,254,235,254,252,
+23,77,41,78,37,30,193,125,177,2,67,108,253,64,1,61,1,205,193,231,231,2,86,
+84,233,152,228,3,181,253,186,3,121,157,171,145,207,53,9,3,7,2,4,1,168,182,
+95,91,164,30,200,147,110,90,138,1,178,4,10,9,164,147,254,92,0,0,1,0,84,255,
+70,3,158,4,74,0,42,0,0,51,53,54,36,54,53,52,38,35,35,53,55,54,55,53,6,35,
+33,53,33,21,1,21,50,22,21,20,6,7,21,55,54,51,51,50,22,22,23,35,52,38,38,35,
+90,165,1,33,148,165,175,168,246,116,107,126,148,254,217,3,6,254,57,235,232,
+204,199,34,86,52,37,98,103,45,4,164,36,85,90,135,12,78,110,75,80,73,123,156,
+71,43,9,7,140,146,254,246,6,115,125,131,156,32,8,4,10,47,106,160,80,76,30,
+0,2,0,125,255,236,5,195,5,205,0,11,0,23,0,0,1,16,0,33,32,0,17,16,0,33,32,
+0,1,16,18,51,50,18,17,16,2,35,34,2,5,195,254,157,254,193,254,189,254,159,
+1,95,1,71,1,62,1,98,251,124,246,236,235,244,242,235,238,246,2,221,254,161,
+254,110,1,139,1,104,1,101,1,137,254,113,254,159,254,222,254,208,1,44,1,38,
+1,37,1,41,254,211,0,2,0,113,255,236,4,104,4,94,0,12,0,23,0,0,1,16,0,35,34,
+38,2,53,16,0,51,50,0,1,20,22,51,50,54,53,52,38,35,32,4,104,254,240,240,149,
+230,124,1,12,242,232,1,17,252,195,163,159,157,164,165,159,254,193,2,39,254,
+243,254,210,139,1,4,172,1,12,1,43,254,207,254,250,207,215,215,207,207,209,
+0,1,0,199,0,0,5,16,5,182,0,7,0,0,33,35,17,33,17,35,17,33,5,16,182,253,37,
+184,4,73,5,20,250,236,5,182,0,1,0,174,0,0,4,78,4,74,0,7,0,0,33,35,17,33,17,
+35,17,33,1,98,180,3,160,180,253,200,4,74,251,182,3,176,0,2,0,199,0,0,4,111,
+5,182,0,9,0,18,0,0,1,20,4,33,35,17,35,17,33,32,1,51,50,54,53,52,38,35,35,
+4,111,254,206,254,234,168,184,1,131,2,37,253,16,147,218,196,182,193,186,4,
+8,224,239,253,199,5,182,253,33,141,156,141,140,0,0,2,0,176,254,20,3,236,4,
+74,0,10,0,19,0,0,1,20,4,35,35,17,35,17,33,50,22,1,51,50,54,53,52,38,35,35,
+3,236,254,252,228,158,182,1,117,216,239,253,122,148,152,159,153,142,164,2,
+174,204,230,253,24,6,54,219,254,30,143,140,131,141,0,1,0,125,255,236,4,207,
+5,203,0,23,0,0,1,34,0,17,16,0,51,50,55,21,6,6,35,32,0,17,52,18,36,51,50,23,
+7,38,3,57,236,254,242,1,6,242,156,195,93,172,112,254,189,254,163,167,1,63,
+216,232,172,74,175,5,41,254,196,254,238,254,229,254,205,58,160,34,25,1,137,
+1,104,226,1,84,184,86,156,80,0,1,0,113,255,236,3,147,4,94,0,22,0,0,5,34,0,
+17,16,0,51,50,22,23,7,38,35,34,6,21,20,22,51,50,55,21,6,2,102,237,254,248,
+1,11,247,80,157,51,55,139,98,166,158,158,155,145,140,114,20,1,35,1,16,1,20,
+1,43,33,26,150,52,209,207,199,211,64,160,59,0,1,0,23,0,0,4,203,5,182,0,15,
+0,0,1,32,17,35,52,35,35,17,35,17,35,34,21,35,16,33,3,168,1,35,176,125,209,
+185,208,125,176,1,34,5,182,254,219,131,250,236,5,20,131,1,37,0,0,1,0,33,0,
+0,4,104,4,74,0,17,0,0,1,50,22,21,35,52,35,35,17,35,17,35,34,21,35,52,54,51,
+3,117,116,127,161,97,198,183,198,96,162,127,116,4,74,124,124,96,252,78,3,
+178,96,123,125,0,0,1,0,0,0,0,4,135,5,182,0,8,0,0,1,1,51,1,17,35,17,1,51,2,
+68,1,125,198,254,25,185,254,25,201,2,231,2,207,252,129,253,201,2,47,3,135,
+0,1,255,170,254,20,4,102,4,74,0,8,0,0,1,51,1,17,35,17,1,51,1,3,141,217,253,
+252,180,253,252,217,1,133,4,74,252,200,253,2,2,254,3,56,253,121,0,3,0,104,
+255,236,6,4,5,203,0,25,0,34,0,43,0,0,1,51,21,51,50,22,22,21,20,2,4,35,35,
+21,35,53,35,34,36,2,53,52,54,54,51,51,19,51,50,54,53,52,38,43,3,34,6,21,20,
+22,51,51,2,219,182,68,174,253,132,148,254,250,178,39,182,43,178,254,251,145,
+136,254,172,65,182,25,197,219,203,182,56,182,55,181,204,218,200,22,5,203,
+180,139,248,158,165,254,254,130,225,225,133,1,5,159,155,249,141,252,77,215,
+189,180,207,209,178,189,215,0,0,3,0,111,254,20,5,92,6,20,0,17,0,23,0,28,0,
+0,1,20,0,5,17,35,17,38,0,53,52,0,37,17,51,17,22,0,5,16,5,17,6,6,5,16,37,17,
+36,5,92,254,225,255,0,176,252,254,222,1,32,1,4,170,253,1,34,251,207,1,104,
+188,172,3,119,254,155,1,101,2,37,245,254,212,20,254,36,1,220,21,1,44,244,
+250,1,39,20,1,186,254,70,25,254,212,240,254,131,37,3,66,19,211,186,1,119,
+39,252,192,39,0,0,1,0,8,0,0,4,168,5,182,0,11,0,0,33,35,1,1,35,1,1,51,1,1,
+51,1,4,168,209,254,125,254,119,195,1,230,254,57,205,1,102,1,105,194,254,60,
+2,123,253,133,2,250,2,188,253,195,2,61,253,72,0,1,0,37,0,0,4,23,4,74,0,11,
+0,0,1,1,51,1,1,51,1,1,35,1,1,35,1,178,254,133,205,1,27,1,24,203,254,133,1,
+144,205,254,213,254,209,203,2,49,2,25,254,98,1,158,253,231,253,207,1,182,
+254,74,0,1,0,98,0,0,6,74,5,182,0,24,0,0,33,35,17,36,0,17,53,51,21,20,18,23,
+17,51,17,54,18,53,53,51,21,20,2,4,7,3,174,180,254,201,254,159,185,254,225,
+180,228,251,189,162,254,211,205,1,209,17,1,108,1,45,131,111,244,254,221,9,
+3,71,252,185,19,1,21,244,115,133,184,254,210,181,13,0,0,1,0,80,254,20,5,74,
+4,74,0,24,0,0,1,51,17,54,54,53,53,51,21,20,2,6,7,17,35,17,36,0,17,53,51,21,
+20,22,23,2,115,174,188,185,180,139,248,166,174,254,250,254,227,178,183,186,
+4,74,253,53,13,228,222,98,115,173,254,239,150,10,253,53,2,203,16,1,64,1,16,
+113,94,221,240,6,0,1,0,125,255,236,7,197,5,217,0,43,0,0,1,22,18,21,20,2,6,
+35,34,38,39,35,2,33,34,38,2,53,16,37,23,6,2,21,20,18,22,51,50,54,17,17,51,
+17,16,22,51,50,54,18,53,52,2,39,6,43,199,211,134,249,166,144,200,39,6,102,
+254,231,163,246,134,1,174,104,176,166,89,163,105,156,133,184,139,152,102,
+163,91,182,168,5,217,118,254,115,251,229,254,171,181,164,145,254,203,177,
+1,78,228,2,22,240,123,106,254,194,227,175,254,252,137,245,1,5,3,0,253,0,254,
+247,241,137,1,3,176,224,1,85,96,0,0,1,0,113,255,236,6,23,4,123,0,43,0,0,1,
+6,6,21,20,22,51,50,54,53,17,51,17,20,22,51,50,54,54,53,16,39,55,22,18,21,
+20,2,6,35,34,38,39,35,6,6,35,34,38,2,53,52,18,55,2,14,123,110,124,109,108,
+116,172,109,97,70,115,65,227,133,120,155,107,195,127,114,152,30,7,40,153,
+124,115,181,101,142,142,4,23,97,242,161,190,218,168,152,2,67,253,189,147,
+173,102,188,124,1,36,202,100,100,254,198,155,182,254,239,143,114,115,121,
+108,137,1,1,173,189,1,48,107,0,0,1,0,20,1,162,5,25,4,205,0,7,0,0,1,17,33,
+21,33,53,33,17,2,217,2,64,250,251,2,19,4,205,253,135,178,178,2,121,0,1,0,
+20,1,10,3,248,3,213,0,7,0,0,1,17,33,21,33,53,33,17,2,88,1,160,252,28,1,152,
+3,213,253,227,174,174,2,29,0,2,0,68,0,0,4,29,5,182,0,6,0,18,0,0,1,51,1,1,
+35,1,53,5,52,54,51,50,22,21,20,6,35,34,38,2,238,249,253,19,3,4,252,253,66,
+2,204,79,57,59,74,75,58,62,74,5,182,253,70,253,4,2,172,145,59,69,64,71,62,
+61,70,68,0,2,0,158,0,0,4,2,4,74,0,6,0,18,0,0,1,33,1,1,33,1,53,5,52,54,51,
+50,22,21,20,6,35,34,38,2,150,1,10,253,162,2,110,255,0,253,238,2,108,71,54,
+57,66,68,55,54,71,4,74,254,6,253,176,2,6,148,84,65,58,65,58,58,65,60,0,3,
+0,57,0,0,4,207,5,182,0,3,0,7,0,11,0,0,19,33,21,33,17,33,21,33,1,21,33,53,
+57,4,150,251,106,4,150,251,106,4,150,251,106,3,51,164,3,39,162,251,142,162,
+162,0,0,3,0,70,0,0,4,27,4,74,0,3,0,7,0,11,0,0,19,33,21,33,17,33,21,33,1,21,
+33,53,70,3,213,252,43,3,213,252,43,3,213,252,43,2,121,156,2,109,158,252,242,
+158,158,0,0,1,0,78,255,70,4,112,5,182,0,15,0,0,37,33,50,22,21,35,38,38,35,
+33,53,1,1,53,1,21,1,53,2,6,180,129,177,2,67,108,253,64,3,28,253,44,3,159,
+164,163,187,95,91,188,2,101,1,196,209,253,183,140,0,1,0,66,255,70,3,160,4,
+74,0,17,0,0,37,33,50,22,22,23,35,52,38,38,35,33,53,1,1,53,1,21,1,41,1,88,
+112,115,55,5,164,27,58,79,253,234,2,116,253,201,2,219,139,51,113,161,84,74,
+28,139,1,205,1,57,185,254,102,156,0,1,0,20,4,96,5,25,5,18,0,3,0,0,1,33,53,
+33,5,25,250,251,5,5,4,96,178,0,0,1,0,20,3,10,3,248,3,184,0,3,0,0,1,33,53,
+33,3,248,252,28,3,228,3,10,174,0,0,3,0,199,0,0,5,135,5,182,0,3,0,7,0,11,0,
+0,33,17,51,17,33,17,51,17,1,51,17,35,2,211,164,253,80,161,3,125,162,162,5,
+182,250,74,5,182,250,74,5,182,250,74,0,3,0,174,0,0,4,248,4,74,0,3,0,7,0,11,
+0,0,33,17,51,17,33,17,51,17,1,51,17,35,2,133,156,253,141,158,3,14,158,158,
+4,74,251,182,4,74,251,182,4,74,251,182,0,1,0,199,0,0,6,115,5,182,0,23,0,0,
+51,17,51,17,33,17,51,17,33,17,51,17,51,21,35,17,35,17,33,17,35,17,33,17,199,
+161,1,107,164,1,110,162,236,236,162,254,146,164,254,149,5,182,253,121,2,135,
+253,121,2,135,253,121,147,253,100,2,156,253,100,2,156,253,100,0,0,1,0,174,
+0,0,5,221,4,74,0,23,0,0,51,17,51,17,33,17,51,17,33,17,51,17,51,21,35,17,35,
+17,33,17,35,17,33,17,174,158,1,57,156,1,57,158,229,229,158,254,199,156,254,
+199,4,74,254,51,1,205,254,51,1,205,254,51,148,254,23,1,233,254,23,1,233,254,
+23,0,0,2,0,4,254,178,4,201,5,182,0,17,0,26,0,0,37,33,17,35,17,33,53,33,17,
+33,32,17,20,4,33,35,17,33,1,51,50,54,53,52,38,35,35,4,27,253,190,184,254,
+227,1,29,1,131,2,37,254,206,254,234,168,2,66,253,190,148,218,195,181,194,
+186,133,254,45,1,211,160,4,145,254,82,224,239,254,236,1,178,142,155,141,140,
+0,0,2,255,252,254,20,3,252,4,74,0,18,0,27,0,0,1,20,4,35,35,21,33,21,33,17,
+35,17,35,53,51,17,33,50,22,1,51,50,54,53,52,38,35,35,3,252,254,252,228,157,
+1,110,254,146,182,197,197,1,116,216,239,253,123,147,152,160,153,142,164,2,
+174,204,230,221,146,254,135,1,121,146,4,43,219,254,30,143,140,131,141,0,0,
+4,0,125,254,113,7,197,8,90,0,11,0,23,0,35,0,91,0,0,1,33,17,51,17,33,21,33,
+21,35,53,33,19,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,
+35,34,38,1,34,38,2,53,16,37,23,6,2,21,20,18,22,51,50,54,17,17,51,17,16,22,
+51,50,54,18,53,52,2,39,55,22,18,21,16,2,0,33,34,39,53,22,51,50,36,55,39,6,
+6,35,34,38,39,35,2,2,133,1,78,145,1,78,254,178,145,254,178,14,56,41,46,50,
+58,38,41,56,2,78,56,38,39,58,58,39,38,56,253,187,163,246,134,1,174,104,176,
+166,89,163,105,156,133,184,139,152,109,160,87,182,168,135,199,211,195,254,
+140,254,255,124,76,86,112,187,1,17,89,6,70,143,94,127,175,40,6,102,7,57,1,
+25,254,231,137,143,143,1,70,53,47,54,46,53,50,50,53,53,47,47,53,53,50,50,
+248,43,177,1,78,228,2,22,240,123,106,254,194,227,175,254,252,137,245,1,5,
+3,0,253,0,254,247,241,133,1,1,182,224,1,85,96,117,118,254,115,251,254,165,
+254,1,254,240,26,164,27,172,179,6,78,63,154,155,254,203,0,4,0,113,254,123,
+6,23,7,6,0,11,0,23,0,35,0,89,0,0,1,33,17,51,17,33,21,33,21,35,53,33,19,52,
+54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,1,16,2,4,
+35,34,39,53,22,51,50,54,55,39,6,6,35,34,39,35,6,6,35,34,38,2,53,52,18,55,
+23,6,6,21,20,22,51,50,54,53,17,51,17,20,22,51,50,54,54,53,16,39,55,4,1,172,
+1,78,145,1,78,254,178,145,254,178,14,56,41,46,50,58,38,41,56,2,78,56,38,39,
+58,58,39,38,56,2,15,157,254,211,186,88,63,59,90,149,201,76,6,48,112,75,197,
+63,7,35,161,125,115,181,101,142,142,129,123,110,124,109,107,117,172,109,97,
+70,115,65,227,133,1,19,5,229,1,25,254,231,137,143,143,1,70,53,47,54,46,53,
+50,50,53,53,47,47,53,53,50,50,251,180,254,236,254,91,237,20,164,18,148,171,
+4,58,62,233,108,125,137,1,1,173,189,1,48,107,100,97,242,161,190,218,170,148,
+2,129,253,127,152,166,100,187,127,1,36,202,100,229,0,1,0,72,255,236,4,59,
+5,182,0,26,0,0,1,30,2,21,20,4,33,32,39,53,22,22,51,50,54,53,52,38,35,35,53,
+1,33,53,33,21,2,84,139,224,124,254,202,254,233,254,253,163,100,226,98,199,
+196,202,193,127,1,166,253,90,3,141,3,133,4,114,199,131,224,249,79,168,48,
+48,168,156,142,155,133,1,157,164,145,0,0,1,0,29,254,123,3,182,4,74,0,23,0,
+0,1,22,4,21,20,0,35,34,39,53,22,51,50,54,53,16,33,35,53,1,33,53,33,21,1,190,
+243,1,5,254,204,251,207,155,187,183,170,201,254,78,100,1,192,253,141,3,70,
+2,16,4,231,205,214,254,249,67,164,82,176,148,1,45,125,1,180,152,131,0,0,1,
+0,29,0,0,3,104,5,182,0,3,0,0,1,1,35,1,3,104,253,101,176,2,155,5,182,250,74,
+5,182,0,0,1,0,20,0,0,2,246,4,74,0,3,0,0,1,1,35,1,2,246,253,207,177,2,50,4,
+74,251,182,4,74,0,0,1,0,80,255,53,4,86,5,203,0,46,0,0,1,33,54,53,52,38,35,
+34,6,21,20,22,23,7,38,38,53,52,54,54,51,50,22,22,21,20,7,51,21,35,6,5,22,
+22,51,50,55,21,6,6,35,32,0,3,36,55,35,1,174,1,121,82,171,147,141,160,24,17,
+170,29,32,126,230,148,155,226,120,69,94,180,185,254,89,37,241,205,145,97,
+49,148,49,254,211,254,155,43,1,135,191,252,2,193,116,162,160,178,143,125,
+35,85,30,65,48,120,53,127,192,105,116,213,138,171,140,127,218,108,145,134,
+31,172,15,20,1,28,1,17,81,143,0,1,0,102,254,238,3,229,4,94,0,44,0,0,1,33,
+54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,20,7,51,21,35,6,
+4,7,18,33,50,54,55,21,6,6,35,32,36,3,36,55,35,1,102,1,111,61,122,113,116,
+128,37,160,55,106,195,133,190,216,47,75,153,80,254,250,209,65,1,111,61,153,
+48,56,159,72,254,249,254,219,42,1,80,162,242,1,254,88,127,114,132,112,105,
+59,62,62,89,98,101,165,94,205,182,123,98,115,87,129,48,255,0,29,24,153,22,
+27,245,1,4,65,99,0,0,1,0,92,255,236,4,66,5,203,0,26,0,0,1,52,38,35,34,6,21,
+20,22,23,7,38,36,53,52,36,51,50,0,17,16,2,4,33,53,32,0,3,131,165,156,140,
+159,163,172,39,224,254,253,1,10,220,245,1,11,210,254,103,254,244,1,73,1,111,
+3,76,232,251,151,129,134,152,28,155,27,241,194,201,242,254,188,254,219,254,
+245,254,113,220,167,1,99,0,0,1,0,104,254,23,4,66,4,94,0,28,0,0,1,52,38,35,
+34,6,21,20,22,23,7,38,38,53,52,54,54,51,50,0,17,16,2,4,35,53,50,36,18,3,131,
+165,152,132,159,160,180,64,238,225,120,223,141,240,1,6,227,254,104,242,196,
+1,59,175,1,223,238,250,171,141,135,167,48,155,58,241,190,134,219,126,254,
+183,254,210,254,232,254,68,252,163,201,1,110,0,0,1,0,78,255,236,4,70,5,203,
+0,39,0,0,1,20,6,7,21,22,22,21,20,4,33,32,39,53,22,22,51,50,54,53,52,38,35,
+35,53,51,50,54,53,52,38,35,34,6,7,39,54,33,50,4,4,39,182,164,186,191,254,
+202,254,232,254,249,163,99,227,98,198,201,226,224,209,198,217,215,159,135,
+114,183,109,88,211,1,29,225,1,2,4,96,142,181,25,8,25,180,145,205,229,79,168,
+47,49,146,137,131,135,154,145,123,106,123,54,71,125,152,196,0,0,1,0,57,254,
+123,3,186,4,94,0,38,0,0,1,20,6,7,21,22,22,21,20,4,35,34,39,53,22,51,50,54,
+53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,51,50,22,3,133,155,142,
+168,182,254,224,254,200,155,187,170,175,183,200,214,92,94,180,187,124,116,
+85,150,96,80,178,231,196,220,2,242,135,174,25,8,23,180,150,206,242,67,164,
+82,154,143,138,133,153,131,129,106,120,50,71,123,149,190,0,1,0,14,254,178,
+4,168,5,182,0,18,0,0,19,35,1,51,32,17,20,4,33,35,53,51,50,54,53,52,38,35,
+35,195,181,1,150,223,2,37,254,208,254,232,82,62,218,195,181,193,60,254,178,
+7,4,254,82,223,240,158,142,155,141,140,0,1,255,209,254,23,4,31,4,76,0,18,
+0,0,19,35,1,51,32,17,20,4,33,35,53,51,50,54,53,52,38,35,35,131,178,1,108,
+228,1,254,254,230,254,251,72,54,198,178,170,165,70,254,23,6,53,254,98,211,
+225,143,138,145,142,132,0,1,0,199,0,0,3,254,5,182,0,5,0,0,51,17,51,17,33,
+21,199,184,2,127,5,182,250,238,164,0,0,1,0,174,0,0,3,86,4,74,0,5,0,0,19,51,
+17,33,21,33,174,180,1,244,253,88,4,74,252,76,150,0,0,1,0,82,255,236,4,55,
+5,203,0,27,0,0,1,20,22,51,50,54,53,52,38,39,55,22,4,21,20,4,35,34,38,2,53,
+16,18,36,33,21,32,0,1,16,165,157,140,159,167,173,43,226,1,1,254,244,217,160,
+230,122,210,1,154,1,11,254,180,254,147,2,106,232,251,151,130,134,151,28,156,
+29,243,191,204,238,141,1,18,201,1,13,1,143,219,168,254,156,0,1,0,106,255,
+236,4,66,5,231,0,30,0,0,1,20,22,51,50,54,53,52,38,38,39,55,30,2,21,20,6,6,
+35,34,2,17,16,18,36,51,21,34,4,2,1,37,157,162,135,162,69,138,137,56,180,197,
+92,121,221,142,249,251,219,1,151,249,204,254,200,172,2,74,225,230,166,137,
+84,119,83,38,149,43,121,178,119,131,214,121,1,49,1,37,1,16,1,168,237,165,
+182,254,167,0,0,1,0,23,254,178,2,119,5,197,0,15,0,0,19,54,36,51,50,23,21,
+38,35,34,6,7,33,17,35,17,23,13,1,2,210,79,48,48,75,119,150,20,1,14,184,3,
+229,227,253,11,149,12,99,93,250,65,5,51,0,1,0,39,254,20,2,84,4,84,0,14,0,
+0,19,54,54,51,50,23,21,38,35,34,7,51,17,35,17,39,16,234,188,68,51,44,71,198,
+43,254,181,2,147,214,235,8,148,11,164,250,245,4,127,0,0,2,255,244,254,170,
+4,152,5,182,0,10,0,26,0,0,23,50,54,53,53,35,34,6,21,20,22,37,20,6,35,34,38,
+53,52,54,51,51,17,51,17,33,21,246,55,51,37,77,74,48,1,69,157,149,113,130,
+171,163,30,185,2,127,184,78,77,29,48,54,41,41,184,166,176,130,112,123,141,
+5,18,250,238,164,0,2,255,244,254,180,3,248,4,74,0,15,0,25,0,0,33,20,6,35,
+34,38,53,52,54,51,51,17,51,17,33,21,5,50,53,53,35,34,6,21,20,22,2,14,155,
+146,113,124,180,164,14,180,1,234,252,248,106,37,77,74,48,161,171,122,110,
+120,132,3,178,252,78,152,186,157,29,48,54,41,43,0,0,1,0,199,0,0,5,16,5,182,
+0,7,0,0,19,51,17,33,17,51,17,33,199,182,2,219,184,251,183,5,182,250,236,5,
+20,250,74,0,0,1,0,174,0,0,4,78,4,74,0,7,0,0,1,51,17,33,17,51,17,33,3,154,
+180,252,96,180,2,56,4,74,251,182,4,74,252,80,0,3,0,33,0,0,6,100,5,182,0,20,
+0,29,0,37,0,0,1,3,51,1,30,2,51,21,33,34,38,53,51,20,22,51,19,37,55,5,1,50,
+23,55,38,39,38,39,3,19,23,22,23,55,38,39,3,3,86,154,205,1,240,35,55,68,77,
+250,219,145,141,174,68,102,201,254,231,61,1,13,1,101,147,104,4,56,167,54,
+251,152,201,254,121,131,4,48,69,215,4,113,1,69,251,164,78,74,32,162,139,152,
+72,57,1,151,166,94,159,254,4,8,4,27,109,35,154,254,191,1,170,160,74,108,4,
+62,167,1,236,0,0,3,0,20,0,0,5,47,4,74,0,19,0,25,0,33,0,0,1,3,51,1,30,2,51,
+21,33,34,53,51,20,22,51,19,39,55,23,19,5,55,38,37,7,19,22,22,23,55,39,39,
+3,2,158,133,194,1,141,26,50,62,61,251,189,216,154,51,74,156,172,51,168,155,
+1,52,2,82,254,213,109,156,81,144,107,4,52,28,135,3,61,1,13,252,202,52,55,
+24,145,244,51,48,1,29,96,86,96,254,141,4,4,38,173,211,1,48,48,86,73,4,97,
+56,1,27,0,2,0,106,255,236,4,119,6,27,0,33,0,46,0,0,1,46,2,53,52,54,51,50,
+23,7,38,35,34,6,21,20,30,2,23,30,2,21,20,6,6,35,34,36,53,52,54,1,52,38,39,
+14,2,21,20,22,51,50,54,2,6,117,110,55,233,184,209,228,70,185,188,102,123,
+38,74,108,69,163,177,92,127,241,161,228,254,232,208,2,130,126,156,143,154,
+82,173,144,162,182,3,143,60,97,114,75,133,173,117,152,107,83,65,47,67,56,
+54,34,78,151,185,118,142,220,121,252,206,166,241,254,128,113,173,82,40,101,
+146,100,137,166,175,0,0,2,0,111,255,236,4,102,6,20,0,30,0,42,0,0,1,38,38,
+53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,22,22,21,20,0,35,34,36,53,
+52,18,1,52,38,39,6,6,21,20,22,51,50,54,2,27,139,115,199,169,104,190,128,78,
+101,164,87,82,96,109,165,213,172,254,242,242,229,254,238,224,2,93,119,139,
+189,194,170,145,158,168,3,166,79,159,98,132,154,46,64,141,56,48,76,65,69,
+107,91,117,244,157,236,254,245,248,210,179,1,1,254,119,124,178,73,45,214,
+161,138,169,181,0,1,0,199,0,0,3,248,5,182,0,7,0,0,37,33,21,33,17,33,21,33,
+1,127,2,121,252,207,3,49,253,135,162,162,5,182,162,0,0,1,0,174,0,0,3,127,
+4,74,0,7,0,0,37,33,21,33,17,33,21,33,1,88,2,39,253,47,2,209,253,217,150,150,
+4,74,150,0,0,2,0,143,254,178,6,39,5,203,0,8,0,30,0,0,1,54,54,53,52,38,35,
+34,17,39,52,54,51,32,17,20,2,4,7,17,35,17,36,0,17,17,51,17,20,22,23,3,158,
+226,232,111,116,231,185,225,195,1,158,153,254,222,206,185,254,222,254,204,
+185,216,197,2,4,12,245,222,170,160,254,201,12,210,247,254,33,182,254,228,
+167,13,253,76,2,180,16,1,52,1,20,1,248,254,21,206,238,11,0,2,0,135,254,20,
+5,125,4,94,0,9,0,31,0,0,1,54,54,53,52,38,35,34,6,21,39,52,54,51,50,22,21,
+20,0,5,17,35,17,38,0,53,17,51,17,20,22,23,3,61,186,210,104,93,92,107,174,
+198,177,184,191,254,208,254,240,174,242,254,234,178,166,176,1,6,17,220,181,
+134,155,136,139,2,199,223,219,221,238,254,197,21,253,172,2,84,16,1,41,247,
+1,178,254,108,204,206,20,0,0,2,0,92,254,178,4,231,5,182,0,28,0,38,0,0,5,36,
+17,52,38,39,17,20,6,35,34,38,53,52,0,55,53,33,53,33,21,33,21,22,18,21,16,
+0,5,19,50,54,53,17,6,6,21,20,22,1,193,2,112,147,119,186,166,165,190,1,19,
+248,253,237,4,133,254,70,212,236,254,90,254,128,14,85,75,163,175,95,170,74,
+2,26,151,242,48,254,196,190,211,216,191,218,1,1,9,243,162,162,249,55,254,
+187,239,254,180,254,115,37,2,152,117,122,1,80,8,178,150,108,131,0,0,2,0,82,
+254,23,4,92,4,74,0,29,0,39,0,0,1,36,17,52,38,39,21,20,6,35,34,38,53,52,54,
+55,53,33,53,33,21,33,21,22,18,21,20,2,4,7,19,50,54,53,17,6,6,21,20,22,1,129,
+2,37,121,96,188,138,142,167,250,207,254,98,3,217,254,119,189,210,169,254,
+184,234,14,69,71,129,154,80,254,184,62,1,205,123,199,44,248,135,190,183,151,
+173,229,15,207,152,152,215,57,254,247,204,191,254,217,184,24,2,116,94,84,
+1,11,8,139,115,75,108,0,1,0,174,254,115,4,47,4,74,0,17,0,0,1,7,17,35,17,51,
+17,7,51,55,55,1,51,9,2,39,1,1,221,125,178,178,8,8,61,70,1,95,210,254,68,1,
+215,253,254,106,1,129,2,0,109,254,109,4,74,254,157,178,78,84,1,115,254,43,
+253,174,254,80,131,1,67,0,0,2,0,41,254,178,5,152,5,182,0,41,0,50,0,0,1,53,
+38,38,39,35,6,7,7,35,54,55,3,51,3,18,23,17,33,32,17,20,4,35,35,17,54,55,3,
+51,3,22,22,23,35,38,38,39,35,6,7,21,17,51,50,54,53,52,38,35,35,2,25,102,136,
+27,2,11,45,24,149,86,66,9,185,9,55,122,1,178,1,205,254,255,239,215,117,71,
+4,182,12,24,68,33,151,40,22,4,4,80,178,213,159,148,144,143,233,254,178,170,
+23,151,121,89,130,72,208,253,1,21,254,235,254,255,50,5,188,254,158,188,201,
+253,51,64,235,1,21,254,235,130,253,78,133,106,52,241,48,176,4,187,105,114,
+109,100,0,2,0,102,254,178,5,109,5,182,0,21,0,30,0,0,5,35,17,33,17,33,32,17,
+20,4,35,35,21,33,17,35,17,35,17,35,17,35,1,51,50,54,53,52,38,35,35,1,27,181,
+1,136,1,178,1,205,254,255,239,215,1,137,180,213,184,211,1,139,213,159,148,
+144,143,233,178,3,6,3,98,254,158,188,201,123,252,250,2,108,252,248,3,8,1,
+179,105,114,109,100,0,4,0,98,254,174,6,145,5,182,0,17,0,26,0,47,0,69,0,0,
+19,33,17,33,32,17,20,4,35,35,21,33,21,33,17,35,17,33,1,51,50,54,53,52,38,
+35,35,1,34,38,53,52,54,51,50,23,7,38,35,34,21,20,22,51,50,55,21,6,33,34,38,
+53,52,54,51,50,23,7,38,35,34,21,20,22,51,50,55,21,6,6,109,2,155,1,178,1,205,
+255,0,239,215,2,208,253,48,185,253,101,3,84,213,159,148,145,142,233,253,243,
+162,176,183,163,110,95,45,95,69,188,92,90,91,110,79,3,112,162,176,183,163,
+113,92,45,100,64,189,93,90,92,108,42,91,2,100,3,82,254,158,187,202,107,147,
+252,225,3,31,1,156,105,114,109,100,249,149,188,173,179,191,45,117,37,245,
+116,124,47,125,43,188,173,179,191,45,117,37,245,116,124,47,125,23,20,0,2,
+0,25,254,178,5,37,5,182,0,17,0,26,0,0,19,33,17,33,32,17,20,4,35,35,21,33,
+21,33,17,35,17,33,1,51,50,54,53,52,38,35,35,25,1,141,1,178,1,205,254,255,
+239,215,1,156,254,100,184,254,115,2,69,213,159,148,144,142,234,2,18,3,164,
+254,158,188,201,189,147,253,51,2,205,1,238,105,114,109,100,0,0,2,0,16,254,
+178,5,37,5,182,0,23,0,32,0,0,37,1,51,23,17,33,32,17,20,4,35,35,17,55,51,1,
+1,35,39,17,35,17,7,35,1,51,50,54,53,52,38,35,35,1,158,254,125,213,182,1,178,
+1,205,254,255,239,215,185,227,254,104,1,131,213,178,184,195,211,2,78,213,
+159,148,144,142,234,217,1,123,201,4,43,254,158,188,201,254,188,201,254,133,
+254,117,207,254,149,1,113,213,4,31,105,114,109,100,0,0,2,0,113,255,236,8,
+25,4,74,0,34,0,44,0,0,5,34,0,17,16,55,33,22,22,21,16,0,35,34,0,17,16,0,51,
+33,50,22,23,7,38,35,34,6,21,16,33,50,55,21,6,1,16,33,50,54,53,16,33,34,6,
+6,236,242,254,252,147,254,70,72,81,254,243,243,230,254,239,1,11,243,4,137,
+79,152,58,56,136,101,164,160,1,57,145,140,114,249,151,1,66,158,163,254,188,
+167,152,20,1,28,1,12,1,31,127,56,214,135,254,247,254,216,1,45,1,4,1,11,1,
+34,32,28,149,51,200,205,254,112,64,160,59,2,49,254,100,207,205,1,149,210,
+0,5,0,82,1,100,6,57,5,115,0,3,0,15,0,25,0,37,0,46,0,0,1,33,53,33,17,20,6,
+35,34,38,53,52,54,51,50,22,5,20,51,50,53,52,38,35,34,6,7,20,6,35,34,38,53,
+52,54,51,50,22,5,20,51,50,53,52,35,34,6,6,57,250,25,5,231,191,171,171,190,
+188,175,170,190,253,203,203,203,97,104,106,99,223,193,170,170,190,188,174,
+169,192,253,203,202,203,201,106,98,1,100,179,1,219,182,205,200,187,185,200,
+206,179,252,252,116,134,133,117,183,204,200,187,185,200,205,180,252,252,250,
+134,0,5,0,70,0,205,4,119,3,231,0,3,0,15,0,23,0,35,0,43,0,0,37,33,53,33,17,
+20,6,35,34,38,53,52,54,51,50,22,5,20,51,50,53,52,35,34,7,20,6,35,34,38,53,
+52,54,51,50,22,5,20,51,50,53,52,35,34,4,119,251,207,4,49,139,119,114,140,
+137,121,115,139,254,135,121,123,123,121,184,139,119,114,140,137,121,115,139,
+254,135,121,123,123,121,205,174,1,94,132,144,149,127,130,140,147,123,164,
+164,158,158,132,144,149,127,130,140,147,123,164,164,158,0,3,0,199,0,0,5,78,
+5,182,0,9,0,12,0,15,0,0,19,51,1,1,51,17,35,1,1,35,55,9,2,17,1,199,213,1,116,
+1,134,184,215,254,141,254,119,180,170,1,59,254,197,3,49,254,198,5,182,253,
+180,2,76,250,74,2,72,253,184,246,1,221,1,242,252,45,3,188,254,49,0,3,0,174,
+0,0,4,156,4,74,0,9,0,12,0,15,0,0,19,51,1,1,51,17,35,1,1,35,55,19,3,1,17,3,
+174,209,1,43,1,57,185,209,254,213,254,194,180,162,246,246,2,168,244,4,74,
+254,82,1,174,251,182,1,168,254,88,205,1,80,1,98,253,76,2,164,254,184,0,1,
+252,57,4,139,255,131,5,186,0,15,0,0,1,50,22,21,35,52,38,35,33,34,38,53,51,
+20,22,51,254,193,103,91,111,46,56,254,78,104,91,111,47,55,5,88,92,113,56,
+43,91,113,55,43,0,1,252,84,4,123,254,129,5,203,0,7,0,0,1,51,21,33,21,33,21,
+35,252,84,106,1,195,254,61,106,5,203,115,106,115,0,0,1,252,84,4,123,254,129,
+5,203,0,7,0,0,1,35,53,33,53,33,53,51,254,129,106,254,61,1,195,106,4,123,115,
+106,115,0,0,1,0,199,255,236,5,90,6,182,0,39,0,0,1,54,51,50,22,21,20,7,51,
+32,0,17,20,2,4,35,34,38,53,17,51,17,20,22,51,50,0,53,52,36,33,35,53,55,54,
+53,52,35,35,7,1,209,22,52,103,93,94,39,1,75,1,103,189,254,181,219,218,214,
+184,113,153,241,1,30,254,245,254,238,162,29,69,75,16,15,6,178,4,95,79,109,
+137,254,179,254,206,198,254,194,163,165,185,3,43,252,252,132,100,1,21,233,
+250,244,153,43,99,67,78,2,0,1,0,174,255,236,4,123,6,25,0,40,0,0,1,54,51,50,
+22,21,20,6,7,51,50,0,21,20,2,4,35,32,17,17,51,17,20,22,51,50,54,54,53,52,
+38,35,35,53,55,54,53,52,38,35,35,1,172,20,74,85,95,44,52,12,250,1,23,153,
+254,242,181,254,143,180,99,118,120,176,94,218,219,96,32,75,42,38,27,6,20,
+5,99,82,55,137,90,254,233,250,176,254,238,139,1,59,2,149,253,142,102,99,106,
+194,122,207,198,142,48,110,83,41,45,0,0,2,0,49,0,82,6,125,4,127,0,13,0,27,
+0,0,1,6,35,34,38,53,52,54,51,50,22,23,1,7,1,6,35,34,38,53,52,54,51,50,22,
+23,1,7,3,96,40,56,63,78,80,63,51,80,37,2,211,125,251,31,42,55,63,78,81,63,
+51,79,37,2,211,125,3,133,31,78,64,65,74,41,45,252,143,102,3,51,31,78,64,65,
+74,41,45,252,143,102,0,2,0,51,0,82,4,61,4,127,0,13,0,25,0,0,55,39,1,54,54,
+51,50,22,21,20,6,35,34,39,1,52,54,51,50,22,21,20,6,35,34,38,176,125,2,211,
+37,80,51,63,80,78,63,56,40,254,178,65,60,61,68,68,61,59,66,82,102,3,113,45,
+41,74,65,63,79,31,253,98,68,70,72,66,64,75,72,0,0,2,0,49,0,82,4,59,4,127,
+0,13,0,25,0,0,1,6,35,34,38,53,52,54,51,50,22,23,1,7,37,20,6,35,34,38,53,52,
+54,51,50,22,1,31,42,55,63,78,81,63,51,79,37,2,211,125,254,175,67,58,60,69,
+67,62,60,65,3,133,31,78,64,65,74,41,45,252,143,102,149,65,74,75,64,65,73,
+72,0,2,0,51,0,82,6,127,4,127,0,13,0,27,0,0,55,39,1,54,54,51,50,22,21,20,6,
+35,34,39,3,39,1,54,54,51,50,22,21,20,6,35,34,39,176,125,2,211,37,80,51,63,
+80,78,63,56,40,94,125,2,211,37,80,51,63,80,78,63,55,42,82,102,3,113,45,41,
+74,65,63,79,31,252,205,102,3,113,45,41,74,65,63,79,31,0,0,1,0,61,0,33,2,135,
+4,43,0,23,0,0,1,34,6,21,20,22,23,22,21,20,6,35,53,50,54,53,52,38,39,38,53,
+52,54,51,2,135,136,132,30,42,71,236,225,146,139,34,37,72,233,211,3,150,80,
+88,39,74,64,108,113,156,163,153,75,83,47,88,57,106,101,152,172,0,0,3,0,72,
+0,0,3,33,2,37,0,13,0,24,0,35,0,0,33,35,52,39,38,38,53,53,51,20,22,23,22,21,
+37,52,51,50,22,21,20,6,35,34,38,37,52,51,50,22,21,20,6,35,34,38,2,84,139,
+100,53,48,147,48,49,96,253,244,96,40,58,58,40,42,54,2,22,96,39,60,60,39,42,
+54,141,124,64,109,58,53,60,110,59,120,137,197,105,48,57,56,50,50,66,105,50,
+55,54,54,54,0,0,1,0,100,3,246,2,18,5,115,0,8,0,0,1,38,39,53,51,22,22,23,21,
+1,227,186,197,31,122,210,67,3,246,186,19,176,23,127,96,135,0,1,252,204,4,
+217,0,0,5,106,0,3,0,0,1,33,21,33,252,204,3,52,252,204,5,106,145,0,0,1,0,0,
+4,217,3,52,5,106,0,3,0,0,17,33,21,33,3,52,252,204,5,106,145,0,0,1,253,128,
+4,217,2,128,5,106,0,3,0,0,1,33,21,33,253,128,5,0,251,0,5,106,145,0,0,1,254,
+172,6,166,1,84,7,5,0,3,0,0,1,33,21,33,254,172,2,168,253,88,7,5,95,0,0,1,253,
+228,6,166,2,28,7,5,0,3,0,0,1,33,21,33,253,228,4,56,251,200,7,5,95,0,0,1,252,
+254,6,166,3,2,7,5,0,3,0,0,1,33,21,33,252,254,6,4,249,252,7,5,95,0,0,1,252,
+154,6,166,3,102,7,5,0,3,0,0,1,33,21,33,252,154,6,204,249,52,7,5,95,0,0,1,
+251,180,6,166,4,76,7,5,0,3,0,0,1,33,21,33,251,180,8,152,247,104,7,5,95,0,
+0,1,0,0,254,183,0,211,255,156,0,11,0,0,21,52,54,51,50,22,21,20,6,35,34,38,
+61,45,42,63,63,42,45,61,214,60,54,54,60,59,56,56,0,2,253,128,4,217,2,128,
+5,206,0,3,0,7,0,0,1,33,21,33,53,33,21,33,253,128,5,0,251,0,5,0,251,0,5,36,
+75,245,75,0,0,1,254,172,4,217,1,84,5,106,0,3,0,0,1,33,21,33,254,172,2,168,
+253,88,5,106,145,0,0,1,253,228,4,217,2,28,5,106,0,3,0,0,1,33,21,33,253,228,
+4,56,251,200,5,106,145,0,0,1,252,254,4,217,3,2,5,107,0,3,0,0,1,33,21,33,252,
+254,6,4,249,252,5,107,146,0,0,1,252,154,4,217,3,102,5,107,0,3,0,0,1,33,21,
+33,252,154,6,204,249,52,5,107,146,0,0,1,251,180,4,217,4,76,5,107,0,3,0,0,
+1,33,21,33,251,180,8,152,247,104,5,107,146,0,0,2,254,172,4,217,1,84,5,206,
+0,3,0,7,0,0,1,33,21,33,53,33,21,33,254,172,2,168,253,88,2,168,253,88,5,36,
+75,245,75,0,0,2,253,228,4,217,2,28,5,206,0,3,0,7,0,0,1,33,21,33,53,33,21,
+33,253,228,4,56,251,200,4,56,251,200,5,36,75,245,75,0,0,2,252,254,4,217,3,
+2,5,206,0,3,0,7,0,0,1,33,21,33,53,33,21,33,252,254,6,4,249,252,6,4,249,252,
+5,36,75,245,75,0,0,2,252,154,4,217,3,102,5,206,0,3,0,7,0,0,1,33,21,33,53,
+33,21,33,252,154,6,204,249,52,6,204,249,52,5,36,75,245,75,0,0,2,251,180,4,
+217,4,76,5,206,0,3,0,7,0,0,1,33,21,33,53,33,21,33,251,180,8,152,247,104,8,
+152,247,104,5,36,75,245,75,0,0,1,252,204,6,166,0,0,7,55,0,3,0,0,1,33,21,33,
+252,204,3,52,252,204,7,55,145,0,0,1,0,0,6,166,3,52,7,55,0,3,0,0,17,33,21,
+33,3,52,252,204,7,55,145,0,0,1,253,128,6,166,2,128,7,55,0,3,0,0,1,33,21,33,
+253,128,5,0,251,0,7,55,145,0,0,1,254,172,6,166,1,84,7,5,0,3,0,0,1,33,21,33,
+254,172,2,168,253,88,7,5,95,0,0,1,253,228,6,166,2,28,7,5,0,3,0,0,1,33,21,
+33,253,228,4,56,251,200,7,5,95,0,0,1,252,254,6,166,3,2,7,5,0,3,0,0,1,33,21,
+33,252,254,6,4,249,252,7,5,95,0,0,1,252,154,6,166,3,102,7,5,0,3,0,0,1,33,
+21,33,252,154,6,204,249,52,7,5,95,0,0,1,251,180,6,166,4,76,7,5,0,3,0,0,1,
+33,21,33,251,180,8,152,247,104,7,5,95,0,0,2,253,128,6,166,2,128,7,155,0,3,
+0,7,0,0,1,33,21,33,53,33,21,33,253,128,5,0,251,0,5,0,251,0,6,241,75,245,75,
+0,0,1,254,172,6,166,1,84,7,55,0,3,0,0,1,33,21,33,254,172,2,168,253,88,7,55,
+145,0,0,1,253,228,6,166,2,28,7,55,0,3,0,0,1,33,21,33,253,228,4,56,251,200,
+7,55,145,0,0,1,252,254,6,166,3,2,7,56,0,3,0,0,1,33,21,33,252,254,6,4,249,
+252,7,56,146,0,0,1,252,154,6,166,3,102,7,56,0,3,0,0,1,33,21,33,252,154,6,
+204,249,52,7,56,146,0,0,1,251,180,6,166,4,76,7,56,0,3,0,0,1,33,21,33,251,
+180,8,152,247,104,7,56,146,0,0,2,254,172,6,166,1,84,7,155,0,3,0,7,0,0,1,33,
+21,33,53,33,21,33,254,172,2,168,253,88,2,168,253,88,6,241,75,245,75,0,0,2,
+253,228,6,166,2,28,7,155,0,3,0,7,0,0,1,33,21,33,53,33,21,33,253,228,4,56,
+251,200,4,56,251,200,6,241,75,245,75,0,0,2,252,254,6,166,3,2,7,155,0,3,0,
+7,0,0,1,33,21,33,53,33,21,33,252,254,6,4,249,252,6,4,249,252,6,241,75,245,
+75,0,0,2,252,154,6,166,3,102,7,155,0,3,0,7,0,0,1,33,21,33,53,33,21,33,252,
+154,6,204,249,52,6,204,249,52,6,241,75,245,75,0,0,2,251,180,6,166,4,76,7,
+155,0,3,0,7,0,0,1,33,21,33,53,33,21,33,251,180,8,152,247,104,8,152,247,104,
+6,241,75,245,75,0,0,1,253,128,6,166,2,128,7,5,0,3,0,0,1,33,21,33,253,128,
+5,0,251,0,7,5,95,0,0,16,0,50,0,25,5,168,5,141,0,7,0,15,0,23,0,31,0,39,0,47,
+0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,20,35,34,53,52,
+51,50,39,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,19,20,35,34,53,52,51,
+50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,
+20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,
+34,53,52,51,50,3,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,
+52,51,50,1,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,4,238,66,72,72,66,
+204,67,71,71,67,1,84,70,68,71,67,50,66,72,72,66,253,137,69,68,68,69,238,71,
+67,67,71,3,51,70,68,68,70,252,1,69,69,69,69,3,119,66,72,72,66,204,67,71,71,
+67,252,204,66,72,69,69,50,66,72,72,66,2,117,69,68,68,69,253,189,69,69,69,
+69,1,85,71,67,67,71,204,69,69,69,69,4,143,69,69,69,67,68,68,70,254,102,70,
+70,68,254,204,69,69,69,2,50,71,71,67,118,68,68,70,252,134,68,68,70,2,102,
+69,65,73,252,64,68,68,70,205,66,66,72,2,238,70,70,68,254,204,69,69,69,253,
+71,70,70,68,1,64,68,68,70,254,105,71,66,72,63,68,68,70,0,0,0,15,0,186,0,3,
+0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,1,4,9,0,2,0,14,0,126,
+0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,0,4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,
+0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,1,4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,
+8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,0,3,0,1,4,9,0,10,0,96,1,162,0,3,0,
+1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,60,2,64,0,3,0,1,4,9,0,13,2,150,2,124,
+0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,67,0,111,0,112,0,116,
+0,105,0,99,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,67,0,111,
+0,112,0,116,0,105,0,99,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,
+0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,
+115,0,67,0,111,0,112,0,116,0,105,0,99,0,78,0,111,0,116,0,111,0,32,0,105,0,
+115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,
+32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,
+99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,
+97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,
+0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,
+0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,
+0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,
+0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,
+0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,
+0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,
+0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,
+0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,
+0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,
+0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,
+99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,
+0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,
+0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,
+0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,
+0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,
+0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,
+0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,
+0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,
+102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,
+0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,
+0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,
+32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,
+111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,
+0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,
+0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,
+0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,
+1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,
+1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,
+1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,
+1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,
+1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,
+1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,
+1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,
+111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,
+1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,
+136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,
+1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,
+161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,
+1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,
+186,1,187,1,188,1,189,1,190,4,110,117,108,108,7,117,110,105,48,51,55,52,7,
+117,110,105,48,51,55,53,7,117,110,105,48,51,48,48,7,117,110,105,48,51,48,
+49,7,117,110,105,48,51,48,50,7,117,110,105,48,51,48,52,7,117,110,105,48,51,
+48,53,7,117,110,105,48,51,48,55,7,117,110,105,48,51,48,56,7,117,110,105,48,
+51,69,50,7,117,110,105,48,51,69,51,7,117,110,105,48,51,69,52,7,117,110,105,
+48,51,69,53,7,117,110,105,48,51,69,54,7,117,110,105,48,51,69,55,7,117,110,
+105,48,51,69,56,7,117,110,105,48,51,69,57,7,117,110,105,48,51,69,65,7,117,
+110,105,48,51,69,66,7,117,110,105,48,51,69,67,7,117,110,105,48,51,69,68,7,
+117,110,105,48,51,69,69,7,117,110,105,48,51,69,70,7,117,110,105,49,68,67,
+68,7,117,110,105,50,67,56,48,7,117,110,105,50,67,56,49,7,117,110,105,50,67,
+56,50,7,117,110,105,50,67,56,51,7,117,110,105,50,67,56,52,7,117,110,105,50,
+67,56,53,7,117,110,105,50,67,56,54,7,117,110,105,50,67,56,55,7,117,110,105,
+50,67,56,56,7,117,110,105,50,67,56,57,7,117,110,105,50,67,56,65,7,117,110,
+105,50,67,56,66,7,117,110,105,50,67,56,67,7,117,110,105,50,67,56,68,7,117,
+110,105,50,67,56,69,7,117,110,105,50,67,56,70,7,117,110,105,50,67,57,48,7,
+117,110,105,50,67,57,49,7,117,110,105,50,67,57,50,7,117,110,105,50,67,57,
+51,7,117,110,105,50,67,57,52,7,117,110,105,50,67,57,53,7,117,110,105,50,67,
+57,54,7,117,110,105,50,67,57,55,7,117,110,105,50,67,57,56,7,117,110,105,50,
+67,57,57,7,117,110,105,50,67,57,65,7,117,110,105,50,67,57,66,7,117,110,105,
+50,67,57,67,7,117,110,105,50,67,57,68,7,117,110,105,50,67,57,69,7,117,110,
+105,50,67,57,70,7,117,110,105,50,67,65,48,7,117,110,105,50,67,65,49,7,117,
+110,105,50,67,65,50,7,117,110,105,50,67,65,51,7,117,110,105,50,67,65,52,7,
+117,110,105,50,67,65,53,7,117,110,105,50,67,65,54,7,117,110,105,50,67,65,
+55,7,117,110,105,50,67,65,56,7,117,110,105,50,67,65,57,7,117,110,105,50,67,
+65,65,7,117,110,105,50,67,65,66,7,117,110,105,50,67,65,67,7,117,110,105,50,
+67,65,68,7,117,110,105,50,67,65,69,7,117,110,105,50,67,65,70,7,117,110,105,
+50,67,66,48,7,117,110,105,50,67,66,49,7,117,110,105,50,67,66,50,7,117,110,
+105,50,67,66,51,7,117,110,105,50,67,66,52,7,117,110,105,50,67,66,53,7,117,
+110,105,50,67,66,54,7,117,110,105,50,67,66,55,7,117,110,105,50,67,66,56,7,
+117,110,105,50,67,66,57,7,117,110,105,50,67,66,65,7,117,110,105,50,67,66,
+66,7,117,110,105,50,67,66,67,7,117,110,105,50,67,66,68,7,117,110,105,50,67,
+66,69,7,117,110,105,50,67,66,70,7,117,110,105,50,67,67,48,7,117,110,105,50,
+67,67,49,7,117,110,105,50,67,67,50,7,117,110,105,50,67,67,51,7,117,110,105,
+50,67,67,52,7,117,110,105,50,67,67,53,7,117,110,105,50,67,67,54,7,117,110,
+105,50,67,67,55,7,117,110,105,50,67,67,56,7,117,110,105,50,67,67,57,7,117,
+110,105,50,67,67,65,7,117,110,105,50,67,67,66,7,117,110,105,50,67,67,67,7,
+117,110,105,50,67,67,68,7,117,110,105,50,67,67,69,7,117,110,105,50,67,67,
+70,7,117,110,105,50,67,68,48,7,117,110,105,50,67,68,49,7,117,110,105,50,67,
+68,50,7,117,110,105,50,67,68,51,7,117,110,105,50,67,68,52,7,117,110,105,50,
+67,68,53,7,117,110,105,50,67,68,54,7,117,110,105,50,67,68,55,7,117,110,105,
+50,67,68,56,7,117,110,105,50,67,68,57,7,117,110,105,50,67,68,65,7,117,110,
+105,50,67,68,66,7,117,110,105,50,67,68,67,7,117,110,105,50,67,68,68,7,117,
+110,105,50,67,68,69,7,117,110,105,50,67,68,70,7,117,110,105,50,67,69,48,7,
+117,110,105,50,67,69,49,7,117,110,105,50,67,69,50,7,117,110,105,50,67,69,
+51,7,117,110,105,50,67,69,52,7,117,110,105,50,67,69,53,7,117,110,105,50,67,
+69,54,7,117,110,105,50,67,69,55,7,117,110,105,50,67,69,56,7,117,110,105,50,
+67,69,57,7,117,110,105,50,67,69,65,7,117,110,105,50,67,69,66,7,117,110,105,
+50,67,69,67,7,117,110,105,50,67,69,68,7,117,110,105,50,67,69,69,7,117,110,
+105,50,67,69,70,7,117,110,105,50,67,70,48,7,117,110,105,50,67,70,49,7,117,
+110,105,50,67,70,50,7,117,110,105,50,67,70,51,7,117,110,105,50,67,70,57,7,
+117,110,105,50,67,70,65,7,117,110,105,50,67,70,66,7,117,110,105,50,67,70,
+67,7,117,110,105,50,67,70,68,7,117,110,105,50,67,70,69,7,117,110,105,50,67,
+70,70,7,117,110,105,70,69,50,52,7,117,110,105,70,69,50,53,7,117,110,105,70,
+69,50,54,13,117,110,105,48,51,48,53,95,115,109,97,108,108,14,117,110,105,
+48,51,48,53,95,109,101,100,105,117,109,13,117,110,105,48,51,48,53,95,108,
+97,114,103,101,14,117,110,105,48,51,48,53,95,120,108,97,114,103,101,15,117,
+110,105,48,51,48,53,95,120,120,108,97,114,103,101,12,100,111,116,98,101,108,
+111,119,99,111,109,98,7,117,110,105,48,51,51,70,13,117,110,105,70,69,50,54,
+46,115,109,97,108,108,14,117,110,105,70,69,50,54,46,109,101,100,105,117,109,
+13,117,110,105,70,69,50,54,46,108,97,114,103,101,14,117,110,105,70,69,50,
+54,46,120,108,97,114,103,101,15,117,110,105,70,69,50,54,46,120,120,108,97,
+114,103,101,13,117,110,105,48,51,51,70,46,115,109,97,108,108,14,117,110,105,
+48,51,51,70,46,109,101,100,105,117,109,13,117,110,105,48,51,51,70,46,108,
+97,114,103,101,14,117,110,105,48,51,51,70,46,120,108,97,114,103,101,15,117,
+110,105,48,51,51,70,46,120,120,108,97,114,103,101,11,117,110,105,70,69,50,
+52,46,99,97,112,11,117,110,105,70,69,50,53,46,99,97,112,11,117,110,105,70,
+69,50,54,46,99,97,112,17,117,110,105,48,51,48,53,95,115,109,97,108,108,46,
+99,97,112,18,117,110,105,48,51,48,53,95,109,101,100,105,117,109,46,99,97,
+112,17,117,110,105,48,51,48,53,95,108,97,114,103,101,46,99,97,112,18,117,
+110,105,48,51,48,53,95,120,108,97,114,103,101,46,99,97,112,19,117,110,105,
+48,51,48,53,95,120,120,108,97,114,103,101,46,99,97,112,11,117,110,105,48,
+51,51,70,46,99,97,112,17,117,110,105,70,69,50,54,46,115,109,97,108,108,46,
+99,97,112,18,117,110,105,70,69,50,54,46,109,101,100,105,117,109,46,99,97,
+112,17,117,110,105,70,69,50,54,46,108,97,114,103,101,46,99,97,112,18,117,
+110,105,70,69,50,54,46,120,108,97,114,103,101,46,99,97,112,19,117,110,105,
+70,69,50,54,46,120,120,108,97,114,103,101,46,99,97,112,17,117,110,105,48,
+51,51,70,46,115,109,97,108,108,46,99,97,112,18,117,110,105,48,51,51,70,46,
+109,101,100,105,117,109,46,99,97,112,17,117,110,105,48,51,51,70,46,108,97,
+114,103,101,46,99,97,112,18,117,110,105,48,51,51,70,46,120,108,97,114,103,
+101,46,99,97,112,19,117,110,105,48,51,51,70,46,120,120,108,97,114,103,101,
+46,99,97,112,11,117,110,105,48,51,48,53,46,99,97,112,7,117,110,105,50,53,
+67,67,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,70,0,78,0,2,0,9,0,0,
+0,5,0,1,0,6,0,12,0,3,0,13,0,26,0,1,0,27,0,27,0,3,0,28,0,138,0,1,0,139,0,141,
+0,3,0,142,0,150,0,1,0,151,0,190,0,3,0,191,0,191,0,1,0,4,0,0,0,1,0,0,0,2,0,
+3,0,10,0,10,0,1,0,151,0,158,0,1,0,160,0,190,0,1,0,1,0,0,0,10,0,52,0,126,0,
+2,68,70,76,84,0,28,99,111,112,116,0,14,0,4,0,0,0,0,255,255,0,2,0,0,0,2,0,
+4,0,0,0,0,255,255,0,2,0,1,0,3,0,4,109,97,114,107,0,26,109,97,114,107,0,42,
+109,107,109,107,0,58,109,107,109,107,0,66,0,0,0,6,0,0,0,1,0,2,0,3,0,4,0,5,
+0,0,0,6,0,0,0,1,0,2,0,3,0,4,0,5,0,0,0,2,0,6,0,7,0,0,0,2,0,6,0,7,0,8,0,18,
+0,26,0,34,0,42,0,50,0,58,0,66,0,74,0,4,0,0,0,1,0,64,0,4,0,0,0,1,1,174,0,4,
+0,0,0,1,2,212,0,4,0,0,0,1,4,32,0,4,0,0,0,1,5,108,0,4,0,0,0,1,6,184,0,6,0,
+0,0,1,8,46,0,6,0,0,0,1,8,174,0,1,1,50,1,84,0,1,0,12,0,62,0,12,0,0,9,18,0,
+0,9,18,0,0,9,24,0,0,9,30,0,0,9,24,0,0,9,36,0,0,9,42,0,0,10,26,0,0,10,32,0,
+0,10,32,0,0,10,38,0,0,10,38,0,121,12,190,12,196,9,184,12,208,9,142,9,58,10,
+90,9,40,12,202,12,214,10,54,12,220,9,10,12,226,8,254,9,40,9,4,9,40,9,10,9,
+46,9,16,9,40,8,254,9,40,9,10,9,40,9,10,9,52,8,254,9,58,9,16,9,58,9,22,9,64,
+9,10,9,40,9,10,9,70,8,254,9,76,9,16,9,82,9,10,9,88,9,16,9,94,8,254,9,58,9,
+10,9,100,8,254,9,40,9,10,9,40,9,10,9,46,9,16,8,254,9,10,9,106,9,16,9,112,
+9,28,9,118,9,160,9,46,9,10,9,46,9,10,9,40,9,10,9,46,9,4,9,46,9,130,9,208,
+9,130,9,208,9,142,9,46,9,166,9,214,9,172,9,46,9,178,9,46,9,10,9,40,9,10,9,
+40,9,10,9,46,9,184,9,220,9,10,9,46,9,10,9,160,9,190,9,226,9,196,9,70,8,254,
+9,58,9,202,9,94,9,142,9,148,9,10,9,106,9,130,9,154,9,142,9,58,9,16,9,94,9,
+130,9,136,9,34,9,124,10,36,0,2,0,5,0,6,0,9,0,0,0,11,0,12,0,4,0,27,0,27,0,
+6,0,139,0,141,0,7,0,151,0,152,0,10,0,2,0,5,0,13,0,26,0,0,0,28,0,127,0,14,
+0,135,0,138,0,114,0,142,0,143,0,118,0,191,0,191,0,120,0,1,1,6,1,12,0,1,0,
+12,0,18,0,1,0,0,9,184,0,121,11,158,9,184,11,164,11,194,11,170,11,200,11,176,
+11,206,11,188,11,212,11,182,9,250,10,252,11,218,9,184,10,18,9,190,9,190,9,
+184,10,18,9,196,9,214,9,202,9,190,9,208,10,24,9,184,10,30,9,214,10,36,9,220,
+10,36,9,226,10,42,9,190,9,184,9,184,10,18,9,232,10,48,9,238,9,190,9,184,10,
+30,9,202,10,36,9,232,10,54,9,184,10,60,9,244,10,54,9,250,10,0,10,0,10,66,
+9,202,10,72,9,184,9,184,9,196,10,78,10,6,10,84,10,54,10,192,10,54,10,192,
+10,54,10,198,10,54,10,192,10,54,10,192,10,132,10,204,10,132,10,204,9,232,
+10,210,10,138,10,216,10,144,10,222,10,150,10,228,10,156,10,234,10,54,10,240,
+10,162,10,246,10,168,10,192,10,54,10,192,10,54,10,252,10,174,11,2,10,180,
+11,8,9,238,10,252,10,186,11,8,9,190,9,250,9,190,10,0,10,108,10,120,10,114,
+10,126,10,90,10,96,9,214,10,102,10,12,10,54,9,214,0,1,0,1,0,159,0,2,0,5,0,
+13,0,26,0,0,0,28,0,127,0,14,0,135,0,138,0,114,0,142,0,143,0,118,0,191,0,191,
+0,120,0,1,1,40,1,56,0,1,0,12,0,38,0,6,0,0,7,136,0,0,7,136,0,0,7,136,0,0,7,
+136,0,0,7,136,0,0,7,136,0,128,6,144,10,2,7,170,9,204,7,170,9,204,7,164,9,
+204,10,8,9,234,7,170,7,164,7,164,7,164,7,170,9,204,7,170,9,204,7,164,9,222,
+10,8,9,234,7,170,9,204,7,164,9,222,7,164,9,222,7,170,9,240,10,8,9,204,9,210,
+9,216,7,164,9,204,7,164,9,222,6,246,9,234,10,8,9,240,7,164,9,222,10,8,9,204,
+7,170,9,204,7,164,9,204,7,170,9,204,7,164,9,204,7,164,9,204,10,8,7,170,7,
+164,9,204,10,8,7,68,6,144,10,2,7,2,9,204,7,164,9,204,7,8,9,204,7,164,9,222,
+7,8,9,204,10,8,9,234,10,8,9,234,7,170,9,204,10,20,10,14,7,164,9,222,9,228,
+9,222,7,164,9,204,7,164,9,204,7,164,9,204,7,164,9,204,7,164,9,222,7,164,7,
+164,9,228,9,222,7,164,9,204,7,170,9,246,10,8,9,234,7,170,7,170,7,164,9,222,
+10,8,9,234,7,170,9,204,9,204,10,8,7,170,10,8,7,170,7,170,10,26,10,8,9,204,
+6,246,9,234,9,252,7,164,7,152,0,2,0,2,0,10,0,10,0,0,0,154,0,158,0,1,0,2,0,
+4,0,13,0,26,0,0,0,28,0,138,0,14,0,142,0,143,0,125,0,191,0,191,0,127,0,1,1,
+40,1,56,0,1,0,12,0,38,0,6,0,0,6,46,0,0,6,46,0,0,6,46,0,0,6,46,0,0,6,46,0,
+0,6,46,0,128,5,60,8,174,6,86,8,120,6,86,8,120,6,80,8,120,8,180,8,150,6,86,
+6,80,6,80,6,80,6,86,8,120,6,86,8,120,6,80,8,138,8,180,8,150,6,86,8,120,6,
+80,8,138,6,80,8,138,6,86,8,156,8,180,8,120,8,126,8,132,6,80,8,120,6,80,8,
+138,5,162,8,150,8,180,8,156,6,80,8,138,8,180,8,120,6,86,8,120,6,80,8,120,
+6,86,8,120,6,80,8,120,6,80,8,120,8,180,6,86,6,80,8,120,8,180,5,240,5,60,8,
+174,5,174,8,120,6,80,8,120,5,180,8,120,6,80,8,138,5,180,8,120,8,180,8,150,
+8,180,8,150,6,86,8,120,8,192,8,186,6,80,8,138,8,144,8,138,6,80,8,120,6,80,
+8,120,6,80,8,120,6,80,8,120,6,80,8,138,6,80,6,80,8,144,8,138,6,80,8,120,6,
+86,8,162,8,180,8,150,6,86,6,86,6,80,8,138,8,180,8,150,6,86,8,120,8,120,8,
+180,6,86,8,180,6,86,6,86,8,198,8,180,8,120,5,162,8,150,8,168,6,80,6,68,0,
+2,0,2,0,153,0,153,0,0,0,161,0,165,0,1,0,2,0,4,0,13,0,26,0,0,0,28,0,138,0,
+14,0,142,0,143,0,125,0,191,0,191,0,127,0,1,1,40,1,56,0,1,0,12,0,38,0,6,0,
+0,3,204,0,0,3,204,0,0,3,204,0,0,3,204,0,0,3,204,0,0,3,204,0,128,3,232,7,90,
+5,2,7,36,5,2,7,36,4,252,7,36,7,96,7,66,5,2,4,252,4,252,4,252,5,2,7,36,5,2,
+7,36,4,252,7,54,7,96,7,66,5,2,7,36,4,252,7,54,4,252,7,54,5,2,7,72,7,96,7,
+36,7,42,7,48,4,252,7,36,4,252,7,54,4,78,7,66,7,96,7,72,4,252,7,54,7,96,7,
+36,5,2,7,36,4,252,7,36,5,2,7,36,4,252,7,36,4,252,7,36,7,96,5,2,4,252,7,36,
+7,96,4,156,3,232,7,90,4,90,7,36,4,252,7,36,4,96,7,36,4,252,7,54,4,96,7,36,
+7,96,7,66,7,96,7,66,5,2,7,36,7,108,7,102,4,252,7,54,7,60,7,54,4,252,7,36,
+4,252,7,36,4,252,7,36,4,252,7,36,4,252,7,54,4,252,4,252,7,60,7,54,4,252,7,
+36,5,2,7,78,7,96,7,66,5,2,5,2,4,252,7,54,7,96,7,66,5,2,7,36,7,36,7,96,5,2,
+7,96,5,2,5,2,7,114,7,96,7,36,4,78,7,66,7,84,4,252,4,240,0,2,0,2,0,160,0,160,
+0,0,0,166,0,170,0,1,0,2,0,4,0,13,0,26,0,0,0,28,0,138,0,14,0,142,0,143,0,125,
+0,191,0,191,0,127,0,1,1,82,1,92,0,1,0,12,0,94,0,20,0,0,3,140,0,0,3,140,0,
+0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,
+140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,
+0,0,3,140,0,0,3,140,0,0,3,140,0,121,5,254,3,214,2,248,3,82,2,206,2,236,3,
+154,2,188,6,10,3,100,3,118,2,224,2,74,2,236,3,64,2,236,3,70,3,154,3,76,3,
+4,3,82,3,160,3,88,3,166,3,94,3,172,2,188,3,178,3,100,3,70,2,194,2,74,3,106,
+3,184,3,112,3,190,2,188,3,196,3,118,3,118,3,124,2,68,2,188,3,202,2,194,2,
+74,3,100,3,208,2,74,2,236,3,70,3,202,3,130,2,236,3,136,3,166,3,142,3,118,
+2,224,2,236,2,80,3,82,3,148,3,214,3,88,2,242,3,244,2,188,3,88,3,244,2,188,
+3,202,3,88,2,242,3,250,3,82,3,250,3,82,2,206,3,220,4,0,4,30,2,236,4,36,4,
+6,4,42,2,68,3,220,2,224,3,220,2,224,4,48,3,112,2,188,3,76,3,4,2,236,2,188,
+2,254,4,54,4,12,2,188,4,18,3,208,4,24,3,88,3,232,3,232,2,188,3,202,3,238,
+2,62,3,160,2,224,3,10,2,74,3,124,3,226,3,70,3,220,3,100,0,2,0,1,0,171,0,190,
+0,0,0,2,0,5,0,13,0,26,0,0,0,28,0,127,0,14,0,135,0,138,0,114,0,142,0,143,0,
+118,0,191,0,191,0,120,0,1,0,80,0,108,0,1,0,12,0,54,0,10,0,0,0,244,0,0,0,244,
+0,0,0,250,0,0,1,0,0,0,0,250,0,0,1,6,0,0,1,12,0,0,1,252,0,0,2,2,0,0,2,2,0,
+12,4,150,4,150,4,150,4,150,4,150,4,150,1,228,1,228,1,228,1,228,1,228,1,228,
+0,2,0,4,0,6,0,9,0,0,0,11,0,12,0,4,0,27,0,27,0,6,0,139,0,141,0,7,0,2,0,4,0,
+10,0,10,0,0,0,154,0,158,0,1,0,160,0,160,0,6,0,166,0,170,0,7,0,1,0,70,0,98,
+0,1,0,12,0,54,0,10,0,0,0,108,0,0,0,108,0,0,0,114,0,0,0,120,0,0,0,114,0,0,
+0,126,0,0,0,132,0,0,1,116,0,0,1,122,0,0,1,122,0,7,4,20,4,26,4,26,4,26,4,26,
+4,26,4,26,0,2,0,4,0,6,0,9,0,0,0,11,0,12,0,4,0,27,0,27,0,6,0,139,0,141,0,7,
+0,2,0,3,0,9,0,9,0,0,0,153,0,153,0,1,0,161,0,165,0,2,0,1,253,148,4,211,0,1,
+0,0,4,211,0,1,253,128,4,176,0,1,255,6,4,211,0,1,249,232,4,211,0,1,2,228,6,
+124,0,1,2,128,6,124,0,1,2,108,6,124,0,1,3,82,6,124,0,1,1,64,6,124,0,1,4,66,
+6,124,0,1,2,138,7,8,0,1,2,48,4,211,0,1,1,244,4,211,0,1,1,224,4,211,0,1,2,
+108,4,211,0,1,0,250,4,211,0,1,1,164,4,211,0,1,3,12,4,211,0,1,2,128,4,211,
+0,1,1,204,4,211,0,1,2,88,4,211,0,1,2,8,4,211,0,1,2,28,4,211,0,1,2,198,4,211,
+0,1,3,52,4,211,0,1,2,48,6,124,0,1,3,32,6,124,0,1,2,148,4,211,0,1,2,188,6,
+124,0,1,2,168,6,124,0,1,2,228,4,211,0,1,2,88,6,124,0,1,4,27,8,192,0,1,2,68,
+6,124,0,1,2,28,6,124,0,1,3,12,6,124,0,1,1,144,6,124,0,1,1,184,6,124,0,1,3,
+52,6,124,0,1,2,208,4,211,0,1,3,60,7,98,0,1,2,168,4,211,0,1,1,104,4,211,0,
+1,252,24,4,211,0,1,253,118,4,111,0,1,0,0,4,176,0,1,0,0,6,124,0,1,2,133,6,
+124,0,1,2,138,6,124,0,1,2,23,6,124,0,1,2,218,6,124,0,1,2,148,6,124,0,1,2,
+58,6,124,0,1,2,238,6,124,0,1,1,34,6,124,0,1,2,118,6,124,0,1,2,248,6,124,0,
+1,3,7,6,124,0,1,2,113,6,124,0,1,2,70,6,124,0,1,3,57,6,124,0,1,4,31,6,124,
+0,1,2,78,6,124,0,1,2,163,6,124,0,1,2,8,6,124,0,1,1,234,6,124,0,1,1,199,6,
+124,0,1,1,9,6,124,0,1,2,33,6,124,0,1,1,209,6,124,0,1,1,224,6,124,0,1,2,123,
+6,124,0,1,3,67,6,124,0,1,2,38,6,124,0,1,2,173,6,124,0,1,2,103,6,124,0,1,3,
+72,6,124,0,1,2,53,6,124,0,1,3,42,6,124,0,1,4,36,8,192,0,1,1,194,6,124,0,1,
+2,98,6,124,0,1,2,233,6,124,0,1,3,62,6,124,0,1,3,72,7,98,0,1,1,244,6,124,0,
+1,1,94,6,124,0,1,1,164,6,124,0,1,1,124,6,124,0,1,0,100,0,50,0,1,2,48,0,0,
+0,1,2,128,0,0,0,1,3,82,0,0,0,1,3,52,0,0,0,1,2,48,255,156,0,1,2,238,0,0,0,
+1,3,72,0,0,0,1,1,44,0,0,0,1,2,248,0,0,0,1,2,228,0,0,0,1,3,32,0,0,0,1,2,108,
+0,0,0,1,2,68,0,0,0,1,4,26,0,0,0,1,2,188,0,0,0,1,1,244,0,0,0,1,2,68,254,232,
+0,1,1,204,0,0,0,1,2,138,0,0,0,1,0,250,0,0,0,1,3,12,0,0,0,1,2,118,0,0,0,1,
+2,92,0,0,0,1,2,8,254,32,0,1,2,228,254,112,0,1,2,198,254,132,0,1,3,62,0,0,
+0,1,3,77,0,0,0,1,2,112,0,0,0,1,2,158,0,0,0,1,3,67,254,232,0,1,2,128,254,232,
+0,1,2,228,254,92,0,1,2,88,254,152,0,1,3,42,0,0,0,1,2,196,0,0,0,1,2,1,0,0,
+0,1,1,205,0,0,0,1,3,32,255,86,0,1,2,27,0,0,0,1,2,40,0,0,0,1,1,144,254,212,
+0,1,3,31,0,0,0,1,3,112,0,0,0,1,1,254,0,0,0,1,2,28,0,0,0,1,2,218,0,0,0,1,2,
+118,255,186,0,1,2,50,0,0,0,1,1,174,254,172,0,1,1,176,0,0,0,1,2,138,255,16,
+0,1,2,128,254,172,0,1,1,174,254,192,0,1,2,115,0,0,0,1,1,144,254,82,0,1,2,
+219,0,0,0,1,2,118,4,211,0,1,1,74,6,124,0,1,1,74,4,211,0,1,2,18,4,211,0,1,
+2,18,6,124,0,1,2,248,4,211,0,1,2,188,4,211,0,1,2,138,4,211,0,1,2,248,6,144,
+0,1,3,92,4,211,0,1,3,92,6,124,0,1,3,92,7,108,0,1,4,66,8,202,0,1,4,66,4,211,
+0,1,0,0,7,208,0,1,253,127,6,64,0,1,0,0,6,64,0,1,4,26,6,124,0,1,3,67,4,211,
+0,1,3,152,6,124,0,1,2,218,4,211,0,1,2,238,4,211,0,1,2,88,5,120,0,1,2,68,5,
+220,0,1,2,148,0,0,0,1,2,137,0,0,0,1,1,239,254,62,0,1,2,93,255,36,0,1,2,247,
+0,0,0,1,3,156,0,0,0,1,2,104,0,0,0,1,1,162,254,92,0,1,2,148,255,16,0,1,3,2,
+0,0,0,1,2,82,255,6,0,1,0,0,0,10,0,48,0,142,0,2,68,70,76,84,0,26,99,111,112,
+116,0,14,0,4,0,0,0,0,255,255,0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,1,0,2,99,99,
+109,112,0,14,99,99,109,112,0,54,0,0,0,18,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,
+0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,0,0,18,0,0,0,1,0,2,0,3,
+0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,35,0,72,
+0,80,0,88,0,96,0,104,0,112,0,120,0,128,0,136,0,144,0,152,0,160,0,168,0,176,
+0,184,0,192,0,200,0,208,0,216,0,224,0,232,0,240,0,248,1,0,1,8,1,16,1,24,1,
+32,1,40,1,48,1,56,1,64,1,72,1,80,1,88,0,6,0,0,0,1,1,24,0,6,0,0,0,1,1,48,0,
+6,0,0,0,1,1,128,0,6,0,0,0,1,2,42,0,6,0,0,0,1,2,170,0,6,0,0,0,1,2,214,0,6,
+0,0,0,1,2,238,0,6,0,0,0,1,3,62,0,6,0,0,0,1,3,232,0,6,0,0,0,1,4,104,0,6,0,
+0,0,1,4,148,0,6,0,0,0,1,4,172,0,6,0,0,0,1,4,252,0,6,0,0,0,1,5,166,0,6,0,0,
+0,1,6,38,0,6,0,0,0,1,6,82,0,6,1,6,0,1,7,198,0,8,1,6,0,1,7,240,0,1,0,0,0,1,
+8,60,0,1,0,0,0,1,8,66,0,1,0,0,0,1,8,72,0,1,0,0,0,1,8,78,0,1,0,0,0,1,8,84,
+0,1,0,0,0,1,8,90,0,1,0,0,0,1,8,96,0,1,0,0,0,1,8,102,0,1,0,0,0,1,8,108,0,1,
+0,0,0,1,8,114,0,1,0,0,0,1,8,120,0,1,0,0,0,1,8,126,0,1,0,0,0,1,8,132,0,1,0,
+0,0,1,8,138,0,1,0,0,0,1,8,144,0,1,0,0,0,1,8,150,0,1,1,6,0,1,8,210,0,3,0,1,
+0,18,0,1,0,26,0,0,0,1,0,0,0,18,0,1,0,2,0,46,0,47,0,1,0,1,0,10,0,3,0,1,0,18,
+0,1,0,82,0,0,0,1,0,0,0,19,0,2,0,10,0,33,0,33,0,0,0,39,0,39,0,1,0,41,0,41,
+0,2,0,51,0,51,0,3,0,57,0,57,0,4,0,85,0,85,0,5,0,97,0,99,0,6,0,109,0,109,0,
+9,0,112,0,113,0,10,0,123,0,123,0,12,0,1,0,1,0,10,0,3,0,1,0,18,0,1,0,172,0,
+0,0,1,0,0,0,20,0,2,0,25,0,15,0,15,0,0,0,17,0,17,0,1,0,22,0,23,0,2,0,28,0,
+28,0,4,0,30,0,30,0,5,0,35,0,36,0,6,0,42,0,43,0,8,0,52,0,53,0,10,0,55,0,55,
+0,12,0,60,0,60,0,13,0,64,0,64,0,14,0,71,0,71,0,15,0,75,0,75,0,16,0,78,0,78,
+0,17,0,82,0,82,0,18,0,86,0,86,0,19,0,89,0,89,0,20,0,91,0,92,0,21,0,116,0,
+117,0,23,0,119,0,121,0,25,0,125,0,126,0,28,0,130,0,130,0,30,0,132,0,133,0,
+31,0,138,0,138,0,33,0,142,0,142,0,34,0,1,0,1,0,10,0,3,0,1,0,18,0,1,0,130,
+0,0,0,1,0,0,0,21,0,2,0,18,0,14,0,14,0,0,0,21,0,21,0,1,0,34,0,34,0,2,0,44,
+0,44,0,3,0,54,0,54,0,4,0,58,0,58,0,5,0,70,0,70,0,6,0,74,0,74,0,7,0,77,0,77,
+0,8,0,88,0,88,0,9,0,90,0,90,0,10,0,95,0,95,0,11,0,118,0,118,0,12,0,124,0,
+124,0,13,0,129,0,129,0,14,0,131,0,131,0,15,0,135,0,135,0,16,0,137,0,137,0,
+17,0,1,0,1,0,10,0,3,0,1,0,18,0,1,0,46,0,0,0,1,0,0,0,22,0,2,0,4,0,13,0,13,
+0,0,0,76,0,76,0,1,0,94,0,94,0,2,0,134,0,134,0,3,0,1,0,1,0,10,0,3,0,1,0,18,
+0,1,0,26,0,0,0,1,0,0,0,23,0,1,0,2,0,46,0,47,0,1,0,1,0,153,0,3,0,1,0,18,0,
+1,0,82,0,0,0,1,0,0,0,24,0,2,0,10,0,33,0,33,0,0,0,39,0,39,0,1,0,41,0,41,0,
+2,0,51,0,51,0,3,0,57,0,57,0,4,0,85,0,85,0,5,0,97,0,99,0,6,0,109,0,109,0,9,
+0,112,0,113,0,10,0,123,0,123,0,12,0,1,0,1,0,153,0,3,0,1,0,18,0,1,0,172,0,
+0,0,1,0,0,0,25,0,2,0,25,0,15,0,15,0,0,0,17,0,17,0,1,0,22,0,23,0,2,0,28,0,
+28,0,4,0,30,0,30,0,5,0,35,0,36,0,6,0,42,0,43,0,8,0,52,0,53,0,10,0,55,0,55,
+0,12,0,60,0,60,0,13,0,64,0,64,0,14,0,71,0,71,0,15,0,75,0,75,0,16,0,78,0,78,
+0,17,0,82,0,82,0,18,0,86,0,86,0,19,0,89,0,89,0,20,0,91,0,92,0,21,0,116,0,
+117,0,23,0,119,0,121,0,25,0,125,0,126,0,28,0,130,0,130,0,30,0,132,0,133,0,
+31,0,138,0,138,0,33,0,142,0,142,0,34,0,1,0,1,0,153,0,3,0,1,0,18,0,1,0,130,
+0,0,0,1,0,0,0,26,0,2,0,18,0,14,0,14,0,0,0,21,0,21,0,1,0,34,0,34,0,2,0,44,
+0,44,0,3,0,54,0,54,0,4,0,58,0,58,0,5,0,70,0,70,0,6,0,74,0,74,0,7,0,77,0,77,
+0,8,0,88,0,88,0,9,0,90,0,90,0,10,0,95,0,95,0,11,0,118,0,118,0,12,0,124,0,
+124,0,13,0,129,0,129,0,14,0,131,0,131,0,15,0,135,0,135,0,16,0,137,0,137,0,
+17,0,1,0,1,0,153,0,3,0,1,0,18,0,1,0,46,0,0,0,1,0,0,0,27,0,2,0,4,0,13,0,13,
+0,0,0,76,0,76,0,1,0,94,0,94,0,2,0,134,0,134,0,3,0,1,0,1,0,153,0,3,0,1,0,18,
+0,1,0,26,0,0,0,1,0,0,0,28,0,1,0,2,0,46,0,47,0,1,0,1,0,160,0,3,0,1,0,18,0,
+1,0,82,0,0,0,1,0,0,0,29,0,2,0,10,0,33,0,33,0,0,0,39,0,39,0,1,0,41,0,41,0,
+2,0,51,0,51,0,3,0,57,0,57,0,4,0,85,0,85,0,5,0,97,0,99,0,6,0,109,0,109,0,9,
+0,112,0,113,0,10,0,123,0,123,0,12,0,1,0,1,0,160,0,3,0,1,0,18,0,1,0,172,0,
+0,0,1,0,0,0,30,0,2,0,25,0,15,0,15,0,0,0,17,0,17,0,1,0,22,0,23,0,2,0,28,0,
+28,0,4,0,30,0,30,0,5,0,35,0,36,0,6,0,42,0,43,0,8,0,52,0,53,0,10,0,55,0,55,
+0,12,0,60,0,60,0,13,0,64,0,64,0,14,0,71,0,71,0,15,0,75,0,75,0,16,0,78,0,78,
+0,17,0,82,0,82,0,18,0,86,0,86,0,19,0,89,0,89,0,20,0,91,0,92,0,21,0,116,0,
+117,0,23,0,119,0,121,0,25,0,125,0,126,0,28,0,130,0,130,0,30,0,132,0,133,0,
+31,0,138,0,138,0,33,0,142,0,142,0,34,0,1,0,1,0,160,0,3,0,1,0,18,0,1,0,130,
+0,0,0,1,0,0,0,31,0,2,0,18,0,14,0,14,0,0,0,21,0,21,0,1,0,34,0,34,0,2,0,44,
+0,44,0,3,0,54,0,54,0,4,0,58,0,58,0,5,0,70,0,70,0,6,0,74,0,74,0,7,0,77,0,77,
+0,8,0,88,0,88,0,9,0,90,0,90,0,10,0,95,0,95,0,11,0,118,0,118,0,12,0,124,0,
+124,0,13,0,129,0,129,0,14,0,131,0,131,0,15,0,135,0,135,0,16,0,137,0,137,0,
+17,0,1,0,1,0,160,0,3,0,1,0,18,0,1,0,46,0,0,0,1,0,0,0,32,0,2,0,4,0,13,0,13,
+0,0,0,76,0,76,0,1,0,94,0,94,0,2,0,134,0,134,0,3,0,1,0,1,0,160,0,3,0,1,0,18,
+0,1,1,102,0,0,0,1,0,0,0,33,0,2,0,56,0,13,0,13,0,0,0,15,0,15,0,1,0,17,0,17,
+0,2,0,19,0,19,0,3,0,21,0,21,0,4,0,23,0,23,0,5,0,25,0,26,0,6,0,28,0,28,0,8,
+0,30,0,30,0,9,0,32,0,32,0,10,0,34,0,34,0,11,0,36,0,36,0,12,0,38,0,38,0,13,
+0,40,0,40,0,14,0,42,0,42,0,15,0,44,0,44,0,16,0,46,0,46,0,17,0,48,0,48,0,18,
+0,50,0,50,0,19,0,52,0,52,0,20,0,54,0,54,0,21,0,56,0,56,0,22,0,58,0,58,0,23,
+0,60,0,60,0,24,0,62,0,62,0,25,0,64,0,64,0,26,0,66,0,66,0,27,0,68,0,68,0,28,
+0,70,0,72,0,29,0,74,0,74,0,32,0,76,0,76,0,33,0,78,0,78,0,34,0,80,0,80,0,35,
+0,82,0,82,0,36,0,84,0,84,0,37,0,86,0,86,0,38,0,88,0,88,0,39,0,90,0,90,0,40,
+0,92,0,92,0,41,0,94,0,96,0,42,0,98,0,98,0,45,0,100,0,100,0,46,0,102,0,102,
+0,47,0,104,0,104,0,48,0,106,0,106,0,49,0,108,0,108,0,50,0,110,0,112,0,51,
+0,114,0,114,0,54,0,116,0,116,0,55,0,118,0,118,0,56,0,120,0,122,0,57,0,124,
+0,124,0,60,0,126,0,126,0,61,0,135,0,135,0,62,0,137,0,137,0,63,0,142,0,143,
+0,64,0,2,0,3,0,10,0,10,0,0,0,151,0,158,0,1,0,160,0,170,0,9,0,3,0,1,0,18,0,
+1,0,28,0,0,0,1,0,0,0,34,0,2,0,1,0,171,0,190,0,0,0,2,0,3,0,10,0,10,0,0,0,151,
+0,158,0,1,0,160,0,170,0,9,0,1,0,52,0,0,0,1,0,74,0,20,0,190,0,171,0,172,0,
+173,0,174,0,175,0,176,0,177,0,178,0,179,0,180,0,181,0,182,0,183,0,184,0,185,
+0,186,0,187,0,188,0,189,0,2,0,3,0,10,0,10,0,0,0,151,0,158,0,1,0,160,0,170,
+0,9,0,2,0,1,0,171,0,190,0,0,0,2,0,8,0,1,0,154,0,1,0,1,0,10,0,2,0,8,0,1,0,
+155,0,1,0,1,0,10,0,2,0,8,0,1,0,156,0,1,0,1,0,10,0,2,0,8,0,1,0,157,0,1,0,1,
+0,10,0,2,0,8,0,1,0,158,0,1,0,1,0,10,0,2,0,8,0,1,0,161,0,1,0,1,0,153,0,2,0,
+8,0,1,0,162,0,1,0,1,0,153,0,2,0,8,0,1,0,163,0,1,0,1,0,153,0,2,0,8,0,1,0,164,
+0,1,0,1,0,153,0,2,0,8,0,1,0,165,0,1,0,1,0,153,0,2,0,8,0,1,0,166,0,1,0,1,0,
+160,0,2,0,8,0,1,0,167,0,1,0,1,0,160,0,2,0,8,0,1,0,168,0,1,0,1,0,160,0,2,0,
+8,0,1,0,169,0,1,0,1,0,160,0,2,0,8,0,1,0,170,0,1,0,1,0,160,0,2,0,46,0,20,0,
+190,0,171,0,172,0,173,0,174,0,175,0,176,0,177,0,178,0,179,0,180,0,181,0,182,
+0,183,0,184,0,185,0,186,0,187,0,188,0,189,0,2,0,3,0,10,0,10,0,0,0,151,0,158,
+0,1,0,160,0,170,0,9,0,2,0,46,0,20,0,190,0,171,0,172,0,173,0,174,0,175,0,176,
+0,177,0,178,0,179,0,180,0,181,0,182,0,183,0,184,0,185,0,186,0,187,0,188,0,
+189,0,2,0,3,0,10,0,10,0,0,0,151,0,158,0,1,0,160,0,170,0,9,};
+#endif
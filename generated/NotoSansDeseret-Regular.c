@@ -0,0 +1,450 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansDeseret_Regular_ttf_size = 10512;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansDeseret_Regular_ttf");
+asm(".type fz_font_NotoSansDeseret_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansDeseret_Regular_ttf, 10512");
+asm(".balign 64");
+asm("fz_font_NotoSansDeseret_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansDeseret-Regular.ttf\"");
+#else
+const int fz_font_NotoSansDeseret_Regular_ttf_size = 10512;
+const char fz_font_NotoSansDeseret_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,123,3,109,226,0,0,1,56,0,0,0,96,99,
+109,97,112,0,219,8,58,0,0,2,232,0,0,0,172,103,97,115,112,0,7,0,7,0,0,41,4,
+0,0,0,12,103,108,121,102,127,225,38,93,0,0,4,64,0,0,30,154,104,101,97,100,
+4,207,157,24,0,0,0,188,0,0,0,54,104,104,101,97,14,197,4,55,0,0,0,244,0,0,
+0,36,104,109,116,120,133,192,32,49,0,0,1,152,0,0,1,80,108,111,99,97,64,189,
+57,49,0,0,3,148,0,0,0,170,109,97,120,112,0,89,0,63,0,0,1,24,0,0,0,32,110,
+97,109,101,141,1,185,98,0,0,34,220,0,0,6,6,112,111,115,116,255,105,0,102,
+0,0,40,228,0,0,0,32,0,1,0,0,0,1,5,31,120,252,233,215,95,15,60,245,0,11,8,
+0,0,0,0,0,205,82,129,109,0,0,0,0,210,40,203,228,255,217,255,221,6,92,5,205,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,6,106,255,217,255,208,6,
+92,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,1,0,0,0,84,0,62,0,4,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,178,1,144,0,5,0,0,5,154,5,51,0,0,1,
+31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,
+0,0,128,0,0,0,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,0,4,205,0,193,0,0,0,0,4,20,0,0,
+2,20,0,0,4,233,0,106,4,115,0,115,5,43,0,115,5,135,0,125,5,135,0,125,5,135,
+0,125,4,16,0,61,4,231,0,20,4,152,0,55,5,217,0,55,4,231,0,199,4,215,0,104,
+5,129,0,102,5,43,0,115,6,66,0,158,6,106,0,70,5,129,0,102,4,49,0,39,5,86,0,
+115,4,205,0,27,5,72,0,125,4,141,0,125,4,23,0,94,6,0,0,125,6,0,0,125,4,215,
+0,199,4,98,0,53,4,49,0,199,4,135,0,0,4,147,255,217,4,205,0,125,5,72,0,201,
+4,100,0,104,5,129,0,102,4,205,0,199,4,141,0,88,5,57,0,199,5,133,0,201,6,14,
+0,55,5,135,0,125,4,68,0,90,3,233,0,88,4,100,0,88,4,217,0,113,4,215,0,113,
+4,217,0,113,3,51,0,31,4,43,0,20,3,225,0,29,4,240,0,20,4,43,0,174,4,53,0,111,
+4,166,0,82,4,100,0,88,5,59,0,119,5,160,0,61,4,166,0,82,3,125,0,31,4,137,0,
+88,4,35,0,31,4,141,0,113,3,215,0,113,3,180,0,96,5,59,0,119,5,59,0,119,4,53,
+0,166,3,227,0,82,3,125,0,174,3,203,255,231,4,123,0,16,4,68,0,113,4,141,0,
+174,3,213,0,104,4,166,0,82,4,35,0,174,3,215,0,68,4,70,0,143,4,190,0,174,5,
+92,0,20,4,215,0,113,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,
+0,0,12,0,8,0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,
+0,160,254,255,255,255,0,1,255,245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,12,0,0,0,0,0,88,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,
+0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,
+0,254,255,0,0,254,255,0,0,0,1,0,1,4,0,0,1,4,79,0,0,0,4,0,0,0,21,0,21,0,21,
+0,21,0,88,0,143,0,205,1,20,1,70,1,127,1,154,1,185,1,204,1,234,2,8,2,48,2,
+101,2,179,2,241,3,63,3,117,3,133,3,200,3,228,4,40,4,83,4,129,4,193,5,23,5,
+64,5,122,5,137,5,187,6,24,6,90,6,138,6,196,6,254,7,26,7,67,7,89,7,123,7,167,
+7,236,8,37,8,92,8,149,8,215,9,3,9,55,9,81,9,112,9,130,9,159,9,187,9,224,10,
+23,10,99,10,156,10,227,11,26,11,42,11,101,11,128,11,194,11,233,12,21,12,78,
+12,153,12,191,12,243,13,2,13,56,13,146,13,203,13,252,14,49,14,108,14,135,
+14,176,14,198,14,227,15,13,15,77,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,
+19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,
+4,230,0,0,2,0,106,255,236,4,109,5,203,0,26,0,40,0,0,1,16,2,35,34,6,7,39,54,
+51,32,0,17,16,0,33,34,38,38,53,52,54,54,51,50,22,23,1,50,54,54,53,52,38,38,
+35,34,6,21,20,22,3,172,225,203,85,141,59,63,152,204,1,30,1,71,254,237,254,
+248,138,225,125,110,202,127,134,198,51,254,180,91,144,91,88,151,93,143,154,
+170,3,4,1,7,1,30,49,31,156,86,254,112,254,162,254,141,254,130,137,242,147,
+142,219,118,111,102,253,131,92,188,103,77,147,87,177,163,157,197,0,0,1,0,
+115,255,236,4,61,5,203,0,37,0,0,19,52,36,51,50,23,7,38,35,34,6,21,20,22,51,
+51,21,35,34,6,21,20,22,51,50,55,21,6,33,34,36,53,52,54,55,53,38,38,168,1,
+8,234,248,171,81,161,177,146,162,199,207,88,98,218,229,173,169,215,191,166,
+254,252,247,254,245,190,174,154,157,4,74,177,208,121,135,104,131,110,132,
+124,154,145,142,122,140,88,156,83,214,193,148,194,25,8,26,175,0,2,0,115,255,
+236,4,174,5,203,0,18,0,38,0,0,1,32,0,17,16,0,33,34,38,53,52,54,55,53,38,38,
+53,52,54,23,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,32,17,16,2,2,127,1,
+21,1,26,254,197,254,225,226,255,190,174,154,157,255,212,134,143,199,207,47,
+57,218,229,152,145,1,144,182,5,203,254,134,254,140,254,155,254,116,219,188,
+148,194,25,8,26,175,135,177,208,158,123,112,132,124,154,145,142,122,138,2,
+88,1,41,1,39,0,0,3,0,125,255,236,5,10,5,205,0,11,0,27,0,37,0,0,1,16,0,33,
+32,0,17,16,0,33,32,0,1,16,18,51,50,18,55,6,35,34,38,53,52,55,6,2,5,50,55,
+2,2,39,6,21,20,22,5,10,254,206,254,237,254,233,254,207,1,48,1,26,1,19,1,48,
+252,53,198,192,174,199,12,45,52,207,223,39,141,146,2,179,52,34,4,179,172,
+36,159,2,221,254,158,254,113,1,137,1,106,1,104,1,134,254,114,254,158,254,
+223,254,207,1,5,245,8,228,200,123,123,40,254,218,221,6,1,9,1,26,12,111,133,
+163,158,0,0,2,0,125,255,236,5,10,5,205,0,11,0,23,0,0,1,16,0,33,32,0,17,16,
+0,33,32,0,1,16,18,51,50,18,17,16,2,35,34,2,5,10,254,206,254,237,254,233,254,
+207,1,48,1,26,1,19,1,48,252,53,198,192,192,195,194,191,193,199,2,221,254,
+158,254,113,1,137,1,106,1,104,1,134,254,114,254,158,254,223,254,207,1,47,
+1,35,1,33,1,45,254,213,0,3,0,125,255,236,5,10,5,205,0,11,0,18,0,25,0,0,1,
+16,0,33,32,0,17,16,0,33,32,0,3,16,2,39,17,54,18,1,16,18,23,17,6,2,5,10,254,
+206,254,237,254,233,254,207,1,48,1,26,1,19,1,48,194,167,159,159,167,252,247,
+168,158,159,167,2,221,254,158,254,113,1,137,1,106,1,104,1,134,254,114,254,
+158,1,12,1,40,22,251,104,23,1,44,1,11,254,244,254,214,24,4,150,23,254,216,
+0,0,1,0,61,0,0,3,207,5,182,0,11,0,0,19,5,17,51,17,5,7,37,17,35,17,37,156,
+1,16,184,1,107,90,254,239,184,254,145,4,47,162,2,41,253,107,211,141,157,253,
+162,2,201,215,0,0,1,0,20,255,221,4,33,5,182,0,15,0,0,1,17,35,38,38,35,32,
+7,39,54,36,51,50,22,23,17,4,33,185,39,180,116,254,255,79,181,49,1,9,190,112,
+188,48,5,182,250,74,96,117,248,58,171,195,81,64,4,194,0,0,1,0,55,0,0,3,207,
+5,182,0,6,0,0,33,35,1,55,1,17,51,3,207,187,253,35,95,2,122,191,1,119,160,
+254,188,4,227,0,0,1,0,55,0,0,5,16,5,182,0,12,0,0,33,35,1,3,35,1,55,1,19,51,
+1,17,51,5,16,186,254,197,197,135,254,104,133,1,76,205,123,1,2,190,1,57,254,
+199,1,135,135,254,189,1,53,254,254,4,184,0,0,1,0,199,255,221,4,211,5,182,
+0,15,0,0,23,17,51,22,22,51,32,55,23,6,4,35,34,38,39,17,199,184,40,181,115,
+1,1,79,180,49,254,244,187,111,188,49,35,5,182,98,115,248,57,172,195,81,65,
+251,61,0,0,2,0,104,0,0,4,16,5,205,0,12,0,23,0,0,19,52,54,51,50,18,21,17,35,
+17,35,32,36,37,52,38,35,34,6,21,20,22,51,51,104,240,205,242,249,184,168,254,
+228,254,212,2,240,150,145,123,143,194,220,147,4,25,196,240,254,246,252,252,
+57,2,57,246,135,196,181,153,134,165,148,0,0,2,0,102,255,233,5,27,5,182,0,
+23,0,32,0,0,19,52,36,55,17,51,17,22,22,21,20,6,7,39,54,53,52,37,21,20,6,35,
+34,38,1,4,21,20,22,51,50,54,53,102,1,25,254,184,232,254,135,125,76,143,254,
+219,194,172,166,187,2,23,254,168,94,76,80,94,1,80,187,231,16,2,180,253,74,
+19,213,174,128,199,55,139,75,152,214,44,219,194,214,191,1,188,25,251,93,108,
+120,112,0,4,0,115,255,236,4,174,5,203,0,18,0,27,0,36,0,45,0,0,1,32,0,17,16,
+0,33,34,38,53,52,54,55,53,38,38,53,52,54,19,32,19,35,34,6,21,20,22,1,38,38,
+39,6,21,20,22,23,1,20,5,38,53,52,55,6,6,2,127,1,21,1,26,254,197,254,225,226,
+255,190,174,154,157,255,181,1,124,17,247,218,229,152,2,28,9,134,115,39,73,
+65,254,22,1,80,115,43,129,135,5,203,254,134,254,140,254,155,254,116,219,188,
+148,194,25,8,26,175,135,177,208,250,186,2,35,145,142,122,138,2,189,200,251,
+36,114,89,86,149,49,1,0,236,20,120,154,111,110,4,126,0,1,0,158,255,236,5,
+164,5,182,0,38,0,0,5,34,2,17,52,18,55,51,2,17,16,18,51,50,54,53,17,51,17,
+20,22,51,50,18,17,52,2,39,51,22,18,21,16,33,34,39,35,6,6,2,8,182,180,59,62,
+196,123,88,101,87,81,184,81,85,103,87,53,70,197,66,55,254,143,210,60,10,36,
+137,20,1,94,1,98,220,1,113,189,254,117,254,125,254,240,254,243,183,194,1,
+86,254,170,194,183,1,13,1,16,204,1,100,222,209,254,154,211,253,64,219,113,
+106,0,3,0,70,0,0,6,92,5,203,0,25,0,35,0,44,0,0,1,6,6,7,3,35,3,38,0,53,52,
+54,51,50,22,23,19,22,51,50,55,19,51,3,54,55,37,34,6,21,20,22,23,3,38,38,1,
+54,54,19,6,35,34,39,18,6,92,73,249,141,200,201,197,231,254,246,145,121,114,
+128,36,107,68,94,62,75,172,188,170,179,131,251,86,34,52,152,130,82,19,55,
+1,242,10,26,81,44,44,65,70,76,3,207,89,142,35,253,59,2,205,55,1,6,174,129,
+146,128,134,254,122,10,8,2,121,253,172,58,153,248,56,57,112,179,44,1,55,75,
+62,251,160,55,116,1,50,4,6,254,188,0,0,2,0,102,0,0,5,27,5,205,0,23,0,32,0,
+0,1,20,4,7,17,35,17,38,38,53,52,54,55,23,6,21,20,5,53,52,54,51,50,22,1,36,
+53,52,38,35,34,6,21,5,27,254,226,249,184,232,254,135,125,76,143,1,37,194,
+172,166,187,253,233,1,88,94,76,80,94,4,102,189,229,16,253,76,2,182,19,213,
+174,128,199,56,140,75,152,214,44,219,194,214,191,254,68,25,251,93,108,120,
+111,0,0,1,0,39,0,0,3,94,5,182,0,5,0,0,1,17,35,17,33,53,3,94,184,253,129,5,
+182,250,74,5,18,164,0,2,0,115,255,236,4,141,5,203,0,23,0,45,0,0,1,50,22,23,
+53,51,17,35,53,6,6,35,34,38,53,52,54,55,53,38,38,53,52,54,23,34,6,21,20,22,
+51,51,21,35,34,6,21,20,22,51,50,18,19,53,16,2,2,96,143,190,40,184,184,52,
+224,146,203,241,190,174,154,157,242,206,120,138,199,207,47,57,218,229,149,
+128,190,202,5,177,5,203,119,100,198,250,74,227,119,128,222,185,148,194,25,
+8,26,175,135,173,212,158,125,110,132,124,154,145,142,122,138,1,34,1,26,28,
+1,52,1,28,0,1,0,27,0,0,4,6,5,203,0,13,0,0,19,16,18,33,32,17,17,35,17,52,38,
+35,32,17,27,254,1,4,1,233,184,152,164,254,191,3,139,1,25,1,39,253,239,252,
+70,3,150,213,192,254,96,0,0,3,0,125,255,236,4,127,5,203,0,15,0,27,0,42,0,
+0,37,6,35,34,2,17,16,0,51,50,22,23,53,51,17,35,1,34,6,21,20,22,51,50,54,53,
+52,38,1,20,22,22,51,50,54,55,17,6,6,35,34,38,39,3,199,114,241,236,251,1,8,
+254,109,168,47,184,184,254,196,138,177,171,142,142,176,180,254,42,85,153,
+100,117,162,33,46,171,103,104,166,53,211,231,1,131,1,106,1,109,1,133,112,
+101,192,250,74,5,47,200,156,152,188,195,153,155,193,253,131,175,245,129,150,
+135,1,18,93,105,96,92,0,1,0,125,255,236,4,78,5,203,0,23,0,0,1,34,2,17,16,
+18,51,50,55,21,6,6,35,32,0,17,52,18,36,51,50,23,7,38,2,242,202,233,223,206,
+131,165,80,154,95,254,228,254,206,149,1,25,190,205,152,64,150,5,41,254,197,
+254,237,254,230,254,204,58,160,34,25,1,138,1,103,226,1,85,183,86,156,80,0,
+1,0,94,0,0,3,217,5,205,0,26,0,0,1,34,38,53,52,0,51,50,22,23,7,38,35,34,6,
+21,20,22,51,50,54,55,23,1,35,1,6,2,43,213,248,1,37,246,112,181,59,76,133,
+153,160,182,163,150,72,148,40,117,254,172,205,1,53,81,1,244,254,221,230,1,
+24,62,45,143,92,182,164,157,169,48,32,106,253,139,2,20,32,0,0,2,0,125,255,
+236,5,131,5,205,0,19,0,38,0,0,1,16,2,35,34,2,17,16,51,50,54,53,53,51,21,20,
+22,51,50,18,1,52,18,36,51,32,0,17,16,2,35,34,39,35,6,6,35,34,2,4,193,224,
+221,221,232,189,87,81,184,81,85,98,93,251,188,154,1,37,200,1,45,1,82,190,
+179,210,60,10,36,137,102,182,180,2,172,1,57,1,70,254,185,254,196,253,227,
+183,194,96,96,194,183,1,0,1,33,242,1,108,195,254,85,254,138,254,168,254,152,
+219,113,106,1,94,0,3,0,125,255,236,5,131,5,205,0,23,0,34,0,53,0,0,1,16,51,
+50,54,53,53,51,21,20,22,51,50,18,55,6,6,35,34,38,53,52,55,4,1,50,55,2,2,39,
+6,6,21,20,22,5,52,18,36,51,32,0,17,16,2,35,34,39,35,6,6,35,34,2,1,63,189,
+87,81,184,81,85,100,89,2,23,102,21,215,227,41,254,161,3,3,70,54,11,209,191,
+15,22,160,252,223,154,1,37,200,1,45,1,82,190,179,210,60,10,36,137,102,182,
+180,2,168,253,227,183,194,96,96,194,183,1,5,249,5,7,220,208,138,110,78,254,
+33,10,1,5,1,29,9,39,141,64,163,158,72,242,1,108,195,254,85,254,138,254,168,
+254,152,219,113,106,1,94,0,2,0,199,0,0,4,111,5,205,0,12,0,23,0,0,1,20,4,33,
+35,17,35,17,52,18,51,50,22,1,51,50,54,53,52,38,35,34,6,21,4,111,254,211,254,
+229,168,184,249,242,205,240,253,16,147,220,194,143,123,145,150,4,25,234,246,
+253,199,3,199,252,1,10,240,253,250,148,165,132,155,181,196,0,0,1,0,53,255,
+236,3,240,5,203,0,39,0,0,1,20,6,7,21,22,22,21,20,4,35,34,38,39,53,22,51,50,
+54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,3,186,163,
+148,178,187,254,215,246,113,217,78,200,198,167,193,198,207,140,84,211,199,
+155,146,177,159,74,85,221,124,230,241,4,96,140,181,25,8,26,183,145,194,238,
+42,37,160,88,137,129,148,135,154,124,129,120,124,104,135,57,64,186,0,0,1,
+0,199,0,0,3,254,5,182,0,5,0,0,51,17,51,17,33,21,199,184,2,127,5,182,250,238,
+164,0,0,2,0,0,255,236,4,135,5,182,0,18,0,28,0,0,1,23,22,22,21,20,6,35,34,
+38,53,52,55,55,1,51,1,1,51,1,52,39,6,21,20,22,51,50,54,2,178,75,70,66,176,
+137,142,167,138,70,254,25,201,1,129,1,119,198,254,86,149,140,75,67,74,73,
+2,233,114,108,165,69,139,170,158,145,138,213,109,2,207,253,193,2,63,251,105,
+106,209,204,115,71,81,87,0,3,255,217,255,236,4,195,5,203,0,36,0,48,0,61,0,
+0,1,50,22,21,20,6,7,23,32,23,7,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,
+35,34,39,55,22,23,38,38,53,52,54,3,20,22,51,50,54,53,52,38,39,6,6,1,34,6,
+21,20,22,23,62,2,53,52,38,2,98,179,229,208,183,121,1,44,171,64,113,124,131,
+248,221,216,249,223,184,49,70,35,248,159,62,111,124,42,50,240,115,153,136,
+149,143,103,97,192,189,1,51,122,134,77,73,138,136,74,136,5,203,180,144,137,
+190,33,68,96,127,64,14,116,153,155,182,185,159,148,208,31,26,45,97,125,68,
+14,42,125,56,156,182,251,145,103,122,108,97,83,139,46,22,121,3,116,101,103,
+65,112,41,20,55,86,65,86,110,0,0,2,0,125,255,236,4,127,5,203,0,25,0,39,0,
+0,1,54,54,51,50,18,21,20,6,6,35,32,0,17,16,0,33,50,23,7,38,38,35,34,2,17,
+1,50,54,53,52,38,35,34,6,6,21,20,22,22,1,74,52,197,134,195,243,124,225,138,
+254,247,254,238,1,70,1,30,203,154,64,59,141,85,202,226,1,89,133,170,155,142,
+93,151,88,89,144,3,4,103,110,254,253,220,147,242,137,1,126,1,115,1,93,1,145,
+86,156,31,49,254,227,254,248,253,131,197,157,163,177,87,148,76,101,188,94,
+0,0,2,0,201,255,236,4,203,5,203,0,15,0,27,0,0,1,54,51,50,18,17,16,0,35,34,
+38,39,21,35,17,51,17,22,22,51,32,17,16,2,35,34,6,7,1,129,115,239,236,252,
+254,247,253,109,168,47,184,184,26,171,118,1,78,176,162,115,162,34,4,227,232,
+254,127,254,147,254,147,254,124,111,102,193,5,182,251,242,126,159,2,80,1,
+36,1,42,148,137,0,1,0,104,255,236,4,4,5,203,0,37,0,0,1,20,4,35,32,39,53,22,
+22,51,50,54,53,52,38,38,39,38,38,53,52,36,51,50,23,7,38,35,34,6,21,20,22,
+22,23,30,2,4,4,254,236,246,254,252,142,93,221,96,164,166,60,141,143,203,174,
+1,1,210,219,184,57,188,162,130,147,57,127,136,163,160,76,1,135,191,220,69,
+176,40,46,126,110,73,94,82,52,74,201,159,171,202,82,158,78,112,101,72,95,
+78,50,60,113,147,0,2,0,102,0,0,5,27,5,182,0,25,0,34,0,0,19,52,54,51,50,22,
+23,17,51,17,54,54,53,52,39,55,4,17,20,4,7,17,35,17,38,36,37,52,38,35,34,6,
+21,16,5,102,168,140,80,118,29,184,138,159,147,76,1,4,254,250,224,184,249,
+254,226,2,23,108,89,67,80,1,88,3,55,151,183,84,78,1,211,252,90,13,150,114,
+151,56,143,89,254,255,182,238,22,254,145,1,109,9,245,26,161,193,90,80,254,
+234,27,0,0,1,0,199,255,238,4,178,5,184,0,13,0,0,1,16,2,33,32,17,17,51,17,
+20,22,51,32,17,4,178,255,254,253,254,23,184,153,162,1,66,2,45,254,231,254,
+218,2,16,3,186,252,107,215,191,1,160,0,1,0,88,255,236,4,16,5,203,0,21,0,0,
+37,50,18,17,16,2,35,34,7,39,54,51,32,0,17,16,0,33,34,39,53,22,1,156,204,230,
+219,209,134,151,45,165,187,1,38,1,50,254,171,254,214,178,135,163,141,1,58,
+1,26,1,29,1,43,68,158,72,254,129,254,147,254,157,254,112,65,180,84,0,0,1,
+0,199,0,0,4,113,5,182,0,9,0,0,1,35,17,51,17,1,51,17,35,17,1,127,184,184,2,
+57,185,185,1,188,3,250,252,203,1,188,251,195,3,113,0,1,0,201,0,0,4,188,5,
+182,0,17,0,0,19,51,17,20,2,7,51,1,51,17,35,17,52,18,55,35,1,35,201,172,10,
+5,9,2,129,204,172,14,3,8,253,125,205,5,182,252,221,85,254,232,42,4,186,250,
+74,3,27,104,1,21,41,251,63,0,0,1,0,55,0,0,6,51,5,182,0,20,0,0,1,23,17,51,
+17,5,7,39,17,35,1,3,35,1,55,1,19,51,1,17,37,3,106,232,190,1,35,90,201,186,
+254,197,197,135,254,104,133,1,76,205,123,1,2,254,186,4,221,137,1,98,254,45,
+172,141,117,252,225,1,57,254,199,1,135,135,254,189,1,53,254,254,2,145,191,
+0,0,3,0,125,255,236,5,10,5,205,0,11,0,22,0,33,0,0,1,16,0,33,32,0,17,16,0,
+33,32,0,3,16,2,39,17,23,7,39,17,54,18,1,23,17,6,2,17,16,18,23,17,39,5,10,
+254,206,254,237,254,233,254,207,1,48,1,26,1,19,1,48,194,167,159,240,47,193,
+159,167,253,133,184,159,167,168,158,237,2,221,254,158,254,113,1,137,1,106,
+1,104,1,134,254,114,254,158,1,12,1,40,22,253,244,179,161,139,254,61,23,1,
+44,2,46,137,1,174,23,254,216,254,247,254,244,254,214,24,2,31,174,0,0,2,0,
+90,255,236,3,211,4,94,0,23,0,35,0,0,1,50,22,23,38,38,35,34,7,39,54,51,50,
+0,17,16,2,35,34,38,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,1,236,91,
+155,48,10,171,134,142,136,50,156,174,235,1,15,240,221,118,198,112,220,210,
+111,141,147,113,110,126,137,2,238,69,65,170,181,68,141,78,254,203,254,252,
+254,238,254,217,105,186,110,169,200,253,147,151,113,89,122,124,109,105,137,
+0,1,0,88,255,236,3,152,4,94,0,37,0,0,1,21,35,32,21,20,22,51,50,54,55,21,6,
+35,34,38,53,52,54,55,53,38,38,53,52,54,51,50,22,23,7,38,38,35,34,21,20,33,
+2,215,149,254,202,148,143,85,171,100,139,227,220,241,113,131,99,106,231,191,
+111,173,87,68,99,132,74,248,1,57,2,133,147,189,89,93,39,47,158,75,171,148,
+99,131,38,11,28,128,93,135,156,37,41,143,44,28,156,168,0,2,0,88,255,238,3,
+244,4,94,0,17,0,36,0,0,1,50,18,17,16,0,35,34,38,53,52,54,55,38,38,53,52,54,
+23,34,6,21,20,22,51,51,21,35,32,21,20,22,51,50,54,53,16,2,23,234,243,254,
+244,244,192,220,130,108,91,104,220,179,109,112,145,164,76,84,254,168,124,
+118,157,162,4,94,254,224,254,231,254,244,254,213,169,148,110,133,29,31,126,
+87,138,165,147,87,75,88,80,145,193,81,95,212,210,1,166,0,0,3,0,113,255,236,
+4,104,4,94,0,11,0,26,0,36,0,0,1,16,0,35,34,0,17,16,0,51,50,0,1,20,22,51,50,
+54,55,6,35,34,38,53,52,55,6,1,50,55,2,37,6,6,21,20,22,4,104,254,242,242,229,
+254,238,1,13,241,235,1,14,252,195,165,157,138,160,19,60,20,179,177,24,227,
+2,59,33,39,5,254,216,7,13,114,2,37,254,248,254,207,1,53,1,6,1,14,1,41,254,
+208,254,247,208,212,167,163,8,170,178,77,80,58,254,169,6,1,129,21,19,84,45,
+144,120,0,0,2,0,113,255,236,4,104,4,94,0,12,0,23,0,0,1,16,0,35,34,38,2,53,
+16,0,51,50,0,1,20,22,51,50,54,53,52,38,35,32,4,104,254,240,240,149,230,124,
+1,12,242,232,1,17,252,195,163,159,157,164,165,159,254,193,2,39,254,243,254,
+210,139,1,4,172,1,12,1,43,254,207,254,250,207,215,215,207,207,209,0,3,0,113,
+255,236,4,104,4,94,0,12,0,19,0,26,0,0,1,16,0,35,34,38,2,53,16,0,51,50,0,1,
+20,22,23,17,6,6,5,52,38,39,17,54,54,4,104,254,240,240,149,230,124,1,12,242,
+232,1,17,252,195,136,130,131,135,2,131,136,130,136,130,2,39,254,243,254,210,
+139,1,4,172,1,12,1,43,254,207,254,250,190,211,17,3,62,17,207,188,184,209,
+19,252,194,19,220,0,1,0,31,0,0,3,20,4,74,0,11,0,0,19,23,17,51,17,5,7,39,17,
+35,17,37,111,211,180,1,30,73,213,180,254,221,3,70,117,1,121,254,39,154,152,
+115,254,78,2,14,160,0,0,1,0,20,255,225,3,125,4,74,0,16,0,0,1,17,35,38,38,
+35,34,6,7,39,54,54,51,50,22,23,17,3,125,174,37,146,94,94,132,32,164,49,223,
+150,80,144,47,4,74,251,182,77,87,98,97,49,146,162,56,47,3,107,0,1,0,29,0,
+0,3,51,4,74,0,6,0,0,33,35,1,55,5,17,51,3,51,164,253,142,92,2,6,180,1,27,143,
+233,3,137,0,1,0,20,0,0,4,66,4,74,0,12,0,0,33,35,1,3,35,1,55,1,19,51,23,17,
+51,4,66,166,254,247,167,127,254,167,125,1,19,174,113,202,181,1,4,254,252,
+1,88,117,254,233,1,6,206,3,92,0,0,1,0,174,0,0,4,23,4,104,0,15,0,0,51,17,51,
+22,22,51,50,55,23,6,6,35,34,38,39,17,174,174,37,146,94,194,64,164,50,223,
+149,78,145,48,4,74,77,87,194,49,148,159,54,48,252,150,0,2,0,111,0,0,3,143,
+4,90,0,12,0,22,0,0,19,52,54,51,50,22,21,17,35,17,35,34,38,37,16,35,34,6,21,
+20,22,51,51,111,206,177,198,219,180,131,239,250,2,108,227,96,113,155,177,
+104,2,254,160,188,199,198,253,51,1,158,182,109,1,6,106,87,111,102,0,2,0,82,
+255,238,4,84,4,74,0,24,0,34,0,0,19,52,54,55,17,51,17,22,22,21,20,6,7,39,54,
+53,52,38,39,21,20,6,35,34,38,1,6,6,21,20,22,51,50,54,53,82,244,198,181,185,
+218,128,116,69,129,115,104,166,152,143,162,1,186,128,130,68,59,66,65,1,27,
+146,191,13,1,209,254,45,15,184,141,108,160,41,127,50,124,79,103,14,172,148,
+175,159,1,88,9,112,90,72,73,90,74,0,0,4,0,88,255,238,3,244,4,94,0,17,0,26,
+0,36,0,45,0,0,1,50,18,17,16,0,35,34,38,53,52,54,55,38,38,53,52,54,1,38,38,
+39,6,21,20,22,23,37,20,33,38,38,53,52,55,6,6,19,50,54,55,35,32,21,20,22,2,
+23,234,243,254,244,244,192,220,130,108,91,104,220,1,218,11,109,93,18,62,51,
+254,106,1,12,43,45,21,97,104,207,147,164,6,215,254,168,134,4,94,254,224,254,
+231,254,244,254,213,169,148,110,133,29,31,126,87,136,167,254,29,145,176,25,
+49,74,71,120,32,180,180,40,113,62,72,61,3,87,253,2,189,180,193,84,92,0,0,
+1,0,119,255,236,4,197,4,74,0,35,0,0,5,34,2,17,52,18,55,51,6,2,21,20,22,51,
+50,17,17,51,17,16,51,50,17,52,2,39,51,22,18,21,16,33,34,38,39,6,1,178,160,
+155,52,58,185,48,67,81,75,131,172,125,157,47,65,186,56,51,254,194,90,120,
+23,61,20,1,11,1,11,150,1,18,160,140,254,224,158,193,190,1,6,1,8,254,248,254,
+250,1,127,139,1,9,182,154,254,239,157,253,234,90,77,167,0,3,0,61,0,0,5,125,
+4,88,0,27,0,36,0,41,0,0,1,6,6,7,3,35,3,38,38,53,52,54,51,50,22,23,23,22,22,
+51,50,55,19,51,3,54,54,55,37,34,6,21,20,22,23,39,38,1,7,35,39,19,5,125,73,
+203,115,166,215,148,197,227,127,99,107,130,37,64,9,94,34,49,57,144,182,137,
+60,130,56,252,14,28,40,129,95,62,36,1,227,36,38,101,84,2,213,75,109,25,253,
+252,2,10,41,200,132,97,120,118,134,231,2,9,5,1,219,254,73,20,84,58,150,36,
+42,71,134,26,198,111,254,37,2,4,254,213,0,2,0,82,0,0,4,84,4,92,0,24,0,34,
+0,0,1,20,6,7,17,35,17,38,38,53,52,54,55,23,6,21,20,22,23,53,52,54,51,50,22,
+1,54,54,53,52,38,35,34,6,21,4,84,241,201,181,184,219,128,116,69,129,116,103,
+166,152,140,165,254,70,128,130,69,58,66,65,3,47,146,190,14,254,47,1,211,13,
+186,141,108,160,41,127,52,122,79,104,14,173,148,175,157,254,165,10,111,90,
+73,73,90,74,0,1,0,31,0,0,2,207,4,74,0,5,0,0,1,17,35,17,33,53,2,207,180,254,
+4,4,74,251,182,3,178,152,0,2,0,88,255,238,3,244,4,94,0,20,0,40,0,0,33,35,
+53,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,23,53,51,5,34,6,21,20,22,51,
+51,21,35,32,21,20,22,51,50,54,55,53,2,3,244,181,123,229,179,212,130,108,91,
+104,215,172,204,109,181,254,30,109,112,145,164,76,84,254,168,124,118,156,
+163,4,9,150,168,172,145,110,133,29,31,126,87,137,166,145,125,127,87,75,88,
+80,145,193,81,95,207,194,39,1,148,0,0,1,0,31,0,0,3,117,4,92,0,14,0,0,19,52,
+54,51,32,17,17,35,17,52,38,35,34,6,21,31,222,218,1,158,178,119,125,134,124,
+2,158,221,225,254,101,253,63,2,166,149,140,148,149,0,0,3,0,113,255,238,3,
+223,4,94,0,15,0,28,0,41,0,0,37,6,35,34,2,17,16,18,51,50,22,23,53,51,17,35,
+3,34,6,21,20,22,22,51,50,54,53,52,38,3,34,38,39,22,22,51,50,54,55,53,6,6,
+3,41,87,202,197,210,221,207,88,143,37,182,182,254,102,140,65,117,76,99,139,
+142,104,80,142,42,7,137,114,92,136,24,42,128,160,178,1,43,1,12,1,19,1,38,
+85,79,144,251,182,3,203,149,103,60,112,66,145,101,107,137,253,155,76,66,172,
+197,111,88,162,65,69,0,0,1,0,113,255,236,3,147,4,94,0,22,0,0,5,34,0,17,16,
+0,51,50,22,23,7,38,35,34,6,21,20,22,51,50,55,21,6,2,102,237,254,248,1,11,
+247,80,157,51,55,139,98,166,158,158,155,145,140,114,20,1,35,1,16,1,20,1,43,
+33,26,150,52,209,207,199,211,64,160,59,0,1,0,96,0,0,3,102,4,90,0,26,0,0,1,
+34,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,23,1,35,19,6,
+1,231,179,212,252,207,86,168,61,79,122,122,124,142,128,115,59,122,34,117,
+254,219,209,254,52,1,109,190,170,177,212,47,41,133,74,125,113,104,115,34,
+27,94,254,35,1,121,12,0,2,0,119,255,236,4,197,4,90,0,17,0,34,0,0,1,20,22,
+51,50,17,17,51,17,16,51,50,17,52,38,35,34,6,7,52,18,54,51,32,0,17,16,33,34,
+38,39,6,35,34,2,1,43,81,75,131,172,125,157,188,182,183,188,180,133,250,170,
+1,0,1,37,254,194,90,120,23,61,175,160,155,2,0,193,190,1,6,1,8,254,248,254,
+250,1,127,222,231,232,219,179,1,17,148,254,191,254,233,253,234,90,77,167,
+1,11,0,0,3,0,119,255,236,4,197,4,90,0,16,0,37,0,47,0,0,19,52,18,54,51,32,
+0,17,16,33,34,38,39,6,35,34,2,19,20,22,51,50,17,53,51,21,16,51,50,17,6,35,
+34,38,53,52,55,4,37,6,21,20,22,51,50,54,55,2,119,133,250,170,1,0,1,37,254,
+194,90,120,23,61,175,160,155,180,81,75,131,172,125,157,58,77,166,182,10,254,
+244,1,129,8,115,135,31,60,17,48,2,2,179,1,17,148,254,191,254,233,253,234,
+90,77,167,1,11,1,9,193,190,1,6,66,66,254,250,1,139,12,167,167,58,50,65,76,
+43,48,140,118,8,3,1,71,0,2,0,166,0,0,3,199,4,90,0,12,0,22,0,0,1,20,6,35,35,
+17,35,17,52,54,51,50,22,1,51,50,54,53,52,38,35,34,17,3,199,252,238,131,180,
+219,199,177,206,253,147,105,176,155,111,98,227,2,254,171,181,254,98,2,205,
+198,199,187,254,146,100,113,87,106,254,250,0,1,0,82,255,240,3,139,4,88,0,
+35,0,0,1,20,6,7,22,21,20,6,35,34,39,53,22,51,50,54,53,52,38,35,35,53,51,50,
+54,53,52,38,35,34,7,39,54,51,50,22,3,94,99,99,243,253,210,206,146,185,159,
+136,145,157,163,131,86,171,151,113,119,145,137,78,180,197,204,199,3,63,89,
+132,35,61,199,147,184,65,148,70,96,82,98,93,143,85,83,75,87,82,127,98,150,
+0,0,1,0,174,0,0,3,94,4,74,0,5,0,0,51,17,51,17,33,21,174,180,1,252,4,74,252,
+78,152,0,0,2,255,231,255,233,3,227,4,74,0,19,0,31,0,0,1,30,2,21,20,6,35,34,
+38,53,52,54,54,55,1,51,1,1,51,1,52,38,39,6,6,21,20,22,51,50,54,2,84,77,55,
+30,148,118,120,143,28,52,80,254,98,205,1,53,1,48,202,254,113,61,48,47,51,
+53,47,54,53,2,47,102,98,93,43,111,135,124,116,43,92,95,110,2,29,254,98,1,
+158,252,147,44,116,57,59,117,45,44,56,61,0,3,0,16,255,240,4,115,4,88,0,35,
+0,46,0,57,0,0,1,50,22,21,20,5,23,4,23,7,38,38,39,22,21,20,6,6,35,34,38,53,
+52,54,55,39,36,39,55,22,22,23,38,53,52,54,3,20,22,51,50,54,53,52,38,39,4,
+19,34,6,21,20,22,23,36,53,52,38,2,70,157,199,254,197,67,1,49,144,60,38,143,
+54,114,95,179,127,185,204,173,161,66,254,248,156,56,36,143,44,80,200,73,121,
+104,108,118,84,68,254,213,231,89,105,48,65,1,14,102,4,88,138,116,186,72,41,
+13,71,119,21,54,9,77,121,73,117,68,138,122,106,148,30,43,4,91,114,22,55,7,
+78,86,113,139,252,172,65,78,74,71,47,97,34,19,2,48,68,59,45,79,40,28,136,
+60,67,0,2,0,113,255,236,3,233,4,94,0,23,0,35,0,0,1,50,22,21,20,6,6,35,34,
+2,17,16,0,51,50,23,7,38,35,34,6,7,54,54,19,50,54,53,52,38,35,34,6,21,20,22,
+2,88,181,220,112,197,119,220,240,1,15,234,176,154,49,139,139,137,171,8,48,
+156,62,106,138,126,109,112,149,142,2,238,199,170,110,186,105,1,39,1,18,1,
+5,1,52,78,141,68,184,167,65,69,253,147,136,106,109,124,122,89,113,151,0,2,
+0,174,255,236,4,29,4,92,0,16,0,30,0,0,1,54,54,51,50,18,17,20,6,6,35,34,39,
+21,35,17,51,17,22,22,51,50,54,53,52,38,38,35,34,6,7,1,100,38,149,102,196,
+212,103,191,134,184,85,182,182,22,134,88,132,134,65,114,79,93,133,26,3,174,
+82,92,254,214,254,243,186,253,130,161,141,4,74,252,254,89,110,215,205,138,
+186,94,110,101,0,1,0,104,255,236,3,121,4,94,0,35,0,0,1,20,6,35,34,39,53,22,
+51,50,54,53,52,38,39,46,2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,30,2,
+3,121,230,208,217,128,181,168,136,124,119,152,155,126,59,220,192,187,163,
+61,167,134,112,116,100,183,137,131,62,1,47,154,169,69,164,88,88,74,65,90,
+58,60,85,106,76,135,156,74,143,70,71,62,60,79,70,51,88,110,0,2,0,82,0,0,4,
+84,4,74,0,27,0,37,0,0,19,52,54,51,50,22,23,17,51,17,54,54,53,52,38,39,55,
+22,22,21,20,6,7,21,35,53,38,38,37,52,38,38,35,34,6,21,20,5,82,142,116,60,
+103,21,181,105,120,60,65,59,120,124,211,192,181,206,236,1,186,38,68,41,56,
+55,1,2,2,90,126,146,59,59,1,86,253,69,15,106,74,53,81,17,138,32,151,110,141,
+178,21,250,250,11,187,37,74,112,58,69,54,190,23,0,0,1,0,174,255,238,4,4,4,
+74,0,14,0,0,1,20,6,35,32,17,17,51,17,20,22,51,50,54,53,4,4,222,218,254,98,
+178,119,125,134,124,1,172,221,225,1,155,2,193,253,90,149,140,147,150,0,1,
+0,68,255,236,3,102,4,94,0,23,0,0,5,34,38,39,53,22,22,51,50,54,53,16,33,34,
+7,39,54,54,51,50,18,17,16,0,1,94,79,122,69,59,136,90,155,164,254,182,139,
+106,41,53,166,88,248,247,254,238,20,28,37,160,29,41,209,193,1,168,54,152,
+27,32,254,228,254,235,254,238,254,209,0,1,0,143,0,0,3,182,4,72,0,9,0,0,1,
+35,17,51,17,1,51,17,35,17,1,59,172,185,1,192,174,184,1,68,3,4,253,192,1,45,
+252,203,2,106,0,1,0,174,0,0,4,16,4,74,0,14,0,0,19,51,17,7,7,21,1,51,17,35,
+17,52,55,1,35,174,170,3,3,2,2,188,166,11,253,245,188,4,74,253,159,139,80,
+20,3,80,251,182,2,90,119,137,252,166,0,1,0,20,0,0,5,61,4,74,0,20,0,0,1,23,
+7,39,17,35,1,3,35,1,55,1,19,51,23,17,37,55,23,53,51,4,66,251,84,167,166,254,
+247,167,127,254,167,125,1,19,174,113,202,254,240,86,186,181,2,250,129,141,
+86,253,190,1,4,254,252,1,88,117,254,233,1,6,206,1,176,141,139,96,244,0,0,
+3,0,113,255,236,4,104,4,94,0,12,0,23,0,34,0,0,1,16,0,35,34,38,2,53,16,0,51,
+50,0,3,52,38,39,17,23,7,39,17,54,54,37,20,22,23,17,39,55,23,17,6,6,4,104,
+254,240,240,149,230,124,1,12,242,232,1,17,186,136,130,172,47,125,136,130,
+253,125,136,130,180,47,133,131,135,2,39,254,243,254,210,139,1,4,172,1,12,
+1,43,254,207,254,250,184,209,19,254,143,129,154,95,254,239,19,220,179,190,
+211,17,1,98,138,153,100,1,29,17,207,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,
+0,94,0,0,0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,128,0,3,0,1,4,9,
+0,3,0,72,0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,0,30,0,214,0,3,0,
+1,4,9,0,6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,9,0,8,0,42,1,86,
+0,3,0,1,4,9,0,9,0,40,1,128,0,3,0,1,4,9,0,10,0,96,1,168,0,3,0,1,4,9,0,11,0,
+62,2,8,0,3,0,1,4,9,0,12,0,60,2,70,0,3,0,1,4,9,0,13,2,150,2,130,0,3,0,1,4,
+9,0,14,0,52,5,24,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,
+0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,68,0,101,0,115,0,101,0,114,0,101,0,
+116,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,
+0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,68,0,101,0,
+115,0,101,0,114,0,101,0,116,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,
+0,115,0,68,0,101,0,115,0,101,0,114,0,101,0,116,0,78,0,111,0,116,0,111,0,32,
+0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,
+0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,};
+#endif
@@ -0,0 +1,5481 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansDevanagari_Regular_ttf_size = 144816;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansDevanagari_Regular_ttf");
+asm(".type fz_font_NotoSansDevanagari_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansDevanagari_Regular_ttf, 144816");
+asm(".balign 64");
+asm("fz_font_NotoSansDevanagari_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansDevanagari-Regular.ttf\"");
+#else
+const int fz_font_NotoSansDevanagari_Regular_ttf_size = 144816;
+const char fz_font_NotoSansDevanagari_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,204,167,204,168,0,1,109,104,0,0,8,
+124,71,80,79,83,214,144,177,100,0,1,117,228,0,0,31,34,71,83,85,66,10,154,
+104,244,0,1,149,8,0,0,160,166,79,83,47,50,248,164,104,116,0,0,1,104,0,0,0,
+96,99,109,97,112,147,222,86,123,0,0,15,180,0,0,0,250,103,97,115,112,0,7,0,
+7,0,1,109,92,0,0,0,12,103,108,121,102,233,170,226,41,0,0,23,188,0,1,79,104,
+104,101,97,100,2,215,159,219,0,0,0,236,0,0,0,54,104,104,101,97,13,151,1,2,
+0,0,1,36,0,0,0,36,104,109,116,120,10,54,218,223,0,0,1,200,0,0,13,234,108,
+111,99,97,111,46,192,45,0,0,16,176,0,0,7,12,109,97,120,112,3,157,0,254,0,
+0,1,72,0,0,0,32,110,97,109,101,143,178,186,242,0,1,103,36,0,0,6,24,112,111,
+115,116,255,105,0,102,0,1,109,60,0,0,0,32,0,1,0,0,0,1,15,92,231,23,33,114,
+95,15,60,245,0,11,8,0,0,0,0,0,203,39,119,251,0,0,0,0,210,40,203,229,251,38,
+252,218,11,66,10,199,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,44,252,188,0,0,10,
+5,251,38,246,208,11,66,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,112,0,1,0,0,3,133,
+0,120,0,10,0,132,0,10,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,4,79,1,144,
+0,5,0,0,5,153,5,51,0,0,0,191,5,153,5,51,0,0,2,130,0,102,2,129,0,0,2,11,5,
+2,4,5,4,2,2,4,0,0,128,0,0,0,0,0,0,0,0,0,0,16,0,0,71,79,79,71,0,64,0,0,254,
+255,7,44,252,188,0,0,7,44,3,68,0,0,0,1,0,0,0,0,4,250,4,250,0,0,0,32,0,4,4,
+205,0,193,0,0,0,0,2,20,0,0,2,20,0,0,0,0,253,48,0,0,253,48,0,0,254,133,2,46,
+0,159,6,29,0,60,6,29,0,60,8,47,0,60,3,202,0,0,3,202,0,0,4,98,0,0,6,31,0,0,
+6,210,0,0,5,152,0,0,4,109,0,0,4,109,0,0,4,109,0,0,4,109,0,0,8,47,0,60,8,47,
+0,60,8,47,0,60,8,47,0,60,6,25,0,0,6,139,0,0,4,129,0,0,4,186,0,0,5,148,0,0,
+5,19,0,0,5,155,0,0,5,240,0,0,5,234,0,0,5,239,0,0,4,8,0,0,4,174,0,0,5,5,0,
+0,4,128,0,0,5,200,0,0,4,143,0,0,5,34,0,95,4,40,0,0,4,236,0,87,4,112,0,0,4,
+112,0,0,4,140,0,0,6,43,0,0,4,145,0,0,5,159,0,95,4,200,0,0,4,164,0,0,3,70,
+0,0,3,70,0,0,5,109,0,0,6,21,0,0,6,21,0,0,4,115,0,0,5,113,0,81,4,160,0,0,5,
+95,0,0,4,64,0,0,0,0,254,164,2,18,0,0,0,0,253,76,3,189,0,53,2,18,0,0,2,18,
+0,0,2,18,254,64,0,0,252,92,0,0,253,87,0,0,253,224,0,0,253,224,0,0,253,48,
+0,0,252,51,0,0,252,186,0,0,252,147,2,18,255,6,2,18,254,69,2,18,254,204,2,
+18,254,165,0,0,254,145,2,48,0,212,2,18,254,45,7,56,0,60,0,0,254,164,0,0,252,
+179,0,0,253,223,0,0,254,147,0,0,253,73,0,0,251,254,0,0,251,254,6,25,0,0,6,
+139,0,0,4,129,0,0,5,240,0,0,5,5,0,0,4,128,0,0,6,43,0,0,4,164,0,0,6,210,0,
+0,5,152,0,0,0,0,252,69,0,0,252,69,3,8,1,142,4,202,1,142,4,104,0,153,4,104,
+1,7,4,104,0,173,4,104,0,184,4,104,0,130,4,104,0,172,4,104,0,211,4,104,0,78,
+4,104,0,148,4,104,0,145,3,104,0,132,2,138,0,215,6,29,0,60,6,29,0,60,8,47,
+0,60,8,47,0,60,6,29,0,60,6,29,0,60,4,112,0,0,5,240,0,0,4,164,0,0,4,129,0,
+0,5,200,0,0,3,193,0,129,5,5,0,0,4,145,0,0,2,126,0,166,0,0,255,202,0,0,254,
+213,4,20,0,106,6,29,0,60,6,29,0,60,8,47,0,60,3,202,0,0,3,202,0,0,4,98,0,0,
+6,31,0,0,6,210,0,0,5,152,0,0,4,109,0,0,4,109,0,0,4,109,0,0,4,109,0,0,8,47,
+0,60,8,47,0,60,8,47,0,60,8,47,0,60,6,210,0,0,5,152,0,0,6,29,0,60,4,186,0,
+0,5,148,0,0,5,19,0,0,5,155,0,0,5,234,0,0,5,239,0,0,4,8,0,0,4,174,0,0,5,200,
+0,0,4,143,0,0,5,34,0,95,4,40,0,0,4,236,0,87,4,140,0,0,4,145,0,0,5,159,0,95,
+4,200,0,0,5,109,0,0,4,115,0,0,5,113,0,81,4,160,0,0,5,95,0,0,4,64,0,0,5,178,
+0,95,5,33,0,0,0,0,254,21,0,0,252,70,4,180,0,0,5,47,0,0,2,76,0,0,2,207,0,0,
+5,148,0,0,3,42,0,0,5,155,0,0,4,148,0,0,3,216,0,0,4,81,0,0,4,8,0,0,4,174,0,
+0,5,5,0,0,4,128,0,0,3,188,0,0,2,243,0,0,3,28,0,95,4,40,0,0,2,229,0,87,2,221,
+0,0,2,118,0,0,4,198,0,0,3,54,0,0,3,132,0,95,2,143,0,0,2,160,0,0,3,50,0,0,
+4,0,0,0,5,187,0,0,3,34,0,0,3,75,0,81,3,3,0,0,3,28,0,0,3,220,0,0,4,148,0,0,
+2,160,0,0,3,174,0,95,3,89,0,0,4,180,0,0,5,47,0,0,2,76,0,0,2,207,0,0,5,148,
+0,0,3,42,0,0,5,155,0,0,4,148,0,0,3,216,0,0,4,81,0,0,4,8,0,0,4,174,0,0,5,5,
+0,0,4,128,0,0,3,188,0,0,2,243,0,0,3,28,0,95,4,40,0,0,2,229,0,87,2,221,0,0,
+2,118,0,0,4,198,0,0,3,54,0,0,3,132,0,95,2,143,0,0,2,160,0,0,4,0,0,0,5,187,
+0,0,3,34,0,0,3,75,0,81,3,3,0,0,3,28,0,0,3,220,0,0,6,25,0,0,6,139,0,0,4,129,
+0,0,4,186,0,0,5,148,0,0,5,19,0,0,5,155,0,0,6,54,0,0,6,104,0,0,6,43,0,0,4,
+8,0,0,4,174,0,0,5,5,0,0,4,128,0,0,5,200,0,0,4,106,0,0,5,34,0,95,4,40,0,0,
+4,236,0,87,4,112,0,0,4,140,0,0,6,43,0,0,4,145,0,0,5,159,0,95,4,200,0,0,4,
+164,0,0,3,70,255,233,5,149,0,0,6,21,0,0,4,115,0,0,5,150,0,57,4,160,0,0,5,
+185,0,0,4,114,0,0,4,112,0,0,6,54,0,0,4,164,0,0,6,12,0,95,5,188,0,0,6,25,0,
+0,6,139,0,0,4,129,0,0,4,186,0,0,5,148,0,0,5,19,0,0,5,155,0,0,6,54,0,0,6,104,
+0,0,6,43,0,0,4,8,0,0,4,174,0,0,5,5,0,0,4,128,0,0,5,200,0,0,4,106,0,0,5,34,
+0,95,4,40,0,0,4,236,0,87,4,112,0,0,4,140,0,0,6,43,0,0,4,145,0,0,5,159,0,95,
+4,200,0,0,4,164,0,0,3,70,255,233,5,149,0,0,6,21,0,0,4,115,0,0,5,150,0,57,
+4,160,0,0,5,185,0,0,4,114,0,0,4,180,0,0,5,47,0,0,2,176,0,0,2,207,0,0,5,148,
+0,0,5,148,0,0,3,42,0,0,5,155,0,0,4,218,0,0,5,12,0,0,4,207,0,0,4,8,0,0,4,8,
+0,0,4,174,0,0,4,174,0,0,5,5,0,0,5,5,0,0,4,128,0,0,4,128,0,0,3,246,0,0,3,14,
+0,0,3,28,0,95,4,40,0,0,2,229,0,87,3,20,0,0,2,118,0,0,4,198,0,0,3,54,0,0,4,
+67,0,95,3,108,0,0,2,160,0,0,3,50,0,0,4,0,0,0,5,187,0,0,3,34,0,0,4,58,0,57,
+3,3,0,0,4,113,0,0,4,114,0,0,4,218,0,0,2,160,0,0,4,176,0,95,4,96,0,0,4,180,
+0,0,5,47,0,0,2,176,0,0,2,207,0,0,5,148,0,0,3,42,0,0,5,155,0,0,4,218,0,0,5,
+12,0,0,4,207,0,0,4,8,0,0,4,174,0,0,5,5,0,0,4,128,0,0,3,246,0,0,3,14,0,0,3,
+28,0,95,4,40,0,0,2,229,0,87,3,20,0,0,2,118,0,0,4,198,0,0,3,54,0,0,4,67,0,
+95,3,108,0,0,2,160,0,0,4,0,0,0,5,187,0,0,3,34,0,0,4,58,0,57,3,3,0,0,4,113,
+0,0,4,114,0,0,4,64,0,0,4,64,0,0,4,103,0,0,4,103,0,0,4,64,0,0,4,64,0,0,4,103,
+0,0,4,103,0,0,4,114,0,0,4,114,0,0,4,128,0,0,6,75,0,0,4,40,0,0,4,40,0,0,4,
+40,0,0,4,128,0,0,6,75,0,0,4,40,0,0,4,40,0,0,4,40,0,0,0,0,254,133,0,0,253,
+255,0,0,253,255,2,18,0,0,2,18,0,0,2,18,0,0,2,18,254,64,2,18,254,64,2,18,254,
+64,0,0,251,220,0,0,251,200,0,0,251,200,0,0,252,51,0,0,252,51,0,0,252,51,0,
+0,252,186,0,0,252,186,0,0,252,186,0,0,252,147,0,0,252,147,0,0,252,147,2,18,
+253,238,2,18,253,218,2,18,253,218,2,18,254,69,2,18,254,69,2,18,254,69,2,18,
+254,204,2,18,254,204,2,18,254,204,2,18,254,165,2,18,254,165,2,18,254,165,
+2,18,254,45,2,18,253,168,2,18,253,168,0,0,254,21,6,29,0,60,3,202,0,0,4,109,
+0,0,4,109,0,0,4,109,0,0,8,47,0,60,8,47,0,60,8,47,0,60,8,47,0,60,6,29,0,60,
+6,29,0,60,8,47,0,60,8,47,0,60,6,29,0,60,3,202,0,0,4,109,0,0,4,109,0,0,4,109,
+0,0,8,47,0,60,8,47,0,60,8,47,0,60,8,47,0,60,6,29,0,60,6,253,0,0,5,148,0,0,
+5,148,0,0,9,232,0,0,10,0,0,0,10,5,0,0,4,8,0,0,4,8,0,0,4,96,0,0,4,96,0,0,8,
+28,0,0,4,174,0,0,9,7,0,0,5,5,0,0,5,5,0,0,5,5,0,0,9,82,0,0,4,128,0,0,8,218,
+0,0,5,115,0,0,3,215,0,0,5,184,0,0,4,40,0,0,5,9,0,0,6,83,0,0,4,245,0,0,6,84,
+0,0,8,154,0,0,4,81,0,0,5,219,0,0,5,121,0,0,3,233,0,0,4,236,0,0,4,140,0,0,
+7,96,0,0,5,145,0,57,4,53,0,57,5,145,0,57,4,53,0,57,8,111,0,57,5,165,0,57,
+4,172,0,0,4,172,0,0,4,201,0,0,4,201,0,0,6,10,0,0,5,116,0,0,6,103,0,0,6,75,
+0,0,6,40,0,0,6,10,0,0,5,152,0,0,5,152,0,0,5,152,0,0,5,152,0,0,8,174,0,57,
+5,95,0,0,3,75,0,0,5,95,0,0,3,75,0,0,5,155,0,0,5,155,0,0,5,155,0,0,5,155,0,
+0,7,101,0,95,7,101,0,95,6,0,0,95,6,0,0,95,7,101,0,95,7,101,0,95,6,0,0,95,
+6,0,0,95,4,104,0,181,4,104,0,114,4,104,0,167,2,18,0,0,2,18,0,0,2,18,0,0,2,
+18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,
+0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,
+0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,
+2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,
+18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,
+0,0,2,18,0,0,2,18,0,0,2,18,0,0,0,0,0,0,2,18,253,208,2,18,253,96,2,18,252,
+127,2,18,253,208,2,18,253,96,2,18,252,127,2,18,253,208,2,18,253,96,2,18,252,
+127,2,18,253,208,2,18,253,96,2,18,252,127,0,0,251,188,0,0,251,188,0,0,252,
+219,0,0,252,2,0,0,252,2,0,0,252,122,0,0,252,122,0,0,252,122,0,0,252,122,0,
+0,252,69,0,0,251,48,0,0,251,48,0,0,251,48,0,0,252,69,0,0,251,48,0,0,253,96,
+0,0,251,38,0,0,251,38,0,0,251,38,0,0,251,38,5,148,0,0,5,155,0,0,4,8,0,0,4,
+174,0,0,5,5,0,0,4,128,0,0,6,21,0,0,5,152,0,0,5,148,0,0,5,155,0,0,4,8,0,0,
+4,174,0,0,5,5,0,0,4,128,0,0,6,21,0,0,5,152,0,0,3,168,0,57,0,0,252,15,0,0,
+252,15,0,0,251,80,0,0,252,124,0,0,252,124,0,0,251,80,0,0,252,70,0,0,252,70,
+0,0,251,80,0,0,252,124,0,0,252,69,0,0,252,69,0,0,252,70,0,0,252,70,0,0,251,
+80,0,0,252,124,0,0,251,81,0,0,252,156,0,0,251,81,0,0,252,92,0,0,253,87,0,
+0,253,224,0,0,253,224,0,0,252,69,0,0,252,69,0,0,254,145,0,0,251,254,0,0,251,
+254,4,81,0,0,6,143,0,0,0,0,253,98,0,0,253,247,0,0,254,164,2,18,0,0,0,0,251,
+220,0,0,252,51,0,0,252,186,0,0,252,147,2,18,253,238,2,18,254,69,2,18,254,
+204,2,18,254,165,2,18,254,45,2,18,254,64,2,18,253,208,2,18,253,96,2,18,252,
+127,0,0,253,235,2,18,255,253,0,0,251,200,0,0,252,51,0,0,252,186,0,0,252,147,
+2,18,253,218,2,18,254,69,2,18,254,204,2,18,254,165,2,18,253,168,2,18,0,0,
+2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,18,0,0,2,
+18,0,0,2,18,0,0,2,18,0,0,2,18,254,64,2,18,253,208,2,18,253,96,2,18,252,127,
+0,0,252,124,0,0,252,66,0,0,252,66,0,0,252,27,3,17,1,43,4,4,0,235,5,57,0,70,
+6,159,0,117,2,156,0,235,2,212,0,140,2,212,0,120,4,219,0,150,4,104,0,102,2,
+0,0,63,2,184,0,100,2,37,0,147,3,111,0,86,4,104,0,98,4,104,0,178,4,104,0,96,
+4,104,0,82,4,104,0,23,4,104,0,131,4,104,0,113,4,104,0,90,4,104,0,106,4,104,
+0,106,2,91,0,175,2,91,0,91,4,104,0,102,4,104,0,102,4,104,0,102,4,36,0,146,
+2,217,0,221,3,111,0,86,2,217,0,110,4,104,0,60,3,74,255,252,3,32,0,90,4,81,
+1,92,3,2,0,110,4,104,0,102,2,184,0,100,4,0,0,82,8,0,0,82,2,127,0,168,2,126,
+0,166,3,255,0,169,3,255,0,166,6,111,0,147,4,104,0,141,4,104,0,102,4,104,0,
+102,4,104,0,147,0,0,0,0,0,0,253,76,1,229,0,160,3,127,0,160,5,25,0,160,4,250,
+0,81,4,250,0,81,4,250,0,81,3,174,0,137,4,18,0,117,2,116,254,191,2,179,254,
+191,0,0,254,39,0,0,254,83,0,0,254,70,0,0,254,77,0,0,254,38,0,0,254,28,0,0,
+254,31,0,0,253,222,0,0,254,46,0,0,254,24,0,0,253,47,0,0,253,172,0,0,253,68,
+0,0,253,159,0,0,253,176,0,0,254,20,0,0,253,7,0,0,254,20,4,47,0,110,4,67,0,
+120,4,67,0,120,4,67,0,120,4,67,0,120,4,67,0,120,5,215,0,118,5,96,0,118,0,
+0,254,174,5,145,0,180,0,0,253,37,0,0,253,37,0,0,253,63,2,50,0,102,0,0,253,
+214,0,0,252,75,0,0,252,139,0,0,252,116,0,0,253,48,0,0,253,143,0,0,254,54,
+0,0,253,214,0,0,254,164,0,0,254,92,0,0,253,112,0,0,252,78,3,137,0,83,3,43,
+255,180,0,0,253,204,1,173,255,0,1,163,0,74,1,163,0,74,1,173,255,0,2,47,255,
+0,1,174,255,186,6,98,0,105,5,252,0,87,6,2,0,87,6,160,0,87,0,0,254,164,4,79,
+0,115,3,175,0,119,4,89,0,83,4,7,0,74,4,29,0,79,4,87,0,79,0,0,253,48,4,46,
+0,93,4,110,0,105,0,0,253,67,0,0,251,247,0,0,251,184,0,0,252,178,0,0,252,130,
+0,0,252,155,0,0,252,38,0,0,252,108,0,0,252,120,0,0,251,175,0,0,251,108,2,
+96,0,19,3,209,0,74,3,209,0,74,3,220,255,186,3,43,0,63,0,0,253,37,253,37,253,
+63,253,48,254,39,254,83,254,70,254,77,254,38,254,28,254,31,253,222,254,46,
+254,24,253,47,253,172,253,68,253,159,253,176,254,20,253,7,254,20,0,0,0,0,
+0,1,0,3,0,1,0,0,0,12,0,4,0,238,0,0,0,52,0,32,0,4,0,20,0,0,0,13,0,35,0,37,
+0,63,0,95,0,126,0,160,0,175,0,215,0,247,2,188,9,127,28,246,32,13,32,20,32,
+25,32,29,32,38,32,185,34,18,37,204,168,57,168,251,254,255,255,255,0,0,0,0,
+0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,175,0,215,0,247,2,188,9,0,28,208,32,
+11,32,19,32,24,32,28,32,38,32,185,34,18,37,204,168,48,168,224,254,255,255,
+255,0,1,255,245,0,0,2,188,2,187,2,160,2,133,255,99,2,85,2,53,2,22,253,200,
+247,4,230,104,0,0,226,242,226,239,226,237,226,229,226,86,224,252,218,187,
+90,226,90,60,4,17,0,1,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,222,2,223,2,
+224,3,16,0,133,0,134,0,0,0,0,0,21,0,21,0,21,0,21,0,67,0,115,0,147,0,201,0,
+213,1,43,1,134,1,220,1,232,2,42,2,132,2,247,3,106,3,118,3,130,3,209,3,221,
+3,233,3,245,4,1,4,13,4,99,4,203,4,239,5,51,5,154,5,212,6,68,6,126,6,233,7,
+42,7,99,7,165,7,245,8,70,8,124,8,169,8,242,9,67,9,156,9,189,9,245,10,36,10,
+112,10,176,10,243,11,31,11,87,11,145,11,225,12,40,12,144,12,156,12,209,13,
+38,13,90,13,162,13,239,14,2,14,14,14,42,14,113,14,131,14,139,14,186,14,236,
+15,31,15,74,15,139,15,173,15,218,15,251,16,51,16,63,16,75,16,87,16,99,16,
+130,16,146,16,158,17,64,17,83,17,96,17,115,17,134,17,174,17,201,17,243,17,
+255,18,11,18,23,18,35,18,47,18,59,18,71,18,83,18,222,19,106,19,221,20,101,
+20,114,20,133,20,187,21,7,21,73,21,159,21,251,22,57,22,151,22,217,23,14,23,
+94,23,148,23,179,23,191,23,203,23,215,23,227,23,239,23,251,24,51,24,151,24,
+211,24,248,25,52,25,94,25,179,25,246,26,21,26,34,26,64,26,158,26,174,26,186,
+26,198,26,210,26,226,26,238,26,250,27,6,27,18,27,34,27,50,27,62,27,78,27,
+94,27,110,27,126,27,142,27,154,27,166,27,182,27,194,27,206,27,218,27,230,
+27,242,27,254,28,10,28,22,28,34,28,46,28,58,28,70,28,82,28,94,28,106,28,118,
+28,130,28,142,28,154,28,166,28,178,28,190,28,202,29,64,29,128,29,166,29,189,
+30,2,30,100,30,131,30,193,30,205,31,3,31,110,31,164,32,7,32,67,32,79,32,91,
+32,103,32,115,32,163,32,204,33,17,33,29,33,113,33,143,33,184,33,244,34,47,
+34,110,34,146,34,196,34,231,35,41,35,137,35,185,36,1,36,48,36,112,36,179,
+37,20,37,72,37,182,37,242,37,254,38,10,38,22,38,34,38,46,38,58,38,70,38,82,
+38,94,38,106,38,118,38,130,38,142,38,154,38,166,38,178,38,190,38,206,38,218,
+38,230,38,242,38,254,39,10,39,22,39,34,39,46,39,58,39,70,39,82,39,94,39,106,
+39,118,39,130,39,221,40,69,40,112,40,185,40,197,41,2,41,14,41,77,41,195,42,
+11,42,23,42,35,42,47,42,59,42,120,42,166,42,245,43,71,43,164,43,204,43,255,
+44,82,44,150,44,224,45,19,45,81,45,93,45,169,45,181,45,238,46,63,46,119,46,
+198,47,31,47,43,47,148,47,215,48,85,48,155,48,167,48,179,48,191,48,203,48,
+219,48,231,48,247,49,3,49,15,49,27,49,43,49,59,49,75,49,91,49,103,49,115,
+49,127,49,139,49,151,49,163,49,175,49,187,49,199,49,211,49,223,49,235,49,
+251,50,7,50,23,50,35,50,47,50,59,50,71,50,83,50,156,50,254,51,38,51,104,51,
+116,51,128,51,183,51,195,51,255,52,111,52,181,52,193,52,205,52,217,52,229,
+52,241,52,253,53,9,53,21,53,79,53,121,53,194,53,206,54,37,54,76,54,118,54,
+185,54,247,55,64,55,109,55,162,55,174,55,250,56,6,56,58,56,133,56,182,56,
+255,57,11,57,115,57,174,58,44,58,113,58,125,58,137,58,149,58,161,58,177,58,
+189,58,205,58,217,58,229,58,241,59,1,59,17,59,33,59,49,59,61,59,73,59,85,
+59,97,59,109,59,121,59,133,59,145,59,157,59,169,59,181,59,193,59,205,59,221,
+59,233,59,245,60,1,60,13,60,29,60,141,61,3,61,112,61,245,62,120,63,1,63,13,
+63,25,63,144,64,8,64,91,64,194,65,55,65,172,66,30,66,42,66,54,66,190,66,202,
+66,214,66,246,67,35,67,97,67,109,67,121,67,133,67,145,67,214,68,43,68,100,
+68,156,68,229,69,40,69,104,69,185,69,241,70,40,70,111,70,190,71,10,71,102,
+71,114,71,126,71,138,71,150,71,162,71,174,71,186,71,198,71,210,71,222,71,
+234,71,246,72,6,72,104,72,218,73,17,73,29,73,41,73,53,73,65,73,77,73,89,73,
+101,73,113,73,125,73,137,73,149,73,161,73,177,73,193,73,209,73,225,73,241,
+74,1,74,17,74,33,74,49,74,65,74,81,74,159,75,21,75,147,76,34,76,194,77,32,
+77,128,77,240,78,83,78,203,79,50,79,152,80,9,80,148,81,21,81,168,82,35,82,
+167,83,35,83,82,83,125,84,7,84,108,84,241,85,132,85,251,86,148,87,59,87,170,
+87,253,88,81,88,162,88,218,89,33,89,128,89,241,90,94,90,210,91,66,91,182,
+92,29,92,104,92,116,92,205,92,217,93,83,93,192,94,38,94,153,95,32,95,158,
+95,247,96,3,96,15,96,31,96,174,96,246,97,57,97,69,97,81,97,93,97,109,97,121,
+97,137,97,230,97,242,98,63,98,75,98,175,98,187,99,15,99,27,99,94,99,148,99,
+212,100,8,100,56,100,104,100,154,100,206,101,2,101,52,101,102,101,152,101,
+202,101,253,102,49,102,61,102,73,102,85,102,97,102,109,102,121,102,133,102,
+145,102,157,102,169,102,181,102,193,103,14,103,80,103,149,103,220,104,36,
+104,111,104,183,105,3,105,80,105,156,105,234,106,55,106,158,106,250,107,89,
+107,186,108,27,108,127,108,225,109,71,109,173,110,18,110,121,110,224,110,
+224,111,18,111,68,111,121,111,133,111,145,111,157,111,230,112,44,112,118,
+112,216,113,55,113,154,113,224,114,38,114,85,114,158,114,231,115,39,115,103,
+115,190,116,21,116,136,117,17,117,154,118,56,118,192,119,94,119,146,119,189,
+119,232,120,36,120,96,120,202,121,59,121,120,121,182,122,8,122,85,122,193,
+123,20,123,32,123,44,123,56,123,68,123,80,123,92,123,104,123,116,123,179,
+123,246,124,52,124,64,124,134,124,198,124,210,125,15,125,70,125,82,125,166,
+126,23,126,159,126,210,127,3,127,15,127,62,127,74,127,133,127,145,127,199,
+127,254,128,44,128,109,128,202,129,63,129,98,129,131,129,177,130,21,130,155,
+130,218,131,31,131,43,131,59,131,150,131,161,131,173,131,185,131,197,131,
+213,131,229,131,245,132,5,132,17,132,29,132,41,132,53,132,128,132,140,132,
+226,133,64,133,145,133,244,134,0,134,12,134,24,134,36,134,167,135,12,135,
+106,135,200,136,39,136,134,136,229,137,68,137,165,138,6,138,106,138,206,139,
+50,139,145,139,242,140,83,140,179,140,253,141,92,141,209,142,30,142,70,142,
+98,142,157,142,251,143,15,143,64,143,113,143,154,143,181,143,206,143,222,
+143,254,144,23,144,86,144,117,144,172,144,252,145,40,145,104,145,192,145,
+211,146,64,146,150,146,210,147,8,147,32,147,55,147,80,147,164,147,192,147,
+217,147,244,148,9,148,23,148,90,148,112,148,182,148,238,148,246,149,6,149,
+22,149,53,149,84,149,133,149,182,150,7,150,44,150,112,150,128,150,183,150,
+183,150,211,150,223,150,242,151,12,151,28,151,53,151,87,151,130,151,181,151,
+218,152,17,152,61,152,126,152,177,152,247,153,64,153,116,153,193,153,247,
+154,24,154,88,154,160,154,216,155,28,155,61,155,103,155,152,155,230,156,33,
+156,79,156,91,156,107,156,201,157,59,157,154,157,246,158,55,158,79,158,93,
+158,124,158,159,158,178,158,203,158,216,159,4,159,20,159,50,159,79,159,104,
+159,129,159,161,159,174,159,190,159,227,160,23,160,54,160,112,160,125,160,
+168,160,211,160,254,161,41,161,105,161,169,162,6,162,115,162,214,163,77,163,
+99,163,189,164,24,164,120,164,214,165,9,165,60,165,89,165,125,165,211,165,
+223,165,235,165,247,166,3,166,15,166,27,166,39,166,51,166,63,166,75,166,87,
+166,148,166,160,166,172,166,184,166,238,166,247,167,0,167,9,167,18,167,27,
+167,36,167,45,167,54,167,63,167,72,167,81,167,90,167,99,167,108,167,117,167,
+126,167,135,167,144,167,153,167,162,167,171,167,180,0,2,0,193,0,0,4,10,5,
+182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,
+5,182,250,74,104,4,230,0,0,3,253,48,4,250,0,141,7,44,0,13,0,25,0,26,0,0,1,
+54,54,51,50,22,23,7,38,38,35,34,6,7,5,34,38,53,52,54,51,50,22,21,20,6,7,253,
+48,43,208,172,153,218,67,141,55,142,105,105,123,39,1,18,41,61,61,41,41,61,
+61,94,5,181,188,187,188,187,49,151,136,130,160,16,59,43,43,59,59,43,43,59,
+119,0,0,3,253,48,4,250,0,141,7,44,0,11,0,25,0,26,0,0,1,50,22,21,20,6,35,34,
+38,53,52,54,5,6,6,35,32,3,55,22,22,51,50,54,54,55,1,254,228,41,61,61,41,41,
+61,61,1,210,43,208,172,254,207,133,141,54,142,106,74,101,65,27,254,174,7,
+44,59,43,43,59,59,43,43,59,68,188,187,1,119,49,150,137,63,120,107,253,222,
+0,0,2,254,133,4,250,255,103,6,164,0,15,0,16,0,0,1,50,22,22,21,20,6,6,35,34,
+38,38,53,52,54,54,3,254,246,30,51,32,33,51,29,30,51,32,31,52,52,6,164,31,
+56,32,33,56,30,31,55,33,32,56,31,254,86,0,0,3,0,159,0,110,1,153,4,250,0,15,
+0,31,0,32,0,0,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,19,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,19,1,28,33,57,35,35,57,33,33,57,35,35,57,33,
+33,57,35,35,57,33,33,57,35,35,57,44,3,254,34,61,36,36,61,34,34,61,36,36,61,
+34,253,118,34,61,36,36,61,34,34,61,36,36,61,34,3,134,0,255,255,0,60,0,0,6,
+59,7,44,2,38,0,9,0,0,0,7,0,74,6,29,0,0,0,1,0,60,0,0,6,59,5,15,0,59,0,0,1,
+54,51,50,22,22,21,20,6,7,22,51,50,54,55,17,35,53,33,21,35,17,35,17,6,35,35,
+22,21,20,6,6,35,34,38,38,39,55,22,22,51,50,54,53,52,38,39,6,7,39,54,54,53,
+52,38,38,35,34,6,7,1,43,154,158,104,150,75,74,74,54,111,72,127,61,150,2,16,
+213,165,108,169,9,31,87,145,91,120,198,175,86,144,97,206,118,83,92,72,78,
+54,64,9,126,130,45,72,43,65,118,85,4,193,78,74,127,80,81,129,43,56,47,53,
+1,67,146,146,251,152,2,109,52,63,59,94,129,61,116,247,204,52,239,229,76,74,
+66,120,60,10,2,144,3,82,85,48,62,28,32,43,0,0,1,0,60,0,0,8,77,5,15,0,63,0,
+0,1,54,51,50,22,22,21,20,6,7,22,51,50,54,55,17,35,53,33,21,35,17,35,17,33,
+17,35,17,6,35,35,22,21,20,6,6,35,34,38,38,39,55,22,22,51,50,54,53,52,38,39,
+6,7,39,54,54,53,52,38,38,35,34,6,7,1,43,154,158,104,150,75,74,74,54,111,72,
+127,61,150,4,34,213,165,254,147,165,108,169,9,31,87,145,91,120,198,175,86,
+144,97,206,118,83,92,72,78,54,64,9,126,130,45,72,43,65,118,85,4,193,78,74,
+127,80,81,129,43,56,47,53,1,67,146,146,251,152,4,104,251,152,2,109,52,63,
+59,94,129,61,116,247,204,52,239,229,76,74,66,120,60,10,2,144,3,82,85,48,62,
+28,32,43,0,1,0,0,255,31,3,232,4,250,0,60,0,0,1,38,38,53,52,62,2,51,51,53,
+33,53,33,21,35,17,33,34,14,3,21,20,22,23,54,51,50,22,22,21,20,14,2,7,22,23,
+7,38,39,38,38,53,52,54,51,50,22,23,50,54,54,53,52,38,35,34,6,1,114,126,142,
+44,84,113,87,192,253,146,3,232,213,254,150,43,56,32,22,12,64,53,75,78,102,
+159,90,47,77,98,51,133,149,67,225,196,131,120,58,52,42,86,63,74,124,69,98,
+83,36,91,1,176,35,155,99,60,84,59,29,175,146,146,254,191,7,16,23,32,19,42,
+64,14,24,70,135,93,64,98,73,48,13,62,40,143,90,136,5,62,61,48,58,42,53,45,
+82,54,67,80,19,0,255,255,0,0,255,31,3,245,7,44,2,38,0,11,0,0,0,7,0,181,3,
+202,0,0,0,2,0,0,0,0,4,128,4,250,0,41,0,42,0,0,1,22,21,20,6,7,30,2,21,20,6,
+6,35,34,38,2,39,55,30,3,51,50,53,52,38,39,6,7,39,54,54,53,52,38,39,33,53,
+33,21,37,3,159,66,83,79,63,77,50,92,158,99,121,208,194,89,144,42,96,112,129,
+73,191,86,89,52,80,9,151,146,55,53,253,48,4,128,254,104,4,104,79,98,91,142,
+46,56,100,129,75,102,141,69,126,1,28,230,52,116,198,145,82,177,77,142,68,
+11,2,144,4,98,101,56,92,31,146,146,146,0,2,0,0,255,255,6,61,4,250,0,59,0,
+60,0,0,1,22,21,20,6,7,22,23,54,54,51,50,22,22,21,20,7,39,54,54,53,52,38,35,
+34,7,22,21,20,6,6,35,34,38,2,39,55,30,3,51,50,53,52,38,39,6,7,39,54,54,53,
+52,38,39,33,53,33,21,37,3,159,66,83,79,39,43,68,125,68,88,137,78,133,148,
+56,60,79,75,83,85,31,92,158,99,121,208,194,89,144,42,96,112,129,73,191,86,
+89,52,80,9,151,146,55,53,253,48,6,61,252,171,4,104,79,98,91,142,46,34,49,
+49,45,73,139,92,198,182,85,64,146,77,85,84,75,73,80,102,141,69,126,1,28,230,
+52,116,198,145,82,177,77,142,68,11,2,144,4,98,101,56,92,31,146,146,146,0,
+0,3,0,0,255,187,6,240,4,250,0,72,0,73,0,74,0,0,19,54,54,51,50,22,22,23,17,
+33,53,33,21,33,17,54,55,38,38,53,52,54,51,50,22,22,21,20,6,7,22,23,7,6,6,
+21,20,30,2,51,50,54,55,23,6,6,35,34,38,38,53,52,54,55,38,39,6,6,7,17,35,17,
+1,39,1,46,2,35,34,6,7,1,1,55,87,150,75,81,128,126,80,252,242,6,240,252,195,
+160,87,8,10,79,58,51,78,40,50,47,45,66,24,104,97,28,46,59,32,57,94,81,52,
+72,133,68,101,148,78,99,93,32,25,42,181,85,165,253,247,98,1,248,67,85,88,
+56,62,119,78,2,158,2,178,3,85,42,38,51,111,103,1,204,146,146,254,57,10,26,
+19,55,16,55,67,42,71,44,50,73,20,81,96,67,16,82,70,35,50,33,15,25,42,142,
+36,34,72,132,85,84,138,38,54,52,17,32,5,253,236,1,223,254,166,138,1,49,85,
+79,39,37,39,2,59,253,6,0,0,3,0,0,255,28,5,185,4,250,0,77,0,78,0,79,0,0,5,
+6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,7,39,54,55,38,38,35,34,
+6,21,20,30,4,23,7,46,4,53,52,54,54,51,50,22,23,54,55,17,33,53,33,21,33,17,
+30,3,21,20,6,7,6,6,21,20,30,2,51,50,54,55,1,1,5,185,72,133,68,101,148,78,
+132,130,21,30,85,78,102,141,43,157,25,39,60,98,50,79,91,11,26,47,79,126,85,
+110,114,125,100,61,29,86,152,87,86,150,72,98,139,252,61,5,182,254,177,41,
+78,60,37,43,40,122,122,28,46,59,32,57,94,81,254,62,1,131,158,36,34,72,132,
+85,105,146,36,43,98,59,87,94,152,150,49,96,69,45,36,90,76,28,54,57,69,84,
+111,71,107,97,116,116,106,101,53,93,139,76,57,58,91,19,1,5,146,146,254,242,
+12,49,78,108,71,76,157,74,19,88,76,35,50,33,15,25,42,5,10,252,118,255,255,
+0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,7,0,73,3,185,0,0,255,255,0,0,254,136,
+4,139,7,44,2,38,0,19,0,0,0,7,0,74,4,128,0,0,0,2,0,0,254,136,4,139,4,250,0,
+53,0,54,0,0,1,21,35,17,20,14,4,7,39,62,2,53,17,33,17,20,30,2,23,23,30,2,21,
+20,6,7,39,62,3,53,52,46,2,39,39,46,5,53,17,35,53,33,4,139,192,16,31,48,69,
+90,55,29,78,71,26,254,30,17,37,67,85,225,82,103,53,51,44,148,31,22,15,6,17,
+42,80,94,177,59,72,54,35,22,12,162,3,40,4,250,146,254,163,80,101,71,57,44,
+28,5,152,11,54,78,91,1,93,254,106,117,104,66,58,49,128,46,86,104,73,63,138,
+66,85,50,40,42,32,15,32,42,42,56,55,102,34,55,59,60,68,89,65,1,225,146,255,
+255,0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,7,0,75,4,128,0,0,255,255,0,60,
+0,0,8,128,7,44,2,38,0,10,0,0,0,7,0,73,7,243,0,0,255,255,0,60,0,0,8,77,7,44,
+2,38,0,10,0,0,0,7,0,74,8,47,0,0,255,255,0,60,0,0,8,77,7,44,2,38,0,10,0,0,
+0,7,0,75,8,47,0,0,255,255,0,60,0,0,8,77,7,44,2,38,0,10,0,0,0,7,0,76,8,47,
+0,0,0,2,0,0,0,0,6,55,4,250,0,57,0,58,0,0,1,21,33,17,54,54,51,50,22,22,21,
+20,6,7,39,54,54,53,52,38,35,34,6,7,17,35,17,6,6,35,34,38,38,53,52,54,54,51,
+50,22,23,7,38,38,35,34,6,21,20,22,22,51,50,54,55,17,33,53,33,6,55,253,101,
+51,118,73,87,136,78,69,64,148,52,64,80,72,55,114,57,165,71,145,80,101,171,
+96,102,184,119,40,114,40,12,35,100,38,117,131,58,94,54,74,143,75,253,9,2,
+247,4,250,146,254,98,50,54,75,150,103,104,213,94,85,66,173,83,94,95,76,73,
+253,242,1,101,61,55,84,161,108,107,162,87,12,9,149,8,13,108,94,71,97,46,70,
+77,2,84,146,0,2,0,0,0,0,6,169,4,250,0,30,0,72,0,0,1,35,17,35,53,6,6,35,34,
+46,2,39,38,38,53,52,54,51,50,22,23,54,54,53,52,38,39,33,53,33,1,53,6,6,35,
+34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,55,17,
+33,22,21,20,6,7,30,2,51,50,54,6,169,213,165,77,173,91,118,209,211,203,96,
+31,37,67,64,51,77,31,36,38,20,14,254,101,6,169,254,134,56,133,70,95,154,89,
+89,162,106,41,108,25,12,31,75,37,101,110,107,92,61,118,54,253,17,34,130,137,
+107,198,212,125,103,165,4,104,251,152,95,41,39,55,127,200,126,42,78,49,49,
+63,47,42,32,114,77,61,99,30,146,251,251,160,33,37,78,146,95,97,143,75,13,
+8,141,7,14,95,86,82,89,49,49,2,42,79,112,155,204,60,126,155,76,40,0,1,0,0,
+0,0,4,159,4,250,0,21,0,0,1,33,17,20,6,35,34,38,38,53,52,54,51,51,17,33,53,
+33,21,35,17,35,3,38,254,133,53,47,51,118,74,61,63,55,254,249,4,159,213,164,
+4,104,253,119,54,60,87,125,53,53,52,1,137,146,146,251,152,0,0,2,0,0,0,0,4,
+216,4,250,0,22,0,45,0,0,1,21,35,17,35,17,6,6,35,34,38,38,53,52,54,55,38,38,
+53,52,55,35,53,5,6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,
+55,17,4,216,213,165,84,153,95,104,161,88,44,40,83,91,20,107,1,39,43,84,73,
+56,74,50,42,13,26,32,104,114,108,97,90,153,72,4,250,146,251,152,1,82,54,43,
+75,139,90,60,108,37,40,143,84,64,47,146,146,49,68,70,87,11,16,6,143,3,85,
+78,79,86,70,76,2,85,0,4,0,0,0,0,5,178,4,250,0,51,0,67,0,68,0,69,0,0,1,38,
+38,53,52,62,2,51,51,53,33,53,33,21,33,17,33,34,6,6,21,20,22,23,54,51,50,22,
+22,21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,34,6,1,50,22,22,
+21,20,6,6,35,34,38,38,53,52,54,54,1,3,2,128,126,142,44,84,113,87,217,252,
+107,5,178,254,136,254,125,64,63,38,64,53,74,103,107,169,96,97,188,131,149,
+251,225,98,141,81,179,197,119,128,128,110,94,49,96,2,62,29,49,29,29,49,29,
+29,49,29,29,49,254,203,135,1,176,35,155,99,60,84,59,29,175,146,146,254,191,
+16,46,35,42,64,14,24,69,136,93,91,144,81,101,230,190,66,159,193,84,86,85,
+68,78,18,1,108,30,53,30,30,53,30,30,53,30,30,53,30,1,204,251,6,0,1,0,0,0,
+0,5,49,4,250,0,38,0,0,1,21,35,17,35,17,14,3,35,34,38,38,53,52,54,55,5,53,
+33,50,23,7,35,34,6,21,20,22,22,51,50,54,54,55,17,33,53,5,49,213,164,39,59,
+71,83,50,104,165,93,47,43,254,211,2,89,81,38,14,66,123,141,57,88,52,61,104,
+86,51,252,72,4,250,146,251,152,1,82,25,31,26,15,79,148,95,58,101,37,3,148,
+3,143,104,92,58,82,37,36,60,51,2,84,146,0,3,0,0,0,0,5,185,4,250,0,75,0,76,
+0,77,0,0,1,7,38,38,53,52,54,55,53,33,53,33,21,33,21,22,22,21,20,6,6,4,35,
+34,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,
+22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,36,54,53,52,38,38,35,34,6,21,
+20,22,3,3,4,71,67,154,163,115,105,252,93,5,185,254,143,116,125,99,194,254,
+236,162,129,181,89,31,33,91,92,84,151,98,41,104,23,12,25,74,43,90,92,77,82,
+58,75,46,40,13,23,29,96,98,122,112,155,1,11,148,43,81,55,61,67,116,54,119,
+2,22,129,43,166,115,101,137,18,143,146,146,150,31,181,136,115,224,185,106,
+77,135,89,44,91,37,44,134,84,81,116,58,13,8,141,7,14,66,66,52,71,20,19,6,
+143,3,73,70,79,81,132,227,132,62,103,59,68,58,71,102,2,202,251,6,0,1,0,0,
+0,0,6,14,4,250,0,36,0,0,1,35,17,35,17,33,34,38,39,22,22,21,20,14,2,35,34,
+38,2,39,55,18,18,51,50,54,53,52,38,39,55,33,53,33,53,33,6,14,213,165,254,
+231,38,58,19,79,84,49,83,111,61,122,198,173,78,144,97,204,118,73,77,111,106,
+58,2,42,251,108,6,14,4,104,251,152,2,246,1,3,68,164,83,72,107,71,34,144,1,
+37,221,52,254,227,254,238,76,75,81,158,68,132,224,146,0,2,0,0,255,31,6,8,
+4,250,0,51,0,74,0,0,1,38,38,53,52,62,2,51,51,53,33,53,33,21,35,17,35,17,6,
+6,35,22,21,20,14,2,7,22,23,7,38,39,38,38,53,52,54,51,50,22,23,50,54,54,53,
+52,38,35,34,6,1,17,33,34,14,3,21,20,22,23,54,51,50,22,23,22,51,50,54,55,17,
+1,114,126,142,44,84,113,87,192,253,146,6,8,213,165,58,142,90,5,47,77,98,51,
+133,149,67,225,196,131,120,58,52,42,86,63,74,124,69,98,83,36,91,1,120,254,
+150,43,56,32,22,12,64,53,75,78,76,126,46,47,67,77,131,66,1,176,35,155,99,
+60,84,59,29,175,146,146,251,152,1,185,32,34,29,30,64,98,73,48,13,62,40,143,
+90,136,5,62,61,48,58,42,53,45,82,54,67,80,19,2,167,254,191,7,16,23,32,19,
+42,64,14,24,38,37,20,52,61,1,240,0,0,1,0,0,0,0,6,13,4,250,0,43,0,0,1,54,54,
+51,50,22,22,23,51,50,55,17,33,53,33,21,35,17,35,17,6,35,35,14,2,35,34,36,
+39,55,30,2,51,50,54,53,52,38,35,34,6,7,1,137,56,135,62,91,149,93,13,17,90,
+72,251,109,6,13,213,165,80,99,4,15,99,163,97,182,254,238,98,140,58,116,137,
+92,111,127,105,96,51,93,47,3,92,25,29,63,121,84,34,1,192,146,146,251,152,
+2,11,21,78,118,64,228,223,54,132,151,71,106,89,85,90,27,24,0,0,3,0,0,0,0,
+4,38,4,250,0,33,0,34,0,35,0,0,1,35,34,6,6,21,20,30,2,51,50,54,54,55,23,6,
+6,35,34,38,38,53,52,54,54,51,51,17,33,53,33,21,33,39,17,2,247,112,132,167,
+89,52,88,116,64,62,107,99,84,56,99,206,96,139,228,124,129,228,134,8,253,174,
+4,38,254,209,165,2,203,66,124,85,75,109,70,34,19,37,43,153,49,49,114,206,
+130,123,187,100,1,12,146,146,146,251,6,0,0,4,0,0,0,0,4,204,4,250,0,22,0,38,
+0,39,0,40,0,0,1,33,17,22,22,21,20,6,6,35,34,38,38,53,52,54,54,51,51,17,33,
+53,33,1,35,34,6,6,21,20,30,2,51,50,54,53,52,38,3,19,4,204,254,43,169,175,
+123,225,147,145,238,130,128,230,134,7,253,174,4,204,253,242,72,111,166,94,
+52,91,125,73,161,178,119,226,66,4,104,254,230,72,225,143,131,184,91,113,205,
+132,121,188,101,1,12,146,253,209,62,126,90,75,109,72,35,135,128,99,157,2,
+97,251,6,0,0,3,0,0,0,0,5,35,4,250,0,51,0,52,0,53,0,0,1,38,38,53,52,62,2,51,
+51,53,33,53,33,21,35,17,33,34,6,6,21,20,22,23,54,51,50,22,22,21,20,6,6,35,
+34,38,38,39,55,30,2,51,50,54,53,52,38,35,34,6,19,3,2,128,126,142,44,84,113,
+87,217,252,107,5,35,233,254,125,64,63,38,64,53,74,103,107,169,96,97,188,131,
+149,251,225,98,141,81,179,197,119,128,128,110,94,49,96,236,135,1,176,35,155,
+99,60,84,59,29,175,146,146,254,191,16,46,35,42,64,14,24,69,136,93,91,144,
+81,101,230,190,66,159,193,84,86,85,68,78,18,3,56,251,6,0,0,4,0,0,0,0,4,158,
+4,250,0,38,0,51,0,52,0,53,0,0,1,35,34,14,2,21,20,22,23,38,53,52,54,54,51,
+50,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,53,33,53,33,21,33,3,54,54,53,
+52,38,35,34,6,6,21,20,22,3,17,3,21,81,115,151,123,60,130,120,31,65,137,98,
+76,110,73,35,107,202,135,150,247,136,127,243,159,253,144,4,158,254,119,127,
+118,137,71,57,47,74,42,17,19,3,1,32,84,116,69,130,161,27,78,94,70,121,77,
+45,74,97,52,94,147,81,119,216,138,128,196,112,4,215,146,146,252,37,2,98,81,
+61,70,40,76,50,41,69,4,73,251,6,0,0,2,0,0,0,0,5,230,4,250,0,20,0,34,0,0,1,
+35,17,35,17,33,17,20,14,3,35,34,38,38,53,17,35,53,33,5,33,17,20,30,3,51,50,
+62,2,53,5,230,213,165,254,241,28,59,85,108,67,118,156,78,162,5,230,252,211,
+254,141,15,29,43,58,38,64,73,39,12,4,104,251,152,4,104,254,42,79,111,86,55,
+27,88,178,154,1,152,146,146,254,106,73,89,61,37,17,39,71,90,77,0,0,1,0,0,
+255,231,4,173,4,250,0,28,0,0,1,35,34,6,6,21,20,22,22,23,7,46,2,53,52,62,2,
+51,33,17,33,53,33,21,35,17,35,3,51,223,129,129,80,63,126,107,110,143,133,
+75,55,118,167,125,1,5,252,205,4,173,213,165,2,160,27,82,77,65,122,131,86,
+107,123,155,158,85,67,123,92,40,1,54,146,146,251,152,0,2,0,95,0,0,5,64,5,
+14,0,47,0,48,0,0,1,36,53,52,54,54,51,50,22,22,21,20,6,7,22,22,51,50,54,55,
+17,35,53,33,21,35,17,35,17,6,35,34,38,38,39,54,54,53,52,38,38,35,34,6,21,
+20,22,23,3,1,126,254,225,69,116,73,95,157,83,155,160,51,121,98,89,156,79,
+168,2,33,213,164,149,188,115,188,129,29,179,175,45,78,49,53,65,79,87,230,
+3,33,41,221,75,106,50,84,151,99,143,194,63,80,65,69,79,2,53,146,146,251,152,
+1,113,99,88,176,126,36,140,120,66,94,47,51,44,52,62,9,254,81,0,3,0,0,255,
+138,4,70,4,250,0,52,0,53,0,54,0,0,5,38,38,39,6,35,34,46,3,53,52,62,4,51,51,
+53,33,53,33,21,33,17,35,34,6,6,21,20,22,22,51,50,55,38,38,53,52,54,51,50,
+22,22,21,20,6,7,22,23,1,19,3,79,43,81,22,57,56,92,161,120,78,42,25,59,88,
+109,138,80,10,253,164,4,70,254,187,99,158,166,87,72,149,108,21,30,7,5,77,
+60,57,83,40,49,56,58,86,254,133,208,118,69,149,49,9,42,74,98,125,78,57,95,
+91,67,43,23,195,146,146,254,173,54,112,86,74,113,64,3,18,40,14,63,68,48,73,
+40,56,76,22,112,115,5,44,251,6,0,0,1,0,87,0,0,5,10,5,15,0,63,0,0,1,21,35,
+17,35,17,6,6,35,34,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,22,21,20,
+6,7,39,54,53,52,38,35,34,6,6,21,20,30,2,23,54,51,50,23,7,38,35,34,6,21,20,
+22,51,50,54,55,17,35,53,5,10,213,165,84,153,95,104,161,88,36,40,107,109,75,
+136,85,71,116,67,41,40,125,41,50,46,38,63,37,37,62,79,41,58,74,50,42,13,26,
+32,104,114,108,97,90,153,72,127,4,250,146,251,152,1,52,54,43,75,139,90,54,
+103,40,41,151,106,80,131,74,51,96,61,48,94,37,79,40,50,39,47,42,74,45,51,
+68,44,22,4,16,6,143,3,85,78,79,86,70,76,2,115,146,0,1,0,0,0,0,4,142,4,250,
+0,20,0,0,17,53,33,21,35,17,35,17,33,21,20,6,35,34,38,38,53,52,51,33,17,4,
+142,213,165,254,143,55,50,48,114,76,124,2,76,4,104,146,146,251,152,2,98,110,
+55,59,85,126,54,105,1,116,0,2,0,0,255,211,4,142,4,250,0,20,0,36,0,0,17,53,
+33,21,35,17,35,17,33,21,20,6,35,34,38,38,53,52,51,33,17,1,50,22,22,21,20,
+6,6,35,34,38,38,53,52,54,54,4,142,213,165,254,143,55,50,48,114,76,124,2,76,
+254,95,30,51,32,33,51,29,30,51,32,31,52,4,104,146,146,251,152,2,98,110,55,
+59,85,126,54,105,1,116,252,89,31,56,32,33,56,30,31,55,33,32,56,31,0,0,2,0,
+0,0,0,4,170,4,250,0,16,0,28,0,0,1,35,17,35,17,6,6,35,34,46,2,53,17,35,53,
+33,5,17,20,30,3,51,50,54,55,17,4,170,213,164,79,140,77,85,140,95,39,162,4,
+170,252,156,14,31,46,70,49,73,147,61,4,104,251,152,1,135,50,41,58,111,147,
+118,1,138,146,146,254,139,98,96,55,41,20,70,63,2,38,0,0,3,0,0,0,0,6,73,4,
+250,0,36,0,49,0,50,0,0,33,17,6,35,34,46,2,53,17,35,53,33,21,33,17,54,54,51,
+50,22,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,17,1,17,20,30,4,51,50,54,55,
+17,53,3,9,120,149,77,139,91,39,162,6,73,253,101,51,118,73,87,136,78,69,64,
+148,52,64,80,72,55,114,57,253,152,6,18,35,39,52,30,74,131,66,1,140,96,59,
+111,140,116,1,146,146,146,254,98,50,54,75,150,103,104,213,94,85,66,173,83,
+94,95,76,73,253,242,4,104,254,121,60,82,62,48,27,13,61,67,2,43,146,0,0,2,
+0,0,0,0,4,175,4,250,0,30,0,39,0,0,1,21,35,17,35,17,6,6,35,34,38,38,53,52,
+54,54,51,50,22,23,7,38,35,34,7,1,54,55,17,33,53,1,1,6,21,20,22,22,51,50,4,
+175,213,164,78,161,90,114,182,102,111,203,133,51,135,28,12,121,75,41,35,1,
+19,33,42,252,202,2,118,254,226,84,64,106,65,72,4,250,146,251,152,1,82,51,
+46,86,157,102,114,165,85,13,8,141,21,5,254,168,24,41,2,91,146,252,149,1,102,
+59,111,70,95,45,0,1,0,95,0,0,5,189,5,14,0,46,0,0,1,33,17,33,53,33,21,35,17,
+35,17,33,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,34,6,21,20,22,
+23,7,36,53,52,54,54,51,50,30,2,21,2,167,1,156,254,245,2,133,213,165,254,100,
+54,45,48,116,81,63,61,60,38,77,58,56,57,105,108,15,254,176,70,118,73,71,119,
+95,38,2,145,1,215,146,146,251,152,1,255,74,60,68,83,127,50,43,45,216,122,
+113,55,53,42,62,59,5,146,28,240,77,104,49,40,102,150,108,0,2,0,0,0,0,4,230,
+4,250,0,21,0,25,0,0,1,35,17,35,17,33,21,20,6,35,34,38,38,53,52,54,51,51,17,
+33,53,33,1,17,33,17,4,230,213,165,254,60,54,45,48,116,81,64,61,55,254,252,
+4,230,254,134,254,60,4,104,251,152,1,255,74,60,68,83,127,50,43,45,1,215,146,
+253,151,1,215,254,41,0,0,3,0,0,0,0,4,194,4,250,0,18,0,32,0,33,0,0,1,6,6,35,
+34,38,39,54,54,53,52,39,35,53,33,21,35,17,35,1,22,22,51,50,54,55,17,33,22,
+22,21,20,6,5,3,73,70,165,88,177,233,30,132,117,75,252,4,194,213,164,253,191,
+41,127,98,86,157,68,254,104,28,31,115,254,213,1,112,47,51,238,214,28,100,
+86,93,99,146,146,251,152,2,105,103,99,73,75,2,53,52,111,53,108,151,77,0,2,
+0,0,255,231,3,100,4,250,0,35,0,36,0,0,1,35,22,21,20,14,2,7,22,22,23,7,46,
+5,53,52,54,54,51,50,22,23,54,54,53,52,38,39,33,53,33,1,3,100,213,34,53,93,
+127,74,83,243,140,110,85,174,179,117,47,15,27,59,45,52,77,31,79,73,18,16,
+254,22,3,100,254,86,4,104,79,112,84,128,99,76,30,99,227,109,110,70,160,186,
+144,80,52,29,27,49,32,47,42,41,121,82,40,95,34,146,251,6,0,3,0,0,255,211,
+3,100,4,250,0,35,0,36,0,52,0,0,1,35,22,21,20,14,2,7,22,22,23,7,46,5,53,52,
+54,54,51,50,22,23,54,54,53,52,38,39,33,53,33,1,39,50,22,22,21,20,6,6,35,34,
+38,38,53,52,54,54,3,100,213,34,53,93,127,74,83,243,140,110,85,174,179,117,
+47,15,27,59,45,52,77,31,79,73,18,16,254,22,3,100,254,86,221,30,51,32,33,51,
+29,30,51,32,31,52,4,104,79,112,84,128,99,76,30,99,227,109,110,70,160,186,
+144,80,52,29,27,49,32,47,42,41,121,82,40,95,34,146,251,6,193,31,56,32,33,
+56,30,31,55,33,32,56,31,0,0,1,0,0,255,231,5,139,4,250,0,48,0,0,1,51,50,23,
+17,33,53,33,21,35,17,35,17,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,30,4,
+23,7,46,4,53,52,54,54,51,50,22,23,54,4,0,9,5,4,251,238,5,139,213,164,9,22,
+98,140,44,157,25,39,60,98,50,79,91,11,26,47,79,126,85,110,114,125,100,61,
+29,86,152,87,84,151,73,120,3,104,1,1,1,146,146,251,152,2,215,2,152,150,49,
+96,69,45,36,90,76,28,54,57,69,84,111,71,107,97,116,116,106,101,53,93,139,
+76,56,58,114,0,0,5,0,0,0,0,6,51,4,250,0,35,0,50,0,65,0,66,0,67,0,0,1,22,22,
+21,20,6,6,35,34,38,38,39,6,6,35,34,38,38,53,52,54,54,51,50,22,22,23,54,54,
+55,53,33,53,33,21,33,1,22,22,51,50,54,54,53,52,38,38,35,34,6,7,39,38,38,35,
+34,6,6,21,20,22,22,51,50,54,55,1,17,4,192,117,129,88,164,108,71,121,103,59,
+54,143,108,97,157,95,92,165,103,70,118,103,62,49,117,79,251,228,6,51,254,
+141,254,114,74,123,66,58,98,60,51,86,53,73,109,53,135,77,121,64,58,98,60,
+52,84,52,72,111,53,1,113,3,117,36,199,139,108,173,100,39,68,55,80,82,88,176,
+123,113,174,95,37,67,57,72,77,9,232,146,146,253,56,76,64,49,109,82,84,106,
+47,98,118,75,78,63,49,109,82,83,107,47,99,117,3,14,251,6,0,255,255,0,0,254,
+230,6,51,4,250,2,38,0,55,0,0,0,7,0,64,3,239,0,112,0,1,0,0,0,0,4,145,4,250,
+0,34,0,0,1,21,35,17,35,17,6,6,35,34,38,38,53,52,54,54,51,50,22,23,7,38,35,
+34,6,21,20,22,22,51,50,55,17,33,53,4,145,213,164,72,156,87,110,174,98,106,
+194,127,48,129,27,12,114,70,129,141,60,101,61,172,138,252,232,4,250,146,251,
+152,1,82,50,47,86,157,102,114,165,85,13,8,149,21,113,101,67,92,43,146,2,85,
+146,0,0,3,0,81,255,254,5,143,5,14,0,46,0,54,0,55,0,0,1,54,54,53,52,38,38,
+35,34,6,21,20,22,23,7,46,2,53,52,54,54,51,50,22,22,21,20,6,7,22,23,7,38,38,
+39,6,35,34,38,38,53,52,54,51,50,22,1,35,17,35,17,35,53,33,1,1,136,109,124,
+55,99,64,59,65,140,130,34,124,174,86,62,128,93,104,171,94,141,126,166,161,
+131,98,168,83,56,62,47,77,44,70,61,41,81,4,65,213,165,182,2,48,251,106,2,
+52,36,182,126,73,117,65,58,49,74,78,3,144,8,83,130,80,70,106,60,96,179,118,
+142,239,68,145,218,91,138,193,70,11,32,62,40,57,65,37,2,9,251,152,4,104,146,
+253,28,0,0,3,0,0,0,0,4,190,4,250,0,16,0,19,0,29,0,0,1,35,17,35,17,6,6,35,
+34,46,2,53,17,35,53,33,5,1,17,3,1,17,20,30,3,51,50,4,190,213,164,89,148,79,
+85,140,95,39,162,4,190,252,229,1,162,100,254,101,14,31,46,70,49,100,4,104,
+251,152,1,138,52,42,58,111,147,118,1,138,146,146,253,225,2,31,253,142,2,24,
+254,229,98,96,55,41,20,0,0,2,0,0,255,231,5,125,4,250,0,36,0,45,0,0,1,35,17,
+35,17,35,34,39,6,7,22,22,23,7,46,2,39,38,38,53,52,54,54,51,50,22,23,54,54,
+53,52,38,39,33,53,33,1,22,51,33,17,33,22,21,20,5,125,213,165,247,221,114,
+45,57,84,226,125,110,114,222,170,40,24,17,27,59,45,51,77,31,36,38,20,14,254,
+101,5,125,252,157,56,118,1,59,254,61,34,4,104,251,152,2,19,44,33,24,108,224,
+101,110,99,225,202,66,41,56,32,27,49,32,47,42,32,114,77,61,99,30,146,253,
+178,7,1,195,79,112,161,0,0,1,0,0,254,221,4,94,4,250,0,54,0,0,37,54,54,53,
+52,35,34,6,21,20,30,2,23,7,46,4,53,52,54,55,38,53,52,62,2,51,33,53,33,53,
+33,21,35,17,33,34,6,6,21,20,23,54,51,50,22,22,21,20,6,7,2,146,84,84,253,140,
+151,28,67,129,121,110,111,111,92,57,28,70,58,104,50,85,110,83,1,14,253,28,
+4,94,213,254,72,64,63,38,95,88,99,126,182,96,138,136,142,23,80,59,163,113,
+101,48,82,88,122,97,107,93,102,104,100,102,57,81,126,43,86,118,63,87,56,26,
+175,146,146,254,191,16,46,35,77,45,26,77,139,85,116,156,37,0,0,3,254,164,
+4,235,255,73,7,44,0,3,0,4,0,5,0,0,3,35,17,51,3,19,183,165,165,165,110,4,235,
+1,133,254,138,2,50,0,255,255,0,0,0,0,2,48,7,44,2,38,0,66,0,0,0,7,0,62,2,18,
+0,0,0,1,253,76,254,118,254,46,255,100,0,15,0,0,5,50,22,22,21,20,6,6,35,34,
+38,38,53,52,54,54,253,189,30,51,32,33,51,29,30,51,32,31,52,156,31,56,32,33,
+56,30,31,55,33,32,56,31,0,2,0,53,0,85,3,93,4,250,0,47,0,48,0,0,1,35,34,14,
+3,21,20,22,22,23,30,2,21,20,6,6,35,34,46,2,39,55,30,2,51,50,54,53,52,46,2,
+39,46,2,53,52,62,2,51,51,33,3,49,209,62,58,37,28,17,32,76,96,100,104,47,79,
+145,95,78,125,112,115,59,141,63,95,109,65,78,88,21,46,77,79,88,98,42,46,96,
+134,110,190,254,90,4,104,6,12,25,36,27,34,59,75,77,81,119,119,76,88,135,74,
+42,90,151,106,70,113,124,71,79,71,41,65,62,73,64,70,111,98,55,63,94,67,25,
+0,0,1,0,0,0,0,2,48,4,250,0,7,0,0,1,35,17,35,17,35,53,33,2,48,213,165,182,
+2,48,4,104,251,152,4,104,146,255,255,0,0,0,0,6,13,7,44,2,6,2,50,0,0,0,1,254,
+64,0,0,2,48,7,44,0,30,0,0,1,38,38,53,52,54,54,51,50,22,22,23,51,21,35,17,
+35,17,35,53,51,46,2,35,34,6,21,20,22,23,254,136,36,36,76,147,101,118,161,
+119,60,226,213,165,182,179,42,79,101,73,80,88,31,37,4,235,71,132,69,88,139,
+78,111,233,218,146,251,152,4,104,146,158,173,85,99,90,56,112,74,0,0,2,252,
+92,253,220,0,46,0,22,0,30,0,31,0,0,5,54,54,51,50,22,22,21,20,6,6,35,34,38,
+38,39,55,30,2,51,50,54,53,52,38,38,35,34,6,7,55,254,5,54,116,58,101,147,77,
+87,166,114,128,216,181,86,126,85,142,158,100,108,108,46,75,43,47,87,51,106,
+25,23,24,72,129,86,83,129,71,82,150,112,87,107,120,58,78,75,43,59,29,19,24,
+161,0,2,253,87,253,220,1,40,0,22,0,31,0,32,0,0,3,6,35,34,38,38,53,52,54,54,
+51,50,30,2,23,7,46,2,35,34,6,21,20,30,2,51,50,54,55,3,128,113,113,101,148,
+78,85,160,105,97,168,141,138,83,125,80,146,167,98,101,109,28,46,60,31,46,
+84,55,168,254,11,47,72,132,85,77,129,75,50,90,143,126,80,120,150,80,78,68,
+39,53,33,14,18,26,1,102,0,2,253,224,253,220,0,56,0,36,0,23,0,24,0,0,19,6,
+6,35,34,38,38,53,52,54,54,55,23,6,6,21,20,30,2,51,50,54,55,1,56,72,133,68,
+101,148,78,81,165,115,15,114,111,28,46,59,32,57,94,81,254,160,254,34,36,34,
+72,132,85,77,129,83,6,135,12,87,72,35,50,33,15,25,42,1,80,0,0,2,253,224,252,
+218,0,136,0,36,0,40,0,41,0,0,19,6,6,35,34,38,38,53,52,55,38,38,53,52,54,54,
+55,23,6,6,21,20,22,51,50,54,55,23,6,6,35,34,39,6,21,20,22,51,50,54,55,1,136,
+72,133,68,106,148,73,32,54,58,82,165,114,15,111,114,86,80,57,93,82,51,72,
+133,68,36,33,27,85,81,57,93,82,254,79,253,32,36,34,70,121,78,58,50,37,108,
+65,66,112,72,5,135,9,72,56,53,57,22,35,129,36,34,5,31,40,54,56,22,35,2,95,
+0,0,3,253,48,4,250,0,141,7,44,0,13,0,14,0,15,0,0,19,6,6,35,32,3,55,22,22,
+51,50,54,54,55,1,19,141,43,208,172,254,207,133,145,54,138,106,75,99,63,26,
+254,178,110,6,232,188,187,1,119,49,148,135,63,119,104,253,222,2,50,0,2,252,
+51,4,235,255,63,7,44,0,25,0,26,0,0,1,46,2,35,34,7,6,35,34,38,38,39,55,30,
+2,51,50,55,54,51,50,22,22,23,39,254,164,24,49,67,53,27,27,26,27,80,113,94,
+38,135,31,50,67,52,27,33,34,37,79,110,87,38,155,4,235,105,105,45,2,3,49,122,
+107,49,84,67,30,4,3,72,172,159,15,0,0,2,252,186,4,235,255,64,7,44,0,16,0,
+17,0,0,1,46,2,35,34,6,7,39,54,54,51,50,30,2,23,39,254,165,44,83,100,72,35,
+64,43,50,45,89,52,87,129,105,94,45,156,4,235,168,179,79,11,17,149,16,14,59,
+129,222,167,15,0,2,252,147,4,235,255,64,7,44,0,34,0,35,0,0,1,46,3,35,34,7,
+39,54,54,51,50,30,3,23,55,46,2,35,34,6,7,39,54,54,51,50,30,2,23,39,254,146,
+45,72,63,61,49,73,94,54,47,102,61,41,72,66,53,34,18,9,43,78,88,65,35,64,43,
+48,49,83,54,87,129,105,93,46,156,4,235,64,72,33,12,44,142,19,26,17,36,44,
+37,31,3,109,115,49,11,17,141,16,13,59,128,219,171,15,255,255,255,6,0,0,2,
+99,7,44,2,38,0,66,0,0,0,7,0,73,1,214,0,0,255,255,254,69,0,0,2,48,7,44,2,38,
+0,66,0,0,0,7,0,74,2,18,0,0,255,255,254,204,0,0,2,48,7,44,2,38,0,66,0,0,0,
+7,0,75,2,18,0,0,255,255,254,165,0,0,2,48,7,44,2,38,0,66,0,0,0,7,0,76,2,18,
+0,0,0,2,254,145,253,220,1,54,0,0,0,15,0,16,0,0,5,54,51,50,30,3,23,7,46,2,
+35,34,7,39,254,145,45,53,67,120,112,109,107,64,117,72,134,151,92,54,32,6,
+91,11,27,53,85,122,97,84,113,136,67,10,242,0,0,1,0,212,0,0,2,78,4,250,0,5,
+0,0,1,35,17,35,17,33,2,78,213,165,1,122,4,104,251,152,4,250,255,255,254,45,
+0,0,2,48,7,44,2,38,0,66,0,0,0,7,2,221,2,18,0,0,0,4,0,60,0,163,6,222,7,44,
+0,11,0,25,0,111,0,112,0,0,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,32,3,
+55,22,22,51,50,54,54,55,1,54,51,50,22,22,21,20,6,7,22,22,51,50,54,55,55,62,
+2,51,50,22,22,21,20,6,6,35,34,38,39,55,22,22,51,50,54,54,53,52,38,35,34,6,
+6,7,7,14,2,35,35,22,21,20,6,6,35,34,38,38,39,55,22,22,51,50,54,53,52,38,39,
+6,7,39,54,54,53,52,38,38,35,34,6,7,1,4,106,41,61,61,41,41,61,61,1,210,43,
+208,172,254,207,133,141,54,142,106,74,101,65,27,251,175,154,158,104,150,75,
+77,76,32,61,34,41,65,37,61,54,96,106,70,86,147,81,87,164,109,83,141,74,100,
+51,95,58,49,86,54,84,71,38,60,56,35,54,28,71,96,64,1,27,87,145,91,120,198,
+175,86,144,97,206,118,83,92,72,78,54,64,9,126,130,45,72,43,65,118,85,3,7,
+6,237,59,43,43,59,59,43,43,59,68,188,187,1,119,49,150,137,63,120,107,253,
+228,78,74,127,80,82,131,43,28,25,46,59,98,87,88,37,87,167,113,108,165,89,
+63,67,107,47,44,47,100,71,101,118,29,64,59,91,47,78,45,56,58,94,129,61,116,
+247,204,52,239,229,76,74,66,120,60,10,2,144,3,82,85,48,62,28,32,43,2,249,
+0,0,3,254,164,4,250,255,63,7,44,0,3,0,4,0,5,0,0,3,17,35,17,3,19,193,145,10,
+96,6,249,254,101,1,155,254,1,2,50,0,1,252,179,254,209,255,83,255,99,0,3,0,
+0,1,53,33,21,252,179,2,160,254,209,146,146,0,3,253,223,4,250,255,78,7,44,
+0,3,0,4,0,5,0,0,3,35,3,51,3,3,178,134,233,222,25,104,5,118,1,134,253,254,
+2,50,0,3,254,147,4,250,0,1,7,44,0,3,0,4,0,5,0,0,3,51,3,35,23,19,220,221,232,
+134,17,96,6,252,254,122,124,2,50,0,0,4,253,73,4,250,0,87,7,44,0,13,0,17,0,
+18,0,19,0,0,19,6,6,35,34,38,39,55,22,22,51,50,54,55,1,53,33,21,5,19,87,38,
+189,158,140,198,59,139,45,120,97,102,102,28,253,204,2,160,254,118,19,6,248,
+147,147,147,147,49,107,93,94,109,254,17,132,132,67,2,50,0,0,1,251,254,254,
+139,255,32,255,150,0,13,0,0,5,55,22,22,51,50,54,55,23,6,6,35,34,38,251,254,
+48,90,163,100,98,161,94,48,78,211,112,113,210,242,136,69,52,50,71,136,64,
+67,68,0,0,2,251,254,253,220,255,32,255,215,0,12,0,24,0,0,5,55,22,22,51,50,
+54,55,23,6,6,35,34,7,55,22,22,51,50,54,55,23,6,35,34,251,254,48,90,163,100,
+98,161,94,48,76,215,110,232,169,48,80,160,113,111,158,84,48,183,218,219,177,
+136,69,52,50,71,136,61,70,135,136,49,46,45,50,136,105,255,255,0,0,255,160,
+6,55,4,250,2,38,0,25,0,0,0,7,3,17,3,102,1,42,255,255,0,0,255,211,6,169,4,
+250,2,38,0,26,0,0,0,7,3,17,3,32,1,93,255,255,0,0,255,211,4,159,4,250,2,38,
+0,27,0,0,0,7,3,17,3,142,1,93,255,255,0,0,255,24,6,14,4,250,2,38,0,32,0,0,
+0,7,0,64,4,125,0,162,255,255,0,0,254,118,5,35,4,250,2,38,0,37,0,0,0,7,0,64,
+4,241,0,0,255,255,0,0,254,118,4,158,4,250,2,38,0,38,0,0,0,7,0,64,4,120,0,
+0,255,255,0,0,255,160,6,73,4,250,2,38,0,47,0,0,0,7,3,17,3,102,1,42,255,255,
+0,0,255,181,4,194,4,250,2,38,0,51,0,0,0,7,3,17,3,122,1,63,0,3,0,0,254,181,
+7,8,4,250,0,91,0,92,0,93,0,0,19,54,54,51,50,22,22,23,17,33,53,33,21,33,17,
+54,55,38,38,53,52,54,51,50,22,22,21,20,6,7,22,23,7,14,2,21,20,22,51,50,54,
+55,23,6,6,35,34,39,6,6,21,20,22,51,50,54,55,23,6,6,35,34,38,38,53,52,55,38,
+38,53,52,54,55,38,39,6,6,7,17,35,17,1,39,1,46,2,35,34,6,7,1,1,55,87,150,75,
+81,128,126,80,252,242,6,240,252,195,160,87,8,10,79,58,51,78,40,50,47,45,66,
+24,71,93,37,86,80,57,93,82,51,72,133,68,37,33,15,11,85,81,57,93,82,51,72,
+133,68,106,148,73,31,55,56,100,92,46,11,42,181,85,165,253,247,98,1,248,67,
+85,88,56,62,119,78,2,158,2,178,3,85,42,38,51,111,103,1,204,146,146,254,57,
+10,26,19,55,16,55,67,42,71,44,50,73,20,81,96,67,9,45,55,30,53,57,22,35,129,
+36,34,5,16,34,20,54,56,22,35,129,36,34,70,121,78,59,48,37,108,65,74,118,33,
+82,24,17,32,5,253,236,1,223,254,166,138,1,49,85,79,39,37,39,2,59,253,6,0,
+3,0,0,254,107,6,14,4,250,0,96,0,97,0,98,0,0,1,6,6,35,34,38,38,53,52,55,38,
+38,53,52,54,54,55,54,53,52,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,30,4,
+23,7,46,4,53,52,54,54,51,50,22,23,54,55,17,33,53,33,21,33,17,30,3,21,20,6,
+7,14,2,21,20,22,51,50,54,55,23,6,6,35,34,39,6,6,21,20,22,51,50,54,55,1,1,
+6,14,72,133,68,106,148,73,31,55,56,62,132,96,18,85,78,102,141,43,157,25,39,
+60,98,50,79,91,11,26,47,79,126,85,110,114,125,100,61,29,86,152,87,86,150,
+72,98,139,252,61,5,182,254,177,41,78,60,37,20,25,108,122,47,86,80,57,93,82,
+51,72,133,68,37,33,15,11,85,81,57,93,82,253,232,1,159,254,177,36,34,70,121,
+78,59,48,37,108,65,59,100,74,17,57,60,87,94,152,150,49,96,69,45,36,90,76,
+28,54,57,69,84,111,71,107,97,116,116,106,101,53,93,139,76,57,58,91,19,1,5,
+146,146,254,242,12,49,78,108,71,56,110,62,9,44,58,37,53,57,22,35,129,36,34,
+5,16,34,20,54,56,22,35,5,200,252,197,0,3,252,69,252,218,0,93,0,1,0,77,0,78,
+0,79,0,0,19,6,6,35,34,46,2,53,52,62,2,55,54,54,53,52,38,35,34,14,2,7,39,54,
+54,55,38,38,35,34,6,21,20,30,2,23,7,46,3,53,52,62,2,51,50,22,23,54,54,51,
+50,30,2,21,20,6,7,6,6,21,20,30,2,51,50,62,2,55,1,1,93,42,108,66,61,96,66,
+35,28,58,92,64,11,12,65,54,28,57,54,49,20,142,11,26,17,34,71,44,63,64,37,
+71,104,67,95,70,121,90,51,47,74,91,44,72,119,56,48,119,71,40,87,72,47,33,
+29,116,98,21,34,44,24,24,41,40,42,27,254,111,1,103,253,16,21,33,34,61,85,
+51,42,73,61,46,14,22,47,28,59,55,19,51,90,70,37,37,67,29,25,30,68,54,43,78,
+81,90,54,102,60,112,111,115,64,64,91,59,28,46,44,44,46,26,56,91,64,60,109,
+47,13,65,52,24,36,22,11,6,12,19,14,2,112,254,42,0,0,2,252,69,252,218,1,37,
+0,1,0,96,0,97,0,0,1,6,6,35,34,46,2,53,52,55,38,38,53,52,54,55,38,35,34,14,
+2,7,39,54,54,55,38,38,35,34,6,21,20,30,2,23,7,46,3,53,52,62,2,51,50,22,23,
+54,54,51,50,30,2,21,20,6,21,6,6,21,20,30,2,51,50,62,2,55,23,6,6,35,34,38,
+39,6,6,21,20,30,2,51,50,62,2,55,1,1,37,42,108,66,61,96,66,35,7,42,45,57,72,
+30,73,28,57,54,49,20,142,11,26,17,34,71,44,63,64,37,71,104,67,95,70,121,90,
+51,47,74,91,44,72,119,56,48,119,71,40,87,72,47,1,87,68,21,34,44,24,24,41,
+40,42,27,40,42,108,66,10,19,10,1,1,21,34,44,24,24,41,40,42,27,253,167,253,
+14,20,32,32,60,83,51,32,27,27,82,51,55,90,34,54,19,51,90,70,37,37,67,29,25,
+30,68,54,43,78,81,90,54,102,60,112,111,115,64,64,91,59,28,46,44,44,46,27,
+60,93,66,3,12,3,15,55,35,20,28,18,8,6,12,19,14,125,20,32,1,1,5,11,5,24,36,
+22,11,6,12,19,14,2,117,0,1,1,142,0,0,2,51,4,250,0,3,0,0,33,17,51,17,1,142,
+165,4,250,251,6,0,0,2,1,142,0,0,3,245,4,250,0,3,0,7,0,0,33,17,51,17,33,17,
+51,17,3,80,165,253,153,165,4,250,251,6,4,250,251,6,0,3,0,153,0,247,3,206,
+4,250,0,15,0,31,0,32,0,0,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,19,
+50,54,54,53,52,38,38,35,34,6,6,21,20,22,22,3,2,50,118,187,107,105,187,118,
+117,188,106,106,186,114,71,114,62,59,109,71,70,113,63,59,108,6,4,40,104,188,
+118,118,186,103,104,188,118,119,187,101,253,97,70,121,75,75,118,66,68,123,
+76,76,117,65,3,113,0,0,3,1,7,255,95,3,118,5,15,0,45,0,46,0,47,0,0,1,62,2,
+53,52,38,35,34,6,6,21,20,22,23,7,38,38,53,52,54,54,51,50,22,22,21,20,6,6,
+7,5,22,22,21,20,6,7,39,54,54,53,52,38,39,1,55,3,1,14,156,188,99,85,67,44,
+65,31,74,81,97,109,97,69,135,88,96,143,74,70,167,147,1,0,72,64,38,57,133,
+28,31,33,49,254,140,223,4,2,54,99,150,138,67,65,79,32,53,29,51,68,28,103,
+47,125,87,60,111,65,72,124,78,81,144,166,105,203,57,120,75,53,102,76,99,31,
+62,39,40,59,42,1,53,252,1,246,0,0,3,0,173,255,232,3,209,5,15,0,38,0,39,0,
+40,0,0,5,2,39,6,35,34,38,38,53,52,54,51,50,22,23,54,54,53,52,38,38,35,34,
+6,7,39,54,54,51,50,22,22,21,20,6,7,22,22,23,1,19,3,78,202,155,52,55,47,77,
+44,70,61,42,81,56,97,117,61,108,72,69,122,81,52,80,158,86,118,185,107,137,
+125,81,175,76,253,173,100,24,1,46,149,9,32,62,40,57,65,38,41,36,168,106,79,
+110,54,31,40,144,38,36,86,178,130,139,222,63,80,216,114,1,240,2,199,0,3,0,
+184,255,119,3,153,5,15,0,54,0,55,0,56,0,0,19,54,54,51,50,22,22,21,20,6,7,
+22,22,21,20,6,7,22,23,7,38,38,39,6,35,34,38,38,53,52,54,51,50,22,23,54,54,
+53,52,38,38,39,6,35,39,50,54,54,53,52,38,35,34,6,7,19,19,184,73,164,86,108,
+157,81,57,62,91,96,127,121,115,118,133,113,103,39,49,73,47,77,44,70,61,56,
+96,51,98,92,50,97,66,66,78,8,118,134,53,92,83,72,137,72,160,86,4,193,38,40,
+69,124,82,77,114,42,38,131,91,103,160,44,115,156,86,156,126,40,7,32,62,40,
+57,65,49,45,20,98,75,47,78,47,3,12,146,41,74,57,64,72,40,35,253,16,3,183,
+0,3,0,130,255,252,3,234,5,15,0,49,0,63,0,64,0,0,1,30,4,21,20,6,6,35,34,38,
+38,53,52,62,2,55,46,4,53,52,55,23,6,21,20,30,2,23,62,3,53,52,39,55,22,21,
+20,14,2,7,14,2,21,20,22,51,50,54,53,52,38,38,3,2,156,53,74,46,25,11,75,141,
+93,86,148,89,18,45,91,61,86,118,74,37,15,14,167,14,25,61,112,68,84,111,56,
+21,13,165,15,23,65,129,223,62,66,24,78,74,68,82,25,65,140,2,148,56,95,77,
+66,59,47,75,121,68,67,126,79,45,71,88,117,66,85,134,106,82,73,50,50,60,32,
+44,34,43,81,98,129,67,87,133,95,66,32,39,44,32,62,48,52,89,112,153,234,67,
+95,68,33,63,77,75,61,35,70,96,3,27,0,2,0,172,255,119,4,100,5,15,0,37,0,38,
+0,0,1,6,6,21,20,22,51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,7,22,18,23,
+7,38,2,39,6,35,34,38,38,53,52,54,55,23,1,209,69,60,143,151,8,30,7,5,79,65,
+53,80,40,58,58,45,160,62,147,60,166,39,28,45,145,211,111,62,58,190,4,227,
+118,189,91,144,143,3,18,40,14,62,69,48,73,40,57,81,21,113,254,195,94,65,102,
+1,98,108,4,100,204,150,102,221,95,21,0,0,2,0,211,255,119,4,85,5,14,0,63,0,
+64,0,0,1,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,21,20,23,54,51,50,22,
+23,7,38,35,34,6,21,20,22,22,51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,7,
+22,22,23,7,38,38,39,6,35,34,38,38,53,52,54,19,1,112,79,78,98,172,108,61,125,
+26,12,37,93,61,222,145,74,87,20,60,24,13,32,77,110,119,65,112,68,22,30,7,
+5,77,60,57,83,40,61,53,28,101,57,147,51,97,30,53,44,133,190,94,50,162,2,251,
+46,133,85,85,121,61,13,8,143,8,15,146,116,42,18,4,4,143,5,92,85,62,85,41,
+3,18,40,14,63,68,48,73,40,57,82,16,65,176,77,65,87,197,73,7,94,157,94,60,
+107,2,37,0,2,0,78,0,100,4,25,4,250,0,40,0,41,0,0,19,55,18,18,22,22,51,50,
+54,54,53,52,38,38,35,34,6,21,20,22,23,7,46,2,53,52,54,51,50,22,22,21,20,6,
+6,35,34,38,38,2,1,78,159,22,86,119,133,79,80,91,37,59,102,64,49,59,140,130,
+34,124,174,86,142,130,106,172,96,93,163,109,137,194,145,101,1,119,4,149,31,
+254,226,254,124,199,80,74,134,104,113,188,99,60,47,74,78,3,144,8,83,130,80,
+112,124,140,248,153,156,203,94,112,244,1,157,1,149,0,0,2,0,148,0,0,4,1,5,
+15,0,31,0,32,0,0,1,23,1,14,3,21,20,30,2,51,50,54,55,23,14,3,35,34,46,2,53,
+52,62,2,55,19,3,14,128,254,82,48,64,37,16,36,63,85,49,106,196,103,72,47,104,
+115,128,71,78,149,115,70,19,49,85,67,114,5,15,109,253,250,58,90,73,64,32,
+55,76,47,21,70,68,151,28,50,38,23,42,86,132,91,48,90,103,123,80,1,223,0,0,
+4,0,145,255,95,4,55,5,14,0,31,0,47,0,48,0,49,0,0,1,22,23,5,22,22,21,20,6,
+7,39,54,54,53,52,38,39,1,46,2,53,52,54,54,51,50,22,22,21,20,6,39,50,54,54,
+53,52,38,38,35,34,6,6,21,20,22,22,5,1,2,44,46,47,1,37,69,68,38,57,133,28,
+31,33,49,253,252,64,73,30,91,157,94,98,158,89,144,203,51,84,47,43,81,52,52,
+83,46,44,79,1,96,254,209,2,117,30,38,237,56,121,77,53,102,76,99,31,62,39,
+40,59,42,1,171,53,103,103,65,91,154,87,86,157,99,135,168,110,50,90,57,55,
+88,49,51,91,56,57,87,47,145,2,148,0,3,0,132,2,60,2,228,4,250,0,15,0,31,0,
+32,0,0,1,34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,3,34,6,6,21,20,22,22,
+51,50,54,54,53,52,38,38,3,1,181,83,139,83,76,140,89,84,139,80,79,139,86,49,
+75,38,43,75,44,46,74,42,42,74,45,2,60,72,132,82,75,131,78,74,131,79,78,132,
+76,1,180,41,68,41,45,70,37,38,70,44,42,70,38,1,10,0,0,2,0,215,4,58,2,15,5,
+54,0,15,0,16,0,0,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,23,1,79,32,
+54,34,34,55,31,32,54,34,33,55,224,5,54,32,60,34,35,59,32,32,59,35,34,59,33,
+60,255,255,0,60,0,0,6,125,7,44,2,38,0,9,0,0,0,7,0,73,5,240,0,0,255,255,0,
+60,0,0,6,59,7,44,2,38,0,9,0,0,0,7,0,62,6,29,0,0,255,255,0,60,0,0,8,77,7,44,
+2,38,0,10,0,0,0,7,0,62,8,47,0,0,255,255,0,60,0,0,8,77,7,44,2,38,0,10,0,0,
+0,7,2,221,8,47,0,0,255,255,0,60,254,139,6,59,5,15,2,38,0,9,0,0,0,7,0,90,6,
+29,0,0,255,255,0,60,253,220,6,59,5,15,2,38,0,9,0,0,0,7,0,91,6,29,0,0,0,2,
+0,0,0,0,4,142,4,250,0,34,0,35,0,0,1,21,20,6,35,34,38,38,53,52,54,55,3,33,
+53,33,21,33,17,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,19,1,171,52,
+48,49,116,78,96,83,1,254,250,4,142,253,29,90,78,223,224,69,64,148,54,62,137,
+140,92,74,2,202,169,52,58,82,119,46,66,66,20,1,38,146,146,254,246,13,197,
+196,107,220,96,85,71,179,85,139,114,253,36,0,4,0,0,255,77,6,14,4,250,0,32,
+0,44,0,56,0,68,0,0,1,33,34,39,22,22,21,20,6,35,34,0,3,55,18,22,51,50,54,53,
+52,38,39,55,33,53,33,53,33,21,35,17,35,37,50,22,21,20,6,35,34,38,53,52,54,
+33,50,22,21,20,6,35,34,38,53,52,54,23,50,22,21,20,6,35,34,38,53,52,54,4,148,
+254,231,93,19,77,83,168,136,181,254,238,116,144,97,204,118,73,77,113,104,
+58,2,42,251,108,6,14,213,165,254,156,41,61,61,41,41,61,61,254,173,41,61,61,
+41,41,61,61,231,41,61,61,41,41,61,61,3,39,4,64,152,77,124,142,1,51,1,55,52,
+254,247,254,70,68,74,146,60,132,175,146,146,251,152,219,63,44,44,63,63,44,
+44,63,63,44,44,63,63,44,44,63,184,63,44,44,63,63,44,44,63,0,0,4,0,0,0,0,4,
+194,4,250,0,17,0,22,0,32,0,33,0,0,1,6,35,34,38,39,54,54,53,52,39,35,53,33,
+21,35,17,35,1,22,23,1,17,3,39,38,39,6,7,22,22,51,50,37,3,73,147,176,177,233,
+30,132,117,75,252,4,194,213,164,254,103,23,11,1,119,92,189,52,38,32,174,41,
+127,98,120,253,197,1,112,98,238,214,28,100,86,93,99,146,146,251,152,4,104,
+49,38,254,36,2,51,253,117,231,63,53,154,53,103,99,161,0,0,1,0,0,0,0,4,159,
+4,250,0,23,0,0,51,53,33,17,33,17,20,6,35,34,38,38,53,52,54,51,51,17,33,53,
+33,21,35,17,168,2,126,254,133,53,47,51,118,74,61,63,55,254,249,4,159,213,
+146,3,214,253,159,54,60,87,125,53,53,52,1,97,146,146,251,152,0,1,0,0,0,0,
+5,230,4,250,0,38,0,0,1,35,17,33,53,33,17,35,34,38,39,22,22,21,20,14,2,35,
+34,38,2,39,55,18,22,51,50,54,53,52,38,39,55,33,53,33,53,33,5,230,213,251,
+151,3,196,241,37,56,19,77,83,49,83,110,62,121,199,174,77,144,97,205,117,73,
+77,113,104,58,2,2,251,148,5,230,4,104,251,152,146,2,149,1,3,63,153,77,67,
+100,66,33,135,1,21,206,52,254,247,254,70,68,74,146,60,132,175,146,0,2,0,129,
+0,0,3,98,5,15,0,23,0,24,0,0,33,17,62,2,53,52,38,38,35,34,6,7,39,54,51,50,
+22,22,21,20,6,7,17,3,1,112,110,148,69,68,109,62,71,120,84,52,171,155,127,
+187,97,175,158,205,2,158,1,68,115,76,70,101,48,27,40,142,71,95,170,110,143,
+206,35,253,232,2,12,0,0,4,0,0,0,0,5,35,4,250,0,49,0,53,0,54,0,55,0,0,1,38,
+38,53,52,54,54,51,51,53,33,53,33,21,35,17,33,34,6,6,21,20,22,23,54,51,50,
+22,22,21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,34,1,53,33,21,
+1,3,2,128,128,140,72,138,118,217,252,107,5,35,233,254,125,65,64,36,64,53,
+74,110,110,165,90,98,187,131,149,250,227,97,136,83,181,198,119,129,127,97,
+98,111,253,212,3,253,254,240,135,2,3,34,138,91,68,89,51,142,146,146,254,224,
+12,35,25,30,51,14,24,60,118,82,80,124,70,87,202,166,69,139,167,72,63,69,51,
+59,253,217,146,146,4,250,251,6,0,0,2,0,0,0,0,4,175,4,250,0,32,0,41,0,0,1,
+21,35,17,33,53,33,53,6,6,35,34,38,38,53,52,54,54,51,50,22,23,7,38,35,34,7,
+1,54,55,17,33,53,1,1,6,21,20,22,22,51,50,4,175,213,252,206,2,142,78,161,90,
+114,182,102,111,203,133,51,135,28,12,121,75,45,24,1,4,47,36,252,202,2,109,
+254,241,90,64,106,65,65,4,250,146,251,152,146,232,51,46,86,157,102,114,165,
+85,13,8,141,21,4,254,162,32,38,2,51,146,252,186,1,109,58,116,70,95,45,0,0,
+3,0,166,3,224,1,223,7,44,0,12,0,13,0,14,0,0,1,23,14,3,7,35,62,3,55,23,3,1,
+209,14,14,39,47,51,25,137,14,29,27,22,8,187,5,5,213,22,55,121,125,122,56,
+60,132,132,124,53,219,2,50,0,0,1,255,202,254,173,0,54,6,77,0,3,0,0,3,17,51,
+17,54,108,254,173,7,160,248,96,0,1,254,213,254,174,1,43,6,77,0,14,0,0,19,
+23,7,39,17,35,17,7,39,55,39,55,23,55,23,74,225,75,170,108,170,75,225,225,
+75,224,224,75,5,43,220,73,169,249,255,6,1,169,73,220,217,73,220,220,74,0,
+0,8,0,106,0,222,3,170,4,29,0,10,0,18,0,26,0,34,0,42,0,50,0,58,0,68,0,0,1,
+20,6,35,34,53,52,54,51,50,22,5,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,
+19,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,5,
+20,35,34,53,52,51,50,5,20,6,35,34,53,52,51,50,22,2,69,29,31,58,28,30,31,29,
+254,247,59,59,59,59,2,18,59,59,59,59,92,60,59,59,60,253,54,59,59,59,59,92,
+59,59,59,59,2,18,59,59,59,59,254,247,29,31,58,58,31,29,3,227,30,29,59,30,
+28,28,132,59,59,59,59,59,59,59,254,198,59,59,59,59,59,59,59,254,198,59,59,
+59,59,59,59,59,161,30,29,59,59,29,255,255,0,60,255,56,6,59,7,44,2,38,0,9,
+0,0,0,39,0,74,6,29,0,0,0,7,0,64,4,127,0,194,255,255,0,60,255,56,6,59,5,15,
+2,38,0,9,0,0,0,7,0,64,4,127,0,194,255,255,0,60,255,56,8,77,5,15,2,38,0,10,
+0,0,0,7,0,64,4,127,0,194,255,255,0,0,254,99,3,232,4,250,2,38,0,11,0,0,0,7,
+0,64,3,209,255,237,255,255,0,0,254,99,3,245,7,44,2,38,0,11,0,0,0,39,0,181,
+3,202,0,0,0,7,0,64,3,209,255,237,255,255,0,0,254,118,4,128,4,250,2,38,0,13,
+0,0,0,7,0,64,4,123,0,0,255,255,0,0,254,118,6,61,4,250,2,38,0,14,0,0,0,7,0,
+64,4,123,0,0,255,255,0,0,254,252,6,240,4,250,2,38,0,15,0,0,0,7,0,64,4,27,
+0,134,255,255,0,0,254,122,5,185,4,250,2,38,0,16,0,0,0,7,0,64,4,27,0,4,255,
+255,0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,39,0,73,3,185,0,0,0,7,0,64,3,159,
+0,132,255,255,0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,39,0,74,4,128,0,0,0,
+7,0,64,3,159,0,132,255,255,0,0,254,136,4,139,4,250,2,38,0,19,0,0,0,7,0,64,
+3,159,0,132,255,255,0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,39,0,75,4,128,
+0,0,0,7,0,64,3,159,0,132,255,255,0,60,255,56,8,128,7,44,2,38,0,10,0,0,0,39,
+0,64,4,127,0,194,0,7,0,73,7,243,0,0,255,255,0,60,255,56,8,77,7,44,2,38,0,
+10,0,0,0,39,0,74,8,47,0,0,0,7,0,64,4,127,0,194,255,255,0,60,255,56,8,77,7,
+44,2,38,0,10,0,0,0,39,0,75,8,47,0,0,0,7,0,64,4,127,0,194,255,255,0,60,255,
+56,8,77,7,44,2,38,0,10,0,0,0,39,0,76,8,47,0,0,0,7,0,64,4,127,0,194,255,255,
+0,0,254,181,7,8,4,250,2,38,0,100,0,0,0,7,0,64,4,27,0,134,255,255,0,0,254,
+107,6,14,4,250,2,38,0,101,0,0,0,7,0,64,4,27,0,4,255,255,0,60,255,56,6,125,
+7,44,2,38,0,9,0,0,0,39,0,73,5,240,0,0,0,7,0,64,4,127,0,194,255,255,0,0,255,
+160,4,216,4,250,2,38,0,28,0,0,0,7,0,64,3,152,1,42,255,255,0,0,254,118,5,178,
+4,250,2,38,0,29,0,0,0,7,0,64,4,241,0,0,255,255,0,0,255,160,5,49,4,250,2,38,
+0,30,0,0,0,7,0,64,3,212,1,42,255,255,0,0,254,118,5,185,4,250,2,38,0,31,0,
+0,0,7,0,64,4,246,0,0,255,255,0,0,254,99,6,8,4,250,2,38,0,33,0,0,0,7,0,64,
+3,209,255,237,255,255,0,0,255,121,6,13,4,250,2,38,0,34,0,0,0,7,0,64,4,99,
+1,3,255,255,0,0,254,118,4,38,4,250,2,38,0,35,0,0,0,7,0,64,4,127,0,0,255,255,
+0,0,254,118,4,204,4,250,2,38,0,36,0,0,0,7,0,64,4,158,0,0,255,255,0,0,255,
+155,5,230,4,250,2,38,0,39,0,0,0,7,0,64,4,82,1,37,255,255,0,0,254,89,4,173,
+4,250,2,38,0,40,0,0,0,7,0,64,3,243,255,227,255,255,0,95,255,181,5,64,5,14,
+2,38,0,41,0,0,0,7,0,64,4,16,1,63,255,255,0,0,255,18,4,70,4,250,2,38,0,42,
+0,0,0,7,0,64,3,233,0,156,255,255,0,87,255,78,5,10,5,15,2,38,0,43,0,0,0,7,
+0,64,4,35,0,216,255,255,0,0,255,160,4,170,4,250,2,38,0,46,0,0,0,7,0,64,3,
+172,1,42,255,255,0,0,255,160,4,175,4,250,2,38,0,48,0,0,0,7,0,64,3,202,1,42,
+255,255,0,95,255,201,5,189,5,14,2,38,0,49,0,0,0,7,3,17,4,166,1,83,255,255,
+0,0,255,191,4,230,4,250,2,38,0,50,0,0,0,7,3,17,3,242,1,73,255,255,0,0,254,
+149,5,139,4,250,2,38,0,54,0,0,0,7,0,64,5,1,0,31,255,255,0,0,255,160,4,145,
+4,250,2,38,0,57,0,0,0,7,0,64,3,202,1,42,255,255,0,81,255,38,5,143,5,14,2,
+38,0,58,0,0,0,7,0,64,4,1,0,176,255,255,0,0,255,160,4,190,4,250,2,38,0,59,
+0,0,0,7,0,64,3,172,1,42,255,255,0,0,255,211,5,125,4,250,2,38,0,60,0,0,0,7,
+3,17,3,32,1,93,255,255,0,0,254,17,4,94,4,250,2,38,0,61,0,0,0,7,3,17,3,69,
+255,155,0,2,0,95,255,122,5,208,5,15,0,71,0,84,0,0,37,38,38,53,52,54,51,50,
+22,22,21,20,6,7,22,23,7,38,39,6,35,34,38,38,53,52,54,54,55,38,38,53,52,54,
+54,51,50,22,22,21,20,6,7,22,51,50,55,17,35,53,33,21,35,17,35,17,6,6,35,34,
+38,39,14,2,21,20,30,2,51,50,3,54,54,53,52,38,38,35,34,6,21,20,22,2,38,7,5,
+73,60,54,81,39,50,48,74,96,119,132,55,36,74,117,185,104,60,99,81,88,95,74,
+147,101,84,140,85,84,94,63,97,201,144,182,2,48,213,165,68,171,85,82,171,70,
+74,83,43,22,55,93,72,15,53,80,74,31,68,52,71,86,81,249,18,40,14,57,64,50,
+75,38,57,67,19,96,89,85,152,91,6,82,145,89,69,115,89,48,57,148,93,72,117,
+68,52,110,79,88,136,66,18,95,1,31,146,146,251,152,2,153,31,33,36,31,45,72,
+78,48,30,64,52,33,2,60,51,106,62,33,56,34,72,60,62,110,0,1,0,0,255,176,5,
+63,4,250,0,41,0,0,19,55,33,53,33,53,33,21,35,17,35,17,33,34,39,22,22,21,20,
+6,7,22,22,23,7,38,38,39,38,38,53,52,54,51,50,22,23,54,54,53,52,38,179,49,
+2,225,252,59,5,63,213,165,254,214,130,62,120,115,110,99,47,148,84,67,90,204,
+94,133,121,58,52,45,89,58,80,95,185,2,254,138,224,146,146,251,152,2,246,9,
+62,156,102,99,139,28,29,63,26,143,35,121,75,3,63,62,48,58,45,50,10,91,67,
+102,151,0,0,2,254,21,4,235,0,43,7,44,0,20,0,21,0,0,1,38,38,53,52,54,54,51,
+50,22,23,7,38,38,35,34,6,21,20,22,23,39,254,122,49,52,82,143,91,68,108,42,
+45,35,77,45,80,89,49,57,126,4,235,80,155,66,88,126,62,29,22,135,19,25,88,
+77,59,127,84,15,0,2,252,70,253,220,255,190,255,232,0,6,0,7,0,0,5,1,39,1,51,
+1,7,7,254,87,254,79,96,1,251,82,1,43,121,134,174,254,214,134,1,58,254,143,
+79,76,0,1,0,0,0,0,4,238,4,250,0,46,0,0,1,21,33,17,54,54,51,51,21,35,34,6,
+7,17,35,17,6,6,35,34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,
+22,22,51,50,54,55,17,33,53,4,210,254,202,54,114,69,101,75,93,110,60,165,71,
+145,80,101,171,96,102,184,119,40,114,40,12,35,100,38,117,131,58,94,54,74,
+143,75,253,9,4,250,146,254,68,37,33,146,41,51,253,252,1,101,61,55,84,161,
+108,107,162,87,12,9,149,8,13,108,94,71,97,46,70,77,2,84,146,0,0,2,0,0,0,15,
+5,154,4,250,0,39,0,67,0,0,1,22,21,20,6,7,30,2,51,50,54,55,23,6,35,34,46,2,
+39,38,38,53,52,54,51,50,22,23,54,54,53,52,38,39,33,53,33,21,19,6,6,35,34,
+38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,55,2,64,34,
+130,137,107,195,214,126,118,196,86,49,200,248,117,209,210,203,97,32,37,67,
+64,51,77,31,36,38,20,14,254,101,5,77,21,64,160,86,95,154,89,89,162,106,41,
+108,25,12,31,75,37,101,110,107,92,61,118,54,4,104,79,112,155,204,60,126,153,
+78,53,52,135,116,55,125,200,127,43,78,49,49,63,47,42,32,114,77,61,99,30,146,
+146,253,81,52,54,78,146,95,97,143,75,13,8,141,7,14,95,86,82,89,49,49,0,0,
+1,0,0,1,109,2,106,4,250,0,17,0,0,1,17,20,6,35,34,38,38,53,52,54,51,51,17,
+33,53,33,21,1,171,53,47,51,118,74,61,63,55,254,249,2,106,4,104,253,119,54,
+60,87,125,53,53,52,1,137,146,146,0,0,1,0,0,0,241,3,178,4,250,0,41,0,0,1,6,
+21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,
+38,53,52,54,55,38,38,53,52,55,35,53,33,21,1,39,43,84,73,58,72,50,42,13,26,
+32,104,114,108,97,90,153,72,84,91,206,119,104,161,88,44,40,83,91,20,107,2,
+237,4,104,49,68,70,87,11,16,6,143,3,85,78,79,86,70,76,123,85,82,75,139,90,
+60,108,37,40,143,84,64,47,146,146,0,255,255,0,0,253,220,5,178,4,250,2,38,
+0,29,0,0,0,7,0,81,3,182,0,0,0,2,0,0,0,241,4,10,4,250,0,3,0,34,0,0,17,53,33,
+21,19,14,3,35,34,38,38,53,52,54,55,5,53,33,50,23,7,35,34,6,21,20,22,22,51,
+50,54,54,55,3,72,194,64,85,97,88,50,104,165,93,47,43,254,211,2,89,81,38,14,
+66,123,141,57,88,52,61,104,86,51,4,104,146,146,253,45,55,53,39,17,79,148,
+95,58,101,37,3,148,3,143,104,92,58,82,37,36,60,51,0,0,2,0,0,0,0,5,185,4,250,
+0,3,0,74,0,0,1,33,53,33,1,7,38,38,53,52,54,54,51,50,22,22,21,20,6,6,4,35,
+34,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,
+22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,36,54,53,52,38,38,35,34,6,21,
+20,22,5,185,250,71,5,185,254,142,67,154,163,65,130,91,94,153,93,99,194,254,
+236,162,129,181,89,31,33,91,92,84,151,98,41,104,23,12,25,74,43,90,92,77,82,
+58,75,46,40,13,23,29,96,98,122,112,155,1,11,148,43,81,55,61,67,116,4,104,
+146,253,28,129,43,166,115,74,118,69,78,164,118,115,224,185,106,77,135,89,
+44,91,37,44,134,84,81,116,58,13,8,141,7,14,66,66,52,71,20,19,6,143,3,73,70,
+79,81,132,227,132,62,103,59,68,58,71,102,0,2,0,0,0,163,4,178,4,250,0,3,0,
+32,0,0,17,53,33,21,1,34,38,39,22,22,21,20,14,2,35,34,38,2,39,55,18,18,51,
+50,54,53,52,38,39,55,33,21,4,178,254,201,38,58,19,79,84,49,83,111,61,122,
+198,173,78,144,97,204,118,73,77,111,106,58,2,42,4,104,146,146,254,142,1,3,
+68,164,83,72,107,71,34,144,1,37,221,52,254,227,254,238,76,75,81,158,68,132,
+146,0,0,1,0,0,255,31,4,202,4,250,0,70,0,0,1,6,6,35,22,21,20,14,2,7,22,23,
+7,38,39,38,38,53,52,54,51,50,22,23,50,54,54,53,52,38,35,34,6,7,38,38,53,52,
+62,2,51,51,53,33,53,33,21,35,17,33,34,14,3,21,20,22,23,54,51,50,22,23,22,
+51,50,54,55,4,202,81,165,104,5,47,77,98,51,133,149,67,225,196,131,120,58,
+52,42,86,63,74,124,69,98,83,36,91,41,126,142,44,84,113,87,192,253,146,3,246,
+227,254,150,43,56,32,22,12,64,53,75,78,76,126,46,47,67,77,131,66,1,226,58,
+49,29,30,64,98,73,48,13,62,40,143,90,136,5,62,61,48,58,42,53,45,82,54,67,
+80,19,17,35,155,99,60,84,59,29,175,146,146,254,191,7,16,23,32,19,42,64,14,
+24,38,37,20,52,61,0,2,0,0,0,242,4,147,4,250,0,3,0,39,0,0,17,53,33,21,19,6,
+35,35,14,2,35,34,36,39,55,30,2,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,
+22,22,23,51,50,55,4,111,36,80,99,4,16,100,163,95,182,254,238,98,140,58,116,
+137,92,111,127,105,96,51,93,47,56,56,135,62,91,149,93,13,17,90,72,4,104,146,
+146,253,163,21,78,119,63,228,223,54,132,151,71,106,89,85,90,27,24,148,25,
+29,63,121,84,34,255,255,0,0,253,220,4,99,4,250,2,38,0,35,0,0,0,7,0,81,3,45,
+0,0,255,255,0,0,253,220,4,204,4,250,2,38,0,36,0,0,0,7,0,81,3,44,0,0,255,255,
+0,0,253,220,5,35,4,250,2,38,0,37,0,0,0,7,0,81,3,182,0,0,255,255,0,0,253,220,
+4,158,4,250,2,38,0,38,0,0,0,7,0,81,3,50,0,0,0,2,0,0,1,44,3,218,4,250,0,16,
+0,30,0,0,1,17,20,14,3,35,34,38,38,53,17,35,53,33,21,33,33,17,20,30,3,51,50,
+62,2,53,3,93,28,59,85,108,67,118,156,78,162,3,218,254,223,254,141,15,29,43,
+58,38,64,73,39,12,4,104,254,42,79,111,86,55,27,88,178,154,1,152,146,146,254,
+106,73,89,61,37,17,39,71,90,77,0,0,2,0,0,255,231,3,51,4,250,0,3,0,24,0,0,
+17,53,33,21,3,34,6,6,21,20,22,22,23,7,46,2,53,52,62,2,51,33,21,3,17,189,129,
+129,80,63,126,107,110,143,133,75,55,118,167,125,1,5,4,104,146,146,254,56,
+27,82,77,65,122,131,86,107,123,155,158,85,67,123,92,40,146,0,0,3,0,95,1,14,
+4,19,5,14,0,40,0,41,0,42,0,0,1,36,53,52,54,54,51,50,22,22,21,20,6,7,22,22,
+51,50,54,55,23,6,6,35,34,38,38,39,54,54,53,52,38,38,35,34,6,21,20,22,23,3,
+1,1,126,254,225,69,116,73,95,157,83,155,160,51,121,98,89,156,79,76,95,202,
+116,115,188,129,29,179,175,45,78,49,53,65,79,87,230,2,104,3,33,41,221,75,
+106,50,84,151,99,143,194,63,80,65,69,79,138,80,75,88,176,126,36,140,120,66,
+94,47,51,44,52,62,9,254,81,2,248,0,255,255,0,0,253,220,4,240,4,250,2,38,0,
+42,0,0,0,7,0,81,3,186,0,0,0,2,0,87,0,211,3,220,5,15,0,56,0,57,0,0,1,14,2,
+35,34,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,39,54,53,
+52,38,35,34,6,6,21,20,30,2,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,
+55,3,3,220,64,114,142,88,104,161,88,36,40,107,109,75,136,85,71,116,67,41,
+40,125,41,50,46,38,63,37,37,62,79,41,58,74,50,42,13,26,32,104,114,108,97,
+90,153,72,171,1,109,54,63,37,75,139,90,54,103,40,41,151,106,80,131,74,51,
+96,61,48,94,37,79,40,50,39,47,42,74,45,51,68,44,22,4,16,6,143,3,85,78,79,
+86,70,76,3,5,0,0,2,0,0,1,130,3,20,4,250,0,3,0,16,0,0,17,53,33,21,1,21,20,
+6,35,34,38,38,53,52,51,33,21,2,251,254,168,55,50,48,114,76,124,2,76,4,104,
+146,146,253,250,110,55,59,85,126,54,105,146,0,0,1,0,0,1,44,3,125,4,250,0,
+25,0,0,1,17,20,30,3,51,50,54,55,23,14,2,35,34,46,2,53,17,35,53,33,21,1,70,
+14,31,46,70,49,73,147,61,76,85,109,112,66,85,140,95,39,162,2,148,4,104,254,
+139,98,96,55,41,20,70,63,139,60,52,27,58,111,147,118,1,138,146,146,0,0,2,
+0,0,0,0,5,0,4,250,0,26,0,39,0,0,33,17,6,35,34,46,2,53,17,35,53,33,21,33,17,
+54,54,51,51,21,35,34,6,6,7,17,1,17,20,30,4,51,50,54,55,17,3,9,120,149,77,
+139,91,39,162,4,228,254,202,49,110,78,101,75,74,80,70,39,253,152,6,18,35,
+39,52,30,74,131,66,1,140,96,59,111,140,116,1,146,146,146,254,74,33,31,146,
+14,34,33,253,241,4,104,254,121,60,82,62,48,27,13,61,67,2,43,0,3,0,0,0,241,
+3,132,4,250,0,3,0,26,0,35,0,0,17,53,33,21,19,6,6,35,34,38,38,53,52,54,54,
+51,50,22,23,7,38,35,34,7,1,54,55,7,1,6,21,20,22,22,51,50,3,84,48,95,200,112,
+114,182,102,111,203,133,51,135,28,12,121,75,41,35,1,19,33,42,192,254,226,
+84,64,106,65,72,4,104,146,146,253,36,80,75,86,157,102,114,165,85,13,8,141,
+21,5,254,168,24,41,126,1,102,59,111,70,95,45,0,0,2,0,95,1,53,4,67,5,14,0,
+38,0,42,0,0,1,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,34,6,21,20,
+22,23,7,36,53,52,54,54,51,50,30,2,21,21,33,21,1,53,51,21,2,167,54,45,48,116,
+81,63,61,60,38,77,58,56,57,105,108,15,254,176,70,118,73,71,119,95,38,1,156,
+254,245,106,1,255,74,60,68,83,127,50,43,45,216,122,113,55,53,42,62,59,5,146,
+28,240,77,104,49,40,102,150,108,237,146,2,105,146,146,0,0,1,0,0,1,53,3,78,
+4,250,0,21,0,0,1,17,33,21,33,21,20,6,35,34,38,38,53,52,54,51,51,17,33,53,
+33,21,1,168,1,166,254,90,54,45,48,116,81,64,61,55,254,252,2,173,4,104,254,
+41,146,74,60,68,83,127,50,43,45,1,215,146,146,0,0,2,0,0,1,14,3,151,4,250,
+0,28,0,29,0,0,1,22,22,21,20,6,7,22,22,51,50,54,55,23,6,6,35,34,38,39,54,54,
+53,52,39,35,53,33,21,1,1,177,28,31,115,113,41,127,98,86,157,68,78,97,193,
+111,177,233,30,132,117,75,252,2,190,253,144,4,104,52,111,53,108,151,36,103,
+99,73,75,138,82,73,238,214,28,100,86,93,99,146,146,253,216,0,0,2,0,0,2,8,
+3,125,4,250,0,3,0,17,0,0,1,33,53,33,19,6,6,35,34,36,39,55,22,22,51,50,54,
+55,3,80,252,176,3,80,45,62,156,82,130,254,253,137,64,138,190,97,104,153,80,
+4,104,146,253,91,38,39,85,78,120,75,57,42,46,0,0,2,0,0,255,231,4,114,4,250,
+0,3,0,44,0,0,17,53,33,21,19,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,30,
+4,23,7,46,4,53,52,54,54,51,50,22,23,54,51,50,22,23,4,30,41,41,43,98,140,44,
+157,25,39,60,98,50,79,91,11,26,47,79,126,85,110,114,125,100,61,29,86,152,
+87,84,152,71,122,176,30,62,23,4,104,146,146,254,99,14,152,150,49,96,69,45,
+36,90,76,28,54,57,69,84,111,71,107,97,116,116,106,101,53,93,139,76,56,58,
+114,9,8,0,4,0,0,0,130,5,217,4,250,0,3,0,34,0,49,0,64,0,0,17,53,33,21,1,62,
+2,51,50,22,22,21,20,6,6,35,34,38,38,39,6,6,35,34,38,38,53,52,54,54,51,50,
+22,22,19,22,22,51,50,54,54,53,52,38,38,35,34,6,7,39,38,38,35,34,6,6,21,20,
+22,22,51,50,54,55,5,217,253,78,41,91,104,70,96,159,94,88,164,108,71,121,103,
+59,54,143,108,97,157,95,92,165,103,70,118,103,73,74,123,66,58,98,60,51,86,
+53,73,109,53,135,77,121,64,58,98,60,52,84,52,72,111,53,4,104,146,146,254,
+122,60,71,30,90,177,121,108,173,100,39,68,55,80,82,88,176,123,113,174,95,
+37,67,254,133,76,64,49,109,82,84,106,47,98,118,75,78,63,49,109,82,83,107,
+47,99,117,0,0,2,0,0,0,241,3,102,4,250,0,3,0,30,0,0,17,53,33,21,19,6,6,35,
+34,38,38,53,52,54,54,51,50,22,23,7,38,35,34,6,21,20,22,22,51,50,55,3,64,38,
+93,194,106,110,174,98,106,194,127,48,129,27,12,114,70,129,141,60,101,61,172,
+138,4,104,146,146,253,36,78,77,86,157,102,114,165,85,13,8,149,21,113,101,
+67,92,43,146,0,2,0,81,255,254,3,79,5,14,0,46,0,47,0,0,1,54,54,53,52,38,38,
+35,34,6,21,20,22,23,7,46,2,53,52,54,54,51,50,22,22,21,20,6,7,22,23,7,38,38,
+39,6,35,34,38,38,53,52,54,51,50,22,7,1,136,109,124,55,99,64,59,65,140,130,
+34,124,174,86,62,128,93,104,171,94,141,126,166,161,131,98,168,83,56,62,47,
+77,44,70,61,41,81,85,2,52,36,182,126,73,117,65,58,49,74,78,3,144,8,83,130,
+80,70,106,60,96,179,118,142,239,68,145,218,91,138,193,70,11,32,62,40,57,65,
+37,73,0,0,2,0,0,1,44,3,145,4,250,0,17,0,27,0,0,1,1,23,14,3,35,34,46,2,53,
+17,35,53,33,21,3,1,17,20,30,3,51,50,1,163,1,162,76,73,87,89,90,53,85,140,
+95,39,162,3,33,64,254,101,14,31,46,70,49,100,4,104,253,225,141,51,48,31,14,
+58,111,147,118,1,138,146,146,253,142,2,24,254,229,98,96,55,41,20,0,0,1,0,
+0,255,231,3,219,4,250,0,41,0,0,1,34,39,6,7,22,22,23,7,46,2,39,38,38,53,52,
+54,54,51,50,22,23,54,54,53,52,38,39,33,53,33,21,35,22,21,20,7,22,51,33,21,
+3,12,221,114,45,57,84,226,125,110,114,222,170,40,24,17,27,59,45,51,77,31,
+36,38,20,14,254,101,3,58,250,34,72,56,118,1,19,2,19,44,33,24,108,224,101,
+110,99,225,202,66,41,56,32,27,49,32,47,42,32,114,77,61,99,30,146,146,79,112,
+161,92,7,146,0,0,1,0,0,254,221,4,82,4,250,0,46,0,0,1,21,33,34,6,6,21,20,30,
+2,23,7,46,4,53,52,55,38,38,53,52,62,2,51,51,53,33,53,33,21,35,17,33,34,6,
+6,21,20,22,23,54,51,4,82,254,42,132,143,79,28,67,129,121,110,111,111,92,57,
+28,129,53,52,50,85,110,83,160,253,138,3,250,223,254,182,64,63,38,52,44,97,
+191,2,102,147,42,100,72,48,82,88,122,97,107,93,102,104,100,102,57,154,96,
+42,101,61,63,87,56,26,175,146,146,254,191,16,46,35,40,63,19,26,0,5,0,0,255,
+77,4,178,4,250,0,24,0,28,0,40,0,52,0,64,0,0,1,33,34,39,22,22,21,20,6,35,34,
+0,3,55,18,22,51,50,54,53,52,38,39,55,33,37,53,33,21,1,50,22,21,20,6,35,34,
+38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,23,50,22,21,20,6,35,34,38,
+53,52,54,4,148,254,231,93,19,77,83,168,136,181,254,238,116,144,97,204,118,
+73,77,113,104,58,2,42,251,108,4,178,254,126,41,61,61,41,41,61,61,254,173,
+41,61,61,41,41,61,61,231,41,61,61,41,41,61,61,3,39,4,64,152,77,124,142,1,
+51,1,55,52,254,247,254,70,68,74,146,60,132,175,146,146,252,115,63,44,44,63,
+63,44,44,63,63,44,44,63,63,44,44,63,184,63,44,44,63,63,44,44,63,0,3,0,0,1,
+14,3,102,4,250,0,18,0,28,0,29,0,0,1,6,35,34,38,39,54,54,53,52,39,35,53,33,
+21,33,22,23,1,7,39,38,39,6,7,22,22,51,50,37,3,102,166,186,177,233,30,132,
+117,75,252,2,190,254,242,23,11,1,125,98,189,52,38,32,174,41,127,98,120,253,
+207,1,125,111,238,214,28,100,86,93,99,146,146,47,40,254,31,83,231,63,53,154,
+53,103,99,161,0,2,0,95,255,122,4,27,5,15,0,64,0,77,0,0,37,38,38,53,52,54,
+51,50,22,22,21,20,6,7,22,23,7,38,39,6,35,34,38,38,53,52,54,54,55,38,38,53,
+52,54,54,51,50,22,22,21,20,6,7,22,51,50,54,55,23,6,6,35,34,38,39,14,2,21,
+20,30,2,51,50,3,54,54,53,52,38,38,35,34,6,21,20,22,2,38,7,5,73,60,54,81,39,
+50,48,74,96,119,132,55,36,74,117,185,104,60,99,81,88,95,74,147,101,84,140,
+85,84,94,63,97,72,119,59,36,61,137,67,82,171,70,74,83,43,22,55,93,72,15,53,
+80,74,31,68,52,71,86,81,249,18,40,14,57,64,50,75,38,57,67,19,96,89,85,152,
+91,6,82,145,89,69,115,89,48,57,148,93,72,117,68,52,110,79,88,136,66,18,21,
+25,150,20,21,36,31,45,72,78,48,30,64,52,33,2,60,51,106,62,33,56,34,72,60,
+62,110,0,2,0,0,255,176,3,167,4,250,0,3,0,37,0,0,17,53,33,21,3,34,39,22,22,
+21,20,6,7,22,22,23,7,38,38,39,38,38,53,52,54,51,50,22,23,54,54,53,52,38,39,
+55,33,21,3,119,220,130,62,120,115,110,99,47,148,84,67,90,204,94,133,121,58,
+52,45,89,58,80,95,185,184,49,2,195,4,104,146,146,254,142,9,62,156,102,99,
+139,28,29,63,26,143,35,121,75,3,63,62,48,58,45,50,10,91,67,102,151,55,138,
+146,0,255,255,0,0,255,160,4,238,4,250,2,38,0,183,0,0,0,7,3,17,3,102,1,42,
+255,255,0,0,255,211,5,154,4,250,2,38,0,184,0,0,0,7,3,17,3,32,1,93,255,255,
+0,0,255,211,2,106,4,250,2,38,0,185,0,0,0,7,0,64,3,142,1,93,255,255,0,0,255,
+160,3,178,4,250,2,38,0,186,0,0,0,7,0,64,3,152,1,42,255,255,0,0,253,220,5,
+178,4,250,2,38,0,29,0,0,0,7,2,122,3,182,0,0,255,255,0,0,255,160,4,10,4,250,
+2,38,0,188,0,0,0,7,0,64,3,212,1,42,255,255,0,0,254,118,5,185,4,250,2,38,0,
+189,0,0,0,7,0,64,4,246,0,0,255,255,0,0,255,24,4,178,4,250,2,38,0,190,0,0,
+0,7,0,64,4,125,0,162,255,255,0,0,254,99,4,202,4,250,2,38,0,191,0,0,0,7,0,
+64,3,209,255,237,255,255,0,0,255,121,4,147,4,250,2,38,0,192,0,0,0,7,0,64,
+4,99,1,3,255,255,0,0,253,220,4,99,4,250,2,38,0,35,0,0,0,7,2,122,3,45,0,0,
+255,255,0,0,253,220,4,204,4,250,2,38,0,36,0,0,0,7,2,122,3,44,0,0,255,255,
+0,0,253,220,5,35,4,250,2,38,0,37,0,0,0,7,2,122,3,182,0,0,255,255,0,0,253,
+220,4,204,4,250,2,38,0,38,0,0,0,7,2,122,3,150,0,0,255,255,0,0,255,155,3,218,
+4,250,2,38,0,197,0,0,0,7,0,64,4,82,1,37,255,255,0,0,254,89,3,51,4,250,2,38,
+0,198,0,0,0,7,0,64,3,243,255,227,255,255,0,95,255,181,4,19,5,14,2,38,0,199,
+0,0,0,7,0,64,4,16,1,63,255,255,0,0,253,220,4,240,4,250,2,38,0,42,0,0,0,39,
+0,81,3,186,0,0,0,7,0,64,3,163,0,156,255,255,0,87,255,78,3,220,5,15,2,38,0,
+201,0,0,0,7,0,64,4,35,0,216,255,255,0,0,255,211,3,20,4,250,2,38,0,202,0,0,
+0,7,3,17,3,182,1,93,255,255,0,0,255,160,3,125,4,250,2,38,0,203,0,0,0,7,0,
+64,3,172,1,42,255,255,0,0,255,160,5,0,4,250,2,38,0,204,0,0,0,7,0,64,3,102,
+1,42,255,255,0,0,255,160,3,132,4,250,2,38,0,205,0,0,0,7,0,64,3,202,1,42,255,
+255,0,95,255,201,4,67,5,14,2,38,0,206,0,0,0,7,0,64,4,166,1,83,255,255,0,0,
+255,191,3,78,4,250,2,38,0,207,0,0,0,7,0,64,3,242,1,73,255,255,0,0,255,160,
+3,151,4,250,2,38,0,208,0,0,0,7,0,64,3,102,1,42,255,255,0,0,254,149,4,114,
+4,250,2,38,0,210,0,0,0,7,0,64,5,1,0,31,255,255,0,0,254,230,5,217,4,250,2,
+38,0,211,0,0,0,7,0,64,3,239,0,112,255,255,0,0,255,160,3,102,4,250,2,38,0,
+212,0,0,0,7,0,64,3,202,1,42,255,255,0,81,255,38,3,79,5,14,2,38,0,213,0,0,
+0,7,0,64,4,1,0,176,255,255,0,0,255,160,3,145,4,250,2,38,0,214,0,0,0,7,0,64,
+3,172,1,42,255,255,0,0,255,211,3,219,4,250,2,38,0,215,0,0,0,7,3,17,3,32,1,
+93,255,255,0,0,254,17,4,82,4,250,2,38,0,216,0,0,0,7,3,17,3,69,255,155,0,3,
+0,0,255,231,6,55,4,250,0,56,0,57,0,58,0,0,1,21,33,17,54,54,51,50,22,22,21,
+20,6,7,39,54,54,53,52,38,35,34,6,7,17,35,17,1,39,37,38,38,53,52,54,54,51,
+50,22,23,7,38,38,35,34,6,21,20,22,22,51,50,54,55,17,33,53,33,1,6,55,253,101,
+51,118,73,87,136,78,69,64,148,52,64,80,72,55,114,57,165,253,199,96,1,5,122,
+138,102,184,119,40,114,40,12,35,100,38,117,131,58,94,54,74,143,75,253,9,2,
+247,254,216,4,250,146,254,98,50,54,75,150,103,104,213,94,85,66,173,83,94,
+95,76,73,253,242,1,98,254,133,134,150,30,175,130,107,162,87,12,9,149,8,13,
+108,94,71,97,46,70,77,2,84,146,251,247,0,0,2,0,0,255,15,6,169,4,250,0,29,
+0,69,0,0,1,35,17,35,53,1,39,37,46,2,39,38,38,53,52,54,51,50,22,23,54,54,53,
+52,38,39,33,53,33,1,30,2,23,37,53,6,6,35,34,38,38,53,52,54,54,51,50,22,23,
+7,38,38,35,34,6,21,20,22,51,50,54,55,17,33,22,21,20,6,6,169,213,165,253,13,
+85,1,28,107,211,204,96,34,38,67,64,51,77,31,36,38,20,14,254,101,6,169,250,
+175,112,192,215,131,1,77,56,133,70,95,154,89,89,162,106,41,108,25,12,31,75,
+37,101,110,107,92,61,118,54,253,17,34,130,4,104,251,152,169,254,102,146,139,
+27,123,199,125,45,80,49,49,63,47,42,32,114,77,61,99,30,146,253,12,130,149,
+77,1,169,75,33,37,78,146,95,97,143,75,13,8,141,7,14,95,86,82,89,49,49,2,42,
+79,112,153,206,0,0,1,0,0,255,206,4,159,4,250,0,25,0,0,37,1,39,1,17,33,17,
+20,6,35,34,38,38,53,52,54,51,51,17,33,53,33,21,35,17,35,3,38,254,59,98,2,
+39,254,133,53,47,51,118,74,61,63,55,254,249,4,159,213,164,251,254,211,138,
+1,77,2,195,253,119,54,60,87,125,53,53,52,1,137,146,146,251,152,0,3,0,0,255,
+206,4,216,4,250,0,21,0,44,0,45,0,0,1,21,35,17,35,17,1,39,37,38,38,53,52,54,
+55,38,38,53,52,55,35,53,5,6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,
+51,50,54,55,17,1,4,216,213,165,253,147,96,1,47,130,141,44,40,83,91,20,107,
+1,39,43,84,73,56,74,50,42,13,26,32,104,114,108,97,90,153,72,254,180,4,250,
+146,251,152,1,89,254,117,134,171,20,153,117,60,108,37,40,143,84,64,47,146,
+146,49,68,70,87,11,16,6,143,3,85,78,79,86,70,76,2,85,252,137,0,255,255,0,
+0,253,220,5,178,4,250,2,38,0,29,0,0,0,7,0,182,4,178,0,0,0,2,0,0,255,206,5,
+49,4,250,0,35,0,36,0,0,1,21,35,17,35,17,1,39,37,38,38,53,52,54,55,5,53,33,
+50,23,7,35,34,6,21,20,22,22,51,50,54,54,55,17,33,53,1,5,49,213,164,253,157,
+96,1,49,123,139,47,43,254,211,2,89,81,38,14,66,123,141,57,88,52,61,104,86,
+51,252,72,2,138,4,250,146,251,152,1,94,254,112,134,173,26,163,117,58,101,
+37,3,148,3,143,104,92,58,82,37,36,60,51,2,84,146,251,247,0,255,255,0,0,253,
+220,5,185,4,250,2,38,0,31,0,0,0,7,0,182,4,181,0,0,0,1,0,0,255,206,6,84,4,
+250,0,38,0,0,1,35,17,35,53,1,39,1,17,33,34,39,22,22,21,20,14,2,35,34,0,3,
+55,22,22,51,50,54,53,52,38,39,55,33,53,33,53,33,6,84,213,165,254,59,98,2,
+39,254,161,75,19,69,73,49,83,111,61,178,254,235,116,144,98,202,119,72,78,
+113,104,58,2,112,251,38,6,84,4,104,251,152,251,254,211,138,1,77,1,81,2,55,
+132,75,62,92,61,30,1,29,1,27,52,242,227,62,59,66,127,54,132,224,146,0,0,2,
+0,0,255,31,6,134,4,250,0,56,0,81,0,0,1,38,38,53,52,62,2,51,51,53,33,53,33,
+21,35,17,35,53,1,39,1,53,6,6,35,35,22,21,20,14,2,7,22,23,7,38,39,38,38,53,
+52,54,51,50,22,23,50,54,54,53,52,38,35,34,6,1,17,33,34,14,3,21,20,22,23,54,
+51,50,22,23,22,22,51,50,54,54,55,17,1,114,126,142,44,84,113,87,192,253,146,
+6,134,213,165,254,223,118,1,151,82,191,119,24,5,47,77,98,51,133,149,67,225,
+196,131,120,58,52,42,86,63,74,124,69,98,83,36,91,1,120,254,150,43,56,32,22,
+12,64,53,75,78,75,124,46,28,73,58,73,117,101,67,1,176,35,155,99,60,84,59,
+29,175,146,146,251,152,228,254,234,115,1,90,52,46,42,29,30,64,98,73,48,13,
+62,40,143,90,136,5,62,61,48,58,42,53,45,82,54,67,80,19,2,167,254,191,7,16,
+23,32,19,42,64,14,24,37,35,13,10,26,50,54,1,223,0,0,1,0,0,255,206,6,73,4,
+250,0,47,0,0,1,54,54,51,50,22,22,23,51,50,55,17,33,53,33,21,35,17,35,53,1,
+39,1,53,6,35,35,14,2,35,34,36,39,55,30,2,51,50,54,53,52,38,35,34,6,7,1,137,
+56,135,62,91,149,93,13,17,125,97,251,49,6,73,213,165,254,59,98,2,39,103,136,
+4,15,99,163,97,182,254,238,98,140,58,116,137,92,111,127,105,96,51,93,47,3,
+144,25,29,63,121,84,70,1,104,146,146,251,152,251,254,211,138,1,77,175,42,
+78,118,64,228,223,54,132,151,71,106,89,85,90,27,24,0,255,255,0,0,253,220,
+4,38,4,250,2,38,0,35,0,0,0,7,0,182,3,250,0,0,255,255,0,0,253,220,4,204,4,
+250,2,38,0,36,0,0,0,7,0,182,4,79,0,0,255,255,0,0,253,220,5,35,4,250,2,38,
+0,37,0,0,0,7,0,182,4,178,0,0,255,255,0,0,253,220,4,158,4,250,2,38,0,38,0,
+0,0,7,0,182,4,60,0,0,0,2,0,0,255,206,5,230,4,250,0,24,0,38,0,0,1,35,17,35,
+53,1,39,1,17,33,17,20,14,3,35,34,38,38,53,17,35,53,33,5,33,17,20,30,3,51,
+50,62,2,53,5,230,213,165,254,59,98,2,39,254,241,28,59,85,108,67,118,156,78,
+162,5,230,252,211,254,141,15,29,43,58,38,64,73,39,12,4,104,251,152,251,254,
+211,138,1,77,2,195,254,42,79,111,86,55,27,88,178,154,1,152,146,146,254,106,
+73,89,61,37,17,39,71,90,77,0,1,0,0,0,0,4,136,4,250,0,26,0,0,19,54,54,51,50,
+22,22,23,17,33,53,33,21,35,17,35,17,1,39,1,46,2,35,34,6,7,55,87,150,75,81,
+128,126,80,252,242,4,136,213,165,253,247,98,1,248,67,85,88,56,62,119,78,3,
+85,42,38,51,111,103,1,204,146,146,251,152,1,223,254,166,138,1,49,85,79,39,
+37,39,0,0,3,0,95,255,206,5,64,5,14,0,47,0,48,0,49,0,0,1,36,53,52,54,54,51,
+50,22,22,21,20,6,7,22,22,51,50,54,55,17,35,53,33,21,35,17,35,17,1,39,37,38,
+38,39,54,54,53,52,38,38,35,34,6,21,20,22,23,19,37,1,126,254,225,69,116,73,
+95,157,83,155,160,51,121,98,89,156,79,168,2,33,213,164,253,112,96,1,94,153,
+204,39,179,175,45,78,49,53,65,79,87,231,254,51,3,33,41,221,75,106,50,84,151,
+99,143,194,63,80,65,69,79,2,53,146,146,251,152,1,111,254,95,134,197,16,193,
+170,36,140,120,66,94,47,51,44,52,62,9,253,93,244,0,0,4,0,0,255,120,4,70,4,
+250,0,49,0,50,0,51,0,52,0,0,5,38,39,1,39,37,38,38,53,52,62,4,51,51,53,33,
+53,33,21,33,17,35,34,6,6,21,20,22,22,51,50,55,38,38,53,52,54,51,50,22,22,
+21,20,6,7,22,23,1,19,39,3,79,92,54,253,234,81,1,95,164,178,25,59,88,109,138,
+80,10,253,164,4,70,254,187,99,158,166,87,73,151,111,15,30,7,5,77,60,57,83,
+40,49,56,58,86,254,133,208,224,118,150,118,254,226,145,157,36,198,157,57,
+95,91,67,43,23,195,146,146,254,173,54,112,86,74,113,64,3,18,40,14,63,68,48,
+73,40,56,76,22,112,115,5,44,251,6,140,0,2,0,87,255,168,5,10,5,15,0,62,0,63,
+0,0,1,21,35,17,35,17,1,39,37,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,
+22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,30,2,23,54,51,50,23,7,38,35,34,
+6,21,20,22,51,50,54,55,17,35,53,3,5,10,213,165,253,126,96,1,63,125,141,36,
+40,107,109,75,136,85,71,116,67,41,40,125,41,50,46,38,63,37,37,62,79,41,58,
+74,50,42,13,26,32,104,114,108,97,90,153,72,127,205,4,250,146,251,152,1,64,
+254,104,134,180,21,154,114,54,103,40,41,151,106,80,131,74,51,96,61,48,94,
+37,79,40,50,39,47,42,74,45,51,68,44,22,4,16,6,143,3,85,78,79,86,70,76,2,115,
+146,251,217,0,1,0,0,255,206,4,142,4,250,0,24,0,0,17,53,33,21,35,17,35,53,
+1,39,1,53,33,21,20,6,35,34,38,38,53,52,51,33,17,4,142,213,165,254,59,98,2,
+39,254,143,55,50,48,114,76,124,2,76,4,104,146,146,251,152,251,254,211,138,
+1,77,189,110,55,59,85,126,54,105,1,116,0,3,0,0,255,230,4,170,4,250,0,15,0,
+27,0,28,0,0,1,35,17,35,17,1,39,37,46,2,53,17,35,53,33,5,17,20,30,3,51,50,
+54,55,17,1,4,170,213,164,253,139,96,1,91,98,122,57,162,4,170,252,156,14,31,
+46,70,49,73,147,61,254,216,4,104,251,152,1,142,254,88,134,205,16,106,155,
+144,1,138,146,146,254,139,98,96,55,41,20,70,63,2,38,252,196,0,4,0,0,255,232,
+6,73,4,250,0,37,0,50,0,51,0,52,0,0,33,17,1,39,37,46,3,53,17,35,53,33,21,33,
+17,54,54,51,50,22,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,17,1,17,20,30,
+4,51,50,54,55,17,53,1,3,9,253,177,96,1,72,61,91,71,33,162,6,73,253,101,51,
+118,73,87,136,78,69,64,148,52,64,80,72,55,114,57,253,152,6,18,35,39,52,30,
+74,131,66,254,243,1,141,254,91,132,208,12,60,100,132,106,1,146,146,146,254,
+98,50,54,75,150,103,104,213,94,85,66,173,83,94,95,76,73,253,242,4,104,254,
+121,60,82,62,48,27,13,61,67,2,43,146,252,50,0,0,3,0,0,255,206,4,175,4,250,
+0,29,0,38,0,39,0,0,1,21,35,17,35,17,1,39,37,38,38,53,52,54,54,51,50,22,23,
+7,38,35,34,7,1,54,55,17,33,53,1,1,6,21,20,22,22,51,50,7,4,175,213,164,253,
+158,96,1,44,151,170,111,203,133,51,135,28,12,121,75,41,35,1,19,33,42,252,
+202,2,118,254,226,84,64,106,65,72,74,4,250,146,251,152,1,93,254,113,134,170,
+21,179,132,114,165,85,13,8,141,21,5,254,168,24,41,2,91,146,252,149,1,102,
+59,111,70,95,45,136,0,0,1,0,95,255,206,5,189,5,14,0,50,0,0,1,33,17,33,53,
+33,21,35,17,35,53,1,39,1,53,33,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,
+38,35,34,6,21,20,22,23,7,36,53,52,54,54,51,50,30,2,21,2,167,1,156,254,245,
+2,133,213,165,254,59,98,2,39,254,100,54,45,48,116,81,63,61,60,38,77,58,56,
+57,105,108,15,254,176,70,118,73,71,119,95,38,2,145,1,215,146,146,251,152,
+251,254,211,138,1,77,90,74,60,68,83,127,50,43,45,216,122,113,55,53,42,62,
+59,5,146,28,240,77,104,49,40,102,150,108,0,2,0,0,255,206,4,230,4,250,0,25,
+0,29,0,0,1,35,17,35,53,1,39,1,53,33,21,20,6,35,34,38,38,53,52,54,51,51,17,
+33,53,33,1,17,33,17,4,230,213,165,254,59,98,2,39,254,60,54,45,48,116,81,64,
+61,55,254,252,4,230,254,134,254,60,4,104,251,152,251,254,211,138,1,77,90,
+74,60,68,83,127,50,43,45,1,215,146,253,151,1,215,254,41,0,0,4,0,0,255,206,
+4,194,4,250,0,18,0,32,0,33,0,34,0,0,1,1,39,37,38,38,39,54,54,53,52,39,35,
+53,33,21,35,17,35,1,22,22,51,50,54,55,17,33,22,22,21,20,6,19,1,3,73,253,117,
+96,1,97,149,194,26,132,117,75,252,4,194,213,164,253,191,41,127,98,86,157,
+68,254,104,28,31,115,141,254,72,1,108,254,98,134,199,22,229,188,28,100,86,
+93,99,146,146,251,152,2,105,103,99,73,75,2,53,52,111,53,108,151,254,129,1,
+50,255,255,255,233,253,220,3,100,4,250,2,38,0,52,0,0,0,7,0,182,3,163,0,0,
+0,1,0,0,255,231,5,179,4,250,0,51,0,0,1,54,51,50,23,17,33,53,33,21,35,17,35,
+17,5,39,1,53,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,30,4,23,7,46,4,53,
+52,54,54,51,50,22,2,214,120,178,29,29,251,198,5,179,213,164,254,240,115,1,
+131,32,39,98,140,44,157,25,39,60,98,50,79,91,11,26,47,79,126,85,110,114,125,
+100,61,29,86,152,87,84,151,2,246,114,5,1,5,146,146,251,152,1,74,223,123,1,
+20,213,10,152,150,49,96,69,45,36,90,76,28,54,57,69,84,111,71,107,97,116,116,
+106,101,53,93,139,76,56,255,255,0,0,253,220,6,51,4,250,2,38,0,55,0,0,0,7,
+0,182,5,216,0,0,0,2,0,0,255,206,4,145,4,250,0,33,0,34,0,0,1,21,35,17,35,17,
+1,39,37,38,38,53,52,54,54,51,50,22,23,7,38,35,34,6,21,20,22,22,51,50,55,17,
+33,53,1,4,145,213,164,253,188,96,1,41,148,170,106,194,127,48,129,27,12,114,
+70,129,141,60,101,61,172,138,252,232,1,221,4,250,146,251,152,1,77,254,129,
+134,169,17,179,137,114,165,85,13,8,149,21,113,101,67,92,43,146,2,85,146,251,
+247,0,3,0,57,0,0,5,180,5,15,0,35,0,48,0,49,0,0,1,35,17,35,17,1,39,1,38,39,
+6,7,39,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,22,23,17,35,53,33,
+1,54,54,53,52,38,35,34,6,6,21,20,22,1,5,180,213,165,253,183,98,2,4,231,157,
+174,198,98,184,133,93,98,76,149,97,88,142,82,81,82,86,233,109,138,2,4,252,
+71,70,75,80,72,41,70,45,84,2,142,4,104,251,152,1,210,254,127,138,1,54,48,
+67,115,115,138,94,79,66,146,93,71,121,73,67,125,80,80,140,64,33,55,13,1,234,
+146,254,42,46,111,63,66,70,32,65,46,61,108,254,156,0,4,0,0,255,230,4,190,
+4,250,0,15,0,18,0,29,0,30,0,0,1,35,17,35,17,1,39,37,46,2,53,17,35,53,33,5,
+1,17,5,17,20,30,3,51,50,54,55,7,4,190,213,164,253,119,96,1,99,103,125,57,
+162,4,190,252,230,1,161,254,1,14,31,46,70,49,55,101,45,216,4,104,251,152,
+1,142,254,88,134,204,14,108,156,144,1,138,146,146,253,225,2,31,90,254,229,
+98,96,55,41,20,32,25,202,0,0,2,0,0,255,231,5,215,4,250,0,40,0,49,0,0,1,35,
+17,35,17,5,39,1,53,33,34,39,6,7,22,22,23,7,46,2,39,38,38,53,52,54,54,51,50,
+22,23,54,54,53,52,38,39,33,53,33,1,22,51,33,17,33,22,21,20,5,215,193,165,
+254,196,98,1,158,254,185,182,105,62,118,84,226,125,110,114,222,170,40,24,
+17,27,59,45,51,77,31,36,38,20,14,254,101,5,215,252,114,40,75,1,181,253,207,
+34,4,104,251,152,1,189,225,138,1,1,5,25,76,51,108,224,101,110,99,225,202,
+66,41,56,32,27,49,32,47,42,32,114,77,61,99,30,146,254,8,4,1,106,79,112,95,
+0,2,0,0,253,220,4,144,4,250,0,58,0,59,0,0,37,54,54,53,52,39,1,39,37,38,35,
+34,6,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,62,2,51,33,53,33,53,33,
+21,35,17,33,34,6,6,21,20,22,23,54,51,50,22,22,21,20,6,7,1,3,39,41,47,5,254,
+141,98,1,141,78,155,149,154,63,158,174,110,183,186,80,69,64,59,50,50,85,110,
+83,1,64,252,234,4,144,213,254,22,64,63,38,52,44,90,106,146,202,103,43,50,
+254,128,2,55,128,56,29,24,254,249,138,241,57,131,128,77,140,175,150,107,155,
+216,193,107,84,148,51,49,101,58,63,87,56,26,175,146,146,254,191,16,46,35,
+40,63,19,26,91,167,106,92,153,87,254,46,255,255,0,0,253,220,4,142,4,250,2,
+38,0,124,0,0,0,3,0,182,3,250,0,0,0,4,0,0,255,126,6,84,4,250,0,35,0,47,0,59,
+0,71,0,0,1,33,34,39,22,21,20,6,35,34,0,3,55,22,22,51,50,54,53,52,38,39,55,
+33,53,33,53,33,21,35,17,35,53,3,39,1,5,50,22,21,20,6,35,34,38,53,52,54,33,
+50,22,21,20,6,35,34,38,53,52,54,23,50,22,21,20,6,35,34,38,53,52,54,4,218,
+254,161,75,19,142,168,136,178,254,235,116,144,98,202,119,72,78,113,104,58,
+2,112,251,38,6,84,213,165,238,128,1,110,254,36,41,61,61,41,41,61,61,254,173,
+41,61,61,41,41,61,61,231,41,61,61,41,41,61,61,3,39,2,112,149,114,132,1,29,
+1,27,52,242,227,62,59,66,127,54,132,175,146,146,251,152,232,254,230,105,1,
+140,183,63,44,44,63,63,44,44,63,63,44,44,63,62,45,44,63,184,62,45,44,63,63,
+44,44,63,0,0,5,0,0,255,206,4,194,4,250,0,18,0,23,0,33,0,34,0,35,0,0,1,1,39,
+37,38,38,39,54,54,53,52,39,35,53,33,21,35,17,35,1,22,23,1,17,3,39,38,39,6,
+7,22,22,51,50,37,1,3,73,253,117,96,1,97,149,194,26,132,117,75,252,4,194,213,
+164,254,104,22,11,1,119,92,189,52,38,32,174,41,127,98,120,253,207,1,173,1,
+108,254,98,134,199,22,229,188,28,100,86,93,99,146,146,251,152,4,104,47,40,
+254,36,2,51,253,117,231,63,53,154,53,103,99,161,254,206,0,2,0,95,255,122,
+6,42,5,15,0,76,0,89,0,0,37,38,38,53,52,54,51,50,22,22,21,20,6,7,22,23,7,38,
+39,6,35,34,38,38,53,52,54,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,
+51,50,54,55,53,33,53,33,21,35,17,35,17,7,39,1,53,6,6,35,34,38,39,14,2,21,
+20,30,2,51,50,3,54,54,53,52,38,38,35,34,6,21,20,22,2,8,13,9,73,60,54,81,39,
+50,48,74,96,119,132,55,33,68,109,172,94,60,99,81,88,95,74,147,101,84,140,
+85,84,94,72,109,111,202,102,254,239,2,138,213,165,219,123,1,86,78,197,108,
+89,189,76,74,83,43,20,48,84,65,13,26,80,74,31,68,52,71,86,81,249,18,40,14,
+57,64,50,75,38,57,67,19,96,89,85,152,91,6,83,145,88,69,115,89,48,57,148,93,
+72,117,68,52,110,79,88,136,66,18,62,67,253,146,146,251,152,1,5,246,111,1,
+92,215,43,45,36,31,45,72,78,48,30,64,51,34,2,60,51,106,62,33,56,34,72,60,
+62,110,0,1,0,0,255,176,5,218,4,250,0,45,0,0,19,55,33,53,33,53,33,21,35,17,
+35,17,7,39,1,53,33,34,39,22,22,21,20,6,7,22,22,23,7,38,38,39,38,38,53,52,
+54,51,50,22,23,54,54,53,52,38,179,49,3,124,251,160,5,218,213,165,224,118,
+1,86,254,59,130,62,120,115,110,99,47,148,84,67,90,204,94,133,121,58,52,45,
+89,58,80,95,185,2,254,138,224,146,146,251,152,1,106,253,117,1,92,184,9,62,
+156,102,99,139,28,29,63,26,143,35,121,75,3,63,62,48,58,45,50,10,91,67,102,
+151,255,255,0,0,254,203,6,55,4,250,2,38,0,254,0,0,0,7,0,64,4,33,0,85,255,
+255,0,0,255,15,6,169,4,250,2,38,0,255,0,0,0,7,3,17,3,32,1,93,255,255,0,0,
+254,118,4,159,4,250,2,38,1,0,0,0,0,7,0,64,3,229,0,0,255,255,0,0,254,203,4,
+216,4,250,2,38,1,1,0,0,0,7,0,64,4,83,0,85,255,255,0,0,253,220,5,178,4,250,
+2,38,0,29,0,0,0,39,0,182,4,178,0,0,0,7,0,64,3,83,0,212,255,255,0,0,254,203,
+5,49,4,250,2,38,1,3,0,0,0,7,0,64,4,193,0,85,255,255,0,0,253,220,5,185,4,250,
+2,38,0,31,0,0,0,39,0,182,4,231,0,0,0,7,0,64,3,44,0,153,255,255,0,0,254,180,
+6,84,4,250,2,38,1,5,0,0,0,7,0,64,4,125,0,62,255,255,0,0,254,99,6,134,4,250,
+2,38,1,6,0,0,0,7,0,64,3,209,255,237,255,255,0,0,254,171,6,73,4,250,2,38,1,
+7,0,0,0,7,0,64,4,99,0,53,255,255,0,0,253,220,4,38,4,250,2,38,0,35,0,0,0,39,
+0,182,4,74,0,0,0,7,0,64,3,8,0,191,255,255,0,0,253,220,4,204,4,250,2,38,0,
+36,0,0,0,39,0,182,4,149,0,0,0,7,0,64,3,21,0,169,255,255,0,0,253,220,5,35,
+4,250,2,38,0,37,0,0,0,39,0,182,4,178,0,0,0,7,0,64,3,83,0,212,255,255,0,0,
+253,220,4,158,4,250,2,38,0,38,0,0,0,39,0,182,4,130,0,0,0,7,0,64,3,16,0,189,
+255,255,0,0,254,148,5,230,4,250,2,38,1,12,0,0,0,7,0,64,4,82,0,30,255,255,
+0,0,254,252,4,136,4,250,2,38,1,13,0,0,0,7,0,64,4,27,0,134,255,255,0,95,254,
+203,5,64,5,14,2,38,1,14,0,0,0,7,0,64,4,213,0,85,255,255,0,0,254,150,4,70,
+4,250,2,38,1,15,0,0,0,7,0,64,4,85,0,32,255,255,0,87,254,173,5,10,5,15,2,38,
+1,16,0,0,0,7,0,64,4,153,0,55,255,255,0,0,254,118,4,142,4,250,2,38,1,17,0,
+0,0,7,0,64,3,230,0,0,255,255,0,0,254,203,4,170,4,250,2,38,1,18,0,0,0,7,0,
+64,4,33,0,85,255,255,0,0,254,203,6,73,4,250,2,38,1,19,0,0,0,7,0,64,4,33,0,
+85,255,255,0,0,254,203,4,175,4,250,2,38,1,20,0,0,0,7,0,64,4,78,0,85,255,255,
+0,95,254,118,5,189,5,14,2,38,1,21,0,0,0,7,0,64,5,44,0,0,255,255,0,0,254,118,
+4,230,4,250,2,38,1,22,0,0,0,7,0,64,4,110,0,0,255,255,0,0,254,203,4,194,4,
+250,2,38,1,23,0,0,0,7,0,64,4,92,0,85,255,255,255,233,253,220,3,100,4,250,
+2,38,0,52,0,0,0,39,0,182,3,163,0,0,0,7,3,17,3,32,1,93,255,255,0,0,254,149,
+5,179,4,250,2,38,1,25,0,0,0,7,0,64,5,1,0,31,255,255,0,0,253,220,6,51,4,250,
+2,38,0,55,0,0,0,39,0,182,5,216,0,0,0,7,0,64,4,33,0,184,255,255,0,0,254,203,
+4,145,4,250,2,38,1,27,0,0,0,7,0,64,4,63,0,85,255,255,0,57,254,221,5,180,5,
+15,2,38,1,28,0,0,0,7,0,64,4,26,0,103,255,255,0,0,254,203,4,190,4,250,2,38,
+1,29,0,0,0,7,0,64,4,43,0,85,255,255,0,0,255,211,5,215,4,250,2,38,1,30,0,0,
+0,7,3,17,3,32,1,93,255,255,0,0,253,220,4,144,4,250,2,38,1,31,0,0,0,7,3,17,
+3,9,255,155,0,2,0,0,255,231,4,238,4,250,0,45,0,46,0,0,1,21,33,17,54,54,51,
+51,21,35,34,6,7,17,35,17,1,39,37,38,38,53,52,54,54,51,50,22,23,7,38,38,35,
+34,6,21,20,22,22,51,50,54,55,17,33,53,1,4,210,254,202,54,114,69,101,75,93,
+110,60,165,253,199,96,1,5,122,138,102,184,119,40,114,40,12,35,100,38,117,
+131,58,94,54,74,143,75,253,9,1,207,4,250,146,254,68,37,33,146,41,51,253,252,
+1,98,254,133,134,150,30,175,130,107,162,87,12,9,149,8,13,108,94,71,97,46,
+70,77,2,84,146,251,247,0,2,0,0,255,15,5,111,4,250,0,37,0,65,0,0,37,1,39,37,
+46,2,39,38,38,53,52,54,51,50,22,23,54,54,53,52,38,39,33,53,33,21,33,22,21,
+20,6,7,30,2,23,37,55,6,6,35,34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,
+6,21,20,22,51,50,54,55,5,111,252,205,85,1,28,107,211,204,96,34,38,67,64,51,
+77,31,36,38,20,14,254,101,5,77,252,243,34,130,136,112,192,215,131,1,77,51,
+64,160,86,95,154,89,89,162,106,41,108,25,12,31,75,37,101,110,107,92,61,118,
+54,201,254,70,146,139,27,123,199,125,45,80,49,49,63,47,42,32,114,77,61,99,
+30,146,146,79,112,153,206,60,130,149,77,1,169,111,52,54,78,146,95,97,143,
+75,13,8,141,7,14,95,86,82,89,49,49,0,0,2,0,0,255,206,3,122,4,250,0,17,0,21,
+0,0,1,17,20,6,35,34,38,38,53,52,54,51,51,17,33,53,33,21,19,1,39,1,1,171,53,
+47,51,118,74,61,63,55,254,249,2,206,172,253,231,98,2,39,4,104,253,119,54,
+60,87,125,53,53,52,1,137,146,146,252,200,254,158,138,1,77,0,2,0,0,255,206,
+3,178,4,250,0,40,0,41,0,0,1,6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,
+22,51,50,54,55,23,1,39,37,38,38,53,52,54,55,38,38,53,52,55,35,53,33,21,3,
+1,39,43,84,73,56,74,50,42,13,26,32,104,114,108,97,90,153,72,84,253,63,96,
+1,47,130,141,44,40,83,91,20,107,2,237,219,4,104,49,68,70,87,11,16,6,143,3,
+85,78,79,86,70,76,128,254,59,134,171,20,153,117,60,108,37,40,143,84,64,47,
+146,146,252,137,0,255,255,0,0,252,218,5,178,4,250,2,38,0,29,0,0,0,7,2,157,
+4,178,0,0,255,255,0,0,253,220,5,178,4,250,2,38,2,127,0,0,0,7,2,156,4,178,
+0,0,0,3,0,0,255,206,4,10,4,250,0,3,0,31,0,32,0,0,17,53,33,21,1,39,37,38,38,
+53,52,54,55,5,53,33,50,23,7,35,34,6,21,20,22,22,51,50,54,54,55,23,5,3,72,
+254,13,96,1,49,123,139,47,43,254,211,2,89,81,38,14,66,123,141,57,88,52,61,
+104,86,51,82,254,128,4,104,146,146,251,102,134,173,26,163,117,58,101,37,3,
+148,3,143,104,92,58,82,37,36,60,51,134,157,255,255,0,0,253,220,5,185,4,250,
+2,38,0,189,0,0,0,7,0,182,4,181,0,0,0,3,0,0,255,206,5,46,4,250,0,3,0,30,0,
+34,0,0,17,53,33,21,1,34,39,22,22,21,20,14,2,35,34,0,3,55,22,22,51,50,54,53,
+52,38,39,55,33,21,19,1,39,1,4,248,254,131,75,19,69,73,49,83,111,61,178,254,
+235,116,144,98,202,119,72,78,113,104,58,2,112,84,253,231,98,2,39,4,104,146,
+146,254,142,2,55,132,75,62,92,61,30,1,29,1,27,52,242,227,62,59,66,127,54,
+132,146,254,58,254,158,138,1,77,0,2,0,0,255,31,5,100,4,250,0,73,0,77,0,0,
+1,17,33,34,14,3,21,20,22,23,54,51,50,22,23,22,22,51,50,54,54,55,21,6,6,35,
+35,22,21,20,14,2,7,22,23,7,38,39,38,38,53,52,54,51,50,22,23,50,54,54,53,52,
+38,35,34,6,7,38,38,53,52,62,2,51,51,53,33,53,33,21,1,39,1,23,3,19,254,150,
+43,56,32,22,12,64,53,75,78,75,124,46,28,73,58,73,117,101,67,82,191,119,24,
+5,47,77,98,51,133,149,67,225,196,131,120,58,52,42,86,63,74,124,69,98,83,36,
+91,41,126,142,44,84,113,87,192,253,146,5,42,254,193,118,1,151,88,4,104,254,
+191,7,16,23,32,19,42,64,14,24,37,35,13,10,26,50,54,186,46,42,29,30,64,98,
+73,48,13,62,40,143,90,136,5,62,61,48,58,42,53,45,82,54,67,80,19,17,35,155,
+99,60,84,59,29,175,146,146,251,102,115,1,90,106,0,3,0,0,255,206,5,35,4,250,
+0,3,0,39,0,43,0,0,17,53,33,21,3,6,35,35,14,2,35,34,36,39,55,30,2,51,50,54,
+53,52,38,35,34,6,7,39,54,54,51,50,22,22,23,51,50,55,19,1,39,1,4,237,30,103,
+136,4,15,99,163,97,182,254,238,98,140,58,116,137,92,111,127,105,96,51,93,
+47,56,56,135,62,91,149,93,13,17,125,97,84,253,231,98,2,39,4,104,146,146,253,
+236,42,78,118,64,228,223,54,132,151,71,106,89,85,90,27,24,148,25,29,63,121,
+84,70,254,48,254,158,138,1,77,0,255,255,0,0,252,218,4,54,4,250,2,38,0,35,
+0,0,0,7,2,157,3,250,0,0,255,255,0,0,253,220,4,54,4,250,2,38,2,129,0,0,0,7,
+2,156,3,250,0,0,255,255,0,0,252,218,4,204,4,250,2,38,0,36,0,0,0,7,2,157,4,
+79,0,0,255,255,0,0,253,220,4,204,4,250,2,38,2,130,0,0,0,7,2,156,4,79,0,0,
+255,255,0,0,252,218,5,35,4,250,2,38,0,37,0,0,0,7,2,157,4,178,0,0,255,255,
+0,0,253,220,5,35,4,250,2,38,2,131,0,0,0,7,2,156,4,178,0,0,255,255,0,0,252,
+218,4,158,4,250,2,38,0,38,0,0,0,7,2,157,4,60,0,0,255,255,0,0,253,220,4,158,
+4,250,2,38,2,132,0,0,0,7,2,156,4,60,0,0,0,3,0,0,255,206,4,192,4,250,0,16,
+0,30,0,34,0,0,1,35,17,20,14,3,35,34,38,38,53,17,35,53,33,5,33,17,20,30,3,
+51,50,62,2,53,1,1,39,1,4,20,183,28,59,85,108,67,118,156,78,162,4,20,254,165,
+254,141,15,29,43,58,38,64,73,39,12,2,7,253,231,98,2,39,4,104,254,42,79,111,
+86,55,27,88,178,154,1,152,146,146,254,106,73,89,61,37,17,39,71,90,77,254,
+94,254,158,138,1,77,0,2,0,0,0,133,3,44,4,250,0,3,0,23,0,0,17,53,33,21,1,39,
+1,46,2,35,34,6,7,39,54,54,51,50,30,2,23,21,3,44,253,217,98,1,248,67,85,88,
+56,62,119,78,57,87,150,75,62,98,99,110,73,4,104,146,146,252,29,138,1,49,85,
+79,39,37,39,150,42,38,27,63,114,97,137,0,0,4,0,95,255,206,4,19,5,14,0,39,
+0,40,0,41,0,42,0,0,1,36,53,52,54,54,51,50,22,22,21,20,6,7,22,22,51,50,54,
+55,23,1,39,37,38,38,39,54,54,53,52,38,38,35,34,6,21,20,22,23,19,37,1,1,126,
+254,225,69,116,73,95,157,83,155,160,51,121,98,89,156,79,76,253,36,96,1,94,
+153,204,39,179,175,45,78,49,53,65,79,87,231,254,51,2,104,3,33,41,221,75,106,
+50,84,151,99,143,194,63,80,65,69,79,143,254,42,134,197,16,193,170,36,140,
+120,66,94,47,51,44,52,62,9,253,93,244,2,248,0,255,255,0,0,253,220,4,240,4,
+250,2,38,1,15,0,0,0,7,0,81,3,186,0,0,0,3,0,87,255,168,3,220,5,15,0,54,0,55,
+0,56,0,0,1,1,39,37,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,22,21,20,
+6,7,39,54,53,52,38,35,34,6,6,21,20,30,2,23,54,51,50,23,7,38,35,34,6,21,20,
+22,51,50,54,55,3,3,3,220,253,50,96,1,63,125,141,36,40,107,109,75,136,85,71,
+116,67,41,40,125,41,50,46,38,63,37,37,62,79,41,58,74,50,42,13,26,32,104,114,
+108,97,90,153,72,171,161,1,103,254,65,134,180,21,154,114,54,103,40,41,151,
+106,80,131,74,51,96,61,48,94,37,79,40,50,39,47,42,74,45,51,68,44,22,4,16,
+6,143,3,85,78,79,86,70,76,3,5,251,217,0,0,3,0,0,255,206,3,104,4,250,0,3,0,
+16,0,20,0,0,17,53,33,21,1,21,20,6,35,34,38,38,53,52,51,33,21,19,1,39,1,3,
+50,254,113,55,50,48,114,76,124,2,76,84,253,231,98,2,39,4,104,146,146,253,
+250,110,55,59,85,126,54,105,146,254,206,254,158,138,1,77,0,2,0,0,255,230,
+3,125,4,250,0,23,0,24,0,0,23,39,37,46,2,53,17,35,53,33,21,33,17,20,30,3,51,
+50,54,55,23,5,188,96,1,91,98,122,57,162,2,148,254,178,14,31,46,70,49,73,147,
+61,76,254,140,26,134,205,16,106,155,144,1,138,146,146,254,139,98,96,55,41,
+20,70,63,134,144,0,0,3,0,0,255,232,5,0,4,250,0,27,0,40,0,41,0,0,33,17,1,39,
+37,46,3,53,17,35,53,33,21,33,17,54,54,51,51,21,35,34,6,6,7,17,1,17,20,30,
+4,51,50,54,55,17,1,3,9,253,177,96,1,72,55,92,74,35,162,4,228,254,202,49,110,
+78,101,75,74,80,70,39,253,152,6,18,35,39,52,30,74,131,66,254,243,1,141,254,
+91,132,208,11,56,100,134,109,1,146,146,146,254,74,33,31,146,14,34,33,253,
+241,4,104,254,121,60,82,62,48,27,13,61,67,2,43,252,196,0,4,0,0,255,206,3,
+132,4,250,0,3,0,25,0,34,0,35,0,0,17,53,33,21,1,39,37,38,38,53,52,54,54,51,
+50,22,23,7,38,35,34,7,1,54,55,23,37,1,6,21,20,22,22,51,50,7,3,84,253,128,
+96,1,44,151,170,111,203,133,51,135,28,12,121,75,41,35,1,19,33,42,78,254,242,
+254,226,84,64,106,65,72,74,4,104,146,146,251,102,134,170,21,179,132,114,165,
+85,13,8,141,21,5,254,168,24,41,134,8,1,102,59,111,70,95,45,136,0,3,0,95,255,
+206,4,151,5,14,0,38,0,42,0,46,0,0,1,21,20,6,35,34,38,38,53,52,54,51,51,53,
+52,38,38,35,34,6,21,20,22,23,7,36,53,52,54,54,51,50,30,2,21,21,33,21,1,53,
+33,21,19,1,39,1,2,167,54,45,48,116,81,63,61,60,38,77,58,56,57,105,108,15,
+254,176,70,118,73,71,119,95,38,1,156,254,245,1,41,54,253,231,98,2,39,1,255,
+74,60,68,83,127,50,43,45,216,122,113,55,53,42,62,59,5,146,28,240,77,104,49,
+40,102,150,108,237,146,2,105,146,146,252,200,254,158,138,1,77,0,0,2,0,0,255,
+206,3,192,4,250,0,21,0,25,0,0,1,17,33,21,33,21,20,6,35,34,38,38,53,52,54,
+51,51,17,33,53,33,21,19,1,39,1,1,168,1,196,254,60,54,45,48,116,81,64,61,55,
+254,252,3,138,54,253,231,98,2,39,4,104,254,41,146,74,60,68,83,127,50,43,45,
+1,215,146,146,252,200,254,158,138,1,77,0,3,0,0,255,206,3,151,4,250,0,28,0,
+29,0,30,0,0,23,39,37,38,38,39,54,54,53,52,39,35,53,33,21,33,22,22,21,20,6,
+7,22,22,51,50,54,55,23,37,1,190,96,1,97,149,194,26,132,117,75,252,2,190,254,
+243,28,31,115,113,41,127,98,86,157,68,78,252,183,1,184,50,134,199,22,229,
+188,28,100,86,93,99,146,146,52,111,53,108,151,36,103,99,73,75,142,155,254,
+206,255,255,0,0,253,220,3,140,4,250,2,38,0,209,0,0,0,7,0,182,3,206,0,0,0,
+3,0,0,255,231,4,129,4,250,0,3,0,44,0,48,0,0,17,53,33,21,19,38,35,34,6,7,39,
+54,55,38,38,35,34,6,21,20,30,4,23,7,46,4,53,52,54,54,51,50,22,23,54,51,50,
+22,23,19,1,39,1,4,30,41,41,43,98,140,44,157,25,39,60,98,50,79,91,11,26,47,
+79,126,85,110,114,125,100,61,29,86,152,87,84,152,71,122,176,30,62,23,15,254,
+169,115,1,131,4,104,146,146,254,99,14,152,150,49,96,69,45,36,90,76,28,54,
+57,69,84,111,71,107,97,116,116,106,101,53,93,139,76,56,58,114,9,8,254,42,
+254,234,123,1,20,0,255,255,0,0,253,220,5,217,4,250,2,38,0,211,0,0,0,7,0,182,
+5,216,0,0,0,3,0,0,255,206,3,112,4,250,0,3,0,29,0,30,0,0,17,53,33,21,1,39,
+37,38,38,53,52,54,54,51,50,22,23,7,38,35,34,6,21,20,22,22,51,50,55,23,5,3,
+64,253,148,96,1,41,148,170,106,194,127,48,129,27,12,114,70,129,141,60,101,
+61,172,138,88,254,109,4,104,146,146,251,102,134,169,17,179,137,114,165,85,
+13,8,149,21,113,101,67,92,43,146,137,153,0,0,4,0,57,0,81,4,88,5,15,0,27,0,
+40,0,44,0,45,0,0,37,39,1,38,39,6,7,39,54,55,38,38,53,52,54,54,51,50,22,22,
+21,20,6,7,22,22,23,21,1,54,54,53,52,38,35,34,6,6,21,20,22,1,53,51,21,3,1,
+241,98,2,4,231,157,174,198,98,184,133,93,98,76,149,97,88,142,82,81,82,86,
+233,109,253,193,70,75,80,72,41,70,45,84,2,4,168,30,81,138,1,54,48,67,115,
+115,138,94,79,66,146,93,71,121,73,67,125,80,80,140,64,33,55,13,172,1,82,46,
+111,63,66,70,32,65,46,61,108,1,24,146,146,253,132,0,3,0,0,255,230,3,145,4,
+250,0,14,0,25,0,26,0,0,1,1,23,1,39,37,46,2,53,17,35,53,33,21,5,17,20,30,3,
+51,50,54,55,7,1,164,1,161,76,253,43,96,1,99,103,125,57,162,3,33,254,37,14,
+31,46,70,49,55,101,45,216,4,104,253,225,138,254,39,134,204,14,108,156,144,
+1,138,146,146,90,254,229,98,96,55,41,20,32,25,202,0,0,2,0,0,255,231,4,195,
+4,250,0,41,0,45,0,0,1,34,39,6,7,22,22,23,7,46,2,39,38,38,53,52,54,54,51,50,
+22,23,54,54,53,52,38,39,33,53,33,21,33,22,21,20,7,22,51,33,21,23,1,39,1,3,
+42,182,105,62,118,84,226,125,110,114,222,170,40,24,17,27,59,45,51,77,31,36,
+38,20,14,254,101,4,143,253,177,34,25,40,75,1,181,82,254,114,98,1,158,2,108,
+25,76,51,108,224,101,110,99,225,202,66,41,56,32,27,49,32,47,42,32,114,77,
+61,99,30,146,146,79,112,95,72,4,146,124,254,236,138,1,1,255,255,0,0,253,220,
+5,88,4,250,2,38,1,31,0,0,0,7,0,81,4,34,0,0,0,6,0,0,255,126,5,52,4,250,0,23,
+0,27,0,31,0,43,0,55,0,67,0,0,1,33,34,39,22,21,20,6,35,34,0,3,55,22,22,51,
+50,54,53,52,38,39,55,33,37,53,33,21,19,1,39,1,5,50,22,21,20,6,35,34,38,53,
+52,54,33,50,22,21,20,6,35,34,38,53,52,54,23,50,22,21,20,6,35,34,38,53,52,
+54,4,218,254,161,75,19,142,168,136,178,254,235,116,144,98,202,119,72,78,113,
+104,58,2,112,251,38,4,248,60,254,184,128,1,110,254,36,41,61,61,41,41,61,61,
+254,173,41,61,61,41,41,61,61,231,41,61,61,41,41,61,61,3,39,2,112,149,114,
+132,1,29,1,27,52,242,227,62,59,66,127,54,132,175,146,146,252,229,254,129,
+105,1,140,183,63,44,44,63,63,44,44,63,63,44,44,63,62,45,44,63,184,62,45,44,
+63,63,44,44,63,0,4,0,0,255,206,3,101,4,250,0,19,0,29,0,30,0,31,0,0,1,1,39,
+37,38,38,39,54,54,53,52,39,35,53,33,21,33,22,23,1,7,39,38,39,6,7,22,22,51,
+50,7,1,3,101,253,89,96,1,97,149,194,26,132,117,75,252,2,190,254,242,23,11,
+1,125,98,189,52,38,32,174,41,127,98,120,132,254,83,1,132,254,74,134,199,22,
+229,188,28,100,86,93,99,146,146,47,40,254,31,83,231,63,53,154,53,103,99,145,
+1,50,0,4,0,95,255,122,5,14,5,15,0,64,0,77,0,81,0,85,0,0,1,6,6,35,34,38,39,
+14,2,21,20,30,2,51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,7,22,23,7,38,
+39,6,35,34,38,38,53,52,54,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,
+51,50,54,55,5,54,54,53,52,38,38,35,34,6,21,20,22,1,53,33,21,3,39,1,23,4,176,
+78,197,108,89,189,76,74,83,43,20,48,84,65,13,27,13,9,73,60,54,81,39,50,48,
+74,96,119,132,55,33,68,109,172,94,60,99,81,88,95,74,147,101,84,140,85,84,
+94,72,109,111,202,102,253,34,80,74,31,68,52,71,86,81,2,22,1,46,249,123,1,
+86,94,2,177,43,45,36,31,45,72,78,48,30,64,51,34,3,18,40,14,57,64,50,75,38,
+57,67,19,96,89,85,152,91,6,83,145,88,69,115,89,48,57,148,93,72,117,68,52,
+110,79,88,136,66,18,62,67,57,51,106,62,33,56,34,72,60,62,110,1,16,146,146,
+251,167,111,1,92,123,0,3,0,0,255,176,4,178,4,250,0,3,0,37,0,41,0,0,17,53,
+33,21,1,34,39,22,22,21,20,6,7,22,22,23,7,38,38,39,38,38,53,52,54,51,50,22,
+23,54,54,53,52,38,39,55,33,21,3,39,1,23,4,126,254,29,130,62,120,115,110,99,
+47,148,84,67,90,204,94,133,121,58,52,45,89,58,80,95,185,184,49,3,124,224,
+118,1,86,82,4,104,146,146,254,142,9,62,156,102,99,139,28,29,63,26,143,35,
+121,75,3,63,62,48,58,45,50,10,91,67,102,151,55,138,146,253,119,117,1,92,126,
+0,255,255,0,0,254,203,4,238,4,250,2,38,1,71,0,0,0,7,0,64,4,33,0,85,255,255,
+0,0,255,15,5,111,4,250,2,38,1,72,0,0,0,7,3,17,3,32,1,93,255,255,0,0,254,118,
+3,122,4,250,2,38,1,73,0,0,0,7,0,64,3,229,0,0,255,255,0,0,254,203,3,178,4,
+250,2,38,1,74,0,0,0,7,0,64,4,83,0,85,255,255,0,0,252,218,5,178,4,250,2,38,
+0,29,0,0,0,39,2,157,4,178,0,0,0,7,0,64,3,83,0,212,255,255,0,0,254,203,4,10,
+4,250,2,38,1,77,0,0,0,7,0,64,4,193,0,85,255,255,0,0,253,220,5,185,4,250,2,
+38,0,189,0,0,0,39,0,182,4,231,0,0,0,7,0,64,3,44,0,153,255,255,0,0,254,180,
+5,46,4,250,2,38,1,79,0,0,0,7,0,64,4,125,0,62,255,255,0,0,254,99,5,100,4,250,
+2,38,1,80,0,0,0,7,0,64,3,209,255,237,255,255,0,0,254,171,5,35,4,250,2,38,
+1,81,0,0,0,7,0,64,4,99,0,53,255,255,0,0,252,218,4,134,4,250,2,38,0,35,0,0,
+0,39,2,157,4,74,0,0,0,7,0,64,3,8,0,191,255,255,0,0,252,218,4,209,4,250,2,
+38,0,36,0,0,0,39,2,157,4,149,0,0,0,7,0,64,3,21,0,169,255,255,0,0,252,218,
+5,35,4,250,2,38,0,37,0,0,0,39,2,157,4,178,0,0,0,7,0,64,3,83,0,212,255,255,
+0,0,252,218,4,190,4,250,2,38,0,38,0,0,0,39,2,157,4,130,0,0,0,7,0,64,3,16,
+0,189,255,255,0,0,254,148,4,192,4,250,2,38,1,90,0,0,0,7,0,64,4,82,0,30,255,
+255,0,0,254,252,3,44,4,250,2,38,1,91,0,0,0,7,0,64,4,27,0,134,255,255,0,95,
+254,203,4,19,5,14,2,38,1,92,0,0,0,7,0,64,4,213,0,85,255,255,0,0,253,220,5,
+54,4,250,2,38,1,15,0,0,0,7,2,122,4,0,0,0,255,255,0,87,254,173,3,220,5,15,
+2,38,1,94,0,0,0,7,0,64,4,153,0,55,255,255,0,0,254,118,3,104,4,250,2,38,1,
+95,0,0,0,7,0,64,3,230,0,0,255,255,0,0,254,203,3,125,4,250,2,38,1,96,0,0,0,
+7,0,64,4,33,0,85,255,255,0,0,254,203,5,0,4,250,2,38,1,97,0,0,0,7,0,64,4,33,
+0,85,255,255,0,0,254,203,3,132,4,250,2,38,1,98,0,0,0,7,0,64,4,78,0,85,255,
+255,0,95,254,118,4,151,5,14,2,38,1,99,0,0,0,7,0,64,5,44,0,0,255,255,0,0,254,
+118,3,192,4,250,2,38,1,100,0,0,0,7,0,64,4,110,0,0,255,255,0,0,254,203,3,151,
+4,250,2,38,1,101,0,0,0,7,0,64,4,92,0,85,255,255,0,0,254,149,4,129,4,250,2,
+38,1,103,0,0,0,7,0,64,5,1,0,31,255,255,0,0,253,220,5,217,4,250,2,38,0,211,
+0,0,0,39,0,182,5,216,0,0,0,7,0,64,4,33,0,184,255,255,0,0,254,203,3,112,4,
+250,2,38,1,105,0,0,0,7,0,64,4,63,0,85,255,255,0,57,254,221,4,88,5,15,2,38,
+1,106,0,0,0,7,0,64,4,26,0,103,255,255,0,0,254,203,3,145,4,250,2,38,1,107,
+0,0,0,7,0,64,4,43,0,85,255,255,0,0,255,211,4,195,4,250,2,38,1,108,0,0,0,7,
+3,17,3,32,1,93,255,255,0,0,253,220,5,88,4,250,2,38,1,31,0,0,0,39,0,81,4,34,
+0,0,0,7,0,64,3,9,255,155,0,1,0,0,253,220,4,94,4,250,0,81,0,0,5,46,2,53,52,
+55,38,53,52,62,2,51,33,53,33,53,33,21,35,17,33,34,6,6,21,20,22,23,54,51,50,
+30,2,21,20,7,39,54,54,53,52,38,35,34,6,21,20,22,22,23,54,51,50,22,22,21,20,
+6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,38,35,34,6,7,1,205,124,148,71,
+115,91,50,85,110,83,1,14,253,28,4,94,213,254,72,64,63,38,47,40,94,101,108,
+153,98,45,235,50,62,64,124,130,145,146,62,124,82,54,55,101,147,77,87,166,
+114,128,216,181,86,126,85,142,158,100,108,108,46,75,43,47,87,51,102,68,129,
+144,89,124,76,81,112,63,87,56,26,175,146,146,254,191,16,46,35,38,61,19,22,
+43,71,94,51,193,73,132,17,56,48,65,60,82,80,61,97,93,42,10,72,129,86,83,129,
+71,82,150,112,87,107,120,58,78,75,43,59,29,19,24,0,0,1,0,0,253,220,4,160,
+4,250,0,86,0,0,1,6,35,34,38,38,53,52,54,55,38,38,53,52,55,38,53,52,62,2,51,
+33,53,33,53,33,21,35,17,33,34,6,6,21,20,22,23,54,51,50,30,2,21,20,7,39,54,
+54,53,52,38,35,34,6,21,20,22,22,23,55,50,30,6,23,7,46,2,35,34,6,21,20,30,
+2,51,50,54,55,2,248,113,113,101,148,78,71,66,115,111,115,91,50,85,110,83,
+1,14,253,28,4,94,213,254,72,64,63,38,47,40,94,101,108,153,98,45,235,50,62,
+64,124,130,145,146,40,112,100,20,28,102,84,77,73,76,73,75,42,125,80,146,167,
+98,101,109,28,46,60,31,46,84,55,254,11,47,72,132,85,72,119,38,77,170,111,
+124,76,81,112,63,87,56,26,175,146,146,254,191,16,46,35,38,61,19,22,43,71,
+94,51,193,73,132,17,56,48,65,60,82,80,48,85,98,53,1,10,23,33,44,61,77,97,
+64,80,120,150,80,78,68,39,53,33,14,18,26,0,0,3,0,0,254,71,4,133,4,250,0,72,
+0,73,0,74,0,0,5,6,35,34,38,38,53,52,54,54,55,38,38,35,34,6,21,20,22,22,23,
+7,46,2,53,52,54,55,38,38,53,52,62,2,51,33,53,33,53,33,21,35,17,33,34,6,6,
+21,20,22,23,54,51,50,22,22,21,20,6,7,6,21,20,30,2,51,50,54,54,55,1,1,4,127,
+109,124,100,148,79,51,112,78,4,126,129,144,147,63,158,174,110,183,186,80,
+67,64,54,53,50,85,110,83,1,14,253,28,4,133,252,254,72,64,63,38,51,43,83,105,
+126,182,96,8,3,233,28,46,60,31,40,56,60,36,254,153,1,59,176,51,68,125,81,
+53,105,86,16,78,82,131,128,77,140,175,150,107,155,216,193,107,86,147,52,44,
+102,60,63,87,56,26,175,146,146,254,191,16,46,35,39,63,19,25,77,139,85,38,
+67,14,15,141,33,46,28,13,9,21,18,5,28,252,79,0,0,3,0,0,254,0,4,205,4,250,
+0,90,0,91,0,92,0,0,1,6,6,35,34,38,38,53,52,55,38,38,53,52,54,54,55,38,38,
+35,34,6,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,62,2,51,33,53,33,53,
+33,21,35,17,33,34,6,6,21,20,22,23,54,51,50,22,22,21,20,6,7,6,6,21,20,22,51,
+50,54,55,23,6,35,34,39,6,6,21,20,22,51,50,54,55,1,1,4,205,48,115,68,106,148,
+73,31,55,56,49,112,80,4,126,129,144,147,59,121,107,108,126,144,73,67,64,54,
+53,50,85,110,83,1,14,253,28,4,133,252,254,72,64,63,38,51,43,83,105,126,182,
+96,8,3,117,116,89,76,61,86,45,52,109,124,37,33,15,11,85,81,54,82,55,254,73,
+1,39,254,50,21,29,70,121,78,59,48,36,105,62,48,98,80,14,78,82,131,128,75,
+133,142,97,110,114,178,183,104,86,147,52,44,102,60,63,87,56,26,175,146,146,
+254,191,16,46,35,39,63,19,25,77,139,85,38,67,14,9,69,60,53,56,22,21,134,51,
+5,16,34,20,54,56,18,22,6,68,252,79,0,0,2,0,0,253,220,4,94,4,250,0,79,0,95,
+0,0,5,46,2,53,52,55,38,53,52,62,2,51,33,53,33,53,33,21,35,17,33,34,6,6,21,
+20,22,23,54,51,50,30,2,21,20,7,39,54,54,53,52,38,35,34,6,21,20,30,2,23,54,
+51,50,22,22,21,20,6,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,37,
+50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,2,1,145,170,80,115,91,50,85,110,
+83,1,14,253,28,4,94,213,254,72,64,63,38,47,40,94,101,108,153,98,45,235,50,
+62,64,124,130,145,146,28,64,110,80,83,70,100,148,79,84,152,97,149,230,109,
+95,85,172,119,96,103,100,86,45,102,37,254,139,30,51,32,33,51,29,30,51,32,
+31,52,130,75,138,151,94,124,76,81,112,63,87,56,26,175,146,146,254,191,16,
+46,35,38,61,19,22,43,71,94,51,193,73,132,17,56,48,65,60,82,80,43,69,71,77,
+40,17,72,131,84,82,130,71,96,102,99,77,74,79,74,62,69,21,16,132,31,56,32,
+33,56,30,31,55,33,32,56,31,0,0,2,0,0,253,220,5,24,4,250,0,83,0,99,0,0,1,6,
+35,34,38,38,53,52,54,55,38,38,53,52,55,38,53,52,62,2,51,33,53,33,53,33,21,
+35,17,33,34,6,6,21,20,22,23,54,51,50,30,2,21,20,7,39,54,54,53,52,38,35,34,
+6,21,20,22,22,23,54,51,50,30,2,23,7,46,2,35,34,6,21,20,30,2,51,50,54,55,1,
+50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,3,112,113,113,101,148,78,41,40,
+150,140,115,91,50,85,110,83,1,14,253,28,4,94,213,254,72,64,63,38,47,40,94,
+101,108,153,98,45,235,50,62,64,124,130,145,146,45,123,110,53,64,96,166,143,
+138,84,125,80,146,167,98,101,109,28,46,60,31,46,84,55,253,90,30,51,32,33,
+51,29,30,51,32,31,52,254,11,47,72,132,85,55,95,37,89,187,124,124,76,81,112,
+63,87,56,26,175,146,146,254,191,16,46,35,38,61,19,22,43,71,94,51,193,73,132,
+17,56,48,65,60,82,80,50,89,102,56,14,49,90,143,127,80,120,150,80,78,68,39,
+53,33,14,18,26,1,68,31,56,32,33,56,30,31,55,33,32,56,31,255,255,0,0,254,17,
+4,133,4,250,2,38,1,149,0,0,0,7,3,17,3,9,255,155,255,255,0,0,254,0,4,205,4,
+250,2,38,1,150,0,0,0,7,3,17,3,9,255,155,0,1,0,0,253,220,4,144,4,250,0,85,
+0,0,5,46,3,53,52,54,55,38,53,52,62,2,51,33,53,33,53,33,21,35,17,33,34,6,6,
+21,20,23,54,51,50,22,21,20,6,7,39,54,54,53,52,39,5,39,37,38,35,34,6,21,20,
+22,22,23,54,51,50,22,22,21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,
+38,35,34,6,7,1,255,114,159,84,36,59,52,87,50,85,110,83,1,64,252,234,4,144,
+213,254,22,64,63,38,73,98,121,221,230,47,47,133,46,38,10,254,162,93,1,92,
+77,133,151,152,50,124,104,69,70,101,147,77,87,166,114,128,216,181,86,126,
+85,142,158,100,108,108,46,75,43,47,87,51,129,58,120,107,102,60,69,106,39,
+80,109,63,87,56,26,175,146,146,254,191,16,46,35,65,45,29,181,163,62,135,59,
+81,55,88,52,28,30,242,141,192,33,94,90,51,94,101,51,16,72,129,86,83,129,71,
+82,150,112,87,107,120,58,78,75,43,59,29,19,24,0,0,1,0,0,253,220,4,190,4,250,
+0,86,0,0,1,6,35,34,38,38,53,52,54,55,46,2,53,52,54,55,38,53,52,62,2,51,33,
+53,33,53,33,21,35,17,33,34,6,6,21,20,23,54,51,50,22,21,20,6,7,39,54,54,53,
+52,39,5,39,37,38,35,34,6,21,20,22,23,54,51,50,30,2,23,7,46,2,35,34,6,21,20,
+30,2,51,50,54,55,3,22,113,113,101,148,78,63,59,93,108,40,59,52,87,50,85,110,
+83,1,64,252,234,4,144,213,254,22,64,63,38,73,98,121,221,230,47,47,133,46,
+38,10,254,162,93,1,92,77,133,151,152,129,124,26,26,96,166,143,138,84,125,
+80,146,167,98,101,109,28,46,60,31,46,84,55,254,11,47,72,132,85,68,114,38,
+62,124,111,60,69,106,39,80,109,63,87,56,26,175,146,146,254,191,16,46,35,65,
+45,29,181,163,62,135,59,81,55,88,52,28,30,242,141,192,33,94,90,83,137,64,
+3,49,90,143,127,80,120,150,80,78,68,39,53,33,14,18,26,0,2,0,0,255,231,4,158,
+4,250,0,54,0,55,0,0,1,33,22,21,20,7,54,51,50,22,22,21,20,6,7,39,54,54,53,
+52,38,35,34,6,7,6,6,7,22,22,23,7,46,5,53,52,54,54,51,50,22,23,54,54,53,52,
+38,39,33,53,33,33,4,158,253,241,34,7,49,52,76,129,75,67,62,148,51,61,73,63,
+34,66,43,41,134,102,83,243,140,110,85,174,179,117,47,15,27,59,45,52,77,31,
+79,73,18,16,254,22,4,158,253,76,4,104,79,112,38,26,21,69,127,83,92,177,74,
+85,53,133,59,70,79,16,23,57,93,42,99,227,109,110,70,160,186,144,80,52,29,
+27,49,32,47,42,41,121,82,40,95,34,146,0,0,2,0,0,255,231,6,105,4,250,0,69,
+0,70,0,0,1,6,35,34,38,38,53,53,38,39,6,6,7,22,22,23,7,46,5,53,52,54,54,51,
+50,22,23,54,54,53,52,38,39,33,53,33,21,33,22,21,20,7,22,23,54,54,51,50,30,
+2,23,7,38,38,35,34,6,6,21,20,22,51,50,54,55,1,4,175,86,94,80,130,76,68,83,
+46,123,71,83,243,140,110,85,174,179,117,47,15,27,59,45,52,77,31,79,73,18,
+16,254,22,6,105,252,38,34,23,59,50,40,140,90,93,153,127,103,44,130,96,181,
+109,57,77,36,77,69,29,59,36,253,109,1,103,34,72,133,84,9,38,7,48,71,29,99,
+227,109,110,70,160,186,144,80,52,29,27,49,32,47,42,41,121,82,40,95,34,146,
+146,79,112,76,62,13,23,64,67,66,114,152,87,69,183,166,40,65,39,69,71,9,15,
+3,11,0,3,0,0,253,220,4,136,4,250,0,80,0,81,0,82,0,0,5,54,55,38,39,6,6,35,
+34,46,3,53,52,62,4,51,51,53,33,53,33,21,33,17,35,34,6,6,21,20,22,22,51,50,
+55,38,38,53,52,54,51,50,22,22,21,20,6,7,22,23,22,22,21,20,6,6,35,34,38,38,
+39,55,30,2,51,50,54,53,52,38,38,35,34,6,7,3,19,2,95,77,90,52,22,18,64,17,
+95,167,123,79,42,25,59,88,109,138,80,10,253,164,4,70,254,187,99,158,166,87,
+73,151,111,15,30,7,5,77,60,57,83,40,49,56,32,68,105,116,87,166,114,128,216,
+181,86,126,85,142,158,100,108,108,46,75,43,47,87,51,56,241,25,35,10,84,48,
+3,6,42,74,98,123,77,57,95,91,67,43,23,195,146,146,254,173,54,112,86,74,113,
+64,3,18,40,14,63,68,48,73,40,56,76,22,63,103,24,146,106,83,129,71,82,150,
+112,87,107,120,58,78,75,43,59,29,19,24,5,155,251,28,0,0,2,0,0,253,220,5,110,
+4,250,0,83,0,84,0,0,1,6,35,34,38,38,53,52,54,54,51,51,38,39,6,6,35,34,46,
+3,53,52,62,4,51,51,53,33,53,33,21,33,17,35,34,6,6,21,20,22,22,51,50,55,38,
+38,53,52,54,51,50,22,22,21,20,6,7,22,23,30,2,23,7,46,2,35,34,6,21,20,30,2,
+51,50,54,55,1,3,198,113,113,101,148,78,85,160,105,9,47,25,18,64,17,95,167,
+123,79,42,25,59,88,109,138,80,10,253,164,4,70,254,187,99,158,166,87,73,151,
+111,15,30,7,5,77,60,57,83,40,49,56,51,61,88,152,128,71,125,80,146,167,98,
+101,109,28,46,60,31,46,84,55,254,202,254,11,47,72,132,85,77,129,75,76,54,
+3,6,42,74,98,123,77,57,95,91,67,43,23,195,146,146,254,173,54,112,86,74,113,
+64,3,18,40,14,63,68,48,73,40,56,76,22,95,88,27,105,141,108,80,120,150,80,
+78,68,39,53,33,14,18,26,6,96,0,4,0,0,253,220,4,146,4,250,0,76,0,77,0,78,0,
+79,0,0,5,14,3,21,20,30,2,51,50,54,55,23,6,6,35,34,38,38,53,52,54,55,38,39,
+6,6,35,34,46,3,53,52,62,4,51,51,53,33,53,33,21,33,17,35,34,6,6,21,20,22,22,
+51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,7,22,23,1,1,23,3,147,41,70,55,
+28,28,46,59,32,57,94,81,52,72,133,68,101,148,78,106,101,40,37,18,64,17,95,
+167,123,79,42,25,59,88,109,138,80,10,253,164,4,70,254,187,99,158,166,87,73,
+151,111,15,30,7,5,77,60,57,83,40,49,56,66,92,254,119,1,117,15,93,11,29,44,
+56,37,35,50,33,15,25,42,142,36,34,72,132,85,90,139,37,68,77,3,6,42,74,98,
+123,77,57,95,91,67,43,23,195,146,146,254,173,54,112,86,74,113,64,3,18,40,
+14,63,68,48,73,40,56,76,22,123,124,5,64,251,42,135,255,255,0,0,255,211,4,
+158,4,250,2,38,1,157,0,0,0,7,3,17,3,32,1,93,255,255,0,0,255,211,6,105,4,250,
+2,38,1,158,0,0,0,7,3,17,3,32,1,93,0,4,0,0,253,220,4,136,4,250,0,77,0,93,0,
+94,0,95,0,0,5,54,55,38,39,6,35,34,46,3,53,52,62,4,51,51,53,33,53,33,21,33,
+17,35,34,6,6,21,20,22,22,51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,7,22,
+23,22,22,21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,34,7,1,50,
+22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,1,2,156,41,60,34,34,57,56,92,161,
+120,78,42,25,59,88,109,138,80,10,253,164,4,70,254,187,99,158,166,87,72,149,
+108,21,30,7,5,77,60,57,83,40,49,56,47,48,107,119,75,145,99,115,188,153,76,
+126,72,116,128,81,83,94,78,68,74,69,254,31,30,51,32,33,51,29,30,51,32,31,
+52,1,139,1,3,14,18,10,62,73,9,42,74,98,125,78,57,95,91,67,43,23,195,146,146,
+254,173,54,112,86,74,113,64,3,18,40,14,63,68,48,73,40,56,76,22,89,70,18,151,
+114,83,129,71,83,148,113,88,110,119,57,80,73,62,69,29,1,14,31,56,32,33,56,
+30,31,55,33,32,56,31,4,127,251,28,0,255,255,0,0,253,220,5,110,4,250,2,38,
+1,160,0,0,0,7,0,64,3,75,1,0,255,255,0,0,253,220,4,146,4,250,2,38,1,161,0,
+0,0,7,0,64,3,162,0,156,0,3,254,133,4,235,255,103,7,44,0,11,0,15,0,16,0,0,
+1,50,22,21,20,6,35,34,38,53,52,54,19,35,17,51,3,254,246,52,61,63,50,51,62,
+62,134,165,165,165,7,44,57,45,45,56,57,44,45,57,253,191,1,58,254,213,0,3,
+253,255,4,235,1,16,7,44,0,3,0,24,0,25,0,0,1,35,17,51,19,38,38,53,52,54,54,
+51,50,22,23,7,38,38,35,34,6,21,20,22,23,37,254,164,165,165,187,49,52,82,143,
+91,68,108,42,45,35,77,45,80,89,49,57,254,157,4,235,1,133,254,123,80,155,66,
+88,126,62,29,22,135,19,25,88,77,59,127,84,15,0,4,253,255,4,235,1,16,7,44,
+0,3,0,24,0,36,0,37,0,0,1,35,17,51,19,38,38,53,52,54,54,51,50,22,23,7,38,38,
+35,34,6,21,20,22,23,19,50,22,21,20,6,35,34,38,53,52,54,1,254,164,165,165,
+187,49,52,82,143,91,68,108,42,45,35,77,45,80,89,49,57,100,41,61,61,41,41,
+61,61,254,98,4,235,1,133,254,123,80,155,66,88,126,62,29,22,135,19,25,88,77,
+59,127,84,1,70,59,43,43,59,59,43,43,59,254,201,0,255,255,0,0,0,0,2,48,7,44,
+2,38,0,66,0,0,0,7,1,167,2,18,0,0,255,255,0,0,0,0,3,34,7,44,2,38,0,66,0,0,
+0,7,1,168,2,18,0,0,255,255,0,0,0,0,3,34,7,44,2,38,0,66,0,0,0,7,1,169,2,18,
+0,0,255,255,254,64,0,0,2,48,7,44,2,38,0,68,0,0,0,7,0,6,2,178,0,90,0,1,254,
+64,0,0,2,111,7,44,0,47,0,0,1,38,38,53,52,54,54,51,50,23,54,54,51,50,22,23,
+7,38,38,35,34,6,21,21,23,30,2,23,51,21,35,17,35,17,35,53,51,46,2,35,34,6,
+21,20,22,23,254,136,36,36,75,145,99,161,108,38,134,93,68,108,42,45,35,77,
+45,80,89,21,9,18,17,7,236,213,165,182,169,33,77,105,70,81,87,31,37,4,235,
+71,132,69,88,138,79,139,70,69,29,22,135,19,25,90,77,16,55,24,56,65,37,146,
+251,152,4,104,146,141,181,94,100,89,56,112,74,0,0,2,254,64,0,0,2,111,7,44,
+0,47,0,59,0,0,1,38,38,53,52,54,54,51,50,23,54,54,51,50,22,23,7,38,38,35,34,
+6,21,21,23,30,2,23,51,21,35,17,35,17,35,53,51,46,2,35,34,6,21,20,22,23,1,
+50,22,21,20,6,35,34,38,53,52,54,254,136,36,36,75,145,99,161,108,38,134,93,
+68,108,42,45,35,77,45,80,89,21,9,18,17,7,236,213,165,182,169,33,77,105,70,
+81,87,31,37,2,162,41,61,61,41,41,61,61,4,235,71,132,69,88,138,79,139,70,69,
+29,22,135,19,25,90,77,16,55,24,56,65,37,146,251,152,4,104,146,141,181,94,
+100,89,56,112,74,1,70,59,43,43,59,59,43,43,59,0,4,251,220,4,250,255,251,7,
+44,0,14,0,30,0,31,0,32,0,0,1,6,6,35,34,38,39,55,22,22,51,50,54,54,55,5,50,
+22,22,21,20,6,6,35,34,38,38,53,52,54,54,3,1,254,253,40,190,158,141,206,66,
+145,48,124,94,66,89,57,23,1,40,30,51,32,33,51,29,30,51,32,31,52,200,254,222,
+6,232,188,187,188,187,49,148,135,63,119,104,160,31,56,32,33,56,30,31,55,33,
+32,56,31,254,126,2,50,0,2,251,200,4,235,0,94,7,44,0,33,0,34,0,0,1,38,39,6,
+35,34,38,39,55,30,2,51,50,54,54,55,23,54,54,51,50,22,23,7,38,38,35,34,6,21,
+20,22,23,39,254,173,77,18,93,148,143,193,69,145,33,70,92,61,65,86,53,21,119,
+42,107,62,68,108,42,45,35,77,45,80,89,49,57,177,4,235,130,105,101,181,194,
+49,103,120,60,66,120,100,43,30,29,29,22,135,19,25,88,77,59,127,84,15,0,3,
+251,200,4,235,0,94,7,44,0,33,0,45,0,46,0,0,1,38,39,6,35,34,38,39,55,30,2,
+51,50,54,54,55,23,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,19,50,22,
+21,20,6,35,34,38,53,52,54,3,254,173,77,18,93,148,143,193,69,145,33,70,92,
+61,65,86,53,21,119,42,107,62,68,108,42,45,35,77,45,80,89,49,57,100,41,61,
+61,41,41,61,61,236,4,235,130,105,101,181,194,49,103,120,60,66,120,100,43,
+30,29,29,22,135,19,25,88,77,59,127,84,1,70,59,43,43,59,59,43,43,59,254,201,
+0,0,3,252,51,4,235,255,223,7,44,0,25,0,41,0,42,0,0,1,46,2,35,34,7,6,35,34,
+38,38,39,55,30,2,51,50,55,54,51,50,22,22,23,19,50,22,22,21,20,6,6,35,34,38,
+38,53,52,54,54,3,254,164,24,49,67,53,27,27,26,27,80,113,94,38,135,31,50,67,
+52,27,33,34,37,79,110,87,38,47,30,51,32,33,51,29,30,51,32,31,52,172,4,235,
+105,105,45,2,3,49,122,107,49,84,67,30,4,3,72,172,159,2,19,31,56,32,33,56,
+30,31,55,33,32,56,31,253,252,0,2,252,51,4,235,0,101,7,44,0,40,0,41,0,0,1,
+46,2,35,34,7,6,35,34,38,38,39,55,30,2,51,50,55,54,51,50,23,54,54,51,50,22,
+23,7,38,38,35,34,6,21,20,23,22,23,39,254,164,24,49,67,53,27,27,26,27,80,113,
+94,38,135,31,50,67,52,27,33,34,37,53,41,27,158,114,67,107,41,45,35,77,45,
+80,89,2,40,35,155,4,235,105,105,45,2,3,49,122,107,49,84,67,30,4,3,16,92,98,
+29,22,135,19,25,88,77,20,18,83,149,15,0,3,252,51,4,235,0,101,7,44,0,40,0,
+52,0,53,0,0,1,46,2,35,34,7,6,35,34,38,38,39,55,30,2,51,50,55,54,51,50,23,
+54,54,51,50,22,23,7,38,38,35,34,6,21,20,23,22,23,19,50,22,21,20,6,35,34,38,
+53,52,54,3,254,164,24,49,67,53,27,27,26,27,80,113,94,38,135,31,50,67,52,27,
+33,34,37,53,41,27,158,114,67,107,41,45,35,77,45,80,89,2,40,35,129,41,61,61,
+41,41,61,61,243,4,235,105,105,45,2,3,49,122,107,49,84,67,30,4,3,16,92,98,
+29,22,135,19,25,88,77,20,18,83,149,1,70,59,43,43,59,59,43,43,59,254,201,0,
+0,3,252,186,4,235,255,251,7,44,0,16,0,32,0,33,0,0,1,46,2,35,34,6,7,39,54,
+54,51,50,30,2,23,19,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,3,254,165,
+44,83,100,72,35,64,43,50,45,89,52,87,129,105,94,45,74,30,51,32,33,51,29,30,
+51,32,31,52,200,4,235,168,179,79,11,17,149,16,14,59,129,222,167,2,29,31,56,
+32,33,56,30,31,55,33,32,56,31,253,242,0,0,2,252,186,4,235,0,104,7,44,0,33,
+0,34,0,0,1,46,3,35,34,6,7,39,54,54,51,50,22,23,51,54,51,50,22,23,7,38,38,
+35,34,6,21,21,20,23,22,23,39,254,165,35,64,69,78,53,35,64,43,50,45,89,52,
+106,125,47,5,54,201,68,108,42,45,35,77,45,80,89,1,36,38,156,4,235,131,164,
+91,40,11,17,149,16,14,77,78,155,29,22,135,19,25,88,77,24,7,5,94,140,15,0,
+0,3,252,186,4,235,0,104,7,44,0,33,0,45,0,46,0,0,1,46,3,35,34,6,7,39,54,54,
+51,50,22,23,51,54,51,50,22,23,7,38,38,35,34,6,21,21,20,23,22,23,19,50,22,
+21,20,6,35,34,38,53,52,54,3,254,165,35,64,69,78,53,35,64,43,50,45,89,52,106,
+125,47,5,54,201,68,108,42,45,35,77,45,80,89,1,36,38,131,41,61,61,41,41,61,
+61,246,4,235,131,164,91,40,11,17,149,16,14,77,78,155,29,22,135,19,25,88,77,
+24,7,5,94,140,1,70,59,43,43,59,59,43,43,59,254,201,0,3,252,147,4,235,255,
+251,7,44,0,34,0,50,0,51,0,0,1,46,3,35,34,7,39,54,54,51,50,30,3,23,55,46,2,
+35,34,6,7,39,54,54,51,50,30,2,23,19,50,22,22,21,20,6,6,35,34,38,38,53,52,
+54,54,3,254,146,45,72,63,61,49,73,94,54,47,102,61,41,72,66,53,34,18,9,43,
+78,88,65,35,64,43,48,49,83,54,87,129,105,93,46,74,30,51,32,33,51,29,30,51,
+32,31,52,200,4,235,64,72,33,12,44,142,19,26,17,36,44,37,31,3,109,115,49,11,
+17,141,16,13,59,128,219,171,2,19,31,56,32,33,56,30,31,55,33,32,56,31,253,
+252,0,0,2,252,147,4,235,0,104,7,44,0,49,0,50,0,0,1,46,3,35,34,7,39,54,54,
+51,50,30,3,23,55,46,2,35,34,6,7,39,54,54,51,50,22,23,51,54,51,50,22,23,7,
+38,38,35,34,6,21,20,23,22,23,39,254,146,45,72,63,61,49,73,94,54,47,102,61,
+41,72,66,53,34,18,9,43,78,88,65,35,64,43,48,49,83,54,104,127,47,5,54,201,
+68,108,42,45,35,77,45,80,89,3,35,37,156,4,235,64,72,33,12,44,142,19,26,17,
+36,44,37,31,3,109,115,49,11,17,141,16,13,78,77,155,29,22,135,19,25,88,77,
+21,21,91,137,15,0,0,3,252,147,4,235,0,104,7,44,0,49,0,61,0,62,0,0,1,46,3,
+35,34,7,39,54,54,51,50,30,3,23,55,46,2,35,34,6,7,39,54,54,51,50,22,23,51,
+54,51,50,22,23,7,38,38,35,34,6,21,20,23,22,23,19,50,22,21,20,6,35,34,38,53,
+52,54,3,254,146,45,72,63,61,49,73,94,54,47,102,61,41,72,66,53,34,18,9,43,
+78,88,65,35,64,43,48,49,83,54,104,127,47,5,54,201,68,108,42,45,35,77,45,80,
+89,3,35,37,131,41,61,61,41,41,61,61,246,4,235,64,72,33,12,44,142,19,26,17,
+36,44,37,31,3,109,115,49,11,17,141,16,13,78,77,155,29,22,135,19,25,88,77,
+21,21,91,137,1,70,59,43,43,59,59,43,43,59,254,201,255,255,253,238,0,0,2,48,
+7,44,2,38,0,66,0,0,0,7,1,176,2,18,0,0,255,255,253,218,0,0,2,112,7,44,2,38,
+0,66,0,0,0,7,1,177,2,18,0,0,255,255,253,218,0,0,2,112,7,44,2,38,0,66,0,0,
+0,7,1,178,2,18,0,0,255,255,254,69,0,0,2,48,7,44,2,38,0,66,0,0,0,7,1,179,2,
+18,0,0,255,255,254,69,0,0,2,119,7,44,2,38,0,66,0,0,0,7,1,180,2,18,0,0,255,
+255,254,69,0,0,2,119,7,44,2,38,0,66,0,0,0,7,1,181,2,18,0,0,255,255,254,204,
+0,0,2,48,7,44,2,38,0,66,0,0,0,7,1,182,2,18,0,0,255,255,254,204,0,0,2,122,
+7,44,2,38,0,66,0,0,0,7,1,183,2,18,0,0,255,255,254,204,0,0,2,122,7,44,2,38,
+0,66,0,0,0,7,1,184,2,18,0,0,255,255,254,165,0,0,2,48,7,44,2,38,0,66,0,0,0,
+7,1,185,2,18,0,0,255,255,254,165,0,0,2,122,7,44,2,38,0,66,0,0,0,7,1,186,2,
+18,0,0,255,255,254,165,0,0,2,122,7,44,2,38,0,66,0,0,0,7,1,187,2,18,0,0,255,
+255,254,45,0,0,2,75,7,44,2,38,0,66,0,0,0,39,2,221,2,18,0,0,0,7,0,6,2,228,
+0,123,0,1,253,168,0,0,2,157,7,44,0,68,0,0,1,21,35,17,35,17,35,53,51,38,38,
+35,34,7,6,35,34,46,2,39,55,30,2,51,50,55,54,51,50,22,22,23,51,38,39,38,39,
+39,38,38,53,53,52,55,55,7,20,22,22,23,23,22,23,54,54,51,50,23,7,38,35,34,
+6,21,20,22,23,2,48,213,165,182,2,22,74,65,23,32,32,37,65,81,74,68,29,135,
+25,50,63,58,27,33,33,35,73,95,71,25,104,58,21,32,88,28,119,89,1,143,1,11,
+45,51,61,22,22,27,161,116,119,99,45,80,77,82,87,43,52,4,250,146,251,152,4,
+104,146,56,74,2,3,21,50,100,71,49,62,66,27,4,3,48,116,104,98,90,56,31,9,38,
+107,106,11,6,6,4,12,44,39,37,17,21,8,9,89,98,51,135,44,90,75,56,119,80,0,
+2,253,168,0,0,2,157,7,44,0,68,0,80,0,0,1,21,35,17,35,17,35,53,51,38,38,35,
+34,7,6,35,34,46,2,39,55,30,2,51,50,55,54,51,50,22,22,23,51,38,39,38,39,39,
+38,38,53,53,52,55,55,7,20,22,22,23,23,22,23,54,54,51,50,23,7,38,35,34,6,21,
+20,22,23,19,50,22,21,20,6,35,34,38,53,52,54,2,48,213,165,182,2,22,74,65,23,
+32,32,37,65,81,74,68,29,135,25,50,63,58,27,33,33,35,73,95,71,25,104,58,21,
+32,88,28,119,89,1,143,1,11,45,51,61,22,22,27,161,116,119,99,45,80,77,82,87,
+43,52,111,41,61,61,41,41,61,61,4,250,146,251,152,4,104,146,56,74,2,3,21,50,
+100,71,49,62,66,27,4,3,48,116,104,98,90,56,31,9,38,107,106,11,6,6,4,12,44,
+39,37,17,21,8,9,89,98,51,135,44,90,75,56,119,80,1,55,59,43,43,59,59,43,43,
+59,0,3,254,21,4,235,0,43,7,44,0,20,0,32,0,33,0,0,1,38,38,53,52,54,54,51,50,
+22,23,7,38,38,35,34,6,21,20,22,23,19,50,22,21,20,6,35,34,38,53,52,54,3,254,
+122,49,52,82,143,91,68,108,42,45,35,77,45,80,89,49,57,100,41,61,61,41,41,
+61,61,185,4,235,80,155,66,88,126,62,29,22,135,19,25,88,77,59,127,84,1,70,
+59,43,43,59,59,43,43,59,254,201,0,255,255,0,60,0,0,6,59,7,44,2,38,0,9,0,0,
+0,7,1,179,6,29,0,0,255,255,0,0,255,31,3,245,7,44,2,38,0,11,0,0,0,7,1,203,
+3,202,0,0,255,255,0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,7,1,176,4,109,0,
+0,255,255,0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,7,1,179,4,128,0,0,255,255,
+0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,7,1,182,4,128,0,0,255,255,0,60,0,0,
+8,77,7,44,2,38,0,10,0,0,0,7,1,176,8,47,0,0,255,255,0,60,0,0,8,77,7,44,2,38,
+0,10,0,0,0,7,1,179,8,47,0,0,255,255,0,60,0,0,8,77,7,44,2,38,0,10,0,0,0,7,
+1,182,8,47,0,0,255,255,0,60,0,0,8,77,7,44,2,38,0,10,0,0,0,7,1,185,8,47,0,
+0,255,255,0,60,0,0,6,59,7,44,2,38,0,9,0,0,0,7,1,176,6,34,0,0,255,255,0,60,
+0,0,6,59,7,44,2,38,0,9,0,0,0,7,1,167,6,29,0,0,255,255,0,60,0,0,8,77,7,44,
+2,38,0,10,0,0,0,7,1,167,8,47,0,0,255,255,0,60,0,0,8,104,7,44,2,38,0,10,0,
+0,0,39,2,221,8,47,0,0,0,7,0,6,9,1,0,123,255,255,0,60,255,56,6,59,7,44,2,38,
+0,9,0,0,0,39,1,179,6,29,0,0,0,7,0,64,4,127,0,194,255,255,0,0,254,99,3,245,
+7,44,2,38,0,11,0,0,0,39,1,203,3,202,0,0,0,7,0,64,3,209,255,237,255,255,0,
+0,254,136,4,139,7,44,2,38,0,19,0,0,0,39,1,176,4,109,0,0,0,7,0,64,3,159,0,
+132,255,255,0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,39,1,179,4,128,0,0,0,7,
+0,64,3,159,0,132,255,255,0,0,254,136,4,139,7,44,2,38,0,19,0,0,0,39,0,64,3,
+159,0,132,0,7,1,182,4,128,0,0,255,255,0,60,255,56,8,77,7,44,2,38,0,10,0,0,
+0,39,1,176,8,47,0,0,0,7,0,64,4,127,0,194,255,255,0,60,255,56,8,77,7,44,2,
+38,0,10,0,0,0,39,1,179,8,47,0,0,0,7,0,64,4,127,0,194,255,255,0,60,255,56,
+8,77,7,44,2,38,0,10,0,0,0,39,0,64,4,127,0,194,0,7,1,182,8,47,0,0,255,255,
+0,60,255,56,8,77,7,44,2,38,0,10,0,0,0,39,0,64,4,127,0,194,0,7,1,185,8,47,
+0,0,255,255,0,60,255,56,6,59,7,44,2,38,0,9,0,0,0,39,1,176,6,34,0,0,0,7,0,
+64,4,127,0,194,0,2,0,0,255,231,7,27,4,250,0,50,0,51,0,0,1,21,33,17,54,54,
+51,50,22,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,17,35,17,35,34,14,2,21,
+20,22,22,23,7,46,2,53,52,54,55,5,53,33,17,33,53,33,7,27,253,101,51,118,73,
+87,136,78,69,64,148,52,64,80,72,55,114,57,165,238,94,103,69,29,64,126,105,
+110,145,132,73,44,37,254,219,3,142,252,37,3,219,4,250,146,254,98,50,54,75,
+150,103,104,213,94,85,66,173,83,94,95,76,73,253,242,2,160,22,49,67,48,65,
+124,131,84,107,125,155,156,85,50,94,33,3,148,1,54,146,0,0,7,0,0,252,218,5,
+178,4,250,0,62,0,74,0,75,0,76,0,77,0,78,0,79,0,0,19,55,22,4,51,32,53,52,38,
+35,34,7,38,38,53,52,54,51,51,53,33,53,33,21,33,17,33,34,6,6,21,20,22,23,54,
+51,50,22,21,20,6,7,17,35,17,6,35,34,39,17,20,6,35,34,38,38,53,52,51,51,53,
+38,38,1,50,22,21,20,6,35,34,38,53,52,54,1,17,19,17,17,57,137,112,1,20,192,
+1,0,106,98,102,84,128,140,160,139,246,252,107,5,178,254,136,254,125,64,66,
+35,62,53,80,106,167,198,62,61,156,63,74,96,69,51,47,52,107,73,124,53,117,
+202,4,88,44,63,63,44,44,63,63,254,218,236,2,152,67,194,190,126,50,56,36,35,
+134,86,98,106,126,146,146,254,240,12,33,22,30,51,14,26,132,119,64,101,37,
+253,183,2,18,11,15,254,155,54,60,74,118,49,96,181,51,201,1,126,66,47,47,66,
+66,47,47,66,1,121,251,6,253,220,1,34,253,220,0,8,0,0,252,218,5,178,4,250,
+0,60,0,67,0,79,0,80,0,81,0,82,0,83,0,84,0,0,19,55,22,4,51,32,53,52,38,35,
+34,7,38,38,53,52,54,51,51,53,33,53,33,21,33,17,33,34,6,6,21,20,22,23,54,51,
+50,22,21,20,6,7,17,35,53,33,21,20,6,35,34,38,38,53,52,54,51,51,53,38,38,1,
+21,33,53,6,35,34,1,50,22,21,20,6,35,34,38,53,52,54,1,19,19,17,17,57,137,112,
+1,20,192,1,0,106,98,102,84,128,140,160,139,246,252,107,5,178,254,136,254,
+125,64,66,35,62,53,80,106,167,198,48,48,156,254,152,51,43,45,110,77,56,56,
+61,108,187,1,192,1,104,67,97,111,2,74,44,63,63,44,44,63,63,254,218,27,209,
+2,152,67,194,190,126,50,56,36,35,134,86,98,106,126,146,146,254,240,12,33,
+22,30,51,14,26,132,119,56,92,36,253,135,235,70,53,58,76,118,46,38,43,251,
+55,193,254,208,195,190,16,2,184,66,47,47,66,66,47,47,66,1,121,251,6,253,220,
+1,34,253,220,0,4,0,0,0,0,10,6,4,250,0,67,0,84,0,100,0,101,0,0,1,38,38,53,
+52,62,2,51,51,53,33,53,33,21,35,17,35,53,6,35,34,38,38,39,54,54,53,52,46,
+2,35,33,34,6,6,21,20,22,23,54,51,50,22,22,21,20,6,6,35,34,38,38,39,55,30,
+2,51,50,54,53,52,38,35,34,6,1,21,33,50,22,22,21,20,6,7,30,2,51,50,55,17,1,
+50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,19,2,128,126,142,44,84,113,87,
+217,252,107,10,6,213,164,129,139,110,182,127,28,125,128,19,43,67,78,252,199,
+64,63,38,64,53,74,103,107,169,96,97,188,131,149,251,225,98,141,81,179,197,
+119,128,128,110,94,49,96,1,145,1,199,130,146,77,101,112,32,74,88,62,140,116,
+252,110,29,49,29,29,49,29,29,49,29,29,49,228,1,176,35,155,99,60,84,59,29,
+175,146,146,251,152,202,66,89,180,132,15,83,65,26,39,29,13,16,46,35,42,64,
+14,24,69,136,93,91,144,81,101,230,190,66,159,193,84,86,85,68,78,18,2,166,
+175,65,122,71,102,123,40,57,65,26,95,2,239,254,138,30,53,30,30,53,30,30,53,
+30,30,53,30,254,149,0,3,0,0,0,0,10,30,4,250,0,94,0,113,0,114,0,0,1,7,38,38,
+53,52,54,55,53,33,53,33,21,35,17,35,53,6,6,35,34,38,38,39,54,54,53,52,46,
+2,35,35,34,39,22,21,20,6,6,4,35,34,38,38,53,52,54,55,38,38,53,52,54,54,51,
+50,22,23,7,38,38,35,34,6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,
+50,36,54,53,52,38,38,35,34,6,21,20,22,19,21,22,23,33,50,22,22,21,20,6,7,22,
+22,51,50,54,55,17,1,4,71,67,154,163,115,105,252,93,10,30,213,164,60,139,84,
+101,176,128,27,125,128,19,43,67,78,99,93,52,37,99,194,254,236,162,129,181,
+89,31,33,91,92,84,151,98,41,104,23,12,25,74,43,90,92,77,82,58,75,46,40,13,
+23,29,96,98,122,112,155,1,11,148,43,81,55,61,67,116,111,29,38,1,142,130,146,
+77,101,112,41,112,87,73,139,60,253,53,2,22,129,43,166,115,101,137,18,143,
+146,146,251,152,212,36,40,88,183,130,15,83,65,26,39,29,13,4,77,104,115,224,
+185,106,77,135,89,44,91,37,44,134,84,81,116,58,13,8,141,7,14,66,66,52,71,
+20,19,6,143,3,73,70,79,81,132,227,132,62,103,59,68,58,71,102,2,56,150,7,18,
+65,122,71,102,123,40,73,75,58,52,2,224,253,31,0,1,0,0,0,0,10,35,4,250,0,64,
+0,0,1,35,17,35,17,33,34,39,22,22,21,20,6,35,34,38,39,6,35,35,6,6,35,34,36,
+39,55,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,23,51,50,55,38,39,55,
+18,18,51,50,54,53,52,38,39,55,33,53,33,53,33,10,35,213,165,254,231,96,19,
+79,84,167,137,138,219,95,111,125,4,27,205,142,182,254,238,98,140,82,183,138,
+111,127,105,96,89,102,56,126,127,138,188,20,17,88,67,25,30,144,97,204,118,
+73,77,111,106,58,2,42,247,87,10,35,4,104,251,152,2,246,4,68,164,83,132,152,
+183,189,33,127,133,228,223,54,187,167,106,89,85,90,51,148,54,140,128,30,58,
+87,52,254,227,254,238,76,75,81,158,68,132,224,146,0,0,3,0,0,253,220,4,38,
+4,250,0,66,0,67,0,68,0,0,1,35,34,14,4,21,20,30,2,51,50,54,55,23,6,7,21,35,
+34,14,4,21,20,30,2,51,50,54,55,23,6,6,35,34,38,38,53,52,54,54,51,51,53,35,
+34,38,38,53,52,54,54,51,51,53,33,53,33,21,33,39,3,2,247,142,67,95,83,60,35,
+18,47,85,117,71,87,165,100,56,120,108,142,67,95,83,60,35,18,47,85,117,71,
+87,165,100,56,99,206,96,146,224,121,116,220,143,20,8,146,224,121,116,220,
+143,20,253,174,4,38,254,209,165,11,3,82,10,24,38,42,53,31,58,78,48,21,48,
+54,156,57,23,233,10,24,38,42,53,31,58,78,48,21,48,54,156,49,49,88,165,113,
+105,150,79,70,88,165,113,105,150,79,133,146,146,146,248,226,0,0,4,0,0,252,
+218,4,172,4,250,0,75,0,76,0,77,0,78,0,0,1,35,34,6,6,21,20,22,51,50,54,55,
+23,6,7,21,35,34,6,6,21,20,22,51,50,54,55,23,6,7,22,22,23,7,38,38,35,34,6,
+21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,53,52,54,51,51,53,35,34,
+36,53,52,54,51,51,53,33,53,33,21,33,39,3,55,2,247,180,127,132,61,150,170,
+85,167,100,56,111,117,180,127,132,61,150,170,85,167,100,56,148,128,126,232,
+127,125,123,230,138,105,105,89,76,93,92,52,110,116,153,174,118,111,171,182,
+249,217,33,8,233,254,254,249,217,33,253,174,4,38,254,209,165,15,1,3,96,43,
+74,47,89,82,42,50,155,49,22,224,43,74,47,89,82,42,50,155,62,17,22,156,177,
+72,159,141,63,54,54,57,40,143,42,141,119,87,129,24,24,166,131,142,158,63,
+173,157,142,158,120,146,146,146,249,209,21,0,4,0,0,253,220,4,126,4,250,0,
+54,0,67,0,68,0,69,0,0,1,35,34,14,4,21,20,30,2,51,50,54,55,23,6,7,21,30,2,
+21,20,4,35,34,46,2,53,52,54,54,51,51,53,35,34,38,38,53,52,54,54,51,51,53,
+33,53,33,21,33,3,35,34,6,21,20,22,51,50,54,53,52,38,3,3,2,247,142,67,95,83,
+60,35,18,47,85,117,71,87,165,100,56,120,108,104,157,83,254,254,237,112,189,
+136,76,123,228,141,7,8,146,224,121,116,220,143,20,253,174,4,126,254,121,57,
+61,187,195,176,165,168,171,121,224,11,3,82,10,24,38,42,53,31,58,78,48,21,
+48,54,156,57,23,103,29,105,138,78,163,172,45,92,137,92,99,152,83,70,88,165,
+113,105,150,79,133,146,146,251,232,103,103,97,106,96,93,75,116,4,199,248,
+226,0,0,5,0,0,252,218,4,172,4,250,0,67,0,80,0,81,0,82,0,83,0,0,1,6,35,34,
+38,53,52,54,55,38,38,53,52,36,51,51,53,35,34,36,53,52,54,51,51,53,33,53,33,
+21,33,17,35,34,6,6,21,20,22,51,50,54,55,23,6,7,21,22,22,21,20,6,7,22,22,23,
+7,38,38,35,34,6,21,20,22,51,50,55,3,35,34,6,21,20,22,51,50,54,53,52,38,3,
+3,55,3,4,110,116,153,174,122,112,177,181,1,13,213,17,8,233,254,254,249,217,
+33,253,174,4,126,254,121,180,127,132,61,150,170,85,167,100,56,111,117,164,
+180,188,187,129,219,120,125,123,230,138,105,105,89,76,93,92,18,61,193,189,
+170,171,169,170,125,220,15,1,253,4,42,141,119,91,128,22,26,162,132,138,162,
+63,173,157,142,158,120,146,146,254,248,43,74,47,89,82,42,50,155,49,22,93,
+42,169,104,130,149,18,26,158,167,72,159,141,63,54,54,57,40,3,24,85,87,84,
+84,75,82,63,98,4,101,249,209,21,0,3,0,0,0,0,8,58,4,250,0,52,0,69,0,70,0,0,
+1,35,34,6,6,21,20,30,2,51,50,54,54,55,23,6,6,35,34,38,38,53,52,54,54,51,51,
+17,33,53,33,21,35,17,35,53,6,6,35,34,38,38,39,54,54,53,52,46,2,35,33,37,50,
+22,22,21,20,6,7,22,22,51,50,54,55,17,33,21,19,2,247,112,132,167,89,52,88,
+116,64,62,107,99,84,56,99,206,96,139,228,124,129,228,134,8,253,174,8,58,213,
+164,60,139,84,101,176,128,27,125,128,19,43,67,78,254,211,1,62,130,146,77,
+101,112,41,112,87,73,139,60,252,54,255,2,203,66,124,85,75,109,70,34,19,37,
+43,153,49,49,114,206,130,123,187,100,1,12,146,146,251,152,212,36,40,88,183,
+130,15,83,65,26,39,29,13,146,65,122,71,102,123,40,73,75,58,52,2,224,175,253,
+206,0,0,5,0,0,253,220,4,204,4,250,0,42,0,55,0,68,0,69,0,70,0,0,1,33,21,30,
+2,21,20,6,7,21,30,2,21,20,4,35,34,46,2,53,52,54,54,51,51,53,46,3,53,52,54,
+54,51,51,53,33,53,33,1,35,34,6,21,20,22,51,50,54,53,52,38,3,35,34,6,21,20,
+22,51,50,54,53,52,38,3,3,4,204,254,43,104,157,83,175,169,104,157,83,254,254,
+237,112,189,136,76,123,228,141,7,110,183,132,74,123,228,141,7,253,174,4,204,
+253,242,61,187,195,176,165,168,171,121,116,61,187,195,176,165,168,171,121,
+224,11,4,104,148,29,105,138,78,133,167,25,95,29,105,138,78,163,172,45,92,
+137,92,99,152,83,70,1,46,92,136,91,99,152,83,133,146,254,88,103,103,97,106,
+96,93,75,116,253,27,103,103,97,106,96,93,75,116,4,199,248,226,0,0,4,0,0,0,
+0,9,37,4,250,0,43,0,60,0,76,0,77,0,0,1,34,39,21,22,22,21,20,6,6,35,34,38,
+38,53,52,54,54,51,51,17,33,53,33,21,35,17,35,53,6,6,35,34,38,38,39,54,54,
+53,52,46,2,35,1,33,21,33,50,22,22,21,20,6,7,22,22,51,50,54,55,1,35,34,6,6,
+21,20,30,2,51,50,54,53,52,38,1,3,242,116,35,121,123,123,225,147,145,238,130,
+128,230,134,7,253,174,9,37,213,164,60,139,84,101,176,128,27,125,128,19,43,
+67,78,2,157,251,75,2,41,130,146,77,101,112,41,112,87,73,139,60,251,18,72,
+111,166,94,52,91,125,73,161,178,119,1,173,3,22,7,2,73,196,120,131,184,91,
+113,205,132,121,188,101,1,12,146,146,251,152,195,36,40,88,183,130,15,83,65,
+26,39,29,13,1,82,192,65,122,71,102,123,40,73,75,58,52,1,84,62,126,90,75,109,
+72,35,135,128,99,157,254,221,0,6,0,0,253,220,5,35,4,250,0,79,0,92,0,93,0,
+94,0,95,0,96,0,0,1,38,38,53,52,54,54,51,51,53,33,53,33,21,35,17,33,34,14,
+2,21,20,22,23,54,51,50,22,22,21,20,6,6,7,21,35,34,6,21,20,22,23,38,53,52,
+54,54,51,50,22,22,21,20,6,6,35,34,38,38,53,52,54,55,38,36,39,55,30,2,51,50,
+54,53,52,38,35,34,6,19,51,50,54,53,52,38,35,34,6,21,20,22,19,1,19,39,2,128,
+128,140,74,137,88,246,252,107,5,35,233,254,125,61,53,35,16,62,53,80,106,110,
+165,90,74,150,103,128,198,204,123,121,25,66,142,103,91,130,62,97,196,142,
+161,248,133,253,234,192,254,215,116,137,82,180,198,120,127,129,106,98,49,
+96,53,22,121,120,61,63,80,87,13,198,254,178,191,33,2,31,35,134,86,67,92,45,
+126,146,146,254,240,8,19,25,15,30,51,14,26,59,113,79,68,111,74,11,122,102,
+98,93,103,15,58,58,55,94,58,59,94,53,80,119,65,86,165,113,143,168,8,25,228,
+203,67,141,169,74,63,63,50,56,18,252,125,64,58,38,42,59,55,24,42,6,54,248,
+226,2,238,26,0,0,3,0,0,253,220,5,35,4,250,0,88,0,89,0,90,0,0,5,38,38,53,52,
+54,55,38,3,55,30,2,51,32,53,52,38,35,34,6,7,38,38,53,52,54,54,51,51,53,33,
+53,33,21,35,17,33,34,14,2,21,20,22,23,54,51,50,22,22,21,20,6,6,35,34,39,6,
+6,21,20,22,23,54,51,50,22,22,21,20,6,6,35,34,36,39,55,30,2,51,32,53,52,38,
+35,34,6,19,1,2,128,128,140,27,22,211,153,137,82,180,198,120,1,0,103,101,49,
+96,41,128,140,74,137,88,246,252,107,5,35,233,254,125,61,53,35,16,62,53,80,
+106,110,165,90,95,189,132,98,80,36,36,62,53,80,106,110,165,90,95,189,132,
+240,254,164,135,137,82,180,198,120,1,0,103,101,49,96,236,254,178,113,35,134,
+86,40,60,22,111,1,13,67,141,169,74,137,52,63,18,18,35,134,86,67,92,45,126,
+146,146,254,240,8,19,25,15,30,51,14,26,61,118,82,79,126,73,17,8,34,23,30,
+51,14,26,61,118,82,79,126,73,230,233,67,141,169,74,137,52,63,18,5,89,248,
+226,0,0,4,0,0,252,218,5,79,4,250,0,101,0,102,0,103,0,104,0,0,37,38,38,53,
+52,55,38,38,39,55,22,4,51,50,54,53,52,38,35,34,7,38,38,53,52,54,51,51,53,
+33,53,33,21,35,21,33,34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,39,6,21,20,
+23,54,51,50,22,21,20,6,7,22,22,23,7,38,38,35,34,6,21,20,22,51,50,55,23,6,
+35,34,38,53,52,54,55,38,36,39,55,22,4,51,50,54,53,52,38,35,34,19,1,39,2,128,
+127,141,42,100,179,78,137,113,1,14,197,128,128,107,97,101,85,127,141,161,
+138,246,252,107,5,35,233,254,125,74,56,35,115,81,105,172,193,217,199,70,65,
+115,115,81,105,172,193,158,150,120,224,127,125,123,230,138,105,105,89,76,
+93,92,52,110,116,153,174,124,117,171,254,229,112,137,113,1,14,197,128,128,
+107,97,101,192,253,125,31,3,32,125,80,66,45,48,171,122,69,173,167,56,56,44,
+50,33,32,125,80,93,98,106,146,146,252,9,26,18,48,31,24,129,113,116,134,8,
+2,50,48,31,24,129,113,97,130,17,24,152,176,72,159,141,63,54,54,57,40,143,
+42,141,119,90,130,23,25,202,177,69,173,167,56,56,44,50,4,214,249,203,27,0,
+3,0,0,0,0,9,112,4,250,0,68,0,85,0,86,0,0,1,38,38,53,52,62,2,51,51,53,33,53,
+33,21,35,17,35,53,6,6,35,34,38,38,39,54,54,53,52,46,2,35,33,34,6,6,21,20,
+22,23,54,51,50,22,22,21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,
+34,6,1,21,33,50,22,22,21,20,6,7,22,22,51,50,54,55,17,1,2,128,126,142,44,84,
+113,87,217,252,107,9,112,213,164,60,139,84,101,176,128,27,125,128,19,43,67,
+78,253,93,64,63,38,64,53,74,103,107,169,96,97,188,131,149,251,225,98,141,
+81,179,197,119,128,128,110,94,49,96,1,145,1,49,130,146,77,101,112,41,112,
+87,73,139,60,253,53,1,176,35,155,99,60,84,59,29,175,146,146,251,152,212,36,
+40,88,183,130,15,83,65,26,39,29,13,16,46,35,42,64,14,24,69,136,93,91,144,
+81,101,230,190,66,159,193,84,86,85,68,78,18,2,166,175,65,122,71,102,123,40,
+73,75,58,52,2,224,253,31,0,5,0,0,253,220,4,158,4,250,0,65,0,78,0,91,0,92,
+0,93,0,0,37,35,34,6,21,20,22,23,38,53,52,54,54,51,50,22,22,21,20,6,6,35,34,
+38,38,53,52,54,54,55,53,46,2,53,52,54,54,55,53,33,53,33,21,33,17,35,34,6,
+21,20,22,23,38,53,52,54,54,51,50,22,22,21,20,6,7,39,50,54,53,52,38,35,34,
+6,21,20,22,23,19,50,54,53,52,38,35,34,6,21,20,22,23,3,3,3,21,128,198,204,
+123,121,25,66,142,103,91,130,62,97,196,142,162,248,132,134,239,156,160,243,
+126,134,239,156,253,144,4,158,254,119,128,198,204,123,121,25,66,142,103,91,
+130,62,147,136,113,121,120,61,63,80,87,13,15,22,121,120,61,63,80,87,13,15,
+30,41,83,102,98,93,103,15,58,58,55,94,58,59,94,53,80,119,65,86,165,113,107,
+151,77,3,68,1,90,162,111,107,151,77,3,131,146,146,254,237,102,98,93,103,15,
+57,59,55,94,58,59,94,53,100,131,22,126,64,58,38,42,59,55,25,42,21,252,254,
+64,58,38,42,59,55,24,42,22,6,76,248,226,0,0,4,0,0,0,0,8,248,4,250,0,55,0,
+72,0,85,0,86,0,0,1,33,34,14,2,21,20,22,23,38,53,52,54,54,51,50,30,2,21,20,
+6,6,35,34,38,38,53,52,54,54,55,53,33,53,33,21,35,17,35,53,6,6,35,34,38,38,
+39,54,54,53,52,46,2,39,50,22,22,21,20,6,7,22,22,51,50,54,55,17,33,21,3,54,
+54,53,52,38,35,34,6,6,21,20,22,37,4,226,253,226,115,151,123,60,130,120,31,
+65,137,98,76,110,73,35,107,202,135,150,247,136,127,243,159,253,144,8,248,
+213,164,60,139,84,101,176,128,27,125,128,19,43,67,61,130,146,77,101,112,41,
+112,87,73,139,60,251,150,127,118,137,71,57,47,74,42,17,2,49,3,1,32,84,116,
+69,130,161,27,78,94,70,121,77,45,74,97,52,94,147,81,119,216,138,128,196,112,
+4,215,146,146,251,152,174,36,40,88,183,130,15,83,65,26,39,29,13,146,65,122,
+71,102,123,40,73,75,58,52,3,6,213,252,250,2,98,81,61,70,40,76,50,41,69,176,
+0,0,1,0,0,255,231,5,145,4,250,0,29,0,0,1,21,35,17,35,17,35,34,14,2,21,20,
+22,22,23,7,46,2,53,52,54,55,5,53,33,17,33,53,5,145,213,165,238,94,103,69,
+29,64,126,105,110,145,132,73,44,37,254,159,3,202,251,233,4,250,146,251,152,
+2,160,22,49,67,48,65,124,131,84,107,125,155,156,85,50,94,33,3,148,1,54,146,
+0,2,0,0,255,231,4,23,4,250,0,3,0,25,0,0,17,53,33,21,3,34,14,2,21,20,22,22,
+23,7,46,2,53,52,54,55,5,53,33,21,3,245,204,94,103,69,29,64,126,105,110,145,
+132,73,44,37,254,159,3,202,4,104,146,146,254,56,22,49,67,48,65,124,131,84,
+107,125,155,156,85,50,94,33,3,148,146,0,0,7,0,0,252,218,5,214,4,250,0,59,
+0,88,0,89,0,90,0,91,0,92,0,93,0,0,1,3,14,3,35,34,38,38,53,52,54,55,38,38,
+53,52,54,54,51,50,23,62,2,51,51,53,33,53,33,21,33,17,35,34,6,6,21,20,22,22,
+51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,7,19,1,6,35,34,38,38,39,38,35,
+34,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,36,19,19,3,17,17,4,
+228,116,48,121,145,172,99,120,173,88,33,36,76,82,85,150,98,37,44,6,133,215,
+145,10,252,20,5,214,254,187,99,164,166,81,73,151,111,12,30,4,5,77,60,57,83,
+40,61,62,173,254,187,30,38,124,209,135,24,44,37,94,92,130,51,60,41,39,13,
+20,25,84,90,112,94,146,1,10,55,228,179,254,173,1,66,62,115,88,53,70,124,80,
+43,90,37,39,115,76,77,112,57,6,119,162,73,195,146,146,254,173,58,110,84,74,
+113,64,3,18,40,14,63,68,48,73,40,59,79,22,254,59,1,173,4,71,134,93,7,63,59,
+87,36,15,6,139,3,67,61,67,76,168,5,21,251,6,253,220,1,34,253,220,0,6,0,0,
+252,218,4,70,4,250,0,61,0,62,0,63,0,64,0,65,0,66,0,0,1,3,6,35,34,39,17,20,
+6,35,34,38,38,53,52,54,51,51,53,38,38,53,52,62,4,51,51,53,33,53,33,21,33,
+17,35,34,6,6,21,20,22,22,51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,7,19,
+1,19,3,17,17,3,84,176,42,33,101,80,47,43,45,103,71,56,56,49,88,89,25,59,88,
+109,138,80,10,253,164,4,70,254,187,99,158,166,87,73,151,111,12,30,4,5,77,
+60,57,83,40,61,62,173,254,122,228,179,254,173,1,231,5,21,254,162,48,54,73,
+115,50,49,46,181,55,167,109,57,95,91,67,43,23,195,146,146,254,173,54,112,
+86,74,113,64,3,18,40,14,63,68,48,73,40,59,79,22,254,59,6,20,251,6,253,220,
+1,34,253,220,0,0,10,0,0,252,218,5,39,4,250,0,54,0,65,0,75,0,76,0,77,0,78,
+0,79,0,80,0,81,0,82,0,0,1,3,14,2,35,34,38,38,53,52,54,55,38,53,52,62,4,51,
+51,53,33,53,33,21,33,17,35,34,6,6,21,20,22,22,51,50,55,38,38,53,52,54,51,
+50,22,22,21,20,6,7,19,1,6,7,1,54,54,55,6,35,34,38,19,1,6,21,20,30,2,51,50,
+1,19,3,17,17,19,1,4,53,118,71,134,175,105,115,180,98,142,129,32,25,59,88,
+109,138,80,10,252,195,5,39,254,187,99,158,166,87,73,151,111,12,30,4,5,77,
+60,57,83,40,61,62,173,252,245,41,32,1,78,46,92,56,39,30,116,203,76,254,198,
+31,39,64,85,46,57,1,44,228,204,75,254,8,254,173,1,70,81,99,62,83,147,93,120,
+169,33,71,96,57,95,91,67,43,23,195,146,146,254,173,54,112,86,74,113,64,3,
+18,40,14,63,68,48,73,40,59,79,22,254,59,2,37,6,12,254,214,30,91,76,5,64,254,
+200,1,24,46,59,52,73,45,21,5,115,251,6,253,220,1,34,253,220,2,179,1,97,0,
+0,7,0,0,252,218,6,113,4,250,0,92,0,93,0,94,0,95,0,96,0,97,0,98,0,0,1,3,5,
+23,22,21,20,6,35,34,38,38,53,52,54,55,55,39,46,2,35,34,6,21,20,22,51,50,54,
+55,23,6,35,34,38,38,53,52,54,54,51,50,30,2,23,23,37,54,55,46,2,53,52,62,2,
+51,51,53,33,53,33,21,33,17,35,34,6,6,21,20,22,22,51,50,55,38,38,53,52,54,
+51,50,22,22,21,20,6,7,19,1,19,1,17,17,19,5,127,152,254,17,24,13,56,44,51,
+120,80,36,44,50,70,29,55,63,51,50,64,52,46,29,59,39,36,79,81,64,105,59,66,
+120,65,62,89,73,66,31,73,1,28,36,42,132,194,98,81,136,178,104,10,251,121,
+6,113,254,187,99,164,166,81,73,151,111,12,30,4,5,77,60,57,83,40,61,62,173,
+254,122,228,254,178,163,254,173,1,165,203,58,31,29,42,46,53,81,38,23,44,18,
+20,172,70,92,41,52,43,42,51,12,15,130,28,57,102,63,68,101,57,29,60,102,76,
+180,116,15,13,13,103,173,117,102,145,90,39,195,146,146,254,173,58,110,84,
+74,113,64,3,18,40,14,63,68,48,73,40,59,79,22,254,59,6,20,251,6,253,220,1,
+34,253,220,3,181,0,8,0,0,252,218,5,19,4,250,0,54,0,70,0,71,0,72,0,73,0,74,
+0,75,0,76,0,0,1,3,14,2,35,34,38,38,53,52,54,55,38,53,52,62,4,51,51,53,33,
+53,33,21,33,17,35,34,6,6,21,20,22,22,51,50,55,38,38,53,52,54,51,50,22,22,
+21,20,6,7,19,1,6,6,21,20,22,22,51,50,54,54,55,6,35,34,38,1,19,3,17,17,1,4,
+33,118,70,132,169,103,113,174,97,131,122,34,25,59,88,109,138,80,10,252,215,
+5,19,254,187,99,158,166,87,73,151,111,12,30,4,5,77,60,57,83,40,61,62,173,
+252,254,87,99,63,101,61,81,141,116,69,39,30,115,196,1,58,228,84,253,239,254,
+173,1,70,80,100,62,82,148,93,117,163,36,75,98,57,95,91,67,43,23,195,146,146,
+254,173,54,112,86,74,113,64,3,18,40,14,63,68,48,73,40,59,79,22,254,58,2,30,
+19,102,69,64,84,36,66,106,91,5,61,4,46,251,6,253,220,1,34,253,220,4,20,0,
+6,0,0,252,218,6,114,4,250,0,102,0,103,0,104,0,105,0,106,0,107,0,0,37,6,35,
+34,46,3,53,52,62,2,51,51,53,33,53,33,21,33,17,35,34,6,6,21,20,22,22,51,50,
+55,38,38,53,52,54,51,50,22,22,21,20,6,7,19,7,3,14,3,35,34,38,38,53,52,54,
+55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,
+22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,36,19,19,3,17,17,4,201,38,30,
+96,165,124,79,42,81,136,178,104,10,251,120,6,114,254,187,99,164,166,81,73,
+151,111,12,30,4,5,77,60,57,83,40,61,62,173,142,116,48,121,145,172,99,120,
+173,88,21,23,143,145,71,129,80,68,109,63,40,36,120,41,46,42,35,60,35,135,
+130,61,84,41,39,13,20,25,84,90,112,94,147,1,11,53,228,135,148,6,42,75,97,
+124,77,102,145,90,39,195,146,146,254,173,58,110,84,74,113,64,3,18,40,14,63,
+68,48,73,40,59,79,22,254,59,57,1,66,62,115,88,53,70,124,80,35,71,33,36,152,
+112,76,124,71,49,91,57,46,91,33,79,35,45,36,44,40,70,41,80,91,8,27,6,139,
+3,67,61,67,76,170,5,19,251,6,253,220,1,34,253,220,0,0,6,0,0,252,218,8,184,
+4,250,0,82,0,115,0,116,0,117,0,118,0,119,0,0,37,6,35,34,46,3,53,52,62,2,51,
+51,53,33,53,33,21,35,17,35,17,6,6,35,34,39,14,3,35,34,38,38,53,52,54,55,38,
+38,53,52,54,54,51,50,22,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,22,23,
+54,51,50,23,7,38,35,34,6,21,20,22,51,50,36,37,22,22,51,50,54,55,17,33,17,
+35,34,6,6,21,20,22,22,51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,19,17,17,
+3,4,201,38,28,96,166,124,79,43,81,136,178,104,10,251,120,8,184,213,164,50,
+117,73,181,115,48,123,153,182,106,120,173,88,21,23,143,145,71,129,80,68,109,
+63,40,36,120,41,46,42,35,60,35,135,130,61,84,41,39,13,20,25,84,90,112,94,
+147,1,11,1,15,38,111,86,64,124,54,253,238,99,164,166,81,73,151,111,12,30,
+4,5,77,60,57,83,40,59,212,145,148,6,42,74,98,124,77,102,145,90,39,195,146,
+146,250,102,1,13,28,35,118,68,127,99,59,70,124,80,35,71,33,36,152,112,76,
+124,71,49,91,57,46,91,33,79,35,45,36,44,40,70,41,80,91,8,27,6,139,3,67,61,
+67,76,170,196,61,64,49,46,3,219,254,173,58,110,84,74,113,64,3,18,40,14,63,
+68,48,73,40,58,79,253,26,1,34,253,220,1,211,0,0,6,0,0,252,218,4,111,4,250,
+0,68,0,69,0,70,0,71,0,72,0,73,0,0,19,46,2,53,52,62,2,51,51,53,33,53,33,21,
+33,17,33,34,6,6,21,20,22,23,54,51,50,22,23,7,38,35,34,6,6,21,20,22,51,50,
+55,38,38,53,52,54,51,50,22,22,21,20,6,7,22,23,7,38,38,39,6,35,34,38,38,53,
+52,1,19,3,17,17,238,55,60,38,50,85,110,83,232,253,123,4,111,254,187,254,110,
+64,63,38,65,62,95,118,38,87,20,12,65,59,87,120,61,152,159,15,30,7,5,77,60,
+57,83,40,49,56,58,86,136,35,83,27,59,57,138,215,115,1,230,207,199,1,226,36,
+66,84,53,63,87,56,26,175,146,146,254,191,16,46,35,43,71,20,40,7,3,149,10,
+52,91,58,103,106,3,18,40,14,63,68,48,73,40,56,76,22,112,115,68,57,150,60,
+9,85,156,107,129,3,118,251,6,253,220,1,34,253,220,0,0,2,0,0,255,253,5,249,
+4,250,0,37,0,59,0,0,1,34,46,2,53,52,54,54,51,51,53,33,53,33,21,35,17,35,53,
+33,21,20,6,35,34,38,38,53,52,54,51,51,52,46,2,35,19,17,33,34,14,3,21,20,30,
+2,51,51,50,30,2,21,33,17,1,138,65,100,91,53,78,149,136,122,253,198,5,249,
+213,165,254,189,54,45,48,118,79,64,61,59,19,36,52,32,206,254,215,57,63,38,
+25,12,18,30,43,35,163,88,99,68,35,1,73,1,207,22,63,97,61,85,107,55,175,146,
+146,251,152,199,74,60,68,85,125,50,43,45,41,46,24,6,2,154,254,191,7,16,25,
+34,22,27,35,23,10,30,67,96,70,3,15,0,0,2,0,0,255,233,5,151,4,250,0,27,0,57,
+0,0,1,21,35,17,35,53,6,6,35,34,38,38,53,52,55,46,2,53,52,62,2,51,51,53,33,
+53,1,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,54,55,17,33,17,33,34,
+6,6,21,20,22,5,151,213,164,126,248,140,114,175,93,74,56,57,34,50,85,110,83,
+140,253,215,1,109,91,112,47,122,27,12,53,79,42,128,127,115,105,103,176,150,
+82,254,176,254,202,64,63,38,64,4,250,146,251,152,198,119,102,75,136,90,123,
+84,39,66,81,50,63,87,56,26,175,146,253,72,36,13,8,146,8,10,91,86,80,87,77,
+134,106,2,178,254,191,16,46,35,43,69,0,0,1,0,0,255,233,4,138,4,250,0,57,0,
+0,1,17,33,34,6,6,21,20,22,23,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,
+54,54,55,23,14,5,35,34,38,38,53,52,55,46,2,53,52,62,2,51,51,53,33,53,33,21,
+2,206,254,202,64,63,38,64,58,91,112,47,122,27,12,53,79,42,128,127,115,105,
+103,176,150,82,108,65,78,96,94,107,116,66,114,175,93,74,56,57,34,50,85,110,
+83,140,253,215,4,7,4,104,254,191,16,46,35,43,69,20,36,13,8,146,8,10,91,86,
+80,87,77,134,106,123,75,75,74,53,40,21,75,136,90,123,84,39,66,81,50,63,87,
+56,26,175,146,146,0,1,0,0,0,0,5,10,4,250,0,37,0,0,17,53,33,21,35,17,35,17,
+5,23,22,21,20,6,35,34,38,53,52,54,55,55,54,55,53,33,21,20,6,35,34,38,38,53,
+52,51,33,17,5,10,213,165,254,236,62,39,80,75,100,148,29,47,197,190,115,254,
+19,55,50,48,114,76,124,2,200,4,104,146,146,251,152,1,254,231,71,45,42,48,
+56,86,62,29,50,39,161,155,74,1,110,55,59,85,126,54,105,1,52,0,0,3,0,0,0,0,
+4,170,4,250,0,31,0,43,0,44,0,0,1,35,17,35,17,5,23,22,21,20,6,6,35,34,46,2,
+53,52,54,55,55,54,55,46,2,53,17,35,53,33,5,17,20,30,3,51,50,54,55,17,1,4,
+170,213,164,254,95,49,19,30,56,41,46,100,82,37,49,51,113,27,84,83,113,42,
+162,4,170,252,156,14,31,46,70,49,73,147,61,254,231,4,104,251,152,1,235,236,
+88,34,31,28,45,29,35,61,64,29,33,49,29,62,15,40,21,119,149,125,1,41,146,146,
+254,236,98,96,55,41,20,70,63,1,197,253,37,0,0,3,0,0,0,0,7,126,4,250,0,48,
+0,62,0,63,0,0,1,6,6,35,34,38,39,14,2,35,34,38,38,53,52,54,54,51,50,22,23,
+7,38,35,34,6,21,20,22,22,51,50,54,55,38,39,54,54,53,52,39,33,53,33,21,35,
+17,35,1,22,22,51,50,54,55,17,33,22,22,21,20,6,5,6,5,70,165,88,97,158,61,71,
+115,142,87,111,181,100,106,194,127,48,129,27,12,114,70,129,141,65,105,62,
+101,167,59,29,12,132,117,75,252,72,7,126,213,164,253,191,41,127,98,86,157,
+68,254,104,28,31,115,254,213,1,112,47,51,72,72,64,68,41,88,158,99,114,165,
+85,13,8,149,21,113,101,67,92,43,87,87,74,89,28,100,86,93,99,146,146,251,152,
+2,105,103,99,73,75,2,53,52,111,53,108,151,77,0,5,0,57,252,218,5,175,5,15,
+0,56,0,69,0,70,0,71,0,72,0,0,1,35,17,35,53,6,6,35,34,38,38,39,7,39,1,23,7,
+6,6,21,20,30,2,51,50,54,55,17,38,36,39,6,7,39,54,55,38,38,53,52,54,54,51,
+50,22,22,21,20,6,7,22,23,17,35,53,33,1,54,54,53,52,38,35,34,6,6,21,20,22,
+1,17,17,5,175,213,165,52,121,77,85,142,84,1,200,95,2,48,68,70,54,49,27,44,
+54,28,72,123,54,141,254,220,117,174,198,98,184,133,93,98,76,149,97,88,142,
+82,81,82,169,254,130,1,252,252,76,70,75,80,72,41,70,45,84,2,13,4,104,250,
+128,162,39,38,72,139,93,139,136,1,80,125,46,35,84,54,42,58,36,16,64,70,1,
+171,12,73,52,115,115,138,94,79,66,146,93,71,121,73,67,125,80,80,140,64,67,
+14,1,214,146,254,42,46,111,63,66,70,32,65,46,61,108,250,140,1,34,253,220,
+0,7,0,57,252,218,4,144,5,15,0,24,0,37,0,62,0,63,0,64,0,65,0,66,0,0,1,38,36,
+39,6,7,39,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,23,37,54,54,53,
+52,38,35,34,6,6,21,20,22,1,14,2,35,34,38,38,39,7,39,1,23,7,6,6,21,20,30,2,
+51,50,54,55,3,3,17,17,4,53,141,254,220,117,174,198,98,184,133,93,98,76,149,
+97,88,142,82,81,82,169,254,253,198,70,75,80,72,41,70,45,84,2,228,61,97,112,
+71,85,142,84,1,200,95,2,48,68,70,54,49,27,44,54,28,72,123,54,174,150,1,251,
+12,73,52,115,115,138,94,79,66,146,93,71,121,73,67,125,80,80,140,64,67,14,
+146,46,111,63,66,70,32,65,46,61,108,252,132,58,61,32,72,139,93,139,136,1,
+80,125,46,35,84,54,42,58,36,16,64,70,254,152,254,244,1,34,253,220,0,0,5,0,
+57,252,218,5,175,5,15,0,60,0,73,0,74,0,75,0,76,0,0,1,35,17,35,53,6,6,35,34,
+38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,55,17,38,
+36,39,6,7,39,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,23,17,35,53,
+33,1,54,54,53,52,38,35,34,6,6,21,20,22,1,17,17,5,175,213,165,59,137,72,99,
+158,92,91,168,111,43,114,24,12,32,80,39,107,116,112,96,64,124,56,141,254,
+220,117,174,198,98,184,133,93,98,76,149,97,88,142,82,81,82,169,254,130,1,
+252,252,76,70,75,80,72,41,70,45,84,1,169,4,104,250,128,156,35,36,78,146,95,
+97,142,76,14,7,141,7,14,95,86,82,89,50,48,1,207,12,73,52,115,115,138,94,79,
+66,146,93,71,121,73,67,125,80,80,140,64,67,14,1,214,146,254,42,46,111,63,
+66,70,32,65,46,61,108,250,140,1,34,253,220,0,0,7,0,57,252,218,4,113,5,15,
+0,24,0,37,0,67,0,68,0,69,0,70,0,71,0,0,1,38,36,39,6,7,39,54,55,38,38,53,52,
+54,54,51,50,22,22,21,20,6,7,22,23,37,54,54,53,52,38,35,34,6,6,21,20,22,1,
+14,3,35,34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,
+55,3,3,17,17,4,53,141,254,220,117,174,198,98,184,133,93,98,76,149,97,88,142,
+82,81,82,169,254,253,198,70,75,80,72,41,70,45,84,2,197,58,73,81,74,42,99,
+158,92,91,168,111,43,114,24,12,32,80,39,107,116,112,96,64,124,56,83,141,1,
+251,12,73,52,115,115,138,94,79,66,146,93,71,121,73,67,125,80,80,140,64,67,
+14,146,46,111,63,66,70,32,65,46,61,108,252,82,34,33,24,10,78,146,95,97,142,
+76,14,7,141,7,14,95,86,82,89,50,48,254,188,254,244,1,34,253,220,0,2,0,57,
+255,231,8,141,5,15,0,67,0,80,0,0,1,22,23,62,2,51,50,22,23,54,55,17,33,53,
+33,21,35,17,35,17,14,2,7,39,54,55,38,38,35,34,6,21,20,30,4,23,7,46,4,39,38,
+39,6,7,39,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,39,54,54,53,52,38,35,
+34,6,6,21,20,22,2,142,104,141,21,99,126,63,86,152,71,115,180,252,162,4,215,
+213,164,79,104,80,30,157,25,39,60,98,50,79,91,11,26,47,79,126,85,110,52,162,
+111,69,30,4,203,154,174,198,98,184,133,93,98,76,149,97,88,142,82,81,229,70,
+75,80,72,41,70,45,84,2,227,40,31,66,94,44,57,59,104,10,1,2,146,146,251,152,
+2,215,8,61,127,104,49,96,69,45,36,90,76,28,54,57,69,84,111,71,107,43,143,
+124,111,92,47,44,65,115,115,138,94,79,66,146,93,71,121,73,67,125,80,80,140,
+1,46,111,63,66,70,32,65,46,61,108,0,0,3,0,57,0,0,5,195,5,15,0,53,0,66,0,67,
+0,0,1,35,17,35,17,5,23,22,21,20,6,6,35,34,46,2,53,52,54,54,55,55,54,55,38,
+38,39,6,7,39,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,22,23,17,35,
+53,33,1,54,54,53,52,38,35,34,6,6,21,20,22,1,5,195,213,165,254,134,49,19,30,
+56,41,46,100,82,37,15,44,41,113,159,168,102,221,85,174,198,98,184,133,93,
+98,76,149,97,88,142,82,81,82,88,232,123,150,2,16,252,56,70,75,80,72,41,70,
+45,84,2,157,4,104,251,152,1,213,214,88,34,31,28,45,29,35,61,64,29,18,32,38,
+23,62,87,77,17,63,38,115,115,138,94,79,66,146,93,71,121,73,67,125,80,80,140,
+64,35,41,5,1,214,146,254,42,46,111,63,66,70,32,65,46,61,108,254,176,0,4,0,
+0,0,0,4,202,4,250,0,34,0,37,0,44,0,45,0,0,1,17,7,35,34,14,2,21,20,30,2,51,
+50,54,55,23,6,6,35,34,38,38,53,52,55,38,38,53,17,35,53,33,21,33,1,17,5,20,
+22,23,54,55,1,1,3,245,132,110,103,163,113,60,51,87,112,61,91,169,101,56,99,
+206,96,152,223,116,124,64,56,172,4,202,252,247,1,143,254,0,48,53,120,152,
+254,139,1,90,4,104,254,69,128,20,48,80,59,58,77,45,18,47,55,156,49,49,83,
+161,114,139,88,57,136,88,1,6,146,146,254,114,1,142,212,117,118,29,36,3,1,
+120,251,213,255,255,0,0,253,220,4,202,4,250,2,38,2,12,0,0,0,7,0,182,4,68,
+0,0,0,6,0,0,0,0,4,231,4,250,0,27,0,30,0,38,0,53,0,54,0,55,0,0,1,17,7,22,22,
+21,20,14,2,35,34,46,4,53,52,55,38,38,53,17,35,53,33,21,33,1,17,5,20,22,23,
+54,51,51,1,1,35,34,6,21,20,22,51,50,54,53,52,46,2,19,3,4,8,82,86,88,72,130,
+181,109,50,120,120,86,56,32,129,55,51,191,4,231,252,237,1,143,254,0,39,47,
+112,144,31,254,139,1,132,68,172,171,162,150,157,159,40,64,78,89,205,4,104,
+254,69,73,54,142,86,89,125,79,37,19,47,64,77,91,59,156,86,53,128,86,1,6,146,
+146,254,114,1,142,212,107,116,31,29,1,120,254,2,104,103,100,104,96,94,49,
+75,53,34,2,215,251,6,0,255,255,0,0,253,220,4,231,4,250,2,38,2,14,0,0,0,7,
+0,182,4,71,0,0,0,6,0,0,252,218,6,40,4,250,0,64,0,79,0,80,0,81,0,82,0,83,0,
+0,1,17,52,38,38,35,35,21,20,6,6,35,34,46,2,53,53,6,6,21,20,22,22,23,7,46,
+2,53,52,54,55,38,38,53,52,62,2,51,33,53,33,53,33,21,33,17,33,34,6,6,21,20,
+22,23,54,51,33,50,22,22,21,17,1,35,21,20,30,3,51,50,62,3,53,19,3,17,17,4,
+174,20,47,46,43,59,118,90,76,108,64,23,108,114,72,150,133,110,163,167,79,
+66,65,54,53,50,85,110,83,2,78,251,220,6,40,254,161,253,8,64,63,38,51,42,82,
+134,1,211,108,124,55,254,43,242,8,18,25,38,30,33,42,24,18,6,166,7,254,232,
+2,126,47,44,18,233,121,130,68,51,98,119,75,203,12,125,116,89,159,175,119,
+107,148,210,200,113,85,148,52,44,102,60,63,87,56,26,175,146,146,254,191,16,
+46,35,39,62,20,25,54,112,95,253,135,2,235,210,52,66,47,29,17,17,27,47,61,
+59,3,249,248,226,1,34,253,220,0,5,0,0,252,218,5,146,4,250,0,69,0,70,0,71,
+0,72,0,73,0,0,1,17,35,21,20,6,35,34,38,38,53,52,54,51,33,53,52,38,38,35,33,
+34,14,2,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,62,2,51,33,53,33,53,
+33,21,33,17,33,34,6,6,21,20,22,23,54,51,33,50,22,22,21,17,1,19,17,17,4,24,
+216,52,42,44,103,67,54,57,1,157,20,47,46,254,204,100,122,84,39,63,158,174,
+110,183,186,80,66,65,54,53,50,85,110,83,1,184,252,114,5,146,254,161,253,158,
+64,63,38,51,42,82,134,1,61,108,124,55,254,209,43,254,232,1,157,99,52,51,77,
+114,48,47,47,94,47,44,18,24,68,99,68,77,140,175,150,107,155,216,193,107,85,
+148,52,44,102,60,63,87,56,26,175,146,146,254,191,16,46,35,39,62,20,25,54,
+112,95,253,135,6,18,248,226,1,34,253,220,0,5,0,0,252,218,6,133,4,250,0,48,
+0,65,0,66,0,67,0,68,0,0,19,38,38,53,52,62,2,51,33,53,33,53,33,21,35,17,35,
+17,33,21,20,6,35,34,38,38,53,52,54,51,51,38,38,35,34,6,21,20,22,22,23,7,46,
+2,53,52,54,1,17,33,34,6,6,21,20,22,23,54,51,50,22,23,33,17,3,17,17,252,58,
+52,50,85,110,83,1,14,253,28,6,133,213,165,254,189,54,45,48,116,81,64,61,59,
+10,118,108,138,152,63,158,174,110,183,186,80,72,2,203,254,72,64,63,38,54,
+44,85,98,173,193,15,1,73,238,2,0,48,102,59,63,87,56,26,175,146,146,250,128,
+1,155,74,60,68,83,127,50,43,45,100,90,132,127,77,140,175,150,107,155,216,
+193,107,91,142,2,153,254,191,16,46,35,40,64,19,27,168,169,3,83,249,116,1,
+34,253,220,0,6,0,0,252,218,6,105,4,250,0,44,0,72,0,73,0,74,0,75,0,76,0,0,
+19,38,38,53,52,62,2,51,33,53,33,53,33,21,35,17,35,53,6,35,34,38,38,39,54,
+54,53,52,38,35,34,6,21,20,22,22,23,7,46,2,53,52,54,1,17,33,17,33,34,6,6,21,
+20,22,23,54,51,50,30,2,21,20,6,6,7,22,22,51,50,54,3,17,17,1,251,59,50,50,
+85,110,83,1,14,253,28,6,105,213,164,117,144,103,174,128,29,127,126,108,102,
+166,164,63,158,174,110,183,186,80,68,4,54,254,153,254,72,64,63,38,54,44,89,
+116,79,140,103,60,52,90,71,43,115,90,69,119,155,254,28,2,1,49,101,58,63,87,
+56,26,175,146,146,250,102,202,61,83,172,126,14,71,53,56,57,129,130,77,140,
+175,150,107,155,216,193,107,83,149,254,123,4,31,254,191,16,46,35,40,64,19,
+27,31,65,97,66,68,93,60,25,66,62,45,253,194,1,34,253,220,3,108,0,5,0,0,252,
+218,6,70,4,250,0,87,0,88,0,89,0,90,0,91,0,0,1,17,6,6,7,39,54,55,38,38,35,
+34,6,21,20,22,22,23,7,46,3,53,52,62,2,51,50,23,54,55,53,52,38,38,35,33,34,
+14,2,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,62,2,51,33,53,33,53,33,
+21,33,17,33,34,6,6,21,20,22,23,54,51,33,50,22,22,21,17,1,3,17,17,4,204,66,
+92,30,133,26,54,31,70,42,61,71,55,116,112,92,72,125,91,51,46,76,100,53,127,
+115,66,81,20,47,46,254,24,100,122,84,39,72,150,133,110,163,167,79,66,65,54,
+53,50,85,110,83,2,108,251,190,6,70,254,161,252,234,64,63,38,51,42,82,134,
+1,241,108,124,55,254,209,37,254,232,1,215,25,136,103,44,108,80,16,17,66,55,
+56,98,107,79,104,54,110,114,119,64,60,90,59,30,69,47,15,38,47,44,18,24,68,
+99,68,89,159,175,119,107,148,210,200,113,85,148,52,44,102,60,63,87,56,26,
+175,146,146,254,191,16,46,35,39,62,20,25,54,112,95,253,135,6,18,248,226,1,
+34,253,220,0,0,5,0,0,252,218,6,40,4,250,0,82,0,83,0,84,0,85,0,86,0,0,1,52,
+38,38,35,33,34,14,2,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,62,2,51,
+33,53,33,53,33,21,33,17,33,34,6,6,21,20,22,23,54,51,33,50,22,22,21,17,35,
+53,6,6,35,34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,21,20,22,51,50,54,
+55,3,3,17,17,4,174,20,47,46,254,54,100,122,84,39,72,150,133,110,163,167,79,
+66,65,54,53,50,85,110,83,2,78,251,220,6,40,254,161,253,8,64,63,38,51,42,82,
+134,1,211,108,124,55,165,66,123,64,98,153,83,85,159,106,40,107,24,12,26,76,
+37,210,105,94,59,117,52,138,7,1,102,47,44,18,24,68,99,68,89,159,175,119,107,
+148,210,200,113,85,148,52,44,102,60,63,87,56,26,175,146,146,254,191,16,46,
+35,39,62,20,25,54,112,95,253,65,178,33,30,71,127,83,85,129,69,13,8,136,6,
+14,149,69,72,47,46,4,255,248,226,1,34,253,220,0,0,3,0,0,255,231,5,182,4,250,
+0,57,0,58,0,59,0,0,1,54,55,17,33,53,33,21,33,17,30,3,21,20,6,6,7,39,54,54,
+53,52,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,30,4,23,7,46,4,53,52,54,54,
+51,50,22,1,17,2,214,98,139,252,61,5,182,254,177,41,78,60,37,48,81,71,141,
+90,86,85,78,102,141,43,157,25,39,60,98,50,79,91,11,26,47,79,126,85,110,114,
+125,100,61,29,86,152,87,86,150,1,53,2,245,91,19,1,5,146,146,254,242,12,49,
+78,108,71,86,161,146,95,103,109,193,91,87,94,152,150,49,96,69,45,36,90,76,
+28,54,57,69,84,111,71,107,97,116,116,106,101,53,93,139,76,57,1,203,251,6,
+255,255,0,0,254,118,5,182,4,250,2,38,2,22,0,0,0,7,0,64,5,73,0,0,255,255,0,
+0,253,220,5,182,4,250,2,38,2,22,0,0,0,7,0,182,5,57,0,0,255,255,0,0,253,220,
+5,182,4,250,2,38,2,22,0,0,0,39,0,182,5,57,0,0,0,7,0,64,3,83,0,139,0,5,0,57,
+255,231,8,204,5,15,0,80,0,93,0,94,0,95,0,96,0,0,1,54,55,17,33,53,33,21,33,
+17,30,3,21,20,6,6,7,39,54,54,53,52,38,35,34,6,7,39,54,55,38,38,35,34,6,21,
+20,30,4,23,7,46,4,39,38,39,6,7,39,54,55,38,38,53,52,54,54,51,50,22,22,21,
+20,6,7,22,23,62,2,51,50,22,5,54,54,53,52,38,35,34,6,6,21,20,22,1,17,1,5,236,
+98,139,252,221,5,22,254,177,41,78,60,37,48,81,71,141,90,86,85,78,102,141,
+43,157,25,39,60,98,50,79,91,11,26,47,79,126,85,110,52,162,111,69,30,4,203,
+154,174,198,98,184,133,93,98,76,149,97,88,142,82,81,82,104,141,21,99,126,
+63,86,150,252,87,70,75,80,72,41,70,45,84,5,45,252,100,2,245,91,19,1,5,146,
+146,254,242,12,49,78,108,71,86,161,146,95,103,109,193,91,87,94,152,150,49,
+96,69,45,36,90,76,28,54,57,69,84,111,71,107,43,143,124,111,92,47,44,65,115,
+115,138,94,79,66,146,93,71,121,73,67,125,80,80,140,64,40,31,66,94,44,57,11,
+46,111,63,66,70,32,65,46,61,108,1,170,251,6,2,10,0,0,2,0,0,255,232,5,125,
+4,250,0,45,0,46,0,0,1,35,17,35,17,33,21,22,22,21,20,6,7,22,23,7,38,39,6,35,
+34,38,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,7,39,54,55,53,33,53,
+33,1,5,125,213,165,253,247,148,155,136,124,107,86,126,125,102,57,58,51,79,
+44,70,61,47,86,53,105,122,126,109,74,124,80,52,128,135,254,170,5,125,251,
+149,4,104,251,152,4,104,160,22,175,142,119,190,56,95,100,93,155,86,9,33,61,
+40,57,65,44,41,28,135,88,94,104,32,39,144,61,10,156,146,252,104,0,2,0,0,255,
+232,3,105,4,250,0,41,0,42,0,0,1,33,21,22,22,21,20,6,7,22,23,7,38,39,6,35,
+34,38,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,7,39,54,55,53,33,53,
+33,1,3,105,254,145,148,155,136,124,107,86,126,125,102,57,58,51,79,44,70,61,
+47,86,53,105,122,126,109,74,124,80,52,128,135,254,170,3,105,253,169,4,104,
+160,22,175,142,119,190,56,95,100,93,155,86,9,33,61,40,57,65,44,41,28,135,
+88,94,104,32,39,144,61,10,156,146,252,104,255,255,0,0,254,240,5,125,4,250,
+2,38,2,27,0,0,0,7,0,64,3,130,0,122,255,255,0,0,254,240,3,105,4,250,2,38,2,
+28,0,0,0,7,0,64,3,130,0,122,255,255,0,0,253,220,5,190,4,250,2,38,0,31,0,0,
+0,7,0,81,4,136,0,0,255,255,0,0,253,220,6,209,4,250,2,38,0,31,0,0,0,39,0,64,
+4,246,0,0,0,7,0,81,5,155,0,0,255,255,0,0,252,218,5,185,4,250,2,38,0,31,0,
+0,0,7,2,157,4,181,0,0,255,255,0,0,252,218,5,185,4,250,2,38,0,31,0,0,0,39,
+2,157,4,231,0,0,0,7,0,64,3,44,0,153,0,2,0,95,0,0,7,131,5,14,0,64,0,65,0,0,
+1,33,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,34,6,21,20,22,23,7,
+38,38,53,52,54,51,50,22,22,21,21,33,17,33,53,33,21,33,17,54,54,51,50,22,21,
+20,6,7,39,54,54,53,52,38,35,34,7,17,35,17,4,67,254,100,54,45,48,116,81,63,
+61,60,39,76,58,55,58,106,107,15,168,168,143,118,116,145,62,1,156,254,245,
+4,75,253,101,51,118,73,137,164,69,64,148,52,64,80,72,109,117,165,1,255,74,
+60,68,83,127,50,43,45,216,123,113,54,52,43,62,59,5,146,14,134,120,110,120,
+99,161,140,237,1,215,146,146,254,98,50,54,177,151,104,213,94,85,66,173,83,
+95,94,149,253,242,4,250,0,255,255,0,95,255,201,7,131,5,14,2,38,2,35,0,0,0,
+7,0,64,4,166,1,83,0,1,0,95,0,0,6,58,5,14,0,54,0,0,1,33,21,20,6,35,34,38,38,
+53,52,54,51,51,53,52,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,
+22,21,21,33,17,33,53,33,21,33,17,54,51,51,21,35,34,6,7,17,35,4,67,254,100,
+54,45,48,116,81,63,61,60,39,76,58,55,58,106,107,15,168,168,143,118,116,145,
+62,1,156,254,245,2,230,254,202,102,135,101,75,94,109,60,165,1,255,74,60,68,
+83,127,50,43,45,216,123,113,54,52,43,62,59,5,146,14,134,120,110,120,99,161,
+140,237,1,215,146,146,254,68,70,146,41,51,253,252,0,255,255,0,95,255,201,
+6,58,5,14,2,38,2,37,0,0,0,7,0,64,4,166,1,83,0,2,0,95,255,206,7,131,5,14,0,
+68,0,69,0,0,1,33,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,34,6,21,
+20,22,23,7,38,38,53,52,54,51,50,22,22,21,21,33,17,33,53,33,21,33,17,54,54,
+51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,7,17,35,53,1,39,1,17,4,67,254,
+100,54,45,48,116,81,63,61,60,39,76,58,55,58,106,107,15,168,168,143,118,116,
+145,62,1,156,254,245,4,75,253,101,51,118,73,137,164,69,64,148,52,64,80,72,
+109,117,165,254,59,98,2,39,1,255,74,60,68,83,127,50,43,45,216,123,113,54,
+52,43,62,59,5,146,14,134,120,110,120,99,161,140,237,1,215,146,146,254,98,
+50,54,177,151,104,213,94,85,66,173,83,95,94,149,253,242,251,254,211,138,1,
+77,3,85,255,255,0,95,254,118,7,131,5,14,2,38,2,39,0,0,0,7,0,64,5,44,0,0,0,
+1,0,95,255,206,6,58,5,14,0,58,0,0,1,33,21,20,6,35,34,38,38,53,52,54,51,51,
+53,52,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,22,21,21,33,17,
+33,53,33,21,33,17,54,51,51,21,35,34,6,7,17,35,53,1,39,1,4,67,254,100,54,45,
+48,116,81,63,61,60,39,76,58,55,58,106,107,15,168,168,143,118,116,145,62,1,
+156,254,245,2,230,254,202,102,135,101,75,94,109,60,165,254,59,98,2,39,1,255,
+74,60,68,83,127,50,43,45,216,123,113,54,52,43,62,59,5,146,14,134,120,110,
+120,99,161,140,237,1,215,146,146,254,68,70,146,41,51,253,252,251,254,211,
+138,1,77,255,255,0,95,254,118,6,58,5,14,2,38,2,41,0,0,0,7,0,64,5,44,0,0,0,
+2,0,181,255,119,3,190,5,0,0,39,0,40,0,0,1,20,22,22,51,50,55,19,23,3,6,2,7,
+22,23,7,38,39,6,35,34,38,53,52,54,51,50,22,23,54,19,6,35,34,46,2,53,17,51,
+1,1,91,36,70,66,108,109,57,165,65,33,134,111,111,133,133,169,87,46,66,79,
+98,70,61,51,90,50,151,58,101,117,74,117,83,37,164,2,13,3,238,94,92,43,80,
+1,167,6,254,47,237,254,234,60,108,177,86,238,85,8,73,61,57,65,42,42,56,1,
+23,53,48,95,130,97,1,16,252,74,0,0,2,0,114,255,250,4,1,4,250,0,33,0,34,0,
+0,37,54,54,53,52,38,38,35,35,34,38,53,52,54,55,33,53,33,21,33,6,6,21,20,22,
+51,51,50,22,22,21,20,6,7,1,2,220,28,32,30,58,72,46,191,188,83,91,254,245,
+3,143,254,56,98,102,87,108,87,121,124,64,39,56,253,86,93,31,61,37,32,46,18,
+153,160,101,215,129,146,146,115,228,97,100,71,56,104,75,57,103,76,5,0,0,2,
+0,167,255,250,3,209,4,250,0,41,0,42,0,0,37,54,54,53,52,38,38,35,35,34,38,
+53,52,19,22,22,51,50,53,52,39,55,22,21,20,6,35,34,39,6,21,20,22,51,51,50,
+22,22,21,20,6,7,1,2,237,27,33,30,58,72,103,191,188,235,107,136,70,93,13,165,
+15,125,118,135,142,126,87,108,144,121,124,64,39,56,254,213,93,30,61,38,32,
+46,18,153,160,242,1,71,79,64,99,39,44,32,62,55,119,126,86,203,156,100,71,
+56,104,75,57,103,76,5,0,0,0,1,0,0,0,0,9,106,7,44,0,31,0,0,1,36,36,33,32,4,
+21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,32,12,2,23,8,156,
+254,221,253,81,254,121,254,227,254,235,36,25,226,213,165,182,164,25,30,88,
+170,245,158,1,30,1,232,1,152,1,74,128,4,235,206,223,113,132,49,87,33,146,
+251,152,4,104,146,46,97,67,86,131,89,46,88,155,211,123,0,1,0,0,0,0,4,145,
+7,44,0,31,0,0,1,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,30,2,23,35,38,
+38,35,34,6,21,20,22,23,51,2,48,213,165,182,169,29,31,52,98,140,88,118,196,
+166,140,62,164,108,239,148,113,124,37,24,226,4,104,251,152,4,104,146,56,112,
+64,73,122,87,48,73,146,216,142,219,211,111,97,63,99,45,0,0,1,0,0,0,0,4,248,
+7,44,0,31,0,0,1,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,30,2,23,35,38,
+36,35,34,6,21,20,22,23,51,2,48,213,165,182,168,28,31,56,104,148,93,128,218,
+188,159,69,166,127,254,233,163,125,139,37,25,225,4,104,251,152,4,104,146,
+53,108,63,75,125,89,49,77,147,215,138,217,213,115,100,63,95,42,0,1,0,0,0,
+0,5,161,7,44,0,32,0,0,1,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,30,2,
+23,35,0,33,34,14,2,21,20,22,23,51,2,48,213,165,182,164,25,30,62,113,161,99,
+145,255,224,192,81,171,254,197,254,137,71,114,80,42,39,23,225,4,104,251,152,
+4,104,146,47,100,62,79,131,92,51,82,150,213,132,1,173,32,58,83,52,61,93,35,
+0,1,0,0,0,0,6,13,7,44,0,33,0,0,1,38,36,35,34,14,2,21,20,22,23,51,21,35,17,
+35,17,35,53,51,38,38,53,52,62,2,51,50,4,22,22,23,5,94,174,254,129,209,79,
+124,86,46,38,24,225,213,165,182,164,25,30,65,119,170,105,160,1,25,244,209,
+87,4,235,214,215,31,59,85,54,60,90,35,146,251,152,4,104,146,46,99,62,81,131,
+93,50,83,152,212,130,0,0,1,0,0,0,0,6,120,7,44,0,33,0,0,1,38,36,35,34,14,2,
+21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,4,4,22,23,5,
+198,189,254,91,232,86,135,93,49,37,24,226,213,165,182,164,25,30,68,126,179,
+112,175,1,51,1,8,224,92,4,235,213,216,31,59,86,55,58,91,34,146,251,152,4,
+104,146,46,99,63,81,131,92,50,84,151,213,129,0,1,0,0,0,0,6,228,7,44,0,31,
+0,0,1,38,36,35,34,6,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,
+2,51,50,4,4,22,23,6,45,203,254,54,255,190,202,37,24,226,213,165,182,164,25,
+30,70,132,189,119,191,1,77,1,29,239,97,4,235,212,217,119,114,57,90,34,146,
+251,152,4,104,146,46,99,63,82,131,92,49,84,152,213,128,0,0,1,0,0,0,0,7,80,
+7,44,0,31,0,0,1,38,36,33,34,6,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,
+53,52,62,2,51,50,4,4,22,23,6,149,218,254,16,254,234,206,214,37,24,226,213,
+165,182,164,25,30,74,138,198,125,207,1,103,1,50,254,102,4,235,211,218,118,
+117,56,89,34,146,251,152,4,104,146,46,99,63,82,132,91,49,85,153,212,127,0,
+1,0,0,0,0,7,187,7,44,0,31,0,0,1,38,36,33,34,6,21,20,22,23,51,21,35,17,35,
+17,35,53,51,38,38,53,52,62,2,51,50,12,2,23,6,253,232,253,232,254,212,222,
+226,36,25,226,213,165,182,164,25,30,77,144,208,131,223,1,128,1,71,1,13,107,
+4,235,209,220,117,120,54,89,34,146,251,152,4,104,146,46,98,65,83,131,91,48,
+86,153,212,126,0,1,0,0,0,0,8,39,7,44,0,31,0,0,1,38,36,33,34,6,21,20,22,23,
+51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,12,2,23,7,101,248,253,197,
+254,188,238,239,36,25,226,213,165,182,164,25,30,80,150,217,138,239,1,155,
+1,90,1,28,113,4,235,210,219,115,124,53,88,34,146,251,152,4,104,146,46,98,
+65,84,131,91,47,86,154,211,126,0,1,0,0,0,0,8,147,7,44,0,31,0,0,1,36,36,33,
+34,6,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,12,2,23,
+7,204,254,251,253,157,254,166,253,252,36,25,226,213,165,182,164,25,30,82,
+157,227,145,254,1,180,1,112,1,43,118,4,235,208,221,115,126,51,88,34,146,251,
+152,4,104,146,46,97,66,85,131,90,47,87,154,211,125,0,0,1,0,0,0,0,8,254,7,
+44,0,31,0,0,1,36,36,33,32,4,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,
+53,52,62,2,51,32,12,2,23,8,52,254,236,253,119,254,144,254,243,254,247,36,
+25,226,213,165,182,164,25,30,85,163,237,151,1,14,1,207,1,131,1,58,123,4,235,
+207,222,114,129,50,88,33,146,251,152,4,104,146,46,98,66,85,131,90,46,88,154,
+211,124,255,255,0,0,0,0,9,122,7,44,2,38,2,46,0,0,0,7,0,6,10,19,0,90,255,255,
+0,0,0,0,5,40,7,44,2,38,2,47,0,0,0,7,0,6,5,193,0,90,255,255,0,0,0,0,5,120,
+7,44,2,38,2,48,0,0,0,7,0,6,6,17,0,90,255,255,0,0,0,0,6,3,7,44,2,38,2,49,0,
+0,0,7,0,6,6,156,0,90,255,255,0,0,0,0,6,101,7,44,2,38,2,50,0,0,0,7,0,6,6,254,
+0,90,255,255,0,0,0,0,6,215,7,44,2,38,2,51,0,0,0,7,0,6,7,112,0,90,255,255,
+0,0,0,0,7,39,7,44,2,38,2,52,0,0,0,7,0,6,7,192,0,90,255,255,0,0,0,0,7,122,
+7,44,2,38,2,53,0,0,0,7,0,6,8,19,0,90,255,255,0,0,0,0,7,214,7,44,2,38,2,54,
+0,0,0,7,0,6,8,111,0,90,255,255,0,0,0,0,8,67,7,44,2,38,2,55,0,0,0,7,0,6,8,
+220,0,90,255,255,0,0,0,0,8,165,7,44,2,38,2,56,0,0,0,7,0,6,9,62,0,90,255,255,
+0,0,0,0,9,16,7,44,2,38,2,57,0,0,0,7,0,6,9,169,0,90,0,1,0,0,0,0,10,88,7,44,
+0,51,0,0,1,36,36,33,32,4,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,
+52,62,2,51,50,12,2,23,38,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,
+23,8,156,254,221,253,81,254,121,254,227,254,235,36,25,226,213,165,182,164,
+25,30,88,170,245,158,216,1,127,1,81,1,36,124,8,48,85,115,68,68,108,42,45,
+35,77,45,84,85,55,51,4,235,206,223,113,132,49,87,33,146,251,152,4,104,146,
+46,97,67,86,131,89,46,51,92,129,79,40,35,68,104,69,35,29,22,135,20,24,91,
+74,68,127,75,0,1,0,0,0,0,5,165,7,44,0,45,0,0,1,35,17,35,17,35,53,51,38,38,
+53,52,62,2,51,50,22,23,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,35,38,
+38,35,34,6,21,20,22,23,51,2,48,213,165,182,169,29,31,52,98,140,88,135,217,
+91,26,158,113,68,108,42,45,35,77,45,84,85,55,51,175,108,239,148,113,124,37,
+24,226,4,104,251,152,4,104,146,56,112,64,73,122,87,48,96,95,95,96,29,22,135,
+20,24,91,74,68,127,75,219,211,111,97,63,99,45,0,1,0,0,0,0,6,10,7,44,0,47,
+0,0,1,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,22,23,62,3,51,50,22,23,
+7,38,38,35,34,6,21,20,22,23,35,38,36,35,34,6,21,20,22,23,51,2,48,213,165,
+182,168,28,31,56,104,148,93,154,251,106,10,54,80,103,60,68,108,42,45,35,77,
+45,84,85,55,51,175,127,254,233,163,125,139,37,25,225,4,104,251,152,4,104,
+146,53,108,63,75,125,89,49,109,105,53,80,54,27,29,22,135,20,24,91,74,68,127,
+75,217,213,115,100,63,95,42,0,0,1,0,0,0,0,6,174,7,44,0,48,0,0,1,35,17,35,
+17,35,53,51,38,38,53,52,62,2,51,50,4,23,62,3,51,50,22,23,7,38,38,35,34,6,
+21,20,22,23,35,0,33,34,14,2,21,20,22,23,51,2,48,213,165,182,164,25,30,62,
+113,161,99,188,1,59,134,3,49,83,111,65,68,108,42,45,35,77,45,84,85,55,51,
+175,254,197,254,137,71,114,80,42,39,23,225,4,104,251,152,4,104,146,47,100,
+62,79,131,92,51,135,122,63,97,64,33,29,22,135,20,24,91,74,68,127,75,1,173,
+32,58,83,52,61,93,35,0,1,0,0,0,0,7,22,7,44,0,49,0,0,1,38,36,35,34,14,2,21,
+20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,4,23,62,3,51,50,
+22,23,7,38,38,35,34,6,21,20,22,23,5,94,174,254,129,209,79,124,86,46,38,24,
+225,213,165,182,164,25,30,65,119,170,105,212,1,100,147,1,47,84,114,67,68,
+108,42,45,35,77,45,84,85,55,51,4,235,214,215,31,59,85,54,60,90,35,146,251,
+152,4,104,146,46,99,62,81,131,93,50,144,127,67,101,68,35,29,22,135,20,24,
+91,74,68,127,75,0,0,1,0,0,0,0,7,126,7,44,0,52,0,0,1,38,36,35,34,14,2,21,20,
+22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,30,2,23,53,52,62,
+2,51,50,22,23,7,38,38,35,34,6,21,20,22,23,5,198,189,254,91,232,86,135,93,
+49,37,24,226,213,165,182,164,25,30,68,126,179,112,118,217,197,178,80,48,85,
+115,68,68,108,42,45,35,77,45,84,85,55,51,4,235,213,216,31,59,86,55,58,91,
+34,146,251,152,4,104,146,46,99,63,81,131,92,50,39,73,104,66,6,68,104,69,35,
+29,22,135,20,24,91,74,68,127,75,0,0,1,0,0,0,0,7,230,7,44,0,50,0,0,1,38,36,
+35,34,6,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,30,
+2,23,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,23,6,45,203,254,54,255,
+190,202,37,24,226,213,165,182,164,25,30,70,132,189,119,132,239,217,195,86,
+48,85,115,68,68,108,42,45,35,77,45,84,85,55,51,4,235,212,217,119,114,57,90,
+34,146,251,152,4,104,146,46,99,63,82,131,92,49,41,76,108,68,17,68,104,69,
+35,29,22,135,20,24,91,74,68,127,75,0,1,0,0,0,0,8,78,7,44,0,52,0,0,1,38,36,
+33,34,6,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,4,22,
+22,23,38,52,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,23,6,149,218,
+254,16,254,234,206,214,37,24,226,213,165,182,164,25,30,74,138,198,125,145,
+1,7,237,211,93,1,48,85,115,68,68,108,42,45,35,77,45,84,85,55,51,4,235,211,
+218,118,117,56,89,34,146,251,152,4,104,146,46,99,63,82,132,91,49,43,79,113,
+70,8,13,8,68,104,69,35,29,22,135,20,24,91,74,68,127,75,0,1,0,0,0,0,8,182,
+7,44,0,52,0,0,1,38,36,33,34,6,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,
+53,52,62,2,51,50,4,4,22,23,38,52,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,
+20,22,23,6,253,232,253,232,254,212,222,226,36,25,226,213,165,182,164,25,30,
+77,144,208,131,159,1,31,1,0,228,99,2,48,85,115,68,68,108,42,45,35,77,45,84,
+85,55,51,4,235,209,220,117,120,54,89,34,146,251,152,4,104,146,46,98,65,83,
+131,91,48,44,82,117,72,10,19,10,68,104,69,35,29,22,135,20,24,91,74,68,127,
+75,0,0,1,0,0,0,0,9,30,7,44,0,51,0,0,1,38,36,33,34,6,21,20,22,23,51,21,35,
+17,35,17,35,53,51,38,38,53,52,62,2,51,50,4,4,22,23,38,53,52,62,2,51,50,22,
+23,7,38,38,35,34,6,21,20,22,23,7,101,248,253,197,254,188,238,239,36,25,226,
+213,165,182,164,25,30,80,150,217,138,173,1,55,1,20,244,105,3,48,85,115,68,
+68,108,42,45,35,77,45,84,85,55,51,4,235,210,219,115,124,53,88,34,146,251,
+152,4,104,146,46,98,65,84,131,91,47,46,85,120,74,24,25,68,104,69,35,29,22,
+135,20,24,91,74,68,127,75,0,0,1,0,0,0,0,9,134,7,44,0,52,0,0,1,36,36,33,34,
+6,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,12,2,23,38,
+38,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,23,7,204,254,251,253,157,
+254,166,253,252,36,25,226,213,165,182,164,25,30,82,157,227,145,187,1,78,1,
+41,1,3,111,2,2,48,85,115,68,68,108,42,45,35,77,45,84,85,55,51,4,235,208,221,
+115,126,51,88,34,146,251,152,4,104,146,46,97,66,85,131,90,47,48,87,123,76,
+15,29,14,68,104,69,35,29,22,135,20,24,91,74,68,127,75,0,0,1,0,0,0,0,9,238,
+7,44,0,51,0,0,1,36,36,33,32,4,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,
+53,52,62,2,51,50,12,2,23,38,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,
+22,23,8,52,254,236,253,119,254,144,254,243,254,247,36,25,226,213,165,182,
+164,25,30,85,163,237,151,201,1,102,1,61,1,19,118,6,48,85,115,68,68,108,42,
+45,35,77,45,84,85,55,51,4,235,207,222,114,129,50,88,33,146,251,152,4,104,
+146,46,98,66,85,131,90,46,49,90,126,77,33,33,68,104,69,35,29,22,135,20,24,
+91,74,68,127,75,0,2,0,0,0,0,10,88,7,44,0,51,0,71,0,0,1,36,36,33,32,4,21,20,
+22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,12,2,23,38,53,52,
+62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,23,39,52,62,2,51,50,30,2,21,20,
+14,2,35,34,46,2,8,156,254,221,253,81,254,121,254,227,254,235,36,25,226,213,
+165,182,164,25,30,88,170,245,158,216,1,127,1,81,1,36,124,8,48,85,115,68,68,
+108,42,45,35,77,45,84,85,55,51,2,16,28,37,21,21,37,28,16,16,28,37,21,21,37,
+28,16,4,235,206,223,113,132,49,87,33,146,251,152,4,104,146,46,97,67,86,131,
+89,46,51,92,129,79,40,35,68,104,69,35,29,22,135,20,24,91,74,68,127,75,224,
+21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,0,2,0,0,0,0,5,165,7,44,0,45,
+0,65,0,0,1,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,22,23,54,54,51,50,
+22,23,7,38,38,35,34,6,21,20,22,23,35,38,38,35,34,6,21,20,22,23,51,37,52,62,
+2,51,50,30,2,21,20,14,2,35,34,46,2,2,48,213,165,182,169,29,31,52,98,140,88,
+135,217,91,26,158,113,68,108,42,45,35,77,45,84,85,55,51,175,108,239,148,113,
+124,37,24,226,2,106,16,28,37,21,21,37,28,16,16,28,37,21,21,37,28,16,4,104,
+251,152,4,104,146,56,112,64,73,122,87,48,96,95,95,96,29,22,135,20,24,91,74,
+68,127,75,219,211,111,97,63,99,45,209,21,38,27,16,16,27,38,21,21,38,27,16,
+16,27,38,0,2,0,0,0,0,6,10,7,44,0,47,0,67,0,0,1,35,17,35,17,35,53,51,38,38,
+53,52,62,2,51,50,22,23,62,3,51,50,22,23,7,38,38,35,34,6,21,20,22,23,35,38,
+36,35,34,6,21,20,22,23,51,37,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,2,48,
+213,165,182,168,28,31,56,104,148,93,154,251,106,10,54,80,103,60,68,108,42,
+45,35,77,45,84,85,55,51,175,127,254,233,163,125,139,37,25,225,2,207,16,28,
+37,21,21,37,28,16,16,28,37,21,21,37,28,16,4,104,251,152,4,104,146,53,108,
+63,75,125,89,49,109,105,53,80,54,27,29,22,135,20,24,91,74,68,127,75,217,213,
+115,100,63,95,42,209,21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,0,2,0,
+0,0,0,6,174,7,44,0,48,0,68,0,0,1,35,17,35,17,35,53,51,38,38,53,52,62,2,51,
+50,4,23,62,3,51,50,22,23,7,38,38,35,34,6,21,20,22,23,35,0,33,34,14,2,21,20,
+22,23,51,37,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,2,48,213,165,182,164,
+25,30,62,113,161,99,188,1,59,134,3,49,83,111,65,68,108,42,45,35,77,45,84,
+85,55,51,175,254,197,254,137,71,114,80,42,39,23,225,3,115,16,28,37,21,21,
+37,28,16,16,28,37,21,21,37,28,16,4,104,251,152,4,104,146,47,100,62,79,131,
+92,51,135,122,63,97,64,33,29,22,135,20,24,91,74,68,127,75,1,173,32,58,83,
+52,61,93,35,209,21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,2,0,0,0,0,
+7,22,7,44,0,49,0,69,0,0,1,38,36,35,34,14,2,21,20,22,23,51,21,35,17,35,17,
+35,53,51,38,38,53,52,62,2,51,50,4,23,62,3,51,50,22,23,7,38,38,35,34,6,21,
+20,22,23,39,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,5,94,174,254,129,209,
+79,124,86,46,38,24,225,213,165,182,164,25,30,65,119,170,105,212,1,100,147,
+1,47,84,114,67,68,108,42,45,35,77,45,84,85,55,51,2,16,28,37,21,21,37,28,16,
+16,28,37,21,21,37,28,16,4,235,214,215,31,59,85,54,60,90,35,146,251,152,4,
+104,146,46,99,62,81,131,93,50,144,127,67,101,68,35,29,22,135,20,24,91,74,
+68,127,75,224,21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,2,0,0,0,0,7,
+126,7,44,0,52,0,72,0,0,1,38,36,35,34,14,2,21,20,22,23,51,21,35,17,35,17,35,
+53,51,38,38,53,52,62,2,51,50,30,2,23,53,52,62,2,51,50,22,23,7,38,38,35,34,
+6,21,20,22,23,39,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,5,198,189,254,91,
+232,86,135,93,49,37,24,226,213,165,182,164,25,30,68,126,179,112,118,217,197,
+178,80,48,85,115,68,68,108,42,45,35,77,45,84,85,55,51,2,16,28,37,21,21,37,
+28,16,16,28,37,21,21,37,28,16,4,235,213,216,31,59,86,55,58,91,34,146,251,
+152,4,104,146,46,99,63,81,131,92,50,39,73,104,66,6,68,104,69,35,29,22,135,
+20,24,91,74,68,127,75,224,21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,
+2,0,0,0,0,7,230,7,44,0,50,0,70,0,0,1,38,36,35,34,6,21,20,22,23,51,21,35,17,
+35,17,35,53,51,38,38,53,52,62,2,51,50,30,2,23,53,52,62,2,51,50,22,23,7,38,
+38,35,34,6,21,20,22,23,39,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,6,45,203,
+254,54,255,190,202,37,24,226,213,165,182,164,25,30,70,132,189,119,132,239,
+217,195,86,48,85,115,68,68,108,42,45,35,77,45,84,85,55,51,2,16,28,37,21,21,
+37,28,16,16,28,37,21,21,37,28,16,4,235,212,217,119,114,57,90,34,146,251,152,
+4,104,146,46,99,63,82,131,92,49,41,76,108,68,17,68,104,69,35,29,22,135,20,
+24,91,74,68,127,75,224,21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,0,2,
+0,0,0,0,8,78,7,44,0,52,0,72,0,0,1,38,36,33,34,6,21,20,22,23,51,21,35,17,35,
+17,35,53,51,38,38,53,52,62,2,51,50,4,22,22,23,38,52,53,52,62,2,51,50,22,23,
+7,38,38,35,34,6,21,20,22,23,39,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,6,
+149,218,254,16,254,234,206,214,37,24,226,213,165,182,164,25,30,74,138,198,
+125,145,1,7,237,211,93,1,48,85,115,68,68,108,42,45,35,77,45,84,85,55,51,2,
+16,28,37,21,21,37,28,16,16,28,37,21,21,37,28,16,4,235,211,218,118,117,56,
+89,34,146,251,152,4,104,146,46,99,63,82,132,91,49,43,79,113,70,8,13,8,68,
+104,69,35,29,22,135,20,24,91,74,68,127,75,224,21,38,27,16,16,27,38,21,21,
+38,27,16,16,27,38,0,0,2,0,0,0,0,8,182,7,44,0,52,0,72,0,0,1,38,36,33,34,6,
+21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,4,4,22,23,38,
+52,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,23,39,52,62,2,51,50,30,
+2,21,20,14,2,35,34,46,2,6,253,232,253,232,254,212,222,226,36,25,226,213,165,
+182,164,25,30,77,144,208,131,159,1,31,1,0,228,99,2,48,85,115,68,68,108,42,
+45,35,77,45,84,85,55,51,2,16,28,37,21,21,37,28,16,16,28,37,21,21,37,28,16,
+4,235,209,220,117,120,54,89,34,146,251,152,4,104,146,46,98,65,83,131,91,48,
+44,82,117,72,10,19,10,68,104,69,35,29,22,135,20,24,91,74,68,127,75,224,21,
+38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,2,0,0,0,0,9,30,7,44,0,51,0,71,
+0,0,1,38,36,33,34,6,21,20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,
+2,51,50,4,4,22,23,38,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,23,39,
+52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,7,101,248,253,197,254,188,238,239,
+36,25,226,213,165,182,164,25,30,80,150,217,138,173,1,55,1,20,244,105,3,48,
+85,115,68,68,108,42,45,35,77,45,84,85,55,51,2,16,28,37,21,21,37,28,16,16,
+28,37,21,21,37,28,16,4,235,210,219,115,124,53,88,34,146,251,152,4,104,146,
+46,98,65,84,131,91,47,46,85,120,74,24,25,68,104,69,35,29,22,135,20,24,91,
+74,68,127,75,224,21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,2,0,0,0,0,
+9,134,7,44,0,52,0,72,0,0,1,36,36,33,34,6,21,20,22,23,51,21,35,17,35,17,35,
+53,51,38,38,53,52,62,2,51,50,12,2,23,38,38,53,52,62,2,51,50,22,23,7,38,38,
+35,34,6,21,20,22,23,39,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,7,204,254,
+251,253,157,254,166,253,252,36,25,226,213,165,182,164,25,30,82,157,227,145,
+187,1,78,1,41,1,3,111,2,2,48,85,115,68,68,108,42,45,35,77,45,84,85,55,51,
+2,16,28,37,21,21,37,28,16,16,28,37,21,21,37,28,16,4,235,208,221,115,126,51,
+88,34,146,251,152,4,104,146,46,97,66,85,131,90,47,48,87,123,76,15,29,14,68,
+104,69,35,29,22,135,20,24,91,74,68,127,75,224,21,38,27,16,16,27,38,21,21,
+38,27,16,16,27,38,0,2,0,0,0,0,9,238,7,44,0,51,0,71,0,0,1,36,36,33,32,4,21,
+20,22,23,51,21,35,17,35,17,35,53,51,38,38,53,52,62,2,51,50,12,2,23,38,53,
+52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,23,39,52,62,2,51,50,30,2,21,
+20,14,2,35,34,46,2,8,52,254,236,253,119,254,144,254,243,254,247,36,25,226,
+213,165,182,164,25,30,85,163,237,151,201,1,102,1,61,1,19,118,6,48,85,115,
+68,68,108,42,45,35,77,45,84,85,55,51,2,16,28,37,21,21,37,28,16,16,28,37,21,
+21,37,28,16,4,235,207,222,114,129,50,88,33,146,251,152,4,104,146,46,98,66,
+85,131,90,46,49,90,126,77,33,33,68,104,69,35,29,22,135,20,24,91,74,68,127,
+75,224,21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,0,0,1,253,208,0,0,2,48,
+7,44,0,33,0,0,1,35,17,35,17,35,53,51,46,3,35,34,6,21,20,22,23,35,38,38,53,
+52,62,2,51,50,30,2,23,51,2,48,213,165,182,176,39,80,90,103,63,96,101,40,29,
+163,35,35,47,89,129,82,100,160,131,108,49,225,4,104,251,152,4,104,146,107,
+157,102,50,106,91,68,111,55,66,127,69,69,116,84,46,67,138,212,145,0,0,1,253,
+96,0,0,2,48,7,44,0,33,0,0,1,35,17,35,17,35,53,51,46,3,35,34,6,21,20,22,23,
+35,38,38,53,52,62,2,51,50,30,2,23,51,2,48,213,165,182,173,49,102,111,123,
+70,109,117,42,28,166,33,35,51,96,137,86,112,184,154,130,58,224,4,104,251,
+152,4,104,146,106,156,103,50,110,94,68,108,50,63,121,68,72,120,85,48,70,141,
+210,141,0,0,1,252,127,0,0,2,48,7,44,0,34,0,0,1,35,17,35,17,35,53,51,0,33,
+34,14,2,21,20,30,2,23,35,38,38,53,52,62,2,51,50,30,2,23,51,2,48,213,165,182,
+167,254,237,254,171,66,105,74,39,13,20,26,13,170,30,36,59,108,154,96,134,
+233,202,173,75,223,4,104,251,152,4,104,146,1,158,31,57,81,50,34,59,51,46,
+20,54,111,67,77,127,91,50,77,145,208,132,0,255,255,253,208,0,0,2,48,7,44,
+2,38,2,95,0,0,0,7,0,6,2,152,0,90,255,255,253,96,0,0,2,48,7,44,2,38,2,96,0,
+0,0,7,0,6,2,139,0,90,255,255,252,127,0,0,2,48,7,44,2,38,2,97,0,0,0,7,0,6,
+2,111,0,90,0,1,253,208,0,0,2,111,7,44,0,50,0,0,1,35,17,35,17,35,53,51,46,
+3,35,34,6,21,20,22,23,35,38,38,53,52,62,2,51,50,22,23,54,54,51,50,22,23,7,
+38,38,35,34,6,21,20,22,23,22,22,23,51,2,48,213,165,182,176,39,80,90,103,63,
+96,101,40,29,163,35,35,47,89,129,82,107,164,68,35,146,98,68,108,42,45,35,
+77,45,84,85,2,2,20,40,19,225,4,104,251,152,4,104,146,107,157,102,50,106,91,
+68,111,55,66,127,69,69,116,84,46,74,77,75,76,29,22,135,20,24,91,74,14,27,
+14,45,99,56,0,0,1,253,96,0,0,2,111,7,44,0,48,0,0,1,35,17,35,17,35,53,51,46,
+3,35,34,6,21,20,22,23,35,38,38,53,52,62,2,51,50,22,23,54,54,51,50,22,23,7,
+38,38,35,34,6,21,20,23,22,23,51,2,48,213,165,182,173,49,102,111,123,70,109,
+117,42,28,166,33,35,51,96,137,86,128,200,84,29,157,109,68,108,42,45,35,77,
+45,84,85,27,28,29,224,4,104,251,152,4,104,146,106,156,103,50,110,94,68,108,
+50,63,121,68,72,120,85,48,89,91,90,90,29,22,135,20,24,91,74,65,64,59,67,0,
+0,1,252,127,0,0,2,111,7,44,0,50,0,0,1,35,17,35,17,35,53,51,0,33,34,14,2,21,
+20,30,2,23,35,38,38,53,52,62,2,51,50,4,23,62,3,51,50,22,23,7,38,38,35,34,
+6,21,20,22,23,51,2,48,213,165,182,167,254,237,254,171,66,105,74,39,13,20,
+26,13,170,30,36,59,108,154,96,172,1,28,119,6,52,82,107,63,68,108,42,45,35,
+77,45,84,85,50,45,213,4,104,251,152,4,104,146,1,158,31,57,81,50,34,59,51,
+46,20,54,111,67,77,127,91,50,124,115,59,90,60,30,29,22,135,20,24,91,74,65,
+121,69,0,0,2,253,208,0,0,2,111,7,44,0,50,0,70,0,0,1,35,17,35,17,35,53,51,
+46,3,35,34,6,21,20,22,23,35,38,38,53,52,62,2,51,50,22,23,54,54,51,50,22,23,
+7,38,38,35,34,6,21,20,22,23,22,22,23,51,39,52,62,2,51,50,30,2,21,20,14,2,
+35,34,46,2,2,48,213,165,182,176,39,80,90,103,63,96,101,40,29,163,35,35,47,
+89,129,82,107,164,68,35,146,98,68,108,42,45,35,77,45,84,85,2,2,20,40,19,225,
+204,16,28,37,21,21,37,28,16,16,28,37,21,21,37,28,16,4,104,251,152,4,104,146,
+107,157,102,50,106,91,68,111,55,66,127,69,69,116,84,46,74,77,75,76,29,22,
+135,20,24,91,74,14,27,14,45,99,56,209,21,38,27,16,16,27,38,21,21,38,27,16,
+16,27,38,0,2,253,96,0,0,2,111,7,44,0,48,0,68,0,0,1,35,17,35,17,35,53,51,46,
+3,35,34,6,21,20,22,23,35,38,38,53,52,62,2,51,50,22,23,54,54,51,50,22,23,7,
+38,38,35,34,6,21,20,23,22,23,51,39,52,62,2,51,50,30,2,21,20,14,2,35,34,46,
+2,2,48,213,165,182,173,49,102,111,123,70,109,117,42,28,166,33,35,51,96,137,
+86,128,200,84,29,157,109,68,108,42,45,35,77,45,84,85,27,28,29,224,204,16,
+28,37,21,21,37,28,16,16,28,37,21,21,37,28,16,4,104,251,152,4,104,146,106,
+156,103,50,110,94,68,108,50,63,121,68,72,120,85,48,89,91,90,90,29,22,135,
+20,24,91,74,65,64,59,67,209,21,38,27,16,16,27,38,21,21,38,27,16,16,27,38,
+0,2,252,127,0,0,2,111,7,44,0,50,0,70,0,0,1,35,17,35,17,35,53,51,0,33,34,14,
+2,21,20,30,2,23,35,38,38,53,52,62,2,51,50,4,23,62,3,51,50,22,23,7,38,38,35,
+34,6,21,20,22,23,51,39,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,2,48,213,
+165,182,167,254,237,254,171,66,105,74,39,13,20,26,13,170,30,36,59,108,154,
+96,172,1,28,119,6,52,82,107,63,68,108,42,45,35,77,45,84,85,50,45,213,204,
+16,28,37,21,21,37,28,16,16,28,37,21,21,37,28,16,4,104,251,152,4,104,146,1,
+158,31,57,81,50,34,59,51,46,20,54,111,67,77,127,91,50,124,115,59,90,60,30,
+29,22,135,20,24,91,74,65,121,69,209,21,38,27,16,16,27,38,21,21,38,27,16,16,
+27,38,0,3,251,188,253,220,0,46,0,22,0,28,0,44,0,45,0,0,5,54,54,51,50,22,22,
+21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,34,7,5,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,37,254,66,47,107,51,89,129,69,75,145,99,115,
+188,153,76,126,72,116,128,81,83,94,78,68,74,69,253,183,30,51,32,33,51,29,
+30,51,32,31,52,2,149,14,18,18,72,131,84,83,129,71,83,148,113,88,110,119,57,
+80,73,62,69,29,9,31,56,32,33,56,30,31,55,33,32,56,31,156,0,0,3,251,188,253,
+220,0,46,0,22,0,28,0,44,0,45,0,0,5,54,54,51,50,22,22,21,20,6,6,35,34,38,38,
+39,55,30,2,51,50,54,53,52,38,35,34,7,5,50,22,22,21,20,6,6,35,34,38,38,53,
+52,54,54,37,254,66,47,107,51,89,129,69,75,145,99,115,188,153,76,126,72,116,
+128,81,83,94,78,68,74,69,253,183,30,51,32,33,51,29,30,51,32,31,52,2,19,14,
+18,18,72,131,84,83,129,71,83,148,113,88,110,119,57,80,73,62,69,29,9,31,56,
+32,33,56,30,31,55,33,32,56,31,156,0,0,2,252,219,253,220,0,46,0,22,0,28,0,
+29,0,0,5,54,54,51,50,22,22,21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,
+38,35,34,7,55,254,66,47,107,51,89,129,69,75,145,99,115,188,153,76,126,72,
+116,128,81,83,94,78,68,74,69,46,14,18,18,72,131,84,83,129,71,83,148,113,88,
+110,119,57,80,73,62,69,29,147,0,3,252,2,253,220,1,40,0,22,0,31,0,47,0,48,
+0,0,3,6,35,34,38,38,53,52,54,54,51,50,30,2,23,7,46,2,35,34,6,21,20,30,2,51,
+50,54,55,37,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,37,128,113,113,101,
+148,78,85,160,105,97,168,141,138,83,125,80,146,167,98,101,109,28,46,60,31,
+46,84,55,253,39,30,51,32,33,51,29,30,51,32,31,52,2,79,254,11,47,72,132,85,
+77,129,75,50,90,143,126,80,120,150,80,78,68,39,53,33,14,18,26,202,31,56,32,
+33,56,30,31,55,33,32,56,31,156,0,3,252,2,253,220,1,40,0,22,0,31,0,47,0,48,
+0,0,3,6,35,34,38,38,53,52,54,54,51,50,30,2,23,7,46,2,35,34,6,21,20,30,2,51,
+50,54,55,37,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,37,128,113,113,101,
+148,78,85,160,105,97,168,141,138,83,125,80,146,167,98,101,109,28,46,60,31,
+46,84,55,253,39,30,51,32,33,51,29,30,51,32,31,52,1,205,254,11,47,72,132,85,
+77,129,75,50,90,143,126,80,120,150,80,78,68,39,53,33,14,18,26,202,31,56,32,
+33,56,30,31,55,33,32,56,31,156,0,3,252,122,253,220,0,56,0,36,0,23,0,39,0,
+40,0,0,19,6,6,35,34,38,38,53,52,54,54,55,23,6,6,21,20,30,2,51,50,54,55,37,
+50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,37,56,72,133,68,101,148,78,81,
+165,115,15,114,111,28,46,59,32,57,94,81,252,231,30,51,32,33,51,29,30,51,32,
+31,52,1,215,254,34,36,34,72,132,85,77,129,83,6,135,12,87,72,35,50,33,15,25,
+42,180,31,56,32,33,56,30,31,55,33,32,56,31,156,0,3,252,122,253,220,0,56,0,
+36,0,23,0,39,0,40,0,0,19,6,6,35,34,38,38,53,52,54,54,55,23,6,6,21,20,30,2,
+51,50,54,55,37,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,37,56,72,133,68,
+101,148,78,81,165,115,15,114,111,28,46,59,32,57,94,81,252,231,30,51,32,33,
+51,29,30,51,32,31,52,1,85,254,34,36,34,72,132,85,77,129,83,6,135,12,87,72,
+35,50,33,15,25,42,180,31,56,32,33,56,30,31,55,33,32,56,31,156,0,3,252,122,
+252,218,0,136,0,36,0,40,0,56,0,57,0,0,19,6,6,35,34,38,38,53,52,55,38,38,53,
+52,54,54,55,23,6,6,21,20,22,51,50,54,55,23,6,6,35,34,39,6,21,20,22,51,50,
+54,55,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,37,136,72,133,68,106,148,
+73,32,54,58,82,165,114,15,111,114,86,80,57,93,82,51,72,133,68,36,33,27,85,
+81,57,93,82,252,150,30,51,32,33,51,29,30,51,32,31,52,1,215,253,32,36,34,70,
+121,78,58,50,37,108,65,66,112,72,5,135,9,72,56,53,57,22,35,129,36,34,5,31,
+40,54,56,22,35,1,195,31,56,32,33,56,30,31,55,33,32,56,31,156,0,0,3,252,122,
+252,218,0,136,0,36,0,40,0,56,0,57,0,0,19,6,6,35,34,38,38,53,52,55,38,38,53,
+52,54,54,55,23,6,6,21,20,22,51,50,54,55,23,6,6,35,34,39,6,21,20,22,51,50,
+54,55,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,37,136,72,133,68,106,148,
+73,32,54,58,82,165,114,15,111,114,86,80,57,93,82,51,72,133,68,36,33,27,85,
+81,57,93,82,252,150,30,51,32,33,51,29,30,51,32,31,52,1,85,253,32,36,34,70,
+121,78,58,50,37,108,65,66,112,72,5,135,9,72,56,53,57,22,35,129,36,34,5,31,
+40,54,56,22,35,1,195,31,56,32,33,56,30,31,55,33,32,56,31,156,0,0,3,252,69,
+252,218,0,93,0,1,0,77,0,78,0,79,0,0,19,6,6,35,34,46,2,53,52,62,2,55,54,54,
+53,52,38,35,34,14,2,7,39,54,54,55,38,38,35,34,6,21,20,30,2,23,7,46,3,53,52,
+62,2,51,50,22,23,54,54,51,50,30,2,21,20,6,7,6,6,21,20,30,2,51,50,62,2,55,
+1,1,93,42,108,66,61,96,66,35,28,58,92,64,11,12,65,54,28,57,54,49,20,142,11,
+26,17,34,71,44,63,64,37,71,104,67,95,70,121,90,51,47,74,91,44,72,119,56,48,
+119,71,40,87,72,47,33,29,116,98,21,34,44,24,24,41,40,42,27,253,237,1,233,
+253,16,21,33,34,61,85,51,42,73,61,46,14,22,47,28,59,55,19,51,90,70,37,37,
+67,29,25,30,68,54,43,78,81,90,54,102,60,112,111,115,64,64,91,59,28,46,44,
+44,46,26,56,91,64,60,109,47,13,65,52,24,36,22,11,6,12,19,14,2,112,254,42,
+0,0,4,251,48,252,218,0,143,0,1,0,77,0,93,0,94,0,95,0,0,19,6,6,35,34,46,2,
+53,52,62,2,55,54,54,53,52,38,35,34,14,2,7,39,54,54,55,38,38,35,34,6,21,20,
+30,2,23,7,46,3,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,6,7,6,6,21,20,
+30,2,51,50,62,2,55,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,37,1,143,
+42,108,66,61,96,66,35,28,58,92,64,11,12,65,54,28,57,54,49,20,142,11,26,17,
+34,71,44,63,64,37,71,104,67,95,70,121,90,51,47,74,91,44,72,119,56,48,119,
+71,40,87,72,47,33,29,116,98,21,34,44,24,24,41,40,42,27,251,58,30,51,32,33,
+51,29,30,51,32,31,52,3,33,1,103,253,16,21,33,34,61,85,51,42,73,61,46,14,22,
+47,28,59,55,19,51,90,70,37,37,67,29,25,30,68,54,43,78,81,90,54,102,60,112,
+111,115,64,64,91,59,28,46,44,44,46,26,56,91,64,60,109,47,13,65,52,24,36,22,
+11,6,12,19,14,1,212,31,56,32,33,56,30,31,55,33,32,56,31,156,254,42,0,0,4,
+251,48,252,218,0,143,0,1,0,77,0,93,0,94,0,95,0,0,19,6,6,35,34,46,2,53,52,
+62,2,55,54,54,53,52,38,35,34,14,2,7,39,54,54,55,38,38,35,34,6,21,20,30,2,
+23,7,46,3,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,6,7,6,6,21,20,30,
+2,51,50,62,2,55,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,37,1,143,42,
+108,66,61,96,66,35,28,58,92,64,11,12,65,54,28,57,54,49,20,142,11,26,17,34,
+71,44,63,64,37,71,104,67,95,70,121,90,51,47,74,91,44,72,119,56,48,119,71,
+40,87,72,47,33,29,116,98,21,34,44,24,24,41,40,42,27,251,58,30,51,32,33,51,
+29,30,51,32,31,52,2,159,1,233,253,16,21,33,34,61,85,51,42,73,61,46,14,22,
+47,28,59,55,19,51,90,70,37,37,67,29,25,30,68,54,43,78,81,90,54,102,60,112,
+111,115,64,64,91,59,28,46,44,44,46,26,56,91,64,60,109,47,13,65,52,24,36,22,
+11,6,12,19,14,1,212,31,56,32,33,56,30,31,55,33,32,56,31,156,254,42,0,0,3,
+251,48,252,218,1,87,0,1,0,96,0,112,0,113,0,0,1,6,6,35,34,46,2,53,52,55,38,
+38,53,52,54,55,38,35,34,14,2,7,39,54,54,55,38,38,35,34,6,21,20,30,2,23,7,
+46,3,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,6,21,6,6,21,20,30,2,51,
+50,62,2,55,23,6,6,35,34,38,39,6,6,21,20,30,2,51,50,62,2,55,1,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,37,1,87,42,108,66,61,96,66,35,7,42,45,57,72,
+30,73,28,57,54,49,20,142,11,26,17,34,71,44,63,64,37,71,104,67,95,70,121,90,
+51,47,74,91,44,72,119,56,48,119,71,40,87,72,47,1,87,68,21,34,44,24,24,41,
+40,42,27,40,42,108,66,10,19,10,1,1,21,34,44,24,24,41,40,42,27,250,114,30,
+51,32,33,51,29,30,51,32,31,52,3,33,253,14,20,32,32,60,83,51,32,27,27,82,51,
+55,90,34,54,19,51,90,70,37,37,67,29,25,30,68,54,43,78,81,90,54,102,60,112,
+111,115,64,64,91,59,28,46,44,44,46,27,60,93,66,3,12,3,15,55,35,20,28,18,8,
+6,12,19,14,125,20,32,1,1,5,11,5,24,36,22,11,6,12,19,14,1,217,31,56,32,33,
+56,30,31,55,33,32,56,31,156,0,2,252,69,252,218,1,37,0,1,0,96,0,97,0,0,1,6,
+6,35,34,46,2,53,52,55,38,38,53,52,54,55,38,35,34,14,2,7,39,54,54,55,38,38,
+35,34,6,21,20,30,2,23,7,46,3,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,
+6,21,6,6,21,20,30,2,51,50,62,2,55,23,6,6,35,34,38,39,6,6,21,20,30,2,51,50,
+62,2,55,1,1,37,42,108,66,61,96,66,35,7,42,45,57,72,30,73,28,57,54,49,20,142,
+11,26,17,34,71,44,63,64,37,71,104,67,95,70,121,90,51,47,74,91,44,72,119,56,
+48,119,71,40,87,72,47,1,87,68,21,34,44,24,24,41,40,42,27,40,42,108,66,10,
+19,10,1,1,21,34,44,24,24,41,40,42,27,253,37,253,14,20,32,32,60,83,51,32,27,
+27,82,51,55,90,34,54,19,51,90,70,37,37,67,29,25,30,68,54,43,78,81,90,54,102,
+60,112,111,115,64,64,91,59,28,46,44,44,46,27,60,93,66,3,12,3,15,55,35,20,
+28,18,8,6,12,19,14,125,20,32,1,1,5,11,5,24,36,22,11,6,12,19,14,2,117,0,3,
+251,48,252,218,1,87,0,1,0,96,0,112,0,113,0,0,1,6,6,35,34,46,2,53,52,55,38,
+38,53,52,54,55,38,35,34,14,2,7,39,54,54,55,38,38,35,34,6,21,20,30,2,23,7,
+46,3,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,6,21,6,6,21,20,30,2,51,
+50,62,2,55,23,6,6,35,34,38,39,6,6,21,20,30,2,51,50,62,2,55,1,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,37,1,87,42,108,66,61,96,66,35,7,42,45,57,72,
+30,73,28,57,54,49,20,142,11,26,17,34,71,44,63,64,37,71,104,67,95,70,121,90,
+51,47,74,91,44,72,119,56,48,119,71,40,87,72,47,1,87,68,21,34,44,24,24,41,
+40,42,27,40,42,108,66,10,19,10,1,1,21,34,44,24,24,41,40,42,27,250,114,30,
+51,32,33,51,29,30,51,32,31,52,2,159,253,14,20,32,32,60,83,51,32,27,27,82,
+51,55,90,34,54,19,51,90,70,37,37,67,29,25,30,68,54,43,78,81,90,54,102,60,
+112,111,115,64,64,91,59,28,46,44,44,46,27,60,93,66,3,12,3,15,55,35,20,28,
+18,8,6,12,19,14,125,20,32,1,1,5,11,5,24,36,22,11,6,12,19,14,1,217,31,56,32,
+33,56,30,31,55,33,32,56,31,156,0,3,253,96,253,220,1,54,0,0,0,15,0,31,0,32,
+0,0,5,54,51,50,30,3,23,7,46,2,35,34,7,39,50,22,22,21,20,6,6,35,34,38,38,53,
+52,54,54,55,254,145,45,53,67,120,112,109,107,64,117,72,134,151,92,54,32,217,
+30,51,32,33,51,29,30,51,32,31,52,241,91,11,27,53,85,122,97,84,113,136,67,
+10,56,31,56,32,33,56,30,31,55,33,32,56,31,186,0,2,251,38,254,118,255,32,255,
+150,0,13,0,25,0,0,5,55,22,22,51,50,54,55,23,6,6,35,34,38,37,50,22,21,20,6,
+35,34,38,53,52,54,252,86,48,78,142,89,86,141,82,48,70,190,97,99,192,254,255,
+47,66,66,47,47,66,66,242,136,68,53,50,71,136,62,69,71,146,71,48,49,70,71,
+48,48,71,0,0,2,251,38,254,118,255,32,255,150,0,13,0,25,0,0,5,55,22,22,51,
+50,54,55,23,6,6,35,34,38,37,50,22,21,20,6,35,34,38,53,52,54,252,86,48,78,
+142,89,86,141,82,48,70,190,97,99,192,254,255,47,66,66,47,47,66,66,242,136,
+68,53,50,71,136,62,69,71,146,71,48,49,70,71,48,48,71,0,0,3,251,38,253,220,
+255,32,255,215,0,13,0,25,0,37,0,0,5,55,22,22,51,50,54,55,23,6,6,35,34,38,
+37,50,22,21,20,6,35,34,38,53,52,54,19,55,22,22,51,50,54,55,23,6,35,34,252,
+86,48,78,142,89,86,141,82,48,68,195,94,101,187,254,252,47,66,66,47,47,66,
+66,238,48,71,139,99,99,139,71,48,165,192,193,177,136,68,53,50,71,136,61,70,
+69,83,71,48,49,70,71,48,48,71,254,225,136,49,46,46,49,136,105,0,3,251,38,
+253,220,255,32,255,215,0,13,0,25,0,37,0,0,5,55,22,22,51,50,54,55,23,6,6,35,
+34,38,37,50,22,21,20,6,35,34,38,53,52,54,19,55,22,22,51,50,54,55,23,6,35,
+34,252,86,48,78,142,89,86,141,82,48,68,195,94,101,187,254,252,47,66,66,47,
+47,66,66,238,48,71,139,99,99,139,71,48,165,192,193,177,136,68,53,50,71,136,
+61,70,69,83,71,48,49,70,71,48,48,71,254,225,136,49,46,46,49,136,105,0,5,0,
+0,0,0,5,178,4,250,0,50,0,66,0,67,0,68,0,69,0,0,1,38,38,53,52,54,54,51,51,
+53,33,53,33,21,33,17,33,34,14,2,21,20,22,23,54,51,50,22,22,21,20,6,6,35,34,
+36,39,55,30,2,51,50,54,53,52,38,35,34,6,1,50,22,22,21,20,6,6,35,34,38,38,
+53,52,54,54,1,3,1,2,128,128,140,74,137,88,246,252,107,5,178,254,136,254,125,
+61,53,35,16,62,53,80,106,110,165,90,96,189,131,240,254,164,135,137,82,180,
+198,120,127,129,106,98,49,96,2,62,29,49,29,29,49,29,29,49,29,29,49,254,203,
+143,1,156,2,31,35,134,86,67,92,45,126,146,146,254,240,8,19,25,15,30,51,14,
+26,59,113,79,77,121,70,230,233,67,141,169,74,63,63,50,56,18,1,80,30,53,30,
+30,53,30,30,53,30,30,53,30,1,121,251,6,1,39,0,0,4,0,0,0,0,5,185,4,250,0,73,
+0,74,0,75,0,76,0,0,1,7,38,38,53,52,54,55,53,33,53,33,21,33,21,22,22,21,20,
+6,6,4,35,34,38,38,53,52,54,55,38,53,52,54,54,51,50,22,23,7,38,35,34,6,21,
+20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,36,54,53,52,38,38,35,34,
+6,21,20,22,3,3,1,4,71,67,154,163,115,105,252,93,5,185,254,143,117,124,101,
+194,254,236,160,129,180,90,25,27,171,84,151,98,41,104,23,12,72,70,91,91,78,
+80,58,76,46,40,13,23,40,93,90,118,116,155,1,9,150,42,81,56,62,66,116,54,154,
+1,153,2,154,129,37,143,99,87,117,15,93,146,146,99,27,152,114,99,190,155,89,
+65,118,77,34,70,31,77,144,70,100,51,13,8,139,19,46,50,39,51,14,16,6,143,3,
+54,51,60,57,103,178,105,49,80,47,49,45,55,76,2,78,251,6,1,39,0,0,4,0,0,253,
+220,4,38,4,250,0,35,0,36,0,37,0,38,0,0,1,35,34,14,4,21,20,30,2,51,50,54,55,
+23,6,6,35,34,38,38,53,52,54,54,51,51,53,33,53,33,21,33,39,3,3,2,247,142,67,
+95,83,60,35,18,47,85,117,71,84,164,105,55,99,206,96,146,224,121,116,220,143,
+20,253,174,4,38,254,209,165,4,7,3,82,10,24,38,42,53,31,58,78,48,21,45,54,
+153,49,49,88,165,113,105,150,79,133,146,146,146,251,6,253,220,0,4,0,0,0,0,
+4,204,4,250,0,23,0,36,0,37,0,38,0,0,1,33,21,30,2,21,20,4,35,34,46,2,53,52,
+54,54,51,51,53,33,53,33,1,35,34,6,21,20,22,51,50,54,53,52,38,3,19,4,204,254,
+43,104,157,83,254,254,237,112,189,136,76,123,228,141,7,253,174,4,204,253,
+242,61,187,195,176,165,168,171,121,224,81,4,104,148,29,105,138,78,163,172,
+45,92,137,92,99,152,83,133,146,254,88,103,103,97,106,96,93,75,116,1,197,251,
+6,0,0,4,0,0,0,0,5,35,4,250,0,50,0,51,0,52,0,53,0,0,1,38,38,53,52,54,54,51,
+51,53,33,53,33,21,35,17,33,34,14,2,21,20,22,23,54,51,50,22,22,21,20,6,6,35,
+34,36,39,55,30,2,51,50,54,53,52,38,35,34,6,19,3,1,2,128,128,140,74,137,88,
+246,252,107,5,35,233,254,125,61,53,35,16,62,53,80,106,110,165,90,96,189,131,
+240,254,164,135,137,82,180,198,120,127,129,106,98,49,96,236,143,254,24,2,
+31,35,134,86,67,92,45,126,146,146,254,240,8,19,25,15,30,51,14,26,59,113,79,
+77,121,70,230,233,67,141,169,74,63,63,50,56,18,2,201,251,6,1,39,0,4,0,0,0,
+0,4,158,4,250,0,35,0,48,0,49,0,50,0,0,1,35,34,6,21,20,22,23,38,53,52,54,54,
+51,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,55,53,33,53,33,21,33,3,50,54,
+53,52,38,35,34,6,21,20,22,23,3,19,3,21,128,198,204,123,121,25,66,142,103,
+91,130,62,97,196,142,162,248,132,134,239,156,253,144,4,158,254,119,113,121,
+120,61,63,80,87,13,15,30,32,3,85,102,98,93,103,15,57,59,55,94,58,59,94,53,
+80,119,65,86,165,113,107,151,77,3,131,146,146,253,72,64,58,38,42,59,55,25,
+42,21,3,74,251,6,0,6,0,0,0,0,6,51,4,250,0,33,0,49,0,66,0,67,0,68,0,69,0,0,
+1,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,54,51,50,22,23,54,
+54,55,53,33,53,33,21,33,1,22,22,51,50,62,2,53,52,38,38,35,34,6,7,39,38,38,
+35,34,14,2,21,20,30,2,51,50,54,55,1,19,1,4,192,116,130,88,164,108,95,163,
+94,54,145,108,97,158,94,91,165,104,93,163,95,50,116,81,251,228,6,51,254,141,
+254,122,68,122,65,43,78,60,35,52,85,53,74,109,52,143,77,116,61,43,78,60,35,
+31,51,68,38,73,109,54,1,113,16,254,190,3,192,31,175,124,96,153,87,63,78,69,
+72,77,157,108,99,154,84,63,77,63,66,8,158,146,146,253,195,60,55,22,48,73,
+52,68,87,37,85,100,69,66,50,22,48,73,52,52,73,46,21,84,101,2,137,251,6,1,
+39,0,0,3,0,0,0,217,5,182,4,250,0,51,0,52,0,53,0,0,1,54,55,53,33,53,33,21,
+33,21,22,22,21,20,6,7,39,54,53,52,38,35,34,14,2,7,39,54,55,38,38,35,34,6,
+6,21,20,22,22,23,7,46,2,53,52,54,54,51,50,22,1,3,2,209,96,146,252,61,5,182,
+254,177,103,113,71,70,141,117,88,75,38,79,74,68,27,157,21,36,54,97,50,54,
+77,39,53,128,134,91,143,171,75,80,143,79,95,157,1,60,77,3,75,86,19,180,146,
+146,188,32,160,114,108,182,92,103,137,149,80,89,22,58,103,82,45,77,61,40,
+35,36,61,37,52,90,104,84,122,82,153,148,83,82,121,67,52,1,117,252,45,0,255,
+255,0,0,255,232,5,178,4,250,2,38,2,127,0,0,0,7,0,64,3,177,1,114,255,255,0,
+0,255,155,5,185,4,250,2,38,2,128,0,0,0,7,0,64,3,143,1,37,255,255,0,0,253,
+220,4,38,4,250,2,38,2,129,0,0,0,7,0,64,2,230,1,233,255,255,0,0,0,0,4,204,
+4,250,2,38,2,130,0,0,0,7,0,64,3,42,1,191,255,255,0,0,0,0,5,35,4,250,2,38,
+2,131,0,0,0,7,0,64,3,77,1,174,255,255,0,0,0,0,4,158,4,250,2,38,2,132,0,0,
+0,7,0,64,3,17,1,215,255,255,0,0,255,205,6,51,4,250,2,38,2,133,0,0,0,7,0,64,
+4,5,1,87,255,255,0,0,255,182,5,182,4,250,2,38,2,134,0,0,0,7,0,64,3,151,1,
+64,0,2,0,57,1,158,4,26,5,15,0,25,0,38,0,0,1,38,36,39,6,7,39,54,55,38,38,53,
+52,54,54,51,50,22,22,21,20,6,7,22,22,23,37,54,54,53,52,38,35,34,6,6,21,20,
+22,3,249,103,254,208,83,174,198,98,184,133,93,98,76,149,97,88,142,82,81,82,
+75,220,101,253,225,70,75,80,72,41,70,45,84,1,251,15,87,35,115,115,138,94,
+79,66,146,93,71,121,73,67,125,80,80,140,64,29,46,8,148,46,111,63,66,70,32,
+65,46,61,108,0,0,5,252,15,253,220,255,131,4,250,0,6,0,35,0,36,0,37,0,38,0,
+0,37,1,39,1,51,19,7,5,39,54,51,50,22,22,21,20,6,6,35,34,38,38,39,55,30,2,
+51,50,54,53,52,38,35,34,6,55,19,19,254,87,254,133,96,1,197,82,240,121,254,
+168,45,100,105,89,134,70,76,148,99,115,190,159,85,106,82,130,138,86,91,88,
+75,67,44,79,125,24,4,122,254,251,134,1,21,254,217,79,145,137,45,62,110,72,
+67,109,63,61,108,87,104,83,92,46,57,48,48,52,24,228,1,39,3,211,0,3,252,15,
+252,218,255,131,0,14,0,6,0,35,0,36,0,0,5,1,39,1,51,19,7,5,39,54,51,50,22,
+22,21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,34,6,19,254,87,254,
+133,96,1,197,82,240,121,254,168,45,100,105,89,134,70,76,148,99,115,190,159,
+85,106,82,130,138,86,91,88,75,67,44,79,125,136,254,251,134,1,21,254,217,79,
+145,137,45,62,110,72,67,109,63,61,108,87,104,83,92,46,57,48,48,52,24,1,230,
+0,255,255,251,80,252,218,255,131,0,14,0,38,2,145,0,0,0,7,0,64,254,4,0,55,
+0,5,252,124,253,220,0,111,4,250,0,6,0,37,0,38,0,39,0,40,0,0,37,1,39,1,51,
+19,7,3,23,6,35,34,38,38,53,52,54,54,51,50,30,3,23,7,46,2,35,34,6,21,20,22,
+51,50,54,3,19,19,254,87,254,133,96,1,197,82,240,121,61,44,100,104,91,134,
+69,74,140,93,64,114,107,105,105,70,125,69,126,140,82,90,89,75,67,46,78,84,
+24,4,122,254,251,134,1,21,254,217,79,254,248,137,45,63,110,72,66,109,63,24,
+47,76,109,93,80,102,124,64,57,48,48,52,24,1,129,1,39,3,211,0,0,3,252,124,
+252,218,0,111,0,14,0,6,0,37,0,38,0,0,5,1,39,1,51,19,7,3,23,6,35,34,38,38,
+53,52,54,54,51,50,30,3,23,7,46,2,35,34,6,21,20,22,51,50,54,3,254,87,254,133,
+96,1,197,82,240,121,61,44,100,104,91,134,69,74,140,93,64,114,107,105,105,
+70,125,69,126,140,82,90,89,75,67,46,78,84,136,254,251,134,1,21,254,217,79,
+254,248,137,45,63,110,72,66,109,63,24,47,76,109,93,80,102,124,64,57,48,48,
+52,24,2,131,0,255,255,251,80,252,218,0,111,0,14,0,38,2,148,0,0,0,7,0,64,254,
+4,0,55,0,5,252,70,253,220,255,190,4,250,0,6,0,28,0,29,0,30,0,31,0,0,37,1,
+39,1,51,1,7,19,6,6,35,34,38,38,53,52,54,54,55,23,6,6,21,20,22,51,50,54,55,
+1,19,19,254,87,254,79,96,1,251,82,1,43,121,75,72,133,68,105,148,74,81,166,
+114,15,115,110,83,75,65,103,72,254,247,24,4,122,254,214,134,1,58,254,143,
+79,254,210,36,34,59,108,71,66,117,78,6,135,9,61,57,48,50,27,36,1,84,1,39,
+3,211,0,0,3,252,70,252,218,255,190,0,14,0,6,0,28,0,29,0,0,5,1,39,1,51,1,7,
+19,6,6,35,34,38,38,53,52,54,54,55,23,6,6,21,20,22,51,50,54,55,1,254,87,254,
+79,96,1,251,82,1,43,121,75,72,133,68,105,148,74,81,166,114,15,115,110,83,
+75,65,103,72,254,247,136,254,214,134,1,58,254,143,79,254,210,36,34,59,108,
+71,66,117,78,6,135,9,61,57,48,50,27,36,2,86,0,255,255,251,80,252,218,255,
+190,0,14,0,38,2,151,0,0,0,7,0,64,254,4,0,55,0,5,252,124,252,218,255,212,4,
+250,0,6,0,47,0,48,0,49,0,50,0,0,37,1,39,1,51,19,7,19,23,6,6,35,34,38,38,53,
+52,55,38,38,53,52,54,54,55,23,6,6,21,20,22,51,50,54,55,23,6,6,35,34,39,6,
+21,20,22,51,50,54,3,19,19,254,87,254,133,96,1,197,82,240,121,151,51,72,133,
+68,106,147,74,31,54,57,81,164,116,15,113,112,82,84,57,93,82,51,72,133,68,
+39,35,22,82,84,57,93,251,24,4,122,254,251,134,1,21,254,217,79,254,7,129,37,
+33,61,109,70,48,49,34,98,60,60,103,66,5,135,8,56,49,44,47,22,35,129,37,33,
+5,23,31,47,44,22,2,130,1,39,3,211,0,5,252,69,252,218,0,93,4,250,0,6,0,70,
+0,71,0,72,0,73,0,0,37,5,39,37,51,19,7,1,23,6,6,35,34,38,38,53,52,54,55,54,
+53,52,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,30,4,23,7,46,2,53,52,54,54,
+51,50,22,23,54,51,50,22,22,21,20,7,6,6,21,20,22,51,50,54,1,19,19,254,87,254,
+188,96,1,142,82,240,121,1,43,40,42,107,67,80,118,60,121,121,23,63,56,74,102,
+32,142,24,30,34,71,44,60,67,9,21,36,61,108,44,95,129,131,72,67,120,69,71,
+120,56,98,140,64,118,64,62,105,109,55,53,42,85,254,93,24,4,122,224,134,240,
+254,217,79,253,239,123,21,31,52,91,58,78,104,24,36,37,42,44,93,91,37,62,37,
+20,23,53,44,17,33,34,40,51,73,28,102,92,120,121,67,64,93,52,46,44,90,51,95,
+64,99,92,2,47,46,33,35,18,2,145,1,39,3,211,0,0,5,252,69,252,218,1,37,4,250,
+0,6,0,88,0,89,0,90,0,91,0,0,37,5,39,37,51,19,7,1,23,6,6,35,34,38,38,53,52,
+55,38,38,53,52,54,55,38,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,30,4,23,
+7,46,2,53,52,54,54,51,50,22,23,54,51,50,30,2,21,21,6,21,6,21,20,22,51,50,
+54,55,23,6,6,35,34,39,6,21,20,22,51,50,54,1,19,19,254,87,254,188,96,1,142,
+82,240,121,1,244,39,59,104,53,80,118,60,6,43,43,62,58,22,45,27,74,102,32,
+142,24,30,34,71,44,60,67,9,21,36,61,108,44,95,129,131,72,67,120,69,71,120,
+56,98,140,41,87,72,46,1,155,59,50,48,79,62,39,59,104,53,19,20,2,62,52,53,
+80,253,137,24,4,122,224,134,240,254,217,79,253,237,121,28,24,52,93,62,32,
+18,23,73,44,46,75,21,16,11,93,91,37,62,37,20,23,53,44,17,33,34,40,51,73,28,
+102,92,120,121,67,64,93,52,46,44,90,26,54,81,56,8,6,3,9,59,25,28,19,29,122,
+28,24,2,8,9,34,39,19,2,149,1,39,3,211,0,0,5,252,70,253,220,0,60,4,250,0,6,
+0,22,0,23,0,24,0,25,0,0,37,1,39,1,51,1,7,37,54,51,50,30,3,23,7,46,2,35,34,
+7,27,2,254,87,254,79,96,1,251,82,1,43,121,254,82,45,53,71,122,111,107,93,
+75,117,73,133,151,92,56,30,164,24,4,122,254,214,134,1,58,254,143,79,19,11,
+27,49,75,86,81,84,90,107,53,7,1,49,1,39,3,211,0,4,252,70,252,218,0,60,0,0,
+0,6,0,22,0,23,0,24,0,0,5,1,39,1,51,1,7,37,54,51,50,30,3,23,7,46,2,35,34,7,
+19,1,254,87,254,79,96,1,251,82,1,43,121,254,82,45,53,71,122,111,107,93,75,
+117,73,133,151,92,56,30,164,254,219,174,254,214,134,1,58,254,143,79,57,11,
+27,49,75,86,81,84,90,107,53,7,2,51,253,220,255,255,251,80,252,218,0,60,0,
+0,0,38,2,157,0,0,0,7,0,64,254,4,0,55,0,4,252,124,252,218,255,170,0,14,0,6,
+0,20,0,21,0,22,0,0,5,1,39,1,51,1,7,23,6,6,35,34,38,39,55,22,22,51,50,54,55,
+1,3,254,87,254,133,96,1,197,82,1,13,121,131,78,211,112,113,210,78,48,90,163,
+100,98,161,94,254,218,29,136,254,251,134,1,21,254,183,79,166,64,67,68,63,
+136,69,52,50,71,1,168,252,218,255,255,251,81,252,218,255,170,0,14,2,38,2,
+159,0,0,0,7,0,64,254,5,0,55,0,4,252,156,252,218,255,154,0,14,0,6,0,19,0,31,
+0,32,0,0,5,5,39,37,51,1,7,23,6,6,35,34,39,55,22,22,51,50,54,55,19,6,35,34,
+39,55,22,22,51,50,54,55,1,254,90,254,169,96,1,158,82,1,7,119,115,69,206,106,
+219,162,46,88,154,93,93,154,88,46,174,207,207,174,46,81,154,100,100,153,82,
+254,236,131,215,134,226,254,240,89,121,57,68,125,129,68,47,47,68,254,145,
+100,100,129,49,41,41,49,2,65,255,255,251,81,252,218,255,154,0,14,2,38,2,161,
+0,0,0,7,0,64,254,5,0,55,0,3,252,92,252,218,0,46,0,0,0,30,0,31,0,32,0,0,1,
+54,54,51,50,22,22,21,20,6,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,38,35,
+34,6,7,19,3,254,5,54,116,58,101,147,77,87,166,114,128,216,181,86,126,85,142,
+158,100,108,108,46,75,43,47,87,51,106,189,254,229,23,24,72,129,86,83,129,
+71,82,150,112,87,107,120,58,78,75,43,59,29,19,24,1,163,254,254,0,3,253,87,
+252,218,1,40,0,0,0,31,0,32,0,33,0,0,3,6,35,34,38,38,53,52,54,54,51,50,30,
+2,23,7,46,2,35,34,6,21,20,30,2,51,50,54,55,3,1,128,113,113,101,148,78,85,
+160,105,97,168,141,138,83,125,80,146,167,98,101,109,28,46,60,31,46,84,55,
+168,254,233,253,9,47,72,132,85,77,129,75,50,90,143,126,80,120,150,80,78,68,
+39,53,33,14,18,26,2,104,254,254,0,0,3,253,224,252,218,0,56,0,0,0,23,0,24,
+0,25,0,0,19,6,6,35,34,38,38,53,52,54,54,55,23,6,6,21,20,30,2,51,50,54,55,
+1,19,56,72,133,68,101,148,78,81,165,115,15,114,111,28,46,59,32,57,94,81,254,
+160,201,253,32,36,34,72,132,85,77,129,83,6,135,12,87,72,35,50,33,15,25,42,
+2,82,254,254,0,0,2,253,224,253,220,0,136,0,33,0,40,0,41,0,0,19,6,6,35,34,
+38,38,53,52,55,38,38,53,52,54,54,55,23,6,6,21,20,22,51,50,54,55,23,6,6,35,
+34,39,6,21,20,22,51,50,54,55,1,136,72,133,68,106,147,74,31,54,57,82,164,115,
+15,113,112,82,84,57,93,82,51,72,133,68,39,35,22,82,84,57,93,82,254,79,254,
+17,27,26,47,83,53,36,38,26,74,46,46,78,50,4,103,6,42,38,33,36,17,26,98,27,
+26,4,18,23,36,34,17,27,1,140,0,0,2,252,69,253,221,0,93,0,15,0,63,0,64,0,0,
+19,6,6,35,34,38,38,53,52,54,55,54,53,52,38,35,34,6,7,39,54,55,38,38,35,34,
+6,21,20,30,4,23,7,46,2,53,52,54,54,51,50,22,23,54,51,50,22,22,21,20,7,6,6,
+21,20,22,51,50,54,55,1,93,42,107,67,80,118,60,121,121,23,63,56,74,102,32,
+142,24,30,34,71,44,60,67,10,21,33,62,100,53,95,129,131,72,67,120,69,71,121,
+55,98,140,64,118,64,62,105,109,55,53,42,85,62,253,237,254,7,17,25,42,73,47,
+63,84,20,29,30,34,35,75,74,30,51,29,17,18,43,35,15,26,28,31,41,55,27,83,75,
+97,97,55,51,76,42,38,35,73,42,76,52,80,75,1,38,37,27,28,14,21,1,150,0,2,252,
+69,253,221,1,37,0,15,0,81,0,82,0,0,1,6,6,35,34,38,38,53,52,55,38,38,53,52,
+54,55,38,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,30,4,23,7,46,2,53,52,54,
+54,51,50,22,23,54,51,50,30,2,21,21,6,21,6,21,20,22,51,50,54,55,23,6,6,35,
+34,39,6,21,20,22,51,50,54,55,1,1,37,59,104,53,80,118,60,6,43,43,62,58,22,
+45,27,74,102,32,142,24,30,34,71,44,60,67,10,21,33,62,100,53,95,129,131,72,
+67,120,69,71,121,55,98,140,41,87,72,46,1,155,59,50,48,79,62,39,59,104,53,
+19,20,2,62,52,53,80,51,253,36,254,7,23,19,42,75,50,26,14,19,59,36,37,60,17,
+13,9,75,74,30,51,29,17,18,43,35,15,26,28,31,41,55,27,83,75,97,97,55,51,76,
+42,38,35,73,21,43,67,45,6,5,3,7,48,20,22,15,23,98,23,19,1,6,7,28,32,16,22,
+1,152,0,0,3,254,145,252,218,1,54,0,0,0,15,0,16,0,17,0,0,1,54,51,50,30,3,23,
+7,46,2,35,34,7,3,19,254,145,45,53,67,120,112,109,107,64,117,72,134,151,92,
+54,32,6,101,254,163,11,27,53,85,122,97,84,113,136,67,10,1,244,254,254,0,0,
+3,251,254,252,218,255,32,254,254,0,13,0,14,0,15,0,0,1,55,22,22,51,50,54,55,
+23,6,6,35,34,38,5,19,251,254,48,90,163,100,98,161,94,48,78,211,112,113,210,
+1,35,33,253,228,136,69,52,50,71,136,64,67,68,203,2,36,0,3,251,254,252,218,
+255,32,254,254,0,12,0,24,0,25,0,0,1,55,22,22,51,50,54,55,23,6,6,35,34,7,55,
+22,22,51,50,54,55,23,6,35,34,19,251,254,48,90,163,100,98,161,94,48,76,215,
+110,232,169,48,80,160,113,111,158,84,48,183,218,219,220,254,77,136,69,52,
+50,71,136,61,70,135,136,49,46,45,50,136,105,2,36,0,0,3,0,0,255,137,4,111,
+4,250,0,66,0,67,0,68,0,0,19,46,2,53,52,62,2,51,51,53,33,53,33,21,33,17,33,
+34,6,6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,55,38,38,53,52,
+54,51,50,22,22,21,20,6,7,22,23,7,38,39,6,6,35,34,38,38,53,52,1,19,209,35,
+51,38,50,85,110,83,232,253,123,4,111,254,187,254,110,64,63,38,42,35,110,139,
+81,40,8,25,64,133,136,147,164,15,30,7,5,75,62,51,84,45,51,54,44,76,136,82,
+41,18,64,17,144,222,117,1,230,152,2,30,26,56,85,52,63,87,56,26,135,146,146,
+254,231,16,46,35,36,57,19,57,7,145,3,73,78,79,79,2,16,36,12,54,62,43,69,37,
+53,70,19,79,100,68,132,90,3,6,68,131,91,87,3,35,251,6,0,0,4,0,0,255,93,6,
+173,4,250,0,89,0,90,0,91,0,92,0,0,5,3,7,5,23,22,21,20,6,35,34,38,38,53,52,
+54,55,55,39,46,2,35,34,6,21,20,22,51,50,54,55,23,6,35,34,38,38,53,52,54,54,
+51,50,30,2,23,23,37,38,38,53,52,54,54,51,51,53,33,53,33,21,33,17,35,34,6,
+6,21,20,22,22,51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,7,19,1,19,39,5,
+139,125,6,253,240,24,13,56,44,51,120,80,36,44,50,70,29,55,63,51,50,64,52,
+46,29,59,39,36,79,81,64,105,59,66,120,65,62,89,73,66,31,73,1,31,141,148,117,
+227,155,10,251,61,6,173,254,187,99,152,179,80,72,151,112,12,30,4,5,77,60,
+57,83,40,61,62,124,254,171,203,213,107,1,113,1,218,58,31,29,42,46,53,81,38,
+23,44,18,20,172,70,92,41,52,43,42,51,12,15,130,28,57,102,63,68,101,57,29,
+60,102,76,180,117,34,175,131,109,153,78,160,146,146,254,208,47,93,74,63,96,
+55,3,18,40,14,63,68,48,73,40,59,79,22,254,171,5,54,251,6,251,0,3,253,98,4,
+250,0,91,7,44,0,19,0,39,0,40,0,0,1,52,62,2,51,50,30,2,21,20,14,2,35,34,46,
+2,37,14,3,35,34,38,39,55,30,3,51,50,62,2,55,1,254,136,14,25,34,19,19,34,25,
+14,14,25,34,19,19,34,25,14,1,211,21,68,93,119,73,137,189,61,131,23,49,61,
+76,51,54,75,51,34,15,254,214,6,208,19,34,25,14,14,25,34,19,19,34,25,14,14,
+25,34,63,96,133,83,37,168,180,46,68,100,66,33,37,69,100,64,253,206,0,4,253,
+247,4,235,1,21,7,44,0,16,0,28,0,41,0,42,0,0,1,38,53,52,54,51,50,23,7,38,35,
+34,6,21,20,22,23,19,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,
+51,50,54,55,1,254,119,128,164,142,111,88,45,64,74,80,79,66,70,205,37,45,45,
+37,36,47,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,254,11,4,235,146,
+155,130,146,42,135,35,86,69,59,135,86,1,127,44,34,35,43,44,34,34,44,49,138,
+136,1,3,36,94,89,93,107,254,155,0,255,255,254,164,4,235,2,13,7,44,2,38,0,
+62,0,0,0,7,2,174,1,178,0,0,255,255,0,0,0,0,4,31,7,44,2,38,0,66,0,0,0,39,0,
+62,2,18,0,0,0,7,2,174,3,196,0,0,0,3,251,220,4,250,1,85,7,44,0,40,0,60,0,61,
+0,0,1,38,38,39,55,30,3,51,50,62,2,55,23,14,3,35,34,38,39,14,3,35,34,38,39,
+55,22,22,51,50,62,2,55,37,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,3,254,
+152,5,10,5,131,21,45,56,70,47,50,68,47,31,14,141,20,64,89,112,69,88,136,53,
+26,73,90,107,61,136,208,69,145,47,123,96,52,75,55,38,15,1,52,14,25,34,19,
+19,34,25,14,14,25,34,19,19,34,25,14,242,6,197,13,27,14,46,63,92,62,30,34,
+64,93,59,48,90,126,78,35,70,74,65,92,57,26,164,176,44,125,118,33,63,91,59,
+1,18,31,23,13,13,23,31,18,17,31,23,13,13,23,31,254,52,0,255,255,252,51,4,
+235,0,182,7,44,2,38,0,74,0,0,0,6,2,174,91,0,255,255,252,186,4,235,1,16,7,
+44,2,38,0,75,0,0,0,7,2,174,0,181,0,0,255,255,252,147,4,235,1,16,7,44,2,38,
+0,76,0,0,0,7,2,174,0,181,0,0,255,255,253,238,0,0,3,103,7,44,2,38,0,66,0,0,
+0,7,2,178,2,18,0,0,255,255,254,69,0,0,2,200,7,44,2,38,0,66,0,0,0,39,0,74,
+2,18,0,0,0,7,2,174,2,109,0,0,255,255,254,204,0,0,3,34,7,44,2,38,0,66,0,0,
+0,39,0,75,2,18,0,0,0,7,2,174,2,199,0,0,255,255,254,165,0,0,3,34,7,44,2,38,
+0,66,0,0,0,39,0,76,2,18,0,0,0,7,2,174,2,199,0,0,255,255,254,45,0,0,3,143,
+7,44,2,38,0,66,0,0,0,39,2,221,2,18,0,0,0,7,2,174,3,52,0,0,255,255,254,64,
+0,0,2,239,7,44,2,38,0,68,0,0,0,7,2,174,2,148,0,0,255,255,253,208,0,0,2,199,
+7,44,2,38,2,95,0,0,0,7,2,174,2,108,0,0,255,255,253,96,0,0,2,199,7,44,2,38,
+2,96,0,0,0,7,2,174,2,108,0,0,255,255,252,127,0,0,2,199,7,44,2,38,2,97,0,0,
+0,7,2,174,2,108,0,0,0,5,253,235,4,235,1,250,7,44,0,3,0,20,0,32,0,45,0,46,
+0,0,1,35,17,51,19,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,19,50,22,
+21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,1,254,144,165,
+165,204,128,164,142,111,88,45,64,74,80,79,66,70,205,37,45,45,37,36,47,46,
+1,75,28,133,127,217,78,114,28,87,67,73,72,18,253,38,4,235,1,133,254,123,146,
+155,130,146,42,135,35,86,69,59,135,86,1,127,44,34,35,43,44,34,34,44,49,138,
+136,1,3,36,94,89,93,107,254,155,255,255,255,253,0,0,4,12,7,44,2,38,0,66,0,
+0,0,7,2,191,2,18,0,0,0,4,251,200,4,235,1,41,7,44,0,28,0,40,0,53,0,54,0,0,
+1,38,39,6,35,34,38,39,55,22,22,51,50,54,55,23,54,51,50,23,7,38,35,34,6,21,
+20,22,23,19,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,
+54,55,1,254,139,81,30,81,110,143,193,69,145,47,119,90,89,104,32,76,77,106,
+111,88,45,64,74,77,82,66,70,205,37,45,45,37,36,47,46,1,75,28,133,127,217,
+78,114,28,87,67,73,72,18,253,247,4,235,94,97,57,181,194,49,151,132,130,156,
+27,43,42,135,35,83,72,59,135,86,1,127,44,34,35,43,44,34,34,44,49,138,136,
+1,3,36,94,89,93,107,254,155,0,0,4,252,51,4,235,1,91,7,44,0,35,0,47,0,60,0,
+61,0,0,1,38,38,35,34,7,6,35,34,38,38,39,55,22,22,51,50,55,54,51,50,23,54,
+54,51,50,23,7,38,35,34,6,21,21,22,23,19,50,22,21,20,6,35,34,38,53,52,54,5,
+6,6,35,34,3,55,22,22,51,50,54,55,1,254,164,29,78,86,27,27,26,27,80,113,94,
+38,135,39,84,77,27,33,34,37,37,32,27,154,112,111,88,45,64,74,77,82,54,41,
+246,39,43,45,37,36,47,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,253,
+197,4,235,133,122,2,3,49,122,107,49,108,73,4,3,8,87,95,42,135,35,83,72,9,
+94,177,1,127,44,34,35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,107,254,155,
+0,4,252,186,4,235,1,99,7,44,0,25,0,37,0,50,0,51,0,0,1,38,38,35,34,7,39,54,
+51,50,22,23,51,54,54,51,50,23,7,38,35,34,6,21,22,23,19,50,22,21,20,6,35,34,
+38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,1,254,165,56,128,115,75,67,
+50,84,102,95,127,50,5,27,127,84,111,88,45,64,75,76,81,47,40,253,39,43,45,
+37,37,46,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,253,189,4,235,217,
+209,28,149,30,69,76,71,74,42,135,35,84,84,119,148,1,127,44,34,35,43,44,34,
+34,44,49,138,136,1,3,36,94,89,93,107,254,155,0,4,252,147,4,235,1,99,7,44,
+0,39,0,51,0,64,0,65,0,0,1,46,2,35,34,7,39,54,51,50,22,23,55,46,2,35,34,7,
+39,54,51,50,22,23,51,54,54,51,50,23,7,38,35,34,6,21,22,23,19,50,22,21,20,
+6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,1,254,146,59,90,81,
+60,73,94,54,108,102,99,151,34,9,43,77,89,65,75,67,48,86,100,95,127,50,5,27,
+127,84,111,88,45,64,75,77,80,47,40,253,39,43,45,37,37,46,46,1,75,28,133,127,
+217,78,114,28,87,67,73,72,18,253,189,4,235,84,74,23,44,142,45,103,62,3,109,
+115,49,28,141,29,69,76,71,74,42,135,35,87,81,119,148,1,127,44,34,35,43,44,
+34,34,44,49,138,136,1,3,36,94,89,93,107,254,155,255,255,253,218,0,0,3,59,
+7,44,2,38,0,66,0,0,0,7,2,193,2,18,0,0,255,255,254,69,0,0,3,109,7,44,2,38,
+0,66,0,0,0,7,2,194,2,18,0,0,255,255,254,204,0,0,3,117,7,44,2,38,0,66,0,0,
+0,7,2,195,2,18,0,0,255,255,254,165,0,0,3,117,7,44,2,38,0,66,0,0,0,7,2,196,
+2,18,0,0,0,3,253,168,0,0,3,148,7,44,0,66,0,78,0,91,0,0,1,21,35,17,35,17,35,
+53,51,38,38,35,34,7,6,35,34,46,2,39,55,30,2,51,50,55,54,51,50,22,22,23,51,
+38,39,38,39,39,38,38,53,53,52,55,55,7,20,22,22,23,23,54,54,51,50,23,7,38,
+35,34,6,21,20,22,23,19,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,
+22,51,50,54,55,2,48,213,165,182,2,22,74,65,23,32,32,37,65,81,74,68,29,135,
+25,50,63,58,27,33,33,35,73,95,71,25,110,87,22,29,67,28,119,89,1,143,1,11,
+45,51,89,28,154,111,111,88,45,64,74,77,82,64,60,217,37,45,45,37,37,46,46,
+1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,251,152,4,104,146,
+56,74,2,3,21,50,100,71,49,62,66,27,4,3,48,116,104,104,115,32,24,9,38,107,
+106,11,6,6,4,12,44,39,37,17,32,88,93,42,135,35,83,72,61,129,75,1,112,44,34,
+35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,107,0,0,3,0,0,0,0,11,66,7,44,
+0,41,0,53,0,66,0,0,1,21,35,17,35,17,35,53,51,38,53,52,36,33,32,4,5,38,53,
+52,54,51,50,23,7,38,35,34,6,21,20,22,23,35,36,36,33,32,4,21,20,23,1,50,22,
+21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,2,48,213,165,
+182,164,55,1,85,1,64,1,129,2,147,1,18,4,164,142,111,88,45,64,74,77,82,66,
+70,179,254,208,253,83,254,132,254,218,254,244,61,8,206,37,45,45,37,37,46,
+46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,251,152,4,104,146,
+99,111,169,183,166,165,22,33,130,146,42,135,35,83,72,59,135,86,214,215,116,
+129,87,82,1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,107,0,
+0,3,0,0,0,0,6,144,7,44,0,39,0,51,0,64,0,0,1,21,35,17,35,17,35,53,51,38,53,
+52,54,51,50,22,23,54,54,51,50,23,7,38,35,34,6,21,20,22,23,35,38,38,35,34,
+6,21,20,23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,
+54,55,2,48,213,165,182,169,60,205,173,122,210,89,29,146,105,111,88,45,64,
+74,80,79,66,70,176,108,240,147,112,125,61,4,28,39,43,45,37,37,46,46,1,75,
+28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,251,152,4,104,146,117,115,
+148,182,85,84,82,87,42,135,35,86,69,59,135,86,220,210,112,96,97,110,1,112,
+44,34,35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,107,0,0,3,0,0,0,0,6,244,
+7,44,0,39,0,51,0,64,0,0,1,21,35,17,35,17,35,53,51,38,53,52,54,51,50,22,23,
+54,54,51,50,23,7,38,35,34,6,21,20,22,23,35,38,36,35,34,6,21,20,23,1,50,22,
+21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,2,48,213,165,
+182,168,59,218,183,139,244,104,24,152,115,111,88,45,64,74,80,79,66,70,175,
+129,254,234,162,123,141,62,4,127,37,45,45,37,37,46,46,1,75,28,133,127,217,
+78,114,28,87,67,73,72,18,4,250,146,251,152,4,104,146,111,113,152,186,96,95,
+91,100,42,135,35,86,69,59,135,86,220,210,116,99,100,100,1,112,44,34,35,43,
+44,34,34,44,49,138,136,1,3,36,94,89,93,107,0,3,0,0,0,0,7,152,7,44,0,39,0,
+51,0,64,0,0,1,21,35,17,35,17,35,53,51,38,53,52,54,51,50,4,23,54,54,51,50,
+23,7,38,35,34,6,21,20,22,23,35,38,36,35,34,6,21,20,23,1,50,22,21,20,6,35,
+34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,2,48,213,165,182,164,55,
+238,197,168,1,48,136,14,158,128,111,88,45,64,74,80,79,66,70,175,158,254,167,
+187,143,164,62,5,35,39,43,45,37,37,46,46,1,75,28,133,127,217,78,114,28,87,
+67,73,72,18,4,250,146,251,152,4,104,146,102,107,159,194,116,116,111,121,42,
+135,35,86,69,59,135,86,214,215,122,103,96,93,1,112,44,34,35,43,44,34,34,44,
+49,138,136,1,3,36,94,89,93,107,0,0,3,0,0,0,0,7,255,7,44,0,39,0,51,0,64,0,
+0,1,21,35,17,35,17,35,53,51,38,53,52,54,51,50,4,23,54,54,51,50,23,7,38,35,
+34,6,21,20,22,23,35,38,36,35,34,6,21,20,23,1,50,22,21,20,6,35,34,38,53,52,
+54,5,6,6,35,34,3,55,22,22,51,50,54,55,2,48,213,165,182,164,55,250,209,191,
+1,87,152,9,160,132,111,88,45,64,74,77,82,66,70,174,175,254,129,208,157,178,
+62,5,138,37,45,45,37,37,46,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,
+4,250,146,251,152,4,104,146,100,107,161,194,124,123,118,129,42,135,35,83,
+72,59,135,86,214,215,122,107,98,87,1,112,44,34,35,43,44,34,34,44,49,138,136,
+1,3,36,94,89,93,107,0,0,3,0,0,0,0,8,104,7,44,0,39,0,51,0,64,0,0,1,21,35,17,
+35,17,35,53,51,38,53,52,36,51,50,4,23,54,54,51,50,23,7,38,35,34,6,21,20,22,
+23,35,38,36,35,34,6,21,20,23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,
+3,55,22,22,51,50,54,55,2,48,213,165,182,164,55,1,6,223,214,1,124,166,6,165,
+135,111,88,45,64,74,80,79,66,70,175,191,254,91,230,174,189,61,5,244,37,45,
+45,37,37,46,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,251,
+152,4,104,146,100,108,162,192,129,129,123,135,42,135,35,86,69,59,135,86,214,
+215,121,110,97,86,1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,
+107,0,3,0,0,0,0,8,208,7,44,0,39,0,51,0,64,0,0,1,21,35,17,35,17,35,53,51,38,
+53,52,36,51,50,4,23,54,54,51,50,23,7,38,35,34,6,21,20,22,23,35,38,36,35,34,
+6,21,20,23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,
+54,55,2,48,213,165,182,164,55,1,18,236,238,1,163,182,2,165,139,111,88,45,
+64,74,77,82,66,70,176,207,254,54,251,189,203,61,6,92,37,45,45,37,36,47,46,
+1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,251,152,4,104,146,
+100,108,163,191,135,135,129,141,42,135,35,83,72,59,135,86,214,215,120,113,
+95,86,1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,107,0,3,0,
+0,0,0,9,56,7,44,0,40,0,52,0,65,0,0,1,21,35,17,35,17,35,53,51,38,53,52,36,
+51,32,4,23,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,35,38,36,33,34,6,21,
+20,23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,
+2,48,213,165,182,164,55,1,29,250,1,5,1,203,198,164,142,111,88,45,64,74,77,
+82,66,70,176,222,254,16,254,238,206,214,61,6,196,37,45,45,37,36,47,46,1,75,
+28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,251,152,4,104,146,100,108,
+164,190,141,141,6,130,146,42,135,35,83,72,59,135,86,214,215,120,115,93,86,
+1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,107,0,0,3,0,0,0,
+0,9,161,7,44,0,40,0,52,0,65,0,0,1,21,35,17,35,17,35,53,51,38,53,52,36,33,
+32,4,23,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,35,38,36,33,34,6,21,20,
+23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,2,
+48,213,165,182,164,55,1,40,1,8,1,31,1,243,212,164,142,111,88,45,64,74,80,
+79,66,70,177,239,253,234,254,217,224,224,61,7,45,37,45,45,37,37,46,46,1,75,
+28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,251,152,4,104,146,100,109,
+165,188,147,146,17,130,146,42,135,35,86,69,59,135,86,214,215,119,118,94,83,
+1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,107,0,3,0,0,0,0,
+10,8,7,44,0,42,0,54,0,67,0,0,1,21,35,17,35,17,35,53,51,38,53,52,36,33,32,
+4,23,39,52,62,2,51,50,23,7,38,35,34,6,21,20,22,23,35,38,36,33,34,6,21,20,
+23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,2,
+48,213,165,182,164,55,1,53,1,20,1,55,2,26,228,1,25,71,125,85,111,88,45,64,
+74,77,82,66,70,176,255,253,196,254,196,237,240,61,7,148,39,43,45,37,36,47,
+46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,251,152,4,104,146,
+100,109,167,186,152,151,14,60,91,86,52,42,135,35,83,72,59,135,86,214,215,
+116,123,91,84,1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,94,89,93,107,
+0,3,0,0,0,0,10,112,7,44,0,41,0,53,0,66,0,0,1,21,35,17,35,17,35,53,51,38,53,
+52,36,33,32,4,23,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,35,36,36,33,
+32,6,21,20,23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,3,55,22,22,51,
+50,54,55,2,48,213,165,182,164,55,1,63,1,36,1,79,2,66,243,2,164,142,111,88,
+45,64,74,77,82,66,70,177,254,242,253,159,254,173,254,247,240,61,7,252,37,
+45,45,37,36,47,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,
+251,152,4,104,146,100,109,167,186,156,156,18,18,130,146,42,135,35,83,72,59,
+135,86,214,215,121,120,89,84,1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,
+36,94,89,93,107,0,0,3,0,0,0,0,10,216,7,44,0,41,0,53,0,66,0,0,1,21,35,17,35,
+17,35,53,51,38,53,52,36,33,32,4,5,38,53,52,54,51,50,23,7,38,35,34,6,21,20,
+22,23,35,36,36,33,32,6,21,20,23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,
+34,3,55,22,22,51,50,54,55,2,48,213,165,182,164,55,1,74,1,50,1,103,2,106,1,
+3,3,164,142,111,88,45,64,74,77,82,66,70,177,254,225,253,122,254,152,254,229,
+251,61,8,100,37,45,45,37,37,46,46,1,75,28,133,127,217,78,114,28,87,67,73,
+72,18,4,250,146,251,152,4,104,146,99,111,168,184,161,160,23,22,130,146,42,
+135,35,83,72,59,135,86,214,215,120,123,89,82,1,112,44,34,35,43,44,34,34,44,
+49,138,136,1,3,36,94,89,93,107,0,3,254,64,0,0,3,121,7,44,0,40,0,52,0,65,0,
+0,1,21,35,17,35,17,35,53,51,38,38,35,34,6,21,20,22,23,35,38,53,52,54,51,50,
+22,23,54,54,51,50,23,7,38,35,34,6,21,21,22,23,1,50,22,21,20,6,35,34,38,53,
+52,54,5,6,6,35,34,3,55,22,22,51,50,54,55,2,48,213,165,182,169,50,135,100,
+81,87,32,36,160,72,173,146,81,134,54,38,124,95,107,92,45,64,74,76,85,54,18,
+1,15,37,45,45,37,36,47,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,
+250,146,251,152,4,104,146,218,198,99,90,56,112,74,141,131,137,168,70,69,71,
+68,42,135,35,83,74,26,134,103,1,112,44,34,35,43,44,34,34,44,49,138,136,1,
+3,36,94,89,93,107,0,3,253,208,0,0,3,119,7,44,0,41,0,53,0,66,0,0,1,21,35,17,
+35,17,35,53,51,38,38,35,34,6,21,20,22,23,35,38,53,52,54,51,50,22,23,54,54,
+51,50,23,7,38,35,34,6,21,20,23,22,23,1,50,22,21,20,6,35,34,38,53,52,54,5,
+6,6,35,34,3,55,22,22,51,50,54,55,2,48,213,165,182,176,81,172,122,94,103,30,
+39,163,70,188,159,107,165,67,34,135,100,111,88,45,64,74,80,79,4,43,36,1,2,
+37,45,45,37,36,47,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,
+251,152,4,104,146,222,194,105,92,52,108,74,134,128,142,173,75,76,75,76,42,
+135,35,86,69,45,20,93,107,1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,
+94,89,93,107,0,0,3,253,96,0,0,3,119,7,44,0,41,0,53,0,66,0,0,1,21,35,17,35,
+17,35,53,51,38,38,35,34,6,21,20,22,23,35,38,53,52,54,51,50,22,23,54,54,51,
+50,23,7,38,35,34,6,21,20,22,22,23,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,
+35,34,3,55,22,22,51,50,54,55,2,48,213,165,182,173,99,217,139,106,120,32,38,
+166,68,200,170,124,205,83,28,147,110,111,88,45,64,74,80,79,17,33,34,1,1,37,
+45,45,37,36,47,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,
+251,152,4,104,146,216,199,108,96,54,105,67,128,124,146,179,90,90,87,93,42,
+135,35,86,69,48,72,66,79,1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,
+94,89,93,107,0,0,3,252,127,0,0,3,119,7,44,0,40,0,52,0,65,0,0,1,21,35,17,35,
+17,35,53,51,38,36,35,34,6,21,20,22,23,35,38,53,52,54,51,50,4,23,54,54,51,
+50,23,7,38,35,34,6,21,20,22,23,19,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,
+34,3,55,22,22,51,50,54,55,2,48,213,165,182,167,138,254,205,171,131,153,32,
+40,170,66,228,189,164,1,32,123,13,159,128,111,88,45,64,74,80,79,39,56,246,
+37,45,45,37,36,47,46,1,75,28,133,127,217,78,114,28,87,67,73,72,18,4,250,146,
+251,152,4,104,146,207,207,118,101,51,98,61,116,116,155,190,120,119,115,124,
+42,135,35,86,70,62,117,85,1,112,44,34,35,43,44,34,34,44,49,138,136,1,3,36,
+94,89,93,107,0,0,5,252,124,253,220,255,227,4,250,0,6,0,40,0,41,0,42,0,43,
+0,0,37,1,39,37,51,19,7,19,23,6,35,34,38,53,52,55,38,53,52,54,55,23,6,21,20,
+51,50,54,55,23,6,35,34,39,6,21,20,22,51,50,54,1,19,19,254,87,254,133,96,1,
+148,153,218,121,166,51,140,133,155,172,31,111,188,173,15,225,166,59,98,75,
+51,140,133,48,26,22,82,84,51,92,254,253,24,4,152,254,251,134,247,254,247,
+79,254,188,99,53,100,83,37,37,52,94,71,101,6,103,12,74,69,19,24,98,53,4,18,
+24,36,33,15,1,169,1,39,3,211,0,0,6,252,66,253,220,0,90,4,250,0,48,0,54,0,
+55,0,56,0,57,0,58,0,0,19,6,35,34,38,53,52,55,54,53,52,38,35,34,7,39,54,55,
+38,35,34,6,21,20,22,23,7,38,38,53,52,55,39,37,51,19,7,22,22,21,20,7,6,21,
+20,51,50,54,55,1,22,23,54,55,39,7,19,19,1,90,102,114,120,138,242,23,63,56,
+143,65,142,25,29,77,72,64,63,111,168,95,188,144,93,35,1,148,153,218,8,78,
+84,62,214,108,49,83,57,253,67,112,84,61,95,126,3,24,4,254,173,254,6,42,89,
+74,128,38,30,29,35,35,149,30,51,29,35,45,33,46,91,87,82,108,142,74,86,45,
+48,247,254,247,6,16,80,60,81,73,3,74,55,16,19,1,157,11,54,47,15,148,152,1,
+39,3,211,251,21,0,0,6,252,66,253,220,1,34,4,250,0,65,0,71,0,72,0,73,0,74,
+0,75,0,0,1,6,35,34,38,53,52,55,38,53,52,54,55,38,35,34,7,39,54,55,38,35,34,
+6,21,20,22,23,7,38,38,53,52,55,39,37,51,19,7,22,22,21,21,6,21,6,21,20,22,
+51,50,54,55,23,6,35,34,39,6,21,20,22,51,50,54,55,1,22,23,54,55,39,7,19,19,
+1,1,34,102,114,120,138,6,86,61,59,37,57,143,65,142,25,29,77,72,64,63,111,
+168,95,188,144,93,35,1,148,153,218,9,78,85,1,155,60,49,42,76,71,39,110,106,
+19,20,2,63,51,64,81,39,252,123,107,88,61,95,126,3,24,4,254,183,254,7,43,91,
+76,26,15,37,74,38,62,17,22,149,30,51,29,35,45,33,46,91,87,82,108,142,74,86,
+45,48,247,254,247,6,17,85,60,6,5,3,5,50,21,22,13,26,99,42,2,6,8,28,31,19,
+19,1,160,11,55,47,15,148,152,1,39,3,211,251,21,0,2,252,27,4,235,255,145,7,
+44,0,49,0,50,0,0,1,38,38,35,34,7,6,35,34,38,38,39,55,30,2,51,50,55,54,51,
+50,22,22,23,54,53,52,38,39,39,38,38,53,53,52,55,55,7,20,22,22,23,23,30,2,
+21,20,7,37,254,123,25,76,66,23,32,32,37,76,102,97,42,135,25,50,63,58,27,33,
+33,35,74,94,72,24,26,51,70,28,120,88,1,143,1,11,45,51,61,71,72,40,44,254,
+219,4,235,68,77,2,3,34,103,105,49,62,66,27,4,3,46,116,102,68,59,57,63,24,
+9,38,106,107,11,6,6,4,12,44,39,37,17,21,25,53,85,64,78,102,15,0,2,1,43,255,
+227,2,41,5,182,0,3,0,23,0,0,1,35,3,51,3,52,62,2,51,50,30,2,21,20,14,2,35,
+34,46,2,1,232,121,51,223,240,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,
+20,1,158,4,24,250,185,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,0,4,
+0,235,3,197,3,54,7,44,0,3,0,7,0,8,0,9,0,0,1,3,35,3,33,3,35,3,7,3,1,206,51,
+125,51,2,75,51,124,51,53,5,5,213,253,240,2,16,253,240,2,16,219,2,50,0,0,2,
+0,70,0,0,4,243,5,15,0,27,0,31,0,0,1,3,33,21,33,3,35,19,33,3,35,19,35,53,33,
+19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,19,33,3,215,59,1,16,254,213,69,
+144,71,254,227,70,141,66,255,1,25,62,254,243,1,37,68,144,67,1,31,69,141,69,
+1,1,252,252,1,30,60,254,227,3,39,254,201,135,254,151,1,105,254,151,1,105,
+135,1,55,134,1,98,254,158,1,98,254,158,134,254,201,1,55,0,5,0,117,255,236,
+6,42,5,14,0,9,0,29,0,39,0,59,0,63,0,0,1,20,22,51,50,53,52,35,34,6,5,20,14,
+2,35,34,46,2,53,52,62,2,51,50,30,2,1,20,22,51,50,53,52,35,34,6,5,20,14,2,
+35,34,46,2,53,52,62,2,51,50,30,2,3,1,35,1,1,9,70,78,153,153,78,70,1,193,35,
+74,114,78,73,110,76,37,34,73,112,77,74,112,77,38,1,160,70,78,153,153,78,70,
+1,192,34,74,113,79,73,111,74,38,35,72,112,77,75,112,75,38,254,252,235,160,
+3,23,3,157,120,120,240,240,120,120,86,139,96,50,50,96,139,86,87,138,95,49,
+49,95,138,253,107,120,119,239,240,119,121,87,137,96,51,51,96,137,87,87,138,
+94,50,50,94,138,3,68,251,6,4,250,0,3,0,235,3,197,1,206,7,44,0,3,0,4,0,5,0,
+0,1,3,35,3,23,3,1,206,51,125,51,218,5,5,213,253,240,2,16,219,2,50,0,4,0,140,
+253,220,2,92,7,44,0,19,0,20,0,21,0,22,0,0,19,52,18,18,54,55,51,6,6,2,2,21,
+16,18,23,35,38,38,2,2,1,3,19,140,35,73,111,77,166,69,108,74,36,146,143,168,
+77,111,73,35,1,57,5,31,2,179,143,1,18,1,0,235,104,109,240,254,252,254,243,
+136,254,233,253,241,221,106,241,1,7,1,21,2,213,2,50,246,176,0,0,4,0,120,253,
+220,2,72,7,44,0,19,0,20,0,21,0,22,0,0,1,20,2,2,6,7,35,54,54,18,18,53,16,2,
+39,51,22,22,18,18,1,3,19,2,72,35,73,111,77,166,69,108,74,36,146,143,168,77,
+111,73,35,254,181,5,231,2,162,143,254,238,255,0,235,104,109,240,1,4,1,13,
+136,1,23,2,15,221,106,241,254,249,254,235,1,202,2,50,246,176,0,3,0,150,2,
+88,4,88,7,44,0,14,0,15,0,16,0,0,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,7,3,
+2,220,43,1,141,26,254,134,245,178,176,158,184,242,254,137,29,1,135,43,74,
+5,5,245,254,119,111,193,28,254,186,96,1,102,254,154,96,1,70,28,193,111,1,
+137,251,2,50,0,2,0,102,0,199,4,2,4,250,0,11,0,12,0,0,1,33,53,33,17,51,17,
+33,21,33,17,35,3,1,233,254,125,1,131,150,1,131,254,125,150,36,2,73,150,1,
+132,254,124,150,254,126,4,51,0,1,0,63,254,248,1,121,0,238,0,12,0,0,37,23,
+14,3,7,35,62,3,55,1,106,15,14,39,47,51,25,138,15,29,27,22,8,238,23,54,122,
+124,123,56,61,132,131,125,53,0,0,2,0,100,2,12,2,84,4,250,0,3,0,4,0,0,19,53,
+33,21,3,100,1,240,143,2,12,168,168,2,238,0,0,1,0,147,255,227,1,145,0,250,
+0,19,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,
+34,20,20,34,47,26,27,46,34,20,111,38,53,33,15,15,33,53,38,37,53,34,16,16,
+34,53,0,0,4,0,86,253,220,3,25,7,44,0,3,0,4,0,5,0,6,0,0,1,1,35,1,3,3,19,3,
+25,253,231,170,2,27,172,5,31,6,169,248,4,7,252,254,81,2,50,246,176,0,0,2,
+0,98,255,236,4,8,5,205,0,19,0,39,0,0,1,20,2,6,6,35,34,38,38,2,53,52,18,54,
+54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,4,8,51,113,178,
+127,118,175,115,57,51,111,177,126,119,176,116,58,253,19,30,66,107,77,77,108,
+69,31,31,69,108,77,77,107,66,30,2,221,177,254,232,194,102,102,194,1,24,177,
+177,1,24,193,102,101,193,254,232,178,150,224,149,75,74,148,225,151,150,224,
+148,74,74,148,224,0,0,1,0,178,0,0,2,199,5,182,0,16,0,0,33,35,17,52,62,2,55,
+14,3,7,7,39,1,51,2,199,176,1,3,3,1,17,26,27,30,21,148,96,1,127,150,3,145,
+43,98,97,89,34,18,26,24,27,18,121,123,1,43,0,0,1,0,96,0,0,3,240,5,203,0,35,
+0,0,33,33,53,1,62,3,53,52,46,2,35,34,6,7,39,62,3,51,50,30,2,21,20,14,2,7,
+1,21,33,3,240,252,112,1,94,75,118,83,44,34,63,86,53,95,153,69,102,40,92,106,
+118,65,96,155,108,59,53,93,129,75,254,231,2,177,156,1,125,81,134,128,129,
+76,59,90,63,32,77,60,119,36,63,46,27,54,101,145,91,85,154,149,150,81,254,
+213,8,0,0,1,0,82,255,236,3,238,5,203,0,57,0,0,1,20,14,2,7,21,22,22,21,20,
+14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,46,2,35,35,53,51,50,62,2,53,52,
+46,2,35,34,6,7,39,62,3,51,50,30,2,3,193,46,83,116,71,177,184,65,132,202,138,
+109,193,85,87,203,93,92,134,87,41,53,98,141,89,133,133,81,126,85,44,36,66,
+92,56,107,163,74,92,38,93,110,125,70,108,163,110,56,4,96,73,120,88,57,12,
+6,22,181,145,96,160,116,64,34,45,170,46,50,40,74,108,67,68,97,63,30,151,40,
+74,102,61,52,82,57,30,67,54,125,31,54,41,24,54,97,133,0,0,2,0,23,0,0,4,63,
+5,190,0,10,0,24,0,0,1,35,17,35,17,33,53,1,51,17,51,33,17,52,62,2,55,35,14,
+3,7,1,4,63,213,176,253,93,2,151,188,213,254,123,3,4,5,1,9,7,21,25,26,11,254,
+101,1,72,254,184,1,72,159,3,215,252,48,1,100,56,123,117,102,34,20,49,49,46,
+16,253,160,0,0,1,0,131,255,236,3,246,5,182,0,42,0,0,1,50,30,2,21,20,14,2,
+35,34,46,2,39,53,30,3,51,50,62,2,53,52,38,35,34,14,2,7,39,19,33,21,33,3,54,
+54,2,33,99,171,127,72,68,134,197,128,51,99,91,82,33,33,89,98,99,42,79,124,
+86,46,176,168,27,63,63,57,21,90,55,2,178,253,236,39,32,105,3,129,55,108,160,
+105,114,182,126,67,10,19,30,20,172,23,36,24,13,37,78,118,81,143,151,5,8,9,
+4,57,2,176,166,254,93,6,14,0,0,2,0,113,255,236,4,10,5,203,0,43,0,63,0,0,19,
+52,62,4,51,50,30,2,23,21,38,38,35,34,14,4,7,51,62,3,51,50,30,2,21,20,14,2,
+35,34,46,2,1,50,62,2,53,52,46,2,35,34,14,2,21,20,30,2,113,21,53,92,142,198,
+133,19,46,47,43,17,35,88,43,90,137,100,67,42,20,3,12,20,57,76,95,59,95,154,
+108,59,62,116,164,102,100,175,128,74,1,219,60,99,72,39,33,66,99,66,67,111,
+78,43,37,73,110,2,113,105,208,191,164,121,69,2,5,7,5,155,12,12,43,78,108,
+131,148,80,36,63,45,26,59,114,165,106,114,182,127,68,78,160,242,254,185,41,
+83,127,87,70,111,78,42,47,75,96,48,67,133,106,67,0,0,1,0,90,0,0,4,6,5,182,
+0,6,0,0,33,1,33,53,33,21,1,1,25,2,51,253,14,3,172,253,213,5,16,166,145,250,
+219,0,0,4,0,106,255,236,4,0,5,205,0,39,0,58,0,74,0,75,0,0,1,50,30,2,21,20,
+14,2,7,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,46,3,53,52,62,2,3,20,30,2,
+51,50,62,2,53,52,46,2,39,39,6,6,1,34,6,21,20,30,2,23,62,3,53,52,38,1,2,53,
+84,149,113,66,40,70,96,56,58,111,87,53,67,121,169,102,110,171,117,61,45,76,
+104,58,49,86,63,37,67,114,149,199,32,68,104,72,70,107,72,36,39,73,102,63,
+30,126,128,1,22,106,125,35,62,87,51,48,85,63,36,126,1,38,5,205,44,88,132,
+88,67,108,87,69,28,31,76,95,118,73,92,149,104,56,54,101,146,92,75,120,96,
+74,28,31,73,90,109,66,87,131,88,44,251,166,53,89,63,35,35,65,92,56,52,84,
+72,64,31,14,60,155,3,84,106,101,57,82,64,51,24,22,52,66,84,54,101,106,253,
+131,0,2,0,106,255,236,4,4,5,203,0,41,0,61,0,0,1,20,14,4,35,34,46,2,39,53,
+22,22,51,50,62,2,55,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,1,34,14,2,21,
+20,30,2,51,50,62,2,53,52,46,2,4,4,21,53,92,142,198,133,19,46,46,44,17,35,
+88,43,135,174,102,43,5,13,20,56,76,96,59,95,154,108,59,63,115,165,102,101,
+174,128,74,254,37,60,99,72,39,33,66,99,66,68,110,78,43,37,73,110,3,70,105,
+209,190,165,120,69,2,5,6,5,156,13,12,94,161,214,119,36,62,46,26,59,114,165,
+106,114,183,127,68,78,160,243,1,71,40,84,127,87,70,111,78,42,47,75,96,48,
+67,133,107,66,0,3,0,175,255,227,1,173,4,250,0,19,0,39,0,40,0,0,55,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,46,
+2,19,175,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,20,34,46,27,26,47,
+34,20,20,34,47,26,27,46,34,20,127,111,38,53,33,15,15,33,53,38,37,53,34,16,
+16,34,53,3,145,39,53,33,14,14,33,53,39,37,52,34,16,16,34,52,1,68,0,3,0,91,
+254,248,1,173,4,250,0,12,0,32,0,33,0,0,37,23,14,3,7,35,62,3,55,3,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,19,1,134,15,14,39,47,51,25,138,15,29,27,
+22,8,17,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,127,238,23,54,122,
+124,123,56,61,132,131,125,53,2,237,39,53,33,14,14,33,53,39,37,52,34,16,16,
+34,52,1,68,0,0,2,0,102,0,157,4,2,4,250,0,6,0,7,0,0,37,1,53,1,21,9,2,4,2,252,
+100,3,156,253,33,2,223,253,195,157,1,168,102,1,225,160,254,148,254,190,3,
+188,0,3,0,102,1,125,4,2,4,250,0,3,0,7,0,8,0,0,19,53,33,21,1,53,33,21,1,102,
+3,156,252,100,3,156,253,195,3,23,149,149,254,102,150,150,3,125,0,2,0,102,
+0,157,4,2,4,250,0,6,0,7,0,0,19,1,1,53,1,21,1,1,102,2,224,253,32,3,156,252,
+100,1,95,1,62,1,66,1,108,160,254,31,102,254,88,4,93,0,0,2,0,146,255,227,3,
+146,5,203,0,39,0,59,0,0,1,53,52,62,2,55,62,3,53,52,46,2,35,34,6,7,39,54,54,
+51,50,30,2,21,20,14,2,7,14,3,21,21,3,52,62,2,51,50,30,2,21,20,14,2,35,34,
+46,2,1,134,15,39,66,50,48,68,43,21,30,57,85,56,83,150,70,63,81,188,97,93,
+149,104,56,27,54,80,54,52,66,38,14,187,20,34,46,27,26,47,34,20,20,34,47,26,
+27,46,34,20,1,158,37,57,92,80,77,42,41,67,69,79,53,48,79,57,31,52,34,145,
+42,59,51,96,139,87,67,105,90,84,47,45,67,63,66,44,18,254,209,38,53,33,15,
+15,33,53,38,37,53,34,16,16,34,53,0,4,0,221,253,220,2,106,7,44,0,7,0,8,0,9,
+0,10,0,0,1,33,17,33,21,35,17,51,3,3,19,2,106,254,115,1,141,232,232,165,5,
+31,254,173,7,251,143,249,35,5,190,2,50,246,176,0,0,4,0,86,253,220,3,25,7,
+44,0,3,0,4,0,5,0,6,0,0,19,1,35,1,1,3,19,254,2,27,168,253,229,1,111,5,31,6,
+167,248,6,7,250,254,83,2,50,246,176,0,0,4,0,110,253,220,1,252,7,44,0,7,0,
+8,0,9,0,10,0,0,23,51,17,35,53,33,17,33,19,3,19,110,231,231,1,142,254,114,
+143,5,231,196,6,220,143,248,6,6,77,2,50,246,176,0,0,1,0,60,2,37,4,44,5,193,
+0,6,0,0,19,1,51,1,35,1,1,60,1,203,102,1,191,161,254,175,254,163,2,37,3,156,
+252,100,2,223,253,33,0,1,255,252,254,188,3,78,255,72,0,3,0,0,1,33,53,33,3,
+78,252,174,3,82,254,188,140,0,0,4,0,90,253,220,2,179,7,44,0,39,0,40,0,41,
+0,42,0,0,5,20,30,2,23,21,46,3,53,17,52,38,35,53,50,54,53,17,52,62,2,55,21,
+14,3,21,17,20,6,7,21,22,22,21,3,3,19,1,251,26,47,68,43,76,128,93,53,129,122,
+122,129,53,93,128,76,43,68,47,26,110,106,106,110,254,5,231,37,47,60,34,13,
+1,147,1,33,69,108,77,1,216,101,84,152,84,101,1,217,76,108,69,33,1,146,1,13,
+34,60,47,254,41,103,121,20,11,20,119,104,3,73,2,50,246,176,0,0,4,1,92,253,
+220,2,114,7,44,0,3,0,4,0,5,0,6,0,0,1,51,17,35,3,3,19,1,223,147,147,126,5,
+131,6,167,248,6,6,77,2,50,246,176,0,4,0,110,253,220,2,199,7,44,0,41,0,42,
+0,43,0,44,0,0,1,52,54,55,53,38,38,53,17,52,46,2,39,53,30,3,21,17,20,30,2,
+51,21,34,6,21,17,20,14,2,7,53,62,3,53,1,3,3,1,37,110,107,107,110,25,47,69,
+42,75,129,93,53,32,64,94,61,123,128,53,93,129,75,42,69,47,25,1,4,5,69,1,177,
+104,119,20,11,20,121,103,1,215,47,60,34,13,1,146,1,33,69,108,76,254,39,51,
+70,44,20,152,84,101,254,40,77,108,69,33,1,147,1,13,34,60,47,5,31,2,50,246,
+176,0,2,0,102,2,13,4,2,4,250,0,35,0,36,0,0,1,46,3,35,34,14,2,7,53,54,51,50,
+30,2,23,30,3,51,50,62,2,55,21,6,35,34,46,2,3,2,18,37,55,45,41,22,28,60,59,
+56,25,100,148,29,50,55,67,47,37,55,47,40,22,28,60,59,56,24,99,149,29,50,55,
+67,124,2,78,16,22,13,5,19,33,44,25,162,108,5,13,25,20,16,22,13,5,19,33,44,
+25,162,108,5,13,25,2,192,255,255,0,100,2,12,2,84,4,250,2,6,2,232,0,0,0,2,
+0,82,2,23,3,174,4,250,0,3,0,4,0,0,19,53,33,21,1,82,3,92,254,23,2,23,168,168,
+2,227,0,2,0,82,2,23,7,174,4,250,0,3,0,4,0,0,19,53,33,21,1,82,7,92,250,23,
+2,23,168,168,2,227,0,3,0,168,3,224,1,225,7,44,0,12,0,13,0,14,0,0,19,39,62,
+3,55,51,14,3,7,19,3,182,14,14,39,46,52,25,137,15,29,26,22,8,72,5,3,224,22,
+54,122,124,123,56,61,132,131,124,53,1,26,2,50,0,0,3,0,166,3,224,1,223,7,44,
+0,12,0,13,0,14,0,0,1,23,14,3,7,35,62,3,55,23,3,1,209,14,14,39,47,51,25,137,
+14,29,27,22,8,187,5,5,213,22,55,121,125,122,56,60,132,132,124,53,219,2,50,
+0,0,4,0,169,3,224,3,99,7,44,0,12,0,25,0,26,0,27,0,0,1,39,62,3,55,51,14,3,
+7,33,39,62,3,55,51,14,3,7,19,3,2,56,14,14,39,46,52,25,137,15,29,26,22,8,253,
+184,14,14,39,46,52,25,137,15,29,26,22,8,71,5,3,224,22,54,122,124,123,56,61,
+132,131,124,53,22,54,122,124,123,56,61,132,131,124,53,1,26,2,50,0,4,0,166,
+3,224,3,96,7,44,0,12,0,25,0,26,0,27,0,0,1,23,14,3,7,35,62,3,55,33,23,14,3,
+7,35,62,3,55,7,3,1,209,14,14,39,47,51,25,137,14,29,27,22,8,2,72,14,14,39,
+47,51,25,137,14,29,27,22,8,198,5,5,213,22,55,121,125,122,56,60,132,132,124,
+53,22,55,121,125,122,56,60,132,132,124,53,219,2,50,0,0,3,0,147,255,227,5,
+219,0,250,0,19,0,39,0,57,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,
+37,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,37,52,62,2,51,50,30,2,21,20,14,
+2,35,34,38,147,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,2,37,20,34,
+46,27,26,47,34,20,20,34,47,26,27,46,34,20,2,37,19,35,46,27,26,47,34,20,20,
+34,47,26,54,73,111,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,37,38,53,
+33,15,15,33,53,38,37,53,34,16,16,34,53,37,38,53,33,15,15,33,53,38,37,53,34,
+16,66,0,2,0,141,0,236,3,221,4,250,0,11,0,12,0,0,1,1,55,1,1,23,1,1,7,1,1,39,
+1,1,203,254,194,105,1,61,1,66,104,254,191,1,63,102,254,190,254,195,103,1,
+54,2,146,1,63,105,254,194,1,62,103,254,191,254,192,102,1,61,254,197,103,3,
+165,0,0,4,0,102,0,195,4,2,4,250,0,3,0,23,0,43,0,44,0,0,19,53,33,21,1,52,62,
+2,51,50,30,2,21,20,14,2,35,34,46,2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,
+46,2,19,102,3,156,253,191,18,31,41,24,23,42,32,18,18,32,42,23,24,41,31,18,
+18,31,41,24,23,42,32,18,18,32,42,23,24,41,31,18,4,2,73,150,150,254,247,35,
+47,30,13,13,30,47,35,33,47,31,14,14,31,47,2,219,35,47,30,13,13,30,47,35,33,
+47,31,14,14,31,47,1,33,0,0,2,0,102,2,73,4,2,4,250,0,3,0,4,0,0,19,53,33,21,
+1,102,3,156,253,195,2,73,150,150,2,177,0,1,0,147,0,0,3,243,4,250,0,33,0,0,
+1,6,6,7,1,35,1,55,51,50,62,2,55,54,55,33,53,33,46,3,35,35,53,33,21,33,22,
+22,23,33,21,2,206,14,174,174,1,177,210,254,80,20,92,49,74,55,40,17,44,13,
+254,108,1,146,8,35,56,91,76,136,3,96,254,128,35,46,9,1,38,3,56,130,160,26,
+254,4,1,249,146,8,15,23,15,42,70,146,39,55,44,20,146,146,25,82,51,146,0,1,
+253,76,254,118,254,46,255,100,0,15,0,0,5,50,22,22,21,20,6,6,35,34,38,38,53,
+52,54,54,253,189,30,51,32,33,51,29,30,51,32,31,52,156,31,56,32,33,56,30,31,
+55,33,32,56,31,0,1,0,160,0,0,1,69,4,250,0,3,0,0,51,17,51,17,160,165,4,250,
+251,6,0,2,0,160,0,0,2,223,4,250,0,3,0,7,0,0,33,17,51,17,33,17,51,17,2,58,
+165,253,193,165,4,250,251,6,4,250,251,6,0,3,0,160,0,0,4,121,4,250,0,3,0,7,
+0,11,0,0,33,17,51,17,33,17,51,17,33,17,51,17,2,58,165,253,193,165,2,143,165,
+4,250,251,6,4,250,251,6,4,250,251,6,0,0,1,0,81,3,75,4,169,4,249,0,3,0,0,19,
+1,23,1,81,4,48,40,251,209,3,237,1,12,163,254,245,0,0,2,0,81,1,184,4,169,4,
+249,0,3,0,7,0,0,19,1,23,1,7,1,23,1,81,4,48,40,251,209,41,4,48,40,251,209,
+3,237,1,12,163,254,245,241,1,12,163,254,245,0,0,3,0,81,0,36,4,169,4,249,0,
+3,0,7,0,11,0,0,19,1,23,1,7,1,23,1,7,1,23,1,81,4,48,40,251,209,41,4,48,40,
+251,209,41,4,48,40,251,209,3,237,1,12,163,254,245,241,1,12,163,254,245,242,
+1,12,163,254,245,0,0,3,0,137,1,86,3,37,4,250,0,12,0,24,0,25,0,0,1,34,38,53,
+52,54,51,50,22,22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,3,1,216,148,187,
+185,150,98,152,83,185,149,83,95,96,82,82,96,98,124,1,86,176,139,133,179,81,
+143,88,136,179,1,229,96,74,79,93,93,79,74,96,1,191,0,3,0,117,0,177,3,254,
+4,252,0,16,0,28,0,29,0,0,1,6,7,22,22,21,20,6,35,34,38,53,52,54,55,1,23,1,
+34,6,21,20,22,51,50,54,53,52,38,39,3,65,129,167,117,131,185,148,148,187,97,
+110,2,91,95,253,197,83,95,95,83,82,96,98,104,3,240,102,114,25,161,114,136,
+179,177,138,93,139,85,1,211,119,254,17,95,75,79,94,94,79,74,96,142,0,0,1,
+254,191,254,128,1,248,5,17,0,19,0,0,5,22,51,50,54,18,53,52,2,39,55,22,18,
+21,16,2,4,35,34,39,254,202,106,75,164,203,98,69,61,166,62,70,137,254,233,
+213,89,107,213,22,120,1,0,228,197,1,215,223,37,221,254,0,202,254,237,254,
+193,152,22,0,0,2,254,191,254,21,2,179,5,17,0,30,0,31,0,0,1,22,51,50,36,54,
+53,52,38,39,38,38,53,52,54,55,23,6,6,21,20,22,23,22,22,21,16,0,33,34,39,1,
+254,195,41,64,187,1,0,129,60,53,56,58,254,255,49,205,188,50,65,51,63,254,
+142,254,150,59,57,3,190,254,180,6,89,179,129,99,200,114,119,182,89,165,217,
+53,155,38,135,106,64,148,140,114,224,112,254,251,254,221,6,6,97,0,0,4,254,
+39,7,139,255,210,9,242,0,11,0,23,0,24,0,25,0,0,1,50,22,21,20,6,35,34,38,53,
+52,54,19,50,54,53,52,38,35,34,6,21,20,22,23,3,254,252,95,119,119,94,93,121,
+119,92,51,65,62,50,51,64,61,58,55,9,142,113,91,89,115,114,91,89,114,254,195,
+64,51,50,62,65,51,49,62,198,2,103,0,3,254,83,4,250,255,154,9,242,0,39,0,40,
+0,41,0,0,1,62,2,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,
+6,7,23,22,22,21,20,6,7,39,54,53,52,38,39,39,23,3,254,90,71,98,47,37,35,25,
+35,70,53,59,46,82,72,74,89,87,96,120,35,35,25,24,80,29,17,24,186,105,24,8,
+157,42,75,58,30,26,30,22,24,39,24,58,24,61,43,49,70,73,59,69,102,65,88,26,
+58,44,33,53,29,55,31,31,14,28,19,147,241,253,111,0,2,254,70,7,128,255,231,
+9,242,0,31,0,32,0,0,3,38,39,6,35,34,38,53,52,54,51,50,23,54,54,53,52,38,35,
+34,7,39,54,51,50,22,21,20,6,7,22,23,7,102,106,62,24,25,49,53,39,32,40,58,
+44,49,61,54,69,64,35,80,90,100,114,60,57,82,68,229,7,128,146,58,3,38,36,36,
+34,39,17,68,42,48,55,32,87,35,102,90,64,104,31,82,100,42,0,2,254,77,7,76,
+255,204,9,242,0,45,0,46,0,0,1,54,51,50,22,21,20,7,22,21,20,6,7,22,23,7,38,
+39,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,39,6,35,39,50,54,53,52,38,
+35,34,6,7,19,254,77,78,91,86,96,53,85,57,54,54,49,77,66,58,15,39,46,52,39,
+32,25,49,38,79,45,39,42,53,4,74,79,44,39,32,60,47,149,9,205,37,74,63,69,38,
+40,85,46,74,22,51,64,52,89,55,2,38,36,36,34,21,29,17,62,26,42,7,8,89,28,38,
+24,28,13,21,254,20,0,3,254,38,7,137,255,237,9,242,0,37,0,47,0,48,0,0,3,30,
+2,21,20,6,35,34,38,53,52,54,54,55,46,2,53,52,55,23,6,21,20,22,23,54,54,53,
+52,39,55,22,21,20,6,6,7,6,21,20,22,51,50,53,52,38,5,185,40,46,16,87,74,74,
+96,17,47,42,63,73,27,7,101,7,48,75,79,48,6,98,9,29,70,130,69,36,33,68,28,
+254,246,8,196,40,66,47,34,57,71,74,58,28,46,64,43,60,88,65,39,27,25,18,18,
+19,35,80,71,78,77,28,18,22,18,33,19,39,64,83,127,66,42,27,30,54,21,50,210,
+0,0,2,254,28,7,74,0,1,9,242,0,31,0,32,0,0,1,6,6,21,20,51,51,38,53,52,54,51,
+50,22,22,21,20,7,22,23,7,38,39,7,34,46,2,53,52,54,55,19,254,189,36,26,130,
+11,3,43,34,34,47,17,56,67,62,88,69,59,19,56,85,67,42,31,29,170,9,213,59,79,
+43,126,14,13,32,41,31,40,17,58,23,145,93,37,114,143,1,19,51,86,67,51,107,
+43,253,153,0,2,254,31,7,68,255,244,9,242,0,52,0,53,0,0,1,38,53,52,54,51,50,
+23,7,38,35,34,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,51,50,55,38,53,
+52,54,51,50,22,21,20,7,22,23,7,38,39,6,35,34,38,38,53,52,19,254,103,72,108,
+91,66,46,6,49,46,111,53,40,57,22,33,7,8,46,54,61,67,56,8,4,4,3,42,35,44,54,
+58,36,52,85,47,39,12,35,71,102,49,198,8,244,44,79,61,70,10,89,11,60,41,18,
+11,5,85,2,39,36,36,43,1,14,13,31,42,53,35,61,20,75,65,40,74,88,2,50,80,47,
+58,254,188,0,3,253,222,7,139,255,224,9,242,0,31,0,32,0,33,0,0,1,55,22,22,
+51,50,54,53,52,38,35,34,21,20,22,23,7,38,38,53,52,54,51,50,22,21,20,6,35,
+34,38,38,55,19,253,222,99,19,102,94,54,47,59,44,50,63,58,19,89,101,76,68,
+86,110,100,92,109,128,70,252,25,9,182,17,225,208,64,69,71,100,40,28,35,1,
+86,7,82,67,57,63,152,114,105,111,121,230,217,253,153,0,0,1,254,46,7,139,255,
+240,9,242,0,18,0,0,3,23,3,6,6,21,20,51,50,55,23,6,35,34,38,53,52,54,55,153,
+79,224,41,25,109,88,103,48,123,115,92,120,50,55,9,242,65,254,255,47,50,25,
+79,66,92,66,90,77,56,92,63,0,0,3,254,24,7,63,255,252,9,242,0,27,0,39,0,40,
+0,0,1,22,23,23,22,22,21,20,6,7,39,54,53,52,38,39,37,38,38,53,52,54,51,50,
+22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,19,254,255,22,26,126,39,40,
+22,25,79,25,13,18,255,0,47,49,103,76,81,100,68,113,35,47,44,36,35,47,44,160,
+8,178,14,19,94,29,60,41,30,51,33,52,30,25,17,23,14,202,37,76,57,65,93,95,
+73,59,79,60,44,36,35,43,45,36,34,43,254,143,0,1,253,47,7,139,0,65,9,242,0,
+50,0,0,1,54,51,50,22,21,20,7,22,51,50,54,55,53,35,53,33,21,35,17,35,17,6,
+7,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,39,6,35,39,54,53,52,38,35,
+34,7,253,169,82,84,80,92,69,22,49,44,59,22,75,1,18,100,99,45,78,7,92,76,97,
+137,69,86,54,98,63,31,41,60,33,41,5,128,41,35,63,69,9,205,37,76,62,75,42,
+19,29,21,124,90,90,253,253,1,27,25,2,18,25,64,72,126,144,39,119,98,33,30,
+47,51,8,86,2,63,25,27,33,0,2,253,172,7,139,255,236,9,242,0,34,0,35,0,0,3,
+22,21,20,7,22,21,20,6,35,34,38,38,39,55,22,22,51,50,54,53,52,39,6,35,39,54,
+54,53,52,39,33,53,33,21,37,110,20,76,87,94,76,70,102,97,52,86,61,101,65,34,
+43,81,33,38,6,76,73,33,254,138,2,64,254,99,9,141,31,36,86,46,78,89,69,79,
+52,127,115,36,136,102,37,37,61,54,6,89,3,41,43,36,27,91,91,101,0,0,2,253,
+68,7,139,0,95,9,242,0,46,0,47,0,0,19,21,33,21,54,51,50,22,21,20,7,39,54,53,
+52,38,35,34,7,21,35,53,6,35,34,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,
+51,50,54,55,17,33,53,37,95,254,195,51,61,73,86,67,85,54,40,36,46,51,99,64,
+84,80,104,112,91,52,45,10,37,39,55,60,53,43,36,63,38,254,133,1,11,9,232,90,
+168,40,84,73,101,93,47,63,76,37,40,54,245,154,60,97,83,79,96,10,90,9,45,42,
+42,46,30,40,1,6,90,10,0,2,253,159,7,139,255,240,9,242,0,18,0,19,0,0,1,53,
+33,21,35,17,35,17,35,21,20,35,34,38,53,52,51,33,53,39,253,159,2,81,100,99,
+175,55,44,82,62,1,38,218,9,142,90,90,253,253,1,21,46,60,93,46,57,148,100,
+0,0,3,253,176,7,139,0,14,9,242,0,14,0,24,0,25,0,0,19,35,17,35,53,6,35,34,
+38,38,53,53,35,53,33,5,21,20,22,22,51,50,54,55,53,39,14,100,99,69,78,61,84,
+35,80,2,94,254,85,14,42,42,34,69,27,248,9,142,253,253,178,44,55,83,69,174,
+90,90,143,58,56,34,34,30,227,100,0,3,254,20,7,127,255,207,9,242,0,27,0,28,
+0,29,0,0,3,35,22,21,20,6,7,22,23,7,46,3,53,52,54,51,50,22,23,54,53,52,39,
+35,53,33,3,3,49,101,12,81,81,84,137,64,79,149,65,16,36,33,22,38,25,61,10,
+245,1,187,236,68,9,142,33,39,66,99,33,90,101,66,62,140,82,41,18,25,37,17,
+26,36,72,26,31,90,253,163,2,103,0,3,253,7,7,139,0,58,10,199,0,44,0,53,0,54,
+0,0,3,35,53,6,35,34,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,
+55,17,33,17,35,17,35,53,51,38,53,52,54,51,50,22,23,51,21,35,37,33,38,38,35,
+34,6,21,20,23,43,99,62,86,49,84,51,112,91,52,45,10,37,39,57,58,53,43,36,63,
+38,254,83,99,91,86,23,118,100,127,220,92,99,101,253,229,1,172,79,150,87,68,
+61,166,7,139,148,54,40,82,58,79,96,10,90,9,47,40,42,46,30,40,1,6,253,253,
+2,3,90,38,43,64,78,112,111,90,90,70,62,43,34,31,14,0,3,254,20,7,139,255,185,
+9,242,0,35,0,36,0,37,0,0,3,35,34,6,6,21,20,22,23,22,22,21,20,6,35,34,38,39,
+55,22,51,50,54,53,52,38,39,46,2,53,52,54,54,51,51,3,3,92,105,41,39,20,28,
+73,67,58,88,74,90,113,56,84,75,90,34,38,43,68,46,50,18,47,83,74,100,78,223,
+9,142,6,21,16,15,30,51,47,85,61,64,79,90,97,41,136,33,25,30,52,49,32,55,47,
+31,41,56,22,253,163,2,103,0,3,0,110,2,211,3,203,4,250,0,11,0,24,0,25,0,0,
+1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,32,3,55,22,22,51,50,54,55,37,2,
+34,41,61,61,41,41,61,61,1,210,43,208,172,254,207,133,141,54,142,106,104,124,
+39,254,156,4,142,59,43,43,59,59,43,43,59,68,188,187,1,119,49,150,137,129,
+161,124,0,255,255,0,120,0,99,3,213,4,250,0,38,3,46,10,0,0,7,0,81,2,138,2,
+135,255,255,0,120,254,44,3,213,4,250,0,39,0,81,2,138,0,80,0,38,3,46,10,0,
+0,7,0,5,3,72,251,44,0,5,0,120,254,79,3,213,4,250,0,11,0,24,0,58,0,59,0,60,
+0,0,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,32,3,55,22,22,51,50,54,55,
+17,38,39,6,35,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,7,39,54,51,
+50,22,21,20,6,7,22,23,1,3,2,44,41,61,61,41,41,61,61,1,210,43,208,172,254,
+207,133,141,54,142,106,104,124,39,168,140,59,62,66,89,64,57,38,74,57,90,104,
+119,105,67,111,72,49,138,161,178,202,118,106,154,132,254,28,72,4,142,59,43,
+43,59,59,43,43,59,68,188,187,1,119,49,150,137,129,161,249,209,213,119,11,
+63,53,50,55,28,36,27,126,83,86,96,25,29,134,57,168,151,107,178,51,126,164,
+6,83,251,30,0,6,0,120,253,220,3,213,4,250,0,11,0,24,0,71,0,72,0,73,0,74,0,
+0,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,32,3,55,22,22,51,50,54,55,1,
+54,51,50,22,21,20,7,22,21,20,6,7,22,23,7,38,39,6,35,34,38,53,52,54,51,50,
+22,23,54,54,53,52,38,39,6,35,39,50,54,54,53,52,38,35,34,7,19,3,19,2,44,41,
+61,61,41,41,61,61,1,210,43,208,172,254,207,133,141,54,142,106,104,124,39,
+253,166,140,173,143,170,94,157,107,100,96,92,114,146,74,59,67,75,94,66,57,
+49,89,55,85,89,89,82,72,90,8,115,124,46,87,77,117,146,188,32,134,4,142,59,
+43,43,59,59,43,43,59,68,188,187,1,119,49,150,137,129,161,253,159,59,122,102,
+116,63,66,145,82,126,36,79,101,89,172,65,8,62,54,50,55,35,38,14,68,60,49,
+72,12,14,130,29,51,44,48,52,58,3,99,250,100,254,126,0,4,0,120,254,157,3,213,
+4,250,0,11,0,24,0,61,0,62,0,0,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,
+32,3,55,22,22,51,50,54,55,19,35,34,6,6,21,20,22,23,22,22,21,20,6,35,34,38,
+39,55,22,22,51,50,54,53,52,38,39,46,2,53,52,54,54,51,51,1,2,44,41,61,61,41,
+41,61,61,1,210,43,208,172,254,207,133,141,54,142,106,104,124,39,9,195,90,
+63,36,62,128,144,91,163,135,137,208,104,124,86,144,85,72,78,81,129,84,90,
+37,90,129,141,178,254,137,4,142,59,43,43,59,59,43,43,59,68,188,187,1,119,
+49,150,137,129,161,253,81,14,36,29,32,59,86,96,124,98,110,134,146,162,66,
+129,104,58,53,53,89,85,55,84,77,56,79,89,36,2,162,0,0,2,0,118,0,0,5,87,4,
+250,0,62,0,63,0,0,1,7,38,38,53,52,54,51,50,22,21,20,2,4,35,34,38,38,53,52,
+54,55,38,38,53,52,54,51,50,22,23,7,38,35,34,21,20,23,54,51,50,23,7,38,35,
+34,6,21,20,22,51,50,36,54,53,52,38,35,34,6,21,20,22,1,4,101,67,154,163,154,
+132,154,186,191,254,178,206,129,180,90,31,33,91,92,179,154,41,104,23,12,80,
+62,182,159,58,75,46,40,13,23,29,100,94,122,112,155,1,11,148,98,81,65,63,116,
+254,197,2,22,129,43,166,115,118,143,193,167,163,254,216,171,77,135,89,44,
+91,37,44,134,84,119,136,13,8,141,21,132,105,38,19,6,143,3,76,67,79,81,132,
+227,132,98,126,72,54,71,102,2,202,0,0,2,0,118,0,0,4,224,4,250,0,42,0,43,0,
+0,1,7,38,53,52,54,51,50,22,22,21,20,2,4,35,34,38,53,52,54,51,50,23,7,38,35,
+34,6,21,20,22,51,50,36,54,53,52,38,35,34,6,21,20,3,3,65,152,59,157,137,96,
+150,86,191,254,178,206,189,210,170,162,57,35,13,23,29,96,98,122,112,155,1,
+11,148,98,81,61,67,80,2,82,57,91,111,112,139,80,164,116,163,254,216,171,161,
+140,137,155,6,143,3,73,70,79,81,132,227,132,98,126,68,58,70,2,99,0,2,254,
+174,4,250,1,82,7,44,0,6,0,7,0,0,1,1,35,1,51,19,19,3,1,82,254,223,98,254,223,
+156,178,178,199,7,44,253,227,2,29,254,160,1,96,253,206,0,0,1,0,180,4,104,
+4,251,4,250,0,3,0,0,1,33,53,33,4,251,251,185,4,71,4,104,146,0,0,4,253,37,
+4,250,255,247,9,242,0,6,0,7,0,8,0,9,0,0,1,1,51,1,7,1,3,5,3,3,253,37,1,26,
+126,1,58,110,254,252,231,1,100,55,143,7,200,1,255,254,5,54,1,180,254,76,11,
+2,103,251,8,0,0,4,253,37,7,44,255,247,9,242,0,3,0,10,0,11,0,12,0,0,1,17,35,
+17,5,1,51,1,7,1,3,5,3,254,204,125,254,214,1,26,126,1,58,109,254,251,231,1,
+172,27,8,201,254,124,1,132,223,1,255,254,5,54,1,180,254,76,140,2,198,0,0,
+3,253,63,4,250,255,223,8,116,0,3,0,4,0,5,0,0,1,53,33,21,5,3,253,63,2,160,
+254,190,96,7,236,136,136,192,253,206,0,3,0,102,4,250,1,241,7,44,0,3,0,7,0,
+8,0,0,1,19,51,3,33,19,51,3,23,1,71,60,110,60,254,177,60,110,60,6,5,70,1,230,
+254,26,1,230,254,26,76,0,0,1,253,214,2,25,0,28,2,171,0,3,0,0,1,53,33,21,253,
+214,2,70,2,25,146,146,0,1,252,75,254,42,255,197,255,126,0,26,0,0,5,22,22,
+51,50,54,55,23,6,6,35,34,38,39,6,6,35,34,38,39,55,22,22,51,50,54,55,254,78,
+2,50,58,64,47,1,153,6,117,128,69,94,31,32,94,68,128,117,6,153,1,47,64,58,
+49,3,133,100,98,108,93,7,162,171,60,64,65,59,168,165,7,93,108,96,102,0,1,
+252,139,254,37,255,83,255,144,0,5,0,0,1,17,51,21,33,21,252,139,159,2,41,254,
+37,1,107,222,141,0,0,1,252,116,253,240,255,81,255,186,0,17,0,0,1,34,38,38,
+53,52,54,51,23,35,34,21,20,22,22,51,33,21,253,153,112,116,65,153,128,11,28,
+108,27,53,65,1,176,253,240,54,100,78,105,121,145,88,31,37,16,141,0,2,253,
+48,253,220,0,141,255,155,0,12,0,13,0,0,23,6,6,35,32,3,55,22,22,51,50,54,55,
+3,141,43,208,172,254,207,133,145,54,138,106,103,122,38,161,153,188,187,1,
+119,49,148,135,128,158,254,65,0,0,2,253,143,253,220,0,213,255,199,0,6,0,7,
+0,0,1,1,51,1,7,1,3,5,253,143,1,43,82,1,201,92,254,124,232,1,68,254,86,1,113,
+254,184,124,1,40,254,217,40,0,0,4,254,54,4,250,255,183,7,44,0,3,0,7,0,8,0,
+9,0,0,3,17,35,17,35,17,35,17,19,19,73,139,107,139,110,96,6,249,254,101,1,
+155,254,101,1,155,254,1,2,50,0,5,253,214,4,250,0,22,7,44,0,3,0,7,0,11,0,12,
+0,13,0,0,19,17,35,17,33,17,35,17,33,17,35,17,3,19,22,130,254,196,130,1,97,
+130,17,96,6,249,254,101,1,155,254,101,1,155,254,101,1,155,254,1,2,50,0,1,
+254,164,254,19,255,73,255,152,0,3,0,0,3,35,17,51,183,165,165,254,19,1,133,
+0,0,2,254,92,253,220,255,158,255,69,0,3,0,4,0,0,5,23,7,39,23,254,253,161,
+161,161,245,187,169,169,169,192,0,2,253,112,254,144,255,104,255,114,0,11,
+0,23,0,0,5,50,22,21,20,6,35,34,38,53,52,54,35,50,22,21,20,6,35,34,38,53,52,
+54,254,253,45,62,63,44,44,63,63,246,44,63,63,44,44,63,63,142,66,47,47,66,
+66,47,47,66,66,47,47,66,66,47,47,66,0,3,252,78,254,144,255,104,255,114,0,
+11,0,23,0,35,0,0,5,50,22,21,20,6,35,34,38,53,52,54,35,50,22,21,20,6,35,34,
+38,53,52,54,35,50,22,21,20,6,35,34,38,53,52,54,254,253,45,62,63,44,44,63,
+63,246,44,63,63,44,44,63,63,246,45,62,63,44,45,62,63,142,66,47,47,66,66,47,
+47,66,66,47,47,66,66,47,47,66,66,47,47,66,66,47,47,66,0,1,0,83,4,108,3,117,
+6,96,0,18,0,0,1,21,33,34,6,6,21,20,51,51,21,35,34,38,53,52,54,54,51,3,117,
+254,63,70,78,40,127,28,30,133,157,70,138,138,6,96,146,16,50,44,102,142,133,
+114,86,109,58,0,0,3,255,180,254,176,3,129,7,44,0,32,0,33,0,34,0,0,1,38,38,
+35,34,21,20,22,19,18,17,16,6,35,34,39,55,22,51,50,54,54,53,52,3,2,53,52,54,
+51,50,22,23,37,17,3,15,38,80,49,161,13,30,43,247,254,59,57,4,41,64,121,151,
+70,43,44,169,147,85,141,67,254,219,5,241,40,40,208,79,189,254,239,254,125,
+254,226,254,241,244,6,153,6,74,157,142,243,1,129,1,129,201,165,183,61,69,
+214,254,138,0,1,253,204,1,236,0,16,2,126,0,3,0,0,1,53,33,21,253,204,2,68,
+1,236,146,146,0,4,255,0,1,116,1,100,4,250,0,21,0,22,0,23,0,24,0,0,3,30,3,
+21,20,14,2,35,35,53,51,50,54,54,53,52,38,38,39,7,17,19,13,62,179,90,38,42,
+91,126,123,230,249,86,72,43,54,175,74,27,11,4,175,46,156,108,98,67,54,84,
+66,27,146,15,48,39,44,89,152,53,57,253,118,3,134,0,0,4,0,74,1,116,2,174,4,
+250,0,21,0,22,0,23,0,24,0,0,1,14,2,21,20,22,22,51,51,21,35,34,46,2,53,52,
+62,2,55,23,17,19,2,27,64,183,56,42,71,88,249,230,123,126,91,42,39,92,179,
+59,141,11,4,55,47,156,91,44,38,48,16,146,27,66,84,54,68,99,109,155,44,177,
+253,118,3,134,0,4,0,74,255,189,2,174,4,250,0,21,0,22,0,23,0,24,0,0,5,46,3,
+53,52,62,2,51,51,21,35,34,6,6,21,20,22,22,23,19,17,19,1,187,53,183,95,38,
+42,91,126,123,230,249,85,73,43,55,175,73,45,11,67,39,158,114,99,65,54,84,
+66,27,146,15,49,38,44,89,152,53,3,201,253,118,3,134,0,4,255,0,255,189,1,100,
+4,250,0,21,0,22,0,23,0,24,0,0,39,62,2,53,52,38,38,35,35,53,51,50,30,2,21,
+20,14,2,7,3,17,19,109,64,183,56,42,71,88,249,230,123,126,91,42,35,88,179,
+67,103,11,53,46,157,91,44,38,48,16,146,27,66,84,54,64,96,108,157,50,4,65,
+253,118,3,134,0,0,4,255,0,1,116,2,73,6,30,0,36,0,37,0,38,0,39,0,0,1,51,50,
+54,54,53,52,38,39,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,
+22,22,21,20,14,2,35,35,1,17,19,255,0,249,86,72,43,50,94,139,97,160,128,130,
+186,92,135,71,123,73,67,66,70,107,112,92,42,91,126,123,230,3,62,11,2,127,
+15,48,39,45,74,79,115,152,98,113,149,136,154,68,117,96,68,52,61,101,89,93,
+138,95,54,84,66,27,2,17,253,118,3,134,0,4,255,186,254,78,2,184,4,250,0,36,
+0,37,0,38,0,39,0,0,1,35,34,6,6,21,20,22,23,22,22,21,20,6,35,34,38,39,55,22,
+22,51,50,54,53,52,38,39,38,38,53,52,62,2,51,51,3,17,19,2,184,249,85,73,43,
+61,83,139,97,160,128,131,186,91,135,71,123,73,63,70,70,107,106,98,42,91,126,
+123,230,122,11,1,237,15,49,38,50,79,69,115,152,98,113,149,138,152,68,117,
+96,66,54,61,101,89,87,141,98,54,84,66,27,1,127,253,118,3,134,0,0,2,0,105,
+0,0,6,3,5,15,0,60,0,61,0,0,1,6,35,34,38,53,52,54,51,50,22,18,21,16,0,33,32,
+0,17,16,18,51,50,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,35,34,6,21,21,
+20,0,33,32,0,17,53,52,38,35,34,6,21,20,22,51,50,55,1,5,37,49,61,154,178,146,
+127,110,175,106,254,142,254,173,254,166,254,133,218,182,120,144,169,155,71,
+49,28,32,49,96,94,71,55,104,124,1,25,1,5,1,19,1,31,118,103,61,72,103,97,43,
+33,253,212,2,252,13,155,127,121,141,126,254,246,192,254,176,254,137,1,125,
+1,80,1,16,1,50,147,115,129,153,19,133,10,76,62,57,67,230,215,13,250,254,216,
+1,41,1,14,10,201,226,67,57,66,72,10,1,115,0,2,0,87,0,0,5,175,5,15,0,75,0,
+76,0,0,1,7,38,38,53,52,54,51,50,22,22,21,20,6,7,6,6,21,20,22,51,50,54,54,
+53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,
+22,23,22,22,21,20,4,33,34,38,38,53,52,54,54,55,54,54,53,52,38,35,34,6,21,
+20,1,1,156,20,151,154,149,122,104,147,74,86,99,73,56,202,195,128,183,96,53,
+87,99,74,172,155,128,140,154,151,20,173,56,54,77,97,60,71,101,87,254,219,
+254,232,189,253,119,31,67,94,75,52,92,68,60,64,1,197,3,169,140,17,139,111,
+104,127,76,138,79,100,158,94,69,107,71,114,138,65,123,71,68,102,83,94,148,
+111,116,163,129,114,107,135,16,143,14,110,50,53,93,74,65,106,66,95,173,89,
+191,212,106,183,118,63,102,104,91,73,105,64,66,89,54,49,110,1,67,0,0,2,0,
+87,0,0,5,173,5,15,0,66,0,67,0,0,1,7,38,38,53,52,54,51,50,22,22,21,20,6,7,
+6,6,21,20,22,51,32,0,53,52,38,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,
+52,54,51,50,18,21,16,0,33,32,36,53,52,54,54,55,54,54,53,52,38,35,34,6,21,
+20,1,1,156,20,151,154,149,122,104,147,74,86,99,73,56,197,188,1,9,1,13,121,
+100,61,72,102,97,45,28,25,47,63,154,178,146,127,177,214,254,153,254,182,254,
+243,254,221,31,67,94,75,52,92,68,60,64,1,197,3,169,140,17,139,111,104,127,
+76,138,79,100,158,94,69,107,71,113,139,1,12,253,165,199,67,57,65,73,9,138,
+13,155,127,121,141,254,236,236,254,196,254,164,218,189,63,102,104,91,73,105,
+64,66,89,54,49,110,1,67,0,3,0,87,0,0,6,109,5,15,0,70,0,79,0,80,0,0,37,39,
+54,54,53,52,38,39,2,0,33,34,38,38,53,52,54,54,55,54,54,53,52,38,35,34,6,21,
+20,23,7,38,38,53,52,54,51,50,22,22,21,20,6,7,6,6,21,20,22,22,51,50,54,55,
+46,2,53,52,54,51,50,23,22,22,23,22,22,21,20,6,1,38,38,35,34,6,21,20,22,1,
+5,236,148,52,60,59,66,36,254,193,254,250,171,242,121,31,67,94,75,52,92,68,
+60,64,173,20,151,154,149,122,102,146,77,87,98,73,56,84,163,110,207,240,28,
+177,185,73,146,121,157,86,43,44,2,146,134,67,254,143,2,87,84,49,65,150,254,
+132,22,85,54,129,62,73,81,25,255,0,254,237,107,184,116,63,102,104,91,73,105,
+64,66,89,54,49,110,14,140,17,139,111,104,127,74,140,82,98,158,93,69,107,71,
+66,119,67,212,208,41,105,127,85,111,136,124,62,187,125,37,155,121,92,177,
+2,100,164,164,61,49,86,105,2,27,0,0,3,254,164,253,220,0,213,0,0,0,3,0,4,0,
+5,0,0,19,1,55,1,1,19,121,254,45,92,1,211,253,207,241,253,239,1,82,124,254,
+174,1,149,253,220,0,3,0,115,0,0,4,29,5,15,0,49,0,61,0,62,0,0,1,38,35,34,6,
+6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,55,38,53,52,54,51,50,
+22,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,50,23,19,50,22,21,20,6,
+35,34,38,53,52,54,1,2,187,92,83,85,109,50,89,95,88,103,52,26,26,24,24,132,
+157,137,130,80,49,9,63,54,33,56,31,200,159,197,233,116,109,97,204,184,123,
+101,213,47,66,66,47,47,66,66,254,91,4,101,24,45,76,48,74,112,49,31,4,146,
+2,126,112,122,124,19,21,29,51,60,29,57,33,96,109,214,176,160,110,70,162,97,
+136,170,27,254,64,71,48,49,70,70,49,48,71,1,198,0,0,4,0,119,255,232,3,96,
+5,15,0,47,0,59,0,60,0,61,0,0,1,6,7,6,6,21,20,22,51,50,54,53,52,38,35,55,22,
+22,21,20,6,35,34,38,38,53,52,55,38,38,53,52,36,51,50,23,7,38,35,34,6,6,21,
+20,22,51,50,55,3,50,22,21,20,6,35,34,38,53,52,54,39,19,3,96,89,109,162,163,
+94,77,63,61,83,85,22,146,138,139,128,87,145,92,191,122,133,1,7,232,124,74,
+12,78,107,105,147,77,147,137,128,121,227,44,63,63,44,44,63,63,138,166,2,75,
+30,12,29,140,106,77,86,47,38,43,49,139,4,127,106,98,112,61,140,106,187,104,
+41,178,117,180,205,17,149,17,53,106,77,112,121,49,1,45,66,47,47,66,66,47,
+47,66,247,253,40,0,0,4,0,83,0,0,3,243,5,15,0,39,0,52,0,64,0,65,0,0,1,22,22,
+21,20,6,35,34,38,38,53,52,54,55,53,52,38,39,38,38,53,52,54,51,50,22,23,7,
+38,38,35,34,6,21,20,22,23,22,22,21,7,35,34,6,21,20,22,51,50,54,53,52,38,19,
+50,22,21,20,6,35,34,38,53,52,54,1,2,167,157,175,245,211,141,217,114,240,192,
+35,58,86,60,136,110,93,146,84,131,59,82,50,42,44,40,82,64,56,64,13,169,186,
+166,135,143,156,122,173,47,66,66,47,47,66,66,254,153,2,172,46,190,113,159,
+176,88,165,112,141,183,9,5,20,50,52,74,117,69,90,120,89,125,67,81,55,41,33,
+30,67,72,55,100,56,142,107,99,96,106,98,91,75,121,1,163,71,48,49,70,71,48,
+48,71,1,68,0,0,4,0,74,255,189,3,195,4,250,0,39,0,51,0,63,0,64,0,0,1,14,2,
+21,20,22,22,51,51,50,30,2,21,20,14,2,7,39,62,2,53,52,38,38,35,35,34,46,2,
+53,52,62,2,55,5,50,22,21,20,6,35,34,38,53,52,54,1,50,22,21,20,6,35,34,38,
+53,52,54,19,2,27,64,183,56,42,71,88,144,123,126,91,42,35,88,179,67,96,64,
+183,56,42,71,88,144,123,126,91,42,39,92,179,59,1,6,52,73,73,52,52,73,73,254,
+191,51,74,73,52,52,73,73,212,4,55,47,156,91,44,38,48,16,27,66,84,54,64,96,
+108,157,50,120,46,157,91,44,38,48,16,27,66,84,54,68,99,109,155,44,177,78,
+53,53,78,78,53,53,78,253,118,77,54,53,78,78,53,53,78,3,134,0,0,3,0,79,0,86,
+3,216,4,250,0,13,0,27,0,28,0,0,1,6,6,35,34,38,39,55,22,22,51,50,54,55,1,54,
+54,51,50,22,23,7,38,38,35,34,6,7,19,3,216,51,217,177,156,237,67,153,57,149,
+107,107,132,37,253,26,51,217,177,156,237,67,153,58,149,106,107,132,37,250,
+3,223,198,195,202,191,52,153,144,140,160,252,119,198,195,201,192,52,154,143,
+140,160,4,164,0,3,0,79,0,114,4,18,4,250,0,13,0,27,0,28,0,0,19,54,54,53,52,
+38,39,55,22,22,21,20,6,7,1,6,6,21,20,22,23,7,38,38,53,52,54,55,37,79,154,
+136,138,149,52,196,197,202,191,3,140,154,136,142,145,52,193,200,201,192,254,
+17,1,9,41,138,108,112,156,59,140,72,234,161,166,226,46,2,242,41,138,108,114,
+156,57,140,70,235,161,168,224,47,255,0,0,2,253,48,7,44,0,141,9,73,0,12,0,
+13,0,0,19,6,6,35,32,3,55,22,22,51,50,54,55,3,141,43,208,172,254,207,133,145,
+54,138,106,103,122,38,210,9,21,188,187,1,119,49,148,135,128,158,253,227,0,
+2,0,93,0,54,3,219,4,250,0,11,0,12,0,0,1,23,1,1,7,1,1,39,1,1,55,1,3,3,80,139,
+254,166,1,83,130,254,205,254,200,138,1,88,254,173,130,1,51,43,4,56,100,254,
+92,254,100,88,1,127,254,123,98,1,162,1,156,88,254,130,2,74,0,3,0,105,0,176,
+4,15,4,250,0,26,0,53,0,54,0,0,1,22,22,51,50,54,55,23,6,6,35,34,38,39,6,6,
+35,34,38,39,55,22,22,51,50,54,55,19,38,38,35,34,6,7,39,54,54,51,50,22,23,
+54,54,51,50,22,23,7,38,38,35,34,6,7,3,2,133,4,52,60,66,52,2,158,6,123,134,
+73,98,33,33,98,73,133,124,6,158,1,51,68,60,52,3,1,4,52,60,66,52,2,158,6,124,
+133,73,98,33,34,98,72,131,125,7,158,2,52,66,60,52,3,154,3,182,110,100,112,
+104,8,173,179,62,67,67,62,179,173,8,101,115,100,110,253,0,110,100,114,102,
+8,173,179,63,67,69,61,177,175,8,104,112,100,110,4,68,0,255,255,253,67,4,250,
+255,254,9,242,0,34,3,29,100,0,0,3,3,29,254,240,0,0,255,255,251,247,7,128,
+255,236,9,242,0,34,3,39,0,0,0,3,3,30,253,177,0,0,255,255,251,184,7,76,0,95,
+9,242,0,34,3,40,0,0,0,3,3,31,253,107,0,0,255,255,252,178,4,250,255,229,9,
+242,0,34,3,43,22,0,0,3,3,29,254,95,0,0,255,255,252,130,7,127,255,229,9,242,
+0,34,3,43,22,0,0,3,3,30,254,60,0,0,255,255,252,155,7,76,255,229,9,242,0,34,
+3,43,22,0,0,3,3,31,254,78,0,0,255,255,252,38,7,127,255,229,9,242,0,34,3,43,
+22,0,0,3,3,32,254,0,0,0,255,255,252,108,7,74,255,229,9,242,0,34,3,43,22,0,
+0,3,3,33,254,80,0,0,255,255,252,120,7,128,255,185,9,242,0,34,3,45,0,0,0,3,
+3,30,254,50,0,0,255,255,251,175,4,250,0,61,9,242,0,38,3,56,70,0,0,3,3,30,
+253,105,0,0,255,255,251,108,7,127,0,53,10,199,0,34,3,43,102,0,0,3,3,44,254,
+101,0,0,0,4,0,19,0,110,2,87,4,250,0,15,0,31,0,32,0,36,0,0,1,50,22,22,21,20,
+6,6,35,34,38,38,53,52,54,54,19,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,
+19,1,53,33,21,1,53,33,57,35,35,57,33,33,57,35,35,57,33,33,57,35,35,57,33,
+33,57,35,35,57,44,254,211,2,68,3,254,34,61,36,36,61,34,34,61,36,36,61,34,
+253,118,34,61,36,36,61,34,34,61,36,36,61,34,3,134,252,242,146,146,0,255,255,
+0,74,0,110,3,60,4,250,0,38,3,76,0,0,0,7,0,7,1,163,0,0,255,255,0,74,255,189,
+3,60,4,250,0,38,3,77,0,0,0,7,0,7,1,163,0,0,255,255,255,186,254,78,3,71,4,
+250,0,38,3,80,0,0,0,7,0,7,1,174,0,0,0,3,0,63,254,177,3,129,7,44,0,28,0,29,
+0,30,0,0,1,38,38,35,34,21,20,22,19,18,17,20,6,6,7,39,54,54,53,52,3,2,53,52,
+54,51,50,22,23,37,17,3,15,38,80,49,161,13,30,43,105,201,143,29,156,156,43,
+44,169,147,85,141,67,254,219,5,241,40,40,208,79,189,254,239,254,125,254,226,
+185,215,104,10,153,1,166,205,243,1,129,1,129,201,165,183,61,69,214,254,138,
+0,255,255,253,37,2,95,255,247,7,87,0,7,3,56,0,0,253,101,255,255,253,37,4,
+111,255,247,7,53,0,7,3,57,0,0,253,67,255,255,253,63,3,79,255,223,6,201,0,
+7,3,58,0,0,254,85,255,255,253,48,5,18,0,141,7,47,0,7,3,92,0,0,253,230,255,
+255,254,39,5,41,255,210,7,144,0,7,3,28,0,0,253,158,255,255,254,83,2,52,255,
+154,7,44,0,7,3,29,0,0,253,58,255,255,254,70,4,186,255,231,7,44,0,7,3,30,0,
+0,253,58,255,255,254,77,4,134,255,204,7,44,0,7,3,31,0,0,253,58,255,255,254,
+38,4,195,255,237,7,44,0,7,3,32,0,0,253,58,255,255,254,28,4,132,0,1,7,44,0,
+7,3,33,0,0,253,58,255,255,254,31,4,126,255,244,7,44,0,7,3,34,0,0,253,58,255,
+255,253,222,4,240,255,224,7,87,0,7,3,35,0,0,253,101,255,255,254,46,4,197,
+255,240,7,44,0,7,3,36,0,0,253,58,255,255,254,24,4,121,255,252,7,44,0,7,3,
+37,0,0,253,58,255,255,253,47,4,197,0,65,7,44,0,7,3,38,0,0,253,58,255,255,
+253,172,4,207,255,236,7,54,0,7,3,39,0,0,253,68,255,255,253,68,4,207,0,95,
+7,54,0,7,3,40,0,0,253,68,255,255,253,159,4,207,255,240,7,54,0,7,3,41,0,0,
+253,68,255,255,253,176,4,207,0,14,7,54,0,7,3,42,0,0,253,68,255,255,254,20,
+4,195,255,207,7,54,0,7,3,43,0,0,253,68,255,255,253,7,3,240,0,58,7,44,0,7,
+3,44,0,0,252,101,255,255,254,20,4,207,255,185,7,54,0,7,3,45,0,0,253,68,0,
+0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,40,0,94,0,3,0,1,4,
+9,0,2,0,14,0,134,0,3,0,1,4,9,0,3,0,78,0,148,0,3,0,1,4,9,0,4,0,40,0,94,0,3,
+0,1,4,9,0,5,0,30,0,226,0,3,0,1,4,9,0,6,0,36,1,0,0,3,0,1,4,9,0,7,0,68,1,36,
+0,3,0,1,4,9,0,8,0,42,1,104,0,3,0,1,4,9,0,9,0,40,1,146,0,3,0,1,4,9,0,10,0,
+96,1,186,0,3,0,1,4,9,0,11,0,62,2,26,0,3,0,1,4,9,0,12,0,60,2,88,0,3,0,1,4,
+9,0,13,2,150,2,148,0,3,0,1,4,9,0,14,0,52,5,42,0,67,0,111,0,112,0,121,0,114,
+0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,
+0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,
+0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,68,0,
+101,0,118,0,97,0,110,0,97,0,103,0,97,0,114,0,105,0,82,0,101,0,103,0,117,0,
+108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,
+109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,
+32,0,83,0,97,0,110,0,115,0,32,0,68,0,101,0,118,0,97,0,110,0,97,0,103,0,97,
+0,114,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,
+0,54,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,68,0,
+101,0,118,0,97,0,110,0,97,0,103,0,97,0,114,0,105,0,78,0,111,0,116,0,111,0,
+32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,
+0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,
+0,1,0,0,0,12,1,216,0,0,7,160,0,2,0,76,0,4,0,6,0,3,0,7,0,44,0,1,0,45,0,45,
+0,2,0,46,0,52,0,1,0,53,0,53,0,2,0,54,0,55,0,1,0,56,0,56,0,2,0,57,0,61,0,1,
+0,62,0,62,0,3,0,63,0,63,0,1,0,64,0,64,0,3,0,65,0,68,0,1,0,69,0,76,0,3,0,77,
+0,80,0,1,0,81,0,81,0,3,0,82,0,83,0,1,0,85,0,91,0,3,0,92,0,99,0,2,0,100,0,
+101,0,1,0,102,0,103,0,3,0,106,0,115,0,1,0,118,0,131,0,1,0,133,0,134,0,3,0,
+135,0,135,0,1,0,136,0,180,0,2,0,181,0,182,0,3,0,183,1,166,0,2,1,167,1,169,
+0,3,1,170,1,175,0,2,1,176,1,187,0,3,1,188,1,202,0,2,1,203,1,203,0,3,1,204,
+2,21,0,2,2,22,2,22,0,1,2,23,2,26,0,2,2,27,2,27,0,1,2,28,2,34,0,2,2,35,2,35,
+0,1,2,36,2,42,0,2,2,43,2,57,0,1,2,58,2,93,0,2,2,94,2,94,0,3,2,95,2,97,0,1,
+2,98,2,106,0,2,2,107,2,126,0,3,2,127,2,134,0,1,2,135,2,143,0,2,2,144,2,171,
+0,3,2,172,2,173,0,2,2,174,2,176,0,3,2,177,2,177,0,2,2,178,2,181,0,3,2,182,
+2,190,0,2,2,191,2,191,0,3,2,192,2,192,0,2,2,193,2,196,0,3,2,197,2,217,0,2,
+2,218,2,220,0,3,3,28,3,45,0,3,3,46,3,53,0,1,3,54,3,54,0,3,3,55,3,55,0,1,3,
+56,3,58,0,3,3,59,3,59,0,1,3,60,3,71,0,3,3,72,3,73,0,1,3,74,3,80,0,3,3,81,
+3,84,0,1,3,85,3,85,0,3,3,86,3,91,0,1,3,92,3,92,0,3,3,93,3,94,0,1,3,95,3,105,
+0,3,3,106,3,109,0,2,3,110,3,110,0,1,3,111,3,132,0,3,1,246,0,249,5,104,5,104,
+5,84,5,140,5,192,4,56,4,226,5,120,4,0,5,60,3,218,4,142,3,224,3,230,3,236,
+3,236,4,20,4,26,4,6,5,32,5,32,3,242,3,242,5,184,5,44,5,64,5,68,5,72,5,132,
+3,248,5,104,5,108,5,112,5,84,5,184,5,184,5,184,3,252,4,0,5,28,5,28,4,6,4,
+126,4,234,4,226,4,234,5,68,4,12,5,100,4,16,5,76,5,36,5,76,5,132,5,68,5,24,
+5,112,4,172,5,192,4,56,4,226,4,126,4,234,4,106,5,172,4,76,4,36,4,20,5,60,
+4,30,5,136,4,106,5,172,4,76,4,36,5,28,5,28,4,40,4,26,4,46,4,52,4,30,4,106,
+5,172,4,76,4,36,5,28,5,28,4,40,4,46,4,52,4,56,4,60,4,56,4,60,5,128,4,178,
+4,110,4,64,4,68,5,128,4,178,4,230,4,64,4,68,5,84,5,136,5,20,5,64,4,76,5,116,
+5,140,5,132,4,72,4,84,4,76,5,116,5,124,4,80,5,188,4,84,4,88,4,94,4,100,5,
+176,5,172,4,106,4,110,4,114,4,118,5,52,4,122,4,126,4,130,4,136,4,142,4,148,
+4,154,4,160,4,166,4,218,4,172,5,180,4,178,4,182,4,186,4,190,4,196,4,196,4,
+196,4,200,4,206,4,206,4,212,4,212,4,218,4,218,5,40,5,44,5,44,5,100,5,100,
+4,222,4,222,4,226,4,230,4,230,4,238,4,234,4,238,5,68,5,88,4,242,4,248,4,254,
+5,4,5,10,5,88,5,28,5,176,5,16,5,32,5,20,5,124,5,24,5,176,5,28,5,32,5,32,5,
+32,5,36,5,36,5,36,5,40,5,40,5,40,5,44,5,48,5,52,5,56,5,56,5,56,5,60,5,60,
+5,68,5,68,5,64,5,68,5,72,5,132,5,76,5,80,5,84,5,88,5,94,5,100,5,140,5,184,
+5,168,5,104,5,108,5,112,5,116,5,120,5,168,5,124,5,196,5,132,5,128,5,148,5,
+132,5,136,5,136,5,140,5,144,5,148,5,188,5,152,5,156,5,160,5,164,5,168,5,172,
+5,176,5,180,5,184,5,188,5,192,5,196,0,2,0,80,0,4,0,6,0,0,0,13,0,16,0,3,0,
+19,0,19,0,7,0,25,0,25,0,8,0,27,0,27,0,9,0,29,0,29,0,10,0,31,0,31,0,11,0,35,
+0,38,0,12,0,42,0,42,0,16,0,44,0,44,0,17,0,47,0,47,0,18,0,52,0,53,0,19,0,55,
+0,56,0,21,0,62,0,62,0,23,0,65,0,65,0,24,0,69,0,76,0,25,0,81,0,81,0,33,0,85,
+0,85,0,34,0,87,0,89,0,35,0,92,0,92,0,38,0,96,0,98,0,39,0,100,0,103,0,42,0,
+106,0,115,0,46,0,124,0,124,0,56,0,130,0,130,0,57,0,142,0,144,0,58,0,153,0,
+154,0,61,0,157,0,157,0,63,0,159,0,159,0,64,0,162,0,163,0,65,0,167,0,167,0,
+67,0,181,0,181,0,68,0,254,0,254,0,69,1,0,1,0,0,70,1,2,1,2,0,71,1,4,1,4,0,
+72,1,8,1,11,0,73,1,15,1,15,0,77,1,17,1,17,0,78,1,19,1,19,0,79,1,26,1,26,0,
+80,1,37,1,37,0,81,1,41,1,41,0,82,1,43,1,43,0,83,1,47,1,50,0,84,1,54,1,54,
+0,88,1,58,1,58,0,89,1,65,1,65,0,90,1,149,1,150,0,91,1,153,1,154,0,93,1,157,
+1,169,0,95,1,176,1,187,0,108,1,203,1,203,0,120,1,227,1,229,0,121,1,233,1,
+236,0,124,1,238,1,238,0,128,1,240,1,242,0,129,1,244,1,244,0,132,1,248,1,253,
+0,133,1,255,1,255,0,139,2,12,2,12,0,140,2,14,2,14,0,141,2,16,2,17,0,142,2,
+20,2,26,0,144,2,35,2,36,0,151,2,39,2,40,0,153,2,107,2,122,0,155,2,127,2,142,
+0,171,2,144,2,169,0,187,2,172,2,176,0,213,2,178,2,181,0,218,2,191,2,191,0,
+222,2,193,2,196,0,223,2,218,2,220,0,227,3,29,3,29,0,230,3,46,3,51,0,231,3,
+56,3,56,0,237,3,58,3,58,0,238,3,66,3,67,0,239,3,81,3,88,0,241,0,2,0,68,0,
+69,0,2,0,34,0,35,0,2,0,39,0,40,0,2,0,52,0,53,0,2,0,66,0,67,0,1,0,14,0,1,0,
+18,0,2,0,25,0,58,0,2,0,0,0,50,0,1,0,47,0,1,0,56,0,2,0,53,0,54,0,1,0,6,0,2,
+0,25,0,57,0,1,0,39,0,2,0,50,0,51,0,2,0,0,0,51,0,1,0,66,0,1,0,73,0,1,0,91,
+0,1,0,84,0,1,0,77,0,1,0,53,0,1,0,34,0,1,0,50,0,1,0,33,0,2,0,25,0,51,0,2,0,
+75,0,76,0,2,0,80,0,81,0,1,0,68,0,1,0,81,0,1,0,69,0,1,0,93,0,1,0,102,0,1,0,
+92,0,2,0,89,0,90,0,2,0,62,0,63,0,2,0,76,0,77,0,2,0,93,0,94,0,2,0,71,0,72,
+0,2,0,103,0,104,0,2,0,69,0,70,0,2,0,54,0,55,0,1,0,70,0,1,0,88,0,1,0,83,0,
+2,0,58,0,59,0,1,0,58,0,2,0,94,0,95,0,2,0,64,0,65,0,2,0,64,0,69,0,1,0,45,0,
+1,0,57,0,1,0,78,0,1,0,94,0,1,0,97,0,1,0,113,0,2,0,74,0,75,0,2,0,36,0,37,0,
+2,0,37,0,38,0,2,0,51,0,52,0,2,0,49,0,50,0,1,0,74,0,1,0,37,0,1,0,49,0,1,0,
+52,0,1,0,36,0,1,0,38,0,1,0,29,0,1,0,48,0,1,0,71,0,1,0,89,0,1,0,23,0,1,0,21,
+0,1,0,31,0,1,0,32,0,1,0,24,0,1,0,64,0,1,0,82,0,1,0,16,0,2,0,67,0,68,0,2,0,
+90,0,91,0,1,0,40,0,1,0,26,0,1,0,17,0,1,0,35,0,1,0,46,0,1,0,54,0,1,0,51,0,
+1,0,55,0,1,0,41,0,1,0,25,0,1,0,42,0,1,0,59,0,1,0,72,0,1,0,9,0,1,0,5,0,1,0,
+8,0,1,0,12,0,1,0,61,0,1,0,76,0,1,0,67,0,1,0,80,0,1,0,4,0,1,0,62,0,1,0,60,
+0,1,0,65,0,2,0,36,0,4,0,6,0,1,0,62,0,62,0,1,0,64,0,64,0,2,0,69,0,72,0,2,0,
+73,0,76,0,1,0,81,0,81,0,2,0,85,0,85,0,1,0,86,0,86,0,2,0,87,0,89,0,1,0,90,
+0,91,0,2,0,102,0,103,0,2,0,181,0,181,0,1,0,182,0,182,0,2,1,167,1,169,0,1,
+1,176,1,187,0,1,1,203,1,203,0,1,2,94,2,94,0,1,2,107,2,126,0,2,2,144,2,171,
+0,2,2,174,2,176,0,1,2,178,2,181,0,1,2,191,2,191,0,1,2,193,2,196,0,1,2,218,
+2,220,0,2,3,28,3,45,0,1,3,54,3,54,0,3,3,56,3,58,0,1,3,60,3,60,0,3,3,61,3,
+65,0,2,3,66,3,67,0,1,3,68,3,71,0,2,3,74,3,80,0,3,3,85,3,85,0,2,3,92,3,92,
+0,1,3,95,3,105,0,1,3,111,3,132,0,1,0,1,0,0,0,10,0,128,0,178,0,2,100,101,118,
+50,0,14,100,101,118,97,0,30,0,32,0,2,77,65,82,32,0,44,78,69,80,32,0,56,0,
+52,0,2,77,65,82,32,0,64,78,69,80,32,0,76,0,0,255,255,0,3,0,0,0,1,0,2,0,0,
+255,255,0,3,0,0,0,1,0,2,0,0,255,255,0,3,0,0,0,1,0,2,0,0,255,255,0,3,0,0,0,
+1,0,2,0,0,255,255,0,3,0,0,0,1,0,2,0,0,255,255,0,3,0,0,0,1,0,2,0,3,97,98,118,
+109,0,20,98,108,119,109,0,28,100,105,115,116,0,36,0,0,0,2,0,0,0,1,0,0,0,2,
+0,2,0,3,0,0,0,5,0,4,0,5,0,7,0,12,0,30,0,31,0,64,8,220,9,174,15,8,19,108,21,
+182,22,28,22,56,24,36,24,100,24,142,24,206,25,14,28,38,28,66,28,94,28,122,
+28,150,28,178,28,206,28,234,29,6,29,34,29,118,29,146,29,174,29,202,29,230,
+30,2,30,30,30,58,0,4,0,0,0,1,0,8,0,1,0,12,0,100,0,1,1,110,3,116,0,2,0,14,
+0,4,0,6,0,0,0,62,0,62,0,3,0,73,0,76,0,4,0,85,0,85,0,8,0,87,0,89,0,9,0,181,
+0,181,0,12,1,167,1,169,0,13,1,176,1,187,0,16,1,203,1,203,0,28,2,174,2,176,
+0,29,2,178,2,181,0,32,2,191,2,191,0,36,2,193,2,196,0,37,3,66,3,67,0,41,0,
+1,0,131,0,13,0,14,0,15,0,16,0,19,0,25,0,29,0,31,0,35,0,36,0,37,0,38,0,42,
+0,47,0,55,0,56,0,92,0,96,0,97,0,98,0,100,0,101,0,130,0,142,0,143,0,144,0,
+153,0,154,0,157,0,159,0,162,0,163,0,167,0,254,1,2,1,4,1,8,1,9,1,10,1,11,1,
+15,1,19,1,26,1,37,1,41,1,43,1,47,1,48,1,49,1,50,1,54,1,58,1,65,1,149,1,150,
+1,153,1,154,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,
+227,1,228,1,229,1,233,1,234,1,235,1,236,1,238,1,240,1,241,1,242,1,244,1,248,
+1,249,1,250,1,251,1,252,1,253,1,255,2,14,2,16,2,17,2,20,2,21,2,22,2,23,2,
+24,2,25,2,26,2,35,2,36,2,39,2,40,2,127,2,128,2,129,2,130,2,131,2,132,2,133,
+2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,172,2,173,3,46,3,
+47,3,48,3,49,3,50,3,51,3,81,3,82,3,83,3,84,3,86,3,87,3,88,0,43,0,0,0,174,
+0,0,0,182,0,0,0,190,0,0,0,198,0,0,0,206,0,0,0,214,0,0,0,222,0,0,0,230,0,0,
+0,238,0,0,0,246,0,0,0,254,0,0,1,6,0,0,1,14,0,0,1,22,0,0,1,30,0,0,1,38,0,0,
+1,46,0,0,1,54,0,0,1,62,0,0,1,70,0,0,1,78,0,0,1,86,0,0,1,94,0,0,1,102,0,0,
+1,110,0,0,1,118,0,0,1,126,0,0,1,134,0,0,1,142,0,0,1,150,0,0,1,158,0,0,1,166,
+0,0,1,174,0,0,1,182,0,0,1,190,0,0,1,198,0,0,1,206,0,0,1,214,0,0,1,222,0,0,
+1,230,0,0,1,238,0,0,1,246,0,0,1,254,0,2,254,164,4,250,0,26,0,2,254,164,4,
+250,0,26,0,2,254,164,4,250,0,16,0,2,254,164,4,250,0,4,0,2,254,164,4,250,0,
+14,0,2,254,164,4,250,0,26,0,2,254,164,4,250,0,17,0,2,254,164,4,250,0,35,0,
+2,254,164,4,250,0,4,0,2,254,164,4,250,0,4,0,2,254,164,4,250,0,4,0,2,254,164,
+4,250,0,18,0,2,254,164,4,250,0,21,0,2,254,164,4,250,0,16,0,2,254,164,4,250,
+0,25,0,2,254,164,4,250,0,37,0,2,254,164,4,250,0,31,0,2,254,164,4,250,0,34,
+0,2,254,164,4,250,0,46,0,2,254,164,4,250,0,42,0,2,254,164,4,250,0,41,0,2,
+254,164,4,250,0,53,0,2,254,164,4,250,0,33,0,2,254,164,4,250,0,34,0,2,254,
+164,4,250,0,46,0,2,254,164,4,250,0,51,0,2,254,164,4,250,0,50,0,2,254,164,
+4,250,0,62,0,2,254,164,4,250,0,33,0,2,254,164,4,250,0,40,0,2,254,164,4,250,
+0,42,0,2,254,164,4,250,0,4,0,2,254,164,4,250,0,61,0,2,254,164,4,250,0,26,
+0,2,254,164,4,250,0,17,0,2,254,164,4,250,0,35,0,2,254,164,4,250,0,46,0,2,
+254,164,4,250,0,54,0,2,254,164,4,250,0,61,0,2,254,164,4,250,0,51,0,2,254,
+164,4,250,0,65,0,2,254,164,4,250,0,8,0,2,254,164,4,250,0,12,0,131,1,8,1,16,
+1,24,1,32,1,40,1,48,1,56,1,64,1,72,1,80,1,88,1,96,1,104,1,112,1,120,1,128,
+1,136,1,144,1,152,1,160,1,168,1,176,1,184,1,192,1,200,1,208,1,216,1,224,1,
+232,1,240,1,248,2,0,2,8,2,16,2,24,2,32,2,40,2,48,2,56,2,64,2,72,2,80,2,88,
+2,96,2,104,2,112,2,120,2,128,2,136,2,144,2,152,2,160,2,168,2,176,2,184,2,
+192,2,200,2,208,2,216,2,224,2,232,2,240,2,248,3,0,3,8,3,16,3,24,3,32,3,40,
+3,48,3,56,3,64,3,72,3,80,3,88,3,96,3,104,3,112,3,120,3,128,3,136,3,144,3,
+152,3,160,3,168,3,176,3,184,3,192,3,200,3,208,3,216,3,224,3,232,3,240,3,248,
+4,0,4,8,4,16,4,24,4,32,4,40,4,48,4,56,4,64,4,72,4,80,4,88,4,96,4,104,4,112,
+4,120,4,128,4,136,4,144,4,152,4,160,4,168,4,176,4,184,4,192,4,200,4,208,4,
+216,4,224,4,232,4,240,4,248,5,0,5,8,5,16,5,24,0,2,2,232,4,250,0,42,0,2,2,
+232,4,250,0,60,0,2,3,14,4,250,0,73,0,2,3,195,4,250,0,78,0,2,3,40,4,250,0,
+54,0,2,2,247,4,250,0,58,0,2,3,149,4,250,0,68,0,2,3,163,4,250,0,76,0,2,2,82,
+4,250,0,34,0,2,2,82,4,250,0,39,0,2,3,149,4,250,0,52,0,2,2,112,4,250,0,52,
+0,2,2,92,4,250,0,53,0,2,3,9,4,250,0,50,0,2,4,28,4,250,0,66,0,2,4,28,4,250,
+0,66,0,2,2,247,4,250,0,58,0,2,3,149,4,250,0,52,0,2,2,112,4,250,0,52,0,2,3,
+9,4,250,0,50,0,2,3,14,4,250,0,92,0,2,3,195,4,250,0,97,0,2,3,149,4,250,0,54,
+0,2,2,232,4,250,0,60,0,2,3,14,4,250,0,73,0,2,3,195,4,250,0,78,0,2,3,14,4,
+250,0,92,0,2,3,195,4,250,0,97,0,2,3,149,4,250,0,68,0,2,3,163,4,250,0,76,0,
+2,2,82,4,250,0,34,0,2,2,82,4,250,0,39,0,2,2,92,4,250,0,53,0,2,2,247,4,250,
+0,57,0,2,3,149,4,250,0,68,0,2,3,163,4,250,0,76,0,2,2,82,4,250,0,34,0,2,2,
+82,4,250,0,39,0,2,3,149,4,250,0,52,0,2,2,112,4,250,0,52,0,2,2,92,4,250,0,
+50,0,2,3,9,4,250,0,51,0,2,4,28,4,250,0,66,0,2,2,247,4,250,0,57,0,2,3,149,
+4,250,0,68,0,2,3,163,4,250,0,76,0,2,2,82,4,250,0,34,0,2,2,82,4,250,0,39,0,
+2,3,149,4,250,0,52,0,2,2,112,4,250,0,52,0,2,2,92,4,250,0,50,0,2,3,9,4,250,
+0,51,0,2,4,28,4,250,0,66,0,2,2,228,4,250,0,73,0,2,2,228,4,250,0,91,0,2,2,
+228,4,250,0,73,0,2,2,228,4,250,0,91,0,2,1,234,4,250,0,55,0,2,1,234,4,250,
+0,70,0,2,2,92,4,250,0,81,0,2,2,92,4,250,0,84,0,2,2,92,4,250,0,77,0,2,1,234,
+4,250,0,55,0,2,1,234,4,250,0,70,0,2,2,92,4,250,0,94,0,2,2,92,4,250,0,84,0,
+2,2,92,4,250,0,77,0,2,3,219,4,250,0,51,0,2,3,149,4,250,0,75,0,2,3,149,4,250,
+0,80,0,2,2,82,4,250,0,67,0,2,2,82,4,250,0,76,0,2,2,82,4,250,0,68,0,2,2,82,
+4,250,0,81,0,2,2,82,4,250,0,69,0,2,3,149,4,250,0,93,0,2,3,149,4,250,0,89,
+0,2,3,149,4,250,0,102,0,2,2,112,4,250,0,92,0,2,3,236,4,250,0,89,0,2,2,92,
+4,250,0,62,0,2,3,61,4,250,0,76,0,2,4,135,4,250,0,93,0,2,3,41,4,250,0,71,0,
+2,4,136,4,250,0,103,0,2,2,133,4,250,0,69,0,2,3,99,4,250,0,54,0,2,4,36,4,250,
+0,80,0,2,3,142,4,250,0,70,0,2,4,66,4,250,0,88,0,2,4,36,4,250,0,83,0,2,3,195,
+4,250,0,58,0,2,3,195,4,250,0,58,0,2,3,195,4,250,0,58,0,2,3,195,4,250,0,58,
+0,2,6,217,4,250,0,94,0,2,4,67,4,250,0,65,0,2,4,67,4,250,0,65,0,2,4,67,4,250,
+0,69,0,2,4,67,4,250,0,69,0,2,3,149,4,250,0,67,0,2,3,163,4,250,0,74,0,2,2,
+82,4,250,0,36,0,2,2,82,4,250,0,37,0,2,3,149,4,250,0,51,0,2,2,112,4,250,0,
+49,0,2,4,28,4,250,0,67,0,2,3,195,4,250,0,52,0,2,3,149,4,250,0,67,0,2,3,163,
+4,250,0,74,0,2,2,82,4,250,0,36,0,2,2,82,4,250,0,37,0,2,3,149,4,250,0,51,0,
+2,2,112,4,250,0,49,0,2,4,28,4,250,0,67,0,2,3,195,4,250,0,52,0,2,2,133,4,250,
+0,67,0,2,4,195,4,250,0,90,0,2,1,208,4,250,0,25,0,2,1,218,4,250,0,25,0,2,1,
+218,4,250,0,42,0,2,1,208,4,250,0,59,0,2,1,208,4,250,0,72,0,2,1,208,4,250,
+0,62,0,2,2,228,4,250,0,61,0,2,2,180,4,250,0,76,0,2,2,180,4,250,0,67,0,2,2,
+180,4,250,0,80,0,2,1,216,4,250,0,62,0,2,1,154,4,250,0,60,0,2,1,236,4,250,
+0,65,0,4,0,0,0,1,0,8,0,1,0,12,0,24,0,1,0,40,0,90,0,1,0,4,0,85,3,29,3,56,3,
+58,0,2,0,2,0,65,0,65,0,0,0,106,0,115,0,1,0,4,0,0,0,18,0,0,0,26,0,0,0,34,0,
+0,0,42,0,2,254,164,4,250,0,4,0,2,254,164,4,250,0,41,0,2,254,60,4,250,0,9,
+0,2,254,61,4,250,0,5,0,11,0,24,0,32,0,40,0,48,0,56,0,64,0,72,0,80,0,88,0,
+96,0,104,0,2,1,139,4,250,0,48,0,2,1,226,4,250,0,32,0,2,1,226,4,250,0,47,0,
+2,1,226,4,250,0,40,0,2,1,226,4,250,0,56,0,2,1,226,4,250,0,64,0,2,1,226,4,
+250,0,38,0,2,1,226,4,250,0,64,0,2,1,226,4,250,0,41,0,2,1,226,4,250,0,32,0,
+2,1,226,4,250,0,49,0,4,0,0,0,1,0,8,0,1,0,12,0,58,0,1,0,172,3,42,0,2,0,7,0,
+69,0,72,0,0,0,81,0,81,0,4,0,102,0,103,0,5,2,107,2,122,0,7,2,144,2,169,0,23,
+2,218,2,220,0,49,3,85,3,85,0,52,0,1,0,55,0,25,0,27,0,29,0,31,0,35,0,36,0,
+37,0,38,0,42,0,44,0,47,0,52,0,53,0,55,0,56,0,92,0,98,0,124,0,130,0,167,0,
+254,1,0,1,15,1,17,1,19,1,37,1,54,1,58,1,227,1,228,1,229,1,248,1,249,1,250,
+1,251,1,252,1,253,1,255,2,12,2,14,2,22,2,26,2,35,2,36,2,39,2,40,2,127,2,128,
+2,129,2,130,2,131,2,132,2,133,2,172,2,173,0,53,0,0,0,214,0,0,0,222,0,0,0,
+230,0,0,0,238,0,0,0,246,0,0,0,254,0,0,1,6,0,0,1,14,0,0,1,22,0,0,1,30,0,0,
+1,38,0,0,1,46,0,0,1,54,0,0,1,62,0,0,1,70,0,0,1,78,0,0,1,86,0,0,1,94,0,0,1,
+102,0,0,1,110,0,0,1,118,0,0,1,126,0,0,1,134,0,0,1,142,0,0,1,150,0,0,1,158,
+0,0,1,166,0,0,1,174,0,0,1,182,0,0,1,190,0,0,1,198,0,0,1,206,0,0,1,214,0,0,
+1,222,0,0,1,230,0,0,1,238,0,0,1,246,0,0,1,254,0,0,2,6,0,0,2,14,0,0,2,22,0,
+0,2,30,0,0,2,38,0,0,2,46,0,0,2,54,0,0,2,62,0,0,2,70,0,0,2,78,0,0,2,86,0,0,
+2,94,0,0,2,102,0,0,2,110,0,0,2,118,0,2,254,164,0,0,0,31,0,2,254,164,0,0,0,
+32,0,2,254,164,0,0,0,24,0,2,254,164,0,0,0,41,0,2,254,164,0,0,0,16,0,2,254,
+164,0,0,0,78,0,2,254,164,0,0,0,97,0,2,254,164,0,0,0,45,0,2,254,34,0,0,0,45,
+0,2,254,164,0,0,0,29,0,2,254,164,0,0,0,48,0,2,254,34,0,0,0,48,0,2,254,164,
+0,0,0,40,0,2,254,34,0,0,0,40,0,2,254,164,0,0,0,57,0,2,254,34,0,0,0,57,0,2,
+254,34,0,0,0,78,0,2,254,164,0,0,0,94,0,2,254,34,0,0,0,94,0,2,254,164,0,0,
+0,113,0,2,254,34,0,0,0,97,0,2,254,34,0,0,0,113,0,2,254,164,0,0,0,32,0,2,254,
+84,0,0,0,36,0,2,254,84,0,0,0,36,0,2,254,84,0,0,0,36,0,2,254,84,0,0,0,38,0,
+2,254,84,0,0,0,38,0,2,254,84,0,0,0,38,0,2,254,84,0,0,0,29,0,2,254,84,0,0,
+0,29,0,2,254,84,0,0,0,29,0,2,254,84,0,0,0,48,0,2,254,84,0,0,0,71,0,2,254,
+84,0,0,0,89,0,2,254,84,0,0,0,23,0,2,254,84,0,0,0,23,0,2,254,84,0,0,0,23,0,
+2,254,84,0,0,0,21,0,2,254,84,0,0,0,21,0,2,254,84,0,0,0,32,0,2,254,84,0,0,
+0,32,0,2,254,164,0,0,0,31,0,2,254,164,0,0,0,32,0,2,254,164,0,0,0,24,0,2,254,
+164,0,0,0,41,0,2,254,34,0,0,0,64,0,2,254,34,0,0,0,82,0,2,254,164,0,0,0,16,
+0,2,254,84,0,0,0,41,0,2,254,84,0,0,0,55,0,2,254,84,0,0,0,72,0,2,254,164,0,
+0,0,4,0,55,0,112,0,120,0,128,0,136,0,144,0,152,0,160,0,168,0,176,0,184,0,
+192,0,200,0,208,0,216,0,224,0,232,0,240,0,248,1,0,1,8,1,16,1,24,1,32,1,40,
+1,48,1,56,1,64,1,72,1,80,1,88,1,96,1,104,1,112,1,120,1,128,1,136,1,144,1,
+152,1,160,1,168,1,176,1,184,1,192,1,200,1,208,1,216,1,224,1,232,1,240,1,248,
+2,0,2,8,2,16,2,24,2,32,0,2,2,247,0,0,0,25,0,2,3,38,0,0,0,21,0,2,3,14,0,0,
+0,69,0,2,3,44,0,0,0,77,0,2,2,82,0,0,0,35,0,2,2,148,0,0,0,40,0,2,3,14,0,0,
+0,53,0,2,2,112,0,0,0,53,0,2,3,44,0,0,0,54,0,2,3,20,0,0,0,6,0,2,3,9,0,0,0,
+0,0,2,1,186,0,0,0,36,0,2,1,186,0,0,0,36,0,2,4,28,0,0,0,67,0,2,4,28,0,0,0,
+67,0,2,2,247,0,0,0,25,0,2,3,9,0,0,0,0,0,2,2,70,0,0,0,35,0,2,3,14,0,0,0,55,
+0,2,3,44,0,0,0,54,0,2,2,247,0,0,0,25,0,2,3,38,0,0,0,25,0,2,3,44,0,0,0,51,
+0,2,3,20,0,0,0,6,0,2,3,9,0,0,0,0,0,2,2,247,0,0,0,25,0,2,3,44,0,0,0,51,0,2,
+3,9,0,0,0,0,0,2,3,219,0,0,0,25,0,2,3,149,0,0,0,76,0,2,3,176,0,0,0,81,0,2,
+4,208,0,0,0,90,0,2,3,64,0,0,0,63,0,2,4,33,0,0,0,77,0,2,5,107,0,0,0,94,0,2,
+4,13,0,0,0,72,0,2,5,108,0,0,0,104,0,2,3,84,0,0,0,70,0,2,2,170,0,0,0,45,0,
+2,2,150,0,0,0,55,0,2,3,195,0,0,0,59,0,2,6,217,0,0,0,95,0,2,4,67,0,0,0,64,
+0,2,4,67,0,0,0,64,0,2,4,67,0,0,0,64,0,2,4,67,0,0,0,64,0,2,3,6,0,0,0,68,0,
+2,3,9,0,0,0,75,0,2,2,78,0,0,0,37,0,2,2,163,0,0,0,38,0,2,3,6,0,0,0,52,0,2,
+2,144,0,0,0,50,0,2,4,44,0,0,0,68,0,2,3,29,0,0,0,68,0,2,5,142,0,0,0,91,0,4,
+0,0,0,1,0,8,0,1,0,12,0,48,0,1,0,232,1,138,0,1,0,16,0,86,0,90,0,91,2,124,2,
+126,2,170,2,171,3,61,3,62,3,63,3,64,3,65,3,68,3,69,3,70,3,71,0,1,0,90,0,10,
+0,13,0,14,0,15,0,16,0,19,0,20,0,23,0,24,0,25,0,29,0,31,0,35,0,36,0,37,0,38,
+0,42,0,47,0,52,0,61,0,92,0,98,0,100,0,107,0,109,0,254,1,2,1,4,1,8,1,9,1,10,
+1,11,1,15,1,19,1,24,1,147,1,148,1,149,1,150,1,155,1,156,1,157,1,158,1,211,
+1,212,1,227,1,228,1,229,1,235,1,238,1,240,1,244,1,248,1,249,1,250,1,251,1,
+252,1,253,1,255,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,127,2,
+128,2,129,2,130,2,131,2,132,2,172,2,173,3,46,3,47,3,48,3,49,3,50,3,51,3,81,
+3,82,3,83,3,84,3,86,3,87,3,88,0,16,0,0,0,66,0,0,0,72,0,0,0,78,0,0,0,84,0,
+0,0,90,0,0,0,96,0,0,0,102,0,0,0,108,0,0,0,114,0,0,0,120,0,0,0,126,0,0,0,132,
+0,0,0,138,0,0,0,144,0,0,0,150,0,0,0,156,0,1,254,3,0,0,0,1,253,143,0,0,0,1,
+253,143,0,0,0,1,253,73,0,0,0,1,253,73,0,0,0,1,253,143,0,0,0,1,253,143,0,0,
+0,1,254,8,0,0,0,1,253,229,0,0,0,1,253,247,0,0,0,1,254,223,0,0,0,1,254,233,
+0,0,0,1,254,247,0,0,0,1,254,253,0,0,0,1,254,108,0,0,0,1,253,219,0,0,0,90,
+0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,
+254,1,4,1,10,1,16,1,22,1,28,1,34,1,40,1,46,1,52,1,58,1,64,1,70,1,76,1,82,
+1,88,1,94,1,100,1,106,1,112,1,118,1,124,1,130,1,136,1,142,1,148,1,154,1,160,
+1,166,1,172,1,178,1,184,1,190,1,196,1,202,1,208,1,214,1,220,1,226,1,232,1,
+238,1,244,1,250,2,0,2,6,2,12,2,18,2,24,2,30,2,36,2,42,2,48,2,54,2,60,2,66,
+2,72,2,78,2,84,2,90,2,96,2,102,2,108,2,114,2,120,2,126,2,132,2,138,2,144,
+2,150,2,156,2,162,2,168,2,174,2,180,2,186,2,192,2,198,2,204,0,1,4,57,0,0,
+0,1,2,101,0,0,0,1,2,101,0,0,0,1,3,96,0,0,0,1,2,206,0,0,0,1,2,54,0,0,0,1,2,
+54,0,0,0,1,4,57,0,0,0,1,4,57,0,0,0,1,3,73,0,0,0,1,2,210,0,0,0,1,2,200,0,0,
+0,1,2,55,0,0,0,1,2,87,0,0,0,1,2,210,0,0,0,1,2,71,0,0,0,1,2,59,0,0,0,1,3,91,
+0,0,0,1,1,163,0,0,0,1,2,32,0,0,0,1,3,73,0,0,0,1,3,91,0,0,0,1,3,96,0,0,0,1,
+2,52,0,0,0,1,2,52,0,0,0,1,3,73,0,0,0,1,2,210,0,0,0,1,2,200,0,0,0,1,2,55,0,
+0,0,1,2,87,0,0,0,1,2,245,0,0,0,1,2,71,0,0,0,1,2,59,0,0,0,1,3,91,0,0,0,1,1,
+163,0,0,0,1,2,32,0,0,0,1,2,32,0,0,0,1,2,32,0,0,0,1,2,32,0,0,0,1,2,68,0,0,
+0,1,2,68,0,0,0,1,2,60,0,0,0,1,3,55,0,0,0,1,4,57,0,0,0,1,4,57,0,0,0,1,4,45,
+0,0,0,1,2,230,0,0,0,1,2,230,0,0,0,1,2,87,0,0,0,1,2,87,0,0,0,1,2,151,0,0,0,
+1,2,71,0,0,0,1,3,215,0,0,0,1,2,60,0,0,0,1,3,37,0,0,0,1,4,159,0,0,0,1,2,243,
+0,0,0,1,4,137,0,0,0,1,2,66,0,0,0,1,2,80,0,0,0,1,2,80,0,0,0,1,2,134,0,0,0,
+1,2,134,0,0,0,1,3,185,0,0,0,1,3,27,0,0,0,1,4,31,0,0,0,1,4,13,0,0,0,1,3,239,
+0,0,0,1,3,228,0,0,0,1,2,210,0,0,0,1,2,200,0,0,0,1,2,55,0,0,0,1,2,87,0,0,0,
+1,2,210,0,0,0,1,2,71,0,0,0,1,2,63,0,0,0,1,4,159,0,0,0,1,2,23,0,0,0,1,2,33,
+0,0,0,1,2,33,0,0,0,1,2,33,0,0,0,1,2,33,0,0,0,1,2,33,0,0,0,1,3,49,0,0,0,1,
+2,254,0,0,0,1,3,1,0,0,0,1,3,1,0,0,0,1,2,39,0,0,0,1,1,215,0,0,0,1,2,44,0,0,
+0,2,0,8,0,1,0,8,0,1,0,42,0,4,0,0,0,16,0,78,0,132,0,154,0,204,0,238,1,48,1,
+86,1,128,1,194,1,200,1,214,2,4,2,30,2,36,2,42,2,56,0,1,0,16,0,183,0,184,0,
+190,0,198,0,202,0,204,0,205,0,210,0,211,0,212,0,214,0,216,0,219,1,247,2,2,
+2,37,0,13,0,25,255,156,0,26,255,156,0,32,255,156,0,35,255,156,0,39,255,136,
+0,40,255,126,0,42,255,156,0,46,255,136,0,47,255,136,0,51,255,136,0,54,255,
+156,0,57,255,156,0,60,255,156,0,5,0,26,255,96,0,40,255,86,0,50,255,146,0,
+51,255,126,0,57,255,136,0,12,0,25,255,126,0,32,255,226,0,33,255,106,0,35,
+255,126,0,37,255,116,0,40,255,126,0,42,255,126,0,44,255,196,0,48,255,126,
+0,50,255,126,0,51,255,126,0,57,255,86,0,8,0,25,255,136,0,26,255,136,0,46,
+255,136,0,47,255,136,0,51,255,146,0,54,255,116,0,57,255,136,0,60,255,136,
+0,16,0,25,255,166,0,31,255,166,0,35,255,166,0,40,255,156,0,42,255,156,0,46,
+255,126,0,47,255,126,0,51,255,126,0,57,255,166,0,60,255,166,0,61,255,136,
+1,15,255,156,1,159,255,156,1,160,255,156,1,252,254,212,1,253,255,206,0,9,
+0,32,255,156,0,35,255,156,0,40,255,126,0,46,255,136,0,47,255,136,0,51,255,
+136,0,54,255,156,0,57,255,176,0,60,255,156,0,10,0,32,255,156,0,33,255,156,
+0,40,255,136,0,42,255,156,0,48,255,156,0,50,255,156,0,51,255,116,0,54,255,
+146,0,57,255,156,0,60,255,196,0,16,0,25,255,156,0,32,255,206,0,35,255,166,
+0,36,255,176,0,37,255,176,0,38,255,156,0,40,255,146,0,42,255,156,0,46,255,
+136,0,47,255,136,0,48,255,156,0,50,255,186,0,51,255,176,0,54,255,146,0,57,
+255,156,0,61,255,136,0,1,0,51,255,76,0,3,0,54,255,146,0,57,255,156,0,61,255,
+216,0,11,0,25,255,186,0,35,255,236,0,36,255,236,0,39,255,146,0,46,255,146,
+0,47,255,146,0,50,255,236,0,51,255,206,0,59,255,146,1,8,255,236,1,9,255,236,
+0,6,0,39,255,196,0,44,255,186,0,50,255,216,0,51,255,186,0,54,255,206,2,22,
+255,206,0,1,0,57,255,206,0,1,0,57,255,136,0,3,0,50,255,126,0,51,255,86,0,
+54,255,166,0,2,0,51,255,146,0,57,255,183,0,8,0,0,0,1,0,8,0,2,0,16,0,24,0,
+58,0,68,0,2,0,0,0,76,0,1,0,2,0,90,0,91,0,2,0,5,0,33,0,33,0,1,0,42,0,42,0,
+1,0,255,0,255,0,1,1,6,1,6,0,1,1,15,1,15,0,1,0,1,0,90,0,2,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,6,0,1,0,0,0,1,0,8,0,2,0,12,0,2,
+0,2,255,166,255,111,0,1,0,2,0,90,0,91,0,8,2,0,0,1,0,8,0,2,0,16,0,42,1,126,
+1,154,0,2,0,0,1,162,0,1,0,11,0,86,3,61,3,62,3,63,3,64,3,65,3,68,3,69,3,70,
+3,71,3,85,0,2,0,56,0,11,0,12,0,2,0,16,0,16,0,2,0,19,0,20,0,3,0,33,0,33,0,
+2,0,61,0,61,0,3,0,69,0,72,0,1,0,81,0,81,0,3,0,102,0,103,0,1,0,107,0,107,0,
+2,0,109,0,109,0,2,0,182,0,182,0,4,1,2,1,2,0,4,1,4,1,4,0,4,1,6,1,6,0,2,1,8,
+1,11,0,4,1,15,1,15,0,2,1,26,1,26,0,4,1,31,1,31,0,4,1,41,1,41,0,1,1,43,1,43,
+0,1,1,47,1,50,0,1,1,65,1,65,0,1,1,76,1,76,0,1,1,83,1,83,0,1,1,85,1,85,0,1,
+1,87,1,87,0,1,1,89,1,89,0,1,1,109,1,109,0,4,1,147,1,156,0,1,1,159,1,161,0,
+1,1,164,1,166,0,1,1,205,1,205,0,2,1,208,1,208,0,3,1,228,1,229,0,4,1,233,1,
+233,0,1,1,235,1,235,0,1,1,238,1,238,0,1,1,240,1,241,0,1,1,244,1,244,0,1,1,
+248,1,255,0,3,2,6,2,6,0,3,2,8,2,8,0,3,2,13,2,13,0,4,2,15,2,21,0,4,2,24,2,
+24,0,4,2,25,2,25,0,1,2,107,2,113,0,1,2,116,2,116,0,1,2,120,2,120,0,1,2,144,
+2,144,0,1,2,147,2,147,0,1,2,150,2,150,0,1,2,153,2,156,0,1,2,163,2,169,0,1,
+2,218,2,220,0,1,3,48,3,48,0,4,0,2,0,4,0,86,0,86,0,1,3,61,3,65,0,1,3,68,3,
+71,0,1,3,85,3,85,0,1,0,1,0,1,0,1,0,1,0,4,0,10,0,24,0,38,0,52,0,1,0,1,0,1,
+0,0,0,1,0,0,0,8,0,1,0,2,0,1,0,0,0,1,0,0,0,9,0,1,0,3,0,1,0,0,0,1,0,0,0,10,
+0,1,0,4,0,1,0,0,0,1,0,0,0,11,0,1,0,0,0,1,0,8,0,2,0,30,0,2,0,11,254,32,254,
+32,254,32,254,32,254,32,254,12,254,12,254,102,254,32,254,32,254,32,0,1,0,
+11,0,86,3,61,3,62,3,63,3,64,3,65,3,68,3,69,3,70,3,71,3,85,0,1,0,0,0,1,0,8,
+0,1,0,8,0,2,255,136,0,1,0,11,0,86,3,61,3,62,3,63,3,64,3,65,3,68,3,69,3,70,
+3,71,3,85,0,1,0,0,0,1,0,8,0,2,0,30,0,2,0,11,254,252,254,252,254,252,254,252,
+254,252,254,252,254,252,255,56,254,252,254,252,254,252,0,1,0,11,0,86,3,61,
+3,62,3,63,3,64,3,65,3,68,3,69,3,70,3,71,3,85,0,1,0,0,0,1,0,8,0,2,0,30,0,2,
+0,11,254,132,254,132,254,132,254,132,254,132,254,132,254,132,254,202,254,
+132,254,132,254,132,0,1,0,11,0,86,3,61,3,62,3,63,3,64,3,65,3,68,3,69,3,70,
+3,71,3,85,0,8,0,0,0,1,0,8,0,2,0,20,0,60,1,114,1,184,0,4,0,0,1,200,2,216,2,
+234,0,1,0,18,0,5,0,6,0,85,0,181,1,182,1,183,1,184,1,185,1,186,1,187,1,203,
+2,174,2,175,2,180,2,181,2,195,2,196,3,66,0,2,0,51,0,5,0,5,0,7,0,6,0,6,0,6,
+0,20,0,20,0,8,0,23,0,24,0,8,0,25,0,61,0,1,0,67,0,67,0,2,0,68,0,68,0,8,0,75,
+0,76,0,8,0,79,0,80,0,8,0,92,0,99,0,1,0,148,0,148,0,8,0,151,0,152,0,8,0,156,
+0,180,0,1,0,181,0,181,0,5,0,254,1,31,0,1,1,35,1,70,0,1,1,173,1,173,0,3,1,
+174,1,175,0,9,1,182,1,182,0,10,1,183,1,184,0,3,1,185,1,185,0,10,1,186,1,187,
+0,3,1,203,1,203,0,5,1,227,1,229,0,1,1,233,1,233,0,1,1,235,1,235,0,1,1,237,
+1,238,0,1,1,240,1,241,0,1,1,244,1,244,0,1,1,246,1,246,0,1,1,248,1,253,0,1,
+1,255,2,1,0,1,2,4,2,6,0,1,2,8,2,8,0,1,2,11,2,25,0,1,2,27,2,27,0,1,2,29,2,
+29,0,1,2,46,2,57,0,2,2,58,2,69,0,4,2,94,2,94,0,3,2,95,2,97,0,8,2,98,2,98,
+0,3,2,99,2,100,0,10,2,101,2,106,0,9,2,174,2,174,0,7,2,175,2,175,0,12,2,180,
+2,181,0,13,2,187,2,190,0,11,2,195,2,196,0,14,2,202,2,213,0,16,2,214,2,217,
+0,15,0,2,0,11,0,5,0,5,0,3,0,6,0,6,0,2,0,85,0,85,0,1,0,181,0,181,0,2,1,182,
+1,187,0,2,1,203,1,203,0,2,2,174,2,174,0,3,2,175,2,175,0,2,2,180,2,181,0,2,
+2,195,2,196,0,2,3,66,3,66,0,1,0,2,0,2,0,85,0,85,0,1,3,66,3,66,0,1,0,16,0,
+34,0,50,0,68,0,86,0,100,0,114,0,128,0,146,0,160,0,174,0,188,0,202,0,216,0,
+230,0,244,1,2,0,2,0,1,0,2,0,1,0,0,0,1,0,0,0,16,0,3,0,3,0,1,0,4,0,1,0,0,0,
+1,0,0,0,17,0,3,0,3,0,1,0,16,0,1,0,0,0,1,0,0,0,19,0,1,0,3,0,1,0,0,0,1,0,0,
+0,18,0,1,0,5,0,1,0,0,0,1,0,0,0,20,0,1,0,6,0,1,0,0,0,1,0,0,0,24,0,3,0,7,0,
+1,0,2,0,1,0,0,0,1,0,0,0,21,0,1,0,7,0,1,0,0,0,1,0,0,0,20,0,1,0,8,0,1,0,0,0,
+1,0,0,0,25,0,1,0,9,0,1,0,0,0,1,0,0,0,26,0,1,0,10,0,1,0,0,0,1,0,0,0,27,0,1,
+0,11,0,1,0,0,0,1,0,0,0,28,0,1,0,12,0,1,0,0,0,1,0,0,0,13,0,1,0,13,0,1,0,0,
+0,1,0,0,0,14,0,1,0,14,0,1,0,0,0,1,0,0,0,15,0,1,0,15,0,1,0,0,0,1,0,0,0,29,
+0,1,0,4,0,0,0,1,0,1,0,1,0,1,0,0,0,22,0,2,0,6,0,24,0,2,0,1,0,2,0,1,0,1,0,1,
+0,1,0,0,0,23,0,0,0,1,0,1,0,1,0,1,0,0,0,22,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,
+2,1,194,2,38,0,1,0,2,0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,2,78,2,178,
+0,1,0,2,0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,2,138,2,238,0,1,0,2,0,
+85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,0,75,0,175,0,1,0,2,0,85,3,66,0,1,
+0,0,0,1,0,8,0,2,0,12,0,1,0,2,1,34,1,134,0,1,0,2,0,85,3,66,0,1,0,0,0,1,0,8,
+0,2,0,12,0,1,0,2,1,184,2,28,0,1,0,2,0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,
+1,0,2,2,138,2,238,0,1,0,2,0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,1,69,
+1,169,0,1,0,2,0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,1,194,2,38,0,1,0,
+2,0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,40,0,1,0,16,255,71,255,176,255,156,255,
+211,255,211,255,211,255,211,255,211,255,211,255,156,255,121,255,71,255,211,
+255,211,255,211,255,211,0,1,0,16,0,5,0,6,0,181,1,182,1,183,1,184,1,185,1,
+186,1,187,1,203,2,174,2,175,2,180,2,181,2,195,2,196,0,1,0,0,0,1,0,8,0,2,0,
+12,0,1,0,2,255,206,255,255,0,1,0,2,0,5,2,174,0,1,0,0,0,1,0,8,0,2,0,12,0,1,
+0,2,0,200,1,44,0,1,0,2,0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,0,180,1,
+24,0,1,0,2,0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,1,224,2,68,0,1,0,2,
+0,85,3,66,0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,1,104,1,204,0,1,0,2,0,85,3,66,
+0,1,0,0,0,1,0,8,0,2,0,12,0,1,0,2,2,38,2,138,0,1,0,2,0,85,3,66,0,1,0,0,0,1,
+0,8,0,2,0,12,0,1,0,2,2,188,3,32,0,1,0,2,0,85,3,66,0,6,0,0,0,1,0,8,0,1,0,12,
+0,18,0,1,0,24,0,36,0,1,0,1,3,71,0,1,0,1,3,71,0,1,0,0,0,6,0,1,253,219,255,
+166,0,1,0,4,0,1,253,219,254,102,0,0,0,1,0,0,0,10,0,242,2,40,0,2,100,101,118,
+50,0,14,100,101,118,97,0,30,0,32,0,2,77,65,82,32,0,64,78,69,80,32,0,96,0,
+112,0,2,77,65,82,32,0,142,78,69,80,32,0,172,0,0,255,255,0,13,0,15,0,1,0,20,
+0,19,0,3,0,10,0,6,0,16,0,0,0,4,0,18,0,12,0,5,0,0,255,255,0,13,0,13,0,15,0,
+1,0,20,0,19,0,3,0,10,0,6,0,16,0,0,0,4,0,18,0,12,0,0,255,255,0,13,0,14,0,15,
+0,1,0,20,0,19,0,3,0,11,0,7,0,17,0,0,0,4,0,18,0,12,0,0,255,255,0,12,0,15,0,
+1,0,20,0,2,0,8,0,21,0,16,0,0,0,4,0,18,0,12,0,5,0,0,255,255,0,12,0,13,0,15,
+0,1,0,20,0,2,0,8,0,21,0,16,0,0,0,4,0,18,0,12,0,0,255,255,0,12,0,14,0,15,0,
+1,0,20,0,2,0,9,0,21,0,17,0,0,0,4,0,18,0,12,0,22,97,98,118,115,0,134,97,107,
+104,110,0,152,98,108,119,102,0,158,98,108,119,102,0,164,98,108,119,115,0,
+170,99,97,108,116,0,190,99,106,99,116,0,196,99,106,99,116,0,202,104,97,108,
+102,0,208,104,97,108,102,0,214,104,97,108,102,0,220,104,97,108,102,0,228,
+104,97,108,110,0,236,108,111,99,108,0,242,108,111,99,108,0,248,110,117,107,
+116,0,254,112,114,101,115,1,4,112,114,101,115,1,12,112,115,116,115,1,20,114,
+107,114,102,1,30,114,112,104,102,1,38,118,97,116,117,1,44,0,0,0,7,0,25,0,
+27,0,28,0,29,0,31,0,79,0,85,0,0,0,1,0,3,0,0,0,1,0,6,0,0,0,1,0,17,0,0,0,8,
+0,87,0,89,0,90,0,95,0,96,0,101,0,102,0,106,0,0,0,1,0,118,0,0,0,1,0,19,0,0,
+0,1,0,20,0,0,0,1,0,9,0,0,0,1,0,10,0,0,0,2,0,11,0,12,0,0,0,2,0,13,0,14,0,0,
+0,1,0,117,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,2,0,0,0,2,0,21,0,23,0,0,0,2,0,
+22,0,24,0,0,0,3,0,110,0,114,0,116,0,0,0,2,0,5,0,7,0,0,0,1,0,4,0,0,0,3,0,15,
+0,16,0,17,0,120,0,242,1,12,1,74,4,62,4,112,4,144,9,36,9,68,9,166,9,198,13,
+178,17,130,21,104,24,128,28,58,31,58,35,48,38,246,39,76,39,104,40,170,40,
+214,42,246,43,86,43,192,43,254,45,90,46,102,47,10,50,134,50,192,50,212,59,
+206,63,142,67,42,70,126,73,184,76,194,79,168,82,160,85,134,88,96,91,46,93,
+160,96,18,98,138,100,246,102,180,104,228,107,38,109,62,111,38,113,2,114,100,
+115,144,116,170,117,164,118,158,119,152,120,140,121,134,122,146,123,146,124,
+110,125,38,125,222,126,130,127,2,131,36,131,56,131,76,131,96,131,116,131,
+136,131,156,131,176,131,196,131,216,131,236,132,0,133,18,133,52,133,76,133,
+100,133,124,133,148,135,48,135,68,135,168,135,194,137,158,138,72,138,92,139,
+60,139,102,141,44,143,60,145,102,145,122,147,212,148,44,148,70,150,62,151,
+92,151,186,152,4,152,92,152,186,152,212,152,238,153,8,154,164,154,206,154,
+248,155,34,156,102,156,122,156,178,157,192,158,46,0,1,0,0,0,1,0,8,0,2,0,10,
+0,2,2,22,2,27,0,1,0,2,0,54,0,58,0,1,0,0,0,1,0,8,0,2,0,28,0,11,2,35,2,43,2,
+44,2,45,2,36,2,37,2,38,2,39,2,40,2,41,2,42,0,1,0,11,0,33,0,111,0,114,0,115,
+0,160,0,191,0,229,1,6,1,45,1,80,1,122,0,4,0,0,0,1,0,8,0,1,2,178,0,57,0,120,
+0,130,0,140,0,150,0,160,0,170,0,180,0,190,0,200,0,210,0,220,0,230,0,240,0,
+250,1,4,1,14,1,24,1,34,1,44,1,54,1,64,1,74,1,84,1,94,1,104,1,114,1,124,1,
+134,1,144,1,154,1,164,1,174,1,184,1,194,1,204,1,214,1,224,1,234,1,244,1,254,
+2,8,2,18,2,28,2,38,2,48,2,58,2,68,2,78,2,88,2,98,2,108,2,118,2,128,2,138,
+2,148,2,158,2,168,0,1,0,4,0,136,0,2,0,64,0,1,0,4,0,137,0,2,0,64,0,1,0,4,0,
+138,0,2,0,64,0,1,0,4,0,139,0,2,0,64,0,1,0,4,0,140,0,2,0,64,0,1,0,4,0,141,
+0,2,0,64,0,1,0,4,0,142,0,2,0,64,0,1,0,4,0,143,0,2,0,64,0,1,0,4,0,144,0,2,
+0,64,0,1,0,4,0,145,0,2,0,64,0,1,0,4,0,146,0,2,0,64,0,1,0,4,0,147,0,2,0,64,
+0,1,0,4,0,148,0,2,0,64,0,1,0,4,0,149,0,2,0,64,0,1,0,4,0,150,0,2,0,64,0,1,
+0,4,0,151,0,2,0,64,0,1,0,4,0,152,0,2,0,64,0,1,0,4,0,92,0,2,0,64,0,1,0,4,0,
+93,0,2,0,64,0,1,0,4,0,94,0,2,0,64,0,1,0,4,0,156,0,2,0,64,0,1,0,4,0,157,0,
+2,0,64,0,1,0,4,0,158,0,2,0,64,0,1,0,4,0,159,0,2,0,64,0,1,0,4,0,95,0,2,0,64,
+0,1,0,4,0,160,0,2,0,64,0,1,0,4,0,161,0,2,0,64,0,1,0,4,0,162,0,2,0,64,0,1,
+0,4,0,163,0,2,0,64,0,1,0,4,0,96,0,2,0,64,0,1,0,4,0,97,0,2,0,64,0,1,0,4,0,
+164,0,2,0,64,0,1,0,4,0,165,0,2,0,64,0,1,0,4,0,166,0,2,0,64,0,1,0,4,0,167,
+0,2,0,64,0,1,0,4,0,168,0,2,0,64,0,1,0,4,0,45,0,2,0,64,0,1,0,4,0,169,0,2,0,
+64,0,1,0,4,0,98,0,2,0,64,0,1,0,4,0,170,0,2,0,64,0,1,0,4,0,171,0,2,0,64,0,
+1,0,4,0,172,0,2,0,64,0,1,0,4,0,99,0,2,0,64,0,1,0,4,0,53,0,2,0,64,0,1,0,4,
+0,173,0,2,0,64,0,1,0,4,0,56,0,2,0,64,0,1,0,4,0,174,0,2,0,64,0,1,0,4,0,175,
+0,2,0,64,0,1,0,4,0,176,0,2,0,64,0,1,0,4,0,177,0,2,0,64,0,1,0,4,0,178,0,2,
+0,64,0,1,0,4,0,153,0,2,0,64,0,1,0,4,0,154,0,2,0,64,0,1,0,4,0,155,0,2,0,64,
+0,1,0,4,2,23,0,2,0,64,0,1,0,4,2,29,0,2,0,64,0,1,0,4,2,36,0,2,0,64,0,2,0,9,
+0,8,0,44,0,0,0,46,0,52,0,37,0,54,0,55,0,44,0,57,0,61,0,46,0,100,0,101,0,51,
+0,118,0,118,0,53,2,22,2,22,0,54,2,27,2,27,0,55,2,35,2,35,0,56,0,4,0,0,0,1,
+0,8,0,1,0,34,0,2,0,10,0,22,0,1,0,4,0,179,0,3,0,81,0,59,0,1,0,4,0,180,0,3,
+0,81,0,34,0,1,0,2,0,25,0,32,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,181,
+0,2,0,81,0,1,0,1,0,52,0,4,0,0,0,1,0,8,0,1,4,88,0,79,0,164,0,176,0,188,0,200,
+0,212,0,224,0,236,0,248,1,4,1,16,1,28,1,40,1,52,1,64,1,76,1,88,1,100,1,112,
+1,124,1,136,1,148,1,160,1,172,1,184,1,196,1,208,1,220,1,232,1,244,2,0,2,12,
+2,24,2,36,2,48,2,60,2,72,2,84,2,96,2,108,2,120,2,132,2,144,2,156,2,168,2,
+180,2,192,2,204,2,216,2,228,2,240,2,252,3,8,3,20,3,32,3,44,3,56,3,68,3,80,
+3,92,3,104,3,116,3,128,3,140,3,152,3,164,3,176,3,188,3,200,3,212,3,224,3,
+236,3,248,4,4,4,16,4,28,4,40,4,52,4,64,4,76,0,1,0,4,0,254,0,3,0,81,0,52,0,
+1,0,4,0,255,0,3,0,81,0,52,0,1,0,4,1,0,0,3,0,81,0,52,0,1,0,4,1,1,0,3,0,81,
+0,52,0,1,0,4,1,2,0,3,0,81,0,52,0,1,0,4,1,3,0,3,0,81,0,52,0,1,0,4,1,4,0,3,
+0,81,0,52,0,1,0,4,1,5,0,3,0,81,0,52,0,1,0,4,1,6,0,3,0,81,0,52,0,1,0,4,1,7,
+0,3,0,81,0,52,0,1,0,4,1,8,0,3,0,81,0,52,0,1,0,4,1,9,0,3,0,81,0,52,0,1,0,4,
+1,10,0,3,0,81,0,52,0,1,0,4,1,11,0,3,0,81,0,52,0,1,0,4,1,12,0,3,0,81,0,52,
+0,1,0,4,1,13,0,3,0,81,0,52,0,1,0,4,1,14,0,3,0,81,0,52,0,1,0,4,1,15,0,3,0,
+81,0,52,0,1,0,4,1,16,0,3,0,81,0,52,0,1,0,4,1,17,0,3,0,81,0,52,0,1,0,4,1,56,
+0,3,0,81,0,52,0,1,0,4,1,18,0,3,0,81,0,52,0,1,0,4,1,19,0,3,0,81,0,52,0,1,0,
+4,1,20,0,3,0,81,0,52,0,1,0,4,1,21,0,3,0,81,0,52,0,1,0,4,1,22,0,3,0,81,0,52,
+0,1,0,4,1,23,0,3,0,81,0,52,0,1,0,4,1,24,0,3,0,81,0,52,0,1,0,4,1,63,0,3,0,
+81,0,52,0,1,0,4,1,25,0,3,0,81,0,52,0,1,0,4,1,26,0,3,0,81,0,52,0,1,0,4,1,65,
+0,3,0,81,0,52,0,1,0,4,1,27,0,3,0,81,0,52,0,1,0,4,1,28,0,3,0,81,0,52,0,1,0,
+4,1,29,0,3,0,81,0,52,0,1,0,4,1,30,0,3,0,81,0,52,0,1,0,4,1,31,0,3,0,81,0,52,
+0,1,0,4,1,37,0,3,0,81,0,52,0,1,0,4,1,38,0,3,0,81,0,52,0,1,0,4,1,39,0,3,0,
+81,0,52,0,1,0,4,1,44,0,3,0,81,0,52,0,1,0,4,1,49,0,3,0,81,0,52,0,1,0,4,1,50,
+0,3,0,81,0,52,0,1,0,4,1,58,0,3,0,81,0,52,0,1,0,4,1,62,0,3,0,81,0,52,0,1,0,
+4,1,32,0,3,0,81,0,52,0,1,0,4,1,33,0,3,0,81,0,52,0,1,0,4,1,34,0,3,0,81,0,52,
+0,1,0,4,1,40,0,3,0,81,0,52,0,1,0,4,1,41,0,3,0,81,0,52,0,1,0,4,1,42,0,3,0,
+81,0,52,0,1,0,4,1,43,0,3,0,81,0,52,0,1,0,4,1,45,0,3,0,81,0,52,0,1,0,4,1,46,
+0,3,0,81,0,52,0,1,0,4,1,47,0,3,0,81,0,52,0,1,0,4,1,48,0,3,0,81,0,52,0,1,0,
+4,1,51,0,3,0,81,0,52,0,1,0,4,1,52,0,3,0,81,0,52,0,1,0,4,1,53,0,3,0,81,0,52,
+0,1,0,4,1,54,0,3,0,81,0,52,0,1,0,4,1,55,0,3,0,81,0,52,0,1,0,4,1,57,0,3,0,
+81,0,52,0,1,0,4,1,59,0,3,0,81,0,52,0,1,0,4,1,60,0,3,0,81,0,52,0,1,0,4,1,61,
+0,3,0,81,0,52,0,1,0,4,1,64,0,3,0,81,0,52,0,1,0,4,1,66,0,3,0,81,0,52,0,1,0,
+4,1,67,0,3,0,81,0,52,0,1,0,4,1,68,0,3,0,81,0,52,0,1,0,4,1,69,0,3,0,81,0,52,
+0,1,0,4,1,70,0,3,0,81,0,52,0,1,0,4,1,35,0,3,0,81,0,52,0,1,0,4,1,36,0,3,0,
+81,0,52,0,1,0,4,2,24,0,3,0,81,0,52,0,1,0,4,2,25,0,3,0,81,0,52,0,1,0,4,1,28,
+0,3,0,81,0,52,0,1,0,4,1,67,0,3,0,81,0,52,0,1,0,4,2,39,0,3,0,81,0,52,0,1,0,
+4,2,40,0,3,0,81,0,52,0,2,0,8,0,25,0,61,0,0,0,92,0,99,0,37,0,124,0,126,0,45,
+0,156,0,180,0,48,2,22,2,23,0,73,2,27,2,27,0,75,2,29,2,29,0,76,2,35,2,36,0,
+77,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,182,0,2,0,81,0,1,0,1,0,52,0,
+5,0,0,0,1,0,8,0,1,0,14,0,4,0,26,0,42,0,58,0,74,0,1,0,4,0,127,0,128,0,130,
+0,131,0,1,0,4,0,3,0,1,0,81,0,52,0,1,0,8,0,1,0,4,0,3,0,1,0,81,0,52,0,1,0,8,
+0,1,0,4,0,3,0,1,0,81,0,52,0,1,0,8,0,1,0,4,0,3,0,1,0,81,0,52,0,1,0,8,0,4,0,
+0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,182,0,2,0,52,0,1,0,1,0,81,0,4,0,0,0,
+1,0,8,0,1,3,176,0,78,0,162,0,172,0,182,0,192,0,202,0,212,0,222,0,232,0,242,
+0,252,1,6,1,16,1,26,1,36,1,46,1,56,1,66,1,76,1,86,1,96,1,106,1,116,1,126,
+1,136,1,146,1,156,1,166,1,176,1,188,1,198,1,208,1,218,1,228,1,238,1,248,2,
+2,2,12,2,22,2,32,2,42,2,52,2,62,2,72,2,82,2,92,2,102,2,112,2,122,2,132,2,
+142,2,152,2,162,2,172,2,182,2,192,2,202,2,212,2,222,2,232,2,242,2,252,3,6,
+3,16,3,26,3,36,3,46,3,56,3,66,3,76,3,86,3,96,3,106,3,116,3,126,3,136,3,146,
+3,156,3,166,0,1,0,4,0,183,0,2,0,81,0,1,0,4,0,184,0,2,0,81,0,1,0,4,0,185,0,
+2,0,81,0,1,0,4,0,186,0,2,0,81,0,1,0,4,0,187,0,2,0,81,0,1,0,4,0,188,0,2,0,
+81,0,1,0,4,0,189,0,2,0,81,0,1,0,4,0,190,0,2,0,81,0,1,0,4,0,191,0,2,0,81,0,
+1,0,4,0,192,0,2,0,81,0,1,0,4,0,193,0,2,0,81,0,1,0,4,0,194,0,2,0,81,0,1,0,
+4,0,195,0,2,0,81,0,1,0,4,0,196,0,2,0,81,0,1,0,4,0,197,0,2,0,81,0,1,0,4,0,
+198,0,2,0,81,0,1,0,4,0,199,0,2,0,81,0,1,0,4,0,200,0,2,0,81,0,1,0,4,0,201,
+0,2,0,81,0,1,0,4,0,202,0,2,0,81,0,1,0,4,0,240,0,2,0,81,0,1,0,4,0,203,0,2,
+0,81,0,1,0,4,0,204,0,2,0,81,0,1,0,4,0,205,0,2,0,81,0,1,0,4,0,206,0,2,0,81,
+0,1,0,4,0,207,0,2,0,81,0,1,0,4,0,208,0,2,0,81,0,1,0,4,0,209,0,3,0,81,0,134,
+0,1,0,4,0,209,0,2,0,81,0,1,0,4,0,210,0,2,0,81,0,1,0,4,0,211,0,2,0,81,0,1,
+0,4,0,248,0,2,0,81,0,1,0,4,0,212,0,2,0,81,0,1,0,4,0,213,0,2,0,81,0,1,0,4,
+0,214,0,2,0,81,0,1,0,4,0,215,0,2,0,81,0,1,0,4,0,216,0,2,0,81,0,1,0,4,0,221,
+0,2,0,81,0,1,0,4,0,222,0,2,0,81,0,1,0,4,0,223,0,2,0,81,0,1,0,4,0,228,0,2,
+0,81,0,1,0,4,0,233,0,2,0,81,0,1,0,4,0,234,0,2,0,81,0,1,0,4,0,242,0,2,0,81,
+0,1,0,4,0,246,0,2,0,81,0,1,0,4,0,217,0,2,0,81,0,1,0,4,0,218,0,2,0,81,0,1,
+0,4,0,224,0,2,0,81,0,1,0,4,0,225,0,2,0,81,0,1,0,4,0,226,0,2,0,81,0,1,0,4,
+0,227,0,2,0,81,0,1,0,4,0,229,0,2,0,81,0,1,0,4,0,230,0,2,0,81,0,1,0,4,0,231,
+0,2,0,81,0,1,0,4,0,232,0,2,0,81,0,1,0,4,0,235,0,2,0,81,0,1,0,4,0,236,0,2,
+0,81,0,1,0,4,0,237,0,2,0,81,0,1,0,4,0,238,0,2,0,81,0,1,0,4,0,239,0,2,0,81,
+0,1,0,4,0,241,0,2,0,81,0,1,0,4,0,243,0,2,0,81,0,1,0,4,0,244,0,2,0,81,0,1,
+0,4,0,245,0,2,0,81,0,1,0,4,0,247,0,2,0,81,0,1,0,4,0,249,0,2,0,81,0,1,0,4,
+0,250,0,2,0,81,0,1,0,4,0,251,0,2,0,81,0,1,0,4,0,252,0,2,0,81,0,1,0,4,0,253,
+0,2,0,81,0,1,0,4,0,219,0,2,0,81,0,1,0,4,0,220,0,2,0,81,0,1,0,4,0,210,0,2,
+0,81,0,1,0,4,0,247,0,2,0,81,0,1,0,4,2,28,0,2,0,81,0,1,0,4,2,30,0,2,0,81,0,
+1,0,4,2,37,0,2,0,81,0,1,0,4,2,38,0,2,0,81,0,2,0,8,0,25,0,61,0,0,0,92,0,99,
+0,37,0,125,0,126,0,45,0,156,0,180,0,47,2,22,2,23,0,72,2,27,2,27,0,74,2,29,
+2,29,0,75,2,35,2,36,0,76,0,4,0,0,0,1,0,8,0,1,3,160,0,75,0,156,0,166,0,176,
+0,186,0,196,0,206,0,216,0,236,0,246,1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,
+1,80,1,90,1,100,1,110,1,120,1,130,1,140,1,150,1,160,1,170,1,180,1,192,1,202,
+1,212,1,222,1,232,1,242,1,252,2,6,2,16,2,26,2,36,2,46,2,56,2,66,2,76,2,86,
+2,96,2,106,2,116,2,126,2,136,2,146,2,156,2,176,2,186,2,196,2,206,2,216,2,
+226,2,236,2,246,3,0,3,10,3,20,3,30,3,40,3,50,3,60,3,70,3,80,3,90,3,100,3,
+110,3,120,3,130,3,140,3,150,0,1,0,4,0,183,0,2,0,81,0,1,0,4,0,184,0,2,0,81,
+0,1,0,4,0,185,0,2,0,81,0,1,0,4,0,186,0,2,0,81,0,1,0,4,0,187,0,2,0,81,0,1,
+0,4,0,188,0,2,0,81,0,2,0,6,0,14,0,189,0,3,0,81,0,134,2,31,0,2,0,81,0,1,0,
+4,0,190,0,2,0,81,0,1,0,4,0,191,0,2,0,81,0,1,0,4,0,192,0,2,0,81,0,1,0,4,0,
+193,0,2,0,81,0,1,0,4,0,194,0,2,0,81,0,1,0,4,0,195,0,2,0,81,0,1,0,4,0,196,
+0,2,0,81,0,1,0,4,0,197,0,2,0,81,0,1,0,4,0,198,0,2,0,81,0,1,0,4,0,199,0,2,
+0,81,0,1,0,4,0,200,0,2,0,81,0,1,0,4,0,201,0,2,0,81,0,1,0,4,0,202,0,2,0,81,
+0,1,0,4,0,240,0,2,0,81,0,1,0,4,0,203,0,2,0,81,0,1,0,4,0,204,0,2,0,81,0,1,
+0,4,0,205,0,2,0,81,0,1,0,4,0,206,0,2,0,81,0,1,0,4,0,207,0,2,0,81,0,1,0,4,
+0,208,0,2,0,81,0,1,0,4,0,209,0,3,0,81,0,134,0,1,0,4,0,209,0,2,0,81,0,1,0,
+4,0,210,0,2,0,81,0,1,0,4,0,211,0,2,0,81,0,1,0,4,0,248,0,2,0,81,0,1,0,4,0,
+212,0,2,0,81,0,1,0,4,0,213,0,2,0,81,0,1,0,4,0,214,0,2,0,81,0,1,0,4,0,215,
+0,2,0,81,0,1,0,4,0,216,0,2,0,81,0,1,0,4,0,221,0,2,0,81,0,1,0,4,0,222,0,2,
+0,81,0,1,0,4,0,223,0,2,0,81,0,1,0,4,0,228,0,2,0,81,0,1,0,4,0,233,0,2,0,81,
+0,1,0,4,0,234,0,2,0,81,0,1,0,4,0,242,0,2,0,81,0,1,0,4,0,246,0,2,0,81,0,1,
+0,4,0,217,0,2,0,81,0,1,0,4,0,218,0,2,0,81,0,1,0,4,0,224,0,2,0,81,0,1,0,4,
+0,225,0,2,0,81,0,1,0,4,0,226,0,2,0,81,0,2,0,6,0,14,0,227,0,3,0,81,0,134,2,
+32,0,2,0,81,0,1,0,4,0,229,0,2,0,81,0,1,0,4,0,230,0,2,0,81,0,1,0,4,0,231,0,
+2,0,81,0,1,0,4,0,232,0,2,0,81,0,1,0,4,0,235,0,2,0,81,0,1,0,4,0,236,0,2,0,
+81,0,1,0,4,0,237,0,2,0,81,0,1,0,4,0,238,0,2,0,81,0,1,0,4,0,239,0,2,0,81,0,
+1,0,4,0,241,0,2,0,81,0,1,0,4,0,243,0,2,0,81,0,1,0,4,0,244,0,2,0,81,0,1,0,
+4,0,245,0,2,0,81,0,1,0,4,0,247,0,2,0,81,0,1,0,4,0,249,0,2,0,81,0,1,0,4,0,
+250,0,2,0,81,0,1,0,4,0,251,0,2,0,81,0,1,0,4,0,252,0,2,0,81,0,1,0,4,0,253,
+0,2,0,81,0,1,0,4,0,219,0,2,0,81,0,1,0,4,0,220,0,2,0,81,0,1,0,4,0,247,0,2,
+0,81,0,1,0,4,2,37,0,2,0,81,0,1,0,4,2,38,0,2,0,81,0,2,0,6,0,25,0,61,0,0,0,
+92,0,99,0,37,0,125,0,126,0,45,0,156,0,180,0,47,2,23,2,23,0,72,2,35,2,36,0,
+73,0,4,0,0,0,1,0,8,0,1,3,176,0,76,0,158,0,168,0,178,0,188,0,198,0,210,0,220,
+0,230,0,240,0,250,1,4,1,16,1,28,1,40,1,52,1,62,1,72,1,82,1,94,1,104,1,114,
+1,124,1,134,1,144,1,154,1,164,1,174,1,184,1,196,1,206,1,216,1,226,1,236,1,
+246,2,0,2,10,2,20,2,30,2,40,2,50,2,60,2,70,2,82,2,94,2,104,2,114,2,124,2,
+134,2,144,2,156,2,166,2,176,2,186,2,196,2,208,2,220,2,230,2,240,2,250,3,6,
+3,16,3,26,3,36,3,46,3,56,3,66,3,76,3,86,3,96,3,106,3,116,3,126,3,136,3,146,
+3,156,3,166,0,1,0,4,0,183,0,2,0,81,0,1,0,4,0,184,0,2,0,81,0,1,0,4,0,185,0,
+2,0,81,0,1,0,4,0,186,0,2,0,81,0,1,0,4,0,187,0,3,0,81,0,134,0,1,0,4,0,188,
+0,2,0,81,0,1,0,4,0,189,0,2,0,81,0,1,0,4,0,190,0,2,0,81,0,1,0,4,0,191,0,2,
+0,81,0,1,0,4,0,192,0,2,0,81,0,1,0,4,0,193,0,3,0,81,0,134,0,1,0,4,0,194,0,
+3,0,81,0,134,0,1,0,4,0,195,0,3,0,81,0,134,0,1,0,4,0,196,0,3,0,81,0,134,0,
+1,0,4,0,197,0,2,0,81,0,1,0,4,0,198,0,2,0,81,0,1,0,4,0,199,0,2,0,81,0,1,0,
+4,0,200,0,3,0,81,0,134,0,1,0,4,0,201,0,2,0,81,0,1,0,4,0,202,0,2,0,81,0,1,
+0,4,0,240,0,2,0,81,0,1,0,4,0,203,0,2,0,81,0,1,0,4,0,204,0,2,0,81,0,1,0,4,
+0,205,0,2,0,81,0,1,0,4,0,206,0,2,0,81,0,1,0,4,0,207,0,2,0,81,0,1,0,4,0,208,
+0,2,0,81,0,1,0,4,0,209,0,3,0,81,0,134,0,1,0,4,0,209,0,2,0,81,0,1,0,4,0,210,
+0,2,0,81,0,1,0,4,0,211,0,2,0,81,0,1,0,4,0,248,0,2,0,81,0,1,0,4,0,212,0,2,
+0,81,0,1,0,4,0,213,0,2,0,81,0,1,0,4,0,214,0,2,0,81,0,1,0,4,0,215,0,2,0,81,
+0,1,0,4,0,216,0,2,0,81,0,1,0,4,0,221,0,2,0,81,0,1,0,4,0,222,0,2,0,81,0,1,
+0,4,0,223,0,2,0,81,0,1,0,4,0,228,0,2,0,81,0,1,0,4,0,233,0,3,0,81,0,134,0,
+1,0,4,0,234,0,3,0,81,0,134,0,1,0,4,0,242,0,2,0,81,0,1,0,4,0,246,0,2,0,81,
+0,1,0,4,0,217,0,2,0,81,0,1,0,4,0,218,0,2,0,81,0,1,0,4,0,224,0,2,0,81,0,1,
+0,4,0,225,0,3,0,81,0,134,0,1,0,4,0,226,0,2,0,81,0,1,0,4,0,227,0,2,0,81,0,
+1,0,4,0,229,0,2,0,81,0,1,0,4,0,230,0,2,0,81,0,1,0,4,0,231,0,3,0,81,0,134,
+0,1,0,4,0,232,0,3,0,81,0,134,0,1,0,4,0,235,0,2,0,81,0,1,0,4,0,236,0,2,0,81,
+0,1,0,4,0,237,0,2,0,81,0,1,0,4,0,238,0,3,0,81,0,134,0,1,0,4,0,239,0,2,0,81,
+0,1,0,4,0,241,0,2,0,81,0,1,0,4,0,243,0,2,0,81,0,1,0,4,0,244,0,2,0,81,0,1,
+0,4,0,245,0,2,0,81,0,1,0,4,0,247,0,2,0,81,0,1,0,4,0,249,0,2,0,81,0,1,0,4,
+0,250,0,2,0,81,0,1,0,4,0,251,0,2,0,81,0,1,0,4,0,252,0,2,0,81,0,1,0,4,0,253,
+0,2,0,81,0,1,0,4,0,219,0,2,0,81,0,1,0,4,0,220,0,2,0,81,0,1,0,4,0,210,0,2,
+0,81,0,1,0,4,0,247,0,2,0,81,0,1,0,4,2,28,0,2,0,81,0,1,0,4,2,30,0,2,0,81,0,
+2,0,7,0,25,0,61,0,0,0,92,0,99,0,37,0,125,0,126,0,45,0,156,0,180,0,47,2,22,
+2,23,0,72,2,27,2,27,0,74,2,29,2,29,0,75,0,4,0,0,0,1,0,8,0,1,2,214,0,60,0,
+126,0,136,0,146,0,156,0,166,0,176,0,186,0,196,0,206,0,216,0,226,0,236,0,246,
+1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,1,80,1,90,1,100,1,110,1,120,1,130,
+1,140,1,150,1,160,1,170,1,180,1,190,1,200,1,210,1,220,1,230,1,240,1,250,2,
+4,2,14,2,24,2,34,2,44,2,54,2,64,2,74,2,84,2,94,2,104,2,114,2,124,2,134,2,
+144,2,154,2,164,2,174,2,184,2,194,2,204,0,1,0,4,1,71,0,2,0,81,0,1,0,4,1,72,
+0,2,0,81,0,1,0,4,1,73,0,2,0,81,0,1,0,4,1,74,0,2,0,81,0,1,0,4,1,77,0,2,0,81,
+0,1,0,4,1,78,0,2,0,81,0,1,0,4,1,79,0,2,0,81,0,1,0,4,1,80,0,2,0,81,0,1,0,4,
+1,81,0,2,0,81,0,1,0,4,1,90,0,2,0,81,0,1,0,4,1,91,0,2,0,81,0,1,0,4,1,92,0,
+2,0,81,0,1,0,4,1,94,0,2,0,81,0,1,0,4,1,95,0,2,0,81,0,1,0,4,1,96,0,2,0,81,
+0,1,0,4,1,97,0,2,0,81,0,1,0,4,1,98,0,2,0,81,0,1,0,4,1,99,0,2,0,81,0,1,0,4,
+1,100,0,2,0,81,0,1,0,4,1,101,0,2,0,81,0,1,0,4,1,102,0,2,0,81,0,1,0,4,1,103,
+0,2,0,81,0,1,0,4,1,104,0,2,0,81,0,1,0,4,1,105,0,2,0,81,0,1,0,4,1,106,0,2,
+0,81,0,1,0,4,1,107,0,2,0,81,0,1,0,4,1,108,0,2,0,81,0,1,0,4,1,110,0,2,0,81,
+0,1,0,4,1,111,0,2,0,81,0,1,0,4,1,112,0,2,0,81,0,1,0,4,1,113,0,2,0,81,0,1,
+0,4,1,114,0,2,0,81,0,1,0,4,1,115,0,2,0,81,0,1,0,4,1,116,0,2,0,81,0,1,0,4,
+1,117,0,2,0,81,0,1,0,4,1,119,0,2,0,81,0,1,0,4,1,120,0,2,0,81,0,1,0,4,1,121,
+0,2,0,81,0,1,0,4,1,122,0,2,0,81,0,1,0,4,1,123,0,2,0,81,0,1,0,4,1,128,0,2,
+0,81,0,1,0,4,1,129,0,2,0,81,0,1,0,4,1,130,0,2,0,81,0,1,0,4,1,132,0,2,0,81,
+0,1,0,4,1,133,0,2,0,81,0,1,0,4,1,134,0,2,0,81,0,1,0,4,1,135,0,2,0,81,0,1,
+0,4,1,136,0,2,0,81,0,1,0,4,1,137,0,2,0,81,0,1,0,4,1,138,0,2,0,81,0,1,0,4,
+1,139,0,2,0,81,0,1,0,4,1,102,0,2,0,81,0,1,0,4,1,140,0,2,0,81,0,1,0,4,1,141,
+0,2,0,81,0,1,0,4,1,142,0,2,0,81,0,1,0,4,1,143,0,2,0,81,0,1,0,4,1,144,0,2,
+0,81,0,1,0,4,1,145,0,2,0,81,0,1,0,4,1,103,0,2,0,81,0,1,0,4,1,140,0,2,0,81,
+0,2,0,9,0,254,1,1,0,0,1,3,1,7,0,4,1,12,1,14,0,9,1,16,1,30,0,12,1,33,1,40,
+0,27,1,42,1,46,0,35,1,51,1,53,0,40,1,55,1,69,0,43,2,24,2,25,0,58,0,4,0,0,
+0,1,0,8,0,1,3,132,0,72,0,150,0,160,0,170,0,180,0,190,0,202,0,212,0,224,0,
+234,0,244,1,0,1,12,1,24,1,36,1,46,1,56,1,66,1,78,1,88,1,98,1,108,1,118,1,
+128,1,138,1,148,1,158,1,168,1,180,1,190,1,200,1,210,1,220,1,230,1,240,1,250,
+2,4,2,14,2,24,2,34,2,44,2,54,2,66,2,78,2,88,2,98,2,108,2,118,2,128,2,140,
+2,150,2,162,2,172,2,184,2,196,2,206,2,216,2,226,2,238,2,248,3,2,3,12,3,22,
+3,32,3,42,3,52,3,62,3,72,3,82,3,92,3,102,3,112,3,122,0,1,0,4,0,183,0,2,0,
+81,0,1,0,4,0,184,0,2,0,81,0,1,0,4,0,185,0,2,0,81,0,1,0,4,0,186,0,2,0,81,0,
+1,0,4,0,187,0,3,0,81,0,134,0,1,0,4,0,188,0,2,0,81,0,1,0,4,0,189,0,3,0,81,
+0,134,0,1,0,4,0,190,0,2,0,81,0,1,0,4,0,192,0,2,0,81,0,1,0,4,0,193,0,3,0,81,
+0,134,0,1,0,4,0,194,0,3,0,81,0,134,0,1,0,4,0,195,0,3,0,81,0,134,0,1,0,4,0,
+196,0,3,0,81,0,134,0,1,0,4,0,197,0,2,0,81,0,1,0,4,0,198,0,2,0,81,0,1,0,4,
+0,199,0,2,0,81,0,1,0,4,0,200,0,3,0,81,0,134,0,1,0,4,0,201,0,2,0,81,0,1,0,
+4,0,202,0,2,0,81,0,1,0,4,0,240,0,2,0,81,0,1,0,4,0,203,0,2,0,81,0,1,0,4,0,
+204,0,2,0,81,0,1,0,4,0,205,0,2,0,81,0,1,0,4,0,206,0,2,0,81,0,1,0,4,0,207,
+0,2,0,81,0,1,0,4,0,208,0,2,0,81,0,1,0,4,0,209,0,3,0,81,0,134,0,1,0,4,0,209,
+0,2,0,81,0,1,0,4,0,210,0,2,0,81,0,1,0,4,0,211,0,2,0,81,0,1,0,4,0,248,0,2,
+0,81,0,1,0,4,0,212,0,2,0,81,0,1,0,4,0,213,0,2,0,81,0,1,0,4,0,214,0,2,0,81,
+0,1,0,4,0,215,0,2,0,81,0,1,0,4,0,216,0,2,0,81,0,1,0,4,0,221,0,2,0,81,0,1,
+0,4,0,222,0,2,0,81,0,1,0,4,0,223,0,2,0,81,0,1,0,4,0,228,0,2,0,81,0,1,0,4,
+0,233,0,3,0,81,0,134,0,1,0,4,0,234,0,3,0,81,0,134,0,1,0,4,0,242,0,2,0,81,
+0,1,0,4,0,246,0,2,0,81,0,1,0,4,0,217,0,2,0,81,0,1,0,4,0,218,0,2,0,81,0,1,
+0,4,0,224,0,2,0,81,0,1,0,4,0,225,0,3,0,81,0,134,0,1,0,4,0,226,0,2,0,81,0,
+1,0,4,0,227,0,3,0,81,0,134,0,1,0,4,0,230,0,2,0,81,0,1,0,4,0,231,0,3,0,81,
+0,134,0,1,0,4,0,232,0,3,0,81,0,134,0,1,0,4,0,235,0,2,0,81,0,1,0,4,0,236,0,
+2,0,81,0,1,0,4,0,237,0,2,0,81,0,1,0,4,0,238,0,3,0,81,0,134,0,1,0,4,0,239,
+0,2,0,81,0,1,0,4,0,241,0,2,0,81,0,1,0,4,0,243,0,2,0,81,0,1,0,4,0,244,0,2,
+0,81,0,1,0,4,0,245,0,2,0,81,0,1,0,4,0,247,0,2,0,81,0,1,0,4,0,249,0,2,0,81,
+0,1,0,4,0,250,0,2,0,81,0,1,0,4,0,251,0,2,0,81,0,1,0,4,0,252,0,2,0,81,0,1,
+0,4,0,253,0,2,0,81,0,1,0,4,0,219,0,2,0,81,0,1,0,4,0,220,0,2,0,81,0,1,0,4,
+2,37,0,2,0,81,0,1,0,4,2,38,0,2,0,81,0,2,0,7,0,25,0,32,0,0,0,34,0,61,0,8,0,
+92,0,99,0,36,0,125,0,126,0,44,0,156,0,159,0,46,0,161,0,180,0,50,2,35,2,36,
+0,70,0,4,0,0,0,1,0,8,0,1,2,166,0,56,0,118,0,128,0,138,0,148,0,158,0,168,0,
+178,0,188,0,198,0,208,0,218,0,228,0,238,0,248,1,2,1,12,1,22,1,32,1,42,1,52,
+1,62,1,72,1,82,1,92,1,102,1,112,1,122,1,132,1,142,1,152,1,162,1,172,1,182,
+1,192,1,202,1,212,1,222,1,232,1,242,1,252,2,6,2,16,2,26,2,36,2,46,2,56,2,
+66,2,76,2,86,2,96,2,106,2,116,2,126,2,136,2,146,2,156,0,1,0,4,1,71,0,2,0,
+81,0,1,0,4,1,72,0,2,0,81,0,1,0,4,1,73,0,2,0,81,0,1,0,4,1,74,0,2,0,81,0,1,
+0,4,1,77,0,2,0,81,0,1,0,4,1,79,0,2,0,81,0,1,0,4,1,81,0,2,0,81,0,1,0,4,1,90,
+0,2,0,81,0,1,0,4,1,91,0,2,0,81,0,1,0,4,1,92,0,2,0,81,0,1,0,4,1,94,0,2,0,81,
+0,1,0,4,1,95,0,2,0,81,0,1,0,4,1,96,0,2,0,81,0,1,0,4,1,97,0,2,0,81,0,1,0,4,
+1,98,0,2,0,81,0,1,0,4,1,99,0,2,0,81,0,1,0,4,1,100,0,2,0,81,0,1,0,4,1,101,
+0,2,0,81,0,1,0,4,1,102,0,2,0,81,0,1,0,4,1,103,0,2,0,81,0,1,0,4,1,104,0,2,
+0,81,0,1,0,4,1,105,0,2,0,81,0,1,0,4,1,106,0,2,0,81,0,1,0,4,1,107,0,2,0,81,
+0,1,0,4,1,108,0,2,0,81,0,1,0,4,1,110,0,2,0,81,0,1,0,4,1,111,0,2,0,81,0,1,
+0,4,1,112,0,2,0,81,0,1,0,4,1,113,0,2,0,81,0,1,0,4,1,114,0,2,0,81,0,1,0,4,
+1,115,0,2,0,81,0,1,0,4,1,116,0,2,0,81,0,1,0,4,1,117,0,2,0,81,0,1,0,4,1,119,
+0,2,0,81,0,1,0,4,1,121,0,2,0,81,0,1,0,4,1,123,0,2,0,81,0,1,0,4,1,128,0,2,
+0,81,0,1,0,4,1,129,0,2,0,81,0,1,0,4,1,130,0,2,0,81,0,1,0,4,1,132,0,2,0,81,
+0,1,0,4,1,133,0,2,0,81,0,1,0,4,1,134,0,2,0,81,0,1,0,4,1,135,0,2,0,81,0,1,
+0,4,1,136,0,2,0,81,0,1,0,4,1,137,0,2,0,81,0,1,0,4,1,138,0,2,0,81,0,1,0,4,
+1,139,0,2,0,81,0,1,0,4,1,102,0,2,0,81,0,1,0,4,1,140,0,2,0,81,0,1,0,4,1,141,
+0,2,0,81,0,1,0,4,1,142,0,2,0,81,0,1,0,4,1,143,0,2,0,81,0,1,0,4,1,144,0,2,
+0,81,0,1,0,4,1,145,0,2,0,81,0,1,0,4,2,41,0,2,0,81,0,1,0,4,2,42,0,2,0,81,0,
+2,0,13,0,254,1,1,0,0,1,3,1,3,0,4,1,5,1,5,0,5,1,7,1,7,0,6,1,12,1,14,0,7,1,
+16,1,30,0,10,1,33,1,40,0,25,1,42,1,42,0,33,1,44,1,44,0,34,1,46,1,46,0,35,
+1,51,1,53,0,36,1,55,1,69,0,39,2,39,2,40,0,54,0,4,0,0,0,1,0,8,0,1,3,186,0,
+79,0,164,0,174,0,184,0,194,0,204,0,214,0,224,0,234,0,244,0,254,1,8,1,18,1,
+28,1,38,1,48,1,58,1,68,1,78,1,88,1,98,1,108,1,118,1,128,1,138,1,148,1,158,
+1,168,1,178,1,188,1,198,1,208,1,218,1,228,1,238,1,248,2,2,2,12,2,22,2,32,
+2,42,2,52,2,62,2,72,2,82,2,92,2,102,2,112,2,122,2,132,2,142,2,152,2,162,2,
+172,2,182,2,192,2,202,2,212,2,222,2,232,2,242,2,252,3,6,3,16,3,26,3,36,3,
+46,3,56,3,66,3,76,3,86,3,96,3,106,3,116,3,126,3,136,3,146,3,156,3,166,3,176,
+0,1,0,4,0,254,0,2,0,182,0,1,0,4,0,255,0,2,0,182,0,1,0,4,1,0,0,2,0,182,0,1,
+0,4,1,1,0,2,0,182,0,1,0,4,1,2,0,2,0,182,0,1,0,4,1,3,0,2,0,182,0,1,0,4,1,4,
+0,2,0,182,0,1,0,4,1,5,0,2,0,182,0,1,0,4,1,6,0,2,0,182,0,1,0,4,1,7,0,2,0,182,
+0,1,0,4,1,8,0,2,0,182,0,1,0,4,1,9,0,2,0,182,0,1,0,4,1,10,0,2,0,182,0,1,0,
+4,1,11,0,2,0,182,0,1,0,4,1,12,0,2,0,182,0,1,0,4,1,13,0,2,0,182,0,1,0,4,1,
+14,0,2,0,182,0,1,0,4,1,15,0,2,0,182,0,1,0,4,1,16,0,2,0,182,0,1,0,4,1,17,0,
+2,0,182,0,1,0,4,1,56,0,2,0,182,0,1,0,4,1,18,0,2,0,182,0,1,0,4,1,19,0,2,0,
+182,0,1,0,4,1,20,0,2,0,182,0,1,0,4,1,21,0,2,0,182,0,1,0,4,1,22,0,2,0,182,
+0,1,0,4,1,23,0,2,0,182,0,1,0,4,1,24,0,2,0,182,0,1,0,4,1,63,0,2,0,182,0,1,
+0,4,1,25,0,2,0,182,0,1,0,4,1,26,0,2,0,182,0,1,0,4,1,65,0,2,0,182,0,1,0,4,
+1,27,0,2,0,182,0,1,0,4,1,28,0,2,0,182,0,1,0,4,1,29,0,2,0,182,0,1,0,4,1,30,
+0,2,0,182,0,1,0,4,1,31,0,2,0,182,0,1,0,4,1,37,0,2,0,182,0,1,0,4,1,38,0,2,
+0,182,0,1,0,4,1,39,0,2,0,182,0,1,0,4,1,44,0,2,0,182,0,1,0,4,1,49,0,2,0,182,
+0,1,0,4,1,50,0,2,0,182,0,1,0,4,1,58,0,2,0,182,0,1,0,4,1,62,0,2,0,182,0,1,
+0,4,1,32,0,2,0,182,0,1,0,4,1,33,0,2,0,182,0,1,0,4,1,34,0,2,0,182,0,1,0,4,
+1,40,0,2,0,182,0,1,0,4,1,41,0,2,0,182,0,1,0,4,1,42,0,2,0,182,0,1,0,4,1,43,
+0,2,0,182,0,1,0,4,1,45,0,2,0,182,0,1,0,4,1,46,0,2,0,182,0,1,0,4,1,47,0,2,
+0,182,0,1,0,4,1,48,0,2,0,182,0,1,0,4,1,51,0,2,0,182,0,1,0,4,1,52,0,2,0,182,
+0,1,0,4,1,53,0,2,0,182,0,1,0,4,1,54,0,2,0,182,0,1,0,4,1,55,0,2,0,182,0,1,
+0,4,1,57,0,2,0,182,0,1,0,4,1,59,0,2,0,182,0,1,0,4,1,60,0,2,0,182,0,1,0,4,
+1,61,0,2,0,182,0,1,0,4,1,64,0,2,0,182,0,1,0,4,1,66,0,2,0,182,0,1,0,4,1,67,
+0,2,0,182,0,1,0,4,1,68,0,2,0,182,0,1,0,4,1,69,0,2,0,182,0,1,0,4,1,70,0,2,
+0,182,0,1,0,4,1,35,0,2,0,182,0,1,0,4,1,36,0,2,0,182,0,1,0,4,2,24,0,2,0,182,
+0,1,0,4,2,25,0,2,0,182,0,1,0,4,1,28,0,2,0,182,0,1,0,4,1,67,0,2,0,182,0,1,
+0,4,2,39,0,2,0,182,0,1,0,4,2,40,0,2,0,182,0,2,0,8,0,25,0,61,0,0,0,92,0,99,
+0,37,0,124,0,126,0,45,0,156,0,180,0,48,2,22,2,23,0,73,2,27,2,27,0,75,2,29,
+2,29,0,76,2,35,2,36,0,77,0,4,0,0,0,1,0,8,0,1,3,162,0,77,0,160,0,170,0,180,
+0,190,0,200,0,210,0,220,0,230,0,240,0,250,1,4,1,14,1,24,1,34,1,44,1,54,1,
+64,1,74,1,84,1,94,1,104,1,114,1,124,1,134,1,144,1,154,1,164,1,174,1,184,1,
+194,1,204,1,214,1,224,1,234,1,244,1,254,2,8,2,18,2,28,2,38,2,48,2,58,2,68,
+2,78,2,88,2,98,2,108,2,118,2,128,2,138,2,148,2,158,2,168,2,178,2,188,2,198,
+2,208,2,218,2,228,2,238,2,248,3,2,3,12,3,22,3,32,3,42,3,52,3,62,3,72,3,82,
+3,92,3,102,3,112,3,122,3,132,3,142,3,152,0,1,0,4,1,71,0,2,0,182,0,1,0,4,1,
+72,0,2,0,182,0,1,0,4,1,73,0,2,0,182,0,1,0,4,1,74,0,2,0,182,0,1,0,4,1,75,0,
+2,0,182,0,1,0,4,1,77,0,2,0,182,0,1,0,4,1,78,0,2,0,182,0,1,0,4,1,79,0,2,0,
+182,0,1,0,4,1,80,0,2,0,182,0,1,0,4,1,81,0,2,0,182,0,1,0,4,1,82,0,2,0,182,
+0,1,0,4,1,84,0,2,0,182,0,1,0,4,1,86,0,2,0,182,0,1,0,4,1,88,0,2,0,182,0,1,
+0,4,1,90,0,2,0,182,0,1,0,4,1,91,0,2,0,182,0,1,0,4,1,92,0,2,0,182,0,1,0,4,
+1,93,0,2,0,182,0,1,0,4,1,94,0,2,0,182,0,1,0,4,1,95,0,2,0,182,0,1,0,4,1,96,
+0,2,0,182,0,1,0,4,1,97,0,2,0,182,0,1,0,4,1,98,0,2,0,182,0,1,0,4,1,99,0,2,
+0,182,0,1,0,4,1,100,0,2,0,182,0,1,0,4,1,101,0,2,0,182,0,1,0,4,1,102,0,2,0,
+182,0,1,0,4,1,103,0,2,0,182,0,1,0,4,1,104,0,2,0,182,0,1,0,4,1,105,0,2,0,182,
+0,1,0,4,1,106,0,2,0,182,0,1,0,4,1,107,0,2,0,182,0,1,0,4,1,108,0,2,0,182,0,
+1,0,4,1,109,0,2,0,182,0,1,0,4,1,110,0,2,0,182,0,1,0,4,1,111,0,2,0,182,0,1,
+0,4,1,112,0,2,0,182,0,1,0,4,1,113,0,2,0,182,0,1,0,4,1,114,0,2,0,182,0,1,0,
+4,1,115,0,2,0,182,0,1,0,4,1,116,0,2,0,182,0,1,0,4,1,117,0,2,0,182,0,1,0,4,
+1,118,0,2,0,182,0,1,0,4,1,119,0,2,0,182,0,1,0,4,1,120,0,2,0,182,0,1,0,4,1,
+121,0,2,0,182,0,1,0,4,1,122,0,2,0,182,0,1,0,4,1,123,0,2,0,182,0,1,0,4,1,124,
+0,2,0,182,0,1,0,4,1,125,0,2,0,182,0,1,0,4,1,126,0,2,0,182,0,1,0,4,1,127,0,
+2,0,182,0,1,0,4,1,128,0,2,0,182,0,1,0,4,1,129,0,2,0,182,0,1,0,4,1,130,0,2,
+0,182,0,1,0,4,1,131,0,2,0,182,0,1,0,4,1,132,0,2,0,182,0,1,0,4,1,133,0,2,0,
+182,0,1,0,4,1,134,0,2,0,182,0,1,0,4,1,135,0,2,0,182,0,1,0,4,1,136,0,2,0,182,
+0,1,0,4,1,137,0,2,0,182,0,1,0,4,1,138,0,2,0,182,0,1,0,4,1,139,0,2,0,182,0,
+1,0,4,1,140,0,2,0,182,0,1,0,4,1,141,0,2,0,182,0,1,0,4,1,142,0,2,0,182,0,1,
+0,4,1,143,0,2,0,182,0,1,0,4,1,144,0,2,0,182,0,1,0,4,1,145,0,2,0,182,0,1,0,
+4,1,146,0,2,0,182,0,1,0,4,1,106,0,2,0,182,0,1,0,4,1,143,0,2,0,182,0,1,0,4,
+2,33,0,2,0,182,0,1,0,4,2,34,0,2,0,182,0,1,0,4,2,41,0,2,0,182,0,1,0,4,2,42,
+0,2,0,182,0,2,0,4,0,183,0,253,0,0,2,28,2,28,0,71,2,30,2,32,0,72,2,37,2,38,
+0,75,0,6,0,0,0,1,0,8,0,2,0,16,0,22,0,30,0,38,0,2,0,0,0,60,0,1,0,1,1,24,0,
+1,0,1,0,1,0,1,0,1,1,24,0,1,0,1,0,2,0,3,0,71,0,72,0,1,0,81,0,81,0,1,0,102,
+0,103,0,1,0,1,0,4,0,0,0,1,0,1,0,1,0,1,0,0,0,18,0,2,0,0,0,1,0,8,0,1,0,14,0,
+1,0,8,0,2,0,209,0,52,0,1,0,1,1,24,0,4,0,0,0,1,0,8,0,1,1,42,0,6,0,18,0,50,
+0,106,0,128,0,172,0,194,0,3,0,8,0,16,0,24,1,228,0,3,0,81,0,27,1,229,0,3,0,
+81,0,50,1,230,0,3,0,81,0,51,0,5,0,12,0,22,0,30,0,40,0,48,1,234,0,4,0,81,0,
+35,0,70,1,233,0,3,0,81,0,35,1,236,0,4,0,81,0,36,0,70,1,235,0,3,0,81,0,36,
+1,237,0,3,0,81,0,51,0,2,0,6,0,14,1,238,0,3,0,81,0,36,1,239,0,3,0,81,0,51,
+0,4,0,10,0,20,0,28,0,36,1,242,0,4,0,81,0,37,0,70,1,241,0,3,0,81,0,37,1,240,
+0,3,0,81,0,38,1,243,0,3,0,81,0,51,0,2,0,6,0,14,1,244,0,3,0,81,0,38,1,245,
+0,3,0,81,0,51,0,10,0,22,0,30,0,38,0,46,0,54,0,62,0,70,0,78,0,86,0,94,1,249,
+0,3,0,81,0,27,1,248,0,3,0,81,0,28,1,255,0,3,0,81,0,42,1,253,0,3,0,81,0,43,
+1,250,0,3,0,81,0,48,1,251,0,3,0,81,0,49,2,0,0,3,0,81,0,50,2,1,0,3,0,81,0,
+51,1,252,0,3,0,81,0,57,1,254,0,4,0,81,0,201,0,51,0,1,0,6,0,29,0,35,0,36,0,
+37,0,38,0,42,0,4,0,0,0,1,0,8,0,1,0,30,0,1,0,8,0,2,0,6,0,14,2,1,0,3,0,81,0,
+51,1,252,0,3,0,81,0,57,0,1,0,1,0,42,0,4,0,0,0,1,0,8,0,1,1,242,0,17,0,40,0,
+50,0,76,0,86,0,96,0,142,0,160,0,196,0,214,0,224,1,52,1,62,1,72,1,82,1,116,
+1,150,1,200,0,1,0,4,1,227,0,2,0,40,0,3,0,8,0,14,0,20,1,228,0,2,0,27,1,229,
+0,2,0,50,1,230,0,2,0,51,0,1,0,4,1,231,0,2,0,51,0,1,0,4,1,232,0,2,0,32,0,5,
+0,12,0,20,0,26,0,34,0,40,1,234,0,3,0,35,0,70,1,233,0,2,0,35,1,236,0,3,0,36,
+0,70,1,235,0,2,0,36,1,237,0,2,0,51,0,2,0,6,0,12,1,238,0,2,0,36,1,239,0,2,
+0,51,0,4,0,10,0,18,0,24,0,30,1,242,0,3,0,37,0,70,1,241,0,2,0,37,1,240,0,2,
+0,38,1,243,0,2,0,51,0,2,0,6,0,12,1,244,0,2,0,38,1,245,0,2,0,51,0,1,0,4,1,
+246,0,2,0,40,0,10,0,22,0,28,0,34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,1,249,
+0,2,0,27,1,248,0,2,0,28,1,255,0,2,0,42,1,253,0,2,0,43,1,250,0,2,0,48,1,251,
+0,2,0,49,2,0,0,2,0,50,2,1,0,2,0,51,1,252,0,2,0,57,1,254,0,3,0,201,0,51,0,
+1,0,4,2,3,0,2,0,44,0,1,0,4,2,4,0,2,0,44,0,1,0,4,2,5,0,2,0,51,0,4,0,10,0,16,
+0,22,0,28,2,6,0,2,0,30,2,11,0,2,0,44,2,10,0,2,0,54,2,8,0,2,0,57,0,4,0,10,
+0,16,0,22,0,28,2,12,0,2,0,35,2,14,0,2,0,36,2,13,0,2,1,8,2,15,0,2,1,9,0,6,
+0,14,0,20,0,26,0,32,0,38,0,44,2,16,0,2,0,39,2,17,0,2,0,44,2,18,0,2,0,50,2,
+19,0,2,0,51,2,20,0,2,0,54,2,21,0,2,0,57,0,5,0,12,0,18,0,24,0,30,0,36,2,6,
+0,2,0,30,2,11,0,2,0,44,2,10,0,2,0,54,2,8,0,2,0,57,2,26,0,2,2,22,0,1,0,17,
+0,183,0,187,0,189,0,192,0,193,0,194,0,195,0,196,0,198,0,200,0,202,0,203,0,
+212,0,213,0,214,0,216,2,28,0,4,0,0,0,1,0,8,0,1,0,74,0,5,0,16,0,26,0,36,0,
+46,0,64,0,1,0,4,1,227,0,2,0,40,0,1,0,4,1,232,0,2,0,32,0,1,0,4,1,246,0,2,0,
+40,0,2,0,6,0,12,2,1,0,2,0,51,1,252,0,2,0,57,0,1,0,4,2,5,0,2,0,51,0,1,0,5,
+0,183,0,192,0,198,0,200,0,212,0,4,0,0,0,1,0,8,0,1,0,84,0,5,0,16,0,28,0,38,
+0,48,0,66,0,1,0,4,2,2,0,3,0,81,0,208,0,1,0,4,1,247,0,2,0,198,0,1,0,4,2,2,
+0,2,0,208,0,2,0,6,0,12,2,7,0,2,0,188,2,9,0,2,0,212,0,2,0,6,0,12,2,7,0,2,0,
+188,2,9,0,2,0,212,0,1,0,5,0,42,0,198,0,200,0,213,2,28,0,4,0,0,0,1,0,8,0,1,
+0,44,0,3,0,12,0,24,0,34,0,1,0,4,2,2,0,3,0,81,0,208,0,1,0,4,1,247,0,2,0,198,
+0,1,0,4,2,2,0,2,0,208,0,1,0,3,0,42,0,198,0,200,0,5,0,0,0,1,0,8,0,2,0,24,0,
+78,0,8,0,0,0,196,0,210,0,238,1,22,0,0,0,0,0,0,0,1,0,25,0,8,0,12,0,17,0,18,
+0,20,0,21,0,22,0,23,0,24,0,79,0,80,0,118,0,119,0,120,0,121,0,136,0,140,0,
+145,0,146,0,148,0,149,0,150,0,151,0,152,0,155,0,2,0,19,0,5,0,5,0,5,0,6,0,
+6,0,6,0,8,0,8,0,1,0,12,0,12,0,3,0,17,0,18,0,1,0,20,0,20,0,2,0,21,0,22,0,1,
+0,23,0,24,0,2,0,79,0,80,0,4,0,85,0,85,0,7,0,118,0,121,0,1,0,136,0,136,0,1,
+0,140,0,140,0,3,0,145,0,146,0,1,0,148,0,148,0,2,0,149,0,150,0,1,0,151,0,152,
+0,2,0,155,0,155,0,1,0,181,0,181,0,5,0,1,0,4,0,2,0,1,0,5,0,0,0,26,0,2,0,6,
+0,16,0,2,0,1,0,5,0,0,0,26,0,3,0,1,0,6,0,7,0,0,0,26,0,3,0,8,0,18,0,30,0,2,
+0,1,0,5,0,0,0,26,0,3,0,1,0,6,0,7,0,0,0,26,0,2,0,1,0,7,0,0,0,26,0,4,0,10,0,
+22,0,36,0,50,0,3,0,1,0,5,0,7,0,0,0,26,0,4,0,1,0,5,0,5,0,7,0,0,0,26,0,4,0,
+1,0,5,0,6,0,7,0,0,0,26,0,3,0,1,0,6,0,7,0,0,0,26,0,2,0,0,0,1,0,8,0,1,0,206,
+0,25,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,122,0,128,
+0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,188,0,194,0,200,0,
+2,0,9,0,74,0,2,0,11,0,181,0,2,0,19,0,73,0,2,0,19,0,74,0,2,0,19,0,75,0,2,0,
+10,0,73,0,2,0,10,0,74,0,2,0,10,0,75,0,2,0,10,0,76,0,2,0,66,0,75,0,2,0,66,
+0,76,0,2,0,9,0,73,0,2,0,9,0,62,0,2,0,10,0,62,0,2,0,9,0,83,0,2,0,137,0,74,
+0,2,0,139,0,181,0,2,0,147,0,73,0,2,0,147,0,74,0,2,0,147,0,75,0,2,0,138,0,
+73,0,2,0,138,0,74,0,2,0,138,0,75,0,2,0,138,0,76,0,2,0,137,0,73,0,1,0,25,0,
+8,0,12,0,17,0,18,0,20,0,21,0,22,0,23,0,24,0,79,0,80,0,118,0,119,0,120,0,121,
+0,136,0,140,0,145,0,146,0,148,0,149,0,150,0,151,0,152,0,155,0,4,0,0,0,1,0,
+8,0,1,0,138,0,7,0,20,0,38,0,56,0,90,0,108,0,118,0,128,0,2,0,6,0,12,2,175,
+0,2,0,5,1,203,0,2,0,6,0,2,0,6,0,12,3,95,0,2,3,29,3,98,0,2,3,43,0,4,0,10,0,
+16,0,22,0,28,3,96,0,2,3,39,3,99,0,2,3,43,3,103,0,2,3,45,3,104,0,2,3,56,0,
+2,0,6,0,12,3,97,0,2,3,40,3,100,0,2,3,43,0,1,0,4,3,101,0,2,3,43,0,1,0,4,3,
+102,0,2,3,43,0,1,0,4,3,105,0,2,3,43,0,1,0,7,0,181,3,29,3,30,3,31,3,32,3,33,
+3,44,0,4,0,0,0,1,0,8,0,1,3,42,0,35,0,76,0,86,0,96,0,106,0,116,0,126,0,136,
+0,146,0,156,0,166,0,208,0,250,1,36,1,78,1,120,1,162,1,204,1,246,2,32,2,74,
+2,116,2,158,2,168,2,178,2,188,2,198,2,208,2,218,2,228,2,238,2,248,3,2,3,12,
+3,22,3,32,0,1,0,4,1,204,0,2,0,6,0,1,0,4,1,205,0,2,0,6,0,1,0,4,1,206,0,2,0,
+6,0,1,0,4,1,207,0,2,0,6,0,1,0,4,1,208,0,2,0,6,0,1,0,4,1,209,0,2,0,6,0,1,0,
+4,1,210,0,2,0,6,0,1,0,4,1,211,0,2,0,6,0,1,0,4,1,212,0,2,0,6,0,5,0,12,0,18,
+0,24,0,30,0,36,2,176,0,2,0,5,1,167,0,2,0,6,1,168,0,2,0,181,1,169,0,2,1,203,
+2,191,0,2,2,175,0,5,0,12,0,18,0,24,0,30,0,36,2,177,0,2,0,5,1,170,0,2,0,6,
+1,171,0,2,0,181,1,172,0,2,1,203,2,192,0,2,2,175,0,5,0,12,0,18,0,24,0,30,0,
+36,2,187,0,2,0,5,1,173,0,2,0,6,1,174,0,2,0,181,1,175,0,2,1,203,2,214,0,2,
+2,175,0,5,0,12,0,18,0,24,0,30,0,36,2,178,0,2,0,5,1,176,0,2,0,6,1,177,0,2,
+0,181,1,178,0,2,1,203,2,193,0,2,2,175,0,5,0,12,0,18,0,24,0,30,0,36,2,179,
+0,2,0,5,1,179,0,2,0,6,1,180,0,2,0,181,1,181,0,2,1,203,2,194,0,2,2,175,0,5,
+0,12,0,18,0,24,0,30,0,36,2,180,0,2,0,5,1,182,0,2,0,6,1,183,0,2,0,181,1,184,
+0,2,1,203,2,195,0,2,2,175,0,5,0,12,0,18,0,24,0,30,0,36,2,181,0,2,0,5,1,185,
+0,2,0,6,1,186,0,2,0,181,1,187,0,2,1,203,2,196,0,2,2,175,0,5,0,12,0,18,0,24,
+0,30,0,36,2,182,0,2,0,5,1,188,0,2,0,6,1,189,0,2,0,181,1,190,0,2,1,203,2,197,
+0,2,2,175,0,5,0,12,0,18,0,24,0,30,0,36,2,183,0,2,0,5,1,191,0,2,0,6,1,192,
+0,2,0,181,1,193,0,2,1,203,2,198,0,2,2,175,0,5,0,12,0,18,0,24,0,30,0,36,2,
+184,0,2,0,5,1,194,0,2,0,6,1,195,0,2,0,181,1,196,0,2,1,203,2,199,0,2,2,175,
+0,5,0,12,0,18,0,24,0,30,0,36,2,185,0,2,0,5,1,197,0,2,0,6,1,198,0,2,0,181,
+1,199,0,2,1,203,2,200,0,2,2,175,0,5,0,12,0,18,0,24,0,30,0,36,2,186,0,2,0,
+5,1,200,0,2,0,6,1,201,0,2,0,181,1,202,0,2,1,203,2,201,0,2,2,175,0,1,0,4,1,
+213,0,2,0,6,0,1,0,4,1,214,0,2,0,6,0,1,0,4,1,215,0,2,0,6,0,1,0,4,1,216,0,2,
+0,6,0,1,0,4,1,217,0,2,0,6,0,1,0,4,1,218,0,2,0,6,0,1,0,4,1,219,0,2,0,6,0,1,
+0,4,1,220,0,2,0,6,0,1,0,4,1,221,0,2,0,6,0,1,0,4,1,222,0,2,0,6,0,1,0,4,1,223,
+0,2,0,6,0,1,0,4,1,224,0,2,0,6,0,1,0,4,1,225,0,2,0,6,0,1,0,4,1,226,0,2,0,6,
+0,1,0,35,0,8,0,12,0,17,0,18,0,20,0,21,0,22,0,23,0,24,0,62,0,63,0,68,0,73,
+0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,83,0,118,0,119,0,120,0,121,0,136,0,140,
+0,145,0,146,0,148,0,149,0,150,0,151,0,152,0,155,0,5,0,0,0,1,0,8,0,2,0,14,
+0,20,0,3,0,0,0,36,0,0,0,1,0,1,0,67,0,2,0,2,0,67,0,67,0,1,0,135,0,135,0,2,
+0,1,0,4,0,2,0,1,0,0,0,0,0,30,0,1,0,0,0,1,0,8,0,1,0,6,1,235,0,1,0,1,0,67,0,
+5,0,0,0,1,0,8,0,2,0,88,0,94,0,40,0,0,4,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,186,0,
+25,0,25,0,3,0,26,0,26,0,2,0,27,0,31,0,3,0,32,0,34,0,2,0,35,0,38,0,3,0,39,
+0,39,0,2,0,40,0,61,0,3,0,92,0,92,0,3,0,93,0,93,0,2,0,94,0,94,0,3,0,95,0,95,
+0,2,0,96,0,99,0,3,0,124,0,124,0,3,0,125,0,125,0,2,0,126,0,127,0,3,0,128,0,
+128,0,2,0,130,0,131,0,3,0,134,0,134,0,39,0,156,0,159,0,3,0,160,0,161,0,2,
+0,162,0,163,0,3,0,164,0,164,0,2,0,165,0,178,0,3,0,179,0,179,0,2,0,180,0,180,
+0,3,0,185,0,185,0,4,0,186,0,186,0,9,0,188,0,188,0,18,0,190,0,190,0,38,0,191,
+0,191,0,28,0,192,0,192,0,37,0,193,0,193,0,33,0,196,0,196,0,37,0,197,0,197,
+0,26,0,198,0,198,0,12,0,199,0,199,0,16,0,200,0,200,0,34,0,201,0,201,0,11,
+0,202,0,202,0,10,0,203,0,203,0,5,0,205,0,205,0,20,0,206,0,206,0,24,0,207,
+0,207,0,6,0,208,0,208,0,7,0,209,0,209,0,19,0,210,0,210,0,32,0,212,0,212,0,
+17,0,213,0,213,0,21,0,214,0,214,0,13,0,215,0,215,0,16,0,216,0,216,0,29,0,
+217,0,217,0,38,0,218,0,218,0,7,0,219,0,219,0,25,0,220,0,220,0,22,0,223,0,
+223,0,4,0,224,0,224,0,9,0,226,0,226,0,18,0,228,0,228,0,38,0,229,0,229,0,28,
+0,230,0,230,0,37,0,231,0,231,0,33,0,234,0,234,0,37,0,235,0,235,0,26,0,236,
+0,236,0,12,0,237,0,237,0,16,0,238,0,238,0,34,0,239,0,239,0,11,0,240,0,240,
+0,10,0,241,0,241,0,5,0,243,0,243,0,20,0,244,0,244,0,24,0,245,0,245,0,6,0,
+246,0,246,0,7,0,247,0,247,0,32,0,249,0,249,0,17,0,250,0,250,0,21,0,251,0,
+251,0,13,0,252,0,252,0,16,0,253,0,253,0,29,0,254,0,254,0,3,0,255,0,255,0,
+2,1,0,1,4,0,3,1,5,1,7,0,2,1,8,1,11,0,3,1,12,1,12,0,2,1,13,1,29,0,3,1,30,1,
+30,0,2,1,31,1,32,0,3,1,33,1,33,0,2,1,34,1,34,0,3,1,35,1,36,0,2,1,37,1,37,
+0,3,1,38,1,38,0,2,1,39,1,43,0,3,1,44,1,46,0,2,1,47,1,50,0,3,1,51,1,51,0,2,
+1,52,1,68,0,3,1,69,1,69,0,2,1,70,1,70,0,3,1,73,1,73,0,8,1,74,1,74,0,9,1,77,
+1,77,0,18,1,82,1,82,0,33,1,88,1,88,0,37,1,90,1,90,0,31,1,91,1,91,0,14,1,92,
+1,92,0,16,1,93,1,93,0,34,1,94,1,94,0,11,1,95,1,95,0,15,1,96,1,96,0,5,1,98,
+1,98,0,20,1,99,1,99,0,37,1,100,1,100,0,23,1,101,1,101,0,7,1,102,1,102,0,19,
+1,103,1,103,0,32,1,105,1,105,0,17,1,106,1,106,0,36,1,107,1,107,0,13,1,108,
+1,109,0,37,1,111,1,111,0,7,1,113,1,113,0,37,1,116,1,116,0,8,1,117,1,117,0,
+9,1,119,1,119,0,18,1,124,1,124,0,33,1,127,1,127,0,37,1,128,1,128,0,31,1,129,
+1,129,0,14,1,130,1,130,0,16,1,131,1,131,0,34,1,132,1,132,0,11,1,133,1,133,
+0,15,1,134,1,134,0,5,1,136,1,136,0,20,1,137,1,137,0,37,1,138,1,138,0,23,1,
+139,1,139,0,7,1,140,1,140,0,32,1,142,1,142,0,17,1,143,1,143,0,36,1,144,1,
+144,0,13,1,145,1,146,0,37,1,227,1,229,0,3,1,230,1,232,0,2,1,233,1,233,0,3,
+1,235,1,235,0,3,1,237,1,237,0,2,1,238,1,238,0,3,1,239,1,239,0,2,1,240,1,241,
+0,3,1,243,1,243,0,2,1,244,1,244,0,3,1,245,1,245,0,2,1,246,1,246,0,3,1,247,
+1,247,0,27,1,248,1,250,0,3,1,251,1,251,0,2,1,252,1,252,0,3,1,253,1,254,0,
+2,1,255,1,255,0,3,2,0,2,0,0,2,2,1,2,1,0,3,2,2,2,2,0,30,2,3,2,4,0,3,2,5,2,
+5,0,2,2,6,2,6,0,3,2,7,2,7,0,35,2,8,2,8,0,3,2,9,2,9,0,35,2,10,2,11,0,2,2,12,
+2,17,0,3,2,18,2,19,0,2,2,20,2,25,0,3,2,26,2,26,0,2,2,27,2,27,0,3,2,28,2,28,
+0,21,2,29,2,29,0,3,2,30,2,30,0,21,2,35,2,36,0,3,2,39,2,40,0,3,2,46,2,46,0,
+1,2,143,2,143,0,25,0,72,0,146,0,156,0,166,0,178,0,190,0,202,0,214,0,226,0,
+238,0,250,1,6,1,18,1,30,1,42,1,54,1,66,1,78,1,90,1,102,1,114,1,126,1,138,
+1,150,1,162,1,174,1,186,1,198,1,210,1,222,1,234,1,246,2,2,2,14,2,26,2,38,
+2,50,2,62,2,74,2,88,2,102,2,116,2,130,2,144,2,158,2,172,2,186,2,200,2,214,
+2,228,2,242,3,0,3,14,3,28,3,42,3,56,3,70,3,84,3,98,3,112,3,126,3,140,3,154,
+3,168,3,182,3,196,3,210,3,224,3,238,3,252,4,10,4,24,4,38,0,2,0,1,0,2,0,0,
+0,67,0,2,0,1,0,3,0,0,0,67,0,3,0,1,0,4,0,3,0,0,0,32,0,3,0,1,0,5,0,3,0,0,0,
+33,0,3,0,1,0,6,0,3,0,0,0,34,0,3,0,1,0,7,0,3,0,0,0,35,0,3,0,1,0,8,0,3,0,0,
+0,36,0,3,0,1,0,9,0,3,0,0,0,37,0,3,0,1,0,10,0,3,0,0,0,38,0,3,0,1,0,11,0,3,
+0,0,0,39,0,3,0,1,0,12,0,3,0,0,0,40,0,3,0,1,0,13,0,3,0,0,0,41,0,3,0,1,0,14,
+0,3,0,0,0,42,0,3,0,1,0,15,0,3,0,0,0,43,0,3,0,1,0,16,0,3,0,0,0,44,0,3,0,1,
+0,17,0,3,0,0,0,45,0,3,0,1,0,18,0,3,0,0,0,46,0,3,0,1,0,19,0,3,0,0,0,47,0,3,
+0,1,0,20,0,3,0,0,0,48,0,3,0,1,0,21,0,3,0,0,0,49,0,3,0,1,0,22,0,3,0,0,0,50,
+0,3,0,1,0,23,0,3,0,0,0,51,0,3,0,1,0,24,0,3,0,0,0,52,0,3,0,1,0,25,0,3,0,0,
+0,53,0,3,0,1,0,26,0,3,0,0,0,54,0,3,0,1,0,27,0,3,0,0,0,55,0,3,0,1,0,28,0,3,
+0,0,0,56,0,3,0,1,0,29,0,3,0,0,0,57,0,3,0,1,0,30,0,3,0,0,0,58,0,3,0,1,0,31,
+0,3,0,0,0,59,0,3,0,1,0,32,0,3,0,0,0,60,0,3,0,1,0,33,0,3,0,0,0,61,0,3,0,1,
+0,34,0,3,0,0,0,62,0,3,0,1,0,35,0,3,0,0,0,63,0,3,0,1,0,36,0,3,0,0,0,64,0,3,
+0,1,0,37,0,3,0,0,0,65,0,3,0,1,0,38,0,3,0,0,0,66,0,4,0,1,0,4,0,39,0,3,0,0,
+0,32,0,4,0,1,0,5,0,39,0,3,0,0,0,33,0,4,0,1,0,6,0,39,0,3,0,0,0,34,0,4,0,1,
+0,7,0,39,0,3,0,0,0,35,0,4,0,1,0,8,0,39,0,3,0,0,0,36,0,4,0,1,0,9,0,39,0,3,
+0,0,0,37,0,4,0,1,0,10,0,39,0,3,0,0,0,38,0,4,0,1,0,11,0,39,0,3,0,0,0,39,0,
+4,0,1,0,12,0,39,0,3,0,0,0,40,0,4,0,1,0,13,0,39,0,3,0,0,0,41,0,4,0,1,0,14,
+0,39,0,3,0,0,0,42,0,4,0,1,0,15,0,39,0,3,0,0,0,43,0,4,0,1,0,16,0,39,0,3,0,
+0,0,44,0,4,0,1,0,17,0,39,0,3,0,0,0,45,0,4,0,1,0,18,0,39,0,3,0,0,0,46,0,4,
+0,1,0,19,0,39,0,3,0,0,0,47,0,4,0,1,0,20,0,39,0,3,0,0,0,48,0,4,0,1,0,21,0,
+39,0,3,0,0,0,49,0,4,0,1,0,22,0,39,0,3,0,0,0,50,0,4,0,1,0,23,0,39,0,3,0,0,
+0,51,0,4,0,1,0,24,0,39,0,3,0,0,0,52,0,4,0,1,0,25,0,39,0,3,0,0,0,53,0,4,0,
+1,0,26,0,39,0,3,0,0,0,54,0,4,0,1,0,27,0,39,0,3,0,0,0,55,0,4,0,1,0,28,0,39,
+0,3,0,0,0,56,0,4,0,1,0,29,0,39,0,3,0,0,0,57,0,4,0,1,0,30,0,39,0,3,0,0,0,58,
+0,4,0,1,0,31,0,39,0,3,0,0,0,59,0,4,0,1,0,32,0,39,0,3,0,0,0,60,0,4,0,1,0,33,
+0,39,0,3,0,0,0,61,0,4,0,1,0,34,0,39,0,3,0,0,0,62,0,4,0,1,0,35,0,39,0,3,0,
+0,0,63,0,4,0,1,0,36,0,39,0,3,0,0,0,64,0,4,0,1,0,37,0,39,0,3,0,0,0,65,0,4,
+0,1,0,38,0,39,0,3,0,0,0,66,0,5,0,0,0,1,0,8,0,2,0,28,0,34,0,10,0,0,3,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,122,0,25,0,25,0,5,0,27,0,28,
+0,6,0,29,0,31,0,7,0,35,0,36,0,4,0,37,0,37,0,7,0,38,0,38,0,4,0,40,0,40,0,6,
+0,41,0,41,0,7,0,42,0,42,0,4,0,43,0,43,0,7,0,44,0,46,0,6,0,47,0,47,0,5,0,48,
+0,48,0,6,0,49,0,49,0,8,0,50,0,51,0,6,0,52,0,53,0,3,0,54,0,56,0,8,0,57,0,57,
+0,6,0,58,0,58,0,8,0,59,0,59,0,6,0,60,0,60,0,8,0,61,0,61,0,5,0,92,0,92,0,5,
+0,94,0,94,0,6,0,96,0,96,0,7,0,97,0,97,0,4,0,98,0,98,0,5,0,99,0,99,0,6,0,124,
+0,124,0,6,0,126,0,127,0,6,0,130,0,130,0,7,0,131,0,131,0,6,0,134,0,134,0,9,
+0,156,0,156,0,6,0,157,0,159,0,7,0,162,0,163,0,4,0,165,0,165,0,6,0,166,0,166,
+0,7,0,167,0,167,0,4,0,168,0,168,0,7,0,169,0,170,0,6,0,171,0,171,0,8,0,172,
+0,172,0,6,0,173,0,173,0,8,0,174,0,174,0,6,0,175,0,175,0,8,0,176,0,176,0,6,
+0,177,0,177,0,8,0,178,0,178,0,5,0,180,0,180,0,7,0,185,0,185,0,2,0,223,0,223,
+0,2,0,254,0,254,0,5,1,0,1,1,0,6,1,2,1,4,0,7,1,8,1,9,0,4,1,10,1,10,0,7,1,11,
+1,11,0,4,1,13,1,13,0,6,1,14,1,14,0,7,1,15,1,15,0,4,1,16,1,16,0,7,1,17,1,18,
+0,6,1,19,1,19,0,5,1,20,1,20,0,6,1,21,1,21,0,8,1,22,1,23,0,6,1,24,1,24,0,3,
+1,25,1,26,0,8,1,27,1,27,0,6,1,28,1,28,0,8,1,29,1,29,0,6,1,31,1,32,0,6,1,34,
+1,34,0,6,1,37,1,37,0,5,1,39,1,40,0,6,1,41,1,43,0,7,1,47,1,48,0,4,1,49,1,49,
+0,7,1,50,1,50,0,4,1,52,1,52,0,6,1,53,1,53,0,7,1,54,1,54,0,4,1,55,1,55,0,7,
+1,56,1,57,0,6,1,58,1,58,0,5,1,59,1,59,0,6,1,60,1,60,0,8,1,61,1,62,0,6,1,63,
+1,63,0,3,1,64,1,65,0,8,1,66,1,66,0,6,1,67,1,67,0,8,1,68,1,68,0,6,1,70,1,70,
+0,6,1,227,1,229,0,7,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,240,
+1,241,0,7,1,244,1,244,0,4,1,246,1,246,0,8,1,248,1,248,0,8,1,249,1,249,0,4,
+1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,0,4,2,1,2,1,0,8,2,3,2,3,0,7,2,
+4,2,4,0,6,2,6,2,6,0,8,2,8,2,8,0,8,2,12,2,15,0,6,2,16,2,16,0,8,2,17,2,17,0,
+7,2,20,2,21,0,8,2,22,2,25,0,7,2,27,2,27,0,8,2,29,2,29,0,8,2,35,2,36,0,8,2,
+39,2,40,0,8,2,46,2,46,0,1,0,12,0,26,0,38,0,50,0,62,0,74,0,86,0,98,0,112,0,
+126,0,140,0,154,0,168,0,3,0,1,0,2,0,3,0,0,0,73,0,3,0,1,0,2,0,4,0,0,0,74,0,
+3,0,1,0,2,0,5,0,0,0,75,0,3,0,1,0,2,0,6,0,0,0,76,0,3,0,1,0,2,0,7,0,0,0,77,
+0,3,0,1,0,2,0,8,0,0,0,78,0,4,0,1,0,2,0,9,0,3,0,0,0,73,0,4,0,1,0,2,0,9,0,4,
+0,0,0,74,0,4,0,1,0,2,0,9,0,5,0,0,0,75,0,4,0,1,0,2,0,9,0,6,0,0,0,76,0,4,0,
+1,0,2,0,9,0,7,0,0,0,77,0,4,0,1,0,2,0,9,0,8,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,
+28,0,34,0,10,0,0,2,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,
+116,0,25,0,25,0,6,0,27,0,27,0,6,0,28,0,29,0,7,0,30,0,30,0,8,0,31,0,31,0,7,
+0,35,0,36,0,4,0,37,0,37,0,7,0,38,0,38,0,4,0,40,0,40,0,6,0,41,0,41,0,8,0,42,
+0,42,0,4,0,43,0,43,0,7,0,44,0,48,0,6,0,50,0,50,0,7,0,51,0,51,0,6,0,52,0,53,
+0,3,0,54,0,56,0,8,0,57,0,57,0,6,0,58,0,58,0,8,0,59,0,59,0,6,0,60,0,60,0,8,
+0,61,0,61,0,5,0,92,0,92,0,6,0,94,0,94,0,6,0,96,0,96,0,7,0,97,0,97,0,4,0,98,
+0,99,0,6,0,124,0,124,0,6,0,126,0,127,0,6,0,130,0,130,0,7,0,131,0,131,0,6,
+0,134,0,134,0,9,0,156,0,157,0,7,0,158,0,158,0,8,0,159,0,159,0,7,0,162,0,163,
+0,4,0,165,0,165,0,6,0,166,0,166,0,8,0,167,0,167,0,4,0,168,0,168,0,7,0,169,
+0,170,0,6,0,172,0,172,0,7,0,173,0,173,0,8,0,174,0,174,0,6,0,175,0,175,0,8,
+0,176,0,176,0,6,0,177,0,177,0,8,0,178,0,178,0,5,0,180,0,180,0,8,0,203,0,203,
+0,2,0,241,0,241,0,2,0,254,0,254,0,6,1,0,1,0,0,6,1,1,1,2,0,7,1,3,1,3,0,8,1,
+4,1,4,0,7,1,8,1,9,0,4,1,10,1,10,0,7,1,11,1,11,0,4,1,13,1,13,0,6,1,14,1,14,
+0,8,1,15,1,15,0,4,1,16,1,16,0,7,1,17,1,20,0,6,1,22,1,22,0,7,1,23,1,23,0,6,
+1,24,1,24,0,3,1,26,1,26,0,8,1,27,1,27,0,6,1,29,1,29,0,6,1,31,1,32,0,6,1,34,
+1,34,0,6,1,37,1,37,0,6,1,39,1,39,0,6,1,40,1,41,0,7,1,42,1,42,0,8,1,43,1,43,
+0,7,1,47,1,48,0,4,1,49,1,49,0,7,1,50,1,50,0,4,1,52,1,52,0,6,1,53,1,53,0,8,
+1,54,1,54,0,4,1,55,1,55,0,7,1,56,1,59,0,6,1,61,1,61,0,7,1,62,1,62,0,6,1,63,
+1,63,0,3,1,65,1,65,0,8,1,66,1,66,0,6,1,68,1,68,0,6,1,70,1,70,0,6,1,96,1,96,
+0,2,1,134,1,134,0,2,1,227,1,227,0,8,1,228,1,229,0,7,1,233,1,233,0,4,1,235,
+1,235,0,4,1,238,1,238,0,4,1,240,1,241,0,7,1,244,1,244,0,4,1,246,1,246,0,8,
+1,248,1,248,0,8,1,249,1,249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,
+0,5,2,1,2,1,0,8,2,3,2,3,0,7,2,4,2,4,0,6,2,12,2,15,0,7,2,17,2,17,0,7,2,22,
+2,25,0,8,2,27,2,27,0,8,2,29,2,29,0,8,2,46,2,46,0,1,0,12,0,26,0,38,0,50,0,
+62,0,74,0,86,0,98,0,112,0,126,0,140,0,154,0,168,0,3,0,1,0,2,0,3,0,0,0,73,
+0,3,0,1,0,2,0,4,0,0,0,74,0,3,0,1,0,2,0,5,0,0,0,75,0,3,0,1,0,2,0,6,0,0,0,76,
+0,3,0,1,0,2,0,7,0,0,0,77,0,3,0,1,0,2,0,8,0,0,0,78,0,4,0,1,0,2,0,9,0,3,0,0,
+0,73,0,4,0,1,0,2,0,9,0,4,0,0,0,74,0,4,0,1,0,2,0,9,0,5,0,0,0,75,0,4,0,1,0,
+2,0,9,0,6,0,0,0,76,0,4,0,1,0,2,0,9,0,7,0,0,0,77,0,4,0,1,0,2,0,9,0,8,0,0,0,
+78,0,5,0,0,0,1,0,8,0,2,0,28,0,34,0,10,0,0,2,150,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,0,1,2,46,0,2,0,104,0,25,0,25,0,6,0,27,0,27,0,6,0,28,0,29,0,7,0,
+30,0,31,0,8,0,35,0,36,0,4,0,37,0,37,0,7,0,38,0,38,0,5,0,40,0,40,0,6,0,41,
+0,41,0,8,0,42,0,42,0,4,0,43,0,43,0,7,0,44,0,47,0,6,0,48,0,48,0,7,0,50,0,51,
+0,7,0,52,0,53,0,3,0,57,0,57,0,6,0,59,0,59,0,7,0,60,0,60,0,8,0,61,0,61,0,6,
+0,92,0,92,0,6,0,94,0,94,0,6,0,96,0,96,0,7,0,97,0,97,0,5,0,98,0,98,0,6,0,99,
+0,99,0,7,0,124,0,124,0,6,0,126,0,126,0,7,0,127,0,127,0,6,0,130,0,131,0,7,
+0,134,0,134,0,9,0,156,0,157,0,7,0,158,0,159,0,8,0,162,0,163,0,4,0,165,0,165,
+0,6,0,166,0,166,0,8,0,167,0,167,0,4,0,168,0,168,0,7,0,169,0,169,0,6,0,170,
+0,170,0,7,0,172,0,172,0,7,0,174,0,174,0,6,0,176,0,176,0,7,0,177,0,177,0,8,
+0,178,0,178,0,6,0,180,0,180,0,8,0,207,0,207,0,2,0,245,0,245,0,2,0,254,0,254,
+0,6,1,0,1,0,0,6,1,1,1,2,0,7,1,3,1,4,0,8,1,8,1,9,0,4,1,10,1,10,0,7,1,11,1,
+11,0,5,1,13,1,13,0,6,1,14,1,14,0,8,1,15,1,15,0,4,1,16,1,16,0,7,1,17,1,19,
+0,6,1,20,1,20,0,7,1,22,1,23,0,7,1,24,1,24,0,3,1,27,1,27,0,6,1,29,1,29,0,7,
+1,31,1,32,0,6,1,34,1,34,0,7,1,37,1,37,0,6,1,39,1,39,0,6,1,40,1,41,0,7,1,42,
+1,43,0,8,1,47,1,48,0,4,1,49,1,49,0,7,1,50,1,50,0,5,1,52,1,52,0,6,1,53,1,53,
+0,8,1,54,1,54,0,4,1,55,1,55,0,7,1,56,1,58,0,6,1,59,1,59,0,7,1,61,1,62,0,7,
+1,63,1,63,0,3,1,66,1,66,0,6,1,68,1,68,0,7,1,70,1,70,0,6,1,227,1,227,0,8,1,
+228,1,229,0,7,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,240,1,241,
+0,7,1,244,1,244,0,5,1,248,1,248,0,8,1,249,1,249,0,4,1,250,1,250,0,7,1,252,
+1,252,0,6,1,255,1,255,0,5,2,3,2,3,0,7,2,4,2,4,0,6,2,12,2,15,0,7,2,17,2,17,
+0,7,2,22,2,25,0,8,2,27,2,27,0,8,2,29,2,29,0,8,2,46,2,46,0,1,0,12,0,26,0,38,
+0,50,0,62,0,74,0,86,0,98,0,112,0,126,0,140,0,154,0,168,0,3,0,1,0,2,0,3,0,
+0,0,73,0,3,0,1,0,2,0,4,0,0,0,74,0,3,0,1,0,2,0,5,0,0,0,75,0,3,0,1,0,2,0,6,
+0,0,0,76,0,3,0,1,0,2,0,7,0,0,0,77,0,3,0,1,0,2,0,8,0,0,0,78,0,4,0,1,0,2,0,
+9,0,3,0,0,0,73,0,4,0,1,0,2,0,9,0,4,0,0,0,74,0,4,0,1,0,2,0,9,0,5,0,0,0,75,
+0,4,0,1,0,2,0,9,0,6,0,0,0,76,0,4,0,1,0,2,0,9,0,7,0,0,0,77,0,4,0,1,0,2,0,9,
+0,8,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,26,0,32,0,9,0,0,2,154,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,105,0,25,0,25,0,5,0,27,0,28,0,6,0,29,0,31,
+0,7,0,35,0,36,0,3,0,37,0,37,0,7,0,38,0,38,0,4,0,40,0,40,0,6,0,41,0,41,0,7,
+0,42,0,42,0,4,0,43,0,43,0,7,0,44,0,45,0,5,0,46,0,46,0,6,0,47,0,47,0,5,0,48,
+0,48,0,6,0,50,0,51,0,6,0,52,0,53,0,3,0,57,0,57,0,5,0,59,0,59,0,6,0,61,0,61,
+0,5,0,92,0,92,0,5,0,94,0,94,0,6,0,96,0,96,0,7,0,97,0,97,0,4,0,98,0,98,0,5,
+0,99,0,99,0,6,0,124,0,124,0,5,0,126,0,127,0,6,0,130,0,130,0,7,0,131,0,131,
+0,6,0,134,0,134,0,8,0,156,0,156,0,6,0,157,0,159,0,7,0,162,0,163,0,3,0,165,
+0,165,0,6,0,166,0,166,0,7,0,167,0,167,0,4,0,168,0,168,0,7,0,169,0,170,0,6,
+0,172,0,172,0,6,0,174,0,174,0,5,0,176,0,176,0,6,0,178,0,178,0,5,0,180,0,180,
+0,7,0,208,0,208,0,2,0,218,0,218,0,2,0,246,0,246,0,2,0,254,0,254,0,5,1,0,1,
+1,0,6,1,2,1,4,0,7,1,8,1,9,0,3,1,10,1,10,0,7,1,11,1,11,0,4,1,13,1,13,0,5,1,
+14,1,14,0,7,1,15,1,15,0,4,1,16,1,16,0,7,1,17,1,17,0,5,1,18,1,18,0,6,1,19,
+1,19,0,5,1,20,1,20,0,6,1,22,1,23,0,6,1,24,1,24,0,3,1,27,1,27,0,5,1,29,1,29,
+0,6,1,31,1,32,0,5,1,34,1,34,0,6,1,37,1,37,0,5,1,39,1,40,0,6,1,41,1,43,0,7,
+1,47,1,48,0,3,1,49,1,49,0,7,1,50,1,50,0,4,1,52,1,52,0,5,1,53,1,53,0,7,1,54,
+1,54,0,4,1,55,1,55,0,7,1,56,1,56,0,5,1,57,1,57,0,6,1,58,1,58,0,5,1,59,1,59,
+0,6,1,61,1,62,0,6,1,63,1,63,0,3,1,66,1,66,0,5,1,68,1,68,0,6,1,70,1,70,0,5,
+1,101,1,101,0,2,1,111,1,111,0,2,1,139,1,139,0,2,1,227,1,229,0,7,1,233,1,233,
+0,3,1,235,1,235,0,3,1,238,1,238,0,3,1,240,1,241,0,7,1,244,1,244,0,4,1,248,
+1,248,0,7,1,249,1,249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,0,4,
+2,3,2,3,0,7,2,4,2,4,0,6,2,12,2,15,0,6,2,17,2,17,0,7,2,22,2,25,0,7,2,46,2,
+46,0,1,0,10,0,22,0,34,0,46,0,58,0,70,0,82,0,96,0,110,0,124,0,138,0,3,0,1,
+0,2,0,3,0,0,0,74,0,3,0,1,0,2,0,4,0,0,0,75,0,3,0,1,0,2,0,5,0,0,0,76,0,3,0,
+1,0,2,0,6,0,0,0,77,0,3,0,1,0,2,0,7,0,0,0,78,0,4,0,1,0,2,0,8,0,3,0,0,0,74,
+0,4,0,1,0,2,0,8,0,4,0,0,0,75,0,4,0,1,0,2,0,8,0,5,0,0,0,76,0,4,0,1,0,2,0,8,
+0,6,0,0,0,77,0,4,0,1,0,2,0,8,0,7,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,26,0,32,0,
+9,0,0,2,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,97,0,25,0,25,0,
+5,0,27,0,28,0,6,0,29,0,31,0,7,0,35,0,36,0,4,0,37,0,37,0,7,0,38,0,38,0,4,0,
+40,0,40,0,6,0,41,0,41,0,7,0,42,0,42,0,4,0,43,0,43,0,7,0,44,0,46,0,6,0,47,
+0,47,0,5,0,48,0,48,0,6,0,50,0,51,0,6,0,52,0,53,0,3,0,57,0,57,0,6,0,59,0,59,
+0,6,0,61,0,61,0,5,0,92,0,92,0,5,0,94,0,94,0,6,0,96,0,96,0,7,0,97,0,97,0,4,
+0,98,0,98,0,5,0,99,0,99,0,6,0,124,0,124,0,6,0,126,0,127,0,6,0,130,0,130,0,
+7,0,131,0,131,0,6,0,134,0,134,0,8,0,156,0,156,0,6,0,157,0,159,0,7,0,162,0,
+163,0,4,0,165,0,165,0,6,0,166,0,166,0,7,0,167,0,167,0,4,0,168,0,168,0,7,0,
+169,0,170,0,6,0,172,0,172,0,6,0,174,0,174,0,6,0,176,0,176,0,6,0,178,0,178,
+0,5,0,180,0,180,0,7,0,254,0,254,0,5,1,0,1,1,0,6,1,2,1,4,0,7,1,8,1,9,0,4,1,
+10,1,10,0,7,1,11,1,11,0,4,1,13,1,13,0,5,1,14,1,14,0,7,1,15,1,15,0,4,1,16,
+1,16,0,7,1,17,1,18,0,6,1,19,1,19,0,5,1,20,1,20,0,6,1,22,1,23,0,6,1,24,1,24,
+0,3,1,27,1,27,0,6,1,29,1,29,0,6,1,31,1,32,0,6,1,34,1,34,0,6,1,37,1,37,0,5,
+1,39,1,40,0,6,1,41,1,43,0,7,1,47,1,48,0,4,1,49,1,49,0,7,1,50,1,50,0,4,1,52,
+1,52,0,5,1,53,1,53,0,7,1,54,1,54,0,4,1,55,1,55,0,7,1,56,1,57,0,6,1,58,1,58,
+0,5,1,59,1,59,0,6,1,61,1,62,0,6,1,63,1,63,0,3,1,66,1,66,0,6,1,68,1,68,0,6,
+1,70,1,70,0,6,1,73,1,73,0,2,1,116,1,116,0,2,1,227,1,229,0,7,1,233,1,233,0,
+4,1,235,1,235,0,4,1,238,1,238,0,4,1,240,1,241,0,7,1,244,1,244,0,4,1,249,1,
+249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,0,4,2,3,2,3,0,7,2,4,2,
+4,0,6,2,12,2,15,0,6,2,17,2,17,0,7,2,22,2,25,0,7,2,46,2,46,0,1,0,10,0,22,0,
+34,0,46,0,58,0,70,0,82,0,96,0,110,0,124,0,138,0,3,0,1,0,2,0,3,0,0,0,74,0,
+3,0,1,0,2,0,4,0,0,0,75,0,3,0,1,0,2,0,5,0,0,0,76,0,3,0,1,0,2,0,6,0,0,0,77,
+0,3,0,1,0,2,0,7,0,0,0,78,0,4,0,1,0,2,0,8,0,3,0,0,0,74,0,4,0,1,0,2,0,8,0,4,
+0,0,0,75,0,4,0,1,0,2,0,8,0,5,0,0,0,76,0,4,0,1,0,2,0,8,0,6,0,0,0,77,0,4,0,
+1,0,2,0,8,0,7,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,26,0,32,0,9,0,0,2,70,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,91,0,25,0,25,0,6,0,27,0,27,0,6,0,28,
+0,31,0,7,0,35,0,36,0,4,0,37,0,37,0,7,0,38,0,38,0,4,0,40,0,40,0,6,0,42,0,42,
+0,4,0,43,0,43,0,7,0,44,0,48,0,6,0,50,0,50,0,7,0,51,0,51,0,6,0,52,0,53,0,3,
+0,57,0,57,0,6,0,59,0,59,0,6,0,61,0,61,0,5,0,92,0,92,0,6,0,94,0,94,0,6,0,96,
+0,96,0,7,0,97,0,97,0,4,0,98,0,99,0,6,0,124,0,124,0,6,0,126,0,127,0,6,0,130,
+0,130,0,7,0,131,0,131,0,6,0,134,0,134,0,8,0,156,0,159,0,7,0,162,0,163,0,4,
+0,165,0,165,0,6,0,167,0,167,0,4,0,168,0,168,0,7,0,169,0,170,0,6,0,172,0,172,
+0,7,0,174,0,174,0,6,0,176,0,176,0,6,0,178,0,178,0,5,0,180,0,180,0,7,0,186,
+0,186,0,2,0,224,0,224,0,2,0,254,0,254,0,6,1,0,1,0,0,6,1,1,1,4,0,7,1,8,1,9,
+0,4,1,10,1,10,0,7,1,11,1,11,0,4,1,13,1,13,0,6,1,15,1,15,0,4,1,16,1,16,0,7,
+1,17,1,20,0,6,1,22,1,22,0,7,1,23,1,23,0,6,1,24,1,24,0,3,1,27,1,27,0,6,1,29,
+1,29,0,6,1,31,1,32,0,6,1,34,1,34,0,6,1,37,1,37,0,6,1,39,1,39,0,6,1,40,1,43,
+0,7,1,47,1,48,0,4,1,49,1,49,0,7,1,50,1,50,0,4,1,52,1,52,0,6,1,54,1,54,0,4,
+1,55,1,55,0,7,1,56,1,59,0,6,1,61,1,61,0,7,1,62,1,62,0,6,1,63,1,63,0,3,1,66,
+1,66,0,6,1,68,1,68,0,6,1,70,1,70,0,6,1,74,1,74,0,2,1,117,1,117,0,2,1,228,
+1,229,0,7,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,240,1,241,0,7,
+1,244,1,244,0,4,1,249,1,249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,
+0,4,2,3,2,3,0,7,2,4,2,4,0,6,2,12,2,13,0,6,2,14,2,15,0,7,2,17,2,17,0,7,2,22,
+2,25,0,7,2,46,2,46,0,1,0,10,0,22,0,34,0,46,0,58,0,70,0,82,0,96,0,110,0,124,
+0,138,0,3,0,1,0,2,0,3,0,0,0,74,0,3,0,1,0,2,0,4,0,0,0,75,0,3,0,1,0,2,0,5,0,
+0,0,76,0,3,0,1,0,2,0,6,0,0,0,77,0,3,0,1,0,2,0,7,0,0,0,78,0,4,0,1,0,2,0,8,
+0,3,0,0,0,74,0,4,0,1,0,2,0,8,0,4,0,0,0,75,0,4,0,1,0,2,0,8,0,5,0,0,0,76,0,
+4,0,1,0,2,0,8,0,6,0,0,0,77,0,4,0,1,0,2,0,8,0,7,0,0,0,78,0,5,0,0,0,1,0,8,0,
+2,0,26,0,32,0,9,0,0,2,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,94,
+0,25,0,25,0,5,0,27,0,27,0,6,0,28,0,29,0,7,0,31,0,31,0,6,0,35,0,35,0,3,0,36,
+0,36,0,4,0,37,0,37,0,7,0,38,0,38,0,4,0,40,0,40,0,5,0,42,0,42,0,3,0,43,0,43,
+0,7,0,44,0,45,0,6,0,46,0,47,0,5,0,48,0,48,0,6,0,50,0,50,0,7,0,51,0,51,0,5,
+0,52,0,53,0,3,0,57,0,57,0,5,0,59,0,59,0,6,0,60,0,60,0,7,0,61,0,61,0,4,0,92,
+0,92,0,6,0,94,0,94,0,6,0,96,0,96,0,7,0,97,0,97,0,4,0,98,0,99,0,6,0,124,0,
+124,0,6,0,126,0,127,0,6,0,130,0,130,0,7,0,131,0,131,0,6,0,134,0,134,0,8,0,
+156,0,157,0,7,0,159,0,159,0,7,0,162,0,163,0,4,0,165,0,165,0,6,0,167,0,167,
+0,4,0,168,0,168,0,7,0,169,0,170,0,6,0,172,0,172,0,7,0,174,0,174,0,6,0,176,
+0,176,0,6,0,178,0,178,0,5,0,202,0,202,0,2,0,240,0,240,0,2,0,254,0,254,0,6,
+1,0,1,0,0,6,1,1,1,2,0,7,1,4,1,4,0,7,1,8,1,9,0,4,1,10,1,10,0,7,1,11,1,11,0,
+4,1,13,1,13,0,6,1,15,1,15,0,3,1,16,1,16,0,7,1,17,1,20,0,6,1,22,1,22,0,7,1,
+23,1,23,0,6,1,24,1,24,0,3,1,27,1,27,0,6,1,29,1,29,0,6,1,31,1,32,0,6,1,34,
+1,34,0,6,1,37,1,37,0,6,1,39,1,39,0,6,1,40,1,41,0,7,1,43,1,43,0,7,1,47,1,48,
+0,4,1,49,1,49,0,7,1,50,1,50,0,4,1,52,1,52,0,6,1,54,1,54,0,4,1,55,1,55,0,7,
+1,56,1,59,0,6,1,61,1,61,0,7,1,62,1,62,0,6,1,63,1,63,0,3,1,66,1,66,0,6,1,68,
+1,68,0,6,1,70,1,70,0,6,1,228,1,229,0,7,1,233,1,233,0,4,1,235,1,235,0,4,1,
+238,1,238,0,4,1,240,1,241,0,7,1,244,1,244,0,4,1,249,1,249,0,4,1,250,1,250,
+0,6,1,252,1,252,0,3,1,255,1,255,0,5,2,3,2,3,0,7,2,4,2,4,0,6,2,12,2,15,0,7,
+2,17,2,17,0,7,2,46,2,46,0,1,0,10,0,22,0,34,0,46,0,58,0,70,0,82,0,96,0,110,
+0,124,0,138,0,3,0,1,0,2,0,3,0,0,0,74,0,3,0,1,0,2,0,4,0,0,0,75,0,3,0,1,0,2,
+0,5,0,0,0,76,0,3,0,1,0,2,0,6,0,0,0,77,0,3,0,1,0,2,0,7,0,0,0,78,0,4,0,1,0,
+2,0,8,0,3,0,0,0,74,0,4,0,1,0,2,0,8,0,4,0,0,0,75,0,4,0,1,0,2,0,8,0,5,0,0,0,
+76,0,4,0,1,0,2,0,8,0,6,0,0,0,77,0,4,0,1,0,2,0,8,0,7,0,0,0,78,0,5,0,0,0,1,
+0,8,0,2,0,26,0,32,0,9,0,0,2,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,
+2,0,91,0,25,0,25,0,6,0,27,0,27,0,6,0,28,0,29,0,7,0,31,0,31,0,7,0,35,0,36,
+0,4,0,37,0,37,0,7,0,38,0,38,0,4,0,40,0,40,0,6,0,42,0,42,0,4,0,43,0,43,0,7,
+0,44,0,48,0,6,0,50,0,51,0,7,0,52,0,53,0,3,0,57,0,57,0,6,0,59,0,59,0,6,0,61,
+0,61,0,6,0,92,0,92,0,6,0,94,0,94,0,6,0,96,0,96,0,7,0,97,0,97,0,4,0,98,0,98,
+0,6,0,99,0,99,0,7,0,124,0,124,0,6,0,126,0,126,0,7,0,127,0,127,0,6,0,130,0,
+130,0,7,0,131,0,131,0,6,0,134,0,134,0,8,0,156,0,157,0,7,0,159,0,159,0,7,0,
+162,0,163,0,4,0,165,0,165,0,6,0,167,0,167,0,4,0,168,0,168,0,7,0,169,0,170,
+0,6,0,172,0,172,0,7,0,174,0,174,0,6,0,176,0,176,0,6,0,178,0,178,0,6,0,201,
+0,201,0,2,0,239,0,239,0,2,0,254,0,254,0,6,1,0,1,0,0,6,1,1,1,2,0,7,1,4,1,4,
+0,7,1,8,1,9,0,4,1,10,1,10,0,7,1,11,1,11,0,4,1,13,1,13,0,6,1,15,1,15,0,4,1,
+16,1,16,0,7,1,17,1,20,0,6,1,22,1,23,0,7,1,24,1,24,0,3,1,27,1,27,0,6,1,29,
+1,29,0,6,1,31,1,32,0,6,1,34,1,34,0,7,1,37,1,37,0,6,1,39,1,39,0,6,1,40,1,41,
+0,7,1,43,1,43,0,7,1,47,1,48,0,4,1,49,1,49,0,7,1,50,1,50,0,4,1,52,1,52,0,6,
+1,54,1,54,0,4,1,55,1,55,0,7,1,56,1,59,0,6,1,61,1,62,0,7,1,63,1,63,0,3,1,66,
+1,66,0,6,1,68,1,68,0,6,1,70,1,70,0,6,1,94,1,94,0,2,1,132,1,132,0,2,1,228,
+1,229,0,7,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,240,1,241,0,7,
+1,244,1,244,0,4,1,249,1,249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,
+0,5,2,3,2,3,0,7,2,4,2,4,0,6,2,12,2,15,0,7,2,17,2,17,0,7,2,46,2,46,0,1,0,10,
+0,22,0,34,0,46,0,58,0,70,0,82,0,96,0,110,0,124,0,138,0,3,0,1,0,2,0,3,0,0,
+0,74,0,3,0,1,0,2,0,4,0,0,0,75,0,3,0,1,0,2,0,5,0,0,0,76,0,3,0,1,0,2,0,6,0,
+0,0,77,0,3,0,1,0,2,0,7,0,0,0,78,0,4,0,1,0,2,0,8,0,3,0,0,0,74,0,4,0,1,0,2,
+0,8,0,4,0,0,0,75,0,4,0,1,0,2,0,8,0,5,0,0,0,76,0,4,0,1,0,2,0,8,0,6,0,0,0,77,
+0,4,0,1,0,2,0,8,0,7,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,26,0,32,0,9,0,0,2,58,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,89,0,25,0,25,0,5,0,27,0,27,0,
+6,0,28,0,29,0,7,0,35,0,36,0,4,0,37,0,37,0,7,0,38,0,38,0,5,0,40,0,40,0,6,0,
+42,0,42,0,4,0,43,0,43,0,7,0,44,0,45,0,6,0,46,0,47,0,5,0,48,0,48,0,6,0,50,
+0,50,0,7,0,51,0,51,0,6,0,52,0,53,0,3,0,54,0,54,0,7,0,57,0,57,0,5,0,59,0,60,
+0,7,0,61,0,61,0,6,0,92,0,92,0,6,0,94,0,94,0,6,0,96,0,96,0,7,0,97,0,97,0,5,
+0,98,0,98,0,6,0,99,0,99,0,7,0,124,0,124,0,6,0,126,0,126,0,7,0,127,0,127,0,
+6,0,130,0,130,0,7,0,131,0,131,0,6,0,134,0,134,0,8,0,156,0,157,0,7,0,162,0,
+163,0,4,0,165,0,165,0,6,0,167,0,167,0,4,0,168,0,168,0,7,0,169,0,170,0,6,0,
+172,0,172,0,7,0,174,0,174,0,6,0,176,0,176,0,7,0,178,0,178,0,6,0,198,0,198,
+0,2,0,236,0,236,0,2,0,254,0,254,0,6,1,0,1,0,0,6,1,1,1,2,0,7,1,8,1,9,0,4,1,
+10,1,10,0,7,1,11,1,11,0,5,1,13,1,13,0,6,1,15,1,15,0,4,1,16,1,16,0,7,1,17,
+1,20,0,6,1,22,1,23,0,7,1,24,1,24,0,3,1,27,1,27,0,6,1,29,1,29,0,7,1,31,1,32,
+0,6,1,34,1,34,0,7,1,37,1,37,0,6,1,39,1,39,0,6,1,40,1,41,0,7,1,47,1,48,0,4,
+1,49,1,49,0,7,1,50,1,50,0,5,1,52,1,52,0,6,1,54,1,54,0,4,1,55,1,55,0,7,1,56,
+1,59,0,6,1,61,1,62,0,7,1,63,1,63,0,3,1,66,1,66,0,6,1,68,1,68,0,7,1,70,1,70,
+0,6,1,228,1,229,0,7,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,240,
+1,241,0,7,1,244,1,244,0,5,1,249,1,249,0,4,1,250,1,250,0,7,1,252,1,252,0,6,
+1,255,1,255,0,5,2,3,2,3,0,7,2,4,2,4,0,6,2,12,2,15,0,7,2,17,2,17,0,7,2,46,
+2,46,0,1,0,10,0,22,0,34,0,46,0,58,0,70,0,82,0,96,0,110,0,124,0,138,0,3,0,
+1,0,2,0,3,0,0,0,74,0,3,0,1,0,2,0,4,0,0,0,75,0,3,0,1,0,2,0,5,0,0,0,76,0,3,
+0,1,0,2,0,6,0,0,0,77,0,3,0,1,0,2,0,7,0,0,0,78,0,4,0,1,0,2,0,8,0,3,0,0,0,74,
+0,4,0,1,0,2,0,8,0,4,0,0,0,75,0,4,0,1,0,2,0,8,0,5,0,0,0,76,0,4,0,1,0,2,0,8,
+0,6,0,0,0,77,0,4,0,1,0,2,0,8,0,7,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,26,0,32,0,
+9,0,0,2,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,87,0,25,0,25,0,
+5,0,27,0,27,0,6,0,28,0,28,0,7,0,35,0,36,0,4,0,38,0,38,0,5,0,40,0,40,0,7,0,
+42,0,42,0,5,0,43,0,43,0,7,0,44,0,46,0,6,0,47,0,47,0,5,0,48,0,48,0,7,0,50,
+0,50,0,7,0,51,0,51,0,6,0,52,0,53,0,3,0,57,0,57,0,6,0,59,0,59,0,6,0,61,0,61,
+0,6,0,92,0,92,0,6,0,94,0,94,0,6,0,97,0,97,0,5,0,98,0,98,0,6,0,99,0,99,0,7,
+0,124,0,124,0,6,0,126,0,126,0,7,0,127,0,127,0,6,0,131,0,131,0,7,0,134,0,134,
+0,8,0,156,0,156,0,7,0,162,0,163,0,4,0,165,0,165,0,7,0,167,0,167,0,5,0,168,
+0,170,0,7,0,172,0,172,0,7,0,174,0,174,0,6,0,176,0,176,0,7,0,178,0,178,0,6,
+0,214,0,214,0,2,0,251,0,251,0,2,0,254,0,254,0,6,1,0,1,0,0,6,1,1,1,1,0,7,1,
+8,1,9,0,4,1,11,1,11,0,5,1,13,1,13,0,6,1,15,1,15,0,5,1,16,1,16,0,7,1,17,1,
+17,0,6,1,18,1,18,0,7,1,19,1,19,0,6,1,20,1,20,0,7,1,22,1,23,0,7,1,24,1,24,
+0,3,1,27,1,27,0,6,1,29,1,29,0,7,1,31,1,32,0,6,1,34,1,34,0,7,1,37,1,37,0,6,
+1,39,1,39,0,6,1,40,1,40,0,7,1,47,1,48,0,4,1,50,1,50,0,5,1,52,1,52,0,6,1,54,
+1,54,0,5,1,55,1,55,0,7,1,56,1,56,0,6,1,57,1,57,0,7,1,58,1,58,0,6,1,59,1,59,
+0,7,1,61,1,62,0,7,1,63,1,63,0,3,1,66,1,66,0,6,1,68,1,68,0,7,1,70,1,70,0,6,
+1,107,1,107,0,2,1,144,1,144,0,2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,
+0,4,1,244,1,244,0,5,1,249,1,249,0,5,1,250,1,250,0,7,1,252,1,252,0,6,1,255,
+1,255,0,5,2,3,2,4,0,7,2,12,2,15,0,7,2,17,2,17,0,7,2,46,2,46,0,1,0,10,0,22,
+0,34,0,46,0,58,0,70,0,82,0,96,0,110,0,124,0,138,0,3,0,1,0,2,0,3,0,0,0,74,
+0,3,0,1,0,2,0,4,0,0,0,75,0,3,0,1,0,2,0,5,0,0,0,76,0,3,0,1,0,2,0,6,0,0,0,77,
+0,3,0,1,0,2,0,7,0,0,0,78,0,4,0,1,0,2,0,8,0,3,0,0,0,74,0,4,0,1,0,2,0,8,0,4,
+0,0,0,75,0,4,0,1,0,2,0,8,0,5,0,0,0,76,0,4,0,1,0,2,0,8,0,6,0,0,0,77,0,4,0,
+1,0,2,0,8,0,7,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,1,240,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,77,0,25,0,25,0,5,0,27,0,28,0,6,0,35,
+0,36,0,4,0,38,0,38,0,4,0,40,0,40,0,6,0,42,0,42,0,4,0,44,0,45,0,5,0,46,0,46,
+0,6,0,47,0,47,0,5,0,48,0,48,0,6,0,50,0,51,0,6,0,52,0,53,0,3,0,57,0,57,0,5,
+0,59,0,59,0,6,0,61,0,61,0,5,0,92,0,92,0,5,0,94,0,94,0,6,0,97,0,97,0,4,0,98,
+0,98,0,5,0,99,0,99,0,6,0,124,0,124,0,5,0,126,0,127,0,6,0,131,0,131,0,6,0,
+134,0,134,0,7,0,156,0,156,0,6,0,162,0,163,0,4,0,165,0,165,0,6,0,167,0,167,
+0,4,0,169,0,170,0,6,0,172,0,172,0,6,0,174,0,174,0,5,0,176,0,176,0,6,0,178,
+0,178,0,5,0,254,0,254,0,5,1,0,1,1,0,6,1,8,1,9,0,4,1,11,1,11,0,4,1,13,1,13,
+0,5,1,15,1,15,0,4,1,17,1,17,0,5,1,18,1,18,0,6,1,19,1,19,0,5,1,20,1,20,0,6,
+1,22,1,23,0,6,1,24,1,24,0,3,1,27,1,27,0,5,1,29,1,29,0,6,1,31,1,32,0,5,1,34,
+1,34,0,6,1,37,1,37,0,5,1,39,1,40,0,6,1,47,1,48,0,4,1,50,1,50,0,4,1,52,1,52,
+0,5,1,54,1,54,0,4,1,56,1,56,0,5,1,57,1,57,0,6,1,58,1,58,0,5,1,59,1,59,0,6,
+1,61,1,62,0,6,1,63,1,63,0,3,1,66,1,66,0,5,1,68,1,68,0,6,1,70,1,70,0,5,1,91,
+1,91,0,2,1,129,1,129,0,2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,
+1,244,1,244,0,4,1,249,1,249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,
+0,4,2,4,2,4,0,6,2,12,2,15,0,6,2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,0,66,
+0,80,0,94,0,108,0,3,0,1,0,2,0,3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,3,0,1,
+0,2,0,5,0,0,0,77,0,3,0,1,0,2,0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,75,0,
+4,0,1,0,2,0,7,0,4,0,0,0,76,0,4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,0,7,0,
+6,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,1,240,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,0,1,2,46,0,2,0,77,0,25,0,25,0,5,0,27,0,28,0,6,0,35,0,36,0,4,0,38,
+0,38,0,4,0,40,0,40,0,6,0,42,0,42,0,4,0,44,0,45,0,5,0,46,0,46,0,6,0,47,0,47,
+0,5,0,48,0,48,0,6,0,50,0,51,0,6,0,52,0,53,0,3,0,57,0,57,0,5,0,59,0,59,0,6,
+0,61,0,61,0,5,0,92,0,92,0,5,0,94,0,94,0,6,0,97,0,97,0,4,0,98,0,98,0,5,0,99,
+0,99,0,6,0,124,0,124,0,5,0,126,0,127,0,6,0,131,0,131,0,6,0,134,0,134,0,7,
+0,156,0,156,0,6,0,162,0,163,0,4,0,165,0,165,0,6,0,167,0,167,0,4,0,169,0,170,
+0,6,0,172,0,172,0,6,0,174,0,174,0,5,0,176,0,176,0,6,0,178,0,178,0,5,0,254,
+0,254,0,5,1,0,1,1,0,6,1,8,1,9,0,4,1,11,1,11,0,4,1,13,1,13,0,5,1,15,1,15,0,
+4,1,17,1,17,0,5,1,18,1,18,0,6,1,19,1,19,0,5,1,20,1,20,0,6,1,22,1,23,0,6,1,
+24,1,24,0,3,1,27,1,27,0,5,1,29,1,29,0,6,1,31,1,32,0,5,1,34,1,34,0,6,1,37,
+1,37,0,5,1,39,1,40,0,6,1,47,1,48,0,4,1,50,1,50,0,4,1,52,1,52,0,5,1,54,1,54,
+0,4,1,56,1,56,0,5,1,57,1,57,0,6,1,58,1,58,0,5,1,59,1,59,0,6,1,61,1,62,0,6,
+1,63,1,63,0,3,1,66,1,66,0,5,1,68,1,68,0,6,1,70,1,70,0,5,1,95,1,95,0,2,1,133,
+1,133,0,2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,4,
+1,249,1,249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,0,4,2,4,2,4,0,
+6,2,12,2,15,0,6,2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,0,108,
+0,3,0,1,0,2,0,3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,3,0,1,0,2,0,5,0,0,0,77,
+0,3,0,1,0,2,0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,75,0,4,0,1,0,2,0,7,0,4,
+0,0,0,76,0,4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,0,7,0,6,0,0,0,78,0,5,0,
+0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,1,246,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,
+0,2,0,78,0,25,0,25,0,5,0,27,0,28,0,6,0,35,0,36,0,4,0,38,0,38,0,4,0,40,0,40,
+0,6,0,42,0,42,0,4,0,44,0,46,0,6,0,47,0,47,0,5,0,48,0,48,0,6,0,50,0,51,0,6,
+0,52,0,53,0,3,0,57,0,57,0,6,0,59,0,59,0,6,0,61,0,61,0,5,0,92,0,92,0,5,0,94,
+0,94,0,6,0,97,0,97,0,4,0,98,0,98,0,5,0,99,0,99,0,6,0,124,0,124,0,6,0,126,
+0,127,0,6,0,131,0,131,0,6,0,134,0,134,0,7,0,156,0,156,0,6,0,162,0,163,0,4,
+0,165,0,165,0,6,0,167,0,167,0,4,0,169,0,170,0,6,0,172,0,172,0,6,0,174,0,174,
+0,6,0,176,0,176,0,6,0,178,0,178,0,5,0,199,0,199,0,2,0,215,0,215,0,2,0,237,
+0,237,0,2,0,252,0,252,0,2,0,254,0,254,0,5,1,0,1,1,0,6,1,8,1,9,0,4,1,11,1,
+11,0,4,1,13,1,13,0,5,1,15,1,15,0,4,1,17,1,18,0,6,1,19,1,19,0,5,1,20,1,20,
+0,6,1,22,1,23,0,6,1,24,1,24,0,3,1,27,1,27,0,6,1,29,1,29,0,6,1,31,1,32,0,6,
+1,34,1,34,0,6,1,37,1,37,0,5,1,39,1,40,0,6,1,47,1,48,0,4,1,50,1,50,0,4,1,52,
+1,52,0,5,1,54,1,54,0,4,1,56,1,57,0,6,1,58,1,58,0,5,1,59,1,59,0,6,1,61,1,62,
+0,6,1,63,1,63,0,3,1,66,1,66,0,6,1,68,1,68,0,6,1,70,1,70,0,6,1,92,1,92,0,2,
+1,130,1,130,0,2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,
+0,4,1,249,1,249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,0,4,2,4,2,
+4,0,6,2,12,2,15,0,6,2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,
+0,108,0,3,0,1,0,2,0,3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,3,0,1,0,2,0,5,0,
+0,0,77,0,3,0,1,0,2,0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,75,0,4,0,1,0,2,
+0,7,0,4,0,0,0,76,0,4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,0,7,0,6,0,0,0,78,
+0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,1,234,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+1,2,46,0,2,0,76,0,25,0,25,0,5,0,27,0,28,0,6,0,35,0,36,0,4,0,38,0,38,0,4,0,
+40,0,40,0,6,0,42,0,42,0,4,0,44,0,46,0,6,0,47,0,47,0,5,0,48,0,48,0,6,0,50,
+0,51,0,6,0,52,0,53,0,3,0,57,0,57,0,5,0,59,0,59,0,6,0,61,0,61,0,5,0,92,0,92,
+0,5,0,94,0,94,0,6,0,97,0,97,0,4,0,98,0,98,0,5,0,99,0,99,0,6,0,124,0,124,0,
+6,0,126,0,127,0,6,0,131,0,131,0,6,0,134,0,134,0,7,0,156,0,156,0,6,0,162,0,
+163,0,4,0,165,0,165,0,6,0,167,0,167,0,4,0,169,0,170,0,6,0,172,0,172,0,6,0,
+174,0,174,0,6,0,176,0,176,0,6,0,178,0,178,0,5,0,212,0,212,0,2,0,249,0,249,
+0,2,0,254,0,254,0,5,1,0,1,1,0,6,1,8,1,9,0,4,1,11,1,11,0,4,1,13,1,13,0,6,1,
+15,1,15,0,4,1,17,1,18,0,6,1,19,1,19,0,5,1,20,1,20,0,6,1,22,1,23,0,6,1,24,
+1,24,0,3,1,27,1,27,0,6,1,29,1,29,0,6,1,31,1,32,0,6,1,34,1,34,0,6,1,37,1,37,
+0,5,1,39,1,40,0,6,1,47,1,48,0,4,1,50,1,50,0,4,1,52,1,52,0,6,1,54,1,54,0,4,
+1,56,1,57,0,6,1,58,1,58,0,5,1,59,1,59,0,6,1,61,1,62,0,6,1,63,1,63,0,3,1,66,
+1,66,0,6,1,68,1,68,0,6,1,70,1,70,0,6,1,105,1,105,0,2,1,142,1,142,0,2,1,233,
+1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,4,1,249,1,249,0,4,
+1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,0,4,2,4,2,4,0,6,2,12,2,15,0,6,
+2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,0,108,0,3,0,1,0,2,0,
+3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,3,0,1,0,2,0,5,0,0,0,77,0,3,0,1,0,2,
+0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,75,0,4,0,1,0,2,0,7,0,4,0,0,0,76,0,
+4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,0,7,0,6,0,0,0,78,0,5,0,0,0,1,0,8,0,
+2,0,24,0,30,0,8,0,0,1,60,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,47,0,
+25,0,25,0,5,0,27,0,28,0,6,0,35,0,36,0,4,0,38,0,38,0,4,0,40,0,40,0,6,0,42,
+0,42,0,4,0,44,0,48,0,6,0,51,0,51,0,6,0,52,0,53,0,3,0,57,0,57,0,6,0,59,0,59,
+0,6,0,61,0,61,0,5,0,92,0,92,0,5,0,94,0,94,0,6,0,97,0,97,0,4,0,98,0,99,0,6,
+0,124,0,124,0,6,0,126,0,127,0,6,0,131,0,131,0,6,0,134,0,134,0,7,0,156,0,156,
+0,6,0,162,0,163,0,4,0,165,0,165,0,6,0,167,0,167,0,4,0,169,0,170,0,6,0,174,
+0,174,0,6,0,176,0,176,0,6,0,178,0,178,0,5,0,188,0,188,0,2,0,226,0,226,0,2,
+0,254,0,254,0,5,1,0,1,1,0,6,1,8,1,9,0,4,1,11,1,11,0,4,1,13,1,13,0,6,1,15,
+1,15,0,4,1,17,1,20,0,6,1,23,1,23,0,6,1,24,1,24,0,3,1,27,1,27,0,6,1,29,1,29,
+0,6,1,31,1,32,0,6,1,34,1,34,0,6,1,63,1,63,0,3,1,77,1,77,0,2,1,119,1,119,0,
+2,2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,0,108,0,3,0,1,0,2,
+0,3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,3,0,1,0,2,0,5,0,0,0,77,0,3,0,1,0,
+2,0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,75,0,4,0,1,0,2,0,7,0,4,0,0,0,76,
+0,4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,0,7,0,6,0,0,0,78,0,5,0,0,0,1,0,8,
+0,2,0,24,0,30,0,8,0,0,1,174,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,66,
+0,25,0,25,0,5,0,27,0,28,0,6,0,35,0,36,0,4,0,38,0,38,0,4,0,40,0,40,0,6,0,42,
+0,42,0,4,0,44,0,48,0,6,0,51,0,51,0,6,0,52,0,53,0,3,0,57,0,57,0,6,0,59,0,59,
+0,6,0,61,0,61,0,5,0,92,0,92,0,5,0,94,0,94,0,6,0,97,0,97,0,4,0,98,0,99,0,6,
+0,124,0,124,0,6,0,126,0,127,0,6,0,131,0,131,0,6,0,134,0,134,0,7,0,156,0,156,
+0,6,0,162,0,163,0,4,0,165,0,165,0,6,0,167,0,167,0,4,0,169,0,170,0,6,0,174,
+0,174,0,6,0,176,0,176,0,6,0,178,0,178,0,5,0,209,0,209,0,2,0,254,0,254,0,5,
+1,0,1,1,0,6,1,8,1,9,0,4,1,11,1,11,0,4,1,13,1,13,0,6,1,15,1,15,0,4,1,17,1,
+20,0,6,1,23,1,23,0,6,1,24,1,24,0,3,1,27,1,27,0,6,1,29,1,29,0,6,1,31,1,32,
+0,6,1,34,1,34,0,6,1,37,1,37,0,5,1,39,1,40,0,6,1,47,1,48,0,4,1,50,1,50,0,4,
+1,52,1,52,0,6,1,54,1,54,0,4,1,56,1,59,0,6,1,62,1,62,0,6,1,63,1,63,0,3,1,66,
+1,66,0,6,1,68,1,68,0,6,1,70,1,70,0,6,1,102,1,102,0,2,1,233,1,233,0,4,1,235,
+1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,4,1,249,1,249,0,4,1,250,1,250,0,6,
+1,252,1,252,0,6,1,255,1,255,0,4,2,4,2,4,0,6,2,12,2,13,0,6,2,46,2,46,0,1,0,
+8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,0,108,0,3,0,1,0,2,0,3,0,0,0,75,0,3,0,
+1,0,2,0,4,0,0,0,76,0,3,0,1,0,2,0,5,0,0,0,77,0,3,0,1,0,2,0,6,0,0,0,78,0,4,
+0,1,0,2,0,7,0,3,0,0,0,75,0,4,0,1,0,2,0,7,0,4,0,0,0,76,0,4,0,1,0,2,0,7,0,5,
+0,0,0,77,0,4,0,1,0,2,0,7,0,6,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,
+0,1,192,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,69,0,25,0,25,0,6,0,27,
+0,27,0,6,0,35,0,36,0,4,0,38,0,38,0,4,0,40,0,40,0,5,0,42,0,42,0,3,0,44,0,47,
+0,6,0,48,0,48,0,5,0,50,0,50,0,6,0,51,0,51,0,5,0,52,0,53,0,3,0,57,0,57,0,5,
+0,59,0,59,0,6,0,61,0,61,0,5,0,92,0,92,0,6,0,94,0,94,0,6,0,97,0,97,0,4,0,98,
+0,99,0,6,0,124,0,124,0,6,0,126,0,127,0,6,0,131,0,131,0,6,0,134,0,134,0,7,
+0,162,0,163,0,4,0,165,0,165,0,6,0,167,0,167,0,4,0,169,0,170,0,6,0,174,0,174,
+0,6,0,176,0,176,0,6,0,178,0,178,0,5,0,205,0,205,0,2,0,243,0,243,0,2,0,254,
+0,254,0,6,1,0,1,0,0,6,1,8,1,9,0,4,1,11,1,11,0,4,1,13,1,13,0,6,1,15,1,15,0,
+4,1,17,1,20,0,6,1,23,1,23,0,6,1,24,1,24,0,3,1,27,1,27,0,6,1,29,1,29,0,6,1,
+31,1,32,0,6,1,34,1,34,0,6,1,37,1,37,0,6,1,39,1,39,0,6,1,47,1,48,0,4,1,50,
+1,50,0,4,1,52,1,52,0,6,1,54,1,54,0,4,1,56,1,59,0,6,1,62,1,62,0,6,1,63,1,63,
+0,3,1,66,1,66,0,6,1,68,1,68,0,6,1,70,1,70,0,6,1,98,1,98,0,2,1,136,1,136,0,
+2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,4,1,249,1,
+249,0,4,1,250,1,250,0,6,1,252,1,252,0,6,1,255,1,255,0,4,2,4,2,4,0,6,2,12,
+2,13,0,6,2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,0,108,0,3,0,
+1,0,2,0,3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,3,0,1,0,2,0,5,0,0,0,77,0,3,
+0,1,0,2,0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,75,0,4,0,1,0,2,0,7,0,4,0,0,
+0,76,0,4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,0,7,0,6,0,0,0,78,0,5,0,0,0,
+1,0,8,0,2,0,24,0,30,0,8,0,0,1,150,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,
+2,0,62,0,25,0,25,0,6,0,27,0,27,0,6,0,35,0,36,0,4,0,38,0,38,0,4,0,40,0,40,
+0,6,0,42,0,42,0,4,0,44,0,48,0,6,0,52,0,53,0,3,0,57,0,57,0,6,0,59,0,59,0,6,
+0,61,0,61,0,6,0,92,0,92,0,6,0,94,0,94,0,6,0,97,0,97,0,4,0,98,0,98,0,6,0,124,
+0,124,0,6,0,127,0,127,0,6,0,131,0,131,0,6,0,134,0,134,0,7,0,162,0,163,0,4,
+0,165,0,165,0,6,0,167,0,167,0,4,0,169,0,170,0,6,0,174,0,174,0,6,0,176,0,176,
+0,6,0,178,0,178,0,6,0,213,0,213,0,2,0,250,0,250,0,2,0,254,0,254,0,6,1,0,1,
+0,0,6,1,8,1,9,0,4,1,11,1,11,0,4,1,13,1,13,0,6,1,15,1,15,0,4,1,17,1,20,0,6,
+1,24,1,24,0,3,1,27,1,27,0,6,1,29,1,29,0,6,1,31,1,32,0,6,1,37,1,37,0,6,1,39,
+1,39,0,6,1,47,1,48,0,4,1,50,1,50,0,4,1,52,1,52,0,6,1,54,1,54,0,4,1,56,1,59,
+0,6,1,63,1,63,0,3,1,66,1,66,0,6,1,68,1,68,0,6,1,70,1,70,0,6,1,233,1,233,0,
+4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,4,1,249,1,249,0,4,1,250,1,
+250,0,6,1,252,1,252,0,6,1,255,1,255,0,5,2,4,2,4,0,6,2,28,2,28,0,2,2,30,2,
+30,0,2,2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,0,108,0,3,0,1,
+0,2,0,3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,3,0,1,0,2,0,5,0,0,0,77,0,3,0,
+1,0,2,0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,75,0,4,0,1,0,2,0,7,0,4,0,0,0,
+76,0,4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,0,7,0,6,0,0,0,78,0,5,0,0,0,1,
+0,8,0,2,0,24,0,30,0,8,0,0,1,102,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,
+0,54,0,25,0,25,0,6,0,27,0,27,0,6,0,35,0,36,0,4,0,38,0,38,0,5,0,40,0,40,0,
+6,0,42,0,42,0,4,0,44,0,48,0,6,0,52,0,53,0,3,0,57,0,57,0,6,0,61,0,61,0,6,0,
+92,0,92,0,6,0,94,0,94,0,6,0,97,0,97,0,5,0,98,0,98,0,6,0,124,0,124,0,6,0,127,
+0,127,0,6,0,131,0,131,0,6,0,134,0,134,0,7,0,162,0,163,0,4,0,165,0,165,0,6,
+0,167,0,167,0,4,0,169,0,170,0,6,0,174,0,174,0,6,0,178,0,178,0,6,0,220,0,220,
+0,2,0,254,0,254,0,6,1,0,1,0,0,6,1,8,1,9,0,4,1,11,1,11,0,5,1,13,1,13,0,6,1,
+15,1,15,0,4,1,17,1,20,0,6,1,24,1,24,0,3,1,27,1,27,0,6,1,31,1,32,0,6,1,37,
+1,37,0,6,1,39,1,39,0,6,1,47,1,48,0,4,1,50,1,50,0,5,1,52,1,52,0,6,1,54,1,54,
+0,4,1,56,1,59,0,6,1,63,1,63,0,3,1,66,1,66,0,6,1,70,1,70,0,6,1,233,1,233,0,
+4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,5,1,249,1,249,0,4,1,252,1,
+252,0,6,1,255,1,255,0,5,2,4,2,4,0,6,2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,
+0,66,0,80,0,94,0,108,0,3,0,1,0,2,0,3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,
+3,0,1,0,2,0,5,0,0,0,77,0,3,0,1,0,2,0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,
+75,0,4,0,1,0,2,0,7,0,4,0,0,0,76,0,4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,
+0,7,0,6,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,1,90,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,0,1,2,46,0,2,0,52,0,25,0,25,0,6,0,27,0,27,0,6,0,35,0,36,0,4,
+0,38,0,38,0,5,0,42,0,42,0,5,0,44,0,45,0,6,0,47,0,47,0,6,0,52,0,53,0,3,0,57,
+0,57,0,6,0,61,0,61,0,6,0,92,0,92,0,6,0,94,0,94,0,6,0,97,0,97,0,5,0,98,0,98,
+0,6,0,124,0,124,0,6,0,127,0,127,0,6,0,134,0,134,0,7,0,162,0,163,0,4,0,167,
+0,167,0,5,0,174,0,174,0,6,0,178,0,178,0,6,0,254,0,254,0,6,1,0,1,0,0,6,1,8,
+1,9,0,4,1,11,1,11,0,5,1,13,1,13,0,6,1,15,1,15,0,5,1,17,1,17,0,6,1,19,1,19,
+0,6,1,24,1,24,0,3,1,27,1,27,0,6,1,31,1,32,0,6,1,37,1,37,0,6,1,39,1,39,0,6,
+1,47,1,48,0,4,1,50,1,50,0,5,1,52,1,52,0,6,1,54,1,54,0,5,1,56,1,56,0,6,1,58,
+1,58,0,6,1,63,1,63,0,3,1,66,1,66,0,6,1,70,1,70,0,6,1,100,1,100,0,2,1,138,
+1,138,0,2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,5,
+1,249,1,249,0,5,1,255,1,255,0,5,2,46,2,46,0,1,0,8,0,18,0,30,0,42,0,54,0,66,
+0,80,0,94,0,108,0,3,0,1,0,2,0,3,0,0,0,75,0,3,0,1,0,2,0,4,0,0,0,76,0,3,0,1,
+0,2,0,5,0,0,0,77,0,3,0,1,0,2,0,6,0,0,0,78,0,4,0,1,0,2,0,7,0,3,0,0,0,75,0,
+4,0,1,0,2,0,7,0,4,0,0,0,76,0,4,0,1,0,2,0,7,0,5,0,0,0,77,0,4,0,1,0,2,0,7,0,
+6,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,0,254,0,0,0,0,0,0,0,0,0,
+0,0,1,0,1,2,46,0,2,0,37,0,25,0,25,0,5,0,35,0,36,0,4,0,38,0,38,0,4,0,42,0,
+42,0,4,0,47,0,47,0,5,0,52,0,53,0,3,0,61,0,61,0,5,0,92,0,92,0,5,0,97,0,97,
+0,4,0,98,0,98,0,5,0,134,0,134,0,6,0,162,0,163,0,4,0,167,0,167,0,4,0,178,0,
+178,0,5,0,206,0,206,0,2,0,244,0,244,0,2,0,254,0,254,0,5,1,8,1,9,0,4,1,11,
+1,11,0,4,1,13,1,13,0,5,1,15,1,15,0,4,1,19,1,19,0,5,1,24,1,24,0,3,1,37,1,37,
+0,5,1,47,1,48,0,4,1,50,1,50,0,4,1,52,1,52,0,5,1,54,1,54,0,4,1,58,1,58,0,5,
+1,63,1,63,0,3,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,
+0,4,1,249,1,249,0,4,1,255,1,255,0,4,2,46,2,46,0,1,0,6,0,14,0,26,0,38,0,50,
+0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,76,0,3,0,1,0,2,0,4,0,0,0,77,0,3,0,1,0,2,0,
+5,0,0,0,78,0,4,0,1,0,2,0,6,0,3,0,0,0,76,0,4,0,1,0,2,0,6,0,4,0,0,0,77,0,4,
+0,1,0,2,0,6,0,5,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,0,200,0,0,
+0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,28,0,35,0,36,0,4,0,38,0,38,0,4,0,42,0,
+42,0,4,0,52,0,53,0,3,0,57,0,57,0,5,0,61,0,61,0,5,0,97,0,97,0,4,0,134,0,134,
+0,6,0,162,0,163,0,4,0,167,0,167,0,4,0,178,0,178,0,5,0,219,0,219,0,2,1,8,1,
+9,0,4,1,11,1,11,0,4,1,15,1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,50,1,50,0,
+4,1,54,1,54,0,4,1,63,1,63,0,3,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,
+0,4,1,244,1,244,0,4,1,249,1,249,0,4,1,255,1,255,0,5,2,46,2,46,0,1,2,143,2,
+143,0,2,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,76,0,3,0,
+1,0,2,0,4,0,0,0,77,0,3,0,1,0,2,0,5,0,0,0,78,0,4,0,1,0,2,0,6,0,3,0,0,0,76,
+0,4,0,1,0,2,0,6,0,4,0,0,0,77,0,4,0,1,0,2,0,6,0,5,0,0,0,78,0,5,0,0,0,1,0,8,
+0,2,0,22,0,28,0,7,0,0,0,182,0,0,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,25,0,35,
+0,36,0,4,0,38,0,38,0,4,0,42,0,42,0,4,0,52,0,53,0,3,0,97,0,97,0,4,0,134,0,
+134,0,6,0,162,0,163,0,4,0,167,0,167,0,4,0,197,0,197,0,2,0,235,0,235,0,2,1,
+8,1,9,0,4,1,11,1,11,0,4,1,15,1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,50,1,
+50,0,4,1,54,1,54,0,4,1,63,1,63,0,3,1,233,1,233,0,4,1,235,1,235,0,4,1,238,
+1,238,0,4,1,244,1,244,0,4,1,249,1,249,0,4,1,255,1,255,0,5,2,46,2,46,0,1,0,
+6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,76,0,3,0,1,0,2,0,4,
+0,0,0,77,0,3,0,1,0,2,0,5,0,0,0,78,0,4,0,1,0,2,0,6,0,3,0,0,0,76,0,4,0,1,0,
+2,0,6,0,4,0,0,0,77,0,4,0,1,0,2,0,6,0,5,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,20,
+0,26,0,6,0,0,0,180,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,25,0,35,0,36,0,4,0,
+38,0,38,0,4,0,42,0,42,0,4,0,52,0,53,0,3,0,57,0,57,0,4,0,97,0,97,0,4,0,134,
+0,134,0,5,0,162,0,163,0,4,0,167,0,167,0,4,1,8,1,9,0,4,1,11,1,11,0,4,1,15,
+1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,50,1,50,0,4,1,54,1,54,0,4,1,63,1,63,
+0,3,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,4,1,247,
+1,247,0,2,1,249,1,249,0,4,1,255,1,255,0,4,2,46,2,46,0,1,0,4,0,10,0,22,0,34,
+0,48,0,3,0,1,0,2,0,3,0,0,0,77,0,3,0,1,0,2,0,4,0,0,0,78,0,4,0,1,0,2,0,5,0,
+3,0,0,0,77,0,4,0,1,0,2,0,5,0,4,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,
+0,0,0,180,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,25,0,35,0,36,0,4,0,38,0,38,0,
+4,0,42,0,42,0,4,0,52,0,53,0,3,0,97,0,97,0,4,0,134,0,134,0,5,0,162,0,163,0,
+4,0,167,0,167,0,4,0,191,0,191,0,2,0,229,0,229,0,2,1,8,1,9,0,4,1,11,1,11,0,
+4,1,15,1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,50,1,50,0,4,1,54,1,54,0,4,1,
+63,1,63,0,3,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,
+4,1,249,1,249,0,4,1,255,1,255,0,4,2,46,2,46,0,1,0,4,0,10,0,22,0,34,0,48,0,
+3,0,1,0,2,0,3,0,0,0,77,0,3,0,1,0,2,0,4,0,0,0,78,0,4,0,1,0,2,0,5,0,3,0,0,0,
+77,0,4,0,1,0,2,0,5,0,4,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,0,180,
+0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,25,0,35,0,36,0,4,0,38,0,38,0,4,0,42,0,
+42,0,4,0,52,0,53,0,3,0,97,0,97,0,4,0,134,0,134,0,5,0,162,0,163,0,4,0,167,
+0,167,0,4,0,216,0,216,0,2,0,253,0,253,0,2,1,8,1,9,0,4,1,11,1,11,0,4,1,15,
+1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,50,1,50,0,4,1,54,1,54,0,4,1,63,1,63,
+0,3,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,4,1,249,
+1,249,0,4,1,255,1,255,0,4,2,46,2,46,0,1,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,
+2,0,3,0,0,0,77,0,3,0,1,0,2,0,4,0,0,0,78,0,4,0,1,0,2,0,5,0,3,0,0,0,77,0,4,
+0,1,0,2,0,5,0,4,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,0,174,0,0,
+0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,24,0,35,0,36,0,4,0,38,0,38,0,4,0,42,0,42,0,
+4,0,52,0,53,0,3,0,97,0,97,0,4,0,134,0,134,0,5,0,162,0,163,0,4,0,167,0,167,
+0,4,1,8,1,9,0,4,1,11,1,11,0,4,1,15,1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,
+50,1,50,0,4,1,54,1,54,0,4,1,63,1,63,0,3,1,233,1,233,0,4,1,235,1,235,0,4,1,
+238,1,238,0,4,1,244,1,244,0,4,1,249,1,249,0,4,1,255,1,255,0,4,2,2,2,2,0,2,
+2,46,2,46,0,1,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,77,0,3,0,1,0,
+2,0,4,0,0,0,78,0,4,0,1,0,2,0,5,0,3,0,0,0,77,0,4,0,1,0,2,0,5,0,4,0,0,0,78,
+0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,0,180,0,0,0,0,0,0,0,0,0,1,0,1,2,46,
+0,2,0,25,0,35,0,36,0,4,0,38,0,38,0,4,0,42,0,42,0,4,0,52,0,53,0,3,0,97,0,97,
+0,4,0,134,0,134,0,5,0,162,0,163,0,4,0,167,0,167,0,4,1,8,1,9,0,4,1,11,1,11,
+0,4,1,15,1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,50,1,50,0,4,1,54,1,54,0,4,
+1,63,1,63,0,3,1,90,1,90,0,2,1,128,1,128,0,2,1,233,1,233,0,4,1,235,1,235,0,
+4,1,238,1,238,0,4,1,244,1,244,0,4,1,249,1,249,0,4,1,255,1,255,0,4,2,46,2,
+46,0,1,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,77,0,3,0,1,0,2,0,4,0,
+0,0,78,0,4,0,1,0,2,0,5,0,3,0,0,0,77,0,4,0,1,0,2,0,5,0,4,0,0,0,78,0,5,0,0,
+0,1,0,8,0,2,0,20,0,26,0,6,0,0,0,198,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,28,
+0,35,0,36,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,52,0,53,0,3,0,61,0,61,0,4,0,97,
+0,97,0,4,0,134,0,134,0,5,0,162,0,163,0,4,0,167,0,167,0,4,0,210,0,210,0,2,
+0,247,0,247,0,2,1,8,1,9,0,4,1,11,1,11,0,4,1,15,1,15,0,4,1,24,1,24,0,3,1,47,
+1,48,0,4,1,50,1,50,0,4,1,54,1,54,0,4,1,63,1,63,0,3,1,103,1,103,0,2,1,140,
+1,140,0,2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,1,244,1,244,0,4,
+1,249,1,249,0,4,1,255,1,255,0,4,2,46,2,46,0,1,0,4,0,10,0,22,0,34,0,48,0,3,
+0,1,0,2,0,3,0,0,0,77,0,3,0,1,0,2,0,4,0,0,0,78,0,4,0,1,0,2,0,5,0,3,0,0,0,77,
+0,4,0,1,0,2,0,5,0,4,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,0,186,
+0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,26,0,35,0,36,0,4,0,38,0,38,0,4,0,42,0,
+42,0,4,0,52,0,53,0,3,0,97,0,97,0,4,0,134,0,134,0,5,0,162,0,163,0,4,0,167,
+0,167,0,4,0,193,0,193,0,2,0,231,0,231,0,2,1,8,1,9,0,4,1,11,1,11,0,4,1,15,
+1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,50,1,50,0,4,1,54,1,54,0,4,1,63,1,63,
+0,3,1,82,1,82,0,2,1,124,1,124,0,2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,
+238,0,4,1,244,1,244,0,4,1,249,1,249,0,4,2,46,2,46,0,1,0,4,0,10,0,22,0,34,
+0,48,0,3,0,1,0,2,0,3,0,0,0,77,0,3,0,1,0,2,0,4,0,0,0,78,0,4,0,1,0,2,0,5,0,
+3,0,0,0,77,0,4,0,1,0,2,0,5,0,4,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,
+0,0,0,150,0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,20,0,35,0,36,0,4,0,42,0,42,0,
+4,0,52,0,53,0,3,0,134,0,134,0,5,0,162,0,163,0,4,0,167,0,167,0,4,0,200,0,200,
+0,2,0,238,0,238,0,2,1,8,1,9,0,4,1,15,1,15,0,4,1,24,1,24,0,3,1,47,1,48,0,4,
+1,54,1,54,0,4,1,63,1,63,0,3,1,93,1,93,0,2,1,131,1,131,0,2,1,233,1,233,0,4,
+1,235,1,235,0,4,1,238,1,238,0,4,2,46,2,46,0,1,0,4,0,10,0,22,0,34,0,48,0,3,
+0,1,0,2,0,3,0,0,0,77,0,3,0,1,0,2,0,4,0,0,0,78,0,4,0,1,0,2,0,5,0,3,0,0,0,77,
+0,4,0,1,0,2,0,5,0,4,0,0,0,78,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,0,114,
+0,0,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,14,0,35,0,36,0,4,0,52,0,53,0,3,0,134,0,
+134,0,5,0,162,0,163,0,4,1,8,1,9,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,63,1,63,
+0,3,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,2,7,2,7,0,2,2,9,2,9,0,
+2,2,46,2,46,0,1,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,77,0,3,0,1,
+0,2,0,4,0,0,0,78,0,4,0,1,0,2,0,5,0,3,0,0,0,77,0,4,0,1,0,2,0,5,0,4,0,0,0,78,
+0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,0,114,0,0,0,0,0,0,0,0,0,1,0,1,2,46,
+0,2,0,14,0,35,0,36,0,4,0,52,0,53,0,3,0,134,0,134,0,5,0,162,0,163,0,4,1,8,
+1,9,0,4,1,24,1,24,0,3,1,47,1,48,0,4,1,63,1,63,0,3,1,106,1,106,0,2,1,143,1,
+143,0,2,1,233,1,233,0,4,1,235,1,235,0,4,1,238,1,238,0,4,2,46,2,46,0,1,0,4,
+0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,77,0,3,0,1,0,2,0,4,0,0,0,78,0,4,
+0,1,0,2,0,5,0,3,0,0,0,77,0,4,0,1,0,2,0,5,0,4,0,0,0,78,0,5,0,0,0,1,0,8,0,2,
+0,18,0,24,0,5,0,0,0,124,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,16,0,52,0,53,0,3,0,
+134,0,134,0,4,0,192,0,192,0,2,0,196,0,196,0,2,0,230,0,230,0,2,0,234,0,234,
+0,2,1,24,1,24,0,3,1,63,1,63,0,3,1,88,1,88,0,2,1,99,1,99,0,2,1,108,1,109,0,
+2,1,113,1,113,0,2,1,127,1,127,0,2,1,137,1,137,0,2,1,145,1,146,0,2,2,46,2,
+46,0,1,0,2,0,6,0,18,0,3,0,1,0,2,0,3,0,0,0,78,0,4,0,1,0,2,0,4,0,3,0,0,0,78,
+0,5,0,0,0,1,0,8,0,2,0,18,0,24,0,5,0,0,0,88,0,0,0,0,0,0,0,1,0,1,2,46,0,2,0,
+10,0,35,0,35,0,3,0,42,0,42,0,3,0,52,0,53,0,3,0,134,0,134,0,4,0,190,0,190,
+0,2,0,217,0,217,0,2,0,228,0,228,0,2,1,24,1,24,0,3,1,63,1,63,0,3,2,46,2,46,
+0,1,0,2,0,6,0,18,0,3,0,1,0,2,0,3,0,0,0,78,0,4,0,1,0,2,0,4,0,3,0,0,0,78,0,
+5,0,0,0,1,0,8,0,2,0,30,0,36,0,11,0,0,3,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,0,1,2,46,0,2,0,150,0,25,0,25,0,4,0,26,0,26,0,9,0,27,0,27,0,4,0,
+28,0,31,0,5,0,32,0,34,0,8,0,35,0,36,0,3,0,37,0,37,0,5,0,38,0,38,0,3,0,39,
+0,39,0,7,0,40,0,40,0,4,0,41,0,41,0,6,0,42,0,42,0,3,0,43,0,43,0,5,0,44,0,48,
+0,4,0,49,0,49,0,7,0,50,0,50,0,5,0,51,0,51,0,4,0,52,0,53,0,2,0,54,0,56,0,6,
+0,57,0,57,0,4,0,58,0,58,0,6,0,59,0,59,0,4,0,60,0,60,0,6,0,61,0,61,0,4,0,92,
+0,92,0,4,0,93,0,93,0,9,0,94,0,94,0,4,0,95,0,95,0,8,0,96,0,96,0,5,0,97,0,97,
+0,3,0,98,0,99,0,4,0,124,0,124,0,4,0,125,0,125,0,8,0,126,0,127,0,4,0,128,0,
+128,0,7,0,130,0,130,0,5,0,131,0,131,0,4,0,156,0,159,0,5,0,160,0,161,0,8,0,
+162,0,163,0,3,0,164,0,164,0,7,0,165,0,165,0,4,0,166,0,166,0,6,0,167,0,167,
+0,3,0,168,0,168,0,5,0,169,0,170,0,4,0,171,0,171,0,7,0,172,0,172,0,5,0,173,
+0,173,0,6,0,174,0,174,0,4,0,175,0,175,0,6,0,176,0,176,0,4,0,177,0,177,0,6,
+0,178,0,178,0,4,0,179,0,179,0,7,0,180,0,180,0,6,0,254,0,254,0,4,0,255,0,255,
+0,9,1,0,1,0,0,4,1,1,1,4,0,5,1,5,1,5,0,8,1,6,1,6,0,9,1,7,1,7,0,8,1,8,1,9,0,
+3,1,10,1,10,0,5,1,11,1,11,0,3,1,12,1,12,0,7,1,13,1,13,0,4,1,14,1,14,0,6,1,
+15,1,15,0,3,1,16,1,16,0,5,1,17,1,20,0,4,1,21,1,21,0,7,1,22,1,22,0,5,1,23,
+1,23,0,4,1,24,1,24,0,2,1,25,1,25,0,7,1,26,1,26,0,6,1,27,1,27,0,4,1,28,1,28,
+0,7,1,29,1,29,0,4,1,30,1,30,0,7,1,31,1,32,0,4,1,33,1,33,0,8,1,34,1,34,0,4,
+1,35,1,35,0,8,1,36,1,36,0,7,1,37,1,37,0,4,1,38,1,38,0,9,1,39,1,39,0,4,1,40,
+1,43,0,5,1,44,1,44,0,8,1,45,1,45,0,9,1,46,1,46,0,8,1,47,1,48,0,3,1,49,1,49,
+0,5,1,50,1,50,0,3,1,51,1,51,0,7,1,52,1,52,0,4,1,53,1,53,0,6,1,54,1,54,0,3,
+1,55,1,55,0,5,1,56,1,59,0,4,1,60,1,60,0,7,1,61,1,61,0,5,1,62,1,62,0,4,1,63,
+1,63,0,2,1,64,1,64,0,7,1,65,1,65,0,6,1,66,1,66,0,4,1,67,1,67,0,7,1,68,1,68,
+0,4,1,69,1,69,0,7,1,70,1,70,0,4,1,227,1,227,0,6,1,228,1,229,0,5,1,233,1,233,
+0,3,1,235,1,235,0,3,1,238,1,238,0,3,1,240,1,241,0,5,1,244,1,244,0,3,1,246,
+1,246,0,6,1,248,1,248,0,6,1,249,1,249,0,3,1,250,1,250,0,4,1,251,1,251,0,8,
+1,252,1,252,0,4,1,253,1,253,0,8,1,255,1,255,0,3,2,0,2,0,0,7,2,1,2,1,0,6,2,
+3,2,3,0,5,2,4,2,4,0,4,2,5,2,5,0,10,2,6,2,6,0,7,2,8,2,8,0,7,2,11,2,11,0,7,
+2,12,2,13,0,4,2,14,2,15,0,5,2,16,2,16,0,7,2,17,2,17,0,5,2,18,2,18,0,9,2,19,
+2,19,0,8,2,20,2,21,0,7,2,22,2,25,0,6,2,27,2,27,0,6,2,29,2,29,0,6,2,35,2,36,
+0,7,2,39,2,40,0,7,2,46,2,46,0,1,0,9,0,20,0,30,0,40,0,50,0,60,0,70,0,80,0,
+90,0,100,0,2,0,1,0,2,0,0,0,68,0,2,0,1,0,3,0,0,0,69,0,2,0,1,0,4,0,0,0,70,0,
+2,0,1,0,5,0,0,0,71,0,2,0,1,0,6,0,0,0,72,0,2,0,1,0,7,0,0,0,73,0,2,0,1,0,8,
+0,0,0,74,0,2,0,1,0,9,0,0,0,75,0,2,0,1,0,10,0,0,0,77,0,1,0,0,0,1,0,8,0,1,0,
+6,0,1,0,1,0,1,2,46,0,1,0,0,0,1,0,8,0,1,0,6,0,2,0,1,0,1,2,46,0,1,0,0,0,1,0,
+8,0,1,0,6,0,3,0,1,0,1,2,46,0,1,0,0,0,1,0,8,0,1,0,6,0,4,0,1,0,1,2,46,0,1,0,
+0,0,1,0,8,0,1,0,6,0,5,0,1,0,1,2,46,0,1,0,0,0,1,0,8,0,1,0,6,0,6,0,1,0,1,2,
+46,0,1,0,0,0,1,0,8,0,1,0,6,0,7,0,1,0,1,2,46,0,1,0,0,0,1,0,8,0,1,0,6,0,8,0,
+1,0,1,2,46,0,1,0,0,0,1,0,8,0,1,0,6,0,9,0,1,0,1,2,46,0,1,0,0,0,1,0,8,0,1,0,
+6,0,10,0,1,0,1,2,46,0,1,0,0,0,1,0,8,0,1,0,6,0,11,0,1,0,1,2,46,0,5,0,0,0,1,
+0,8,0,2,0,22,0,32,0,7,0,0,0,192,0,0,0,0,0,0,0,0,0,0,0,2,0,1,2,46,2,57,0,0,
+0,2,0,26,0,6,0,6,0,3,0,25,0,61,0,2,0,92,0,99,0,2,0,124,0,126,0,2,0,156,0,
+180,0,2,0,181,0,181,0,4,0,254,1,70,0,2,1,203,1,203,0,5,1,227,1,229,0,2,1,
+233,1,233,0,2,1,235,1,235,0,2,1,237,1,238,0,2,1,240,1,241,0,2,1,244,1,244,
+0,2,1,246,1,246,0,2,1,248,1,253,0,2,1,255,2,1,0,2,2,3,2,6,0,2,2,8,2,8,0,2,
+2,11,2,25,0,2,2,27,2,27,0,2,2,29,2,29,0,2,2,35,2,36,0,2,2,39,2,40,0,2,2,46,
+2,57,0,1,2,175,2,175,0,6,0,4,0,10,0,26,0,42,0,58,0,3,0,2,0,2,0,3,0,0,0,81,
+0,2,0,80,0,3,0,2,0,2,0,4,0,0,0,82,0,2,0,80,0,3,0,2,0,2,0,5,0,0,0,83,0,2,0,
+80,0,3,0,2,0,2,0,6,0,0,0,84,0,2,0,80,0,1,0,0,0,1,0,8,0,2,0,14,0,4,2,94,2,
+94,2,94,2,94,0,1,0,4,0,6,0,181,1,203,2,175,0,1,0,0,0,1,0,8,0,1,0,6,0,12,0,
+2,0,1,2,46,2,57,0,0,0,1,0,0,0,1,0,8,0,1,0,6,0,24,0,2,0,1,2,46,2,57,0,0,0,
+1,0,0,0,1,0,8,0,1,0,6,0,36,0,2,0,1,2,46,2,57,0,0,0,1,0,0,0,1,0,8,0,1,0,6,
+0,156,0,2,0,1,2,46,2,57,0,0,0,6,0,0,0,1,0,8,0,2,0,16,0,22,1,112,1,120,0,2,
+0,0,1,128,0,1,0,1,0,5,0,2,0,57,0,25,0,25,0,2,0,27,0,27,0,2,0,35,0,36,0,2,
+0,38,0,38,0,2,0,40,0,40,0,2,0,42,0,42,0,2,0,44,0,48,0,2,0,51,0,53,0,2,0,57,
+0,57,0,2,0,59,0,59,0,2,0,61,0,61,0,2,0,92,0,92,0,2,0,94,0,94,0,2,0,97,0,99,
+0,2,0,124,0,124,0,2,0,126,0,127,0,2,0,131,0,131,0,2,0,162,0,163,0,2,0,165,
+0,165,0,2,0,167,0,167,0,2,0,169,0,170,0,2,0,174,0,174,0,2,0,176,0,176,0,2,
+0,178,0,178,0,2,0,254,0,254,0,2,1,0,1,0,0,2,1,8,1,9,0,2,1,11,1,11,0,2,1,13,
+1,13,0,2,1,15,1,15,0,2,1,17,1,20,0,2,1,23,1,24,0,2,1,27,1,27,0,2,1,29,1,29,
+0,2,1,31,1,32,0,2,1,34,1,34,0,2,1,37,1,37,0,2,1,39,1,39,0,2,1,47,1,48,0,2,
+1,50,1,50,0,2,1,52,1,52,0,2,1,54,1,54,0,2,1,56,1,59,0,2,1,62,1,63,0,2,1,66,
+1,66,0,2,1,68,1,68,0,2,1,70,1,70,0,2,1,233,1,233,0,2,1,235,1,235,0,2,1,238,
+1,238,0,2,1,244,1,244,0,2,1,249,1,250,0,2,1,252,1,252,0,2,1,255,1,255,0,2,
+2,4,2,4,0,2,2,12,2,13,0,2,2,47,2,50,0,1,0,1,0,5,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,4,0,2,0,2,0,1,0,1,0,0,0,1,0,0,0,86,0,1,0,0,0,1,0,8,0,1,0,6,2,169,0,1,
+0,1,0,5,0,5,2,0,0,1,0,8,0,2,0,16,0,24,0,4,0,0,0,76,0,0,0,0,0,1,0,2,1,251,
+1,255,0,2,0,8,0,69,0,71,0,2,0,81,0,81,0,2,0,86,0,86,0,3,1,251,1,251,0,1,1,
+255,1,255,0,1,3,61,3,65,0,3,3,68,3,71,0,3,3,85,3,85,0,3,0,1,0,4,0,3,0,1,0,
+2,0,3,0,0,0,88,0,1,0,0,0,1,0,8,0,2,0,10,0,2,2,173,2,172,0,1,0,2,1,251,1,255,
+0,5,2,0,0,1,0,8,0,2,0,28,0,126,0,10,0,0,1,78,1,116,1,144,1,182,0,0,0,0,0,
+0,0,0,0,0,0,1,0,47,0,127,0,128,0,130,0,131,1,2,1,4,1,8,1,9,1,10,1,11,1,26,
+1,32,1,41,1,43,1,47,1,48,1,49,1,50,1,65,1,228,1,229,1,233,1,235,1,238,1,240,
+1,241,1,244,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,6,2,8,2,13,
+2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,24,2,25,0,2,0,34,0,69,0,71,0,5,0,72,
+0,72,0,6,0,81,0,81,0,8,0,86,0,86,0,9,0,90,0,91,0,5,0,102,0,103,0,6,0,127,
+0,128,0,4,0,130,0,131,0,4,0,182,0,182,0,7,1,2,1,2,0,3,1,4,1,4,0,3,1,8,1,11,
+0,3,1,26,1,26,0,3,1,32,1,32,0,3,1,41,1,41,0,3,1,43,1,43,0,3,1,47,1,50,0,3,
+1,65,1,65,0,3,1,228,1,229,0,2,1,233,1,233,0,1,1,235,1,235,0,1,1,238,1,238,
+0,1,1,240,1,241,0,1,1,244,1,244,0,1,1,248,1,255,0,2,2,6,2,6,0,2,2,8,2,8,0,
+2,2,13,2,13,0,3,2,15,2,15,0,3,2,16,2,21,0,2,2,24,2,25,0,3,3,61,3,65,0,9,3,
+68,3,71,0,9,3,85,3,85,0,9,0,3,0,8,0,18,0,28,0,2,0,1,0,5,0,0,0,94,0,2,0,1,
+0,6,0,0,0,94,0,2,0,1,0,8,0,0,0,94,0,2,0,6,0,18,0,3,0,1,0,5,0,9,0,0,0,94,0,
+2,0,1,0,6,0,0,0,94,0,3,0,8,0,18,0,28,0,2,0,1,0,5,0,0,0,92,0,2,0,1,0,6,0,0,
+0,94,0,2,0,1,0,8,0,0,0,92,0,2,0,6,0,18,0,3,0,1,0,7,0,5,0,1,0,91,0,3,0,1,0,
+7,0,8,0,1,0,91,0,6,0,0,0,1,0,8,0,2,0,18,0,34,0,80,0,102,0,3,0,0,0,110,0,128,
+0,1,0,6,0,69,0,70,0,71,0,81,0,90,0,91,0,2,0,7,0,61,0,61,0,2,1,31,1,31,0,2,
+1,228,1,229,0,1,1,248,1,255,0,1,2,6,2,6,0,1,2,8,2,8,0,1,2,16,2,21,0,1,0,2,
+0,3,0,69,0,71,0,1,0,81,0,81,0,1,0,90,0,91,0,2,0,1,0,1,0,1,0,1,0,1,0,4,0,1,
+0,1,0,1,0,0,0,1,0,0,0,93,0,2,0,6,0,20,0,1,0,1,0,1,0,0,0,1,0,0,0,93,0,1,0,
+2,0,1,0,0,0,1,0,0,0,93,0,1,0,0,0,1,0,8,0,1,0,6,1,168,0,1,0,1,0,182,0,2,0,
+0,0,1,0,8,0,1,0,174,0,19,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,100,
+0,108,0,116,0,124,0,132,0,140,0,148,0,154,0,160,0,166,0,2,0,29,2,94,0,2,0,
+31,2,94,0,2,0,35,2,94,0,2,0,36,2,94,0,2,0,37,2,94,0,2,0,38,2,94,0,2,0,55,
+2,94,0,2,0,124,2,94,0,3,0,29,0,64,2,94,0,3,0,31,0,64,2,94,0,3,0,35,0,64,2,
+94,0,3,0,36,0,64,2,94,0,3,0,37,0,64,2,94,0,3,0,38,0,64,2,94,0,3,0,55,0,64,
+2,94,0,2,2,12,2,94,0,2,2,14,2,94,0,2,2,22,2,94,0,3,2,22,0,64,2,94,0,1,0,19,
+1,2,1,4,1,8,1,9,1,10,1,11,1,26,1,32,1,41,1,43,1,47,1,48,1,49,1,50,1,65,2,
+13,2,15,2,24,2,25,0,1,0,0,0,1,0,8,0,2,0,18,0,6,2,163,2,164,2,165,2,169,2,
+170,2,171,0,1,0,6,0,69,0,70,0,71,0,81,0,90,0,91,0,2,0,0,0,1,0,8,0,1,1,100,
+0,43,0,92,0,98,0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,
+0,164,0,170,0,176,0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,
+236,0,242,0,248,0,254,1,4,1,10,1,18,1,24,1,30,1,36,1,44,1,52,1,58,1,64,1,
+70,1,76,1,82,1,88,1,94,0,2,2,127,0,182,0,2,2,128,0,182,0,2,2,129,0,182,0,
+2,2,130,0,182,0,2,2,131,0,182,0,2,2,132,0,182,0,2,2,133,0,182,0,2,0,124,0,
+182,0,2,2,135,0,182,0,2,2,136,0,182,0,2,2,137,0,182,0,2,2,138,0,182,0,2,2,
+139,0,182,0,2,2,140,0,182,0,2,2,141,0,182,0,2,0,187,0,27,0,2,0,187,0,50,0,
+2,0,193,0,35,0,2,0,193,0,36,0,2,0,194,0,36,0,2,0,195,0,38,0,2,0,195,0,37,
+0,2,0,196,0,38,0,2,0,200,0,28,0,2,0,200,0,27,0,2,0,200,0,48,0,2,0,200,0,49,
+0,2,0,200,0,57,0,2,0,200,0,43,0,3,0,200,0,201,0,51,0,2,0,200,0,42,0,2,2,143,
+0,30,0,2,2,143,0,57,0,3,0,214,2,129,0,182,0,3,0,214,2,130,0,182,0,2,0,216,
+0,39,0,2,0,216,0,44,0,2,0,216,0,50,0,2,0,216,0,51,0,2,0,216,0,54,0,2,0,216,
+0,57,0,2,2,134,0,182,0,2,2,142,0,182,0,1,0,43,1,2,1,4,1,8,1,9,1,10,1,11,1,
+26,1,32,1,41,1,43,1,47,1,48,1,49,1,50,1,65,1,228,1,229,1,233,1,235,1,238,
+1,240,1,241,1,244,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,6,2,8,
+2,13,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,24,2,25,0,5,0,0,0,1,0,8,0,2,0,18,
+0,170,0,5,0,0,1,218,1,232,1,250,0,0,0,1,0,74,0,25,0,29,0,31,0,35,0,36,0,37,
+0,38,0,45,0,47,0,52,0,53,0,56,0,92,0,94,0,95,0,96,0,97,0,98,0,99,0,156,0,
+157,0,158,0,159,0,160,0,161,0,162,0,163,0,164,0,165,0,166,0,167,0,168,0,169,
+0,170,0,171,0,172,0,173,0,174,0,175,0,176,0,254,1,15,1,19,1,37,1,39,1,40,
+1,42,1,44,1,46,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,
+1,64,1,66,1,67,1,68,1,227,2,12,2,14,2,23,2,29,2,35,2,36,2,39,2,40,0,2,0,50,
+0,25,0,25,0,3,0,29,0,29,0,3,0,31,0,31,0,3,0,35,0,38,0,3,0,45,0,45,0,2,0,47,
+0,47,0,3,0,52,0,53,0,3,0,56,0,56,0,1,0,92,0,92,0,2,0,94,0,94,0,2,0,95,0,95,
+0,1,0,96,0,98,0,2,0,99,0,99,0,1,0,102,0,103,0,4,0,156,0,156,0,1,0,157,0,157,
+0,2,0,158,0,158,0,1,0,159,0,159,0,2,0,160,0,161,0,1,0,162,0,163,0,2,0,164,
+0,166,0,1,0,167,0,167,0,2,0,168,0,176,0,1,0,254,0,254,0,3,1,15,1,15,0,3,1,
+19,1,19,0,3,1,37,1,37,0,2,1,39,1,39,0,2,1,40,1,40,0,1,1,42,1,42,0,1,1,44,
+1,44,0,1,1,46,1,46,0,1,1,51,1,53,0,1,1,54,1,54,0,2,1,55,1,55,0,1,1,56,1,56,
+0,2,1,57,1,57,0,1,1,58,1,58,0,2,1,59,1,62,0,1,1,64,1,64,0,1,1,66,1,68,0,1,
+1,227,1,227,0,3,2,12,2,12,0,3,2,14,2,14,0,3,2,23,2,23,0,1,2,29,2,29,0,1,2,
+35,2,35,0,3,2,36,2,36,0,2,2,39,2,39,0,3,2,40,2,40,0,2,0,1,0,4,0,2,0,1,0,4,
+0,0,0,98,0,1,0,4,0,2,0,2,0,4,0,0,0,98,0,1,0,99,0,1,0,4,0,2,0,1,0,4,0,1,0,
+100,0,5,0,0,0,1,0,8,0,2,0,26,0,142,0,9,0,0,1,160,1,174,1,224,1,238,2,20,0,
+0,0,0,0,0,0,1,0,56,0,56,0,92,0,94,0,95,0,96,0,97,0,98,0,99,0,125,0,156,0,
+157,0,158,0,159,0,161,0,162,0,163,0,164,0,165,0,166,0,167,0,168,0,169,0,170,
+0,173,0,174,0,175,0,176,0,255,1,15,1,37,1,38,1,39,1,40,1,42,1,44,1,46,1,51,
+1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,64,1,66,1,67,1,68,
+1,70,2,23,2,29,2,40,0,2,0,45,0,56,0,56,0,3,0,69,0,69,0,6,0,70,0,70,0,7,0,
+71,0,72,0,8,0,90,0,91,0,6,0,92,0,92,0,1,0,94,0,94,0,1,0,95,0,95,0,3,0,96,
+0,97,0,2,0,98,0,99,0,1,0,125,0,125,0,1,0,156,0,156,0,1,0,157,0,157,0,2,0,
+158,0,158,0,1,0,159,0,159,0,2,0,161,0,161,0,1,0,162,0,163,0,2,0,164,0,164,
+0,1,0,165,0,165,0,4,0,166,0,166,0,1,0,167,0,167,0,5,0,168,0,168,0,4,0,169,
+0,170,0,1,0,173,0,173,0,4,0,174,0,174,0,1,0,175,0,175,0,3,0,176,0,176,0,1,
+0,255,0,255,0,1,1,15,1,15,0,1,1,37,1,37,0,4,1,38,1,38,0,1,1,39,1,40,0,4,1,
+42,1,42,0,4,1,44,1,44,0,3,1,46,1,46,0,3,1,51,1,51,0,3,1,52,1,62,0,4,1,64,
+1,64,0,4,1,66,1,66,0,4,1,67,1,67,0,3,1,68,1,68,0,4,1,70,1,70,0,1,2,23,2,23,
+0,4,2,29,2,29,0,1,2,40,2,40,0,4,0,1,0,4,0,2,0,1,0,6,0,1,0,97,0,3,0,8,0,22,
+0,36,0,2,0,2,0,6,0,0,0,98,0,1,0,99,0,2,0,2,0,7,0,0,0,98,0,1,0,99,0,2,0,2,
+0,8,0,0,0,98,0,1,0,99,0,1,0,4,0,2,0,1,0,6,0,0,0,98,0,3,0,8,0,18,0,28,0,2,
+0,1,0,6,0,0,0,98,0,2,0,1,0,7,0,0,0,98,0,2,0,1,0,8,0,0,0,98,0,1,0,4,0,2,0,
+1,0,8,0,0,0,98,0,1,0,0,0,1,0,8,0,1,0,6,2,40,0,1,0,1,0,69,0,2,0,0,0,1,0,8,
+0,1,1,238,0,61,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,
+0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,254,1,
+4,1,10,1,16,1,22,1,28,1,34,1,40,1,46,1,52,1,58,1,64,1,70,1,76,1,82,1,88,1,
+94,1,100,1,106,1,112,1,118,1,124,1,130,1,136,1,142,1,148,1,154,1,160,1,166,
+1,172,1,178,1,184,1,190,1,196,1,202,1,208,1,214,1,220,1,226,1,232,0,2,0,44,
+0,64,0,2,0,55,0,64,0,2,0,25,0,64,0,2,0,27,0,64,0,2,0,32,0,64,0,2,0,37,0,64,
+0,2,0,38,0,64,0,2,0,47,0,64,0,2,0,51,0,64,0,2,0,28,0,64,0,2,0,29,0,64,0,2,
+0,30,0,64,0,2,0,31,0,64,0,2,0,33,0,64,0,2,0,34,0,64,0,2,0,35,0,64,0,2,0,36,
+0,64,0,2,0,39,0,64,0,2,0,40,0,64,0,2,0,41,0,64,0,2,0,42,0,64,0,2,0,43,0,64,
+0,2,0,46,0,64,0,2,0,48,0,64,0,2,0,49,0,64,0,2,0,50,0,64,0,2,0,54,0,64,0,2,
+0,57,0,64,0,2,0,58,0,64,0,2,0,59,0,64,0,2,0,254,0,64,0,2,1,0,0,64,0,2,1,1,
+0,64,0,2,1,3,0,64,0,2,1,5,0,64,0,2,1,6,0,64,0,2,1,7,0,64,0,2,1,12,0,64,0,
+2,1,13,0,64,0,2,1,14,0,64,0,2,1,15,0,64,0,2,1,16,0,64,0,2,1,17,0,64,0,2,1,
+18,0,64,0,2,1,19,0,64,0,2,1,20,0,64,0,2,1,21,0,64,0,2,1,22,0,64,0,2,1,23,
+0,64,0,2,1,25,0,64,0,2,1,26,0,64,0,2,1,27,0,64,0,2,1,28,0,64,0,2,1,29,0,64,
+0,2,1,30,0,64,0,2,1,31,0,64,0,2,2,22,0,64,0,2,2,24,0,64,0,2,2,27,0,64,0,2,
+2,35,0,64,0,2,2,39,0,64,0,2,0,16,0,45,0,45,0,0,0,56,0,56,0,1,0,92,0,92,0,
+2,0,94,0,99,0,3,0,156,0,176,0,9,1,37,1,37,0,30,1,39,1,40,0,31,1,42,1,42,0,
+33,1,44,1,46,0,34,1,51,1,62,0,37,1,64,1,70,0,49,2,23,2,23,0,56,2,25,2,25,
+0,57,2,29,2,29,0,58,2,36,2,36,0,59,2,40,2,40,0,60,0,4,0,0,0,1,0,8,0,1,0,74,
+0,1,0,8,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,2,108,0,2,0,69,2,111,
+0,2,0,70,2,113,0,2,0,71,2,115,0,2,0,72,2,124,0,2,0,90,2,126,0,2,0,91,2,118,
+0,2,0,102,2,121,0,2,0,103,0,1,0,1,0,64,0,1,0,0,0,1,0,8,0,2,0,10,0,2,2,116,
+2,120,0,1,0,2,0,102,0,103,0,4,0,0,0,1,0,8,0,1,1,216,0,10,0,26,0,82,0,100,
+0,118,0,152,1,30,1,56,1,90,1,148,1,166,0,6,0,14,0,22,0,30,0,38,0,44,0,50,
+1,164,0,3,0,64,0,69,1,165,0,3,0,64,0,70,1,166,0,3,0,64,0,71,1,159,0,2,0,69,
+1,160,0,2,0,70,1,161,0,2,0,71,0,2,0,6,0,12,1,157,0,2,0,69,1,158,0,2,0,70,
+0,2,0,6,0,12,1,162,0,2,0,69,1,163,0,2,0,70,0,4,0,10,0,16,0,22,0,28,1,147,
+0,2,0,69,1,148,0,2,0,70,1,149,0,2,0,71,1,150,0,2,0,72,0,15,0,32,0,38,0,44,
+0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,94,0,102,0,110,0,118,0,126,2,107,0,2,
+0,69,2,110,0,2,0,70,2,112,0,2,0,71,2,114,0,2,0,72,2,122,0,2,0,81,2,123,0,
+2,0,90,2,125,0,2,0,91,2,117,0,2,0,102,2,119,0,2,0,103,2,146,0,3,2,94,0,69,
+2,149,0,3,2,94,0,70,2,152,0,3,2,94,0,71,2,158,0,3,2,94,0,81,2,160,0,3,2,94,
+0,90,2,162,0,3,2,94,0,91,0,3,0,8,0,14,0,20,1,164,0,2,0,69,1,165,0,2,0,70,
+1,166,0,2,0,71,0,4,0,10,0,16,0,22,0,28,1,151,0,2,0,69,1,152,0,2,0,70,1,153,
+0,2,0,71,1,154,0,2,0,72,0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,2,144,0,2,
+0,69,2,147,0,2,0,70,2,150,0,2,0,71,2,153,0,2,0,72,2,156,0,2,0,81,2,154,0,
+2,0,102,2,155,0,2,0,103,0,2,0,6,0,12,1,155,0,2,0,69,1,156,0,2,0,70,0,6,0,
+14,0,20,0,26,0,32,0,38,0,44,2,145,0,2,0,69,2,148,0,2,0,70,2,151,0,2,0,71,
+2,157,0,2,0,81,2,159,0,2,0,90,2,161,0,2,0,91,0,1,0,10,0,42,0,52,0,53,0,61,
+0,64,0,167,0,178,0,182,1,31,2,94,0,5,2,0,0,1,0,8,0,2,0,22,0,66,0,7,0,0,0,
+202,0,226,0,250,1,8,0,0,0,0,0,1,0,20,0,29,0,31,0,35,0,36,0,37,0,38,0,55,0,
+72,0,102,0,103,1,234,1,236,1,242,2,12,2,14,2,116,2,120,2,153,2,154,2,155,
+0,2,0,22,0,29,0,29,0,1,0,31,0,31,0,1,0,35,0,38,0,1,0,55,0,55,0,1,0,72,0,72,
+0,3,0,86,0,86,0,6,0,102,0,103,0,3,1,234,1,234,0,4,1,236,1,236,0,4,1,242,1,
+242,0,4,2,12,2,12,0,2,2,14,2,14,0,2,2,116,2,116,0,3,2,120,2,120,0,3,2,145,
+2,145,0,5,2,148,2,148,0,5,2,151,2,151,0,5,2,153,2,155,0,3,2,157,2,157,0,5,
+3,61,3,65,0,6,3,68,3,71,0,6,3,85,3,85,0,6,0,1,0,4,0,3,0,3,0,5,0,6,0,0,0,103,
+0,1,0,103,0,0,0,105,0,1,0,4,0,3,0,3,0,5,0,6,0,1,0,103,0,0,0,104,0,1,0,105,
+0,1,0,4,0,2,0,1,0,6,0,0,0,103,0,1,0,4,0,2,0,1,0,6,0,0,0,104,0,1,0,0,0,1,0,
+8,0,2,0,44,0,19,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,166,2,167,2,168,
+2,167,2,168,2,144,2,147,2,150,2,218,2,219,2,220,2,156,0,1,0,19,0,29,0,31,
+0,35,0,36,0,37,0,38,0,55,0,72,0,102,0,103,2,116,2,120,2,145,2,148,2,151,2,
+153,2,154,2,155,2,157,0,2,0,0,0,1,0,8,0,1,0,52,0,5,0,16,0,24,0,32,0,40,0,
+46,0,3,0,193,0,35,0,70,0,3,0,193,0,36,0,70,0,3,0,195,0,37,0,70,0,2,0,214,
+2,129,0,2,0,214,2,130,0,1,0,5,1,234,1,236,1,242,2,12,2,14,0,4,0,0,0,1,0,8,
+0,1,0,66,0,5,0,16,0,26,0,36,0,46,0,56,0,1,0,4,1,76,0,2,2,156,0,1,0,4,1,83,
+0,2,2,156,0,1,0,4,1,85,0,2,2,156,0,1,0,4,1,87,0,2,2,156,0,1,0,4,1,89,0,2,
+2,156,0,1,0,5,2,127,2,129,2,130,2,131,2,132,0,5,0,0,0,1,0,8,0,1,0,10,0,2,
+0,18,0,52,0,1,0,2,1,24,1,63,0,2,0,6,0,20,0,2,0,2,0,69,0,0,0,107,0,1,0,109,
+0,2,0,2,0,70,0,0,0,108,0,1,0,109,0,2,0,6,0,20,0,2,0,2,0,69,0,0,0,107,0,1,
+0,109,0,2,0,2,0,70,0,0,0,108,0,1,0,109,0,1,0,0,0,1,0,8,0,2,0,10,0,2,1,157,
+1,162,0,1,0,2,1,24,1,63,0,1,0,0,0,1,0,8,0,2,0,10,0,2,1,158,1,163,0,1,0,2,
+1,24,1,63,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,182,0,182,0,1,0,2,0,69,0,70,0,6,
+0,0,0,1,0,8,0,2,0,16,0,32,1,62,1,90,0,2,0,0,1,98,0,1,0,6,0,68,1,173,1,174,
+1,175,2,187,2,214,0,2,0,47,0,25,0,25,0,3,0,29,0,29,0,1,0,31,0,31,0,1,0,35,
+0,35,0,1,0,36,0,36,0,2,0,38,0,38,0,1,0,42,0,42,0,1,0,47,0,47,0,3,0,55,0,56,
+0,1,0,92,0,92,0,3,0,97,0,97,0,1,0,98,0,98,0,3,0,157,0,157,0,1,0,159,0,159,
+0,1,0,162,0,162,0,1,0,163,0,163,0,2,0,167,0,167,0,1,0,254,0,254,0,3,1,2,1,
+2,0,1,1,4,1,4,0,1,1,8,1,8,0,1,1,9,1,9,0,2,1,11,1,11,0,1,1,15,1,15,0,1,1,19,
+1,19,0,3,1,26,1,26,0,1,1,37,1,37,0,3,1,41,1,41,0,1,1,43,1,43,0,1,1,47,1,47,
+0,1,1,48,1,48,0,2,1,50,1,50,0,1,1,54,1,54,0,1,1,58,1,58,0,3,1,65,1,65,0,1,
+1,227,1,227,0,3,1,228,1,229,0,1,1,233,1,233,0,1,1,235,1,235,0,2,1,238,1,238,
+0,2,1,244,1,244,0,1,1,248,1,253,0,1,1,255,1,255,0,1,2,16,2,17,0,1,2,20,2,
+25,0,1,2,35,2,36,0,3,2,39,2,40,0,3,0,2,0,4,0,68,0,68,0,1,1,173,1,175,0,1,
+2,187,2,187,0,1,2,214,2,214,0,1,0,1,0,1,0,1,0,1,0,3,0,8,0,22,0,36,0,1,0,1,
+0,1,0,0,0,1,0,0,0,111,0,1,0,2,0,1,0,0,0,1,0,0,0,112,0,1,0,3,0,1,0,0,0,1,0,
+0,0,113,0,1,0,0,0,1,0,8,0,2,0,18,0,6,2,95,2,98,2,101,2,104,2,188,2,215,0,
+1,0,6,0,68,1,173,1,174,1,175,2,187,2,214,0,1,0,0,0,1,0,8,0,2,0,18,0,6,2,96,
+2,99,2,102,2,105,2,189,2,216,0,1,0,6,0,68,1,173,1,174,1,175,2,187,2,214,0,
+1,0,0,0,1,0,8,0,2,0,18,0,6,2,97,2,100,2,103,2,106,2,190,2,217,0,1,0,6,0,68,
+1,173,1,174,1,175,2,187,2,214,0,6,2,0,0,1,0,8,0,2,0,16,0,22,0,230,0,238,0,
+2,0,0,0,246,0,1,0,1,3,73,0,2,0,34,0,15,0,16,0,2,0,26,0,28,0,4,0,30,0,30,0,
+4,0,32,0,54,0,4,0,57,0,61,0,4,0,69,0,72,0,1,0,81,0,81,0,1,0,100,0,100,0,2,
+0,102,0,103,0,1,0,179,0,180,0,4,0,255,1,1,0,4,1,3,1,3,0,4,1,5,1,7,0,4,1,12,
+1,23,0,4,1,25,1,25,0,4,1,27,1,31,0,4,1,35,1,36,0,4,1,56,1,56,0,4,1,230,1,
+232,0,4,1,233,1,236,0,2,1,237,1,237,0,4,1,238,1,238,0,2,1,239,1,239,0,4,1,
+240,1,241,0,2,1,243,1,243,0,4,1,244,1,244,0,2,1,245,1,246,0,4,1,248,1,253,
+0,3,1,255,1,255,0,3,2,0,2,1,0,4,2,3,2,5,0,4,2,10,2,11,0,4,2,163,2,165,0,1,
+2,169,2,169,0,1,0,1,3,73,0,1,0,1,0,1,0,1,0,1,0,1,0,4,0,10,0,26,0,42,0,56,
+0,2,0,1,0,3,0,1,0,0,0,1,0,0,0,115,0,2,0,1,0,4,0,1,0,0,0,1,0,0,0,115,0,1,0,
+2,0,1,0,0,0,1,0,0,0,115,0,1,0,3,0,1,0,0,0,1,0,0,0,115,0,1,0,0,0,1,0,8,0,1,
+0,6,0,37,0,1,0,1,3,73,0,4,0,0,0,1,0,8,0,1,0,42,0,1,0,8,0,4,0,10,0,16,0,22,
+0,28,3,106,0,2,3,74,3,107,0,2,3,76,3,108,0,2,3,77,3,109,0,2,3,80,0,1,0,1,
+0,7,0,4,0,0,0,1,0,8,0,1,0,222,0,18,0,42,0,52,0,62,0,72,0,82,0,92,0,102,0,
+112,0,122,0,132,0,142,0,152,0,162,0,172,0,182,0,192,0,202,0,212,0,1,0,4,1,
+118,0,2,2,158,0,1,0,4,1,124,0,2,2,158,0,1,0,4,1,125,0,2,2,158,0,1,0,4,1,126,
+0,2,2,158,0,1,0,4,1,127,0,2,2,158,0,1,0,4,0,238,0,2,2,122,0,1,0,4,0,233,0,
+2,0,81,0,1,0,4,0,234,0,2,0,81,0,1,0,4,0,225,0,2,0,81,0,1,0,4,0,231,0,2,0,
+81,0,1,0,4,0,232,0,2,0,81,0,1,0,4,1,109,0,2,0,81,0,1,0,4,1,146,0,2,0,81,0,
+1,0,4,1,75,0,2,2,156,0,1,0,4,1,82,0,2,2,156,0,1,0,4,1,84,0,2,2,156,0,1,0,
+4,1,86,0,2,2,156,0,1,0,4,1,88,0,2,2,156,0,1,0,18,0,29,0,35,0,36,0,37,0,38,
+0,42,0,96,0,97,0,157,0,162,0,163,1,31,1,70,2,127,2,129,2,130,2,131,2,132,
+0,6,0,0,0,1,0,8,0,2,0,16,0,38,0,54,0,76,0,2,0,0,0,84,0,2,0,3,3,28,3,45,0,
+0,3,56,3,58,0,18,3,92,3,92,0,21,0,2,0,2,0,3,0,3,0,1,0,135,0,135,0,1,0,2,0,
+3,3,28,3,45,0,1,3,56,3,58,0,1,3,92,3,92,0,1,0,1,0,1,0,1,0,1,0,1,0,4,0,1,0,
+1,0,1,0,0,0,1,0,0,0,119,0,1,0,0,0,1,0,8,0,2,0,50,0,22,3,115,3,116,3,117,3,
+118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,127,3,128,3,129,3,130,
+3,131,3,132,3,111,3,112,3,113,3,114,0,2,0,3,3,28,3,45,0,0,3,56,3,58,0,18,
+3,92,3,92,0,21,0,0,};
+#endif
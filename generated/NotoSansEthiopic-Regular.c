@@ -0,0 +1,6124 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansEthiopic_Regular_ttf_size = 156960;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansEthiopic_Regular_ttf");
+asm(".type fz_font_NotoSansEthiopic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansEthiopic_Regular_ttf, 156960");
+asm(".balign 64");
+asm("fz_font_NotoSansEthiopic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansEthiopic-Regular.ttf\"");
+#else
+const int fz_font_NotoSansEthiopic_Regular_ttf_size = 156960;
+const char fz_font_NotoSansEthiopic_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,9,43,8,105,0,1,93,220,0,0,0,48,71,
+80,79,83,185,23,115,170,0,1,94,12,0,1,6,16,71,83,85,66,82,239,67,199,0,2,
+100,28,0,0,1,4,79,83,47,50,125,63,103,37,0,0,1,104,0,0,0,96,99,109,97,112,
+68,92,214,168,0,0,10,132,0,0,1,228,103,97,115,112,0,7,0,7,0,1,93,208,0,0,
+0,12,103,108,121,102,21,18,214,175,0,0,16,200,0,1,47,240,104,101,97,100,4,
+3,117,31,0,0,0,236,0,0,0,54,104,104,101,97,17,80,8,233,0,0,1,36,0,0,0,36,
+104,109,116,120,105,182,217,166,0,0,1,200,0,0,8,186,108,111,99,97,210,73,
+30,228,0,0,12,104,0,0,4,96,109,97,120,112,2,59,0,159,0,0,1,72,0,0,0,32,110,
+97,109,101,142,1,185,230,0,1,64,184,0,0,6,12,112,111,115,116,191,79,128,34,
+0,1,70,196,0,0,23,9,0,1,0,0,0,1,20,123,78,176,172,187,95,15,60,245,0,11,8,
+0,0,0,0,0,201,251,72,231,0,0,0,0,210,40,203,232,253,176,255,72,11,16,7,143,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,11,98,253,176,253,176,11,
+16,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,46,0,1,0,0,2,47,0,123,0,7,0,34,0,3,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,4,5,188,1,144,0,5,0,0,5,154,5,51,0,0,
+1,31,5,154,5,51,0,0,3,209,0,102,1,242,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,
+0,0,0,0,0,8,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,3,3,80,0,0,0,0,0,0,0,0,0,0,2,20,0,
+0,4,242,0,184,6,33,0,184,4,90,0,164,4,25,0,164,4,125,0,164,5,248,0,102,6,
+94,0,184,4,217,0,102,5,115,0,102,6,72,0,102,4,197,0,82,6,66,0,102,5,84,0,
+102,7,27,0,102,6,12,0,82,6,16,0,164,7,12,0,164,7,68,0,164,5,231,0,123,7,147,
+0,164,6,16,0,164,5,231,0,164,6,231,0,123,7,154,0,143,8,203,0,143,7,248,0,
+123,7,104,0,123,8,2,0,123,7,92,0,123,7,92,0,123,7,90,0,123,6,154,0,184,7,
+201,0,184,6,113,0,123,6,113,0,164,6,166,0,164,7,115,0,82,6,113,0,164,6,113,
+0,164,4,63,0,102,5,2,0,102,4,139,0,102,5,94,0,102,5,31,0,102,4,86,0,184,5,
+47,0,184,5,94,0,102,4,242,0,184,6,33,0,184,6,53,0,184,4,221,0,164,6,94,0,
+184,4,242,0,184,4,221,0,184,5,215,0,123,4,242,0,162,6,33,0,162,6,53,0,162,
+4,221,0,141,6,94,0,162,5,8,0,82,4,221,0,162,5,215,0,141,5,86,0,102,5,86,0,
+102,5,86,0,102,5,109,0,82,5,86,0,102,5,86,0,102,5,86,0,102,5,217,0,102,7,
+137,0,102,5,86,0,102,5,86,0,102,7,137,0,102,5,86,0,102,5,86,0,102,5,86,0,
+102,5,106,0,82,5,86,0,102,6,84,0,102,5,84,0,100,5,176,0,102,7,137,0,102,5,
+86,0,102,5,88,0,102,7,137,0,102,4,242,0,184,6,33,0,184,6,41,0,184,4,221,0,
+164,6,94,0,184,6,33,0,82,4,221,0,184,6,4,0,164,4,242,0,162,6,33,0,162,6,53,
+0,162,4,201,0,141,6,94,0,162,6,33,0,82,4,221,0,162,5,197,0,141,4,240,0,102,
+4,240,0,102,4,240,0,102,4,240,0,102,5,35,0,102,4,240,0,102,4,240,0,102,4,
+240,0,102,4,240,0,102,4,240,0,102,4,240,0,102,4,240,0,102,4,250,0,102,6,33,
+0,102,4,240,0,102,4,240,0,102,4,119,0,82,5,166,0,82,5,188,0,82,4,119,0,82,
+5,227,0,82,4,188,0,82,6,127,0,82,6,143,0,82,6,88,0,82,5,20,0,82,5,227,0,82,
+6,88,0,82,3,49,0,102,4,94,0,102,4,106,0,102,4,59,0,123,3,201,0,78,3,229,0,
+82,5,27,0,123,4,184,0,82,4,211,0,82,5,209,0,82,5,221,0,82,4,166,0,82,4,137,
+0,82,4,63,0,82,5,68,0,82,4,166,0,82,4,96,0,82,5,145,0,82,5,188,0,82,4,92,
+0,102,5,246,0,82,4,117,0,82,4,96,0,82,4,209,0,82,5,6,0,102,6,33,0,102,6,74,
+0,102,5,6,0,102,6,115,0,102,5,6,0,102,4,242,0,102,7,199,0,102,6,240,0,102,
+5,111,0,102,6,115,0,102,6,78,0,102,6,88,0,82,7,106,0,82,7,133,0,82,6,88,0,
+82,7,197,0,82,6,88,0,82,6,68,0,82,9,25,0,82,8,43,0,82,6,199,0,82,7,197,0,
+82,7,160,0,82,6,31,0,123,6,242,0,123,6,31,0,123,6,31,0,123,6,31,0,123,7,117,
+0,123,6,31,0,123,4,242,0,164,6,25,0,164,5,211,0,123,4,209,0,123,5,233,0,123,
+4,242,0,164,4,76,0,104,4,88,0,184,5,117,0,184,5,117,0,184,4,88,0,184,5,197,
+0,184,5,102,0,82,4,88,0,184,5,102,0,184,6,117,0,82,6,117,0,82,6,117,0,82,
+6,117,0,82,6,211,0,82,6,217,0,82,6,117,0,82,6,117,0,82,4,10,0,154,4,51,0,
+154,5,27,0,154,4,92,0,82,5,66,0,154,5,188,0,82,5,76,0,154,4,186,0,82,6,223,
+0,82,6,246,0,82,5,156,0,82,5,156,0,82,5,215,0,82,5,152,0,102,5,236,0,82,4,
+186,0,82,6,223,0,82,6,246,0,82,5,156,0,82,5,156,0,82,5,197,0,82,5,152,0,102,
+5,236,0,82,4,252,0,82,6,223,0,82,6,246,0,82,5,156,0,82,5,156,0,82,5,188,0,
+82,5,154,0,102,6,20,0,82,4,168,0,82,5,213,0,82,5,225,0,82,5,8,0,82,6,20,0,
+82,6,47,0,82,4,168,0,82,6,252,0,82,6,137,0,82,4,168,0,82,6,20,0,82,6,137,
+0,82,4,236,0,82,6,16,0,82,6,29,0,82,5,18,0,82,6,23,0,82,6,47,0,82,5,74,0,
+102,7,131,0,184,8,178,0,184,8,180,0,184,7,111,0,164,8,199,0,184,7,90,0,164,
+7,111,0,184,8,104,0,164,9,45,0,184,9,45,0,184,9,27,0,184,9,25,0,164,10,63,
+0,184,9,111,0,164,8,248,0,184,8,207,0,164,4,31,0,102,5,137,0,102,5,188,0,
+102,4,31,0,125,5,209,0,102,5,27,0,102,4,31,0,102,5,68,0,125,4,106,0,102,5,
+176,0,102,5,186,0,102,4,106,0,125,6,35,0,102,5,39,0,102,4,106,0,102,5,143,
+0,125,4,242,0,164,5,236,0,164,4,129,0,102,3,231,0,102,4,135,0,102,4,242,0,
+164,4,74,0,104,5,37,0,104,5,150,1,39,5,43,0,104,5,37,0,104,6,6,0,104,5,4,
+0,102,5,90,0,184,5,94,0,82,5,133,0,102,5,133,0,102,5,133,0,102,5,133,0,102,
+5,133,0,102,5,133,0,102,6,25,0,131,5,133,0,102,5,53,0,102,8,51,0,123,5,96,
+0,104,2,37,0,147,4,12,0,147,3,23,0,147,3,23,0,147,3,23,0,147,4,160,0,147,
+2,37,0,147,5,2,0,147,4,125,0,82,4,125,0,82,4,125,0,82,4,125,0,82,4,125,0,
+82,4,125,0,82,4,125,0,82,4,248,0,82,4,125,0,82,4,125,0,82,4,248,0,82,5,0,
+0,102,5,88,0,102,4,125,0,82,4,248,0,82,4,145,0,102,6,96,0,82,4,125,0,82,4,
+125,0,82,5,111,0,82,4,49,0,82,4,8,0,82,4,33,0,82,3,240,0,82,4,125,0,82,4,
+125,0,82,4,61,0,82,4,248,0,82,4,49,0,82,3,84,0,82,4,248,0,82,5,0,0,102,5,
+76,0,102,4,12,0,82,4,248,0,82,4,145,0,102,6,96,0,82,3,250,0,82,3,250,0,82,
+5,111,0,82,4,8,0,0,3,195,0,0,3,217,0,0,3,137,0,0,4,84,0,0,3,150,0,0,3,164,
+0,0,4,248,0,0,3,231,0,0,2,43,0,0,4,248,0,0,5,0,0,0,5,88,0,0,3,127,0,0,4,248,
+0,0,4,145,0,0,6,96,0,0,3,55,0,0,3,25,0,0,5,111,0,0,4,84,0,0,4,55,0,0,4,53,
+0,0,4,23,0,0,4,84,0,0,3,150,0,0,3,227,0,0,4,248,0,0,4,51,0,0,3,84,0,0,4,248,
+0,0,5,0,0,0,5,88,0,0,3,240,0,0,4,248,0,0,4,145,0,0,6,96,0,0,3,227,0,0,3,197,
+0,0,5,111,0,0,7,141,0,82,5,86,0,102,6,135,0,82,6,12,0,82,7,111,0,82,6,135,
+0,82,4,168,0,82,5,166,0,82,5,10,0,82,10,121,0,143,9,119,0,123,8,2,0,123,10,
+100,0,123,7,197,0,184,6,236,0,184,6,74,0,164,9,37,0,82,6,213,0,104,6,37,0,
+104,6,180,0,104,6,203,0,102,6,156,0,102,5,203,0,102,5,133,0,102,7,66,0,102,
+8,27,0,82,7,133,0,82,6,131,0,82,6,33,0,82,6,53,0,82,6,33,0,82,4,240,0,102,
+4,240,0,102,5,68,0,82,5,68,0,82,4,203,0,82,5,156,0,82,6,45,0,82,6,49,0,82,
+6,49,0,82,8,182,0,82,10,61,0,82,5,84,0,82,6,119,0,82,7,53,0,82,6,195,0,82,
+6,20,0,82,6,195,0,82,6,74,0,82,7,141,0,82,7,141,0,82,6,74,0,82,7,182,0,82,
+6,72,0,82,6,53,0,82,4,240,0,102,4,240,0,102,4,240,0,102,4,240,0,102,4,250,
+0,102,5,248,0,82,4,240,0,102,6,117,0,82,6,117,0,82,6,117,0,82,6,117,0,82,
+6,211,0,82,6,217,0,82,6,117,0,82,10,109,0,82,10,80,0,82,10,61,0,82,10,80,
+0,82,11,98,0,82,10,166,0,82,10,27,0,82,5,86,0,102,5,86,0,102,5,86,0,102,5,
+106,0,82,5,86,0,102,5,254,0,51,5,86,0,102,5,6,0,102,6,53,0,102,6,74,0,102,
+5,6,0,102,6,115,0,102,5,6,0,102,5,6,0,102,6,88,0,82,7,106,0,82,7,133,0,82,
+6,88,0,82,7,197,0,82,6,88,0,82,6,68,0,82,4,168,0,82,5,213,0,82,5,225,0,82,
+5,8,0,82,6,20,0,82,6,47,0,82,4,168,0,82,0,0,254,141,5,221,0,41,2,37,0,147,
+3,221,0,145,2,37,0,147,2,37,0,147,3,221,0,145,6,92,0,102,3,35,0,102,7,111,
+0,102,7,111,0,145,3,119,0,184,6,33,0,184,6,53,0,184,4,221,0,164,6,94,0,184,
+4,242,0,184,4,221,0,184,6,223,0,82,6,246,0,82,5,156,0,82,5,156,0,82,5,197,
+0,82,5,152,0,102,5,102,0,152,5,117,0,152,4,88,0,152,5,197,0,152,5,102,0,82,
+4,88,0,152,9,45,0,184,9,45,0,184,9,27,0,184,9,25,0,164,10,63,0,184,9,111,
+0,164,9,25,0,164,4,106,0,82,5,213,0,82,6,23,0,82,4,106,0,82,5,209,0,82,5,
+90,0,82,4,106,0,82,0,0,253,176,255,129,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,
+216,0,0,0,108,0,64,0,5,0,44,0,0,0,13,0,32,0,160,18,6,18,7,18,70,18,72,18,
+77,18,86,18,88,18,93,18,134,18,136,18,141,18,174,18,176,18,181,18,190,18,
+192,18,197,18,206,18,207,18,214,18,238,18,239,19,14,19,16,19,21,19,30,19,
+31,19,70,19,71,19,90,19,96,19,124,19,143,19,153,45,150,45,166,45,174,45,182,
+45,190,45,198,45,206,45,214,45,222,171,6,171,14,171,22,171,38,171,46,254,
+255,255,255,0,0,0,0,0,13,0,32,0,160,18,0,18,7,18,8,18,71,18,74,18,80,18,88,
+18,90,18,96,18,135,18,138,18,144,18,175,18,178,18,184,18,192,18,194,18,200,
+18,207,18,208,18,216,18,239,18,240,19,15,19,18,19,24,19,31,19,32,19,71,19,
+72,19,93,19,97,19,128,19,144,45,128,45,160,45,168,45,176,45,184,45,192,45,
+200,45,208,45,216,171,1,171,9,171,17,171,32,171,40,254,255,255,255,0,1,255,
+245,255,227,255,99,238,4,239,146,238,3,0,0,238,1,237,255,237,254,237,253,
+237,251,0,0,237,249,237,247,0,0,237,245,237,243,237,242,237,241,237,239,238,
+206,237,238,237,237,238,175,237,236,0,0,237,234,237,232,238,129,237,231,238,
+90,237,230,0,0,237,224,238,34,238,115,212,50,212,41,212,40,212,39,212,38,
+212,37,212,36,212,35,212,34,87,12,87,10,87,8,86,255,86,254,1,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,84,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,154,
+0,74,1,155,0,130,1,156,0,166,1,159,0,251,2,45,2,46,2,1,2,2,0,0,0,77,0,77,
+0,77,0,77,0,110,0,153,0,196,0,223,1,16,1,59,1,116,1,146,1,189,1,235,2,8,2,
+60,2,109,2,177,2,226,3,12,3,66,3,122,3,163,3,225,4,20,4,62,4,120,4,185,5,
+4,5,100,5,181,6,26,6,93,6,157,6,255,7,47,7,105,7,175,7,228,8,45,8,98,8,148,
+8,219,9,12,9,59,9,102,9,154,9,217,10,16,10,93,10,161,10,197,10,243,11,38,
+11,73,11,127,11,164,11,200,11,253,12,60,12,133,12,212,13,19,13,102,13,166,
+13,229,14,53,14,103,14,164,14,229,15,38,15,107,15,167,15,249,16,76,16,144,
+16,207,17,29,17,96,17,176,18,10,18,105,18,200,19,43,19,131,19,241,20,97,20,
+194,21,31,21,138,21,234,22,10,22,53,22,100,22,132,22,184,22,226,23,3,23,52,
+23,116,23,190,24,12,24,75,24,156,24,229,25,36,25,115,25,150,25,196,25,246,
+26,41,26,96,26,144,26,212,27,9,27,73,27,148,27,226,28,50,28,134,28,208,29,
+41,29,122,29,158,29,206,30,1,30,55,30,112,30,147,30,214,31,29,31,83,31,134,
+31,199,31,251,32,22,32,60,32,101,32,136,32,183,32,217,33,18,33,72,33,126,
+33,191,34,4,34,69,34,137,34,191,35,23,35,107,35,148,35,199,35,254,36,39,36,
+98,36,143,36,180,36,242,37,28,37,81,37,138,37,179,37,240,38,42,38,83,38,158,
+38,215,39,14,39,83,39,140,39,211,40,37,40,123,40,193,41,28,41,115,41,185,
+42,34,42,122,42,209,43,51,43,137,43,202,44,19,44,96,44,159,44,241,45,59,45,
+123,45,170,45,229,46,42,46,93,46,166,46,216,47,14,47,37,47,71,47,109,47,132,
+47,176,47,216,47,240,48,25,48,81,48,148,48,219,49,19,49,95,49,186,49,242,
+50,60,50,109,50,169,50,235,51,44,51,127,51,200,52,4,52,69,52,137,52,209,53,
+11,53,97,53,171,53,240,54,59,54,127,54,197,55,15,55,76,55,164,55,242,56,58,
+56,139,56,238,57,84,57,190,58,26,58,142,58,250,59,94,59,204,59,237,60,23,
+60,70,60,121,60,173,60,228,61,10,61,79,61,127,61,180,61,240,62,30,62,95,62,
+170,62,249,63,73,63,157,63,244,64,82,64,131,64,190,64,253,65,45,65,113,65,
+167,65,216,66,24,66,128,66,242,67,87,67,192,68,73,68,183,69,30,69,132,69,
+195,70,13,70,90,70,152,70,245,71,63,71,125,71,203,72,13,72,90,72,170,72,238,
+73,75,73,150,73,215,74,43,74,97,74,162,74,233,75,34,75,110,75,166,75,225,
+76,31,76,105,76,171,76,231,77,66,77,129,77,209,78,32,78,63,78,105,78,150,
+78,196,78,246,79,26,79,75,79,123,79,183,80,45,80,125,80,163,80,231,81,20,
+81,71,81,116,81,161,81,211,82,68,82,152,83,12,83,81,83,160,84,4,84,93,84,
+184,85,13,85,89,85,140,85,235,86,64,86,152,86,224,87,59,87,168,87,241,88,
+64,88,150,89,28,89,100,89,203,90,5,90,71,90,159,90,236,91,59,91,132,91,196,
+91,235,92,62,92,134,92,211,93,15,93,94,93,191,93,252,94,63,94,137,95,3,95,
+62,95,151,95,195,95,249,96,70,96,135,96,202,97,7,97,59,97,84,97,155,97,215,
+98,24,98,72,98,138,98,224,99,16,99,70,99,131,99,241,100,57,100,159,100,217,
+101,28,101,116,101,193,102,16,102,89,102,153,102,191,103,18,103,90,103,166,
+103,226,104,49,104,146,104,207,105,18,105,93,105,215,106,32,106,128,106,210,
+107,6,107,80,107,150,107,203,108,29,108,107,108,206,109,45,109,152,109,253,
+110,64,110,112,110,171,110,248,111,89,111,166,111,250,112,81,112,147,112,
+195,112,253,113,68,113,153,113,234,114,71,114,117,114,190,114,233,115,60,
+115,164,115,236,116,82,116,136,116,177,117,3,117,89,117,205,118,8,118,121,
+118,199,119,6,119,106,119,189,120,24,120,103,120,177,121,6,121,95,121,168,
+122,6,122,81,122,155,122,230,123,60,123,149,123,239,124,77,124,162,125,6,
+125,73,125,151,125,232,126,43,126,130,126,232,127,43,127,159,128,29,128,141,
+129,1,129,150,130,13,130,128,130,196,131,20,131,103,131,182,132,14,132,88,
+132,186,132,244,133,57,133,129,133,186,134,7,134,81,134,138,134,227,135,71,
+135,174,136,3,136,110,136,212,137,44,137,99,137,162,137,232,138,47,138,123,
+138,196,138,250,139,33,139,125,139,147,139,175,139,183,139,192,139,221,139,
+243,140,8,140,21,140,51,140,81,140,135,140,193,140,235,141,42,141,86,141,
+129,141,204,142,26,142,90,142,188,143,17,143,94,143,161,143,230,144,28,144,
+103,144,174,144,229,145,109,146,1,146,133,147,12,147,182,148,68,148,204,149,
+45,149,153,150,6,150,102,150,229,151,79,151,172,151,226,151,248,0,4,0,0,0,
+0,3,80,4,240,0,3,0,7,0,35,0,47,0,0,1,17,33,17,1,17,33,17,1,39,52,54,55,62,
+2,53,52,38,35,34,7,39,54,54,51,50,22,23,20,6,7,6,7,6,21,7,52,54,51,50,22,
+21,20,6,35,34,38,3,80,252,176,2,252,253,86,1,33,2,30,68,32,33,19,74,51,121,
+18,82,14,121,90,88,114,1,29,72,65,10,8,95,35,25,24,35,35,24,25,35,4,240,251,
+16,4,240,251,104,4,64,251,192,1,68,30,73,95,78,32,42,47,29,65,82,166,12,125,
+117,118,109,46,91,76,60,36,29,92,152,27,35,35,27,28,35,35,0,0,1,0,184,255,
+236,4,57,5,182,0,17,0,0,1,17,16,2,35,34,2,17,17,51,17,20,22,51,50,54,53,17,
+4,57,235,219,217,226,187,130,136,131,127,5,182,252,78,254,252,254,236,1,22,
+1,6,3,174,252,72,193,174,175,194,3,182,0,0,1,0,184,255,236,5,207,5,182,0,
+25,0,0,1,17,33,19,35,34,38,39,35,21,16,2,35,34,2,17,17,51,17,20,22,51,50,
+54,53,17,4,57,1,109,41,39,70,94,12,191,235,219,217,226,187,130,136,131,127,
+5,182,253,117,254,193,104,80,160,254,252,254,236,1,22,1,6,3,174,252,72,193,
+174,175,194,3,182,0,1,0,164,255,92,4,8,5,182,0,23,0,0,37,19,36,17,17,51,17,
+20,23,19,51,1,33,54,54,51,51,7,23,35,34,38,39,33,1,43,248,254,129,186,250,
+244,188,253,230,1,41,17,99,56,38,32,32,38,56,100,16,254,20,115,2,102,33,1,
+106,1,82,254,180,247,21,2,88,250,209,67,97,229,234,98,66,0,0,1,0,164,0,0,
+4,8,5,182,0,12,0,0,33,1,38,38,53,17,51,17,20,23,19,51,1,1,0,1,37,197,188,
+186,252,242,188,253,180,2,215,17,200,180,1,82,254,180,247,21,2,88,250,74,
+0,2,0,164,0,0,4,37,5,182,0,20,0,28,0,0,37,19,38,38,53,17,51,17,20,5,19,51,
+1,51,50,22,21,20,6,35,33,1,3,51,50,54,53,52,35,1,63,232,197,190,182,1,2,240,
+188,254,142,120,129,150,188,171,254,129,1,29,106,170,106,105,156,145,2,70,
+17,198,182,1,82,254,180,246,22,2,88,252,103,138,116,139,148,1,145,254,246,
+71,75,120,0,1,0,102,255,236,5,63,5,182,0,26,0,0,1,17,16,2,35,34,2,17,17,38,
+38,53,53,51,21,20,22,51,51,17,20,22,51,50,54,53,17,5,63,232,222,215,228,187,
+157,187,86,112,146,130,136,131,127,5,182,252,78,254,253,254,235,1,21,1,7,
+1,156,9,177,191,153,147,127,109,253,199,193,174,175,194,3,182,0,2,0,184,255,
+236,6,12,5,203,0,27,0,36,0,0,1,62,2,51,50,22,21,20,6,35,35,17,16,2,35,34,
+2,17,17,51,17,20,22,51,50,54,53,1,34,7,21,51,50,53,52,38,3,127,141,83,83,
+43,152,151,171,158,138,238,220,215,224,187,130,136,131,127,1,80,96,54,115,
+170,69,5,131,45,19,8,132,122,138,149,254,86,255,0,254,232,1,21,1,7,3,174,
+252,72,193,174,175,194,3,63,34,232,150,62,54,0,0,1,0,102,0,0,4,135,5,182,
+0,13,0,0,33,35,1,6,6,2,3,35,26,2,55,3,51,4,135,194,254,174,98,121,86,33,187,
+35,114,176,146,108,194,3,231,30,225,254,101,254,179,1,122,1,225,1,1,37,1,
+53,0,1,0,102,0,0,5,33,5,182,0,21,0,0,1,33,19,35,34,38,39,35,19,35,1,6,6,2,
+3,35,26,2,55,3,51,3,115,1,133,41,39,70,94,12,170,231,194,254,174,98,121,86,
+33,187,35,114,176,146,106,195,3,43,254,193,104,80,253,92,3,231,30,225,254,
+101,254,179,1,122,1,225,1,1,37,1,53,0,0,1,0,102,255,92,5,246,5,182,0,24,0,
+0,37,23,35,34,38,39,33,1,6,6,2,3,35,26,2,55,3,51,1,51,54,54,51,51,5,213,33,
+39,56,100,16,254,162,254,174,98,121,86,33,187,35,114,176,146,106,195,1,194,
+203,17,99,56,39,70,234,98,66,3,231,30,225,254,101,254,179,1,122,1,225,1,1,
+37,1,53,250,209,67,97,0,1,0,82,0,0,4,115,5,182,0,13,0,0,33,35,1,14,2,7,35,
+18,18,54,55,3,51,4,115,195,254,174,104,115,81,38,186,36,117,176,146,111,195,
+3,225,20,120,250,241,1,7,1,70,170,24,1,61,0,0,2,0,102,0,0,5,240,5,182,0,20,
+0,28,0,0,1,33,50,22,21,20,6,35,35,1,6,6,2,3,35,26,2,55,3,51,1,19,51,50,54,
+53,52,35,3,207,1,10,129,150,188,171,196,254,174,98,121,86,33,187,35,114,176,
+146,106,195,1,104,90,14,106,105,155,2,29,138,116,139,148,3,231,30,225,254,
+101,254,179,1,122,1,225,1,1,37,1,53,251,219,254,246,71,75,120,0,0,2,0,102,
+0,0,5,2,5,182,0,19,0,28,0,0,33,35,1,6,6,7,51,50,22,21,20,6,35,33,26,2,55,
+3,51,1,6,7,51,50,54,53,52,35,5,2,195,254,72,109,129,47,117,129,150,188,171,
+254,215,35,118,183,148,133,198,254,199,21,14,62,106,104,155,3,236,32,210,
+221,138,116,139,148,1,116,1,228,1,4,37,1,53,251,219,133,133,71,75,120,0,2,
+0,102,0,0,6,201,5,182,0,29,0,41,0,0,1,33,54,51,50,22,21,20,6,35,34,38,53,
+52,55,35,1,35,1,6,6,2,3,35,26,2,55,3,51,1,34,6,21,20,22,51,50,54,53,52,38,
+3,80,1,43,82,174,164,170,174,160,157,177,4,180,1,10,194,254,174,98,121,86,
+33,187,35,114,176,146,106,195,2,229,71,81,80,72,70,81,81,3,147,74,135,127,
+128,150,152,126,37,16,252,244,3,231,30,225,254,101,254,179,1,122,1,225,1,
+1,37,1,53,253,178,77,68,72,90,88,74,69,76,0,1,0,82,255,92,5,186,5,182,0,25,
+0,0,5,19,33,1,6,6,2,7,35,18,18,54,55,3,51,1,33,19,35,34,38,39,33,6,6,35,1,
+14,41,2,74,254,219,93,121,89,33,186,36,116,179,140,107,195,1,195,1,77,41,
+39,55,96,23,252,254,18,99,57,164,1,43,3,96,17,139,254,243,212,1,6,1,78,172,
+23,1,53,250,209,254,213,89,75,69,95,0,1,0,164,0,0,5,109,5,182,0,23,0,0,33,
+17,52,38,39,17,35,17,6,6,21,17,35,17,52,0,55,17,51,17,22,0,21,17,4,178,175,
+159,186,161,171,186,1,24,238,186,241,1,24,1,100,150,192,21,253,49,2,207,22,
+186,153,254,154,1,92,222,1,33,24,2,67,253,189,28,254,218,209,254,160,0,0,
+1,0,164,0,0,6,186,5,182,0,32,0,0,1,6,6,21,17,35,17,52,0,55,17,51,17,22,22,
+23,33,19,35,34,38,39,35,22,21,17,35,17,52,38,39,17,35,2,170,161,171,186,1,
+24,238,186,143,213,66,1,135,41,39,54,93,25,151,29,187,175,159,186,2,207,22,
+186,153,254,154,1,92,222,1,33,24,2,67,253,189,17,117,90,254,213,89,75,83,
+89,254,160,1,100,150,192,21,253,49,0,0,1,0,164,255,92,6,242,5,182,0,34,0,
+0,1,6,6,21,17,35,17,52,0,55,17,51,17,22,0,21,21,51,54,54,51,51,7,23,35,34,
+38,39,33,17,52,38,39,17,35,2,170,161,171,186,1,24,238,186,241,1,24,178,17,
+99,56,39,33,33,39,56,100,16,254,147,175,159,186,2,207,22,186,153,254,154,
+1,92,222,1,33,24,2,67,253,189,28,254,218,209,217,67,97,229,234,98,66,1,100,
+150,192,21,253,49,0,1,0,123,0,0,5,68,5,182,0,23,0,0,33,17,38,38,39,17,35,
+17,6,6,21,21,35,53,52,0,55,17,51,17,22,0,21,17,4,137,2,175,157,186,161,171,
+186,1,24,238,186,241,1,24,1,100,154,188,21,254,84,1,172,22,186,153,67,57,
+222,1,33,24,2,67,253,189,28,254,218,209,254,160,0,2,0,164,0,0,7,66,5,182,
+0,29,0,39,0,0,1,6,6,21,17,35,17,52,0,55,17,51,17,22,22,23,51,50,22,21,20,
+6,35,33,17,52,38,39,17,35,1,22,21,21,51,50,54,53,52,35,2,170,161,171,186,
+1,24,238,186,180,252,54,225,129,150,188,171,254,215,175,159,186,2,192,3,75,
+106,105,155,2,207,22,186,153,254,154,1,92,222,1,33,24,2,67,253,189,22,179,
+141,138,116,139,148,1,100,150,192,21,253,49,1,145,18,31,217,71,75,120,0,1,
+0,164,0,0,5,109,6,111,0,29,0,0,1,6,6,21,17,35,17,52,0,55,17,33,3,51,50,22,
+23,33,17,22,0,21,17,35,17,52,38,39,17,35,2,170,161,171,186,1,24,238,254,158,
+41,39,66,98,12,1,110,241,1,24,187,175,159,186,2,207,22,186,153,254,154,1,
+92,222,1,33,24,1,188,1,64,103,82,253,189,28,254,218,209,254,160,1,100,150,
+192,21,253,49,0,1,0,164,0,0,5,109,5,182,0,23,0,0,1,53,38,38,39,17,35,17,6,
+6,21,17,35,17,52,0,55,17,51,17,22,0,21,21,4,178,2,177,155,186,161,171,186,
+1,24,238,186,241,1,24,1,35,59,153,190,20,254,90,1,166,22,186,153,254,160,
+1,86,222,1,33,24,2,73,253,183,28,254,218,209,55,0,1,0,123,255,72,6,150,5,
+182,0,35,0,0,5,19,33,53,52,38,39,17,35,17,6,6,21,21,35,53,52,0,55,17,51,17,
+22,0,21,21,33,19,35,34,38,39,33,6,6,35,2,88,41,2,8,175,159,186,161,171,186,
+1,24,238,186,241,1,24,1,41,41,39,57,97,20,253,106,20,97,55,184,1,63,215,150,
+192,21,254,90,1,166,22,186,153,61,51,222,1,33,24,2,73,253,183,28,254,218,
+209,211,254,193,106,78,80,104,0,0,3,0,143,255,236,7,10,5,182,0,16,0,27,0,
+36,0,0,1,35,17,6,35,32,17,16,0,51,33,50,18,17,16,33,33,5,50,54,55,17,35,34,
+2,17,20,18,1,17,51,50,18,17,16,38,35,4,88,207,172,203,254,125,1,28,247,2,
+207,201,208,254,117,254,217,253,195,52,86,42,29,175,189,113,3,91,82,123,117,
+114,117,5,47,251,176,243,2,147,1,127,1,184,254,202,254,212,253,66,31,52,58,
+4,74,254,168,254,174,255,254,241,4,184,251,238,1,1,1,17,1,7,249,0,0,3,0,143,
+255,236,8,121,5,182,0,23,0,34,0,43,0,0,1,35,17,6,35,32,17,16,0,51,33,50,18,
+19,33,19,35,34,38,39,35,2,33,33,5,50,54,55,17,35,34,2,17,20,18,1,17,51,50,
+18,17,16,38,35,4,88,207,172,203,254,125,1,28,247,2,207,193,207,7,1,72,41,
+39,70,94,12,154,25,254,144,254,217,253,195,52,86,42,29,175,189,113,3,91,82,
+123,117,114,117,5,47,251,176,243,2,147,1,127,1,184,254,222,254,239,254,193,
+104,80,253,154,31,52,58,4,74,254,168,254,174,255,254,241,4,184,251,238,1,
+1,1,17,1,7,249,0,3,0,123,255,94,7,166,5,182,0,38,0,49,0,63,0,0,1,32,17,20,
+6,7,1,33,54,54,51,51,7,23,35,34,38,39,33,53,1,35,34,38,53,55,55,35,17,6,6,
+35,34,38,53,52,54,54,51,3,50,54,55,17,35,34,6,21,20,22,1,7,7,20,22,51,51,
+62,2,53,52,38,35,5,133,1,125,44,64,254,243,1,74,16,99,57,39,33,33,39,57,98,
+17,253,240,1,2,109,143,156,4,19,207,85,194,121,175,187,122,229,149,129,65,
+97,42,69,156,168,101,3,100,19,4,96,126,59,45,26,11,87,91,5,182,254,224,57,
+166,156,253,108,64,100,229,232,99,63,115,2,114,144,137,68,237,253,176,74,
+88,208,196,142,221,122,253,19,29,34,2,39,181,173,125,135,2,102,215,72,89,
+74,118,90,68,21,78,75,0,3,0,123,0,0,7,2,5,182,0,26,0,37,0,51,0,0,1,17,6,6,
+35,34,38,53,52,54,54,51,33,32,17,20,6,7,1,35,1,35,34,38,53,55,55,1,50,54,
+55,17,35,34,6,21,20,22,1,7,7,20,22,51,51,62,2,53,52,38,35,3,117,85,194,121,
+175,187,122,229,149,3,22,1,125,44,64,254,188,191,1,50,109,143,156,4,19,253,
+170,65,97,42,69,156,168,101,3,100,19,4,96,126,59,45,26,11,87,91,5,47,253,
+176,74,88,208,196,142,221,122,254,224,57,166,156,252,229,2,229,144,137,68,
+237,253,154,29,34,2,39,181,173,125,135,2,102,215,72,89,74,118,90,68,21,78,
+75,0,4,0,123,0,0,7,176,5,182,0,34,0,45,0,59,0,67,0,0,1,17,6,6,35,34,38,53,
+52,54,54,51,33,32,17,20,6,6,3,51,50,22,21,20,6,35,33,53,19,35,34,38,53,55,
+55,1,50,54,55,17,35,34,6,21,20,22,1,7,7,20,22,51,51,62,2,53,52,38,35,19,3,
+51,50,54,53,52,35,3,117,85,194,121,175,187,122,229,149,3,22,1,125,24,41,148,
+109,127,151,185,173,254,129,250,109,143,156,4,19,253,170,65,97,42,69,156,
+168,101,3,100,19,4,96,126,59,45,26,11,87,91,90,109,158,106,105,156,5,47,253,
+176,74,88,208,196,142,221,122,254,224,44,109,122,254,154,135,119,138,149,
+135,2,94,144,137,68,237,253,154,29,34,2,39,181,173,125,135,2,102,215,72,89,
+74,118,90,68,21,78,75,252,98,254,246,71,75,120,0,3,0,123,0,0,6,246,5,182,
+0,22,0,33,0,42,0,0,1,50,22,21,20,6,35,33,17,35,17,1,35,19,6,35,34,38,53,52,
+54,54,51,3,50,54,55,17,35,34,6,21,20,22,1,17,51,50,54,53,52,38,35,5,131,175,
+196,188,171,254,181,207,254,221,191,248,79,87,175,187,122,229,149,129,65,
+97,42,69,156,168,101,3,104,111,102,108,101,91,5,182,183,157,180,199,2,72,
+253,176,253,33,2,86,25,208,196,142,221,122,253,19,29,34,2,39,181,173,125,
+135,2,102,254,64,121,112,102,113,0,3,0,123,0,0,6,246,5,182,0,21,0,32,0,41,
+0,0,1,6,35,34,38,53,52,54,54,51,33,50,22,21,20,6,35,33,17,35,17,35,3,50,54,
+55,17,35,34,6,21,20,22,1,17,51,50,54,53,52,38,35,2,186,100,113,175,187,122,
+229,149,3,20,175,196,188,171,254,181,207,187,204,65,97,42,69,156,168,101,
+3,104,111,102,108,101,91,2,102,41,208,196,142,221,122,183,157,180,199,2,72,
+250,209,2,201,29,34,2,39,181,173,125,135,2,102,254,64,121,112,102,113,0,3,
+0,123,255,92,7,8,5,182,0,38,0,49,0,63,0,0,1,17,6,6,35,34,38,53,52,54,54,51,
+33,32,17,20,6,7,1,33,19,35,34,38,39,33,6,6,35,35,19,33,19,35,34,38,53,55,
+55,1,50,54,55,17,35,34,6,21,20,22,1,7,7,20,22,51,51,62,2,53,52,38,35,3,117,
+85,194,121,175,187,122,229,149,3,22,1,125,44,64,254,243,1,86,41,39,55,96,
+23,253,236,23,94,55,39,41,1,86,250,109,143,156,4,19,253,170,65,97,42,69,156,
+168,101,3,100,19,4,96,126,59,45,26,11,87,91,5,47,253,176,74,88,208,196,142,
+221,122,254,224,57,166,156,253,108,254,213,89,75,76,88,1,43,2,94,144,137,
+68,237,253,154,29,34,2,39,181,173,125,135,2,102,215,72,89,74,118,90,68,21,
+78,75,0,1,0,184,255,236,5,225,5,182,0,30,0,0,1,51,17,20,22,51,50,54,55,17,
+51,17,20,6,35,34,39,2,33,34,38,53,17,51,17,20,22,51,50,54,53,2,240,186,96,
+99,90,94,2,186,198,179,143,88,75,254,239,175,190,187,96,98,93,94,5,182,252,
+224,163,151,146,165,3,35,252,215,220,249,86,254,222,251,226,3,237,252,19,
+163,151,151,167,0,0,1,0,184,255,236,7,119,5,182,0,38,0,0,1,51,17,20,22,51,
+50,54,55,17,51,17,33,19,35,34,38,39,35,21,20,6,35,34,39,2,33,34,38,53,17,
+51,17,20,22,51,50,54,53,2,240,186,96,99,90,94,2,186,1,109,41,39,70,94,12,
+191,198,179,143,88,75,254,239,175,190,187,96,98,93,94,5,182,252,224,163,151,
+146,165,3,35,253,205,254,193,104,80,111,220,249,86,254,222,251,226,3,237,
+252,19,163,151,151,167,0,1,0,123,255,94,6,31,5,182,0,47,0,0,1,6,35,34,38,
+39,2,33,34,38,53,17,51,17,20,22,51,50,54,53,17,51,21,20,22,51,50,54,53,53,
+51,21,20,7,1,33,54,54,51,51,7,23,35,34,38,39,33,53,4,102,20,39,79,104,48,
+75,254,238,176,188,186,95,100,92,94,187,95,99,93,93,187,47,254,172,1,43,16,
+99,57,39,33,33,39,57,98,17,254,20,2,250,4,38,48,254,221,252,225,1,176,254,
+80,161,152,149,162,1,178,227,161,152,151,160,229,235,143,111,252,186,64,100,
+229,232,99,63,115,0,0,1,0,164,0,0,5,205,5,182,0,34,0,0,33,1,7,35,34,39,2,
+33,34,38,53,17,51,17,20,22,51,50,54,53,17,51,21,20,22,51,50,54,53,53,51,21,
+20,7,1,3,84,1,49,24,25,143,88,75,254,238,176,188,186,95,100,92,94,187,95,
+99,93,93,187,47,254,116,2,248,2,86,254,221,252,225,1,176,254,80,161,152,149,
+162,1,178,227,165,148,151,160,229,235,143,111,252,51,0,0,2,0,164,0,0,6,84,
+5,182,0,42,0,50,0,0,1,6,35,34,39,2,33,34,38,53,17,51,17,20,22,51,50,54,53,
+17,51,21,20,22,51,50,54,53,53,51,21,20,7,3,51,50,22,21,20,6,35,33,53,1,3,
+51,50,54,53,52,35,4,141,24,33,143,88,75,254,238,176,188,186,95,100,92,94,
+187,95,99,93,93,187,47,181,84,129,150,185,173,254,155,1,41,106,131,106,105,
+156,2,252,6,86,254,221,252,225,1,176,254,80,161,152,149,162,1,178,227,165,
+148,151,160,229,235,143,111,254,80,138,116,138,149,115,1,30,254,246,71,75,
+120,0,1,0,82,0,0,6,207,5,182,0,34,0,0,1,51,21,20,22,51,50,54,53,53,51,21,
+20,6,35,34,39,2,33,34,39,1,35,1,38,53,17,51,17,20,22,51,50,54,53,3,221,187,
+95,99,93,93,187,198,179,143,88,75,254,238,155,90,254,243,190,1,100,16,186,
+95,100,92,94,5,182,227,161,152,151,160,229,235,220,249,86,254,221,96,253,
+119,3,92,71,99,1,176,254,80,161,152,149,162,0,1,0,164,0,0,5,205,5,182,0,33,
+0,0,1,51,21,20,22,51,50,54,53,53,51,21,20,6,35,34,39,1,35,19,6,35,34,38,53,
+17,51,17,20,22,51,50,54,53,2,219,187,95,99,93,93,187,198,179,128,85,254,168,
+191,230,19,43,176,188,186,95,100,92,94,5,182,227,165,148,151,160,229,235,
+217,252,69,252,197,2,45,4,252,225,1,176,254,80,161,152,149,162,0,1,0,164,
+255,92,5,233,5,182,0,46,0,0,5,19,33,1,7,35,34,39,2,33,34,38,53,17,51,17,20,
+22,51,50,54,53,17,51,21,20,22,51,50,54,53,53,51,21,20,7,1,33,19,35,34,38,
+39,33,6,6,35,2,4,41,1,86,1,2,24,25,143,88,75,254,238,176,188,186,95,100,92,
+94,187,95,99,93,93,187,47,254,164,1,127,40,38,55,97,23,253,195,19,96,57,164,
+1,43,2,113,2,86,254,221,252,225,1,176,254,80,161,152,149,162,1,178,227,165,
+148,151,160,229,235,143,111,252,186,254,213,88,76,70,94,0,0,1,0,102,255,92,
+3,238,5,182,0,31,0,0,33,34,38,53,52,18,55,62,2,53,51,20,2,7,6,6,21,20,22,
+51,51,54,54,51,51,7,23,35,34,38,39,2,55,237,228,179,227,82,97,44,189,153,
+157,166,155,137,141,228,20,96,56,39,33,33,39,56,98,18,172,184,173,1,27,183,
+67,140,149,111,189,254,221,118,126,248,134,117,104,69,95,229,234,97,67,0,
+0,1,0,102,0,0,4,176,5,182,0,29,0,0,1,35,34,38,53,52,54,55,54,54,53,51,20,
+6,7,6,6,21,20,22,51,33,19,35,34,38,39,35,17,35,2,137,82,240,225,175,190,129,
+135,189,174,160,159,138,136,142,2,80,41,39,54,95,23,153,187,1,139,132,151,
+120,203,101,69,173,118,147,249,83,81,138,80,82,72,254,213,90,74,254,117,0,
+0,1,0,102,255,236,4,37,5,182,0,26,0,0,5,32,17,52,18,55,62,2,53,51,20,2,7,
+6,6,21,20,22,51,50,54,53,53,51,21,16,2,57,254,45,173,233,82,96,45,189,152,
+158,168,153,147,133,150,153,189,20,1,120,170,1,20,187,67,141,150,115,189,
+254,216,119,128,243,131,116,125,170,161,78,59,254,27,0,0,1,0,102,0,0,5,12,
+5,182,0,32,0,0,1,34,6,3,35,34,38,53,52,18,55,62,2,53,51,20,2,7,6,6,21,20,
+22,51,18,54,51,51,19,35,34,38,4,57,167,146,12,189,237,228,173,233,82,96,45,
+168,141,148,168,153,139,143,29,233,242,176,41,39,54,95,1,246,226,254,236,
+172,184,170,1,20,187,67,141,150,115,203,254,223,112,128,243,131,114,107,1,
+11,235,254,213,90,0,2,0,102,0,0,4,205,5,182,0,31,0,43,0,0,33,34,38,53,52,
+18,55,62,2,53,51,20,2,7,6,6,21,20,22,51,38,53,52,54,51,50,22,21,20,6,35,17,
+34,6,21,20,22,51,50,54,53,52,38,2,55,237,228,173,233,82,96,45,168,141,148,
+168,153,137,141,47,183,171,171,184,189,166,80,92,92,80,80,93,91,172,184,170,
+1,20,187,67,141,150,115,203,254,223,112,128,243,131,117,104,69,95,137,146,
+145,138,139,160,1,207,89,77,79,103,103,79,77,89,0,1,0,184,255,92,4,4,5,182,
+0,35,0,0,33,34,38,38,53,53,16,18,36,51,51,19,35,34,38,39,35,34,2,17,21,20,
+22,22,51,51,54,54,51,51,7,23,35,34,38,39,2,174,208,203,91,119,1,1,212,215,
+41,39,54,95,23,45,208,193,55,123,143,125,21,97,54,39,33,33,39,54,98,20,85,
+195,181,139,1,64,1,111,175,254,213,90,74,254,170,254,129,162,122,128,55,72,
+92,229,234,93,71,0,0,2,0,184,255,92,4,221,5,182,0,40,0,52,0,0,1,34,38,53,
+52,55,6,2,17,21,20,22,22,51,51,54,54,51,51,7,23,35,34,38,39,35,34,38,38,53,
+53,16,18,36,51,51,50,22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,3,123,165,
+189,14,94,86,55,125,139,127,25,94,53,39,33,33,39,54,95,23,131,206,205,91,
+119,1,1,212,119,173,181,186,168,79,93,95,77,77,95,93,3,113,164,135,62,40,
+62,254,194,254,212,162,122,129,54,76,88,229,234,90,74,86,196,177,141,1,64,
+1,111,175,144,138,138,161,1,206,88,77,81,102,102,81,77,88,0,1,0,102,0,0,5,
+12,6,14,0,42,0,0,1,50,22,23,33,54,54,51,51,3,33,6,7,6,6,21,20,22,51,18,54,
+51,51,19,35,34,38,39,34,6,3,35,34,38,53,52,54,54,55,54,55,33,3,1,18,57,97,
+18,2,121,22,98,54,39,41,254,138,54,213,168,153,139,143,29,233,242,176,41,
+39,54,95,23,167,146,12,189,237,228,75,162,169,148,46,254,86,40,6,14,95,69,
+74,90,254,213,233,160,128,243,131,114,107,1,11,235,254,213,90,74,226,254,
+236,172,184,115,190,190,138,124,138,1,43,0,0,1,0,184,0,0,4,57,6,20,0,20,0,
+0,33,17,52,38,35,34,6,21,17,35,17,52,18,55,17,51,17,22,18,21,17,3,127,127,
+131,136,130,187,180,175,186,175,181,2,227,193,176,173,194,253,27,2,219,234,
+1,17,28,1,34,254,220,27,254,242,232,253,33,0,0,1,0,184,0,0,5,207,6,20,0,28,
+0,0,33,35,17,52,38,35,34,6,21,17,35,17,52,18,55,17,51,17,22,18,21,21,33,19,
+35,34,38,39,35,4,57,186,127,131,136,130,187,180,175,186,175,181,1,109,41,
+39,70,94,12,191,2,227,193,176,173,194,253,27,2,219,234,1,17,28,1,34,254,220,
+27,254,242,232,6,254,193,104,80,0,0,1,0,184,255,92,5,227,6,20,0,31,0,0,1,
+52,38,35,34,6,21,17,35,17,52,18,55,17,51,17,22,18,21,17,51,54,54,51,51,7,
+23,35,34,38,39,33,3,127,127,131,136,130,187,180,175,186,175,181,215,21,97,
+54,39,32,32,39,54,98,20,254,111,2,227,193,176,173,194,253,27,2,219,234,1,
+17,28,1,34,254,220,27,254,242,232,253,168,72,92,229,234,93,71,0,0,1,0,164,
+0,0,4,37,6,20,0,20,0,0,33,17,52,38,35,34,6,21,17,35,53,52,18,55,17,51,17,
+22,18,21,17,3,106,127,131,136,130,186,180,174,187,175,181,2,227,193,176,174,
+193,255,0,246,237,1,14,28,1,34,254,220,27,254,242,232,253,33,0,2,0,184,0,
+0,6,12,6,20,0,27,0,35,0,0,33,17,52,38,35,34,6,21,17,35,17,52,18,55,17,51,
+17,22,18,21,21,51,50,22,21,20,6,35,3,17,51,50,54,53,52,35,3,127,127,131,136,
+130,187,180,175,186,175,181,189,128,150,185,173,109,74,106,105,156,2,227,
+193,176,173,194,253,27,2,219,234,1,17,28,1,34,254,220,27,254,242,232,194,
+136,118,138,149,1,145,254,246,71,75,120,0,1,0,184,0,0,4,57,6,20,0,20,0,0,
+33,17,52,38,35,34,6,21,17,35,17,52,18,55,3,51,19,22,18,21,17,3,127,127,131,
+136,130,187,168,162,135,203,133,180,186,2,227,193,176,173,194,253,27,2,219,
+225,1,15,33,1,40,254,222,27,254,246,238,253,33,0,0,1,0,184,0,0,4,57,6,20,
+0,20,0,0,1,53,52,38,35,34,6,21,17,35,17,52,18,55,17,51,17,22,18,21,21,3,127,
+127,131,136,130,187,180,175,186,175,181,1,229,254,193,176,173,194,253,27,
+2,219,234,1,17,28,1,34,254,220,27,254,242,232,250,0,0,1,0,123,255,92,5,133,
+6,20,0,32,0,0,23,19,33,17,52,38,35,34,6,21,17,35,53,52,18,55,17,51,17,22,
+18,21,17,33,19,35,34,38,39,33,6,6,35,123,41,2,198,127,131,136,130,186,180,
+174,187,175,181,1,55,41,39,55,96,23,252,158,23,94,55,164,1,43,2,92,193,176,
+174,193,255,0,246,237,1,14,28,1,34,254,220,27,254,242,232,253,168,254,213,
+89,75,76,88,0,0,1,0,162,0,0,4,80,6,184,0,42,0,0,33,17,52,38,35,34,6,21,17,
+35,17,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,
+38,39,35,21,22,18,21,17,3,127,127,131,136,130,187,180,175,166,19,93,60,39,
+33,33,39,59,93,20,2,8,17,93,62,39,33,33,39,62,94,16,168,175,181,2,227,193,
+176,173,194,253,27,2,219,234,1,17,28,196,62,81,201,200,80,63,60,83,200,201,
+85,58,198,27,254,242,232,253,33,0,1,0,162,0,0,5,207,6,184,0,50,0,0,33,35,
+17,52,38,35,34,6,21,17,35,17,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,
+54,54,51,51,7,23,35,34,38,39,35,21,22,18,21,21,33,19,35,34,38,39,35,4,57,
+186,127,131,136,130,187,180,175,166,19,93,60,39,33,33,39,59,93,20,2,8,17,
+93,62,39,33,33,39,62,94,16,168,175,181,1,109,41,39,70,94,12,191,2,227,193,
+176,173,194,253,27,2,219,234,1,17,28,196,62,81,201,200,80,63,60,83,200,201,
+85,58,198,27,254,242,232,6,254,193,104,80,0,1,0,162,255,92,5,227,6,184,0,
+53,0,0,1,7,23,35,34,38,39,35,21,22,18,21,17,51,54,54,51,51,7,23,35,34,38,
+39,33,17,52,38,35,34,6,21,17,35,17,52,18,55,53,35,6,6,35,35,55,39,51,50,22,
+23,33,54,54,51,4,80,33,33,39,62,94,16,168,175,181,215,21,97,54,39,32,32,39,
+54,98,20,254,111,127,131,136,130,187,180,175,166,19,93,60,39,33,33,39,59,
+93,20,2,8,17,93,62,6,184,200,201,85,58,198,27,254,242,232,253,168,72,92,229,
+234,93,71,2,227,193,176,173,194,253,27,2,219,234,1,17,28,196,62,81,201,200,
+80,63,60,83,0,0,1,0,141,0,0,4,59,6,184,0,42,0,0,33,17,52,38,35,34,6,21,17,
+35,53,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,
+38,39,35,21,22,18,21,17,3,106,127,131,136,130,186,180,174,166,17,95,60,39,
+33,33,39,59,96,17,2,8,21,92,59,39,32,32,39,60,92,20,167,175,181,2,227,193,
+176,174,193,255,0,246,237,1,14,28,196,60,83,201,200,82,61,66,77,200,201,79,
+64,198,27,254,242,232,253,33,0,0,2,0,162,0,0,6,12,6,184,0,49,0,57,0,0,1,7,
+23,35,34,38,39,35,21,22,18,21,21,51,50,22,21,20,6,35,33,17,52,38,35,34,6,
+21,17,35,17,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,19,17,
+51,50,54,53,52,35,4,80,33,33,39,62,94,16,168,175,181,189,128,150,185,173,
+254,217,127,131,136,130,187,180,175,166,19,93,60,39,33,33,39,59,93,20,2,8,
+17,93,62,16,74,106,105,156,6,184,200,201,85,58,198,27,254,242,232,194,136,
+118,138,149,2,227,193,176,173,194,253,27,2,219,234,1,17,28,196,62,81,201,
+200,80,63,60,83,250,217,254,246,71,75,120,0,1,0,82,0,0,4,80,6,184,0,42,0,
+0,33,17,52,38,35,34,6,21,17,35,17,52,18,55,39,35,6,6,35,35,55,39,51,50,22,
+23,33,54,54,51,51,7,23,35,34,38,39,35,23,22,18,21,17,3,150,128,131,136,130,
+186,168,162,93,151,19,93,60,39,33,33,39,59,93,20,2,8,21,92,59,39,33,33,39,
+60,92,20,166,90,181,186,2,227,193,176,174,193,253,27,2,219,227,1,12,34,202,
+62,81,201,200,80,63,66,77,200,201,79,64,196,27,254,247,239,253,33,0,1,0,162,
+0,0,4,80,6,184,0,42,0,0,1,53,52,38,35,34,6,21,17,35,17,52,18,55,53,35,6,6,
+35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,21,22,18,21,21,
+3,127,127,131,136,130,187,180,175,166,19,93,60,39,33,33,39,59,93,20,2,8,17,
+93,62,39,33,33,39,62,94,16,168,175,181,1,229,254,193,176,173,194,253,27,2,
+219,234,1,17,28,196,62,81,201,200,80,63,60,83,200,201,85,58,198,27,254,242,
+232,250,0,1,0,141,255,92,5,133,6,184,0,54,0,0,23,19,33,17,52,38,35,34,6,21,
+17,35,53,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,
+34,38,39,35,21,22,18,21,17,33,19,35,34,38,39,33,6,6,35,143,41,2,178,127,131,
+136,130,186,180,174,166,17,95,60,39,33,33,39,59,96,17,2,29,17,93,62,39,33,
+33,39,62,94,16,188,175,181,1,55,41,39,55,96,23,252,178,19,96,57,164,1,43,
+2,92,193,176,174,193,255,0,246,237,1,14,28,196,60,83,201,200,82,61,60,83,
+200,201,85,58,198,27,254,242,232,253,168,254,213,89,75,70,94,0,3,0,102,0,
+0,4,240,5,182,0,17,0,25,0,32,0,0,33,35,17,34,38,53,52,54,51,17,51,17,50,22,
+21,20,6,35,3,34,6,21,20,22,22,51,51,50,54,53,52,38,35,3,8,186,238,250,243,
+245,186,243,245,254,234,186,154,151,62,134,109,186,158,147,150,155,1,233,
+163,165,172,156,1,61,254,195,159,169,161,167,2,9,88,103,77,78,39,88,104,101,
+92,0,0,3,0,102,0,0,4,240,5,182,0,25,0,33,0,40,0,0,1,19,35,34,38,39,35,21,
+35,17,34,38,53,52,54,51,17,51,17,50,22,21,20,6,35,21,3,34,6,21,20,22,22,51,
+51,50,54,53,52,38,35,4,117,41,39,68,96,12,191,186,238,250,243,245,186,243,
+245,254,234,186,154,151,62,134,109,186,158,147,150,155,1,125,254,192,104,
+81,246,1,233,163,165,172,156,1,61,254,195,159,169,161,167,108,2,117,88,103,
+77,78,39,88,104,101,92,0,0,3,0,102,255,92,4,240,5,182,0,28,0,36,0,43,0,0,
+1,50,22,21,20,6,35,17,51,54,54,51,51,7,23,35,34,38,39,33,17,34,38,53,52,54,
+51,17,51,3,34,6,21,20,22,22,51,51,50,54,53,52,38,35,3,8,243,245,254,234,246,
+17,99,56,39,33,33,39,56,100,16,254,80,238,250,243,245,186,186,154,151,62,
+134,109,186,158,147,150,155,4,119,159,169,161,167,254,160,67,97,229,234,98,
+66,1,231,163,165,172,156,1,63,254,58,88,103,77,78,39,88,104,101,92,0,3,0,
+82,255,92,5,6,5,182,0,29,0,37,0,44,0,0,33,35,6,6,35,35,19,51,50,54,54,53,
+34,38,53,52,54,51,17,51,17,50,22,21,20,6,35,14,2,19,34,6,21,20,22,22,51,51,
+50,54,53,52,38,35,1,70,33,23,94,55,39,41,196,116,123,54,238,249,243,244,187,
+242,245,251,236,3,93,201,110,154,151,62,134,109,187,158,147,150,155,76,88,
+1,43,64,145,145,162,166,173,155,1,61,254,195,157,171,161,167,187,208,94,3,
+242,88,103,77,78,39,88,104,101,92,0,4,0,102,0,0,4,240,5,182,0,23,0,31,0,38,
+0,47,0,0,1,51,50,22,21,20,6,35,33,17,32,17,52,54,51,53,51,21,50,22,21,20,
+6,35,3,34,6,21,20,22,22,51,51,50,54,53,52,38,35,17,21,51,50,54,53,52,38,35,
+3,8,191,138,140,172,186,254,215,254,24,243,245,186,247,241,252,236,186,154,
+151,62,134,109,186,158,147,150,155,76,122,89,62,94,1,223,116,111,128,124,
+2,113,1,71,172,156,182,182,160,168,160,167,2,8,88,103,77,78,39,88,104,101,
+92,252,219,205,47,64,51,43,0,3,0,102,0,0,4,240,6,184,0,23,0,31,0,38,0,0,1,
+50,22,21,20,6,35,17,35,17,34,38,53,52,54,51,17,33,3,51,50,22,23,33,3,34,6,
+21,20,22,22,51,51,50,54,53,52,38,35,3,8,243,245,254,234,186,238,250,243,245,
+254,158,41,38,60,88,18,1,121,186,154,151,62,134,109,186,158,147,150,155,4,
+121,159,169,161,167,254,23,1,233,163,165,172,156,1,61,1,2,80,63,253,201,88,
+103,77,78,39,88,104,101,92,0,0,4,0,102,0,0,4,240,6,41,0,31,0,39,0,46,0,56,
+0,0,1,38,38,53,52,54,51,50,22,21,20,7,6,6,21,21,50,22,21,20,6,35,17,35,17,
+34,38,53,52,54,51,54,7,34,6,21,20,22,22,51,51,50,54,53,52,38,35,3,34,6,21,
+20,23,54,53,52,38,2,113,99,129,159,128,130,153,102,57,32,244,244,254,234,
+186,238,250,241,247,6,6,154,151,62,134,109,186,158,147,150,155,94,45,57,133,
+71,51,4,35,17,138,95,122,146,131,113,127,104,58,52,17,4,159,167,161,167,254,
+195,1,61,163,165,168,158,48,181,88,103,77,78,39,88,104,101,92,2,88,68,49,
+109,36,66,85,51,60,0,0,4,0,102,0,0,5,135,5,182,0,31,0,39,0,46,0,58,0,0,37,
+34,38,53,52,55,35,17,35,17,34,38,53,52,54,51,53,51,21,50,22,21,20,6,35,21,
+33,50,22,21,20,6,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,1,34,6,21,20,
+22,51,50,54,53,52,38,4,121,125,146,19,117,186,238,250,240,248,186,247,241,
+254,234,1,113,133,137,145,253,88,154,151,60,132,113,186,155,150,150,155,1,
+113,52,59,60,51,50,60,59,72,121,106,52,44,254,117,2,80,163,165,170,157,215,
+215,160,167,161,167,82,110,101,108,119,4,16,88,102,76,79,40,88,105,101,91,
+253,57,54,48,55,66,63,58,48,54,0,3,0,102,0,0,7,55,5,182,0,30,0,38,0,45,0,
+0,1,34,38,39,35,53,35,6,6,35,17,35,17,34,38,53,52,54,51,17,51,17,50,22,23,
+51,53,51,17,51,19,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,7,16,66,98,12,
+211,164,25,243,213,186,238,250,243,245,186,215,242,24,164,187,198,41,251,
+23,154,151,62,134,109,186,158,147,150,155,1,127,103,81,187,130,135,254,23,
+1,233,163,165,172,156,1,61,254,195,124,132,168,254,157,254,193,2,115,88,103,
+77,78,39,88,104,101,92,0,3,0,102,0,0,4,240,5,182,0,27,0,35,0,42,0,0,55,19,
+33,53,34,38,53,52,54,51,53,51,21,50,22,21,20,6,35,21,33,17,35,17,33,6,6,35,
+1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,174,41,1,119,238,250,240,248,186,
+247,241,254,234,1,146,187,253,162,21,95,56,1,121,154,151,60,132,113,186,155,
+150,150,155,109,1,43,184,163,165,170,157,215,215,160,167,161,167,184,254,
+104,1,16,74,89,3,235,88,102,76,79,40,88,105,101,91,0,4,0,102,255,72,4,240,
+6,41,0,30,0,38,0,45,0,54,0,0,33,6,6,35,35,19,33,17,34,38,53,52,54,51,17,51,
+17,50,22,21,20,6,35,21,51,50,22,21,20,6,35,1,34,6,21,20,22,22,51,51,50,54,
+53,52,38,35,17,21,51,50,54,53,52,38,35,1,156,12,99,65,39,41,1,96,238,250,
+240,248,186,247,241,254,234,191,138,140,172,186,254,215,154,151,60,132,113,
+186,155,150,150,155,76,122,89,62,94,82,102,1,63,1,201,163,165,170,157,1,74,
+254,182,160,167,161,167,113,116,111,128,124,4,88,88,102,76,79,40,88,105,101,
+91,252,252,205,47,64,51,43,0,3,0,102,0,0,7,55,5,182,0,28,0,36,0,43,0,0,1,
+34,38,39,33,6,6,35,17,35,17,34,38,53,52,54,51,17,51,17,50,22,23,51,17,51,
+17,51,19,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,7,16,66,98,12,254,137,
+25,243,213,186,238,250,243,245,186,215,242,24,164,187,198,41,251,23,154,151,
+62,134,109,186,158,147,150,155,2,57,103,82,130,135,254,23,1,233,163,165,172,
+156,1,61,254,195,124,132,1,45,254,211,254,192,1,185,88,103,77,78,39,88,104,
+101,92,0,3,0,102,0,0,4,240,6,184,0,39,0,47,0,54,0,0,1,7,23,35,34,38,39,35,
+17,50,22,21,20,6,35,17,35,17,34,38,53,52,54,51,17,35,6,6,35,35,55,39,51,50,
+22,23,33,54,54,51,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,4,152,33,33,
+39,62,94,16,189,243,245,254,234,186,238,250,243,245,187,17,95,60,38,32,32,
+38,59,96,17,2,50,17,93,62,253,221,154,151,62,134,109,186,158,147,150,155,
+6,184,200,201,85,58,254,195,159,169,161,167,254,23,1,233,163,165,172,156,
+1,61,60,83,201,200,82,61,60,83,253,58,88,103,77,78,39,88,104,101,92,0,3,0,
+102,0,0,4,240,6,184,0,47,0,55,0,62,0,0,1,33,19,35,34,38,39,35,21,35,17,34,
+38,53,52,54,51,17,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,
+38,39,35,17,50,22,21,20,6,35,3,34,6,21,20,22,22,51,51,50,54,53,52,38,35,3,
+8,1,109,41,39,68,96,12,191,186,238,250,243,245,187,17,95,60,38,32,32,38,59,
+96,17,2,50,17,93,62,39,33,33,39,62,94,16,189,243,245,254,234,186,154,151,
+62,134,109,186,158,147,150,155,1,125,254,192,104,81,246,2,18,163,165,172,
+156,1,20,60,83,201,200,82,61,60,83,200,201,85,58,254,236,159,169,161,167,
+2,9,88,103,77,78,39,88,104,101,92,0,0,3,0,102,255,92,4,240,6,184,0,50,0,58,
+0,65,0,0,1,7,23,35,34,38,39,35,17,50,22,21,20,6,35,17,51,54,54,51,51,7,23,
+35,34,38,39,33,17,34,38,53,52,54,51,17,35,6,6,35,35,55,39,51,50,22,23,33,
+54,54,51,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,4,152,33,33,39,62,94,
+16,189,243,245,254,234,215,21,97,54,39,33,33,39,54,98,20,254,111,238,250,
+243,245,187,17,95,60,38,32,32,38,59,96,17,2,50,17,93,62,253,221,154,151,62,
+134,109,186,158,147,150,155,6,184,200,201,85,58,254,236,159,169,161,167,254,
+117,72,92,229,234,93,71,2,18,163,165,172,156,1,20,60,83,201,200,82,61,60,
+83,253,99,88,103,77,78,39,88,104,101,92,0,0,3,0,82,255,92,5,4,6,184,0,51,
+0,59,0,66,0,0,1,7,23,35,34,38,39,35,17,50,22,21,20,6,35,14,2,35,35,6,6,35,
+35,19,51,50,54,54,53,34,38,53,52,54,51,17,35,6,6,35,35,55,39,51,50,22,23,
+33,54,54,51,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,4,168,33,33,39,60,
+92,20,184,242,245,251,236,3,93,201,174,33,23,94,55,39,41,196,115,122,54,238,
+249,243,244,190,19,93,60,39,33,33,39,59,93,20,2,49,21,92,59,253,225,154,151,
+62,134,109,187,158,147,149,156,6,184,200,201,79,64,254,195,157,171,161,167,
+189,206,94,76,88,1,43,63,144,147,162,166,173,155,1,61,62,81,201,200,80,63,
+66,77,253,58,88,103,77,78,39,88,104,100,93,0,4,0,102,0,0,4,240,6,184,0,46,
+0,54,0,61,0,70,0,0,1,7,23,35,34,38,39,35,21,50,22,21,20,6,35,21,51,50,22,
+21,20,6,35,33,17,34,38,53,52,54,51,53,35,6,6,35,35,55,39,51,50,22,23,33,54,
+54,51,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,17,21,51,50,54,53,52,38,
+35,4,152,33,33,39,62,94,16,189,247,241,254,234,191,138,140,172,186,254,215,
+238,250,240,248,187,17,95,60,38,32,32,38,59,96,17,2,50,17,93,62,253,221,154,
+151,60,132,113,186,155,150,150,155,76,122,89,62,94,6,184,200,201,85,58,215,
+160,167,161,167,113,116,111,128,124,2,80,163,165,170,157,215,60,83,201,200,
+82,61,60,83,253,160,88,102,76,79,40,88,105,101,91,252,252,205,47,64,51,43,
+0,0,3,0,102,0,0,5,238,6,184,0,46,0,54,0,61,0,0,1,7,23,35,34,38,39,35,20,22,
+51,51,21,50,22,21,20,6,35,17,35,17,32,17,52,54,51,53,46,2,53,35,6,6,35,35,
+55,39,51,50,22,23,33,54,54,51,3,34,6,21,20,22,22,51,51,50,54,53,52,38,35,
+4,61,32,32,38,60,93,20,188,86,100,158,247,241,252,236,186,254,24,243,245,
+133,142,69,187,17,95,60,39,33,33,39,59,96,17,2,49,20,93,60,203,154,151,62,
+134,109,186,158,147,150,155,6,184,200,201,80,63,123,110,248,160,168,160,167,
+254,186,1,70,1,71,172,156,100,8,81,161,131,60,83,201,200,82,61,64,79,252,
+150,88,103,77,78,39,88,104,101,92,0,0,4,0,100,0,0,4,240,6,184,0,52,0,60,0,
+67,0,77,0,0,1,50,22,21,20,6,35,17,35,17,32,17,52,54,55,53,52,55,38,38,53,
+52,55,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,22,
+21,20,7,7,6,21,7,34,6,21,20,22,22,51,51,50,54,53,52,38,35,3,34,6,21,20,23,
+54,53,52,38,3,8,247,241,252,236,186,254,24,238,250,37,99,129,43,131,17,95,
+60,39,33,33,39,59,96,17,2,213,21,92,59,39,33,33,39,60,92,20,102,35,102,48,
+43,186,154,151,62,134,109,186,158,147,150,155,92,45,57,133,71,51,3,172,160,
+168,160,167,254,227,1,29,1,71,167,159,2,8,60,51,17,138,95,87,66,60,83,201,
+200,82,61,66,77,200,201,79,64,58,71,125,106,51,47,50,149,88,103,77,78,39,
+88,104,101,92,2,121,68,49,109,36,66,85,51,60,0,4,0,102,0,0,5,94,6,184,0,53,
+0,61,0,68,0,80,0,0,1,7,23,35,34,38,39,35,21,50,22,21,20,6,35,21,33,50,22,
+21,20,6,35,34,38,53,52,55,35,17,35,17,34,38,53,52,54,51,53,35,6,6,35,35,55,
+39,51,50,22,23,33,54,54,51,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,1,34,
+6,21,20,22,51,50,54,53,52,38,4,152,33,33,39,62,94,16,189,247,241,254,234,
+1,72,133,137,145,125,126,144,18,76,186,238,250,240,248,187,17,95,60,38,32,
+32,38,59,96,17,2,50,17,93,62,253,221,154,151,60,132,113,186,155,150,150,155,
+1,72,52,59,60,51,50,60,59,6,184,200,201,85,58,215,160,167,161,167,82,110,
+101,108,119,122,105,54,42,254,117,2,80,163,165,170,157,215,60,83,201,200,
+82,61,60,83,253,160,88,102,76,79,40,88,105,101,91,253,57,54,48,55,66,63,58,
+48,54,0,3,0,102,0,0,7,55,6,184,0,52,0,60,0,67,0,0,1,35,6,6,35,17,35,17,34,
+38,53,52,54,51,17,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,
+38,39,35,17,50,22,23,51,53,51,17,51,19,35,34,38,39,35,1,34,6,21,20,22,22,
+51,51,50,54,53,52,38,35,5,141,164,25,243,213,186,238,250,243,245,187,17,95,
+60,38,32,32,38,59,96,17,2,50,17,93,62,39,33,33,39,62,94,16,189,215,242,24,
+164,187,198,41,39,66,98,12,211,252,193,154,151,62,134,109,186,158,147,150,
+155,2,242,130,135,254,23,1,233,163,165,172,156,1,61,60,83,201,200,82,61,60,
+83,200,201,85,58,254,195,124,132,168,254,157,254,193,103,81,1,187,88,103,
+77,78,39,88,104,101,92,0,0,3,0,102,0,0,4,240,6,184,0,49,0,57,0,64,0,0,1,7,
+23,35,34,38,39,35,21,50,22,21,20,6,35,21,33,17,35,17,33,6,6,35,35,19,33,53,
+34,38,53,52,54,51,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,1,34,6,21,
+20,22,22,51,51,50,54,53,52,38,35,4,152,33,33,39,62,94,16,189,247,241,254,
+234,1,146,187,253,183,21,95,57,38,41,1,98,238,250,240,248,187,17,95,60,38,
+32,32,38,59,96,17,2,50,17,93,62,253,221,154,151,60,132,113,186,155,150,150,
+155,6,184,200,201,85,58,215,160,167,161,167,184,254,104,1,16,71,92,1,43,184,
+163,165,170,157,215,60,83,201,200,82,61,60,83,253,160,88,102,76,79,40,88,
+105,101,91,0,0,4,0,102,255,72,4,240,6,184,0,52,0,60,0,67,0,76,0,0,1,7,23,
+35,34,38,39,35,21,50,22,21,20,6,35,21,51,50,22,21,20,6,35,33,6,6,35,35,19,
+33,17,34,38,53,52,54,51,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,1,34,
+6,21,20,22,22,51,51,50,54,53,52,38,35,17,21,51,50,54,53,52,38,35,4,152,33,
+33,39,62,94,16,189,247,241,254,234,191,138,140,172,186,254,37,12,99,65,39,
+41,1,96,238,250,240,248,187,17,95,60,38,32,32,38,59,96,17,2,50,17,93,62,253,
+221,154,151,60,132,113,186,155,150,150,155,76,122,89,62,94,6,184,200,201,
+85,58,215,160,167,161,167,113,116,111,128,124,82,102,1,63,1,201,163,165,170,
+157,215,60,83,201,200,82,61,60,83,253,160,88,102,76,79,40,88,105,101,91,252,
+252,205,47,64,51,43,0,3,0,102,0,0,7,55,6,184,0,50,0,58,0,65,0,0,1,34,38,39,
+33,6,6,35,17,35,17,34,38,53,52,54,51,17,35,6,6,35,35,55,39,51,50,22,23,33,
+54,54,51,51,7,23,35,34,38,39,35,17,50,22,23,51,17,51,17,51,19,1,34,6,21,20,
+22,22,51,51,50,54,53,52,38,35,7,16,66,98,12,254,137,25,243,213,186,238,250,
+243,245,187,17,95,60,38,32,32,38,59,96,17,2,50,17,93,62,39,33,33,39,62,94,
+16,189,215,242,24,164,187,198,41,251,23,154,151,62,134,109,186,158,147,150,
+155,2,57,103,82,130,135,254,23,1,233,163,165,172,156,1,61,60,83,201,200,82,
+61,60,83,200,201,85,58,254,195,124,132,1,45,254,211,254,192,1,185,88,103,
+77,78,39,88,104,101,92,0,0,1,0,184,0,0,4,57,5,201,0,17,0,0,33,17,52,38,35,
+34,6,21,17,35,17,16,18,51,50,18,17,17,3,127,127,131,136,130,187,225,218,222,
+232,3,180,193,176,173,194,252,74,3,172,1,6,1,23,254,242,254,245,252,80,0,
+0,1,0,184,0,0,5,207,5,201,0,25,0,0,1,33,19,35,34,38,39,35,17,35,17,52,38,
+35,34,6,21,17,35,17,16,18,51,50,18,17,4,57,1,109,41,39,70,94,12,191,186,127,
+131,136,130,187,225,218,222,232,2,217,254,193,104,80,253,174,3,180,193,176,
+173,194,252,74,3,172,1,6,1,23,254,242,254,245,0,1,0,184,255,92,5,215,5,201,
+0,28,0,0,1,52,38,35,34,6,21,17,35,17,16,18,51,50,18,17,17,51,54,54,51,51,
+7,23,35,34,38,39,33,3,127,127,131,136,130,187,225,218,222,232,203,21,97,54,
+39,33,33,39,54,98,20,254,123,3,180,193,176,173,194,252,74,3,172,1,6,1,23,
+254,242,254,245,252,215,72,92,229,234,93,71,0,0,1,0,164,0,0,4,37,5,201,0,
+17,0,0,33,17,52,38,35,34,6,21,17,35,17,16,18,51,50,18,17,17,3,106,127,131,
+136,130,186,225,217,223,232,3,180,193,176,174,193,254,47,1,199,1,6,1,23,254,
+241,254,246,252,80,0,0,2,0,184,0,0,6,12,5,201,0,24,0,32,0,0,1,52,38,35,34,
+6,21,17,35,17,16,18,51,50,18,17,17,51,50,22,21,20,6,35,33,19,17,51,50,54,
+53,52,35,3,127,127,131,136,130,187,225,218,222,232,189,128,150,185,173,254,
+217,186,74,106,105,156,3,180,193,176,173,194,252,74,3,172,1,6,1,23,254,242,
+254,245,254,109,136,118,138,149,1,145,254,246,71,75,120,0,0,1,0,82,0,0,5,
+104,5,201,0,25,0,0,33,17,52,38,35,34,6,21,17,35,17,35,6,6,35,35,19,33,53,
+16,18,51,50,18,17,17,4,174,127,131,136,130,187,194,22,94,56,39,41,1,108,227,
+216,222,232,3,180,193,176,173,194,252,74,2,82,76,88,1,43,211,1,7,1,22,254,
+242,254,245,252,80,0,1,0,184,0,0,4,57,5,201,0,17,0,0,1,17,52,38,35,34,6,21,
+17,35,17,16,18,51,50,18,17,17,3,127,127,131,136,130,187,225,218,222,232,1,
+229,1,207,193,176,173,194,252,74,3,172,1,6,1,23,254,242,254,245,254,53,0,
+0,1,0,164,255,92,5,178,5,201,0,29,0,0,23,19,33,17,52,38,35,34,6,21,17,35,
+17,16,18,51,50,18,17,17,33,19,35,34,38,39,33,6,6,35,164,41,2,198,127,131,
+136,130,186,225,217,223,232,1,59,41,39,55,96,23,252,154,23,94,55,164,1,43,
+3,45,193,176,174,193,254,47,1,199,1,6,1,23,254,241,254,246,252,215,254,213,
+89,75,76,88,0,2,0,162,0,0,4,80,6,184,0,21,0,39,0,0,1,7,23,35,34,38,39,33,
+6,6,35,35,55,39,51,50,22,23,33,54,54,51,3,17,52,38,35,34,6,21,17,35,17,16,
+18,51,50,18,17,17,4,80,33,33,39,62,94,16,253,248,19,93,60,39,33,33,39,59,
+93,20,2,8,17,93,62,170,127,131,136,130,187,225,218,222,232,6,184,200,201,
+85,58,62,81,201,200,80,63,60,83,249,72,2,217,193,176,173,194,253,37,2,209,
+1,6,1,23,254,242,254,245,253,43,0,0,2,0,162,0,0,5,207,6,184,0,25,0,47,0,0,
+1,33,19,35,34,38,39,35,17,35,17,52,38,35,34,6,21,17,35,17,16,18,51,50,18,
+17,19,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,4,57,1,
+109,41,39,68,96,12,191,186,127,131,136,130,187,225,218,222,232,23,33,33,39,
+62,94,16,253,248,19,93,60,39,33,33,39,59,93,20,2,8,17,93,62,2,121,254,192,
+104,81,254,14,2,217,193,176,173,194,253,37,2,209,1,6,1,23,254,242,254,245,
+3,227,200,201,85,58,62,81,201,200,80,63,60,83,0,2,0,162,255,92,5,227,6,184,
+0,28,0,50,0,0,1,52,38,35,34,6,21,17,35,17,16,18,51,50,18,17,17,51,54,54,51,
+51,7,23,35,34,38,39,33,19,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,
+33,54,54,51,3,127,127,131,136,130,187,225,218,222,232,215,21,97,54,39,32,
+32,39,54,98,20,254,111,209,33,33,39,62,94,16,253,248,19,93,60,39,33,33,39,
+59,93,20,2,8,17,93,62,2,217,193,176,173,194,253,37,2,209,1,6,1,23,254,242,
+254,245,253,178,72,92,229,234,93,71,6,184,200,201,85,58,62,81,201,200,80,
+63,60,83,0,0,2,0,141,0,0,4,39,6,184,0,21,0,39,0,0,1,7,23,35,34,38,39,33,6,
+6,35,35,55,39,51,50,22,23,33,54,54,51,3,17,52,38,35,34,6,21,21,35,53,16,18,
+51,50,18,17,17,4,39,33,33,39,62,94,16,254,12,17,95,60,39,33,33,39,59,96,17,
+1,244,17,93,62,150,127,131,136,130,186,225,217,223,232,6,184,200,201,85,58,
+60,83,201,200,82,61,60,83,249,72,2,217,193,176,174,193,246,236,1,6,1,23,254,
+241,254,246,253,43,0,0,3,0,162,0,0,6,12,6,184,0,24,0,46,0,54,0,0,33,17,52,
+38,35,34,6,21,17,35,17,16,18,51,50,18,17,21,51,50,22,21,20,6,35,3,7,23,35,
+34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,19,17,51,50,54,53,52,
+35,3,127,127,131,136,130,187,225,218,222,232,189,128,150,185,173,86,33,33,
+39,62,94,16,253,248,19,93,60,39,33,33,39,59,93,20,2,8,17,93,62,16,74,106,
+105,156,2,217,193,176,173,194,253,37,2,209,1,6,1,23,254,242,254,245,184,136,
+118,138,149,6,184,200,201,85,58,62,81,201,200,80,63,60,83,250,217,254,246,
+71,75,120,0,2,0,82,0,0,5,127,6,184,0,25,0,47,0,0,33,17,52,38,35,34,6,21,17,
+35,17,35,6,6,35,35,19,33,53,16,18,51,50,18,17,17,19,7,23,35,34,38,39,33,6,
+6,35,35,55,39,51,50,22,23,33,54,54,51,4,174,127,131,136,130,187,194,22,94,
+56,39,41,1,108,227,216,222,232,23,33,33,39,60,92,20,253,248,19,93,60,39,33,
+33,39,59,93,20,2,8,21,92,59,2,217,193,176,173,194,253,37,1,215,76,88,1,43,
+115,1,7,1,22,254,242,254,245,253,43,6,184,200,201,79,64,62,81,201,200,80,
+63,66,77,0,2,0,162,0,0,4,80,6,184,0,21,0,39,0,0,19,50,22,23,33,54,54,51,51,
+7,23,35,34,38,39,33,6,6,35,35,55,39,1,53,52,38,35,34,6,21,17,35,17,16,18,
+51,50,18,17,21,201,59,92,21,2,8,18,94,60,39,33,33,39,60,96,16,253,248,20,
+93,59,39,33,33,2,221,127,131,136,130,187,225,218,222,232,6,184,77,66,61,82,
+200,201,83,60,65,78,201,200,251,45,244,193,176,173,194,253,37,2,209,1,6,1,
+23,254,242,254,245,240,0,0,2,0,141,255,92,5,115,6,184,0,29,0,51,0,0,23,19,
+33,17,52,38,35,34,6,21,21,35,53,16,18,51,50,18,17,17,33,19,35,34,38,39,33,
+6,6,35,19,50,22,23,33,54,54,51,51,7,23,35,34,38,39,33,6,6,35,35,55,39,141,
+41,2,199,127,131,136,130,187,225,218,222,232,1,19,41,39,57,99,18,252,194,
+19,96,57,39,61,94,17,1,244,18,94,60,39,33,33,39,60,96,16,254,12,16,94,62,
+39,33,33,164,1,43,2,82,193,176,173,194,246,236,1,6,1,23,254,242,254,245,253,
+178,254,213,94,70,70,94,7,92,83,60,61,82,200,201,83,60,59,84,201,200,0,1,
+0,102,0,0,4,137,5,182,0,19,0,0,19,19,33,17,51,17,33,19,35,34,38,39,35,17,
+35,17,35,6,6,35,102,41,1,140,186,1,139,41,39,56,96,22,223,186,226,18,95,59,
+3,10,1,43,1,129,254,127,254,213,90,74,252,82,3,174,69,95,0,1,0,102,0,0,4,
+137,5,182,0,27,0,0,1,33,19,35,34,38,39,35,17,35,17,35,6,6,35,35,19,33,17,
+51,17,33,19,35,34,38,39,35,2,213,1,139,41,39,56,96,22,223,186,226,18,95,59,
+39,41,1,140,186,1,139,41,39,56,96,22,223,2,29,254,213,90,74,254,106,3,174,
+69,95,1,43,1,129,254,127,254,213,90,74,0,1,0,102,255,92,4,137,5,182,0,30,
+0,0,19,19,33,17,51,17,33,19,35,34,38,39,35,17,51,54,54,51,51,7,23,35,34,38,
+39,33,17,35,6,6,35,102,41,1,140,186,1,139,41,39,56,96,22,223,225,21,97,54,
+39,33,33,39,54,98,20,254,101,226,18,95,59,3,10,1,43,1,129,254,127,254,213,
+90,74,252,217,72,92,229,234,93,71,3,174,69,95,0,0,1,0,102,255,92,4,137,5,
+182,0,31,0,0,19,19,33,17,51,17,33,19,35,34,38,39,35,17,16,6,35,35,6,6,35,
+35,19,51,50,54,53,17,35,6,6,35,102,41,1,140,186,1,139,41,39,56,96,22,223,
+183,216,13,20,99,59,33,41,150,133,113,226,18,95,59,3,10,1,43,1,129,254,127,
+254,213,90,74,254,84,254,237,239,74,90,1,43,162,197,1,192,69,95,0,0,2,0,102,
+0,0,4,209,5,182,0,26,0,34,0,0,19,19,33,17,51,17,33,19,35,34,38,39,35,17,51,
+50,22,21,20,6,35,33,17,35,6,6,35,1,17,51,50,54,53,52,35,102,41,1,140,186,
+1,139,41,39,56,96,22,223,229,129,150,188,171,254,177,226,18,95,59,2,72,115,
+106,105,156,3,10,1,43,1,129,254,127,254,213,90,74,254,111,138,116,139,148,
+3,174,69,95,254,135,254,246,71,75,120,0,1,0,102,0,0,4,137,6,20,0,30,0,0,1,
+21,33,19,35,34,38,39,35,17,35,17,35,6,6,35,35,19,33,53,46,2,53,53,51,21,20,
+22,22,51,2,213,1,139,41,39,56,96,22,223,186,226,18,95,59,39,41,1,140,133,
+141,70,186,42,83,106,4,203,252,254,213,90,74,252,184,3,72,69,95,1,43,106,
+8,79,161,133,94,94,89,101,45,0,0,2,0,102,0,0,4,137,6,41,0,34,0,44,0,0,1,34,
+38,39,35,17,35,17,35,6,6,35,35,19,33,53,52,55,38,38,53,52,54,51,50,22,21,
+20,7,6,6,21,21,33,19,1,34,6,21,20,23,54,53,52,38,4,98,56,96,22,223,186,226,
+18,95,59,39,41,1,140,36,100,127,159,128,130,153,102,61,30,1,139,41,253,240,
+45,58,134,71,51,2,125,90,74,252,223,3,33,69,95,1,43,12,59,52,17,139,94,122,
+146,131,113,127,104,61,59,28,18,254,213,3,33,69,48,108,37,66,85,51,60,0,1,
+0,102,255,92,4,137,5,182,0,31,0,0,1,35,6,6,35,35,19,33,17,51,17,33,19,35,
+34,38,39,35,17,33,19,35,34,38,39,33,6,6,35,35,19,33,2,27,226,18,95,59,39,
+41,1,140,186,1,139,41,39,56,96,22,223,1,139,41,39,55,96,23,253,133,19,96,
+57,39,41,1,140,3,174,69,95,1,43,1,129,254,127,254,213,90,74,252,217,254,213,
+89,75,70,94,1,43,0,0,1,0,102,0,0,4,137,6,184,0,41,0,0,1,34,38,39,35,17,35,
+17,35,6,6,35,35,19,33,17,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,
+23,35,34,38,39,35,17,33,19,4,98,56,96,22,223,186,226,18,95,59,39,41,1,140,
+226,17,95,60,39,33,33,39,59,96,17,2,125,21,92,59,39,33,33,39,60,92,20,225,
+1,139,41,3,10,90,74,252,82,3,174,69,95,1,43,1,129,60,83,201,200,82,61,66,
+77,200,201,79,64,254,127,254,213,0,1,0,102,0,0,4,137,6,184,0,49,0,0,1,33,
+19,35,34,38,39,35,17,35,17,35,6,6,35,35,19,33,17,35,6,6,35,35,55,39,51,50,
+22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,33,19,35,34,38,39,35,2,213,1,
+139,41,39,56,96,22,223,186,226,18,95,59,39,41,1,140,226,17,95,60,39,33,33,
+39,59,96,17,2,125,21,92,59,39,33,33,39,60,92,20,225,1,139,41,39,56,96,22,
+223,2,29,254,213,90,74,254,106,3,174,69,95,1,43,1,129,60,83,201,200,82,61,
+66,77,200,201,79,64,254,127,254,213,90,74,0,0,1,0,102,255,92,4,137,6,184,
+0,52,0,0,19,19,33,17,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,
+34,38,39,35,17,33,19,35,34,38,39,35,17,51,54,54,51,51,7,23,35,34,38,39,33,
+17,35,6,6,35,102,41,1,140,226,17,95,60,39,33,33,39,59,96,17,2,125,21,92,59,
+39,33,33,39,60,92,20,225,1,139,41,39,56,96,22,223,225,21,97,54,39,33,33,39,
+54,98,20,254,101,226,18,95,59,3,10,1,43,1,129,60,83,201,200,82,61,66,77,200,
+201,79,64,254,127,254,213,90,74,252,217,72,92,229,234,93,71,3,174,69,95,0,
+1,0,102,255,92,4,137,6,184,0,53,0,0,1,7,23,35,34,38,39,35,17,33,19,35,34,
+38,39,35,17,16,6,35,35,6,6,35,35,19,51,50,54,53,17,35,6,6,35,35,19,33,17,
+35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,4,137,33,33,39,60,92,20,225,1,
+139,41,39,56,96,22,223,183,216,13,20,99,59,33,41,150,133,113,226,18,95,59,
+39,41,1,140,226,17,95,60,39,33,33,39,59,96,17,2,125,21,92,59,6,184,200,201,
+79,64,254,127,254,213,90,74,254,84,254,237,239,74,90,1,43,162,197,1,192,69,
+95,1,43,1,129,60,83,201,200,82,61,66,77,0,0,2,0,102,0,0,4,168,6,184,0,48,
+0,56,0,0,19,19,33,17,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,
+34,38,39,35,17,33,19,35,34,38,39,35,17,51,50,22,21,20,6,35,33,17,35,6,6,35,
+1,17,51,50,54,53,52,35,102,41,1,140,226,17,95,60,39,33,33,39,59,96,17,2,125,
+21,92,59,39,33,33,39,60,92,20,225,1,139,41,39,56,96,22,223,188,129,150,185,
+173,254,217,226,18,95,59,2,72,74,106,105,156,3,10,1,43,1,129,60,83,201,200,
+82,61,66,77,200,201,79,64,254,127,254,213,90,74,254,111,138,116,138,149,3,
+174,69,95,254,135,254,246,71,75,120,0,0,1,0,102,0,0,5,186,6,184,0,50,0,0,
+1,21,33,19,35,34,38,39,35,17,35,17,35,6,6,35,35,19,33,53,46,2,53,35,6,6,35,
+35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,20,22,22,51,4,6,1,
+139,41,39,56,96,22,223,186,226,18,95,59,38,41,1,139,133,142,69,187,17,95,
+60,39,33,33,39,59,96,17,2,49,20,93,60,38,32,32,38,60,93,20,188,42,83,107,
+4,203,252,254,213,90,74,252,184,3,72,69,95,1,43,106,8,81,161,131,60,83,201,
+200,82,61,64,79,200,201,80,63,89,101,45,0,2,0,102,0,0,4,137,6,205,0,50,0,
+60,0,0,1,22,21,20,7,6,6,21,21,33,19,35,34,38,39,35,17,35,17,35,6,6,35,35,
+19,33,53,52,55,38,38,53,52,55,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,
+51,3,5,34,6,21,20,23,54,53,52,38,3,133,35,102,72,37,1,139,41,39,56,96,22,
+223,186,226,18,95,59,39,41,1,140,55,100,127,43,97,17,95,60,39,33,33,39,59,
+96,17,2,123,22,98,54,39,41,254,43,45,57,133,72,52,5,182,56,73,125,106,74,
+56,28,8,254,213,90,74,252,223,3,33,69,95,1,43,6,62,55,17,139,94,89,64,60,
+83,201,200,82,61,74,90,254,233,24,68,49,108,37,67,84,51,60,0,1,0,102,255,
+92,4,137,6,184,0,53,0,0,1,35,6,6,35,35,19,33,17,35,6,6,35,35,55,39,51,50,
+22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,33,19,35,34,38,39,35,17,33,19,
+35,34,38,39,33,6,6,35,35,19,33,2,27,226,18,95,59,39,41,1,140,226,17,95,60,
+39,33,33,39,59,96,17,2,125,21,92,59,39,33,33,39,60,92,20,225,1,139,41,39,
+56,96,22,223,1,139,41,39,55,96,23,253,133,19,96,57,39,41,1,140,3,174,69,95,
+1,43,1,129,60,83,201,200,82,61,66,77,200,201,79,64,254,127,254,213,90,74,
+252,217,254,213,89,75,70,94,1,43,0,1,0,82,0,0,3,190,5,180,0,21,0,0,33,35,
+17,38,38,39,35,6,6,35,35,19,33,39,53,51,21,20,22,22,51,51,3,190,186,131,153,
+33,158,12,96,68,39,41,1,51,2,186,41,84,88,131,3,184,7,87,91,82,103,1,64,28,
+160,125,88,102,47,0,0,1,0,82,0,0,5,84,5,180,0,29,0,0,1,33,19,35,34,38,39,
+35,17,35,17,38,38,39,35,6,6,35,35,19,33,39,53,51,21,20,22,22,51,51,3,190,
+1,109,41,39,68,96,12,191,186,131,153,33,158,12,96,68,39,41,1,51,2,186,43,
+85,104,112,2,98,254,193,104,80,254,37,3,184,7,87,91,82,103,1,64,28,160,125,
+91,102,44,0,0,1,0,82,255,92,5,106,5,180,0,32,0,0,1,38,38,39,35,6,6,35,35,
+19,33,39,53,51,21,20,22,22,51,51,17,51,54,54,51,51,7,23,35,34,38,39,33,3,
+4,131,153,33,158,12,96,68,39,41,1,51,2,186,40,85,92,127,218,17,99,56,38,32,
+32,38,56,100,16,254,108,3,184,7,87,91,82,103,1,64,28,160,125,89,102,46,252,
+61,67,97,229,234,98,66,0,1,0,82,255,92,3,190,5,180,0,34,0,0,1,20,6,6,35,35,
+6,6,35,35,19,33,50,54,53,17,38,38,39,35,6,6,35,35,19,33,39,53,51,21,20,22,
+22,51,51,3,190,99,214,188,164,23,94,55,39,41,1,72,176,145,131,153,33,158,
+12,96,68,39,41,1,51,2,186,40,84,89,131,2,2,191,220,103,76,88,1,43,164,195,
+1,202,7,87,91,82,103,1,64,28,160,125,89,102,46,0,0,2,0,82,0,0,5,145,5,180,
+0,28,0,36,0,0,1,17,51,50,22,21,20,6,35,33,17,38,38,39,35,6,6,35,35,19,33,
+39,53,51,21,20,22,22,51,19,17,51,50,54,53,52,35,3,190,189,128,150,185,173,
+254,217,131,153,33,158,12,96,68,39,41,1,51,2,186,43,85,104,112,74,106,105,
+156,4,74,253,211,136,118,138,149,3,184,7,87,91,82,103,1,64,28,160,125,91,
+102,44,253,71,254,246,71,75,120,0,0,1,0,82,0,0,4,4,5,182,0,19,0,0,1,17,35,
+17,38,38,39,6,17,35,52,18,55,53,51,21,20,22,22,51,4,4,186,144,157,31,242,
+186,202,214,186,41,84,106,4,74,251,182,3,184,7,109,108,79,254,193,215,1,20,
+60,133,127,90,102,45,0,0,2,0,82,0,0,6,45,5,182,0,31,0,43,0,0,19,19,33,18,
+0,33,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,21,33,17,35,17,33,53,35,6,
+6,35,1,34,6,21,20,22,51,50,54,53,52,38,82,41,1,104,31,1,65,1,15,121,173,181,
+186,168,164,191,21,113,116,1,147,186,254,108,184,23,92,57,4,82,79,93,95,77,
+77,95,93,2,111,1,43,1,8,1,20,144,138,138,161,163,136,63,51,49,248,188,117,
+253,76,2,43,231,75,88,2,208,88,77,81,102,102,81,77,88,0,2,0,82,0,0,6,61,5,
+180,0,35,0,47,0,0,1,17,33,50,22,21,20,6,35,34,38,53,52,55,35,17,35,17,38,
+38,39,35,6,6,35,35,19,33,39,53,51,21,20,22,22,51,1,34,6,21,20,22,51,50,54,
+53,52,38,3,190,1,113,133,137,142,128,128,142,18,117,186,131,153,33,158,12,
+96,68,39,41,1,51,2,186,43,85,104,1,225,53,57,57,53,54,57,59,4,74,254,129,
+108,103,107,121,125,103,52,44,253,168,3,184,7,87,91,82,103,1,64,28,160,125,
+91,102,44,254,20,55,47,56,65,68,53,46,56,0,0,1,0,82,0,0,6,6,5,180,0,35,0,
+0,1,35,17,35,17,38,38,39,35,6,6,35,35,19,33,39,53,51,21,20,22,22,51,51,17,
+51,53,51,17,51,19,35,34,38,39,35,4,92,158,186,131,153,33,158,12,96,68,39,
+41,1,51,2,186,40,85,90,129,158,187,198,41,39,68,96,12,211,2,78,253,178,3,
+184,7,87,91,82,103,1,64,28,160,125,89,102,46,254,139,168,254,158,254,192,
+104,80,0,1,0,82,0,0,4,174,5,180,0,31,0,0,1,33,6,6,35,35,19,33,17,38,38,39,
+35,6,6,35,35,19,33,39,53,51,21,20,22,22,51,51,17,51,17,35,3,244,253,186,12,
+96,68,39,41,2,4,131,153,33,158,12,96,68,39,41,1,51,2,186,40,84,89,131,240,
+186,1,16,80,104,1,64,2,32,7,87,91,82,103,1,64,28,160,125,89,102,46,253,78,
+254,104,0,0,2,0,82,255,72,5,145,5,180,0,34,0,42,0,0,1,17,51,50,22,21,20,6,
+35,33,6,6,35,35,19,33,17,38,38,39,35,6,6,35,35,19,33,39,53,51,21,20,22,22,
+51,19,17,51,50,54,53,52,35,3,190,189,128,150,185,173,253,172,12,96,68,39,
+41,1,219,131,153,33,158,12,96,68,39,41,1,51,2,186,43,85,104,112,74,106,105,
+156,4,74,253,211,136,118,138,149,80,104,1,63,3,49,7,87,91,82,103,1,64,28,
+160,125,91,102,44,253,71,254,246,71,75,120,0,1,0,82,0,0,6,6,5,180,0,33,0,
+0,1,17,51,53,51,21,51,19,35,34,38,39,33,17,35,17,38,38,39,35,6,6,35,35,19,
+33,39,53,51,21,20,22,22,51,3,190,158,187,198,41,39,70,94,12,254,143,186,131,
+153,33,158,12,96,68,39,41,1,51,2,186,43,85,104,4,74,254,139,168,168,254,193,
+104,80,253,178,3,184,7,87,91,82,103,1,64,28,160,125,91,102,44,0,1,0,102,0,
+0,2,121,5,180,0,14,0,0,1,17,35,17,46,2,53,53,51,21,20,22,22,51,2,121,187,
+132,142,70,187,41,84,106,4,74,251,182,3,184,8,79,158,132,131,125,90,102,45,
+0,0,1,0,102,0,0,4,12,5,180,0,22,0,0,1,17,33,19,35,34,38,39,35,17,35,17,46,
+2,53,53,51,21,20,22,22,51,2,121,1,106,41,39,56,96,22,190,187,132,142,70,187,
+41,84,106,4,74,254,166,254,213,89,74,253,152,3,184,8,79,158,132,131,125,90,
+102,45,0,0,1,0,102,255,92,4,25,5,180,0,25,0,0,1,17,51,54,54,51,51,7,23,35,
+34,38,39,33,17,46,2,53,53,51,21,20,22,22,51,2,121,205,17,99,56,39,33,33,39,
+56,100,16,254,120,132,142,70,187,41,84,106,4,74,252,61,67,97,229,234,98,66,
+3,184,8,79,158,132,131,125,90,102,45,0,1,0,123,0,0,3,233,5,182,0,19,0,0,33,
+17,33,53,16,0,33,51,19,35,34,38,39,35,34,2,21,21,33,17,2,12,254,111,1,69,
+1,48,209,40,38,56,98,18,84,193,205,1,146,2,43,248,1,60,1,87,254,213,97,67,
+254,245,251,117,253,76,0,2,0,78,0,0,3,119,5,180,0,21,0,29,0,0,1,46,2,53,53,
+51,21,20,22,22,51,51,3,51,50,22,21,20,6,35,33,1,3,51,50,54,53,52,35,1,211,
+140,152,73,187,41,84,106,207,225,106,129,150,188,171,254,62,1,110,108,158,
+106,105,156,3,182,5,79,162,133,131,125,90,102,45,253,211,138,116,139,148,
+1,145,254,246,71,75,120,0,1,0,82,0,0,3,113,5,182,0,20,0,0,33,35,1,35,53,52,
+38,38,35,35,6,6,35,35,19,51,50,22,21,21,51,1,219,205,1,101,154,27,66,69,18,
+23,95,54,39,41,186,193,157,222,3,98,234,106,85,36,74,90,1,43,157,207,97,0,
+0,2,0,123,0,0,4,201,5,182,0,24,0,36,0,0,1,34,38,53,52,55,6,6,21,21,33,17,
+35,17,33,53,16,0,33,51,50,22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,3,
+102,165,189,21,109,119,1,148,187,254,109,1,69,1,48,118,173,182,189,166,79,
+93,95,77,77,95,93,3,113,163,136,64,50,47,249,189,117,253,76,2,43,248,1,60,
+1,87,145,137,139,160,1,206,88,77,81,102,102,81,77,88,0,1,0,82,255,92,4,102,
+5,182,0,31,0,0,1,19,35,34,38,39,35,34,2,21,21,33,17,33,19,35,34,38,39,33,
+6,6,35,35,19,33,17,33,53,16,0,33,3,254,41,39,56,98,18,111,189,202,1,111,1,
+112,41,39,55,96,23,253,148,23,94,55,39,41,1,151,254,146,1,69,1,48,5,182,254,
+213,97,67,254,243,249,117,253,211,254,213,89,75,76,88,1,43,1,164,248,1,60,
+1,87,0,0,1,0,82,0,0,4,27,6,68,0,35,0,0,1,17,35,17,38,38,53,53,35,6,6,35,35,
+55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,21,20,22,22,51,3,236,
+187,187,157,180,20,95,57,39,33,33,39,56,95,21,2,35,18,96,58,39,33,33,39,58,
+97,17,181,43,87,102,3,231,252,25,3,86,9,177,191,115,65,79,201,201,78,66,64,
+80,201,201,81,63,109,91,103,44,0,1,0,82,0,0,5,127,6,68,0,43,0,0,1,17,33,19,
+35,34,38,39,35,17,35,17,38,38,53,53,35,6,6,35,35,55,39,51,50,22,23,33,54,
+54,51,51,7,23,35,34,38,39,35,21,20,22,22,51,3,236,1,106,41,39,56,96,22,190,
+187,187,157,180,20,95,57,39,33,33,39,56,95,21,2,35,18,96,58,39,33,33,39,58,
+97,17,181,43,87,102,3,231,254,220,254,213,90,73,253,197,3,86,9,177,191,115,
+65,79,201,201,78,66,64,80,201,201,81,63,109,91,103,44,0,1,0,82,255,94,5,139,
+6,68,0,46,0,0,1,17,51,54,54,51,51,7,23,35,34,38,39,33,17,38,38,53,53,35,6,
+6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,21,20,22,22,
+51,3,236,204,20,98,54,39,33,33,39,55,97,20,254,121,187,157,180,20,95,57,39,
+33,33,39,56,95,21,2,35,18,96,58,39,33,33,39,58,97,17,181,43,87,102,3,231,
+252,160,70,94,229,232,94,68,3,86,9,177,191,115,65,79,201,201,78,66,64,80,
+201,201,81,63,109,91,103,44,0,0,1,0,82,0,0,4,84,6,68,0,44,0,0,33,17,33,53,
+52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,
+35,21,51,19,35,34,38,39,35,34,6,21,21,33,17,1,246,254,174,176,162,209,20,
+95,57,39,33,33,39,56,95,21,2,92,22,94,56,39,33,33,39,57,94,21,209,178,41,
+39,54,95,23,41,145,160,1,82,1,201,153,215,1,8,44,213,65,79,201,201,78,66,
+69,75,201,201,77,67,193,254,213,90,74,201,190,33,253,174,0,2,0,82,0,0,4,55,
+6,68,0,36,0,44,0,0,1,51,50,22,21,20,6,35,33,1,35,17,35,6,6,35,35,55,39,51,
+50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,51,3,3,51,50,54,53,52,35,2,
+182,107,128,150,185,173,254,61,1,101,154,180,20,95,57,39,33,33,39,56,95,21,
+2,35,18,96,58,39,33,33,39,58,97,17,181,222,244,109,158,106,105,156,2,29,136,
+118,138,149,3,98,1,224,65,79,201,201,78,66,64,80,201,201,81,63,254,167,253,
+168,254,246,71,75,120,0,0,1,0,82,0,0,3,203,6,88,0,34,0,0,33,35,1,35,53,52,
+38,38,35,35,6,6,35,35,19,51,53,33,3,51,50,22,23,33,54,54,51,51,3,33,21,22,
+22,23,51,2,104,204,1,49,154,27,65,70,18,23,95,54,39,41,172,254,250,41,39,
+55,96,23,1,111,19,96,57,38,41,254,252,85,83,11,221,2,227,66,106,85,36,74,
+90,1,43,158,1,43,89,75,70,94,254,213,178,27,124,122,0,2,0,82,0,0,4,242,6,
+68,0,49,0,61,0,0,1,34,38,53,52,55,6,6,21,21,33,17,35,17,33,53,16,37,53,35,
+6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,21,55,51,50,
+22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,3,195,142,162,17,180,146,1,82,
+186,254,174,1,82,209,20,95,57,39,33,33,39,56,95,21,2,92,22,94,56,39,33,33,
+39,57,94,21,209,28,249,147,154,159,142,59,64,65,56,55,65,62,2,152,134,111,
+50,42,14,174,203,16,253,174,1,201,137,1,164,98,234,65,79,201,201,78,66,69,
+75,201,201,77,67,205,2,119,115,114,131,1,104,63,54,57,72,72,57,55,62,0,1,
+0,82,255,92,4,84,6,68,0,56,0,0,1,7,23,35,34,38,39,35,21,51,19,35,34,38,39,
+35,34,6,21,21,33,17,33,19,35,34,38,39,33,6,6,35,35,19,33,17,33,53,52,18,55,
+53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,4,84,33,33,39,57,94,21,209,
+158,41,39,56,98,18,31,141,154,1,82,1,123,41,39,55,96,23,253,166,23,94,55,
+39,41,1,123,254,174,176,162,209,20,95,57,39,33,33,39,56,95,21,2,92,22,94,
+56,6,68,201,201,77,67,193,254,213,97,67,206,185,33,254,53,254,213,89,75,76,
+88,1,43,1,66,153,215,1,8,44,213,65,79,201,201,78,66,69,75,0,0,1,0,82,0,0,
+4,35,5,180,0,22,0,0,1,22,18,19,35,38,2,39,3,35,1,46,2,53,53,51,21,20,22,22,
+51,51,2,92,213,214,28,187,18,155,158,254,205,1,133,140,152,73,187,41,84,106,
+207,3,14,89,254,128,254,203,230,1,49,92,253,141,3,182,5,79,162,133,131,125,
+90,102,45,0,0,1,0,82,0,0,5,63,5,180,0,30,0,0,37,34,38,39,35,22,23,35,38,2,
+39,3,35,1,46,2,53,53,51,21,20,22,22,51,51,3,22,23,33,19,5,25,58,96,21,151,
+59,21,187,18,155,158,254,205,1,133,140,152,73,187,41,84,106,207,127,201,108,
+1,134,40,221,91,73,156,229,230,1,49,92,253,141,3,182,5,79,162,133,131,125,
+90,102,45,254,196,83,179,254,213,0,1,0,82,255,92,5,106,5,180,0,33,0,0,1,22,
+18,23,51,54,54,51,51,7,23,35,34,38,39,33,38,2,39,3,35,1,46,2,53,53,51,21,
+20,22,22,51,51,2,92,191,206,41,134,17,99,56,38,32,32,38,56,100,16,254,208,
+18,155,158,254,205,1,133,140,152,73,187,41,84,106,207,3,14,81,254,198,252,
+67,97,229,234,98,66,230,1,49,92,253,141,3,182,5,79,162,133,131,125,90,102,
+45,0,0,1,0,102,0,0,4,31,5,180,0,22,0,0,1,22,18,19,35,38,2,39,3,35,1,46,2,
+53,53,51,21,20,22,22,51,51,2,86,213,215,29,187,18,155,160,132,204,1,12,140,
+152,73,187,41,84,106,207,3,14,89,254,132,254,199,230,1,49,92,254,184,2,139,
+5,79,162,133,131,125,90,102,45,0,0,2,0,82,0,0,5,164,5,180,0,28,0,37,0,0,1,
+22,23,33,50,22,21,20,6,35,35,38,2,39,3,35,1,46,2,53,53,51,21,20,22,22,51,
+51,19,22,23,51,50,54,53,52,35,2,92,186,111,1,8,129,150,188,171,213,18,155,
+158,254,205,1,133,140,152,73,187,41,84,106,207,242,48,21,9,106,105,156,3,
+14,77,164,138,116,139,148,230,1,49,92,253,141,3,182,5,79,162,133,131,125,
+90,102,45,253,71,131,135,71,75,120,0,1,0,82,0,0,4,35,5,180,0,25,0,0,1,51,
+7,22,18,19,35,38,2,39,3,35,1,35,55,38,38,53,53,51,21,20,22,22,51,51,1,236,
+198,86,213,214,28,187,18,156,157,254,205,1,98,205,97,119,103,187,38,78,95,
+80,3,227,213,89,254,128,254,203,231,1,49,89,253,143,3,92,225,27,158,149,41,
+35,78,87,39,0,0,1,0,82,0,0,3,248,5,180,0,20,0,0,1,4,19,35,38,39,3,35,1,46,
+2,53,53,51,21,20,22,22,51,51,2,92,1,62,94,199,71,205,254,205,1,133,140,152,
+73,187,41,84,106,207,3,16,133,254,142,231,115,253,141,3,182,5,79,162,133,
+131,125,90,102,45,0,1,0,82,0,0,4,127,6,68,0,37,0,0,1,7,23,35,34,38,39,35,
+21,51,3,22,18,19,35,38,2,39,3,35,1,35,17,35,6,6,35,35,55,39,51,50,22,23,33,
+54,54,51,3,217,33,33,39,57,94,21,147,196,127,214,213,28,186,20,153,159,254,
+205,1,139,129,147,20,95,57,39,33,33,39,56,95,21,1,225,22,94,56,6,68,201,201,
+77,67,248,254,196,89,254,132,254,199,231,1,49,91,253,141,3,195,1,127,65,79,
+201,201,78,66,69,75,0,0,1,0,102,0,0,4,78,6,20,0,26,0,0,19,52,55,38,38,53,
+53,51,21,20,23,54,51,50,18,17,17,35,17,52,38,35,34,6,21,17,35,205,43,75,71,
+187,49,113,196,222,233,187,127,131,136,130,186,2,219,167,112,34,165,147,200,
+194,164,43,117,254,242,254,245,253,33,2,227,193,176,174,193,253,27,0,0,1,
+0,102,0,0,5,207,6,20,0,34,0,0,1,19,35,34,38,39,35,17,35,17,52,38,35,34,6,
+21,17,35,17,52,55,38,38,53,53,51,21,20,23,54,51,50,18,17,21,5,166,41,39,70,
+94,12,170,187,127,131,136,130,186,43,75,71,187,49,113,196,222,233,2,217,254,
+193,104,80,253,174,2,227,193,176,174,193,253,27,2,219,167,112,34,165,147,
+200,194,164,43,117,254,242,254,245,6,0,0,1,0,102,255,92,5,248,6,20,0,37,0,
+0,1,52,38,35,34,6,21,17,35,17,52,55,38,38,53,53,51,21,20,23,54,51,50,18,17,
+17,51,54,54,51,51,7,23,35,34,38,39,33,3,147,127,131,136,130,186,43,75,71,
+187,49,113,196,222,233,215,17,99,56,39,33,33,39,56,100,16,254,110,2,227,193,
+176,174,193,253,27,2,219,167,112,34,165,147,200,194,164,43,117,254,242,254,
+245,253,168,67,97,229,234,98,66,0,0,1,0,102,0,0,4,78,6,20,0,26,0,0,19,52,
+55,38,38,53,53,51,21,20,23,54,51,50,18,17,17,35,17,52,38,35,34,6,21,21,35,
+205,43,75,71,187,49,113,196,222,233,187,127,131,136,130,186,2,219,167,112,
+34,165,147,200,194,164,43,117,254,242,254,245,253,33,2,227,193,176,174,193,
+188,0,2,0,102,0,0,6,33,6,20,0,33,0,41,0,0,1,52,38,35,34,6,21,17,35,17,52,
+55,38,38,53,53,51,21,20,23,54,51,50,18,17,21,51,50,22,21,20,6,35,33,19,17,
+51,50,54,53,52,35,3,147,127,131,136,130,186,43,75,71,187,49,113,196,222,233,
+188,129,150,188,171,254,217,187,74,106,104,155,2,227,193,176,174,193,253,
+27,2,219,167,112,34,165,147,200,194,164,43,117,254,242,254,245,194,138,116,
+139,148,1,145,254,246,71,75,120,0,1,0,102,0,0,4,78,6,20,0,39,0,0,19,52,55,
+38,38,53,53,51,21,20,23,54,51,50,18,17,17,35,17,52,38,35,34,6,21,21,54,51,
+21,34,6,6,21,17,35,17,52,54,55,35,205,43,75,71,187,49,113,196,223,232,187,
+127,131,136,130,83,142,102,84,39,186,75,78,153,2,219,167,112,34,165,147,200,
+194,164,43,117,254,241,254,246,253,33,2,227,193,176,174,193,36,30,147,45,
+104,89,254,162,1,100,135,163,38,0,0,1,0,102,0,0,4,78,6,20,0,26,0,0,19,52,
+55,38,38,53,53,51,21,20,23,54,51,50,18,17,21,35,53,52,38,35,34,6,21,17,35,
+205,43,75,71,187,49,113,196,222,233,187,127,131,136,130,186,2,219,167,112,
+34,165,147,200,194,164,43,117,254,242,254,245,182,186,193,176,174,193,253,
+27,0,0,2,0,102,0,0,7,117,6,20,0,41,0,53,0,0,19,52,55,38,38,53,53,51,21,20,
+23,54,51,50,22,23,51,54,51,50,22,21,20,6,35,34,38,53,52,55,35,17,35,17,52,
+38,35,34,6,21,17,35,1,34,6,21,20,22,51,50,54,53,52,38,205,43,75,71,187,49,
+113,196,195,227,25,225,85,171,162,172,174,160,158,176,4,143,187,127,131,136,
+130,186,5,90,71,81,80,72,71,80,81,2,219,167,112,34,165,147,200,194,164,43,
+117,209,207,74,135,127,128,151,154,125,37,16,253,47,2,227,193,176,174,193,
+253,27,3,45,77,68,72,90,91,71,69,76,0,1,0,102,0,0,6,158,6,20,0,39,0,0,19,
+52,55,38,38,53,53,51,21,20,23,54,51,50,22,23,51,53,51,17,51,19,35,34,38,39,
+35,53,35,17,35,17,52,38,35,34,6,21,17,35,205,43,75,71,187,49,113,196,211,
+231,11,168,186,199,41,39,68,96,12,211,166,187,127,131,136,130,186,2,219,167,
+112,34,165,147,200,194,164,43,117,247,243,168,254,158,254,192,104,81,186,
+253,121,2,227,193,176,174,193,253,27,0,0,1,0,102,0,0,5,8,6,20,0,36,0,0,19,
+52,55,38,38,53,53,51,21,20,23,54,51,50,18,17,17,51,17,35,17,33,6,6,35,35,
+19,33,17,52,38,35,34,6,21,21,35,205,43,75,71,187,49,113,196,222,233,186,186,
+254,16,12,96,68,39,41,1,227,127,131,136,130,186,2,219,167,112,34,165,147,
+200,194,164,43,117,254,242,254,245,254,185,254,104,1,16,80,104,1,64,1,75,
+193,176,174,193,135,0,2,0,102,255,92,6,33,6,20,0,39,0,47,0,0,19,52,55,38,
+38,53,53,51,21,20,23,54,51,50,18,17,21,51,50,22,21,20,6,35,33,6,6,35,35,19,
+33,17,52,38,35,34,6,21,21,35,5,17,51,50,54,53,52,35,205,43,75,71,187,49,113,
+196,222,233,188,129,150,188,171,253,160,19,96,57,39,41,1,227,127,131,136,
+130,186,3,129,74,106,104,155,2,219,167,112,34,165,147,200,194,164,43,117,
+254,242,254,245,194,138,116,139,148,70,94,1,43,2,92,193,176,174,193,188,152,
+254,246,71,75,120,0,0,1,0,102,0,0,5,252,6,20,0,38,0,0,19,52,55,38,38,53,53,
+51,21,20,23,54,51,50,22,23,51,17,51,17,51,19,35,34,38,39,35,23,17,35,17,52,
+38,35,34,6,21,17,35,205,43,75,71,187,49,113,196,180,222,36,21,186,199,41,
+39,68,96,12,217,2,187,127,131,136,130,186,2,219,167,112,34,165,147,200,194,
+164,43,117,179,175,1,92,254,164,254,192,104,80,23,253,9,2,227,193,176,174,
+193,253,27,0,0,1,0,82,0,0,5,160,6,162,0,48,0,0,1,21,20,23,54,51,50,18,17,
+17,35,17,52,38,35,34,6,21,17,35,17,52,55,38,38,53,53,35,6,6,35,35,55,39,51,
+50,22,23,33,54,54,51,51,7,23,35,34,38,39,2,115,49,113,196,222,233,187,127,
+131,136,130,186,43,76,70,147,20,95,57,39,33,33,39,56,95,21,1,225,22,94,56,
+39,33,33,39,57,94,21,5,160,172,164,43,117,254,242,254,245,253,127,2,133,193,
+176,174,193,253,121,2,125,166,112,35,169,143,178,65,79,201,201,78,66,69,75,
+201,201,77,67,0,1,0,82,0,0,7,25,6,162,0,56,0,0,1,21,20,23,54,51,50,18,17,
+21,33,19,35,34,38,39,35,17,35,17,52,38,35,34,6,21,17,35,17,52,55,38,38,53,
+53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,2,115,49,
+113,196,222,233,1,80,41,39,59,97,18,164,187,127,131,136,130,186,43,76,70,
+147,20,95,57,39,33,33,39,56,95,21,1,225,22,94,56,39,33,33,39,57,94,21,5,160,
+172,164,43,117,254,242,254,245,6,254,213,94,70,254,12,2,133,193,176,174,193,
+253,121,2,125,166,112,35,169,143,178,65,79,201,201,78,66,69,75,201,201,77,
+67,0,0,1,0,82,255,92,7,51,6,162,0,59,0,0,1,21,20,23,54,51,50,18,17,17,51,
+54,54,51,51,7,23,35,34,38,39,33,17,52,38,35,34,6,21,17,35,17,52,55,38,38,
+53,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,2,115,
+49,113,196,222,233,192,21,97,54,39,33,33,39,54,98,20,254,133,127,131,136,
+130,186,43,76,70,147,20,95,57,39,33,33,39,56,95,21,1,225,22,94,56,39,33,33,
+39,57,94,21,5,160,172,164,43,117,254,242,254,245,254,6,72,92,229,234,93,71,
+2,133,193,176,174,193,253,121,2,125,166,112,35,169,143,178,65,79,201,201,
+78,66,69,75,201,201,77,67,0,0,1,0,82,0,0,5,160,6,162,0,48,0,0,1,21,20,23,
+54,51,50,18,17,17,35,17,52,38,35,34,6,21,21,35,53,52,55,38,38,53,53,35,6,
+6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,2,115,49,113,196,
+222,233,187,127,131,136,130,186,43,76,70,147,20,95,57,39,33,33,39,56,95,21,
+1,225,22,94,56,39,33,33,39,57,94,21,5,160,172,164,43,117,254,242,254,245,
+253,127,2,133,193,176,174,193,94,84,166,112,35,169,143,178,65,79,201,201,
+78,66,69,75,201,201,77,67,0,2,0,82,0,0,7,115,6,162,0,55,0,63,0,0,1,21,20,
+23,54,51,50,18,17,21,51,50,22,21,20,6,35,33,17,52,38,35,34,6,21,17,35,17,
+52,55,38,38,53,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,
+38,39,1,17,51,50,54,53,52,35,2,115,49,113,196,222,233,188,129,150,188,171,
+254,217,127,131,136,130,186,43,76,70,147,20,95,57,39,33,33,39,56,95,21,1,
+225,22,94,56,39,33,33,39,57,94,21,2,154,73,106,105,155,5,160,172,164,43,117,
+254,242,254,245,100,138,116,139,148,2,133,193,176,174,193,253,121,2,125,166,
+112,35,169,143,178,65,79,201,201,78,66,69,75,201,201,77,67,251,241,254,246,
+71,75,120,0,0,1,0,82,0,0,5,160,6,162,0,61,0,0,1,52,55,38,38,53,53,35,6,6,
+35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,21,20,23,54,51,
+50,18,17,17,35,17,52,38,35,34,6,21,21,54,51,21,34,6,6,21,17,35,17,52,54,55,
+35,2,31,43,76,70,147,20,95,57,39,33,33,39,56,95,21,1,225,22,94,56,39,33,33,
+39,57,94,21,147,47,113,198,222,233,187,127,131,136,130,86,139,102,84,39,186,
+75,78,153,2,125,164,114,35,169,143,178,65,79,201,201,78,66,69,75,201,201,
+77,67,172,164,43,117,254,242,254,245,253,127,2,133,193,176,174,193,37,31,
+147,45,104,89,255,0,1,6,135,163,38,0,0,1,0,82,0,0,5,160,6,162,0,48,0,0,1,
+21,20,23,54,51,50,18,17,21,35,53,52,38,35,34,6,21,17,35,17,52,55,38,38,53,
+53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,2,115,49,
+113,196,222,233,187,127,131,136,130,186,43,76,70,147,20,95,57,39,33,33,39,
+56,95,21,1,225,22,94,56,39,33,33,39,57,94,21,5,160,172,164,43,117,254,242,
+254,245,86,90,193,176,174,193,253,121,2,125,166,112,35,169,143,178,65,79,
+201,201,78,66,69,75,201,201,77,67,0,2,0,82,0,0,8,199,6,162,0,63,0,75,0,0,
+1,21,20,23,54,51,50,22,23,51,54,51,50,22,21,20,6,35,34,38,53,52,55,35,17,
+35,17,52,38,35,34,6,21,17,35,17,52,55,38,38,53,53,35,6,6,35,35,55,39,51,50,
+22,23,33,54,54,51,51,7,23,35,34,38,39,1,34,6,21,20,22,51,50,54,53,52,38,2,
+115,49,113,196,195,227,25,225,85,171,162,172,174,160,157,177,4,143,187,127,
+131,136,130,186,43,76,70,147,20,95,57,39,33,33,39,56,95,21,1,225,22,94,56,
+39,33,33,39,57,94,21,4,115,72,80,81,71,70,81,78,5,160,172,164,43,117,209,
+207,74,135,128,128,150,152,126,37,17,253,141,2,133,193,176,174,193,253,121,
+2,125,166,112,35,169,143,178,65,79,201,201,78,66,69,75,201,201,77,67,253,
+47,79,67,72,89,88,73,66,80,0,0,1,0,82,0,0,7,217,6,162,0,62,0,0,1,21,20,23,
+54,51,50,22,23,51,53,51,17,51,19,35,34,38,39,35,53,35,23,17,35,17,52,38,35,
+34,6,21,17,35,17,52,55,38,38,53,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,
+51,51,7,23,35,34,38,39,2,115,49,113,196,180,222,36,160,186,199,41,39,68,96,
+12,211,145,2,187,127,131,136,130,186,43,76,70,147,20,95,57,39,33,33,39,56,
+95,21,1,225,22,94,56,39,33,33,39,57,94,21,5,160,172,164,43,117,178,177,181,
+254,157,254,193,104,80,174,23,253,103,2,133,193,176,174,193,253,121,2,125,
+166,112,35,169,143,178,65,79,201,201,78,66,69,75,201,201,77,67,0,0,1,0,82,
+255,92,6,117,6,162,0,60,0,0,1,21,20,23,54,51,50,18,17,17,51,19,35,34,38,39,
+33,6,6,35,35,19,33,17,52,38,35,34,6,21,21,35,53,52,55,38,38,53,53,35,6,6,
+35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,2,115,49,113,196,
+222,233,172,41,39,57,99,18,254,14,19,96,57,39,41,1,225,127,131,136,130,186,
+43,76,70,147,20,95,57,39,33,33,39,56,95,21,1,225,22,94,56,39,33,33,39,57,
+94,21,5,160,172,164,43,117,254,242,254,245,254,6,254,213,94,70,70,94,1,43,
+1,254,193,176,174,193,94,84,166,112,35,169,143,178,65,79,201,201,78,66,69,
+75,201,201,77,67,0,2,0,82,255,92,7,115,6,162,0,61,0,69,0,0,1,21,20,23,54,
+51,50,18,17,21,51,50,22,21,20,6,35,33,6,6,35,35,19,33,17,52,38,35,34,6,21,
+21,35,53,52,55,38,38,53,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,
+7,23,35,34,38,39,1,17,51,50,54,53,52,35,2,115,49,113,196,222,233,188,129,
+150,188,171,253,160,19,96,57,39,41,1,227,127,131,136,130,186,43,76,70,147,
+20,95,57,39,33,33,39,56,95,21,1,225,22,94,56,39,33,33,39,57,94,21,2,154,73,
+106,105,155,5,160,172,164,43,117,254,242,254,245,100,138,116,139,148,70,94,
+1,43,1,254,193,176,174,193,94,84,166,112,35,169,143,178,65,79,201,201,78,
+66,69,75,201,201,77,67,251,241,254,246,71,75,120,0,1,0,82,0,0,7,78,6,162,
+0,60,0,0,1,21,20,23,54,51,50,22,23,51,17,51,17,51,19,35,34,38,39,35,23,17,
+35,17,52,38,35,34,6,21,17,35,17,52,55,38,38,53,53,35,6,6,35,35,55,39,51,50,
+22,23,33,54,54,51,51,7,23,35,34,38,39,2,115,49,113,196,180,222,36,21,186,
+199,41,39,68,96,12,217,2,187,127,131,136,130,186,43,76,70,147,20,95,57,39,
+33,33,39,56,95,21,1,225,22,94,56,39,33,33,39,57,94,21,5,160,172,164,43,117,
+178,177,1,99,254,157,254,193,104,80,23,253,103,2,133,193,176,174,193,253,
+121,2,125,166,112,35,169,143,178,65,79,201,201,78,66,69,75,201,201,77,67,
+0,3,0,123,0,0,5,166,5,182,0,17,0,28,0,37,0,0,1,50,18,17,20,2,6,35,35,6,35,
+34,2,17,52,18,54,51,3,50,54,55,17,35,34,6,2,21,16,1,17,51,50,18,17,16,2,35,
+3,195,236,247,102,188,124,147,164,182,205,211,133,241,160,116,38,66,53,30,
+107,161,95,2,70,108,131,136,152,147,5,182,254,176,254,207,189,254,210,166,
+164,1,82,1,72,230,1,116,194,250,213,25,41,4,98,157,254,193,183,253,239,4,
+164,251,252,1,1,1,1,1,1,1,1,0,0,3,0,123,255,236,6,160,5,182,0,22,0,33,0,42,
+0,0,1,50,18,17,20,2,7,33,19,35,34,38,39,33,6,35,34,2,17,52,18,54,51,3,50,
+54,55,17,35,34,6,2,21,16,1,17,51,50,18,17,16,2,35,3,195,236,247,76,72,1,101,
+41,39,70,94,12,253,172,164,182,205,211,133,241,160,116,38,66,53,30,107,161,
+95,2,70,108,131,136,152,147,5,182,254,176,254,207,159,254,239,90,254,193,
+104,80,164,1,82,1,72,230,1,116,194,250,213,25,41,4,98,157,254,193,183,253,
+239,4,164,251,252,1,1,1,1,1,1,1,1,0,0,3,0,123,255,92,5,164,5,182,0,31,0,42,
+0,51,0,0,1,50,22,21,20,6,6,35,35,17,51,54,54,51,51,7,23,35,34,38,39,33,17,
+6,35,34,38,53,52,54,54,51,3,50,55,17,35,34,6,6,21,20,22,1,17,51,50,54,53,
+52,38,35,3,252,198,226,100,189,125,145,205,17,99,56,38,32,32,38,56,100,16,
+254,120,95,105,186,189,123,230,147,117,108,84,61,106,147,79,101,1,223,108,
+130,139,138,125,5,182,200,170,112,178,100,253,201,67,97,229,234,98,66,2,111,
+31,202,185,140,221,122,253,37,43,2,41,91,161,102,113,129,2,84,254,23,127,
+127,115,120,0,3,0,123,0,0,5,164,5,182,0,20,0,31,0,40,0,0,1,50,22,21,20,6,
+6,35,35,17,35,17,6,35,34,38,53,52,54,54,51,3,50,55,17,35,34,6,6,21,20,22,
+1,17,51,50,54,53,52,38,35,3,252,198,226,100,189,125,145,187,95,105,186,189,
+123,230,147,117,108,84,61,106,147,79,101,1,223,108,130,139,138,125,5,182,
+200,170,112,178,100,253,66,2,111,31,202,185,140,221,122,253,37,43,2,41,91,
+161,102,113,129,2,84,254,23,127,127,115,120,0,0,4,0,123,0,0,5,164,5,182,0,
+27,0,38,0,47,0,55,0,0,1,6,35,34,38,53,52,54,54,51,33,50,22,21,20,6,6,35,35,
+21,51,50,22,21,20,6,35,33,3,50,55,17,35,34,6,6,21,20,22,1,17,51,50,54,53,
+52,38,35,3,17,51,50,54,53,52,35,2,186,95,105,186,189,123,230,147,1,141,198,
+226,100,189,125,145,188,129,150,188,171,254,217,192,108,84,61,106,147,79,
+101,1,223,108,130,139,138,125,114,73,106,105,155,2,111,31,202,185,140,221,
+122,200,170,112,178,100,161,138,116,139,148,2,219,43,2,41,91,161,102,113,
+129,2,84,254,23,127,127,115,120,252,98,254,246,71,75,120,0,0,3,0,123,0,0,
+7,35,5,182,0,23,0,34,0,43,0,0,1,50,18,19,33,19,35,34,38,39,35,6,2,35,35,6,
+35,34,2,17,52,18,54,51,3,50,54,55,17,35,34,6,2,21,16,1,17,51,50,18,17,16,
+2,35,3,195,233,246,4,1,84,41,39,59,97,18,174,26,216,166,147,164,182,205,211,
+133,241,160,116,38,66,53,30,107,161,95,2,70,108,131,136,152,147,5,182,254,
+187,254,206,254,213,94,70,246,254,226,164,1,82,1,72,230,1,116,194,250,213,
+25,41,4,98,157,254,193,183,253,239,4,164,251,252,1,1,1,1,1,1,1,1,0,0,3,0,
+123,0,0,5,164,5,182,0,20,0,31,0,40,0,0,1,50,22,21,20,6,6,35,35,1,35,19,6,
+35,34,38,53,52,54,54,51,3,50,55,17,35,34,6,6,21,20,22,1,17,51,50,54,53,52,
+38,35,3,252,198,226,100,189,125,162,254,236,191,252,70,85,186,189,123,230,
+147,117,108,84,61,106,147,79,101,1,223,108,130,139,138,125,5,182,200,170,
+112,178,100,253,66,2,96,16,202,185,140,221,122,253,37,43,2,41,91,161,102,
+113,129,2,84,254,23,127,127,115,120,0,2,0,164,255,236,4,78,5,201,0,13,0,27,
+0,0,1,16,2,35,34,2,17,17,16,18,51,50,18,17,39,52,38,35,34,6,21,17,20,22,51,
+50,54,53,4,78,246,229,227,236,236,227,228,247,187,135,143,149,138,138,149,
+142,136,2,4,254,251,254,237,1,22,1,6,1,164,1,7,1,22,254,236,254,251,4,192,
+177,178,189,254,72,190,177,176,193,0,2,0,164,255,236,5,199,5,201,0,21,0,35,
+0,0,1,34,38,39,35,21,16,2,35,34,2,17,17,16,18,51,50,18,17,21,33,19,1,52,38,
+35,34,6,21,17,20,22,51,50,54,53,5,160,59,97,18,164,246,229,227,236,236,227,
+228,247,1,80,41,253,204,135,143,149,138,138,149,142,136,2,0,94,70,160,254,
+251,254,237,1,22,1,6,1,164,1,7,1,22,254,236,254,251,133,254,213,1,180,192,
+177,178,189,254,72,190,177,176,193,0,0,2,0,123,255,94,5,129,5,203,0,31,0,
+45,0,0,1,20,7,33,3,33,54,54,51,51,7,23,35,34,38,39,33,53,19,35,6,35,34,38,
+53,17,52,54,51,50,22,21,1,50,54,53,53,52,38,35,34,6,21,21,20,22,3,109,29,
+1,24,247,1,61,20,98,54,39,33,33,39,55,97,20,253,240,202,176,83,113,181,196,
+194,181,179,200,254,135,110,92,94,110,106,95,95,3,113,78,60,253,160,70,94,
+229,232,94,68,115,1,237,33,157,149,1,41,145,160,161,144,254,47,97,103,240,
+97,96,96,97,240,103,97,0,0,2,0,123,0,0,4,104,5,203,0,19,0,33,0,0,33,35,19,
+35,6,35,34,38,53,17,52,54,51,50,22,21,17,20,7,33,5,50,54,53,53,52,38,35,34,
+6,21,21,20,22,3,59,204,249,176,83,113,181,196,194,181,179,200,29,1,24,253,
+140,110,92,94,110,106,95,95,2,96,33,157,149,1,41,145,160,161,144,254,215,
+78,60,30,97,103,240,97,96,96,97,240,103,97,0,0,3,0,123,0,0,5,152,5,203,0,
+27,0,41,0,49,0,0,1,51,50,22,21,20,6,35,33,53,19,35,6,35,34,38,53,17,52,54,
+51,50,22,21,17,20,7,33,5,50,54,53,53,52,38,35,34,6,21,21,20,22,1,3,51,50,
+54,53,52,35,4,23,106,129,150,188,171,254,109,202,176,83,113,181,196,194,181,
+179,200,29,1,24,253,140,110,92,94,110,106,95,95,2,85,108,157,106,105,155,
+2,29,138,116,139,148,117,1,235,33,157,149,1,41,145,160,161,144,254,215,78,
+60,30,97,103,240,97,96,96,97,240,103,97,254,200,254,246,71,75,120,0,2,0,164,
+255,236,4,78,6,20,0,16,0,30,0,0,1,16,2,35,34,2,17,53,52,18,55,17,51,17,22,
+18,21,39,52,38,35,34,6,21,21,20,22,51,50,54,53,4,78,246,229,227,236,192,183,
+186,180,197,187,136,142,150,137,138,149,142,136,2,4,254,251,254,237,1,21,
+1,7,211,235,1,18,26,1,34,254,220,27,254,240,230,4,192,177,177,190,229,192,
+177,176,193,0,2,0,104,0,0,3,227,5,203,0,23,0,33,0,0,51,18,55,54,55,55,38,
+38,53,52,54,51,50,22,21,20,6,6,7,14,3,7,1,34,6,21,20,23,54,54,53,52,104,21,
+162,87,94,54,111,122,202,162,166,176,61,119,119,116,151,81,43,14,1,104,85,
+95,219,69,54,1,123,192,100,55,32,36,193,135,164,197,177,169,101,154,122,66,
+65,137,132,176,184,5,63,121,106,227,23,45,129,86,217,0,0,1,0,184,0,0,3,160,
+5,182,0,11,0,0,33,35,17,33,17,35,17,51,17,33,17,51,3,160,187,254,142,187,
+187,1,114,187,2,213,253,43,5,182,253,166,2,90,0,1,0,184,0,0,5,35,5,182,0,
+19,0,0,33,35,17,33,17,35,17,51,17,33,17,51,17,33,19,35,34,38,39,35,3,160,
+187,254,142,187,187,1,114,187,1,90,41,39,70,94,12,172,2,213,253,43,5,182,
+253,166,2,90,253,166,254,193,104,80,0,1,0,184,255,92,5,35,5,182,0,22,0,0,
+37,51,54,54,51,51,7,23,35,34,38,39,33,17,33,17,35,17,51,17,33,17,51,3,160,
+176,17,99,56,39,33,33,39,56,100,16,254,149,254,142,187,187,1,114,187,135,
+67,97,229,234,98,66,2,213,253,43,5,182,253,166,2,90,0,1,0,184,0,0,3,160,5,
+182,0,11,0,0,33,35,17,33,17,35,17,51,17,33,17,51,3,160,187,254,142,187,187,
+1,114,187,2,213,254,149,4,76,253,166,2,90,0,2,0,184,0,0,5,115,5,182,0,18,
+0,26,0,0,1,33,17,35,17,51,17,33,17,51,17,51,50,22,21,20,6,35,33,19,17,51,
+50,54,53,52,35,2,229,254,142,187,187,1,114,187,188,129,150,188,171,254,217,
+187,73,106,105,155,2,213,253,43,5,182,253,166,2,90,252,103,138,116,139,148,
+1,145,254,246,71,75,120,0,0,1,0,82,0,0,4,174,5,182,0,24,0,0,19,50,22,22,21,
+21,33,17,51,17,35,17,33,17,35,17,52,38,35,35,6,6,35,35,19,246,162,158,75,
+1,115,186,186,254,141,186,66,82,14,23,95,54,39,41,5,182,80,177,158,187,2,
+90,250,74,2,213,253,43,4,41,139,123,74,90,1,43,0,1,0,184,0,0,3,160,5,182,
+0,11,0,0,1,35,17,33,17,35,17,51,17,33,17,51,3,160,187,254,142,187,187,1,114,
+187,1,106,1,107,253,43,5,182,253,166,2,90,0,1,0,184,255,92,5,20,5,182,0,23,
+0,0,37,33,19,35,34,38,39,33,6,6,35,35,19,33,17,33,17,35,17,51,17,33,17,51,
+3,160,1,76,40,38,55,97,23,254,7,23,94,55,39,41,1,73,254,142,187,187,1,114,
+187,135,254,213,88,76,76,88,1,43,2,78,254,149,4,76,253,166,2,90,0,1,0,82,
+0,0,6,35,5,182,0,37,0,0,19,50,22,22,21,21,33,53,52,54,54,51,51,19,35,34,38,
+39,35,34,6,21,17,35,17,33,17,35,17,52,38,35,35,6,6,35,35,19,246,162,158,75,
+1,115,74,158,163,123,41,39,56,98,18,14,84,64,186,254,141,186,66,82,14,23,
+95,54,39,41,5,182,80,177,158,187,187,156,179,80,254,213,97,67,126,136,251,
+215,2,213,253,43,4,41,139,123,74,90,1,43,0,1,0,82,0,0,6,35,5,182,0,45,0,0,
+19,50,22,22,21,21,33,53,52,54,54,51,51,19,35,34,38,39,35,34,6,21,21,33,19,
+35,34,38,39,35,17,35,17,33,17,35,17,52,38,35,35,6,6,35,35,19,246,162,158,
+75,1,115,74,158,163,123,41,39,56,98,18,14,84,64,1,76,41,39,59,97,18,160,186,
+254,141,186,66,82,14,23,95,54,39,41,5,182,80,177,158,187,187,156,179,80,254,
+213,97,67,126,136,205,254,213,94,70,253,43,2,213,253,43,4,41,139,123,74,90,
+1,43,0,0,1,0,82,255,92,6,35,5,182,0,48,0,0,19,50,22,22,21,21,33,53,52,54,
+54,51,51,19,35,34,38,39,35,34,6,21,17,51,54,54,51,51,7,23,35,34,38,39,33,
+17,33,17,35,17,52,38,35,35,6,6,35,35,19,246,162,158,75,1,115,74,158,163,123,
+41,39,56,98,18,14,84,64,162,17,99,56,39,33,33,39,56,100,16,254,164,254,141,
+186,66,82,14,23,95,54,39,41,5,182,80,177,158,187,187,156,179,80,254,213,97,
+67,126,136,252,94,67,97,229,234,98,66,2,213,253,43,4,41,139,123,74,90,1,43,
+0,0,1,0,82,0,0,6,35,5,182,0,37,0,0,19,50,22,22,21,21,33,53,52,54,54,51,51,
+19,35,34,38,39,35,34,6,21,17,35,17,33,17,35,17,52,38,35,35,6,6,35,35,19,246,
+162,158,75,1,115,74,158,163,123,41,39,56,98,18,14,84,64,186,254,141,186,66,
+82,14,23,95,54,39,41,5,182,80,177,158,187,187,156,179,80,254,213,97,67,126,
+136,251,215,2,213,254,149,2,191,139,123,74,90,1,43,0,2,0,82,0,0,6,129,5,182,
+0,44,0,52,0,0,19,50,22,22,21,21,33,53,52,54,54,51,51,19,35,34,38,39,35,34,
+6,21,17,51,50,22,21,20,6,35,33,17,33,17,35,17,52,38,35,35,6,6,35,35,19,1,
+17,51,50,54,53,52,35,246,162,158,75,1,115,74,158,163,123,41,39,56,98,18,14,
+84,64,188,129,150,185,173,254,217,254,141,186,66,82,14,23,95,54,39,41,4,51,
+74,106,105,156,5,182,80,177,158,187,187,156,179,80,254,213,97,67,126,136,
+253,244,138,116,138,149,2,213,253,43,4,41,139,123,74,90,1,43,251,219,254,
+246,71,75,120,0,1,0,82,0,0,6,135,6,162,0,63,0,0,1,7,23,35,34,38,39,35,17,
+22,22,21,21,33,53,52,54,54,51,51,19,35,34,38,39,35,34,6,21,17,35,17,33,17,
+35,17,52,38,35,35,6,6,35,35,19,51,50,23,17,35,6,6,35,35,55,39,51,50,22,23,
+33,54,54,51,3,119,33,33,39,58,97,17,107,90,82,1,115,74,158,163,123,41,39,
+54,95,23,14,82,66,186,254,141,186,93,116,53,23,95,54,39,41,164,50,46,90,20,
+95,57,39,33,33,39,56,95,21,1,127,18,96,58,6,162,201,201,81,63,254,184,43,
+182,146,49,49,156,180,80,254,213,90,74,122,140,253,8,2,45,253,211,2,248,137,
+125,74,90,1,43,4,1,31,65,79,201,201,78,66,64,80,0,0,1,0,82,0,0,6,35,5,182,
+0,37,0,0,19,50,22,22,21,21,33,53,52,54,54,51,51,19,35,34,38,39,35,34,6,21,
+17,35,17,33,17,35,17,52,38,35,35,6,6,35,35,19,246,162,158,75,1,115,74,158,
+163,123,41,39,56,98,18,14,84,64,186,254,141,186,66,82,14,23,95,54,39,41,5,
+182,80,177,158,187,187,156,179,80,254,213,97,67,126,136,253,65,1,107,253,
+43,4,41,139,123,74,90,1,43,0,1,0,82,255,92,6,35,5,182,0,49,0,0,19,50,22,22,
+21,21,33,53,52,54,54,51,51,19,35,34,38,39,35,34,6,21,17,33,19,35,34,38,39,
+33,6,6,35,35,19,33,17,33,17,35,17,52,38,35,35,6,6,35,35,19,246,162,158,75,
+1,115,74,158,163,123,41,39,56,98,18,14,84,64,1,76,41,39,57,99,18,254,6,23,
+94,55,39,41,1,74,254,141,186,66,82,14,23,95,54,39,41,5,182,80,177,158,187,
+187,156,179,80,254,213,97,67,126,136,252,94,254,213,94,70,76,88,1,43,2,78,
+254,149,2,191,139,123,74,90,1,43,0,0,2,0,154,0,0,3,113,5,203,0,20,0,31,0,
+0,33,53,52,38,39,39,38,53,52,54,51,50,22,21,20,6,7,22,22,21,21,3,34,6,21,
+20,23,54,54,53,52,38,1,178,60,65,55,100,194,160,178,195,216,171,72,55,105,
+81,99,92,134,136,99,193,160,240,116,100,180,141,164,189,180,166,158,210,15,
+150,242,137,225,5,63,109,91,133,127,16,132,108,92,112,0,2,0,154,0,0,3,225,
+5,203,0,28,0,39,0,0,33,53,52,38,39,39,38,53,52,54,51,50,22,21,20,6,7,22,23,
+33,19,35,34,38,39,35,22,21,21,3,34,6,21,20,23,54,54,53,52,38,1,178,60,65,
+55,100,194,160,178,195,216,171,59,33,1,110,41,39,56,96,22,170,11,105,81,99,
+92,134,136,99,193,160,240,116,100,180,141,164,189,180,166,158,210,15,123,
+115,254,213,90,74,81,75,225,5,63,109,91,133,127,16,132,108,92,112,0,2,0,154,
+0,0,4,201,5,203,0,34,0,45,0,0,33,53,52,38,39,39,38,53,52,54,51,50,22,21,20,
+6,7,22,23,51,53,51,17,51,19,35,34,38,39,35,53,35,22,21,21,3,34,6,21,20,23,
+54,54,53,52,38,1,178,60,65,55,100,194,160,178,195,216,171,52,25,228,186,199,
+41,39,68,96,12,211,195,17,105,81,99,92,134,136,99,193,160,240,116,100,180,
+141,164,189,180,166,158,210,15,113,80,168,254,158,254,192,104,81,186,98,103,
+225,5,63,109,91,133,127,16,132,108,92,112,0,2,0,82,255,92,3,195,5,203,0,32,
+0,43,0,0,33,6,6,35,35,55,39,51,50,22,23,51,53,52,38,39,46,2,53,52,54,51,50,
+22,21,20,6,7,22,22,23,21,3,34,6,21,20,23,54,54,53,52,38,1,37,20,98,54,39,
+33,33,39,54,97,21,223,60,65,70,54,31,194,160,178,195,219,169,70,56,1,104,
+81,99,92,134,136,99,71,93,230,233,91,73,58,160,240,116,122,123,118,58,164,
+189,180,166,159,209,15,141,235,136,242,5,63,109,91,133,127,16,132,108,92,
+112,0,0,3,0,154,0,0,4,240,5,203,0,34,0,45,0,57,0,0,33,53,52,38,39,39,38,53,
+52,54,51,50,22,21,20,6,7,22,23,33,50,22,21,20,6,35,34,38,53,52,55,35,22,21,
+21,3,34,6,21,20,23,54,54,53,52,38,1,34,6,21,20,22,51,50,54,53,52,38,1,178,
+60,65,55,100,194,160,178,195,216,171,50,23,1,170,134,137,142,129,128,142,
+18,143,23,105,81,99,92,134,136,99,1,138,53,57,57,53,54,57,59,193,160,240,
+116,100,180,141,164,189,180,166,158,210,15,108,68,111,100,107,121,125,103,
+52,44,113,125,225,5,63,109,91,133,127,16,132,108,92,112,252,150,55,47,56,
+65,68,53,46,56,0,0,2,0,82,255,94,5,86,5,205,0,37,0,47,0,0,37,38,2,53,16,18,
+51,50,22,22,21,20,4,33,22,18,22,51,50,54,53,53,51,21,20,6,35,33,6,6,35,35,
+55,39,51,50,22,23,1,34,6,21,21,54,54,53,52,38,2,55,131,155,225,196,108,158,
+85,254,216,254,230,17,128,192,99,126,141,188,230,227,253,152,20,98,54,39,
+33,33,39,54,97,21,1,164,112,132,221,180,90,137,120,1,163,227,1,13,1,57,77,
+142,88,184,189,190,254,206,172,173,159,78,60,239,246,71,93,230,233,91,73,
+4,185,210,173,13,2,103,116,78,97,0,0,2,0,154,0,0,4,250,5,203,0,27,0,38,0,
+0,33,53,52,38,39,39,38,53,52,54,51,50,22,23,33,19,35,34,38,39,35,6,6,7,22,
+22,21,21,3,34,6,21,20,23,54,54,53,52,38,1,178,60,65,55,100,194,160,165,195,
+11,1,98,41,39,59,97,18,193,31,204,139,72,55,105,81,99,92,134,136,99,193,160,
+240,116,100,180,141,164,189,159,150,254,212,94,70,119,152,13,150,242,137,
+225,5,63,109,91,133,127,16,132,108,92,112,0,0,2,0,82,0,0,4,104,5,205,0,29,
+0,39,0,0,1,38,2,53,52,18,51,50,22,22,21,20,4,33,35,22,18,23,33,19,35,34,38,
+39,33,6,6,35,35,19,1,34,6,21,21,54,54,53,52,38,1,213,109,104,224,198,109,
+159,82,254,229,254,244,18,13,125,101,1,133,41,38,55,97,23,253,148,22,98,54,
+39,41,2,53,114,130,215,187,90,1,43,165,1,79,155,254,1,21,80,138,89,184,189,
+124,254,247,117,254,213,88,76,74,90,1,43,4,23,208,175,13,2,98,121,75,100,
+0,2,0,82,0,0,6,141,5,205,0,32,0,43,0,0,1,38,17,52,54,51,50,22,22,21,20,6,
+7,22,51,51,21,33,19,35,34,38,39,35,17,35,17,33,6,6,35,35,19,1,34,6,21,20,
+23,54,54,53,52,38,2,74,183,203,178,110,156,85,250,221,109,249,250,1,108,41,
+39,66,98,12,190,187,252,232,23,94,55,39,41,2,160,103,100,16,168,176,85,2,
+100,173,1,30,192,222,77,141,89,168,196,7,195,202,254,192,103,81,254,238,1,
+221,76,88,1,43,2,222,137,122,80,57,5,98,112,78,103,0,0,2,0,82,255,92,6,164,
+5,205,0,35,0,46,0,0,1,17,51,54,54,51,51,7,23,35,34,38,39,33,17,33,6,6,35,
+35,19,33,38,17,52,54,51,50,22,22,21,20,6,7,22,51,3,34,6,21,20,23,54,54,53,
+52,38,4,248,217,17,99,56,39,33,33,39,56,100,16,254,108,252,232,23,94,55,39,
+41,1,207,183,203,178,110,156,85,250,221,109,249,227,103,100,16,168,176,85,
+2,100,254,35,67,97,229,234,98,66,1,221,76,88,1,43,173,1,30,192,222,77,141,
+89,168,196,7,195,2,222,137,122,80,57,5,98,112,78,103,0,0,2,0,82,0,0,4,248,
+5,205,0,24,0,35,0,0,1,38,17,52,54,51,50,22,22,21,20,6,7,22,51,33,17,35,17,
+33,6,6,35,35,19,1,34,6,21,20,23,54,54,53,52,38,2,74,183,203,178,110,156,85,
+250,221,106,238,1,8,187,252,232,23,94,55,39,41,2,160,103,100,16,168,176,85,
+2,100,173,1,30,192,222,77,141,89,168,196,7,195,253,156,1,221,76,88,1,43,2,
+222,137,122,80,57,5,98,112,78,103,0,0,3,0,82,255,238,5,74,5,205,0,35,0,45,
+0,57,0,0,1,6,6,35,35,19,33,46,2,53,52,18,51,50,22,22,21,20,4,33,35,18,33,
+51,50,22,21,20,6,35,34,38,53,52,55,3,34,6,21,21,54,54,53,52,38,1,34,6,21,
+20,22,51,50,54,53,52,38,1,37,23,94,55,39,41,1,199,68,120,66,224,197,109,158,
+84,254,230,254,243,19,116,1,128,57,134,137,145,126,126,144,10,67,114,130,
+216,185,87,1,1,53,57,59,51,51,60,59,1,29,76,88,1,43,48,174,206,106,254,1,
+21,79,138,90,182,191,254,127,111,100,108,119,122,105,48,28,4,37,208,175,13,
+2,99,120,74,101,251,245,55,47,57,64,66,55,46,56,0,0,2,0,82,0,0,5,133,5,205,
+0,36,0,46,0,0,1,38,2,53,52,18,51,50,22,22,21,21,33,19,35,34,38,39,35,6,33,
+35,22,18,23,33,19,35,34,38,39,33,6,6,35,35,19,1,34,6,21,21,54,54,53,52,38,
+1,213,109,104,224,198,109,159,82,1,88,41,39,56,96,22,199,100,254,88,18,13,
+125,101,1,133,41,38,55,97,23,253,148,22,98,54,39,41,2,53,114,130,215,187,
+90,1,43,165,1,79,155,254,1,21,80,138,89,7,254,213,90,74,231,124,254,247,117,
+254,213,88,76,74,90,1,43,4,23,208,175,13,2,98,121,75,100,0,2,0,102,0,0,5,
+70,5,205,0,34,0,46,0,0,1,34,6,6,21,21,35,53,52,54,51,51,46,2,53,52,54,51,
+50,22,21,20,6,6,35,22,22,51,33,19,35,34,38,39,1,34,6,21,20,23,23,50,54,53,
+52,38,1,252,92,87,40,187,176,181,147,93,91,45,206,175,160,190,112,212,145,
+66,202,127,1,19,41,39,68,96,12,254,145,100,103,11,6,174,170,88,1,221,47,102,
+88,240,233,200,179,79,133,157,96,187,221,166,141,108,167,90,100,101,254,193,
+104,80,3,101,134,125,63,40,28,97,112,78,103,0,0,2,0,82,255,92,5,154,5,205,
+0,37,0,48,0,0,5,35,34,38,39,33,6,6,35,35,19,33,53,33,6,6,35,35,19,33,38,2,
+53,52,54,51,50,22,21,20,4,7,22,22,51,51,17,33,1,34,6,21,20,23,54,54,53,52,
+38,5,154,39,57,99,18,253,206,19,96,57,38,40,1,101,253,215,23,94,55,39,41,
+1,110,97,124,190,191,163,187,255,0,247,61,214,157,104,1,105,253,34,92,110,
+6,192,162,85,164,94,70,70,94,1,43,215,76,88,1,43,85,1,36,150,232,241,169,
+138,175,191,7,163,157,254,162,4,187,157,157,26,56,7,100,108,78,103,0,2,0,
+82,0,0,4,104,6,20,0,29,0,40,0,0,1,38,2,53,16,37,17,51,17,22,22,21,20,4,7,
+22,22,23,33,19,35,34,38,39,33,6,6,35,35,19,1,34,6,21,20,23,54,54,53,52,38,
+1,217,97,97,1,12,186,131,146,254,251,241,32,92,70,1,129,41,38,55,97,23,253,
+148,22,98,54,39,41,2,35,101,102,6,185,169,88,1,43,132,1,20,131,1,124,64,1,
+18,254,246,17,165,119,172,194,7,88,151,78,254,213,88,76,74,90,1,43,3,90,148,
+157,47,43,4,100,111,75,105,0,0,2,0,82,0,0,6,141,6,20,0,34,0,45,0,0,1,38,53,
+52,54,55,53,51,21,22,22,21,20,6,7,22,51,33,21,33,19,35,34,38,39,35,21,35,
+17,33,6,6,35,35,19,1,34,6,21,20,23,54,54,53,52,38,2,12,121,137,126,186,128,
+155,250,221,78,212,1,62,1,108,41,39,66,98,12,190,187,252,232,23,94,55,39,
+41,2,160,103,100,16,176,168,86,2,47,132,220,156,210,34,245,235,16,165,122,
+168,196,7,88,184,254,192,103,82,240,1,168,76,88,1,43,2,115,136,122,80,57,
+4,104,107,77,103,0,0,2,0,82,255,92,6,164,6,20,0,37,0,48,0,0,1,38,53,52,54,
+55,53,51,21,22,22,21,20,6,7,22,51,33,17,51,54,54,51,51,7,23,35,34,38,39,33,
+17,33,6,6,35,35,19,1,34,6,21,20,23,54,54,53,52,38,2,16,125,137,126,186,128,
+155,250,221,78,212,1,62,217,17,99,56,39,33,33,39,56,100,16,254,108,252,232,
+23,94,55,39,41,2,160,103,100,16,176,168,86,2,47,128,224,156,210,34,245,235,
+16,165,122,168,196,7,88,254,88,67,97,229,234,98,66,1,168,76,88,1,43,2,115,
+136,122,80,57,4,104,107,77,103,0,2,0,82,0,0,4,248,6,20,0,27,0,38,0,0,1,38,
+38,53,52,54,55,53,51,21,22,22,21,20,6,7,22,51,33,17,35,17,33,6,6,35,35,19,
+1,34,6,21,20,23,54,54,53,52,38,2,18,59,68,137,126,186,128,155,250,221,78,
+212,1,62,187,252,232,23,94,55,39,41,2,160,103,100,16,176,168,86,2,47,61,178,
+113,156,210,34,245,235,16,165,122,168,196,7,88,253,209,1,168,76,88,1,43,2,
+115,136,122,80,57,4,104,107,77,103,0,3,0,82,255,238,5,74,6,20,0,36,0,47,0,
+59,0,0,1,6,6,35,35,19,33,38,2,53,52,54,55,53,51,21,22,22,21,20,6,7,22,22,
+51,51,50,22,21,20,6,35,34,38,53,52,55,3,34,6,21,20,23,54,54,53,52,38,1,34,
+6,21,20,22,51,50,54,53,52,38,1,37,23,94,55,39,41,1,158,84,95,137,126,186,
+128,155,250,222,41,158,131,135,134,137,145,126,126,144,10,73,103,100,16,176,
+168,86,1,6,53,57,59,51,51,60,59,1,29,76,88,1,43,89,1,9,137,156,210,34,245,
+235,16,165,122,168,196,7,115,112,111,100,108,119,122,105,48,28,3,133,136,
+122,80,57,4,104,107,77,103,252,149,55,47,57,64,66,55,46,56,0,0,2,0,82,0,0,
+5,115,6,20,0,36,0,47,0,0,1,38,2,53,16,37,17,51,17,22,22,23,33,19,35,34,38,
+39,35,6,6,7,22,22,23,33,19,35,34,38,39,33,6,6,35,35,19,1,34,6,21,20,23,54,
+54,53,52,38,1,217,97,97,1,12,186,119,146,10,1,90,41,39,59,97,18,187,39,250,
+198,32,92,70,1,129,41,38,55,97,23,253,148,22,98,54,39,41,2,35,101,102,6,185,
+169,88,1,43,132,1,20,131,1,124,64,1,18,254,246,16,143,113,254,213,94,70,127,
+135,5,88,151,78,254,213,88,76,74,90,1,43,3,90,148,157,47,43,4,100,111,75,
+105,0,0,2,0,102,0,0,5,70,6,20,0,35,0,47,0,0,1,34,6,6,21,21,35,53,52,54,51,
+51,38,17,52,54,55,17,51,17,22,22,21,20,6,6,35,22,22,51,33,19,35,34,38,39,
+1,34,6,21,20,23,23,50,54,53,52,38,1,252,92,87,40,187,176,181,135,217,150,
+135,186,119,141,109,208,148,60,190,111,1,49,41,39,68,96,12,254,145,100,103,
+11,6,174,170,90,1,59,47,102,88,78,72,200,179,159,1,23,159,208,30,1,14,254,
+244,20,161,118,109,165,90,91,83,254,192,104,80,3,74,134,124,63,40,28,96,113,
+78,102,0,0,2,0,82,255,92,5,154,6,20,0,39,0,51,0,0,1,17,33,19,35,34,38,39,
+33,6,6,35,35,19,33,53,33,6,6,35,35,19,33,38,38,53,52,54,55,17,51,17,22,22,
+21,20,6,7,22,33,1,34,6,21,20,22,23,50,54,53,52,38,4,8,1,105,41,39,57,99,18,
+253,206,19,96,57,38,40,1,101,253,215,23,94,55,39,41,1,104,123,106,148,133,
+186,123,141,229,201,133,1,4,254,209,98,105,16,11,171,163,90,1,207,254,184,
+254,213,94,70,70,94,1,43,193,76,88,1,43,101,218,129,150,195,30,1,14,254,244,
+20,162,117,160,195,9,162,2,182,129,117,31,87,25,102,107,78,102,0,0,2,0,82,
+0,0,4,170,6,68,0,53,0,65,0,0,1,21,22,22,21,20,6,6,7,22,22,23,33,19,35,34,
+38,39,33,6,6,35,35,19,33,38,2,53,52,54,55,53,35,6,6,35,35,55,39,51,50,22,
+23,33,54,54,51,51,7,23,35,34,38,39,1,34,6,21,20,23,23,54,54,53,52,38,2,221,
+127,144,120,214,135,50,65,52,1,129,41,38,55,97,23,253,148,22,98,54,39,41,
+1,94,108,93,142,133,209,20,95,57,39,33,33,39,56,95,21,2,133,22,94,56,39,33,
+33,39,57,94,21,254,193,95,108,15,5,166,174,88,5,66,129,21,162,119,114,165,
+90,3,96,90,58,254,213,88,76,74,90,1,43,148,1,1,125,151,202,30,134,65,79,201,
+201,78,66,69,75,201,201,77,67,254,249,128,113,71,60,23,2,109,104,75,105,0,
+0,2,0,82,0,0,6,141,6,68,0,58,0,69,0,0,1,38,53,52,54,55,53,33,6,6,35,35,55,
+39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,33,21,22,22,21,20,6,6,35,22,
+22,51,33,7,33,19,35,34,38,39,35,21,35,17,33,6,6,35,35,19,1,34,6,21,20,23,
+54,54,53,52,38,2,10,119,138,125,254,241,18,98,56,39,33,33,39,56,98,18,2,215,
+22,94,56,39,33,33,39,57,94,21,254,242,130,153,112,206,131,56,125,87,1,62,
+2,1,110,41,39,67,97,12,190,187,252,232,23,94,55,39,41,2,160,103,100,22,176,
+162,86,1,254,121,217,149,203,35,111,64,80,201,201,79,65,69,75,201,201,77,
+67,101,17,165,121,105,169,95,37,26,168,254,193,102,82,207,1,119,76,88,1,43,
+2,88,136,122,59,78,4,103,108,77,103,0,2,0,82,255,92,6,164,6,68,0,61,0,72,
+0,0,1,38,53,52,54,55,53,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,
+35,34,38,39,33,21,22,22,21,20,6,6,35,22,22,51,33,17,51,54,54,51,51,7,23,35,
+34,38,39,33,17,33,6,6,35,35,19,1,34,6,21,20,23,54,54,53,52,38,2,12,121,138,
+125,254,241,18,98,56,39,33,33,39,56,98,18,2,215,22,94,56,39,33,33,39,57,94,
+21,254,242,130,153,112,206,131,60,135,112,1,23,217,17,99,56,39,33,33,39,56,
+100,16,254,108,252,232,23,94,55,39,41,2,160,103,100,22,176,162,86,1,254,124,
+214,149,203,35,111,64,80,201,201,79,65,69,75,201,201,77,67,101,17,165,121,
+105,169,95,37,26,254,137,67,97,229,234,98,66,1,119,76,88,1,43,2,88,136,122,
+59,78,4,103,108,77,103,0,2,0,82,0,0,5,53,6,68,0,50,0,61,0,0,1,38,53,52,54,
+55,53,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,33,21,
+22,22,21,20,6,6,35,22,22,51,33,17,35,17,33,6,6,35,35,19,1,34,6,21,20,23,54,
+54,53,52,38,2,4,113,138,125,254,241,18,98,56,39,33,33,39,56,98,18,2,215,22,
+94,56,39,33,33,39,57,94,21,254,242,130,153,112,206,131,60,135,112,1,23,187,
+252,232,23,94,55,39,41,2,160,103,100,22,176,162,86,1,254,117,221,149,203,
+35,111,64,80,201,201,79,65,69,75,201,201,77,67,101,17,165,121,105,169,95,
+37,26,254,2,1,119,76,88,1,43,2,88,136,122,59,78,4,103,108,77,103,0,0,3,0,
+82,255,238,5,74,6,68,0,59,0,69,0,81,0,0,1,6,6,35,35,19,33,38,38,53,52,54,
+55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,21,
+22,22,21,20,6,6,7,22,22,51,51,50,22,21,20,6,35,34,38,53,52,55,3,34,6,21,20,
+23,36,53,52,38,1,34,6,21,20,22,51,50,54,53,52,38,1,37,23,94,55,39,41,1,129,
+81,97,140,134,209,18,98,56,39,33,33,39,56,98,18,2,133,22,94,56,39,32,32,39,
+57,94,21,249,126,144,116,200,116,37,153,68,196,134,137,145,126,126,144,10,
+102,93,110,37,1,68,91,1,39,53,57,59,51,51,60,59,1,29,76,88,1,43,79,221,109,
+150,203,30,134,64,80,201,201,79,65,69,75,201,201,77,67,129,21,161,120,109,
+165,94,2,50,75,111,100,108,119,122,105,48,28,3,30,124,103,123,45,15,200,76,
+104,252,252,55,47,57,64,66,55,46,56,0,2,0,82,0,0,5,106,6,68,0,59,0,71,0,0,
+1,21,22,22,23,33,19,35,34,38,39,35,6,6,7,22,22,23,33,19,35,34,38,39,33,6,
+6,35,35,19,33,38,2,53,52,54,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,
+51,51,7,23,35,34,38,39,1,34,6,21,20,23,23,54,54,53,52,38,2,221,108,141,17,
+1,91,40,38,58,97,19,181,31,250,177,50,65,52,1,129,41,38,55,97,23,253,148,
+22,98,54,39,41,1,94,108,93,142,133,209,20,95,57,39,33,33,39,56,95,21,2,133,
+22,94,56,39,33,33,39,57,94,21,254,193,95,108,15,5,166,174,88,5,66,129,17,
+130,103,254,213,92,71,135,151,2,96,90,58,254,213,88,76,74,90,1,43,148,1,1,
+125,151,202,30,134,65,79,201,201,78,66,69,75,201,201,77,67,254,249,128,113,
+71,60,23,2,109,104,75,105,0,0,2,0,102,0,0,5,72,6,68,0,57,0,69,0,0,1,21,22,
+22,21,20,6,7,22,22,51,51,19,35,34,38,39,33,34,6,6,21,21,35,53,52,54,51,51,
+38,38,53,52,54,55,53,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,
+34,38,39,5,34,6,21,20,22,23,54,54,53,52,38,3,80,119,141,231,189,63,168,152,
+238,41,39,68,96,12,253,141,92,87,40,187,176,181,135,94,123,149,136,254,225,
+20,95,57,39,33,33,39,56,95,21,2,254,18,96,58,39,33,33,39,58,97,17,254,139,
+94,109,25,12,165,159,88,5,66,123,20,161,118,158,199,6,74,61,254,192,104,81,
+47,102,89,53,47,200,179,71,231,116,149,200,28,125,65,79,201,201,78,66,64,
+80,201,201,81,63,254,125,103,52,88,22,2,101,106,78,103,0,0,2,0,82,255,92,
+5,195,6,68,0,62,0,74,0,0,1,17,33,19,35,34,38,39,33,6,6,35,35,19,33,53,33,
+6,6,35,35,19,33,38,38,53,52,54,55,53,33,6,6,35,35,55,39,51,50,22,23,33,54,
+54,51,51,7,23,35,34,38,39,33,21,22,22,21,20,6,7,22,22,51,3,34,6,21,20,22,
+23,50,54,53,52,38,4,49,1,105,41,39,57,99,18,253,206,19,96,57,39,41,1,101,
+253,174,23,94,55,39,41,1,102,81,105,147,133,254,230,20,95,57,39,33,33,39,
+56,95,21,2,239,22,95,56,38,32,32,38,56,96,21,254,230,121,141,225,205,48,160,
+87,205,98,105,19,12,162,168,88,1,186,254,205,254,213,94,70,70,94,1,43,172,
+76,88,1,43,71,219,106,161,198,28,121,65,79,201,201,78,66,69,75,201,201,77,
+67,119,20,161,118,159,195,11,56,65,2,142,129,117,34,88,21,96,112,78,103,0,
+0,1,0,82,0,0,3,240,5,182,0,17,0,0,1,52,38,38,35,35,6,6,35,35,19,51,32,4,18,
+21,17,35,3,53,85,203,209,31,23,95,54,39,41,194,1,26,1,26,127,187,3,4,238,
+222,95,74,90,1,43,123,254,239,239,252,197,0,0,1,0,82,0,0,5,131,5,182,0,24,
+0,0,1,52,38,38,35,35,6,6,35,35,19,51,32,4,22,23,33,19,35,34,38,39,35,17,35,
+3,53,85,203,209,31,23,95,54,39,41,194,1,2,1,14,143,16,1,110,41,39,56,96,22,
+190,187,3,4,238,222,95,74,90,1,43,98,220,192,254,213,90,74,252,207,0,1,0,
+82,255,92,5,143,5,182,0,28,0,0,1,52,38,38,35,35,6,6,35,35,19,51,32,4,18,21,
+17,51,54,54,51,51,7,23,35,34,38,39,33,3,53,85,203,209,31,23,95,54,39,41,194,
+1,26,1,26,127,204,21,97,54,39,32,32,39,54,98,20,254,121,3,4,238,222,95,74,
+90,1,43,123,254,239,239,253,76,72,92,229,234,93,71,0,1,0,82,255,92,4,80,5,
+182,0,30,0,0,1,20,6,6,35,33,6,6,35,35,19,33,50,54,53,17,52,38,38,33,35,6,
+6,35,35,19,51,32,4,18,17,4,80,99,214,189,254,203,23,94,55,39,41,1,217,175,
+147,101,237,254,251,26,23,95,54,39,41,237,1,62,1,44,126,2,2,191,220,103,76,
+88,1,43,163,196,1,18,227,231,101,74,90,1,43,122,254,221,254,229,0,2,0,82,
+0,0,5,195,5,182,0,24,0,32,0,0,1,52,38,38,35,35,6,6,35,35,19,51,32,4,18,21,
+17,51,50,22,21,20,6,35,33,19,17,51,50,54,53,52,35,3,53,85,203,209,31,23,95,
+54,39,41,192,1,27,1,28,126,188,129,150,188,171,254,217,187,73,106,105,155,
+3,4,238,222,95,74,90,1,43,123,254,238,238,254,226,138,116,139,148,1,145,254,
+246,71,75,120,0,2,0,82,0,0,5,119,5,182,0,22,0,34,0,0,1,52,38,38,39,22,21,
+20,6,35,34,38,53,52,54,51,33,32,4,18,21,17,35,1,34,6,21,20,22,51,50,54,53,
+52,38,4,188,83,193,182,37,190,165,167,187,180,174,1,33,1,18,1,19,125,187,
+252,248,79,93,95,77,77,95,93,3,4,232,222,98,1,63,82,135,164,161,138,138,144,
+121,254,239,241,252,197,5,63,88,77,81,102,102,81,77,88,0,1,0,82,0,0,3,240,
+6,20,0,21,0,0,1,52,38,38,35,35,6,6,35,35,19,51,50,23,17,51,17,22,18,17,17,
+35,3,53,85,203,209,31,23,95,54,39,41,194,59,52,186,212,182,187,2,68,238,222,
+95,74,90,1,43,4,1,34,254,201,42,254,226,254,230,253,133,0,0,2,0,82,0,0,6,
+170,6,20,0,34,0,46,0,0,1,52,38,38,35,35,6,6,35,35,19,51,50,23,17,51,17,22,
+22,23,33,50,22,21,20,6,35,34,38,53,52,55,35,17,35,1,34,6,21,20,22,51,50,54,
+53,52,38,3,53,85,203,209,31,23,95,54,39,41,194,59,52,186,180,182,23,1,181,
+133,137,142,128,126,145,19,176,187,2,103,52,59,58,53,52,58,59,2,68,238,222,
+95,74,90,1,43,4,1,34,254,201,36,213,201,110,101,107,121,123,105,54,42,253,
+88,2,174,54,48,54,67,65,56,48,54,0,1,0,82,0,0,6,55,5,182,0,30,0,0,1,52,38,
+38,35,35,6,6,35,35,19,51,50,4,22,23,51,53,51,17,51,19,35,34,38,39,35,53,35,
+17,35,3,53,85,203,209,31,23,95,54,39,41,194,250,1,14,145,19,164,187,198,41,
+39,66,98,12,211,157,187,3,4,238,222,95,74,90,1,43,95,211,181,168,254,157,
+254,193,103,81,187,252,184,0,0,1,0,82,0,0,3,240,5,182,0,35,0,0,33,35,17,52,
+38,38,35,35,6,6,35,35,19,51,50,23,23,53,52,38,35,35,6,6,35,35,19,51,50,22,
+22,21,21,22,18,21,3,240,187,88,199,210,31,23,95,54,39,41,194,114,69,35,96,
+124,22,23,95,54,39,41,145,170,194,89,155,132,1,20,212,223,92,74,90,1,43,7,
+3,51,204,144,74,90,1,43,96,209,184,88,62,254,235,241,0,2,0,82,255,92,5,195,
+5,182,0,30,0,38,0,0,33,6,6,35,35,19,33,17,52,38,38,35,35,6,6,35,35,19,51,
+32,4,18,21,17,51,50,22,21,20,6,35,3,17,51,50,54,53,52,35,1,37,23,94,55,39,
+41,2,186,85,203,209,31,23,95,54,39,41,194,1,26,1,26,127,188,129,150,188,171,
+108,73,106,105,155,76,88,1,43,2,125,238,222,95,74,90,1,43,123,254,239,239,
+254,226,138,116,139,148,1,145,254,246,71,75,120,0,0,1,0,82,0,0,6,55,5,182,
+0,28,0,0,1,52,38,38,35,35,6,6,35,35,19,51,32,4,22,23,51,53,51,21,51,19,35,
+34,38,39,33,17,35,3,53,85,203,209,31,23,95,54,39,41,194,1,6,1,18,139,12,161,
+187,198,41,39,66,98,12,254,144,187,3,4,238,222,95,74,90,1,43,103,229,200,
+168,168,254,192,103,82,252,229,0,1,0,82,0,0,4,51,6,68,0,42,0,0,1,52,38,38,
+35,35,6,6,35,35,19,51,23,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,
+7,23,35,34,38,39,35,17,22,18,17,17,35,3,113,85,203,210,31,19,97,56,39,41,
+250,53,192,20,95,57,39,33,33,39,56,95,21,2,59,22,94,56,39,33,33,39,57,94,
+21,192,213,182,186,1,150,238,222,95,68,96,1,43,2,252,65,79,201,201,78,66,
+69,75,201,201,77,67,254,237,43,254,227,254,230,254,51,0,0,1,0,82,0,0,5,190,
+6,68,0,50,0,0,1,52,38,38,35,35,6,6,35,35,19,51,23,53,35,6,6,35,35,55,39,51,
+50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,22,22,23,33,19,35,34,38,39,
+35,23,17,35,3,113,85,203,210,31,19,97,56,39,41,250,53,192,20,95,57,39,33,
+33,39,56,95,21,2,59,22,94,56,39,33,33,39,57,94,21,192,171,180,28,1,123,40,
+38,58,96,21,192,2,186,1,150,238,222,95,68,96,1,43,2,252,65,79,201,201,78,
+66,69,75,201,201,77,67,254,237,34,193,174,254,213,91,73,74,254,51,0,1,0,82,
+255,92,5,203,6,68,0,53,0,0,1,52,38,38,35,35,6,6,35,35,19,51,23,53,35,6,6,
+35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,22,18,17,17,
+51,54,54,51,51,7,23,35,34,38,39,33,3,113,86,204,208,31,19,97,56,39,41,250,
+53,192,20,95,57,39,33,33,39,56,95,21,2,59,22,94,56,39,33,33,39,57,94,21,192,
+213,182,205,17,99,56,39,33,33,39,56,100,16,254,121,1,152,237,221,95,68,96,
+1,43,2,252,65,79,201,201,78,66,69,75,201,201,77,67,254,237,43,254,227,254,
+230,254,186,67,97,229,234,98,66,0,1,0,82,255,92,4,90,6,68,0,54,0,0,1,7,23,
+35,34,38,39,35,17,30,2,21,21,20,6,33,33,6,6,35,35,19,33,50,54,53,53,52,38,
+36,35,35,6,6,35,35,19,33,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,4,
+51,33,33,39,57,94,21,192,158,193,91,233,254,243,254,193,23,94,55,39,41,1,
+225,171,153,120,254,252,218,35,21,98,55,39,41,1,106,192,20,95,57,39,33,33,
+39,56,95,21,2,59,22,94,56,6,68,201,201,77,67,254,245,24,135,224,192,35,248,
+221,76,88,1,43,158,174,27,180,194,95,69,95,1,43,248,65,79,201,201,78,66,69,
+75,0,2,0,82,0,0,5,197,6,68,0,49,0,57,0,0,1,7,23,35,34,38,39,35,17,22,18,23,
+51,50,22,21,20,6,35,33,17,52,38,38,35,35,6,6,35,35,19,51,50,23,53,35,6,6,
+35,35,55,39,51,50,22,23,33,54,54,51,3,17,51,50,54,53,52,35,4,51,33,33,39,
+57,94,21,192,162,165,9,190,129,150,188,171,254,217,86,205,208,31,23,95,54,
+39,41,194,85,83,192,20,95,57,39,33,33,39,56,95,21,2,59,22,94,56,26,73,106,
+105,155,6,68,201,201,77,67,254,225,40,254,245,211,138,116,139,148,1,152,236,
+224,95,74,90,1,43,6,254,65,79,201,201,78,66,69,75,251,77,254,246,71,75,120,
+0,2,0,82,0,0,5,119,6,68,0,48,0,60,0,0,1,52,38,38,39,22,21,20,6,35,34,38,53,
+52,54,51,51,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,
+39,35,21,51,32,4,18,21,17,35,1,34,6,21,20,22,51,50,54,53,52,38,4,188,83,194,
+181,37,190,165,167,187,185,169,99,193,20,95,57,39,33,33,39,56,95,21,2,59,
+22,94,56,39,32,32,39,57,94,21,192,4,1,18,1,18,126,187,252,248,80,92,92,80,
+79,93,92,1,152,232,222,98,1,63,83,135,164,161,138,139,144,248,65,79,201,201,
+78,66,69,75,201,201,77,67,248,122,254,238,239,254,49,3,211,89,77,79,103,102,
+80,77,89,0,2,0,102,0,0,5,2,6,184,0,53,0,63,0,0,1,22,21,20,7,6,6,7,22,22,17,
+17,35,17,52,38,38,35,35,6,6,35,35,19,33,54,55,38,38,53,52,55,35,6,6,35,35,
+55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,5,34,6,21,20,23,54,53,52,
+38,3,174,35,102,40,52,7,213,180,186,90,205,190,64,19,96,57,39,41,1,74,10,
+31,100,127,43,138,17,95,60,39,33,33,39,59,96,17,2,246,21,92,59,39,33,33,39,
+60,92,20,254,133,45,57,133,72,52,5,182,56,73,125,106,42,59,18,37,253,254,
+237,254,94,1,152,186,187,85,67,97,1,43,27,31,17,139,94,89,64,60,83,201,200,
+82,61,66,77,200,201,79,64,24,68,49,108,37,67,84,51,60,0,1,0,184,0,0,6,203,
+5,182,0,28,0,0,1,21,54,54,51,32,17,17,35,17,52,38,38,35,34,6,7,17,35,17,34,
+2,17,17,35,17,16,0,33,4,31,56,162,77,1,133,187,52,114,98,55,141,37,187,250,
+247,187,1,80,1,55,5,182,94,43,51,253,250,252,80,3,119,172,161,78,44,35,251,
+61,5,18,254,247,254,231,253,16,2,219,1,95,1,124,0,0,1,0,184,0,0,8,96,5,182,
+0,36,0,0,1,33,19,35,34,38,39,35,17,35,17,52,38,38,35,34,6,7,17,35,17,34,2,
+17,17,35,17,16,0,33,51,21,54,54,51,32,17,6,203,1,108,41,39,67,97,12,190,187,
+52,114,98,55,141,37,187,250,247,187,1,80,1,55,224,56,162,77,1,133,2,217,254,
+193,102,82,253,174,3,119,172,161,78,44,35,251,61,5,18,254,247,254,231,253,
+16,2,219,1,95,1,124,94,43,51,253,250,0,1,0,184,255,92,8,98,5,182,0,39,0,0,
+1,21,54,54,51,32,17,17,51,54,54,51,51,7,23,35,34,38,39,33,17,52,38,38,35,
+34,6,7,17,35,17,34,2,17,17,35,17,16,0,33,4,31,56,162,77,1,133,196,21,97,54,
+39,32,32,39,54,98,20,254,129,52,114,98,55,141,37,187,250,247,187,1,80,1,55,
+5,182,94,43,51,253,250,252,215,72,92,229,234,93,71,3,119,172,161,78,44,35,
+251,61,5,18,254,247,254,231,253,16,2,219,1,95,1,124,0,1,0,164,0,0,6,182,5,
+182,0,28,0,0,1,21,54,54,51,32,17,17,35,17,52,38,38,35,34,6,7,17,35,17,34,
+2,17,17,35,53,16,0,33,4,10,62,156,77,1,133,186,52,113,99,56,142,36,186,250,
+248,186,1,80,1,55,5,182,94,45,49,253,250,252,80,3,119,167,165,79,45,34,253,
+34,3,45,254,247,254,231,254,245,246,1,95,1,124,0,2,0,184,0,0,8,117,5,182,
+0,35,0,43,0,0,1,21,54,54,51,32,17,17,51,50,22,21,20,6,35,35,17,52,38,38,35,
+34,6,7,17,35,17,34,2,17,17,35,17,16,0,33,1,17,51,50,54,53,52,35,4,31,56,162,
+77,1,133,147,129,150,188,171,254,52,114,98,55,141,37,187,250,247,187,1,80,
+1,55,3,140,33,106,104,155,5,182,94,43,51,253,250,254,109,138,116,139,148,
+3,119,172,161,78,44,35,251,61,5,18,254,247,254,231,253,16,2,219,1,95,1,124,
+251,219,254,246,71,75,120,0,1,0,164,0,0,6,182,5,182,0,34,0,0,33,35,17,35,
+17,39,34,2,21,17,35,53,16,0,33,51,21,54,54,51,50,22,17,17,35,17,52,38,38,
+35,34,6,7,17,51,4,154,187,221,24,190,206,186,1,54,1,36,190,62,196,89,212,
+203,186,55,123,109,68,181,40,222,3,10,2,8,1,254,220,255,254,245,246,1,97,
+1,122,94,41,53,252,254,246,254,53,1,146,185,153,73,46,33,254,206,0,0,1,0,
+184,0,0,6,203,5,182,0,28,0,0,1,21,54,54,51,32,17,17,35,17,52,38,38,35,34,
+6,7,17,35,17,34,2,17,17,35,17,16,0,33,4,31,56,162,77,1,133,187,52,114,98,
+55,141,37,187,250,247,187,1,80,1,55,5,182,94,43,51,253,250,254,53,1,146,172,
+161,78,44,35,253,34,3,45,254,247,254,231,253,16,2,219,1,95,1,124,0,0,1,0,
+164,255,92,8,23,5,182,0,40,0,0,5,35,34,38,39,33,6,6,35,35,19,33,17,52,38,
+38,35,34,6,7,17,35,17,34,2,17,17,35,53,16,0,33,51,21,54,54,51,32,17,17,33,
+8,23,39,57,99,18,253,155,19,96,57,39,41,1,201,52,113,99,56,142,36,186,250,
+248,186,1,80,1,55,223,62,156,77,1,133,1,56,164,94,70,70,94,1,43,2,240,167,
+165,79,45,34,253,34,3,45,254,247,254,231,254,245,246,1,95,1,124,94,45,49,
+253,250,252,215,0,4,0,184,0,0,8,219,5,182,0,49,0,57,0,65,0,73,0,0,19,16,0,
+33,51,21,54,54,51,32,17,17,51,50,22,21,20,6,35,35,17,52,38,38,35,34,6,7,17,
+51,50,22,21,20,6,35,35,17,32,0,17,21,51,50,22,21,20,6,35,35,19,17,51,50,54,
+53,52,35,33,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,184,1,100,1,74,236,
+62,170,85,1,162,148,127,151,185,173,254,57,125,109,63,157,38,147,129,150,
+185,173,254,254,235,254,240,147,129,150,188,171,254,187,32,106,105,155,5,
+102,33,106,105,156,252,201,33,106,105,156,2,219,1,96,1,123,94,43,51,253,250,
+254,109,135,119,138,149,3,119,167,165,79,46,33,253,90,138,116,138,149,5,18,
+254,247,254,231,211,138,116,139,148,1,145,254,246,71,75,120,254,246,71,75,
+120,254,246,71,75,120,0,4,0,184,0,0,8,219,5,182,0,56,0,64,0,72,0,80,0,0,19,
+16,0,33,51,21,54,54,51,32,19,33,19,35,34,38,39,35,17,51,50,22,21,20,6,35,
+35,17,52,38,38,35,34,6,7,17,51,50,22,21,20,6,35,35,17,32,0,17,21,51,50,22,
+21,20,6,35,35,19,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,33,17,51,50,
+54,53,52,35,184,1,100,1,74,236,62,170,85,1,87,61,1,84,41,39,59,97,18,154,
+148,127,151,185,173,254,57,125,109,63,157,38,147,129,150,185,173,254,254,
+235,254,240,147,129,150,188,171,254,187,32,106,105,155,5,102,33,106,105,156,
+252,201,33,106,105,156,2,219,1,96,1,123,94,43,51,254,164,254,213,94,70,254,
+74,135,119,138,149,3,119,167,165,79,46,33,253,90,138,116,138,149,5,18,254,
+247,254,231,211,138,116,139,148,1,145,254,246,71,75,120,254,246,71,75,120,
+254,246,71,75,120,0,3,0,184,255,92,8,201,5,182,0,53,0,61,0,69,0,0,19,16,0,
+33,51,21,54,54,51,32,17,17,51,54,54,51,51,7,23,35,34,38,39,33,17,52,38,38,
+35,34,6,7,17,51,50,22,21,20,6,35,35,17,32,0,17,21,51,50,22,21,20,6,35,35,
+1,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,184,1,100,1,74,236,62,170,
+85,1,162,197,17,99,56,39,33,33,39,56,100,16,254,129,57,125,109,63,157,38,
+147,129,150,185,173,254,254,235,254,240,147,129,150,188,171,254,3,154,33,
+106,105,156,252,201,32,106,105,155,2,219,1,96,1,123,94,43,51,253,250,252,
+215,67,97,229,234,98,66,3,119,167,165,79,46,33,253,90,138,116,138,149,5,18,
+254,247,254,231,211,138,116,139,148,1,145,254,246,71,75,120,254,246,71,75,
+120,0,0,4,0,164,0,0,8,199,5,182,0,47,0,55,0,63,0,73,0,0,19,16,0,33,51,21,
+54,54,51,32,17,17,51,50,22,21,20,6,35,35,17,52,38,38,35,34,6,7,21,51,50,22,
+21,20,6,35,35,17,32,3,51,50,22,21,20,6,35,35,1,17,51,50,54,53,52,35,1,17,
+51,50,54,53,52,35,1,6,21,21,51,50,54,53,52,35,164,1,99,1,75,235,63,174,81,
+1,162,147,129,150,188,171,254,57,125,109,62,154,42,148,128,150,185,173,254,
+254,116,108,103,128,150,185,173,254,3,153,33,106,105,155,2,135,32,106,105,
+155,249,241,8,33,106,105,156,2,219,1,95,1,124,94,44,50,253,250,254,109,138,
+116,139,148,3,119,167,165,79,44,35,193,136,118,138,149,3,45,254,240,136,118,
+138,149,1,146,254,246,70,75,121,254,26,254,246,71,75,120,1,230,51,84,131,
+70,75,121,0,5,0,184,0,0,9,238,5,182,0,62,0,70,0,78,0,86,0,98,0,0,19,16,0,
+33,51,21,54,54,51,32,19,33,50,22,21,20,6,35,34,38,53,52,55,35,17,51,50,22,
+21,20,6,35,35,17,52,38,38,35,34,6,7,17,51,50,22,21,20,6,35,35,17,32,0,17,
+21,51,50,22,21,20,6,35,35,19,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,
+33,17,51,50,54,53,52,35,1,34,6,21,20,22,51,50,54,53,52,38,184,1,100,1,74,
+236,62,170,85,1,124,34,1,178,134,137,145,126,126,144,18,178,148,127,151,185,
+173,254,57,125,109,63,157,38,147,129,150,185,173,254,254,235,254,240,147,
+129,150,188,171,254,187,32,106,105,155,2,135,33,106,105,156,2,135,33,106,
+105,156,1,86,54,56,59,51,51,60,57,2,219,1,96,1,123,94,43,51,254,82,111,100,
+108,119,122,105,53,44,254,135,135,119,138,149,3,119,167,165,79,46,33,253,
+90,138,116,138,149,5,18,254,247,254,231,211,138,116,139,148,1,145,254,246,
+71,75,120,254,246,71,75,120,254,246,71,75,120,2,11,56,47,57,64,66,55,45,58,
+0,0,4,0,164,0,0,9,29,5,182,0,51,0,59,0,67,0,77,0,0,19,16,0,33,51,21,54,54,
+51,50,22,22,23,51,50,22,21,20,6,35,35,17,52,38,35,34,6,7,17,51,17,51,50,22,
+21,20,6,35,35,17,35,17,32,3,51,50,22,21,20,6,35,35,1,17,51,50,54,53,52,35,
+1,17,51,50,54,53,52,35,1,6,21,21,51,50,54,53,52,35,164,1,98,1,76,235,60,185,
+91,130,214,128,10,151,129,150,188,171,254,173,173,80,163,46,222,147,129,150,
+188,171,254,221,254,116,108,103,128,150,185,173,254,6,207,32,106,105,155,
+253,80,32,106,105,155,251,243,8,33,106,105,156,2,219,1,94,1,125,94,42,52,
+111,202,123,138,116,139,148,1,146,215,196,42,37,254,206,254,140,138,116,139,
+148,3,10,2,8,254,240,136,118,138,149,1,146,254,246,70,75,121,254,26,254,246,
+71,75,120,1,230,51,84,131,70,75,121,0,4,0,184,0,0,8,166,5,182,0,49,0,57,0,
+65,0,73,0,0,19,16,0,33,51,21,54,54,51,32,19,51,50,22,21,20,6,35,35,17,52,
+38,38,35,34,6,7,21,51,50,22,21,20,6,35,35,17,34,6,6,21,21,51,50,22,21,20,
+6,35,35,19,17,51,50,54,53,52,35,1,17,51,50,54,53,52,35,33,17,51,50,54,53,
+52,35,184,1,61,1,60,236,62,170,85,1,124,34,151,129,150,188,171,253,57,125,
+109,63,157,38,147,129,150,188,171,254,179,216,100,147,129,150,188,171,254,
+187,32,106,105,155,5,49,33,106,105,156,252,201,32,106,105,155,2,219,1,117,
+1,102,94,43,51,254,76,138,116,139,148,1,146,167,165,79,46,33,193,138,116,
+139,148,3,45,112,221,213,211,138,116,139,148,1,145,254,246,71,75,120,1,230,
+254,246,70,75,121,254,246,70,75,121,0,3,0,164,255,92,8,125,5,182,0,52,0,60,
+0,70,0,0,19,16,0,33,51,21,54,54,51,32,17,17,33,19,35,34,38,39,33,6,6,35,35,
+19,33,17,52,38,38,35,34,6,7,21,51,50,22,21,20,6,35,35,17,32,3,51,50,22,21,
+20,6,35,35,1,17,51,50,54,53,52,35,33,6,21,21,51,50,54,53,52,35,164,1,99,1,
+75,235,63,174,81,1,162,1,55,41,39,57,99,18,253,104,19,96,57,39,41,1,252,57,
+125,109,62,154,42,148,128,150,185,173,254,254,116,108,103,128,150,185,173,
+254,3,153,33,106,105,155,252,208,8,33,106,105,156,2,219,1,95,1,124,94,44,
+50,253,250,252,215,254,213,94,70,70,94,1,43,2,240,167,165,79,44,35,193,136,
+118,138,149,3,45,254,240,136,118,138,149,1,146,254,246,70,75,121,51,84,131,
+70,75,121,0,2,0,102,0,0,3,184,6,20,0,29,0,40,0,0,33,35,18,18,55,38,53,52,
+54,55,53,51,21,22,22,21,20,6,7,22,18,21,21,35,53,16,37,14,2,1,54,53,52,38,
+35,34,6,21,20,22,1,33,187,10,156,156,248,142,114,186,126,151,120,152,163,
+166,186,254,231,79,83,34,1,6,162,99,84,82,98,109,1,6,1,74,102,109,235,121,
+179,24,194,194,19,172,122,104,183,109,52,254,224,221,92,76,1,175,44,70,161,
+220,2,181,89,162,85,106,111,88,94,126,0,2,0,102,0,0,5,55,6,20,0,37,0,48,0,
+0,33,35,18,18,55,38,53,52,54,55,53,51,21,22,22,21,20,6,7,22,23,33,19,35,34,
+38,39,35,22,21,21,35,53,16,37,14,2,1,54,53,52,38,35,34,6,21,20,22,1,33,187,
+10,156,156,248,142,114,186,126,151,120,152,166,79,1,170,41,39,56,96,22,198,
+28,186,254,231,79,83,34,1,6,162,99,84,82,98,109,1,6,1,74,102,109,235,121,
+179,24,194,194,19,172,122,104,183,109,56,140,254,213,90,74,106,124,92,76,
+1,175,44,70,161,220,2,181,89,162,85,106,111,88,94,126,0,0,2,0,102,255,92,
+5,106,6,20,0,39,0,50,0,0,33,35,18,18,55,38,53,52,54,55,53,51,21,22,22,21,
+20,6,7,22,18,23,51,54,54,51,51,7,23,35,34,38,39,33,53,16,37,14,2,1,54,53,
+52,38,35,34,6,21,20,22,1,33,187,10,156,156,248,142,114,186,126,151,120,152,
+151,167,9,226,17,99,56,38,32,32,38,56,100,16,254,102,254,231,79,83,34,1,6,
+162,99,84,82,98,109,1,6,1,74,102,109,235,121,179,24,194,194,19,172,122,104,
+183,109,49,254,251,208,67,97,229,234,98,66,76,1,175,44,70,161,220,2,181,89,
+162,85,106,111,88,94,126,0,2,0,125,0,0,3,184,6,20,0,28,0,39,0,0,37,16,37,
+6,6,7,35,54,54,55,38,53,52,54,55,53,51,21,22,22,21,20,6,7,22,18,21,21,35,
+3,54,53,52,38,35,34,6,21,20,22,2,254,254,231,84,83,7,186,40,140,119,248,142,
+114,186,126,151,120,152,163,166,186,215,162,99,84,82,98,109,76,1,175,44,76,
+169,79,174,216,77,109,235,121,179,24,194,194,19,172,122,104,183,109,52,254,
+224,221,92,3,25,89,162,85,106,111,88,94,126,0,0,3,0,102,255,219,5,127,6,20,
+0,39,0,50,0,62,0,0,33,35,18,18,55,38,53,52,54,55,53,51,21,22,22,21,20,6,7,
+22,23,54,54,51,50,22,21,20,6,35,34,46,2,39,38,38,39,6,6,1,54,53,52,38,35,
+34,6,21,20,22,1,34,6,21,20,22,51,50,54,53,52,38,1,33,187,10,156,156,248,142,
+114,186,126,151,123,149,181,97,28,113,78,135,152,155,132,78,104,74,55,29,
+65,137,93,106,90,1,6,162,99,84,82,98,109,2,153,60,67,69,58,57,66,66,1,6,1,
+74,102,109,235,121,179,24,194,194,19,172,122,104,185,107,63,197,44,57,140,
+116,127,148,43,78,109,67,145,133,15,94,246,2,68,89,162,85,106,111,88,94,126,
+254,54,68,57,61,74,75,60,54,71,0,0,2,0,102,0,0,4,201,6,20,0,36,0,47,0,0,33,
+35,18,18,55,38,53,52,54,55,53,51,21,22,22,23,33,19,35,34,38,39,35,6,6,7,22,
+18,21,21,35,53,16,37,14,2,1,54,53,52,38,35,34,6,21,20,22,1,33,187,10,156,
+156,248,142,114,186,120,147,8,1,35,41,39,59,97,18,135,25,117,112,163,166,
+186,254,231,79,83,34,1,6,162,99,84,82,98,109,1,6,1,74,102,109,235,121,179,
+24,194,194,19,156,114,254,213,94,70,71,133,81,52,254,224,221,92,76,1,175,
+44,70,161,220,2,181,89,162,85,106,111,88,94,126,0,0,2,0,102,0,0,3,172,6,20,
+0,28,0,39,0,0,33,35,18,18,55,38,53,52,54,55,53,51,21,22,22,21,20,6,7,22,22,
+23,35,38,38,39,14,2,1,54,53,52,38,35,34,6,21,20,22,1,33,187,10,156,156,248,
+142,114,186,126,151,123,149,131,164,22,186,33,132,104,79,83,34,1,6,162,99,
+84,82,98,109,1,6,1,74,102,109,235,121,179,24,194,194,19,172,122,104,185,107,
+42,211,154,146,142,17,70,161,220,2,181,89,162,85,106,111,88,94,126,0,2,0,
+125,255,92,4,242,6,20,0,38,0,49,0,0,37,2,37,6,6,7,35,54,54,55,38,53,52,54,
+55,53,51,21,22,22,21,20,6,7,22,18,23,33,19,35,34,38,39,33,6,6,35,35,19,19,
+54,53,52,38,35,34,6,21,20,22,2,252,18,254,251,84,83,7,186,40,140,119,248,
+142,114,186,126,151,120,152,151,167,9,1,19,41,39,57,99,18,254,39,23,94,55,
+39,41,141,162,99,84,82,98,109,135,1,120,40,76,169,79,174,216,77,109,235,121,
+179,24,194,194,19,172,122,104,183,109,49,254,251,208,254,213,94,70,76,88,
+1,43,2,146,89,162,85,106,111,88,94,126,0,0,2,0,102,0,0,4,4,5,203,0,29,0,42,
+0,0,33,35,18,37,38,38,53,52,54,51,50,22,22,21,20,6,6,7,22,18,21,21,35,53,
+52,2,39,6,7,6,1,62,2,53,52,38,35,34,6,21,20,22,1,33,187,4,1,76,118,125,194,
+166,112,160,86,52,99,117,187,196,186,167,163,99,38,86,1,24,75,58,29,99,83,
+82,98,104,2,55,240,53,171,110,161,181,86,150,88,73,124,111,85,67,254,184,
+246,125,94,252,1,22,42,89,85,187,2,86,50,67,82,53,87,104,109,90,92,125,0,
+2,0,102,0,0,5,94,5,203,0,37,0,50,0,0,33,35,18,37,38,38,53,52,54,51,50,22,
+22,21,20,6,6,7,22,23,33,19,35,34,38,39,35,22,21,21,35,53,52,2,39,6,7,6,1,
+62,2,53,52,38,35,34,6,21,20,22,1,33,187,4,1,76,118,125,194,166,112,160,86,
+52,99,117,231,95,1,106,41,39,56,96,22,151,18,186,167,163,99,38,86,1,24,75,
+58,29,99,83,82,98,104,2,55,240,53,171,110,161,181,86,150,88,73,124,111,85,
+82,229,254,213,89,74,92,102,125,94,252,1,22,42,89,85,187,2,86,50,67,82,53,
+87,104,109,90,92,125,0,0,2,0,102,255,92,5,104,5,203,0,39,0,52,0,0,33,35,18,
+37,38,38,53,52,54,51,50,22,22,21,20,6,6,7,22,18,23,51,54,54,51,51,7,23,35,
+34,38,39,33,53,52,2,39,6,7,6,1,62,2,53,52,38,35,34,6,21,20,22,1,33,187,4,
+1,76,118,125,194,166,112,160,86,52,99,117,183,195,5,146,17,99,56,38,32,32,
+38,56,100,16,254,180,167,163,99,38,86,1,24,75,58,29,99,83,82,98,104,2,55,
+240,53,171,110,161,181,86,150,88,73,124,111,85,66,254,197,250,67,97,229,234,
+98,66,94,252,1,22,42,89,85,187,2,86,50,67,82,53,87,104,109,90,92,125,0,2,
+0,125,0,0,4,4,5,203,0,30,0,43,0,0,1,35,54,18,55,38,38,53,52,54,51,50,22,22,
+21,20,6,6,7,22,18,21,21,35,53,52,2,39,14,2,1,62,2,53,52,38,35,34,6,21,20,
+22,1,55,186,37,154,122,118,125,194,166,112,160,86,52,99,117,187,196,186,167,
+161,65,78,60,1,2,75,58,29,99,83,82,98,104,1,12,190,1,6,87,53,171,110,161,
+181,86,150,88,73,124,111,85,67,254,184,246,125,94,252,1,22,42,59,111,188,
+2,83,50,67,82,53,87,104,109,90,92,125,0,0,3,0,102,255,219,5,209,5,203,0,37,
+0,50,0,62,0,0,33,35,18,37,38,38,53,52,54,51,50,22,22,21,20,6,6,7,22,22,23,
+54,51,50,22,21,20,6,35,34,38,39,38,38,39,6,7,6,1,62,2,53,52,38,35,34,6,21,
+20,22,1,34,6,21,20,22,51,50,54,53,52,38,1,33,187,4,1,76,118,125,194,166,112,
+160,86,52,99,117,118,172,60,70,137,135,152,155,132,121,150,38,65,177,139,
+99,38,86,1,24,75,58,29,99,83,82,98,104,2,221,60,67,69,58,57,66,66,2,55,240,
+53,171,110,161,181,86,150,88,73,124,111,85,45,176,144,93,140,116,127,148,
+112,130,213,213,35,89,85,187,2,86,50,67,82,53,87,104,109,90,92,125,253,196,
+68,57,61,74,75,60,54,71,0,2,0,102,0,0,4,213,5,203,0,35,0,48,0,0,33,35,18,
+37,38,38,53,52,54,51,50,22,22,23,33,19,35,34,38,39,35,6,6,7,22,18,21,21,35,
+53,52,2,39,6,7,6,1,62,2,53,52,38,35,34,6,21,20,22,1,33,187,4,1,76,118,125,
+194,166,103,153,91,9,1,29,41,39,56,96,22,127,20,110,122,187,196,186,167,163,
+99,38,86,1,24,75,58,29,99,83,82,98,104,2,55,240,53,171,110,161,181,74,133,
+86,254,213,90,74,69,131,89,67,254,184,246,125,94,252,1,22,42,89,85,187,2,
+86,50,67,82,53,87,104,109,90,92,125,0,2,0,102,0,0,3,250,5,203,0,26,0,39,0,
+0,1,2,37,6,7,6,17,35,18,37,38,38,53,52,54,51,50,22,22,21,20,6,6,7,22,22,23,
+1,62,2,53,52,38,35,34,6,21,20,22,3,61,51,254,246,99,38,86,187,4,1,76,118,
+125,194,166,112,160,86,52,99,117,159,189,25,254,63,75,58,29,99,83,82,98,104,
+1,14,1,76,64,89,85,187,254,207,2,55,240,53,171,110,161,181,86,150,88,73,124,
+111,85,58,255,183,2,121,50,67,82,53,87,104,109,90,92,125,0,2,0,125,255,92,
+5,61,5,203,0,40,0,53,0,0,1,35,54,18,55,38,38,53,52,54,51,50,22,22,21,20,6,
+6,7,22,18,23,33,19,35,34,38,39,33,6,6,35,35,19,33,38,2,39,14,2,1,62,2,53,
+52,38,35,34,6,21,20,22,1,55,186,37,154,122,118,125,194,166,112,160,86,52,
+99,117,183,195,5,1,16,41,38,55,97,23,254,39,19,96,57,39,41,1,99,7,164,155,
+65,78,60,1,2,75,58,29,99,83,82,98,104,1,12,190,1,6,87,53,171,110,161,181,
+86,150,88,73,124,111,85,66,254,197,250,254,213,88,76,70,94,1,43,232,1,2,41,
+59,111,188,2,83,50,67,82,53,87,104,109,90,92,125,0,3,0,164,255,236,4,78,5,
+201,0,13,0,22,0,31,0,0,1,16,2,35,34,2,17,17,16,18,51,50,18,17,7,33,21,20,
+22,51,50,54,53,1,33,53,52,38,35,34,6,21,4,78,246,229,227,236,236,227,228,
+247,187,253,203,138,149,142,136,253,203,2,53,135,143,149,138,2,4,254,251,
+254,237,1,22,1,6,1,164,1,7,1,22,254,236,254,251,244,190,190,177,176,193,1,
+68,112,192,177,178,189,0,3,0,164,255,236,5,154,5,201,0,21,0,30,0,39,0,0,1,
+33,19,35,34,38,39,35,21,16,2,35,34,2,17,17,16,18,51,50,18,17,7,33,21,20,22,
+51,50,54,53,1,33,53,52,38,35,34,6,21,4,78,1,35,41,39,59,97,18,119,246,229,
+227,236,236,227,228,247,187,253,203,138,149,142,136,253,203,2,53,135,143,
+149,138,3,68,254,213,94,69,184,254,251,254,237,1,22,1,6,1,164,1,7,1,22,254,
+236,254,251,244,190,190,177,176,193,1,68,112,192,177,178,189,0,0,3,0,102,
+255,92,4,47,5,203,0,31,0,37,0,43,0,0,1,38,38,53,52,54,51,50,22,21,20,7,14,
+3,7,7,33,54,54,51,51,7,23,35,34,38,39,33,55,54,19,34,6,7,33,38,3,54,54,55,
+33,22,2,12,206,216,217,193,180,205,10,15,71,86,84,27,22,1,22,21,97,54,39,
+33,33,39,54,98,20,254,23,47,34,50,90,113,12,1,170,20,103,31,54,17,254,109,
+38,2,80,22,236,217,195,221,197,172,46,46,85,165,182,212,132,111,72,92,229,
+234,93,71,242,172,3,161,122,105,227,253,162,68,117,59,228,0,0,3,0,102,0,0,
+3,129,5,203,0,20,0,26,0,32,0,0,1,20,7,14,3,7,7,35,55,54,55,38,38,53,52,54,
+51,50,22,1,54,54,55,33,18,19,34,6,7,33,38,3,129,16,19,73,83,78,24,47,186,
+47,34,72,206,216,217,193,180,205,254,205,35,58,17,254,99,23,192,87,112,14,
+1,168,22,4,90,57,64,81,158,176,205,127,246,242,172,178,22,236,217,195,221,
+197,253,219,76,132,65,255,0,2,77,114,105,219,0,4,0,102,0,0,4,53,5,203,0,24,
+0,30,0,36,0,46,0,0,1,20,6,7,6,7,51,50,22,21,20,6,35,33,55,54,55,38,38,53,
+52,54,51,50,22,1,54,54,55,33,18,19,34,6,7,33,38,3,6,6,7,51,50,54,53,52,35,
+3,129,49,100,29,27,107,128,150,185,173,254,164,47,34,72,206,216,217,193,180,
+205,254,205,35,58,17,254,99,23,192,87,112,14,1,168,22,50,9,16,34,102,106,
+105,156,4,90,67,178,204,59,65,136,118,138,149,242,172,178,22,236,217,195,
+221,197,253,219,76,132,65,255,0,2,77,114,105,219,252,82,32,65,169,71,75,120,
+0,3,0,164,255,236,4,78,6,20,0,16,0,25,0,32,0,0,1,16,2,35,34,2,17,53,52,18,
+55,17,51,17,22,18,21,7,33,21,20,22,51,50,54,53,1,34,6,21,33,52,38,4,78,246,
+229,227,236,192,183,186,180,197,187,253,203,138,149,142,136,254,234,150,137,
+2,53,139,2,4,254,251,254,237,1,21,1,7,211,235,1,18,26,1,34,254,220,27,254,
+240,230,129,94,192,177,176,193,2,84,177,190,192,175,0,0,3,0,104,0,0,3,227,
+5,203,0,23,0,28,0,34,0,0,51,18,55,54,55,55,38,38,53,52,54,51,50,22,21,20,
+6,6,7,14,3,7,1,54,55,33,22,19,34,6,7,33,38,104,21,162,87,94,54,111,122,202,
+162,166,176,61,119,119,116,151,81,43,14,1,143,102,17,254,176,23,155,75,88,
+13,1,78,18,1,123,192,100,55,32,36,193,135,164,197,177,169,101,154,122,66,
+65,137,132,176,184,3,98,64,135,178,1,200,91,72,163,0,0,2,0,104,255,72,4,211,
+5,203,0,29,0,39,0,0,33,34,38,53,52,54,54,55,62,3,55,51,6,2,6,7,7,22,22,21,
+20,7,33,19,35,34,38,39,37,50,54,53,52,39,6,6,21,20,1,190,166,176,62,117,120,
+121,147,81,43,14,186,8,92,159,104,54,111,122,70,1,197,41,39,68,96,12,253,
+197,85,95,219,70,53,177,169,100,155,120,67,68,136,132,174,185,181,254,220,
+192,61,32,36,193,136,129,96,254,193,104,80,139,124,104,226,23,45,128,87,217,
+0,2,1,39,255,254,5,68,6,23,0,11,0,48,0,0,1,50,54,53,52,38,35,34,6,21,20,22,
+23,6,6,7,35,54,54,55,38,38,53,52,54,54,55,55,62,3,55,51,14,2,7,22,22,21,20,
+7,33,19,35,34,38,39,2,127,85,95,81,91,73,97,84,238,121,114,29,193,32,98,101,
+120,158,58,111,109,79,95,141,58,36,13,193,9,104,186,96,111,97,69,1,119,41,
+39,59,97,18,2,53,121,107,116,103,135,95,108,109,139,117,187,124,136,181,111,
+16,194,136,99,145,104,47,34,41,88,69,86,74,101,179,121,42,36,157,137,132,
+93,254,213,94,70,0,2,0,104,0,0,4,197,5,203,0,31,0,41,0,0,1,6,2,6,7,7,22,22,
+21,20,7,54,54,53,53,51,21,16,33,33,34,38,53,52,54,54,55,62,3,55,1,50,54,53,
+52,39,6,6,21,20,3,227,8,92,159,104,54,111,122,68,143,146,189,254,18,254,231,
+166,176,62,117,120,121,147,81,43,14,254,152,85,95,219,70,53,5,203,181,254,
+220,192,61,32,36,193,136,129,94,5,169,158,78,60,254,25,177,169,100,155,120,
+67,68,136,132,174,185,250,192,124,104,226,23,45,128,87,217,0,0,2,0,104,0,
+0,4,211,6,23,0,28,0,38,0,0,1,34,38,39,35,17,35,17,35,34,38,53,16,37,62,4,
+55,51,6,6,7,22,21,21,33,19,1,52,35,34,6,21,20,22,51,51,4,172,59,97,18,236,
+186,154,156,186,1,23,22,127,122,89,52,10,192,15,205,185,194,1,152,41,253,
+133,156,65,92,88,98,127,1,6,94,70,254,86,1,170,187,159,1,45,94,7,59,65,80,
+110,71,147,233,73,83,232,230,254,213,2,19,215,128,98,114,107,0,3,0,104,0,
+0,5,180,5,203,0,39,0,49,0,61,0,0,1,6,2,6,7,7,22,22,21,20,7,51,38,53,52,54,
+51,50,22,21,20,6,35,34,39,33,6,35,34,38,53,52,54,54,55,62,3,55,1,50,54,53,
+52,39,6,6,21,20,5,50,54,53,52,38,35,34,6,21,20,22,3,227,8,92,159,104,54,111,
+122,53,166,4,142,128,126,144,137,133,124,65,254,148,82,109,166,176,62,117,
+120,121,147,81,43,14,254,152,85,95,219,70,53,3,135,52,58,59,51,51,60,59,5,
+203,181,254,220,192,61,32,36,193,136,115,85,16,35,107,120,122,105,101,110,
+45,45,177,169,100,155,120,67,68,136,132,174,185,250,192,124,104,226,23,45,
+128,87,217,30,54,48,57,64,66,55,46,56,0,0,2,0,102,0,0,4,178,5,182,0,30,0,
+38,0,0,19,16,0,33,33,19,35,34,38,39,35,34,6,7,30,2,23,33,19,35,34,38,39,35,
+17,35,17,35,32,38,19,20,22,51,51,38,38,39,102,1,89,1,47,1,155,41,39,54,95,
+23,192,199,251,42,185,201,99,11,1,102,41,39,55,95,22,184,186,17,254,253,243,
+187,155,166,8,6,146,177,3,74,1,36,1,72,254,213,90,74,160,159,9,101,211,189,
+254,213,89,74,254,150,1,106,227,1,5,181,171,199,164,11,0,3,0,184,255,72,5,
+8,5,182,0,32,0,44,0,53,0,0,19,16,0,33,51,50,22,21,20,6,35,34,38,53,52,55,
+6,6,21,21,51,50,22,21,20,7,33,19,35,34,38,39,33,1,34,6,21,20,22,51,50,54,
+53,52,38,1,17,51,50,54,53,52,38,35,184,1,69,1,48,119,173,181,186,168,165,
+189,20,110,117,161,149,171,66,1,205,41,39,66,98,12,252,135,2,236,79,93,95,
+77,77,95,93,253,128,92,100,107,106,83,3,35,1,60,1,87,144,138,138,161,164,
+135,67,47,48,250,187,207,149,134,104,80,254,193,103,81,5,63,88,77,81,102,
+102,81,77,88,252,144,254,184,93,85,66,84,0,2,0,82,255,92,5,12,5,182,0,41,
+0,51,0,0,37,17,35,34,38,53,52,54,55,62,2,53,51,20,6,7,7,30,2,23,33,19,35,
+34,38,39,35,17,33,19,35,34,38,39,33,6,6,35,35,19,1,46,2,39,6,21,20,22,51,
+2,129,94,240,225,169,195,94,115,56,188,172,162,51,116,130,60,5,1,168,41,39,
+54,94,24,252,1,168,41,39,55,96,23,253,58,23,94,55,39,41,1,184,4,51,119,143,
+54,139,140,135,1,76,122,140,111,188,98,47,103,109,77,133,228,75,25,14,81,
+150,144,254,213,83,71,254,180,254,213,89,75,76,88,1,43,1,221,115,101,41,3,
+54,66,74,66,0,1,0,102,0,0,5,31,5,182,0,15,0,0,1,19,35,34,38,39,33,17,35,17,
+33,6,6,35,35,19,4,246,41,39,57,99,18,254,213,187,254,213,19,96,57,39,41,5,
+182,254,213,94,70,250,209,5,47,70,94,1,43,0,0,1,0,102,0,0,5,31,5,182,0,23,
+0,0,1,33,19,35,34,38,39,35,17,35,17,33,6,6,35,35,19,33,19,35,34,38,39,33,
+3,31,1,108,41,39,67,97,12,190,187,254,213,19,96,57,39,41,4,103,41,39,57,99,
+18,254,213,2,217,254,193,102,82,253,174,5,47,70,94,1,43,254,213,94,70,0,0,
+1,0,102,255,92,5,31,5,182,0,26,0,0,1,19,35,34,38,39,33,17,51,54,54,51,51,
+7,23,35,34,38,39,33,17,33,6,6,35,35,19,4,246,41,39,57,99,18,254,213,194,21,
+97,54,39,33,33,39,54,98,20,254,131,254,213,19,96,57,39,41,5,182,254,213,94,
+70,251,88,72,92,229,234,93,71,5,47,70,94,1,43,0,1,0,102,255,92,5,31,5,182,
+0,27,0,0,1,19,35,34,38,39,33,17,16,6,35,35,6,6,35,35,19,51,50,54,53,17,33,
+6,6,35,35,19,4,246,41,39,57,99,18,254,213,179,214,80,21,100,62,41,41,213,
+139,117,254,213,19,96,57,39,41,5,182,254,213,94,70,252,211,254,231,233,70,
+94,1,43,160,199,3,65,70,94,1,43,0,2,0,102,0,0,5,31,5,182,0,22,0,30,0,0,1,
+33,6,6,35,35,19,33,19,35,34,38,39,33,17,51,50,22,21,20,6,35,33,19,17,51,50,
+54,53,52,35,2,100,254,213,19,96,57,39,41,4,103,41,39,57,99,18,254,213,188,
+129,150,188,171,254,217,187,73,106,105,155,5,47,70,94,1,43,254,213,94,70,
+252,238,138,116,139,148,1,145,254,246,71,75,120,0,1,0,102,0,0,5,31,5,182,
+0,19,0,0,1,33,6,6,35,35,19,33,19,35,34,38,39,33,17,51,17,35,17,35,2,63,254,
+250,19,96,57,39,41,4,103,41,39,57,99,18,254,176,221,186,222,5,47,70,94,1,
+43,254,213,94,70,254,98,252,111,3,10,0,0,1,0,131,0,0,5,178,5,182,0,27,0,0,
+1,19,35,34,38,39,33,2,1,6,2,21,21,35,53,52,18,55,62,2,55,33,6,6,35,35,19,
+5,137,41,39,55,96,23,254,213,21,254,226,162,160,186,182,234,74,86,44,7,254,
+215,23,94,55,39,41,5,182,254,213,89,75,254,128,254,255,147,254,211,162,76,
+76,205,1,86,221,68,140,147,128,76,88,1,43,0,0,1,0,102,255,92,5,31,5,182,0,
+27,0,0,1,19,35,34,38,39,33,17,33,19,35,34,38,39,33,6,6,35,35,19,33,17,33,
+6,6,35,35,19,4,246,41,39,57,99,18,254,213,1,108,41,39,55,96,23,253,197,23,
+94,55,39,41,1,106,254,213,19,96,57,39,41,5,182,254,213,94,70,251,88,254,213,
+89,75,76,88,1,43,4,168,70,94,1,43,0,1,0,102,255,236,4,227,6,14,0,37,0,0,5,
+32,17,52,54,55,54,54,55,33,3,51,50,22,23,33,54,54,51,51,3,33,2,5,6,6,21,20,
+22,51,50,54,53,53,51,21,20,6,2,57,254,45,174,232,101,107,11,254,182,41,39,
+57,97,18,1,215,22,98,54,39,41,254,217,27,254,234,168,153,147,133,143,160,
+189,242,20,1,120,144,235,162,72,169,113,1,43,95,69,74,90,254,213,254,205,
+178,108,196,106,116,125,154,134,72,49,224,222,0,0,3,0,123,255,94,7,225,6,
+129,0,54,0,65,0,79,0,0,1,17,6,6,35,34,38,53,52,0,51,33,53,33,3,51,50,22,23,
+33,54,54,51,51,3,33,21,33,50,22,21,20,6,7,3,33,54,54,51,51,7,23,35,34,38,
+39,33,53,19,35,34,38,53,55,55,1,50,54,55,17,35,34,6,21,20,22,1,7,7,20,22,
+51,51,62,2,53,52,38,35,3,117,100,193,107,178,184,1,18,226,1,4,254,108,41,
+39,57,97,18,2,135,22,98,54,39,41,254,113,1,88,186,195,44,64,170,1,34,20,98,
+54,39,32,32,39,55,97,20,254,25,158,109,143,156,4,19,253,170,66,96,42,69,156,
+168,101,3,100,19,4,96,126,59,44,26,12,87,91,4,59,253,177,86,76,207,196,218,
+1,12,147,1,43,95,69,74,90,254,213,147,143,146,57,166,156,254,96,70,94,229,
+232,94,68,115,1,127,144,136,68,237,253,154,28,35,2,39,181,173,125,135,2,102,
+215,71,90,74,115,90,66,26,78,75,0,2,0,104,0,0,5,14,6,14,0,42,0,52,0,0,1,50,
+22,23,33,54,54,51,51,3,33,6,7,6,7,7,22,22,21,20,7,51,50,54,53,53,51,21,16,
+33,33,34,38,53,52,54,55,62,2,55,33,3,19,50,54,53,52,39,6,6,21,20,1,223,57,
+97,18,1,174,22,98,54,39,41,254,242,41,129,90,91,54,111,122,68,19,150,153,
+188,254,19,254,198,166,176,135,164,131,175,70,16,254,198,41,9,85,95,219,70,
+53,6,14,95,69,74,90,254,213,233,127,90,47,29,36,193,136,129,94,171,161,78,
+60,254,25,177,169,146,211,85,68,153,134,108,1,43,250,125,124,104,226,23,45,
+128,87,217,0,2,0,147,1,74,1,145,4,154,0,11,0,23,0,0,19,52,54,51,50,22,21,
+20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,147,64,63,61,66,68,59,61,
+66,65,62,61,66,68,59,61,66,1,213,66,73,72,67,66,73,74,2,122,68,72,72,68,66,
+73,74,0,0,4,0,147,1,74,3,121,4,154,0,11,0,23,0,35,0,46,0,0,19,52,54,51,50,
+22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,
+20,6,35,34,38,17,52,51,50,22,21,20,6,35,34,38,147,64,63,61,66,68,59,61,66,
+65,62,61,66,68,59,61,66,1,232,66,61,61,66,68,59,59,68,127,61,66,68,59,59,
+68,1,213,66,73,72,67,66,73,74,2,122,68,72,72,68,66,73,74,254,8,70,69,72,67,
+66,73,70,2,126,140,72,68,66,73,70,0,3,0,147,0,248,2,131,4,174,0,11,0,23,0,
+27,0,0,1,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,
+38,3,53,33,21,1,12,64,63,61,66,68,59,61,66,65,62,61,66,68,59,61,66,121,1,
+240,1,131,66,73,72,67,66,73,74,1,200,68,72,72,68,66,73,74,1,61,168,168,0,
+0,4,0,147,0,135,2,131,5,86,0,10,0,14,0,26,0,30,0,0,1,52,51,50,22,21,20,6,
+35,34,38,3,53,33,21,1,52,54,51,50,22,21,20,6,35,34,38,5,21,33,53,1,12,127,
+63,64,68,59,61,66,121,1,240,254,137,67,60,59,68,66,61,62,65,1,119,254,16,
+3,178,139,72,67,66,73,74,1,61,168,168,253,125,65,74,72,67,67,72,71,184,168,
+168,0,0,3,0,147,0,248,2,131,4,236,0,11,0,23,0,27,0,0,1,52,54,51,50,22,21,
+20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,3,53,33,21,1,12,64,63,61,
+66,68,59,61,66,65,62,61,66,68,59,61,66,121,1,240,1,131,66,73,72,67,66,73,
+74,3,30,68,72,72,68,66,73,74,254,127,168,168,0,0,3,0,147,1,74,4,12,4,154,
+0,11,0,23,0,27,0,0,19,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,
+20,6,35,34,38,1,53,33,21,147,64,63,61,66,68,59,61,66,65,62,61,66,68,59,61,
+66,1,138,1,239,1,213,66,73,72,67,66,73,74,2,122,68,72,72,68,66,73,74,254,
+209,168,168,0,0,3,0,147,0,125,1,145,5,102,0,10,0,21,0,33,0,0,19,52,51,50,
+22,21,20,6,35,34,38,17,52,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,
+20,6,35,34,38,147,127,63,64,68,59,61,66,127,63,64,68,59,61,66,64,63,61,66,
+68,59,61,66,1,8,139,72,67,66,73,74,4,20,139,72,67,66,73,74,254,88,66,73,72,
+67,67,73,74,0,7,0,147,0,125,4,111,5,102,0,10,0,21,0,33,0,45,0,57,0,69,0,80,
+0,0,1,52,51,50,22,21,20,6,35,34,38,17,52,51,50,22,21,20,6,35,34,38,17,52,
+54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,
+50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,17,52,51,50,22,21,
+20,6,35,34,38,2,2,127,63,64,68,59,59,68,127,63,64,68,59,59,68,66,61,61,66,
+68,59,54,73,254,145,64,63,61,66,68,59,61,66,65,62,61,66,68,59,61,66,2,222,
+66,61,61,66,68,59,59,68,127,61,66,68,59,59,68,1,8,139,72,67,66,73,70,4,24,
+139,72,67,66,73,70,254,92,70,69,72,67,67,73,66,211,66,73,72,67,66,73,74,2,
+122,68,72,72,68,66,73,74,254,8,70,69,72,67,66,73,70,2,126,140,72,68,66,73,
+70,0,0,4,0,82,255,92,4,43,6,20,0,11,0,28,0,40,0,52,0,0,37,19,35,34,38,39,
+33,6,6,35,35,19,1,51,7,30,2,21,20,6,35,34,38,53,52,62,2,19,50,54,53,52,38,
+39,6,6,21,20,22,1,19,35,34,38,39,33,6,6,35,35,19,4,2,41,39,55,96,23,253,207,
+23,94,55,39,41,1,123,196,168,137,187,96,211,188,184,203,30,54,83,218,97,120,
+161,163,40,52,104,2,60,41,39,55,96,23,253,207,23,94,55,39,41,135,254,213,
+89,75,76,88,1,43,4,125,235,8,105,175,112,185,204,192,166,61,125,124,133,253,
+106,122,108,130,133,7,58,155,61,107,119,4,133,254,213,89,75,76,88,1,43,0,
+0,5,0,82,255,92,4,43,6,20,0,29,0,40,0,51,0,63,0,75,0,0,19,52,54,54,51,50,
+22,21,20,6,35,34,38,39,7,30,2,23,54,54,51,50,22,21,20,6,35,34,2,1,34,6,7,
+22,22,51,50,53,52,38,3,50,54,53,52,38,35,34,6,7,22,1,19,35,34,38,39,33,6,
+6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,193,101,186,118,148,163,157,138,
+69,127,43,2,1,6,8,5,31,106,72,105,120,134,120,175,205,1,137,63,104,24,32,
+103,45,150,73,79,41,41,45,45,39,62,34,36,2,48,41,39,55,96,23,253,207,23,94,
+55,39,41,3,135,41,39,55,96,23,253,207,23,94,55,39,41,3,16,147,229,124,134,
+118,124,142,41,35,46,84,55,41,8,29,47,111,94,103,116,1,21,2,100,90,82,33,
+43,119,57,72,253,14,44,32,34,44,20,31,103,254,252,254,213,89,75,76,88,1,43,
+5,141,254,213,89,75,76,88,1,43,0,0,3,0,82,255,92,4,43,6,20,0,11,0,23,0,41,
+0,0,37,19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,1,
+35,17,52,18,54,51,51,19,35,34,38,39,35,34,6,6,21,4,2,41,39,55,96,23,253,207,
+23,94,55,39,41,3,135,41,39,55,96,23,253,207,23,94,55,39,41,1,43,186,107,233,
+208,150,41,39,56,98,18,19,126,137,60,135,254,213,89,75,76,88,1,43,5,141,254,
+213,89,75,76,88,1,43,250,240,1,53,224,1,22,133,254,213,97,67,102,232,221,
+0,4,0,82,255,92,4,43,6,20,0,13,0,25,0,37,0,49,0,0,1,20,6,35,34,38,53,53,52,
+54,51,50,22,21,39,38,38,35,34,17,21,16,51,50,54,53,1,19,35,34,38,39,33,6,
+6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,3,117,172,164,153,171,171,153,
+164,172,187,3,68,74,141,141,76,69,1,72,41,39,55,96,23,253,207,23,94,55,39,
+41,3,135,41,39,55,96,23,253,207,23,94,55,39,41,2,227,239,240,255,228,56,230,
+255,239,242,4,176,137,254,211,69,254,186,149,172,253,158,254,213,89,75,76,
+88,1,43,5,141,254,213,89,75,76,88,1,43,0,0,3,0,82,255,92,4,43,6,20,0,40,0,
+52,0,64,0,0,1,34,38,39,33,7,7,6,6,21,20,22,51,33,54,54,51,51,7,23,35,34,38,
+39,33,34,38,53,52,54,54,55,62,2,53,51,20,7,33,19,3,19,35,34,38,39,33,6,6,
+35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,4,4,56,96,22,254,219,29,86,72,65,
+113,121,1,57,16,91,65,39,33,33,39,65,91,16,254,229,250,200,52,102,126,85,
+97,44,188,108,1,61,41,41,41,39,55,96,23,253,207,23,94,55,39,41,3,135,41,39,
+55,96,23,253,207,23,94,55,39,41,2,205,88,74,19,51,41,78,47,74,71,57,66,189,
+192,65,57,129,148,62,99,87,69,46,98,104,80,136,134,254,215,253,186,254,213,
+89,75,76,88,1,43,5,141,254,213,89,75,76,88,1,43,0,4,0,82,255,92,4,43,6,20,
+0,23,0,35,0,47,0,55,0,0,1,51,50,22,21,20,6,35,33,53,1,35,6,6,35,35,55,39,
+51,50,22,23,33,21,19,19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,
+6,35,35,19,1,3,51,50,54,53,52,35,2,227,45,129,150,185,173,254,194,1,23,142,
+15,92,65,39,33,33,39,65,92,15,1,72,174,41,39,55,96,23,253,207,23,94,55,39,
+41,3,135,41,39,55,96,23,253,207,23,94,55,39,41,2,49,109,95,106,105,156,3,
+33,138,116,138,149,115,2,182,56,67,189,190,67,54,114,1,210,254,213,89,75,
+76,88,1,43,250,115,254,213,89,75,76,88,1,43,2,15,254,245,71,75,121,0,0,3,
+0,82,255,92,4,43,6,20,0,33,0,45,0,57,0,0,1,52,38,38,35,35,6,6,35,35,19,51,
+50,22,21,20,7,3,51,54,54,51,51,7,23,35,34,38,39,33,53,19,54,54,1,19,35,34,
+38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,2,119,24,58,47,56,
+19,97,56,38,40,224,159,144,74,113,177,15,92,65,39,33,33,39,65,92,15,254,147,
+121,38,44,1,139,41,39,55,96,23,253,207,23,94,55,39,41,3,135,41,39,55,96,23,
+253,207,23,94,55,39,41,4,10,40,35,19,67,96,1,43,94,109,101,186,254,236,55,
+68,189,190,66,54,115,1,47,98,119,2,47,254,213,89,75,76,88,1,43,250,115,254,
+213,89,75,76,88,1,43,0,3,0,82,255,92,4,166,6,20,0,27,0,39,0,51,0,0,1,17,35,
+6,6,35,35,19,33,19,35,34,38,39,35,17,33,19,35,34,38,39,33,6,6,35,35,19,1,
+19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,2,31,250,
+23,94,55,39,41,4,2,41,39,57,99,18,248,1,102,41,38,55,97,23,253,207,19,96,
+57,39,41,3,135,41,38,55,97,23,253,207,19,96,57,39,41,3,135,41,38,55,97,23,
+253,207,19,96,57,39,41,2,47,1,234,76,88,1,43,254,213,94,70,254,22,254,213,
+88,76,70,94,1,43,3,229,254,213,88,76,70,94,1,43,250,115,254,213,88,76,70,
+94,1,43,0,4,0,82,255,92,4,43,6,20,0,12,0,24,0,36,0,45,0,0,1,17,20,6,35,34,
+38,53,17,51,21,33,53,1,19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,
+6,6,35,35,19,1,50,54,53,17,33,17,20,22,3,121,164,154,154,159,186,1,2,1,68,
+41,39,55,96,23,253,207,23,94,55,39,41,3,135,41,39,55,96,23,253,207,23,94,
+55,39,41,1,203,62,58,254,254,61,4,184,253,176,173,187,189,176,2,75,188,188,
+1,92,254,213,89,75,76,88,1,43,250,115,254,213,89,75,76,88,1,43,1,29,111,122,
+1,37,254,217,110,121,0,3,0,82,255,92,4,43,6,20,0,11,0,23,0,27,0,0,37,19,35,
+34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,1,51,17,35,4,2,
+41,39,55,96,23,253,207,23,94,55,39,41,3,135,41,39,55,96,23,253,207,23,94,
+55,39,41,1,102,187,187,135,254,213,89,75,76,88,1,43,5,141,254,213,89,75,76,
+88,1,43,254,213,252,66,0,0,3,0,82,255,92,4,166,6,20,0,35,0,47,0,59,0,0,1,
+53,52,54,55,54,54,55,33,6,6,35,35,19,33,19,35,34,38,39,35,6,6,7,30,2,23,35,
+46,2,39,6,21,21,1,19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,
+35,35,19,1,2,80,115,47,53,6,254,246,23,94,55,39,41,4,2,41,39,57,99,18,229,
+7,55,55,143,139,85,16,187,11,60,97,114,101,2,131,41,38,55,97,23,253,207,19,
+96,57,39,41,3,135,41,38,55,97,23,253,207,19,96,57,39,41,1,4,45,122,193,138,
+56,137,98,76,88,1,43,254,213,94,70,102,164,76,36,103,174,134,100,124,76,32,
+154,133,45,5,16,254,213,88,76,70,94,1,43,250,115,254,213,88,76,70,94,1,43,
+0,3,0,102,255,92,4,154,6,20,0,31,0,43,0,55,0,0,1,17,20,22,51,50,54,53,53,
+52,54,51,50,22,21,17,35,17,52,38,35,34,6,21,21,20,6,35,34,38,53,17,1,19,35,
+34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,1,33,67,70,61,60,
+164,153,154,160,187,61,76,60,61,164,153,153,161,3,222,41,39,57,99,18,253,
+206,19,96,57,39,41,3,136,41,39,57,99,18,253,206,19,96,57,39,41,4,94,254,66,
+122,110,111,123,178,173,181,182,176,253,180,2,45,111,121,111,123,178,174,
+187,188,177,1,221,252,41,254,213,94,70,70,94,1,43,5,141,254,213,94,70,70,
+94,1,43,0,0,3,0,102,255,92,4,242,6,20,0,34,0,46,0,58,0,0,1,19,35,34,38,39,
+6,6,35,34,38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,51,50,54,53,53,51,
+21,20,7,1,19,19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,
+19,2,252,213,29,78,124,25,27,149,127,150,166,187,72,73,78,76,186,152,77,76,
+187,39,254,235,180,41,38,55,97,23,253,207,19,96,57,39,41,3,135,41,38,55,97,
+23,253,207,19,96,57,39,41,1,4,1,232,60,44,111,106,175,157,217,191,105,89,
+100,111,174,70,203,93,110,70,86,95,92,253,117,5,16,254,213,88,76,70,94,1,
+43,250,115,254,213,88,76,70,94,1,43,0,3,0,82,255,92,4,43,6,20,0,20,0,32,0,
+44,0,0,1,19,35,34,38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,7,3,1,19,35,
+34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,1,211,164,41,165,
+181,186,78,80,76,84,186,49,232,1,117,41,39,55,96,23,253,207,23,94,55,39,41,
+3,135,41,39,55,96,23,253,207,23,94,55,39,41,1,4,1,121,175,155,217,189,100,
+94,102,88,193,64,192,119,253,219,5,16,254,213,89,75,76,88,1,43,250,115,254,
+213,89,75,76,88,1,43,0,0,3,0,82,255,92,4,166,6,20,0,31,0,43,0,55,0,0,1,33,
+6,6,35,35,19,33,19,35,34,38,39,35,7,51,3,33,19,35,34,38,39,33,6,6,35,35,19,
+33,55,35,1,19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,
+2,45,254,248,23,94,55,39,41,4,2,41,39,57,99,18,234,67,147,135,1,143,41,38,
+55,97,23,253,207,19,96,57,39,41,1,62,80,148,2,141,41,38,55,97,23,253,207,
+19,96,57,39,41,3,135,41,38,55,97,23,253,207,19,96,57,39,41,4,25,76,88,1,43,
+254,213,94,70,164,254,186,254,213,88,76,70,94,1,43,191,253,153,254,213,88,
+76,70,94,1,43,5,141,254,213,88,76,70,94,1,43,0,4,0,102,255,92,4,63,6,20,0,
+36,0,48,0,60,0,72,0,0,1,34,38,53,52,55,6,17,21,20,22,51,51,54,54,51,51,7,
+23,35,34,38,39,35,34,38,53,53,16,0,33,51,50,22,21,20,6,19,19,35,34,38,39,
+33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,1,34,6,21,20,22,51,50,54,
+53,52,38,3,8,140,169,4,182,91,103,158,17,90,65,39,33,33,39,65,90,17,180,177,
+182,1,44,1,51,69,150,159,169,129,40,38,55,97,23,253,207,19,96,57,39,41,3,
+136,40,38,55,97,23,253,207,19,96,57,39,41,2,121,61,66,68,59,60,69,68,3,51,
+115,100,29,12,57,254,217,59,87,79,57,66,189,192,65,57,145,134,70,1,14,1,2,
+106,99,102,113,2,225,254,213,88,76,70,94,1,43,250,115,254,213,88,76,70,94,
+1,43,3,215,47,41,42,54,54,42,41,47,0,3,0,82,255,92,6,14,6,20,0,19,0,31,0,
+43,0,0,1,35,17,35,17,35,6,6,35,35,19,33,19,35,34,38,39,35,17,35,1,19,35,34,
+38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,3,135,174,186,250,
+23,94,55,39,41,5,106,41,39,55,96,23,247,187,1,109,41,39,57,99,18,253,207,
+23,96,54,38,41,3,135,41,39,57,99,18,253,207,23,96,54,38,41,4,25,252,235,3,
+21,76,88,1,43,254,213,89,75,252,235,5,16,254,213,94,70,76,88,1,43,250,115,
+254,213,94,70,76,88,1,43,0,0,3,0,82,255,92,4,43,6,20,0,24,0,36,0,48,0,0,1,
+50,22,21,20,7,51,3,35,19,35,55,54,54,53,52,38,38,35,35,6,6,35,35,19,1,19,
+35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,35,35,19,1,244,159,144,
+60,148,227,187,172,143,65,26,34,24,58,47,56,19,97,56,38,40,2,238,41,39,55,
+96,23,253,207,23,94,55,39,41,3,135,41,39,55,96,23,253,207,23,94,55,39,41,
+4,240,94,109,117,133,253,217,1,160,162,63,96,37,40,35,19,67,96,1,43,1,36,
+254,213,89,75,76,88,1,43,250,115,254,213,89,75,76,88,1,43,0,4,0,82,255,92,
+4,43,6,20,0,11,0,23,0,42,0,54,0,0,37,19,35,34,38,39,33,6,6,35,35,19,1,19,
+35,34,38,39,33,6,6,35,35,19,1,53,52,39,38,38,53,52,54,51,50,22,21,20,6,7,
+22,21,21,3,34,6,21,20,22,23,54,54,53,52,38,4,2,41,39,55,96,23,253,207,23,
+94,55,39,41,3,135,41,39,55,96,23,253,207,23,94,55,39,41,1,88,80,42,38,150,
+127,128,142,124,130,53,69,43,52,36,20,54,73,49,135,254,213,89,75,76,88,1,
+43,5,141,254,213,89,75,76,88,1,43,250,240,170,161,168,88,125,56,115,141,134,
+114,116,157,44,142,145,172,3,117,62,47,49,88,47,12,103,63,51,64,0,5,0,82,
+255,92,5,29,6,20,0,40,0,52,0,64,0,76,0,89,0,0,1,53,52,39,5,23,21,35,53,52,
+39,38,38,53,52,54,51,50,22,21,20,6,7,23,37,38,38,53,52,54,51,50,22,21,20,
+6,7,23,22,21,21,19,19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,6,6,
+35,35,19,1,34,6,21,20,22,23,54,54,53,52,38,33,34,6,21,20,22,22,23,54,54,53,
+52,38,3,154,39,254,53,4,186,80,41,39,150,126,129,142,123,139,36,1,179,46,
+30,150,126,127,144,124,130,20,33,16,41,39,55,96,23,253,207,19,96,57,39,41,
+3,135,41,39,55,96,23,253,207,19,96,57,39,41,3,49,40,54,35,20,53,74,46,253,
+46,40,54,4,10,33,55,80,46,1,4,98,114,108,152,68,100,98,163,156,79,122,58,
+115,141,135,113,104,145,48,110,149,93,105,52,115,141,133,115,116,157,44,58,
+96,113,100,5,16,254,213,89,75,70,94,1,43,250,115,254,213,89,75,70,94,1,43,
+3,150,62,47,49,87,48,11,103,64,50,65,62,47,19,33,34,78,13,86,59,50,65,0,0,
+4,0,82,255,92,4,49,6,20,0,7,0,15,0,32,0,44,0,0,37,21,33,6,6,35,35,19,1,21,
+33,6,6,35,35,19,1,51,7,30,2,21,20,6,35,34,38,53,52,62,2,19,50,54,53,52,38,
+39,6,6,21,20,22,4,49,252,244,23,94,55,39,41,3,182,252,244,23,94,55,39,41,
+1,123,196,168,137,187,96,211,188,184,203,30,54,83,218,97,120,161,163,40,52,
+104,135,135,76,88,1,43,5,141,135,76,88,1,43,254,240,235,8,105,175,112,185,
+204,192,166,61,125,124,133,253,106,122,108,130,133,7,58,155,61,107,119,0,
+0,5,0,82,255,92,4,8,6,20,0,7,0,15,0,45,0,56,0,67,0,0,37,21,33,6,6,35,35,19,
+1,21,33,6,6,35,35,19,19,52,54,54,51,50,22,21,20,6,35,34,38,39,7,30,2,23,54,
+54,51,50,22,21,20,6,35,34,2,1,34,6,7,22,22,51,50,53,52,38,3,50,54,53,52,38,
+35,34,6,7,22,4,8,253,29,23,94,55,39,41,3,141,253,29,23,94,55,39,41,70,101,
+186,118,148,163,157,138,69,127,43,2,1,6,8,5,31,106,72,105,120,134,120,175,
+205,1,137,63,104,24,32,103,45,150,73,79,41,41,45,45,39,62,34,36,135,135,76,
+88,1,43,5,141,135,76,88,1,43,252,252,147,229,124,134,118,124,142,41,35,46,
+84,55,41,8,29,47,111,94,103,116,1,21,2,100,90,82,33,43,119,57,72,253,14,44,
+32,34,44,20,31,103,0,3,0,82,255,92,4,33,6,20,0,17,0,25,0,33,0,0,1,35,17,52,
+18,54,51,51,19,35,34,38,39,35,34,6,6,21,1,21,33,6,6,35,35,19,1,21,33,6,6,
+35,35,19,1,166,186,107,233,208,150,41,39,56,98,18,19,126,137,60,2,123,253,
+4,23,94,55,39,41,3,166,253,4,23,94,55,39,41,1,4,1,53,224,1,22,133,254,213,
+97,67,102,232,221,254,133,135,76,88,1,43,5,141,135,76,88,1,43,0,0,4,0,82,
+255,92,3,240,6,20,0,7,0,15,0,29,0,41,0,0,37,21,33,6,6,35,35,19,1,21,33,6,
+6,35,35,19,1,20,6,35,34,38,53,53,52,54,51,50,22,21,39,38,38,35,34,17,21,16,
+51,50,54,53,3,240,253,53,23,94,55,39,41,3,117,253,53,23,94,55,39,41,2,250,
+172,164,153,171,171,153,164,172,187,3,68,74,141,141,76,69,135,135,76,88,1,
+43,5,141,135,76,88,1,43,252,207,239,240,255,228,56,230,255,239,242,4,176,
+137,254,211,69,254,186,149,172,0,3,0,82,255,92,4,125,6,20,0,40,0,48,0,56,
+0,0,1,34,38,39,33,7,7,6,6,21,20,22,51,33,54,54,51,51,7,23,35,34,38,39,33,
+34,38,53,52,54,54,55,62,2,53,51,20,7,33,19,19,21,33,6,6,35,35,19,1,21,33,
+6,6,35,35,19,4,4,56,96,22,254,219,29,86,72,65,125,133,1,33,16,91,65,39,33,
+33,39,65,91,16,254,229,250,200,52,102,126,85,97,44,188,108,1,61,41,82,252,
+168,23,94,55,39,41,4,2,252,168,23,94,55,39,41,2,205,88,74,19,51,41,78,47,
+77,68,57,66,189,192,65,57,129,148,62,99,87,69,46,98,104,80,136,134,254,215,
+253,186,135,76,88,1,43,5,141,135,76,88,1,43,0,4,0,82,255,92,4,125,6,20,0,
+23,0,31,0,39,0,47,0,0,1,51,50,22,21,20,6,35,33,53,1,35,6,6,35,35,55,39,51,
+50,22,23,33,21,1,21,33,6,6,35,35,19,1,21,33,6,6,35,35,19,1,3,51,50,54,53,
+52,35,2,227,45,129,150,185,173,254,194,1,23,142,15,92,65,39,33,33,39,65,92,
+15,1,72,1,41,252,168,23,94,55,39,41,4,2,252,168,23,94,55,39,41,2,49,109,95,
+106,105,156,3,33,138,116,138,149,115,2,182,56,67,189,190,67,54,114,252,69,
+135,76,88,1,43,5,141,135,76,88,1,43,252,130,254,245,71,75,121,0,3,0,82,255,
+92,4,61,6,20,0,33,0,41,0,49,0,0,1,52,38,38,35,35,6,6,35,35,19,51,50,22,21,
+20,7,3,51,54,54,51,51,7,23,35,34,38,39,33,53,19,54,54,1,21,33,6,6,35,35,19,
+1,21,33,6,6,35,35,19,2,119,24,58,47,56,19,97,56,38,40,224,159,144,74,113,
+177,15,92,65,39,33,33,39,65,92,15,254,149,119,38,44,1,198,252,232,23,94,55,
+39,41,3,194,252,232,23,94,55,39,41,4,10,40,35,19,67,96,1,43,94,109,101,186,
+254,236,55,68,189,190,66,54,115,1,47,98,119,2,47,135,76,88,1,43,250,115,135,
+76,88,1,43,0,3,0,82,255,92,4,248,6,20,0,27,0,35,0,43,0,0,1,17,35,6,6,35,35,
+19,33,19,35,34,38,39,35,17,33,19,35,34,38,39,33,6,6,35,35,19,1,21,33,6,6,
+35,35,19,1,21,33,6,6,35,35,19,2,31,250,23,94,55,39,41,4,2,41,39,57,99,18,
+248,1,102,41,38,55,97,23,253,207,19,96,57,39,41,4,64,252,106,19,96,57,39,
+41,4,64,252,106,19,96,57,39,41,2,47,1,234,76,88,1,43,254,213,94,70,254,22,
+254,213,88,76,70,94,1,43,3,229,135,70,94,1,43,250,115,135,70,94,1,43,0,4,
+0,82,255,92,4,49,6,20,0,12,0,20,0,28,0,37,0,0,1,17,20,6,35,34,38,53,17,51,
+21,33,53,1,21,33,6,6,35,35,19,1,21,33,6,6,35,35,19,1,50,54,53,17,33,17,20,
+22,3,121,164,154,154,159,186,1,2,1,115,252,244,23,94,55,39,41,3,182,252,244,
+23,94,55,39,41,1,203,62,58,254,254,61,4,184,253,176,173,187,189,176,2,75,
+188,188,1,92,135,76,88,1,43,250,115,135,76,88,1,43,1,29,111,122,1,37,254,
+217,110,121,0,3,0,82,255,92,3,84,6,20,0,7,0,15,0,19,0,0,37,21,33,6,6,35,35,
+19,1,21,33,6,6,35,35,19,1,51,17,35,3,84,253,209,23,94,55,39,41,2,217,253,
+209,23,94,55,39,41,1,102,187,187,135,135,76,88,1,43,5,141,135,76,88,1,43,
+254,213,252,66,0,0,3,0,82,255,92,4,248,6,20,0,35,0,43,0,51,0,0,1,53,52,54,
+55,54,54,55,33,6,6,35,35,19,33,19,35,34,38,39,35,6,6,7,30,2,23,35,46,2,39,
+6,21,21,1,21,33,6,6,35,35,19,1,21,33,6,6,35,35,19,1,2,80,115,47,53,6,254,
+246,23,94,55,39,41,4,2,41,39,57,99,18,229,7,55,55,143,139,85,16,187,11,60,
+97,114,101,3,60,252,106,19,96,57,39,41,4,64,252,106,19,96,57,39,41,1,4,45,
+122,193,138,56,137,98,76,88,1,43,254,213,94,70,102,164,76,36,103,174,134,
+100,124,76,32,154,133,45,5,16,135,70,94,1,43,250,115,135,70,94,1,43,0,3,0,
+102,255,92,5,0,6,20,0,7,0,15,0,47,0,0,1,21,33,6,6,35,35,19,1,21,33,6,6,35,
+35,19,19,17,20,22,51,50,54,53,53,52,54,51,50,22,21,17,35,17,52,38,35,34,6,
+21,21,20,6,35,34,38,53,17,5,0,252,102,19,96,57,39,41,4,68,252,102,19,96,57,
+39,41,101,67,70,61,60,164,153,154,160,187,61,76,60,61,164,153,153,161,6,20,
+135,70,94,1,43,250,115,135,70,94,1,43,3,215,254,66,122,110,111,123,178,173,
+181,182,176,253,180,2,45,111,121,111,123,178,174,187,188,177,1,221,0,3,0,
+102,255,92,5,76,6,20,0,34,0,42,0,50,0,0,1,19,35,34,38,39,6,6,35,34,38,53,
+53,51,21,20,22,51,50,54,53,53,51,21,20,51,50,54,53,53,51,21,20,7,1,1,21,33,
+6,6,35,35,19,1,21,33,6,6,35,35,19,2,252,213,29,78,124,25,27,149,127,150,166,
+187,72,73,78,76,186,152,77,76,187,39,254,235,1,150,252,65,19,96,57,39,41,
+4,105,252,65,19,96,57,39,41,1,4,1,232,60,44,111,106,175,157,217,191,105,89,
+100,111,174,70,203,93,110,70,86,97,94,253,121,5,16,135,70,94,1,43,250,115,
+135,70,94,1,43,0,0,3,0,82,255,92,4,12,6,20,0,20,0,28,0,36,0,0,1,19,35,34,
+38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,7,3,1,21,33,6,6,35,35,19,1,21,
+33,6,6,35,35,19,1,211,164,41,165,181,186,78,80,76,84,186,43,238,1,127,253,
+25,23,94,55,39,41,3,145,253,25,23,94,55,39,41,1,4,1,121,175,155,217,189,100,
+94,102,88,193,64,194,103,253,205,5,16,135,76,88,1,43,250,115,135,76,88,1,
+43,0,0,3,0,82,255,92,4,248,6,20,0,7,0,15,0,47,0,0,1,21,33,6,6,35,35,19,1,
+21,33,6,6,35,35,19,1,33,6,6,35,35,19,33,19,35,34,38,39,35,7,51,3,33,19,35,
+34,38,39,33,6,6,35,35,19,33,55,35,4,248,252,106,19,96,57,39,41,4,64,252,106,
+19,96,57,39,41,1,117,254,248,23,94,55,39,41,4,2,41,39,57,99,18,234,67,147,
+135,1,143,41,38,55,97,23,253,207,19,96,57,39,41,1,62,80,148,6,20,135,70,94,
+1,43,250,115,135,70,94,1,43,3,146,76,88,1,43,254,213,94,70,164,254,186,254,
+213,88,76,70,94,1,43,191,0,4,0,102,255,92,4,145,6,20,0,36,0,44,0,52,0,64,
+0,0,1,34,38,53,52,55,6,17,21,20,22,51,51,54,54,51,51,7,23,35,34,38,39,35,
+34,38,53,53,16,0,33,51,50,22,21,20,6,19,21,33,6,6,35,35,19,1,21,33,6,6,35,
+35,19,1,34,6,21,20,22,51,50,54,53,52,38,3,8,140,169,4,182,91,103,158,17,90,
+65,39,33,33,39,65,90,17,180,177,182,1,44,1,51,69,150,159,169,251,252,168,
+19,96,57,39,41,4,2,252,168,19,96,57,39,41,2,121,61,66,68,59,60,69,68,3,51,
+115,100,29,12,57,254,217,59,87,79,57,66,189,192,65,57,145,134,70,1,14,1,2,
+106,99,102,113,2,225,135,70,94,1,43,250,115,135,70,94,1,43,3,215,47,41,42,
+54,54,42,41,47,0,3,0,82,255,92,6,96,6,20,0,19,0,27,0,35,0,0,1,35,17,35,17,
+35,6,6,35,35,19,33,19,35,34,38,39,35,17,35,1,21,33,6,6,35,35,19,1,21,33,6,
+6,35,35,19,3,135,174,186,250,23,94,55,39,41,5,106,41,39,55,96,23,247,187,
+2,217,251,183,23,96,54,38,41,4,243,251,183,23,96,54,38,41,4,25,252,235,3,
+21,76,88,1,43,254,213,89,75,252,235,5,16,135,76,88,1,43,250,115,135,76,88,
+1,43,0,0,3,0,82,255,92,3,250,6,20,0,7,0,15,0,40,0,0,1,21,33,6,6,35,35,19,
+1,21,33,6,6,35,35,19,1,50,22,21,20,7,51,3,35,19,35,55,54,54,53,52,38,38,35,
+35,6,6,35,35,19,3,250,253,43,23,94,55,39,41,3,127,253,43,23,94,55,39,41,1,
+121,159,144,60,148,227,187,172,143,65,26,34,24,58,47,56,19,97,56,38,40,6,
+20,135,76,88,1,43,250,115,135,76,88,1,43,4,105,94,109,117,133,253,217,1,160,
+162,63,96,37,40,35,19,67,96,1,43,0,4,0,82,255,92,3,250,6,20,0,7,0,15,0,34,
+0,46,0,0,37,21,33,6,6,35,35,19,1,21,33,6,6,35,35,19,1,53,52,39,38,38,53,52,
+54,51,50,22,21,20,6,7,22,21,21,3,34,6,21,20,22,23,54,54,53,52,38,3,250,253,
+43,23,94,55,39,41,3,127,253,43,23,94,55,39,41,1,88,80,42,38,150,127,128,142,
+124,130,53,69,43,52,36,20,54,73,49,135,135,76,88,1,43,5,141,135,76,88,1,43,
+250,240,170,161,168,88,125,56,115,141,134,114,116,157,44,142,145,172,3,117,
+62,47,49,88,47,12,103,63,51,64,0,5,0,82,255,92,5,111,6,20,0,40,0,48,0,56,
+0,68,0,81,0,0,1,53,52,39,5,23,21,35,53,52,39,38,38,53,52,54,51,50,22,21,20,
+6,7,23,37,38,38,53,52,54,51,50,22,21,20,6,7,23,22,21,21,1,21,33,6,6,35,35,
+19,1,21,33,6,6,35,35,19,1,34,6,21,20,22,23,54,54,53,52,38,33,34,6,21,20,22,
+22,23,54,54,53,52,38,3,154,39,254,53,4,186,80,41,39,150,126,129,142,123,139,
+36,1,179,46,30,150,126,127,144,124,130,20,33,1,27,252,24,19,96,57,39,41,4,
+146,252,24,19,96,57,39,41,3,49,40,54,35,20,53,74,46,253,46,40,54,4,10,33,
+55,80,46,1,4,98,114,108,152,68,100,98,163,156,79,122,58,115,141,135,113,104,
+145,48,110,149,93,105,52,115,141,133,115,116,157,44,58,96,113,100,5,16,135,
+70,94,1,43,250,115,135,70,94,1,43,3,150,62,47,49,87,48,11,103,64,50,65,62,
+47,19,33,34,78,13,86,59,50,65,0,4,0,0,0,0,4,8,6,20,0,3,0,7,0,24,0,36,0,0,
+53,33,21,33,17,33,21,33,5,51,7,30,2,21,20,6,35,34,38,53,52,54,54,55,19,50,
+54,53,52,38,39,6,6,21,20,22,4,8,251,248,4,8,251,248,1,205,196,168,137,187,
+96,211,188,184,203,54,81,88,162,97,120,161,163,40,52,104,135,135,6,20,135,
+137,235,8,105,175,112,185,204,192,166,85,163,148,119,253,34,122,108,130,133,
+7,58,155,61,107,119,0,0,5,0,0,0,0,3,195,6,20,0,3,0,7,0,36,0,47,0,58,0,0,53,
+33,21,33,17,33,21,33,19,52,54,54,51,50,22,21,20,6,35,34,38,39,7,30,2,23,54,
+51,50,22,21,20,6,35,34,2,1,34,6,7,22,22,51,50,53,52,38,3,50,54,53,52,38,35,
+34,6,7,22,3,195,252,61,3,195,252,61,123,101,186,118,149,163,157,138,70,126,
+44,2,1,6,9,5,81,127,106,120,136,118,178,203,1,137,65,105,20,31,103,46,149,
+73,78,40,42,45,45,40,62,34,36,135,135,6,20,135,253,131,147,229,124,133,119,
+124,142,40,36,46,84,56,38,10,76,112,93,104,115,1,25,2,96,93,79,33,43,119,
+57,72,253,14,44,32,34,44,21,30,103,0,0,3,0,0,0,0,3,217,6,20,0,3,0,7,0,25,
+0,0,53,33,21,33,17,33,21,33,1,35,17,52,18,54,51,51,19,35,34,38,39,35,34,6,
+6,21,3,217,252,39,3,217,252,39,1,94,186,107,233,209,149,41,39,54,95,23,18,
+127,137,60,135,135,6,20,135,251,119,1,53,224,1,22,133,254,213,90,74,103,230,
+222,0,4,0,0,0,0,3,137,6,20,0,3,0,7,0,21,0,33,0,0,53,33,21,33,17,33,21,33,
+1,20,6,35,34,38,53,53,52,18,51,50,22,21,39,38,38,35,34,17,21,16,51,50,54,
+53,3,137,252,119,3,137,252,119,3,14,172,164,154,169,169,154,164,172,186,3,
+69,73,142,142,76,69,135,135,6,20,135,253,86,239,240,255,228,56,229,1,0,239,
+242,4,176,137,254,211,69,254,186,150,171,0,0,3,0,0,0,0,4,84,6,20,0,40,0,44,
+0,48,0,0,1,34,38,39,33,7,7,6,6,21,20,22,51,33,54,54,51,51,7,23,35,34,38,39,
+33,34,38,53,52,54,54,55,62,2,53,51,20,7,33,19,1,33,21,33,17,33,21,33,3,219,
+56,96,22,254,219,28,87,72,65,125,133,1,33,16,91,65,39,33,33,39,65,91,16,254,
+199,226,194,52,102,126,85,97,44,188,108,1,61,41,251,254,4,84,251,172,4,84,
+251,172,2,205,88,74,19,51,40,79,47,77,68,57,66,189,192,65,57,131,146,62,99,
+87,69,46,98,104,80,136,134,254,215,253,186,135,6,20,135,0,0,4,0,0,0,0,3,150,
+6,20,0,23,0,27,0,31,0,39,0,0,1,51,50,22,21,20,6,35,33,53,1,35,6,6,35,35,55,
+39,51,50,22,23,33,21,1,33,21,33,17,33,21,33,1,3,51,50,54,53,52,35,1,252,45,
+128,150,185,173,254,193,1,24,141,16,91,65,39,33,33,39,65,91,16,1,72,253,147,
+3,150,252,106,3,150,252,106,1,197,109,94,106,105,155,3,33,136,118,138,149,
+115,2,182,56,67,189,190,67,54,114,252,69,135,6,20,135,253,9,254,245,71,75,
+121,0,3,0,0,0,0,3,164,6,20,0,33,0,37,0,41,0,0,1,52,38,38,35,35,6,6,35,35,
+19,51,50,22,21,20,7,3,51,54,54,51,51,7,23,35,34,38,39,33,53,19,54,54,1,33,
+21,33,17,33,21,33,1,221,24,58,47,55,24,95,53,39,41,223,159,144,74,112,176,
+15,92,65,39,33,33,39,65,92,15,254,145,123,40,42,254,35,3,164,252,92,3,164,
+252,92,4,10,40,35,19,74,89,1,43,94,109,106,181,254,236,55,68,189,190,66,54,
+115,1,47,98,119,2,47,135,250,250,135,0,3,0,0,0,0,4,248,6,20,0,27,0,31,0,35,
+0,0,1,17,35,6,6,35,35,19,33,19,35,34,38,39,35,17,33,19,35,34,38,39,33,6,6,
+35,35,19,3,33,21,33,17,33,21,33,2,31,250,23,94,55,39,41,4,2,41,39,57,99,18,
+248,1,102,41,38,55,97,23,253,207,19,96,57,39,41,184,4,248,251,8,4,248,251,
+8,2,47,1,234,76,88,1,43,254,213,94,70,254,22,254,213,88,76,70,94,1,43,3,229,
+135,250,250,135,0,0,4,0,0,0,0,3,231,6,20,0,12,0,16,0,20,0,29,0,0,1,17,20,
+6,35,34,38,53,17,51,21,33,53,1,33,21,33,17,33,21,33,1,50,54,53,17,33,17,20,
+22,3,47,164,153,153,161,187,1,2,253,139,3,231,252,25,3,231,252,25,1,252,61,
+60,254,254,66,4,184,253,176,173,187,188,177,2,75,188,188,251,207,135,6,20,
+135,252,23,111,122,1,37,254,217,121,110,0,3,0,0,0,0,2,43,6,20,0,3,0,7,0,11,
+0,0,53,33,21,33,17,33,21,33,23,51,17,35,2,43,253,213,2,43,253,213,184,187,
+187,135,135,6,20,135,164,252,66,0,0,3,0,0,0,0,4,248,6,20,0,35,0,39,0,43,0,
+0,1,53,52,54,55,54,54,55,33,6,6,35,35,19,33,19,35,34,38,39,35,6,6,7,30,2,
+23,35,46,2,39,6,21,21,5,33,21,33,17,33,21,33,1,2,80,115,47,53,6,254,246,23,
+94,55,39,41,4,2,41,39,57,99,18,229,7,55,55,143,139,85,16,187,11,60,97,114,
+101,254,68,4,248,251,8,4,248,251,8,1,4,45,122,193,138,56,137,98,76,88,1,43,
+254,213,94,70,102,164,76,36,103,174,134,100,124,76,32,154,133,45,125,135,
+6,20,135,0,0,3,0,0,0,0,5,0,6,20,0,3,0,7,0,39,0,0,17,33,21,33,17,33,21,33,
+1,17,20,22,51,50,54,53,53,52,54,51,50,22,21,17,35,17,52,38,35,34,6,21,21,
+20,6,35,34,38,53,17,5,0,251,0,5,0,251,0,1,33,67,70,61,60,164,153,154,160,
+187,61,76,60,61,164,153,153,161,6,20,135,250,250,135,4,94,254,66,122,110,
+111,123,178,173,181,182,176,253,180,2,45,111,121,111,123,178,174,187,188,
+177,1,221,0,0,3,0,0,0,0,5,88,6,20,0,34,0,38,0,42,0,0,1,19,35,34,38,39,6,6,
+35,34,38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,51,50,54,53,53,51,21,20,
+7,1,1,33,21,33,17,33,21,33,2,252,213,29,78,124,25,27,149,127,150,166,187,
+72,73,78,76,186,152,77,76,187,39,254,235,252,74,5,88,250,168,5,88,250,168,
+1,4,1,232,60,44,111,106,175,157,217,191,105,89,100,111,174,70,203,93,110,
+70,86,93,94,253,117,5,16,135,250,250,135,0,0,3,0,0,0,0,3,127,6,20,0,20,0,
+24,0,28,0,0,1,19,35,34,38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,7,3,1,
+33,21,33,17,33,21,33,1,70,163,40,165,182,187,78,79,76,84,187,48,233,254,0,
+3,127,252,129,3,127,252,129,1,4,1,121,176,154,217,189,99,95,102,88,193,64,
+194,111,253,213,5,16,135,250,250,135,0,0,3,0,0,0,0,4,248,6,20,0,3,0,7,0,39,
+0,0,17,33,21,33,17,33,21,33,1,33,6,6,35,35,19,33,19,35,34,38,39,35,7,51,3,
+33,19,35,34,38,39,33,6,6,35,35,19,33,55,35,4,248,251,8,4,248,251,8,2,45,254,
+248,23,94,55,39,41,4,2,41,39,57,99,18,234,67,147,135,1,143,41,38,55,97,23,
+253,207,19,96,57,39,41,1,62,80,148,6,20,135,250,250,135,4,25,76,88,1,43,254,
+213,94,70,164,254,186,254,213,88,76,70,94,1,43,191,0,4,0,0,0,0,4,145,6,20,
+0,36,0,40,0,44,0,56,0,0,1,34,38,53,52,55,6,17,21,20,22,51,51,54,54,51,51,
+7,23,35,34,38,39,35,34,38,53,53,16,0,33,51,50,22,21,20,6,1,33,21,33,17,33,
+21,33,1,34,6,21,20,22,51,50,54,53,52,38,3,8,140,169,4,182,91,103,158,17,90,
+65,39,33,33,39,65,90,17,180,177,182,1,44,1,51,69,150,159,169,252,106,4,145,
+251,111,4,145,251,111,3,8,61,66,68,59,60,69,68,3,51,115,100,29,12,57,254,
+217,59,87,79,57,66,189,192,65,57,145,134,70,1,14,1,2,106,99,102,113,2,225,
+135,250,250,135,4,94,47,41,42,54,54,42,41,47,0,0,3,0,0,0,0,6,96,6,20,0,19,
+0,23,0,27,0,0,1,35,17,35,17,35,6,6,35,35,19,33,19,35,34,38,39,35,17,35,5,
+33,21,33,17,33,21,33,3,135,174,186,250,23,94,55,39,41,5,106,41,39,55,96,23,
+247,187,252,121,6,96,249,160,6,96,249,160,4,25,252,235,3,21,76,88,1,43,254,
+213,89,75,252,235,125,135,6,20,135,0,3,0,0,0,0,3,55,6,20,0,3,0,7,0,32,0,0,
+17,33,21,33,17,33,21,33,1,50,22,21,20,6,7,51,3,35,19,35,54,54,53,52,38,38,
+35,35,6,6,35,35,19,3,55,252,201,3,55,252,201,1,90,159,144,24,35,147,227,186,
+172,144,104,21,24,58,47,55,24,95,53,39,41,6,20,135,250,250,135,4,240,94,109,
+54,109,87,253,217,1,160,254,74,30,40,35,19,74,89,1,43,0,4,0,0,0,0,3,25,6,
+20,0,3,0,7,0,26,0,38,0,0,53,33,21,33,17,33,21,33,1,53,52,39,38,38,53,52,54,
+51,50,22,21,20,6,7,22,21,21,3,34,6,21,20,22,23,54,54,53,52,38,3,25,252,231,
+3,25,252,231,1,27,80,42,38,150,126,127,144,124,130,53,70,43,51,35,20,53,74,
+46,135,135,6,20,135,251,119,170,161,168,88,125,56,115,141,133,115,116,157,
+44,149,138,172,3,117,63,46,49,87,48,11,103,64,50,65,0,5,0,0,0,0,5,111,6,20,
+0,40,0,44,0,48,0,60,0,73,0,0,1,53,52,39,5,23,21,35,53,52,39,38,38,53,52,54,
+51,50,22,21,20,6,7,23,37,38,38,53,52,54,51,50,22,21,20,6,7,23,22,21,21,1,
+33,21,33,17,33,21,33,1,34,6,21,20,22,23,54,54,53,52,38,33,34,6,21,20,22,22,
+23,54,54,53,52,38,3,154,39,254,53,4,186,80,41,39,150,126,129,142,123,139,
+36,1,179,46,30,150,126,127,144,124,130,20,33,251,172,5,111,250,145,5,111,
+250,145,4,14,40,54,35,20,53,74,46,253,46,40,54,4,10,33,55,80,46,1,4,98,114,
+108,152,68,100,98,163,156,79,122,58,115,141,135,113,104,145,48,110,149,93,
+105,52,115,141,133,115,116,157,44,58,96,113,100,5,16,135,250,250,135,4,29,
+62,47,49,87,48,11,103,64,50,65,62,47,19,33,34,78,13,86,59,50,65,0,4,0,0,255,
+92,4,2,6,20,0,7,0,15,0,32,0,44,0,0,37,19,35,34,38,39,33,53,1,19,35,34,38,
+39,33,53,1,51,7,30,2,21,20,6,35,34,38,53,52,54,54,55,19,50,54,53,52,38,39,
+6,6,21,20,22,3,217,41,39,55,96,23,252,211,3,217,41,39,55,96,23,252,211,1,
+205,196,168,137,187,96,211,188,184,203,54,81,88,162,97,120,161,163,40,52,
+104,135,254,213,89,75,135,5,141,254,213,89,75,135,254,240,235,8,105,175,112,
+185,204,192,166,85,163,148,119,253,34,122,108,130,133,7,58,155,61,107,119,
+0,5,0,0,255,92,3,229,6,20,0,7,0,15,0,44,0,55,0,66,0,0,37,19,35,34,38,39,33,
+53,1,19,35,34,38,39,33,53,19,52,54,54,51,50,22,21,20,6,35,34,38,39,7,30,2,
+23,54,51,50,22,21,20,6,35,34,2,1,34,6,7,22,22,51,50,53,52,38,3,50,54,53,52,
+38,35,34,6,7,22,3,188,41,39,55,96,23,252,240,3,188,41,39,55,96,23,252,240,
+123,101,186,118,149,163,157,138,70,126,44,2,1,6,9,5,81,127,106,120,136,118,
+178,203,1,137,65,105,20,31,103,46,149,73,78,40,42,45,45,40,62,34,36,135,254,
+213,89,75,135,5,141,254,213,89,75,135,252,252,147,229,124,133,119,124,142,
+40,36,46,84,56,38,10,76,112,93,104,115,1,25,2,96,93,79,33,43,119,57,72,253,
+14,44,32,34,44,21,30,103,0,0,3,0,0,255,94,3,227,6,20,0,17,0,25,0,33,0,0,1,
+35,17,52,18,54,51,51,19,35,34,38,39,35,34,6,6,21,1,19,35,34,38,39,33,53,1,
+19,35,34,38,39,33,53,1,94,186,107,233,209,149,41,39,54,95,23,18,127,137,60,
+2,92,41,39,55,96,23,252,242,3,186,41,39,55,96,23,252,242,1,4,1,53,224,1,22,
+133,254,213,90,74,103,230,222,254,133,254,215,89,73,135,5,141,254,213,89,
+75,135,0,0,4,0,0,255,92,3,197,6,20,0,7,0,15,0,29,0,41,0,0,37,19,35,34,38,
+39,33,53,1,19,35,34,38,39,33,53,1,20,6,35,34,38,53,53,52,18,51,50,22,21,39,
+38,38,35,34,17,21,16,51,50,54,53,3,156,41,39,57,99,18,253,16,3,156,41,39,
+57,99,18,253,16,3,14,172,164,154,169,169,154,164,172,186,3,69,73,142,142,
+76,69,135,254,213,94,70,135,5,141,254,213,94,70,135,252,207,239,240,255,228,
+56,229,1,0,239,242,4,176,137,254,211,69,254,186,150,171,0,0,3,0,0,255,92,
+4,2,6,20,0,40,0,48,0,56,0,0,1,34,38,39,33,7,7,6,6,21,20,22,51,33,54,54,51,
+51,7,23,35,34,38,39,33,34,38,53,52,54,54,55,62,2,53,51,20,7,33,19,3,19,35,
+34,38,39,33,53,1,19,35,34,38,39,33,53,3,219,56,96,22,254,219,28,87,72,65,
+125,133,1,33,16,91,65,39,33,33,39,65,91,16,254,199,226,194,52,102,126,85,
+97,44,188,108,1,61,41,41,41,39,55,96,23,252,211,3,217,41,39,55,96,23,252,
+211,2,205,88,74,19,51,40,79,47,77,68,57,66,189,192,65,57,131,146,62,99,87,
+69,46,98,104,80,136,134,254,215,253,186,254,213,89,75,135,5,141,254,213,89,
+75,135,0,4,0,0,255,92,3,68,6,20,0,23,0,31,0,39,0,47,0,0,1,51,50,22,21,20,
+6,35,33,53,1,35,6,6,35,35,55,39,51,50,22,23,33,21,19,19,35,34,38,39,33,53,
+1,19,35,34,38,39,33,53,1,3,51,50,54,53,52,35,1,252,45,128,150,185,173,254,
+195,1,22,141,16,91,65,39,33,33,39,65,91,16,1,72,174,41,39,57,99,18,253,145,
+3,27,41,39,57,99,18,253,145,1,197,109,94,106,105,155,3,33,136,118,138,149,
+115,2,182,56,67,189,190,67,54,114,252,69,254,213,94,70,135,5,141,254,213,
+94,70,135,252,130,254,245,71,75,121,0,0,3,0,0,255,92,3,145,6,20,0,33,0,41,
+0,49,0,0,1,52,38,38,35,35,6,6,35,35,19,51,50,22,21,20,7,3,51,54,54,51,51,
+7,23,35,34,38,39,33,53,19,54,54,1,19,35,34,38,39,33,53,1,19,35,34,38,39,33,
+53,1,221,24,58,47,55,24,95,53,39,41,223,159,144,74,112,176,15,92,65,39,33,
+33,39,65,92,15,254,147,121,40,42,1,139,41,39,55,96,23,253,68,3,104,41,39,
+55,96,23,253,68,4,10,40,35,19,74,89,1,43,94,109,106,181,254,236,55,68,189,
+190,66,54,115,1,47,98,119,2,47,254,213,89,75,135,250,115,254,213,89,75,135,
+0,3,0,0,255,92,4,166,6,20,0,27,0,35,0,43,0,0,1,17,35,6,6,35,35,19,33,19,35,
+34,38,39,35,17,33,19,35,34,38,39,33,6,6,35,35,19,1,19,35,34,38,39,33,53,1,
+19,35,34,38,39,33,53,2,31,250,23,94,55,39,41,4,2,41,39,57,99,18,248,1,102,
+41,38,55,97,23,253,207,19,96,57,39,41,3,135,41,38,55,97,23,252,109,4,63,41,
+38,55,97,23,252,109,2,47,1,234,76,88,1,43,254,213,94,70,254,22,254,213,88,
+76,70,94,1,43,3,229,254,213,88,76,135,250,115,254,213,88,76,135,0,4,0,0,255,
+92,3,225,6,20,0,12,0,20,0,28,0,37,0,0,1,17,20,6,35,34,38,53,17,51,21,33,53,
+1,19,35,34,38,39,33,53,1,19,35,34,38,39,33,53,1,50,54,53,17,33,17,20,22,3,
+47,164,153,153,161,187,1,2,1,67,41,39,55,96,23,252,244,3,184,41,39,55,96,
+23,252,244,1,252,61,60,254,254,66,4,184,253,176,173,187,188,177,2,75,188,
+188,251,207,254,213,89,75,135,5,141,254,213,89,75,135,251,144,111,122,1,37,
+254,217,121,110,0,3,0,0,255,92,3,2,6,20,0,3,0,11,0,19,0,0,19,51,17,35,5,19,
+35,34,38,39,33,53,1,19,35,34,38,39,33,53,184,187,187,2,33,41,39,55,96,23,
+253,211,2,217,41,39,55,96,23,253,211,4,233,252,66,164,254,213,89,75,135,5,
+141,254,213,89,75,135,0,3,0,0,255,92,4,166,6,20,0,35,0,43,0,51,0,0,1,53,52,
+54,55,54,54,55,33,6,6,35,35,19,33,19,35,34,38,39,35,6,6,7,30,2,23,35,46,2,
+39,6,21,21,1,19,35,34,38,39,33,53,1,19,35,34,38,39,33,53,1,2,80,115,47,53,
+6,254,246,23,94,55,39,41,4,2,41,39,57,99,18,229,7,55,55,143,139,85,16,187,
+11,60,97,114,101,2,131,41,38,55,97,23,252,109,4,63,41,38,55,97,23,252,109,
+1,4,45,122,193,138,56,137,98,76,88,1,43,254,213,94,70,102,164,76,36,103,174,
+134,100,124,76,32,154,133,45,5,16,254,213,88,76,135,250,115,254,213,88,76,
+135,0,3,0,0,255,92,4,154,6,20,0,7,0,15,0,47,0,0,37,19,35,34,38,39,33,53,1,
+19,35,34,38,39,33,53,1,17,20,22,51,50,54,53,53,52,54,51,50,22,21,17,35,17,
+52,38,35,34,6,21,21,20,6,35,34,38,53,17,4,68,41,39,57,99,18,252,104,4,68,
+41,39,57,99,18,252,104,1,33,67,70,61,60,164,153,154,160,187,61,76,60,61,164,
+153,153,161,135,254,213,94,70,135,5,141,254,213,94,70,135,254,74,254,66,122,
+110,111,123,178,173,181,182,176,253,180,2,45,111,121,111,123,178,174,187,
+188,177,1,221,0,3,0,0,255,92,4,242,6,20,0,34,0,42,0,50,0,0,1,19,35,34,38,
+39,6,6,35,34,38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,51,50,54,53,53,
+51,21,20,7,1,19,19,35,34,38,39,33,53,1,19,35,34,38,39,33,53,2,252,213,29,
+78,124,25,27,149,127,150,166,187,72,73,78,76,186,152,77,76,187,39,254,235,
+180,41,38,55,97,23,252,66,4,106,41,38,55,97,23,252,66,1,4,1,232,60,44,111,
+106,175,157,217,191,105,89,100,111,174,70,203,93,110,70,86,95,98,253,123,
+5,16,254,213,88,76,135,250,115,254,213,88,76,135,0,3,0,0,255,92,3,158,6,20,
+0,20,0,28,0,36,0,0,1,19,35,34,38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,
+7,3,1,19,35,34,38,39,33,53,1,19,35,34,38,39,33,53,1,70,163,40,165,182,187,
+78,79,76,84,187,52,229,1,117,41,39,57,99,18,253,55,3,117,41,39,57,99,18,253,
+55,1,4,1,121,176,154,217,189,99,95,102,88,193,64,192,125,253,225,5,16,254,
+213,94,70,135,250,115,254,213,94,70,135,0,0,3,0,0,255,92,4,166,6,20,0,7,0,
+15,0,47,0,0,1,19,35,34,38,39,33,53,1,19,35,34,38,39,33,53,1,33,6,6,35,35,
+19,33,19,35,34,38,39,35,7,51,3,33,19,35,34,38,39,33,6,6,35,35,19,33,55,35,
+4,66,40,38,57,99,18,252,106,4,66,40,38,57,99,18,252,106,2,45,254,248,23,94,
+55,39,41,4,2,41,39,57,99,18,234,67,147,135,1,143,41,38,55,97,23,253,207,19,
+96,57,39,41,1,62,80,148,6,20,254,213,94,70,135,250,115,254,213,94,70,135,
+3,146,76,88,1,43,254,213,94,70,164,254,186,254,213,88,76,70,94,1,43,191,0,
+4,0,0,255,92,4,63,6,20,0,36,0,44,0,52,0,64,0,0,1,34,38,53,52,55,6,17,21,20,
+22,51,51,54,54,51,51,7,23,35,34,38,39,35,34,38,53,53,16,0,33,51,50,22,21,
+20,6,19,19,35,34,38,39,33,53,1,19,35,34,38,39,33,53,1,34,6,21,20,22,51,50,
+54,53,52,38,3,8,140,169,4,182,91,103,158,17,90,65,39,33,33,39,65,90,17,180,
+177,182,1,44,1,51,69,150,159,169,129,40,38,55,97,23,252,150,4,23,40,38,55,
+97,23,252,150,3,8,61,66,68,59,60,69,68,3,51,115,100,29,12,57,254,217,59,87,
+79,57,66,189,192,65,57,145,134,70,1,14,1,2,106,99,102,113,2,225,254,213,88,
+76,135,250,115,254,213,88,76,135,3,215,47,41,42,54,54,42,41,47,0,3,0,0,255,
+92,6,14,6,20,0,19,0,27,0,35,0,0,1,35,17,35,17,35,6,6,35,35,19,33,19,35,34,
+38,39,35,17,35,1,19,35,34,38,39,33,53,1,19,35,34,38,39,33,53,3,135,174,186,
+250,23,94,55,39,41,5,106,41,39,55,96,23,247,187,1,109,41,39,57,99,18,251,
+184,4,244,41,39,57,99,18,251,184,4,25,252,235,3,21,76,88,1,43,254,213,89,
+75,252,235,5,16,254,213,94,70,135,250,115,254,213,94,70,135,0,0,3,0,0,255,
+92,3,145,6,20,0,7,0,15,0,40,0,0,1,19,35,34,38,39,33,53,1,19,35,34,38,39,33,
+53,1,50,22,21,20,6,7,51,3,35,19,35,54,54,53,52,38,38,35,35,6,6,35,35,19,3,
+104,41,39,55,96,23,253,68,3,104,41,39,55,96,23,253,68,1,90,159,144,24,35,
+147,227,186,172,144,104,21,24,58,47,55,24,95,53,39,41,6,20,254,213,89,75,
+135,250,115,254,213,89,75,135,4,105,94,109,54,109,87,253,217,1,160,254,74,
+30,40,35,19,74,89,1,43,0,4,0,0,255,92,3,115,6,20,0,18,0,30,0,38,0,46,0,0,
+1,53,52,39,38,38,53,52,54,51,50,22,21,20,6,7,22,21,21,3,34,6,21,20,22,23,
+54,54,53,52,38,1,19,35,34,38,39,33,53,1,19,35,34,38,39,33,53,1,27,80,42,38,
+150,126,127,144,124,130,53,70,43,51,35,20,53,74,46,1,145,41,39,57,99,18,253,
+98,3,74,41,39,57,99,18,253,98,1,4,170,161,168,88,125,56,115,141,133,115,116,
+157,44,149,138,172,3,117,63,46,49,87,48,11,103,64,50,65,252,14,254,213,94,
+70,135,5,141,254,213,94,70,135,0,0,5,0,0,255,92,5,29,6,20,0,40,0,48,0,56,
+0,68,0,81,0,0,1,53,52,39,5,23,21,35,53,52,39,38,38,53,52,54,51,50,22,21,20,
+6,7,23,37,38,38,53,52,54,51,50,22,21,20,6,7,23,22,21,21,19,19,35,34,38,39,
+33,53,1,19,35,34,38,39,33,53,1,34,6,21,20,22,23,54,54,53,52,38,33,34,6,21,
+20,22,22,23,54,54,53,52,38,3,154,39,254,53,4,186,80,41,39,150,126,129,142,
+123,139,36,1,179,46,30,150,126,127,144,124,130,20,33,16,41,39,55,96,23,252,
+72,4,100,41,39,55,96,23,252,72,4,14,40,54,35,20,53,74,46,253,46,40,54,4,10,
+33,55,80,46,1,4,98,114,108,152,68,100,98,163,156,79,122,58,115,141,135,113,
+104,145,48,110,149,93,105,52,115,141,133,115,116,157,44,58,96,113,100,5,16,
+254,213,89,75,135,250,115,254,213,89,75,135,3,150,62,47,49,87,48,11,103,64,
+50,65,62,47,19,33,34,78,13,86,59,50,65,0,0,2,0,82,255,236,7,59,5,203,0,40,
+0,49,0,0,1,62,2,51,50,22,21,20,6,35,35,17,16,2,35,34,2,17,53,35,6,6,35,35,
+55,39,51,50,22,23,51,17,51,17,20,22,51,50,54,53,1,34,7,21,51,50,53,52,38,
+4,174,141,83,83,43,152,151,171,158,138,238,220,213,226,194,20,97,55,39,33,
+33,39,54,97,21,194,187,130,136,131,127,1,80,96,54,115,170,69,5,131,45,19,
+8,132,122,138,149,254,86,255,0,254,232,1,20,1,8,53,71,92,233,229,91,72,2,
+241,252,72,193,174,175,194,3,63,34,232,150,62,54,0,0,4,0,102,255,92,4,240,
+6,41,0,42,0,50,0,57,0,67,0,0,1,38,38,53,52,54,51,50,22,21,20,7,6,6,21,21,
+50,22,21,20,6,35,17,33,6,6,35,35,55,39,51,50,22,23,33,53,34,38,53,52,54,51,
+54,7,34,6,21,20,22,22,51,51,50,54,53,52,38,35,3,34,6,21,20,23,54,53,52,38,
+2,113,99,129,159,128,130,153,102,57,32,244,244,254,234,254,51,20,98,54,39,
+33,33,39,54,97,21,1,19,238,250,241,247,6,6,154,151,62,134,109,186,158,147,
+150,155,94,45,57,133,71,51,4,35,17,138,95,122,146,131,113,127,104,58,52,17,
+4,159,167,161,167,254,195,71,93,234,229,91,73,182,163,165,168,158,48,181,
+88,103,77,78,39,88,104,101,92,2,88,68,49,109,36,66,85,51,60,0,2,0,82,255,
+92,6,53,5,182,0,42,0,54,0,0,1,34,38,53,52,55,6,6,21,21,33,17,33,6,6,35,35,
+55,39,51,50,22,23,51,17,33,53,35,6,6,35,35,19,33,18,0,33,51,50,22,21,20,6,
+3,34,6,21,20,22,51,50,54,53,52,38,4,211,165,189,20,110,117,1,147,254,133,
+20,98,54,39,33,33,39,54,97,21,193,254,108,190,12,98,66,39,41,1,115,32,1,63,
+1,15,119,173,181,186,168,79,93,95,77,77,95,93,3,113,164,135,67,47,48,250,
+187,117,253,76,71,93,234,229,91,73,1,164,240,84,101,1,64,1,2,1,18,144,138,
+138,161,1,206,88,77,81,102,102,81,77,88,0,0,1,0,82,0,0,5,104,6,20,0,34,0,
+0,1,52,55,38,38,53,53,51,21,20,23,54,51,50,18,17,21,35,53,52,38,35,34,6,21,
+17,35,17,35,6,6,35,35,19,33,1,231,43,75,70,186,50,113,196,222,232,186,127,
+131,136,130,187,194,22,94,56,39,41,1,108,2,219,167,112,34,169,143,200,194,
+163,44,117,254,241,254,246,182,186,193,176,173,194,253,27,2,82,76,88,1,43,
+0,3,0,82,0,0,6,244,5,182,0,26,0,37,0,46,0,0,1,50,22,21,20,6,6,35,35,1,35,
+19,6,35,34,38,39,35,6,6,35,35,19,33,54,36,51,3,50,55,17,35,34,6,6,21,20,22,
+1,17,51,50,54,53,52,38,35,5,76,200,224,100,189,125,162,254,236,191,252,70,
+85,158,183,26,174,21,95,56,39,41,1,80,8,1,19,216,116,108,84,61,106,147,79,
+101,1,223,108,131,137,135,127,5,182,202,168,112,178,100,253,66,2,96,16,144,
+134,74,89,1,43,202,254,253,37,43,2,41,91,161,102,113,129,2,84,254,23,127,
+127,114,121,0,0,2,0,82,0,0,6,53,5,203,0,34,0,45,0,0,33,53,52,38,39,33,6,6,
+35,35,19,33,38,53,52,54,54,51,50,22,23,33,19,35,34,38,39,35,6,6,7,22,22,21,
+21,3,34,6,21,20,23,54,54,53,52,38,2,238,67,77,254,199,21,95,56,39,41,1,156,
+66,89,163,102,167,193,11,1,98,41,39,56,96,22,192,31,204,140,67,60,105,83,
+97,92,134,137,100,193,167,252,129,74,89,1,43,137,116,109,160,84,160,149,254,
+212,90,74,119,152,13,135,248,146,225,5,63,113,87,133,127,16,131,109,93,111,
+0,0,1,0,82,255,92,3,240,6,20,0,32,0,0,1,52,38,38,35,35,6,6,35,35,19,51,50,
+23,17,51,17,22,18,17,17,33,6,6,35,35,55,39,51,50,22,23,33,3,53,85,203,209,
+31,23,95,54,39,41,194,59,52,186,212,182,253,53,20,98,54,39,33,33,39,54,97,
+21,2,16,2,68,238,222,95,74,90,1,43,4,1,34,254,201,42,254,226,254,230,253,
+133,71,93,234,229,91,73,0,0,1,0,82,255,92,5,84,6,68,0,54,0,0,37,17,52,38,
+38,35,35,6,6,35,35,19,51,23,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,
+51,7,23,35,34,38,39,35,17,22,18,17,17,33,19,35,34,38,39,33,6,6,35,35,19,3,
+113,85,203,210,31,19,97,56,39,41,250,53,192,20,95,57,39,33,33,39,56,95,21,
+2,59,22,94,56,39,33,33,39,57,94,21,192,213,182,1,0,41,39,55,96,23,253,174,
+19,96,57,39,41,135,1,15,238,222,95,68,96,1,43,2,252,65,79,201,201,78,66,69,
+75,201,201,77,67,254,237,43,254,227,254,230,254,186,254,213,89,75,70,94,1,
+43,0,0,3,0,82,0,0,4,164,5,203,0,36,0,41,0,47,0,0,1,54,54,51,50,22,21,20,6,
+6,7,14,3,7,35,54,18,55,54,54,55,38,38,39,35,6,6,35,35,55,39,51,50,22,23,1,
+54,55,33,22,19,34,6,7,33,38,1,229,18,199,144,166,176,61,119,119,115,150,82,
+44,15,186,8,94,80,49,102,85,97,125,9,191,20,98,54,39,33,33,39,54,97,21,2,
+78,101,17,254,177,23,155,76,88,12,1,77,18,4,156,141,162,177,169,101,154,122,
+66,64,136,131,174,189,183,1,37,95,56,83,48,31,161,117,71,93,221,219,91,72,
+254,198,65,134,178,1,200,91,72,163,0,0,4,0,143,255,236,10,39,5,182,0,32,0,
+43,0,52,0,64,0,0,1,35,17,6,35,32,17,16,0,51,33,50,22,23,51,54,51,50,22,21,
+20,6,35,34,38,53,52,55,35,21,16,33,33,5,50,54,55,17,35,34,2,17,20,18,1,17,
+51,50,18,17,16,38,35,1,34,6,21,20,22,51,50,54,53,52,38,4,88,207,172,203,254,
+125,1,28,247,2,207,170,201,28,217,85,171,162,172,174,160,158,176,4,133,254,
+117,254,217,253,195,52,86,42,29,175,189,113,3,91,82,123,117,114,117,3,108,
+71,80,80,71,71,81,80,5,47,251,176,243,2,147,1,127,1,184,224,214,74,135,127,
+128,151,154,125,36,17,37,253,66,31,52,58,4,74,254,168,254,174,255,254,241,
+4,184,251,238,1,1,1,17,1,7,249,254,166,76,69,72,90,90,72,67,78,0,3,0,123,
+0,0,9,37,5,182,0,38,0,49,0,63,0,0,1,17,6,6,35,34,38,53,52,54,54,51,33,32,
+17,20,7,51,53,51,17,51,19,35,34,38,39,35,53,35,1,35,1,35,34,38,53,55,55,1,
+50,54,55,17,35,34,6,21,20,22,1,7,7,20,22,51,51,62,2,53,52,38,35,3,117,85,
+194,121,175,187,122,229,149,3,22,1,125,76,197,186,199,41,39,68,96,12,211,
+252,254,211,191,1,50,109,143,156,4,19,253,170,65,97,42,69,156,168,101,3,100,
+19,4,96,126,59,45,26,11,87,91,5,47,253,176,74,88,208,196,142,221,122,254,
+224,106,191,167,254,158,254,193,104,80,186,253,27,2,229,144,137,68,237,253,
+154,29,34,2,39,181,173,125,135,2,102,215,72,89,74,118,90,68,21,78,75,0,4,
+0,123,255,72,7,176,5,182,0,39,0,50,0,64,0,72,0,0,33,6,6,35,35,19,33,19,35,
+34,38,53,55,55,35,17,6,6,35,34,38,53,52,54,54,51,33,32,17,20,6,6,3,51,50,
+22,21,20,6,35,1,50,54,55,17,35,34,6,21,20,22,1,7,7,20,22,51,51,62,2,53,52,
+38,35,19,3,51,50,54,53,52,35,4,35,12,99,65,39,41,1,86,250,109,143,156,4,19,
+207,85,194,121,175,187,122,229,149,3,22,1,125,24,41,148,109,127,151,185,173,
+251,164,65,97,42,69,156,168,101,3,100,19,4,96,126,59,45,26,11,87,91,90,109,
+158,106,105,156,82,102,1,63,2,94,144,137,68,237,253,176,74,88,208,196,142,
+221,122,254,224,44,109,122,254,154,135,119,138,149,2,201,29,34,2,39,181,173,
+125,135,2,102,215,72,89,74,118,90,68,21,78,75,252,98,254,246,71,75,120,0,
+4,0,123,0,0,10,18,5,182,0,36,0,47,0,56,0,68,0,0,1,35,17,1,35,19,6,35,32,17,
+52,54,54,51,33,50,22,23,51,54,51,50,22,21,20,6,35,34,38,53,52,55,35,6,6,35,
+33,5,50,54,55,17,35,34,6,21,20,22,1,17,51,50,54,53,52,38,35,5,34,6,21,20,
+22,51,50,54,53,52,38,4,68,207,254,237,190,231,79,87,254,150,123,227,150,3,
+20,150,191,24,213,85,171,161,172,174,159,157,177,4,137,15,182,158,254,181,
+253,170,65,97,42,69,156,168,96,3,109,111,102,108,100,92,3,70,71,81,80,72,
+70,81,79,5,47,253,135,253,74,2,45,25,1,189,141,222,122,137,131,74,135,127,
+128,151,152,127,36,17,173,184,30,29,34,2,80,184,170,146,155,2,143,254,23,
+136,138,99,116,176,77,68,72,90,88,74,67,78,0,2,0,184,0,0,7,115,5,201,0,33,
+0,45,0,0,33,17,52,38,35,34,6,21,17,35,17,16,18,51,50,18,17,21,51,54,51,50,
+22,21,20,6,35,34,38,53,52,55,35,17,1,34,6,21,20,22,51,50,54,53,52,38,3,127,
+127,131,136,130,187,225,218,222,232,236,85,171,164,170,174,160,158,176,4,
+162,1,236,71,81,80,72,70,81,81,3,180,193,176,173,194,252,74,3,172,1,6,1,23,
+254,242,254,245,123,74,135,127,128,151,154,125,37,16,253,82,3,10,77,68,72,
+90,88,74,69,76,0,0,1,0,184,0,0,6,154,5,201,0,31,0,0,33,35,17,52,38,35,34,
+6,21,17,35,17,16,18,51,50,18,17,21,51,53,51,17,51,19,35,34,38,39,35,53,35,
+4,57,186,127,131,136,130,187,225,218,222,232,183,186,199,41,39,68,96,12,211,
+183,3,180,193,176,173,194,252,74,3,172,1,6,1,23,254,242,254,245,215,168,254,
+158,254,192,104,81,186,0,0,2,0,164,255,72,5,248,5,201,0,30,0,38,0,0,33,6,
+6,35,35,19,33,17,52,38,35,34,6,21,17,35,17,16,18,51,50,18,17,17,51,50,22,
+21,20,6,35,3,17,51,50,54,53,52,35,2,154,12,99,66,38,41,1,126,127,131,136,
+130,186,225,217,223,232,188,129,150,188,171,108,74,106,105,156,82,102,1,63,
+3,45,193,176,174,193,254,47,1,199,1,6,1,23,254,241,254,246,254,109,138,116,
+139,148,1,145,254,246,71,75,120,0,2,0,82,0,0,8,211,5,201,0,41,0,53,0,0,33,
+17,52,38,35,34,6,21,17,35,17,35,6,6,35,35,19,33,53,16,18,51,50,18,17,21,51,
+54,51,50,22,21,20,6,35,34,38,53,52,55,35,17,1,34,6,21,20,22,51,50,54,53,52,
+38,4,223,127,131,136,130,186,240,12,96,68,39,41,1,158,225,217,223,232,235,
+85,171,164,170,174,160,158,176,4,161,1,235,71,80,80,71,71,81,80,3,180,193,
+176,174,193,252,74,2,174,80,104,1,63,119,1,6,1,23,254,241,254,246,123,74,
+135,127,128,151,154,125,37,16,253,82,3,10,76,69,72,90,90,72,67,78,0,3,0,104,
+255,92,6,131,5,203,0,45,0,55,0,67,0,0,33,34,38,53,52,54,54,55,62,3,55,51,
+6,7,51,54,51,50,22,21,20,6,35,34,38,53,52,55,35,6,6,7,7,22,22,21,20,7,33,
+19,35,34,38,39,37,50,54,53,52,39,6,6,21,20,1,34,6,21,20,22,51,50,54,53,52,
+38,1,190,166,176,62,117,120,121,147,81,43,14,186,15,73,170,85,171,162,172,
+174,160,158,176,5,175,10,119,68,54,111,122,70,1,199,41,39,56,96,22,253,193,
+85,95,219,70,53,4,22,72,79,80,71,71,81,80,177,169,100,155,120,67,68,136,132,
+174,185,251,165,74,135,127,128,151,154,125,37,16,21,114,40,32,36,193,136,
+129,96,254,213,90,74,139,124,104,226,23,45,128,87,217,3,117,78,67,72,90,90,
+72,67,78,0,2,0,104,255,92,5,211,5,203,0,42,0,52,0,0,33,34,38,53,52,54,54,
+55,62,3,55,51,6,7,51,53,51,17,51,19,35,34,38,39,35,53,35,6,7,7,22,22,21,20,
+7,33,19,35,34,38,39,37,50,54,53,52,39,6,6,21,20,1,190,166,176,62,117,120,
+121,147,81,43,14,186,15,73,158,186,199,41,39,68,96,12,211,234,86,113,54,111,
+122,70,1,199,41,39,56,96,22,253,193,85,95,219,70,53,177,169,100,155,120,67,
+68,136,132,174,185,249,165,168,254,158,254,192,104,81,186,110,67,32,36,193,
+136,129,96,254,213,90,74,139,124,104,226,23,45,128,87,217,0,3,0,104,0,0,6,
+98,6,23,0,36,0,46,0,58,0,0,37,34,38,53,52,55,35,17,35,17,35,34,38,53,16,37,
+62,4,55,51,6,6,7,22,21,21,33,54,51,50,22,21,20,6,1,52,35,34,6,21,20,22,51,
+51,5,34,6,21,20,22,51,50,54,53,52,38,5,20,155,178,4,185,186,154,156,186,1,
+23,22,127,122,89,52,10,192,15,205,185,194,1,2,87,169,162,172,174,252,164,
+156,65,92,88,98,127,2,188,72,79,80,71,71,81,80,94,152,127,37,16,254,86,1,
+170,187,159,1,45,94,7,59,65,80,110,71,147,233,73,83,232,230,74,135,127,128,
+151,2,187,215,128,98,114,107,43,78,67,72,90,90,72,67,78,0,2,0,102,0,0,6,121,
+5,182,0,45,0,57,0,0,1,34,38,53,52,55,35,17,33,19,35,34,38,39,35,17,35,17,
+38,38,53,16,0,33,33,19,35,34,38,39,35,34,4,21,20,22,23,17,37,54,51,50,22,
+21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,5,23,164,191,19,215,1,153,41,39,
+55,95,22,239,187,240,223,1,89,1,47,1,155,41,39,54,95,23,192,248,254,250,134,
+142,2,29,78,119,170,184,190,164,81,92,93,80,79,93,92,2,8,163,136,66,47,254,
+78,254,213,89,74,254,150,1,106,8,228,244,1,36,1,72,254,213,90,74,247,230,
+171,170,9,2,53,2,35,145,138,139,160,1,207,90,76,80,102,103,79,77,89,0,0,2,
+0,102,0,0,6,74,5,182,0,31,0,43,0,0,1,34,38,53,52,55,35,17,35,17,33,6,6,35,
+35,19,33,19,35,34,38,39,33,17,51,54,51,50,22,21,20,6,3,34,6,21,20,22,51,50,
+54,53,52,38,4,252,158,176,4,147,187,254,213,19,96,57,39,41,4,103,41,39,57,
+99,18,254,213,221,85,171,162,172,174,160,71,81,80,72,70,81,81,1,88,154,125,
+36,17,253,92,5,47,70,94,1,43,254,213,94,70,253,252,74,135,127,128,151,1,168,
+77,68,72,90,88,74,69,76,0,1,0,102,0,0,5,121,5,182,0,29,0,0,1,19,35,34,38,
+39,33,17,51,53,51,17,51,19,35,34,38,39,35,53,35,17,35,17,33,6,6,35,35,19,
+4,246,41,39,57,99,18,254,213,176,186,199,41,39,68,96,12,211,176,187,254,213,
+19,96,57,39,41,5,182,254,213,94,70,253,252,168,254,158,254,192,104,80,187,
+253,92,5,47,70,94,1,43,0,0,2,0,102,255,72,5,31,5,182,0,28,0,36,0,0,33,6,6,
+35,35,19,33,17,33,6,6,35,35,19,33,19,35,34,38,39,33,17,51,50,22,21,20,6,35,
+3,17,51,50,54,53,52,35,1,147,12,96,68,39,41,1,127,254,213,19,96,57,39,41,
+4,103,41,39,57,99,18,254,213,188,129,150,188,171,108,73,106,105,155,80,104,
+1,63,4,168,70,94,1,43,254,213,94,70,252,238,138,116,139,148,1,145,254,246,
+71,75,120,0,0,2,0,102,0,0,6,240,5,182,0,35,0,47,0,0,1,51,54,51,50,22,21,20,
+6,35,34,38,53,52,55,35,17,35,17,35,17,33,6,6,35,35,19,33,19,35,34,38,39,33,
+17,51,1,34,6,21,20,22,51,50,54,53,52,38,3,215,203,83,173,164,170,174,160,
+155,179,4,129,186,222,254,250,19,96,57,39,41,4,103,41,39,57,99,18,254,176,
+221,1,203,72,80,80,72,70,81,78,2,154,73,135,127,128,150,150,128,37,16,253,
+238,3,10,2,37,70,94,1,43,254,213,94,70,254,98,254,222,79,67,72,90,88,74,66,
+80,0,2,0,82,0,0,7,201,5,182,0,42,0,54,0,0,1,33,54,51,50,22,21,20,6,35,34,
+38,53,52,55,35,1,35,1,6,6,2,3,35,18,19,35,6,6,35,35,55,39,51,50,22,23,33,
+54,54,55,3,51,1,34,6,21,20,22,51,50,54,53,52,38,4,80,1,43,82,174,164,170,
+174,160,157,177,4,180,1,10,194,254,174,98,121,86,33,187,46,90,201,20,98,54,
+39,33,33,39,54,97,21,1,0,50,134,96,106,195,2,229,71,81,80,72,70,81,81,3,147,
+74,135,127,128,150,152,126,37,16,252,244,3,231,30,225,254,101,254,179,1,254,
+1,10,71,93,234,229,91,73,98,119,25,1,53,253,178,77,68,72,90,88,74,69,76,0,
+3,0,82,0,0,7,31,5,182,0,34,0,45,0,54,0,0,1,50,22,21,20,6,35,33,17,35,17,35,
+53,33,6,6,35,35,55,39,51,50,22,23,33,17,6,35,34,38,53,52,54,54,51,3,50,54,
+55,17,35,34,6,21,20,22,1,17,51,50,54,53,52,38,35,5,172,175,196,188,171,254,
+181,207,187,254,66,20,98,54,39,33,33,39,54,97,21,1,190,100,113,175,187,122,
+229,149,129,65,97,42,69,156,168,101,3,104,111,102,108,101,91,5,182,183,157,
+180,199,2,72,250,209,223,71,93,234,229,91,73,1,0,41,208,196,142,221,122,253,
+19,29,34,2,39,181,173,125,135,2,102,254,64,121,112,102,113,0,2,0,82,255,92,
+6,49,5,182,0,53,0,65,0,0,33,34,38,38,53,53,52,55,35,6,6,35,35,55,39,51,50,
+22,23,51,18,0,33,51,50,22,21,20,6,35,34,38,53,52,55,6,2,17,21,20,22,22,51,
+51,54,54,51,51,7,23,35,34,38,39,19,34,6,21,20,22,51,50,54,53,52,38,4,2,206,
+205,91,4,235,20,98,54,39,33,33,39,54,97,21,248,37,1,19,1,3,119,173,181,186,
+168,165,189,14,94,86,55,125,139,127,25,94,53,39,33,33,39,54,95,23,74,79,93,
+95,77,77,95,93,86,196,177,141,113,53,71,93,234,229,91,73,1,38,1,11,144,138,
+138,161,164,135,62,40,62,254,194,254,212,162,122,129,54,76,88,229,234,90,
+74,5,63,88,77,81,102,102,81,77,88,0,1,0,82,0,0,5,125,6,20,0,28,0,0,1,53,52,
+38,35,34,6,21,17,35,17,35,6,6,35,35,19,33,53,52,18,55,17,51,17,22,18,21,21,
+4,195,128,130,138,129,186,211,12,94,70,39,41,1,129,180,174,187,175,181,1,
+229,254,193,176,175,192,253,27,2,82,80,104,1,63,2,237,1,14,28,1,34,254,220,
+27,254,242,232,250,0,1,0,82,0,0,5,147,6,184,0,50,0,0,1,35,6,6,35,35,19,33,
+53,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,
+39,35,21,22,18,21,21,35,53,52,38,35,34,6,21,17,35,1,252,211,12,94,70,39,41,
+1,129,180,174,166,17,95,60,39,33,33,39,59,96,17,2,9,17,93,62,38,32,32,38,
+62,94,16,168,175,181,186,128,130,138,129,186,2,82,80,104,1,63,2,237,1,14,
+28,196,60,83,201,200,82,61,60,83,200,201,85,58,198,27,254,242,232,250,254,
+193,176,175,192,253,27,0,1,0,82,0,0,5,125,5,201,0,25,0,0,1,35,6,6,35,35,19,
+33,53,16,18,51,50,18,17,17,35,17,52,38,35,34,6,21,17,35,1,252,211,12,94,70,
+39,41,1,129,225,217,223,232,186,128,130,138,129,186,2,82,80,104,1,63,211,
+1,6,1,23,254,241,254,246,254,53,1,207,193,176,175,192,252,74,0,0,2,0,102,
+255,92,4,137,6,41,0,45,0,55,0,0,1,34,38,39,35,17,33,6,6,35,35,55,39,51,50,
+22,23,51,17,35,6,6,35,35,19,33,53,52,55,38,38,53,52,54,51,50,22,21,20,7,6,
+6,21,21,33,19,1,34,6,21,20,23,54,53,52,38,4,98,56,96,22,223,254,100,20,98,
+54,39,33,33,39,54,97,21,226,226,18,95,59,39,41,1,140,36,100,127,159,128,130,
+153,102,61,30,1,139,41,253,240,45,58,134,71,51,2,125,90,74,252,223,71,93,
+234,229,91,73,2,154,69,95,1,43,12,59,52,17,139,94,122,146,131,113,127,104,
+61,59,28,18,254,213,3,33,69,48,108,37,66,85,51,60,0,0,2,0,102,255,92,4,137,
+6,205,0,61,0,71,0,0,1,22,21,20,7,6,6,21,21,33,19,35,34,38,39,35,17,33,6,6,
+35,35,55,39,51,50,22,23,51,17,35,6,6,35,35,19,33,53,52,55,38,38,53,52,55,
+35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,3,5,34,6,21,20,23,54,53,52,
+38,3,133,35,102,72,37,1,139,41,39,56,96,22,223,254,100,20,98,54,39,33,33,
+39,54,97,21,226,226,18,95,59,39,41,1,140,55,100,127,43,97,17,95,60,39,33,
+33,39,59,96,17,2,123,22,98,54,39,41,254,43,45,57,133,72,52,5,182,56,73,125,
+106,74,56,28,8,254,213,90,74,252,223,71,93,234,229,91,73,2,154,69,95,1,43,
+6,62,55,17,139,94,89,64,60,83,201,200,82,61,74,90,254,233,24,68,49,108,37,
+67,84,51,60,0,0,2,0,82,255,92,4,242,5,182,0,35,0,47,0,0,1,34,38,53,52,55,
+6,6,21,21,33,17,33,6,6,35,35,55,39,51,50,22,23,33,17,33,53,16,0,33,51,50,
+22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,3,143,165,189,21,109,119,1,148,
+254,51,20,98,54,39,33,33,39,54,97,21,1,18,254,109,1,69,1,48,118,173,182,189,
+166,79,93,95,77,77,95,93,3,113,163,136,64,50,47,249,189,39,252,254,71,93,
+234,229,91,73,1,242,170,1,60,1,87,145,137,139,160,1,206,88,77,81,102,102,
+81,77,88,0,2,0,82,255,92,4,242,6,68,0,60,0,72,0,0,33,6,6,35,35,55,39,51,50,
+22,23,51,17,33,53,16,37,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,
+7,23,35,34,38,39,35,21,55,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,21,33,
+17,1,34,6,21,20,22,51,50,54,53,52,38,1,37,20,98,54,39,33,33,39,54,97,21,209,
+254,174,1,82,209,20,95,57,39,33,33,39,56,95,21,2,92,22,94,56,39,33,33,39,
+57,94,21,209,28,249,147,154,159,144,142,162,17,180,146,1,82,1,21,59,64,65,
+56,55,65,62,71,93,234,229,91,73,1,66,137,1,164,98,234,65,79,201,201,78,66,
+69,75,201,201,77,67,205,2,119,115,114,131,134,111,50,42,14,174,203,16,253,
+174,4,0,63,54,57,72,72,57,55,62,0,0,1,0,82,0,0,4,113,5,180,0,33,0,0,1,4,19,
+35,38,39,3,35,1,35,6,6,35,35,55,39,51,50,22,23,51,55,46,2,53,53,51,21,20,
+22,22,51,51,2,213,1,62,94,199,71,205,254,205,1,18,184,20,98,54,39,33,33,39,
+54,97,21,239,60,140,151,74,187,41,84,106,207,3,16,133,254,142,229,117,253,
+141,2,156,71,93,233,230,91,73,147,5,78,163,133,131,125,90,102,45,0,0,1,0,
+82,0,0,4,227,5,182,0,24,0,0,1,35,17,33,17,35,17,35,6,6,35,35,55,39,51,50,
+22,23,51,17,51,17,33,17,51,4,227,186,254,141,186,215,20,98,54,39,33,33,39,
+54,97,21,215,186,1,115,186,1,106,1,107,253,43,2,211,71,93,234,229,91,73,2,
+92,253,166,2,90,0,0,2,0,82,0,0,5,219,5,205,0,45,0,56,0,0,1,34,6,6,21,21,35,
+53,52,54,51,51,38,38,39,35,6,6,35,35,55,39,51,50,22,23,51,54,54,51,50,22,
+21,20,6,6,35,22,22,51,33,19,35,34,38,39,1,34,6,21,20,23,50,54,53,52,38,2,
+145,92,87,40,186,175,181,148,110,101,15,237,20,98,54,39,33,33,39,54,97,21,
+233,12,205,164,160,190,112,212,145,64,204,128,1,18,41,39,68,96,12,254,146,
+100,103,16,175,169,87,1,221,47,102,88,240,233,200,179,92,172,109,71,93,234,
+229,91,73,168,197,166,141,108,167,90,98,103,254,193,104,80,3,101,134,125,
+56,75,97,112,78,103,0,2,0,82,0,0,5,223,6,20,0,47,0,58,0,0,1,34,6,6,21,21,
+35,53,52,54,51,51,38,39,35,6,6,35,35,55,39,51,50,22,23,51,54,54,55,17,51,
+17,22,22,21,20,6,6,35,22,22,51,33,19,35,34,38,39,1,34,6,21,20,23,50,54,53,
+52,38,2,150,93,87,40,186,175,181,136,205,13,237,20,98,54,39,33,33,39,54,97,
+21,246,21,143,112,186,120,141,110,207,148,56,183,121,1,49,41,39,66,98,12,
+254,146,100,103,16,175,169,87,1,59,46,103,88,78,72,200,179,152,251,71,93,
+234,229,91,73,118,154,25,1,14,254,244,20,162,117,108,165,91,84,90,254,192,
+103,81,3,74,134,124,56,75,96,113,77,103,0,0,2,0,82,0,0,5,223,6,68,0,69,0,
+81,0,0,1,34,6,6,21,21,35,53,52,54,51,51,38,38,39,35,6,6,35,35,55,39,51,50,
+22,23,51,54,54,55,53,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,
+34,38,39,33,21,22,22,21,20,6,7,22,22,51,51,19,35,34,38,39,1,34,6,21,20,22,
+23,54,54,53,52,38,2,147,92,87,40,186,175,181,135,82,122,11,237,20,98,54,39,
+33,33,39,54,97,21,242,21,143,114,254,225,18,98,56,39,33,33,39,56,98,18,2,
+254,22,94,56,39,33,33,39,57,94,21,254,219,120,141,231,189,63,168,152,237,
+41,39,66,98,12,254,146,94,109,24,13,167,156,87,1,35,47,102,89,53,47,200,179,
+60,206,107,71,93,233,230,91,73,112,152,23,125,64,80,201,201,79,65,69,75,201,
+201,77,67,123,20,162,117,158,199,6,74,61,254,192,103,82,3,33,125,103,52,88,
+22,2,102,105,78,103,0,1,0,82,0,0,8,18,5,182,0,36,0,0,1,35,6,6,35,35,19,33,
+53,16,0,33,51,21,54,54,51,32,17,17,35,17,52,38,38,35,34,6,7,17,35,17,34,2,
+17,17,35,2,0,215,12,94,70,39,41,1,133,1,80,1,55,223,62,156,77,1,133,186,52,
+113,99,55,142,37,186,250,248,186,2,82,80,104,1,63,2,1,95,1,124,94,45,49,253,
+250,254,53,1,146,167,165,79,45,34,253,34,3,45,254,247,254,231,253,16,0,0,
+4,0,82,0,0,9,236,5,182,0,55,0,63,0,71,0,79,0,0,1,6,6,35,35,19,33,18,33,51,
+21,54,54,51,32,19,51,50,22,21,20,6,35,35,17,52,38,38,35,34,6,7,21,51,50,22,
+21,20,6,35,35,17,34,6,6,21,21,51,50,22,21,20,6,35,35,17,37,17,51,50,54,53,
+52,35,1,17,51,50,54,53,52,35,1,17,51,50,54,53,52,35,1,41,12,96,68,39,41,1,
+135,42,2,75,235,63,174,81,1,123,34,152,129,150,188,171,254,57,125,109,62,
+154,42,148,128,150,185,173,254,175,218,103,148,128,150,185,173,254,6,68,32,
+106,105,155,250,30,33,106,105,156,2,82,33,106,105,156,2,197,82,103,1,64,2,
+106,94,44,50,254,76,138,116,139,148,1,146,167,165,79,44,35,193,136,118,138,
+149,3,45,107,228,211,211,136,118,138,149,2,197,178,254,246,70,75,121,254,
+26,254,246,71,75,120,1,230,254,246,70,75,121,0,0,2,0,82,0,0,4,225,6,20,0,
+41,0,52,0,0,1,54,55,38,53,52,54,55,53,51,21,22,22,21,20,6,7,22,22,23,35,38,
+38,39,14,2,21,35,54,55,35,6,6,35,35,55,39,51,50,22,23,37,54,53,52,38,35,34,
+6,21,20,22,2,55,67,99,248,142,114,187,127,149,126,146,131,164,22,186,33,132,
+103,81,82,34,186,10,67,196,20,98,54,39,33,33,39,55,97,20,2,55,162,99,83,81,
+100,109,2,29,88,65,109,235,121,179,24,194,194,19,172,122,107,186,103,42,211,
+154,146,142,17,72,157,213,109,249,157,71,93,233,230,94,70,252,89,162,85,106,
+110,89,94,126,0,1,0,82,0,0,6,16,5,182,0,39,0,0,51,53,52,18,55,35,6,6,35,35,
+55,39,51,50,22,23,33,62,2,55,33,6,6,35,35,19,33,19,35,34,38,39,33,2,1,6,2,
+21,21,225,133,144,209,20,98,54,39,33,33,39,55,97,20,1,88,85,83,41,6,254,215,
+23,94,55,39,41,4,102,41,39,55,96,23,254,213,21,254,226,163,158,76,177,1,46,
+150,71,93,233,230,94,70,85,135,145,122,76,88,1,43,254,213,89,75,254,128,254,
+255,147,254,212,163,76,0,2,0,82,0,0,6,227,6,68,0,58,0,70,0,0,1,52,38,38,35,
+35,6,6,35,35,19,51,50,23,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,
+7,23,35,34,38,39,35,17,22,22,23,33,50,22,21,20,6,35,34,38,53,52,55,35,22,
+21,17,35,1,34,6,21,20,22,51,50,54,53,52,38,3,111,85,202,211,31,19,97,56,39,
+41,195,58,52,192,20,95,57,39,33,33,39,56,95,21,2,59,22,94,56,39,33,33,39,
+57,94,21,192,155,170,35,1,205,133,137,142,128,128,142,18,186,10,186,2,102,
+52,59,58,53,54,57,59,1,152,238,221,96,68,96,1,43,4,252,65,79,201,201,78,66,
+69,75,201,201,77,67,254,239,33,156,136,110,101,107,121,125,103,52,44,76,94,
+254,49,2,127,54,48,54,67,68,53,46,56,0,0,1,0,82,0,0,6,113,6,68,0,58,0,0,1,
+52,38,38,35,35,6,6,35,35,19,51,50,23,53,35,6,6,35,35,55,39,51,50,22,23,33,
+54,54,51,51,7,23,35,34,38,39,35,17,22,22,23,51,53,51,17,51,19,35,34,38,39,
+35,53,35,22,21,17,35,3,111,85,202,211,31,19,97,56,39,41,195,58,52,192,20,
+95,57,39,33,33,39,56,95,21,2,59,22,94,56,39,33,33,39,57,94,21,192,144,180,
+38,189,186,199,41,39,68,96,12,211,164,6,186,1,152,238,221,96,68,96,1,43,4,
+252,65,79,201,201,78,66,69,75,201,201,77,67,254,239,29,156,149,168,254,158,
+254,192,104,81,186,65,76,254,49,0,2,0,82,255,92,5,195,6,68,0,55,0,63,0,0,
+33,6,6,35,35,19,33,17,52,38,38,35,35,6,6,35,35,19,51,50,23,53,35,6,6,35,35,
+55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,22,22,23,51,50,22,
+21,20,6,35,3,17,51,50,54,53,52,35,1,37,23,94,55,39,41,2,186,85,203,209,31,
+23,95,54,39,41,194,88,80,192,20,95,57,39,33,33,39,56,95,21,2,59,22,94,56,
+39,33,33,39,57,94,21,192,168,154,12,190,129,150,188,171,108,73,106,105,155,
+76,88,1,43,1,17,238,222,95,74,90,1,43,6,254,65,79,201,201,78,66,69,75,201,
+201,77,67,254,225,50,248,220,138,116,139,148,1,145,254,246,71,75,120,0,0,
+1,0,82,0,0,6,113,6,68,0,54,0,0,1,52,38,38,35,35,6,6,35,35,19,51,50,23,53,
+35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,22,22,
+23,51,53,51,21,51,19,35,34,38,39,33,17,35,3,111,85,202,211,31,19,97,56,39,
+41,195,58,52,192,20,95,57,39,33,33,39,56,95,21,2,59,22,94,56,39,33,33,39,
+57,94,21,192,193,181,15,162,186,199,41,39,68,96,12,254,143,186,1,152,238,
+221,96,68,96,1,43,4,252,65,79,201,201,78,66,69,75,201,201,77,67,254,239,39,
+242,227,168,168,254,193,104,80,254,82,0,0,1,0,82,0,0,5,168,6,184,0,50,0,0,
+33,17,52,38,35,34,6,21,17,35,17,35,6,6,35,35,19,33,53,52,18,55,53,35,6,6,
+35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,21,22,18,21,17,
+4,215,127,131,136,130,187,235,22,94,56,39,41,1,149,180,175,166,19,93,60,39,
+33,33,39,59,93,20,2,8,21,92,59,39,33,33,39,60,92,20,168,175,181,2,227,193,
+176,173,194,253,27,2,82,76,88,1,43,2,234,1,17,28,196,62,81,201,200,80,63,
+66,77,200,201,79,64,198,27,254,242,232,253,33,0,0,1,0,82,0,0,7,59,6,184,0,
+58,0,0,1,33,19,35,34,38,39,35,17,35,17,52,38,35,34,6,21,17,35,17,35,6,6,35,
+35,19,33,53,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,
+35,34,38,39,35,21,22,18,21,5,145,1,129,41,39,67,97,12,211,186,127,131,136,
+130,187,235,22,94,56,39,41,1,149,180,175,166,19,93,60,39,33,33,39,59,93,20,
+2,8,21,92,59,39,33,33,39,60,92,20,168,175,181,2,217,254,193,102,82,253,174,
+2,227,193,176,173,194,253,27,2,82,76,88,1,43,2,234,1,17,28,196,62,81,201,
+200,80,63,66,77,200,201,79,64,198,27,254,242,232,0,1,0,82,255,92,7,59,6,184,
+0,61,0,0,1,7,23,35,34,38,39,35,21,22,18,21,17,51,54,54,51,51,7,23,35,34,38,
+39,33,17,52,38,35,34,6,21,17,35,17,35,6,6,35,35,19,33,53,52,18,55,53,35,6,
+6,35,35,55,39,51,50,22,23,33,54,54,51,5,168,33,33,39,60,92,20,168,175,181,
+215,21,97,54,39,32,32,39,54,98,20,254,111,127,131,136,130,187,235,22,94,56,
+39,41,1,149,180,175,166,19,93,60,39,33,33,39,59,93,20,2,8,21,92,59,6,184,
+200,201,79,64,198,27,254,242,232,253,168,72,92,229,234,93,71,2,227,193,176,
+173,194,253,27,2,82,76,88,1,43,2,234,1,17,28,196,62,81,201,200,80,63,66,77,
+0,1,0,82,0,0,5,168,6,184,0,50,0,0,33,17,52,38,35,34,6,21,17,35,53,35,6,6,
+35,35,19,33,53,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,
+7,23,35,34,38,39,35,21,22,18,21,17,4,215,127,131,136,130,187,235,22,94,56,
+39,41,1,149,180,175,166,19,93,60,39,33,33,39,59,93,20,2,8,21,92,59,39,33,
+33,39,60,92,20,168,175,181,2,227,193,176,173,194,255,0,109,76,88,1,43,2,234,
+1,17,28,196,62,81,201,200,80,63,66,77,200,201,79,64,198,27,254,242,232,253,
+33,0,2,0,82,0,0,7,100,6,184,0,57,0,65,0,0,1,7,23,35,34,38,39,35,21,22,18,
+21,21,51,50,22,21,20,6,35,33,17,52,38,35,34,6,21,17,35,17,35,6,6,35,35,19,
+33,53,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,19,17,51,50,
+54,53,52,35,5,168,33,33,39,60,92,20,168,175,181,189,128,150,185,173,254,217,
+127,131,136,130,187,235,22,94,56,39,41,1,149,180,175,166,19,93,60,39,33,33,
+39,59,93,20,2,8,21,92,59,16,74,106,105,156,6,184,200,201,79,64,198,27,254,
+242,232,194,136,118,138,149,2,227,193,176,173,194,253,27,2,82,76,88,1,43,
+2,234,1,17,28,196,62,81,201,200,80,63,66,77,250,217,254,246,71,75,120,0,0,
+1,0,82,0,0,5,143,6,184,0,50,0,0,33,17,52,38,35,34,6,21,17,35,17,35,6,6,35,
+35,19,33,53,52,18,55,39,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,
+35,34,38,39,35,23,22,18,21,17,4,213,127,131,136,130,187,233,22,94,56,39,41,
+1,147,168,162,92,152,17,95,60,39,33,33,39,59,96,17,2,9,17,93,62,38,32,32,
+38,62,94,16,166,90,180,186,2,227,193,176,173,194,253,27,2,82,76,88,1,43,2,
+225,1,15,33,202,60,83,201,200,82,61,60,83,200,201,85,58,196,27,254,246,238,
+253,33,0,0,1,0,82,0,0,5,168,6,184,0,50,0,0,1,53,52,38,35,34,6,21,17,35,17,
+35,6,6,35,35,19,33,53,52,18,55,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,
+51,51,7,23,35,34,38,39,35,21,22,18,21,21,4,215,127,131,136,130,187,235,22,
+94,56,39,41,1,149,180,175,166,19,93,60,39,33,33,39,59,93,20,2,8,21,92,59,
+39,33,33,39,60,92,20,168,175,181,1,229,254,193,176,173,194,253,27,2,82,76,
+88,1,43,2,234,1,17,28,196,62,81,201,200,80,63,66,77,200,201,79,64,198,27,
+254,242,232,250,0,0,1,0,102,0,0,4,137,6,184,0,49,0,0,1,35,6,6,35,35,19,33,
+17,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,33,
+19,35,34,38,39,35,17,35,17,35,6,6,35,35,19,33,2,27,226,18,95,59,39,41,1,140,
+226,17,95,60,39,33,33,39,59,96,17,2,125,21,92,59,39,33,33,39,60,92,20,225,
+1,139,41,39,56,96,22,223,186,226,19,96,57,39,41,1,140,3,174,69,95,1,43,1,
+129,60,83,201,200,82,61,66,77,200,201,79,64,254,127,254,213,90,74,252,82,
+1,150,70,94,1,43,0,0,1,0,102,0,0,4,137,6,184,0,57,0,0,1,33,19,35,34,38,39,
+35,17,35,17,35,6,6,35,35,19,33,17,35,6,6,35,35,19,33,17,35,6,6,35,35,55,39,
+51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,33,19,35,34,38,39,35,2,
+213,1,139,41,39,56,96,22,223,186,226,19,96,57,39,41,1,140,226,18,95,59,39,
+41,1,140,226,17,95,60,39,33,33,39,59,96,17,2,125,21,92,59,39,33,33,39,60,
+92,20,225,1,139,41,39,56,96,22,223,2,29,254,213,90,74,254,106,1,150,70,94,
+1,43,1,145,69,95,1,43,1,129,60,83,201,200,82,61,66,77,200,201,79,64,254,127,
+254,213,90,74,0,0,1,0,102,255,92,4,137,6,184,0,60,0,0,1,35,6,6,35,35,19,33,
+17,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,33,
+19,35,34,38,39,35,17,51,54,54,51,51,7,23,35,34,38,39,33,17,35,6,6,35,35,19,
+33,2,27,226,18,95,59,39,41,1,140,226,17,95,60,39,33,33,39,59,96,17,2,125,
+21,92,59,39,33,33,39,60,92,20,225,1,139,41,39,56,96,22,223,225,21,97,54,39,
+33,33,39,54,98,20,254,101,226,19,96,57,39,41,1,140,3,174,69,95,1,43,1,129,
+60,83,201,200,82,61,66,77,200,201,79,64,254,127,254,213,90,74,252,217,72,
+92,229,234,93,71,1,150,70,94,1,43,0,1,0,102,255,92,4,137,6,184,0,61,0,0,1,
+7,23,35,34,38,39,35,17,33,19,35,34,38,39,35,17,16,6,35,35,6,6,35,35,19,51,
+50,54,53,53,35,6,6,35,35,19,33,17,35,6,6,35,35,19,33,17,35,6,6,35,35,55,39,
+51,50,22,23,33,54,54,51,4,137,33,33,39,60,92,20,225,1,139,41,39,56,96,22,
+223,183,216,13,20,99,59,33,41,150,133,113,226,18,98,56,39,41,1,140,226,17,
+96,59,39,41,1,140,226,17,95,60,39,33,33,39,59,96,17,2,125,21,92,59,6,184,
+200,201,79,64,254,183,254,213,90,73,254,29,254,237,239,74,90,1,43,162,197,
+36,69,94,1,43,1,75,67,96,1,43,1,73,60,83,201,200,82,61,66,77,0,2,0,102,0,
+0,4,168,6,184,0,56,0,64,0,0,1,35,6,6,35,35,19,33,17,35,6,6,35,35,19,33,17,
+35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,17,33,19,
+35,34,38,39,35,17,51,50,22,21,20,6,35,33,19,17,51,50,54,53,52,35,2,27,226,
+19,96,57,39,41,1,140,226,18,95,59,39,41,1,140,226,17,95,60,39,33,33,39,59,
+96,17,2,125,21,92,59,39,33,33,39,60,92,20,225,1,139,41,39,56,96,22,223,188,
+129,150,185,173,254,217,186,74,106,105,156,1,150,70,94,1,43,1,145,69,95,1,
+43,1,129,60,83,201,200,82,61,66,77,200,201,79,64,254,127,254,213,90,74,254,
+111,138,116,138,149,1,145,254,246,71,75,120,0,1,0,82,0,0,5,166,6,184,0,58,
+0,0,1,34,38,39,35,17,35,17,35,6,6,35,35,19,33,17,35,6,6,35,35,19,33,53,46,
+2,53,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,35,20,
+22,22,51,51,21,33,19,5,127,59,97,18,223,187,225,23,94,55,39,41,1,139,225,
+22,94,56,39,41,1,139,133,142,69,186,19,93,60,39,33,33,39,59,93,20,2,49,21,
+92,59,39,33,33,39,60,92,20,188,40,86,93,125,1,139,41,2,164,94,70,252,184,
+1,53,76,88,1,43,1,140,76,88,1,43,106,8,81,161,131,62,81,201,200,80,63,66,
+77,200,201,79,64,88,101,46,252,254,213,0,2,0,102,0,0,4,137,6,205,0,58,0,68,
+0,0,1,35,6,6,35,35,19,33,53,52,55,38,38,53,52,55,35,6,6,35,35,55,39,51,50,
+22,23,33,54,54,51,51,3,35,22,21,20,7,6,6,21,21,33,19,35,34,38,39,35,17,35,
+17,35,6,6,35,35,19,33,19,34,6,21,20,23,54,53,52,38,2,27,226,18,95,59,39,41,
+1,140,55,100,127,43,97,17,95,60,39,33,33,39,59,96,17,2,123,22,98,54,39,41,
+219,35,102,72,37,1,139,41,39,56,96,22,223,186,226,19,96,57,39,41,1,140,112,
+45,57,133,72,52,3,33,69,95,1,43,6,62,55,17,139,94,89,64,60,83,201,200,82,
+61,74,90,254,233,56,73,125,106,74,56,28,8,254,213,90,74,252,223,1,53,70,94,
+1,43,3,226,68,49,108,37,67,84,51,60,0,0,1,0,82,0,0,6,35,5,182,0,45,0,0,19,
+50,22,22,21,21,33,53,52,54,54,51,51,19,35,34,38,39,35,34,6,21,17,35,17,33,
+17,35,17,35,6,6,35,35,19,33,53,52,38,35,35,6,6,35,35,19,246,162,158,75,1,
+115,74,158,163,123,41,39,56,98,18,14,84,64,186,254,141,186,162,23,94,55,39,
+41,1,76,66,82,14,23,95,54,39,41,5,182,80,177,158,187,187,156,179,80,254,213,
+97,67,126,136,251,215,2,213,253,43,2,213,76,88,1,43,205,139,123,74,90,1,43,
+0,0,1,0,82,0,0,6,35,5,182,0,53,0,0,1,34,38,39,35,17,35,17,33,17,35,17,35,
+6,6,35,35,19,33,53,52,38,35,35,6,6,35,35,19,51,50,22,22,21,21,33,53,52,54,
+54,51,51,19,35,34,38,39,35,34,6,21,21,33,19,5,252,59,97,18,160,186,254,141,
+186,162,23,94,55,39,41,1,76,66,82,14,23,95,54,39,41,123,162,158,75,1,115,
+74,158,163,123,41,39,56,98,18,14,84,64,1,76,41,2,49,94,70,253,43,2,213,253,
+43,2,213,76,88,1,43,205,139,123,74,90,1,43,80,177,158,187,187,156,179,80,
+254,213,97,67,126,136,205,254,213,0,0,1,0,82,255,92,6,35,5,182,0,56,0,0,1,
+33,17,35,17,35,6,6,35,35,19,33,53,52,38,35,35,6,6,35,35,19,51,50,22,22,21,
+21,33,53,52,54,54,51,51,19,35,34,38,39,35,34,6,21,17,51,54,54,51,51,7,23,
+35,34,38,39,33,3,244,254,141,186,162,23,94,55,39,41,1,76,66,82,14,23,95,54,
+39,41,123,162,158,75,1,115,74,158,163,123,41,39,56,98,18,14,84,64,162,17,
+99,56,39,33,33,39,56,100,16,254,164,2,213,253,43,2,213,76,88,1,43,205,139,
+123,74,90,1,43,80,177,158,187,187,156,179,80,254,213,97,67,126,136,252,94,
+67,97,229,234,98,66,0,1,0,82,0,0,6,35,5,182,0,45,0,0,19,50,22,22,21,21,33,
+53,52,54,54,51,51,19,35,34,38,39,35,34,6,21,17,35,17,33,17,35,17,35,6,6,35,
+35,19,33,53,52,38,35,35,6,6,35,35,19,246,162,158,75,1,115,74,158,163,123,
+41,39,56,98,18,14,84,64,186,254,141,186,162,23,94,55,39,41,1,76,66,82,14,
+23,95,54,39,41,5,182,80,177,158,187,187,156,179,80,254,213,97,67,126,136,
+251,215,2,213,254,149,1,107,76,88,1,43,205,139,123,74,90,1,43,0,0,2,0,82,
+0,0,6,129,5,182,0,52,0,60,0,0,19,50,22,22,21,21,33,53,52,54,54,51,51,19,35,
+34,38,39,35,34,6,21,17,51,50,22,21,20,6,35,33,17,33,17,35,17,35,6,6,35,35,
+19,33,53,52,38,35,35,6,6,35,35,19,1,17,51,50,54,53,52,35,246,162,158,75,1,
+115,74,158,163,123,41,39,56,98,18,14,84,64,188,129,150,185,173,254,217,254,
+141,186,162,23,94,55,39,41,1,76,66,82,14,23,95,54,39,41,4,51,74,106,105,156,
+5,182,80,177,158,187,187,156,179,80,254,213,97,67,126,136,253,244,138,116,
+138,149,2,213,253,43,2,213,76,88,1,43,205,139,123,74,90,1,43,251,219,254,
+246,71,75,120,0,0,1,0,82,0,0,6,135,6,162,0,71,0,0,1,19,35,34,38,39,35,34,
+6,21,17,35,17,33,17,35,17,33,6,6,35,35,19,33,53,52,38,35,35,6,6,35,35,19,
+51,50,23,17,35,6,6,35,35,55,39,51,50,22,23,33,54,54,51,51,7,23,35,34,38,39,
+35,17,22,22,21,21,33,53,52,54,54,51,6,94,41,39,54,95,23,14,82,66,186,254,
+141,186,254,250,23,94,55,39,41,1,176,93,116,53,23,95,54,39,41,164,50,46,90,
+20,95,57,39,33,33,39,56,95,21,1,127,18,96,58,39,33,33,39,58,97,17,107,90,
+82,1,115,74,158,163,4,133,254,213,90,74,122,140,253,8,2,45,253,211,2,45,76,
+88,1,43,68,137,125,74,90,1,43,4,1,31,65,79,201,201,78,66,64,80,201,201,81,
+63,254,184,43,182,146,49,49,156,180,80,0,0,1,0,82,0,0,6,35,5,182,0,45,0,0,
+19,50,22,22,21,21,33,53,52,54,54,51,51,19,35,34,38,39,35,34,6,21,17,35,17,
+33,17,35,17,35,6,6,35,35,19,33,53,52,38,35,35,6,6,35,35,19,246,162,158,75,
+1,115,74,158,163,123,41,39,56,98,18,14,84,64,186,254,141,186,162,23,94,55,
+39,41,1,76,66,82,14,23,95,54,39,41,5,182,80,177,158,187,187,156,179,80,254,
+213,97,67,126,136,253,65,1,107,253,43,2,213,76,88,1,43,205,139,123,74,90,
+1,43,0,0,4,0,82,0,0,10,27,5,182,0,57,0,65,0,73,0,81,0,0,19,19,33,18,0,33,
+51,21,54,54,51,32,17,17,51,50,22,21,20,6,35,35,17,52,38,38,35,34,6,7,17,51,
+50,22,21,20,6,35,35,17,32,0,17,21,51,50,22,21,20,6,35,35,17,55,35,6,6,35,
+5,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,82,
+41,1,143,49,1,86,1,21,235,63,174,81,1,162,147,129,150,188,171,254,57,125,
+109,62,154,42,148,128,150,185,173,254,254,235,254,240,148,128,150,185,173,
+254,2,213,22,94,56,2,57,33,106,105,156,5,103,32,106,105,155,252,200,33,106,
+105,156,2,125,1,43,1,1,1,13,94,44,50,253,250,254,109,138,116,139,148,3,119,
+167,165,79,44,35,253,90,136,118,138,149,5,18,254,247,254,231,211,136,118,
+138,149,2,254,35,76,88,236,254,246,71,75,120,254,246,71,75,120,254,246,71,
+75,120,0,4,0,82,0,0,9,254,5,182,0,64,0,72,0,80,0,88,0,0,1,55,35,6,6,35,35,
+19,33,54,0,33,51,21,54,54,51,32,19,33,19,35,34,38,39,35,17,51,50,22,21,20,
+6,35,35,17,52,38,38,35,34,6,7,17,51,50,22,21,20,6,35,35,17,32,0,17,21,51,
+50,22,21,20,6,35,35,1,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,33,17,
+51,50,54,53,52,35,1,219,2,184,23,94,55,39,41,1,115,47,1,87,1,21,236,62,170,
+85,1,87,61,1,84,41,39,59,97,18,154,147,129,150,185,173,254,57,125,109,63,
+157,38,147,129,150,188,171,254,254,236,254,240,147,128,150,185,173,254,6,
+121,33,106,105,156,249,234,32,106,105,155,2,135,33,106,104,155,2,254,35,76,
+88,1,43,255,1,15,94,43,51,254,164,254,213,94,70,254,74,138,116,138,149,3,
+119,167,165,79,46,33,253,90,138,116,139,148,5,18,254,246,254,232,211,136,
+118,138,149,1,145,254,246,71,75,120,254,246,71,75,120,254,246,71,75,120,0,
+3,0,82,255,92,9,236,5,182,0,61,0,69,0,77,0,0,1,32,0,17,21,51,50,22,21,20,
+6,35,35,17,55,35,6,6,35,35,19,33,54,0,33,51,21,54,54,51,32,17,17,51,54,54,
+51,51,7,23,35,34,38,39,33,17,52,38,38,35,34,6,7,17,51,50,22,21,20,6,35,35,
+19,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,4,186,254,236,254,240,147,
+128,150,185,173,254,2,184,23,94,55,39,41,1,115,47,1,87,1,21,236,62,170,85,
+1,162,197,17,99,56,39,33,33,39,56,100,16,254,129,57,125,109,63,157,38,147,
+129,150,188,171,254,187,33,106,104,155,252,201,32,106,105,155,5,18,254,246,
+254,232,211,136,118,138,149,2,254,35,76,88,1,43,255,1,15,94,43,51,253,250,
+252,215,67,97,229,234,98,66,3,119,167,165,79,46,33,253,90,138,116,139,148,
+1,145,254,246,71,75,120,254,246,71,75,120,0,0,4,0,82,0,0,9,254,5,182,0,54,
+0,62,0,70,0,80,0,0,1,35,6,6,35,35,19,33,18,0,33,51,21,54,54,51,32,17,17,51,
+50,22,21,20,6,35,35,17,52,38,38,35,34,6,7,21,51,50,22,21,20,6,35,35,17,32,
+3,51,50,22,21,20,6,35,35,1,17,51,50,54,53,52,35,1,17,51,50,54,53,52,35,1,
+6,21,21,51,50,54,53,52,35,1,219,182,23,94,55,39,41,1,96,14,1,99,1,61,236,
+62,170,85,1,162,147,129,150,185,173,254,57,125,109,63,157,38,147,129,150,
+188,171,254,254,117,108,102,128,150,185,173,254,3,154,33,104,106,155,2,135,
+33,106,105,156,249,242,8,32,106,105,155,2,137,76,88,1,43,1,68,1,98,94,43,
+51,253,250,254,109,138,116,138,149,3,119,167,165,79,46,33,193,138,116,139,
+148,3,45,254,240,136,118,138,149,1,146,254,246,69,76,121,254,26,254,246,71,
+75,120,1,230,51,84,131,70,75,121,0,0,5,0,82,0,0,11,16,5,182,0,70,0,78,0,86,
+0,94,0,106,0,0,1,55,35,6,6,35,35,19,33,54,0,33,51,21,54,54,51,32,19,33,50,
+22,21,20,6,35,34,38,53,52,55,35,17,51,50,22,21,20,6,35,35,17,52,38,38,35,
+34,6,7,17,51,50,22,21,20,6,35,35,17,32,0,17,21,51,50,22,21,20,6,35,35,1,17,
+51,50,54,53,52,35,33,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,1,34,6,
+21,20,22,51,50,54,53,52,38,1,219,2,184,23,94,55,39,41,1,115,47,1,87,1,21,
+236,62,170,85,1,120,38,1,178,133,137,142,128,126,144,18,178,147,129,150,185,
+173,254,57,125,109,63,157,38,147,129,150,188,171,254,254,236,254,240,147,
+128,150,185,173,254,3,154,33,106,104,155,252,201,32,106,105,155,5,102,33,
+106,105,156,1,86,54,57,60,51,51,60,57,2,254,35,76,88,1,43,255,1,15,94,43,
+51,254,82,110,101,107,120,122,105,53,44,254,135,138,116,138,149,3,119,167,
+165,79,46,33,253,90,138,116,139,148,5,18,254,246,254,232,211,136,118,138,
+149,1,145,254,246,71,75,120,254,246,71,75,120,254,246,71,75,120,2,11,57,46,
+55,66,66,55,45,58,0,0,4,0,82,0,0,10,84,5,182,0,58,0,66,0,74,0,84,0,0,1,35,
+6,6,35,35,19,33,18,0,33,51,21,54,54,51,50,22,22,23,51,50,22,21,20,6,35,35,
+17,52,38,35,34,6,7,17,51,17,51,50,22,21,20,6,35,35,17,35,17,32,3,51,50,22,
+21,20,6,35,35,5,17,51,50,54,53,52,35,1,17,51,50,54,53,52,35,33,6,21,21,51,
+50,54,53,52,35,1,219,182,23,94,55,39,41,1,96,14,1,114,1,83,199,61,184,91,
+131,214,126,10,151,129,150,185,173,254,173,173,82,164,43,221,147,129,150,
+185,173,254,222,254,117,108,102,128,150,185,173,254,4,119,33,106,105,156,
+2,0,33,106,105,156,249,156,8,32,106,105,155,2,137,76,88,1,43,1,74,1,92,94,
+43,51,113,199,124,138,116,138,149,1,146,215,196,42,37,254,206,254,140,138,
+116,138,149,3,10,2,8,254,240,136,118,138,149,84,254,246,71,75,120,1,230,254,
+246,70,75,121,51,84,131,70,75,121,0,4,0,82,0,0,9,201,5,182,0,56,0,64,0,72,
+0,80,0,0,1,35,6,6,35,35,19,33,18,0,33,51,21,54,54,51,32,19,51,50,22,21,20,
+6,35,35,17,52,38,38,35,34,6,7,21,51,50,22,21,20,6,35,35,17,34,6,6,21,21,51,
+50,22,21,20,6,35,35,1,17,51,50,54,53,52,35,1,17,51,50,54,53,52,35,1,17,51,
+50,54,53,52,35,1,219,182,23,94,55,39,41,1,96,10,1,62,1,49,235,63,174,81,1,
+124,34,151,129,150,188,171,254,57,125,108,61,156,42,148,128,150,185,173,254,
+180,216,99,147,128,150,185,173,254,6,68,32,106,105,155,250,31,32,106,105,
+155,2,81,33,106,105,155,2,131,76,88,1,43,1,92,1,80,94,44,50,254,76,138,116,
+139,148,1,146,167,165,79,44,35,193,136,118,138,149,3,45,111,223,212,211,136,
+118,138,149,3,119,254,246,70,75,121,254,26,254,246,71,75,120,1,230,254,246,
+70,75,121,0,3,0,102,0,0,4,240,6,20,0,29,0,37,0,44,0,0,1,54,54,55,51,6,6,7,
+21,50,22,21,20,6,35,17,35,17,32,17,52,54,51,53,38,38,39,51,22,22,3,34,6,21,
+20,22,22,51,51,50,54,53,52,38,35,2,164,70,100,63,187,37,161,122,247,241,252,
+236,186,254,24,243,245,127,172,37,186,60,108,18,154,151,62,134,109,186,158,
+147,150,155,5,86,17,81,92,106,158,39,149,160,168,160,167,254,63,1,193,1,71,
+172,156,145,35,160,112,86,88,254,99,88,103,77,78,39,88,104,101,92,0,3,0,102,
+0,0,4,240,6,20,0,38,0,46,0,53,0,0,1,33,19,35,34,38,39,35,21,35,17,34,38,53,
+52,54,51,53,38,38,39,51,22,22,23,54,54,55,51,6,6,7,21,50,22,21,20,4,35,3,
+34,6,21,20,22,22,51,51,50,54,53,52,38,35,3,8,1,109,41,39,68,96,12,191,186,
+240,248,242,246,127,172,37,186,60,108,68,70,100,63,187,37,161,122,247,241,
+255,0,232,186,152,153,60,134,111,186,157,148,153,152,1,125,254,192,104,81,
+246,1,233,156,156,163,150,135,35,160,112,86,88,16,17,81,92,106,158,39,139,
+153,160,154,158,1,234,81,95,70,71,37,81,95,95,83,0,0,3,0,102,255,92,4,240,
+6,20,0,41,0,49,0,56,0,0,1,34,38,53,52,54,51,53,38,38,39,51,22,22,23,54,54,
+55,51,6,6,7,21,50,22,21,20,6,35,17,51,54,54,51,51,7,23,35,34,38,39,33,17,
+34,6,21,20,22,22,51,51,50,54,53,52,38,35,2,78,238,250,243,245,93,172,30,186,
+40,101,54,63,89,40,187,35,152,92,243,245,254,234,246,17,99,56,39,33,33,39,
+56,100,16,254,80,154,151,62,134,109,186,158,147,150,155,1,190,163,165,172,
+156,108,46,204,96,98,121,20,25,123,91,110,182,47,115,159,169,161,167,254,
+201,67,97,229,234,98,66,3,199,88,103,77,78,39,88,104,101,92,0,0,3,0,82,255,
+92,5,4,6,20,0,38,0,46,0,53,0,0,1,54,54,55,51,6,6,7,21,50,22,21,20,6,35,20,
+6,35,35,6,6,35,35,19,51,50,54,53,32,17,52,54,51,53,38,38,39,51,22,19,34,6,
+21,20,22,22,51,51,50,54,53,52,38,35,2,188,63,90,40,186,34,153,95,246,241,
+251,236,189,205,98,22,100,58,43,41,227,141,119,254,25,243,244,90,170,31,187,
+81,23,154,151,62,134,109,187,158,147,149,156,5,37,25,123,91,108,185,49,110,
+159,169,160,167,235,214,73,91,1,43,150,164,1,71,173,155,108,46,199,99,198,
+254,123,88,103,77,78,39,88,104,100,93,0,0,4,0,102,0,0,4,240,6,20,0,37,0,45,
+0,52,0,61,0,0,1,38,38,39,51,22,22,23,54,54,55,51,6,6,7,21,50,22,21,20,6,35,
+21,51,50,22,21,20,6,35,33,17,34,38,53,52,54,51,21,34,6,21,20,22,22,51,51,
+50,54,53,52,38,35,17,21,51,50,54,53,52,38,35,2,78,127,172,37,186,60,108,68,
+70,100,63,187,37,161,122,245,243,253,235,189,124,154,184,174,254,217,239,
+249,243,245,155,150,60,133,112,186,158,147,147,158,74,109,102,78,78,4,225,
+35,160,112,86,88,16,17,81,92,106,158,39,55,151,158,149,156,84,127,105,129,
+139,2,72,152,153,161,148,135,77,95,70,69,33,76,94,92,82,253,65,225,60,67,
+45,53,0,0,3,0,51,0,0,5,152,6,20,0,34,0,42,0,49,0,0,1,38,38,39,51,22,22,23,
+54,54,55,51,6,6,7,21,33,17,50,22,21,20,6,35,21,35,53,34,38,53,52,54,51,53,
+33,1,34,6,21,20,22,22,51,51,50,54,53,52,38,35,1,131,127,172,37,187,63,107,
+65,69,101,64,186,37,161,122,1,115,243,245,254,234,186,238,250,243,245,254,
+141,1,115,155,150,60,132,113,186,155,150,150,155,4,225,35,160,112,90,85,15,
+16,80,94,106,158,39,114,255,0,159,169,161,167,227,227,163,165,172,156,141,
+254,236,89,102,76,79,40,88,105,101,92,0,4,0,102,0,0,4,240,6,20,0,41,0,49,
+0,56,0,66,0,0,1,22,21,20,7,6,21,21,50,22,21,20,4,35,21,35,53,32,17,52,54,
+51,54,55,38,38,53,52,54,55,38,38,39,51,22,22,23,54,54,55,51,6,1,34,6,21,20,
+22,22,51,51,50,54,53,52,38,35,3,34,6,21,20,23,54,53,52,38,3,94,105,102,89,
+244,244,255,0,232,186,254,24,244,244,6,29,100,128,62,45,68,117,24,186,40,
+101,54,63,89,40,187,53,254,100,152,153,60,131,114,186,155,150,150,155,94,
+43,59,133,71,51,4,250,64,114,118,98,86,34,4,147,154,148,153,154,154,1,45,
+158,143,44,38,17,128,90,64,106,23,55,159,76,98,121,20,25,123,91,166,253,1,
+75,91,66,67,35,76,90,89,79,2,51,61,48,98,35,60,79,48,55,0,1,0,102,0,0,4,211,
+6,20,0,37,0,0,19,52,55,38,38,53,53,51,21,20,23,54,55,38,39,51,22,23,54,54,
+55,51,6,6,7,22,17,17,35,17,52,38,35,34,6,21,17,35,205,43,75,71,187,49,92,
+164,90,29,187,82,112,63,89,41,186,32,139,85,123,187,127,131,136,130,186,2,
+219,167,112,34,165,147,200,194,164,43,96,17,105,100,199,41,25,124,91,102,
+175,51,138,254,240,253,33,2,227,193,176,174,193,253,27,0,0,1,0,102,0,0,5,
+227,6,20,0,45,0,0,1,33,19,35,34,38,39,35,17,35,17,52,38,35,34,6,21,17,35,
+17,52,55,38,38,53,53,51,21,20,23,54,55,38,39,51,22,23,54,54,55,51,6,6,7,22,
+17,4,78,1,108,41,39,67,97,12,190,187,127,131,136,130,186,43,75,71,187,49,
+92,164,90,29,187,82,112,63,89,41,186,32,139,85,123,2,217,254,193,102,82,253,
+174,2,227,193,176,174,193,253,27,2,219,167,112,34,165,147,200,194,164,43,
+96,17,105,100,199,41,25,124,91,102,175,51,138,254,240,0,1,0,102,255,92,5,
+248,6,20,0,48,0,0,19,52,55,38,38,53,53,51,21,20,23,54,55,38,39,51,22,23,54,
+54,55,51,6,6,7,22,17,17,51,54,54,51,51,7,23,35,34,38,39,33,17,52,38,35,34,
+6,21,17,35,205,43,75,71,187,49,92,164,90,29,187,82,112,63,89,41,186,32,139,
+85,123,215,17,99,56,39,33,33,39,56,100,16,254,110,127,131,136,130,186,2,219,
+167,112,34,165,147,200,194,164,43,96,17,105,100,199,41,25,124,91,102,175,
+51,138,254,240,253,168,67,97,229,234,98,66,2,227,193,176,174,193,253,27,0,
+1,0,102,0,0,4,213,6,20,0,37,0,0,19,52,55,38,38,53,53,51,21,20,23,54,55,38,
+39,51,22,23,54,54,55,51,6,6,7,22,17,17,35,17,52,38,35,34,6,21,21,35,205,43,
+75,71,187,47,96,164,91,28,187,82,112,63,89,41,186,32,135,91,123,187,127,131,
+136,130,186,2,219,167,112,34,165,147,200,194,164,43,100,15,106,97,199,41,
+25,124,91,103,172,55,134,254,238,253,33,2,227,193,176,174,193,188,0,2,0,102,
+0,0,6,33,6,20,0,44,0,52,0,0,19,52,55,38,38,53,53,51,21,20,23,54,55,38,39,
+51,22,23,54,54,55,51,6,6,7,22,17,21,51,50,22,21,20,6,35,33,17,52,38,35,34,
+6,21,17,35,1,17,51,50,54,53,52,35,205,43,75,71,187,49,92,164,90,29,187,78,
+116,63,89,41,186,32,139,85,123,188,129,150,188,171,254,217,127,131,136,130,
+186,3,129,74,106,104,155,2,219,167,112,34,165,147,200,194,164,43,96,17,105,
+100,197,43,25,124,91,102,175,51,138,254,240,194,138,116,139,148,2,227,193,
+176,174,193,253,27,1,145,254,246,71,75,120,0,1,0,102,0,0,4,213,6,20,0,50,
+0,0,19,52,55,38,38,53,53,51,21,20,23,54,55,38,39,51,22,23,54,54,55,51,6,6,
+7,22,17,17,35,17,52,38,35,34,6,21,21,54,51,21,34,6,6,21,17,35,17,52,54,55,
+35,205,43,75,71,187,47,96,164,91,28,187,82,112,63,89,41,186,32,135,91,123,
+187,127,131,136,130,83,142,102,84,39,186,75,78,153,2,219,167,112,34,165,147,
+200,194,164,43,100,15,106,97,199,41,25,124,91,103,172,55,136,254,240,253,
+33,2,227,193,176,174,193,36,30,147,45,104,89,254,162,1,100,135,163,38,0,0,
+1,0,102,0,0,4,213,6,20,0,37,0,0,19,52,55,38,38,53,53,51,21,20,23,54,55,38,
+39,51,22,23,54,54,55,51,6,6,7,22,17,21,35,53,52,38,35,34,6,21,17,35,205,43,
+75,71,187,47,96,164,91,28,187,82,112,63,89,41,186,32,135,91,123,187,127,131,
+136,130,186,2,219,167,112,34,165,147,200,194,164,43,100,15,106,97,199,41,
+25,124,91,103,172,55,134,254,238,182,186,193,176,174,193,253,27,0,0,1,0,82,
+0,0,5,160,6,20,0,62,0,0,1,52,55,38,38,53,53,35,6,35,35,55,39,51,50,23,51,
+53,38,38,39,51,22,22,23,54,54,55,51,6,6,7,21,51,54,51,51,7,23,35,34,39,35,
+21,20,22,23,54,51,50,18,17,17,35,17,52,38,35,34,6,21,17,35,2,31,45,75,73,
+147,31,141,39,33,33,39,141,31,147,92,164,28,186,40,101,54,63,89,40,186,32,
+156,100,147,31,141,39,33,33,39,141,31,147,23,26,108,201,224,231,187,128,130,
+135,131,186,1,104,166,113,33,166,147,100,102,160,160,103,17,50,195,94,98,
+121,20,25,123,91,105,186,48,17,103,160,160,102,94,86,98,25,119,254,241,254,
+247,254,147,1,113,194,174,171,195,254,141,0,0,1,0,82,0,0,7,25,6,20,0,70,0,
+0,1,21,20,22,23,54,51,32,19,33,19,35,34,38,39,35,22,21,17,35,17,52,38,35,
+34,6,21,17,35,17,52,55,38,38,53,53,35,6,35,35,55,39,51,50,23,51,53,38,38,
+39,51,22,22,23,54,54,55,51,6,6,7,21,51,54,51,51,7,23,35,34,39,2,115,23,26,
+108,201,1,54,102,1,123,41,39,59,97,18,174,10,187,128,130,135,131,186,45,75,
+73,147,31,141,39,33,33,39,141,31,147,92,164,28,186,40,101,54,63,89,40,186,
+32,156,100,147,31,141,39,33,33,39,141,31,4,61,94,86,98,25,119,254,246,254,
+213,94,70,64,71,254,147,1,113,194,174,171,195,254,141,1,104,166,113,33,166,
+147,100,102,160,160,103,17,50,195,94,98,121,20,25,123,91,105,186,48,17,103,
+160,160,102,0,1,0,82,255,92,7,51,6,20,0,73,0,0,1,21,20,22,23,54,51,50,18,
+17,21,51,54,54,51,51,7,23,35,34,38,39,33,17,52,38,35,34,6,21,17,35,17,52,
+55,38,38,53,53,35,6,35,35,55,39,51,50,23,51,53,38,38,39,51,22,22,23,54,54,
+55,51,6,6,7,21,51,54,51,51,7,23,35,34,39,2,115,23,26,108,201,224,231,192,
+21,97,54,39,33,33,39,54,98,20,254,133,128,130,135,131,186,45,75,73,147,31,
+141,39,33,33,39,141,31,147,92,164,28,186,40,101,54,63,89,40,186,32,156,100,
+147,31,141,39,33,33,39,141,31,4,61,94,86,98,25,119,254,241,254,247,230,72,
+92,229,234,93,71,1,113,194,174,171,195,254,141,1,104,166,113,33,166,147,100,
+102,160,160,103,17,50,195,94,98,121,20,25,123,91,105,186,48,17,103,160,160,
+102,0,1,0,82,0,0,5,160,6,20,0,59,0,0,1,52,55,38,38,53,53,35,6,35,35,55,39,
+51,50,23,51,53,38,38,39,51,22,22,23,54,54,55,51,6,6,7,21,51,54,51,51,7,23,
+35,34,39,35,21,20,23,54,51,50,18,17,17,35,17,52,38,35,34,6,21,2,31,43,75,
+71,147,31,141,39,33,33,39,141,31,147,92,164,28,186,40,101,54,63,89,40,186,
+32,156,100,147,31,141,39,33,33,39,141,31,147,49,111,198,224,231,187,128,130,
+136,130,1,113,154,116,34,165,147,100,102,160,160,103,17,50,195,94,98,121,
+20,25,123,91,105,186,48,17,103,160,160,102,94,164,43,117,254,241,254,247,
+254,147,1,113,194,174,174,194,0,0,2,0,82,0,0,7,115,6,20,0,68,0,76,0,0,1,21,
+20,22,23,54,51,50,22,23,51,50,22,21,20,6,35,33,17,52,38,35,34,6,21,17,35,
+17,52,55,38,38,53,53,35,6,35,35,55,39,51,50,23,51,53,38,38,39,51,22,22,23,
+54,54,55,51,6,6,7,21,51,54,51,51,7,23,35,34,39,1,17,51,50,54,53,52,35,2,115,
+23,26,108,201,182,222,34,205,129,150,188,171,254,217,126,132,135,131,186,
+45,75,73,147,31,141,39,33,33,39,141,31,147,92,164,28,186,40,101,54,63,89,
+40,186,32,156,100,147,31,141,39,33,33,39,141,31,2,154,73,106,105,155,4,61,
+94,86,98,25,119,183,177,138,116,139,148,1,113,190,178,171,195,254,141,1,104,
+166,113,33,166,147,100,102,160,160,103,17,50,195,94,98,121,20,25,123,91,105,
+186,48,17,103,160,160,102,253,84,254,246,71,75,120,0,1,0,82,0,0,5,160,6,20,
+0,74,0,0,1,21,20,23,54,51,50,18,17,17,35,17,52,38,35,34,6,21,21,54,51,21,
+34,6,6,21,21,35,53,52,54,55,35,53,52,55,38,38,53,53,35,6,35,35,55,39,51,50,
+23,51,53,38,38,39,51,22,22,23,54,54,55,51,6,6,7,21,51,54,51,51,7,23,35,34,
+39,2,115,45,113,200,223,232,187,128,130,129,137,86,139,104,81,40,186,71,78,
+149,35,73,65,147,31,141,39,33,33,39,141,31,147,92,164,28,186,40,101,54,63,
+89,40,186,32,156,100,147,31,141,39,33,33,39,141,31,4,61,94,156,49,115,254,
+240,254,245,254,150,1,113,194,174,145,135,23,31,148,44,100,93,80,86,129,166,
+39,33,105,85,37,164,141,100,102,160,160,103,17,50,195,94,98,121,20,25,123,
+91,105,186,48,17,103,160,160,102,0,1,0,82,0,0,5,160,6,20,0,62,0,0,1,52,55,
+38,38,53,53,35,6,35,35,55,39,51,50,23,51,53,38,38,39,51,22,22,23,54,54,55,
+51,6,6,7,21,51,54,51,51,7,23,35,34,39,35,21,20,22,23,54,51,50,18,17,21,35,
+53,52,38,35,34,6,21,17,35,2,31,45,75,73,147,31,141,39,33,33,39,141,31,147,
+92,164,28,186,40,101,54,63,89,40,186,32,156,100,147,31,141,39,33,33,39,141,
+31,147,23,26,108,201,224,231,187,128,130,135,131,186,1,104,166,113,33,166,
+147,100,102,160,160,103,17,50,195,94,98,121,20,25,123,91,105,186,48,17,103,
+160,160,102,94,86,98,25,119,254,241,254,247,3,7,194,174,171,195,254,141,0,
+0,1,0,82,0,0,3,240,6,20,0,33,0,0,1,52,38,38,35,35,6,6,35,35,19,51,50,23,38,
+38,39,51,22,22,23,54,54,55,51,6,6,7,7,22,18,17,17,35,3,53,85,203,209,31,23,
+95,54,39,41,194,74,68,85,147,24,186,40,101,54,63,89,40,187,38,171,99,2,187,
+168,187,2,33,238,222,95,74,90,1,43,4,54,191,80,98,121,20,25,123,91,118,193,
+43,2,48,254,232,254,240,253,168,0,1,0,82,0,0,5,131,6,20,0,39,0,0,1,52,38,
+38,35,35,6,6,35,35,19,51,50,23,38,38,39,51,22,22,23,54,54,55,51,6,6,7,22,
+22,23,33,19,35,34,38,39,35,17,35,3,53,85,203,209,31,23,95,54,39,41,194,74,
+68,85,147,24,186,40,101,54,63,89,40,187,38,171,99,167,165,17,1,110,41,39,
+56,96,22,190,187,2,33,238,222,95,74,90,1,43,4,54,191,80,98,121,20,25,123,
+91,118,193,43,44,226,207,254,213,90,74,253,178,0,0,1,0,82,255,92,5,143,6,
+20,0,44,0,0,1,52,38,38,35,35,6,6,35,35,19,51,50,23,38,38,39,51,22,22,23,54,
+54,55,51,6,6,7,7,22,18,17,17,51,54,54,51,51,7,23,35,34,38,39,33,3,53,85,203,
+209,31,23,95,54,39,41,194,74,68,85,147,24,186,40,101,54,63,89,40,187,38,171,
+99,2,187,168,204,21,97,54,39,32,32,39,54,98,20,254,121,2,33,238,222,95,74,
+90,1,43,4,54,191,80,98,121,20,25,123,91,118,193,43,2,48,254,232,254,240,254,
+47,72,92,229,234,93,71,0,0,1,0,82,255,92,4,80,6,20,0,45,0,0,1,20,6,6,35,33,
+6,6,35,35,19,33,50,54,53,53,52,38,38,35,35,6,6,35,35,19,33,23,38,38,39,51,
+22,22,23,54,54,55,51,6,6,7,22,22,18,21,4,80,99,214,189,254,203,23,94,55,39,
+41,1,217,175,147,104,243,252,26,23,95,54,39,41,1,30,46,83,145,24,186,40,101,
+54,63,89,40,187,37,155,91,163,179,82,2,2,191,220,103,76,88,1,43,163,196,47,
+226,236,97,74,90,1,43,2,56,185,82,98,121,20,25,123,91,112,184,46,28,146,254,
+242,231,0,2,0,82,0,0,5,195,6,20,0,41,0,49,0,0,1,52,38,38,35,35,6,6,35,35,
+19,51,50,23,55,38,38,39,51,22,22,23,54,54,55,51,6,6,7,7,22,18,17,21,51,50,
+22,21,20,6,35,33,19,17,51,50,54,53,52,35,3,53,85,203,209,31,23,95,54,39,41,
+192,74,68,2,85,147,24,186,40,101,54,63,89,40,187,38,171,99,2,187,168,188,
+129,150,188,171,254,217,187,73,106,105,155,2,33,238,222,95,74,90,1,43,6,2,
+54,191,80,98,121,20,25,123,91,118,193,43,2,48,254,232,254,240,59,138,116,
+139,148,1,145,254,246,71,75,120,0,0,2,0,82,0,0,5,119,6,20,0,35,0,47,0,0,1,
+52,38,38,39,22,21,20,6,35,34,38,53,52,54,51,51,38,38,39,51,22,23,54,54,55,
+51,6,6,7,22,22,18,21,17,35,1,34,6,21,20,22,51,50,54,53,52,38,4,188,83,193,
+182,37,190,165,167,187,180,174,234,80,127,25,187,81,113,63,89,41,186,29,134,
+85,167,191,91,187,252,248,79,93,95,77,77,95,93,2,45,232,222,98,1,63,82,135,
+164,161,138,138,144,58,172,79,198,41,25,123,91,94,177,52,22,139,254,255,203,
+253,156,4,104,88,77,81,102,102,81,77,88,0,0,1,0,82,0,0,3,240,6,20,0,33,0,
+0,1,52,38,38,35,35,6,6,35,35,19,51,50,23,53,38,38,39,51,22,23,54,54,55,51,
+6,6,7,21,22,18,17,17,35,3,53,86,205,206,31,24,95,53,39,41,194,46,65,91,155,
+28,186,81,114,63,89,40,186,35,164,100,212,182,187,1,102,238,225,92,74,89,
+1,43,5,177,52,191,92,198,41,25,123,91,114,189,47,182,42,254,226,254,230,254,
+98,0,2,254,141,6,121,1,115,7,143,0,11,0,23,0,0,1,52,54,51,50,22,21,20,6,35,
+34,38,37,52,54,51,50,22,21,20,6,35,34,38,254,141,64,63,61,66,68,59,61,66,
+1,232,66,61,61,66,68,59,59,68,7,4,66,73,72,67,66,73,74,65,70,69,72,67,66,
+73,70,0,0,5,0,41,0,0,5,180,5,182,0,11,0,23,0,34,0,45,0,56,0,0,1,1,51,1,1,
+35,1,1,35,1,1,51,5,52,54,51,50,22,21,20,6,35,34,38,1,52,51,50,22,21,20,6,
+35,34,38,37,52,51,50,22,21,20,6,35,34,38,1,52,51,50,22,21,20,6,35,34,38,2,
+238,2,14,184,253,150,2,106,184,253,242,253,243,184,2,104,253,152,184,1,142,
+66,61,61,66,68,59,59,68,2,71,127,63,64,68,59,61,66,251,115,127,63,64,68,59,
+59,68,2,70,127,61,66,68,59,59,68,3,72,2,110,253,37,253,37,2,109,253,147,2,
+219,2,219,139,70,69,72,67,66,73,70,253,245,139,72,67,66,73,74,65,139,72,67,
+66,73,70,253,245,140,72,68,66,73,70,0,0,1,0,147,0,0,1,145,1,23,0,11,0,0,55,
+52,54,51,50,22,21,20,6,35,34,38,147,65,62,61,66,68,59,61,66,139,68,72,72,
+68,66,73,74,0,0,1,0,145,0,0,3,76,1,180,0,17,0,0,33,34,38,53,53,51,21,20,22,
+51,50,54,53,53,51,21,20,6,1,238,182,167,187,78,84,84,79,187,174,186,191,59,
+53,126,122,121,127,53,59,196,181,0,255,255,0,147,0,1,1,145,4,234,0,2,1,71,
+0,132,255,255,0,147,0,1,1,145,3,81,0,3,1,65,0,0,254,183,0,1,0,145,0,0,3,76,
+1,180,0,17,0,0,1,50,22,21,21,35,53,52,38,35,34,6,21,21,35,53,52,54,1,240,
+181,167,187,79,82,85,79,187,173,1,180,185,192,59,53,127,121,122,126,53,59,
+197,180,0,0,1,0,102,0,0,5,246,2,20,0,11,0,0,55,33,50,54,53,53,51,21,20,6,
+33,33,102,3,166,160,143,187,234,255,0,252,90,135,128,122,147,153,195,184,
+0,1,0,102,0,0,2,188,2,20,0,11,0,0,55,51,50,54,53,53,51,21,20,6,33,35,102,
+109,160,143,186,230,254,253,109,135,128,122,147,153,191,188,0,1,0,102,0,0,
+7,8,0,135,0,3,0,0,55,33,21,33,102,6,162,249,94,135,135,0,0,1,0,145,0,0,7,
+8,1,180,0,19,0,0,33,34,38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,7,33,
+21,1,238,182,167,187,77,83,84,81,187,53,3,241,186,191,59,53,125,123,120,128,
+53,59,148,94,135,0,1,0,184,0,0,3,37,4,233,0,16,0,0,1,51,54,54,51,51,7,23,
+35,34,38,39,35,17,35,17,51,1,115,223,17,99,56,39,33,33,39,57,99,16,223,187,
+187,2,190,67,97,229,234,100,64,253,201,4,233,0,0,2,0,184,0,0,5,207,6,20,0,
+23,0,32,0,0,1,33,19,35,34,38,39,35,17,35,17,33,17,35,17,52,18,55,17,51,17,
+22,18,21,5,33,53,52,38,35,34,6,21,4,57,1,109,41,39,70,94,12,191,186,253,244,
+187,180,175,186,175,181,253,58,2,12,127,131,136,130,2,217,254,193,104,80,
+253,174,2,82,253,174,2,219,234,1,17,28,1,34,254,220,27,254,242,232,6,10,193,
+176,173,194,0,2,0,184,255,92,5,227,6,20,0,26,0,35,0,0,1,33,17,35,17,52,18,
+55,17,51,17,22,18,21,17,51,54,54,51,51,7,23,35,34,38,39,33,1,33,53,52,38,
+35,34,6,21,3,127,253,244,187,180,175,186,175,181,215,21,97,54,39,32,32,39,
+54,98,20,254,111,253,244,2,12,127,131,136,130,2,82,253,174,2,219,234,1,17,
+28,1,34,254,220,27,254,242,232,253,168,72,92,229,234,93,71,2,217,10,193,176,
+173,194,0,2,0,164,0,0,4,37,6,20,0,15,0,24,0,0,33,17,33,21,35,53,52,18,55,
+17,51,17,22,18,21,17,1,33,53,52,38,35,34,6,21,3,106,253,244,186,180,174,187,
+175,181,253,57,2,12,127,131,136,130,2,82,109,246,237,1,14,28,1,34,254,220,
+27,254,242,232,253,33,2,217,10,193,176,174,193,0,3,0,184,0,0,6,12,6,20,0,
+22,0,31,0,39,0,0,1,33,17,35,17,52,18,55,17,51,17,22,18,21,21,51,50,22,21,
+20,6,35,33,1,33,53,52,38,35,34,6,21,1,17,51,50,54,53,52,35,3,127,253,244,
+187,180,175,186,175,181,189,128,150,185,173,254,217,253,244,2,12,127,131,
+136,130,2,198,74,106,105,156,2,82,253,174,2,219,234,1,17,28,1,34,254,220,
+27,254,242,232,194,136,118,138,149,2,217,10,193,176,173,194,254,172,254,246,
+71,75,120,0,2,0,184,0,0,4,57,6,20,0,15,0,24,0,0,33,17,33,17,35,17,52,18,55,
+3,51,19,22,18,21,17,1,33,53,52,38,35,34,6,21,3,127,253,244,187,168,162,135,
+203,133,180,186,253,58,2,12,127,131,136,130,2,82,253,174,2,219,225,1,15,33,
+1,40,254,222,27,254,246,238,253,33,2,217,10,193,176,173,194,0,2,0,184,0,0,
+4,57,6,20,0,15,0,24,0,0,1,53,33,17,35,17,52,18,55,17,51,17,22,18,21,21,37,
+33,53,52,38,35,34,6,21,3,127,253,244,187,180,175,186,175,181,253,58,2,12,
+127,131,136,130,1,229,109,253,174,2,219,234,1,17,28,1,34,254,220,27,254,242,
+232,250,244,10,193,176,173,194,0,0,3,0,82,0,0,6,141,6,20,0,35,0,41,0,47,0,
+0,1,38,53,52,54,55,53,51,21,22,22,21,20,6,7,22,22,51,33,21,33,19,35,34,38,
+39,35,21,35,17,33,6,6,35,35,19,37,54,54,55,33,20,19,34,7,33,38,38,2,20,129,
+137,126,186,128,155,250,221,40,158,131,1,23,1,108,41,39,66,98,12,190,187,
+252,232,23,94,55,39,41,1,229,139,167,26,254,164,203,149,42,1,88,9,79,2,47,
+120,232,156,210,34,245,235,16,165,122,168,196,7,45,43,184,254,192,103,82,
+240,1,168,76,88,1,43,211,3,70,83,108,1,112,146,63,83,0,3,0,82,255,92,6,164,
+6,20,0,37,0,43,0,49,0,0,1,38,53,52,54,55,53,51,21,22,22,21,20,6,7,22,51,33,
+17,51,54,54,51,51,7,23,35,34,38,39,33,17,33,6,6,35,35,19,37,54,54,55,33,20,
+19,34,7,33,38,38,2,12,121,137,126,186,128,155,250,221,78,212,1,62,217,17,
+99,56,39,33,33,39,56,100,16,254,108,252,232,23,94,55,39,41,1,229,139,167,
+26,254,164,203,149,42,1,88,9,79,2,47,121,231,156,210,34,245,235,16,165,122,
+168,196,7,88,254,88,67,97,229,234,98,66,1,168,76,88,1,43,211,3,70,83,108,
+1,112,146,63,83,0,3,0,82,0,0,4,248,6,20,0,26,0,32,0,38,0,0,1,38,53,52,54,
+55,53,51,21,22,22,21,20,6,7,22,51,33,17,35,17,33,6,6,35,35,19,37,54,54,55,
+33,20,19,34,7,33,38,38,2,12,121,137,126,186,128,155,250,221,78,212,1,62,187,
+252,232,23,94,55,39,41,1,229,139,167,26,254,164,203,149,42,1,88,9,79,2,47,
+121,231,156,210,34,245,235,16,165,122,168,196,7,88,253,209,1,168,76,88,1,
+43,211,3,70,83,108,1,112,146,63,83,0,0,4,0,82,255,238,5,74,6,20,0,37,0,45,
+0,57,0,64,0,0,1,6,6,35,35,19,33,38,38,53,52,54,55,53,51,21,22,22,21,20,4,
+35,30,2,23,51,50,22,21,20,6,35,34,38,53,52,55,1,32,55,33,6,21,21,20,1,34,
+6,21,20,22,51,50,54,53,52,38,1,34,6,7,33,38,38,1,37,23,94,55,39,41,1,151,
+105,106,169,149,186,128,141,254,234,251,56,111,155,114,84,134,137,145,126,
+126,144,10,254,209,1,80,43,254,129,4,2,59,53,57,59,51,51,60,59,254,129,68,
+102,31,1,98,9,83,1,29,76,88,1,43,90,235,132,172,233,31,243,237,21,164,116,
+177,196,89,87,48,1,111,100,108,119,122,105,48,28,1,229,158,14,48,18,27,254,
+2,55,47,57,64,66,55,46,56,3,107,78,66,65,79,0,0,3,0,82,0,0,5,115,6,20,0,36,
+0,44,0,50,0,0,1,38,2,53,16,37,17,51,17,22,22,23,33,19,35,34,38,39,35,6,4,
+7,22,22,23,33,19,35,34,38,39,33,6,6,35,35,19,1,54,54,55,33,7,21,20,19,34,
+7,33,38,38,1,217,97,97,1,12,186,116,143,16,1,90,41,39,59,97,18,183,32,254,
+255,202,32,92,70,1,129,41,38,55,97,23,253,148,22,98,54,39,41,1,94,144,174,
+26,254,164,2,203,140,43,1,78,11,83,1,43,132,1,20,131,1,124,64,1,18,254,246,
+16,133,109,254,213,94,70,132,145,4,88,151,78,254,213,88,76,74,90,1,43,1,207,
+3,64,78,27,28,47,1,96,135,60,75,0,3,0,102,0,0,5,70,6,20,0,35,0,43,0,49,0,
+0,1,34,6,6,21,21,35,53,52,54,51,51,38,17,52,54,55,17,51,17,22,22,21,20,6,
+6,35,22,22,51,33,19,35,34,38,39,1,50,54,55,33,21,20,23,19,34,7,33,38,38,1,
+252,92,87,40,187,176,181,135,217,150,135,186,119,141,109,208,148,60,190,111,
+1,49,41,39,68,96,12,253,215,143,166,24,254,162,11,192,144,42,1,84,13,79,1,
+59,47,102,88,78,72,200,179,159,1,23,159,208,30,1,14,254,244,20,161,118,109,
+165,90,91,83,254,192,104,80,1,197,65,74,8,63,40,1,105,135,57,78,0,2,0,152,
+0,0,5,20,6,184,0,19,0,41,0,0,1,34,38,39,35,17,35,17,33,17,35,17,51,17,33,
+17,51,17,33,19,1,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,
+51,4,238,58,96,21,159,187,254,142,187,187,1,114,187,1,76,40,254,173,33,33,
+39,62,94,16,254,124,17,95,60,38,32,32,38,59,96,17,1,132,17,93,62,2,49,91,
+73,253,43,2,213,253,43,4,201,254,147,1,109,254,147,254,213,4,135,200,201,
+85,58,60,83,201,200,82,61,60,83,0,2,0,152,255,92,5,35,6,184,0,22,0,44,0,0,
+37,51,54,54,51,51,7,23,35,34,38,39,33,17,33,17,35,17,51,17,33,17,51,19,7,
+23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,3,160,176,17,99,
+56,39,33,33,39,56,100,16,254,149,254,142,187,187,1,114,187,33,33,33,39,62,
+94,16,254,124,17,95,60,38,32,32,38,59,96,17,1,132,17,93,62,135,67,97,229,
+234,98,66,2,213,253,43,4,201,254,147,1,109,1,239,200,201,85,58,60,83,201,
+200,82,61,60,83,0,2,0,152,0,0,3,193,6,184,0,11,0,33,0,0,33,35,17,33,17,35,
+17,51,17,33,17,51,19,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,
+54,51,3,160,187,254,142,187,187,1,114,187,33,33,33,39,62,94,16,254,124,17,
+95,60,38,32,32,38,59,96,17,1,132,17,93,62,2,213,254,149,3,95,254,147,1,109,
+1,239,200,201,85,58,60,83,201,200,82,61,60,83,0,3,0,152,0,0,5,115,6,184,0,
+18,0,40,0,48,0,0,1,33,17,35,17,51,17,33,17,51,17,51,50,22,21,20,6,35,33,19,
+7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,19,17,51,50,54,
+53,52,35,2,229,254,142,187,187,1,114,187,188,129,150,188,171,254,217,220,
+33,33,39,62,94,16,254,124,17,95,60,38,32,32,38,59,96,17,1,132,17,93,62,6,
+73,106,105,155,2,213,253,43,4,201,254,147,1,109,253,84,138,116,139,148,6,
+184,200,201,85,58,60,83,201,200,82,61,60,83,250,217,254,246,71,75,120,0,0,
+2,0,82,0,0,4,207,6,184,0,23,0,45,0,0,19,50,22,22,23,33,17,51,17,35,17,33,
+17,35,17,52,38,35,35,6,6,35,35,19,1,7,23,35,34,38,39,33,6,6,35,35,55,39,51,
+50,22,23,33,54,54,51,246,152,157,78,6,1,117,186,186,254,141,186,66,82,14,
+23,95,54,39,41,4,84,33,33,39,62,94,16,254,125,19,93,60,39,33,33,39,59,93,
+20,1,131,17,93,62,4,201,71,157,137,1,109,251,55,2,213,253,43,3,59,139,124,
+74,90,1,43,1,239,200,201,85,58,62,81,201,200,80,63,60,83,0,2,0,152,0,0,3,
+193,6,184,0,11,0,33,0,0,1,35,17,33,17,35,17,51,17,33,17,51,19,7,23,35,34,
+38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,3,160,187,254,142,187,187,
+1,114,187,33,33,33,39,62,94,16,254,124,17,95,60,38,32,32,38,59,96,17,1,132,
+17,93,62,1,106,1,107,253,43,4,201,254,147,1,109,1,239,200,201,85,58,60,83,
+201,200,82,61,60,83,0,5,0,184,0,0,8,219,6,184,0,49,0,71,0,79,0,87,0,95,0,
+0,19,16,0,33,51,21,54,54,51,32,17,21,51,50,22,21,20,6,35,35,17,52,38,38,35,
+34,6,7,17,51,50,22,21,20,6,35,35,17,32,0,17,21,51,50,22,21,20,6,35,35,1,7,
+23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,1,17,51,50,54,53,
+52,35,33,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,184,1,98,1,76,236,63,
+174,80,1,162,148,127,151,185,173,254,57,127,107,66,155,37,147,129,150,185,
+173,254,254,235,254,240,147,129,150,188,171,254,5,148,33,33,39,62,94,16,253,
+43,19,93,60,39,33,33,39,59,93,20,2,213,17,93,62,251,78,32,106,105,155,5,102,
+33,106,105,156,252,201,33,106,105,156,2,23,1,94,1,125,95,44,51,253,250,207,
+135,119,138,149,2,178,167,165,80,48,32,254,31,138,116,138,149,4,78,254,247,
+254,230,14,138,116,139,148,6,184,200,201,85,58,62,81,201,200,80,63,60,83,
+250,217,254,246,71,75,120,254,246,71,75,120,254,246,71,75,120,0,0,5,0,184,
+0,0,8,219,6,184,0,58,0,80,0,88,0,96,0,104,0,0,19,16,0,33,51,21,54,54,51,32,
+19,33,19,35,34,38,39,35,22,21,21,51,50,22,21,20,6,35,35,17,52,38,38,35,34,
+6,7,17,51,50,22,21,20,6,35,35,17,32,0,17,21,51,50,22,21,20,6,35,35,1,7,23,
+35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,1,17,51,50,54,53,52,
+35,33,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,184,1,98,1,76,236,63,174,
+80,1,56,80,1,96,41,39,59,97,18,158,4,148,127,151,185,173,254,57,127,107,66,
+155,37,147,129,150,185,173,254,254,235,254,240,147,129,150,188,171,254,5,
+148,33,33,39,62,94,16,253,43,19,93,60,39,33,33,39,59,93,20,2,213,17,93,62,
+251,78,32,106,105,155,5,102,33,106,105,156,252,201,33,106,105,156,2,23,1,
+94,1,125,95,44,51,254,217,254,213,94,70,44,44,207,135,119,138,149,2,178,167,
+165,80,48,32,254,31,138,116,138,149,4,78,254,247,254,230,14,138,116,139,148,
+6,184,200,201,85,58,62,81,201,200,80,63,60,83,250,217,254,246,71,75,120,254,
+246,71,75,120,254,246,71,75,120,0,4,0,184,255,92,8,201,6,184,0,53,0,75,0,
+83,0,91,0,0,19,16,0,33,51,21,54,54,51,32,17,17,51,54,54,51,51,7,23,35,34,
+38,39,33,17,52,38,38,35,34,6,7,17,51,50,22,21,20,6,35,35,17,32,0,17,21,51,
+50,22,21,20,6,35,35,1,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,
+54,54,51,1,17,51,50,54,53,52,35,33,17,51,50,54,53,52,35,184,1,98,1,76,236,
+63,174,80,1,162,197,17,99,56,39,33,33,39,56,100,16,254,129,57,127,107,66,
+155,37,147,129,150,185,173,254,254,235,254,240,147,129,150,188,171,254,5,
+148,33,33,39,62,94,16,253,43,19,93,60,39,33,33,39,59,93,20,2,213,17,93,62,
+254,45,33,106,105,156,252,201,32,106,105,155,2,23,1,94,1,125,95,44,51,253,
+250,253,155,67,97,229,234,98,66,2,178,167,165,80,48,32,254,31,138,116,138,
+149,4,78,254,247,254,230,14,138,116,139,148,6,184,200,201,85,58,62,81,201,
+200,80,63,60,83,250,217,254,246,71,75,120,254,246,71,75,120,0,5,0,164,0,0,
+8,199,6,184,0,48,0,70,0,78,0,86,0,96,0,0,19,16,0,33,51,21,54,54,51,32,17,
+21,51,50,22,21,20,6,35,35,17,52,38,38,35,34,6,7,21,51,50,22,21,20,6,35,35,
+17,34,6,7,51,50,22,21,20,6,35,35,1,7,23,35,34,38,39,33,6,6,35,35,55,39,51,
+50,22,23,33,54,54,51,19,17,51,50,54,53,52,35,1,17,51,50,54,53,52,35,33,6,
+21,21,51,50,54,53,52,35,164,1,90,1,84,235,63,175,80,1,162,147,129,150,188,
+171,254,57,127,107,64,152,42,148,128,150,185,173,254,178,225,60,62,128,150,
+185,173,254,5,168,33,33,39,62,94,16,253,43,19,93,60,39,33,33,39,59,93,20,
+2,213,17,93,62,248,32,106,105,155,252,200,33,106,105,155,252,221,21,33,106,
+105,156,2,78,1,81,1,83,95,44,51,253,250,207,138,116,139,148,2,178,167,165,
+80,46,34,80,136,118,138,149,2,189,80,80,136,118,138,149,5,39,200,201,85,58,
+62,81,201,200,80,63,60,83,250,217,254,246,71,75,120,1,146,254,246,70,75,121,
+84,109,73,70,75,121,0,6,0,184,0,0,9,238,6,184,0,64,0,86,0,94,0,102,0,110,
+0,122,0,0,19,16,0,33,51,21,54,54,51,32,23,33,50,22,21,20,6,35,34,38,53,52,
+55,35,22,21,21,51,50,22,21,20,6,35,35,17,52,38,38,35,34,6,7,17,51,50,22,21,
+20,6,35,35,17,32,0,17,21,51,50,22,21,20,6,35,35,1,7,23,35,34,38,39,33,6,6,
+35,35,55,39,51,50,22,23,33,54,54,51,1,17,51,50,54,53,52,35,33,17,51,50,54,
+53,52,35,33,17,51,50,54,53,52,35,1,34,6,21,20,22,51,50,54,53,52,38,184,1,
+98,1,76,236,63,174,80,1,32,89,1,215,134,137,145,126,126,144,18,190,12,148,
+127,151,185,173,254,57,127,107,66,155,37,147,129,150,185,173,254,254,235,
+254,240,147,129,150,188,171,254,5,148,33,33,39,62,94,16,253,43,19,93,60,39,
+33,33,39,59,93,20,2,213,17,93,62,254,45,33,106,105,156,2,135,33,106,105,156,
+249,234,32,106,105,155,7,20,53,57,59,51,51,60,59,2,23,1,94,1,125,95,44,51,
+246,111,100,108,119,122,105,54,42,74,83,207,135,119,138,149,2,178,167,165,
+80,48,32,254,31,138,116,138,149,4,78,254,247,254,230,14,138,116,139,148,6,
+184,200,201,85,58,62,81,201,200,80,63,60,83,250,217,254,246,71,75,120,254,
+246,71,75,120,254,246,71,75,120,1,254,55,47,57,64,66,55,46,56,0,5,0,164,0,
+0,9,29,6,184,0,51,0,73,0,82,0,90,0,100,0,0,19,16,0,33,33,21,54,54,51,50,22,
+23,51,50,22,21,20,6,35,35,17,52,38,35,34,6,7,17,51,21,51,50,22,21,20,6,35,
+35,17,35,17,34,6,7,51,50,22,21,20,6,35,35,1,7,23,35,34,38,39,33,6,6,35,35,
+55,39,51,50,22,23,33,54,54,51,1,23,21,51,50,54,53,52,35,1,17,51,50,54,53,
+52,35,1,6,21,21,51,50,54,53,52,35,164,1,61,1,72,1,20,63,175,80,178,248,53,
+172,129,150,188,171,254,173,204,64,152,42,152,147,129,150,185,173,254,152,
+202,219,58,78,128,150,185,173,254,5,209,33,33,39,62,94,16,253,2,19,93,60,
+39,33,33,39,59,93,20,2,254,17,93,62,1,35,2,32,106,105,155,253,10,33,106,105,
+156,252,66,17,33,106,105,156,2,78,1,98,1,66,95,44,51,166,158,138,116,139,
+148,1,33,220,192,46,34,254,207,176,138,116,138,149,2,70,2,8,74,86,136,118,
+138,149,5,39,200,201,85,58,62,81,201,200,80,63,60,83,252,107,27,239,70,75,
+121,254,110,254,246,71,75,120,1,146,75,118,73,70,75,121,0,0,5,0,164,0,0,8,
+199,6,184,0,48,0,70,0,79,0,87,0,95,0,0,19,16,0,33,51,21,54,54,51,32,19,51,
+50,22,21,20,6,35,35,17,52,38,38,35,34,6,7,21,51,50,22,21,20,6,35,35,17,32,
+0,17,21,51,50,22,21,20,6,35,35,1,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,
+22,23,33,54,54,51,19,23,21,51,50,54,53,52,35,33,17,51,50,54,53,52,35,1,17,
+51,50,54,53,52,35,164,1,83,1,70,236,59,195,84,1,71,72,166,129,150,188,171,
+254,57,127,107,69,172,37,147,129,150,185,173,254,254,242,254,253,148,128,
+150,185,173,254,5,168,33,33,39,62,94,16,253,43,19,93,60,39,33,33,39,59,93,
+20,2,213,17,93,62,246,2,32,106,105,155,252,180,33,106,105,156,252,221,33,
+106,105,156,2,23,1,101,1,118,95,41,54,254,188,138,116,139,148,1,33,167,165,
+80,48,32,80,138,116,138,149,2,189,254,255,254,222,14,136,118,138,149,6,184,
+200,201,85,58,62,81,201,200,80,63,60,83,252,107,27,239,70,75,121,254,246,
+70,75,121,254,110,254,246,71,75,120,0,3,0,82,0,0,4,6,6,184,0,28,0,50,0,63,
+0,0,1,20,6,7,22,18,21,21,35,53,52,2,39,6,2,7,35,54,18,55,38,38,53,52,54,51,
+50,22,22,19,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,1,
+62,2,53,52,38,35,34,6,21,20,22,3,145,114,154,186,197,186,166,164,114,107,
+2,187,2,175,159,118,125,194,166,112,160,86,117,33,33,39,60,92,20,253,242,
+19,93,60,39,33,33,39,59,93,20,2,14,21,92,59,254,90,75,58,29,99,83,81,99,104,
+4,4,105,179,109,65,254,194,234,18,18,212,1,7,42,104,254,255,174,208,1,98,
+114,53,171,110,161,181,86,150,2,92,200,201,79,64,62,81,201,200,80,63,66,77,
+252,76,50,67,82,53,85,105,108,90,92,125,0,3,0,82,0,0,5,131,6,184,0,36,0,58,
+0,71,0,0,1,20,6,7,22,23,33,19,35,34,38,39,35,22,21,21,35,53,52,2,39,6,2,7,
+35,54,18,55,38,38,53,52,54,51,50,22,22,19,7,23,35,34,38,39,33,6,6,35,35,55,
+39,51,50,22,23,33,54,54,51,1,62,2,53,52,38,35,34,6,21,20,22,3,145,114,154,
+159,95,1,215,41,39,56,96,22,223,53,186,166,164,114,107,2,187,2,175,159,118,
+125,194,166,112,160,86,117,33,33,39,60,92,20,253,242,19,93,60,39,33,33,39,
+59,93,20,2,14,21,92,59,254,90,75,58,29,99,83,81,99,104,4,4,105,179,109,56,
+122,254,213,90,74,138,166,18,18,212,1,7,42,104,254,255,174,208,1,98,114,53,
+171,110,161,181,86,150,2,92,200,201,79,64,62,81,201,200,80,63,66,77,252,76,
+50,67,82,53,85,105,108,90,92,125,0,0,3,0,82,255,92,5,197,6,184,0,37,0,59,
+0,72,0,0,33,53,52,2,39,6,2,7,35,54,18,55,38,38,53,52,54,51,50,22,22,21,20,
+6,7,4,19,51,54,54,51,51,7,23,35,34,38,39,3,7,23,35,34,38,39,33,6,6,35,35,
+55,39,51,50,22,23,33,54,54,51,1,62,2,53,52,38,35,34,6,21,20,22,3,74,166,164,
+114,107,2,187,2,175,159,118,125,194,166,112,160,86,114,154,1,71,48,246,17,
+99,56,39,33,33,39,56,100,16,236,33,33,39,60,92,20,253,242,19,93,60,39,33,
+33,39,59,93,20,2,14,21,92,59,254,90,75,58,29,99,83,81,99,104,18,212,1,7,42,
+104,254,255,174,208,1,98,114,53,171,110,161,181,86,150,88,105,179,109,118,
+254,130,67,97,229,234,98,66,6,184,200,201,79,64,62,81,201,200,80,63,66,77,
+252,76,50,67,82,53,85,105,108,90,92,125,0,0,3,0,82,0,0,4,6,6,184,0,28,0,50,
+0,63,0,0,1,20,6,7,22,18,21,21,35,53,52,2,39,6,6,7,35,54,54,55,38,38,53,52,
+54,51,50,22,22,19,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,
+51,1,62,2,53,52,38,35,34,6,21,20,22,3,145,114,154,186,197,186,166,164,67,
+96,32,186,46,155,106,118,125,194,166,112,160,86,117,33,33,39,60,92,20,253,
+242,19,93,60,39,33,33,39,59,93,20,2,14,21,92,59,254,90,75,58,29,99,83,81,
+99,104,4,4,105,179,109,65,254,194,234,18,18,212,1,7,42,60,145,103,156,216,
+77,53,171,110,161,181,86,150,2,92,200,201,79,64,62,81,201,200,80,63,66,77,
+252,76,50,67,82,53,85,105,108,90,92,125,0,4,0,82,255,219,5,127,6,184,0,38,
+0,60,0,73,0,85,0,0,1,20,6,7,22,23,54,54,51,50,22,21,20,6,35,34,46,2,39,38,
+38,39,6,2,7,35,54,18,55,38,38,53,52,54,51,50,22,22,19,7,23,35,34,38,39,33,
+6,6,35,35,55,39,51,50,22,23,33,54,54,51,1,62,2,53,52,38,35,34,6,21,20,22,
+1,34,6,21,20,22,51,50,54,53,52,38,3,145,118,148,168,86,28,113,78,135,152,
+155,132,78,104,74,55,29,61,118,87,116,107,2,187,2,175,159,118,125,194,166,
+112,160,86,117,33,33,39,60,92,20,253,242,19,93,60,39,33,33,39,59,93,20,2,
+14,21,92,59,254,90,75,58,29,99,83,81,99,104,2,139,60,67,69,58,57,66,66,4,
+4,107,182,102,71,173,44,57,140,116,127,148,43,78,109,67,131,120,24,103,254,
+254,174,208,1,98,114,53,171,110,161,181,86,150,2,92,200,201,79,64,62,81,201,
+200,80,63,66,77,252,76,50,67,82,53,85,105,108,90,92,125,254,71,68,57,61,74,
+75,60,54,71,0,0,3,0,82,0,0,5,8,6,184,0,34,0,56,0,69,0,0,1,6,6,7,22,18,21,
+21,35,53,52,2,39,6,2,7,35,54,18,55,38,38,53,52,54,51,50,22,23,33,19,35,34,
+38,39,3,7,23,35,34,38,39,33,6,6,35,35,55,39,51,50,22,23,33,54,54,51,1,62,
+2,53,52,38,35,34,6,21,20,22,3,135,20,117,121,186,197,186,166,164,114,107,
+2,187,2,175,159,118,125,194,166,144,190,20,1,82,41,39,56,96,22,45,33,33,39,
+60,92,20,253,242,19,93,60,39,33,33,39,59,93,20,2,14,21,92,59,254,90,75,58,
+29,99,83,81,99,104,3,170,77,140,86,65,254,194,234,18,18,212,1,7,42,104,254,
+255,174,208,1,98,114,53,171,110,161,181,148,131,254,213,90,74,3,14,200,201,
+79,64,62,81,201,200,80,63,66,77,252,76,50,67,82,53,85,105,108,90,92,125,0,
+3,0,82,0,0,4,6,6,184,0,24,0,46,0,59,0,0,37,38,39,6,2,7,35,54,18,55,38,38,
+53,52,54,51,50,22,22,21,20,6,7,4,19,19,7,23,35,34,38,39,33,6,6,35,35,55,39,
+51,50,22,23,33,54,54,51,1,62,2,53,52,38,35,34,6,21,20,22,3,43,76,223,114,
+107,2,187,2,175,159,118,125,194,166,112,160,86,114,154,1,21,79,29,33,33,39,
+60,92,20,253,242,19,93,60,39,33,33,39,59,93,20,2,14,21,92,59,254,90,75,58,
+29,99,83,81,99,104,246,233,56,104,254,255,174,208,1,98,114,53,171,110,161,
+181,86,150,88,105,179,109,97,254,220,5,194,200,201,79,64,62,81,201,200,80,
+63,66,77,252,76,50,67,82,53,85,105,108,90,92,125,0,0,3,253,176,6,121,2,80,
+7,143,0,11,0,23,0,35,0,0,3,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,
+22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,127,66,61,61,66,68,
+59,59,68,1,209,66,61,61,66,68,59,59,68,252,94,66,61,61,66,68,59,59,68,7,4,
+70,69,72,67,66,73,70,69,70,69,72,67,66,73,70,69,70,69,72,67,66,73,70,0,1,
+255,129,6,121,0,127,7,143,0,11,0,0,3,52,54,51,50,22,21,20,6,35,34,38,127,
+66,61,61,66,68,59,59,68,7,4,70,69,72,67,66,73,70,0,0,0,15,0,186,0,3,0,1,4,
+9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,
+1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,
+0,3,0,1,4,9,0,6,0,32,0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,
+1,92,0,3,0,1,4,9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,
+11,0,62,2,14,0,3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,
+0,1,4,9,0,14,0,52,5,30,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,69,0,116,0,104,0,105,0,111,0,
+112,0,105,0,99,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,69,
+0,116,0,104,0,105,0,111,0,112,0,105,0,99,0,86,0,101,0,114,0,115,0,105,0,111,
+0,110,0,32,0,49,0,46,0,48,0,56,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,
+83,0,97,0,110,0,115,0,69,0,116,0,104,0,105,0,111,0,112,0,105,0,99,0,78,0,
+111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,
+101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,
+112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,
+99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,
+0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,
+0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,
+0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,
+0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,
+0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,
+0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,
+83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,
+0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,
+0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,
+0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,
+0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,
+115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,
+0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,
+0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,
+0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,
+0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,
+0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,
+0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,
+0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,47,0,0,1,2,0,2,0,3,1,3,1,
+4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,
+20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,
+1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,
+1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,
+1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,
+1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,
+1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,
+120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,
+1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,
+145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,
+1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,
+170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,
+1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,
+195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,
+1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,
+220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,
+1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,
+245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,
+2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,
+2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,
+2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,
+2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,
+2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,
+2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,
+2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,
+107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,
+2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,
+132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,
+2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,
+157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,
+2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,
+182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,
+2,195,2,196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,
+207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,
+2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,
+232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,
+2,245,2,246,2,247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,
+3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,
+18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,
+3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,4,110,117,
+108,108,7,117,110,105,49,50,48,48,7,117,110,105,49,50,48,49,7,117,110,105,
+49,50,48,50,7,117,110,105,49,50,48,51,7,117,110,105,49,50,48,52,7,117,110,
+105,49,50,48,53,7,117,110,105,49,50,48,54,7,117,110,105,49,50,48,56,7,117,
+110,105,49,50,48,57,7,117,110,105,49,50,48,65,7,117,110,105,49,50,48,66,7,
+117,110,105,49,50,48,67,7,117,110,105,49,50,48,68,7,117,110,105,49,50,48,
+69,7,117,110,105,49,50,48,70,7,117,110,105,49,50,49,48,7,117,110,105,49,50,
+49,49,7,117,110,105,49,50,49,50,7,117,110,105,49,50,49,51,7,117,110,105,49,
+50,49,52,7,117,110,105,49,50,49,53,7,117,110,105,49,50,49,54,7,117,110,105,
+49,50,49,55,7,117,110,105,49,50,49,56,7,117,110,105,49,50,49,57,7,117,110,
+105,49,50,49,65,7,117,110,105,49,50,49,66,7,117,110,105,49,50,49,67,7,117,
+110,105,49,50,49,68,7,117,110,105,49,50,49,69,7,117,110,105,49,50,49,70,7,
+117,110,105,49,50,50,48,7,117,110,105,49,50,50,49,7,117,110,105,49,50,50,
+50,7,117,110,105,49,50,50,51,7,117,110,105,49,50,50,52,7,117,110,105,49,50,
+50,53,7,117,110,105,49,50,50,54,7,117,110,105,49,50,50,55,7,117,110,105,49,
+50,50,56,7,117,110,105,49,50,50,57,7,117,110,105,49,50,50,65,7,117,110,105,
+49,50,50,66,7,117,110,105,49,50,50,67,7,117,110,105,49,50,50,68,7,117,110,
+105,49,50,50,69,7,117,110,105,49,50,50,70,7,117,110,105,49,50,51,48,7,117,
+110,105,49,50,51,49,7,117,110,105,49,50,51,50,7,117,110,105,49,50,51,51,7,
+117,110,105,49,50,51,52,7,117,110,105,49,50,51,53,7,117,110,105,49,50,51,
+54,7,117,110,105,49,50,51,55,7,117,110,105,49,50,51,56,7,117,110,105,49,50,
+51,57,7,117,110,105,49,50,51,65,7,117,110,105,49,50,51,66,7,117,110,105,49,
+50,51,67,7,117,110,105,49,50,51,68,7,117,110,105,49,50,51,69,7,117,110,105,
+49,50,51,70,7,117,110,105,49,50,52,48,7,117,110,105,49,50,52,49,7,117,110,
+105,49,50,52,50,7,117,110,105,49,50,52,51,7,117,110,105,49,50,52,52,7,117,
+110,105,49,50,52,53,7,117,110,105,49,50,52,54,7,117,110,105,49,50,52,56,7,
+117,110,105,49,50,52,65,7,117,110,105,49,50,52,66,7,117,110,105,49,50,52,
+67,7,117,110,105,49,50,52,68,7,117,110,105,49,50,53,48,7,117,110,105,49,50,
+53,49,7,117,110,105,49,50,53,50,7,117,110,105,49,50,53,51,7,117,110,105,49,
+50,53,52,7,117,110,105,49,50,53,53,7,117,110,105,49,50,53,54,7,117,110,105,
+49,50,53,56,7,117,110,105,49,50,53,65,7,117,110,105,49,50,53,66,7,117,110,
+105,49,50,53,67,7,117,110,105,49,50,53,68,7,117,110,105,49,50,54,48,7,117,
+110,105,49,50,54,49,7,117,110,105,49,50,54,50,7,117,110,105,49,50,54,51,7,
+117,110,105,49,50,54,52,7,117,110,105,49,50,54,53,7,117,110,105,49,50,54,
+54,7,117,110,105,49,50,54,55,7,117,110,105,49,50,54,56,7,117,110,105,49,50,
+54,57,7,117,110,105,49,50,54,65,7,117,110,105,49,50,54,66,7,117,110,105,49,
+50,54,67,7,117,110,105,49,50,54,68,7,117,110,105,49,50,54,69,7,117,110,105,
+49,50,54,70,7,117,110,105,49,50,55,48,7,117,110,105,49,50,55,49,7,117,110,
+105,49,50,55,50,7,117,110,105,49,50,55,51,7,117,110,105,49,50,55,52,7,117,
+110,105,49,50,55,53,7,117,110,105,49,50,55,54,7,117,110,105,49,50,55,55,7,
+117,110,105,49,50,55,56,7,117,110,105,49,50,55,57,7,117,110,105,49,50,55,
+65,7,117,110,105,49,50,55,66,7,117,110,105,49,50,55,67,7,117,110,105,49,50,
+55,68,7,117,110,105,49,50,55,69,7,117,110,105,49,50,55,70,7,117,110,105,49,
+50,56,48,7,117,110,105,49,50,56,49,7,117,110,105,49,50,56,50,7,117,110,105,
+49,50,56,51,7,117,110,105,49,50,56,52,7,117,110,105,49,50,56,53,7,117,110,
+105,49,50,56,54,7,117,110,105,49,50,56,56,7,117,110,105,49,50,56,65,7,117,
+110,105,49,50,56,66,7,117,110,105,49,50,56,67,7,117,110,105,49,50,56,68,7,
+117,110,105,49,50,57,48,7,117,110,105,49,50,57,49,7,117,110,105,49,50,57,
+50,7,117,110,105,49,50,57,51,7,117,110,105,49,50,57,52,7,117,110,105,49,50,
+57,53,7,117,110,105,49,50,57,54,7,117,110,105,49,50,57,55,7,117,110,105,49,
+50,57,56,7,117,110,105,49,50,57,57,7,117,110,105,49,50,57,65,7,117,110,105,
+49,50,57,66,7,117,110,105,49,50,57,67,7,117,110,105,49,50,57,68,7,117,110,
+105,49,50,57,69,7,117,110,105,49,50,57,70,7,117,110,105,49,50,65,48,7,117,
+110,105,49,50,65,49,7,117,110,105,49,50,65,50,7,117,110,105,49,50,65,51,7,
+117,110,105,49,50,65,52,7,117,110,105,49,50,65,53,7,117,110,105,49,50,65,
+54,7,117,110,105,49,50,65,55,7,117,110,105,49,50,65,56,7,117,110,105,49,50,
+65,57,7,117,110,105,49,50,65,65,7,117,110,105,49,50,65,66,7,117,110,105,49,
+50,65,67,7,117,110,105,49,50,65,68,7,117,110,105,49,50,65,69,7,117,110,105,
+49,50,66,48,7,117,110,105,49,50,66,50,7,117,110,105,49,50,66,51,7,117,110,
+105,49,50,66,52,7,117,110,105,49,50,66,53,7,117,110,105,49,50,66,56,7,117,
+110,105,49,50,66,57,7,117,110,105,49,50,66,65,7,117,110,105,49,50,66,66,7,
+117,110,105,49,50,66,67,7,117,110,105,49,50,66,68,7,117,110,105,49,50,66,
+69,7,117,110,105,49,50,67,48,7,117,110,105,49,50,67,50,7,117,110,105,49,50,
+67,51,7,117,110,105,49,50,67,52,7,117,110,105,49,50,67,53,7,117,110,105,49,
+50,67,56,7,117,110,105,49,50,67,57,7,117,110,105,49,50,67,65,7,117,110,105,
+49,50,67,66,7,117,110,105,49,50,67,67,7,117,110,105,49,50,67,68,7,117,110,
+105,49,50,67,69,7,117,110,105,49,50,68,48,7,117,110,105,49,50,68,49,7,117,
+110,105,49,50,68,50,7,117,110,105,49,50,68,51,7,117,110,105,49,50,68,52,7,
+117,110,105,49,50,68,53,7,117,110,105,49,50,68,54,7,117,110,105,49,50,68,
+56,7,117,110,105,49,50,68,57,7,117,110,105,49,50,68,65,7,117,110,105,49,50,
+68,66,7,117,110,105,49,50,68,67,7,117,110,105,49,50,68,68,7,117,110,105,49,
+50,68,69,7,117,110,105,49,50,68,70,7,117,110,105,49,50,69,48,7,117,110,105,
+49,50,69,49,7,117,110,105,49,50,69,50,7,117,110,105,49,50,69,51,7,117,110,
+105,49,50,69,52,7,117,110,105,49,50,69,53,7,117,110,105,49,50,69,54,7,117,
+110,105,49,50,69,55,7,117,110,105,49,50,69,56,7,117,110,105,49,50,69,57,7,
+117,110,105,49,50,69,65,7,117,110,105,49,50,69,66,7,117,110,105,49,50,69,
+67,7,117,110,105,49,50,69,68,7,117,110,105,49,50,69,69,7,117,110,105,49,50,
+70,48,7,117,110,105,49,50,70,49,7,117,110,105,49,50,70,50,7,117,110,105,49,
+50,70,51,7,117,110,105,49,50,70,52,7,117,110,105,49,50,70,53,7,117,110,105,
+49,50,70,54,7,117,110,105,49,50,70,55,7,117,110,105,49,50,70,56,7,117,110,
+105,49,50,70,57,7,117,110,105,49,50,70,65,7,117,110,105,49,50,70,66,7,117,
+110,105,49,50,70,67,7,117,110,105,49,50,70,68,7,117,110,105,49,50,70,69,7,
+117,110,105,49,50,70,70,7,117,110,105,49,51,48,48,7,117,110,105,49,51,48,
+49,7,117,110,105,49,51,48,50,7,117,110,105,49,51,48,51,7,117,110,105,49,51,
+48,52,7,117,110,105,49,51,48,53,7,117,110,105,49,51,48,54,7,117,110,105,49,
+51,48,55,7,117,110,105,49,51,48,56,7,117,110,105,49,51,48,57,7,117,110,105,
+49,51,48,65,7,117,110,105,49,51,48,66,7,117,110,105,49,51,48,67,7,117,110,
+105,49,51,48,68,7,117,110,105,49,51,48,69,7,117,110,105,49,51,49,48,7,117,
+110,105,49,51,49,50,7,117,110,105,49,51,49,51,7,117,110,105,49,51,49,52,7,
+117,110,105,49,51,49,53,7,117,110,105,49,51,49,56,7,117,110,105,49,51,49,
+57,7,117,110,105,49,51,49,65,7,117,110,105,49,51,49,66,7,117,110,105,49,51,
+49,67,7,117,110,105,49,51,49,68,7,117,110,105,49,51,49,69,7,117,110,105,49,
+51,50,48,7,117,110,105,49,51,50,49,7,117,110,105,49,51,50,50,7,117,110,105,
+49,51,50,51,7,117,110,105,49,51,50,52,7,117,110,105,49,51,50,53,7,117,110,
+105,49,51,50,54,7,117,110,105,49,51,50,55,7,117,110,105,49,51,50,56,7,117,
+110,105,49,51,50,57,7,117,110,105,49,51,50,65,7,117,110,105,49,51,50,66,7,
+117,110,105,49,51,50,67,7,117,110,105,49,51,50,68,7,117,110,105,49,51,50,
+69,7,117,110,105,49,51,50,70,7,117,110,105,49,51,51,48,7,117,110,105,49,51,
+51,49,7,117,110,105,49,51,51,50,7,117,110,105,49,51,51,51,7,117,110,105,49,
+51,51,52,7,117,110,105,49,51,51,53,7,117,110,105,49,51,51,54,7,117,110,105,
+49,51,51,55,7,117,110,105,49,51,51,56,7,117,110,105,49,51,51,57,7,117,110,
+105,49,51,51,65,7,117,110,105,49,51,51,66,7,117,110,105,49,51,51,67,7,117,
+110,105,49,51,51,68,7,117,110,105,49,51,51,69,7,117,110,105,49,51,51,70,7,
+117,110,105,49,51,52,48,7,117,110,105,49,51,52,49,7,117,110,105,49,51,52,
+50,7,117,110,105,49,51,52,51,7,117,110,105,49,51,52,52,7,117,110,105,49,51,
+52,53,7,117,110,105,49,51,52,54,7,117,110,105,49,51,52,56,7,117,110,105,49,
+51,52,57,7,117,110,105,49,51,52,65,7,117,110,105,49,51,52,66,7,117,110,105,
+49,51,52,67,7,117,110,105,49,51,52,68,7,117,110,105,49,51,52,69,7,117,110,
+105,49,51,52,70,7,117,110,105,49,51,53,48,7,117,110,105,49,51,53,49,7,117,
+110,105,49,51,53,50,7,117,110,105,49,51,53,51,7,117,110,105,49,51,53,52,7,
+117,110,105,49,51,53,53,7,117,110,105,49,51,53,54,7,117,110,105,49,51,53,
+55,7,117,110,105,49,51,53,56,7,117,110,105,49,51,53,57,7,117,110,105,49,51,
+53,65,7,117,110,105,49,51,54,49,7,117,110,105,49,51,54,50,7,117,110,105,49,
+51,54,51,7,117,110,105,49,51,54,52,7,117,110,105,49,51,54,53,7,117,110,105,
+49,51,54,54,7,117,110,105,49,51,54,55,7,117,110,105,49,51,54,56,7,117,110,
+105,49,51,54,57,7,117,110,105,49,51,54,65,7,117,110,105,49,51,54,66,7,117,
+110,105,49,51,54,67,7,117,110,105,49,51,54,68,7,117,110,105,49,51,54,69,7,
+117,110,105,49,51,54,70,7,117,110,105,49,51,55,48,7,117,110,105,49,51,55,
+49,7,117,110,105,49,51,55,50,7,117,110,105,49,51,55,51,7,117,110,105,49,51,
+55,52,7,117,110,105,49,51,55,53,7,117,110,105,49,51,55,54,7,117,110,105,49,
+51,55,55,7,117,110,105,49,51,55,56,7,117,110,105,49,51,55,57,7,117,110,105,
+49,51,55,65,7,117,110,105,49,51,55,66,7,117,110,105,49,51,55,67,12,117,110,
+105,49,51,54,57,46,105,110,105,116,12,117,110,105,49,51,54,65,46,105,110,
+105,116,12,117,110,105,49,51,54,66,46,105,110,105,116,12,117,110,105,49,51,
+54,67,46,105,110,105,116,12,117,110,105,49,51,54,68,46,105,110,105,116,12,
+117,110,105,49,51,54,69,46,105,110,105,116,12,117,110,105,49,51,54,70,46,
+105,110,105,116,12,117,110,105,49,51,55,48,46,105,110,105,116,12,117,110,
+105,49,51,55,49,46,105,110,105,116,12,117,110,105,49,51,55,50,46,105,110,
+105,116,12,117,110,105,49,51,55,51,46,105,110,105,116,12,117,110,105,49,51,
+55,52,46,105,110,105,116,12,117,110,105,49,51,55,53,46,105,110,105,116,12,
+117,110,105,49,51,55,54,46,105,110,105,116,12,117,110,105,49,51,55,55,46,
+105,110,105,116,12,117,110,105,49,51,55,56,46,105,110,105,116,12,117,110,
+105,49,51,55,57,46,105,110,105,116,12,117,110,105,49,51,55,65,46,105,110,
+105,116,12,117,110,105,49,51,55,66,46,105,110,105,116,12,117,110,105,49,51,
+55,67,46,105,110,105,116,12,117,110,105,49,51,54,57,46,109,101,100,105,12,
+117,110,105,49,51,54,65,46,109,101,100,105,12,117,110,105,49,51,54,66,46,
+109,101,100,105,12,117,110,105,49,51,54,67,46,109,101,100,105,12,117,110,
+105,49,51,54,68,46,109,101,100,105,12,117,110,105,49,51,54,69,46,109,101,
+100,105,12,117,110,105,49,51,54,70,46,109,101,100,105,12,117,110,105,49,51,
+55,48,46,109,101,100,105,12,117,110,105,49,51,55,49,46,109,101,100,105,12,
+117,110,105,49,51,55,50,46,109,101,100,105,12,117,110,105,49,51,55,51,46,
+109,101,100,105,12,117,110,105,49,51,55,52,46,109,101,100,105,12,117,110,
+105,49,51,55,53,46,109,101,100,105,12,117,110,105,49,51,55,54,46,109,101,
+100,105,12,117,110,105,49,51,55,55,46,109,101,100,105,12,117,110,105,49,51,
+55,56,46,109,101,100,105,12,117,110,105,49,51,55,57,46,109,101,100,105,12,
+117,110,105,49,51,55,65,46,109,101,100,105,12,117,110,105,49,51,55,66,46,
+109,101,100,105,12,117,110,105,49,51,55,67,46,109,101,100,105,12,117,110,
+105,49,51,54,57,46,102,105,110,97,12,117,110,105,49,51,54,65,46,102,105,110,
+97,12,117,110,105,49,51,54,66,46,102,105,110,97,12,117,110,105,49,51,54,67,
+46,102,105,110,97,12,117,110,105,49,51,54,68,46,102,105,110,97,12,117,110,
+105,49,51,54,69,46,102,105,110,97,12,117,110,105,49,51,54,70,46,102,105,110,
+97,12,117,110,105,49,51,55,48,46,102,105,110,97,12,117,110,105,49,51,55,49,
+46,102,105,110,97,12,117,110,105,49,51,55,50,46,102,105,110,97,12,117,110,
+105,49,51,55,51,46,102,105,110,97,12,117,110,105,49,51,55,52,46,102,105,110,
+97,12,117,110,105,49,51,55,53,46,102,105,110,97,12,117,110,105,49,51,55,54,
+46,102,105,110,97,12,117,110,105,49,51,55,55,46,102,105,110,97,12,117,110,
+105,49,51,55,56,46,102,105,110,97,12,117,110,105,49,51,55,57,46,102,105,110,
+97,12,117,110,105,49,51,55,65,46,102,105,110,97,12,117,110,105,49,51,55,66,
+46,102,105,110,97,12,117,110,105,49,51,55,67,46,102,105,110,97,7,117,110,
+105,49,50,48,55,7,117,110,105,49,50,52,55,7,117,110,105,49,50,56,55,7,117,
+110,105,49,50,65,70,7,117,110,105,49,50,67,70,7,117,110,105,49,50,69,70,7,
+117,110,105,49,51,48,70,7,117,110,105,49,51,49,70,7,117,110,105,49,51,52,
+55,7,117,110,105,49,51,56,48,7,117,110,105,49,51,56,49,7,117,110,105,49,51,
+56,50,7,117,110,105,49,51,56,51,7,117,110,105,49,51,56,52,7,117,110,105,49,
+51,56,53,7,117,110,105,49,51,56,54,7,117,110,105,49,51,56,55,7,117,110,105,
+49,51,56,56,7,117,110,105,49,51,56,57,7,117,110,105,49,51,56,65,7,117,110,
+105,49,51,56,66,7,117,110,105,49,51,56,67,7,117,110,105,49,51,56,68,7,117,
+110,105,49,51,56,69,7,117,110,105,49,51,56,70,7,117,110,105,50,68,56,48,7,
+117,110,105,50,68,56,49,7,117,110,105,50,68,56,50,7,117,110,105,50,68,56,
+51,7,117,110,105,50,68,56,52,7,117,110,105,50,68,56,53,7,117,110,105,50,68,
+56,54,7,117,110,105,50,68,56,55,7,117,110,105,50,68,56,56,7,117,110,105,50,
+68,56,57,7,117,110,105,50,68,56,65,7,117,110,105,50,68,56,66,7,117,110,105,
+50,68,56,67,7,117,110,105,50,68,56,68,7,117,110,105,50,68,56,69,7,117,110,
+105,50,68,56,70,7,117,110,105,50,68,57,48,7,117,110,105,50,68,57,49,7,117,
+110,105,50,68,57,50,7,117,110,105,50,68,57,51,7,117,110,105,50,68,57,52,7,
+117,110,105,50,68,57,53,7,117,110,105,50,68,57,54,7,117,110,105,50,68,65,
+48,7,117,110,105,50,68,65,49,7,117,110,105,50,68,65,50,7,117,110,105,50,68,
+65,51,7,117,110,105,50,68,65,52,7,117,110,105,50,68,65,53,7,117,110,105,50,
+68,65,54,7,117,110,105,50,68,65,56,7,117,110,105,50,68,65,57,7,117,110,105,
+50,68,65,65,7,117,110,105,50,68,65,66,7,117,110,105,50,68,65,67,7,117,110,
+105,50,68,65,68,7,117,110,105,50,68,65,69,7,117,110,105,50,68,66,48,7,117,
+110,105,50,68,66,49,7,117,110,105,50,68,66,50,7,117,110,105,50,68,66,51,7,
+117,110,105,50,68,66,52,7,117,110,105,50,68,66,53,7,117,110,105,50,68,66,
+54,7,117,110,105,50,68,66,56,7,117,110,105,50,68,66,57,7,117,110,105,50,68,
+66,65,7,117,110,105,50,68,66,66,7,117,110,105,50,68,66,67,7,117,110,105,50,
+68,66,68,7,117,110,105,50,68,66,69,7,117,110,105,50,68,67,48,7,117,110,105,
+50,68,67,49,7,117,110,105,50,68,67,50,7,117,110,105,50,68,67,51,7,117,110,
+105,50,68,67,52,7,117,110,105,50,68,67,53,7,117,110,105,50,68,67,54,7,117,
+110,105,50,68,67,56,7,117,110,105,50,68,67,57,7,117,110,105,50,68,67,65,7,
+117,110,105,50,68,67,66,7,117,110,105,50,68,67,67,7,117,110,105,50,68,67,
+68,7,117,110,105,50,68,67,69,7,117,110,105,50,68,68,48,7,117,110,105,50,68,
+68,49,7,117,110,105,50,68,68,50,7,117,110,105,50,68,68,51,7,117,110,105,50,
+68,68,52,7,117,110,105,50,68,68,53,7,117,110,105,50,68,68,54,7,117,110,105,
+50,68,68,56,7,117,110,105,50,68,68,57,7,117,110,105,50,68,68,65,7,117,110,
+105,50,68,68,66,7,117,110,105,50,68,68,67,7,117,110,105,50,68,68,68,7,117,
+110,105,50,68,68,69,7,117,110,105,49,51,53,70,7,117,110,105,49,51,54,48,7,
+117,110,105,49,51,57,48,7,117,110,105,49,51,57,49,7,117,110,105,49,51,57,
+50,7,117,110,105,49,51,57,51,7,117,110,105,49,51,57,52,7,117,110,105,49,51,
+57,53,7,117,110,105,49,51,57,54,7,117,110,105,49,51,57,55,7,117,110,105,49,
+51,57,56,7,117,110,105,49,51,57,57,7,117,110,105,65,66,48,49,7,117,110,105,
+65,66,48,50,7,117,110,105,65,66,48,51,7,117,110,105,65,66,48,52,7,117,110,
+105,65,66,48,53,7,117,110,105,65,66,48,54,7,117,110,105,65,66,48,57,7,117,
+110,105,65,66,48,65,7,117,110,105,65,66,48,66,7,117,110,105,65,66,48,67,7,
+117,110,105,65,66,48,68,7,117,110,105,65,66,48,69,7,117,110,105,65,66,49,
+49,7,117,110,105,65,66,49,50,7,117,110,105,65,66,49,51,7,117,110,105,65,66,
+49,52,7,117,110,105,65,66,49,53,7,117,110,105,65,66,49,54,7,117,110,105,65,
+66,50,48,7,117,110,105,65,66,50,49,7,117,110,105,65,66,50,50,7,117,110,105,
+65,66,50,51,7,117,110,105,65,66,50,52,7,117,110,105,65,66,50,53,7,117,110,
+105,65,66,50,54,7,117,110,105,65,66,50,56,7,117,110,105,65,66,50,57,7,117,
+110,105,65,66,50,65,7,117,110,105,65,66,50,66,7,117,110,105,65,66,50,67,7,
+117,110,105,65,66,50,68,7,117,110,105,65,66,50,69,7,117,110,105,49,51,53,
+68,7,117,110,105,49,51,53,69,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,2,0,
+14,0,0,0,0,0,0,0,0,0,2,0,5,0,4,1,64,0,1,1,153,2,0,0,1,2,1,2,1,0,3,2,13,2,
+44,0,1,2,45,2,46,0,3,0,1,0,0,0,10,0,52,0,78,0,2,101,116,104,105,0,14,108,
+97,116,110,0,18,0,8,0,0,0,14,0,0,0,0,255,255,0,2,0,0,0,1,0,0,255,255,0,2,
+0,0,0,1,0,2,107,101,114,110,0,14,109,97,114,107,0,20,0,0,0,1,0,0,0,0,0,1,
+0,1,0,2,0,6,247,68,0,2,0,8,0,2,0,10,105,30,0,1,2,182,0,4,0,0,1,86,4,148,4,
+154,4,164,5,114,6,32,6,50,6,56,6,250,8,192,9,62,9,244,11,174,11,208,12,226,
+13,48,14,246,15,24,15,50,17,88,18,206,22,52,22,98,22,144,23,154,23,212,23,
+246,24,36,24,246,25,8,25,206,25,244,25,250,26,4,26,10,26,40,26,46,26,52,26,
+98,26,112,26,138,26,164,26,178,26,224,26,230,26,240,26,250,28,28,28,50,28,
+88,28,98,28,144,28,206,28,216,29,142,29,180,29,186,29,248,29,254,30,4,30,
+18,30,60,30,66,30,84,30,190,30,220,30,230,30,240,30,246,31,0,31,6,31,20,31,
+162,31,172,31,218,31,228,32,158,32,200,32,238,34,156,34,166,35,96,35,194,
+36,60,36,66,36,72,36,78,36,112,36,142,36,148,36,154,36,172,36,182,37,4,37,
+18,37,28,37,210,37,216,37,250,38,0,38,6,38,84,38,158,38,168,38,230,38,240,
+39,18,39,28,39,210,39,216,39,222,39,228,39,238,40,164,40,210,41,108,42,34,
+42,92,42,130,42,188,43,42,43,100,43,110,43,120,44,46,44,56,44,166,44,176,
+44,218,44,228,45,66,45,140,45,190,45,204,45,214,45,224,46,150,46,164,46,198,
+46,232,47,86,47,96,47,110,47,180,48,10,48,24,48,30,48,212,48,218,48,228,48,
+238,48,244,48,254,49,180,49,186,49,228,49,234,49,240,49,250,50,176,50,250,
+52,8,52,14,52,48,52,110,52,116,53,46,53,52,53,58,53,248,54,174,54,180,54,
+226,54,244,55,230,56,156,57,82,57,100,57,170,57,216,58,238,59,164,60,90,60,
+120,60,126,60,156,62,18,62,40,62,50,62,232,62,238,63,40,63,46,63,56,63,90,
+63,100,63,114,63,216,63,226,63,236,63,246,64,176,65,2,65,40,65,50,65,60,65,
+242,66,28,66,34,66,216,67,2,67,188,67,226,67,232,67,242,67,252,68,230,69,
+160,70,86,70,124,70,210,71,140,72,66,72,252,73,74,73,112,73,138,74,204,74,
+210,75,28,76,14,76,32,76,38,76,108,77,58,77,76,77,90,77,100,77,134,77,140,
+77,146,77,152,77,162,78,36,78,42,78,76,78,82,78,92,78,98,78,156,78,162,78,
+168,78,178,79,104,79,110,79,180,79,190,80,164,80,174,80,248,81,26,81,36,81,
+42,81,48,81,58,81,68,81,82,81,104,81,118,81,124,81,146,81,188,82,86,82,92,
+82,106,82,124,82,158,82,168,82,242,83,20,83,94,83,104,84,30,84,64,84,70,84,
+76,84,118,84,128,84,218,84,252,85,178,85,212,85,234,85,244,86,50,86,56,86,
+62,86,68,86,74,86,236,88,18,88,28,88,210,88,244,89,126,89,216,90,166,91,132,
+92,18,93,24,94,54,94,60,94,98,95,24,95,30,95,136,95,146,95,160,95,170,95,
+204,96,134,96,168,96,202,96,236,97,18,97,200,98,126,98,144,98,162,99,0,99,
+10,99,192,99,230,99,236,100,14,100,20,100,202,100,236,100,242,100,252,101,
+6,101,192,103,254,0,2,0,79,0,4,0,33,0,0,0,35,0,41,0,30,0,43,0,47,0,37,0,49,
+0,49,0,42,0,51,0,58,0,43,0,60,0,61,0,51,0,63,0,64,0,53,0,66,0,78,0,55,0,80,
+0,80,0,68,0,82,0,82,0,69,0,84,0,84,0,70,0,87,0,87,0,71,0,90,0,90,0,72,0,92,
+0,93,0,73,0,95,0,95,0,75,0,97,0,98,0,76,0,100,0,101,0,78,0,103,0,103,0,80,
+0,106,0,110,0,81,0,112,0,115,0,86,0,118,0,118,0,90,0,120,0,120,0,91,0,123,
+0,140,0,92,0,144,0,145,0,110,0,151,0,184,0,112,0,186,0,186,0,146,0,188,0,
+196,0,147,0,198,0,199,0,156,0,201,0,201,0,158,0,204,0,204,0,159,0,206,0,206,
+0,160,0,211,0,211,0,161,0,213,0,213,0,162,0,216,0,219,0,163,0,221,0,224,0,
+167,0,226,0,227,0,171,0,229,0,232,0,173,0,234,0,235,0,177,0,237,0,240,0,179,
+0,242,1,5,0,183,1,8,1,9,0,203,1,11,1,12,0,205,1,14,1,15,0,207,1,17,1,22,0,
+209,1,24,1,25,0,215,1,27,1,27,0,217,1,29,1,30,0,218,1,32,1,35,0,220,1,37,
+1,41,0,224,1,43,1,50,0,229,1,53,1,57,0,237,1,61,1,63,0,242,1,153,1,154,0,
+245,1,156,1,163,0,247,1,165,1,169,0,255,1,172,1,175,1,4,1,177,1,178,1,8,1,
+181,1,184,1,10,1,188,1,188,1,14,1,190,1,191,1,15,1,193,1,193,1,17,1,196,1,
+200,1,18,1,202,1,203,1,23,1,205,1,205,1,25,1,208,1,208,1,26,1,211,1,211,1,
+27,1,213,1,213,1,28,1,220,1,222,1,29,1,224,1,225,1,32,1,227,1,235,1,34,1,
+237,1,238,1,43,1,240,1,240,1,45,1,243,2,0,1,46,2,12,2,22,1,60,2,24,2,26,1,
+71,2,28,2,28,1,74,2,30,2,37,1,75,2,39,2,40,1,83,2,42,2,42,1,85,0,1,0,156,
+255,172,0,2,0,9,255,133,0,84,255,133,0,51,0,44,255,174,0,54,255,174,0,84,
+255,174,0,94,255,215,0,96,255,154,0,104,255,154,0,120,255,195,0,121,255,195,
+0,128,255,174,0,129,255,113,0,133,255,195,0,147,255,195,0,222,255,174,1,12,
+255,154,1,14,255,154,1,49,255,174,1,51,255,174,1,153,255,154,1,155,255,154,
+1,156,255,154,1,157,255,154,1,158,255,174,1,169,255,154,1,172,255,195,1,173,
+255,195,1,178,255,154,1,180,255,154,1,181,255,154,1,182,255,154,1,183,255,
+154,1,189,255,154,1,191,255,195,1,193,255,154,1,194,255,154,1,195,255,154,
+1,201,255,154,1,202,255,154,1,203,255,154,1,204,255,154,1,205,255,154,1,206,
+255,154,1,207,255,154,1,213,255,215,1,222,255,113,1,223,255,154,1,224,255,
+154,1,225,255,154,1,226,255,154,1,227,255,154,1,228,255,154,2,15,255,174,
+0,43,0,40,255,72,0,70,255,154,0,76,255,195,0,77,255,195,0,105,255,215,0,106,
+255,215,0,110,255,195,0,114,255,195,0,128,255,195,0,216,255,215,0,218,255,
+133,0,220,255,154,0,225,255,154,0,228,255,154,1,7,255,154,1,8,255,154,1,9,
+255,154,1,10,255,154,1,11,255,154,1,12,255,154,1,13,255,154,1,14,255,154,
+1,15,255,154,1,16,255,154,1,17,255,154,1,18,255,154,1,19,255,154,1,20,255,
+154,1,21,255,154,1,22,255,154,1,154,255,195,1,184,255,195,1,186,255,215,1,
+235,255,133,2,23,255,133,2,24,255,113,2,31,255,154,2,32,255,154,2,33,255,
+133,2,34,255,154,2,35,255,154,2,36,255,154,2,37,255,154,0,4,0,77,255,195,
+0,84,255,154,0,120,255,133,0,128,255,174,0,1,0,156,255,172,0,48,0,40,255,
+72,0,50,255,195,0,70,255,193,0,96,255,72,0,104,255,72,0,129,255,72,0,216,
+255,154,0,218,255,133,0,220,255,154,0,225,255,133,0,228,255,133,0,233,255,
+133,0,234,255,31,1,153,255,72,1,154,255,195,1,155,255,72,1,156,255,72,1,157,
+255,72,1,158,255,72,1,169,255,72,1,178,255,236,1,180,255,72,1,181,255,72,
+1,182,255,72,1,183,255,72,1,186,255,174,1,189,255,236,1,193,255,72,1,194,
+255,72,1,195,255,72,1,201,255,72,1,202,255,72,1,203,255,72,1,204,255,72,1,
+205,255,72,1,206,255,72,1,207,255,72,1,222,255,72,1,223,255,72,1,224,255,
+72,1,225,255,72,1,226,255,72,1,227,255,72,1,228,255,72,1,232,255,174,1,235,
+255,113,2,23,255,92,2,24,255,31,0,113,0,9,255,92,0,41,255,174,0,42,255,133,
+0,54,255,133,0,62,255,133,0,67,255,113,0,68,255,113,0,69,255,113,0,71,255,
+92,0,72,255,113,0,73,255,113,0,74,255,72,0,75,255,113,0,77,255,174,0,78,255,
+113,0,79,255,113,0,80,255,113,0,81,255,113,0,83,255,113,0,84,254,205,0,85,
+255,113,0,86,255,113,0,87,255,113,0,88,255,174,0,89,255,195,0,90,255,113,
+0,94,255,154,0,102,255,154,0,107,255,113,0,108,255,113,0,109,255,113,0,111,
+255,113,0,112,255,154,0,113,255,113,0,115,255,133,0,116,255,113,0,117,255,
+133,0,119,255,133,0,120,254,164,0,121,255,154,0,128,255,113,0,133,255,174,
+0,140,255,133,0,146,255,195,0,147,255,133,0,148,255,113,0,154,255,133,0,158,
+255,174,0,162,255,92,0,168,255,133,0,169,255,174,0,171,254,225,0,172,254,
+225,0,173,254,225,0,174,254,123,0,175,254,225,0,176,254,225,0,177,254,225,
+0,178,254,225,0,179,254,225,0,180,254,123,0,181,254,225,0,182,254,225,0,200,
+255,174,0,202,255,92,0,204,255,174,0,205,255,92,0,206,255,92,0,207,255,92,
+0,208,255,31,0,209,255,92,0,210,255,72,0,211,255,92,0,212,255,92,0,249,255,
+86,0,250,255,86,0,251,255,86,1,0,255,86,1,1,255,86,1,2,255,86,1,4,255,86,
+1,5,255,86,1,6,255,86,1,10,255,154,1,12,255,133,1,14,255,154,1,18,255,133,
+1,20,255,154,1,22,255,154,1,51,255,133,1,57,255,195,1,61,255,195,1,160,255,
+154,1,161,255,174,1,197,255,72,1,198,255,92,1,200,255,92,1,213,255,31,1,229,
+255,113,1,230,255,113,1,231,255,113,1,233,255,113,1,239,255,113,1,250,255,
+86,1,251,255,86,1,252,255,86,1,254,255,86,1,255,255,86,2,0,255,86,2,15,255,
+154,2,29,255,92,2,34,255,154,2,36,255,154,0,31,0,9,255,113,0,84,255,133,0,
+120,254,246,0,133,255,174,0,140,255,215,0,147,255,113,0,148,255,133,0,158,
+255,154,0,249,255,195,0,250,255,195,0,251,255,195,0,254,255,154,1,0,255,195,
+1,1,255,195,1,2,255,195,1,4,255,195,1,5,255,195,1,6,255,113,1,57,255,195,
+1,61,255,133,1,160,255,195,1,197,255,195,1,198,255,195,1,200,255,195,1,234,
+255,133,1,250,255,195,1,251,255,195,1,252,255,195,1,254,255,195,1,255,255,
+195,2,0,255,195,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,
+254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,
+0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,
+255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,
+253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,
+22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,
+104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,
+180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,
+2,36,255,84,0,110,0,9,255,92,0,54,255,195,0,84,254,233,0,96,255,193,0,104,
+255,193,0,115,255,129,0,116,255,106,0,117,255,170,0,119,255,150,0,120,254,
+170,0,121,255,106,0,128,255,84,0,129,255,86,0,132,255,190,0,133,255,150,0,
+140,255,170,0,146,255,127,0,147,255,147,0,149,255,150,0,162,255,147,0,171,
+255,20,0,172,255,20,0,173,255,20,0,174,254,127,0,175,255,20,0,176,255,20,
+0,177,255,20,0,178,255,20,0,179,255,20,0,180,254,170,0,181,254,193,0,182,
+255,20,0,204,255,170,0,210,255,86,0,249,255,86,0,250,255,106,0,251,255,106,
+1,0,255,106,1,1,255,106,1,2,255,106,1,4,255,106,1,5,255,106,1,6,255,106,1,
+10,255,170,1,12,255,170,1,14,255,170,1,18,255,170,1,20,255,193,1,22,255,170,
+1,51,255,150,1,54,255,20,1,55,255,20,1,56,255,20,1,58,255,20,1,59,254,150,
+1,61,255,147,1,153,255,193,1,155,255,193,1,156,255,193,1,157,255,193,1,158,
+255,193,1,160,255,106,1,169,255,193,1,172,255,150,1,173,255,190,1,174,255,
+20,1,175,255,20,1,176,255,150,1,177,255,20,1,178,255,193,1,180,255,172,1,
+181,255,193,1,182,255,193,1,183,255,193,1,189,255,193,1,190,255,170,1,191,
+255,172,1,193,255,193,1,194,255,193,1,195,255,193,1,197,255,106,1,198,255,
+106,1,200,255,106,1,201,255,193,1,202,255,193,1,203,255,193,1,204,255,193,
+1,205,255,193,1,206,255,193,1,207,255,193,1,213,255,43,1,222,255,193,1,223,
+255,193,1,224,255,193,1,225,255,193,1,226,255,193,1,227,255,193,1,228,255,
+193,1,239,255,86,1,250,255,106,1,251,255,106,1,252,255,106,1,254,255,106,
+1,255,255,106,2,0,255,106,2,15,255,170,2,27,255,193,2,34,255,170,2,36,255,
+172,2,41,255,150,0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,
+120,254,213,0,128,255,106,0,156,255,86,1,239,255,106,0,68,0,9,255,51,0,41,
+255,113,0,42,255,51,0,84,254,150,0,88,255,170,0,89,255,150,0,94,255,170,0,
+102,255,127,0,120,254,86,0,121,255,63,0,128,255,41,0,132,255,170,0,133,255,
+127,0,140,255,43,0,146,255,106,0,147,255,43,0,148,255,41,0,149,255,86,0,158,
+255,127,0,162,255,86,0,168,255,106,0,171,254,66,0,172,254,66,0,173,254,66,
+0,174,254,106,0,175,254,66,0,176,254,66,0,177,254,66,0,178,254,66,0,179,254,
+66,0,180,254,106,0,181,254,84,0,182,254,66,0,200,255,150,0,202,255,23,0,205,
+255,23,0,206,255,23,0,207,255,23,0,208,255,0,0,209,255,23,0,210,255,43,0,
+211,255,23,0,212,255,23,1,12,255,170,1,14,255,170,1,18,255,150,1,20,255,170,
+1,22,255,170,1,51,255,129,1,54,255,0,1,55,255,0,1,56,255,0,1,58,255,0,1,59,
+254,170,1,61,255,106,1,63,255,193,1,161,255,170,1,174,255,0,1,175,255,0,1,
+176,255,150,1,177,255,0,1,190,255,127,1,213,255,43,1,239,255,86,2,27,255,
+172,2,29,255,23,2,34,255,172,2,36,255,190,0,19,0,9,255,133,0,84,255,133,0,
+125,0,20,1,23,255,195,1,24,255,195,1,25,255,195,1,26,255,195,1,27,255,195,
+1,28,255,195,1,29,255,195,1,30,255,195,1,31,255,195,1,32,255,195,1,33,255,
+195,1,34,255,195,1,35,255,195,1,36,255,195,1,37,255,195,1,38,255,195,0,113,
+0,9,254,213,0,14,255,63,0,40,255,190,0,41,255,43,0,42,254,240,0,62,255,20,
+0,67,254,217,0,68,254,217,0,69,254,217,0,71,254,217,0,72,254,217,0,73,254,
+217,0,74,254,217,0,75,254,217,0,76,255,150,0,77,255,106,0,78,254,217,0,79,
+254,217,0,80,254,233,0,81,254,217,0,83,254,217,0,84,255,23,0,85,254,217,0,
+86,254,217,0,87,254,217,0,88,255,106,0,89,255,106,0,90,254,217,0,94,254,236,
+0,96,255,129,0,102,255,63,0,104,255,129,0,120,254,63,0,121,255,0,0,128,254,
+150,0,129,255,0,0,133,255,170,0,140,254,170,0,146,255,106,0,147,254,193,0,
+148,254,193,0,149,255,150,0,158,254,106,0,162,254,236,0,166,255,106,0,167,
+255,129,0,169,255,63,0,170,255,129,0,200,255,43,0,210,254,236,1,10,255,51,
+1,12,255,51,1,14,255,51,1,18,255,51,1,20,255,51,1,22,255,51,1,51,255,0,1,
+54,254,23,1,55,254,23,1,56,254,23,1,57,255,174,1,58,254,23,1,59,253,217,1,
+61,255,92,1,153,255,129,1,155,255,129,1,156,255,129,1,157,254,150,1,158,255,
+129,1,161,255,43,1,169,255,129,1,173,255,43,1,174,254,23,1,175,254,23,1,177,
+254,23,1,178,255,129,1,180,255,129,1,181,255,129,1,182,255,129,1,183,255,
+129,1,188,255,129,1,189,255,129,1,190,255,127,1,191,255,63,1,192,255,63,1,
+193,255,129,1,194,255,129,1,195,255,129,1,196,255,106,1,199,255,86,1,201,
+255,129,1,202,255,129,1,203,255,129,1,204,255,129,1,205,255,129,1,206,255,
+129,1,207,255,129,1,213,255,63,1,222,255,129,1,223,255,129,1,224,255,129,
+1,225,255,129,1,226,255,129,1,227,255,129,1,228,255,129,1,229,254,217,1,230,
+254,217,1,231,254,217,1,233,254,217,1,234,254,213,1,235,255,127,1,237,255,
+193,1,239,254,213,0,8,0,9,255,31,0,120,254,236,0,147,255,106,0,156,255,84,
+1,6,255,106,1,213,255,172,1,234,255,127,1,246,255,23,0,6,0,6,255,174,0,7,
+255,174,0,8,255,174,0,9,255,133,0,18,0,43,0,84,255,133,0,137,0,4,255,174,
+0,5,255,174,0,10,255,174,0,14,0,20,0,29,255,18,0,30,255,18,0,31,255,18,0,
+32,255,18,0,33,255,18,0,34,255,18,0,35,255,174,0,36,255,174,0,37,255,18,0,
+38,255,18,0,39,255,18,0,41,255,86,0,54,255,92,0,62,255,92,0,67,255,129,0,
+68,255,129,0,69,255,129,0,71,255,66,0,72,255,129,0,73,255,129,0,74,255,129,
+0,75,255,129,0,78,255,129,0,79,255,129,0,80,255,129,0,81,255,129,0,83,255,
+129,0,84,254,129,0,85,255,106,0,86,255,20,0,87,255,129,0,90,255,129,0,94,
+255,133,0,96,255,215,0,104,255,213,0,120,254,213,0,128,255,51,0,129,255,215,
+0,142,255,215,0,143,254,102,0,144,254,102,0,145,254,102,0,146,255,195,0,148,
+255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,171,254,229,0,172,254,150,
+0,173,254,229,0,174,254,213,0,175,254,229,0,176,254,229,0,177,254,229,0,178,
+254,229,0,179,254,229,0,180,254,229,0,181,254,229,0,182,254,229,0,185,255,
+18,0,186,255,18,0,187,255,18,0,189,255,18,0,208,255,0,0,212,255,20,0,253,
+255,106,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,
+255,84,1,51,255,113,1,54,254,231,1,55,254,231,1,56,254,231,1,58,254,231,1,
+59,254,129,1,63,255,170,1,153,255,215,1,155,255,215,1,156,255,215,1,157,254,
+252,1,158,255,104,1,160,255,84,1,163,255,18,1,164,255,18,1,165,255,119,1,
+168,255,84,1,169,255,215,1,172,255,86,1,174,254,231,1,175,254,231,1,177,254,
+231,1,178,255,106,1,180,255,0,1,181,255,215,1,182,255,215,1,183,255,215,1,
+189,255,215,1,193,255,215,1,194,255,215,1,195,255,215,1,201,255,215,1,202,
+255,215,1,203,255,215,1,204,255,215,1,205,255,215,1,206,255,215,1,207,255,
+215,1,222,255,215,1,223,255,215,1,224,255,215,1,225,255,215,1,226,255,215,
+1,227,255,215,1,228,255,215,1,229,255,129,1,230,255,129,1,231,255,129,1,233,
+255,129,1,234,255,129,1,243,255,35,1,244,255,63,1,245,255,35,1,246,255,35,
+1,247,255,35,1,248,255,35,1,249,255,35,2,15,255,92,2,27,255,150,2,34,255,
+84,2,36,255,84,0,93,0,6,255,174,0,7,255,174,0,8,255,174,0,9,255,51,0,29,255,
+170,0,30,255,170,0,31,255,170,0,32,255,170,0,33,255,170,0,34,255,170,0,37,
+255,170,0,38,255,170,0,39,255,170,0,107,255,127,0,108,255,127,0,109,255,127,
+0,111,255,127,0,112,255,127,0,113,255,127,0,120,255,41,0,123,255,150,0,124,
+255,150,0,125,255,150,0,127,255,150,0,130,255,150,0,131,255,150,0,134,255,
+150,0,143,255,43,0,144,255,43,0,145,255,43,0,147,255,170,0,148,255,147,0,
+156,255,84,0,171,255,86,0,172,255,86,0,173,255,86,0,174,255,86,0,175,255,
+86,0,176,255,86,0,177,255,86,0,178,255,86,0,179,255,86,0,180,255,86,0,181,
+255,86,0,182,255,86,0,185,255,170,0,186,255,170,0,187,255,170,0,189,255,170,
+0,192,255,190,0,193,255,190,0,194,255,190,0,249,255,127,0,250,255,127,0,251,
+255,127,1,0,255,127,1,1,255,127,1,2,255,127,1,4,255,127,1,5,255,127,1,6,255,
+106,1,47,255,193,1,54,255,41,1,55,255,41,1,56,255,41,1,58,255,41,1,59,255,
+41,1,160,255,127,1,163,255,170,1,164,255,170,1,165,255,170,1,174,255,41,1,
+175,255,41,1,176,255,193,1,177,255,41,1,197,255,127,1,198,255,127,1,200,255,
+127,1,213,255,41,1,234,255,129,1,243,255,106,1,244,255,106,1,245,255,106,
+1,246,255,23,1,247,255,106,1,248,255,106,1,249,255,106,1,250,255,127,1,251,
+255,127,1,252,255,127,1,254,255,127,1,255,255,127,2,0,255,127,0,217,0,6,255,
+150,0,7,255,150,0,8,255,150,0,9,255,129,0,14,255,233,0,27,255,254,0,28,255,
+254,0,29,255,80,0,30,255,80,0,31,255,80,0,32,255,80,0,33,255,80,0,34,255,
+80,0,37,255,80,0,38,255,80,0,39,255,80,0,48,255,254,0,49,255,254,0,54,255,
+215,0,62,255,193,0,67,255,164,0,68,255,164,0,69,255,164,0,71,255,43,0,72,
+255,164,0,73,255,233,0,74,255,164,0,75,255,164,0,78,255,164,0,79,255,164,
+0,80,255,164,0,81,255,164,0,83,255,84,0,84,254,233,0,85,255,236,0,86,255,
+164,0,87,255,164,0,90,255,164,0,94,255,195,0,96,255,215,0,104,255,215,0,107,
+255,154,0,108,255,154,0,109,255,154,0,111,255,154,0,112,255,154,0,113,255,
+154,0,115,255,133,0,116,255,133,0,117,255,154,0,119,255,133,0,120,254,213,
+0,121,255,145,0,123,255,39,0,124,255,39,0,125,255,39,0,127,255,39,0,128,255,
+106,0,129,255,215,0,130,255,39,0,131,255,39,0,134,255,39,0,138,255,215,0,
+141,255,215,0,142,255,215,0,143,254,127,0,144,254,127,0,145,254,127,0,156,
+255,86,0,162,255,123,0,168,255,166,0,169,255,188,0,171,255,35,0,172,255,35,
+0,173,255,35,0,174,254,100,0,175,255,35,0,176,255,35,0,177,254,229,0,178,
+255,35,0,179,255,35,0,180,255,35,0,181,254,125,0,182,255,35,0,183,255,254,
+0,184,255,254,0,185,255,80,0,186,255,80,0,187,255,80,0,188,255,254,0,189,
+255,80,0,190,255,254,0,191,255,254,0,192,255,102,0,193,255,102,0,194,255,
+102,0,195,255,254,0,202,255,63,0,205,255,63,0,206,255,63,0,207,255,63,0,208,
+255,43,0,209,255,63,0,210,255,43,0,211,255,63,0,212,255,23,0,213,255,166,
+0,214,255,166,0,215,255,166,0,217,255,166,0,218,0,86,0,219,255,166,0,227,
+0,63,0,249,255,16,0,250,255,16,0,251,255,16,1,0,255,16,1,1,255,16,1,2,255,
+16,1,4,255,16,1,5,255,139,1,6,255,16,1,10,255,186,1,12,255,186,1,14,255,186,
+1,18,255,186,1,20,255,186,1,22,255,186,1,23,0,63,1,24,0,63,1,25,0,63,1,26,
+0,63,1,27,0,63,1,28,0,63,1,29,0,63,1,30,0,63,1,31,0,63,1,32,0,63,1,33,0,63,
+1,34,0,63,1,35,0,63,1,36,0,63,1,37,0,63,1,38,0,63,1,39,255,254,1,40,255,254,
+1,41,255,166,1,42,255,166,1,43,255,166,1,44,255,254,1,153,255,215,1,155,255,
+215,1,156,255,215,1,157,255,78,1,158,255,145,1,160,255,16,1,162,255,254,1,
+163,255,80,1,164,255,80,1,165,255,80,1,169,255,215,1,178,255,215,1,180,255,
+215,1,181,255,215,1,182,0,20,1,183,255,215,1,189,255,215,1,193,255,215,1,
+194,255,215,1,195,255,215,1,197,255,16,1,198,255,16,1,200,255,16,1,201,255,
+215,1,202,255,215,1,203,255,215,1,204,255,215,1,205,255,215,1,206,255,215,
+1,207,255,215,1,215,255,209,1,216,255,209,1,217,255,209,1,218,255,209,1,219,
+255,209,1,220,255,252,1,221,255,209,1,222,255,215,1,223,255,215,1,224,255,
+215,1,225,255,215,1,226,255,215,1,227,255,215,1,228,255,215,1,229,255,164,
+1,230,255,164,1,231,255,164,1,233,255,164,1,234,255,127,1,239,255,193,1,243,
+254,213,1,244,254,213,1,245,254,213,1,246,254,213,1,247,254,213,1,248,254,
+233,1,249,254,213,1,250,255,16,1,251,255,16,1,252,255,16,1,254,255,16,1,255,
+255,16,2,0,255,106,2,15,255,195,2,29,255,63,2,34,255,186,2,36,255,186,0,11,
+0,6,255,174,0,7,255,174,0,8,255,174,0,9,255,51,0,120,254,236,0,147,255,106,
+0,156,255,84,1,6,255,106,1,213,255,172,1,234,255,127,1,246,255,23,0,11,0,
+6,255,133,0,7,255,133,0,8,255,133,0,9,255,113,0,120,254,236,0,147,255,106,
+0,156,255,84,1,6,255,106,1,213,255,172,1,234,255,127,1,246,255,23,0,66,0,
+4,255,84,0,5,255,84,0,9,255,63,0,10,255,133,0,35,255,84,0,36,255,84,0,41,
+255,84,0,42,255,106,0,54,255,86,0,62,255,86,0,67,255,39,0,68,255,39,0,69,
+255,39,0,71,254,213,0,72,255,39,0,73,255,39,0,74,255,39,0,75,255,39,0,78,
+255,39,0,79,255,39,0,80,255,39,0,81,254,236,0,83,255,39,0,84,254,150,0,85,
+255,39,0,86,254,193,0,87,255,39,0,90,255,39,0,120,254,63,0,121,255,86,0,128,
+255,20,0,140,255,170,0,146,255,150,0,147,255,150,0,148,255,63,0,149,255,106,
+0,162,255,63,0,171,254,236,0,172,254,236,0,173,254,236,0,174,254,20,0,175,
+254,236,0,176,254,236,0,177,254,236,0,178,254,236,0,179,254,236,0,180,254,
+236,0,181,254,63,0,182,254,86,0,210,255,43,0,253,255,106,1,10,255,86,1,12,
+255,86,1,14,255,86,1,18,255,86,1,20,255,86,1,22,255,86,1,51,255,127,1,63,
+255,127,1,213,255,63,1,229,255,39,1,230,255,39,1,231,255,39,1,233,255,39,
+1,234,255,20,1,239,255,86,0,14,0,84,255,215,0,171,255,133,0,172,255,133,0,
+173,255,133,0,174,255,133,0,175,255,133,0,176,255,133,0,177,255,133,0,178,
+255,133,0,179,255,133,0,180,255,133,0,181,255,133,0,182,255,133,0,242,255,
+190,0,8,0,9,255,133,0,84,255,133,0,244,255,106,0,245,255,106,0,246,255,106,
+0,248,255,106,0,252,255,106,0,255,255,106,0,11,0,9,255,174,0,41,255,170,0,
+42,255,150,0,102,255,170,0,120,255,127,0,128,255,127,0,140,255,170,0,147,
+255,150,0,148,255,129,1,176,255,193,1,213,255,150,0,52,0,40,255,127,0,84,
+255,150,0,96,255,154,0,104,255,154,0,120,255,170,0,129,255,154,0,216,255,
+213,0,218,255,193,0,220,255,172,0,225,255,193,0,228,255,170,0,233,255,172,
+0,234,255,109,1,3,0,66,1,60,255,193,1,153,255,154,1,155,255,154,1,156,255,
+154,1,157,255,154,1,158,255,154,1,169,255,154,1,178,0,20,1,180,255,236,1,
+181,255,154,1,182,255,154,1,183,255,154,1,189,255,154,1,190,0,61,1,193,255,
+154,1,194,255,154,1,195,255,154,1,199,0,63,1,201,255,154,1,202,255,154,1,
+203,255,154,1,204,255,154,1,205,255,154,1,206,255,154,1,207,255,154,1,213,
+255,195,1,222,255,154,1,223,255,154,1,224,255,154,1,225,255,154,1,226,255,
+154,1,227,255,154,1,228,255,154,1,232,255,195,1,234,255,170,1,235,255,170,
+2,23,255,213,2,24,255,150,0,4,0,84,255,106,0,147,255,170,0,148,255,150,1,
+176,255,150,0,49,0,11,255,154,0,12,255,154,0,13,255,154,0,14,255,154,0,15,
+255,154,0,16,255,154,0,17,255,154,0,18,255,154,0,19,255,106,0,20,255,106,
+0,21,255,106,0,22,255,106,0,23,255,106,0,24,255,106,0,25,255,106,0,26,255,
+106,0,40,255,127,0,96,255,106,0,104,255,106,0,129,255,106,1,153,255,106,1,
+155,255,106,1,156,255,106,1,157,255,106,1,158,255,106,1,169,255,106,1,178,
+255,106,1,180,255,106,1,181,255,106,1,182,255,106,1,183,255,106,1,189,255,
+106,1,193,255,106,1,194,255,106,1,195,255,106,1,201,255,106,1,202,255,106,
+1,203,255,106,1,204,255,106,1,205,255,106,1,206,255,106,1,207,255,106,1,222,
+255,170,1,223,255,170,1,224,255,170,1,225,255,170,1,226,255,170,1,227,255,
+170,1,228,255,170,0,9,0,11,255,133,0,12,255,133,0,13,255,133,0,14,255,133,
+0,15,255,133,0,16,255,133,0,17,255,133,0,18,255,133,0,40,255,63,0,1,0,120,
+255,172,0,2,0,9,255,133,0,84,255,133,0,1,0,84,255,170,0,7,0,40,255,150,0,
+84,255,193,0,216,255,154,0,220,255,193,0,225,255,193,2,23,255,150,2,24,255,
+150,0,1,0,84,255,170,0,1,0,40,255,63,0,11,0,40,255,63,0,91,255,215,0,92,255,
+215,0,93,255,215,0,94,255,215,0,95,255,215,0,97,255,215,0,98,255,215,1,166,
+255,215,1,167,255,215,1,168,255,215,0,3,0,84,255,213,0,120,255,150,1,213,
+255,213,0,6,0,9,255,172,0,84,255,84,0,120,255,92,0,128,255,195,1,61,255,174,
+1,234,255,129,0,6,0,71,255,150,0,84,255,106,0,120,255,106,0,147,255,150,0,
+148,255,190,1,176,255,127,0,3,0,9,255,133,0,71,255,147,0,84,255,106,0,11,
+0,84,255,106,0,120,255,23,0,128,255,168,0,133,255,193,0,140,255,170,0,148,
+255,129,0,158,255,172,0,168,255,193,0,210,255,133,1,51,255,193,1,61,255,150,
+0,1,1,50,255,195,0,2,0,9,255,174,0,84,255,154,0,2,0,9,255,133,0,84,255,133,
+0,72,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,
+106,0,86,255,20,0,94,255,133,0,96,255,174,0,104,255,213,0,120,254,213,0,128,
+255,51,0,129,255,174,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,
+0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,
+20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,
+84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,153,255,174,1,155,
+255,174,1,156,255,174,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,
+119,1,168,255,84,1,169,255,174,1,172,255,86,1,178,255,106,1,180,255,0,1,181,
+255,174,1,182,255,174,1,183,255,174,1,189,255,174,1,193,255,174,1,194,255,
+174,1,195,255,174,1,201,255,174,1,202,255,174,1,203,255,174,1,204,255,174,
+1,205,255,174,1,206,255,174,1,207,255,174,1,222,255,174,1,223,255,174,1,224,
+255,174,1,225,255,174,1,226,255,174,1,227,255,174,1,228,255,174,1,234,255,
+129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,5,0,6,
+255,195,0,7,255,195,0,8,255,195,0,9,255,174,0,84,255,154,0,9,0,9,255,129,
+0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,0,156,255,
+86,0,174,254,213,1,239,255,106,0,2,0,9,255,174,0,84,255,154,0,11,0,9,255,
+174,0,11,255,195,0,12,255,195,0,13,255,195,0,14,255,195,0,15,255,195,0,16,
+255,195,0,17,255,195,0,18,255,195,0,40,255,172,0,84,255,170,0,15,0,14,255,
+172,0,54,255,88,0,71,255,0,0,84,254,236,0,94,255,106,0,154,255,150,1,10,255,
+86,1,12,255,86,1,14,255,86,1,18,255,86,1,20,255,86,1,22,255,86,1,239,255,
+86,2,34,255,86,2,36,255,86,0,2,0,9,255,133,0,84,255,133,0,45,0,14,255,154,
+0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,
+0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,
+255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,
+0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,
+84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,
+129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,
+168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,
+63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,9,0,9,255,129,0,30,
+255,20,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,
+0,156,255,86,1,239,255,106,0,1,0,9,255,174,0,15,0,14,255,172,0,54,255,88,
+0,71,255,0,0,84,254,236,0,94,255,106,0,154,255,150,1,10,255,86,1,12,255,86,
+1,14,255,86,1,18,255,86,1,20,255,86,1,22,255,86,1,239,255,86,2,34,255,86,
+2,36,255,86,0,1,0,84,255,147,0,1,0,84,255,127,0,3,0,84,255,129,0,120,255,
+129,1,234,255,170,0,10,0,6,255,174,0,7,255,174,0,8,255,174,0,84,255,23,0,
+244,255,174,0,245,255,174,0,246,255,174,0,248,255,174,0,252,255,174,0,255,
+255,174,0,1,0,84,255,150,0,4,0,6,255,174,0,7,255,174,0,8,255,174,0,84,255,
+147,0,26,0,6,255,174,0,7,255,174,0,8,255,174,0,84,255,147,0,143,255,66,0,
+144,255,66,0,145,255,66,0,249,255,213,0,250,255,213,0,251,255,213,1,0,255,
+213,1,1,255,213,1,2,255,213,1,4,255,213,1,5,255,213,1,6,255,213,1,160,255,
+213,1,197,255,213,1,198,255,213,1,200,255,213,1,250,255,213,1,251,255,213,
+1,252,255,213,1,254,255,213,1,255,255,213,2,0,255,213,0,7,0,9,255,174,0,84,
+255,106,0,140,254,213,0,147,255,0,0,148,255,106,0,158,255,20,1,61,255,172,
+0,2,0,9,255,133,0,84,255,133,0,2,0,84,255,129,0,120,255,106,0,1,0,84,255,
+129,0,2,0,9,255,133,0,84,255,133,0,1,1,213,255,193,0,3,0,40,255,147,2,23,
+255,170,2,24,255,129,0,35,0,6,255,133,0,7,255,133,0,8,255,133,0,84,255,147,
+0,140,255,150,0,143,255,43,0,144,255,43,0,145,255,43,0,244,255,102,0,245,
+255,102,0,246,255,102,0,248,255,102,0,249,255,174,0,250,255,174,0,251,255,
+174,0,252,255,102,0,255,255,102,1,0,255,174,1,1,255,174,1,2,255,174,1,4,255,
+174,1,5,255,174,1,6,255,174,1,47,255,127,1,160,255,174,1,176,255,150,1,197,
+255,174,1,198,255,174,1,200,255,174,1,250,255,174,1,251,255,174,1,252,255,
+174,1,254,255,174,1,255,255,174,2,0,255,174,0,2,0,9,255,133,0,84,255,133,
+0,11,0,9,255,133,0,19,255,195,0,20,255,195,0,21,255,195,0,22,255,195,0,23,
+255,195,0,24,255,195,0,25,255,195,0,26,255,195,0,84,255,133,1,47,255,150,
+0,2,0,9,255,133,0,84,255,133,0,46,0,14,255,154,0,32,255,106,0,41,255,86,0,
+54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,
+0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,
+255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,
+0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,
+1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,
+1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,
+255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,
+27,255,150,2,34,255,84,2,36,255,84,0,10,0,9,255,129,0,32,255,150,0,54,255,
+215,0,62,255,195,0,84,255,20,0,120,254,236,0,128,255,106,0,156,255,86,0,210,
+255,127,1,239,255,106,0,9,0,11,255,195,0,12,255,195,0,13,255,195,0,14,255,
+195,0,15,255,195,0,16,255,195,0,17,255,195,0,18,255,195,0,40,255,150,0,107,
+0,14,255,172,0,54,255,88,0,67,255,170,0,68,255,170,0,69,255,170,0,71,255,
+0,0,72,255,170,0,73,255,170,0,74,255,170,0,75,255,170,0,78,255,170,0,79,255,
+170,0,80,255,170,0,81,255,170,0,83,255,170,0,84,254,236,0,85,255,170,0,86,
+255,170,0,87,255,170,0,90,255,170,0,94,255,106,0,96,255,150,0,104,255,150,
+0,129,255,150,0,154,255,150,0,244,255,86,0,245,255,86,0,246,255,86,0,248,
+255,86,0,249,255,127,0,250,255,127,0,251,255,127,0,252,255,86,0,255,255,86,
+1,0,255,127,1,1,255,127,1,2,255,127,1,4,255,127,1,5,255,127,1,6,255,127,1,
+10,255,86,1,12,255,86,1,14,255,86,1,18,255,86,1,20,255,86,1,22,255,86,1,54,
+255,86,1,55,255,86,1,56,255,86,1,58,255,86,1,59,254,172,1,153,255,150,1,155,
+255,150,1,156,255,150,1,157,255,150,1,158,255,150,1,160,255,127,1,169,255,
+150,1,174,255,86,1,175,255,86,1,177,254,147,1,178,255,150,1,180,255,150,1,
+181,255,150,1,182,255,150,1,183,255,150,1,189,255,150,1,193,255,150,1,194,
+255,150,1,195,255,150,1,197,255,127,1,198,255,127,1,200,255,127,1,201,255,
+150,1,202,255,150,1,203,255,150,1,204,255,150,1,205,255,150,1,206,255,150,
+1,207,255,150,1,222,255,150,1,223,255,150,1,224,255,150,1,225,255,150,1,226,
+255,150,1,227,255,150,1,228,255,150,1,229,255,170,1,230,255,170,1,231,255,
+170,1,233,255,170,1,239,255,150,1,243,255,150,1,244,255,150,1,245,255,150,
+1,246,255,150,1,247,255,150,1,248,255,150,1,249,255,150,1,250,255,127,1,251,
+255,127,1,252,255,127,1,254,255,127,1,255,255,127,2,0,255,127,2,34,255,86,
+2,36,255,86,0,2,0,9,255,133,0,84,255,133,0,46,0,14,255,154,0,32,255,86,0,
+41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,
+94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,
+195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,
+254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,
+14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,
+63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,
+84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,
+255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,24,0,9,255,129,0,29,255,20,
+0,30,255,20,0,31,255,20,0,32,255,170,0,33,255,20,0,34,255,20,0,37,255,20,
+0,38,255,20,0,39,255,20,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,
+0,128,255,106,0,156,255,86,0,185,255,20,0,186,255,20,0,187,255,20,0,189,255,
+20,1,163,255,20,1,164,255,20,1,165,255,20,1,239,255,106,0,30,0,14,255,172,
+0,54,255,88,0,71,255,0,0,84,254,236,0,94,255,106,0,154,255,150,0,221,255,
+127,0,222,255,127,0,223,255,127,0,224,255,127,0,226,255,213,0,227,255,127,
+0,229,255,127,0,230,255,127,0,231,255,127,0,232,255,127,0,235,255,127,1,10,
+255,86,1,12,255,86,1,14,255,86,1,18,255,86,1,20,255,86,1,22,255,86,1,239,
+255,86,2,19,255,127,2,20,255,127,2,21,255,127,2,22,255,127,2,34,255,86,2,
+36,255,86,0,1,0,22,255,172,0,1,1,213,255,92,0,1,0,84,255,152,0,8,0,22,255,
+172,0,23,255,133,0,244,255,215,0,245,255,215,0,246,255,215,0,248,255,215,
+0,252,255,215,0,255,255,215,0,7,0,22,255,172,0,244,255,215,0,245,255,215,
+0,246,255,215,0,248,255,215,0,252,255,215,0,255,255,215,0,1,0,40,255,129,
+0,1,0,84,255,150,0,4,0,228,255,195,0,233,255,174,0,234,255,170,1,235,255,
+174,0,2,0,40,255,150,0,218,255,127,0,19,0,19,255,195,0,20,255,195,0,21,255,
+195,0,22,255,172,0,23,255,195,0,24,255,195,0,25,255,195,0,26,255,195,0,43,
+255,193,0,45,255,193,0,46,255,193,0,47,255,193,0,244,255,215,0,245,255,215,
+0,246,255,215,0,248,255,215,0,252,255,215,0,255,255,215,1,62,255,193,0,3,
+0,84,255,106,0,120,255,84,1,234,255,170,0,2,0,9,255,133,0,84,255,133,0,45,
+0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,
+0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,
+215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,
+254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,
+1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,
+1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,
+255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,
+1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,1,0,84,255,
+127,0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,
+128,255,72,0,156,255,86,1,239,255,106,0,1,0,84,255,213,0,1,0,40,255,86,0,
+19,0,9,255,133,0,14,0,23,0,84,255,133,0,107,255,215,0,108,255,215,0,109,255,
+215,0,111,255,215,0,112,255,215,0,113,255,215,0,123,255,31,0,124,255,31,0,
+125,255,31,0,127,255,31,0,130,255,31,0,131,255,31,0,134,255,31,0,143,254,
+190,0,144,254,190,0,145,254,190,0,18,0,9,255,133,0,29,255,172,0,30,255,150,
+0,31,255,172,0,32,255,172,0,33,255,172,0,34,255,172,0,37,255,172,0,38,255,
+172,0,39,255,172,0,84,255,133,0,185,255,172,0,186,255,172,0,187,255,172,0,
+189,255,172,1,163,255,172,1,164,255,172,1,165,255,172,0,2,0,9,255,154,0,84,
+255,106,0,15,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,
+213,0,123,255,10,0,124,255,10,0,125,255,10,0,127,255,10,0,128,255,106,0,130,
+255,10,0,131,255,10,0,134,255,10,0,156,255,86,1,239,255,106,0,2,0,9,255,133,
+0,84,255,133,0,8,0,84,255,131,0,120,255,113,0,140,255,215,1,57,255,215,1,
+61,255,154,1,176,255,133,1,213,255,150,1,234,255,150,0,2,0,9,255,133,0,84,
+255,133,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,
+0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,
+51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,
+255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,
+1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,
+51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,
+84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,
+255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,1,
+1,235,255,150,0,1,0,84,255,129,0,1,0,84,255,150,0,2,0,9,255,133,0,84,255,
+133,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,
+85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,
+51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,
+255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,
+1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,
+51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,
+84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,
+255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,11,
+0,174,254,236,0,208,255,84,1,10,255,193,1,12,255,195,1,14,255,195,1,18,255,
+195,1,20,255,195,1,22,255,195,1,157,255,154,2,34,255,195,2,36,255,195,0,38,
+0,9,255,51,0,29,255,86,0,30,255,86,0,31,255,86,0,32,255,86,0,33,255,86,0,
+34,255,86,0,37,255,86,0,38,255,86,0,39,255,86,0,83,255,106,0,84,255,63,0,
+107,255,170,0,108,255,170,0,109,255,170,0,111,255,170,0,112,255,170,0,113,
+255,170,0,115,255,170,0,116,255,170,0,117,255,170,0,119,255,170,0,143,254,
+170,0,144,254,170,0,145,254,170,0,185,255,86,0,186,255,86,0,187,255,86,0,
+189,255,86,0,244,255,66,0,245,255,66,0,246,255,66,0,248,255,66,0,252,255,
+66,0,255,255,66,1,163,255,86,1,164,255,86,1,165,255,86,0,45,0,14,255,154,
+0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,
+0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,
+255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,
+0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,
+84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,
+129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,
+168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,
+63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,14,0,6,255,133,0,7,
+255,133,0,8,255,133,0,174,254,236,0,208,255,84,1,10,255,193,1,12,255,195,
+1,14,255,195,1,18,255,195,1,20,255,195,1,22,255,195,1,157,255,154,2,34,255,
+195,2,36,255,195,0,9,0,9,255,129,0,14,255,213,0,54,255,215,0,62,255,195,0,
+84,255,20,0,120,254,213,0,128,255,106,0,156,255,86,1,239,255,106,0,14,0,6,
+255,154,0,7,255,154,0,8,255,154,0,174,254,236,0,208,255,84,1,10,255,193,1,
+12,255,195,1,14,255,195,1,18,255,195,1,20,255,195,1,22,255,195,1,157,255,
+154,2,34,255,195,2,36,255,195,0,27,0,174,254,236,0,208,255,84,1,10,255,193,
+1,12,255,195,1,14,255,195,1,18,255,195,1,20,255,195,1,22,255,195,1,23,255,
+195,1,24,255,195,1,25,255,195,1,26,255,195,1,27,255,195,1,28,255,195,1,29,
+255,195,1,30,255,195,1,31,255,195,1,32,255,195,1,33,255,195,1,34,255,195,
+1,35,255,195,1,36,255,195,1,37,255,195,1,38,255,195,1,157,255,154,2,34,255,
+195,2,36,255,195,0,14,0,6,255,195,0,7,255,195,0,8,255,195,0,174,254,236,0,
+208,255,84,1,10,255,193,1,12,255,195,1,14,255,195,1,18,255,195,1,20,255,195,
+1,22,255,195,1,157,255,154,2,34,255,195,2,36,255,195,0,2,0,9,255,174,0,84,
+255,106,0,2,0,9,255,133,0,84,255,133,0,45,0,14,0,20,0,41,255,86,0,54,255,
+92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,
+213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,
+156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,
+0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,
+84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,
+252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,
+178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,
+2,34,255,84,2,36,255,84,0,2,0,9,255,174,0,84,255,154,0,27,0,9,255,129,0,29,
+255,63,0,30,255,63,0,31,255,63,0,32,255,63,0,33,255,63,0,34,255,63,0,37,255,
+63,0,38,255,63,0,39,255,63,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,
+213,0,128,255,106,0,143,254,170,0,144,254,170,0,145,254,170,0,156,255,86,
+0,185,255,63,0,186,255,63,0,187,255,63,0,189,255,63,1,163,255,63,1,164,255,
+63,1,165,255,63,1,239,255,106,0,2,0,9,255,174,0,84,255,154,0,10,0,9,255,174,
+0,11,255,215,0,12,255,215,0,13,255,215,0,14,255,215,0,15,255,215,0,16,255,
+215,0,17,255,215,0,18,255,215,0,84,255,154,0,2,0,9,255,133,0,84,255,133,0,
+23,0,4,255,215,0,5,255,215,0,9,255,133,0,10,255,215,0,29,255,150,0,30,255,
+150,0,31,255,150,0,32,255,150,0,33,255,150,0,34,255,150,0,35,255,215,0,36,
+255,215,0,37,255,150,0,38,255,150,0,39,255,150,0,84,255,133,0,185,255,150,
+0,186,255,150,0,187,255,150,0,189,255,150,1,163,255,150,1,164,255,150,1,165,
+255,150,0,18,0,6,255,215,0,7,255,215,0,8,255,215,0,14,255,172,0,54,255,88,
+0,71,255,0,0,84,255,84,0,94,255,106,0,154,255,150,1,10,255,86,1,12,255,86,
+1,14,255,86,1,18,255,86,1,20,255,86,1,22,255,86,1,239,255,86,2,34,255,86,
+2,36,255,86,0,12,0,9,255,129,0,34,255,100,0,54,255,215,0,62,255,195,0,84,
+255,20,0,120,254,213,0,128,255,106,0,143,254,170,0,144,254,170,0,145,254,
+170,0,156,255,86,1,239,255,106,0,3,0,9,255,133,0,14,0,41,0,84,255,133,0,2,
+0,9,255,174,0,84,255,154,0,2,0,9,255,133,0,84,255,133,0,45,0,14,255,154,0,
+41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,
+94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,
+195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,
+254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,
+14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,
+63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,
+84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,
+255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,3,0,9,255,174,0,84,255,154,
+0,108,255,195,0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,
+254,213,0,128,255,106,0,156,255,86,1,239,255,106,0,8,0,9,255,174,0,84,255,
+154,0,107,255,193,0,108,255,193,0,109,255,193,0,111,255,193,0,112,255,193,
+0,113,255,193,0,27,0,9,255,174,0,11,255,195,0,12,255,195,0,13,255,195,0,14,
+255,195,0,15,255,195,0,16,255,195,0,17,255,195,0,18,255,195,0,84,255,154,
+0,108,255,195,1,23,255,174,1,24,255,174,1,25,255,174,1,26,255,174,1,27,255,
+174,1,28,255,174,1,29,255,174,1,30,255,174,1,31,255,174,1,32,255,174,1,33,
+255,174,1,34,255,174,1,35,255,174,1,36,255,174,1,37,255,174,1,38,255,174,
+0,2,0,9,255,133,0,84,255,133,0,3,0,9,255,133,0,14,0,20,0,84,255,133,0,17,
+0,14,255,172,0,30,255,63,0,32,255,170,0,54,255,88,0,71,255,0,0,84,254,236,
+0,94,255,106,0,154,255,150,1,10,255,86,1,12,255,86,1,14,255,86,1,18,255,86,
+1,20,255,86,1,22,255,86,1,239,255,86,2,34,255,86,2,36,255,86,0,21,0,9,255,
+129,0,14,255,213,0,32,255,170,0,54,255,215,0,62,255,195,0,84,255,20,0,120,
+254,213,0,128,255,106,0,139,0,2,0,143,254,172,0,144,254,172,0,145,254,172,
+0,156,255,86,1,239,255,106,1,243,254,205,1,244,254,205,1,245,254,205,1,246,
+254,205,1,247,254,205,1,248,254,205,1,249,254,205,0,3,0,9,255,133,0,18,0,
+20,0,84,255,133,0,1,0,84,255,215,0,45,0,14,255,154,0,41,255,86,0,54,255,92,
+0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,
+213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,
+156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,
+0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,
+84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,
+252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,
+178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,
+2,34,255,84,2,36,255,84,0,1,0,40,255,86,0,2,0,9,255,133,0,84,255,133,0,2,
+0,40,255,109,0,147,255,170,0,1,0,84,255,215,0,2,0,9,255,133,0,84,255,133,
+0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,
+106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,
+255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,
+0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,
+84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,
+1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,
+255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,
+1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,1,0,9,255,
+174,0,10,0,9,255,129,0,14,255,233,0,32,255,170,0,54,255,215,0,62,255,195,
+0,84,255,20,0,120,254,213,0,128,255,106,0,156,255,86,1,239,255,106,0,1,0,
+84,255,215,0,1,2,22,255,172,0,2,0,9,255,133,0,84,255,133,0,45,0,14,255,154,
+0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,
+0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,
+255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,
+0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,
+84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,
+129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,
+168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,
+63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,18,0,9,255,129,0,32,
+255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,
+0,156,255,86,0,202,255,31,0,205,255,31,0,206,255,31,0,207,255,31,0,208,255,
+31,0,209,255,31,0,211,255,31,0,212,255,31,1,239,255,106,2,29,255,31,0,67,
+0,14,255,63,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,
+0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,
+215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,
+254,150,0,174,254,213,0,202,255,31,0,205,255,31,0,206,255,31,0,207,255,31,
+0,208,255,0,0,209,255,31,0,211,255,31,0,212,255,20,0,221,255,170,0,222,255,
+170,0,223,255,170,0,224,255,170,0,226,255,170,0,227,255,170,0,229,255,170,
+0,230,255,170,0,231,255,170,0,232,255,170,0,235,255,170,0,253,255,123,1,10,
+255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,
+113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,
+165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,
+129,1,244,255,63,2,15,255,92,2,19,255,170,2,20,255,170,2,21,255,170,2,22,
+255,170,2,27,255,150,2,29,255,31,2,34,255,84,2,36,255,84,0,1,0,40,255,174,
+0,8,0,11,255,51,0,12,255,51,0,13,255,51,0,14,255,51,0,15,255,51,0,16,255,
+51,0,17,255,51,0,18,255,51,0,15,0,84,255,193,0,120,255,170,0,147,255,215,
+0,220,255,190,0,225,255,193,0,233,255,190,0,234,255,190,1,57,255,195,1,61,
+255,195,1,176,255,215,1,213,255,147,1,234,255,174,1,235,255,195,2,23,255,
+174,2,24,255,150,0,1,0,40,255,150,0,46,0,14,255,215,0,32,255,106,0,41,255,
+86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,
+133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,
+0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,
+213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,
+84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,
+170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,
+172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,
+92,2,27,255,150,2,34,255,84,2,36,255,84,0,1,0,147,255,147,0,1,0,40,255,129,
+0,47,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,
+106,0,86,255,82,0,94,255,133,0,104,255,213,0,113,255,109,0,120,254,213,0,
+128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,
+0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,
+255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,
+255,84,1,51,255,113,1,59,254,129,1,63,255,193,1,157,254,252,1,158,255,104,
+1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,
+255,0,1,219,255,188,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,
+34,255,84,2,36,255,84,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,
+92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,
+254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,
+0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,
+20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,
+84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,
+255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,
+1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,
+84,2,36,255,84,0,1,0,84,255,84,0,11,0,6,255,133,0,7,255,133,0,8,255,133,0,
+84,255,84,0,123,255,133,0,124,255,133,0,125,255,133,0,127,255,133,0,130,255,
+133,0,131,255,133,0,134,255,133,0,4,0,6,255,113,0,7,255,113,0,8,255,113,0,
+84,255,84,0,60,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,
+129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,
+255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,
+0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,221,255,
+129,0,222,255,129,0,223,255,129,0,224,255,129,0,226,255,129,0,227,255,129,
+0,229,255,129,0,230,255,129,0,231,255,129,0,232,255,129,0,235,255,129,0,253,
+255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,
+255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,
+1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,
+255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,19,255,129,2,20,255,129,2,
+21,255,129,2,22,255,129,2,27,255,150,2,34,255,84,2,36,255,84,0,45,0,14,255,
+154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,
+20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,
+146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,
+150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,
+255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,
+254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,
+1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,
+63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,45,0,14,255,154,0,41,
+255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,
+255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,
+195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,
+254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,
+14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,
+63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,
+84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,
+255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,4,0,6,255,174,0,7,255,174,0,
+8,255,174,0,84,255,84,0,17,0,6,255,174,0,7,255,174,0,8,255,174,0,84,255,84,
+0,115,255,170,0,116,255,170,0,117,255,170,0,119,255,170,0,202,255,109,0,205,
+255,109,0,206,255,109,0,207,255,109,0,208,255,109,0,209,255,109,0,211,255,
+109,0,212,255,109,2,29,255,109,0,11,0,6,255,174,0,7,255,174,0,8,255,174,0,
+84,255,84,0,115,255,174,0,116,255,174,0,117,255,174,0,119,255,174,0,143,255,
+106,0,144,255,106,0,145,255,106,0,69,0,14,255,154,0,27,255,129,0,41,255,86,
+0,54,255,92,0,62,255,92,0,67,255,0,0,68,255,0,0,69,255,0,0,71,255,0,0,72,
+255,0,0,73,255,0,0,74,255,0,0,75,255,0,0,78,255,0,0,79,255,0,0,80,255,0,0,
+81,255,0,0,83,255,0,0,84,254,129,0,85,255,106,0,86,255,20,0,87,255,0,0,90,
+255,0,0,94,255,133,0,104,255,213,0,115,254,246,0,116,254,246,0,117,254,246,
+0,119,254,246,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,
+255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,
+0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,
+1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,
+1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,
+255,86,1,178,255,106,1,180,255,0,1,229,255,0,1,230,255,0,1,231,255,0,1,233,
+255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,
+255,84,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,
+0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,
+51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,
+255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,
+1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,
+51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,
+84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,
+255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,45,
+0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,
+0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,
+215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,
+254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,
+1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,
+1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,
+255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,
+1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,7,0,84,255,
+84,0,244,255,215,0,245,255,215,0,246,255,215,0,248,255,215,0,252,255,215,
+0,255,255,215,0,1,0,84,255,84,0,7,0,84,255,84,0,244,255,215,0,245,255,215,
+0,246,255,215,0,248,255,215,0,252,255,215,0,255,255,215,0,93,0,14,255,154,
+0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,
+0,94,255,133,0,96,255,150,0,104,255,213,0,120,254,213,0,128,255,51,0,129,
+255,150,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,
+0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,221,255,
+150,0,222,255,150,0,223,255,150,0,224,255,150,0,226,255,150,0,227,255,150,
+0,229,255,150,0,230,255,150,0,231,255,150,0,232,255,150,0,235,255,150,0,244,
+255,92,0,245,255,92,0,246,255,92,0,248,255,92,0,252,255,92,0,253,255,123,
+0,255,255,92,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,
+1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,153,255,150,1,155,255,
+150,1,156,255,150,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,
+1,168,255,84,1,169,255,150,1,172,255,86,1,178,255,106,1,180,255,0,1,181,255,
+150,1,182,255,150,1,183,255,150,1,189,255,150,1,193,255,150,1,194,255,150,
+1,195,255,150,1,201,255,150,1,202,255,150,1,203,255,150,1,204,255,150,1,205,
+255,150,1,206,255,150,1,207,255,150,1,222,255,150,1,223,255,150,1,224,255,
+150,1,225,255,150,1,226,255,150,1,227,255,150,1,228,255,150,1,234,255,129,
+1,244,255,63,2,15,255,92,2,19,255,150,2,20,255,150,2,21,255,150,2,22,255,
+150,2,27,255,150,2,34,255,84,2,36,255,84,0,5,0,84,255,172,0,120,255,172,0,
+147,255,215,1,57,255,236,1,61,255,215,0,2,0,9,255,133,0,84,255,133,0,45,0,
+14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,
+0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,
+215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,
+254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,
+1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,
+1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,
+255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,
+1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,1,0,84,255,
+129,0,14,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,
+0,128,255,106,0,156,255,86,0,244,254,225,0,245,254,225,0,246,254,225,0,248,
+254,225,0,252,254,225,0,255,254,225,1,239,255,106,0,1,0,84,255,150,0,2,0,
+9,255,174,0,84,255,154,0,8,0,9,255,133,0,84,255,133,0,244,254,184,0,245,254,
+184,0,246,254,184,0,248,254,184,0,252,254,184,0,255,254,184,0,2,0,9,255,133,
+0,84,255,133,0,3,0,9,255,174,0,30,255,150,0,84,255,154,0,25,0,9,255,113,0,
+14,255,213,0,29,255,66,0,30,255,66,0,31,255,66,0,32,255,66,0,33,255,66,0,
+34,255,66,0,37,255,66,0,38,255,66,0,39,255,66,0,54,255,215,0,62,255,195,0,
+84,255,20,0,120,254,213,0,128,255,106,0,156,255,86,0,185,255,66,0,186,255,
+66,0,187,255,66,0,189,255,66,1,163,255,66,1,164,255,66,1,165,255,66,1,239,
+255,106,0,2,0,9,255,133,0,84,255,133,0,2,0,9,255,174,0,84,255,154,0,2,0,9,
+255,133,0,84,255,133,0,46,0,14,255,154,0,30,254,236,0,41,255,86,0,54,255,
+92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,
+213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,
+156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,
+0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,
+84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,
+252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,
+178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,
+2,34,255,84,2,36,255,84,0,20,0,84,255,215,0,249,255,174,0,250,255,174,0,251,
+255,174,1,0,255,174,1,1,255,174,1,2,255,174,1,4,255,174,1,5,255,174,1,6,255,
+174,1,160,255,174,1,197,255,174,1,198,255,174,1,200,255,174,1,250,255,174,
+1,251,255,174,1,252,255,174,1,254,255,174,1,255,255,174,2,0,255,174,0,9,0,
+9,255,129,0,30,255,109,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,
+0,128,255,106,0,156,255,86,1,239,255,106,0,2,0,9,255,174,0,84,255,154,0,2,
+0,9,255,133,0,84,255,133,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,
+92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,
+254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,
+0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,
+20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,
+84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,
+255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,
+1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,
+84,2,36,255,84,0,10,0,9,255,129,0,14,255,233,0,30,255,109,0,54,255,215,0,
+62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,0,156,255,86,1,239,255,
+106,0,1,0,84,255,193,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,
+0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,
+213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,
+162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,
+20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,
+84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,
+255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,
+1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,
+84,2,36,255,84,0,10,0,9,255,129,0,14,255,213,0,30,255,109,0,54,255,215,0,
+62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,0,156,255,86,1,239,255,
+106,0,46,0,14,255,154,0,30,255,109,0,41,255,86,0,54,255,92,0,62,255,92,0,
+84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,
+213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,
+162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,
+20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,
+84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,
+255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,
+1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,
+84,2,36,255,84,0,9,0,9,255,129,0,30,255,109,0,54,255,215,0,62,255,195,0,84,
+255,20,0,120,254,213,0,128,255,106,0,156,255,86,1,239,255,106,0,1,0,84,255,
+129,0,2,0,40,255,193,0,84,255,170,0,2,0,40,255,172,0,84,255,88,0,58,0,4,255,
+113,0,5,255,113,0,10,255,113,0,14,255,154,0,35,255,113,0,36,255,113,0,41,
+255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,
+255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,
+195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,
+254,213,0,208,255,0,0,212,255,20,0,213,255,43,0,214,255,43,0,215,255,43,0,
+217,255,43,0,219,255,43,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,
+1,18,255,84,1,20,255,84,1,22,255,84,1,41,255,43,1,42,255,43,1,43,255,43,1,
+51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,
+84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,
+255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,46,
+0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,73,255,193,0,84,254,129,
+0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,
+51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,
+255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,
+1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,
+51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,
+84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,
+255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,45,
+0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,
+0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,
+215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,
+254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,
+1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,
+1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,
+255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,
+1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,9,0,9,255,
+129,0,54,255,215,0,62,255,195,0,71,255,20,0,84,255,20,0,120,254,213,0,128,
+255,106,0,156,255,86,1,239,255,106,0,21,0,67,255,193,0,68,255,193,0,69,255,
+193,0,71,255,193,0,72,255,193,0,73,255,193,0,74,255,193,0,75,255,193,0,78,
+255,193,0,79,255,193,0,80,255,193,0,81,255,193,0,83,255,193,0,85,255,193,
+0,86,255,193,0,87,255,193,0,90,255,193,1,229,255,193,1,230,255,193,1,231,
+255,193,1,233,255,193,0,46,0,14,255,43,0,41,255,86,0,54,255,92,0,62,255,92,
+0,71,255,0,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,
+0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,
+255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,
+0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,
+1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,
+252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,
+178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,
+2,34,255,84,2,36,255,84,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,
+92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,
+254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,
+0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,
+20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,
+84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,
+255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,
+1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,
+84,2,36,255,84,0,46,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,71,
+255,0,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,
+120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,
+127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,
+255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,
+255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,
+158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,
+106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,
+255,84,2,36,255,84,0,19,0,6,255,195,0,7,255,195,0,8,255,195,0,29,255,193,
+0,30,255,193,0,31,255,193,0,32,255,193,0,33,255,193,0,34,255,193,0,37,255,
+193,0,38,255,193,0,39,255,193,0,185,255,193,0,186,255,193,0,187,255,193,0,
+189,255,193,1,163,255,193,1,164,255,193,1,165,255,193,0,9,0,9,255,129,0,54,
+255,215,0,62,255,195,0,71,255,63,0,84,255,20,0,120,254,213,0,128,255,106,
+0,156,255,86,1,239,255,106,0,6,0,6,255,174,0,7,255,174,0,8,255,174,0,143,
+255,106,0,144,255,106,0,145,255,106,0,80,0,12,255,215,0,14,255,154,0,41,255,
+86,0,54,255,92,0,62,255,92,0,67,254,236,0,68,254,236,0,69,254,236,0,71,254,
+236,0,72,254,236,0,73,254,236,0,74,254,236,0,75,254,236,0,78,254,236,0,79,
+254,236,0,80,254,236,0,81,254,236,0,83,254,236,0,84,254,129,0,85,255,106,
+0,86,255,20,0,87,254,236,0,90,254,236,0,94,255,133,0,104,255,213,0,120,254,
+213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,
+162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,
+20,0,221,255,170,0,222,255,170,0,223,255,170,0,224,255,170,0,226,255,170,
+0,227,255,170,0,229,255,170,0,230,255,170,0,231,255,170,0,232,255,170,0,235,
+255,170,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,
+255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,
+158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,
+106,1,180,255,0,1,229,254,236,1,230,254,236,1,231,254,236,1,233,254,236,1,
+234,255,129,1,244,255,63,2,15,255,92,2,19,255,170,2,20,255,170,2,21,255,170,
+2,22,255,170,2,27,255,150,2,34,255,84,2,36,255,84,0,1,0,84,255,215,0,18,0,
+9,255,133,0,84,255,133,1,23,255,195,1,24,255,195,1,25,255,195,1,26,255,195,
+1,27,255,195,1,28,255,195,1,29,255,195,1,30,255,195,1,31,255,195,1,32,255,
+195,1,33,255,195,1,34,255,195,1,35,255,195,1,36,255,195,1,37,255,195,1,38,
+255,195,0,60,0,14,255,154,0,29,255,106,0,30,255,106,0,31,255,106,0,32,255,
+106,0,33,255,106,0,34,255,106,0,37,255,106,0,38,255,106,0,39,255,106,0,41,
+255,86,0,54,255,92,0,62,255,92,0,84,255,0,0,85,255,106,0,86,255,20,0,94,255,
+133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,
+0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,
+213,0,185,255,106,0,186,255,106,0,187,255,106,0,189,255,106,0,208,255,0,0,
+212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,
+1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,
+252,1,158,255,104,1,160,255,84,1,163,255,106,1,164,255,106,1,165,255,119,
+1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,
+63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,4,0,9,255,133,0,84,
+255,43,0,120,255,23,1,157,255,150,0,1,0,84,255,170,0,17,0,11,255,154,0,12,
+255,154,0,13,255,154,0,14,255,154,0,15,255,154,0,16,255,154,0,17,255,154,
+0,18,255,154,0,19,255,66,0,20,255,66,0,21,255,66,0,22,255,66,0,23,255,66,
+0,24,255,66,0,25,255,66,0,26,255,66,2,22,255,172,0,51,0,14,255,154,0,41,255,
+86,0,54,255,92,0,62,255,92,0,84,255,0,0,85,255,106,0,86,255,20,0,94,255,133,
+0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,143,255,41,0,144,
+255,41,0,145,255,41,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,127,
+0,169,255,86,0,172,254,150,0,174,254,213,0,192,255,63,0,193,255,63,0,194,
+255,63,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,
+255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,255,20,1,63,
+255,150,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,
+84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,63,1,244,255,63,2,15,
+255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,4,0,9,255,154,0,84,255,170,
+1,176,255,215,1,214,0,63,0,3,0,9,255,154,0,14,0,41,0,30,255,106,0,2,0,9,255,
+133,0,84,255,133,0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,
+120,254,213,0,128,255,106,0,156,255,86,1,239,255,106,0,1,0,9,255,174,0,1,
+0,40,255,63,0,1,0,40,255,172,0,2,0,14,255,170,0,40,255,170,0,32,0,12,255,
+31,0,19,254,233,0,20,254,233,0,21,254,233,0,22,254,233,0,23,254,233,0,24,
+254,233,0,25,254,233,0,26,254,233,0,40,255,43,0,43,255,0,0,45,255,0,0,46,
+255,0,0,47,255,0,1,23,255,174,1,24,255,174,1,25,255,174,1,26,255,174,1,27,
+255,174,1,28,255,174,1,29,255,174,1,30,255,174,1,31,255,174,1,32,255,174,
+1,33,255,174,1,34,255,174,1,35,255,174,1,36,255,174,1,37,255,174,1,38,255,
+174,1,47,255,23,1,62,255,0,0,1,0,40,255,150,0,8,0,11,255,154,0,12,255,154,
+0,13,255,154,0,14,255,154,0,15,255,154,0,16,255,154,0,17,255,154,0,18,255,
+31,0,1,0,9,255,43,0,2,0,40,255,106,0,70,255,193,0,1,0,84,255,147,0,14,0,6,
+255,174,0,7,255,174,0,8,255,174,0,9,255,174,0,11,255,195,0,12,255,195,0,13,
+255,195,0,14,255,195,0,15,255,195,0,16,255,195,0,17,255,195,0,18,255,195,
+0,84,255,154,1,47,255,172,0,1,0,40,255,150,0,1,0,40,255,127,0,2,0,9,255,174,
+0,84,255,154,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,
+129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,
+255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,
+0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,
+123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,
+84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,
+255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,
+1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,
+84,0,1,0,40,255,150,0,17,0,9,255,133,0,13,255,150,0,19,255,174,0,20,255,174,
+0,21,255,174,0,22,255,174,0,23,255,174,0,24,255,174,0,25,255,174,0,26,255,
+174,0,43,255,211,0,45,255,211,0,46,255,211,0,47,255,211,0,84,255,133,1,47,
+255,150,1,62,255,211,0,2,0,9,255,133,0,84,255,133,0,57,0,7,255,236,0,9,255,
+133,0,11,255,92,0,12,255,133,0,13,255,92,0,14,255,92,0,15,255,92,0,16,255,
+92,0,17,255,92,0,18,255,92,0,19,255,106,0,20,255,106,0,21,255,106,0,22,255,
+106,0,23,255,106,0,24,255,106,0,25,255,106,0,26,255,106,0,43,255,106,0,45,
+255,106,0,46,255,106,0,47,255,106,0,84,255,133,0,205,255,193,0,244,255,213,
+0,245,255,213,0,246,255,213,0,248,255,213,0,249,0,43,0,250,0,43,0,251,0,43,
+0,252,255,213,0,255,255,213,1,0,0,43,1,1,0,43,1,2,0,43,1,4,0,43,1,5,0,43,
+1,6,0,43,1,46,255,86,1,47,255,86,1,48,255,86,1,50,255,86,1,62,255,106,1,64,
+255,86,1,160,0,43,1,170,255,86,1,171,255,86,1,197,0,43,1,198,0,43,1,200,0,
+43,1,250,0,43,1,251,0,43,1,252,0,43,1,254,0,43,1,255,0,43,2,0,0,43,0,2,0,
+9,255,133,0,84,255,133,0,18,0,9,255,133,0,29,255,150,0,30,255,150,0,31,255,
+150,0,32,255,150,0,33,255,150,0,34,255,150,0,37,255,150,0,38,255,150,0,39,
+255,150,0,84,255,133,0,185,255,150,0,186,255,150,0,187,255,150,0,189,255,
+150,1,163,255,150,1,164,255,150,1,165,255,150,0,8,0,9,255,129,0,54,255,215,
+0,62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,0,156,255,86,1,239,255,
+106,0,2,0,9,255,133,0,84,255,133,0,1,0,84,255,84,0,1,0,84,255,106,0,2,0,9,
+255,133,0,84,255,133,0,2,0,9,255,133,0,84,255,133,0,3,0,9,255,133,0,84,255,
+133,1,47,255,193,0,5,0,6,255,174,0,7,255,174,0,8,255,174,0,9,255,133,0,84,
+255,133,0,3,0,9,255,174,0,12,255,195,0,84,255,154,0,1,0,40,255,193,0,5,0,
+6,255,195,0,7,255,195,0,8,255,195,0,9,255,174,0,84,255,154,0,10,0,9,255,133,
+0,19,255,193,0,20,255,193,0,21,255,193,0,22,255,193,0,23,255,193,0,24,255,
+193,0,25,255,193,0,26,255,193,0,84,255,133,0,38,0,4,255,195,0,5,255,195,0,
+6,255,113,0,7,255,113,0,8,255,113,0,10,255,195,0,29,255,127,0,30,255,127,
+0,31,255,127,0,32,255,127,0,33,255,127,0,34,255,127,0,35,255,195,0,36,255,
+195,0,37,255,127,0,38,255,127,0,39,255,127,0,143,255,20,0,144,255,20,0,145,
+255,20,0,174,254,236,0,185,255,127,0,186,255,127,0,187,255,127,0,189,255,
+127,0,208,255,84,1,10,255,193,1,12,255,195,1,14,255,195,1,18,255,195,1,20,
+255,195,1,22,255,195,1,157,255,154,1,163,255,127,1,164,255,127,1,165,255,
+127,2,34,255,195,2,36,255,195,0,1,0,9,255,154,0,3,0,9,255,154,0,71,255,127,
+0,84,255,129,0,4,0,6,255,215,0,7,255,215,0,8,255,215,1,47,255,190,0,8,0,19,
+254,106,0,20,254,106,0,21,254,106,0,22,254,106,0,23,254,106,0,24,254,106,
+0,25,254,106,0,26,254,106,0,2,0,9,255,133,0,84,255,133,0,18,0,9,255,133,0,
+29,255,172,0,30,255,172,0,31,255,172,0,32,255,172,0,33,255,172,0,34,255,172,
+0,37,255,172,0,38,255,172,0,39,255,172,0,84,255,133,0,185,255,172,0,186,255,
+172,0,187,255,172,0,189,255,172,1,163,255,172,1,164,255,172,1,165,255,172,
+0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,128,
+255,106,0,156,255,86,1,239,255,106,0,18,0,9,255,133,0,29,255,170,0,30,255,
+170,0,31,255,170,0,32,255,170,0,33,255,170,0,34,255,170,0,37,255,170,0,38,
+255,170,0,39,255,170,0,84,255,133,0,185,255,170,0,186,255,170,0,187,255,170,
+0,189,255,170,1,163,255,170,1,164,255,170,1,165,255,170,0,2,0,9,255,133,0,
+84,255,133,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,
+129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,
+255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,
+0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,
+123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,
+84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,
+255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,
+1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,
+84,0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,
+128,255,106,0,156,255,86,1,239,255,106,0,1,0,40,255,170,0,1,0,40,255,133,
+0,10,0,9,255,133,0,19,255,129,0,20,255,129,0,21,255,129,0,22,255,129,0,23,
+255,129,0,24,255,129,0,25,255,129,0,26,255,129,0,84,255,133,0,2,0,40,255,
+174,0,84,255,193,0,22,0,11,255,51,0,12,255,51,0,13,255,51,0,14,255,51,0,15,
+255,51,0,16,255,51,0,17,255,51,0,18,255,51,0,51,255,174,0,52,255,174,0,53,
+255,174,0,54,255,174,0,55,255,174,0,56,255,174,0,57,255,174,0,58,255,174,
+2,13,255,174,2,14,255,174,2,15,255,174,2,16,255,174,2,17,255,174,2,18,255,
+174,0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,
+128,255,106,0,156,255,86,1,239,255,106,0,45,0,14,255,154,0,41,255,86,0,54,
+255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,
+255,213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,
+0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,
+255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,
+255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,
+254,252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,
+1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,
+150,2,34,255,84,2,36,255,84,0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,
+255,20,0,120,254,213,0,128,255,106,0,156,255,86,1,239,255,106,0,5,0,6,255,
+174,0,7,255,174,0,8,255,174,0,9,255,133,0,84,255,133,0,2,0,9,255,133,0,84,
+255,133,0,15,0,84,255,147,0,213,255,215,0,214,255,215,0,215,255,215,0,217,
+255,215,0,219,255,215,0,244,255,174,0,245,255,174,0,246,255,174,0,248,255,
+174,0,252,255,174,0,255,255,174,1,41,255,215,1,42,255,215,1,43,255,215,0,
+1,0,84,255,150,0,1,0,84,255,150,0,1,0,84,255,147,0,1,0,84,255,172,0,40,0,
+19,255,231,0,20,255,231,0,21,255,231,0,22,255,231,0,23,255,231,0,24,255,231,
+0,25,255,231,0,26,255,231,0,83,255,193,0,84,255,147,0,123,255,127,0,124,255,
+127,0,125,255,127,0,127,255,127,0,130,255,127,0,131,255,127,0,134,255,127,
+0,135,255,63,0,136,255,63,0,137,255,63,0,143,254,213,0,144,254,213,0,145,
+254,213,0,202,255,106,0,205,255,106,0,206,255,106,0,207,255,106,0,208,255,
+106,0,209,255,106,0,211,255,106,0,212,255,106,0,213,255,193,0,214,255,193,
+0,215,255,193,0,217,255,193,0,219,255,193,1,41,255,193,1,42,255,193,1,43,
+255,193,2,29,255,106,0,73,0,29,255,170,0,30,255,170,0,31,255,170,0,32,255,
+170,0,33,255,170,0,34,255,170,0,37,255,170,0,38,255,170,0,39,255,170,0,84,
+255,147,0,107,255,150,0,108,255,150,0,109,255,150,0,111,255,150,0,112,255,
+150,0,113,255,150,0,115,255,174,0,116,255,174,0,117,255,174,0,119,255,174,
+0,123,255,127,0,124,255,127,0,125,255,127,0,127,255,127,0,130,255,127,0,131,
+255,127,0,134,255,127,0,135,255,92,0,136,255,92,0,137,255,92,0,185,255,170,
+0,186,255,170,0,187,255,170,0,189,255,170,0,202,255,127,0,205,255,127,0,206,
+255,127,0,207,255,127,0,208,255,127,0,209,255,127,0,211,255,127,0,212,255,
+127,0,213,255,195,0,214,255,195,0,215,255,195,0,217,255,195,0,219,255,195,
+0,249,255,172,0,250,255,172,0,251,255,172,1,0,255,172,1,1,255,172,1,2,255,
+172,1,4,255,172,1,5,255,172,1,6,255,172,1,41,255,195,1,42,255,195,1,43,255,
+195,1,160,255,172,1,163,255,170,1,164,255,170,1,165,255,170,1,197,255,172,
+1,198,255,172,1,200,255,172,1,250,255,172,1,251,255,172,1,252,255,172,1,254,
+255,172,1,255,255,172,2,0,255,172,2,29,255,127,0,2,0,9,255,133,0,84,255,133,
+0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,
+106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,
+255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,
+0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,
+84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,
+1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,
+255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,
+1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,8,0,9,255,
+129,0,54,255,195,0,62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,0,156,
+255,86,1,239,255,106,0,34,0,6,255,113,0,7,255,113,0,8,255,113,0,9,255,51,
+0,29,255,84,0,30,255,84,0,31,255,84,0,32,255,84,0,33,255,84,0,34,255,84,0,
+37,255,84,0,38,255,84,0,39,255,84,0,84,255,154,0,107,255,150,0,108,255,150,
+0,109,255,150,0,111,255,150,0,112,255,150,0,113,255,150,0,185,255,84,0,186,
+255,84,0,187,255,84,0,189,255,84,1,163,255,84,1,164,255,84,1,165,255,84,1,
+243,255,51,1,244,255,51,1,245,255,51,1,246,255,51,1,247,255,51,1,248,255,
+51,1,249,255,51,0,22,0,9,255,133,0,83,255,170,0,84,255,133,0,107,255,193,
+0,108,255,193,0,109,255,193,0,111,255,193,0,112,255,193,0,113,255,193,0,244,
+255,86,0,245,255,86,0,246,255,86,0,248,255,86,0,252,255,86,0,255,255,86,1,
+243,255,72,1,244,255,72,1,245,255,72,1,246,255,72,1,247,255,72,1,248,255,
+72,1,249,255,72,0,51,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,
+254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,
+0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,
+255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,
+253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,
+22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,
+104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,
+180,255,0,1,234,255,129,1,243,254,225,1,244,255,63,1,245,254,225,1,246,254,
+225,1,247,254,225,1,248,254,225,1,249,254,225,2,15,255,92,2,27,255,150,2,
+34,255,84,2,36,255,84,0,55,0,9,255,92,0,30,255,106,0,84,255,154,0,107,255,
+150,0,108,255,150,0,109,255,150,0,111,255,150,0,112,255,150,0,113,255,150,
+0,115,255,170,0,116,255,170,0,117,255,170,0,119,255,170,0,202,255,84,0,205,
+255,84,0,206,255,84,0,207,255,84,0,208,255,84,0,209,255,84,0,211,255,84,0,
+212,255,84,0,213,255,170,0,214,255,170,0,215,255,170,0,217,255,170,0,219,
+255,170,0,244,254,236,0,245,254,236,0,246,254,236,0,248,254,236,0,249,255,
+86,0,250,255,86,0,251,255,86,0,252,254,236,0,255,254,236,1,0,255,86,1,1,255,
+86,1,2,255,86,1,4,255,86,1,5,255,86,1,6,255,86,1,41,255,170,1,42,255,170,
+1,43,255,170,1,160,255,86,1,197,255,86,1,198,255,86,1,200,255,86,1,250,255,
+86,1,251,255,86,1,252,255,86,1,254,255,86,1,255,255,86,2,0,255,86,2,29,255,
+84,0,35,0,9,255,129,0,54,255,215,0,62,255,195,0,71,255,106,0,84,255,20,0,
+120,254,213,0,128,255,106,0,156,255,86,0,249,255,43,0,250,255,43,0,251,255,
+43,1,0,255,43,1,1,255,43,1,2,255,43,1,4,255,43,1,5,255,43,1,6,255,43,1,160,
+255,43,1,197,255,43,1,198,255,43,1,200,255,43,1,239,255,106,1,243,254,246,
+1,244,254,246,1,245,254,246,1,246,254,246,1,247,254,246,1,248,254,246,1,249,
+254,246,1,250,255,43,1,251,255,43,1,252,255,43,1,254,255,43,1,255,255,43,
+2,0,255,43,0,65,0,9,255,133,0,29,255,170,0,30,255,106,0,31,255,170,0,32,255,
+170,0,33,255,170,0,34,255,170,0,37,255,170,0,38,255,170,0,39,255,170,0,71,
+255,150,0,84,255,154,0,115,255,172,0,116,255,172,0,117,255,172,0,119,255,
+172,0,185,255,170,0,186,255,170,0,187,255,170,0,189,255,170,0,202,255,84,
+0,205,255,84,0,206,255,84,0,207,255,84,0,208,255,84,0,209,255,84,0,211,255,
+84,0,212,255,84,0,213,255,170,0,214,255,170,0,215,255,170,0,217,255,170,0,
+219,255,170,0,244,255,41,0,245,255,41,0,246,255,41,0,248,255,41,0,249,255,
+86,0,250,255,86,0,251,255,86,0,252,255,41,0,255,255,41,1,0,255,86,1,1,255,
+86,1,2,255,86,1,4,255,86,1,5,255,86,1,6,255,86,1,41,255,170,1,42,255,170,
+1,43,255,170,1,160,255,86,1,163,255,170,1,164,255,170,1,165,255,170,1,197,
+255,86,1,198,255,86,1,200,255,86,1,250,255,86,1,251,255,86,1,252,255,86,1,
+254,255,86,1,255,255,86,2,0,255,86,2,29,255,84,0,71,0,6,255,72,0,7,255,72,
+0,8,255,72,0,9,255,174,0,11,255,215,0,12,255,215,0,13,255,215,0,14,255,215,
+0,15,255,215,0,16,255,215,0,17,255,215,0,18,255,215,0,29,255,170,0,30,255,
+170,0,31,255,170,0,32,255,170,0,33,255,170,0,34,255,170,0,37,255,170,0,38,
+255,170,0,39,255,170,0,71,255,147,0,84,255,63,0,115,255,172,0,116,255,172,
+0,117,255,172,0,119,255,172,0,143,254,236,0,144,254,236,0,145,254,236,0,185,
+255,170,0,186,255,170,0,187,255,170,0,189,255,170,0,202,255,84,0,205,255,
+84,0,206,255,84,0,207,255,84,0,208,255,84,0,209,255,84,0,211,255,84,0,212,
+255,84,0,244,255,51,0,245,255,51,0,246,255,51,0,248,255,51,0,249,255,86,0,
+250,255,86,0,251,255,86,0,252,255,51,0,255,255,51,1,0,255,86,1,1,255,86,1,
+2,255,86,1,4,255,86,1,5,255,86,1,6,255,86,1,160,255,86,1,163,255,170,1,164,
+255,170,1,165,255,170,1,197,255,86,1,198,255,86,1,200,255,86,1,250,255,86,
+1,251,255,86,1,252,255,86,1,254,255,86,1,255,255,86,2,0,255,86,2,29,255,84,
+0,1,0,30,255,150,0,9,0,9,255,133,0,30,255,213,0,84,255,133,0,244,255,63,0,
+245,255,63,0,246,255,63,0,248,255,63,0,252,255,63,0,255,255,63,0,45,0,14,
+255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,
+255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,215,
+0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,254,
+150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,
+255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,
+254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,255,119,
+1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,1,244,255,
+63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,1,0,84,255,147,0,26,
+0,9,255,129,0,14,255,213,0,29,255,63,0,30,255,63,0,31,255,63,0,32,255,63,
+0,33,255,63,0,34,255,63,0,37,255,63,0,38,255,63,0,39,255,63,0,54,255,215,
+0,62,255,195,0,83,255,66,0,84,255,20,0,120,254,213,0,128,255,106,0,156,255,
+86,0,185,255,63,0,186,255,63,0,187,255,63,0,189,255,63,1,163,255,63,1,164,
+255,63,1,165,255,63,1,239,255,106,0,2,0,9,255,174,0,84,255,154,0,3,0,9,255,
+174,0,83,255,150,0,84,255,154,0,2,0,9,255,133,0,84,255,133,0,8,0,9,255,133,
+0,84,255,133,0,244,255,84,0,245,255,84,0,246,255,84,0,248,255,84,0,252,255,
+84,0,255,255,84,0,46,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,71,
+255,66,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,
+120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,
+127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,
+255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,
+255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,
+158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,
+106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,
+255,84,2,36,255,84,0,8,0,9,255,174,0,84,255,154,0,244,255,92,0,245,255,92,
+0,246,255,92,0,248,255,92,0,252,255,92,0,255,255,92,0,8,0,9,255,129,0,54,
+255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,0,156,255,86,
+1,239,255,106,0,8,0,9,255,174,0,84,255,154,0,244,255,92,0,245,255,92,0,246,
+255,92,0,248,255,92,0,252,255,92,0,255,255,92,0,9,0,9,255,174,0,12,255,195,
+0,84,255,154,0,244,255,92,0,245,255,92,0,246,255,92,0,248,255,92,0,252,255,
+92,0,255,255,92,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,
+254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,
+0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,
+255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,
+253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,
+22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,
+104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,
+180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,
+2,36,255,84,0,45,0,14,255,154,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,
+129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,
+255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,
+0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,
+123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,
+84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,
+255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,
+1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,
+84,0,4,0,84,255,84,0,143,255,86,0,144,255,86,0,145,255,86,0,4,0,6,255,113,
+0,7,255,113,0,8,255,113,0,84,255,170,0,23,0,6,255,154,0,7,255,154,0,8,255,
+154,0,29,255,150,0,30,255,150,0,31,255,150,0,32,255,150,0,33,255,150,0,34,
+255,150,0,37,255,150,0,38,255,150,0,39,255,150,0,84,255,106,0,143,255,63,
+0,144,255,63,0,145,255,63,0,185,255,150,0,186,255,150,0,187,255,150,0,189,
+255,150,1,163,255,150,1,164,255,150,1,165,255,150,0,2,0,9,255,133,0,84,255,
+133,0,45,0,14,255,213,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,
+85,255,106,0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,
+51,0,142,255,215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,
+255,86,0,172,254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,
+1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,
+51,255,113,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,
+84,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,
+255,129,1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,9,
+0,9,255,129,0,14,255,215,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,
+213,0,128,255,106,0,156,255,86,1,239,255,106,0,1,0,40,255,195,0,8,0,9,255,
+129,0,54,255,215,0,62,255,195,0,84,255,20,0,120,254,213,0,128,255,106,0,156,
+255,86,1,239,255,106,0,1,0,9,255,195,0,45,0,14,255,154,0,41,255,86,0,54,255,
+92,0,62,255,92,0,84,254,129,0,85,255,106,0,86,255,20,0,94,255,133,0,104,255,
+213,0,120,254,213,0,128,255,51,0,142,255,215,0,146,255,195,0,148,255,0,0,
+156,255,127,0,162,255,0,0,169,255,86,0,172,254,150,0,174,254,213,0,208,255,
+0,0,212,255,20,0,253,255,123,1,10,255,84,1,12,255,84,1,14,255,84,1,18,255,
+84,1,20,255,84,1,22,255,84,1,51,255,113,1,59,254,129,1,63,255,170,1,157,254,
+252,1,158,255,104,1,160,255,84,1,165,255,119,1,168,255,84,1,172,255,86,1,
+178,255,106,1,180,255,0,1,234,255,129,1,244,255,63,2,15,255,92,2,27,255,150,
+2,34,255,84,2,36,255,84,0,8,0,9,255,129,0,54,255,215,0,62,255,195,0,84,255,
+20,0,120,254,213,0,128,255,106,0,156,255,86,1,239,255,106,0,1,0,84,255,109,
+0,2,0,9,255,133,0,84,255,133,0,2,0,9,255,133,0,84,255,133,0,46,0,14,255,154,
+0,32,255,127,0,41,255,86,0,54,255,92,0,62,255,92,0,84,254,129,0,85,255,106,
+0,86,255,20,0,94,255,133,0,104,255,213,0,120,254,213,0,128,255,51,0,142,255,
+215,0,146,255,195,0,148,255,0,0,156,255,127,0,162,255,0,0,169,255,86,0,172,
+254,150,0,174,254,213,0,208,255,0,0,212,255,20,0,253,255,123,1,10,255,84,
+1,12,255,84,1,14,255,84,1,18,255,84,1,20,255,84,1,22,255,84,1,51,255,113,
+1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,165,
+255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,1,234,255,129,
+1,244,255,63,2,15,255,92,2,27,255,150,2,34,255,84,2,36,255,84,0,143,0,6,255,
+113,0,7,255,113,0,8,255,113,0,14,255,154,0,27,255,174,0,28,255,174,0,41,255,
+51,0,44,255,92,0,48,255,174,0,49,255,174,0,54,255,92,0,62,255,31,0,67,254,
+225,0,68,254,225,0,69,254,225,0,71,254,225,0,72,254,225,0,73,254,225,0,74,
+254,225,0,75,254,225,0,78,254,225,0,79,254,225,0,80,254,225,0,81,254,225,
+0,83,254,225,0,84,254,123,0,85,255,106,0,86,255,20,0,87,254,225,0,90,254,
+225,0,94,255,92,0,104,255,213,0,107,254,225,0,108,254,225,0,109,254,225,0,
+111,254,225,0,112,255,10,0,113,254,102,0,115,254,184,0,116,254,184,0,117,
+254,184,0,119,254,184,0,120,254,123,0,123,254,193,0,124,254,193,0,125,254,
+193,0,127,254,193,0,128,254,164,0,129,254,246,0,130,254,193,0,131,254,193,
+0,134,254,193,0,142,255,215,0,143,254,143,0,144,254,143,0,145,254,143,0,146,
+255,113,0,148,255,10,0,156,255,127,0,162,255,0,0,169,255,92,0,172,254,150,
+0,174,254,213,0,183,255,174,0,184,255,174,0,188,255,174,0,190,255,174,0,191,
+255,174,0,192,254,164,0,193,254,164,0,194,254,164,0,195,255,174,0,202,254,
+246,0,205,254,246,0,206,254,246,0,207,254,246,0,208,255,0,0,209,254,246,0,
+211,254,246,0,212,255,20,0,213,255,72,0,214,255,72,0,215,255,72,0,217,255,
+72,0,219,255,72,0,244,254,236,0,245,254,236,0,246,254,236,0,248,254,236,0,
+252,254,236,0,253,255,123,0,255,254,236,1,10,255,84,1,12,255,84,1,14,255,
+31,1,18,255,84,1,20,255,84,1,22,255,84,1,39,255,174,1,40,255,174,1,41,255,
+72,1,42,255,72,1,43,255,72,1,44,255,174,1,47,255,51,1,49,255,31,1,51,255,
+31,1,59,254,129,1,63,255,170,1,157,254,252,1,158,255,104,1,160,255,84,1,162,
+255,174,1,165,255,119,1,168,255,84,1,172,255,86,1,178,255,106,1,180,255,0,
+1,198,254,225,1,215,255,51,1,216,255,51,1,217,255,51,1,218,255,51,1,219,255,
+51,1,221,255,51,1,222,255,92,1,229,254,225,1,230,254,225,1,231,254,225,1,
+233,254,225,1,234,255,129,1,243,254,225,1,244,255,63,1,245,254,225,1,246,
+254,225,1,247,254,225,1,248,254,225,1,249,254,225,2,15,255,72,2,27,255,72,
+2,29,254,246,2,34,254,246,2,36,254,246,0,69,0,6,255,92,0,7,255,92,0,8,255,
+92,0,9,255,10,0,40,255,215,0,41,255,92,0,54,255,215,0,62,255,195,0,84,255,
+20,0,120,254,213,0,123,254,225,0,124,254,225,0,125,254,225,0,127,254,225,
+0,128,255,106,0,130,254,225,0,131,254,225,0,134,254,225,0,135,254,246,0,136,
+254,246,0,137,254,246,0,143,254,246,0,144,254,246,0,145,254,246,0,156,255,
+86,0,162,255,51,0,166,255,174,0,167,255,195,0,168,255,133,0,169,255,133,0,
+202,254,205,0,205,254,205,0,206,254,205,0,207,254,205,0,208,254,205,0,209,
+254,205,0,211,254,205,0,212,254,205,0,213,255,51,0,214,255,51,0,215,255,51,
+0,217,255,51,0,219,255,51,0,244,254,236,0,245,254,236,0,246,254,236,0,248,
+254,236,0,252,254,236,0,255,254,236,1,41,255,51,1,42,255,51,1,43,255,51,1,
+54,255,10,1,55,255,10,1,56,255,10,1,58,255,10,1,59,255,10,1,174,255,10,1,
+175,255,10,1,177,255,10,1,239,255,106,1,243,254,164,1,244,254,164,1,245,254,
+164,1,246,254,164,1,247,254,164,1,248,254,164,1,249,254,164,2,29,254,205,
+0,2,133,168,0,4,0,0,133,178,138,8,0,171,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,195,255,215,255,195,255,133,255,195,255,215,255,113,255,195,0,0,
+0,0,0,0,255,215,0,0,0,0,0,0,0,0,255,215,255,31,0,0,0,0,255,72,0,0,0,0,255,
+154,255,72,255,113,255,154,255,174,255,195,255,92,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,255,195,0,0,0,0,255,
+154,0,0,0,0,0,0,0,0,255,195,255,174,0,0,255,174,0,0,0,0,0,0,0,0,255,174,255,
+195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,215,0,0,255,174,255,154,255,195,0,0,0,0,0,0,0,0,0,
+0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,255,72,0,0,255,195,0,0,0,0,0,0,255,72,255,
+51,255,51,255,170,0,0,255,174,255,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,154,255,195,0,0,0,0,255,106,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,106,0,0,0,0,255,66,0,0,0,0,255,92,255,106,
+0,0,255,195,0,0,255,190,255,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,195,255,72,255,154,0,0,0,0,0,0,255,174,0,0,0,0,255,92,
+255,72,255,174,254,143,0,0,255,113,0,0,255,154,0,0,255,31,0,0,255,154,254,
+246,255,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,133,0,0,0,0,255,174,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,174,255,174,0,0,254,225,254,246,0,0,255,113,255,195,0,0,255,127,0,0,
+255,113,255,10,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,86,0,0,0,0,255,127,0,0,0,
+0,255,127,0,0,255,66,255,147,255,193,254,231,0,0,255,127,255,84,255,129,255,
+215,255,43,0,0,255,127,0,0,255,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,255,
+154,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,190,255,92,
+255,133,0,0,255,66,0,0,255,127,255,86,255,41,254,215,255,43,255,63,254,150,
+0,0,255,84,0,0,255,129,0,0,255,0,0,0,255,129,0,0,255,20,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,195,255,72,0,0,255,20,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,255,133,254,172,255,20,0,0,0,0,0,0,0,0,254,213,254,205,254,86,254,
+233,255,250,254,2,254,150,254,213,255,20,255,20,0,0,255,0,0,0,255,86,0,0,
+254,152,0,0,0,0,255,215,0,0,0,0,0,0,0,0,255,150,255,106,0,0,255,0,255,4,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,133,255,20,255,106,0,0,0,0,0,0,255,
+104,255,0,255,20,254,170,255,61,255,147,254,63,0,0,255,43,255,63,255,66,255,
+170,254,233,0,0,255,86,254,236,255,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,0,255,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,170,0,
+0,0,0,255,129,0,0,0,0,0,0,0,0,255,170,255,150,255,170,255,106,255,113,255,
+174,255,154,255,193,0,0,255,150,0,0,255,84,255,147,255,213,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+213,0,0,0,0,255,195,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,
+0,255,211,255,150,0,0,0,0,255,129,0,0,0,0,255,174,255,170,255,172,255,215,
+255,195,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,0,255,106,255,109,255,
+170,0,0,255,193,0,0,0,0,0,0,0,0,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+127,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,
+0,0,255,170,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,255,
+170,0,0,255,195,255,150,0,0,0,0,255,174,255,154,255,150,255,195,0,0,0,0,255,
+150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,106,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,0,
+0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,172,0,0,0,0,255,133,0,0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,195,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,255,195,0,
+0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,255,129,0,0,255,174,0,0,0,0,0,0,0,0,0,0,
+255,92,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,133,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,150,255,106,0,0,255,127,255,190,0,0,255,129,0,0,255,129,255,170,
+255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,255,154,0,0,0,0,255,154,255,131,
+255,154,255,129,0,0,255,43,255,106,0,0,255,113,255,211,0,0,255,127,0,0,0,
+0,255,63,255,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,41,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,
+0,255,150,0,0,0,0,255,174,255,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,133,255,133,0,0,255,174,0,0,0,0,255,195,0,0,0,0,255,174,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,150,255,129,0,0,
+0,0,0,0,0,0,255,193,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,170,0,0,0,0,0,0,0,0,255,195,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,106,255,129,
+0,0,254,170,0,0,0,0,255,195,0,0,0,0,255,195,0,0,0,0,255,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,86,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,174,0,0,255,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,215,0,0,255,193,0,0,0,0,0,0,255,174,0,0,255,195,0,0,0,0,0,0,0,0,
+255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,255,170,255,215,0,0,0,0,
+0,0,0,0,255,195,255,150,0,0,0,0,0,0,0,0,255,150,0,0,255,215,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,154,0,0,
+0,0,255,170,0,0,0,0,0,0,0,0,255,84,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,133,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,215,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,133,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,174,0,0,0,0,0,0,0,0,0,0,255,154,255,195,255,150,0,0,0,0,255,195,255,
+150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,0,0,0,0,
+0,0,0,0,0,255,154,255,154,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,255,154,0,0,0,0,255,
+215,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,133,255,174,0,0,0,
+0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,255,
+154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,129,0,0,0,0,255,170,0,0,0,
+0,255,133,255,86,255,63,0,0,0,0,0,0,255,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,127,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,127,0,0,0,0,255,133,255,86,255,
+84,0,0,0,0,255,213,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,
+0,255,215,0,0,255,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,255,109,0,0,255,154,0,0,0,0,255,
+154,0,0,0,0,255,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,255,170,255,195,255,195,0,
+0,255,154,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,109,0,0,255,193,
+0,0,0,0,0,0,255,154,255,174,255,150,0,0,0,0,255,193,255,154,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,133,0,0,0,0,255,0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,
+0,0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,255,215,255,195,0,0,0,0,0,0,0,0,255,
+170,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,
+0,0,0,255,170,0,0,0,0,255,133,255,63,255,106,0,0,0,0,0,0,255,86,0,0,255,195,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,255,
+172,0,0,0,0,255,174,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+150,0,0,0,0,255,154,255,127,255,106,0,0,0,0,0,0,255,129,0,0,255,174,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,170,0,0,0,0,255,190,255,195,0,0,0,0,0,0,0,0,0,0,0,0,
+255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,172,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,172,0,
+0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,172,0,0,0,0,
+255,127,0,0,0,0,255,92,255,129,255,133,0,0,0,0,0,0,255,106,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,127,0,0,0,0,0,0,0,0,0,0,255,133,255,106,255,86,0,0,0,0,255,133,255,
+66,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,195,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,
+0,0,0,0,0,0,0,0,0,0,255,113,255,127,255,129,0,0,0,0,0,0,255,86,0,0,255,174,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,154,0,0,255,127,0,0,0,0,0,0,255,174,0,0,255,174,0,0,255,
+172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,133,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,0,0,0,0,0,0,255,174,0,0,255,190,0,0,0,
+0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,255,215,255,195,0,0,
+0,0,0,0,0,0,0,0,0,0,255,213,0,0,0,0,0,0,255,174,255,215,255,215,0,0,255,195,
+0,0,255,174,255,195,255,195,0,0,255,215,0,0,255,174,0,0,255,174,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,255,92,0,0,0,0,0,0,0,0,255,129,
+0,0,0,0,255,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,92,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,0,0,0,0,0,0,
+255,154,255,154,255,170,0,0,0,0,0,0,0,0,0,0,255,154,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,0,0,0,0,0,0,255,193,0,0,255,
+133,255,127,0,0,255,84,0,0,0,0,0,0,255,170,0,0,255,63,0,0,255,172,255,150,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,168,0,0,0,0,255,150,0,0,0,0,255,113,255,41,255,127,0,0,
+0,0,0,0,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,113,255,172,255,86,255,195,0,0,0,0,255,170,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,211,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,255,147,0,0,0,0,255,195,0,0,255,170,0,0,0,0,0,0,255,
+172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,255,174,0,0,0,0,255,174,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,174,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,255,193,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,150,0,0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,154,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,195,0,0,0,0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+129,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,113,0,0,255,133,0,
+0,0,0,255,106,0,0,255,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,255,172,0,0,0,
+0,255,154,255,106,0,0,0,0,0,0,0,0,255,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,129,0,0,0,0,0,0,0,0,255,150,0,0,0,0,255,215,255,51,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,215,0,0,255,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,255,150,0,0,0,0,
+0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,41,0,0,0,0,255,
+129,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,147,0,0,0,0,255,
+195,0,0,255,129,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,215,255,127,255,174,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,150,0,0,0,0,255,106,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+215,0,0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,
+0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,106,0,0,0,0,0,0,0,0,
+0,0,255,133,255,113,255,127,255,113,0,0,255,195,255,127,0,0,255,154,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,255,195,0,
+0,255,106,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,84,0,0,0,0,
+255,86,0,0,0,0,255,195,0,0,255,106,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,215,0,0,0,
+0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,255,174,0,0,0,0,255,150,
+0,0,0,0,0,0,255,150,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,255,170,255,133,
+0,0,255,109,0,0,0,0,0,0,0,0,0,0,255,193,0,0,255,84,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,
+0,0,0,0,255,111,0,0,0,0,0,0,0,0,255,127,255,174,0,0,255,150,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,255,170,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,127,0,0,0,0,255,174,0,0,0,0,0,0,255,133,255,
+84,255,106,0,0,254,233,0,0,0,0,255,106,255,152,0,0,255,20,0,0,255,193,255,
+86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,113,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,
+0,255,170,0,0,0,0,255,133,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,255,193,
+0,0,0,0,255,215,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,215,0,0,0,0,0,0,255,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,255,
+133,0,0,255,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,150,0,0,0,0,255,106,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,255,
+172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,0,0,0,255,215,255,190,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,195,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,127,0,0,0,0,255,92,255,51,255,63,255,170,0,0,255,190,255,106,0,0,
+255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,0,
+0,0,0,255,174,255,150,255,190,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,129,0,0,0,0,0,0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,255,113,0,0,0,0,0,0,0,0,255,129,0,0,
+0,0,0,0,0,0,0,0,255,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,255,
+195,255,106,255,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,129,0,0,0,0,255,150,0,0,0,0,255,154,255,90,255,127,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,150,0,0,0,0,255,174,255,170,255,213,0,0,0,0,0,0,0,0,0,0,255,215,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,193,0,0,255,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,
+0,255,154,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,172,
+0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,154,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,106,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,255,195,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,174,255,193,0,0,255,154,0,0,0,0,255,
+193,0,0,0,0,255,174,0,0,255,215,0,0,0,0,255,174,0,0,255,215,0,0,0,0,255,174,
+0,0,0,0,0,0,255,215,0,0,255,172,255,195,255,195,255,193,255,215,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,0,
+0,0,0,0,0,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,215,255,174,0,0,0,0,255,174,255,195,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,154,255,113,0,0,255,31,255,72,0,0,255,113,255,174,0,0,
+255,86,0,0,255,154,255,72,255,133,255,215,0,0,0,0,255,195,0,0,0,0,0,0,0,0,
+255,133,255,215,255,211,0,0,0,0,0,0,255,113,0,0,0,0,255,154,255,113,255,154,
+255,51,255,92,255,154,255,174,255,174,255,154,255,133,255,133,255,174,255,
+236,255,92,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,213,255,37,255,113,
+0,0,255,82,0,0,255,195,255,20,255,51,255,59,255,92,255,113,254,129,254,231,
+255,0,255,43,255,104,0,0,255,63,0,0,255,106,255,37,255,63,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,195,255,174,0,0,255,57,255,106,255,39,0,0,255,86,255,0,0,
+0,255,133,255,106,0,0,0,0,255,92,0,0,255,16,0,0,0,0,0,0,0,0,0,0,0,0,255,20,
+0,0,0,0,255,51,0,0,255,193,255,170,255,170,255,129,255,63,0,0,255,154,255,
+113,0,0,255,147,255,174,0,0,255,63,0,0,255,174,0,63,0,0,255,168,0,0,255,106,
+255,150,255,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,100,0,0,0,0,255,150,0,0,255,195,255,127,255,
+68,255,86,255,86,255,174,254,172,254,193,255,127,255,129,255,129,0,0,255,
+0,0,0,255,170,255,20,254,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,255,170,
+0,0,255,106,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,255,43,255,106,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,174,0,0,0,0,255,170,0,0,0,0,255,129,0,0,255,90,255,88,0,0,254,193,254,
+193,255,150,255,86,255,174,0,0,255,43,0,0,255,150,255,23,255,43,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,154,0,0,255,86,0,0,0,0,255,43,0,0,254,233,0,0,0,
+0,0,0,0,0,0,0,255,86,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,113,255,51,255,127,0,0,255,20,0,0,255,
+127,255,133,255,109,255,20,255,41,255,154,254,233,254,236,255,63,255,43,255,
+84,255,193,255,43,0,0,255,63,255,20,255,41,0,0,0,0,0,0,0,0,255,195,0,0,0,
+0,255,113,255,129,0,0,255,63,255,127,255,86,0,0,255,106,255,150,0,0,0,0,0,
+0,0,0,254,233,255,88,255,106,0,0,0,0,0,0,0,0,0,0,0,0,255,127,255,63,255,86,
+255,154,0,0,255,127,0,0,0,0,0,0,255,109,255,129,255,63,255,170,0,0,0,0,255,
+154,0,0,255,84,255,106,255,129,0,0,0,0,255,150,255,127,255,106,0,0,255,174,
+0,0,0,0,0,0,0,0,0,0,255,170,255,195,255,195,255,195,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,255,193,255,133,255,195,0,0,255,109,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,106,0,0,255,174,255,150,0,0,0,
+0,255,72,254,213,255,66,255,150,0,0,0,0,255,63,0,0,255,236,0,0,0,41,0,0,0,
+0,255,213,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,170,255,84,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,255,195,255,193,255,170,255,150,255,150,255,193,255,150,255,63,0,
+0,0,0,0,0,0,0,0,0,255,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,133,0,0,
+255,133,255,154,0,0,255,195,255,215,0,0,255,154,0,0,0,0,255,195,255,215,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,154,0,0,255,195,0,0,0,0,0,0,255,195,0,0,
+0,0,255,215,0,0,0,0,255,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,147,255,
+150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,174,0,0,255,133,255,133,0,0,255,195,0,0,0,0,255,195,0,0,255,195,255,
+133,0,0,255,215,255,170,0,0,255,195,0,0,255,215,255,215,0,0,255,154,255,215,
+0,0,0,0,255,174,0,0,255,170,255,174,0,0,255,195,0,0,255,150,255,106,0,0,0,
+0,0,0,0,0,0,0,255,195,0,0,255,195,0,0,255,106,255,150,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,193,255,174,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,150,0,0,0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,255,150,255,150,0,0,255,174,0,0,
+255,190,255,215,0,0,255,150,255,174,0,0,255,215,255,154,255,154,255,195,0,
+0,0,0,255,193,0,0,0,0,0,0,0,0,0,0,0,0,255,154,255,133,255,190,0,0,255,174,
+255,174,255,150,255,170,0,0,0,0,0,0,0,0,255,106,0,0,0,0,255,215,0,0,255,170,
+255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,255,172,0,0,0,0,0,0,255,213,0,0,0,0,0,0,255,215,255,86,0,0,0,0,255,
+174,0,0,0,0,255,170,255,195,255,88,255,113,0,0,255,0,255,86,255,113,255,92,
+255,195,0,0,255,43,0,0,0,0,255,63,255,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,174,0,0,255,51,0,0,255,92,255,86,255,129,255,195,0,0,255,195,0,0,0,0,
+255,20,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,255,86,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,255,174,255,215,255,168,0,0,0,0,0,0,0,0,0,0,255,150,0,0,255,193,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,255,172,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,109,0,0,255,195,0,0,0,0,0,0,255,
+133,255,47,255,113,0,0,0,0,255,215,255,127,0,0,255,215,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,170,255,129,255,195,0,0,0,0,0,0,255,195,0,0,255,113,255,195,
+255,195,0,0,255,150,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,133,0,
+0,255,195,255,86,0,0,0,0,255,113,255,84,255,84,0,0,0,0,0,0,255,63,0,0,255,
+174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,129,0,0,0,0,0,0,0,0,0,0,255,
+129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,195,0,0,0,0,255,170,255,172,0,0,255,236,255,106,255,133,0,
+0,0,0,0,0,0,0,255,170,0,0,0,0,255,174,0,0,0,0,255,195,0,0,255,174,255,174,
+0,0,255,188,255,133,0,0,255,170,255,174,0,0,255,154,0,0,0,0,255,133,255,174,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,0,0,255,195,0,0,255,174,0,0,0,0,0,
+0,0,0,255,174,0,0,0,0,255,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,127,
+255,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,0,255,215,0,0,0,
+0,0,0,255,195,0,0,0,0,0,0,255,195,255,154,0,0,255,152,0,0,0,0,255,174,0,0,
+0,0,255,174,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,154,
+255,150,255,213,255,215,0,0,0,0,0,0,0,0,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,255,195,0,0,255,113,255,
+195,255,133,255,195,255,106,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,
+255,172,0,0,0,0,255,23,0,0,0,0,255,51,255,43,255,43,255,113,0,0,255,174,255,
+0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,174,0,0,0,0,0,0,0,0,0,0,255,213,255,66,0,0,0,0,0,
+0,0,0,255,172,0,0,255,86,255,133,255,133,255,195,255,43,255,174,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,215,255,66,0,0,255,174,255,25,0,0,0,0,255,10,254,
+170,254,233,255,86,0,0,255,174,254,129,0,0,255,174,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,150,0,0,0,0,254,238,0,0,0,0,0,0,0,0,255,170,255,86,0,0,0,0,0,0,
+255,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,129,255,150,255,150,0,0,255,129,0,0,255,190,255,63,0,0,0,0,255,170,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,195,255,154,0,0,0,0,255,154,0,0,0,0,
+255,133,255,195,255,195,255,215,255,174,255,195,255,215,255,174,255,215,255,
+154,0,0,255,236,0,0,255,72,255,195,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,2,43,0,0,
+0,1,0,4,2,40,0,151,0,152,0,170,0,1,0,2,0,151,0,3,0,5,0,6,0,153,0,7,0,154,
+0,8,0,152,0,9,0,155,0,152,0,153,0,155,0,154,0,155,0,155,0,10,0,150,0,152,
+0,11,0,12,0,13,0,157,0,157,0,170,0,14,0,152,0,15,0,16,0,17,0,157,0,157,0,
+18,0,19,0,20,0,21,0,152,0,22,0,23,0,24,0,25,0,158,0,152,0,153,0,158,0,154,
+0,158,0,158,0,156,0,26,0,152,0,153,0,170,0,154,0,27,0,28,0,156,0,159,0,29,
+0,30,0,159,0,31,0,159,0,159,0,32,0,152,0,33,0,34,0,152,0,35,0,36,0,37,0,38,
+0,39,0,159,0,40,0,41,0,152,0,42,0,43,0,152,0,160,0,152,0,153,0,160,0,154,
+0,160,0,160,0,156,0,170,0,152,0,153,0,170,0,154,0,170,0,44,0,156,0,161,0,
+45,0,46,0,161,0,47,0,161,0,48,0,49,0,50,0,170,0,170,0,51,0,170,0,161,0,52,
+0,170,0,53,0,152,0,153,0,54,0,154,0,55,0,56,0,152,0,152,0,58,0,154,0,152,
+0,59,0,152,0,153,0,60,0,61,0,62,0,63,0,64,0,65,0,152,0,153,0,66,0,170,0,67,
+0,68,0,69,0,162,0,152,0,153,0,162,0,154,0,162,0,162,0,162,0,158,0,152,0,153,
+0,158,0,154,0,158,0,158,0,152,0,152,0,156,0,154,0,152,0,158,0,152,0,153,0,
+158,0,154,0,158,0,158,0,152,0,152,0,156,0,154,0,152,0,150,0,153,0,70,0,71,
+0,72,0,152,0,73,0,150,0,152,0,153,0,75,0,154,0,150,0,163,0,170,0,152,0,153,
+0,170,0,154,0,170,0,170,0,153,0,164,0,170,0,76,0,164,0,77,0,78,0,164,0,79,
+0,80,0,81,0,82,0,83,0,153,0,84,0,85,0,87,0,153,0,153,0,165,0,165,0,88,0,165,
+0,153,0,89,0,153,0,153,0,165,0,165,0,90,0,165,0,153,0,91,0,153,0,153,0,165,
+0,165,0,92,0,165,0,153,0,93,0,152,0,153,0,150,0,154,0,94,0,158,0,152,0,152,
+0,158,0,154,0,152,0,158,0,152,0,153,0,150,0,154,0,158,0,170,0,160,0,152,0,
+153,0,160,0,154,0,95,0,96,0,153,0,154,0,97,0,153,0,154,0,98,0,99,0,170,0,
+153,0,166,0,153,0,153,0,166,0,154,0,100,0,166,0,153,0,166,0,153,0,153,0,166,
+0,154,0,101,0,166,0,153,0,150,0,152,0,153,0,102,0,103,0,150,0,163,0,153,0,
+105,0,106,0,152,0,154,0,170,0,107,0,108,0,167,0,109,0,110,0,167,0,111,0,112,
+0,168,0,113,0,114,0,115,0,116,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,
+170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,
+0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,
+170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,
+0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,
+170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,
+0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,
+170,0,170,0,170,0,170,0,170,0,170,0,4,0,159,0,57,0,158,0,74,0,86,0,158,0,
+153,0,104,0,152,0,152,0,117,0,152,0,152,0,152,0,154,0,152,0,170,0,170,0,118,
+0,119,0,152,0,152,0,120,0,152,0,152,0,121,0,122,0,158,0,123,0,158,0,152,0,
+124,0,125,0,126,0,162,0,170,0,127,0,128,0,170,0,160,0,129,0,130,0,168,0,152,
+0,152,0,154,0,152,0,170,0,152,0,153,0,170,0,154,0,131,0,132,0,133,0,170,0,
+170,0,134,0,170,0,152,0,135,0,164,0,170,0,136,0,164,0,137,0,138,0,164,0,154,
+0,139,0,153,0,154,0,140,0,152,0,152,0,159,0,141,0,142,0,159,0,170,0,159,0,
+159,0,170,0,152,0,153,0,170,0,154,0,170,0,143,0,158,0,152,0,153,0,158,0,154,
+0,158,0,158,0,144,0,152,0,153,0,150,0,154,0,158,0,158,0,170,0,170,0,170,0,
+170,0,170,0,170,0,170,0,170,0,170,0,170,0,170,0,152,0,152,0,153,0,158,0,154,
+0,158,0,158,0,153,0,153,0,165,0,165,0,145,0,165,0,152,0,153,0,170,0,154,0,
+170,0,146,0,154,0,147,0,153,0,154,0,148,0,152,0,152,0,170,0,153,0,153,0,170,
+0,154,0,149,0,2,0,174,0,4,0,5,0,31,0,6,0,8,0,32,0,9,0,9,0,36,0,10,0,10,0,
+31,0,11,0,18,0,24,0,19,0,26,0,25,0,27,0,28,0,1,0,29,0,34,0,2,0,35,0,36,0,
+31,0,37,0,39,0,2,0,40,0,40,0,43,0,41,0,41,0,56,0,42,0,42,0,57,0,43,0,43,0,
+26,0,44,0,44,0,3,0,45,0,47,0,26,0,48,0,49,0,1,0,51,0,58,0,4,0,62,0,62,0,58,
+0,67,0,69,0,5,0,70,0,70,0,88,0,71,0,75,0,5,0,76,0,76,0,84,0,77,0,77,0,59,
+0,78,0,81,0,5,0,83,0,83,0,5,0,84,0,84,0,37,0,85,0,87,0,5,0,88,0,88,0,60,0,
+89,0,89,0,61,0,90,0,90,0,5,0,91,0,95,0,6,0,96,0,96,0,7,0,97,0,98,0,6,0,102,
+0,102,0,62,0,104,0,104,0,7,0,107,0,109,0,8,0,111,0,113,0,8,0,115,0,117,0,
+9,0,119,0,119,0,9,0,120,0,120,0,44,0,121,0,121,0,63,0,123,0,125,0,10,0,127,
+0,127,0,10,0,128,0,128,0,64,0,129,0,129,0,7,0,130,0,131,0,10,0,132,0,132,
+0,65,0,133,0,133,0,66,0,134,0,134,0,10,0,135,0,137,0,11,0,138,0,138,0,12,
+0,140,0,140,0,45,0,141,0,142,0,12,0,143,0,145,0,13,0,146,0,146,0,67,0,147,
+0,147,0,38,0,148,0,148,0,46,0,149,0,149,0,68,0,151,0,157,0,33,0,158,0,158,
+0,39,0,159,0,159,0,69,0,162,0,162,0,70,0,166,0,166,0,81,0,167,0,167,0,82,
+0,168,0,168,0,71,0,169,0,169,0,72,0,171,0,182,0,14,0,183,0,184,0,1,0,185,
+0,187,0,2,0,188,0,188,0,1,0,189,0,189,0,2,0,190,0,191,0,1,0,192,0,194,0,15,
+0,195,0,195,0,1,0,196,0,196,0,27,0,200,0,200,0,73,0,202,0,202,0,16,0,205,
+0,209,0,16,0,210,0,210,0,47,0,211,0,212,0,16,0,213,0,215,0,17,0,216,0,216,
+0,40,0,217,0,217,0,17,0,218,0,218,0,83,0,219,0,219,0,17,0,220,0,220,0,48,
+0,221,0,224,0,18,0,225,0,225,0,90,0,226,0,227,0,18,0,228,0,228,0,91,0,229,
+0,232,0,18,0,233,0,233,0,92,0,234,0,234,0,49,0,235,0,235,0,18,0,237,0,243,
+0,28,0,244,0,246,0,19,0,247,0,247,0,50,0,248,0,248,0,19,0,249,0,251,0,34,
+0,252,0,252,0,19,0,253,0,253,0,74,0,254,0,254,0,51,0,255,0,255,0,19,1,0,1,
+2,0,34,1,4,1,6,0,34,1,7,1,22,0,20,1,23,1,38,0,29,1,39,1,40,0,1,1,41,1,43,
+0,17,1,44,1,44,0,1,1,45,1,45,0,27,1,46,1,46,0,30,1,47,1,47,0,21,1,48,1,48,
+0,30,1,49,1,49,0,3,1,50,1,50,0,30,1,51,1,51,0,76,1,52,1,52,0,98,1,54,1,56,
+0,22,1,57,1,57,0,52,1,58,1,59,0,22,1,60,1,60,0,93,1,61,1,61,0,41,1,62,1,62,
+0,26,1,63,1,63,0,53,1,64,1,64,0,30,1,153,1,153,0,7,1,154,1,154,0,89,1,155,
+1,158,0,7,1,160,1,160,0,34,1,161,1,161,0,75,1,162,1,162,0,1,1,163,1,165,0,
+2,1,166,1,168,0,6,1,169,1,169,0,7,1,170,1,171,0,30,1,172,1,172,0,3,1,173,
+1,173,0,77,1,174,1,175,0,22,1,176,1,176,0,42,1,177,1,177,0,22,1,178,1,178,
+0,7,1,180,1,183,0,7,1,187,1,187,0,97,1,189,1,189,0,7,1,190,1,190,0,85,1,191,
+1,191,0,86,1,192,1,192,0,87,1,193,1,195,0,7,1,197,1,198,0,34,1,200,1,200,
+0,34,1,201,1,207,0,7,1,213,1,213,0,54,1,215,1,219,0,35,1,220,1,220,0,78,1,
+221,1,221,0,35,1,222,1,228,0,7,1,229,1,231,0,5,1,232,1,232,0,99,1,233,1,233,
+0,5,1,234,1,234,0,55,1,235,1,235,0,96,1,239,1,239,0,79,1,243,1,249,0,23,1,
+250,1,252,0,34,1,254,2,0,0,34,2,13,2,18,0,4,2,19,2,22,0,18,2,23,2,23,0,94,
+2,24,2,24,0,95,2,27,2,27,0,80,2,29,2,29,0,16,2,31,2,37,0,20,0,4,0,0,0,1,0,
+8,0,1,0,12,0,22,0,1,0,44,0,76,0,1,0,3,2,1,2,45,2,46,0,2,0,3,0,4,1,64,0,0,
+1,153,2,0,1,61,2,13,2,44,1,165,0,3,0,0,0,14,0,0,0,20,0,0,0,26,0,1,0,0,6,10,
+0,1,0,0,6,10,0,1,0,0,6,10,1,197,3,140,3,146,3,152,3,158,3,164,3,170,3,176,
+3,182,3,188,3,194,3,200,3,206,3,212,3,218,3,224,3,230,3,236,3,242,3,248,3,
+254,4,4,4,10,4,16,4,22,4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,
+4,88,4,94,4,100,4,106,4,112,4,118,4,124,4,130,4,136,4,142,4,148,4,154,4,160,
+4,166,4,172,4,178,4,184,4,190,4,196,4,202,4,208,4,214,4,220,4,226,4,232,4,
+238,4,244,4,250,5,0,5,6,5,12,5,18,5,24,5,30,5,36,5,42,5,48,5,54,5,60,5,66,
+5,72,5,78,5,84,5,90,5,96,5,102,5,108,5,114,5,120,5,126,5,132,5,138,5,144,
+5,150,5,156,5,162,5,168,5,174,5,180,5,186,5,192,5,198,5,204,5,210,5,216,5,
+222,5,228,5,234,5,240,5,246,5,252,6,2,6,8,6,14,6,20,6,26,6,32,6,38,6,44,6,
+50,6,56,6,62,6,68,6,74,6,80,6,86,6,92,6,98,6,104,6,110,6,116,6,122,6,128,
+6,134,6,140,6,146,6,152,6,158,6,164,6,170,6,176,6,182,6,188,6,194,6,200,6,
+206,6,212,6,218,6,224,6,230,6,236,6,242,6,248,6,254,7,4,7,10,7,16,7,22,7,
+28,7,34,7,40,7,46,7,52,7,58,7,64,7,70,7,76,7,82,7,88,7,94,7,100,7,106,7,112,
+7,118,7,124,7,130,7,136,7,142,7,148,7,154,7,160,7,166,7,172,7,178,7,184,7,
+190,7,196,7,202,7,208,7,214,7,220,7,226,7,232,7,238,7,244,7,250,8,0,8,6,8,
+12,8,18,8,24,8,30,8,36,8,42,8,48,8,54,8,60,8,66,8,72,8,78,8,84,8,90,8,96,
+8,102,8,108,8,114,8,120,8,126,8,132,8,138,8,144,8,150,8,156,8,162,8,168,8,
+174,8,180,8,186,8,192,8,198,8,204,8,210,8,216,8,222,8,228,8,234,8,240,8,246,
+8,252,9,2,9,8,9,14,9,20,9,26,9,32,9,38,9,44,9,50,9,56,9,62,9,68,9,74,9,80,
+9,86,9,92,9,98,9,104,9,110,9,116,9,122,9,128,9,134,9,140,9,146,9,152,9,158,
+9,164,9,170,9,176,9,182,9,188,9,194,9,200,9,206,9,212,9,218,9,224,9,230,9,
+236,9,242,9,248,9,254,10,4,10,10,10,16,10,22,10,28,10,34,10,40,10,46,10,52,
+10,58,10,64,10,70,10,76,10,82,10,88,10,94,10,100,10,106,10,112,10,118,10,
+124,10,130,10,136,10,142,10,148,10,154,10,160,10,166,10,172,10,178,10,184,
+10,190,10,196,10,202,10,208,10,214,10,220,10,226,10,232,10,238,10,244,10,
+250,11,0,11,6,11,12,11,18,11,24,11,30,11,36,11,42,11,48,11,54,11,60,11,66,
+11,72,11,78,11,84,11,90,11,96,11,102,11,108,11,114,11,120,11,126,11,132,11,
+138,11,144,11,150,11,156,11,162,11,168,11,174,11,180,11,186,11,192,11,198,
+11,204,11,210,11,216,11,222,11,228,11,234,11,240,11,246,11,252,12,2,12,8,
+12,14,12,20,12,26,12,32,12,38,12,44,12,50,12,56,12,62,12,68,12,74,12,80,12,
+86,12,92,12,98,12,104,12,110,12,116,12,122,12,128,12,134,12,140,12,146,12,
+152,12,158,12,164,12,170,12,176,12,182,12,188,12,194,12,200,12,206,12,212,
+12,218,12,224,12,230,12,236,12,242,12,248,12,254,13,4,13,10,13,16,13,22,13,
+28,13,34,13,40,13,46,13,52,13,58,13,64,13,70,13,76,13,82,13,88,13,94,13,100,
+13,106,13,112,13,118,13,124,13,130,13,136,13,142,13,148,13,154,13,160,13,
+166,13,172,13,178,13,184,13,190,13,196,13,202,13,208,13,214,13,220,13,226,
+13,232,13,238,13,244,13,250,14,0,14,6,14,12,14,18,14,24,14,30,14,36,0,1,2,
+121,6,10,0,1,2,125,6,10,0,1,2,45,6,10,0,1,2,74,6,10,0,1,2,61,6,10,0,1,3,90,
+6,10,0,1,2,125,6,10,0,1,2,109,6,10,0,1,2,109,6,10,0,1,2,109,6,10,0,1,2,98,
+6,10,0,1,2,109,6,10,0,1,2,170,6,10,0,1,2,129,6,10,0,1,2,129,6,10,0,1,3,8,
+6,10,0,1,3,8,6,10,0,1,3,8,6,10,0,1,2,223,6,10,0,1,3,8,6,10,0,1,3,8,6,133,
+0,1,3,8,6,10,0,1,2,223,6,10,0,1,3,240,6,10,0,1,3,240,6,10,0,1,3,219,6,10,
+0,1,3,219,6,10,0,1,3,219,6,10,0,1,3,219,6,10,0,1,3,219,6,10,0,1,3,219,6,10,
+0,1,3,76,6,10,0,1,3,74,6,10,0,1,3,14,6,10,0,1,3,55,6,10,0,1,3,57,6,10,0,1,
+4,57,6,10,0,1,3,55,6,10,0,1,3,55,6,10,0,1,2,225,6,10,0,1,2,227,6,10,0,1,2,
+145,6,10,0,1,2,227,6,10,0,1,2,203,6,10,0,1,2,201,6,10,0,1,2,211,6,10,0,1,
+2,246,6,10,0,1,2,121,6,10,0,1,2,115,6,10,0,1,2,117,6,10,0,1,2,98,6,10,0,1,
+2,119,6,10,0,1,2,121,6,10,0,1,2,121,6,10,0,1,2,102,6,10,0,1,2,119,6,174,0,
+1,2,119,6,174,0,1,2,119,6,174,0,1,2,102,6,174,0,1,2,119,6,174,0,1,2,41,6,
+174,0,1,2,119,6,174,0,1,2,102,6,174,0,1,2,170,6,10,0,1,2,170,6,10,0,1,2,170,
+6,10,0,1,2,182,6,10,0,1,2,170,6,10,0,1,2,170,6,174,0,1,2,170,6,10,0,1,2,172,
+6,10,0,1,2,184,6,10,0,1,2,170,6,10,0,1,2,170,6,10,0,1,2,186,6,10,0,1,2,170,
+6,174,0,1,2,170,6,174,0,1,2,170,6,174,0,1,2,197,6,174,0,1,2,170,6,174,0,1,
+2,104,6,174,0,1,2,170,6,174,0,1,2,174,6,174,0,1,2,170,6,174,0,1,2,170,6,174,
+0,1,2,172,6,174,0,1,2,174,6,174,0,1,2,121,6,10,0,1,2,127,6,10,0,1,2,125,6,
+10,0,1,2,102,6,10,0,1,2,125,6,10,0,1,3,170,6,10,0,1,2,125,6,10,0,1,2,145,
+6,10,0,1,2,121,6,174,0,1,2,125,6,174,0,1,2,125,6,174,0,1,2,100,6,174,0,1,
+2,125,6,174,0,1,3,172,6,174,0,1,2,125,6,174,0,1,2,125,6,174,0,1,2,119,6,10,
+0,1,2,119,6,10,0,1,2,119,6,10,0,1,2,119,6,10,0,1,2,121,6,10,0,1,2,119,6,51,
+0,1,2,119,6,10,0,1,2,119,6,10,0,1,2,119,6,174,0,1,2,119,6,174,0,1,2,119,6,
+174,0,1,2,119,6,174,0,1,2,125,6,174,0,1,2,98,6,174,0,1,2,119,6,174,0,1,2,
+119,6,174,0,1,3,100,6,10,0,1,3,94,6,10,0,1,3,98,6,10,0,1,2,59,6,10,0,1,3,
+98,6,10,0,1,2,94,6,10,0,1,3,176,6,10,0,1,3,72,6,10,0,1,3,86,6,10,0,1,3,96,
+6,10,0,1,3,94,6,10,0,1,3,94,6,10,0,1,2,25,6,10,0,1,2,25,6,10,0,1,2,25,6,10,
+0,1,2,106,6,10,0,1,1,254,6,10,0,1,2,35,6,10,0,1,2,141,6,10,0,1,2,139,6,10,
+0,1,2,57,6,51,0,1,2,55,6,51,0,1,2,55,6,51,0,1,2,82,6,51,0,1,2,68,6,51,0,1,
+1,248,6,51,0,1,2,100,6,51,0,1,2,82,6,51,0,1,2,47,6,10,0,1,2,47,6,10,0,1,2,
+47,6,10,0,1,2,45,6,10,0,1,2,47,6,10,0,1,2,23,6,10,0,1,2,47,6,10,0,1,2,33,
+6,51,0,1,2,131,6,10,0,1,2,145,6,10,0,1,2,145,6,10,0,1,2,145,6,10,0,1,2,145,
+6,10,0,1,2,145,6,10,0,1,2,145,6,10,0,1,2,145,6,10,0,1,2,145,6,2,0,1,2,145,
+6,10,0,1,2,145,6,10,0,1,2,145,6,10,0,1,2,18,6,174,0,1,2,23,6,174,0,1,2,23,
+6,174,0,1,2,18,6,174,0,1,2,45,6,174,0,1,2,25,6,174,0,1,2,23,6,174,0,1,2,23,
+6,174,0,1,2,14,6,174,0,1,2,23,6,174,0,1,2,18,6,174,0,1,2,18,6,174,0,1,3,14,
+6,10,0,1,3,27,6,10,0,1,3,29,6,8,0,1,3,27,6,10,0,1,3,27,6,10,0,1,3,20,6,10,
+0,1,3,14,6,10,0,1,2,121,6,10,0,1,2,129,6,10,0,1,3,2,6,10,0,1,2,104,6,10,0,
+1,2,244,6,10,0,1,2,121,6,10,0,1,2,121,6,10,0,1,2,43,6,10,0,1,2,47,6,10,0,
+1,2,47,6,10,0,1,2,43,6,10,0,1,2,47,6,10,0,1,3,61,6,10,0,1,2,43,6,10,0,1,2,
+51,6,10,0,1,3,57,6,10,0,1,3,57,6,10,0,1,3,57,6,10,0,1,3,57,6,10,0,1,3,57,
+6,10,0,1,1,225,6,137,0,1,3,57,6,10,0,1,3,57,6,10,0,1,2,4,6,10,0,1,2,25,6,
+10,0,1,2,23,6,10,0,1,2,45,6,10,0,1,2,20,6,10,0,1,2,221,6,10,0,1,2,6,6,10,
+0,1,2,162,6,10,0,1,3,29,6,10,0,1,3,33,6,10,0,1,3,14,6,10,0,1,2,205,6,10,0,
+1,2,123,6,10,0,1,2,236,6,10,0,1,2,156,6,10,0,1,2,125,6,10,0,1,2,250,6,10,
+0,1,2,246,6,10,0,1,2,250,6,10,0,1,2,205,6,10,0,1,2,225,6,10,0,1,2,203,6,10,
+0,1,2,117,6,10,0,1,2,131,6,51,0,1,2,252,6,51,0,1,2,250,6,51,0,1,2,250,6,51,
+0,1,2,186,6,51,0,1,2,131,6,51,0,1,2,246,6,51,0,1,2,156,6,51,0,1,2,86,6,10,
+0,1,2,86,6,10,0,1,2,86,6,10,0,1,2,86,6,10,0,1,2,86,6,10,0,1,3,23,6,10,0,1,
+2,8,6,10,0,1,2,8,6,10,0,1,2,86,6,10,0,1,2,84,6,10,0,1,2,86,6,10,0,1,2,86,
+6,10,0,1,2,66,6,51,0,1,2,66,6,51,0,1,2,66,6,51,0,1,2,66,6,51,0,1,2,66,6,51,
+0,1,2,119,6,51,0,1,2,178,6,195,0,1,3,193,6,10,0,1,3,193,6,10,0,1,3,193,6,
+10,0,1,3,182,6,10,0,1,3,193,6,10,0,1,3,96,6,10,0,1,3,182,6,10,0,1,3,168,6,
+10,0,1,3,242,6,10,0,1,3,242,6,10,0,1,3,244,6,10,0,1,3,227,6,10,0,1,3,242,
+6,10,0,1,3,225,6,10,0,1,3,188,6,10,0,1,3,225,6,10,0,1,2,14,6,10,0,1,2,16,
+6,10,0,1,2,16,6,10,0,1,2,14,6,10,0,1,2,16,6,10,0,1,2,16,6,10,0,1,2,14,6,10,
+0,1,2,16,6,10,0,1,2,37,6,10,0,1,2,37,6,10,0,1,2,35,6,10,0,1,2,37,6,10,0,1,
+2,35,6,10,0,1,2,37,6,10,0,1,2,37,6,10,0,1,2,37,6,10,0,1,2,121,6,10,0,1,2,
+125,6,10,0,1,1,244,6,10,0,1,1,244,6,10,0,1,1,248,6,10,0,1,2,121,6,10,0,1,
+2,141,6,10,0,1,3,109,6,10,0,1,4,4,6,10,0,1,3,109,6,10,0,1,3,119,6,10,0,1,
+3,106,6,10,0,1,2,190,6,10,0,1,3,14,6,10,0,1,3,6,6,10,0,1,2,195,6,10,0,1,2,
+195,6,10,0,1,2,195,6,10,0,1,2,195,6,10,0,1,2,195,6,10,0,1,2,176,6,10,0,1,
+3,88,6,10,0,1,2,195,6,10,0,1,3,41,6,10,0,1,3,203,6,133,0,1,3,104,6,10,0,1,
+3,172,6,10,0,1,2,170,6,10,0,1,4,23,6,10,0,1,3,172,6,10,0,1,4,106,6,10,0,1,
+3,68,6,10,0,1,2,6,6,10,0,1,2,61,6,10,0,1,3,86,6,10,0,1,3,240,6,10,0,1,3,223,
+6,10,0,1,3,223,6,10,0,1,3,223,6,10,0,1,2,125,6,10,0,1,2,125,6,10,0,1,2,102,
+6,10,0,1,3,221,6,10,0,1,3,106,6,10,0,1,3,111,6,10,0,1,3,129,6,10,0,1,2,174,
+6,10,0,1,2,193,6,10,0,1,2,193,6,10,0,1,2,195,6,10,0,1,2,156,6,10,0,1,3,72,
+6,10,0,1,4,2,6,10,0,1,4,18,6,10,0,1,3,190,6,10,0,1,3,190,6,174,0,1,3,190,
+6,10,0,1,2,119,6,10,0,1,2,119,6,174,0,1,2,207,6,10,0,1,2,84,6,51,0,1,2,100,
+6,10,0,1,3,111,6,10,0,1,3,121,6,10,0,1,3,137,6,10,0,1,3,135,6,51,0,1,5,8,
+6,10,0,1,5,10,6,10,0,1,3,68,6,10,0,1,3,174,6,10,0,1,2,61,6,51,0,1,2,68,6,
+51,0,1,2,63,6,51,0,1,2,68,6,51,0,1,3,201,6,174,0,1,3,213,6,174,0,1,3,213,
+6,174,0,1,3,213,6,174,0,1,3,219,6,174,0,1,3,94,6,174,0,1,3,209,6,174,0,1,
+2,119,6,174,0,1,2,119,6,174,0,1,2,119,6,174,0,1,2,119,6,174,0,1,2,125,6,174,
+0,1,2,61,6,174,0,1,2,119,6,174,0,1,3,57,6,10,0,1,3,57,6,10,0,1,3,57,6,10,
+0,1,3,57,6,10,0,1,3,104,6,10,0,1,1,217,6,174,0,1,3,57,6,10,0,1,5,53,6,10,
+0,1,5,18,6,10,0,1,5,23,6,10,0,1,5,23,6,10,0,1,5,20,6,10,0,1,5,23,6,10,0,1,
+4,223,6,10,0,1,2,170,6,10,0,1,2,170,6,10,0,1,2,170,6,10,0,1,2,180,6,10,0,
+1,2,170,6,10,0,1,1,221,6,10,0,1,2,170,6,10,0,1,2,145,6,10,0,1,2,145,6,10,
+0,1,2,145,6,10,0,1,2,145,6,10,0,1,2,145,6,10,0,1,2,145,6,10,0,1,2,145,6,10,
+0,1,2,35,6,10,0,1,2,25,6,10,0,1,2,29,6,10,0,1,2,31,6,10,0,1,2,31,6,10,0,1,
+2,25,6,10,0,1,2,23,6,10,0,1,2,70,6,10,0,1,2,70,6,10,0,1,2,76,6,10,0,1,2,72,
+6,10,0,1,2,68,6,10,0,1,3,33,6,10,0,1,2,16,6,10,0,1,2,119,6,10,0,1,2,119,6,
+10,0,1,2,102,6,10,0,1,2,125,6,10,0,1,2,121,6,10,0,1,2,125,6,10,0,1,2,252,
+6,10,0,1,2,250,6,10,0,1,2,252,6,10,0,1,2,221,6,10,0,1,2,129,6,10,0,1,2,240,
+6,10,0,1,2,41,6,174,0,1,2,41,6,174,0,1,2,45,6,174,0,1,2,45,6,174,0,1,3,57,
+6,174,0,1,2,43,6,174,0,1,3,250,6,174,0,1,4,4,6,174,0,1,4,4,6,174,0,1,4,4,
+6,174,0,1,4,4,6,174,0,1,4,23,6,174,0,1,4,4,6,174,0,1,2,53,6,174,0,1,2,37,
+6,174,0,1,2,37,6,174,0,1,2,53,6,174,0,1,2,37,6,174,0,1,2,33,6,174,0,1,2,39,
+6,174,0,1,0,0,0,10,0,48,0,62,0,2,101,116,104,105,0,14,108,97,116,110,0,26,
+0,4,0,0,0,0,255,255,0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,
+0,8,0,0,0,1,0,0,0,4,0,10,0,126,0,150,0,174,0,6,0,0,0,1,0,8,0,2,0,16,0,46,
+0,26,0,36,0,2,0,0,0,56,0,2,0,1,1,73,1,92,0,0,0,2,0,1,1,73,1,92,0,1,0,2,0,
+1,1,73,1,92,0,3,0,2,0,1,1,93,1,132,0,2,0,3,0,8,0,24,0,38,0,1,0,2,0,1,0,1,
+0,3,0,1,0,0,0,2,0,1,0,2,0,1,0,0,0,1,0,0,0,3,0,0,0,1,0,1,0,3,0,1,0,0,0,1,0,
+1,0,0,0,1,0,8,0,1,0,6,0,20,0,2,0,1,1,73,1,92,0,0,0,1,0,0,0,1,0,8,0,1,0,6,
+0,40,0,2,0,1,1,73,1,92,0,0,0,1,0,0,0,1,0,8,0,1,0,6,0,60,0,2,0,1,1,73,1,92,
+0,0,};
+#endif
@@ -0,0 +1,908 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansGeorgian_Regular_ttf_size = 21404;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansGeorgian_Regular_ttf");
+asm(".type fz_font_NotoSansGeorgian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansGeorgian_Regular_ttf, 21404");
+asm(".balign 64");
+asm("fz_font_NotoSansGeorgian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansGeorgian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansGeorgian_Regular_ttf_size = 21404;
+const char fz_font_NotoSansGeorgian_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,38,0,132,0,0,69,36,0,0,0,30,71,
+80,79,83,27,169,92,42,0,0,69,68,0,0,14,56,71,83,85,66,103,149,111,147,0,0,
+83,124,0,0,0,32,79,83,47,50,123,3,111,30,0,0,1,104,0,0,0,96,99,109,97,112,
+63,224,22,137,0,0,3,196,0,0,0,108,103,97,115,112,0,22,0,35,0,0,69,20,0,0,
+0,16,103,108,121,102,38,45,73,222,0,0,5,48,0,0,52,216,104,101,97,100,5,36,
+53,16,0,0,0,236,0,0,0,54,104,104,101,97,16,155,6,236,0,0,1,36,0,0,0,36,104,
+109,116,120,166,9,51,171,0,0,1,200,0,0,1,252,108,111,99,97,30,20,43,100,0,
+0,4,48,0,0,1,0,109,97,120,112,0,131,0,69,0,0,1,72,0,0,0,32,110,97,109,101,
+141,241,185,217,0,0,58,8,0,0,6,12,112,111,115,116,200,15,110,200,0,0,64,20,
+0,0,4,253,0,1,0,0,0,1,15,92,62,112,140,131,95,15,60,245,0,11,8,0,0,0,0,0,
+203,208,15,110,0,0,0,0,210,40,203,232,255,145,254,20,8,123,7,76,0,0,0,9,0,
+2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,8,176,255,145,0,20,8,123,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,1,0,0,0,127,0,68,0,3,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,108,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,4,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,0,0,0,1,
+0,0,0,0,4,74,5,182,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,0,6,63,
+0,125,5,113,0,117,6,10,0,82,6,27,0,125,5,27,0,82,6,10,0,82,5,246,0,20,6,184,
+0,125,3,229,0,20,5,139,0,164,6,96,0,41,5,244,0,113,5,162,0,201,6,63,0,125,
+6,123,0,41,5,233,0,41,6,10,0,82,5,27,0,184,4,215,0,199,6,63,0,125,6,109,0,
+104,4,236,0,41,5,217,0,184,5,168,0,164,5,174,0,184,5,162,0,201,5,162,0,125,
+5,244,0,113,4,215,0,199,4,156,0,74,5,162,0,201,4,219,0,31,6,10,0,41,5,139,
+0,199,5,14,0,121,5,113,0,117,5,156,0,154,6,186,0,102,4,160,0,86,4,215,0,113,
+4,215,0,113,6,205,0,115,4,231,0,86,4,113,0,66,5,6,255,215,6,205,0,115,4,215,
+0,113,4,72,0,25,8,176,0,115,4,215,0,111,4,225,0,123,6,205,0,115,4,178,0,106,
+5,0,0,86,6,205,0,115,4,231,0,162,6,37,0,113,4,213,0,31,7,0,0,113,4,223,0,
+98,6,205,0,115,4,238,0,113,4,215,0,100,4,240,0,174,5,29,0,123,4,225,0,113,
+4,215,0,123,4,160,0,86,4,225,0,164,4,160,0,86,4,182,0,98,5,63,0,164,4,225,
+0,41,4,104,0,57,4,113,0,66,5,68,0,113,7,199,0,113,4,76,0,49,4,238,0,174,4,
+215,0,113,4,203,0,113,4,68,0,147,3,102,0,98,4,61,0,20,5,6,0,162,5,98,0,20,
+4,215,0,113,5,78,0,20,7,123,255,184,4,246,255,195,7,123,0,174,3,205,0,20,
+4,233,0,166,7,123,0,174,5,20,0,113,4,242,0,174,7,123,0,166,5,90,0,20,5,90,
+0,20,7,117,0,164,4,242,0,162,4,166,0,162,7,123,0,166,7,199,0,113,3,207,0,
+41,5,78,0,20,4,242,0,162,4,242,0,162,4,242,0,174,4,242,0,174,7,111,0,113,
+7,123,0,174,5,78,0,20,4,242,0,174,4,139,255,145,7,229,0,20,4,141,0,174,4,
+188,0,86,4,242,0,162,4,193,0,162,7,111,0,113,2,36,0,147,0,0,0,0,0,0,0,1,0,
+3,0,1,0,0,0,12,0,4,0,96,0,0,0,20,0,16,0,3,0,4,0,0,0,13,0,32,0,160,5,137,16,
+197,16,252,45,37,254,255,255,255,0,0,0,0,0,13,0,32,0,160,5,137,16,160,16,
+208,45,0,254,255,255,255,0,1,255,245,255,227,255,99,250,244,239,100,239,90,
+211,87,1,127,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,
+21,0,21,0,66,0,108,0,146,0,203,0,235,1,17,1,72,1,118,1,133,1,189,1,245,2,
+43,2,83,2,153,2,189,2,234,3,17,3,48,3,84,3,156,3,211,3,240,4,16,4,53,4,109,
+4,147,4,194,4,245,5,31,5,99,5,140,5,177,5,213,5,249,6,35,6,77,6,113,6,178,
+6,228,7,36,7,108,7,197,7,252,8,63,8,135,8,204,8,246,9,52,9,150,9,214,10,16,
+10,80,10,146,10,209,11,30,11,65,11,126,11,188,12,23,12,80,12,163,12,221,13,
+43,13,105,13,183,13,230,14,52,14,144,14,193,15,2,15,85,15,167,15,227,16,27,
+16,105,16,176,17,2,17,69,17,127,17,199,17,253,18,49,18,100,18,132,18,192,
+19,3,19,64,19,113,19,181,19,239,20,51,20,72,20,134,20,205,21,3,21,50,21,103,
+21,146,21,198,21,254,22,33,22,94,22,155,22,239,23,8,23,51,23,94,23,142,23,
+185,23,232,24,51,24,110,24,183,24,234,25,12,25,75,25,122,25,166,25,209,25,
+247,26,71,26,108,26,108,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,
+55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,
+1,0,125,255,236,5,195,5,182,0,23,0,0,19,52,18,55,33,53,33,21,33,32,0,17,16,
+18,51,50,18,17,51,16,0,33,32,0,125,173,161,254,178,5,18,254,4,254,214,254,
+214,249,233,235,244,195,254,157,254,193,254,189,254,159,2,203,201,1,44,87,
+159,159,254,216,254,222,254,231,254,215,1,44,1,38,254,161,254,110,1,130,0,
+1,0,117,0,0,4,168,5,182,0,25,0,0,19,16,55,51,6,2,21,20,22,51,50,54,53,17,
+51,17,35,17,52,55,35,6,6,35,34,2,117,151,215,73,99,149,156,202,190,184,186,
+10,10,60,228,130,225,246,3,195,1,1,242,84,254,235,140,171,190,207,231,1,168,
+250,74,1,240,26,117,90,109,1,17,0,0,1,0,82,255,20,5,225,5,203,0,21,0,0,1,
+52,38,35,34,6,21,21,35,53,16,0,51,50,0,17,17,33,17,35,53,33,3,170,169,163,
+166,174,184,1,19,251,251,1,7,1,127,176,254,121,3,178,189,188,190,185,26,20,
+1,1,1,28,254,233,254,254,252,238,254,116,236,0,0,2,0,125,255,236,5,158,5,
+182,0,11,0,30,0,0,1,52,38,35,34,6,21,20,22,51,50,54,1,4,0,17,16,0,33,32,0,
+17,16,0,37,53,33,53,33,21,33,4,219,240,223,221,240,238,221,223,242,254,143,
+1,12,1,40,254,166,254,198,254,207,254,164,1,46,1,7,254,15,4,153,254,16,2,
+66,211,227,224,214,213,224,223,3,39,22,254,197,254,253,254,233,254,196,1,
+64,1,19,1,0,1,61,23,129,162,162,0,0,1,0,82,0,0,4,98,5,203,0,17,0,0,1,52,38,
+35,34,6,21,21,35,53,16,0,51,50,0,17,17,35,3,170,171,161,166,174,184,1,19,
+251,247,1,11,184,3,178,189,188,190,185,26,20,1,1,1,28,254,234,254,253,252,
+78,0,1,0,82,0,0,5,225,5,203,0,22,0,0,33,35,17,16,33,34,6,21,21,35,53,16,0,
+51,50,0,17,21,33,17,35,53,35,4,98,184,254,180,166,174,184,1,19,249,248,1,
+12,1,127,176,207,3,178,1,121,190,185,26,20,1,1,1,28,254,233,254,254,92,254,
+117,235,0,0,2,0,20,255,236,5,129,5,182,0,11,0,33,0,0,37,50,54,53,52,38,35,
+34,6,21,20,22,1,53,33,17,20,7,51,54,54,51,50,22,18,21,20,2,6,35,34,0,17,17,
+3,82,174,195,183,164,178,192,183,253,103,1,226,10,12,79,187,131,155,230,123,
+132,252,173,251,254,228,139,216,196,194,213,221,190,191,217,4,140,159,254,
+135,26,150,114,95,142,254,254,167,172,254,253,140,1,49,1,6,2,244,0,0,2,0,
+125,0,0,6,143,5,182,0,14,0,23,0,0,33,33,32,0,17,16,0,33,33,17,33,17,35,53,
+35,37,16,0,33,51,17,35,32,0,5,16,254,62,254,168,254,135,1,139,1,113,1,151,
+1,127,176,207,252,47,1,22,1,19,240,199,254,216,254,214,1,123,1,82,1,106,1,
+127,253,160,254,117,235,29,254,232,254,227,4,123,254,219,0,1,0,20,0,0,3,29,
+5,182,0,5,0,0,33,35,17,33,53,33,3,29,185,253,176,3,9,5,23,159,0,2,0,164,0,
+0,4,231,5,182,0,11,0,37,0,0,1,20,22,51,50,54,53,52,38,35,34,6,3,51,21,20,
+7,51,54,54,51,50,22,22,21,17,35,53,52,55,35,6,6,35,34,38,38,53,1,92,184,166,
+177,196,185,165,177,196,184,184,10,12,79,188,131,155,231,121,184,10,12,79,
+188,130,155,231,122,2,229,176,200,201,175,179,198,201,2,33,217,26,150,114,
+95,135,246,156,253,27,238,26,150,114,95,134,243,159,0,2,0,41,255,236,5,236,
+5,182,0,11,0,35,0,0,37,50,54,53,52,38,35,34,6,21,20,22,3,20,7,51,54,54,51,
+50,22,18,21,20,2,6,35,34,0,17,17,35,21,35,17,33,3,188,174,195,182,164,177,
+194,182,182,10,12,79,188,131,155,230,123,132,252,174,249,254,227,207,176,
+2,55,139,216,196,194,213,219,192,191,217,3,178,26,150,114,95,142,254,251,
+164,172,254,254,141,1,48,1,7,2,244,236,1,139,0,2,0,113,255,236,5,203,5,182,
+0,21,0,32,0,0,19,53,33,17,33,17,35,53,35,17,16,0,35,34,0,53,52,54,54,51,33,
+17,1,34,6,21,20,22,51,50,54,53,17,221,3,111,1,127,176,207,255,0,232,233,254,
+246,123,234,161,1,28,254,218,155,171,161,146,157,156,5,23,159,254,68,254,
+117,235,254,223,254,237,254,198,1,23,239,155,236,129,1,29,254,67,191,169,
+171,188,220,198,1,45,0,0,1,0,201,0,0,5,4,5,182,0,24,0,0,19,33,21,33,17,20,
+7,51,54,54,51,50,18,17,17,35,17,52,38,35,34,6,21,17,35,201,3,237,252,203,
+10,12,74,204,136,233,250,184,167,167,179,202,184,5,182,159,254,176,26,150,
+107,101,254,246,254,248,254,43,1,215,187,182,209,180,254,61,0,2,0,125,254,
+164,5,195,5,205,0,28,0,40,0,0,1,16,7,6,6,21,20,22,51,50,55,21,6,35,34,38,
+53,52,55,6,35,32,0,17,16,0,33,32,0,1,16,18,51,50,18,17,16,2,35,34,2,5,195,
+224,37,34,80,77,58,28,48,54,145,177,9,105,102,254,189,254,159,1,95,1,71,1,
+62,1,98,251,124,246,236,235,244,242,235,238,246,2,221,254,113,201,32,72,64,
+71,82,10,162,8,153,125,29,45,24,1,139,1,104,1,101,1,137,254,113,254,159,254,
+222,254,208,1,44,1,38,1,37,1,41,254,211,0,0,1,0,41,255,236,5,195,5,182,0,
+19,0,0,1,33,53,33,17,20,22,51,50,54,53,17,51,17,20,0,33,32,0,53,1,92,254,
+205,1,233,194,183,192,191,185,254,220,254,247,254,244,254,210,5,23,159,252,
+78,180,197,196,179,3,180,252,82,252,254,224,1,29,251,0,1,0,41,0,0,5,33,5,
+182,0,27,0,0,19,52,55,33,53,33,6,2,21,16,33,50,54,53,17,51,17,35,17,52,54,
+55,35,6,6,35,34,2,238,69,254,246,2,51,73,99,1,57,197,186,185,187,8,3,11,60,
+226,131,225,246,3,195,167,173,159,84,254,235,140,254,151,209,229,1,168,250,
+74,1,240,42,66,35,89,110,1,17,0,1,0,82,255,236,5,225,5,182,0,22,0,0,1,20,
+0,35,34,0,17,53,51,21,20,22,51,32,17,17,51,17,33,17,35,53,35,4,98,254,243,
+245,251,254,237,184,170,170,1,76,184,1,127,176,207,2,4,254,254,230,1,28,1,
+0,21,27,179,196,1,121,3,178,253,160,254,117,235,0,0,1,0,184,255,236,4,201,
+5,182,0,16,0,0,1,16,33,50,54,53,53,51,21,20,0,35,34,0,17,17,51,1,113,1,75,
+171,169,185,254,238,253,250,254,248,185,2,4,254,135,196,179,27,21,253,254,
+225,1,18,1,6,3,178,0,2,0,199,0,0,4,111,5,182,0,11,0,20,0,0,37,21,33,17,33,
+32,17,20,4,33,35,17,17,51,50,54,53,52,38,35,35,4,53,252,146,1,131,2,37,254,
+206,254,234,168,147,218,196,182,193,186,160,160,5,182,254,82,224,239,254,
+103,2,55,141,156,141,140,0,2,0,125,254,164,6,0,5,205,0,29,0,41,0,0,1,16,7,
+22,22,21,20,6,35,34,39,53,22,51,50,54,53,52,38,39,6,33,32,0,17,16,0,33,32,
+0,1,16,18,51,50,18,17,16,2,35,34,2,5,195,123,86,98,184,154,35,51,37,49,77,
+81,62,59,174,254,252,254,189,254,159,1,95,1,71,1,62,1,98,251,124,246,236,
+235,244,242,235,238,246,2,221,254,226,193,31,148,110,141,172,8,160,8,82,71,
+59,83,14,141,1,139,1,104,1,101,1,137,254,113,254,159,254,222,254,208,1,44,
+1,38,1,37,1,41,254,211,0,0,3,0,104,0,0,6,4,5,203,0,16,0,23,0,30,0,0,1,32,
+0,17,20,6,4,35,17,35,17,34,36,2,53,16,0,1,50,54,53,52,38,39,35,6,6,21,20,
+22,51,3,59,1,95,1,106,155,254,233,193,182,192,254,234,157,1,119,1,178,210,
+231,229,212,182,211,229,228,212,5,203,254,227,254,232,170,254,129,254,147,
+1,109,129,1,1,167,1,18,1,35,252,57,210,194,191,211,5,5,214,188,194,210,0,
+1,0,41,0,0,4,195,5,182,0,15,0,0,1,17,51,17,33,17,35,53,33,17,35,17,33,17,
+51,21,2,27,184,1,240,177,254,193,184,254,14,176,4,29,1,153,254,103,254,116,
+236,252,131,3,125,1,139,235,0,1,0,184,0,0,5,31,5,203,0,17,0,0,51,17,52,0,
+33,32,0,21,17,35,17,52,38,35,34,6,21,17,184,1,47,1,11,1,9,1,36,185,193,190,
+181,195,3,178,251,1,30,254,223,252,252,82,3,180,182,193,194,183,252,78,0,
+1,0,164,0,0,4,223,5,182,0,21,0,0,1,6,33,34,2,17,17,51,17,20,22,51,50,54,53,
+17,51,17,35,17,52,55,4,37,142,254,240,233,250,184,160,174,177,204,184,184,
+10,2,160,209,1,11,1,7,1,213,254,41,191,177,205,184,1,194,250,74,1,240,26,
+150,0,1,0,184,255,236,4,244,5,182,0,36,0,0,1,20,0,35,32,0,53,53,51,21,20,
+22,51,50,54,53,53,52,54,55,35,6,6,35,34,2,53,17,51,17,16,33,50,54,53,17,51,
+4,244,254,228,251,254,250,254,225,185,180,182,171,181,8,3,13,75,204,134,229,
+255,185,1,77,179,202,185,2,4,253,254,229,1,31,253,21,27,179,196,194,183,123,
+45,86,45,109,100,1,23,252,1,69,254,185,254,143,209,180,1,51,0,1,0,201,0,0,
+5,4,5,182,0,22,0,0,1,54,54,51,50,18,17,17,35,17,52,38,35,34,6,21,17,35,17,
+51,17,20,7,1,131,74,204,136,234,249,184,161,173,179,202,184,184,10,3,23,107,
+101,254,239,254,255,254,43,1,215,190,179,209,180,254,61,5,182,254,17,26,150,
+0,1,0,125,255,236,5,29,5,203,0,26,0,0,1,34,0,17,16,18,51,50,55,17,51,17,35,
+53,6,35,32,0,17,52,18,36,51,50,23,7,38,3,57,236,254,242,241,208,182,174,185,
+185,173,212,254,224,254,186,167,1,63,216,232,172,74,175,5,41,254,196,254,
+238,254,237,254,197,92,1,119,253,160,72,92,1,146,1,95,226,1,84,184,86,156,
+80,0,2,0,113,255,236,5,203,5,182,0,18,0,29,0,0,1,35,17,16,0,35,34,0,53,52,
+0,51,33,17,51,17,33,17,35,37,34,6,21,20,22,51,50,54,53,17,5,27,207,255,0,
+232,233,254,246,1,15,247,1,28,185,1,127,176,253,98,172,170,161,146,157,156,
+3,90,254,223,254,237,254,198,1,23,239,245,1,19,1,188,254,68,254,117,235,176,
+184,171,188,220,198,1,45,0,0,2,0,199,0,0,4,111,5,182,0,15,0,24,0,0,1,20,4,
+33,35,21,33,17,35,53,35,17,35,17,33,32,1,51,50,54,53,52,38,35,35,4,111,254,
+210,254,230,168,1,168,176,248,184,1,131,2,37,253,16,147,217,197,182,193,186,
+4,23,216,233,172,254,147,207,254,244,5,182,253,62,134,148,134,133,0,0,1,0,
+74,255,236,4,37,5,203,0,46,0,0,1,34,6,21,20,22,22,23,30,2,21,20,4,35,34,38,
+53,52,55,51,6,21,20,22,51,50,54,53,52,38,38,39,38,38,53,52,36,51,50,22,21,
+7,35,55,52,38,2,106,130,146,57,127,136,163,160,76,254,237,243,221,248,20,
+189,25,144,143,164,168,60,139,146,203,173,1,1,210,190,213,4,184,4,121,5,41,
+113,100,72,95,78,50,60,113,147,102,192,219,205,182,61,51,46,52,116,126,126,
+110,73,93,82,53,74,201,159,171,202,189,164,49,47,90,103,0,0,1,0,201,0,0,5,
+4,5,182,0,24,0,0,19,51,17,20,22,51,50,54,53,17,51,17,16,0,35,34,38,39,35,
+22,21,17,33,21,33,201,184,201,180,171,163,184,254,255,253,131,187,69,12,10,
+3,53,252,19,5,182,254,62,179,210,178,190,1,215,254,43,254,250,254,244,102,
+107,150,26,254,176,160,0,0,2,0,31,0,0,4,158,5,182,0,11,0,14,0,0,19,33,21,
+1,1,35,1,1,35,1,1,35,1,1,33,31,4,127,254,127,1,116,204,254,235,254,92,194,
+2,0,254,153,196,2,151,1,29,253,217,5,182,141,253,207,253,213,1,168,253,139,
+2,244,2,35,254,92,1,164,0,1,0,41,255,236,5,184,5,182,0,20,0,0,1,35,21,35,
+17,33,17,16,33,50,54,53,53,51,21,20,0,35,34,0,17,1,168,207,176,2,55,1,76,
+170,170,184,254,238,252,249,254,247,5,23,236,1,139,252,78,254,135,196,179,
+27,21,253,254,225,1,22,1,2,0,1,0,199,0,0,5,98,5,182,0,21,0,0,1,7,7,51,54,
+51,50,22,21,51,21,33,53,52,38,35,32,17,17,35,17,51,1,127,3,5,10,127,219,201,
+213,233,254,95,120,134,254,188,184,184,4,66,74,70,172,228,214,160,164,137,
+141,254,140,253,182,5,182,0,0,1,0,121,255,236,4,145,5,182,0,23,0,0,19,51,
+21,51,32,0,17,20,2,4,35,34,38,39,53,22,51,50,0,53,52,0,35,33,199,176,123,
+1,68,1,91,161,254,206,204,113,177,87,193,155,235,1,15,254,249,243,254,242,
+5,182,162,254,165,254,198,197,254,214,164,26,33,160,58,1,12,230,238,1,6,0,
+0,1,0,117,0,0,4,168,5,182,0,26,0,0,19,52,54,55,51,6,6,21,20,22,51,50,54,53,
+17,51,17,35,17,52,55,35,6,6,35,34,38,117,53,41,195,43,52,146,149,207,195,
+184,186,10,10,60,228,130,235,236,3,127,84,202,70,66,190,84,159,152,204,234,
+1,168,250,74,1,240,26,117,90,109,234,0,0,1,0,154,0,0,5,0,5,182,0,20,0,0,1,
+38,2,53,17,51,17,20,22,51,50,54,53,17,51,17,20,2,7,17,35,2,113,227,244,184,
+191,192,183,194,182,246,225,184,1,240,24,1,25,231,1,174,254,76,179,196,196,
+181,1,178,254,78,225,254,234,27,254,14,0,3,0,102,255,236,6,84,5,203,0,10,
+0,35,0,45,0,0,1,33,50,54,53,52,38,35,34,6,21,7,52,54,51,50,22,21,20,6,35,
+33,21,33,21,33,21,20,6,35,34,38,53,16,33,51,21,35,34,6,21,20,51,50,54,53,
+3,100,1,9,149,143,138,142,136,141,184,251,218,221,246,248,225,254,233,2,4,
+253,252,203,180,183,200,1,164,162,149,124,114,195,92,100,3,182,90,93,91,99,
+130,126,6,196,226,185,168,164,175,150,160,80,195,226,176,159,1,70,160,80,
+88,174,136,126,0,1,0,86,255,236,4,61,4,74,0,32,0,0,1,21,20,22,23,30,2,21,
+20,4,35,34,36,53,52,55,51,6,21,20,22,51,50,54,53,52,38,39,38,38,53,53,2,160,
+78,96,101,90,48,254,239,230,232,254,248,18,191,23,156,158,145,168,87,103,
+125,92,4,74,51,64,100,68,71,105,126,79,208,246,229,203,78,83,73,90,135,144,
+153,140,71,133,77,92,151,107,43,0,0,2,0,113,255,236,4,104,6,20,0,29,0,40,
+0,0,1,16,0,35,34,38,2,53,16,0,55,54,53,52,38,35,34,38,53,51,20,22,51,50,22,
+21,20,7,22,18,5,20,22,51,50,54,53,52,38,35,32,4,104,254,240,240,149,230,124,
+1,4,239,31,33,39,117,104,160,42,58,90,103,43,175,193,252,195,163,159,157,
+164,165,159,254,193,2,39,254,243,254,210,139,1,4,172,1,7,1,43,5,45,51,31,
+45,124,142,67,57,98,87,74,71,44,254,221,216,207,215,215,207,207,209,0,2,0,
+113,254,20,4,104,4,94,0,36,0,47,0,0,55,16,0,51,50,23,54,53,52,38,35,34,6,
+21,20,23,35,38,53,52,54,51,50,22,21,20,6,7,22,18,21,16,0,35,34,38,2,37,52,
+38,35,34,6,21,20,22,51,32,113,1,17,239,33,67,39,77,79,78,73,8,180,9,171,161,
+160,176,30,31,118,127,254,243,241,151,229,125,3,61,163,158,157,165,165,159,
+1,63,76,1,12,1,47,8,72,84,75,97,81,65,47,43,42,40,150,155,169,158,50,114,
+45,69,254,250,175,254,245,254,211,135,1,3,174,207,215,214,208,207,209,0,0,
+2,0,115,254,20,6,90,4,94,0,11,0,58,0,0,1,20,22,51,50,54,53,52,38,35,34,6,
+5,16,18,51,50,23,51,54,54,51,50,18,17,16,2,35,34,2,17,53,52,38,35,34,6,21,
+20,22,22,23,30,2,23,7,38,38,35,34,6,7,39,54,54,55,38,2,3,193,118,123,121,
+123,126,110,135,114,252,178,220,200,250,79,10,49,157,124,199,223,213,207,
+212,214,109,124,120,132,89,187,154,133,175,112,53,143,58,241,146,94,151,103,
+63,60,106,92,172,170,2,49,217,213,219,209,199,211,185,227,1,8,1,41,211,110,
+101,254,214,254,249,254,231,254,216,1,39,1,32,80,157,169,215,197,185,234,
+167,49,43,90,106,95,80,116,138,40,54,146,29,36,19,100,1,68,0,1,0,86,254,20,
+4,68,4,94,0,36,0,0,1,34,38,53,52,55,51,6,6,21,20,22,51,50,54,53,17,52,38,
+35,34,6,21,20,23,35,38,53,52,54,54,51,32,17,17,16,2,2,72,247,251,25,184,13,
+16,157,163,173,152,152,175,125,140,5,177,6,113,206,132,1,244,253,254,20,242,
+232,100,70,27,100,41,163,161,226,247,1,109,249,220,155,136,50,28,42,40,126,
+203,109,253,148,254,151,254,196,254,199,0,1,0,66,254,20,4,27,4,94,0,46,0,
+0,1,50,54,53,16,33,35,53,51,50,54,53,52,38,35,34,21,23,7,38,53,52,54,51,50,
+22,21,20,6,7,22,22,21,20,0,35,34,38,53,52,55,51,6,6,21,20,22,2,35,151,166,
+254,123,139,139,163,173,132,126,252,4,176,6,230,202,205,231,129,135,153,171,
+254,234,234,230,243,20,184,10,14,154,254,172,179,159,1,65,152,130,122,118,
+128,215,45,2,42,15,163,191,198,172,135,169,41,39,212,150,227,254,245,219,
+207,69,56,22,71,29,138,139,0,0,3,255,215,255,236,4,152,6,31,0,25,0,37,0,47,
+0,0,1,16,0,35,34,38,2,53,52,55,38,38,53,52,54,51,50,22,21,20,7,54,51,50,22,
+18,5,20,22,51,50,54,53,52,38,35,34,6,39,50,54,53,52,35,34,21,20,22,4,152,
+254,240,240,149,230,125,86,137,150,181,157,153,185,21,34,38,145,223,122,252,
+194,163,159,157,164,166,157,162,158,49,79,87,166,166,86,2,39,254,243,254,
+210,138,1,3,174,184,139,15,184,152,156,186,179,149,64,61,4,138,254,254,171,
+207,215,215,207,207,209,205,248,108,105,200,200,104,109,0,0,2,0,115,255,236,
+6,90,4,94,0,11,0,44,0,0,1,52,38,35,34,6,21,20,22,51,50,54,55,16,2,35,34,2,
+17,16,18,51,50,22,23,51,54,54,51,50,18,17,20,2,7,35,54,18,53,52,38,35,34,
+6,21,3,12,105,132,119,129,123,121,124,117,181,214,212,208,212,219,203,123,
+160,46,11,45,161,123,199,221,63,68,184,70,65,132,120,120,113,2,49,218,190,
+213,197,209,219,215,217,254,224,254,217,1,38,1,27,1,6,1,43,98,113,110,101,
+254,218,254,253,155,254,248,146,147,1,8,156,188,214,162,164,0,1,0,113,0,0,
+4,104,4,94,0,23,0,0,19,16,0,51,50,0,17,20,2,7,35,54,17,52,38,35,34,6,21,16,
+23,35,38,2,113,1,14,240,232,1,17,83,68,193,158,166,158,157,162,158,193,65,
+86,2,37,1,12,1,45,254,207,254,250,156,254,212,95,232,1,61,207,211,211,207,
+254,195,232,91,1,41,0,1,0,25,254,20,3,242,4,94,0,43,0,0,1,54,51,50,22,21,
+20,6,7,22,22,21,20,0,35,34,38,53,52,55,51,6,6,21,20,22,51,50,54,53,52,38,
+35,35,53,51,50,54,53,52,38,35,34,7,1,176,51,31,208,239,129,132,150,160,254,
+234,234,230,243,20,184,10,14,154,147,151,166,194,178,19,21,153,174,139,129,
+43,37,4,88,6,201,169,140,168,41,38,206,153,227,254,245,219,207,69,56,22,71,
+29,138,139,179,159,155,166,152,134,118,115,131,6,0,1,0,115,254,20,8,123,4,
+94,0,67,0,0,1,38,36,35,34,6,7,39,54,55,36,17,16,18,51,50,22,23,51,54,51,50,
+22,23,51,54,54,51,32,17,20,2,7,35,54,54,53,52,38,35,34,6,21,21,35,53,52,38,
+35,34,6,21,21,35,53,52,38,35,34,6,21,20,22,4,23,22,4,23,5,244,134,254,183,
+195,128,220,69,101,100,177,254,2,203,202,105,156,42,11,68,241,112,162,35,
+10,41,157,107,1,148,61,70,185,77,59,109,123,98,121,172,124,101,101,124,173,
+119,98,118,115,172,1,108,113,221,1,78,137,254,20,147,136,75,68,119,89,48,
+223,1,201,1,7,1,15,97,93,190,92,98,91,99,253,209,152,255,0,151,162,253,144,
+210,200,181,141,92,88,142,184,185,141,88,92,139,183,180,195,180,253,210,8,
+14,152,158,0,0,2,0,111,255,236,4,92,6,31,0,10,0,38,0,0,37,50,54,53,16,33,
+34,6,21,20,22,19,34,6,21,23,7,38,53,52,54,54,51,50,0,17,16,0,33,34,2,17,16,
+18,51,50,23,51,2,2,94,145,167,254,196,148,157,154,151,103,120,4,178,6,104,
+186,119,240,1,12,254,253,254,245,225,254,244,216,235,103,11,61,129,227,199,
+1,156,211,205,205,217,5,6,96,84,37,2,36,15,88,148,84,254,92,254,123,254,121,
+254,125,1,43,1,14,1,13,1,42,155,1,198,0,0,2,0,123,255,236,4,115,6,20,0,11,
+0,34,0,0,1,34,6,21,20,22,51,50,54,53,52,38,3,34,6,7,51,54,54,51,50,18,17,
+16,0,35,34,38,2,53,16,0,33,33,21,2,121,158,166,164,156,160,163,161,103,164,
+180,33,11,61,162,114,228,252,254,245,245,186,216,102,1,17,1,12,1,100,3,199,
+203,195,216,224,213,209,205,211,1,182,210,243,86,78,254,214,254,243,254,236,
+254,219,155,1,70,244,1,165,1,174,151,0,0,1,0,115,0,0,6,90,4,94,0,41,0,0,1,
+50,18,17,20,2,7,35,54,18,53,52,38,35,34,6,21,21,35,53,52,38,35,34,6,21,20,
+18,23,35,38,2,53,16,18,51,50,22,23,51,54,54,4,182,199,221,63,68,184,70,65,
+135,117,113,125,172,123,118,118,130,67,68,184,69,62,225,197,126,161,42,11,
+45,161,4,94,254,218,254,253,155,254,248,146,147,1,8,156,198,204,151,138,135,
+135,139,150,204,198,163,254,247,139,143,1,11,155,1,6,1,35,104,107,110,101,
+0,0,1,0,106,255,236,4,68,6,31,0,44,0,0,1,22,22,21,20,4,35,34,38,53,52,55,
+51,6,6,21,20,22,51,50,54,53,16,33,35,53,51,50,54,53,52,39,39,38,39,55,22,
+22,23,23,22,22,21,20,6,3,0,156,168,254,238,238,230,244,21,184,9,15,154,147,
+152,165,254,123,139,139,163,173,213,54,195,118,86,45,108,77,110,160,174,129,
+3,10,36,191,131,199,241,218,208,65,59,19,73,30,138,139,156,133,1,18,152,130,
+122,206,17,4,15,87,140,38,39,8,14,21,174,151,136,167,0,1,0,86,254,20,4,82,
+4,74,0,42,0,0,1,5,22,22,21,20,6,35,32,17,55,51,6,21,20,22,51,50,54,53,52,
+39,53,37,51,17,20,2,35,34,38,53,52,55,51,6,21,20,22,51,50,54,53,3,158,254,
+198,50,55,173,145,254,199,4,168,4,76,69,70,80,146,2,25,166,252,246,225,246,
+21,182,23,152,143,170,144,3,182,82,38,114,69,138,169,1,59,58,19,41,82,92,
+92,82,153,21,129,142,251,209,255,254,248,212,200,75,73,75,73,130,130,177,
+196,0,0,1,0,115,0,0,6,90,6,41,0,49,0,0,1,54,51,50,23,51,54,54,51,50,18,17,
+20,2,7,35,54,18,53,52,38,35,34,6,21,21,35,53,52,38,35,34,6,21,20,18,23,35,
+38,38,53,16,18,36,36,37,23,4,4,7,1,176,44,61,248,81,11,45,162,122,197,223,
+63,68,184,70,65,131,121,113,125,172,123,118,114,134,67,68,184,72,59,135,1,
+11,1,164,1,38,20,254,237,254,92,124,4,80,14,211,111,100,254,218,254,253,155,
+254,248,146,147,1,8,156,192,210,151,138,135,135,139,150,200,202,163,254,247,
+139,150,253,146,1,5,1,95,238,148,30,156,20,159,130,0,1,0,162,255,236,4,121,
+6,20,0,17,0,0,1,16,0,35,32,17,17,51,17,16,33,32,17,16,39,51,22,18,4,121,254,
+251,255,254,45,180,1,45,1,64,226,205,90,113,2,61,254,219,254,212,2,6,4,34,
+251,228,254,135,1,195,1,9,255,98,254,232,0,2,0,113,254,20,5,180,6,20,0,16,
+0,31,0,0,1,20,2,4,35,32,0,17,52,18,36,55,17,51,17,4,0,5,17,6,2,17,16,18,51,
+50,18,17,16,2,39,17,5,180,163,254,206,205,254,188,254,163,137,1,8,182,181,
+1,18,1,53,253,4,194,203,252,235,236,252,203,194,1,59,249,254,147,193,1,167,
+1,130,222,1,89,208,20,1,188,254,70,29,254,94,178,1,213,31,254,180,254,232,
+254,196,254,173,1,81,1,62,1,26,1,77,31,254,40,0,1,0,31,254,20,4,47,4,94,0,
+43,0,0,19,50,23,51,54,51,50,22,21,17,20,2,35,34,2,53,52,55,51,6,21,20,22,
+51,50,54,53,17,16,35,34,6,21,21,35,53,52,38,35,34,6,7,39,54,219,199,59,8,
+71,194,150,171,251,247,228,243,21,182,22,151,144,168,145,162,76,88,172,87,
+81,38,77,18,61,66,4,94,190,190,224,212,253,113,254,254,247,1,4,236,107,71,
+70,108,171,173,174,199,2,137,1,31,152,139,51,47,143,152,18,11,135,43,0,2,
+0,113,254,20,6,170,4,94,0,52,0,62,0,0,1,20,6,35,34,2,53,52,54,51,50,23,54,
+51,50,22,21,16,5,22,22,21,20,0,33,32,36,53,52,55,51,6,21,20,22,51,32,17,52,
+38,35,35,53,51,50,54,53,52,38,35,34,7,22,5,20,22,51,50,54,53,16,33,32,3,248,
+239,214,205,245,240,216,194,120,126,201,207,230,254,251,155,165,254,203,254,
+221,254,240,254,229,20,185,25,198,187,1,148,191,178,29,29,151,164,132,126,
+154,87,49,253,51,137,131,131,138,254,241,254,246,2,137,222,251,1,0,217,221,
+248,112,112,196,174,254,251,88,40,205,152,236,254,254,207,197,66,53,50,65,
+127,129,1,82,154,167,152,133,119,118,128,80,109,131,161,162,161,162,1,62,
+0,0,1,0,98,254,20,4,49,6,20,0,37,0,0,19,38,53,52,54,51,50,22,23,51,38,53,
+17,51,17,20,2,35,32,17,52,55,51,6,21,16,33,32,17,17,52,38,35,34,6,21,20,23,
+184,20,209,205,97,156,60,12,10,180,247,236,254,20,21,182,22,1,59,1,43,161,
+146,115,121,17,2,29,82,75,202,218,66,83,64,89,1,178,250,7,254,254,247,1,156,
+75,73,71,77,254,252,1,117,2,86,162,176,150,143,69,66,0,0,1,0,115,254,20,6,
+90,4,94,0,55,0,0,19,16,18,51,50,23,51,54,54,51,50,18,17,20,2,7,35,54,18,53,
+52,38,35,34,6,21,21,35,53,52,38,35,34,6,21,20,22,22,23,30,2,23,7,38,38,35,
+34,6,7,39,54,54,55,38,2,115,220,202,250,79,11,45,161,123,196,224,63,68,184,
+70,65,130,122,113,125,172,123,118,120,128,90,191,157,130,170,113,52,143,58,
+241,146,94,151,103,65,59,103,98,172,170,2,45,1,11,1,38,211,110,101,254,217,
+254,254,155,254,248,146,147,1,8,156,190,212,151,138,135,135,139,150,210,202,
+186,234,166,51,42,88,109,93,80,116,138,40,54,146,29,34,21,100,1,68,0,0,1,
+0,113,254,20,4,63,4,74,0,39,0,0,37,20,2,35,34,38,53,52,55,51,6,21,20,22,51,
+50,54,53,53,52,55,35,6,6,35,34,38,53,52,54,55,51,6,21,16,33,32,17,17,51,4,
+63,252,247,227,248,20,182,22,156,141,160,157,11,13,52,183,107,223,227,75,
+66,203,158,1,31,1,65,180,27,255,254,248,218,194,79,69,71,77,130,130,184,189,
+252,83,70,84,86,219,201,117,222,71,161,226,254,219,1,61,1,107,0,0,2,0,100,
+255,236,4,92,6,31,0,10,0,51,0,0,37,50,54,53,16,33,34,6,21,20,22,1,16,0,33,
+34,2,53,52,18,51,50,22,23,51,52,38,38,35,34,6,21,35,52,38,35,34,7,39,54,51,
+50,22,23,51,54,54,51,50,22,22,18,2,94,144,168,254,196,149,156,154,2,153,254,
+253,254,245,226,253,246,214,130,172,47,10,34,72,72,68,78,172,82,76,72,42,
+62,70,102,104,115,27,8,29,115,82,102,134,85,43,129,198,175,1,104,185,179,
+180,189,2,117,254,121,254,125,1,15,245,246,1,14,87,69,201,249,111,153,138,
+144,147,28,135,43,81,89,81,89,96,195,254,207,0,2,0,174,0,0,4,125,6,31,0,32,
+0,41,0,0,19,52,54,51,50,22,21,20,6,35,21,20,7,51,54,54,51,50,22,21,20,6,7,
+35,54,17,16,33,34,6,21,17,35,1,34,6,7,50,54,53,52,38,174,155,165,130,156,
+206,220,10,12,49,180,113,223,228,85,67,192,158,254,225,169,153,180,1,66,76,
+64,2,133,125,61,4,115,209,219,141,113,145,146,96,90,64,80,90,248,229,134,
+252,79,190,1,5,1,86,174,197,254,90,5,139,114,144,72,80,47,59,0,1,0,123,254,
+20,4,199,4,115,0,51,0,0,1,20,6,7,22,22,21,20,0,35,34,38,2,17,52,18,55,51,
+6,2,21,20,18,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,46,2,39,46,2,39,
+55,22,22,23,22,22,4,150,132,129,149,161,254,230,247,212,243,116,102,82,180,
+80,104,73,163,157,162,178,192,180,60,62,153,174,33,59,82,49,46,60,39,23,86,
+18,75,77,172,144,2,211,141,169,38,38,197,152,222,254,254,155,1,81,1,27,234,
+1,194,131,132,254,62,229,242,254,245,118,168,158,148,161,151,134,118,58,72,
+46,27,14,13,27,27,26,131,23,36,23,51,150,0,2,0,113,255,236,4,61,6,20,0,11,
+0,27,0,0,37,50,54,53,53,52,38,35,34,6,21,16,1,17,16,33,34,2,17,16,18,51,50,
+23,51,38,53,17,2,88,157,148,144,165,146,151,3,18,254,11,228,243,237,215,229,
+111,10,10,129,208,208,10,224,188,208,208,254,90,5,147,252,19,253,197,1,36,
+1,21,1,13,1,42,164,113,113,1,122,0,0,2,0,123,255,236,4,115,6,31,0,10,0,51,
+0,0,37,50,54,53,52,38,35,32,17,20,22,1,52,18,54,54,51,50,22,23,51,54,54,51,
+50,23,7,38,35,34,6,21,35,52,38,35,34,6,6,21,51,54,54,51,50,18,21,20,2,35,
+32,0,2,121,155,154,156,149,254,197,166,254,147,43,84,134,103,82,115,29,8,
+27,114,105,102,70,62,42,72,76,82,172,77,69,72,72,34,10,47,172,130,215,245,
+252,227,254,245,254,253,129,189,180,178,186,254,152,173,200,2,117,212,1,49,
+195,97,89,81,89,81,43,135,28,147,144,136,155,111,251,199,69,87,254,241,245,
+245,254,241,1,131,0,0,2,0,86,254,20,4,61,6,20,0,52,0,64,0,0,1,52,55,35,6,
+35,34,38,53,52,54,51,50,23,51,38,53,17,51,17,33,21,33,17,20,22,23,22,22,21,
+20,4,35,34,36,53,52,55,51,6,21,20,22,51,50,54,53,52,38,39,38,38,53,1,20,22,
+51,50,54,53,52,38,35,34,6,2,82,12,12,64,110,130,161,160,131,111,63,12,12,
+180,1,21,254,235,43,78,107,83,254,238,229,232,254,248,18,191,23,156,158,140,
+173,66,79,92,68,254,219,76,69,72,76,78,70,68,77,1,211,104,52,64,161,122,126,
+150,63,52,103,1,90,253,125,151,254,215,67,74,60,83,159,106,186,222,210,188,
+87,75,75,89,118,126,134,110,69,109,65,76,126,93,1,142,67,77,77,67,66,73,73,
+0,0,2,0,164,255,236,4,113,6,20,0,12,0,29,0,0,37,50,54,53,52,38,35,34,6,21,
+21,20,22,3,17,20,7,51,54,51,50,18,17,16,2,35,34,2,17,17,2,137,151,150,151,
+146,163,146,148,148,10,10,111,229,215,238,252,238,241,242,129,215,207,205,
+211,192,220,10,214,202,5,147,254,134,113,113,164,254,214,254,243,254,232,
+254,223,1,23,1,36,3,237,0,0,1,0,86,254,20,4,61,4,74,0,41,0,0,1,37,21,20,22,
+23,30,2,21,20,4,35,34,36,53,52,55,51,6,21,20,22,51,50,54,53,52,38,38,39,38,
+38,53,53,37,55,5,17,51,17,5,3,193,254,223,76,98,96,93,50,254,238,229,232,
+254,248,18,191,23,156,158,140,173,37,72,81,131,86,254,167,60,1,29,180,1,88,
+1,217,119,127,56,84,61,61,98,116,73,186,222,210,188,77,85,75,89,118,126,134,
+110,46,76,70,51,86,121,88,224,141,133,119,1,21,254,162,144,0,0,1,0,98,255,
+236,4,59,6,41,0,58,0,0,1,20,6,7,22,21,20,6,7,30,2,21,20,4,35,34,38,53,52,
+55,51,6,6,21,20,22,51,50,54,53,52,38,35,35,53,51,32,53,52,38,35,35,53,51,
+32,53,52,38,39,38,38,39,55,22,22,23,23,4,4,10,110,123,243,113,97,90,109,50,
+254,239,239,229,244,21,184,9,15,154,147,159,158,172,184,47,47,1,67,143,180,
+47,47,1,57,142,135,105,143,65,86,44,104,82,54,1,144,4,207,105,110,27,44,197,
+85,120,19,16,58,86,75,141,168,176,170,66,59,20,71,32,97,100,88,72,79,70,160,
+145,90,70,152,162,64,58,3,1,45,48,139,37,39,4,3,22,0,1,0,164,255,236,4,197,
+6,41,0,56,0,0,5,32,36,17,17,51,17,20,22,22,51,50,54,53,52,38,35,35,53,51,
+32,53,52,38,35,35,53,51,32,53,52,38,39,38,38,39,55,22,22,23,23,22,22,21,20,
+6,7,22,21,20,6,7,22,22,21,20,4,2,197,254,227,254,252,180,70,156,147,159,158,
+172,184,47,47,1,67,143,180,47,47,1,57,77,80,103,110,46,87,31,84,64,74,131,
+125,107,126,244,114,97,126,124,254,239,20,248,1,14,4,34,251,240,150,164,71,
+88,72,79,70,160,145,90,70,152,162,58,56,8,8,45,44,139,36,37,6,9,20,124,114,
+92,124,26,45,196,86,119,19,21,114,100,140,169,0,2,0,41,255,78,4,184,4,92,
+0,21,0,33,0,0,1,20,2,7,22,23,7,36,39,6,5,39,54,55,38,2,53,52,0,51,50,0,5,
+20,22,23,54,54,53,52,38,35,34,6,4,113,177,167,192,223,43,254,211,239,242,
+254,213,43,220,196,168,176,1,20,236,234,1,22,252,184,164,164,164,163,169,
+158,160,168,2,121,152,254,239,112,77,39,158,63,115,116,62,158,38,78,113,1,
+17,151,224,1,3,254,252,223,127,232,96,97,232,126,163,169,169,0,0,1,0,57,254,
+20,4,18,4,74,0,38,0,0,19,33,21,20,6,6,7,22,22,21,20,0,35,34,38,53,52,55,51,
+6,6,21,20,22,51,50,54,53,52,38,35,35,53,50,54,53,33,21,35,139,3,35,51,97,
+102,168,182,254,236,236,229,244,21,184,10,14,154,147,152,165,205,196,115,
+215,207,254,69,180,4,74,131,123,174,120,54,47,237,173,245,254,226,246,234,
+74,67,24,85,34,162,164,201,172,173,181,152,197,210,127,0,1,0,66,254,20,4,
+27,6,31,0,53,0,0,1,20,6,7,22,22,21,20,0,35,34,38,53,52,55,51,6,6,21,20,22,
+51,50,54,53,16,33,35,53,51,50,54,53,52,39,36,17,52,54,51,50,23,7,38,35,34,
+6,21,20,22,22,23,22,22,3,223,129,135,153,171,254,234,234,230,243,20,184,10,
+14,154,147,151,166,254,123,139,139,163,173,227,254,180,185,155,154,137,62,
+124,103,84,86,35,79,68,185,200,2,236,135,169,41,39,212,150,227,254,245,219,
+207,69,56,22,71,29,138,139,179,159,1,65,152,130,122,225,21,26,1,25,136,155,
+74,143,69,71,62,64,62,36,6,17,189,0,0,3,0,113,255,236,4,252,6,31,0,10,0,40,
+0,50,0,0,1,33,34,6,21,20,22,51,50,54,53,19,51,21,35,21,20,6,35,34,38,53,52,
+54,51,33,53,33,34,38,53,52,54,51,50,22,21,21,51,21,35,39,52,38,35,34,6,21,
+20,51,33,3,98,254,195,119,131,148,141,134,144,181,229,229,245,222,221,246,
+237,219,1,41,254,174,189,198,239,214,217,236,229,229,181,134,142,127,135,
+215,1,67,2,37,103,100,99,116,164,145,1,4,151,105,217,247,193,175,168,184,
+191,172,158,160,186,223,226,76,151,227,139,158,97,95,181,0,0,3,0,113,254,
+20,7,86,4,94,0,9,0,21,0,52,0,0,1,32,17,20,22,51,50,54,53,16,33,34,6,21,20,
+22,51,50,54,53,52,38,1,52,55,35,6,35,34,2,17,16,18,51,32,19,54,54,51,50,18,
+17,16,2,35,34,39,35,23,22,21,17,35,2,88,254,211,145,152,165,144,1,225,144,
+159,149,169,139,152,155,253,136,10,10,107,233,215,237,253,236,1,25,114,58,
+206,132,235,250,237,216,222,118,12,4,8,180,3,201,254,90,209,207,189,223,1,
+170,224,202,223,191,221,205,204,210,251,231,112,113,163,1,42,1,13,1,20,1,
+37,255,0,132,124,254,222,254,235,254,243,254,210,161,35,75,105,254,94,0,0,
+1,0,49,254,20,4,35,4,94,0,46,0,0,5,52,38,39,51,22,21,20,4,35,34,36,53,52,
+54,54,55,54,54,53,52,38,35,34,21,23,35,38,53,52,54,51,50,22,21,20,6,7,14,
+2,21,20,22,51,50,54,3,104,14,10,190,21,254,238,236,238,254,250,89,182,202,
+139,115,115,106,227,4,178,4,218,187,187,219,188,198,132,144,63,159,154,151,
+172,23,31,72,20,59,66,215,252,235,214,110,166,138,90,60,137,108,91,110,213,
+47,28,29,163,191,191,163,156,216,85,59,99,109,81,144,155,172,0,0,1,0,174,
+254,20,4,125,4,74,0,39,0,0,19,51,17,16,33,32,17,52,39,51,22,22,21,20,6,35,
+34,38,39,35,22,21,21,20,22,51,50,54,53,52,39,51,22,21,20,6,35,34,2,17,174,
+180,1,66,1,31,158,203,62,79,228,223,107,183,52,12,10,158,160,140,157,23,182,
+21,249,226,246,254,4,74,254,149,254,195,1,37,223,164,66,222,122,201,219,87,
+83,64,89,252,189,184,130,130,79,69,73,75,195,217,1,6,1,1,0,2,0,113,254,20,
+4,104,4,94,0,35,0,46,0,0,1,16,0,35,34,39,6,21,20,22,51,50,54,53,52,39,51,
+22,21,20,6,35,34,38,53,52,54,55,38,38,53,16,0,51,50,0,1,20,22,51,50,54,53,
+52,38,35,32,4,104,254,240,240,33,67,39,77,79,78,73,8,180,9,170,162,161,175,
+30,31,112,133,1,12,242,232,1,17,252,195,163,159,157,164,165,159,254,193,2,
+39,254,243,254,210,8,76,80,75,97,80,65,48,43,31,51,149,157,171,157,50,114,
+45,66,255,185,1,12,1,43,254,207,254,250,207,215,215,207,207,209,0,0,1,0,113,
+255,12,4,104,4,94,0,35,0,0,55,54,55,38,38,53,52,54,54,51,50,4,21,20,7,35,
+54,54,53,52,38,35,34,6,21,20,22,23,22,22,23,7,38,35,34,7,143,96,123,119,130,
+126,232,154,244,1,3,20,184,10,14,171,154,149,175,190,183,152,227,69,147,117,
+254,199,196,27,54,36,68,244,159,153,243,134,245,232,87,62,24,90,39,155,167,
+204,177,193,227,14,13,168,143,72,244,115,0,3,0,147,255,227,3,197,4,102,0,
+11,0,22,0,34,0,0,55,52,54,51,50,22,21,20,6,35,34,38,17,52,51,50,22,21,20,
+6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,147,64,63,61,66,68,59,61,66,
+127,63,64,68,59,61,66,2,52,66,61,61,66,68,59,59,68,111,66,73,72,67,67,73,
+74,3,174,139,72,67,66,73,74,254,139,70,69,72,67,66,73,70,0,2,0,98,3,133,3,
+12,7,76,0,10,0,32,0,0,1,34,6,21,20,22,51,50,53,52,38,3,34,6,7,54,54,51,50,
+22,21,20,6,35,34,38,38,53,16,18,51,51,21,1,184,87,103,97,91,191,103,51,96,
+112,21,32,97,82,152,171,179,165,124,141,73,183,178,243,5,205,110,113,116,
+126,231,120,114,1,8,113,123,39,47,181,169,169,179,91,194,155,1,1,1,14,119,
+0,0,1,0,20,255,233,4,4,4,74,0,18,0,0,1,21,33,17,20,22,51,50,55,21,6,6,35,
+34,38,53,17,33,53,4,4,254,41,113,137,129,92,42,134,59,223,193,254,155,4,74,
+152,253,158,117,96,22,135,15,18,164,176,2,117,152,0,1,0,162,254,20,4,180,
+4,74,0,40,0,0,37,6,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,51,17,20,30,
+2,21,20,4,33,32,39,53,22,22,51,50,54,53,52,46,2,39,3,156,52,193,118,198,201,
+182,119,125,169,154,181,35,42,35,254,220,254,251,254,229,167,78,218,121,197,
+209,22,30,31,9,166,91,95,190,209,2,207,253,61,133,129,188,209,2,60,252,233,
+59,95,93,99,63,185,205,70,168,40,46,123,115,44,70,61,59,34,0,1,0,20,254,20,
+5,25,4,94,0,47,0,0,1,20,30,2,21,20,4,35,34,39,53,22,33,50,54,53,52,46,2,53,
+17,52,38,35,34,6,21,17,35,17,52,38,35,35,53,51,50,22,23,51,54,54,51,50,22,
+21,4,168,35,43,35,254,232,255,251,165,181,1,0,148,185,35,42,35,117,127,169,
+153,180,46,54,146,185,114,108,11,11,52,183,111,202,195,1,51,59,89,85,93,63,
+197,213,70,168,86,144,114,51,87,88,97,60,1,145,134,131,187,211,253,199,3,
+74,59,45,152,68,82,82,88,197,206,0,2,0,113,255,236,4,104,6,20,0,25,0,37,0,
+0,19,53,33,21,33,21,20,22,22,23,22,22,21,20,0,35,34,0,53,52,18,55,38,38,53,
+53,19,4,17,20,22,51,50,54,53,52,39,38,170,3,133,254,133,26,57,91,137,125,
+254,237,237,228,254,237,239,219,32,27,145,254,156,170,145,157,169,194,56,
+5,125,151,151,21,116,138,95,70,105,237,140,236,254,245,1,18,238,192,1,23,
+71,63,165,122,21,254,25,111,254,192,159,199,174,178,204,155,43,0,0,1,0,20,
+254,20,4,252,4,94,0,32,0,0,5,20,22,23,35,38,17,17,52,38,35,34,6,21,17,35,
+17,52,38,35,35,53,51,50,22,23,51,54,54,51,50,22,21,4,168,46,38,184,80,117,
+127,169,153,180,46,54,146,185,114,108,11,11,52,183,111,202,195,53,128,234,
+77,168,1,9,2,249,134,131,187,211,253,199,3,74,59,45,152,68,82,82,88,197,206,
+0,0,1,255,184,254,20,6,213,4,94,0,47,0,0,1,52,38,35,34,6,21,17,35,17,52,38,
+35,35,53,51,50,22,23,51,54,54,51,32,23,51,54,54,51,50,22,21,17,35,17,52,38,
+35,34,6,21,17,20,22,23,35,38,17,3,104,109,116,152,141,180,46,54,146,207,100,
+100,11,10,47,171,106,1,2,78,10,53,183,116,186,185,180,107,114,153,144,45,
+41,185,80,2,195,130,130,186,212,253,199,3,74,59,45,152,70,80,80,90,184,88,
+96,192,211,253,53,2,195,130,130,178,183,253,109,119,237,83,172,1,5,0,2,255,
+195,255,236,4,133,6,20,0,24,0,37,0,0,3,51,50,22,21,21,20,7,51,54,51,50,18,
+17,16,2,35,34,2,17,17,52,38,35,35,1,50,54,53,52,38,35,34,6,21,21,20,22,61,
+180,134,112,11,11,111,229,215,237,250,239,245,239,46,54,145,2,219,148,153,
+152,145,163,146,148,6,20,98,129,151,101,125,164,254,214,254,243,254,233,254,
+222,1,28,1,31,2,237,59,46,251,4,212,210,206,210,192,220,10,214,202,0,0,2,
+0,174,255,236,6,213,4,94,0,33,0,47,0,0,19,51,23,51,54,54,51,32,23,51,54,54,
+51,50,22,21,17,35,17,16,35,34,6,21,17,35,39,35,6,6,35,34,38,53,55,20,22,51,
+50,54,53,53,52,38,35,34,6,21,174,145,27,10,47,171,106,1,2,78,10,53,183,116,
+186,185,178,223,153,144,144,28,9,45,168,112,185,186,180,109,115,153,141,109,
+116,152,141,4,74,150,80,90,184,88,96,192,211,253,53,2,195,1,4,178,183,253,
+162,145,77,88,190,209,12,133,129,188,209,181,130,130,186,212,0,1,0,20,0,0,
+3,39,4,74,0,9,0,0,19,53,33,32,17,17,35,17,52,35,20,1,162,1,113,180,219,3,
+178,152,254,159,253,23,2,233,201,0,0,2,0,166,254,20,4,152,6,20,0,28,0,42,
+0,0,5,20,22,23,35,38,17,53,52,55,35,6,6,35,34,38,53,17,51,17,20,7,51,54,54,
+51,50,22,21,7,52,38,35,34,6,21,21,20,22,51,50,54,53,4,68,42,42,185,80,13,
+15,50,178,118,198,199,180,10,12,49,180,113,199,203,181,116,127,167,155,119,
+125,169,152,53,121,231,87,172,1,5,53,55,96,79,86,190,209,4,153,254,56,90,
+64,80,90,191,210,13,134,131,186,214,176,133,129,188,209,0,0,2,0,174,255,236,
+6,213,4,94,0,13,0,48,0,0,1,52,38,35,34,6,21,21,20,22,51,50,54,53,19,39,35,
+6,6,35,34,38,53,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,51,32,23,51,54,
+54,51,50,22,21,17,6,33,107,114,153,144,108,115,153,142,37,29,8,48,169,109,
+185,186,109,116,152,141,180,145,27,10,47,171,106,1,2,78,10,53,183,116,186,
+185,2,195,130,130,178,183,215,133,129,187,210,253,242,145,80,85,190,209,1,
+72,130,130,186,212,253,199,4,74,150,80,90,184,88,96,192,211,253,53,0,0,2,
+0,113,255,236,5,0,6,20,0,10,0,32,0,0,37,50,54,53,17,33,34,6,6,21,16,1,21,
+35,17,16,33,34,2,17,16,18,33,33,53,52,35,33,53,33,32,17,21,2,88,157,148,254,
+242,131,143,62,3,213,195,254,11,228,243,248,1,16,1,16,219,254,125,1,162,1,
+112,129,203,205,1,153,77,169,159,254,100,3,201,152,254,117,253,197,1,32,1,
+15,1,36,1,11,106,201,151,254,160,106,0,1,0,174,0,0,4,76,6,20,0,30,0,0,1,20,
+7,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,54,51,33,21,
+33,34,6,21,1,98,10,12,49,180,113,200,202,178,119,127,167,155,180,209,223,
+1,199,254,72,150,117,4,76,90,64,80,90,191,210,253,53,2,190,134,131,186,214,
+253,201,4,94,228,210,151,122,144,0,0,1,0,166,255,236,6,205,4,74,0,34,0,0,
+1,17,16,51,50,54,53,17,51,17,20,22,51,50,54,53,17,51,17,35,39,35,6,6,35,32,
+39,35,6,6,35,34,38,53,17,1,88,223,152,145,178,110,116,152,141,180,146,26,
+10,50,170,104,254,254,78,10,53,183,116,186,185,4,74,253,61,254,252,175,186,
+2,94,253,61,130,130,187,210,2,58,251,182,150,83,87,184,88,96,191,212,2,203,
+0,0,1,0,20,255,236,4,172,4,74,0,28,0,0,1,20,22,51,50,54,53,17,51,17,35,39,
+35,6,6,35,34,38,53,17,52,38,35,35,53,51,50,22,21,1,193,118,125,170,154,180,
+147,27,8,49,181,118,199,201,46,54,146,183,135,111,1,135,133,129,187,210,2,
+60,251,182,145,77,88,190,209,1,207,59,45,152,100,128,0,1,0,20,254,20,5,0,
+4,74,0,35,0,0,5,20,22,23,35,38,17,53,52,55,35,6,6,35,34,38,53,17,52,38,35,
+35,53,51,50,22,21,17,20,22,51,50,54,53,17,51,4,172,46,38,184,80,12,14,49,
+181,118,199,201,46,54,146,183,135,111,118,125,170,154,180,53,128,234,77,168,
+1,9,53,62,89,77,88,190,209,1,207,59,45,152,100,128,254,33,133,129,187,210,
+2,60,0,0,1,0,164,255,236,6,209,6,20,0,38,0,0,33,39,35,6,6,35,34,38,53,17,
+51,17,16,51,50,54,53,17,51,17,20,7,51,54,54,51,50,22,21,17,35,17,52,38,35,
+34,6,21,17,3,131,29,8,45,168,112,185,188,180,225,153,142,180,10,13,46,174,
+107,183,188,180,108,116,154,143,145,77,88,190,209,2,207,253,61,254,250,187,
+210,4,6,254,58,90,64,80,90,192,211,253,53,2,190,134,131,191,207,253,199,0,
+1,0,162,255,236,4,68,6,20,0,20,0,0,1,17,20,22,51,50,54,53,17,51,17,35,39,
+35,6,6,35,34,38,53,17,1,88,119,125,169,154,181,148,26,9,49,180,119,198,201,
+6,20,251,115,133,129,188,209,2,60,251,182,145,79,86,190,209,4,153,0,0,2,0,
+162,254,20,4,102,4,94,0,26,0,38,0,0,1,50,55,21,6,35,34,38,17,17,16,18,51,
+50,0,17,16,2,35,34,39,35,23,22,21,20,22,19,50,54,53,52,38,35,34,6,21,20,22,
+2,131,227,179,165,247,246,229,251,238,219,1,0,246,218,199,119,12,3,7,149,
+156,155,140,141,158,153,148,146,254,170,86,166,70,241,1,5,2,8,1,31,1,45,254,
+208,254,247,254,245,254,210,159,41,80,59,158,143,1,215,212,208,210,208,202,
+204,235,197,0,1,0,166,254,20,7,33,6,20,0,41,0,0,33,52,55,35,6,6,35,32,39,
+35,6,6,35,34,38,53,17,51,17,16,51,50,54,53,17,51,17,20,22,51,50,54,53,17,
+51,17,20,22,23,35,38,17,6,25,8,10,50,170,104,254,254,78,10,53,183,116,186,
+185,178,223,152,145,178,110,116,152,141,180,46,38,185,79,49,101,83,87,184,
+88,96,191,212,2,203,253,61,254,252,175,186,2,94,253,61,130,130,187,210,4,
+4,249,183,128,234,77,170,1,7,0,0,3,0,113,254,20,7,86,4,94,0,9,0,21,0,54,0,
+0,1,32,17,20,22,51,50,54,53,16,33,34,6,21,20,22,51,50,54,53,52,38,1,52,55,
+35,6,35,34,2,17,16,18,51,32,19,54,54,51,50,18,17,16,2,35,34,39,35,23,22,21,
+20,23,35,38,2,88,254,211,145,152,165,144,1,225,144,159,149,169,139,152,155,
+253,136,10,10,107,233,215,237,253,236,1,25,114,58,206,132,235,250,237,216,
+222,118,12,4,8,84,184,80,3,201,254,90,209,207,189,223,1,170,224,202,223,191,
+221,205,204,210,251,231,112,113,163,1,42,1,13,1,20,1,37,255,0,132,124,254,
+222,254,235,254,243,254,210,161,35,75,105,246,172,172,0,1,0,41,0,0,3,164,
+6,20,0,11,0,0,1,17,33,21,33,17,35,17,33,53,33,17,2,63,1,101,254,155,180,254,
+158,1,98,6,20,254,54,152,252,78,3,178,152,1,202,0,0,1,0,20,0,0,4,168,4,94,
+0,27,0,0,1,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,
+35,53,51,50,22,23,1,193,52,183,111,202,195,178,119,127,169,153,180,46,54,
+146,185,114,108,11,3,180,82,88,197,206,253,53,2,190,134,131,187,211,253,199,
+3,74,59,45,152,68,82,0,0,1,0,162,254,20,4,152,4,74,0,27,0,0,5,20,22,23,35,
+38,17,53,52,55,35,6,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,51,4,68,42,
+42,185,80,13,15,49,180,119,198,201,182,119,125,169,154,181,53,121,231,87,
+172,1,5,53,55,96,79,86,190,209,2,207,253,61,133,129,188,209,2,60,0,0,1,0,
+162,254,20,4,68,4,74,0,33,0,0,37,20,6,35,34,39,53,22,51,50,54,61,2,52,55,
+35,6,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,51,4,68,240,252,234,161,
+160,245,147,152,9,9,49,180,119,198,201,182,119,125,169,154,181,2,251,243,
+70,166,86,158,144,7,33,62,83,79,86,190,209,2,207,253,61,133,129,188,209,2,
+60,0,1,0,174,254,20,4,76,6,20,0,27,0,0,19,51,17,20,7,51,54,54,51,50,22,21,
+17,35,17,52,38,35,34,6,21,17,20,22,23,35,38,17,174,180,10,12,49,180,113,200,
+202,178,119,127,167,155,46,38,184,80,6,20,254,56,90,64,80,90,191,210,253,
+53,2,190,134,131,186,214,253,148,128,234,77,172,1,5,0,1,0,174,254,20,4,76,
+4,94,0,30,0,0,19,51,23,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,
+20,22,51,50,54,55,21,6,33,32,17,174,145,27,10,51,184,111,202,196,178,119,
+127,169,153,147,146,115,209,73,155,255,0,254,53,4,74,150,81,89,196,207,253,
+53,2,190,134,131,187,211,253,158,155,146,46,40,166,70,1,218,0,2,0,113,255,
+236,6,201,6,20,0,38,0,51,0,0,33,39,35,6,35,34,2,17,16,18,51,50,23,51,38,38,
+39,17,51,17,20,7,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,37,50,
+54,53,53,52,38,35,34,6,21,20,22,3,125,27,8,110,211,202,222,224,202,205,114,
+12,4,7,1,180,10,12,50,171,99,187,190,178,110,116,154,141,254,43,151,140,141,
+152,129,139,138,147,167,1,40,1,15,1,14,1,45,162,28,101,33,1,182,254,56,90,
+64,85,85,191,210,253,53,2,190,134,131,188,212,253,201,129,179,204,33,229,
+195,221,205,204,210,0,1,0,174,254,20,6,213,4,94,0,39,0,0,19,51,23,51,54,54,
+51,32,23,51,54,54,51,50,22,21,17,35,17,16,35,34,6,21,17,35,17,52,38,35,34,
+6,21,17,20,22,23,35,38,17,174,145,27,10,47,171,106,1,2,78,10,53,183,116,186,
+185,178,223,153,144,179,109,116,152,141,46,38,184,80,4,74,150,80,90,184,88,
+96,192,211,253,53,2,195,1,4,178,183,253,162,2,195,130,130,186,212,253,146,
+128,234,77,172,1,5,0,0,1,0,20,254,20,4,199,4,94,0,51,0,0,1,54,54,51,50,22,
+21,21,35,53,52,38,35,34,6,21,21,51,32,4,21,20,0,35,34,38,53,52,55,51,6,6,
+21,16,33,50,54,53,52,38,35,33,17,52,38,35,35,53,51,50,22,23,1,193,52,183,
+111,202,195,178,119,127,169,153,207,1,23,1,35,254,234,251,235,252,20,185,
+11,14,1,59,161,173,193,186,254,121,46,54,146,185,114,108,11,3,180,82,88,197,
+206,203,190,134,131,187,211,129,226,228,218,254,252,216,217,87,62,27,90,36,
+254,235,168,154,160,147,2,41,59,45,152,68,82,0,0,1,0,174,254,20,4,76,4,74,
+0,32,0,0,1,50,54,55,21,6,33,32,17,17,51,17,20,22,51,50,54,53,17,51,17,20,
+6,35,34,38,39,35,23,22,21,20,22,2,135,111,208,78,155,255,0,254,53,180,154,
+168,127,119,178,194,204,112,184,50,12,3,7,144,254,170,45,41,166,70,1,218,
+4,92,253,198,211,186,131,133,2,191,253,67,217,200,90,80,42,86,59,160,145,
+0,0,1,255,145,254,23,4,102,4,74,0,14,0,0,3,53,33,21,1,1,35,1,1,35,1,3,51,
+23,19,27,4,99,254,186,1,100,204,255,0,253,194,203,2,156,242,199,152,229,3,
+190,140,135,254,49,254,12,1,121,252,158,3,221,1,88,221,1,79,0,0,1,0,20,255,
+236,7,55,4,94,0,44,0,0,1,20,22,51,50,54,53,17,51,17,35,39,35,6,6,35,34,38,
+53,17,52,38,35,34,6,21,17,35,17,52,38,35,35,53,51,50,22,23,51,54,54,51,50,
+22,21,4,123,109,114,154,143,180,147,27,8,48,165,113,185,187,110,116,154,141,
+180,46,54,146,185,114,108,11,11,47,171,105,189,186,1,135,133,129,188,209,
+2,60,251,182,145,79,86,190,209,1,67,134,131,187,211,253,199,3,74,59,45,152,
+68,82,80,90,197,206,0,1,0,174,254,20,4,121,6,20,0,31,0,0,5,20,22,23,35,38,
+17,17,51,17,51,54,54,51,50,22,21,20,22,51,51,21,35,34,38,53,52,38,35,34,6,
+21,1,98,46,38,184,80,180,11,31,139,94,126,146,61,80,103,156,124,146,75,81,
+100,109,53,128,234,77,172,1,5,6,79,253,191,67,72,134,118,98,72,151,128,105,
+96,93,146,137,0,0,1,0,86,255,236,4,78,4,74,0,25,0,0,1,32,0,17,16,0,35,34,
+38,53,52,55,51,6,6,21,20,22,51,50,54,53,16,33,33,53,2,20,1,26,1,32,254,230,
+247,235,252,20,185,11,14,154,162,160,173,254,134,254,120,4,74,254,239,254,
+240,254,245,254,206,237,240,87,62,27,90,36,166,156,218,200,1,141,152,0,0,
+1,0,162,254,20,4,152,6,20,0,27,0,0,5,20,22,23,35,38,17,53,52,55,35,6,6,35,
+34,38,53,17,51,17,20,22,51,50,54,53,17,51,4,68,42,42,185,80,13,15,49,180,
+119,198,201,182,119,125,169,154,181,53,121,231,87,172,1,5,53,55,96,79,86,
+190,209,2,207,253,61,133,129,188,209,4,6,0,0,1,0,162,254,20,4,27,4,74,0,22,
+0,0,19,17,51,17,20,22,51,50,54,53,17,51,17,20,6,7,16,23,35,38,17,38,38,162,
+180,132,134,127,135,181,188,167,84,184,80,169,185,1,139,2,191,253,61,125,
+135,134,126,2,195,253,61,168,209,22,254,200,172,168,1,60,19,210,0,2,0,113,
+255,236,6,201,6,20,0,10,0,54,0,0,1,52,38,35,34,6,21,20,22,51,32,19,20,7,51,
+54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,21,16,2,35,34,2,17,16,18,51,50,
+23,51,38,38,53,52,54,51,33,21,33,34,6,21,3,90,138,153,129,139,137,146,1,20,
+180,10,12,50,171,99,187,190,178,110,116,154,141,246,219,227,233,224,202,203,
+114,12,2,8,209,223,1,137,254,134,150,117,2,35,229,193,221,205,209,205,3,203,
+90,64,85,85,191,210,253,53,2,190,134,131,188,212,18,254,244,254,211,1,27,
+1,28,1,14,1,45,162,16,119,27,226,212,151,122,144,0,0,2,0,147,255,227,1,145,
+4,102,0,11,0,23,0,0,55,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,
+21,20,6,35,34,38,147,64,63,61,66,68,59,61,66,63,64,63,64,68,59,61,66,111,
+66,73,72,67,67,73,74,3,174,69,70,72,67,66,73,74,0,0,0,15,0,186,0,3,0,1,4,
+9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,
+1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,
+0,3,0,1,4,9,0,6,0,32,0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,
+1,92,0,3,0,1,4,9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,
+11,0,62,2,14,0,3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,
+0,1,4,9,0,14,0,52,5,30,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,71,0,101,0,111,0,114,0,103,0,
+105,0,97,0,110,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,71,
+0,101,0,111,0,114,0,103,0,105,0,97,0,110,0,86,0,101,0,114,0,115,0,105,0,111,
+0,110,0,32,0,49,0,46,0,48,0,54,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,
+83,0,97,0,110,0,115,0,71,0,101,0,111,0,114,0,103,0,105,0,97,0,110,0,78,0,
+111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,
+101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,
+112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,
+99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,
+0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,
+0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,
+0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,
+0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,
+0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,
+0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,
+83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,
+0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,
+0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,
+0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,
+0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,
+115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,
+0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,
+0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,
+0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,
+0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,
+0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,
+0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,
+0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,1,2,0,2,0,3,1,3,1,
+4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,
+20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,
+1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,
+1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,
+1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,
+1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,
+1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,
+120,1,121,1,122,1,123,1,124,1,125,4,110,117,108,108,7,117,110,105,49,48,65,
+48,7,117,110,105,49,48,65,49,7,117,110,105,49,48,65,50,7,117,110,105,49,48,
+65,51,7,117,110,105,49,48,65,52,7,117,110,105,49,48,65,53,7,117,110,105,49,
+48,65,54,7,117,110,105,49,48,65,55,7,117,110,105,49,48,65,56,7,117,110,105,
+49,48,65,57,7,117,110,105,49,48,65,65,7,117,110,105,49,48,65,66,7,117,110,
+105,49,48,65,67,7,117,110,105,49,48,65,68,7,117,110,105,49,48,65,69,7,117,
+110,105,49,48,65,70,7,117,110,105,49,48,66,48,7,117,110,105,49,48,66,49,7,
+117,110,105,49,48,66,50,7,117,110,105,49,48,66,51,7,117,110,105,49,48,66,
+52,7,117,110,105,49,48,66,53,7,117,110,105,49,48,66,54,7,117,110,105,49,48,
+66,55,7,117,110,105,49,48,66,56,7,117,110,105,49,48,66,57,7,117,110,105,49,
+48,66,65,7,117,110,105,49,48,66,66,7,117,110,105,49,48,66,67,7,117,110,105,
+49,48,66,68,7,117,110,105,49,48,66,69,7,117,110,105,49,48,66,70,7,117,110,
+105,49,48,67,48,7,117,110,105,49,48,67,49,7,117,110,105,49,48,67,50,7,117,
+110,105,49,48,67,51,7,117,110,105,49,48,67,52,7,117,110,105,49,48,67,53,7,
+117,110,105,49,48,68,48,7,117,110,105,49,48,68,49,7,117,110,105,49,48,68,
+50,7,117,110,105,49,48,68,51,7,117,110,105,49,48,68,52,7,117,110,105,49,48,
+68,53,7,117,110,105,49,48,68,54,7,117,110,105,49,48,68,55,7,117,110,105,49,
+48,68,56,7,117,110,105,49,48,68,57,7,117,110,105,49,48,68,65,7,117,110,105,
+49,48,68,66,7,117,110,105,49,48,68,67,7,117,110,105,49,48,68,68,7,117,110,
+105,49,48,68,69,7,117,110,105,49,48,68,70,7,117,110,105,49,48,69,48,7,117,
+110,105,49,48,69,49,7,117,110,105,49,48,69,50,7,117,110,105,49,48,69,51,7,
+117,110,105,49,48,69,52,7,117,110,105,49,48,69,53,7,117,110,105,49,48,69,
+54,7,117,110,105,49,48,69,55,7,117,110,105,49,48,69,56,7,117,110,105,49,48,
+69,57,7,117,110,105,49,48,69,65,7,117,110,105,49,48,69,66,7,117,110,105,49,
+48,69,67,7,117,110,105,49,48,69,68,7,117,110,105,49,48,69,69,7,117,110,105,
+49,48,69,70,7,117,110,105,49,48,70,48,7,117,110,105,49,48,70,49,7,117,110,
+105,49,48,70,50,7,117,110,105,49,48,70,51,7,117,110,105,49,48,70,52,7,117,
+110,105,49,48,70,53,7,117,110,105,49,48,70,54,7,117,110,105,49,48,70,55,7,
+117,110,105,49,48,70,56,7,117,110,105,49,48,70,57,7,117,110,105,49,48,70,
+65,7,117,110,105,49,48,70,66,7,117,110,105,49,48,70,67,7,117,110,105,50,68,
+48,48,7,117,110,105,50,68,48,49,7,117,110,105,50,68,48,50,7,117,110,105,50,
+68,48,51,7,117,110,105,50,68,48,52,7,117,110,105,50,68,48,53,7,117,110,105,
+50,68,48,54,7,117,110,105,50,68,48,55,7,117,110,105,50,68,48,56,7,117,110,
+105,50,68,48,57,7,117,110,105,50,68,48,65,7,117,110,105,50,68,48,66,7,117,
+110,105,50,68,48,67,7,117,110,105,50,68,48,68,7,117,110,105,50,68,48,69,7,
+117,110,105,50,68,48,70,7,117,110,105,50,68,49,48,7,117,110,105,50,68,49,
+49,7,117,110,105,50,68,49,50,7,117,110,105,50,68,49,51,7,117,110,105,50,68,
+49,52,7,117,110,105,50,68,49,53,7,117,110,105,50,68,49,54,7,117,110,105,50,
+68,49,55,7,117,110,105,50,68,49,56,7,117,110,105,50,68,49,57,7,117,110,105,
+50,68,49,65,7,117,110,105,50,68,49,66,7,117,110,105,50,68,49,67,7,117,110,
+105,50,68,49,68,7,117,110,105,50,68,49,69,7,117,110,105,50,68,49,70,7,117,
+110,105,50,68,50,48,7,117,110,105,50,68,50,49,7,117,110,105,50,68,50,50,7,
+117,110,105,50,68,50,51,7,117,110,105,50,68,50,52,7,117,110,105,50,68,50,
+53,7,117,110,105,48,53,56,57,7,117,110,105,70,69,70,70,0,0,0,0,1,0,3,0,8,
+0,10,0,14,0,7,255,255,0,15,0,1,0,0,0,12,0,0,0,22,0,0,0,2,0,1,0,0,0,126,0,
+1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,30,0,44,0,1,103,101,111,114,0,8,0,4,
+0,0,0,0,255,255,0,1,0,0,0,1,107,101,114,110,0,8,0,0,0,1,0,0,0,1,0,4,0,2,0,
+8,0,1,0,8,0,1,13,210,0,4,0,0,0,113,0,236,0,242,0,248,2,2,2,44,2,54,3,24,2,
+54,0,242,3,102,3,180,4,2,4,236,5,54,0,236,0,242,2,54,5,80,5,198,5,54,5,220,
+6,14,6,152,6,182,0,236,3,24,6,200,7,14,8,0,8,102,8,120,8,190,5,80,9,72,5,
+54,0,242,9,134,9,196,10,70,10,88,10,106,10,112,10,130,10,106,10,112,10,112,
+10,112,10,144,10,112,10,170,10,200,10,112,10,218,10,130,10,112,10,112,10,
+248,10,130,11,10,10,130,10,112,10,130,10,170,10,112,11,44,11,78,11,112,11,
+134,10,112,11,180,11,206,11,216,10,112,11,234,10,106,11,248,10,112,12,6,12,
+36,10,112,12,86,12,108,12,114,12,212,12,254,13,4,13,18,13,32,13,46,13,18,
+13,46,13,46,13,60,13,46,13,78,13,46,13,46,13,18,13,128,13,134,12,212,13,46,
+13,128,13,46,13,46,13,46,13,46,13,152,13,166,13,204,13,18,13,128,13,46,0,
+1,0,41,255,205,0,1,0,41,255,195,0,66,0,4,255,215,0,5,255,92,0,6,255,92,0,
+7,255,225,0,8,255,92,0,9,255,92,0,10,255,113,0,11,255,215,0,12,255,113,0,
+13,255,143,0,14,255,51,0,15,255,225,0,17,255,215,0,18,255,113,0,19,255,72,
+0,21,255,225,0,23,255,215,0,25,255,113,0,26,0,41,0,27,255,92,0,28,255,225,
+0,30,255,215,0,33,0,61,0,35,255,215,0,36,255,113,0,38,255,236,0,39,255,92,
+0,40,255,92,0,87,255,92,0,88,0,31,0,89,255,195,0,90,0,51,0,91,255,195,0,92,
+255,195,0,93,0,31,0,94,0,31,0,95,255,102,0,96,0,31,0,97,0,31,0,98,0,51,0,
+99,0,31,0,100,0,31,0,101,255,195,0,102,255,195,0,103,0,31,0,104,0,31,0,105,
+0,31,0,106,0,31,0,107,0,51,0,108,255,92,0,109,255,195,0,110,0,31,0,111,0,
+31,0,112,0,31,0,113,0,31,0,114,0,51,0,115,0,31,0,116,255,195,0,117,0,31,0,
+118,255,236,0,119,255,195,0,120,0,31,0,121,0,51,0,122,0,31,0,123,0,31,0,124,
+0,51,0,10,0,10,255,184,0,12,255,184,0,14,255,184,0,18,255,184,0,19,255,184,
+0,36,255,184,0,41,255,205,0,87,255,164,0,108,255,164,0,118,255,164,0,2,0,
+35,255,174,0,41,255,195,0,56,0,4,0,61,0,7,0,51,0,10,255,225,0,11,0,61,0,12,
+255,225,0,13,0,51,0,14,255,225,0,15,0,51,0,17,0,61,0,18,255,225,0,19,255,
+225,0,21,0,51,0,23,0,61,0,25,0,53,0,26,0,41,0,28,0,51,0,30,0,61,0,33,0,61,
+0,35,255,215,0,36,255,225,0,38,255,195,0,88,0,31,0,89,0,20,0,90,0,51,0,91,
+0,20,0,92,0,20,0,93,0,31,0,94,0,31,0,95,0,20,0,96,0,31,0,97,0,31,0,98,0,51,
+0,99,0,31,0,100,0,31,0,101,0,20,0,102,0,20,0,103,0,31,0,104,0,31,0,105,0,
+31,0,106,0,31,0,107,0,51,0,109,0,20,0,110,0,31,0,111,0,31,0,112,0,31,0,113,
+0,31,0,114,0,51,0,115,0,31,0,116,0,20,0,117,0,31,0,119,0,20,0,120,0,31,0,
+121,0,51,0,122,0,31,0,123,0,31,0,124,0,51,0,19,0,5,255,215,0,6,255,195,0,
+8,255,195,0,9,255,195,0,10,255,143,0,12,255,51,0,14,255,143,0,18,255,143,
+0,19,255,143,0,25,255,215,0,27,255,215,0,35,255,174,0,36,255,143,0,38,255,
+205,0,39,255,215,0,40,255,215,0,87,255,184,0,108,255,184,0,118,255,184,0,
+19,0,5,255,215,0,6,255,195,0,8,255,195,0,9,255,195,0,10,255,143,0,12,255,
+51,0,14,255,143,0,18,255,143,0,19,255,143,0,25,255,215,0,27,255,215,0,35,
+255,174,0,36,255,143,0,38,255,205,0,39,255,215,0,40,255,215,0,87,255,184,
+0,108,255,184,0,118,255,246,0,19,0,5,255,215,0,6,255,174,0,8,255,174,0,9,
+255,174,0,10,255,143,0,12,255,51,0,14,255,143,0,18,255,143,0,19,255,143,0,
+25,255,215,0,27,255,215,0,35,255,174,0,36,255,143,0,38,255,205,0,39,255,215,
+0,40,255,215,0,87,255,184,0,108,255,184,0,118,255,225,0,58,0,4,0,61,0,7,0,
+51,0,10,255,225,0,11,0,61,0,12,255,225,0,13,0,51,0,14,255,225,0,15,0,51,0,
+17,0,61,0,18,255,225,0,19,255,225,0,21,0,51,0,23,0,61,0,25,0,53,0,26,0,41,
+0,28,0,51,0,30,0,61,0,33,0,61,0,35,255,215,0,36,255,225,0,38,255,195,0,41,
+255,195,0,88,0,31,0,89,0,61,0,90,0,51,0,91,0,61,0,92,0,61,0,93,0,31,0,94,
+0,31,0,95,0,61,0,96,0,31,0,97,0,31,0,98,0,51,0,99,0,31,0,100,0,31,0,101,0,
+61,0,102,0,61,0,103,0,31,0,104,0,31,0,105,0,31,0,106,0,31,0,107,0,51,0,109,
+0,61,0,110,0,31,0,111,0,31,0,112,0,31,0,113,0,31,0,114,0,51,0,115,0,31,0,
+116,0,61,0,117,0,31,0,118,0,92,0,119,0,61,0,120,0,31,0,121,0,51,0,122,0,31,
+0,123,0,31,0,124,0,51,0,18,0,5,255,236,0,6,255,195,0,8,255,195,0,9,255,195,
+0,10,255,195,0,12,255,195,0,14,255,195,0,18,255,195,0,19,255,195,0,27,255,
+236,0,36,255,195,0,39,255,236,0,40,255,236,0,41,255,195,0,87,255,174,0,95,
+255,164,0,108,255,174,0,118,255,215,0,6,0,10,255,195,0,12,255,195,0,14,255,
+195,0,18,255,195,0,19,255,195,0,36,255,195,0,29,0,5,255,174,0,6,254,205,0,
+8,254,205,0,9,254,205,0,10,255,113,0,12,255,31,0,13,255,195,0,14,255,113,
+0,18,255,113,0,19,255,113,0,25,255,154,0,27,255,174,0,35,255,195,0,36,255,
+113,0,38,255,195,0,39,255,174,0,40,255,174,0,87,255,141,0,89,255,215,0,91,
+255,215,0,92,255,215,0,95,255,141,0,101,255,215,0,102,255,215,0,108,255,141,
+0,109,255,215,0,116,255,215,0,118,255,141,0,119,255,215,0,5,0,20,255,174,
+0,25,0,51,0,36,0,41,0,41,255,184,0,118,0,51,0,12,0,10,255,215,0,12,255,215,
+0,14,255,215,0,18,255,215,0,19,255,215,0,20,255,133,0,25,0,31,0,31,255,205,
+0,35,255,215,0,36,255,215,0,38,255,174,0,41,255,133,0,34,0,4,0,41,0,5,0,61,
+0,6,0,61,0,8,0,61,0,9,0,61,0,10,255,215,0,11,0,41,0,12,255,215,0,14,0,20,
+0,17,0,41,0,18,255,215,0,19,255,215,0,23,0,41,0,25,0,82,0,27,0,31,0,30,0,
+41,0,35,255,195,0,36,255,215,0,38,255,154,0,39,0,31,0,40,0,31,0,41,255,133,
+0,87,0,41,0,89,0,41,0,91,0,41,0,92,0,41,0,95,0,41,0,101,0,41,0,102,0,41,0,
+108,0,41,0,109,0,41,0,116,0,41,0,118,0,82,0,119,0,41,0,7,0,10,255,215,0,12,
+255,215,0,14,255,215,0,18,255,215,0,19,255,215,0,36,255,215,0,41,255,195,
+0,4,0,41,255,215,0,48,0,61,0,51,255,195,0,78,255,195,0,17,0,5,255,215,0,6,
+255,174,0,8,255,174,0,9,255,174,0,10,255,215,0,12,255,215,0,14,255,215,0,
+18,255,215,0,19,255,215,0,27,255,215,0,36,255,215,0,39,255,215,0,40,255,215,
+0,87,255,184,0,95,255,164,0,108,255,184,0,118,255,184,0,60,0,4,0,61,0,7,0,
+51,0,10,255,225,0,11,0,61,0,12,255,225,0,13,0,51,0,14,255,225,0,15,0,51,0,
+17,0,61,0,18,255,225,0,19,255,225,0,21,0,51,0,23,0,61,0,24,0,61,0,25,0,53,
+0,26,0,41,0,28,0,51,0,30,0,61,0,33,0,61,0,35,255,215,0,36,255,225,0,38,255,
+195,0,87,0,61,0,88,0,31,0,89,0,51,0,90,0,20,0,91,0,51,0,92,0,51,0,93,0,31,
+0,94,0,31,0,95,0,51,0,96,0,31,0,97,0,31,0,98,0,51,0,99,0,31,0,100,0,31,0,
+101,0,51,0,102,0,51,0,103,0,31,0,104,0,31,0,105,0,31,0,106,0,31,0,107,0,51,
+0,108,0,61,0,109,0,51,0,110,0,31,0,111,0,31,0,112,0,31,0,113,0,31,0,114,0,
+51,0,115,0,31,0,116,0,51,0,117,0,31,0,118,0,92,0,119,0,51,0,120,0,31,0,121,
+0,51,0,122,0,31,0,123,0,31,0,124,0,51,0,25,0,14,0,20,0,20,255,143,0,36,0,
+20,0,88,255,215,0,90,255,195,0,94,255,215,0,97,255,215,0,98,255,205,0,99,
+255,236,0,100,255,215,0,103,255,215,0,105,255,215,0,106,255,215,0,107,255,
+205,0,110,255,215,0,111,255,215,0,113,255,215,0,114,255,205,0,115,255,215,
+0,117,255,215,0,118,0,41,0,121,255,205,0,122,255,215,0,123,255,215,0,124,
+255,205,0,4,0,41,255,205,0,87,255,215,0,108,255,215,0,118,255,215,0,17,0,
+20,255,133,0,31,255,195,0,41,255,164,0,88,255,236,0,94,255,236,0,97,255,236,
+0,100,255,236,0,103,255,236,0,105,255,236,0,106,255,236,0,110,255,236,0,111,
+255,236,0,113,255,236,0,115,255,236,0,117,255,236,0,122,255,236,0,123,255,
+236,0,34,0,10,0,61,0,12,0,61,0,14,0,61,0,18,0,61,0,19,0,61,0,20,255,195,0,
+31,255,215,0,36,0,61,0,39,255,215,0,41,255,215,0,87,255,225,0,88,255,195,
+0,90,255,195,0,93,0,82,0,94,255,195,0,97,255,195,0,98,255,195,0,100,255,195,
+0,103,255,195,0,105,255,195,0,106,255,195,0,107,255,195,0,108,255,225,0,110,
+255,195,0,111,255,195,0,113,255,195,0,114,255,195,0,115,255,195,0,117,255,
+195,0,118,255,225,0,121,255,195,0,122,255,195,0,123,255,195,0,124,255,195,
+0,15,0,5,255,215,0,6,255,174,0,8,255,174,0,9,255,174,0,10,255,174,0,12,255,
+174,0,14,255,174,0,18,255,174,0,19,255,174,0,27,255,215,0,35,255,143,0,36,
+255,174,0,38,255,154,0,39,255,215,0,40,255,215,0,15,0,10,0,20,0,12,0,20,0,
+14,0,20,0,15,255,195,0,18,0,20,0,19,0,20,0,20,255,133,0,36,0,20,0,90,255,
+195,0,98,255,195,0,105,255,174,0,107,255,195,0,114,255,195,0,121,255,195,
+0,124,255,195,0,32,0,10,255,215,0,12,255,215,0,14,255,215,0,18,255,215,0,
+19,255,215,0,20,255,133,0,25,0,31,0,31,255,154,0,35,255,215,0,36,255,215,
+0,38,255,174,0,41,255,133,0,88,255,205,0,90,255,174,0,94,255,205,0,97,255,
+205,0,98,255,174,0,100,255,205,0,103,255,205,0,105,255,205,0,106,255,205,
+0,107,255,174,0,110,255,205,0,111,255,205,0,113,255,205,0,114,255,174,0,115,
+255,205,0,117,255,205,0,121,255,174,0,122,255,205,0,123,255,205,0,124,255,
+174,0,4,0,51,255,205,0,73,255,195,0,78,255,225,0,86,255,139,0,4,0,51,255,
+195,0,73,255,195,0,78,255,225,0,86,255,154,0,1,0,77,0,102,0,4,0,51,255,225,
+0,73,255,195,0,78,255,225,0,86,255,154,0,3,0,56,255,215,0,62,255,225,0,74,
+255,215,0,6,0,46,0,31,0,47,0,31,0,51,0,31,0,77,0,102,0,78,0,31,0,81,0,51,
+0,7,0,48,0,41,0,51,255,164,0,56,255,215,0,71,255,236,0,73,255,195,0,74,255,
+215,0,78,255,195,0,4,0,51,255,184,0,73,255,195,0,78,255,225,0,86,255,154,
+0,7,0,48,0,41,0,51,255,215,0,56,255,215,0,71,255,236,0,73,255,195,0,74,255,
+215,0,78,255,195,0,4,0,56,255,215,0,62,255,225,0,74,255,215,0,86,255,133,
+0,8,0,46,0,41,0,47,0,41,0,48,255,236,0,51,0,41,0,77,0,102,0,78,0,41,0,81,
+0,41,0,86,255,195,0,8,0,46,0,31,0,47,0,31,0,51,0,31,0,61,0,41,0,77,0,102,
+0,78,0,31,0,81,0,31,0,86,255,215,0,8,0,47,255,215,0,48,0,41,0,51,255,164,
+0,56,255,215,0,71,255,236,0,73,255,195,0,74,255,215,0,78,255,195,0,5,0,47,
+255,236,0,51,255,225,0,73,255,195,0,78,255,225,0,86,255,195,0,11,0,48,255,
+195,0,53,255,225,0,54,255,225,0,59,255,225,0,66,255,195,0,70,255,225,0,72,
+255,215,0,75,255,195,0,79,255,225,0,81,0,20,0,86,255,139,0,6,0,48,255,195,
+0,66,255,195,0,72,255,215,0,75,255,195,0,81,0,20,0,86,255,139,0,2,0,48,0,
+41,0,51,255,184,0,4,0,48,0,41,0,51,255,184,0,73,255,236,0,78,255,215,0,3,
+0,47,0,72,0,62,255,225,0,77,0,102,0,3,0,48,0,41,0,51,255,154,0,78,255,174,
+0,7,0,51,0,31,0,71,0,20,0,73,0,20,0,77,0,51,0,78,0,41,0,81,0,41,0,86,255,
+154,0,12,0,47,0,41,0,51,255,225,0,57,0,61,0,61,0,61,0,63,0,61,0,65,0,61,0,
+68,0,61,0,71,0,61,0,73,255,195,0,78,255,225,0,82,0,61,0,86,255,154,0,5,0,
+51,255,225,0,73,255,195,0,74,255,215,0,78,255,225,0,86,255,154,0,1,0,51,255,
+174,0,24,0,42,255,117,0,43,255,154,0,45,255,154,0,48,0,123,0,49,255,154,0,
+50,255,154,0,51,255,92,0,52,255,154,0,55,255,154,0,56,255,154,0,57,255,154,
+0,58,255,154,0,60,255,113,0,62,255,154,0,64,255,154,0,66,255,215,0,68,255,
+174,0,69,255,154,0,74,255,154,0,76,255,154,0,80,255,154,0,81,255,174,0,83,
+255,154,0,84,255,154,0,10,0,89,0,31,0,91,0,31,0,92,0,31,0,95,0,31,0,101,0,
+31,0,102,0,31,0,109,0,31,0,116,0,31,0,118,0,82,0,119,0,31,0,1,0,118,0,72,
+0,3,0,87,255,195,0,108,255,195,0,118,0,20,0,3,0,87,255,195,0,108,255,195,
+0,118,255,195,0,3,0,87,255,195,0,108,255,195,0,118,0,41,0,3,0,87,255,195,
+0,108,255,195,0,118,255,225,0,4,0,87,255,195,0,93,255,215,0,108,255,195,0,
+118,0,41,0,12,0,87,0,61,0,89,0,31,0,91,0,31,0,92,0,31,0,95,0,31,0,101,0,31,
+0,102,0,31,0,108,0,61,0,109,0,31,0,116,0,31,0,118,0,82,0,119,0,31,0,1,0,118,
+0,41,0,4,0,87,255,195,0,93,255,236,0,108,255,195,0,118,255,195,0,3,0,87,255,
+195,0,108,255,195,0,118,0,10,0,9,0,89,0,41,0,91,0,41,0,92,0,41,0,95,0,41,
+0,101,0,41,0,102,0,41,0,109,0,41,0,116,0,41,0,119,0,41,0,1,0,95,255,236,0,
+2,0,7,0,4,0,99,0,0,0,103,0,103,0,96,0,105,0,110,0,97,0,112,0,116,0,103,0,
+118,0,118,0,108,0,120,0,122,0,109,0,124,0,124,0,112,0,1,0,0,0,10,0,28,0,30,
+0,1,103,101,111,114,0,8,0,4,0,0,0,0,255,255,0,0,0,0,0,0,};
+#endif
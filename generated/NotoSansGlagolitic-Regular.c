@@ -0,0 +1,694 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansGlagolitic_Regular_ttf_size = 16632;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansGlagolitic_Regular_ttf");
+asm(".type fz_font_NotoSansGlagolitic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansGlagolitic_Regular_ttf, 16632");
+asm(".balign 64");
+asm("fz_font_NotoSansGlagolitic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansGlagolitic-Regular.ttf\"");
+#else
+const int fz_font_NotoSansGlagolitic_Regular_ttf_size = 16632;
+const char fz_font_NotoSansGlagolitic_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,122,233,107,135,0,0,1,56,0,0,0,96,
+99,109,97,112,45,47,43,246,0,0,3,32,0,0,0,92,103,97,115,112,0,8,0,22,0,0,
+64,236,0,0,0,12,103,108,121,102,234,43,88,110,0,0,4,68,0,0,50,178,104,101,
+97,100,7,195,110,193,0,0,0,188,0,0,0,54,104,104,101,97,18,193,8,181,0,0,0,
+244,0,0,0,36,104,109,116,120,82,201,51,116,0,0,1,152,0,0,1,136,108,111,99,
+97,107,231,95,55,0,0,3,124,0,0,0,198,109,97,120,112,0,104,0,83,0,0,1,24,0,
+0,0,32,110,97,109,101,143,167,187,34,0,0,54,248,0,0,6,24,112,111,115,116,
+121,146,139,195,0,0,61,16,0,0,3,219,0,1,0,0,0,1,10,61,83,238,177,86,95,15,
+60,245,0,11,8,0,0,0,0,0,204,73,77,213,0,0,0,0,210,40,203,233,0,40,254,170,
+10,10,7,30,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,10,110,0,40,
+0,60,10,10,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,1,0,0,0,98,0,82,0,5,0,0,
+0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,6,33,1,144,0,5,0,0,5,154,5,51,
+0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,
+141,2,88,0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,0,4,0,0,102,0,0,0,0,4,20,0,
+0,2,20,0,0,6,138,0,160,6,199,0,200,8,128,0,200,7,169,0,160,8,146,0,200,5,
+68,0,100,8,128,0,200,6,212,0,200,8,38,0,200,8,148,0,160,8,148,0,160,4,44,
+0,160,8,196,0,200,3,144,0,80,8,78,0,160,6,176,0,200,4,142,0,200,4,142,0,140,
+6,39,0,200,4,142,0,200,6,110,0,140,8,128,0,200,6,214,0,160,6,94,0,140,6,215,
+0,100,6,94,0,140,6,235,0,160,6,139,0,160,6,184,0,140,7,69,0,100,6,219,0,200,
+5,240,0,60,5,152,0,60,7,124,0,100,6,57,0,140,6,219,0,200,5,209,0,40,6,204,
+0,60,6,225,0,100,8,62,0,100,8,82,0,160,10,110,0,100,7,106,0,140,4,206,0,160,
+3,26,0,100,6,86,0,160,7,234,0,100,5,168,0,140,5,208,0,180,7,92,0,180,6,99,
+0,140,7,42,0,180,4,16,0,80,7,92,0,180,5,128,0,140,6,172,0,180,7,80,0,140,
+7,80,0,140,3,200,0,160,7,90,0,180,3,46,0,60,6,248,0,140,5,200,0,180,3,242,
+0,180,4,12,0,160,5,78,0,180,3,228,0,180,5,34,0,120,7,92,0,180,5,232,0,160,
+5,241,0,130,5,152,0,80,4,251,0,130,5,158,0,140,5,168,0,140,5,90,0,120,5,150,
+0,80,5,248,0,180,5,29,0,80,4,231,0,80,5,198,0,80,4,213,0,130,5,248,0,180,
+4,132,0,40,5,79,0,60,5,198,0,80,6,70,0,80,6,210,0,160,8,78,0,80,6,97,0,100,
+3,221,0,160,2,126,0,80,5,38,0,140,6,44,0,80,0,0,0,1,0,3,0,1,0,0,0,12,0,4,
+0,80,0,0,0,16,0,16,0,3,0,0,0,0,0,13,0,32,0,160,44,46,44,94,254,255,255,255,
+0,0,0,0,0,13,0,32,0,160,44,0,44,48,254,255,255,255,0,1,255,245,255,227,255,
+99,212,4,212,3,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,20,0,20,
+0,20,0,66,0,117,0,197,1,19,1,109,1,158,2,7,2,102,2,181,3,9,3,110,3,170,3,
+245,4,16,4,125,4,175,4,218,5,31,5,89,5,134,5,207,6,31,6,114,6,178,6,238,7,
+88,7,157,7,224,8,41,8,102,8,142,8,235,9,53,9,108,9,176,9,229,10,26,10,92,
+10,148,10,233,11,88,11,183,12,6,12,94,12,110,12,145,12,239,13,30,13,81,13,
+165,13,240,14,73,14,117,14,221,15,53,15,131,15,210,16,48,16,107,16,184,16,
+211,17,71,17,118,17,157,17,223,18,29,18,73,18,137,18,221,19,46,19,105,19,
+163,20,8,20,82,20,146,20,213,21,15,21,55,21,143,21,214,22,10,22,72,22,127,
+22,173,22,230,23,32,23,112,23,217,24,53,24,123,24,208,24,223,25,0,25,89,0,
+0,0,2,0,102,0,0,3,154,5,182,0,3,0,7,0,0,51,17,33,17,37,33,17,33,102,3,52,
+253,47,2,110,253,146,5,182,250,74,98,4,242,0,1,0,160,0,0,5,234,5,182,0,28,
+0,0,1,17,33,50,22,21,17,35,17,52,38,35,33,17,35,17,33,34,6,21,17,35,17,52,
+54,54,51,33,17,3,161,1,129,119,81,184,39,61,254,211,184,254,211,59,41,184,
+34,82,84,1,129,5,182,253,86,81,119,253,188,2,6,59,41,253,150,2,106,39,61,
+253,250,2,68,86,80,34,2,170,0,1,0,200,0,0,6,19,5,182,0,30,0,0,33,33,34,38,
+38,53,17,51,17,37,17,51,17,37,54,54,53,17,51,17,20,6,6,7,5,17,20,22,22,51,
+33,5,225,251,175,86,80,34,184,1,145,184,1,82,38,26,184,26,66,108,252,53,15,
+36,49,3,253,34,81,85,4,238,253,86,38,2,132,253,141,32,3,32,32,2,16,253,218,
+84,72,33,10,91,254,152,44,40,16,0,0,3,0,200,0,0,7,184,5,182,0,28,0,41,0,54,
+0,0,37,17,52,54,54,51,33,50,22,21,17,20,6,35,33,34,38,38,53,17,52,54,54,51,
+33,50,22,21,17,33,50,54,53,17,52,38,35,35,34,6,21,17,1,52,38,35,35,34,6,21,
+17,20,22,51,33,4,204,34,82,84,1,92,119,81,79,121,250,160,86,80,34,34,82,84,
+1,92,119,81,2,232,59,41,39,61,180,59,41,253,120,39,61,180,59,41,39,61,1,24,
+162,4,76,86,80,34,81,119,251,218,119,81,34,81,85,4,38,86,80,34,81,119,251,
+180,39,61,3,170,59,41,39,61,251,242,4,14,59,41,39,61,252,86,59,41,0,3,0,160,
+0,0,7,9,5,182,0,28,0,41,0,49,0,0,33,34,38,38,53,17,35,39,3,35,19,38,2,53,
+53,52,54,51,33,1,51,54,54,51,33,50,22,21,17,3,52,38,35,35,34,6,21,17,20,22,
+51,33,1,20,22,23,19,33,34,6,4,171,86,80,34,215,23,211,177,222,190,241,52,
+48,3,62,254,239,183,12,86,97,1,150,119,81,184,39,61,238,59,41,39,61,1,82,
+251,7,166,137,206,254,76,48,25,34,81,85,1,110,1,253,201,2,85,58,1,59,207,
+186,44,55,253,34,68,50,81,119,253,122,2,72,59,41,39,61,254,190,59,41,3,222,
+147,220,38,2,41,54,0,3,0,200,0,0,7,242,5,182,0,36,0,49,0,62,0,0,1,50,22,21,
+17,33,50,22,21,17,20,6,35,33,34,38,38,53,17,52,38,35,35,17,20,6,35,33,34,
+38,38,53,17,52,54,54,51,23,34,6,21,17,20,22,51,51,50,54,53,17,1,20,22,51,
+51,50,54,53,17,52,38,35,33,4,188,119,81,1,166,119,81,79,121,254,106,86,80,
+34,39,61,180,79,121,254,164,86,80,34,34,82,84,84,59,41,39,61,180,59,41,2,
+136,39,61,238,59,41,39,61,254,174,5,182,81,119,254,128,81,119,254,34,119,
+81,34,81,85,3,232,59,41,251,180,119,81,34,81,85,4,38,86,80,34,162,39,61,252,
+86,59,41,39,61,4,14,251,242,59,41,39,61,1,98,59,41,0,1,0,100,255,236,4,184,
+5,203,0,27,0,0,19,54,51,50,4,18,21,16,0,33,34,38,39,53,22,22,51,32,0,19,33,
+53,33,38,36,35,34,7,100,174,242,217,1,57,162,254,147,254,171,113,175,101,
+86,175,99,1,8,1,13,8,253,57,2,197,20,254,249,215,167,171,5,117,86,176,254,
+186,225,254,138,254,110,24,35,160,23,35,1,24,1,7,162,222,253,78,0,3,0,200,
+0,0,7,184,7,30,0,47,0,60,0,73,0,0,1,17,20,6,35,33,34,38,38,53,17,52,54,54,
+51,33,38,38,35,35,53,51,50,4,23,54,36,51,51,21,35,34,6,7,33,50,22,21,17,20,
+6,35,33,34,38,38,53,17,33,33,34,6,21,17,20,22,51,51,50,54,53,1,17,20,22,51,
+51,50,54,53,17,52,38,35,3,180,79,121,254,164,86,80,34,34,82,84,2,6,46,193,
+159,52,38,222,1,43,61,61,1,44,221,38,52,170,188,40,2,6,119,81,79,121,254,
+164,86,80,34,254,48,254,232,59,41,39,61,180,59,41,2,136,39,61,180,59,41,39,
+61,5,20,251,180,119,81,34,81,85,4,38,86,80,34,107,91,162,168,159,161,166,
+162,99,99,81,119,251,218,119,81,34,81,85,4,76,39,61,252,86,59,41,39,61,4,
+14,251,242,59,41,39,61,3,170,59,41,0,4,0,200,0,0,6,12,5,182,0,30,0,40,0,50,
+0,63,0,0,33,34,38,38,53,17,52,54,54,51,33,17,52,54,54,51,33,50,22,21,21,20,
+6,7,22,22,21,17,20,6,35,1,34,6,21,17,20,22,51,33,17,1,50,54,53,17,52,38,35,
+33,17,19,62,2,53,52,38,35,35,34,6,21,17,1,144,86,80,34,34,82,84,1,126,34,
+82,84,1,210,48,52,96,96,117,75,79,121,252,160,59,41,39,61,1,42,1,226,59,41,
+39,61,254,214,33,110,165,90,33,40,225,59,41,34,81,85,1,190,86,80,34,1,160,
+86,80,34,55,44,114,121,207,75,2,81,117,254,66,119,81,2,172,39,61,254,190,
+59,41,2,10,253,246,39,61,1,66,59,41,253,246,2,172,12,97,172,106,40,27,39,
+61,254,158,0,0,4,0,200,0,0,7,134,5,182,0,23,0,36,0,42,0,48,0,0,1,50,0,19,
+33,50,22,21,17,20,6,35,33,34,38,38,53,17,35,2,0,35,35,17,1,20,22,51,51,50,
+54,53,17,52,38,35,33,1,51,50,54,19,33,53,33,38,38,35,35,1,182,231,1,8,19,
+3,6,119,81,79,121,254,106,86,80,34,165,12,254,239,250,220,4,80,39,61,238,
+59,41,39,61,254,174,252,104,17,182,171,7,254,135,1,119,14,163,146,52,5,182,
+254,194,254,214,81,119,254,66,119,81,34,81,85,1,228,254,175,254,165,5,182,
+251,80,59,41,39,61,1,66,59,41,253,246,252,1,14,162,223,231,0,4,0,160,0,0,
+7,244,5,182,0,23,0,33,0,44,0,55,0,0,1,20,6,35,34,39,6,7,17,51,21,33,53,51,
+17,38,39,6,35,34,38,53,17,33,1,20,22,51,50,54,54,53,53,33,5,20,22,22,51,50,
+54,54,53,53,33,35,33,21,20,22,22,51,50,54,54,53,7,244,182,192,190,93,68,121,
+212,253,160,212,123,67,92,190,192,182,7,84,253,204,85,105,73,82,35,254,132,
+253,204,36,82,72,71,83,36,254,132,184,254,132,36,82,72,72,82,36,4,74,250,
+215,119,86,25,254,33,162,162,1,223,24,86,118,215,250,1,108,254,130,164,121,
+56,120,127,202,218,120,113,54,54,116,117,218,202,129,119,55,55,118,130,0,
+0,5,0,160,0,0,7,244,5,182,0,23,0,33,0,44,0,55,0,66,0,0,1,20,6,35,34,39,6,
+7,22,17,17,33,17,16,55,38,39,6,35,34,38,53,17,33,1,20,22,51,50,54,54,53,53,
+33,33,21,20,22,22,51,50,54,54,53,53,33,21,20,22,22,51,50,54,54,53,53,1,52,
+38,38,35,34,6,6,21,21,33,7,244,182,192,190,93,15,18,126,253,20,125,17,16,
+92,190,192,182,7,84,253,204,85,105,73,82,35,254,132,253,204,36,81,73,71,82,
+37,252,80,36,82,72,72,82,36,2,52,35,83,72,74,81,35,1,124,4,74,250,215,119,
+20,16,108,254,248,254,168,1,88,1,7,109,15,20,118,215,250,1,108,254,148,176,
+127,56,120,127,202,202,130,118,55,53,118,132,202,202,129,119,55,55,118,130,
+202,252,68,126,113,50,51,109,129,182,0,0,3,0,160,0,0,3,140,5,182,0,13,0,24,
+0,35,0,0,1,16,7,22,17,17,33,17,16,55,38,17,17,33,3,52,38,38,35,34,6,6,21,
+21,33,1,21,20,22,22,51,50,54,54,53,53,3,140,126,126,253,20,125,125,2,236,
+184,36,82,72,73,80,37,1,124,254,132,35,81,74,74,82,34,4,94,254,248,109,112,
+254,243,254,148,1,108,1,11,115,109,1,7,1,88,251,182,129,119,55,55,116,132,
+202,4,114,182,128,110,51,52,115,122,182,0,2,0,200,0,0,8,36,5,182,0,39,0,50,
+0,0,33,17,33,17,35,17,52,38,35,35,34,6,21,17,35,17,52,54,54,51,33,50,22,21,
+17,33,17,52,54,54,51,33,50,22,21,21,20,0,5,17,17,54,54,53,52,38,35,33,34,
+6,21,4,234,254,202,184,39,61,180,59,41,184,34,82,84,1,92,119,81,1,54,34,82,
+84,2,14,48,52,254,159,254,223,216,242,26,47,254,227,59,41,2,104,253,152,4,
+176,59,41,39,61,251,80,4,238,86,80,34,81,119,254,28,1,228,86,80,34,55,44,
+186,244,254,209,14,253,152,3,10,12,194,168,97,51,39,61,0,1,0,80,0,0,2,240,
+5,182,0,13,0,0,1,50,22,21,17,35,17,52,38,35,33,19,51,3,2,40,119,81,184,39,
+61,254,124,162,176,129,3,78,81,119,253,122,2,72,59,41,3,10,253,152,0,4,0,
+160,0,0,7,174,5,182,0,39,0,52,0,65,0,75,0,0,1,17,20,6,35,33,34,38,38,53,17,
+52,54,54,51,33,17,52,54,54,51,33,50,22,21,17,33,50,22,21,17,20,6,35,33,34,
+38,38,53,17,33,34,6,21,17,20,22,51,51,50,54,53,17,1,20,22,51,51,50,54,53,
+17,52,38,35,33,39,17,52,38,35,35,34,6,21,17,3,140,79,121,254,164,86,80,34,
+34,82,84,1,108,34,82,84,1,22,119,81,1,108,119,81,79,121,254,164,86,80,34,
+252,250,59,41,39,61,180,59,41,2,166,39,61,180,59,41,39,61,254,232,184,39,
+61,110,59,41,2,172,254,28,119,81,34,81,85,1,190,86,80,34,1,160,86,80,34,81,
+119,254,96,81,119,254,66,119,81,34,81,85,1,228,39,61,254,190,59,41,39,61,
+1,166,254,90,59,41,39,61,1,66,59,41,162,1,98,59,41,39,61,254,158,0,0,1,0,
+200,0,0,5,232,5,202,0,33,0,0,51,17,16,54,51,50,23,54,51,50,22,22,21,17,35,
+17,52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,17,200,186,188,192,91,
+93,188,131,164,79,184,37,83,70,99,91,184,92,98,70,82,38,3,209,1,11,238,120,
+120,110,211,184,252,47,3,209,136,137,70,145,177,252,26,3,225,184,143,69,134,
+140,252,47,0,2,0,200,0,0,4,2,5,182,0,14,0,25,0,0,51,17,52,54,54,51,33,50,
+22,21,21,20,0,5,17,17,54,54,53,52,38,35,33,34,6,21,200,34,82,84,2,14,48,52,
+254,159,254,223,216,242,26,47,254,227,59,41,4,238,86,80,34,55,44,186,244,
+254,209,14,253,152,3,10,12,194,168,97,51,39,61,0,0,3,0,140,0,0,3,198,5,182,
+0,22,0,34,0,45,0,0,1,38,38,53,52,54,51,33,50,22,22,21,17,20,6,6,35,33,34,
+38,53,52,54,37,14,2,21,20,22,22,51,33,50,53,17,17,52,35,33,34,6,6,21,20,22,
+1,170,140,146,115,112,1,143,92,77,31,31,77,92,254,113,113,114,150,1,236,130,
+210,118,21,46,40,1,20,75,75,254,236,41,46,20,253,2,242,64,216,143,154,131,
+31,77,92,251,218,92,77,31,131,154,147,245,7,1,95,168,103,70,57,28,88,2,84,
+1,110,88,29,57,69,137,162,0,2,0,200,0,0,5,135,5,182,0,24,0,37,0,0,1,34,6,
+21,17,35,17,52,54,54,51,33,50,22,21,17,20,6,35,33,34,38,38,53,17,19,20,22,
+51,51,50,54,53,17,52,38,35,33,1,228,59,41,184,34,82,84,3,47,119,81,79,121,
+254,164,86,80,34,184,39,61,180,59,41,39,61,254,232,5,20,39,61,251,80,4,238,
+86,80,34,81,119,253,106,119,81,34,81,85,2,188,253,130,59,41,39,61,2,26,59,
+41,0,0,2,0,200,0,0,4,2,5,182,0,14,0,26,0,0,1,22,4,18,21,20,6,35,33,34,38,
+38,53,17,51,17,20,51,33,50,54,54,53,52,38,38,39,1,128,176,1,42,168,114,113,
+254,113,92,77,31,184,75,1,20,41,46,20,122,213,123,3,78,1,149,254,255,154,
+154,131,31,77,92,4,238,251,68,88,29,57,69,95,171,100,1,0,3,0,140,0,0,5,226,
+5,205,0,18,0,34,0,45,0,0,33,17,55,38,2,53,52,18,36,51,50,4,18,21,20,2,7,23,
+17,3,54,53,52,38,38,35,34,6,6,21,20,23,54,33,50,3,52,38,38,35,34,6,6,21,21,
+33,1,200,1,150,167,174,1,50,204,200,1,49,177,162,142,2,36,148,123,227,144,
+139,228,125,157,77,1,10,255,65,36,82,72,73,80,37,1,124,1,133,25,71,1,7,163,
+167,1,13,138,134,254,246,162,165,254,245,71,56,254,148,2,92,109,200,126,185,
+99,105,185,120,211,108,235,254,47,129,119,55,55,116,132,202,0,3,0,200,0,0,
+7,184,5,182,0,28,0,41,0,54,0,0,1,17,20,6,35,33,34,38,38,53,17,52,54,54,51,
+33,50,22,21,17,20,6,35,33,34,38,38,53,17,19,20,22,51,51,50,54,53,17,52,38,
+35,33,33,34,6,21,17,20,22,51,51,50,54,53,17,3,180,79,121,254,164,86,80,34,
+34,82,84,5,96,119,81,79,121,254,164,86,80,34,184,39,61,180,59,41,39,61,254,
+232,252,96,59,41,39,61,180,59,41,5,20,251,180,119,81,34,81,85,4,38,86,80,
+34,81,119,251,218,119,81,34,81,85,4,76,251,242,59,41,39,61,3,170,59,41,39,
+61,252,86,59,41,39,61,4,14,0,5,0,160,0,0,6,14,5,182,0,20,0,29,0,36,0,45,0,
+52,0,0,1,38,38,53,52,54,51,33,50,22,21,17,20,6,35,33,34,38,53,52,18,5,6,6,
+21,20,22,22,51,33,51,33,50,54,53,17,33,1,34,6,6,21,20,22,51,17,19,33,17,52,
+38,35,33,1,196,152,140,115,112,3,195,119,81,79,121,252,61,113,114,159,1,227,
+206,252,21,46,40,1,95,184,1,24,59,41,254,132,253,233,41,46,20,245,213,184,
+1,124,39,61,254,232,2,249,77,205,134,154,131,81,119,251,218,119,81,131,154,
+148,1,2,7,2,198,167,70,57,28,39,61,1,166,2,104,29,57,69,141,158,1,198,254,
+58,1,98,59,41,0,3,0,140,255,36,5,210,6,126,0,17,0,24,0,31,0,0,1,4,0,17,16,
+0,5,21,35,53,36,0,17,16,0,37,53,51,17,54,18,17,16,2,39,7,6,2,17,16,18,23,
+3,138,1,21,1,51,254,207,254,233,184,254,232,254,210,1,45,1,25,184,195,203,
+204,194,184,193,203,203,193,5,200,27,254,119,254,185,254,187,254,117,28,205,
+205,29,1,131,1,78,1,75,1,129,29,182,250,14,29,1,47,1,5,1,7,1,43,27,1,29,254,
+209,255,0,254,254,254,207,29,0,0,2,0,100,0,0,6,55,5,182,0,23,0,36,0,0,19,
+33,1,51,54,54,51,33,50,22,21,17,33,34,38,38,53,17,35,39,3,35,1,33,1,52,38,
+35,35,34,6,21,17,20,22,51,33,100,3,12,254,239,183,12,86,97,1,150,119,81,253,
+162,86,80,34,215,23,211,177,1,228,253,225,5,27,39,61,238,59,41,39,61,1,82,
+5,182,253,34,68,50,81,119,253,122,34,81,85,1,110,1,253,201,5,20,253,52,59,
+41,39,61,254,190,59,41,0,4,0,140,255,236,5,210,5,205,0,11,0,43,0,55,0,67,
+0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,52,54,51,50,22,21,20,7,54,18,53,52,2,
+39,22,21,20,6,35,34,38,53,52,55,6,2,21,20,18,23,38,19,20,22,51,50,54,53,52,
+38,35,34,6,17,20,22,51,50,54,53,52,38,35,34,6,5,210,254,157,254,193,254,189,
+254,159,1,95,1,71,1,62,1,98,252,125,135,92,91,135,7,127,136,136,128,8,132,
+94,95,132,8,130,140,139,130,7,126,59,42,42,59,57,48,41,56,59,42,42,59,59,
+42,42,59,2,221,254,161,254,110,1,139,1,104,1,101,1,137,254,113,252,162,97,
+130,130,97,24,33,59,1,34,217,215,1,33,59,30,29,94,132,132,94,30,30,56,254,
+222,218,216,254,220,60,27,4,22,42,59,59,42,41,60,59,251,225,42,59,59,42,42,
+59,59,0,2,0,160,0,0,6,35,5,182,0,33,0,46,0,0,33,17,52,38,35,35,34,6,21,17,
+20,6,35,33,34,38,38,53,17,52,54,54,51,33,17,52,54,54,51,33,50,22,21,17,1,
+34,6,21,17,20,22,51,51,50,54,53,17,5,107,39,61,221,59,41,79,121,254,106,86,
+80,34,34,82,84,1,166,34,82,84,1,133,119,81,251,153,59,41,39,61,238,59,41,
+4,176,59,41,39,61,252,24,119,81,34,81,85,1,190,86,80,34,1,160,86,80,34,81,
+119,251,18,2,172,39,61,254,190,59,41,39,61,1,166,0,0,2,0,160,0,0,5,235,5,
+182,0,32,0,43,0,0,1,17,20,6,35,35,22,21,17,33,17,52,55,35,34,38,38,53,17,
+51,17,20,22,51,33,17,51,17,33,50,54,53,17,1,52,38,38,35,34,6,6,21,21,33,5,
+235,79,121,163,60,253,20,58,162,86,80,34,184,39,61,1,45,185,1,45,59,41,254,
+209,35,81,74,74,80,36,1,124,5,182,253,190,119,81,109,180,254,117,1,139,185,
+104,34,81,85,2,66,253,252,59,41,2,104,253,152,39,61,2,4,251,213,126,111,50,
+49,108,130,233,0,0,2,0,140,0,0,6,84,5,182,0,32,0,45,0,0,33,33,34,38,38,39,
+3,35,34,36,38,53,52,54,51,33,50,30,2,23,19,22,22,51,50,54,55,19,51,3,6,6,
+1,35,34,6,6,21,20,22,51,51,3,38,38,5,30,254,227,36,46,28,13,70,43,191,254,
+215,161,115,112,1,106,64,71,38,17,10,153,9,34,42,43,33,10,187,180,187,18,
+55,253,85,246,41,46,20,236,199,49,56,8,36,37,75,88,1,228,120,225,148,154,
+131,15,44,78,63,252,24,66,34,33,67,4,176,251,18,121,79,5,20,29,57,69,142,
+157,1,110,54,34,0,0,4,0,100,0,0,6,225,5,182,0,15,0,26,0,30,0,34,0,0,1,33,
+22,21,17,33,17,52,55,33,1,51,7,33,39,51,1,52,38,38,35,34,6,6,21,21,33,1,33,
+21,33,33,53,33,7,6,225,253,219,93,253,20,91,253,220,1,51,184,90,3,91,90,184,
+254,179,35,83,72,74,81,35,1,124,1,47,254,111,1,234,253,93,254,111,89,2,172,
+113,225,254,166,1,90,227,111,3,10,228,228,251,164,126,113,50,51,109,129,184,
+3,142,226,226,226,0,1,0,200,0,0,6,19,5,182,0,24,0,0,37,20,6,35,33,34,38,38,
+53,17,51,17,20,22,51,33,17,51,17,33,50,54,53,17,51,6,19,79,121,252,69,86,
+80,34,184,39,61,1,45,184,1,46,59,41,184,200,119,81,34,81,85,4,238,251,80,
+59,41,5,20,250,236,39,61,4,176,0,0,4,0,60,0,0,5,80,5,182,0,27,0,38,0,49,0,
+61,0,0,1,16,7,22,17,17,33,17,52,55,35,22,21,20,6,35,34,38,53,52,54,51,23,
+33,38,53,17,33,3,52,38,38,35,34,6,6,21,21,33,1,21,20,22,22,51,50,54,54,53,
+53,1,20,22,51,50,54,53,52,38,35,34,6,5,80,126,126,253,20,73,173,10,135,96,
+96,135,135,96,22,1,92,49,2,236,184,36,82,72,73,80,37,1,124,254,132,35,81,
+74,74,82,34,252,38,59,42,42,59,57,48,41,56,4,94,254,248,109,112,254,243,254,
+148,1,108,207,113,34,34,96,135,135,96,96,135,1,101,171,1,88,251,182,129,119,
+55,55,116,132,202,4,114,182,128,110,51,52,115,122,182,253,84,42,59,59,42,
+41,60,59,0,0,3,0,60,0,0,4,248,5,182,0,26,0,37,0,48,0,0,33,17,52,55,35,23,
+20,6,35,34,38,53,52,54,51,23,33,38,53,17,33,17,16,7,22,17,17,3,52,38,38,35,
+34,6,6,21,21,33,1,21,20,22,22,51,50,54,54,53,53,2,12,73,177,4,107,75,77,105,
+105,77,18,1,57,49,2,236,126,126,184,36,82,72,73,80,37,1,124,254,132,35,81,
+74,74,82,34,1,108,207,113,44,87,119,122,84,85,122,1,101,171,1,88,254,168,
+254,248,109,112,254,243,254,148,1,108,129,119,55,55,116,132,202,4,114,182,
+128,110,51,52,115,122,182,0,4,0,100,0,0,7,24,5,182,0,9,0,19,0,23,0,27,0,0,
+51,1,54,54,51,51,50,22,23,1,1,33,3,38,38,35,35,34,6,7,1,3,33,17,19,33,3,33,
+100,2,112,26,58,53,194,53,58,26,2,112,251,109,2,114,209,19,35,26,48,25,36,
+19,254,228,212,2,1,185,1,246,212,254,222,5,62,56,64,64,56,250,194,3,12,1,
+194,40,30,29,41,253,156,254,56,1,200,254,56,1,200,0,0,2,0,140,255,186,5,173,
+5,247,0,31,0,43,0,0,5,53,6,35,34,36,2,53,52,55,17,51,21,54,55,53,51,21,54,
+51,50,4,18,21,20,7,17,35,17,6,7,21,1,20,18,51,50,18,53,52,2,35,34,2,3,173,
+74,70,207,254,215,153,85,154,67,89,154,52,58,201,1,41,156,48,154,69,87,253,
+7,239,224,223,238,235,224,226,239,70,133,13,166,1,51,208,202,158,1,180,252,
+54,33,165,128,8,168,254,203,201,146,128,253,243,1,33,65,42,182,3,31,252,254,
+244,1,9,255,253,1,7,254,246,0,3,0,200,255,89,6,19,5,182,0,13,0,20,0,29,0,
+0,19,52,54,54,51,33,50,22,21,17,20,6,7,1,1,34,6,21,17,37,17,19,37,54,53,17,
+52,38,35,33,200,34,82,84,3,187,119,81,36,43,251,4,1,28,59,41,1,145,184,1,
+80,66,39,61,254,210,4,238,86,80,34,81,119,252,239,122,86,14,254,90,5,187,
+39,61,251,147,133,4,76,251,242,111,23,74,2,218,59,41,0,1,0,40,255,236,5,109,
+5,203,0,29,0,0,19,51,18,0,33,50,23,7,38,35,34,4,7,33,21,33,18,0,33,50,54,
+55,21,6,6,35,32,0,3,35,40,245,24,1,105,1,47,242,174,76,171,167,215,254,249,
+20,2,197,253,57,7,1,14,1,8,99,175,86,100,173,116,254,191,254,147,19,242,3,
+78,1,45,1,80,86,154,78,253,222,162,254,249,254,232,35,23,160,35,24,1,103,
+1,89,0,1,0,60,255,236,6,104,5,203,0,39,0,0,1,38,35,34,4,7,33,21,33,18,0,33,
+50,54,55,21,6,6,35,32,0,3,35,23,20,6,35,34,38,53,52,54,51,23,33,18,0,33,50,
+23,6,28,171,167,215,254,249,20,2,197,253,57,7,1,14,1,8,99,175,86,100,173,
+116,254,191,254,147,19,113,4,107,75,77,105,105,77,18,1,20,24,1,105,1,47,242,
+174,4,219,78,253,222,162,254,249,254,232,35,23,160,35,24,1,103,1,89,44,87,
+119,122,84,85,122,1,1,45,1,80,86,0,4,0,100,0,0,6,125,5,182,0,11,0,22,0,26,
+0,30,0,0,1,33,22,21,17,33,17,52,55,33,1,33,3,52,38,38,35,34,6,6,21,21,33,
+19,35,17,33,33,17,35,3,6,125,254,13,93,253,20,91,254,14,1,151,2,235,183,35,
+83,72,74,81,35,1,124,85,183,1,169,253,158,184,241,2,172,113,225,254,166,1,
+90,227,111,3,10,251,164,126,113,50,51,109,129,184,4,114,254,58,1,198,254,
+58,0,0,1,0,100,255,236,7,218,5,203,0,53,0,0,55,22,51,50,18,17,33,53,33,38,
+38,35,34,7,39,54,54,51,50,0,19,51,18,0,51,50,22,23,7,38,35,34,2,7,33,21,33,
+16,18,51,50,55,21,6,35,34,0,3,35,2,0,35,34,39,106,162,108,182,189,254,51,
+1,203,6,177,141,148,103,70,73,149,101,230,1,9,20,233,17,1,11,232,101,147,
+75,70,103,148,142,176,6,1,203,254,51,189,182,108,162,145,154,249,254,240,
+14,231,14,254,240,248,154,145,190,49,1,24,1,7,162,220,255,71,150,44,39,254,
+187,254,200,1,50,1,75,38,45,150,71,255,0,219,162,254,249,254,232,49,164,46,
+1,94,1,98,254,159,254,161,46,0,3,0,160,255,236,7,238,5,203,0,51,0,63,0,74,
+0,0,37,6,35,34,0,3,35,17,20,6,6,35,33,34,38,53,52,54,55,38,38,53,52,54,51,
+33,50,22,22,21,17,51,18,0,51,50,22,23,7,38,35,34,2,7,33,21,33,16,18,51,50,
+55,1,14,2,21,20,22,22,51,33,50,53,17,52,35,33,34,6,6,21,20,22,51,7,232,145,
+154,249,254,240,14,204,31,77,92,254,113,113,114,150,136,140,146,115,112,1,
+143,92,77,31,205,17,1,11,232,101,147,75,70,103,148,142,176,6,1,203,254,51,
+189,182,108,162,251,58,125,212,121,21,46,40,1,20,75,75,254,236,41,46,20,253,
+205,26,46,1,94,1,98,254,28,92,77,31,131,154,147,245,77,64,216,143,154,131,
+31,77,92,254,96,1,50,1,75,38,45,150,71,255,0,219,162,254,249,254,232,49,1,
+238,1,101,170,95,70,57,28,85,3,197,88,29,57,69,137,162,0,0,4,0,100,255,236,
+10,10,5,203,0,38,0,49,0,53,0,57,0,0,33,17,52,55,33,1,33,1,51,18,0,51,50,22,
+23,7,38,35,34,2,7,33,21,33,16,18,51,50,55,21,6,35,34,0,3,33,22,21,17,3,52,
+38,38,35,34,6,6,21,21,33,19,35,17,33,33,17,35,3,1,251,91,254,14,1,151,2,235,
+1,66,155,17,1,11,232,101,147,75,70,103,148,142,176,6,1,203,254,51,189,182,
+108,162,145,154,249,254,240,14,253,200,93,184,35,83,72,74,81,35,1,124,85,
+183,1,169,253,158,184,241,1,90,227,111,3,10,253,152,1,50,1,75,38,45,150,71,
+255,0,219,162,254,249,254,232,49,164,46,1,94,1,98,113,225,254,166,1,90,126,
+113,50,51,109,129,184,4,114,254,58,1,198,254,58,0,0,3,0,140,255,236,6,222,
+5,205,0,34,0,40,0,46,0,0,1,53,52,38,35,35,2,0,35,34,0,3,35,34,6,21,21,35,
+53,52,54,54,51,51,18,0,51,50,0,19,51,50,22,21,21,1,50,18,19,33,18,1,34,6,
+7,33,2,6,58,39,61,31,8,254,250,233,238,254,254,9,31,59,41,184,34,82,84,117,
+19,1,1,229,220,1,0,22,98,119,81,252,226,153,157,7,253,131,13,1,53,146,158,
+15,2,120,26,2,33,39,59,41,254,175,254,145,1,100,1,92,39,61,39,101,86,80,34,
+1,58,1,69,254,183,254,202,81,119,101,254,106,1,10,1,23,253,223,4,160,235,
+242,1,221,0,4,0,160,0,0,4,126,5,182,0,29,0,41,0,50,0,59,0,0,1,33,6,7,22,22,
+21,21,33,53,52,54,55,38,38,53,52,54,55,38,53,53,33,21,20,6,7,22,23,33,37,
+34,6,21,20,22,51,50,54,53,52,38,19,53,52,38,35,34,6,21,21,17,21,20,22,51,
+50,54,53,53,4,126,254,243,19,92,52,66,253,40,56,52,57,50,50,57,108,2,216,
+68,52,60,31,1,35,253,142,81,97,97,81,81,97,100,102,96,84,83,97,97,83,83,97,
+2,172,116,74,46,150,64,234,234,79,134,48,47,126,63,63,125,47,98,164,234,234,
+66,149,47,49,71,37,86,66,66,86,85,67,68,84,253,47,72,87,96,95,88,72,4,114,
+72,87,96,95,88,72,0,0,1,0,100,0,0,2,42,5,182,0,5,0,0,19,33,17,35,17,33,100,
+1,198,184,254,242,5,182,250,74,5,20,0,3,0,160,0,0,5,102,5,182,0,7,0,10,0,
+13,0,0,1,17,35,17,1,17,1,17,1,17,33,5,17,1,5,102,184,251,242,4,14,252,160,
+2,115,253,141,2,115,5,182,250,74,2,85,253,254,5,19,253,244,2,92,254,165,254,
+205,162,254,216,1,40,0,1,0,100,255,236,7,134,5,205,0,64,0,0,1,52,38,39,17,
+35,17,14,2,21,20,22,23,22,22,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,
+39,38,53,52,18,36,51,50,4,18,21,20,7,6,6,21,20,22,51,50,55,23,6,6,35,34,38,
+38,53,52,54,55,54,54,6,40,240,231,184,150,208,113,68,71,75,63,154,143,147,
+170,13,176,33,113,58,61,46,92,139,189,1,77,227,224,1,79,190,138,92,47,62,
+57,112,34,176,16,173,141,95,132,70,60,79,69,69,3,142,182,214,18,250,212,5,
+44,12,99,181,122,100,174,89,97,145,80,116,129,140,139,29,144,57,54,44,89,
+125,187,210,172,1,13,134,133,254,243,173,210,187,124,89,45,55,58,146,29,139,
+140,64,114,74,70,133,104,91,179,0,1,0,140,0,0,5,28,4,74,0,29,0,0,1,17,33,
+50,22,22,21,17,35,17,52,38,35,35,17,35,17,35,34,6,21,17,35,17,52,54,54,51,
+33,17,3,44,1,102,55,59,24,176,25,45,250,176,250,45,25,176,25,60,53,1,102,
+4,74,254,54,30,66,84,254,52,1,159,45,35,254,17,1,239,35,45,254,97,1,204,86,
+65,29,1,202,0,0,1,0,180,0,0,5,68,4,74,0,30,0,0,1,17,55,54,54,53,17,51,17,
+20,6,6,7,5,21,20,22,22,51,33,21,33,34,38,38,53,17,51,17,37,17,3,84,254,41,
+25,176,25,63,65,252,185,12,22,36,3,128,252,20,58,57,23,176,1,64,4,74,254,
+32,23,4,32,48,1,117,254,78,75,49,25,6,82,202,31,35,14,145,29,66,85,3,150,
+253,243,29,1,240,0,0,3,0,180,0,0,6,168,4,74,0,31,0,44,0,57,0,0,37,17,52,54,
+54,51,33,50,22,22,21,17,20,6,6,35,33,34,38,38,53,17,52,54,54,51,33,50,22,
+22,21,17,3,52,38,35,35,34,6,21,17,20,22,51,51,33,50,54,53,17,52,38,35,35,
+34,6,21,17,4,28,25,59,54,1,120,55,58,25,25,59,54,251,32,55,58,25,25,59,54,
+1,120,55,58,25,176,26,44,160,44,26,26,44,230,3,34,44,26,26,44,160,44,26,145,
+3,5,83,67,30,31,67,82,253,30,83,67,30,31,67,82,2,226,83,67,30,31,67,82,252,
+251,2,216,45,35,35,45,253,120,45,35,35,45,2,136,45,35,35,45,253,40,0,0,3,
+0,140,0,0,5,215,4,74,0,28,0,35,0,48,0,0,33,34,38,38,53,53,35,3,35,19,38,38,
+53,53,52,54,51,33,3,51,54,54,51,33,50,22,22,21,17,1,34,6,21,16,23,19,1,52,
+38,35,35,34,6,21,21,20,22,51,51,3,223,55,58,25,215,153,166,160,153,186,45,
+38,2,173,214,163,8,58,68,1,110,55,58,25,251,162,36,25,218,152,2,121,26,44,
+150,44,26,26,44,220,31,67,82,217,254,115,1,160,42,252,164,150,35,39,253,212,
+52,46,31,67,82,254,52,3,185,30,54,254,253,53,1,140,253,230,45,35,35,45,190,
+45,35,0,0,3,0,180,0,0,6,158,4,74,0,37,0,50,0,63,0,0,37,20,6,35,35,34,38,53,
+17,52,54,51,33,50,22,22,21,21,33,50,22,22,21,17,20,6,6,35,33,34,38,38,53,
+17,52,38,35,35,33,34,6,21,17,20,22,51,51,50,54,53,17,1,20,22,51,51,50,54,
+53,53,52,38,35,35,3,64,83,117,252,114,86,85,115,2,198,55,58,25,1,72,55,58,
+25,25,59,54,254,146,55,58,25,26,44,150,254,136,59,41,39,61,100,59,41,2,60,
+26,44,150,44,26,26,44,220,200,116,84,83,117,2,186,119,81,31,67,82,238,31,
+67,82,254,192,83,67,30,31,67,82,2,181,45,35,39,61,253,160,59,41,39,61,2,196,
+253,40,45,35,35,45,230,45,35,0,1,0,80,255,236,3,152,4,94,0,24,0,0,5,34,39,
+53,22,51,32,19,33,53,33,38,38,35,34,7,39,54,54,51,32,0,17,16,0,1,115,169,
+122,154,141,1,80,23,253,227,2,27,14,162,156,105,151,51,64,165,76,1,1,1,9,
+254,225,20,59,156,62,1,104,147,168,155,54,146,29,34,254,221,254,234,254,241,
+254,214,0,3,0,180,0,0,6,168,5,112,0,48,0,61,0,74,0,0,1,35,17,20,6,6,35,33,
+34,38,38,53,17,52,54,54,51,33,38,35,35,53,51,50,22,23,54,54,51,51,21,35,34,
+7,33,50,22,22,21,17,20,6,6,35,33,34,38,38,53,55,20,22,51,51,50,54,53,17,52,
+38,35,35,33,34,6,21,17,20,22,51,51,50,54,53,17,4,28,220,25,59,54,254,136,
+55,58,25,25,59,54,1,242,65,239,41,30,154,225,62,61,224,156,30,41,243,61,1,
+242,55,58,25,25,59,54,254,136,55,58,25,176,26,44,160,44,26,26,44,230,252,
+222,44,26,26,44,160,44,26,3,185,252,251,83,67,30,31,67,82,2,226,83,67,30,
+149,145,105,107,106,106,145,149,31,67,82,253,30,83,67,30,31,67,82,45,45,35,
+35,45,2,136,45,35,35,45,253,120,45,35,35,45,2,216,0,0,4,0,140,0,0,4,224,4,
+74,0,29,0,39,0,49,0,62,0,0,33,34,38,38,53,17,52,54,54,51,33,17,52,54,51,33,
+50,22,21,21,20,7,22,22,21,17,20,6,6,35,37,51,50,54,53,53,52,38,35,35,33,34,
+6,21,21,20,22,51,51,17,55,50,54,54,53,52,38,35,35,34,6,21,21,1,22,55,58,25,
+25,59,54,1,72,57,64,1,159,42,64,120,68,52,25,59,54,254,184,220,44,26,26,44,
+220,254,116,44,26,26,44,220,191,88,124,69,23,28,195,35,15,31,67,82,1,24,83,
+67,30,1,62,77,63,46,48,70,181,114,3,69,107,254,232,83,67,30,145,35,45,190,
+45,35,35,45,190,45,35,1,94,145,61,105,62,56,29,37,38,238,0,4,0,180,0,0,6,
+32,4,74,0,25,0,38,0,44,0,50,0,0,1,50,22,22,21,17,20,6,6,35,33,34,38,38,53,
+17,35,6,2,35,35,17,51,50,22,23,1,20,22,51,51,50,54,53,53,52,38,35,35,1,50,
+54,55,35,17,17,51,38,38,35,35,5,150,55,58,25,25,59,54,254,146,55,58,25,135,
+14,226,180,191,191,183,217,18,1,57,26,44,150,44,26,26,44,220,253,65,92,108,
+8,251,250,13,105,87,45,2,128,31,67,82,254,232,83,67,30,31,67,82,1,59,229,
+254,246,4,74,239,220,254,98,45,35,35,45,190,45,35,254,162,180,170,254,162,
+1,238,153,163,0,0,4,0,140,0,0,6,196,4,74,0,23,0,34,0,44,0,54,0,0,1,20,6,35,
+34,39,6,7,17,51,21,33,53,51,17,38,39,6,35,34,38,53,17,33,5,21,20,22,22,51,
+50,54,54,53,53,51,21,20,22,51,50,54,54,53,53,51,21,20,22,51,50,54,54,53,53,
+6,196,168,157,150,85,60,88,163,254,10,163,94,59,86,144,157,168,6,56,250,120,
+29,65,55,56,63,28,176,70,79,56,63,28,176,66,81,55,65,29,3,74,186,187,105,
+71,24,254,178,145,145,1,77,20,70,99,187,186,1,0,145,110,93,89,45,40,84,102,
+111,122,119,96,40,84,104,109,122,126,89,45,90,92,110,0,5,0,140,0,0,6,196,
+4,74,0,22,0,32,0,43,0,53,0,63,0,0,1,20,6,35,34,39,7,22,22,21,21,33,17,52,
+55,39,6,35,34,38,53,17,33,5,21,20,22,51,50,54,54,53,53,33,21,20,22,22,51,
+50,54,54,53,53,33,21,20,22,51,50,54,54,53,53,1,52,38,38,35,34,6,21,21,33,
+6,196,168,157,150,85,28,53,63,253,120,105,22,86,144,157,168,6,56,252,80,70,
+79,56,63,28,253,0,29,65,55,56,63,28,2,136,66,81,55,65,29,254,40,28,62,57,
+78,71,1,40,3,74,186,187,105,30,46,150,94,254,1,0,197,91,24,99,187,186,1,0,
+145,122,119,96,40,84,102,111,110,93,89,45,40,84,102,111,122,126,89,45,90,
+92,110,253,71,95,80,38,90,124,110,0,0,3,0,160,0,0,3,40,4,74,0,15,0,25,0,36,
+0,0,1,20,6,7,22,22,21,17,33,17,52,55,38,53,53,33,3,52,38,38,35,34,6,21,21,
+33,1,21,20,22,22,51,50,54,54,53,53,3,40,62,54,53,63,253,120,105,105,2,136,
+176,28,62,57,78,71,1,40,254,216,29,65,55,56,63,28,3,96,94,156,50,46,150,94,
+254,238,1,20,197,91,98,200,236,252,202,95,80,38,90,124,130,3,40,90,93,89,
+45,40,84,102,91,0,2,0,180,0,0,6,206,4,74,0,42,0,52,0,0,1,35,17,35,17,52,38,
+38,35,35,34,6,6,21,17,35,17,52,54,54,51,33,50,22,22,21,17,51,17,52,54,54,
+51,33,50,22,21,21,20,4,7,17,35,19,54,54,53,52,38,35,35,34,21,4,28,220,176,
+12,32,36,140,34,33,13,176,29,72,69,1,56,72,70,28,220,27,61,53,1,199,42,52,
+254,250,252,176,176,165,173,19,32,221,66,1,199,254,57,3,85,56,31,13,11,28,
+61,252,171,3,140,101,64,25,29,69,102,254,213,1,73,74,65,31,46,48,130,194,
+215,12,254,59,2,85,5,131,135,41,44,75,0,0,1,0,60,0,0,2,122,4,74,0,14,0,0,
+19,51,3,51,50,22,22,21,17,35,17,52,38,35,33,221,166,123,232,55,58,25,176,
+26,44,254,184,4,74,254,54,31,67,82,254,52,1,159,45,35,0,4,0,140,0,0,6,108,
+4,74,0,43,0,56,0,69,0,81,0,0,1,17,20,6,6,35,33,34,38,38,53,17,52,54,54,51,
+33,17,52,54,54,51,33,50,22,22,21,17,33,50,22,22,21,17,20,6,6,35,33,34,38,
+38,53,17,19,20,22,51,51,50,54,53,53,52,38,35,35,33,34,6,21,21,20,22,51,51,
+50,54,53,17,1,52,38,38,35,35,34,6,6,21,21,51,3,14,25,59,54,254,146,55,58,
+25,25,59,54,1,72,22,55,73,1,16,75,54,21,1,72,55,58,25,25,59,54,254,146,55,
+58,25,176,26,44,150,44,26,26,44,220,252,232,44,26,26,44,150,44,26,1,140,9,
+25,26,100,26,24,10,220,1,239,254,197,83,67,30,31,67,82,1,24,83,67,30,1,32,
+93,55,22,23,60,87,254,224,31,67,82,254,232,83,67,30,31,67,82,1,59,254,242,
+45,35,35,45,190,45,35,35,45,190,45,35,35,45,1,14,1,102,58,30,12,12,29,59,
+213,0,0,1,0,180,0,0,5,20,4,94,0,31,0,0,33,17,52,38,35,34,6,6,21,17,35,17,
+52,38,35,34,6,21,17,35,17,52,54,51,50,23,54,51,50,22,21,17,4,100,71,78,56,
+63,28,176,64,83,78,71,176,170,155,149,86,86,149,155,170,2,245,124,90,37,79,
+97,253,10,2,244,126,89,90,124,253,11,2,246,177,183,99,99,184,176,253,10,0,
+2,0,180,0,0,3,102,4,74,0,13,0,23,0,0,19,52,54,51,33,50,22,21,21,20,4,7,17,
+35,19,54,54,53,52,38,35,35,34,21,180,77,84,1,179,42,52,254,250,252,176,176,
+165,173,19,32,221,66,3,160,93,77,46,48,130,194,215,12,254,59,2,85,5,131,135,
+41,44,75,0,3,0,160,0,0,3,88,4,74,0,21,0,32,0,44,0,0,33,33,34,38,53,52,54,
+55,38,38,53,52,51,33,50,22,22,21,17,20,6,6,3,6,6,21,20,22,51,51,50,54,53,
+17,53,52,38,35,35,34,6,6,21,20,22,2,163,254,196,99,100,128,114,111,131,179,
+1,100,70,66,25,27,65,84,155,191,27,35,235,30,19,20,37,203,34,36,16,172,96,
+118,107,183,59,48,163,110,214,20,50,77,252,220,67,57,23,1,242,11,144,105,
+52,41,35,31,1,173,247,31,35,16,31,46,99,113,0,2,0,180,0,0,4,194,4,74,0,27,
+0,40,0,0,1,34,6,6,21,17,35,17,52,54,54,51,33,50,22,22,21,17,20,6,6,35,33,
+34,38,38,53,17,19,20,22,51,51,50,54,53,17,52,38,35,35,1,180,34,33,13,176,
+29,72,69,2,218,55,58,25,25,59,54,254,146,55,58,25,176,26,44,150,44,26,26,
+44,220,3,185,11,28,61,252,171,3,140,101,64,25,31,67,82,254,92,83,67,30,31,
+67,82,1,199,254,102,45,35,35,45,1,74,45,35,0,0,2,0,180,0,0,3,88,4,74,0,14,
+0,25,0,0,1,22,4,21,20,6,6,35,33,34,38,38,53,17,51,1,52,38,39,17,20,22,51,
+51,50,54,1,100,229,1,15,41,85,73,254,216,86,67,28,176,1,70,171,155,19,30,
+215,34,28,2,128,2,231,193,80,86,48,22,57,68,3,183,252,164,120,136,5,254,224,
+31,35,40,0,3,0,120,0,0,4,170,4,94,0,16,0,30,0,40,0,0,33,17,38,38,53,52,54,
+54,51,50,22,22,21,20,6,7,17,1,20,23,54,51,50,23,54,53,52,38,35,34,6,1,52,
+38,38,35,34,6,21,21,33,1,77,102,111,128,242,167,168,241,128,114,99,253,84,
+74,74,213,195,85,79,195,165,169,191,1,252,29,64,54,74,75,1,40,1,66,60,200,
+110,121,196,109,110,194,122,112,201,57,254,190,2,182,126,74,166,170,76,128,
+133,144,144,253,217,100,91,46,105,133,130,0,0,3,0,180,0,0,6,168,4,74,0,31,
+0,44,0,57,0,0,1,17,20,6,6,35,33,34,38,38,53,17,52,54,54,51,33,50,22,22,21,
+17,20,6,6,35,33,34,38,38,53,17,19,20,22,51,51,50,54,53,17,52,38,35,35,33,
+34,6,21,17,20,22,51,51,50,54,53,17,3,64,25,59,54,254,136,55,58,25,25,59,54,
+4,224,55,58,25,25,59,54,254,136,55,58,25,176,26,44,160,44,26,26,44,230,252,
+222,44,26,26,44,160,44,26,3,185,252,251,83,67,30,31,67,82,2,226,83,67,30,
+31,67,82,253,30,83,67,30,31,67,82,3,5,253,40,45,35,35,45,2,136,45,35,35,45,
+253,120,45,35,35,45,2,216,0,5,0,160,0,0,5,52,4,74,0,21,0,28,0,36,0,43,0,52,
+0,0,1,38,38,53,52,51,33,50,22,22,21,17,20,6,6,35,33,34,38,53,52,54,1,51,50,
+54,53,17,33,39,6,6,21,20,22,51,33,19,33,53,52,38,43,2,33,34,6,6,21,20,22,
+23,1,146,111,131,179,3,87,55,58,25,25,59,54,252,189,99,100,128,2,56,230,44,
+26,254,212,176,155,191,27,35,1,28,176,1,44,26,44,230,176,254,252,34,36,16,
+172,174,2,51,48,163,110,214,31,67,82,253,30,83,67,30,96,118,107,183,254,153,
+35,45,1,14,3,11,144,105,52,41,1,238,234,45,35,16,31,46,99,113,8,0,0,3,0,130,
+254,170,5,111,5,136,0,17,0,23,0,28,0,0,1,20,0,5,17,35,17,38,0,53,52,0,37,
+17,51,17,22,0,5,16,5,17,6,6,5,16,37,17,36,5,111,254,225,255,0,176,252,254,
+222,1,32,1,4,170,253,1,34,251,207,1,104,188,172,3,119,254,155,1,101,2,37,
+245,254,212,20,254,186,1,70,21,1,44,244,250,1,39,20,1,46,254,210,25,254,212,
+240,254,131,37,3,66,19,211,186,1,119,39,252,192,39,0,0,2,0,80,0,0,5,12,4,
+74,0,23,0,36,0,0,19,33,3,51,54,54,51,33,50,22,22,21,17,33,34,38,38,53,53,
+35,3,35,1,33,1,52,38,35,35,34,6,21,21,20,22,51,51,80,2,113,214,163,8,58,68,
+1,110,55,58,25,254,8,55,58,25,215,153,166,1,111,254,109,4,12,26,44,150,44,
+26,26,44,220,4,74,253,212,52,46,31,67,82,254,52,31,67,82,217,254,115,3,185,
+253,230,45,35,35,45,190,45,35,0,4,0,130,255,46,4,121,4,91,0,14,0,43,0,55,
+0,67,0,0,1,20,2,7,21,35,53,38,2,53,16,0,51,50,0,37,55,6,6,21,20,22,23,39,
+52,54,51,50,22,21,7,54,54,53,52,38,39,22,21,20,6,35,34,38,19,20,22,51,50,
+54,53,52,38,35,34,6,17,20,22,51,50,54,53,52,38,35,34,6,4,121,221,200,178,
+194,222,1,12,242,232,1,17,253,64,3,63,69,64,67,2,111,83,81,113,3,69,68,72,
+66,4,116,78,80,114,108,51,35,36,51,51,36,35,51,51,35,36,51,51,36,35,51,2,
+36,241,254,217,29,193,194,30,1,43,235,1,12,1,43,254,207,88,36,52,200,134,
+126,205,57,30,78,116,113,81,35,57,208,128,134,203,51,16,22,83,111,115,253,
+139,35,51,51,35,36,51,51,2,160,35,51,51,35,36,51,51,0,0,2,0,140,0,0,4,234,
+4,74,0,37,0,50,0,0,33,17,52,38,38,35,35,34,6,6,21,17,20,6,6,35,33,34,38,38,
+53,17,52,54,54,51,33,17,52,54,54,51,33,50,22,22,21,17,1,34,6,21,21,20,22,
+51,51,50,54,53,17,4,58,12,32,36,140,34,33,13,25,59,54,254,146,55,58,25,25,
+59,54,1,72,29,72,69,1,56,72,70,28,252,152,44,26,26,44,150,44,26,3,85,56,31,
+13,11,28,61,253,95,83,67,30,31,67,82,1,24,83,67,30,1,12,101,64,25,29,69,102,
+252,126,1,239,35,45,190,45,35,35,45,1,14,0,2,0,140,0,0,5,28,4,74,0,33,0,43,
+0,0,33,17,52,55,35,34,38,38,53,17,51,17,20,22,51,51,17,51,17,51,50,54,53,
+17,51,17,20,6,6,35,35,22,21,17,3,52,38,38,35,34,6,21,21,33,1,144,47,169,55,
+58,25,176,25,45,250,176,250,45,25,176,25,58,55,177,55,176,28,62,57,78,71,
+1,40,1,24,128,87,29,64,87,1,167,254,134,45,35,1,202,254,54,35,45,1,122,254,
+89,86,65,29,91,126,254,234,1,24,95,80,38,90,124,134,0,0,2,0,120,0,0,4,246,
+4,74,0,30,0,41,0,0,33,35,34,38,38,39,3,38,36,53,52,54,51,51,50,22,22,23,19,
+22,22,51,50,54,55,19,51,3,14,2,1,35,34,6,21,20,22,23,39,38,38,3,211,129,56,
+53,28,11,53,240,254,223,99,100,243,79,69,33,10,112,6,18,25,25,19,6,137,169,
+143,14,27,52,254,9,175,34,28,169,165,38,5,24,19,50,78,1,98,8,210,165,117,
+97,21,55,71,253,28,40,26,28,38,3,119,252,73,85,44,18,3,185,40,53,97,112,9,
+245,31,35,0,4,0,80,0,0,5,70,4,74,0,15,0,25,0,29,0,33,0,0,1,51,7,33,39,51,
+19,33,22,21,17,33,17,52,55,33,5,52,38,38,35,34,6,21,21,33,19,33,21,41,2,53,
+33,1,55,149,58,2,113,57,149,231,254,145,55,253,120,47,254,155,3,14,28,62,
+57,78,71,1,40,213,254,229,1,85,252,188,1,83,254,230,4,74,161,161,253,165,
+91,126,254,234,1,24,128,87,215,95,80,38,90,124,134,2,145,162,162,0,0,1,0,
+180,0,0,5,68,4,74,0,25,0,0,37,20,6,6,35,33,34,38,38,53,17,51,17,20,22,51,
+51,17,51,17,51,50,54,53,17,51,5,68,25,58,55,252,132,55,58,25,176,25,45,250,
+176,250,45,25,176,180,86,65,29,29,64,87,3,150,252,151,45,35,3,185,252,71,
+35,45,3,105,0,4,0,80,0,0,4,125,4,74,0,26,0,37,0,48,0,60,0,0,1,20,7,22,21,
+17,33,17,52,55,35,22,21,20,6,35,34,38,53,52,54,51,33,38,53,53,33,3,53,52,
+38,38,35,34,6,6,21,21,17,21,20,22,22,51,50,54,54,53,53,1,20,22,51,50,54,53,
+52,38,35,34,6,4,125,106,106,253,120,58,123,8,106,77,74,107,104,77,1,20,36,
+2,136,176,27,62,58,55,65,29,29,65,55,56,63,28,252,234,45,33,35,45,45,38,32,
+43,3,80,193,99,99,192,254,247,1,11,160,86,27,27,76,107,108,75,72,109,81,125,
+252,252,71,112,101,84,41,45,90,92,111,3,40,96,93,89,45,40,84,102,97,254,18,
+34,46,46,34,32,46,46,0,3,0,80,0,0,4,71,4,74,0,25,0,36,0,47,0,0,1,20,7,22,
+21,17,33,17,52,55,35,23,20,6,35,34,38,53,52,54,51,33,38,53,53,33,3,53,52,
+38,38,35,34,6,6,21,21,17,21,20,22,22,51,50,54,54,53,53,4,71,106,106,253,120,
+58,140,4,84,60,59,86,80,57,1,10,36,2,136,176,27,62,58,55,65,29,29,65,55,56,
+63,28,3,80,193,99,99,192,254,247,1,11,160,86,36,67,96,95,68,65,98,81,125,
+252,252,71,112,101,84,41,45,90,92,111,3,40,96,93,89,45,40,84,102,97,0,0,4,
+0,80,0,0,5,118,4,73,0,9,0,17,0,21,0,25,0,0,51,1,54,54,51,51,50,22,23,1,1,
+35,34,7,3,33,3,38,1,33,17,35,1,33,3,35,80,1,212,20,43,40,176,40,43,20,1,212,
+253,132,46,16,24,153,1,176,153,24,254,48,1,91,201,1,101,1,90,146,200,3,239,
+42,48,48,42,252,17,3,208,53,254,183,1,73,53,252,193,1,58,254,198,1,58,0,0,
+2,0,130,255,196,4,83,4,111,0,28,0,40,0,0,5,53,7,34,0,53,52,55,17,51,21,54,
+55,53,51,21,54,51,50,0,21,20,7,17,35,53,6,7,21,1,20,22,51,50,54,53,52,38,
+35,34,6,2,167,65,217,254,245,34,140,46,54,140,48,29,217,1,13,48,140,47,53,
+254,7,162,143,149,156,157,151,142,160,60,108,3,1,17,222,116,90,1,133,196,
+35,22,139,105,5,254,242,225,133,106,254,151,191,33,19,139,2,88,158,190,179,
+169,170,176,186,0,0,3,0,180,255,116,5,68,4,74,0,14,0,21,0,31,0,0,19,52,54,
+54,51,33,50,22,22,21,17,20,6,7,1,1,17,35,34,6,21,17,37,37,54,54,53,17,52,
+38,35,35,180,25,60,53,3,124,55,59,24,34,40,251,186,1,240,250,45,25,1,240,
+1,8,35,21,25,45,250,3,150,86,65,29,30,66,84,254,23,128,83,13,254,167,1,52,
+3,17,35,45,252,218,156,84,11,47,37,1,215,45,35,0,0,1,0,40,255,236,4,52,4,
+94,0,27,0,0,19,51,54,36,51,50,22,23,7,38,35,34,6,7,33,21,33,18,33,50,55,21,
+6,35,34,0,39,35,40,200,20,1,9,233,75,163,67,51,151,105,156,162,14,2,27,253,
+227,23,1,80,141,154,122,169,247,254,226,15,197,2,128,235,243,34,29,146,54,
+155,168,145,254,150,62,156,59,1,11,248,0,1,0,60,255,236,4,255,4,94,0,36,0,
+0,1,38,35,34,6,7,33,21,33,18,33,50,55,21,6,35,34,0,39,35,23,20,6,35,34,38,
+53,52,54,51,51,54,36,51,50,22,23,4,191,151,105,156,162,14,2,27,253,227,23,
+1,80,141,154,122,169,247,254,226,15,92,1,84,60,59,86,86,59,238,20,1,9,233,
+75,163,67,3,141,54,155,168,145,254,150,62,156,59,1,11,248,18,67,96,95,68,
+69,94,235,243,34,29,0,4,0,80,0,0,5,118,4,74,0,11,0,22,0,26,0,30,0,0,1,1,33,
+22,21,17,33,17,52,55,33,1,1,53,52,38,38,35,34,6,6,21,21,1,33,17,35,1,33,3,
+35,4,74,1,44,254,121,56,253,120,47,254,130,1,24,2,15,27,62,58,55,65,29,254,
+235,1,91,203,1,103,1,85,157,184,4,74,253,165,92,138,254,247,1,11,144,84,2,
+91,252,71,112,101,84,41,45,90,92,111,1,239,1,57,254,199,1,57,0,1,0,80,255,
+236,5,246,4,94,0,53,0,0,1,33,22,22,51,50,55,21,6,35,34,2,39,35,6,2,35,34,
+39,53,22,22,51,50,54,55,33,53,33,38,38,35,34,6,7,39,54,51,50,22,23,51,54,
+54,51,50,23,7,38,38,35,34,3,33,5,159,254,162,8,123,107,111,87,80,128,193,
+213,11,194,11,215,191,128,80,62,90,46,105,122,11,254,162,1,93,12,121,110,
+39,86,31,37,99,123,183,203,16,198,17,203,182,123,99,37,27,89,40,226,18,1,
+94,1,239,173,189,36,156,33,1,10,249,249,254,246,33,156,24,12,182,180,145,
+172,151,16,13,154,30,241,237,239,239,30,154,12,17,254,189,0,3,0,160,255,236,
+6,130,4,94,0,49,0,60,0,72,0,0,1,38,38,35,34,3,33,21,33,22,22,51,50,55,21,
+6,35,34,2,39,35,17,20,6,6,35,33,34,38,53,52,54,55,38,38,53,52,51,33,50,22,
+22,21,17,51,54,54,51,50,23,1,6,6,21,20,22,51,51,50,54,53,17,52,38,35,35,34,
+6,6,21,20,22,23,6,93,27,89,40,226,18,1,94,254,162,8,123,107,111,87,80,128,
+193,213,11,184,27,65,89,254,196,99,100,128,114,111,131,179,1,100,70,66,25,
+186,17,203,182,123,99,252,38,155,191,27,35,235,30,19,20,37,203,34,36,16,172,
+174,3,166,12,17,254,189,145,173,189,36,156,33,1,10,249,254,164,67,57,23,96,
+118,107,183,59,48,163,110,214,20,50,77,254,201,239,239,30,253,178,11,144,
+105,52,41,35,31,2,164,31,35,16,31,46,99,113,8,0,0,4,0,80,255,236,7,254,4,
+94,0,37,0,48,0,52,0,56,0,0,37,6,35,34,2,39,33,22,21,17,33,17,52,55,33,1,33,
+19,51,54,54,51,50,23,7,38,38,35,34,3,33,21,33,22,22,51,50,55,5,53,52,38,38,
+35,34,6,6,21,21,1,33,17,35,1,33,3,35,7,253,80,128,193,213,11,254,99,56,253,
+120,47,254,130,1,24,2,226,228,96,17,203,182,123,99,37,27,89,40,226,18,1,94,
+254,162,8,123,107,111,87,251,122,27,62,58,55,65,29,254,235,1,91,203,1,103,
+1,85,157,184,13,33,1,10,249,92,138,254,247,1,11,144,84,2,91,254,54,239,239,
+30,154,12,17,254,189,145,173,189,36,24,112,101,84,41,45,90,92,111,1,239,1,
+57,254,199,1,57,0,0,3,0,100,255,236,5,253,4,94,0,33,0,38,0,43,0,0,1,53,52,
+38,35,35,6,2,35,34,2,39,35,34,6,21,21,35,53,52,54,51,51,54,54,51,50,22,23,
+51,50,22,21,21,1,32,19,33,18,1,34,3,33,2,5,109,25,45,37,12,247,211,199,249,
+14,36,45,25,144,48,82,123,20,242,204,195,245,21,123,82,48,253,52,1,6,17,253,
+208,17,1,5,251,25,2,44,25,1,130,39,37,33,243,254,240,1,18,241,33,37,39,131,
+73,50,229,249,254,224,50,73,131,254,255,1,110,254,146,3,70,254,185,1,71,0,
+5,0,160,0,0,3,161,4,74,0,26,0,34,0,42,0,54,0,58,0,0,51,53,52,54,55,38,53,
+52,55,38,38,53,53,33,21,20,7,22,22,21,20,6,7,22,22,21,21,39,52,38,38,35,34,
+6,21,17,20,22,51,50,54,54,53,3,34,6,21,20,22,51,50,54,53,52,38,51,33,21,33,
+160,39,41,63,62,41,38,2,66,89,37,34,33,37,44,44,168,23,51,46,64,59,59,64,
+46,51,23,122,50,59,59,50,49,61,61,159,1,17,254,239,96,128,128,39,61,97,96,
+60,38,127,132,96,94,211,86,35,85,38,38,87,35,42,140,113,94,135,82,67,33,77,
+105,3,60,105,77,33,66,83,254,189,52,40,40,51,49,42,42,50,145,0,1,0,80,0,0,
+1,182,4,74,0,5,0,0,33,17,35,53,33,17,1,6,182,1,102,3,185,145,251,182,0,3,
+0,140,0,0,4,94,4,74,0,7,0,10,0,13,0,0,33,17,1,17,1,17,51,17,1,21,33,5,21,
+37,3,174,252,222,3,34,176,252,206,1,214,254,42,1,214,1,167,254,144,3,219,
+254,137,1,175,251,182,3,41,196,138,187,187,0,0,1,0,80,255,236,5,220,4,94,
+0,62,0,0,33,17,4,21,20,23,22,22,21,20,6,35,34,38,38,39,55,22,22,51,50,54,
+53,52,38,39,38,53,52,54,36,51,50,22,22,21,20,7,6,6,21,20,22,51,50,55,23,14,
+2,35,34,38,53,52,54,55,54,53,52,38,39,17,2,190,254,208,87,44,43,122,113,77,
+110,64,6,152,9,47,38,33,32,34,55,89,145,1,12,180,168,249,144,89,58,31,32,
+33,68,26,152,6,64,110,77,113,122,43,44,87,158,146,3,200,38,253,146,132,67,
+108,55,90,99,62,104,63,24,45,61,26,33,34,74,86,139,158,140,197,104,102,206,
+133,152,141,92,72,34,33,26,106,24,63,104,62,99,90,54,109,67,132,146,133,146,
+14,252,54,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,40,
+0,94,0,3,0,1,4,9,0,2,0,14,0,134,0,3,0,1,4,9,0,3,0,78,0,148,0,3,0,1,4,9,0,
+4,0,40,0,94,0,3,0,1,4,9,0,5,0,30,0,226,0,3,0,1,4,9,0,6,0,36,1,0,0,3,0,1,4,
+9,0,7,0,68,1,36,0,3,0,1,4,9,0,8,0,42,1,104,0,3,0,1,4,9,0,9,0,40,1,146,0,3,
+0,1,4,9,0,10,0,96,1,186,0,3,0,1,4,9,0,11,0,62,2,26,0,3,0,1,4,9,0,12,0,60,
+2,88,0,3,0,1,4,9,0,13,2,150,2,148,0,3,0,1,4,9,0,14,0,52,5,42,0,67,0,111,0,
+112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,
+0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,
+108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,
+114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,
+115,0,32,0,71,0,108,0,97,0,103,0,111,0,108,0,105,0,116,0,105,0,99,0,82,0,
+101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,
+111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,71,0,108,0,97,0,103,0,111,
+0,108,0,105,0,116,0,105,0,99,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,
+0,115,0,71,0,108,0,97,0,103,0,111,0,108,0,105,0,116,0,105,0,99,0,78,0,111,
+0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,
+0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,
+0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,
+46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,
+105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,
+0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,
+0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,
+0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,
+0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,
+0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,
+0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,1,2,0,2,0,3,1,3,1,
+4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,
+20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,
+1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,
+1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,
+1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,
+1,95,1,96,4,110,117,108,108,7,117,110,105,50,67,48,48,7,117,110,105,50,67,
+48,49,7,117,110,105,50,67,48,50,7,117,110,105,50,67,48,51,7,117,110,105,50,
+67,48,52,7,117,110,105,50,67,48,53,7,117,110,105,50,67,48,54,7,117,110,105,
+50,67,48,55,7,117,110,105,50,67,48,56,7,117,110,105,50,67,48,57,7,117,110,
+105,50,67,48,65,7,117,110,105,50,67,48,66,7,117,110,105,50,67,48,67,7,117,
+110,105,50,67,48,68,7,117,110,105,50,67,48,69,7,117,110,105,50,67,48,70,7,
+117,110,105,50,67,49,48,7,117,110,105,50,67,49,49,7,117,110,105,50,67,49,
+50,7,117,110,105,50,67,49,51,7,117,110,105,50,67,49,52,7,117,110,105,50,67,
+49,53,7,117,110,105,50,67,49,54,7,117,110,105,50,67,49,55,7,117,110,105,50,
+67,49,56,7,117,110,105,50,67,49,57,7,117,110,105,50,67,49,65,7,117,110,105,
+50,67,49,66,7,117,110,105,50,67,49,67,7,117,110,105,50,67,49,68,7,117,110,
+105,50,67,49,69,7,117,110,105,50,67,49,70,7,117,110,105,50,67,50,48,7,117,
+110,105,50,67,50,49,7,117,110,105,50,67,50,50,7,117,110,105,50,67,50,51,7,
+117,110,105,50,67,50,52,7,117,110,105,50,67,50,53,7,117,110,105,50,67,50,
+54,7,117,110,105,50,67,50,55,7,117,110,105,50,67,50,56,7,117,110,105,50,67,
+50,57,7,117,110,105,50,67,50,65,7,117,110,105,50,67,50,66,7,117,110,105,50,
+67,50,67,7,117,110,105,50,67,50,68,7,117,110,105,50,67,50,69,7,117,110,105,
+50,67,51,48,7,117,110,105,50,67,51,49,7,117,110,105,50,67,51,50,7,117,110,
+105,50,67,51,51,7,117,110,105,50,67,51,52,7,117,110,105,50,67,51,53,7,117,
+110,105,50,67,51,54,7,117,110,105,50,67,51,55,7,117,110,105,50,67,51,56,7,
+117,110,105,50,67,51,57,7,117,110,105,50,67,51,65,7,117,110,105,50,67,51,
+66,7,117,110,105,50,67,51,67,7,117,110,105,50,67,51,68,7,117,110,105,50,67,
+51,69,7,117,110,105,50,67,51,70,7,117,110,105,50,67,52,48,7,117,110,105,50,
+67,52,49,7,117,110,105,50,67,52,50,7,117,110,105,50,67,52,51,7,117,110,105,
+50,67,52,52,7,117,110,105,50,67,52,53,7,117,110,105,50,67,52,54,7,117,110,
+105,50,67,52,55,7,117,110,105,50,67,52,56,7,117,110,105,50,67,52,57,7,117,
+110,105,50,67,52,65,7,117,110,105,50,67,52,66,7,117,110,105,50,67,52,67,7,
+117,110,105,50,67,52,68,7,117,110,105,50,67,52,69,7,117,110,105,50,67,52,
+70,7,117,110,105,50,67,53,48,7,117,110,105,50,67,53,49,7,117,110,105,50,67,
+53,50,7,117,110,105,50,67,53,51,7,117,110,105,50,67,53,52,7,117,110,105,50,
+67,53,53,7,117,110,105,50,67,53,54,7,117,110,105,50,67,53,55,7,117,110,105,
+50,67,53,56,7,117,110,105,50,67,53,57,7,117,110,105,50,67,53,65,7,117,110,
+105,50,67,53,66,7,117,110,105,50,67,53,67,7,117,110,105,50,67,53,68,7,117,
+110,105,50,67,53,69,0,0,1,0,2,0,8,0,5,255,255,0,15,};
+#endif
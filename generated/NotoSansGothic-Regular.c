@@ -0,0 +1,252 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansGothic_Regular_ttf_size = 6152;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansGothic_Regular_ttf");
+asm(".type fz_font_NotoSansGothic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansGothic_Regular_ttf, 6152");
+asm(".balign 64");
+asm("fz_font_NotoSansGothic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansGothic-Regular.ttf\"");
+#else
+const int fz_font_NotoSansGothic_Regular_ttf_size = 6152;
+const char fz_font_NotoSansGothic_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,123,0,100,0,0,19,140,0,0,0,48,71,
+80,79,83,72,181,43,240,0,0,19,188,0,0,2,240,71,83,85,66,143,137,135,71,0,
+0,22,172,0,0,1,90,79,83,47,50,123,3,109,176,0,0,1,104,0,0,0,96,99,109,97,
+112,255,98,39,88,0,0,2,112,0,0,1,16,103,97,115,112,0,7,0,7,0,0,19,128,0,0,
+0,12,103,108,121,102,144,169,18,152,0,0,3,216,0,0,9,136,104,101,97,100,1,
+156,38,209,0,0,0,236,0,0,0,54,104,104,101,97,12,10,253,189,0,0,1,36,0,0,0,
+36,104,109,116,120,166,0,10,225,0,0,1,200,0,0,0,168,108,111,99,97,46,7,48,
+112,0,0,3,128,0,0,0,88,109,97,120,112,0,50,0,67,0,0,1,72,0,0,0,32,110,97,
+109,101,140,81,184,132,0,0,13,96,0,0,6,0,112,111,115,116,255,105,0,102,0,
+0,19,96,0,0,0,32,0,1,0,0,0,1,7,174,197,117,205,104,95,15,60,245,0,11,8,0,
+0,0,0,0,204,217,8,91,0,0,0,0,210,40,203,233,252,55,254,20,7,68,7,205,0,0,
+0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,7,47,252,55,248,188,7,68,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,1,0,0,0,43,0,41,0,3,0,24,0,2,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,4,4,190,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,
+154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,64,
+0,0,0,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,2,88,0,0,
+0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,0,
+2,37,0,147,2,37,0,147,0,0,252,55,0,0,255,246,0,0,253,215,0,0,254,209,4,223,
+0,195,5,12,0,199,4,49,0,199,5,131,0,92,5,86,0,125,5,238,0,193,4,250,0,61,
+5,238,0,199,7,47,0,121,2,70,0,199,5,35,0,199,5,35,0,49,6,104,0,199,6,20,0,
+199,5,180,0,125,5,238,0,199,5,217,0,199,5,174,0,188,5,20,0,199,4,152,0,96,
+4,115,0,20,5,2,255,244,4,14,0,199,4,176,255,254,6,63,0,125,4,35,255,203,3,
+182,0,33,2,70,0,4,4,182,1,43,4,164,1,49,0,0,255,246,255,246,255,246,0,0,0,
+2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,124,0,4,0,104,0,0,0,22,0,16,0,3,0,6,0,0,
+0,13,0,32,0,58,0,160,0,183,3,5,3,8,3,49,254,255,255,255,0,0,0,0,0,13,0,32,
+0,58,0,160,0,183,3,4,3,8,3,49,254,255,255,255,0,1,255,245,255,227,255,202,
+255,99,255,78,253,2,253,0,252,216,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,12,0,0,0,0,0,148,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,13,0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,58,0,0,0,58,0,0,0,
+4,0,0,0,160,0,0,0,160,0,0,0,3,0,0,0,183,0,0,0,183,0,0,0,5,0,0,3,4,0,0,3,5,
+0,0,0,6,0,0,3,8,0,0,3,8,0,0,0,8,0,0,3,49,0,0,3,49,0,0,0,9,0,0,254,255,0,0,
+254,255,0,0,0,1,0,1,3,48,0,1,3,74,0,0,0,10,0,0,0,21,0,21,0,21,0,21,0,58,0,
+80,0,89,0,102,0,111,0,120,0,149,0,199,0,215,1,4,1,55,1,86,1,109,1,142,1,202,
+1,214,1,247,2,13,2,50,2,87,2,148,2,177,2,195,2,226,3,7,3,67,3,85,3,109,3,
+134,3,164,3,233,4,35,4,59,4,104,4,118,4,157,4,170,4,183,4,196,0,2,0,193,0,
+0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,
+253,135,5,182,250,74,104,4,230,0,0,2,0,147,255,227,1,145,4,102,0,11,0,23,
+0,0,55,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,
+147,65,60,61,68,68,61,59,66,63,62,63,66,68,61,59,66,111,66,71,71,66,65,75,
+74,3,174,66,73,72,67,64,75,74,0,1,0,147,2,72,1,145,3,94,0,11,0,0,19,52,54,
+51,50,22,21,20,6,35,34,38,147,65,60,62,67,68,61,59,66,2,211,65,74,75,64,64,
+75,74,255,255,252,55,4,217,254,151,5,106,16,7,0,38,251,12,0,0,0,1,255,246,
+7,60,5,70,7,205,0,3,0,0,3,33,21,33,10,5,80,250,176,7,205,145,255,255,253,
+215,5,12,0,23,5,215,16,7,0,39,252,166,0,0,255,255,254,209,254,211,1,49,255,
+100,16,7,0,38,253,166,249,250,0,1,0,195,254,127,4,231,5,43,0,12,0,0,19,16,
+55,51,1,51,1,35,1,6,17,17,7,211,98,168,254,230,213,3,79,215,253,224,101,184,
+1,186,1,32,155,1,182,250,213,3,88,152,254,232,253,41,82,0,0,1,0,199,0,0,4,
+164,5,98,0,31,0,0,37,51,50,54,53,52,38,39,53,54,54,53,52,38,39,55,22,22,21,
+20,6,7,21,22,22,21,20,4,33,33,17,51,1,127,168,210,236,235,244,157,122,76,
+62,74,124,130,120,138,219,240,254,186,254,236,254,125,184,156,132,124,125,
+134,17,139,49,112,81,65,90,23,131,36,146,102,104,149,55,8,15,187,152,195,
+229,5,43,0,0,1,0,199,0,0,4,0,5,43,0,5,0,0,1,21,33,17,35,17,4,0,253,127,184,
+5,43,164,251,121,5,43,0,1,0,92,255,236,5,139,5,43,0,26,0,0,1,6,6,21,20,22,
+51,50,54,54,53,52,38,39,1,51,1,35,3,6,6,35,34,38,53,52,55,1,141,51,63,140,
+124,86,128,68,51,49,254,137,215,3,82,217,223,19,245,183,203,237,103,2,170,
+48,143,75,128,153,78,134,85,89,145,75,2,70,250,213,1,94,168,202,223,190,171,
+118,0,1,0,125,255,236,5,35,5,61,0,28,0,0,1,34,4,7,33,21,33,22,22,51,50,54,
+55,23,6,4,35,32,0,17,52,18,36,51,50,22,23,7,38,3,35,201,254,254,20,3,108,
+252,143,10,255,207,133,205,85,101,95,254,237,165,254,209,254,160,173,1,59,
+200,146,255,91,103,160,4,154,229,193,160,212,243,98,91,115,113,122,1,105,
+1,50,207,1,61,170,95,93,135,160,0,0,1,0,193,255,236,5,39,5,43,0,15,0,0,1,
+17,6,33,32,0,17,17,51,17,20,22,51,50,55,17,5,39,244,254,248,254,204,254,202,
+184,207,227,190,134,5,43,251,2,65,1,21,1,26,3,16,253,8,219,205,31,4,129,0,
+1,0,61,0,0,4,199,5,43,0,9,0,0,33,33,53,1,33,53,33,21,1,33,4,199,251,155,3,
+25,252,194,4,27,252,231,3,136,139,3,252,164,139,252,4,0,0,1,0,199,0,0,5,45,
+6,172,0,17,0,0,1,54,51,32,0,17,17,35,17,52,38,35,34,7,17,35,17,51,1,127,130,
+171,1,64,1,65,184,220,253,153,132,184,184,5,31,24,254,238,254,227,252,248,
+2,240,224,200,31,251,135,6,172,0,0,1,0,121,254,20,6,186,6,172,0,35,0,0,1,
+51,17,54,54,18,53,52,38,39,51,22,22,21,20,2,4,7,17,7,17,38,36,2,53,52,54,
+55,51,6,6,21,20,18,22,23,3,61,185,159,234,125,49,37,190,34,52,173,254,191,
+214,185,214,254,190,172,51,35,192,36,52,125,235,158,6,172,250,100,15,164,
+1,29,190,99,221,77,62,235,108,236,254,156,206,16,253,254,82,2,84,16,206,1,
+101,235,98,235,72,75,230,92,191,254,228,164,15,0,0,1,0,199,0,0,1,127,5,43,
+0,3,0,0,33,35,17,51,1,127,184,184,5,43,0,1,0,199,0,0,5,20,5,43,0,18,0,0,33,
+35,1,17,35,17,51,17,62,3,55,51,14,3,7,5,20,253,253,104,184,184,154,215,140,
+86,44,195,47,85,124,200,151,2,152,253,104,5,43,253,166,87,142,123,124,126,
+142,144,126,142,87,0,0,1,0,49,0,0,5,43,5,43,0,7,0,0,51,1,3,51,1,35,1,1,49,
+1,156,199,213,3,80,215,253,231,254,183,3,244,1,55,250,213,3,74,252,182,0,
+1,0,199,0,0,5,160,5,43,0,21,0,0,1,17,35,17,6,6,35,34,38,39,17,35,17,51,30,
+2,51,50,54,54,55,5,160,185,60,249,133,125,251,54,184,184,24,144,181,87,87,
+182,141,26,5,43,250,213,3,193,135,193,195,133,252,63,5,43,121,245,140,144,
+240,122,0,1,0,199,0,0,5,78,5,43,0,19,0,0,33,35,1,35,22,17,17,35,17,51,22,
+19,1,18,23,51,38,53,17,51,5,78,184,252,223,8,18,184,184,21,240,1,21,240,21,
+8,16,184,4,35,202,254,247,253,176,5,43,36,254,201,254,152,254,200,36,152,
+254,2,137,0,0,1,0,125,254,20,5,63,5,61,0,35,0,0,1,22,22,21,16,1,35,0,17,53,
+6,33,34,36,2,53,52,18,36,51,50,4,23,7,38,38,35,34,0,21,20,18,51,50,54,55,
+5,39,9,15,254,220,224,1,78,146,254,236,181,254,232,153,167,1,55,202,165,1,
+10,89,104,96,203,119,225,254,251,241,204,139,207,43,1,172,32,137,50,254,99,
+254,224,1,37,1,82,39,198,166,1,47,198,206,1,61,171,96,92,139,88,76,254,227,
+242,237,254,237,153,136,0,1,0,199,0,0,5,45,5,59,0,15,0,0,51,17,54,36,51,32,
+17,17,35,17,52,38,35,34,7,17,199,115,1,18,119,2,106,184,207,227,192,132,4,
+250,31,34,253,209,252,244,2,244,219,205,31,251,131,0,0,1,0,199,0,0,5,16,5,
+43,0,7,0,0,33,35,17,33,17,35,17,33,5,16,184,253,39,184,4,73,4,137,251,119,
+5,43,0,1,0,188,254,20,4,231,5,43,0,17,0,0,1,7,17,6,35,34,38,53,17,51,17,20,
+22,51,50,55,17,51,4,231,184,215,203,222,243,185,156,147,196,199,184,254,102,
+82,2,185,80,234,216,2,236,253,47,152,163,71,3,197,0,1,0,199,254,20,5,29,5,
+94,0,19,0,0,33,33,1,17,7,17,51,17,54,54,53,52,38,39,55,22,22,21,16,5,5,29,
+254,243,253,111,184,184,242,219,95,122,69,163,175,254,113,2,127,251,231,82,
+7,23,253,125,78,161,99,77,97,41,141,46,159,127,254,244,137,0,0,1,0,96,255,
+236,4,59,5,68,0,38,0,0,1,20,4,35,34,39,53,22,22,51,32,53,52,38,38,39,38,38,
+53,52,36,51,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,4,49,254,237,251,
+253,181,91,240,115,1,74,65,142,188,219,179,1,18,234,154,248,77,94,84,192,
+117,153,160,59,133,146,191,173,88,1,102,182,196,98,182,51,70,207,60,80,63,
+45,53,176,148,177,200,78,72,145,71,62,107,102,68,85,59,32,42,92,139,0,0,1,
+0,20,0,0,4,92,5,43,0,7,0,0,33,35,17,33,53,33,21,33,2,150,185,254,55,4,72,
+254,58,4,137,162,162,0,0,1,255,244,254,20,5,12,5,43,0,8,0,0,1,1,51,1,17,7,
+17,1,51,2,139,1,187,198,253,219,184,253,197,211,1,238,3,61,252,18,253,41,
+82,3,33,3,246,0,0,1,0,199,254,20,3,209,6,172,0,11,0,0,1,7,17,51,17,33,21,
+33,17,33,21,33,1,127,184,184,2,82,253,174,2,82,253,174,254,102,82,8,152,254,
+127,162,253,230,162,0,0,1,255,254,0,0,4,178,5,43,0,11,0,0,33,35,1,1,35,1,
+1,51,1,1,51,1,4,178,219,254,125,254,119,205,1,227,254,62,213,1,102,1,105,
+206,254,60,2,61,253,195,2,176,2,123,253,250,2,6,253,137,0,3,0,125,255,236,
+5,195,5,66,0,15,0,28,0,40,0,0,1,20,2,4,35,34,36,2,53,52,18,36,51,50,4,18,
+5,20,22,22,51,50,0,53,52,2,35,34,0,5,52,54,51,50,22,21,20,6,35,34,38,5,195,
+168,254,203,197,206,254,206,164,172,1,56,194,203,1,49,164,251,124,120,218,
+144,223,1,0,255,222,220,254,248,1,99,64,61,62,67,68,61,59,66,2,150,195,254,
+198,173,170,1,56,202,196,1,57,173,166,254,201,207,154,240,129,1,26,241,236,
+1,30,254,227,235,67,72,75,64,65,75,71,0,0,2,255,203,255,35,4,72,5,43,0,20,
+0,31,0,0,1,20,2,7,22,5,33,38,39,6,1,35,0,55,38,2,53,52,55,33,22,5,20,18,23,
+54,54,53,52,39,33,6,3,182,136,161,157,1,30,254,233,168,100,80,254,219,229,
+1,52,179,169,146,49,2,231,39,253,121,113,123,122,105,8,254,63,6,4,82,155,
+254,181,225,156,239,151,103,108,254,145,1,104,238,193,1,74,192,128,103,103,
+135,151,254,239,143,176,255,145,40,29,33,0,1,0,33,254,20,3,150,5,98,0,8,0,
+0,1,7,37,17,7,17,5,39,1,3,150,78,254,239,184,254,240,78,1,186,4,55,118,186,
+249,235,82,6,103,186,118,1,43,0,0,3,0,4,0,0,2,68,6,223,0,11,0,23,0,27,0,0,
+19,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,3,35,
+17,51,4,56,40,39,58,58,39,40,56,1,129,56,38,39,58,58,39,38,56,6,184,184,6,
+123,54,46,46,54,53,50,50,53,54,46,46,54,53,50,50,249,186,5,43,0,0,1,1,43,
+4,217,3,139,5,106,0,3,0,0,1,33,21,33,1,43,2,96,253,160,5,106,145,0,0,2,1,
+49,5,12,3,113,5,215,0,11,0,23,0,0,1,52,54,51,50,22,21,20,6,35,34,38,37,52,
+54,51,50,22,21,20,6,35,34,38,1,49,56,40,39,58,58,39,40,56,1,129,56,38,39,
+58,58,39,38,56,5,115,53,47,47,53,53,50,50,53,53,47,47,53,53,50,50,0,0,1,255,
+246,7,60,2,93,7,205,0,3,0,0,3,33,21,33,10,2,103,253,153,7,205,145,0,1,255,
+246,7,60,6,24,7,205,0,3,0,0,3,33,21,33,10,6,34,249,222,7,205,145,0,1,255,
+246,7,60,7,68,7,205,0,3,0,0,3,33,21,33,10,7,78,248,178,7,205,145,0,0,0,15,
+0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,1,4,9,0,2,
+0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,0,4,0,32,0,94,0,3,0,1,4,
+9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,1,4,9,0,7,0,68,1,12,0,3,
+0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,0,3,0,1,4,9,0,10,0,96,1,
+162,0,3,0,1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,60,2,64,0,3,0,1,4,9,0,13,
+2,150,2,124,0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,0,112,0,121,0,114,0,105,
+0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,71,0,111,0,
+116,0,104,0,105,0,99,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,
+32,0,71,0,111,0,116,0,104,0,105,0,99,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,
+0,97,0,110,0,115,0,71,0,111,0,116,0,104,0,105,0,99,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,
+0,1,0,0,0,12,0,0,0,40,0,0,0,2,0,4,0,0,0,5,0,1,0,6,0,9,0,3,0,10,0,39,0,1,0,
+40,0,42,0,3,0,4,0,0,0,1,0,0,0,1,0,0,0,10,0,48,0,90,0,2,68,70,76,84,0,14,103,
+111,116,104,0,26,0,4,0,0,0,0,255,255,0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,1,
+0,2,109,97,114,107,0,14,109,97,114,107,0,28,0,0,0,5,0,0,0,1,0,2,0,3,0,4,0,
+0,0,5,0,0,0,1,0,2,0,3,0,4,0,5,0,12,0,20,0,28,0,36,0,44,0,4,0,0,0,1,0,40,0,
+4,0,0,0,1,0,182,0,4,0,0,0,1,1,8,0,4,0,0,0,1,1,34,0,4,0,0,0,1,1,92,0,1,0,132,
+0,140,0,2,0,12,0,22,0,2,0,0,1,126,0,1,1,228,0,27,1,122,1,224,1,128,1,230,
+1,134,1,236,1,140,1,242,1,146,1,248,1,146,1,224,1,140,1,254,1,152,1,248,1,
+158,2,4,1,164,2,10,1,170,2,16,1,128,2,22,1,152,2,28,1,176,2,34,1,176,2,40,
+1,182,2,46,1,182,2,46,1,182,2,22,1,128,2,28,1,140,2,40,1,188,2,52,1,194,2,
+58,1,200,2,64,1,140,2,40,1,206,1,224,1,128,1,236,1,212,2,70,0,1,0,2,0,6,0,
+9,0,2,0,1,0,10,0,36,0,0,0,1,0,50,0,56,0,1,0,12,0,18,0,1,0,0,1,78,0,15,1,72,
+1,72,1,72,1,72,1,72,1,72,1,72,1,72,1,72,1,72,1,72,1,72,1,72,1,72,1,72,0,1,
+0,1,0,7,0,2,0,5,0,10,0,12,0,0,0,16,0,16,0,3,0,20,0,21,0,4,0,28,0,33,0,6,0,
+35,0,37,0,12,0,1,0,22,0,28,0,1,0,12,0,18,0,1,0,0,0,244,0,1,0,238,0,1,0,1,
+0,40,0,1,0,1,0,19,0,1,0,38,0,44,0,1,0,12,0,18,0,1,0,0,0,210,0,9,0,204,0,204,
+0,204,0,204,0,204,0,204,0,204,0,204,0,204,0,1,0,1,0,41,0,2,0,3,0,13,0,15,
+0,0,0,17,0,17,0,3,0,23,0,27,0,4,0,1,0,26,0,32,0,1,0,12,0,18,0,1,0,0,0,144,
+0,3,0,138,0,138,0,138,0,1,0,1,0,42,0,2,0,3,0,18,0,18,0,0,0,22,0,22,0,1,0,
+34,0,34,0,2,0,1,253,108,4,216,0,1,2,138,5,220,0,1,2,18,5,220,0,1,2,108,5,
+220,0,1,2,88,5,220,0,1,2,248,5,220,0,1,3,32,5,220,0,1,3,152,7,8,0,1,1,24,
+5,220,0,1,2,168,5,220,0,1,3,12,5,220,0,1,2,228,5,220,0,1,2,58,5,220,0,1,2,
+148,5,220,0,1,2,108,6,244,0,1,3,52,5,220,0,1,1,214,5,220,0,1,0,0,0,0,0,1,
+3,52,0,0,0,1,2,48,0,0,0,1,2,108,0,0,0,1,2,28,0,0,0,1,2,248,0,0,0,1,2,138,
+0,0,0,1,3,152,254,112,0,1,1,24,0,0,0,1,2,128,0,0,0,1,2,168,0,0,0,1,3,32,0,
+0,0,1,3,12,0,0,0,1,2,88,0,0,0,1,2,228,0,0,0,1,2,58,0,0,0,1,2,148,254,112,
+0,1,2,208,0,0,0,1,1,214,254,112,0,1,0,0,0,10,0,48,0,86,0,2,68,70,76,84,0,
+14,103,111,116,104,0,26,0,4,0,0,0,0,255,255,0,1,0,0,0,4,0,0,0,0,255,255,0,
+1,0,1,0,2,99,99,109,112,0,14,99,99,109,112,0,26,0,0,0,4,0,0,0,1,0,2,0,3,0,
+0,0,4,0,0,0,1,0,2,0,3,0,7,0,16,0,24,0,32,0,40,0,48,0,56,0,64,0,4,0,0,0,1,
+0,56,0,6,0,0,0,1,0,72,0,6,0,0,0,1,0,94,0,6,0,0,0,1,0,132,0,1,0,0,0,1,0,170,
+0,1,0,0,0,1,0,176,0,1,0,0,0,1,0,182,0,1,0,18,0,1,0,8,0,1,0,4,0,37,0,2,0,8,
+0,1,0,1,0,19,0,3,0,1,0,24,0,1,0,18,0,0,0,1,0,0,0,4,0,1,0,1,0,7,0,1,0,1,0,
+19,0,3,0,1,0,24,0,1,0,18,0,0,0,1,0,0,0,5,0,1,0,1,0,7,0,2,0,3,0,13,0,15,0,
+0,0,17,0,17,0,3,0,23,0,27,0,4,0,3,0,1,0,24,0,1,0,18,0,0,0,1,0,0,0,6,0,1,0,
+1,0,7,0,2,0,3,0,18,0,18,0,0,0,22,0,22,0,1,0,34,0,34,0,2,0,2,0,8,0,1,0,40,
+0,1,0,1,0,7,0,2,0,8,0,1,0,41,0,1,0,1,0,7,0,2,0,8,0,1,0,42,0,1,0,1,0,7,0,0,
+};
+#endif
@@ -0,0 +1,4928 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansGujarati_Regular_ttf_size = 128336;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansGujarati_Regular_ttf");
+asm(".type fz_font_NotoSansGujarati_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansGujarati_Regular_ttf, 128336");
+asm(".balign 64");
+asm("fz_font_NotoSansGujarati_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansGujarati-Regular.ttf\"");
+#else
+const int fz_font_NotoSansGujarati_Regular_ttf_size = 128336;
+const char fz_font_NotoSansGujarati_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,220,245,221,242,0,1,49,188,0,0,8,
+42,71,80,79,83,57,178,189,119,0,1,57,232,0,0,36,212,71,83,85,66,166,185,58,
+228,0,1,94,188,0,0,150,146,79,83,47,50,120,103,104,138,0,0,1,104,0,0,0,96,
+99,109,97,112,143,60,241,228,0,0,13,92,0,0,1,68,103,97,115,112,0,7,0,7,0,
+1,49,176,0,0,0,12,103,108,121,102,43,148,85,19,0,0,20,108,0,1,23,24,104,101,
+97,100,4,54,31,158,0,0,0,236,0,0,0,54,104,104,101,97,12,167,2,24,0,0,1,36,
+0,0,0,36,104,109,116,120,76,124,204,202,0,0,1,200,0,0,11,148,108,111,99,97,
+146,238,216,144,0,0,14,160,0,0,5,204,109,97,120,112,3,0,0,227,0,0,1,72,0,
+0,0,32,110,97,109,101,142,22,185,211,0,1,43,132,0,0,6,12,112,111,115,116,
+255,105,0,102,0,1,49,144,0,0,0,32,0,1,0,0,0,1,7,174,133,109,187,44,95,15,
+60,245,0,11,8,0,0,0,0,0,205,118,3,3,0,0,0,0,210,40,203,233,251,10,252,218,
+10,110,7,44,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,44,252,188,0,0,10,127,251,10,
+247,247,10,110,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,229,0,1,0,0,2,229,0,105,
+0,9,0,120,0,14,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,4,173,1,144,0,5,0,
+0,5,153,5,51,0,0,0,191,5,153,5,51,0,0,2,130,0,102,2,129,0,0,2,11,5,2,4,5,
+4,2,2,4,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,44,
+252,188,0,0,7,44,3,68,0,0,0,1,0,0,0,0,4,189,4,189,0,0,0,32,0,5,4,205,0,193,
+0,0,0,0,2,100,0,0,2,100,0,0,0,0,253,91,0,0,254,126,1,252,0,129,7,16,0,64,
+9,47,0,64,5,19,0,90,5,19,0,90,4,255,0,118,7,28,0,118,6,166,0,23,5,147,0,87,
+7,16,0,64,7,16,0,64,7,16,0,64,9,47,0,64,9,47,0,64,9,47,0,64,4,23,0,37,5,248,
+0,13,5,59,0,22,4,247,0,90,3,236,0,19,5,73,0,64,5,232,0,90,6,250,0,67,5,150,
+0,22,5,137,0,22,3,155,0,90,4,35,0,90,3,218,0,19,4,32,0,90,6,147,0,153,4,149,
+0,89,5,0,0,86,3,188,0,90,4,217,0,90,4,95,0,49,4,139,0,13,4,23,0,77,5,224,
+0,90,6,120,0,93,4,194,0,88,4,193,0,29,3,144,0,60,5,54,0,90,6,0,0,90,4,159,
+0,90,5,107,0,63,4,159,0,13,5,177,0,63,5,16,0,95,0,0,253,128,3,196,0,25,2,
+31,0,185,2,31,0,185,2,31,254,116,0,0,252,79,0,0,253,76,0,0,253,213,0,0,253,
+213,0,0,252,198,0,0,252,226,0,0,252,61,2,31,254,229,2,31,255,1,2,31,254,92,
+0,0,254,128,7,31,0,25,7,41,0,23,5,147,0,87,0,0,252,47,0,0,252,47,4,104,0,
+133,4,104,0,175,4,104,0,157,4,104,0,77,4,104,0,16,4,104,0,20,4,104,0,193,
+4,104,0,51,4,104,0,148,4,104,0,98,3,16,0,88,6,152,0,70,0,0,0,0,0,0,255,202,
+0,0,254,213,4,20,0,106,4,23,0,37,5,248,0,13,5,59,0,22,4,247,0,90,3,236,0,
+19,5,73,0,64,5,232,0,90,6,250,0,67,5,150,0,22,5,137,0,22,3,155,0,90,4,35,
+0,90,3,218,0,19,4,32,0,90,6,147,0,153,4,149,0,89,5,0,0,86,3,188,0,90,4,217,
+0,90,4,95,0,49,4,139,0,13,4,23,0,77,5,224,0,90,6,120,0,93,4,194,0,88,4,193,
+0,29,3,144,0,60,5,54,0,90,6,0,0,90,4,159,0,90,5,107,0,63,4,159,0,13,5,177,
+0,63,5,16,0,95,5,189,0,95,5,133,0,73,0,0,254,58,0,0,252,70,4,23,0,37,4,124,
+0,13,3,71,0,22,3,131,0,90,3,236,0,19,3,193,0,64,5,232,0,90,6,169,0,67,5,12,
+0,22,3,240,0,22,3,155,0,90,4,35,0,90,3,218,0,19,4,32,0,90,4,173,0,153,2,241,
+0,89,3,111,0,86,3,188,0,90,3,101,0,90,2,209,0,49,3,27,0,13,4,23,0,77,4,100,
+0,90,4,244,0,93,3,62,0,88,3,79,0,29,3,144,0,60,3,180,0,90,4,85,0,90,3,77,
+0,90,3,124,0,63,3,110,0,13,4,60,0,63,3,217,0,105,3,222,0,95,3,218,0,73,4,
+23,0,37,4,124,0,13,3,71,0,22,3,131,0,90,3,236,0,19,3,193,0,64,5,232,0,90,
+6,169,0,67,5,12,0,22,3,240,0,22,3,155,0,90,4,35,0,90,3,218,0,19,4,32,0,90,
+4,173,0,153,2,241,0,89,3,111,0,86,3,188,0,90,3,101,0,90,2,209,0,49,3,27,0,
+13,4,23,0,77,4,100,0,90,4,244,0,93,3,62,0,88,3,79,0,29,3,144,0,60,3,180,0,
+90,4,85,0,90,3,77,0,90,3,124,0,63,3,110,0,13,4,60,0,63,3,217,0,105,4,35,0,
+37,5,248,0,13,5,59,0,22,4,247,0,90,3,236,0,19,5,73,0,64,5,232,0,90,6,250,
+0,67,5,150,0,22,5,137,0,22,3,155,0,17,4,35,0,85,3,218,0,19,4,32,0,84,6,147,
+0,153,4,168,0,23,5,0,0,86,3,235,0,90,4,217,0,90,4,95,0,49,4,139,0,13,4,35,
+0,65,5,224,0,90,6,120,0,93,4,194,0,88,4,193,0,29,3,144,0,12,5,54,0,90,6,0,
+0,90,4,159,0,90,5,183,0,26,4,159,0,13,5,217,0,63,5,0,0,105,6,13,0,95,5,163,
+0,73,4,35,0,37,5,248,0,13,5,59,0,22,4,247,0,90,3,236,0,19,5,73,0,64,5,232,
+0,90,6,250,0,67,5,150,0,22,5,137,0,22,3,155,0,37,4,35,0,90,3,218,0,19,4,32,
+0,90,6,147,0,153,4,168,0,23,5,0,0,86,3,235,0,90,4,217,0,90,4,95,0,49,4,139,
+0,13,4,35,0,65,5,224,0,90,6,120,0,93,4,194,0,88,4,193,0,29,3,144,0,12,5,54,
+0,90,6,0,0,90,4,159,0,90,5,183,0,26,4,159,0,13,5,217,0,63,5,0,0,105,4,48,
+0,37,4,124,0,13,3,161,0,22,3,131,0,90,3,236,0,19,3,193,0,64,5,232,0,90,6,
+169,0,67,5,12,0,22,3,240,0,22,3,155,0,17,4,35,0,85,3,218,0,19,4,32,0,84,4,
+249,0,153,3,13,0,23,3,111,0,86,3,235,0,90,3,101,0,90,2,209,0,49,3,27,0,13,
+4,48,0,65,4,100,0,90,4,244,0,93,3,62,0,88,3,79,0,29,3,144,0,12,3,180,0,90,
+4,102,0,90,3,77,0,90,4,36,0,26,3,110,0,13,4,66,0,63,5,0,0,105,4,115,0,95,
+4,48,0,73,4,48,0,37,4,124,0,13,3,161,0,22,3,131,0,90,3,236,0,19,3,193,0,64,
+5,232,0,90,6,169,0,67,5,12,0,22,3,240,0,22,3,155,0,53,4,35,0,90,3,218,0,19,
+4,32,0,90,4,249,0,153,3,13,0,23,3,111,0,86,3,235,0,90,3,101,0,90,2,209,0,
+49,3,27,0,13,4,48,0,65,4,100,0,90,4,244,0,93,3,62,0,88,3,79,0,29,3,144,0,
+38,3,180,0,90,4,102,0,90,3,77,0,90,4,36,0,26,3,110,0,13,4,66,0,63,5,0,0,105,
+7,37,0,37,8,63,0,37,5,109,0,22,4,4,0,9,4,4,0,16,4,4,0,19,4,4,0,19,8,69,0,
+19,10,127,0,90,5,218,0,90,6,112,0,22,6,112,0,22,3,180,0,90,3,180,0,35,3,180,
+0,90,3,180,0,64,3,180,0,64,7,225,0,90,7,223,0,90,4,23,0,90,4,23,0,72,8,130,
+0,90,3,205,0,19,3,205,0,19,3,205,0,19,8,29,0,19,4,40,0,90,8,134,0,90,5,90,
+0,64,3,235,0,90,5,186,0,78,3,188,0,90,5,186,0,78,3,235,0,90,5,29,0,49,4,146,
+0,18,5,162,0,80,4,217,0,90,5,9,0,49,4,219,0,49,8,63,0,77,8,127,0,90,6,250,
+0,26,5,183,0,26,8,165,0,26,6,249,0,26,5,241,0,13,5,241,0,13,6,172,0,13,6,
+172,0,13,8,77,0,63,5,153,0,105,5,38,0,105,6,123,0,105,6,133,0,105,5,128,0,
+105,5,68,0,105,3,182,0,64,3,85,0,26,2,31,0,185,2,31,0,185,2,31,0,185,2,31,
+0,185,2,31,254,116,2,31,254,116,2,31,254,116,0,0,252,198,0,0,252,128,0,0,
+252,128,0,0,252,226,0,0,252,226,0,0,252,226,0,0,252,61,0,0,252,48,0,0,252,
+48,2,31,254,229,2,31,254,159,2,31,254,159,2,31,255,1,2,31,255,1,2,31,255,
+1,2,31,254,92,2,31,254,79,2,31,254,79,0,0,254,58,4,255,0,118,7,28,0,118,5,
+19,0,90,5,19,0,90,7,16,0,64,7,16,0,64,7,16,0,64,9,47,0,64,9,47,0,64,9,47,
+0,64,8,80,0,67,8,45,0,67,6,147,0,153,6,147,0,153,3,188,0,90,5,120,0,60,3,
+149,0,60,4,155,0,105,4,23,0,77,4,35,0,65,8,80,0,67,8,45,0,67,6,147,0,153,
+6,147,0,153,3,188,0,54,5,120,0,60,3,149,0,60,4,155,0,105,4,23,0,77,4,35,0,
+65,5,248,0,13,5,59,0,22,4,247,0,90,5,73,0,64,5,137,0,22,6,147,0,153,4,149,
+0,89,5,0,0,86,4,217,0,90,4,95,0,49,4,139,0,13,5,224,0,90,6,120,0,93,4,194,
+0,88,4,193,0,29,5,54,0,90,6,0,0,90,4,159,0,90,5,107,0,63,4,159,0,13,5,177,
+0,63,5,189,0,95,5,133,0,73,5,248,0,13,5,59,0,22,4,247,0,90,5,73,0,64,5,137,
+0,22,6,147,0,153,4,149,0,89,5,0,0,86,4,217,0,90,4,95,0,49,4,139,0,13,5,224,
+0,90,6,120,0,93,4,194,0,88,4,193,0,29,5,54,0,90,6,0,0,90,4,159,0,90,5,107,
+0,63,4,159,0,13,5,177,0,63,5,248,0,13,5,59,0,22,4,247,0,90,5,73,0,64,5,137,
+0,22,6,147,0,153,4,168,0,23,5,0,0,86,4,217,0,90,4,95,0,49,4,139,0,13,5,224,
+0,90,6,120,0,93,4,194,0,88,4,193,0,29,5,54,0,90,6,0,0,90,4,159,0,90,5,183,
+0,26,4,159,0,13,5,217,0,63,5,9,0,105,6,13,0,95,5,163,0,73,5,248,0,13,5,59,
+0,22,4,247,0,90,5,73,0,64,5,137,0,22,6,147,0,153,4,168,0,23,5,0,0,86,4,217,
+0,90,4,95,0,49,4,139,0,13,5,224,0,90,6,120,0,93,4,194,0,88,4,193,0,29,5,54,
+0,90,6,0,0,90,4,159,0,90,5,183,0,26,4,159,0,13,5,217,0,63,5,9,0,105,8,63,
+0,37,5,109,0,22,8,69,0,19,10,127,0,90,6,112,0,22,6,112,0,22,7,225,0,90,7,
+223,0,90,8,130,0,90,8,29,0,19,8,134,0,90,5,90,0,64,5,162,0,80,4,217,0,90,
+4,219,0,49,8,63,0,77,8,127,0,90,6,250,0,26,5,183,0,26,8,165,0,26,6,249,0,
+26,8,77,0,63,5,153,0,105,5,38,0,105,6,123,0,105,6,133,0,105,5,128,0,105,5,
+68,0,105,4,40,0,19,5,209,0,90,6,240,0,67,3,166,0,90,4,23,0,90,3,205,0,19,
+4,25,0,90,3,235,0,90,5,186,0,78,3,188,0,90,5,186,0,78,3,235,0,90,3,235,0,
+90,4,23,0,77,4,35,0,65,3,140,0,63,4,40,0,19,5,209,0,90,6,240,0,67,3,166,0,
+58,4,23,0,90,3,205,0,19,4,25,0,56,3,235,0,90,4,23,0,77,4,35,0,65,3,140,0,
+63,0,0,252,15,0,0,251,175,0,0,252,70,0,0,251,175,0,0,252,70,0,0,251,175,0,
+0,252,62,0,0,252,69,0,0,252,69,0,0,252,70,0,0,251,175,0,0,252,79,0,0,253,
+76,0,0,253,213,0,0,254,128,0,0,253,107,2,31,0,185,2,31,0,185,2,31,0,185,2,
+31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,
+2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,
+185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,0,185,2,31,
+0,185,0,0,0,0,2,31,254,29,2,31,253,198,2,31,254,29,2,31,253,198,2,31,254,
+29,2,31,253,198,2,31,254,29,2,31,253,198,0,0,251,160,0,0,252,24,0,0,252,154,
+0,0,252,154,0,0,251,10,0,0,251,10,0,0,251,160,0,0,252,24,0,0,252,154,0,0,
+252,154,0,0,251,10,0,0,251,10,0,0,252,173,0,0,252,173,0,0,253,91,0,0,254,
+126,0,0,254,58,0,0,254,58,0,0,253,68,4,23,0,37,3,218,0,19,4,32,0,76,4,35,
+0,37,4,23,0,37,3,218,0,19,4,32,0,55,4,35,0,37,2,206,0,232,3,231,0,206,5,57,
+0,70,6,159,0,117,2,127,0,206,2,212,0,140,2,212,0,120,4,199,0,130,4,104,0,
+102,2,40,0,143,2,184,0,100,2,37,0,147,3,111,0,86,4,104,0,98,4,104,0,178,4,
+104,0,96,4,104,0,82,4,104,0,23,4,104,0,131,4,104,0,113,4,104,0,90,4,104,0,
+106,4,104,0,106,2,91,0,175,2,91,0,158,4,104,0,102,4,104,0,102,4,104,0,102,
+4,16,0,126,2,217,0,221,3,111,0,86,2,217,0,110,4,104,0,60,3,74,255,252,3,32,
+0,90,4,81,0,240,3,2,0,110,4,104,0,102,2,184,0,100,4,0,0,82,8,0,0,82,2,107,
+0,148,2,106,0,146,3,235,0,149,3,235,0,146,6,111,0,147,4,104,0,141,4,104,0,
+102,4,104,0,102,4,104,0,147,3,8,1,142,4,202,1,142,0,0,253,128,0,0,254,126,
+0,0,254,126,1,229,0,160,3,127,0,160,5,25,0,160,4,250,0,81,4,250,0,81,4,250,
+0,81,3,174,0,50,4,18,0,50,2,116,254,191,2,179,254,191,0,0,0,1,0,3,0,1,0,0,
+0,12,0,4,1,56,0,0,0,72,0,64,0,5,0,8,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,
+160,0,173,0,215,0,247,9,101,10,131,10,141,10,145,10,168,10,176,10,179,10,
+185,10,197,10,201,10,205,10,208,10,227,10,241,32,13,32,20,32,25,32,29,32,
+38,32,185,34,18,37,204,168,57,254,255,255,255,0,0,0,0,0,13,0,32,0,37,0,39,
+0,91,0,123,0,160,0,173,0,215,0,247,9,100,10,129,10,133,10,143,10,147,10,170,
+10,178,10,181,10,188,10,199,10,203,10,208,10,224,10,230,32,11,32,19,32,24,
+32,28,32,38,32,185,34,18,37,204,168,48,254,255,255,255,0,1,255,245,0,0,2,
+130,2,129,2,102,2,75,255,99,2,29,1,251,1,220,249,114,245,131,245,130,245,
+129,245,128,245,127,245,126,245,125,245,123,245,122,245,121,245,119,245,104,
+245,102,224,77,226,184,226,181,226,179,226,171,226,28,224,194,218,143,90,
+171,1,89,0,1,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,3,2,164,2,165,2,166,0,0,0,21,0,21,0,21,0,21,0,70,0,99,0,140,0,
+234,1,92,1,192,2,37,2,124,2,229,3,74,3,164,3,176,3,188,3,200,3,212,3,224,
+3,236,4,60,4,136,4,196,5,15,5,102,5,178,6,21,6,126,6,200,7,13,7,83,7,156,
+7,230,8,67,8,170,8,223,9,47,9,125,9,195,9,237,10,39,10,141,10,208,11,28,11,
+89,11,153,11,224,12,28,12,107,12,165,12,254,13,70,13,161,13,245,14,14,14,
+71,14,97,14,105,14,155,14,198,14,244,15,26,15,83,15,115,15,143,15,189,15,
+201,15,213,15,225,15,255,16,143,16,253,17,108,17,192,18,36,18,83,18,136,18,
+199,19,0,19,62,19,122,19,194,19,246,20,31,20,76,20,117,20,129,20,129,20,148,
+20,184,21,15,21,27,21,39,21,51,21,63,21,75,21,87,21,99,21,111,21,123,21,135,
+21,147,21,159,21,171,21,183,21,195,21,207,21,219,21,231,21,243,21,255,22,
+11,22,23,22,35,22,47,22,59,22,71,22,83,22,95,22,107,22,119,22,131,22,143,
+22,155,22,167,23,24,23,130,23,161,23,188,24,0,24,63,24,103,24,161,24,173,
+24,232,24,244,25,76,25,140,25,193,25,205,25,217,25,229,25,241,26,68,26,106,
+26,166,26,178,26,235,27,6,27,50,27,146,27,196,28,0,28,46,28,94,28,106,28,
+148,28,202,28,245,29,58,29,119,29,193,29,253,30,89,30,180,30,192,30,204,30,
+216,30,228,30,244,31,0,31,16,31,28,31,40,31,52,31,68,31,84,31,100,31,116,
+31,128,31,140,31,152,31,168,31,180,31,192,31,204,31,216,31,228,31,240,31,
+252,32,8,32,24,32,36,32,48,32,60,32,72,32,84,32,96,32,108,32,193,33,18,33,
+82,33,162,33,174,33,255,34,11,34,23,34,109,34,183,34,195,34,207,34,219,34,
+231,35,83,35,136,35,222,36,54,36,132,36,179,36,243,37,95,37,167,37,249,38,
+58,38,128,38,140,38,204,39,32,39,95,39,186,40,6,40,107,40,189,41,54,41,163,
+41,175,41,187,41,199,41,211,41,227,41,239,41,255,42,15,42,27,42,39,42,55,
+42,71,42,87,42,103,42,115,42,127,42,139,42,151,42,163,42,175,42,187,42,199,
+42,211,42,223,42,235,42,247,43,7,43,19,43,31,43,43,43,55,43,67,43,79,43,91,
+43,164,43,236,44,30,44,92,44,104,44,168,44,180,44,192,45,12,45,74,45,86,45,
+98,45,110,45,122,45,213,45,250,46,60,46,72,46,135,46,171,46,219,47,63,47,
+123,47,191,47,246,48,43,48,55,48,105,48,169,48,217,49,34,49,101,49,186,49,
+198,50,46,50,146,50,158,50,170,50,182,50,194,50,210,50,222,50,238,50,254,
+51,10,51,22,51,38,51,54,51,70,51,86,51,98,51,110,51,122,51,138,51,150,51,
+162,51,174,51,186,51,198,51,210,51,222,51,234,51,250,52,6,52,18,52,30,52,
+42,52,54,52,66,52,82,52,213,53,77,53,162,54,46,54,178,55,62,55,186,56,67,
+56,212,57,84,57,186,58,29,58,134,59,14,59,153,60,8,60,155,61,17,61,132,61,
+251,62,145,63,9,63,110,63,242,64,107,64,228,65,120,66,4,66,57,66,164,67,39,
+67,135,68,6,68,109,68,224,69,104,69,206,70,39,70,145,70,220,71,111,71,211,
+72,62,72,170,73,22,73,125,73,238,73,250,74,110,74,122,74,233,75,92,75,186,
+76,25,76,122,76,234,77,80,77,118,77,175,77,228,77,240,78,57,78,146,78,158,
+78,224,79,51,79,100,79,151,79,219,80,8,80,51,80,111,80,173,80,235,81,58,81,
+70,81,82,81,94,81,106,81,118,81,130,81,142,81,154,81,166,81,213,81,225,81,
+237,81,249,82,5,82,17,82,29,82,41,82,53,82,65,82,77,82,191,83,67,83,186,84,
+57,84,153,84,244,85,66,85,153,86,3,86,115,86,127,86,139,86,151,86,163,86,
+175,86,187,86,199,86,211,86,223,86,235,87,43,87,91,87,153,87,216,88,17,88,
+106,88,147,88,215,89,17,89,47,89,93,89,147,89,212,90,4,90,56,90,104,90,170,
+90,215,91,36,91,94,91,173,92,18,92,112,92,124,92,136,92,148,92,160,92,172,
+92,184,92,196,92,208,92,220,92,232,92,244,93,0,93,12,93,24,93,36,93,48,93,
+60,93,72,93,84,93,96,93,108,93,180,93,236,94,48,94,117,94,182,95,22,95,63,
+95,136,95,202,95,239,96,35,96,97,96,170,96,226,97,28,97,82,97,156,97,207,
+98,30,98,94,98,183,99,8,99,117,99,217,99,229,99,241,99,253,100,9,100,21,100,
+33,100,45,100,57,100,69,100,81,100,93,100,105,100,117,100,129,100,141,100,
+153,100,165,100,177,100,189,100,201,100,213,100,225,101,76,101,149,102,17,
+102,149,102,240,103,70,103,176,104,23,104,131,104,240,105,112,105,153,105,
+243,106,67,106,130,107,9,107,97,107,195,108,35,108,131,108,223,109,65,109,
+172,110,3,110,87,110,175,111,24,111,122,111,202,112,39,112,140,112,209,113,
+31,113,95,113,184,114,35,114,168,114,250,115,123,115,225,116,57,116,147,116,
+243,117,55,117,67,117,79,117,91,117,103,117,115,117,127,117,139,117,151,117,
+163,117,175,117,187,117,246,118,2,118,61,118,73,118,126,118,138,118,213,119,
+50,119,168,119,214,119,226,120,19,120,71,120,116,120,156,120,179,120,229,
+121,23,121,73,121,124,121,176,121,228,121,240,121,252,122,8,122,20,122,32,
+122,44,122,111,122,181,122,248,123,59,123,127,123,205,124,32,124,118,124,
+201,125,28,125,112,125,206,125,206,126,0,126,50,126,62,126,74,126,142,126,
+210,127,38,127,122,127,181,127,243,128,40,128,116,128,219,129,83,129,91,129,
+99,129,107,129,115,129,123,129,131,129,174,129,224,130,17,130,46,130,54,130,
+62,130,108,130,124,130,140,130,156,130,172,130,188,130,204,130,220,130,236,
+131,10,131,38,131,100,131,172,131,193,131,231,132,13,132,51,132,78,132,97,
+132,113,132,135,132,160,132,206,132,229,133,19,133,78,133,117,133,163,133,
+223,133,242,134,58,134,119,134,161,134,199,134,223,134,246,135,15,135,74,
+135,101,135,126,135,152,135,173,135,187,135,242,136,8,136,64,136,106,136,
+114,136,130,136,146,136,170,136,195,136,231,137,12,137,65,137,102,137,151,
+137,167,137,219,137,232,137,251,138,17,138,46,138,69,138,81,138,100,138,126,
+138,142,138,167,138,201,138,245,139,46,139,82,139,140,0,2,0,193,0,0,4,10,
+5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,
+135,5,182,250,74,104,4,230,0,0,4,253,91,4,210,0,133,7,44,0,11,0,25,0,26,0,
+27,0,0,1,50,22,21,20,6,35,34,38,53,52,54,5,55,22,22,51,50,54,55,23,6,6,35,
+34,38,5,3,254,239,44,62,62,44,44,62,62,254,152,142,43,127,93,92,128,43,142,
+62,208,135,140,206,1,4,51,7,15,67,45,46,66,67,45,45,67,195,57,95,89,88,96,
+57,135,136,140,247,2,90,0,3,254,126,4,210,255,96,7,44,0,11,0,12,0,13,0,0,
+1,50,22,21,20,6,35,34,38,53,52,54,3,19,254,239,47,66,66,47,47,66,66,38,55,
+6,144,71,48,49,70,71,48,48,71,254,66,2,90,0,0,3,0,129,0,103,1,123,4,210,0,
+11,0,23,0,24,0,0,19,50,22,21,20,6,35,34,38,53,52,54,19,50,22,21,20,6,35,34,
+38,53,52,54,19,254,52,73,73,52,52,73,73,52,52,73,73,52,52,73,73,48,3,226,
+78,53,53,78,78,53,53,78,253,139,78,53,53,78,78,53,53,78,3,101,0,2,0,64,0,
+0,6,255,4,210,0,65,0,66,0,0,19,39,54,54,51,50,22,21,20,6,7,22,22,51,50,54,
+54,53,53,23,21,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,53,6,35,34,
+39,6,6,35,34,38,39,35,34,38,53,52,51,50,23,54,54,53,52,38,35,34,6,1,119,55,
+54,142,69,187,205,154,134,36,135,86,111,137,57,164,39,78,98,76,164,17,36,
+66,58,16,21,114,138,52,72,102,90,58,43,220,162,145,218,73,27,84,85,113,93,
+71,96,113,114,120,47,114,2,189,4,17,139,24,30,188,169,119,194,47,75,83,92,
+161,147,157,22,217,63,82,2,26,22,252,123,64,55,31,12,149,69,123,112,211,49,
+45,145,155,137,137,61,55,106,71,30,132,82,99,107,26,251,220,0,3,0,64,0,0,
+9,30,4,210,0,65,0,79,0,80,0,0,19,39,54,54,51,50,22,21,20,6,7,22,22,51,50,
+54,54,53,53,23,21,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,53,6,35,
+34,39,6,6,35,34,38,39,35,34,38,53,52,51,50,23,54,54,53,52,38,35,34,6,37,23,
+17,20,30,2,51,7,35,34,38,38,53,1,119,55,54,142,69,187,205,154,134,36,135,
+86,111,137,57,164,39,78,98,76,164,17,36,66,58,16,21,114,138,52,72,102,90,
+58,43,220,162,145,218,73,27,84,85,113,93,71,96,113,114,120,47,114,7,39,164,
+17,36,66,58,16,21,114,138,52,251,150,4,17,139,24,30,188,169,119,194,47,75,
+83,92,161,147,157,22,217,63,82,2,26,22,252,123,64,55,31,12,149,69,123,112,
+211,49,45,145,155,137,137,61,55,106,71,30,132,82,99,107,26,174,22,252,123,
+64,55,31,12,149,69,123,112,254,208,0,0,5,0,90,255,236,4,185,7,44,0,61,0,62,
+0,63,0,64,0,65,0,0,1,38,35,34,6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,
+22,51,50,54,53,52,38,39,46,2,53,52,54,55,23,6,6,21,20,23,30,2,21,20,0,33,
+34,38,53,52,54,55,38,38,53,52,54,51,50,23,19,3,37,1,2,82,84,61,92,102,85,
+85,84,103,49,31,19,27,32,122,147,149,150,183,214,36,68,51,43,23,96,96,109,
+74,57,71,60,57,31,254,219,254,233,215,242,52,52,99,95,185,156,101,90,21,201,
+2,61,254,248,4,41,19,81,70,77,108,43,31,4,148,2,118,106,112,120,190,163,71,
+145,122,90,96,99,55,102,160,67,137,53,85,62,86,130,111,129,145,69,234,254,
+243,208,172,77,129,52,66,160,101,125,164,22,251,68,4,210,108,1,238,0,3,0,
+90,255,236,5,145,7,44,0,66,0,67,0,68,0,0,1,38,35,34,6,21,20,22,23,54,51,50,
+23,7,38,35,34,6,21,20,22,51,50,54,53,52,38,39,46,2,53,52,54,51,50,22,23,7,
+38,35,34,6,21,20,22,23,22,18,21,20,0,33,34,38,53,52,54,55,38,38,53,52,54,
+51,50,23,19,1,2,82,84,61,92,102,85,85,84,103,49,31,19,27,32,122,147,149,150,
+183,214,68,79,81,78,36,183,152,131,189,71,152,88,149,76,91,52,111,104,73,
+254,219,254,233,215,242,52,52,99,95,185,156,101,90,21,254,111,4,41,19,81,
+70,77,108,43,31,4,148,2,118,106,112,120,190,163,110,229,152,155,172,141,71,
+144,179,139,158,57,206,92,86,70,164,215,202,255,0,120,234,254,243,208,172,
+77,129,52,66,160,101,125,164,22,251,68,4,210,0,0,4,0,118,255,236,4,155,7,
+44,0,49,0,50,0,51,0,52,0,0,1,38,38,35,34,4,2,21,16,18,51,50,54,53,52,39,6,
+7,39,54,54,53,52,38,35,34,7,39,54,51,50,22,21,20,7,22,22,21,20,6,35,32,0,
+17,16,18,36,51,50,23,9,2,4,19,28,92,36,187,254,243,143,235,222,130,139,132,
+82,108,30,170,181,109,95,129,128,52,165,147,173,193,146,73,74,228,199,254,
+208,254,182,181,1,85,240,100,91,254,134,1,103,254,253,6,2,8,10,177,254,158,
+241,254,191,254,179,113,107,147,88,26,7,150,10,109,92,78,92,63,141,73,168,
+147,165,100,66,162,84,169,193,1,158,1,139,1,13,1,167,227,22,249,106,4,210,
+2,90,0,0,4,0,118,255,236,7,11,7,44,0,62,0,63,0,64,0,65,0,0,1,54,51,50,22,
+21,20,7,22,22,21,20,6,35,32,0,17,16,18,36,51,50,4,19,17,20,30,2,51,7,35,34,
+38,38,53,17,38,36,35,34,4,2,21,16,18,51,50,54,53,52,39,6,7,39,54,54,53,52,
+38,35,34,7,9,2,1,244,165,147,173,193,146,73,74,229,208,254,216,254,184,181,
+1,93,242,255,1,104,121,17,36,66,58,16,21,114,138,52,90,254,229,193,196,254,
+240,140,233,224,130,139,132,82,108,30,170,181,109,95,129,128,1,115,2,97,254,
+20,4,137,73,168,147,165,100,66,162,84,171,191,1,160,1,131,1,15,1,169,229,
+252,254,238,252,157,64,55,31,12,153,69,123,112,3,69,207,207,188,254,157,228,
+254,188,254,182,113,107,147,88,26,7,150,10,109,92,78,92,63,252,4,4,210,2,
+90,0,0,3,0,23,0,0,6,84,4,210,0,63,0,64,0,65,0,0,1,1,39,1,38,38,35,34,6,7,
+39,54,54,51,50,22,23,55,17,23,17,22,51,50,55,38,53,52,54,51,50,22,21,20,7,
+22,22,21,20,6,7,39,54,54,53,52,39,6,35,34,38,39,17,20,30,2,51,7,35,34,38,
+38,53,19,1,3,66,253,232,102,1,240,70,161,124,68,115,73,58,70,162,74,154,200,
+135,16,164,112,147,41,29,20,75,62,65,78,62,52,43,105,118,84,81,64,55,59,67,
+74,146,59,17,36,66,58,16,21,114,138,52,109,1,207,2,118,254,158,143,1,38,102,
+123,32,40,143,37,46,129,175,9,1,181,22,254,204,115,8,40,42,58,67,81,67,74,
+59,80,117,63,98,146,57,131,38,84,56,96,91,17,46,42,254,94,64,55,31,12,149,
+69,123,112,254,208,1,46,0,0,4,0,87,253,220,5,186,4,210,0,55,0,56,0,57,0,58,
+0,0,5,6,35,34,38,53,52,54,55,54,53,52,38,35,34,6,7,39,54,55,38,35,34,6,21,
+20,22,23,7,38,38,53,52,54,51,50,23,54,55,17,23,17,22,22,21,20,7,6,6,21,20,
+22,51,50,54,55,5,39,1,5,186,140,137,151,176,132,130,51,85,78,102,141,43,157,
+25,39,105,103,80,90,134,151,110,187,156,193,135,167,141,87,120,164,114,132,
+83,122,120,92,71,57,94,81,252,247,170,2,235,107,71,159,130,105,146,36,103,
+97,87,94,152,150,49,96,69,81,90,76,89,200,136,107,166,251,123,141,167,115,
+81,24,1,66,22,254,215,23,171,131,153,154,19,88,76,61,69,26,41,37,214,253,
+6,0,255,255,0,64,0,0,6,255,7,44,2,34,0,7,0,0,0,3,0,64,7,16,0,0,255,255,0,
+64,0,0,6,255,7,44,2,34,0,7,0,0,0,3,0,65,7,16,0,0,255,255,0,64,0,0,6,255,7,
+44,2,34,0,7,0,0,0,3,0,66,7,16,0,0,255,255,0,64,0,0,9,30,7,44,2,34,0,8,0,0,
+0,3,0,64,9,47,0,0,255,255,0,64,0,0,9,30,7,44,2,34,0,8,0,0,0,3,0,65,9,47,0,
+0,255,255,0,64,0,0,9,30,7,44,2,34,0,8,0,0,0,3,0,66,9,47,0,0,0,6,0,37,255,
+236,4,16,4,210,0,41,0,42,0,43,0,44,0,45,0,46,0,0,19,37,38,38,53,52,54,51,
+50,23,7,38,38,35,34,6,21,20,22,23,37,23,5,22,22,21,20,6,35,32,39,55,22,51,
+50,54,53,52,38,38,39,5,1,19,35,1,5,77,1,29,76,76,196,162,128,110,30,68,77,
+46,99,108,75,76,1,165,66,254,182,129,113,206,191,254,235,217,92,185,207,119,
+120,41,107,100,254,134,1,182,72,205,2,89,252,48,2,65,102,59,134,75,128,159,
+27,149,17,9,79,73,52,96,44,157,144,114,85,164,99,138,173,169,128,147,82,82,
+45,79,97,62,145,254,80,4,210,254,27,169,0,1,0,13,0,0,5,231,4,210,0,53,0,0,
+19,55,51,50,30,2,21,21,20,22,22,51,50,54,54,53,17,23,21,22,51,50,55,17,23,
+17,20,30,2,51,7,35,34,38,38,53,17,6,35,34,39,6,6,35,34,38,38,53,53,52,38,
+38,13,16,21,89,114,68,33,43,80,60,64,79,35,164,39,78,98,76,164,17,36,66,58,
+16,21,114,138,52,72,102,80,53,32,171,125,124,149,72,32,67,4,39,149,39,66,
+101,98,189,107,93,42,53,92,97,1,11,22,217,63,82,1,212,22,252,123,64,55,31,
+12,149,69,123,112,1,25,49,35,116,126,95,155,140,182,79,60,23,0,2,0,22,0,0,
+5,42,4,210,0,24,0,38,0,0,1,34,38,39,55,22,22,51,50,54,53,52,38,35,34,7,39,
+54,54,51,50,22,21,20,6,1,23,17,20,30,2,51,7,35,34,38,38,53,1,174,123,201,
+84,130,65,124,81,92,99,115,114,114,108,52,59,153,72,183,201,178,1,125,164,
+17,36,66,58,16,21,114,138,52,1,108,128,128,89,101,94,139,134,149,150,56,138,
+30,36,231,219,208,212,3,102,22,252,123,64,55,31,12,149,69,123,112,0,1,0,90,
+0,0,4,230,4,210,0,52,0,0,1,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,
+35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,20,
+30,2,51,7,35,34,38,38,53,3,145,154,197,180,212,62,142,184,157,101,90,28,84,
+61,95,99,98,77,101,49,75,24,42,62,91,101,120,106,101,172,79,164,17,36,66,
+58,16,21,114,138,52,1,73,110,174,142,114,77,104,148,112,144,22,145,19,64,
+60,93,58,30,12,146,10,79,74,82,91,76,79,2,200,22,252,123,64,55,31,12,149,
+69,123,112,0,0,8,0,19,255,236,3,168,4,210,0,36,0,48,0,49,0,50,0,51,0,52,0,
+53,0,54,0,0,1,38,35,34,6,21,20,22,22,23,22,22,21,20,6,35,34,38,39,55,22,22,
+51,50,54,53,52,38,39,38,38,53,52,54,51,50,23,23,50,22,21,20,6,35,34,38,53,
+52,54,39,35,19,35,3,1,3,2,80,107,88,101,37,78,106,176,130,211,178,152,253,
+108,143,85,174,114,102,116,107,153,143,121,193,164,123,91,18,50,68,69,49,
+49,69,68,136,185,138,83,17,254,69,4,42,20,70,63,42,60,61,65,108,176,127,151,
+183,152,165,87,130,124,95,83,87,122,90,85,155,109,125,153,23,228,65,50,50,
+66,66,50,50,65,251,251,46,2,65,254,171,0,1,0,64,0,0,5,56,4,210,0,52,0,0,1,
+6,6,35,34,38,39,35,34,38,53,52,51,50,23,54,54,53,52,38,35,34,6,7,39,54,54,
+51,50,22,21,20,6,7,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,38,38,53,3,
+227,77,156,95,133,199,67,28,84,85,113,93,71,96,113,114,120,47,114,43,55,54,
+142,69,187,205,155,132,84,143,92,153,89,164,17,36,66,58,16,21,114,138,52,
+1,119,58,49,108,109,61,55,106,71,30,132,82,99,107,26,19,139,24,30,188,169,
+120,194,46,101,63,91,2,152,22,252,123,64,55,31,12,149,69,123,112,0,0,5,0,
+90,255,236,5,156,4,210,0,59,0,60,0,61,0,62,0,63,0,0,1,38,35,34,6,21,20,33,
+50,36,18,53,52,38,35,34,6,21,20,22,23,7,36,17,52,54,51,50,22,21,20,2,4,35,
+34,38,53,52,55,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,51,50,
+23,19,1,1,19,2,161,29,30,122,147,1,47,183,1,25,156,96,92,68,79,145,143,51,
+254,113,161,138,166,200,193,254,154,233,224,248,104,99,95,185,156,101,90,
+28,84,61,92,102,85,85,84,103,25,55,80,1,47,254,148,179,2,72,2,118,106,232,
+176,1,49,152,158,165,83,59,107,116,28,147,106,1,27,132,167,244,227,194,254,
+141,218,206,174,155,103,66,160,101,125,164,22,147,19,81,70,77,108,43,31,4,
+253,36,4,210,251,46,4,210,0,0,8,0,67,255,236,7,9,4,212,0,34,0,48,0,60,0,61,
+0,62,0,63,0,64,0,65,0,0,1,54,37,23,4,7,22,22,21,20,6,35,34,38,53,52,54,55,
+38,38,39,22,21,20,6,6,35,34,38,53,52,54,51,50,4,37,34,39,35,34,6,21,20,22,
+51,50,54,53,52,1,6,6,21,20,22,51,50,54,53,52,38,3,19,35,3,1,4,216,188,1,34,
+83,254,232,179,90,90,190,165,173,188,148,164,86,198,111,51,87,163,110,159,
+188,246,212,208,1,97,253,229,10,10,20,132,143,98,84,93,104,2,95,115,129,97,
+93,94,96,68,104,230,145,205,2,161,3,164,135,169,136,160,124,116,234,119,173,
+194,194,154,142,242,129,87,113,26,93,116,88,153,84,186,152,158,205,147,3,
+1,121,103,86,98,101,81,130,254,243,87,190,120,100,101,112,108,102,189,253,
+129,4,210,251,46,4,64,0,0,2,0,22,255,236,5,64,4,210,0,47,0,48,0,0,1,22,21,
+20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,
+54,55,17,23,17,22,22,21,20,6,7,39,54,54,53,52,38,35,34,19,3,30,17,196,179,
+137,202,79,129,80,122,83,103,108,131,130,64,100,63,52,64,158,71,121,175,54,
+84,99,164,119,128,117,127,114,104,89,119,104,80,136,2,142,80,98,244,252,131,
+125,88,119,75,177,174,183,194,24,31,139,30,35,105,104,40,5,1,135,22,254,124,
+36,196,146,135,220,104,126,78,154,107,115,131,253,70,0,1,0,22,0,0,5,120,4,
+210,0,46,0,0,1,6,35,34,39,6,6,35,34,3,55,22,22,51,50,54,53,52,38,35,34,7,
+39,54,54,51,50,22,23,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,4,35,
+82,122,51,36,20,170,151,236,169,130,65,124,81,92,99,115,113,114,109,52,59,
+153,72,168,198,12,32,48,126,81,164,17,36,66,58,16,21,114,138,52,2,213,46,
+7,161,161,1,0,89,101,94,139,134,149,150,56,138,30,36,202,194,10,71,1,79,22,
+252,123,64,55,31,12,149,69,123,112,0,5,0,90,255,236,3,156,4,210,0,40,0,41,
+0,42,0,43,0,44,0,0,37,23,6,6,35,34,38,53,52,54,54,55,62,2,53,52,38,35,34,
+6,7,39,54,51,50,22,21,20,6,6,7,14,2,21,20,22,51,50,54,3,35,19,35,3,80,76,
+114,192,115,183,230,54,128,142,116,97,42,89,84,79,117,52,52,148,156,160,174,
+58,109,102,120,130,57,135,114,92,163,194,185,166,88,233,145,60,48,200,151,
+73,125,122,78,62,65,61,40,64,65,28,26,138,64,148,126,73,115,87,55,65,90,95,
+64,83,103,49,4,31,251,46,0,6,0,90,255,236,3,226,4,210,0,28,0,41,0,42,0,43,
+0,44,0,45,0,0,1,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,38,53,52,54,55,
+38,38,53,52,54,51,50,23,3,35,34,6,21,20,22,51,50,54,53,52,38,3,3,35,3,3,50,
+81,115,79,82,83,128,180,142,241,211,214,238,193,178,83,82,172,150,133,97,
+222,13,157,198,146,135,135,152,91,56,68,82,35,4,40,22,53,48,48,81,77,110,
+201,131,164,193,205,174,139,201,38,56,126,70,108,137,23,253,184,148,125,108,
+118,110,104,90,126,2,164,251,46,4,210,0,0,7,0,19,255,236,3,153,4,210,0,36,
+0,37,0,38,0,39,0,40,0,41,0,42,0,0,1,38,35,34,6,21,20,22,23,30,2,21,20,6,35,
+34,38,39,55,22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,50,23,3,19,3,3,19,
+1,3,2,77,99,95,105,74,147,133,122,51,214,175,156,248,109,143,85,174,114,99,
+119,108,152,143,121,191,156,134,90,215,47,139,46,136,254,39,4,40,22,69,64,
+53,87,88,82,122,130,85,145,181,149,168,87,130,124,92,80,86,129,90,85,155,
+109,122,156,23,251,69,4,210,251,46,4,210,253,111,254,171,0,0,8,0,90,255,236,
+3,248,4,210,0,42,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,0,37,38,53,52,54,51,
+50,22,21,20,6,35,34,38,53,52,54,54,55,62,2,53,52,38,35,34,6,7,39,54,51,50,
+22,21,20,6,7,6,6,21,20,22,23,54,54,53,52,38,35,34,6,21,20,23,11,2,19,3,1,
+217,33,162,130,131,153,233,213,230,250,71,132,127,117,94,42,87,74,87,118,
+54,52,147,158,155,177,134,177,165,107,111,254,116,125,63,59,69,80,24,12,74,
+91,193,213,129,82,78,119,142,144,125,135,166,203,170,92,136,105,65,59,59,
+59,39,55,64,27,27,138,64,144,120,101,158,81,76,121,82,92,114,23,5,83,73,58,
+67,80,69,75,184,4,210,251,46,4,210,251,174,2,138,0,5,0,153,253,220,6,130,
+4,210,0,23,0,37,0,64,0,65,0,66,0,0,1,22,22,51,50,54,53,52,38,35,34,7,39,54,
+51,50,22,21,20,6,35,34,38,39,1,23,17,20,30,2,51,7,35,34,38,38,53,1,23,17,
+20,30,2,23,30,2,21,20,7,39,54,54,53,52,38,38,39,46,3,53,1,1,2,56,64,116,64,
+82,78,99,95,111,85,51,117,141,161,186,162,158,99,195,77,3,112,164,17,36,66,
+58,16,21,114,138,52,251,108,164,10,43,122,159,139,132,45,97,133,27,30,44,
+117,110,152,140,60,18,2,191,254,55,2,215,81,69,123,128,131,130,47,134,58,
+215,191,197,201,107,98,2,87,22,252,123,64,55,31,12,149,69,123,112,3,162,22,
+253,193,108,74,59,71,67,59,101,96,64,112,117,93,31,61,34,42,64,68,46,62,85,
+85,91,95,251,166,2,213,0,0,2,0,89,0,0,4,132,4,210,0,31,0,32,0,0,1,35,34,6,
+6,21,20,22,23,7,38,38,53,52,54,54,51,33,17,23,17,20,30,2,51,7,35,34,38,38,
+53,5,3,47,239,126,121,72,139,147,111,189,154,88,185,188,1,9,164,17,36,66,
+58,16,21,114,138,52,254,169,2,226,31,84,65,92,202,130,110,168,253,126,86,
+144,85,1,92,22,252,123,64,55,31,12,149,69,123,112,132,0,0,3,0,86,0,0,4,239,
+4,210,0,50,0,51,0,52,0,0,1,6,6,35,34,38,39,54,54,53,52,38,35,34,6,21,20,22,
+23,7,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,54,55,17,23,17,20,30,2,51,
+7,35,34,38,38,53,1,3,3,154,84,173,102,173,238,66,207,207,69,57,58,68,44,48,
+95,155,154,129,136,151,175,182,40,126,86,106,176,85,164,17,36,66,58,16,21,
+114,138,52,253,181,219,1,156,62,51,177,177,56,160,107,56,64,51,43,42,55,24,
+111,86,150,99,129,149,114,129,195,75,63,62,69,83,2,123,22,252,123,64,55,31,
+12,149,69,123,112,2,102,254,99,0,4,0,90,255,236,3,201,4,210,0,49,0,50,0,51,
+0,52,0,0,1,38,35,34,6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,
+55,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,
+22,23,3,3,35,2,162,92,83,118,126,87,89,91,108,81,73,28,58,64,132,157,137,
+130,83,44,7,63,54,55,65,200,159,197,233,55,55,103,97,204,184,51,128,45,64,
+79,185,4,36,24,86,75,70,107,44,34,13,147,10,121,105,115,117,18,17,30,51,60,
+69,50,96,109,208,172,76,128,53,66,155,97,133,166,15,12,251,73,4,210,0,1,0,
+90,0,0,4,200,5,44,0,48,0,0,19,38,53,52,54,55,23,6,6,21,20,23,54,51,50,23,
+7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,38,38,53,53,
+6,35,34,38,53,52,233,143,166,165,60,109,117,97,77,102,49,75,24,42,62,91,101,
+119,105,93,152,79,164,17,36,66,58,16,21,114,138,52,140,184,178,211,2,215,
+108,150,115,173,51,148,30,100,76,99,60,30,12,146,10,79,74,82,91,59,74,2,222,
+22,252,123,64,55,31,12,149,69,123,112,9,94,174,142,116,0,0,1,0,49,0,0,4,78,
+4,210,0,26,0,0,1,33,21,20,6,35,34,38,38,53,52,51,33,17,23,17,20,30,2,51,7,
+35,34,38,38,53,2,249,254,143,56,49,48,114,76,124,2,76,164,17,36,66,58,16,
+21,114,138,52,2,160,117,57,60,88,130,56,108,1,158,22,252,123,64,55,31,12,
+149,69,123,112,0,1,0,13,0,0,4,122,4,210,0,39,0,0,1,6,35,34,38,38,53,53,52,
+38,38,35,55,51,50,30,2,21,21,20,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,
+38,38,53,3,37,119,145,103,155,93,32,67,78,16,21,89,114,68,33,93,111,62,129,
+56,164,17,36,66,58,16,21,114,138,52,1,151,78,81,158,149,184,79,60,23,149,
+39,66,101,98,176,145,110,56,52,2,137,22,252,123,64,55,31,12,149,69,123,112,
+0,6,0,77,253,220,4,16,4,210,0,60,0,61,0,62,0,63,0,64,0,65,0,0,19,37,38,38,
+53,52,54,51,50,23,7,38,38,35,34,6,21,20,22,23,37,23,5,22,22,21,20,6,35,35,
+34,39,30,2,51,51,7,35,34,38,39,38,38,53,52,54,51,50,22,23,22,51,50,54,53,
+52,38,38,39,5,1,35,19,19,55,77,1,29,76,76,196,162,128,110,30,68,77,46,99,
+108,75,76,1,165,66,254,182,129,113,206,191,24,12,13,49,85,93,74,48,18,32,
+142,228,118,104,100,61,47,55,94,45,57,78,113,121,41,107,100,254,134,1,254,
+205,251,244,106,2,65,102,59,134,75,128,159,27,149,17,9,79,73,52,96,44,157,
+144,114,85,164,99,138,173,1,59,64,27,154,143,174,13,83,59,45,55,58,54,12,
+87,82,45,79,97,62,145,3,34,249,10,4,104,169,0,1,0,90,0,0,5,207,4,210,0,44,
+0,0,1,6,35,34,39,6,6,35,34,38,53,52,18,55,23,4,17,20,22,51,50,54,54,53,53,
+23,21,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,4,122,72,102,93,57,
+41,178,126,174,213,221,220,47,254,192,121,101,77,98,36,164,39,78,98,76,164,
+17,36,66,58,16,21,114,138,52,2,3,49,47,101,103,228,188,183,1,1,69,149,96,
+254,245,128,137,69,119,110,161,22,217,63,82,2,26,22,252,123,64,55,31,12,149,
+69,123,112,0,0,2,0,93,0,0,6,103,4,210,0,51,0,52,0,0,37,7,38,2,53,52,54,51,
+50,22,22,21,21,33,17,23,17,20,30,2,51,7,35,34,38,38,53,17,33,21,20,6,35,34,
+38,38,53,52,54,51,51,53,52,38,38,35,34,6,21,20,18,23,2,81,114,208,178,237,
+192,131,180,87,1,122,164,17,36,66,58,16,21,114,138,52,254,134,54,45,48,118,
+79,64,61,55,45,103,85,126,139,149,172,211,111,183,1,65,182,200,248,111,194,
+156,25,1,230,22,252,123,64,55,31,12,149,69,123,112,1,40,78,60,68,87,127,50,
+43,47,13,118,133,74,168,135,147,254,248,124,0,1,0,88,0,0,4,177,4,210,0,41,
+0,0,1,33,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,55,51,50,30,2,
+21,17,33,17,23,17,20,30,2,51,7,35,34,38,38,53,3,92,254,84,54,45,48,118,79,
+64,61,55,32,67,78,16,21,89,114,68,33,1,172,164,17,36,66,58,16,21,114,138,
+52,1,244,78,60,68,87,127,50,43,47,254,79,60,23,149,39,66,101,98,254,251,2,
+74,22,252,123,64,55,31,12,149,69,123,112,0,0,2,0,29,0,0,4,176,4,210,0,40,
+0,41,0,0,1,6,6,35,34,38,39,36,53,52,38,35,34,7,39,54,51,50,22,21,20,7,22,
+22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,37,3,91,77,143,83,165,237,
+65,1,12,101,86,55,49,37,78,74,160,181,223,36,134,81,178,131,164,17,36,66,
+58,16,21,114,138,52,253,28,1,169,55,41,178,176,75,166,75,89,11,140,17,166,
+142,205,108,64,72,134,2,111,22,252,123,64,55,31,12,149,69,123,112,231,0,6,
+0,60,0,0,3,125,4,210,0,38,0,39,0,40,0,41,0,42,0,43,0,0,33,34,38,39,6,35,34,
+38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,7,
+30,2,51,51,7,33,11,2,1,3,75,153,252,135,29,26,94,94,69,55,51,77,37,139,153,
+134,120,74,128,73,52,169,162,197,222,187,164,79,119,115,80,41,18,254,159,
+2,64,106,1,142,175,220,2,58,66,47,57,31,27,31,149,105,113,123,29,34,141,72,
+204,184,144,222,54,111,114,47,154,4,210,251,46,4,210,253,75,0,2,0,90,0,0,
+5,37,4,210,0,17,0,35,0,0,1,6,35,34,0,53,52,0,55,23,6,6,21,20,22,51,50,55,
+19,5,39,37,17,23,17,20,30,2,51,7,35,34,38,38,53,3,74,115,155,221,254,251,
+1,16,250,41,201,194,166,141,122,92,197,254,36,38,2,2,164,17,36,66,58,16,21,
+114,138,52,1,15,55,1,5,222,198,1,26,55,152,42,196,163,149,166,42,1,56,98,
+151,103,1,102,22,252,123,64,55,31,12,149,69,123,112,0,0,2,0,90,0,0,5,239,
+4,210,0,53,0,54,0,0,1,52,38,38,35,34,6,6,21,21,20,14,2,35,34,38,53,52,18,
+55,23,6,6,21,20,22,51,50,62,2,53,53,52,54,54,51,50,22,22,21,17,20,30,2,51,
+7,35,34,38,38,53,3,4,154,20,73,54,56,72,21,31,89,153,113,182,224,222,219,
+47,156,164,125,111,62,83,54,25,67,142,104,100,138,73,17,36,66,58,16,21,114,
+138,52,135,3,45,88,104,62,62,98,93,47,120,163,124,71,235,200,179,1,5,70,149,
+51,181,136,136,145,35,64,97,98,107,146,142,87,82,139,126,253,214,64,55,31,
+12,149,69,123,112,3,162,0,0,1,0,90,0,0,4,142,4,210,0,38,0,0,1,6,6,35,34,38,
+53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,20,30,2,51,
+7,35,34,38,38,53,3,57,78,153,94,180,230,246,203,43,115,39,27,89,75,138,152,
+130,112,96,150,82,164,17,36,66,58,16,21,114,138,52,1,167,52,42,210,167,183,
+216,13,10,145,18,129,117,109,123,59,77,2,109,22,252,123,64,55,31,12,149,69,
+123,112,0,0,4,0,63,0,0,5,90,4,210,0,43,0,57,0,58,0,59,0,0,1,38,38,53,52,54,
+51,50,22,22,21,20,6,7,22,22,51,51,7,35,34,38,39,6,35,34,53,52,54,51,50,23,
+54,54,53,52,38,35,34,6,21,20,22,23,1,23,17,20,30,2,51,7,35,34,38,38,53,37,
+3,1,219,173,167,163,140,104,175,96,189,163,110,137,107,27,18,32,132,231,125,
+30,30,181,69,55,92,77,146,146,119,95,67,73,126,109,1,244,164,17,36,66,58,
+16,21,114,138,52,253,186,84,2,168,41,150,121,103,139,92,176,120,149,234,54,
+156,99,154,176,201,2,124,47,57,61,35,157,121,113,121,59,43,71,77,22,1,161,
+22,252,123,64,55,31,12,149,69,123,112,253,1,15,0,3,0,13,0,0,4,142,4,210,0,
+32,0,43,0,44,0,0,1,6,35,34,38,38,53,53,52,38,38,35,55,51,50,23,1,22,23,17,
+23,17,20,30,2,51,7,35,34,38,38,53,1,20,22,51,50,55,37,38,39,22,21,1,3,57,
+127,157,103,155,93,32,66,79,16,21,152,74,1,165,54,74,164,17,36,66,58,16,21,
+114,138,52,254,41,93,111,134,126,254,252,130,83,9,1,247,1,165,92,81,158,149,
+212,62,52,20,149,62,254,201,40,62,1,241,22,252,123,64,55,31,12,149,69,123,
+112,1,172,145,110,109,193,97,72,51,93,254,146,0,2,0,63,0,0,5,160,4,210,0,
+62,0,63,0,0,1,6,35,34,39,6,6,7,30,2,51,51,7,35,34,38,39,6,35,34,38,53,52,
+54,51,50,23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,7,22,51,50,55,17,
+23,17,20,30,2,51,7,35,34,38,38,53,37,4,75,86,122,91,71,44,134,91,81,120,117,
+77,41,18,32,154,254,132,31,31,89,92,69,55,90,73,131,133,126,114,72,121,66,
+52,161,157,188,214,5,47,60,131,83,164,17,36,66,58,16,21,114,138,52,253,232,
+2,156,53,26,74,106,32,114,115,46,154,177,219,3,58,66,47,57,56,35,145,103,
+113,123,30,33,141,72,203,185,34,30,18,85,1,129,22,252,123,64,55,31,12,149,
+69,123,112,237,0,5,0,95,255,236,5,7,4,210,0,31,0,49,0,50,0,51,0,52,0,0,1,
+22,51,50,53,52,38,39,38,38,53,52,54,51,50,23,7,38,35,34,21,20,22,23,22,22,
+21,20,6,35,32,3,3,6,21,20,4,51,50,55,23,6,6,35,34,36,2,53,52,55,1,35,19,2,
+15,141,199,150,84,111,135,127,165,149,97,106,31,92,105,127,77,93,153,136,
+169,147,254,226,192,50,74,1,30,254,238,180,66,127,208,148,227,254,193,163,
+87,2,190,185,43,2,168,203,104,60,68,40,48,126,87,106,118,23,148,25,76,39,
+53,33,55,139,109,121,134,1,10,1,44,145,158,214,248,84,147,47,40,156,1,30,
+183,187,171,1,15,251,46,0,0,2,253,128,254,118,254,98,0,0,0,11,0,12,0,0,5,
+50,22,21,20,6,35,34,38,53,52,54,55,253,241,47,66,66,47,47,66,66,47,156,71,
+48,49,70,71,48,48,71,156,0,0,1,0,25,0,78,3,112,4,188,0,36,0,0,1,33,34,6,6,
+21,20,22,22,23,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,39,38,
+38,53,52,54,54,51,33,3,87,254,214,69,40,23,25,77,103,146,104,185,159,152,
+251,108,144,82,172,114,83,91,94,131,117,109,78,121,119,1,21,4,40,19,30,24,
+29,46,76,82,118,167,105,136,154,151,166,87,123,131,74,67,72,122,104,94,150,
+92,68,97,44,0,0,1,0,185,0,0,2,14,4,210,0,13,0,0,19,23,17,20,30,2,51,7,35,
+34,38,38,53,185,164,17,36,66,58,16,21,114,138,52,4,210,22,252,123,64,55,31,
+12,149,69,123,112,0,255,255,0,185,0,0,5,11,7,44,2,2,2,105,0,0,0,2,254,116,
+0,0,2,14,7,44,0,29,0,30,0,0,1,20,30,2,51,7,35,34,38,38,53,17,38,38,35,34,
+6,21,20,23,35,38,53,52,54,51,50,18,19,5,1,93,17,36,66,58,16,21,114,138,52,
+27,151,95,68,76,25,159,30,162,131,174,234,44,254,222,1,59,64,55,31,12,153,
+69,123,112,3,179,192,245,98,90,87,100,114,92,144,173,254,210,254,244,32,0,
+0,3,252,79,253,220,0,35,0,0,0,22,0,23,0,24,0,0,5,54,51,50,22,21,20,6,35,34,
+36,39,55,22,22,51,50,53,52,38,35,34,7,55,1,253,250,107,121,152,173,194,173,
+180,254,215,136,128,123,217,145,216,88,76,98,87,107,253,199,48,48,147,129,
+125,147,167,176,88,157,128,141,57,64,44,184,254,255,0,0,3,253,76,253,220,
+1,29,0,0,0,24,0,25,0,26,0,0,3,6,35,34,38,53,52,54,51,50,4,23,7,38,38,35,34,
+6,21,20,22,51,50,54,55,3,1,139,113,113,153,174,190,160,187,1,44,140,125,125,
+229,137,102,108,86,79,46,84,55,167,2,116,254,11,47,151,127,118,152,181,206,
+80,177,151,69,65,63,66,18,26,1,102,254,185,0,3,253,213,253,220,0,49,0,36,
+0,18,0,19,0,20,0,0,19,6,35,34,38,53,52,54,55,21,6,6,21,20,22,51,50,54,55,
+1,23,49,140,137,151,176,190,171,105,103,92,71,57,94,81,254,161,164,254,35,
+71,159,130,122,163,10,137,15,83,71,61,69,26,41,1,77,104,0,0,2,253,213,252,
+218,0,125,0,36,0,35,0,36,0,0,19,6,35,34,38,53,52,55,38,53,52,54,55,21,6,6,
+21,20,22,51,50,54,55,23,6,35,34,39,6,21,20,22,51,50,54,55,1,125,136,137,154,
+173,32,112,190,171,102,108,86,80,57,93,82,51,136,137,36,33,27,85,81,57,93,
+82,254,80,253,32,70,146,123,58,50,77,133,103,142,10,137,10,69,56,53,57,22,
+35,129,70,5,31,40,54,56,22,35,2,95,0,0,4,252,198,4,210,255,155,7,44,0,11,
+0,12,0,13,0,14,0,0,3,6,35,34,36,39,55,22,22,51,50,55,7,19,7,101,78,87,156,
+254,238,130,125,118,191,126,65,52,209,13,206,5,57,24,187,197,81,173,141,19,
+249,2,90,198,0,2,252,226,4,210,255,45,7,44,0,12,0,13,0,0,1,38,38,35,34,7,
+39,54,51,50,22,22,23,7,254,155,52,129,106,56,50,48,82,83,127,153,103,39,147,
+5,33,191,180,19,146,25,121,236,166,79,0,2,252,61,4,210,255,50,7,44,0,25,0,
+26,0,0,1,39,7,38,38,35,34,7,39,54,51,50,22,23,38,38,35,34,7,39,54,51,50,22,
+22,23,7,254,171,10,80,123,152,90,68,51,48,78,87,111,184,148,39,103,107,56,
+50,48,82,83,113,142,97,35,152,5,33,43,79,99,76,20,144,24,96,130,163,150,19,
+143,25,111,224,188,79,0,255,255,254,229,0,0,2,14,7,44,2,34,0,57,0,0,0,3,0,
+64,2,31,0,0,255,255,255,1,0,0,2,14,7,44,2,34,0,57,0,0,0,3,0,65,2,31,0,0,255,
+255,254,92,0,0,2,14,7,44,2,34,0,57,0,0,0,3,0,66,2,31,0,0,0,3,254,128,253,
+221,1,85,0,0,0,11,0,12,0,13,0,0,5,54,51,50,4,23,7,38,38,35,34,7,39,1,254,
+128,78,87,154,1,17,133,125,118,191,126,65,52,22,2,172,106,24,183,201,81,173,
+141,19,252,254,105,0,4,0,25,255,236,6,200,7,44,0,11,0,25,0,99,0,100,0,0,1,
+50,22,21,20,6,35,34,38,53,52,54,5,55,22,22,51,50,54,55,23,6,6,35,34,38,1,
+54,51,50,22,21,20,7,23,22,51,50,54,55,55,54,54,51,50,22,21,20,6,35,34,38,
+39,55,22,22,51,50,54,53,52,38,35,34,6,7,7,6,6,35,35,22,21,20,6,35,34,38,39,
+55,22,22,51,50,54,53,52,39,6,7,39,54,54,53,52,38,35,34,6,7,1,3,154,44,62,
+62,44,44,62,62,254,152,142,43,127,93,92,128,43,142,62,208,135,140,206,254,
+108,166,165,190,199,117,30,38,48,41,65,37,61,74,144,108,135,179,196,164,83,
+141,74,100,51,95,58,81,108,84,71,54,82,53,54,52,123,84,12,17,214,181,152,
+241,106,142,84,161,107,112,123,115,105,160,30,200,184,118,111,76,117,81,1,
+243,6,223,67,45,46,66,67,45,45,67,195,57,95,89,88,96,57,135,136,140,254,240,
+73,172,157,155,100,31,23,46,59,98,120,92,195,172,165,197,63,67,107,47,44,
+118,100,101,116,61,89,91,88,82,59,58,161,194,149,168,86,128,125,107,102,145,
+89,42,16,156,16,111,102,87,96,27,36,3,48,0,0,2,0,23,0,0,7,82,4,210,0,73,0,
+74,0,0,1,1,39,1,38,38,35,34,6,7,39,54,54,51,50,22,23,55,17,23,17,22,51,50,
+55,38,53,52,54,51,50,22,21,20,7,22,23,6,6,21,20,22,51,50,54,55,23,6,35,34,
+38,53,52,54,55,38,39,6,35,34,38,39,17,20,30,2,51,7,35,34,38,38,53,19,3,66,
+253,232,102,1,240,70,161,124,68,115,73,58,70,162,74,154,200,135,16,164,118,
+159,44,29,21,79,63,65,78,64,63,43,116,115,92,71,57,94,81,56,140,137,151,176,
+104,95,28,16,53,76,80,157,61,17,36,66,58,16,21,114,138,52,109,2,118,254,158,
+143,1,38,102,123,32,40,143,37,46,129,175,9,1,181,22,254,209,120,8,38,44,58,
+67,81,67,85,56,115,151,15,81,75,61,69,26,41,144,71,159,130,90,138,36,71,31,
+14,49,44,254,89,64,55,31,12,149,69,123,112,254,208,0,4,0,87,253,220,6,11,
+4,210,0,72,0,73,0,74,0,75,0,0,37,52,54,55,54,53,52,38,35,34,6,7,39,54,55,
+38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,23,54,55,17,23,17,22,22,21,
+20,7,6,6,21,20,22,51,50,54,55,23,6,35,34,39,6,21,20,22,51,50,54,55,23,6,35,
+34,38,53,52,55,38,7,39,1,3,99,150,140,18,85,78,102,141,43,157,25,39,105,103,
+80,90,134,151,110,187,156,193,135,167,141,87,120,164,114,132,45,136,141,86,
+80,57,93,82,51,136,137,36,33,27,85,81,57,93,82,51,136,137,154,173,32,112,
+234,163,3,28,231,93,132,25,57,60,87,94,152,150,49,96,69,81,90,76,89,200,136,
+107,166,251,123,141,167,115,81,24,1,66,22,254,215,23,171,131,116,112,11,71,
+66,52,57,22,35,129,70,5,29,42,54,56,22,35,129,70,146,123,58,50,77,99,214,
+253,6,0,3,252,47,252,218,0,79,0,1,0,53,0,54,0,55,0,0,19,6,35,34,38,53,52,
+55,54,53,52,38,35,34,6,7,39,54,55,38,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,22,23,54,51,50,22,21,20,7,6,6,21,20,22,51,50,54,55,1,1,79,108,108,
+119,139,242,23,62,57,76,101,31,142,23,31,34,72,44,60,74,110,123,102,145,134,
+155,111,63,115,67,98,140,103,143,62,111,103,70,53,46,72,56,254,115,254,201,
+253,16,54,126,105,183,53,48,49,55,59,119,111,37,82,51,25,30,73,56,80,155,
+111,98,125,214,107,122,139,39,51,90,127,110,112,104,12,63,55,44,49,21,30,
+2,112,253,196,0,0,3,252,47,252,218,1,23,0,1,0,67,0,68,0,69,0,0,5,54,51,50,
+22,21,21,6,21,6,21,20,22,51,50,54,55,23,6,35,34,39,6,21,20,22,51,50,54,55,
+23,6,35,34,38,53,52,55,38,53,52,55,38,35,34,6,7,39,54,55,38,38,35,34,6,21,
+20,22,23,7,38,38,53,52,54,51,50,22,55,1,254,46,98,140,100,146,1,155,69,54,
+46,72,56,40,108,108,19,20,2,70,53,46,72,56,40,108,108,119,139,7,87,129,30,
+73,76,101,31,142,23,31,34,72,44,60,74,110,123,102,145,134,155,111,63,115,
+175,254,207,89,90,131,115,9,6,3,26,79,35,39,21,30,125,52,2,9,12,44,49,21,
+30,125,52,122,104,34,25,56,104,118,61,54,119,111,37,82,51,25,30,73,56,80,
+155,111,98,125,214,107,122,139,39,38,253,196,0,3,0,133,0,201,3,226,4,210,
+0,15,0,27,0,28,0,0,37,34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,3,34,6,21,
+20,22,51,50,54,53,52,38,3,2,53,124,198,110,109,198,123,127,198,106,113,197,
+116,117,150,143,116,116,150,142,137,201,107,196,123,119,194,110,110,194,122,
+123,193,107,2,185,156,120,120,149,156,121,120,148,1,80,0,2,0,175,0,0,4,5,
+4,210,0,23,0,35,0,0,1,6,35,34,38,53,52,54,51,50,22,21,17,20,30,2,51,7,35,
+34,38,38,53,17,53,52,38,35,34,6,21,20,22,51,50,2,176,74,89,152,198,187,152,
+159,179,17,36,66,58,16,21,114,138,52,87,84,82,95,103,85,89,2,87,29,187,149,
+141,187,184,209,253,238,64,55,31,12,149,69,123,112,1,204,43,160,119,104,87,
+83,94,0,0,2,0,157,0,0,4,56,4,210,0,39,0,40,0,0,33,34,38,39,7,6,38,38,53,52,
+54,51,50,22,23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,7,22,22,51,
+50,55,23,6,3,3,92,145,225,112,16,23,110,72,69,55,51,77,37,139,153,134,120,
+74,128,73,52,169,162,197,222,197,170,89,136,103,73,82,57,100,166,174,220,
+1,1,10,56,59,47,57,31,27,31,149,105,113,123,29,34,141,72,204,184,147,227,
+51,154,114,41,141,53,2,29,0,0,1,0,77,255,236,3,203,4,211,0,37,0,0,1,6,7,39,
+54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,7,22,22,21,20,6,35,34,38,39,
+55,22,22,51,50,54,53,52,2,179,105,160,30,200,184,118,111,76,117,81,52,166,
+165,190,199,117,71,72,214,181,152,241,106,142,84,161,107,112,123,2,61,42,
+16,156,16,111,103,87,96,27,36,141,73,172,157,156,100,66,163,86,161,194,149,
+168,86,128,125,107,102,145,0,3,0,16,255,236,4,88,4,210,0,22,0,35,0,36,0,0,
+19,4,23,54,55,23,7,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,1,1,14,2,21,
+20,22,51,50,54,53,52,38,1,123,1,20,165,199,240,109,242,138,66,103,93,164,
+150,148,169,113,113,104,254,175,2,30,66,70,28,81,71,72,81,68,254,21,4,210,
+239,175,198,216,119,217,122,64,112,199,122,136,163,173,127,120,198,114,107,
+1,39,253,255,71,104,88,59,72,81,85,71,87,145,2,60,0,1,0,20,0,0,4,69,4,210,
+0,40,0,0,1,6,35,34,38,38,53,53,52,38,38,35,55,51,50,30,2,21,21,20,22,22,51,
+50,54,55,17,23,17,20,30,2,51,7,35,34,38,38,53,2,240,106,138,91,137,83,32,
+67,78,16,21,89,114,68,33,36,70,66,62,115,42,164,17,36,66,58,16,21,114,138,
+52,1,145,72,73,154,143,202,79,60,23,149,39,66,101,98,202,94,92,43,59,47,2,
+139,22,252,123,64,55,31,12,149,69,123,112,0,0,3,0,193,253,220,3,252,4,210,
+0,44,0,45,0,46,0,0,1,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,
+23,7,38,35,34,6,21,20,22,23,22,22,21,20,6,7,39,54,53,52,38,39,38,38,53,52,
+1,3,1,95,158,215,200,114,123,28,101,100,124,131,113,105,139,93,90,28,76,88,
+127,137,128,133,160,154,41,56,133,57,80,132,190,168,2,160,229,2,133,123,167,
+136,163,29,148,26,85,75,111,74,49,15,148,12,105,101,89,111,41,50,132,103,
+58,107,72,93,67,59,50,62,46,67,181,144,120,254,104,253,72,0,1,0,51,255,237,
+4,23,4,210,0,32,0,0,19,55,22,22,51,50,54,17,52,38,38,35,34,6,21,20,22,51,
+7,32,36,53,52,54,51,50,22,18,21,16,33,34,0,51,169,42,181,154,145,133,70,127,
+84,78,92,200,211,3,254,229,254,217,184,161,129,203,116,254,70,233,254,244,
+2,51,22,233,220,218,1,0,131,226,123,92,76,118,113,153,200,190,137,173,147,
+254,216,209,253,167,1,35,0,2,0,148,255,236,3,250,4,210,0,20,0,21,0,0,1,23,
+1,6,6,21,20,22,51,50,54,55,23,6,33,34,38,53,52,54,55,1,3,85,129,254,81,148,
+88,132,111,94,173,117,76,213,254,255,171,229,95,124,2,13,4,210,121,254,90,
+145,142,76,92,106,52,72,142,132,193,159,111,174,125,1,88,0,0,2,0,98,255,236,
+4,41,4,209,0,18,0,22,0,0,1,4,6,21,20,22,51,50,55,23,6,35,34,36,2,53,52,0,
+37,1,5,39,37,2,252,255,0,238,233,200,150,150,62,162,195,190,254,236,144,1,
+64,1,43,1,45,254,2,38,1,255,4,58,78,249,210,196,216,53,145,61,146,1,9,172,
+236,1,93,85,253,126,121,156,118,0,0,3,0,88,255,255,2,184,4,210,0,11,0,23,
+0,24,0,0,5,34,38,53,52,54,51,50,22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,
+38,3,1,137,130,175,171,134,131,172,172,132,74,88,91,71,72,90,91,44,1,161,
+125,122,162,162,122,123,163,1,180,85,65,68,84,85,67,66,84,3,31,255,255,0,
+70,253,220,6,64,4,211,0,35,0,86,3,136,0,0,0,2,1,185,10,0,0,3,255,202,253,
+220,0,54,7,44,0,3,0,4,0,5,0,0,3,17,51,17,17,3,54,108,6,254,173,7,160,248,
+96,8,127,246,176,0,0,3,254,213,253,220,1,43,7,44,0,14,0,15,0,16,0,0,19,23,
+7,39,17,35,17,7,39,55,39,55,23,55,23,3,3,74,225,75,170,108,170,75,225,225,
+75,224,224,75,216,44,5,43,220,73,169,249,255,6,1,169,73,220,217,73,220,220,
+74,1,41,246,176,0,0,8,0,106,0,222,3,170,4,29,0,7,0,15,0,23,0,31,0,39,0,47,
+0,55,0,63,0,0,1,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,5,20,35,34,53,
+52,51,50,19,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,53,52,
+51,50,5,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,2,69,60,58,58,60,254,
+247,59,59,59,59,2,18,59,59,59,59,92,60,59,59,60,253,54,59,59,59,59,92,59,
+59,59,59,2,18,59,59,59,59,254,247,60,58,58,60,3,227,59,59,58,160,59,59,59,
+59,59,59,59,254,198,59,59,59,59,59,59,59,254,198,59,59,59,59,59,59,59,161,
+59,59,59,0,255,255,0,37,254,118,4,16,4,210,2,34,0,21,0,0,0,3,0,55,4,26,0,
+0,255,255,0,13,255,207,5,231,4,210,2,34,0,22,0,0,0,3,2,216,4,111,1,89,255,
+255,0,22,255,236,5,42,4,210,2,34,0,23,0,0,0,3,2,216,4,14,1,118,255,255,0,
+90,255,73,4,230,4,210,2,34,0,24,0,0,0,3,0,55,4,26,0,211,255,255,0,19,254,
+118,3,168,4,210,2,34,0,25,0,0,0,3,0,55,4,5,0,0,255,255,0,64,255,145,5,56,
+4,210,2,34,0,26,0,0,0,3,0,55,4,37,1,27,255,255,0,90,254,118,5,156,4,210,2,
+34,0,27,0,0,0,3,0,55,4,229,0,0,255,255,0,67,254,118,7,9,4,212,2,34,0,28,0,
+0,0,3,0,55,6,135,0,0,255,255,0,22,254,118,5,64,4,210,2,34,0,29,0,0,0,3,0,
+55,4,218,0,0,255,255,0,22,255,236,5,120,4,210,2,34,0,30,0,0,0,3,2,216,4,14,
+1,118,255,255,0,90,254,118,3,156,4,210,2,34,0,31,0,0,0,3,0,55,3,220,0,0,255,
+255,0,90,254,118,3,226,4,210,2,34,0,32,0,0,0,3,0,55,4,32,0,0,255,255,0,19,
+254,118,3,153,4,210,2,34,0,33,0,0,0,3,0,55,3,252,0,0,255,255,0,90,254,118,
+3,248,4,210,2,34,0,34,0,0,0,3,0,55,4,31,0,0,255,255,0,153,253,220,6,130,4,
+210,2,34,0,35,0,0,0,3,0,55,3,219,0,0,255,255,0,89,254,146,4,132,4,210,2,34,
+0,36,0,0,0,3,0,55,3,236,0,28,255,255,0,86,255,167,4,239,4,210,2,34,0,37,0,
+0,0,3,0,55,3,241,1,49,255,255,0,90,254,118,3,201,4,210,2,34,0,38,0,0,0,3,
+0,55,3,253,0,0,255,255,0,90,255,73,4,200,5,44,2,34,0,39,0,0,0,3,0,55,4,26,
+0,211,255,255,0,49,255,236,4,78,4,210,2,34,0,40,0,0,0,3,2,216,3,155,1,118,
+255,255,0,13,255,183,4,122,4,210,2,34,0,41,0,0,0,3,0,55,3,176,1,65,255,255,
+0,77,253,220,4,16,4,210,2,34,0,42,0,0,0,3,0,55,3,62,255,137,255,255,0,90,
+255,167,5,207,4,210,2,34,0,43,0,0,0,3,0,55,4,179,1,49,255,255,0,93,255,177,
+6,103,4,210,2,34,0,44,0,0,0,3,0,55,5,156,1,59,255,255,0,88,255,152,4,177,
+4,210,2,34,0,45,0,0,0,3,0,55,4,16,1,34,255,255,0,29,255,183,4,176,4,210,2,
+34,0,46,0,0,0,3,0,55,3,207,1,65,255,255,0,60,255,10,3,125,4,210,2,34,0,47,
+0,0,0,3,0,55,3,166,0,148,255,255,0,90,255,73,5,37,4,210,2,34,0,48,0,0,0,3,
+0,55,4,46,0,211,255,255,0,90,255,152,5,239,4,210,2,34,0,49,0,0,0,3,0,55,4,
+123,1,34,255,255,0,90,255,183,4,142,4,210,2,34,0,50,0,0,0,3,0,55,3,217,1,
+65,255,255,0,63,255,10,5,90,4,210,2,34,0,51,0,0,0,3,0,55,3,156,0,148,255,
+255,0,13,255,183,4,142,4,210,2,34,0,52,0,0,0,3,0,55,3,175,1,65,255,255,0,
+63,255,10,5,160,4,210,2,34,0,53,0,0,0,3,0,55,3,156,0,148,255,255,0,95,254,
+118,5,7,4,210,2,34,0,54,0,0,0,3,0,55,4,151,0,0,0,2,0,95,255,167,5,172,4,210,
+0,69,0,81,0,0,1,6,6,35,34,39,6,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,
+20,7,22,22,51,51,7,35,34,39,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,
+21,20,6,7,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,1,54,54,53,52,
+38,35,34,6,21,20,22,4,87,65,171,89,182,145,114,82,124,118,51,36,8,63,54,55,
+65,41,28,88,73,17,17,28,194,101,69,79,182,221,108,124,84,93,173,147,140,175,
+82,93,58,97,206,140,164,17,36,66,58,16,21,114,138,52,253,121,78,79,79,72,
+76,81,80,2,110,29,33,63,64,99,65,78,90,14,21,26,51,60,69,50,56,48,63,55,147,
+187,19,174,135,95,147,69,48,142,81,118,146,131,111,75,130,65,14,83,1,187,
+22,252,123,64,55,31,12,149,69,123,112,1,218,43,96,53,56,66,67,61,54,98,0,
+1,0,73,255,167,5,116,4,210,0,76,0,0,1,6,35,34,39,38,38,35,34,6,21,20,22,23,
+22,22,21,20,6,7,30,2,51,51,7,35,34,38,39,38,53,52,54,51,50,22,23,22,51,50,
+54,53,52,38,38,39,38,38,53,52,54,51,50,22,22,23,30,2,51,50,55,53,23,17,20,
+30,2,51,7,35,34,38,38,53,4,31,37,61,160,149,81,100,53,66,72,109,130,167,156,
+201,186,33,67,69,74,27,18,32,128,197,88,185,59,49,54,91,44,27,34,117,124,
+46,84,90,177,167,166,142,50,88,82,66,65,65,82,46,53,42,164,17,36,66,58,16,
+21,114,138,52,3,71,7,96,51,45,65,56,64,72,24,31,144,121,142,155,8,32,33,12,
+154,113,127,28,115,42,58,53,52,4,76,69,50,62,36,18,33,154,125,117,147,18,
+36,42,42,33,21,12,242,22,252,123,64,55,31,12,149,69,123,112,0,2,254,58,4,
+210,0,80,7,44,0,15,0,16,0,0,1,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,
+7,254,133,75,171,145,119,99,45,80,77,80,89,71,138,5,15,131,119,138,153,51,
+135,44,89,77,89,127,78,0,0,3,252,70,253,220,255,190,0,0,0,6,0,7,0,8,0,0,5,
+1,39,1,51,1,7,1,3,254,97,254,70,97,2,18,59,1,43,121,254,189,8,183,254,222,
+135,1,58,254,143,79,1,216,253,220,0,2,0,37,255,236,4,80,4,210,0,42,0,43,0,
+0,1,38,38,35,34,6,21,20,22,23,33,21,35,34,39,22,22,21,20,6,35,32,39,55,22,
+51,50,53,52,38,38,39,5,39,37,38,38,53,52,54,51,50,23,1,3,8,68,77,46,99,108,
+76,76,2,62,225,99,58,108,98,206,191,254,235,217,92,185,207,239,41,107,100,
+254,134,57,1,29,76,76,196,162,128,110,253,16,4,34,17,9,79,73,52,96,45,145,
+9,70,147,95,138,173,169,128,147,164,45,79,97,62,145,145,102,59,134,75,128,
+159,27,253,141,0,2,0,13,1,73,4,175,4,210,0,40,0,41,0,0,19,55,51,50,30,2,21,
+21,20,22,22,51,50,54,54,53,17,23,21,22,51,50,55,23,6,6,35,34,39,6,6,35,34,
+38,38,53,53,52,38,38,37,13,16,21,89,114,68,33,43,80,60,64,79,35,164,39,78,
+82,63,58,54,87,62,80,53,32,171,125,124,149,72,32,67,4,55,4,39,149,39,66,101,
+98,189,107,93,42,53,92,97,1,11,22,217,63,54,138,37,27,35,116,126,95,155,140,
+182,79,60,23,171,0,0,1,0,22,1,108,3,10,4,210,0,24,0,0,1,34,38,39,55,22,22,
+51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,1,174,123,201,84,130,
+65,124,81,92,99,115,114,114,108,52,59,153,72,183,201,178,1,108,128,128,89,
+101,94,139,134,149,150,56,138,30,36,231,219,208,212,0,1,0,90,0,219,3,208,
+4,210,0,39,0,0,1,6,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,
+21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,3,208,99,198,117,180,
+212,62,142,184,157,101,90,28,84,61,95,99,98,77,101,49,75,24,42,62,91,101,
+120,106,96,156,84,1,114,81,70,174,142,114,77,104,148,112,144,22,145,19,64,
+60,93,58,30,12,146,10,79,74,82,91,64,75,255,255,0,19,253,221,3,229,4,210,
+2,34,0,25,0,0,0,3,0,70,2,144,0,0,0,1,0,64,1,12,4,22,4,210,0,39,0,0,1,6,6,
+35,34,38,39,35,34,38,53,52,51,50,23,54,54,53,52,38,35,34,6,7,39,54,54,51,
+50,22,21,20,6,7,22,22,51,50,54,55,4,22,104,168,107,133,199,67,28,84,85,113,
+93,71,96,113,114,120,47,114,43,55,54,142,69,187,205,155,132,42,113,72,87,
+143,72,1,149,80,57,108,109,61,55,106,71,30,132,82,99,107,26,19,139,24,30,
+188,169,120,194,46,51,50,55,67,255,255,0,90,253,221,5,156,4,210,2,34,0,27,
+0,0,0,3,0,70,3,106,0,0,0,3,0,67,255,236,6,209,4,210,0,36,0,50,0,61,0,0,1,
+54,51,51,21,35,34,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,39,22,21,20,
+6,6,35,34,38,53,52,54,51,50,4,37,34,39,35,34,6,21,20,22,51,50,54,53,52,1,
+6,6,21,20,51,50,54,53,52,38,5,35,118,131,181,168,103,69,58,59,190,165,175,
+186,178,174,92,218,125,51,87,163,110,159,188,246,212,236,1,139,253,159,10,
+10,20,132,143,98,84,93,104,2,129,136,142,190,94,96,51,3,83,25,148,11,91,185,
+94,173,194,198,163,151,233,74,105,134,29,93,116,88,153,84,186,152,158,205,
+192,48,1,121,103,86,98,101,81,130,254,198,47,175,117,214,112,108,89,166,0,
+1,0,22,255,236,5,33,4,210,0,41,0,0,1,22,21,20,6,35,34,38,39,55,22,22,51,50,
+54,53,52,38,35,34,6,7,39,54,54,51,50,22,23,54,55,17,23,17,22,22,23,7,38,38,
+35,34,3,31,16,196,179,137,202,79,129,80,122,83,103,108,131,130,64,100,63,
+52,64,158,71,121,175,54,86,97,164,64,108,44,139,46,90,69,97,2,140,85,91,244,
+252,131,125,88,119,75,177,174,183,194,24,31,139,30,35,105,104,40,5,1,135,
+22,254,131,15,81,67,83,57,56,0,1,0,22,1,108,4,59,4,210,0,33,0,0,1,6,6,35,
+34,39,6,6,35,34,3,55,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,23,
+22,51,50,55,4,59,50,95,83,51,36,20,170,151,236,169,130,65,124,81,92,99,115,
+113,114,109,52,59,153,72,168,198,12,32,48,100,77,2,220,27,26,7,161,161,1,
+0,89,101,94,139,134,149,150,56,138,30,36,202,194,10,48,0,255,255,0,90,253,
+221,3,243,4,210,2,34,0,31,0,0,0,3,0,70,2,158,0,0,255,255,0,90,253,221,4,40,
+4,210,2,34,0,32,0,0,0,3,0,70,2,211,0,0,255,255,0,19,253,221,3,229,4,210,2,
+34,0,33,0,0,0,3,0,70,2,144,0,0,255,255,0,90,253,221,4,54,4,210,2,34,0,34,
+0,0,0,3,0,70,2,225,0,0,0,4,0,153,253,220,4,112,4,210,0,23,0,50,0,51,0,52,
+0,0,1,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,38,39,
+1,23,17,20,30,2,23,30,2,21,20,7,39,54,54,53,52,38,38,39,46,3,53,1,1,2,56,
+64,116,64,82,78,99,95,111,85,51,117,141,161,186,162,158,99,195,77,254,220,
+164,10,43,122,159,139,132,45,97,133,27,30,44,117,110,152,140,60,18,2,114,
+254,123,2,215,81,69,123,128,131,130,47,134,58,215,191,197,201,107,98,2,87,
+22,253,193,108,74,59,71,67,59,101,96,64,112,117,93,31,61,34,42,64,68,46,62,
+85,85,91,95,251,166,2,213,0,0,3,0,89,0,24,3,47,4,210,0,17,0,18,0,19,0,0,1,
+35,34,6,6,21,20,22,23,7,38,38,53,52,54,54,51,33,1,19,3,47,239,126,121,72,
+139,147,111,189,154,88,185,188,1,9,254,170,239,2,226,31,84,65,92,202,130,
+110,168,253,126,86,144,85,253,54,4,38,0,3,0,86,1,43,3,186,4,210,0,34,0,35,
+0,36,0,0,1,6,6,35,32,3,54,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,51,
+50,22,21,20,6,7,22,51,50,54,55,1,3,3,186,92,185,114,254,167,132,207,207,69,
+57,58,68,44,48,95,155,154,129,136,151,175,182,81,171,96,161,77,253,119,31,
+1,176,71,62,1,98,56,160,107,56,64,51,43,42,55,24,111,86,150,99,129,149,114,
+129,195,75,125,56,66,1,93,254,99,255,255,0,90,253,221,4,47,4,210,2,34,0,38,
+0,0,0,3,0,70,2,218,0,0,0,2,0,90,0,219,3,176,5,44,0,35,0,36,0,0,1,6,6,35,34,
+38,53,52,55,38,53,52,54,55,23,6,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,
+22,51,50,54,55,3,3,176,85,185,115,178,211,63,143,166,165,60,109,117,97,77,
+102,49,75,24,42,62,91,101,119,105,87,144,77,158,1,104,75,66,174,142,116,76,
+108,150,115,173,51,148,30,100,76,99,60,30,12,146,10,79,74,82,91,56,71,2,228,
+0,2,0,49,1,182,2,249,4,210,0,12,0,13,0,0,1,33,21,20,6,35,34,38,38,53,52,51,
+33,3,2,249,254,143,56,49,48,114,76,124,2,76,71,2,160,117,57,60,88,130,56,
+108,1,158,0,2,0,13,1,73,3,66,4,210,0,25,0,26,0,0,1,6,6,35,34,38,38,53,53,
+52,38,38,35,55,51,50,30,2,21,21,20,22,51,50,55,1,3,66,73,138,82,103,155,93,
+32,67,78,16,21,89,114,68,33,93,111,111,106,254,72,1,165,50,42,81,158,149,
+184,79,60,23,149,39,66,101,98,176,145,110,82,2,163,0,0,3,0,77,253,220,4,80,
+4,210,0,62,0,63,0,64,0,0,37,50,54,53,52,38,38,39,5,39,37,38,38,53,52,54,51,
+50,23,7,38,38,35,34,6,21,20,22,23,33,21,35,34,39,22,22,21,20,6,35,35,34,39,
+30,2,51,51,7,35,34,38,39,38,38,53,52,54,51,50,22,23,22,19,1,2,14,113,121,
+41,107,100,254,134,57,1,29,76,76,196,162,128,110,30,68,77,46,99,108,76,76,
+2,62,234,88,40,98,88,206,191,24,12,13,49,85,93,74,48,18,32,142,228,118,104,
+100,61,47,55,94,45,57,253,253,250,125,87,82,45,79,97,62,145,145,102,59,134,
+75,128,159,27,149,17,9,79,73,52,96,45,145,5,73,147,88,138,173,1,59,64,27,
+154,143,174,13,83,59,45,55,58,54,12,253,95,4,104,0,0,1,0,90,1,53,4,151,4,
+210,0,31,0,0,1,6,6,35,34,39,6,6,35,34,38,53,52,18,55,23,4,17,20,22,51,50,
+54,54,53,53,23,21,22,51,50,55,4,151,54,87,62,93,57,41,178,126,174,213,221,
+220,47,254,192,121,101,77,98,36,164,39,78,82,63,2,18,37,27,47,101,103,228,
+188,183,1,1,69,149,96,254,245,129,136,69,119,110,161,22,217,63,54,0,2,0,93,
+0,100,5,18,4,210,0,37,0,38,0,0,1,33,21,20,6,35,34,38,38,53,52,54,51,51,53,
+52,38,38,35,34,6,21,20,18,23,7,38,2,53,52,54,51,50,22,22,21,21,33,1,5,18,
+254,134,54,45,48,118,79,64,61,55,45,103,85,126,139,149,186,114,208,178,237,
+192,131,180,87,1,122,253,13,2,88,78,60,68,87,127,50,43,47,13,118,133,74,168,
+135,147,254,248,161,111,183,1,65,182,200,248,111,194,156,25,254,12,0,0,2,
+0,88,1,38,3,92,4,210,0,27,0,28,0,0,1,33,21,20,6,35,34,38,38,53,52,54,51,51,
+53,52,38,38,35,55,51,50,30,2,21,17,33,1,3,92,254,84,54,45,48,118,79,64,61,
+55,32,67,78,16,21,89,114,68,33,1,172,254,60,1,244,78,60,68,87,127,50,43,47,
+254,79,60,23,149,39,66,101,98,254,251,2,74,0,2,0,29,1,73,3,137,4,210,0,27,
+0,28,0,0,1,6,6,35,34,38,39,36,53,52,38,35,34,7,39,54,51,50,22,21,20,7,22,
+22,51,50,54,55,5,3,137,92,159,98,165,237,65,1,12,101,86,55,49,37,78,74,160,
+181,223,36,134,81,76,133,70,253,49,1,194,69,52,178,176,75,166,75,89,11,140,
+17,166,142,205,108,64,72,48,57,47,0,255,255,0,60,253,221,4,59,4,210,2,34,
+0,47,0,0,0,3,0,70,2,230,0,0,0,2,0,90,0,216,3,225,4,210,0,17,0,21,0,0,1,6,
+35,34,0,53,52,0,55,23,6,6,21,20,22,51,50,55,19,5,39,37,3,74,115,155,221,254,
+251,1,16,250,41,201,194,166,141,122,92,214,254,19,38,1,245,1,15,55,1,5,222,
+198,1,26,55,152,42,196,163,149,166,42,1,58,100,151,100,0,0,1,0,90,1,33,4,
+127,4,210,0,36,0,0,1,38,35,34,6,21,21,20,14,2,35,34,38,53,52,18,55,23,6,6,
+21,20,22,51,50,62,2,53,53,52,54,54,51,50,23,4,86,42,44,75,67,35,91,150,110,
+182,224,222,219,47,156,164,125,111,62,83,54,25,64,135,103,65,66,3,175,17,
+101,105,11,111,157,119,67,235,200,179,1,5,70,149,51,181,136,136,145,35,64,
+97,98,32,123,134,86,22,0,2,0,90,1,73,3,125,4,210,0,24,0,25,0,0,1,6,6,35,34,
+38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,3,3,125,107,178,
+108,180,230,246,203,43,115,39,27,89,75,138,152,130,112,81,137,95,18,1,221,
+86,62,210,167,183,216,13,10,145,18,129,117,109,123,47,81,2,117,0,0,3,0,63,
+0,0,3,74,4,210,0,43,0,44,0,45,0,0,1,38,38,53,52,54,51,50,22,22,21,20,6,7,
+22,22,51,51,7,35,34,38,39,6,35,34,53,52,54,51,50,23,54,54,53,52,38,35,34,
+6,21,20,22,23,3,3,1,219,173,167,163,140,104,175,96,189,163,110,137,107,27,
+18,32,132,231,125,30,30,181,69,55,92,77,146,146,119,95,67,73,126,109,71,78,
+2,168,41,150,121,103,139,92,176,120,149,234,54,156,99,154,176,201,2,124,47,
+57,61,35,157,121,113,121,59,43,71,77,22,254,252,1,15,0,5,0,13,1,73,3,151,
+4,210,0,19,0,30,0,31,0,32,0,33,0,0,1,6,6,35,34,38,38,53,53,52,38,38,35,55,
+51,50,23,1,22,23,37,20,22,51,50,55,37,38,39,22,21,19,1,3,3,151,103,168,107,
+103,155,93,32,66,79,16,21,152,74,1,165,111,111,253,203,93,111,134,126,254,
+252,130,83,9,7,2,24,2,1,225,84,68,81,158,149,212,62,52,20,149,62,254,201,
+82,105,80,145,110,109,193,97,72,51,93,1,174,252,228,1,40,0,2,0,63,0,0,4,99,
+4,210,0,48,0,49,0,0,1,6,35,34,39,6,6,7,30,2,51,51,7,35,34,38,39,6,35,34,38,
+53,52,54,51,50,23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,7,22,51,50,
+55,1,4,99,94,138,91,71,44,134,91,81,120,117,77,41,18,32,154,254,132,31,31,
+89,92,69,55,90,73,131,133,126,114,72,121,66,52,161,157,188,214,5,47,60,114,
+76,253,229,2,163,60,26,74,106,32,114,115,46,154,177,219,3,58,66,47,57,56,
+35,145,103,113,123,30,33,141,72,203,185,34,30,18,63,254,226,0,0,2,0,105,253,
+220,4,35,4,210,0,36,0,37,0,0,1,38,35,34,6,21,20,23,54,51,50,22,23,7,38,38,
+35,34,6,21,20,22,23,7,38,2,53,52,54,55,38,53,52,54,51,50,23,1,2,251,83,86,
+106,113,88,101,117,105,176,97,58,91,144,93,185,215,159,167,85,198,211,109,
+103,107,199,177,115,92,254,235,4,38,22,84,77,98,68,32,30,38,147,39,28,196,
+161,140,209,74,134,91,1,39,178,125,206,67,103,143,132,167,25,249,35,0,0,2,
+0,95,255,167,4,32,4,210,0,10,0,65,0,0,1,54,53,52,38,35,34,6,21,20,22,5,6,
+35,34,39,6,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,22,51,51,7,
+35,34,39,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,51,50,
+55,1,208,157,79,72,76,81,80,2,151,131,139,182,145,114,82,124,118,51,36,8,
+63,54,55,65,41,28,88,73,17,17,28,194,101,69,79,182,221,108,124,84,93,173,
+147,140,175,82,93,58,97,146,100,3,10,87,105,56,66,67,61,54,98,210,42,63,64,
+99,65,78,90,14,21,26,51,60,69,50,56,48,63,55,147,187,19,174,135,95,147,69,
+48,142,81,118,146,131,111,75,130,65,14,37,0,0,2,0,73,255,167,4,31,4,210,0,
+62,0,63,0,0,1,6,35,34,39,38,38,35,34,6,21,20,22,23,22,22,21,20,6,7,30,2,51,
+51,7,35,34,38,39,38,53,52,54,51,50,22,23,22,51,50,54,53,52,38,38,39,38,38,
+53,52,54,51,50,22,22,23,30,2,51,50,55,39,4,31,37,61,160,149,81,100,53,66,
+72,109,130,167,156,201,186,33,67,69,74,27,18,32,128,197,88,185,59,49,54,91,
+44,27,34,117,124,46,84,90,177,167,166,142,50,88,82,66,65,65,82,46,53,42,169,
+3,71,7,96,51,45,65,56,64,72,24,31,144,121,142,155,8,32,33,12,154,113,127,
+28,115,42,58,53,52,4,76,69,50,62,36,18,33,154,125,117,147,18,36,42,42,33,
+21,12,242,255,255,0,37,254,118,4,80,4,210,2,34,0,130,0,0,0,3,0,55,4,26,0,
+0,255,255,0,13,255,207,4,175,4,210,2,34,0,131,0,0,0,3,2,216,4,111,1,89,255,
+255,0,22,255,236,3,10,4,210,2,34,0,132,0,0,0,3,2,216,4,14,1,118,255,255,0,
+90,255,73,3,208,4,210,2,34,0,133,0,0,0,3,0,55,4,26,0,211,255,255,0,19,253,
+221,4,119,4,210,2,34,0,25,0,0,0,35,0,55,3,3,0,0,0,3,0,70,3,34,0,0,255,255,
+0,64,255,145,4,22,4,210,2,34,0,135,0,0,0,3,0,55,4,37,1,27,255,255,0,90,253,
+221,5,156,4,210,2,34,0,27,0,0,0,35,0,55,3,173,0,0,0,3,0,70,3,234,0,0,255,
+255,0,67,254,118,6,209,4,210,2,34,0,137,0,0,0,3,0,55,6,135,0,0,255,255,0,
+22,254,118,5,33,4,210,2,34,0,138,0,0,0,3,0,55,4,218,0,0,255,255,0,22,255,
+236,4,59,4,210,2,34,0,139,0,0,0,3,2,216,4,14,1,118,255,255,0,90,253,221,4,
+99,4,210,2,34,0,31,0,0,0,35,0,55,2,239,0,0,0,3,0,70,3,14,0,0,255,255,0,90,
+253,221,4,119,4,210,2,34,0,32,0,0,0,35,0,55,3,3,0,0,0,3,0,70,3,34,0,0,255,
+255,0,19,253,221,4,119,4,210,2,34,0,33,0,0,0,35,0,55,3,3,0,0,0,3,0,70,3,34,
+0,0,255,255,0,90,253,221,4,119,4,210,2,34,0,34,0,0,0,35,0,55,3,3,0,0,0,3,
+0,70,3,34,0,0,255,255,0,153,253,220,4,112,4,210,2,34,0,144,0,0,0,3,0,55,3,
+219,0,0,255,255,0,89,254,146,3,47,4,210,2,34,0,145,0,0,0,3,0,55,3,236,0,28,
+255,255,0,86,255,167,3,186,4,210,2,34,0,146,0,0,0,3,0,55,3,241,1,49,255,255,
+0,90,253,221,4,125,4,210,2,34,0,38,0,0,0,35,0,55,3,9,0,0,0,3,0,70,3,40,0,
+0,255,255,0,90,255,73,3,176,5,44,2,34,0,148,0,0,0,3,0,55,4,26,0,211,255,255,
+0,49,255,236,2,249,4,210,2,34,0,149,0,0,0,3,2,216,3,155,1,118,255,255,0,13,
+255,183,3,66,4,210,2,34,0,150,0,0,0,3,0,55,3,176,1,65,255,255,0,77,253,220,
+4,80,4,210,2,34,0,151,0,0,0,3,0,55,3,62,255,137,255,255,0,90,255,167,4,151,
+4,210,2,34,0,152,0,0,0,3,0,55,4,179,1,49,255,255,0,93,255,177,5,18,4,210,
+2,34,0,153,0,0,0,3,0,55,5,156,1,59,255,255,0,88,255,152,3,92,4,210,2,34,0,
+154,0,0,0,3,0,55,4,16,1,34,255,255,0,29,255,183,3,137,4,210,2,34,0,155,0,
+0,0,3,0,55,3,207,1,65,255,255,0,60,253,221,4,129,4,210,2,34,0,47,0,0,0,35,
+0,55,3,13,0,0,0,3,0,70,3,44,0,0,255,255,0,90,255,73,3,225,4,210,2,34,0,157,
+0,0,0,3,0,55,4,46,0,211,255,255,0,90,255,152,4,127,4,210,2,34,0,158,0,0,0,
+3,0,55,4,123,1,34,255,255,0,90,255,183,3,125,4,210,2,34,0,159,0,0,0,3,0,55,
+3,217,1,65,255,255,0,63,255,10,3,74,4,210,2,34,0,160,0,0,0,3,0,55,3,156,0,
+148,255,255,0,13,255,183,3,151,4,210,2,34,0,161,0,0,0,3,0,55,3,175,1,65,255,
+255,0,63,255,10,4,99,4,210,2,34,0,162,0,0,0,3,0,55,3,156,0,148,255,255,0,
+105,253,220,4,35,4,210,2,34,0,163,0,0,0,3,0,55,3,12,255,147,0,6,0,37,255,
+236,4,5,4,210,0,43,0,44,0,45,0,46,0,47,0,48,0,0,1,5,39,37,38,38,53,52,54,
+51,50,23,7,38,38,35,34,6,21,20,22,23,37,23,5,22,22,21,20,6,35,32,39,55,22,
+51,50,53,52,38,39,3,39,19,19,3,3,1,5,1,239,254,128,46,1,30,58,58,196,162,
+128,110,30,68,77,46,99,108,58,58,1,200,54,254,162,146,128,211,197,254,227,
+223,92,193,215,248,92,85,225,133,246,173,91,114,1,246,252,245,2,97,123,149,
+79,52,117,64,128,159,27,149,17,9,79,73,45,85,40,138,145,93,91,174,106,140,
+171,169,128,147,164,65,114,60,254,209,87,1,35,2,114,251,46,4,210,254,30,118,
+0,1,0,13,255,236,5,231,4,210,0,55,0,0,1,6,35,34,39,6,6,35,34,38,38,53,53,
+52,38,38,35,55,51,50,30,2,21,21,20,22,22,51,50,54,54,53,17,23,21,22,51,50,
+55,17,23,17,20,30,2,51,7,35,34,38,53,1,39,1,4,146,72,102,80,53,32,171,125,
+124,149,72,32,67,78,16,21,89,114,68,33,43,80,60,64,79,35,164,39,78,98,76,
+164,17,36,66,58,16,21,152,152,254,59,102,2,43,2,73,49,35,116,126,95,155,140,
+182,79,60,23,149,39,66,101,98,189,107,93,42,53,92,97,1,11,22,217,63,82,1,
+212,22,252,123,64,55,31,12,149,127,154,254,211,142,1,73,0,2,0,22,255,236,
+5,42,4,210,0,24,0,40,0,0,1,34,38,39,55,22,22,51,50,54,53,52,38,35,34,7,39,
+54,54,51,50,22,21,20,6,37,17,23,17,20,30,2,51,7,35,34,38,53,1,39,1,174,123,
+201,84,130,65,124,81,92,99,115,114,114,108,52,59,153,72,183,201,178,1,125,
+164,17,36,66,58,16,21,152,152,254,59,102,1,108,128,128,89,101,94,139,134,
+149,150,56,138,30,36,231,219,208,212,87,3,15,22,252,123,64,55,31,12,149,127,
+154,254,211,142,0,0,2,0,90,255,160,4,230,4,210,0,53,0,54,0,0,5,39,37,38,38,
+53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,
+6,21,20,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,38,38,53,53,5,1,61,102,
+1,53,169,185,62,142,184,157,101,90,28,84,61,95,99,98,77,101,49,75,24,42,62,
+91,101,120,106,101,172,79,164,17,36,66,58,16,21,114,138,52,254,176,96,143,
+186,5,163,134,114,77,104,148,112,144,22,145,19,64,60,93,58,30,12,146,10,79,
+74,82,91,76,79,2,200,22,252,123,64,55,31,12,149,69,123,112,36,121,0,255,255,
+0,19,253,220,3,178,4,210,2,34,0,25,0,0,0,3,0,129,3,244,0,0,0,2,0,64,255,212,
+5,56,4,210,0,52,0,53,0,0,1,1,39,37,38,38,39,35,34,38,53,52,51,50,23,54,54,
+53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,22,51,50,54,55,17,23,17,20,
+30,2,51,7,35,34,38,38,53,5,3,227,253,136,106,1,88,110,167,56,28,84,85,113,
+93,71,96,113,114,120,47,114,43,55,54,142,69,187,205,155,132,84,143,92,153,
+89,164,17,36,66,58,16,21,114,138,52,254,203,1,125,254,87,143,185,7,100,94,
+61,55,106,71,30,132,82,99,107,26,19,139,24,30,188,169,120,194,46,101,63,91,
+2,152,22,252,123,64,55,31,12,149,69,123,112,36,255,255,0,90,253,220,5,156,
+4,210,2,34,0,27,0,0,0,3,0,129,4,197,0,0,255,255,0,67,253,220,7,9,4,212,2,
+34,0,28,0,0,0,3,0,129,6,58,0,0,0,3,0,22,255,236,5,64,4,210,0,52,0,53,0,54,
+0,0,1,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,39,5,39,37,38,38,35,
+34,6,7,39,54,54,51,50,22,23,54,55,17,23,17,22,22,21,20,6,7,39,54,54,53,52,
+38,35,34,19,1,3,30,17,196,179,137,202,79,129,80,122,83,103,108,5,254,182,
+102,1,140,31,110,79,64,100,63,52,64,158,71,121,175,54,84,99,164,119,128,117,
+127,114,104,89,119,104,80,136,253,20,2,142,80,98,244,252,131,125,88,119,75,
+177,174,50,42,226,142,230,69,70,24,31,139,30,35,105,104,40,5,1,135,22,254,
+124,36,196,146,135,220,104,126,78,154,107,115,131,253,70,1,239,0,1,0,22,255,
+236,5,120,4,210,0,48,0,0,1,6,35,34,39,6,6,35,34,3,55,22,22,51,50,54,53,52,
+38,35,34,7,39,54,54,51,50,22,23,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,
+53,1,39,1,4,35,82,122,51,36,20,170,151,236,169,130,65,124,81,92,99,115,113,
+114,109,52,59,153,72,168,198,12,32,48,126,81,164,17,36,66,58,16,21,152,152,
+254,59,102,2,43,2,213,46,7,161,161,1,0,89,101,94,139,134,149,150,56,138,30,
+36,202,194,10,71,1,79,22,252,123,64,55,31,12,149,127,154,254,211,142,1,73,
+255,255,0,17,253,220,3,156,4,210,2,34,0,31,0,0,0,3,0,129,3,203,0,0,255,255,
+0,85,253,220,3,226,4,210,2,34,0,32,0,0,0,3,0,129,4,15,0,0,255,255,0,19,253,
+220,3,169,4,210,2,34,0,33,0,0,0,3,0,129,3,235,0,0,255,255,0,84,253,220,3,
+248,4,210,2,34,0,34,0,0,0,3,0,129,4,14,0,0,0,5,0,153,253,220,6,130,4,210,
+0,26,0,50,0,68,0,69,0,70,0,0,19,23,17,20,30,2,23,30,2,21,20,7,39,54,54,53,
+52,38,38,39,46,3,53,37,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,
+20,6,35,34,38,39,1,23,17,20,30,2,51,7,35,34,38,38,53,53,5,39,37,1,1,153,164,
+10,43,122,159,139,132,45,97,133,27,30,44,117,110,152,140,60,18,1,159,64,116,
+64,82,78,99,95,111,85,51,117,141,161,186,162,158,99,195,77,3,112,164,17,36,
+66,58,16,21,114,138,52,254,199,102,1,159,254,39,254,50,4,210,22,253,193,108,
+74,59,71,67,59,101,96,64,112,117,93,31,61,34,42,64,68,46,62,85,85,91,95,161,
+81,69,123,128,131,130,47,134,58,215,191,197,201,107,98,2,87,22,252,123,64,
+55,31,12,149,69,123,112,47,212,142,243,251,208,2,213,0,1,0,23,0,0,4,151,4,
+210,0,31,0,0,1,1,39,1,38,38,35,34,6,7,39,54,54,51,50,22,23,55,17,23,17,20,
+30,2,51,7,35,34,38,38,53,3,66,253,232,102,1,240,70,161,124,68,115,73,58,70,
+162,74,154,200,135,16,164,17,36,66,58,16,21,114,138,52,2,118,254,158,143,
+1,38,102,123,32,40,143,37,46,129,175,9,1,181,22,252,123,64,55,31,12,149,69,
+123,112,0,4,0,86,255,236,4,239,4,210,0,50,0,51,0,52,0,53,0,0,1,1,39,37,38,
+38,39,54,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,21,20,6,7,
+22,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,38,38,53,1,3,5,3,154,253,126,
+106,1,95,161,216,62,207,207,69,57,58,68,44,48,95,155,154,129,136,151,175,
+182,40,126,86,106,176,85,164,17,36,66,58,16,21,114,138,52,253,185,124,1,130,
+1,156,254,80,143,189,5,167,169,56,160,107,56,64,51,43,42,55,24,111,86,150,
+99,129,149,114,129,195,75,63,62,69,83,2,123,22,252,123,64,55,31,12,149,69,
+123,112,2,102,254,99,206,0,0,6,0,90,255,32,4,54,4,211,0,46,0,47,0,48,0,49,
+0,50,0,51,0,0,1,38,53,52,54,51,50,22,21,20,7,19,7,3,1,39,55,54,55,38,38,53,
+52,54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,19,1,1,3,
+1,2,170,5,71,57,60,69,55,199,126,196,254,17,102,155,94,80,187,211,69,123,
+118,118,106,36,49,136,83,47,109,147,120,99,50,138,124,87,53,1,16,254,55,255,
+1,44,1,8,21,28,52,63,70,56,68,46,254,214,75,1,53,254,164,143,89,54,41,1,191,
+146,90,132,101,63,63,67,55,38,51,55,79,95,107,63,93,88,77,63,70,84,56,94,
+105,3,226,251,46,4,210,251,138,2,75,0,2,0,90,255,160,4,200,5,44,0,49,0,50,
+0,0,1,1,39,37,38,38,53,52,55,38,53,52,54,55,23,6,6,21,20,23,54,51,50,23,7,
+38,35,34,6,21,20,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,38,38,53,5,3,
+115,253,191,102,1,53,157,186,63,143,166,165,60,109,117,97,77,102,49,75,24,
+42,62,91,101,119,105,93,152,79,164,17,36,66,58,16,21,114,138,52,254,218,1,
+70,254,90,143,186,5,167,130,116,76,108,150,115,173,51,148,30,100,76,99,60,
+30,12,146,10,79,74,82,91,59,74,2,222,22,252,123,64,55,31,12,149,69,123,112,
+85,0,0,1,0,49,255,236,4,78,4,210,0,28,0,0,1,33,21,20,6,35,34,38,38,53,52,
+51,33,17,23,17,20,30,2,51,7,35,34,38,53,1,39,1,2,249,254,143,56,49,48,114,
+76,124,2,76,164,17,36,66,58,16,21,152,152,254,59,102,2,43,2,160,117,57,60,
+88,130,56,108,1,158,22,252,123,64,55,31,12,149,127,154,254,211,142,1,73,0,
+2,0,13,255,236,4,122,4,210,0,40,0,41,0,0,1,1,39,37,46,2,53,53,52,38,38,35,
+55,51,50,30,2,21,21,20,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,38,38,53,
+39,3,37,253,169,102,1,112,107,126,49,32,67,78,16,21,89,114,68,33,93,111,62,
+129,56,164,17,36,66,58,16,21,114,138,52,238,1,157,254,79,143,221,8,114,142,
+109,184,79,60,23,149,39,66,101,98,176,145,110,56,52,2,137,22,252,123,64,55,
+31,12,149,69,123,112,25,0,6,0,65,253,220,4,5,4,210,0,62,0,63,0,64,0,65,0,
+66,0,67,0,0,37,50,54,53,52,38,39,3,39,19,39,5,39,37,38,38,53,52,54,51,50,
+23,7,38,38,35,34,6,21,20,22,23,37,23,5,22,22,21,20,6,35,34,39,30,2,51,51,
+7,35,34,38,39,38,38,53,52,54,51,50,22,23,22,19,35,1,5,1,2,39,113,121,92,85,
+206,133,226,1,254,129,46,1,31,59,58,196,162,128,110,30,68,77,46,99,108,58,
+58,1,200,54,254,162,146,128,206,191,34,41,51,86,91,74,48,18,32,142,228,118,
+104,100,61,47,55,93,45,65,214,205,1,215,252,241,2,32,125,87,82,65,114,60,
+254,235,87,1,9,1,123,149,79,53,117,63,128,159,27,149,17,9,79,73,45,85,40,
+138,145,93,91,174,106,138,173,2,60,64,27,154,143,174,13,83,59,45,55,57,53,
+14,4,85,254,30,118,251,98,0,1,0,90,255,236,5,207,4,210,0,46,0,0,1,6,35,34,
+39,6,6,35,34,38,53,52,18,55,23,4,17,20,22,51,50,54,54,53,53,23,21,22,51,50,
+55,17,23,17,20,30,2,51,7,35,34,38,53,1,39,1,4,122,72,102,93,57,41,178,126,
+174,213,221,220,47,254,192,121,101,77,98,36,164,39,78,98,76,164,17,36,66,
+58,16,21,152,152,254,59,102,2,43,2,3,49,47,101,103,228,188,183,1,1,69,149,
+96,254,245,128,137,69,119,110,161,22,217,63,82,2,26,22,252,123,64,55,31,12,
+149,127,154,254,211,142,1,67,0,0,2,0,93,255,236,6,103,4,210,0,53,0,54,0,0,
+1,33,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,34,6,21,20,18,23,7,
+38,2,53,52,54,51,50,22,22,21,21,33,17,23,17,20,30,2,51,7,35,34,38,53,1,39,
+1,5,5,18,254,134,54,45,48,118,79,64,61,55,45,103,85,126,139,149,186,114,208,
+178,237,192,131,180,87,1,122,164,17,36,66,58,16,21,152,152,254,59,102,2,43,
+253,3,2,88,78,60,68,87,127,50,43,47,13,118,133,74,168,135,147,254,248,161,
+111,183,1,65,182,200,248,111,194,156,25,1,230,22,252,123,64,55,31,12,149,
+127,154,254,211,142,1,73,203,0,1,0,88,255,236,4,177,4,210,0,43,0,0,1,33,21,
+20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,55,51,50,30,2,21,21,33,17,
+23,17,20,30,2,51,7,35,34,38,53,1,39,1,3,92,254,84,54,45,48,118,79,64,61,55,
+32,67,78,16,21,89,114,68,33,1,172,164,17,36,66,58,16,21,152,152,254,59,102,
+2,43,2,13,78,60,68,87,127,50,43,47,229,79,60,23,149,39,66,101,98,236,2,49,
+22,252,123,64,55,31,12,149,127,154,254,211,142,1,73,0,3,0,29,255,236,4,176,
+4,210,0,40,0,41,0,42,0,0,1,1,39,37,38,38,39,36,53,52,38,35,34,7,39,54,51,
+50,22,21,20,7,22,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,37,5,3,
+91,253,143,102,1,112,147,205,59,1,12,101,86,55,49,37,78,74,160,181,223,36,
+134,81,178,131,164,17,36,66,58,16,21,114,138,52,253,130,1,78,1,174,254,62,
+143,221,7,170,162,75,166,75,89,11,140,17,166,142,205,108,64,72,134,2,111,
+22,252,123,64,55,31,12,149,69,123,112,231,206,0,255,255,0,12,253,220,3,132,
+4,210,2,34,0,47,0,0,0,3,0,129,3,198,0,0,0,1,0,90,255,236,5,37,4,210,0,38,
+0,0,1,1,39,55,6,35,34,36,53,52,0,55,23,6,6,21,20,22,51,50,55,23,55,17,5,39,
+37,17,23,17,20,30,2,51,7,35,34,38,3,208,254,59,102,242,37,54,224,254,254,
+1,14,252,41,203,192,167,140,73,66,38,234,254,36,38,2,2,164,17,36,66,58,16,
+21,152,152,1,25,254,211,142,143,7,249,213,191,1,15,52,152,40,185,154,141,
+156,16,110,139,1,13,98,151,103,1,102,22,252,123,64,55,31,12,149,127,0,0,2,
+0,90,255,236,5,239,4,210,0,55,0,56,0,0,1,52,38,38,35,34,6,6,21,21,20,14,2,
+35,34,38,53,52,18,55,23,6,6,21,20,22,51,50,62,2,53,53,52,54,54,51,50,22,22,
+21,17,20,30,2,51,7,35,34,38,53,1,39,1,3,4,154,20,73,54,56,72,21,31,89,153,
+113,182,224,222,219,47,156,164,125,111,62,83,54,25,67,142,104,100,138,73,
+17,36,66,58,16,21,152,152,254,59,102,2,43,135,3,45,88,104,62,62,98,93,47,
+120,163,124,71,235,200,179,1,5,70,149,51,181,136,136,145,35,64,97,98,107,
+146,142,87,82,139,126,253,214,64,55,31,12,149,127,154,254,211,142,1,73,3,
+15,0,0,2,0,90,255,236,4,142,4,210,0,38,0,39,0,0,1,1,39,37,38,38,53,52,54,
+51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,
+38,38,53,37,3,57,253,183,110,1,78,172,202,246,203,43,115,39,27,89,75,138,
+152,130,112,91,152,85,164,17,36,66,58,16,21,114,138,52,254,210,1,180,254,
+56,134,225,8,200,159,183,216,13,10,145,18,129,117,109,123,62,86,2,97,22,252,
+123,64,55,31,12,149,69,123,112,25,0,4,0,26,0,0,5,166,4,210,0,42,0,54,0,55,
+0,56,0,0,1,1,39,37,54,55,38,38,39,6,5,39,54,55,38,38,53,52,54,51,50,22,21,
+20,6,7,22,22,23,17,23,17,20,30,2,51,7,35,34,38,38,53,1,54,54,53,52,38,35,
+34,6,21,20,22,23,5,4,81,253,241,102,1,97,43,61,114,202,87,133,254,238,97,
+170,167,100,105,173,139,154,172,71,73,87,227,139,164,17,36,66,58,16,21,114,
+138,52,253,159,71,67,81,75,69,87,85,56,2,186,1,173,254,161,142,208,25,29,
+24,57,34,93,170,145,92,99,53,154,93,109,155,148,124,75,124,59,27,57,30,2,
+132,22,252,123,64,55,31,12,149,69,123,112,1,201,51,92,55,60,72,73,61,62,94,
+188,171,0,4,0,13,255,236,4,142,4,210,0,33,0,44,0,45,0,46,0,0,23,39,37,46,
+2,53,53,52,38,38,35,55,51,50,23,1,22,23,17,23,17,20,30,2,51,7,35,34,38,38,
+53,53,1,20,22,51,50,55,37,38,39,22,21,1,5,204,102,1,112,82,128,70,32,66,79,
+16,21,152,74,1,165,54,74,164,17,36,66,58,16,21,114,138,52,254,41,93,111,134,
+126,254,252,130,83,9,2,10,254,190,20,143,221,10,86,144,133,212,62,52,20,149,
+62,254,201,40,62,1,241,22,252,123,64,55,31,12,149,69,123,112,126,1,46,145,
+110,109,193,97,72,51,93,254,146,109,0,3,0,63,0,0,5,200,4,210,0,66,0,67,0,
+68,0,0,1,6,35,34,39,6,6,7,30,2,51,51,7,35,34,38,39,6,35,34,38,53,52,54,51,
+50,23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,7,22,51,50,55,17,23,17,
+20,30,2,51,7,35,34,38,38,53,53,5,39,37,5,1,4,115,94,136,89,77,41,142,100,
+81,120,117,77,41,18,32,154,254,132,31,31,89,92,69,55,90,73,131,133,126,114,
+72,121,66,52,161,157,188,214,2,53,69,144,92,164,17,36,66,58,16,21,114,138,
+52,254,179,98,1,175,253,178,1,61,2,189,56,23,83,120,36,114,115,46,154,177,
+219,3,58,66,47,57,56,35,145,103,113,123,30,33,141,72,203,185,15,17,20,89,
+1,95,22,252,123,64,55,31,12,149,69,123,112,177,221,138,249,106,254,221,0,
+5,0,105,253,220,4,167,4,210,0,45,0,46,0,47,0,48,0,49,0,0,1,38,35,34,6,21,
+20,23,54,51,50,0,21,20,6,7,39,54,53,52,39,1,39,1,38,35,34,6,21,20,22,23,7,
+38,2,53,52,54,55,38,53,52,54,51,50,23,39,35,19,1,2,251,83,86,106,113,88,101,
+117,237,1,17,32,28,161,56,18,254,59,102,1,224,91,171,184,214,159,167,85,198,
+211,109,103,107,199,177,115,92,97,205,5,2,99,4,38,22,84,77,98,68,32,255,0,
+222,85,180,66,45,149,129,71,57,254,208,142,1,28,88,196,161,140,209,74,134,
+91,1,39,178,125,206,67,103,143,132,167,25,25,249,10,3,185,0,0,3,0,95,255,
+167,5,252,4,210,0,10,0,84,0,85,0,0,1,54,53,52,38,35,34,6,21,20,22,5,6,35,
+34,39,6,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,22,51,51,7,35,
+34,39,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,
+55,17,23,17,20,30,2,51,7,35,34,38,38,53,53,5,39,37,3,1,208,157,79,72,76,81,
+80,3,30,151,240,198,143,114,82,112,102,56,21,10,63,54,55,65,38,27,85,74,17,
+17,28,191,101,57,75,171,211,108,124,84,93,173,147,140,175,82,93,33,107,28,
+246,167,164,17,36,66,58,16,21,114,138,52,254,253,102,1,105,169,3,10,87,105,
+56,66,67,61,54,98,182,70,63,64,99,65,77,91,8,27,26,51,60,69,50,63,47,57,55,
+147,182,14,173,136,95,147,69,48,142,81,118,146,131,111,75,130,65,7,7,90,1,
+180,22,252,123,64,55,31,12,149,69,123,112,41,182,142,210,254,154,0,0,1,0,
+73,255,167,5,146,4,210,0,77,0,0,1,6,35,34,39,38,38,35,34,6,21,20,22,23,22,
+22,21,20,6,7,30,2,51,51,7,35,34,38,39,38,53,52,54,51,50,22,23,22,51,50,54,
+53,52,38,38,39,38,38,53,52,54,51,50,22,22,23,30,2,51,50,55,53,23,17,20,30,
+2,51,7,35,34,39,5,39,37,4,61,49,79,160,149,81,100,53,66,72,109,130,167,156,
+200,188,30,61,71,66,13,18,13,121,195,85,186,59,49,54,91,44,27,34,117,124,
+46,84,90,177,167,166,142,50,88,82,66,65,65,82,46,72,53,164,17,36,66,58,16,
+21,251,41,254,242,102,1,104,3,77,13,96,51,45,65,56,64,72,24,31,144,121,142,
+156,8,28,34,14,154,117,123,27,116,42,58,53,52,4,76,69,50,62,36,18,33,154,
+125,117,147,18,36,42,42,33,21,22,232,22,252,123,64,55,31,12,149,170,190,142,
+209,255,255,0,37,254,118,4,5,4,210,2,34,0,200,0,0,0,3,0,55,4,32,0,0,255,255,
+0,13,254,118,5,231,4,210,2,34,0,201,0,0,0,3,0,55,4,181,0,0,255,255,0,22,254,
+118,5,42,4,210,2,34,0,202,0,0,0,3,0,55,4,58,0,0,255,255,0,90,254,118,4,230,
+4,210,2,34,0,203,0,0,0,3,0,55,4,33,0,0,255,255,0,19,253,151,3,198,4,210,2,
+34,0,25,0,0,0,35,0,129,4,8,255,187,0,3,0,55,2,201,0,141,255,255,0,64,254,
+118,5,56,4,210,2,34,0,205,0,0,0,3,0,55,4,58,0,0,255,255,0,90,253,151,5,156,
+4,210,2,34,0,27,0,0,0,35,0,129,4,227,255,187,0,3,0,55,3,28,0,125,255,255,
+0,67,253,220,7,9,4,212,2,34,0,28,0,0,0,35,0,129,6,58,0,0,0,3,0,55,4,92,0,
+240,255,255,0,22,254,118,5,64,4,210,2,34,0,208,0,0,0,3,0,55,4,204,0,0,255,
+255,0,22,254,118,5,120,4,210,2,34,0,209,0,0,0,3,0,55,4,68,0,0,255,255,0,37,
+253,151,3,157,4,210,2,34,0,31,0,0,0,35,0,129,3,223,255,187,0,3,0,55,2,181,
+0,148,255,255,0,90,253,151,3,226,4,210,2,34,0,32,0,0,0,35,0,129,4,36,255,
+187,0,3,0,55,2,229,0,141,255,255,0,19,253,151,3,198,4,210,2,34,0,33,0,0,0,
+35,0,129,4,8,255,187,0,3,0,55,2,201,0,141,255,255,0,90,253,151,3,248,4,210,
+2,34,0,34,0,0,0,35,0,129,4,30,255,187,0,3,0,55,2,223,0,141,255,255,0,153,
+253,220,6,130,4,210,2,34,0,214,0,0,0,3,0,55,3,219,0,0,255,255,0,23,255,143,
+4,151,4,210,2,34,0,215,0,0,0,3,0,55,3,232,1,25,255,255,0,86,254,118,4,239,
+4,210,2,34,0,216,0,0,0,3,0,55,4,18,0,0,255,255,0,90,254,35,4,54,4,211,2,34,
+0,217,0,0,0,3,0,55,4,64,255,173,255,255,0,90,254,118,4,200,5,44,2,34,0,218,
+0,0,0,3,0,55,4,16,0,0,255,255,0,49,254,118,4,78,4,210,2,34,0,219,0,0,0,3,
+0,55,3,213,0,0,255,255,0,13,254,118,4,122,4,210,2,34,0,220,0,0,0,3,0,55,3,
+243,0,0,255,255,0,65,253,220,4,5,4,210,2,34,0,221,0,0,0,3,0,55,3,62,255,137,
+255,255,0,90,254,118,5,207,4,210,2,34,0,222,0,0,0,3,0,55,4,128,0,0,255,255,
+0,93,254,118,6,103,4,210,2,34,0,223,0,0,0,3,0,55,4,228,0,0,255,255,0,88,254,
+118,4,177,4,210,2,34,0,224,0,0,0,3,0,55,4,16,0,0,255,255,0,29,254,118,4,176,
+4,210,2,34,0,225,0,0,0,3,0,55,3,254,0,0,255,255,0,12,253,151,3,132,4,210,
+2,34,0,47,0,0,0,35,0,129,3,198,255,187,0,3,0,55,2,239,1,15,255,255,0,90,254,
+118,5,37,4,210,2,34,0,227,0,0,0,3,0,55,4,32,0,0,255,255,0,90,254,118,5,239,
+4,210,2,34,0,228,0,0,0,3,0,55,4,158,0,0,255,255,0,90,254,118,4,142,4,210,
+2,34,0,229,0,0,0,3,0,55,3,204,0,0,255,255,0,26,254,118,5,166,4,210,2,34,0,
+230,0,0,0,3,0,55,4,39,0,0,255,255,0,13,254,118,4,142,4,210,2,34,0,231,0,0,
+0,3,0,55,3,254,0,0,255,255,0,63,254,118,5,200,4,210,2,34,0,232,0,0,0,3,0,
+55,4,161,0,0,255,255,0,105,253,220,4,167,4,210,2,34,0,233,0,0,0,3,0,55,3,
+12,255,147,0,2,0,37,255,236,4,105,4,210,0,45,0,46,0,0,1,5,39,37,38,38,53,
+52,54,51,50,23,7,38,38,35,34,6,21,20,22,23,33,21,35,34,39,22,22,21,20,6,35,
+32,39,55,22,51,50,53,52,38,39,3,39,19,37,1,239,254,128,46,1,30,58,58,196,
+162,128,110,30,68,77,46,99,108,58,58,2,98,241,98,62,115,110,211,197,254,227,
+223,92,193,215,248,92,85,225,133,246,254,154,2,97,123,149,79,52,117,64,128,
+159,27,149,17,9,79,73,45,85,40,145,10,76,162,98,140,171,169,128,147,164,65,
+114,60,254,209,87,1,35,26,0,3,0,13,255,236,4,175,4,210,0,40,0,44,0,45,0,0,
+1,6,6,35,34,39,6,6,35,34,38,38,53,53,52,38,38,35,55,51,50,30,2,21,21,20,22,
+22,51,50,54,54,53,17,23,21,22,51,50,55,19,1,39,1,17,4,175,54,87,62,80,53,
+32,171,125,124,149,72,32,67,78,16,21,89,114,68,33,43,80,60,64,79,35,164,39,
+78,82,63,29,254,59,102,2,43,2,88,37,27,35,116,126,95,155,140,182,79,60,23,
+149,39,66,101,98,189,107,93,42,53,92,97,1,11,22,217,63,54,254,56,254,210,
+142,1,73,3,15,0,0,2,0,22,255,236,3,213,4,210,0,24,0,28,0,0,1,34,38,39,55,
+22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,5,1,39,1,1,174,
+123,201,84,130,65,124,81,92,99,115,114,114,108,52,59,153,72,183,201,178,1,
+125,254,59,102,2,43,1,108,128,128,89,101,94,139,134,149,150,56,138,30,36,
+231,219,208,212,82,254,210,142,1,73,0,0,2,0,90,255,160,3,208,4,210,0,39,0,
+40,0,0,5,39,37,38,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,
+54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,23,5,1,61,102,1,53,169,185,
+62,142,184,157,101,90,28,84,61,95,99,98,77,101,49,75,24,42,62,91,101,120,
+106,96,156,84,79,254,112,96,143,186,5,163,134,114,77,104,148,112,144,22,145,
+19,64,60,93,58,30,12,146,10,79,74,82,91,64,75,133,154,255,255,0,19,252,218,
+4,52,4,210,2,34,0,25,0,0,0,3,2,97,3,244,0,0,0,2,0,64,255,212,4,20,4,210,0,
+38,0,39,0,0,1,1,39,37,38,38,39,35,34,38,53,52,51,50,23,54,54,53,52,38,35,
+34,6,7,39,54,54,51,50,22,21,20,6,7,22,51,50,54,55,1,4,20,253,87,106,1,88,
+110,167,56,28,84,85,113,93,71,96,113,114,120,47,114,43,55,54,142,69,187,205,
+155,132,84,143,88,141,73,254,217,1,152,254,60,143,185,7,100,94,61,55,106,
+71,30,132,82,99,107,26,19,139,24,30,188,169,120,194,46,101,55,67,254,242,
+0,255,255,0,90,252,218,5,156,4,210,2,34,0,27,0,0,0,3,2,97,4,197,0,0,255,255,
+0,67,253,220,6,209,4,210,2,34,0,137,0,0,0,3,0,129,6,58,0,0,0,2,0,22,255,236,
+5,33,4,210,0,46,0,47,0,0,1,38,38,35,34,7,22,21,20,6,35,34,38,39,55,22,22,
+51,50,54,53,52,39,5,39,37,38,38,35,34,6,7,39,54,54,51,50,22,23,54,55,17,23,
+17,22,22,23,5,4,150,46,90,69,97,73,16,196,179,137,202,79,129,80,122,83,103,
+108,5,254,182,102,1,140,31,110,79,64,100,63,52,64,158,71,121,175,54,86,97,
+164,64,108,44,252,1,2,73,57,56,46,85,91,244,252,131,125,88,119,75,177,174,
+50,42,226,142,230,69,70,24,31,139,30,35,105,104,40,6,1,134,22,254,132,15,
+82,67,173,0,0,2,0,22,255,236,4,59,4,210,0,33,0,37,0,0,1,6,6,35,34,39,6,6,
+35,34,3,55,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,23,22,51,50,
+55,19,1,39,1,4,59,50,95,83,51,36,20,170,151,236,169,130,65,124,81,92,99,115,
+113,114,109,52,59,153,72,168,198,12,32,48,100,77,30,254,59,102,2,43,2,220,
+27,26,7,161,161,1,0,89,101,94,139,134,149,150,56,138,30,36,202,194,10,48,
+253,174,254,210,142,1,73,255,255,0,17,252,218,4,11,4,210,2,34,0,31,0,0,0,
+3,2,97,3,203,0,0,255,255,0,85,252,218,4,79,4,210,2,34,0,32,0,0,0,3,2,97,4,
+15,0,0,255,255,0,19,252,218,4,43,4,210,2,34,0,33,0,0,0,3,2,97,3,235,0,0,255,
+255,0,84,252,218,4,78,4,210,2,34,0,34,0,0,0,3,2,97,4,14,0,0,0,5,0,153,253,
+220,5,45,4,210,0,23,0,50,0,54,0,55,0,56,0,0,1,22,22,51,50,54,53,52,38,35,
+34,7,39,54,51,50,22,21,20,6,35,34,38,39,1,23,17,20,30,2,23,30,2,21,20,7,39,
+54,54,53,52,38,38,39,46,3,53,5,5,39,37,1,1,2,56,64,116,64,82,78,99,95,111,
+85,51,117,141,161,186,162,158,99,195,77,254,220,164,10,43,122,159,139,132,
+45,97,133,27,30,44,117,110,152,140,60,18,4,148,254,199,102,1,159,252,205,
+1,67,2,215,81,69,123,128,131,130,47,134,58,215,191,197,201,107,98,2,87,22,
+253,193,108,74,59,71,67,59,101,96,64,112,117,93,31,61,34,42,64,68,46,62,85,
+85,91,95,220,207,142,243,254,165,253,43,0,2,0,23,1,20,3,50,4,210,0,16,0,17,
+0,0,1,1,39,1,38,38,35,34,6,7,39,54,54,51,50,22,23,1,3,50,253,248,102,1,240,
+70,161,124,68,115,73,58,70,162,74,154,200,135,254,115,2,102,254,174,143,1,
+38,102,123,32,40,143,37,46,129,175,1,190,0,4,0,86,255,236,3,185,4,210,0,35,
+0,36,0,37,0,38,0,0,1,1,39,37,38,38,39,54,54,53,52,38,35,34,6,21,20,22,23,
+7,38,53,52,54,51,50,22,21,20,6,7,22,51,50,54,55,1,3,5,3,185,253,95,106,1,
+95,161,216,62,207,207,69,57,58,68,44,48,95,155,154,129,136,151,175,182,81,
+171,96,161,77,253,227,107,1,99,1,178,254,58,143,189,5,167,169,56,160,107,
+56,64,51,43,42,55,24,111,86,150,99,129,149,114,129,195,75,125,56,66,1,93,
+254,99,206,255,255,0,90,252,218,5,64,4,211,2,34,0,217,0,0,0,3,2,102,3,235,
+0,0,0,3,0,90,255,160,3,175,5,44,0,35,0,36,0,37,0,0,1,1,39,37,38,38,53,52,
+55,38,53,52,54,55,23,6,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,
+54,55,1,3,3,175,253,131,102,1,53,157,186,63,143,166,165,60,109,117,97,77,
+102,49,75,24,42,62,91,101,119,105,87,144,77,254,234,20,1,105,254,55,143,186,
+5,167,130,116,76,108,150,115,173,51,148,30,100,76,99,60,30,12,146,10,79,74,
+82,91,56,71,254,237,3,247,0,3,0,49,255,236,2,249,4,210,0,12,0,16,0,17,0,0,
+1,33,21,20,6,35,34,38,38,53,52,51,33,17,1,39,1,3,2,249,254,143,56,49,48,114,
+76,124,2,76,254,59,102,2,43,73,2,160,117,57,60,88,130,56,108,253,224,254,
+216,142,1,73,3,15,0,3,0,13,255,236,3,64,4,210,0,25,0,26,0,27,0,0,1,1,39,37,
+46,2,53,53,52,38,38,35,55,51,50,30,2,21,21,20,22,51,50,55,7,1,3,64,253,142,
+102,1,112,107,126,49,32,67,78,16,21,89,114,68,33,93,111,111,106,211,254,225,
+1,167,254,69,143,221,8,114,142,109,184,79,60,23,149,39,66,101,98,176,145,
+110,82,230,3,137,0,3,0,65,253,220,4,105,4,210,0,64,0,65,0,66,0,0,37,50,54,
+53,52,38,39,3,39,19,39,5,39,37,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,
+20,22,23,33,21,35,34,39,22,22,21,20,6,35,34,39,30,2,51,51,7,35,34,38,39,38,
+38,53,52,54,51,50,22,23,22,19,1,2,39,113,121,92,85,206,133,226,1,254,129,
+46,1,31,59,58,196,162,128,110,30,68,77,46,99,108,58,58,2,98,241,98,62,115,
+110,206,191,34,41,51,86,91,74,48,18,32,142,228,118,104,100,61,47,55,93,45,
+65,235,253,236,125,87,82,65,114,60,254,235,87,1,9,1,123,149,79,53,117,63,
+128,159,27,149,17,9,79,73,45,85,40,145,10,76,162,98,138,173,2,60,64,27,154,
+143,174,13,83,59,45,55,57,53,14,253,95,4,158,0,2,0,90,255,236,4,151,4,210,
+0,31,0,35,0,0,1,6,6,35,34,39,6,6,35,34,38,53,52,18,55,23,4,17,20,22,51,50,
+54,54,53,53,23,21,22,51,50,55,19,1,39,1,4,151,54,87,62,93,57,41,178,126,174,
+213,221,220,47,254,192,121,101,77,98,36,164,39,78,82,63,29,254,59,102,2,43,
+2,18,37,27,47,101,103,228,188,183,1,1,69,149,96,254,245,129,136,69,119,110,
+161,22,217,63,54,254,120,254,216,142,1,73,0,0,3,0,93,255,236,5,18,4,210,0,
+37,0,41,0,42,0,0,1,33,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,34,
+6,21,20,18,23,7,38,2,53,52,54,51,50,22,22,21,21,33,17,1,39,1,5,5,18,254,134,
+54,45,48,118,79,64,61,55,45,103,85,126,139,149,186,114,208,178,237,192,131,
+180,87,1,122,254,59,102,2,43,252,233,2,88,78,60,68,87,127,50,43,47,13,118,
+133,74,168,135,147,254,248,161,111,183,1,65,182,200,248,111,194,156,25,254,
+40,254,216,142,1,73,203,0,3,0,88,255,236,3,93,4,210,0,27,0,31,0,32,0,0,1,
+33,21,20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,55,51,50,30,2,21,21,
+33,3,1,39,1,1,3,93,254,83,54,45,48,118,79,64,61,55,32,67,78,16,21,89,114,
+68,33,1,173,1,254,59,102,2,43,254,76,2,13,78,60,68,87,127,50,43,47,229,79,
+60,23,149,39,66,101,98,236,254,114,254,217,142,1,73,3,15,0,3,0,29,255,236,
+3,134,4,210,0,27,0,28,0,29,0,0,1,1,39,37,38,38,39,36,53,52,38,35,34,7,39,
+54,51,50,22,21,20,7,22,22,51,50,54,55,5,37,3,134,253,100,102,1,112,147,205,
+59,1,12,101,86,55,49,37,78,74,160,181,223,36,134,81,76,133,70,254,242,254,
+177,1,197,254,39,143,221,7,170,162,75,166,75,89,11,140,17,166,142,205,108,
+64,72,48,57,253,206,255,255,0,12,252,218,4,6,4,210,2,34,0,47,0,0,0,3,2,97,
+3,198,0,0,0,2,0,90,255,236,3,225,4,210,0,22,0,26,0,0,1,1,39,55,6,35,34,36,
+53,52,0,55,23,6,6,21,20,22,51,50,55,23,55,19,5,39,37,3,208,254,59,102,242,
+37,54,224,254,254,1,14,252,41,203,192,167,140,73,66,38,234,17,254,19,38,1,
+245,1,25,254,211,142,143,7,249,213,191,1,15,52,152,40,185,154,141,156,16,
+110,139,1,15,100,151,100,0,0,2,0,90,255,236,4,154,4,210,0,36,0,40,0,0,1,38,
+35,34,6,21,21,20,14,2,35,34,38,53,52,18,55,23,6,6,21,20,22,51,50,62,2,53,
+53,52,54,54,51,50,23,19,1,39,1,4,86,42,44,75,67,35,91,150,110,182,224,222,
+219,47,156,164,125,111,62,83,54,25,64,135,103,65,66,27,254,59,102,2,43,3,
+175,17,101,105,11,111,157,119,67,235,200,179,1,5,70,149,51,181,136,136,145,
+35,64,97,98,32,123,134,86,22,252,223,254,210,142,1,73,0,0,3,0,90,255,236,
+3,124,4,210,0,24,0,25,0,26,0,0,1,1,39,37,38,38,53,52,54,51,50,22,23,7,38,
+35,34,6,21,20,22,51,50,54,55,3,19,3,124,253,116,110,1,78,172,202,246,203,
+43,115,39,27,89,75,138,152,130,112,81,137,95,254,124,1,223,254,13,134,225,
+8,200,159,183,216,13,10,145,18,129,117,109,123,47,81,254,236,3,137,0,4,0,
+26,0,78,4,81,4,210,0,28,0,40,0,41,0,42,0,0,1,1,39,37,54,55,38,38,39,6,5,39,
+54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,23,37,54,54,53,52,38,35,34,
+6,21,20,22,23,5,4,81,253,241,102,1,97,43,61,114,202,87,133,254,238,97,170,
+167,100,105,173,139,154,172,71,73,87,227,139,253,159,71,67,81,75,69,87,85,
+67,2,53,1,168,254,166,142,208,25,29,24,57,34,93,170,145,92,99,53,154,93,109,
+155,148,124,75,124,59,27,57,30,171,51,92,55,60,72,73,61,62,94,188,171,0,0,
+6,0,13,255,236,3,151,4,210,0,19,0,30,0,31,0,32,0,33,0,34,0,0,1,1,39,37,46,
+2,53,53,52,38,38,35,55,51,50,23,1,22,23,37,20,22,51,50,55,37,38,39,22,21,
+1,5,3,1,3,151,253,53,102,1,112,82,128,70,32,66,79,16,21,152,74,1,165,112,
+110,253,203,93,111,134,126,254,252,130,83,9,2,39,254,185,226,2,41,1,225,254,
+11,143,221,10,86,144,133,212,62,52,20,149,62,254,201,83,104,80,145,110,109,
+193,97,72,51,93,254,146,109,3,137,254,12,0,0,4,0,63,0,0,4,118,4,210,0,3,0,
+52,0,53,0,54,0,0,1,5,39,37,55,6,35,34,39,6,6,7,30,2,51,51,7,35,34,38,39,6,
+35,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,
+7,22,51,50,55,1,1,4,115,254,179,98,1,175,3,94,139,89,77,41,142,100,81,120,
+117,77,41,18,32,154,254,132,31,31,89,92,69,55,90,73,131,133,126,114,72,121,
+66,52,161,157,188,214,2,53,69,115,76,253,143,1,160,1,225,221,138,249,58,60,
+23,83,120,36,114,115,46,154,177,219,3,58,66,47,57,56,35,145,103,113,123,30,
+33,141,72,203,185,15,17,20,63,254,196,254,221,255,255,0,105,253,220,5,189,
+4,210,2,34,0,233,0,0,0,3,0,70,4,104,0,0,0,4,0,95,255,167,4,167,4,210,0,10,
+0,14,0,70,0,71,0,0,1,54,53,52,38,35,34,6,21,20,22,1,5,39,37,53,6,35,34,39,
+6,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,22,51,51,7,35,34,39,
+6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,55,3,
+1,208,157,79,72,76,81,80,3,30,254,253,102,1,105,151,240,198,143,114,82,112,
+102,56,21,10,63,54,55,65,38,27,85,74,17,17,28,191,101,57,75,171,211,108,124,
+84,93,173,147,140,175,82,93,33,107,28,246,167,182,3,10,87,105,56,66,67,61,
+54,98,254,39,176,142,210,115,70,63,64,99,65,77,91,8,27,26,51,60,69,50,63,
+47,57,55,147,182,14,173,136,95,147,69,48,142,81,118,146,131,111,75,130,65,
+7,7,90,253,127,0,3,0,73,255,167,4,100,4,210,0,62,0,66,0,67,0,0,1,6,35,34,
+39,38,38,35,34,6,21,20,22,23,22,22,21,20,6,7,30,2,51,51,7,35,34,38,39,38,
+53,52,54,51,50,22,23,22,51,50,54,53,52,38,38,39,38,38,53,52,54,51,50,22,22,
+23,30,2,51,50,55,1,39,37,21,1,4,61,49,79,160,149,81,100,53,66,72,109,130,
+167,156,200,188,30,61,71,66,13,18,13,121,195,85,186,59,49,54,91,44,27,34,
+117,124,46,84,90,177,167,166,142,50,88,82,66,65,65,82,46,72,53,254,254,102,
+1,143,254,89,3,77,13,96,51,45,65,56,64,72,24,31,144,121,142,156,8,28,34,14,
+154,117,123,27,116,42,58,53,52,4,76,69,50,62,36,18,33,154,125,117,147,18,
+36,42,42,33,21,22,252,2,142,234,166,4,20,255,255,0,37,254,118,4,105,4,210,
+2,34,1,14,0,0,0,3,0,55,4,32,0,0,255,255,0,13,254,118,4,175,4,210,2,34,1,15,
+0,0,0,3,0,55,4,181,0,0,255,255,0,22,254,118,3,213,4,210,2,34,1,16,0,0,0,3,
+0,55,4,58,0,0,255,255,0,90,254,118,3,208,4,210,2,34,1,17,0,0,0,3,0,55,4,33,
+0,0,255,255,0,19,252,218,4,149,4,210,2,34,0,25,0,0,0,35,2,97,4,85,0,0,0,3,
+0,55,2,201,0,141,255,255,0,64,254,118,4,20,4,210,2,34,1,19,0,0,0,3,0,55,4,
+58,0,0,255,255,0,90,252,218,5,156,4,210,2,34,0,27,0,0,0,35,2,97,5,21,0,0,
+0,3,0,55,3,28,0,125,255,255,0,67,253,220,6,209,4,210,2,34,0,137,0,0,0,35,
+0,129,6,58,0,0,0,3,0,55,4,92,0,240,255,255,0,22,254,118,5,33,4,210,2,34,1,
+22,0,0,0,3,0,55,4,204,0,0,255,255,0,22,254,118,4,59,4,210,2,34,1,23,0,0,0,
+3,0,55,4,68,0,0,255,255,0,53,252,218,4,123,4,210,2,34,0,31,0,0,0,35,2,97,
+4,59,0,0,0,3,0,55,2,181,0,148,255,255,0,90,252,218,4,195,4,210,2,34,0,32,
+0,0,0,35,2,97,4,131,0,0,0,3,0,55,2,229,0,141,255,255,0,19,252,218,4,149,4,
+210,2,34,0,33,0,0,0,35,2,97,4,85,0,0,0,3,0,55,2,201,0,141,255,255,0,90,252,
+218,4,161,4,210,2,34,0,34,0,0,0,35,2,97,4,97,0,0,0,3,0,55,2,223,0,141,255,
+255,0,153,253,220,5,45,4,210,2,34,1,28,0,0,0,3,0,55,3,219,0,0,255,255,0,23,
+255,143,3,50,4,210,2,34,1,29,0,0,0,3,0,55,3,232,1,25,255,255,0,86,254,118,
+3,185,4,210,2,34,1,30,0,0,0,3,0,55,4,18,0,0,255,255,0,90,253,221,5,114,4,
+211,2,34,0,217,0,0,0,35,0,70,4,29,0,0,0,3,0,55,4,34,255,173,255,255,0,90,
+254,118,3,175,5,44,2,34,1,32,0,0,0,3,0,55,4,16,0,0,255,255,0,49,254,118,2,
+249,4,210,2,34,1,33,0,0,0,3,0,55,3,213,0,0,255,255,0,13,254,118,3,64,4,210,
+2,34,1,34,0,0,0,3,0,55,3,243,0,0,255,255,0,65,253,220,4,105,4,210,2,34,1,
+35,0,0,0,3,0,55,3,62,255,137,255,255,0,90,254,118,4,151,4,210,2,34,1,36,0,
+0,0,3,0,55,4,128,0,0,255,255,0,93,254,118,5,18,4,210,2,34,1,37,0,0,0,3,0,
+55,4,228,0,0,255,255,0,88,254,118,3,93,4,210,2,34,1,38,0,0,0,3,0,55,4,16,
+0,0,255,255,0,29,254,118,3,134,4,210,2,34,1,39,0,0,0,3,0,55,3,254,0,0,255,
+255,0,38,252,218,4,32,4,210,2,34,0,47,0,0,0,35,2,97,3,224,0,0,0,3,0,55,2,
+239,1,15,255,255,0,90,254,118,3,225,4,210,2,34,1,41,0,0,0,3,0,55,4,32,0,0,
+255,255,0,90,254,118,4,154,4,210,2,34,1,42,0,0,0,3,0,55,4,158,0,0,255,255,
+0,90,254,118,3,124,4,210,2,34,1,43,0,0,0,3,0,55,3,204,0,0,255,255,0,26,254,
+118,4,81,4,210,2,34,1,44,0,0,0,3,0,55,4,43,0,0,255,255,0,13,254,118,3,151,
+4,210,2,34,1,45,0,0,0,3,0,55,3,254,0,0,255,255,0,63,254,118,4,118,4,210,2,
+34,1,46,0,0,0,3,0,55,4,161,0,0,255,255,0,105,253,220,5,189,4,210,2,34,0,233,
+0,0,0,35,0,70,4,104,0,0,0,3,0,55,3,12,255,147,0,7,0,37,255,236,7,2,4,210,
+0,64,0,78,0,79,0,80,0,81,0,82,0,83,0,0,19,37,38,38,53,52,54,51,50,23,7,38,
+38,35,34,6,21,20,22,23,37,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,20,22,
+23,37,23,5,22,22,21,20,6,35,34,39,6,6,35,32,39,55,22,51,50,54,53,52,38,39,
+5,5,22,51,50,54,53,52,38,39,5,22,22,21,20,1,3,3,1,37,88,1,65,102,97,196,162,
+128,110,30,68,77,46,99,108,121,125,1,181,35,34,196,162,128,110,30,68,77,46,
+99,108,35,35,2,16,36,254,116,161,151,206,191,245,199,52,169,117,254,235,217,
+92,185,207,119,120,85,90,254,51,3,34,177,200,119,120,154,198,254,109,77,64,
+1,242,72,133,252,1,5,211,2,75,53,68,146,93,128,159,27,149,17,9,79,73,62,113,
+71,81,39,90,51,128,159,27,149,17,9,79,73,39,67,28,99,151,67,94,182,112,138,
+173,132,66,66,169,128,147,82,82,60,109,59,85,173,134,82,82,77,148,115,75,
+64,126,78,13,3,188,251,46,4,210,253,119,164,0,2,0,37,255,236,8,46,4,210,0,
+83,0,84,0,0,1,35,34,39,22,22,21,20,6,35,32,39,55,22,51,50,53,52,38,38,39,
+5,39,37,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,20,22,23,33,54,53,52,38,
+35,34,7,39,54,51,50,22,21,20,6,7,22,22,51,50,55,17,23,17,20,30,2,51,7,35,
+34,38,38,53,53,6,6,35,34,38,37,3,254,143,99,58,108,98,206,191,254,235,217,
+92,185,207,239,41,107,100,254,134,57,1,29,76,76,196,162,128,110,30,68,77,
+46,99,108,76,76,2,83,126,101,86,55,49,37,78,74,160,181,112,111,36,134,81,
+178,131,164,17,36,66,58,16,21,114,138,52,77,143,83,145,214,252,114,2,82,9,
+70,147,95,138,173,169,128,147,164,45,79,97,62,145,145,102,59,134,75,128,159,
+27,149,17,9,79,73,52,96,45,70,115,75,89,11,140,17,166,142,103,156,54,64,72,
+134,2,111,22,252,123,64,55,31,12,149,69,123,112,121,55,41,132,119,0,3,0,22,
+255,221,5,92,4,210,0,24,0,54,0,55,0,0,1,34,38,39,55,22,22,51,50,54,53,52,
+38,35,34,7,39,54,54,51,50,22,21,20,6,5,5,23,22,21,20,6,35,34,38,38,53,52,
+54,55,1,17,23,17,20,30,2,51,7,35,34,38,38,53,37,1,174,123,201,84,130,65,124,
+81,91,100,117,112,114,108,52,59,153,72,180,204,185,1,182,254,199,47,21,71,
+56,63,131,71,52,56,2,17,164,17,36,66,58,16,21,114,138,52,254,206,1,168,128,
+128,89,101,94,123,121,134,134,56,138,30,36,218,201,192,199,35,180,73,33,36,
+43,59,61,87,41,34,52,30,1,25,2,171,22,252,123,64,55,31,12,149,69,123,112,
+43,0,7,0,9,253,220,3,227,4,210,0,79,0,91,0,92,0,93,0,94,0,95,0,96,0,0,5,38,
+35,34,6,21,20,22,51,50,54,55,17,38,38,39,55,22,22,51,50,54,53,52,38,39,46,
+2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,22,22,21,20,6,7,21,54,51,50,
+22,21,20,7,39,54,53,52,38,35,34,6,7,17,35,53,6,35,34,38,53,52,54,51,50,23,
+1,50,22,21,20,6,35,34,38,53,52,54,39,35,9,2,1,111,33,37,64,74,69,58,54,85,
+37,124,222,97,139,90,189,114,91,103,76,93,145,143,54,181,151,134,91,30,88,
+97,82,95,73,135,166,140,160,141,58,80,110,120,57,144,51,48,48,34,58,30,150,
+81,103,121,148,146,121,62,36,1,247,50,68,69,49,49,69,68,195,185,1,148,254,
+168,254,43,59,6,69,61,62,68,47,43,1,133,15,146,130,92,121,119,69,65,64,86,
+47,72,106,102,69,108,137,21,148,21,55,47,44,68,66,81,161,122,113,151,15,202,
+49,140,118,140,131,50,104,102,66,73,40,43,254,171,170,69,146,122,115,145,
+7,3,175,65,50,50,66,66,50,50,65,217,251,207,1,241,254,255,0,0,7,0,16,253,
+220,3,241,4,210,0,73,0,85,0,86,0,87,0,88,0,89,0,90,0,0,1,38,35,34,6,21,20,
+22,23,22,22,21,20,7,17,20,22,22,51,7,35,34,46,2,53,17,6,35,34,39,22,21,20,
+6,35,34,39,55,22,22,51,50,54,53,52,38,35,34,7,39,54,55,38,39,55,22,22,51,
+50,54,53,52,38,39,46,2,53,52,54,51,50,23,23,50,22,21,20,6,35,34,38,53,52,
+54,39,35,19,1,23,2,249,88,97,82,95,73,135,166,140,72,36,63,69,15,20,83,107,
+63,30,64,80,18,18,23,127,123,153,115,115,35,68,41,57,52,59,59,63,78,46,37,
+36,70,63,139,90,189,114,91,103,76,93,145,143,54,181,151,134,91,86,50,68,69,
+49,49,69,68,195,185,55,254,53,228,4,41,21,55,47,44,68,66,81,161,122,108,73,
+254,10,85,58,19,145,38,65,98,103,1,166,18,1,72,95,157,160,151,78,50,44,93,
+92,121,93,36,115,17,9,59,82,92,121,119,69,65,64,86,47,72,106,102,69,108,137,
+21,196,65,50,50,66,66,50,50,65,217,253,192,254,255,55,0,0,7,0,19,253,220,
+3,241,4,210,0,54,0,80,0,92,0,93,0,94,0,95,0,96,0,0,1,38,35,34,6,21,20,22,
+23,22,22,21,20,7,17,20,22,22,51,7,35,34,39,6,35,34,38,53,52,55,38,53,52,55,
+38,39,55,22,22,51,50,54,53,52,38,39,46,2,53,52,54,51,50,23,1,35,34,6,21,20,
+23,54,51,50,23,7,38,35,34,6,21,20,51,50,54,55,17,6,35,34,1,50,22,21,20,6,
+35,34,38,53,52,54,39,35,1,1,2,249,88,97,82,95,73,135,166,140,72,36,63,69,
+15,20,242,32,116,148,136,165,43,107,103,84,71,139,90,189,114,91,103,76,93,
+145,143,54,181,151,134,91,254,73,16,53,62,51,66,94,36,65,20,36,44,70,77,152,
+74,121,58,64,80,98,1,172,50,68,69,49,49,69,68,195,185,254,203,1,80,4,41,21,
+55,47,44,68,66,81,161,122,108,73,254,10,85,58,19,145,177,81,138,112,83,58,
+79,113,109,56,67,94,92,121,119,69,65,64,86,47,72,106,102,69,108,137,21,252,
+6,50,43,53,38,30,10,132,7,55,51,117,48,56,1,135,18,3,89,65,50,50,66,66,50,
+50,65,217,252,191,1,1,0,7,0,19,253,220,3,247,4,210,0,61,0,68,0,80,0,81,0,
+82,0,83,0,84,0,0,5,33,21,20,6,35,34,38,38,53,52,54,51,51,17,38,39,55,22,22,
+51,50,54,53,52,38,39,46,2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,22,22,
+21,20,7,17,20,22,22,51,7,35,34,46,2,53,1,21,33,53,6,35,34,1,50,22,21,20,6,
+35,34,38,53,52,54,39,35,19,1,2,185,254,189,53,46,44,105,71,64,61,44,106,99,
+139,90,189,114,91,103,76,93,145,143,54,181,151,134,91,30,88,97,82,95,73,135,
+166,140,66,36,63,69,15,20,83,107,63,30,254,189,1,67,62,88,91,1,165,50,68,
+69,49,49,69,68,195,185,29,254,183,203,66,63,65,77,114,49,43,45,1,69,69,132,
+92,121,119,69,65,64,86,47,72,106,102,69,108,137,21,148,21,55,47,44,68,66,
+81,161,122,104,70,254,3,85,58,19,145,38,65,98,103,1,173,254,248,19,3,89,65,
+50,50,66,66,50,50,65,217,253,192,254,255,0,6,0,19,255,236,8,52,4,210,0,36,
+0,48,0,90,0,91,0,92,0,93,0,0,1,38,35,34,6,21,20,22,22,23,22,22,21,20,6,35,
+34,38,39,55,22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,50,23,23,50,22,21,
+20,6,35,34,38,53,52,54,1,6,6,35,34,38,39,54,54,53,52,38,38,35,35,53,51,50,
+22,22,21,20,7,22,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,9,2,3,2,
+80,107,88,101,37,78,106,176,130,211,178,152,253,108,143,85,174,114,102,116,
+107,153,143,121,193,164,123,91,18,50,68,69,49,49,69,68,3,223,77,143,83,165,
+237,65,135,133,52,93,100,158,167,171,148,82,223,36,134,81,178,131,164,17,
+36,66,58,16,21,114,138,52,251,108,254,75,3,220,4,42,20,70,63,42,60,61,65,
+108,176,127,151,183,152,165,87,130,124,95,83,87,122,90,85,155,109,125,153,
+23,228,65,50,50,66,66,50,50,65,253,210,55,41,178,176,38,116,82,58,66,22,147,
+70,126,97,200,106,64,72,134,2,111,22,252,123,64,55,31,12,149,69,123,112,1,
+17,254,171,1,43,0,0,2,0,90,255,236,10,110,4,210,0,102,0,103,0,0,1,20,2,4,
+35,34,38,53,52,55,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,51,
+50,23,7,38,35,34,6,21,20,33,50,36,18,53,52,38,35,34,6,21,20,22,23,7,36,17,
+52,54,51,50,22,23,51,50,22,22,21,20,7,22,22,51,50,55,17,23,17,20,30,2,51,
+7,35,34,38,38,53,53,6,6,35,34,38,39,54,54,53,52,38,38,35,35,22,1,5,156,193,
+254,154,233,224,248,104,99,95,185,156,101,90,28,84,61,92,102,85,85,84,103,
+25,55,19,29,30,122,147,1,47,183,1,25,156,96,92,68,79,145,143,51,254,113,161,
+138,90,147,47,237,169,153,79,223,36,135,80,178,131,164,17,36,66,58,16,21,
+114,138,52,77,143,83,164,238,65,138,130,50,91,104,165,19,1,9,2,251,194,254,
+141,218,206,174,155,103,66,160,101,125,164,22,147,19,81,70,77,108,43,31,4,
+148,2,118,106,232,176,1,49,152,158,165,83,59,107,116,28,147,106,1,27,132,
+167,76,71,67,116,92,188,99,61,67,134,2,191,22,252,123,64,55,31,12,149,69,
+123,112,41,55,41,167,165,38,108,76,54,60,23,81,254,86,0,0,3,0,90,253,220,
+5,142,4,210,0,90,0,91,0,92,0,0,1,38,35,34,6,21,20,22,23,54,51,50,23,7,38,
+35,34,6,21,20,33,50,36,54,53,52,38,35,34,6,21,20,22,23,7,36,17,52,54,51,50,
+22,21,20,2,7,17,20,22,22,51,7,35,34,39,6,35,34,38,53,52,54,51,50,23,7,38,
+35,34,6,21,20,22,51,50,55,17,6,35,34,38,53,52,55,38,53,52,54,51,50,23,37,
+35,2,82,84,61,94,100,68,62,90,109,37,57,19,29,47,112,126,1,47,184,1,19,149,
+98,85,64,76,142,126,48,254,130,161,138,161,191,126,115,36,63,69,15,20,236,
+37,109,136,145,171,171,141,88,73,12,71,59,90,89,88,79,132,100,167,212,225,
+247,76,166,183,158,101,90,1,186,185,4,42,19,72,63,61,88,33,35,4,148,2,93,
+87,186,144,255,141,130,130,69,52,89,103,24,143,86,1,14,119,152,216,201,143,
+254,243,95,253,217,85,58,19,145,170,71,146,124,115,145,21,133,20,68,60,65,
+67,100,1,172,78,184,158,116,86,113,171,116,153,22,22,0,3,0,22,0,0,6,95,4,
+210,0,65,0,66,0,67,0,0,1,6,6,35,34,39,6,6,35,34,3,55,22,22,51,50,54,53,52,
+35,34,7,39,54,54,51,50,22,23,22,51,50,54,55,53,23,17,20,30,2,51,7,35,34,38,
+39,6,6,35,34,38,39,5,39,1,23,7,6,6,21,20,22,51,50,55,39,1,5,10,59,143,110,
+106,100,14,187,144,236,169,130,65,124,81,92,99,228,114,109,52,59,153,72,150,
+194,26,85,120,104,153,64,164,17,36,66,58,16,21,102,129,35,63,124,78,138,168,
+6,254,232,100,2,134,82,69,55,64,82,71,135,91,184,253,181,3,54,30,33,28,161,
+162,1,0,89,101,94,114,111,247,56,138,30,36,149,141,36,45,46,235,22,252,123,
+64,55,31,12,149,53,54,47,40,157,143,219,135,1,172,125,44,35,81,66,71,76,96,
+254,254,84,0,1,0,22,255,235,6,95,4,210,0,69,0,0,1,35,34,39,22,21,20,6,35,
+32,3,55,22,22,51,50,53,52,38,39,55,33,53,6,6,35,34,39,6,6,35,34,3,55,22,22,
+51,50,54,53,52,35,34,7,39,54,54,51,50,22,23,22,51,50,54,55,53,23,17,20,30,
+2,51,7,35,34,38,38,53,5,10,180,93,14,96,147,125,254,214,189,144,83,146,90,
+134,69,77,56,1,187,59,143,110,106,100,14,187,144,236,169,130,65,124,81,92,
+99,228,114,109,52,59,153,72,152,192,26,85,120,104,153,64,164,17,36,66,58,
+16,21,114,138,52,1,200,3,100,128,120,132,1,83,78,148,121,125,63,103,56,128,
+220,30,33,28,161,162,1,0,89,101,94,114,111,247,56,138,30,36,149,141,36,45,
+46,235,22,252,123,64,55,31,12,149,69,123,112,0,0,6,0,90,253,220,3,156,4,210,
+0,63,0,64,0,65,0,66,0,67,0,68,0,0,1,23,6,7,22,21,20,6,7,6,6,21,20,22,51,50,
+55,23,6,6,35,34,38,53,52,54,55,54,54,53,52,39,7,6,38,53,52,54,54,55,54,54,
+53,52,38,35,34,7,39,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,3,35,19,19,3,
+3,78,78,113,62,26,132,151,119,90,100,104,167,151,75,115,178,105,171,193,147,
+163,100,85,65,30,195,233,67,141,136,124,82,75,78,114,110,52,139,151,145,159,
+138,176,137,96,118,117,184,101,185,77,66,6,2,23,146,55,17,41,51,97,119,51,
+41,63,46,52,50,95,140,57,40,132,112,107,122,57,35,49,43,49,12,1,6,148,129,
+79,101,83,50,46,52,48,40,35,38,138,48,116,102,104,130,59,46,71,57,58,62,3,
+37,249,10,4,241,253,3,0,8,0,35,252,218,3,156,4,210,0,82,0,83,0,84,0,85,0,
+86,0,87,0,88,0,89,0,0,1,23,6,7,22,21,20,6,7,6,6,21,20,22,51,50,55,23,7,22,
+22,21,20,6,35,34,36,39,55,22,22,51,50,53,52,38,35,34,7,39,38,38,53,52,54,
+55,54,54,53,52,39,7,6,38,53,52,54,54,55,54,54,53,52,38,35,34,7,39,54,51,50,
+22,21,20,6,7,6,6,21,20,22,51,50,3,35,19,19,3,3,5,3,78,78,113,62,26,132,151,
+119,90,100,104,167,151,75,55,47,47,181,162,160,254,254,123,121,122,180,115,
+195,84,71,108,87,21,134,145,147,163,100,85,65,30,195,233,67,141,136,124,82,
+75,78,114,110,52,139,151,145,159,138,176,137,96,118,117,184,101,185,77,66,
+6,46,254,86,2,23,146,55,17,41,51,97,119,51,41,63,46,52,50,95,140,26,35,94,
+59,116,137,132,126,95,117,91,122,47,56,44,53,16,126,93,107,122,57,35,49,43,
+49,12,1,6,148,129,79,101,83,50,46,52,48,40,35,38,138,48,116,102,104,130,59,
+46,71,57,58,62,3,37,249,10,4,241,253,3,254,124,157,0,7,0,90,252,218,4,71,
+4,210,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,0,5,23,6,7,22,22,23,7,38,38,35,
+34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,53,52,54,55,54,54,
+53,52,39,7,6,38,53,52,54,54,55,54,54,53,52,38,35,34,7,39,54,51,50,22,21,20,
+6,7,6,6,21,20,22,51,50,55,23,6,7,22,21,20,6,7,6,6,21,20,22,51,50,3,35,19,
+19,3,1,3,37,75,56,27,71,149,78,125,125,230,136,102,108,90,75,93,92,52,110,
+116,153,174,49,49,49,49,147,163,100,85,65,30,195,233,67,141,136,124,82,75,
+78,114,110,52,139,151,145,159,138,176,137,96,118,117,184,169,78,113,62,26,
+132,151,119,90,100,104,167,78,185,77,66,6,2,52,199,140,27,9,36,143,107,72,
+161,136,61,54,54,56,40,143,42,140,118,59,91,33,32,86,55,107,122,57,35,49,
+43,49,12,1,6,148,129,79,101,83,50,46,52,48,40,35,38,138,48,116,102,104,130,
+59,46,71,57,58,62,106,146,55,17,41,51,97,119,51,41,63,46,52,50,5,248,249,
+10,4,241,253,3,253,223,0,0,6,0,64,253,220,3,156,4,210,0,58,0,70,0,71,0,72,
+0,73,0,74,0,0,1,23,6,6,35,35,6,21,20,22,22,23,22,22,21,20,6,35,34,38,53,52,
+54,55,38,53,52,55,38,38,53,52,54,54,55,54,54,53,52,38,35,34,7,39,54,51,50,
+22,21,20,6,7,6,6,21,20,22,51,50,3,6,6,21,20,22,51,50,54,53,52,38,3,35,19,
+19,3,78,78,125,200,112,14,47,26,73,70,153,136,208,193,200,219,137,135,74,
+17,92,97,67,141,136,124,82,75,78,114,110,52,139,151,145,159,138,176,137,96,
+118,117,184,177,133,138,124,120,130,116,93,50,185,77,66,2,23,146,63,45,12,
+39,19,32,40,28,62,134,98,119,134,145,128,95,132,30,65,86,36,32,33,125,81,
+79,101,83,50,46,52,48,40,35,38,138,48,116,102,104,130,59,46,71,57,58,62,254,
+75,2,82,69,65,68,52,56,52,74,5,14,249,10,4,241,0,7,0,64,252,218,4,41,4,210,
+0,82,0,94,0,95,0,96,0,97,0,98,0,99,0,0,1,6,35,34,38,53,52,54,55,38,38,53,
+52,54,55,38,53,52,55,38,38,53,52,54,54,55,54,54,53,52,38,35,34,7,39,54,51,
+50,22,21,20,6,7,6,6,21,20,22,51,50,55,23,6,6,35,35,6,21,20,22,22,23,22,22,
+21,20,6,7,22,22,23,7,38,38,35,34,6,21,20,22,51,50,55,3,6,6,21,20,22,51,50,
+54,53,52,38,3,35,19,19,1,2,129,110,116,153,174,51,52,64,63,137,135,74,17,
+92,97,67,141,136,124,82,75,78,114,110,52,139,151,145,159,138,176,137,96,118,
+117,184,169,78,125,200,112,14,47,26,73,70,153,136,62,62,75,153,77,125,125,
+230,136,102,108,90,75,93,92,89,133,138,124,120,130,116,93,50,185,77,66,2,
+12,253,4,42,140,118,56,90,34,34,102,69,95,132,30,65,86,36,32,33,125,81,79,
+101,83,50,46,52,48,40,35,38,138,48,116,102,104,130,59,46,71,57,58,62,106,
+146,63,45,12,39,19,32,40,28,62,134,98,65,95,31,38,144,105,72,161,136,61,54,
+54,56,40,2,101,2,82,69,65,68,52,56,52,74,5,14,249,10,4,241,250,226,0,0,2,
+0,90,255,236,7,208,4,210,0,82,0,83,0,0,1,6,6,35,34,38,39,54,54,53,52,38,38,
+35,35,14,2,7,14,2,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,54,55,62,
+2,53,52,38,35,34,6,7,39,54,51,50,22,23,51,50,22,22,21,20,6,7,22,22,51,50,
+55,17,23,17,20,30,2,51,7,35,34,38,38,53,37,6,123,77,143,83,164,238,65,138,
+130,50,91,104,79,4,50,99,115,120,130,57,135,114,92,163,86,76,114,192,115,
+183,230,54,128,142,116,97,42,89,84,79,117,52,52,148,156,113,153,39,116,169,
+153,79,112,111,36,135,80,178,131,164,17,36,66,58,16,21,114,138,52,253,129,
+1,89,55,41,167,165,38,108,76,54,60,23,60,100,88,62,65,90,95,64,83,103,49,
+54,145,60,48,200,151,73,125,122,78,62,65,61,40,64,65,28,26,138,64,74,73,67,
+116,92,94,144,49,61,67,134,2,191,22,252,123,64,55,31,12,149,69,123,112,129,
+0,3,0,90,255,236,7,206,4,210,0,38,0,79,0,80,0,0,1,6,6,35,34,38,53,52,54,51,
+50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,38,
+38,53,37,23,6,4,35,34,38,53,52,54,54,55,62,2,53,52,38,35,34,6,7,39,54,51,
+50,22,21,20,6,6,7,14,2,21,20,22,51,50,54,23,6,121,78,153,94,180,230,246,203,
+43,115,39,27,89,75,138,152,130,112,96,150,82,164,17,36,66,58,16,21,114,138,
+52,253,56,130,140,254,239,159,189,224,54,128,142,116,97,42,89,84,79,117,52,
+52,148,156,160,174,58,109,102,120,130,57,125,107,125,211,159,1,167,52,42,
+210,167,183,216,13,10,145,18,129,117,109,123,59,77,2,109,22,252,123,64,55,
+31,12,149,69,123,112,73,100,161,136,198,153,73,125,122,78,62,65,61,40,64,
+65,28,26,138,64,148,126,73,115,87,55,65,90,95,64,83,103,111,12,0,0,7,0,90,
+253,220,3,214,4,210,0,51,0,63,0,75,0,76,0,77,0,78,0,79,0,0,1,38,35,34,6,21,
+20,22,22,23,22,22,21,20,6,35,35,6,21,20,22,22,23,22,22,21,20,6,35,34,38,53,
+52,54,55,38,53,52,55,38,38,53,52,54,55,38,53,52,54,51,50,23,1,6,6,21,20,22,
+51,50,54,53,52,38,3,6,6,21,20,22,51,50,54,53,52,38,3,35,19,19,3,57,92,114,
+77,70,25,84,80,173,148,229,207,11,47,26,73,70,153,136,208,193,200,219,137,
+135,74,13,121,126,154,154,88,168,150,120,103,254,234,151,167,144,136,139,
+143,103,152,133,138,124,120,130,116,93,14,185,31,138,4,45,17,32,33,21,36,
+46,33,71,143,109,133,148,12,39,19,32,40,28,62,134,98,119,134,145,128,95,132,
+30,65,86,35,25,33,145,102,111,143,31,75,93,90,106,17,254,57,1,93,81,75,83,
+62,68,60,85,253,56,2,82,69,65,68,52,56,52,74,5,14,249,10,5,38,0,0,8,0,72,
+252,218,3,214,4,210,0,72,0,84,0,96,0,97,0,98,0,99,0,100,0,101,0,0,1,38,38,
+53,52,54,55,38,53,52,55,38,38,53,52,54,55,38,53,52,54,51,50,23,7,38,35,34,
+6,21,20,22,22,23,22,22,21,20,6,35,35,6,21,20,22,22,23,22,22,21,20,6,7,22,
+22,21,20,6,35,34,36,39,55,22,22,51,50,53,52,38,35,34,7,19,6,6,21,20,22,51,
+50,54,53,52,38,3,6,6,21,20,22,51,50,54,53,52,38,3,35,19,19,1,1,178,149,159,
+137,135,74,13,121,126,154,154,88,168,150,120,103,26,92,114,77,70,25,84,80,
+173,148,229,207,11,47,26,73,70,153,136,49,48,53,54,181,162,160,254,254,123,
+121,122,180,115,195,84,71,108,87,118,151,167,144,136,139,143,103,152,133,
+138,124,120,130,116,93,14,185,76,98,254,12,254,86,18,137,108,95,132,30,65,
+86,35,25,33,145,102,111,143,31,75,93,90,106,17,148,17,32,33,21,36,46,33,71,
+143,109,133,148,12,39,19,32,40,28,62,134,98,54,88,34,37,97,60,116,137,132,
+126,95,117,91,122,47,56,44,4,218,1,93,81,75,83,62,68,60,85,253,56,2,82,69,
+65,68,52,56,52,74,5,14,249,10,5,38,250,173,0,0,4,0,90,255,236,8,113,4,210,
+0,28,0,41,0,83,0,84,0,0,1,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,38,53,
+52,54,55,38,38,53,52,54,51,50,23,3,35,34,6,21,20,22,51,50,54,53,52,38,5,6,
+6,35,34,38,39,54,54,53,52,38,38,35,35,53,51,50,22,22,21,20,7,22,22,51,50,
+55,17,23,17,20,30,2,51,7,35,34,38,38,53,37,3,50,81,115,79,82,83,128,180,142,
+241,211,214,238,193,178,83,82,172,150,133,97,222,13,157,198,146,135,135,152,
+91,4,61,77,143,83,165,237,65,135,133,52,93,100,180,189,171,148,82,223,36,
+134,81,178,131,164,17,36,66,58,16,21,114,138,52,253,159,4,40,22,53,48,48,
+81,77,110,201,131,164,193,205,174,139,201,38,56,126,70,108,137,23,253,184,
+148,125,108,118,110,104,90,126,133,55,41,178,176,38,116,82,58,66,22,147,70,
+126,97,200,106,64,72,134,2,111,22,252,123,64,55,31,12,149,69,123,112,231,
+0,0,4,0,19,253,220,3,140,4,210,0,66,0,67,0,68,0,69,0,0,1,38,35,34,21,20,22,
+23,22,22,21,20,6,35,35,34,39,6,6,21,20,22,23,22,22,21,20,6,35,34,38,39,55,
+22,51,50,53,52,38,39,46,2,53,52,55,38,38,39,55,22,22,51,50,53,52,38,39,46,
+2,53,52,54,51,50,23,39,35,19,2,243,96,95,161,68,131,162,144,188,163,22,11,
+11,50,45,61,118,148,124,166,148,141,241,116,134,166,199,148,75,92,112,123,
+49,47,73,140,68,137,93,199,114,178,93,93,102,140,74,175,147,139,87,160,185,
+107,4,43,19,81,36,55,53,66,148,113,115,138,1,4,32,31,30,48,48,61,128,104,
+106,126,119,136,93,206,90,52,63,37,44,83,86,60,68,48,34,114,80,94,114,116,
+109,62,75,37,41,82,100,76,100,123,19,19,249,10,0,0,5,0,19,252,218,3,144,4,
+210,0,87,0,88,0,89,0,90,0,91,0,0,1,38,38,39,55,22,51,50,53,52,38,39,46,2,
+53,52,55,38,38,39,55,22,22,51,50,53,52,38,39,46,2,53,52,54,51,50,23,7,38,
+35,34,21,20,22,23,22,22,21,20,6,35,35,34,39,6,6,21,20,22,23,22,22,21,20,6,
+7,22,22,21,20,6,35,34,36,39,55,22,22,51,50,53,52,38,35,34,7,19,35,19,5,1,
+126,89,162,74,134,166,199,148,75,92,112,123,49,47,73,140,68,137,93,199,114,
+178,93,93,102,140,74,175,147,139,87,31,96,95,161,68,131,162,144,188,163,22,
+11,11,50,45,61,118,148,124,34,33,55,55,181,162,160,254,254,123,121,122,180,
+115,195,84,71,108,87,215,185,136,253,254,254,105,25,113,88,93,206,90,52,63,
+37,44,83,86,60,68,48,34,114,80,94,114,116,109,62,75,37,41,82,100,76,100,123,
+19,148,19,81,36,55,53,66,148,113,115,138,1,4,32,31,30,48,48,61,128,104,47,
+77,29,37,98,61,116,137,132,126,95,117,91,122,47,56,44,6,178,249,10,45,0,5,
+0,19,253,220,3,180,4,210,0,70,0,81,0,82,0,83,0,84,0,0,1,38,35,34,21,20,22,
+23,22,22,21,20,6,7,22,21,20,6,7,6,6,21,20,22,23,38,53,52,54,51,50,22,21,20,
+6,35,34,38,53,52,54,54,55,62,2,53,52,39,35,34,36,39,55,22,22,51,50,53,52,
+38,39,46,2,53,52,54,51,50,23,3,54,54,53,52,38,35,34,6,21,20,19,35,19,2,243,
+96,95,161,68,131,162,144,81,76,5,136,213,110,98,122,118,27,149,124,121,142,
+221,213,232,251,54,156,151,92,75,32,3,31,149,254,248,125,137,93,199,114,178,
+93,93,102,140,74,175,147,139,87,208,111,111,63,57,61,68,75,185,54,4,43,19,
+81,36,55,53,66,148,113,74,113,32,24,25,97,112,75,40,75,60,60,69,5,62,66,90,
+116,122,104,119,131,149,130,68,104,100,51,31,33,37,27,11,9,137,147,94,114,
+116,109,62,75,37,41,82,100,76,100,123,19,249,250,3,61,54,37,48,54,53,43,5,
+228,249,10,0,5,0,19,255,236,8,12,4,210,0,36,0,78,0,79,0,80,0,81,0,0,1,38,
+35,34,6,21,20,22,22,23,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,
+38,39,38,38,53,52,54,51,50,23,1,6,6,35,34,38,39,54,54,53,52,38,38,35,35,53,
+51,50,22,22,21,20,7,22,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,9,
+2,3,2,80,107,88,101,37,78,106,176,130,211,178,152,253,108,143,85,174,114,
+102,116,107,153,143,121,193,164,123,91,3,151,77,143,83,165,237,65,135,133,
+52,93,100,138,147,171,148,82,223,36,134,81,178,131,164,17,36,66,58,16,21,
+114,138,52,251,163,254,58,3,176,4,42,20,70,63,42,60,61,65,108,176,127,151,
+183,152,165,87,130,124,95,83,87,122,90,85,155,109,125,153,23,252,238,55,41,
+178,176,38,116,82,58,66,22,147,70,126,97,200,106,64,72,134,2,111,22,252,123,
+64,55,31,12,149,69,123,112,1,17,254,171,1,43,0,6,0,90,253,220,3,254,4,210,
+0,79,0,90,0,101,0,102,0,103,0,104,0,0,1,39,54,51,50,22,21,20,6,6,7,6,6,21,
+20,22,23,38,53,52,54,51,50,22,21,20,6,7,22,21,20,6,7,6,6,21,20,22,23,38,53,
+52,54,51,50,22,21,20,6,35,34,38,53,52,54,54,55,62,2,53,52,39,6,35,34,38,53,
+52,54,54,55,62,2,53,52,38,35,34,1,54,54,53,52,38,35,34,6,21,20,19,54,54,53,
+52,38,35,34,6,21,20,19,35,19,1,17,52,139,151,145,159,57,139,153,110,98,128,
+127,27,149,124,121,142,109,102,4,136,213,110,98,122,118,27,149,124,121,142,
+221,213,232,251,54,156,151,92,75,32,4,32,33,236,255,54,156,151,92,75,32,75,
+78,114,1,13,111,111,63,57,61,68,12,111,111,63,57,61,68,3,165,144,4,24,138,
+48,116,102,66,87,77,54,40,75,60,61,69,5,62,67,90,116,122,104,82,115,27,15,
+26,97,112,75,40,75,60,60,69,5,62,66,90,116,122,104,119,131,149,130,68,104,
+100,51,31,33,37,27,13,9,2,149,130,68,104,100,51,31,33,37,27,40,35,253,104,
+4,61,54,37,48,54,53,44,252,222,3,61,54,37,48,54,53,43,5,228,249,10,0,0,5,
+0,90,255,236,8,117,4,210,0,10,0,94,0,95,0,96,0,97,0,0,37,54,54,53,52,38,35,
+34,6,21,20,19,6,6,7,6,6,21,20,22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,
+53,52,54,54,55,62,2,53,52,38,35,34,6,7,39,54,51,50,22,23,33,50,22,22,21,20,
+7,22,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,53,6,6,35,34,38,39,
+54,54,53,52,38,38,35,19,1,3,2,108,116,125,63,59,69,80,246,8,138,163,165,107,
+111,107,33,162,130,131,153,233,213,230,250,71,132,127,117,94,42,87,74,87,
+118,54,52,147,158,109,159,37,1,19,169,153,79,223,36,135,80,178,131,164,17,
+36,66,58,16,21,114,138,52,77,143,83,164,238,65,138,130,50,91,104,150,253,
+112,184,122,5,83,73,58,67,80,69,75,2,244,89,147,74,76,121,82,92,114,16,82,
+78,119,142,144,125,135,166,203,170,92,136,105,65,59,59,59,39,55,64,27,27,
+138,64,76,71,67,116,92,188,99,61,67,134,2,191,22,252,123,64,55,31,12,149,
+69,123,112,41,55,41,167,165,38,108,76,54,60,23,254,5,254,207,2,138,0,2,0,
+64,0,0,5,73,4,210,0,31,0,32,0,0,1,35,34,6,6,21,20,22,23,7,38,38,53,52,55,
+5,53,33,17,23,17,20,30,2,51,7,35,34,38,38,53,5,3,244,209,126,121,72,137,149,
+111,185,158,76,254,184,3,180,164,17,36,66,58,16,21,114,138,52,254,194,2,226,
+31,84,65,91,201,132,110,165,249,120,117,68,8,151,1,92,22,252,123,64,55,31,
+12,149,69,123,112,132,0,7,0,90,253,220,4,54,4,211,0,61,0,62,0,63,0,64,0,65,
+0,66,0,67,0,0,23,22,22,51,50,54,53,52,38,39,38,38,53,52,54,54,55,62,2,53,
+52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,
+7,19,7,3,6,7,22,21,20,6,35,34,38,39,9,2,19,3,3,224,42,71,39,51,60,51,52,136,
+158,69,123,118,118,106,36,49,136,83,47,109,147,120,99,50,136,121,87,80,5,
+71,57,60,69,55,199,126,197,70,104,66,146,118,85,132,54,2,36,1,16,254,55,24,
+3,95,135,43,41,61,55,57,109,43,30,182,123,90,132,101,63,63,67,55,38,51,55,
+79,95,107,63,93,88,77,63,70,84,56,93,106,25,21,27,52,63,70,56,68,47,254,215,
+75,1,54,21,7,90,107,127,135,66,69,5,181,251,46,4,210,251,138,2,75,251,53,
+0,7,0,78,253,220,6,5,4,211,0,54,0,82,0,83,0,84,0,85,0,86,0,87,0,0,1,38,53,
+52,54,51,50,22,21,20,7,19,7,3,7,6,4,35,34,38,53,52,55,38,38,53,52,54,51,50,
+23,54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,7,35,34,38,
+53,52,55,38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,9,4,
+4,121,5,71,57,60,69,55,199,126,197,25,129,254,175,195,168,197,52,71,70,185,
+148,110,77,29,117,119,118,106,36,49,136,83,47,109,147,120,99,50,136,121,87,
+78,21,184,229,2,65,60,94,97,82,65,94,41,39,13,20,25,84,90,112,94,248,1,85,
+1,16,254,55,254,206,1,65,1,9,21,27,52,63,70,56,68,47,254,215,75,1,54,6,199,
+205,150,124,84,66,52,121,77,110,140,23,50,97,64,63,67,55,38,51,55,79,95,107,
+63,93,88,77,63,70,84,56,93,106,148,198,151,32,12,13,64,58,90,53,33,6,137,
+3,67,61,67,76,5,99,251,46,4,210,249,10,4,203,0,5,0,90,253,220,4,62,4,210,
+0,58,0,59,0,60,0,61,0,62,0,0,5,34,38,53,52,55,38,38,53,52,54,51,50,22,23,
+7,38,35,34,6,21,20,22,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,55,38,53,
+52,54,51,50,22,21,20,7,22,22,23,23,7,39,38,38,39,6,3,19,1,19,2,98,197,233,
+110,103,97,204,184,51,128,45,28,92,83,118,126,87,89,91,108,81,73,28,58,64,
+132,157,137,130,47,24,11,63,54,55,65,42,36,97,71,15,46,16,100,135,52,62,116,
+243,254,84,199,20,208,172,152,105,66,155,97,133,166,15,12,147,24,86,75,70,
+107,44,34,13,147,10,121,105,115,117,4,26,35,51,60,69,50,63,48,97,98,12,2,
+151,3,19,132,130,18,4,230,251,46,4,210,249,10,0,7,0,78,253,220,6,5,4,211,
+0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,0,37,35,34,38,53,52,54,54,55,62,2,53,
+52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,
+7,19,7,3,7,6,4,35,34,38,53,52,55,38,53,52,54,55,23,6,6,21,20,23,54,51,50,
+23,7,38,35,34,6,21,20,22,51,50,9,3,3,37,3,219,21,184,229,69,123,118,118,106,
+36,49,136,83,47,109,147,120,99,50,136,121,87,80,5,71,57,60,69,55,199,126,
+197,25,129,254,175,195,168,197,49,138,166,165,57,114,113,76,68,97,41,39,13,
+20,25,84,90,112,94,248,1,85,1,16,254,55,254,199,216,2,32,92,198,151,90,132,
+101,63,63,67,55,38,51,55,79,95,107,63,93,88,77,63,70,84,56,93,106,25,21,27,
+52,63,70,56,68,47,254,215,75,1,54,6,199,205,150,124,80,66,108,146,115,173,
+51,144,31,99,80,86,58,36,6,137,3,67,61,67,76,5,99,251,46,4,210,249,10,4,163,
+40,0,7,0,90,253,220,4,54,4,211,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,0,5,7,
+3,5,23,22,21,20,6,35,34,38,53,52,54,55,55,54,55,38,38,53,52,54,54,55,62,2,
+53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,
+20,7,3,1,1,19,3,19,4,54,126,200,254,180,47,21,66,60,85,161,52,56,46,84,83,
+161,186,69,123,118,118,106,36,49,136,83,47,109,147,120,99,50,138,124,87,75,
+5,71,57,60,69,55,219,1,16,254,55,74,54,35,110,75,1,59,190,73,33,36,38,55,
+114,67,34,52,30,24,44,34,12,190,135,90,132,101,63,63,67,55,38,51,55,79,95,
+107,63,93,88,77,63,70,84,56,94,105,24,21,28,52,63,70,56,68,45,4,21,251,46,
+4,210,251,138,2,75,251,53,0,0,8,0,49,253,220,5,104,4,211,0,48,0,57,0,65,0,
+66,0,67,0,68,0,69,0,70,0,0,1,38,53,52,54,51,50,22,21,20,7,19,7,3,6,4,35,34,
+38,53,52,54,55,53,52,54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,
+22,51,50,3,54,55,35,34,38,39,6,7,19,1,6,21,20,22,51,50,9,2,3,19,3,220,5,71,
+57,60,69,55,199,126,196,106,254,189,185,180,219,186,161,69,123,118,118,106,
+36,49,136,83,47,109,147,120,99,50,136,121,87,227,83,87,42,133,199,47,56,44,
+226,254,199,29,126,108,59,1,203,1,16,254,55,224,250,1,9,21,27,52,63,70,56,
+68,47,254,215,75,1,53,186,202,189,153,127,195,36,5,90,132,101,63,63,67,55,
+38,51,55,79,95,107,63,93,88,77,63,70,84,56,93,106,254,217,45,102,107,95,12,
+24,254,150,1,24,47,57,90,98,5,70,251,46,4,210,249,10,4,203,0,0,9,0,18,253,
+220,4,221,4,211,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,0,1,38,53,
+52,54,51,50,22,21,20,7,19,7,39,5,23,22,21,20,6,35,34,38,53,52,54,55,55,38,
+38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,37,39,6,35,34,38,53,52,
+54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,19,1,1,19,3,
+45,2,3,82,5,71,57,60,69,71,214,126,137,254,205,33,25,65,57,83,158,37,38,38,
+45,81,52,60,72,88,96,99,131,109,160,117,89,144,75,1,55,17,95,112,196,236,
+64,120,127,123,104,32,49,136,83,55,108,139,122,101,47,139,123,87,53,1,26,
+254,45,44,159,254,220,1,69,1,96,1,100,21,28,52,63,70,56,79,49,254,136,75,
+243,202,51,39,35,42,48,85,51,31,44,25,25,60,51,71,59,72,130,74,115,118,185,
+90,121,149,78,100,201,31,23,172,141,79,117,93,64,62,61,44,31,51,55,79,95,
+107,62,90,75,67,58,64,71,49,76,89,3,134,251,46,4,210,253,238,251,28,188,189,
+201,0,0,1,0,80,0,0,5,145,5,96,0,74,0,0,1,6,6,21,20,22,51,50,55,38,53,52,54,
+51,50,22,21,20,7,21,33,17,23,17,20,30,2,51,7,35,34,38,38,39,33,21,20,6,35,
+34,38,38,53,52,54,51,51,53,6,35,34,38,53,52,54,55,55,62,2,53,52,35,34,7,39,
+54,51,50,22,21,20,6,7,1,103,69,45,81,87,76,50,9,62,55,55,65,44,1,105,164,
+17,36,66,58,16,21,110,136,57,1,254,151,54,45,47,111,77,64,61,53,66,94,155,
+172,100,130,61,37,33,19,98,88,85,38,116,97,122,136,81,135,3,139,37,56,32,
+49,48,19,21,29,51,60,69,50,66,47,194,3,27,22,252,123,64,55,31,12,149,64,115,
+114,64,60,68,81,121,48,43,45,123,17,137,103,88,112,65,31,19,22,31,19,61,28,
+138,33,108,93,71,103,69,0,0,1,0,90,0,0,4,200,5,96,0,63,0,0,1,6,6,21,20,23,
+54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,
+39,6,35,34,38,53,52,55,38,53,52,54,55,55,62,2,53,52,35,34,7,39,54,51,50,22,
+21,20,6,7,1,113,66,48,87,79,110,49,75,24,42,62,91,101,119,105,93,152,79,164,
+17,36,66,58,16,21,246,44,147,191,178,211,55,135,100,130,61,37,33,19,98,88,
+85,38,116,97,122,136,82,133,3,139,34,59,38,76,53,34,12,146,10,79,74,82,91,
+59,74,3,126,22,252,123,64,55,31,12,149,163,104,174,142,107,74,96,139,83,111,
+65,31,19,22,31,19,61,28,138,33,108,93,71,104,68,0,7,0,49,253,220,5,84,4,211,
+0,48,0,61,0,62,0,63,0,64,0,65,0,66,0,0,1,38,53,52,54,51,50,22,21,20,7,19,
+7,3,6,4,35,34,38,53,52,54,55,53,52,54,54,55,62,2,53,52,39,55,22,21,20,6,6,
+7,14,2,21,20,22,51,50,7,35,34,38,39,6,6,21,20,22,51,50,54,19,1,1,3,3,3,200,
+5,71,57,60,69,55,199,126,196,103,254,200,179,180,219,174,153,69,123,118,118,
+106,36,49,136,83,47,109,147,120,99,50,136,121,87,54,45,131,199,47,92,106,
+126,108,111,187,200,1,16,254,55,74,92,1,9,21,27,52,63,70,56,68,47,254,215,
+75,1,52,186,201,189,153,123,191,40,9,90,132,101,63,63,67,55,38,51,55,79,95,
+107,63,93,88,77,63,70,84,56,93,106,146,103,93,23,118,77,90,98,100,4,226,251,
+46,4,210,253,213,251,53,0,0,2,0,49,0,0,4,202,4,210,0,48,0,49,0,0,1,6,7,7,
+23,22,22,21,20,6,35,34,38,53,52,54,55,37,54,55,53,33,21,20,6,35,34,38,38,
+53,52,54,54,51,33,17,23,17,20,30,2,51,7,35,34,38,38,53,19,3,117,60,44,190,
+44,23,17,74,68,98,155,30,53,1,72,125,69,254,19,56,49,48,114,76,36,62,73,2,
+153,164,17,36,66,58,16,21,114,138,52,38,2,87,56,37,158,54,28,41,28,49,53,
+107,62,30,45,39,246,94,41,24,117,57,60,88,130,56,42,50,16,1,47,22,252,123,
+64,55,31,12,149,69,123,112,1,51,0,3,0,77,253,220,8,46,4,210,0,102,0,103,0,
+104,0,0,1,35,34,39,22,22,21,20,6,35,35,34,39,30,2,51,51,7,35,34,38,39,38,
+38,53,52,54,51,50,22,23,22,51,50,54,53,52,38,38,39,5,39,37,38,38,53,52,54,
+51,50,23,7,38,38,35,34,6,21,20,22,23,33,54,53,52,38,35,34,7,39,54,51,50,22,
+21,20,7,22,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,53,6,6,35,34,
+38,1,1,3,254,142,89,51,98,90,206,191,24,12,13,49,85,93,74,48,18,32,142,228,
+118,104,100,61,47,55,94,45,57,78,113,121,41,107,100,254,134,57,1,29,76,76,
+196,162,128,110,30,68,77,46,99,108,76,76,2,83,126,101,86,55,49,37,78,74,160,
+181,223,36,134,81,178,131,164,17,36,66,58,16,21,114,138,52,77,143,83,145,
+214,254,176,253,188,2,82,7,73,148,89,138,173,1,59,64,27,154,143,174,13,83,
+59,45,55,58,54,12,87,82,45,79,97,62,145,145,102,59,134,75,128,159,27,149,
+17,9,79,73,52,96,45,70,115,75,89,11,140,17,166,142,205,108,64,72,134,2,111,
+22,252,123,64,55,31,12,149,69,123,112,121,55,41,132,252,15,4,104,0,2,0,90,
+0,0,8,110,4,210,0,69,0,70,0,0,1,6,6,35,34,38,39,36,53,52,38,35,34,14,2,21,
+21,20,14,2,35,34,38,53,52,18,55,23,6,6,21,20,22,51,50,62,2,53,53,52,54,54,
+51,50,22,21,20,7,22,22,51,50,55,17,23,17,20,30,2,51,7,35,34,38,38,53,37,7,
+25,77,143,83,165,237,65,1,12,103,94,73,78,58,27,35,91,150,110,182,224,222,
+219,47,156,164,125,111,62,83,54,25,80,181,140,168,193,223,36,134,81,178,131,
+164,17,36,66,58,16,21,114,138,52,253,136,1,169,55,41,178,176,75,166,77,87,
+34,65,115,94,37,111,157,119,67,235,200,179,1,5,70,149,51,181,136,136,145,
+35,64,97,98,64,158,176,106,170,138,205,108,64,72,134,2,111,22,252,123,64,
+55,31,12,149,69,123,112,231,0,0,4,0,26,0,0,6,233,4,210,0,55,0,67,0,68,0,69,
+0,0,37,6,35,34,38,39,5,39,55,54,55,38,38,39,6,5,39,54,55,38,38,53,52,54,51,
+50,22,21,20,6,7,22,22,23,55,23,7,6,6,21,20,22,51,50,55,17,23,17,20,30,2,51,
+7,35,32,1,54,54,53,52,38,35,34,6,21,20,22,23,5,5,156,99,136,138,168,6,254,
+212,99,169,60,71,69,129,61,109,254,213,97,170,167,100,105,173,139,154,172,
+71,73,39,143,104,217,82,69,55,64,82,71,135,91,164,17,36,66,58,16,21,254,247,
+252,53,71,67,81,75,69,87,85,99,1,212,191,65,157,142,232,135,112,40,38,17,
+39,23,78,185,145,92,99,53,154,93,109,155,148,124,75,124,59,13,38,25,142,125,
+44,35,81,66,71,76,95,3,99,22,252,123,64,55,31,12,149,2,249,51,92,55,60,72,
+73,61,62,94,188,133,0,5,0,26,255,228,5,166,4,210,0,53,0,65,0,66,0,67,0,68,
+0,0,1,23,17,20,30,2,51,7,35,34,38,38,53,53,5,23,22,21,20,6,35,34,38,38,53,
+52,54,55,37,55,38,38,39,6,5,39,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,
+22,23,37,54,54,53,52,38,35,34,6,21,20,22,1,1,5,4,81,164,17,36,66,58,16,21,
+114,138,52,254,174,47,21,71,56,63,131,71,52,56,1,47,86,111,205,94,133,254,
+238,97,170,167,100,105,173,139,154,172,71,73,87,227,139,253,159,71,67,81,
+75,69,87,85,1,96,254,238,2,62,4,210,22,252,123,64,55,31,12,149,69,123,112,
+107,195,73,33,36,43,59,61,87,41,34,52,30,161,43,22,58,36,93,170,145,92,99,
+53,154,93,109,155,148,124,75,124,59,27,57,30,171,51,92,55,60,72,73,61,62,
+94,254,65,1,3,171,0,0,3,0,26,0,0,8,148,4,210,0,17,0,58,0,70,0,0,1,5,39,37,
+17,23,17,20,30,2,51,7,35,34,38,38,53,1,54,0,55,23,6,6,21,20,22,51,50,55,23,
+6,35,34,38,39,38,39,6,5,39,54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,
+51,37,54,54,53,52,38,35,34,6,21,20,22,7,63,254,36,38,2,2,164,17,36,66,58,
+16,21,114,138,52,252,139,12,1,14,239,41,201,194,166,141,122,92,63,115,155,
+187,252,33,243,171,117,254,187,97,197,154,110,109,78,142,92,154,172,51,47,
+106,145,254,80,61,56,81,75,68,88,97,2,208,98,151,103,1,102,22,252,123,64,
+55,31,12,149,69,123,112,1,173,187,1,6,52,152,42,196,163,149,166,42,137,55,
+193,175,2,35,85,202,145,106,94,48,146,97,68,124,72,148,124,66,105,47,11,43,
+47,86,50,60,72,76,58,63,90,0,2,0,26,0,0,6,232,4,210,0,59,0,71,0,0,37,6,6,
+35,34,38,53,52,55,38,39,6,5,39,54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,
+22,51,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,20,30,2,51,
+7,35,34,38,1,54,54,53,52,38,35,34,6,21,20,22,5,155,71,140,84,172,216,41,130,
+96,105,254,173,97,173,178,110,109,78,142,92,154,172,51,47,106,142,95,118,
+39,106,34,27,79,64,120,131,123,103,79,133,72,164,17,36,66,58,16,21,131,148,
+252,89,61,56,81,75,68,88,97,188,53,41,183,147,97,73,9,20,78,211,145,92,108,
+48,146,97,68,124,72,148,124,66,105,47,11,42,13,10,145,18,103,95,89,96,53,
+73,3,98,22,252,123,64,55,31,12,149,94,2,170,47,86,50,60,72,76,58,63,90,0,
+7,0,13,255,236,5,242,4,210,0,57,0,68,0,69,0,70,0,71,0,72,0,73,0,0,37,23,6,
+6,35,34,38,53,53,6,35,34,38,38,53,53,52,38,38,35,55,51,50,23,1,22,23,54,55,
+62,2,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,6,7,14,2,21,20,22,51,50,54,
+1,20,22,51,50,55,37,38,39,22,21,1,35,19,35,3,5,166,76,114,192,115,183,230,
+68,79,103,155,93,32,66,79,16,21,152,74,1,165,123,90,20,82,116,97,42,89,84,
+79,117,52,52,148,156,160,174,58,109,102,120,130,57,135,114,92,163,252,18,
+93,111,134,126,254,252,130,83,9,3,44,185,166,88,157,233,145,60,48,200,151,
+22,24,81,158,149,212,62,52,20,149,62,254,201,91,79,14,46,62,65,61,40,64,65,
+28,26,138,64,148,126,73,115,87,55,65,90,95,64,83,103,49,2,41,145,110,109,
+193,97,72,51,93,1,174,251,46,2,222,255,255,0,13,253,220,5,242,4,210,2,34,
+1,130,0,0,0,3,0,129,6,33,0,0,0,8,0,13,255,236,6,107,4,210,0,12,0,58,0,69,
+0,70,0,71,0,72,0,73,0,74,0,0,1,35,34,6,21,20,22,51,50,54,53,52,38,37,38,53,
+52,54,51,50,23,7,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,38,53,53,6,35,
+34,38,38,53,53,52,38,38,35,55,51,50,23,1,22,23,54,37,20,22,51,50,55,37,38,
+39,22,21,1,3,35,3,1,4,251,13,157,198,146,135,135,152,91,254,238,165,172,150,
+133,97,30,81,115,79,82,83,128,180,142,241,211,214,238,85,113,103,155,93,32,
+66,79,16,21,152,74,1,165,101,113,81,253,130,93,111,134,126,254,252,130,83,
+9,3,210,68,86,31,254,251,2,115,148,125,108,118,110,104,90,126,179,112,140,
+108,137,23,147,22,53,48,48,81,77,110,201,131,164,193,205,174,7,37,81,158,
+149,212,62,52,20,149,62,254,201,74,106,53,20,145,110,109,193,97,72,51,93,
+1,174,251,46,4,210,254,12,0,255,255,0,13,253,220,6,107,4,210,2,34,1,132,0,
+0,0,3,0,129,6,152,0,0,0,3,0,63,0,0,8,60,4,210,0,31,0,73,0,74,0,0,1,1,39,1,
+38,38,35,34,6,7,39,54,54,51,50,22,23,55,17,23,17,20,30,2,51,7,35,34,38,38,
+53,1,6,7,30,2,51,51,7,35,34,38,39,6,35,34,38,53,52,54,51,50,23,54,54,53,52,
+38,35,34,6,7,39,54,51,50,22,21,20,7,33,21,5,6,231,253,232,102,1,240,70,161,
+124,68,115,73,58,70,162,74,154,200,135,16,164,17,36,66,58,16,21,114,138,52,
+251,203,87,143,81,120,117,77,41,18,32,154,254,132,31,31,89,92,69,55,90,73,
+131,133,126,114,72,121,66,52,161,157,188,214,15,1,111,253,91,2,118,254,158,
+143,1,38,102,123,32,40,143,37,46,129,175,9,1,181,22,252,123,64,55,31,12,149,
+69,123,112,1,25,105,51,114,115,46,154,177,219,3,58,66,47,57,56,35,145,103,
+113,123,30,33,141,72,203,185,55,57,149,44,0,5,0,105,253,220,5,136,4,210,0,
+61,0,75,0,76,0,77,0,78,0,0,1,38,35,34,6,21,20,23,54,51,50,4,23,17,20,30,2,
+51,7,35,34,46,2,53,17,38,39,21,20,6,6,35,34,46,2,53,53,7,14,2,21,20,22,23,
+7,38,2,53,52,54,55,38,53,52,54,51,50,23,19,38,35,34,7,21,20,22,22,51,50,54,
+54,53,3,35,3,2,251,83,86,106,113,51,122,141,156,1,21,145,11,26,57,55,15,12,
+83,107,63,30,47,83,59,118,90,74,107,66,24,8,26,81,50,154,172,85,201,208,96,
+93,84,199,177,115,92,35,51,92,52,47,18,54,47,52,53,18,102,185,40,4,38,22,
+84,77,74,58,48,52,57,254,93,56,54,33,19,149,38,65,98,103,1,75,15,20,186,121,
+130,68,49,96,121,77,130,4,13,85,137,88,153,218,79,134,97,1,43,195,125,204,
+71,91,126,132,167,25,253,250,4,8,191,74,80,46,45,84,82,2,215,249,10,0,0,4,
+0,105,253,220,5,21,4,210,0,62,0,63,0,64,0,65,0,0,1,38,35,34,6,21,20,23,54,
+51,50,22,23,17,20,30,2,51,7,35,34,46,2,53,53,35,21,20,6,35,34,38,38,53,52,
+51,33,53,38,38,35,34,6,21,20,22,23,7,38,2,53,52,54,55,38,53,52,54,51,50,23,
+39,35,3,2,251,83,86,106,113,88,101,117,124,219,128,11,26,57,55,15,12,83,107,
+63,30,199,52,42,43,102,69,111,1,140,79,146,93,185,215,159,167,85,198,211,
+109,103,107,199,177,115,92,77,185,26,4,38,22,84,77,98,68,32,47,59,254,140,
+56,54,33,19,149,38,65,98,103,6,99,52,51,76,114,49,94,145,29,26,196,161,140,
+209,74,134,91,1,39,178,125,206,67,103,143,132,167,25,25,249,10,0,2,0,105,
+253,220,6,106,4,210,0,64,0,65,0,0,1,38,35,34,6,21,20,23,54,51,50,22,23,33,
+17,23,17,20,30,2,51,7,35,34,38,38,39,33,21,20,6,35,34,38,38,53,52,54,51,51,
+38,38,35,34,6,6,21,20,22,23,7,38,2,53,52,54,55,38,53,52,54,51,50,23,1,2,251,
+83,86,106,113,77,77,77,181,208,13,1,37,164,17,36,66,58,16,21,110,136,57,1,
+254,226,53,46,46,111,78,61,61,44,6,124,111,90,157,86,159,167,85,199,210,104,
+100,99,199,177,115,92,254,197,4,38,22,84,77,92,65,23,178,172,3,27,22,252,
+123,64,55,31,12,149,64,115,114,64,61,67,82,121,47,42,46,101,101,88,161,108,
+140,209,74,134,92,1,39,177,128,209,69,102,136,132,167,25,249,35,0,3,0,105,
+253,220,6,116,4,210,0,62,0,63,0,64,0,0,1,38,35,34,6,21,20,23,54,51,50,22,
+21,20,7,22,22,51,50,54,55,17,23,17,20,30,2,51,7,35,34,39,6,6,35,34,38,39,
+54,54,53,52,35,34,6,21,16,5,7,38,2,53,52,54,55,38,53,52,54,51,50,23,1,1,2,
+251,83,86,106,113,48,110,131,164,190,189,35,118,72,73,124,60,164,17,36,66,
+58,16,21,233,51,71,127,82,149,220,56,116,113,191,175,216,1,70,85,199,210,
+95,91,81,199,177,115,92,254,215,1,21,4,38,22,84,77,72,56,44,142,126,157,92,
+57,62,50,60,3,153,22,252,123,64,55,31,12,149,146,51,40,172,162,32,89,62,119,
+203,177,254,212,150,134,97,1,53,185,127,207,70,90,123,132,167,25,249,35,3,
+21,0,0,5,0,105,253,220,5,111,4,210,0,52,0,71,0,72,0,73,0,74,0,0,1,38,35,34,
+6,21,20,23,54,51,50,4,23,17,20,30,2,51,7,35,34,46,2,39,5,39,37,53,38,38,35,
+34,6,21,20,22,23,7,38,2,53,52,54,55,38,53,52,54,51,50,23,19,6,6,21,20,22,
+51,50,54,55,23,6,35,34,38,53,52,54,55,3,35,3,2,251,83,86,106,113,51,122,141,
+149,1,9,139,11,26,57,55,15,12,93,112,56,21,1,254,216,35,1,75,114,162,120,
+193,219,154,172,85,201,208,96,93,84,199,177,115,92,73,129,124,104,92,49,63,
+34,50,83,115,158,185,189,176,103,185,64,4,38,22,84,77,74,58,48,51,58,254,
+93,56,54,33,19,149,47,71,93,82,62,134,68,198,37,23,207,173,153,218,79,134,
+97,1,43,195,125,204,71,91,126,132,167,25,253,51,21,103,86,74,82,9,11,125,
+28,160,140,125,176,33,2,95,249,10,0,4,0,105,253,220,5,51,4,210,0,67,0,68,
+0,69,0,70,0,0,1,38,35,34,6,21,20,23,54,51,50,22,23,17,20,30,2,51,7,35,34,
+39,6,35,34,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,51,50,55,17,38,38,35,
+34,6,21,20,22,23,7,38,2,53,52,54,55,38,53,52,54,51,50,23,39,35,3,2,251,83,
+86,106,113,51,122,141,121,232,140,11,26,57,55,15,12,195,60,114,154,142,173,
+170,141,89,73,12,69,59,88,88,86,79,133,100,109,142,85,193,219,154,172,85,
+201,208,96,93,84,199,177,115,92,67,185,150,4,38,22,84,77,74,58,48,49,60,254,
+93,56,54,33,19,149,116,80,149,122,118,145,21,136,20,68,60,64,68,103,1,99,
+37,23,207,173,153,218,79,134,97,1,43,195,125,204,71,91,126,132,167,25,25,
+249,10,0,0,3,0,64,0,24,3,244,4,210,0,17,0,18,0,19,0,0,1,35,34,6,6,21,20,22,
+23,7,38,38,53,52,55,5,53,33,3,3,3,244,209,126,121,72,137,149,111,185,158,
+76,254,184,3,180,132,184,2,226,31,84,65,91,201,132,110,165,249,120,117,68,
+8,151,1,92,251,218,0,2,0,26,1,78,3,221,4,210,0,23,0,35,0,0,1,38,39,6,5,39,
+54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,51,51,37,54,54,53,52,38,35,
+34,6,21,20,22,3,204,239,165,103,254,170,97,173,178,110,109,78,142,92,154,
+172,51,47,118,120,53,254,40,61,56,81,75,68,88,97,2,76,3,32,76,213,145,92,
+108,47,145,99,68,124,72,148,124,66,105,47,11,44,47,85,50,60,72,76,58,63,90,
+0,3,0,185,0,0,8,172,7,44,0,26,0,27,0,28,0,0,1,36,36,33,34,6,6,21,17,20,30,
+2,51,7,35,34,38,38,53,17,16,18,36,51,32,1,5,37,8,89,254,159,253,162,254,235,
+233,220,99,17,36,66,58,16,21,114,138,52,175,1,49,221,2,88,2,222,248,110,6,
+248,5,33,190,180,117,215,225,252,213,64,55,31,12,153,69,123,112,3,123,1,0,
+1,7,122,254,120,210,227,255,255,0,185,0,0,9,98,7,44,2,34,1,143,0,0,0,3,2,
+217,10,2,0,0,0,3,0,185,0,0,10,40,7,44,0,41,0,42,0,43,0,0,1,38,35,34,6,21,
+20,23,7,39,0,33,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,16,18,36,51,32,
+1,39,38,54,54,51,50,23,1,37,9,251,80,77,80,89,71,159,13,253,92,253,217,233,
+220,99,17,36,66,58,16,21,114,138,52,175,1,49,221,2,32,2,125,1,5,54,154,113,
+119,99,246,242,6,189,6,114,44,89,77,89,127,17,22,1,110,117,215,225,252,213,
+64,55,31,12,153,69,123,112,3,123,1,0,1,7,122,254,194,14,63,148,93,51,253,
+217,231,0,4,0,185,0,0,10,40,7,44,0,41,0,53,0,54,0,55,0,0,1,38,35,34,6,21,
+20,23,7,39,0,33,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,16,18,36,51,32,
+1,39,38,54,54,51,50,23,3,20,6,35,34,38,53,52,54,51,50,22,1,37,9,251,80,77,
+80,89,71,159,13,253,92,253,217,233,220,99,17,36,66,58,16,21,114,138,52,175,
+1,49,221,2,32,2,125,1,5,54,154,113,119,99,64,61,41,41,61,61,41,41,61,247,
+60,6,198,6,114,44,89,77,89,127,17,22,1,110,117,215,225,252,213,64,55,31,12,
+153,69,123,112,3,123,1,0,1,7,122,254,194,14,63,148,93,51,254,200,43,59,59,
+43,43,59,59,254,230,231,255,255,254,116,0,0,2,25,7,44,2,34,0,59,0,0,0,3,2,
+217,2,185,0,0,0,2,254,116,0,0,2,136,7,44,0,42,0,43,0,0,1,20,30,2,51,7,35,
+34,38,38,53,17,38,38,35,34,6,21,20,23,35,38,53,52,54,51,50,22,23,54,54,51,
+50,23,7,38,35,34,6,7,22,23,7,1,93,17,36,66,58,16,21,114,138,52,27,151,95,
+68,76,25,159,30,162,131,87,136,50,32,130,98,119,99,45,80,77,77,89,3,45,27,
+223,1,59,64,55,31,12,153,69,123,112,3,179,192,245,98,90,87,100,114,92,144,
+173,71,71,71,71,51,135,44,89,76,109,154,32,0,0,3,254,116,0,0,2,136,7,44,0,
+42,0,54,0,55,0,0,1,20,30,2,51,7,35,34,38,38,53,17,38,38,35,34,6,21,20,23,
+35,38,53,52,54,51,50,22,23,54,54,51,50,23,7,38,35,34,6,7,22,23,19,50,22,21,
+20,6,35,34,38,53,52,54,1,1,93,17,36,66,58,16,21,114,138,52,27,151,95,68,76,
+25,159,30,162,131,87,136,50,32,130,98,119,99,45,80,77,77,89,3,45,27,133,41,
+61,61,41,41,61,61,254,203,1,59,64,55,31,12,153,69,123,112,3,179,192,245,98,
+90,87,100,114,92,144,173,71,71,71,71,51,135,44,89,76,109,154,1,53,59,43,43,
+59,59,43,43,59,254,171,0,0,5,252,198,4,210,255,155,7,44,0,11,0,23,0,24,0,
+25,0,26,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,6,35,34,36,39,55,22,22,51,
+50,55,7,3,5,254,245,47,66,66,47,47,66,66,213,78,87,156,254,238,130,125,118,
+191,126,65,52,209,76,254,253,6,244,71,48,49,70,71,48,48,71,254,69,24,187,
+197,81,173,141,19,249,2,90,198,0,3,252,128,4,210,0,160,7,44,0,27,0,28,0,29,
+0,0,1,39,6,35,34,1,55,22,22,51,51,50,55,38,53,52,54,51,50,23,7,38,35,34,6,
+21,20,23,7,1,254,204,14,36,45,230,254,249,125,116,172,82,18,8,8,7,171,145,
+119,99,45,80,77,79,90,49,196,254,119,5,7,31,5,1,128,81,167,147,1,48,32,138,
+153,51,135,44,94,81,91,115,79,1,148,0,0,4,252,128,4,210,0,160,7,44,0,27,0,
+39,0,40,0,41,0,0,1,39,6,35,34,1,55,22,22,51,51,50,55,38,53,52,54,51,50,23,
+7,38,35,34,6,21,20,23,19,50,22,21,20,6,35,34,38,53,52,54,1,1,254,204,14,36,
+45,230,254,249,125,116,172,82,18,8,8,7,171,145,119,99,45,80,77,79,90,49,156,
+41,61,61,41,41,61,61,254,201,254,138,5,7,31,5,1,128,81,167,147,1,48,32,138,
+153,51,135,44,94,81,91,115,1,6,59,43,43,59,59,43,43,59,254,171,1,148,0,0,
+3,252,226,4,210,255,229,7,44,0,12,0,24,0,25,0,0,1,38,38,35,34,7,39,54,51,
+50,22,22,23,19,50,22,21,20,6,35,34,38,53,52,54,3,254,155,52,129,106,56,50,
+48,82,83,127,153,103,39,71,47,66,66,47,47,66,66,171,5,33,191,180,19,146,25,
+121,236,166,1,201,71,48,49,70,71,48,48,71,253,232,0,0,2,252,226,4,210,0,105,
+7,44,0,24,0,25,0,0,1,38,38,35,34,7,39,54,51,50,22,23,54,51,50,23,7,38,35,
+34,6,21,21,22,23,7,254,155,52,129,106,56,50,48,82,83,93,121,47,65,194,119,
+99,45,80,77,79,90,28,27,147,5,33,191,180,19,146,25,67,72,139,51,135,44,94,
+81,10,80,116,79,0,3,252,226,4,210,0,105,7,44,0,24,0,36,0,37,0,0,1,38,38,35,
+34,7,39,54,51,50,22,23,54,51,50,23,7,38,35,34,6,21,21,22,23,19,50,22,21,20,
+6,35,34,38,53,52,54,1,254,155,52,129,106,56,50,48,82,83,93,121,47,65,194,
+119,99,45,80,77,79,90,28,27,150,41,61,61,41,41,61,61,255,0,5,33,191,180,19,
+146,25,67,72,139,51,135,44,94,81,10,80,116,1,6,59,43,43,59,59,43,43,59,254,
+171,0,3,252,61,4,210,255,229,7,44,0,25,0,37,0,38,0,0,1,39,7,38,38,35,34,7,
+39,54,51,50,22,23,38,38,35,34,7,39,54,51,50,22,22,23,19,50,22,21,20,6,35,
+34,38,53,52,54,3,254,171,10,80,123,152,90,68,51,48,78,87,111,184,148,39,103,
+107,56,50,48,82,83,113,142,97,35,66,47,66,66,47,47,66,66,171,5,33,43,79,99,
+76,20,144,24,96,130,163,150,19,143,25,111,224,188,1,201,71,48,49,70,71,48,
+48,71,253,232,0,2,252,48,4,210,0,105,7,44,0,38,0,39,0,0,1,39,7,38,38,35,34,
+7,39,54,51,50,22,23,38,38,35,34,7,39,54,51,50,22,23,54,54,51,50,23,7,38,35,
+34,6,21,21,22,23,7,254,158,10,80,123,152,90,68,51,48,78,87,111,184,148,39,
+103,107,56,50,48,82,83,83,119,36,35,128,92,119,99,45,80,77,79,90,26,21,139,
+5,33,43,79,99,76,20,144,24,96,130,163,150,19,143,25,62,61,61,62,51,135,44,
+94,81,5,84,117,79,0,3,252,48,4,210,0,105,7,44,0,38,0,50,0,51,0,0,1,39,7,38,
+38,35,34,7,39,54,51,50,22,23,38,38,35,34,7,39,54,51,50,22,23,54,54,51,50,
+23,7,38,35,34,6,21,21,22,23,19,50,22,21,20,6,35,34,38,53,52,54,1,254,158,
+10,80,123,152,90,68,51,48,78,87,111,184,148,39,103,107,56,50,48,82,83,83,
+119,36,35,128,92,119,99,45,80,77,79,90,26,21,158,41,61,61,41,41,61,61,255,
+0,5,33,43,79,99,76,20,144,24,96,130,163,150,19,143,25,62,61,61,62,51,135,
+44,94,81,5,84,117,1,6,59,43,43,59,59,43,43,59,254,171,255,255,254,229,0,0,
+2,14,7,44,2,34,0,57,0,0,0,3,1,150,2,31,0,0,255,255,254,159,0,0,2,191,7,44,
+2,34,0,57,0,0,0,3,1,151,2,31,0,0,255,255,254,159,0,0,2,191,7,44,2,34,0,57,
+0,0,0,3,1,152,2,31,0,0,255,255,255,1,0,0,2,14,7,44,2,34,0,57,0,0,0,3,1,153,
+2,31,0,0,255,255,255,1,0,0,2,136,7,44,2,34,0,57,0,0,0,3,1,154,2,31,0,0,255,
+255,255,1,0,0,2,136,7,44,2,34,0,57,0,0,0,3,1,155,2,31,0,0,255,255,254,92,
+0,0,2,14,7,44,2,34,0,57,0,0,0,3,1,156,2,31,0,0,255,255,254,79,0,0,2,136,7,
+44,2,34,0,57,0,0,0,3,1,157,2,31,0,0,255,255,254,79,0,0,2,136,7,44,2,34,0,
+57,0,0,0,3,1,158,2,31,0,0,0,3,254,58,4,210,0,80,7,44,0,15,0,27,0,28,0,0,1,
+38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,19,50,22,21,20,6,35,34,38,53,52,
+54,3,254,133,75,171,145,119,99,45,80,77,80,89,71,134,41,61,61,41,41,61,61,
+231,5,15,131,119,138,153,51,135,44,89,77,89,127,1,7,59,43,43,59,59,43,43,
+59,254,171,255,255,0,118,255,236,4,155,7,44,2,34,0,11,0,0,0,3,2,218,2,57,
+0,0,255,255,0,118,255,236,7,11,7,44,2,34,0,12,0,0,0,3,2,217,7,28,0,0,255,
+255,0,90,255,236,4,185,7,44,2,34,0,9,0,0,0,3,0,5,3,50,0,0,255,255,0,90,255,
+236,5,145,7,44,2,34,0,10,0,0,0,3,0,5,2,178,0,0,255,255,0,64,0,0,6,255,7,44,
+2,34,0,7,0,0,0,3,1,150,7,16,0,0,255,255,0,64,0,0,6,255,7,44,2,34,0,7,0,0,
+0,3,1,153,7,16,0,0,255,255,0,64,0,0,6,255,7,44,2,34,0,7,0,0,0,3,1,156,7,16,
+0,0,255,255,0,64,0,0,9,30,7,44,2,34,0,8,0,0,0,3,1,150,9,47,0,0,255,255,0,
+64,0,0,9,30,7,44,2,34,0,8,0,0,0,3,1,153,9,47,0,0,255,255,0,64,0,0,9,30,7,
+44,2,34,0,8,0,0,0,3,1,156,9,47,0,0,0,4,0,67,255,236,8,63,4,210,0,13,0,25,
+0,75,0,76,0,0,1,50,54,53,52,39,34,39,35,34,6,21,20,22,1,50,54,53,52,38,39,
+6,6,21,20,22,1,6,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,39,22,21,20,
+6,6,35,34,38,53,52,54,51,50,4,23,54,36,55,23,17,20,30,2,51,7,35,34,38,38,
+53,19,1,158,93,104,64,10,10,20,132,143,98,3,66,94,96,68,68,119,125,97,2,187,
+125,214,89,90,90,190,165,173,188,149,164,86,198,112,51,87,163,110,159,188,
+246,212,211,1,98,151,126,1,9,138,164,17,36,66,58,16,21,114,138,52,59,2,171,
+101,81,130,95,1,121,103,86,98,253,213,112,108,102,189,87,91,187,119,100,101,
+3,173,66,126,61,117,234,118,173,194,194,154,146,237,129,87,114,26,96,113,
+88,153,84,186,152,158,205,151,152,88,152,63,22,252,123,64,55,31,12,149,69,
+123,112,3,14,0,0,7,0,67,253,220,7,202,4,210,0,13,0,24,0,76,0,77,0,78,0,79,
+0,80,0,0,1,50,54,53,52,39,34,39,35,34,6,21,20,22,1,50,53,52,38,39,6,6,21,
+20,22,1,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,39,22,21,20,6,6,35,34,
+38,53,52,54,51,50,4,23,54,37,51,0,17,20,2,4,35,32,1,55,0,33,32,0,17,52,2,
+1,5,1,1,1,158,93,104,64,10,10,20,132,143,98,3,76,177,69,68,101,96,80,2,10,
+181,102,92,88,176,155,161,172,127,137,87,197,110,52,87,163,110,159,188,246,
+212,204,1,104,147,118,1,25,53,1,50,195,254,151,240,253,237,254,198,147,1,
+10,1,176,1,41,1,76,109,254,186,1,54,254,43,253,34,2,171,101,81,130,95,1,121,
+103,86,98,254,52,198,87,171,83,88,176,97,84,94,3,40,104,71,109,216,124,157,
+175,177,140,125,231,119,78,101,23,92,119,88,153,84,186,152,158,205,137,136,
+87,164,254,150,254,100,229,254,178,174,1,227,90,254,92,1,49,1,23,155,1,60,
+1,69,170,249,180,2,162,0,5,0,153,253,220,6,182,4,210,0,26,0,50,0,77,0,78,
+0,79,0,0,19,23,17,20,30,2,23,30,2,21,20,7,39,54,54,53,52,38,38,39,46,3,53,
+37,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,38,39,1,17,
+23,17,22,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,38,35,34,7,39,54,
+37,1,153,164,9,37,94,115,142,124,40,97,133,27,30,29,107,125,83,131,58,19,
+1,159,64,116,64,82,78,99,95,111,85,51,117,141,161,186,162,158,99,195,77,3,
+112,164,110,119,185,158,157,254,238,125,121,118,194,120,98,97,91,76,95,88,
+53,74,252,177,2,25,4,210,22,253,193,104,74,57,59,51,62,86,81,63,112,117,93,
+31,61,34,36,45,59,52,34,82,78,91,99,161,81,69,123,128,131,130,47,134,58,215,
+191,197,201,107,98,253,129,4,214,22,251,59,23,140,104,124,148,146,148,95,
+134,109,73,68,58,63,44,135,35,209,254,18,0,5,0,153,253,220,6,182,4,210,0,
+26,0,50,0,81,0,82,0,83,0,0,19,23,17,20,30,2,23,30,2,21,20,7,39,54,54,53,52,
+38,38,39,46,3,53,37,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,
+6,35,34,38,39,1,23,17,22,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,38,
+35,34,7,39,54,55,17,5,39,37,1,1,153,164,9,37,94,115,142,124,40,97,133,27,
+30,29,107,125,83,131,58,19,1,159,64,116,64,82,78,99,95,111,85,51,117,141,
+161,186,162,158,99,195,77,3,112,164,110,119,185,158,157,254,238,125,121,118,
+194,120,98,97,91,76,95,88,53,74,87,254,199,102,1,159,252,90,2,46,4,210,22,
+253,193,104,74,57,59,51,62,86,81,63,112,117,93,31,61,34,36,45,59,52,34,82,
+78,91,99,161,81,69,123,128,131,130,47,134,58,215,191,197,201,107,98,2,87,
+22,251,59,23,140,104,124,148,146,148,95,134,109,73,68,58,63,44,135,35,10,
+1,99,212,142,243,254,183,254,18,0,0,3,0,90,253,220,3,201,4,210,0,64,0,65,
+0,66,0,0,19,52,55,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,23,54,
+51,50,23,7,38,35,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,6,
+21,20,22,51,50,54,55,23,6,35,34,38,53,52,55,38,38,1,19,180,110,103,97,204,
+184,51,128,45,28,92,83,118,126,87,89,91,108,81,73,28,58,64,132,157,137,130,
+83,44,7,63,54,55,65,184,157,162,93,73,60,97,87,56,145,139,163,184,97,105,
+113,1,56,150,1,104,152,105,66,155,97,133,166,15,12,147,24,86,75,70,107,44,
+34,13,147,10,121,105,115,117,18,17,30,51,60,69,50,91,110,4,38,130,64,73,24,
+43,144,71,159,132,125,76,46,177,3,224,249,10,0,5,0,60,0,0,5,34,4,210,0,55,
+0,56,0,57,0,58,0,59,0,0,1,20,6,7,30,2,51,51,7,35,34,38,39,6,35,34,38,53,52,
+54,51,50,22,23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,23,54,51,50,22,21,
+20,7,39,54,53,52,38,35,34,7,22,1,35,19,5,3,42,187,164,79,119,115,80,41,18,
+32,153,252,135,29,26,94,94,69,55,51,77,37,139,153,134,120,74,128,73,52,169,
+162,147,204,42,79,94,167,190,228,115,178,108,95,74,63,1,254,232,165,76,2,
+96,3,78,144,222,54,111,114,47,154,175,220,2,58,66,47,57,31,27,31,149,105,
+113,123,29,34,141,72,118,113,33,195,169,238,185,124,131,171,98,115,31,7,1,
+128,253,75,144,0,0,3,0,60,253,220,3,125,4,211,0,48,0,49,0,50,0,0,37,54,54,
+53,52,39,6,7,39,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,7,22,22,21,
+20,6,7,22,22,51,51,7,35,34,38,39,38,38,53,52,54,51,50,22,19,1,1,131,130,134,
+107,101,147,30,200,184,118,111,76,117,81,52,166,165,190,199,131,65,67,173,
+162,89,160,122,41,18,32,150,251,131,129,122,69,55,61,95,22,1,60,130,13,115,
+92,130,86,37,14,156,16,111,103,87,96,27,36,141,73,172,157,168,98,64,155,79,
+137,181,29,122,121,154,170,213,1,58,75,47,57,46,4,37,249,10,0,0,4,0,105,253,
+220,4,197,4,210,0,52,0,53,0,54,0,55,0,0,1,34,6,21,20,22,23,7,38,2,53,52,54,
+55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,23,7,6,6,21,20,22,
+51,50,54,55,23,6,35,34,38,53,52,54,55,38,1,3,1,2,144,175,208,159,167,85,198,
+211,105,103,103,199,177,115,92,30,83,86,106,113,84,97,103,236,181,66,121,
+119,92,71,57,94,81,56,140,137,151,176,130,123,84,254,238,131,2,103,2,130,
+194,164,140,209,74,134,91,1,39,178,127,206,69,103,139,132,167,25,147,22,84,
+77,95,67,28,136,150,19,89,75,61,69,26,41,144,71,159,130,103,145,31,32,2,80,
+249,10,4,167,0,0,7,0,77,252,218,4,6,4,210,0,60,0,61,0,62,0,63,0,64,0,65,0,
+66,0,0,19,37,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,20,22,23,37,23,5,
+22,22,21,20,6,35,35,34,39,30,2,51,51,7,35,34,38,39,38,38,53,52,54,51,50,22,
+23,22,51,50,54,53,52,38,38,39,5,1,3,35,19,1,55,77,1,29,76,76,196,162,128,
+110,30,68,77,46,99,108,75,76,1,165,66,254,182,129,113,206,191,24,12,13,47,
+74,71,67,48,16,32,133,206,109,104,100,61,47,55,94,45,57,78,113,121,41,107,
+100,254,134,2,26,28,205,203,1,36,96,2,65,102,59,134,75,128,159,27,149,17,
+9,79,73,52,96,44,157,144,114,85,164,99,138,173,1,55,54,21,144,125,162,13,
+83,59,45,55,58,54,12,87,82,45,79,97,62,145,254,80,4,210,248,8,5,106,169,0,
+0,7,0,65,252,218,4,5,4,210,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,0,37,50,54,
+53,52,38,39,3,39,19,39,5,39,37,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,
+20,22,23,37,23,5,22,22,21,20,6,35,34,39,30,2,51,51,7,35,34,38,39,38,38,53,
+52,54,51,50,22,23,22,19,19,3,1,5,1,2,39,113,121,92,85,206,133,226,1,254,129,
+46,1,31,59,58,196,162,128,110,30,68,77,46,99,108,58,58,1,200,54,254,162,146,
+128,206,191,33,41,52,78,72,57,48,16,32,133,208,107,104,100,61,47,55,93,45,
+65,214,3,188,1,206,252,251,2,28,125,87,82,65,114,60,254,235,87,1,9,1,123,
+149,79,53,117,63,128,159,27,149,17,9,79,73,45,85,40,138,145,93,91,174,106,
+138,173,2,61,53,17,144,129,158,13,83,59,45,55,57,53,14,4,85,251,46,4,210,
+254,30,118,250,96,255,255,0,67,254,118,8,63,4,210,2,34,1,179,0,0,0,3,0,55,
+6,135,0,0,255,255,0,67,253,220,7,202,4,210,2,34,1,180,0,0,0,3,0,55,3,229,
+255,175,255,255,0,153,253,220,6,182,4,210,2,34,1,181,0,0,0,3,0,55,3,199,0,
+0,255,255,0,153,253,220,6,182,4,210,2,34,1,182,0,0,0,3,0,55,3,199,0,0,255,
+255,0,54,253,220,3,201,4,210,2,34,1,183,0,0,0,3,0,55,2,182,255,213,255,255,
+0,60,255,10,5,34,4,210,2,34,1,184,0,0,0,3,0,55,3,166,0,148,255,255,0,60,253,
+220,3,125,4,211,2,34,1,185,0,0,0,3,0,55,3,16,255,158,255,255,0,105,253,220,
+4,197,4,210,2,34,1,186,0,0,0,3,0,55,3,12,255,147,255,255,0,77,252,218,4,6,
+4,210,2,34,1,187,0,0,0,3,0,55,2,238,0,30,255,255,0,65,252,218,4,5,4,210,2,
+34,1,188,0,0,0,3,0,55,2,238,0,30,0,1,0,13,255,167,5,54,4,210,0,43,0,0,19,
+55,51,50,30,2,21,21,20,22,22,51,50,54,54,53,17,23,21,22,51,50,55,17,23,17,
+35,17,6,35,34,39,6,6,35,34,38,38,53,53,52,38,38,13,16,21,89,114,68,33,43,
+80,60,64,79,35,164,39,78,98,76,164,164,72,102,80,53,32,171,125,124,149,72,
+32,67,4,39,149,39,66,101,98,189,107,93,42,53,92,97,1,11,22,217,63,82,1,212,
+22,250,235,2,162,49,35,116,126,95,155,140,182,79,60,23,0,0,2,0,22,255,167,
+4,121,4,210,0,24,0,28,0,0,1,34,38,39,55,22,22,51,50,54,53,52,38,35,34,7,39,
+54,54,51,50,22,21,20,6,1,23,17,35,1,174,123,201,84,130,65,124,81,92,99,115,
+114,114,108,52,59,153,72,183,201,178,1,125,164,164,1,108,128,128,89,101,94,
+139,134,149,150,56,138,30,36,231,219,208,212,3,102,22,250,235,0,0,1,0,90,
+255,167,4,53,4,210,0,42,0,0,1,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,
+38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,
+35,3,145,154,197,180,212,62,142,184,157,101,90,28,84,61,95,99,98,77,101,49,
+75,24,42,62,91,101,120,106,101,172,79,164,164,1,73,110,174,142,114,77,104,
+148,112,144,22,145,19,64,60,93,58,30,12,146,10,79,74,82,91,76,79,2,200,22,
+250,235,0,1,0,64,255,167,4,135,4,210,0,42,0,0,1,6,6,35,34,38,39,35,34,38,
+53,52,51,50,23,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,22,51,
+50,54,55,17,23,17,35,3,227,80,155,93,133,199,67,28,84,85,113,93,71,96,113,
+114,120,47,114,43,55,54,142,69,187,205,155,132,84,143,92,153,89,164,164,1,
+120,61,47,108,109,61,55,106,71,30,132,82,99,107,26,19,139,24,30,188,169,120,
+194,46,101,63,92,2,151,22,250,235,0,1,0,22,255,167,4,199,4,210,0,36,0,0,1,
+6,35,34,39,6,6,35,34,3,55,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,
+22,23,22,51,50,55,17,23,17,35,4,35,82,122,51,36,20,170,151,236,169,130,65,
+124,81,92,99,115,113,114,109,52,59,153,72,168,198,12,32,48,126,81,164,164,
+2,213,46,7,161,161,1,0,89,101,94,139,134,149,150,56,138,30,36,202,194,10,
+71,1,79,22,250,235,0,0,5,0,153,253,220,5,209,4,210,0,26,0,50,0,54,0,55,0,
+56,0,0,19,23,17,20,30,2,23,30,2,21,20,7,39,54,54,53,52,38,38,39,46,3,53,37,
+22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,38,39,1,23,17,
+35,1,1,153,164,10,43,122,159,139,132,45,97,133,27,30,44,117,110,152,140,60,
+18,1,159,64,116,64,82,78,99,95,111,85,51,117,141,161,186,162,158,99,195,77,
+3,112,164,164,252,109,1,142,4,210,22,253,193,108,74,59,71,67,59,101,96,64,
+112,117,93,31,61,34,42,64,68,46,62,85,85,91,95,161,81,69,123,128,131,130,
+47,134,58,215,191,197,201,107,98,2,87,22,250,235,1,10,253,43,0,2,0,89,255,
+167,3,211,4,210,0,21,0,22,0,0,1,35,34,6,6,21,20,22,23,7,38,38,53,52,54,54,
+51,33,17,23,17,35,1,3,47,239,126,121,72,139,147,111,189,154,88,185,188,1,
+9,164,164,254,137,2,226,31,84,65,92,202,130,110,168,253,126,86,144,85,1,92,
+22,250,235,1,5,0,0,3,0,86,255,167,4,62,4,210,0,40,0,41,0,42,0,0,1,6,6,35,
+34,38,39,54,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,21,20,
+6,7,22,22,51,50,54,55,17,23,17,35,1,19,3,154,84,173,102,173,238,66,207,207,
+69,57,58,68,44,48,95,155,154,129,136,151,175,182,40,126,86,106,176,85,164,
+164,253,68,120,1,156,62,51,177,177,56,160,107,56,64,51,43,42,55,24,111,86,
+150,99,129,149,114,129,195,75,63,62,69,83,2,123,22,250,235,2,82,1,157,0,0,
+1,0,90,255,167,4,23,5,44,0,38,0,0,1,6,35,34,38,53,52,55,38,53,52,54,55,23,
+6,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,35,3,
+115,140,184,178,211,63,143,166,165,60,109,117,97,77,102,49,75,24,42,62,91,
+101,119,105,93,152,79,164,164,1,57,94,174,142,116,76,108,150,115,173,51,148,
+30,100,76,99,60,30,12,146,10,79,74,82,91,59,74,2,222,22,250,235,0,1,0,49,
+255,167,3,157,4,210,0,16,0,0,1,33,21,20,6,35,34,38,38,53,52,51,33,17,23,17,
+35,2,249,254,143,56,49,48,114,76,124,2,76,164,164,2,160,117,57,60,88,130,
+56,108,1,158,22,250,235,0,0,1,0,13,255,167,3,201,4,210,0,29,0,0,1,6,35,34,
+38,38,53,53,52,38,38,35,55,51,50,30,2,21,21,20,22,51,50,54,55,17,23,17,35,
+3,37,119,145,103,155,93,32,67,78,16,21,89,114,68,33,93,111,62,129,56,164,
+164,1,151,78,81,158,149,184,79,60,23,149,39,66,101,98,176,145,110,56,52,2,
+137,22,250,235,0,0,1,0,90,255,167,5,30,4,210,0,34,0,0,1,6,35,34,39,6,6,35,
+34,38,53,52,18,55,23,4,17,20,22,51,50,54,54,53,53,23,21,22,51,50,55,17,23,
+17,35,4,122,72,102,93,57,41,178,126,174,213,221,220,47,254,192,121,101,77,
+98,36,164,39,78,98,76,164,164,2,3,49,47,101,103,228,188,183,1,1,69,149,96,
+254,245,128,137,69,119,110,161,22,217,63,82,2,26,22,250,235,0,2,0,93,255,
+167,5,182,4,210,0,41,0,42,0,0,1,33,21,20,6,35,34,38,38,53,52,54,51,51,53,
+52,38,38,35,34,6,21,20,18,23,7,38,2,53,52,54,51,50,22,22,21,21,33,17,23,17,
+35,1,5,18,254,134,54,45,48,118,79,64,61,55,45,103,85,126,139,149,186,114,
+208,178,237,192,131,180,87,1,122,164,164,253,60,2,88,78,60,68,87,127,50,43,
+47,13,118,133,74,168,135,147,254,248,161,111,183,1,65,182,200,248,111,194,
+156,25,1,230,22,250,235,1,81,0,1,0,88,255,167,4,0,4,210,0,31,0,0,1,33,21,
+20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,55,51,50,30,2,21,17,33,17,
+23,17,35,3,92,254,84,54,45,48,118,79,64,61,55,32,67,78,16,21,89,114,68,33,
+1,172,164,164,1,244,78,60,68,87,127,50,43,47,254,79,60,23,149,39,66,101,98,
+254,251,2,74,22,250,235,0,2,0,29,255,167,3,255,4,210,0,30,0,31,0,0,1,6,6,
+35,34,38,39,36,53,52,38,35,34,7,39,54,51,50,22,21,20,7,22,22,51,50,55,17,
+23,17,35,1,3,91,77,143,83,165,237,65,1,12,101,86,55,49,37,78,74,160,181,223,
+36,134,81,178,131,164,164,253,141,1,169,55,41,178,176,75,166,75,89,11,140,
+17,166,142,205,108,64,72,134,2,111,22,250,235,2,112,0,2,0,90,255,167,4,116,
+4,210,0,17,0,25,0,0,1,6,35,34,0,53,52,0,55,23,6,6,21,20,22,51,50,55,19,17,
+5,39,37,17,23,17,3,74,115,155,221,254,251,1,16,250,41,201,194,166,141,122,
+92,197,254,36,38,2,2,164,1,15,55,1,5,222,198,1,26,55,152,42,196,163,149,166,
+42,254,15,3,41,98,151,103,1,102,22,250,235,0,0,2,0,90,255,167,5,62,4,210,
+0,43,0,44,0,0,1,52,38,38,35,34,6,6,21,21,20,14,2,35,34,38,53,52,18,55,23,
+6,6,21,20,22,51,50,62,2,53,53,52,54,54,51,50,22,22,21,17,35,3,4,154,20,73,
+54,56,72,21,31,89,153,113,182,224,222,219,47,156,164,125,111,62,83,54,25,
+67,142,104,100,138,73,164,135,3,45,88,104,62,62,98,93,47,120,163,124,71,235,
+200,179,1,5,70,149,51,181,136,136,145,35,64,97,98,107,146,142,87,82,139,126,
+252,70,5,43,0,1,0,90,255,167,3,221,4,210,0,28,0,0,1,6,6,35,34,38,53,52,54,
+51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,35,3,57,78,153,94,
+180,230,246,203,43,115,39,27,89,75,138,152,130,112,96,150,82,164,164,1,167,
+52,42,210,167,183,216,13,10,145,18,129,117,109,123,59,77,2,109,22,250,235,
+0,4,0,63,255,167,4,169,4,210,0,43,0,47,0,48,0,49,0,0,1,38,38,53,52,54,51,
+50,22,22,21,20,6,7,22,22,51,51,7,35,34,38,39,6,35,34,53,52,54,51,50,23,54,
+54,53,52,38,35,34,6,21,20,22,23,1,23,17,35,1,3,1,219,173,167,163,140,104,
+175,96,189,163,110,137,107,27,18,32,132,231,125,30,30,181,69,55,92,77,146,
+146,119,95,67,73,126,109,1,244,164,164,253,193,89,2,168,41,150,121,103,139,
+92,176,120,149,234,54,156,99,154,176,201,2,124,47,57,61,35,157,121,113,121,
+59,43,71,77,22,1,161,22,250,235,2,134,1,15,0,3,0,13,255,167,3,221,4,210,0,
+10,0,33,0,34,0,0,1,37,38,39,22,21,21,20,22,51,50,23,6,35,34,38,38,53,53,52,
+38,38,35,55,51,50,23,1,22,23,17,23,17,35,19,3,50,254,252,130,83,9,93,111,
+134,133,127,157,103,155,93,32,66,79,16,21,152,74,1,165,54,74,164,164,38,2,
+74,193,97,72,51,93,72,145,110,56,92,81,158,149,212,62,52,20,149,62,254,201,
+40,62,1,241,22,250,235,2,15,0,0,2,0,63,255,167,4,239,4,210,0,52,0,53,0,0,
+1,6,35,34,39,6,6,7,30,2,51,51,7,35,34,38,39,6,35,34,38,53,52,54,51,50,23,
+54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,7,22,51,50,55,17,23,17,35,1,
+4,75,86,122,91,71,44,134,91,81,120,117,77,41,18,32,154,254,132,31,31,89,92,
+69,55,90,73,131,133,126,114,72,121,66,52,161,157,188,214,5,47,60,131,83,164,
+164,253,200,2,156,53,26,74,106,32,114,115,46,154,177,219,3,58,66,47,57,56,
+35,145,103,113,123,30,33,141,72,203,185,34,30,18,85,1,129,22,250,235,2,118,
+0,2,0,95,255,167,4,251,4,210,0,59,0,71,0,0,1,6,6,35,34,39,6,6,21,20,22,51,
+50,55,38,53,52,54,51,50,22,21,20,7,22,22,51,51,7,35,34,39,6,35,34,38,53,52,
+54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,51,50,55,17,23,17,35,1,54,54,53,
+52,38,35,34,6,21,20,22,4,87,65,171,89,182,145,114,82,124,118,51,36,8,63,54,
+55,65,41,28,88,73,17,17,28,194,101,69,79,182,221,108,124,84,93,173,147,140,
+175,82,93,58,97,206,140,164,164,253,121,78,79,79,72,76,81,80,2,110,29,33,
+63,64,99,65,78,90,14,21,26,51,60,69,50,56,48,63,55,147,187,19,174,135,95,
+147,69,48,142,81,118,146,131,111,75,130,65,14,83,1,187,22,250,235,3,99,43,
+96,53,56,66,67,61,54,98,0,0,1,0,73,255,167,4,195,4,210,0,66,0,0,1,6,35,34,
+39,38,38,35,34,6,21,20,22,23,22,22,21,20,6,7,30,2,51,51,7,35,34,38,39,38,
+53,52,54,51,50,22,23,22,51,50,54,53,52,38,38,39,38,38,53,52,54,51,50,22,22,
+23,30,2,51,50,55,53,23,17,35,4,31,37,61,160,149,81,100,53,66,72,109,130,167,
+156,201,186,33,67,69,74,27,18,32,128,197,88,185,59,49,54,91,44,27,34,117,
+124,46,84,90,177,167,166,142,50,88,82,66,65,65,82,46,53,42,164,164,3,71,7,
+96,51,45,65,56,64,72,24,31,144,121,142,155,8,32,33,12,154,113,127,28,115,
+42,58,53,52,4,76,69,50,62,36,18,33,154,125,117,147,18,36,42,42,33,21,12,242,
+22,250,235,0,255,255,0,13,255,167,5,54,4,210,2,34,1,199,0,0,0,3,2,216,4,111,
+1,89,255,255,0,22,255,167,4,121,4,210,2,34,1,200,0,0,0,3,2,216,4,14,1,118,
+255,255,0,90,255,73,4,53,4,210,2,34,1,201,0,0,0,3,0,55,4,26,0,211,255,255,
+0,64,255,145,4,135,4,210,2,34,1,202,0,0,0,3,0,55,4,37,1,27,255,255,0,22,255,
+167,4,199,4,210,2,34,1,203,0,0,0,3,2,216,4,14,1,118,255,255,0,153,253,220,
+5,209,4,210,2,34,1,204,0,0,0,3,0,55,3,219,0,0,255,255,0,89,254,146,3,211,
+4,210,2,34,1,205,0,0,0,3,0,55,3,236,0,28,255,255,0,86,255,167,4,62,4,210,
+2,34,1,206,0,0,0,3,0,55,3,241,1,49,255,255,0,90,255,73,4,23,5,44,2,34,1,207,
+0,0,0,3,0,55,4,26,0,211,255,255,0,49,255,167,3,157,4,210,2,34,1,208,0,0,0,
+3,2,216,3,155,1,118,255,255,0,13,255,167,3,201,4,210,2,34,1,209,0,0,0,3,0,
+55,3,176,1,65,255,255,0,90,255,167,5,30,4,210,2,34,1,210,0,0,0,3,0,55,4,179,
+1,49,255,255,0,93,255,167,5,182,4,210,2,34,1,211,0,0,0,3,0,55,5,156,1,59,
+255,255,0,88,255,152,4,0,4,210,2,34,1,212,0,0,0,3,0,55,4,16,1,34,255,255,
+0,29,255,167,3,255,4,210,2,34,1,213,0,0,0,3,0,55,3,207,1,65,255,255,0,90,
+255,73,4,116,4,210,2,34,1,214,0,0,0,3,0,55,4,46,0,211,255,255,0,90,255,152,
+5,62,4,210,2,34,1,215,0,0,0,3,0,55,4,123,1,34,255,255,0,90,255,167,3,221,
+4,210,2,34,1,216,0,0,0,3,0,55,3,217,1,65,255,255,0,63,255,10,4,169,4,210,
+2,34,1,217,0,0,0,3,0,55,3,156,0,148,255,255,0,13,255,167,3,221,4,210,2,34,
+1,218,0,0,0,3,0,55,3,175,1,65,255,255,0,63,255,10,4,239,4,210,2,34,1,219,
+0,0,0,3,0,55,3,156,0,148,0,1,0,13,255,167,5,54,4,210,0,47,0,0,1,6,35,34,39,
+6,6,35,34,38,38,53,53,52,38,38,35,55,51,50,30,2,21,21,20,22,22,51,50,54,54,
+53,17,23,21,22,51,50,55,17,23,17,35,17,1,39,1,4,146,72,102,80,53,32,171,125,
+124,149,72,32,67,78,16,21,89,114,68,33,43,80,60,64,79,35,164,39,78,98,76,
+164,164,254,59,102,2,43,2,73,49,35,116,126,95,155,140,182,79,60,23,149,39,
+66,101,98,189,107,93,42,53,92,97,1,11,22,217,63,82,1,212,22,250,235,1,114,
+254,211,142,1,73,0,0,2,0,22,255,167,4,121,4,210,0,24,0,32,0,0,1,34,38,39,
+55,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,1,23,17,35,17,
+1,39,1,1,174,123,201,84,130,65,124,81,92,99,115,114,114,108,52,59,153,72,
+183,201,178,1,125,164,164,254,59,102,2,43,1,108,128,128,89,101,94,139,134,
+149,150,56,138,30,36,231,219,208,212,3,102,22,250,235,1,114,254,211,142,1,
+73,0,0,2,0,90,255,160,4,53,4,210,0,43,0,44,0,0,5,39,37,38,38,53,52,55,38,
+53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,
+51,50,54,55,17,23,17,35,17,5,1,61,102,1,53,169,185,62,142,184,157,101,90,
+28,84,61,95,99,98,77,101,49,75,24,42,62,91,101,120,106,101,172,79,164,164,
+254,207,96,143,186,5,163,134,114,77,104,148,112,144,22,145,19,64,60,93,58,
+30,12,146,10,79,74,82,91,76,79,2,200,22,250,235,1,173,121,0,0,2,0,64,255,
+167,4,135,4,210,0,42,0,43,0,0,1,1,39,37,38,38,39,35,34,38,53,52,51,50,23,
+54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,22,51,50,54,55,17,23,
+17,35,1,3,227,253,136,106,1,88,110,167,56,28,84,85,113,93,71,96,113,114,120,
+47,114,43,55,54,142,69,187,205,155,132,84,143,92,153,89,164,164,254,236,1,
+125,254,87,143,185,7,100,94,61,55,106,71,30,132,82,99,107,26,19,139,24,30,
+188,169,120,194,46,101,63,91,2,152,22,250,235,1,101,0,1,0,22,255,167,4,199,
+4,210,0,40,0,0,1,6,35,34,39,6,6,35,34,3,55,22,22,51,50,54,53,52,38,35,34,
+7,39,54,54,51,50,22,23,22,51,50,55,17,23,17,35,17,1,39,1,4,35,82,122,51,36,
+20,170,151,236,169,130,65,124,81,92,99,115,113,114,109,52,59,153,72,168,198,
+12,32,48,126,81,164,164,254,59,102,2,43,2,213,46,7,161,161,1,0,89,101,94,
+139,134,149,150,56,138,30,36,202,194,10,71,1,79,22,250,235,1,114,254,211,
+142,1,73,0,0,5,0,153,253,220,5,209,4,210,0,26,0,50,0,58,0,59,0,60,0,0,19,
+23,17,20,30,2,23,30,2,21,20,7,39,54,54,53,52,38,38,39,46,3,53,37,22,22,51,
+50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,38,39,1,5,39,37,17,23,
+17,35,1,1,153,164,10,43,122,159,139,132,45,97,133,27,30,44,117,110,152,140,
+60,18,1,159,64,116,64,82,78,99,95,111,85,51,117,141,161,186,162,158,99,195,
+77,3,112,254,199,102,1,159,164,164,254,105,254,68,4,210,22,253,193,108,74,
+59,71,67,59,101,96,64,112,117,93,31,61,34,42,64,68,46,62,85,85,91,95,161,
+81,69,123,128,131,130,47,134,58,215,191,197,201,107,98,254,228,212,142,243,
+2,198,22,250,235,254,53,2,213,0,1,0,23,255,167,3,230,4,210,0,21,0,0,1,1,39,
+1,38,38,35,34,6,7,39,54,54,51,50,22,23,55,17,23,17,35,3,66,253,232,102,1,
+240,70,161,124,68,115,73,58,70,162,74,154,200,135,16,164,164,2,118,254,158,
+143,1,38,102,123,32,40,143,37,46,129,175,9,1,181,22,250,235,0,0,4,0,86,255,
+167,4,62,4,210,0,40,0,41,0,42,0,43,0,0,1,1,39,37,38,38,39,54,54,53,52,38,
+35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,54,55,17,
+23,17,35,1,3,5,3,154,253,126,106,1,95,161,216,62,207,207,69,57,58,68,44,48,
+95,155,154,129,136,151,175,182,40,126,86,106,176,85,164,164,253,209,114,1,
+114,1,156,254,80,143,189,5,167,169,56,160,107,56,64,51,43,42,55,24,111,86,
+150,99,129,149,114,129,195,75,63,62,69,83,2,123,22,250,235,3,239,254,99,206,
+0,2,0,90,255,160,4,23,5,44,0,39,0,40,0,0,1,1,39,37,38,38,53,52,55,38,53,52,
+54,55,23,6,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,
+17,35,1,3,115,253,191,102,1,53,157,186,63,143,166,165,60,109,117,97,77,102,
+49,75,24,42,62,91,101,119,105,93,152,79,164,164,254,234,1,70,254,90,143,186,
+5,167,130,116,76,108,150,115,173,51,148,30,100,76,99,60,30,12,146,10,79,74,
+82,91,59,74,2,222,22,250,235,1,52,0,0,1,0,49,255,167,3,157,4,210,0,20,0,0,
+1,1,39,1,53,33,21,20,6,35,34,38,38,53,52,51,33,17,23,17,35,2,249,254,59,102,
+2,43,254,143,56,49,48,114,76,124,2,76,164,164,1,25,254,211,142,1,73,221,117,
+57,60,88,130,56,108,1,158,22,250,235,0,2,0,13,255,167,3,201,4,210,0,30,0,
+31,0,0,1,1,39,37,46,2,53,53,52,38,38,35,55,51,50,30,2,21,21,20,22,51,50,54,
+55,17,23,17,35,3,3,37,253,169,102,1,112,107,126,49,32,67,78,16,21,89,114,
+68,33,93,111,62,129,56,164,164,225,1,157,254,79,143,221,8,114,142,109,184,
+79,60,23,149,39,66,101,98,176,145,110,56,52,2,137,22,250,235,1,162,0,1,0,
+90,255,167,5,30,4,210,0,38,0,0,1,6,35,34,39,6,6,35,34,38,53,52,18,55,23,4,
+17,20,22,51,50,54,54,53,53,23,21,22,51,50,55,17,23,17,35,17,1,39,1,4,122,
+72,102,93,57,41,178,126,174,213,221,220,47,254,192,121,101,77,98,36,164,39,
+78,98,76,164,164,254,59,102,2,43,2,3,49,47,101,103,228,188,183,1,1,69,149,
+96,254,245,128,137,69,119,110,161,22,217,63,82,2,26,22,250,235,1,114,254,
+211,142,1,67,0,2,0,93,255,167,5,182,4,210,0,45,0,46,0,0,1,33,21,20,6,35,34,
+38,38,53,52,54,51,51,53,52,38,38,35,34,6,21,20,18,23,7,38,2,53,52,54,51,50,
+22,22,21,21,33,17,23,17,35,17,1,39,1,5,5,18,254,134,54,45,48,118,79,64,61,
+55,45,103,85,126,139,149,186,114,208,178,237,192,131,180,87,1,122,164,164,
+254,59,102,2,43,252,243,2,88,78,60,68,87,127,50,43,47,13,118,133,74,168,135,
+147,254,248,161,111,183,1,65,182,200,248,111,194,156,25,1,230,22,250,235,
+1,114,254,211,142,1,73,203,0,0,1,0,88,255,167,4,0,4,210,0,35,0,0,1,33,21,
+20,6,35,34,38,38,53,52,54,51,51,53,52,38,38,35,55,51,50,30,2,21,21,33,17,
+23,17,35,17,1,39,1,3,92,254,84,54,45,48,118,79,64,61,55,32,67,78,16,21,89,
+114,68,33,1,172,164,164,254,59,102,2,43,2,13,78,60,68,87,127,50,43,47,229,
+79,60,23,149,39,66,101,98,236,2,49,22,250,235,1,114,254,211,142,1,73,0,0,
+3,0,29,255,167,3,255,4,210,0,30,0,31,0,32,0,0,1,1,39,37,38,38,39,36,53,52,
+38,35,34,7,39,54,51,50,22,21,20,7,22,22,51,50,55,17,23,17,35,1,5,3,91,253,
+143,102,1,112,147,205,59,1,12,101,86,55,49,37,78,74,160,181,223,36,134,81,
+178,131,164,164,253,133,1,88,1,174,254,62,143,221,7,170,162,75,166,75,89,
+11,140,17,166,142,205,108,64,72,134,2,111,22,250,235,2,112,206,0,0,1,0,90,
+255,167,4,116,4,210,0,30,0,0,1,1,39,55,6,35,34,36,53,52,0,55,23,6,6,21,20,
+22,51,50,55,23,55,17,5,39,37,17,23,17,35,3,208,254,59,102,242,37,54,224,254,
+254,1,14,252,41,203,192,167,140,73,66,38,234,254,36,38,2,2,164,164,1,25,254,
+211,142,143,7,249,213,191,1,15,52,152,40,185,154,141,156,16,110,139,1,13,
+98,151,103,1,102,22,250,235,0,0,2,0,90,255,167,5,62,4,210,0,47,0,48,0,0,1,
+52,38,38,35,34,6,6,21,21,20,14,2,35,34,38,53,52,18,55,23,6,6,21,20,22,51,
+50,62,2,53,53,52,54,54,51,50,22,22,21,17,35,17,1,39,1,3,4,154,20,73,54,56,
+72,21,31,89,153,113,182,224,222,219,47,159,161,125,111,62,83,54,25,67,142,
+104,100,138,73,164,254,59,102,2,43,135,3,45,88,104,62,62,98,93,47,120,163,
+124,71,235,200,179,1,5,70,150,52,181,134,136,145,35,64,97,98,107,146,142,
+87,82,139,126,252,70,1,114,254,211,142,1,73,3,15,0,2,0,90,255,167,3,221,4,
+210,0,28,0,29,0,0,1,1,39,37,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,
+22,51,50,54,55,17,23,17,35,1,3,57,253,183,110,1,78,172,202,246,203,43,115,
+39,27,89,75,138,152,130,112,91,152,85,164,164,254,250,1,180,254,56,134,225,
+8,200,159,183,216,13,10,145,18,129,117,109,123,62,86,2,97,22,250,235,1,162,
+0,4,0,26,255,167,4,245,4,210,0,32,0,44,0,45,0,46,0,0,1,1,39,37,54,55,38,38,
+39,6,5,39,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,23,17,23,17,35,1,
+54,54,53,52,38,35,34,6,21,20,22,23,5,4,81,253,241,102,1,97,43,61,114,202,
+87,133,254,238,97,170,167,100,105,173,139,154,172,71,73,87,227,139,164,164,
+253,159,71,67,81,75,69,87,85,69,2,163,1,173,254,161,142,208,25,29,24,57,34,
+93,170,145,92,99,53,154,93,109,155,148,124,75,124,59,27,57,30,2,132,22,250,
+235,3,82,51,92,55,60,72,73,61,62,94,188,171,0,0,4,0,13,255,167,3,221,4,210,
+0,10,0,34,0,35,0,36,0,0,1,37,38,39,22,21,21,20,22,51,50,23,1,39,37,46,2,53,
+53,52,38,38,35,55,51,50,23,1,22,23,17,23,17,35,19,5,3,50,254,252,130,83,9,
+93,111,134,133,253,147,102,1,112,82,128,70,32,66,79,16,21,152,74,1,165,54,
+74,164,164,58,254,202,2,74,193,97,72,51,93,72,145,110,47,254,62,143,221,10,
+86,144,133,212,62,52,20,149,62,254,201,40,62,1,241,22,250,235,2,15,109,0,
+3,0,63,255,167,5,23,4,210,0,56,0,57,0,58,0,0,1,6,35,34,39,6,6,7,30,2,51,51,
+7,35,34,38,39,6,35,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,7,39,54,
+51,50,22,21,20,7,22,51,50,55,17,23,17,35,17,5,39,37,5,1,4,115,94,136,89,77,
+41,142,100,81,120,117,77,41,18,32,154,254,132,31,31,89,92,69,55,90,73,131,
+133,126,114,72,121,66,52,161,157,188,214,2,53,69,144,92,164,164,254,179,98,
+1,175,253,107,1,131,2,189,56,23,83,120,36,114,115,46,154,177,219,3,58,66,
+47,57,56,35,145,103,113,123,30,33,141,72,203,185,15,17,20,89,1,95,22,250,
+235,2,58,221,138,249,106,254,221,0,6,0,105,253,220,4,146,4,210,0,43,0,44,
+0,45,0,46,0,47,0,48,0,0,37,52,39,1,39,1,38,35,34,6,21,20,22,23,7,38,2,53,
+52,54,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,22,21,17,
+35,53,1,35,1,1,3,238,14,254,75,102,1,221,82,177,184,214,159,167,85,198,211,
+109,103,107,199,177,115,92,30,83,86,106,113,88,101,117,163,218,108,164,254,
+202,185,2,38,253,224,235,118,68,254,218,142,1,26,90,196,161,140,209,74,134,
+91,1,39,178,125,206,67,103,143,132,167,25,147,22,84,77,98,68,32,113,206,178,
+254,131,89,4,210,252,193,252,73,0,3,0,95,255,167,5,75,4,210,0,10,0,74,0,75,
+0,0,1,54,53,52,38,35,34,6,21,20,22,5,6,35,34,39,6,6,21,20,22,51,50,55,38,
+53,52,54,51,50,22,21,20,7,22,22,51,51,7,35,34,39,6,35,34,38,53,52,54,55,38,
+38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,55,17,23,17,35,17,5,39,37,3,1,
+208,157,79,72,76,81,80,3,30,151,240,198,143,114,82,112,102,56,21,10,63,54,
+55,65,38,27,85,74,17,17,28,191,101,57,75,171,211,108,124,84,93,173,147,140,
+175,82,93,33,107,28,246,167,164,164,254,253,102,1,105,182,3,10,87,105,56,
+66,67,61,54,98,182,70,63,64,99,65,77,91,8,27,26,51,60,69,50,63,47,57,55,147,
+182,14,173,136,95,147,69,48,142,81,118,146,131,111,75,130,65,7,7,90,1,180,
+22,250,235,1,178,182,142,210,254,154,0,0,1,0,73,255,167,4,225,4,210,0,70,
+0,0,1,6,35,34,39,38,38,35,34,6,21,20,22,23,22,22,21,20,6,7,30,2,51,51,7,35,
+34,38,39,38,53,52,54,51,50,22,23,22,51,50,54,53,52,38,38,39,38,38,53,52,54,
+51,50,22,22,23,30,2,51,50,55,53,23,17,35,53,5,39,37,4,61,49,79,160,149,81,
+100,53,66,72,109,130,167,156,200,188,30,61,71,66,13,18,13,121,195,85,186,
+59,49,54,91,44,27,34,117,124,46,84,90,177,167,166,142,50,88,82,66,65,65,82,
+46,72,53,164,164,254,254,102,1,104,3,77,13,96,51,45,65,56,64,72,24,31,144,
+121,142,156,8,28,34,14,154,117,123,27,116,42,58,53,52,4,76,69,50,62,36,18,
+33,154,125,117,147,18,36,42,42,33,21,22,232,22,250,235,250,181,142,209,255,
+255,0,13,254,118,5,54,4,210,2,34,1,243,0,0,0,3,0,55,4,181,0,0,255,255,0,22,
+254,118,4,121,4,210,2,34,1,244,0,0,0,3,0,55,4,58,0,0,255,255,0,90,254,118,
+4,53,4,210,2,34,1,245,0,0,0,3,0,55,4,33,0,0,255,255,0,64,254,118,4,135,4,
+210,2,34,1,246,0,0,0,3,0,55,4,58,0,0,255,255,0,22,254,118,4,199,4,210,2,34,
+1,247,0,0,0,3,0,55,4,68,0,0,255,255,0,153,253,220,5,209,4,210,2,34,1,248,
+0,0,0,3,0,55,3,219,0,0,255,255,0,23,255,143,3,230,4,210,2,34,1,249,0,0,0,
+3,0,55,3,232,1,25,255,255,0,86,254,118,4,62,4,210,2,34,1,250,0,0,0,3,0,55,
+4,18,0,0,255,255,0,90,254,118,4,23,5,44,2,34,1,251,0,0,0,3,0,55,4,16,0,0,
+255,255,0,49,254,118,3,157,4,210,2,34,1,252,0,0,0,3,0,55,3,213,0,0,255,255,
+0,13,254,118,3,201,4,210,2,34,1,253,0,0,0,3,0,55,3,243,0,0,255,255,0,90,254,
+118,5,30,4,210,2,34,1,254,0,0,0,3,0,55,4,128,0,0,255,255,0,93,254,118,5,182,
+4,210,2,34,1,255,0,0,0,3,0,55,4,228,0,0,255,255,0,88,254,118,4,0,4,210,2,
+34,2,0,0,0,0,3,0,55,4,16,0,0,255,255,0,29,254,118,3,255,4,210,2,34,2,1,0,
+0,0,3,0,55,3,254,0,0,255,255,0,90,254,118,4,116,4,210,2,34,2,2,0,0,0,3,0,
+55,4,32,0,0,255,255,0,90,254,118,5,62,4,210,2,34,2,3,0,0,0,3,0,55,4,158,0,
+0,255,255,0,90,254,118,3,221,4,210,2,34,2,4,0,0,0,3,0,55,3,204,0,0,255,255,
+0,26,254,118,4,245,4,210,2,34,2,5,0,0,0,3,0,55,4,39,0,0,255,255,0,13,254,
+118,3,221,4,210,2,34,2,6,0,0,0,3,0,55,3,254,0,0,255,255,0,63,254,118,5,23,
+4,210,2,34,2,7,0,0,0,3,0,55,4,161,0,0,255,255,0,105,253,220,4,146,4,210,2,
+34,2,8,0,0,0,3,0,55,3,12,255,147,0,2,0,37,255,167,7,125,4,210,0,72,0,73,0,
+0,1,6,6,35,34,38,39,35,34,39,22,22,21,20,6,35,32,39,55,22,51,50,53,52,38,
+38,39,5,39,37,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,20,22,23,33,54,53,
+52,38,35,34,7,39,54,51,50,22,21,20,7,22,22,51,50,55,17,23,17,35,1,6,217,77,
+143,83,145,214,69,143,99,58,108,98,206,191,254,235,217,92,185,207,239,41,
+107,100,254,134,57,1,29,76,76,196,162,128,110,30,68,77,46,99,108,76,76,2,
+83,126,101,86,55,49,37,78,74,160,181,223,36,134,81,178,131,164,164,249,215,
+1,169,55,41,132,133,9,70,147,95,138,173,169,128,147,164,45,79,97,62,145,145,
+102,59,134,75,128,159,27,149,17,9,79,73,52,96,45,70,115,75,89,11,140,17,166,
+142,205,108,64,72,134,2,111,22,250,235,2,157,0,3,0,22,255,167,4,171,4,210,
+0,24,0,44,0,45,0,0,1,34,38,39,55,22,22,51,50,54,53,52,38,35,34,7,39,54,54,
+51,50,22,21,20,6,5,5,23,22,21,20,6,35,34,38,38,53,52,54,55,1,17,23,17,35,
+1,1,174,123,201,84,130,65,124,81,91,100,117,112,114,108,52,59,153,72,180,
+204,185,1,182,254,199,47,21,71,56,63,131,71,52,56,2,17,164,164,254,221,1,
+168,128,128,89,101,94,123,121,134,134,56,138,30,36,218,201,192,199,35,180,
+73,33,36,43,59,61,87,41,34,52,30,1,25,2,171,22,250,235,1,180,0,6,0,19,255,
+167,7,131,4,210,0,36,0,48,0,80,0,81,0,82,0,83,0,0,1,38,35,34,6,21,20,22,22,
+23,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,39,38,38,53,52,54,
+51,50,23,23,50,22,21,20,6,35,34,38,53,52,54,1,6,6,35,34,38,39,54,54,53,52,
+38,38,35,35,53,51,50,22,22,21,20,7,22,22,51,50,55,17,23,17,35,9,2,3,2,80,
+107,88,101,37,78,106,176,130,211,178,152,253,108,143,85,174,114,102,116,107,
+153,143,121,193,164,123,91,18,50,68,69,49,49,69,68,3,223,77,143,83,165,237,
+65,135,133,52,93,100,158,167,171,148,82,223,36,134,81,178,131,164,164,251,
+101,254,119,3,193,4,42,20,70,63,42,60,61,65,108,176,127,151,183,152,165,87,
+130,124,95,83,87,122,90,85,155,109,125,153,23,228,65,50,50,66,66,50,50,65,
+253,210,55,41,178,176,38,116,82,58,66,22,147,70,126,97,200,106,64,72,134,
+2,111,22,250,235,2,154,254,171,1,43,0,2,0,90,255,167,9,189,4,210,0,92,0,93,
+0,0,1,6,6,35,34,38,39,54,54,53,52,38,38,35,35,22,21,20,2,4,35,34,38,53,52,
+55,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,54,51,50,23,7,38,35,34,
+6,21,20,33,50,36,18,53,52,38,35,34,6,21,20,22,23,7,36,17,52,54,51,50,22,23,
+51,50,22,22,21,20,7,22,22,51,50,55,17,23,17,35,1,9,25,77,143,83,164,238,65,
+138,130,50,91,104,165,19,193,254,154,233,224,248,104,99,95,185,156,101,90,
+28,84,61,92,102,85,85,84,103,25,55,19,29,30,122,147,1,47,183,1,25,156,96,
+92,68,79,145,143,51,254,113,161,138,90,147,47,237,169,153,79,223,36,135,80,
+178,131,164,164,253,160,1,89,55,41,167,165,38,108,76,54,60,23,81,96,194,254,
+141,218,206,174,155,103,66,160,101,125,164,22,147,19,81,70,77,108,43,31,4,
+148,2,118,106,232,176,1,49,152,158,165,83,59,107,116,28,147,106,1,27,132,
+167,76,71,67,116,92,188,99,61,67,134,2,191,22,250,235,2,10,0,3,0,22,255,167,
+5,174,4,210,0,56,0,57,0,58,0,0,37,6,35,34,38,39,5,39,1,23,7,6,6,21,20,22,
+51,50,55,17,6,6,35,34,39,6,6,35,34,3,55,22,22,51,50,54,53,52,35,34,7,39,54,
+54,51,50,22,23,22,51,50,54,55,53,23,17,35,3,1,5,10,97,130,138,168,6,254,232,
+100,2,134,82,69,55,64,82,71,135,91,59,143,110,106,100,14,187,144,236,169,
+130,65,124,81,92,99,228,114,109,52,59,153,72,150,194,26,85,120,104,153,64,
+164,164,158,253,155,80,60,157,143,219,135,1,172,125,44,35,81,66,71,76,95,
+2,49,30,33,28,161,162,1,0,89,101,94,114,111,247,56,138,30,36,149,141,36,45,
+46,235,22,250,235,2,93,254,84,0,0,1,0,22,255,167,5,174,4,210,0,59,0,0,1,35,
+34,39,22,21,20,6,35,32,3,55,22,22,51,50,53,52,38,39,55,33,53,6,6,35,34,39,
+6,6,35,34,3,55,22,22,51,50,54,53,52,35,34,7,39,54,54,51,50,22,23,22,51,50,
+54,55,53,23,17,35,5,10,180,93,14,96,147,125,254,214,189,144,83,146,90,134,
+69,77,56,1,187,59,143,110,106,100,14,187,144,236,169,130,65,124,81,92,99,
+228,114,109,52,59,153,72,152,192,26,85,120,104,153,64,164,164,1,200,3,100,
+128,120,132,1,83,78,148,121,125,63,103,56,128,220,30,33,28,161,162,1,0,89,
+101,94,114,111,247,56,138,30,36,149,141,36,45,46,235,22,250,235,0,2,0,90,
+255,167,7,31,4,210,0,72,0,73,0,0,1,6,6,35,34,38,39,54,54,53,52,38,38,35,35,
+14,2,7,14,2,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,54,55,62,2,53,52,
+38,35,34,6,7,39,54,51,50,22,23,51,50,22,22,21,20,6,7,22,22,51,50,55,17,23,
+17,35,1,6,123,77,143,83,164,238,65,138,130,50,91,104,79,4,50,99,115,120,130,
+57,135,114,92,163,86,76,114,192,115,183,230,54,128,142,116,97,42,89,84,79,
+117,52,52,148,156,113,153,39,116,169,153,79,112,111,36,135,80,178,131,164,
+164,253,151,1,89,55,41,167,165,38,108,76,54,60,23,60,100,88,62,65,90,95,64,
+83,103,49,54,145,60,48,200,151,73,125,122,78,62,65,61,40,64,65,28,26,138,
+64,74,73,67,116,92,94,144,49,61,67,134,2,191,22,250,235,2,10,0,3,0,90,255,
+167,7,29,4,210,0,40,0,69,0,70,0,0,1,23,6,4,35,34,38,53,52,54,54,55,62,2,53,
+52,38,35,34,6,7,39,54,51,50,22,21,20,6,6,7,14,2,21,20,22,51,50,54,37,6,6,
+35,34,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,
+35,1,3,177,130,140,254,239,159,189,224,54,128,142,116,97,42,89,84,79,117,
+52,52,148,156,160,174,58,109,102,120,130,57,125,107,125,211,3,63,78,153,94,
+180,230,246,203,43,115,39,27,89,75,138,152,130,112,96,150,82,164,164,253,
+89,1,121,100,161,136,198,153,73,125,122,78,62,65,61,40,64,65,28,26,138,64,
+148,126,73,115,87,55,65,90,95,64,83,103,111,182,52,42,210,167,183,216,13,
+10,145,18,129,117,109,123,59,77,2,109,22,250,235,1,62,0,4,0,90,255,167,7,
+192,4,210,0,28,0,41,0,73,0,74,0,0,1,38,35,34,6,21,20,22,23,22,22,21,20,6,
+35,34,38,53,52,54,55,38,38,53,52,54,51,50,23,3,35,34,6,21,20,22,51,50,54,
+53,52,38,5,6,6,35,34,38,39,54,54,53,52,38,38,35,35,53,51,50,22,22,21,20,7,
+22,22,51,50,55,17,23,17,35,1,3,50,81,115,79,82,83,128,180,142,241,211,214,
+238,193,178,83,82,172,150,133,97,222,13,157,198,146,135,135,152,91,4,61,77,
+143,83,165,237,65,135,133,52,93,100,180,189,171,148,82,223,36,134,81,178,
+131,164,164,253,177,4,40,22,53,48,48,81,77,110,201,131,164,193,205,174,139,
+201,38,56,126,70,108,137,23,253,184,148,125,108,118,110,104,90,126,133,55,
+41,178,176,38,116,82,58,66,22,147,70,126,97,200,106,64,72,134,2,111,22,250,
+235,2,112,0,0,5,0,19,255,167,7,91,4,210,0,36,0,68,0,69,0,70,0,71,0,0,1,38,
+35,34,6,21,20,22,22,23,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,
+38,39,38,38,53,52,54,51,50,23,1,6,6,35,34,38,39,54,54,53,52,38,38,35,35,53,
+51,50,22,22,21,20,7,22,22,51,50,55,17,23,17,35,9,2,3,2,80,107,88,101,37,78,
+106,176,130,211,178,152,253,108,143,85,174,114,102,116,107,153,143,121,193,
+164,123,91,3,151,77,143,83,165,237,65,135,133,52,93,100,138,147,171,148,82,
+223,36,134,81,178,131,164,164,251,154,254,75,3,191,4,42,20,70,63,42,60,61,
+65,108,176,127,151,183,152,165,87,130,124,95,83,87,122,90,85,155,109,125,
+153,23,252,238,55,41,178,176,38,116,82,58,66,22,147,70,126,97,200,106,64,
+72,134,2,111,22,250,235,2,154,254,171,1,43,0,0,5,0,90,255,167,7,196,4,210,
+0,10,0,84,0,85,0,86,0,87,0,0,37,54,54,53,52,38,35,34,6,21,20,37,6,6,35,34,
+38,39,54,54,53,52,38,38,35,35,6,6,7,6,6,21,20,22,23,38,53,52,54,51,50,22,
+21,20,6,35,34,38,53,52,54,54,55,62,2,53,52,38,35,34,6,7,39,54,51,50,22,23,
+33,50,22,22,21,20,7,22,22,51,50,55,17,23,17,35,1,1,3,2,108,116,125,63,59,
+69,80,4,210,77,143,83,164,238,65,138,130,50,91,104,241,8,138,163,165,107,
+111,107,33,162,130,131,153,233,213,230,250,71,132,127,117,94,42,87,74,87,
+118,54,52,147,158,109,159,37,1,19,169,153,79,223,36,135,80,178,131,164,164,
+253,172,253,112,180,122,5,83,73,58,67,80,69,75,161,55,41,167,165,38,108,76,
+54,60,23,89,147,74,76,121,82,92,114,16,82,78,119,142,144,125,135,166,203,
+170,92,136,105,65,59,59,59,39,55,64,27,27,138,64,76,71,67,116,92,188,99,61,
+67,134,2,191,22,250,235,2,10,254,207,2,138,0,2,0,64,255,167,4,152,4,210,0,
+21,0,22,0,0,1,35,34,6,6,21,20,22,23,7,38,38,53,52,55,5,53,33,17,23,17,35,
+1,3,244,209,126,121,72,137,149,111,185,158,76,254,184,3,180,164,164,254,192,
+2,226,31,84,65,91,201,132,110,165,249,120,117,68,8,151,1,92,22,250,235,1,
+5,0,1,0,80,255,167,4,224,5,96,0,65,0,0,1,33,21,20,6,35,34,38,38,53,52,54,
+51,51,53,6,35,34,38,53,52,54,55,55,62,2,53,52,35,34,7,39,54,51,50,22,21,20,
+6,7,7,6,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,21,33,17,23,17,35,
+4,60,254,151,54,45,47,111,77,64,61,53,66,94,155,172,100,130,61,37,33,19,98,
+88,85,38,116,97,122,136,81,135,47,69,45,81,87,76,50,9,62,55,55,65,44,1,105,
+164,164,1,37,64,60,68,81,121,48,43,45,123,17,137,103,88,112,65,31,19,22,31,
+19,61,28,138,33,108,93,71,103,69,25,37,56,32,49,48,19,21,29,51,60,69,50,66,
+47,194,3,27,22,250,235,0,1,0,90,255,167,4,23,5,96,0,56,0,0,37,6,35,34,38,
+53,52,55,38,53,52,54,55,55,62,2,53,52,35,34,7,39,54,51,50,22,21,20,6,7,7,
+6,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,55,17,23,17,35,3,
+115,140,184,178,211,55,135,100,130,61,37,33,19,98,88,85,38,116,97,122,136,
+82,133,48,66,48,87,79,110,49,75,24,42,62,91,101,119,105,93,152,79,164,164,
+153,94,174,142,107,74,96,139,83,111,65,31,19,22,31,19,61,28,138,33,108,93,
+71,104,68,25,34,59,38,76,53,34,12,146,10,79,74,82,91,59,74,3,126,22,250,235,
+0,2,0,49,255,167,4,25,4,210,0,38,0,39,0,0,1,6,7,7,23,22,22,21,20,6,35,34,
+38,53,52,54,55,37,54,55,53,33,21,20,6,35,34,38,38,53,52,54,54,51,33,17,23,
+17,35,19,3,117,60,44,190,44,23,17,74,68,98,155,30,53,1,72,125,69,254,19,56,
+49,48,114,76,36,62,73,2,153,164,164,41,2,87,56,37,158,54,28,41,28,49,53,107,
+62,30,45,39,246,94,41,24,117,57,60,88,130,56,42,50,16,1,47,22,250,235,2,188,
+0,0,3,0,77,253,220,7,125,4,210,0,92,0,93,0,94,0,0,1,6,6,35,34,38,39,35,34,
+39,22,22,21,20,6,35,35,34,39,30,2,51,51,7,35,34,38,39,38,38,53,52,54,51,50,
+22,23,22,51,50,54,53,52,38,38,39,5,39,37,38,38,53,52,54,51,50,23,7,38,38,
+35,34,6,21,20,22,23,33,54,53,52,38,35,34,7,39,54,51,50,22,21,20,7,22,22,51,
+50,55,17,23,17,35,1,1,6,217,77,143,83,145,214,69,142,89,51,98,90,206,191,
+24,12,13,49,85,93,74,48,18,32,142,228,118,104,100,61,47,55,94,45,57,78,113,
+121,41,107,100,254,134,57,1,29,76,76,196,162,128,110,30,68,77,46,99,108,76,
+76,2,83,126,101,86,55,49,37,78,74,160,181,223,36,134,81,178,131,164,164,249,
+233,2,21,1,169,55,41,132,133,7,73,148,89,138,173,1,59,64,27,154,143,174,13,
+83,59,45,55,58,54,12,87,82,45,79,97,62,145,145,102,59,134,75,128,159,27,149,
+17,9,79,73,52,96,45,70,115,75,89,11,140,17,166,142,205,108,64,72,134,2,111,
+22,250,235,2,157,251,152,0,2,0,90,255,167,7,189,4,210,0,59,0,60,0,0,1,6,6,
+35,34,38,39,36,53,52,38,35,34,14,2,21,21,20,14,2,35,34,38,53,52,18,55,23,
+6,6,21,20,22,51,50,62,2,53,53,52,54,54,51,50,22,21,20,7,22,22,51,50,55,17,
+23,17,35,1,7,25,77,143,83,165,237,65,1,12,103,94,73,78,58,27,35,91,150,110,
+182,224,222,219,47,156,164,125,111,62,83,54,25,80,181,140,168,193,223,36,
+134,81,178,131,164,164,253,162,1,169,55,41,178,176,75,166,77,87,34,65,115,
+94,37,111,157,119,67,235,200,179,1,5,70,149,51,181,136,136,145,35,64,97,98,
+64,158,176,106,170,138,205,108,64,72,134,2,111,22,250,235,2,112,0,0,4,0,26,
+255,167,6,56,4,210,0,48,0,60,0,61,0,62,0,0,37,6,35,34,38,39,5,39,55,54,55,
+38,38,39,6,5,39,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,23,55,23,7,
+6,6,21,20,22,51,50,55,17,23,17,35,1,54,54,53,52,38,35,34,6,21,20,22,23,5,
+5,148,97,130,137,168,7,254,212,99,169,67,59,64,127,64,133,254,238,97,170,
+167,100,105,173,139,154,172,71,73,39,143,104,217,82,69,55,64,82,71,135,91,
+164,164,252,92,71,67,81,75,69,87,85,77,1,232,186,60,155,139,227,135,112,44,
+33,16,40,24,93,170,145,92,99,53,154,93,109,155,148,124,75,124,59,13,38,25,
+142,125,44,35,81,66,71,76,95,3,99,22,250,235,3,82,51,92,55,60,72,73,61,62,
+94,188,133,0,5,0,26,255,167,4,245,4,210,0,11,0,55,0,56,0,57,0,58,0,0,1,54,
+54,53,52,38,35,34,6,21,20,22,1,5,23,22,21,20,6,35,34,38,38,53,52,54,55,37,
+55,38,38,39,6,5,39,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,23,17,23,
+17,35,1,1,5,1,240,71,67,81,75,69,87,85,2,186,254,174,47,21,71,56,63,131,71,
+52,56,1,47,86,111,205,94,133,254,238,97,170,167,100,105,173,139,154,172,71,
+73,87,227,139,164,164,254,174,254,199,2,195,2,249,51,92,55,60,72,73,61,62,
+94,254,122,195,73,33,36,43,59,61,87,41,34,52,30,161,43,22,58,36,93,170,145,
+92,99,53,154,93,109,155,148,124,75,124,59,27,57,30,2,132,22,250,235,1,187,
+1,3,171,0,3,0,26,255,167,7,227,4,210,0,11,0,52,0,60,0,0,1,54,54,53,52,38,
+35,34,6,21,20,22,1,34,38,39,38,39,6,5,39,54,55,38,38,53,52,54,54,51,50,22,
+21,20,6,7,22,51,51,54,0,55,23,6,6,21,20,22,51,50,55,23,6,19,17,5,39,37,17,
+23,17,2,5,61,56,81,75,68,88,97,4,8,187,252,33,243,171,117,254,187,97,197,
+154,110,109,78,142,92,154,172,51,47,106,145,21,12,1,14,239,41,201,194,166,
+141,122,92,63,115,249,254,36,38,2,2,164,3,8,47,86,50,60,72,76,58,63,90,253,
+180,193,175,2,35,85,202,145,106,94,48,146,97,68,124,72,148,124,66,105,47,
+11,187,1,6,52,152,42,196,163,149,166,42,137,55,254,207,3,41,98,151,103,1,
+102,22,250,235,0,2,0,26,255,167,6,55,4,210,0,11,0,62,0,0,1,54,54,53,52,38,
+35,34,6,21,20,22,1,6,35,34,38,53,52,55,38,39,6,5,39,54,55,38,38,53,52,54,
+54,51,50,22,21,20,6,7,22,51,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,
+55,17,23,17,35,2,5,61,56,81,75,68,88,97,3,240,120,167,172,216,41,130,96,105,
+254,173,97,173,178,110,109,78,142,92,154,172,51,47,106,142,95,118,39,106,
+34,27,79,64,120,131,123,103,79,133,72,164,164,3,8,47,86,50,60,72,76,58,63,
+90,253,145,87,183,147,97,73,9,20,78,211,145,92,108,48,146,97,68,124,72,148,
+124,66,105,47,11,42,13,10,145,18,103,95,89,96,53,73,3,98,22,250,235,0,3,0,
+63,255,167,7,139,4,210,0,41,0,42,0,64,0,0,1,6,7,30,2,51,51,7,35,34,38,39,
+6,35,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,
+7,33,21,5,37,1,39,1,38,38,35,34,6,7,39,54,54,51,50,22,23,55,17,23,17,35,2,
+178,87,143,81,120,117,77,41,18,32,154,254,132,31,31,89,92,69,55,90,73,131,
+133,126,114,72,121,66,52,161,157,188,214,15,1,111,253,63,5,57,253,232,102,
+1,240,70,161,124,68,115,73,58,70,162,74,154,200,135,16,164,164,2,73,105,51,
+114,115,46,154,177,219,3,58,66,47,57,56,35,145,103,113,123,30,33,141,72,203,
+185,55,57,149,44,89,254,158,143,1,38,102,123,32,40,143,37,46,129,175,9,1,
+181,22,250,235,0,6,0,105,253,220,4,243,4,210,0,13,0,64,0,65,0,66,0,67,0,68,
+0,0,1,38,35,34,7,21,20,22,22,51,50,54,54,53,1,17,38,39,21,20,6,6,35,34,46,
+2,53,53,7,14,2,21,20,22,23,7,38,2,53,52,54,55,38,53,52,54,51,50,23,7,38,35,
+34,6,21,20,23,54,51,50,4,23,17,9,2,3,3,60,51,92,52,47,18,54,47,52,53,18,1,
+22,47,83,59,118,90,74,107,66,24,8,26,81,50,154,172,85,201,208,96,93,84,199,
+177,115,92,30,83,86,106,113,51,122,141,156,1,21,145,253,227,1,124,253,203,
+28,2,179,4,8,191,74,80,46,45,84,82,253,172,2,212,15,20,186,121,130,68,49,
+96,121,77,130,4,13,85,137,88,153,218,79,134,97,1,43,195,125,204,71,91,126,
+132,167,25,147,22,84,77,74,58,48,52,57,252,205,5,43,251,46,4,210,249,10,0,
+5,0,105,253,220,4,128,4,210,0,51,0,52,0,53,0,54,0,55,0,0,1,35,21,20,6,35,
+34,38,38,53,52,51,33,53,38,38,35,34,6,21,20,22,23,7,38,2,53,52,54,55,38,53,
+52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,23,17,35,9,2,3,3,223,199,
+52,42,43,102,69,111,1,140,79,146,93,185,215,159,167,85,198,211,109,103,107,
+199,177,115,92,30,83,86,106,113,88,101,117,124,219,128,161,254,247,1,9,254,
+62,48,1,54,99,52,51,76,114,49,94,145,29,26,196,161,140,209,74,134,91,1,39,
+178,125,206,67,103,143,132,167,25,147,22,84,77,98,68,32,47,59,252,252,5,43,
+251,46,4,210,249,10,0,0,2,0,105,253,220,5,185,4,210,0,55,0,56,0,0,1,33,21,
+20,6,35,34,38,38,53,52,54,51,51,38,38,35,34,6,6,21,20,22,23,7,38,2,53,52,
+54,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,23,33,17,23,
+17,35,1,5,21,254,226,53,46,46,111,78,61,61,44,6,124,111,90,157,86,159,167,
+85,199,210,104,100,99,199,177,115,92,30,83,86,106,113,77,77,77,181,208,13,
+1,37,164,164,252,166,1,37,64,61,67,82,121,47,42,46,101,101,88,161,108,140,
+209,74,134,92,1,39,177,128,209,69,102,136,132,167,25,147,22,84,77,92,65,23,
+178,172,3,27,22,250,235,254,53,0,0,3,0,105,253,220,5,195,4,210,0,55,0,56,
+0,57,0,0,37,6,6,35,34,38,39,54,54,53,52,35,34,6,21,16,5,7,38,2,53,52,54,55,
+38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,7,22,22,51,50,
+54,55,17,23,17,35,1,1,5,31,65,118,77,149,220,56,116,113,191,175,216,1,70,
+85,199,210,95,91,81,199,177,115,92,30,83,86,106,113,48,110,131,164,190,189,
+35,118,72,73,124,60,164,164,252,193,1,62,132,43,34,172,162,32,89,62,119,203,
+177,254,212,150,134,97,1,53,185,127,207,70,90,123,132,167,25,147,22,84,77,
+72,56,44,142,126,157,92,57,62,50,60,3,153,22,250,235,254,53,3,21,0,0,6,0,
+105,253,220,4,218,4,210,0,18,0,61,0,62,0,63,0,64,0,65,0,0,1,6,6,21,20,22,
+51,50,54,55,23,6,35,34,38,53,52,54,55,19,5,39,37,53,38,38,35,34,6,21,20,22,
+23,7,38,2,53,52,54,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,
+4,23,17,35,9,2,19,3,98,129,124,104,92,49,63,34,50,83,115,158,185,189,176,
+252,254,216,35,1,75,114,162,120,193,219,154,172,85,201,208,96,93,84,199,177,
+115,92,30,83,86,106,113,51,122,141,149,1,9,139,161,254,157,1,99,253,228,68,
+1,236,21,103,86,74,82,9,11,125,28,160,140,125,176,33,254,178,62,134,68,198,
+37,23,207,173,153,218,79,134,97,1,43,195,125,204,71,91,126,132,167,25,147,
+22,84,77,74,58,48,51,58,252,205,5,43,251,46,4,210,249,10,0,0,5,0,105,253,
+220,4,158,4,210,0,60,0,61,0,62,0,63,0,64,0,0,37,6,35,34,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,22,51,50,55,17,38,38,35,34,6,21,20,22,23,7,38,2,53,
+52,54,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,23,17,35,
+9,2,3,3,253,104,136,142,173,170,141,89,73,12,69,59,88,88,86,79,133,100,109,
+142,85,193,219,154,172,85,201,208,96,93,84,199,177,115,92,30,83,86,106,113,
+51,122,141,121,232,140,161,254,217,1,39,254,32,153,98,62,149,122,118,145,
+21,136,20,68,60,64,68,103,1,99,37,23,207,173,153,218,79,134,97,1,43,195,125,
+204,71,91,126,132,167,25,147,22,84,77,74,58,48,49,60,252,205,5,43,251,46,
+4,210,249,10,0,6,0,19,253,220,4,11,4,210,0,34,0,46,0,47,0,48,0,49,0,50,0,
+0,1,38,35,34,21,20,22,23,22,22,21,20,6,35,34,36,39,55,22,22,51,50,53,52,38,
+39,46,2,53,52,54,51,50,23,23,50,22,21,20,6,35,34,38,53,52,54,39,3,3,19,2,
+243,96,95,161,68,131,162,144,188,163,149,254,248,125,137,93,199,114,178,93,
+93,102,140,74,175,147,139,87,131,50,68,69,49,49,69,68,241,94,91,104,4,43,
+19,81,36,55,53,66,148,113,115,138,137,147,94,114,116,109,62,75,37,41,82,100,
+76,100,123,19,174,65,50,50,66,66,50,50,65,193,251,46,4,210,249,10,0,0,5,0,
+90,253,220,5,133,4,210,0,56,0,57,0,58,0,59,0,60,0,0,1,38,35,34,6,21,20,23,
+54,51,50,23,7,38,35,34,6,21,20,33,50,36,54,53,52,38,35,34,6,21,20,23,7,36,
+17,52,54,51,50,22,21,20,2,4,35,34,38,53,52,55,38,53,52,54,51,50,23,37,1,19,
+3,2,82,84,61,95,99,102,93,115,61,42,19,30,56,106,112,1,47,184,1,14,146,98,
+82,62,73,255,47,254,142,161,138,157,186,185,254,167,231,225,247,58,148,184,
+157,101,90,1,186,254,149,178,223,4,43,19,64,60,96,57,39,5,147,2,78,73,156,
+122,222,134,109,110,60,48,141,51,140,74,1,3,111,142,198,183,162,254,225,163,
+170,148,93,70,104,152,112,144,22,22,251,46,4,210,249,10,0,7,0,67,0,0,6,249,
+4,212,0,34,0,47,0,59,0,60,0,61,0,62,0,63,0,0,1,54,37,23,6,7,22,22,21,20,6,
+35,34,38,53,52,54,55,38,38,39,22,21,20,6,6,35,34,38,53,52,54,51,50,4,5,39,
+38,6,6,21,20,22,51,50,54,53,52,5,6,6,21,20,22,51,50,54,53,52,38,19,35,3,1,
+4,214,168,1,56,67,250,182,84,85,190,171,172,183,147,150,84,191,108,54,87,
+163,110,159,188,246,212,207,1,101,253,226,20,75,140,80,98,84,93,104,2,97,
+116,130,95,95,90,100,67,125,145,161,2,85,3,227,95,146,140,109,95,86,178,92,
+153,165,160,142,112,196,89,60,79,18,96,120,88,153,84,186,152,158,205,120,
+24,1,4,44,108,76,86,98,101,81,131,176,65,138,90,78,83,90,85,75,140,1,222,
+251,46,4,64,0,0,6,0,90,253,220,3,156,4,210,0,35,0,36,0,37,0,38,0,39,0,40,
+0,0,1,23,6,6,35,34,38,53,52,54,54,55,54,54,53,52,38,35,34,7,39,54,51,50,22,
+21,20,6,7,6,6,21,20,22,51,50,11,2,19,19,3,78,78,125,200,112,183,214,67,141,
+136,124,82,75,78,114,110,52,139,151,145,159,138,176,137,96,118,117,184,101,
+110,75,77,66,2,23,146,63,45,149,122,79,101,83,50,46,52,48,40,35,38,138,48,
+116,102,104,130,59,46,71,57,58,62,3,37,251,46,4,210,249,10,4,241,0,0,7,0,
+90,253,220,3,214,4,210,0,29,0,41,0,42,0,43,0,44,0,45,0,46,0,0,1,38,35,34,
+6,21,20,22,22,23,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,
+23,1,6,6,21,20,22,51,50,54,53,52,38,11,2,19,19,3,57,92,114,77,70,25,84,80,
+173,148,229,207,218,238,154,154,44,44,168,150,120,103,254,234,151,167,144,
+136,139,143,103,40,149,36,4,164,4,45,17,32,33,21,36,46,33,71,143,109,133,
+148,162,142,111,143,31,37,84,47,90,106,17,254,57,1,93,81,75,83,62,68,60,85,
+2,18,251,46,4,210,249,10,5,38,0,0,5,0,19,253,220,3,140,4,210,0,34,0,35,0,
+36,0,37,0,38,0,0,1,38,35,34,21,20,22,23,22,22,21,20,6,35,34,36,39,55,22,22,
+51,50,53,52,38,39,46,2,53,52,54,51,50,23,39,3,3,19,2,243,96,95,161,68,131,
+162,144,188,163,149,254,248,125,137,93,199,114,178,93,93,102,140,74,175,147,
+139,87,160,138,47,81,4,43,19,81,36,55,53,66,148,113,115,138,137,147,94,114,
+116,109,62,75,37,41,82,100,76,100,123,19,19,251,46,4,210,249,10,0,6,0,90,
+253,220,3,239,4,210,0,42,0,53,0,54,0,55,0,56,0,57,0,0,1,39,54,51,50,22,21,
+20,6,6,7,6,6,21,20,22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,54,
+55,62,2,53,52,38,35,34,19,54,54,53,52,38,35,34,6,21,20,19,3,3,19,1,17,52,
+139,151,145,159,57,139,153,110,98,124,116,27,149,124,121,142,221,213,232,
+251,54,156,151,92,75,32,75,78,114,254,110,112,63,57,61,68,3,89,76,141,4,24,
+138,48,116,102,66,87,77,54,40,75,60,61,68,5,62,66,90,116,122,104,119,131,
+149,130,68,104,100,51,31,33,37,27,40,35,253,104,3,62,54,37,48,54,53,44,2,
+247,251,46,4,210,249,10,0,7,0,90,253,220,4,30,4,211,0,61,0,62,0,63,0,64,0,
+65,0,66,0,67,0,0,23,22,22,51,50,54,53,52,38,39,38,38,53,52,54,54,55,62,2,
+53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,
+20,7,19,7,3,6,7,22,21,20,6,35,34,38,39,1,19,1,19,19,3,224,42,71,39,51,60,
+53,49,136,159,64,120,127,123,104,32,49,136,83,55,108,139,122,101,47,139,123,
+87,75,5,71,57,60,69,59,179,132,172,68,101,66,146,118,85,132,54,2,36,233,254,
+94,32,1,99,43,43,41,61,55,57,109,42,27,170,105,79,117,93,64,62,61,44,31,51,
+55,79,95,107,62,90,75,67,58,64,71,49,76,89,24,21,28,52,63,70,56,69,48,254,
+207,65,1,54,20,8,90,107,127,135,66,69,5,89,251,46,4,210,251,233,2,5,251,28,
+0,7,0,78,253,220,5,237,4,211,0,54,0,83,0,84,0,85,0,86,0,87,0,88,0,0,1,38,
+53,52,54,51,50,22,21,20,7,19,7,3,7,6,4,35,34,38,53,52,55,38,38,53,52,54,51,
+50,23,54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,7,35,34,
+38,38,53,52,55,38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,21,20,22,51,50,
+1,19,9,2,4,121,5,71,57,60,69,58,178,132,171,22,129,254,175,194,168,197,52,
+71,70,185,148,112,108,41,119,73,135,98,26,49,136,83,55,108,139,122,101,47,
+139,123,87,83,19,131,191,93,8,61,70,94,97,82,65,94,41,39,13,20,25,84,90,112,
+94,248,1,85,233,254,94,254,211,1,128,1,100,21,28,52,63,70,56,71,48,254,209,
+65,1,53,6,199,204,150,124,84,66,52,121,77,110,140,32,44,72,37,67,61,41,29,
+51,55,79,95,107,62,90,75,67,58,64,71,49,76,89,145,93,143,76,41,35,15,64,58,
+90,53,33,6,137,3,67,61,67,76,5,7,251,46,4,210,249,10,4,228,0,4,0,90,255,167,
+3,230,4,210,0,50,0,51,0,52,0,53,0,0,1,38,35,34,6,21,20,22,23,54,51,50,23,
+7,38,35,34,6,21,20,33,50,55,38,53,52,54,51,50,22,21,20,7,19,35,39,6,35,34,
+38,53,52,55,38,53,52,54,51,50,22,23,39,1,1,2,162,92,83,120,124,73,69,99,134,
+81,73,28,58,64,131,158,1,11,47,24,11,63,54,55,65,41,130,169,89,62,68,201,
+229,85,175,204,184,51,128,45,143,1,9,254,62,4,36,24,80,74,60,90,36,42,13,
+147,10,100,91,197,4,26,35,51,60,69,50,62,48,254,228,207,18,187,158,124,88,
+120,167,129,161,15,12,27,251,46,4,210,0,0,7,0,78,253,220,5,237,4,211,0,78,
+0,79,0,80,0,81,0,82,0,83,0,84,0,0,37,35,34,38,38,53,52,54,54,55,62,2,53,52,
+39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,
+19,7,3,7,6,4,35,34,38,53,52,55,38,53,52,54,55,23,6,6,21,20,23,54,51,50,23,
+7,38,35,34,6,21,20,22,51,50,1,19,1,1,3,5,3,219,19,131,191,93,64,120,127,135,
+98,26,49,136,83,55,108,139,122,101,47,139,123,87,75,5,71,57,60,69,58,178,
+132,171,22,129,254,175,194,168,197,49,138,166,165,57,114,113,76,68,97,41,
+39,13,20,25,84,90,112,94,248,1,85,233,254,94,254,156,108,2,20,187,93,143,
+76,79,117,93,64,67,61,41,29,51,55,79,95,107,62,90,75,67,58,64,71,49,76,89,
+24,21,28,52,63,70,56,71,48,254,209,65,1,53,6,199,204,150,124,80,66,108,146,
+115,173,51,144,31,99,80,86,58,36,6,137,3,67,61,67,76,5,7,251,46,4,210,249,
+10,4,255,27,0,7,0,90,253,220,4,30,4,211,0,57,0,58,0,59,0,60,0,61,0,62,0,63,
+0,0,5,7,3,5,23,22,21,20,6,35,34,38,53,52,54,55,55,54,55,38,38,53,52,54,54,
+55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,
+50,22,21,20,7,3,19,1,19,3,19,4,30,132,173,254,183,47,21,66,60,85,161,52,56,
+46,92,78,168,182,64,120,127,123,104,32,49,136,83,55,108,139,122,101,47,139,
+123,87,75,5,71,57,60,69,59,215,233,254,94,92,54,37,28,65,1,57,189,73,33,36,
+38,55,114,67,34,52,30,24,48,32,14,171,117,79,117,93,64,62,61,44,31,51,55,
+79,95,107,62,90,75,67,58,64,71,49,76,89,24,21,28,52,63,70,56,71,46,3,189,
+251,46,4,210,251,233,2,5,251,28,0,6,0,90,255,124,4,30,4,211,0,47,0,48,0,49,
+0,50,0,51,0,52,0,0,1,38,53,52,54,51,50,22,21,20,7,19,7,3,1,39,55,54,55,46,
+2,53,52,54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,19,19,
+1,19,3,2,170,5,71,57,60,69,59,179,132,170,254,21,102,155,94,80,121,181,96,
+64,120,127,123,104,32,49,136,83,55,108,139,122,101,47,139,123,87,53,233,254,
+94,89,46,1,100,21,28,52,63,70,56,71,46,254,207,65,1,51,254,166,143,89,54,
+41,1,79,141,83,79,117,93,64,62,61,44,31,51,55,79,95,107,62,90,75,67,58,64,
+71,49,76,89,3,134,251,46,4,210,251,233,2,5,0,4,0,77,255,147,3,248,4,210,0,
+53,0,54,0,55,0,56,0,0,1,5,39,37,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,
+20,22,23,37,23,5,22,22,21,20,6,35,22,23,7,35,38,39,38,38,53,52,54,51,50,22,
+23,22,51,50,54,53,52,38,38,19,3,3,1,254,254,136,57,1,13,67,69,197,161,128,
+110,30,68,77,46,100,107,69,69,1,178,66,254,188,122,114,205,191,142,89,19,
+118,152,162,109,114,61,47,50,86,42,58,93,118,116,40,109,33,32,173,2,134,144,
+145,96,49,113,71,115,143,27,149,17,9,65,60,44,77,33,162,144,111,67,147,98,
+124,156,106,25,98,73,168,9,84,64,45,55,56,51,17,77,67,39,71,81,2,122,251,
+46,4,210,0,4,0,65,255,147,4,5,4,210,0,57,0,58,0,59,0,60,0,0,1,5,39,37,38,
+38,53,52,54,51,50,23,7,38,38,35,34,6,21,20,22,23,37,23,5,22,22,21,20,6,35,
+35,22,23,7,35,38,39,38,38,53,52,54,51,50,22,23,22,51,50,54,53,52,38,39,7,
+39,55,19,3,3,1,236,254,131,46,1,20,53,53,196,162,128,110,30,68,77,46,105,
+102,53,54,1,209,54,254,168,138,130,205,192,24,130,101,19,118,152,162,109,
+114,61,47,55,93,45,65,96,118,116,96,77,181,133,195,176,57,148,2,166,122,149,
+76,45,99,53,114,142,27,149,17,9,67,57,34,65,32,141,145,91,76,159,98,124,157,
+102,29,98,73,168,9,84,64,45,55,57,53,14,77,66,57,98,46,244,87,225,2,45,251,
+46,4,210,0,0,6,0,63,253,220,3,118,4,210,0,35,0,36,0,37,0,38,0,39,0,40,0,0,
+37,34,38,39,6,35,34,38,53,52,54,51,50,22,23,54,53,52,35,34,7,39,54,51,50,
+22,21,20,6,7,30,2,51,51,7,1,3,3,19,3,3,66,151,237,130,36,36,89,92,69,55,53,
+80,40,254,230,144,125,52,161,168,188,203,157,143,74,111,112,91,15,18,254,
+174,76,94,151,79,232,123,164,3,58,66,47,57,33,31,60,162,182,63,141,72,170,
+161,117,185,48,75,69,23,154,3,234,251,46,4,210,249,10,4,188,255,255,0,19,
+253,220,4,11,4,210,2,34,2,61,0,0,0,3,2,103,2,191,2,27,255,255,0,90,253,220,
+5,133,4,210,2,34,2,62,0,0,0,3,2,103,3,121,1,137,255,255,0,67,0,0,6,249,4,
+212,2,34,2,63,0,0,0,3,2,103,4,155,2,37,255,255,0,58,253,220,3,156,4,210,2,
+34,2,64,0,0,0,3,2,103,2,207,1,233,255,255,0,90,253,220,3,214,4,210,2,34,2,
+65,0,0,0,3,2,103,3,21,1,219,255,255,0,19,253,220,3,140,4,210,2,34,2,66,0,
+0,0,3,2,103,2,198,2,17,255,255,0,56,253,220,3,239,4,210,2,34,2,67,0,0,0,3,
+2,103,2,205,1,223,255,255,0,90,254,156,4,30,4,211,2,34,2,73,0,0,0,3,2,103,
+3,9,0,4,255,255,0,77,255,124,3,248,4,210,2,34,2,74,0,0,0,3,2,103,2,250,0,
+228,255,255,0,65,255,124,4,5,4,210,2,34,2,75,0,0,0,3,2,103,2,250,0,228,255,
+255,0,63,253,220,3,118,4,210,2,34,2,76,0,0,0,3,2,103,3,5,2,64,0,4,252,15,
+252,218,255,128,0,8,0,6,0,30,0,31,0,32,0,0,5,1,39,1,51,19,7,5,54,51,50,22,
+21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,38,35,34,7,19,1,254,97,254,101,
+97,1,243,59,237,121,254,126,100,105,134,159,177,146,156,254,252,133,106,121,
+194,121,92,87,76,66,77,83,72,254,140,151,254,243,135,1,37,254,222,79,7,45,
+134,110,105,134,119,137,104,123,98,57,48,48,52,43,1,249,253,182,0,255,255,
+251,175,252,218,255,128,0,136,2,34,2,88,0,0,0,3,0,55,254,47,0,136,0,4,252,
+70,252,218,0,111,0,8,0,6,0,30,0,31,0,32,0,0,5,1,39,1,51,19,7,3,6,35,34,38,
+53,52,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,50,55,3,1,254,97,254,70,97,
+2,18,59,232,121,9,100,104,134,160,169,138,157,1,9,143,125,106,195,116,90,
+89,76,66,79,82,211,2,35,151,254,222,135,1,58,254,226,79,254,108,45,134,111,
+103,135,155,194,80,156,134,57,48,48,52,43,2,112,253,156,0,255,255,251,175,
+252,218,0,111,0,136,2,34,2,90,0,0,0,3,0,55,254,47,0,136,0,4,252,70,252,218,
+255,190,0,8,0,6,0,25,0,26,0,27,0,0,5,1,39,1,51,1,7,19,6,35,34,38,53,52,54,
+55,23,6,6,21,20,22,51,50,54,55,1,19,254,97,254,70,97,2,18,59,1,43,121,75,
+136,137,156,171,191,170,15,115,110,83,75,65,103,72,254,157,167,151,254,222,
+135,1,58,254,143,79,254,216,70,128,110,105,152,10,135,9,61,57,48,50,27,36,
+2,86,254,71,255,255,251,175,252,218,255,190,0,136,2,34,2,92,0,0,0,3,0,55,
+254,47,0,136,0,5,252,62,252,218,255,212,4,210,0,6,0,40,0,41,0,42,0,43,0,0,
+37,1,39,1,51,1,7,19,6,35,34,38,53,52,55,38,53,52,54,55,23,6,21,20,51,50,54,
+55,23,6,35,34,39,6,21,20,22,51,50,54,55,1,19,3,254,89,254,70,97,2,18,59,1,
+43,121,151,136,137,155,172,31,111,188,173,15,225,166,57,93,82,51,136,137,
+39,35,22,82,84,57,93,82,254,89,184,190,123,254,222,135,1,58,254,143,79,253,
+198,70,131,109,48,49,70,122,94,132,8,135,15,98,91,22,35,129,70,5,23,31,47,
+44,22,35,2,95,4,210,252,71,0,0,6,252,69,252,218,0,93,4,210,0,6,0,53,0,54,
+0,55,0,56,0,57,0,0,37,5,39,37,51,19,7,1,6,35,34,38,53,52,55,54,53,52,38,35,
+34,7,39,54,55,38,35,34,6,21,20,22,23,7,36,53,52,54,51,50,23,54,51,50,22,21,
+20,7,6,21,20,51,50,55,1,19,3,3,254,89,254,182,97,1,162,59,248,121,1,83,105,
+111,118,140,242,23,63,56,143,65,142,24,30,75,74,63,64,117,117,102,254,232,
+142,114,132,115,98,140,102,144,62,214,108,85,104,253,197,218,230,129,123,
+225,135,249,254,207,79,253,116,52,110,91,159,47,36,37,42,44,184,37,63,36,
+43,59,55,66,152,101,98,233,196,113,123,90,90,111,99,99,92,5,90,68,44,2,119,
+4,210,252,71,252,101,0,0,6,252,69,252,218,1,37,4,210,0,6,0,72,0,73,0,74,0,
+75,0,76,0,0,37,5,39,37,51,19,7,1,6,35,34,38,53,52,55,38,38,53,52,54,55,38,
+35,34,7,39,54,55,38,35,34,6,21,20,22,23,7,36,53,52,54,51,50,23,54,51,50,22,
+21,21,6,21,6,21,20,22,51,50,54,55,23,6,35,34,39,6,21,20,22,51,50,54,55,1,
+19,3,3,254,89,254,182,97,1,162,59,248,121,2,27,108,108,119,139,6,42,44,62,
+58,36,58,143,65,142,24,30,75,74,63,64,117,117,102,254,232,142,114,132,115,
+98,140,98,148,1,155,59,50,48,79,62,39,108,108,19,20,2,62,52,53,80,51,252,
+252,199,178,174,123,225,135,249,254,207,79,253,116,52,112,95,32,18,22,74,
+44,46,75,21,27,184,37,63,36,43,59,55,66,152,101,98,233,196,113,123,90,90,
+119,98,8,6,3,9,59,25,28,19,29,122,52,2,8,9,34,39,19,28,2,121,4,210,252,71,
+252,101,0,0,4,252,70,252,218,0,64,0,0,0,6,0,19,0,20,0,21,0,0,5,1,39,1,51,
+1,7,37,54,51,50,22,23,7,46,2,35,34,7,19,1,254,97,254,70,97,2,18,59,1,43,121,
+254,55,78,87,124,244,175,108,123,110,127,75,65,52,78,1,225,183,254,222,135,
+1,58,254,143,79,26,24,123,166,95,108,79,46,19,2,80,253,110,0,255,255,251,
+175,252,218,0,64,0,136,2,34,2,97,0,0,0,3,0,55,254,47,0,136,0,5,252,79,252,
+218,0,35,0,0,0,22,0,23,0,24,0,25,0,26,0,0,5,54,51,50,22,21,20,6,35,34,36,
+39,55,22,22,51,50,53,52,38,35,34,7,19,17,1,1,253,250,107,121,152,173,194,
+173,180,254,215,136,128,123,217,145,216,88,76,98,87,107,253,189,2,86,228,
+48,147,129,125,147,167,176,88,157,128,141,57,64,44,1,108,252,218,1,113,1,
+32,0,5,253,76,252,218,1,29,0,0,0,24,0,25,0,26,0,27,0,28,0,0,3,6,35,34,38,
+53,52,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,50,54,55,3,17,1,1,139,113,
+113,153,174,190,160,187,1,44,140,125,125,229,137,102,108,86,79,46,84,55,167,
+2,106,253,169,253,87,47,151,127,118,152,181,206,80,177,151,69,65,63,66,18,
+26,2,26,252,218,1,43,1,102,0,6,253,213,252,218,0,49,0,0,0,18,0,19,0,20,0,
+21,0,22,0,23,0,0,19,6,35,34,38,53,52,54,55,21,6,6,21,20,22,51,50,54,55,1,
+17,19,21,23,49,140,137,151,176,190,171,105,103,92,71,57,94,81,254,161,19,
+165,253,111,71,159,130,122,163,10,137,15,83,71,61,69,26,41,2,1,252,218,2,
+145,31,104,0,6,254,128,252,218,1,85,0,0,0,11,0,12,0,13,0,14,0,15,0,16,0,0,
+1,54,51,50,4,23,7,38,38,35,34,7,19,1,55,1,55,254,128,78,87,154,1,17,133,125,
+118,191,126,65,52,118,1,154,134,253,230,3,254,226,24,183,201,81,173,141,19,
+1,176,252,218,219,1,151,31,0,0,1,253,107,254,152,254,37,255,81,0,11,0,0,1,
+34,38,53,52,54,51,50,22,21,20,6,253,200,38,55,55,38,38,55,55,254,152,54,39,
+38,54,54,38,39,54,0,0,3,0,185,0,0,4,77,7,44,0,27,0,28,0,29,0,0,1,38,38,35,
+34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,54,51,50,4,23,7,55,3,200,
+126,199,91,74,94,35,17,36,66,58,16,21,114,138,52,80,164,109,145,1,7,155,103,
+34,5,33,202,173,68,131,134,251,240,64,55,31,12,153,69,123,112,4,86,155,172,
+95,201,239,162,227,0,0,3,0,185,0,0,5,11,7,44,0,27,0,28,0,29,0,0,1,38,36,35,
+34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,54,51,50,4,23,7,55,4,143,
+171,254,247,120,105,113,44,17,36,66,58,16,21,114,138,52,92,188,132,173,1,
+74,191,116,102,5,33,198,176,77,146,148,252,23,64,55,31,12,153,69,123,112,
+4,49,170,186,103,202,230,170,227,0,3,0,185,0,0,5,201,7,44,0,27,0,28,0,29,
+0,0,1,38,36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,54,51,50,
+4,23,7,55,5,85,211,254,178,149,135,137,50,17,36,66,58,16,21,114,138,52,112,
+209,150,201,1,143,225,122,13,5,33,195,178,90,167,152,252,62,64,55,31,12,153,
+69,123,112,4,12,191,202,103,204,220,178,227,0,3,0,185,0,0,6,124,7,44,0,27,
+0,28,0,29,0,0,1,38,36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,
+54,51,50,4,5,7,55,6,16,252,254,114,176,143,157,77,17,36,66,58,16,21,114,138,
+52,121,234,172,222,1,207,1,7,150,53,5,33,196,176,80,169,196,252,99,64,55,
+31,12,153,69,123,112,3,212,219,221,112,200,216,186,227,0,0,3,0,185,0,0,7,
+59,7,44,0,27,0,28,0,29,0,0,1,36,36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,
+38,53,17,52,54,36,51,50,4,5,7,55,6,215,254,224,254,43,208,183,179,75,17,36,
+66,58,16,21,114,138,52,137,1,2,191,250,2,17,1,45,156,41,5,33,193,179,103,
+188,192,252,137,64,55,31,12,153,69,123,112,3,195,220,232,117,198,210,194,
+227,0,0,3,0,185,0,0,7,238,7,44,0,27,0,28,0,29,0,0,1,36,36,35,34,14,2,21,17,
+20,30,2,51,7,35,34,38,38,53,17,52,54,36,51,32,1,7,55,7,146,254,196,253,230,
+242,139,186,123,45,17,36,66,58,16,21,114,138,52,153,1,26,207,2,36,2,143,134,
+10,5,33,190,181,52,126,186,155,252,174,64,55,31,12,153,69,123,112,3,160,237,
+247,120,254,112,202,227,0,255,255,0,185,0,0,4,228,7,44,2,34,2,104,0,0,0,3,
+2,217,5,132,0,0,255,255,0,185,0,0,5,167,7,44,2,34,2,105,0,0,0,3,2,217,6,71,
+0,0,255,255,0,185,0,0,6,107,7,44,2,34,2,106,0,0,0,3,2,217,7,11,0,0,255,255,
+0,185,0,0,7,35,7,44,2,34,2,107,0,0,0,3,2,217,7,195,0,0,255,255,0,185,0,0,
+7,230,7,44,2,34,2,108,0,0,0,3,2,217,8,134,0,0,255,255,0,185,0,0,8,158,7,44,
+2,34,2,109,0,0,0,3,2,217,9,62,0,0,0,2,0,185,0,0,5,150,7,44,0,42,0,43,0,0,
+1,38,35,34,6,21,20,23,7,38,39,38,38,35,34,6,6,21,17,20,30,2,51,7,35,34,38,
+38,53,17,52,54,54,51,50,22,23,54,54,51,50,23,1,5,105,80,77,80,89,71,154,9,
+8,119,197,91,74,94,35,17,36,66,58,16,21,114,138,52,80,164,109,107,189,82,
+20,152,124,119,99,251,146,6,114,44,89,77,89,127,17,15,17,190,171,68,131,134,
+251,240,64,55,31,12,153,69,123,112,4,86,155,172,95,108,107,106,109,51,253,
+217,0,2,0,185,0,0,6,98,7,44,0,43,0,44,0,0,1,38,35,34,6,21,20,23,7,39,38,39,
+38,36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,54,51,50,4,23,
+54,54,51,50,23,1,6,53,80,77,80,89,71,159,5,2,3,173,254,249,118,105,113,44,
+17,36,66,58,16,21,114,138,52,92,188,132,139,1,3,120,8,156,137,119,99,250,
+211,6,114,44,89,77,89,127,17,9,5,4,201,173,77,146,148,252,23,64,55,31,12,
+153,69,123,112,4,49,170,186,103,130,130,127,133,51,253,217,0,0,2,0,185,0,
+0,7,40,7,44,0,41,0,42,0,0,1,38,35,34,6,21,20,23,7,39,38,36,35,34,6,6,21,17,
+20,30,2,51,7,35,34,38,38,53,17,52,54,54,51,50,4,23,54,54,51,50,23,1,6,251,
+80,77,80,89,71,159,12,219,254,186,145,135,137,50,17,36,66,58,16,21,114,138,
+52,112,209,150,169,1,71,157,2,159,144,119,99,249,255,6,114,44,89,77,89,127,
+17,21,200,170,90,167,152,252,62,64,55,31,12,153,69,123,112,4,12,191,202,103,
+142,142,138,146,51,253,217,0,0,2,0,185,0,0,7,226,7,44,0,42,0,43,0,0,1,38,
+35,34,6,21,20,23,7,39,38,36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,
+52,54,54,51,50,4,23,53,52,54,51,50,23,1,7,181,80,77,80,89,71,159,12,253,254,
+118,174,143,157,77,17,36,66,58,16,21,114,138,52,120,235,172,194,1,127,203,
+163,145,119,99,249,85,6,114,44,89,77,89,127,17,21,196,173,80,169,196,252,
+99,64,55,31,12,153,69,123,112,3,213,218,221,112,147,152,8,141,150,51,253,
+217,0,2,0,185,0,0,8,168,7,44,0,42,0,43,0,0,1,38,35,34,6,21,20,23,7,39,36,
+36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,36,51,50,4,23,53,
+52,54,51,50,23,1,8,123,80,77,80,89,71,159,12,254,223,254,49,207,183,179,75,
+17,36,66,58,16,21,114,138,52,137,1,2,191,218,1,195,246,164,148,119,99,248,
+133,6,114,44,89,77,89,127,17,22,192,176,103,188,192,252,137,64,55,31,12,153,
+69,123,112,3,195,220,232,117,150,157,16,138,153,51,253,217,0,3,0,185,0,0,
+9,98,7,44,0,47,0,48,0,49,0,0,1,38,35,34,6,21,20,23,7,39,36,36,35,34,14,2,
+21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,36,51,50,4,5,39,38,62,4,51,50,
+23,1,37,9,53,80,77,80,89,71,159,12,254,190,253,238,237,139,186,123,45,17,
+36,66,58,16,21,114,138,52,153,1,26,207,247,2,10,1,20,1,2,10,24,49,73,99,60,
+119,99,247,179,6,130,6,114,44,89,77,89,127,17,22,192,175,52,126,186,155,252,
+174,64,55,31,12,153,69,123,112,3,160,237,247,120,158,157,12,26,74,66,64,47,
+26,51,253,217,231,0,3,0,185,0,0,5,156,7,44,0,42,0,54,0,55,0,0,1,38,35,34,
+6,21,20,23,7,38,39,38,38,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,
+54,54,51,50,22,23,54,54,51,50,23,7,50,22,21,20,6,35,34,38,53,52,54,1,5,111,
+80,77,80,89,71,159,4,9,122,198,92,74,94,35,17,36,66,58,16,21,114,138,52,80,
+164,109,110,193,83,16,149,129,119,99,166,41,61,61,41,41,61,61,252,96,6,114,
+44,89,77,89,127,17,5,18,196,174,68,131,134,251,240,64,55,31,12,153,69,123,
+112,4,86,155,172,95,113,112,109,116,51,210,59,43,43,59,59,43,43,59,254,171,
+0,0,3,0,185,0,0,6,98,7,44,0,43,0,55,0,56,0,0,1,38,35,34,6,21,20,23,7,39,38,
+39,38,36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,54,51,50,4,
+23,54,54,51,50,23,3,20,6,35,34,38,53,52,54,51,50,22,1,6,53,80,77,80,89,71,
+159,5,2,3,173,254,249,118,105,113,44,17,36,66,58,16,21,114,138,52,92,188,
+132,139,1,3,120,8,156,137,119,99,64,61,41,41,61,61,41,41,61,251,11,6,114,
+44,89,77,89,127,17,9,5,4,201,173,77,146,148,252,23,64,55,31,12,153,69,123,
+112,4,49,170,186,103,130,130,127,133,51,254,200,43,59,59,43,43,59,59,254,
+230,0,0,3,0,185,0,0,7,40,7,44,0,41,0,53,0,54,0,0,1,38,35,34,6,21,20,23,7,
+39,38,36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,54,51,50,4,
+23,54,54,51,50,23,3,20,6,35,34,38,53,52,54,51,50,22,1,6,251,80,77,80,89,71,
+159,12,219,254,186,145,135,137,50,17,36,66,58,16,21,114,138,52,112,209,150,
+169,1,71,157,2,159,144,119,99,64,61,41,41,61,61,41,41,61,250,63,6,114,44,
+89,77,89,127,17,21,200,170,90,167,152,252,62,64,55,31,12,153,69,123,112,4,
+12,191,202,103,142,142,138,146,51,254,200,43,59,59,43,43,59,59,254,230,0,
+0,3,0,185,0,0,7,226,7,44,0,42,0,54,0,55,0,0,1,38,35,34,6,21,20,23,7,39,38,
+36,35,34,6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,54,51,50,4,23,53,
+52,54,51,50,23,3,20,6,35,34,38,53,52,54,51,50,22,1,7,181,80,77,80,89,71,159,
+12,253,254,118,174,143,157,77,17,36,66,58,16,21,114,138,52,120,235,172,194,
+1,127,203,163,145,119,99,64,61,41,41,61,61,41,41,61,249,133,6,114,44,89,77,
+89,127,17,21,196,173,80,169,196,252,99,64,55,31,12,153,69,123,112,3,213,218,
+221,112,147,152,8,141,150,51,254,200,43,59,59,43,43,59,59,254,230,0,3,0,185,
+0,0,8,168,7,44,0,42,0,54,0,55,0,0,1,38,35,34,6,21,20,23,7,39,36,36,35,34,
+6,6,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,36,51,50,4,23,53,52,54,51,
+50,23,3,20,6,35,34,38,53,52,54,51,50,22,1,8,123,80,77,80,89,71,159,12,254,
+223,254,49,207,183,179,75,17,36,66,58,16,21,114,138,52,137,1,2,191,218,1,
+195,246,164,148,119,99,64,61,41,41,61,61,41,41,61,248,190,6,114,44,89,77,
+89,127,17,22,192,176,103,188,192,252,137,64,55,31,12,153,69,123,112,3,195,
+220,232,117,150,157,16,138,153,51,254,200,43,59,59,43,43,59,59,254,230,0,
+4,0,185,0,0,9,98,7,44,0,47,0,59,0,60,0,61,0,0,1,38,35,34,6,21,20,23,7,39,
+36,36,35,34,14,2,21,17,20,30,2,51,7,35,34,38,38,53,17,52,54,36,51,50,4,5,
+39,38,62,4,51,50,23,3,20,6,35,34,38,53,52,54,51,50,22,1,37,9,53,80,77,80,
+89,71,159,12,254,190,253,238,237,139,186,123,45,17,36,66,58,16,21,114,138,
+52,153,1,26,207,247,2,10,1,20,1,2,10,24,49,73,99,60,119,99,64,61,41,41,61,
+61,41,41,61,247,237,6,152,6,114,44,89,77,89,127,17,22,192,175,52,126,186,
+155,252,174,64,55,31,12,153,69,123,112,3,160,237,247,120,158,157,12,26,74,
+66,64,47,26,51,254,200,43,59,59,43,43,59,59,254,230,231,0,2,254,29,0,0,2,
+14,7,44,0,29,0,30,0,0,1,20,30,2,51,7,35,34,38,38,53,17,38,38,35,34,6,21,20,
+23,35,38,53,52,54,51,50,0,19,7,1,93,17,36,66,58,16,21,114,138,52,50,184,105,
+80,85,26,161,29,177,139,174,1,7,79,251,1,57,64,55,31,12,151,69,123,112,3,
+169,203,244,103,95,78,99,109,87,151,176,254,228,254,236,42,0,0,2,253,198,
+0,0,2,14,7,44,0,29,0,30,0,0,1,20,30,2,51,7,35,34,38,38,53,17,38,38,35,34,
+6,21,20,23,35,38,53,52,54,51,50,0,19,5,1,93,17,36,66,58,16,21,114,138,52,
+70,217,118,92,94,26,163,27,191,147,178,1,34,113,254,252,1,55,64,55,31,12,
+149,69,123,112,3,160,209,247,104,103,73,95,106,81,158,178,254,237,254,238,
+53,255,255,254,29,0,0,2,14,7,44,2,34,2,129,0,0,0,3,2,217,2,152,0,0,255,255,
+253,198,0,0,2,14,7,44,2,34,2,130,0,0,0,3,2,217,2,122,0,0,0,2,254,29,0,0,2,
+127,7,44,0,44,0,45,0,0,1,17,20,30,2,51,7,35,34,38,38,53,17,38,38,35,34,6,
+21,20,23,35,38,53,52,54,51,50,22,23,54,54,51,50,23,7,38,35,34,6,21,20,23,
+22,7,1,93,17,36,66,58,16,21,114,138,52,50,184,105,80,85,26,161,29,177,139,
+96,159,64,28,137,104,119,99,45,80,77,79,90,1,45,222,4,252,252,61,64,55,31,
+12,151,69,123,112,3,169,203,244,103,95,78,99,109,87,151,176,83,82,81,84,51,
+135,44,94,81,12,13,96,164,0,0,2,253,198,0,0,2,116,7,44,0,44,0,45,0,0,1,17,
+20,30,2,51,7,35,34,38,38,53,17,38,38,35,34,6,21,20,23,35,38,53,52,54,51,50,
+22,23,54,54,51,50,23,7,38,35,34,6,21,20,23,22,7,1,93,17,36,66,58,16,21,114,
+138,52,70,217,118,92,94,26,163,27,191,147,102,178,85,25,139,113,119,99,45,
+80,77,79,90,7,38,208,5,7,252,48,64,55,31,12,149,69,123,112,3,160,209,247,
+104,103,73,95,106,81,158,178,88,102,95,95,51,135,44,94,81,27,25,69,164,0,
+0,3,254,29,0,0,2,127,7,44,0,44,0,56,0,57,0,0,1,17,20,30,2,51,7,35,34,38,38,
+53,17,38,38,35,34,6,21,20,23,35,38,53,52,54,51,50,22,23,54,54,51,50,23,7,
+38,35,34,6,21,20,23,22,55,50,22,21,20,6,35,34,38,53,52,54,1,1,93,17,36,66,
+58,16,21,114,138,52,50,184,105,80,85,26,161,29,177,139,96,159,64,28,137,104,
+119,99,45,80,77,79,90,1,45,159,41,61,61,41,41,61,61,254,172,4,252,252,61,
+64,55,31,12,151,69,123,112,3,169,203,244,103,95,78,99,109,87,151,176,83,82,
+81,84,51,135,44,94,81,12,13,96,177,59,43,43,59,59,43,43,59,254,171,0,3,253,
+198,0,0,2,116,7,44,0,44,0,56,0,57,0,0,1,17,20,30,2,51,7,35,34,38,38,53,17,
+38,38,35,34,6,21,20,23,35,38,53,52,54,51,50,22,23,54,54,51,50,23,7,38,35,
+34,6,21,20,23,22,55,50,22,21,20,6,35,34,38,53,52,54,1,1,93,17,36,66,58,16,
+21,114,138,52,70,217,118,92,94,26,163,27,191,147,102,178,85,25,139,113,119,
+99,45,80,77,79,90,7,38,160,41,61,61,41,41,61,61,254,188,5,7,252,48,64,55,
+31,12,149,69,123,112,3,160,209,247,104,103,73,95,106,81,158,178,88,102,95,
+95,51,135,44,94,81,27,25,69,177,59,43,43,59,59,43,43,59,254,171,0,4,251,160,
+253,220,0,35,0,0,0,22,0,34,0,35,0,36,0,0,5,54,51,50,22,21,20,6,35,34,36,39,
+55,22,22,51,50,53,52,38,35,34,7,37,50,22,21,20,6,35,34,38,53,52,54,37,1,253,
+249,105,123,152,174,187,156,158,254,245,118,121,111,188,120,195,92,75,95,
+88,253,227,47,66,66,47,47,66,66,2,184,254,111,49,49,150,126,123,149,143,136,
+95,123,105,141,57,64,44,28,71,48,49,70,71,48,48,71,156,254,198,0,4,252,24,
+253,220,1,29,0,0,0,24,0,36,0,37,0,38,0,0,3,6,35,34,38,53,52,54,51,50,4,23,
+7,38,38,35,34,6,21,20,22,51,50,54,55,37,50,22,21,20,6,35,34,38,53,52,54,37,
+1,139,113,113,153,174,190,160,187,1,44,140,125,125,229,137,102,108,86,79,
+46,84,55,253,72,47,66,66,47,47,66,66,2,64,2,119,254,11,47,151,127,118,152,
+181,206,80,177,151,69,65,63,66,18,26,202,71,48,49,70,71,48,48,71,156,254,
+185,0,4,252,154,253,220,0,49,0,36,0,18,0,30,0,31,0,32,0,0,19,6,35,34,38,53,
+52,54,55,21,6,6,21,20,22,51,50,54,55,37,50,22,21,20,6,35,34,38,53,52,54,37,
+23,49,140,137,151,176,190,171,105,103,92,71,57,94,81,253,18,47,66,66,47,47,
+66,66,1,190,231,254,35,71,159,130,122,163,10,137,15,83,71,61,69,26,41,177,
+71,48,49,70,71,48,48,71,156,104,0,4,252,154,252,218,0,125,0,36,0,35,0,47,
+0,48,0,49,0,0,19,6,35,34,38,53,52,55,38,53,52,54,55,21,6,6,21,20,22,51,50,
+54,55,23,6,35,34,39,6,21,20,22,51,50,54,55,1,50,22,21,20,6,35,34,38,53,52,
+54,37,1,125,136,137,154,173,32,112,190,171,102,108,86,80,57,93,82,51,136,
+137,36,33,27,85,81,57,93,82,252,193,47,66,66,47,47,66,66,1,190,254,187,253,
+32,70,146,123,58,50,77,133,103,142,10,137,10,69,56,53,57,22,35,129,70,5,31,
+40,54,56,22,35,1,195,71,48,49,70,71,48,48,71,156,253,220,0,5,251,10,252,218,
+0,79,0,1,0,53,0,65,0,66,0,67,0,68,0,0,19,6,35,34,38,53,52,55,54,53,52,38,
+35,34,6,7,39,54,55,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,
+54,51,50,22,21,20,7,6,6,21,20,22,51,50,54,55,1,50,22,21,20,6,35,34,38,53,
+52,54,37,1,37,79,108,108,119,139,242,23,62,57,76,101,31,142,23,31,34,72,44,
+60,74,110,123,102,145,134,155,111,63,115,67,98,140,103,143,62,111,103,70,
+53,46,72,56,251,84,47,66,66,47,47,66,66,3,78,254,199,254,115,253,16,54,126,
+105,183,53,48,49,55,59,119,111,37,82,51,25,30,73,56,80,155,111,98,125,214,
+107,122,139,39,51,90,127,110,112,104,12,63,55,44,49,21,30,1,212,71,48,49,
+70,71,48,48,71,156,253,196,24,0,0,5,251,10,252,218,1,23,0,1,0,67,0,79,0,80,
+0,81,0,82,0,0,5,54,51,50,22,21,21,6,21,6,21,20,22,51,50,54,55,23,6,35,34,
+39,6,21,20,22,51,50,54,55,23,6,35,34,38,53,52,55,38,53,52,55,38,35,34,6,7,
+39,54,55,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,5,50,22,21,20,
+6,35,34,38,53,52,54,37,1,5,254,46,98,140,100,146,1,155,69,54,46,72,56,40,
+108,108,19,20,2,70,53,46,72,56,40,108,108,119,139,7,87,129,30,73,76,101,31,
+142,23,31,34,72,44,60,74,110,123,102,145,134,155,111,63,115,253,144,47,66,
+66,47,47,66,66,3,78,253,6,1,187,89,90,131,115,9,6,3,26,79,35,39,21,30,125,
+52,2,9,12,44,49,21,30,125,52,122,104,34,25,56,104,118,61,54,119,111,37,82,
+51,25,30,73,56,80,155,111,98,125,214,107,122,139,39,118,71,48,49,70,71,48,
+48,71,156,253,220,24,0,255,255,251,160,253,220,0,35,0,0,2,2,2,137,0,0,255,
+255,252,24,253,220,1,29,0,0,2,2,2,138,0,0,255,255,252,154,253,220,0,49,0,
+36,2,2,2,139,0,0,255,255,252,154,252,218,0,125,0,36,2,2,2,140,0,0,255,255,
+251,10,252,218,0,79,0,1,2,2,2,141,0,0,255,255,251,10,252,218,1,23,0,1,2,2,
+2,142,0,0,0,3,252,173,253,220,0,35,0,0,0,22,0,23,0,24,0,0,5,54,51,50,22,21,
+20,6,35,34,36,39,55,22,22,51,50,53,52,38,35,34,7,55,1,253,249,105,123,152,
+174,187,156,158,254,245,118,121,111,188,120,195,92,75,95,88,108,254,111,49,
+49,150,126,123,149,143,136,95,123,105,141,57,64,44,184,254,198,0,0,5,252,
+173,252,218,0,35,0,0,0,22,0,23,0,24,0,25,0,26,0,0,5,54,51,50,22,21,20,6,35,
+34,36,39,55,22,22,51,50,53,52,38,35,34,7,19,19,1,1,253,249,105,123,152,174,
+187,156,158,254,245,118,121,111,188,120,195,92,75,95,88,108,37,254,102,1,
+142,229,49,150,126,123,149,143,136,95,123,105,141,57,64,44,1,108,252,218,
+1,56,1,89,0,0,4,253,91,4,210,0,133,7,44,0,11,0,25,0,26,0,27,0,0,1,50,22,21,
+20,6,35,34,38,53,52,54,5,55,22,22,51,50,54,55,23,6,6,35,34,38,5,3,254,239,
+44,62,62,44,44,62,62,254,152,142,43,127,93,92,128,43,142,62,208,135,140,206,
+1,4,93,7,15,67,45,46,66,67,45,45,67,195,57,95,89,88,96,57,135,136,140,247,
+2,90,0,3,254,126,4,210,255,96,7,44,0,11,0,12,0,13,0,0,1,50,22,21,20,6,35,
+34,38,53,52,54,3,19,254,239,47,66,66,47,47,66,66,38,60,6,144,71,48,49,70,
+71,48,48,71,254,66,2,90,0,255,255,254,58,4,210,0,80,7,44,0,2,0,128,0,0,255,
+255,254,58,4,210,0,80,7,44,0,2,1,168,0,0,0,4,253,68,253,220,1,85,0,0,0,11,
+0,23,0,24,0,25,0,0,5,54,51,50,4,23,7,38,38,35,34,7,39,50,22,21,20,6,35,34,
+38,53,52,54,37,1,254,128,78,87,154,1,17,133,125,118,191,126,65,52,251,47,
+66,66,47,47,66,66,1,20,2,108,106,24,183,201,82,174,141,19,96,71,48,49,70,
+71,48,48,71,156,254,105,255,255,0,37,253,220,4,58,4,210,2,34,0,21,0,0,0,35,
+2,149,4,23,0,0,0,3,2,103,2,197,0,158,255,255,0,19,253,220,4,46,4,210,2,34,
+0,33,0,0,0,35,2,149,4,11,0,0,0,3,2,103,2,195,0,188,255,255,0,76,253,220,4,
+46,4,210,2,34,0,34,0,0,0,35,2,149,4,11,0,0,0,3,2,103,2,225,0,184,255,255,
+0,37,253,220,4,87,4,210,2,34,0,200,0,0,0,35,2,149,4,52,0,0,0,3,2,103,2,226,
+0,158,255,255,0,37,253,220,4,229,4,210,2,34,0,21,0,0,0,35,0,61,3,200,0,0,
+0,3,2,103,2,191,0,78,255,255,0,19,253,220,4,229,4,210,2,34,0,33,0,0,0,35,
+0,61,3,200,0,0,0,3,2,103,2,194,0,168,255,255,0,55,253,220,4,229,4,210,2,34,
+0,34,0,0,0,35,0,61,3,200,0,0,0,3,2,103,2,204,0,178,255,255,0,37,253,220,5,
+2,4,210,2,34,0,200,0,0,0,35,0,61,3,229,0,0,0,3,2,103,2,220,0,128,0,2,0,232,
+255,227,1,230,5,182,0,3,0,15,0,0,1,35,3,51,3,50,22,21,20,6,35,34,38,53,52,
+54,1,165,121,51,223,113,61,66,67,60,60,67,66,1,158,4,24,251,68,71,68,67,73,
+74,66,67,72,0,0,4,0,206,3,197,3,25,7,44,0,3,0,7,0,8,0,9,0,0,1,3,35,3,33,3,
+35,3,3,19,1,177,51,125,51,2,75,51,124,51,52,7,5,213,253,240,2,16,253,240,
+2,16,1,87,253,144,0,3,0,70,0,0,4,243,5,182,0,27,0,31,0,32,0,0,1,3,33,21,33,
+3,35,19,33,3,35,19,35,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,19,
+33,19,3,215,59,1,16,254,213,69,144,71,254,227,70,141,66,255,1,25,62,254,243,
+1,37,68,144,67,1,31,69,141,69,1,1,252,252,1,30,60,254,227,247,3,39,254,201,
+135,254,151,1,105,254,151,1,105,135,1,55,134,1,98,254,158,1,98,254,158,134,
+254,201,1,55,2,143,0,5,0,117,255,236,6,42,5,14,0,10,0,20,0,24,0,35,0,45,0,
+0,1,34,38,53,16,33,50,22,21,20,6,39,50,53,52,35,34,6,21,20,22,1,1,35,1,19,
+34,38,53,16,33,50,22,21,20,6,39,50,53,52,35,34,6,21,20,22,1,157,142,154,1,
+40,145,156,151,150,153,153,78,70,70,3,221,252,235,160,3,23,112,143,153,1,
+40,146,154,153,147,153,153,78,70,70,2,42,191,180,1,113,190,179,184,187,131,
+240,240,120,120,120,120,2,77,251,6,4,250,250,242,194,177,1,113,190,179,187,
+184,132,239,240,119,121,120,119,0,3,0,206,3,197,1,177,7,44,0,3,0,4,0,5,0,
+0,1,3,35,3,19,19,1,177,51,125,51,137,15,5,213,253,240,2,16,254,231,2,112,
+0,0,4,0,140,253,220,2,179,7,44,0,12,0,13,0,14,0,15,0,0,1,51,0,17,16,18,23,
+35,38,2,17,16,18,19,19,3,1,180,166,254,225,146,143,168,143,153,153,213,185,
+191,6,167,254,56,253,210,254,233,253,241,221,197,2,18,1,46,1,48,2,3,254,214,
+2,112,246,176,0,4,0,120,253,220,2,72,7,44,0,12,0,13,0,14,0,15,0,0,1,35,0,
+17,16,2,39,51,22,18,17,16,2,3,19,19,1,32,166,1,31,146,143,168,143,153,153,
+246,6,129,254,174,1,200,2,46,1,23,2,15,221,197,253,238,254,210,254,208,253,
+253,7,189,253,144,249,32,0,2,0,130,2,88,4,68,5,245,0,14,0,15,0,0,1,3,37,23,
+5,19,7,3,3,39,19,37,55,5,3,7,2,200,43,1,141,26,254,134,245,178,176,158,184,
+242,254,137,29,1,135,43,57,5,245,254,119,111,193,28,254,186,96,1,102,254,
+154,96,1,70,28,193,111,1,137,63,0,2,0,102,0,159,4,2,4,188,0,11,0,12,0,0,1,
+33,53,33,17,51,17,33,21,33,17,35,3,1,233,254,125,1,131,150,1,131,254,125,
+150,57,2,33,150,1,132,254,124,150,254,126,4,29,0,1,0,143,254,248,1,201,0,
+238,0,6,0,0,37,23,6,3,35,18,55,1,186,15,51,125,138,67,34,238,23,197,254,230,
+1,23,223,0,0,2,0,100,2,12,2,84,4,188,0,3,0,4,0,0,19,53,33,21,1,100,1,240,
+254,141,2,12,168,168,2,176,0,1,0,147,255,227,1,145,0,250,0,11,0,0,37,50,22,
+21,20,6,35,34,38,53,52,54,1,18,61,66,67,60,60,67,66,250,71,68,67,73,74,66,
+67,72,0,4,0,86,253,220,3,25,7,44,0,3,0,4,0,5,0,6,0,0,1,1,35,1,3,19,3,3,25,
+253,231,170,2,27,193,49,197,6,169,248,4,7,252,254,19,2,112,246,176,0,0,2,
+0,98,255,236,4,8,5,205,0,11,0,23,0,0,5,34,2,17,16,18,51,50,18,17,16,2,39,
+50,18,17,16,2,35,34,2,17,16,18,2,51,229,236,229,236,232,237,232,237,147,138,
+138,147,148,132,133,20,1,131,1,110,1,126,1,114,254,125,254,147,254,128,254,
+143,155,1,25,1,61,1,59,1,25,254,230,254,198,254,197,254,229,0,0,1,0,178,0,
+0,2,199,5,182,0,10,0,0,33,35,17,52,55,6,7,7,39,1,51,2,199,176,8,39,82,148,
+96,1,127,150,3,145,123,238,43,70,121,123,1,43,0,1,0,96,0,0,3,240,5,203,0,
+28,0,0,33,33,53,1,62,4,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,6,7,1,21,
+33,3,240,252,112,1,94,118,86,64,36,16,128,108,95,153,69,102,191,230,194,224,
+72,128,150,254,231,2,177,156,1,125,128,102,102,89,82,45,114,130,77,60,119,
+172,212,179,96,183,178,162,254,213,8,0,1,0,82,255,236,3,238,5,203,0,40,0,
+0,1,21,22,22,21,20,4,33,34,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,
+53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,2,133,177,184,254,236,254,251,
+242,145,87,203,93,173,181,192,189,133,133,160,176,136,114,107,163,74,92,89,
+225,122,206,231,164,3,2,6,22,181,145,203,233,79,170,46,50,144,145,127,131,
+151,152,125,102,119,67,54,125,72,78,198,165,138,185,0,2,0,23,0,0,4,63,5,190,
+0,10,0,20,0,0,1,35,17,35,17,33,53,1,51,17,51,33,17,52,55,55,35,6,6,7,1,4,
+63,213,176,253,93,2,151,188,213,254,123,10,3,9,17,54,19,254,101,1,72,254,
+184,1,72,159,3,215,252,48,1,100,153,194,85,49,103,28,253,160,0,1,0,131,255,
+236,3,246,5,182,0,28,0,0,55,53,22,22,51,50,54,53,52,38,35,34,7,39,19,33,21,
+33,3,54,51,50,4,21,20,4,35,34,38,131,65,208,88,167,168,176,168,89,142,90,
+55,2,178,253,236,39,107,102,210,1,3,254,236,251,103,188,59,172,45,51,162,
+152,143,151,26,57,2,176,166,254,93,20,229,199,234,255,40,0,0,2,0,113,255,
+236,4,10,5,203,0,23,0,37,0,0,1,21,38,35,34,2,3,51,54,51,50,22,21,20,2,35,
+34,38,2,53,16,0,33,50,19,52,38,35,34,6,6,21,20,22,22,51,50,54,3,156,71,95,
+224,225,10,12,95,212,195,221,241,203,133,215,129,1,64,1,63,104,2,137,127,
+86,141,72,63,136,94,126,144,5,184,155,24,254,230,254,206,170,238,206,228,
+254,249,136,1,38,215,1,180,1,166,252,12,145,156,80,123,63,88,170,115,172,
+0,1,0,90,0,0,4,6,5,182,0,6,0,0,33,1,33,53,33,21,1,1,25,2,51,253,14,3,172,
+253,213,5,16,166,145,250,219,0,0,3,0,106,255,236,4,0,5,205,0,22,0,34,0,47,
+0,0,1,22,22,21,20,6,35,34,38,53,16,37,38,38,53,52,54,51,50,22,21,20,6,37,
+54,54,53,52,38,35,34,6,21,20,22,23,6,6,21,20,22,51,50,54,53,52,38,39,2,203,
+162,147,252,207,217,242,1,27,126,109,233,178,182,230,126,254,228,126,106,
+126,110,106,125,99,108,126,128,143,133,136,149,126,151,3,6,86,191,116,181,
+220,207,186,1,1,136,79,182,108,161,189,189,163,114,177,6,57,132,89,101,106,
+106,101,90,125,215,60,155,110,116,124,131,117,90,139,74,0,0,2,0,106,255,236,
+4,4,5,203,0,24,0,38,0,0,23,53,22,51,50,54,54,55,35,6,35,34,38,53,52,18,51,
+50,0,17,16,0,33,34,38,19,20,22,51,50,54,54,53,52,38,38,35,34,6,217,67,99,
+167,198,85,9,13,95,212,195,221,239,206,220,1,1,254,192,254,193,51,103,48,
+137,127,88,140,71,65,135,93,128,142,2,156,25,149,246,193,170,238,206,226,
+1,10,254,170,254,209,254,75,254,91,12,3,231,145,156,82,122,62,90,172,111,
+174,0,0,3,0,175,255,227,1,173,4,188,0,11,0,23,0,24,0,0,1,50,22,21,20,6,35,
+34,38,53,52,54,19,50,22,21,20,6,35,34,38,53,52,54,19,1,46,63,64,68,59,60,
+67,63,64,61,66,67,60,60,67,66,77,4,102,72,67,66,73,73,66,67,72,252,148,71,
+68,67,73,74,66,67,72,3,194,0,0,3,0,158,254,248,1,240,4,188,0,11,0,18,0,19,
+0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,23,6,3,35,18,55,19,1,113,63,64,68,
+59,60,67,63,152,15,51,125,138,67,34,18,4,102,72,67,66,73,73,66,67,72,252,
+136,23,197,254,230,1,23,223,3,206,0,2,0,102,0,117,4,2,4,188,0,6,0,7,0,0,37,
+1,53,1,21,9,2,4,2,252,100,3,156,253,33,2,223,254,182,117,1,168,102,1,225,
+160,254,148,254,190,3,166,0,3,0,102,1,85,4,2,4,188,0,3,0,7,0,8,0,0,19,53,
+33,21,1,53,33,21,1,102,3,156,252,100,3,156,254,169,2,239,149,149,254,102,
+150,150,3,103,0,2,0,102,0,117,4,2,4,188,0,6,0,7,0,0,19,1,1,53,1,21,1,1,102,
+2,224,253,32,3,156,252,100,1,102,1,22,1,66,1,108,160,254,31,102,254,88,4,
+71,0,0,2,0,126,255,227,3,126,5,203,0,27,0,39,0,0,1,53,52,54,55,62,2,53,52,
+38,35,34,6,7,39,54,51,50,22,21,20,6,7,6,6,21,21,7,50,22,21,20,6,35,34,38,
+53,52,54,1,114,79,91,81,67,32,119,109,83,150,70,63,199,167,187,215,79,136,
+109,61,60,61,66,67,60,60,67,66,1,158,37,129,143,76,69,82,94,64,97,118,52,
+34,145,101,200,173,108,167,118,94,105,86,18,164,71,68,67,73,74,66,67,72,0,
+4,0,221,253,220,2,106,7,44,0,7,0,8,0,9,0,10,0,0,1,33,17,33,21,35,17,51,11,
+2,2,106,254,115,1,141,232,232,145,8,152,254,173,7,251,143,249,35,5,128,2,
+112,246,176,0,4,0,86,253,220,3,25,7,44,0,3,0,4,0,5,0,6,0,0,19,1,35,1,1,3,
+3,254,2,27,168,253,229,1,210,124,37,6,167,248,6,7,250,254,21,2,112,246,176,
+0,0,4,0,110,253,220,1,252,7,44,0,7,0,8,0,9,0,10,0,0,23,51,17,35,53,33,17,
+33,27,2,110,231,231,1,142,254,114,90,80,7,196,6,220,143,248,6,6,15,2,112,
+246,176,0,1,0,60,2,37,4,44,5,193,0,6,0,0,19,1,51,1,35,1,1,60,1,203,102,1,
+191,161,254,175,254,163,2,37,3,156,252,100,2,223,253,33,0,1,255,252,254,188,
+3,78,255,72,0,3,0,0,1,33,53,33,3,78,252,174,3,82,254,188,140,0,0,4,0,90,253,
+220,2,179,7,44,0,29,0,30,0,31,0,32,0,0,5,20,22,23,21,38,38,53,17,52,38,35,
+53,50,54,53,17,52,54,55,21,6,6,21,17,20,7,21,22,21,1,19,19,1,251,78,106,172,
+178,129,122,122,129,178,172,106,78,216,216,254,162,37,86,37,78,75,2,147,3,
+147,138,1,216,101,84,152,84,101,1,217,136,148,3,146,2,75,78,254,41,203,41,
+11,41,202,3,11,2,112,246,176,0,4,0,240,253,220,2,114,7,44,0,3,0,4,0,5,0,6,
+0,0,1,51,17,35,3,19,3,1,223,147,147,239,74,20,6,167,248,6,6,15,2,112,246,
+176,0,4,0,110,253,220,2,199,7,44,0,29,0,30,0,31,0,32,0,0,1,52,55,53,38,53,
+17,52,38,39,53,22,22,21,17,20,22,51,21,34,6,21,17,20,6,7,53,54,54,53,1,19,
+3,1,37,217,217,77,106,173,177,123,128,123,128,178,172,106,77,1,72,11,107,
+1,177,202,41,11,41,203,1,215,79,74,2,146,3,148,136,254,39,98,87,152,84,101,
+254,40,137,148,3,147,2,74,79,4,225,2,112,246,176,0,0,2,0,102,1,229,4,2,4,
+188,0,23,0,24,0,0,19,53,54,51,50,22,23,22,22,51,50,54,55,21,6,35,34,38,39,
+38,38,35,34,6,1,102,100,148,54,91,103,80,76,45,51,122,54,99,149,59,96,93,
+81,73,46,50,119,1,173,1,229,162,108,19,44,34,22,65,56,162,108,23,40,35,21,
+63,2,157,255,255,0,100,2,12,2,84,4,188,2,2,2,174,0,0,0,2,0,82,2,23,3,174,
+4,188,0,3,0,4,0,0,19,53,33,21,1,82,3,92,254,150,2,23,168,168,2,165,0,2,0,
+82,2,23,7,174,4,188,0,3,0,4,0,0,19,53,33,21,1,82,7,92,250,90,2,23,168,168,
+2,165,0,3,0,148,3,224,1,205,7,44,0,6,0,7,0,8,0,0,19,39,54,19,51,6,7,19,3,
+162,14,54,122,137,62,38,70,104,3,224,22,208,1,15,252,249,3,76,253,144,0,3,
+0,146,3,224,1,203,7,44,0,6,0,7,0,8,0,0,1,23,6,3,35,18,55,19,3,1,189,14,50,
+126,137,70,30,136,56,5,213,22,197,254,230,1,47,198,1,87,253,144,0,4,0,149,
+3,224,3,79,7,44,0,6,0,13,0,14,0,15,0,0,1,39,54,19,51,6,7,33,39,54,19,51,6,
+7,19,19,2,36,14,54,122,137,62,38,253,184,14,54,122,137,62,38,220,92,3,224,
+22,208,1,15,255,246,22,208,1,15,255,246,3,76,253,144,0,4,0,146,3,224,3,76,
+7,44,0,6,0,13,0,14,0,15,0,0,1,23,6,3,35,18,55,33,23,6,3,35,18,55,3,19,1,189,
+14,50,126,137,70,30,2,72,14,50,126,137,70,30,3,56,5,213,22,197,254,230,1,
+47,198,22,197,254,230,1,47,198,1,87,253,144,0,3,0,147,255,227,5,219,0,250,
+0,11,0,23,0,35,0,0,37,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,
+34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,1,18,61,66,67,60,60,67,
+66,2,98,61,66,67,60,60,67,66,2,98,61,66,67,60,54,73,67,250,71,68,67,73,74,
+66,67,72,71,68,67,73,74,66,67,72,71,68,67,73,66,74,70,69,0,2,0,141,0,196,
+3,221,4,188,0,11,0,12,0,0,1,1,55,1,1,23,1,1,7,1,1,39,1,1,203,254,194,105,
+1,61,1,66,104,254,191,1,63,102,254,190,254,195,103,1,213,2,106,1,63,105,254,
+194,1,62,103,254,191,254,192,102,1,61,254,197,103,3,143,0,0,4,0,102,0,155,
+4,2,4,188,0,11,0,15,0,27,0,28,0,0,1,50,22,21,20,6,35,34,38,53,52,54,1,53,
+33,21,5,50,22,21,20,6,35,34,38,53,52,54,19,2,51,55,60,62,53,54,60,59,254,
+106,3,156,254,49,55,60,62,53,54,60,59,148,4,79,64,61,60,65,67,58,61,64,253,
+210,150,150,140,64,61,60,65,67,58,61,64,3,39,0,0,2,0,102,2,33,4,2,4,188,0,
+3,0,4,0,0,19,53,33,21,1,102,3,156,254,110,2,33,150,150,2,155,0,2,0,147,0,
+0,4,19,4,250,0,28,0,29,0,0,1,6,6,7,1,35,1,55,51,50,54,54,55,33,53,33,46,2,
+35,35,53,33,21,33,22,23,33,21,19,2,206,14,181,167,1,177,210,254,80,20,92,
+104,111,66,11,254,108,1,146,11,64,99,92,136,3,96,254,128,71,19,1,38,32,3,
+56,133,158,25,254,4,1,249,146,35,79,59,146,53,75,30,146,146,52,106,146,1,
+132,0,0,1,1,142,0,0,2,51,4,188,0,3,0,0,33,17,51,17,1,142,165,4,188,251,68,
+0,0,2,1,142,0,0,3,245,4,188,0,3,0,7,0,0,33,17,51,17,33,17,51,17,3,80,165,
+253,153,165,4,188,251,68,4,188,251,68,0,1,253,128,254,118,254,98,255,100,
+0,11,0,0,5,50,22,21,20,6,35,34,38,53,52,54,253,241,47,66,66,47,47,66,66,156,
+71,48,49,70,71,48,48,71,0,3,254,126,4,210,255,96,7,44,0,11,0,12,0,13,0,0,
+1,50,22,21,20,6,35,34,38,53,52,54,19,19,254,239,47,66,66,47,47,66,66,32,55,
+6,250,71,48,49,70,71,48,48,71,253,216,2,90,0,0,1,254,126,6,62,255,96,7,44,
+0,11,0,0,1,50,22,21,20,6,35,34,38,53,52,54,254,239,47,66,66,47,47,66,66,7,
+44,71,48,49,70,71,48,48,71,0,0,1,0,160,0,0,1,69,4,188,0,3,0,0,51,17,51,17,
+160,165,4,188,251,68,0,2,0,160,0,0,2,223,4,188,0,3,0,7,0,0,33,17,51,17,33,
+17,51,17,2,58,165,253,193,165,4,188,251,68,4,188,251,68,0,3,0,160,0,0,4,121,
+4,188,0,3,0,7,0,11,0,0,33,17,51,17,33,17,51,17,33,17,51,17,2,58,165,253,193,
+165,2,143,165,4,188,251,68,4,188,251,68,4,188,251,68,0,0,1,0,81,3,38,4,169,
+4,212,0,3,0,0,19,1,23,1,81,4,48,40,251,209,3,200,1,12,163,254,245,0,0,2,0,
+81,1,166,4,169,4,212,0,3,0,7,0,0,19,1,23,1,7,1,23,1,81,4,48,40,251,209,41,
+4,48,40,251,209,3,200,1,12,163,254,245,222,1,12,163,254,245,0,0,3,0,81,0,
+36,4,169,4,212,0,3,0,7,0,11,0,0,19,1,23,1,7,1,23,1,7,1,23,1,81,4,48,40,251,
+209,41,4,48,40,251,209,41,4,48,40,251,209,3,200,1,12,163,254,245,222,1,12,
+163,254,245,224,1,12,163,254,245,0,0,3,0,50,1,56,3,37,4,188,0,12,0,24,0,25,
+0,0,1,34,38,53,52,54,51,50,22,22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,
+1,1,216,148,187,185,150,98,152,83,185,149,83,95,96,82,82,96,98,254,11,1,56,
+176,139,133,179,81,143,88,136,179,1,229,96,74,79,93,93,79,74,96,1,159,0,0,
+5,0,50,0,147,4,3,4,222,0,16,0,28,0,29,0,30,0,31,0,0,1,6,7,22,22,21,20,6,35,
+34,38,53,52,54,55,1,23,1,34,6,21,20,22,51,50,54,53,52,38,39,1,37,3,65,129,
+167,117,131,185,148,148,187,97,110,2,91,95,253,197,83,95,95,83,82,96,98,104,
+2,88,252,47,3,210,102,114,25,161,114,136,179,177,138,93,139,85,1,211,119,
+254,17,95,75,79,94,94,79,74,96,142,1,74,108,0,1,254,191,254,128,1,248,4,211,
+0,19,0,0,5,22,51,50,54,54,53,52,2,39,55,22,18,21,16,2,4,35,34,39,254,202,
+106,75,164,203,98,69,61,166,62,70,137,254,233,213,89,107,213,22,115,245,219,
+189,1,195,214,37,213,254,19,195,254,248,254,204,146,22,0,3,254,191,253,213,
+2,179,4,212,0,30,0,31,0,32,0,0,1,22,51,50,36,54,53,52,38,39,38,38,53,52,54,
+55,23,6,6,21,20,22,23,22,22,21,20,0,33,34,39,1,1,254,195,41,64,187,1,0,129,
+60,53,56,58,254,255,49,205,188,50,65,51,63,254,142,254,150,59,57,3,190,253,
+11,254,180,6,86,172,124,95,193,109,115,175,85,159,210,51,155,37,130,102,62,
+142,135,110,215,108,251,254,232,6,6,39,249,147,0,0,0,0,15,0,186,0,3,0,1,4,
+9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,
+1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,
+0,3,0,1,4,9,0,6,0,32,0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,
+1,92,0,3,0,1,4,9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,
+11,0,62,2,14,0,3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,
+0,1,4,9,0,14,0,52,5,30,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,71,0,117,0,106,0,97,0,114,0,97,
+0,116,0,105,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,71,0,117,
+0,106,0,97,0,114,0,97,0,116,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,
+0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,
+0,110,0,115,0,71,0,117,0,106,0,97,0,114,0,97,0,116,0,105,0,78,0,111,0,116,
+0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,
+0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,
+110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,
+0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,
+0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,
+0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,
+0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,
+0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,
+0,1,0,0,0,12,0,250,0,0,7,192,0,2,0,39,0,4,0,5,0,3,0,6,0,54,0,1,0,55,0,55,
+0,3,0,56,0,59,0,1,0,60,0,66,0,3,0,67,0,69,0,1,0,70,0,70,0,3,0,72,0,73,0,1,
+0,74,0,75,0,3,0,91,0,91,0,1,0,92,0,127,0,2,0,128,0,128,0,3,0,129,0,129,0,
+4,0,130,1,142,0,2,1,143,1,143,0,1,1,144,1,149,0,2,1,150,1,158,0,3,1,159,1,
+167,0,2,1,168,1,168,0,3,1,169,1,186,0,2,1,187,1,188,0,1,1,189,1,198,0,2,1,
+199,1,219,0,1,1,220,2,60,0,2,2,61,2,67,0,1,2,68,2,73,0,2,2,74,2,74,0,1,2,
+75,2,75,0,2,2,76,2,76,0,1,2,77,2,87,0,2,2,88,2,102,0,3,2,103,2,103,0,4,2,
+104,2,109,0,1,2,110,2,127,0,2,2,128,2,128,0,3,2,129,2,130,0,1,2,131,2,136,
+0,2,2,137,2,155,0,3,2,156,2,163,0,2,1,252,0,252,6,154,6,158,5,148,5,152,4,
+144,5,4,4,120,5,98,3,248,3,254,5,148,5,148,5,148,5,152,5,152,5,152,5,238,
+4,4,4,14,4,24,4,34,4,40,4,50,4,60,4,70,4,90,4,114,4,80,6,110,4,90,6,158,6,
+150,6,122,6,126,4,150,6,158,4,98,6,154,6,158,4,102,4,108,6,174,4,158,4,138,
+4,144,6,138,4,170,4,176,6,180,6,186,4,126,4,114,4,182,6,110,4,120,6,162,4,
+158,4,164,4,170,4,176,6,180,6,186,4,126,4,182,4,158,4,138,4,170,4,176,6,180,
+6,186,4,126,4,182,5,190,4,158,4,138,4,144,4,132,4,170,4,176,6,180,6,186,5,
+222,5,98,4,182,4,154,4,188,6,192,4,158,4,138,4,144,4,150,4,170,4,176,6,180,
+6,186,6,30,5,98,4,182,4,154,4,188,4,158,4,164,4,170,4,176,6,180,6,186,6,30,
+4,182,4,188,4,158,4,164,4,170,4,176,6,180,6,186,6,30,4,182,4,188,6,22,4,194,
+4,200,4,206,4,212,4,218,4,224,4,230,4,236,4,242,4,248,5,92,4,254,5,4,5,10,
+5,16,5,22,5,254,5,28,5,36,5,44,6,90,5,52,6,22,5,254,5,60,5,70,5,76,5,86,5,
+92,5,98,5,104,5,110,6,170,6,166,5,116,6,122,6,122,6,134,5,120,5,124,5,128,
+6,166,5,132,5,136,5,140,5,144,5,148,5,148,5,148,5,152,5,152,5,152,5,156,5,
+160,5,164,5,170,5,174,5,214,5,178,5,156,5,160,5,164,5,170,5,174,5,214,5,178,
+5,186,5,186,6,142,5,190,6,142,5,190,5,198,5,206,5,254,5,214,5,222,5,230,6,
+42,6,98,5,238,5,246,6,82,5,254,6,6,6,14,6,22,6,90,6,74,6,82,6,90,6,98,6,30,
+6,36,6,42,6,50,6,56,6,62,6,68,6,74,6,82,6,90,6,98,6,138,6,138,6,154,6,106,
+6,110,6,114,6,118,6,150,6,122,6,126,6,158,6,130,6,134,6,138,6,142,6,146,6,
+150,6,154,6,158,6,162,6,166,6,170,6,174,6,180,6,186,6,192,6,174,6,180,6,186,
+6,192,0,1,0,252,0,4,0,5,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,
+17,0,18,0,19,0,20,0,21,0,25,0,27,0,28,0,29,0,31,0,32,0,33,0,34,0,38,0,42,
+0,47,0,49,0,54,0,55,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,70,0,72,0,73,0,92,
+0,96,0,98,0,99,0,100,0,102,0,103,0,104,0,105,0,109,0,113,0,118,0,120,0,125,
+0,128,0,134,0,136,0,140,0,141,0,142,0,143,0,147,0,156,0,170,0,172,0,176,0,
+177,0,178,0,179,0,183,0,192,0,200,0,204,0,206,0,207,0,208,0,210,0,211,0,212,
+0,213,0,217,0,221,0,226,0,228,0,233,0,236,0,240,0,242,0,243,0,244,0,246,0,
+247,0,248,0,249,0,253,1,1,1,6,1,8,1,13,1,18,1,20,1,24,1,25,1,26,1,27,1,31,
+1,40,1,47,1,54,1,56,1,60,1,61,1,62,1,63,1,67,1,76,1,83,1,84,1,87,1,88,1,89,
+1,90,1,93,1,96,1,97,1,98,1,99,1,100,1,103,1,104,1,106,1,107,1,108,1,110,1,
+113,1,114,1,115,1,116,1,117,1,118,1,119,1,122,1,130,1,131,1,132,1,133,1,135,
+1,136,1,139,1,140,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,
+168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,180,1,183,
+1,184,1,185,1,186,1,187,1,188,1,190,1,193,1,194,1,195,1,196,1,197,1,198,1,
+215,1,238,2,3,2,8,2,27,2,32,2,55,2,56,2,59,2,60,2,61,2,62,2,63,2,64,2,65,
+2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,
+2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,90,2,92,2,94,2,95,2,96,2,97,2,99,
+2,100,2,101,2,102,2,137,2,138,2,139,2,140,2,149,2,150,2,151,2,152,2,153,2,
+154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,0,2,0,18,0,64,0,
+2,0,39,0,56,0,4,0,49,0,50,0,51,0,52,0,4,0,60,0,61,0,62,0,63,0,4,0,61,0,62,
+0,63,0,64,0,2,0,31,0,48,0,4,0,41,0,42,0,43,0,44,0,4,0,42,0,43,0,44,0,45,0,
+4,0,37,0,38,0,39,0,40,0,4,0,54,0,55,0,56,0,57,0,4,0,39,0,40,0,41,0,42,0,3,
+0,50,0,51,0,52,0,1,0,13,0,2,0,18,0,74,0,2,0,34,0,73,0,2,0,61,0,62,0,2,0,50,
+0,51,0,2,0,51,0,52,0,2,0,36,0,53,0,2,0,61,0,63,0,2,0,62,0,63,0,1,0,36,0,1,
+0,56,0,2,0,49,0,50,0,2,0,26,0,63,0,2,0,41,0,42,0,2,0,42,0,45,0,2,0,40,0,42,
+0,2,0,46,0,47,0,2,0,92,0,93,0,2,0,86,0,87,0,2,0,93,0,94,0,2,0,81,0,82,0,2,
+0,91,0,92,0,2,0,64,0,65,0,2,0,83,0,84,0,2,0,87,0,88,0,2,0,71,0,72,0,2,0,95,
+0,96,0,2,0,97,0,98,0,2,0,67,0,68,0,2,0,88,0,89,0,2,0,82,0,83,0,2,0,102,0,
+103,0,3,0,83,0,84,0,85,0,3,0,59,0,60,0,61,0,3,0,78,0,79,0,80,0,3,0,66,0,67,
+0,68,0,4,0,69,0,70,0,71,0,72,0,2,0,69,0,70,0,4,0,70,0,71,0,72,0,73,0,2,0,
+70,0,73,0,2,0,76,0,77,0,2,0,63,0,64,0,2,0,72,0,73,0,2,0,68,0,69,0,1,0,40,
+0,1,0,38,0,1,0,39,0,1,0,51,0,1,0,50,0,1,0,63,0,1,0,62,0,1,0,67,0,1,0,66,0,
+1,0,80,0,1,0,77,0,1,0,65,0,2,0,56,0,57,0,1,0,49,0,1,0,53,0,3,0,63,0,64,0,
+65,0,1,0,44,0,3,0,44,0,45,0,46,0,3,0,65,0,66,0,67,0,3,0,52,0,53,0,54,0,3,
+0,61,0,62,0,63,0,3,0,47,0,48,0,49,0,3,0,57,0,58,0,59,0,3,0,42,0,43,0,44,0,
+3,0,35,0,36,0,37,0,3,0,62,0,63,0,64,0,3,0,84,0,85,0,86,0,3,0,51,0,52,0,53,
+0,3,0,79,0,80,0,81,0,2,0,47,0,49,0,2,0,57,0,59,0,3,0,60,0,61,0,62,0,2,0,36,
+0,38,0,2,0,42,0,44,0,2,0,35,0,37,0,2,0,54,0,56,0,3,0,48,0,49,0,50,0,3,0,54,
+0,55,0,56,0,3,0,58,0,59,0,60,0,3,0,36,0,37,0,38,0,1,0,41,0,1,0,54,0,1,0,73,
+0,1,0,20,0,1,0,25,0,1,0,19,0,1,0,35,0,1,0,37,0,1,0,31,0,1,0,48,0,1,0,2,0,
+1,0,23,0,1,0,26,0,1,0,12,0,1,0,16,0,1,0,28,0,1,0,24,0,2,0,43,0,44,0,2,0,38,
+0,40,0,2,0,55,0,57,0,2,0,44,0,46,0,2,0,17,0,4,0,5,0,1,0,55,0,55,0,3,0,60,
+0,63,0,3,0,64,0,66,0,1,0,70,0,70,0,3,0,128,0,128,0,1,1,150,1,158,0,1,1,168,
+1,168,0,1,2,88,2,88,0,4,2,90,2,90,0,4,2,92,2,92,0,4,2,94,2,97,0,4,2,99,2,
+102,0,3,2,137,2,140,0,3,2,149,2,150,0,3,2,151,2,154,0,2,2,155,2,155,0,3,0,
+0,0,1,0,0,0,10,0,56,0,102,0,2,103,106,114,50,0,14,103,117,106,114,0,18,0,
+8,0,0,0,16,0,0,0,0,255,255,0,3,0,0,0,1,0,2,0,0,255,255,0,3,0,0,0,1,0,2,0,
+3,97,98,118,109,0,20,98,108,119,109,0,28,100,105,115,116,0,36,0,0,0,2,0,0,
+0,1,0,0,0,2,0,2,0,3,0,0,0,3,0,4,0,5,0,7,0,10,0,22,9,252,17,234,22,100,23,
+214,35,14,35,106,35,130,36,56,36,88,0,4,0,0,0,1,0,8,0,1,0,12,0,46,0,1,1,174,
+2,112,0,2,0,5,0,4,0,5,0,0,0,64,0,66,0,2,0,128,0,128,0,5,1,150,1,158,0,6,1,
+168,1,168,0,15,0,1,0,190,0,9,0,10,0,11,0,12,0,13,0,14,0,21,0,25,0,27,0,28,
+0,29,0,31,0,32,0,33,0,34,0,38,0,42,0,47,0,49,0,54,0,72,0,73,0,92,0,96,0,98,
+0,99,0,100,0,102,0,103,0,104,0,105,0,109,0,113,0,118,0,120,0,125,0,134,0,
+136,0,140,0,141,0,142,0,143,0,147,0,156,0,170,0,172,0,176,0,177,0,178,0,179,
+0,183,0,192,0,200,0,204,0,206,0,207,0,208,0,210,0,211,0,212,0,213,0,217,0,
+221,0,226,0,228,0,233,0,236,0,240,0,242,0,243,0,244,0,246,0,247,0,248,0,249,
+0,253,1,1,1,6,1,8,1,13,1,18,1,20,1,24,1,25,1,26,1,27,1,31,1,40,1,47,1,54,
+1,56,1,60,1,61,1,62,1,63,1,67,1,76,1,83,1,84,1,87,1,88,1,89,1,90,1,93,1,96,
+1,97,1,98,1,99,1,100,1,103,1,104,1,106,1,107,1,108,1,110,1,113,1,114,1,115,
+1,116,1,117,1,118,1,119,1,122,1,130,1,131,1,132,1,133,1,135,1,136,1,139,1,
+140,1,180,1,183,1,184,1,185,1,186,1,187,1,188,1,190,1,193,1,194,1,195,1,196,
+1,197,1,198,1,215,1,238,2,3,2,8,2,27,2,32,2,55,2,56,2,59,2,60,2,61,2,62,2,
+63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,
+2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,156,2,157,2,158,2,159,
+2,160,2,161,2,162,2,163,0,16,0,0,0,66,0,0,0,74,0,0,0,82,0,0,0,90,0,0,0,98,
+0,0,0,106,0,0,0,114,0,0,0,122,0,0,0,130,0,0,0,138,0,0,0,146,0,0,0,154,0,0,
+0,162,0,0,0,170,0,0,0,178,0,0,0,186,0,2,254,154,4,210,0,26,0,2,254,154,4,
+210,0,12,0,2,254,154,4,210,0,12,0,2,254,154,4,210,0,13,0,2,254,154,4,210,
+0,26,0,2,254,154,4,210,0,16,0,2,254,154,4,210,0,24,0,2,254,154,4,210,0,28,
+0,2,254,154,4,210,0,40,0,2,254,154,4,210,0,25,0,2,254,154,4,210,0,25,0,2,
+254,154,4,210,0,37,0,2,254,154,4,210,0,38,0,2,254,154,4,210,0,39,0,2,254,
+154,4,210,0,51,0,2,254,154,4,210,0,28,0,190,1,126,1,134,1,142,1,150,1,158,
+1,166,1,174,1,182,1,190,1,198,1,206,1,214,1,222,1,230,1,238,1,246,1,254,2,
+6,2,14,2,22,2,30,2,38,2,46,2,54,2,62,2,70,2,78,2,86,2,94,2,102,2,110,2,118,
+2,126,2,134,2,142,2,150,2,158,2,166,2,174,2,182,2,190,2,198,2,206,2,214,2,
+222,2,230,2,238,2,246,2,254,3,6,3,14,3,22,3,30,3,38,3,46,3,54,3,62,3,70,3,
+78,3,86,3,94,3,102,3,110,3,118,3,126,3,134,3,142,3,150,3,158,3,166,3,174,
+3,182,3,190,3,198,3,206,3,214,3,222,3,230,3,238,3,246,3,254,4,6,4,14,4,22,
+4,30,4,38,4,46,4,54,4,62,4,70,4,78,4,86,4,94,4,102,4,110,4,118,4,126,4,134,
+4,142,4,150,4,158,4,166,4,174,4,182,4,190,4,198,4,206,4,214,4,222,4,230,4,
+238,4,246,4,254,5,6,5,14,5,22,5,30,5,38,5,46,5,54,5,62,5,70,5,78,5,86,5,94,
+5,102,5,110,5,118,5,126,5,134,5,142,5,150,5,158,5,166,5,174,5,182,5,190,5,
+198,5,206,5,214,5,222,5,230,5,238,5,246,5,254,6,6,6,14,6,22,6,30,6,38,6,46,
+6,54,6,62,6,70,6,78,6,86,6,94,6,102,6,110,6,118,6,126,6,134,6,142,6,150,6,
+158,6,166,6,174,6,182,6,190,6,198,6,206,6,214,6,222,6,230,6,238,6,246,6,254,
+7,6,7,14,7,22,7,30,7,38,7,46,7,54,7,62,7,70,7,78,7,86,7,94,7,102,0,2,1,186,
+4,210,0,63,0,2,0,242,4,210,0,68,0,2,4,28,4,210,0,51,0,2,5,252,4,210,0,64,
+0,2,3,66,4,210,0,18,0,2,3,162,4,210,0,39,0,2,2,132,4,210,0,43,0,2,2,120,4,
+210,0,49,0,2,4,51,4,210,0,61,0,2,5,132,4,210,0,62,0,2,3,165,4,210,0,31,0,
+2,2,56,4,210,0,41,0,2,2,167,4,210,0,42,0,2,2,120,4,210,0,38,0,2,2,90,4,210,
+0,55,0,2,2,47,4,210,0,51,0,2,2,132,4,210,0,61,0,2,2,8,4,210,0,40,0,2,4,19,
+4,210,0,54,0,2,3,116,4,210,0,50,0,2,3,66,4,210,0,18,0,2,3,162,4,210,0,34,
+0,2,2,132,4,210,0,43,0,2,2,120,4,210,0,49,0,2,4,51,4,210,0,61,0,2,5,132,4,
+210,0,62,0,2,3,165,4,210,0,31,0,2,2,56,4,210,0,41,0,2,2,167,4,210,0,42,0,
+2,2,120,4,210,0,38,0,2,2,90,4,210,0,55,0,2,2,47,4,210,0,51,0,2,2,132,4,210,
+0,61,0,2,2,8,4,210,0,40,0,2,4,19,4,210,0,54,0,2,3,116,4,210,0,50,0,2,2,120,
+4,210,0,49,0,2,4,46,4,210,0,26,0,2,2,56,4,210,0,41,0,2,2,167,4,210,0,42,0,
+2,2,120,4,210,0,38,0,2,2,90,4,210,0,55,0,2,2,47,4,210,0,51,0,2,2,8,4,210,
+0,40,0,2,2,120,4,210,0,49,0,2,4,51,4,210,0,61,0,2,2,56,4,210,0,41,0,2,2,167,
+4,210,0,42,0,2,2,120,4,210,0,38,0,2,2,90,4,210,0,55,0,2,2,47,4,210,0,51,0,
+2,2,8,4,210,0,40,0,2,2,157,4,210,0,44,0,2,2,120,4,210,0,49,0,2,4,51,4,210,
+0,61,0,2,5,132,4,210,0,62,0,2,3,165,4,210,0,36,0,2,2,56,4,210,0,41,0,2,2,
+167,4,210,0,42,0,2,2,120,4,210,0,38,0,2,2,90,4,210,0,55,0,2,2,148,4,210,0,
+47,0,2,2,157,4,210,0,63,0,2,2,8,4,210,0,40,0,2,4,19,4,210,0,56,0,2,2,184,
+4,210,0,46,0,2,2,157,4,210,0,44,0,2,2,120,4,210,0,49,0,2,4,51,4,210,0,61,
+0,2,5,132,4,210,0,62,0,2,3,165,4,210,0,36,0,2,2,56,4,210,0,41,0,2,2,167,4,
+210,0,42,0,2,2,120,4,210,0,38,0,2,2,90,4,210,0,55,0,2,2,148,4,210,0,47,0,
+2,2,157,4,210,0,63,0,2,2,8,4,210,0,40,0,2,4,19,4,210,0,56,0,2,2,184,4,210,
+0,46,0,2,2,120,4,210,0,49,0,2,4,46,4,210,0,26,0,2,2,56,4,210,0,41,0,2,2,167,
+4,210,0,42,0,2,2,120,4,210,0,38,0,2,2,90,4,210,0,55,0,2,2,148,4,210,0,47,
+0,2,2,8,4,210,0,40,0,2,2,184,4,210,0,46,0,2,2,120,4,210,0,49,0,2,4,46,4,210,
+0,26,0,2,2,56,4,210,0,41,0,2,2,167,4,210,0,42,0,2,2,120,4,210,0,38,0,2,2,
+90,4,210,0,55,0,2,2,148,4,210,0,47,0,2,2,8,4,210,0,40,0,2,2,184,4,210,0,46,
+0,2,5,146,4,210,0,79,0,2,2,120,4,210,0,92,0,2,2,120,4,210,0,86,0,2,2,120,
+4,210,0,93,0,2,2,120,4,210,0,81,0,2,4,40,4,210,0,91,0,2,2,64,4,210,0,64,0,
+2,2,64,4,210,0,83,0,2,2,64,4,210,0,87,0,2,2,64,4,210,0,71,0,2,2,64,4,210,
+0,95,0,2,2,162,4,210,0,76,0,2,2,162,4,210,0,97,0,2,2,114,4,210,0,67,0,2,2,
+114,4,210,0,88,0,2,2,114,4,210,0,82,0,2,2,101,4,210,0,102,0,2,2,148,4,210,
+0,62,0,2,4,99,4,210,0,83,0,2,2,47,4,210,0,59,0,2,4,99,4,210,0,78,0,2,2,148,
+4,210,0,58,0,2,3,198,4,210,0,66,0,2,3,60,4,210,0,79,0,2,3,178,4,210,0,62,
+0,2,4,142,4,210,0,69,0,2,4,142,4,210,0,69,0,2,5,52,4,210,0,70,0,2,5,52,4,
+210,0,70,0,2,2,214,4,210,0,76,0,2,2,204,4,210,0,63,0,2,2,214,4,210,0,72,0,
+2,2,214,4,210,0,68,0,2,5,112,4,210,0,77,0,2,1,236,4,210,0,65,0,2,2,18,4,210,
+0,56,0,2,1,106,4,210,0,49,0,2,2,0,4,210,0,53,0,2,2,132,4,210,0,62,0,2,2,157,
+4,210,0,63,0,2,5,112,4,210,0,77,0,2,1,236,4,210,0,65,0,2,2,18,4,210,0,56,
+0,2,1,106,4,210,0,49,0,2,2,0,4,210,0,53,0,2,2,132,4,210,0,62,0,2,2,157,4,
+210,0,63,0,2,4,19,4,210,0,44,0,2,4,19,4,210,0,44,0,2,4,19,4,210,0,48,0,2,
+2,184,4,210,0,45,0,2,4,19,4,210,0,48,0,2,2,184,4,210,0,45,0,2,2,214,4,210,
+0,65,0,2,2,214,4,210,0,52,0,2,2,214,4,210,0,62,0,2,2,214,4,210,0,61,0,2,2,
+114,4,210,0,47,0,2,4,40,4,210,0,57,0,2,5,132,4,210,0,60,0,2,2,64,4,210,0,
+36,0,2,2,162,4,210,0,42,0,2,2,114,4,210,0,35,0,2,2,101,4,210,0,54,0,2,2,148,
+4,210,0,62,0,2,4,99,4,210,0,84,0,2,2,47,4,210,0,51,0,2,4,99,4,210,0,79,0,
+2,2,148,4,210,0,58,0,2,2,148,4,210,0,48,0,2,2,132,4,210,0,54,0,2,2,157,4,
+210,0,58,0,2,2,18,4,210,0,36,0,2,2,114,4,210,0,47,0,2,4,40,4,210,0,57,0,2,
+5,132,4,210,0,60,0,2,2,64,4,210,0,36,0,2,2,162,4,210,0,42,0,2,2,114,4,210,
+0,35,0,2,2,101,4,210,0,54,0,2,2,148,4,210,0,48,0,2,2,132,4,210,0,54,0,2,2,
+157,4,210,0,58,0,2,2,18,4,210,0,36,0,2,2,132,4,210,0,43,0,2,2,120,4,210,0,
+38,0,2,2,90,4,210,0,55,0,2,2,157,4,210,0,44,0,2,2,132,4,210,0,43,0,2,2,120,
+4,210,0,38,0,2,2,90,4,210,0,55,0,2,2,157,4,210,0,44,0,4,0,0,0,1,0,8,0,1,0,
+12,0,22,0,1,1,94,1,144,0,2,0,1,2,151,2,154,0,0,0,1,0,162,0,21,0,25,0,27,0,
+28,0,31,0,32,0,33,0,34,0,38,0,42,0,47,0,54,0,92,0,96,0,98,0,99,0,102,0,103,
+0,104,0,105,0,109,0,113,0,118,0,125,0,134,0,136,0,140,0,141,0,142,0,143,0,
+147,0,156,0,170,0,172,0,176,0,177,0,178,0,179,0,183,0,192,0,200,0,204,0,206,
+0,207,0,210,0,211,0,212,0,213,0,217,0,221,0,226,0,233,0,236,0,240,0,242,0,
+243,0,246,0,247,0,248,0,249,0,253,1,1,1,6,1,13,1,18,1,20,1,24,1,25,1,26,1,
+27,1,31,1,40,1,47,1,54,1,56,1,60,1,61,1,62,1,63,1,67,1,76,1,83,1,84,1,87,
+1,88,1,89,1,90,1,93,1,96,1,97,1,98,1,99,1,100,1,103,1,104,1,106,1,107,1,108,
+1,110,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,122,1,130,1,131,1,132,1,
+133,1,135,1,136,1,139,1,140,1,184,1,187,1,188,1,194,1,197,1,198,2,8,2,32,
+2,55,2,56,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,
+2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,
+2,87,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,0,4,0,0,0,18,0,0,0,26,
+0,0,0,34,0,0,0,42,0,2,254,154,4,210,0,26,0,2,254,154,4,210,0,12,0,2,254,154,
+4,210,0,16,0,2,254,154,4,210,0,28,0,162,1,70,1,78,1,86,1,94,1,102,1,110,1,
+118,1,126,1,134,1,142,1,150,1,158,1,166,1,174,1,182,1,190,1,198,1,206,1,214,
+1,222,1,230,1,238,1,246,1,254,2,6,2,14,2,22,2,30,2,38,2,46,2,54,2,62,2,70,
+2,78,2,86,2,94,2,102,2,110,2,118,2,126,2,134,2,142,2,150,2,158,2,166,2,174,
+2,182,2,190,2,198,2,206,2,214,2,222,2,230,2,238,2,246,2,254,3,6,3,14,3,22,
+3,30,3,38,3,46,3,54,3,62,3,70,3,78,3,86,3,94,3,102,3,110,3,118,3,126,3,134,
+3,142,3,150,3,158,3,166,3,174,3,182,3,190,3,198,3,206,3,214,3,222,3,230,3,
+238,3,246,3,254,4,6,4,14,4,22,4,30,4,38,4,46,4,54,4,62,4,70,4,78,4,86,4,94,
+4,102,4,110,4,118,4,126,4,134,4,142,4,150,4,158,4,166,4,174,4,182,4,190,4,
+198,4,206,4,214,4,222,4,230,4,238,4,246,4,254,5,6,5,14,5,22,5,30,5,38,5,46,
+5,54,5,62,5,70,5,78,5,86,5,94,5,102,5,110,5,118,5,126,5,134,5,142,5,150,5,
+158,5,166,5,174,5,182,5,190,5,198,5,206,5,214,5,222,5,230,5,238,5,246,5,254,
+6,6,6,14,6,22,6,30,6,38,6,46,6,54,6,62,6,70,6,78,0,2,1,183,4,210,0,44,0,2,
+1,191,4,210,0,50,0,2,3,122,4,210,0,63,0,2,4,243,4,210,0,63,0,2,1,127,4,210,
+0,42,0,2,1,238,4,210,0,45,0,2,1,191,4,210,0,40,0,2,1,181,4,210,0,57,0,2,1,
+118,4,210,0,52,0,2,1,183,4,210,0,62,0,2,1,94,4,210,0,42,0,2,2,187,4,210,0,
+51,0,2,1,183,4,210,0,44,0,2,1,191,4,210,0,50,0,2,3,122,4,210,0,63,0,2,4,243,
+4,210,0,63,0,2,1,127,4,210,0,42,0,2,1,238,4,210,0,45,0,2,1,191,4,210,0,40,
+0,2,1,181,4,210,0,57,0,2,1,118,4,210,0,52,0,2,1,183,4,210,0,62,0,2,1,94,4,
+210,0,42,0,2,2,187,4,210,0,51,0,2,1,191,4,210,0,50,0,2,3,122,4,210,0,63,0,
+2,1,127,4,210,0,42,0,2,1,238,4,210,0,45,0,2,1,191,4,210,0,40,0,2,1,181,4,
+210,0,57,0,2,1,118,4,210,0,52,0,2,1,94,4,210,0,42,0,2,1,191,4,210,0,50,0,
+2,3,122,4,210,0,63,0,2,1,127,4,210,0,42,0,2,1,238,4,210,0,45,0,2,1,191,4,
+210,0,40,0,2,1,181,4,210,0,57,0,2,1,118,4,210,0,52,0,2,1,94,4,210,0,42,0,
+2,1,208,4,210,0,46,0,2,1,191,4,210,0,50,0,2,3,122,4,210,0,63,0,2,4,243,4,
+210,0,63,0,2,1,127,4,210,0,42,0,2,1,238,4,210,0,45,0,2,1,191,4,210,0,40,0,
+2,1,181,4,210,0,57,0,2,1,219,4,210,0,49,0,2,1,208,4,210,0,64,0,2,1,94,4,210,
+0,42,0,2,1,235,4,210,0,47,0,2,1,208,4,210,0,46,0,2,1,191,4,210,0,50,0,2,3,
+122,4,210,0,63,0,2,4,243,4,210,0,63,0,2,1,127,4,210,0,42,0,2,1,238,4,210,
+0,45,0,2,1,191,4,210,0,40,0,2,1,181,4,210,0,57,0,2,1,219,4,210,0,49,0,2,1,
+208,4,210,0,64,0,2,1,94,4,210,0,42,0,2,1,235,4,210,0,47,0,2,1,191,4,210,0,
+50,0,2,3,122,4,210,0,63,0,2,1,127,4,210,0,42,0,2,1,238,4,210,0,45,0,2,1,191,
+4,210,0,40,0,2,1,181,4,210,0,57,0,2,1,219,4,210,0,49,0,2,1,94,4,210,0,42,
+0,2,1,235,4,210,0,47,0,2,1,191,4,210,0,50,0,2,3,122,4,210,0,63,0,2,1,127,
+4,210,0,42,0,2,1,238,4,210,0,45,0,2,1,191,4,210,0,40,0,2,1,181,4,210,0,57,
+0,2,1,219,4,210,0,49,0,2,1,94,4,210,0,42,0,2,1,235,4,210,0,47,0,2,4,197,4,
+210,0,81,0,2,1,191,4,210,0,93,0,2,1,191,4,210,0,87,0,2,1,191,4,210,0,94,0,
+2,1,191,4,210,0,82,0,2,3,111,4,210,0,92,0,2,1,135,4,210,0,65,0,2,1,135,4,
+210,0,84,0,2,1,135,4,210,0,88,0,2,1,135,4,210,0,72,0,2,1,135,4,210,0,96,0,
+2,1,233,4,210,0,77,0,2,1,233,4,210,0,98,0,2,1,185,4,210,0,68,0,2,1,185,4,
+210,0,89,0,2,1,185,4,210,0,83,0,2,1,192,4,210,0,103,0,2,1,219,4,210,0,64,
+0,2,3,170,4,210,0,85,0,2,1,118,4,210,0,61,0,2,3,170,4,210,0,80,0,2,1,219,
+4,210,0,60,0,2,3,13,4,210,0,68,0,2,2,131,4,210,0,81,0,2,2,249,4,210,0,64,
+0,2,3,213,4,210,0,70,0,2,3,213,4,210,0,70,0,2,4,123,4,210,0,73,0,2,4,123,
+4,210,0,73,0,2,2,29,4,210,0,77,0,2,2,19,4,210,0,64,0,2,2,29,4,210,0,73,0,
+2,2,29,4,210,0,69,0,2,1,109,4,210,0,57,0,2,1,183,4,210,0,63,0,2,1,228,4,210,
+0,65,0,2,1,109,4,210,0,57,0,2,1,183,4,210,0,63,0,2,1,228,4,210,0,65,0,2,1,
+255,4,210,0,46,0,2,1,255,4,210,0,46,0,2,2,29,4,210,0,67,0,2,2,29,4,210,0,
+54,0,2,2,29,4,210,0,64,0,2,2,29,4,210,0,63,0,2,1,185,4,210,0,49,0,2,3,111,
+4,210,0,59,0,2,4,243,4,210,0,61,0,2,1,135,4,210,0,38,0,2,1,233,4,210,0,44,
+0,2,1,185,4,210,0,37,0,2,1,192,4,210,0,56,0,2,1,219,4,210,0,64,0,2,3,170,
+4,210,0,86,0,2,1,118,4,210,0,53,0,2,3,170,4,210,0,81,0,2,1,219,4,210,0,60,
+0,2,1,219,4,210,0,50,0,2,1,183,4,210,0,56,0,2,1,208,4,210,0,60,0,2,1,104,
+4,210,0,38,0,2,1,185,4,210,0,49,0,2,3,111,4,210,0,59,0,2,4,243,4,210,0,61,
+0,2,1,135,4,210,0,38,0,2,1,233,4,210,0,44,0,2,1,185,4,210,0,37,0,2,1,192,
+4,210,0,56,0,2,1,219,4,210,0,50,0,2,1,183,4,210,0,56,0,2,1,208,4,210,0,60,
+0,2,1,104,4,210,0,38,0,2,1,183,4,210,0,44,0,2,1,191,4,210,0,40,0,2,1,181,
+4,210,0,57,0,2,1,208,4,210,0,46,0,2,1,183,4,210,0,44,0,2,1,191,4,210,0,40,
+0,2,1,181,4,210,0,57,0,2,1,208,4,210,0,46,0,4,0,0,0,1,0,8,0,1,0,12,0,50,0,
+1,0,200,1,150,0,1,0,17,0,55,0,60,0,61,0,62,0,63,0,70,2,99,2,100,2,101,2,102,
+2,137,2,138,2,139,2,140,2,149,2,150,2,155,0,1,0,73,0,7,0,8,0,9,0,10,0,11,
+0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,25,0,27,0,28,0,29,0,31,
+0,32,0,33,0,34,0,38,0,47,0,54,0,72,0,73,0,200,0,208,0,217,1,84,1,113,1,114,
+1,115,1,116,1,117,1,118,1,119,1,122,1,130,1,132,1,169,1,170,1,171,1,172,1,
+173,1,174,1,175,1,176,1,177,1,178,1,187,1,188,1,197,1,198,2,8,2,32,2,55,2,
+56,2,59,2,60,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,84,2,85,2,86,0,17,
+0,0,0,70,0,0,0,78,0,0,0,86,0,0,0,94,0,0,0,102,0,0,0,110,0,0,0,118,0,0,0,126,
+0,0,0,134,0,0,0,142,0,0,0,150,0,0,0,158,0,0,0,166,0,0,0,174,0,0,0,182,0,0,
+0,190,0,0,0,198,0,2,253,241,0,0,0,12,0,2,254,154,0,0,0,23,0,2,254,154,0,0,
+0,25,0,2,254,154,0,0,0,19,0,2,254,154,0,0,0,36,0,2,254,154,0,0,0,12,0,2,254,
+154,0,0,0,23,0,2,254,154,0,0,0,25,0,2,254,154,0,0,0,19,0,2,255,38,0,0,0,12,
+0,2,254,154,0,0,0,35,0,2,254,154,0,0,0,37,0,2,254,154,0,0,0,31,0,2,254,154,
+0,0,0,48,0,2,254,221,0,0,0,2,0,2,254,154,0,0,0,23,0,2,254,154,0,0,0,24,0,
+73,0,148,0,156,0,164,0,172,0,180,0,188,0,196,0,204,0,212,0,220,0,228,0,236,
+0,244,0,252,1,4,1,12,1,20,1,28,1,36,1,44,1,52,1,60,1,68,1,76,1,84,1,92,1,
+100,1,108,1,116,1,124,1,132,1,140,1,148,1,156,1,164,1,172,1,180,1,188,1,196,
+1,204,1,212,1,220,1,228,1,236,1,244,1,252,2,4,2,12,2,20,2,28,2,36,2,44,2,
+52,2,60,2,68,2,76,2,84,2,92,2,100,2,108,2,116,2,124,2,132,2,140,2,148,2,156,
+2,164,2,172,2,180,2,188,2,196,2,204,2,212,0,2,3,95,0,0,0,66,0,2,3,95,0,0,
+0,80,0,2,2,131,0,0,0,62,0,2,2,131,0,0,0,67,0,2,2,181,0,0,0,50,0,2,3,155,0,
+0,0,63,0,2,3,175,0,0,0,64,0,2,2,121,0,0,0,56,0,2,3,95,0,0,0,66,0,2,3,95,0,
+0,0,66,0,2,3,95,0,0,0,66,0,2,3,95,0,0,0,80,0,2,3,95,0,0,0,80,0,2,3,95,0,0,
+0,80,0,2,2,60,0,0,0,42,0,2,2,73,0,0,0,51,0,2,3,4,0,0,0,60,0,2,4,158,0,0,0,
+61,0,2,3,244,0,0,0,48,0,2,2,37,0,0,0,43,0,2,2,99,0,0,0,43,0,2,2,73,0,0,0,
+37,0,2,2,102,0,0,0,54,0,2,2,126,0,0,0,50,0,2,2,10,0,0,0,39,0,2,2,230,0,0,
+0,52,0,2,3,175,0,0,0,74,0,2,2,121,0,0,0,73,0,2,2,66,0,0,0,45,0,2,3,244,0,
+0,0,53,0,2,3,164,0,0,0,48,0,2,5,74,0,0,0,80,0,2,3,164,0,0,0,63,0,2,5,115,
+0,0,0,84,0,2,3,34,0,0,0,60,0,2,5,115,0,0,0,79,0,2,3,164,0,0,0,59,0,2,4,214,
+0,0,0,67,0,2,4,86,0,0,0,80,0,2,4,194,0,0,0,63,0,2,4,123,0,0,0,71,0,2,4,240,
+0,0,0,71,0,2,2,181,0,0,0,50,0,2,3,155,0,0,0,63,0,2,2,131,0,0,0,62,0,2,2,131,
+0,0,0,67,0,2,3,95,0,0,0,66,0,2,3,95,0,0,0,66,0,2,3,95,0,0,0,66,0,2,3,95,0,
+0,0,80,0,2,3,95,0,0,0,80,0,2,3,95,0,0,0,80,0,2,2,160,0,0,0,61,0,2,2,160,0,
+0,0,64,0,2,2,160,0,0,0,61,0,2,2,160,0,0,0,64,0,2,3,238,0,0,0,44,0,2,3,238,
+0,0,0,44,0,2,4,82,0,0,0,66,0,2,3,223,0,0,0,53,0,2,4,57,0,0,0,63,0,2,3,253,
+0,0,0,62,0,2,3,125,0,0,0,63,0,2,5,76,0,0,0,85,0,2,3,56,0,0,0,52,0,2,5,76,
+0,0,0,80,0,2,3,125,0,0,0,59,0,2,3,125,0,0,0,49,0,2,2,100,0,0,0,55,0,2,2,100,
+0,0,0,59,0,2,3,125,0,0,0,49,0,2,2,100,0,0,0,55,0,2,2,100,0,0,0,59,0,4,0,0,
+0,1,0,8,0,1,0,12,0,30,0,1,0,74,0,160,0,1,0,7,2,88,2,90,2,92,2,94,2,95,2,96,
+2,97,0,1,0,20,0,25,0,27,0,28,0,31,0,32,0,33,0,34,0,47,1,130,1,132,2,61,2,
+62,2,63,2,64,2,65,2,66,2,67,2,76,2,79,2,87,0,7,0,0,0,30,0,0,0,38,0,0,0,46,
+0,0,0,54,0,0,0,62,0,0,0,70,0,0,0,78,0,2,253,250,0,0,0,31,0,2,253,250,0,0,
+0,31,0,2,253,250,0,0,0,26,0,2,253,250,0,0,0,41,0,2,253,250,0,0,0,54,0,2,253,
+250,0,0,0,73,0,2,253,250,0,0,0,20,0,20,0,42,0,50,0,58,0,66,0,74,0,82,0,90,
+0,98,0,106,0,114,0,122,0,130,0,138,0,146,0,154,0,162,0,170,0,178,0,186,0,
+194,0,2,1,246,0,0,0,52,0,2,2,199,0,0,0,62,0,2,4,38,0,0,0,64,0,2,1,205,0,0,
+0,44,0,2,2,17,0,0,0,44,0,2,1,237,0,0,0,39,0,2,2,16,0,0,0,56,0,2,1,200,0,0,
+0,41,0,2,4,35,0,0,0,72,0,2,4,154,0,0,0,72,0,2,2,20,0,0,0,48,0,2,2,189,0,0,
+0,58,0,2,4,82,0,0,0,62,0,2,1,210,0,0,0,37,0,2,2,13,0,0,0,43,0,2,1,232,0,0,
+0,36,0,2,2,12,0,0,0,55,0,2,1,198,0,0,0,37,0,2,4,82,0,0,0,62,0,2,1,198,0,0,
+0,37,0,2,0,0,0,1,0,8,0,1,0,72,0,4,0,0,0,31,0,130,1,84,1,174,2,20,2,86,2,136,
+2,218,3,28,3,90,3,176,4,114,4,148,4,166,4,240,5,150,6,12,6,94,6,220,7,38,
+7,180,7,198,8,140,8,226,9,36,9,102,9,244,10,210,10,232,11,14,11,20,11,38,
+0,2,0,9,0,130,0,133,0,0,0,135,0,135,0,4,0,137,0,138,0,5,0,140,0,140,0,7,0,
+142,0,142,0,8,0,145,0,155,0,9,0,157,0,164,0,20,0,173,0,173,0,28,1,141,1,142,
+0,29,0,52,0,22,255,166,0,27,255,186,0,28,255,96,0,29,255,186,0,31,255,176,
+0,36,255,176,0,37,255,236,0,40,255,176,0,41,255,166,0,42,255,196,0,45,255,
+181,0,48,255,156,0,49,255,146,0,50,255,136,0,51,255,216,0,53,255,186,0,99,
+255,96,0,201,255,166,0,206,255,186,0,207,255,96,0,210,255,176,0,216,255,236,
+0,219,255,176,0,220,255,166,0,221,255,196,0,224,255,181,0,227,255,156,0,228,
+255,146,0,229,255,136,0,232,255,186,1,179,255,96,1,180,255,96,1,199,255,166,
+1,205,255,176,1,206,255,236,1,208,255,176,1,209,255,166,1,212,255,181,1,214,
+255,156,1,215,255,146,1,216,255,136,1,217,255,216,1,219,255,186,1,243,255,
+166,1,250,255,236,1,252,255,176,1,253,255,166,2,0,255,181,2,2,255,156,2,3,
+255,146,2,4,255,136,2,7,255,186,0,22,0,22,255,151,0,28,255,186,0,36,255,196,
+0,45,255,226,0,46,255,206,0,50,255,156,0,201,255,151,0,207,255,186,0,224,
+255,226,0,225,255,206,0,229,255,156,1,179,255,186,1,180,255,186,1,199,255,
+151,1,205,255,196,1,212,255,226,1,213,255,206,1,216,255,156,1,243,255,151,
+2,0,255,226,2,1,255,206,2,4,255,156,0,25,0,29,255,226,0,31,255,197,0,40,0,
+20,0,42,255,231,0,43,0,20,0,44,0,20,0,48,0,20,0,49,0,20,0,210,255,197,0,219,
+0,20,0,221,255,231,0,222,0,20,0,223,0,20,0,227,0,20,0,228,0,20,1,208,0,20,
+1,210,0,20,1,211,0,20,1,214,0,20,1,215,0,20,1,252,0,20,1,254,0,20,1,255,0,
+20,2,2,0,20,2,3,0,20,0,16,0,24,255,86,0,40,255,186,0,46,255,136,0,50,255,
+149,0,203,255,86,0,219,255,186,0,225,255,136,0,229,255,149,1,201,255,86,1,
+208,255,186,1,213,255,136,1,216,255,149,1,245,255,86,1,252,255,186,2,1,255,
+136,2,4,255,149,0,12,0,26,255,206,0,27,255,176,0,36,255,156,0,46,255,106,
+0,205,255,206,0,206,255,176,0,225,255,106,1,202,255,206,1,205,255,156,1,213,
+255,106,1,246,255,206,2,1,255,106,0,20,0,28,255,126,0,45,255,176,0,46,255,
+176,0,50,255,146,0,127,255,176,0,207,255,126,0,224,255,176,0,225,255,176,
+0,229,255,146,0,235,255,176,1,179,255,126,1,180,255,126,1,212,255,176,1,213,
+255,176,1,216,255,146,1,221,255,176,2,0,255,176,2,1,255,176,2,4,255,146,2,
+10,255,176,0,16,0,29,255,186,0,33,255,106,0,38,255,206,0,43,255,206,0,45,
+255,226,0,46,255,226,0,212,255,106,0,222,255,206,0,224,255,226,0,225,255,
+226,1,210,255,206,1,212,255,226,1,213,255,226,1,254,255,206,2,0,255,226,2,
+1,255,226,0,15,0,26,255,216,0,50,255,206,0,51,255,201,0,53,255,216,0,54,255,
+219,0,205,255,216,0,229,255,206,0,232,255,216,1,202,255,216,1,216,255,206,
+1,217,255,201,1,219,255,216,1,246,255,216,2,4,255,206,2,7,255,216,0,21,0,
+23,255,206,0,28,255,144,0,38,255,226,0,44,255,216,0,45,255,231,0,50,255,204,
+0,202,255,206,0,207,255,144,0,223,255,216,0,224,255,231,0,229,255,204,1,179,
+255,144,1,180,255,144,1,200,255,206,1,211,255,216,1,212,255,231,1,216,255,
+204,1,244,255,206,1,255,255,216,2,0,255,231,2,4,255,204,0,48,0,21,255,206,
+0,22,255,166,0,40,0,40,0,41,255,166,0,42,255,206,0,43,255,186,0,45,255,196,
+0,46,255,226,0,48,255,186,0,50,255,176,0,51,255,196,0,53,255,206,0,126,255,
+186,0,150,255,166,0,162,255,206,0,200,255,206,0,201,255,166,0,219,0,40,0,
+220,255,166,0,221,255,206,0,222,255,186,0,224,255,196,0,225,255,226,0,227,
+255,186,0,229,255,176,0,232,255,206,0,234,255,186,1,199,255,166,1,208,0,40,
+1,209,255,166,1,210,255,186,1,212,255,196,1,213,255,226,1,214,255,186,1,216,
+255,176,1,217,255,196,1,219,255,206,1,220,255,186,1,243,255,166,1,252,0,40,
+1,253,255,166,1,254,255,186,2,0,255,196,2,1,255,226,2,2,255,186,2,4,255,176,
+2,7,255,206,2,9,255,186,0,8,0,37,255,118,0,46,255,146,0,216,255,118,0,225,
+255,146,1,206,255,118,1,213,255,146,1,250,255,118,2,1,255,146,0,4,0,41,255,
+176,0,220,255,176,1,209,255,176,1,253,255,176,0,18,0,39,255,86,0,40,255,186,
+0,45,255,136,0,46,255,106,0,50,255,129,0,219,255,186,0,224,255,136,0,225,
+255,106,0,229,255,129,1,207,255,86,1,208,255,186,1,212,255,136,1,213,255,
+106,1,216,255,129,1,252,255,186,2,0,255,136,2,1,255,106,2,4,255,129,0,41,
+0,21,255,216,0,23,0,30,0,28,255,166,0,29,255,236,0,31,255,126,0,33,255,156,
+0,39,255,176,0,40,0,60,0,42,255,216,0,45,255,226,0,46,255,236,0,51,255,226,
+0,53,255,196,0,54,255,166,0,154,255,226,0,200,255,216,0,202,0,30,0,207,255,
+166,0,210,255,126,0,212,255,156,0,217,255,126,0,219,0,60,0,221,255,216,0,
+224,255,226,0,225,255,236,0,232,255,196,1,122,254,102,1,179,255,166,1,180,
+255,166,1,200,0,30,1,207,255,176,1,208,0,60,1,212,255,226,1,213,255,236,1,
+217,255,226,1,219,255,196,1,244,0,30,1,252,0,60,2,0,255,226,2,1,255,236,2,
+7,255,196,0,29,0,26,255,236,0,31,255,216,0,36,255,146,0,40,255,196,0,41,255,
+72,0,46,255,116,0,48,255,106,0,49,255,236,0,54,255,146,0,205,255,236,0,210,
+255,216,0,219,255,196,0,220,255,72,0,225,255,116,0,227,255,106,0,228,255,
+236,1,202,255,236,1,205,255,146,1,208,255,196,1,209,255,72,1,213,255,116,
+1,214,255,106,1,215,255,236,1,246,255,236,1,252,255,196,1,253,255,72,2,1,
+255,116,2,2,255,106,2,3,255,236,0,20,0,28,255,116,0,31,255,176,0,36,255,176,
+0,37,255,236,0,48,255,156,0,49,255,156,0,207,255,116,0,210,255,176,0,216,
+255,236,0,227,255,156,0,228,255,156,1,179,255,116,1,180,255,116,1,205,255,
+176,1,206,255,236,1,214,255,156,1,215,255,156,1,250,255,236,2,2,255,156,2,
+3,255,156,0,31,0,28,255,176,0,29,255,176,0,33,255,166,0,38,255,186,0,39,255,
+129,0,43,255,146,0,44,255,136,0,46,255,136,0,48,255,156,0,50,255,146,0,54,
+255,156,0,207,255,176,0,212,255,166,0,222,255,146,0,223,255,136,0,225,255,
+136,0,227,255,156,0,229,255,146,1,179,255,176,1,180,255,176,1,207,255,129,
+1,210,255,146,1,211,255,136,1,213,255,136,1,214,255,156,1,216,255,146,1,254,
+255,146,1,255,255,136,2,1,255,136,2,2,255,156,2,4,255,146,0,18,0,36,255,136,
+0,44,255,146,0,46,255,196,0,49,255,146,0,50,255,146,0,223,255,146,0,225,255,
+196,0,228,255,146,0,229,255,146,1,205,255,136,1,211,255,146,1,213,255,196,
+1,215,255,146,1,216,255,146,1,255,255,146,2,1,255,196,2,3,255,146,2,4,255,
+146,0,35,0,35,255,121,0,41,255,136,0,42,255,246,0,43,255,136,0,44,255,116,
+0,45,255,86,0,46,255,76,0,48,255,116,0,51,255,236,0,54,255,166,0,150,255,
+136,0,214,255,121,0,220,255,136,0,221,255,246,0,222,255,136,0,223,255,116,
+0,224,255,86,0,225,255,76,0,227,255,116,1,181,255,121,1,204,255,121,1,209,
+255,136,1,210,255,136,1,211,255,116,1,212,255,86,1,213,255,76,1,214,255,116,
+1,217,255,236,1,248,255,121,1,253,255,136,1,254,255,136,1,255,255,116,2,0,
+255,86,2,1,255,76,2,2,255,116,0,4,0,46,255,166,0,225,255,166,1,213,255,166,
+2,1,255,166,0,49,0,21,255,191,0,26,255,206,0,28,255,160,0,31,255,156,0,33,
+255,166,0,36,255,186,0,38,255,227,0,39,255,216,0,41,255,216,0,42,255,191,
+0,45,255,196,0,46,255,206,0,48,255,126,0,50,255,106,0,51,255,196,0,53,255,
+186,0,54,255,146,0,150,255,216,0,200,255,191,0,205,255,206,0,207,255,160,
+0,210,255,156,0,212,255,166,0,220,255,216,0,221,255,191,0,224,255,196,0,225,
+255,206,0,227,255,126,0,229,255,106,0,232,255,186,1,179,255,160,1,180,255,
+160,1,202,255,206,1,205,255,186,1,207,255,216,1,209,255,216,1,212,255,196,
+1,213,255,206,1,214,255,126,1,216,255,106,1,217,255,196,1,219,255,186,1,246,
+255,206,1,253,255,216,2,0,255,196,2,1,255,206,2,2,255,126,2,4,255,106,2,7,
+255,186,0,21,0,22,0,60,0,41,0,60,0,46,0,40,0,47,0,20,0,50,255,186,0,52,0,
+60,0,201,0,60,0,220,0,60,0,225,0,40,0,229,255,186,0,231,0,60,1,199,0,60,1,
+209,0,60,1,213,0,40,1,216,255,186,1,218,0,60,1,243,0,60,1,253,0,60,2,1,0,
+40,2,4,255,186,2,6,0,60,0,16,0,28,255,176,0,29,255,216,0,33,255,196,0,46,
+255,199,0,50,255,126,0,54,255,134,0,207,255,176,0,212,255,196,0,225,255,199,
+0,229,255,126,1,179,255,176,1,180,255,176,1,213,255,199,1,216,255,126,2,1,
+255,199,2,4,255,126,0,16,0,21,255,213,0,31,255,203,0,33,255,206,0,36,255,
+203,0,42,255,213,0,45,255,235,0,51,255,216,0,200,255,213,0,210,255,203,0,
+212,255,206,0,221,255,213,0,224,255,235,1,205,255,203,1,212,255,235,1,217,
+255,216,2,0,255,235,0,35,0,22,255,156,0,31,254,252,0,32,255,48,0,35,255,66,
+0,41,255,156,0,46,255,226,0,49,255,116,0,50,255,106,0,52,255,156,0,201,255,
+156,0,210,254,252,0,211,255,48,0,214,255,66,0,220,255,156,0,225,255,226,0,
+228,255,116,0,229,255,106,0,231,255,156,1,181,255,66,1,199,255,156,1,204,
+255,66,1,209,255,156,1,213,255,226,1,215,255,116,1,216,255,106,1,218,255,
+156,1,243,255,156,1,248,255,66,1,253,255,156,2,1,255,226,2,3,255,116,2,4,
+255,106,2,6,255,156,2,64,255,136,2,65,255,136,0,55,0,21,255,216,0,22,255,
+146,0,28,255,146,0,31,255,116,0,33,255,136,0,36,255,88,0,37,255,236,0,38,
+255,216,0,40,0,30,0,41,255,116,0,42,255,216,0,43,255,136,0,45,255,186,0,46,
+255,216,0,48,255,136,0,50,255,116,0,53,255,176,0,200,255,216,0,201,255,146,
+0,207,255,146,0,210,255,116,0,212,255,136,0,216,255,236,0,219,0,30,0,220,
+255,116,0,221,255,216,0,222,255,136,0,224,255,186,0,225,255,216,0,227,255,
+136,0,229,255,116,0,232,255,176,1,179,255,146,1,180,255,146,1,199,255,146,
+1,205,255,88,1,206,255,236,1,208,0,30,1,209,255,116,1,210,255,136,1,212,255,
+186,1,213,255,216,1,214,255,136,1,216,255,116,1,219,255,176,1,243,255,146,
+1,250,255,236,1,252,0,30,1,253,255,116,1,254,255,136,2,0,255,186,2,1,255,
+216,2,2,255,136,2,4,255,116,2,7,255,176,0,5,0,53,255,206,0,54,255,156,0,232,
+255,206,1,219,255,206,2,7,255,206,0,9,0,35,255,96,0,45,255,216,0,214,255,
+96,0,224,255,216,1,181,255,96,1,204,255,96,1,212,255,216,1,248,255,96,2,0,
+255,216,0,1,0,173,255,126,0,4,0,50,255,176,0,229,255,176,1,216,255,176,2,
+4,255,176,0,2,0,135,0,70,0,149,0,100,0,7,0,0,0,1,0,8,0,2,0,14,0,30,0,3,0,
+0,0,70,0,0,0,1,0,6,2,8,2,32,2,55,2,56,2,59,2,60,0,2,0,6,0,61,0,61,0,2,2,8,
+2,8,0,1,2,32,2,32,0,1,2,55,2,56,0,1,2,59,2,60,0,1,2,149,2,149,0,2,0,1,0,4,
+0,2,0,1,0,2,0,1,0,6,0,1,0,0,0,1,0,8,0,1,0,8,0,2,255,176,0,1,0,2,0,61,2,149,
+0,8,0,0,0,1,0,8,0,2,0,18,0,34,0,98,0,126,0,3,0,0,0,134,0,156,0,2,0,2,0,60,
+0,62,0,0,2,137,2,139,0,3,0,2,0,10,0,21,0,21,0,1,0,25,0,25,0,1,0,27,0,28,0,
+1,0,31,0,34,0,1,0,38,0,38,0,1,0,54,0,54,0,1,0,200,0,200,0,1,1,84,1,84,0,1,
+1,130,1,130,0,1,1,132,1,132,0,1,0,2,0,4,0,60,0,60,0,2,0,61,0,61,0,1,0,62,
+0,62,0,2,2,137,2,139,0,2,0,1,0,1,0,1,0,1,0,1,0,4,0,1,0,1,0,1,0,0,0,2,0,0,
+0,8,0,0,0,9,0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,8,0,1,0,0,0,1,0,8,0,1,0,8,0,
+2,255,216,0,2,0,2,0,60,0,62,0,0,2,137,2,139,0,3,0,1,0,0,0,1,0,8,0,1,0,8,0,
+1,255,176,0,1,0,1,0,61,0,1,0,0,0,10,0,90,1,44,0,2,103,106,114,50,0,14,103,
+117,106,114,0,18,0,8,0,0,0,34,0,0,0,0,255,255,0,12,0,9,0,1,0,13,0,12,0,3,
+0,7,0,5,0,10,0,0,0,4,0,11,0,8,0,0,255,255,0,11,0,9,0,1,0,13,0,2,0,6,0,14,
+0,10,0,0,0,4,0,11,0,8,0,15,97,98,118,115,0,92,97,107,104,110,0,108,98,108,
+119,102,0,114,98,108,119,102,0,120,98,108,119,115,0,126,99,106,99,116,0,140,
+104,97,108,102,0,146,104,97,108,102,0,152,104,97,108,110,0,158,110,117,107,
+116,0,164,112,114,101,115,0,170,112,115,116,115,0,180,114,107,114,102,0,190,
+114,112,104,102,0,196,118,97,116,117,0,202,0,0,0,6,0,15,0,17,0,18,0,19,0,
+74,0,79,0,0,0,1,0,1,0,0,0,1,0,4,0,0,0,1,0,5,0,0,0,5,0,81,0,82,0,89,0,91,0,
+94,0,0,0,1,0,10,0,0,0,1,0,6,0,0,0,1,0,7,0,0,0,1,0,101,0,0,0,1,0,0,0,0,0,3,
+0,11,0,12,0,13,0,0,0,3,0,95,0,96,0,99,0,0,0,1,0,3,0,0,0,1,0,2,0,0,0,2,0,8,
+0,9,0,102,0,206,2,126,2,176,2,208,6,186,6,218,6,250,10,96,16,12,19,114,22,
+210,24,38,26,68,26,100,26,216,26,236,27,42,27,114,27,154,29,94,40,210,43,
+244,46,234,49,140,52,76,54,166,56,208,58,230,60,252,62,250,64,242,67,36,68,
+254,70,186,72,208,74,188,76,168,78,136,80,98,82,30,83,212,85,156,87,70,88,
+252,90,160,92,68,93,226,95,140,97,30,98,176,100,66,101,174,103,26,104,122,
+105,212,107,52,108,148,110,68,111,212,113,100,115,0,116,144,118,2,119,134,
+120,242,121,192,122,130,126,76,126,96,126,116,126,136,126,156,126,176,126,
+196,126,216,128,14,128,58,128,102,128,146,128,180,128,250,129,14,130,84,133,
+148,133,210,133,244,135,204,137,50,138,152,139,98,140,18,140,44,141,194,142,
+146,142,218,143,144,143,244,145,226,146,4,146,38,147,236,148,14,0,4,0,0,0,
+1,0,8,0,1,1,158,0,34,0,74,0,84,0,94,0,104,0,114,0,124,0,134,0,144,0,154,0,
+164,0,174,0,184,0,194,0,204,0,214,0,224,0,234,0,244,0,254,1,8,1,18,1,28,1,
+38,1,48,1,58,1,68,1,78,1,88,1,98,1,108,1,118,1,128,1,138,1,148,0,1,0,4,0,
+92,0,2,0,55,0,1,0,4,0,93,0,2,0,55,0,1,0,4,0,94,0,2,0,55,0,1,0,4,0,95,0,2,
+0,55,0,1,0,4,0,96,0,2,0,55,0,1,0,4,0,97,0,2,0,55,0,1,0,4,0,98,0,2,0,55,0,
+1,0,4,0,99,0,2,0,55,0,1,0,4,0,100,0,2,0,55,0,1,0,4,0,101,0,2,0,55,0,1,0,4,
+0,102,0,2,0,55,0,1,0,4,0,103,0,2,0,55,0,1,0,4,0,104,0,2,0,55,0,1,0,4,0,105,
+0,2,0,55,0,1,0,4,0,106,0,2,0,55,0,1,0,4,0,107,0,2,0,55,0,1,0,4,0,108,0,2,
+0,55,0,1,0,4,0,109,0,2,0,55,0,1,0,4,0,110,0,2,0,55,0,1,0,4,0,111,0,2,0,55,
+0,1,0,4,0,112,0,2,0,55,0,1,0,4,0,113,0,2,0,55,0,1,0,4,0,114,0,2,0,55,0,1,
+0,4,0,115,0,2,0,55,0,1,0,4,0,116,0,2,0,55,0,1,0,4,0,117,0,2,0,55,0,1,0,4,
+0,118,0,2,0,55,0,1,0,4,0,119,0,2,0,55,0,1,0,4,0,120,0,2,0,55,0,1,0,4,0,121,
+0,2,0,55,0,1,0,4,0,122,0,2,0,55,0,1,0,4,0,123,0,2,0,55,0,1,0,4,0,124,0,2,
+0,55,0,1,0,4,0,125,0,2,0,55,0,2,0,1,0,21,0,54,0,0,0,4,0,0,0,1,0,8,0,1,0,34,
+0,2,0,10,0,22,0,1,0,4,0,126,0,3,0,70,0,52,0,1,0,4,0,127,0,3,0,70,0,30,0,1,
+0,2,0,21,0,28,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,128,0,2,0,70,0,1,
+0,1,0,47,0,4,0,0,0,1,0,8,0,1,3,204,0,69,0,144,0,156,0,168,0,180,0,192,0,204,
+0,216,0,228,0,240,0,252,1,8,1,20,1,32,1,44,1,56,1,68,1,80,1,92,1,104,1,116,
+1,128,1,140,1,152,1,164,1,176,1,188,1,200,1,212,1,224,1,236,1,248,2,4,2,16,
+2,28,2,40,2,52,2,64,2,76,2,88,2,100,2,112,2,124,2,136,2,148,2,160,2,172,2,
+184,2,196,2,208,2,220,2,232,2,244,3,0,3,12,3,24,3,36,3,48,3,60,3,72,3,84,
+3,96,3,108,3,120,3,132,3,144,3,156,3,168,3,180,3,192,0,1,0,4,0,200,0,3,0,
+70,0,47,0,1,0,4,0,201,0,3,0,70,0,47,0,1,0,4,0,202,0,3,0,70,0,47,0,1,0,4,0,
+203,0,3,0,70,0,47,0,1,0,4,0,204,0,3,0,70,0,47,0,1,0,4,0,205,0,3,0,70,0,47,
+0,1,0,4,0,206,0,3,0,70,0,47,0,1,0,4,0,207,0,3,0,70,0,47,0,1,0,4,0,208,0,3,
+0,70,0,47,0,1,0,4,0,209,0,3,0,70,0,47,0,1,0,4,0,210,0,3,0,70,0,47,0,1,0,4,
+0,211,0,3,0,70,0,47,0,1,0,4,0,212,0,3,0,70,0,47,0,1,0,4,0,213,0,3,0,70,0,
+47,0,1,0,4,0,214,0,3,0,70,0,47,0,1,0,4,0,215,0,3,0,70,0,47,0,1,0,4,0,216,
+0,3,0,70,0,47,0,1,0,4,0,217,0,3,0,70,0,47,0,1,0,4,0,218,0,3,0,70,0,47,0,1,
+0,4,0,219,0,3,0,70,0,47,0,1,0,4,0,220,0,3,0,70,0,47,0,1,0,4,0,221,0,3,0,70,
+0,47,0,1,0,4,0,222,0,3,0,70,0,47,0,1,0,4,0,223,0,3,0,70,0,47,0,1,0,4,0,224,
+0,3,0,70,0,47,0,1,0,4,0,225,0,3,0,70,0,47,0,1,0,4,0,227,0,3,0,70,0,47,0,1,
+0,4,0,228,0,3,0,70,0,47,0,1,0,4,0,229,0,3,0,70,0,47,0,1,0,4,0,230,0,3,0,70,
+0,47,0,1,0,4,0,231,0,3,0,70,0,47,0,1,0,4,0,232,0,3,0,70,0,47,0,1,0,4,0,233,
+0,3,0,70,0,47,0,1,0,4,0,236,0,3,0,70,0,47,0,1,0,4,0,237,0,3,0,70,0,47,0,1,
+0,4,0,238,0,3,0,70,0,47,0,1,0,4,0,239,0,3,0,70,0,47,0,1,0,4,0,240,0,3,0,70,
+0,47,0,1,0,4,0,241,0,3,0,70,0,47,0,1,0,4,0,242,0,3,0,70,0,47,0,1,0,4,0,243,
+0,3,0,70,0,47,0,1,0,4,0,244,0,3,0,70,0,47,0,1,0,4,0,245,0,3,0,70,0,47,0,1,
+0,4,0,246,0,3,0,70,0,47,0,1,0,4,0,247,0,3,0,70,0,47,0,1,0,4,0,248,0,3,0,70,
+0,47,0,1,0,4,0,249,0,3,0,70,0,47,0,1,0,4,0,250,0,3,0,70,0,47,0,1,0,4,0,251,
+0,3,0,70,0,47,0,1,0,4,0,252,0,3,0,70,0,47,0,1,0,4,0,253,0,3,0,70,0,47,0,1,
+0,4,0,254,0,3,0,70,0,47,0,1,0,4,0,255,0,3,0,70,0,47,0,1,0,4,1,0,0,3,0,70,
+0,47,0,1,0,4,1,1,0,3,0,70,0,47,0,1,0,4,1,2,0,3,0,70,0,47,0,1,0,4,1,3,0,3,
+0,70,0,47,0,1,0,4,1,4,0,3,0,70,0,47,0,1,0,4,1,5,0,3,0,70,0,47,0,1,0,4,1,6,
+0,3,0,70,0,47,0,1,0,4,1,7,0,3,0,70,0,47,0,1,0,4,1,8,0,3,0,70,0,47,0,1,0,4,
+1,9,0,3,0,70,0,47,0,1,0,4,1,10,0,3,0,70,0,47,0,1,0,4,1,11,0,3,0,70,0,47,0,
+1,0,4,1,12,0,3,0,70,0,47,0,1,0,4,1,13,0,3,0,70,0,47,0,1,0,4,0,234,0,3,0,70,
+0,47,0,1,0,4,0,235,0,3,0,70,0,47,0,2,0,3,0,21,0,46,0,0,0,48,0,54,0,26,0,92,
+0,127,0,33,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,129,0,2,0,70,0,1,0,
+1,0,47,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,129,0,2,0,47,0,1,0,1,0,
+70,0,4,0,0,0,1,0,8,0,1,3,78,0,70,0,146,0,156,0,166,0,176,0,186,0,196,0,206,
+0,216,0,226,0,236,0,246,1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,1,80,1,90,
+1,100,1,110,1,120,1,130,1,140,1,150,1,160,1,170,1,180,1,190,1,200,1,210,1,
+220,1,230,1,240,1,250,2,4,2,14,2,24,2,34,2,44,2,54,2,64,2,74,2,84,2,94,2,
+104,2,114,2,124,2,134,2,144,2,154,2,164,2,174,2,184,2,194,2,204,2,214,2,224,
+2,234,2,244,2,254,3,8,3,18,3,28,3,38,3,48,3,58,3,68,0,1,0,4,0,130,0,2,0,70,
+0,1,0,4,0,131,0,2,0,70,0,1,0,4,0,132,0,2,0,70,0,1,0,4,0,133,0,2,0,70,0,1,
+0,4,0,134,0,2,0,70,0,1,0,4,0,135,0,2,0,70,0,1,0,4,0,136,0,2,0,70,0,1,0,4,
+0,137,0,2,0,70,0,1,0,4,0,138,0,2,0,70,0,1,0,4,0,139,0,2,0,70,0,1,0,4,0,140,
+0,2,0,70,0,1,0,4,0,141,0,2,0,70,0,1,0,4,0,142,0,2,0,70,0,1,0,4,0,143,0,2,
+0,70,0,1,0,4,0,144,0,2,0,70,0,1,0,4,0,145,0,2,0,70,0,1,0,4,0,146,0,2,0,70,
+0,1,0,4,0,147,0,2,0,70,0,1,0,4,0,148,0,2,0,70,0,1,0,4,0,149,0,2,0,70,0,1,
+0,4,0,150,0,2,0,70,0,1,0,4,0,151,0,2,0,70,0,1,0,4,0,152,0,2,0,70,0,1,0,4,
+0,153,0,2,0,70,0,1,0,4,0,154,0,2,0,70,0,1,0,4,0,155,0,2,0,70,0,1,0,4,0,156,
+0,2,0,70,0,1,0,4,0,157,0,2,0,70,0,1,0,4,0,158,0,2,0,70,0,1,0,4,0,159,0,2,
+0,70,0,1,0,4,0,160,0,2,0,70,0,1,0,4,0,161,0,2,0,70,0,1,0,4,0,162,0,2,0,70,
+0,1,0,4,0,163,0,2,0,70,0,1,0,4,0,166,0,2,0,70,0,1,0,4,0,167,0,2,0,70,0,1,
+0,4,0,168,0,2,0,70,0,1,0,4,0,169,0,2,0,70,0,1,0,4,0,170,0,2,0,70,0,1,0,4,
+0,171,0,2,0,70,0,1,0,4,0,172,0,2,0,70,0,1,0,4,0,173,0,2,0,70,0,1,0,4,0,174,
+0,2,0,70,0,1,0,4,0,175,0,2,0,70,0,1,0,4,0,176,0,2,0,70,0,1,0,4,0,177,0,2,
+0,70,0,1,0,4,0,178,0,2,0,70,0,1,0,4,0,179,0,2,0,70,0,1,0,4,0,180,0,2,0,70,
+0,1,0,4,0,181,0,2,0,70,0,1,0,4,0,182,0,2,0,70,0,1,0,4,0,183,0,2,0,70,0,1,
+0,4,0,184,0,2,0,70,0,1,0,4,0,185,0,2,0,70,0,1,0,4,0,186,0,2,0,70,0,1,0,4,
+0,187,0,2,0,70,0,1,0,4,0,188,0,2,0,70,0,1,0,4,0,189,0,2,0,70,0,1,0,4,0,190,
+0,2,0,70,0,1,0,4,0,191,0,2,0,70,0,1,0,4,0,192,0,2,0,70,0,1,0,4,0,193,0,2,
+0,70,0,1,0,4,0,194,0,2,0,70,0,1,0,4,0,195,0,2,0,70,0,1,0,4,0,196,0,2,0,70,
+0,1,0,4,0,197,0,2,0,70,0,1,0,4,0,198,0,2,0,70,0,1,0,4,0,199,0,2,0,70,0,1,
+0,4,0,164,0,2,0,70,0,1,0,4,0,165,0,2,0,70,0,2,0,2,0,21,0,54,0,0,0,92,0,127,
+0,34,0,4,0,0,0,1,0,8,0,1,5,22,0,108,0,222,0,232,0,242,0,252,1,6,1,16,1,26,
+1,36,1,46,1,56,1,66,1,76,1,86,1,96,1,106,1,116,1,126,1,136,1,146,1,156,1,
+166,1,176,1,186,1,196,1,206,1,216,1,226,1,236,1,246,2,0,2,10,2,20,2,30,2,
+40,2,50,2,60,2,70,2,80,2,90,2,100,2,110,2,120,2,130,2,140,2,150,2,160,2,170,
+2,180,2,190,2,200,2,210,2,220,2,230,2,240,2,250,3,4,3,14,3,24,3,34,3,44,3,
+54,3,64,3,74,3,84,3,94,3,104,3,114,3,124,3,134,3,144,3,154,3,164,3,174,3,
+184,3,194,3,204,3,214,3,224,3,234,3,244,3,254,4,8,4,18,4,28,4,38,4,48,4,58,
+4,68,4,78,4,88,4,98,4,108,4,118,4,128,4,138,4,148,4,158,4,168,4,178,4,188,
+4,198,4,208,4,218,4,228,4,238,4,248,5,2,5,12,0,1,0,4,0,130,0,2,0,70,0,1,0,
+4,0,131,0,2,0,70,0,1,0,4,0,132,0,2,0,70,0,1,0,4,0,133,0,2,0,70,0,1,0,4,0,
+135,0,2,0,70,0,1,0,4,0,137,0,2,0,70,0,1,0,4,0,138,0,2,0,70,0,1,0,4,0,139,
+0,2,0,70,0,1,0,4,0,144,0,2,0,70,0,1,0,4,0,145,0,2,0,70,0,1,0,4,0,146,0,2,
+0,70,0,1,0,4,0,148,0,2,0,70,0,1,0,4,0,149,0,2,0,70,0,1,0,4,0,150,0,2,0,70,
+0,1,0,4,0,151,0,2,0,70,0,1,0,4,0,152,0,2,0,70,0,1,0,4,0,153,0,2,0,70,0,1,
+0,4,0,154,0,2,0,70,0,1,0,4,0,155,0,2,0,70,0,1,0,4,0,157,0,2,0,70,0,1,0,4,
+0,158,0,2,0,70,0,1,0,4,0,159,0,2,0,70,0,1,0,4,0,160,0,2,0,70,0,1,0,4,0,161,
+0,2,0,70,0,1,0,4,0,162,0,2,0,70,0,1,0,4,0,163,0,2,0,70,0,1,0,4,0,166,0,2,
+0,70,0,1,0,4,0,167,0,2,0,70,0,1,0,4,0,168,0,2,0,70,0,1,0,4,0,169,0,2,0,70,
+0,1,0,4,0,171,0,2,0,70,0,1,0,4,0,173,0,2,0,70,0,1,0,4,0,174,0,2,0,70,0,1,
+0,4,0,175,0,2,0,70,0,1,0,4,0,180,0,2,0,70,0,1,0,4,0,181,0,2,0,70,0,1,0,4,
+0,182,0,2,0,70,0,1,0,4,0,184,0,2,0,70,0,1,0,4,0,185,0,2,0,70,0,1,0,4,0,186,
+0,2,0,70,0,1,0,4,0,187,0,2,0,70,0,1,0,4,0,188,0,2,0,70,0,1,0,4,0,189,0,2,
+0,70,0,1,0,4,0,190,0,2,0,70,0,1,0,4,0,191,0,2,0,70,0,1,0,4,0,193,0,2,0,70,
+0,1,0,4,0,194,0,2,0,70,0,1,0,4,0,195,0,2,0,70,0,1,0,4,0,196,0,2,0,70,0,1,
+0,4,0,197,0,2,0,70,0,1,0,4,0,198,0,2,0,70,0,1,0,4,0,199,0,2,0,70,0,1,0,4,
+0,164,0,2,0,70,0,1,0,4,0,165,0,2,0,70,0,1,0,4,1,14,0,2,0,70,0,1,0,4,1,15,
+0,2,0,70,0,1,0,4,1,16,0,2,0,70,0,1,0,4,1,17,0,2,0,70,0,1,0,4,1,19,0,2,0,70,
+0,1,0,4,1,21,0,2,0,70,0,1,0,4,1,22,0,2,0,70,0,1,0,4,1,23,0,2,0,70,0,1,0,4,
+1,28,0,2,0,70,0,1,0,4,1,29,0,2,0,70,0,1,0,4,1,30,0,2,0,70,0,1,0,4,1,32,0,
+2,0,70,0,1,0,4,1,33,0,2,0,70,0,1,0,4,1,34,0,2,0,70,0,1,0,4,1,35,0,2,0,70,
+0,1,0,4,1,36,0,2,0,70,0,1,0,4,1,37,0,2,0,70,0,1,0,4,1,38,0,2,0,70,0,1,0,4,
+1,39,0,2,0,70,0,1,0,4,1,41,0,2,0,70,0,1,0,4,1,42,0,2,0,70,0,1,0,4,1,43,0,
+2,0,70,0,1,0,4,1,44,0,2,0,70,0,1,0,4,1,45,0,2,0,70,0,1,0,4,1,46,0,2,0,70,
+0,1,0,4,1,47,0,2,0,70,0,1,0,4,1,48,0,2,0,70,0,1,0,4,1,49,0,2,0,70,0,1,0,4,
+1,50,0,2,0,70,0,1,0,4,1,51,0,2,0,70,0,1,0,4,1,52,0,2,0,70,0,1,0,4,1,53,0,
+2,0,70,0,1,0,4,1,55,0,2,0,70,0,1,0,4,1,57,0,2,0,70,0,1,0,4,1,58,0,2,0,70,
+0,1,0,4,1,59,0,2,0,70,0,1,0,4,1,64,0,2,0,70,0,1,0,4,1,65,0,2,0,70,0,1,0,4,
+1,66,0,2,0,70,0,1,0,4,1,68,0,2,0,70,0,1,0,4,1,69,0,2,0,70,0,1,0,4,1,70,0,
+2,0,70,0,1,0,4,1,71,0,2,0,70,0,1,0,4,1,72,0,2,0,70,0,1,0,4,1,73,0,2,0,70,
+0,1,0,4,1,74,0,2,0,70,0,1,0,4,1,75,0,2,0,70,0,1,0,4,1,77,0,2,0,70,0,1,0,4,
+1,78,0,2,0,70,0,1,0,4,1,79,0,2,0,70,0,1,0,4,1,80,0,2,0,70,0,1,0,4,1,81,0,
+2,0,70,0,1,0,4,1,82,0,2,0,70,0,1,0,4,1,83,0,2,0,70,0,2,0,23,0,21,0,24,0,0,
+0,26,0,26,0,4,0,28,0,30,0,5,0,35,0,37,0,8,0,39,0,46,0,11,0,48,0,54,0,19,0,
+92,0,95,0,26,0,97,0,97,0,30,0,99,0,101,0,31,0,106,0,108,0,34,0,110,0,117,
+0,37,0,119,0,127,0,45,0,200,0,203,0,54,0,205,0,205,0,58,0,207,0,209,0,59,
+0,214,0,216,0,62,0,218,0,225,0,65,0,227,0,239,0,73,0,241,0,241,0,86,0,243,
+0,245,0,87,0,250,0,252,0,90,0,254,1,5,0,93,1,7,1,13,0,101,0,4,0,0,0,1,0,8,
+0,1,3,78,0,70,0,146,0,156,0,166,0,176,0,186,0,196,0,206,0,216,0,226,0,236,
+0,246,1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,1,80,1,90,1,100,1,110,1,120,
+1,130,1,140,1,150,1,160,1,170,1,180,1,190,1,200,1,210,1,220,1,230,1,240,1,
+250,2,4,2,14,2,24,2,34,2,44,2,54,2,64,2,74,2,84,2,94,2,104,2,114,2,124,2,
+134,2,144,2,154,2,164,2,174,2,184,2,194,2,204,2,214,2,224,2,234,2,244,2,254,
+3,8,3,18,3,28,3,38,3,48,3,58,3,68,0,1,0,4,0,200,0,2,0,129,0,1,0,4,0,201,0,
+2,0,129,0,1,0,4,0,202,0,2,0,129,0,1,0,4,0,203,0,2,0,129,0,1,0,4,0,204,0,2,
+0,129,0,1,0,4,0,205,0,2,0,129,0,1,0,4,0,206,0,2,0,129,0,1,0,4,0,207,0,2,0,
+129,0,1,0,4,0,208,0,2,0,129,0,1,0,4,0,209,0,2,0,129,0,1,0,4,0,210,0,2,0,129,
+0,1,0,4,0,211,0,2,0,129,0,1,0,4,0,212,0,2,0,129,0,1,0,4,0,213,0,2,0,129,0,
+1,0,4,0,214,0,2,0,129,0,1,0,4,0,215,0,2,0,129,0,1,0,4,0,216,0,2,0,129,0,1,
+0,4,0,217,0,2,0,129,0,1,0,4,0,218,0,2,0,129,0,1,0,4,0,219,0,2,0,129,0,1,0,
+4,0,220,0,2,0,129,0,1,0,4,0,221,0,2,0,129,0,1,0,4,0,222,0,2,0,129,0,1,0,4,
+0,223,0,2,0,129,0,1,0,4,0,224,0,2,0,129,0,1,0,4,0,225,0,2,0,129,0,1,0,4,0,
+226,0,2,0,129,0,1,0,4,0,227,0,2,0,129,0,1,0,4,0,228,0,2,0,129,0,1,0,4,0,229,
+0,2,0,129,0,1,0,4,0,230,0,2,0,129,0,1,0,4,0,231,0,2,0,129,0,1,0,4,0,232,0,
+2,0,129,0,1,0,4,0,233,0,2,0,129,0,1,0,4,0,236,0,2,0,129,0,1,0,4,0,237,0,2,
+0,129,0,1,0,4,0,238,0,2,0,129,0,1,0,4,0,239,0,2,0,129,0,1,0,4,0,240,0,2,0,
+129,0,1,0,4,0,241,0,2,0,129,0,1,0,4,0,242,0,2,0,129,0,1,0,4,0,243,0,2,0,129,
+0,1,0,4,0,244,0,2,0,129,0,1,0,4,0,245,0,2,0,129,0,1,0,4,0,246,0,2,0,129,0,
+1,0,4,0,247,0,2,0,129,0,1,0,4,0,248,0,2,0,129,0,1,0,4,0,249,0,2,0,129,0,1,
+0,4,0,250,0,2,0,129,0,1,0,4,0,251,0,2,0,129,0,1,0,4,0,252,0,2,0,129,0,1,0,
+4,0,253,0,2,0,129,0,1,0,4,0,254,0,2,0,129,0,1,0,4,0,255,0,2,0,129,0,1,0,4,
+1,0,0,2,0,129,0,1,0,4,1,1,0,2,0,129,0,1,0,4,1,2,0,2,0,129,0,1,0,4,1,3,0,2,
+0,129,0,1,0,4,1,4,0,2,0,129,0,1,0,4,1,5,0,2,0,129,0,1,0,4,1,6,0,2,0,129,0,
+1,0,4,1,7,0,2,0,129,0,1,0,4,1,8,0,2,0,129,0,1,0,4,1,9,0,2,0,129,0,1,0,4,1,
+10,0,2,0,129,0,1,0,4,1,11,0,2,0,129,0,1,0,4,1,12,0,2,0,129,0,1,0,4,1,13,0,
+2,0,129,0,1,0,4,0,234,0,2,0,129,0,1,0,4,0,235,0,2,0,129,0,2,0,2,0,21,0,54,
+0,0,0,92,0,127,0,34,0,4,0,0,0,1,0,8,0,1,3,78,0,70,0,146,0,156,0,166,0,176,
+0,186,0,196,0,206,0,216,0,226,0,236,0,246,1,0,1,10,1,20,1,30,1,40,1,50,1,
+60,1,70,1,80,1,90,1,100,1,110,1,120,1,130,1,140,1,150,1,160,1,170,1,180,1,
+190,1,200,1,210,1,220,1,230,1,240,1,250,2,4,2,14,2,24,2,34,2,44,2,54,2,64,
+2,74,2,84,2,94,2,104,2,114,2,124,2,134,2,144,2,154,2,164,2,174,2,184,2,194,
+2,204,2,214,2,224,2,234,2,244,2,254,3,8,3,18,3,28,3,38,3,48,3,58,3,68,0,1,
+0,4,1,14,0,2,0,129,0,1,0,4,1,15,0,2,0,129,0,1,0,4,1,16,0,2,0,129,0,1,0,4,
+1,17,0,2,0,129,0,1,0,4,1,18,0,2,0,129,0,1,0,4,1,19,0,2,0,129,0,1,0,4,1,20,
+0,2,0,129,0,1,0,4,1,21,0,2,0,129,0,1,0,4,1,22,0,2,0,129,0,1,0,4,1,23,0,2,
+0,129,0,1,0,4,1,24,0,2,0,129,0,1,0,4,1,25,0,2,0,129,0,1,0,4,1,26,0,2,0,129,
+0,1,0,4,1,27,0,2,0,129,0,1,0,4,1,28,0,2,0,129,0,1,0,4,1,29,0,2,0,129,0,1,
+0,4,1,30,0,2,0,129,0,1,0,4,1,31,0,2,0,129,0,1,0,4,1,32,0,2,0,129,0,1,0,4,
+1,33,0,2,0,129,0,1,0,4,1,34,0,2,0,129,0,1,0,4,1,35,0,2,0,129,0,1,0,4,1,36,
+0,2,0,129,0,1,0,4,1,37,0,2,0,129,0,1,0,4,1,38,0,2,0,129,0,1,0,4,1,39,0,2,
+0,129,0,1,0,4,1,40,0,2,0,129,0,1,0,4,1,41,0,2,0,129,0,1,0,4,1,42,0,2,0,129,
+0,1,0,4,1,43,0,2,0,129,0,1,0,4,1,44,0,2,0,129,0,1,0,4,1,45,0,2,0,129,0,1,
+0,4,1,46,0,2,0,129,0,1,0,4,1,47,0,2,0,129,0,1,0,4,1,48,0,2,0,129,0,1,0,4,
+1,49,0,2,0,129,0,1,0,4,1,50,0,2,0,129,0,1,0,4,1,51,0,2,0,129,0,1,0,4,1,52,
+0,2,0,129,0,1,0,4,1,53,0,2,0,129,0,1,0,4,1,54,0,2,0,129,0,1,0,4,1,55,0,2,
+0,129,0,1,0,4,1,56,0,2,0,129,0,1,0,4,1,57,0,2,0,129,0,1,0,4,1,58,0,2,0,129,
+0,1,0,4,1,59,0,2,0,129,0,1,0,4,1,60,0,2,0,129,0,1,0,4,1,61,0,2,0,129,0,1,
+0,4,1,62,0,2,0,129,0,1,0,4,1,63,0,2,0,129,0,1,0,4,1,64,0,2,0,129,0,1,0,4,
+1,65,0,2,0,129,0,1,0,4,1,66,0,2,0,129,0,1,0,4,1,67,0,2,0,129,0,1,0,4,1,68,
+0,2,0,129,0,1,0,4,1,69,0,2,0,129,0,1,0,4,1,70,0,2,0,129,0,1,0,4,1,71,0,2,
+0,129,0,1,0,4,1,72,0,2,0,129,0,1,0,4,1,73,0,2,0,129,0,1,0,4,1,74,0,2,0,129,
+0,1,0,4,1,75,0,2,0,129,0,1,0,4,1,76,0,2,0,129,0,1,0,4,1,77,0,2,0,129,0,1,
+0,4,1,78,0,2,0,129,0,1,0,4,1,79,0,2,0,129,0,1,0,4,1,80,0,2,0,129,0,1,0,4,
+1,81,0,2,0,129,0,1,0,4,1,82,0,2,0,129,0,1,0,4,1,83,0,2,0,129,0,2,0,1,0,130,
+0,199,0,0,0,4,0,0,0,1,0,8,0,1,1,58,0,7,0,20,0,72,0,94,0,136,0,158,0,190,0,
+212,0,5,0,12,0,20,0,28,0,36,0,44,1,87,0,3,0,70,0,21,1,88,0,3,0,70,0,23,1,
+89,0,3,0,70,0,24,1,90,0,3,0,70,0,45,1,91,0,3,0,70,0,46,0,2,0,6,0,14,1,92,
+0,3,0,70,0,46,1,93,0,3,0,70,0,50,0,4,0,10,0,18,0,26,0,34,1,96,0,3,0,70,0,
+31,1,99,0,3,0,70,0,32,1,101,0,3,0,70,0,46,1,102,0,3,0,70,0,50,0,2,0,6,0,14,
+1,103,0,3,0,70,0,32,1,105,0,3,0,70,0,46,0,3,0,8,0,16,0,24,1,106,0,3,0,70,
+0,33,1,108,0,3,0,70,0,34,1,109,0,3,0,70,0,46,0,2,0,6,0,14,1,110,0,3,0,70,
+0,34,1,111,0,3,0,70,0,46,0,10,0,22,0,30,0,38,0,46,0,54,0,62,0,70,0,78,0,86,
+0,94,1,113,0,3,0,70,0,23,1,114,0,3,0,70,0,24,1,115,0,3,0,70,0,38,1,116,0,
+3,0,70,0,39,1,117,0,3,0,70,0,40,1,118,0,3,0,70,0,43,1,119,0,3,0,70,0,44,1,
+120,0,3,0,70,0,45,1,121,0,3,0,70,0,46,1,122,0,3,0,70,0,50,0,1,0,7,0,25,0,
+27,0,31,0,32,0,33,0,34,0,38,0,4,0,0,0,1,0,8,0,1,1,238,0,18,0,42,0,60,0,70,
+0,112,0,130,0,148,0,182,0,200,0,226,0,244,0,254,1,80,1,90,1,100,1,110,1,144,
+1,178,1,188,0,2,0,6,0,12,1,84,0,2,0,21,1,85,0,2,0,46,0,1,0,4,1,86,0,2,0,40,
+0,5,0,12,0,18,0,24,0,30,0,36,1,87,0,2,0,21,1,88,0,2,0,23,1,89,0,2,0,24,1,
+90,0,2,0,45,1,91,0,2,0,46,0,2,0,6,0,12,1,92,0,2,0,46,1,93,0,2,0,50,0,2,0,
+6,0,12,1,94,0,2,0,26,1,95,0,2,0,28,0,4,0,10,0,16,0,22,0,28,1,96,0,2,0,31,
+1,99,0,2,0,32,1,101,0,2,0,46,1,102,0,2,0,50,0,2,0,6,0,12,1,103,0,2,0,32,1,
+105,0,2,0,46,0,3,0,8,0,14,0,20,1,106,0,2,0,33,1,108,0,2,0,34,1,109,0,2,0,
+46,0,2,0,6,0,12,1,110,0,2,0,34,1,111,0,2,0,46,0,1,0,4,1,112,0,2,0,36,0,10,
+0,22,0,28,0,34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,1,113,0,2,0,23,1,114,0,
+2,0,24,1,115,0,2,0,38,1,116,0,2,0,39,1,117,0,2,0,40,1,118,0,2,0,43,1,119,
+0,2,0,44,1,120,0,2,0,45,1,121,0,2,0,46,1,122,0,2,0,50,0,1,0,4,1,123,0,2,0,
+40,0,1,0,4,1,124,0,2,0,46,0,1,0,4,1,125,0,2,0,46,0,4,0,10,0,16,0,22,0,28,
+1,126,0,2,0,26,1,127,0,2,0,40,1,128,0,2,0,48,1,129,0,2,0,50,0,4,0,10,0,16,
+0,22,0,28,1,130,0,2,0,31,1,132,0,2,0,32,1,131,0,2,0,210,1,133,0,2,0,211,0,
+1,0,4,1,134,0,2,0,215,0,6,0,14,0,20,0,26,0,32,0,38,0,44,1,135,0,2,0,35,1,
+136,0,2,0,40,1,137,0,2,0,45,1,138,0,2,0,46,1,139,0,2,0,48,1,140,0,2,0,50,
+0,1,0,18,0,130,0,132,0,134,0,136,0,139,0,140,0,141,0,142,0,143,0,145,0,147,
+0,149,0,151,0,158,0,160,0,161,0,162,0,163,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,
+8,0,1,0,4,1,141,0,2,0,145,0,1,0,1,0,145,0,6,0,0,0,1,0,8,0,2,0,16,0,22,0,30,
+0,38,0,2,0,0,0,90,0,1,0,1,0,160,0,1,0,1,0,1,0,1,0,1,0,160,0,1,0,1,0,2,0,8,
+0,135,0,135,0,1,0,149,0,149,0,1,0,157,0,157,0,1,0,159,0,159,0,1,0,205,0,205,
+0,1,0,219,0,219,0,1,0,227,0,227,0,1,0,229,0,229,0,1,0,1,0,4,0,0,0,1,0,1,0,
+1,0,1,0,0,0,14,0,1,0,0,0,1,0,8,0,1,0,6,0,238,0,1,0,1,0,160,0,5,1,0,0,1,0,
+8,0,2,0,14,0,24,0,3,0,0,0,40,0,0,0,2,0,1,0,15,0,20,0,0,0,2,0,2,0,15,0,20,
+0,1,0,128,0,128,0,2,0,1,0,4,0,2,0,1,0,2,0,0,0,16,0,2,0,0,0,1,0,8,0,1,0,54,
+0,6,0,18,0,24,0,30,0,36,0,42,0,48,0,2,0,7,0,64,0,2,0,7,0,65,0,2,0,7,0,66,
+0,2,0,7,0,67,0,2,0,7,0,68,0,2,0,7,0,69,0,2,0,1,0,15,0,20,0,0,0,4,0,0,0,1,
+0,8,0,1,0,26,0,1,0,8,0,2,0,6,0,12,1,168,0,2,0,4,1,168,0,2,0,5,0,1,0,1,0,128,
+0,4,1,0,0,1,0,8,0,1,1,166,0,16,0,38,0,56,0,74,0,92,0,110,0,128,0,146,0,164,
+0,182,0,200,0,218,0,252,1,30,1,64,1,98,1,132,0,2,0,6,0,12,1,171,0,2,0,4,1,
+171,0,2,0,5,0,2,0,6,0,12,1,172,0,2,0,4,1,172,0,2,0,5,0,2,0,6,0,12,1,169,0,
+2,0,4,1,169,0,2,0,5,0,2,0,6,0,12,1,170,0,2,0,4,1,170,0,2,0,5,0,2,0,6,0,12,
+1,173,0,2,0,4,1,173,0,2,0,5,0,2,0,6,0,12,1,174,0,2,0,4,1,174,0,2,0,5,0,2,
+0,6,0,12,1,175,0,2,0,4,1,175,0,2,0,5,0,2,0,6,0,12,1,176,0,2,0,4,1,176,0,2,
+0,5,0,2,0,6,0,12,1,177,0,2,0,4,1,177,0,2,0,5,0,2,0,6,0,12,1,178,0,2,0,4,1,
+178,0,2,0,5,0,4,0,10,0,16,0,22,0,28,1,150,0,2,0,4,1,150,0,2,0,5,1,151,0,2,
+0,128,1,152,0,2,1,168,0,4,0,10,0,16,0,22,0,28,1,153,0,2,0,4,1,153,0,2,0,5,
+1,154,0,2,0,128,1,155,0,2,1,168,0,4,0,10,0,16,0,22,0,28,1,156,0,2,0,4,1,156,
+0,2,0,5,1,157,0,2,0,128,1,158,0,2,1,168,0,4,0,10,0,16,0,22,0,28,1,159,0,2,
+0,4,1,159,0,2,0,5,1,160,0,2,0,128,1,161,0,2,1,168,0,4,0,10,0,16,0,22,0,28,
+1,162,0,2,0,4,1,162,0,2,0,5,1,163,0,2,0,128,1,164,0,2,1,168,0,4,0,10,0,16,
+0,22,0,28,1,165,0,2,0,4,1,165,0,2,0,5,1,166,0,2,0,128,1,167,0,2,1,168,0,2,
+0,3,0,9,0,12,0,0,0,15,0,20,0,4,0,64,0,69,0,10,0,5,0,0,0,1,0,8,0,2,0,122,0,
+128,0,57,0,0,5,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,231,0,21,0,21,0,3,0,22,0,23,0,2,0,24,
+0,25,0,3,0,26,0,28,0,2,0,29,0,29,0,3,0,30,0,30,0,2,0,31,0,34,0,3,0,35,0,35,
+0,2,0,36,0,42,0,3,0,43,0,44,0,2,0,45,0,48,0,3,0,49,0,49,0,2,0,50,0,50,0,3,
+0,51,0,51,0,2,0,52,0,52,0,3,0,53,0,53,0,2,0,54,0,54,0,3,0,58,0,58,0,1,0,90,
+0,90,0,55,0,92,0,92,0,3,0,93,0,94,0,2,0,95,0,96,0,3,0,97,0,99,0,2,0,100,0,
+100,0,3,0,101,0,101,0,2,0,102,0,105,0,3,0,106,0,106,0,2,0,107,0,113,0,3,0,
+114,0,115,0,2,0,116,0,119,0,3,0,120,0,120,0,2,0,121,0,121,0,3,0,122,0,122,
+0,2,0,123,0,123,0,3,0,124,0,124,0,2,0,125,0,125,0,3,0,126,0,127,0,2,0,130,
+0,130,0,35,0,131,0,131,0,52,0,132,0,132,0,9,0,133,0,133,0,17,0,134,0,134,
+0,33,0,135,0,135,0,26,0,138,0,138,0,56,0,139,0,139,0,34,0,140,0,140,0,20,
+0,141,0,141,0,40,0,142,0,142,0,29,0,143,0,143,0,39,0,144,0,144,0,53,0,145,
+0,145,0,5,0,146,0,146,0,15,0,147,0,147,0,25,0,148,0,148,0,13,0,149,0,149,
+0,4,0,150,0,150,0,7,0,151,0,151,0,36,0,152,0,152,0,49,0,153,0,153,0,54,0,
+154,0,154,0,8,0,155,0,155,0,11,0,156,0,156,0,19,0,157,0,157,0,23,0,158,0,
+158,0,48,0,159,0,159,0,10,0,160,0,160,0,16,0,161,0,161,0,14,0,162,0,162,0,
+46,0,163,0,163,0,28,0,164,0,164,0,31,0,165,0,165,0,30,0,166,0,166,0,35,0,
+167,0,167,0,52,0,168,0,168,0,9,0,169,0,169,0,17,0,170,0,170,0,33,0,171,0,
+171,0,26,0,174,0,174,0,56,0,175,0,175,0,34,0,176,0,176,0,20,0,177,0,177,0,
+40,0,178,0,178,0,29,0,179,0,179,0,39,0,180,0,180,0,53,0,181,0,181,0,5,0,182,
+0,182,0,15,0,183,0,183,0,25,0,184,0,184,0,13,0,185,0,185,0,4,0,186,0,186,
+0,7,0,187,0,187,0,36,0,188,0,188,0,49,0,189,0,189,0,54,0,190,0,190,0,8,0,
+191,0,191,0,11,0,192,0,192,0,19,0,193,0,193,0,23,0,194,0,194,0,48,0,195,0,
+195,0,10,0,196,0,196,0,16,0,197,0,197,0,14,0,198,0,198,0,46,0,199,0,199,0,
+28,0,200,0,200,0,3,0,201,0,202,0,2,0,203,0,204,0,3,0,205,0,207,0,2,0,208,
+0,208,0,3,0,209,0,209,0,2,0,210,0,213,0,3,0,214,0,214,0,2,0,215,0,221,0,3,
+0,222,0,223,0,2,0,224,0,227,0,3,0,228,0,228,0,2,0,229,0,229,0,3,0,230,0,230,
+0,2,0,231,0,231,0,3,0,232,0,232,0,2,0,233,0,233,0,3,0,234,0,235,0,2,0,236,
+0,236,0,3,0,237,0,238,0,2,0,239,0,240,0,3,0,241,0,243,0,2,0,244,0,244,0,3,
+0,245,0,245,0,2,0,246,0,249,0,3,0,250,0,250,0,2,0,251,1,1,0,3,1,2,1,3,0,2,
+1,4,1,7,0,3,1,8,1,8,0,2,1,9,1,9,0,3,1,10,1,10,0,2,1,11,1,11,0,3,1,12,1,12,
+0,2,1,13,1,13,0,3,1,14,1,14,0,44,1,15,1,15,0,52,1,16,1,16,0,21,1,17,1,17,
+0,17,1,18,1,18,0,33,1,19,1,19,0,26,1,22,1,22,0,56,1,23,1,23,0,34,1,24,1,24,
+0,20,1,25,1,25,0,40,1,26,1,26,0,29,1,27,1,27,0,39,1,28,1,28,0,54,1,29,1,29,
+0,6,1,30,1,30,0,15,1,31,1,31,0,32,1,32,1,32,0,13,1,33,1,33,0,4,1,34,1,34,
+0,7,1,35,1,35,0,45,1,36,1,36,0,49,1,37,1,37,0,54,1,38,1,38,0,8,1,39,1,39,
+0,11,1,40,1,40,0,19,1,41,1,41,0,23,1,42,1,42,0,50,1,43,1,43,0,10,1,44,1,44,
+0,41,1,45,1,45,0,14,1,46,1,46,0,47,1,47,1,47,0,54,1,48,1,48,0,51,1,49,1,49,
+0,43,1,50,1,50,0,44,1,51,1,51,0,52,1,52,1,52,0,21,1,53,1,53,0,17,1,54,1,54,
+0,33,1,55,1,55,0,26,1,58,1,58,0,56,1,59,1,59,0,34,1,60,1,60,0,20,1,61,1,61,
+0,40,1,62,1,62,0,29,1,63,1,63,0,39,1,64,1,64,0,54,1,65,1,65,0,6,1,66,1,66,
+0,15,1,67,1,67,0,32,1,68,1,68,0,13,1,69,1,69,0,4,1,70,1,70,0,7,1,71,1,71,
+0,45,1,72,1,72,0,49,1,73,1,73,0,54,1,74,1,74,0,8,1,75,1,75,0,11,1,76,1,76,
+0,19,1,77,1,77,0,23,1,78,1,78,0,50,1,79,1,79,0,10,1,80,1,80,0,41,1,81,1,81,
+0,14,1,82,1,82,0,47,1,83,1,83,0,54,1,84,1,84,0,2,1,86,1,86,0,2,1,87,1,90,
+0,3,1,93,1,95,0,2,1,96,1,96,0,3,1,99,1,99,0,3,1,101,1,102,0,2,1,103,1,103,
+0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,109,1,109,0,2,1,110,1,110,0,3,1,112,
+1,112,0,2,1,113,1,113,0,3,1,114,1,114,0,2,1,115,1,115,0,3,1,116,1,116,0,2,
+1,117,1,119,0,3,1,120,1,120,0,2,1,121,1,123,0,3,1,126,1,127,0,2,1,129,1,133,
+0,2,1,135,1,136,0,3,1,137,1,138,0,2,1,139,1,140,0,3,1,141,1,141,0,24,1,142,
+1,142,0,12,0,94,0,190,0,200,0,210,0,222,0,236,0,248,1,6,1,18,1,32,1,44,1,
+58,1,70,1,84,1,96,1,110,1,122,1,136,1,148,1,162,1,174,1,188,1,200,1,214,1,
+226,1,240,1,252,2,10,2,22,2,36,2,48,2,62,2,74,2,88,2,100,2,114,2,126,2,140,
+2,152,2,166,2,178,2,192,2,204,2,218,2,230,2,244,3,0,3,14,3,26,3,40,3,52,3,
+66,3,78,3,92,3,104,3,118,3,130,3,144,3,156,3,170,3,182,3,196,3,208,3,222,
+3,234,3,248,4,4,4,18,4,30,4,44,4,56,4,70,4,82,4,96,4,108,4,122,4,134,4,148,
+4,160,4,174,4,186,4,200,4,212,4,226,4,238,4,252,5,8,5,22,5,34,5,48,5,60,5,
+74,5,86,5,100,5,112,0,2,0,1,0,2,0,0,0,66,0,2,0,1,0,3,0,0,0,66,0,3,0,1,0,4,
+0,3,0,0,0,20,0,4,0,1,0,4,0,55,0,3,0,0,0,20,0,3,0,1,0,5,0,3,0,0,0,21,0,4,0,
+1,0,5,0,55,0,3,0,0,0,21,0,3,0,1,0,6,0,3,0,0,0,22,0,4,0,1,0,6,0,55,0,3,0,0,
+0,22,0,3,0,1,0,7,0,3,0,0,0,23,0,4,0,1,0,7,0,55,0,3,0,0,0,23,0,3,0,1,0,8,0,
+3,0,0,0,24,0,4,0,1,0,8,0,55,0,3,0,0,0,24,0,3,0,1,0,9,0,3,0,0,0,25,0,4,0,1,
+0,9,0,55,0,3,0,0,0,25,0,3,0,1,0,10,0,3,0,0,0,26,0,4,0,1,0,10,0,55,0,3,0,0,
+0,26,0,3,0,1,0,11,0,3,0,0,0,27,0,4,0,1,0,11,0,55,0,3,0,0,0,27,0,3,0,1,0,12,
+0,3,0,0,0,28,0,4,0,1,0,12,0,55,0,3,0,0,0,28,0,3,0,1,0,13,0,3,0,0,0,29,0,4,
+0,1,0,13,0,55,0,3,0,0,0,29,0,3,0,1,0,14,0,3,0,0,0,30,0,4,0,1,0,14,0,55,0,
+3,0,0,0,30,0,3,0,1,0,15,0,3,0,0,0,31,0,4,0,1,0,15,0,55,0,3,0,0,0,31,0,3,0,
+1,0,16,0,3,0,0,0,32,0,4,0,1,0,16,0,55,0,3,0,0,0,32,0,3,0,1,0,17,0,3,0,0,0,
+33,0,4,0,1,0,17,0,55,0,3,0,0,0,33,0,3,0,1,0,19,0,3,0,0,0,34,0,4,0,1,0,19,
+0,55,0,3,0,0,0,34,0,3,0,1,0,20,0,3,0,0,0,35,0,4,0,1,0,20,0,55,0,3,0,0,0,35,
+0,3,0,1,0,21,0,3,0,0,0,36,0,4,0,1,0,21,0,55,0,3,0,0,0,36,0,3,0,1,0,23,0,3,
+0,0,0,37,0,4,0,1,0,23,0,55,0,3,0,0,0,37,0,3,0,1,0,24,0,3,0,0,0,38,0,4,0,1,
+0,24,0,55,0,3,0,0,0,38,0,3,0,1,0,25,0,3,0,0,0,39,0,4,0,1,0,25,0,55,0,3,0,
+0,0,39,0,3,0,1,0,26,0,3,0,0,0,40,0,4,0,1,0,26,0,55,0,3,0,0,0,40,0,3,0,1,0,
+28,0,3,0,0,0,41,0,4,0,1,0,28,0,55,0,3,0,0,0,41,0,3,0,1,0,29,0,3,0,0,0,42,
+0,4,0,1,0,29,0,55,0,3,0,0,0,42,0,3,0,1,0,30,0,3,0,0,0,43,0,4,0,1,0,30,0,55,
+0,3,0,0,0,43,0,3,0,1,0,31,0,3,0,0,0,44,0,4,0,1,0,31,0,55,0,3,0,0,0,44,0,3,
+0,1,0,32,0,3,0,0,0,45,0,4,0,1,0,32,0,55,0,3,0,0,0,45,0,3,0,1,0,33,0,3,0,0,
+0,46,0,4,0,1,0,33,0,55,0,3,0,0,0,46,0,3,0,1,0,34,0,3,0,0,0,47,0,4,0,1,0,34,
+0,55,0,3,0,0,0,47,0,3,0,1,0,35,0,3,0,0,0,48,0,4,0,1,0,35,0,55,0,3,0,0,0,48,
+0,3,0,1,0,36,0,3,0,0,0,49,0,4,0,1,0,36,0,55,0,3,0,0,0,49,0,3,0,1,0,39,0,3,
+0,0,0,50,0,4,0,1,0,39,0,55,0,3,0,0,0,50,0,3,0,1,0,40,0,3,0,0,0,51,0,4,0,1,
+0,40,0,55,0,3,0,0,0,51,0,3,0,1,0,41,0,3,0,0,0,52,0,4,0,1,0,41,0,55,0,3,0,
+0,0,52,0,3,0,1,0,43,0,3,0,0,0,53,0,4,0,1,0,43,0,55,0,3,0,0,0,53,0,3,0,1,0,
+44,0,3,0,0,0,54,0,4,0,1,0,44,0,55,0,3,0,0,0,54,0,3,0,1,0,45,0,3,0,0,0,55,
+0,4,0,1,0,45,0,55,0,3,0,0,0,55,0,3,0,1,0,46,0,3,0,0,0,56,0,4,0,1,0,46,0,55,
+0,3,0,0,0,56,0,3,0,1,0,47,0,3,0,0,0,57,0,4,0,1,0,47,0,55,0,3,0,0,0,57,0,3,
+0,1,0,48,0,3,0,0,0,58,0,4,0,1,0,48,0,55,0,3,0,0,0,58,0,3,0,1,0,49,0,3,0,0,
+0,59,0,4,0,1,0,49,0,55,0,3,0,0,0,59,0,3,0,1,0,50,0,3,0,0,0,60,0,4,0,1,0,50,
+0,55,0,3,0,0,0,60,0,3,0,1,0,51,0,3,0,0,0,61,0,4,0,1,0,51,0,55,0,3,0,0,0,61,
+0,3,0,1,0,52,0,3,0,0,0,62,0,4,0,1,0,52,0,55,0,3,0,0,0,62,0,3,0,1,0,53,0,3,
+0,0,0,63,0,4,0,1,0,53,0,55,0,3,0,0,0,63,0,3,0,1,0,54,0,3,0,0,0,64,0,4,0,1,
+0,54,0,55,0,3,0,0,0,64,0,3,0,1,0,56,0,3,0,0,0,65,0,4,0,1,0,56,0,55,0,3,0,
+0,0,65,0,5,0,0,0,1,0,8,0,2,0,26,0,32,0,9,0,0,2,130,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,0,1,0,58,0,2,0,101,0,21,0,21,0,3,0,24,0,24,0,6,0,25,0,25,0,3,0,
+27,0,27,0,6,0,29,0,29,0,6,0,31,0,31,0,8,0,32,0,32,0,4,0,33,0,34,0,3,0,36,
+0,36,0,5,0,37,0,37,0,6,0,38,0,38,0,3,0,39,0,41,0,5,0,42,0,42,0,3,0,45,0,46,
+0,5,0,47,0,47,0,3,0,50,0,50,0,5,0,52,0,52,0,5,0,54,0,54,0,4,0,58,0,58,0,1,
+0,90,0,90,0,7,0,92,0,92,0,3,0,95,0,95,0,6,0,96,0,96,0,3,0,98,0,98,0,6,0,100,
+0,100,0,6,0,102,0,102,0,3,0,103,0,103,0,4,0,104,0,105,0,3,0,107,0,107,0,5,
+0,108,0,108,0,6,0,109,0,109,0,3,0,110,0,110,0,6,0,111,0,112,0,5,0,113,0,113,
+0,3,0,116,0,117,0,6,0,118,0,118,0,3,0,121,0,121,0,5,0,123,0,123,0,5,0,125,
+0,125,0,5,0,149,0,149,0,2,0,185,0,185,0,2,0,200,0,200,0,3,0,203,0,203,0,6,
+0,204,0,204,0,3,0,206,0,206,0,6,0,208,0,208,0,6,0,210,0,210,0,8,0,211,0,211,
+0,4,0,212,0,213,0,3,0,215,0,215,0,5,0,216,0,216,0,6,0,217,0,217,0,3,0,218,
+0,218,0,6,0,219,0,220,0,5,0,221,0,221,0,3,0,224,0,225,0,5,0,226,0,226,0,3,
+0,229,0,229,0,5,0,231,0,231,0,5,0,233,0,233,0,4,0,236,0,236,0,3,0,239,0,239,
+0,6,0,240,0,240,0,3,0,242,0,242,0,6,0,244,0,244,0,6,0,246,0,246,0,3,0,247,
+0,247,0,4,0,248,0,249,0,3,0,251,0,251,0,5,0,252,0,252,0,6,0,253,0,253,0,4,
+0,254,0,254,0,6,0,255,1,0,0,5,1,1,1,1,0,3,1,4,1,5,0,6,1,6,1,6,0,3,1,9,1,9,
+0,5,1,11,1,11,0,5,1,13,1,13,0,4,1,33,1,33,0,2,1,69,1,69,0,2,1,87,1,90,0,3,
+1,93,1,93,0,6,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,3,
+1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,4,1,114,1,114,0,6,1,115,1,115,
+0,3,1,116,1,116,0,6,1,117,1,117,0,4,1,118,1,118,0,5,1,119,1,119,0,4,1,121,
+1,121,0,6,1,122,1,122,0,3,1,123,1,123,0,6,1,135,1,136,0,4,1,139,1,140,0,4,
+0,10,0,22,0,34,0,46,0,58,0,70,0,82,0,96,0,110,0,124,0,138,0,3,0,1,0,2,0,3,
+0,0,0,70,0,3,0,1,0,2,0,4,0,0,0,71,0,3,0,1,0,2,0,5,0,0,0,72,0,3,0,1,0,2,0,
+6,0,0,0,73,0,3,0,1,0,2,0,8,0,0,0,69,0,4,0,1,0,2,0,7,0,3,0,0,0,70,0,4,0,1,
+0,2,0,7,0,4,0,0,0,71,0,4,0,1,0,2,0,7,0,5,0,0,0,72,0,4,0,1,0,2,0,7,0,6,0,0,
+0,73,0,4,0,1,0,2,0,7,0,8,0,0,0,69,0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,2,
+116,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,99,0,21,0,21,0,3,0,24,0,24,
+0,6,0,25,0,25,0,4,0,27,0,27,0,6,0,29,0,29,0,6,0,31,0,31,0,3,0,32,0,33,0,4,
+0,34,0,34,0,3,0,36,0,36,0,5,0,37,0,37,0,6,0,38,0,38,0,3,0,39,0,39,0,6,0,40,
+0,41,0,5,0,42,0,42,0,3,0,45,0,45,0,5,0,46,0,46,0,6,0,47,0,47,0,3,0,48,0,48,
+0,6,0,50,0,50,0,5,0,52,0,52,0,6,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,7,
+0,92,0,92,0,3,0,95,0,95,0,6,0,96,0,96,0,4,0,98,0,98,0,6,0,100,0,100,0,6,0,
+102,0,102,0,3,0,103,0,104,0,4,0,105,0,105,0,3,0,107,0,107,0,5,0,108,0,108,
+0,6,0,109,0,109,0,3,0,110,0,110,0,6,0,111,0,112,0,5,0,113,0,113,0,3,0,116,
+0,117,0,6,0,118,0,118,0,3,0,121,0,121,0,6,0,123,0,123,0,6,0,125,0,125,0,5,
+0,145,0,145,0,2,0,181,0,181,0,2,0,200,0,200,0,3,0,203,0,203,0,6,0,204,0,204,
+0,4,0,206,0,206,0,6,0,208,0,208,0,6,0,210,0,210,0,3,0,211,0,212,0,4,0,213,
+0,213,0,3,0,215,0,216,0,6,0,217,0,217,0,4,0,218,0,218,0,6,0,219,0,220,0,5,
+0,221,0,221,0,3,0,224,0,224,0,5,0,225,0,225,0,6,0,226,0,226,0,3,0,227,0,227,
+0,6,0,229,0,229,0,5,0,231,0,231,0,6,0,233,0,233,0,4,0,236,0,236,0,4,0,239,
+0,239,0,6,0,240,0,240,0,4,0,242,0,242,0,6,0,244,0,244,0,6,0,246,0,246,0,3,
+0,247,0,248,0,4,0,249,0,249,0,3,0,251,0,252,0,6,0,253,0,253,0,4,0,254,0,254,
+0,6,0,255,1,0,0,5,1,1,1,1,0,4,1,4,1,5,0,6,1,6,1,6,0,3,1,9,1,9,0,6,1,11,1,
+11,0,6,1,13,1,13,0,4,1,87,1,90,0,4,1,93,1,93,0,6,1,96,1,96,0,3,1,99,1,99,
+0,3,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,
+1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,118,1,119,0,5,1,121,1,121,0,6,
+1,122,1,122,0,5,1,123,1,123,0,6,1,135,1,136,0,4,1,139,1,140,0,4,0,8,0,18,
+0,30,0,42,0,54,0,66,0,80,0,94,0,108,0,3,0,1,0,2,0,3,0,0,0,70,0,3,0,1,0,2,
+0,4,0,0,0,71,0,3,0,1,0,2,0,5,0,0,0,72,0,3,0,1,0,2,0,6,0,0,0,73,0,4,0,1,0,
+2,0,7,0,3,0,0,0,70,0,4,0,1,0,2,0,7,0,4,0,0,0,71,0,4,0,1,0,2,0,7,0,5,0,0,0,
+72,0,4,0,1,0,2,0,7,0,6,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,2,32,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,85,0,21,0,21,0,4,0,25,0,25,0,4,
+0,27,0,27,0,6,0,31,0,31,0,3,0,32,0,34,0,4,0,36,0,36,0,6,0,38,0,38,0,3,0,39,
+0,39,0,6,0,40,0,40,0,5,0,41,0,41,0,6,0,42,0,42,0,4,0,45,0,46,0,6,0,47,0,47,
+0,3,0,50,0,50,0,6,0,52,0,52,0,6,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,7,
+0,92,0,92,0,4,0,96,0,96,0,4,0,98,0,98,0,6,0,102,0,102,0,3,0,103,0,105,0,4,
+0,107,0,107,0,6,0,109,0,109,0,3,0,110,0,110,0,6,0,111,0,111,0,5,0,112,0,112,
+0,6,0,113,0,113,0,4,0,116,0,117,0,6,0,118,0,118,0,3,0,121,0,121,0,6,0,123,
+0,123,0,6,0,125,0,125,0,5,0,200,0,200,0,4,0,204,0,204,0,4,0,206,0,206,0,6,
+0,210,0,210,0,3,0,211,0,213,0,4,0,215,0,215,0,6,0,217,0,217,0,4,0,218,0,218,
+0,6,0,219,0,219,0,5,0,220,0,220,0,6,0,221,0,221,0,4,0,224,0,225,0,6,0,226,
+0,226,0,3,0,229,0,229,0,6,0,231,0,231,0,6,0,233,0,233,0,4,0,236,0,236,0,4,
+0,240,0,240,0,4,0,242,0,242,0,6,0,246,0,246,0,3,0,247,0,249,0,4,0,251,0,251,
+0,6,0,253,0,253,0,4,0,254,0,254,0,6,0,255,0,255,0,5,1,0,1,0,0,6,1,1,1,1,0,
+4,1,4,1,5,0,6,1,6,1,6,0,3,1,9,1,9,0,6,1,11,1,11,0,6,1,13,1,13,0,4,1,29,1,
+29,0,2,1,65,1,65,0,2,1,87,1,90,0,4,1,93,1,93,0,6,1,96,1,96,0,3,1,99,1,99,
+0,3,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,
+1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,118,1,119,0,5,1,121,1,121,0,6,
+1,122,1,122,0,5,1,123,1,123,0,6,1,135,1,136,0,4,1,139,1,140,0,4,0,8,0,18,
+0,30,0,42,0,54,0,66,0,80,0,94,0,108,0,3,0,1,0,2,0,3,0,0,0,70,0,3,0,1,0,2,
+0,4,0,0,0,71,0,3,0,1,0,2,0,5,0,0,0,72,0,3,0,1,0,2,0,6,0,0,0,73,0,4,0,1,0,
+2,0,7,0,3,0,0,0,70,0,4,0,1,0,2,0,7,0,4,0,0,0,71,0,4,0,1,0,2,0,7,0,5,0,0,0,
+72,0,4,0,1,0,2,0,7,0,6,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,2,62,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,90,0,21,0,21,0,4,0,25,0,25,0,4,
+0,27,0,27,0,6,0,31,0,31,0,3,0,32,0,34,0,4,0,36,0,36,0,5,0,38,0,38,0,3,0,39,
+0,39,0,6,0,40,0,41,0,5,0,42,0,42,0,4,0,45,0,45,0,6,0,46,0,46,0,5,0,47,0,47,
+0,3,0,48,0,48,0,6,0,50,0,50,0,6,0,52,0,52,0,6,0,54,0,54,0,4,0,58,0,58,0,1,
+0,90,0,90,0,7,0,92,0,92,0,4,0,96,0,96,0,4,0,98,0,98,0,6,0,102,0,102,0,3,0,
+103,0,105,0,4,0,107,0,107,0,6,0,109,0,109,0,3,0,110,0,110,0,6,0,111,0,111,
+0,5,0,112,0,112,0,6,0,113,0,113,0,4,0,116,0,117,0,6,0,118,0,118,0,3,0,121,
+0,121,0,6,0,123,0,123,0,6,0,125,0,125,0,5,0,150,0,150,0,2,0,186,0,186,0,2,
+0,200,0,200,0,4,0,204,0,204,0,4,0,206,0,206,0,6,0,210,0,210,0,3,0,211,0,213,
+0,4,0,215,0,215,0,6,0,217,0,217,0,4,0,218,0,218,0,6,0,219,0,220,0,5,0,221,
+0,221,0,4,0,224,0,224,0,6,0,225,0,225,0,5,0,226,0,226,0,3,0,227,0,227,0,6,
+0,229,0,229,0,6,0,231,0,231,0,6,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,
+0,4,0,242,0,242,0,6,0,246,0,246,0,3,0,247,0,249,0,4,0,251,0,251,0,6,0,253,
+0,253,0,4,0,254,0,254,0,6,0,255,0,255,0,5,1,0,1,0,0,6,1,1,1,1,0,4,1,4,1,5,
+0,6,1,6,1,6,0,3,1,9,1,9,0,6,1,11,1,11,0,6,1,13,1,13,0,4,1,34,1,34,0,2,1,70,
+1,70,0,2,1,87,1,90,0,4,1,93,1,93,0,6,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,
+103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,
+115,1,115,0,3,1,117,1,117,0,4,1,118,1,118,0,6,1,119,1,119,0,5,1,121,1,121,
+0,6,1,122,1,122,0,5,1,123,1,123,0,6,1,135,1,136,0,4,1,139,1,140,0,4,0,8,0,
+18,0,30,0,42,0,54,0,66,0,80,0,94,0,108,0,3,0,1,0,2,0,3,0,0,0,70,0,3,0,1,0,
+2,0,4,0,0,0,71,0,3,0,1,0,2,0,5,0,0,0,72,0,3,0,1,0,2,0,6,0,0,0,73,0,4,0,1,
+0,2,0,7,0,3,0,0,0,70,0,4,0,1,0,2,0,7,0,4,0,0,0,71,0,4,0,1,0,2,0,7,0,5,0,0,
+0,72,0,4,0,1,0,2,0,7,0,6,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,1,
+216,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,73,0,21,0,21,0,4,0,25,0,25,
+0,4,0,31,0,34,0,4,0,36,0,36,0,6,0,38,0,38,0,4,0,40,0,40,0,6,0,41,0,41,0,5,
+0,42,0,42,0,4,0,45,0,46,0,5,0,47,0,47,0,3,0,48,0,48,0,6,0,50,0,50,0,6,0,52,
+0,52,0,6,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,7,0,92,0,92,0,4,0,96,0,96,
+0,4,0,102,0,105,0,4,0,107,0,107,0,6,0,109,0,109,0,4,0,111,0,112,0,6,0,113,
+0,113,0,4,0,116,0,117,0,6,0,118,0,118,0,3,0,121,0,121,0,6,0,123,0,123,0,6,
+0,125,0,125,0,5,0,154,0,154,0,2,0,190,0,190,0,2,0,200,0,200,0,4,0,204,0,204,
+0,4,0,210,0,213,0,4,0,215,0,215,0,6,0,217,0,217,0,4,0,219,0,219,0,6,0,220,
+0,220,0,5,0,221,0,221,0,4,0,224,0,225,0,5,0,226,0,226,0,3,0,227,0,227,0,6,
+0,229,0,229,0,6,0,231,0,231,0,6,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,
+0,4,0,246,0,249,0,4,0,251,0,251,0,6,0,253,0,253,0,4,0,255,1,0,0,6,1,1,1,1,
+0,4,1,4,1,5,0,6,1,6,1,6,0,3,1,9,1,9,0,6,1,11,1,11,0,6,1,13,1,13,0,4,1,38,
+1,38,0,2,1,74,1,74,0,2,1,87,1,90,0,4,1,96,1,96,0,4,1,99,1,99,0,4,1,103,1,
+103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,
+115,1,115,0,4,1,117,1,117,0,4,1,118,1,118,0,6,1,119,1,119,0,5,1,122,1,122,
+0,6,1,135,1,136,0,4,1,139,1,140,0,4,0,8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,
+0,108,0,3,0,1,0,2,0,3,0,0,0,70,0,3,0,1,0,2,0,4,0,0,0,71,0,3,0,1,0,2,0,5,0,
+0,0,72,0,3,0,1,0,2,0,6,0,0,0,73,0,4,0,1,0,2,0,7,0,3,0,0,0,70,0,4,0,1,0,2,
+0,7,0,4,0,0,0,71,0,4,0,1,0,2,0,7,0,5,0,0,0,72,0,4,0,1,0,2,0,7,0,6,0,0,0,73,
+0,5,0,0,0,1,0,8,0,2,0,24,0,30,0,8,0,0,1,168,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+1,0,58,0,2,0,65,0,21,0,21,0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,
+36,0,36,0,6,0,38,0,38,0,4,0,40,0,41,0,6,0,42,0,42,0,4,0,47,0,47,0,3,0,50,
+0,50,0,6,0,52,0,52,0,6,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,7,0,92,0,92,
+0,4,0,96,0,96,0,4,0,102,0,105,0,4,0,107,0,107,0,6,0,109,0,109,0,4,0,111,0,
+112,0,6,0,113,0,113,0,4,0,118,0,118,0,3,0,121,0,121,0,6,0,123,0,123,0,6,0,
+125,0,125,0,5,0,132,0,132,0,2,0,168,0,168,0,2,0,200,0,200,0,4,0,204,0,204,
+0,4,0,210,0,210,0,3,0,211,0,213,0,4,0,215,0,215,0,6,0,217,0,217,0,4,0,219,
+0,220,0,6,0,221,0,221,0,4,0,226,0,226,0,3,0,229,0,229,0,6,0,231,0,231,0,6,
+0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,249,0,4,0,251,0,251,
+0,6,0,253,0,253,0,4,0,255,1,0,0,6,1,1,1,1,0,4,1,6,1,6,0,3,1,9,1,9,0,6,1,11,
+1,11,0,6,1,13,1,13,0,4,1,87,1,90,0,4,1,96,1,96,0,4,1,99,1,99,0,4,1,103,1,
+103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,
+115,1,115,0,4,1,117,1,117,0,4,1,118,1,118,0,6,1,119,1,119,0,5,1,122,1,122,
+0,6,1,135,1,136,0,4,1,139,1,140,0,4,0,8,0,18,0,30,0,42,0,54,0,66,0,80,0,94,
+0,108,0,3,0,1,0,2,0,3,0,0,0,70,0,3,0,1,0,2,0,4,0,0,0,71,0,3,0,1,0,2,0,5,0,
+0,0,72,0,3,0,1,0,2,0,6,0,0,0,73,0,4,0,1,0,2,0,7,0,3,0,0,0,70,0,4,0,1,0,2,
+0,7,0,4,0,0,0,71,0,4,0,1,0,2,0,7,0,5,0,0,0,72,0,4,0,1,0,2,0,7,0,6,0,0,0,73,
+0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,178,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,
+58,0,2,0,67,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,34,0,3,0,36,0,36,0,5,0,38,
+0,38,0,3,0,40,0,41,0,5,0,42,0,42,0,3,0,46,0,46,0,5,0,47,0,47,0,3,0,50,0,50,
+0,4,0,52,0,52,0,5,0,54,0,54,0,4,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,3,
+0,96,0,96,0,3,0,102,0,105,0,3,0,107,0,107,0,5,0,109,0,109,0,3,0,111,0,112,
+0,5,0,113,0,113,0,3,0,118,0,118,0,3,0,121,0,121,0,5,0,123,0,123,0,5,0,125,
+0,125,0,4,0,159,0,159,0,2,0,195,0,195,0,2,0,200,0,200,0,3,0,204,0,204,0,3,
+0,210,0,213,0,3,0,215,0,215,0,5,0,217,0,217,0,3,0,219,0,220,0,5,0,221,0,221,
+0,3,0,225,0,225,0,5,0,226,0,226,0,3,0,229,0,229,0,4,0,231,0,231,0,5,0,233,
+0,233,0,3,0,236,0,236,0,3,0,240,0,240,0,3,0,246,0,249,0,3,0,251,0,251,0,5,
+0,253,0,253,0,3,0,255,1,0,0,5,1,1,1,1,0,3,1,6,1,6,0,3,1,9,1,9,0,5,1,11,1,
+11,0,5,1,13,1,13,0,3,1,43,1,43,0,2,1,79,1,79,0,2,1,87,1,90,0,3,1,96,1,96,
+0,3,1,99,1,99,0,3,1,103,1,103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,
+110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,1,118,1,118,0,5,1,
+119,1,119,0,4,1,122,1,122,0,5,1,135,1,136,0,3,1,139,1,140,0,3,0,6,0,14,0,
+26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,
+0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,
+0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,
+0,1,178,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,67,0,21,0,21,0,3,0,25,0,25,
+0,3,0,31,0,34,0,3,0,36,0,36,0,5,0,38,0,38,0,3,0,40,0,41,0,5,0,42,0,42,0,3,
+0,46,0,46,0,5,0,47,0,47,0,3,0,50,0,50,0,5,0,52,0,52,0,5,0,54,0,54,0,4,0,58,
+0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,105,0,3,0,107,
+0,107,0,5,0,109,0,109,0,3,0,111,0,112,0,5,0,113,0,113,0,3,0,118,0,118,0,3,
+0,121,0,121,0,5,0,123,0,123,0,5,0,125,0,125,0,4,0,155,0,155,0,2,0,191,0,191,
+0,2,0,200,0,200,0,3,0,204,0,204,0,3,0,210,0,213,0,3,0,215,0,215,0,5,0,217,
+0,217,0,3,0,219,0,220,0,5,0,221,0,221,0,3,0,225,0,225,0,5,0,226,0,226,0,3,
+0,229,0,229,0,5,0,231,0,231,0,5,0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,
+0,3,0,246,0,249,0,3,0,251,0,251,0,5,0,253,0,253,0,3,0,255,1,0,0,5,1,1,1,1,
+0,3,1,6,1,6,0,3,1,9,1,9,0,5,1,11,1,11,0,5,1,13,1,13,0,3,1,39,1,39,0,2,1,75,
+1,75,0,2,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,3,1,106,
+1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,
+1,117,1,117,0,3,1,118,1,118,0,5,1,119,1,119,0,4,1,122,1,122,0,5,1,135,1,136,
+0,3,1,139,1,140,0,3,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,
+0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,
+3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,
+0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,154,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,
+0,2,0,63,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,34,0,3,0,36,0,36,0,5,0,38,0,38,
+0,3,0,40,0,41,0,5,0,42,0,42,0,3,0,47,0,47,0,3,0,50,0,50,0,5,0,52,0,52,0,5,
+0,54,0,54,0,4,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,3,0,96,0,96,0,3,0,102,
+0,105,0,3,0,107,0,107,0,5,0,109,0,109,0,3,0,111,0,112,0,5,0,113,0,113,0,3,
+0,118,0,118,0,3,0,121,0,121,0,5,0,123,0,123,0,5,0,125,0,125,0,4,0,200,0,200,
+0,3,0,204,0,204,0,3,0,210,0,213,0,3,0,215,0,215,0,5,0,217,0,217,0,3,0,219,
+0,220,0,5,0,221,0,221,0,3,0,226,0,226,0,3,0,229,0,229,0,5,0,231,0,231,0,5,
+0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,0,3,0,246,0,249,0,3,0,251,0,251,
+0,5,0,253,0,253,0,3,0,255,1,0,0,5,1,1,1,1,0,3,1,6,1,6,0,3,1,9,1,9,0,5,1,11,
+1,11,0,5,1,13,1,13,0,3,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,
+103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,1,
+115,1,115,0,3,1,117,1,117,0,3,1,118,1,118,0,5,1,119,1,119,0,4,1,122,1,122,
+0,5,1,135,1,135,0,4,1,136,1,136,0,3,1,139,1,140,0,4,1,142,1,142,0,2,0,6,0,
+14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,
+0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,
+6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,
+0,7,0,0,1,148,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,62,0,21,0,21,0,3,0,25,
+0,25,0,3,0,31,0,34,0,3,0,36,0,36,0,5,0,38,0,38,0,3,0,39,0,39,0,5,0,40,0,40,
+0,4,0,41,0,41,0,5,0,42,0,42,0,3,0,45,0,46,0,5,0,47,0,47,0,3,0,50,0,50,0,4,
+0,54,0,54,0,4,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,3,0,96,0,96,0,3,0,102,
+0,105,0,3,0,107,0,107,0,5,0,109,0,109,0,3,0,111,0,112,0,5,0,113,0,113,0,3,
+0,118,0,118,0,3,0,125,0,125,0,4,0,148,0,148,0,2,0,184,0,184,0,2,0,200,0,200,
+0,3,0,204,0,204,0,3,0,210,0,213,0,3,0,217,0,217,0,3,0,219,0,219,0,4,0,220,
+0,220,0,5,0,221,0,221,0,3,0,224,0,225,0,5,0,226,0,226,0,3,0,229,0,229,0,4,
+0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,0,3,0,246,0,249,0,3,0,253,0,253,
+0,3,0,255,1,0,0,5,1,1,1,1,0,3,1,6,1,6,0,3,1,13,1,13,0,3,1,32,1,32,0,2,1,68,
+1,68,0,2,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,3,1,106,
+1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,
+1,117,1,117,0,3,1,118,1,118,0,5,1,119,1,119,0,4,1,122,1,122,0,5,1,135,1,136,
+0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,
+0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,
+3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,
+0,0,0,1,0,8,0,2,0,26,0,32,0,9,0,0,1,146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+1,0,58,0,2,0,61,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,31,0,7,0,32,0,32,0,8,0,
+33,0,34,0,3,0,38,0,38,0,3,0,40,0,41,0,5,0,42,0,42,0,3,0,47,0,47,0,3,0,50,
+0,50,0,4,0,52,0,52,0,5,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,
+0,3,0,96,0,96,0,3,0,102,0,105,0,3,0,109,0,109,0,3,0,111,0,112,0,5,0,113,0,
+113,0,3,0,118,0,118,0,3,0,125,0,125,0,5,0,161,0,161,0,2,0,197,0,197,0,2,0,
+200,0,200,0,3,0,204,0,204,0,3,0,210,0,210,0,7,0,211,0,211,0,8,0,212,0,213,
+0,3,0,217,0,217,0,3,0,219,0,220,0,5,0,221,0,221,0,3,0,226,0,226,0,3,0,229,
+0,229,0,4,0,231,0,231,0,5,0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,0,3,
+0,246,0,249,0,3,0,253,0,253,0,3,0,255,1,0,0,5,1,1,1,1,0,3,1,6,1,6,0,3,1,13,
+1,13,0,3,1,45,1,45,0,2,1,81,1,81,0,2,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,
+0,3,1,103,1,103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,
+1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,1,118,1,118,0,5,1,119,1,119,0,4,
+1,122,1,122,0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,10,0,22,0,34,0,46,0,58,
+0,70,0,82,0,96,0,110,0,124,0,138,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,
+0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,3,0,1,0,2,0,7,0,0,0,69,0,3,0,1,0,2,0,
+8,0,0,0,70,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,
+0,1,0,2,0,6,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,7,0,0,0,69,0,4,0,1,0,2,0,6,0,8,
+0,0,0,70,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,118,0,0,0,0,0,0,0,0,0,0,
+0,1,0,1,0,58,0,2,0,57,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,34,0,3,0,37,0,37,
+0,5,0,38,0,38,0,3,0,40,0,41,0,5,0,42,0,42,0,3,0,46,0,46,0,5,0,47,0,47,0,3,
+0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,3,0,96,0,96,0,3,0,102,
+0,105,0,3,0,109,0,109,0,3,0,111,0,112,0,5,0,113,0,113,0,3,0,118,0,118,0,3,
+0,125,0,125,0,5,0,146,0,146,0,2,0,182,0,182,0,2,0,200,0,200,0,3,0,204,0,204,
+0,3,0,210,0,213,0,3,0,216,0,216,0,5,0,217,0,217,0,3,0,219,0,220,0,5,0,221,
+0,221,0,3,0,225,0,225,0,5,0,226,0,226,0,3,0,233,0,233,0,3,0,236,0,236,0,3,
+0,240,0,240,0,3,0,246,0,249,0,3,0,253,0,253,0,3,0,255,1,0,0,5,1,1,1,1,0,3,
+1,6,1,6,0,3,1,13,1,13,0,3,1,30,1,30,0,2,1,66,1,66,0,2,1,87,1,90,0,3,1,96,
+1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,
+110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,1,118,1,118,
+0,5,1,119,1,119,0,4,1,122,1,122,0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,
+14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,
+0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,
+6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,
+0,7,0,0,1,88,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,52,0,21,0,21,0,3,0,25,
+0,25,0,3,0,31,0,34,0,3,0,36,0,36,0,5,0,38,0,38,0,3,0,40,0,40,0,5,0,42,0,42,
+0,3,0,47,0,47,0,3,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,3,
+0,96,0,96,0,3,0,102,0,105,0,3,0,109,0,109,0,3,0,111,0,111,0,5,0,113,0,113,
+0,3,0,118,0,118,0,3,0,125,0,125,0,5,0,160,0,160,0,2,0,196,0,196,0,2,0,200,
+0,200,0,3,0,204,0,204,0,3,0,210,0,213,0,3,0,217,0,217,0,3,0,219,0,219,0,5,
+0,221,0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,
+0,3,0,246,0,249,0,3,0,253,0,253,0,3,0,255,0,255,0,5,1,1,1,1,0,3,1,6,1,6,0,
+3,1,13,1,13,0,3,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,3,
+1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,
+0,3,1,117,1,117,0,3,1,118,1,118,0,5,1,119,1,119,0,4,1,122,1,122,0,5,1,135,
+1,136,0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,
+3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,
+0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,
+0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,178,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,
+58,0,2,0,67,0,21,0,21,0,3,0,24,0,24,0,5,0,25,0,25,0,3,0,31,0,31,0,3,0,32,
+0,32,0,4,0,33,0,34,0,3,0,38,0,38,0,3,0,40,0,40,0,5,0,42,0,42,0,3,0,46,0,46,
+0,5,0,47,0,47,0,3,0,50,0,50,0,5,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,6,
+0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,102,0,3,0,103,0,103,0,4,0,104,0,105,0,
+3,0,109,0,109,0,3,0,111,0,111,0,5,0,113,0,113,0,3,0,118,0,118,0,3,0,125,0,
+125,0,5,0,133,0,133,0,2,0,169,0,169,0,2,0,200,0,200,0,3,0,203,0,203,0,5,0,
+204,0,204,0,3,0,210,0,210,0,3,0,211,0,211,0,4,0,212,0,213,0,3,0,217,0,217,
+0,3,0,219,0,219,0,5,0,221,0,221,0,3,0,225,0,225,0,5,0,226,0,226,0,3,0,229,
+0,229,0,5,0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,0,3,0,246,0,246,0,3,
+0,247,0,247,0,4,0,248,0,249,0,3,0,253,0,253,0,3,0,255,0,255,0,5,1,1,1,1,0,
+3,1,6,1,6,0,3,1,13,1,13,0,3,1,17,1,17,0,2,1,53,1,53,0,2,1,87,1,90,0,3,1,96,
+1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,
+110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,1,118,1,118,
+0,5,1,119,1,119,0,4,1,122,1,122,0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,
+14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,
+0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,
+6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,
+0,7,0,0,1,136,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,60,0,21,0,21,0,3,0,25,
+0,25,0,3,0,31,0,31,0,3,0,32,0,32,0,4,0,33,0,34,0,3,0,38,0,38,0,3,0,40,0,40,
+0,5,0,42,0,42,0,3,0,47,0,47,0,3,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,6,
+0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,102,0,3,0,103,0,103,0,4,0,104,0,105,0,
+3,0,109,0,109,0,3,0,111,0,111,0,5,0,113,0,113,0,3,0,118,0,118,0,3,0,125,0,
+125,0,5,0,156,0,156,0,2,0,192,0,192,0,2,0,200,0,200,0,3,0,204,0,204,0,3,0,
+210,0,210,0,3,0,211,0,211,0,4,0,212,0,213,0,3,0,217,0,217,0,3,0,219,0,219,
+0,5,0,221,0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,3,0,240,
+0,240,0,3,0,246,0,246,0,3,0,247,0,247,0,4,0,248,0,249,0,3,0,253,0,253,0,3,
+0,255,0,255,0,5,1,1,1,1,0,3,1,6,1,6,0,3,1,13,1,13,0,4,1,40,1,40,0,2,1,76,
+1,76,0,2,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,
+1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,
+1,117,1,117,0,3,1,119,1,119,0,4,1,122,1,122,0,5,1,135,1,136,0,4,1,139,1,140,
+0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,
+2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,
+0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,
+0,22,0,28,0,7,0,0,1,136,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,60,0,21,0,
+21,0,3,0,25,0,25,0,3,0,31,0,31,0,3,0,32,0,32,0,4,0,33,0,34,0,3,0,38,0,38,
+0,3,0,40,0,40,0,5,0,42,0,42,0,3,0,47,0,47,0,3,0,54,0,54,0,5,0,58,0,58,0,1,
+0,90,0,90,0,6,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,102,0,3,0,103,0,103,0,4,
+0,104,0,105,0,3,0,109,0,109,0,3,0,111,0,111,0,5,0,113,0,113,0,3,0,118,0,118,
+0,3,0,125,0,125,0,5,0,140,0,140,0,2,0,176,0,176,0,2,0,200,0,200,0,3,0,204,
+0,204,0,3,0,210,0,210,0,3,0,211,0,211,0,4,0,212,0,213,0,3,0,217,0,217,0,4,
+0,219,0,219,0,5,0,221,0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,
+0,3,0,240,0,240,0,3,0,246,0,246,0,3,0,247,0,247,0,4,0,248,0,249,0,3,0,253,
+0,253,0,4,0,255,0,255,0,5,1,1,1,1,0,3,1,6,1,6,0,3,1,13,1,13,0,4,1,24,1,24,
+0,2,1,60,1,60,0,2,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,
+4,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,4,1,115,1,
+115,0,3,1,117,1,117,0,4,1,119,1,119,0,4,1,122,1,122,0,5,1,135,1,136,0,4,1,
+139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,
+0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,
+0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,
+1,0,8,0,2,0,22,0,28,0,7,0,0,1,124,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,
+58,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,31,0,3,0,32,0,32,0,4,0,33,0,34,0,3,
+0,38,0,38,0,3,0,40,0,40,0,5,0,42,0,42,0,3,0,47,0,47,0,3,0,54,0,54,0,5,0,58,
+0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,102,0,3,0,103,
+0,103,0,4,0,104,0,105,0,3,0,109,0,109,0,3,0,111,0,111,0,5,0,113,0,113,0,3,
+0,118,0,118,0,3,0,125,0,125,0,5,0,200,0,200,0,4,0,204,0,204,0,3,0,210,0,210,
+0,3,0,211,0,211,0,4,0,212,0,213,0,3,0,217,0,217,0,4,0,219,0,219,0,5,0,221,
+0,221,0,4,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,3,
+0,246,0,246,0,3,0,247,0,247,0,4,0,248,0,249,0,3,0,253,0,253,0,4,0,255,0,255,
+0,5,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,16,1,16,0,2,1,52,1,52,0,2,1,87,
+1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,3,1,108,
+1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,
+1,119,1,119,0,5,1,122,1,122,0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,14,
+0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,
+0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,
+0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,
+0,1,118,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,57,0,21,0,21,0,3,0,25,0,25,
+0,4,0,31,0,31,0,3,0,32,0,32,0,4,0,33,0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,
+0,47,0,47,0,3,0,50,0,50,0,5,0,54,0,54,0,4,0,58,0,58,0,1,0,90,0,90,0,6,0,92,
+0,92,0,3,0,96,0,96,0,4,0,102,0,102,0,3,0,103,0,104,0,4,0,105,0,105,0,3,0,
+109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,125,0,125,0,5,0,157,0,157,
+0,2,0,193,0,193,0,2,0,200,0,200,0,3,0,204,0,204,0,4,0,210,0,210,0,3,0,211,
+0,211,0,4,0,212,0,213,0,3,0,217,0,217,0,4,0,221,0,221,0,3,0,226,0,226,0,3,
+0,229,0,229,0,5,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,
+0,3,0,247,0,248,0,4,0,249,0,249,0,3,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,
+3,1,13,1,13,0,4,1,41,1,41,0,2,1,77,1,77,0,2,1,87,1,90,0,4,1,96,1,96,0,3,1,
+99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,
+4,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,119,1,119,0,5,1,135,1,
+136,0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,
+0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,
+6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,
+0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,88,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,
+58,0,2,0,52,0,21,0,21,0,3,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,33,0,4,0,34,
+0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,0,54,0,54,0,5,0,58,0,58,
+0,1,0,90,0,90,0,6,0,92,0,92,0,3,0,96,0,96,0,4,0,102,0,102,0,3,0,103,0,104,
+0,4,0,105,0,105,0,3,0,109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,125,
+0,125,0,5,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,0,3,0,211,0,212,0,4,
+0,213,0,213,0,3,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,0,233,
+0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,3,0,247,0,248,0,4,0,249,
+0,249,0,3,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,87,1,90,
+0,4,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,
+0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,119,
+1,119,0,5,1,135,1,136,0,4,1,139,1,140,0,4,1,141,1,141,0,2,0,6,0,14,0,26,0,
+38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,
+1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,
+72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,82,
+0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,51,0,21,0,21,0,4,0,25,0,25,0,4,0,31,
+0,31,0,3,0,32,0,34,0,4,0,38,0,38,0,3,0,41,0,41,0,5,0,42,0,42,0,4,0,47,0,47,
+0,3,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,4,0,96,0,96,0,4,
+0,102,0,102,0,3,0,103,0,105,0,4,0,109,0,109,0,3,0,113,0,113,0,4,0,118,0,118,
+0,3,0,125,0,125,0,5,0,147,0,147,0,2,0,183,0,183,0,2,0,200,0,200,0,4,0,204,
+0,204,0,4,0,210,0,210,0,3,0,211,0,213,0,4,0,217,0,217,0,4,0,220,0,220,0,5,
+0,221,0,221,0,4,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,
+0,4,0,246,0,246,0,3,0,247,0,249,0,4,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,
+3,1,13,1,13,0,4,1,87,1,90,0,4,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,
+1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,115,1,115,
+0,3,1,117,1,117,0,4,1,119,1,119,0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,
+14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,
+0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,
+6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,
+0,7,0,0,1,100,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,54,0,21,0,21,0,4,0,25,
+0,25,0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,36,0,36,0,5,0,38,0,38,0,3,0,42,0,42,
+0,4,0,46,0,46,0,5,0,47,0,47,0,3,0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,6,
+0,92,0,92,0,4,0,96,0,96,0,4,0,102,0,102,0,3,0,103,0,105,0,4,0,109,0,109,0,
+3,0,113,0,113,0,4,0,118,0,118,0,3,0,125,0,125,0,5,0,135,0,135,0,2,0,171,0,
+171,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,0,3,0,211,0,213,0,4,0,
+217,0,217,0,4,0,221,0,221,0,4,0,225,0,225,0,5,0,226,0,226,0,3,0,233,0,233,
+0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,3,0,247,0,249,0,4,0,253,
+0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,19,1,19,0,2,1,55,1,55,0,
+2,1,87,1,90,0,4,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,
+4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,
+117,0,4,1,119,1,119,0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,
+0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,
+0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,
+0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,70,0,
+0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,49,0,21,0,21,0,4,0,25,0,25,0,4,0,31,
+0,31,0,3,0,32,0,34,0,4,0,38,0,38,0,3,0,42,0,42,0,4,0,47,0,47,0,3,0,54,0,54,
+0,5,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,4,0,96,0,96,0,4,0,102,0,102,0,
+3,0,103,0,105,0,4,0,109,0,109,0,3,0,113,0,113,0,4,0,118,0,118,0,3,0,125,0,
+125,0,5,0,163,0,163,0,2,0,199,0,199,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,
+210,0,210,0,3,0,211,0,213,0,4,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,
+0,3,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,3,0,247,
+0,249,0,4,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,87,1,90,
+0,4,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,
+0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,119,
+1,119,0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,
+78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,
+0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,
+2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,82,0,0,0,0,0,0,
+0,0,0,0,0,1,0,1,0,58,0,2,0,51,0,21,0,21,0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,
+32,0,34,0,4,0,38,0,38,0,3,0,42,0,42,0,4,0,47,0,47,0,3,0,54,0,54,0,5,0,58,
+0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,4,0,96,0,96,0,4,0,102,0,102,0,3,0,103,
+0,105,0,4,0,109,0,109,0,3,0,113,0,113,0,4,0,118,0,118,0,3,0,125,0,125,0,5,
+0,142,0,142,0,2,0,178,0,178,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,
+0,3,0,211,0,213,0,4,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,
+0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,3,0,247,0,249,0,4,
+0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,26,1,26,0,2,1,62,
+1,62,0,2,1,87,1,90,0,4,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,
+1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,115,1,115,0,3,
+1,117,1,117,0,4,1,119,1,119,0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,14,
+0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,
+0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,
+0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,
+0,1,64,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,48,0,21,0,21,0,4,0,25,0,25,
+0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,38,0,38,0,3,0,42,0,42,0,4,0,47,0,47,0,3,
+0,54,0,54,0,5,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,4,0,96,0,96,0,4,0,102,
+0,102,0,3,0,103,0,105,0,4,0,109,0,109,0,3,0,113,0,113,0,4,0,118,0,118,0,3,
+0,125,0,125,0,5,0,165,0,165,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,
+0,3,0,211,0,213,0,4,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,
+0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,3,0,247,0,249,0,4,
+0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,87,1,90,0,4,1,96,
+1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,
+110,1,110,0,4,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,119,1,119,
+0,5,1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,
+0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,
+4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,
+5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,64,0,0,0,0,0,0,0,0,0,0,
+0,1,0,1,0,58,0,2,0,48,0,21,0,21,0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,34,
+0,4,0,38,0,38,0,3,0,42,0,42,0,4,0,47,0,47,0,3,0,54,0,54,0,5,0,58,0,58,0,1,
+0,90,0,90,0,6,0,92,0,92,0,4,0,96,0,96,0,4,0,102,0,102,0,3,0,103,0,105,0,4,
+0,109,0,109,0,3,0,113,0,113,0,4,0,118,0,118,0,3,0,125,0,125,0,5,0,164,0,164,
+0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,0,3,0,211,0,213,0,4,0,217,
+0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,4,
+0,240,0,240,0,4,0,246,0,246,0,3,0,247,0,249,0,4,0,253,0,253,0,4,1,1,1,1,0,
+4,1,6,1,6,0,3,1,13,1,13,0,4,1,87,1,90,0,4,1,96,1,96,0,3,1,99,1,99,0,3,1,103,
+1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,1,113,0,4,
+1,115,1,115,0,3,1,117,1,117,0,4,1,119,1,119,0,5,1,135,1,136,0,4,1,139,1,140,
+0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,0,71,0,3,0,1,0,
+2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,3,0,0,0,71,0,4,
+0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,0,0,0,1,0,8,0,2,
+0,22,0,28,0,7,0,0,1,58,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,47,0,21,0,21,
+0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,38,0,38,0,3,0,42,0,42,0,4,
+0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,4,0,96,0,96,0,4,0,102,
+0,102,0,3,0,103,0,105,0,4,0,109,0,109,0,3,0,113,0,113,0,4,0,118,0,118,0,3,
+0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,0,3,0,211,0,213,0,4,0,217,0,217,
+0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,4,0,240,
+0,240,0,4,0,246,0,246,0,3,0,247,0,249,0,4,0,253,0,253,0,4,1,1,1,1,0,4,1,6,
+1,6,0,3,1,13,1,13,0,4,1,31,1,31,0,2,1,67,1,67,0,2,1,87,1,90,0,4,1,96,1,96,
+0,4,1,99,1,99,0,4,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,
+110,0,4,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,119,1,119,0,5,1,
+135,1,136,0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,
+2,0,3,0,0,0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,
+0,2,0,6,0,3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,
+0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,70,0,0,0,0,0,0,0,0,0,0,0,1,0,
+1,0,58,0,2,0,49,0,21,0,21,0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,
+38,0,38,0,3,0,42,0,42,0,4,0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,6,0,92,
+0,92,0,4,0,96,0,96,0,4,0,102,0,102,0,3,0,103,0,105,0,4,0,109,0,109,0,3,0,
+113,0,113,0,4,0,118,0,118,0,3,0,134,0,134,0,2,0,170,0,170,0,2,0,200,0,200,
+0,4,0,204,0,204,0,4,0,210,0,210,0,3,0,211,0,213,0,4,0,217,0,217,0,4,0,221,
+0,221,0,4,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,
+0,246,0,246,0,3,0,247,0,249,0,4,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,
+13,1,13,0,4,1,18,1,18,0,2,1,54,1,54,0,2,1,87,1,90,0,4,1,96,1,96,0,4,1,99,
+1,99,0,4,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,
+1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,119,1,119,0,5,1,135,1,136,
+0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,
+0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,
+3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,
+0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,46,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,
+2,0,45,0,21,0,21,0,4,0,25,0,25,0,4,0,31,0,34,0,4,0,38,0,38,0,3,0,42,0,42,
+0,4,0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,4,0,96,0,96,0,4,
+0,102,0,105,0,4,0,109,0,109,0,3,0,113,0,113,0,4,0,118,0,118,0,3,0,139,0,139,
+0,2,0,175,0,175,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,213,0,4,0,217,
+0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,4,
+0,240,0,240,0,4,0,246,0,249,0,4,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,
+13,1,13,0,4,1,23,1,23,0,2,1,59,1,59,0,2,1,87,1,90,0,4,1,96,1,96,0,4,1,99,
+1,99,0,4,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,
+1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,119,1,119,0,5,1,135,1,136,
+0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,
+0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,
+3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,
+0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,46,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,
+2,0,45,0,21,0,21,0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,38,0,38,
+0,4,0,42,0,42,0,4,0,47,0,47,0,4,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,4,
+0,96,0,96,0,4,0,102,0,105,0,4,0,109,0,109,0,4,0,113,0,113,0,4,0,118,0,118,
+0,4,0,130,0,130,0,2,0,166,0,166,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,
+0,210,0,3,0,211,0,213,0,4,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,4,
+0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,249,0,4,0,253,0,253,
+0,4,1,1,1,1,0,4,1,6,1,6,0,4,1,13,1,13,0,4,1,87,1,90,0,4,1,96,1,96,0,4,1,99,
+1,99,0,4,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,
+1,113,1,113,0,4,1,115,1,115,0,4,1,117,1,117,0,4,1,119,1,119,0,5,1,135,1,136,
+0,5,1,139,1,140,0,5,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,
+0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,
+3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,
+0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,46,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,
+2,0,45,0,21,0,21,0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,38,0,38,
+0,4,0,42,0,42,0,4,0,47,0,47,0,4,0,58,0,58,0,1,0,90,0,90,0,6,0,92,0,92,0,4,
+0,96,0,96,0,4,0,102,0,105,0,4,0,109,0,109,0,4,0,113,0,113,0,4,0,118,0,118,
+0,4,0,151,0,151,0,2,0,187,0,187,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,
+0,210,0,3,0,211,0,213,0,4,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,4,
+0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,249,0,4,0,253,0,253,
+0,4,1,1,1,1,0,4,1,6,1,6,0,4,1,13,1,13,0,4,1,87,1,90,0,4,1,96,1,96,0,4,1,99,
+1,99,0,4,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,
+1,113,1,113,0,4,1,115,1,115,0,4,1,117,1,117,0,4,1,119,1,119,0,5,1,135,1,136,
+0,5,1,139,1,140,0,5,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,0,2,0,3,0,0,
+0,71,0,3,0,1,0,2,0,4,0,0,0,72,0,3,0,1,0,2,0,5,0,0,0,73,0,4,0,1,0,2,0,6,0,
+3,0,0,0,71,0,4,0,1,0,2,0,6,0,4,0,0,0,72,0,4,0,1,0,2,0,6,0,5,0,0,0,73,0,5,
+0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,1,38,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,
+44,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,
+0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,5,0,92,0,92,0,3,0,96,0,96,0,3,0,102,
+0,105,0,3,0,109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,143,0,143,0,2,
+0,179,0,179,0,2,0,200,0,200,0,3,0,204,0,204,0,3,0,210,0,213,0,3,0,217,0,217,
+0,3,0,221,0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,3,0,236,0,236,0,3,0,240,
+0,240,0,3,0,246,0,249,0,3,0,253,0,253,0,3,1,1,1,1,0,3,1,6,1,6,0,3,1,13,1,
+13,0,3,1,27,1,27,0,2,1,63,1,63,0,2,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,
+0,3,1,103,1,103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,
+1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,1,135,1,136,0,4,1,139,1,140,0,4,
+0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,
+0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,5,0,0,0,1,0,8,
+0,2,0,20,0,26,0,6,0,0,1,38,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,44,0,21,0,21,
+0,3,0,25,0,25,0,3,0,31,0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,
+0,58,0,58,0,1,0,90,0,90,0,5,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,105,0,3,0,
+109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,141,0,141,0,2,0,177,0,177,
+0,2,0,200,0,200,0,3,0,204,0,204,0,3,0,210,0,213,0,3,0,217,0,217,0,3,0,221,
+0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,0,3,
+0,246,0,249,0,3,0,253,0,253,0,3,1,1,1,1,0,3,1,6,1,6,0,3,1,13,1,13,0,3,1,25,
+1,25,0,2,1,61,1,61,0,2,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,
+103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,1,
+115,1,115,0,3,1,117,1,117,0,3,1,135,1,136,0,4,1,139,1,140,0,4,0,4,0,10,0,
+22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,0,4,0,1,0,
+2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,20,
+0,26,0,6,0,0,1,26,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,42,0,21,0,21,0,3,0,25,
+0,25,0,3,0,31,0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,0,58,0,58,
+0,1,0,90,0,90,0,5,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,105,0,3,0,109,0,109,
+0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,200,0,200,0,3,0,204,0,204,0,3,0,210,
+0,213,0,3,0,217,0,217,0,3,0,221,0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,3,
+0,236,0,236,0,3,0,240,0,240,0,3,0,246,0,249,0,3,0,253,0,253,0,3,1,1,1,1,0,
+3,1,6,1,6,0,3,1,13,1,13,0,3,1,44,1,44,0,2,1,80,1,80,0,2,1,87,1,90,0,3,1,96,
+1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,
+110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,1,135,1,136,
+0,4,1,139,1,140,0,4,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,
+0,1,0,2,0,4,0,0,0,73,0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,
+0,73,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,1,20,0,0,0,0,0,0,0,0,0,1,0,1,0,
+58,0,2,0,41,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,34,0,3,0,38,0,38,0,3,0,42,
+0,42,0,3,0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,5,0,92,0,92,0,3,0,96,0,96,
+0,3,0,102,0,105,0,3,0,109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,200,
+0,200,0,3,0,204,0,204,0,3,0,210,0,213,0,3,0,217,0,217,0,3,0,221,0,221,0,3,
+0,226,0,226,0,3,0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,0,3,0,246,0,249,
+0,3,0,253,0,253,0,3,1,1,1,1,0,3,1,6,1,6,0,3,1,13,1,13,0,3,1,49,1,49,0,2,1,
+87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,3,1,106,1,106,0,3,1,
+108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,1,117,1,117,
+0,3,1,135,1,136,0,4,1,139,1,140,0,4,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,
+3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,
+0,2,0,5,0,4,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,1,26,0,0,0,0,0,
+0,0,0,0,1,0,1,0,58,0,2,0,42,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,34,0,3,0,38,
+0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,5,0,92,0,92,
+0,3,0,96,0,96,0,3,0,102,0,105,0,3,0,109,0,109,0,3,0,113,0,113,0,3,0,118,0,
+118,0,3,0,200,0,200,0,3,0,204,0,204,0,3,0,210,0,213,0,3,0,217,0,217,0,3,0,
+221,0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,3,0,236,0,236,0,3,0,240,0,240,
+0,3,0,246,0,249,0,3,0,253,0,253,0,3,1,1,1,1,0,3,1,6,1,6,0,3,1,13,1,13,0,3,
+1,14,1,14,0,2,1,50,1,50,0,2,1,87,1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,
+1,103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,
+1,115,1,115,0,3,1,117,1,117,0,3,1,135,1,136,0,4,1,139,1,140,0,4,0,4,0,10,
+0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,0,4,0,1,
+0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,20,
+0,26,0,6,0,0,1,26,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,42,0,21,0,21,0,3,0,25,
+0,25,0,3,0,31,0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,0,58,0,58,
+0,1,0,90,0,90,0,5,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,105,0,3,0,109,0,109,
+0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,200,0,200,0,3,0,204,0,204,0,3,0,210,
+0,213,0,3,0,217,0,217,0,3,0,221,0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,3,
+0,236,0,236,0,3,0,240,0,240,0,3,0,246,0,249,0,3,0,253,0,253,0,3,1,1,1,1,0,
+3,1,6,1,6,0,3,1,13,1,13,0,3,1,35,1,35,0,2,1,71,1,71,0,2,1,87,1,90,0,3,1,96,
+1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,3,1,106,1,106,0,3,1,108,1,108,0,3,1,
+110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,1,135,1,136,
+0,4,1,139,1,140,0,4,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,
+0,1,0,2,0,4,0,0,0,73,0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,
+0,73,0,5,0,0,0,1,0,8,0,2,0,22,0,28,0,7,0,0,1,76,0,0,0,0,0,0,0,0,0,0,0,1,0,
+1,0,58,0,2,0,50,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,31,0,6,0,32,0,32,0,4,0,
+33,0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,0,58,0,58,0,1,0,90,
+0,90,0,5,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,102,0,3,0,103,0,103,0,4,0,104,
+0,105,0,3,0,109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,162,0,162,0,2,
+0,198,0,198,0,2,0,200,0,200,0,3,0,204,0,204,0,3,0,210,0,210,0,6,0,211,0,211,
+0,4,0,212,0,213,0,3,0,217,0,217,0,3,0,221,0,221,0,3,0,226,0,226,0,3,0,233,
+0,233,0,4,0,236,0,236,0,3,0,240,0,240,0,3,0,246,0,246,0,3,0,247,0,247,0,4,
+0,248,0,249,0,3,0,253,0,253,0,3,1,1,1,1,0,3,1,6,1,6,0,3,1,13,1,13,0,4,1,87,
+1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,3,1,108,
+1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,
+1,135,1,136,0,4,1,139,1,140,0,4,0,6,0,14,0,26,0,38,0,50,0,64,0,78,0,3,0,1,
+0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,0,3,0,1,0,2,0,6,0,0,0,71,0,4,0,
+1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,4,0,1,0,2,0,5,0,6,0,
+0,0,71,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,1,74,0,0,0,0,0,0,0,0,0,1,0,1,
+0,58,0,2,0,50,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,31,0,3,0,32,0,32,0,4,0,33,
+0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,
+0,5,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,102,0,3,0,103,0,103,0,4,0,104,0,105,
+0,3,0,109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,200,0,200,0,3,0,204,
+0,204,0,3,0,210,0,210,0,3,0,211,0,211,0,4,0,212,0,213,0,3,0,217,0,217,0,3,
+0,221,0,221,0,3,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,3,0,240,0,240,
+0,3,0,246,0,246,0,3,0,247,0,247,0,4,0,248,0,249,0,3,0,253,0,253,0,3,1,1,1,
+1,0,3,1,6,1,6,0,3,1,13,1,13,0,4,1,46,1,46,0,2,1,82,1,82,0,2,1,87,1,90,0,3,
+1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,3,1,108,1,108,0,
+3,1,110,1,110,0,3,1,113,1,113,0,3,1,115,1,115,0,3,1,117,1,117,0,3,1,135,1,
+136,0,4,1,139,1,140,0,4,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,
+0,3,0,1,0,2,0,4,0,0,0,73,0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,
+0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,1,74,0,0,0,0,0,0,0,0,0,1,0,
+1,0,58,0,2,0,50,0,21,0,21,0,3,0,25,0,25,0,3,0,31,0,31,0,3,0,32,0,32,0,4,0,
+33,0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,0,58,0,58,0,1,0,90,
+0,90,0,5,0,92,0,92,0,3,0,96,0,96,0,3,0,102,0,102,0,3,0,103,0,103,0,4,0,104,
+0,105,0,3,0,109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,158,0,158,0,2,
+0,194,0,194,0,2,0,200,0,200,0,4,0,204,0,204,0,3,0,210,0,210,0,3,0,211,0,211,
+0,4,0,212,0,213,0,3,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,
+0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,3,0,246,0,246,0,3,0,247,0,247,0,4,
+0,248,0,249,0,3,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,87,
+1,90,0,3,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,3,1,108,
+1,108,0,3,1,110,1,110,0,3,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,
+1,135,1,136,0,4,1,139,1,140,0,4,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,
+0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,
+0,5,0,4,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,1,86,0,0,0,0,0,0,0,
+0,0,1,0,1,0,58,0,2,0,52,0,21,0,21,0,3,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,
+32,0,4,0,33,0,34,0,3,0,38,0,38,0,3,0,42,0,42,0,3,0,47,0,47,0,3,0,58,0,58,
+0,1,0,90,0,90,0,5,0,92,0,92,0,3,0,96,0,96,0,4,0,102,0,102,0,3,0,103,0,104,
+0,4,0,105,0,105,0,3,0,109,0,109,0,3,0,113,0,113,0,3,0,118,0,118,0,3,0,152,
+0,152,0,2,0,188,0,188,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,0,3,
+0,211,0,211,0,4,0,212,0,213,0,3,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,
+0,3,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,3,0,247,
+0,248,0,4,0,249,0,249,0,3,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,
+13,0,4,1,36,1,36,0,2,1,72,1,72,0,2,1,87,1,90,0,4,1,96,1,96,0,3,1,99,1,99,
+0,3,1,103,1,103,0,4,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,4,1,113,
+1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,135,1,136,0,4,1,139,1,140,0,4,
+0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,
+0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,5,0,0,0,1,0,8,
+0,2,0,20,0,26,0,6,0,0,1,74,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,50,0,21,0,21,
+0,3,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,33,0,4,0,34,0,34,0,3,0,38,0,38,0,3,
+0,42,0,42,0,3,0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,5,0,92,0,92,0,3,0,96,
+0,96,0,4,0,102,0,102,0,3,0,103,0,104,0,4,0,105,0,105,0,3,0,109,0,109,0,3,
+0,113,0,113,0,3,0,118,0,118,0,3,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,
+0,3,0,211,0,212,0,4,0,213,0,213,0,3,0,217,0,217,0,4,0,221,0,221,0,4,0,226,
+0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,3,
+0,247,0,248,0,4,0,249,0,249,0,3,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,
+13,1,13,0,4,1,42,1,42,0,2,1,78,1,78,0,2,1,87,1,90,0,4,1,96,1,96,0,3,1,99,
+1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,3,1,108,1,108,0,3,1,110,1,110,0,4,
+1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,135,1,136,0,4,1,139,1,140,
+0,4,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,
+0,73,0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,5,0,0,0,
+1,0,8,0,2,0,20,0,26,0,6,0,0,1,44,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,45,0,
+21,0,21,0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,38,0,38,0,3,0,42,
+0,42,0,4,0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,5,0,92,0,92,0,4,0,96,0,96,
+0,4,0,102,0,102,0,3,0,103,0,105,0,4,0,109,0,109,0,3,0,113,0,113,0,4,0,118,
+0,118,0,3,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,0,3,0,211,0,213,0,4,
+0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,0,233,0,4,0,236,0,236,
+0,4,0,240,0,240,0,4,0,246,0,246,0,3,0,247,0,249,0,4,0,253,0,253,0,4,1,1,1,
+1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,48,1,48,0,2,1,87,1,90,0,4,1,96,1,96,0,3,
+1,99,1,99,0,3,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,
+0,4,1,113,1,113,0,4,1,115,1,115,0,3,1,117,1,117,0,4,1,135,1,136,0,4,1,139,
+1,140,0,4,0,4,0,10,0,22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,
+4,0,0,0,73,0,4,0,1,0,2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,5,
+0,0,0,1,0,8,0,2,0,20,0,26,0,6,0,0,1,62,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,
+48,0,21,0,21,0,4,0,25,0,25,0,4,0,31,0,31,0,3,0,32,0,34,0,4,0,38,0,38,0,3,
+0,42,0,42,0,4,0,47,0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,5,0,92,0,92,0,4,0,96,
+0,96,0,4,0,102,0,102,0,3,0,103,0,105,0,4,0,109,0,109,0,3,0,113,0,113,0,4,
+0,118,0,118,0,3,0,131,0,131,0,2,0,167,0,167,0,2,0,200,0,200,0,4,0,204,0,204,
+0,4,0,210,0,210,0,3,0,211,0,213,0,4,0,217,0,217,0,4,0,221,0,221,0,4,0,226,
+0,226,0,3,0,233,0,233,0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,3,
+0,247,0,249,0,4,0,253,0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,15,
+1,15,0,2,1,51,1,51,0,2,1,87,1,90,0,4,1,96,1,96,0,3,1,99,1,99,0,3,1,103,1,
+103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,0,4,1,113,1,113,0,4,1,
+115,1,115,0,3,1,117,1,117,0,4,1,135,1,136,0,4,1,139,1,140,0,4,0,4,0,10,0,
+22,0,34,0,48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,0,4,0,1,0,
+2,0,5,0,3,0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,20,
+0,26,0,6,0,0,1,38,0,0,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,44,0,21,0,21,0,4,0,25,
+0,25,0,4,0,31,0,31,0,4,0,33,0,34,0,4,0,38,0,38,0,4,0,42,0,42,0,4,0,47,0,47,
+0,3,0,58,0,58,0,1,0,90,0,90,0,5,0,92,0,92,0,4,0,96,0,96,0,4,0,102,0,102,0,
+4,0,104,0,105,0,4,0,109,0,109,0,4,0,113,0,113,0,4,0,118,0,118,0,3,0,144,0,
+144,0,2,0,180,0,180,0,2,0,200,0,200,0,4,0,204,0,204,0,4,0,210,0,210,0,4,0,
+212,0,213,0,4,0,217,0,217,0,4,0,221,0,221,0,4,0,226,0,226,0,3,0,233,0,233,
+0,4,0,236,0,236,0,4,0,240,0,240,0,4,0,246,0,246,0,4,0,248,0,249,0,4,0,253,
+0,253,0,4,1,1,1,1,0,4,1,6,1,6,0,3,1,13,1,13,0,4,1,87,1,90,0,4,1,96,1,96,0,
+4,1,99,1,99,0,4,1,103,1,103,0,4,1,106,1,106,0,4,1,108,1,108,0,4,1,110,1,110,
+0,4,1,113,1,113,0,4,1,115,1,115,0,4,1,117,1,117,0,4,0,4,0,10,0,22,0,34,0,
+48,0,3,0,1,0,2,0,3,0,0,0,72,0,3,0,1,0,2,0,4,0,0,0,73,0,4,0,1,0,2,0,5,0,3,
+0,0,0,72,0,4,0,1,0,2,0,5,0,4,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,18,0,24,0,5,0,
+0,0,166,0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,23,0,31,0,31,0,3,0,38,0,38,0,3,0,47,
+0,47,0,3,0,58,0,58,0,1,0,90,0,90,0,4,0,102,0,102,0,3,0,109,0,109,0,3,0,118,
+0,118,0,3,0,153,0,153,0,2,0,189,0,189,0,2,0,210,0,210,0,3,0,226,0,226,0,3,
+0,246,0,246,0,3,1,6,1,6,0,3,1,28,1,28,0,2,1,37,1,37,0,2,1,47,1,47,0,2,1,64,
+1,64,0,2,1,73,1,73,0,2,1,83,1,83,0,2,1,96,1,96,0,3,1,99,1,99,0,3,1,115,1,
+115,0,3,0,2,0,6,0,18,0,3,0,1,0,2,0,3,0,0,0,73,0,4,0,1,0,2,0,4,0,3,0,0,0,73,
+0,5,0,0,0,1,0,8,0,2,0,18,0,24,0,5,0,0,0,154,0,0,0,0,0,0,0,1,0,1,0,58,0,2,
+0,21,0,31,0,31,0,3,0,33,0,33,0,3,0,38,0,38,0,3,0,47,0,47,0,3,0,58,0,58,0,
+1,0,90,0,90,0,4,0,102,0,102,0,3,0,109,0,109,0,3,0,118,0,118,0,3,0,138,0,138,
+0,2,0,174,0,174,0,2,0,210,0,210,0,3,0,212,0,212,0,3,0,226,0,226,0,3,0,246,
+0,246,0,3,1,6,1,6,0,3,1,22,1,22,0,2,1,58,1,58,0,2,1,96,1,96,0,3,1,99,1,99,
+0,3,1,115,1,115,0,3,0,2,0,6,0,18,0,3,0,1,0,2,0,3,0,0,0,73,0,4,0,1,0,2,0,4,
+0,3,0,0,0,73,0,5,0,0,0,1,0,8,0,2,0,26,0,32,0,9,0,0,3,108,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,1,0,58,0,2,0,140,0,21,0,21,0,2,0,22,0,22,0,5,0,23,0,24,
+0,4,0,25,0,25,0,2,0,26,0,27,0,4,0,28,0,28,0,6,0,29,0,29,0,4,0,30,0,30,0,5,
+0,31,0,34,0,2,0,35,0,35,0,6,0,36,0,37,0,4,0,38,0,38,0,2,0,39,0,39,0,4,0,40,
+0,41,0,3,0,42,0,42,0,2,0,43,0,43,0,5,0,44,0,44,0,6,0,45,0,46,0,4,0,47,0,47,
+0,2,0,48,0,48,0,4,0,49,0,49,0,5,0,50,0,50,0,4,0,51,0,51,0,5,0,52,0,52,0,4,
+0,53,0,53,0,5,0,54,0,54,0,3,0,58,0,58,0,1,0,92,0,92,0,2,0,93,0,93,0,5,0,94,
+0,95,0,4,0,96,0,96,0,2,0,97,0,98,0,4,0,99,0,99,0,6,0,100,0,100,0,4,0,101,
+0,101,0,5,0,102,0,105,0,2,0,106,0,106,0,6,0,107,0,108,0,4,0,109,0,109,0,2,
+0,110,0,110,0,4,0,111,0,112,0,3,0,113,0,113,0,2,0,114,0,114,0,5,0,115,0,115,
+0,6,0,116,0,117,0,4,0,118,0,118,0,2,0,119,0,119,0,4,0,120,0,120,0,5,0,121,
+0,121,0,4,0,122,0,122,0,5,0,123,0,123,0,4,0,124,0,124,0,5,0,125,0,125,0,3,
+0,126,0,127,0,5,0,200,0,200,0,2,0,201,0,201,0,5,0,202,0,203,0,4,0,204,0,204,
+0,2,0,205,0,206,0,4,0,207,0,207,0,6,0,208,0,208,0,4,0,209,0,209,0,5,0,210,
+0,213,0,2,0,214,0,214,0,6,0,215,0,216,0,4,0,217,0,217,0,2,0,218,0,218,0,4,
+0,219,0,220,0,3,0,221,0,221,0,2,0,222,0,222,0,5,0,223,0,223,0,6,0,224,0,225,
+0,4,0,226,0,226,0,2,0,227,0,227,0,4,0,228,0,228,0,5,0,229,0,229,0,4,0,230,
+0,230,0,5,0,231,0,231,0,4,0,232,0,232,0,5,0,233,0,233,0,2,0,234,0,234,0,6,
+0,235,0,235,0,5,0,236,0,236,0,2,0,237,0,237,0,5,0,238,0,239,0,4,0,240,0,240,
+0,2,0,241,0,242,0,4,0,243,0,243,0,6,0,244,0,244,0,4,0,245,0,245,0,5,0,246,
+0,249,0,2,0,250,0,250,0,6,0,251,0,252,0,4,0,253,0,253,0,2,0,254,0,254,0,4,
+0,255,1,0,0,3,1,1,1,1,0,2,1,2,1,2,0,5,1,3,1,3,0,6,1,4,1,5,0,4,1,6,1,6,0,2,
+1,7,1,7,0,4,1,8,1,8,0,5,1,9,1,9,0,4,1,10,1,10,0,5,1,11,1,11,0,4,1,12,1,12,
+0,5,1,13,1,13,0,2,1,84,1,84,0,6,1,86,1,86,0,5,1,87,1,90,0,2,1,93,1,93,0,4,
+1,94,1,95,0,6,1,96,1,96,0,2,1,99,1,99,0,2,1,101,1,102,0,8,1,103,1,103,0,2,
+1,106,1,106,0,2,1,108,1,108,0,2,1,109,1,109,0,8,1,110,1,110,0,2,1,112,1,112,
+0,5,1,113,1,113,0,2,1,114,1,114,0,4,1,115,1,115,0,2,1,116,1,116,0,4,1,117,
+1,117,0,2,1,118,1,119,0,3,1,120,1,120,0,5,1,121,1,121,0,4,1,122,1,122,0,3,
+1,123,1,123,0,4,1,126,1,126,0,7,1,127,1,127,0,5,1,129,1,129,0,7,1,130,1,131,
+0,4,1,132,1,133,0,5,1,135,1,136,0,2,1,137,1,138,0,6,1,139,1,140,0,2,0,7,0,
+16,0,26,0,36,0,46,0,56,0,66,0,76,0,2,0,1,0,2,0,0,0,67,0,2,0,1,0,3,0,0,0,68,
+0,2,0,1,0,4,0,0,0,69,0,2,0,1,0,5,0,0,0,70,0,2,0,1,0,6,0,0,0,71,0,2,0,1,0,
+7,0,0,0,72,0,2,0,1,0,8,0,0,0,73,0,1,0,0,0,1,0,8,0,1,0,6,2,46,0,1,0,1,0,58,
+0,1,0,0,0,1,0,8,0,1,0,6,2,47,0,1,0,1,0,58,0,1,0,0,0,1,0,8,0,1,0,6,2,48,0,
+1,0,1,0,58,0,1,0,0,0,1,0,8,0,1,0,6,2,49,0,1,0,1,0,58,0,1,0,0,0,1,0,8,0,1,
+0,6,2,50,0,1,0,1,0,58,0,1,0,0,0,1,0,8,0,1,0,6,2,51,0,1,0,1,0,58,0,1,0,0,0,
+1,0,8,0,1,0,6,1,85,0,1,0,1,0,58,0,5,0,0,0,1,0,8,0,2,0,22,0,38,0,7,0,0,0,120,
+0,0,0,0,0,0,0,0,0,0,0,2,0,2,1,143,1,143,0,0,2,104,2,109,0,1,0,2,0,13,0,5,
+0,5,0,2,0,90,0,90,0,6,0,128,0,128,0,3,0,130,0,135,0,5,0,138,0,171,0,5,0,174,
+0,199,0,5,1,14,1,19,0,5,1,22,1,55,0,5,1,58,1,83,0,5,1,141,1,142,0,5,1,143,
+1,143,0,1,1,168,1,168,0,4,2,104,2,109,0,1,0,9,0,20,0,36,0,52,0,68,0,86,0,
+104,0,122,0,142,0,162,0,3,0,2,0,0,0,2,0,0,0,75,0,2,0,78,0,3,0,2,0,0,0,3,0,
+0,0,76,0,2,0,78,0,3,0,2,0,0,0,4,0,0,0,77,0,2,0,78,0,4,0,2,0,5,0,0,0,2,0,0,
+0,75,0,3,0,78,0,4,0,2,0,5,0,0,0,3,0,0,0,76,0,3,0,78,0,4,0,2,0,5,0,0,0,4,0,
+0,0,77,0,3,0,78,0,5,0,2,0,5,0,6,0,0,0,2,0,0,0,75,0,4,0,78,0,5,0,2,0,5,0,6,
+0,0,0,3,0,0,0,76,0,4,0,78,0,5,0,2,0,5,0,6,0,0,0,4,0,0,0,77,0,4,0,78,0,1,0,
+0,0,1,0,8,0,2,0,20,0,7,1,144,2,110,2,111,2,112,2,113,2,114,2,115,0,2,0,2,
+1,143,1,143,0,0,2,104,2,109,0,1,0,1,0,0,0,1,0,8,0,2,0,20,0,7,1,145,2,116,
+2,117,2,118,2,119,2,120,2,121,0,2,0,2,1,143,1,143,0,0,2,104,2,109,0,1,0,1,
+0,0,0,1,0,8,0,2,0,20,0,7,1,146,2,122,2,123,2,124,2,125,2,126,2,127,0,2,0,
+2,1,143,1,143,0,0,2,104,2,109,0,1,0,1,0,0,0,1,0,8,0,2,0,14,0,4,2,128,2,128,
+2,128,2,128,0,1,0,4,0,4,0,5,0,128,1,168,0,5,0,0,0,1,0,8,0,2,0,14,0,20,0,3,
+0,0,0,48,0,0,0,1,0,1,0,58,0,2,0,4,0,3,0,3,0,2,0,58,0,58,0,1,0,88,0,88,0,2,
+0,91,0,91,0,2,0,1,0,4,0,2,0,1,0,0,0,0,0,80,0,1,0,0,0,1,0,8,0,1,0,6,1,85,0,
+1,0,1,0,58,0,4,0,0,0,1,0,8,0,1,1,22,0,18,0,42,0,52,0,62,0,80,0,90,0,108,0,
+126,0,144,0,154,0,164,0,182,0,192,0,202,0,220,0,230,0,248,1,2,1,12,0,1,0,
+4,1,181,0,2,0,60,0,1,0,4,1,183,0,2,0,62,0,2,0,6,0,12,1,184,0,2,0,60,1,185,
+0,2,0,61,0,1,0,4,1,186,0,2,0,62,0,2,0,6,0,12,2,156,0,2,0,60,2,160,0,2,0,61,
+0,2,0,6,0,12,2,157,0,2,0,60,2,161,0,2,0,61,0,2,0,6,0,12,2,158,0,2,0,60,2,
+162,0,2,0,61,0,1,0,4,1,191,0,2,0,60,0,1,0,4,1,193,0,2,0,62,0,2,0,6,0,12,1,
+194,0,2,0,60,1,195,0,2,0,61,0,1,0,4,1,196,0,2,0,62,0,1,0,4,1,182,0,2,0,60,
+0,2,0,6,0,12,2,159,0,2,0,60,2,163,0,2,0,61,0,1,0,4,1,192,0,2,0,60,0,2,0,6,
+0,12,1,97,0,2,0,60,1,98,0,2,0,61,0,1,0,4,1,100,0,2,0,61,0,1,0,4,1,104,0,2,
+0,60,0,1,0,4,1,107,0,2,0,60,0,1,0,18,0,35,0,38,0,47,0,54,0,92,0,104,0,105,
+0,106,0,109,0,118,0,125,0,214,0,236,0,250,1,96,1,99,1,103,1,106,0,5,0,0,0,
+1,0,8,0,2,0,28,0,176,0,10,0,0,2,88,2,134,2,160,2,198,2,236,3,18,0,0,0,0,0,
+0,0,2,0,24,0,22,0,24,0,0,0,26,0,26,0,3,0,30,0,30,0,4,0,35,0,37,0,5,0,39,0,
+46,0,8,0,48,0,53,0,16,0,93,0,95,0,22,0,97,0,97,0,25,0,101,0,101,0,26,0,106,
+0,108,0,27,0,110,0,117,0,30,0,119,0,124,0,38,0,126,0,127,0,44,0,201,0,207,
+0,46,0,209,0,235,0,53,0,237,0,243,0,80,0,245,1,13,0,87,1,85,1,96,0,112,1,
+99,1,99,0,124,1,101,1,103,0,125,1,105,1,106,0,128,1,108,1,129,0,130,1,131,
+1,131,0,152,1,133,1,140,0,153,0,2,0,70,0,22,0,24,0,2,0,26,0,26,0,2,0,30,0,
+30,0,2,0,35,0,37,0,2,0,39,0,41,0,2,0,42,0,42,0,1,0,43,0,46,0,2,0,48,0,53,
+0,2,0,60,0,62,0,7,0,63,0,63,0,8,0,70,0,70,0,9,0,74,0,75,0,8,0,93,0,95,0,2,
+0,97,0,97,0,2,0,101,0,101,0,2,0,106,0,108,0,2,0,110,0,112,0,2,0,113,0,113,
+0,1,0,114,0,117,0,2,0,119,0,124,0,2,0,126,0,127,0,2,0,201,0,203,0,2,0,204,
+0,204,0,6,0,205,0,205,0,2,0,206,0,207,0,6,0,209,0,209,0,2,0,210,0,213,0,6,
+0,214,0,216,0,2,0,217,0,217,0,4,0,218,0,220,0,2,0,221,0,221,0,1,0,222,0,225,
+0,2,0,226,0,226,0,6,0,227,0,235,0,2,0,237,0,239,0,2,0,240,0,240,0,6,0,241,
+0,241,0,2,0,242,0,243,0,6,0,245,0,245,0,2,0,246,0,249,0,6,0,250,0,252,0,2,
+0,253,0,253,0,4,0,254,1,0,0,2,1,1,1,1,0,1,1,2,1,5,0,2,1,6,1,6,0,6,1,7,1,13,
+0,2,1,85,1,86,0,2,1,87,1,90,0,3,1,91,1,92,0,2,1,93,1,93,0,3,1,94,1,95,0,2,
+1,96,1,96,0,3,1,99,1,99,0,3,1,101,1,102,0,2,1,103,1,103,0,3,1,105,1,105,0,
+2,1,106,1,106,0,3,1,108,1,108,0,3,1,109,1,109,0,2,1,110,1,110,0,3,1,111,1,
+112,0,2,1,113,1,117,0,4,1,118,1,119,0,5,1,120,1,121,0,2,1,122,1,122,0,5,1,
+123,1,129,0,2,1,131,1,131,0,6,1,133,1,133,0,6,1,134,1,140,0,2,0,3,0,8,0,22,
+0,32,0,2,0,2,0,7,0,0,0,85,0,1,0,84,0,2,0,1,0,8,0,0,0,83,0,2,0,2,0,9,0,0,0,
+85,0,1,0,84,0,2,0,6,0,16,0,2,0,1,0,7,0,0,0,85,0,2,0,1,0,8,0,0,0,85,0,3,0,
+8,0,18,0,28,0,2,0,1,0,7,0,0,0,86,0,2,0,1,0,8,0,0,0,86,0,2,0,1,0,9,0,0,0,87,
+0,3,0,8,0,18,0,28,0,2,0,1,0,7,0,1,0,84,0,2,0,1,0,8,0,0,0,83,0,2,0,1,0,9,0,
+1,0,84,0,3,0,8,0,18,0,28,0,2,0,1,0,7,0,1,0,84,0,2,0,1,0,8,0,0,0,86,0,2,0,
+1,0,9,0,1,0,84,0,3,0,8,0,18,0,28,0,2,0,1,0,7,0,0,0,86,0,2,0,1,0,8,0,0,0,88,
+0,2,0,1,0,9,0,0,0,87,0,1,0,0,0,1,0,8,0,2,0,28,0,11,2,74,2,85,2,73,2,75,2,
+84,2,86,2,68,2,69,2,70,2,71,2,72,0,1,0,11,0,42,0,113,0,217,0,221,0,253,1,
+1,1,113,1,114,1,115,1,116,1,117,0,1,0,0,0,1,0,8,0,2,0,14,0,4,2,99,2,100,2,
+101,2,102,0,1,0,4,0,60,0,61,0,62,0,70,0,1,0,0,0,1,0,8,0,2,0,250,0,122,1,199,
+1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,187,1,210,1,
+211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,222,1,223,1,224,1,225,
+1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,197,1,233,1,234,1,235,1,236,1,
+237,1,238,1,239,1,240,1,241,1,242,1,220,1,221,1,243,1,244,1,245,1,246,1,247,
+1,248,1,249,1,250,1,251,1,252,1,253,1,188,1,254,1,255,2,0,2,1,2,2,2,3,2,4,
+2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,
+2,21,1,198,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,
+34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,
+2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,0,2,0,35,0,22,
+0,24,0,0,0,26,0,26,0,3,0,30,0,30,0,4,0,35,0,37,0,5,0,39,0,46,0,8,0,48,0,53,
+0,16,0,93,0,95,0,22,0,97,0,97,0,25,0,101,0,101,0,26,0,106,0,108,0,27,0,110,
+0,117,0,30,0,119,0,124,0,38,0,126,0,127,0,44,0,201,0,203,0,46,0,205,0,205,
+0,49,0,209,0,209,0,50,0,214,0,216,0,51,0,218,0,225,0,54,0,227,0,235,0,62,
+0,237,0,239,0,71,0,241,0,241,0,74,0,245,0,245,0,75,0,250,0,252,0,76,0,254,
+1,5,0,79,1,7,1,13,0,87,1,85,1,86,0,94,1,91,1,92,0,96,1,94,1,95,0,98,1,101,
+1,102,0,100,1,105,1,105,0,102,1,109,1,109,0,103,1,111,1,112,0,104,1,120,1,
+121,0,106,1,123,1,129,0,108,1,134,1,140,0,115,0,2,0,0,0,1,0,8,0,1,1,26,0,
+32,0,70,0,76,0,82,0,88,0,94,0,100,0,106,0,112,0,118,0,126,0,134,0,142,0,150,
+0,158,0,166,0,174,0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,
+236,0,242,0,248,0,254,1,4,1,10,1,18,0,2,0,25,0,129,0,2,0,27,0,129,0,2,0,28,
+0,129,0,2,0,31,0,129,0,2,0,32,0,129,0,2,0,33,0,129,0,2,0,34,0,129,0,2,0,47,
+0,129,0,3,0,25,0,55,0,129,0,3,0,27,0,55,0,129,0,3,0,28,0,55,0,129,0,3,0,31,
+0,55,0,129,0,3,0,32,0,55,0,129,0,3,0,33,0,55,0,129,0,3,0,34,0,55,0,129,0,
+3,0,47,0,55,0,129,0,2,0,134,0,21,0,2,0,134,1,200,0,2,0,134,1,201,0,2,0,134,
+1,212,0,2,0,136,1,216,0,2,0,140,0,31,0,2,0,140,0,32,0,2,0,141,0,32,0,2,0,
+142,0,33,0,2,0,142,0,34,0,2,0,143,0,34,0,2,0,147,1,210,0,2,0,147,1,211,0,
+2,0,147,1,216,0,3,0,161,0,31,0,129,0,3,0,161,0,32,0,129,0,1,0,32,0,204,0,
+206,0,207,0,210,0,211,0,212,0,213,0,226,0,240,0,242,0,243,0,246,0,247,0,248,
+0,249,1,6,1,87,1,88,1,89,1,90,1,93,1,96,1,99,1,103,1,106,1,108,1,110,1,118,
+1,119,1,122,1,131,1,133,0,2,0,0,0,1,0,8,0,1,1,26,0,32,0,70,0,76,0,82,0,88,
+0,94,0,100,0,106,0,112,0,118,0,126,0,134,0,142,0,150,0,158,0,166,0,174,0,
+182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,254,
+1,4,1,10,1,18,0,2,0,25,0,129,0,2,0,27,0,129,0,2,0,28,0,129,0,2,0,31,0,129,
+0,2,0,32,0,129,0,2,0,33,0,129,0,2,0,34,0,129,0,2,0,47,0,129,0,3,0,25,0,55,
+0,129,0,3,0,27,0,55,0,129,0,3,0,28,0,55,0,129,0,3,0,31,0,55,0,129,0,3,0,32,
+0,55,0,129,0,3,0,33,0,55,0,129,0,3,0,34,0,55,0,129,0,3,0,47,0,55,0,129,0,
+2,0,134,0,21,0,2,0,134,0,23,0,2,0,134,0,24,0,2,0,134,0,45,0,2,0,136,0,50,
+0,2,0,140,0,31,0,2,0,140,0,32,0,2,0,141,0,32,0,2,0,142,0,33,0,2,0,142,0,34,
+0,2,0,143,0,34,0,2,0,147,0,43,0,2,0,147,0,44,0,2,0,147,0,50,0,3,0,161,0,31,
+0,129,0,3,0,161,0,32,0,129,0,1,0,32,0,204,0,206,0,207,0,210,0,211,0,212,0,
+213,0,226,0,240,0,242,0,243,0,246,0,247,0,248,0,249,1,6,1,87,1,88,1,89,1,
+90,1,93,1,96,1,99,1,103,1,106,1,108,1,110,1,118,1,119,1,122,1,131,1,133,0,
+2,0,0,0,1,0,8,0,1,0,154,0,18,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,84,0,90,
+0,96,0,102,0,108,0,114,0,120,0,126,0,132,0,138,0,146,0,2,2,61,0,129,0,2,2,
+62,0,129,0,2,2,63,0,129,0,2,2,64,0,129,0,2,2,65,0,129,0,2,2,66,0,129,0,2,
+2,67,0,129,0,2,2,76,0,129,0,2,2,77,0,129,0,2,2,78,0,129,0,2,2,79,0,129,0,
+2,2,80,0,129,0,2,2,81,0,129,0,2,2,82,0,129,0,2,2,83,0,129,0,2,2,87,0,129,
+0,3,0,161,2,64,0,129,0,3,0,161,2,65,0,129,0,1,0,18,0,204,0,206,0,207,0,210,
+0,211,0,212,0,213,0,226,0,240,0,242,0,243,0,246,0,247,0,248,0,249,1,6,1,131,
+1,133,0,5,0,0,0,1,0,8,0,2,0,14,0,54,0,3,0,0,0,154,0,0,0,1,0,18,1,113,1,117,
+1,119,1,197,1,198,1,224,1,228,1,230,1,237,1,238,1,240,1,242,2,8,2,32,2,55,
+2,56,2,59,2,60,0,2,0,16,0,60,0,60,0,2,1,113,1,113,0,1,1,117,1,117,0,1,1,119,
+1,119,0,1,1,197,1,198,0,1,1,224,1,224,0,1,1,228,1,228,0,1,1,230,1,230,0,1,
+1,237,1,238,0,1,1,240,1,240,0,1,1,242,1,242,0,1,2,8,2,8,0,1,2,32,2,32,0,1,
+2,55,2,56,0,1,2,59,2,60,0,1,2,99,2,99,0,2,0,1,0,4,0,2,0,1,0,2,0,1,0,90,0,
+1,0,0,0,1,0,8,0,2,0,10,0,2,2,149,2,150,0,1,0,2,0,60,2,99,0,5,0,0,0,1,0,8,
+0,2,0,30,0,72,0,11,0,0,0,184,1,6,1,52,1,90,1,124,0,0,0,0,0,0,0,0,0,0,0,1,
+0,19,0,92,0,96,0,98,0,99,0,100,0,102,0,103,0,104,0,105,0,109,0,118,0,125,
+0,236,0,244,2,11,2,12,2,25,2,85,2,86,0,2,0,18,0,60,0,60,0,6,0,61,0,61,0,7,
+0,62,0,63,0,8,0,70,0,70,0,10,0,74,0,75,0,9,0,92,0,92,0,2,0,96,0,96,0,1,0,
+98,0,100,0,1,0,102,0,103,0,1,0,104,0,105,0,4,0,109,0,109,0,1,0,118,0,118,
+0,4,0,125,0,125,0,1,0,236,0,236,0,2,0,244,0,244,0,1,2,11,2,12,0,3,2,25,2,
+25,0,3,2,85,2,86,0,5,0,5,0,12,0,26,0,40,0,54,0,68,0,2,0,2,0,6,0,0,0,92,0,
+1,0,93,0,2,0,2,0,7,0,0,0,92,0,1,0,93,0,2,0,2,0,8,0,0,0,92,0,1,0,93,0,2,0,
+2,0,9,0,0,0,92,0,1,0,93,0,2,0,1,0,10,0,0,0,92,0,3,0,8,0,22,0,36,0,2,0,2,0,
+8,0,0,0,92,0,1,0,93,0,2,0,2,0,9,0,0,0,92,0,1,0,93,0,2,0,1,0,10,0,0,0,92,0,
+3,0,8,0,18,0,28,0,2,0,1,0,6,0,0,0,92,0,2,0,1,0,7,0,0,0,92,0,2,0,1,0,9,0,0,
+0,92,0,2,0,6,0,20,0,2,0,2,0,8,0,0,0,92,0,1,0,93,0,2,0,2,0,9,0,0,0,92,0,1,
+0,93,0,1,0,4,0,2,0,2,0,9,0,0,0,92,0,1,0,93,0,2,0,0,0,1,0,8,0,1,0,158,0,19,
+0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,122,
+0,128,0,134,0,140,0,146,0,152,0,2,0,21,0,55,0,2,0,25,0,55,0,2,0,27,0,55,0,
+2,0,28,0,55,0,2,0,29,0,55,0,2,0,31,0,55,0,2,0,32,0,55,0,2,0,33,0,55,0,2,0,
+34,0,55,0,2,0,38,0,55,0,2,0,47,0,55,0,2,0,54,0,55,0,2,0,200,0,55,0,2,0,208,
+0,55,0,2,1,243,0,55,0,2,1,244,0,55,0,2,2,1,0,55,0,2,2,74,0,55,0,2,2,75,0,
+55,0,1,0,19,0,92,0,96,0,98,0,99,0,100,0,102,0,103,0,104,0,105,0,109,0,118,
+0,125,0,236,0,244,2,11,2,12,2,25,2,85,2,86,0,4,0,0,0,1,0,8,0,1,0,58,0,1,0,
+8,0,6,0,14,0,20,0,26,0,32,0,38,0,44,2,143,0,2,0,60,2,144,0,2,0,61,2,145,0,
+2,0,62,2,146,0,2,0,63,2,147,0,2,0,74,2,148,0,2,0,75,0,1,0,1,0,55,0,4,0,0,
+0,1,0,8,0,1,0,166,0,2,0,10,0,108,0,11,0,24,0,30,0,36,0,42,0,48,0,54,0,60,
+0,66,0,74,0,82,0,90,2,137,0,2,0,60,2,138,0,2,0,61,2,139,0,2,0,62,2,140,0,
+2,0,63,2,155,0,2,0,70,2,141,0,2,0,74,2,142,0,2,0,75,2,89,0,3,0,129,0,60,2,
+91,0,3,0,129,0,61,2,93,0,3,0,129,0,62,2,98,0,3,0,129,0,70,0,7,0,16,0,22,0,
+28,0,34,0,40,0,46,0,52,2,88,0,2,0,60,2,90,0,2,0,61,2,92,0,2,0,62,2,94,0,2,
+0,63,2,97,0,2,0,70,2,95,0,2,0,74,2,96,0,2,0,75,0,1,0,2,0,55,0,129,0,4,0,0,
+0,1,0,8,0,1,0,82,0,3,0,12,0,30,0,64,0,2,0,6,0,12,1,179,0,2,0,57,1,180,0,2,
+0,59,0,4,0,10,0,16,0,22,0,28,1,147,0,2,0,4,1,147,0,2,0,5,1,148,0,2,0,128,
+1,149,0,2,1,168,0,2,0,6,0,12,1,189,0,2,0,57,1,190,0,2,0,59,0,1,0,3,0,28,0,
+59,0,99,0,6,0,0,0,1,0,8,0,2,0,16,0,28,1,172,1,188,0,2,0,0,1,196,0,1,0,4,0,
+59,1,147,1,148,1,149,0,2,0,66,0,21,0,21,0,2,0,25,0,25,0,2,0,27,0,27,0,2,0,
+29,0,29,0,2,0,31,0,32,0,2,0,33,0,33,0,1,0,34,0,34,0,2,0,38,0,38,0,2,0,42,
+0,42,0,2,0,47,0,47,0,2,0,49,0,49,0,1,0,54,0,54,0,2,0,92,0,92,0,2,0,96,0,96,
+0,2,0,98,0,98,0,2,0,100,0,100,0,2,0,102,0,103,0,2,0,104,0,104,0,1,0,105,0,
+105,0,2,0,109,0,109,0,2,0,113,0,113,0,2,0,118,0,118,0,2,0,120,0,120,0,1,0,
+125,0,125,0,2,0,200,0,200,0,2,0,204,0,204,0,2,0,206,0,206,0,2,0,207,0,207,
+0,1,0,208,0,208,0,2,0,210,0,211,0,2,0,212,0,212,0,1,0,213,0,213,0,2,0,217,
+0,217,0,1,0,221,0,221,0,2,0,226,0,226,0,2,0,228,0,228,0,1,0,233,0,233,0,2,
+0,236,0,236,0,2,0,240,0,240,0,2,0,242,0,242,0,2,0,243,0,243,0,1,0,244,0,244,
+0,2,0,246,0,247,0,2,0,248,0,248,0,1,0,249,0,249,0,2,0,253,0,253,0,1,1,1,1,
+1,0,2,1,6,1,6,0,2,1,8,1,8,0,1,1,13,1,13,0,2,1,84,1,84,0,2,1,87,1,90,0,2,1,
+93,1,93,0,2,1,96,1,96,0,2,1,99,1,99,0,2,1,103,1,103,0,2,1,106,1,106,0,1,1,
+108,1,108,0,1,1,110,1,110,0,2,1,113,1,114,0,1,1,115,1,115,0,2,1,116,1,119,
+0,1,1,122,1,122,0,1,1,130,1,133,0,2,1,135,1,136,0,2,1,139,1,140,0,2,0,2,0,
+2,0,59,0,59,0,1,1,147,1,149,0,1,0,1,0,1,0,1,0,1,0,2,0,6,0,20,0,1,0,1,0,1,
+0,0,0,1,0,0,0,97,0,1,0,2,0,1,0,0,0,1,0,0,0,98,0,1,0,0,0,1,0,8,0,2,0,14,0,
+4,2,129,2,131,2,133,2,135,0,1,0,4,0,59,1,147,1,148,1,149,0,1,0,0,0,1,0,8,
+0,2,0,14,0,4,2,130,2,132,2,134,2,136,0,1,0,4,0,59,1,147,1,148,1,149,0,6,0,
+0,0,1,0,8,0,2,0,16,0,28,1,124,1,146,0,2,0,0,1,154,0,1,0,4,0,4,0,5,0,128,1,
+168,0,2,0,58,0,21,0,21,0,1,0,25,0,25,0,1,0,27,0,28,0,1,0,31,0,34,0,1,0,38,
+0,38,0,1,0,42,0,42,0,1,0,47,0,47,0,1,0,54,0,54,0,1,0,92,0,92,0,1,0,96,0,96,
+0,1,0,98,0,99,0,1,0,102,0,105,0,1,0,109,0,109,0,1,0,113,0,113,0,1,0,118,0,
+118,0,1,0,125,0,125,0,1,0,200,0,200,0,1,0,204,0,204,0,1,0,206,0,207,0,1,0,
+210,0,213,0,1,0,217,0,217,0,1,0,221,0,221,0,1,0,226,0,226,0,1,0,233,0,233,
+0,1,0,236,0,236,0,1,0,240,0,240,0,1,0,242,0,243,0,1,0,246,0,249,0,1,0,253,
+0,253,0,1,1,1,1,1,0,1,1,6,1,6,0,1,1,13,1,13,0,1,1,84,1,84,0,1,1,87,1,90,0,
+1,1,93,1,93,0,1,1,96,1,100,0,1,1,103,1,104,0,1,1,106,1,108,0,1,1,110,1,110,
+0,1,1,113,1,119,0,1,1,122,1,122,0,1,1,130,1,133,0,1,1,135,1,136,0,1,1,139,
+1,140,0,1,1,184,1,184,0,1,1,187,1,188,0,1,1,194,1,194,0,1,1,197,1,198,0,1,
+2,8,2,8,0,1,2,32,2,32,0,1,2,55,2,56,0,1,2,59,2,62,0,1,2,64,2,67,0,1,2,70,
+2,70,0,1,2,74,2,78,0,1,2,80,2,83,0,1,2,85,2,87,0,1,2,156,2,163,0,1,0,2,0,
+3,0,4,0,5,0,1,0,128,0,128,0,1,1,168,1,168,0,1,0,1,0,1,0,1,0,1,0,2,0,6,0,20,
+0,1,0,1,0,1,0,0,0,1,0,0,0,100,0,2,0,0,0,1,0,1,0,0,0,1,0,0,0,100,0,1,0,0,0,
+1,0,8,0,2,0,14,0,4,2,151,2,152,2,153,2,154,0,1,0,4,0,4,0,5,0,128,1,168,0,
+4,0,0,0,1,0,8,0,1,1,50,0,13,0,32,0,66,0,100,0,134,0,168,0,194,0,220,0,238,
+1,0,1,10,1,20,1,30,1,40,0,4,0,10,0,16,0,22,0,28,0,134,0,2,0,70,1,18,0,2,2,
+97,1,54,0,2,2,98,0,170,0,2,2,155,0,4,0,10,0,16,0,22,0,28,0,136,0,2,0,70,1,
+20,0,2,2,97,1,56,0,2,2,98,0,172,0,2,2,155,0,4,0,10,0,16,0,22,0,28,0,140,0,
+2,0,70,1,24,0,2,2,97,1,60,0,2,2,98,0,176,0,2,2,155,0,4,0,10,0,16,0,22,0,28,
+0,141,0,2,0,70,1,25,0,2,2,97,1,61,0,2,2,98,0,177,0,2,2,155,0,3,0,8,0,14,0,
+20,0,142,0,2,0,70,1,26,0,2,2,97,1,62,0,2,2,98,0,3,0,8,0,14,0,20,0,143,0,2,
+0,70,1,27,0,2,2,97,1,63,0,2,2,98,0,2,0,6,0,12,0,147,0,2,0,70,0,183,0,2,2,
+155,0,2,0,6,0,12,0,156,0,2,0,70,1,76,0,2,2,98,0,1,0,4,0,178,0,2,0,70,0,1,
+0,4,0,179,0,2,0,70,0,1,0,4,0,192,0,2,0,70,0,1,0,4,1,31,0,2,0,70,0,1,0,4,1,
+67,0,2,2,102,0,1,0,13,0,25,0,27,0,31,0,32,0,33,0,34,0,38,0,47,0,104,0,105,
+0,118,0,217,0,253,0,0,};
+#endif
@@ -0,0 +1,1526 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansGurmukhi_Regular_ttf_size = 37440;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansGurmukhi_Regular_ttf");
+asm(".type fz_font_NotoSansGurmukhi_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansGurmukhi_Regular_ttf, 37440");
+asm(".balign 64");
+asm("fz_font_NotoSansGurmukhi_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansGurmukhi-Regular.ttf\"");
+#else
+const int fz_font_NotoSansGurmukhi_Regular_ttf_size = 37440;
+const char fz_font_NotoSansGurmukhi_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,123,121,120,51,0,0,121,72,0,0,2,254,
+71,80,79,83,11,132,76,242,0,0,124,72,0,0,6,190,71,83,85,66,6,94,7,7,0,0,131,
+8,0,0,15,54,79,83,47,50,120,164,104,193,0,0,1,104,0,0,0,96,99,109,97,112,
+152,183,9,178,0,0,6,124,0,0,1,100,103,97,115,112,0,7,0,7,0,0,121,60,0,0,0,
+12,103,108,121,102,118,193,91,91,0,0,10,60,0,0,87,88,104,101,97,100,8,54,
+210,244,0,0,0,236,0,0,0,54,104,104,101,97,15,53,8,79,0,0,1,36,0,0,0,36,104,
+109,116,120,130,112,116,107,0,0,1,200,0,0,4,180,108,111,99,97,130,114,151,
+206,0,0,7,224,0,0,2,92,109,97,120,112,1,70,1,16,0,0,1,72,0,0,0,32,110,97,
+109,101,142,42,185,254,0,0,97,148,0,0,6,12,112,111,115,116,192,7,31,73,0,
+0,103,160,0,0,17,154,0,1,0,0,0,1,7,174,101,187,44,134,95,15,60,245,0,11,8,
+0,0,0,0,0,206,10,252,202,0,0,0,0,211,6,133,120,251,197,252,218,12,65,7,44,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,44,252,188,0,0,11,223,251,197,254,134,12,
+65,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,45,0,1,0,0,1,45,0,150,0,8,0,120,0,12,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,4,4,171,1,144,0,5,0,0,5,153,5,51,0,
+0,0,191,5,153,5,51,0,0,2,130,0,102,2,129,0,0,2,11,5,2,4,5,4,2,2,4,0,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,44,252,188,0,0,7,44,
+3,68,0,0,0,1,0,0,0,0,4,250,4,250,0,0,0,32,0,3,4,205,0,193,0,0,0,0,2,20,0,
+0,2,20,0,0,0,0,253,121,0,0,254,133,3,62,0,126,5,240,255,241,7,209,255,241,
+6,135,255,241,6,135,255,241,5,76,255,241,5,76,255,241,4,117,255,241,5,240,
+255,241,5,76,255,241,5,240,255,241,4,249,255,241,4,200,255,241,6,0,255,241,
+6,14,255,241,4,161,255,241,5,65,255,241,5,19,255,241,4,229,255,241,4,192,
+255,241,4,138,255,241,4,154,255,241,5,72,255,241,4,199,255,241,5,43,255,241,
+4,250,255,241,4,86,255,241,4,200,255,241,4,239,255,241,4,190,255,241,5,48,
+255,241,4,190,255,241,4,161,255,241,4,222,255,241,4,158,255,241,4,196,255,
+241,5,144,255,241,4,161,255,241,5,100,255,241,5,100,255,241,4,138,255,241,
+4,211,255,241,4,196,255,241,4,156,255,241,0,0,253,76,1,225,255,241,2,18,255,
+241,2,18,254,140,0,0,252,7,0,0,252,7,0,0,252,209,0,0,252,209,0,0,252,58,0,
+0,252,133,0,0,254,138,0,0,254,164,4,200,255,241,6,0,255,241,5,3,255,241,4,
+141,255,241,4,161,255,241,4,104,0,79,4,104,0,123,4,104,0,88,4,104,0,92,4,
+104,0,92,4,104,0,69,4,104,0,150,4,104,0,61,4,104,0,73,4,104,0,73,0,0,253,
+205,0,0,253,199,4,117,255,241,5,76,255,241,11,223,0,123,0,0,253,255,7,152,
+0,124,5,76,255,241,5,76,255,241,4,249,255,241,6,14,255,241,4,161,255,241,
+5,65,255,241,5,19,255,241,4,192,255,241,4,138,255,241,4,154,255,241,5,72,
+255,241,5,43,255,241,4,250,255,241,4,86,255,241,4,200,255,241,4,239,255,241,
+4,190,255,241,5,48,255,241,4,190,255,241,4,222,255,241,4,158,255,241,4,196,
+255,241,5,144,255,241,4,161,255,241,4,138,255,241,4,156,255,241,0,0,253,117,
+0,0,252,235,0,0,253,17,4,249,255,241,4,200,255,241,6,0,255,241,6,14,255,241,
+4,161,255,241,5,65,255,241,5,19,255,241,4,229,255,241,4,192,255,241,4,138,
+255,241,4,154,255,241,5,72,255,241,4,199,255,241,5,43,255,241,4,250,255,241,
+4,86,255,241,4,200,255,241,4,239,255,241,4,190,255,241,5,48,255,241,4,190,
+255,241,4,161,255,241,4,222,255,241,4,158,255,241,4,196,255,241,5,144,255,
+241,4,161,255,241,5,100,255,241,4,138,255,241,4,196,255,241,4,156,255,241,
+4,249,255,241,4,200,255,241,6,0,255,241,6,14,255,241,4,161,255,241,5,65,255,
+241,5,19,255,241,5,3,255,241,4,192,255,241,4,138,255,241,4,154,255,241,5,
+72,255,241,4,141,255,241,5,43,255,241,4,250,255,241,4,86,255,241,4,200,255,
+241,4,239,255,241,4,190,255,241,5,48,255,241,4,190,255,241,4,161,255,241,
+4,222,255,241,4,158,255,241,4,196,255,241,5,144,255,241,4,161,255,241,5,100,
+255,241,4,138,255,241,4,211,255,241,4,156,255,241,5,83,255,241,0,0,253,117,
+0,0,252,235,0,0,252,193,0,0,254,149,0,0,253,235,0,0,252,7,0,0,252,7,0,0,251,
+223,0,0,252,7,0,0,252,7,0,0,252,7,0,0,251,205,0,0,251,197,0,0,252,49,0,0,
+251,200,4,249,255,241,0,0,253,117,0,0,252,235,0,0,253,17,5,48,255,241,4,161,
+255,241,4,161,255,241,6,135,255,241,5,76,255,241,5,76,255,241,4,117,255,241,
+5,240,255,241,5,76,255,241,5,240,255,241,2,18,254,140,0,0,252,209,0,0,252,
+209,0,0,252,58,0,0,252,11,5,76,255,241,5,76,255,241,1,188,255,241,0,0,252,
+7,0,0,252,7,0,0,252,128,0,0,252,128,3,17,1,43,4,4,0,235,5,57,0,70,6,159,0,
+117,2,156,0,235,2,212,0,140,2,212,0,120,4,219,0,150,4,104,0,102,2,0,0,63,
+2,184,0,100,2,37,0,147,3,111,0,86,4,104,0,98,4,104,0,178,4,104,0,96,4,104,
+0,82,4,104,0,23,4,104,0,131,4,104,0,113,4,104,0,90,4,104,0,106,4,104,0,106,
+2,91,0,175,2,91,0,91,4,104,0,102,4,104,0,102,4,104,0,102,4,36,0,146,2,217,
+0,221,3,111,0,86,2,217,0,110,4,104,0,60,3,74,255,252,3,32,0,90,4,81,0,248,
+3,2,0,110,4,104,0,102,2,184,0,100,4,0,0,82,8,0,0,82,2,127,0,168,2,126,0,166,
+3,255,0,169,3,255,0,166,6,111,0,147,4,104,0,141,4,104,0,102,4,104,0,102,4,
+104,0,147,3,8,1,142,4,202,1,142,0,0,0,0,0,0,255,202,0,0,254,213,4,20,0,106,
+0,0,252,7,6,135,255,241,5,76,255,241,5,76,255,241,4,117,255,241,5,240,255,
+241,5,76,255,241,5,240,255,241,2,18,254,140,0,0,252,189,0,0,252,187,0,0,252,
+38,0,0,252,23,5,76,255,241,5,76,255,241,5,76,255,241,0,0,253,76,0,0,254,133,
+1,229,0,160,3,127,0,160,5,25,0,160,4,250,0,81,4,250,0,81,4,250,0,81,3,174,
+0,137,4,18,0,117,2,116,254,191,2,179,254,191,0,0,0,1,0,3,0,1,0,0,0,12,0,4,
+1,88,0,0,0,80,0,64,0,5,0,16,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,160,0,173,
+0,215,0,247,9,101,10,3,10,10,10,16,10,40,10,48,10,51,10,54,10,57,10,60,10,
+66,10,72,10,77,10,81,10,92,10,94,10,117,32,13,32,20,32,25,32,29,32,38,32,
+185,34,18,37,204,38,44,168,57,254,255,255,255,0,0,0,0,0,13,0,32,0,37,0,39,
+0,91,0,123,0,160,0,173,0,215,0,247,9,100,10,1,10,5,10,15,10,19,10,42,10,50,
+10,53,10,56,10,60,10,62,10,71,10,75,10,81,10,89,10,94,10,102,32,11,32,19,
+32,24,32,28,32,38,32,185,34,18,37,204,38,44,168,48,254,255,255,255,0,1,255,
+245,0,0,0,183,0,182,0,155,0,128,255,99,0,82,0,48,0,17,247,167,246,3,246,2,
+245,254,245,252,245,251,245,250,245,249,245,248,245,246,245,245,245,241,245,
+239,245,236,245,229,245,228,245,221,225,2,224,237,224,234,224,232,224,224,
+224,81,222,247,219,68,218,39,88,243,2,14,0,1,0,0,0,0,0,76,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,217,0,218,
+0,219,0,0,0,21,0,21,0,21,0,21,0,67,0,96,0,167,1,2,1,103,1,199,2,34,2,46,2,
+58,2,70,2,82,2,174,2,186,3,1,3,58,3,116,3,194,4,18,4,79,4,169,4,210,5,41,
+5,115,5,169,5,230,6,58,6,134,6,195,7,2,7,62,7,117,7,167,7,234,8,28,8,98,8,
+159,8,246,9,34,9,89,9,146,9,237,9,249,10,63,10,122,10,165,10,220,10,245,11,
+9,11,52,11,95,11,129,11,182,11,211,12,4,12,44,12,99,12,124,12,150,12,162,
+12,174,12,232,13,54,13,66,13,112,13,168,13,224,14,49,14,128,14,172,15,8,15,
+58,15,105,15,174,15,214,15,246,16,49,16,143,17,45,17,78,18,35,18,51,18,67,
+18,79,18,91,18,103,18,115,18,127,18,139,18,151,18,163,18,175,18,187,18,199,
+18,211,18,223,18,235,18,247,19,3,19,15,19,27,19,39,19,51,19,63,19,75,19,87,
+19,99,19,141,19,181,19,235,19,247,20,3,20,15,20,27,20,39,20,51,20,63,20,75,
+20,87,20,99,20,111,20,123,20,135,20,147,20,159,20,171,20,183,20,195,20,207,
+20,219,20,231,20,243,20,255,21,11,21,23,21,35,21,47,21,59,21,71,21,83,21,
+95,21,111,21,127,21,143,21,159,21,175,21,191,21,207,21,219,21,235,21,251,
+22,11,22,27,22,39,22,55,22,71,22,87,22,103,22,119,22,135,22,151,22,167,22,
+183,22,199,22,215,22,231,22,247,23,7,23,23,23,39,23,51,23,67,23,108,23,168,
+23,228,24,48,24,88,24,136,24,201,25,6,25,79,25,126,25,178,26,4,26,81,26,171,
+26,232,27,45,27,149,27,199,27,244,28,48,28,181,28,197,28,213,28,225,28,241,
+29,1,29,13,29,25,29,133,29,145,29,157,29,203,30,13,30,69,30,141,30,161,30,
+181,30,217,30,248,31,39,31,79,31,135,31,165,31,193,31,252,32,75,32,95,32,
+133,32,171,32,212,32,239,33,7,33,23,33,45,33,70,33,116,33,139,33,185,33,244,
+34,27,34,73,34,135,34,154,34,226,35,31,35,73,35,117,35,141,35,164,35,189,
+35,248,36,20,36,45,36,72,36,93,36,107,36,162,36,184,36,239,37,25,37,33,37,
+49,37,65,37,89,37,114,37,150,37,187,37,240,38,21,38,70,38,86,38,135,38,148,
+38,167,38,167,38,180,38,210,39,48,39,78,39,190,39,202,39,214,39,226,39,238,
+40,92,40,104,40,168,40,218,41,30,41,91,41,167,41,183,41,199,42,59,42,81,42,
+104,42,116,42,135,42,161,42,177,42,202,42,236,43,23,43,77,43,114,43,172,0,
+2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,
+104,2,121,253,135,5,182,250,74,104,4,230,0,0,3,253,121,4,250,0,116,7,44,0,
+11,0,25,0,26,0,0,1,50,22,21,20,6,35,34,38,53,52,54,5,6,6,35,34,38,39,55,22,
+22,51,50,54,55,3,254,246,47,60,59,48,46,61,60,1,173,22,195,163,168,199,16,
+148,15,112,106,107,113,14,151,7,44,61,50,51,60,61,50,50,61,78,188,196,201,
+183,19,136,129,129,136,254,9,0,3,254,133,4,250,255,103,7,44,0,11,0,12,0,13,
+0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,3,254,246,49,64,62,51,50,63,64,132,
+83,6,174,65,52,53,64,65,52,52,65,254,76,2,50,0,0,4,0,126,0,0,2,192,4,250,
+0,11,0,23,0,35,0,47,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,
+38,35,34,6,21,20,22,19,50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,38,
+35,34,6,21,20,22,1,159,132,157,155,134,132,157,158,131,65,77,77,65,65,77,
+76,66,132,157,155,134,132,157,158,131,65,77,77,65,65,77,76,4,250,145,122,
+123,144,144,123,119,148,254,108,76,61,61,76,75,62,62,75,254,176,145,122,123,
+144,144,123,119,148,254,108,76,61,61,76,75,62,62,75,0,0,6,255,241,0,0,5,255,
+4,250,0,49,0,50,0,51,0,52,0,53,0,54,0,0,1,6,6,7,6,6,35,34,53,52,54,55,38,
+38,39,6,7,6,6,35,34,38,53,52,54,55,38,38,39,35,53,33,22,22,21,54,54,55,22,
+22,23,54,54,55,17,33,21,35,17,35,33,19,19,37,37,4,148,85,151,66,3,92,76,100,
+72,58,8,33,24,159,119,5,90,79,51,47,71,57,6,35,30,186,1,54,39,40,61,221,110,
+38,54,5,65,154,90,1,107,198,165,253,199,163,97,1,53,252,226,2,211,22,69,48,
+173,189,118,74,172,63,103,152,49,59,95,175,189,59,60,74,170,61,92,134,43,
+146,90,161,70,53,104,24,63,223,102,45,68,22,1,137,146,251,152,3,220,254,124,
+135,72,0,0,7,255,241,0,0,7,224,4,250,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,
+0,1,6,6,7,6,6,35,34,53,52,54,55,38,38,39,6,7,6,6,35,34,38,53,52,54,55,38,
+38,39,35,53,33,22,22,21,54,54,55,22,22,23,54,54,55,17,33,21,35,17,35,17,33,
+17,35,1,1,19,19,37,37,4,148,85,151,66,3,92,76,100,72,58,8,33,24,159,119,5,
+90,79,51,47,71,57,6,35,30,186,1,54,39,40,61,221,110,38,54,5,65,154,90,3,76,
+180,165,254,178,165,2,152,251,47,163,97,1,53,252,226,2,211,22,69,48,173,189,
+118,74,172,63,103,152,49,59,95,175,189,59,60,74,170,61,92,134,43,146,90,161,
+70,53,104,24,63,223,102,45,68,22,1,137,146,253,175,2,81,251,152,4,250,251,
+6,3,220,254,124,135,72,0,0,4,255,241,0,0,6,150,7,44,0,54,0,61,0,62,0,63,0,
+0,19,35,53,51,53,52,54,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,6,21,21,
+33,21,35,17,7,33,34,6,7,22,22,51,50,54,55,23,6,35,34,36,39,54,54,55,38,38,
+53,33,17,35,1,33,20,22,22,51,51,19,1,182,197,197,75,168,131,160,184,13,160,
+11,91,93,77,97,33,5,59,186,60,254,232,95,187,81,78,170,120,93,157,104,57,
+190,224,185,254,239,100,52,144,92,126,126,254,219,165,4,129,253,241,62,133,
+129,203,165,254,112,4,104,146,94,164,191,113,188,171,54,82,16,59,66,106,104,
+80,133,106,99,146,254,40,60,97,101,133,115,39,50,145,94,197,212,81,124,43,
+56,235,180,251,152,4,104,124,172,91,2,21,251,6,0,3,255,241,0,0,6,150,7,44,
+0,54,0,61,0,62,0,0,33,35,17,33,17,7,33,34,6,7,22,22,51,50,54,55,23,6,35,34,
+36,39,54,54,55,38,38,53,35,53,33,53,52,38,38,35,34,6,21,20,23,7,38,53,52,
+54,51,50,22,22,21,21,51,21,35,33,33,20,22,22,51,51,3,5,208,165,254,159,60,
+254,232,95,187,81,78,170,120,93,157,104,57,190,224,185,254,239,100,52,144,
+92,126,126,125,5,58,34,87,74,99,98,12,160,14,196,168,136,161,58,198,198,253,
+85,253,241,62,133,129,203,235,4,104,254,40,60,97,101,133,115,39,50,145,94,
+197,212,81,124,43,56,235,180,146,65,148,132,73,106,110,51,68,16,97,40,166,
+192,118,187,163,94,146,124,172,91,253,27,255,255,255,241,253,213,5,91,7,44,
+2,38,0,80,0,0,0,7,0,54,5,32,0,0,255,255,255,241,252,218,5,91,7,44,2,38,0,
+80,0,0,0,7,0,55,5,32,0,0,255,255,255,241,0,0,4,132,7,44,2,34,0,79,0,0,0,7,
+0,56,4,117,0,0,255,255,255,241,0,0,5,255,7,44,2,34,0,7,0,0,0,7,0,57,5,240,
+0,0,0,5,255,241,0,0,5,91,7,44,0,32,0,44,0,57,0,58,0,59,0,0,1,6,6,7,22,22,
+21,20,6,35,32,0,17,53,52,55,35,53,51,62,3,51,33,7,33,34,6,6,7,33,21,35,33,
+6,21,21,20,23,33,50,62,2,1,22,22,51,50,54,53,52,46,3,35,19,19,5,6,12,165,
+152,94,102,215,202,254,219,254,204,14,164,192,38,135,184,224,171,1,59,10,
+254,227,235,209,124,33,3,255,249,252,219,14,3,1,13,187,173,118,65,252,228,
+34,203,168,132,126,29,50,91,145,128,142,152,4,104,188,237,49,45,157,93,172,
+187,1,182,1,169,38,124,103,146,139,178,100,36,146,63,137,107,146,97,143,19,
+68,60,40,88,145,254,93,223,223,102,110,46,75,49,46,18,253,173,7,44,255,255,
+255,241,0,0,6,4,7,44,2,34,0,7,0,0,0,7,0,59,5,240,0,0,0,3,255,241,0,0,5,8,
+4,250,0,32,0,44,0,45,0,0,33,38,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,
+53,52,39,33,53,33,21,35,22,22,21,20,7,22,18,23,1,38,38,35,34,6,21,20,22,51,
+50,54,1,3,232,9,42,33,85,227,134,185,213,224,176,135,212,86,26,20,252,98,
+5,23,211,6,13,85,58,77,20,254,194,74,181,108,115,130,124,107,120,188,1,15,
+119,206,86,109,109,190,165,163,193,95,99,94,134,91,99,146,146,28,121,40,214,
+164,99,254,232,182,2,43,101,102,111,100,97,111,108,3,59,0,2,255,241,0,0,4,
+215,4,250,0,25,0,35,0,0,1,6,35,34,38,39,54,54,53,52,38,39,35,53,33,22,22,
+21,21,33,17,33,21,35,17,35,17,17,33,6,7,22,22,51,50,54,3,108,138,157,168,
+252,83,76,67,26,23,187,1,49,44,50,1,236,1,107,198,165,253,248,27,58,64,147,
+100,73,136,1,81,66,205,205,64,124,72,45,102,40,146,80,174,78,13,1,89,146,
+251,152,2,1,1,19,66,53,132,116,40,0,0,2,255,241,0,0,6,15,4,250,0,23,0,37,
+0,0,1,17,33,53,33,21,35,17,35,17,33,17,20,6,6,35,34,38,38,53,52,54,54,51,
+23,35,34,6,6,21,20,22,22,51,50,54,54,53,2,206,253,35,6,30,198,165,254,207,
+81,133,106,118,213,156,101,174,155,212,179,121,113,64,102,145,74,65,62,29,
+3,68,1,36,146,146,251,152,4,104,252,234,136,137,65,131,254,143,97,152,59,
+146,23,77,73,81,185,105,38,77,99,0,0,1,255,241,0,0,6,29,4,250,0,53,0,0,1,
+21,35,17,35,17,6,35,34,38,39,6,6,35,34,38,39,54,54,53,52,38,39,35,53,33,22,
+22,21,20,7,22,22,51,50,54,55,38,53,52,54,51,50,22,21,20,7,22,22,51,50,54,
+55,17,6,29,198,165,65,85,102,143,40,46,149,102,147,170,75,76,67,26,23,187,
+1,49,44,50,123,33,110,77,80,110,29,33,58,56,57,55,43,29,108,78,49,64,24,4,
+250,146,251,152,1,51,35,92,92,92,92,180,229,64,124,72,45,102,40,146,80,174,
+78,176,105,120,120,114,115,232,160,100,103,97,107,152,244,112,112,34,31,3,
+20,0,0,3,255,241,255,239,4,176,4,250,0,40,0,52,0,53,0,0,1,54,54,53,52,38,
+38,35,33,39,17,35,53,33,21,33,21,33,50,22,22,21,20,6,7,22,23,7,38,39,6,6,
+35,34,38,53,52,54,51,50,22,7,38,38,35,34,6,21,20,22,51,50,54,23,3,65,55,56,
+62,117,148,254,138,60,198,4,191,252,172,1,57,166,178,104,99,91,39,58,159,
+37,35,69,151,82,195,202,159,139,128,220,31,69,159,89,66,67,120,117,58,106,
+196,1,74,49,117,67,64,78,35,60,1,72,146,146,242,63,139,115,100,189,70,59,
+125,43,90,59,29,28,133,127,98,127,108,199,80,81,46,40,58,53,18,235,0,3,255,
+241,0,0,5,80,4,250,0,26,0,36,0,37,0,0,1,17,20,6,6,35,34,0,39,35,34,38,53,
+52,54,54,51,50,22,21,21,33,17,33,53,33,21,1,33,30,2,51,50,54,54,53,3,4,138,
+86,151,123,242,254,184,26,35,52,54,69,107,43,42,46,2,113,252,12,5,95,254,
+149,253,143,11,125,193,107,83,79,27,100,4,104,252,249,134,146,73,1,85,255,
+41,37,46,109,77,58,56,51,1,131,146,146,253,236,121,208,118,47,89,90,254,137,
+0,6,255,241,0,0,5,34,4,250,0,35,0,43,0,52,0,53,0,54,0,55,0,0,1,50,22,21,20,
+4,33,32,36,53,52,54,55,38,38,53,52,54,54,51,33,53,33,53,33,21,35,17,7,33,
+34,6,21,20,22,51,19,17,35,34,6,21,20,22,1,17,54,54,53,52,38,38,35,1,1,33,
+3,35,213,204,254,234,254,217,254,225,254,247,77,77,72,72,94,144,155,1,175,
+252,80,5,49,220,60,253,203,113,86,92,110,109,78,125,119,160,1,61,167,153,
+55,108,116,1,61,254,67,1,16,2,75,152,135,158,142,142,153,63,104,34,32,101,
+69,77,113,48,192,146,146,254,234,60,47,51,54,51,254,65,1,51,82,67,81,73,1,
+47,254,205,4,75,83,44,64,37,3,59,251,6,0,1,255,241,0,0,4,244,4,250,0,25,0,
+0,1,33,17,33,53,33,21,35,17,35,17,33,17,35,17,35,34,38,53,52,54,54,51,50,
+22,21,1,126,2,11,252,104,5,3,198,165,253,245,165,36,52,54,69,107,43,42,46,
+2,229,1,131,146,146,251,152,2,84,253,172,2,84,41,37,46,109,77,58,56,0,4,255,
+241,255,228,4,207,4,250,0,43,0,53,0,54,0,55,0,0,1,54,54,53,52,38,35,34,7,
+39,54,55,38,38,39,35,53,33,21,35,6,6,7,22,22,21,20,6,7,22,23,7,38,39,6,35,
+34,38,53,52,54,51,50,22,19,50,54,54,55,33,30,3,3,5,2,82,171,172,168,189,227,
+240,51,122,145,63,74,12,195,4,222,181,15,85,71,113,114,187,178,74,70,113,
+142,92,39,79,119,132,83,75,63,119,110,49,115,84,16,253,232,9,47,79,87,149,
+1,216,1,54,13,105,92,94,86,80,136,39,25,51,154,103,146,146,112,162,50,38,
+142,104,128,173,34,46,61,106,132,52,3,66,58,46,50,25,1,239,41,125,119,80,
+113,68,24,253,224,181,0,3,255,241,0,0,4,153,4,250,0,42,0,47,0,48,0,0,1,21,
+33,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,55,38,38,53,52,54,55,38,39,
+35,53,33,21,35,17,7,33,34,6,6,21,20,22,22,51,3,22,23,33,53,3,3,241,254,93,
+116,76,132,133,167,153,44,167,217,199,211,71,101,127,109,101,66,69,166,4,
+168,198,60,254,29,71,80,44,70,128,140,231,68,44,1,98,216,2,36,146,61,52,71,
+70,48,150,46,146,128,94,57,24,127,112,93,120,20,116,91,146,146,254,232,60,
+17,51,38,54,58,22,2,68,104,90,194,251,152,0,2,255,241,0,0,4,169,4,250,0,31,
+0,32,0,0,1,17,33,53,33,21,35,17,7,35,34,14,2,7,22,22,51,50,54,55,23,6,6,35,
+34,36,3,62,2,51,3,3,62,252,179,4,184,198,60,78,152,143,119,115,71,86,191,
+126,98,155,131,57,122,204,115,196,254,234,116,131,208,197,151,160,3,95,1,
+9,146,146,254,161,60,16,53,96,87,169,146,40,60,145,57,48,222,1,1,172,158,
+54,252,161,0,5,255,241,0,0,5,87,4,250,0,18,0,30,0,31,0,32,0,33,0,0,1,53,33,
+53,33,21,33,21,22,0,21,20,4,33,32,36,53,52,0,5,6,6,21,20,22,51,50,54,53,52,
+38,3,19,3,2,82,253,159,5,102,253,159,249,1,9,254,211,254,217,254,219,254,
+209,1,12,1,72,209,223,207,225,223,209,226,124,156,250,3,130,230,146,146,230,
+58,254,246,161,205,208,209,204,164,1,7,65,48,194,125,129,129,131,129,122,
+195,2,35,251,6,2,240,0,4,255,241,0,0,4,214,4,250,0,43,0,55,0,56,0,57,0,0,
+37,54,54,53,52,38,39,6,35,34,53,52,51,50,23,54,54,53,52,39,33,53,33,21,35,
+22,21,20,6,7,22,22,21,20,4,33,34,38,53,52,54,51,50,22,7,38,38,35,34,6,21,
+20,22,51,50,54,7,51,3,88,44,44,121,109,125,105,229,179,148,149,82,82,4,252,
+118,4,229,183,6,82,95,118,111,254,193,254,228,215,223,155,138,142,254,43,
+84,172,89,69,67,135,135,65,105,101,219,223,34,95,62,82,135,32,24,116,104,
+54,35,129,93,38,28,146,146,36,31,108,156,56,61,164,111,192,213,133,127,98,
+127,136,187,88,89,44,40,57,56,10,152,0,0,2,255,241,0,0,5,58,4,250,0,39,0,
+51,0,0,19,35,34,38,53,52,54,54,51,50,22,21,21,33,17,33,53,33,21,35,17,7,33,
+21,20,22,23,54,54,51,50,22,21,20,6,35,34,36,2,53,1,22,22,51,50,54,53,52,38,
+35,34,6,207,36,52,54,69,107,43,42,46,2,91,252,34,5,73,198,60,253,60,59,60,
+98,229,131,136,153,209,203,191,254,232,148,1,143,49,115,65,121,117,69,70,
+85,164,2,144,41,37,46,109,77,58,56,51,1,71,146,146,254,100,60,22,116,180,
+64,105,106,126,99,127,133,159,1,37,186,254,65,25,24,53,58,40,46,74,0,0,1,
+255,241,0,0,5,9,4,250,0,37,0,0,1,55,38,39,33,53,33,21,33,22,5,7,38,39,7,7,
+38,35,34,6,7,22,22,51,50,54,55,23,6,6,35,34,36,39,54,54,51,50,2,190,61,198,
+148,254,80,5,24,253,115,215,1,95,72,126,105,86,76,74,84,86,142,91,101,207,
+145,113,174,149,57,132,226,128,229,254,214,123,138,226,131,72,2,235,122,121,
+138,146,146,163,150,140,57,58,169,32,30,76,106,166,121,40,60,145,57,48,199,
+250,178,141,0,2,255,241,0,0,4,101,4,250,0,41,0,42,0,0,55,55,22,22,51,50,54,
+53,52,38,39,6,35,34,53,52,51,50,23,54,54,53,52,39,33,53,33,21,35,22,21,20,
+6,7,22,22,21,20,4,35,34,38,5,26,67,98,203,114,152,171,115,114,125,106,229,
+179,148,149,82,82,7,252,234,4,116,183,6,80,96,122,106,254,247,223,131,243,
+2,52,132,150,64,69,122,116,92,138,46,24,116,104,54,33,121,89,44,36,146,146,
+43,39,105,145,55,67,174,115,179,206,66,66,0,3,255,241,0,0,4,215,4,250,0,19,
+0,26,0,36,0,0,1,6,6,35,34,38,39,54,54,53,52,38,39,35,53,33,21,35,17,35,1,
+22,21,20,7,33,17,17,53,33,6,7,22,22,51,50,54,3,108,80,137,78,168,252,83,76,
+67,26,23,187,4,230,198,165,253,239,37,5,1,241,253,217,19,35,64,147,100,73,
+136,1,82,38,29,205,205,64,124,72,45,102,40,146,146,251,152,4,104,98,88,35,
+35,1,0,253,153,218,29,33,132,116,40,0,0,1,255,241,0,0,4,254,4,250,0,34,0,
+0,1,33,17,33,53,33,21,35,17,7,33,22,22,51,50,54,55,23,6,35,32,0,17,53,35,
+34,38,53,52,54,54,51,50,22,21,1,116,2,31,252,94,5,13,198,60,253,120,1,192,
+191,96,169,89,57,187,227,254,249,254,229,36,52,54,69,107,43,42,46,2,229,1,
+131,146,146,254,40,60,223,223,45,45,146,94,1,46,1,16,22,41,37,46,109,77,58,
+56,0,0,2,255,241,0,0,4,205,4,250,0,18,0,30,0,0,1,6,35,34,38,39,54,54,53,52,
+38,39,35,53,33,21,35,17,35,1,22,21,20,7,22,22,51,50,54,55,17,3,98,135,150,
+168,252,83,76,67,26,23,187,4,220,198,165,253,249,37,113,64,147,100,77,137,
+70,1,77,62,205,205,64,124,72,45,102,40,146,146,251,152,4,104,98,88,171,102,
+132,116,44,42,2,109,0,5,255,241,0,0,5,63,4,250,0,34,0,35,0,36,0,37,0,38,0,
+0,1,6,6,21,20,22,51,7,34,38,38,53,52,0,55,53,33,53,33,21,33,21,22,0,21,20,
+6,6,35,39,50,54,53,52,38,3,3,33,1,2,152,204,216,132,125,10,131,184,96,1,5,
+241,253,171,5,78,253,171,242,1,4,93,185,133,10,125,132,216,122,82,1,10,254,
+244,3,7,52,196,128,122,128,149,102,187,108,170,1,11,64,230,146,146,230,64,
+254,245,170,106,186,105,149,128,122,128,196,2,39,251,6,2,240,0,0,1,255,241,
+0,0,4,205,4,250,0,31,0,0,1,6,35,34,38,39,54,54,53,52,38,39,35,53,33,22,22,
+21,20,7,22,22,51,50,54,55,17,33,21,35,17,35,3,98,135,150,168,252,83,76,67,
+26,23,187,1,49,44,50,113,64,147,100,74,132,78,1,107,198,165,1,77,62,205,205,
+64,124,72,45,102,40,146,80,174,78,171,102,132,116,40,46,2,255,146,251,152,
+0,0,2,255,241,0,0,4,176,4,250,0,34,0,46,0,0,1,17,33,53,33,21,35,17,7,33,34,
+6,6,21,20,22,23,54,54,51,50,22,21,20,6,35,34,36,2,53,52,62,2,51,3,22,22,51,
+50,54,53,52,38,35,34,6,3,69,252,172,4,191,198,60,254,151,145,126,69,57,58,
+98,227,129,135,154,203,201,171,254,245,181,54,121,166,132,81,45,112,67,119,
+123,71,69,84,163,3,93,1,11,146,146,254,159,60,33,78,73,63,124,62,101,102,
+125,100,128,132,131,1,4,150,69,125,91,35,253,98,25,24,53,58,42,44,74,0,3,
+255,241,0,0,4,237,4,250,0,18,0,25,0,36,0,0,1,21,35,17,35,53,6,35,34,36,39,
+54,54,55,38,38,53,35,53,1,17,33,20,22,22,51,1,17,33,34,6,6,7,22,22,51,50,
+4,237,198,165,123,147,184,254,236,84,42,135,92,117,116,135,3,145,253,158,
+70,119,122,1,43,254,254,85,117,111,50,60,170,121,154,4,250,146,251,152,193,
+51,184,181,61,107,46,50,203,154,146,254,40,1,70,119,144,63,254,62,1,53,33,
+72,58,106,100,0,4,255,241,0,0,4,173,4,250,0,45,0,56,0,57,0,58,0,0,1,54,54,
+53,52,39,33,53,33,21,35,22,21,20,6,7,22,22,21,20,4,35,34,38,39,55,22,22,51,
+50,54,53,52,38,39,6,6,35,34,38,53,52,54,51,50,22,7,38,38,35,34,6,21,20,51,
+50,54,3,51,3,71,14,15,31,252,172,4,188,190,23,40,39,48,49,254,240,253,137,
+248,112,67,109,205,121,179,179,21,20,72,187,114,165,181,178,161,109,187,5,
+63,145,81,88,88,179,91,143,169,224,3,46,34,71,38,102,69,146,146,72,108,71,
+125,53,67,141,75,202,214,66,66,150,71,63,138,138,43,82,39,63,62,129,113,110,
+133,67,183,52,52,52,43,98,44,253,115,0,0,1,255,241,0,0,4,211,4,250,0,25,0,
+0,1,22,18,23,33,17,33,21,35,17,35,17,33,6,6,35,34,38,53,52,54,55,2,39,35,
+53,1,11,63,64,1,1,221,1,107,198,165,254,33,9,93,75,51,47,64,61,14,91,153,
+4,250,162,254,208,128,2,82,146,251,152,2,22,183,186,59,60,67,171,67,1,33,
+250,146,0,0,2,255,241,0,0,5,159,4,250,0,20,0,33,0,0,1,33,17,6,35,34,38,39,
+54,54,53,52,38,39,35,53,33,21,35,17,35,1,33,17,33,22,21,20,7,22,22,51,50,
+55,4,52,254,246,101,128,168,252,83,77,66,26,23,187,5,174,198,165,254,81,1,
+175,253,38,38,113,63,147,101,31,32,2,101,254,178,33,211,212,68,126,73,46,
+105,41,146,146,251,152,2,247,1,113,102,91,174,104,137,124,4,0,0,3,255,241,
+0,0,4,176,4,250,0,19,0,33,0,34,0,0,1,17,33,53,33,21,35,17,20,6,6,35,34,38,
+2,53,52,54,54,51,5,33,34,6,6,21,20,22,22,51,50,54,54,53,3,3,69,252,172,4,
+191,198,89,153,125,131,245,183,112,187,182,1,24,254,252,133,130,73,131,179,
+91,85,80,30,100,3,68,1,36,146,146,252,249,137,145,71,125,1,4,143,107,140,
+61,146,26,77,70,83,184,101,46,84,96,254,137,0,0,7,255,241,0,0,5,115,4,250,
+0,44,0,50,0,51,0,52,0,53,0,54,0,55,0,0,1,6,7,22,22,21,20,6,6,35,35,39,51,
+50,54,53,52,38,39,6,7,38,39,6,6,21,20,22,51,51,7,35,34,38,38,53,52,54,55,
+38,39,35,53,33,21,33,18,23,54,54,55,55,1,33,1,23,4,117,31,97,142,145,100,
+192,136,12,10,22,128,136,106,108,106,126,128,106,101,111,135,129,22,10,12,
+137,192,99,147,141,102,27,254,5,130,252,36,44,239,116,145,22,168,254,61,1,
+36,253,234,242,4,104,163,153,79,213,123,108,187,102,150,129,112,93,157,56,
+114,71,72,113,53,154,91,117,132,150,103,186,107,123,218,75,154,162,146,146,
+254,238,167,77,228,136,146,251,6,2,154,8,255,255,255,241,254,198,5,115,4,
+250,2,34,0,44,0,0,0,7,0,50,3,59,0,78,0,2,255,241,0,0,4,153,4,250,0,46,0,47,
+0,0,1,21,33,34,14,2,21,20,22,51,50,55,23,6,35,34,38,53,52,55,38,38,53,52,
+62,2,51,33,53,33,53,33,21,35,17,7,33,34,6,6,21,20,22,22,51,19,3,241,254,147,
+81,75,58,32,132,133,167,153,44,167,217,199,211,71,101,127,58,108,134,113,
+1,69,252,195,4,168,198,60,254,29,71,80,44,70,128,140,19,2,36,146,5,25,49,
+34,71,70,48,150,46,146,128,94,57,24,127,112,67,101,61,17,194,146,146,254,
+232,60,17,51,38,54,58,22,253,220,0,3,255,241,255,238,4,226,4,250,0,19,0,24,
+0,36,0,0,3,33,21,35,17,35,17,33,6,6,35,34,38,53,52,54,55,2,39,35,33,22,23,
+33,17,1,50,22,21,20,6,35,34,38,53,52,54,15,4,241,198,165,254,18,9,93,75,51,
+47,64,61,14,91,153,1,72,79,3,1,236,254,200,49,64,62,51,50,63,64,4,250,146,
+251,152,2,22,183,186,59,60,67,171,67,1,33,250,246,202,1,192,252,112,65,52,
+53,64,65,52,52,65,0,2,255,241,0,0,4,211,4,250,0,19,0,24,0,0,3,33,21,35,17,
+35,17,33,6,6,35,34,38,53,52,54,55,2,39,35,33,22,23,33,17,15,4,226,198,165,
+254,33,9,93,75,51,47,64,61,14,91,153,1,72,79,3,1,221,4,250,146,251,152,2,
+22,183,186,59,60,67,171,67,1,33,250,246,202,1,192,0,0,2,255,241,0,0,4,171,
+4,250,0,34,0,35,0,0,1,38,35,34,6,21,20,22,22,51,50,54,54,53,17,33,53,33,21,
+35,17,20,6,6,35,34,38,38,53,52,54,54,51,50,23,19,2,28,35,43,118,103,132,179,
+98,78,75,29,252,177,4,186,198,98,149,118,132,247,177,89,162,140,48,37,180,
+2,171,4,84,85,84,186,99,49,82,95,2,241,146,146,252,249,144,146,63,132,252,
+144,100,139,69,6,252,194,0,2,253,76,254,120,254,46,0,0,0,11,0,12,0,0,5,50,
+22,21,20,6,35,34,38,53,52,54,55,253,189,49,64,62,51,50,63,64,49,158,65,52,
+53,64,65,52,52,65,158,0,0,2,255,241,2,23,1,240,4,250,0,7,0,8,0,0,1,35,17,
+35,17,35,53,33,35,1,240,180,165,166,1,255,180,4,104,253,175,2,81,146,0,1,
+255,241,0,0,3,132,7,44,0,29,0,0,19,35,53,51,53,52,54,54,51,50,22,21,20,7,
+39,54,53,52,38,35,34,6,6,21,21,51,21,35,17,35,182,197,197,75,168,131,160,
+184,13,160,11,91,93,77,97,33,198,198,165,4,104,146,94,164,191,113,188,171,
+54,82,16,59,66,106,104,80,133,106,99,146,251,152,0,1,254,140,0,0,2,33,7,44,
+0,29,0,0,33,35,17,35,53,51,53,52,38,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,22,22,21,21,51,21,35,1,91,165,197,197,34,87,74,99,98,12,160,14,196,168,
+136,161,58,198,198,4,104,146,65,148,132,73,106,110,51,68,16,97,40,166,192,
+118,187,163,94,146,0,0,3,252,7,253,213,255,24,0,0,0,13,0,14,0,15,0,0,1,55,
+22,22,51,50,54,55,23,6,6,35,34,38,1,19,252,7,29,89,175,99,99,175,90,29,82,
+205,106,106,203,1,54,4,254,244,138,51,46,46,51,138,51,54,54,1,63,253,213,
+0,0,4,252,7,252,218,255,24,0,0,0,13,0,27,0,28,0,29,0,0,5,55,22,22,51,50,54,
+55,23,6,6,35,34,38,7,55,22,22,51,50,54,55,23,6,6,35,34,38,1,19,252,7,29,90,
+174,99,100,173,91,29,82,205,106,106,204,82,29,90,174,99,100,172,92,29,83,
+204,106,106,203,1,54,14,215,125,52,45,45,52,125,51,54,54,217,126,52,45,45,
+52,126,51,54,54,2,22,252,218,0,2,252,209,4,235,255,73,7,44,0,12,0,13,0,0,
+1,38,38,35,35,34,7,39,54,51,50,0,19,55,254,171,49,194,165,37,12,8,9,18,33,
+233,1,28,63,1,4,235,208,213,1,155,2,254,226,254,221,15,0,2,252,209,4,158,
+255,86,7,44,0,27,0,28,0,0,1,38,38,35,35,34,7,39,54,51,50,22,23,38,38,35,35,
+34,7,39,54,51,50,0,19,7,22,23,55,254,187,68,205,167,20,11,9,10,20,22,146,
+225,79,56,193,164,15,8,7,9,18,21,238,1,15,57,85,8,7,57,4,158,113,110,1,150,
+2,101,100,168,161,1,151,2,254,230,254,217,7,14,14,50,0,2,252,58,4,235,255,
+73,7,44,0,21,0,22,0,0,1,38,38,35,34,7,6,35,34,38,39,55,22,22,51,50,55,54,
+51,50,22,23,55,254,167,11,71,77,20,53,53,26,126,143,41,146,42,73,65,26,50,
+49,27,143,145,5,12,4,235,127,108,5,6,156,158,39,134,73,5,5,187,193,15,0,0,
+2,252,133,4,250,0,20,7,44,0,34,0,35,0,0,3,54,53,52,38,35,34,6,21,20,23,7,
+38,53,52,55,6,35,34,38,39,55,22,22,51,50,54,55,54,51,50,22,21,20,7,7,153,
+26,72,67,67,71,26,140,33,1,21,22,128,142,28,146,23,65,72,36,50,35,79,118,
+130,157,33,170,5,131,60,58,64,67,69,62,58,60,21,80,76,11,11,4,122,111,39,
+75,64,12,22,62,134,114,74,81,116,0,0,1,254,138,254,9,0,196,255,184,0,12,0,
+0,19,38,38,35,35,34,7,39,54,51,50,4,23,54,51,177,146,26,10,9,9,18,33,192,
+1,1,70,254,9,129,146,1,155,2,198,190,0,2,254,164,253,130,0,241,0,0,0,10,0,
+11,0,0,7,22,22,51,51,50,55,7,34,0,3,39,200,50,194,164,17,7,9,18,224,254,232,
+66,1,61,211,210,1,157,1,8,1,12,106,0,255,255,255,241,255,238,4,215,4,250,
+2,34,0,18,0,0,0,7,1,33,3,151,1,118,255,255,255,241,254,232,6,15,4,250,2,34,
+0,19,0,0,0,7,0,50,3,69,0,112,0,2,255,241,255,238,5,18,4,250,0,25,0,37,0,0,
+1,33,17,33,53,33,21,35,17,35,17,33,17,35,17,35,34,38,53,52,54,54,51,50,22,
+21,1,50,22,21,20,6,35,34,38,53,52,54,1,126,2,41,252,74,5,33,198,165,253,215,
+165,36,52,54,69,107,43,42,46,1,20,49,64,62,51,50,63,64,2,229,1,131,146,146,
+251,152,2,84,253,172,2,84,41,37,46,109,77,58,56,253,192,65,52,53,64,65,52,
+52,65,0,0,1,255,241,255,216,4,156,4,250,0,53,0,0,37,22,23,7,38,39,6,35,34,
+38,39,22,23,7,38,39,55,22,22,51,50,54,53,52,38,39,6,35,34,53,52,51,50,23,
+54,54,53,52,39,33,53,33,21,35,22,21,20,6,7,22,22,21,20,6,3,107,70,70,152,
+59,78,69,77,123,136,50,69,53,153,84,103,75,119,204,116,159,160,119,114,125,
+102,229,179,148,149,82,82,4,252,176,4,171,182,5,81,90,116,107,90,220,85,104,
+71,106,111,11,29,23,92,97,67,176,170,116,58,52,84,84,72,103,26,24,116,104,
+54,34,121,87,37,24,146,146,37,26,104,149,50,49,140,98,87,127,255,255,255,
+241,255,58,4,176,4,250,2,34,0,38,0,0,0,7,0,50,3,20,0,194,0,3,0,79,0,160,4,
+26,4,250,0,12,0,24,0,25,0,0,1,50,0,21,20,0,35,34,0,53,52,54,54,19,50,54,53,
+52,38,35,34,6,21,20,22,19,2,51,220,1,11,254,248,221,223,254,249,120,222,139,
+152,170,169,145,150,171,167,143,4,109,254,245,221,221,254,248,1,10,222,140,
+222,123,252,200,181,160,153,181,185,157,153,180,3,197,0,2,0,123,255,238,4,
+20,5,14,0,23,0,37,0,0,1,6,35,34,38,53,52,54,51,50,22,22,21,17,20,22,22,51,
+7,34,46,2,53,17,53,52,38,38,35,34,6,21,20,22,51,50,54,2,216,106,139,164,196,
+209,173,142,181,65,29,62,60,20,82,109,70,35,56,102,72,100,109,102,92,76,118,
+2,160,62,182,158,148,196,111,139,130,253,174,89,72,28,149,42,75,115,104,2,
+12,81,89,87,48,105,91,91,103,40,0,3,0,88,255,220,4,2,5,14,0,31,0,32,0,33,
+0,0,1,22,23,7,38,39,6,35,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,7,39,
+54,51,50,4,21,20,6,37,1,2,169,215,130,118,209,216,31,42,138,138,82,76,128,
+126,129,139,179,168,173,148,58,183,209,237,1,8,155,254,96,2,86,1,101,147,
+138,108,209,134,4,67,68,50,55,73,40,186,127,156,166,69,133,85,248,218,162,
+246,29,254,173,0,2,0,92,255,121,3,226,5,14,0,54,0,55,0,0,5,38,39,6,35,34,
+38,53,52,54,51,50,23,54,54,53,52,38,39,6,35,34,38,53,52,54,51,50,22,23,54,
+54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,7,22,22,21,20,6,7,22,23,39,3,103,
+202,167,46,66,137,137,83,75,140,142,129,142,106,97,108,103,108,108,88,76,
+59,121,94,86,97,153,155,198,162,58,201,228,223,241,92,89,95,95,138,137,144,
+126,18,135,194,97,4,62,62,46,50,71,13,96,75,65,97,23,27,60,56,51,53,20,35,
+23,90,64,81,79,69,133,85,159,141,74,131,49,45,129,83,107,146,39,96,123,39,
+0,0,4,0,92,255,239,4,12,5,4,0,37,0,49,0,50,0,51,0,0,1,38,38,53,52,54,55,23,
+6,6,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,7,22,22,21,20,6,35,34,
+38,53,52,54,1,50,54,53,52,38,35,34,6,21,20,22,19,39,1,45,102,107,186,170,
+20,103,109,153,148,157,158,106,106,20,174,182,108,101,85,84,230,200,203,231,
+87,1,86,132,135,139,120,130,139,135,125,9,2,99,47,165,107,126,204,24,142,
+17,118,88,107,119,113,113,91,111,21,142,27,201,126,107,165,47,43,140,90,164,
+191,192,166,92,137,254,74,107,103,95,108,110,98,97,108,3,228,146,0,1,0,69,
+0,0,3,194,5,14,0,26,0,0,1,6,35,34,38,39,54,54,53,52,38,39,55,22,21,20,6,7,
+22,22,51,50,55,17,51,17,35,3,29,108,130,164,245,81,77,66,36,44,153,90,53,
+60,62,141,98,119,115,165,165,1,110,44,196,196,62,120,74,65,123,79,57,169,
+149,84,132,58,122,108,63,2,227,251,6,0,0,3,0,150,255,237,4,20,7,44,0,61,0,
+62,0,63,0,0,1,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,
+34,39,34,6,21,20,22,23,54,51,50,22,21,20,6,35,34,39,6,6,21,20,22,51,50,55,
+23,6,35,34,38,53,52,54,55,38,38,53,52,54,39,1,2,110,57,169,154,66,62,21,39,
+54,84,88,69,112,113,74,65,118,78,182,190,93,83,107,112,108,108,88,76,130,
+144,82,90,153,161,200,154,58,197,232,225,239,84,84,85,84,248,96,2,22,4,125,
+92,109,117,145,9,140,6,75,68,101,80,11,67,57,48,52,97,96,87,70,79,20,27,60,
+56,51,53,51,27,97,66,100,93,69,133,85,176,162,79,132,53,41,123,82,139,168,
+159,2,29,0,0,2,0,61,255,238,4,7,5,14,0,26,0,27,0,0,1,38,38,53,52,54,54,51,
+50,0,21,20,2,4,5,53,36,0,17,52,38,35,34,6,21,20,23,3,1,18,63,62,100,185,122,
+219,1,0,239,254,66,254,227,1,121,1,169,167,148,110,124,99,252,2,142,72,147,
+88,90,155,88,254,219,246,213,254,175,204,19,150,30,1,78,1,1,178,215,106,96,
+119,97,253,168,0,0,1,0,73,0,0,4,26,5,15,0,29,0,0,1,33,17,20,22,22,51,50,55,
+23,6,35,34,36,38,53,17,35,34,38,53,52,54,54,51,50,22,21,21,33,4,21,253,113,
+98,186,208,70,85,13,77,124,231,254,255,136,46,52,54,77,107,45,42,46,2,143,
+3,207,254,180,216,184,95,12,149,11,129,254,225,1,111,41,37,51,117,74,58,56,
+61,0,0,2,0,73,0,0,4,148,7,44,0,45,0,46,0,0,1,33,17,20,22,22,51,50,55,23,6,
+35,34,36,38,53,17,35,34,38,53,52,54,54,51,50,22,21,21,33,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,23,51,3,4,21,253,113,98,186,208,70,85,13,77,124,231,
+254,255,136,46,52,54,77,107,45,42,46,1,151,76,169,154,66,62,21,39,54,84,88,
+93,66,9,3,207,254,180,216,184,95,12,149,11,129,254,225,1,111,41,37,51,117,
+74,58,56,61,106,124,117,145,9,140,6,75,68,116,90,2,204,0,3,253,205,4,250,
+0,32,7,44,0,21,0,22,0,23,0,0,3,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,21,20,7,7,19,141,26,78,73,73,77,26,140,33,164,132,136,163,33,182,
+19,5,131,60,58,64,67,68,63,58,60,21,80,76,111,136,135,113,74,81,116,2,50,
+0,3,253,199,4,250,0,38,7,44,0,13,0,14,0,15,0,0,19,6,6,35,34,38,39,55,20,22,
+51,50,54,53,3,19,38,6,150,146,147,153,5,154,65,84,85,65,67,19,6,232,183,182,
+182,183,9,126,110,113,123,254,9,2,50,0,0,3,255,241,0,0,4,132,4,250,0,27,0,
+34,0,35,0,0,1,34,6,7,22,22,51,50,54,55,23,6,35,34,36,39,54,55,38,38,53,35,
+53,33,21,35,17,7,3,33,20,22,22,51,51,3,2,118,95,187,81,78,170,120,93,157,
+104,57,190,224,185,254,239,100,105,183,126,126,125,4,147,186,60,105,253,241,
+62,133,129,203,235,2,84,97,101,133,115,39,50,145,94,197,212,162,86,56,235,
+180,146,146,254,40,60,2,20,124,172,91,253,27,0,5,255,241,0,0,5,91,7,44,0,
+26,0,33,0,45,0,58,0,59,0,0,1,6,6,7,22,22,21,20,6,35,32,0,17,53,52,55,35,53,
+51,54,36,51,50,4,23,51,21,37,33,38,38,35,34,6,3,20,23,33,50,62,2,55,33,6,
+21,19,22,22,51,50,54,53,52,46,3,35,1,5,7,6,165,158,93,102,215,202,254,219,
+254,204,14,164,191,65,1,52,223,213,1,13,27,90,252,2,2,255,22,183,152,153,
+208,95,3,1,13,147,194,134,71,2,252,220,16,19,34,203,168,132,126,29,50,91,
+145,128,1,38,4,104,180,244,50,45,158,92,172,187,1,182,1,169,38,123,104,146,
+239,238,246,231,146,146,158,169,166,253,202,68,60,28,89,148,122,99,141,254,
+219,223,223,102,110,46,75,49,46,18,4,217,0,6,0,123,255,238,12,65,7,44,0,46,
+0,58,0,71,0,95,0,108,0,109,0,0,1,6,6,7,22,22,21,20,6,35,32,0,17,53,52,55,
+35,53,51,54,36,51,50,22,23,54,54,51,50,4,23,7,38,38,35,34,6,7,7,38,38,35,
+34,6,7,33,21,33,33,6,21,21,20,23,33,50,62,2,1,22,22,51,50,54,53,52,46,3,35,
+37,6,35,34,38,53,52,54,51,50,22,22,21,17,20,22,22,51,7,34,46,2,53,17,53,52,
+38,38,35,34,6,21,20,22,51,50,19,8,228,6,164,158,93,102,215,202,254,219,254,
+204,14,94,124,64,1,49,223,131,209,65,84,235,150,202,1,5,39,164,33,181,136,
+135,185,69,139,46,173,127,150,206,51,4,7,254,251,252,221,16,3,1,13,182,178,
+128,56,252,227,36,201,168,132,126,29,50,91,145,128,252,220,106,139,164,196,
+209,173,142,181,65,29,62,60,20,82,109,70,35,56,102,72,100,109,102,92,151,
+202,4,104,178,245,51,45,158,92,172,187,1,182,1,169,38,123,104,146,234,243,
+99,94,124,124,222,200,18,142,148,131,146,13,117,118,165,162,146,99,141,19,
+68,60,37,96,143,254,90,225,221,102,110,46,75,49,46,18,76,61,182,158,148,196,
+111,139,130,253,174,89,72,28,149,42,75,115,104,2,12,81,89,87,48,105,91,91,
+103,4,55,0,0,2,253,255,253,130,255,250,0,0,0,17,0,18,0,0,5,6,21,20,22,51,
+50,54,55,23,6,6,35,34,38,53,52,55,55,254,168,13,52,58,44,53,28,116,49,123,
+86,119,130,18,147,100,92,111,101,96,50,61,61,102,86,169,167,105,114,83,0,
+3,0,124,254,106,7,28,7,10,0,129,0,139,0,149,0,0,1,21,34,6,7,22,18,21,20,6,
+7,22,23,6,7,21,54,36,18,53,52,38,39,22,18,21,20,2,7,38,38,35,34,7,22,22,21,
+20,6,35,34,38,53,52,54,55,54,53,52,38,39,6,21,20,23,22,21,20,6,35,34,38,53,
+52,55,54,53,52,39,6,6,21,20,23,22,22,21,20,6,35,34,38,53,52,54,55,38,35,34,
+6,7,38,2,53,52,18,55,6,6,21,20,18,4,23,53,38,39,54,55,38,38,53,52,18,55,38,
+38,35,53,50,54,55,54,54,51,50,22,23,22,22,1,54,53,52,39,6,6,21,20,22,1,6,
+21,20,23,54,54,53,52,38,4,181,49,43,10,165,196,159,134,20,23,64,106,173,1,
+4,141,55,70,140,187,126,123,9,142,111,60,62,116,146,51,48,49,58,8,13,4,86,
+70,68,39,38,89,60,59,88,38,38,68,70,86,4,13,8,58,49,48,51,143,120,65,57,112,
+142,9,124,126,188,141,69,56,140,1,5,172,105,65,31,12,134,159,197,164,10,44,
+48,35,56,31,33,43,26,23,45,42,33,61,254,169,59,19,118,138,116,1,99,18,59,
+99,116,138,6,164,57,51,56,49,254,247,164,146,249,64,39,35,29,13,160,13,170,
+1,31,166,154,235,122,92,254,158,213,239,254,83,169,117,142,23,95,210,61,50,
+61,60,45,21,29,20,7,8,43,133,74,54,68,74,76,76,70,67,94,94,67,71,75,75,75,
+68,54,74,133,43,8,7,20,29,21,45,60,61,50,61,207,98,23,142,117,173,1,169,239,
+213,1,98,92,119,239,153,167,254,227,172,12,160,13,29,47,27,64,249,146,164,
+1,9,49,57,50,57,25,26,28,23,20,31,24,27,252,42,172,225,153,140,38,192,120,
+110,184,2,132,132,161,231,166,45,183,112,120,192,0,255,255,255,241,253,213,
+5,91,7,44,2,38,0,80,0,0,0,39,0,54,5,82,0,0,0,7,0,50,3,2,0,255,255,255,255,
+241,252,218,5,91,7,44,2,38,0,80,0,0,0,39,0,55,5,92,0,0,0,7,0,50,3,2,0,255,
+255,255,255,241,255,169,5,8,4,250,2,34,0,17,0,0,0,7,0,50,3,27,1,49,255,255,
+255,241,255,156,6,29,4,250,2,34,0,20,0,0,0,7,0,50,3,197,1,36,255,255,255,
+241,255,35,4,176,4,250,2,34,0,21,0,0,0,7,0,50,3,41,0,171,255,255,255,241,
+255,167,5,80,4,250,2,34,0,22,0,0,0,7,0,50,3,45,1,47,255,255,255,241,254,226,
+5,34,4,250,2,34,0,23,0,0,0,7,0,50,3,101,0,106,255,255,255,241,255,85,4,207,
+4,250,2,34,0,25,0,0,0,7,0,50,3,125,0,221,255,255,255,241,255,17,4,153,4,250,
+2,34,0,26,0,0,0,7,0,50,3,62,0,153,255,255,255,241,255,5,4,169,4,250,2,34,
+0,27,0,0,0,7,0,50,3,65,0,141,255,255,255,241,254,198,5,87,4,250,2,34,0,28,
+0,0,0,7,0,50,3,59,0,78,255,255,255,241,255,119,5,58,4,250,2,34,0,30,0,0,0,
+7,0,50,3,63,0,255,255,255,255,241,255,5,5,9,4,250,2,34,0,31,0,0,0,7,0,50,
+3,65,0,141,255,255,255,241,254,227,4,101,4,250,2,34,0,32,0,0,0,7,0,50,3,30,
+0,107,255,255,255,241,255,238,4,215,4,250,2,34,0,33,0,0,0,7,1,33,3,151,1,
+118,255,255,255,241,255,106,4,254,4,250,2,34,0,34,0,0,0,7,0,50,3,52,0,242,
+255,255,255,241,255,238,4,205,4,250,2,34,0,35,0,0,0,7,1,33,3,151,1,118,255,
+255,255,241,254,198,5,63,4,250,2,34,0,36,0,0,0,7,0,50,3,59,0,78,255,255,255,
+241,255,238,4,205,4,250,2,34,0,37,0,0,0,7,1,33,3,151,1,118,255,255,255,241,
+255,167,4,237,4,250,2,34,0,39,0,0,0,7,0,50,3,67,1,47,255,255,255,241,254,
+227,4,173,4,250,2,34,0,40,0,0,0,7,0,50,3,30,0,107,255,255,255,241,255,238,
+4,211,4,250,2,34,0,41,0,0,0,7,1,33,4,117,1,118,255,255,255,241,255,215,5,
+159,4,250,2,34,0,42,0,0,0,7,0,50,3,151,1,95,255,255,255,241,255,37,4,176,
+4,250,2,34,0,43,0,0,0,7,0,50,3,34,0,173,255,255,255,241,255,17,4,153,4,250,
+2,34,0,46,0,0,0,7,0,50,3,62,0,153,255,255,255,241,255,37,4,171,4,250,2,34,
+0,49,0,0,0,7,0,50,3,34,0,173,0,3,253,117,253,220,0,93,0,0,0,22,0,23,0,24,
+0,0,3,38,39,6,6,35,34,38,53,52,54,51,50,23,54,53,53,51,21,20,7,22,23,39,37,
+29,115,132,39,95,56,90,95,98,91,49,62,3,165,21,149,148,22,254,167,253,220,
+165,67,40,40,65,63,61,63,11,20,21,114,35,117,47,68,201,66,57,0,1,252,235,
+253,130,255,73,0,0,0,25,0,0,3,20,6,6,35,34,38,53,52,54,54,51,7,34,6,6,21,
+20,22,51,50,54,54,53,17,51,183,57,98,87,154,210,62,119,126,5,67,52,32,122,
+72,43,39,14,165,254,125,106,96,49,184,124,51,83,45,130,11,32,29,54,106,24,
+39,37,1,157,0,1,253,17,253,141,255,114,0,0,0,37,0,0,3,21,33,34,6,21,20,51,
+50,55,23,6,35,34,38,53,52,55,38,38,53,52,54,54,51,51,53,51,21,7,33,34,6,6,
+21,20,22,51,175,254,253,41,32,155,89,87,34,94,139,132,135,29,69,69,60,99,
+91,153,165,49,254,213,40,25,19,42,79,254,234,117,25,22,67,22,112,28,86,78,
+50,33,18,83,65,54,74,27,59,127,49,8,20,19,26,29,255,255,255,241,254,9,6,2,
+4,250,2,34,0,17,0,0,0,7,0,60,5,62,0,0,255,255,255,241,254,9,5,140,4,250,2,
+34,0,18,0,0,0,7,0,60,4,200,0,0,255,255,255,241,254,9,6,196,4,250,2,38,0,19,
+0,0,0,7,0,60,6,0,0,0,255,255,255,241,254,9,6,210,4,250,2,38,0,20,0,0,0,7,
+0,60,6,14,0,0,255,255,255,241,254,9,5,116,4,250,2,34,0,21,0,0,0,7,0,60,4,
+176,0,0,255,255,255,241,254,9,5,152,4,250,2,34,0,22,0,0,0,7,0,60,4,212,0,
+0,255,255,255,241,254,9,5,95,4,250,2,34,0,23,0,0,0,7,0,60,4,155,0,0,255,255,
+255,241,254,9,5,169,4,250,2,38,0,24,0,0,0,7,0,60,4,229,0,0,255,255,255,241,
+254,9,4,207,4,250,2,34,0,25,0,0,0,7,0,60,3,252,0,0,255,255,255,241,254,9,
+4,186,4,250,2,38,0,26,0,0,0,7,0,60,3,246,0,0,255,255,255,241,254,9,4,211,
+4,250,2,38,0,27,0,0,0,7,0,60,4,15,0,0,255,255,255,241,254,9,5,87,4,250,2,
+38,0,28,0,0,0,7,0,60,4,38,0,0,255,255,255,241,254,9,4,214,4,250,2,38,0,29,
+0,0,0,7,0,60,3,174,0,0,255,255,255,241,254,9,5,132,4,250,2,38,0,30,0,0,0,
+7,0,60,4,192,0,0,255,255,255,241,254,9,5,32,4,250,2,38,0,31,0,0,0,7,0,60,
+4,92,0,0,255,255,255,241,254,9,4,101,4,250,2,38,0,32,0,0,0,7,0,60,3,78,0,
+0,255,255,255,241,254,9,5,140,4,250,2,38,0,33,0,0,0,7,0,60,4,200,0,0,255,
+255,255,241,254,9,4,254,4,250,2,38,0,34,0,0,0,7,0,60,4,54,0,0,255,255,255,
+241,254,9,5,130,4,250,2,38,0,35,0,0,0,7,0,60,4,190,0,0,255,255,255,241,254,
+9,5,63,4,250,2,34,0,36,0,0,0,7,0,60,4,17,0,0,255,255,255,241,254,9,5,130,
+4,250,2,38,0,37,0,0,0,7,0,60,4,190,0,0,255,255,255,241,254,9,4,246,4,250,
+2,38,0,38,0,0,0,7,0,60,4,50,0,0,255,255,255,241,254,9,5,162,4,250,2,38,0,
+39,0,0,0,7,0,60,4,222,0,0,255,255,255,241,254,9,4,173,4,250,2,38,0,40,0,0,
+0,7,0,60,3,158,0,0,255,255,255,241,254,9,5,136,4,250,2,38,0,41,0,0,0,7,0,
+60,4,196,0,0,255,255,255,241,254,9,6,84,4,250,2,38,0,42,0,0,0,7,0,60,5,144,
+0,0,255,255,255,241,254,9,4,248,4,250,2,38,0,43,0,0,0,7,0,60,4,52,0,0,255,
+255,255,241,254,9,5,115,4,250,2,38,0,44,0,0,0,7,0,60,4,58,0,0,255,255,255,
+241,254,9,4,186,4,250,2,38,0,46,0,0,0,7,0,60,3,246,0,0,255,255,255,241,254,
+9,5,136,4,250,2,38,0,48,0,0,0,7,0,60,4,196,0,0,255,255,255,241,254,9,4,243,
+4,250,2,38,0,49,0,0,0,7,0,60,4,47,0,0,255,255,255,241,254,9,6,2,4,250,2,34,
+0,17,0,0,0,39,0,60,5,62,0,0,0,7,0,50,3,27,1,49,255,255,255,241,254,9,5,140,
+4,250,2,34,0,18,0,0,0,39,0,60,4,200,0,0,0,7,1,33,3,151,1,118,255,255,255,
+241,254,9,6,196,4,250,2,38,0,19,0,0,0,39,0,60,6,0,0,0,0,7,0,50,3,69,0,112,
+255,255,255,241,254,9,6,210,4,250,2,38,0,20,0,0,0,39,0,60,6,14,0,0,0,7,0,
+50,3,197,1,36,255,255,255,241,254,9,5,116,4,250,2,34,0,21,0,0,0,39,0,60,4,
+176,0,0,0,7,0,50,3,41,0,171,255,255,255,241,254,9,5,152,4,250,2,34,0,22,0,
+0,0,39,0,60,4,212,0,0,0,7,0,50,3,45,1,47,255,255,255,241,254,9,5,95,4,250,
+2,34,0,23,0,0,0,39,0,60,4,155,0,0,0,7,0,50,3,101,0,106,255,255,255,241,254,
+9,5,199,4,250,2,38,0,64,0,0,0,7,0,60,5,3,0,0,255,255,255,241,254,9,4,207,
+4,250,2,34,0,25,0,0,0,39,0,60,3,252,0,0,0,7,0,50,3,125,0,221,255,255,255,
+241,254,9,4,186,4,250,2,38,0,26,0,0,0,39,0,60,3,246,0,0,0,7,0,50,3,62,0,153,
+255,255,255,241,254,9,4,211,4,250,2,38,0,27,0,0,0,39,0,60,4,15,0,0,0,7,0,
+50,3,65,0,141,255,255,255,241,254,9,5,87,4,250,2,38,0,28,0,0,0,39,0,60,4,
+38,0,0,0,7,0,50,3,59,0,78,255,255,255,241,254,9,4,227,4,250,2,38,0,65,0,0,
+0,7,0,60,4,31,0,0,255,255,255,241,254,9,5,132,4,250,2,38,0,30,0,0,0,39,0,
+60,4,192,0,0,0,7,0,50,3,63,0,255,255,255,255,241,254,9,5,32,4,250,2,38,0,
+31,0,0,0,39,0,60,4,92,0,0,0,7,0,50,3,65,0,141,255,255,255,241,254,9,4,101,
+4,250,2,38,0,32,0,0,0,39,0,60,3,78,0,0,0,7,0,50,3,30,0,107,255,255,255,241,
+254,9,5,140,4,250,2,38,0,33,0,0,0,39,0,60,4,200,0,0,0,7,1,33,3,151,1,118,
+255,255,255,241,254,9,4,254,4,250,2,38,0,34,0,0,0,39,0,60,4,54,0,0,0,7,0,
+50,3,52,0,242,255,255,255,241,254,9,5,130,4,250,2,38,0,35,0,0,0,39,0,60,4,
+190,0,0,0,7,1,33,3,151,1,118,255,255,255,241,254,9,5,63,4,250,2,34,0,36,0,
+0,0,39,0,60,4,17,0,0,0,7,0,50,3,59,0,78,255,255,255,241,254,9,5,130,4,250,
+2,38,0,37,0,0,0,39,0,60,4,190,0,0,0,7,1,33,3,151,1,118,255,255,255,241,254,
+9,4,246,4,250,2,38,0,38,0,0,0,39,0,60,4,50,0,0,0,7,0,50,3,20,0,194,255,255,
+255,241,254,9,5,162,4,250,2,38,0,39,0,0,0,39,0,60,4,222,0,0,0,7,0,50,3,67,
+1,47,255,255,255,241,254,9,4,173,4,250,2,38,0,40,0,0,0,39,0,60,3,158,0,0,
+0,7,0,50,3,30,0,107,255,255,255,241,254,9,5,136,4,250,2,38,0,41,0,0,0,39,
+0,60,4,196,0,0,0,7,1,33,4,117,1,118,255,255,255,241,254,9,6,84,4,250,2,38,
+0,42,0,0,0,39,0,60,5,144,0,0,0,7,0,50,3,151,1,95,255,255,255,241,254,9,4,
+248,4,250,2,38,0,43,0,0,0,39,0,60,4,52,0,0,0,7,0,50,3,34,0,173,255,255,255,
+241,254,9,5,115,4,250,2,38,0,44,0,0,0,39,0,60,4,58,0,0,0,7,0,50,3,59,0,78,
+255,255,255,241,254,9,4,186,4,250,2,38,0,46,0,0,0,39,0,60,3,246,0,0,0,7,0,
+50,3,62,0,153,255,255,255,241,254,9,5,151,4,250,2,38,0,47,0,0,0,7,0,60,4,
+211,0,0,255,255,255,241,254,9,4,243,4,250,2,38,0,49,0,0,0,39,0,60,4,47,0,
+0,0,7,0,50,3,34,0,173,0,1,255,241,0,0,5,98,4,250,0,24,0,0,1,33,17,6,35,34,
+38,39,55,30,2,51,50,55,17,33,17,33,53,33,21,35,17,35,3,247,254,246,97,115,
+167,230,112,146,71,115,108,74,18,24,1,175,251,250,5,113,198,165,2,101,254,
+178,33,185,224,69,147,136,45,4,1,103,1,113,146,146,251,152,0,4,253,117,252,
+218,0,169,0,0,0,21,0,34,0,35,0,36,0,0,3,38,39,6,35,34,38,53,52,54,51,50,23,
+54,53,53,51,21,20,7,22,23,3,38,38,35,35,34,7,39,54,51,50,4,23,3,37,29,115,
+132,78,112,90,95,98,91,49,62,3,165,21,149,148,61,62,200,158,37,12,8,9,18,
+33,207,1,29,80,98,254,157,254,25,165,67,80,65,63,61,63,11,20,21,53,3,72,63,
+68,201,254,113,114,114,1,155,2,168,169,1,162,57,0,2,252,235,252,218,1,105,
+0,0,0,25,0,39,0,0,3,20,6,6,35,34,38,53,52,54,54,51,7,34,6,6,21,20,22,51,50,
+54,54,53,17,51,1,46,2,35,35,34,7,39,54,51,50,22,23,183,57,98,87,154,210,62,
+119,126,5,67,52,32,122,72,43,39,14,165,1,146,37,99,120,86,35,16,7,9,18,31,
+194,240,68,254,175,106,96,49,184,124,51,83,45,130,11,32,29,54,106,24,39,37,
+1,107,252,218,80,91,37,1,155,2,160,161,0,2,252,193,252,218,1,68,255,236,0,
+38,0,52,0,0,1,21,35,34,6,6,21,20,51,50,55,23,6,35,34,38,53,52,55,38,38,53,
+52,54,54,51,51,53,51,21,7,33,34,6,6,21,20,22,51,1,46,2,35,35,34,7,39,54,51,
+50,22,23,254,217,190,46,34,22,136,78,77,34,90,124,122,124,29,69,69,60,99,
+91,113,165,49,254,253,40,25,19,42,79,2,244,37,99,120,86,35,16,7,9,18,31,194,
+240,68,254,234,117,5,24,18,67,22,112,28,86,78,50,33,18,83,65,54,74,27,39,
+107,49,8,20,19,26,29,253,240,80,91,37,1,155,2,160,161,0,0,2,254,149,252,218,
+0,188,255,197,0,8,0,22,0,0,7,22,22,23,7,46,2,39,1,46,2,35,35,34,7,39,54,51,
+50,22,23,202,56,141,153,35,115,156,134,51,1,133,37,99,120,86,35,16,7,9,18,
+31,196,240,66,59,141,135,16,147,20,73,159,141,253,67,80,91,37,1,155,2,163,
+158,0,1,253,235,252,218,1,122,255,204,0,30,0,0,5,6,21,20,22,51,50,54,55,23,
+6,7,22,22,23,7,46,2,35,35,34,7,39,6,35,34,38,53,52,55,254,145,10,54,56,43,
+56,26,116,44,47,192,237,66,142,37,99,120,86,35,16,7,7,50,63,117,132,15,69,
+51,82,86,74,52,59,61,91,39,1,163,157,43,80,91,37,1,122,23,144,140,81,83,0,
+5,252,7,252,218,0,93,0,0,0,21,0,35,0,36,0,37,0,38,0,0,3,38,39,6,35,34,38,
+53,52,54,51,50,23,54,53,53,51,21,20,7,22,23,5,55,22,22,51,50,54,55,23,6,6,
+35,34,38,5,1,37,29,115,132,78,112,90,95,98,91,49,62,3,165,21,149,148,251,
+170,29,89,175,99,99,175,90,29,82,205,106,106,203,2,74,1,163,254,167,253,220,
+165,67,80,65,63,61,63,11,20,21,114,64,72,63,68,201,114,138,51,46,46,51,138,
+51,54,54,173,1,148,57,0,2,252,7,252,218,255,73,0,0,0,25,0,39,0,0,3,20,6,6,
+35,34,38,53,52,54,54,51,7,34,6,6,21,20,22,51,50,54,54,53,17,51,1,55,22,22,
+51,50,54,55,23,6,6,35,34,38,183,57,98,87,154,210,62,119,126,5,67,52,32,122,
+72,43,39,14,165,252,190,29,89,175,99,99,175,90,29,82,205,106,106,203,254,
+175,106,96,49,184,124,51,83,45,130,11,32,29,54,106,24,39,37,1,107,253,67,
+138,51,46,46,51,138,51,54,54,0,2,251,223,252,218,255,114,0,0,0,48,0,49,0,
+0,3,21,33,34,6,21,20,51,50,55,23,6,7,23,6,35,34,39,55,22,22,51,50,55,38,38,
+53,52,55,38,38,53,52,54,54,51,51,53,51,21,7,33,34,6,6,21,20,22,51,19,175,
+254,253,41,32,155,89,87,34,74,97,16,166,214,214,166,29,93,161,97,125,103,
+93,100,29,69,69,60,99,91,153,165,49,254,213,40,25,19,42,79,119,254,234,117,
+25,22,67,22,112,22,4,76,105,105,138,55,42,37,11,82,67,50,33,18,83,65,54,74,
+27,59,127,49,8,20,19,26,29,254,163,0,0,3,252,7,252,218,0,241,255,195,0,10,
+0,24,0,25,0,0,7,22,22,51,51,50,55,7,34,0,3,1,55,22,22,51,50,54,55,23,6,6,
+35,34,38,23,200,50,194,164,17,7,9,18,224,254,232,66,253,98,29,89,175,99,99,
+175,90,29,82,205,106,106,203,234,61,211,210,1,157,1,8,1,12,254,37,138,51,
+46,46,51,138,51,54,54,174,0,0,2,252,7,252,218,255,250,255,204,0,17,0,31,0,
+0,5,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,1,6,6,35,34,38,39,55,
+22,22,51,50,54,55,254,165,10,53,57,44,53,28,116,49,123,86,117,132,15,1,10,
+82,205,106,106,203,83,29,89,175,99,99,175,90,69,59,96,101,85,50,61,61,102,
+86,160,154,91,91,253,119,51,54,54,51,138,51,46,46,51,0,0,5,252,7,252,218,
+0,93,0,0,0,21,0,35,0,49,0,50,0,51,0,0,3,38,39,6,35,34,38,53,52,54,51,50,23,
+54,53,53,51,21,20,7,22,23,5,6,6,35,34,38,39,55,22,22,51,50,54,55,19,6,6,35,
+34,38,39,55,22,22,51,50,54,55,37,37,29,115,132,78,112,90,95,98,91,49,62,3,
+165,21,149,148,254,187,82,205,106,106,204,82,29,90,174,99,100,173,91,29,83,
+204,106,106,203,83,29,90,174,99,100,172,92,1,76,254,167,254,25,165,67,80,
+65,63,61,63,11,20,21,53,10,65,63,68,201,58,51,54,54,51,125,52,45,45,52,254,
+151,51,54,54,51,126,52,45,45,52,234,57,0,2,251,205,252,218,255,73,0,0,0,37,
+0,51,0,0,1,55,22,51,39,38,38,53,52,54,54,51,7,34,6,6,21,20,22,51,50,54,54,
+53,17,51,17,20,6,6,35,34,39,35,6,35,34,38,7,55,22,22,51,50,54,55,23,6,6,35,
+34,38,251,205,29,168,185,18,32,46,62,119,126,5,67,52,32,122,72,43,39,14,165,
+57,98,87,7,7,15,111,118,106,204,82,29,90,174,99,100,172,92,29,83,204,106,
+106,203,254,47,125,97,17,31,100,59,51,83,45,130,11,32,29,54,106,24,39,37,
+1,57,254,225,106,96,49,1,33,54,185,126,52,45,45,52,126,51,54,54,0,0,2,251,
+197,252,218,255,114,0,0,0,60,0,61,0,0,1,55,22,22,51,50,55,54,55,38,38,53,
+52,54,54,51,51,53,51,21,7,33,34,6,6,21,20,22,51,33,21,35,34,6,21,20,51,50,
+55,23,6,7,23,6,6,35,34,38,39,55,22,22,51,50,55,38,39,6,35,34,38,5,251,197,
+29,90,174,99,50,42,8,18,69,69,60,99,91,113,165,49,254,253,40,25,19,42,79,
+1,23,219,41,32,136,78,77,34,68,105,17,83,204,106,106,203,83,29,90,174,99,
+147,120,92,49,67,59,106,204,2,123,254,47,125,52,45,5,30,22,18,83,65,54,74,
+27,59,127,49,8,20,19,26,29,117,25,22,67,22,112,23,4,75,51,54,54,51,126,52,
+45,49,12,51,10,54,111,0,0,3,252,49,252,218,0,148,255,197,0,8,0,22,0,36,0,
+0,7,22,22,23,7,46,2,39,1,55,22,22,51,50,54,55,23,6,6,35,34,38,7,55,22,22,
+51,50,54,55,23,6,6,35,34,38,202,57,141,152,35,143,161,114,38,253,136,29,90,
+174,99,100,173,91,29,82,205,106,106,204,82,29,90,174,99,100,172,92,29,83,
+204,106,106,203,59,142,135,15,147,25,95,164,109,254,152,125,52,45,45,52,125,
+51,54,54,185,126,52,45,45,52,126,51,54,54,0,2,251,200,252,218,0,44,255,204,
+0,30,0,44,0,0,1,55,22,22,51,50,55,38,53,52,55,23,6,21,20,22,51,50,54,55,23,
+6,6,35,34,39,6,6,35,34,38,7,55,22,22,51,50,54,55,23,6,6,35,34,38,251,200,
+29,90,174,99,141,122,38,15,151,10,54,56,43,56,26,116,49,123,86,57,50,77,191,
+99,106,204,82,29,90,174,99,100,172,92,29,83,204,106,106,203,254,47,125,52,
+45,48,68,105,81,83,17,51,82,86,74,52,59,61,102,86,20,43,47,54,185,126,52,
+45,45,52,126,51,54,54,0,0,5,255,241,253,220,5,161,4,250,0,53,0,65,0,66,0,
+67,0,68,0,0,33,52,2,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,39,33,53,
+33,21,35,22,22,21,20,7,22,18,23,21,20,7,22,23,7,38,39,6,6,35,34,38,53,52,
+54,51,50,23,54,53,3,38,38,35,34,6,21,20,22,51,50,54,1,19,5,3,232,39,45,85,
+227,134,185,213,224,176,135,212,86,26,20,252,98,5,23,211,6,13,85,62,77,14,
+20,149,148,122,115,132,39,95,56,90,95,98,91,49,62,3,152,74,181,108,115,130,
+124,107,120,188,1,15,34,1,79,37,1,0,118,109,109,190,165,163,193,95,99,94,
+134,91,99,146,146,28,121,40,214,164,108,254,232,173,32,109,58,68,201,80,165,
+67,40,40,65,63,61,63,11,20,21,2,157,101,102,111,100,97,111,108,3,59,249,173,
+57,0,0,5,253,117,253,220,0,101,0,146,0,22,0,23,0,24,0,25,0,26,0,0,3,38,39,
+6,6,35,34,38,53,52,54,51,50,23,54,53,53,55,21,20,7,22,23,9,2,19,29,115,132,
+39,95,56,90,95,98,91,49,62,3,160,16,149,148,254,71,1,193,254,63,94,253,220,
+165,67,40,40,65,63,61,63,11,20,21,204,40,165,111,53,68,201,1,212,254,110,
+2,36,254,21,0,3,252,235,253,130,255,68,0,146,0,25,0,26,0,27,0,0,3,20,6,6,
+35,34,38,53,52,54,54,51,7,34,6,6,21,20,22,51,50,54,54,53,17,55,7,53,188,46,
+100,91,154,210,62,119,126,5,67,52,32,122,72,43,39,14,160,160,254,125,96,97,
+58,184,124,51,83,45,130,11,32,29,54,106,24,39,37,1,247,4,94,146,0,3,253,17,
+253,141,255,114,0,146,0,37,0,38,0,39,0,0,3,21,33,34,6,21,20,51,50,55,23,6,
+35,34,38,53,52,55,38,38,53,52,54,54,51,51,53,55,17,7,33,34,6,6,21,20,22,51,
+19,53,175,254,253,41,32,155,89,87,34,94,139,132,135,29,69,69,60,99,91,158,
+160,49,254,213,40,25,19,42,79,146,254,234,117,25,22,67,22,112,28,86,78,50,
+33,18,83,65,54,74,27,149,40,254,255,49,8,20,19,26,29,1,22,146,0,7,255,241,
+252,218,5,63,7,44,0,34,0,35,0,57,0,58,0,72,0,86,0,87,0,0,1,6,6,21,20,22,51,
+7,34,38,38,53,52,0,55,53,33,53,33,21,33,21,22,0,21,20,6,6,35,39,50,54,53,
+52,38,39,19,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,7,3,
+1,55,22,22,51,50,54,55,23,6,6,35,34,38,7,55,22,22,51,50,54,55,23,6,6,35,34,
+38,1,2,152,204,216,132,125,10,131,184,96,1,5,241,253,171,5,78,253,171,242,
+1,4,93,185,133,10,125,132,216,206,126,26,78,73,73,77,26,140,33,164,132,136,
+163,33,163,254,18,29,90,174,99,100,173,91,29,82,205,106,106,204,82,29,90,
+174,99,100,172,92,29,83,204,106,106,203,1,68,3,7,52,196,128,122,128,149,102,
+187,108,170,1,11,64,230,146,146,230,64,254,245,170,106,186,105,149,128,122,
+128,196,29,2,147,60,58,64,67,68,63,58,60,21,80,76,111,136,135,113,74,81,1,
+190,247,253,125,52,45,45,52,125,51,54,54,217,126,52,45,45,52,126,51,54,54,
+254,240,255,255,255,241,253,220,4,176,4,250,2,34,0,38,0,0,0,39,1,17,4,211,
+0,0,0,7,0,50,3,20,0,194,255,255,255,241,253,42,4,176,4,250,2,34,0,38,0,0,
+0,39,0,214,4,211,0,80,0,7,0,50,3,20,0,194,255,255,255,241,0,0,6,191,7,44,
+2,34,0,10,0,0,0,7,1,34,7,88,0,0,255,255,255,241,253,213,5,158,7,44,2,38,0,
+80,0,0,0,39,0,54,5,32,0,0,0,7,1,34,6,55,0,0,255,255,255,241,252,218,5,158,
+7,44,2,38,0,80,0,0,0,39,0,55,5,32,0,0,0,7,1,34,6,55,0,0,255,255,255,241,0,
+0,4,132,7,44,2,34,0,79,0,0,0,7,0,206,4,117,0,0,255,255,255,241,0,0,5,255,
+7,44,2,34,0,7,0,0,0,7,0,207,5,240,0,0,0,6,255,241,0,0,5,91,7,44,0,32,0,44,
+0,57,0,69,0,70,0,71,0,0,1,6,6,7,22,22,21,20,6,35,32,0,17,53,52,55,35,53,51,
+62,3,51,51,7,35,34,6,6,7,33,21,35,33,6,21,21,20,23,33,50,62,2,1,22,22,51,
+50,54,53,52,46,3,35,1,50,22,21,20,6,35,34,38,53,52,54,1,19,5,6,12,165,152,
+94,102,215,202,254,219,254,204,14,164,192,38,135,184,224,171,138,10,108,235,
+209,124,33,3,255,249,252,219,14,3,1,13,187,173,118,65,252,228,34,203,168,
+132,126,29,50,91,145,128,2,155,49,64,62,51,50,63,64,254,36,152,4,104,188,
+237,49,45,157,93,172,187,1,182,1,169,38,124,103,146,139,178,100,36,146,63,
+137,107,146,97,143,19,68,60,40,88,145,254,93,223,223,102,110,46,75,49,46,
+18,3,247,65,52,53,64,65,52,52,65,249,182,7,44,255,255,255,241,0,0,6,135,7,
+44,2,34,0,7,0,0,0,7,0,209,5,240,0,0,255,255,254,140,0,0,2,74,7,44,2,34,0,
+53,0,0,0,7,1,34,2,227,0,0,0,3,252,209,4,235,255,191,7,44,0,12,0,24,0,25,0,
+0,1,38,38,35,35,34,7,39,54,51,50,0,19,19,50,22,21,20,6,35,34,38,53,52,54,
+19,254,171,49,194,165,37,12,8,9,18,33,233,1,28,63,6,49,64,62,51,50,63,64,
+44,4,235,208,213,1,155,2,254,226,254,221,2,65,65,52,53,64,65,52,52,65,253,
+206,0,0,3,252,209,4,158,255,215,7,44,0,27,0,39,0,40,0,0,1,38,38,35,35,34,
+7,39,54,51,50,22,23,38,38,35,35,34,7,39,54,51,50,0,19,7,22,23,19,50,22,21,
+20,6,35,34,38,53,52,54,19,254,187,68,205,167,20,11,9,10,20,22,146,225,79,
+56,193,164,15,8,7,9,18,21,238,1,15,57,85,8,7,86,49,64,62,51,50,63,64,20,4,
+158,113,110,1,150,2,101,100,168,161,1,151,2,254,230,254,217,7,14,14,2,100,
+65,52,53,64,65,52,52,65,253,206,0,0,3,252,58,4,235,255,181,7,44,0,21,0,33,
+0,34,0,0,1,38,38,35,34,7,6,35,34,38,39,55,22,22,51,50,55,54,51,50,22,23,19,
+50,22,21,20,6,35,34,38,53,52,54,19,254,167,11,71,77,20,53,53,26,126,143,41,
+146,42,73,65,26,50,49,27,143,145,5,7,49,64,62,51,50,63,64,54,4,235,127,108,
+5,6,156,158,39,134,73,5,5,187,193,2,65,65,52,53,64,65,52,52,65,253,206,0,
+3,252,11,4,250,0,151,7,44,0,34,0,46,0,47,0,0,1,54,53,52,38,35,34,6,21,20,
+23,7,38,53,52,55,6,35,34,38,39,55,22,22,51,50,54,55,54,51,50,22,21,20,7,19,
+50,22,21,20,6,35,34,38,53,52,54,3,254,237,26,72,67,67,71,26,140,33,1,21,22,
+128,142,28,146,23,65,72,36,50,35,79,118,130,157,33,173,49,64,62,51,50,63,
+64,172,5,131,60,58,64,67,69,62,58,60,21,80,76,11,11,4,122,111,39,75,64,12,
+22,62,134,114,74,81,1,190,65,52,53,64,65,52,52,65,253,206,0,255,255,255,241,
+253,213,5,158,7,44,2,38,0,80,0,0,0,39,0,54,5,82,0,0,0,39,0,50,3,2,0,255,0,
+7,1,34,6,55,0,0,255,255,255,241,252,218,5,158,7,44,2,38,0,80,0,0,0,39,0,55,
+5,92,0,0,0,39,0,50,3,2,0,255,0,7,1,34,6,55,0,0,0,3,255,241,4,104,2,160,7,
+44,0,13,0,17,0,18,0,0,1,6,6,35,34,38,39,55,20,22,51,50,54,53,1,53,33,21,3,
+2,160,6,151,145,148,152,5,154,65,84,85,65,253,235,1,218,103,6,232,183,182,
+182,183,9,126,110,113,123,253,119,146,146,2,196,0,2,252,7,252,218,255,24,
+254,168,0,13,0,14,0,0,1,55,22,22,51,50,54,55,23,6,6,35,34,38,1,252,7,29,89,
+175,99,99,175,90,29,82,205,106,106,203,1,38,254,30,138,51,46,46,51,138,51,
+54,54,254,239,0,0,2,252,7,252,218,255,24,254,204,0,13,0,27,0,0,1,55,22,22,
+51,50,54,55,23,6,6,35,34,38,7,55,22,22,51,50,54,55,23,6,6,35,34,38,252,7,
+29,90,174,99,100,173,91,29,82,205,106,106,204,82,29,90,174,99,100,172,92,
+29,83,204,106,106,203,254,79,125,52,45,45,52,125,51,54,54,217,126,52,45,45,
+52,126,51,54,54,0,2,252,128,4,235,255,73,7,44,0,21,0,22,0,0,1,38,38,35,34,
+7,6,35,34,38,39,55,22,22,51,50,55,54,51,50,22,23,55,254,167,16,61,67,16,45,
+44,28,107,128,39,146,30,61,51,38,44,44,17,126,135,9,12,4,235,134,101,5,6,
+160,154,39,114,93,5,5,190,190,15,0,0,3,252,128,4,235,255,181,7,44,0,21,0,
+33,0,34,0,0,1,38,38,35,34,7,6,35,34,38,39,55,22,22,51,50,55,54,51,50,22,23,
+19,50,22,21,20,6,35,34,38,53,52,54,19,254,167,16,61,67,16,45,44,28,107,128,
+39,146,30,61,51,38,44,44,17,126,135,9,7,49,64,62,51,50,63,64,54,4,235,134,
+101,5,6,160,154,39,114,93,5,5,190,190,2,65,65,52,53,64,65,52,52,65,253,206,
+0,2,1,43,255,227,2,41,5,182,0,3,0,15,0,0,1,35,3,51,3,50,22,21,20,6,35,34,
+38,53,52,54,1,232,121,51,223,113,61,66,67,60,60,67,66,1,158,4,24,251,68,71,
+68,67,73,74,66,67,72,0,0,4,0,235,3,197,3,54,7,44,0,3,0,7,0,8,0,9,0,0,1,3,
+35,3,33,3,35,3,7,19,1,206,51,125,51,2,75,51,124,51,86,46,5,213,253,240,2,
+16,253,240,2,16,219,2,50,0,0,2,0,70,0,0,4,243,5,15,0,27,0,31,0,0,1,3,33,21,
+33,3,35,19,33,3,35,19,35,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,
+19,33,3,215,59,1,16,254,213,69,144,71,254,227,70,141,66,255,1,25,62,254,243,
+1,37,68,144,67,1,31,69,141,69,1,1,252,252,1,30,60,254,227,3,39,254,201,135,
+254,151,1,105,254,151,1,105,135,1,55,134,1,98,254,158,1,98,254,158,134,254,
+201,1,55,0,5,0,117,255,236,6,42,5,14,0,11,0,23,0,27,0,39,0,51,0,0,1,34,38,
+53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,1,35,1,19,
+34,38,53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,157,
+142,154,148,148,145,156,151,150,76,77,77,76,78,70,70,3,221,252,235,160,3,
+23,112,143,153,148,148,146,154,153,147,76,77,77,76,78,70,70,2,42,191,180,
+184,185,190,179,184,187,131,120,120,120,120,120,120,120,120,2,77,251,6,4,
+250,250,242,194,177,184,185,190,179,187,184,132,119,120,120,120,119,121,120,
+119,0,3,0,235,3,197,1,231,7,44,0,3,0,4,0,5,0,0,1,3,35,3,23,3,1,206,51,125,
+51,252,7,5,213,253,240,2,16,219,2,50,0,4,0,140,253,213,2,179,7,44,0,12,0,
+13,0,14,0,15,0,0,1,51,0,17,16,18,23,35,38,2,17,16,18,23,19,3,1,180,166,254,
+225,146,143,168,143,153,153,213,185,191,6,167,254,56,253,210,254,233,253,
+241,221,197,2,18,1,46,1,48,2,3,236,2,50,246,169,0,0,4,0,120,253,213,2,72,
+7,44,0,12,0,13,0,14,0,15,0,0,1,35,0,17,16,2,39,51,22,18,17,16,2,3,19,19,1,
+32,166,1,31,146,143,168,143,153,153,216,6,129,254,174,1,200,2,46,1,23,2,15,
+221,197,253,238,254,210,254,208,253,253,7,189,253,206,248,219,0,3,0,150,2,
+88,4,88,7,44,0,14,0,15,0,16,0,0,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,7,3,
+2,220,43,1,141,26,254,134,245,178,176,158,184,242,254,137,29,1,135,43,74,
+5,5,245,254,119,111,193,28,254,186,96,1,102,254,154,96,1,70,28,193,111,1,
+137,251,2,50,0,2,0,102,0,199,4,2,4,250,0,11,0,12,0,0,1,33,53,33,17,51,17,
+33,21,33,17,35,3,1,233,254,125,1,131,150,1,131,254,125,150,36,2,73,150,1,
+132,254,124,150,254,126,4,51,0,3,0,63,254,248,1,158,0,250,0,6,0,7,0,8,0,0,
+37,23,6,3,35,18,55,55,17,1,106,15,51,125,138,67,34,250,238,23,197,254,230,
+1,23,223,12,254,233,0,0,2,0,100,2,12,2,84,4,250,0,3,0,4,0,0,19,53,33,21,3,
+100,1,240,143,2,12,168,168,2,238,0,0,1,0,147,255,227,1,145,0,250,0,11,0,0,
+37,50,22,21,20,6,35,34,38,53,52,54,1,18,61,66,67,60,60,67,66,250,71,68,67,
+73,74,66,67,72,0,4,0,86,253,220,3,25,7,44,0,3,0,4,0,5,0,6,0,0,1,1,35,1,3,
+3,19,3,25,253,231,170,2,27,172,5,31,6,169,248,4,7,252,254,81,2,50,246,176,
+0,0,2,0,98,255,236,4,8,5,205,0,11,0,23,0,0,5,34,2,17,16,18,51,50,18,17,16,
+2,39,50,18,17,16,2,35,34,2,17,16,18,2,51,229,236,229,236,232,237,232,237,
+147,138,138,147,148,132,133,20,1,131,1,110,1,126,1,114,254,125,254,147,254,
+128,254,143,155,1,25,1,61,1,59,1,25,254,230,254,198,254,197,254,229,0,0,1,
+0,178,0,0,2,199,5,182,0,10,0,0,33,35,17,52,55,6,7,7,39,1,51,2,199,176,8,39,
+82,148,96,1,127,150,3,145,123,238,43,70,121,123,1,43,0,1,0,96,0,0,3,240,5,
+203,0,28,0,0,33,33,53,1,62,4,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,6,
+7,1,21,33,3,240,252,112,1,94,118,86,64,36,16,128,108,95,153,69,102,191,230,
+194,224,72,128,150,254,231,2,177,156,1,125,128,102,102,89,82,45,114,130,77,
+60,119,172,212,179,96,183,178,162,254,213,8,0,1,0,82,255,236,3,238,5,203,
+0,40,0,0,1,21,22,22,21,20,4,33,34,39,53,22,22,51,50,54,53,52,38,35,35,53,
+51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,2,133,177,184,254,236,
+254,251,242,145,87,203,93,173,181,192,189,133,133,160,176,136,114,107,163,
+74,92,89,225,122,206,231,164,3,2,6,22,181,145,203,233,79,170,46,50,144,145,
+127,131,151,152,125,102,119,67,54,125,72,78,198,165,138,185,0,2,0,23,0,0,
+4,63,5,190,0,10,0,20,0,0,1,35,17,35,17,33,53,1,51,17,51,33,17,52,55,55,35,
+6,6,7,1,4,63,213,176,253,93,2,151,188,213,254,123,10,3,9,17,54,19,254,101,
+1,72,254,184,1,72,159,3,215,252,48,1,100,153,194,85,49,103,28,253,160,0,1,
+0,131,255,236,3,246,5,182,0,28,0,0,55,53,22,22,51,50,54,53,52,38,35,34,7,
+39,19,33,21,33,3,54,51,50,4,21,20,4,35,34,38,131,65,208,88,167,168,176,168,
+89,142,90,55,2,178,253,236,39,107,102,210,1,3,254,236,251,103,188,59,172,
+45,51,162,152,143,151,26,57,2,176,166,254,93,20,229,199,234,255,40,0,0,2,
+0,113,255,236,4,10,5,203,0,24,0,38,0,0,1,21,38,35,34,2,3,51,54,54,51,50,22,
+21,20,2,35,34,38,2,53,16,0,33,50,19,52,38,35,34,6,6,21,20,22,22,51,50,54,
+3,156,71,95,224,225,10,12,48,157,102,195,221,241,203,133,215,129,1,64,1,63,
+104,2,137,127,86,141,72,63,136,94,126,144,5,184,155,24,254,230,254,206,86,
+84,238,206,228,254,249,136,1,38,215,1,180,1,166,252,12,145,156,80,123,63,
+88,170,115,172,0,0,1,0,90,0,0,4,6,5,182,0,6,0,0,33,1,33,53,33,21,1,1,25,2,
+51,253,14,3,172,253,213,5,16,166,145,250,219,0,0,3,0,106,255,236,4,0,5,205,
+0,23,0,35,0,48,0,0,1,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,51,
+50,22,21,20,6,37,54,54,53,52,38,35,34,6,21,20,22,23,6,6,21,20,22,51,50,54,
+53,52,38,39,2,203,162,147,252,207,217,242,141,142,126,109,233,178,182,230,
+126,254,228,126,106,126,110,106,125,99,108,126,128,143,133,136,149,126,151,
+3,6,86,191,116,181,220,207,186,128,197,68,79,182,108,161,189,189,163,114,
+177,6,57,132,89,101,106,106,101,90,125,215,60,155,110,116,124,131,117,90,
+139,74,0,2,0,106,255,236,4,4,5,203,0,24,0,38,0,0,23,53,22,51,50,54,54,55,
+35,6,35,34,38,53,52,18,51,50,0,17,16,0,33,34,38,19,20,22,51,50,54,54,53,52,
+38,38,35,34,6,217,67,99,167,198,85,9,13,95,212,195,221,239,206,220,1,1,254,
+192,254,193,51,103,48,137,127,88,140,71,65,135,93,128,142,2,156,25,149,246,
+193,170,238,206,226,1,10,254,170,254,209,254,75,254,91,12,3,231,145,156,82,
+122,62,90,172,111,174,0,0,3,0,175,255,227,1,173,4,250,0,11,0,23,0,24,0,0,
+1,50,22,21,20,6,35,34,38,53,52,54,19,50,22,21,20,6,35,34,38,53,52,54,19,1,
+46,63,64,68,59,60,67,63,64,61,66,67,60,60,67,66,61,4,102,72,67,66,73,73,66,
+67,72,252,148,71,68,67,73,74,66,67,72,4,0,0,0,5,0,91,254,248,1,178,4,250,
+0,11,0,18,0,19,0,20,0,21,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,23,6,3,
+35,18,55,19,19,17,1,46,63,64,68,59,60,67,63,152,15,51,125,138,67,34,110,132,
+4,102,72,67,66,73,73,66,67,72,252,136,23,197,254,230,1,23,223,4,12,252,0,
+254,233,0,0,2,0,102,0,157,4,2,4,250,0,6,0,7,0,0,37,1,53,1,21,9,2,4,2,252,
+100,3,156,253,33,2,223,253,195,157,1,168,102,1,225,160,254,148,254,190,3,
+188,0,3,0,102,1,125,4,2,4,250,0,3,0,7,0,8,0,0,19,53,33,21,1,53,33,21,1,102,
+3,156,252,100,3,156,253,195,3,23,149,149,254,102,150,150,3,125,0,2,0,102,
+0,157,4,2,4,250,0,6,0,7,0,0,19,1,1,53,1,21,1,1,102,2,224,253,32,3,156,252,
+100,1,95,1,62,1,66,1,108,160,254,31,102,254,88,4,93,0,0,2,0,146,255,227,3,
+146,5,203,0,27,0,39,0,0,1,53,52,54,55,62,2,53,52,38,35,34,6,7,39,54,51,50,
+22,21,20,6,7,6,6,21,21,7,50,22,21,20,6,35,34,38,53,52,54,1,134,79,91,81,67,
+32,119,109,83,150,70,63,199,167,187,215,79,136,109,61,60,61,66,67,60,60,67,
+66,1,158,37,129,143,76,69,82,94,64,97,118,52,34,145,101,200,173,108,167,118,
+94,105,86,18,164,71,68,67,73,74,66,67,72,0,4,0,221,253,220,2,106,7,44,0,7,
+0,8,0,9,0,10,0,0,1,33,17,33,21,35,17,51,3,3,19,2,106,254,115,1,141,232,232,
+165,5,31,254,173,7,251,143,249,35,5,190,2,50,246,176,0,0,4,0,86,253,220,3,
+25,7,44,0,3,0,4,0,5,0,6,0,0,19,1,35,1,1,3,19,254,2,27,168,253,229,1,111,5,
+31,6,167,248,6,7,250,254,83,2,50,246,176,0,0,4,0,110,253,220,1,252,7,44,0,
+7,0,8,0,9,0,10,0,0,23,51,17,35,53,33,17,33,19,3,19,110,231,231,1,142,254,
+114,143,5,231,196,6,220,143,248,6,6,77,2,50,246,176,0,0,1,0,60,2,37,4,44,
+5,193,0,6,0,0,19,1,51,1,35,1,1,60,1,203,102,1,191,161,254,175,254,163,2,37,
+3,156,252,100,2,223,253,33,0,1,255,252,254,188,3,78,255,72,0,3,0,0,1,33,53,
+33,3,78,252,174,3,82,254,188,140,0,0,4,0,90,253,220,2,179,7,44,0,29,0,30,
+0,31,0,32,0,0,5,20,22,23,21,38,38,53,17,52,38,35,53,50,54,53,17,52,54,55,
+21,6,6,21,17,20,7,21,22,21,3,3,19,1,251,78,106,172,178,129,122,122,129,178,
+172,106,78,216,216,254,5,231,37,78,75,2,147,3,147,138,1,216,101,84,152,84,
+101,1,217,136,148,3,146,2,75,78,254,41,203,41,11,41,202,3,73,2,50,246,176,
+0,0,4,0,248,253,220,2,114,7,44,0,3,0,4,0,5,0,6,0,0,1,51,17,35,3,3,19,1,223,
+147,147,226,5,231,6,167,248,6,6,77,2,50,246,176,0,4,0,110,253,220,2,199,7,
+44,0,29,0,30,0,31,0,32,0,0,1,52,55,53,38,53,17,52,38,39,53,22,22,21,17,20,
+22,51,21,34,6,21,17,20,6,7,53,54,54,53,3,3,19,1,37,217,217,77,106,173,177,
+123,128,123,128,178,172,106,77,40,5,231,1,177,202,41,11,41,203,1,215,79,74,
+2,146,3,148,136,254,39,98,87,152,84,101,254,40,137,148,3,147,2,74,79,5,31,
+2,50,246,176,0,2,0,102,2,13,4,2,4,250,0,23,0,24,0,0,19,53,54,51,50,22,23,
+22,22,51,50,54,55,21,6,35,34,38,39,38,38,35,34,6,1,102,100,148,54,91,103,
+80,76,45,51,122,54,99,149,59,96,93,81,73,46,50,119,1,36,2,13,162,108,19,44,
+34,22,65,56,162,108,23,40,35,21,63,2,179,255,255,0,100,2,12,2,84,4,250,2,
+6,0,227,0,0,0,2,0,82,2,23,3,174,4,250,0,3,0,4,0,0,19,53,33,21,1,82,3,92,254,
+23,2,23,168,168,2,227,0,2,0,82,2,23,7,174,4,250,0,3,0,4,0,0,19,53,33,21,1,
+82,7,92,250,23,2,23,168,168,2,227,0,3,0,168,3,224,1,225,7,44,0,6,0,7,0,8,
+0,0,19,39,54,19,51,6,7,19,3,182,14,54,122,137,62,38,72,5,3,224,22,208,1,15,
+255,246,1,26,2,50,0,3,0,166,3,224,1,223,7,44,0,6,0,7,0,8,0,0,1,23,6,3,35,
+18,55,23,3,1,209,14,50,126,137,70,30,187,5,5,213,22,197,254,230,1,47,198,
+219,2,50,0,0,4,0,169,3,224,3,99,7,44,0,6,0,13,0,14,0,15,0,0,1,39,54,19,51,
+6,7,33,39,54,19,51,6,7,19,3,2,56,14,54,122,137,62,38,253,184,14,54,122,137,
+62,38,71,5,3,224,22,208,1,15,255,246,22,208,1,15,255,246,1,26,2,50,0,4,0,
+166,3,224,3,96,7,44,0,6,0,13,0,14,0,15,0,0,1,23,6,3,35,18,55,33,23,6,3,35,
+18,55,7,3,1,209,14,50,126,137,70,30,2,72,14,50,126,137,70,30,198,5,5,213,
+22,197,254,230,1,47,198,22,197,254,230,1,47,198,219,2,50,0,0,3,0,147,255,
+227,5,219,0,250,0,11,0,23,0,35,0,0,37,50,22,21,20,6,35,34,38,53,52,54,33,
+50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,1,18,61,
+66,67,60,60,67,66,2,98,61,66,67,60,60,67,66,2,98,61,66,67,60,54,73,67,250,
+71,68,67,73,74,66,67,72,71,68,67,73,74,66,67,72,71,68,67,73,66,74,70,69,0,
+2,0,141,0,236,3,221,4,250,0,11,0,12,0,0,1,1,55,1,1,23,1,1,7,1,1,39,1,1,203,
+254,194,105,1,61,1,66,104,254,191,1,63,102,254,190,254,195,103,1,54,2,146,
+1,63,105,254,194,1,62,103,254,191,254,192,102,1,61,254,197,103,3,165,0,0,
+4,0,102,0,195,4,2,4,250,0,11,0,15,0,27,0,28,0,0,1,50,22,21,20,6,35,34,38,
+53,52,54,1,53,33,21,5,50,22,21,20,6,35,34,38,53,52,54,3,2,51,55,60,62,53,
+54,60,59,254,106,3,156,254,49,55,60,62,53,54,60,59,55,4,119,64,61,60,65,67,
+58,61,64,253,210,150,150,140,64,61,60,65,67,58,61,64,3,61,0,0,2,0,102,2,73,
+4,2,4,250,0,3,0,4,0,0,19,53,33,21,1,102,3,156,253,195,2,73,150,150,2,177,
+0,1,0,147,0,0,3,243,4,250,0,28,0,0,1,6,6,7,1,35,1,55,51,50,54,54,55,33,53,
+33,46,2,35,35,53,33,21,33,22,23,33,21,2,206,14,181,167,1,177,210,254,80,20,
+92,104,111,66,11,254,108,1,146,11,64,99,92,136,3,96,254,128,71,19,1,38,3,
+56,133,158,25,254,4,1,249,146,35,79,59,146,53,75,30,146,146,52,106,146,0,
+0,1,1,142,0,0,2,51,4,250,0,3,0,0,33,17,51,17,1,142,165,4,250,251,6,0,0,2,
+1,142,0,0,3,245,4,250,0,3,0,7,0,0,33,17,51,17,33,17,51,17,3,80,165,253,153,
+165,4,250,251,6,4,250,251,6,0,1,255,202,254,173,0,54,6,77,0,3,0,0,3,17,51,
+17,54,108,254,173,7,160,248,96,0,1,254,213,254,174,1,43,6,77,0,14,0,0,19,
+23,7,39,17,35,17,7,39,55,39,55,23,55,23,74,225,75,170,108,170,75,225,225,
+75,224,224,75,5,43,220,73,169,249,255,6,1,169,73,220,217,73,220,220,74,0,
+0,8,0,106,0,222,3,170,4,29,0,10,0,18,0,26,0,34,0,42,0,50,0,58,0,68,0,0,1,
+20,6,35,34,53,52,54,51,50,22,5,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,
+19,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,5,
+20,35,34,53,52,51,50,5,20,6,35,34,53,52,51,50,22,2,69,29,31,58,28,30,31,29,
+254,247,59,59,59,59,2,18,59,59,59,59,92,60,59,59,60,253,54,59,59,59,59,92,
+59,59,59,59,2,18,59,59,59,59,254,247,29,31,58,58,31,29,3,227,30,29,59,30,
+28,28,132,59,59,59,59,59,59,59,254,198,59,59,59,59,59,59,59,254,198,59,59,
+59,59,59,59,59,161,30,29,59,59,29,0,2,252,7,253,220,255,24,255,12,0,13,0,
+14,0,0,1,55,22,22,51,50,54,55,23,6,6,35,34,38,5,252,7,29,89,175,99,99,175,
+90,29,82,205,106,106,203,1,45,254,130,138,51,46,46,51,138,51,54,54,115,0,
+3,255,241,0,0,7,137,7,44,0,70,0,77,0,78,0,0,33,35,17,33,17,7,33,34,6,7,22,
+22,51,50,54,55,23,6,35,34,36,39,54,54,55,38,38,53,35,53,33,53,52,38,38,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,23,38,53,55,20,22,51,50,54,53,23,6,6,
+35,34,39,22,21,21,51,21,35,33,33,20,22,22,51,51,3,5,208,165,254,159,60,254,
+232,95,187,81,78,170,120,93,157,104,57,190,224,185,254,239,100,52,144,92,
+126,126,125,5,58,34,87,74,100,97,12,162,14,193,173,65,102,46,4,154,60,79,
+80,60,154,6,146,140,95,60,6,198,198,253,85,253,241,62,133,129,203,235,4,104,
+254,40,60,97,101,133,115,39,50,145,94,197,212,81,124,43,56,235,180,146,65,
+148,132,73,108,114,45,68,16,97,39,171,188,28,36,36,19,9,124,112,113,123,9,
+183,182,41,49,60,120,146,124,172,91,253,27,0,255,255,255,241,253,213,6,169,
+7,44,2,38,1,32,0,0,0,7,0,54,5,32,0,0,255,255,255,241,252,218,6,169,7,44,2,
+38,1,32,0,0,0,7,0,55,5,32,0,0,255,255,255,241,0,0,5,119,7,44,2,34,0,79,0,
+0,0,7,1,26,4,117,0,0,255,255,255,241,0,0,7,36,7,44,2,34,0,7,0,0,0,7,1,27,
+6,34,0,0,0,5,255,241,0,0,6,78,7,44,0,47,0,59,0,72,0,73,0,74,0,0,1,6,6,7,22,
+22,21,20,6,35,32,0,17,53,52,55,35,53,51,62,3,51,51,38,53,55,20,22,51,50,54,
+53,23,6,6,35,34,38,39,35,34,6,6,7,33,21,35,33,6,21,21,20,23,33,50,62,2,1,
+22,22,51,50,54,53,52,46,3,35,19,19,5,6,12,165,152,94,102,215,202,254,219,
+254,204,14,164,192,38,135,184,224,171,100,2,154,60,79,80,60,154,6,146,140,
+100,132,32,109,235,209,124,33,3,255,249,252,219,14,3,1,13,187,173,118,65,
+252,228,34,203,168,132,126,29,50,91,145,128,142,152,4,104,188,237,49,45,157,
+93,172,187,1,182,1,169,38,124,103,146,139,178,100,36,20,21,9,124,112,113,
+123,9,183,182,89,89,63,137,107,146,97,143,19,68,60,40,88,145,254,93,223,223,
+102,110,46,75,49,46,18,253,173,7,44,255,255,255,241,0,0,7,96,7,44,2,34,0,
+7,0,0,0,7,1,29,5,240,0,0,0,1,254,140,0,0,3,20,7,44,0,45,0,0,1,6,6,35,34,39,
+22,21,21,51,21,35,17,35,17,35,53,51,53,52,38,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,23,38,53,55,20,22,51,50,54,53,3,20,6,146,140,94,62,7,198,198,
+165,197,197,34,87,74,99,98,12,162,12,196,168,65,102,46,4,154,60,79,80,60,
+7,35,183,182,42,51,85,94,146,251,152,4,104,146,65,148,132,73,106,110,51,68,
+16,87,49,167,192,28,36,36,19,9,124,112,113,123,0,3,252,189,4,235,1,2,7,44,
+0,12,0,26,0,27,0,0,1,38,38,35,35,34,7,39,54,51,50,0,19,1,6,6,35,34,38,39,
+55,20,22,51,50,54,53,1,254,171,60,196,172,37,12,8,9,18,33,245,1,16,83,1,186,
+6,146,140,142,148,5,154,60,79,80,60,254,225,4,235,209,212,1,155,2,254,235,
+254,212,1,253,183,182,182,183,9,124,112,113,123,254,9,0,3,252,187,4,158,1,
+2,7,44,0,26,0,40,0,41,0,0,1,38,38,35,35,34,7,39,54,51,32,23,38,38,35,35,34,
+7,39,54,51,50,22,22,23,7,23,1,6,6,35,34,38,39,55,20,22,51,50,54,53,1,254,
+187,76,217,169,20,11,9,10,20,22,1,47,163,67,206,156,15,8,7,9,18,21,170,197,
+146,75,92,11,1,253,6,146,140,142,148,5,154,60,79,80,60,254,225,4,158,115,
+108,1,150,2,203,169,162,1,151,2,118,247,212,8,21,2,26,183,182,182,183,9,124,
+112,113,123,254,9,0,0,3,252,38,4,235,1,2,7,44,0,21,0,35,0,36,0,0,1,38,38,
+35,34,7,6,35,34,38,39,55,22,22,51,50,55,54,51,50,22,23,1,6,6,35,34,38,39,
+55,20,22,51,50,54,53,1,254,167,15,79,85,20,53,53,26,126,143,41,146,42,73,
+65,26,50,49,27,150,142,21,1,197,6,146,140,130,159,6,154,60,79,80,60,254,225,
+4,235,122,113,5,6,156,158,39,134,73,5,5,195,185,1,253,183,182,191,174,9,124,
+112,113,123,254,9,0,0,2,252,23,4,250,1,112,7,44,0,50,0,51,0,0,1,54,53,52,
+38,35,34,6,21,20,23,7,38,53,52,55,53,6,35,34,38,39,55,22,22,51,50,55,54,51,
+50,22,23,38,39,55,20,22,51,50,54,53,23,6,6,35,34,38,39,20,7,7,254,209,26,
+66,63,62,66,26,140,33,1,10,25,122,136,28,146,23,61,66,60,35,78,125,56,88,
+32,6,2,154,65,84,85,65,154,6,151,145,63,102,39,25,20,5,131,60,58,64,67,68,
+63,58,60,21,80,76,6,5,9,2,120,113,39,76,63,22,74,26,26,39,47,9,126,110,113,
+123,9,183,182,40,40,96,56,116,255,255,255,241,253,213,6,169,7,44,2,38,1,32,
+0,0,0,39,0,54,5,82,0,0,0,7,0,50,3,2,0,255,255,255,255,241,252,218,6,169,7,
+44,2,38,1,32,0,0,0,39,0,55,5,92,0,0,0,7,0,50,3,2,0,255,0,5,255,241,0,0,6,
+169,7,44,0,43,0,50,0,62,0,75,0,76,0,0,1,6,6,7,22,22,21,20,6,35,32,0,17,53,
+52,55,35,53,51,54,36,51,50,22,23,38,39,55,20,22,51,50,54,53,23,6,6,35,34,
+39,22,23,51,21,37,33,38,38,35,34,6,3,20,23,33,50,62,2,55,33,6,21,19,22,22,
+51,50,54,53,52,46,3,35,1,5,7,6,165,158,93,102,215,202,254,219,254,204,14,
+164,191,65,1,52,223,110,175,65,22,2,154,65,84,85,65,154,6,151,145,109,63,
+35,14,91,252,2,2,255,22,183,152,153,208,95,3,1,13,147,194,134,71,2,252,220,
+16,19,34,203,168,132,126,29,50,91,145,128,1,38,4,104,180,244,50,45,158,92,
+172,187,1,182,1,169,38,123,104,146,239,238,68,68,67,86,9,126,110,113,123,
+9,183,182,48,79,98,146,146,158,169,166,253,202,68,60,28,89,148,122,99,141,
+254,219,223,223,102,110,46,75,49,46,18,4,217,0,1,253,76,254,120,254,46,255,
+98,0,11,0,0,5,50,22,21,20,6,35,34,38,53,52,54,253,189,49,64,62,51,50,63,64,
+158,65,52,53,64,65,52,52,65,0,1,254,133,6,66,255,103,7,44,0,11,0,0,1,50,22,
+21,20,6,35,34,38,53,52,54,254,246,49,64,62,51,50,63,64,7,44,65,52,53,64,65,
+52,52,65,0,0,1,0,160,0,0,1,69,4,250,0,3,0,0,51,17,51,17,160,165,4,250,251,
+6,0,2,0,160,0,0,2,223,4,250,0,3,0,7,0,0,33,17,51,17,33,17,51,17,2,58,165,
+253,193,165,4,250,251,6,4,250,251,6,0,3,0,160,0,0,4,121,4,250,0,3,0,7,0,11,
+0,0,33,17,51,17,33,17,51,17,33,17,51,17,2,58,165,253,193,165,2,143,165,4,
+250,251,6,4,250,251,6,4,250,251,6,0,0,1,0,81,3,75,4,169,4,249,0,3,0,0,19,
+1,23,1,81,4,48,40,251,209,3,237,1,12,163,254,245,0,0,2,0,81,1,184,4,169,4,
+249,0,3,0,7,0,0,19,1,23,1,7,1,23,1,81,4,48,40,251,209,41,4,48,40,251,209,
+3,237,1,12,163,254,245,241,1,12,163,254,245,0,0,3,0,81,0,36,4,169,4,249,0,
+3,0,7,0,11,0,0,19,1,23,1,7,1,23,1,7,1,23,1,81,4,48,40,251,209,41,4,48,40,
+251,209,41,4,48,40,251,209,3,237,1,12,163,254,245,241,1,12,163,254,245,242,
+1,12,163,254,245,0,0,3,0,137,1,86,3,37,4,250,0,12,0,24,0,25,0,0,1,34,38,53,
+52,54,51,50,22,22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,3,1,216,148,187,
+185,150,98,152,83,185,149,83,95,96,82,82,96,98,124,1,86,176,139,133,179,81,
+143,88,136,179,1,229,96,74,79,93,93,79,74,96,1,191,0,4,0,117,0,177,4,3,4,
+252,0,16,0,28,0,29,0,30,0,0,1,6,7,22,22,21,20,6,35,34,38,53,52,54,55,1,23,
+1,34,6,21,20,22,51,50,54,53,52,38,39,1,3,65,129,167,117,131,185,148,148,187,
+97,110,2,91,95,253,197,83,95,95,83,82,96,98,104,2,88,3,240,102,114,25,161,
+114,136,179,177,138,93,139,85,1,211,119,254,17,95,75,79,94,94,79,74,96,142,
+1,74,0,1,254,191,254,128,1,248,5,17,0,19,0,0,5,22,51,50,54,18,53,52,2,39,
+55,22,18,21,16,2,4,35,34,39,254,202,106,75,164,203,98,69,61,166,62,70,137,
+254,233,213,89,107,213,22,120,1,0,228,197,1,215,223,37,221,254,0,202,254,
+237,254,193,152,22,0,0,3,254,191,253,213,2,179,5,17,0,30,0,31,0,32,0,0,1,
+22,51,50,36,54,53,52,38,39,38,38,53,52,54,55,23,6,6,21,20,22,23,22,22,21,
+16,0,33,34,39,1,1,254,195,41,64,187,1,0,129,60,53,56,58,254,255,49,205,188,
+50,65,51,63,254,142,254,150,59,57,3,190,253,11,254,180,6,89,179,129,99,200,
+114,119,182,89,165,217,53,155,38,135,106,64,148,140,114,224,112,254,251,254,
+221,6,6,100,249,86,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,
+1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,0,3,0,1,
+4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,32,0,248,0,
+3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,9,0,9,0,40,1,
+134,0,3,0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,11,0,62,2,14,0,3,0,1,4,9,0,
+12,0,60,2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,0,1,4,9,0,14,0,52,5,30,0,67,
+0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,
+0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,
+65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,
+115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,
+97,0,110,0,115,0,32,0,71,0,117,0,114,0,109,0,117,0,107,0,104,0,105,0,82,0,
+101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,
+111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,71,0,117,0,114,0,109,0,
+117,0,107,0,104,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,
+0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,
+115,0,71,0,117,0,114,0,109,0,117,0,107,0,104,0,105,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,45,1,2,1,3,1,4,1,5,1,6,1,
+7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,
+1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,
+1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,
+1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,
+1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,
+1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,
+1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,
+1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,
+123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,
+1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,
+148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,
+1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,
+173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,
+1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,
+198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,
+1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,
+223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,
+1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,
+248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,
+2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,
+22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,
+2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,7,46,110,111,116,100,101,
+102,4,78,85,76,76,16,110,111,110,109,97,114,107,105,110,103,114,101,116,117,
+114,110,5,115,112,97,99,101,13,97,100,97,107,98,105,110,100,105,103,117,114,
+117,9,98,105,110,100,105,103,117,114,117,11,118,105,115,97,114,103,97,103,
+117,114,117,5,97,103,117,114,117,6,97,97,103,117,114,117,5,105,103,117,114,
+117,6,105,105,103,117,114,117,5,117,103,117,114,117,6,117,117,103,117,114,
+117,6,101,101,103,117,114,117,6,97,105,103,117,114,117,6,111,111,103,117,
+114,117,6,97,117,103,117,114,117,6,107,97,103,117,114,117,7,107,104,97,103,
+117,114,117,6,103,97,103,117,114,117,7,103,104,97,103,117,114,117,7,110,103,
+97,103,117,114,117,6,99,97,103,117,114,117,7,99,104,97,103,117,114,117,6,
+106,97,103,117,114,117,7,106,104,97,103,117,114,117,7,110,121,97,103,117,
+114,117,7,116,116,97,103,117,114,117,8,116,116,104,97,103,117,114,117,7,100,
+100,97,103,117,114,117,8,100,100,104,97,103,117,114,117,7,110,110,97,103,
+117,114,117,6,116,97,103,117,114,117,7,116,104,97,103,117,114,117,6,100,97,
+103,117,114,117,7,100,104,97,103,117,114,117,6,110,97,103,117,114,117,6,112,
+97,103,117,114,117,7,112,104,97,103,117,114,117,6,98,97,103,117,114,117,7,
+98,104,97,103,117,114,117,6,109,97,103,117,114,117,6,121,97,103,117,114,117,
+6,114,97,103,117,114,117,6,108,97,103,117,114,117,11,108,97,110,117,107,116,
+97,103,117,114,117,6,118,97,103,117,114,117,11,115,97,110,117,107,116,97,
+103,117,114,117,6,115,97,103,117,114,117,6,104,97,103,117,114,117,9,110,117,
+107,116,97,103,117,114,117,11,97,97,109,97,116,114,97,103,117,114,117,10,
+105,109,97,116,114,97,103,117,114,117,11,105,105,109,97,116,114,97,103,117,
+114,117,10,117,109,97,116,114,97,103,117,114,117,11,117,117,109,97,116,114,
+97,103,117,114,117,11,101,101,109,97,116,114,97,103,117,114,117,11,97,105,
+109,97,116,114,97,103,117,114,117,11,111,111,109,97,116,114,97,103,117,114,
+117,11,97,117,109,97,116,114,97,103,117,114,117,10,104,97,108,97,110,116,
+103,117,114,117,9,117,100,97,97,116,103,117,114,117,12,107,104,97,110,117,
+107,116,97,103,117,114,117,11,103,97,110,117,107,116,97,103,117,114,117,11,
+106,97,110,117,107,116,97,103,117,114,117,7,114,114,97,103,117,114,117,12,
+112,104,97,110,117,107,116,97,103,117,114,117,8,122,101,114,111,103,117,114,
+117,7,111,110,101,103,117,114,117,7,116,119,111,103,117,114,117,9,116,104,
+114,101,101,103,117,114,117,8,102,111,117,114,103,117,114,117,8,102,105,118,
+101,103,117,114,117,7,115,105,120,103,117,114,117,9,115,101,118,101,110,103,
+117,114,117,9,101,105,103,104,116,103,117,114,117,8,110,105,110,101,103,117,
+114,117,9,116,105,112,112,105,103,117,114,117,9,97,100,100,97,107,103,117,
+114,117,7,105,114,105,103,117,114,117,7,117,114,97,103,117,114,117,11,101,
+107,111,110,107,97,114,103,117,114,117,10,121,97,107,97,115,104,103,117,114,
+117,5,85,50,54,50,67,10,117,110,117,107,116,97,103,117,114,117,11,117,117,
+110,117,107,116,97,103,117,114,117,11,107,97,110,117,107,116,97,103,117,114,
+117,12,103,104,97,110,117,107,116,97,103,117,114,117,12,110,103,97,110,117,
+107,116,97,103,117,114,117,11,99,97,110,117,107,116,97,103,117,114,117,12,
+99,104,97,110,117,107,116,97,103,117,114,117,12,106,104,97,110,117,107,116,
+97,103,117,114,117,12,110,121,97,110,117,107,116,97,103,117,114,117,12,116,
+116,97,110,117,107,116,97,103,117,114,117,13,116,116,104,97,110,117,107,116,
+97,103,117,114,117,13,100,100,104,97,110,117,107,116,97,103,117,114,117,12,
+110,110,97,110,117,107,116,97,103,117,114,117,11,116,97,110,117,107,116,97,
+103,117,114,117,12,116,104,97,110,117,107,116,97,103,117,114,117,11,100,97,
+110,117,107,116,97,103,117,114,117,12,100,104,97,110,117,107,116,97,103,117,
+114,117,11,110,97,110,117,107,116,97,103,117,114,117,11,112,97,110,117,107,
+116,97,103,117,114,117,11,98,97,110,117,107,116,97,103,117,114,117,12,98,
+104,97,110,117,107,116,97,103,117,114,117,11,109,97,110,117,107,116,97,103,
+117,114,117,11,121,97,110,117,107,116,97,103,117,114,117,11,114,97,110,117,
+107,116,97,103,117,114,117,11,118,97,110,117,107,116,97,103,117,114,117,11,
+104,97,110,117,107,116,97,103,117,114,117,15,114,97,115,117,98,115,99,114,
+105,112,116,103,117,114,117,15,104,97,115,117,98,115,99,114,105,112,116,103,
+117,114,117,15,118,97,115,117,98,115,99,114,105,112,116,103,117,114,117,13,
+107,97,112,114,101,104,97,108,102,103,117,114,117,14,107,104,97,112,114,101,
+104,97,108,102,103,117,114,117,13,103,97,112,114,101,104,97,108,102,103,117,
+114,117,14,103,104,97,112,114,101,104,97,108,102,103,117,114,117,14,110,103,
+97,112,114,101,104,97,108,102,103,117,114,117,13,99,97,112,114,101,104,97,
+108,102,103,117,114,117,14,99,104,97,112,114,101,104,97,108,102,103,117,114,
+117,13,106,97,112,114,101,104,97,108,102,103,117,114,117,14,106,104,97,112,
+114,101,104,97,108,102,103,117,114,117,14,110,121,97,112,114,101,104,97,108,
+102,103,117,114,117,14,116,116,97,112,114,101,104,97,108,102,103,117,114,
+117,15,116,116,104,97,112,114,101,104,97,108,102,103,117,114,117,14,100,100,
+97,112,114,101,104,97,108,102,103,117,114,117,15,100,100,104,97,112,114,101,
+104,97,108,102,103,117,114,117,14,110,110,97,112,114,101,104,97,108,102,103,
+117,114,117,13,116,97,112,114,101,104,97,108,102,103,117,114,117,14,116,104,
+97,112,114,101,104,97,108,102,103,117,114,117,13,100,97,112,114,101,104,97,
+108,102,103,117,114,117,14,100,104,97,112,114,101,104,97,108,102,103,117,
+114,117,13,110,97,112,114,101,104,97,108,102,103,117,114,117,13,112,97,112,
+114,101,104,97,108,102,103,117,114,117,14,112,104,97,112,114,101,104,97,108,
+102,103,117,114,117,13,98,97,112,114,101,104,97,108,102,103,117,114,117,14,
+98,104,97,112,114,101,104,97,108,102,103,117,114,117,13,109,97,112,114,101,
+104,97,108,102,103,117,114,117,13,121,97,112,114,101,104,97,108,102,103,117,
+114,117,13,114,97,112,114,101,104,97,108,102,103,117,114,117,13,108,97,112,
+114,101,104,97,108,102,103,117,114,117,13,118,97,112,114,101,104,97,108,102,
+103,117,114,117,13,115,97,112,114,101,104,97,108,102,103,117,114,117,13,104,
+97,112,114,101,104,97,108,102,103,117,114,117,18,107,97,110,117,107,116,97,
+112,114,101,104,97,108,102,103,117,114,117,19,107,104,97,110,117,107,116,
+97,112,114,101,104,97,108,102,103,117,114,117,18,103,97,110,117,107,116,97,
+112,114,101,104,97,108,102,103,117,114,117,19,103,104,97,110,117,107,116,
+97,112,114,101,104,97,108,102,103,117,114,117,19,110,103,97,110,117,107,116,
+97,112,114,101,104,97,108,102,103,117,114,117,18,99,97,110,117,107,116,97,
+112,114,101,104,97,108,102,103,117,114,117,19,99,104,97,110,117,107,116,97,
+112,114,101,104,97,108,102,103,117,114,117,18,106,97,110,117,107,116,97,112,
+114,101,104,97,108,102,103,117,114,117,19,106,104,97,110,117,107,116,97,112,
+114,101,104,97,108,102,103,117,114,117,19,110,121,97,110,117,107,116,97,112,
+114,101,104,97,108,102,103,117,114,117,19,116,116,97,110,117,107,116,97,112,
+114,101,104,97,108,102,103,117,114,117,20,116,116,104,97,110,117,107,116,
+97,112,114,101,104,97,108,102,103,117,114,117,19,100,100,97,110,117,107,116,
+97,112,114,101,104,97,108,102,103,117,114,117,20,100,100,104,97,110,117,107,
+116,97,112,114,101,104,97,108,102,103,117,114,117,19,110,110,97,110,117,107,
+116,97,112,114,101,104,97,108,102,103,117,114,117,18,116,97,110,117,107,116,
+97,112,114,101,104,97,108,102,103,117,114,117,19,116,104,97,110,117,107,116,
+97,112,114,101,104,97,108,102,103,117,114,117,18,100,97,110,117,107,116,97,
+112,114,101,104,97,108,102,103,117,114,117,19,100,104,97,110,117,107,116,
+97,112,114,101,104,97,108,102,103,117,114,117,18,110,97,110,117,107,116,97,
+112,114,101,104,97,108,102,103,117,114,117,18,112,97,110,117,107,116,97,112,
+114,101,104,97,108,102,103,117,114,117,19,112,104,97,110,117,107,116,97,112,
+114,101,104,97,108,102,103,117,114,117,18,98,97,110,117,107,116,97,112,114,
+101,104,97,108,102,103,117,114,117,19,98,104,97,110,117,107,116,97,112,114,
+101,104,97,108,102,103,117,114,117,18,109,97,110,117,107,116,97,112,114,101,
+104,97,108,102,103,117,114,117,18,121,97,110,117,107,116,97,112,114,101,104,
+97,108,102,103,117,114,117,18,114,97,110,117,107,116,97,112,114,101,104,97,
+108,102,103,117,114,117,18,108,97,110,117,107,116,97,112,114,101,104,97,108,
+102,103,117,114,117,18,118,97,110,117,107,116,97,112,114,101,104,97,108,102,
+103,117,114,117,18,115,97,110,117,107,116,97,112,114,101,104,97,108,102,103,
+117,114,117,18,104,97,110,117,107,116,97,112,114,101,104,97,108,102,103,117,
+114,117,14,121,97,112,111,115,116,102,111,114,109,103,117,114,117,21,114,
+97,115,117,98,115,99,114,105,112,116,104,97,108,97,110,116,103,117,114,117,
+21,104,97,115,117,98,115,99,114,105,112,116,104,97,108,97,110,116,103,117,
+114,117,21,118,97,115,117,98,115,99,114,105,112,116,104,97,108,97,110,116,
+103,117,114,117,15,117,100,97,97,116,104,97,108,97,110,116,103,117,114,117,
+16,121,97,107,97,115,104,104,97,108,97,110,116,103,117,114,117,16,114,97,
+115,117,98,115,99,114,105,112,116,117,103,117,114,117,16,104,97,115,117,98,
+115,99,114,105,112,116,117,103,117,114,117,16,118,97,115,117,98,115,99,114,
+105,112,116,117,103,117,114,117,10,117,100,97,97,116,117,103,117,114,117,
+11,121,97,107,97,115,104,117,103,117,114,117,17,114,97,115,117,98,115,99,
+114,105,112,116,117,117,103,117,114,117,17,104,97,115,117,98,115,99,114,105,
+112,116,117,117,103,117,114,117,17,118,97,115,117,98,115,99,114,105,112,116,
+117,117,103,117,114,117,11,117,100,97,97,116,117,117,103,117,114,117,12,121,
+97,107,97,115,104,117,117,103,117,114,117,8,107,97,114,97,103,117,114,117,
+16,114,97,115,117,98,115,99,114,105,112,116,49,103,117,114,117,16,104,97,
+115,117,98,115,99,114,105,112,116,49,103,117,114,117,16,118,97,115,117,98,
+115,99,114,105,112,116,49,103,117,114,117,12,110,117,117,116,105,112,112,
+105,103,117,114,117,12,112,104,117,110,117,107,116,97,103,117,114,117,13,
+112,104,117,117,110,117,107,116,97,103,117,114,117,11,105,105,98,105,110,
+100,105,103,117,114,117,10,117,98,105,110,100,105,103,117,114,117,11,117,
+117,98,105,110,100,105,103,117,114,117,11,101,101,98,105,110,100,105,103,
+117,114,117,11,97,105,98,105,110,100,105,103,117,114,117,11,111,111,98,105,
+110,100,105,103,117,114,117,11,97,117,98,105,110,100,105,103,117,114,117,
+16,105,105,109,97,116,114,97,98,105,110,100,105,103,117,114,117,16,101,101,
+109,97,116,114,97,98,105,110,100,105,103,117,114,117,16,97,105,109,97,116,
+114,97,98,105,110,100,105,103,117,114,117,16,111,111,109,97,116,114,97,98,
+105,110,100,105,103,117,114,117,16,97,117,109,97,116,114,97,98,105,110,100,
+105,103,117,114,117,15,117,98,105,110,100,105,110,117,107,116,97,103,117,
+114,117,16,117,117,98,105,110,100,105,110,117,107,116,97,103,117,114,117,
+15,97,100,100,97,107,98,97,114,97,108,116,103,117,114,117,13,117,109,97,116,
+114,97,108,111,119,103,117,114,117,14,117,117,109,97,116,114,97,108,111,119,
+103,117,114,117,12,111,111,109,97,116,114,97,49,103,117,114,117,17,111,111,
+109,97,116,114,97,98,105,110,100,105,49,103,117,114,117,11,101,120,99,108,
+97,109,46,103,117,114,117,13,113,117,111,116,101,100,98,108,46,103,117,114,
+117,15,110,117,109,98,101,114,115,105,103,110,46,103,117,114,117,12,112,101,
+114,99,101,110,116,46,103,117,114,117,16,113,117,111,116,101,115,105,110,
+103,108,101,46,103,117,114,117,14,112,97,114,101,110,108,101,102,116,46,103,
+117,114,117,15,112,97,114,101,110,114,105,103,104,116,46,103,117,114,117,
+13,97,115,116,101,114,105,115,107,46,103,117,114,117,9,112,108,117,115,46,
+103,117,114,117,10,99,111,109,109,97,46,103,117,114,117,11,104,121,112,104,
+101,110,46,103,117,114,117,11,112,101,114,105,111,100,46,103,117,114,117,
+10,115,108,97,115,104,46,103,117,114,117,9,122,101,114,111,46,103,117,114,
+117,8,111,110,101,46,103,117,114,117,8,116,119,111,46,103,117,114,117,10,
+116,104,114,101,101,46,103,117,114,117,9,102,111,117,114,46,103,117,114,117,
+9,102,105,118,101,46,103,117,114,117,8,115,105,120,46,103,117,114,117,10,
+115,101,118,101,110,46,103,117,114,117,10,101,105,103,104,116,46,103,117,
+114,117,9,110,105,110,101,46,103,117,114,117,10,99,111,108,111,110,46,103,
+117,114,117,14,115,101,109,105,99,111,108,111,110,46,103,117,114,117,9,108,
+101,115,115,46,103,117,114,117,10,101,113,117,97,108,46,103,117,114,117,12,
+103,114,101,97,116,101,114,46,103,117,114,117,13,113,117,101,115,116,105,
+111,110,46,103,117,114,117,16,98,114,97,99,107,101,116,108,101,102,116,46,
+103,117,114,117,14,98,97,99,107,115,108,97,115,104,46,103,117,114,117,17,
+98,114,97,99,107,101,116,114,105,103,104,116,46,103,117,114,117,16,97,115,
+99,105,105,99,105,114,99,117,109,46,103,117,114,117,15,117,110,100,101,114,
+115,99,111,114,101,46,103,117,114,117,14,98,114,97,99,101,108,101,102,116,
+46,103,117,114,117,8,98,97,114,46,103,117,114,117,15,98,114,97,99,101,114,
+105,103,104,116,46,103,117,114,117,15,97,115,99,105,105,116,105,108,100,101,
+46,103,117,114,117,14,115,102,116,104,121,112,104,101,110,46,103,117,114,
+117,11,101,110,100,97,115,104,46,103,117,114,117,11,101,109,100,97,115,104,
+46,103,117,114,117,14,113,117,111,116,101,108,101,102,116,46,103,117,114,
+117,15,113,117,111,116,101,114,105,103,104,116,46,103,117,114,117,17,113,
+117,111,116,101,100,98,108,108,101,102,116,46,103,117,114,117,18,113,117,
+111,116,101,100,98,108,114,105,103,104,116,46,103,117,114,117,13,101,108,
+108,105,112,115,105,115,46,103,117,114,117,13,109,117,108,116,105,112,108,
+121,46,103,117,114,117,11,100,105,118,105,100,101,46,103,117,114,117,10,109,
+105,110,117,115,46,103,117,114,117,12,117,110,105,50,48,66,57,46,103,117,
+114,117,10,100,97,110,100,97,46,103,117,114,117,13,100,98,108,100,97,110,
+100,97,46,103,117,114,117,7,117,110,105,50,48,48,66,7,117,110,105,50,48,48,
+67,7,117,110,105,50,48,48,68,7,117,110,105,50,53,67,67,14,117,109,97,116,
+114,97,108,111,119,49,103,117,114,117,11,105,105,97,100,100,97,107,103,117,
+114,117,10,117,97,100,100,97,107,103,117,114,117,11,117,117,97,100,100,97,
+107,103,117,114,117,11,101,101,97,100,100,97,107,103,117,114,117,11,97,105,
+97,100,100,97,107,103,117,114,117,11,111,111,97,100,100,97,107,103,117,114,
+117,11,97,117,97,100,100,97,107,103,117,114,117,16,105,105,109,97,116,114,
+97,97,100,100,97,107,103,117,114,117,16,101,101,109,97,116,114,97,97,100,
+100,97,107,103,117,114,117,16,97,105,109,97,116,114,97,97,100,100,97,107,
+103,117,114,117,16,111,111,109,97,116,114,97,97,100,100,97,107,103,117,114,
+117,16,97,117,109,97,116,114,97,97,100,100,97,107,103,117,114,117,15,117,
+110,117,107,116,97,97,100,100,97,107,103,117,114,117,16,117,117,110,117,107,
+116,97,97,100,100,97,107,103,117,114,117,12,117,114,97,97,100,100,97,107,
+103,117,114,117,12,110,117,107,116,97,97,108,116,103,117,114,117,12,98,105,
+110,100,105,97,108,116,103,117,114,117,7,117,110,105,65,56,51,48,7,117,110,
+105,65,56,51,49,7,117,110,105,65,56,51,50,7,117,110,105,65,56,51,51,7,117,
+110,105,65,56,51,52,7,117,110,105,65,56,51,53,7,117,110,105,65,56,51,54,7,
+117,110,105,65,56,51,55,7,117,110,105,65,56,51,56,7,117,110,105,65,56,51,
+57,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,190,0,0,0,0,0,2,0,29,0,
+4,0,5,0,3,0,6,0,44,0,1,0,45,0,45,0,2,0,46,0,46,0,1,0,47,0,47,0,2,0,48,0,49,
+0,1,0,50,0,50,0,3,0,51,0,53,0,1,0,54,0,61,0,3,0,62,0,64,0,2,0,65,0,65,0,1,
+0,66,0,66,0,2,0,77,0,78,0,3,0,79,0,80,0,1,0,82,0,82,0,3,0,84,0,109,0,2,0,
+110,0,112,0,3,0,113,0,175,0,2,0,176,0,190,0,3,0,191,0,191,0,2,0,192,0,194,
+0,3,0,195,0,205,0,2,0,206,0,209,0,3,0,210,0,211,0,2,0,212,0,216,0,3,1,16,
+1,16,0,1,1,18,1,25,0,2,1,26,1,29,0,3,1,30,1,31,0,2,0,174,0,85,1,252,1,170,
+2,44,1,92,1,98,2,4,2,36,2,44,1,104,2,44,1,198,1,232,1,204,1,108,1,116,1,120,
+1,124,1,132,1,138,1,142,1,150,2,28,1,156,1,164,2,20,2,36,1,170,1,174,1,178,
+1,186,1,182,1,186,2,24,2,36,1,190,2,24,1,194,1,198,1,232,1,204,1,208,1,224,
+1,214,2,28,2,36,1,220,1,236,1,252,1,228,1,232,1,224,2,36,2,60,1,228,1,232,
+2,36,2,60,1,240,1,236,1,240,1,240,1,244,1,248,1,252,2,0,2,4,2,36,2,44,2,8,
+2,44,2,12,2,16,2,28,2,20,2,24,2,28,2,32,2,36,2,44,2,40,2,44,2,48,2,52,2,56,
+2,60,0,1,0,85,0,4,0,5,0,7,0,8,0,9,0,10,0,13,0,14,0,15,0,16,0,17,0,21,0,22,
+0,23,0,26,0,27,0,28,0,29,0,32,0,36,0,40,0,43,0,44,0,45,0,46,0,49,0,50,0,51,
+0,54,0,55,0,56,0,57,0,58,0,59,0,61,0,77,0,82,0,86,0,88,0,89,0,90,0,94,0,101,
+0,107,0,109,0,110,0,111,0,112,0,113,0,119,0,124,0,132,0,140,0,144,0,150,0,
+163,0,171,0,176,0,177,0,181,0,186,0,191,0,192,0,193,0,194,0,198,0,201,0,202,
+0,203,0,204,0,206,0,207,0,208,0,209,0,215,0,216,1,18,1,21,1,22,1,23,1,24,
+1,26,1,27,1,28,1,29,0,2,0,54,0,55,0,2,0,62,0,63,0,1,0,58,0,3,0,53,0,54,0,
+55,0,1,0,48,0,1,0,32,0,3,0,13,0,31,0,32,0,2,0,56,0,57,0,1,0,42,0,3,0,35,0,
+36,0,37,0,2,0,57,0,58,0,3,0,51,0,52,0,53,0,2,0,51,0,53,0,1,0,12,0,1,0,8,0,
+1,0,14,0,1,0,13,0,1,0,28,0,1,0,11,0,1,0,18,0,2,0,0,0,45,0,1,0,37,0,2,0,53,
+0,55,0,2,0,35,0,37,0,1,0,16,0,1,0,31,0,1,0,45,0,1,0,53,0,1,0,24,0,1,0,15,
+0,1,0,66,0,1,0,23,0,1,0,26,0,1,0,38,0,1,0,62,0,1,0,70,0,1,0,25,0,1,0,40,0,
+1,0,47,0,1,0,22,0,1,0,34,0,1,0,78,0,1,0,35,0,1,0,73,0,1,0,50,0,1,0,27,0,1,
+0,41,0,1,0,36,0,1,0,51,0,0,0,1,0,0,0,10,0,56,0,96,0,2,103,117,114,50,0,14,
+103,117,114,117,0,18,0,8,0,0,0,16,0,0,0,0,255,255,0,3,0,0,0,1,0,2,0,0,255,
+255,0,3,0,0,0,1,0,2,0,3,97,98,118,109,0,20,98,108,119,109,0,26,100,105,115,
+116,0,34,0,0,0,1,0,0,0,0,0,2,0,1,0,2,0,0,0,1,0,3,0,5,0,12,2,46,3,198,5,126,
+6,62,0,4,0,0,0,1,0,8,0,1,0,12,0,50,0,1,0,100,1,50,0,1,0,17,0,4,0,5,0,56,0,
+57,0,58,0,59,0,77,0,206,0,207,0,208,0,209,0,215,0,216,1,26,1,27,1,28,1,29,
+0,1,0,23,0,8,0,9,0,17,0,23,0,28,0,36,0,44,0,45,0,51,0,86,0,90,0,94,0,101,
+0,113,0,119,0,124,0,132,0,140,0,144,0,150,0,163,0,171,0,191,0,17,0,0,0,70,
+0,0,0,78,0,0,0,86,0,0,0,94,0,0,0,102,0,0,0,110,0,0,0,118,0,0,0,126,0,0,0,
+134,0,0,0,142,0,0,0,150,0,0,0,158,0,0,0,166,0,0,0,174,0,0,0,182,0,0,0,190,
+0,0,0,198,0,2,255,73,4,250,0,26,0,2,255,73,4,250,0,12,0,2,255,73,4,250,0,
+13,0,2,255,73,4,250,0,28,0,2,255,73,4,250,0,22,0,2,255,73,4,250,0,35,0,2,
+255,73,4,250,0,22,0,2,255,73,4,250,0,25,0,2,255,73,4,250,0,40,0,2,255,73,
+4,250,0,34,0,2,255,73,4,250,0,47,0,2,255,73,4,250,0,22,0,2,255,73,4,250,0,
+34,0,2,255,73,4,250,0,27,0,2,255,73,4,250,0,41,0,2,255,73,4,250,0,36,0,2,
+255,73,4,250,0,51,0,23,0,48,0,56,0,64,0,72,0,80,0,88,0,96,0,104,0,112,0,120,
+0,128,0,136,0,144,0,152,0,160,0,168,0,176,0,184,0,192,0,200,0,208,0,216,0,
+224,0,2,7,44,4,250,0,54,0,2,5,220,4,250,0,62,0,2,4,26,4,250,0,45,0,2,4,70,
+4,250,0,53,0,2,2,246,4,250,0,31,0,2,2,234,4,250,0,35,0,2,4,117,4,250,0,51,
+0,2,4,117,4,250,0,51,0,2,1,60,4,250,0,8,0,2,4,26,4,250,0,45,0,2,4,70,4,250,
+0,53,0,2,2,246,4,250,0,31,0,2,2,234,4,250,0,35,0,2,4,26,4,250,0,45,0,2,4,
+70,4,250,0,53,0,2,2,246,4,250,0,31,0,2,2,234,4,250,0,35,0,2,4,117,4,250,0,
+51,0,2,4,26,4,250,0,45,0,2,4,70,4,250,0,53,0,2,2,234,4,250,0,35,0,2,4,117,
+4,250,0,51,0,2,4,26,4,250,0,66,0,4,0,0,0,1,0,8,0,1,0,12,0,22,0,1,0,82,0,120,
+0,1,0,3,0,50,0,54,0,55,0,1,0,28,0,7,0,8,0,9,0,10,0,13,0,14,0,15,0,16,0,23,
+0,26,0,27,0,28,0,29,0,36,0,40,0,44,0,46,0,198,0,201,0,202,0,203,0,204,1,16,
+1,18,1,21,1,22,1,23,1,24,0,3,0,0,0,14,0,0,0,22,0,0,0,30,0,2,253,189,0,0,0,
+12,0,2,253,144,0,0,0,14,0,2,253,144,0,0,0,28,0,28,0,58,0,66,0,74,0,82,0,90,
+0,98,0,106,0,114,0,122,0,130,0,138,0,146,0,154,0,162,0,170,0,178,0,186,0,
+194,0,202,0,210,0,218,0,226,0,234,0,240,0,248,1,0,1,8,1,16,0,2,2,91,0,0,0,
+50,0,2,2,91,0,0,0,55,0,2,4,76,0,0,0,63,0,2,2,58,0,0,0,62,0,2,2,58,0,0,0,35,
+0,2,2,91,0,0,0,50,0,2,2,172,0,0,0,58,0,2,2,91,0,0,0,50,0,2,2,137,0,0,0,54,
+0,2,2,86,0,0,0,48,0,2,2,85,0,0,0,32,0,2,2,164,0,0,0,13,0,2,2,64,0,0,0,56,
+0,2,2,152,0,0,0,36,0,2,2,23,0,0,0,57,0,2,2,178,0,0,0,52,0,2,2,86,0,0,0,47,
+0,2,2,58,0,0,0,62,0,2,2,58,0,0,0,35,0,2,2,91,0,0,0,50,0,2,2,172,0,0,0,70,
+0,2,2,91,0,0,0,50,0,1,2,10,0,0,0,2,2,58,0,0,0,78,0,2,2,58,0,0,0,35,0,2,2,
+91,0,0,0,50,0,2,2,172,0,0,0,73,0,2,2,91,0,0,0,50,0,4,0,0,0,1,0,8,0,1,0,12,
+0,40,0,1,0,84,0,230,0,1,0,12,0,61,0,82,0,110,0,111,0,112,0,176,0,177,0,181,
+0,186,0,192,0,193,0,194,0,1,0,20,0,17,0,21,0,22,0,23,0,28,0,29,0,32,0,36,
+0,40,0,43,0,44,0,45,0,49,0,86,0,88,0,89,0,90,0,101,0,107,0,109,0,12,0,0,0,
+50,0,0,0,58,0,0,0,66,0,0,0,74,0,0,0,82,0,0,0,90,0,0,0,98,0,0,0,106,0,0,0,
+114,0,0,0,122,0,0,0,130,0,0,0,138,0,2,254,164,0,0,0,11,0,2,254,164,0,0,0,
+18,0,2,254,164,0,0,0,16,0,2,254,164,0,0,0,24,0,2,254,164,0,0,0,26,0,2,254,
+164,0,0,0,15,0,2,254,164,0,0,0,24,0,2,254,164,0,0,0,15,0,2,254,164,0,0,0,
+15,0,2,254,164,0,0,0,23,0,2,254,164,0,0,0,26,0,2,254,164,0,0,0,38,0,20,0,
+42,0,50,0,58,0,66,0,74,0,82,0,90,0,98,0,106,0,114,0,122,0,130,0,138,0,146,
+0,154,0,162,0,170,0,178,0,186,0,194,0,2,3,232,0,0,0,0,0,2,3,80,0,0,0,53,0,
+2,3,129,0,0,0,37,0,2,3,153,0,0,0,55,0,2,3,146,0,0,0,32,0,2,3,27,0,0,0,57,
+0,2,2,190,0,0,0,42,0,2,3,162,0,0,0,37,0,2,2,247,0,0,0,58,0,2,2,225,0,0,0,
+34,0,2,3,214,0,0,0,53,0,2,3,214,0,0,0,53,0,2,2,220,0,0,0,35,0,2,3,232,0,0,
+0,0,0,2,3,80,0,0,0,53,0,2,3,129,0,0,0,37,0,2,3,153,0,0,0,55,0,2,3,162,0,0,
+0,37,0,2,2,225,0,0,0,34,0,2,2,220,0,0,0,35,0,8,0,0,0,1,0,8,0,2,0,18,0,26,
+0,72,0,94,0,3,0,0,0,102,0,0,0,1,0,2,0,59,0,209,0,2,0,7,0,28,0,28,0,2,0,36,
+0,36,0,2,0,61,0,61,0,1,0,82,0,82,0,1,0,94,0,94,0,2,0,101,0,101,0,2,0,192,
+0,194,0,1,0,2,0,3,0,59,0,59,0,1,0,78,0,78,0,2,0,209,0,209,0,1,0,1,0,1,0,1,
+0,1,0,4,0,10,0,32,0,52,0,68,0,2,0,1,0,2,0,2,0,2,0,0,0,2,0,0,0,4,0,1,0,4,0,
+1,0,2,0,2,0,2,0,0,0,2,0,0,0,4,0,1,0,4,0,2,0,1,0,2,0,1,0,0,0,1,0,0,0,4,0,1,
+0,2,0,1,0,0,0,1,0,0,0,4,0,1,0,0,0,1,0,8,0,2,0,14,0,1,0,3,0,40,0,190,0,110,
+0,1,0,3,0,59,0,78,0,209,0,0,0,1,0,0,0,10,0,70,0,192,0,2,103,117,114,50,0,
+14,103,117,114,117,0,18,0,8,0,0,0,22,0,0,0,0,255,255,0,6,0,6,0,2,0,8,0,3,
+0,0,0,5,0,0,255,255,0,7,0,6,0,1,0,4,0,7,0,3,0,0,0,5,0,9,97,98,118,115,0,56,
+98,108,119,102,0,66,98,108,119,102,0,72,98,108,119,115,0,78,104,97,108,102,
+0,92,104,97,108,110,0,98,110,117,107,116,0,104,112,115,116,102,0,110,112,
+115,116,102,0,116,0,0,0,3,0,14,0,15,0,17,0,0,0,1,0,1,0,0,0,1,0,2,0,0,0,5,
+0,6,0,8,0,9,0,10,0,12,0,0,0,1,0,3,0,0,0,1,0,20,0,0,0,1,0,0,0,0,0,1,0,4,0,
+0,0,1,0,5,0,21,0,44,1,226,2,30,2,78,5,90,5,122,5,154,5,246,6,38,6,206,7,20,
+7,148,7,172,8,40,8,62,9,240,10,70,10,90,11,24,11,50,11,106,0,4,0,0,0,1,0,
+8,0,1,1,146,0,33,0,72,0,82,0,92,0,102,0,112,0,122,0,132,0,142,0,152,0,162,
+0,172,0,182,0,192,0,202,0,212,0,222,0,232,0,242,0,252,1,6,1,16,1,26,1,36,
+1,46,1,56,1,66,1,76,1,86,1,96,1,106,1,116,1,126,1,136,0,1,0,4,0,84,0,2,0,
+50,0,1,0,4,0,85,0,2,0,50,0,1,0,4,0,86,0,2,0,50,0,1,0,4,0,62,0,2,0,50,0,1,
+0,4,0,63,0,2,0,50,0,1,0,4,0,87,0,2,0,50,0,1,0,4,0,88,0,2,0,50,0,1,0,4,0,89,
+0,2,0,50,0,1,0,4,0,90,0,2,0,50,0,1,0,4,0,64,0,2,0,50,0,1,0,4,0,91,0,2,0,50,
+0,1,0,4,0,92,0,2,0,50,0,1,0,4,0,93,0,2,0,50,0,1,0,4,0,94,0,2,0,50,0,1,0,4,
+0,65,0,2,0,50,0,1,0,4,0,95,0,2,0,50,0,1,0,4,0,96,0,2,0,50,0,1,0,4,0,97,0,
+2,0,50,0,1,0,4,0,98,0,2,0,50,0,1,0,4,0,99,0,2,0,50,0,1,0,4,0,100,0,2,0,50,
+0,1,0,4,0,101,0,2,0,50,0,1,0,4,0,102,0,2,0,50,0,1,0,4,0,66,0,2,0,50,0,1,0,
+4,0,103,0,2,0,50,0,1,0,4,0,104,0,2,0,50,0,1,0,4,0,105,0,2,0,50,0,1,0,4,0,
+106,0,2,0,50,0,1,0,4,0,107,0,2,0,50,0,1,0,4,0,45,0,2,0,50,0,1,0,4,0,108,0,
+2,0,50,0,1,0,4,0,47,0,2,0,50,0,1,0,4,0,109,0,2,0,50,0,2,0,4,0,11,0,12,0,0,
+0,17,0,44,0,2,0,46,0,46,0,30,0,48,0,49,0,31,0,4,0,0,0,1,0,8,0,1,0,42,0,3,
+0,12,0,22,0,32,0,1,0,4,0,110,0,2,0,60,0,1,0,4,0,112,0,2,0,60,0,1,0,4,0,111,
+0,2,0,60,0,1,0,3,0,43,0,46,0,49,0,4,0,0,0,1,0,8,0,1,0,34,0,1,0,8,0,3,0,8,
+0,14,0,20,0,110,0,2,0,43,0,112,0,2,0,46,0,111,0,2,0,49,0,1,0,1,0,60,0,4,0,
+0,0,1,0,8,0,1,2,238,0,62,0,130,0,140,0,150,0,160,0,170,0,180,0,190,0,200,
+0,210,0,220,0,230,0,240,0,250,1,4,1,14,1,24,1,34,1,44,1,54,1,64,1,74,1,84,
+1,94,1,104,1,114,1,124,1,134,1,144,1,154,1,164,1,174,1,184,1,194,1,204,1,
+214,1,224,1,234,1,244,1,254,2,8,2,18,2,28,2,38,2,48,2,58,2,68,2,78,2,88,2,
+98,2,108,2,118,2,128,2,138,2,148,2,158,2,168,2,178,2,188,2,198,2,208,2,218,
+2,228,0,1,0,4,0,113,0,2,0,60,0,1,0,4,0,114,0,2,0,60,0,1,0,4,0,115,0,2,0,60,
+0,1,0,4,0,116,0,2,0,60,0,1,0,4,0,117,0,2,0,60,0,1,0,4,0,118,0,2,0,60,0,1,
+0,4,0,119,0,2,0,60,0,1,0,4,0,120,0,2,0,60,0,1,0,4,0,121,0,2,0,60,0,1,0,4,
+0,122,0,2,0,60,0,1,0,4,0,123,0,2,0,60,0,1,0,4,0,124,0,2,0,60,0,1,0,4,0,125,
+0,2,0,60,0,1,0,4,0,126,0,2,0,60,0,1,0,4,0,127,0,2,0,60,0,1,0,4,0,128,0,2,
+0,60,0,1,0,4,0,129,0,2,0,60,0,1,0,4,0,130,0,2,0,60,0,1,0,4,0,131,0,2,0,60,
+0,1,0,4,0,132,0,2,0,60,0,1,0,4,0,133,0,2,0,60,0,1,0,4,0,134,0,2,0,60,0,1,
+0,4,0,135,0,2,0,60,0,1,0,4,0,136,0,2,0,60,0,1,0,4,0,137,0,2,0,60,0,1,0,4,
+0,138,0,2,0,60,0,1,0,4,0,139,0,2,0,60,0,1,0,4,0,140,0,2,0,60,0,1,0,4,0,171,
+0,2,0,60,0,1,0,4,0,141,0,2,0,60,0,1,0,4,0,173,0,2,0,60,0,1,0,4,0,142,0,2,
+0,60,0,1,0,4,0,143,0,2,0,60,0,1,0,4,0,145,0,2,0,60,0,1,0,4,0,146,0,2,0,60,
+0,1,0,4,0,151,0,2,0,60,0,1,0,4,0,156,0,2,0,60,0,1,0,4,0,165,0,2,0,60,0,1,
+0,4,0,144,0,2,0,60,0,1,0,4,0,147,0,2,0,60,0,1,0,4,0,148,0,2,0,60,0,1,0,4,
+0,149,0,2,0,60,0,1,0,4,0,150,0,2,0,60,0,1,0,4,0,152,0,2,0,60,0,1,0,4,0,153,
+0,2,0,60,0,1,0,4,0,154,0,2,0,60,0,1,0,4,0,155,0,2,0,60,0,1,0,4,0,157,0,2,
+0,60,0,1,0,4,0,158,0,2,0,60,0,1,0,4,0,159,0,2,0,60,0,1,0,4,0,160,0,2,0,60,
+0,1,0,4,0,161,0,2,0,60,0,1,0,4,0,162,0,2,0,60,0,1,0,4,0,163,0,2,0,60,0,1,
+0,4,0,164,0,2,0,60,0,1,0,4,0,166,0,2,0,60,0,1,0,4,0,167,0,2,0,60,0,1,0,4,
+0,168,0,2,0,60,0,1,0,4,0,169,0,2,0,60,0,1,0,4,0,170,0,2,0,60,0,1,0,4,0,172,
+0,2,0,60,0,1,0,4,0,174,0,2,0,60,0,2,0,3,0,17,0,49,0,0,0,62,0,66,0,33,0,86,
+0,109,0,38,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,175,0,2,0,60,0,1,0,
+1,0,42,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,175,0,2,0,42,0,1,0,1,0,
+60,0,6,0,0,0,1,0,8,0,2,0,16,0,26,0,34,0,44,0,2,0,0,0,66,0,2,0,1,0,110,0,112,
+0,0,0,1,0,1,0,1,0,1,0,2,0,1,0,110,0,112,0,1,0,2,0,3,0,61,0,61,0,1,0,82,0,
+82,0,1,0,110,0,112,0,1,0,1,0,4,0,0,0,1,0,1,0,1,0,1,0,0,0,7,0,2,0,0,0,1,0,
+8,0,1,0,30,0,3,0,12,0,18,0,24,0,2,0,60,0,43,0,2,0,60,0,49,0,2,0,60,0,46,0,
+2,0,1,0,110,0,112,0,0,0,4,0,0,0,1,0,8,0,1,0,146,0,5,0,16,0,42,0,68,0,94,0,
+120,0,3,0,8,0,14,0,20,0,184,0,2,0,54,0,189,0,2,0,55,0,179,0,2,0,60,0,3,0,
+8,0,14,0,20,0,185,0,2,0,54,0,190,0,2,0,55,0,180,0,2,0,60,0,3,0,8,0,14,0,20,
+0,181,0,2,0,54,0,186,0,2,0,55,0,176,0,2,0,60,0,3,0,8,0,14,0,20,0,182,0,2,
+0,54,0,187,0,2,0,55,0,177,0,2,0,60,0,3,0,8,0,14,0,20,0,183,0,2,0,54,0,188,
+0,2,0,55,0,178,0,2,0,60,0,1,0,5,0,61,0,82,0,110,0,111,0,112,0,4,0,0,0,1,0,
+8,0,1,0,52,0,3,0,12,0,22,0,34,0,1,0,4,0,191,0,2,0,110,0,1,0,4,0,195,0,3,0,
+55,0,77,0,2,0,6,0,12,0,196,0,2,0,54,0,197,0,2,0,55,0,1,0,3,0,17,0,36,0,66,
+0,6,0,0,0,1,0,8,0,2,0,16,0,26,0,84,0,94,0,2,0,0,0,102,0,2,0,1,0,110,0,112,
+0,0,0,2,0,9,0,22,0,23,0,1,0,26,0,32,0,1,0,34,0,34,0,1,0,36,0,36,0,1,0,38,
+0,38,0,1,0,40,0,40,0,1,0,43,0,46,0,1,0,49,0,49,0,1,0,66,0,66,0,1,0,2,0,1,
+0,110,0,112,0,1,0,1,0,1,0,1,0,1,0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,11,0,1,
+0,0,0,1,0,8,0,1,0,6,0,82,0,2,0,1,0,110,0,112,0,0,0,5,0,0,0,1,0,8,0,2,0,14,
+0,50,0,3,0,0,0,102,0,0,0,1,0,16,0,45,0,88,0,90,0,91,0,92,0,93,0,94,0,95,0,
+96,0,97,0,99,0,101,0,104,0,107,0,108,0,109,0,2,0,8,0,45,0,45,0,1,0,54,0,55,
+0,2,0,88,0,88,0,1,0,90,0,97,0,1,0,99,0,99,0,1,0,101,0,101,0,1,0,104,0,104,
+0,1,0,107,0,109,0,1,0,1,0,4,0,2,0,1,0,2,0,1,0,13,0,1,0,0,0,1,0,8,0,1,0,6,
+0,159,0,1,0,2,0,54,0,55,0,4,0,0,0,1,0,8,0,1,1,142,0,14,0,34,0,60,0,86,0,112,
+0,138,0,164,0,190,0,216,0,242,1,12,1,38,1,64,1,90,1,116,0,3,0,8,0,14,0,20,
+0,198,0,2,0,5,0,198,0,2,0,77,1,18,0,2,0,78,0,3,0,8,0,14,0,20,0,199,0,2,0,
+5,0,199,0,2,0,77,1,19,0,2,0,78,0,3,0,8,0,14,0,20,0,200,0,2,0,5,0,200,0,2,
+0,77,1,20,0,2,0,78,0,3,0,8,0,14,0,20,0,201,0,2,0,5,0,201,0,2,0,77,1,21,0,
+2,0,78,0,3,0,8,0,14,0,20,0,202,0,2,0,5,0,202,0,2,0,77,1,22,0,2,0,78,0,3,0,
+8,0,14,0,20,0,203,0,2,0,5,0,203,0,2,0,77,1,23,0,2,0,78,0,3,0,8,0,14,0,20,
+0,204,0,2,0,5,0,204,0,2,0,77,1,24,0,2,0,78,0,3,0,8,0,14,0,20,0,205,0,2,0,
+5,0,205,0,2,0,77,1,25,0,2,0,78,0,3,0,8,0,14,0,20,0,206,0,2,0,5,0,206,0,2,
+0,77,1,26,0,2,0,78,0,3,0,8,0,14,0,20,0,207,0,2,0,5,0,207,0,2,0,77,1,27,0,
+2,0,78,0,3,0,8,0,14,0,20,0,208,0,2,0,5,0,208,0,2,0,77,1,28,0,2,0,78,0,3,0,
+8,0,14,0,20,0,209,0,2,0,5,0,209,0,2,0,77,1,29,0,2,0,78,0,3,0,8,0,14,0,20,
+0,210,0,2,0,5,0,210,0,2,0,77,1,30,0,2,0,78,0,3,0,8,0,14,0,20,0,211,0,2,0,
+5,0,211,0,2,0,77,1,31,0,2,0,78,0,2,0,4,0,10,0,16,0,0,0,53,0,53,0,7,0,56,0,
+59,0,8,0,84,0,85,0,12,0,6,0,0,0,1,0,8,0,2,0,16,0,22,0,44,0,52,0,2,0,0,0,60,
+0,1,0,1,0,78,0,2,0,3,0,5,0,5,0,1,0,77,0,77,0,1,0,198,0,211,0,1,0,1,0,78,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,16,0,1,0,0,0,1,0,
+8,0,1,0,6,0,134,0,1,0,1,0,78,0,6,0,0,0,1,0,8,0,2,0,18,0,34,0,80,0,102,0,3,
+0,0,0,110,0,146,0,1,0,6,0,58,0,208,1,26,1,27,1,28,1,29,0,2,0,7,0,28,0,28,
+0,2,0,36,0,36,0,2,0,61,0,61,0,1,0,82,0,82,0,1,0,94,0,94,0,2,0,101,0,101,0,
+2,0,192,0,194,0,1,0,2,0,3,0,58,0,58,0,1,0,208,0,208,0,1,1,26,1,29,0,2,0,1,
+0,1,0,1,0,1,0,2,0,6,0,22,0,2,0,1,0,2,0,1,0,0,0,1,0,0,0,18,0,1,0,2,0,1,0,0,
+0,1,0,0,0,18,0,2,0,6,0,22,0,2,0,1,0,2,0,1,0,0,0,1,0,0,0,19,0,1,0,2,0,1,0,
+0,0,1,0,0,0,19,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,215,0,216,0,1,0,2,0,58,0,208,
+0,2,0,0,0,1,0,8,0,1,0,38,0,4,0,14,0,20,0,26,0,32,0,2,0,56,0,78,0,2,0,57,0,
+78,0,2,0,215,0,78,0,2,0,59,0,78,0,2,0,1,1,26,1,29,0,0,0,4,0,0,0,1,0,8,0,1,
+2,238,0,62,0,130,0,140,0,150,0,160,0,170,0,180,0,190,0,200,0,210,0,220,0,
+230,0,240,0,250,1,4,1,14,1,24,1,34,1,44,1,54,1,64,1,74,1,84,1,94,1,104,1,
+114,1,124,1,134,1,144,1,154,1,164,1,174,1,184,1,194,1,204,1,214,1,224,1,234,
+1,244,1,254,2,8,2,18,2,28,2,38,2,48,2,58,2,68,2,78,2,88,2,98,2,108,2,118,
+2,128,2,138,2,148,2,158,2,168,2,178,2,188,2,198,2,208,2,218,2,228,0,1,0,4,
+0,113,0,2,0,60,0,1,0,4,0,114,0,2,0,60,0,1,0,4,0,115,0,2,0,60,0,1,0,4,0,116,
+0,2,0,60,0,1,0,4,0,117,0,2,0,60,0,1,0,4,0,118,0,2,0,60,0,1,0,4,0,119,0,2,
+0,60,0,1,0,4,0,120,0,2,0,60,0,1,0,4,0,121,0,2,0,60,0,1,0,4,0,122,0,2,0,60,
+0,1,0,4,0,123,0,2,0,60,0,1,0,4,0,124,0,2,0,60,0,1,0,4,0,125,0,2,0,60,0,1,
+0,4,0,126,0,2,0,60,0,1,0,4,0,127,0,2,0,60,0,1,0,4,0,128,0,2,0,60,0,1,0,4,
+0,129,0,2,0,60,0,1,0,4,0,130,0,2,0,60,0,1,0,4,0,131,0,2,0,60,0,1,0,4,0,132,
+0,2,0,60,0,1,0,4,0,133,0,2,0,60,0,1,0,4,0,134,0,2,0,60,0,1,0,4,0,135,0,2,
+0,60,0,1,0,4,0,136,0,2,0,60,0,1,0,4,0,137,0,2,0,60,0,1,0,4,0,138,0,2,0,60,
+0,1,0,4,0,139,0,2,0,60,0,1,0,4,0,140,0,2,0,60,0,1,0,4,0,171,0,2,0,60,0,1,
+0,4,0,141,0,2,0,60,0,1,0,4,0,173,0,2,0,60,0,1,0,4,0,142,0,2,0,60,0,1,0,4,
+0,143,0,2,0,60,0,1,0,4,0,145,0,2,0,60,0,1,0,4,0,146,0,2,0,60,0,1,0,4,0,151,
+0,2,0,60,0,1,0,4,0,156,0,2,0,60,0,1,0,4,0,165,0,2,0,60,0,1,0,4,0,144,0,2,
+0,60,0,1,0,4,0,147,0,2,0,60,0,1,0,4,0,148,0,2,0,60,0,1,0,4,0,149,0,2,0,60,
+0,1,0,4,0,150,0,2,0,60,0,1,0,4,0,152,0,2,0,60,0,1,0,4,0,153,0,2,0,60,0,1,
+0,4,0,154,0,2,0,60,0,1,0,4,0,155,0,2,0,60,0,1,0,4,0,157,0,2,0,60,0,1,0,4,
+0,158,0,2,0,60,0,1,0,4,0,159,0,2,0,60,0,1,0,4,0,160,0,2,0,60,0,1,0,4,0,161,
+0,2,0,60,0,1,0,4,0,162,0,2,0,60,0,1,0,4,0,163,0,2,0,60,0,1,0,4,0,164,0,2,
+0,60,0,1,0,4,0,166,0,2,0,60,0,1,0,4,0,167,0,2,0,60,0,1,0,4,0,168,0,2,0,60,
+0,1,0,4,0,169,0,2,0,60,0,1,0,4,0,170,0,2,0,60,0,1,0,4,0,172,0,2,0,60,0,1,
+0,4,0,174,0,2,0,60,0,2,0,3,0,17,0,49,0,0,0,62,0,66,0,33,0,86,0,109,0,38,0,
+0,};
+#endif
@@ -0,0 +1,300 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansHanunoo_Regular_ttf_size = 7220;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansHanunoo_Regular_ttf");
+asm(".type fz_font_NotoSansHanunoo_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansHanunoo_Regular_ttf, 7220");
+asm(".balign 64");
+asm("fz_font_NotoSansHanunoo_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansHanunoo-Regular.ttf\"");
+#else
+const int fz_font_NotoSansHanunoo_Regular_ttf_size = 7220;
+const char fz_font_NotoSansHanunoo_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,98,0,96,0,0,25,220,0,0,0,42,71,
+80,79,83,234,220,240,28,0,0,26,8,0,0,1,26,71,83,85,66,41,47,33,163,0,0,27,
+36,0,0,1,14,79,83,47,50,123,179,107,247,0,0,1,104,0,0,0,96,99,109,97,112,
+232,58,47,84,0,0,2,116,0,0,0,84,103,97,115,112,0,22,0,35,0,0,25,204,0,0,0,
+16,103,108,121,102,159,172,177,27,0,0,3,32,0,0,14,198,104,101,97,100,3,23,
+176,208,0,0,0,236,0,0,0,54,104,104,101,97,13,101,5,167,0,0,1,36,0,0,0,36,
+104,109,116,120,240,237,7,110,0,0,1,200,0,0,0,172,108,111,99,97,71,9,74,234,
+0,0,2,200,0,0,0,88,109,97,120,112,0,51,0,58,0,0,1,72,0,0,0,32,110,97,109,
+101,141,35,185,102,0,0,17,232,0,0,6,6,112,111,115,116,114,130,96,105,0,0,
+23,240,0,0,1,217,0,1,0,0,0,1,10,61,167,117,143,215,95,15,60,245,0,11,8,0,
+0,0,0,0,204,181,106,71,0,0,0,0,210,109,241,208,252,166,254,174,8,47,6,208,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,8,35,252,166,255,176,8,
+47,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,1,0,0,0,43,0,48,0,3,0,8,0,2,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,6,5,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,
+16,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,
+0,0,0,1,0,0,0,0,4,122,6,102,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,0,0,2,20,
+0,0,7,10,0,63,7,2,0,100,4,43,0,236,5,4,0,160,6,70,0,143,6,113,0,143,7,174,
+0,143,6,246,0,4,7,186,0,156,6,252,0,63,4,39,0,166,6,250,0,82,7,0,0,84,4,231,
+0,139,7,35,0,143,8,35,0,84,7,170,0,98,6,113,0,141,0,0,252,186,0,0,252,233,
+5,135,252,166,2,162,0,37,3,231,0,37,6,113,0,143,6,113,0,143,7,228,0,143,6,
+246,0,4,6,246,0,4,6,252,0,63,6,252,0,63,6,250,0,82,5,42,0,139,5,42,0,139,
+7,35,0,143,7,170,0,98,6,113,0,141,6,113,0,141,2,162,1,8,3,231,1,8,0,0,0,1,
+0,3,0,1,0,0,0,12,0,4,0,72,0,0,0,14,0,8,0,2,0,6,0,0,0,13,0,32,0,160,23,54,
+254,255,255,255,0,0,0,0,0,13,0,32,0,160,23,32,254,255,255,255,0,1,255,245,
+255,227,255,99,232,228,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,
+0,21,0,21,0,62,0,116,0,156,0,205,0,242,1,24,1,71,1,138,1,206,1,255,2,27,2,
+89,2,140,2,154,2,209,3,16,3,93,3,121,3,135,3,148,3,174,3,189,3,201,4,2,4,
+61,4,136,4,202,5,26,5,88,5,149,5,236,6,21,6,67,6,134,6,218,7,13,7,65,7,79,
+7,99,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,
+252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,0,63,0,0,7,63,5,18,
+0,19,0,0,37,54,0,1,51,0,1,35,19,5,55,37,54,51,50,22,21,20,3,2,1,233,244,2,
+107,1,51,196,252,142,253,250,162,225,254,57,43,1,84,82,64,47,41,72,88,190,
+183,2,71,1,86,252,50,254,188,3,211,223,184,166,39,62,36,82,254,217,254,137,
+0,2,0,100,0,0,7,57,5,18,0,6,0,26,0,0,1,54,54,55,23,6,5,37,54,0,1,51,0,1,35,
+1,5,55,37,54,51,50,22,21,20,7,3,4,80,213,205,84,102,233,254,229,253,59,244,
+2,107,1,51,196,252,142,253,250,162,1,12,254,57,43,1,84,82,64,47,41,39,129,
+1,33,143,168,78,109,219,180,20,183,2,71,1,86,252,50,254,188,4,109,224,187,
+164,38,61,37,51,166,253,227,0,1,0,236,0,0,4,47,5,18,0,20,0,0,1,1,33,21,1,
+35,1,33,53,0,55,6,35,34,39,55,22,22,51,50,55,4,47,253,219,2,37,253,133,200,
+2,94,253,190,1,148,80,82,52,219,155,53,129,166,92,215,176,4,193,254,36,118,
+253,145,2,90,105,1,96,61,12,61,129,32,15,47,0,2,0,160,0,0,4,188,5,18,0,17,
+0,28,0,0,51,1,38,39,51,22,23,18,33,50,22,21,20,6,35,34,39,1,1,34,6,7,22,51,
+50,54,53,52,38,160,1,57,188,27,152,22,98,113,1,0,135,178,200,146,137,129,
+254,240,2,65,92,115,47,88,121,96,109,92,3,61,215,254,186,129,1,59,182,145,
+137,197,80,253,51,4,135,170,137,76,123,86,82,92,0,1,0,143,0,0,5,182,5,18,
+0,16,0,0,1,1,35,19,55,6,6,1,35,1,51,3,6,7,55,55,1,5,182,254,213,164,189,57,
+26,156,253,10,162,1,43,164,207,16,23,109,127,2,192,5,18,250,238,3,43,233,
+34,179,252,193,5,18,252,129,79,70,135,146,2,251,0,1,0,143,0,0,6,170,5,18,
+0,15,0,0,1,51,3,7,54,0,1,51,0,7,1,7,1,0,5,35,1,186,164,200,66,244,2,106,1,
+51,197,254,90,215,1,137,108,254,116,254,160,254,211,162,5,18,252,168,252,
+183,2,71,1,86,254,54,211,254,80,99,1,172,254,179,193,0,0,1,0,143,0,0,7,254,
+5,18,0,22,0,0,1,1,51,3,6,7,54,54,1,51,1,35,19,54,55,6,7,1,35,1,51,2,2,1,106,
+2,240,162,43,4,23,27,49,2,78,174,252,188,161,41,18,4,25,149,253,135,162,1,
+43,164,100,109,1,47,3,227,253,2,145,139,49,84,3,149,250,238,3,20,246,33,41,
+203,252,201,5,18,254,82,254,54,0,2,0,4,0,0,7,53,5,100,0,33,0,37,0,0,1,6,6,
+7,54,54,55,62,3,55,51,6,8,2,7,35,19,5,55,37,54,54,51,50,22,21,20,14,2,7,19,
+3,35,19,2,33,15,28,23,49,109,51,121,252,246,235,107,196,139,254,178,254,150,
+254,133,187,161,166,254,67,41,1,78,41,69,35,47,41,4,12,23,18,209,82,164,82,
+1,186,59,117,76,37,90,41,101,231,242,248,118,153,254,158,254,159,254,191,
+117,2,213,184,178,135,16,25,61,37,29,49,64,96,76,3,129,254,156,1,100,0,0,
+2,0,156,0,0,7,72,5,18,0,31,0,41,0,0,1,22,23,54,54,51,50,22,21,20,6,35,39,
+3,35,1,38,39,1,35,1,6,35,34,38,39,55,22,51,50,55,51,5,34,6,7,23,50,54,53,
+52,38,3,164,164,219,57,146,110,101,135,183,137,117,245,166,1,0,223,160,254,
+207,166,1,96,96,133,103,223,59,55,178,156,157,115,170,2,133,61,70,31,80,88,
+78,43,4,98,108,58,172,140,115,88,129,154,9,252,233,3,55,58,104,252,39,4,111,
+35,43,28,127,59,59,170,106,92,6,75,48,34,47,0,1,0,63,0,0,7,49,5,18,0,23,0,
+0,37,54,0,1,51,0,7,1,7,1,0,5,35,19,5,55,37,54,51,50,22,21,20,2,1,219,244,
+2,106,1,52,196,254,109,238,1,141,108,254,117,254,159,254,211,161,227,254,
+69,39,1,78,86,58,47,41,144,190,183,2,71,1,86,254,72,231,254,82,99,1,172,254,
+179,193,3,211,168,172,127,35,62,36,82,253,178,0,1,0,166,0,0,4,59,5,18,0,12,
+0,0,1,1,35,1,6,35,32,39,55,22,51,50,55,4,59,253,181,174,2,2,119,156,255,0,
+139,51,154,213,237,142,5,18,250,238,4,109,21,62,124,47,47,0,0,2,0,82,0,0,
+7,47,5,18,0,22,0,28,0,0,1,20,7,1,54,1,51,0,1,1,7,1,0,5,35,19,5,55,37,54,51,
+50,22,3,54,0,55,1,3,2,176,16,1,127,243,1,88,197,254,115,254,237,1,189,99,
+254,60,254,180,254,221,162,250,254,68,41,1,76,98,47,47,41,215,113,1,69,35,
+254,201,96,4,106,34,82,254,190,232,1,118,254,74,254,248,254,139,112,1,129,
+254,202,186,4,39,193,179,141,39,62,252,47,84,1,23,39,1,8,254,98,0,1,0,84,
+0,0,6,113,5,20,0,26,0,0,37,55,55,1,51,1,35,19,55,6,6,1,35,1,5,55,37,54,51,
+50,22,21,20,6,7,3,6,2,35,108,127,2,193,162,254,213,164,188,58,27,156,253,
+11,162,1,4,254,6,43,1,141,78,68,47,41,35,33,104,17,254,135,146,2,251,250,
+238,3,43,233,34,179,252,193,4,104,247,184,195,40,63,37,59,160,139,254,73,
+79,0,0,1,0,139,2,92,4,113,2,231,0,3,0,0,1,33,55,33,4,80,252,59,33,3,197,2,
+92,139,0,1,0,143,254,174,6,162,5,18,0,29,0,0,1,6,6,1,35,1,51,3,6,7,55,55,
+1,51,2,7,37,54,51,50,21,20,2,7,39,18,53,5,35,19,4,221,26,156,253,10,162,1,
+43,164,207,16,23,109,127,2,192,162,233,25,1,33,45,49,111,135,119,105,211,
+254,66,105,189,4,20,34,179,252,193,5,18,252,129,79,70,135,146,2,251,252,5,
+89,113,21,152,113,254,238,123,90,1,0,158,166,3,43,0,1,0,84,0,0,8,31,5,18,
+0,36,0,0,1,5,55,37,54,51,50,22,21,20,3,3,7,55,0,19,55,51,21,20,22,51,50,54,
+55,23,6,6,35,34,38,39,6,0,0,7,35,2,84,254,0,43,1,141,82,64,47,41,72,80,67,
+186,1,109,192,72,104,113,94,72,125,110,107,105,192,123,117,176,25,127,254,
+156,254,217,129,100,4,109,252,184,195,38,61,37,82,254,217,254,172,243,182,
+1,98,1,127,139,151,139,152,86,154,86,160,133,137,111,220,254,105,254,254,
+80,0,1,0,98,254,227,7,125,5,18,0,40,0,0,1,1,0,5,35,18,18,19,5,55,37,54,51,
+50,22,21,20,2,2,7,0,1,1,51,2,3,54,36,55,51,6,2,21,35,16,55,4,35,35,18,18,
+5,178,254,248,253,242,254,137,162,139,185,86,254,69,39,1,76,78,71,48,41,136,
+102,59,1,100,1,238,1,4,161,159,213,92,1,22,109,129,80,86,149,51,254,227,252,
+39,123,170,4,4,254,244,253,233,225,1,37,1,239,1,93,181,172,138,32,61,37,78,
+254,37,254,236,123,1,14,2,0,1,12,253,23,254,119,18,141,89,107,254,141,215,
+1,29,150,150,1,0,1,203,0,0,1,0,141,0,0,6,168,5,18,0,10,0,0,37,54,0,1,51,0,
+1,35,1,51,3,1,82,244,2,106,1,51,197,252,141,253,250,162,1,45,162,190,190,
+183,2,71,1,86,252,50,254,188,5,18,252,209,0,1,252,186,5,219,255,45,6,102,
+0,3,0,0,3,33,55,33,244,253,174,33,2,82,5,219,139,0,0,1,252,233,0,0,255,92,
+0,139,0,3,0,0,35,33,55,33,197,253,174,33,2,82,139,0,0,1,252,166,254,227,5,
+8,6,0,0,8,0,0,1,2,0,0,33,55,32,0,19,5,8,104,253,182,252,143,253,193,31,3,
+20,3,250,147,6,0,253,174,252,195,254,114,140,3,110,3,35,0,0,1,0,37,254,227,
+2,86,6,0,0,3,0,0,19,1,51,1,37,1,162,143,254,92,254,227,7,29,248,227,255,255,
+0,37,254,227,3,156,6,0,0,38,0,25,0,0,0,7,0,25,1,70,0,0,0,1,0,143,0,0,6,170,
+5,18,0,28,0,0,1,51,3,6,6,7,54,36,55,38,38,39,55,22,22,23,54,0,55,51,6,0,7,
+1,7,1,0,5,35,1,186,164,200,16,35,15,116,1,2,145,56,115,61,96,63,122,60,137,
+1,12,136,197,212,254,195,108,1,137,108,254,116,254,159,254,212,162,5,18,252,
+168,66,124,62,87,219,136,58,109,51,114,54,114,61,132,1,23,152,230,254,179,
+106,254,80,99,1,172,254,179,193,0,0,1,0,143,0,0,6,170,5,18,0,29,0,0,1,38,
+38,39,6,6,7,1,7,1,0,5,35,1,51,3,6,6,7,54,36,55,0,1,51,6,6,7,22,23,6,60,95,
+191,103,38,70,30,1,137,108,254,116,254,159,254,212,162,1,43,164,200,16,35,
+15,123,1,19,155,1,53,1,51,197,115,196,84,208,186,1,107,112,201,92,40,69,30,
+254,80,99,1,172,254,179,193,5,18,252,168,66,124,62,92,236,146,1,36,1,86,125,
+209,88,186,226,0,2,0,143,0,0,8,47,5,18,0,28,0,40,0,0,1,1,51,3,6,7,55,54,0,
+1,51,1,35,19,54,54,55,6,6,7,1,35,1,51,6,2,7,6,6,5,54,18,55,23,14,5,7,1,106,
+2,240,162,43,5,22,51,13,1,51,1,39,174,252,188,161,41,9,11,2,13,86,75,253,
+135,162,1,43,164,50,77,28,27,45,4,206,121,178,61,126,17,52,62,70,71,69,30,
+1,47,3,227,253,2,145,139,91,21,1,224,1,202,250,238,3,20,125,137,17,20,121,
+103,252,201,5,18,215,254,183,115,115,167,82,151,1,7,109,72,31,85,97,103,99,
+88,33,0,0,2,0,4,0,0,7,53,5,18,0,33,0,37,0,0,1,6,6,7,54,54,55,62,3,55,51,6,
+8,2,7,35,19,5,55,37,54,54,51,50,22,21,20,14,2,7,19,33,55,33,2,33,15,28,23,
+49,109,51,121,252,246,235,107,196,139,254,178,254,150,254,133,187,161,166,
+254,67,41,1,78,41,69,35,47,41,4,12,23,18,121,253,174,33,2,82,1,186,59,117,
+76,37,90,41,101,231,242,248,118,153,254,158,254,159,254,191,117,2,213,184,
+178,135,16,25,61,37,29,49,64,96,76,2,54,139,0,3,0,4,0,0,7,53,5,100,0,33,0,
+37,0,44,0,0,1,6,6,7,54,54,55,62,3,55,51,6,8,2,7,35,19,5,55,37,54,54,51,50,
+22,21,20,14,2,7,19,3,35,19,1,54,54,55,23,6,5,2,33,15,28,23,49,109,51,121,
+252,246,235,107,196,139,254,178,254,150,254,133,187,161,166,254,67,41,1,78,
+41,69,35,47,41,4,12,23,18,209,82,164,82,1,248,213,205,84,102,233,254,229,
+1,186,59,117,76,37,90,41,101,231,242,248,118,153,254,158,254,159,254,191,
+117,2,213,184,178,135,16,25,61,37,29,49,64,96,76,3,129,254,156,1,100,251,
+189,143,168,78,109,219,180,0,0,1,0,63,0,0,7,49,5,18,0,31,0,0,37,54,1,38,38,
+39,55,22,22,23,0,1,51,0,7,1,7,1,0,5,35,19,5,55,37,54,51,50,22,21,20,2,1,219,
+230,1,33,56,116,60,96,63,122,60,1,15,1,15,196,254,109,238,1,141,108,254,117,
+254,159,254,211,161,227,254,69,39,1,78,86,58,47,41,144,190,173,1,13,58,108,
+52,114,54,113,61,1,5,1,45,254,72,231,254,82,99,1,172,254,179,193,3,211,168,
+172,127,35,62,36,82,253,178,0,1,0,63,0,0,7,49,5,18,0,31,0,0,1,38,38,39,6,
+7,1,7,1,0,5,35,19,5,55,37,54,51,50,22,21,20,2,7,54,0,1,51,6,7,22,23,6,195,
+96,190,103,77,65,1,141,108,254,117,254,159,254,211,161,227,254,69,39,1,78,
+86,58,47,41,144,49,244,2,106,1,52,196,223,172,207,187,1,107,112,201,92,78,
+63,254,82,99,1,172,254,179,193,3,211,168,172,127,35,62,36,82,253,178,185,
+183,2,71,1,86,243,180,183,228,0,0,2,0,82,255,114,7,47,5,18,0,37,0,47,0,0,
+1,20,7,1,54,0,55,51,0,1,5,22,22,21,20,6,7,7,39,54,54,55,1,6,4,7,35,19,5,55,
+37,54,54,51,50,30,2,3,54,54,55,54,55,1,3,6,6,2,176,16,1,127,122,1,36,173,
+197,254,114,254,238,1,30,57,57,49,51,252,98,78,139,63,254,176,167,254,202,
+146,162,250,254,68,41,1,76,48,74,23,24,33,21,10,215,57,137,81,162,36,254,
+201,96,15,35,4,106,36,80,254,190,117,1,45,188,254,74,254,248,240,48,69,32,
+30,64,42,213,111,60,117,63,1,31,156,246,94,4,39,193,179,141,20,19,17,28,36,
+252,66,42,111,70,138,41,1,8,254,98,66,123,0,0,1,0,139,0,0,4,178,5,18,0,21,
+0,0,33,19,33,55,33,19,62,3,51,50,22,23,23,7,37,3,33,7,33,3,1,147,137,254,
+111,33,1,143,93,6,23,34,45,28,34,80,35,253,38,254,178,93,1,174,33,254,83,
+139,2,92,139,1,151,26,53,42,27,12,7,47,137,53,254,107,139,253,164,0,0,1,0,
+139,255,241,4,143,5,3,0,24,0,0,1,33,3,37,7,5,6,6,35,34,38,53,52,62,2,55,19,
+33,55,33,19,51,3,33,4,110,254,82,106,1,101,25,254,238,38,86,34,41,34,6,9,
+10,3,89,254,111,33,1,143,124,163,123,1,176,2,92,254,46,50,137,47,7,12,56,
+38,7,33,40,41,15,1,133,139,2,28,253,228,0,0,2,0,143,254,174,6,242,5,18,0,
+32,0,36,0,0,1,6,6,7,1,35,1,51,3,6,6,7,55,1,51,2,2,7,37,54,54,51,50,21,20,
+7,6,7,39,18,53,5,35,1,33,55,33,4,221,13,51,40,252,188,162,1,43,164,207,9,
+19,11,109,3,63,162,116,129,13,1,33,23,46,25,111,68,68,118,105,211,254,66,
+105,2,234,254,115,33,1,141,4,20,17,62,45,252,104,5,18,252,129,40,74,35,135,
+3,141,254,3,253,213,44,113,9,12,152,112,138,138,122,90,1,0,158,166,1,214,
+139,0,2,0,98,254,227,7,206,5,18,0,40,0,44,0,0,1,1,0,5,35,18,18,19,5,55,37,
+54,51,50,22,21,20,2,2,7,0,1,1,51,2,3,54,36,55,51,6,2,21,35,16,55,4,35,35,
+18,18,5,33,55,33,5,178,254,248,253,242,254,137,162,139,185,86,254,69,39,1,
+76,78,71,48,41,136,102,59,1,100,1,238,1,4,161,159,213,92,1,22,109,129,80,
+86,149,51,254,227,252,39,123,170,2,83,254,115,33,1,141,4,4,254,244,253,233,
+225,1,37,1,239,1,93,181,172,138,32,61,37,78,254,37,254,236,123,1,14,2,0,1,
+12,253,23,254,119,18,141,89,107,254,141,215,1,29,150,150,1,0,1,203,165,139,
+0,2,0,141,0,0,6,168,6,208,0,14,0,24,0,0,37,54,36,55,0,1,51,0,1,35,1,51,3,
+6,6,1,54,54,55,23,14,3,7,1,82,123,1,19,155,1,53,1,51,197,252,139,253,252,
+162,1,45,162,190,17,41,2,27,128,197,73,111,30,96,112,120,52,190,92,236,146,
+1,36,1,86,252,49,254,189,5,18,252,209,73,145,4,40,116,209,90,90,37,109,119,
+118,45,0,0,2,0,141,0,0,6,168,5,18,0,14,0,26,0,0,37,54,36,55,0,1,51,0,1,35,
+1,51,3,6,6,37,54,54,55,23,14,5,7,1,82,123,1,19,155,1,53,1,51,197,252,139,
+253,252,162,1,45,162,190,17,41,2,139,145,219,79,117,22,65,78,87,86,83,35,
+190,92,236,146,1,36,1,86,252,49,254,189,5,18,252,209,73,145,55,128,230,97,
+94,28,75,85,90,85,76,27,0,1,1,8,254,227,1,152,6,0,0,3,0,0,1,17,51,17,1,8,
+144,254,227,7,29,248,227,0,0,2,1,8,254,227,2,223,6,0,0,3,0,7,0,0,1,17,51,
+17,51,17,51,17,1,8,144,184,143,254,227,7,29,248,227,7,29,248,227,0,0,0,0,
+0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,
+9,0,2,0,14,0,128,0,3,0,1,4,9,0,3,0,72,0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,
+0,1,4,9,0,5,0,30,0,214,0,3,0,1,4,9,0,6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,
+18,0,3,0,1,4,9,0,8,0,42,1,86,0,3,0,1,4,9,0,9,0,40,1,128,0,3,0,1,4,9,0,10,
+0,96,1,168,0,3,0,1,4,9,0,11,0,62,2,8,0,3,0,1,4,9,0,12,0,60,2,70,0,3,0,1,4,
+9,0,13,2,150,2,130,0,3,0,1,4,9,0,14,0,52,5,24,0,67,0,111,0,112,0,121,0,114,
+0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,
+0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,
+0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,72,0,
+97,0,110,0,117,0,110,0,111,0,111,0,82,0,101,0,103,0,117,0,108,0,97,0,114,
+0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,
+0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,
+110,0,115,0,32,0,72,0,97,0,110,0,117,0,110,0,111,0,111,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,
+0,116,0,111,0,83,0,97,0,110,0,115,0,72,0,97,0,110,0,117,0,110,0,111,0,111,
+0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,
+100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,
+110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,
+97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,
+0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,
+119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,
+0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,
+0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,
+0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,
+0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,
+0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,
+0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,
+0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,
+0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,
+0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,
+0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,
+0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,
+0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,
+76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,
+0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,
+0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,
+0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,
+0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,
+0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,
+0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,
+0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,
+0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,
+0,0,0,0,255,181,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,0,1,2,
+0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,
+17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,
+1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,4,110,117,108,108,7,117,
+110,105,49,55,50,48,7,117,110,105,49,55,50,49,7,117,110,105,49,55,50,50,7,
+117,110,105,49,55,50,51,7,117,110,105,49,55,50,52,7,117,110,105,49,55,50,
+53,7,117,110,105,49,55,50,54,7,117,110,105,49,55,50,55,7,117,110,105,49,55,
+50,56,7,117,110,105,49,55,50,57,7,117,110,105,49,55,50,65,7,117,110,105,49,
+55,50,66,7,117,110,105,49,55,50,67,7,117,110,105,49,55,50,68,7,117,110,105,
+49,55,50,69,7,117,110,105,49,55,50,70,7,117,110,105,49,55,51,48,7,117,110,
+105,49,55,51,49,7,117,110,105,49,55,51,50,7,117,110,105,49,55,51,51,7,117,
+110,105,49,55,51,52,7,117,110,105,49,55,51,53,7,117,110,105,49,55,51,54,9,
+117,110,105,49,55,50,53,95,105,9,117,110,105,49,55,50,53,95,117,9,117,110,
+105,49,55,50,54,95,117,9,117,110,105,49,55,50,55,95,105,9,117,110,105,49,
+55,50,55,95,117,9,117,110,105,49,55,50,57,95,105,9,117,110,105,49,55,50,57,
+95,117,9,117,110,105,49,55,50,66,95,117,9,117,110,105,49,55,50,68,95,105,
+9,117,110,105,49,55,50,68,95,117,9,117,110,105,49,55,50,69,95,117,9,117,110,
+105,49,55,51,48,95,117,9,117,110,105,49,55,51,49,95,105,9,117,110,105,49,
+55,51,49,95,117,11,117,110,105,49,55,51,53,46,97,108,116,11,117,110,105,49,
+55,51,54,46,97,108,116,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,15,0,1,0,
+0,0,12,0,0,0,34,0,0,0,2,0,3,0,0,0,21,0,1,0,22,0,23,0,3,0,24,0,42,0,1,0,4,
+0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,30,0,46,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,
+255,0,1,0,0,0,1,109,97,114,107,0,8,0,0,0,2,0,0,0,1,0,2,0,6,0,132,0,4,0,0,
+0,1,0,8,0,1,0,12,0,18,0,1,0,42,0,54,0,1,0,1,0,22,0,1,0,10,0,7,0,8,0,10,0,
+12,0,14,0,15,0,16,0,18,0,19,0,20,0,1,0,0,0,6,0,1,254,2,5,200,0,10,0,28,0,
+46,0,22,0,58,0,28,0,34,0,40,0,46,0,52,0,58,0,1,5,0,5,200,0,1,3,32,5,200,0,
+1,2,28,5,200,0,1,5,140,5,200,0,1,4,176,5,200,0,1,4,236,5,200,0,1,5,180,5,
+200,0,4,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,34,0,46,0,1,0,1,0,23,0,1,0,6,0,7,
+0,8,0,12,0,14,0,16,0,19,0,1,0,0,0,6,0,1,254,32,0,0,0,6,0,14,0,20,0,26,0,32,
+0,38,0,44,0,1,2,18,0,0,0,1,4,56,254,252,0,1,5,80,0,0,0,1,2,168,0,0,0,1,5,
+240,0,0,0,1,6,144,1,194,0,0,0,1,0,0,0,10,0,32,0,58,0,1,68,70,76,84,0,8,0,
+4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,99,99,109,112,0,14,115,97,108,116,0,20,
+0,0,0,1,0,0,0,0,0,1,0,1,0,2,0,6,0,190,0,4,0,0,0,1,0,8,0,1,0,154,0,9,0,24,
+0,42,0,52,0,70,0,88,0,98,0,116,0,126,0,136,0,2,0,6,0,12,0,27,0,2,0,22,0,28,
+0,2,0,23,0,1,0,4,0,29,0,2,0,23,0,2,0,6,0,12,0,30,0,2,0,22,0,31,0,2,0,23,0,
+2,0,6,0,12,0,32,0,2,0,22,0,33,0,2,0,23,0,1,0,4,0,34,0,2,0,23,0,2,0,6,0,12,
+0,35,0,2,0,22,0,36,0,2,0,23,0,1,0,4,0,37,0,2,0,23,0,1,0,4,0,38,0,2,0,23,0,
+2,0,6,0,12,0,39,0,2,0,22,0,40,0,2,0,23,0,1,0,9,0,9,0,10,0,11,0,13,0,15,0,
+17,0,18,0,20,0,21,0,1,0,0,0,1,0,8,0,1,0,6,0,16,0,1,0,2,0,25,0,26,0,0,};
+#endif
@@ -0,0 +1,799 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansHebrew_Regular_ttf_size = 20516;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansHebrew_Regular_ttf");
+asm(".type fz_font_NotoSansHebrew_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansHebrew_Regular_ttf, 20516");
+asm(".balign 64");
+asm("fz_font_NotoSansHebrew_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansHebrew-Regular.ttf\"");
+#else
+const int fz_font_NotoSansHebrew_Regular_ttf_size = 20516;
+const char fz_font_NotoSansHebrew_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,8,62,12,82,0,0,46,232,0,0,0,156,71,
+80,79,83,86,245,67,68,0,0,47,132,0,0,29,48,71,83,85,66,70,163,44,166,0,0,
+76,180,0,0,3,112,79,83,47,50,133,203,179,113,0,0,1,104,0,0,0,96,99,109,97,
+112,64,132,32,241,0,0,4,48,0,0,0,172,103,97,115,112,0,7,0,7,0,0,46,220,0,
+0,0,12,103,108,121,102,130,233,195,148,0,0,6,20,0,0,28,52,104,101,97,100,
+254,58,96,88,0,0,0,236,0,0,0,54,104,104,101,97,12,81,3,2,0,0,1,36,0,0,0,36,
+104,109,116,120,159,138,249,236,0,0,1,200,0,0,2,102,108,111,99,97,59,39,66,
+97,0,0,4,220,0,0,1,56,109,97,120,112,0,181,0,208,0,0,1,72,0,0,0,32,110,97,
+109,101,140,59,184,152,0,0,34,72,0,0,6,0,112,111,115,116,163,30,3,103,0,0,
+40,72,0,0,6,146,0,1,0,0,0,1,10,61,95,130,228,220,95,15,60,245,0,11,8,0,0,
+0,0,0,201,49,62,251,0,0,0,0,210,40,203,235,253,170,254,96,6,23,7,215,0,0,
+0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,6,203,253,170,253,246,6,23,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,0,1,0,0,0,155,0,128,0,16,0,78,0,6,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,4,102,1,144,0,5,0,0,5,154,5,51,0,0,
+1,27,5,154,5,51,0,0,3,209,0,102,2,139,8,5,2,11,5,2,4,5,4,2,2,4,0,0,8,0,64,
+0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,33,0,32,0,0,5,124,7,215,0,0,0,32,0,4,4,205,0,193,0,0,0,0,4,20,
+0,0,2,57,0,0,0,0,255,68,0,0,0,43,0,0,255,109,0,0,0,94,0,0,0,96,0,0,255,78,
+0,0,255,104,0,0,254,213,0,0,254,184,0,0,0,0,0,0,255,41,0,0,0,0,0,0,0,0,0,
+0,254,184,0,0,253,246,0,0,0,0,0,0,255,92,0,0,255,68,0,0,255,72,0,0,255,94,
+0,0,255,106,0,0,254,184,0,0,255,98,0,0,255,92,0,0,254,20,0,0,255,68,0,0,255,
+94,0,0,255,72,0,0,0,0,0,0,253,170,0,0,255,41,0,0,255,176,0,0,254,211,0,0,
+254,242,0,0,254,242,0,0,255,176,0,0,255,61,0,0,255,61,0,0,255,92,0,0,255,
+92,0,0,255,176,0,0,255,176,0,0,255,18,0,0,255,176,0,0,255,201,3,16,0,133,
+0,0,255,92,4,129,1,244,0,0,255,176,0,0,255,176,2,57,0,186,0,0,255,176,0,0,
+255,176,3,8,0,154,0,0,0,53,5,6,0,66,4,201,0,82,3,98,0,63,4,111,0,41,5,18,
+0,152,2,20,0,174,2,150,0,51,5,68,0,174,5,57,0,164,2,20,0,174,4,70,0,39,4,
+51,0,80,4,61,0,70,5,109,0,174,5,127,0,55,2,20,0,174,3,29,0,72,5,63,0,51,4,
+168,0,41,4,252,0,133,4,225,0,143,4,8,0,10,4,92,0,10,4,184,0,123,4,70,0,39,
+5,215,0,51,5,135,0,61,4,18,0,174,4,18,0,174,4,18,0,174,3,20,0,215,4,211,0,
+215,6,203,0,180,2,20,0,174,0,0,254,182,4,18,0,174,4,168,0,41,5,6,0,66,4,111,
+0,41,5,18,0,152,4,51,0,80,4,61,0,70,5,109,0,174,4,70,0,39,5,135,0,61,4,127,
+0,90,5,215,0,51,5,215,0,51,5,215,0,51,5,215,0,51,5,6,0,66,5,6,0,66,5,6,0,
+66,4,201,0,82,3,98,0,63,4,111,0,41,5,18,0,152,2,20,255,186,2,150,255,203,
+5,57,0,164,2,20,255,186,4,70,0,39,4,51,0,80,4,61,0,70,5,127,0,55,3,29,0,72,
+5,63,0,51,4,252,0,133,4,225,0,143,4,92,0,10,4,184,0,123,4,70,0,39,5,215,0,
+51,5,135,0,61,2,20,0,174,4,201,0,82,4,51,0,80,4,225,0,143,5,6,0,80,4,61,255,
+107,4,61,255,107,4,70,0,39,4,70,0,39,5,6,0,80,5,6,0,80,5,6,0,80,4,61,0,70,
+5,6,0,66,0,0,254,38,0,0,254,18,0,0,254,92,4,193,0,98,0,0,255,220,255,37,255,
+220,254,81,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,160,0,0,0,36,0,32,0,4,0,4,0,
+0,0,13,0,32,0,160,5,199,5,234,5,244,32,15,32,170,37,204,251,54,251,60,251,
+62,251,65,251,68,251,79,254,255,255,255,0,0,0,0,0,13,0,32,0,160,5,145,5,208,
+5,240,32,12,32,170,37,204,251,29,251,56,251,62,251,64,251,67,251,70,254,255,
+255,255,0,1,255,245,255,227,255,99,250,115,250,107,250,102,224,139,223,177,
+218,202,5,63,5,62,5,61,5,60,5,59,5,58,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,53,
+0,107,0,132,0,170,0,214,0,231,0,245,1,40,1,57,1,73,1,106,1,123,1,131,1,158,
+1,239,2,27,2,56,2,88,2,103,2,119,2,136,2,163,2,183,2,192,2,236,2,244,3,4,
+3,19,3,28,3,37,3,75,3,112,3,197,3,240,4,31,4,53,4,91,4,144,4,157,4,174,4,
+196,4,204,5,1,5,23,5,35,5,48,5,61,5,75,5,83,5,91,5,109,5,131,5,153,5,181,
+5,201,5,249,6,22,6,66,6,83,6,113,6,126,6,154,6,181,6,225,6,238,7,6,7,38,7,
+71,7,100,7,145,7,158,7,185,7,238,8,13,8,43,8,83,8,122,8,157,8,195,8,218,9,
+16,9,57,9,69,9,81,9,93,9,107,9,128,9,180,9,192,9,217,9,233,9,241,9,249,10,
+1,10,9,10,17,10,25,10,33,10,41,10,49,10,68,10,80,10,92,10,108,10,124,10,136,
+10,148,10,160,10,172,10,184,10,196,10,208,10,219,10,230,10,242,10,254,11,
+10,11,22,11,34,11,46,11,58,11,70,11,82,11,94,11,106,11,118,11,130,11,142,
+11,154,11,166,11,178,11,190,11,202,11,236,11,251,12,6,12,18,12,30,12,42,12,
+54,12,66,12,74,12,86,12,177,12,227,13,26,13,193,13,206,13,235,14,3,14,26,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,255,68,254,127,0,190,255,
+203,0,20,0,0,19,35,53,52,38,35,34,6,21,21,35,53,52,54,55,53,51,21,22,22,21,
+190,102,38,48,51,39,100,67,70,102,72,67,254,127,47,54,46,46,54,47,49,88,90,
+11,94,94,11,91,87,0,3,0,43,5,78,1,174,6,188,0,11,0,23,0,35,0,0,1,20,6,35,
+34,38,53,52,54,51,50,22,7,20,6,35,34,38,53,52,54,51,50,22,55,20,6,35,34,38,
+53,52,54,51,50,22,1,174,46,32,34,46,46,34,32,46,229,46,32,34,46,46,34,32,
+46,114,46,32,34,45,45,34,32,46,5,155,32,45,45,32,34,46,46,34,32,45,45,32,
+34,46,46,175,34,46,46,34,32,48,48,0,0,1,255,109,5,78,0,147,6,252,0,11,0,0,
+19,7,23,7,23,7,35,55,39,55,39,55,147,155,155,155,155,176,118,155,155,155,
+155,155,6,252,86,86,86,86,86,86,86,86,86,86,0,2,0,94,5,78,1,0,6,188,0,11,
+0,23,0,0,19,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,
+38,96,46,32,34,48,47,35,32,46,2,48,32,32,48,47,33,34,46,6,109,34,45,45,34,
+32,46,46,175,34,46,48,32,32,48,46,0,0,3,0,96,5,78,1,199,6,188,0,11,0,23,0,
+27,0,0,1,52,54,51,50,22,21,20,6,35,34,38,21,52,54,51,50,22,21,20,6,35,34,
+38,7,17,51,17,1,39,46,34,32,48,48,32,34,46,46,32,33,47,46,34,32,46,199,111,
+6,109,34,45,45,34,32,46,46,175,32,48,47,33,34,46,46,46,1,110,254,146,0,1,
+255,78,254,127,0,150,255,174,0,7,0,0,7,20,22,51,21,34,38,53,68,116,102,156,
+172,82,92,105,106,160,143,0,0,1,255,104,5,88,0,152,6,168,0,3,0,0,19,7,39,
+55,152,152,152,152,6,0,168,168,168,0,0,1,254,213,5,80,1,43,6,131,0,33,0,0,
+3,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,55,22,21,
+20,6,35,34,38,39,38,38,156,28,37,57,26,109,82,65,47,81,53,40,55,32,28,37,
+57,26,109,81,62,50,83,52,44,49,6,57,38,37,64,22,72,38,120,65,82,53,74,57,
+47,38,37,64,22,72,41,117,65,82,54,73,62,42,0,1,254,184,5,78,0,0,6,127,0,7,
+0,0,3,52,38,35,53,50,22,21,111,113,104,154,174,5,78,92,104,109,159,146,0,
+1,0,0,254,127,1,66,255,231,0,5,0,0,1,35,39,55,51,7,1,66,144,178,178,144,179,
+254,127,180,180,180,0,2,255,41,254,127,0,150,255,242,0,7,0,19,0,0,23,20,6,
+35,53,50,54,53,5,52,54,51,50,22,21,20,6,35,34,38,150,170,158,101,118,255,
+0,46,32,33,47,46,34,32,46,82,141,162,106,105,92,12,32,48,47,33,34,46,46,0,
+0,1,0,0,5,78,1,72,6,127,0,7,0,0,17,52,54,51,21,34,6,21,174,154,102,115,5,
+78,145,160,109,101,95,0,255,255,0,0,5,78,1,72,6,127,0,2,0,15,0,0,0,2,254,
+184,5,78,1,72,6,127,0,7,0,15,0,0,17,52,54,51,21,34,6,21,33,52,54,51,21,34,
+6,21,174,154,102,115,254,73,172,156,102,115,5,78,145,160,109,101,95,143,162,
+109,101,95,0,4,253,246,5,59,2,10,7,41,0,15,0,27,0,43,0,55,0,0,19,52,54,51,
+50,22,21,20,6,35,34,39,7,39,55,38,55,20,22,51,50,54,53,52,38,35,34,6,5,20,
+7,23,7,39,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,
+90,126,89,91,126,124,93,59,45,88,82,88,29,121,55,39,40,58,60,38,36,58,254,
+211,29,88,82,88,45,59,92,125,126,91,89,126,121,58,36,38,60,58,40,38,56,6,
+82,89,126,125,90,89,126,24,88,84,88,47,60,40,56,57,39,39,57,56,40,60,47,88,
+84,88,24,125,90,89,126,126,89,40,56,58,38,39,57,56,0,2,0,0,5,59,1,236,7,41,
+0,15,0,27,0,0,19,52,54,51,50,22,21,20,6,35,34,39,7,39,55,38,55,20,22,51,50,
+54,53,52,38,35,34,6,61,126,89,88,128,126,90,57,49,86,84,88,27,119,56,40,41,
+56,58,39,38,58,6,82,89,126,124,91,90,125,24,88,84,88,46,61,40,56,56,40,40,
+56,56,0,0,1,255,92,5,78,0,168,6,154,0,17,0,0,19,21,20,6,35,34,39,21,35,17,
+51,21,22,51,50,54,53,53,168,87,87,34,23,101,101,10,33,48,38,6,154,50,88,102,
+10,102,1,76,138,12,45,55,50,0,0,1,255,68,254,127,0,190,255,203,0,20,0,0,23,
+20,6,7,21,35,53,38,38,53,53,51,21,20,22,51,50,54,53,53,51,190,69,70,102,67,
+70,100,39,51,48,38,102,102,90,90,11,92,92,10,90,91,49,49,53,48,48,53,49,0,
+0,1,255,72,254,164,0,143,255,221,0,5,0,0,23,17,33,53,51,53,143,254,185,219,
+35,254,199,106,207,0,0,1,255,94,254,127,0,162,255,231,0,5,0,0,19,35,39,55,
+51,7,162,144,180,180,144,180,254,127,180,180,180,0,0,1,255,106,254,127,0,
+178,255,174,0,7,0,0,23,20,6,35,53,50,54,53,178,171,157,102,116,82,143,160,
+106,106,91,0,0,2,254,184,254,127,1,72,255,174,0,7,0,15,0,0,21,20,6,35,53,
+50,54,53,33,20,6,35,53,50,54,53,171,157,103,114,1,183,170,158,103,114,82,
+143,160,106,107,90,141,162,106,107,90,0,0,1,255,98,254,127,0,156,255,248,
+0,7,0,0,19,5,53,55,39,37,21,7,156,254,227,141,170,1,31,143,254,178,51,80,
+22,224,51,76,25,0,255,255,255,92,5,78,0,164,6,127,0,3,0,12,0,164,0,0,0,2,
+254,20,5,59,0,0,7,41,0,15,0,27,0,0,3,20,7,23,7,39,6,35,34,38,53,52,54,51,
+50,22,7,52,38,35,34,6,21,20,22,51,50,54,61,27,88,84,86,50,56,89,127,128,88,
+87,128,119,58,38,39,58,56,41,40,56,6,82,61,46,88,84,88,24,124,91,90,125,126,
+89,40,56,57,39,40,56,56,0,255,255,255,68,254,127,0,190,255,203,0,2,0,21,0,
+0,0,1,255,94,5,78,0,162,6,182,0,5,0,0,19,35,39,55,51,7,162,144,180,180,144,
+180,5,78,180,180,180,0,0,1,255,72,5,78,0,143,6,135,0,5,0,0,19,17,33,53,51,
+53,143,254,185,219,6,135,254,199,106,207,255,255,0,0,254,127,1,72,255,174,
+0,3,0,9,0,178,0,0,255,255,253,170,5,80,0,0,6,131,0,3,0,11,254,213,0,0,0,2,
+255,41,5,123,0,215,7,41,0,11,0,23,0,0,3,52,54,51,50,22,21,20,6,35,34,38,55,
+20,22,51,50,54,53,52,38,35,34,6,215,126,89,89,126,124,91,91,124,119,56,40,
+40,56,58,38,38,58,6,82,89,126,126,89,89,126,126,89,40,56,56,40,40,56,56,0,
+0,2,255,176,254,127,0,80,255,238,0,11,0,23,0,0,7,52,54,51,50,22,21,20,6,35,
+34,38,21,52,54,51,50,22,21,20,6,35,34,38,80,47,33,34,46,48,32,32,48,48,32,
+32,48,47,33,34,46,98,33,47,48,32,32,46,46,175,34,46,48,32,32,48,46,0,0,5,
+254,211,254,127,1,45,255,238,0,11,0,23,0,35,0,47,0,59,0,0,5,52,54,51,50,22,
+21,20,6,35,34,38,55,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,
+6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,
+34,38,254,211,46,32,34,46,46,34,32,46,229,46,32,34,46,46,34,32,46,114,45,
+32,35,45,45,35,32,45,1,73,46,32,34,46,46,34,32,46,2,48,32,32,48,47,33,34,
+46,96,32,46,46,32,34,46,46,34,32,46,46,32,34,46,46,175,34,46,46,34,32,48,
+48,239,34,46,46,34,32,46,46,175,34,46,48,32,32,48,46,0,0,3,254,242,254,127,
+1,16,255,238,0,3,0,15,0,27,0,0,5,53,33,21,55,52,54,51,50,22,21,20,6,35,34,
+38,21,52,54,51,50,22,21,20,6,35,34,38,254,242,1,71,56,45,35,32,47,47,32,35,
+45,45,32,35,45,45,35,32,45,162,109,109,64,34,46,46,34,32,46,46,175,32,48,
+48,32,34,46,46,0,3,254,242,254,127,1,16,255,238,0,7,0,19,0,31,0,0,3,53,35,
+53,33,21,35,21,55,52,54,51,50,22,21,20,6,35,34,38,21,52,54,51,50,22,21,20,
+6,35,34,38,160,110,1,71,106,162,45,35,32,47,47,32,35,45,45,32,35,45,45,35,
+32,45,254,236,114,109,109,114,178,34,46,46,34,32,46,46,175,32,48,48,32,34,
+46,46,0,1,255,176,254,164,0,80,255,66,0,11,0,0,3,52,54,51,50,22,21,20,6,35,
+34,38,80,47,33,34,46,48,32,32,48,254,242,33,47,48,32,32,46,46,0,2,255,61,
+254,164,0,195,255,68,0,11,0,23,0,0,3,52,54,51,50,22,21,20,6,35,34,38,55,52,
+54,51,50,22,21,20,6,35,34,38,195,48,32,32,48,47,33,34,46,232,46,32,33,47,
+46,34,32,46,254,244,34,46,48,32,32,48,46,34,32,48,47,33,34,46,46,0,0,3,255,
+61,254,127,0,195,255,238,0,11,0,23,0,35,0,0,7,52,54,51,50,22,21,20,6,35,34,
+38,55,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,195,
+46,34,34,46,48,32,32,48,232,46,32,34,46,48,32,32,46,117,48,32,32,48,47,33,
+34,46,98,34,46,48,32,32,48,47,33,34,46,46,34,34,46,48,175,32,46,46,32,32,
+48,48,0,0,1,255,92,255,25,0,164,255,131,0,3,0,0,7,33,21,33,164,1,72,254,184,
+125,106,0,0,1,255,92,254,164,0,164,255,131,0,7,0,0,3,53,35,53,33,21,35,21,
+53,111,1,72,107,254,164,117,106,106,117,0,0,1,255,176,5,166,0,80,6,70,0,11,
+0,0,3,52,54,51,50,22,21,20,6,35,34,38,80,48,32,32,48,47,33,34,46,5,246,32,
+48,48,32,32,48,48,255,255,255,176,5,166,0,80,6,70,0,2,0,44,0,0,0,3,255,18,
+254,127,0,240,255,240,0,11,0,23,0,35,0,0,7,52,54,51,50,22,21,20,6,35,34,38,
+23,52,54,51,50,22,21,20,6,35,34,38,23,52,54,51,50,22,21,20,6,35,34,38,238,
+46,32,34,46,46,34,32,46,158,48,32,32,48,47,33,34,46,160,48,32,32,48,47,33,
+34,46,96,34,46,46,34,32,46,46,73,32,48,48,32,32,48,48,72,34,46,48,32,32,48,
+46,0,0,1,255,176,2,113,0,80,3,14,0,11,0,0,3,52,54,51,50,22,21,20,6,35,34,
+38,80,48,32,32,48,48,32,32,48,2,190,35,45,45,35,32,45,45,0,1,255,201,254,
+164,0,55,255,131,0,3,0,0,3,53,51,21,55,110,254,164,223,223,0,1,0,133,4,121,
+2,193,5,76,0,3,0,0,19,33,21,33,133,2,60,253,196,5,76,211,0,1,255,92,5,193,
+0,164,6,43,0,3,0,0,3,33,21,33,164,1,72,254,184,6,43,106,0,1,1,244,254,96,
+2,141,7,215,0,3,0,0,1,17,51,17,1,244,153,254,96,9,119,246,137,0,255,255,255,
+176,5,166,0,80,6,70,0,2,0,44,0,0,255,255,255,176,5,166,0,80,6,70,0,2,0,44,
+0,0,0,2,0,186,0,0,1,127,4,57,0,3,0,7,0,0,19,53,51,21,3,53,51,21,186,197,197,
+197,3,106,207,207,252,150,207,207,0,1,255,176,6,23,0,80,6,182,0,11,0,0,3,
+52,54,51,50,22,21,20,6,35,34,38,80,48,32,32,48,48,32,32,48,6,102,32,48,48,
+32,34,45,45,0,1,255,176,254,106,0,80,255,8,0,11,0,0,3,52,54,51,50,22,21,20,
+6,35,34,38,80,47,33,34,46,48,32,32,48,254,184,33,47,48,32,32,46,46,0,1,0,
+154,0,0,2,203,4,203,0,15,0,0,19,52,54,54,51,51,21,35,34,6,6,21,17,33,21,33,
+154,67,148,159,129,135,73,78,33,1,121,253,207,2,240,184,202,89,170,58,131,
+168,253,238,170,0,0,1,0,53,254,127,1,229,255,158,0,9,0,0,5,35,23,21,35,53,
+55,35,53,33,1,229,180,19,109,16,178,1,176,205,160,20,20,160,107,0,0,1,0,66,
+0,0,4,236,4,203,0,25,0,0,19,51,1,54,19,55,51,7,14,2,7,1,35,1,14,2,7,3,35,
+19,62,2,55,125,227,1,195,150,28,23,190,23,10,60,99,103,1,105,234,253,240,
+43,53,37,25,80,194,84,36,60,91,77,4,203,253,147,140,1,2,223,219,107,172,150,
+102,254,35,2,205,21,63,102,128,254,109,1,143,171,142,88,31,0,0,1,0,82,0,0,
+4,129,4,203,0,15,0,0,19,53,33,32,22,17,17,51,21,33,53,33,17,52,38,35,129,
+1,121,1,20,238,133,251,209,2,242,149,183,4,33,170,236,254,240,253,219,170,
+170,2,39,184,152,0,0,1,0,63,0,0,3,45,4,203,0,26,0,0,1,50,30,2,23,19,35,3,
+14,2,7,7,35,55,62,3,55,46,2,35,35,53,1,4,97,105,68,57,52,174,182,113,84,77,
+50,22,33,189,35,24,46,72,108,139,50,52,62,57,135,4,203,31,69,140,225,253,
+6,1,248,21,60,118,125,180,182,132,134,92,61,38,212,148,58,170,0,1,0,41,0,
+0,4,55,4,203,0,7,0,0,33,35,17,33,53,33,21,35,3,158,185,253,68,4,14,153,4,
+33,170,170,0,2,0,152,0,0,4,111,4,203,0,3,0,15,0,0,33,35,17,51,1,35,17,52,
+38,35,33,53,33,32,22,17,1,100,184,184,3,11,185,149,183,254,46,1,213,1,20,
+238,3,29,252,227,2,209,184,152,170,236,254,240,0,1,0,174,0,0,1,102,4,203,
+0,3,0,0,19,51,17,35,174,184,184,4,203,251,53,0,0,1,0,51,0,0,2,121,4,221,0,
+14,0,0,1,21,39,14,2,21,17,35,17,52,54,55,37,53,2,121,109,59,46,20,184,81,
+97,254,170,4,25,191,37,31,54,75,57,253,90,2,158,106,132,32,115,190,0,1,0,
+174,0,0,4,160,4,203,0,13,0,0,1,52,38,35,33,17,35,17,33,32,22,17,17,35,3,231,
+147,184,254,202,184,1,240,1,20,238,185,2,209,182,154,251,223,4,203,236,254,
+240,253,49,0,1,0,164,255,236,4,203,4,223,0,26,0,0,5,34,2,17,17,51,17,20,22,
+51,50,54,17,52,38,35,34,7,53,54,51,50,22,22,21,16,0,2,147,255,240,184,147,
+167,196,176,88,106,102,95,78,137,137,157,75,254,238,20,1,1,1,11,2,211,253,
+51,186,172,242,1,24,208,193,65,176,61,118,253,202,254,153,254,177,0,0,1,0,
+174,2,70,1,102,4,203,0,3,0,0,19,51,17,35,174,184,184,4,203,253,123,0,0,1,
+0,39,254,127,3,162,4,203,0,11,0,0,1,35,17,52,38,35,33,53,33,32,22,17,3,162,
+185,147,184,254,137,1,121,1,20,238,254,127,4,82,182,154,170,236,254,240,0,
+1,0,80,0,0,3,195,4,203,0,17,0,0,1,16,33,33,53,33,50,54,53,53,52,38,35,33,
+53,33,32,17,3,195,253,204,254,193,1,67,191,182,183,190,254,189,1,63,2,52,
+2,84,253,172,170,212,212,39,213,211,170,253,172,0,0,1,0,70,255,211,3,219,
+6,129,0,16,0,0,55,54,36,18,53,52,35,33,17,51,17,33,32,17,16,0,5,193,191,1,
+18,143,234,254,15,184,1,76,1,145,254,82,254,148,162,71,217,1,0,132,219,2,
+96,254,74,254,155,254,220,254,19,130,0,2,0,174,0,0,4,201,4,203,0,6,0,13,0,
+0,33,33,17,33,32,22,17,1,17,33,17,52,38,35,4,201,251,229,2,25,1,20,238,252,
+157,2,170,147,184,4,203,236,254,240,1,82,252,137,2,39,182,154,0,1,0,55,0,
+0,4,219,4,223,0,24,0,0,1,50,18,17,17,33,53,33,17,52,38,35,34,6,3,3,35,19,
+54,55,3,51,23,54,54,3,10,242,223,253,166,1,160,126,151,135,174,74,125,198,
+137,47,47,250,217,125,78,178,4,223,254,217,254,191,253,137,170,1,182,245,
+222,245,254,204,253,246,2,25,187,118,1,129,203,118,105,0,0,1,0,174,254,127,
+1,102,4,203,0,3,0,0,19,51,17,35,174,184,184,4,203,249,180,0,0,1,0,72,0,0,
+2,121,4,203,0,15,0,0,33,33,53,33,17,52,38,38,35,35,53,51,50,22,22,21,2,121,
+253,207,1,121,33,78,74,135,129,160,147,68,170,2,18,160,138,59,170,89,203,
+183,0,2,0,51,255,236,4,207,4,203,0,16,0,30,0,0,19,52,54,55,35,53,33,32,22,
+17,21,16,0,33,32,0,17,1,6,17,21,20,22,51,50,54,17,53,52,38,35,133,59,39,180,
+2,152,1,20,240,254,225,254,236,254,238,254,251,1,6,67,177,167,191,171,142,
+179,2,131,121,242,51,170,235,254,239,88,254,192,254,181,1,53,1,63,1,193,119,
+254,225,53,220,228,226,1,1,88,186,150,0,0,1,0,41,255,223,4,66,4,203,0,13,
+0,0,55,32,55,1,51,1,54,18,17,51,16,2,4,5,41,1,20,158,254,141,203,1,72,140,
+122,193,197,254,67,254,105,162,51,3,246,252,88,100,1,163,1,161,254,49,253,
+246,254,21,0,1,0,133,254,127,4,88,4,203,0,15,0,0,1,32,22,17,17,35,17,52,38,
+35,33,17,51,21,33,17,2,86,1,20,238,184,149,183,254,235,244,254,82,4,203,234,
+254,238,251,176,4,82,184,152,254,166,170,2,174,0,0,1,0,143,0,0,4,113,4,203,
+0,22,0,0,1,52,38,35,33,17,51,21,33,17,33,32,0,17,21,16,33,33,53,33,50,54,
+53,3,182,166,178,254,236,243,254,82,1,209,1,12,1,5,253,204,254,93,1,168,190,
+182,2,170,189,186,254,166,170,2,174,254,245,254,230,82,253,172,170,211,213,
+0,0,1,0,10,254,127,3,213,4,203,0,20,0,0,1,35,17,52,38,38,3,51,18,22,23,62,
+2,55,55,51,3,6,6,7,2,0,184,44,102,172,217,172,99,10,92,104,53,11,20,193,27,
+19,200,223,254,127,3,162,89,145,187,1,5,254,246,226,119,23,80,135,125,248,
+254,233,216,217,44,0,0,1,0,10,0,0,4,4,4,203,0,17,0,0,33,33,53,33,1,51,1,54,
+54,55,55,51,7,14,2,7,1,4,4,252,80,2,203,252,235,230,1,125,77,70,12,23,190,
+20,14,55,102,93,1,63,170,4,33,253,250,33,129,133,223,219,140,145,96,37,254,
+80,0,2,0,123,254,127,4,72,4,203,0,3,0,19,0,0,1,17,35,17,3,33,50,22,21,16,
+0,5,53,54,18,53,52,38,35,33,1,102,184,51,2,6,247,208,254,177,254,226,209,
+225,117,143,253,242,3,29,251,98,4,158,1,174,177,204,254,230,254,41,120,211,
+94,1,79,208,134,102,0,1,0,39,0,0,3,162,4,203,0,11,0,0,33,35,17,52,38,35,33,
+53,33,32,22,17,3,162,185,147,184,254,137,1,121,1,20,238,2,209,182,154,170,
+236,254,240,0,1,0,51,255,246,5,127,4,203,0,29,0,0,1,51,3,14,2,7,7,19,51,50,
+62,2,55,19,51,3,2,6,6,4,5,3,51,19,55,54,54,55,2,156,190,31,15,51,100,116,
+150,49,24,201,242,140,77,23,63,193,64,31,114,208,254,147,254,172,234,191,
+123,73,108,86,11,4,203,254,184,167,149,81,31,35,254,254,47,100,183,194,2,
+13,253,250,254,250,253,139,63,2,4,213,253,137,14,24,121,146,0,1,0,61,0,0,
+4,227,4,203,0,25,0,0,1,35,53,33,32,22,17,17,35,17,52,38,35,33,17,20,6,6,35,
+35,53,51,50,54,54,53,1,6,190,2,151,1,20,240,184,149,185,254,225,67,148,159,
+11,17,70,80,34,4,33,170,235,254,239,253,49,2,209,184,152,253,186,184,202,
+89,170,51,108,109,255,255,0,174,0,0,3,100,4,203,0,34,0,64,0,0,0,3,0,64,1,
+254,0,0,255,255,0,174,0,0,3,100,4,203,0,34,0,68,0,0,0,3,0,64,1,254,0,0,255,
+255,0,174,2,70,3,100,4,203,0,34,0,68,0,0,0,3,0,68,1,254,0,0,0,1,0,215,4,6,
+2,72,6,129,0,3,0,0,1,35,19,51,1,96,137,137,232,4,6,2,123,0,0,2,0,215,4,6,
+4,6,6,129,0,3,0,7,0,0,1,35,19,51,19,35,19,51,1,96,137,137,232,215,137,137,
+231,4,6,2,123,253,133,2,123,0,0,2,0,180,0,0,6,23,4,203,0,15,0,31,0,0,1,50,
+22,22,21,17,35,53,52,38,38,35,33,17,35,17,1,17,51,17,33,50,54,54,53,17,51,
+17,20,6,6,35,2,193,173,192,89,184,49,114,112,254,177,185,1,142,184,1,84,111,
+113,48,185,91,193,171,4,203,106,233,202,254,248,252,153,159,71,251,223,4,
+203,251,53,2,217,253,209,71,163,149,2,162,253,82,203,234,104,0,255,255,0,
+174,1,38,1,102,4,203,2,34,0,68,0,0,0,3,0,47,1,10,254,181,0,1,254,182,5,166,
+1,74,6,227,0,13,0,0,1,20,6,35,34,38,53,51,20,22,51,50,54,53,1,74,180,150,
+150,180,162,90,78,77,91,6,227,145,172,175,142,77,93,96,74,0,255,255,0,174,
+1,60,3,100,4,203,0,34,0,68,0,0,0,35,0,68,1,254,0,0,0,3,0,42,2,10,2,35,255,
+255,0,41,255,223,4,66,4,203,2,2,0,77,0,0,255,255,0,66,0,0,4,236,4,203,2,2,
+0,59,0,0,255,255,0,41,0,0,4,55,4,203,2,2,0,62,0,0,255,255,0,152,0,0,4,111,
+4,203,2,2,0,63,0,0,255,255,0,80,0,0,3,195,4,203,2,2,0,70,0,0,255,255,0,70,
+255,211,3,219,6,129,2,2,0,71,0,0,255,255,0,174,0,0,4,201,4,203,2,2,0,72,0,
+0,255,255,0,39,0,0,3,162,4,203,2,2,0,83,0,0,255,255,0,61,0,0,4,227,4,203,
+2,2,0,85,0,0,0,1,0,90,2,2,4,39,4,104,0,7,0,0,1,33,53,33,17,51,17,33,4,39,
+252,51,1,135,187,1,139,2,2,186,1,172,254,84,255,255,0,51,255,246,5,127,6,
+70,2,34,0,84,0,0,0,3,0,44,5,45,0,0,255,255,0,51,255,246,5,127,6,70,2,34,0,
+84,0,0,0,3,0,44,0,152,0,0,255,255,0,51,255,246,5,160,6,70,2,34,0,84,0,0,0,
+35,0,44,5,80,0,0,0,3,0,47,3,190,255,177,255,255,0,51,255,246,5,127,6,70,2,
+34,0,84,0,0,0,35,0,47,3,190,255,177,0,3,0,44,0,145,0,0,255,255,0,66,255,25,
+4,236,4,203,2,34,0,59,0,0,0,3,0,42,2,131,0,0,255,255,0,66,254,164,4,236,4,
+203,2,34,0,59,0,0,0,3,0,43,2,131,0,0,255,255,0,66,0,0,4,236,4,203,2,34,0,
+59,0,0,0,3,0,47,2,57,253,183,255,255,0,82,0,0,4,129,4,203,2,34,0,60,0,0,0,
+3,0,47,1,211,0,0,255,255,0,63,0,0,3,45,4,203,2,34,0,61,0,0,0,3,0,47,0,201,
+0,76,255,255,0,41,0,0,4,55,4,203,2,34,0,62,0,0,0,3,0,47,1,127,0,0,255,255,
+0,152,0,0,4,111,4,203,2,34,0,63,0,0,0,3,0,47,2,129,0,0,255,255,255,186,0,
+0,1,102,4,203,2,34,0,64,0,0,0,2,0,47,10,0,255,255,255,203,0,0,2,121,4,221,
+2,34,0,65,0,0,0,2,0,47,27,0,255,255,0,164,255,236,4,203,4,223,2,34,0,67,0,
+0,0,3,0,47,2,182,0,0,255,255,255,186,2,70,1,102,4,203,2,34,0,68,0,0,0,3,0,
+47,0,10,0,172,255,255,0,39,254,127,3,162,4,203,2,34,0,69,0,0,0,3,0,47,1,152,
+0,0,255,255,0,80,0,0,3,195,4,203,2,34,0,70,0,0,0,3,0,47,1,209,255,187,255,
+255,0,70,255,211,3,219,6,129,2,34,0,71,0,0,0,3,0,47,1,172,0,16,255,255,0,
+55,0,0,4,219,4,223,2,34,0,73,0,0,0,3,0,47,2,248,0,16,255,255,0,72,0,0,2,121,
+4,203,2,34,0,75,0,0,0,3,0,47,0,201,0,0,255,255,0,51,255,236,4,207,4,203,2,
+34,0,76,0,0,0,3,0,47,2,166,0,0,255,255,0,133,254,127,4,88,4,203,2,34,0,78,
+0,0,0,3,0,47,2,53,0,186,255,255,0,143,0,0,4,113,4,203,2,34,0,79,0,0,0,3,0,
+47,2,45,0,180,255,255,0,10,0,0,4,4,4,203,2,34,0,81,0,0,0,3,0,47,1,72,254,
+212,255,255,0,123,254,127,4,72,4,203,2,34,0,82,0,0,0,3,0,47,2,84,0,100,255,
+255,0,39,0,0,3,162,4,203,2,34,0,83,0,0,0,3,0,47,1,152,0,0,255,255,0,51,255,
+246,5,127,4,203,2,34,0,84,0,0,0,3,0,47,3,184,255,177,255,255,0,61,0,0,4,227,
+4,203,2,34,0,85,0,0,0,3,0,47,2,225,0,0,255,255,0,174,0,0,1,102,6,70,2,34,
+0,64,0,0,0,3,0,44,1,10,0,0,255,255,0,82,0,0,4,129,6,43,2,34,0,60,0,0,0,3,
+0,50,2,4,0,0,255,255,0,80,0,0,3,195,6,43,2,34,0,70,0,0,0,3,0,50,1,213,0,0,
+255,255,0,143,0,0,4,113,6,43,2,34,0,79,0,0,0,3,0,50,2,66,0,0,0,1,0,80,0,0,
+4,236,6,129,0,17,0,0,19,35,17,51,17,51,1,54,19,55,51,7,14,2,7,1,35,238,158,
+186,86,1,195,150,28,23,190,23,10,60,99,103,1,105,234,4,47,2,82,254,74,253,
+147,140,1,2,223,219,107,172,150,102,254,35,255,255,255,107,255,211,3,219,
+6,129,2,34,0,71,0,0,0,34,0,44,187,0,0,3,0,47,1,170,0,20,255,255,255,107,255,
+211,3,219,6,129,2,34,0,71,0,0,0,2,0,44,187,0,255,255,0,39,254,127,3,162,4,
+203,2,34,0,69,0,0,0,3,0,43,1,129,3,74,255,255,0,39,254,127,3,162,4,203,2,
+34,0,69,0,0,0,3,0,35,1,152,3,43,255,255,0,80,254,127,4,236,6,129,2,34,0,137,
+0,0,0,3,0,36,2,152,0,0,255,255,0,80,254,127,4,236,6,129,2,34,0,137,0,0,0,
+3,0,41,2,133,0,0,255,255,0,80,254,164,4,236,6,129,2,34,0,137,0,0,0,3,0,40,
+2,139,0,0,255,255,0,70,255,211,3,219,6,129,2,2,0,71,0,0,255,255,0,66,0,0,
+4,236,4,203,2,34,0,59,0,0,0,3,0,47,2,57,253,183,0,6,254,38,254,127,1,105,
+255,238,0,11,0,23,0,35,0,47,0,59,0,63,0,0,5,52,54,51,50,22,21,20,6,35,34,
+38,55,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,37,
+52,54,51,50,22,21,20,6,35,34,38,21,52,54,51,50,22,21,20,6,35,34,38,7,17,51,
+17,254,38,46,32,34,46,46,34,32,46,229,46,32,34,46,46,34,32,46,114,45,32,35,
+45,45,35,32,45,2,50,46,32,34,46,46,34,32,46,46,32,32,48,47,33,34,44,200,110,
+96,32,46,46,32,34,46,46,34,32,46,46,32,34,46,46,175,34,46,46,34,32,48,48,
+239,34,46,46,34,32,46,46,175,34,46,48,32,32,48,46,46,1,111,254,145,0,0,4,
+254,18,254,127,1,26,255,238,0,3,0,15,0,27,0,31,0,0,5,53,33,21,37,52,54,51,
+50,22,21,20,6,35,34,38,21,52,54,51,50,22,21,20,6,35,34,38,7,17,51,17,254,
+18,1,71,1,34,45,35,32,47,47,32,35,45,45,32,35,45,45,35,32,45,200,110,162,
+109,109,64,34,46,46,34,32,46,46,175,32,48,48,32,34,46,46,46,1,111,254,145,
+0,4,254,92,254,127,1,100,255,238,0,7,0,19,0,31,0,35,0,0,1,53,35,53,33,21,
+35,21,37,52,54,51,50,22,21,20,6,35,34,38,21,52,54,51,50,22,21,20,6,35,34,
+38,7,17,51,17,254,202,110,1,71,106,1,140,45,35,32,47,47,32,35,45,45,32,35,
+47,47,35,32,45,200,110,254,236,114,109,109,114,178,34,46,46,34,32,46,46,175,
+32,48,48,32,34,46,46,46,1,111,254,145,0,0,16,0,98,0,86,4,95,4,82,0,7,0,15,
+0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,119,0,127,
+0,0,1,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,
+23,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,
+35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,
+53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,
+51,50,37,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,39,20,35,34,53,52,51,
+50,3,216,52,56,56,52,148,52,56,56,52,247,55,53,55,53,36,52,56,56,52,254,55,
+54,54,54,54,173,55,53,53,55,2,82,55,53,53,55,253,26,54,54,54,54,2,131,52,
+56,56,52,148,52,56,56,52,253,174,52,56,54,54,36,52,56,56,52,1,200,54,54,54,
+54,254,92,54,54,54,54,247,55,53,53,55,148,54,54,54,54,3,150,54,54,54,44,53,
+53,55,254,211,55,55,53,227,54,54,54,1,147,55,55,53,90,53,53,55,253,119,53,
+53,55,1,185,54,51,57,253,68,53,53,55,153,52,52,56,2,28,55,55,53,227,54,54,
+54,254,3,55,55,53,228,53,53,55,254,213,56,52,56,42,53,53,55,0,0,1,255,220,
+255,163,0,36,5,111,0,3,0,0,19,17,35,17,36,72,5,111,250,52,5,204,0,1,255,37,
+255,163,0,219,5,111,0,14,0,0,23,35,17,7,39,55,39,55,23,55,23,7,23,7,39,36,
+72,134,49,171,171,49,170,170,49,171,171,49,134,93,4,161,136,49,169,168,49,
+171,171,49,168,169,49,136,0,1,255,220,255,163,1,174,5,111,0,10,0,0,1,7,39,
+55,33,17,35,17,33,39,55,1,174,217,49,137,254,246,71,1,81,137,49,4,152,214,
+49,130,251,46,5,25,130,49,0,1,254,81,255,163,0,35,5,111,0,10,0,0,23,35,17,
+33,23,7,39,55,23,7,33,35,71,254,246,137,49,217,217,49,137,1,81,93,4,210,130,
+49,214,215,49,130,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,
+0,32,0,94,0,3,0,1,4,9,0,2,0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,
+9,0,4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,
+0,1,4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,
+0,3,0,1,4,9,0,10,0,96,1,162,0,3,0,1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,
+60,2,64,0,3,0,1,4,9,0,13,2,150,2,124,0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,
+0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,
+0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,
+0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,
+0,115,0,32,0,72,0,101,0,98,0,114,0,101,0,119,0,82,0,101,0,103,0,117,0,108,
+0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,
+0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,
+83,0,97,0,110,0,115,0,32,0,72,0,101,0,98,0,114,0,101,0,119,0,86,0,101,0,114,
+0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,
+111,0,116,0,111,0,83,0,97,0,110,0,115,0,72,0,101,0,98,0,114,0,101,0,119,0,
+78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,
+0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,
+0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,
+32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,
+0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,
+0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,
+0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,
+0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,
+0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,
+65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,
+0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,
+0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,
+0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,
+0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,
+115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,
+0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,
+0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,
+101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,
+0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,
+0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,
+0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,
+0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,
+0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,
+0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,
+0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,0,1,2,0,2,0,3,1,
+3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,
+19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,
+1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,
+1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,
+1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,
+1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,
+1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,
+107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,
+1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,
+132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,
+1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,4,110,117,108,108,7,
+117,110,105,48,53,57,49,7,117,110,105,48,53,57,50,7,117,110,105,48,53,57,
+51,7,117,110,105,48,53,57,52,7,117,110,105,48,53,57,53,7,117,110,105,48,53,
+57,54,7,117,110,105,48,53,57,55,7,117,110,105,48,53,57,56,7,117,110,105,48,
+53,57,57,7,117,110,105,48,53,57,65,7,117,110,105,48,53,57,66,7,117,110,105,
+48,53,57,67,7,117,110,105,48,53,57,68,7,117,110,105,48,53,57,69,7,117,110,
+105,48,53,57,70,7,117,110,105,48,53,65,48,7,117,110,105,48,53,65,49,7,117,
+110,105,48,53,65,50,7,117,110,105,48,53,65,51,7,117,110,105,48,53,65,52,7,
+117,110,105,48,53,65,53,7,117,110,105,48,53,65,54,7,117,110,105,48,53,65,
+55,7,117,110,105,48,53,65,56,7,117,110,105,48,53,65,57,7,117,110,105,48,53,
+65,65,7,117,110,105,48,53,65,66,7,117,110,105,48,53,65,67,7,117,110,105,48,
+53,65,68,7,117,110,105,48,53,65,69,7,117,110,105,48,53,65,70,5,115,104,101,
+118,97,10,104,97,116,97,102,115,101,103,111,108,10,104,97,116,97,102,112,
+97,116,97,104,11,104,97,116,97,102,113,97,109,97,116,115,5,104,105,114,105,
+113,5,116,115,101,114,101,5,115,101,103,111,108,5,112,97,116,97,104,6,113,
+97,109,97,116,115,5,104,111,108,97,109,7,117,110,105,48,53,66,65,6,113,117,
+98,117,116,115,6,100,97,103,101,115,104,5,109,101,116,101,103,5,109,97,113,
+97,102,4,114,97,102,101,5,112,97,115,101,113,7,115,104,105,110,100,111,116,
+6,115,105,110,100,111,116,8,115,111,102,112,97,115,117,113,9,117,112,112,
+101,114,95,100,111,116,8,108,111,119,101,114,100,111,116,7,117,110,105,48,
+53,67,54,11,113,97,109,97,116,115,113,97,116,97,110,4,97,108,101,102,3,98,
+101,116,5,103,105,109,101,108,5,100,97,108,101,116,2,104,101,3,118,97,118,
+5,122,97,121,105,110,3,104,101,116,3,116,101,116,3,121,111,100,8,102,105,
+110,97,108,107,97,102,3,107,97,102,5,108,97,109,101,100,8,102,105,110,97,
+108,109,101,109,3,109,101,109,8,102,105,110,97,108,110,117,110,3,110,117,
+110,6,115,97,109,101,107,104,4,97,121,105,110,7,102,105,110,97,108,112,101,
+2,112,101,10,102,105,110,97,108,116,115,97,100,105,5,116,115,97,100,105,3,
+113,111,102,4,114,101,115,104,4,115,104,105,110,3,116,97,118,6,118,97,118,
+118,97,118,6,118,97,118,121,111,100,6,121,111,100,121,111,100,6,103,101,114,
+101,115,104,9,103,101,114,115,104,97,121,105,109,6,115,104,101,113,101,108,
+7,117,110,105,70,66,49,68,7,117,110,105,70,66,49,69,12,121,111,100,121,111,
+100,95,112,97,116,97,104,15,97,108,116,101,114,110,97,116,105,118,101,97,
+121,105,110,8,97,108,101,102,119,105,100,101,9,100,97,108,101,116,119,105,
+100,101,6,104,101,119,105,100,101,7,107,97,102,119,105,100,101,9,108,97,109,
+101,100,119,105,100,101,12,102,105,110,97,108,109,101,109,119,105,100,101,
+8,114,101,115,104,119,105,100,101,7,116,97,118,119,105,100,101,12,97,108,
+116,95,112,108,117,115,115,105,103,110,11,115,104,105,110,115,104,105,110,
+100,111,116,10,115,104,105,110,115,105,110,100,111,116,17,115,104,105,110,
+100,97,103,101,115,104,115,104,105,110,100,111,116,16,115,104,105,110,100,
+97,103,101,115,104,115,105,110,100,111,116,9,97,108,101,102,112,97,116,97,
+104,10,97,108,101,102,113,97,109,97,116,115,9,97,108,101,102,109,97,112,105,
+113,9,98,101,116,100,97,103,101,115,104,11,103,105,109,101,108,100,97,103,
+101,115,104,11,100,97,108,101,116,100,97,103,101,115,104,8,104,101,100,97,
+103,101,115,104,9,118,97,118,100,97,103,101,115,104,11,122,97,121,105,110,
+100,97,103,101,115,104,9,116,101,116,100,97,103,101,115,104,9,121,111,100,
+100,97,103,101,115,104,14,102,105,110,97,108,107,97,102,100,97,103,101,115,
+104,9,107,97,102,100,97,103,101,115,104,11,108,97,109,101,100,100,97,103,
+101,115,104,9,109,101,109,100,97,103,101,115,104,9,110,117,110,100,97,103,
+101,115,104,12,115,97,109,101,107,104,100,97,103,101,115,104,13,102,105,110,
+97,108,112,101,100,97,103,101,115,104,8,112,101,100,97,103,101,115,104,11,
+116,115,97,100,105,100,97,103,101,115,104,9,113,111,102,100,97,103,101,115,
+104,10,114,101,115,104,100,97,103,101,115,104,10,115,104,105,110,100,97,103,
+101,115,104,9,116,97,118,100,97,103,101,115,104,8,118,97,118,104,111,108,
+97,109,7,98,101,116,114,97,102,101,7,107,97,102,114,97,102,101,6,112,101,
+114,97,102,101,9,97,108,101,102,108,97,109,101,100,16,108,97,109,101,100,
+104,111,108,97,109,100,97,103,101,115,104,10,108,97,109,101,100,104,111,108,
+97,109,14,102,105,110,97,108,107,97,102,113,97,109,97,116,115,13,102,105,
+110,97,108,107,97,102,115,104,101,118,97,19,97,108,101,102,108,97,109,101,
+100,104,97,116,97,102,115,101,103,111,108,14,97,108,101,102,108,97,109,101,
+100,115,101,103,111,108,14,97,108,101,102,108,97,109,101,100,116,115,101,
+114,101,16,97,108,116,101,114,110,97,116,105,118,101,108,97,109,101,100,10,
+97,108,101,102,100,97,103,101,115,104,11,117,110,105,48,53,66,49,48,53,66,
+68,11,117,110,105,48,53,66,50,48,53,66,68,11,117,110,105,48,53,66,51,48,53,
+66,68,7,117,110,105,50,53,67,67,7,117,110,105,50,48,48,67,7,117,110,105,50,
+48,48,68,7,117,110,105,50,48,48,69,7,117,110,105,50,48,48,70,0,0,0,0,0,2,
+0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,124,0,0,0,2,0,18,0,0,0,3,0,1,0,4,0,
+48,0,3,0,49,0,49,0,1,0,50,0,50,0,3,0,51,0,51,0,1,0,52,0,53,0,3,0,55,0,56,
+0,3,0,57,0,57,0,1,0,58,0,58,0,3,0,59,0,92,0,1,0,93,0,93,0,3,0,94,0,136,0,
+1,0,137,0,137,0,2,0,138,0,141,0,1,0,142,0,144,0,2,0,145,0,146,0,1,0,147,0,
+149,0,3,0,150,0,154,0,1,0,12,0,4,0,24,0,24,0,24,0,24,0,1,0,4,0,137,0,142,
+0,143,0,144,0,1,0,4,0,1,5,6,0,1,0,0,0,10,0,32,0,88,0,1,104,101,98,114,0,8,
+0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,107,101,114,110,0,14,109,97,114,107,0,
+20,0,0,0,1,0,16,0,0,0,16,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,
+0,12,0,13,0,14,0,15,0,25,0,52,0,60,0,68,0,76,0,84,0,92,0,100,0,114,0,128,
+0,142,0,156,0,164,0,172,0,180,0,202,0,234,0,244,0,252,1,4,1,12,1,20,1,28,
+1,36,1,44,1,52,0,4,0,1,0,1,1,8,0,8,0,1,0,1,1,226,0,4,0,7,0,1,2,20,0,4,0,1,
+0,1,2,46,0,4,0,1,0,1,2,164,0,4,0,1,0,1,4,152,0,8,0,1,0,4,6,176,6,196,6,216,
+6,236,0,8,0,1,0,4,7,96,7,116,7,136,7,156,0,8,0,1,0,4,8,88,8,108,8,128,8,148,
+0,8,0,1,0,4,9,8,9,28,9,48,9,68,0,4,0,1,0,1,10,0,0,4,0,1,0,1,10,242,0,4,0,
+1,0,1,11,210,0,8,0,1,0,8,12,178,12,198,12,220,12,242,13,8,13,30,13,52,13,
+74,0,8,0,1,0,13,14,48,14,68,14,88,14,108,14,128,14,148,14,168,14,188,14,208,
+14,228,14,248,15,12,15,32,0,8,0,1,0,2,15,204,15,226,0,2,0,8,0,1,16,18,0,1,
+0,1,0,1,18,34,0,4,0,1,0,1,18,42,0,4,0,1,0,1,19,10,0,4,0,1,0,1,20,126,0,4,
+0,1,0,1,21,186,0,1,0,1,0,1,23,46,0,1,0,1,0,1,23,54,0,2,0,1,0,1,23,94,0,1,
+0,174,0,180,0,1,0,12,0,18,0,1,0,0,23,106,0,77,23,94,23,94,23,94,23,100,23,
+94,23,106,23,100,23,94,23,94,23,94,23,100,23,100,23,112,23,94,23,100,23,94,
+23,94,23,100,23,94,23,94,23,94,23,100,23,100,23,94,23,100,23,100,23,100,23,
+94,23,118,23,118,23,94,23,94,23,100,23,94,23,100,23,112,23,94,23,100,23,100,
+23,100,23,124,23,100,23,124,23,94,23,94,23,94,23,94,23,94,23,100,23,94,23,
+94,23,100,23,94,23,94,23,100,23,100,23,112,23,100,23,94,23,100,23,94,23,94,
+23,100,23,94,23,100,23,100,23,100,23,124,23,100,23,100,23,94,23,130,23,130,
+23,100,23,100,23,112,23,136,0,1,0,1,0,44,0,2,0,7,0,59,0,88,0,0,0,94,0,94,
+0,30,0,96,0,103,0,31,0,105,0,136,0,39,0,138,0,141,0,71,0,145,0,145,0,75,0,
+150,0,150,0,76,0,3,0,1,0,24,0,1,0,18,0,0,0,1,0,0,0,17,0,1,0,1,0,44,0,2,0,
+5,0,59,0,63,0,0,0,65,0,85,0,5,0,87,0,88,0,26,0,96,0,103,0,28,0,145,0,145,
+0,36,0,1,0,22,0,28,0,1,0,12,0,18,0,1,0,0,22,78,0,1,22,114,0,1,0,1,0,52,0,
+1,0,1,0,150,0,1,0,56,0,62,0,1,0,12,0,18,0,1,0,0,22,98,0,18,22,98,22,104,22,
+110,22,116,22,176,22,110,22,122,22,122,22,128,22,134,22,140,22,146,22,152,
+22,158,22,164,22,170,22,170,22,86,0,1,0,1,0,47,0,2,0,10,0,66,0,66,0,0,0,72,
+0,72,0,1,0,74,0,74,0,2,0,77,0,77,0,3,0,80,0,80,0,4,0,86,0,88,0,5,0,96,0,100,
+0,8,0,102,0,103,0,13,0,105,0,106,0,15,0,150,0,150,0,17,0,1,1,136,1,206,0,
+2,0,12,0,82,0,17,0,0,22,68,0,0,22,74,0,0,22,80,0,0,22,86,0,0,22,74,0,0,22,
+74,0,0,22,92,0,0,22,98,0,0,22,74,0,0,22,74,0,0,22,74,0,0,22,104,0,0,22,74,
+0,0,22,110,0,0,21,174,0,1,22,242,0,0,21,174,0,77,22,52,22,142,22,58,22,154,
+22,64,22,190,22,70,22,196,21,248,22,46,22,76,22,148,22,82,22,202,22,88,22,
+142,22,88,22,142,22,76,22,148,22,94,22,208,22,94,22,208,21,248,22,46,22,88,
+22,142,22,100,22,214,22,76,22,148,22,106,22,220,22,112,22,226,21,248,22,46,
+21,248,22,46,21,248,22,46,22,118,22,178,22,118,22,178,22,124,22,166,22,82,
+22,202,22,130,22,184,22,136,22,232,22,118,22,178,22,118,22,178,22,118,22,
+178,22,118,22,178,22,88,22,142,22,70,22,196,21,248,22,46,22,94,22,208,21,
+248,22,46,22,88,22,142,22,82,22,202,22,136,22,232,22,130,22,184,22,130,22,
+184,22,130,22,184,22,130,22,184,22,88,22,142,22,88,22,142,22,88,22,142,22,
+58,22,154,22,64,22,190,22,70,22,196,21,248,22,46,22,76,22,148,22,82,22,202,
+22,88,22,142,22,76,22,148,22,94,22,208,22,94,22,208,21,248,22,46,22,100,22,
+214,22,106,22,220,22,112,22,226,21,248,22,46,21,248,22,46,22,118,22,178,22,
+124,22,166,22,82,22,202,22,130,22,184,22,136,22,232,22,148,22,148,22,154,
+22,154,22,160,22,160,22,166,22,166,21,248,22,46,21,248,22,46,22,94,22,208,
+22,94,22,208,21,248,22,46,21,248,22,46,0,2,0,11,0,5,0,8,0,0,0,10,0,11,0,4,
+0,15,0,15,0,6,0,17,0,18,0,7,0,20,0,20,0,9,0,27,0,27,0,10,0,30,0,31,0,11,0,
+34,0,34,0,13,0,50,0,50,0,14,0,55,0,55,0,15,0,93,0,93,0,16,0,2,0,7,0,59,0,
+88,0,0,0,94,0,94,0,30,0,96,0,103,0,31,0,105,0,136,0,39,0,138,0,141,0,71,0,
+145,0,145,0,75,0,150,0,150,0,76,0,1,1,172,1,242,0,2,0,12,0,118,0,26,0,0,21,
+68,0,0,21,80,0,0,21,68,0,0,21,68,0,0,21,68,0,0,21,68,0,0,21,86,0,0,21,92,
+0,0,21,68,0,0,21,68,0,0,21,68,0,0,21,68,0,0,21,68,0,0,21,68,0,0,21,86,0,0,
+21,86,0,0,21,68,0,0,21,86,0,0,21,86,0,0,21,68,0,0,21,86,0,1,21,206,0,0,21,
+104,0,0,21,56,0,0,21,62,0,0,21,68,0,77,20,248,20,248,21,4,21,4,21,10,21,10,
+21,16,21,16,20,248,20,248,21,22,21,22,21,28,21,28,21,34,20,248,21,34,21,34,
+21,22,21,22,21,40,21,40,21,46,21,46,21,40,21,40,21,34,21,34,21,34,21,34,21,
+52,21,22,21,58,21,58,21,34,21,34,20,248,20,248,21,64,21,64,20,224,20,224,
+21,70,21,40,21,4,21,4,21,76,21,106,21,82,21,64,21,88,21,88,20,248,20,248,
+21,94,21,94,21,94,21,94,21,94,21,94,21,94,21,94,20,248,20,248,21,16,21,4,
+20,248,20,248,21,46,21,46,21,40,21,40,21,34,21,34,21,82,21,64,20,248,20,248,
+21,88,21,88,21,88,21,88,21,88,21,88,21,88,21,88,21,58,20,248,21,58,20,248,
+20,248,20,248,21,4,21,4,21,10,21,10,21,16,21,4,20,248,20,248,21,22,21,22,
+21,28,21,28,21,34,21,34,21,112,21,112,21,40,21,118,21,46,21,46,21,40,21,40,
+21,34,21,34,21,58,21,58,21,34,21,34,21,64,21,64,20,224,20,224,20,224,20,224,
+21,76,21,106,21,82,21,64,21,88,21,88,20,248,20,248,21,22,21,22,21,4,21,4,
+21,46,21,46,20,224,20,224,21,40,21,40,21,40,21,40,21,40,21,118,21,40,21,118,
+21,40,21,40,20,224,20,224,0,2,0,11,0,4,0,4,0,0,0,9,0,9,0,1,0,14,0,14,0,2,
+0,21,0,26,0,3,0,29,0,29,0,9,0,35,0,43,0,10,0,46,0,46,0,19,0,48,0,48,0,20,
+0,56,0,56,0,21,0,58,0,58,0,22,0,147,0,149,0,23,0,2,0,7,0,59,0,88,0,0,0,94,
+0,94,0,30,0,96,0,103,0,31,0,105,0,136,0,39,0,138,0,141,0,71,0,145,0,145,0,
+75,0,150,0,150,0,76,0,3,0,1,0,88,0,1,0,80,0,1,0,116,0,1,0,0,0,18,0,3,0,2,
+0,96,0,68,0,1,0,60,0,0,0,1,0,0,0,18,0,3,0,1,0,128,0,1,0,40,0,1,0,76,0,1,0,
+0,0,18,0,3,0,2,0,56,0,108,0,1,0,20,0,0,0,1,0,0,0,18,0,1,0,2,0,50,0,93,0,2,
+0,4,0,59,0,88,0,0,0,96,0,103,0,30,0,145,0,145,0,38,0,150,0,150,0,39,0,2,0,
+8,0,5,0,8,0,0,0,10,0,11,0,4,0,15,0,15,0,6,0,17,0,18,0,7,0,20,0,20,0,9,0,27,
+0,27,0,10,0,30,0,31,0,11,0,34,0,34,0,13,0,2,0,3,0,94,0,94,0,0,0,105,0,136,
+0,1,0,138,0,141,0,33,0,3,0,1,0,144,0,1,0,80,0,1,0,172,0,1,0,0,0,19,0,3,0,
+1,0,124,0,1,0,60,0,1,0,186,0,1,0,0,0,19,0,3,0,1,0,200,0,1,0,40,0,1,0,166,
+0,1,0,0,0,19,0,3,0,1,0,180,0,1,0,20,0,1,0,112,0,1,0,0,0,19,0,2,0,10,0,4,0,
+4,0,0,0,9,0,9,0,1,0,14,0,14,0,2,0,21,0,26,0,3,0,29,0,29,0,9,0,35,0,43,0,10,
+0,46,0,46,0,19,0,48,0,48,0,20,0,58,0,58,0,21,0,147,0,149,0,22,0,2,0,4,0,59,
+0,88,0,0,0,96,0,103,0,30,0,145,0,145,0,38,0,150,0,150,0,39,0,2,0,5,0,4,0,
+4,0,0,0,9,0,9,0,1,0,14,0,14,0,2,0,21,0,26,0,3,0,29,0,29,0,9,0,2,0,5,0,35,
+0,43,0,0,0,46,0,46,0,9,0,48,0,48,0,10,0,58,0,58,0,11,0,147,0,149,0,12,0,2,
+0,3,0,94,0,94,0,0,0,105,0,136,0,1,0,138,0,141,0,33,0,3,0,2,0,132,0,140,0,
+1,0,80,0,0,0,1,0,0,0,20,0,3,0,1,0,120,0,1,0,60,0,1,0,112,0,1,0,0,0,20,0,3,
+0,2,0,92,0,128,0,1,0,40,0,0,0,1,0,0,0,20,0,3,0,1,0,108,0,1,0,20,0,1,0,72,
+0,1,0,0,0,20,0,2,0,8,0,5,0,8,0,0,0,10,0,11,0,4,0,15,0,15,0,6,0,17,0,18,0,
+7,0,20,0,20,0,9,0,27,0,27,0,10,0,30,0,31,0,11,0,34,0,34,0,13,0,1,0,2,0,50,
+0,93,0,2,0,4,0,59,0,88,0,0,0,96,0,103,0,30,0,145,0,145,0,38,0,150,0,150,0,
+39,0,2,0,3,0,94,0,94,0,0,0,105,0,136,0,1,0,138,0,141,0,33,0,3,0,2,0,144,0,
+178,0,1,0,80,0,0,0,1,0,0,0,21,0,3,0,2,0,186,0,158,0,1,0,60,0,0,0,1,0,0,0,
+21,0,3,0,2,0,104,0,200,0,1,0,40,0,0,0,1,0,0,0,21,0,3,0,2,0,146,0,180,0,1,
+0,20,0,0,0,1,0,0,0,21,0,2,0,10,0,4,0,4,0,0,0,9,0,9,0,1,0,14,0,14,0,2,0,21,
+0,26,0,3,0,29,0,29,0,9,0,35,0,43,0,10,0,46,0,46,0,19,0,48,0,48,0,20,0,58,
+0,58,0,21,0,147,0,149,0,22,0,2,0,5,0,35,0,43,0,0,0,46,0,46,0,9,0,48,0,48,
+0,10,0,58,0,58,0,11,0,147,0,149,0,12,0,2,0,4,0,59,0,88,0,0,0,96,0,103,0,30,
+0,145,0,145,0,38,0,150,0,150,0,39,0,2,0,5,0,4,0,4,0,0,0,9,0,9,0,1,0,14,0,
+14,0,2,0,21,0,26,0,3,0,29,0,29,0,9,0,2,0,3,0,94,0,94,0,0,0,105,0,136,0,1,
+0,138,0,141,0,33,0,1,0,182,0,204,0,1,0,12,0,26,0,3,0,0,14,166,0,0,14,166,
+0,0,14,166,0,77,16,48,16,48,16,48,16,78,16,48,16,84,16,78,16,48,16,48,16,
+84,16,78,16,84,14,152,16,48,16,78,16,84,16,48,16,84,16,84,16,48,16,48,16,
+78,16,78,16,48,16,78,16,78,16,84,16,84,16,84,16,84,16,84,16,48,16,78,16,48,
+16,84,14,152,16,48,16,78,16,84,16,78,14,152,16,78,14,152,16,48,16,48,16,48,
+16,48,16,48,16,78,16,48,16,84,16,78,16,48,16,84,16,78,16,84,14,152,16,78,
+16,84,16,84,16,48,16,48,16,78,16,48,16,78,16,78,16,84,16,90,16,48,16,84,16,
+48,16,96,16,96,16,78,16,78,14,152,16,48,0,2,0,3,0,12,0,12,0,0,0,28,0,28,0,
+1,0,33,0,33,0,2,0,2,0,7,0,59,0,88,0,0,0,94,0,94,0,30,0,96,0,103,0,31,0,105,
+0,136,0,39,0,138,0,141,0,71,0,145,0,145,0,75,0,150,0,150,0,76,0,1,0,178,0,
+186,0,1,0,12,0,22,0,2,0,0,13,172,0,0,13,172,0,77,15,112,15,118,13,216,15,
+118,15,64,13,222,15,124,15,64,15,64,13,222,15,130,15,130,15,136,15,64,15,
+64,13,222,13,216,15,64,15,64,15,64,15,64,15,118,15,118,15,64,15,142,15,148,
+15,154,14,2,14,2,14,2,14,2,15,112,15,118,15,64,15,130,15,130,15,64,15,142,
+15,154,15,160,15,148,15,160,15,148,15,112,15,112,15,112,15,118,13,216,15,
+118,15,64,13,222,15,124,15,64,13,222,15,130,15,130,15,130,15,64,13,216,15,
+64,15,64,15,64,15,118,15,64,15,142,15,148,15,154,13,240,15,118,15,130,15,
+64,15,130,15,130,15,130,15,130,15,136,15,64,0,1,0,2,0,16,0,19,0,2,0,7,0,59,
+0,88,0,0,0,94,0,94,0,30,0,96,0,103,0,31,0,105,0,136,0,39,0,138,0,141,0,71,
+0,145,0,145,0,75,0,150,0,150,0,76,0,1,0,178,0,186,0,1,0,12,0,22,0,2,0,0,14,
+104,0,0,14,110,0,77,14,190,14,196,14,202,14,208,14,28,14,214,14,220,14,226,
+14,226,14,214,14,232,14,208,14,238,14,244,14,244,14,4,14,4,14,106,14,34,14,
+250,15,0,15,6,15,12,13,182,14,208,14,244,14,244,14,238,14,238,14,238,14,238,
+14,190,14,208,14,28,14,208,14,238,14,244,14,208,14,244,14,244,14,244,14,244,
+14,244,14,190,14,190,14,190,14,196,14,202,14,208,14,28,14,214,14,220,14,226,
+14,214,14,232,14,208,14,238,14,190,14,4,14,106,14,250,15,0,15,12,13,182,14,
+208,14,244,14,190,14,214,14,196,14,208,15,0,14,238,14,238,14,232,14,232,14,
+238,14,106,0,1,0,2,0,13,0,32,0,2,0,7,0,59,0,88,0,0,0,94,0,94,0,30,0,96,0,
+103,0,31,0,105,0,136,0,39,0,138,0,141,0,71,0,145,0,145,0,75,0,150,0,150,0,
+76,0,3,0,2,0,180,0,214,0,1,0,172,0,0,0,1,0,0,0,22,0,3,0,3,1,50,1,56,0,194,
+0,1,0,152,0,0,0,1,0,0,0,22,0,3,0,3,1,40,1,46,0,172,0,1,0,130,0,0,0,1,0,0,
+0,22,0,3,0,3,1,30,1,36,0,150,0,1,0,108,0,0,0,1,0,0,0,22,0,3,0,3,1,20,1,26,
+0,128,0,1,0,86,0,0,0,1,0,0,0,22,0,3,0,3,1,10,1,16,0,106,0,1,0,64,0,0,0,1,
+0,0,0,22,0,3,0,3,1,0,1,6,0,84,0,1,0,42,0,0,0,1,0,0,0,22,0,3,0,2,0,246,0,62,
+0,1,0,20,0,0,0,1,0,0,0,22,0,1,0,2,0,13,0,32,0,2,0,5,0,35,0,43,0,0,0,46,0,
+46,0,9,0,48,0,48,0,10,0,58,0,58,0,11,0,147,0,149,0,12,0,2,0,18,0,61,0,62,
+0,0,0,64,0,65,0,2,0,68,0,68,0,4,0,71,0,71,0,5,0,75,0,75,0,6,0,83,0,83,0,7,
+0,97,0,97,0,8,0,100,0,100,0,9,0,102,0,102,0,10,0,113,0,114,0,11,0,116,0,117,
+0,13,0,119,0,119,0,15,0,122,0,122,0,16,0,124,0,124,0,17,0,130,0,130,0,18,
+0,133,0,133,0,19,0,138,0,139,0,20,0,145,0,145,0,22,0,1,0,1,0,39,0,1,0,1,0,
+35,0,1,0,1,0,48,0,1,0,1,0,35,0,1,0,1,0,48,0,1,0,1,0,39,0,1,0,1,0,48,0,1,0,
+1,0,40,0,1,0,1,0,48,0,1,0,1,0,42,0,1,0,1,0,48,0,1,0,1,0,43,0,1,0,1,0,48,0,
+3,0,2,1,32,1,38,0,1,1,4,0,0,0,1,0,0,0,23,0,3,0,2,1,24,1,30,0,1,0,240,0,0,
+0,1,0,0,0,23,0,3,0,2,1,16,1,22,0,1,0,220,0,0,0,1,0,0,0,23,0,3,0,2,1,8,1,14,
+0,1,0,200,0,0,0,1,0,0,0,23,0,3,0,2,1,0,1,6,0,1,0,180,0,0,0,1,0,0,0,23,0,3,
+0,2,0,248,0,254,0,1,0,160,0,0,0,1,0,0,0,23,0,3,0,2,0,240,0,246,0,1,0,140,
+0,0,0,1,0,0,0,23,0,3,0,2,0,232,0,238,0,1,0,120,0,0,0,1,0,0,0,23,0,3,0,2,0,
+224,0,230,0,1,0,100,0,0,0,1,0,0,0,23,0,3,0,2,0,216,0,222,0,1,0,80,0,0,0,1,
+0,0,0,23,0,3,0,2,0,208,0,214,0,1,0,60,0,0,0,1,0,0,0,23,0,3,0,2,0,200,0,206,
+0,1,0,40,0,0,0,1,0,0,0,23,0,3,0,2,0,192,0,198,0,1,0,20,0,0,0,1,0,0,0,23,0,
+2,0,4,0,4,0,4,0,0,0,9,0,9,0,1,0,22,0,24,0,2,0,48,0,48,0,5,0,1,0,1,0,48,0,
+1,0,1,0,39,0,1,0,1,0,22,0,1,0,1,0,40,0,1,0,1,0,48,0,1,0,1,0,40,0,1,0,1,0,
+22,0,1,0,1,0,41,0,1,0,1,0,13,0,1,0,1,0,41,0,1,0,1,0,9,0,1,0,1,0,42,0,1,0,
+1,0,35,0,1,0,1,0,43,0,1,0,1,0,39,0,1,0,1,0,43,0,1,0,1,0,9,0,1,0,1,0,43,0,
+1,0,1,0,13,0,1,0,1,0,43,0,1,0,1,0,22,0,1,0,1,0,43,0,1,0,1,0,23,0,1,0,1,0,
+43,0,1,0,1,0,48,0,1,0,1,0,43,0,3,0,2,0,56,0,62,0,2,0,44,0,50,0,0,0,1,0,0,
+0,24,0,3,0,2,0,46,0,52,0,2,0,22,0,28,0,0,0,1,0,0,0,24,0,1,0,1,0,23,0,1,0,
+1,0,24,0,1,0,1,0,44,0,1,0,1,0,77,0,1,0,1,0,47,0,1,0,1,0,77,0,1,1,168,0,4,
+0,0,0,43,0,96,0,178,1,24,0,96,1,30,0,96,1,68,0,96,0,96,1,74,0,96,0,96,0,96,
+1,74,0,96,0,96,1,74,1,74,0,96,1,74,0,96,0,96,1,74,0,96,0,96,1,74,1,74,1,74,
+1,74,0,96,0,96,0,96,1,74,0,96,0,96,0,96,1,74,1,74,0,96,0,96,0,96,0,96,1,74,
+0,20,0,62,255,195,0,65,255,215,0,68,255,215,0,69,255,195,0,71,255,215,0,76,
+255,236,0,78,255,215,0,80,255,215,0,83,255,195,0,87,255,215,0,88,255,215,
+0,97,255,195,0,100,255,215,0,102,255,195,0,114,255,195,0,120,255,195,0,122,
+255,215,0,126,255,215,0,130,255,195,0,145,255,215,0,25,0,62,255,154,0,65,
+255,236,0,67,255,215,0,68,255,215,0,69,255,154,0,71,255,215,0,78,255,215,
+0,80,255,215,0,83,255,154,0,84,255,215,0,97,255,154,0,100,255,215,0,102,255,
+154,0,105,255,215,0,106,255,215,0,107,255,215,0,108,255,215,0,114,255,154,
+0,118,255,215,0,120,255,154,0,122,255,215,0,126,255,215,0,130,255,154,0,131,
+255,215,0,145,255,215,0,1,0,65,0,41,0,9,0,62,0,41,0,69,0,41,0,76,0,41,0,83,
+0,41,0,97,0,41,0,102,0,41,0,114,0,41,0,120,0,41,0,130,0,41,0,1,0,80,255,236,
+0,23,0,59,255,215,0,60,255,215,0,61,255,215,0,70,255,215,0,71,255,236,0,73,
+255,236,0,75,255,215,0,78,255,236,0,80,255,236,0,85,255,215,0,96,255,215,
+0,99,255,215,0,100,255,236,0,103,255,215,0,109,255,215,0,110,255,215,0,111,
+255,215,0,112,255,215,0,122,255,236,0,126,255,236,0,132,255,215,0,134,255,
+215,0,145,255,236,0,2,0,18,0,60,0,63,0,0,0,65,0,67,0,4,0,69,0,73,0,7,0,76,
+0,79,0,12,0,82,0,82,0,16,0,84,0,85,0,17,0,95,0,95,0,19,0,98,0,101,0,20,0,
+103,0,103,0,24,0,105,0,108,0,25,0,115,0,115,0,29,0,118,0,118,0,30,0,121,0,
+122,0,31,0,125,0,127,0,33,0,129,0,129,0,36,0,131,0,132,0,37,0,134,0,136,0,
+39,0,145,0,145,0,42,0,1,0,10,0,5,0,25,0,10,0,1,0,1,0,44,0,1,0,178,0,186,0,
+1,0,12,0,22,0,2,0,0,5,120,0,0,5,120,0,77,8,104,8,110,8,116,8,122,8,98,8,128,
+8,134,8,140,8,140,8,128,8,146,8,146,8,146,8,152,8,152,8,128,8,158,8,152,8,
+140,8,164,8,164,8,170,8,170,8,140,8,176,8,182,8,152,8,146,8,146,8,146,8,146,
+8,104,8,122,8,98,8,146,8,146,8,152,8,176,8,152,8,194,8,182,8,194,8,182,8,
+104,8,104,8,104,8,110,8,116,8,122,8,98,8,128,8,134,8,200,8,128,8,146,8,146,
+8,146,8,152,8,158,8,152,8,164,8,164,8,170,8,140,8,176,8,182,8,152,8,206,8,
+188,8,170,8,164,8,146,8,146,8,146,8,146,8,146,8,98,0,1,0,2,0,50,0,93,0,2,
+0,7,0,59,0,88,0,0,0,94,0,94,0,30,0,96,0,103,0,31,0,105,0,136,0,39,0,138,0,
+141,0,71,0,145,0,145,0,75,0,150,0,150,0,76,0,1,1,14,1,78,0,1,0,12,0,114,0,
+25,0,0,8,8,0,0,8,8,0,0,8,8,0,0,8,8,0,0,8,8,0,0,8,8,0,0,8,8,0,0,8,14,0,0,8,
+8,0,0,8,8,0,0,8,20,0,0,8,20,0,0,8,20,0,0,8,20,0,0,8,20,0,0,8,20,0,0,8,20,
+0,0,8,20,0,0,8,20,0,0,8,20,0,0,8,26,0,0,6,52,0,0,7,246,0,0,7,252,0,0,8,2,
+0,77,5,218,7,186,5,236,5,230,5,218,5,248,5,254,5,218,6,4,7,192,6,88,6,16,
+6,10,6,4,6,4,7,198,6,28,6,4,5,218,7,204,5,194,5,194,5,194,6,76,6,250,6,58,
+5,218,6,28,6,28,6,28,6,28,5,218,5,230,5,218,6,16,6,10,6,4,6,250,5,218,6,58,
+6,58,6,58,6,58,6,40,6,40,5,218,5,230,5,236,5,230,5,218,5,248,5,254,6,4,5,
+248,6,88,6,16,6,10,6,4,6,28,6,4,7,204,5,194,5,194,6,76,6,250,6,58,5,218,5,
+248,5,230,6,16,5,194,6,10,6,10,6,88,6,88,6,10,5,194,0,2,0,10,0,4,0,4,0,0,
+0,9,0,9,0,1,0,14,0,14,0,2,0,21,0,26,0,3,0,29,0,29,0,9,0,35,0,43,0,10,0,46,
+0,46,0,19,0,48,0,48,0,20,0,58,0,58,0,21,0,147,0,149,0,22,0,2,0,7,0,59,0,88,
+0,0,0,94,0,94,0,30,0,96,0,103,0,31,0,105,0,136,0,39,0,138,0,141,0,71,0,145,
+0,145,0,75,0,150,0,150,0,76,0,1,0,226,1,22,0,1,0,12,0,70,0,14,0,0,6,188,0,
+0,5,108,0,0,6,194,0,0,6,188,0,0,5,108,0,0,6,194,0,0,3,236,0,0,6,194,0,0,3,
+230,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,6,200,0,77,3,202,3,172,3,
+178,3,184,3,106,3,190,3,196,3,202,3,202,3,190,3,208,3,208,6,148,3,202,3,214,
+3,190,3,220,3,226,3,106,3,106,3,106,3,232,3,232,3,238,3,196,3,250,3,202,3,
+232,3,232,3,232,3,232,3,202,3,238,3,202,5,80,6,148,6,148,3,196,3,202,3,250,
+5,86,3,250,5,86,3,202,3,202,3,202,3,172,3,178,3,184,3,106,3,190,3,196,3,202,
+3,190,3,208,3,208,6,148,3,214,3,220,3,226,3,106,3,106,3,232,3,238,3,196,3,
+250,3,202,6,154,3,178,6,136,3,208,6,148,6,148,3,208,3,208,6,148,3,106,0,2,
+0,8,0,5,0,8,0,0,0,10,0,11,0,4,0,15,0,15,0,6,0,17,0,18,0,7,0,20,0,20,0,9,0,
+27,0,27,0,10,0,30,0,31,0,11,0,34,0,34,0,13,0,2,0,7,0,59,0,88,0,0,0,94,0,94,
+0,30,0,96,0,103,0,31,0,105,0,136,0,39,0,138,0,141,0,71,0,145,0,145,0,75,0,
+150,0,150,0,76,0,1,1,14,1,78,0,1,0,12,0,114,0,25,0,0,5,162,0,0,5,168,0,0,
+5,174,0,0,5,162,0,0,5,174,0,0,5,180,0,0,5,102,0,0,3,194,0,0,5,174,0,0,5,162,
+0,0,5,180,0,0,5,186,0,0,5,156,0,0,5,156,0,0,5,192,0,0,5,198,0,0,5,198,0,0,
+5,204,0,0,5,204,0,0,5,210,0,0,5,216,0,0,5,222,0,0,5,150,0,0,5,156,0,0,5,150,
+0,77,3,26,3,38,3,44,5,126,3,26,3,92,3,62,3,26,3,68,5,132,5,120,3,80,3,74,
+3,68,3,68,5,66,3,92,3,68,3,26,3,2,3,2,3,62,3,2,5,138,3,68,4,58,3,26,3,128,
+3,128,3,128,3,128,3,26,5,126,3,26,3,80,3,74,3,68,3,68,3,26,4,58,4,58,4,58,
+4,58,3,80,3,80,3,26,3,38,3,44,5,126,3,26,3,92,3,62,3,68,5,132,5,120,3,80,
+3,74,3,68,3,92,3,68,3,2,3,2,3,2,5,138,3,68,4,58,3,26,3,92,3,38,3,80,3,2,3,
+74,3,74,5,120,5,120,3,74,3,2,0,2,0,10,0,4,0,4,0,0,0,9,0,9,0,1,0,14,0,14,0,
+2,0,21,0,26,0,3,0,29,0,29,0,9,0,35,0,43,0,10,0,46,0,46,0,19,0,48,0,48,0,20,
+0,58,0,58,0,21,0,147,0,149,0,22,0,2,0,7,0,59,0,88,0,0,0,94,0,94,0,30,0,96,
+0,103,0,31,0,105,0,136,0,39,0,138,0,141,0,71,0,145,0,145,0,75,0,150,0,150,
+0,76,0,1,0,8,0,1,1,64,0,1,0,2,0,13,0,32,0,2,0,20,0,1,0,6,253,228,253,228,
+253,228,253,228,253,228,254,112,0,2,0,4,0,4,0,4,0,0,0,9,0,9,0,1,0,22,0,24,
+0,2,0,48,0,48,0,5,0,1,0,20,0,1,0,1,0,1,0,12,0,1,0,24,0,200,255,56,0,1,0,1,
+0,23,0,1,0,60,5,150,0,1,0,0,5,150,0,1,1,4,5,150,0,1,255,126,5,150,0,1,0,80,
+5,150,0,1,255,176,5,150,0,1,254,212,5,150,0,1,0,100,5,161,0,1,2,88,5,150,
+0,1,2,88,2,88,0,1,0,0,2,188,0,1,2,138,2,188,0,1,2,168,2,128,0,1,255,206,2,
+188,0,1,2,148,3,32,0,1,255,206,3,32,0,1,2,38,1,4,0,1,1,124,2,188,0,1,2,118,
+2,188,0,1,1,184,2,148,0,1,1,174,2,208,0,1,1,154,2,188,0,1,2,228,2,188,0,1,
+3,182,2,108,0,1,0,120,2,28,0,1,2,88,5,70,0,1,0,230,5,70,0,1,0,0,5,70,0,1,
+0,170,5,70,0,1,1,4,5,70,0,1,0,160,5,70,0,1,255,156,5,70,0,1,0,20,5,70,0,1,
+0,0,5,110,0,1,2,88,6,164,0,1,2,159,5,70,0,1,1,244,5,70,0,1,1,104,5,70,0,1,
+2,28,5,70,0,1,1,14,5,70,0,1,1,164,5,70,0,1,2,148,5,70,0,1,1,144,5,70,0,1,
+3,12,5,70,0,1,1,64,5,70,0,1,2,128,5,70,0,1,2,8,5,70,0,1,2,48,5,70,0,1,2,248,
+5,70,0,1,2,188,5,70,0,1,2,148,6,164,0,1,1,14,6,164,0,1,1,244,6,164,0,1,1,
+204,6,164,0,1,2,48,6,164,0,1,0,0,6,14,0,1,2,8,6,164,0,1,2,248,6,164,0,1,1,
+104,6,164,0,1,2,28,6,164,0,1,1,164,6,164,0,1,1,144,6,164,0,1,3,12,6,164,0,
+1,1,64,6,164,0,1,2,128,6,164,0,1,2,188,6,164,0,1,255,226,0,20,0,1,255,196,
+0,20,0,1,0,0,0,20,0,1,2,88,0,0,0,1,0,45,0,0,0,1,0,0,0,0,0,1,0,27,0,0,0,1,
+2,148,0,0,0,1,0,253,0,0,0,1,2,48,0,0,0,1,1,194,0,0,0,1,3,62,0,0,0,1,1,14,
+0,0,0,1,1,44,0,0,0,1,2,168,0,0,0,1,1,164,0,0,0,1,1,204,0,0,0,1,254,252,0,
+0,0,1,1,104,0,0,0,1,1,244,0,0,0,1,3,192,0,0,0,1,3,92,0,0,0,1,3,52,0,0,0,1,
+2,208,0,0,0,1,2,8,0,0,0,1,0,0,0,50,0,1,2,108,0,0,0,1,1,24,0,0,0,1,1,84,0,
+0,0,1,0,240,5,70,0,1,3,232,5,70,0,1,0,0,0,40,0,1,0,0,0,10,0,1,3,232,0,0,0,
+1,0,140,5,70,0,1,0,200,5,70,0,1,0,100,5,70,0,1,255,76,5,70,0,1,4,56,5,70,
+0,1,3,132,5,70,0,1,1,204,5,70,0,1,3,32,5,70,0,1,3,112,5,70,0,1,3,92,5,70,
+0,1,5,20,5,70,0,1,4,76,5,70,0,1,5,180,5,70,0,1,4,36,0,0,0,1,3,72,0,0,0,1,
+2,68,0,0,0,1,2,248,0,0,0,1,0,180,0,0,0,1,0,240,0,0,0,1,3,252,0,0,0,1,4,16,
+0,0,0,1,2,188,0,0,0,1,4,56,0,0,0,1,4,176,0,0,0,1,3,132,0,0,0,1,2,228,0,0,
+0,1,3,32,0,0,0,1,3,232,5,150,0,1,4,96,5,150,0,1,3,172,5,150,0,1,2,128,5,150,
+0,1,3,192,5,150,0,1,1,244,5,150,0,1,2,28,5,150,0,1,4,56,5,150,0,1,3,112,5,
+150,0,1,4,176,5,150,0,1,2,138,5,150,0,1,4,76,5,150,0,1,3,212,5,150,0,1,3,
+92,5,150,0,1,5,80,5,150,0,1,3,252,5,150,0,1,6,164,5,150,0,1,4,156,5,150,0,
+1,2,148,5,150,0,1,254,192,0,20,0,1,254,172,0,20,0,1,254,212,0,20,0,1,255,
+56,0,20,0,1,254,182,0,20,0,1,255,16,0,20,0,1,255,16,0,0,0,1,2,38,0,0,0,1,
+0,200,0,0,0,1,1,184,0,0,0,1,1,174,0,0,0,1,1,224,5,70,0,1,1,44,5,70,0,1,0,
+240,5,110,0,1,2,168,5,70,0,1,0,180,5,70,0,1,1,124,0,20,0,1,1,44,0,20,0,1,
+0,220,0,20,0,1,0,140,0,0,0,1,0,180,0,20,0,1,0,160,0,20,0,1,1,64,0,20,0,1,
+0,140,0,20,0,1,0,240,0,20,0,1,0,200,0,20,0,1,1,4,0,20,0,1,0,120,0,0,0,1,2,
+28,0,0,0,1,2,218,0,0,0,1,1,124,0,0,0,1,0,160,0,0,0,1,0,0,0,10,0,36,0,88,0,
+1,104,101,98,114,0,8,0,4,0,0,0,0,255,255,0,4,0,1,0,0,0,2,0,3,0,4,99,99,109,
+112,0,26,100,108,105,103,0,34,108,105,103,97,0,40,115,97,108,116,0,46,0,0,
+0,2,0,1,0,2,0,0,0,1,0,0,0,0,0,1,0,3,0,0,0,1,0,4,0,6,0,14,0,22,0,30,0,38,0,
+46,0,54,0,4,0,1,0,1,0,48,0,4,0,1,0,1,0,64,0,6,0,1,0,1,2,2,0,4,0,0,0,1,2,86,
+0,1,0,0,0,1,2,118,0,4,0,1,0,1,2,124,0,1,0,18,0,1,0,8,0,1,0,4,0,137,0,2,0,
+71,0,1,0,1,0,59,0,1,1,156,0,25,0,56,0,66,0,76,0,86,0,96,0,106,0,116,0,126,
+0,136,0,154,0,164,0,174,0,192,0,218,0,228,1,0,1,10,1,20,1,30,1,40,1,50,1,
+60,1,70,1,80,1,146,0,1,0,4,0,147,0,2,0,48,0,1,0,4,0,148,0,2,0,48,0,1,0,4,
+0,149,0,2,0,48,0,1,0,4,0,146,0,2,0,47,0,1,0,4,0,112,0,2,0,47,0,1,0,4,0,113,
+0,2,0,47,0,1,0,4,0,114,0,2,0,47,0,1,0,4,0,115,0,2,0,47,0,2,0,6,0,12,0,116,
+0,2,0,47,0,133,0,2,0,44,0,1,0,4,0,117,0,2,0,47,0,1,0,4,0,118,0,2,0,47,0,2,
+0,6,0,12,0,119,0,2,0,47,0,92,0,2,0,39,0,3,0,8,0,14,0,20,0,120,0,2,0,47,0,
+141,0,2,0,35,0,140,0,2,0,43,0,1,0,4,0,121,0,2,0,47,0,3,0,8,0,14,0,22,0,139,
+0,2,0,44,0,138,0,3,0,47,0,44,0,122,0,2,0,47,0,1,0,4,0,123,0,2,0,47,0,1,0,
+4,0,124,0,2,0,47,0,1,0,4,0,125,0,2,0,47,0,1,0,4,0,126,0,2,0,47,0,1,0,4,0,
+127,0,2,0,47,0,1,0,4,0,128,0,2,0,47,0,1,0,4,0,129,0,2,0,47,0,1,0,4,0,130,
+0,2,0,47,0,7,0,16,0,24,0,32,0,38,0,46,0,54,0,60,0,107,0,3,0,52,0,47,0,107,
+0,3,0,47,0,52,0,105,0,2,0,52,0,108,0,3,0,53,0,47,0,108,0,3,0,47,0,53,0,106,
+0,2,0,53,0,131,0,2,0,47,0,1,0,4,0,132,0,2,0,47,0,2,0,7,0,36,0,38,0,0,0,59,
+0,65,0,3,0,67,0,71,0,10,0,73,0,73,0,15,0,75,0,76,0,16,0,78,0,79,0,18,0,81,
+0,85,0,20,0,3,0,0,0,2,0,20,0,48,0,1,0,64,0,1,0,0,0,5,0,2,0,4,0,59,0,60,0,
+0,0,70,0,70,0,2,0,79,0,79,0,3,0,88,0,88,0,4,0,2,0,2,0,42,0,43,0,0,0,50,0,
+50,0,2,0,2,0,4,0,59,0,88,0,0,0,96,0,103,0,30,0,145,0,145,0,38,0,150,0,150,
+0,39,0,1,0,34,0,1,0,8,0,3,0,8,0,14,0,20,0,142,0,2,0,36,0,143,0,2,0,41,0,144,
+0,2,0,40,0,1,0,1,0,137,0,2,0,8,0,1,0,145,0,1,0,1,0,137,0,1,0,74,0,5,0,16,
+0,34,0,44,0,54,0,64,0,2,0,6,0,12,0,109,0,2,0,42,0,110,0,2,0,43,0,1,0,4,0,
+134,0,2,0,50,0,1,0,4,0,135,0,2,0,50,0,1,0,4,0,136,0,2,0,50,0,1,0,4,0,94,0,
+2,0,42,0,2,0,4,0,59,0,60,0,0,0,70,0,70,0,2,0,79,0,79,0,3,0,88,0,88,0,4,};
+#endif
@@ -0,0 +1,240 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansInscriptionalPahlavi_Regular_ttf_size = 5692;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansInscriptionalPahlavi_Regular_ttf");
+asm(".type fz_font_NotoSansInscriptionalPahlavi_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansInscriptionalPahlavi_Regular_ttf, 5692");
+asm(".balign 64");
+asm("fz_font_NotoSansInscriptionalPahlavi_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansInscriptionalPahlavi-Regular.ttf\"");
+#else
+const int fz_font_NotoSansInscriptionalPahlavi_Regular_ttf_size = 5692;
+const char fz_font_NotoSansInscriptionalPahlavi_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,38,0,39,0,0,19,240,0,0,0,30,71,
+80,79,83,144,224,157,151,0,0,20,16,0,0,0,200,71,83,85,66,131,190,147,197,
+0,0,20,216,0,0,1,98,79,83,47,50,123,123,109,4,0,0,1,104,0,0,0,96,99,109,97,
+112,0,221,45,216,0,0,2,80,0,0,0,184,103,97,115,112,0,22,0,35,0,0,19,224,0,
+0,0,16,103,108,121,102,109,161,226,207,0,0,3,80,0,0,10,24,104,101,97,100,
+2,60,150,78,0,0,0,236,0,0,0,54,104,104,101,97,12,190,6,108,0,0,1,36,0,0,0,
+36,104,109,116,120,151,6,4,31,0,0,1,200,0,0,0,134,108,111,99,97,42,181,40,
+89,0,0,3,8,0,0,0,70,109,97,120,112,0,45,0,123,0,0,1,72,0,0,0,32,110,97,109,
+101,152,18,194,62,0,0,13,104,0,0,6,88,112,111,115,116,255,105,0,102,0,0,19,
+192,0,0,0,32,0,1,0,0,0,1,5,31,153,226,66,6,95,15,60,245,0,11,8,0,0,0,0,0,
+204,198,124,233,0,0,0,0,210,40,203,239,251,201,253,48,8,101,6,41,0,0,0,9,
+0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,48,0,0,9,145,251,201,255,137,8,101,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,1,0,0,0,34,0,61,0,2,0,60,0,4,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,4,0,1,0,4,4,201,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,48,0,0,8,141,2,208,0,0,0,1,
+0,0,0,0,4,74,5,182,0,0,0,32,0,3,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,0,5,163,
+0,30,7,34,0,30,4,223,0,31,3,131,255,205,6,223,0,123,4,160,0,106,3,72,0,86,
+6,96,0,10,3,127,0,113,3,229,255,240,3,193,0,49,3,219,0,57,5,37,0,10,3,53,
+0,0,5,217,0,98,5,35,0,113,5,113,0,102,6,57,0,123,5,49,0,20,3,77,0,100,5,100,
+0,100,7,122,0,100,9,145,0,100,4,179,0,50,3,178,0,150,4,95,0,150,5,133,0,100,
+3,244,0,57,2,205,251,201,251,201,0,0,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,
+0,0,84,0,4,0,64,0,0,0,12,0,8,0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,255,
+0,0,0,0,0,13,0,32,0,160,254,255,255,255,0,1,255,245,255,227,255,99,1,2,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,100,0,0,0,0,0,0,0,7,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,
+0,0,0,160,0,0,0,3,0,0,254,255,0,0,254,255,0,0,0,1,0,1,11,96,0,1,11,114,0,
+0,0,4,0,1,11,120,0,1,11,127,0,0,0,23,0,0,0,21,0,21,0,21,0,21,0,43,0,59,0,
+84,0,143,0,215,0,251,1,35,1,116,1,167,1,202,2,3,2,45,2,114,2,146,2,203,2,
+249,3,60,3,117,3,178,3,205,3,217,3,233,3,253,4,27,4,77,4,146,4,194,4,236,
+4,252,5,12,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,
+33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,0,30,0,
+0,4,245,4,74,0,9,0,0,55,33,3,51,19,33,17,51,17,33,30,1,219,205,186,205,1,
+141,181,251,41,152,3,178,252,78,3,178,251,182,0,1,0,30,254,217,6,116,2,176,
+0,5,0,0,5,17,51,17,33,53,5,191,181,249,170,143,3,63,252,41,152,0,0,1,0,31,
+0,0,4,63,4,94,0,10,0,0,37,38,39,3,55,19,22,18,23,33,53,3,94,72,143,239,155,
+240,111,125,48,251,224,152,211,247,1,162,90,254,94,197,254,204,195,152,0,
+1,255,205,254,82,3,53,4,94,0,38,0,0,1,34,6,7,39,54,54,51,50,22,21,20,6,7,
+22,18,21,20,4,33,34,38,39,53,22,22,51,50,54,53,52,38,39,53,62,2,53,52,1,72,
+45,101,26,52,42,124,58,179,193,148,165,211,223,254,201,254,238,64,173,50,
+45,179,71,185,204,219,191,106,127,60,3,199,26,13,147,20,23,141,133,103,166,
+86,68,254,250,179,196,214,21,14,151,12,23,136,123,149,226,48,142,56,97,88,
+58,123,0,1,0,123,255,236,6,182,4,94,0,48,0,0,1,34,39,17,20,22,22,51,50,55,
+21,6,35,34,38,38,53,17,38,35,34,6,21,20,18,23,35,38,2,53,52,0,51,50,22,23,
+22,22,51,50,54,53,52,39,51,22,21,20,6,5,98,175,148,22,54,51,91,118,120,102,
+115,126,54,127,110,161,171,86,78,184,70,92,1,12,221,103,192,103,105,175,92,
+71,83,8,182,8,184,2,227,68,253,250,79,56,23,21,152,20,60,135,124,2,90,66,
+182,177,130,254,186,152,123,1,87,142,234,1,20,56,57,59,55,85,62,33,27,43,
+21,136,159,0,0,1,0,106,0,0,4,66,4,94,0,20,0,0,19,54,54,51,50,22,21,16,5,33,
+21,33,53,36,17,52,38,35,34,6,7,106,48,231,162,214,240,254,158,1,187,252,172,
+2,69,150,122,94,146,31,3,43,145,162,224,200,254,167,197,152,129,133,1,180,
+119,150,119,98,0,1,0,86,255,236,2,205,4,94,0,24,0,0,1,38,35,34,6,21,20,22,
+22,23,21,4,33,53,50,55,46,2,53,52,54,51,50,23,2,147,73,74,84,84,68,128,177,
+254,224,254,169,243,232,182,140,75,192,156,103,90,3,174,25,102,87,68,112,
+119,129,186,184,159,115,137,145,148,88,158,188,28,0,1,0,10,255,236,6,10,4,
+94,0,60,0,0,1,22,22,21,20,6,35,34,38,38,53,52,62,2,53,52,38,35,34,6,21,20,
+30,2,21,20,6,35,34,39,53,22,51,50,54,53,52,46,2,53,52,54,51,50,22,21,20,14,
+2,21,20,22,51,50,53,52,39,5,221,20,25,188,166,115,159,84,27,32,27,107,92,
+93,100,22,27,23,224,194,94,78,77,95,122,116,23,27,22,192,183,180,197,29,34,
+29,101,83,174,49,2,10,41,120,54,157,168,96,168,104,65,99,87,86,52,108,120,
+122,108,50,83,87,102,67,171,197,20,158,27,104,109,58,100,93,91,51,181,200,
+199,180,50,97,97,97,50,96,119,174,119,96,0,1,0,113,0,0,3,147,6,41,0,31,0,
+0,1,20,6,7,33,21,33,53,54,54,53,52,38,39,38,53,52,36,51,50,22,23,7,38,35,
+32,17,20,22,23,22,22,2,35,101,77,1,219,253,67,119,98,56,67,124,1,17,241,85,
+160,43,55,136,101,254,188,60,64,63,61,2,14,86,216,72,152,121,106,181,118,
+61,116,85,153,185,209,242,37,22,144,51,254,209,72,136,80,80,149,0,1,255,240,
+255,236,3,96,4,94,0,18,0,0,1,34,7,39,54,54,51,50,22,21,20,0,5,53,36,18,53,
+52,38,1,137,181,138,90,93,198,122,222,245,254,154,254,192,1,0,236,157,3,199,
+113,133,68,63,224,200,233,254,131,100,165,110,1,7,180,122,147,0,1,0,49,254,
+20,3,133,4,94,0,36,0,0,1,34,6,7,39,54,54,51,50,22,21,20,6,7,22,22,21,20,6,
+7,33,21,33,53,54,36,53,52,38,38,39,53,62,2,53,52,1,31,45,101,26,52,42,124,
+58,179,193,131,155,175,183,153,119,1,186,252,172,236,1,4,98,170,95,106,127,
+60,3,199,26,13,147,20,23,141,133,102,162,95,70,216,138,118,223,60,152,130,
+54,218,149,81,141,98,14,152,53,93,91,62,123,0,0,1,0,57,254,20,3,133,6,20,
+0,25,0,0,1,54,51,50,22,21,20,6,7,6,6,7,53,54,55,54,54,53,52,38,35,34,6,7,
+17,51,1,100,52,59,198,236,214,218,138,185,89,130,219,161,148,156,135,63,145,
+40,180,2,51,12,228,187,183,239,45,27,81,77,199,92,43,32,150,134,127,139,43,
+31,4,182,0,2,0,10,255,236,4,182,5,182,0,29,0,41,0,0,19,54,55,38,38,53,52,
+54,55,51,6,21,20,23,54,51,50,0,17,16,0,35,34,36,39,53,1,3,6,7,19,22,51,50,
+54,53,52,38,35,34,7,19,10,107,106,28,17,51,33,160,84,35,152,139,254,1,32,
+254,218,248,144,254,252,82,1,19,158,102,97,238,152,178,173,183,189,167,111,
+109,195,3,123,72,49,56,76,52,63,156,47,132,130,59,70,47,254,209,254,248,254,
+244,254,209,77,70,127,1,72,1,36,50,64,253,209,72,213,209,194,222,35,254,143,
+0,0,1,0,0,254,20,3,172,4,74,0,15,0,0,37,38,2,39,51,22,18,23,6,2,7,33,21,33,
+53,36,1,166,119,138,7,178,4,142,116,51,175,120,2,176,252,84,1,54,170,211,
+1,228,233,227,254,25,191,165,254,254,110,152,138,196,0,1,0,98,255,236,5,106,
+4,94,0,35,0,0,1,20,0,5,53,54,18,53,52,38,35,34,7,53,54,51,50,23,54,51,50,
+22,21,20,0,5,53,54,18,53,52,38,35,34,7,22,2,215,254,213,254,182,234,209,143,
+113,92,89,74,107,208,119,157,206,191,220,254,167,254,235,218,218,128,111,
+132,137,35,2,182,244,254,171,129,159,102,1,1,200,117,152,39,151,39,117,117,
+223,201,220,254,121,103,159,117,1,19,167,122,147,88,85,0,2,0,113,255,10,4,
+242,4,94,0,16,0,26,0,0,37,51,21,35,21,35,53,35,32,0,17,16,0,51,32,18,17,39,
+16,38,35,32,17,20,22,51,51,4,96,146,146,180,207,254,212,254,192,1,4,237,1,
+13,241,180,153,175,254,199,234,223,184,152,152,246,246,1,28,1,9,1,12,1,45,
+254,191,254,147,2,1,30,247,254,92,206,189,0,0,1,0,102,254,20,5,27,4,94,0,
+46,0,0,37,6,6,7,33,21,33,53,62,2,55,46,2,53,52,54,54,51,50,22,21,20,22,51,
+50,54,53,52,39,51,22,21,20,6,35,32,17,52,38,35,34,6,21,20,22,2,133,2,147,
+134,2,113,252,139,138,140,67,10,133,153,65,103,183,112,159,181,71,84,71,69,
+9,166,11,160,154,254,203,91,97,95,114,159,184,172,254,98,152,130,108,144,
+133,96,107,187,188,132,107,178,100,176,158,131,106,104,115,79,56,57,78,178,
+193,1,90,114,112,130,108,143,247,0,0,1,0,123,0,0,5,180,4,94,0,35,0,0,19,54,
+51,50,22,21,16,1,33,36,17,52,38,35,34,7,39,54,51,50,22,21,20,2,7,33,21,33,
+53,36,17,52,38,35,34,7,123,92,121,179,214,254,197,1,170,1,100,119,104,87,
+52,56,92,121,179,214,159,156,1,135,250,228,1,133,119,105,87,52,4,59,35,230,
+194,254,230,254,252,247,1,43,120,140,24,149,35,230,194,147,254,236,119,152,
+137,252,1,53,118,142,24,0,0,1,0,20,254,20,4,199,4,74,0,37,0,0,1,6,2,7,33,
+21,33,53,54,18,55,38,2,39,51,22,23,54,54,51,50,22,22,21,20,6,7,39,54,54,53,
+52,38,35,34,6,7,22,2,33,33,135,135,2,219,252,71,106,187,49,18,137,94,202,
+57,56,61,190,95,130,207,112,133,115,129,87,103,148,118,92,156,45,47,1,39,
+140,254,220,203,152,138,122,1,97,168,194,1,189,170,108,175,69,83,111,203,
+131,118,208,85,112,51,167,81,129,156,88,78,188,0,1,0,100,254,20,2,33,4,94,
+0,14,0,0,1,17,52,38,35,34,7,53,54,54,51,50,22,21,17,1,108,63,66,72,63,25,
+96,47,143,134,254,20,4,242,99,94,23,141,13,20,169,173,251,12,255,255,0,100,
+254,20,4,56,4,94,16,34,0,23,0,0,16,3,0,23,2,23,0,0,255,255,0,100,254,20,6,
+78,4,94,16,34,0,23,0,0,16,35,0,23,2,23,0,0,16,3,0,23,4,45,0,0,255,255,0,100,
+254,20,8,101,4,94,16,34,0,23,0,0,16,35,0,23,2,23,0,0,16,35,0,23,4,45,0,0,
+16,3,0,23,6,68,0,0,0,1,0,50,0,0,3,185,4,94,0,16,0,0,19,36,51,50,22,22,21,
+17,35,17,52,38,38,35,34,6,7,50,1,4,180,172,200,91,180,53,120,108,79,185,160,
+4,66,28,67,143,132,252,248,2,250,83,84,38,11,18,0,1,0,150,254,82,3,28,4,94,
+0,32,0,0,1,34,7,53,54,51,32,17,20,6,7,22,22,21,20,6,35,34,39,53,22,51,50,
+54,53,52,38,39,53,36,53,52,38,1,66,76,75,72,102,1,94,148,145,191,203,252,
+232,66,96,85,75,143,158,187,185,1,16,92,3,199,25,148,28,254,187,108,177,76,
+55,239,175,188,205,14,152,15,126,120,141,195,45,133,143,169,90,84,0,2,0,150,
+254,20,3,201,6,20,0,31,0,43,0,0,51,18,18,55,54,18,55,51,6,7,54,51,50,22,21,
+20,6,6,35,34,39,6,3,33,21,6,2,7,35,54,18,55,3,34,7,21,20,22,51,50,54,53,52,
+38,150,23,99,76,22,163,116,166,155,94,46,56,131,170,85,148,87,164,85,51,35,
+2,55,80,198,70,223,85,234,47,33,88,63,75,70,70,82,76,1,91,1,185,127,113,1,
+92,180,251,203,16,161,123,90,138,76,115,196,254,215,129,164,254,220,59,67,
+1,66,103,3,197,95,16,81,91,84,63,65,71,0,2,0,100,254,20,5,174,6,20,0,20,0,
+30,0,0,1,33,21,33,17,35,34,38,53,52,54,51,50,22,21,21,33,17,51,17,33,3,52,
+35,34,6,21,20,22,51,51,2,190,2,240,252,92,78,177,167,156,141,154,151,1,8,
+181,254,67,180,123,60,59,75,89,78,254,172,152,3,222,153,152,149,166,168,174,
+127,3,139,251,222,1,32,181,87,77,77,77,0,0,1,0,57,255,61,3,133,6,20,0,25,
+0,0,1,54,51,50,22,21,20,6,7,6,6,7,53,54,55,54,54,53,52,38,35,34,6,7,17,51,
+1,100,52,59,198,236,214,218,138,185,89,130,219,161,148,156,135,63,145,40,
+180,3,92,12,228,187,183,239,45,27,81,77,199,92,43,32,150,134,127,139,43,31,
+3,141,0,1,251,201,253,48,2,31,2,176,0,5,0,0,1,17,51,17,33,53,1,106,181,249,
+170,253,200,4,232,250,128,152,0,1,251,201,254,217,2,31,2,176,0,5,0,0,5,17,
+51,17,33,53,1,106,181,249,170,143,3,63,252,41,152,0,0,0,0,15,0,186,0,3,0,
+1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,62,0,94,0,3,0,1,4,9,0,2,0,14,0,156,0,
+3,0,1,4,9,0,3,0,100,0,170,0,3,0,1,4,9,0,4,0,62,0,94,0,3,0,1,4,9,0,5,0,30,
+1,14,0,3,0,1,4,9,0,6,0,56,1,44,0,3,0,1,4,9,0,7,0,68,1,100,0,3,0,1,4,9,0,8,
+0,42,1,168,0,3,0,1,4,9,0,9,0,40,1,210,0,3,0,1,4,9,0,10,0,96,1,250,0,3,0,1,
+4,9,0,11,0,62,2,90,0,3,0,1,4,9,0,12,0,60,2,152,0,3,0,1,4,9,0,13,2,150,2,212,
+0,3,0,1,4,9,0,14,0,52,5,106,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,73,0,110,0,115,0,99,0,
+114,0,105,0,112,0,116,0,105,0,111,0,110,0,97,0,108,0,32,0,80,0,97,0,104,0,
+108,0,97,0,118,0,105,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,
+32,0,73,0,110,0,115,0,99,0,114,0,105,0,112,0,116,0,105,0,111,0,110,0,97,0,
+108,0,32,0,80,0,97,0,104,0,108,0,97,0,118,0,105,0,86,0,101,0,114,0,115,0,
+105,0,111,0,110,0,32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,78,0,111,0,116,
+0,111,0,83,0,97,0,110,0,115,0,73,0,110,0,115,0,99,0,114,0,105,0,112,0,116,
+0,105,0,111,0,110,0,97,0,108,0,80,0,97,0,104,0,108,0,97,0,118,0,105,0,78,
+0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,
+0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,
+0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,
+32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,
+0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,
+0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,
+0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,
+0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,
+0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,
+65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,
+0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,
+0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,
+0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,
+0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,
+115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,
+0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,
+0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,
+101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,
+0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,
+0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,
+0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,
+0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,
+0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,
+0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,
+0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,
+7,255,255,0,15,0,1,0,0,0,12,0,0,0,22,0,0,0,2,0,1,0,0,0,33,0,1,0,4,0,0,0,1,
+0,0,0,0,0,1,0,0,0,10,0,48,0,74,0,2,68,70,76,84,0,14,112,104,108,105,0,26,
+0,4,0,0,0,0,255,255,0,1,0,1,0,4,0,0,0,0,255,255,0,1,0,0,0,2,107,101,114,110,
+0,14,107,101,114,110,0,20,0,0,0,1,0,0,0,0,0,1,0,0,0,2,0,6,0,22,0,9,0,1,0,
+1,0,8,0,1,0,8,0,0,0,24,0,9,0,1,0,1,0,8,0,1,0,1,0,0,0,80,0,3,0,0,0,1,0,66,
+0,2,0,20,0,46,0,1,0,0,0,1,0,1,0,11,0,4,0,6,0,8,0,9,0,10,0,11,0,12,0,13,0,
+16,0,18,0,21,0,1,0,8,0,5,0,7,0,14,0,15,0,17,0,19,0,20,0,22,0,1,0,1,0,33,0,
+1,0,10,0,5,0,240,0,240,0,1,0,1,0,33,0,1,0,0,0,10,0,48,0,82,0,2,68,70,76,84,
+0,14,112,104,108,105,0,26,0,4,0,0,0,0,255,255,0,1,0,1,0,4,0,0,0,0,255,255,
+0,1,0,0,0,2,99,99,109,112,0,14,99,99,109,112,0,24,0,0,0,3,0,0,0,1,0,2,0,0,
+0,3,0,0,0,1,0,2,0,6,0,14,0,30,0,46,0,62,0,78,0,94,0,7,0,1,0,1,0,8,0,1,0,6,
+0,0,0,88,0,7,0,1,0,1,0,8,0,1,0,6,0,0,0,116,0,7,0,1,0,1,0,8,0,1,0,6,0,0,0,
+132,0,7,0,1,0,1,0,8,0,1,0,1,0,0,0,166,0,7,0,1,0,1,0,8,0,1,0,1,0,0,0,162,0,
+7,0,1,0,1,0,8,0,1,0,1,0,0,0,158,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,3,0,1,
+0,1,0,5,0,1,0,8,0,5,0,7,0,14,0,15,0,17,0,19,0,20,0,22,0,3,0,0,0,1,0,26,0,
+1,0,18,0,1,0,0,0,4,0,1,0,2,0,14,0,17,0,1,0,1,0,15,0,3,0,0,0,1,0,44,0,1,0,
+18,0,1,0,0,0,5,0,1,0,11,0,4,0,6,0,8,0,9,0,10,0,11,0,12,0,13,0,16,0,18,0,21,
+0,1,0,1,0,5,0,1,0,6,0,27,0,1,0,1,0,5,0,1,0,6,0,16,0,1,0,1,0,15,0,1,0,6,0,
+28,0,1,0,1,0,5,0,0,};
+#endif
@@ -0,0 +1,339 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansInscriptionalParthian_Regular_ttf_size = 8040;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansInscriptionalParthian_Regular_ttf");
+asm(".type fz_font_NotoSansInscriptionalParthian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansInscriptionalParthian_Regular_ttf, 8040");
+asm(".balign 64");
+asm("fz_font_NotoSansInscriptionalParthian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansInscriptionalParthian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansInscriptionalParthian_Regular_ttf_size = 8040;
+const char fz_font_NotoSansInscriptionalParthian_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,38,0,50,0,0,29,56,0,0,0,30,71,80,
+79,83,170,90,175,221,0,0,29,88,0,0,0,248,71,83,85,66,141,255,145,32,0,0,30,
+80,0,0,1,22,79,83,47,50,123,19,110,82,0,0,1,104,0,0,0,96,99,109,97,112,0,
+221,45,94,0,0,2,124,0,0,0,184,103,97,115,112,0,22,0,35,0,0,29,40,0,0,0,16,
+103,108,121,102,76,71,67,137,0,0,3,144,0,0,17,10,104,101,97,100,1,253,177,
+225,0,0,0,236,0,0,0,54,104,104,101,97,12,113,7,141,0,0,1,36,0,0,0,36,104,
+109,116,120,250,38,254,170,0,0,1,200,0,0,0,180,108,111,99,97,75,47,79,140,
+0,0,3,52,0,0,0,92,109,97,120,112,0,50,0,83,0,0,1,72,0,0,0,32,110,97,109,101,
+153,207,194,28,0,0,20,156,0,0,6,94,112,111,115,116,63,31,47,32,0,0,26,252,
+0,0,2,43,0,1,0,0,0,1,7,174,12,226,72,75,95,15,60,245,0,11,8,0,0,0,0,0,204,
+199,225,25,0,0,0,0,210,52,128,112,250,190,253,152,9,36,6,20,0,0,0,9,0,2,0,
+0,0,0,0,0,0,1,0,0,8,141,253,152,0,0,9,135,250,190,0,64,9,36,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,45,0,1,0,0,0,45,0,82,0,4,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,4,5,175,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,5,51,0,
+0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+0,71,79,79,71,0,64,0,0,255,255,8,141,253,152,0,0,8,141,2,104,0,0,0,1,0,0,
+0,0,4,74,5,182,0,0,0,32,0,3,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,0,5,250,0,
+10,6,250,0,31,4,215,0,0,5,59,0,57,5,211,0,86,4,176,0,74,2,160,0,39,6,168,
+0,20,6,135,0,109,2,82,0,41,6,219,0,31,3,195,255,242,5,70,0,10,6,252,0,30,
+5,158,0,31,4,252,0,31,5,172,0,31,9,135,0,30,4,215,255,246,5,27,0,78,4,182,
+0,41,5,134,0,70,2,138,0,41,4,77,0,41,6,15,0,41,7,210,0,41,5,63,0,80,5,73,
+0,80,7,71,0,120,5,73,0,80,2,100,250,190,8,84,0,30,4,197,251,92,7,156,0,80,
+8,241,0,80,5,184,0,80,6,108,0,80,7,186,0,80,7,195,0,80,8,116,0,80,6,186,0,
+59,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,0,12,0,8,0,2,0,
+4,0,0,0,13,0,32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,0,160,254,255,255,
+255,0,1,255,245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,
+0,0,100,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,
+0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,254,255,0,0,254,
+255,0,0,0,1,0,1,11,64,0,1,11,85,0,0,0,4,0,1,11,88,0,1,11,95,0,0,0,26,0,0,
+0,21,0,21,0,21,0,21,0,44,0,94,0,135,0,192,0,239,1,22,1,65,1,106,1,167,1,187,
+1,222,2,4,2,61,2,77,2,115,2,163,2,209,3,5,3,53,3,89,3,140,3,202,3,222,4,0,
+4,48,4,110,4,149,4,204,5,48,5,89,5,105,5,131,5,183,6,20,6,113,6,188,7,5,7,
+112,7,202,8,58,8,133,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,
+33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,
+0,10,0,0,5,76,4,74,0,9,0,0,37,1,51,1,51,17,51,17,33,53,3,74,254,2,205,1,235,
+148,180,250,190,152,3,178,252,78,3,178,251,182,152,0,0,1,0,31,0,0,6,180,4,
+113,0,29,0,0,1,34,6,7,6,35,34,38,39,55,22,51,50,55,54,51,50,18,17,16,0,33,
+33,53,33,32,54,53,52,38,4,209,51,120,76,161,184,135,210,83,119,102,207,156,
+163,163,114,237,242,254,155,254,169,252,39,3,219,1,15,241,149,3,197,32,30,
+63,89,101,107,146,63,62,254,252,255,0,254,214,254,210,152,219,243,171,180,
+0,0,1,0,0,255,236,4,129,4,74,0,20,0,0,19,22,22,51,32,19,51,2,0,0,33,35,53,
+32,0,19,6,33,34,38,39,125,53,141,93,1,114,213,158,16,254,228,254,35,254,199,
+32,1,89,1,221,85,223,254,209,148,193,71,3,145,81,62,1,72,254,180,253,252,
+254,242,151,1,112,1,66,205,90,105,0,2,0,57,254,248,4,219,4,74,0,20,0,33,0,
+0,1,2,2,4,33,35,53,51,32,36,55,33,34,38,38,53,51,20,22,22,51,1,54,54,51,50,
+22,23,35,38,35,34,6,7,4,219,39,232,254,77,254,151,98,145,1,122,1,118,53,254,
+211,205,240,110,180,67,153,153,253,100,16,173,127,133,160,18,123,30,160,73,
+104,14,3,90,254,213,254,182,151,151,224,254,79,166,146,96,100,44,251,158,
+114,134,129,119,106,53,53,0,0,2,0,86,255,236,5,37,4,74,0,19,0,29,0,0,33,17,
+33,20,2,35,34,38,53,52,54,51,51,17,51,17,33,17,51,17,37,50,54,53,35,34,6,
+21,20,22,4,113,254,182,215,191,146,169,228,227,86,180,1,74,180,252,115,104,
+115,80,143,132,70,1,254,249,254,231,161,146,190,185,1,180,254,76,1,180,251,
+182,131,188,191,102,117,75,85,0,0,1,0,74,255,236,4,63,4,94,0,22,0,0,37,51,
+50,54,53,52,38,35,34,6,7,35,54,0,51,50,0,21,20,2,4,35,35,1,104,56,232,253,
+166,125,166,178,12,180,18,1,26,238,214,1,5,167,254,204,200,52,139,252,234,
+149,193,184,165,237,1,7,254,242,223,193,254,218,158,0,0,1,0,39,255,236,2,
+82,4,94,0,27,0,0,1,52,46,2,53,52,55,23,6,6,21,20,30,2,21,20,6,35,34,38,39,
+53,22,51,50,54,1,68,33,41,33,242,135,114,83,33,41,33,153,134,50,107,21,54,
+95,63,73,1,12,52,100,98,93,44,221,242,112,105,160,82,40,83,94,108,64,134,
+156,16,8,152,25,76,0,1,0,20,255,236,5,250,4,74,0,21,0,0,1,51,17,35,34,0,3,
+6,2,4,35,53,50,54,18,18,53,51,18,18,22,51,5,70,180,178,241,254,168,46,39,
+223,254,211,138,104,235,175,97,180,5,143,244,147,4,74,251,182,1,87,1,24,163,
+254,211,179,151,158,1,2,1,94,201,254,228,254,82,232,0,2,0,109,0,0,6,49,4,
+74,0,18,0,37,0,0,1,2,0,33,35,53,51,50,18,19,35,34,38,53,51,20,22,22,51,33,
+2,0,33,35,53,51,50,18,19,35,34,38,53,51,20,22,22,51,3,59,16,254,193,254,233,
+94,92,175,221,22,178,184,158,180,30,73,85,4,84,15,254,190,254,239,98,94,175,
+209,31,178,183,159,181,30,70,88,3,90,254,95,254,71,152,1,24,1,12,185,213,
+99,100,41,254,106,254,60,152,1,21,1,15,185,213,97,100,43,0,1,0,41,255,240,
+1,174,4,74,0,9,0,0,19,51,17,20,6,35,53,50,54,53,250,180,197,192,108,101,4,
+74,253,88,217,217,151,134,149,0,0,1,0,31,0,0,6,133,4,74,0,17,0,0,37,32,0,
+19,33,34,38,53,51,20,22,51,33,2,0,33,33,53,2,221,1,61,1,114,53,254,188,203,
+180,180,92,111,2,8,24,254,34,254,80,253,64,152,1,24,1,19,185,206,127,113,
+254,110,254,56,152,0,0,1,255,242,0,0,3,82,6,20,0,22,0,0,3,54,55,17,51,17,
+22,22,21,20,6,4,35,35,53,51,32,17,52,38,35,34,7,14,101,144,181,197,241,150,
+254,225,202,88,72,1,213,160,123,186,103,2,207,121,37,2,167,253,107,4,222,
+177,148,224,120,152,1,79,115,141,127,0,0,1,0,10,255,236,4,211,5,125,0,32,
+0,0,23,53,50,54,54,19,38,38,39,51,22,22,23,62,2,51,7,34,6,7,33,2,0,35,53,
+54,18,19,33,2,2,6,78,95,109,73,30,179,181,15,180,10,90,105,20,108,202,172,
+47,136,125,16,2,150,14,254,218,235,145,182,23,254,33,31,115,188,20,159,106,
+252,1,9,9,159,168,98,81,6,188,209,95,160,151,181,254,88,254,3,159,4,1,69,
+1,38,254,220,254,177,155,0,0,1,0,30,254,172,6,78,4,74,0,5,0,0,5,17,51,17,
+33,53,5,154,180,249,208,188,5,6,250,98,152,0,0,1,0,31,255,236,5,10,4,74,0,
+19,0,0,1,20,2,7,35,54,18,53,17,33,21,16,0,33,53,54,18,17,17,33,5,10,123,145,
+236,170,146,254,0,254,222,254,243,187,192,3,112,2,150,211,254,194,133,137,
+1,54,215,1,20,143,254,120,254,89,159,4,1,73,1,65,1,49,0,1,0,31,0,0,4,139,
+4,74,0,29,0,0,1,50,55,54,51,50,22,21,16,0,33,33,53,33,32,36,53,52,38,35,34,
+7,6,35,34,38,53,51,20,22,1,242,44,82,81,57,186,215,254,145,254,146,254,113,
+1,145,1,29,1,6,129,133,46,77,78,39,137,133,180,54,3,193,13,13,228,196,254,
+225,254,236,154,186,211,136,147,13,14,137,154,73,64,0,0,1,0,31,255,236,5,
+94,5,55,0,23,0,0,1,18,0,33,6,2,4,35,53,50,54,55,36,39,16,0,33,53,54,18,17,
+52,38,39,2,31,137,1,146,1,36,9,159,254,236,176,154,230,25,254,161,194,254,
+202,254,235,197,214,43,34,5,55,254,197,254,229,227,254,169,187,159,254,197,
+60,251,254,74,254,29,159,2,1,135,1,113,78,245,111,0,1,0,30,254,20,9,36,4,
+74,0,29,0,0,1,19,22,22,51,38,53,17,51,17,20,22,22,23,33,34,38,38,39,3,2,4,
+35,33,53,33,50,54,55,19,6,208,92,52,96,94,26,180,20,46,42,255,0,128,145,101,
+39,148,51,254,250,248,252,92,3,164,161,184,36,215,4,74,254,252,146,88,67,
+140,1,31,254,223,94,100,108,63,63,145,130,252,242,254,244,224,152,164,184,
+4,66,0,0,1,255,246,255,236,4,100,4,74,0,26,0,0,1,46,2,39,51,30,3,51,33,2,
+0,35,53,36,19,35,34,39,2,0,35,53,54,18,1,76,108,131,67,16,180,12,60,123,228,
+173,1,82,13,254,238,241,1,37,47,248,125,53,32,254,246,222,144,173,3,16,18,
+70,108,118,75,63,33,14,254,66,254,25,159,9,2,102,4,254,136,254,102,159,4,
+1,52,0,0,1,0,78,0,0,4,219,4,74,0,18,0,0,1,2,2,4,33,35,53,51,32,0,19,33,34,
+38,53,51,20,22,51,4,219,1,215,254,52,254,121,98,92,1,184,1,178,5,254,79,243,
+201,180,111,149,3,90,254,195,254,142,171,152,1,16,1,27,178,213,135,105,0,
+0,1,0,41,255,113,4,47,4,94,0,28,0,0,5,35,62,2,53,52,38,38,39,53,50,22,23,
+36,55,23,0,5,6,7,54,36,55,23,6,4,7,6,1,82,176,41,31,16,36,79,94,187,176,20,
+1,26,230,106,254,251,254,161,4,14,129,1,32,138,104,162,254,191,207,13,143,
+139,176,222,134,165,184,81,5,151,195,214,163,250,131,254,226,169,237,119,
+52,190,129,129,160,194,64,57,0,1,0,70,0,0,4,248,5,55,0,41,0,0,1,22,22,23,
+54,54,51,50,30,2,21,20,14,2,7,35,62,3,53,52,38,35,34,6,7,14,3,7,35,62,3,53,
+16,39,1,188,20,49,14,68,170,102,109,154,98,44,39,68,91,52,215,59,102,75,43,
+124,117,100,155,51,1,28,61,99,71,209,82,112,69,29,98,5,55,54,160,107,46,58,
+66,115,155,89,85,193,187,168,60,63,168,186,194,90,129,137,80,64,117,220,205,
+192,89,94,196,207,221,120,1,1,240,0,0,1,0,41,255,240,1,174,5,182,0,9,0,0,
+19,51,17,20,6,35,53,50,54,53,250,180,197,192,110,99,5,182,251,236,217,217,
+159,129,146,0,0,2,0,41,255,240,3,113,5,182,0,9,0,19,0,0,19,51,17,20,6,35,
+53,50,54,53,1,51,17,20,6,35,53,50,54,53,250,180,197,192,110,99,1,194,181,
+196,193,111,97,5,182,251,236,217,217,159,129,146,4,20,251,236,214,220,159,
+129,146,0,0,3,0,41,255,240,5,51,5,182,0,9,0,19,0,29,0,0,19,51,17,20,6,35,
+53,50,54,53,1,51,17,20,6,35,53,50,54,53,1,51,17,20,6,35,53,50,54,53,250,180,
+197,192,110,99,1,194,181,196,193,111,97,1,195,180,197,192,110,99,5,182,251,
+236,217,217,159,129,146,4,20,251,236,214,220,159,129,146,4,20,251,236,217,
+217,159,129,146,0,0,4,0,41,255,240,6,246,5,182,0,9,0,19,0,29,0,39,0,0,19,
+51,17,20,6,35,53,50,54,53,1,51,17,20,6,35,53,50,54,53,1,51,17,20,6,35,53,
+50,54,53,1,51,17,20,6,35,53,50,54,53,250,180,197,192,110,99,1,194,181,196,
+193,111,97,1,195,180,197,192,110,99,1,195,180,196,193,110,99,5,182,251,236,
+217,217,159,129,146,4,20,251,236,214,220,159,129,146,4,20,251,236,217,217,
+159,129,146,4,20,251,236,214,220,159,129,146,0,0,1,0,80,255,236,4,199,4,74,
+0,20,0,0,1,18,33,21,35,32,0,0,3,51,22,22,51,50,54,55,51,6,4,35,34,1,45,199,
+2,211,53,254,203,254,34,254,225,16,150,52,188,161,155,179,16,180,14,254,238,
+228,229,3,25,253,114,159,1,12,2,6,1,76,136,116,132,120,194,218,0,2,0,80,0,
+0,4,209,4,94,0,21,0,33,0,0,37,50,36,55,6,35,34,38,38,53,52,54,54,51,50,18,
+21,16,0,33,33,53,1,20,22,51,50,54,53,52,38,35,34,6,2,16,211,1,13,32,111,155,
+114,184,105,110,184,109,219,240,254,162,254,174,254,47,1,223,133,100,99,137,
+130,106,107,126,160,148,138,96,97,178,108,103,180,102,254,239,243,254,213,
+254,209,160,2,61,102,129,136,95,103,131,129,0,0,1,0,120,0,0,6,247,5,248,0,
+70,0,0,1,50,22,21,20,6,35,34,38,38,39,38,38,35,34,6,21,20,22,22,23,22,22,
+21,20,6,6,7,6,6,21,20,51,33,21,33,34,38,53,52,54,54,55,54,54,53,52,38,39,
+46,2,53,52,54,54,51,50,22,22,23,23,22,22,51,50,54,53,52,38,35,4,234,180,193,
+184,165,87,138,125,122,58,110,57,81,91,32,57,85,98,76,51,100,161,72,73,186,
+5,13,250,243,172,198,57,108,147,75,69,55,55,109,85,44,94,165,98,76,124,108,
+74,67,59,120,74,86,74,86,103,5,248,168,158,151,174,51,98,141,67,66,78,69,
+39,53,42,38,44,111,78,68,96,70,55,25,71,52,151,160,163,146,75,109,72,47,24,
+60,45,42,59,21,42,71,104,73,79,144,84,43,80,86,78,69,68,83,83,83,83,0,0,1,
+0,80,0,0,4,209,5,182,0,23,0,0,1,17,51,17,22,22,21,16,0,33,33,53,33,32,54,
+53,52,38,35,34,6,7,53,54,2,100,180,215,226,254,163,254,173,254,47,1,192,1,
+15,247,163,168,86,182,74,100,4,0,1,182,254,80,16,242,215,254,237,254,230,
+160,184,203,164,163,43,36,161,46,0,1,250,190,254,172,1,182,4,74,0,5,0,0,5,
+17,51,17,33,53,1,2,180,249,8,188,5,6,250,98,152,0,0,2,0,30,253,152,7,166,
+4,74,0,5,0,11,0,0,1,17,51,17,33,53,1,17,51,17,33,53,6,242,180,248,120,4,230,
+180,250,102,254,48,6,26,249,78,152,1,20,5,6,250,98,152,0,1,251,92,254,20,
+4,98,4,74,0,29,0,0,1,19,22,22,51,38,53,17,51,17,20,22,22,23,33,34,38,38,39,
+3,2,4,35,33,53,33,50,54,55,19,2,14,92,52,96,94,26,180,20,46,42,255,0,128,
+145,101,39,148,51,254,250,248,252,92,3,164,161,184,36,215,4,74,254,252,146,
+88,67,140,1,31,254,223,94,100,108,63,63,145,130,252,242,254,244,224,152,164,
+184,4,66,0,0,2,0,80,255,236,7,70,4,74,0,45,0,61,0,0,1,22,51,32,19,51,6,2,
+14,2,4,35,34,36,38,38,53,52,62,2,51,50,30,2,21,20,14,2,7,22,22,51,50,36,54,
+54,55,6,33,34,38,39,5,20,22,23,62,3,53,52,38,35,34,14,2,3,238,51,64,1,114,
+213,158,8,63,116,172,230,254,219,180,168,254,245,186,99,57,101,135,78,94,
+138,90,44,37,60,75,38,42,96,55,174,1,21,210,145,41,223,254,209,48,85,37,253,
+83,76,84,46,76,54,30,97,81,41,68,51,28,3,15,13,1,72,148,254,231,248,208,150,
+83,73,146,218,144,78,137,102,59,61,101,132,71,75,128,107,84,30,9,8,103,184,
+253,150,205,10,9,76,113,172,56,30,77,90,102,56,103,110,34,61,83,0,0,2,0,80,
+255,236,8,67,4,74,0,51,0,65,0,0,33,35,34,39,38,3,14,5,35,34,46,2,53,52,62,
+2,51,50,30,2,21,20,14,2,7,22,51,50,62,4,55,51,22,22,23,22,23,22,51,17,51,
+1,20,22,23,54,54,53,52,38,35,34,14,2,8,67,178,241,172,172,46,21,55,76,101,
+134,172,108,143,210,138,68,58,102,140,81,90,133,89,44,40,63,78,39,30,32,92,
+153,122,93,62,33,2,180,2,39,35,72,122,122,147,180,248,199,72,76,103,115,100,
+81,41,67,50,27,171,171,1,25,78,156,143,123,91,52,95,157,204,108,86,145,104,
+58,61,101,132,71,80,134,110,85,29,3,85,145,192,215,225,105,143,248,108,215,
+116,116,3,178,253,214,102,180,57,59,191,118,103,110,39,66,88,0,0,2,0,80,255,
+236,5,10,4,74,0,37,0,51,0,0,1,20,14,4,35,34,46,2,53,52,62,2,51,50,30,2,21,
+20,14,2,7,22,22,51,50,62,2,53,17,51,1,20,22,23,54,54,53,52,38,35,34,14,2,
+5,10,50,87,116,133,143,69,161,231,149,71,58,102,140,81,90,133,89,44,39,61,
+77,38,21,45,25,81,151,116,69,180,252,0,76,80,100,110,100,81,41,67,50,27,1,
+203,97,146,106,71,42,17,95,157,204,108,86,145,104,58,61,101,132,71,78,133,
+109,84,30,4,3,25,68,119,95,2,148,253,214,100,177,58,60,187,117,103,110,39,
+66,88,0,0,2,0,80,255,236,5,190,4,74,0,36,0,50,0,0,1,20,14,2,35,34,46,4,53,
+52,62,2,51,50,30,2,21,20,14,2,7,22,51,50,62,2,53,17,51,1,20,22,23,54,54,53,
+52,38,35,34,14,2,5,190,79,165,255,175,136,213,159,110,68,30,58,102,140,81,
+90,133,89,44,36,57,73,37,88,107,113,179,124,65,180,251,76,78,88,95,105,100,
+81,41,67,50,27,1,177,107,168,116,62,44,78,106,126,139,71,86,145,104,58,61,
+101,132,71,75,128,107,84,30,17,31,71,117,86,2,150,253,214,108,167,54,60,184,
+114,103,110,39,66,88,0,2,0,80,0,0,7,13,6,20,0,59,0,73,0,0,1,50,54,55,54,54,
+51,50,23,22,21,16,0,33,33,34,46,2,53,52,54,55,17,51,17,54,51,50,30,2,21,20,
+14,2,7,22,22,51,33,32,55,54,53,52,38,35,34,7,6,6,35,34,38,53,51,20,22,1,20,
+22,23,54,54,53,52,38,35,34,14,2,4,116,22,62,42,41,68,29,186,107,108,254,145,
+254,146,254,173,186,251,151,65,48,45,181,51,56,90,133,89,44,33,53,68,35,25,
+51,29,1,85,1,29,131,131,129,133,49,74,39,58,20,137,133,180,54,252,207,80,
+90,93,103,100,81,41,67,50,27,3,193,6,7,7,6,114,114,196,254,225,254,236,93,
+153,195,103,79,135,51,2,235,253,135,14,61,101,132,71,72,123,104,83,31,3,2,
+93,93,211,136,147,13,7,7,137,154,73,64,254,95,109,166,51,60,183,112,103,110,
+39,66,88,0,0,2,0,80,0,0,7,131,4,74,0,47,0,61,0,0,1,20,2,6,4,35,35,34,36,38,
+38,53,52,62,2,51,50,30,2,21,20,14,2,7,22,22,51,51,50,62,4,55,33,34,39,38,
+53,51,20,23,22,51,1,20,22,23,54,54,53,52,38,35,34,14,2,7,131,133,236,254,
+189,190,179,185,254,222,201,106,57,101,135,78,94,138,90,44,31,52,66,35,51,
+117,67,179,89,169,150,127,92,53,2,254,79,243,101,100,180,55,55,150,251,254,
+88,93,85,100,97,81,41,68,51,28,3,90,231,254,186,206,95,67,138,212,144,78,
+137,102,59,61,101,132,71,69,119,100,83,31,9,10,30,61,92,123,156,94,89,88,
+214,136,52,52,254,213,112,164,51,60,175,106,103,110,34,61,83,0,0,2,0,80,255,
+236,7,230,5,55,0,67,0,81,0,0,1,14,5,35,34,46,2,53,52,62,2,51,50,30,2,21,20,
+14,2,7,22,22,51,50,62,4,53,16,39,51,22,22,23,54,54,51,50,30,2,21,20,14,2,
+7,35,62,3,53,52,38,35,34,6,1,20,22,23,54,54,53,52,38,35,34,14,2,5,9,1,26,
+57,92,135,181,118,161,227,144,67,58,102,140,81,90,133,89,44,39,61,77,38,21,
+45,25,93,135,93,57,31,10,98,180,20,49,14,68,170,102,109,154,98,44,39,68,91,
+52,215,59,102,75,43,124,117,100,155,251,206,76,80,100,110,100,81,41,67,50,
+27,3,55,120,218,187,152,108,58,95,157,204,108,86,145,104,58,61,101,132,71,
+78,133,109,84,30,4,3,57,100,136,157,171,86,1,1,240,54,160,107,46,58,66,115,
+155,89,85,193,187,168,60,63,168,186,194,90,129,137,80,254,169,100,177,58,
+60,187,117,103,110,39,66,88,0,3,0,59,253,174,6,12,4,74,0,27,0,42,0,48,0,0,
+1,14,4,4,35,35,53,51,50,36,54,54,55,33,34,46,2,39,51,20,30,2,51,1,62,3,51,
+50,22,23,35,38,35,34,6,7,1,17,51,17,33,53,4,221,20,76,120,169,224,254,229,
+175,98,145,190,1,23,194,116,26,254,211,154,210,131,58,2,180,37,87,143,106,
+253,100,8,54,83,108,63,134,159,18,123,30,160,73,104,14,4,162,180,250,58,3,
+90,149,231,173,120,74,33,151,54,116,181,127,41,92,149,109,73,93,54,20,250,
+84,57,92,65,34,128,120,106,53,53,2,18,4,138,250,222,152,0,0,0,0,0,15,0,186,
+0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,64,0,94,0,3,0,1,4,9,0,2,0,14,0,
+158,0,3,0,1,4,9,0,3,0,102,0,172,0,3,0,1,4,9,0,4,0,64,0,94,0,3,0,1,4,9,0,5,
+0,30,1,18,0,3,0,1,4,9,0,6,0,58,1,48,0,3,0,1,4,9,0,7,0,68,1,106,0,3,0,1,4,
+9,0,8,0,42,1,174,0,3,0,1,4,9,0,9,0,40,1,216,0,3,0,1,4,9,0,10,0,96,2,0,0,3,
+0,1,4,9,0,11,0,62,2,96,0,3,0,1,4,9,0,12,0,60,2,158,0,3,0,1,4,9,0,13,2,150,
+2,218,0,3,0,1,4,9,0,14,0,52,5,112,0,67,0,111,0,112,0,121,0,114,0,105,0,103,
+0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,
+101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,
+0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,
+0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,73,0,110,0,115,0,
+99,0,114,0,105,0,112,0,116,0,105,0,111,0,110,0,97,0,108,0,32,0,80,0,97,0,
+114,0,116,0,104,0,105,0,97,0,110,0,82,0,101,0,103,0,117,0,108,0,97,0,114,
+0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,
+0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,
+110,0,115,0,32,0,73,0,110,0,115,0,99,0,114,0,105,0,112,0,116,0,105,0,111,
+0,110,0,97,0,108,0,32,0,80,0,97,0,114,0,116,0,104,0,105,0,97,0,110,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,
+0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,73,0,110,0,115,0,99,0,114,
+0,105,0,112,0,116,0,105,0,111,0,110,0,97,0,108,0,80,0,97,0,114,0,116,0,104,
+0,105,0,97,0,110,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,
+116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,
+97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,
+32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,
+0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,
+0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,
+0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,
+0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,
+110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,
+101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,
+0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,
+111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,
+0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,
+0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,
+73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,
+0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,
+0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,
+0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,
+120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,
+0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,
+0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,
+0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,
+0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,45,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,
+1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,
+1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,
+1,43,4,110,117,108,108,8,117,110,105,49,48,66,52,48,8,117,110,105,49,48,66,
+52,49,8,117,110,105,49,48,66,52,50,8,117,110,105,49,48,66,52,51,8,117,110,
+105,49,48,66,52,52,8,117,110,105,49,48,66,52,53,8,117,110,105,49,48,66,52,
+54,8,117,110,105,49,48,66,52,55,8,117,110,105,49,48,66,52,56,8,117,110,105,
+49,48,66,52,57,8,117,110,105,49,48,66,52,65,8,117,110,105,49,48,66,52,66,
+8,117,110,105,49,48,66,52,67,8,117,110,105,49,48,66,52,68,8,117,110,105,49,
+48,66,52,69,8,117,110,105,49,48,66,52,70,8,117,110,105,49,48,66,53,48,8,117,
+110,105,49,48,66,53,49,8,117,110,105,49,48,66,53,50,8,117,110,105,49,48,66,
+53,51,8,117,110,105,49,48,66,53,52,8,117,110,105,49,48,66,53,53,8,117,110,
+105,49,48,66,53,56,8,117,110,105,49,48,66,53,57,8,117,110,105,49,48,66,53,
+65,8,117,110,105,49,48,66,53,66,8,117,110,105,49,48,66,53,67,8,117,110,105,
+49,48,66,53,68,8,117,110,105,49,48,66,53,69,8,117,110,105,49,48,66,53,70,
+14,117,110,105,49,48,66,52,68,46,97,108,116,48,49,13,117,110,105,49,48,66,
+52,68,49,48,66,52,68,14,117,110,105,49,48,66,53,49,46,97,108,116,48,49,13,
+117,110,105,49,48,66,52,50,49,48,66,52,53,13,117,110,105,49,48,66,52,55,49,
+48,66,52,53,13,117,110,105,49,48,66,52,57,49,48,66,52,53,13,117,110,105,49,
+48,66,52,68,49,48,66,52,53,13,117,110,105,49,48,66,52,70,49,48,66,52,66,13,
+117,110,105,49,48,66,53,51,49,48,66,52,53,13,117,110,105,49,48,66,53,53,49,
+48,66,52,53,13,117,110,105,49,48,66,52,68,49,48,66,52,51,0,0,1,0,3,0,8,0,
+10,0,14,0,7,255,255,0,15,0,1,0,0,0,12,0,0,0,22,0,0,0,2,0,1,0,0,0,44,0,1,0,
+4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,48,0,70,0,2,68,70,76,84,0,14,112,114,116,
+105,0,26,0,4,0,0,0,0,255,255,0,1,0,1,0,4,0,0,0,0,255,255,0,1,0,0,0,2,107,
+101,114,110,0,14,107,101,114,110,0,14,0,0,0,2,0,0,0,1,0,3,0,8,0,96,0,138,
+0,2,0,1,0,1,0,8,0,1,0,12,0,0,0,5,0,1,0,18,0,1,0,1,0,34,0,10,0,6,0,230,0,230,
+0,9,1,4,1,4,0,10,3,12,3,12,0,13,3,72,3,72,0,15,1,224,1,224,0,19,0,180,0,180,
+0,21,0,0,1,204,0,22,0,220,0,220,0,23,0,160,0,160,0,24,0,200,0,200,0,8,0,1,
+0,1,0,8,0,3,0,0,0,2,0,54,0,20,0,1,0,28,0,1,0,0,0,2,0,1,0,2,0,10,0,13,0,1,
+0,1,0,17,0,2,0,1,0,1,0,8,0,1,0,12,0,0,0,5,0,1,0,18,0,1,0,1,0,36,0,2,0,10,
+2,48,2,48,0,13,2,108,2,108,0,1,0,0,0,10,0,48,0,70,0,2,68,70,76,84,0,14,112,
+114,116,105,0,26,0,4,0,0,0,0,255,255,0,1,0,1,0,4,0,0,0,0,255,255,0,1,0,0,
+0,2,99,99,109,112,0,14,99,99,109,112,0,14,0,0,0,2,0,0,0,1,0,3,0,8,0,140,0,
+182,0,4,0,1,0,1,0,8,0,1,0,106,0,7,0,20,0,30,0,40,0,50,0,76,0,86,0,96,0,1,
+0,4,0,37,0,2,0,9,0,1,0,4,0,38,0,2,0,9,0,1,0,4,0,39,0,2,0,9,0,3,0,8,0,14,0,
+20,0,35,0,2,0,17,0,40,0,2,0,9,0,44,0,2,0,7,0,1,0,4,0,41,0,2,0,15,0,1,0,4,
+0,42,0,2,0,9,0,1,0,4,0,43,0,2,0,9,0,1,0,7,0,6,0,11,0,13,0,17,0,19,0,23,0,
+25,0,6,0,1,0,1,0,8,0,3,0,0,0,1,0,52,0,1,0,18,0,1,0,0,0,2,0,2,0,2,0,4,0,16,
+0,0,0,18,0,25,0,13,0,1,0,1,0,1,0,8,0,2,0,10,0,2,0,34,0,36,0,1,0,2,0,17,0,
+21,0,0,};
+#endif
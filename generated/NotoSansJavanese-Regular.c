@@ -0,0 +1,1672 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansJavanese_Regular_ttf_size = 40468;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansJavanese_Regular_ttf");
+asm(".type fz_font_NotoSansJavanese_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansJavanese_Regular_ttf, 40468");
+asm(".balign 64");
+asm("fz_font_NotoSansJavanese_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansJavanese-Regular.ttf\"");
+#else
+const int fz_font_NotoSansJavanese_Regular_ttf_size = 40468;
+const char fz_font_NotoSansJavanese_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,9,72,8,240,0,0,133,104,0,0,0,156,
+71,80,79,83,175,214,46,216,0,0,134,4,0,0,15,166,71,83,85,66,165,241,49,88,
+0,0,149,172,0,0,8,102,79,83,47,50,128,86,107,224,0,0,1,104,0,0,0,96,99,109,
+97,112,43,166,25,11,0,0,4,176,0,0,0,116,103,97,115,112,0,7,0,7,0,0,133,92,
+0,0,0,12,103,108,121,102,176,112,252,82,0,0,6,156,0,0,111,184,104,101,97,
+100,7,227,194,24,0,0,0,236,0,0,0,54,104,104,101,97,16,137,10,66,0,0,1,36,
+0,0,0,36,104,109,116,120,93,113,144,92,0,0,1,200,0,0,2,230,108,111,99,97,
+237,130,208,100,0,0,5,36,0,0,1,118,109,97,120,112,0,216,1,112,0,0,1,72,0,
+0,0,32,110,97,109,101,142,22,185,184,0,0,118,84,0,0,6,12,112,111,115,116,
+179,21,250,121,0,0,124,96,0,0,8,251,0,1,0,0,0,1,15,92,166,115,232,37,95,15,
+60,245,0,11,8,0,0,0,0,0,205,251,48,188,0,0,0,0,210,208,60,210,244,63,247,
+246,19,186,8,58,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,251,135,0,0,19,196,
+244,63,250,61,19,186,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,185,0,1,0,0,0,186,
+0,216,0,16,0,150,0,11,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,6,215,1,144,
+0,5,0,0,5,154,5,51,0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,174,0,0,2,11,5,2,
+4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,
+8,141,251,135,0,0,8,141,4,121,0,0,0,1,0,0,0,0,5,194,8,58,0,0,0,32,0,2,4,205,
+0,193,0,0,0,0,2,188,0,0,2,188,0,0,0,0,0,0,0,0,255,220,0,0,255,37,4,20,0,106,
+0,0,0,0,0,0,0,0,0,0,0,0,2,118,0,0,12,124,0,100,6,192,0,165,8,214,0,165,8,
+214,0,165,6,192,0,165,5,253,0,170,6,192,0,165,9,25,0,165,5,237,0,110,5,237,
+0,110,6,90,0,160,8,114,0,175,8,114,0,175,7,182,0,160,7,161,0,80,8,138,0,175,
+6,197,0,165,7,34,0,100,11,4,0,160,6,146,0,165,6,146,0,165,10,54,0,165,10,
+245,0,165,6,197,0,165,6,196,0,165,6,231,0,175,7,3,0,165,9,185,0,80,8,94,0,
+160,6,184,0,175,6,47,0,155,6,184,0,175,6,53,0,175,6,2,0,170,7,134,0,165,8,
+221,0,165,8,208,0,80,6,2,0,110,8,52,0,160,5,137,0,88,10,223,0,80,7,222,0,
+175,6,90,0,160,8,224,0,80,7,199,0,160,6,240,0,100,8,126,0,174,0,0,0,0,2,164,
+0,0,2,60,0,0,0,0,0,0,0,0,0,1,1,55,254,182,1,145,253,97,5,132,0,80,5,132,0,
+80,0,0,0,0,0,0,250,226,3,179,252,87,0,0,246,120,6,248,0,0,12,245,0,165,12,
+245,0,165,18,44,0,50,19,196,0,50,19,196,0,50,3,97,0,125,2,135,0,125,3,46,
+0,125,5,67,0,125,2,187,0,165,4,63,0,165,2,187,0,165,2,187,0,16,3,172,0,126,
+4,243,0,125,7,149,0,80,6,192,0,165,10,126,0,165,4,173,0,125,6,1,0,125,5,237,
+0,110,7,212,0,175,7,134,0,165,8,42,0,160,4,252,0,160,6,78,0,165,9,69,0,75,
+0,238,251,69,0,0,247,223,0,0,250,207,0,0,249,13,0,0,251,79,0,0,249,29,7,223,
+0,25,0,0,251,245,0,0,250,244,6,204,0,25,0,0,249,191,0,0,249,86,0,0,248,123,
+3,205,251,210,0,0,250,17,0,0,248,187,0,0,248,249,0,0,248,230,0,0,249,229,
+0,0,248,173,0,0,247,55,0,0,248,134,1,23,251,158,0,0,248,182,6,203,254,182,
+8,39,0,0,0,0,248,39,0,0,247,168,0,0,248,162,1,15,246,120,1,96,254,182,0,0,
+0,0,0,0,248,55,0,0,248,0,0,0,246,6,0,0,246,170,1,66,246,120,0,0,251,234,0,
+0,246,6,0,0,244,185,0,0,249,86,0,0,250,35,0,0,244,63,14,101,0,80,14,101,0,
+80,12,253,0,80,12,253,0,80,11,234,0,80,11,234,0,80,13,109,0,80,13,109,0,80,
+1,66,248,162,1,66,244,63,1,15,244,63,1,15,248,106,6,142,0,25,0,0,249,224,
+0,0,249,224,0,0,247,179,1,172,248,156,0,0,250,249,0,0,249,157,0,0,249,247,
+0,0,245,113,6,199,0,106,6,250,0,106,6,171,0,106,5,96,0,106,5,151,0,106,9,
+6,0,80,9,6,0,80,6,251,0,106,7,200,0,106,8,85,0,120,7,72,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,1,0,0,0,0,1,66,246,120,3,179,252,87,4,123,253,71,0,0,246,
+170,4,23,251,20,252,144,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,104,0,0,0,22,0,
+16,0,3,0,6,0,0,0,13,0,32,0,160,32,13,37,204,169,205,169,217,169,223,254,255,
+255,255,0,0,0,0,0,13,0,32,0,160,32,11,37,204,169,128,169,207,169,222,254,
+255,255,255,0,1,255,245,255,227,255,99,223,249,218,59,86,136,86,135,86,131,
+1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,
+21,0,21,0,34,0,63,0,146,0,202,0,225,0,255,1,67,1,244,2,114,2,238,3,124,3,
+248,4,66,4,189,5,87,5,168,6,33,6,132,6,216,7,72,7,160,7,228,8,68,8,149,8,
+231,9,124,9,221,10,88,10,247,11,109,11,215,12,51,12,115,12,176,13,4,13,81,
+13,189,14,9,14,84,14,148,14,195,15,33,15,132,16,5,16,81,16,163,16,220,17,
+89,17,159,17,215,18,61,18,151,18,223,19,35,19,90,19,150,19,194,19,239,20,
+44,20,77,20,146,20,205,21,47,21,89,21,172,21,243,22,45,22,112,23,85,24,56,
+25,97,26,157,27,219,28,1,28,39,28,86,28,173,28,204,29,3,29,73,29,143,29,191,
+29,235,30,47,30,170,31,55,31,129,31,218,32,43,32,113,32,121,32,203,32,246,
+33,41,33,123,33,178,34,8,34,63,34,156,34,214,35,42,35,150,35,196,35,254,36,
+61,36,137,36,211,37,32,37,111,37,184,37,250,38,86,38,175,38,254,39,95,39,
+190,40,22,40,108,40,209,40,220,41,74,41,163,42,36,42,89,42,193,42,225,43,
+26,43,106,43,200,44,56,44,114,44,196,44,240,45,103,46,105,46,205,47,36,47,
+95,47,107,47,119,47,131,47,143,47,155,47,167,47,179,47,191,48,7,48,87,48,
+189,49,41,49,132,49,253,50,153,51,37,51,146,51,215,51,224,51,233,52,109,52,
+121,52,133,52,145,52,157,52,169,52,181,52,193,52,205,52,217,52,230,52,241,
+53,48,53,126,53,189,54,11,54,67,54,149,54,220,55,36,55,87,55,154,55,220,0,
+0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,255,220,0,183,0,36,6,131,
+0,3,0,0,19,17,35,17,36,72,6,131,250,52,5,204,0,1,255,37,0,183,0,219,6,131,
+0,14,0,0,55,35,17,7,39,55,39,55,23,55,23,7,23,7,39,36,72,134,49,171,171,49,
+170,170,49,171,171,49,134,183,4,161,136,49,169,168,49,171,171,49,168,169,
+49,136,0,8,0,106,0,222,3,170,4,29,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,
+0,0,0,21,20,35,34,53,52,51,6,21,20,35,34,53,52,51,32,21,20,35,34,53,52,51,
+22,21,20,35,34,53,52,51,32,21,20,35,34,53,52,51,22,21,20,35,34,53,52,51,32,
+21,20,35,34,53,52,51,6,21,20,35,34,53,52,51,2,69,60,58,58,205,59,59,59,2,
+77,59,59,59,151,60,59,59,253,114,59,59,59,151,59,59,59,2,77,59,59,59,206,
+60,58,58,4,29,58,59,59,58,101,59,59,59,59,59,59,59,59,255,59,59,59,59,59,
+59,59,59,255,59,59,59,59,59,59,59,59,102,59,59,59,59,0,2,0,0,5,38,4,146,7,
+29,0,24,0,35,0,0,1,20,4,33,32,36,53,54,51,50,23,20,23,54,54,51,50,22,21,7,
+54,53,54,51,50,5,22,22,51,50,53,52,38,35,34,6,4,146,254,234,254,211,254,217,
+254,216,30,63,59,18,47,43,249,134,135,196,3,79,26,37,43,253,9,25,130,74,232,
+120,74,95,170,6,170,196,192,186,172,14,14,80,49,113,161,158,112,37,62,130,
+10,253,13,16,107,62,105,156,0,1,0,0,4,158,1,141,6,20,0,11,0,0,0,6,35,34,38,
+53,52,54,51,50,22,21,1,141,115,83,83,116,115,84,83,115,5,12,110,109,78,77,
+110,110,77,0,0,1,0,0,4,159,3,193,7,11,0,13,0,0,1,22,21,20,7,35,32,1,38,38,
+39,54,36,36,3,186,7,7,14,254,68,254,97,29,33,19,200,1,30,1,51,7,11,24,43,
+40,23,254,22,17,33,31,222,213,104,0,0,2,0,0,251,162,2,118,4,94,0,33,0,43,
+0,0,1,38,38,53,52,54,51,50,22,21,20,2,7,22,18,21,16,1,38,38,39,54,18,53,52,
+38,35,35,38,53,52,55,54,54,55,54,53,52,38,35,34,6,21,20,1,37,142,151,143,
+124,127,149,182,138,199,208,254,218,24,55,6,124,140,246,226,10,8,8,65,137,
+104,34,68,60,57,70,1,244,23,167,128,136,164,169,140,152,254,119,138,50,254,
+223,236,254,114,254,241,7,55,23,105,1,45,163,223,241,46,38,38,29,41,181,248,
+108,82,85,102,95,78,184,0,3,0,100,255,236,12,65,4,94,0,68,0,120,0,129,0,0,
+1,20,6,35,34,0,35,34,21,20,22,23,22,21,20,7,34,38,53,52,54,51,50,22,22,51,
+50,54,53,53,38,38,53,52,54,55,22,21,21,7,6,6,21,20,22,51,39,53,52,54,51,50,
+22,21,21,50,22,23,6,35,34,39,38,38,39,17,35,17,33,37,52,54,51,50,22,21,20,
+7,22,21,20,6,35,34,0,53,16,0,33,22,21,20,7,32,4,21,20,22,51,50,54,53,52,37,
+35,38,53,52,55,51,36,53,52,38,35,34,6,7,6,35,34,5,33,53,52,38,35,34,6,21,
+8,103,136,115,119,254,254,123,105,41,26,8,8,75,106,135,102,91,151,159,79,
+75,64,193,159,123,157,28,1,92,74,97,113,1,202,176,159,164,175,201,25,34,23,
+24,34,16,140,130,170,254,97,249,102,160,123,117,149,117,169,239,180,236,254,
+205,1,153,1,130,10,10,254,181,254,175,235,182,109,135,254,176,19,10,10,17,
+1,34,66,50,58,81,4,14,43,37,6,127,1,160,90,104,118,104,1,127,181,222,1,36,
+88,43,45,2,34,25,25,30,116,79,88,114,72,192,143,178,55,6,92,102,92,124,46,
+38,44,8,9,23,57,51,59,61,31,22,218,246,202,201,113,205,222,8,8,153,148,10,
+254,26,1,232,153,113,142,137,110,103,68,55,134,128,181,1,42,231,1,32,1,65,
+26,37,43,14,237,234,184,243,96,68,133,4,14,42,36,26,4,137,54,62,76,59,10,
+29,105,142,118,162,175,0,0,2,0,165,254,94,6,32,4,94,0,54,0,91,0,0,1,6,7,21,
+20,22,51,50,54,55,55,51,50,23,6,6,35,34,17,53,6,35,34,38,53,17,51,17,20,22,
+51,50,55,53,52,38,35,34,6,7,7,35,34,39,54,54,51,50,17,21,54,55,54,51,50,3,
+54,51,32,17,17,35,17,52,38,35,34,6,7,21,6,35,34,39,53,38,38,35,34,6,7,6,35,
+34,39,39,53,52,18,51,50,22,4,11,11,160,56,63,30,51,9,9,8,43,38,19,122,81,
+198,69,89,220,208,170,141,159,67,49,56,63,30,51,9,9,8,43,38,19,122,81,198,
+52,4,27,29,28,20,84,204,1,40,170,67,86,100,106,3,29,24,21,30,3,98,95,94,98,
+4,29,24,21,30,1,160,140,81,128,1,43,187,80,97,105,108,57,68,1,28,106,132,
+1,93,64,15,203,200,2,203,253,61,130,130,10,85,105,108,57,68,1,28,106,132,
+254,163,42,41,70,10,2,105,192,254,109,253,53,2,195,130,130,139,187,11,8,6,
+4,186,149,144,191,8,6,15,16,186,1,15,98,0,3,0,165,253,136,8,54,4,94,0,49,
+0,68,0,88,0,0,1,6,35,34,39,53,38,38,35,34,6,7,6,35,34,39,52,54,51,50,22,23,
+54,51,50,23,51,54,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,
+34,6,7,3,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,1,6,35,34,39,
+53,52,46,2,53,54,51,50,23,20,30,2,21,4,12,29,24,21,30,3,98,95,94,98,4,29,
+24,21,30,154,145,81,128,40,84,204,205,61,7,42,136,83,1,40,170,64,86,110,101,
+168,77,81,100,106,3,1,6,232,204,220,208,170,141,159,130,150,5,27,29,28,3,
+171,52,32,33,52,78,195,71,27,29,28,31,236,103,59,2,118,8,6,4,186,149,144,
+191,8,6,233,255,98,94,192,184,94,90,254,109,253,53,2,195,130,130,165,196,
+253,162,2,195,135,125,139,187,254,170,155,164,203,200,2,203,253,61,130,130,
+82,86,10,252,99,16,16,28,130,131,42,107,108,10,10,124,22,73,141,150,0,0,2,
+0,165,254,94,8,54,4,94,0,49,0,104,0,0,1,6,35,34,39,53,38,38,35,34,6,7,6,35,
+34,39,52,54,51,50,22,23,54,51,50,23,51,54,54,51,32,17,17,35,17,52,38,35,34,
+6,21,17,35,17,52,38,35,34,6,7,3,6,7,21,20,22,51,50,54,55,55,51,50,23,6,6,
+35,34,17,53,6,35,34,38,53,17,51,17,20,22,51,50,55,53,52,38,35,34,6,7,7,35,
+34,39,54,54,51,50,17,21,54,55,54,51,50,4,12,29,24,21,30,3,98,95,94,98,4,29,
+24,21,30,154,145,81,128,40,84,204,205,61,7,42,136,83,1,40,170,64,86,110,101,
+168,77,81,100,106,3,1,11,160,56,63,30,51,9,9,8,43,38,19,122,81,198,69,89,
+220,208,170,141,159,67,49,56,63,30,51,9,9,8,43,38,19,122,81,198,52,4,27,29,
+28,2,118,8,6,4,186,149,144,191,8,6,233,255,98,94,192,184,94,90,254,109,253,
+53,2,195,130,130,165,196,253,162,2,195,135,125,139,187,254,170,187,80,97,
+105,108,57,68,1,28,106,132,1,93,64,15,203,200,2,203,253,61,130,130,10,85,
+105,108,57,68,1,28,106,132,254,163,42,41,70,10,0,2,0,165,251,133,6,207,4,
+94,0,67,0,86,0,0,1,54,51,32,17,17,34,4,0,21,20,22,51,50,0,54,51,50,22,23,
+22,21,20,7,38,38,35,34,14,2,35,34,53,52,18,0,55,17,52,38,35,34,6,7,21,6,35,
+34,39,53,38,38,35,34,6,7,6,35,34,39,39,53,52,18,51,50,22,19,6,6,35,34,38,
+53,17,51,17,20,22,51,50,54,55,54,51,50,3,216,84,204,1,40,114,254,16,254,203,
+33,53,106,1,50,229,119,60,141,39,8,8,28,122,69,114,210,208,168,83,192,236,
+1,162,203,67,86,100,106,3,29,24,21,30,3,98,95,94,98,4,29,24,21,30,1,160,140,
+81,128,91,6,232,204,220,208,170,141,159,130,150,5,27,29,28,3,158,192,254,
+109,252,140,251,254,183,165,48,52,1,8,94,18,11,34,25,25,30,12,16,100,184,
+92,227,178,1,114,1,40,53,2,218,130,130,139,187,11,8,6,4,186,149,144,191,8,
+6,15,16,186,1,15,98,253,47,155,164,203,200,2,203,253,61,130,130,82,86,10,
+0,2,0,170,253,136,5,98,4,94,0,32,0,52,0,0,19,51,17,20,22,51,50,54,54,53,53,
+52,54,51,50,22,21,17,35,17,52,38,35,34,6,21,7,20,6,35,34,38,53,1,6,35,34,
+39,53,52,46,2,53,54,51,50,23,20,30,2,21,170,170,64,105,101,92,37,180,161,
+147,151,170,79,86,99,101,1,185,191,157,139,3,28,52,32,33,52,78,195,71,27,
+29,28,31,236,103,59,4,74,253,61,127,133,52,113,138,220,217,247,204,199,253,
+53,2,195,146,114,154,184,224,223,202,197,206,252,25,16,16,28,130,131,42,107,
+108,10,10,124,22,73,141,150,0,3,0,165,251,160,7,129,4,94,0,55,0,65,0,84,0,
+0,1,54,51,32,17,17,51,54,54,53,54,51,50,23,20,6,35,35,17,20,6,33,32,0,53,
+52,36,33,17,52,38,35,34,6,7,21,6,35,34,39,53,38,38,35,34,6,7,6,35,34,39,52,
+18,51,50,22,1,32,4,21,20,22,51,50,54,53,1,6,6,35,34,38,53,17,51,17,20,22,
+51,50,54,55,54,51,50,3,216,84,204,1,45,126,47,61,30,25,25,34,131,100,117,
+231,254,245,254,253,254,218,1,180,1,189,72,86,100,106,3,29,24,21,30,3,98,
+95,94,98,4,29,24,21,30,153,146,81,128,1,203,254,151,254,165,209,197,178,124,
+254,144,6,232,204,220,208,170,141,159,130,150,5,27,29,28,3,158,192,254,109,
+252,179,2,51,41,8,8,91,116,254,62,219,208,1,23,248,235,229,3,68,129,131,139,
+187,11,8,6,4,186,149,144,191,8,6,216,1,16,98,251,17,147,183,212,221,138,187,
+3,212,155,164,203,200,2,203,253,61,130,130,82,86,10,0,0,3,0,165,251,160,8,
+126,4,94,0,80,0,90,0,109,0,0,1,54,51,50,23,22,22,51,50,54,53,52,38,35,38,
+53,52,55,50,54,53,52,38,35,17,20,6,33,32,0,53,52,36,33,17,52,38,35,34,6,7,
+21,6,35,34,39,53,38,38,35,34,6,7,6,35,34,39,52,18,51,50,22,23,54,51,32,17,
+17,4,21,20,6,7,22,22,21,20,6,35,34,38,3,32,4,21,20,22,51,50,54,53,1,6,6,35,
+34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,6,76,26,37,43,14,5,71,49,54,
+89,135,108,10,10,76,119,178,201,231,254,245,254,253,254,218,1,165,1,204,72,
+86,100,106,3,29,24,21,30,3,98,95,94,98,4,29,24,21,30,153,146,81,128,40,84,
+204,1,45,2,37,59,58,90,79,193,115,107,144,212,254,135,254,181,209,197,178,
+124,254,144,6,232,204,220,208,170,141,159,130,150,5,27,29,28,252,238,10,10,
+58,69,89,57,65,77,14,42,36,26,82,53,65,66,254,60,219,208,1,23,248,230,235,
+3,67,129,131,139,187,11,8,6,4,186,149,144,191,8,6,216,1,16,98,94,192,254,
+109,252,181,12,231,59,84,34,29,96,68,115,174,137,2,138,159,171,212,221,138,
+187,3,212,155,164,203,200,2,203,253,61,130,130,82,86,10,0,2,0,110,255,236,
+5,227,4,94,0,43,0,55,0,0,0,6,35,34,38,39,6,21,20,22,51,50,18,51,50,22,21,
+20,6,35,38,53,52,55,54,54,53,52,38,35,34,6,6,35,34,36,2,53,52,0,51,50,22,
+21,5,22,22,51,50,54,53,52,38,35,34,6,3,211,185,161,84,159,56,37,235,168,148,
+248,148,113,150,106,75,8,8,26,41,77,63,112,193,168,89,150,254,240,159,1,59,
+237,143,174,253,174,53,150,68,101,106,123,76,78,147,3,10,117,34,24,97,99,
+175,235,1,8,116,88,78,115,30,25,25,34,2,48,34,44,50,218,74,154,1,9,154,233,
+1,76,133,104,60,22,23,49,45,52,81,95,0,3,0,110,255,236,5,227,7,108,0,43,0,
+72,0,84,0,0,0,6,35,34,38,39,6,21,20,22,51,50,18,51,50,22,21,20,6,35,38,53,
+52,55,54,54,53,52,38,35,34,6,6,35,34,36,2,53,52,0,51,50,22,21,1,38,38,53,
+52,55,22,21,21,7,6,6,21,20,4,22,21,20,6,7,38,53,53,55,54,54,53,52,39,3,22,
+22,51,50,54,53,52,38,35,34,6,3,211,185,161,84,159,56,37,235,168,148,248,148,
+113,150,106,75,8,8,26,41,77,63,112,193,168,89,150,254,240,159,1,59,237,143,
+174,254,99,112,86,238,28,1,66,66,1,36,110,126,112,28,1,68,57,124,254,53,150,
+68,101,106,123,76,78,147,3,10,117,34,24,97,99,175,235,1,8,116,88,78,115,30,
+25,25,34,2,48,34,44,50,218,74,154,1,9,154,233,1,76,133,104,2,88,18,89,76,
+187,49,38,43,8,9,8,66,42,79,28,86,83,95,119,22,38,43,8,9,12,57,32,77,20,253,
+119,22,23,49,45,52,81,95,0,1,0,160,251,133,6,105,4,94,0,69,0,0,5,34,4,0,21,
+20,22,51,50,0,54,51,50,22,23,22,21,20,7,38,38,35,34,14,2,35,34,53,52,18,0,
+55,17,52,38,38,35,34,7,22,21,21,20,6,35,34,38,53,17,51,17,20,22,51,50,54,
+53,53,52,38,35,38,53,52,55,36,51,32,17,5,186,114,254,16,254,203,33,53,106,
+1,50,229,119,60,141,39,8,8,28,122,69,107,216,209,168,83,192,234,1,156,211,
+45,109,116,77,144,115,201,198,190,171,170,100,137,142,96,114,97,25,23,1,117,
+165,1,80,169,251,254,183,165,48,52,1,8,94,18,11,34,25,25,30,12,16,99,184,
+93,227,179,1,111,1,38,56,2,219,132,104,44,19,110,231,222,222,203,195,208,
+2,203,253,61,127,133,115,188,189,149,166,32,37,34,23,54,254,109,0,2,0,175,
+255,236,7,210,4,94,0,49,0,60,0,0,51,17,51,17,33,17,52,54,51,50,22,23,51,54,
+54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,51,50,
+22,21,20,6,35,34,38,53,53,33,17,37,20,22,51,50,54,53,52,38,35,35,175,170,
+1,61,220,179,119,161,39,8,47,149,91,1,71,170,86,97,121,111,170,119,104,132,
+116,73,78,109,110,77,77,110,254,195,1,175,43,30,30,43,43,30,73,4,74,253,43,
+1,25,209,255,97,87,94,90,254,109,253,53,2,195,132,128,166,195,253,162,2,195,
+123,137,165,173,255,0,113,82,83,115,115,83,84,254,250,178,36,52,52,36,36,
+48,0,3,0,175,253,136,7,210,4,94,0,19,0,69,0,80,0,0,1,6,35,34,39,53,52,46,
+2,53,54,51,50,23,20,30,2,21,1,17,51,17,33,17,52,54,51,50,22,23,51,54,54,51,
+32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,51,50,22,21,
+20,6,35,34,38,53,53,33,17,37,20,22,51,50,54,53,52,38,35,35,5,26,52,32,33,
+52,78,195,71,27,29,28,31,236,103,59,251,149,170,1,61,220,179,119,161,39,8,
+47,149,91,1,71,170,86,97,121,111,170,119,104,132,116,73,78,109,110,77,77,
+110,254,195,1,175,43,30,30,43,43,30,73,253,152,16,16,28,130,131,42,107,108,
+10,10,124,22,73,141,150,2,68,4,74,253,43,1,25,209,255,97,87,94,90,254,109,
+253,53,2,195,132,128,166,195,253,162,2,195,123,137,165,173,255,0,113,82,83,
+115,115,83,84,254,250,178,36,52,52,36,36,48,0,2,0,160,255,236,7,122,4,94,
+0,52,0,63,0,0,1,20,6,35,34,38,53,17,52,38,35,34,6,21,21,51,50,22,21,20,6,
+35,34,38,53,53,33,17,35,17,51,17,33,17,52,54,51,50,22,21,17,20,22,51,50,54,
+54,53,17,54,51,50,23,1,20,22,51,50,54,53,52,38,35,35,7,122,182,180,165,143,
+129,106,132,116,73,77,110,110,77,77,110,254,195,170,170,1,61,220,179,164,
+204,68,106,86,90,35,27,29,28,31,251,127,43,30,30,43,43,30,73,1,149,219,206,
+189,214,1,68,123,137,165,173,252,115,84,83,115,115,83,84,254,250,4,74,253,
+47,1,21,209,255,219,184,254,183,133,122,54,107,142,1,83,10,10,253,173,36,
+46,46,36,36,48,0,1,0,80,0,0,7,1,4,94,0,47,0,0,19,52,54,51,50,23,51,54,54,
+51,50,23,51,54,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,
+6,21,17,35,17,52,38,35,34,6,7,6,35,34,80,176,164,202,65,8,42,136,83,207,63,
+5,42,136,83,1,45,170,69,86,109,102,170,69,86,110,101,170,72,86,102,104,3,
+29,24,21,2,116,237,253,184,94,90,184,94,90,254,109,253,53,2,195,129,131,161,
+183,253,145,2,195,129,131,165,196,253,162,2,195,129,131,141,196,8,0,0,1,0,
+175,255,235,7,234,4,94,0,68,0,0,1,38,53,52,55,54,36,51,32,17,17,35,17,52,
+38,38,35,34,7,22,17,20,6,35,34,38,39,6,35,34,38,53,17,52,38,35,34,6,21,17,
+23,35,39,53,39,53,52,54,51,32,17,17,20,22,51,50,54,55,53,51,21,22,51,50,54,
+53,52,38,38,4,131,22,22,97,1,92,90,1,80,170,45,109,116,67,100,224,170,157,
+47,77,55,81,128,152,135,73,87,111,91,1,103,1,1,182,161,1,37,82,77,35,51,24,
+115,59,55,100,116,101,192,3,170,28,34,35,29,18,36,254,109,253,53,2,195,132,
+104,44,12,142,254,154,246,250,33,52,84,198,205,1,68,146,114,166,171,254,105,
+223,127,103,223,201,216,248,254,109,254,188,134,151,31,21,219,219,53,215,
+189,125,190,114,0,2,0,165,255,236,6,37,4,94,0,36,0,55,0,0,1,54,51,32,17,17,
+35,17,52,38,35,34,6,7,21,6,35,34,39,53,38,38,35,34,6,7,6,35,34,39,39,53,52,
+18,51,50,22,19,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,3,216,
+84,204,1,45,170,72,86,100,106,3,29,24,21,30,3,98,95,94,98,4,29,24,21,30,1,
+160,140,81,128,91,6,232,204,220,208,170,141,159,130,150,5,27,29,28,3,158,
+192,254,109,253,53,2,195,129,131,139,187,11,8,6,4,186,149,144,191,8,6,15,
+16,186,1,15,98,253,47,155,164,203,200,2,203,253,61,130,130,82,86,10,0,2,0,
+100,255,236,6,130,4,94,0,49,0,58,0,0,37,6,6,35,34,38,53,52,54,51,51,23,17,
+51,17,22,22,51,50,54,53,53,52,38,35,38,53,52,55,36,51,32,17,17,35,17,52,38,
+38,35,34,7,22,21,21,20,6,35,34,38,39,34,6,21,20,51,50,54,53,2,3,24,123,78,
+79,111,124,115,11,10,170,53,156,99,89,78,114,97,25,23,1,117,165,1,80,170,
+45,109,116,77,144,115,157,139,120,155,229,56,50,73,41,32,196,97,119,113,85,
+96,99,1,2,214,252,250,32,179,139,182,189,149,166,32,37,34,23,54,254,109,253,
+53,2,195,132,104,44,19,110,231,244,188,215,187,95,41,43,65,71,76,0,3,0,160,
+255,236,10,100,4,94,0,94,0,105,0,114,0,0,37,6,35,34,38,53,53,52,38,35,34,
+6,21,17,20,6,35,34,38,53,17,52,38,35,34,21,17,20,6,35,34,38,53,17,52,54,51,
+22,21,20,7,34,6,21,17,20,22,51,50,54,53,17,52,54,51,50,22,21,17,20,22,51,
+50,54,53,53,52,54,51,50,22,21,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,
+7,22,22,21,20,6,35,34,39,54,54,53,52,38,35,34,6,21,20,23,6,7,22,51,50,54,
+53,52,8,243,102,124,162,143,61,67,60,63,153,123,135,133,68,65,124,150,125,
+129,144,169,159,11,11,84,74,69,60,64,75,140,124,131,142,56,68,64,71,138,130,
+127,141,54,92,67,48,56,135,114,83,130,27,49,41,108,98,90,25,63,74,45,32,40,
+55,219,43,63,37,39,28,38,29,49,192,197,209,103,101,101,90,254,243,155,187,
+199,190,1,42,171,129,242,254,117,167,183,179,170,1,132,196,205,53,22,28,46,
+125,123,254,99,90,87,78,66,1,186,189,212,234,213,254,190,118,100,90,80,192,
+214,226,211,195,158,134,104,13,108,158,156,177,142,101,80,66,37,96,42,95,
+104,235,57,142,69,67,63,119,96,106,39,74,62,27,46,36,50,0,0,2,0,165,255,237,
+5,242,4,94,0,60,0,67,0,0,1,20,6,6,35,34,38,53,17,51,17,20,22,51,50,54,51,
+38,38,53,53,35,53,54,54,55,55,54,55,54,54,51,33,22,21,20,7,6,4,7,33,50,22,
+21,21,35,53,52,38,35,33,21,20,22,51,50,54,55,54,51,50,3,34,6,7,54,54,55,4,
+102,97,217,170,243,234,170,165,173,8,20,8,35,42,154,14,27,18,40,23,32,2,173,
+169,1,249,11,11,36,254,90,230,1,47,200,226,170,148,147,254,231,64,52,60,46,
+13,26,30,29,120,111,86,2,152,251,103,1,43,118,126,74,190,212,2,203,253,61,
+142,121,4,62,148,101,53,114,2,10,8,17,10,12,220,229,46,28,22,53,42,218,99,
+214,185,211,217,142,137,28,145,183,71,88,10,2,148,121,133,66,126,62,0,3,0,
+165,253,136,5,242,4,94,0,19,0,80,0,87,0,0,1,6,35,34,39,53,52,46,2,53,54,51,
+50,23,20,30,2,21,19,20,6,6,35,34,38,53,17,51,17,20,22,51,50,54,51,38,38,53,
+53,35,53,54,54,55,55,54,55,54,54,51,33,22,21,20,7,6,4,7,33,50,22,21,21,35,
+53,52,38,35,33,21,20,22,51,50,54,55,54,51,50,3,34,6,7,54,54,55,3,238,51,33,
+34,51,74,203,67,26,30,29,30,229,107,62,120,97,217,170,243,234,170,165,173,
+8,20,8,35,42,154,14,27,18,40,23,32,2,173,169,1,249,11,11,36,254,90,230,1,
+47,200,226,170,148,147,254,231,64,52,60,46,13,26,30,29,120,111,86,2,152,251,
+103,253,152,16,16,28,125,135,44,111,103,10,10,122,24,67,151,146,3,111,118,
+126,74,190,212,2,203,253,61,142,121,4,62,148,101,53,114,2,10,8,17,10,12,220,
+229,46,28,22,53,42,218,99,214,185,211,217,142,137,28,145,183,71,88,10,2,148,
+121,133,66,126,62,0,3,0,165,251,162,9,160,6,169,0,84,0,103,0,112,0,0,1,36,
+17,52,54,51,50,18,21,21,22,4,21,20,6,7,35,38,53,52,55,54,54,53,52,38,39,17,
+20,6,33,32,17,52,62,3,53,17,52,38,35,34,6,7,21,6,35,34,39,53,38,38,35,34,
+6,7,6,35,34,39,52,18,51,50,22,23,54,51,32,17,17,20,6,4,6,21,20,22,51,50,54,
+54,53,1,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,1,38,2,35,34,
+6,21,20,22,7,35,253,217,160,118,173,214,247,1,20,232,185,27,8,8,115,151,182,
+163,237,254,212,253,160,95,180,243,89,72,86,100,106,3,29,24,21,30,3,98,95,
+94,98,4,29,24,21,30,153,146,81,128,40,84,204,1,45,158,254,170,162,216,176,
+227,212,85,252,232,6,232,204,220,208,170,141,159,130,150,5,27,29,28,3,43,
+15,149,116,57,73,195,3,219,120,1,62,119,161,254,147,233,20,54,220,131,113,
+148,3,34,24,22,34,4,103,67,76,139,39,249,175,246,215,1,147,120,171,109,47,
+132,116,2,215,129,131,139,187,11,8,6,4,186,149,144,191,8,6,216,1,16,98,94,
+192,254,109,253,33,176,185,55,157,124,139,147,67,126,161,3,180,155,164,203,
+200,2,203,253,61,130,130,82,86,10,3,40,206,1,10,71,74,119,159,0,2,0,165,255,
+236,10,85,4,94,0,65,0,84,0,0,1,52,38,35,34,6,21,17,35,17,52,38,35,34,6,7,
+6,35,34,39,38,38,35,34,6,7,6,35,34,39,39,53,52,18,51,50,22,23,54,51,50,23,
+51,54,54,51,50,22,23,51,54,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,1,
+6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,7,147,69,86,110,101,170,
+72,86,100,106,3,29,24,21,30,3,98,95,94,98,4,29,24,21,30,1,160,140,81,128,
+40,84,204,205,63,7,42,136,83,89,142,36,8,42,136,83,1,45,170,69,86,109,102,
+170,252,120,6,232,204,220,208,170,141,159,130,150,5,27,29,28,2,195,129,131,
+165,196,253,162,2,195,129,131,139,198,8,6,190,149,144,191,8,6,15,16,186,1,
+15,98,94,192,184,94,90,89,95,94,90,254,109,253,53,2,195,129,131,161,183,253,
+145,1,43,155,164,203,200,2,203,253,61,130,130,82,86,10,0,2,0,165,254,203,
+6,37,4,94,0,36,0,73,0,0,1,54,51,32,17,17,35,17,52,38,35,34,6,7,21,6,35,34,
+39,53,38,38,35,34,6,7,6,35,34,39,39,53,52,18,51,50,22,1,7,32,17,17,51,17,
+20,22,51,55,54,54,51,50,23,6,6,7,6,21,20,22,51,50,54,55,54,51,50,23,6,6,35,
+34,38,53,3,216,84,204,1,45,170,72,86,100,106,3,29,24,21,30,3,98,95,94,98,
+4,29,24,21,30,1,160,140,81,128,254,236,79,254,88,170,138,158,81,48,138,78,
+22,37,6,127,112,20,47,41,43,45,2,34,25,25,30,4,112,79,88,114,3,158,192,254,
+109,253,53,2,195,129,131,139,187,11,8,6,4,186,149,144,191,8,6,15,16,186,1,
+15,98,251,243,3,1,147,2,203,253,61,127,132,3,90,85,11,114,149,32,47,46,51,
+55,41,26,8,8,75,106,135,102,0,3,0,165,255,236,6,37,4,94,0,33,0,53,0,63,0,
+0,1,54,51,32,17,17,35,17,52,38,35,34,6,7,6,35,34,39,52,38,35,34,6,7,6,35,
+34,39,39,53,52,18,51,50,1,17,51,17,20,22,51,38,53,52,54,51,50,22,21,20,6,
+35,32,38,5,54,53,52,38,35,34,6,21,20,3,216,86,203,1,44,170,75,89,101,98,4,
+29,24,21,30,99,99,94,97,3,29,24,21,30,1,157,142,168,253,31,170,204,183,36,
+102,75,84,123,211,225,254,251,208,2,179,100,54,37,32,36,3,158,192,254,109,
+253,53,2,195,137,123,148,189,8,6,178,161,149,186,8,6,15,16,182,1,19,253,33,
+2,203,253,45,127,137,52,62,77,107,123,85,103,118,196,53,20,62,34,55,39,29,
+58,0,1,0,175,255,235,6,71,4,94,0,45,0,0,33,17,52,38,35,34,6,21,21,20,2,35,
+34,38,39,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,53,51,21,22,51,50,54,
+53,53,16,54,51,50,22,21,17,5,157,63,62,73,62,167,160,45,76,58,41,100,68,153,
+134,170,85,74,35,51,24,115,59,55,99,117,145,145,124,134,2,195,136,124,129,
+208,155,240,255,0,31,54,42,42,197,206,2,203,253,61,138,147,31,21,219,219,
+53,216,188,145,1,0,208,202,201,253,53,0,1,0,165,255,236,6,139,4,95,0,40,0,
+0,1,22,18,21,20,2,35,34,38,38,35,34,6,6,35,34,38,53,17,51,17,20,22,51,50,
+54,54,51,50,30,2,51,50,54,53,52,2,39,54,54,5,135,115,145,234,202,93,126,98,
+44,42,107,147,106,173,138,170,70,89,71,113,125,78,39,73,95,94,68,142,169,
+127,99,19,37,4,95,90,254,188,181,251,254,219,91,167,170,88,177,226,2,203,
+253,61,155,140,72,211,48,159,76,235,184,154,1,33,80,32,35,0,1,0,80,0,0,9,
+25,4,94,0,60,0,0,1,54,51,50,22,21,17,35,17,52,38,35,34,17,17,35,17,52,38,
+35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,7,6,35,34,39,
+52,54,51,50,23,51,54,54,51,50,23,51,54,51,50,23,6,225,89,181,147,151,170,
+79,86,201,170,69,86,109,102,170,69,86,110,101,170,72,86,102,104,3,29,24,21,
+30,176,164,202,65,8,42,136,83,207,63,8,82,176,194,67,3,189,161,204,199,253,
+53,2,195,146,114,254,215,253,98,2,195,129,131,161,183,253,145,2,195,129,131,
+165,196,253,162,2,195,129,131,141,196,8,6,237,253,184,94,90,184,184,161,0,
+0,1,0,160,255,236,7,191,4,94,0,54,0,0,1,52,38,35,34,7,22,22,21,21,20,6,35,
+34,38,53,17,51,17,20,22,51,50,54,53,53,52,38,38,39,38,53,52,36,51,50,22,23,
+51,54,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,4,204,148,120,240,40,125,
+111,208,187,190,171,170,100,137,128,104,44,68,100,12,1,4,179,113,183,45,8,
+47,140,106,1,71,170,86,97,121,111,170,2,195,120,148,246,17,150,159,82,161,
+180,195,208,2,203,253,61,127,133,81,92,55,110,100,38,2,48,48,170,243,109,
+92,94,107,254,109,253,53,2,195,132,128,164,180,253,145,0,1,0,175,254,94,6,
+24,4,94,0,77,0,0,1,38,53,52,55,54,36,51,32,17,17,35,17,52,38,38,35,34,7,22,
+17,20,6,7,21,20,22,51,50,54,55,55,51,50,23,6,6,35,34,17,53,6,35,34,38,38,
+53,17,51,17,20,22,51,50,55,53,52,38,35,34,6,7,7,35,34,39,54,54,51,50,17,21,
+54,54,53,52,38,38,2,177,22,22,97,1,92,90,1,80,170,45,109,116,67,100,224,150,
+163,56,63,30,51,9,9,8,43,38,19,122,81,198,48,53,185,201,89,170,125,188,38,
+55,56,63,30,51,9,9,8,43,38,19,122,81,198,101,94,101,192,3,170,28,34,35,29,
+18,36,254,109,253,53,2,195,132,104,44,12,142,254,154,217,220,37,66,105,108,
+57,68,1,28,106,132,1,93,53,4,74,165,164,2,203,253,61,156,129,5,115,105,108,
+57,68,1,28,106,132,254,163,94,38,175,160,125,190,114,0,2,0,155,255,236,5,
+143,4,94,0,41,0,53,0,0,1,54,51,50,22,21,20,6,35,34,38,39,6,35,34,38,53,17,
+51,17,20,22,51,50,55,55,17,52,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,
+20,22,51,50,54,53,52,38,35,34,7,3,14,41,32,78,109,110,77,55,90,23,99,160,
+134,139,170,47,82,88,81,45,220,179,173,183,170,119,104,132,116,43,30,30,43,
+43,30,35,38,1,105,12,113,82,83,115,60,49,109,205,198,2,203,253,61,124,136,
+95,52,1,120,209,255,201,183,253,34,2,195,123,137,165,173,254,75,54,48,52,
+36,36,48,47,0,0,1,0,175,255,235,6,24,4,94,0,51,0,0,1,38,53,52,55,54,36,51,
+32,17,17,35,17,52,38,38,35,34,7,22,17,20,6,35,34,38,39,6,35,34,38,53,17,51,
+17,20,22,51,50,54,55,53,51,21,22,51,50,54,53,52,38,38,2,177,22,22,97,1,92,
+90,1,80,170,45,109,116,67,100,224,170,157,47,77,55,81,128,152,135,170,82,
+77,35,51,24,115,59,55,100,116,101,192,3,170,28,34,35,29,18,36,254,109,253,
+53,2,195,132,104,44,12,142,254,154,246,250,33,52,84,198,205,2,203,253,61,
+134,151,31,21,219,219,53,215,189,125,190,114,0,0,2,0,175,255,236,5,149,4,
+94,0,34,0,45,0,0,51,17,51,17,33,17,52,54,51,50,22,21,17,35,17,52,38,35,34,
+6,21,21,51,50,22,21,20,6,35,34,38,53,53,33,17,37,20,22,51,50,54,53,52,38,
+35,35,175,170,1,61,220,179,164,204,170,129,106,132,116,73,77,110,110,77,77,
+110,254,195,1,175,43,30,30,43,43,30,73,4,74,253,47,1,21,209,255,219,184,253,
+53,2,195,123,137,165,173,252,115,84,83,115,115,83,84,254,250,178,36,46,46,
+36,36,48,0,1,0,170,255,236,5,98,4,94,0,32,0,0,33,35,17,52,38,35,34,6,6,21,
+21,20,6,35,34,38,53,17,51,17,20,22,51,50,54,53,53,52,54,51,50,22,21,5,98,
+170,68,67,66,66,26,197,209,183,156,170,101,95,144,131,142,144,146,135,2,195,
+147,113,59,122,156,225,212,213,193,210,2,203,253,61,130,130,150,150,223,247,
+217,202,201,0,0,2,0,165,255,236,7,56,4,94,0,54,0,66,0,0,1,17,20,22,51,50,
+54,54,51,50,30,2,51,50,54,55,46,2,53,52,54,51,50,22,21,20,6,7,22,22,21,21,
+35,53,52,38,39,6,6,35,34,38,38,35,34,6,6,35,34,38,38,53,17,1,54,54,53,52,
+38,35,34,6,21,20,22,1,79,73,93,79,125,119,57,37,71,97,92,66,61,137,61,90,
+130,100,157,132,142,155,53,52,109,75,170,49,39,81,187,98,81,120,103,35,44,
+111,144,107,117,132,65,5,123,33,40,82,87,72,89,91,4,74,253,61,161,134,117,
+164,46,155,80,116,100,85,140,190,111,118,162,169,168,92,227,113,109,148,68,
+24,24,51,94,48,118,119,95,163,167,91,78,151,174,2,203,253,110,81,173,84,118,
+104,98,70,77,160,0,2,0,165,255,236,8,61,4,94,0,50,0,69,0,0,1,54,51,50,23,
+51,54,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,7,6,35,
+34,39,53,38,38,35,34,6,7,6,35,34,39,39,53,52,18,51,50,22,19,6,6,35,34,38,
+53,17,51,17,20,22,51,50,54,55,54,51,50,3,216,84,204,205,63,7,42,136,83,1,
+45,170,69,86,110,101,170,72,86,102,104,3,29,24,21,30,3,98,95,94,98,4,29,24,
+21,30,1,160,140,81,128,91,6,232,204,220,208,170,141,159,130,150,5,27,29,28,
+3,158,192,184,94,90,254,109,253,53,2,195,129,131,165,196,253,162,2,195,129,
+131,141,196,8,6,4,186,149,144,191,8,6,15,16,186,1,15,98,253,47,155,164,203,
+200,2,203,253,61,130,130,82,86,10,0,0,2,0,80,255,236,8,113,4,94,0,88,0,97,
+0,0,1,51,50,22,21,21,35,53,52,38,35,35,21,20,6,35,34,38,53,53,35,34,38,53,
+52,54,55,22,22,21,7,6,6,21,20,22,51,51,53,52,38,35,35,34,6,21,20,22,23,23,
+20,6,7,38,38,53,52,54,51,51,50,22,21,21,33,53,16,33,51,50,22,21,20,6,7,38,
+38,53,55,54,54,53,52,38,35,35,34,6,21,1,21,20,22,51,50,54,54,53,5,84,141,
+150,173,170,87,119,88,184,172,163,108,31,182,170,129,132,12,16,1,75,72,96,
+114,32,84,110,86,112,136,60,66,1,16,12,106,122,201,165,86,195,175,1,103,1,
+37,234,190,183,126,128,12,16,1,80,64,117,130,248,82,83,254,50,41,102,105,
+80,31,2,32,191,169,184,189,132,107,23,248,177,166,237,45,96,107,85,128,39,
+17,37,19,26,18,54,49,59,60,163,156,139,64,48,30,64,26,26,19,37,17,38,127,
+69,92,121,187,216,171,171,1,147,98,110,86,116,37,17,37,19,26,22,51,45,61,
+53,140,155,254,233,37,156,104,46,112,139,0,1,0,110,255,236,5,98,4,94,0,55,
+0,0,1,34,6,21,20,22,51,22,21,20,7,34,6,21,20,22,51,50,54,53,53,52,54,51,32,
+17,17,35,17,52,38,35,34,6,21,21,20,6,35,34,38,53,52,54,55,53,38,53,52,54,
+51,51,22,21,20,7,1,188,66,71,117,115,9,9,116,144,113,104,124,109,191,163,
+1,39,170,79,86,111,90,177,186,163,206,116,100,188,155,153,97,9,9,3,236,78,
+77,94,104,29,27,28,30,135,100,96,111,123,199,240,212,249,254,109,253,53,2,
+195,146,114,168,169,225,244,181,183,152,112,156,16,6,46,190,136,141,29,27,
+28,30,0,0,1,0,160,255,236,7,148,4,94,0,59,0,0,1,16,33,34,38,53,17,52,38,35,
+34,6,6,21,21,16,33,34,38,53,17,51,17,20,22,51,50,54,53,53,52,54,51,50,22,
+21,17,20,22,51,50,54,53,53,52,54,51,50,22,21,17,35,17,52,38,35,34,6,6,21,
+5,232,254,238,134,139,62,71,57,53,15,254,238,134,139,170,47,82,80,65,133,
+125,127,146,47,82,80,65,133,125,127,146,170,62,71,57,53,15,1,149,254,87,205,
+198,1,68,145,115,69,128,140,225,254,87,205,198,2,203,253,61,124,136,110,193,
+220,231,233,214,189,254,188,124,136,110,193,220,231,233,214,189,253,53,2,
+195,145,115,70,128,140,0,0,1,0,88,0,0,4,233,4,94,0,38,0,0,1,20,7,38,38,53,
+52,54,51,50,22,23,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,
+52,38,35,34,6,21,20,22,1,13,28,78,75,153,148,126,142,31,7,44,132,93,145,148,
+170,75,87,104,100,170,113,105,59,71,32,3,69,60,51,23,100,68,95,106,92,92,
+95,89,208,195,253,53,2,195,142,118,170,191,253,162,2,195,152,156,49,44,24,
+47,0,0,2,0,80,255,236,10,153,5,212,0,82,0,93,0,0,1,52,38,35,34,17,17,35,17,
+52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,7,6,35,
+34,39,52,54,51,50,23,51,54,54,51,50,23,51,54,51,50,23,51,54,51,50,22,21,17,
+20,22,51,50,54,53,17,35,34,38,53,52,54,51,50,22,21,17,20,6,35,32,17,1,53,
+52,38,35,34,6,21,20,22,51,8,111,79,86,201,170,69,86,109,102,170,69,86,110,
+101,170,72,86,102,104,3,29,24,21,30,176,164,202,65,8,42,136,83,207,63,8,82,
+176,194,67,8,89,181,147,151,43,81,80,65,84,83,115,115,83,83,116,146,140,254,
+244,1,183,48,36,36,46,46,36,2,195,146,114,254,215,253,98,2,195,129,131,161,
+183,253,145,2,195,129,131,165,196,253,162,2,195,129,131,141,196,8,6,237,253,
+184,94,90,184,184,161,161,204,199,254,188,127,133,110,193,2,172,110,77,77,
+110,109,78,252,124,200,225,1,147,3,81,73,30,43,43,30,30,43,0,1,0,175,255,
+236,7,62,4,94,0,50,0,0,51,39,53,39,53,52,54,51,50,22,21,17,20,22,51,50,54,
+54,53,39,52,54,51,50,22,21,17,35,17,52,38,35,34,6,21,23,20,6,35,34,38,53,
+17,52,38,35,34,6,21,17,23,177,1,1,182,161,147,151,64,105,101,92,37,2,182,
+161,147,151,170,79,86,111,91,1,185,191,157,139,79,86,111,91,1,127,103,223,
+201,216,248,204,199,254,188,127,133,52,113,138,220,216,248,204,199,253,53,
+2,195,146,114,166,171,225,223,202,197,206,1,68,146,114,166,171,254,105,223,
+0,0,1,0,160,255,236,5,186,4,94,0,38,0,0,33,35,17,52,38,38,35,34,7,22,21,21,
+20,6,35,34,38,53,17,51,17,20,22,51,50,54,53,53,52,38,35,38,53,52,55,36,51,
+32,17,5,186,170,45,109,116,77,144,115,201,198,190,171,170,100,137,142,96,
+114,97,25,23,1,117,165,1,80,2,195,132,104,44,19,110,231,222,222,203,195,208,
+2,203,253,61,127,133,115,188,189,149,166,32,37,34,23,54,254,109,0,0,2,0,80,
+0,0,8,139,4,94,0,65,0,74,0,0,19,52,54,51,50,23,51,54,51,50,23,51,54,51,32,
+17,21,50,22,21,6,35,34,39,52,38,35,17,35,17,33,17,35,17,38,38,53,52,55,22,
+21,21,7,6,21,20,23,53,52,38,35,34,6,21,17,35,17,52,38,35,34,6,7,6,35,34,5,
+33,53,52,38,35,34,6,21,80,176,164,202,65,8,82,177,207,63,5,82,174,1,45,202,
+199,34,23,24,34,132,154,170,254,151,170,177,146,238,28,1,124,182,69,86,111,
+98,170,72,86,102,104,3,29,24,21,4,121,1,105,69,86,107,99,2,116,237,253,184,
+184,184,184,254,109,237,149,154,8,8,103,86,254,148,1,108,254,148,1,110,9,
+91,99,177,72,38,43,8,9,35,80,119,5,230,129,131,170,191,253,162,2,195,129,
+131,141,196,8,144,229,129,131,158,186,0,2,0,160,255,236,7,110,4,94,0,55,0,
+64,0,0,37,6,35,34,39,38,38,39,17,35,17,33,21,20,6,35,34,38,53,17,51,17,20,
+22,51,50,54,53,53,38,38,53,52,54,55,22,21,21,7,6,6,21,20,22,51,39,53,52,54,
+51,50,22,21,21,50,22,37,33,53,52,38,35,34,6,21,7,110,34,23,24,34,16,140,130,
+170,254,97,208,187,190,171,170,100,137,128,107,193,159,123,157,28,1,92,74,
+97,113,1,202,176,159,164,175,201,252,62,1,160,90,104,118,104,175,8,8,153,
+148,10,254,26,1,232,167,161,180,195,208,2,203,253,61,127,133,82,91,185,6,
+92,102,92,124,46,38,44,8,9,23,57,51,59,61,31,22,218,246,202,201,113,205,205,
+105,142,118,162,175,0,2,0,100,255,236,6,80,4,94,0,40,0,49,0,0,1,16,33,32,
+17,17,35,17,52,38,35,34,6,21,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,
+51,23,17,51,17,22,22,51,50,54,53,5,34,6,21,20,51,50,54,53,3,187,1,91,1,58,
+170,96,100,107,73,139,123,110,145,38,24,123,78,82,108,126,113,11,10,170,66,
+129,84,80,66,253,133,56,50,73,41,32,2,142,1,208,254,128,253,34,2,195,139,
+121,147,191,246,190,213,183,33,97,119,116,86,93,98,1,2,214,252,250,33,178,
+137,184,172,41,43,65,71,76,0,1,0,174,255,236,7,222,4,94,0,47,0,0,1,20,6,35,
+34,38,53,17,51,17,20,22,51,50,54,54,53,53,39,52,54,51,50,23,51,54,54,51,32,
+17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,3,77,182,180,164,145,
+170,65,110,86,90,35,1,202,176,216,71,6,47,149,91,1,71,170,86,97,123,108,170,
+90,104,118,104,1,149,219,206,187,216,2,203,253,61,129,131,54,107,142,64,156,
+218,246,184,94,90,254,109,253,53,2,195,132,128,168,193,253,162,2,195,144,
+116,162,175,0,0,3,0,0,4,186,3,75,7,126,0,11,0,23,0,35,0,0,0,6,35,34,38,53,
+52,54,51,50,22,21,4,6,35,34,38,53,52,54,51,50,22,21,0,6,35,34,38,53,52,54,
+51,50,22,21,1,81,99,69,70,99,99,70,69,99,1,250,99,69,70,99,99,70,69,99,254,
+250,99,69,70,99,99,70,69,99,5,22,92,92,67,67,92,92,67,67,92,92,67,67,92,92,
+67,1,67,92,92,67,67,92,92,67,0,1,0,0,0,0,2,164,4,94,0,40,0,0,1,20,6,6,35,
+35,38,53,52,55,54,18,53,52,38,35,34,6,7,6,35,34,39,54,54,51,50,22,21,20,2,
+7,51,50,54,53,53,54,51,50,23,2,164,73,175,220,180,8,8,174,220,96,67,54,73,
+12,14,43,37,26,15,147,108,130,172,161,138,23,155,105,26,37,43,14,1,13,144,
+96,29,40,42,42,27,97,1,104,189,89,112,72,63,10,10,118,137,183,144,166,254,
+166,129,40,100,135,10,10,0,1,0,0,255,236,2,60,4,94,0,26,0,0,19,38,53,52,55,
+22,0,18,21,20,6,35,34,38,39,54,51,50,23,22,22,51,50,54,53,52,2,28,8,8,134,
+1,2,152,170,131,107,149,15,26,37,43,14,14,78,49,72,89,243,3,199,27,39,39,
+46,41,254,249,254,169,149,155,187,136,119,10,10,71,64,119,104,178,1,130,0,
+2,0,0,4,124,4,22,7,143,0,14,0,25,0,0,17,16,0,33,50,4,21,17,7,38,36,35,34,
+6,7,55,54,51,50,4,23,53,52,38,35,32,1,30,1,6,227,1,15,49,135,254,164,125,
+83,144,72,27,108,146,106,1,9,134,164,171,254,133,5,21,1,42,1,80,220,205,254,
+231,81,85,110,55,60,194,68,74,73,153,158,157,0,2,0,1,4,124,4,23,7,202,0,20,
+0,36,0,0,19,16,0,33,23,54,51,50,22,21,7,22,21,17,7,38,36,35,34,6,7,1,32,3,
+54,51,50,4,23,53,52,39,6,35,34,38,53,1,1,30,1,6,66,60,88,83,115,3,89,49,135,
+254,164,125,83,144,72,1,195,254,131,43,106,148,108,1,10,131,23,42,49,82,117,
+5,21,1,42,1,80,3,62,110,77,29,104,164,254,231,81,85,110,55,60,2,71,254,123,
+68,76,71,153,81,63,20,110,80,0,1,254,182,251,162,0,151,0,32,0,19,0,0,19,20,
+6,35,34,17,17,51,17,20,22,51,50,54,53,17,54,51,50,23,151,116,124,241,170,
+45,55,59,49,24,27,25,27,253,114,238,226,1,147,2,235,253,29,141,119,143,194,
+1,152,10,10,0,0,3,253,97,251,162,0,241,0,133,0,32,0,42,0,47,0,0,55,20,6,35,
+35,21,50,22,21,20,6,35,34,38,53,17,38,38,53,52,54,55,53,51,21,51,54,54,53,
+54,54,51,50,2,38,35,17,20,22,51,50,54,53,1,53,34,21,20,241,209,175,17,173,
+149,132,121,118,121,178,163,164,177,170,17,128,141,17,29,12,20,156,79,129,
+42,57,62,47,254,134,195,125,133,158,175,174,195,208,200,195,198,1,12,2,96,
+106,106,95,2,105,105,3,90,82,4,4,253,83,95,254,252,133,117,129,148,1,93,175,
+87,88,0,0,1,0,80,251,162,5,72,4,94,0,39,0,0,1,52,38,35,34,6,7,6,35,34,39,
+52,54,51,50,23,51,54,54,51,32,17,17,20,51,22,21,20,7,32,17,17,52,38,35,34,
+6,21,17,35,2,37,70,86,102,104,3,29,24,21,30,176,164,200,65,8,42,136,83,1,
+40,91,11,11,254,251,64,86,110,101,170,2,195,129,131,141,196,8,6,237,253,184,
+94,90,254,109,250,20,168,44,30,24,51,1,53,5,236,130,130,165,196,253,162,0,
+0,2,0,80,251,162,5,72,7,108,0,39,0,68,0,0,1,52,38,35,34,6,7,6,35,34,39,52,
+54,51,50,23,51,54,54,51,32,17,17,20,51,22,21,20,7,32,17,17,52,38,35,34,6,
+21,17,35,19,38,38,53,52,55,22,21,21,7,6,6,21,20,4,22,21,20,6,7,38,53,53,55,
+54,54,53,52,39,2,37,70,86,102,104,3,29,24,21,30,176,164,200,65,8,42,136,83,
+1,40,91,11,11,254,251,64,86,110,101,170,17,112,86,238,28,1,66,66,1,36,110,
+126,112,28,1,68,57,124,2,195,129,131,141,196,8,6,237,253,184,94,90,254,109,
+250,20,168,44,30,24,51,1,53,5,236,130,130,165,196,253,162,5,201,18,89,76,
+187,49,38,43,8,9,8,66,42,79,28,86,83,95,119,22,38,43,8,9,12,57,32,77,20,0,
+1,0,0,4,157,5,159,7,11,0,23,0,0,1,6,7,2,36,35,34,6,21,20,22,23,23,20,7,34,
+38,53,52,36,51,50,4,4,5,159,30,51,218,254,116,239,155,173,116,93,4,26,161,
+203,1,6,223,162,1,51,1,30,4,240,51,30,1,6,228,90,85,81,120,2,36,41,37,177,
+124,137,184,104,214,0,0,2,250,226,252,7,0,122,0,80,0,44,0,55,0,0,37,22,22,
+21,20,4,5,6,21,20,22,51,50,54,55,22,23,2,35,34,38,53,52,55,38,38,53,52,54,
+51,50,22,21,20,7,36,36,53,52,38,39,38,53,52,55,1,54,53,52,38,35,34,6,21,20,
+22,254,217,182,235,253,233,254,94,35,46,45,42,53,24,70,29,73,175,103,122,
+31,136,175,152,128,121,125,17,1,113,1,120,159,107,8,8,253,121,26,54,63,55,
+78,112,80,4,147,113,173,238,2,129,58,42,48,72,92,5,22,254,232,125,104,82,
+117,21,152,110,104,124,134,127,59,82,10,157,105,69,102,3,34,22,24,34,253,
+212,119,53,60,51,68,47,63,90,0,1,252,87,251,162,3,79,4,94,0,48,0,0,37,51,
+21,20,6,4,6,21,20,22,51,50,54,54,53,17,52,54,51,32,17,17,20,51,22,21,20,7,
+32,17,17,52,38,35,34,6,21,17,16,6,33,32,17,52,62,3,53,254,182,170,164,254,
+182,168,208,184,222,213,89,195,161,1,39,91,11,11,254,251,74,91,111,91,247,
+254,222,253,160,92,177,252,86,41,61,182,180,54,152,129,132,154,61,135,158,
+5,26,213,248,254,109,250,20,168,46,28,22,53,1,53,5,236,138,122,166,171,250,
+249,254,254,203,1,147,118,172,108,50,134,113,0,0,1,246,120,252,224,0,56,5,
+22,0,29,0,0,1,6,2,17,16,0,0,33,32,36,53,52,38,35,39,52,55,22,22,21,16,0,33,
+32,0,0,17,16,1,22,248,53,158,168,1,55,2,55,1,96,1,212,1,248,128,85,4,26,158,
+208,253,145,254,29,254,101,253,130,254,171,1,108,51,4,197,135,254,69,254,
+238,254,204,254,32,254,246,232,205,73,141,38,38,38,2,192,131,254,253,254,
+216,1,27,2,8,1,95,2,117,1,63,30,0,0,1,0,0,251,162,6,248,4,94,0,45,0,0,1,20,
+6,6,35,32,36,53,52,54,51,22,21,20,7,34,6,21,16,33,50,54,54,53,17,52,54,51,
+32,17,17,20,51,22,21,20,7,32,17,17,52,38,35,34,6,21,4,121,111,240,229,254,
+251,254,208,240,186,8,8,129,182,1,194,170,209,87,191,165,1,39,91,11,11,254,
+251,79,86,111,91,253,111,178,197,86,206,180,177,249,34,24,22,34,179,130,254,
+238,67,135,152,5,26,209,252,254,109,250,20,168,44,30,24,51,1,53,5,236,146,
+114,166,171,0,7,0,165,248,248,12,80,6,111,0,28,0,50,0,76,0,100,0,125,0,137,
+0,149,0,0,1,6,4,33,32,0,17,52,54,51,50,22,21,20,6,35,34,38,39,6,6,21,16,0,
+33,50,36,55,22,1,6,21,20,0,0,51,20,7,36,0,17,52,18,51,50,22,21,20,6,35,34,
+1,6,0,4,35,34,36,53,52,54,51,50,22,21,20,6,7,22,22,51,50,36,0,55,22,22,3,
+6,6,21,20,0,23,6,6,7,38,0,17,16,0,33,50,22,21,20,6,35,34,38,0,54,51,50,22,
+23,54,18,17,52,39,54,51,50,23,22,22,21,20,2,0,35,34,38,53,0,54,51,50,22,21,
+20,6,35,34,38,53,36,38,35,34,6,21,20,22,51,50,54,53,10,0,205,253,42,254,234,
+253,212,253,138,201,148,95,120,118,80,57,94,25,8,7,2,38,2,0,244,2,159,209,
+34,251,105,46,1,127,2,62,252,32,254,87,252,114,215,146,82,116,118,80,96,4,
+197,94,254,106,254,14,189,222,254,156,117,82,82,116,74,61,63,170,97,157,1,
+211,1,116,88,27,52,115,115,119,1,0,181,11,47,26,199,254,230,1,38,1,10,82,
+116,118,80,76,114,253,156,117,82,77,117,4,202,234,6,22,41,36,21,5,5,213,254,
+173,206,82,117,2,163,163,107,108,161,163,106,110,160,1,158,86,58,60,85,86,
+59,57,87,254,140,61,63,1,133,1,86,158,208,106,81,76,111,55,45,23,54,35,254,
+223,254,205,65,58,46,5,26,98,108,162,254,121,254,251,79,38,12,2,71,1,131,
+193,1,8,113,74,76,111,250,44,187,254,156,217,244,194,78,109,113,74,58,99,
+20,60,71,216,1,72,169,8,43,7,175,46,200,144,211,254,24,142,27,45,11,129,2,
+40,1,15,1,13,1,47,113,74,76,111,97,244,167,109,102,76,87,2,38,1,17,53,50,
+7,7,35,73,38,230,253,240,254,207,110,77,5,241,152,151,104,106,150,153,103,
+55,81,82,54,55,81,80,56,0,7,0,165,248,10,12,80,5,129,0,28,0,50,0,77,0,101,
+0,125,0,137,0,149,0,0,5,54,36,33,32,4,0,21,20,6,35,34,38,53,52,54,51,50,22,
+23,54,53,16,0,33,32,4,7,38,1,54,53,52,0,36,35,52,55,4,0,17,20,2,35,34,38,
+53,52,54,51,50,1,54,0,36,51,50,4,22,21,20,6,35,34,38,53,52,54,55,38,38,35,
+34,4,0,7,38,38,19,54,54,53,52,2,39,54,54,55,22,0,17,16,0,33,34,38,53,52,54,
+51,50,22,19,6,2,17,20,23,6,35,34,39,38,53,52,18,0,51,50,22,21,20,6,35,34,
+38,0,54,51,50,22,21,20,6,35,34,38,53,36,38,35,34,6,21,20,22,51,50,54,53,2,
+245,212,2,180,1,49,1,115,2,20,1,27,203,146,98,117,115,83,57,94,25,15,253,
+230,253,244,254,246,253,92,182,34,4,151,46,254,126,253,198,253,32,1,173,3,
+138,204,157,83,115,115,83,96,251,59,94,1,144,1,244,193,151,1,27,144,114,85,
+83,115,77,58,62,172,96,167,254,55,254,142,90,27,52,115,115,119,250,187,11,
+47,26,208,1,17,254,217,254,247,83,115,115,83,76,112,217,196,240,6,26,37,33,
+24,10,213,1,88,201,83,116,114,85,79,115,252,203,158,111,110,160,160,110,111,
+158,1,158,84,61,61,83,84,60,61,84,19,59,65,174,254,175,210,173,203,105,82,
+77,110,55,45,43,64,1,35,1,54,71,52,47,250,229,100,106,169,1,134,255,81,36,
+12,253,180,254,130,179,254,234,110,77,77,110,5,212,189,1,94,221,124,196,118,
+77,110,110,77,62,97,18,60,71,215,254,185,171,8,43,248,81,46,202,142,215,1,
+223,147,27,45,11,136,253,216,254,248,254,239,254,213,110,77,77,110,94,11,
+155,85,253,226,254,229,54,49,7,7,70,76,237,2,9,1,49,109,78,77,110,103,251,
+51,151,150,106,105,150,151,104,56,80,79,57,57,79,80,56,0,5,0,50,251,162,18,
+34,4,94,0,36,0,55,0,184,0,194,0,204,0,0,1,54,51,32,17,17,35,17,52,38,35,34,
+6,7,21,6,35,34,39,53,38,38,35,34,6,7,6,35,34,39,39,53,52,18,51,50,22,19,6,
+6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,1,54,55,0,0,33,32,36,53,
+17,6,7,22,22,21,20,6,35,34,36,53,52,0,37,22,21,20,7,4,4,21,20,22,51,50,54,
+53,52,38,39,6,7,38,39,54,36,55,17,52,54,51,32,17,17,22,23,17,52,54,51,32,
+17,17,4,0,23,6,6,7,39,38,38,35,34,6,7,38,38,39,54,54,55,38,37,17,20,51,22,
+21,20,7,32,17,17,38,39,17,20,6,6,35,38,53,52,55,50,54,54,53,17,38,39,17,20,
+51,22,21,20,7,32,17,17,6,7,17,20,4,33,32,1,54,55,17,52,38,35,34,6,21,1,22,
+23,17,52,38,35,34,6,21,4,174,84,204,1,40,170,67,86,100,106,3,29,24,21,30,
+3,98,95,94,98,4,29,24,21,30,1,160,140,81,128,91,6,232,204,220,208,170,141,
+159,130,150,5,27,29,28,251,112,23,66,1,46,2,193,1,140,1,53,1,88,196,152,110,
+119,208,172,218,254,193,1,190,1,126,8,8,254,206,254,159,229,164,110,132,117,
+101,106,74,45,30,113,1,108,228,175,161,1,29,203,210,175,161,1,29,1,4,1,151,
+125,22,34,42,15,26,77,34,51,131,41,27,25,17,53,152,81,214,254,190,91,11,11,
+254,251,161,176,66,143,125,8,8,90,93,37,204,209,91,11,11,254,251,167,170,
+254,96,254,150,252,175,6,91,164,173,71,84,98,84,4,10,173,164,71,84,98,84,
+3,158,192,254,109,253,53,2,195,130,130,139,187,11,8,6,4,186,149,144,191,8,
+6,15,16,186,1,15,98,253,47,155,164,203,200,2,203,253,61,130,130,82,86,10,
+253,75,70,24,254,163,254,151,205,186,1,56,56,81,23,117,78,108,141,207,157,
+192,1,22,12,34,24,23,34,15,197,144,111,149,79,60,55,87,13,67,78,30,57,120,
+193,63,3,63,218,243,254,109,252,217,2,37,3,20,218,243,254,109,251,238,123,
+254,168,205,22,21,17,25,37,38,78,51,16,24,29,77,91,6,234,158,254,164,168,
+44,30,24,51,1,53,1,175,64,41,254,92,174,166,85,34,23,24,34,58,118,146,1,176,
+38,2,253,176,168,44,30,24,51,1,53,2,83,14,39,254,119,214,241,3,201,37,12,
+3,36,151,109,144,193,252,240,39,62,3,194,151,109,144,193,0,5,0,50,251,162,
+19,186,4,177,0,36,0,55,0,195,0,205,0,215,0,0,1,54,51,32,17,17,35,17,52,38,
+35,34,6,7,21,6,35,34,39,53,38,38,35,34,6,7,6,35,34,39,39,53,52,18,51,50,22,
+19,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,1,38,38,39,54,54,55,
+38,37,17,20,51,22,21,20,7,32,17,17,38,39,17,20,6,6,35,38,53,52,55,50,54,54,
+53,17,38,39,17,20,51,22,21,20,7,32,17,17,6,7,17,20,4,33,32,0,0,17,16,18,55,
+22,23,6,2,17,16,0,0,33,32,36,54,53,17,6,7,22,22,21,20,6,35,34,36,53,52,54,
+36,55,22,21,20,7,4,4,21,20,22,51,50,54,53,52,38,39,6,7,38,39,54,36,55,17,
+52,54,51,32,17,17,22,23,17,52,54,51,32,17,17,4,0,23,6,6,7,39,38,38,35,34,
+6,1,22,23,17,52,38,35,34,6,21,1,54,55,17,52,38,35,34,6,21,6,70,84,204,1,40,
+170,67,86,100,106,3,29,24,21,30,3,98,95,94,98,4,29,24,21,30,1,160,140,81,
+128,91,6,232,204,220,208,170,141,159,130,150,5,27,29,28,11,135,27,25,17,53,
+152,81,214,254,190,91,11,11,254,251,161,176,66,143,125,8,8,90,93,37,204,209,
+91,11,11,254,251,167,170,254,38,254,46,253,221,252,254,254,102,243,198,51,
+30,189,218,1,131,2,199,1,196,1,97,1,120,159,196,152,107,122,209,155,237,254,
+196,206,1,121,245,8,8,254,211,254,154,230,156,116,133,115,103,106,74,45,30,
+113,1,108,228,175,161,1,29,203,210,175,161,1,29,1,4,1,151,125,22,34,42,15,
+26,77,34,51,131,252,157,173,164,71,84,98,84,251,246,164,173,71,84,98,84,3,
+158,192,254,109,253,53,2,195,130,130,139,187,11,8,6,4,186,149,144,191,8,6,
+15,16,186,1,15,98,253,47,155,164,203,200,2,203,253,61,130,130,82,86,10,250,
+139,16,24,29,77,91,6,234,158,254,164,168,44,30,24,51,1,53,1,175,64,41,254,
+92,174,166,85,34,23,24,34,58,118,146,1,176,38,2,253,176,168,44,30,24,51,1,
+53,2,83,14,39,254,119,220,238,1,73,2,107,1,84,1,6,2,62,195,30,51,176,254,
+10,254,251,254,176,253,225,254,207,78,160,156,1,56,56,81,22,118,77,107,143,
+204,164,124,216,131,7,34,24,23,34,12,203,135,117,149,79,59,56,86,14,67,78,
+30,57,120,193,63,3,63,218,243,254,109,252,217,2,37,3,20,218,243,254,109,251,
+238,123,254,168,205,22,21,17,25,37,38,78,3,115,39,62,3,194,151,109,144,193,
+252,248,37,12,3,36,151,109,144,193,0,0,5,0,50,251,162,19,186,6,20,0,139,0,
+149,0,186,0,196,0,215,0,0,1,22,22,23,4,0,17,16,0,33,32,36,54,53,17,6,7,22,
+22,21,20,6,35,34,36,53,52,0,37,22,21,20,7,4,4,21,20,22,51,50,54,53,52,38,
+39,6,7,38,39,54,36,55,17,52,54,51,32,17,17,22,23,17,52,54,51,32,17,17,4,0,
+23,6,6,7,39,38,38,35,34,6,7,38,38,39,54,54,55,38,37,17,20,51,22,21,20,7,32,
+17,17,38,39,17,20,6,6,35,38,53,52,55,50,54,54,53,17,38,39,17,20,51,22,21,
+20,7,32,17,17,6,7,17,20,4,33,32,0,0,17,16,18,0,1,22,23,17,52,38,35,34,6,21,
+1,54,51,32,17,17,35,17,52,38,35,34,6,7,21,6,35,34,39,53,38,38,35,34,6,7,6,
+35,34,39,39,53,52,18,51,50,22,1,54,55,17,52,38,35,34,6,21,1,6,6,35,34,38,
+53,17,51,17,20,22,51,50,54,55,54,51,50,3,182,27,26,4,254,119,254,63,3,101,
+3,20,1,29,1,79,161,196,152,110,119,208,172,218,254,193,1,185,1,131,8,8,254,
+206,254,159,229,164,110,132,117,101,106,74,45,30,113,1,108,228,175,161,1,
+29,203,210,175,161,1,29,1,4,1,151,125,22,34,42,15,26,77,34,51,131,41,27,25,
+17,53,152,81,214,254,190,91,11,11,254,251,161,176,66,143,125,8,8,90,93,37,
+204,209,91,11,11,254,251,167,170,254,32,254,41,253,227,253,2,254,103,246,
+1,194,11,189,173,164,71,84,98,84,247,159,84,204,1,40,170,67,86,100,106,3,
+29,24,21,30,3,98,95,94,98,4,29,24,21,30,1,160,140,81,128,4,127,164,173,71,
+84,98,84,251,220,6,232,204,220,208,170,141,159,130,150,5,27,29,28,6,20,19,
+41,36,225,253,98,254,127,253,219,253,134,83,165,146,1,56,56,81,23,117,78,
+108,141,207,157,192,1,22,12,34,24,23,34,15,197,144,111,149,79,60,55,87,13,
+67,78,30,57,120,193,63,3,63,218,243,254,109,252,217,2,37,3,20,218,243,254,
+109,251,238,123,254,168,205,22,21,17,25,37,38,78,51,16,24,29,77,91,6,234,
+158,254,164,168,44,30,24,51,1,53,1,175,64,41,254,92,174,166,85,34,23,24,34,
+58,118,146,1,176,38,2,253,176,168,44,30,24,51,1,53,2,83,14,39,254,119,223,
+235,1,58,2,100,1,126,1,20,2,25,1,203,249,176,39,62,3,194,151,109,144,193,
+1,40,192,254,109,253,53,2,195,130,130,139,187,11,8,6,4,186,149,144,191,8,
+6,15,16,186,1,15,98,251,114,37,12,3,36,151,109,144,193,254,181,155,164,203,
+200,2,203,253,61,130,130,82,86,10,0,2,0,125,4,184,2,228,7,108,0,11,0,23,0,
+0,0,38,53,52,54,51,50,22,21,20,6,35,54,54,53,52,38,35,34,6,21,20,22,51,1,
+51,182,185,145,135,150,149,135,57,98,90,69,70,88,85,63,4,184,207,141,145,
+199,174,172,173,173,118,123,98,105,130,130,98,89,139,0,2,0,125,0,63,2,10,
+4,14,0,11,0,23,0,0,0,6,35,34,38,53,52,54,51,50,22,21,16,6,35,34,38,53,52,
+54,51,50,22,21,2,10,115,83,83,116,115,84,83,115,115,83,83,116,115,84,83,115,
+3,6,110,109,78,77,110,110,77,253,90,110,109,78,77,110,110,77,0,1,0,125,255,
+236,2,177,4,94,0,26,0,0,1,22,22,23,38,2,2,39,38,53,52,54,55,50,18,18,21,20,
+6,35,38,38,39,38,53,52,54,1,74,71,94,45,4,136,190,69,16,18,19,98,250,179,
+73,48,106,96,57,16,18,1,145,20,68,69,114,1,96,1,14,26,22,31,20,34,5,254,208,
+254,84,156,96,154,197,95,17,22,31,20,34,0,0,2,0,125,255,236,4,198,4,94,0,
+26,0,53,0,0,1,22,22,23,38,2,2,39,38,53,52,54,55,50,18,18,21,20,6,35,38,38,
+39,38,53,52,54,37,22,22,23,38,2,2,39,38,53,52,54,55,50,18,18,21,20,6,35,38,
+38,39,38,53,52,54,1,74,71,94,45,4,136,190,69,16,18,19,98,250,179,73,48,106,
+96,57,16,18,2,40,71,94,45,4,136,190,69,16,18,19,98,250,179,73,48,106,96,57,
+16,18,1,145,20,68,69,114,1,96,1,14,26,22,31,20,34,5,254,208,254,84,156,96,
+154,197,95,17,22,31,20,34,5,20,68,69,114,1,96,1,14,26,22,31,20,34,5,254,208,
+254,84,156,96,154,197,95,17,22,31,20,34,0,0,1,0,165,251,162,2,22,4,94,0,17,
+0,0,19,32,17,17,20,51,22,21,20,7,32,17,17,52,35,38,53,52,176,1,0,91,11,11,
+255,0,91,11,4,94,254,203,249,182,168,44,30,24,51,1,53,6,74,168,44,30,24,0,
+0,2,0,165,251,162,3,154,4,94,0,17,0,35,0,0,19,32,17,17,20,51,22,21,20,7,32,
+17,17,52,35,38,53,52,37,32,17,17,20,51,22,21,20,7,32,17,17,52,35,38,53,52,
+176,1,0,91,11,11,255,0,91,11,1,143,1,0,91,11,11,255,0,91,11,4,94,254,203,
+249,182,168,44,30,24,51,1,53,6,74,168,44,30,24,51,254,203,249,182,168,44,
+30,24,51,1,53,6,74,168,44,30,24,0,3,0,165,251,162,2,171,7,96,0,17,0,37,0,
+43,0,0,19,32,17,17,20,51,22,21,20,7,32,17,17,52,35,38,53,52,19,6,6,21,20,
+51,50,55,22,23,6,6,35,34,38,53,52,55,22,22,1,22,23,3,38,39,176,1,0,91,11,
+11,255,0,91,11,156,14,22,75,69,52,54,31,26,124,76,77,98,72,23,49,1,18,56,
+44,211,60,40,4,94,254,203,249,182,168,44,30,24,51,1,53,6,74,168,44,30,24,
+1,194,20,62,30,80,87,13,44,70,87,103,85,102,80,3,28,1,95,9,49,254,147,11,
+47,0,0,3,0,16,248,160,2,22,4,94,0,17,0,37,0,43,0,0,19,32,17,17,20,51,22,21,
+20,7,32,17,17,52,35,38,53,52,19,54,54,53,52,35,34,7,38,39,54,54,51,50,22,
+21,20,7,38,38,1,38,39,19,22,23,176,1,0,91,11,11,255,0,91,11,213,14,22,75,
+69,52,54,31,26,124,76,77,98,72,21,51,254,238,56,44,211,60,40,4,94,254,203,
+249,182,168,44,30,24,51,1,53,6,74,168,44,30,24,245,232,20,62,30,80,87,13,
+44,70,87,103,85,102,80,3,29,254,160,9,49,1,109,11,47,0,0,1,0,126,255,236,
+3,47,4,106,0,30,0,0,1,20,6,35,34,39,22,18,21,20,7,6,35,34,39,54,53,52,2,39,
+38,53,52,55,4,51,50,53,54,51,50,3,47,142,129,67,80,87,99,36,24,36,35,26,40,
+180,148,12,12,1,21,137,142,24,37,37,4,94,128,138,19,127,254,201,168,143,129,
+13,13,126,131,205,1,135,121,42,34,33,42,96,96,12,0,2,0,125,255,237,4,118,
+4,95,0,11,0,23,0,0,18,0,51,50,0,21,20,0,35,34,0,17,0,6,21,20,22,51,50,54,
+53,52,2,35,125,1,14,235,228,1,28,254,231,226,234,254,236,1,92,179,182,156,
+176,214,224,168,3,52,1,43,254,185,244,239,254,184,1,50,1,12,1,194,242,210,
+211,247,255,202,192,1,5,0,0,1,0,80,0,0,7,1,4,94,0,47,0,0,19,52,54,51,50,23,
+51,54,54,51,50,23,51,54,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,
+38,35,34,6,21,17,35,17,52,38,35,34,6,7,6,35,34,80,176,164,202,65,8,42,136,
+83,207,63,5,42,136,83,1,45,170,69,86,109,102,170,69,86,110,101,170,72,86,
+102,104,3,29,24,21,2,116,237,253,184,94,90,184,94,90,254,109,253,53,2,195,
+129,131,161,183,253,145,2,195,129,131,165,196,253,162,2,195,129,131,141,196,
+8,0,0,3,0,165,251,160,7,129,4,94,0,55,0,65,0,84,0,0,1,54,51,32,17,17,51,54,
+54,53,54,51,50,23,20,6,35,35,17,20,6,33,32,0,53,52,36,33,17,52,38,35,34,6,
+7,21,6,35,34,39,53,38,38,35,34,6,7,6,35,34,39,52,18,51,50,22,1,32,4,21,20,
+22,51,50,54,53,1,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,3,216,
+84,204,1,45,126,47,61,30,25,25,34,131,100,117,231,254,245,254,253,254,218,
+1,180,1,189,72,86,100,106,3,29,24,21,30,3,98,95,94,98,4,29,24,21,30,153,146,
+81,128,1,203,254,151,254,165,209,197,178,124,254,144,6,232,204,220,208,170,
+141,159,130,150,5,27,29,28,3,158,192,254,109,252,179,2,51,41,8,8,91,116,254,
+62,219,208,1,23,248,235,229,3,68,129,131,139,187,11,8,6,4,186,149,144,191,
+8,6,216,1,16,98,251,17,147,183,212,221,138,187,3,212,155,164,203,200,2,203,
+253,61,130,130,82,86,10,0,0,3,0,165,251,160,10,46,4,94,0,34,0,53,0,97,0,0,
+1,54,51,32,17,17,35,17,52,38,35,34,6,7,21,6,35,34,39,53,38,38,35,34,6,7,6,
+35,34,39,52,18,51,50,22,19,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,
+51,50,1,20,4,33,32,0,53,16,0,33,22,21,20,7,32,17,20,4,51,50,36,53,17,52,54,
+51,32,17,17,20,51,22,21,20,7,32,17,17,52,38,35,34,6,21,3,216,84,204,1,45,
+170,72,86,100,106,3,29,24,21,30,3,98,95,94,98,4,29,24,21,30,153,146,81,128,
+91,6,232,204,220,208,170,141,159,130,150,5,27,29,28,3,195,254,188,254,217,
+254,233,254,140,1,187,1,172,8,8,253,70,1,25,223,222,1,1,191,165,1,39,91,11,
+11,254,251,79,86,111,91,3,158,192,254,109,253,53,2,195,129,131,139,187,11,
+8,6,4,186,149,144,191,8,6,216,1,16,98,253,47,155,164,203,200,2,203,253,61,
+130,130,82,86,10,252,22,211,216,1,19,234,1,7,1,29,34,24,22,34,254,98,194,
+221,165,160,5,58,209,252,254,109,250,20,168,44,30,24,51,1,53,5,236,146,114,
+166,171,0,1,0,125,255,236,4,63,4,94,0,50,0,0,1,52,54,51,50,22,21,20,7,22,
+21,20,6,35,34,0,53,16,0,33,22,21,20,7,32,4,21,20,22,51,50,54,53,52,33,38,
+53,52,55,54,54,53,52,38,35,34,6,7,6,35,34,1,230,160,123,117,149,117,169,239,
+180,236,254,205,1,153,1,130,10,10,254,181,254,175,235,182,109,135,254,157,
+10,10,153,154,66,50,58,81,4,14,43,37,2,129,113,142,137,110,103,68,55,134,
+128,181,1,42,231,1,32,1,65,26,37,43,14,237,234,184,243,96,68,137,14,42,36,
+26,2,67,72,54,62,76,59,10,0,1,0,125,251,162,5,197,4,94,0,62,0,0,1,20,51,22,
+21,20,7,32,17,17,52,38,35,34,4,21,20,22,51,50,54,53,52,33,38,53,52,55,50,
+54,53,52,38,35,34,6,7,6,35,34,39,52,54,51,50,22,21,20,7,22,21,20,6,35,34,
+0,53,16,0,33,32,4,21,5,95,91,11,11,254,251,224,231,238,254,252,231,184,110,
+136,254,157,10,10,151,156,66,50,58,81,4,14,43,37,26,160,123,117,149,117,169,
+238,184,238,254,210,1,82,1,49,1,50,1,45,252,223,168,44,30,24,51,1,53,5,134,
+216,175,253,214,188,241,95,69,137,14,42,36,26,68,73,54,62,76,59,10,10,113,
+142,137,110,103,68,55,134,127,182,1,36,239,1,11,1,84,243,251,0,2,0,110,255,
+236,5,227,4,94,0,43,0,55,0,0,0,6,35,34,38,39,6,21,20,22,51,50,18,51,50,22,
+21,20,6,35,38,53,52,55,54,54,53,52,38,35,34,6,6,35,34,36,2,53,52,0,51,50,
+22,21,5,22,22,51,50,54,53,52,38,35,34,6,3,211,185,161,84,159,56,37,235,168,
+148,248,148,113,150,106,75,8,8,26,41,77,63,112,193,168,89,150,254,240,159,
+1,59,237,143,174,253,174,53,150,68,101,106,123,76,78,147,3,10,117,34,24,97,
+99,175,235,1,8,116,88,78,115,30,25,25,34,2,48,34,44,50,218,74,154,1,9,154,
+233,1,76,133,104,60,22,23,49,45,52,81,95,0,1,0,175,255,236,7,62,4,94,0,50,
+0,0,51,39,53,39,53,52,54,51,50,22,21,17,20,22,51,50,54,54,53,39,52,54,51,
+50,22,21,17,35,17,52,38,35,34,6,21,23,20,6,35,34,38,53,17,52,38,35,34,6,21,
+17,23,177,1,1,182,161,147,151,64,105,101,92,37,2,182,161,147,151,170,79,86,
+111,91,1,185,191,157,139,79,86,111,91,1,127,103,223,201,216,248,204,199,254,
+188,127,133,52,113,138,220,216,248,204,199,253,53,2,195,146,114,166,171,225,
+223,202,197,206,1,68,146,114,166,171,254,105,223,0,255,255,0,165,255,236,
+7,56,4,94,2,2,0,46,0,0,0,1,0,160,255,236,7,148,4,94,0,59,0,0,1,16,33,34,38,
+53,17,52,38,35,34,6,6,21,21,16,33,34,38,53,17,51,17,20,22,51,50,54,53,53,
+52,54,51,50,22,21,17,20,22,51,50,54,53,53,52,54,51,50,22,21,17,35,17,52,38,
+35,34,6,6,21,5,232,254,238,134,139,62,71,57,53,15,254,238,134,139,170,47,
+82,80,65,133,125,127,146,47,82,80,65,133,125,127,146,170,62,71,57,53,15,1,
+149,254,87,205,198,1,68,145,115,69,128,140,225,254,87,205,198,2,203,253,61,
+124,136,110,193,220,231,233,214,189,254,188,124,136,110,193,220,231,233,214,
+189,253,53,2,195,145,115,70,128,140,0,0,2,0,160,255,237,4,92,4,95,0,11,0,
+22,0,0,1,22,0,21,20,4,35,34,0,53,52,0,23,4,17,20,22,51,50,54,53,52,2,2,119,
+225,1,4,254,248,214,218,254,252,1,9,206,254,211,175,142,143,197,189,4,95,
+114,254,149,202,207,252,1,4,197,193,1,126,8,213,254,158,142,175,179,138,155,
+1,44,0,0,1,0,165,0,0,5,169,4,94,0,34,0,0,51,53,39,53,52,54,51,50,23,51,54,
+54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,23,166,
+1,202,176,216,71,6,47,149,91,1,70,170,85,97,121,111,170,89,104,118,104,1,
+228,225,201,218,246,184,94,90,254,109,253,53,2,195,132,128,166,195,253,162,
+2,195,144,116,162,175,254,99,217,0,0,1,0,75,255,236,8,167,4,94,0,58,0,0,1,
+52,54,51,50,23,51,54,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,
+35,34,6,21,21,20,6,35,34,0,35,34,21,20,22,23,22,21,20,7,38,38,53,52,54,51,
+50,22,22,51,50,54,53,3,161,202,176,217,71,6,47,149,91,1,71,170,86,97,121,
+111,170,90,104,118,104,134,116,119,254,254,123,105,41,26,8,8,72,109,135,102,
+91,151,159,79,75,64,2,142,218,246,184,94,90,254,109,253,53,2,195,132,128,
+164,180,253,145,2,195,144,116,162,175,247,180,223,1,36,88,43,45,2,34,25,25,
+30,2,113,80,88,114,72,192,143,178,0,0,2,251,69,251,160,0,188,0,22,0,24,0,
+34,0,0,39,21,51,50,54,53,54,51,50,23,20,6,35,35,17,20,6,33,32,0,53,52,36,
+33,53,3,4,4,21,20,22,51,50,54,53,160,126,48,60,32,23,25,34,130,101,117,236,
+254,250,254,254,254,217,1,177,1,192,1,254,121,254,196,208,198,179,122,22,
+152,52,42,8,8,89,118,254,62,224,203,1,24,247,234,230,151,254,247,4,150,176,
+214,219,136,189,0,0,2,247,223,251,123,0,0,255,236,0,52,0,59,0,0,17,6,35,34,
+39,52,38,39,16,35,34,38,53,53,52,38,35,34,6,21,21,20,6,35,34,0,53,16,0,33,
+22,21,20,7,32,4,21,20,18,51,50,54,53,53,52,54,51,32,17,21,51,50,22,37,22,
+22,51,50,54,53,34,22,24,34,119,117,234,124,106,73,92,102,90,201,213,207,254,
+223,1,183,1,176,8,8,254,157,254,169,212,151,152,108,183,160,1,37,227,188,
+222,253,131,2,41,52,57,45,252,79,8,8,97,124,20,254,178,185,192,115,139,121,
+153,184,109,218,207,1,79,241,1,21,1,28,34,24,22,34,210,213,198,254,225,158,
+189,96,216,248,254,109,45,192,78,109,82,84,107,0,0,1,250,207,251,122,255,
+96,255,216,0,37,0,0,1,20,7,38,53,52,54,51,50,22,23,51,54,54,51,50,22,21,17,
+35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,20,22,251,132,28,153,152,
+149,126,142,31,7,45,130,94,146,147,170,71,91,104,100,170,112,106,60,70,32,
+254,191,64,47,45,146,96,105,92,92,96,88,207,196,253,53,2,195,139,121,170,
+191,253,162,2,195,153,155,48,45,24,47,0,2,249,13,250,66,0,100,255,216,0,56,
+0,67,0,0,1,22,22,51,51,50,22,21,20,6,7,38,53,52,55,54,54,53,52,35,35,34,38,
+53,17,52,38,35,34,6,21,21,51,50,22,21,20,6,35,34,38,53,53,33,17,35,17,51,
+17,33,17,52,18,51,50,22,21,1,20,22,51,50,54,53,52,38,35,35,253,242,2,103,
+136,126,121,138,106,75,8,8,26,41,113,253,167,149,126,108,132,116,73,77,110,
+112,75,77,110,254,195,170,170,1,61,222,179,163,202,253,116,43,30,30,43,43,
+30,73,252,250,160,129,114,96,76,119,2,32,23,25,34,2,45,42,89,190,213,1,68,
+122,138,165,173,252,115,84,82,116,118,80,84,254,250,4,74,253,47,1,21,207,
+1,1,221,182,253,231,36,46,46,36,36,48,0,1,251,79,251,93,0,0,255,216,0,35,
+0,0,7,22,21,20,7,34,4,0,21,22,22,51,50,55,55,54,54,51,50,22,23,22,21,20,7,
+38,38,35,34,0,35,34,53,52,0,0,174,11,11,108,254,18,254,195,5,32,49,92,89,
+178,90,203,108,58,147,35,7,7,26,117,76,212,254,93,152,192,1,58,2,1,40,44,
+40,36,49,246,254,181,168,64,36,70,142,71,75,20,9,27,31,31,25,11,17,254,136,
+227,203,1,173,1,32,0,0,1,249,29,250,66,0,100,255,216,0,61,0,0,3,50,22,21,
+20,6,7,38,53,52,55,54,54,53,52,35,35,34,38,53,17,52,38,35,34,7,22,22,21,21,
+20,6,35,34,38,53,17,51,17,20,22,51,50,54,53,53,52,38,38,39,38,53,52,36,51,
+50,22,21,17,20,22,51,159,121,138,106,75,8,8,26,41,113,253,167,149,133,131,
+243,40,126,110,208,187,190,171,170,108,130,124,107,44,68,100,18,1,10,203,
+184,175,102,139,251,217,114,96,76,119,2,32,23,25,34,2,45,42,89,190,213,1,
+68,132,136,246,16,152,158,82,161,180,195,208,2,203,253,61,139,121,80,93,55,
+110,100,38,2,31,41,190,247,209,208,254,202,162,134,0,2,0,25,255,236,7,199,
+4,94,0,69,0,78,0,0,33,35,17,33,21,20,6,35,34,0,35,34,21,20,22,23,22,21,20,
+7,38,38,53,52,54,51,50,22,22,51,50,54,53,53,38,38,53,52,54,55,22,21,21,7,
+6,6,21,20,22,51,39,53,52,54,51,50,22,21,21,50,18,17,6,35,34,39,52,38,38,39,
+37,33,53,52,38,35,34,6,21,6,44,170,254,97,136,115,119,254,254,123,105,41,
+26,8,8,72,109,135,102,91,151,159,79,75,64,193,159,123,157,28,1,92,74,97,113,
+1,202,176,159,164,202,209,34,22,24,34,57,133,107,253,182,1,160,90,104,118,
+104,1,232,105,181,222,1,36,88,43,45,2,34,25,25,30,2,113,80,88,114,72,192,
+143,178,55,6,92,102,92,124,46,38,44,8,9,23,57,51,59,61,31,22,218,246,202,
+201,113,254,227,254,183,8,8,201,186,102,9,116,105,144,116,162,175,0,1,251,
+245,251,126,255,208,255,216,0,26,0,0,3,16,2,35,34,36,2,53,16,0,33,22,21,20,
+7,32,17,20,18,51,32,17,53,54,51,50,23,48,209,212,145,254,246,155,1,196,1,
+163,8,8,253,70,254,157,1,32,30,29,27,29,254,62,254,147,254,173,153,1,8,151,
+1,7,1,27,34,24,22,34,254,98,179,254,222,2,69,42,9,9,0,1,250,244,250,66,0,
+100,255,216,0,39,0,0,1,17,52,18,51,50,22,21,17,20,22,51,51,50,22,21,20,6,
+7,38,53,52,55,54,54,53,52,35,35,34,38,53,17,52,38,35,34,6,21,17,250,244,222,
+179,163,202,102,139,126,121,138,106,75,8,8,26,41,113,253,167,149,126,108,
+132,116,251,122,2,142,207,1,1,221,182,254,188,162,134,114,96,76,119,2,32,
+23,25,34,2,45,42,89,190,213,1,68,122,138,165,173,253,139,0,0,1,0,25,255,236,
+6,44,4,94,0,43,0,0,1,52,54,51,32,17,17,35,17,52,38,35,34,6,21,21,20,6,35,
+34,0,35,34,21,20,22,23,22,21,20,7,38,38,53,52,54,51,50,22,22,51,50,54,53,
+3,111,202,176,1,67,170,88,106,117,104,137,114,119,254,254,123,105,41,26,8,
+8,76,105,136,101,91,154,155,80,76,61,2,142,217,247,254,109,253,53,2,195,141,
+119,159,178,247,183,220,1,36,88,43,45,2,34,25,23,32,2,117,76,88,114,75,189,
+141,180,0,1,249,191,251,146,255,196,255,236,0,50,0,0,7,22,18,21,20,2,35,34,
+46,2,35,34,6,6,35,34,0,53,52,0,33,22,22,21,20,6,7,32,4,21,20,18,51,50,62,
+2,51,50,22,22,51,50,18,53,52,38,39,54,54,250,96,94,241,169,81,87,38,56,30,
+65,122,123,84,181,254,248,1,194,1,165,4,4,4,4,254,177,254,149,164,106,68,
+97,88,86,59,73,88,39,90,116,175,84,67,19,37,20,137,254,227,129,228,254,177,
+65,129,95,199,86,1,94,203,255,1,26,17,29,12,11,28,17,205,189,130,254,187,
+79,139,70,128,171,1,20,186,97,252,102,32,35,0,1,249,86,251,103,255,126,255,
+216,0,48,0,0,3,20,7,38,35,34,7,22,22,21,20,6,4,35,32,36,53,52,0,36,55,22,
+21,20,7,35,34,4,2,21,20,22,51,32,36,53,52,38,35,34,7,38,53,52,55,54,36,51,
+50,130,28,76,110,217,209,147,175,137,254,210,228,254,216,254,217,1,32,1,190,
+239,11,11,6,198,254,112,253,246,239,1,8,1,22,143,117,113,123,10,10,160,1,
+148,201,83,254,141,67,101,16,62,10,129,100,88,161,104,182,176,176,1,123,223,
+1,44,40,36,49,184,254,218,135,123,114,129,94,65,79,37,23,36,34,21,119,137,
+0,1,248,123,251,102,255,96,255,216,0,55,0,0,3,35,17,52,38,35,34,6,21,21,16,
+33,32,17,17,52,38,35,34,6,21,21,16,33,32,17,17,51,17,20,22,51,50,54,53,53,
+52,54,51,50,22,21,17,20,22,51,50,54,53,53,52,54,51,50,22,21,160,170,55,73,
+84,42,254,239,254,244,60,73,83,43,254,239,254,244,170,53,71,89,54,133,127,
+127,141,57,72,89,54,133,127,127,141,251,122,2,195,141,119,138,199,225,254,
+87,1,147,1,68,141,119,143,194,225,254,87,1,147,2,203,253,61,153,107,123,180,
+220,232,232,215,188,254,188,151,109,123,180,220,232,232,215,188,0,0,2,251,
+210,251,162,3,105,4,94,0,44,0,54,0,0,3,17,20,6,35,34,0,53,52,54,51,33,17,
+51,17,51,50,54,53,17,52,54,51,32,17,17,20,51,22,21,20,7,32,17,17,52,38,35,
+34,6,21,17,20,6,35,33,34,6,21,20,22,51,32,17,17,160,232,218,187,254,239,185,
+158,1,141,170,58,130,92,195,161,1,39,91,11,11,254,251,74,91,111,91,161,191,
+253,176,96,111,181,126,1,24,254,92,254,235,207,214,1,23,196,152,186,1,71,
+254,185,134,188,2,128,213,248,254,109,250,20,168,46,28,22,53,1,53,5,236,138,
+122,166,171,253,143,233,192,122,109,145,208,1,9,1,63,0,2,250,17,251,86,255,
+176,255,216,0,33,0,45,0,0,5,54,55,18,17,16,0,33,34,36,2,53,52,18,54,51,50,
+22,21,20,6,35,34,38,39,6,21,20,0,33,50,36,53,52,37,22,22,51,50,54,53,52,38,
+35,34,6,254,162,31,49,190,254,151,254,200,214,254,157,197,133,224,124,124,
+178,173,106,58,165,56,52,1,97,1,14,250,1,18,251,243,33,135,57,66,88,94,52,
+69,119,121,53,28,254,241,254,216,254,241,254,196,157,1,22,171,138,1,1,153,
+136,94,91,136,58,39,114,111,193,254,254,254,228,248,49,33,51,57,43,43,83,
+79,0,0,1,248,187,251,122,255,96,255,216,0,46,0,0,1,34,53,52,54,51,50,23,51,
+54,51,50,23,51,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,
+6,21,17,35,17,52,38,35,34,6,7,6,35,248,227,40,179,161,201,64,8,82,179,202,
+63,5,82,179,1,40,170,64,86,110,101,170,64,86,113,98,170,70,86,112,95,2,30,
+23,253,232,13,231,252,184,184,184,184,254,109,253,53,2,195,130,130,164,180,
+253,145,2,195,130,130,169,192,253,162,2,195,129,131,150,187,8,0,2,248,249,
+251,102,255,96,255,216,0,51,0,62,0,0,1,14,2,35,34,36,2,53,16,0,33,22,21,20,
+7,32,17,20,18,51,50,54,55,17,52,18,51,50,22,21,17,35,17,52,38,35,34,6,21,
+21,54,51,50,22,21,20,6,35,34,38,39,55,34,7,22,22,51,50,54,53,52,38,252,70,
+65,67,92,58,148,254,245,148,1,196,1,163,8,8,253,70,253,159,96,128,63,222,
+176,168,201,170,130,115,125,113,40,62,90,125,109,81,84,119,24,206,62,43,4,
+77,49,32,40,44,252,17,82,56,32,162,1,2,148,1,7,1,27,34,24,22,34,254,98,179,
+254,222,193,43,1,64,206,1,2,224,179,253,53,2,195,127,133,168,170,250,10,122,
+88,83,116,115,102,77,15,67,97,49,40,42,44,0,0,2,248,230,251,127,255,196,255,
+239,0,48,0,59,0,0,1,6,35,34,38,2,53,16,0,33,22,21,20,7,32,4,21,20,18,51,50,
+55,38,53,52,54,51,50,22,21,20,7,22,51,50,18,53,52,38,39,54,55,22,18,21,20,
+0,35,34,39,54,53,52,38,35,34,6,21,20,22,252,50,128,176,136,251,153,1,196,
+1,163,8,8,254,163,254,163,236,145,98,91,103,124,82,80,114,90,127,138,171,
+253,80,71,31,49,94,96,254,193,240,195,162,79,41,30,41,58,49,251,255,128,153,
+1,11,152,1,4,1,25,34,24,22,34,207,196,171,254,208,77,97,104,83,126,116,80,
+100,96,91,1,15,196,108,248,107,53,28,134,254,228,137,243,254,185,254,60,80,
+42,48,57,33,30,75,0,2,249,229,251,102,255,96,255,216,0,35,0,54,0,0,5,54,51,
+32,17,17,35,17,52,38,35,34,6,7,21,6,35,34,39,53,38,38,35,34,6,7,6,35,34,39,
+53,52,54,51,50,22,19,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,
+253,24,84,204,1,40,170,67,86,110,97,2,30,23,21,30,2,87,107,101,90,5,30,23,
+21,30,172,127,81,128,91,6,230,206,220,208,170,141,159,130,150,5,26,30,29,
+232,192,254,109,253,53,2,195,130,130,148,178,11,8,6,4,167,168,150,185,8,6,
+31,203,254,98,253,47,155,164,203,200,2,203,253,61,130,130,82,86,10,0,0,2,
+248,173,251,102,255,96,255,216,0,49,0,68,0,0,1,54,51,50,23,21,20,6,35,34,
+17,17,52,38,35,34,6,7,6,35,34,39,38,38,35,34,6,7,6,35,34,39,53,52,54,51,50,
+22,23,54,51,32,17,17,20,22,51,50,54,53,5,6,6,35,34,38,53,17,51,17,20,22,51,
+50,54,55,54,51,50,254,248,24,27,26,27,118,123,236,72,86,111,96,2,30,23,30,
+21,2,87,107,101,90,5,30,23,21,30,172,127,81,128,40,84,204,1,40,45,55,61,47,
+253,27,6,230,206,220,208,170,141,159,130,150,5,26,30,29,253,224,10,10,170,
+241,223,1,147,1,68,129,131,150,185,8,8,167,168,150,185,8,6,31,203,254,98,
+94,192,254,109,254,188,141,119,146,191,169,155,164,203,200,2,203,253,61,130,
+130,82,86,10,0,0,1,247,55,251,122,255,96,255,216,0,68,0,0,5,54,54,51,50,22,
+21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,
+34,6,21,17,35,17,52,38,35,34,6,7,6,6,35,34,38,39,52,54,51,50,22,23,51,54,
+54,51,50,22,23,51,54,54,51,50,22,23,253,80,46,117,87,145,133,170,58,87,95,
+86,170,62,73,105,86,170,62,73,108,83,170,70,78,86,91,2,14,29,14,13,23,11,
+157,153,102,123,32,8,42,115,84,97,118,35,8,47,111,80,95,112,34,201,83,78,
+201,202,253,53,2,195,144,116,138,159,253,98,2,195,156,104,153,191,253,145,
+2,195,156,104,157,204,253,162,2,195,144,116,163,174,3,5,5,8,243,240,91,93,
+94,90,84,100,104,80,81,80,0,0,2,248,134,251,102,255,96,255,216,0,52,0,63,
+0,0,3,20,6,35,34,38,53,17,52,38,35,34,6,21,21,51,50,22,21,20,6,35,34,38,53,
+53,33,17,35,17,51,17,33,17,52,18,51,50,22,21,17,20,22,51,50,54,54,53,17,54,
+51,50,23,1,20,22,51,50,54,53,52,38,35,35,160,182,180,161,147,127,108,132,
+116,73,77,110,112,75,77,110,254,195,170,170,1,61,222,179,163,203,73,101,88,
+90,33,26,30,29,30,251,127,43,30,30,43,43,30,73,253,15,219,206,184,219,1,68,
+122,138,165,173,252,115,84,82,116,118,80,84,254,250,4,74,253,47,1,21,207,
+1,1,222,181,254,183,149,106,56,109,138,1,83,10,10,253,173,36,46,46,36,36,
+48,0,1,251,158,251,123,1,23,255,236,0,58,0,0,3,51,32,21,20,6,7,38,39,54,54,
+53,52,38,35,35,21,20,6,35,34,0,17,16,0,33,22,21,20,7,32,4,21,20,18,51,50,
+54,55,35,32,53,52,54,55,22,23,6,6,21,20,22,51,51,17,54,51,50,23,160,90,1,
+93,130,108,22,5,68,57,108,105,86,245,194,224,254,213,1,181,1,178,8,8,254,
+163,254,163,222,164,137,149,3,95,254,163,131,107,22,5,68,57,108,105,91,34,
+24,22,34,253,168,198,80,122,20,36,62,9,51,30,63,56,19,189,236,1,63,1,0,1,
+21,1,29,34,24,22,34,206,221,214,254,245,170,159,198,80,122,20,26,72,9,51,
+30,63,56,1,53,8,8,0,2,248,182,251,122,0,241,255,216,0,64,0,73,0,0,1,34,53,
+52,54,51,50,23,51,54,51,50,23,51,54,51,32,17,21,50,22,21,6,35,34,39,52,38,
+35,17,35,17,33,17,35,17,38,38,53,52,55,22,21,6,21,20,23,53,52,38,35,34,6,
+21,17,35,17,52,38,35,34,6,7,6,35,5,33,53,52,38,35,34,6,21,248,222,40,179,
+161,203,64,8,82,177,207,63,5,82,174,1,45,203,198,37,20,24,34,133,153,170,
+254,151,170,172,151,238,27,124,182,69,86,112,97,170,72,86,112,95,2,30,23,
+4,100,1,105,69,86,109,97,253,232,13,231,252,184,184,184,184,254,109,237,148,
+155,8,8,103,86,254,148,1,108,254,148,1,110,8,90,101,177,72,39,59,34,81,119,
+5,230,129,131,169,192,253,162,2,195,129,131,150,187,8,144,229,129,131,162,
+182,255,255,254,182,251,162,6,44,4,94,2,34,0,109,0,0,0,2,0,64,0,0,0,2,0,0,
+255,235,8,41,4,94,0,68,0,80,0,0,1,22,22,21,21,35,53,52,38,39,6,6,35,34,38,
+38,35,34,6,6,35,34,2,35,34,21,20,22,23,22,22,21,20,7,38,38,53,52,54,51,50,
+22,22,51,50,62,2,51,50,30,2,51,50,54,55,46,2,53,52,54,51,50,22,21,20,6,7,
+54,54,53,52,38,35,34,6,21,20,22,7,113,109,75,170,49,39,81,187,98,102,98,73,
+74,71,62,110,123,164,242,125,107,41,26,4,4,8,72,109,139,110,86,144,158,80,
+77,77,68,86,84,84,106,63,70,52,63,138,59,90,130,100,157,132,142,155,53,148,
+33,40,82,87,72,89,91,1,93,109,148,68,24,24,51,94,48,118,119,120,250,240,131,
+1,36,88,43,45,2,17,29,13,23,32,2,115,79,88,113,76,188,81,211,87,100,201,92,
+117,97,85,140,190,111,118,162,169,168,92,227,22,81,173,84,118,104,98,70,77,
+160,0,1,248,39,251,101,255,96,255,216,0,63,0,0,5,38,53,52,55,54,36,51,32,
+17,17,35,17,52,38,38,35,34,7,22,17,20,6,35,34,38,39,6,35,34,38,53,17,52,38,
+35,34,6,21,17,35,17,52,54,51,32,17,17,20,22,51,50,54,55,53,51,21,22,51,50,
+54,53,52,38,251,249,22,22,93,1,118,68,1,80,170,41,111,118,67,100,224,169,
+158,52,78,49,81,128,152,135,69,91,111,90,103,183,158,1,37,81,78,35,51,24,
+115,59,55,100,116,251,220,28,34,36,28,17,37,254,109,253,53,2,195,127,106,
+47,12,143,254,155,247,249,38,47,84,198,205,1,68,140,120,168,169,253,138,2,
+142,218,246,254,109,254,188,135,150,31,21,219,219,53,218,186,207,222,0,2,
+247,168,251,102,255,201,255,216,0,88,0,97,0,0,1,51,50,22,21,21,35,53,52,38,
+35,35,21,20,6,35,34,38,53,53,35,34,38,53,52,54,55,22,22,21,7,6,6,21,20,22,
+51,51,53,52,38,35,35,34,6,21,20,22,23,23,20,6,7,38,38,53,52,54,51,51,50,22,
+21,21,33,53,16,33,51,50,22,21,20,6,7,38,38,53,55,54,54,53,52,38,35,35,34,
+6,21,1,21,20,22,51,50,54,54,53,252,172,141,150,173,170,87,119,88,184,172,
+163,108,31,182,170,129,132,12,16,1,75,72,96,114,32,84,110,86,112,136,60,66,
+1,16,12,106,122,201,165,86,195,175,1,103,1,37,234,190,183,126,128,12,16,1,
+80,64,117,130,248,82,83,254,50,41,102,105,80,31,253,154,191,169,184,189,132,
+107,23,248,177,166,237,45,96,107,85,128,39,17,37,19,26,18,54,49,59,60,163,
+156,139,64,48,30,64,26,26,19,37,17,38,127,69,92,121,187,216,171,171,1,147,
+98,110,86,116,37,17,37,19,26,22,51,45,61,53,140,155,254,233,37,156,104,46,
+112,139,0,1,248,162,252,224,0,57,5,22,0,28,0,0,1,6,2,17,16,0,33,32,36,53,
+52,38,35,39,52,55,22,22,21,20,0,33,32,0,17,16,18,55,22,250,92,145,178,1,254,
+1,167,1,97,1,107,120,93,4,26,169,197,254,71,254,74,254,29,253,187,187,174,
+51,4,197,124,254,1,254,218,254,40,254,7,202,189,112,148,38,38,38,2,196,165,
+254,254,249,2,51,2,2,1,80,2,24,153,30,0,3,246,120,251,93,0,111,5,22,0,44,
+0,55,0,63,0,0,1,6,6,35,34,38,53,52,55,36,0,17,16,1,22,23,6,2,17,16,0,5,18,
+0,37,22,21,20,7,34,4,0,7,22,23,54,54,51,50,22,21,20,6,35,32,39,22,51,50,54,
+53,52,38,35,34,6,5,20,22,51,50,55,38,39,252,222,104,143,75,102,120,8,253,
+245,253,189,1,108,51,30,158,168,2,1,1,247,102,2,104,1,42,11,11,87,254,105,
+254,168,68,204,189,156,226,118,193,220,181,187,254,243,154,238,240,105,88,
+165,136,97,194,253,131,64,46,93,110,156,153,251,249,87,69,119,108,43,46,182,
+2,122,1,153,2,117,1,63,30,51,135,254,69,254,238,254,140,253,200,184,1,9,1,
+167,27,44,39,33,53,182,254,242,132,66,37,120,80,134,115,86,82,180,60,26,32,
+56,68,64,79,52,48,69,31,48,0,1,254,182,249,222,0,152,253,104,0,19,0,0,19,
+20,6,35,34,17,53,51,21,20,22,51,50,54,53,17,54,51,50,23,152,124,117,241,170,
+45,55,59,49,24,27,26,27,251,174,251,213,1,147,32,24,141,119,148,189,1,152,
+10,10,0,0,2,0,0,4,157,5,159,7,11,0,23,0,35,0,0,1,6,7,2,36,35,34,6,21,20,22,
+23,23,20,7,34,38,53,52,36,51,50,12,2,6,35,34,38,53,52,54,51,50,22,21,5,159,
+30,51,218,254,116,239,155,173,116,93,4,26,161,203,1,6,223,162,1,51,1,30,254,
+199,115,83,83,116,115,84,83,115,4,240,51,30,1,6,228,90,85,81,120,2,36,41,
+37,177,124,137,184,104,214,193,110,109,78,77,110,110,77,0,1,248,55,251,126,
+255,96,255,216,0,52,0,0,1,20,22,51,50,54,53,17,54,51,50,23,17,20,6,35,34,
+38,53,53,52,38,35,34,6,2,2,6,35,34,36,2,53,16,0,33,22,21,20,7,32,17,20,18,
+51,50,54,18,18,51,50,22,21,254,40,45,55,59,49,24,27,26,27,118,123,118,124,
+74,91,97,100,14,93,180,134,151,254,243,147,1,196,1,163,8,8,253,70,253,161,
+135,131,15,196,164,145,148,253,61,141,119,143,194,1,152,10,10,254,80,239,
+225,202,201,192,138,122,125,254,154,254,243,139,163,1,4,145,1,7,1,27,34,24,
+22,34,254,98,180,254,223,227,1,186,1,0,203,200,0,0,1,248,0,249,222,255,96,
+255,216,0,64,0,0,3,20,6,35,34,17,17,35,34,7,22,22,21,20,6,4,35,32,36,53,52,
+0,36,55,22,21,20,7,35,34,4,2,21,20,22,51,32,36,53,52,38,35,34,7,38,53,52,
+55,54,36,51,50,23,17,20,22,51,50,54,53,17,54,51,50,23,160,118,123,241,44,
+217,209,145,177,137,254,210,228,254,216,254,217,1,32,1,190,239,11,11,6,198,
+254,112,253,246,239,1,8,1,22,146,114,113,123,10,10,160,1,148,201,83,81,45,
+55,59,49,24,27,26,27,251,174,239,225,1,147,2,132,62,10,128,101,88,161,104,
+182,176,176,1,123,223,1,44,40,36,49,184,254,218,135,123,114,129,94,65,79,
+37,23,36,34,21,119,137,12,252,236,141,119,143,194,1,152,10,10,0,1,246,6,251,
+146,255,96,255,216,0,80,0,0,0,38,35,34,2,6,35,34,38,2,53,16,0,33,22,21,20,
+7,32,4,21,20,18,51,50,62,2,51,50,22,21,20,6,21,20,22,51,50,54,18,54,51,50,
+22,21,21,20,22,51,50,54,53,17,54,51,50,23,17,20,6,35,34,38,53,53,52,38,35,
+34,6,2,6,6,35,34,38,53,52,54,53,249,146,23,35,80,76,110,123,115,216,130,1,
+198,1,161,8,8,254,177,254,149,185,119,80,62,49,106,94,82,82,10,40,57,148,
+134,67,160,153,155,146,45,55,59,49,24,27,26,27,118,123,118,124,73,93,86,96,
+43,81,186,159,109,90,13,253,1,40,254,249,140,152,1,3,143,1,1,1,23,34,24,22,
+34,205,189,154,254,211,145,158,86,72,81,38,81,33,53,46,203,1,237,210,201,
+202,192,141,119,143,194,1,152,10,10,254,80,239,225,202,201,192,139,121,136,
+254,122,214,131,74,89,43,89,37,0,1,246,170,249,223,0,135,255,179,0,34,0,0,
+5,6,6,21,16,0,4,33,51,32,36,53,52,38,35,39,52,55,50,22,21,20,4,33,35,32,36,
+0,17,52,54,55,55,51,50,247,43,5,5,1,43,2,89,1,216,188,1,57,1,107,103,44,4,
+26,146,149,254,91,254,108,183,253,229,253,104,254,198,6,7,13,12,50,106,63,
+129,69,254,93,254,60,211,75,54,13,5,36,40,38,55,58,121,147,247,2,12,1,190,
+69,136,68,2,0,0,2,246,120,251,162,0,162,4,188,0,39,0,49,0,0,1,6,0,4,35,34,
+0,0,17,16,18,55,22,23,6,2,17,20,18,0,51,50,36,55,55,54,54,55,17,51,17,50,
+22,21,20,6,35,34,38,53,55,20,22,51,50,54,53,52,38,35,254,182,180,254,50,254,
+183,171,248,254,52,254,252,175,189,51,30,172,154,233,1,142,218,164,1,19,166,
+115,110,202,110,170,167,155,132,121,118,121,170,45,54,56,53,91,117,254,95,
+37,254,242,89,1,41,1,238,1,30,1,58,1,191,187,30,51,161,254,109,254,224,253,
+254,67,254,248,71,95,66,63,72,16,1,86,254,179,200,199,208,220,205,198,8,141,
+119,135,155,155,115,0,0,1,251,234,254,170,255,96,6,101,0,25,0,0,7,20,6,35,
+34,0,2,53,16,18,55,22,23,6,2,17,20,18,22,51,50,54,53,54,51,50,160,165,121,
+148,254,218,158,227,214,51,30,192,211,127,223,104,60,85,27,54,54,58,120,164,
+1,4,1,164,245,1,38,2,33,215,30,51,180,254,15,254,230,212,254,153,217,83,58,
+10,0,2,246,6,251,127,255,96,255,216,0,72,0,83,0,0,1,6,35,34,36,2,53,16,0,
+33,22,21,20,7,32,4,21,20,18,51,50,55,38,53,52,54,51,50,22,21,20,7,22,22,51,
+50,54,18,54,51,32,17,21,20,22,51,50,54,53,17,54,51,50,23,17,20,6,35,34,38,
+53,53,52,38,35,34,6,2,6,6,35,34,38,39,54,53,52,38,35,34,6,21,20,22,249,82,
+128,176,138,255,0,146,1,196,1,163,8,8,254,161,254,165,236,145,97,92,103,125,
+81,80,114,90,68,74,46,96,117,92,174,167,1,42,45,55,59,49,23,28,27,26,118,
+123,118,124,70,89,93,104,59,85,173,121,70,125,80,79,41,30,41,58,51,251,255,
+128,160,1,6,150,1,4,1,25,34,24,22,34,206,197,171,254,208,77,97,104,83,126,
+116,80,100,96,51,32,175,1,238,239,254,109,192,141,119,143,194,1,152,10,10,
+254,80,241,223,201,202,192,131,129,160,254,184,253,133,54,195,60,80,42,48,
+57,33,31,77,0,0,16,244,185,251,102,0,200,255,216,0,75,0,82,0,87,0,93,0,98,
+0,106,0,111,0,119,0,127,0,134,0,143,0,150,0,155,0,163,0,167,0,171,0,0,1,54,
+55,18,51,50,22,23,22,23,54,51,50,22,23,22,23,54,54,51,50,22,21,7,22,22,21,
+20,6,35,38,53,52,55,50,53,52,38,39,22,21,20,6,35,34,39,6,35,34,38,39,33,2,
+35,34,3,33,2,35,34,3,38,53,52,55,53,52,54,51,22,21,20,7,34,6,7,5,38,39,21,
+33,53,52,5,33,53,34,7,7,6,7,21,22,51,33,33,53,38,39,37,38,38,35,34,6,7,54,
+1,38,39,21,51,5,34,39,22,22,51,50,54,5,38,39,35,22,22,51,50,37,22,22,51,50,
+54,55,1,22,23,55,52,38,35,34,6,37,38,38,35,34,7,22,5,6,21,20,23,5,6,7,22,
+51,50,53,52,39,23,54,55,39,38,39,21,246,85,127,148,20,237,124,140,4,148,153,
+56,175,103,137,20,129,116,28,106,66,95,141,6,254,154,146,92,20,15,129,123,
+144,18,108,97,85,60,113,114,137,138,18,254,236,46,217,220,40,254,235,46,217,
+234,30,251,247,162,161,11,11,84,73,1,4,56,140,140,1,18,253,71,1,2,136,122,
+103,175,99,116,158,3,137,1,0,130,126,253,223,5,58,69,58,63,4,122,5,34,93,
+120,213,249,243,143,114,9,54,59,64,60,6,76,25,13,219,18,54,66,64,252,23,11,
+51,58,64,60,11,3,153,107,62,1,49,37,25,45,253,190,13,57,49,79,26,113,250,
+61,122,122,9,70,41,57,26,24,56,221,22,37,29,25,33,55,254,33,24,14,1,145,205,
+181,4,13,218,148,143,26,41,81,87,182,125,72,12,70,104,81,117,25,37,36,17,
+82,36,32,5,45,49,88,88,42,42,135,139,254,238,1,18,254,238,1,49,47,112,115,
+79,79,194,207,53,22,28,46,125,123,121,12,4,247,100,66,166,250,7,7,17,18,194,
+7,188,21,13,143,116,117,95,147,8,254,250,29,27,158,115,10,70,63,62,51,44,
+68,79,44,123,63,60,62,61,1,8,50,48,9,77,107,49,111,55,52,77,12,162,39,40,
+38,21,181,62,45,14,72,22,69,55,24,30,115,20,25,44,0,0,1,249,86,250,46,255,
+126,255,216,0,68,0,0,1,6,35,34,39,53,52,38,39,35,32,36,53,52,0,36,55,22,21,
+20,7,35,34,4,2,21,20,5,38,53,54,51,50,23,20,22,23,51,32,36,53,52,38,35,34,
+7,38,53,52,55,54,36,51,50,23,20,7,38,35,34,7,22,22,21,20,6,7,22,21,252,215,
+51,33,34,51,61,70,6,254,216,254,217,1,32,1,190,239,11,11,6,198,254,112,253,
+1,28,16,26,30,29,30,46,50,6,1,8,1,22,143,117,113,123,10,10,160,1,148,201,
+83,81,28,76,110,217,209,147,175,233,190,62,250,62,16,16,28,116,130,23,182,
+176,176,1,123,223,1,44,40,36,49,184,254,218,135,183,41,46,72,10,10,58,62,
+11,129,94,65,79,37,23,36,34,21,119,137,12,67,101,16,62,10,129,100,122,182,
+30,88,192,0,2,250,35,251,102,0,241,255,216,0,52,0,61,0,0,19,6,35,34,39,38,
+38,39,17,35,17,33,21,20,6,35,34,38,53,17,51,17,20,22,51,50,54,53,53,38,38,
+53,52,54,55,22,22,21,6,6,21,20,22,51,53,52,54,51,32,17,21,50,22,37,33,53,
+52,38,35,34,6,21,241,37,20,24,34,16,140,130,170,254,97,208,187,190,171,170,
+107,130,125,110,192,160,128,152,17,10,100,66,97,113,201,176,1,67,175,201,
+252,62,1,160,88,106,118,104,252,41,8,8,153,148,10,254,26,1,232,167,161,180,
+195,208,2,203,253,61,139,121,79,94,185,6,91,103,96,121,45,22,47,30,26,56,
+49,59,61,53,216,248,254,109,113,205,205,105,142,118,162,175,0,1,244,63,252,
+224,0,57,5,22,0,31,0,0,1,6,2,21,16,0,0,33,32,36,53,52,38,35,39,53,52,55,50,
+22,21,16,0,33,32,0,0,17,16,18,55,22,245,189,115,148,1,103,2,144,1,181,2,190,
+2,106,118,97,1,25,162,204,253,20,253,39,254,33,253,46,254,124,158,143,51,
+4,197,95,254,85,229,254,177,253,242,254,228,221,220,89,111,16,15,47,36,177,
+134,254,237,254,218,1,56,2,60,1,115,1,15,1,192,128,30,0,255,255,0,80,251,
+162,13,197,4,94,0,34,0,66,0,0,0,3,0,99,5,30,0,0,255,255,0,80,251,162,13,197,
+7,108,0,34,0,67,0,0,0,3,0,99,5,30,0,0,255,255,0,80,251,162,12,229,4,94,0,
+34,0,66,0,0,0,3,0,106,5,30,0,0,255,255,0,80,251,162,12,229,7,108,0,34,0,67,
+0,0,0,3,0,106,5,30,0,0,255,255,0,80,251,162,11,74,4,94,0,34,0,66,0,0,0,3,
+0,109,5,30,0,0,255,255,0,80,251,162,11,74,7,108,0,34,0,67,0,0,0,3,0,109,5,
+30,0,0,255,255,0,80,251,162,13,111,4,94,0,34,0,66,0,0,0,3,0,125,5,70,0,0,
+255,255,0,80,251,162,13,111,7,108,0,34,0,67,0,0,0,3,0,125,5,70,0,0,0,2,248,
+162,251,162,0,162,5,22,0,33,0,43,0,0,37,51,17,50,22,21,20,6,35,34,38,53,53,
+14,2,35,32,0,2,17,16,1,22,23,0,17,16,18,4,51,50,0,55,19,20,22,51,50,54,53,
+52,38,35,254,182,170,167,155,132,121,118,121,56,186,229,151,254,255,254,77,
+242,1,105,51,30,254,189,210,1,123,226,227,1,50,89,170,45,54,56,53,91,117,
+42,254,179,200,199,208,220,205,198,244,41,190,111,1,30,1,237,1,55,2,156,1,
+101,30,51,254,210,253,141,254,233,254,66,250,1,62,44,254,126,141,119,135,
+155,155,115,0,0,2,244,63,251,162,0,162,5,22,0,36,0,46,0,0,39,17,50,22,21,
+20,6,35,34,38,53,17,6,0,4,35,32,0,0,17,16,18,55,22,23,6,2,21,16,0,0,33,50,
+36,0,55,17,19,20,22,51,50,54,53,52,38,35,160,167,155,132,121,118,121,162,
+254,62,254,115,236,254,112,253,109,254,137,158,143,51,30,115,148,1,82,2,89,
+1,120,216,1,103,1,202,212,170,45,54,56,53,91,117,42,254,179,200,199,208,220,
+205,198,1,42,34,254,254,106,1,64,2,74,1,108,1,15,1,192,128,30,51,95,254,85,
+229,254,191,253,236,254,214,87,1,8,30,1,86,253,19,141,119,135,155,155,115,
+0,0,3,244,63,251,93,0,111,5,22,0,43,0,54,0,62,0,0,5,22,21,20,7,34,4,0,7,5,
+54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,53,55,0,17,16,18,55,22,23,6,
+2,21,16,0,5,54,0,36,3,22,51,50,54,53,52,38,35,34,6,5,20,22,51,50,54,55,37,
+254,223,11,11,89,254,82,254,196,53,1,99,160,242,118,193,220,181,187,99,228,
+218,104,143,75,192,4,249,95,158,143,51,30,115,148,3,11,3,55,55,1,54,1,176,
+189,238,240,105,88,165,136,97,194,253,161,35,45,48,92,50,254,244,40,44,39,
+33,53,195,254,236,132,79,116,79,134,115,86,82,30,52,87,69,227,68,1,162,3,
+161,1,15,1,192,128,30,51,95,254,85,229,254,96,253,141,212,178,1,72,222,252,
+148,60,26,32,56,68,64,79,53,47,44,34,59,0,0,3,248,106,251,93,0,111,4,228,
+0,45,0,56,0,66,0,0,1,0,17,16,0,5,54,0,36,51,22,21,20,7,34,4,4,7,22,23,54,
+54,51,50,22,21,20,6,35,32,37,6,6,35,34,53,52,55,38,0,2,53,16,18,55,22,1,22,
+51,50,54,53,52,38,35,34,6,5,38,39,6,21,20,22,51,50,54,250,36,254,189,1,9,
+1,52,74,1,70,1,137,168,11,11,84,254,108,254,209,68,154,169,135,228,160,193,
+220,181,187,254,243,254,236,104,143,75,192,21,255,254,249,129,182,179,51,
+3,82,238,240,105,88,165,136,97,194,254,171,132,123,11,35,45,52,84,4,147,254,
+175,253,233,254,188,254,49,199,151,1,49,191,44,39,33,53,179,242,118,86,57,
+108,87,134,115,86,82,82,87,69,227,77,75,161,1,48,1,129,255,1,35,1,214,194,
+30,247,149,60,26,32,56,68,64,108,49,68,50,38,53,47,35,0,0,2,0,25,253,136,
+5,238,4,94,0,46,0,66,0,0,33,35,17,52,38,35,34,6,21,21,20,6,35,34,0,35,34,
+21,20,22,23,22,22,21,20,7,38,38,53,52,54,51,50,30,2,51,50,54,53,53,52,54,
+51,50,22,21,1,6,35,34,39,53,52,46,2,53,54,51,50,23,20,30,2,21,5,238,170,71,
+94,105,95,129,110,119,254,254,123,105,41,26,4,4,8,72,109,136,101,72,137,101,
+102,68,75,62,183,158,148,150,254,100,51,33,34,51,78,195,71,26,30,29,30,66,
+197,135,2,195,134,126,160,178,246,187,216,1,36,88,43,45,2,17,29,13,23,32,
+2,115,78,87,115,51,104,109,142,179,220,219,245,203,200,250,205,16,16,28,130,
+131,42,107,108,10,10,66,67,16,149,212,0,3,249,224,249,192,0,108,255,216,0,
+57,0,67,0,86,0,0,5,54,51,50,22,21,17,51,50,54,53,54,51,50,22,23,20,6,35,35,
+21,20,6,33,34,36,53,52,36,33,17,52,38,35,34,6,21,21,6,35,34,39,53,52,38,35,
+34,6,7,6,35,34,39,52,54,51,50,22,1,4,4,21,20,22,51,50,54,53,1,6,6,35,34,38,
+53,17,51,17,20,22,51,50,54,55,54,51,50,253,19,84,204,152,149,46,48,60,32,
+23,13,29,17,131,100,37,253,254,237,240,254,229,1,206,1,163,73,85,109,100,
+30,23,21,30,97,99,111,81,4,30,23,21,30,151,148,81,128,1,203,254,161,254,155,
+180,181,205,142,254,144,6,230,206,220,208,170,141,159,130,150,5,26,30,29,
+232,192,180,173,253,193,52,42,8,4,4,89,118,90,234,195,144,115,166,208,2,54,
+107,103,131,145,11,8,6,4,143,142,119,166,8,6,216,222,98,252,81,4,132,104,
+82,83,130,197,1,244,154,165,203,200,2,3,254,5,130,130,82,86,10,0,3,249,224,
+249,147,1,56,255,216,0,84,0,103,0,113,0,0,5,54,51,50,22,21,17,22,22,21,20,
+6,7,22,22,21,20,6,35,34,38,39,54,54,51,50,23,22,22,51,50,54,53,52,38,35,38,
+38,53,52,55,50,54,53,52,38,35,21,20,6,33,34,36,53,52,36,33,17,52,38,35,34,
+6,21,21,6,35,34,39,53,52,38,35,34,6,7,6,35,34,39,52,54,51,50,22,19,6,6,35,
+34,38,53,17,51,17,20,22,51,50,54,55,54,51,50,1,4,4,21,20,22,51,50,54,53,253,
+19,84,204,152,149,247,178,33,56,85,51,147,111,110,117,2,12,28,17,40,11,5,
+48,60,48,61,102,97,6,3,9,68,88,114,158,253,254,237,240,254,229,1,206,1,163,
+73,85,109,100,30,23,21,30,97,99,111,81,4,30,23,21,30,151,148,81,128,91,6,
+230,206,220,208,170,141,159,130,150,5,26,30,29,1,142,254,161,254,155,180,
+181,205,142,232,192,180,173,253,194,10,83,98,50,49,32,31,63,47,91,124,94,
+82,5,3,8,40,35,43,48,56,47,7,8,16,32,21,61,46,50,28,90,234,195,144,115,166,
+208,2,54,107,103,131,145,11,8,6,4,143,142,119,166,8,6,216,222,98,253,247,
+154,165,203,200,2,3,254,5,130,130,82,86,10,254,80,4,132,104,82,83,130,197,
+0,0,3,247,179,249,2,0,97,255,216,0,72,0,92,0,103,0,0,1,17,51,17,51,17,52,
+18,51,50,22,23,51,54,54,51,50,22,21,17,20,22,51,50,22,21,20,6,7,38,53,52,
+54,55,54,54,53,52,35,35,34,38,53,17,52,38,35,34,6,21,17,35,17,52,38,35,34,
+6,21,17,51,50,22,21,20,6,35,34,38,53,53,35,17,1,6,35,34,39,53,52,46,2,53,
+54,51,50,23,20,30,2,23,1,20,22,51,50,54,53,52,38,35,35,247,179,170,247,206,
+173,120,160,39,8,48,128,91,162,145,104,149,134,138,107,74,8,4,4,26,41,113,
+153,168,147,76,87,122,90,170,99,104,132,116,73,78,109,113,74,76,111,247,3,
+123,51,33,34,51,78,195,71,26,30,29,30,67,192,137,2,253,238,43,30,30,43,43,
+30,73,251,122,4,74,253,43,1,25,208,1,0,96,88,94,90,200,203,254,188,167,129,
+115,95,75,120,2,32,23,13,29,17,2,45,42,89,189,214,1,68,149,111,166,195,253,
+162,2,195,123,137,165,173,255,0,114,81,82,116,118,80,84,254,250,253,152,16,
+16,28,130,131,42,107,108,10,10,68,66,15,140,221,2,246,36,52,52,36,36,48,0,
+2,248,156,251,160,2,109,6,169,0,65,0,74,0,0,5,6,6,21,20,22,51,50,36,51,50,
+22,51,50,54,54,53,17,38,38,53,52,54,51,50,18,17,21,22,22,21,20,6,35,38,38,
+53,52,54,55,54,54,53,52,38,39,17,16,6,33,34,38,35,34,4,35,32,0,53,52,54,54,
+55,22,22,23,1,16,38,35,34,6,21,20,22,250,28,82,122,209,231,111,1,41,112,75,
+228,120,160,171,72,196,225,148,104,145,138,216,217,200,154,4,4,4,4,89,87,
+129,126,232,254,227,102,230,98,93,254,212,160,254,242,254,202,114,197,69,
+15,14,3,6,9,77,83,57,63,152,215,50,218,152,195,180,75,75,65,144,152,6,100,
+45,238,155,119,161,254,229,254,197,20,47,206,157,111,148,17,29,12,11,28,17,
+3,77,94,106,117,31,249,175,254,249,200,85,85,1,9,220,121,214,149,10,8,29,
+20,5,35,1,0,216,70,75,119,178,0,2,250,249,251,65,255,136,255,216,0,30,0,43,
+0,0,1,6,35,34,38,53,52,54,51,50,22,21,16,0,33,34,0,17,52,18,55,22,23,6,2,
+21,20,22,51,50,18,19,52,38,35,34,6,21,20,22,51,50,54,55,254,219,45,53,146,
+166,152,126,131,174,254,185,254,205,237,254,216,135,124,62,2,98,108,231,206,
+201,222,20,79,77,64,75,109,95,24,46,21,253,198,17,142,130,121,154,229,203,
+254,150,254,131,1,59,1,6,167,1,66,108,5,56,85,254,231,167,223,237,1,7,1,102,
+157,157,86,67,85,93,7,6,255,255,249,157,251,102,255,131,255,217,0,3,0,38,
+248,248,251,122,255,255,249,247,251,101,255,96,255,216,0,3,0,43,249,72,251,
+122,0,2,245,113,251,102,255,96,255,226,0,88,0,99,0,0,1,52,38,35,34,6,21,17,
+35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,7,
+6,6,35,34,38,53,52,54,51,50,23,51,54,54,51,50,23,51,54,54,51,50,23,51,54,
+54,51,50,22,21,17,20,22,51,50,54,53,17,35,34,38,53,52,54,51,50,22,21,17,20,
+6,35,34,38,53,1,53,52,38,35,34,6,21,20,22,51,253,14,58,87,88,73,170,69,86,
+105,86,170,69,86,102,79,170,72,86,102,85,2,8,43,18,14,21,166,154,203,64,8,
+42,106,83,207,63,8,47,111,80,193,68,8,54,99,77,139,139,77,87,91,54,84,80,
+118,116,82,82,117,148,129,149,168,1,223,48,36,36,46,46,36,254,61,144,116,
+124,173,253,98,2,195,129,131,153,191,253,145,2,195,129,131,146,215,253,162,
+2,195,129,131,127,210,2,6,5,8,240,243,184,94,90,184,104,80,161,98,63,202,
+201,254,188,135,125,123,180,1,64,111,76,74,113,111,76,253,232,198,227,210,
+193,1,229,73,30,43,43,30,30,43,255,255,0,106,251,162,6,94,4,94,0,34,0,7,0,
+0,0,3,0,11,3,232,0,0,255,255,0,106,0,0,6,140,4,94,0,34,0,7,0,0,0,3,0,60,3,
+232,0,0,255,255,0,106,255,236,6,46,4,94,0,34,0,7,0,0,0,3,0,61,3,242,0,0,255,
+255,0,106,251,162,4,227,4,29,0,34,0,7,0,0,0,3,0,64,4,76,0,0,255,255,0,106,
+251,162,5,61,4,29,0,34,0,7,0,0,0,3,0,65,4,76,0,0,255,255,0,80,251,162,8,156,
+4,94,0,35,0,7,4,242,0,0,0,2,0,66,0,0,255,255,0,80,251,162,8,156,7,108,0,34,
+0,67,0,0,0,3,0,7,4,242,0,0,255,255,0,106,252,7,6,206,4,29,0,34,0,7,0,0,0,
+3,0,69,6,84,0,0,255,255,0,106,251,162,7,155,4,94,0,34,0,7,0,0,0,3,0,70,4,
+76,0,0,255,255,0,120,252,224,8,15,5,22,0,35,0,7,3,88,0,0,0,3,0,128,7,214,
+0,0,255,255,0,0,251,162,6,248,4,94,0,34,0,7,0,0,0,2,0,72,0,0,0,3,0,0,4,124,
+4,22,7,143,0,15,0,26,0,38,0,0,19,38,39,16,0,33,50,4,21,17,7,38,36,35,34,6,
+39,54,51,50,4,23,53,52,38,35,32,4,6,35,34,38,53,52,54,51,50,22,21,90,89,1,
+1,31,1,5,233,1,9,49,124,254,151,123,84,143,45,109,145,108,1,16,125,163,172,
+254,133,1,234,72,48,48,71,69,50,50,70,4,204,71,2,1,41,1,81,229,196,254,231,
+81,78,117,55,134,68,78,69,153,159,156,233,66,66,46,45,68,68,45,0,3,0,1,4,
+124,4,23,7,202,0,21,0,37,0,49,0,0,19,16,0,33,50,23,54,51,50,22,21,7,22,21,
+17,7,38,36,35,34,6,7,1,32,3,54,51,50,4,23,53,52,39,6,35,34,38,53,6,6,35,34,
+38,53,52,54,51,50,22,21,1,1,33,1,22,38,9,60,88,82,116,3,89,49,124,254,151,
+123,84,143,72,1,195,254,132,44,107,147,104,1,12,133,23,43,48,81,118,12,72,
+48,48,71,69,50,50,70,5,21,1,43,1,79,3,62,113,74,29,104,164,254,231,81,78,
+117,55,60,2,71,254,123,68,76,71,153,80,64,20,112,78,232,66,66,46,45,68,68,
+45,0,0,2,0,0,4,124,5,45,8,58,0,25,0,36,0,0,1,6,2,7,7,38,36,35,34,6,7,38,39,
+16,0,33,50,22,23,54,54,55,54,51,50,22,1,54,51,50,4,23,53,52,38,35,32,5,45,
+112,147,20,49,124,254,151,123,84,143,72,89,1,1,31,1,5,163,219,57,34,93,63,
+12,13,39,80,251,76,109,145,108,1,16,125,163,172,254,133,7,252,145,254,46,
+204,81,78,117,55,60,71,2,1,41,1,81,107,93,97,187,84,3,39,253,123,68,78,69,
+153,159,156,0,2,0,1,4,124,5,45,8,58,0,31,0,47,0,0,1,6,2,7,7,38,36,35,34,6,
+7,39,16,0,33,50,23,54,51,50,22,21,7,22,23,54,54,55,54,51,50,22,1,32,3,54,
+51,50,4,23,53,52,39,6,35,34,38,53,5,45,109,148,21,49,124,254,151,123,84,143,
+72,90,1,33,1,22,38,9,60,88,82,116,3,15,15,33,93,63,12,13,39,80,252,245,254,
+132,44,107,147,104,1,12,133,23,43,48,81,118,7,252,141,254,49,211,81,78,117,
+55,60,73,1,43,1,79,3,62,113,74,29,18,23,97,186,83,3,39,255,0,254,123,68,76,
+71,153,80,64,20,112,78,0,0,1,0,0,4,157,5,195,8,58,0,33,0,0,1,6,2,7,6,7,38,
+36,35,34,6,21,20,22,23,6,6,7,38,38,53,52,54,51,50,4,23,54,18,55,54,51,50,
+22,5,195,115,152,10,25,42,181,254,180,198,129,114,98,76,4,24,20,118,185,227,
+177,163,1,68,165,33,139,99,12,13,39,80,7,252,150,254,56,180,47,28,245,216,
+86,79,74,103,4,29,63,25,6,167,110,130,179,156,187,198,1,89,130,3,39,0,2,246,
+120,249,194,0,162,255,206,0,42,0,52,0,0,5,6,6,21,20,18,0,51,50,36,55,55,54,
+54,55,53,51,21,50,22,21,20,6,35,34,38,53,53,6,0,4,35,34,0,0,17,52,54,55,54,
+51,50,22,1,20,22,51,50,54,53,52,38,35,247,14,17,14,235,1,142,216,160,1,18,
+171,115,104,200,118,170,151,171,133,120,118,121,181,254,58,254,184,179,246,
+254,54,254,248,20,22,24,16,27,30,8,93,45,54,57,52,105,103,95,78,167,91,253,
+254,65,254,250,68,98,66,60,74,17,172,163,167,142,133,155,205,198,68,37,254,
+245,92,1,38,1,239,1,32,106,193,91,6,27,251,170,140,120,72,78,91,89,0,1,252,
+87,247,246,3,79,4,94,0,48,0,0,1,51,21,16,4,21,20,22,51,50,54,54,53,17,52,
+54,51,50,22,21,17,20,51,22,21,20,7,32,17,17,52,38,35,34,6,21,17,20,4,33,32,
+36,53,52,62,3,53,254,182,170,253,106,222,202,176,216,100,195,161,145,150,
+91,11,11,254,251,71,94,111,91,254,231,254,187,254,246,254,239,109,186,212,
+100,252,5,159,254,234,104,197,87,99,69,134,151,8,198,212,249,199,204,246,
+104,168,46,28,22,53,1,53,9,152,134,126,166,171,247,77,242,219,155,148,114,
+140,78,43,96,122,0,0,1,253,71,247,246,4,23,4,94,0,48,0,0,19,20,6,4,6,21,20,
+22,51,50,54,54,53,17,52,54,51,50,22,21,17,20,51,22,21,20,7,32,17,17,52,38,
+35,34,6,21,17,20,6,33,32,36,53,52,54,54,36,54,53,100,136,254,163,197,215,
+209,162,199,91,195,161,145,150,91,11,11,254,251,71,94,111,91,254,254,200,
+254,241,254,244,105,207,1,24,88,251,30,117,105,74,124,97,84,92,68,133,153,
+8,198,212,249,199,204,246,104,168,46,28,22,53,1,53,9,152,134,126,166,171,
+247,77,251,210,148,145,88,138,97,62,56,74,0,0,1,246,170,250,7,0,100,255,179,
+0,28,0,0,5,6,6,21,16,0,4,33,33,32,54,54,55,51,14,2,33,33,32,36,0,17,52,54,
+55,55,51,50,247,43,5,5,1,34,2,81,1,220,1,9,1,4,206,158,6,117,2,114,252,254,
+219,254,200,253,218,253,110,254,203,6,7,13,12,50,106,63,129,69,254,95,254,
+82,195,18,64,77,105,117,57,232,1,248,1,185,69,136,68,2,0,1,251,20,251,75,
+3,179,4,94,0,43,0,0,1,6,6,21,20,4,33,50,36,54,53,17,52,54,51,50,22,21,17,
+20,51,22,21,20,7,32,17,17,52,38,35,34,6,21,17,16,4,33,32,36,53,52,54,55,251,
+192,20,23,1,36,1,95,249,1,36,141,195,161,145,150,91,11,11,254,251,71,82,114,
+100,254,145,254,86,254,84,254,165,26,20,253,58,32,76,42,116,114,76,162,186,
+5,43,212,249,199,204,249,196,168,46,28,22,53,1,53,6,60,139,121,157,180,250,
+232,254,215,234,168,172,47,80,34,0,1,252,144,251,75,3,179,4,94,0,42,0,0,1,
+6,6,21,20,22,51,32,36,53,17,52,54,51,50,22,21,17,20,51,22,21,20,7,32,17,17,
+52,38,35,34,6,21,17,16,0,33,32,36,53,52,54,55,253,60,20,23,204,199,1,21,1,
+9,195,161,145,150,91,11,11,254,251,71,82,114,100,254,196,254,175,254,248,
+254,241,26,20,253,58,32,76,42,115,115,190,234,5,43,212,249,199,204,249,196,
+168,46,28,22,53,1,53,6,60,139,121,157,180,250,232,254,239,254,254,172,168,
+47,80,34,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,
+94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,
+0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,32,0,248,0,3,0,1,4,
+9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,9,0,9,0,40,1,134,0,3,
+0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,11,0,62,2,14,0,3,0,1,4,9,0,12,0,60,
+2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,0,1,4,9,0,14,0,52,5,30,0,67,0,111,0,
+112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,
+0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,
+108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,
+114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,
+115,0,32,0,74,0,97,0,118,0,97,0,110,0,101,0,115,0,101,0,82,0,101,0,103,0,
+117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,74,0,97,0,118,0,97,0,110,0,101,0,115,
+0,101,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,54,0,
+32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,74,0,97,0,118,
+0,97,0,110,0,101,0,115,0,101,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,
+0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,
+0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,
+105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,
+97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,
+101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,
+98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,
+101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,
+0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,
+0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,
+0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,
+0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,
+79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,186,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,
+12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,
+1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,
+1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,
+1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,
+1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,
+1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,
+101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,
+1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,
+126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,
+1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,
+151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,
+1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,
+176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,4,110,117,108,108,4,90,
+87,83,80,7,117,110,105,50,48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,
+50,53,67,67,12,106,118,95,80,97,110,121,97,110,103,103,97,8,106,118,95,67,
+101,99,97,107,6,106,118,95,76,97,121,6,106,118,95,87,105,103,4,106,118,95,
+65,5,106,118,95,73,107,4,106,118,95,73,5,106,118,95,73,73,4,106,118,95,85,
+7,106,118,95,118,111,99,82,7,106,118,95,118,111,99,76,8,106,118,95,118,111,
+99,76,76,4,106,118,95,69,5,106,118,95,65,73,4,106,118,95,79,5,106,118,95,
+75,97,5,106,118,95,81,97,8,106,118,95,75,97,95,109,117,5,106,118,95,71,97,
+8,106,118,95,71,97,95,109,117,6,106,118,95,78,103,97,5,106,118,95,67,97,8,
+106,118,95,67,97,95,109,117,5,106,118,95,74,97,9,106,118,95,78,121,97,95,
+109,117,6,106,118,95,74,104,97,6,106,118,95,78,121,97,6,106,118,95,84,104,
+97,7,106,118,95,84,116,104,97,6,106,118,95,68,100,97,7,106,118,95,68,100,
+104,97,8,106,118,95,78,97,95,109,117,5,106,118,95,84,97,8,106,118,95,84,97,
+95,109,117,5,106,118,95,68,97,6,106,118,95,68,104,97,5,106,118,95,78,97,5,
+106,118,95,80,97,8,106,118,95,80,97,95,109,117,5,106,118,95,66,97,8,106,118,
+95,66,97,95,109,117,5,106,118,95,77,97,5,106,118,95,89,97,5,106,118,95,82,
+97,10,106,118,95,82,97,65,103,117,110,103,5,106,118,95,76,97,5,106,118,95,
+87,97,8,106,118,95,83,97,95,109,117,9,106,118,95,83,115,97,95,109,117,5,106,
+118,95,83,97,5,106,118,95,72,97,5,106,118,95,67,84,7,106,118,95,118,95,97,
+97,6,106,118,95,118,95,111,6,106,118,95,118,95,105,7,106,118,95,118,95,105,
+105,6,106,118,95,118,95,117,7,106,118,95,118,95,117,117,6,106,118,95,118,
+95,101,7,106,118,95,118,95,97,105,7,106,118,95,118,95,97,101,9,106,118,95,
+99,95,118,111,99,82,10,106,118,95,99,95,109,101,100,89,97,10,106,118,95,99,
+95,109,101,100,82,97,10,106,118,95,80,97,110,103,107,111,110,8,106,118,95,
+82,101,114,95,108,8,106,118,95,82,101,114,95,114,7,106,118,95,112,95,65,110,
+7,106,118,95,112,95,77,97,8,106,118,95,112,95,76,117,104,7,106,118,95,112,
+95,87,105,7,106,118,95,112,95,80,97,7,106,118,95,112,95,76,105,8,106,118,
+95,112,95,76,117,110,7,106,118,95,112,95,65,100,9,106,118,95,112,95,65,100,
+65,100,16,106,118,95,112,95,80,105,115,101,108,101,104,79,112,101,110,17,
+106,118,95,112,95,80,105,115,101,108,101,104,67,108,111,115,101,14,106,118,
+95,80,97,110,103,114,97,110,103,107,101,112,7,106,118,95,122,101,114,111,
+6,106,118,95,111,110,101,6,106,118,95,116,119,111,8,106,118,95,116,104,114,
+101,101,7,106,118,95,102,111,117,114,7,106,118,95,102,105,118,101,6,106,118,
+95,115,105,120,8,106,118,95,115,101,118,101,110,8,106,118,95,101,105,103,
+104,116,7,106,118,95,110,105,110,101,9,106,118,95,112,95,84,105,84,117,9,
+106,118,95,112,95,73,115,73,115,9,106,118,95,72,97,95,112,97,115,9,106,118,
+95,78,97,95,112,97,115,9,106,118,95,67,97,95,112,97,115,9,106,118,95,82,97,
+95,112,97,115,9,106,118,95,75,97,95,112,97,115,9,106,118,95,68,97,95,112,
+97,115,9,106,118,95,84,97,95,112,97,115,9,106,118,95,83,97,95,112,97,115,
+9,106,118,95,87,97,95,112,97,115,9,106,118,95,76,97,95,112,97,115,9,106,118,
+95,80,97,95,112,97,115,10,106,118,95,68,100,97,95,112,97,115,9,106,118,95,
+74,97,95,112,97,115,9,106,118,95,89,97,95,112,97,115,10,106,118,95,78,121,
+97,95,112,97,115,9,106,118,95,77,97,95,112,97,115,9,106,118,95,71,97,95,112,
+97,115,9,106,118,95,66,97,95,112,97,115,10,106,118,95,84,104,97,95,112,97,
+115,10,106,118,95,78,103,97,95,112,97,115,12,106,118,95,78,103,97,95,112,
+97,115,95,117,12,106,118,95,78,97,95,109,117,95,112,97,115,12,106,118,95,
+75,97,95,109,117,95,112,97,115,12,106,118,95,84,97,95,109,117,95,112,97,115,
+12,106,118,95,83,97,95,109,117,95,112,97,115,13,106,118,95,83,115,97,95,109,
+117,95,112,97,115,12,106,118,95,80,97,95,109,117,95,112,97,115,12,106,118,
+95,71,97,95,109,117,95,112,97,115,12,106,118,95,66,97,95,109,117,95,112,97,
+115,16,106,118,95,99,95,109,101,100,82,97,95,115,109,97,108,108,15,106,118,
+95,68,97,95,112,97,115,95,109,101,100,82,97,10,106,118,95,118,95,117,95,97,
+108,116,13,106,118,95,118,95,97,101,95,67,101,99,97,107,11,106,118,95,87,
+97,95,112,97,115,95,117,11,106,118,95,74,97,95,112,97,115,95,117,12,106,118,
+95,68,100,97,95,112,97,115,95,117,14,106,118,95,99,95,109,101,100,82,97,95,
+115,117,98,12,106,118,95,99,95,109,101,100,82,97,95,117,15,106,118,95,99,
+95,109,101,100,82,97,95,115,117,98,50,12,106,118,95,84,104,97,95,112,97,115,
+95,117,12,106,118,95,67,97,95,109,117,95,112,97,115,13,106,118,95,78,121,
+97,95,109,117,95,112,97,115,17,106,118,95,83,115,97,95,109,117,95,112,97,
+115,95,97,108,116,16,106,118,95,99,95,109,101,100,82,97,95,108,97,114,103,
+101,11,106,118,95,72,97,95,112,97,115,95,101,12,106,118,95,72,97,95,112,97,
+115,95,97,105,11,106,118,95,83,97,95,112,97,115,95,101,12,106,118,95,83,97,
+95,112,97,115,95,97,105,11,106,118,95,80,97,95,112,97,115,95,101,12,106,118,
+95,80,97,95,112,97,115,95,97,105,14,106,118,95,80,97,95,109,117,95,112,97,
+115,95,101,15,106,118,95,80,97,95,109,117,95,112,97,115,95,97,105,18,106,
+118,95,99,95,109,101,100,82,97,95,117,95,115,109,97,108,108,18,106,118,95,
+99,95,109,101,100,82,97,95,117,95,108,97,114,103,101,21,106,118,95,68,97,
+95,112,97,115,95,109,101,100,82,97,95,108,97,114,103,101,21,106,118,95,68,
+97,95,112,97,115,95,109,101,100,82,97,95,115,109,97,108,108,11,106,118,95,
+118,111,99,82,95,112,97,115,11,106,118,95,118,111,99,76,95,112,97,115,12,
+106,118,95,118,111,99,76,76,95,112,97,115,9,106,118,95,81,97,95,112,97,115,
+10,106,118,95,74,104,97,95,112,97,115,11,106,118,95,84,116,104,97,95,112,
+97,115,11,106,118,95,68,100,104,97,95,112,97,115,10,106,118,95,68,104,97,
+95,112,97,115,14,106,118,95,82,97,65,103,117,110,103,95,112,97,115,11,117,
+110,105,50,53,67,67,65,57,56,51,11,117,110,105,50,53,67,67,65,57,66,52,11,
+117,110,105,50,53,67,67,65,57,66,53,11,117,110,105,50,53,67,67,65,57,66,56,
+11,117,110,105,50,53,67,67,65,57,66,57,11,117,110,105,50,53,67,67,65,57,66,
+65,11,117,110,105,50,53,67,67,65,57,66,66,11,117,110,105,50,53,67,67,65,57,
+66,68,11,117,110,105,50,53,67,67,65,57,66,69,11,117,110,105,50,53,67,67,65,
+57,66,70,11,117,110,105,50,53,67,67,65,57,67,48,12,106,118,95,118,95,105,
+95,67,101,99,97,107,13,106,118,95,118,95,105,105,95,67,101,99,97,107,10,106,
+118,95,118,95,105,95,76,97,121,11,106,118,95,118,95,105,105,95,76,97,121,
+11,106,118,95,118,95,97,101,95,76,97,121,16,106,118,95,99,95,109,101,100,
+82,97,95,117,95,115,117,98,14,106,118,95,99,95,109,101,100,89,97,95,115,117,
+98,15,106,118,95,99,95,109,101,100,89,97,95,115,117,98,50,15,106,118,95,99,
+95,109,101,100,82,97,95,115,117,98,51,18,106,118,95,99,95,109,101,100,89,
+97,95,97,102,116,101,114,82,97,21,106,118,95,99,95,109,101,100,89,97,95,97,
+102,116,101,114,82,97,46,115,109,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,
+12,0,0,0,148,0,0,0,2,0,22,0,0,0,7,0,1,0,8,0,10,0,3,0,11,0,58,0,1,0,59,0,59,
+0,3,0,60,0,61,0,1,0,62,0,65,0,3,0,66,0,67,0,1,0,68,0,71,0,3,0,72,0,99,0,1,
+0,100,0,105,0,3,0,106,0,106,0,1,0,107,0,108,0,3,0,109,0,109,0,1,0,110,0,124,
+0,3,0,125,0,125,0,1,0,126,0,142,0,3,0,143,0,150,0,1,0,151,0,154,0,3,0,155,
+0,155,0,1,0,156,0,163,0,3,0,164,0,174,0,1,0,175,0,185,0,3,0,4,0,0,0,1,0,0,
+0,1,0,0,0,10,0,58,0,170,0,2,68,70,76,84,0,14,106,97,118,97,0,32,0,4,0,0,0,
+0,255,255,0,4,0,0,0,2,0,3,0,5,0,4,0,0,0,0,255,255,0,3,0,1,0,4,0,6,0,7,100,
+105,115,116,0,44,100,105,115,116,0,52,107,101,114,110,0,58,109,97,114,107,
+0,64,109,97,114,107,0,74,109,107,109,107,0,84,109,107,109,107,0,98,0,0,0,
+2,0,0,0,1,0,0,0,1,0,1,0,0,0,1,0,2,0,0,0,3,0,3,0,4,0,5,0,0,0,3,0,3,0,4,0,5,
+0,0,0,5,0,6,0,7,0,8,0,9,0,10,0,0,0,5,0,6,0,7,0,8,0,9,0,10,0,12,0,26,0,34,
+0,42,0,50,0,58,0,66,0,74,0,82,0,90,0,98,0,106,0,114,0,2,0,8,0,1,0,96,0,2,
+0,0,0,1,2,180,0,8,0,0,0,1,4,40,0,4,0,0,0,1,4,92,0,4,0,0,0,1,5,98,0,4,0,0,
+0,1,6,132,0,6,0,0,0,1,8,62,0,6,0,0,0,1,9,12,0,6,0,0,0,1,10,68,0,6,0,0,0,1,
+10,176,0,6,0,0,0,1,10,216,0,1,0,0,0,1,10,252,0,1,2,82,0,1,0,1,0,47,2,12,0,
+160,2,26,2,26,0,160,2,40,0,160,2,54,2,68,2,68,1,198,0,104,0,104,0,118,0,132,
+0,146,0,160,0,174,0,188,0,202,0,202,0,216,0,230,0,244,0,244,1,2,1,16,1,30,
+1,44,1,2,1,58,1,2,1,72,1,86,1,100,1,114,1,128,1,86,1,142,1,156,1,170,1,184,
+1,198,1,212,1,226,1,240,1,254,0,2,0,66,5,132,247,142,0,67,5,132,247,142,0,
+2,0,66,5,132,248,74,0,67,5,132,248,74,0,2,0,66,5,132,248,100,0,67,5,132,248,
+100,0,2,0,66,5,132,247,118,0,67,5,132,247,118,0,2,0,66,5,132,249,64,0,67,
+5,132,249,64,0,2,0,66,5,132,248,222,0,67,5,132,248,222,0,2,0,66,5,132,244,
+194,0,67,5,132,244,194,0,2,0,66,5,132,249,110,0,67,5,132,249,110,0,2,0,66,
+5,132,245,202,0,67,5,132,245,202,0,2,0,66,5,132,245,11,0,67,5,132,245,11,
+0,2,0,66,5,132,249,59,0,67,5,132,249,59,0,2,0,66,5,132,249,72,0,67,5,132,
+249,72,0,2,0,66,5,132,248,253,0,67,5,132,248,253,0,2,0,66,5,132,246,71,0,
+67,5,132,246,71,0,2,0,66,5,132,247,161,0,67,5,132,247,161,0,2,0,66,5,132,
+249,209,0,67,5,132,249,209,0,2,0,66,5,132,249,203,0,67,5,132,249,203,0,2,
+0,66,5,132,249,254,0,67,5,132,249,254,0,2,0,66,5,132,248,122,0,67,5,132,248,
+122,0,2,0,66,5,132,247,35,0,67,5,132,247,35,0,2,0,66,5,132,247,48,0,67,5,
+132,247,48,0,2,0,66,5,132,247,204,0,67,5,132,247,204,0,2,0,66,5,132,250,119,
+0,67,5,132,250,119,0,2,0,66,5,132,245,33,0,67,5,132,245,33,0,2,0,66,5,132,
+248,34,0,67,5,132,248,34,0,2,0,66,5,132,249,166,0,67,5,132,249,166,0,2,0,
+66,5,132,247,32,0,67,5,132,247,32,0,2,0,66,5,132,248,57,0,67,5,132,248,57,
+0,2,0,66,5,132,249,16,0,67,5,132,249,16,0,2,0,66,5,132,247,129,0,67,5,132,
+247,129,0,2,0,66,5,132,243,132,0,67,5,132,243,132,0,2,0,66,5,132,247,42,0,
+67,5,132,247,42,0,2,0,66,5,132,250,3,0,67,5,132,250,3,0,2,0,66,5,132,246,
+231,0,67,5,132,246,231,0,2,0,66,5,132,250,19,0,67,5,132,250,19,0,2,0,1,0,
+12,0,58,0,0,0,1,1,78,0,5,0,5,0,44,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,
+0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,
+0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,98,0,180,0,
+180,0,252,0,252,0,252,0,252,0,252,0,252,0,8,0,71,2,188,2,188,0,0,0,0,0,128,
+1,164,1,164,0,0,0,0,0,129,1,144,1,144,0,0,0,0,0,136,3,32,3,32,0,0,0,0,0,142,
+1,144,1,144,0,0,0,0,0,151,1,144,1,144,0,0,0,0,0,153,2,8,2,8,0,0,0,0,0,154,
+1,194,1,194,0,0,0,0,0,7,0,71,3,232,0,0,3,232,3,232,0,128,2,88,0,0,2,88,2,
+88,0,129,3,232,0,0,3,232,3,232,0,136,3,232,0,0,3,232,3,232,0,142,5,220,0,
+0,5,220,5,220,0,151,1,144,1,144,0,0,0,0,0,154,2,88,0,0,2,88,2,88,0,8,0,71,
+2,188,2,188,0,0,0,0,0,128,0,100,0,100,0,0,0,0,0,129,0,200,0,200,0,0,0,0,0,
+136,1,244,1,244,0,0,0,0,0,142,1,244,1,244,0,0,0,0,0,151,0,200,0,200,0,0,0,
+0,0,153,1,144,1,144,0,0,0,0,0,154,0,100,0,100,0,0,0,0,0,2,0,7,0,23,0,58,0,
+0,0,66,0,67,0,36,0,99,0,99,0,38,0,106,0,106,0,39,0,109,0,109,0,40,0,124,0,
+125,0,41,0,155,0,155,0,43,0,3,0,1,0,18,0,1,0,52,0,0,0,1,0,0,0,11,0,2,0,5,
+0,71,0,71,0,0,0,128,0,129,0,1,0,135,0,137,0,3,0,142,0,142,0,6,0,151,0,154,
+0,7,0,1,0,2,0,66,0,67,0,1,0,178,0,218,0,1,0,12,0,66,0,13,0,0,6,228,0,0,6,
+234,0,0,6,240,0,0,6,246,0,0,6,252,0,0,6,252,0,0,7,2,0,0,7,2,0,0,6,252,0,0,
+6,252,0,0,9,210,0,0,9,210,0,0,7,2,0,55,8,184,6,234,7,38,6,222,6,222,7,44,
+7,62,7,68,7,68,7,50,7,56,6,240,6,210,6,210,6,216,6,210,6,222,6,228,6,216,
+6,234,6,240,6,240,6,246,6,252,6,228,6,228,6,228,6,228,7,2,6,210,6,228,6,240,
+6,228,6,240,6,240,7,8,7,14,6,210,7,20,6,210,7,20,7,26,6,216,6,240,6,210,6,
+228,6,216,7,32,9,168,7,74,7,80,7,80,7,80,7,86,7,80,0,2,0,6,0,8,0,10,0,0,0,
+59,0,59,0,3,0,62,0,63,0,4,0,68,0,68,0,6,0,131,0,131,0,7,0,175,0,179,0,8,0,
+2,0,8,0,7,0,7,0,0,0,12,0,58,0,1,0,60,0,60,0,48,0,99,0,99,0,49,0,106,0,106,
+0,50,0,109,0,109,0,51,0,124,0,125,0,52,0,155,0,155,0,54,0,1,0,224,1,2,0,2,
+0,12,0,54,0,10,0,0,6,132,0,0,6,138,0,0,6,144,0,0,6,150,0,1,7,86,0,0,6,156,
+0,0,6,150,0,0,6,150,0,0,6,150,0,0,6,150,0,42,6,120,6,108,6,120,6,108,6,126,
+6,108,6,132,6,108,6,138,6,108,6,144,6,108,6,150,6,108,6,156,6,108,6,162,6,
+108,6,162,6,108,6,168,6,108,6,174,6,108,6,144,6,108,6,144,6,108,6,180,6,108,
+6,186,6,108,6,192,6,108,6,198,6,108,6,204,6,108,6,210,6,108,6,204,6,108,6,
+216,6,108,6,222,6,108,6,228,6,108,6,234,6,108,6,240,6,108,6,222,6,108,6,246,
+6,108,6,252,6,108,7,2,6,108,7,8,6,108,7,14,6,108,7,20,6,108,7,26,6,108,7,
+32,6,108,7,38,6,108,9,30,6,108,9,24,6,108,9,18,6,108,9,18,6,108,9,12,6,108,
+9,6,6,108,0,2,0,5,0,71,0,71,0,0,0,128,0,129,0,1,0,136,0,137,0,3,0,142,0,142,
+0,5,0,151,0,154,0,6,0,2,0,6,0,23,0,58,0,0,0,99,0,99,0,36,0,106,0,106,0,37,
+0,109,0,109,0,38,0,124,0,125,0,39,0,155,0,155,0,41,0,1,1,96,1,154,0,2,0,12,
+0,182,0,42,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,
+0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,
+108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,1,5,108,
+0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,1,5,108,0,1,
+5,108,0,1,5,108,0,1,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,
+0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,0,5,108,0,42,4,206,6,
+84,4,206,6,90,4,212,6,96,4,218,5,76,4,224,6,102,4,230,6,108,4,236,6,108,4,
+242,6,84,4,248,6,108,4,248,6,114,4,254,6,120,5,4,6,126,4,230,6,132,4,230,
+6,108,5,10,6,108,5,16,6,108,5,22,6,138,5,28,6,102,5,34,6,144,5,40,6,108,5,
+34,6,108,5,46,6,108,5,52,6,108,5,58,5,76,5,64,6,84,5,70,6,102,5,52,6,108,
+5,76,6,102,5,82,6,108,5,88,6,138,5,94,6,150,5,100,6,108,5,106,5,76,5,112,
+6,96,5,118,6,108,5,124,6,102,7,116,7,122,7,110,7,122,7,104,7,122,7,104,7,
+122,7,98,7,122,7,92,7,122,0,2,0,9,0,64,0,65,0,0,0,69,0,69,0,2,0,100,0,105,
+0,3,0,107,0,108,0,9,0,110,0,123,0,11,0,126,0,127,0,25,0,132,0,134,0,27,0,
+138,0,141,0,30,0,156,0,163,0,34,0,2,0,6,0,23,0,58,0,0,0,99,0,99,0,36,0,106,
+0,106,0,37,0,109,0,109,0,38,0,124,0,125,0,39,0,155,0,155,0,41,0,1,0,160,0,
+168,0,2,0,12,0,22,0,2,0,0,3,170,0,1,3,170,0,34,3,160,3,160,6,28,3,160,3,160,
+3,160,3,160,3,160,6,28,3,160,3,160,3,160,3,160,3,160,3,160,3,160,3,160,3,
+160,3,160,3,160,3,160,3,160,6,34,3,160,3,160,3,160,3,160,3,160,3,160,3,160,
+3,160,3,160,3,160,3,160,3,160,3,160,3,160,3,160,6,40,3,160,3,160,3,160,3,
+160,3,160,6,46,3,160,3,160,3,160,3,160,3,160,3,160,3,160,3,160,3,160,3,160,
+3,160,3,160,3,160,6,52,3,160,3,160,3,160,3,160,3,160,3,160,3,160,3,160,3,
+160,0,1,0,2,0,181,0,182,0,2,0,7,0,100,0,105,0,0,0,107,0,108,0,6,0,110,0,118,
+0,8,0,120,0,123,0,17,0,126,0,127,0,21,0,139,0,141,0,23,0,156,0,163,0,26,0,
+1,0,240,1,18,0,3,0,12,0,34,0,5,0,0,4,36,0,0,4,36,0,0,3,154,0,1,3,244,0,2,
+2,212,0,34,3,138,3,228,2,190,3,144,2,190,2,190,3,132,2,190,5,4,3,150,3,234,
+4,38,3,156,2,190,2,190,3,162,3,240,4,254,3,168,3,246,5,10,3,174,3,252,5,16,
+3,180,3,246,5,22,3,186,2,190,2,190,3,132,2,190,5,4,3,192,2,190,2,190,3,138,
+2,190,5,22,3,132,2,190,5,4,3,132,2,190,5,4,3,138,2,190,5,22,3,132,2,190,5,
+4,3,132,2,190,5,4,3,138,2,190,5,4,3,198,2,190,5,10,3,132,2,190,5,4,3,132,
+2,190,5,4,3,204,4,2,5,28,3,210,2,190,5,34,3,216,2,190,5,40,3,132,2,190,2,
+190,4,20,4,38,5,46,4,26,4,38,5,46,4,32,4,44,4,38,4,50,2,190,5,52,4,56,2,190,
+2,190,4,62,2,190,2,190,4,68,2,190,5,4,4,74,2,190,5,4,0,2,0,5,0,65,0,65,0,
+0,0,69,0,69,0,1,0,130,0,130,0,2,0,135,0,135,0,3,0,180,0,180,0,4,0,2,0,7,0,
+100,0,105,0,0,0,107,0,108,0,6,0,110,0,118,0,8,0,120,0,123,0,17,0,126,0,127,
+0,21,0,139,0,141,0,23,0,156,0,163,0,26,0,1,0,70,0,110,0,1,0,12,0,66,0,13,
+0,0,3,116,0,0,3,122,0,0,3,128,0,0,3,134,0,0,3,140,0,0,3,140,0,0,3,146,0,0,
+3,152,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,140,0,0,3,200,0,1,3,56,0,2,0,6,
+0,8,0,10,0,0,0,59,0,59,0,3,0,62,0,63,0,4,0,68,0,68,0,6,0,131,0,131,0,7,0,
+175,0,179,0,8,0,1,0,1,0,59,0,1,0,26,0,32,0,1,0,12,0,18,0,1,0,0,3,0,0,3,3,
+36,3,48,3,42,0,1,0,1,0,8,0,2,0,2,0,62,0,63,0,0,0,68,0,68,0,2,0,1,0,28,0,36,
+0,1,0,12,0,22,0,2,0,0,3,18,0,0,3,18,0,2,3,2,3,14,0,1,0,2,0,64,0,65,0,1,0,
+2,0,69,0,70,0,1,0,8,0,1,254,112,0,1,0,2,0,66,0,67,0,1,2,98,5,20,0,1,0,200,
+4,136,0,1,1,224,4,176,0,1,1,164,4,136,0,1,1,244,4,96,0,1,2,218,4,136,0,1,
+4,76,4,176,0,1,3,232,4,176,0,1,4,136,4,176,0,1,3,112,4,176,0,1,5,200,4,176,
+0,1,3,52,4,176,0,1,2,148,4,176,0,1,5,160,4,176,0,1,5,80,4,176,0,1,3,182,4,
+176,0,1,4,156,4,176,0,1,3,12,4,176,0,1,5,100,4,176,0,1,4,96,4,176,0,1,3,132,
+4,176,0,1,3,92,4,176,0,1,2,168,4,176,0,1,2,168,7,168,0,1,3,32,4,176,0,1,3,
+152,4,176,0,1,6,44,4,176,0,1,4,176,4,176,0,1,6,164,4,176,0,1,255,244,255,
+231,0,1,255,236,255,236,0,1,0,50,0,0,0,1,0,0,0,0,0,1,0,0,255,236,0,1,8,114,
+0,0,0,1,7,48,0,0,0,1,7,161,0,0,0,1,8,138,0,0,0,1,6,197,0,0,0,1,7,34,0,0,0,
+1,10,170,255,236,0,1,6,146,0,0,0,1,7,41,251,160,0,1,10,245,0,0,0,1,6,231,
+0,0,0,1,6,104,0,0,0,1,9,185,0,0,0,1,8,95,0,0,0,1,6,184,0,0,0,1,6,47,0,0,0,
+1,6,53,0,0,0,1,6,2,0,0,0,1,7,216,0,0,0,1,8,221,0,0,0,1,7,196,0,0,0,1,8,52,
+0,0,0,1,5,137,0,0,0,1,10,140,0,0,0,1,7,222,0,0,0,1,6,90,0,0,0,1,7,154,0,0,
+0,1,6,125,0,0,0,1,6,240,0,0,0,1,8,126,0,0,0,1,254,12,255,206,0,1,255,96,251,
+230,0,1,255,96,252,174,0,1,0,5,252,174,0,1,0,60,251,30,0,1,255,250,253,70,
+0,1,0,60,250,246,0,1,255,206,252,74,0,1,0,38,251,30,0,1,255,96,252,194,0,
+1,253,223,252,29,0,1,255,96,252,164,0,1,0,192,252,174,0,1,254,122,251,230,
+0,1,0,104,251,230,0,1,252,226,250,145,0,1,0,160,255,176,0,1,0,0,0,140,0,1,
+0,99,255,58,0,1,0,99,255,91,0,1,0,0,0,100,0,1,1,8,255,25,0,1,255,46,0,75,
+0,1,2,16,5,20,0,1,255,96,0,150,0,1,255,96,251,30,0,1,0,160,249,242,0,1,0,
+0,250,236,0,1,0,0,254,212,0,1,0,121,254,212,0,1,0,110,252,89,0,1,254,193,
+252,34,0,1,254,160,251,224,0,1,255,91,251,224,0,1,254,237,251,224,0,1,8,252,
+0,0,0,1,8,252,253,188,0,1,8,2,0,0,0,1,8,152,0,0,0,1,7,108,0,0,0,1,7,108,254,
+32,0,1,8,52,252,24,0,1,10,240,0,0,0,1,7,208,254,212,0,1,9,96,0,0,0,1,7,108,
+254,112,0,1,7,208,0,0,0,1,1,144,7,208,0,1,2,88,5,70,0,1,0,200,4,176,0,1,1,
+244,5,120,0,1,1,164,4,206,0,1,1,244,4,226,0,1,2,138,5,220,0,1,2,228,4,176,
+0,1,2,28,7,248,0,1,2,68,7,158,0,1,2,28,8,32,0,1,253,88,252,24,0,1,255,116,
+0,0,0,1,255,102,251,158,0,1,2,28,4,96,0,1,2,188,4,176,0,1,1,24,4,136,0,1,
+0,198,253,237,0,1,0,0,255,156,0,1,0,0,255,36,0,1,0,187,253,248,0,1,0,0,255,
+56,0,1,255,26,254,215,0,1,255,124,254,204,0,1,253,75,254,215,0,1,0,0,254,
+112,0,1,0,44,255,25,0,1,0,200,0,0,0,1,4,16,0,0,0,1,1,44,0,0,0,1,255,36,0,
+0,0,1,1,144,0,0,0,1,6,142,0,0,0,1,8,201,0,0,0,1,6,203,0,0,0,1,6,204,0,0,0,
+1,9,71,0,0,0,1,8,102,0,0,0,0,0,1,0,0,0,10,0,56,0,190,0,2,68,70,76,84,0,14,
+106,97,118,97,0,30,0,4,0,0,0,0,255,255,0,3,0,0,0,2,0,4,0,4,0,0,0,0,255,255,
+0,3,0,1,0,3,0,5,0,6,99,99,109,112,0,38,99,99,109,112,0,76,108,105,103,97,
+0,110,108,105,103,97,0,116,115,97,108,116,0,122,115,97,108,116,0,128,0,0,
+0,17,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,
+0,16,0,0,0,15,0,0,0,1,0,2,0,3,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,
+15,0,16,0,0,0,1,0,17,0,0,0,1,0,17,0,0,0,1,0,18,0,0,0,1,0,18,0,30,0,62,0,70,
+0,78,0,86,0,94,0,102,0,110,0,118,0,126,0,134,0,142,0,150,0,158,0,166,0,174,
+0,182,0,190,0,198,0,206,0,214,0,222,0,230,0,238,0,246,0,254,1,6,1,14,1,22,
+1,30,1,38,0,4,0,0,0,1,0,240,0,4,0,0,0,1,2,48,0,6,0,0,0,1,2,78,0,4,0,0,0,1,
+2,102,0,4,0,0,0,1,2,176,0,2,0,0,0,1,3,26,0,6,0,0,0,1,3,98,0,6,0,0,0,1,3,160,
+0,6,0,0,0,1,3,244,0,6,0,0,0,1,4,48,0,6,0,0,0,1,4,112,0,6,0,0,0,1,4,134,0,
+6,0,0,0,1,4,178,0,6,0,0,0,1,4,252,0,6,0,0,0,1,5,40,0,6,0,0,0,1,5,64,0,4,0,
+0,0,1,5,86,0,4,0,0,0,1,5,182,0,1,0,0,0,1,6,6,0,1,0,0,0,1,6,12,0,1,0,0,0,1,
+6,18,0,1,0,0,0,1,6,24,0,1,0,0,0,1,6,50,0,1,0,0,0,1,6,76,0,1,0,0,0,1,6,86,
+0,1,0,0,0,1,6,92,0,1,0,0,0,1,6,98,0,1,0,0,0,1,6,104,0,1,0,0,0,1,6,110,0,1,
+0,0,0,1,6,116,0,1,1,66,0,1,0,8,0,39,0,80,0,86,0,92,0,98,0,104,0,110,0,116,
+0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,188,0,
+194,0,200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,254,1,4,1,10,
+1,16,1,22,1,28,1,34,1,40,1,46,1,52,0,103,0,2,0,23,0,121,0,2,0,25,0,115,0,
+2,0,26,0,126,0,2,0,27,0,118,0,2,0,28,0,101,0,2,0,29,0,139,0,2,0,30,0,111,
+0,2,0,31,0,113,0,2,0,34,0,140,0,2,0,32,0,117,0,2,0,35,0,110,0,2,0,37,0,120,
+0,2,0,39,0,105,0,2,0,40,0,122,0,2,0,41,0,104,0,2,0,42,0,100,0,2,0,44,0,109,
+0,2,0,45,0,125,0,2,0,46,0,116,0,2,0,47,0,127,0,2,0,48,0,114,0,2,0,49,0,112,
+0,2,0,50,0,102,0,2,0,51,0,108,0,2,0,53,0,107,0,2,0,54,0,123,0,2,0,55,0,124,
+0,2,0,56,0,106,0,2,0,57,0,99,0,2,0,58,0,155,0,2,0,17,0,156,0,2,0,18,0,157,
+0,2,0,19,0,158,0,2,0,24,0,159,0,2,0,33,0,160,0,2,0,36,0,161,0,2,0,38,0,162,
+0,2,0,43,0,163,0,2,0,52,0,1,0,1,0,72,0,1,0,30,0,2,0,10,0,20,0,1,0,4,0,136,
+0,2,0,64,0,1,0,4,0,129,0,2,0,71,0,1,0,2,0,71,0,104,0,3,0,0,0,1,0,18,0,1,0,
+24,0,1,0,0,0,19,0,1,0,1,0,124,0,1,0,2,0,66,0,67,0,1,0,66,0,3,0,12,0,30,0,
+48,0,2,0,6,0,12,0,175,0,2,0,9,0,177,0,2,0,10,0,2,0,6,0,12,0,176,0,2,0,9,0,
+178,0,2,0,10,0,2,0,6,0,12,0,131,0,2,0,9,0,179,0,2,0,10,0,2,0,2,0,62,0,63,
+0,0,0,68,0,68,0,2,0,1,0,86,0,4,0,14,0,32,0,50,0,68,0,2,0,6,0,12,0,143,0,2,
+0,66,0,144,0,2,0,67,0,2,0,6,0,12,0,145,0,2,0,66,0,146,0,2,0,67,0,2,0,6,0,
+12,0,147,0,2,0,66,0,148,0,2,0,67,0,2,0,6,0,12,0,149,0,2,0,66,0,150,0,2,0,
+67,0,2,0,4,0,99,0,99,0,0,0,106,0,106,0,1,0,109,0,109,0,2,0,125,0,125,0,3,
+0,1,0,70,0,8,0,22,0,28,0,34,0,40,0,46,0,52,0,58,0,64,0,2,0,66,0,99,0,2,0,
+67,0,99,0,2,0,66,0,106,0,2,0,67,0,106,0,2,0,66,0,109,0,2,0,67,0,109,0,2,0,
+66,0,125,0,2,0,67,0,125,0,2,0,1,0,143,0,150,0,0,0,3,0,1,0,18,0,1,0,64,0,0,
+0,1,0,0,0,20,0,2,0,7,0,100,0,105,0,0,0,107,0,108,0,6,0,110,0,118,0,8,0,120,
+0,123,0,17,0,126,0,127,0,21,0,139,0,141,0,23,0,156,0,163,0,26,0,1,0,1,0,64,
+0,3,0,1,0,18,0,1,0,70,0,0,0,1,0,0,0,21,0,2,0,8,0,28,0,29,0,0,0,31,0,33,0,
+2,0,35,0,37,0,5,0,41,0,45,0,8,0,49,0,49,0,13,0,51,0,51,0,14,0,54,0,54,0,15,
+0,57,0,57,0,16,0,2,0,3,0,71,0,71,0,0,0,129,0,129,0,1,0,136,0,136,0,2,0,3,
+0,1,0,18,0,1,0,46,0,0,0,1,0,0,0,22,0,2,0,4,0,30,0,30,0,0,0,34,0,34,0,1,0,
+39,0,39,0,2,0,52,0,52,0,3,0,2,0,3,0,71,0,71,0,0,0,129,0,129,0,1,0,136,0,136,
+0,2,0,3,0,1,0,18,0,1,0,64,0,0,0,1,0,0,0,23,0,2,0,7,0,100,0,105,0,0,0,107,
+0,108,0,6,0,110,0,118,0,8,0,120,0,123,0,17,0,126,0,127,0,21,0,139,0,141,0,
+23,0,156,0,163,0,26,0,1,0,2,0,71,0,136,0,3,0,1,0,18,0,1,0,24,0,0,0,1,0,0,
+0,24,0,1,0,1,0,139,0,1,0,1,0,135,0,3,0,1,0,18,0,1,0,46,0,0,0,1,0,0,0,25,0,
+2,0,4,0,103,0,103,0,0,0,105,0,105,0,1,0,108,0,108,0,2,0,158,0,158,0,3,0,1,
+0,1,0,135,0,3,0,1,0,18,0,1,0,76,0,0,0,1,0,0,0,26,0,2,0,9,0,100,0,102,0,0,
+0,104,0,104,0,3,0,107,0,107,0,4,0,110,0,118,0,5,0,120,0,123,0,14,0,126,0,
+127,0,18,0,139,0,141,0,20,0,156,0,157,0,23,0,159,0,163,0,25,0,1,0,1,0,70,
+0,3,0,1,0,18,0,1,0,46,0,0,0,1,0,0,0,27,0,2,0,4,0,103,0,103,0,0,0,105,0,105,
+0,1,0,108,0,108,0,2,0,158,0,158,0,3,0,1,0,1,0,70,0,3,0,1,0,18,0,1,0,26,0,
+0,0,1,0,0,0,28,0,1,0,2,0,71,0,142,0,1,0,1,0,70,0,3,0,1,0,18,0,1,0,24,0,0,
+0,1,0,0,0,29,0,1,0,1,0,128,0,1,0,1,0,70,0,1,0,98,0,1,0,8,0,11,0,24,0,30,0,
+36,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,84,0,164,0,2,0,11,0,165,0,2,0,60,
+0,166,0,2,0,61,0,167,0,2,0,64,0,168,0,2,0,65,0,169,0,2,0,66,0,170,0,2,0,67,
+0,171,0,2,0,69,0,172,0,2,0,70,0,173,0,2,0,71,0,174,0,2,0,72,0,1,0,1,0,7,0,
+1,0,66,0,5,0,16,0,26,0,36,0,46,0,56,0,1,0,4,0,132,0,2,0,130,0,1,0,4,0,134,
+0,2,0,130,0,1,0,4,0,133,0,2,0,130,0,1,0,4,0,138,0,2,0,130,0,1,0,4,0,119,0,
+2,0,130,0,2,0,3,0,107,0,107,0,0,0,110,0,111,0,1,0,117,0,118,0,3,0,2,0,8,0,
+1,0,141,0,1,0,1,0,124,0,2,0,8,0,1,0,141,0,1,0,1,0,124,0,2,0,8,0,1,0,130,0,
+1,0,1,0,64,0,2,0,12,0,3,0,128,0,154,0,151,0,2,0,3,0,71,0,71,0,0,0,129,0,129,
+0,1,0,136,0,136,0,2,0,2,0,12,0,3,0,142,0,153,0,152,0,2,0,3,0,71,0,71,0,0,
+0,129,0,129,0,1,0,136,0,136,0,2,0,2,0,10,0,2,0,135,0,180,0,1,0,2,0,71,0,136,
+0,2,0,8,0,1,0,137,0,1,0,1,0,135,0,2,0,8,0,1,0,183,0,1,0,1,0,135,0,2,0,8,0,
+1,0,181,0,1,0,1,0,70,0,2,0,8,0,1,0,182,0,1,0,1,0,70,0,2,0,8,0,1,0,184,0,1,
+0,1,0,70,0,2,0,8,0,1,0,185,0,1,0,1,0,70,0,0,};
+#endif
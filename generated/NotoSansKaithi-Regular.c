@@ -0,0 +1,2481 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansKaithi_Regular_ttf_size = 62524;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansKaithi_Regular_ttf");
+asm(".type fz_font_NotoSansKaithi_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansKaithi_Regular_ttf, 62524");
+asm(".balign 64");
+asm("fz_font_NotoSansKaithi_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansKaithi-Regular.ttf\"");
+#else
+const int fz_font_NotoSansKaithi_Regular_ttf_size = 62524;
+const char fz_font_NotoSansKaithi_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,54,212,54,206,0,0,181,28,0,0,4,14,
+71,80,79,83,6,239,185,246,0,0,185,44,0,0,10,162,71,83,85,66,52,81,225,3,0,
+0,195,208,0,0,48,108,79,83,47,50,123,102,109,105,0,0,1,104,0,0,0,96,99,109,
+97,112,105,213,23,211,0,0,6,176,0,0,1,0,103,97,115,112,0,7,0,7,0,0,181,16,
+0,0,0,12,103,108,121,102,107,209,26,31,0,0,10,40,0,0,152,224,104,101,97,100,
+12,178,45,30,0,0,0,236,0,0,0,54,104,104,101,97,20,216,250,214,0,0,1,36,0,
+0,0,36,104,109,116,120,215,159,90,108,0,0,1,200,0,0,4,232,108,111,99,97,53,
+128,16,20,0,0,7,176,0,0,2,118,109,97,120,112,1,74,0,179,0,0,1,72,0,0,0,32,
+110,97,109,101,140,70,184,134,0,0,163,8,0,0,6,0,112,111,115,116,122,197,43,
+32,0,0,169,8,0,0,12,6,0,1,0,0,0,1,12,205,115,242,58,38,95,15,60,245,0,11,
+8,0,0,0,0,0,206,232,154,164,0,0,0,0,210,113,59,121,251,36,252,153,17,21,8,
+157,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,157,252,153,0,0,12,34,251,36,240,224,
+17,21,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,58,0,1,0,0,1,58,0,103,0,6,0,74,0,
+7,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,5,0,1,144,0,5,0,0,5,154,5,51,0,
+0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,255,255,8,157,252,153,0,0,8,157,
+3,103,0,0,0,1,0,0,0,0,4,250,4,250,0,0,0,32,0,8,4,205,0,193,0,0,0,0,2,38,0,
+0,2,38,0,0,0,0,253,25,0,0,254,182,1,207,0,100,4,243,0,80,6,226,0,80,4,37,
+0,120,4,37,0,120,4,4,0,70,5,207,0,70,4,141,0,150,4,137,0,60,6,236,0,80,6,
+236,0,80,6,13,0,95,5,217,0,130,4,221,0,80,4,214,0,140,4,231,0,150,4,125,0,
+60,6,7,0,130,5,147,0,131,4,180,0,85,5,39,0,50,4,117,0,100,4,70,0,100,4,192,
+0,100,4,192,0,100,4,167,0,100,4,167,0,100,5,245,0,180,4,128,0,120,4,175,0,
+90,3,141,0,120,4,194,0,120,4,208,0,90,4,83,0,160,5,159,0,94,4,139,0,90,5,
+31,0,110,4,202,0,145,4,111,0,90,3,159,0,70,4,196,0,110,4,149,0,100,5,71,0,
+120,4,43,0,150,5,161,0,120,4,32,0,120,1,249,0,170,1,245,0,180,2,4,254,133,
+0,0,251,36,0,0,252,141,0,0,251,190,0,0,251,190,1,255,253,138,1,239,253,118,
+0,0,0,149,0,0,254,182,3,228,0,160,8,102,0,120,8,102,0,120,1,249,0,180,3,137,
+0,180,7,229,0,95,6,13,0,95,6,13,0,95,4,211,0,145,4,224,0,145,5,40,0,110,5,
+52,0,110,3,157,0,70,3,170,0,70,5,226,0,130,5,239,0,130,6,91,0,160,4,62,0,
+160,4,76,0,160,5,170,0,120,5,183,0,120,1,255,0,180,0,0,251,230,0,0,251,190,
+7,183,0,30,6,252,0,80,4,223,0,80,4,236,0,80,6,139,0,100,5,217,0,130,6,103,
+0,95,4,221,0,80,1,255,253,138,1,239,253,118,7,255,0,130,5,197,0,70,7,185,
+0,130,7,236,0,130,4,52,0,120,4,33,0,120,7,199,0,120,4,134,0,60,4,148,0,90,
+5,218,0,120,4,22,0,90,4,4,0,160,4,98,0,130,4,44,0,100,4,165,0,65,4,117,0,
+160,4,48,0,140,5,83,0,40,5,149,0,120,5,149,0,120,4,88,0,160,6,13,0,95,4,85,
+0,160,3,125,0,80,4,223,0,140,4,235,0,140,6,252,0,140,5,4,0,140,4,146,0,60,
+6,163,0,60,5,156,0,130,5,168,0,130,5,202,0,130,5,10,0,130,4,110,0,10,6,151,
+0,40,6,120,0,110,6,52,0,100,6,157,0,100,6,110,0,100,6,166,0,120,6,213,0,90,
+5,201,0,120,6,232,0,120,6,246,0,90,7,69,0,110,6,240,0,145,6,149,0,90,6,153,
+0,110,6,187,0,100,7,109,0,120,6,81,0,150,6,157,0,100,4,180,0,60,6,110,0,100,
+8,27,0,180,5,254,0,180,5,245,0,180,6,12,0,180,4,137,0,120,4,128,0,120,4,217,
+0,90,4,203,0,120,4,210,0,90,4,229,0,90,4,149,0,120,4,184,0,90,4,175,0,90,
+4,197,0,90,4,194,0,120,4,214,0,120,4,124,0,160,4,143,0,90,7,89,0,94,6,177,
+0,90,4,161,0,90,5,17,0,110,4,213,0,145,4,120,0,90,4,111,0,90,4,133,0,90,3,
+148,0,70,4,158,0,100,4,149,0,100,4,172,0,100,5,80,0,120,5,71,0,120,5,94,0,
+120,4,52,0,150,4,43,0,150,4,66,0,150,5,161,0,120,4,223,0,95,4,134,0,130,3,
+113,0,140,3,26,0,60,9,47,0,95,8,182,0,95,6,13,0,95,4,181,0,40,3,154,0,130,
+4,96,0,180,2,120,0,120,3,127,0,90,3,101,0,120,2,250,0,90,3,2,0,160,3,255,
+0,94,3,61,0,90,3,82,0,110,3,123,0,145,3,32,0,90,3,70,0,100,3,248,0,120,2,
+91,0,150,3,197,0,120,4,117,0,100,5,178,0,180,5,178,0,180,1,245,0,180,1,245,
+0,180,1,245,0,180,1,245,0,180,9,110,0,95,1,245,0,180,1,245,0,180,1,245,0,
+180,1,245,0,180,1,245,0,180,1,245,0,180,1,245,0,180,1,245,0,180,1,245,0,180,
+1,245,0,180,1,245,0,180,1,245,0,180,1,245,0,180,7,229,0,95,11,148,0,95,11,
+85,0,95,10,220,0,95,7,229,0,95,5,217,0,130,4,214,0,140,4,125,0,60,4,175,0,
+90,4,194,0,120,4,139,0,90,4,202,0,145,4,43,0,150,5,161,0,120,5,31,0,110,5,
+147,0,130,6,126,0,160,6,123,0,160,6,219,0,40,6,110,0,100,7,213,0,110,3,213,
+0,50,9,251,0,110,9,252,0,95,4,128,0,120,6,166,0,120,12,34,0,95,7,255,0,130,
+6,252,0,140,6,163,0,60,6,213,0,90,6,232,0,120,6,177,0,90,6,240,0,145,6,81,
+0,150,7,69,0,110,7,185,0,130,7,199,0,120,4,149,0,100,6,187,0,100,8,177,0,
+100,1,245,0,180,4,231,0,150,6,7,0,130,4,180,0,85,4,117,0,100,4,70,0,100,4,
+192,0,100,4,192,0,100,4,167,0,100,4,167,0,100,3,141,0,120,3,159,0,70,4,196,
+0,110,4,32,0,120,1,245,0,180,0,0,0,5,0,0,0,5,0,0,0,5,0,0,0,0,4,104,0,153,
+4,104,1,7,4,104,0,173,4,104,0,184,4,104,0,130,4,104,0,172,4,104,0,211,4,104,
+0,78,4,104,0,148,4,104,0,145,1,229,0,160,3,127,0,160,5,25,0,160,4,250,0,81,
+4,250,0,81,4,250,0,81,3,174,0,137,4,18,0,117,2,116,254,191,2,179,254,191,
+0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,108,0,4,0,88,0,0,0,18,0,16,0,3,0,
+2,0,0,0,13,0,32,0,57,0,160,9,111,168,57,254,255,255,255,0,0,0,0,0,13,0,32,
+0,48,0,160,9,102,168,48,254,255,255,255,0,1,255,245,255,227,0,246,255,99,
+247,5,89,0,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,148,
+0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,0,0,0,
+32,0,0,0,32,0,0,0,3,0,0,0,48,0,0,0,57,0,0,1,38,0,0,0,160,0,0,0,160,0,0,0,
+3,0,0,9,102,0,0,9,111,0,0,0,107,0,0,168,48,0,0,168,57,0,0,1,48,0,0,254,255,
+0,0,254,255,0,0,0,1,0,1,16,128,0,1,16,189,0,0,0,4,0,1,16,190,0,1,16,191,0,
+0,0,214,0,1,16,192,0,1,16,193,0,0,0,66,0,0,0,21,0,21,0,21,0,21,0,68,0,93,
+0,131,0,197,1,15,1,91,1,188,1,249,2,74,2,119,2,174,3,0,3,98,3,174,3,235,4,
+28,4,87,4,144,4,200,5,37,5,89,5,170,5,235,6,29,6,104,6,166,6,245,7,64,7,156,
+7,197,7,243,8,61,8,113,8,162,8,221,9,9,9,109,9,163,9,233,10,45,10,123,10,
+153,10,224,11,36,11,116,11,168,11,246,12,62,12,81,12,116,12,157,12,196,12,
+238,13,4,13,42,13,68,13,109,13,127,13,153,13,193,13,252,14,55,14,68,14,88,
+14,183,15,28,15,127,15,220,16,61,16,157,17,0,17,54,17,114,17,200,18,35,18,
+91,18,158,18,230,19,75,19,183,19,218,20,16,20,54,20,120,20,182,21,0,21,77,
+21,142,21,214,22,54,22,115,22,127,22,139,22,213,23,2,23,70,23,185,24,21,24,
+117,24,210,25,29,25,105,25,197,25,241,26,29,26,99,26,182,26,240,27,20,27,
+96,27,159,27,217,28,42,28,101,28,229,29,19,29,52,29,126,29,206,30,21,30,85,
+30,160,30,227,31,41,31,117,31,178,32,7,32,100,32,195,33,5,33,100,33,182,34,
+17,34,78,34,164,34,236,35,40,35,111,35,195,36,21,36,110,36,207,37,33,37,126,
+37,192,38,35,38,94,38,201,39,4,39,64,39,113,39,180,39,244,40,41,40,120,40,
+188,40,253,41,78,41,148,41,240,42,60,42,154,42,205,43,22,43,69,43,127,43,
+241,44,51,44,125,44,203,45,22,45,112,45,194,46,36,46,73,46,156,46,230,47,
+67,47,162,47,248,48,99,48,173,48,232,49,54,49,137,49,202,49,249,50,38,50,
+78,50,202,51,72,51,153,51,210,51,252,52,26,52,60,52,119,52,157,52,197,52,
+223,53,56,53,97,53,153,53,218,54,28,54,86,54,154,54,196,55,6,55,64,55,77,
+55,97,55,131,55,165,55,204,55,241,56,118,56,155,56,189,56,228,57,9,57,48,
+57,60,57,72,57,84,57,96,57,108,57,145,57,181,57,216,58,106,58,253,59,134,
+60,19,60,118,60,182,60,242,61,43,61,114,61,164,61,217,62,39,62,93,62,177,
+62,254,63,58,63,131,63,191,64,6,64,80,64,200,64,250,65,129,65,252,66,43,66,
+107,66,248,67,69,67,144,67,216,68,48,68,112,68,180,69,16,69,85,69,175,69,
+251,70,93,70,163,70,247,71,76,71,111,71,123,71,135,71,147,71,158,71,169,71,
+181,71,193,71,205,71,217,71,228,71,239,71,251,72,6,72,45,72,85,72,147,72,
+232,72,232,73,14,73,77,73,132,73,207,74,21,74,77,74,162,74,214,74,252,75,
+60,75,72,75,91,75,117,75,133,75,158,75,192,75,232,76,24,76,61,76,112,0,0,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,3,253,25,5,120,0,51,7,154,
+0,14,0,26,0,27,0,0,19,6,6,35,34,38,39,55,22,22,51,50,54,54,55,37,52,54,51,
+50,22,21,20,6,35,34,38,19,51,75,172,113,111,225,98,87,106,142,73,54,82,66,
+45,254,148,55,49,46,57,57,46,49,55,132,6,129,125,103,126,115,81,101,76,34,
+62,72,91,50,55,55,50,47,56,56,254,118,0,2,254,182,5,160,255,149,6,207,0,11,
+0,12,0,0,1,52,54,51,50,22,21,20,6,35,34,38,23,254,182,57,53,54,59,59,54,52,
+58,110,6,87,58,62,62,58,58,65,65,125,0,2,0,100,0,220,1,67,4,59,0,11,0,23,
+0,0,19,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,
+100,57,53,54,59,59,54,52,58,57,53,54,59,59,54,52,58,3,195,58,62,62,58,58,
+65,65,253,206,58,62,62,58,58,65,65,0,0,2,0,80,0,0,4,73,5,4,0,9,0,41,0,0,1,
+20,23,54,53,52,38,35,34,6,19,39,37,38,39,6,7,39,54,55,38,53,52,54,51,50,22,
+22,21,20,7,22,23,55,17,51,17,35,17,52,55,35,1,126,86,120,50,48,50,58,21,88,
+1,118,124,84,104,224,73,183,102,148,141,112,84,128,71,173,79,139,134,165,
+165,5,5,3,232,106,108,103,126,51,73,79,252,44,130,221,94,73,68,103,145,77,
+62,163,157,111,142,79,135,75,177,147,70,105,80,2,186,251,6,1,47,99,17,0,0,
+3,0,80,0,0,6,66,5,4,0,31,0,35,0,45,0,0,1,52,55,35,1,39,37,38,39,6,7,39,54,
+55,38,53,52,54,51,50,22,22,21,20,7,22,23,55,17,51,17,35,1,51,17,35,1,20,23,
+54,53,52,38,35,34,6,3,164,5,5,253,239,88,1,118,124,84,104,224,73,183,102,
+148,141,112,84,128,71,173,79,139,134,165,165,1,249,165,165,251,225,86,120,
+50,48,50,58,1,47,99,17,254,173,130,221,94,73,68,103,145,77,62,163,157,111,
+142,79,135,75,177,147,70,105,80,2,186,251,6,4,250,251,6,3,232,106,108,103,
+126,51,73,79,0,2,0,120,254,155,3,178,5,4,0,42,0,51,0,0,1,38,39,6,35,34,38,
+53,52,54,51,50,19,54,53,52,39,39,46,2,53,52,54,51,23,34,6,21,20,30,6,21,20,
+6,7,22,23,1,55,38,35,34,6,21,20,22,3,15,87,73,60,64,158,221,118,87,194,167,
+95,172,100,114,102,57,254,226,11,154,172,47,76,98,103,98,76,47,102,83,60,
+94,254,86,55,106,92,30,31,113,254,155,220,139,12,151,115,84,109,254,247,60,
+112,121,91,54,60,94,116,75,152,165,145,98,89,46,72,61,55,57,65,81,103,66,
+100,149,45,116,238,1,181,3,156,35,23,45,56,0,0,2,0,120,254,155,3,178,7,18,
+0,59,0,68,0,0,19,52,54,55,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,
+23,34,6,21,20,30,6,21,20,6,7,22,23,7,38,39,6,35,34,38,53,52,54,51,50,19,54,
+53,52,39,39,46,2,19,55,38,35,34,6,21,20,22,236,147,140,104,114,150,113,74,
+151,64,69,107,83,60,68,243,14,154,172,47,76,98,103,98,76,47,102,83,60,94,
+132,87,73,60,64,158,221,118,87,194,167,95,172,100,114,102,57,253,55,106,92,
+30,31,113,3,199,115,152,31,68,165,83,103,126,59,57,92,63,62,51,150,121,142,
+98,89,46,72,61,55,57,65,81,103,66,100,149,45,116,238,55,220,139,12,151,115,
+84,109,254,247,60,112,121,91,54,60,94,116,253,11,3,156,35,23,45,56,0,1,0,
+70,255,246,3,180,5,4,0,40,0,0,1,62,2,53,52,38,35,34,6,7,39,54,51,50,22,21,
+20,7,22,22,21,20,6,35,34,38,39,55,30,2,51,50,54,53,52,38,39,6,7,1,60,194,
+145,73,97,80,56,101,92,75,162,150,158,196,151,110,96,213,162,143,251,109,
+103,85,104,119,72,98,131,71,88,110,153,2,191,37,66,99,79,74,90,38,62,120,
+116,184,141,167,97,82,173,105,150,195,176,186,67,123,101,60,123,97,81,137,
+63,40,28,0,0,1,0,70,255,246,5,107,5,4,0,56,0,0,1,62,2,53,52,38,35,34,6,7,
+39,54,51,50,22,21,20,7,54,51,50,22,21,20,6,7,39,18,53,52,38,35,34,7,22,22,
+21,20,6,35,34,38,39,55,30,2,51,50,54,53,52,38,39,6,7,1,60,194,145,73,97,80,
+56,101,92,75,162,150,158,196,33,79,75,172,201,76,60,163,134,104,94,110,131,
+80,85,213,162,143,251,109,103,85,104,119,72,98,131,71,88,110,153,2,191,37,
+66,99,79,74,90,38,62,120,116,184,141,79,62,27,201,162,123,234,120,51,1,2,
+176,103,107,37,67,157,104,150,195,176,186,67,123,101,60,123,97,81,137,63,
+40,28,0,1,0,150,254,209,4,101,4,250,0,27,0,0,1,20,6,35,34,38,39,30,3,5,7,
+36,46,3,53,17,51,17,22,51,50,53,17,51,3,227,162,136,109,183,90,5,72,139,241,
+1,97,64,254,193,235,175,118,64,165,191,165,159,165,2,178,142,164,86,78,105,
+170,143,145,160,128,141,130,138,164,201,130,2,161,253,214,191,188,2,45,0,
+0,2,0,60,254,209,4,97,7,64,0,27,0,31,0,0,1,20,6,35,34,38,39,30,3,5,7,36,46,
+3,53,17,51,17,22,51,50,53,17,51,1,1,7,1,3,223,162,136,109,183,90,5,72,139,
+241,1,97,64,254,193,235,175,118,64,165,191,165,159,165,252,164,3,90,53,252,
+148,2,178,142,164,86,78,105,170,143,145,160,128,141,130,138,164,201,130,2,
+161,253,214,191,188,2,45,2,70,254,145,109,1,72,0,0,4,0,80,0,0,6,66,7,64,0,
+3,0,7,0,17,0,49,0,0,1,51,17,35,1,1,7,1,3,20,23,54,53,52,38,35,34,6,19,39,
+37,38,39,6,7,39,54,55,38,53,52,54,51,50,22,22,21,20,7,22,23,55,17,51,17,35,
+17,52,55,35,5,157,165,165,253,23,3,90,53,252,148,239,86,120,50,48,50,58,21,
+88,1,118,124,84,104,224,73,183,102,148,141,112,84,128,71,173,79,139,134,165,
+165,5,5,4,250,251,6,7,64,254,145,109,1,72,253,60,106,108,103,126,51,73,79,
+252,44,130,221,94,73,68,103,145,77,62,163,157,111,142,79,135,75,177,147,70,
+105,80,2,186,251,6,1,47,99,17,0,4,0,80,0,0,6,66,8,49,0,14,0,18,0,28,0,60,
+0,0,1,1,55,5,22,23,55,38,38,39,39,55,22,18,23,7,51,17,35,1,20,23,54,53,52,
+38,35,34,6,19,39,37,38,39,6,7,39,54,55,38,53,52,54,51,50,22,22,21,20,7,22,
+23,55,17,51,17,35,17,52,55,35,5,223,252,148,71,2,42,76,95,8,30,101,132,153,
+112,189,202,38,119,165,165,251,225,86,120,50,48,50,58,21,88,1,118,124,84,
+104,224,73,183,102,148,141,112,84,128,71,173,79,139,134,165,165,5,5,5,100,
+1,72,148,237,33,59,8,58,120,127,149,108,189,254,231,138,215,251,6,3,232,106,
+108,103,126,51,73,79,252,44,130,221,94,73,68,103,145,77,62,163,157,111,142,
+79,135,75,177,147,70,105,80,2,186,251,6,1,47,99,17,0,4,0,95,0,0,5,149,5,120,
+0,36,0,47,0,48,0,49,0,0,1,52,55,35,6,35,34,38,53,52,54,51,50,23,17,51,17,
+20,7,51,54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,17,35,1,50,55,53,38,35,
+34,6,21,20,22,1,3,2,215,5,5,125,143,156,208,204,153,146,129,165,5,5,107,132,
+135,163,109,157,101,118,57,120,77,165,254,224,145,143,129,126,88,124,99,1,
+205,10,1,66,99,17,98,193,145,136,177,87,1,114,254,189,96,40,96,176,144,200,
+240,51,230,179,155,75,88,253,165,1,228,153,142,67,105,83,80,94,3,148,250,
+136,0,0,3,0,130,0,0,5,47,5,120,0,36,0,37,0,38,0,0,1,34,38,53,17,51,17,20,
+51,50,55,38,53,17,51,17,20,22,51,50,55,17,51,17,35,17,52,55,35,6,6,35,34,
+39,35,6,6,1,17,1,211,156,181,165,137,116,96,14,165,60,77,124,106,165,165,
+5,5,32,103,60,157,85,5,42,136,2,186,1,179,183,154,1,246,253,250,177,101,65,
+76,1,197,253,250,95,82,122,2,61,251,6,1,76,136,35,28,40,87,38,49,3,197,250,
+136,0,0,4,0,80,0,0,4,51,5,120,0,19,0,23,0,24,0,25,0,0,1,52,38,38,39,55,18,
+17,20,6,6,35,34,38,39,55,22,51,50,54,1,51,17,35,19,3,2,66,47,76,80,131,236,
+76,134,79,101,198,74,110,132,114,69,73,1,76,165,165,90,20,2,128,95,182,169,
+126,75,254,154,254,188,101,154,82,148,126,72,201,123,2,226,251,6,5,120,250,
+136,0,0,3,0,140,0,0,4,44,5,120,0,35,0,36,0,37,0,0,37,52,55,35,6,35,34,38,
+53,52,55,38,53,16,33,23,34,6,21,20,23,54,51,23,34,6,21,20,22,51,50,55,17,
+51,17,35,19,3,3,135,5,5,144,179,193,247,165,132,1,217,11,163,155,81,122,150,
+20,195,212,141,112,189,156,165,165,97,20,161,99,17,77,180,145,157,94,107,
+120,1,25,145,81,85,75,74,38,165,99,94,75,85,108,3,54,251,6,5,120,250,136,
+0,0,3,0,150,255,246,4,101,5,120,0,30,0,31,0,32,0,0,1,3,22,22,21,20,6,6,35,
+34,36,2,53,52,18,55,23,6,2,21,20,22,22,51,50,54,53,52,38,39,19,55,3,3,175,
+158,175,165,107,190,115,157,254,254,148,87,114,157,116,77,98,178,112,116,
+141,174,187,176,55,130,4,221,254,57,78,214,140,102,171,95,157,1,25,169,165,
+1,50,216,36,237,254,229,141,128,208,116,127,106,111,187,73,2,33,116,250,136,
+0,3,0,60,0,0,3,211,5,120,0,31,0,32,0,33,0,0,37,52,55,35,6,35,34,36,39,55,
+54,54,53,52,38,39,55,22,22,21,20,6,6,7,22,51,50,55,17,51,17,35,19,17,3,46,
+5,5,104,140,134,254,255,119,114,106,102,79,67,87,124,100,58,103,112,114,161,
+157,108,165,165,86,202,99,17,50,146,157,92,84,145,67,70,106,51,98,88,161,
+93,69,124,121,95,120,82,3,11,251,6,5,120,250,136,0,0,4,0,130,255,245,5,143,
+5,120,0,46,0,57,0,58,0,59,0,0,37,50,55,2,17,52,54,51,50,22,22,21,20,2,7,22,
+23,7,38,39,6,33,34,36,53,52,55,38,38,53,52,54,51,23,34,6,21,20,23,54,51,23,
+34,6,21,20,22,1,20,22,23,54,17,52,38,35,34,6,19,1,2,86,254,171,255,160,141,
+98,152,83,96,89,85,121,92,104,103,207,254,215,215,254,237,157,63,71,236,217,
+11,147,151,81,112,140,20,183,194,166,1,216,90,91,123,83,75,69,77,147,254,
+47,134,167,1,64,1,37,176,194,111,194,116,153,254,210,119,94,107,99,87,108,
+194,216,179,174,106,58,143,77,161,180,145,115,111,110,81,40,165,122,111,105,
+125,3,2,130,240,122,191,1,4,133,143,122,1,127,250,136,0,3,0,131,0,0,4,233,
+5,120,0,29,0,30,0,31,0,0,1,17,20,51,50,54,53,17,16,33,50,22,21,17,35,17,52,
+38,35,34,6,21,17,20,6,35,34,38,53,17,37,19,1,40,147,79,86,1,53,150,190,165,
+84,81,74,80,172,148,150,172,3,21,240,4,250,252,217,227,113,115,1,189,1,115,
+233,179,252,152,3,114,135,122,122,114,254,67,167,196,204,178,3,29,126,250,
+136,0,0,3,0,85,254,107,4,135,5,120,0,50,0,51,0,52,0,0,55,20,22,51,50,54,55,
+23,6,6,35,34,36,38,53,52,18,55,38,53,52,36,33,23,34,6,21,20,23,54,51,23,34,
+6,21,20,22,51,50,55,23,6,35,34,38,53,52,55,39,6,6,1,3,250,246,204,96,213,
+101,49,123,220,106,172,254,224,165,237,203,121,1,10,1,1,11,180,188,82,152,
+169,20,247,210,134,109,161,150,50,158,181,186,234,11,3,80,59,2,58,100,128,
+171,217,49,50,139,57,48,142,251,150,168,1,34,82,121,144,166,175,145,109,117,
+112,80,41,165,116,127,101,119,100,147,97,211,173,43,29,2,74,149,4,151,249,
+12,0,0,3,0,50,0,0,4,125,5,120,0,39,0,40,0,41,0,0,1,52,55,35,7,34,39,6,6,35,
+34,38,39,55,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,22,23,22,51,50,
+55,17,51,17,35,19,17,3,216,5,5,86,58,50,27,205,147,108,183,70,88,73,113,73,
+110,127,125,107,117,113,96,149,167,109,179,109,9,40,45,54,47,165,165,76,1,
+228,99,17,5,10,155,181,102,83,85,70,55,162,140,117,150,98,115,128,102,179,
+108,4,9,2,18,251,6,5,120,250,136,0,3,0,100,255,246,4,57,5,120,0,27,0,28,0,
+29,0,0,1,21,20,6,7,6,6,21,20,22,51,50,54,55,23,6,33,34,38,38,53,52,54,55,
+54,54,53,53,55,3,2,227,116,121,128,109,146,122,105,212,126,105,248,254,227,
+120,207,121,114,123,131,106,76,80,4,250,242,94,174,96,102,150,77,95,109,88,
+108,125,216,99,174,101,96,177,99,105,145,76,212,126,250,136,0,3,0,100,255,
+246,3,226,5,120,0,48,0,49,0,50,0,0,1,38,35,34,6,21,20,22,51,50,54,53,52,38,
+39,46,3,53,52,36,51,23,34,6,21,20,22,22,23,30,2,21,20,6,6,35,34,38,38,53,
+52,54,51,50,22,23,17,3,1,229,61,73,43,43,175,117,126,146,91,91,193,104,65,
+31,1,3,221,11,167,159,51,87,150,121,108,58,109,196,122,126,215,126,132,99,
+83,133,53,40,1,47,95,46,35,79,103,115,96,62,104,47,100,77,85,91,55,147,170,
+145,99,88,49,77,66,81,66,95,111,71,105,157,84,91,161,95,90,116,79,90,4,2,
+250,136,0,3,0,100,255,246,4,92,5,120,0,37,0,38,0,39,0,0,1,34,6,21,20,23,50,
+55,54,51,50,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,39,34,7,6,35,34,
+38,53,52,36,33,39,19,3,41,194,206,24,72,125,125,51,134,176,224,186,169,254,
+221,146,118,138,210,119,123,143,94,49,111,111,43,134,165,1,41,1,1,138,40,
+4,115,150,147,77,55,24,24,219,161,171,217,198,239,75,208,159,140,123,139,
+66,19,19,160,127,201,231,116,250,136,0,4,0,100,254,102,4,92,5,120,0,37,0,
+49,0,50,0,51,0,0,1,34,6,21,20,23,50,55,54,51,50,22,21,20,6,35,34,36,39,55,
+22,22,51,50,54,53,52,39,34,7,6,35,34,38,53,52,36,33,1,52,54,51,50,22,21,20,
+6,35,34,38,19,3,3,41,194,206,24,72,125,125,51,134,176,224,186,169,254,221,
+146,118,138,210,119,123,143,94,49,111,111,43,134,165,1,41,1,1,254,240,57,
+53,54,59,59,54,52,58,134,20,4,115,150,147,77,55,24,24,219,161,171,217,198,
+239,75,208,159,140,123,139,66,19,19,160,127,201,231,249,221,58,62,62,58,58,
+65,65,6,209,248,248,0,4,0,100,255,246,4,67,5,120,0,35,0,46,0,47,0,48,0,0,
+1,20,6,6,35,34,38,38,53,52,54,55,54,54,53,53,51,21,20,6,7,6,6,21,20,22,51,
+55,38,53,52,54,51,50,22,22,5,20,23,54,54,53,52,38,35,34,6,3,3,4,67,127,220,
+131,139,238,136,113,124,123,114,165,117,120,131,106,181,147,81,117,150,112,
+77,124,71,254,143,65,63,76,52,45,46,61,62,90,1,65,96,151,84,105,183,111,97,
+169,96,95,164,92,172,212,103,180,91,100,141,78,108,126,5,96,111,97,128,68,
+118,68,77,72,24,82,56,39,57,63,4,12,250,136,0,5,0,100,254,112,4,67,5,120,
+0,35,0,47,0,58,0,59,0,60,0,0,1,20,6,6,35,34,38,38,53,52,54,55,54,54,53,53,
+51,21,20,6,7,6,6,21,20,22,51,55,38,53,52,54,51,50,22,22,1,52,54,51,50,22,
+21,20,6,35,34,38,19,20,23,54,54,53,52,38,35,34,6,3,3,4,67,127,220,131,139,
+238,136,113,124,123,114,165,117,120,131,106,181,147,81,117,150,112,77,124,
+71,253,197,57,53,54,59,59,54,52,58,202,65,63,76,52,45,46,61,62,30,1,65,96,
+151,84,105,183,111,97,169,96,95,164,92,172,212,103,180,91,100,141,78,108,
+126,5,96,111,97,128,68,118,253,113,58,62,62,58,58,65,65,2,133,77,72,24,82,
+56,39,57,63,4,12,248,248,0,0,3,0,180,0,0,5,75,5,120,0,19,0,20,0,21,0,0,1,
+33,17,35,17,51,17,33,17,51,17,33,17,51,17,35,17,33,17,35,1,17,2,173,254,172,
+165,165,1,84,165,1,84,165,165,254,172,165,2,43,2,50,253,206,4,250,253,201,
+2,55,253,201,2,55,251,6,2,50,253,206,5,120,250,136,0,3,0,120,0,0,3,214,5,
+120,0,22,0,23,0,24,0,0,1,17,35,17,52,55,39,14,3,21,20,22,22,23,7,2,53,52,
+54,36,37,55,3,3,214,165,5,3,112,195,144,83,29,54,89,115,222,129,1,20,1,81,
+38,10,4,250,251,6,3,176,115,20,3,34,66,87,118,86,58,107,112,141,74,1,60,203,
+121,177,148,110,126,250,136,0,0,4,0,90,0,0,4,5,5,120,0,33,0,44,0,45,0,46,
+0,0,37,52,55,35,6,35,34,36,39,55,54,55,38,38,53,52,54,51,50,22,21,20,6,7,
+7,22,22,51,50,55,17,51,17,35,1,20,22,23,54,53,52,38,35,34,6,1,17,3,96,5,5,
+110,144,139,254,248,117,70,148,75,94,91,121,97,118,153,142,164,77,51,149,
+85,165,110,165,165,254,1,54,57,58,53,38,38,40,2,85,212,98,17,59,149,154,45,
+93,70,72,143,83,91,116,150,112,115,207,113,54,55,65,94,2,255,251,6,4,33,50,
+90,48,85,85,47,63,54,1,49,250,136,0,3,0,120,255,246,3,121,5,120,0,29,0,30,
+0,31,0,0,1,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,55,38,53,52,36,33,23,
+34,6,21,20,23,54,51,3,3,2,230,247,210,134,109,164,147,50,158,181,191,239,
+163,130,1,10,1,1,11,180,188,82,132,189,182,10,2,85,116,127,100,120,100,147,
+97,216,169,194,100,125,149,166,175,145,109,117,111,82,42,2,126,250,136,0,
+3,0,120,0,0,4,24,5,120,0,26,0,27,0,28,0,0,37,52,55,35,6,35,34,38,53,52,54,
+55,3,55,1,34,6,21,20,22,51,50,55,17,51,17,35,19,3,3,115,5,5,144,179,193,247,
+178,161,198,134,1,41,195,212,141,112,189,156,165,165,87,10,221,99,17,77,180,
+145,114,164,37,1,52,76,253,241,99,94,75,85,108,2,250,251,6,5,120,250,136,
+0,4,0,90,0,0,4,38,5,120,0,21,0,31,0,32,0,33,0,0,1,6,7,22,22,21,20,6,35,34,
+38,53,52,18,36,37,51,17,35,17,52,55,1,52,39,6,21,20,22,51,50,54,1,17,3,129,
+242,180,76,67,141,114,123,150,201,1,131,1,8,120,165,10,254,58,78,120,48,42,
+50,58,2,5,4,65,92,146,84,164,91,117,151,155,126,132,1,14,250,97,251,6,3,186,
+95,40,253,230,118,89,133,127,48,61,86,3,157,250,136,0,0,3,0,160,0,0,3,169,
+5,120,0,22,0,23,0,24,0,0,1,34,38,53,17,51,17,20,22,51,50,54,55,17,51,17,35,
+17,52,55,35,6,6,1,17,2,20,173,199,165,100,92,64,140,51,165,165,5,5,38,130,
+1,0,1,129,207,183,1,243,253,249,111,115,73,59,2,101,251,6,1,36,136,35,32,
+46,3,247,250,136,0,0,5,0,94,255,206,4,245,5,120,0,42,0,52,0,62,0,63,0,64,
+0,0,37,20,6,35,34,0,39,55,54,55,38,53,52,54,51,50,22,22,21,20,7,22,23,17,
+51,17,7,38,39,6,7,30,2,51,51,38,53,52,54,51,50,22,1,20,23,54,53,52,38,35,
+34,6,1,20,23,54,53,52,38,35,34,6,19,3,4,245,200,152,192,254,79,198,124,226,
+93,251,129,104,89,142,78,66,117,117,165,46,255,181,120,239,80,216,197,73,
+12,84,115,84,110,146,252,206,168,44,72,56,37,47,1,252,60,95,46,35,32,42,111,
+140,195,110,135,1,0,224,73,130,91,160,187,94,119,85,147,83,113,104,51,34,
+2,95,253,20,34,68,87,126,133,83,151,79,77,96,79,111,141,2,242,117,107,75,
+85,65,87,46,252,147,61,58,37,81,34,44,43,4,126,250,116,0,0,3,0,90,0,0,3,225,
+5,120,0,31,0,32,0,33,0,0,1,52,55,35,6,35,34,38,38,53,52,54,54,51,50,22,23,
+7,38,35,34,6,21,20,22,51,50,55,17,51,17,35,19,17,3,60,5,5,124,154,131,212,
+117,113,193,110,53,93,60,55,64,69,117,152,155,120,168,130,165,165,82,1,27,
+99,17,68,111,197,118,105,187,110,23,31,130,27,145,115,121,145,112,2,174,251,
+6,5,120,250,136,0,0,4,0,110,0,0,4,117,5,120,0,29,0,39,0,40,0,41,0,0,1,6,7,
+22,21,20,6,35,34,38,53,52,37,38,39,6,7,39,54,55,22,23,54,55,51,17,35,17,52,
+55,1,52,39,6,21,20,22,51,50,54,1,3,3,210,193,119,71,145,120,118,155,1,30,
+43,60,100,132,40,204,153,87,53,162,252,120,165,5,254,103,32,176,48,43,54,
+63,1,232,20,4,53,99,83,197,176,141,167,167,124,222,223,99,91,18,49,128,69,
+14,135,112,106,131,251,6,3,156,113,37,253,255,108,126,160,157,57,62,109,3,
+164,250,136,0,4,0,145,0,0,4,32,5,120,0,28,0,38,0,39,0,40,0,0,1,22,23,54,54,
+55,51,17,35,17,52,55,39,6,6,7,7,22,21,20,6,35,34,38,53,52,55,38,39,1,52,39,
+6,21,20,22,51,50,54,1,19,1,6,137,93,185,182,77,120,165,5,3,46,127,128,31,
+71,127,108,106,142,221,85,140,1,76,38,125,41,35,42,45,1,237,10,5,4,175,168,
+92,141,100,251,6,3,111,108,27,3,46,84,68,17,160,120,115,133,141,115,190,149,
+152,177,253,116,73,103,98,111,45,49,73,3,140,250,136,0,4,0,90,255,87,3,197,
+5,120,0,36,0,48,0,49,0,50,0,0,37,52,55,39,6,35,34,38,53,52,54,55,54,54,53,
+52,38,39,55,22,22,21,20,6,7,6,6,21,20,22,51,50,55,17,51,17,35,5,52,54,51,
+50,22,21,20,6,35,34,38,1,19,3,32,5,5,143,143,177,247,79,82,89,72,41,86,98,
+118,76,80,81,82,79,125,113,164,143,165,165,254,82,57,53,54,59,59,54,52,58,
+1,254,10,193,96,17,3,61,182,133,58,112,62,66,85,42,46,77,85,88,113,135,75,
+55,106,58,58,97,49,70,75,91,3,22,251,6,46,58,62,62,58,58,65,65,5,224,250,
+136,0,3,0,70,0,0,2,245,5,120,0,9,0,10,0,11,0,0,19,1,51,17,35,17,52,55,39,
+1,1,3,70,2,55,120,165,5,3,254,108,1,234,20,2,246,2,4,251,6,3,105,125,25,2,
+254,118,3,1,250,136,0,0,5,0,110,255,246,4,66,5,120,0,12,0,28,0,39,0,40,0,
+41,0,0,19,52,18,54,51,50,18,17,16,2,35,34,0,19,23,54,54,51,50,22,23,53,55,
+52,38,35,34,2,21,23,22,22,51,50,54,53,38,35,34,6,19,19,110,129,225,145,229,
+252,243,225,240,254,240,165,1,67,177,76,79,149,100,1,148,151,162,189,17,20,
+172,118,148,165,144,155,80,176,240,10,2,163,174,1,30,149,254,164,254,196,
+254,211,254,183,1,110,1,1,4,36,43,38,52,15,26,254,246,254,238,241,172,144,
+173,175,159,75,51,3,139,250,136,0,0,4,0,100,255,123,3,235,5,120,0,28,0,40,
+0,41,0,42,0,0,1,38,35,34,6,21,20,22,51,50,55,17,51,17,35,17,6,35,34,38,38,
+53,52,54,54,51,50,22,23,1,52,54,51,50,22,21,20,6,35,34,38,1,19,2,155,64,69,
+117,152,155,120,168,130,165,165,124,154,131,212,117,113,193,110,53,93,60,
+254,190,57,53,54,59,59,54,52,58,1,254,10,3,207,27,145,115,121,145,112,2,174,
+251,6,1,143,68,111,197,118,105,187,110,23,31,251,165,58,62,62,58,58,65,65,
+5,188,250,136,0,0,4,0,120,255,234,4,157,5,120,0,37,0,47,0,48,0,49,0,0,1,38,
+39,6,7,22,23,7,1,6,35,34,38,53,52,54,51,50,23,54,55,38,38,53,52,54,51,50,
+22,21,20,7,22,23,17,51,17,35,1,20,23,54,53,52,38,35,34,6,1,3,3,248,201,96,
+69,103,86,166,130,254,245,44,46,79,113,68,58,91,96,85,56,166,152,138,115,
+151,168,42,101,129,165,165,253,173,217,25,73,65,52,52,2,167,10,1,182,76,43,
+90,56,98,237,98,1,123,10,80,61,48,56,73,40,71,95,203,118,105,133,217,188,
+110,99,45,45,2,182,251,6,4,2,153,128,69,83,114,128,62,1,67,250,136,0,4,0,
+150,0,0,3,129,5,120,0,16,0,25,0,26,0,27,0,0,1,34,38,53,17,51,1,17,51,17,35,
+17,52,55,35,6,6,39,50,55,38,39,1,17,20,22,1,3,2,15,175,202,165,1,161,165,
+165,5,5,32,113,85,106,92,72,47,254,246,89,1,160,10,1,149,223,193,1,197,254,
+3,1,253,251,6,1,46,146,25,28,40,144,87,29,61,1,79,254,207,106,101,3,83,250,
+136,0,3,0,120,255,234,4,247,5,120,0,47,0,48,0,49,0,0,1,6,35,34,39,6,7,22,
+23,23,7,1,7,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,6,7,39,54,51,50,
+22,22,21,20,7,22,51,50,55,17,51,17,35,19,3,4,82,56,82,125,106,73,105,62,86,
+146,144,254,225,80,94,128,65,61,96,110,116,115,124,103,39,70,62,61,88,146,
+163,118,183,102,35,64,76,94,59,165,165,84,10,2,52,14,50,73,40,80,130,220,
+79,1,218,5,90,66,48,61,104,40,151,98,113,129,20,32,48,123,122,107,187,111,
+93,76,20,26,2,46,251,6,5,120,250,136,0,0,3,0,120,255,71,3,178,5,120,0,45,
+0,46,0,47,0,0,1,22,51,50,54,53,52,38,35,34,6,21,20,22,22,23,7,46,2,53,52,
+54,55,38,53,52,36,51,23,34,6,21,20,23,54,51,50,22,22,21,20,6,35,34,39,19,
+19,2,14,57,76,53,70,104,93,139,161,84,187,202,74,237,222,105,81,69,80,1,2,
+245,11,178,170,31,92,96,108,168,95,154,113,121,96,128,80,1,210,42,82,57,64,
+78,140,121,80,153,162,124,110,144,196,197,102,96,153,52,106,113,150,160,145,
+93,102,69,57,32,77,142,88,117,147,94,4,3,250,6,0,3,0,170,0,0,1,79,5,120,0,
+3,0,4,0,5,0,0,19,51,17,35,19,19,170,165,165,80,10,4,250,251,6,5,120,250,136,
+0,0,2,0,180,0,0,5,225,6,249,0,15,0,16,0,0,19,16,0,51,50,4,5,7,38,36,35,34,
+6,21,17,35,1,180,1,6,254,165,1,131,1,1,67,227,254,167,152,190,179,165,4,236,
+4,180,1,30,1,39,143,169,96,144,119,228,228,251,96,6,124,0,0,2,254,133,0,0,
+1,90,7,76,0,21,0,22,0,0,1,52,54,51,50,18,17,17,35,17,52,38,35,34,6,21,20,
+22,23,7,38,38,1,254,133,174,140,201,210,165,115,111,81,88,49,34,112,65,71,
+2,49,6,28,132,160,254,198,254,214,251,36,4,250,227,210,91,76,59,94,43,74,
+65,148,1,125,0,0,2,251,36,254,50,254,149,0,81,0,22,0,23,0,0,37,50,22,21,20,
+6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,53,7,253,100,138,167,176,149,
+104,185,166,101,103,106,122,134,75,79,97,119,110,13,81,147,123,125,148,81,
+139,126,84,123,100,62,79,66,72,80,101,91,0,0,2,252,141,253,225,255,206,0,
+10,0,23,0,24,0,0,3,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,50,30,4,23,
+1,159,38,170,214,66,71,99,80,24,139,181,157,129,81,135,110,88,68,48,17,253,
+233,253,225,75,1,77,64,48,56,65,2,121,148,113,109,131,54,86,110,110,102,36,
+1,232,0,0,3,251,190,5,100,255,95,7,64,0,3,0,4,0,5,0,0,1,1,7,1,1,55,252,5,
+3,90,53,252,148,3,22,40,7,64,254,145,109,1,72,254,204,240,0,3,251,190,5,100,
+255,95,8,49,0,14,0,15,0,16,0,0,3,1,55,5,22,23,55,38,38,39,39,55,22,18,23,
+7,19,214,252,148,71,2,42,76,95,8,30,101,132,153,112,189,202,38,139,114,5,
+100,1,72,148,237,33,59,8,58,120,127,149,108,189,254,231,138,89,2,32,0,0,3,
+253,138,0,0,1,85,7,64,0,3,0,7,0,8,0,0,19,51,17,35,1,1,7,1,5,176,165,165,253,
+33,3,90,53,252,148,3,107,4,250,251,6,7,64,254,145,109,1,72,104,0,0,3,253,
+118,0,0,1,69,8,49,0,14,0,18,0,19,0,0,19,1,55,5,22,23,55,38,38,39,39,55,22,
+18,23,7,51,17,35,19,226,252,148,71,2,42,76,95,8,30,101,132,153,112,189,202,
+38,119,165,165,54,5,100,1,72,148,237,33,59,8,58,120,127,149,108,189,254,231,
+138,215,251,6,7,195,0,2,0,149,253,196,2,234,0,0,0,3,0,4,0,0,23,1,7,1,19,241,
+1,249,70,253,241,151,134,254,184,110,1,44,1,16,0,2,254,182,254,102,255,149,
+0,0,0,11,0,12,0,0,1,52,54,51,50,22,21,20,6,35,34,38,19,254,182,57,53,54,59,
+59,54,52,58,100,254,225,58,62,62,58,58,65,65,1,89,0,0,2,0,160,1,38,3,98,3,
+230,0,13,0,24,0,0,1,50,22,22,21,20,6,6,35,34,38,53,52,54,23,34,6,21,20,22,
+51,50,54,53,52,1,253,103,164,90,88,154,100,154,210,197,161,93,100,99,90,86,
+101,3,230,94,165,97,91,163,94,202,158,151,193,145,114,95,103,102,103,110,
+201,0,0,2,0,120,255,246,8,102,4,89,0,25,0,36,0,0,1,4,7,22,21,20,6,35,34,38,
+53,52,0,37,51,17,20,22,22,51,33,21,33,34,38,53,5,52,38,39,6,21,20,22,51,50,
+54,3,175,254,197,178,242,155,113,140,164,1,194,1,164,118,56,115,130,2,229,
+253,37,241,235,254,96,90,81,71,69,60,48,65,3,153,146,174,161,193,110,147,
+165,140,197,1,168,197,253,76,105,118,53,145,215,228,186,70,109,54,106,99,
+67,83,61,0,0,2,0,120,255,246,8,102,4,89,0,25,0,36,0,0,1,4,7,22,21,20,6,35,
+34,38,53,52,0,37,51,17,20,22,22,51,33,21,33,34,38,53,5,52,38,39,6,21,20,22,
+51,50,54,3,175,254,197,178,242,155,113,140,164,1,194,1,164,118,56,115,130,
+2,229,253,37,241,235,254,96,90,81,71,69,60,48,65,3,153,146,174,161,193,110,
+147,165,140,197,1,168,197,253,76,105,118,53,145,215,228,186,70,109,54,106,
+99,67,83,61,0,0,1,0,180,255,196,1,69,5,54,0,3,0,0,19,51,17,35,180,145,145,
+5,54,250,142,0,0,2,0,180,255,196,2,213,5,54,0,3,0,7,0,0,19,51,17,35,1,51,
+17,35,180,145,145,1,144,145,145,5,54,250,142,5,114,250,142,0,0,3,0,95,0,0,
+7,59,7,67,0,51,0,62,0,63,0,0,1,20,7,51,54,51,50,22,21,20,7,39,54,53,52,35,
+34,6,7,17,35,17,52,55,35,6,35,34,38,38,53,52,54,51,50,23,17,16,0,33,32,0,
+17,17,35,17,52,38,35,34,6,21,1,50,55,53,38,35,34,6,21,20,22,1,3,124,5,5,107,
+132,135,163,109,157,101,118,57,120,77,165,5,5,125,143,99,168,97,205,152,146,
+129,1,38,1,3,1,10,1,49,165,197,189,202,206,254,59,145,143,129,126,92,120,
+102,4,245,3,183,96,40,96,176,144,200,240,51,230,179,155,75,88,253,165,1,66,
+99,17,98,89,156,93,136,177,87,1,84,1,36,1,64,254,169,254,213,251,66,4,210,
+238,239,255,242,253,38,153,142,67,106,82,77,97,5,95,0,3,0,95,254,50,5,149,
+5,120,0,59,0,70,0,71,0,0,37,20,7,22,22,21,20,6,35,34,38,38,39,55,30,2,51,
+50,54,53,52,38,35,17,52,55,35,6,35,34,38,38,53,52,54,51,50,23,17,51,17,20,
+7,51,54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,5,50,55,53,38,35,34,6,21,20,
+22,1,3,124,10,113,126,176,149,104,185,166,101,103,106,122,134,75,79,97,119,
+110,5,5,125,143,99,168,97,205,152,146,129,165,5,5,107,132,135,163,109,157,
+101,118,57,120,77,254,59,145,143,129,126,92,120,102,1,202,211,72,63,18,142,
+105,125,148,81,139,126,84,123,100,62,79,66,72,80,1,86,99,17,98,89,156,93,
+136,177,87,1,114,254,189,96,40,96,176,144,200,240,51,230,179,155,75,88,119,
+153,142,67,106,82,77,97,3,148,0,3,0,95,253,225,5,149,5,120,0,55,0,66,0,67,
+0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,55,17,52,55,35,6,35,34,38,
+53,52,54,51,50,23,17,51,17,20,7,51,54,51,50,22,21,20,7,39,54,53,52,35,34,
+6,7,17,22,22,23,1,50,55,53,38,35,34,6,21,20,22,1,4,174,38,170,214,66,71,99,
+80,24,139,181,134,119,5,5,125,143,156,208,204,153,146,129,165,5,5,107,132,
+135,163,109,157,101,118,57,120,77,115,202,98,252,156,145,143,129,126,88,124,
+99,1,205,253,225,75,1,77,64,48,56,65,2,121,148,113,100,129,10,1,57,99,17,
+98,193,145,136,177,87,1,114,254,189,96,40,96,176,144,200,240,51,230,179,155,
+75,88,253,154,37,224,216,3,204,153,142,67,105,83,80,94,3,148,0,0,3,0,145,
+254,50,5,5,5,120,0,50,0,60,0,61,0,0,1,52,55,39,6,6,7,7,22,21,20,6,35,34,38,
+53,52,55,38,39,55,22,23,54,54,55,51,17,20,7,22,22,21,20,6,35,34,38,38,39,
+55,30,2,51,50,54,53,52,38,35,1,52,39,6,21,20,22,51,50,54,1,3,123,5,3,50,115,
+117,50,71,127,108,106,142,221,85,140,117,137,93,185,182,77,120,10,113,126,
+176,149,104,185,166,101,103,106,122,134,75,79,97,119,110,254,98,38,125,41,
+35,42,45,2,1,3,111,108,27,3,52,77,59,27,160,120,115,133,141,115,190,149,152,
+177,86,175,168,92,141,100,251,217,72,63,18,142,105,125,148,81,139,126,84,
+123,100,62,79,66,72,80,2,54,73,103,98,111,45,49,73,3,140,0,3,0,145,253,225,
+5,141,5,120,0,52,0,62,0,63,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,
+51,23,17,52,55,39,6,6,7,7,22,21,20,6,35,34,38,53,52,55,38,39,55,22,23,54,
+54,55,51,17,20,7,7,30,2,23,1,52,39,6,21,20,22,51,50,54,1,5,32,38,170,214,
+66,71,99,80,24,139,181,157,129,17,5,3,50,115,117,50,71,127,108,106,142,221,
+85,140,117,137,93,185,182,77,120,22,5,73,136,112,71,252,80,38,125,41,35,42,
+45,1,247,253,225,75,1,77,64,48,56,65,2,121,148,113,109,131,1,3,102,108,27,
+3,52,77,59,27,160,120,115,133,141,115,190,149,152,177,86,175,168,92,141,100,
+251,197,128,67,15,29,118,170,152,4,10,73,103,98,111,45,49,73,3,140,0,3,0,
+110,254,50,5,90,5,120,0,52,0,62,0,63,0,0,37,20,7,22,22,21,20,6,35,34,38,38,
+39,55,30,2,51,50,54,53,52,38,35,17,52,55,35,7,6,7,22,21,20,6,35,34,38,53,
+52,37,38,39,6,7,39,54,55,22,23,54,55,51,1,52,39,6,21,20,22,51,50,54,1,4,117,
+10,113,126,176,149,104,185,166,101,103,106,122,134,75,79,97,119,110,5,5,124,
+94,86,65,145,120,118,155,1,33,39,67,100,132,40,204,153,90,52,158,254,120,
+253,199,28,180,45,41,55,67,1,232,211,72,63,18,142,105,125,148,81,139,126,
+84,123,100,62,79,66,72,80,3,176,113,37,82,54,60,184,172,141,167,159,122,214,
+235,93,103,18,49,128,69,14,140,111,108,133,253,55,105,112,164,146,51,58,105,
+3,168,0,0,3,0,110,253,225,5,225,5,120,0,53,0,63,0,64,0,0,1,39,2,35,34,6,21,
+20,22,23,7,34,38,53,52,54,51,23,17,52,55,35,7,6,7,22,21,20,6,35,34,38,53,
+52,37,38,39,6,7,39,54,55,22,23,54,55,51,17,20,7,30,2,23,1,52,39,6,21,20,22,
+51,50,54,1,5,116,38,170,214,66,71,99,80,24,139,181,157,129,18,5,5,124,94,
+86,65,145,120,118,155,1,33,39,67,100,132,40,204,153,90,52,158,254,120,27,
+83,132,103,73,252,91,28,180,45,41,55,67,1,232,253,225,75,1,77,64,48,56,65,
+2,121,148,113,109,131,1,3,147,113,37,82,54,60,184,172,141,167,159,122,214,
+235,93,103,18,49,128,69,14,140,111,108,133,251,197,126,85,33,126,153,156,
+4,25,105,112,164,146,51,58,105,3,168,0,0,2,0,70,254,50,3,207,5,120,0,32,0,
+33,0,0,37,20,7,22,22,21,20,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,
+17,52,55,35,7,5,39,1,51,39,2,234,10,113,126,176,149,104,185,166,101,103,106,
+122,134,75,79,97,119,110,5,5,124,254,234,109,2,44,120,76,211,72,63,18,142,
+105,125,148,81,139,126,84,123,100,62,79,66,72,80,3,22,216,37,141,251,135,
+1,252,126,0,2,0,70,253,225,4,87,5,120,0,34,0,35,0,0,1,39,2,35,34,6,21,20,
+22,23,7,34,38,53,52,54,51,23,17,52,55,35,7,5,39,1,51,17,20,7,7,30,2,23,1,
+3,234,38,170,214,71,86,107,92,24,143,197,173,133,17,5,5,124,254,234,109,2,
+44,120,22,5,73,136,112,71,254,71,253,225,75,1,77,65,56,63,68,2,121,157,114,
+110,139,1,2,249,216,37,141,251,135,1,252,251,197,128,67,15,29,118,170,152,
+7,96,0,0,2,0,130,254,50,6,20,5,120,0,58,0,59,0,0,1,52,55,35,6,6,35,34,39,
+35,6,6,35,32,17,17,51,17,20,22,51,50,55,38,53,17,51,17,20,22,51,50,55,17,
+51,17,20,7,22,22,21,20,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,19,4,
+138,5,5,32,103,60,157,85,5,42,136,75,254,175,165,60,77,116,96,14,165,60,77,
+124,106,165,10,113,126,176,149,104,185,166,101,103,106,122,134,75,79,97,119,
+110,78,1,76,136,35,28,40,87,38,49,1,130,1,197,253,250,95,82,101,65,76,1,197,
+253,250,95,82,122,2,61,251,217,72,63,18,142,105,125,148,81,139,126,84,123,
+100,62,79,66,72,80,5,140,0,2,0,130,253,225,6,156,5,120,0,60,0,61,0,0,1,39,
+2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,23,17,52,55,35,6,6,35,34,39,35,
+6,6,35,32,17,17,51,17,20,22,51,50,55,38,53,17,51,17,20,22,51,50,55,17,51,
+17,20,7,7,30,2,23,1,6,47,38,170,214,66,71,99,80,24,139,181,157,129,17,5,5,
+32,103,60,157,85,5,42,136,75,254,175,165,60,77,116,96,14,165,60,77,124,106,
+165,22,5,73,136,112,71,254,60,253,225,75,1,77,64,48,56,65,2,121,148,113,109,
+131,1,1,67,136,35,28,40,87,38,49,1,130,1,197,253,250,95,82,101,65,76,1,197,
+253,250,95,82,122,2,61,251,197,128,67,15,29,118,170,152,7,96,0,0,2,0,160,
+0,0,5,177,7,67,0,34,0,35,0,0,33,35,17,52,55,35,6,6,35,34,38,53,17,51,17,20,
+22,51,50,55,17,16,33,50,18,17,17,35,17,52,38,35,34,6,21,1,3,139,165,5,5,32,
+113,60,175,202,165,89,98,124,106,1,100,184,175,165,83,101,103,98,1,62,1,46,
+136,35,28,40,223,193,1,197,253,250,106,101,122,2,91,2,10,254,235,254,217,
+251,56,4,230,220,177,198,209,2,103,0,0,2,0,160,254,50,4,112,5,120,0,43,0,
+44,0,0,1,52,55,35,6,6,35,34,38,53,17,51,17,20,22,51,50,55,17,51,17,20,7,22,
+22,21,20,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,19,2,230,10,10,32,
+113,60,175,202,165,89,98,124,106,165,10,113,126,176,149,104,185,166,101,103,
+106,122,134,75,79,97,119,110,68,1,46,124,47,28,40,223,193,1,197,253,250,106,
+101,122,2,91,251,217,72,63,18,142,105,125,148,81,139,126,84,123,100,62,79,
+66,72,80,5,140,0,0,2,0,160,253,225,4,249,5,120,0,46,0,47,0,0,1,39,2,35,34,
+6,21,20,22,23,7,34,38,53,52,54,51,23,17,52,55,35,6,6,35,34,38,53,17,51,17,
+20,22,51,50,55,17,51,17,20,6,7,30,3,23,1,4,140,38,170,214,66,71,99,80,24,
+139,181,157,129,16,10,10,32,113,60,175,202,165,89,98,124,106,165,20,7,58,
+101,87,84,63,254,49,253,225,75,1,77,64,48,56,65,2,121,148,113,109,131,1,1,
+37,124,47,28,40,223,193,1,197,253,250,106,101,122,2,91,251,197,74,129,7,23,
+77,99,134,136,7,96,0,2,0,120,254,50,5,220,5,120,0,69,0,70,0,0,37,20,7,22,
+22,21,20,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,17,6,35,34,39,6,7,
+22,22,23,7,3,7,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,6,7,39,54,51,
+50,22,22,21,20,7,22,51,50,55,17,51,39,4,247,10,113,126,176,149,104,185,166,
+101,103,106,122,134,75,79,97,119,110,51,77,113,102,74,129,48,96,51,144,190,
+79,94,128,65,61,101,107,114,115,124,103,39,70,62,61,88,146,163,118,183,102,
+22,68,69,79,64,165,91,211,72,63,18,142,105,125,148,81,139,126,84,123,100,
+62,79,66,72,80,2,103,15,50,93,50,63,142,72,79,1,65,5,90,66,48,61,103,40,148,
+100,113,129,20,32,48,123,122,107,187,111,73,62,24,30,2,12,126,0,2,0,120,253,
+225,6,100,5,120,0,72,0,73,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,
+51,23,17,6,35,34,39,6,7,22,22,23,7,3,6,35,34,38,53,52,54,51,50,23,54,54,53,
+52,38,35,34,6,6,7,39,54,51,50,22,22,21,20,7,22,51,50,55,17,51,17,20,7,7,30,
+2,23,1,5,247,38,170,214,66,71,99,80,24,139,181,157,129,17,51,77,113,102,75,
+130,63,129,66,144,249,33,48,94,128,65,61,91,112,117,117,124,103,39,70,62,
+61,88,146,163,118,183,102,22,68,69,79,64,165,22,5,73,136,112,71,254,56,253,
+225,75,1,77,64,48,56,65,2,121,148,113,109,131,1,2,74,15,50,94,50,80,188,95,
+79,1,152,5,90,66,48,61,105,40,149,101,113,129,20,32,48,123,122,107,187,111,
+73,62,24,30,2,12,251,197,128,67,15,29,118,170,152,7,96,0,0,2,0,180,0,0,4,
+239,6,249,0,17,0,18,0,0,19,16,18,51,50,22,22,23,7,46,2,35,34,6,21,17,35,1,
+180,231,226,109,196,179,142,85,135,142,157,89,157,153,165,3,245,4,180,1,31,
+1,38,71,118,136,86,121,89,56,226,230,251,96,6,124,0,4,251,230,5,100,0,74,
+8,49,0,14,0,26,0,27,0,28,0,0,3,1,55,5,22,23,55,38,38,39,39,55,22,18,23,3,
+52,54,51,50,22,21,20,6,35,34,38,3,55,174,252,148,71,2,42,76,95,8,30,101,132,
+153,112,189,202,38,28,57,53,54,59,59,54,52,58,151,140,5,100,1,72,148,237,
+33,59,8,58,120,127,149,108,189,254,231,138,1,107,58,62,62,58,58,65,65,254,
+118,240,0,0,4,251,190,5,100,0,3,7,64,0,3,0,15,0,16,0,17,0,0,1,1,7,1,37,52,
+54,51,50,22,21,20,6,35,34,38,3,55,252,5,3,90,53,252,148,3,102,57,53,54,59,
+59,54,52,58,80,40,7,64,254,145,109,1,72,15,58,62,62,58,58,65,65,254,247,240,
+0,0,1,0,30,0,0,7,13,4,250,0,42,0,0,19,62,2,51,50,23,54,51,50,23,54,51,50,
+23,17,51,17,35,17,38,35,34,3,7,39,54,54,55,38,35,34,3,7,39,55,54,55,38,35,
+34,3,7,30,58,117,155,94,135,126,101,134,133,124,99,132,104,98,165,165,84,
+88,169,106,29,150,44,47,28,80,73,169,106,29,150,20,38,58,80,78,169,106,29,
+1,196,183,193,98,101,101,97,97,59,1,151,251,6,2,210,59,254,212,80,51,130,
+107,45,47,254,212,80,51,61,124,94,50,254,212,80,0,3,0,80,0,0,6,82,7,67,0,
+16,0,35,0,36,0,0,33,35,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,1,52,2,
+39,55,18,17,20,6,35,34,38,39,55,22,22,51,50,54,1,4,44,165,168,188,1,103,165,
+82,102,108,93,254,15,95,108,127,240,163,126,105,193,68,105,49,128,59,77,73,
+3,59,4,250,1,9,1,1,253,196,251,56,4,230,219,178,188,219,253,164,118,1,18,
+170,72,254,148,254,207,148,189,148,133,59,89,106,124,5,42,0,0,3,0,80,254,
+50,5,17,5,120,0,25,0,44,0,45,0,0,1,17,20,7,22,22,21,20,6,35,34,38,38,39,55,
+30,2,51,50,54,53,52,38,35,17,1,52,2,39,55,18,17,20,6,35,34,38,39,55,22,22,
+51,50,54,1,4,44,10,113,126,176,149,104,185,166,101,103,106,122,134,75,79,
+97,119,110,254,180,95,108,127,240,163,126,105,193,68,105,49,128,59,77,73,
+1,153,4,250,251,217,72,63,18,142,105,125,148,81,139,126,84,123,100,62,79,
+66,72,80,5,14,253,134,118,1,18,170,72,254,148,254,207,148,189,148,133,59,
+89,106,124,3,95,0,0,3,0,80,253,225,5,153,5,120,0,27,0,46,0,47,0,0,1,39,2,
+35,34,6,21,20,22,23,7,34,38,53,52,54,51,23,17,51,17,20,7,7,30,2,23,1,52,2,
+39,55,18,17,20,6,35,34,38,39,55,22,22,51,50,54,1,5,44,38,170,214,66,71,99,
+80,24,139,181,157,129,17,165,22,5,73,136,112,71,252,162,95,108,127,240,163,
+126,105,193,68,105,49,128,59,77,73,1,153,253,225,75,1,77,64,48,56,65,2,121,
+148,113,109,131,1,4,241,251,197,128,67,15,29,118,170,152,4,104,118,1,18,170,
+72,254,148,254,207,148,189,148,133,59,89,106,124,3,95,0,2,0,100,254,99,5,
+225,5,120,0,36,0,37,0,0,1,33,17,35,17,33,6,7,22,0,23,7,36,0,39,62,2,53,52,
+38,39,55,22,22,21,20,7,33,17,51,17,33,17,51,17,35,19,5,60,254,172,165,254,
+143,57,95,89,1,53,250,91,254,242,254,155,144,138,94,50,62,84,87,120,104,21,
+1,53,165,1,84,165,165,80,2,50,253,206,2,50,103,126,153,254,209,174,116,179,
+1,107,242,154,143,143,78,79,136,82,98,98,200,114,91,74,2,55,253,201,2,55,
+251,6,5,120,0,0,2,0,130,254,216,5,47,5,120,0,46,0,47,0,0,1,16,0,35,34,36,
+39,55,4,51,50,54,53,52,55,39,6,6,35,34,39,35,6,6,35,34,38,53,17,51,17,20,
+51,50,55,38,53,17,51,17,20,22,51,50,55,17,51,39,5,47,254,240,239,146,254,
+183,196,83,1,58,254,187,179,5,3,29,111,57,157,85,5,42,136,75,156,181,165,
+137,116,96,14,165,60,77,124,106,165,87,1,5,254,251,254,216,123,137,111,226,
+213,216,188,37,3,29,42,87,38,49,183,154,1,246,253,250,177,101,65,76,1,197,
+253,250,95,82,122,2,61,126,0,3,0,95,254,182,5,239,5,120,0,49,0,61,0,62,0,
+0,1,34,36,39,55,22,4,51,50,36,18,53,52,38,35,34,6,7,17,35,17,52,55,35,6,35,
+34,38,38,53,52,54,54,51,50,23,17,51,17,20,7,51,54,51,50,18,21,20,2,4,1,50,
+54,55,53,38,35,34,6,21,20,22,1,3,33,174,254,162,157,85,185,1,13,132,168,1,
+1,138,106,102,57,120,77,165,5,5,125,143,101,168,95,93,164,100,151,124,165,
+5,5,107,132,180,208,180,254,187,253,193,75,133,80,129,126,94,118,96,1,198,
+254,182,158,147,103,149,114,151,1,21,178,167,178,75,88,253,165,1,66,99,17,
+98,90,159,94,89,141,78,87,1,114,254,189,96,40,96,254,239,227,211,254,169,
+187,3,46,67,86,142,67,103,80,81,98,3,148,0,0,3,0,80,254,92,4,51,5,120,0,14,
+0,34,0,35,0,0,1,51,17,16,33,34,38,39,55,22,22,51,50,54,53,1,52,38,38,39,55,
+18,17,20,6,6,35,34,38,39,55,22,51,50,54,1,3,142,165,254,62,123,253,148,86,
+120,206,102,153,142,254,180,47,76,80,131,236,76,134,79,101,198,74,110,132,
+114,69,73,1,156,4,250,251,86,254,12,107,119,103,95,89,186,189,2,28,95,182,
+169,126,75,254,154,254,188,101,154,82,148,126,72,201,123,3,96,255,255,253,
+138,0,0,1,110,7,64,2,38,0,59,0,0,0,7,0,5,1,217,0,99,255,255,253,118,0,0,1,
+210,8,49,2,38,0,60,0,0,0,7,0,5,2,61,0,199,0,2,0,130,0,0,7,85,7,67,0,49,0,
+50,0,0,33,35,17,52,55,35,6,6,35,34,39,35,6,6,35,34,38,53,17,51,17,20,51,50,
+55,38,53,17,51,17,20,22,51,50,55,17,16,33,50,18,17,17,35,17,52,38,35,34,6,
+21,1,5,47,165,5,5,32,103,60,157,85,5,42,136,75,156,181,165,137,116,96,14,
+165,60,77,124,106,1,100,184,175,165,83,101,103,98,1,75,1,76,136,35,28,40,
+87,38,49,183,154,1,246,253,250,177,101,65,76,1,197,253,250,95,82,122,2,61,
+2,10,254,235,254,217,251,56,4,230,220,177,198,209,2,103,0,2,0,70,0,0,5,27,
+7,67,0,22,0,23,0,0,1,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,55,39,1,
+39,1,16,18,37,3,180,1,103,165,82,102,108,93,165,5,3,254,108,120,2,28,162,
+1,60,7,4,253,196,251,56,4,230,219,178,188,219,251,36,3,105,125,25,2,254,118,
+127,1,235,1,35,1,0,63,0,0,2,0,130,0,0,7,15,7,67,0,44,0,45,0,0,33,35,17,52,
+38,35,34,6,21,17,20,6,35,34,38,53,19,51,17,20,51,50,54,53,17,16,33,50,23,
+38,53,16,18,51,32,17,17,35,17,52,38,35,34,6,21,1,4,233,165,84,81,74,80,172,
+148,149,174,1,165,147,79,86,1,53,102,79,6,168,188,1,103,165,82,102,108,93,
+1,75,3,114,135,122,122,114,254,67,167,196,203,179,3,29,252,217,227,113,115,
+1,189,1,115,66,27,29,1,9,1,1,253,196,251,56,4,230,219,178,188,219,2,103,0,
+3,0,130,255,245,7,66,7,67,0,66,0,77,0,78,0,0,1,34,6,21,20,23,54,51,23,34,
+6,21,20,22,51,50,55,2,17,52,54,51,50,23,38,53,52,54,51,50,18,17,17,35,17,
+52,38,35,34,6,21,20,30,2,21,20,2,7,22,23,7,38,39,6,33,34,36,53,52,55,38,38,
+53,52,54,51,1,20,22,23,54,17,52,38,35,34,6,1,2,105,147,151,81,112,140,20,
+183,194,166,137,254,171,255,160,141,63,55,16,171,147,190,179,165,86,108,87,
+94,26,32,26,96,89,85,121,92,104,103,207,254,215,215,254,237,157,63,71,236,
+217,1,71,90,91,123,83,75,69,77,2,193,4,115,115,111,110,81,40,165,122,111,
+105,125,167,1,64,1,37,176,194,23,52,84,184,215,254,222,254,230,251,56,4,230,
+223,174,148,129,76,123,117,122,73,153,254,210,119,94,107,99,87,108,194,216,
+179,174,106,58,143,77,161,180,254,132,130,240,122,191,1,4,133,143,122,3,74,
+0,2,0,120,254,31,3,198,5,120,0,64,0,65,0,0,5,20,6,35,34,38,39,55,22,51,50,
+54,53,52,38,39,46,2,53,52,54,55,38,53,52,36,51,23,34,6,21,20,23,54,51,50,
+22,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,35,34,6,21,20,30,6,1,3,161,
+189,148,130,252,90,89,195,178,82,100,92,105,187,157,83,81,69,80,1,2,245,11,
+178,170,31,92,96,108,168,95,154,113,121,96,64,57,76,53,70,104,93,139,161,
+54,87,112,117,113,87,54,254,173,203,124,154,145,122,80,202,69,74,48,86,51,
+89,123,155,95,96,153,52,106,113,150,160,145,93,102,69,57,32,77,142,88,117,
+147,94,93,42,82,57,64,78,140,121,64,97,77,63,59,60,74,92,6,6,0,0,2,0,120,
+254,29,4,3,5,120,0,67,0,68,0,0,1,34,6,21,20,23,54,51,50,22,22,21,20,6,35,
+34,39,55,22,51,50,54,53,52,38,35,34,6,21,20,30,4,23,7,39,38,35,34,6,21,20,
+22,51,50,54,55,23,6,35,34,38,53,52,54,55,36,53,52,54,55,38,53,52,36,51,39,
+2,192,178,170,31,92,96,108,168,95,154,113,121,96,64,57,76,53,70,104,93,139,
+161,69,117,151,165,167,73,79,104,237,155,79,88,70,60,56,83,41,63,100,123,
+138,177,150,125,254,237,81,69,80,1,2,245,123,4,115,93,102,69,57,32,77,142,
+88,117,147,94,93,42,82,57,64,78,140,121,80,138,123,113,111,112,60,88,78,178,
+63,54,48,48,29,25,130,69,143,112,105,133,9,203,232,96,153,52,106,113,150,
+160,116,0,2,0,120,255,234,7,29,7,67,0,61,0,62,0,0,33,35,17,6,35,34,39,6,7,
+22,23,23,7,1,7,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,6,7,39,54,51,
+50,22,22,21,20,7,22,51,50,55,17,16,18,51,50,18,17,17,35,17,52,38,35,34,6,
+21,1,4,247,165,51,77,113,102,74,130,62,86,146,144,254,225,80,94,128,65,61,
+96,110,116,115,124,103,39,70,62,61,88,146,163,118,183,102,22,68,69,79,64,
+188,175,183,169,165,83,94,106,102,1,74,2,83,15,50,92,51,80,130,220,79,1,218,
+5,90,66,48,61,104,40,151,98,113,129,20,32,48,123,122,107,187,111,73,62,24,
+30,2,12,1,0,1,10,254,222,254,230,251,56,4,230,215,182,200,207,2,103,0,2,0,
+60,254,52,4,184,5,120,0,47,0,48,0,0,1,6,35,34,36,39,55,54,54,53,52,38,39,
+55,22,22,21,20,6,6,7,22,51,50,55,17,51,17,20,7,22,22,21,20,6,35,34,36,39,
+55,22,22,51,50,54,53,52,35,19,3,46,104,140,134,254,255,119,114,106,102,79,
+67,87,124,100,58,103,112,114,161,157,108,165,10,119,120,179,156,142,254,197,
+140,78,159,234,110,91,95,229,76,1,62,50,146,157,92,84,145,67,70,106,51,98,
+88,161,93,69,124,121,95,120,82,3,11,251,217,71,63,17,135,105,128,152,134,
+117,103,116,93,85,67,143,5,140,0,0,2,0,90,254,50,4,198,5,120,0,50,0,51,0,
+0,1,38,35,34,6,21,20,22,51,50,55,17,51,17,20,7,22,22,21,20,6,35,34,38,38,
+39,55,30,2,51,50,54,53,52,38,35,17,6,35,34,38,38,53,52,54,54,51,50,22,23,
+19,2,145,64,69,117,152,155,120,168,130,165,10,113,126,176,149,104,185,166,
+101,103,106,122,134,75,79,97,119,110,124,154,131,212,117,113,193,110,53,93,
+60,198,3,207,27,145,115,121,145,112,2,174,251,217,72,63,18,142,105,125,148,
+81,139,126,84,123,100,62,79,66,72,80,1,163,68,111,197,118,105,187,110,23,
+31,1,39,0,0,2,0,120,255,71,5,48,7,67,0,63,0,64,0,0,1,22,51,50,54,53,52,38,
+35,34,6,21,20,22,22,23,7,46,2,53,52,54,55,38,53,52,54,55,38,53,52,54,51,50,
+18,17,17,35,17,52,38,35,34,6,21,20,23,34,6,21,20,23,54,51,50,22,22,21,20,
+6,35,34,39,1,2,14,57,76,53,70,104,93,139,161,84,187,202,74,237,222,105,81,
+69,80,176,186,11,204,174,193,216,165,113,121,114,127,16,178,170,31,92,96,
+108,168,95,154,113,121,96,2,134,1,210,42,82,57,64,78,140,121,80,153,162,124,
+110,144,196,197,102,96,153,52,106,113,120,159,23,46,45,196,233,254,212,254,
+240,251,56,4,230,205,192,161,146,113,92,93,102,69,57,32,77,142,88,117,147,
+94,5,206,0,2,0,90,0,204,3,178,4,74,0,15,0,27,0,0,1,50,22,22,21,20,6,6,35,
+34,38,38,53,52,54,54,23,34,6,21,20,22,51,50,54,53,52,38,2,1,123,200,110,105,
+188,120,124,203,116,111,197,124,122,143,145,121,118,138,139,4,74,120,210,
+126,122,202,114,113,207,130,124,204,116,145,167,142,134,161,166,137,135,166,
+0,2,0,160,0,0,3,90,5,4,0,14,0,27,0,0,33,17,6,35,34,38,38,53,52,54,51,50,22,
+21,17,1,50,54,55,53,52,38,35,34,6,21,20,22,2,181,80,97,94,166,96,191,146,
+166,195,254,160,60,87,40,98,88,83,99,104,2,160,38,90,154,90,137,179,214,185,
+252,139,3,12,35,38,66,106,114,103,78,79,99,0,2,0,130,255,246,3,184,5,4,0,
+35,0,46,0,0,19,54,54,51,50,22,22,21,20,6,7,22,22,23,7,39,39,6,35,34,38,53,
+52,54,51,50,23,54,54,53,52,38,35,34,6,7,19,50,55,38,38,35,34,6,21,20,22,197,
+71,161,102,125,191,105,98,84,48,85,42,153,83,79,71,74,148,207,133,97,178,
+153,46,50,133,113,74,115,54,177,49,40,46,92,50,31,50,99,4,121,72,67,115,202,
+122,123,202,66,96,205,98,65,203,187,23,161,116,91,117,244,51,134,72,130,154,
+54,54,253,239,13,84,98,37,42,52,64,0,2,0,100,254,230,3,180,5,4,0,45,0,55,
+0,0,1,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,7,22,22,21,20,6,7,22,
+23,7,38,39,6,35,34,38,53,52,54,51,50,19,54,53,52,38,39,6,7,19,50,55,38,35,
+34,6,21,20,22,1,114,206,152,97,80,56,101,92,75,162,150,158,196,157,100,112,
+96,75,60,70,132,73,60,64,69,173,236,115,90,211,182,84,89,87,92,100,85,32,
+28,120,113,30,31,130,2,212,40,118,102,74,90,38,62,120,116,184,141,169,94,
+79,170,102,95,143,46,111,177,55,179,109,16,157,119,87,106,254,246,64,108,
+79,132,61,30,18,254,58,4,165,33,25,51,60,0,0,2,0,65,255,246,4,110,5,4,0,21,
+0,32,0,0,19,0,23,54,1,23,0,7,22,22,21,20,6,35,34,38,53,52,54,55,38,1,1,52,
+39,6,6,21,20,22,51,50,54,174,1,37,117,110,1,76,108,254,185,126,91,106,172,
+130,130,179,113,107,120,254,210,2,136,130,77,74,73,61,65,82,5,4,254,227,133,
+113,1,49,122,254,230,130,117,222,108,132,181,175,137,112,221,124,138,1,32,
+252,152,148,179,94,167,87,69,88,100,0,0,1,0,160,0,0,3,203,4,250,0,18,0,0,
+1,16,18,22,51,50,54,18,19,51,17,35,17,6,35,34,38,2,17,1,69,39,94,86,90,107,
+58,18,154,165,95,157,148,170,76,4,250,254,172,254,251,115,128,1,9,1,67,251,
+6,2,16,115,164,1,79,1,106,0,0,2,0,140,254,171,3,244,5,4,0,40,0,49,0,0,1,50,
+22,21,20,6,7,22,22,23,7,38,39,38,38,53,52,55,38,53,52,36,33,23,32,21,20,23,
+54,51,23,34,6,21,20,22,23,38,53,52,54,19,23,54,53,52,38,35,34,6,3,4,102,138,
+147,126,35,108,59,104,185,69,197,246,156,112,1,10,1,1,11,254,144,57,151,194,
+20,223,244,127,105,6,136,29,2,149,38,27,38,48,1,211,127,92,86,133,26,72,123,
+60,89,185,147,8,225,172,179,112,119,137,166,175,145,226,93,71,63,165,142,
+130,97,126,14,36,36,114,143,254,235,47,24,91,26,38,72,0,0,2,0,40,255,246,
+4,209,5,4,0,27,0,38,0,0,1,52,39,2,35,34,38,53,52,54,51,50,4,18,21,20,2,4,
+35,34,0,39,55,22,22,51,50,54,1,50,54,55,38,35,34,6,21,20,22,4,39,98,93,231,
+135,202,182,146,157,1,19,169,139,254,255,161,217,254,181,88,129,87,246,164,
+178,219,254,80,74,106,33,97,105,78,95,91,2,92,193,150,254,250,182,123,131,
+163,182,254,186,182,172,254,236,156,1,10,253,50,218,201,253,1,181,115,128,
+66,88,71,64,86,0,1,0,120,255,227,5,69,3,168,0,37,0,0,1,35,34,4,6,21,20,22,
+51,50,55,54,51,50,22,23,7,39,38,35,34,6,7,6,35,34,38,38,53,52,54,55,39,6,
+35,35,39,33,4,211,212,210,254,202,163,138,117,93,104,103,82,81,163,128,83,
+72,112,95,38,75,57,104,108,118,199,113,141,121,2,63,93,149,10,4,81,3,23,103,
+185,117,109,132,59,58,77,114,100,57,89,26,32,59,104,185,115,132,197,60,5,
+7,145,0,0,1,0,120,255,227,5,69,5,105,0,55,0,0,1,50,23,7,38,38,35,34,6,21,
+20,22,23,23,35,34,4,6,21,20,22,51,50,55,54,51,50,22,23,7,39,38,35,34,6,7,
+6,35,34,38,38,53,52,54,55,39,6,35,35,39,33,38,38,53,52,54,3,221,160,177,79,
+83,97,48,40,49,158,137,10,212,210,254,202,163,138,117,93,104,103,82,81,163,
+128,83,72,112,95,38,75,57,104,108,118,199,113,141,121,2,63,93,149,10,3,60,
+82,101,128,5,105,157,96,65,43,41,35,62,122,44,145,103,185,117,109,132,59,
+58,77,114,100,57,89,26,32,59,104,185,115,132,197,60,5,7,145,49,120,79,90,
+111,0,3,0,160,255,52,3,174,5,120,0,33,0,34,0,35,0,0,19,52,54,55,38,38,53,
+17,51,17,20,22,51,50,55,17,51,17,35,17,52,55,39,14,2,21,20,22,22,23,7,38,
+38,1,3,160,97,97,92,97,165,100,92,150,105,165,165,5,4,203,170,80,28,59,89,
+109,130,102,2,188,1,1,9,105,150,54,45,178,128,1,93,254,143,111,115,82,2,1,
+251,6,1,190,105,30,3,62,90,113,81,54,93,99,115,81,156,211,4,213,250,136,0,
+6,0,95,254,112,5,149,5,120,0,46,0,61,0,72,0,87,0,88,0,89,0,0,55,52,54,55,
+38,38,53,52,54,51,50,23,17,51,17,20,7,51,54,51,50,22,21,20,7,22,21,20,7,39,
+54,53,52,35,34,6,7,17,35,53,52,55,35,6,35,34,38,1,52,55,35,6,35,34,39,6,21,
+20,22,51,50,55,1,50,55,53,38,35,34,6,21,20,22,5,50,23,54,53,52,38,35,34,7,
+21,20,7,51,54,3,3,95,62,60,57,65,205,152,146,129,165,5,5,107,132,135,163,
+62,62,109,157,101,118,57,120,77,165,5,5,125,143,155,209,2,120,5,5,125,143,
+46,47,106,97,82,145,143,254,224,145,143,129,126,92,120,102,3,1,41,50,42,63,
+55,111,143,5,5,107,179,10,190,62,121,51,46,130,78,136,177,87,1,114,254,189,
+96,40,96,176,144,124,147,84,123,200,240,51,230,179,155,75,88,253,245,242,
+99,17,98,186,1,18,99,17,98,11,64,117,74,90,153,1,69,153,142,67,106,82,77,
+97,51,12,99,91,73,82,163,130,96,40,96,3,199,248,248,0,0,3,0,160,255,246,3,
+171,5,120,0,22,0,23,0,24,0,0,55,1,38,38,53,17,51,17,20,22,51,50,54,55,17,
+51,17,35,17,52,55,35,1,1,3,160,1,67,152,169,165,100,92,64,140,51,165,165,
+5,3,254,7,2,77,1,120,1,12,17,199,171,1,243,253,249,111,115,73,59,2,101,251,
+6,1,36,136,35,254,39,5,130,250,136,0,0,1,0,80,1,12,2,230,5,7,0,17,0,0,1,52,
+2,39,55,18,17,20,6,35,34,38,39,55,22,51,50,54,2,66,91,112,131,236,162,127,
+101,198,74,110,132,114,69,73,2,128,124,1,16,176,75,254,154,254,188,150,187,
+148,126,72,201,123,0,1,0,140,254,52,5,17,5,4,0,51,0,0,1,6,35,34,38,53,52,
+55,38,53,16,33,23,34,6,21,20,23,54,51,23,34,6,21,20,22,51,50,55,17,51,17,
+20,7,22,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,35,3,135,144,179,193,
+247,165,132,1,217,11,163,155,81,122,150,20,195,212,141,112,189,156,165,7,
+108,128,179,156,142,254,197,140,78,159,234,110,91,95,229,1,21,77,180,145,
+157,94,107,120,1,25,145,81,85,75,74,38,165,99,94,75,85,108,3,54,251,197,61,
+54,15,129,112,128,152,134,117,103,116,93,85,67,143,0,1,0,140,253,225,5,152,
+5,4,0,55,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,23,17,6,35,34,
+38,53,52,55,38,53,16,33,23,34,6,21,20,23,54,51,23,34,6,21,20,22,51,50,55,
+17,51,17,20,7,30,2,23,5,43,38,170,214,66,71,99,80,24,139,181,157,129,18,144,
+179,193,247,165,132,1,217,11,163,155,81,122,150,20,195,212,141,112,189,156,
+165,27,83,132,103,73,253,225,75,1,77,64,48,56,65,2,121,148,113,109,131,1,
+1,12,77,180,145,157,94,107,120,1,25,145,81,85,75,74,38,165,99,94,75,85,108,
+3,54,251,197,126,85,33,126,153,156,0,2,0,140,0,0,6,82,7,67,0,45,0,46,0,0,
+1,34,6,21,20,22,51,50,55,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,17,35,
+17,6,35,34,38,53,52,55,38,53,16,33,23,34,6,21,20,23,54,51,1,2,200,195,212,
+141,112,189,156,168,188,1,103,165,82,102,108,93,165,144,179,193,247,165,132,
+1,217,11,163,155,81,122,150,2,194,2,185,99,94,75,85,108,3,54,1,9,1,1,253,
+196,251,56,4,230,219,178,188,219,251,36,1,21,77,180,145,157,94,107,120,1,
+25,145,81,85,75,74,38,3,229,0,0,1,0,140,254,92,4,90,5,4,0,43,0,0,37,16,33,
+34,38,39,55,22,22,51,50,54,53,53,6,35,34,38,53,52,55,38,53,16,33,23,34,6,
+21,20,23,54,51,23,34,6,21,20,22,51,50,55,17,51,4,90,254,62,123,253,148,86,
+120,206,102,153,142,144,179,193,247,165,132,1,217,11,163,155,81,122,150,20,
+195,212,141,112,189,156,165,80,254,12,107,119,103,95,89,186,189,177,77,180,
+145,157,94,107,120,1,25,145,81,85,75,74,38,165,99,94,75,85,108,3,54,0,0,1,
+0,60,253,225,5,63,5,4,0,49,0,0,1,22,22,21,20,6,6,7,22,51,50,55,17,51,17,20,
+7,30,2,23,7,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,23,17,6,35,32,3,
+55,54,53,52,38,39,1,67,124,100,58,103,112,114,161,157,108,165,27,83,132,103,
+73,109,38,170,214,66,71,99,80,24,139,181,157,129,18,104,140,254,232,230,114,
+208,79,67,5,4,88,161,93,69,124,121,95,120,82,3,11,251,197,126,85,33,126,153,
+156,55,75,1,77,64,48,56,65,2,121,148,113,109,131,1,1,53,50,1,47,92,165,131,
+70,106,51,0,2,0,60,0,0,5,249,7,67,0,41,0,42,0,0,33,35,17,6,35,34,36,39,55,
+54,54,53,52,38,39,55,22,22,21,20,6,6,7,22,51,50,55,17,16,18,51,32,17,17,35,
+17,52,38,35,34,6,21,1,3,211,165,104,140,134,254,255,119,114,106,102,79,67,
+87,124,100,58,103,112,114,161,157,108,168,188,1,103,165,82,102,108,93,1,73,
+1,62,50,146,157,92,84,145,67,70,106,51,98,88,161,93,69,124,121,95,120,82,
+3,11,1,9,1,1,253,196,251,56,4,230,219,178,188,219,2,103,0,1,0,130,254,52,
+5,206,5,4,0,48,0,0,1,52,38,35,34,6,21,17,20,6,35,34,38,53,19,51,17,20,51,
+50,54,53,17,16,33,50,22,21,17,20,7,22,22,21,20,6,35,34,36,39,55,22,22,51,
+50,54,53,52,35,4,68,84,81,74,80,172,148,149,174,1,165,147,79,86,1,53,150,
+190,10,119,120,179,156,142,254,197,140,78,159,234,110,91,95,229,3,114,135,
+122,122,114,254,67,167,196,203,179,3,29,252,217,227,113,115,1,189,1,115,233,
+179,253,107,71,63,17,135,105,128,152,134,117,103,116,93,85,67,143,0,1,0,130,
+253,225,6,85,5,4,0,52,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,
+23,17,52,38,35,34,6,21,17,20,6,35,34,38,53,19,51,17,20,51,50,54,53,17,16,
+33,50,22,21,17,20,7,30,2,23,5,232,38,170,214,66,71,99,80,24,139,181,157,129,
+18,84,81,74,80,172,148,149,174,1,165,147,79,86,1,53,150,190,27,83,132,103,
+73,253,225,75,1,77,64,48,56,65,2,121,148,113,109,131,1,3,105,135,122,122,
+114,254,67,167,196,203,179,3,29,252,217,227,113,115,1,189,1,115,233,179,253,
+87,126,85,33,126,153,156,0,1,0,130,254,36,5,32,5,4,0,39,0,0,37,16,0,35,32,
+1,55,4,51,50,54,53,17,52,38,35,34,6,21,17,20,6,35,34,38,53,19,51,17,20,51,
+50,54,53,17,16,33,50,22,21,5,32,254,240,239,254,213,254,140,83,1,58,254,187,
+179,84,81,74,80,172,148,149,174,1,165,147,79,86,1,53,150,190,81,254,251,254,
+216,1,4,111,226,213,216,3,16,135,122,122,114,254,67,167,196,203,179,3,29,
+252,217,227,113,115,1,189,1,115,233,179,0,1,0,130,253,68,4,226,5,4,0,59,0,
+0,55,52,54,55,38,53,52,36,33,23,32,21,20,23,54,51,23,34,6,21,20,22,51,50,
+55,23,6,35,34,38,53,52,55,6,6,21,20,4,33,50,22,21,20,6,35,34,36,39,55,22,
+51,50,54,53,52,38,35,34,36,38,130,226,204,111,1,10,1,1,11,254,144,77,165,
+161,20,247,210,129,114,164,147,50,158,181,191,229,45,87,89,1,50,1,8,197,188,
+184,141,149,254,208,125,75,255,222,90,96,82,98,230,254,154,187,208,156,253,
+71,121,134,166,175,145,226,110,77,36,165,116,127,107,113,100,147,97,201,173,
+79,55,53,160,97,170,188,132,143,112,143,119,104,98,176,65,62,58,55,131,234,
+0,1,0,10,253,85,4,189,5,4,0,64,0,0,1,32,21,20,23,54,51,23,34,6,21,20,22,51,
+50,55,23,6,35,34,38,53,52,55,6,6,21,20,22,23,39,53,52,54,51,50,30,4,23,7,
+39,2,35,34,6,21,20,22,23,7,34,36,2,53,52,18,55,38,53,52,36,33,3,125,254,144,
+82,154,167,20,247,210,134,109,161,150,50,158,181,186,234,8,81,88,110,96,1,
+157,129,81,135,110,88,68,48,17,109,38,170,214,66,71,99,80,24,180,254,188,
+186,250,220,121,1,10,1,1,4,115,226,112,80,41,165,116,127,101,119,100,147,
+97,211,173,50,24,75,216,119,131,225,71,10,9,109,131,54,86,110,110,102,36,
+55,75,1,77,64,48,56,65,2,121,190,1,57,176,208,1,77,89,121,144,166,175,0,2,
+0,40,254,107,5,237,7,67,0,64,0,65,0,0,1,6,21,20,22,51,50,54,55,23,6,6,35,
+34,36,38,53,52,18,55,38,53,52,54,55,38,53,52,54,51,50,18,17,17,35,17,52,38,
+35,34,6,21,20,23,34,6,21,20,23,54,51,23,34,6,21,20,22,51,50,55,23,6,35,34,
+38,1,1,89,140,246,204,96,213,101,49,123,220,106,172,254,224,165,237,203,121,
+193,189,11,207,171,198,211,165,111,123,118,123,16,180,188,82,152,169,20,247,
+210,134,109,164,147,50,158,181,189,222,3,185,1,167,98,197,171,217,49,50,139,
+57,48,142,251,150,168,1,34,82,121,144,141,169,23,46,45,194,235,254,222,254,
+230,251,56,4,230,209,188,160,147,113,92,109,117,112,80,41,165,116,127,100,
+120,100,147,97,236,6,97,0,2,0,110,255,246,5,206,7,67,0,40,0,41,0,0,1,20,6,
+7,6,6,21,20,22,51,50,54,55,23,6,33,34,38,38,53,52,54,55,54,54,53,53,16,18,
+51,32,17,17,35,17,52,38,35,34,6,17,1,2,237,116,121,128,109,146,122,105,212,
+126,105,248,254,227,120,207,121,114,123,131,106,221,218,1,207,165,136,147,
+154,135,2,5,4,8,94,174,96,102,150,77,95,109,88,108,125,216,99,174,101,96,
+177,99,105,145,76,182,1,48,1,52,253,126,251,66,4,210,253,224,232,254,247,
+2,133,0,2,0,100,255,246,5,138,7,67,0,65,0,66,0,0,1,34,6,21,20,22,23,30,3,
+21,20,6,6,35,34,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,
+53,52,38,39,46,3,53,52,54,55,38,53,52,54,51,50,18,17,17,35,17,16,33,34,6,
+21,20,1,2,242,171,164,90,92,200,101,62,30,109,196,122,126,215,126,132,99,
+83,133,53,115,61,73,43,43,175,117,126,146,91,91,207,98,61,27,186,162,11,212,
+182,207,226,165,254,254,122,135,1,174,4,115,97,100,58,102,50,107,76,80,82,
+51,105,157,84,91,161,95,90,116,79,90,71,95,46,35,79,103,115,96,64,107,48,
+108,73,80,81,50,127,166,24,46,47,194,235,254,209,254,243,251,56,4,230,1,141,
+157,150,113,2,116,0,0,2,0,100,255,246,5,243,7,67,0,55,0,56,0,0,1,34,6,21,
+20,23,50,55,54,51,50,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,39,34,
+7,6,35,34,38,53,52,54,55,38,53,52,54,51,50,18,17,17,35,17,52,38,35,34,6,21,
+20,1,3,41,194,206,24,72,125,125,51,134,176,224,186,169,254,221,146,118,138,
+210,119,123,143,94,49,111,111,43,134,165,216,198,12,227,192,217,241,165,147,
+136,134,148,1,214,4,115,150,147,77,55,24,24,219,161,171,217,198,239,75,208,
+159,140,123,139,66,19,19,160,127,170,220,31,45,49,195,234,254,209,254,243,
+251,56,4,230,201,196,161,146,113,2,116,0,3,0,100,255,246,5,196,7,67,0,48,
+0,59,0,60,0,0,1,20,6,7,6,6,21,20,22,51,55,38,53,52,54,51,50,22,22,21,20,6,
+6,35,34,38,38,53,52,54,55,54,54,53,53,16,18,51,32,17,17,35,17,52,38,35,34,
+6,17,3,20,23,54,54,53,52,38,35,34,6,1,2,227,117,120,131,106,181,147,81,117,
+150,112,77,124,71,127,220,131,139,238,136,113,124,123,114,221,218,1,207,165,
+136,147,154,135,17,65,63,76,52,45,46,61,2,69,4,38,103,180,91,100,141,78,108,
+126,5,96,111,97,128,68,118,65,96,151,84,105,183,111,97,169,96,95,164,92,142,
+1,48,1,52,253,126,251,66,4,210,253,224,232,254,247,252,128,77,72,24,82,56,
+39,57,63,5,215,0,0,2,0,120,0,0,5,252,7,67,0,35,0,36,0,0,19,52,54,36,37,18,
+54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,52,55,39,14,3,21,20,22,22,
+23,7,2,1,120,123,1,2,1,78,2,163,173,1,103,165,82,102,108,93,165,5,3,112,195,
+144,83,29,54,89,115,222,4,149,2,206,118,173,144,112,1,26,249,253,196,251,
+56,4,230,219,178,188,219,251,36,3,176,115,20,3,34,66,87,118,86,58,107,112,
+141,74,1,60,5,64,0,0,3,0,90,0,0,6,43,7,67,0,43,0,54,0,55,0,0,1,50,22,21,20,
+6,7,7,22,22,51,50,55,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,
+6,35,34,36,39,55,54,55,38,38,53,52,54,23,20,22,23,54,53,52,38,35,34,6,1,1,
+160,118,153,142,164,77,51,149,85,165,110,168,188,1,103,165,82,102,108,93,
+165,110,144,139,254,248,117,70,148,75,94,91,121,34,54,57,58,53,38,38,40,3,
+238,5,4,150,112,115,207,113,54,55,65,94,2,255,1,9,1,1,253,196,251,56,4,230,
+219,178,188,219,251,36,1,71,59,149,154,45,93,70,72,143,83,91,116,227,50,90,
+48,85,85,47,63,54,2,252,0,0,2,0,120,255,246,5,31,7,67,0,47,0,48,0,0,1,34,
+6,21,20,22,51,50,55,23,6,35,34,38,53,52,55,38,53,52,54,55,38,53,52,54,51,
+50,18,17,17,35,17,52,38,35,34,6,21,20,23,34,6,21,20,23,54,51,1,2,230,247,
+210,134,109,164,147,50,158,181,191,239,163,130,193,189,11,207,171,198,211,
+165,111,123,118,123,16,180,188,82,132,189,1,111,2,85,116,127,100,120,100,
+147,97,216,169,194,100,125,149,141,169,23,46,45,194,235,254,222,254,230,251,
+56,4,230,209,188,160,147,113,92,109,117,111,82,42,4,73,0,0,2,0,120,0,0,6,
+62,7,67,0,36,0,37,0,0,33,35,17,6,35,34,38,53,52,54,55,3,55,1,34,6,21,20,22,
+51,50,55,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,1,4,24,165,144,179,193,
+247,178,161,198,134,1,41,195,212,141,112,189,156,168,188,1,103,165,82,102,
+108,93,1,75,1,81,77,180,145,114,164,37,1,52,76,253,241,99,94,75,85,108,2,
+250,1,9,1,1,253,196,251,56,4,230,219,178,188,219,2,103,0,3,0,90,0,0,6,76,
+7,67,0,33,0,43,0,44,0,0,33,35,17,52,55,35,6,7,22,22,21,20,6,35,34,38,53,52,
+0,37,18,54,51,32,17,17,35,17,52,38,35,34,6,21,1,52,39,6,21,20,22,51,50,54,
+1,4,38,165,10,10,242,180,76,67,141,114,123,150,1,191,1,122,2,163,173,1,103,
+165,82,102,108,93,253,159,78,120,48,42,50,58,3,171,3,186,95,40,92,146,84,
+164,91,117,151,155,126,201,1,140,142,1,27,249,253,196,251,56,4,230,219,178,
+188,219,253,75,118,89,133,127,48,61,86,5,104,0,0,3,0,110,0,0,6,155,7,67,0,
+42,0,52,0,53,0,0,33,35,17,52,55,39,6,7,22,21,20,6,35,34,38,53,52,37,38,39,
+6,7,39,54,55,22,23,54,55,18,54,51,32,17,17,35,17,52,38,35,34,6,21,1,52,39,
+6,21,20,22,51,50,54,1,4,117,165,5,3,193,119,71,145,120,118,155,1,30,43,60,
+100,132,40,204,153,87,53,140,247,2,162,174,1,103,165,82,102,108,93,253,199,
+32,176,48,43,54,63,3,131,3,156,113,37,3,99,83,197,176,141,167,167,124,222,
+223,99,91,18,49,128,69,14,135,112,94,129,1,29,251,253,196,251,56,4,230,219,
+178,188,219,253,85,108,126,160,157,57,62,109,5,111,0,0,3,0,145,0,0,6,70,7,
+67,0,41,0,51,0,52,0,0,33,35,17,52,55,39,6,6,7,7,22,21,20,6,35,34,38,53,52,
+55,38,39,55,22,23,54,54,55,16,18,51,32,17,17,35,17,52,38,35,34,6,21,1,52,
+39,6,21,20,22,51,50,54,1,4,32,165,5,3,50,115,117,50,71,127,108,106,142,221,
+85,140,117,137,93,180,172,65,165,173,1,103,165,82,102,107,94,253,189,38,125,
+41,35,42,45,3,141,3,111,108,27,3,52,77,59,27,160,120,115,133,141,115,190,
+149,152,177,86,175,168,90,129,80,1,36,1,8,253,196,251,56,4,230,219,178,199,
+221,253,83,73,103,98,111,45,49,73,5,87,0,0,3,0,90,255,87,5,235,7,67,0,46,
+0,58,0,59,0,0,1,22,22,21,20,6,7,6,6,21,20,22,51,50,55,17,16,18,51,32,17,17,
+35,17,52,38,35,34,6,21,17,35,17,6,35,34,38,53,52,54,55,54,54,53,52,38,39,
+19,52,54,51,50,22,21,20,6,35,34,38,1,1,127,118,76,80,81,82,79,125,113,164,
+143,168,188,1,103,165,82,102,108,93,165,143,143,177,247,79,82,89,72,41,86,
+85,57,53,54,59,59,54,52,58,3,157,5,4,113,135,75,55,106,58,58,97,49,70,75,
+91,3,22,1,9,1,1,253,196,251,56,4,230,219,178,188,219,251,36,1,53,61,182,133,
+58,112,62,66,85,42,46,77,85,251,38,58,62,62,58,58,65,65,7,171,0,4,0,110,255,
+246,5,239,7,67,0,34,0,50,0,61,0,62,0,0,1,16,2,35,34,0,17,52,18,54,51,50,23,
+38,53,52,54,51,50,18,17,17,35,17,52,38,35,34,6,21,20,22,23,22,22,5,23,54,
+54,51,50,22,23,53,55,52,38,35,34,2,21,23,22,22,51,50,54,53,38,35,34,6,1,4,
+66,243,225,240,254,240,129,225,145,150,108,35,171,147,190,179,165,86,108,
+87,94,26,30,29,26,252,209,1,67,177,76,79,149,100,1,148,151,162,189,17,20,
+172,118,148,165,144,155,80,176,3,171,2,108,254,211,254,183,1,110,1,63,174,
+1,30,149,77,80,110,184,215,254,222,254,230,251,56,4,230,223,174,148,129,102,
+177,102,104,171,105,4,36,43,38,52,15,26,254,246,254,238,241,172,144,173,175,
+159,75,51,5,86,0,0,3,0,100,255,123,6,17,7,67,0,41,0,53,0,54,0,0,1,38,35,34,
+6,21,20,22,51,50,55,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,
+6,35,34,38,38,53,52,54,54,51,50,22,23,1,52,54,51,50,22,21,20,6,35,34,38,1,
+2,155,64,69,117,152,155,120,168,130,168,188,1,103,165,82,102,108,93,165,124,
+154,131,212,117,113,193,110,53,93,60,254,190,57,53,54,59,59,54,52,58,3,165,
+3,207,27,145,115,121,145,112,2,174,1,9,1,1,253,196,251,56,4,230,219,178,188,
+219,251,36,1,143,68,111,197,118,105,187,110,23,31,251,165,58,62,62,58,58,
+65,65,7,135,0,3,0,120,255,234,6,195,7,67,0,50,0,60,0,61,0,0,33,35,17,38,39,
+6,7,22,23,7,1,6,35,34,38,53,52,54,51,50,23,54,55,38,38,53,52,54,51,50,22,
+21,20,7,22,23,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,5,20,23,54,53,52,
+38,35,34,6,1,4,157,165,201,96,69,103,86,166,130,254,245,44,46,79,113,68,58,
+91,96,85,56,166,152,138,115,151,168,42,101,129,168,188,1,103,165,82,102,108,
+93,253,8,217,25,73,65,52,52,4,66,1,182,76,43,90,56,98,237,98,1,123,10,80,
+61,48,56,73,40,71,95,203,118,105,133,217,188,110,99,45,45,2,182,1,9,1,1,253,
+196,251,56,4,230,219,178,188,219,218,153,128,69,83,114,128,62,3,14,0,3,0,
+150,0,0,5,167,7,67,0,29,0,38,0,39,0,0,33,35,17,52,55,35,6,6,35,34,38,53,17,
+51,1,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,1,50,55,38,39,1,17,20,22,
+1,3,129,165,5,5,32,113,60,175,202,165,1,161,168,188,1,103,165,82,102,108,
+93,254,117,106,92,72,47,254,246,89,3,55,1,46,146,25,28,40,223,193,1,197,254,
+3,1,253,1,9,1,1,253,196,251,56,4,230,219,178,188,219,253,73,87,29,61,1,79,
+254,207,106,101,5,30,0,3,0,100,254,102,5,243,7,67,0,55,0,67,0,68,0,0,1,34,
+6,21,20,23,50,55,54,51,50,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,
+39,34,7,6,35,34,38,53,52,54,55,38,53,52,54,51,50,18,17,17,35,17,52,38,35,
+34,6,21,20,1,52,54,51,50,22,21,20,6,35,34,38,1,3,41,194,206,24,72,125,125,
+51,134,176,224,186,169,254,221,146,118,138,210,119,123,143,94,49,111,111,
+43,134,165,216,198,12,227,192,217,241,165,147,136,134,148,254,245,57,53,54,
+59,59,54,52,58,3,9,4,115,150,147,77,55,24,24,219,161,171,217,198,239,75,208,
+159,140,123,139,66,19,19,160,127,170,220,31,45,49,195,234,254,209,254,243,
+251,56,4,230,201,196,161,146,113,250,18,58,62,62,58,58,65,65,8,156,0,0,1,
+0,60,254,92,4,10,5,4,0,37,0,0,37,16,33,34,38,39,55,22,22,51,50,54,53,53,6,
+35,32,3,55,54,53,52,38,39,55,22,22,21,20,6,6,7,22,51,50,55,17,51,4,10,254,
+62,123,253,148,86,120,206,102,153,142,104,140,254,232,230,114,208,79,67,87,
+124,100,58,103,112,114,161,157,108,165,80,254,12,107,119,103,95,89,186,189,
+218,50,1,47,92,165,131,70,106,51,98,88,161,93,69,124,121,95,120,82,3,11,0,
+0,4,0,100,254,120,5,196,7,67,0,48,0,60,0,71,0,72,0,0,1,20,6,7,6,6,21,20,22,
+51,55,38,53,52,54,51,50,22,22,21,20,6,6,35,34,38,38,53,52,54,55,54,54,53,
+53,16,18,51,32,17,17,35,17,52,38,35,34,6,17,3,52,54,51,50,22,21,20,6,35,34,
+38,19,20,23,54,54,53,52,38,35,34,6,1,2,227,117,120,131,106,181,147,81,117,
+150,112,77,124,71,127,220,131,139,238,136,113,124,123,114,221,218,1,207,165,
+136,147,154,135,219,57,53,54,59,59,54,52,58,202,65,63,76,52,45,46,61,2,21,
+4,38,103,180,91,100,141,78,108,126,5,96,111,97,128,68,118,65,96,151,84,105,
+183,111,97,169,96,95,164,92,142,1,48,1,52,253,126,251,66,4,210,253,224,232,
+254,247,250,53,58,62,62,58,58,65,65,2,133,77,72,24,82,56,39,57,63,5,215,0,
+0,2,0,180,0,0,7,113,7,67,0,34,0,35,0,0,1,33,17,35,17,51,17,33,17,51,17,33,
+17,16,18,51,50,18,17,17,35,17,52,38,35,34,6,6,21,17,35,17,33,17,35,1,2,173,
+254,172,165,165,1,84,165,1,84,169,185,185,176,165,83,103,78,84,37,165,254,
+172,165,3,232,2,50,253,206,4,250,253,201,2,55,253,201,2,5,1,53,1,7,254,246,
+254,206,251,56,4,230,223,174,85,188,184,251,86,2,50,253,206,7,67,0,1,0,180,
+254,52,6,48,4,250,0,38,0,0,1,33,17,35,17,51,17,33,17,51,17,33,17,51,17,6,
+7,22,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,35,17,33,17,35,2,173,
+254,172,165,165,1,84,165,1,84,165,2,8,119,120,179,156,142,254,197,140,78,
+159,234,110,91,95,229,254,172,165,2,50,253,206,4,250,253,201,2,55,253,201,
+2,55,251,196,69,44,17,135,105,128,152,134,117,103,116,93,85,67,143,2,70,253,
+206,0,1,0,180,254,12,5,75,4,250,0,29,0,0,1,33,17,35,17,51,17,33,17,51,17,
+33,17,51,17,20,2,7,7,39,62,4,53,17,33,17,35,2,173,254,172,165,165,1,84,165,
+1,84,165,178,217,113,69,138,100,83,59,32,254,172,165,2,50,253,206,4,250,253,
+201,2,55,253,201,2,55,251,156,206,254,233,107,58,130,69,67,82,105,135,82,
+1,136,253,206,0,0,1,0,180,253,225,6,185,4,250,0,43,0,0,1,33,17,35,17,51,17,
+33,17,51,17,33,17,51,17,20,6,7,30,2,23,7,39,2,35,34,6,21,20,22,23,7,34,38,
+53,52,54,51,23,17,33,17,35,2,173,254,172,165,165,1,84,165,1,84,165,20,7,72,
+134,113,74,109,38,170,214,66,71,99,80,24,139,181,157,129,16,254,172,165,2,
+50,253,206,4,250,253,201,2,55,253,201,2,55,251,197,74,129,7,29,116,166,158,
+55,75,1,77,64,48,56,65,2,121,148,113,109,131,1,2,41,253,206,0,1,0,120,254,
+52,4,187,4,250,0,41,0,0,1,52,55,39,14,3,21,20,22,22,23,7,2,53,52,54,36,37,
+51,17,20,7,22,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,35,3,49,5,3,
+112,195,144,83,29,54,89,115,222,129,1,20,1,81,120,10,119,120,179,156,142,
+254,197,140,78,159,234,110,91,95,229,3,176,115,20,3,34,66,87,118,86,58,107,
+112,141,74,1,60,203,121,177,148,110,251,217,71,63,17,135,105,128,152,134,
+117,103,116,93,85,67,143,0,1,0,120,254,12,3,214,4,250,0,32,0,0,1,62,4,53,
+17,52,55,39,14,3,21,20,22,22,23,7,2,53,52,54,36,37,51,17,20,2,7,7,1,149,138,
+100,83,59,32,5,3,112,195,144,83,29,54,89,115,222,129,1,20,1,81,120,178,217,
+113,254,142,69,67,82,105,135,82,3,6,115,20,3,34,66,87,118,86,58,107,112,141,
+74,1,60,203,121,177,148,110,251,156,206,254,233,107,58,0,2,0,90,254,50,5,
+11,4,250,0,42,0,52,0,0,1,52,55,35,6,7,22,22,21,20,6,35,34,38,53,52,0,37,51,
+17,20,7,22,22,21,20,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,1,52,39,
+6,21,20,22,51,50,54,3,129,10,10,242,180,76,67,141,114,123,150,1,202,1,138,
+120,10,113,126,176,149,104,185,166,101,103,106,122,134,75,79,97,119,110,254,
+68,78,120,48,42,50,58,3,186,95,40,92,146,84,164,91,117,151,155,126,204,1,
+144,145,251,217,72,63,18,142,105,125,148,81,139,126,84,123,100,62,79,66,72,
+80,2,59,118,89,133,127,48,61,86,0,0,1,0,120,254,50,4,253,5,4,0,45,0,0,37,
+20,7,22,22,21,20,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,17,6,35,34,
+38,53,52,54,55,3,55,1,34,6,21,20,22,51,50,55,17,51,4,24,10,113,126,176,149,
+104,185,166,101,103,106,122,134,75,79,97,119,110,144,179,193,247,178,161,
+198,134,1,41,195,212,141,112,189,156,165,211,72,63,18,142,105,125,148,81,
+139,126,84,123,100,62,79,66,72,80,1,101,77,180,145,114,164,37,1,52,76,253,
+241,99,94,75,85,108,2,250,0,0,2,0,90,254,92,4,40,4,250,0,31,0,41,0,0,37,16,
+33,34,38,39,55,22,22,51,50,54,53,17,52,55,35,6,7,22,22,21,20,6,35,34,38,53,
+52,0,37,51,1,52,39,6,21,20,22,51,50,54,4,40,254,62,123,253,148,86,120,206,
+102,153,142,10,10,242,180,76,67,141,114,123,150,1,202,1,138,120,253,159,78,
+120,48,42,50,58,80,254,12,107,119,103,95,89,186,189,3,86,95,40,92,146,84,
+164,91,117,151,155,126,204,1,144,145,253,45,118,89,133,127,48,61,86,0,2,0,
+90,253,225,5,146,4,250,0,43,0,53,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,
+52,54,51,23,17,52,55,35,6,7,22,22,21,20,6,35,34,38,53,52,0,37,51,17,20,7,
+30,2,23,1,52,39,6,21,20,22,51,50,54,5,37,38,170,214,66,71,99,80,24,139,181,
+157,129,18,10,10,242,180,76,67,141,114,123,150,1,202,1,138,120,27,83,132,
+103,73,252,51,78,120,48,42,50,58,253,225,75,1,77,64,48,56,65,2,121,148,113,
+109,131,1,3,177,95,40,92,146,84,164,91,117,151,155,126,204,1,144,145,251,
+197,126,85,33,126,153,156,4,15,118,89,133,127,48,61,86,0,1,0,120,253,225,
+5,66,4,250,0,45,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,23,17,
+52,55,39,14,3,21,20,22,22,23,7,2,53,52,54,36,37,51,17,20,7,30,2,23,4,213,
+38,170,214,66,71,99,80,24,139,181,157,129,18,5,3,112,195,144,83,29,54,89,
+115,222,129,1,20,1,81,120,27,83,132,103,73,253,225,75,1,77,64,48,56,65,2,
+121,148,113,109,131,1,3,167,115,20,3,34,66,87,118,86,58,107,112,141,74,1,
+60,203,121,177,148,110,251,197,126,85,33,126,153,156,0,2,0,90,254,50,4,234,
+5,4,0,51,0,62,0,0,1,6,35,32,3,55,54,55,38,38,53,52,54,51,50,22,21,20,6,7,
+7,22,22,51,50,55,17,51,17,20,7,22,22,21,20,6,35,34,38,38,39,55,30,2,51,50,
+54,53,52,38,35,1,20,22,23,54,53,52,38,35,34,6,3,96,110,144,254,222,230,70,
+148,75,94,91,121,97,118,153,142,164,77,51,149,85,165,110,165,10,113,126,176,
+149,104,185,166,101,103,106,122,134,75,79,97,119,110,254,1,54,57,58,53,38,
+38,40,1,71,59,1,47,45,93,70,72,143,83,91,116,150,112,115,207,113,54,55,65,
+94,2,255,251,217,72,63,18,142,105,125,148,81,139,126,84,123,100,62,79,66,
+72,80,4,53,50,90,48,85,85,47,63,54,0,2,0,90,254,12,4,5,5,4,0,39,0,50,0,0,
+37,20,2,7,7,39,62,4,53,53,6,35,32,3,55,54,55,38,38,53,52,54,51,50,22,21,20,
+6,7,7,22,22,51,50,55,17,51,5,20,22,23,54,53,52,38,35,34,6,4,5,178,217,113,
+69,138,100,83,59,32,110,144,254,222,230,70,148,75,94,91,121,97,118,153,142,
+164,77,51,149,85,165,110,165,253,92,54,57,58,53,38,38,40,150,206,254,233,
+107,58,130,69,67,82,105,135,82,157,59,1,47,45,93,70,72,143,83,91,116,150,
+112,115,207,113,54,55,65,94,2,255,217,50,90,48,85,85,47,63,54,0,2,0,90,253,
+225,5,114,5,4,0,51,0,62,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,
+23,17,6,35,32,3,55,54,55,38,38,53,52,54,51,50,22,21,20,6,7,7,22,22,51,50,
+55,17,51,17,20,7,22,22,23,1,20,22,23,54,53,52,38,35,34,6,5,5,38,170,214,66,
+71,99,80,24,139,181,157,129,17,110,144,254,222,230,70,148,75,94,91,121,97,
+118,153,142,164,77,51,149,85,165,110,165,27,106,181,105,251,239,54,57,58,
+53,38,38,40,253,225,75,1,77,64,48,56,65,2,121,148,113,109,131,1,1,62,59,1,
+47,45,93,70,72,143,83,91,116,150,112,115,207,113,54,55,65,94,2,255,251,197,
+129,81,42,201,226,6,9,50,90,48,85,85,47,63,54,0,0,1,0,120,254,12,4,24,5,4,
+0,29,0,0,37,16,0,5,39,36,0,53,53,6,35,34,38,53,52,54,55,3,55,1,34,6,21,20,
+22,51,50,55,17,51,4,24,254,108,254,139,20,1,69,1,51,144,179,193,247,178,161,
+198,134,1,41,195,212,141,112,189,156,165,150,254,213,254,183,22,130,27,1,
+12,245,167,77,180,145,114,164,37,1,52,76,253,241,99,94,75,85,108,2,250,0,
+1,0,120,253,225,5,131,5,4,0,48,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,
+52,54,51,51,23,17,6,35,34,38,53,52,54,55,3,55,1,34,6,21,20,22,51,50,55,17,
+51,17,20,7,35,30,2,23,5,22,38,170,214,66,71,99,80,24,139,181,157,129,10,9,
+144,179,193,247,178,161,198,134,1,41,195,212,141,112,189,156,165,27,1,83,
+132,103,73,253,225,75,1,77,64,48,56,65,2,121,148,113,109,131,1,1,72,77,180,
+145,114,164,37,1,52,76,253,241,99,94,75,85,108,2,250,251,197,126,85,33,126,
+153,156,0,0,1,0,160,254,12,3,189,4,250,0,27,0,0,37,16,0,5,39,36,0,53,53,52,
+55,35,6,6,35,34,38,53,17,51,17,20,22,51,50,55,17,51,3,189,254,108,254,139,
+20,1,69,1,51,10,10,32,113,60,175,202,165,89,98,124,106,165,150,254,213,254,
+183,22,130,27,1,12,245,132,124,47,28,40,223,193,1,197,253,250,106,101,122,
+2,91,0,0,1,0,90,254,12,3,225,4,250,0,38,0,0,1,38,35,34,6,21,20,22,51,50,55,
+17,51,17,20,2,7,7,39,62,4,53,53,6,35,34,38,38,53,52,54,54,51,50,22,23,2,145,
+64,69,117,152,155,120,168,130,165,178,217,113,69,138,100,83,59,32,124,154,
+131,212,117,113,193,110,53,93,60,3,207,27,145,115,121,145,112,2,174,251,156,
+206,254,233,107,58,130,69,67,82,105,135,82,229,68,111,197,118,105,187,110,
+23,31,0,0,4,0,94,255,206,6,175,7,67,0,55,0,65,0,75,0,76,0,0,1,7,38,39,6,7,
+30,2,51,51,38,53,52,54,51,50,22,21,20,6,35,34,0,39,55,54,55,38,53,52,54,51,
+50,22,22,21,20,7,22,23,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,5,20,23,
+54,53,52,38,35,34,6,1,20,23,54,53,52,38,35,34,6,1,4,137,46,255,181,120,239,
+80,216,197,73,12,84,115,84,110,146,200,152,192,254,79,198,124,226,93,251,
+129,104,89,142,78,66,117,117,168,188,1,103,165,82,102,108,93,253,58,168,44,
+72,56,37,47,1,252,60,95,46,35,32,42,2,30,2,14,34,68,87,126,133,83,151,79,
+77,96,79,111,141,102,110,135,1,0,224,73,130,91,160,187,94,119,85,147,83,113,
+104,51,34,2,95,1,9,1,1,253,196,251,56,4,230,219,178,188,219,193,117,107,75,
+85,65,87,46,252,147,61,58,37,81,34,44,43,6,73,0,2,0,90,0,0,6,7,7,67,0,41,
+0,42,0,0,1,38,35,34,6,21,20,22,51,50,55,17,16,18,51,32,17,17,35,17,52,38,
+35,34,6,21,17,35,17,6,35,34,38,38,53,52,54,54,51,50,22,23,1,2,145,64,69,117,
+152,155,120,168,130,168,188,1,103,165,82,102,108,93,165,124,154,131,212,117,
+113,193,110,53,93,60,2,99,3,207,27,145,115,121,145,112,2,174,1,9,1,1,253,
+196,251,56,4,230,219,178,188,219,251,36,1,143,68,111,197,118,105,187,110,
+23,31,2,242,0,0,1,0,90,253,225,5,78,4,250,0,50,0,0,37,20,7,22,22,23,7,39,
+2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,23,17,6,35,34,38,38,53,52,54,54,
+51,50,22,23,7,38,35,34,6,21,20,22,51,50,55,17,51,3,225,27,106,181,105,109,
+38,170,214,66,71,99,80,24,139,181,157,129,17,124,154,131,212,117,113,193,
+110,53,93,60,55,64,69,117,152,155,120,168,130,165,191,129,81,42,201,226,55,
+75,1,77,64,48,56,65,2,121,148,113,109,131,1,1,134,68,111,197,118,105,187,
+110,23,31,130,27,145,115,121,145,112,2,174,0,0,2,0,110,254,12,4,117,5,4,0,
+40,0,50,0,0,37,20,2,7,7,39,62,4,53,17,52,55,35,7,6,7,22,21,20,6,35,34,38,
+53,52,37,38,39,6,7,39,54,55,22,23,54,55,51,1,52,39,6,21,20,22,51,50,54,4,
+117,178,217,113,69,138,100,83,59,32,5,5,124,94,86,65,145,120,118,155,1,33,
+39,67,100,132,40,204,153,90,52,158,254,120,253,199,28,180,45,41,55,67,150,
+206,254,233,107,58,130,69,67,82,105,135,82,2,242,113,37,82,54,60,184,172,
+141,167,159,122,214,235,93,103,18,49,128,69,14,140,111,108,133,253,55,105,
+112,164,146,51,58,105,0,0,2,0,145,254,12,4,32,5,4,0,38,0,48,0,0,37,20,2,7,
+7,39,62,4,53,17,52,55,39,6,6,7,7,22,21,20,6,35,34,38,53,52,55,38,39,55,22,
+23,54,54,55,51,1,52,39,6,21,20,22,51,50,54,4,32,178,217,113,69,138,100,83,
+59,32,5,3,50,115,117,50,71,127,108,106,142,221,85,140,117,137,93,185,182,
+77,120,253,189,38,125,41,35,42,45,150,206,254,233,107,58,130,69,67,82,105,
+135,82,2,197,108,27,3,52,77,59,27,160,120,115,133,141,115,190,149,152,177,
+86,175,168,92,141,100,253,40,73,103,98,111,45,49,73,0,0,2,0,90,254,50,4,170,
+5,4,0,51,0,63,0,0,5,22,51,50,54,53,52,38,35,17,6,35,34,38,53,52,54,55,54,
+54,53,52,38,39,55,22,22,21,20,6,7,6,6,21,20,22,51,50,55,17,51,17,20,7,22,
+22,21,20,6,35,34,39,3,52,54,51,50,22,21,20,6,35,34,38,2,120,111,110,79,97,
+119,110,143,143,177,247,79,82,89,72,41,86,98,118,76,80,81,82,79,125,113,164,
+143,165,10,113,126,176,149,166,154,179,57,53,54,59,59,54,52,58,242,75,79,
+66,72,80,1,73,61,182,133,58,112,62,66,85,42,46,77,85,88,113,135,75,55,106,
+58,58,97,49,70,75,91,3,22,251,217,72,63,18,142,105,125,148,110,1,50,58,62,
+62,58,58,65,65,0,2,0,90,254,12,3,197,5,4,0,43,0,55,0,0,1,6,35,34,38,53,52,
+54,55,54,54,53,52,38,39,55,22,22,21,20,6,7,6,6,21,20,22,51,50,55,17,51,17,
+20,2,7,7,39,62,4,53,5,52,54,51,50,22,21,20,6,35,34,38,3,32,143,143,177,247,
+79,82,89,72,41,86,98,118,76,80,81,82,79,125,113,164,143,165,178,217,113,69,
+138,100,83,59,32,253,248,57,53,54,59,59,54,52,58,1,53,61,182,133,58,112,62,
+66,85,42,46,77,85,88,113,135,75,55,106,58,58,97,49,70,75,91,3,22,251,156,
+206,254,233,107,58,130,69,67,82,105,135,82,186,58,62,62,58,58,65,65,0,0,2,
+0,90,253,225,5,50,5,4,0,55,0,67,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,
+52,54,51,23,17,6,35,34,38,53,52,54,55,54,54,53,52,38,39,55,22,22,21,20,6,
+7,6,6,21,20,22,51,50,55,17,51,17,20,7,22,22,23,1,52,54,51,50,22,21,20,6,35,
+34,38,4,197,38,170,214,66,71,99,80,24,139,181,157,129,17,143,143,177,247,
+79,82,89,72,41,86,98,118,76,80,81,82,79,125,113,164,143,165,27,106,181,105,
+251,110,57,53,54,59,59,54,52,58,253,225,75,1,77,64,48,56,65,2,121,148,113,
+109,131,1,1,44,61,182,133,58,112,62,66,85,42,46,77,85,88,113,135,75,55,106,
+58,58,97,49,70,75,91,3,22,251,197,129,81,42,201,226,1,236,58,62,62,58,58,
+65,65,0,1,0,70,254,12,2,234,4,250,0,20,0,0,37,20,2,7,7,39,62,4,53,17,52,55,
+35,7,5,39,1,51,2,234,178,217,113,69,138,100,83,59,32,5,5,124,254,234,109,
+2,44,120,150,206,254,233,107,58,130,69,67,82,105,135,82,2,88,216,37,141,251,
+135,1,252,0,2,0,100,254,50,4,208,4,250,0,46,0,58,0,0,37,20,7,22,22,21,20,
+6,35,34,39,55,22,51,50,54,53,52,38,35,17,6,35,34,38,38,53,52,54,54,51,50,
+22,23,7,38,35,34,6,21,20,22,51,50,55,17,51,1,52,54,51,50,22,21,20,6,35,34,
+38,3,235,10,113,126,176,149,166,154,83,111,110,79,97,119,110,124,154,131,
+212,117,113,193,110,53,93,60,55,64,69,117,152,155,120,168,130,165,253,165,
+57,53,54,59,59,54,52,58,211,72,63,18,142,105,125,148,110,110,75,79,66,72,
+80,1,163,68,111,197,118,105,187,110,23,31,130,27,145,115,121,145,112,2,174,
+250,252,58,62,62,58,58,65,65,0,2,0,100,254,12,3,235,4,250,0,38,0,50,0,0,1,
+38,35,34,6,21,20,22,51,50,55,17,51,17,20,2,7,7,39,62,4,53,53,6,35,34,38,38,
+53,52,54,54,51,50,22,23,1,52,54,51,50,22,21,20,6,35,34,38,2,155,64,69,117,
+152,155,120,168,130,165,178,217,113,69,138,100,83,59,32,124,154,131,212,117,
+113,193,110,53,93,60,254,140,57,53,54,59,59,54,52,58,3,207,27,145,115,121,
+145,112,2,174,251,156,206,254,233,107,58,130,69,67,82,105,135,82,229,68,111,
+197,118,105,187,110,23,31,251,195,58,62,62,58,58,65,65,0,2,0,100,253,225,
+5,89,4,250,0,52,0,64,0,0,1,38,35,34,6,21,20,22,51,50,55,17,51,17,20,6,7,30,
+2,23,7,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,51,23,17,6,35,34,38,38,53,
+52,54,54,51,50,22,23,1,52,54,51,50,22,21,20,6,35,34,38,2,155,64,69,117,152,
+155,120,168,130,165,20,7,72,132,116,73,109,38,170,214,66,71,99,80,24,139,
+181,157,129,16,124,154,131,212,117,113,193,110,53,93,60,254,20,57,53,54,59,
+59,54,52,58,3,207,27,145,115,121,145,112,2,174,251,197,74,129,7,29,114,167,
+159,55,75,1,77,64,48,56,65,2,121,148,113,109,131,1,1,134,68,111,197,118,105,
+187,110,23,31,251,245,58,62,62,58,58,65,65,0,2,0,120,254,50,5,130,5,4,0,55,
+0,65,0,0,5,22,51,50,54,53,52,38,35,17,38,39,6,7,22,23,7,1,6,35,34,38,53,52,
+54,51,50,23,54,55,38,38,53,52,54,51,50,22,21,20,7,22,23,17,51,17,20,7,22,
+22,21,20,6,35,34,39,3,20,23,54,53,52,38,35,34,6,2,247,152,158,79,97,119,110,
+201,96,69,103,86,166,130,254,245,44,46,79,113,68,58,91,96,85,56,166,152,138,
+115,151,168,42,101,129,165,10,113,126,176,149,221,205,238,217,25,73,65,52,
+52,170,147,79,66,72,80,1,202,76,43,90,56,98,237,98,1,123,10,80,61,48,56,73,
+40,71,95,203,118,105,133,217,188,110,99,45,45,2,182,251,217,72,63,18,142,
+105,125,148,200,5,8,153,128,69,83,114,128,62,0,2,0,120,254,12,4,157,5,4,0,
+47,0,57,0,0,37,20,2,7,7,39,62,4,53,17,38,39,6,7,22,23,7,1,6,35,34,38,53,52,
+54,51,50,23,54,55,38,38,53,52,54,51,50,22,21,20,7,22,23,17,51,5,20,23,54,
+53,52,38,35,34,6,4,157,178,217,113,69,138,100,83,59,32,201,96,69,103,86,166,
+130,254,245,44,46,79,113,68,58,91,96,85,56,166,152,138,115,151,168,42,101,
+129,165,253,8,217,25,73,65,52,52,150,206,254,233,107,58,130,69,67,82,105,
+135,82,1,12,76,43,90,56,98,237,98,1,123,10,80,61,48,56,73,40,71,95,203,118,
+105,133,217,188,110,99,45,45,2,182,248,153,128,69,83,114,128,62,0,2,0,120,
+253,225,6,11,5,4,0,62,0,72,0,0,1,39,2,35,34,6,21,20,22,23,7,34,38,53,52,54,
+51,23,17,38,39,6,7,22,22,23,7,3,6,35,34,38,53,52,54,51,50,23,54,55,38,38,
+53,52,54,51,50,22,21,20,7,22,23,17,51,17,20,6,7,30,2,23,1,20,23,54,53,52,
+38,35,34,6,5,158,38,170,214,71,86,107,92,24,143,197,173,133,16,201,96,71,
+100,53,105,57,130,231,44,46,79,113,68,58,96,93,84,55,166,152,138,115,151,
+168,42,101,129,165,20,7,72,134,113,74,251,154,217,25,73,65,52,52,253,225,
+75,1,77,65,56,63,68,2,121,157,114,110,139,1,1,173,76,43,91,54,60,146,80,98,
+1,73,10,80,61,48,56,72,42,68,95,203,118,105,133,217,188,110,99,45,45,2,182,
+251,197,74,129,7,29,116,166,158,5,234,153,128,69,83,114,128,62,0,0,2,0,150,
+254,50,4,102,4,250,0,38,0,47,0,0,1,52,55,35,6,6,35,34,38,53,17,51,1,17,51,
+17,20,7,22,22,21,20,6,35,34,38,38,39,55,30,2,51,50,54,53,52,38,35,3,50,55,
+38,39,1,17,20,22,2,220,5,5,32,113,60,175,202,165,1,161,165,10,113,126,176,
+149,104,185,166,101,103,106,122,134,75,79,97,119,110,230,106,92,72,47,254,
+246,89,1,46,146,25,28,40,223,193,1,197,254,3,1,253,251,217,72,63,18,142,105,
+125,148,81,139,126,84,123,100,62,79,66,72,80,2,57,87,29,61,1,79,254,207,106,
+101,0,0,2,0,150,254,12,3,129,4,250,0,26,0,35,0,0,37,20,2,7,7,39,62,4,53,53,
+52,55,35,6,6,35,34,38,53,17,51,1,17,51,1,50,55,38,39,1,17,20,22,3,129,178,
+217,113,69,138,100,83,59,32,5,5,32,113,60,175,202,165,1,161,165,254,117,106,
+92,72,47,254,246,89,150,206,254,233,107,58,130,69,67,82,105,135,82,132,146,
+25,28,40,223,193,1,197,254,3,1,253,253,43,87,29,61,1,79,254,207,106,101,0,
+0,2,0,150,253,225,4,239,4,250,0,40,0,49,0,0,1,39,2,35,34,6,21,20,22,23,7,
+34,38,53,52,54,51,23,17,52,55,35,6,6,35,34,38,53,17,51,1,17,51,17,20,6,7,
+30,2,23,1,50,55,38,39,1,17,20,22,4,130,38,170,214,66,71,99,80,24,139,181,
+157,129,16,5,5,32,113,60,175,202,165,1,161,165,20,7,72,134,113,74,253,7,106,
+92,72,47,254,246,89,253,225,75,1,77,64,48,56,65,2,121,148,113,109,131,1,1,
+37,146,25,28,40,223,193,1,197,254,3,1,253,251,197,74,129,7,29,116,166,158,
+4,13,87,29,61,1,79,254,207,106,101,0,1,0,120,254,12,4,247,5,4,0,56,0,0,37,
+20,2,7,7,39,62,4,53,17,6,35,34,39,6,7,22,22,23,7,3,7,34,38,53,52,54,51,50,
+23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,22,21,20,7,22,51,50,55,17,51,4,
+247,178,217,113,69,138,100,83,59,32,51,77,113,102,74,129,48,96,51,144,190,
+79,94,128,65,61,101,107,114,115,124,103,51,103,78,88,146,163,118,183,102,
+22,68,69,79,64,165,150,206,254,233,107,58,130,69,67,82,105,135,82,1,169,15,
+50,93,50,63,142,72,79,1,65,5,90,66,48,61,103,40,148,100,113,129,39,61,123,
+122,107,187,111,73,62,24,30,2,12,0,0,2,0,95,0,0,5,59,4,250,0,32,0,43,0,0,
+1,38,35,34,6,7,17,35,17,52,55,35,6,35,34,38,53,52,54,51,50,23,17,51,17,20,
+7,51,54,51,50,23,23,5,50,55,53,38,35,34,6,21,20,22,5,34,63,105,57,120,77,
+165,5,5,125,143,156,208,204,153,146,129,165,5,5,119,120,119,66,23,252,124,
+145,143,129,126,88,124,99,2,162,92,75,88,253,165,1,66,99,17,98,193,145,136,
+177,87,1,114,254,189,96,40,106,92,147,198,153,142,67,105,83,80,94,0,0,1,0,
+130,1,179,5,5,4,250,0,30,0,0,1,50,55,23,20,6,6,35,34,39,35,6,6,35,34,38,53,
+17,51,17,20,51,50,55,38,53,17,51,17,20,22,3,164,156,123,74,96,143,79,157,
+85,5,42,136,75,156,181,165,137,116,96,14,165,60,2,67,189,105,37,115,76,87,
+38,49,183,154,1,246,253,250,177,101,65,76,1,197,253,250,95,82,0,1,0,140,0,
+200,3,201,5,4,0,28,0,0,1,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,55,38,
+53,16,33,23,34,6,21,20,23,54,51,2,200,195,212,141,112,201,160,50,171,218,
+193,247,165,132,1,217,11,163,155,81,122,150,2,185,99,94,75,85,120,147,117,
+180,145,157,94,107,120,1,25,145,81,85,75,74,38,0,0,1,0,60,1,12,3,165,5,4,
+0,22,0,0,1,22,22,21,20,6,6,7,22,51,50,55,23,6,35,32,3,55,54,53,52,38,39,1,
+67,124,100,58,103,112,114,161,195,119,70,143,220,254,232,230,114,208,79,67,
+5,4,88,161,93,69,124,121,95,120,163,139,169,1,47,92,165,131,70,106,51,0,0,
+5,0,95,0,0,8,133,5,120,0,59,0,70,0,81,0,82,0,83,0,0,1,50,22,23,54,54,55,51,
+17,35,17,52,55,39,6,7,7,22,21,20,6,35,34,38,53,52,54,54,55,38,38,35,34,6,
+7,7,17,35,17,52,55,35,6,35,34,38,53,52,54,51,50,23,17,51,17,20,7,51,54,54,
+1,50,55,53,38,35,34,6,21,20,22,5,52,39,6,6,21,20,22,51,50,54,1,3,5,26,111,
+179,60,152,185,68,120,165,5,3,112,190,9,30,133,102,106,142,53,100,132,33,
+115,75,73,151,93,107,165,5,5,125,143,156,208,204,153,146,129,165,5,5,124,
+191,253,0,145,143,129,126,88,124,99,4,199,9,90,64,41,35,42,45,2,26,25,4,70,
+138,138,117,214,125,251,6,3,71,108,27,3,174,134,7,134,126,128,160,141,115,
+61,105,100,95,105,113,116,121,134,253,190,1,66,99,17,98,193,145,136,177,87,
+1,114,254,189,96,40,158,121,253,158,153,142,67,105,83,80,94,58,71,72,67,96,
+53,45,49,86,4,31,250,136,0,0,5,0,95,254,243,8,12,5,120,0,63,0,74,0,86,0,87,
+0,88,0,0,37,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,14,2,7,17,35,17,52,
+55,35,6,35,34,38,53,52,54,51,50,23,17,51,17,20,7,51,55,54,54,51,50,22,21,
+20,6,7,6,6,21,20,22,51,50,55,17,51,17,35,1,50,55,53,38,35,34,6,21,20,22,1,
+52,54,51,50,22,21,20,6,35,34,38,1,17,7,103,143,143,177,247,80,82,86,76,67,
+52,56,114,121,132,75,165,5,5,125,143,156,208,204,153,146,129,165,5,5,69,150,
+191,88,122,162,79,83,94,68,125,113,164,143,165,165,250,80,145,143,129,126,
+88,124,99,4,82,57,53,54,59,59,54,52,58,2,3,209,61,182,133,58,113,64,66,96,
+47,48,64,74,119,148,75,253,165,1,66,99,17,98,193,145,136,177,87,1,114,254,
+189,96,40,69,161,119,150,115,68,125,65,75,85,43,70,75,91,3,122,251,6,1,228,
+153,142,67,105,83,80,94,253,138,58,62,62,58,58,65,65,6,68,250,136,0,4,0,95,
+0,0,5,149,5,120,0,38,0,49,0,50,0,51,0,0,1,52,55,35,7,1,39,55,38,38,53,52,
+54,51,50,23,17,51,17,20,7,51,54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,17,
+35,1,50,55,53,38,35,34,6,21,20,22,1,19,2,215,5,5,13,254,62,105,252,138,178,
+204,153,146,129,165,5,5,107,132,135,163,109,157,101,118,57,120,77,165,254,
+224,145,143,129,126,88,124,99,1,185,12,1,66,99,17,10,254,84,112,231,14,189,
+132,136,177,87,1,114,254,189,96,40,96,176,144,200,240,51,230,179,155,75,88,
+253,165,1,228,153,142,67,105,83,80,94,3,148,250,136,0,0,4,0,40,255,236,4,
+11,5,120,0,7,0,28,0,29,0,30,0,0,1,1,39,1,17,51,17,35,1,52,38,39,55,30,2,21,
+20,6,6,35,34,38,39,55,22,51,50,54,1,3,3,102,254,51,82,2,31,165,165,254,180,
+71,92,131,87,68,41,75,132,82,101,198,74,110,132,114,72,70,1,166,5,1,23,254,
+213,129,1,68,3,73,251,6,2,218,113,225,144,75,138,163,184,107,104,158,85,148,
+126,72,201,125,3,14,250,136,0,1,0,130,0,95,4,45,5,4,0,26,0,0,1,35,38,35,34,
+6,21,17,20,6,35,34,38,53,19,51,17,20,51,50,54,53,17,16,33,50,23,4,45,24,41,
+77,70,84,172,148,149,174,1,165,147,79,86,1,53,82,70,4,94,72,168,119,254,67,
+167,196,203,179,3,29,252,217,227,113,115,1,189,1,115,38,0,1,0,180,0,0,4,215,
+4,250,0,15,0,0,1,33,17,35,17,51,17,33,17,51,17,33,21,33,17,35,2,173,254,172,
+165,165,1,84,165,1,133,254,123,165,2,50,253,206,4,250,253,201,2,55,253,201,
+145,253,206,0,0,1,0,120,0,130,3,164,4,19,0,16,0,0,1,7,4,6,21,20,22,22,23,
+7,2,53,52,54,54,36,37,3,164,174,254,237,198,29,54,89,115,222,75,148,1,14,
+1,43,3,122,18,27,111,112,58,107,112,141,74,1,60,203,92,130,86,59,27,0,0,2,
+0,90,1,12,3,215,5,4,0,25,0,36,0,0,1,50,22,21,20,6,7,7,22,22,51,50,55,23,6,
+35,32,3,55,54,55,38,38,53,52,54,23,20,22,23,54,53,52,38,35,34,6,1,160,118,
+153,142,164,77,51,149,85,193,126,75,149,224,254,222,230,70,148,75,94,91,121,
+34,54,57,58,53,38,38,40,5,4,150,112,115,207,113,54,55,65,136,132,149,1,47,
+45,93,70,72,143,83,91,116,227,50,90,48,85,85,47,63,54,0,0,1,0,120,1,4,4,15,
+5,4,0,21,0,0,19,52,54,55,3,55,1,34,6,21,20,22,51,50,55,23,14,2,35,34,38,120,
+178,161,198,134,1,41,195,212,141,112,224,227,50,105,136,150,88,193,247,2,
+73,114,164,37,1,52,76,253,241,99,94,75,85,170,147,71,61,35,180,0,0,2,0,90,
+0,244,3,244,3,234,0,12,0,22,0,0,1,22,21,20,6,35,34,38,53,16,37,7,4,3,52,39,
+6,21,20,22,51,50,54,2,26,80,141,114,123,150,3,154,45,254,252,254,47,151,48,
+42,50,58,3,4,122,138,117,151,155,126,1,143,78,153,25,254,239,92,73,84,134,
+48,61,86,0,1,0,160,1,129,3,123,4,250,0,13,0,0,1,34,38,53,17,51,17,20,22,51,
+50,55,23,6,2,20,173,199,165,100,92,179,146,49,159,1,129,207,183,1,243,253,
+249,111,115,162,140,166,0,3,0,94,255,206,4,245,5,4,0,38,0,48,0,58,0,0,1,38,
+39,6,7,22,4,51,51,38,53,52,54,51,50,22,21,20,6,35,34,0,39,55,54,55,38,53,
+52,54,51,50,22,22,21,20,7,22,23,1,20,23,54,53,52,38,35,34,6,1,20,23,54,53,
+52,38,35,34,6,4,91,255,181,120,239,124,1,68,118,12,84,115,84,110,146,200,
+152,192,254,79,198,124,226,93,251,129,104,89,142,78,66,158,203,253,96,168,
+44,72,56,37,47,1,252,60,95,46,35,32,42,1,236,68,87,126,133,129,184,77,96,
+79,111,141,102,110,135,1,0,224,73,130,91,160,187,94,119,85,147,83,113,104,
+71,47,1,161,117,107,75,85,65,87,46,252,147,61,58,37,81,34,44,43,0,1,0,90,
+1,75,3,214,4,135,0,25,0,0,1,38,35,34,6,21,20,22,51,50,54,55,23,6,35,34,38,
+38,53,52,54,54,51,50,22,23,2,145,64,69,117,152,155,120,107,194,61,90,179,
+253,131,212,117,113,193,110,53,93,60,3,207,27,145,115,121,145,98,85,138,190,
+111,197,118,105,187,110,23,31,0,2,0,110,0,214,3,253,5,4,0,23,0,33,0,0,1,22,
+21,20,6,35,34,38,53,52,37,38,39,6,7,39,54,55,22,23,54,55,7,6,3,52,39,6,21,
+20,22,51,50,54,2,154,71,145,120,118,155,1,30,43,60,100,132,40,204,153,87,
+53,162,252,43,193,213,32,176,48,43,54,63,3,127,197,176,141,167,167,124,222,
+223,99,91,18,49,128,69,14,135,112,106,131,197,99,254,95,108,126,160,157,57,
+62,109,0,0,2,0,145,0,174,4,65,5,4,0,28,0,39,0,0,1,6,6,7,6,7,22,21,20,6,35,
+34,38,53,52,54,55,38,38,39,55,22,18,23,54,55,54,54,55,1,52,39,6,6,21,20,22,
+51,50,54,4,65,60,172,131,92,61,59,127,108,107,141,116,124,49,145,50,117,49,
+147,57,76,71,142,201,74,253,166,32,63,68,41,35,42,45,3,222,61,104,57,40,34,
+164,108,115,133,147,114,94,160,78,115,255,61,86,63,255,0,127,38,29,59,115,
+71,253,64,70,102,44,94,62,45,54,73,0,2,0,90,255,87,3,195,5,4,0,31,0,43,0,
+0,1,22,22,21,20,6,7,6,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,55,
+54,54,53,52,38,39,19,52,54,51,50,22,21,20,6,35,34,38,1,127,118,76,80,81,82,
+79,125,113,107,190,98,75,137,208,104,177,247,79,82,89,72,41,86,85,57,53,54,
+59,59,54,52,58,5,4,113,135,75,55,106,58,58,97,49,70,75,75,81,152,85,64,182,
+133,58,112,62,66,85,42,46,77,85,251,38,58,62,62,58,58,65,65,0,2,0,100,255,
+123,3,224,4,135,0,25,0,37,0,0,1,38,35,34,6,21,20,22,51,50,54,55,23,6,35,34,
+38,38,53,52,54,54,51,50,22,23,1,52,54,51,50,22,21,20,6,35,34,38,2,155,64,
+69,117,152,155,120,107,194,61,90,179,253,131,212,117,113,193,110,53,93,60,
+254,190,57,53,54,59,59,54,52,58,3,207,27,145,115,121,145,98,85,138,190,111,
+197,118,105,187,110,23,31,251,165,58,62,62,58,58,65,65,0,0,2,0,120,255,234,
+4,143,5,4,0,33,0,43,0,0,19,52,54,51,50,22,21,20,7,22,23,7,36,39,6,7,22,23,
+7,1,6,35,34,38,53,52,54,51,50,23,54,55,38,38,55,20,23,54,53,52,38,35,34,6,
+236,145,113,157,177,19,115,243,19,254,253,129,73,140,86,166,130,254,245,44,
+46,79,113,68,58,91,96,107,60,191,173,165,248,14,83,70,51,58,4,22,106,132,
+218,187,73,72,27,38,129,45,33,129,78,98,237,98,1,123,10,80,61,48,56,73,52,
+95,68,188,104,156,90,54,63,111,131,62,0,2,0,150,1,149,3,73,4,250,0,13,0,22,
+0,0,1,7,23,6,6,35,34,38,53,17,51,1,55,23,1,17,20,22,51,50,55,38,39,3,61,23,
+35,85,147,82,175,202,165,1,202,1,1,254,52,89,98,108,93,71,51,2,136,6,80,85,
+72,223,193,1,197,253,209,1,3,1,92,254,207,106,101,86,26,65,0,1,0,120,255,
+234,4,166,5,4,0,43,0,0,1,7,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,
+7,39,54,51,50,22,22,21,20,7,22,51,50,54,55,23,6,35,34,39,6,7,22,23,23,7,1,
+166,80,94,128,65,61,96,110,116,115,124,103,51,103,78,88,146,163,118,183,102,
+48,72,81,61,78,46,52,99,123,140,112,63,94,62,86,146,144,1,196,5,90,66,48,
+61,104,40,151,98,113,129,39,61,123,122,107,187,111,109,86,24,18,24,139,43,
+60,56,37,80,130,220,79,0,0,3,0,100,254,125,4,57,5,120,0,31,0,32,0,33,0,0,
+1,1,6,35,34,38,38,53,52,54,55,54,54,53,53,51,21,20,6,7,6,6,21,20,22,51,50,
+54,55,23,0,7,19,3,1,116,1,46,64,62,120,207,121,114,123,131,106,165,116,121,
+128,109,146,122,121,216,106,105,254,48,120,153,153,254,245,1,12,11,99,174,
+101,96,177,99,105,145,76,212,242,94,174,96,102,150,77,95,109,105,91,125,254,
+35,116,6,251,249,106,0,0,1,0,180,2,77,4,254,2,223,0,3,0,0,19,53,33,21,180,
+4,74,2,77,146,146,0,0,2,0,180,1,143,4,254,3,77,0,3,0,7,0,0,19,53,33,21,1,
+53,33,21,180,4,74,251,182,4,74,2,187,146,146,254,212,146,146,0,0,2,0,180,
+0,0,5,69,6,249,0,15,0,16,0,0,19,16,18,51,50,22,22,23,7,38,36,35,32,17,17,
+35,1,180,255,246,118,219,205,126,80,165,254,238,131,254,158,165,4,80,4,180,
+1,26,1,43,75,130,116,88,144,120,254,56,251,96,6,124,0,2,0,180,0,0,9,69,6,
+249,0,13,0,14,0,0,19,16,0,33,32,1,7,0,33,34,6,21,17,35,1,180,1,52,1,62,2,
+36,3,251,38,252,65,253,216,254,225,165,8,44,4,180,1,48,1,21,254,222,118,1,
+7,210,246,251,96,6,124,0,0,2,0,180,0,0,11,117,6,249,0,17,0,18,0,0,19,52,54,
+36,33,32,4,5,7,36,36,33,34,6,6,21,17,35,1,180,148,1,63,1,3,1,91,4,23,2,121,
+35,253,209,251,234,254,143,221,246,112,165,10,39,4,180,212,248,121,145,141,
+122,124,139,89,192,175,251,96,6,124,0,0,2,0,180,0,0,10,162,6,249,0,16,0,17,
+0,0,19,52,54,36,33,32,4,5,7,0,33,34,6,6,21,17,35,1,180,150,1,63,1,11,1,123,
+3,75,2,72,38,252,33,253,9,227,249,113,165,9,113,4,180,212,248,121,136,150,
+122,1,7,89,193,174,251,96,6,124,0,5,0,95,0,0,8,196,5,120,0,66,0,77,0,88,0,
+89,0,90,0,0,1,50,22,22,23,54,55,38,38,53,52,54,51,50,22,21,20,14,2,7,22,22,
+51,50,55,17,51,17,35,17,6,35,34,38,38,39,38,38,35,34,6,6,7,17,35,17,52,55,
+35,6,35,34,38,53,52,54,51,50,23,17,51,17,20,7,51,54,1,50,55,53,38,35,34,6,
+21,20,22,1,20,22,23,54,53,52,38,35,34,6,1,19,4,72,62,97,88,92,103,60,94,91,
+121,97,118,153,43,78,126,132,55,149,77,165,110,165,165,110,144,111,192,153,
+81,60,88,44,27,47,49,81,165,5,5,125,143,156,208,204,153,146,129,165,5,5,91,
+253,224,145,143,129,126,88,124,99,4,185,54,57,58,53,38,38,40,2,70,19,3,153,
+48,86,132,68,56,72,143,83,91,116,150,112,60,110,105,114,90,60,70,94,2,255,
+251,6,1,71,59,77,147,117,83,74,24,44,95,253,165,1,66,99,17,98,193,145,136,
+177,87,1,114,254,189,96,40,106,254,75,153,142,67,105,83,80,94,2,61,50,90,
+48,85,85,47,63,54,1,49,250,136,0,0,2,0,180,0,0,10,3,6,249,0,15,0,16,0,0,19,
+16,0,33,32,4,5,7,36,36,33,34,6,21,17,35,1,180,1,52,1,62,1,64,3,223,1,190,
+38,254,121,252,60,254,166,254,225,165,8,239,4,180,1,48,1,21,163,127,118,108,
+155,210,246,251,96,6,124,0,0,2,0,180,0,0,9,99,6,249,0,13,0,14,0,0,19,16,0,
+33,32,1,7,0,33,34,6,21,17,35,1,180,1,52,1,62,2,66,3,251,38,252,65,253,186,
+254,225,165,8,70,4,180,1,48,1,21,254,222,118,1,7,210,246,251,96,6,124,0,0,
+2,0,180,0,0,11,147,6,249,0,17,0,18,0,0,19,52,54,36,33,32,4,5,7,36,36,33,34,
+6,6,21,17,35,1,180,148,1,63,1,3,1,121,4,23,2,121,35,253,209,251,234,254,113,
+221,246,112,165,10,104,4,180,212,248,121,145,141,122,124,139,89,192,175,251,
+96,6,124,0,0,2,0,180,0,0,10,213,6,249,0,15,0,16,0,0,19,16,0,33,32,4,5,7,36,
+36,33,34,6,21,17,35,1,180,1,52,1,62,1,124,4,117,1,190,38,254,121,251,166,
+254,106,254,225,165,9,191,4,180,1,48,1,21,163,127,118,108,155,210,246,251,
+96,6,124,0,0,2,0,180,0,0,11,117,6,249,0,17,0,18,0,0,19,52,54,36,33,32,4,5,
+7,36,36,33,34,6,6,21,17,35,1,180,148,1,63,1,3,1,91,4,23,2,121,35,253,209,
+251,234,254,143,221,246,112,165,10,65,4,180,212,248,121,145,141,122,124,139,
+89,192,175,251,96,6,124,0,255,255,0,180,0,0,7,20,8,157,2,38,0,53,0,0,0,7,
+0,4,6,225,1,3,255,255,0,180,0,0,6,17,7,170,2,38,0,53,0,0,0,7,0,5,6,124,0,
+219,255,255,0,180,0,0,7,26,7,215,2,38,0,53,0,0,0,7,1,35,4,171,0,20,255,255,
+0,180,0,0,7,95,7,215,2,38,0,53,0,0,0,7,1,36,4,171,0,20,255,255,0,180,0,0,
+7,4,7,194,2,38,0,53,0,0,0,7,1,34,4,171,0,20,0,2,0,180,0,0,8,246,6,249,0,16,
+0,17,0,0,19,16,0,33,50,4,5,7,44,2,35,34,6,21,17,35,1,180,1,52,1,62,238,2,
+161,2,65,38,254,107,254,62,254,115,180,254,225,165,7,222,4,180,1,48,1,21,
+125,165,118,111,99,53,210,246,251,96,6,124,0,2,0,180,0,0,10,216,6,249,0,15,
+0,16,0,0,19,52,54,36,33,32,1,7,0,33,34,6,6,21,17,35,1,180,150,1,68,1,6,2,
+222,4,102,35,251,222,253,19,223,251,115,165,9,165,4,180,212,248,121,254,226,
+122,1,7,88,194,174,251,96,6,124,0,0,2,0,180,0,0,6,195,6,249,0,15,0,16,0,0,
+19,16,33,50,4,5,7,38,36,36,35,34,6,21,17,35,1,180,2,75,195,1,195,1,62,56,
+206,254,238,254,242,140,229,211,165,5,214,4,180,2,69,138,173,97,106,103,54,
+219,237,251,96,6,124,0,0,5,0,95,254,114,7,59,7,67,0,60,0,75,0,86,0,101,0,
+102,0,0,1,20,7,51,54,51,50,22,21,20,7,22,21,20,7,39,54,53,52,35,34,6,7,17,
+35,53,52,55,35,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,23,17,16,0,33,
+32,0,17,17,35,17,52,38,35,34,6,21,1,34,39,6,21,20,22,51,50,55,53,52,55,35,
+6,39,50,55,53,38,35,34,6,21,20,22,1,34,7,21,20,7,51,54,51,50,23,54,53,52,
+38,1,3,124,5,5,107,132,135,163,62,62,109,157,101,118,57,120,77,165,5,5,125,
+143,155,209,62,60,57,65,205,152,146,129,1,38,1,3,1,10,1,49,165,197,189,202,
+206,254,79,46,47,106,97,82,145,143,5,5,125,163,145,143,129,126,92,120,102,
+3,16,111,143,5,5,107,132,41,50,42,63,1,174,3,183,96,40,96,176,144,124,147,
+84,123,200,240,51,230,179,155,75,88,253,245,242,99,17,98,186,142,62,121,51,
+46,130,78,136,177,87,1,84,1,36,1,64,254,169,254,213,251,66,4,210,238,239,
+255,242,252,150,11,64,117,74,90,153,163,99,17,98,144,153,142,67,106,82,77,
+97,1,26,163,130,96,40,96,12,99,91,73,82,4,69,0,4,0,95,0,0,10,234,7,67,0,79,
+0,90,0,101,0,102,0,0,1,50,22,22,23,54,55,38,38,53,52,54,51,50,22,21,20,14,
+2,7,22,22,51,50,55,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,6,
+35,34,38,38,39,38,38,35,34,6,6,7,17,35,17,52,55,35,6,35,34,38,53,52,54,51,
+50,23,17,51,17,20,7,51,54,1,50,55,53,38,35,34,6,21,20,22,1,20,22,23,54,53,
+52,38,35,34,6,1,4,72,62,97,88,92,103,60,94,91,121,97,118,153,43,78,126,132,
+55,149,77,165,110,168,188,1,103,165,82,102,108,93,165,110,144,111,192,153,
+81,60,88,44,27,47,49,81,165,5,5,125,143,156,208,204,153,146,129,165,5,5,91,
+253,224,145,143,129,126,88,124,99,4,185,54,57,58,53,38,38,40,3,238,3,153,
+48,86,132,68,56,72,143,83,91,116,150,112,60,110,105,114,90,60,70,94,2,255,
+1,9,1,1,253,196,251,56,4,230,219,178,188,219,251,36,1,71,59,77,147,117,83,
+74,24,44,95,253,165,1,66,99,17,98,193,145,136,177,87,1,114,254,189,96,40,
+106,254,75,153,142,67,105,83,80,94,2,61,50,90,48,85,85,47,63,54,2,252,0,4,
+0,95,0,0,10,171,7,67,0,72,0,83,0,94,0,95,0,0,33,35,17,52,55,39,6,7,7,22,21,
+20,6,35,34,38,53,52,54,54,55,38,38,35,34,6,7,7,17,35,17,52,55,35,6,35,34,
+38,53,52,54,51,50,23,17,51,17,20,7,51,54,54,51,50,22,23,54,54,55,16,18,51,
+32,17,17,35,17,52,38,35,34,6,21,1,50,55,53,38,35,34,6,21,20,22,5,52,39,6,
+6,21,20,22,51,50,54,1,8,133,165,5,3,112,190,9,30,133,102,106,142,53,100,132,
+33,115,75,73,151,93,107,165,5,5,125,143,156,208,204,153,146,129,165,5,5,124,
+191,99,111,179,60,133,172,73,163,175,1,103,165,82,102,105,96,249,50,145,143,
+129,126,88,124,99,4,199,9,90,64,41,35,42,45,3,161,3,71,108,27,3,174,134,7,
+134,126,128,160,141,115,61,105,100,95,105,113,116,121,134,253,190,1,66,99,
+17,98,193,145,136,177,87,1,114,254,189,96,40,158,121,138,138,103,185,121,
+1,36,1,21,253,196,251,56,4,230,219,178,214,226,253,41,153,142,67,105,83,80,
+94,58,71,72,67,96,53,45,49,86,5,234,0,0,4,0,95,254,243,10,50,7,67,0,76,0,
+87,0,99,0,100,0,0,37,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,14,2,7,17,
+35,17,52,55,35,6,35,34,38,53,52,54,51,50,23,17,51,17,20,7,51,55,54,54,51,
+50,22,21,20,6,7,6,6,21,20,22,51,50,55,17,16,18,51,32,17,17,35,17,52,38,35,
+34,6,21,17,35,1,50,55,53,38,35,34,6,21,20,22,1,52,54,51,50,22,21,20,6,35,
+34,38,1,7,103,143,143,177,247,80,82,86,76,67,52,56,114,121,132,75,165,5,5,
+125,143,156,208,204,153,146,129,165,5,5,69,150,191,88,122,162,79,83,94,68,
+125,113,164,143,168,188,1,103,165,82,102,108,93,165,250,80,145,143,129,126,
+88,124,99,4,82,57,53,54,59,59,54,52,58,3,158,209,61,182,133,58,113,64,66,
+96,47,48,64,74,119,148,75,253,165,1,66,99,17,98,193,145,136,177,87,1,114,
+254,189,96,40,69,161,119,150,115,68,125,65,75,85,43,70,75,91,3,122,1,9,1,
+1,253,196,251,56,4,230,219,178,188,219,251,36,1,228,153,142,67,105,83,80,
+94,253,138,58,62,62,58,58,65,65,8,15,0,3,0,95,0,0,7,59,7,67,0,52,0,63,0,64,
+0,0,1,20,7,51,54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,17,35,17,52,55,35,
+7,1,39,55,38,38,53,52,54,51,50,23,17,16,0,33,32,0,17,17,35,17,52,38,35,34,
+6,21,1,50,55,53,38,35,34,6,21,20,22,1,3,124,5,5,107,132,135,163,109,157,101,
+118,57,120,77,165,5,5,13,254,62,105,252,138,178,204,153,146,129,1,38,1,3,
+1,10,1,49,165,197,189,202,206,254,59,145,143,129,126,88,124,99,4,248,3,183,
+96,40,96,176,144,200,240,51,230,179,155,75,88,253,165,1,66,99,17,10,254,84,
+112,231,14,189,132,136,177,87,1,84,1,36,1,64,254,169,254,213,251,66,4,210,
+238,239,255,242,253,38,153,142,67,105,83,80,94,5,95,0,0,3,0,130,255,236,5,
+47,5,120,0,36,0,37,0,38,0,0,1,34,38,53,17,51,17,20,51,50,55,38,53,17,51,17,
+20,22,51,50,55,17,51,17,35,17,52,55,35,1,39,1,38,39,35,6,6,1,19,1,211,156,
+181,165,137,116,96,14,165,60,77,124,106,165,165,5,5,253,226,105,1,145,122,
+69,5,42,136,2,186,7,1,179,183,154,1,246,253,250,177,101,65,76,1,197,253,250,
+95,82,122,2,61,251,6,1,76,136,35,253,245,112,1,89,14,71,38,49,3,197,250,136,
+0,3,0,140,255,149,4,44,5,120,0,33,0,34,0,35,0,0,1,1,39,37,38,38,53,52,55,
+38,53,16,33,23,34,6,21,20,23,54,51,23,34,6,21,20,22,51,50,55,17,51,17,35,
+19,19,3,135,253,149,86,1,72,170,216,165,132,1,217,11,163,155,81,122,150,20,
+195,212,141,112,189,156,165,165,67,18,1,20,254,129,134,175,13,175,135,157,
+94,107,120,1,25,145,81,85,75,74,38,165,99,94,75,85,108,3,54,251,6,5,120,250,
+136,0,0,3,0,60,255,236,3,211,5,120,0,29,0,30,0,31,0,0,1,7,1,39,37,38,3,55,
+54,54,53,52,38,39,55,22,22,21,20,6,6,7,22,51,50,55,17,51,17,35,19,19,3,46,
+5,253,242,85,1,31,232,193,114,106,102,79,67,87,124,100,58,103,112,114,161,
+157,108,165,165,76,9,1,62,2,254,176,134,161,38,1,2,92,84,145,67,70,106,51,
+98,88,161,93,69,124,121,95,120,82,3,11,251,6,5,120,250,136,0,3,0,90,255,236,
+4,5,5,120,0,30,0,41,0,42,0,0,1,1,39,37,38,39,55,54,55,38,38,53,52,54,51,50,
+22,21,20,6,7,7,22,22,51,50,55,17,51,17,35,1,20,22,23,54,53,52,38,35,34,6,
+1,3,96,253,193,81,1,46,233,187,70,148,75,94,91,121,97,118,153,142,164,77,
+51,149,85,165,110,165,165,254,1,54,57,58,53,38,38,40,2,75,1,71,254,165,134,
+163,45,249,45,93,70,72,143,83,91,116,150,112,115,207,113,54,55,65,94,2,255,
+251,6,4,33,50,90,48,85,85,47,63,54,1,49,0,0,3,0,120,255,236,4,24,5,120,0,
+24,0,25,0,26,0,0,1,1,39,37,38,38,53,52,54,55,3,55,1,34,6,21,20,22,51,50,55,
+17,51,17,35,19,19,3,115,253,174,81,1,23,166,201,178,161,198,134,1,41,195,
+212,141,112,189,156,165,165,67,18,1,81,254,155,134,150,17,175,129,114,164,
+37,1,52,76,253,241,99,94,75,85,108,2,250,251,6,5,120,250,136,0,3,0,90,255,
+236,3,225,5,120,0,28,0,29,0,30,0,0,1,1,39,37,38,38,53,52,54,54,51,50,22,23,
+7,38,35,34,6,21,20,22,51,50,55,17,51,17,35,19,19,3,60,253,249,107,1,45,179,
+234,113,193,110,53,93,60,55,64,69,117,152,155,120,168,130,165,165,72,13,1,
+141,254,95,130,223,13,238,173,105,187,110,23,31,130,27,145,115,121,145,112,
+2,174,251,6,5,120,250,136,0,4,0,145,255,213,4,32,5,120,0,33,0,44,0,45,0,46,
+0,0,1,22,23,62,2,55,51,17,35,53,1,39,1,17,52,55,39,6,7,7,22,21,20,6,35,34,
+38,53,52,54,55,38,39,1,52,39,6,6,21,20,22,51,50,54,1,19,1,6,153,78,168,127,
+99,49,120,165,253,215,81,2,122,5,3,65,125,138,67,127,108,106,142,101,117,
+83,139,1,76,38,61,64,41,35,38,49,1,237,6,5,4,195,134,84,81,91,63,251,6,251,
+254,218,143,1,55,1,212,108,27,3,65,63,71,147,109,115,133,141,115,91,152,72,
+138,175,253,156,62,94,43,89,57,45,49,67,3,106,250,136,0,4,0,150,255,236,3,
+129,5,120,0,16,0,25,0,26,0,27,0,0,1,17,51,17,35,17,52,55,35,1,39,1,38,38,
+53,17,51,19,50,55,38,39,1,17,20,22,1,19,2,220,165,165,5,2,254,64,115,1,51,
+156,173,165,187,106,92,72,47,254,246,89,1,140,17,2,253,1,253,251,6,1,46,146,
+25,254,19,117,1,54,16,219,179,1,197,253,43,87,29,61,1,79,254,207,106,101,
+3,83,250,136,0,3,0,120,255,141,4,247,5,120,0,51,0,52,0,53,0,0,37,5,39,37,
+17,6,35,34,39,6,7,22,22,23,7,3,7,34,38,53,52,54,51,50,23,54,54,53,52,38,35,
+34,6,6,7,39,54,51,50,22,22,21,20,7,22,51,50,55,17,51,17,35,19,19,4,82,254,
+42,71,2,29,51,77,113,102,74,129,48,96,51,144,190,79,94,128,65,61,101,107,
+114,115,124,103,39,70,62,61,88,146,163,118,183,102,22,68,69,79,64,165,165,
+74,11,124,239,137,241,1,76,15,50,93,50,63,142,72,79,1,65,5,90,66,48,61,103,
+40,148,100,113,129,20,32,48,123,122,107,187,111,73,62,24,30,2,12,251,6,5,
+120,250,136,0,0,4,0,110,0,0,4,117,5,120,0,33,0,42,0,43,0,44,0,0,1,6,7,22,
+21,20,6,35,34,38,53,52,37,38,39,6,7,39,54,55,22,23,54,37,51,17,35,17,1,39,
+1,17,52,55,1,52,39,6,21,20,51,50,54,1,19,3,210,194,121,64,138,114,110,141,
+1,3,44,57,100,132,40,204,153,78,58,162,1,0,120,165,253,226,81,2,111,5,254,
+93,25,148,69,45,59,1,222,21,4,53,92,81,171,121,145,168,141,114,195,206,97,
+88,18,49,128,69,14,122,120,108,124,251,6,1,16,254,240,143,1,29,1,240,113,
+37,254,89,61,95,135,135,93,99,3,89,250,136,0,3,0,130,0,0,4,233,5,120,0,33,
+0,34,0,35,0,0,1,17,20,51,50,54,53,53,16,33,50,22,21,17,35,17,1,39,1,17,52,
+38,35,34,6,21,21,20,6,35,34,38,53,19,37,1,1,40,147,79,86,1,53,150,190,165,
+253,205,74,2,125,84,81,74,80,172,148,149,174,1,3,21,1,1,4,250,253,181,227,
+113,115,225,1,115,233,179,252,152,1,33,254,223,143,1,47,1,180,135,122,122,
+114,225,167,196,203,179,2,65,126,250,136,0,0,2,0,160,255,52,5,212,7,67,0,
+46,0,47,0,0,33,35,17,52,55,39,14,2,21,20,22,22,23,7,38,38,53,52,54,55,38,
+38,53,17,51,17,20,22,51,50,55,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,
+1,3,174,165,5,4,203,170,80,28,59,89,109,130,102,97,97,92,97,165,100,92,150,
+105,174,182,1,103,165,82,102,108,93,1,83,1,190,105,30,3,62,90,113,81,54,93,
+99,115,81,156,211,102,105,150,54,45,178,128,1,93,254,143,111,115,82,2,1,1,
+9,1,1,253,196,251,56,4,230,219,178,196,211,2,103,0,0,2,0,160,255,246,5,209,
+7,67,0,35,0,36,0,0,33,35,17,52,55,35,1,39,1,38,38,53,17,51,17,20,22,51,50,
+54,55,17,16,18,51,32,17,17,35,17,52,38,35,34,6,21,1,3,171,165,5,3,254,7,111,
+1,67,152,169,165,100,92,64,140,51,174,182,1,103,165,82,102,108,93,1,76,1,
+36,136,35,254,39,130,1,12,17,199,171,1,243,253,249,111,115,73,59,2,101,1,
+9,1,1,253,196,251,56,4,230,219,178,196,211,2,103,0,3,0,40,255,236,6,49,7,
+67,0,20,0,41,0,42,0,0,33,35,17,1,39,1,17,16,18,51,32,17,17,35,17,52,38,35,
+34,6,21,1,52,38,39,55,30,2,21,20,6,6,35,34,38,39,55,22,51,50,54,1,4,11,165,
+254,51,82,2,31,174,182,1,103,165,82,102,108,93,254,15,71,92,131,87,68,41,
+75,132,82,101,198,74,110,132,114,72,70,3,59,1,23,254,213,129,1,68,3,73,1,
+9,1,1,253,196,251,56,4,230,219,178,196,211,253,254,113,225,144,75,138,163,
+184,107,104,158,85,148,126,72,201,125,4,217,0,0,2,0,100,254,125,5,196,7,67,
+0,44,0,45,0,0,1,20,6,7,6,6,21,20,22,51,50,54,55,23,0,7,39,1,6,35,34,38,38,
+53,52,54,55,54,54,53,53,16,18,51,32,17,17,35,17,52,38,35,34,6,17,1,2,227,
+116,121,128,109,146,122,121,216,106,105,254,48,120,125,1,46,64,62,120,207,
+121,114,123,131,106,221,218,1,207,165,136,147,154,135,2,4,4,8,94,174,96,102,
+150,77,95,109,105,91,125,254,35,116,120,1,12,11,99,174,101,96,177,99,105,
+145,76,182,1,48,1,52,253,126,251,66,4,210,253,224,232,254,247,2,133,0,0,5,
+0,110,255,87,7,43,5,120,0,56,0,66,0,78,0,79,0,80,0,0,1,6,35,34,38,53,52,55,
+54,54,53,52,35,34,6,7,22,21,20,6,35,34,38,53,52,54,55,38,39,6,7,39,54,55,
+22,23,54,36,51,50,22,21,20,6,7,6,6,21,20,22,51,50,55,17,51,17,35,1,52,39,
+6,21,20,22,51,50,54,1,52,54,51,50,22,21,20,6,35,34,38,1,19,6,134,135,151,
+187,237,161,88,73,161,107,248,107,78,145,120,118,155,143,134,43,51,100,132,
+40,204,153,74,58,117,1,8,121,161,185,81,80,86,75,120,118,164,143,165,165,
+251,182,39,169,48,43,54,63,2,156,57,53,54,59,59,54,52,58,1,254,5,1,36,54,
+157,128,121,114,61,79,40,121,77,68,213,179,141,167,167,124,119,241,106,91,
+78,18,49,128,69,14,112,118,69,81,146,130,62,108,53,57,90,50,66,59,84,3,39,
+251,6,2,49,128,130,158,183,57,62,109,253,254,58,62,62,58,58,65,65,5,224,250,
+136,0,0,1,0,50,1,13,4,106,4,104,0,32,0,0,19,54,51,50,22,23,22,51,50,55,23,
+6,35,34,39,6,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,7,76,149,167,
+163,229,14,40,45,101,94,52,125,107,58,50,27,205,147,108,183,70,88,73,113,
+73,110,127,125,107,117,113,3,232,128,220,169,4,37,139,38,10,155,181,102,83,
+85,70,55,162,140,117,150,98,0,4,0,110,255,87,9,81,7,67,0,69,0,79,0,91,0,92,
+0,0,1,52,35,34,6,7,22,21,20,6,35,34,38,53,52,54,55,38,39,6,7,39,54,55,22,
+23,54,36,51,50,22,21,20,6,7,6,6,21,20,22,51,50,55,17,16,18,51,32,17,17,35,
+17,52,38,35,34,6,21,17,35,17,6,35,34,38,53,52,55,54,54,1,52,39,6,21,20,22,
+51,50,54,1,52,54,51,50,22,21,20,6,35,34,38,1,5,2,161,107,248,107,78,145,120,
+118,155,143,134,43,51,100,132,40,204,153,74,58,117,1,8,121,161,185,81,80,
+86,75,120,118,164,143,168,188,1,103,165,82,102,108,93,165,135,151,187,237,
+161,88,73,253,58,39,169,48,43,54,63,2,156,57,53,54,59,59,54,52,58,3,157,3,
+170,121,77,68,213,179,141,167,167,124,119,241,106,91,78,18,49,128,69,14,112,
+118,69,81,146,130,62,108,53,57,90,50,66,59,84,3,39,1,9,1,1,253,196,251,56,
+4,230,219,178,188,219,251,36,1,36,54,157,128,121,114,61,79,254,175,128,130,
+158,183,57,62,109,253,254,58,62,62,58,58,65,65,7,171,0,0,3,0,95,255,234,9,
+82,5,120,0,74,0,85,0,86,0,0,1,6,35,34,39,6,7,22,23,23,7,1,7,34,38,53,52,54,
+51,50,23,54,54,53,52,38,35,34,14,2,7,17,35,17,52,55,35,6,35,34,38,53,52,54,
+51,50,23,17,51,17,20,7,51,62,5,51,50,22,22,21,20,7,22,51,50,55,17,51,17,35,
+1,50,55,53,38,35,34,6,21,20,22,1,8,173,56,82,125,106,73,105,62,86,146,144,
+254,225,80,94,128,65,61,96,110,116,115,124,103,94,158,155,168,104,165,5,5,
+125,143,156,208,204,153,146,129,165,5,5,52,98,99,103,114,128,74,118,183,102,
+35,64,76,94,59,165,165,249,10,145,143,129,126,88,124,99,7,159,2,52,14,50,
+73,40,80,130,220,79,1,218,5,90,66,48,61,104,40,151,98,113,129,91,150,193,
+102,253,165,1,66,99,17,98,193,145,136,177,87,1,114,254,189,96,40,48,106,105,
+95,72,43,107,187,111,93,76,20,26,2,46,251,6,1,228,153,142,67,105,83,80,94,
+3,148,0,0,2,0,120,0,0,3,214,5,120,0,24,0,25,0,0,19,38,53,52,54,36,37,51,17,
+35,17,5,39,1,17,52,55,39,14,3,21,20,23,1,179,59,129,1,20,1,81,120,165,253,
+253,74,2,77,5,3,112,195,144,83,30,2,93,1,221,133,108,121,177,148,110,251,
+6,1,157,250,143,1,7,1,119,115,20,3,34,66,87,118,86,80,81,3,102,0,0,2,0,120,
+0,0,5,252,7,67,0,37,0,38,0,0,33,35,17,5,39,1,17,52,55,39,14,3,21,20,23,7,
+38,53,52,54,36,37,18,54,51,32,17,17,35,17,52,38,35,34,6,21,1,3,214,165,253,
+253,74,2,77,5,3,112,195,144,83,30,136,59,123,1,2,1,78,2,163,173,1,103,165,
+82,102,108,93,1,74,1,157,250,143,1,7,1,119,115,20,3,34,66,87,118,86,80,81,
+53,133,108,118,173,144,112,1,26,249,253,196,251,56,4,230,219,178,188,219,
+2,103,0,0,3,0,95,255,234,11,120,7,67,0,88,0,99,0,100,0,0,33,35,17,6,35,34,
+39,6,7,22,23,23,7,1,7,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,14,2,7,
+17,35,17,52,55,35,6,35,34,38,53,52,54,51,50,23,17,51,17,20,7,51,62,5,51,50,
+22,22,21,20,7,22,51,50,55,17,16,18,51,50,18,17,17,35,17,52,38,35,34,6,21,
+1,50,55,53,38,35,34,6,21,20,22,1,9,82,165,56,82,125,106,73,105,62,86,146,
+144,254,225,80,94,128,65,61,96,110,116,115,124,103,94,158,155,168,104,165,
+5,5,125,143,156,208,204,153,146,129,165,5,5,52,98,99,103,114,128,74,118,183,
+102,35,64,76,94,59,188,175,183,169,165,83,94,106,102,248,101,145,143,129,
+126,88,124,99,9,52,2,52,14,50,73,40,80,130,220,79,1,218,5,90,66,48,61,104,
+40,151,98,113,129,91,150,193,102,253,165,1,66,99,17,98,193,145,136,177,87,
+1,114,254,189,96,40,48,106,105,95,72,43,107,187,111,93,76,20,26,2,46,1,0,
+1,10,254,222,254,230,251,56,4,230,215,182,200,207,253,8,153,142,67,105,83,
+80,94,5,95,0,0,2,0,130,255,236,7,85,7,67,0,49,0,50,0,0,33,35,17,52,55,35,
+1,39,1,38,39,35,6,6,35,34,38,53,17,51,17,20,51,50,55,38,53,17,51,17,20,22,
+51,50,55,17,16,33,50,18,17,17,35,17,52,38,35,34,6,21,1,5,47,165,5,5,253,226,
+105,1,145,122,69,5,42,136,75,156,181,165,137,116,96,14,165,60,77,124,106,
+1,100,184,175,165,83,101,103,98,1,72,1,76,136,35,253,245,112,1,89,14,71,38,
+49,183,154,1,246,253,250,177,101,65,76,1,197,253,250,95,82,122,2,61,2,10,
+254,235,254,217,251,56,4,230,220,177,198,209,2,103,0,2,0,140,255,149,6,82,
+7,67,0,46,0,47,0,0,1,34,6,21,20,22,51,50,55,17,16,33,50,18,17,17,35,17,52,
+38,35,34,6,21,17,35,17,1,39,37,38,38,53,52,55,38,53,16,33,23,34,6,21,20,23,
+54,51,1,2,200,195,212,141,112,189,156,1,100,184,175,165,83,101,103,98,165,
+253,149,86,1,72,170,216,165,132,1,217,11,163,155,81,122,150,2,194,2,185,99,
+94,75,85,108,3,54,2,10,254,235,254,217,251,56,4,230,220,177,198,209,251,36,
+1,20,254,129,134,175,13,175,135,157,94,107,120,1,25,145,81,85,75,74,38,3,
+229,0,0,2,0,60,255,236,5,249,7,67,0,42,0,43,0,0,1,22,22,21,20,6,6,7,22,51,
+50,55,17,16,33,50,18,17,17,35,17,52,38,35,34,6,21,17,35,17,7,1,39,37,38,3,
+55,54,54,53,52,38,39,1,1,67,124,100,58,103,112,114,161,157,108,1,100,184,
+175,165,83,101,103,98,165,5,253,242,85,1,31,232,193,114,106,102,79,67,4,49,
+5,4,88,161,93,69,124,121,95,120,82,3,11,2,10,254,235,254,217,251,56,4,230,
+220,177,198,209,251,36,1,62,2,254,176,134,161,38,1,2,92,84,145,67,70,106,
+51,2,161,0,3,0,90,255,236,6,43,7,67,0,43,0,54,0,55,0,0,1,50,22,21,20,6,7,
+7,22,22,51,50,55,17,16,33,50,18,17,17,35,17,52,38,35,34,6,21,17,35,17,1,39,
+37,38,39,55,54,55,38,38,53,52,54,23,20,22,23,54,53,52,38,35,34,6,1,1,160,
+118,153,142,164,77,51,149,85,165,110,1,100,184,175,165,83,101,103,98,165,
+253,193,81,1,46,233,187,70,148,75,94,91,121,34,54,57,58,53,38,38,40,3,238,
+5,4,150,112,115,207,113,54,55,65,94,2,255,2,10,254,235,254,217,251,56,4,230,
+220,177,198,209,251,36,1,71,254,165,134,163,45,249,45,93,70,72,143,83,91,
+116,227,50,90,48,85,85,47,63,54,2,252,0,0,2,0,120,255,236,6,62,7,67,0,37,
+0,38,0,0,33,35,17,1,39,37,38,38,53,52,54,55,3,55,1,34,6,21,20,22,51,50,55,
+17,16,33,50,18,17,17,35,17,52,38,35,34,6,21,1,4,24,165,253,174,81,1,23,166,
+201,178,161,198,134,1,41,195,212,141,112,189,156,1,100,184,175,165,83,101,
+103,98,1,71,1,81,254,155,134,150,17,175,129,114,164,37,1,52,76,253,241,99,
+94,75,85,108,2,250,2,10,254,235,254,217,251,56,4,230,220,177,198,209,2,103,
+0,2,0,90,255,236,6,7,7,67,0,41,0,42,0,0,1,38,35,34,6,21,20,22,51,50,55,17,
+16,33,50,18,17,17,35,17,52,38,35,34,6,21,17,35,17,1,39,37,38,38,53,52,54,
+54,51,50,22,23,1,2,145,64,69,117,152,155,120,168,130,1,100,184,175,165,83,
+101,103,98,165,253,249,107,1,45,179,234,113,193,110,53,93,60,2,101,3,207,
+27,145,115,121,145,112,2,174,2,10,254,235,254,217,251,56,4,230,220,177,198,
+209,251,36,1,141,254,95,130,223,13,238,173,105,187,110,23,31,2,242,0,3,0,
+145,255,213,6,70,7,67,0,46,0,57,0,58,0,0,37,1,17,52,55,39,6,7,7,22,21,20,
+6,35,34,38,53,52,54,55,38,39,55,22,23,62,2,55,16,18,51,32,17,17,35,17,52,
+38,35,34,6,21,17,35,53,1,19,52,39,6,6,21,20,22,51,50,54,1,1,1,2,122,5,3,65,
+125,138,67,127,108,106,142,101,117,83,139,117,153,78,160,112,101,43,165,173,
+1,103,165,82,102,107,94,165,253,215,139,38,61,64,41,35,38,49,3,140,100,1,
+55,1,212,108,27,3,65,63,71,147,109,115,133,141,115,91,152,72,138,175,86,195,
+134,80,70,83,52,1,36,1,8,253,196,251,56,4,230,219,178,199,221,251,49,251,
+254,218,2,117,62,94,43,89,57,45,49,67,5,53,0,0,3,0,150,255,236,5,167,7,67,
+0,29,0,38,0,39,0,0,33,35,17,52,55,35,1,39,1,38,38,53,17,51,1,17,16,33,50,
+18,17,17,35,17,52,38,35,34,6,21,1,50,55,38,39,1,17,20,22,1,3,129,165,5,2,
+254,64,115,1,51,156,173,165,1,161,1,100,184,175,165,83,101,103,98,254,117,
+106,92,72,47,254,246,89,3,53,1,46,146,25,254,19,117,1,54,16,219,179,1,197,
+254,3,1,253,2,10,254,235,254,217,251,56,4,230,220,177,198,209,253,73,87,29,
+61,1,79,254,207,106,101,5,30,0,3,0,110,0,0,6,155,7,67,0,46,0,55,0,56,0,0,
+37,1,17,52,55,39,6,7,22,21,20,6,35,34,38,53,52,37,38,39,6,7,39,54,55,22,23,
+54,55,18,54,51,32,17,17,35,17,52,38,35,34,6,21,17,35,17,1,19,52,39,6,21,20,
+51,50,54,1,1,97,2,111,5,3,194,121,64,138,114,110,141,1,3,44,57,100,132,40,
+204,153,78,58,148,243,2,162,174,1,103,165,82,102,108,93,165,253,226,128,25,
+148,69,45,59,3,141,143,1,29,1,240,113,37,3,92,81,171,121,145,168,141,114,
+195,206,97,88,18,49,128,69,14,122,120,100,119,1,28,251,253,196,251,56,4,230,
+219,178,188,219,251,36,1,16,254,240,2,139,61,95,135,135,93,99,5,36,0,2,0,
+130,0,0,7,15,7,67,0,48,0,49,0,0,1,50,23,38,53,16,18,51,32,17,17,35,17,52,
+38,35,34,6,21,17,35,17,1,39,1,17,52,38,35,34,6,21,21,20,6,35,34,38,53,19,
+51,17,20,51,50,54,53,53,16,1,3,149,100,79,4,168,188,1,103,165,82,102,108,
+93,165,253,205,74,2,125,84,81,74,80,172,148,149,174,1,165,147,79,86,3,219,
+5,4,64,24,30,1,9,1,1,253,196,251,56,4,230,219,178,188,219,251,36,1,33,254,
+223,143,1,47,1,180,135,122,122,114,225,167,196,203,179,2,65,253,181,227,113,
+115,225,1,115,2,63,0,2,0,120,255,141,7,29,7,67,0,64,0,65,0,0,33,35,53,5,39,
+37,17,6,35,34,39,6,7,22,22,23,7,3,7,34,38,53,52,54,51,50,23,54,54,53,52,38,
+35,34,6,6,7,39,54,51,50,22,22,21,20,7,22,51,50,55,17,16,33,50,18,17,17,35,
+17,52,38,35,34,6,21,1,4,247,165,254,42,71,2,29,51,77,113,102,74,129,48,96,
+51,144,190,79,94,128,65,61,101,107,114,115,124,103,39,70,62,61,88,146,163,
+118,183,102,22,68,69,79,64,1,100,184,175,165,83,101,103,98,1,74,124,239,137,
+241,1,76,15,50,93,50,63,142,72,79,1,65,5,90,66,48,61,103,40,148,100,113,129,
+20,32,48,123,122,107,187,111,73,62,24,30,2,12,2,10,254,235,254,217,251,56,
+4,230,220,177,198,209,2,103,0,0,4,0,100,255,71,3,235,5,120,0,28,0,40,0,41,
+0,42,0,0,1,1,39,37,38,38,53,52,54,54,51,50,22,23,7,38,35,34,6,21,20,22,51,
+50,55,17,51,17,35,5,52,54,51,50,22,21,20,6,35,34,38,1,19,3,70,253,247,107,
+1,45,182,229,113,193,110,53,93,60,55,64,69,117,152,155,120,168,130,165,165,
+254,201,57,53,54,59,59,54,52,58,1,137,3,1,142,254,94,130,223,16,236,172,105,
+187,110,23,31,130,27,145,115,121,145,112,2,174,251,6,62,58,62,62,58,58,65,
+65,5,240,250,136,0,0,3,0,100,255,71,6,17,7,67,0,41,0,53,0,54,0,0,1,38,35,
+34,6,21,20,22,51,50,55,17,16,33,50,18,17,17,35,17,52,38,35,34,6,21,17,35,
+17,1,39,37,38,38,53,52,54,54,51,50,22,23,3,52,54,51,50,22,21,20,6,35,34,38,
+1,2,155,64,69,117,152,155,120,168,130,1,100,184,175,165,83,101,103,98,165,
+253,247,107,1,45,182,229,113,193,110,53,93,60,195,57,53,54,59,59,54,52,58,
+3,38,3,207,27,145,115,121,145,112,2,174,2,10,254,235,254,217,251,56,4,230,
+220,177,198,209,251,36,1,142,254,94,130,223,16,236,172,105,187,110,23,31,
+251,113,58,62,62,58,58,65,65,7,187,0,2,0,100,254,99,8,7,7,67,0,51,0,52,0,
+0,33,35,17,33,17,35,17,33,6,7,22,0,23,7,36,0,39,62,2,53,52,38,39,55,22,22,
+21,20,7,33,17,51,17,33,17,16,18,51,50,18,17,17,35,17,52,38,35,34,6,6,21,1,
+5,225,165,254,172,165,254,143,57,95,89,1,53,250,91,254,242,254,155,144,138,
+94,50,62,84,87,120,104,21,1,53,165,1,84,169,185,185,176,165,83,103,78,84,
+37,1,74,2,50,253,206,2,50,103,126,153,254,209,174,116,179,1,107,242,154,143,
+143,78,79,136,82,98,98,200,114,91,74,2,55,253,201,2,5,1,53,1,7,254,246,254,
+206,251,56,4,230,223,174,85,188,184,2,153,0,0,2,0,180,0,0,5,225,6,249,0,15,
+0,16,0,0,19,16,0,51,50,4,5,7,38,36,35,34,6,21,17,35,1,180,1,6,254,165,1,131,
+1,1,67,227,254,167,152,190,179,165,4,236,4,180,1,30,1,39,143,169,96,144,119,
+228,228,251,96,6,124,0,255,255,0,150,253,196,4,101,5,120,2,38,0,21,0,0,0,
+7,0,61,0,248,0,0,255,255,0,130,253,196,5,143,5,120,2,38,0,23,0,0,0,7,0,61,
+1,80,0,0,255,255,0,85,252,153,4,135,5,120,2,38,0,25,0,0,0,7,0,61,0,188,254,
+213,255,255,0,100,253,196,4,57,5,120,2,38,0,27,0,0,0,6,0,61,118,0,255,255,
+0,100,253,196,3,226,5,120,2,38,0,28,0,0,0,6,0,61,118,0,255,255,0,100,253,
+196,4,92,5,120,2,38,0,29,0,0,0,7,0,61,0,238,0,0,255,255,0,100,252,193,4,92,
+5,120,2,38,0,30,0,0,0,7,0,61,0,178,254,253,255,255,0,100,253,196,4,67,5,120,
+2,38,0,31,0,0,0,7,0,61,0,148,0,0,255,255,0,100,252,223,4,67,5,120,2,38,0,
+32,0,0,0,7,0,61,0,128,255,27,255,255,0,120,253,196,3,121,5,120,2,38,0,36,
+0,0,0,6,0,61,79,0,255,255,0,70,253,196,3,26,5,120,2,38,0,45,0,0,0,6,0,61,
+48,0,255,255,0,110,253,196,4,66,5,120,2,38,0,46,0,0,0,7,0,61,0,158,0,0,255,
+255,0,120,253,196,3,178,5,120,2,38,0,51,0,0,0,6,0,61,48,0,0,2,0,180,0,0,17,
+21,6,249,0,17,0,18,0,0,19,52,54,36,33,32,4,5,7,36,36,33,32,6,6,21,17,35,1,
+180,148,1,63,2,127,1,255,7,151,2,121,35,253,209,247,185,254,156,253,167,246,
+112,165,15,111,4,180,212,248,121,145,141,122,124,139,89,192,175,251,96,6,
+124,0,2,0,5,5,109,2,89,7,174,0,22,0,23,0,0,1,38,35,34,6,21,20,22,23,7,46,
+3,53,52,62,2,51,50,22,23,5,2,3,98,110,66,71,77,87,71,54,94,70,40,46,78,104,
+58,97,153,60,254,156,6,198,87,75,58,61,108,34,96,20,52,73,100,69,64,99,66,
+34,74,57,195,0,3,0,5,5,109,2,111,7,195,0,27,0,39,0,40,0,0,1,38,38,35,34,14,
+2,21,20,22,23,7,46,3,53,52,62,2,51,50,30,2,23,3,52,54,51,50,22,21,20,6,35,
+34,38,39,2,41,35,102,75,45,64,42,20,77,87,71,54,94,70,40,50,85,114,64,55,
+96,77,59,18,249,57,53,54,59,59,54,52,58,129,6,255,17,34,26,44,55,29,61,108,
+34,96,20,52,73,100,69,64,105,75,40,15,23,28,14,254,208,58,62,62,58,58,65,
+65,95,0,4,0,5,5,109,2,180,7,195,0,15,0,27,0,55,0,56,0,0,1,6,6,35,34,46,2,
+39,55,22,22,51,50,54,55,39,52,54,51,50,22,21,20,6,35,34,38,55,38,38,35,34,
+14,2,21,20,22,23,7,46,3,53,52,62,2,51,50,30,2,23,1,2,180,38,104,65,36,68,
+61,55,24,53,40,85,51,48,68,24,212,34,29,29,34,34,29,29,34,155,35,102,75,45,
+64,42,20,77,87,71,54,94,70,40,50,85,114,64,55,96,77,59,18,254,134,6,81,54,
+60,19,33,43,24,55,35,52,49,35,35,30,33,33,30,29,33,33,111,17,34,26,44,55,
+29,61,108,34,96,20,52,73,100,69,64,105,75,40,15,23,28,14,254,245,0,2,0,153,
+0,247,3,206,4,40,0,11,0,23,0,0,0,6,35,34,38,53,52,54,51,50,22,21,38,38,35,
+34,6,21,20,22,51,50,54,53,3,206,230,180,179,232,228,181,180,232,168,132,107,
+107,139,131,107,106,141,1,220,229,231,179,178,229,233,177,120,144,151,116,
+115,143,150,116,0,1,1,7,255,95,3,118,5,15,0,40,0,0,1,54,54,53,52,38,35,34,
+6,21,20,22,23,7,38,38,53,52,54,51,50,22,21,20,6,7,5,22,22,21,20,6,7,39,54,
+54,53,52,38,39,1,1,14,246,197,85,67,64,76,74,81,97,109,97,160,132,141,172,
+182,202,1,0,72,64,38,57,133,28,31,33,49,254,140,2,54,156,206,92,65,79,66,
+48,51,68,28,103,47,125,87,98,138,152,122,128,224,144,203,57,120,75,53,102,
+76,99,31,62,39,40,59,42,1,53,0,1,0,173,255,232,3,209,5,15,0,35,0,0,5,2,39,
+6,35,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,
+21,20,6,7,22,22,23,3,78,202,155,52,55,74,94,70,61,42,81,56,97,117,128,113,
+69,122,81,52,80,158,86,189,221,137,125,81,175,76,24,1,46,149,9,74,60,57,65,
+38,41,36,168,106,114,129,31,40,144,38,36,208,186,139,222,63,80,216,114,0,
+1,0,184,255,119,3,153,5,15,0,51,0,0,19,54,54,51,50,22,21,20,6,7,22,22,21,
+20,6,7,22,23,7,38,38,39,6,35,34,38,53,52,54,51,50,22,23,54,54,53,52,38,38,
+35,6,35,39,50,54,53,52,38,35,34,6,7,184,73,164,86,160,186,57,62,91,96,127,
+121,115,118,133,113,103,39,49,73,74,94,70,61,56,96,51,98,92,66,105,36,76,
+74,8,156,149,92,83,72,137,72,4,193,38,40,148,127,77,114,42,38,131,91,103,
+160,44,115,156,86,156,126,40,7,74,60,57,65,49,45,20,98,75,55,85,35,12,146,
+76,96,64,72,40,35,0,2,0,130,255,252,3,234,5,15,0,34,0,46,0,0,1,22,22,21,20,
+6,35,34,38,53,52,54,55,46,2,53,52,55,23,6,21,20,22,23,54,54,53,52,39,55,22,
+21,20,6,1,6,6,21,20,22,51,50,54,53,52,38,2,156,95,114,169,140,137,186,105,
+110,121,141,68,14,167,14,139,127,152,120,13,165,15,150,254,222,78,74,78,74,
+68,82,74,2,148,100,185,115,116,148,155,117,95,173,119,120,174,141,95,50,60,
+32,44,34,96,197,125,157,185,71,39,44,32,62,48,120,218,254,210,85,121,57,63,
+77,75,61,59,124,0,1,0,172,255,119,4,100,5,15,0,35,0,0,1,6,6,21,20,22,51,50,
+55,38,38,53,52,54,51,50,22,21,20,6,7,22,18,23,7,38,2,39,6,35,34,38,53,52,
+54,55,1,209,69,60,143,151,8,30,7,5,79,65,75,98,58,58,45,160,62,147,60,166,
+39,28,45,225,242,62,58,4,227,118,189,91,144,143,3,18,40,14,62,69,95,66,57,
+81,21,113,254,195,94,65,102,1,98,108,4,232,222,102,221,95,0,1,0,211,255,119,
+4,85,5,14,0,59,0,0,1,38,38,53,52,54,51,50,22,23,7,38,38,35,34,21,20,23,54,
+51,50,22,23,7,38,35,34,6,21,20,22,51,50,55,38,38,53,52,54,51,50,22,21,20,
+6,7,22,22,23,7,38,38,39,6,35,34,38,53,52,54,1,112,79,78,207,171,61,125,26,
+12,45,92,54,222,145,74,87,20,60,24,13,32,77,109,120,135,110,22,30,7,5,77,
+60,80,100,61,53,28,101,57,147,51,97,30,53,44,192,225,50,2,251,46,133,85,124,
+143,13,8,143,10,13,146,116,42,18,4,4,143,5,91,86,89,99,3,18,40,14,63,68,95,
+66,57,82,16,65,176,77,65,87,197,73,7,195,150,60,107,0,1,0,78,0,100,4,25,4,
+180,0,32,0,0,19,18,18,51,50,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,18,21,20,6,35,34,38,2,3,237,39,214,186,108,100,125,100,49,59,140,
+130,34,179,205,142,130,160,214,190,175,193,235,142,36,4,180,254,0,254,71,
+143,169,171,229,60,47,74,78,3,144,12,162,127,112,124,254,206,235,221,232,
+228,1,208,1,125,0,0,1,0,148,0,0,4,1,5,15,0,21,0,0,1,23,1,6,6,21,20,22,51,
+50,54,55,23,6,6,35,34,38,53,52,54,55,3,14,128,254,82,94,71,120,113,106,196,
+103,72,120,230,115,179,233,103,117,5,15,109,253,250,113,138,66,98,101,70,
+68,151,71,68,188,163,108,196,140,0,2,0,145,255,95,4,55,5,14,0,28,0,40,0,0,
+1,22,23,5,22,22,21,20,6,7,39,54,54,53,52,38,39,1,38,38,53,52,54,51,50,22,
+21,20,6,2,38,35,34,6,21,20,22,51,50,54,53,2,44,46,47,1,37,69,68,38,57,133,
+28,31,33,49,253,252,85,82,197,145,151,194,144,21,98,78,79,102,96,79,78,104,
+2,117,30,38,237,56,121,77,53,102,76,99,31,62,39,40,59,42,1,171,71,148,105,
+138,194,192,150,135,168,1,137,106,112,86,85,106,110,87,0,1,0,160,0,0,1,69,
+4,250,0,3,0,0,51,17,51,17,160,165,4,250,251,6,0,2,0,160,0,0,2,223,4,250,0,
+3,0,7,0,0,33,17,51,17,33,17,51,17,2,58,165,253,193,165,4,250,251,6,4,250,
+251,6,0,3,0,160,0,0,4,121,4,250,0,3,0,7,0,11,0,0,33,17,51,17,33,17,51,17,
+33,17,51,17,2,58,165,253,193,165,2,143,165,4,250,251,6,4,250,251,6,4,250,
+251,6,0,0,1,0,81,3,75,4,169,4,249,0,3,0,0,19,1,23,1,81,4,48,40,251,209,3,
+237,1,12,163,254,245,0,0,2,0,81,1,184,4,169,4,249,0,3,0,7,0,0,19,1,23,1,7,
+1,23,1,81,4,48,40,251,209,41,4,48,40,251,209,3,237,1,12,163,254,245,241,1,
+12,163,254,245,0,0,3,0,81,0,36,4,169,4,249,0,3,0,7,0,11,0,0,19,1,23,1,7,1,
+23,1,7,1,23,1,81,4,48,40,251,209,41,4,48,40,251,209,41,4,48,40,251,209,3,
+237,1,12,163,254,245,241,1,12,163,254,245,242,1,12,163,254,245,0,0,2,0,137,
+1,86,3,37,3,201,0,12,0,24,0,0,1,34,38,53,52,54,51,50,22,22,21,20,6,3,34,6,
+21,20,22,51,50,54,53,52,38,1,216,148,187,185,150,98,152,83,185,149,83,95,
+96,82,82,96,98,1,86,176,139,133,179,81,143,88,136,179,1,229,96,74,79,93,93,
+79,74,96,0,2,0,117,0,177,3,254,4,252,0,16,0,28,0,0,1,6,7,22,22,21,20,6,35,
+34,38,53,52,54,55,1,23,1,34,6,21,20,22,51,50,54,53,52,38,3,65,129,167,117,
+131,185,148,148,187,97,110,2,91,95,253,197,83,95,95,83,82,96,98,3,240,102,
+114,25,161,114,136,179,177,138,93,139,85,1,211,119,254,17,95,75,79,94,94,
+79,74,96,0,1,254,191,254,128,1,248,5,17,0,19,0,0,5,22,51,50,54,18,53,52,2,
+39,55,22,18,21,16,2,4,35,34,39,254,202,106,75,164,203,98,69,61,166,62,70,
+137,254,233,213,89,107,213,22,120,1,0,228,197,1,215,223,37,221,254,0,202,
+254,237,254,193,152,22,0,0,1,254,191,254,21,2,179,5,17,0,30,0,0,1,22,51,50,
+36,54,53,52,38,39,38,38,53,52,54,55,23,6,6,21,20,22,23,22,22,21,16,0,33,34,
+39,254,195,41,64,187,1,0,129,60,53,56,58,254,255,49,205,188,50,65,51,63,254,
+142,254,150,59,57,254,180,6,89,179,129,99,200,114,119,182,89,165,217,53,155,
+38,135,106,64,148,140,114,224,112,254,251,254,221,6,0,0,0,15,0,186,0,3,0,
+1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,1,4,9,0,2,0,14,0,126,0,
+3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,0,4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,0,
+210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,1,4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,8,
+0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,0,3,0,1,4,9,0,10,0,96,1,162,0,3,0,1,
+4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,60,2,64,0,3,0,1,4,9,0,13,2,150,2,124,
+0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,75,0,97,0,105,0,116,0,
+104,0,105,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,75,0,97,
+0,105,0,116,0,104,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,
+0,46,0,48,0,53,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,
+115,0,75,0,97,0,105,0,116,0,104,0,105,0,78,0,111,0,116,0,111,0,32,0,105,0,
+115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,
+32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,
+99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,
+97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,
+0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,
+0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,
+0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,
+0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,
+0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,
+0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,
+0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,
+0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,
+0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,
+0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,
+99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,
+0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,
+0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,
+0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,
+0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,
+0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,
+0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,
+0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,
+102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,
+0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,
+0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,
+32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,
+111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,
+0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,
+0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,
+0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,181,0,50,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,58,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,
+1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,
+1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,
+1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,
+1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,
+1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,
+1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,
+101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,
+1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,
+126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,
+1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,
+151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,
+1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,
+176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,188,
+1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,1,
+201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,
+1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,1,
+226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,238,
+1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,1,
+251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,
+2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,
+2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,
+2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,
+2,56,2,57,2,58,2,59,7,46,110,111,116,100,101,102,4,110,117,108,108,16,110,
+111,110,109,97,114,107,105,110,103,114,101,116,117,114,110,5,115,112,97,99,
+101,10,107,116,86,83,67,66,105,110,100,117,12,107,116,86,83,65,110,117,115,
+118,97,114,97,11,107,116,86,83,86,105,115,97,114,103,97,3,107,116,65,4,107,
+116,65,65,3,107,116,73,4,107,116,73,73,3,107,116,85,4,107,116,85,85,3,107,
+116,69,4,107,116,65,73,3,107,116,79,4,107,116,65,85,4,107,116,75,97,5,107,
+116,75,72,97,4,107,116,71,97,5,107,116,71,72,97,5,107,116,78,71,97,4,107,
+116,67,97,5,107,116,67,72,97,4,107,116,74,97,5,107,116,74,72,97,5,107,116,
+78,89,97,5,107,116,84,84,97,6,107,116,84,84,72,97,5,107,116,68,68,97,7,107,
+116,68,68,68,72,97,6,107,116,68,68,72,97,5,107,116,82,72,97,5,107,116,78,
+78,97,4,107,116,84,97,5,107,116,84,72,97,4,107,116,68,97,5,107,116,68,72,
+97,4,107,116,78,97,4,107,116,80,97,5,107,116,80,72,97,4,107,116,66,97,5,107,
+116,66,72,97,4,107,116,77,97,4,107,116,89,97,4,107,116,82,97,4,107,116,76,
+97,4,107,116,86,97,5,107,116,83,72,97,5,107,116,83,83,97,4,107,116,83,97,
+4,107,116,72,97,6,107,116,86,83,65,65,5,107,116,86,83,73,6,107,116,86,83,
+73,73,5,107,116,86,83,85,6,107,116,86,83,85,85,5,107,116,86,83,69,6,107,116,
+86,83,65,73,5,107,116,86,83,79,6,107,116,86,83,65,85,8,107,116,86,105,114,
+97,109,97,7,107,116,78,117,107,116,97,5,107,116,65,66,66,5,107,116,69,78,
+85,5,107,116,78,85,77,7,107,116,68,97,110,100,97,8,107,116,68,68,97,110,100,
+97,5,107,116,75,73,73,4,107,116,75,85,5,107,116,75,85,85,4,107,116,77,85,
+5,107,116,77,85,85,5,107,116,66,72,85,6,107,116,66,72,85,85,4,107,116,82,
+85,5,107,116,82,85,85,5,107,116,75,72,85,6,107,116,75,72,85,85,5,107,116,
+80,73,73,4,107,116,80,85,5,107,116,80,85,85,4,107,116,83,85,5,107,116,83,
+85,85,10,107,116,86,83,73,46,97,108,116,49,7,107,116,86,83,65,73,109,6,107,
+116,86,83,69,109,8,107,116,65,46,97,108,116,49,5,107,116,71,73,73,4,107,116,
+71,85,5,107,116,71,85,85,10,107,116,78,78,97,46,97,108,116,49,10,107,116,
+75,72,85,46,97,108,116,49,9,107,116,75,85,46,97,108,116,49,9,107,116,71,85,
+46,97,108,116,49,6,107,116,86,83,79,109,7,107,116,86,83,65,85,109,6,107,116,
+75,72,73,73,5,107,116,82,73,73,5,107,116,74,73,73,6,107,116,67,72,73,73,4,
+107,116,72,85,5,107,116,72,85,85,5,107,116,83,73,73,4,107,116,67,85,4,107,
+116,66,85,5,107,116,72,73,73,6,107,116,90,101,114,111,5,107,116,79,110,101,
+5,107,116,84,119,111,7,107,116,84,104,114,101,101,6,107,116,70,111,117,114,
+6,107,116,70,105,118,101,5,107,116,83,105,120,7,107,116,83,101,118,101,110,
+7,107,116,69,105,103,104,116,6,107,116,78,105,110,101,5,107,116,80,84,97,
+5,107,116,75,75,97,5,107,116,80,82,97,9,107,116,71,97,46,104,97,108,102,5,
+107,116,71,72,85,6,107,116,71,72,85,85,6,107,116,71,72,73,73,10,107,116,71,
+72,85,46,97,108,116,49,5,107,116,67,85,85,5,107,116,67,73,73,4,107,116,74,
+85,5,107,116,74,85,85,9,107,116,74,85,46,97,108,116,49,5,107,116,74,72,85,
+6,107,116,74,72,85,85,6,107,116,74,72,73,73,6,107,116,84,84,73,73,7,107,116,
+84,84,72,73,73,6,107,116,68,68,73,73,7,107,116,68,68,72,73,73,5,107,116,84,
+73,73,6,107,116,84,72,73,73,5,107,116,68,73,73,6,107,116,68,72,73,73,5,107,
+116,78,73,73,6,107,116,66,72,73,73,5,107,116,77,73,73,5,107,116,89,73,73,
+5,107,116,76,73,73,5,107,116,86,73,73,6,107,116,83,72,73,73,6,107,116,83,
+83,73,73,8,107,116,68,68,68,72,73,73,9,107,116,67,85,46,97,108,116,49,6,107,
+116,82,72,73,73,6,107,116,78,78,73,73,5,107,116,78,78,85,10,107,116,78,78,
+85,46,97,108,116,49,6,107,116,78,78,85,85,4,107,116,84,85,9,107,116,84,85,
+46,97,108,116,49,4,107,116,78,85,5,107,116,68,72,85,9,107,116,78,85,46,97,
+108,116,49,5,107,116,78,85,85,5,107,116,84,85,85,5,107,116,84,72,85,10,107,
+116,84,72,85,46,97,108,116,49,6,107,116,84,72,85,85,10,107,116,68,72,85,46,
+97,108,116,49,6,107,116,68,72,85,85,9,107,116,80,85,46,97,108,116,49,9,107,
+116,66,85,46,97,108,116,49,6,107,116,80,72,73,73,5,107,116,66,73,73,5,107,
+116,66,85,85,10,107,116,66,72,85,46,97,108,116,49,9,107,116,77,85,46,97,108,
+116,49,4,107,116,89,85,9,107,116,89,85,46,97,108,116,49,5,107,116,89,85,85,
+9,107,116,82,85,46,97,108,116,49,4,107,116,86,85,9,107,116,86,85,46,97,108,
+116,49,5,107,116,86,85,85,5,107,116,83,72,85,10,107,116,83,72,85,46,97,108,
+116,49,6,107,116,83,72,85,85,5,107,116,83,83,85,10,107,116,83,83,85,46,97,
+108,116,49,6,107,116,83,83,85,85,9,107,116,83,85,46,97,108,116,49,9,107,116,
+75,97,46,104,97,108,102,10,107,116,75,72,97,46,104,97,108,102,10,107,116,
+71,72,97,46,104,97,108,102,9,107,116,67,97,46,104,97,108,102,5,107,116,75,
+77,97,5,107,116,75,89,97,5,107,116,75,82,97,5,107,116,71,82,97,9,107,116,
+74,97,46,104,97,108,102,10,107,116,78,78,97,46,104,97,108,102,9,107,116,84,
+97,46,104,97,108,102,10,107,116,84,72,97,46,104,97,108,102,10,107,116,68,
+72,97,46,104,97,108,102,9,107,116,78,97,46,104,97,108,102,9,107,116,80,97,
+46,104,97,108,102,10,107,116,80,72,97,46,104,97,108,102,9,107,116,66,97,46,
+104,97,108,102,10,107,116,66,72,97,46,104,97,108,102,9,107,116,77,97,46,104,
+97,108,102,9,107,116,89,97,46,104,97,108,102,9,107,116,86,97,46,104,97,108,
+102,10,107,116,83,72,97,46,104,97,108,102,10,107,116,83,83,97,46,104,97,108,
+102,9,107,116,83,97,46,104,97,108,102,6,107,116,84,84,82,97,5,107,116,83,
+69,67,8,107,116,68,98,108,83,69,67,10,107,116,86,83,73,46,97,108,116,50,10,
+107,116,86,83,73,46,97,108,116,57,11,107,116,86,83,73,46,97,108,116,49,50,
+11,107,116,86,83,73,46,97,108,116,49,49,6,107,116,75,84,72,97,10,107,116,
+86,83,73,46,97,108,116,54,10,107,116,86,83,73,46,97,108,116,53,10,107,116,
+86,83,73,46,97,108,116,55,11,107,116,86,83,73,46,97,108,116,49,48,11,107,
+116,86,83,73,46,97,108,116,49,51,11,107,116,86,83,73,99,97,110,100,114,97,
+6,107,116,86,83,73,109,8,107,116,86,83,73,82,97,109,13,107,116,86,83,73,82,
+97,67,97,110,100,114,97,7,107,116,86,83,73,82,97,10,107,116,86,83,73,46,97,
+108,116,56,10,107,116,86,83,73,46,97,108,116,52,10,107,116,86,83,73,46,97,
+108,116,51,6,107,116,75,75,73,73,7,107,116,75,84,72,73,73,6,107,116,75,77,
+73,73,6,107,116,75,89,73,73,6,107,116,75,82,73,73,6,107,116,75,72,82,97,6,
+107,116,71,72,82,97,5,107,116,67,82,97,6,107,116,84,72,82,97,6,107,116,68,
+72,82,97,5,107,116,66,82,97,5,107,116,77,82,97,6,107,116,83,83,82,97,5,107,
+116,83,82,97,6,107,116,66,72,82,97,5,107,116,74,82,97,6,107,116,80,84,73,
+73,6,107,116,80,82,73,73,6,107,116,71,82,73,73,7,107,116,84,84,82,73,73,6,
+107,116,66,72,89,97,10,107,116,78,89,97,46,104,97,108,102,7,107,116,66,72,
+89,73,73,5,107,116,75,83,97,5,107,116,84,82,97,6,107,116,84,82,73,73,6,107,
+116,75,83,73,73,7,107,116,75,72,82,73,73,7,107,116,71,72,82,73,73,6,107,116,
+67,82,73,73,7,107,116,84,72,82,73,73,7,107,116,68,72,82,73,73,6,107,116,66,
+82,73,73,6,107,116,77,82,73,73,7,107,116,83,83,82,73,73,7,107,116,66,72,82,
+73,73,6,107,116,74,82,73,73,6,107,116,83,82,73,73,5,107,116,86,82,97,6,107,
+116,86,82,73,73,11,107,116,78,78,73,73,46,97,108,116,49,9,107,116,86,83,73,
+46,115,117,98,10,107,116,78,71,97,46,104,97,108,102,10,107,116,67,72,97,46,
+104,97,108,102,10,107,116,74,72,97,46,104,97,108,102,10,107,116,84,84,97,
+46,104,97,108,102,11,107,116,84,84,72,97,46,104,97,108,102,10,107,116,68,
+68,97,46,104,97,108,102,12,107,116,68,68,68,72,97,46,104,97,108,102,11,107,
+116,68,68,72,97,46,104,97,108,102,10,107,116,82,72,97,46,104,97,108,102,9,
+107,116,68,97,46,104,97,108,102,9,107,116,82,97,46,104,97,108,102,9,107,116,
+76,97,46,104,97,108,102,9,107,116,72,97,46,104,97,108,102,10,107,116,86,83,
+73,46,115,117,98,51,8,107,116,82,97,72,111,111,107,12,107,116,82,97,65,110,
+117,115,118,97,114,97,15,107,116,82,97,67,97,110,100,114,97,98,105,110,100,
+117,5,110,117,108,108,82,8,122,101,114,111,100,101,118,97,7,111,110,101,100,
+101,118,97,7,116,119,111,100,101,118,97,9,116,104,114,101,101,100,101,118,
+97,8,102,111,117,114,100,101,118,97,8,102,105,118,101,100,101,118,97,7,115,
+105,120,100,101,118,97,9,115,101,118,101,110,100,101,118,97,9,101,105,103,
+104,116,100,101,118,97,8,110,105,110,101,100,101,118,97,7,117,110,105,65,
+56,51,48,7,117,110,105,65,56,51,49,7,117,110,105,65,56,51,50,7,117,110,105,
+65,56,51,51,7,117,110,105,65,56,51,52,7,117,110,105,65,56,51,53,7,117,110,
+105,65,56,51,54,7,117,110,105,65,56,51,55,7,117,110,105,65,56,51,56,7,117,
+110,105,65,56,51,57,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,70,0,0,
+4,6,0,2,0,9,0,4,0,5,0,3,0,6,0,54,0,1,0,55,0,58,0,3,0,59,0,60,0,1,0,61,0,62,
+0,3,0,63,0,84,0,1,0,85,0,86,0,3,0,87,1,33,0,1,1,34,1,36,0,3,1,122,0,187,1,
+222,2,104,2,60,3,6,1,226,1,232,1,238,2,230,1,244,3,12,1,250,2,54,2,0,2,42,
+2,6,2,224,2,12,2,18,2,24,2,154,3,30,3,12,2,132,2,230,2,154,2,30,2,230,2,54,
+2,36,2,42,2,48,2,54,3,110,2,60,3,36,2,60,2,66,2,100,3,124,2,72,3,180,2,76,
+2,80,2,86,2,92,2,96,2,100,2,104,2,116,2,108,2,112,2,192,2,116,2,116,3,2,2,
+120,2,204,3,160,2,192,2,204,2,180,3,156,2,124,2,128,3,176,2,132,2,138,3,60,
+3,64,3,156,2,176,3,156,2,188,2,204,3,152,3,180,3,64,2,144,3,106,2,196,2,188,
+2,172,3,136,3,2,3,54,2,148,2,154,3,172,3,98,3,106,2,160,2,164,3,188,2,168,
+3,60,3,94,2,172,2,176,2,180,2,184,3,120,3,160,2,188,3,116,2,192,3,102,2,196,
+2,200,2,204,2,208,3,98,2,212,2,218,2,224,3,24,2,230,3,124,2,242,3,176,2,246,
+2,236,3,124,2,242,3,176,3,124,3,176,2,246,3,124,3,124,2,250,2,250,2,254,3,
+86,3,2,3,6,3,54,3,12,3,98,3,18,3,24,3,30,3,36,3,42,3,48,3,54,3,156,3,60,3,
+98,3,64,3,68,3,74,3,78,3,82,3,148,3,86,3,152,3,156,3,90,3,94,3,148,3,98,3,
+132,3,102,3,188,3,144,3,106,3,110,3,116,3,120,3,124,3,128,3,132,3,136,3,140,
+3,144,3,148,3,152,3,156,3,160,3,164,3,168,3,184,3,172,3,176,3,180,3,184,3,
+188,0,2,0,16,0,4,0,5,0,0,0,17,0,62,0,2,0,68,0,86,0,48,0,88,0,94,0,67,0,97,
+0,106,0,74,0,117,0,119,0,84,0,123,0,123,0,87,0,126,0,126,0,88,0,132,0,149,
+0,89,0,151,0,152,0,107,0,170,0,171,0,109,0,193,0,196,0,111,0,213,0,213,0,
+115,0,216,0,225,0,116,0,231,0,254,0,126,1,0,1,36,0,150,0,1,0,27,0,2,0,24,
+0,25,0,2,0,36,0,37,0,2,0,31,0,32,0,2,0,58,0,59,0,2,0,51,0,52,0,2,0,28,0,29,
+0,2,0,38,0,39,0,2,0,47,0,48,0,2,0,59,0,60,0,2,0,20,0,21,0,2,0,63,0,64,0,2,
+0,39,0,40,0,2,0,49,0,50,0,2,0,10,0,11,0,2,0,40,0,41,0,2,0,48,0,49,0,2,0,46,
+0,47,0,1,0,22,0,1,0,24,0,2,0,4,0,5,0,2,0,15,0,16,0,1,0,8,0,1,0,19,0,1,0,4,
+0,1,0,12,0,1,0,71,0,1,0,67,0,1,0,63,0,1,0,33,0,1,0,70,0,1,0,73,0,2,0,27,0,
+28,0,2,0,16,0,17,0,1,0,78,0,2,0,88,0,89,0,2,0,23,0,24,0,1,0,41,0,1,0,66,0,
+1,0,60,0,1,0,48,0,1,0,37,0,1,0,44,0,1,0,53,0,1,0,62,0,1,0,61,0,1,0,68,0,1,
+0,72,0,1,0,35,0,1,0,76,0,2,0,82,0,83,0,2,0,87,0,88,0,2,0,50,0,51,0,2,0,32,
+0,33,0,2,0,89,0,90,0,1,0,14,0,1,0,17,0,1,0,102,0,1,0,95,0,1,0,64,0,2,0,37,
+0,38,0,2,0,30,0,31,0,2,0,25,0,26,0,2,0,29,0,30,0,2,0,45,0,46,0,2,0,26,0,27,
+0,2,0,52,0,53,0,2,0,43,0,44,0,2,0,34,0,35,0,1,0,36,0,1,0,45,0,2,0,79,0,80,
+0,1,0,92,0,1,0,86,0,1,0,25,0,1,0,100,0,1,0,43,0,1,0,55,0,1,0,42,0,1,0,39,
+0,1,0,65,0,2,0,41,0,42,0,1,0,54,0,1,0,52,0,1,0,16,0,1,0,31,0,1,0,58,0,1,0,
+51,0,1,0,28,0,1,0,49,0,1,0,38,0,1,0,50,0,1,0,47,0,1,0,59,0,1,0,30,0,1,0,10,
+0,1,0,46,0,1,0,18,0,1,0,23,0,1,0,40,0,1,0,56,0,1,0,61,0,1,0,1,0,0,0,1,0,0,
+0,10,0,32,0,60,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,109,
+97,114,107,0,14,109,107,109,107,0,22,0,0,0,2,0,0,0,1,0,0,0,1,0,2,0,3,0,8,
+7,18,9,208,0,4,0,0,0,1,0,8,0,1,0,12,0,34,0,1,0,134,0,204,0,1,0,9,0,4,0,5,
+0,57,0,58,0,85,0,86,1,34,1,35,1,36,0,2,0,16,0,17,0,54,0,0,0,59,0,60,0,38,
+0,68,0,84,0,40,0,88,0,94,0,57,0,97,0,106,0,64,0,117,0,119,0,74,0,123,0,123,
+0,77,0,126,0,126,0,78,0,132,0,149,0,79,0,151,0,152,0,97,0,170,0,171,0,99,
+0,193,0,196,0,101,0,213,0,213,0,105,0,216,0,225,0,106,0,231,0,254,0,116,1,
+0,1,33,0,140,0,9,0,0,9,126,0,0,9,134,0,0,0,38,0,0,0,46,0,0,0,54,0,0,0,62,
+0,0,9,142,0,0,9,150,0,0,9,158,0,2,254,212,5,120,0,4,0,2,254,212,5,120,0,15,
+0,2,254,212,5,120,0,27,0,2,254,212,5,120,0,16,0,174,1,94,4,166,1,102,1,110,
+5,198,1,118,5,206,1,126,5,214,1,190,5,222,5,230,5,238,5,246,5,254,6,6,1,134,
+1,142,1,150,6,14,1,158,1,166,3,54,1,174,1,182,1,190,1,198,1,206,6,22,6,30,
+1,214,1,222,1,230,1,238,6,38,1,246,5,190,1,254,2,6,2,14,2,22,2,30,2,38,2,
+46,2,54,2,62,2,70,2,78,2,86,2,94,2,102,2,110,2,118,2,126,2,134,2,142,2,150,
+2,158,2,166,2,174,2,182,2,190,2,198,2,206,2,214,2,222,2,230,2,238,2,246,2,
+254,3,6,3,14,3,22,3,30,3,38,3,46,3,54,3,62,3,70,3,78,3,86,3,94,3,102,3,110,
+3,118,5,102,3,126,3,134,3,142,3,150,3,158,3,166,3,174,5,174,3,182,3,190,3,
+198,3,206,3,214,3,222,3,230,3,238,3,246,3,254,4,6,4,14,4,22,4,30,4,38,4,46,
+4,54,4,62,4,70,4,78,4,86,4,94,4,102,4,110,4,118,4,126,4,134,4,142,4,150,4,
+158,4,166,4,174,4,182,4,190,4,198,4,206,4,214,4,222,4,230,4,238,4,246,4,254,
+5,6,5,14,5,22,5,30,5,38,5,46,5,54,5,62,5,70,5,78,5,86,5,94,5,102,5,110,5,
+118,5,126,5,134,5,142,5,150,5,158,5,166,5,174,5,182,5,190,5,198,5,206,5,214,
+5,222,5,230,5,238,5,246,5,254,6,6,6,14,6,22,6,30,6,38,6,46,0,2,3,52,5,120,
+0,48,0,2,3,232,5,120,0,24,0,2,3,232,5,120,0,36,0,2,3,132,5,120,0,32,0,2,3,
+152,5,120,0,30,0,2,4,216,5,120,0,20,0,2,3,132,5,120,0,23,0,2,3,182,5,120,
+0,45,0,2,3,202,5,120,0,27,0,2,3,202,5,120,0,32,0,2,4,46,5,120,0,63,0,2,3,
+142,5,120,0,32,0,2,4,36,5,120,0,40,0,2,3,202,5,120,0,39,0,2,3,112,5,120,0,
+49,0,2,3,142,5,120,0,41,0,2,4,76,5,120,0,48,0,2,3,52,5,120,0,26,0,2,4,166,
+5,120,0,48,0,2,0,250,5,120,0,4,0,2,0,182,7,76,0,22,0,2,0,245,6,68,0,8,0,2,
+0,214,7,195,0,19,0,2,6,95,7,67,0,63,0,2,3,52,5,120,0,71,0,2,3,52,5,120,0,
+67,0,2,3,222,5,120,0,61,0,2,3,212,5,120,0,63,0,2,4,36,5,120,0,63,0,2,4,36,
+5,120,0,64,0,2,2,158,5,120,0,33,0,2,2,158,5,120,0,35,0,2,4,216,5,120,0,59,
+0,2,4,216,5,120,0,61,0,2,4,201,7,67,0,35,0,2,3,42,5,120,0,44,0,2,3,42,5,120,
+0,47,0,2,4,156,5,120,0,70,0,2,4,156,5,120,0,73,0,2,4,169,6,124,0,18,0,2,5,
+118,7,67,0,36,0,2,3,212,5,120,0,45,0,2,3,212,5,120,0,47,0,2,5,140,5,120,0,
+37,0,2,4,216,5,120,0,47,0,2,3,42,5,120,0,62,0,2,3,222,5,120,0,35,0,2,6,122,
+7,67,0,50,0,2,4,64,7,67,0,23,0,2,6,52,7,67,0,45,0,2,6,102,7,67,0,78,0,2,2,
+78,5,120,0,65,0,2,2,58,5,120,0,68,0,2,6,65,7,67,0,62,0,2,3,122,5,120,0,48,
+0,2,3,142,5,120,0,51,0,2,4,84,7,67,0,64,0,2,3,92,5,120,0,34,0,2,3,52,5,120,
+0,88,0,2,3,92,5,120,0,23,0,2,5,118,7,67,0,46,0,2,5,28,7,67,0,42,0,2,5,18,
+7,67,0,65,0,2,4,242,7,67,0,41,0,2,4,144,7,67,0,66,0,2,4,239,7,67,0,56,0,2,
+5,23,7,67,0,60,0,2,5,13,7,67,0,36,0,2,4,65,7,67,0,48,0,2,5,99,7,67,0,37,0,
+2,5,112,7,67,0,44,0,2,5,191,7,67,0,53,0,2,5,106,7,67,0,52,0,2,5,15,7,67,0,
+59,0,2,5,19,7,67,0,62,0,2,5,231,7,67,0,61,0,2,4,203,7,67,0,39,0,2,5,23,7,
+67,0,68,0,2,4,231,7,67,0,72,0,2,6,149,7,67,0,35,0,2,5,221,7,67,0,76,0,2,5,
+43,7,67,0,42,0,2,8,72,5,120,0,82,0,2,7,188,5,120,0,87,0,2,3,32,5,120,0,50,
+0,2,3,192,5,120,0,29,0,2,2,138,5,120,0,32,0,2,5,4,6,124,0,16,0,2,8,224,6,
+124,0,14,0,2,10,219,6,124,0,18,0,2,10,37,6,124,0,17,0,2,8,102,5,120,0,89,
+0,2,9,163,6,124,0,16,0,2,8,250,6,124,0,14,0,2,11,28,6,124,0,18,0,2,10,115,
+6,124,0,16,0,2,10,245,6,124,0,18,0,2,8,146,6,124,0,17,0,2,10,89,6,124,0,16,
+0,2,6,138,6,124,0,16,0,2,6,95,7,67,0,102,0,2,10,14,7,67,0,102,0,2,9,207,7,
+67,0,95,0,2,9,87,7,67,0,100,0,2,6,95,7,67,0,64,0,2,4,216,5,120,0,37,0,2,3,
+202,5,120,0,34,0,2,3,122,5,120,0,30,0,2,3,172,5,120,0,42,0,2,3,182,5,120,
+0,25,0,2,3,132,5,120,0,29,0,2,3,202,5,120,0,45,0,2,3,32,5,120,0,26,0,2,4,
+156,5,120,0,52,0,2,4,16,5,120,0,43,0,2,3,152,5,120,0,34,0,2,5,1,7,67,0,47,
+0,2,4,247,7,67,0,36,0,2,5,85,7,67,0,42,0,2,4,231,7,67,0,45,0,2,6,214,5,120,
+0,79,0,2,8,117,7,67,0,92,0,2,9,6,5,120,0,86,0,2,3,152,5,120,0,25,0,2,5,32,
+7,67,0,38,0,2,10,155,7,67,0,100,0,2,6,119,7,67,0,50,0,2,5,118,7,67,0,47,0,
+2,5,29,7,67,0,43,0,2,5,79,7,67,0,55,0,2,5,95,7,67,0,38,0,2,5,45,7,67,0,42,
+0,2,5,105,7,67,0,58,0,2,4,201,7,67,0,39,0,2,5,191,7,67,0,56,0,2,6,59,7,67,
+0,49,0,2,6,65,7,67,0,65,0,2,3,152,5,120,0,41,0,2,5,53,7,67,0,54,0,2,7,43,
+7,67,0,52,0,2,5,160,6,124,0,16,0,2,3,62,5,120,0,31,0,2,4,56,5,120,0,58,0,
+2,3,52,5,120,0,51,0,2,2,138,5,120,0,28,0,2,2,88,5,120,0,49,0,2,2,148,5,120,
+0,38,0,2,2,148,5,120,0,50,0,2,2,148,5,120,0,47,0,2,2,148,5,120,0,59,0,2,2,
+28,5,120,0,30,0,2,2,168,5,120,0,10,0,2,2,88,5,120,0,40,0,2,2,78,5,120,0,46,
+0,2,16,35,6,124,0,18,0,4,0,0,0,1,0,8,0,1,0,12,0,24,0,1,0,82,0,132,0,1,0,4,
+0,55,0,56,0,61,0,62,0,2,0,9,0,17,0,51,0,0,0,117,0,119,0,35,0,193,0,196,0,
+38,0,213,0,213,0,42,0,220,0,220,0,43,0,239,0,241,0,44,0,243,0,249,0,47,0,
+254,0,254,0,54,1,16,1,16,0,55,0,4,0,0,0,18,0,0,0,26,0,0,0,34,0,0,0,42,0,2,
+252,254,255,246,0,23,0,2,253,183,0,0,0,24,0,2,1,44,0,0,0,4,0,2,255,26,0,0,
+0,12,0,56,0,114,0,122,0,130,0,138,0,146,0,154,0,162,0,170,0,178,0,186,0,194,
+0,202,0,210,0,218,0,226,0,234,0,242,0,250,1,2,1,10,1,18,1,26,1,34,1,42,1,
+50,1,58,1,66,1,74,1,82,1,90,1,98,1,106,1,114,1,122,1,130,1,138,1,146,1,154,
+1,162,1,170,1,178,1,186,1,194,1,202,1,210,1,218,1,226,1,234,1,242,1,250,2,
+2,2,10,2,18,2,26,2,34,2,42,0,2,3,42,0,0,0,49,0,2,4,216,0,0,0,38,0,2,3,212,
+0,0,0,25,0,2,3,212,0,0,0,37,0,2,2,188,0,0,0,32,0,2,3,132,0,0,0,33,0,2,2,103,
+0,0,0,59,0,2,4,136,0,0,0,31,0,2,2,208,254,132,0,52,0,2,4,36,0,0,0,41,0,2,
+2,58,0,0,0,29,0,2,2,48,0,0,0,50,0,2,2,188,0,0,0,39,0,2,2,128,254,112,0,51,
+0,2,2,58,0,0,0,48,0,2,2,118,254,112,0,60,0,2,4,216,0,0,0,21,0,2,3,122,0,0,
+0,24,0,2,3,182,0,0,0,46,0,2,2,18,0,0,0,31,0,2,3,192,0,0,0,28,0,2,3,202,0,
+0,0,33,0,2,3,92,0,0,0,24,0,2,3,162,255,236,0,64,0,2,3,142,0,0,0,33,0,2,4,
+16,0,0,0,41,0,2,3,212,0,0,0,40,0,2,3,122,0,0,0,50,0,2,2,148,0,0,0,11,0,2,
+2,98,0,0,0,41,0,2,3,152,0,0,0,42,0,2,4,66,0,0,0,49,0,2,3,42,0,0,0,27,0,2,
+4,156,0,0,0,49,0,2,2,158,255,126,0,47,0,2,3,91,0,0,0,35,0,2,3,42,254,112,
+0,89,0,2,3,91,0,0,0,24,0,2,8,47,0,0,0,83,0,2,7,188,0,0,0,88,0,2,3,44,0,0,
+0,51,0,2,3,187,0,0,0,30,0,2,1,241,254,226,0,33,0,2,8,121,0,0,0,90,0,2,4,223,
+0,0,0,38,0,2,3,220,0,0,0,35,0,2,3,131,0,0,0,31,0,2,3,200,0,0,0,26,0,2,3,145,
+0,0,0,30,0,2,3,208,0,0,0,46,0,2,3,49,0,0,0,27,0,2,4,167,0,0,0,53,0,2,4,37,
+0,0,0,44,0,2,4,153,0,0,0,35,0,2,6,219,0,0,0,80,0,2,3,155,0,0,0,42,0,6,0,0,
+0,1,0,8,0,1,0,12,0,26,0,1,0,38,0,100,0,1,0,5,0,4,0,5,1,34,1,35,1,36,0,1,0,
+4,0,57,0,58,0,85,0,86,0,5,0,0,0,22,0,0,0,30,0,0,0,38,0,0,0,46,0,0,0,54,0,
+2,254,192,5,120,0,27,0,2,255,36,5,160,0,12,0,2,0,245,6,104,0,23,0,2,0,245,
+6,104,0,40,0,2,0,245,6,104,0,56,0,4,0,10,0,18,0,26,0,34,0,2,254,252,6,104,
+0,5,0,2,255,70,7,152,0,16,0,2,255,96,6,104,0,28,0,2,254,252,6,104,0,17,0,
+0,0,1,0,0,0,10,0,36,0,108,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,4,0,0,
+0,1,0,2,0,3,0,4,99,99,109,112,0,26,115,115,48,49,0,54,115,115,48,50,0,60,
+115,115,48,51,0,66,0,0,0,12,0,0,0,1,0,2,0,3,0,4,0,6,0,7,0,9,0,12,0,13,0,14,
+0,15,0,0,0,1,0,18,0,0,0,1,0,16,0,0,0,1,0,17,0,39,0,80,0,186,1,220,3,152,5,
+86,7,48,9,142,9,182,10,46,10,60,13,2,13,44,13,64,19,178,21,186,23,28,24,200,
+25,46,25,66,25,92,28,90,32,20,35,206,39,136,43,66,47,54,47,68,47,82,47,96,
+47,110,47,124,47,138,47,152,47,166,47,180,47,194,47,208,47,222,47,236,0,4,
+0,0,0,1,0,8,0,1,0,88,0,3,0,12,0,64,0,76,0,5,0,12,0,20,0,28,0,36,0,44,0,118,
+0,3,0,61,0,17,0,220,0,3,0,61,0,35,0,193,0,3,0,61,0,43,0,194,0,3,0,61,0,44,
+1,1,0,3,0,61,0,50,0,1,0,4,0,117,0,3,0,61,0,34,0,1,0,4,0,254,0,3,0,61,0,44,
+0,1,0,3,0,17,0,39,0,42,0,4,0,0,0,1,0,8,0,1,0,244,0,17,0,40,0,52,0,64,0,76,
+0,88,0,100,0,112,0,124,0,136,0,148,0,160,0,172,0,184,0,196,0,208,0,220,0,
+232,0,1,0,4,0,195,0,3,0,61,0,45,0,1,0,4,0,239,0,3,0,61,0,45,0,1,0,4,0,196,
+0,3,0,61,0,45,0,1,0,4,0,240,0,3,0,61,0,45,0,1,0,4,0,241,0,3,0,61,0,45,0,1,
+0,4,0,249,0,3,0,61,0,45,0,1,0,4,0,213,0,3,0,61,0,45,0,1,0,4,1,2,0,3,0,61,
+0,45,0,1,0,4,0,242,0,3,0,61,0,45,0,1,0,4,0,243,0,3,0,61,0,45,0,1,0,4,0,119,
+0,3,0,61,0,45,0,1,0,4,0,244,0,3,0,61,0,45,0,1,0,4,0,248,0,3,0,61,0,45,0,1,
+0,4,0,245,0,3,0,61,0,45,0,1,0,4,1,16,0,3,0,61,0,45,0,1,0,4,0,246,0,3,0,61,
+0,45,0,1,0,4,0,247,0,3,0,61,0,45,0,1,0,17,0,17,0,18,0,19,0,20,0,22,0,24,0,
+27,0,34,0,35,0,37,0,39,0,41,0,42,0,43,0,47,0,49,0,50,0,4,0,0,0,1,0,8,0,1,
+1,170,0,35,0,76,0,86,0,96,0,106,0,116,0,126,0,136,0,146,0,156,0,166,0,176,
+0,186,0,196,0,206,0,216,0,226,0,236,0,246,1,0,1,10,1,20,1,30,1,40,1,50,1,
+60,1,70,1,80,1,90,1,100,1,110,1,120,1,130,1,140,1,150,1,160,0,1,0,4,0,189,
+0,2,0,61,0,1,0,4,0,190,0,2,0,61,0,1,0,4,0,120,0,2,0,61,0,1,0,4,0,191,0,2,
+0,61,0,1,0,4,1,20,0,2,0,61,0,1,0,4,0,192,0,2,0,61,0,1,0,4,1,21,0,2,0,61,0,
+1,0,4,0,197,0,2,0,61,0,1,0,4,1,22,0,2,0,61,0,1,0,4,0,255,0,2,0,61,0,1,0,4,
+1,23,0,2,0,61,0,1,0,4,1,24,0,2,0,61,0,1,0,4,1,25,0,2,0,61,0,1,0,4,1,26,0,
+2,0,61,0,1,0,4,1,27,0,2,0,61,0,1,0,4,1,28,0,2,0,61,0,1,0,4,0,198,0,2,0,61,
+0,1,0,4,0,199,0,2,0,61,0,1,0,4,0,200,0,2,0,61,0,1,0,4,1,29,0,2,0,61,0,1,0,
+4,0,201,0,2,0,61,0,1,0,4,0,202,0,2,0,61,0,1,0,4,0,203,0,2,0,61,0,1,0,4,0,
+204,0,2,0,61,0,1,0,4,0,205,0,2,0,61,0,1,0,4,0,206,0,2,0,61,0,1,0,4,0,207,
+0,2,0,61,0,1,0,4,0,208,0,2,0,61,0,1,0,4,1,30,0,2,0,61,0,1,0,4,1,31,0,2,0,
+61,0,1,0,4,0,209,0,2,0,61,0,1,0,4,0,210,0,2,0,61,0,1,0,4,0,211,0,2,0,61,0,
+1,0,4,0,212,0,2,0,61,0,1,0,4,1,32,0,2,0,61,0,2,0,1,0,17,0,51,0,0,0,6,0,0,
+0,1,0,8,0,2,0,24,0,88,0,96,0,214,0,6,0,0,1,22,1,104,0,0,0,0,0,0,0,2,0,10,
+0,17,0,51,0,0,0,117,0,120,0,35,0,189,0,213,0,39,0,220,0,220,0,64,0,239,0,
+249,0,65,0,254,0,255,0,76,1,1,1,2,0,78,1,16,1,16,0,80,1,20,1,29,0,81,1,31,
+1,32,0,91,0,1,1,30,0,1,0,1,0,2,0,19,0,17,0,51,0,2,0,52,0,54,0,5,0,57,0,60,
+0,5,0,61,0,61,0,3,0,117,0,119,0,2,0,120,0,120,0,1,0,189,0,192,0,1,0,193,0,
+196,0,2,0,197,0,212,0,1,0,213,0,213,0,2,0,220,0,220,0,2,0,239,0,249,0,2,0,
+254,0,254,0,2,0,255,0,255,0,1,1,1,1,2,0,2,1,16,1,16,0,2,1,20,1,29,0,1,1,30,
+1,30,0,4,1,31,1,32,0,1,0,2,0,10,0,17,0,51,0,1,0,117,0,120,0,1,0,189,0,213,
+0,1,0,220,0,220,0,1,0,239,0,249,0,1,0,254,0,255,0,1,1,1,1,2,0,1,1,16,1,16,
+0,1,1,20,1,32,0,1,1,34,1,34,0,2,0,4,0,10,0,30,0,48,0,66,0,1,0,1,0,4,0,1,0,
+2,0,5,0,0,0,1,0,3,0,5,0,1,0,1,0,3,0,1,0,2,0,0,0,1,0,2,0,5,0,1,0,1,0,3,0,2,
+0,5,0,0,0,1,0,2,0,5,0,1,0,1,0,2,0,2,0,0,0,1,0,1,0,5,0,4,0,10,0,30,0,48,0,
+64,0,1,0,1,0,4,0,3,0,2,0,5,0,0,0,1,0,3,0,5,0,1,0,1,0,3,0,3,0,2,0,0,0,1,0,
+2,0,5,0,1,0,1,0,2,0,5,0,0,0,1,0,1,0,5,0,1,0,1,0,1,0,0,0,1,0,0,0,5,0,5,0,0,
+0,1,0,8,0,2,7,220,0,20,0,6,0,0,0,0,0,0,0,114,0,0,0,0,0,2,0,15,0,17,0,51,0,
+1,0,52,0,54,0,5,0,57,0,60,0,5,0,61,0,61,0,4,0,117,0,120,0,1,0,189,0,213,0,
+1,0,220,0,220,0,1,0,239,0,249,0,1,0,254,0,255,0,1,1,1,1,2,0,1,1,16,1,16,0,
+1,1,20,1,29,0,1,1,30,1,30,0,3,1,31,1,32,0,1,1,34,1,34,0,2,0,18,0,38,0,54,
+0,72,0,90,0,110,0,128,0,148,0,168,0,190,0,204,0,220,0,238,0,254,1,14,1,32,
+1,52,1,70,1,82,0,5,0,1,0,1,0,1,0,1,0,2,0,0,0,11,0,6,0,1,0,1,0,4,0,1,0,1,0,
+2,0,0,0,11,0,6,0,1,0,1,0,1,0,4,0,1,0,2,0,0,0,11,0,7,0,1,0,1,0,4,0,1,0,4,0,
+1,0,2,0,0,0,11,0,6,0,1,0,1,0,1,0,1,0,5,0,2,0,0,0,11,0,7,0,1,0,1,0,4,0,1,0,
+1,0,5,0,2,0,0,0,11,0,7,0,1,0,1,0,1,0,4,0,1,0,5,0,2,0,0,0,11,0,8,0,1,0,1,0,
+4,0,1,0,4,0,1,0,5,0,2,0,0,0,11,0,4,0,1,0,1,0,1,0,2,0,0,0,11,0,5,0,1,0,1,0,
+4,0,1,0,2,0,0,0,11,0,6,0,1,0,1,0,4,0,1,0,4,0,2,0,0,0,11,0,5,0,1,0,1,0,1,0,
+4,0,2,0,0,0,11,0,5,0,1,0,1,0,1,0,5,0,2,0,0,0,11,0,6,0,1,0,1,0,4,0,1,0,5,0,
+2,0,0,0,11,0,7,0,1,0,1,0,4,0,1,0,4,0,5,0,2,0,0,0,11,0,6,0,1,0,1,0,1,0,4,0,
+5,0,2,0,0,0,11,0,3,0,1,0,1,0,2,0,0,0,11,0,4,0,1,0,1,0,5,0,2,0,0,0,11,0,2,
+0,0,0,1,0,8,0,1,0,138,0,66,0,202,0,208,0,214,0,220,0,226,0,232,0,238,0,244,
+0,250,1,0,1,6,1,12,1,18,1,24,1,30,1,36,1,42,1,48,1,54,1,60,1,66,1,72,1,78,
+1,84,1,90,1,96,1,102,1,108,1,114,1,120,1,126,1,132,1,138,1,144,1,150,1,156,
+1,162,1,168,1,174,1,180,1,186,1,192,1,198,1,204,1,210,1,216,1,222,1,228,1,
+234,1,240,1,246,1,252,2,2,2,8,2,14,2,20,2,26,2,32,2,38,2,44,2,50,2,56,2,62,
+2,68,2,74,2,80,0,2,0,10,0,17,0,54,0,0,0,57,0,60,0,38,0,117,0,119,0,42,0,193,
+0,196,0,45,0,213,0,213,0,49,0,220,0,220,0,50,0,239,0,249,0,51,0,254,0,254,
+0,62,1,1,1,2,0,63,1,16,1,16,0,65,0,2,0,17,1,34,0,2,0,18,1,34,0,2,0,19,1,34,
+0,2,0,20,1,34,0,2,0,21,1,34,0,2,0,22,1,34,0,2,0,23,1,34,0,2,0,24,1,34,0,2,
+0,25,1,34,0,2,0,26,1,34,0,2,0,27,1,34,0,2,0,28,1,34,0,2,0,29,1,34,0,2,0,30,
+1,34,0,2,0,31,1,34,0,2,0,32,1,34,0,2,0,33,1,34,0,2,0,34,1,34,0,2,0,35,1,34,
+0,2,0,36,1,34,0,2,0,37,1,34,0,2,0,38,1,34,0,2,0,39,1,34,0,2,0,40,1,34,0,2,
+0,41,1,34,0,2,0,42,1,34,0,2,0,43,1,34,0,2,0,44,1,34,0,2,0,45,1,34,0,2,0,46,
+1,34,0,2,0,47,1,34,0,2,0,48,1,34,0,2,0,49,1,34,0,2,0,50,1,34,0,2,0,51,1,34,
+0,2,0,52,1,34,0,2,0,53,1,34,0,2,0,54,1,34,0,2,0,57,1,34,0,2,0,58,1,34,0,2,
+0,59,1,34,0,2,0,60,1,34,0,2,0,117,1,34,0,2,0,118,1,34,0,2,0,119,1,34,0,2,
+0,193,1,34,0,2,0,194,1,34,0,2,0,195,1,34,0,2,0,196,1,34,0,2,0,213,1,34,0,
+2,0,220,1,34,0,2,0,239,1,34,0,2,0,240,1,34,0,2,0,241,1,34,0,2,0,242,1,34,
+0,2,0,243,1,34,0,2,0,244,1,34,0,2,0,245,1,34,0,2,0,246,1,34,0,2,0,247,1,34,
+0,2,0,248,1,34,0,2,0,249,1,34,0,2,0,254,1,34,0,2,1,1,1,34,0,2,1,2,1,34,0,
+2,1,16,1,34,0,4,0,0,0,1,0,8,0,1,0,26,0,1,0,8,0,2,0,6,0,12,1,36,0,2,0,4,1,
+35,0,2,0,5,0,1,0,1,1,34,0,4,0,0,0,1,0,8,0,1,0,98,0,5,0,16,0,58,0,68,0,78,
+0,88,0,5,0,12,0,18,0,24,0,30,0,36,0,226,0,2,0,4,0,227,0,2,0,5,0,230,0,2,1,
+34,0,228,0,2,1,35,0,229,0,2,1,36,0,1,0,4,0,86,0,2,0,5,0,1,0,4,0,85,0,2,0,
+5,0,1,0,4,0,95,0,2,0,5,0,1,0,4,0,96,0,2,0,5,0,1,0,5,0,53,0,57,0,58,0,59,0,
+60,0,1,0,0,0,1,0,8,0,1,3,4,0,4,0,6,1,0,0,1,0,8,0,2,0,22,0,0,0,92,0,198,0,
+5,0,0,0,238,1,212,0,0,2,174,0,2,0,11,0,17,0,51,0,0,0,53,0,53,0,35,0,117,0,
+120,0,36,0,189,0,213,0,40,0,220,0,220,0,65,0,226,0,230,0,66,0,239,0,249,0,
+71,0,254,0,255,0,82,1,1,1,2,0,84,1,16,1,16,0,86,1,20,1,32,0,87,0,2,0,17,0,
+17,0,51,0,2,0,53,0,53,0,4,0,61,0,61,0,3,0,117,0,119,0,2,0,120,0,120,0,1,0,
+189,0,192,0,1,0,193,0,196,0,2,0,197,0,212,0,1,0,213,0,213,0,2,0,220,0,220,
+0,2,0,226,0,230,0,4,0,239,0,249,0,2,0,254,0,254,0,2,0,255,0,255,0,1,1,1,1,
+2,0,2,1,16,1,16,0,2,1,20,1,32,0,1,0,2,0,6,0,53,0,53,0,1,0,226,0,226,0,3,0,
+227,0,227,0,2,0,228,0,228,0,4,0,229,0,229,0,5,0,230,0,230,0,6,0,12,0,26,0,
+44,0,62,0,80,0,98,0,116,0,134,0,150,0,166,0,182,0,198,0,214,0,0,0,3,0,1,0,
+2,0,1,0,1,0,1,0,0,0,19,0,0,0,3,0,1,0,2,0,1,0,2,0,1,0,0,0,20,0,0,0,3,0,1,0,
+2,0,1,0,3,0,1,0,0,0,21,0,0,0,3,0,1,0,2,0,1,0,4,0,1,0,0,0,22,0,0,0,3,0,1,0,
+2,0,1,0,5,0,1,0,0,0,23,0,0,0,3,0,1,0,2,0,1,0,6,0,1,0,0,0,24,0,0,0,2,0,2,0,
+1,0,1,0,1,0,0,0,19,0,0,0,2,0,2,0,1,0,2,0,1,0,0,0,20,0,0,0,2,0,2,0,1,0,3,0,
+1,0,0,0,21,0,0,0,2,0,2,0,1,0,4,0,1,0,0,0,22,0,0,0,2,0,2,0,1,0,5,0,1,0,0,0,
+23,0,0,0,2,0,2,0,1,0,6,0,1,0,0,0,24,0,12,0,26,0,44,0,62,0,80,0,98,0,116,0,
+134,0,148,0,162,0,176,0,190,0,204,0,0,0,3,0,3,0,2,0,1,0,1,0,1,0,0,0,19,0,
+0,0,3,0,3,0,2,0,1,0,2,0,1,0,0,0,20,0,0,0,3,0,3,0,2,0,1,0,3,0,1,0,0,0,21,0,
+0,0,3,0,3,0,2,0,1,0,4,0,1,0,0,0,22,0,0,0,3,0,3,0,2,0,1,0,5,0,1,0,0,0,23,0,
+0,0,3,0,3,0,2,0,1,0,6,0,1,0,0,0,24,0,0,0,1,0,1,0,1,0,1,0,0,0,19,0,0,0,1,0,
+1,0,2,0,1,0,0,0,20,0,0,0,1,0,1,0,3,0,1,0,0,0,21,0,0,0,1,0,1,0,4,0,1,0,0,0,
+22,0,0,0,1,0,1,0,5,0,1,0,0,0,23,0,0,0,1,0,1,0,6,0,1,0,0,0,24,0,1,0,4,0,0,
+0,1,0,0,0,1,0,0,0,10,0,1,0,0,0,1,0,8,0,2,0,18,0,6,1,37,1,37,1,37,1,37,1,37,
+1,37,0,1,0,6,0,53,0,226,0,227,0,228,0,229,0,230,0,1,0,0,0,1,0,8,0,1,0,6,0,
+7,0,1,0,1,1,30,0,5,0,8,0,1,0,8,0,2,0,20,0,28,0,6,0,0,0,0,0,0,0,0,0,0,1,100,
+0,1,0,2,0,53,1,19,0,2,0,54,0,17,0,17,0,2,0,18,0,18,0,3,0,19,0,21,0,4,0,22,
+0,22,0,2,0,23,0,24,0,3,0,25,0,26,0,4,0,27,0,28,0,1,0,29,0,30,0,2,0,31,0,32,
+0,1,0,33,0,33,0,3,0,34,0,35,0,4,0,36,0,36,0,1,0,37,0,38,0,4,0,39,0,39,0,2,
+0,40,0,40,0,3,0,41,0,43,0,4,0,44,0,45,0,2,0,46,0,47,0,4,0,48,0,48,0,3,0,49,
+0,49,0,2,0,50,0,50,0,3,0,51,0,51,0,1,0,53,0,53,0,5,0,117,0,119,0,2,0,120,
+0,120,0,1,0,189,0,190,0,2,0,191,0,192,0,1,0,195,0,195,0,2,0,196,0,196,0,4,
+0,197,0,197,0,1,0,198,0,198,0,2,0,199,0,203,0,1,0,204,0,204,0,2,0,205,0,209,
+0,1,0,210,0,210,0,2,0,211,0,212,0,1,0,239,0,239,0,3,0,240,0,240,0,4,0,241,
+0,241,0,2,0,242,0,245,0,4,0,246,0,246,0,2,0,247,0,247,0,3,0,248,0,248,0,4,
+0,249,0,249,0,3,0,255,0,255,0,1,1,2,1,2,0,4,1,16,1,16,0,4,1,19,1,19,0,5,1,
+21,1,21,0,3,1,23,1,24,0,1,1,25,1,26,0,2,1,27,1,29,0,1,1,30,1,30,0,2,1,32,
+1,32,0,1,0,83,0,168,0,182,0,196,0,210,0,224,0,238,0,252,1,10,1,24,1,38,1,
+52,1,66,1,80,1,94,1,108,1,122,1,136,1,150,1,164,1,178,1,192,1,206,1,220,1,
+234,1,248,2,6,2,20,2,34,2,48,2,62,2,76,2,90,2,104,2,118,2,132,2,146,2,160,
+2,174,2,188,2,202,2,216,2,230,2,244,3,2,3,16,3,30,3,44,3,58,3,72,3,86,3,100,
+3,114,3,128,3,142,3,156,3,170,3,184,3,198,3,212,3,226,3,240,3,254,4,12,4,
+26,4,40,4,52,4,64,4,76,4,88,4,100,4,112,4,124,4,136,4,148,4,160,4,172,4,184,
+4,196,4,208,4,220,4,232,4,242,4,252,0,4,0,1,0,1,0,1,0,1,0,0,0,38,0,4,0,1,
+0,1,0,1,0,2,0,0,0,38,0,4,0,1,0,1,0,1,0,3,0,0,0,38,0,4,0,1,0,1,0,1,0,4,0,0,
+0,38,0,4,0,1,0,1,0,2,0,1,0,0,0,38,0,4,0,1,0,1,0,2,0,2,0,0,0,38,0,4,0,1,0,
+1,0,2,0,3,0,0,0,38,0,4,0,1,0,1,0,2,0,4,0,0,0,38,0,4,0,1,0,1,0,3,0,1,0,0,0,
+38,0,4,0,1,0,1,0,3,0,2,0,0,0,38,0,4,0,1,0,1,0,3,0,3,0,0,0,38,0,4,0,1,0,1,
+0,3,0,4,0,0,0,38,0,4,0,1,0,1,0,4,0,1,0,0,0,38,0,4,0,1,0,1,0,4,0,2,0,0,0,38,
+0,4,0,1,0,1,0,4,0,3,0,0,0,38,0,4,0,1,0,1,0,4,0,4,0,0,0,38,0,4,0,1,0,2,0,1,
+0,1,0,0,0,38,0,4,0,1,0,2,0,1,0,2,0,0,0,38,0,4,0,1,0,2,0,1,0,3,0,0,0,38,0,
+4,0,1,0,2,0,1,0,4,0,0,0,38,0,4,0,1,0,2,0,2,0,1,0,0,0,38,0,4,0,1,0,2,0,2,0,
+2,0,0,0,38,0,4,0,1,0,2,0,2,0,3,0,0,0,38,0,4,0,1,0,2,0,2,0,4,0,0,0,38,0,4,
+0,1,0,2,0,3,0,1,0,0,0,38,0,4,0,1,0,2,0,3,0,2,0,0,0,38,0,4,0,1,0,2,0,3,0,3,
+0,0,0,38,0,4,0,1,0,2,0,3,0,4,0,0,0,38,0,4,0,1,0,2,0,4,0,1,0,0,0,38,0,4,0,
+1,0,2,0,4,0,2,0,0,0,38,0,4,0,1,0,2,0,4,0,3,0,0,0,38,0,4,0,1,0,2,0,4,0,4,0,
+0,0,38,0,4,0,1,0,3,0,1,0,1,0,0,0,38,0,4,0,1,0,3,0,1,0,2,0,0,0,38,0,4,0,1,
+0,3,0,1,0,3,0,0,0,38,0,4,0,1,0,3,0,1,0,4,0,0,0,38,0,4,0,1,0,3,0,2,0,1,0,0,
+0,38,0,4,0,1,0,3,0,2,0,2,0,0,0,38,0,4,0,1,0,3,0,2,0,3,0,0,0,38,0,4,0,1,0,
+3,0,2,0,4,0,0,0,38,0,4,0,1,0,3,0,3,0,1,0,0,0,38,0,4,0,1,0,3,0,3,0,2,0,0,0,
+38,0,4,0,1,0,3,0,3,0,3,0,0,0,38,0,4,0,1,0,3,0,3,0,4,0,0,0,38,0,4,0,1,0,3,
+0,4,0,1,0,0,0,38,0,4,0,1,0,3,0,4,0,2,0,0,0,38,0,4,0,1,0,3,0,4,0,3,0,0,0,38,
+0,4,0,1,0,3,0,4,0,4,0,0,0,38,0,4,0,1,0,4,0,1,0,1,0,0,0,38,0,4,0,1,0,4,0,1,
+0,2,0,0,0,38,0,4,0,1,0,4,0,1,0,3,0,0,0,38,0,4,0,1,0,4,0,1,0,4,0,0,0,38,0,
+4,0,1,0,4,0,2,0,1,0,0,0,38,0,4,0,1,0,4,0,2,0,2,0,0,0,38,0,4,0,1,0,4,0,2,0,
+3,0,0,0,38,0,4,0,1,0,4,0,2,0,4,0,0,0,38,0,4,0,1,0,4,0,3,0,1,0,0,0,38,0,4,
+0,1,0,4,0,3,0,2,0,0,0,38,0,4,0,1,0,4,0,3,0,3,0,0,0,38,0,4,0,1,0,4,0,3,0,4,
+0,0,0,38,0,4,0,1,0,4,0,4,0,1,0,0,0,38,0,4,0,1,0,4,0,4,0,2,0,0,0,38,0,4,0,
+1,0,4,0,4,0,3,0,0,0,38,0,4,0,1,0,4,0,4,0,4,0,0,0,38,0,3,0,1,0,4,0,4,0,0,0,
+28,0,3,0,1,0,4,0,1,0,0,0,29,0,3,0,1,0,1,0,4,0,0,0,29,0,3,0,1,0,4,0,2,0,0,
+0,30,0,3,0,1,0,2,0,4,0,0,0,30,0,3,0,1,0,4,0,3,0,0,0,31,0,3,0,1,0,3,0,4,0,
+0,0,31,0,3,0,1,0,1,0,1,0,0,0,32,0,3,0,1,0,1,0,2,0,0,0,33,0,3,0,1,0,2,0,1,
+0,0,0,33,0,3,0,1,0,1,0,3,0,0,0,34,0,3,0,1,0,3,0,1,0,0,0,34,0,3,0,1,0,2,0,
+2,0,0,0,35,0,3,0,1,0,2,0,3,0,0,0,36,0,3,0,1,0,3,0,2,0,0,0,36,0,3,0,1,0,3,
+0,3,0,0,0,37,0,2,0,1,0,1,0,0,0,25,0,2,0,1,0,2,0,0,0,26,0,2,0,1,0,3,0,0,0,
+27,0,4,0,0,0,1,0,8,0,1,1,210,0,23,0,52,0,70,0,88,0,106,0,124,0,142,0,160,
+0,178,0,196,0,214,0,232,0,250,1,12,1,30,1,48,1,66,1,84,1,102,1,120,1,138,
+1,156,1,174,1,192,0,2,0,6,0,12,0,69,0,2,0,55,0,70,0,2,0,56,0,2,0,6,0,12,0,
+77,0,2,0,55,0,78,0,2,0,56,0,2,0,6,0,12,0,89,0,2,0,55,0,90,0,2,0,56,0,2,0,
+6,0,12,0,121,0,2,0,55,0,122,0,2,0,56,0,2,0,6,0,12,0,104,0,2,0,55,0,125,0,
+2,0,56,0,2,0,6,0,12,0,127,0,2,0,55,0,128,0,2,0,56,0,2,0,6,0,12,0,130,0,2,
+0,55,0,131,0,2,0,56,0,2,0,6,0,12,0,153,0,2,0,55,0,155,0,2,0,56,0,2,0,6,0,
+12,0,156,0,2,0,55,0,162,0,2,0,56,0,2,0,6,0,12,0,163,0,2,0,55,0,165,0,2,0,
+56,0,2,0,6,0,12,0,159,0,2,0,55,0,167,0,2,0,56,0,2,0,6,0,12,0,158,0,2,0,55,
+0,161,0,2,0,56,0,2,0,6,0,12,0,80,0,2,0,55,0,81,0,2,0,56,0,2,0,6,0,12,0,105,
+0,2,0,55,0,172,0,2,0,56,0,2,0,6,0,12,0,73,0,2,0,55,0,74,0,2,0,56,0,2,0,6,
+0,12,0,71,0,2,0,55,0,72,0,2,0,56,0,2,0,6,0,12,0,175,0,2,0,55,0,177,0,2,0,
+56,0,2,0,6,0,12,0,75,0,2,0,55,0,76,0,2,0,56,0,2,0,6,0,12,0,179,0,2,0,55,0,
+181,0,2,0,56,0,2,0,6,0,12,0,182,0,2,0,55,0,184,0,2,0,56,0,2,0,6,0,12,0,185,
+0,2,0,55,0,187,0,2,0,56,0,2,0,6,0,12,0,82,0,2,0,55,0,83,0,2,0,56,0,2,0,6,
+0,12,0,101,0,2,0,55,0,102,0,2,0,56,0,2,0,7,0,17,0,20,0,0,0,22,0,22,0,4,0,
+24,0,25,0,5,0,33,0,35,0,7,0,37,0,39,0,10,0,41,0,45,0,13,0,47,0,51,0,18,0,
+4,0,0,0,1,0,8,0,1,1,38,0,24,0,54,0,64,0,74,0,84,0,94,0,104,0,114,0,124,0,
+134,0,144,0,154,0,164,0,174,0,184,0,194,0,204,0,214,0,224,0,234,0,244,0,254,
+1,8,1,18,1,28,0,1,0,4,0,250,0,2,0,54,0,1,0,4,0,234,0,2,0,54,0,1,0,4,0,251,
+0,2,0,54,0,1,0,4,0,236,0,2,0,54,0,1,0,4,0,237,0,2,0,54,0,1,0,4,0,238,0,2,
+0,54,0,1,0,4,0,252,0,2,0,54,0,1,0,4,0,253,0,2,0,54,0,1,0,4,0,235,0,2,0,54,
+0,1,0,4,1,5,0,2,0,54,0,1,0,4,1,6,0,2,0,54,0,1,0,4,1,7,0,2,0,54,0,1,0,4,1,
+8,0,2,0,54,0,1,0,4,1,9,0,2,0,54,0,1,0,4,1,10,0,2,0,54,0,1,0,4,1,11,0,2,0,
+54,0,1,0,4,1,12,0,2,0,54,0,1,0,4,1,15,0,2,0,54,0,1,0,4,1,13,0,2,0,54,0,1,
+0,4,1,14,0,2,0,54,0,1,0,4,1,0,0,2,0,54,0,1,0,4,1,4,0,2,0,54,0,1,0,4,1,3,0,
+2,0,54,0,1,0,4,1,17,0,2,0,54,0,1,0,24,0,117,0,118,0,119,0,193,0,194,0,195,
+0,196,0,213,0,220,0,239,0,240,0,241,0,242,0,243,0,244,0,245,0,246,0,247,0,
+248,0,249,0,254,1,1,1,2,1,16,0,4,0,0,0,1,0,8,0,1,1,148,0,34,0,74,0,84,0,104,
+0,94,0,104,0,114,0,124,0,134,0,144,0,154,0,164,0,174,0,184,0,194,0,204,0,
+214,0,224,0,234,0,244,0,254,1,8,1,18,1,28,1,38,1,48,1,58,1,68,1,78,1,88,1,
+98,1,108,1,118,1,128,1,138,0,1,0,4,0,68,0,2,0,54,0,1,0,4,0,97,0,2,0,54,0,
+1,0,4,0,123,0,2,0,54,0,1,0,4,0,88,0,2,0,54,0,1,0,4,0,126,0,2,0,54,0,1,0,4,
+0,100,0,2,0,54,0,1,0,4,0,99,0,2,0,54,0,1,0,4,0,132,0,2,0,54,0,1,0,4,0,133,
+0,2,0,54,0,1,0,4,0,134,0,2,0,54,0,1,0,4,0,135,0,2,0,54,0,1,0,4,0,149,0,2,
+0,54,0,1,0,4,0,136,0,2,0,54,0,1,0,4,0,151,0,2,0,54,0,1,0,4,0,152,0,2,0,54,
+0,1,0,4,0,137,0,2,0,54,0,1,0,4,0,138,0,2,0,54,0,1,0,4,0,139,0,2,0,54,0,1,
+0,4,0,140,0,2,0,54,0,1,0,4,0,141,0,2,0,54,0,1,0,4,0,79,0,2,0,54,0,1,0,4,0,
+170,0,2,0,54,0,1,0,4,0,171,0,2,0,54,0,1,0,4,0,142,0,2,0,54,0,1,0,4,0,143,
+0,2,0,54,0,1,0,4,0,144,0,2,0,54,0,1,0,4,0,98,0,2,0,54,0,1,0,4,0,145,0,2,0,
+54,0,1,0,4,0,146,0,2,0,54,0,1,0,4,0,147,0,2,0,54,0,1,0,4,0,148,0,2,0,54,0,
+1,0,4,0,103,0,2,0,54,0,1,0,4,0,106,0,2,0,54,0,2,0,2,0,17,0,25,0,0,0,27,0,
+51,0,9,0,1,0,0,0,1,0,8,0,2,0,48,0,21,0,93,0,174,0,173,0,178,0,92,0,168,0,
+188,0,94,0,150,0,169,0,124,0,129,0,154,0,157,0,160,0,166,0,164,0,176,0,180,
+0,183,0,186,0,1,0,21,0,69,0,71,0,73,0,75,0,77,0,80,0,82,0,89,0,104,0,105,
+0,121,0,127,0,153,0,156,0,158,0,159,0,163,0,175,0,179,0,182,0,185,0,1,0,0,
+0,1,0,8,0,1,0,6,0,122,0,1,0,1,0,152,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,87,0,91,
+0,1,0,2,0,7,0,33,0,2,0,8,0,1,0,8,0,1,18,168,0,94,0,194,0,200,0,206,0,212,
+0,218,0,224,0,230,0,236,0,242,0,248,0,254,1,4,1,10,1,16,1,22,1,28,1,34,1,
+40,1,46,1,52,1,58,1,64,1,70,1,76,1,82,1,88,1,94,1,100,1,106,1,112,1,118,1,
+124,1,130,1,136,1,142,1,148,1,154,1,160,1,166,1,172,1,178,1,184,1,190,1,196,
+1,202,1,208,1,214,1,220,1,226,1,232,1,238,1,244,1,250,2,0,2,6,2,12,2,18,2,
+24,2,30,2,36,2,42,2,48,2,54,2,60,2,66,2,72,2,78,2,84,2,90,2,96,2,102,2,108,
+2,114,2,120,2,126,2,132,2,138,2,144,2,150,2,156,2,162,2,168,2,174,2,180,2,
+186,2,192,2,198,2,204,2,210,2,216,2,222,2,228,2,234,2,240,0,2,1,19,0,17,0,
+2,1,19,0,18,0,2,1,19,0,19,0,2,1,19,0,20,0,2,1,19,0,21,0,2,1,19,0,22,0,2,1,
+19,0,23,0,2,1,19,0,24,0,2,1,19,0,25,0,2,1,19,0,26,0,2,1,19,0,27,0,2,1,19,
+0,28,0,2,1,19,0,29,0,2,1,19,0,30,0,2,1,19,0,31,0,2,1,19,0,32,0,2,1,19,0,33,
+0,2,1,19,0,34,0,2,1,19,0,35,0,2,1,19,0,36,0,2,1,19,0,37,0,2,1,19,0,38,0,2,
+1,19,0,39,0,2,1,19,0,40,0,2,1,19,0,41,0,2,1,19,0,42,0,2,1,19,0,43,0,2,1,19,
+0,44,0,2,1,19,0,45,0,2,1,19,0,46,0,2,1,19,0,47,0,2,1,19,0,48,0,2,1,19,0,49,
+0,2,1,19,0,50,0,2,1,19,0,51,0,2,1,19,0,117,0,2,1,19,0,118,0,2,1,19,0,119,
+0,2,1,19,0,120,0,2,1,19,0,189,0,2,1,19,0,190,0,2,1,19,0,191,0,2,1,19,0,192,
+0,2,1,19,0,193,0,2,1,19,0,194,0,2,1,19,0,195,0,2,1,19,0,196,0,2,1,19,0,197,
+0,2,1,19,0,198,0,2,1,19,0,199,0,2,1,19,0,200,0,2,1,19,0,201,0,2,1,19,0,202,
+0,2,1,19,0,203,0,2,1,19,0,204,0,2,1,19,0,205,0,2,1,19,0,206,0,2,1,19,0,207,
+0,2,1,19,0,208,0,2,1,19,0,209,0,2,1,19,0,210,0,2,1,19,0,211,0,2,1,19,0,212,
+0,2,1,19,0,213,0,2,1,19,0,220,0,2,1,19,0,239,0,2,1,19,0,240,0,2,1,19,0,241,
+0,2,1,19,0,242,0,2,1,19,0,243,0,2,1,19,0,244,0,2,1,19,0,245,0,2,1,19,0,246,
+0,2,1,19,0,247,0,2,1,19,0,248,0,2,1,19,0,249,0,2,1,19,0,254,0,2,1,19,0,255,
+0,2,1,19,1,1,0,2,1,19,1,2,0,2,1,19,1,16,0,2,1,19,1,20,0,2,1,19,1,21,0,2,1,
+19,1,22,0,2,1,19,1,23,0,2,1,19,1,24,0,2,1,19,1,25,0,2,1,19,1,26,0,2,1,19,
+1,27,0,2,1,19,1,28,0,2,1,19,1,29,0,2,1,19,1,30,0,2,1,19,1,31,0,2,1,19,1,32,
+0,2,0,8,0,1,0,8,0,1,15,170,0,94,0,194,0,202,0,210,0,218,0,226,0,234,0,242,
+0,250,1,2,1,10,1,18,1,26,1,34,1,42,1,50,1,58,1,66,1,74,1,82,1,90,1,98,1,106,
+1,114,1,122,1,130,1,138,1,146,1,154,1,162,1,170,1,178,1,186,1,194,1,202,1,
+210,1,218,1,226,1,234,1,242,1,250,2,2,2,10,2,18,2,26,2,34,2,42,2,50,2,58,
+2,66,2,74,2,82,2,90,2,98,2,106,2,114,2,122,2,130,2,138,2,146,2,154,2,162,
+2,170,2,178,2,186,2,194,2,202,2,210,2,218,2,226,2,234,2,242,2,250,3,2,3,10,
+3,18,3,26,3,34,3,42,3,50,3,58,3,66,3,74,3,82,3,90,3,98,3,106,3,114,3,122,
+3,130,3,138,3,146,3,154,3,162,3,170,0,3,1,19,0,5,0,17,0,3,1,19,0,5,0,18,0,
+3,1,19,0,5,0,19,0,3,1,19,0,5,0,20,0,3,1,19,0,5,0,21,0,3,1,19,0,5,0,22,0,3,
+1,19,0,5,0,23,0,3,1,19,0,5,0,24,0,3,1,19,0,5,0,25,0,3,1,19,0,5,0,26,0,3,1,
+19,0,5,0,27,0,3,1,19,0,5,0,28,0,3,1,19,0,5,0,29,0,3,1,19,0,5,0,30,0,3,1,19,
+0,5,0,31,0,3,1,19,0,5,0,32,0,3,1,19,0,5,0,33,0,3,1,19,0,5,0,34,0,3,1,19,0,
+5,0,35,0,3,1,19,0,5,0,36,0,3,1,19,0,5,0,37,0,3,1,19,0,5,0,38,0,3,1,19,0,5,
+0,39,0,3,1,19,0,5,0,40,0,3,1,19,0,5,0,41,0,3,1,19,0,5,0,42,0,3,1,19,0,5,0,
+43,0,3,1,19,0,5,0,44,0,3,1,19,0,5,0,45,0,3,1,19,0,5,0,46,0,3,1,19,0,5,0,47,
+0,3,1,19,0,5,0,48,0,3,1,19,0,5,0,49,0,3,1,19,0,5,0,50,0,3,1,19,0,5,0,51,0,
+3,1,19,0,5,0,117,0,3,1,19,0,5,0,118,0,3,1,19,0,5,0,119,0,3,1,19,0,5,0,120,
+0,3,1,19,0,5,0,189,0,3,1,19,0,5,0,190,0,3,1,19,0,5,0,191,0,3,1,19,0,5,0,192,
+0,3,1,19,0,5,0,193,0,3,1,19,0,5,0,194,0,3,1,19,0,5,0,195,0,3,1,19,0,5,0,196,
+0,3,1,19,0,5,0,197,0,3,1,19,0,5,0,198,0,3,1,19,0,5,0,199,0,3,1,19,0,5,0,200,
+0,3,1,19,0,5,0,201,0,3,1,19,0,5,0,202,0,3,1,19,0,5,0,203,0,3,1,19,0,5,0,204,
+0,3,1,19,0,5,0,205,0,3,1,19,0,5,0,206,0,3,1,19,0,5,0,207,0,3,1,19,0,5,0,208,
+0,3,1,19,0,5,0,209,0,3,1,19,0,5,0,210,0,3,1,19,0,5,0,211,0,3,1,19,0,5,0,212,
+0,3,1,19,0,5,0,213,0,3,1,19,0,5,0,220,0,3,1,19,0,5,0,239,0,3,1,19,0,5,0,240,
+0,3,1,19,0,5,0,241,0,3,1,19,0,5,0,242,0,3,1,19,0,5,0,243,0,3,1,19,0,5,0,244,
+0,3,1,19,0,5,0,245,0,3,1,19,0,5,0,246,0,3,1,19,0,5,0,247,0,3,1,19,0,5,0,248,
+0,3,1,19,0,5,0,249,0,3,1,19,0,5,0,254,0,3,1,19,0,5,0,255,0,3,1,19,0,5,1,1,
+0,3,1,19,0,5,1,2,0,3,1,19,0,5,1,16,0,3,1,19,0,5,1,20,0,3,1,19,0,5,1,21,0,
+3,1,19,0,5,1,22,0,3,1,19,0,5,1,23,0,3,1,19,0,5,1,24,0,3,1,19,0,5,1,25,0,3,
+1,19,0,5,1,26,0,3,1,19,0,5,1,27,0,3,1,19,0,5,1,28,0,3,1,19,0,5,1,29,0,3,1,
+19,0,5,1,30,0,3,1,19,0,5,1,31,0,3,1,19,0,5,1,32,0,2,0,8,0,1,0,8,0,1,11,240,
+0,94,0,194,0,202,0,210,0,218,0,226,0,234,0,242,0,250,1,2,1,10,1,18,1,26,1,
+34,1,42,1,50,1,58,1,66,1,74,1,82,1,90,1,98,1,106,1,114,1,122,1,130,1,138,
+1,146,1,154,1,162,1,170,1,178,1,186,1,194,1,202,1,210,1,218,1,226,1,234,1,
+242,1,250,2,2,2,10,2,18,2,26,2,34,2,42,2,50,2,58,2,66,2,74,2,82,2,90,2,98,
+2,106,2,114,2,122,2,130,2,138,2,146,2,154,2,162,2,170,2,178,2,186,2,194,2,
+202,2,210,2,218,2,226,2,234,2,242,2,250,3,2,3,10,3,18,3,26,3,34,3,42,3,50,
+3,58,3,66,3,74,3,82,3,90,3,98,3,106,3,114,3,122,3,130,3,138,3,146,3,154,3,
+162,3,170,0,3,1,19,0,4,0,17,0,3,1,19,0,4,0,18,0,3,1,19,0,4,0,19,0,3,1,19,
+0,4,0,20,0,3,1,19,0,4,0,21,0,3,1,19,0,4,0,22,0,3,1,19,0,4,0,23,0,3,1,19,0,
+4,0,24,0,3,1,19,0,4,0,25,0,3,1,19,0,4,0,26,0,3,1,19,0,4,0,27,0,3,1,19,0,4,
+0,28,0,3,1,19,0,4,0,29,0,3,1,19,0,4,0,30,0,3,1,19,0,4,0,31,0,3,1,19,0,4,0,
+32,0,3,1,19,0,4,0,33,0,3,1,19,0,4,0,34,0,3,1,19,0,4,0,35,0,3,1,19,0,4,0,36,
+0,3,1,19,0,4,0,37,0,3,1,19,0,4,0,38,0,3,1,19,0,4,0,39,0,3,1,19,0,4,0,40,0,
+3,1,19,0,4,0,41,0,3,1,19,0,4,0,42,0,3,1,19,0,4,0,43,0,3,1,19,0,4,0,44,0,3,
+1,19,0,4,0,45,0,3,1,19,0,4,0,46,0,3,1,19,0,4,0,47,0,3,1,19,0,4,0,48,0,3,1,
+19,0,4,0,49,0,3,1,19,0,4,0,50,0,3,1,19,0,4,0,51,0,3,1,19,0,4,0,117,0,3,1,
+19,0,4,0,118,0,3,1,19,0,4,0,119,0,3,1,19,0,4,0,120,0,3,1,19,0,4,0,189,0,3,
+1,19,0,4,0,190,0,3,1,19,0,4,0,191,0,3,1,19,0,4,0,192,0,3,1,19,0,4,0,193,0,
+3,1,19,0,4,0,194,0,3,1,19,0,4,0,195,0,3,1,19,0,4,0,196,0,3,1,19,0,4,0,197,
+0,3,1,19,0,4,0,198,0,3,1,19,0,4,0,199,0,3,1,19,0,4,0,200,0,3,1,19,0,4,0,201,
+0,3,1,19,0,4,0,202,0,3,1,19,0,4,0,203,0,3,1,19,0,4,0,204,0,3,1,19,0,4,0,205,
+0,3,1,19,0,4,0,206,0,3,1,19,0,4,0,207,0,3,1,19,0,4,0,208,0,3,1,19,0,4,0,209,
+0,3,1,19,0,4,0,210,0,3,1,19,0,4,0,211,0,3,1,19,0,4,0,212,0,3,1,19,0,4,0,213,
+0,3,1,19,0,4,0,220,0,3,1,19,0,4,0,239,0,3,1,19,0,4,0,240,0,3,1,19,0,4,0,241,
+0,3,1,19,0,4,0,242,0,3,1,19,0,4,0,243,0,3,1,19,0,4,0,244,0,3,1,19,0,4,0,245,
+0,3,1,19,0,4,0,246,0,3,1,19,0,4,0,247,0,3,1,19,0,4,0,248,0,3,1,19,0,4,0,249,
+0,3,1,19,0,4,0,254,0,3,1,19,0,4,0,255,0,3,1,19,0,4,1,1,0,3,1,19,0,4,1,2,0,
+3,1,19,0,4,1,16,0,3,1,19,0,4,1,20,0,3,1,19,0,4,1,21,0,3,1,19,0,4,1,22,0,3,
+1,19,0,4,1,23,0,3,1,19,0,4,1,24,0,3,1,19,0,4,1,25,0,3,1,19,0,4,1,26,0,3,1,
+19,0,4,1,27,0,3,1,19,0,4,1,28,0,3,1,19,0,4,1,29,0,3,1,19,0,4,1,30,0,3,1,19,
+0,4,1,31,0,3,1,19,0,4,1,32,0,2,0,8,0,1,0,8,0,1,8,54,0,94,0,194,0,202,0,210,
+0,218,0,226,0,234,0,242,0,250,1,2,1,10,1,18,1,26,1,34,1,42,1,50,1,58,1,66,
+1,74,1,82,1,90,1,98,1,106,1,114,1,122,1,130,1,138,1,146,1,154,1,162,1,170,
+1,178,1,186,1,194,1,202,1,210,1,218,1,226,1,234,1,242,1,250,2,2,2,10,2,18,
+2,26,2,34,2,42,2,50,2,58,2,66,2,74,2,82,2,90,2,98,2,106,2,114,2,122,2,130,
+2,138,2,146,2,154,2,162,2,170,2,178,2,186,2,194,2,202,2,210,2,218,2,226,2,
+234,2,242,2,250,3,2,3,10,3,18,3,26,3,34,3,42,3,50,3,58,3,66,3,74,3,82,3,90,
+3,98,3,106,3,114,3,122,3,130,3,138,3,146,3,154,3,162,3,170,0,3,1,19,1,35,
+0,17,0,3,1,19,1,35,0,18,0,3,1,19,1,35,0,19,0,3,1,19,1,35,0,20,0,3,1,19,1,
+35,0,21,0,3,1,19,1,35,0,22,0,3,1,19,1,35,0,23,0,3,1,19,1,35,0,24,0,3,1,19,
+1,35,0,25,0,3,1,19,1,35,0,26,0,3,1,19,1,35,0,27,0,3,1,19,1,35,0,28,0,3,1,
+19,1,35,0,29,0,3,1,19,1,35,0,30,0,3,1,19,1,35,0,31,0,3,1,19,1,35,0,32,0,3,
+1,19,1,35,0,33,0,3,1,19,1,35,0,34,0,3,1,19,1,35,0,35,0,3,1,19,1,35,0,36,0,
+3,1,19,1,35,0,37,0,3,1,19,1,35,0,38,0,3,1,19,1,35,0,39,0,3,1,19,1,35,0,40,
+0,3,1,19,1,35,0,41,0,3,1,19,1,35,0,42,0,3,1,19,1,35,0,43,0,3,1,19,1,35,0,
+44,0,3,1,19,1,35,0,45,0,3,1,19,1,35,0,46,0,3,1,19,1,35,0,47,0,3,1,19,1,35,
+0,48,0,3,1,19,1,35,0,49,0,3,1,19,1,35,0,50,0,3,1,19,1,35,0,51,0,3,1,19,1,
+35,0,117,0,3,1,19,1,35,0,118,0,3,1,19,1,35,0,119,0,3,1,19,1,35,0,120,0,3,
+1,19,1,35,0,189,0,3,1,19,1,35,0,190,0,3,1,19,1,35,0,191,0,3,1,19,1,35,0,192,
+0,3,1,19,1,35,0,193,0,3,1,19,1,35,0,194,0,3,1,19,1,35,0,195,0,3,1,19,1,35,
+0,196,0,3,1,19,1,35,0,197,0,3,1,19,1,35,0,198,0,3,1,19,1,35,0,199,0,3,1,19,
+1,35,0,200,0,3,1,19,1,35,0,201,0,3,1,19,1,35,0,202,0,3,1,19,1,35,0,203,0,
+3,1,19,1,35,0,204,0,3,1,19,1,35,0,205,0,3,1,19,1,35,0,206,0,3,1,19,1,35,0,
+207,0,3,1,19,1,35,0,208,0,3,1,19,1,35,0,209,0,3,1,19,1,35,0,210,0,3,1,19,
+1,35,0,211,0,3,1,19,1,35,0,212,0,3,1,19,1,35,0,213,0,3,1,19,1,35,0,220,0,
+3,1,19,1,35,0,239,0,3,1,19,1,35,0,240,0,3,1,19,1,35,0,241,0,3,1,19,1,35,0,
+242,0,3,1,19,1,35,0,243,0,3,1,19,1,35,0,244,0,3,1,19,1,35,0,245,0,3,1,19,
+1,35,0,246,0,3,1,19,1,35,0,247,0,3,1,19,1,35,0,248,0,3,1,19,1,35,0,249,0,
+3,1,19,1,35,0,254,0,3,1,19,1,35,0,255,0,3,1,19,1,35,1,1,0,3,1,19,1,35,1,2,
+0,3,1,19,1,35,1,16,0,3,1,19,1,35,1,20,0,3,1,19,1,35,1,21,0,3,1,19,1,35,1,
+22,0,3,1,19,1,35,1,23,0,3,1,19,1,35,1,24,0,3,1,19,1,35,1,25,0,3,1,19,1,35,
+1,26,0,3,1,19,1,35,1,27,0,3,1,19,1,35,1,28,0,3,1,19,1,35,1,29,0,3,1,19,1,
+35,1,30,0,3,1,19,1,35,1,31,0,3,1,19,1,35,1,32,0,2,0,8,0,1,0,8,0,1,4,124,0,
+94,0,194,0,202,0,210,0,218,0,226,0,234,0,242,0,250,1,2,1,10,1,18,1,26,1,34,
+1,42,1,50,1,58,1,66,1,74,1,82,1,90,1,98,1,106,1,114,1,122,1,130,1,138,1,146,
+1,154,1,162,1,170,1,178,1,186,1,194,1,202,1,210,1,218,1,226,1,234,1,242,1,
+250,2,2,2,10,2,18,2,26,2,34,2,42,2,50,2,58,2,66,2,74,2,82,2,90,2,98,2,106,
+2,114,2,122,2,130,2,138,2,146,2,154,2,162,2,170,2,178,2,186,2,194,2,202,2,
+210,2,218,2,226,2,234,2,242,2,250,3,2,3,10,3,18,3,26,3,34,3,42,3,50,3,58,
+3,66,3,74,3,82,3,90,3,98,3,106,3,114,3,122,3,130,3,138,3,146,3,154,3,162,
+3,170,0,3,1,19,1,36,0,17,0,3,1,19,1,36,0,18,0,3,1,19,1,36,0,19,0,3,1,19,1,
+36,0,20,0,3,1,19,1,36,0,21,0,3,1,19,1,36,0,22,0,3,1,19,1,36,0,23,0,3,1,19,
+1,36,0,24,0,3,1,19,1,36,0,25,0,3,1,19,1,36,0,26,0,3,1,19,1,36,0,27,0,3,1,
+19,1,36,0,28,0,3,1,19,1,36,0,29,0,3,1,19,1,36,0,30,0,3,1,19,1,36,0,31,0,3,
+1,19,1,36,0,32,0,3,1,19,1,36,0,33,0,3,1,19,1,36,0,34,0,3,1,19,1,36,0,35,0,
+3,1,19,1,36,0,36,0,3,1,19,1,36,0,37,0,3,1,19,1,36,0,38,0,3,1,19,1,36,0,39,
+0,3,1,19,1,36,0,40,0,3,1,19,1,36,0,41,0,3,1,19,1,36,0,42,0,3,1,19,1,36,0,
+43,0,3,1,19,1,36,0,44,0,3,1,19,1,36,0,45,0,3,1,19,1,36,0,46,0,3,1,19,1,36,
+0,47,0,3,1,19,1,36,0,48,0,3,1,19,1,36,0,49,0,3,1,19,1,36,0,50,0,3,1,19,1,
+36,0,51,0,3,1,19,1,36,0,117,0,3,1,19,1,36,0,118,0,3,1,19,1,36,0,119,0,3,1,
+19,1,36,0,120,0,3,1,19,1,36,0,189,0,3,1,19,1,36,0,190,0,3,1,19,1,36,0,191,
+0,3,1,19,1,36,0,192,0,3,1,19,1,36,0,193,0,3,1,19,1,36,0,194,0,3,1,19,1,36,
+0,195,0,3,1,19,1,36,0,196,0,3,1,19,1,36,0,197,0,3,1,19,1,36,0,198,0,3,1,19,
+1,36,0,199,0,3,1,19,1,36,0,200,0,3,1,19,1,36,0,201,0,3,1,19,1,36,0,202,0,
+3,1,19,1,36,0,203,0,3,1,19,1,36,0,204,0,3,1,19,1,36,0,205,0,3,1,19,1,36,0,
+206,0,3,1,19,1,36,0,207,0,3,1,19,1,36,0,208,0,3,1,19,1,36,0,209,0,3,1,19,
+1,36,0,210,0,3,1,19,1,36,0,211,0,3,1,19,1,36,0,212,0,3,1,19,1,36,0,213,0,
+3,1,19,1,36,0,220,0,3,1,19,1,36,0,239,0,3,1,19,1,36,0,240,0,3,1,19,1,36,0,
+241,0,3,1,19,1,36,0,242,0,3,1,19,1,36,0,243,0,3,1,19,1,36,0,244,0,3,1,19,
+1,36,0,245,0,3,1,19,1,36,0,246,0,3,1,19,1,36,0,247,0,3,1,19,1,36,0,248,0,
+3,1,19,1,36,0,249,0,3,1,19,1,36,0,254,0,3,1,19,1,36,0,255,0,3,1,19,1,36,1,
+1,0,3,1,19,1,36,1,2,0,3,1,19,1,36,1,16,0,3,1,19,1,36,1,20,0,3,1,19,1,36,1,
+21,0,3,1,19,1,36,1,22,0,3,1,19,1,36,1,23,0,3,1,19,1,36,1,24,0,3,1,19,1,36,
+1,25,0,3,1,19,1,36,1,26,0,3,1,19,1,36,1,27,0,3,1,19,1,36,1,28,0,3,1,19,1,
+36,1,29,0,3,1,19,1,36,1,30,0,3,1,19,1,36,1,31,0,3,1,19,1,36,1,32,0,2,0,8,
+0,1,0,8,0,1,0,194,0,94,0,252,1,4,1,12,1,20,1,28,1,36,1,44,1,52,1,60,1,68,
+1,76,1,84,1,92,1,100,1,108,1,116,1,124,1,132,1,140,1,148,1,156,1,164,1,172,
+1,180,1,188,1,196,1,204,1,212,1,220,1,228,1,236,1,244,1,252,2,4,2,12,2,20,
+2,28,2,36,2,44,2,52,2,60,2,68,2,76,2,84,2,92,2,100,2,108,2,116,2,124,2,132,
+2,140,2,148,2,156,2,164,2,172,2,180,2,188,2,196,2,204,2,212,2,220,2,228,2,
+236,2,244,2,252,3,4,3,12,3,20,3,28,3,36,3,44,3,52,3,60,3,68,3,76,3,84,3,92,
+3,100,3,108,3,116,3,124,3,132,3,140,3,148,3,156,3,164,3,172,3,180,3,188,3,
+196,3,204,3,212,3,220,3,228,0,2,0,9,0,17,0,51,0,0,0,117,0,120,0,35,0,189,
+0,213,0,39,0,220,0,220,0,64,0,239,0,249,0,65,0,254,0,255,0,76,1,1,1,2,0,78,
+1,16,1,16,0,80,1,20,1,32,0,81,0,3,1,19,1,34,0,17,0,3,1,19,1,34,0,18,0,3,1,
+19,1,34,0,19,0,3,1,19,1,34,0,20,0,3,1,19,1,34,0,21,0,3,1,19,1,34,0,22,0,3,
+1,19,1,34,0,23,0,3,1,19,1,34,0,24,0,3,1,19,1,34,0,25,0,3,1,19,1,34,0,26,0,
+3,1,19,1,34,0,27,0,3,1,19,1,34,0,28,0,3,1,19,1,34,0,29,0,3,1,19,1,34,0,30,
+0,3,1,19,1,34,0,31,0,3,1,19,1,34,0,32,0,3,1,19,1,34,0,33,0,3,1,19,1,34,0,
+34,0,3,1,19,1,34,0,35,0,3,1,19,1,34,0,36,0,3,1,19,1,34,0,37,0,3,1,19,1,34,
+0,38,0,3,1,19,1,34,0,39,0,3,1,19,1,34,0,40,0,3,1,19,1,34,0,41,0,3,1,19,1,
+34,0,42,0,3,1,19,1,34,0,43,0,3,1,19,1,34,0,44,0,3,1,19,1,34,0,45,0,3,1,19,
+1,34,0,46,0,3,1,19,1,34,0,47,0,3,1,19,1,34,0,48,0,3,1,19,1,34,0,49,0,3,1,
+19,1,34,0,50,0,3,1,19,1,34,0,51,0,3,1,19,1,34,0,117,0,3,1,19,1,34,0,118,0,
+3,1,19,1,34,0,119,0,3,1,19,1,34,0,120,0,3,1,19,1,34,0,189,0,3,1,19,1,34,0,
+190,0,3,1,19,1,34,0,191,0,3,1,19,1,34,0,192,0,3,1,19,1,34,0,193,0,3,1,19,
+1,34,0,194,0,3,1,19,1,34,0,195,0,3,1,19,1,34,0,196,0,3,1,19,1,34,0,197,0,
+3,1,19,1,34,0,198,0,3,1,19,1,34,0,199,0,3,1,19,1,34,0,200,0,3,1,19,1,34,0,
+201,0,3,1,19,1,34,0,202,0,3,1,19,1,34,0,203,0,3,1,19,1,34,0,204,0,3,1,19,
+1,34,0,205,0,3,1,19,1,34,0,206,0,3,1,19,1,34,0,207,0,3,1,19,1,34,0,208,0,
+3,1,19,1,34,0,209,0,3,1,19,1,34,0,210,0,3,1,19,1,34,0,211,0,3,1,19,1,34,0,
+212,0,3,1,19,1,34,0,213,0,3,1,19,1,34,0,220,0,3,1,19,1,34,0,239,0,3,1,19,
+1,34,0,240,0,3,1,19,1,34,0,241,0,3,1,19,1,34,0,242,0,3,1,19,1,34,0,243,0,
+3,1,19,1,34,0,244,0,3,1,19,1,34,0,245,0,3,1,19,1,34,0,246,0,3,1,19,1,34,0,
+247,0,3,1,19,1,34,0,248,0,3,1,19,1,34,0,249,0,3,1,19,1,34,0,254,0,3,1,19,
+1,34,0,255,0,3,1,19,1,34,1,1,0,3,1,19,1,34,1,2,0,3,1,19,1,34,1,16,0,3,1,19,
+1,34,1,20,0,3,1,19,1,34,1,21,0,3,1,19,1,34,1,22,0,3,1,19,1,34,1,23,0,3,1,
+19,1,34,1,24,0,3,1,19,1,34,1,25,0,3,1,19,1,34,1,26,0,3,1,19,1,34,1,27,0,3,
+1,19,1,34,1,28,0,3,1,19,1,34,1,29,0,3,1,19,1,34,1,30,0,3,1,19,1,34,1,31,0,
+3,1,19,1,34,1,32,0,1,0,0,0,1,0,8,0,1,0,188,255,65,0,1,0,0,0,1,0,8,0,1,0,174,
+255,197,0,1,0,0,0,1,0,8,0,1,0,160,255,214,0,1,0,0,0,1,0,8,0,1,0,146,255,213,
+0,1,0,0,0,1,0,8,0,1,0,132,255,203,0,1,0,0,0,1,0,8,0,1,0,118,255,202,0,1,0,
+0,0,1,0,8,0,1,0,104,255,204,0,1,0,0,0,1,0,8,0,1,0,90,255,212,0,1,0,0,0,1,
+0,8,0,1,0,76,255,198,0,1,0,0,0,1,0,8,0,1,0,62,255,205,0,1,0,0,0,1,0,8,0,1,
+0,48,255,200,0,1,0,0,0,1,0,8,0,1,0,34,255,199,0,1,0,0,0,1,0,8,0,1,0,20,255,
+206,0,1,0,0,0,1,0,8,0,1,0,6,0,14,0,1,0,1,1,19,};
+#endif
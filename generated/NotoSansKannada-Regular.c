@@ -0,0 +1,3485 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansKannada_Regular_ttf_size = 83868;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansKannada_Regular_ttf");
+asm(".type fz_font_NotoSansKannada_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansKannada_Regular_ttf, 83868");
+asm(".balign 64");
+asm("fz_font_NotoSansKannada_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansKannada-Regular.ttf\"");
+#else
+const int fz_font_NotoSansKannada_Regular_ttf_size = 83868;
+const char fz_font_NotoSansKannada_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,17,200,18,184,0,1,32,112,0,0,0,194,
+71,80,79,83,165,185,247,118,0,1,33,52,0,0,16,100,71,83,85,66,121,96,103,230,
+0,1,49,152,0,0,22,2,79,83,47,50,122,7,102,252,0,0,1,104,0,0,0,96,99,109,97,
+112,251,194,239,120,0,0,8,212,0,0,1,68,103,97,115,112,0,7,0,7,0,1,32,100,
+0,0,0,12,103,108,121,102,218,231,232,59,0,0,13,160,0,1,12,156,104,101,97,
+100,8,74,1,39,0,0,0,236,0,0,0,54,104,104,101,97,16,108,9,225,0,0,1,36,0,0,
+0,36,104,109,116,120,167,58,78,243,0,0,1,200,0,0,7,12,108,111,99,97,252,250,
+64,192,0,0,10,24,0,0,3,136,109,97,120,112,1,218,1,98,0,0,1,72,0,0,0,32,110,
+97,109,101,140,231,185,36,0,1,26,60,0,0,6,6,112,111,115,116,255,105,0,102,
+0,1,32,68,0,0,0,32,0,1,0,0,0,1,10,61,206,225,6,226,95,15,60,245,0,11,8,0,
+0,0,0,0,205,17,227,195,0,0,0,0,210,40,203,240,252,82,251,193,13,159,6,120,
+0,0,0,9,0,1,0,0,0,0,0,0,0,1,0,0,6,120,251,175,0,0,13,178,252,82,254,188,13,
+159,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,195,0,1,0,0,1,195,0,160,0,10,0,192,
+0,10,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,4,247,1,144,0,5,0,0,5,154,5,
+51,0,0,1,124,5,154,5,51,0,0,2,138,0,102,2,58,0,0,2,11,5,2,4,5,4,2,2,4,0,64,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,6,120,251,175,0,
+0,6,120,4,81,0,0,0,1,0,0,0,0,4,106,5,134,0,0,0,32,0,3,4,205,0,193,0,0,0,0,
+2,78,0,0,2,78,0,0,4,103,0,75,2,113,0,67,6,231,0,75,6,181,0,75,5,177,0,56,
+8,20,0,40,9,198,0,75,12,197,0,75,9,136,0,56,6,198,0,56,6,76,0,59,6,76,0,59,
+6,117,0,70,6,54,0,56,6,54,0,56,6,60,0,59,4,152,0,73,6,205,0,52,5,47,0,96,
+7,248,0,63,6,54,0,56,6,95,0,56,6,191,0,85,6,54,0,56,11,8,0,85,7,190,0,56,
+6,133,0,82,5,54,0,85,6,37,0,85,6,37,0,85,6,233,0,63,4,251,0,70,6,30,0,85,
+6,30,0,85,6,30,0,85,5,176,0,63,6,85,0,63,6,85,0,63,6,105,0,56,6,115,0,56,
+9,63,0,63,10,172,0,77,5,54,0,85,7,29,0,82,6,18,0,75,5,178,0,66,6,90,0,63,
+5,11,0,63,6,105,0,63,5,172,0,63,6,105,0,68,0,0,252,153,3,134,0,33,3,151,254,
+136,2,157,255,49,5,217,255,49,2,233,255,12,5,246,255,5,0,245,253,121,3,244,
+253,121,2,200,255,35,6,44,255,35,3,133,255,35,7,217,255,35,11,42,255,35,3,
+112,253,217,2,128,254,176,3,75,0,75,1,119,253,146,6,239,0,84,12,142,0,56,
+10,75,0,56,0,150,253,56,0,140,253,56,5,128,0,110,5,128,0,110,5,128,0,62,5,
+128,0,125,5,128,0,77,5,128,0,60,5,128,0,127,5,128,0,129,5,128,0,105,5,128,
+0,156,4,105,0,33,6,3,0,67,0,0,0,0,0,0,255,171,0,0,254,213,4,160,0,145,4,137,
+0,66,6,54,0,56,6,85,0,63,1,102,254,240,0,245,253,24,0,40,253,170,1,251,252,
+163,0,165,253,35,1,22,253,15,0,245,252,254,0,165,253,35,1,108,252,82,1,51,
+252,114,1,21,252,239,0,48,253,163,0,146,253,71,0,146,253,71,0,231,253,13,
+0,133,252,109,0,130,253,81,0,130,253,81,0,130,253,81,0,215,253,121,0,245,
+252,249,0,245,252,249,0,245,253,29,0,245,253,29,1,255,255,101,2,20,254,97,
+1,19,253,5,0,252,252,240,0,130,253,17,0,255,253,149,1,6,252,229,1,158,255,
+14,0,203,252,255,0,245,253,23,0,185,253,33,0,252,253,8,4,152,0,73,6,225,0,
+52,5,47,0,96,7,248,0,63,6,92,0,56,6,191,0,85,6,54,0,56,11,8,0,85,6,133,0,
+82,5,54,0,85,6,37,0,85,6,37,0,85,6,239,0,69,4,251,0,70,6,30,0,85,6,30,0,85,
+6,30,0,85,5,176,0,63,6,85,0,63,6,85,0,63,6,115,0,56,6,115,0,56,9,63,0,63,
+10,172,0,77,5,54,0,85,6,38,0,75,5,178,0,66,6,90,0,63,5,11,0,63,6,105,0,63,
+5,172,0,63,6,105,0,68,6,54,0,56,6,85,0,63,7,24,0,73,9,97,0,52,7,175,0,96,
+10,210,0,63,11,124,0,56,8,233,0,56,9,63,0,85,8,182,0,56,13,136,0,85,13,97,
+0,56,9,6,0,82,7,182,0,85,8,135,0,85,8,135,0,85,9,112,0,69,7,123,0,70,8,158,
+0,85,8,158,0,85,8,158,0,85,8,48,0,63,8,213,0,63,8,213,0,63,8,243,0,56,8,243,
+0,56,11,201,0,63,13,68,0,77,7,182,0,85,9,184,0,82,8,186,0,75,8,96,0,66,8,
+218,0,63,7,143,0,63,8,233,0,63,8,44,0,63,8,158,0,68,9,132,0,82,8,182,0,56,
+8,213,0,63,4,152,0,73,7,54,0,52,5,47,0,103,7,244,0,59,6,92,0,56,6,225,0,85,
+6,54,0,56,11,8,0,85,6,133,0,82,5,54,0,85,6,37,0,85,6,37,0,85,6,233,0,63,4,
+245,0,60,6,30,0,85,6,30,0,85,6,30,0,85,5,244,0,63,6,76,0,59,6,76,0,59,6,149,
+0,56,6,149,0,56,9,111,0,59,10,172,0,77,5,54,0,85,6,92,0,72,5,199,0,66,6,139,
+0,59,5,15,0,63,6,96,0,59,5,167,0,63,6,95,0,63,6,54,0,56,6,81,0,59,4,152,0,
+73,6,236,0,53,5,47,0,96,7,249,0,63,6,92,0,56,6,191,0,85,6,54,0,56,11,8,0,
+85,6,133,0,82,5,54,0,85,6,37,0,85,6,37,0,85,6,239,0,69,4,251,0,70,6,30,0,
+85,6,30,0,85,6,30,0,85,5,176,0,63,6,85,0,63,6,85,0,63,6,115,0,56,6,115,0,
+56,9,63,0,63,10,172,0,77,5,54,0,85,6,38,0,75,5,178,0,66,6,90,0,63,5,11,0,
+63,6,105,0,63,5,172,0,63,6,105,0,68,6,54,0,56,6,85,0,63,5,179,255,35,2,4,
+253,46,5,36,253,46,2,4,253,106,5,36,253,106,2,254,254,151,5,246,254,151,12,
+80,0,63,13,178,0,77,4,152,0,73,4,152,0,73,7,24,0,73,4,152,0,73,4,152,0,73,
+6,54,0,56,6,54,0,56,8,182,0,56,6,54,0,56,6,54,0,56,2,136,254,240,1,124,253,
+170,1,253,252,239,1,203,253,71,1,170,252,109,1,188,253,81,2,34,252,249,2,
+60,253,29,2,180,252,109,6,10,255,101,2,68,252,109,5,68,255,101,2,154,252,
+109,5,222,255,101,3,210,253,5,2,47,0,20,3,128,255,246,2,45,255,236,5,25,0,
+20,3,80,0,20,3,160,0,20,3,216,0,20,3,80,0,20,5,125,0,20,4,113,0,20,3,202,
+0,0,2,91,0,20,3,5,0,0,3,45,0,40,3,168,0,20,1,147,253,213,3,19,0,40,2,235,
+0,0,3,19,0,40,3,30,0,20,3,115,255,206,3,235,0,30,3,173,0,20,3,243,0,40,2,
+48,0,4,3,182,0,20,0,226,253,104,3,198,0,0,3,23,255,236,3,91,0,30,3,161,255,
+206,2,94,0,20,3,184,0,20,3,72,255,193,3,41,255,226,3,184,0,10,3,112,0,20,
+6,120,0,20,3,209,0,20,3,127,0,40,3,144,0,40,3,192,0,40,4,14,0,60,5,64,0,50,
+4,182,0,50,3,18,254,27,4,157,0,50,5,91,0,50,5,71,0,40,5,210,253,213,6,239,
+0,20,4,248,253,213,6,152,0,20,5,114,253,213,7,18,0,20,4,237,253,95,1,108,
+254,246,1,194,253,252,0,40,253,231,2,15,252,246,1,122,254,62,2,6,254,62,2,
+88,254,118,1,122,254,62,3,111,254,6,2,74,253,237,2,11,254,28,0,78,254,7,0,
+230,253,225,1,56,254,51,1,178,254,30,0,233,252,229,1,30,254,51,0,204,253,
+225,1,30,254,51,1,78,254,18,1,39,253,50,1,39,253,50,1,255,254,62,2,149,254,
+182,1,96,255,23,1,224,254,63,1,19,253,5,1,226,254,28,1,63,254,0,1,200,254,
+119,1,31,253,42,1,80,255,7,0,214,253,50,1,11,253,62,1,108,254,37,1,202,254,
+28,2,39,0,147,3,68,0,133,5,43,0,51,6,166,0,100,1,205,0,133,3,16,0,100,3,16,
+0,133,4,104,0,84,4,147,0,102,2,57,0,104,2,147,0,82,2,37,0,147,4,39,0,151,
+4,147,0,100,4,147,0,182,4,147,0,98,4,147,0,92,4,147,0,43,4,147,0,129,4,147,
+0,113,4,147,0,90,4,147,0,100,4,147,0,102,2,37,0,147,2,74,0,104,4,147,0,102,
+4,147,0,115,4,147,0,102,3,171,0,65,3,16,0,164,4,39,0,151,3,16,0,161,4,147,
+0,78,3,141,255,252,3,16,0,57,4,104,1,233,3,15,0,71,4,147,0,102,2,147,0,82,
+4,0,0,82,8,0,0,82,1,192,0,65,1,192,0,65,3,47,0,65,3,47,0,65,6,84,0,147,4,
+147,0,131,4,147,0,102,4,147,0,102,4,147,0,162,3,8,1,142,4,202,1,142,0,0,0,
+1,0,3,0,1,0,0,0,12,0,4,1,56,0,0,0,72,0,64,0,5,0,8,0,0,0,13,0,35,0,37,0,63,
+0,95,0,126,0,160,0,173,0,215,0,247,9,101,12,131,12,140,12,144,12,168,12,179,
+12,185,12,196,12,200,12,205,12,214,12,222,12,227,12,239,12,242,32,13,32,20,
+32,25,32,29,32,38,32,185,34,18,37,204,254,255,255,255,0,0,0,0,0,13,0,32,0,
+37,0,39,0,91,0,123,0,160,0,173,0,215,0,247,9,100,12,130,12,133,12,142,12,
+146,12,170,12,181,12,188,12,198,12,202,12,213,12,222,12,224,12,230,12,241,
+32,11,32,19,32,24,32,28,32,38,32,185,34,18,37,204,254,255,255,255,0,1,255,
+245,0,0,1,109,1,108,1,81,1,54,255,99,1,8,0,230,0,199,248,93,243,130,243,129,
+243,128,243,127,243,126,243,125,243,123,243,122,243,121,243,114,243,107,243,
+106,243,104,243,103,224,79,225,163,225,160,225,158,225,150,225,7,223,173,
+218,145,1,91,0,1,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,3,1,143,1,144,1,145,0,0,0,21,0,21,0,21,0,21,0,66,0,139,0,
+224,1,65,1,161,2,38,2,153,3,59,3,222,4,53,4,137,4,228,5,71,5,160,6,13,6,166,
+6,248,7,98,7,160,8,44,8,171,9,47,9,160,10,15,10,142,11,7,11,128,11,210,12,
+72,12,198,13,49,13,145,13,254,14,82,14,174,15,4,15,113,15,230,16,67,16,184,
+17,48,17,167,17,233,18,92,18,161,19,22,19,116,19,213,20,84,20,190,21,41,21,
+82,21,139,21,194,22,2,22,108,22,142,22,226,23,36,23,142,23,216,24,76,24,88,
+24,240,25,179,25,254,26,52,26,100,26,179,27,33,27,247,28,123,28,198,29,37,
+29,90,29,143,29,198,30,33,30,130,30,251,31,78,31,143,31,229,32,50,32,108,
+32,185,32,185,32,207,32,246,33,81,33,139,33,151,34,47,34,108,34,193,34,227,
+35,80,35,190,36,31,36,115,36,209,37,52,37,163,37,254,38,52,38,130,38,216,
+39,60,39,107,39,180,39,231,40,33,40,110,40,188,41,17,41,100,41,190,42,17,
+42,115,42,156,42,252,43,62,43,156,43,244,44,75,44,162,44,229,45,44,45,137,
+45,200,46,51,46,94,46,211,47,69,47,164,48,18,48,153,49,14,49,77,49,177,50,
+30,50,138,50,216,51,51,51,118,51,193,52,6,52,97,52,196,53,33,53,134,54,3,
+54,130,54,177,54,246,55,88,55,163,55,240,56,93,56,179,57,10,57,22,57,155,
+58,6,58,154,58,239,59,145,60,78,60,232,61,112,62,8,62,184,63,116,64,18,64,
+124,65,9,65,158,66,51,66,170,67,44,67,150,68,9,68,117,68,248,69,131,70,8,
+70,150,71,60,71,228,72,61,72,219,73,73,73,213,74,72,74,191,75,84,75,211,76,
+81,76,233,77,164,78,81,78,170,79,50,79,123,80,20,80,159,81,29,81,164,82,43,
+82,184,83,18,83,148,84,30,84,176,85,34,85,151,85,243,86,87,86,188,87,51,87,
+178,88,45,88,176,89,54,89,186,90,4,90,104,90,231,91,81,91,196,92,74,92,192,
+93,59,93,71,93,233,94,71,94,210,95,30,95,183,96,72,96,200,97,88,97,232,98,
+125,98,221,99,97,99,238,100,123,100,234,101,100,101,198,102,49,102,149,103,
+16,103,148,104,18,104,152,105,31,105,168,105,248,106,95,106,231,107,82,107,
+193,108,79,108,198,109,61,109,73,109,238,110,63,110,118,110,218,111,18,111,
+118,111,163,111,254,112,181,113,110,113,122,113,134,113,146,113,158,113,170,
+113,182,113,194,113,206,113,218,113,230,113,242,113,254,114,10,114,22,114,
+100,114,112,114,216,115,83,115,191,116,106,116,181,117,66,117,155,118,50,
+118,165,118,174,118,183,118,192,118,201,118,210,118,219,118,228,118,237,118,
+246,118,255,119,8,119,17,119,26,119,35,119,44,119,86,119,95,119,104,119,113,
+119,122,119,197,119,206,119,215,119,224,120,48,120,142,120,181,120,190,120,
+199,120,208,120,217,120,226,120,235,121,43,121,111,121,120,121,187,121,196,
+122,23,122,32,122,41,122,54,122,67,122,80,122,93,122,164,122,177,123,25,123,
+148,123,160,123,172,123,184,123,196,123,208,123,220,123,232,123,240,123,249,
+124,2,124,11,124,20,124,29,124,38,124,47,124,56,124,173,124,182,124,191,124,
+200,124,209,124,218,124,226,124,235,124,244,124,253,125,6,125,15,125,24,125,
+33,125,42,125,51,125,60,125,105,125,114,125,186,126,31,126,40,126,133,126,
+221,126,230,126,239,126,248,127,22,127,50,127,110,127,187,127,208,127,245,
+128,26,128,67,128,97,128,121,128,140,128,162,128,184,128,230,129,0,129,45,
+129,105,129,145,129,191,129,252,130,15,130,88,130,148,130,190,130,235,131,
+12,131,41,131,74,131,132,131,158,131,180,131,205,131,229,131,246,132,39,132,
+58,132,110,132,158,132,166,132,185,132,204,132,228,132,253,133,35,133,72,
+133,125,133,170,133,219,133,238,134,32,134,52,134,78,0,2,0,193,0,0,4,10,5,
+182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,
+5,182,250,74,104,4,230,0,0,3,0,75,255,232,4,28,4,106,0,11,0,23,0,24,0,0,1,
+50,18,21,20,0,35,34,0,53,52,0,19,50,54,53,52,38,35,34,6,21,20,22,19,2,53,
+232,255,254,244,228,222,254,253,1,9,219,156,170,169,148,157,169,169,145,4,
+1,254,231,245,237,254,226,1,22,244,239,1,32,252,129,195,173,173,201,195,174,
+173,200,3,232,0,5,0,67,255,230,2,46,4,106,0,11,0,23,0,35,0,47,0,48,0,0,1,
+50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,23,50,
+22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,19,1,56,109,
+137,137,109,109,136,138,107,53,62,62,53,52,61,61,52,109,137,137,109,109,136,
+138,107,53,62,62,53,52,61,61,46,4,1,136,104,104,134,134,104,104,136,254,161,
+61,52,49,62,62,49,53,60,222,136,104,104,134,134,104,104,136,254,161,61,52,
+49,62,62,49,53,60,4,5,0,2,0,75,255,232,6,156,4,130,0,43,0,54,0,0,1,21,33,
+53,33,38,53,52,54,51,50,18,21,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,
+39,22,0,33,32,0,17,52,38,35,34,6,21,20,22,37,22,51,50,54,53,52,38,35,34,6,
+5,111,253,141,1,110,120,157,132,179,214,254,98,254,101,254,137,254,95,234,
+187,134,159,190,164,107,89,10,1,70,1,31,1,84,1,66,118,105,56,76,117,251,244,
+77,95,101,106,73,61,96,127,2,127,146,156,99,148,110,148,254,248,214,254,163,
+254,161,1,100,1,48,238,1,24,150,125,141,168,50,222,255,0,1,1,1,16,150,180,
+75,67,71,116,101,59,83,75,65,73,123,0,0,3,0,75,255,232,6,125,4,130,0,41,0,
+54,0,65,0,0,19,22,4,33,32,36,53,52,39,6,35,33,53,33,38,53,52,54,51,50,22,
+21,20,7,22,21,20,4,33,32,0,17,52,18,51,50,22,21,20,6,35,34,37,54,54,53,52,
+38,35,34,6,21,20,22,23,37,22,51,50,54,53,52,38,35,34,6,236,9,1,85,1,43,1,
+14,1,37,55,95,169,254,97,1,210,171,175,141,158,178,135,88,254,140,254,159,
+254,123,254,87,234,187,134,159,190,164,107,4,28,55,60,92,79,71,82,89,111,
+251,157,75,99,101,106,73,61,94,129,2,110,227,253,149,124,73,42,37,156,93,
+162,113,137,163,128,148,108,80,126,191,234,1,97,1,51,238,1,24,150,125,141,
+168,116,34,91,51,67,83,69,58,59,87,48,84,61,83,75,65,73,121,0,2,0,56,255,
+143,5,102,4,130,0,55,0,66,0,0,19,38,53,52,54,51,50,22,23,54,54,51,50,18,21,
+20,7,6,6,7,22,23,7,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,54,53,52,38,
+35,34,6,7,35,38,38,35,34,6,21,20,22,23,1,38,38,35,34,6,21,20,51,50,54,103,
+47,179,136,108,147,59,49,155,112,172,209,41,20,56,35,73,36,170,23,44,93,221,
+129,189,203,201,179,150,245,95,38,39,115,114,86,117,17,161,15,119,88,75,83,
+19,15,3,4,72,191,119,104,112,238,110,180,2,141,91,113,130,167,87,97,88,96,
+254,244,238,119,115,58,99,41,124,172,33,119,102,66,66,165,145,136,155,114,
+114,62,149,86,173,173,126,112,114,124,77,70,34,80,29,254,43,97,98,75,65,158,
+51,0,5,0,40,255,232,7,238,6,120,0,59,0,68,0,80,0,87,0,88,0,0,1,22,22,23,51,
+38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,7,39,54,54,53,52,38,39,6,
+35,35,6,0,35,34,0,39,35,53,51,54,54,55,35,53,33,50,54,54,53,52,39,55,22,22,
+21,20,6,1,33,38,38,39,38,35,34,6,5,54,54,53,52,38,35,34,6,21,20,22,5,33,22,
+22,51,50,54,1,4,57,92,110,18,245,40,39,148,132,130,153,101,100,80,65,164,
+152,16,83,87,64,75,60,89,215,10,254,195,253,253,254,192,10,106,115,18,105,
+87,219,2,219,106,108,53,133,133,84,82,119,252,149,3,55,16,71,54,109,157,162,
+222,5,84,81,82,70,58,59,69,46,253,247,252,192,17,222,179,174,220,254,23,3,
+217,64,173,110,51,100,49,103,133,145,116,104,139,35,85,132,76,110,124,8,159,
+3,60,50,59,97,73,7,239,254,233,1,19,243,144,107,166,60,159,22,63,53,131,130,
+89,94,170,100,100,145,254,141,78,123,44,88,175,149,16,80,63,60,69,63,53,41,
+86,198,169,187,187,5,51,0,3,0,75,255,232,9,123,4,134,0,67,0,78,0,79,0,0,1,
+52,38,38,35,34,6,21,20,23,22,21,20,4,35,32,0,17,52,54,54,51,50,22,21,20,6,
+35,34,39,22,22,51,32,17,52,39,38,53,52,54,51,50,22,22,21,21,20,22,22,51,50,
+54,53,52,2,39,55,22,18,21,20,2,35,34,38,38,53,1,22,51,50,54,53,52,38,35,34,
+6,37,6,11,32,94,82,109,109,11,11,254,251,226,254,241,254,202,111,192,118,
+134,159,190,164,110,90,5,216,195,1,69,11,11,207,185,116,162,90,65,114,78,
+140,148,155,173,119,202,175,245,211,135,184,105,250,236,77,98,101,106,73,
+61,96,129,6,241,2,167,117,130,67,117,116,74,100,99,58,211,242,1,101,1,48,
+160,236,121,150,125,141,168,53,230,255,1,49,60,112,111,56,176,196,90,167,
+175,252,145,129,58,166,154,173,1,8,123,140,164,254,188,215,220,254,253,97,
+193,163,1,91,62,83,75,65,73,121,110,0,2,0,75,255,232,12,122,4,130,0,110,0,
+121,0,0,19,22,22,51,50,54,53,52,39,38,53,52,54,51,50,22,22,21,17,20,22,22,
+51,50,54,53,52,39,38,53,52,54,54,51,50,4,18,21,20,2,35,34,38,53,52,54,51,
+50,22,21,20,6,35,34,38,39,6,21,20,22,51,50,54,53,52,2,35,34,6,21,20,23,22,
+21,20,6,35,34,38,38,53,17,52,38,38,35,34,6,21,20,23,22,21,20,6,6,35,32,0,
+17,52,54,54,51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,38,35,34,6,235,5,
+216,195,162,163,11,11,204,181,106,166,84,36,90,77,102,102,9,9,131,236,147,
+184,1,14,142,230,204,161,190,128,99,75,86,65,48,49,62,6,10,105,99,123,141,
+225,198,169,182,8,8,197,185,105,169,83,35,91,77,97,107,11,11,120,226,141,
+254,241,254,202,111,192,118,134,159,190,164,110,78,77,98,101,106,73,61,96,
+129,2,111,230,255,152,153,53,118,117,65,164,194,97,169,176,254,238,118,122,
+60,126,126,49,95,94,42,145,222,117,164,254,205,196,239,254,240,183,144,124,
+146,74,65,58,71,45,42,28,46,87,105,188,169,228,1,27,183,167,32,89,90,65,189,
+203,98,170,174,1,18,118,121,62,118,101,95,94,93,63,144,204,105,1,101,1,48,
+160,236,121,150,125,141,168,206,62,83,75,65,73,121,0,0,4,0,56,255,232,9,61,
+6,120,0,90,0,103,0,116,0,117,0,0,37,6,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,21,20,7,54,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,
+18,21,20,7,22,22,51,50,54,53,52,2,39,35,53,51,50,54,54,53,52,39,55,22,22,
+21,20,6,7,4,17,20,7,22,22,51,50,54,53,52,2,39,55,22,18,21,20,6,35,34,38,1,
+38,35,34,6,21,20,22,51,50,54,53,52,3,54,53,52,38,35,34,6,21,20,22,51,50,1,
+6,2,56,178,123,110,200,89,67,199,133,143,176,163,129,119,142,12,61,63,65,
+61,6,150,124,120,159,176,143,157,236,127,39,77,158,92,123,139,213,190,110,
+230,106,108,53,133,133,84,82,139,133,1,34,13,80,161,98,121,137,201,201,88,
+235,247,229,204,109,197,251,102,38,43,72,83,67,61,68,73,33,41,71,60,68,70,
+83,72,40,1,94,152,88,88,90,91,91,90,153,116,121,144,137,114,40,45,52,197,
+135,110,193,64,27,27,114,137,146,119,116,153,163,254,229,141,146,119,85,79,
+156,137,188,1,32,64,159,22,63,53,131,130,89,94,170,100,108,150,18,196,254,
+170,70,60,90,82,158,135,195,1,28,89,159,117,254,142,231,215,249,88,3,174,
+9,71,57,60,66,67,63,59,252,194,64,55,63,67,65,61,57,71,6,5,0,1,0,56,255,232,
+6,119,4,130,0,59,0,0,1,35,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,
+54,51,50,22,21,20,6,7,14,2,21,20,33,32,36,53,16,39,55,22,18,21,16,0,33,34,
+38,53,52,54,55,62,2,53,52,38,35,34,6,2,212,161,27,102,68,67,75,19,15,155,
+47,171,129,185,101,106,194,138,160,156,209,113,99,48,1,64,1,5,1,35,184,145,
+101,106,254,122,254,173,229,249,156,185,139,100,44,76,66,76,105,3,5,108,113,
+78,65,33,77,27,51,94,109,126,162,181,181,167,140,134,162,56,30,44,59,43,181,
+236,213,1,21,198,92,129,254,238,160,254,224,254,185,177,162,117,148,46,35,
+56,74,56,69,76,111,0,4,0,59,255,232,6,1,6,120,0,49,0,50,0,51,0,52,0,0,37,
+6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,
+32,19,51,22,22,51,50,54,53,52,2,36,37,55,4,4,18,21,20,6,35,34,38,1,19,19,
+3,68,60,167,151,176,223,170,141,109,132,27,140,13,50,43,69,80,135,126,1,2,
+23,157,9,132,108,102,104,218,254,105,254,247,21,1,70,1,209,246,199,160,119,
+154,253,195,23,65,160,92,92,202,163,141,182,104,87,76,45,13,35,31,44,45,93,
+78,98,113,1,5,125,136,144,140,183,1,16,147,1,169,6,193,254,165,224,215,233,
+76,4,54,2,14,253,147,0,0,3,0,59,255,232,6,1,4,170,0,58,0,59,0,60,0,0,37,6,
+6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,
+19,51,22,22,51,50,54,53,52,2,39,6,35,34,38,39,55,22,22,51,50,54,55,4,0,17,
+20,6,35,34,38,1,21,3,68,60,167,151,176,223,170,141,109,132,27,140,13,50,43,
+69,80,135,126,1,2,23,157,9,132,108,102,104,246,246,97,234,154,188,3,158,6,
+84,98,92,105,19,1,128,1,134,199,160,119,154,252,242,160,92,92,202,163,141,
+182,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,144,140,215,1,33,
+74,215,198,195,16,126,129,125,130,63,254,108,254,209,215,233,76,4,54,95,0,
+0,2,0,70,255,232,6,32,4,130,0,68,0,69,0,0,19,38,53,52,54,51,50,22,23,54,51,
+50,18,17,16,2,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,
+52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,2,35,34,6,7,35,38,
+38,35,34,21,20,23,1,124,23,177,153,115,171,64,128,204,206,249,208,194,108,
+144,67,60,167,151,176,223,170,141,109,132,27,140,13,50,43,69,80,135,126,1,
+2,23,157,9,124,97,126,118,157,134,103,131,19,161,21,138,103,163,15,1,223,
+2,218,68,72,127,157,94,95,189,254,171,254,215,254,245,254,239,80,104,92,92,
+202,163,141,182,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,182,
+195,219,1,2,119,111,110,120,130,50,44,1,106,0,3,0,56,255,232,5,247,4,130,
+0,58,0,59,0,60,0,0,1,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,
+54,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,
+51,50,19,51,22,22,51,50,54,53,52,39,5,1,5,137,110,193,184,117,158,63,59,166,
+139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,162,169,107,156,
+85,70,35,98,89,253,23,157,8,140,111,100,109,87,253,41,1,72,2,129,143,171,
+167,184,88,96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,
+103,118,154,158,130,93,152,100,55,63,69,45,73,78,1,5,124,137,99,86,123,100,
+38,2,110,0,0,5,0,56,255,232,5,247,6,120,0,68,0,69,0,70,0,71,0,72,0,0,1,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,
+23,7,38,53,52,54,55,38,53,52,54,55,23,6,21,20,23,22,22,21,20,6,7,14,2,21,
+20,22,51,50,19,51,22,22,51,50,54,53,52,39,1,3,3,1,5,137,110,193,184,117,158,
+63,59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,100,90,108,170,
+164,16,188,129,146,149,107,156,85,70,35,98,89,253,23,157,8,140,111,100,109,
+87,253,221,32,148,1,72,2,129,143,171,167,184,88,96,95,89,175,128,78,120,104,
+77,71,87,49,139,72,68,63,57,64,99,103,86,134,30,99,117,120,134,6,159,4,115,
+94,83,10,157,120,93,152,100,55,63,69,45,73,78,1,5,124,137,99,86,123,100,4,
+86,254,10,253,122,2,110,0,3,0,59,255,232,5,250,6,120,0,110,0,111,0,112,0,
+0,1,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,
+6,21,20,23,7,38,53,52,54,55,53,51,50,54,54,53,52,39,33,53,33,50,22,22,21,
+20,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,51,50,54,53,
+52,38,38,35,35,22,21,20,6,7,7,22,22,21,20,6,7,14,2,21,20,22,51,50,19,51,22,
+22,51,50,54,53,52,39,5,19,5,140,110,193,184,117,158,63,59,166,139,158,188,
+56,107,120,111,62,166,82,88,41,145,62,45,47,193,100,84,42,68,254,98,3,55,
+228,252,125,212,180,142,173,120,98,74,83,65,46,48,60,6,10,90,83,109,119,87,
+178,212,191,54,59,33,10,46,47,107,156,85,70,35,98,89,253,23,157,8,140,111,
+100,109,87,253,1,157,2,129,143,171,167,184,88,96,95,89,175,128,78,120,104,
+77,71,87,49,139,72,68,63,57,64,99,103,56,103,38,75,26,54,45,81,83,159,128,
+226,164,193,223,173,134,120,136,72,63,57,68,46,41,29,39,85,93,141,134,110,
+152,94,82,90,73,90,20,6,38,113,65,93,152,100,55,63,69,45,73,78,1,5,124,137,
+99,86,123,100,38,4,124,0,0,3,0,73,255,232,4,93,6,120,0,42,0,54,0,55,0,0,1,
+22,21,20,7,33,21,39,22,22,21,20,6,35,34,38,53,52,55,7,53,33,54,53,52,39,33,
+53,33,50,54,54,53,52,39,55,22,22,21,20,6,6,35,3,34,6,21,20,22,51,50,54,53,
+52,38,3,2,170,33,26,1,159,199,73,79,250,227,214,248,146,191,1,171,53,34,254,
+66,2,99,106,108,53,133,133,84,82,73,160,163,134,147,157,156,148,148,157,158,
+191,3,203,55,50,56,41,143,3,44,142,86,179,202,205,172,174,101,2,143,39,60,
+52,51,159,22,63,53,131,130,89,94,170,100,75,129,79,254,167,134,116,113,127,
+127,113,118,132,4,6,0,2,0,52,255,232,6,130,5,9,0,61,0,73,0,0,1,22,22,51,50,
+54,53,52,0,37,55,4,0,17,20,2,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,
+54,54,53,52,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,18,21,20,6,7,38,38,35,34,6,21,20,22,51,50,54,3,122,111,143,79,130,145,
+254,240,254,250,88,1,42,1,60,236,212,97,200,121,78,205,127,158,180,169,149,
+100,186,103,16,17,152,130,88,96,11,23,84,48,61,83,70,97,125,185,145,211,241,
+35,241,93,146,74,74,82,90,86,94,146,1,30,85,63,179,162,217,1,78,100,159,127,
+254,96,254,247,235,254,242,82,96,89,89,153,137,112,148,67,74,51,115,63,181,
+210,81,74,37,24,79,66,55,62,70,128,108,137,166,254,223,241,98,169,108,74,
+59,66,54,61,71,59,0,0,2,0,96,0,0,4,200,6,120,0,38,0,39,0,0,1,50,54,54,53,
+52,39,55,22,22,21,20,6,7,22,18,17,17,35,53,52,46,2,35,34,14,3,21,21,35,53,
+16,18,55,33,53,1,3,23,106,108,53,133,133,85,81,134,130,128,136,185,38,104,
+137,93,70,109,89,79,32,185,133,128,254,244,1,195,4,106,22,63,53,131,130,89,
+95,170,100,105,151,18,97,254,191,254,213,254,250,221,193,251,209,97,50,100,
+193,239,168,221,255,1,30,1,86,88,159,2,14,0,5,0,63,254,218,7,192,6,120,0,
+16,0,28,0,32,0,96,0,97,0,0,19,53,33,50,54,54,53,52,39,55,22,22,21,20,6,6,
+35,5,50,22,21,20,6,35,34,38,53,52,54,3,19,51,19,1,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,
+51,22,22,51,50,54,53,52,38,39,55,22,22,51,50,54,53,52,39,55,22,22,21,20,6,
+35,34,39,22,1,63,4,71,106,108,53,133,133,84,82,73,160,163,254,139,50,70,71,
+49,49,69,67,26,16,158,16,2,92,206,151,119,154,69,60,167,151,176,223,172,139,
+109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,97,109,79,83,143,
+90,127,86,78,84,183,110,116,122,170,141,94,64,24,253,27,3,203,159,22,63,53,
+131,130,89,94,170,100,75,129,79,122,70,51,50,70,71,49,49,72,251,137,1,69,
+254,187,2,130,168,204,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,
+44,45,93,78,98,113,1,5,125,136,117,86,96,165,83,96,127,88,84,73,177,127,128,
+88,220,122,143,160,38,53,4,225,0,4,0,56,255,232,5,247,4,130,0,75,0,87,0,88,
+0,89,0,0,1,54,53,52,38,35,34,6,7,6,6,7,14,2,21,20,22,51,50,19,51,22,22,51,
+50,54,53,52,39,55,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,
+53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,7,37,
+50,22,21,20,6,35,34,38,53,52,54,3,3,4,234,19,100,96,96,190,83,16,110,125,
+85,70,35,98,89,253,23,157,8,139,112,101,108,87,145,110,195,182,117,158,63,
+59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,117,151,
+35,101,189,107,162,187,28,254,23,50,70,71,49,49,69,67,163,166,2,226,46,57,
+79,82,105,101,67,128,80,55,63,69,45,73,78,1,5,125,136,94,85,113,96,95,140,
+171,158,176,88,96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,
+99,103,118,154,82,81,86,77,164,135,99,63,86,70,51,50,70,71,49,49,72,1,95,
+253,146,0,0,3,0,56,255,232,6,37,6,120,0,92,0,93,0,94,0,0,1,53,51,50,54,54,
+53,52,39,55,22,22,21,20,6,7,22,22,21,20,7,51,21,35,34,39,22,22,21,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,38,
+39,33,53,33,54,53,52,39,1,1,3,133,239,106,108,53,133,133,84,82,120,119,20,
+21,28,217,85,53,54,81,74,195,182,117,158,63,59,166,139,158,188,56,107,120,
+111,62,166,82,88,41,145,62,181,156,162,169,107,156,85,70,35,98,89,253,23,
+157,8,140,111,101,108,105,94,254,253,1,3,53,36,254,193,254,162,3,203,159,
+22,63,53,131,130,89,94,170,100,100,146,25,26,64,27,53,44,143,3,67,150,92,
+163,181,88,96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,
+103,118,154,158,130,93,152,100,55,63,69,45,73,78,1,5,124,137,102,92,92,153,
+49,143,39,60,57,46,2,173,251,132,0,4,0,85,254,218,6,106,6,120,0,60,0,71,0,
+75,0,76,0,0,1,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,2,39,35,53,51,
+50,54,54,53,52,39,55,22,22,21,20,6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,
+2,17,52,18,54,51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,38,35,34,6,1,19,
+51,19,3,1,2,5,139,123,122,156,17,157,8,140,111,113,135,213,190,110,230,106,
+108,53,133,133,84,82,139,133,145,145,227,197,112,156,62,65,166,140,198,234,
+121,207,126,134,156,190,164,120,69,77,99,101,106,73,61,80,134,1,217,16,158,
+16,184,2,121,54,62,185,194,137,124,124,137,160,133,188,1,32,64,159,22,63,
+53,131,130,89,94,170,100,108,150,18,98,254,243,170,213,252,90,94,95,89,1,
+31,1,3,196,1,33,147,148,127,141,168,206,62,83,75,65,73,120,251,96,1,69,254,
+187,7,158,0,0,3,0,56,255,232,5,247,4,130,0,75,0,76,0,77,0,0,1,22,21,20,6,
+35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,
+53,52,54,51,50,22,23,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,39,6,
+6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,39,5,1,5,137,110,195,182,
+117,158,63,59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,
+122,155,32,158,187,94,101,20,17,158,20,27,182,167,212,144,18,103,123,85,70,
+35,98,89,253,23,157,8,139,112,101,108,87,253,41,1,72,2,109,140,171,158,176,
+88,96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,
+154,89,88,188,82,79,38,86,32,48,35,112,49,152,169,136,56,116,80,55,63,69,
+45,73,78,1,5,125,136,94,85,113,96,18,2,110,0,4,0,85,254,218,10,189,6,120,
+0,11,0,79,0,83,0,84,0,0,1,34,6,21,20,22,51,50,54,53,52,38,3,34,36,38,53,16,
+55,35,53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,22,21,20,7,22,22,51,50,
+54,53,52,2,39,55,22,18,21,20,7,22,22,51,50,54,53,52,2,39,55,22,18,21,20,6,
+35,34,39,6,35,34,38,39,6,6,1,19,51,19,1,2,159,188,230,223,193,193,219,230,
+183,171,254,245,145,219,219,2,219,106,108,53,133,133,84,82,119,110,119,110,
+29,81,171,106,121,137,201,201,88,235,247,14,76,160,97,121,137,201,201,88,
+235,247,229,204,214,175,115,241,116,207,103,79,245,4,2,16,158,16,250,55,3,
+203,228,187,193,220,227,186,188,227,252,29,131,248,165,1,45,150,159,22,63,
+53,131,130,90,94,171,100,100,145,24,82,226,157,100,88,98,96,158,135,195,1,
+28,89,159,117,254,142,231,72,65,83,82,158,135,195,1,28,89,159,117,254,142,
+231,215,249,172,172,99,111,104,106,254,242,1,69,254,187,7,158,0,2,0,56,255,
+143,7,134,4,130,0,75,0,86,0,0,19,38,53,52,54,51,50,22,23,54,54,51,50,22,23,
+54,54,51,50,22,21,20,7,39,54,54,53,52,38,35,34,6,6,21,23,22,21,20,6,7,22,
+23,7,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,7,35,
+38,38,35,34,6,21,20,22,23,1,38,38,35,34,6,21,20,51,50,54,103,47,180,135,108,
+147,59,49,155,112,97,156,51,56,145,105,135,180,47,155,15,19,83,75,66,105,
+51,2,2,81,71,73,36,170,23,44,93,221,129,189,203,201,179,150,245,95,38,39,
+115,114,86,117,17,161,15,119,88,75,83,19,15,3,4,72,191,119,104,112,238,110,
+180,2,141,94,111,131,165,87,97,88,96,87,87,90,84,165,131,111,94,49,29,80,
+34,70,77,75,125,57,29,29,29,119,230,83,124,172,33,119,102,66,66,165,145,136,
+155,114,114,62,149,86,173,173,126,112,114,124,77,70,34,80,29,254,43,97,98,
+75,65,158,51,0,5,0,82,255,232,6,64,6,120,0,70,0,80,0,81,0,82,0,83,0,0,37,
+6,6,35,34,38,53,52,54,55,38,38,53,52,54,55,23,6,6,21,20,23,54,51,50,22,21,
+20,6,35,34,39,21,20,22,51,50,19,51,22,22,51,50,54,53,52,38,39,35,53,51,50,
+54,53,52,38,39,55,22,22,21,20,6,7,22,21,20,6,35,34,38,1,22,51,50,53,52,38,
+35,34,6,1,3,1,3,117,75,172,141,192,223,107,99,55,59,171,163,16,94,94,127,
+17,17,127,153,177,159,109,89,137,138,245,44,157,11,138,110,101,108,145,116,
+151,117,145,110,116,108,57,163,172,91,82,213,191,176,116,167,253,86,71,86,
+192,68,55,80,116,1,231,20,1,84,160,95,89,248,219,148,238,63,39,109,57,111,
+125,5,159,2,50,52,85,41,2,136,115,124,147,52,44,150,149,1,5,125,136,102,92,
+106,161,27,153,84,80,87,96,21,156,37,181,124,94,148,42,125,232,162,182,89,
+2,45,49,120,53,61,96,1,163,2,14,254,0,0,4,0,85,255,232,4,225,6,120,0,28,0,
+40,0,52,0,53,0,0,1,22,22,21,20,6,4,35,34,36,38,53,16,55,35,53,33,50,54,54,
+53,52,39,55,22,22,21,20,6,5,34,6,21,20,22,51,50,54,53,52,38,3,50,22,21,20,
+6,35,34,38,53,52,54,3,3,252,119,110,140,254,246,175,171,254,245,145,219,219,
+2,219,106,108,53,133,133,84,82,119,254,53,188,230,223,193,193,219,229,186,
+50,70,71,49,49,69,67,19,3,217,82,226,157,158,248,138,131,248,165,1,45,150,
+159,22,63,53,131,130,89,94,170,100,100,145,38,228,188,193,220,227,186,188,
+228,254,228,70,51,50,70,71,49,49,72,3,201,0,0,4,0,85,255,232,5,213,6,120,
+0,31,0,41,0,80,0,81,0,0,1,51,22,22,51,50,54,53,52,39,6,35,34,38,53,52,54,
+51,50,23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,34,6,21,20,51,50,54,55,
+20,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,33,53,33,50,54,54,
+53,52,39,55,22,22,21,20,6,7,22,22,1,2,192,157,17,132,100,105,124,12,85,132,
+112,137,130,103,87,69,44,218,147,71,241,254,236,102,109,94,125,2,68,61,89,
+44,55,107,48,79,168,1,39,39,206,160,124,157,64,49,158,132,168,190,142,132,
+254,238,3,207,101,109,57,133,133,84,82,124,124,82,89,253,43,1,120,114,124,
+124,116,53,56,89,115,103,97,111,34,84,97,254,225,236,157,153,124,1,107,74,
+44,38,90,51,113,21,19,59,138,78,177,223,84,100,86,98,247,226,176,1,17,73,
+159,20,62,56,131,130,89,94,170,100,102,147,23,44,150,3,100,0,5,0,85,254,218,
+5,213,6,120,0,31,0,41,0,80,0,84,0,85,0,0,1,51,22,22,51,50,54,53,52,39,6,35,
+34,38,53,52,54,51,50,23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,34,6,21,
+20,51,50,54,55,20,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,33,
+53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,22,1,19,51,19,3,2,192,157,17,
+132,100,105,124,12,85,132,112,137,130,103,87,69,44,218,147,71,241,254,236,
+102,109,94,125,2,68,61,89,44,55,107,48,79,168,1,39,39,206,160,124,157,64,
+49,158,132,168,190,142,132,254,238,3,207,101,109,57,133,133,84,82,124,124,
+82,89,253,40,16,158,16,119,1,120,114,124,124,116,53,56,89,115,103,97,111,
+34,84,97,254,225,236,157,153,124,1,107,74,44,38,90,51,113,21,19,59,138,78,
+177,223,84,100,86,98,247,226,176,1,17,73,159,20,62,56,131,130,89,94,170,100,
+102,147,23,44,150,251,198,1,69,254,187,7,158,0,1,0,63,255,232,6,148,4,130,
+0,78,0,0,1,39,54,53,52,38,35,34,6,21,20,22,51,50,54,53,53,52,38,35,34,6,7,
+35,2,33,34,6,21,20,22,51,51,21,35,34,6,6,21,20,22,51,50,54,55,23,6,35,34,
+38,53,52,55,38,53,52,54,51,50,22,23,54,51,50,0,17,16,2,35,34,38,53,52,54,
+51,50,22,21,20,5,79,140,13,47,40,53,65,107,104,136,142,176,152,114,142,16,
+157,33,254,253,109,115,124,147,32,56,95,100,64,85,79,63,101,56,98,146,178,
+155,171,180,168,216,173,132,172,70,121,233,232,1,4,235,217,164,197,158,120,
+107,130,1,30,13,35,31,44,45,78,67,88,92,198,192,16,210,247,134,127,1,5,99,
+90,82,110,144,32,76,69,74,87,41,45,125,114,159,136,185,82,98,188,144,186,
+89,100,189,254,180,254,215,254,253,254,222,177,150,125,170,104,87,76,0,0,
+3,0,70,255,232,4,175,6,120,0,56,0,65,0,66,0,0,1,6,6,35,34,38,53,52,54,51,
+50,23,38,38,39,33,53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,22,29,2,22,
+22,21,20,4,33,32,36,53,52,55,23,6,21,20,22,51,50,54,53,52,39,38,35,34,6,21,
+20,51,50,3,4,5,45,174,108,135,147,155,146,103,95,15,77,63,253,85,2,173,106,
+108,53,133,133,84,82,116,114,54,54,59,63,254,219,254,233,254,251,254,216,
+11,162,8,199,196,208,213,139,73,96,81,78,133,150,102,2,27,79,89,118,112,106,
+117,31,56,89,33,159,22,63,53,131,130,89,94,170,100,98,145,26,46,129,83,13,
+11,54,144,82,216,231,236,199,63,56,22,39,40,140,151,151,131,67,164,35,40,
+43,83,4,112,0,5,0,85,254,218,5,201,6,120,0,33,0,54,0,58,0,70,0,71,0,0,1,33,
+53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,18,21,20,6,35,34,38,39,6,6,
+35,34,38,53,52,18,1,51,22,22,51,50,54,53,52,38,38,35,35,34,0,21,20,22,51,
+50,54,19,19,51,19,3,50,22,21,20,6,35,34,38,53,52,54,3,1,103,254,238,3,195,
+104,109,54,133,133,84,82,136,135,130,141,192,173,116,154,64,49,158,132,168,
+190,142,1,221,157,17,128,94,107,106,123,231,155,34,241,254,236,102,109,94,
+125,5,16,158,16,96,50,70,71,49,49,69,67,141,3,203,159,21,64,53,131,130,89,
+94,170,100,107,150,20,79,254,236,173,228,245,85,99,86,98,247,226,176,1,17,
+253,246,112,126,150,155,152,243,133,254,225,236,157,153,124,253,212,1,69,
+254,187,4,17,70,51,50,70,71,49,49,72,3,141,0,0,3,0,85,255,232,5,201,6,120,
+0,33,0,54,0,55,0,0,1,33,53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,18,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,1,51,22,22,51,50,17,52,38,38,35,
+35,34,6,6,21,20,22,51,50,54,19,1,103,254,238,3,195,101,109,57,133,133,84,
+82,136,136,130,142,192,173,116,154,64,49,158,132,168,190,142,1,221,157,8,
+134,97,214,123,232,155,34,157,235,125,102,109,99,130,20,3,203,159,20,62,56,
+131,130,89,94,170,100,107,150,19,79,254,234,172,228,245,85,99,86,98,247,226,
+176,1,17,254,13,122,139,1,49,150,244,134,128,241,155,156,153,138,5,100,0,
+4,0,85,254,218,5,201,6,120,0,33,0,54,0,58,0,59,0,0,1,33,53,33,50,54,54,53,
+52,39,55,22,22,21,20,6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,
+1,51,22,22,51,50,17,52,38,38,35,35,34,6,6,21,20,22,51,50,54,3,19,51,19,3,
+1,103,254,238,3,195,101,109,57,133,133,84,82,136,136,130,142,192,173,116,
+154,64,49,158,132,168,190,142,1,221,157,8,134,97,214,123,232,155,34,157,235,
+125,102,109,99,130,5,16,158,16,213,3,203,159,20,62,56,131,130,89,94,170,100,
+107,150,19,79,254,234,172,228,245,85,99,86,98,247,226,176,1,17,254,13,122,
+139,1,49,150,244,134,128,241,155,156,153,138,253,198,1,69,254,187,7,158,0,
+3,0,63,255,228,5,91,6,120,0,54,0,55,0,56,0,0,37,7,38,38,53,52,54,51,50,22,
+23,30,2,51,50,54,53,52,2,39,33,53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,
+22,18,21,20,6,35,34,38,38,39,46,2,35,34,6,21,20,1,3,1,75,159,51,58,177,130,
+108,151,86,63,73,92,64,95,101,252,200,253,84,3,103,107,108,52,133,133,84,
+82,150,158,149,159,202,179,89,135,102,62,52,69,65,44,67,77,1,165,105,35,63,
+69,172,84,140,188,93,149,109,90,46,133,119,205,1,74,46,159,23,63,52,131,130,
+89,94,170,100,112,155,13,103,254,220,174,202,227,61,113,106,88,88,36,88,77,
+125,5,198,249,136,0,0,4,0,63,255,232,6,5,6,120,0,16,0,63,0,75,0,76,0,0,19,
+53,33,50,54,54,53,52,39,55,22,22,21,20,6,6,35,23,22,17,20,6,35,34,38,39,6,
+6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,
+19,51,22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,38,53,52,54,3,63,
+4,21,106,108,53,133,133,84,82,73,160,163,200,196,201,158,119,154,69,60,167,
+151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,
+108,100,106,86,86,254,133,50,70,71,49,49,69,67,6,3,203,159,22,63,53,131,130,
+89,94,170,100,75,129,79,81,215,254,243,202,228,76,108,92,92,202,163,142,181,
+104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,131,123,107,195,99,56,
+70,51,50,70,71,49,49,72,3,39,0,5,0,63,254,218,6,5,6,120,0,16,0,63,0,75,0,
+79,0,80,0,0,19,53,33,50,54,54,53,52,39,55,22,22,21,20,6,6,35,23,22,17,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,
+6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,
+38,53,52,54,3,19,51,19,3,63,4,21,106,108,53,133,133,84,82,73,160,163,200,
+196,201,158,119,154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,
+69,80,135,126,1,2,23,157,9,132,108,100,106,86,86,254,133,50,70,71,49,49,69,
+67,26,16,158,16,173,3,203,159,22,63,53,131,130,89,94,170,100,75,129,79,81,
+215,254,243,202,228,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,
+45,93,78,98,113,1,5,125,136,131,123,107,195,99,56,70,51,50,70,71,49,49,72,
+251,137,1,69,254,187,7,158,0,3,0,56,255,232,6,30,4,134,0,60,0,61,0,62,0,0,
+37,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,2,39,55,
+22,18,21,20,6,35,34,38,1,1,3,44,59,166,139,158,188,56,107,120,111,62,166,
+82,88,41,145,62,181,156,162,169,107,156,85,70,35,98,89,253,23,157,8,140,111,
+113,135,201,201,88,235,247,227,197,112,156,254,183,1,72,160,95,89,175,128,
+78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,158,130,93,152,100,
+55,63,69,45,73,78,1,5,124,137,160,133,195,1,28,89,159,117,254,142,230,213,
+252,90,1,186,2,110,0,0,4,0,56,254,218,6,30,6,120,0,74,0,78,0,79,0,80,0,0,
+37,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,2,39,35,
+53,51,50,54,54,53,52,39,55,22,22,21,20,6,7,4,17,20,6,35,34,38,3,19,51,19,
+3,3,3,44,59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,
+162,169,107,156,85,70,35,98,89,253,23,157,8,140,111,113,135,213,190,110,230,
+106,108,53,133,133,84,82,139,133,1,34,227,197,112,156,156,16,158,16,138,210,
+160,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,
+158,130,93,152,100,55,63,69,45,73,78,1,5,124,137,160,133,188,1,32,64,159,
+22,63,53,131,130,89,94,170,100,108,150,18,196,254,171,213,252,90,254,152,
+1,69,254,187,7,158,251,132,0,2,0,63,255,232,8,244,6,120,0,82,0,83,0,0,37,
+6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,
+34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,0,39,33,53,33,50,54,54,53,
+52,39,55,22,22,21,20,6,7,22,18,21,20,7,22,22,51,50,54,53,52,2,39,55,22,18,
+21,20,6,35,34,1,5,197,49,154,92,119,154,69,60,167,151,176,223,172,139,109,
+132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,254,255,191,
+252,162,4,21,106,108,53,133,133,84,82,155,153,150,158,8,76,160,97,121,137,
+201,201,88,235,247,229,204,209,252,30,140,81,83,76,108,92,92,202,163,142,
+181,104,87,76,45,13,37,29,44,45,93,78,98,113,1,5,125,136,133,121,205,1,75,
+43,159,22,63,53,131,130,89,94,170,100,114,155,11,104,254,220,173,55,47,83,
+82,158,135,195,1,28,89,159,117,254,142,231,215,249,6,144,0,0,3,0,77,255,232,
+10,97,6,120,0,68,0,80,0,81,0,0,37,6,35,34,38,39,6,6,35,34,38,2,53,52,18,54,
+51,50,22,18,21,20,7,22,22,51,50,54,53,52,2,39,35,53,51,50,54,54,53,52,39,
+55,22,22,21,20,6,7,4,17,20,7,22,22,51,50,54,53,52,2,39,55,22,18,21,20,6,35,
+34,1,34,6,21,20,22,51,50,54,53,52,38,1,7,38,111,246,117,207,98,74,217,133,
+170,249,131,139,250,156,172,246,128,40,80,168,99,123,139,213,190,110,230,
+106,108,53,133,133,84,82,139,133,1,34,13,80,161,98,121,137,201,201,88,235,
+247,229,204,218,250,150,172,203,198,180,174,203,201,1,96,152,176,99,105,100,
+104,150,1,24,166,166,1,12,148,153,254,236,159,129,112,95,92,156,137,188,1,
+32,64,159,22,63,53,131,130,89,94,170,100,108,150,18,196,254,170,70,60,90,
+82,158,135,195,1,28,89,159,117,254,142,231,215,249,3,248,227,197,205,225,
+231,202,197,224,2,152,0,3,0,85,255,232,4,225,6,120,0,28,0,40,0,41,0,0,1,22,
+22,21,20,6,4,35,34,36,38,53,16,55,35,53,33,50,54,54,53,52,39,55,22,22,21,
+20,6,5,34,6,21,20,22,51,50,54,53,52,38,3,3,252,119,110,140,254,246,175,171,
+254,245,145,219,219,2,219,106,108,53,133,133,84,82,119,254,53,188,230,223,
+193,193,219,229,217,3,217,82,226,157,158,248,138,131,248,165,1,45,150,159,
+22,63,53,131,130,89,94,170,100,100,145,38,228,188,193,220,227,186,188,228,
+2,173,0,0,5,0,82,255,232,6,203,4,130,0,34,0,44,0,55,0,77,0,78,0,0,37,6,6,
+35,34,2,17,52,18,54,51,50,22,21,20,7,54,51,51,50,23,38,53,52,54,51,50,22,
+18,21,16,2,35,34,38,1,38,38,35,34,6,21,20,51,50,37,22,51,50,54,53,52,38,35,
+34,6,19,34,39,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,39,6,35,1,3,
+142,68,171,144,205,240,121,207,126,133,157,44,30,28,140,29,30,44,159,133,
+130,207,115,240,205,146,172,2,49,34,133,81,61,73,207,96,251,105,77,99,102,
+105,73,61,80,134,174,138,99,5,144,130,132,159,17,157,17,159,132,129,145,6,
+103,133,254,3,160,96,88,1,33,1,1,196,1,33,147,149,126,83,72,2,2,71,84,125,
+150,155,254,226,191,254,255,254,223,90,2,198,112,122,73,65,158,62,62,80,78,
+65,73,120,254,192,63,53,63,185,194,133,128,128,133,193,186,51,65,63,2,48,
+0,3,0,75,255,232,5,199,4,133,0,30,0,41,0,42,0,0,19,20,22,22,51,32,36,53,16,
+37,55,4,17,16,0,33,34,36,2,53,52,54,54,51,50,22,21,20,6,35,34,39,22,51,50,
+54,53,52,38,35,34,6,37,236,130,244,164,1,0,1,24,254,209,95,1,121,254,146,
+254,167,209,254,198,170,112,195,121,132,154,190,164,112,74,77,95,101,107,
+73,61,90,131,2,176,2,110,135,223,122,229,205,1,15,159,151,203,254,133,254,
+237,254,188,160,1,42,196,157,240,127,148,127,139,170,198,54,83,75,65,73,124,
+112,0,5,0,66,255,232,5,110,6,120,0,54,0,66,0,79,0,80,0,81,0,0,1,22,21,20,
+6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,34,39,30,2,51,50,54,
+54,53,52,39,35,53,51,50,54,54,53,52,39,55,22,22,21,20,6,7,22,21,20,6,1,22,
+51,50,54,53,52,38,35,34,6,21,1,34,6,6,21,20,22,51,50,54,53,52,38,3,19,3,250,
+49,169,153,140,175,61,198,227,194,165,127,157,174,166,50,61,44,166,221,62,
+107,231,128,165,195,100,106,108,53,133,133,84,82,69,80,142,191,252,48,60,
+75,97,101,74,62,89,108,2,19,28,81,51,85,77,80,81,97,178,116,1,97,52,85,111,
+129,124,113,81,59,40,235,160,165,201,133,114,127,144,16,65,78,32,54,125,94,
+153,68,159,22,63,53,131,130,89,94,170,100,73,126,43,104,160,149,205,1,151,
+25,65,60,50,59,112,91,254,58,23,59,42,50,59,56,53,58,66,5,23,250,198,0,0,
+2,0,63,255,232,6,5,6,120,0,62,0,63,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,
+51,50,54,53,52,0,39,33,53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,18,1,
+6,5,201,158,119,154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,
+69,80,135,126,1,2,23,157,9,132,108,100,106,254,255,191,252,162,4,21,106,108,
+53,133,133,84,82,155,153,150,158,252,170,1,149,201,228,76,108,92,92,202,163,
+142,181,104,87,76,45,13,37,29,44,45,93,78,98,113,1,5,125,136,133,121,205,
+1,75,43,159,22,63,53,131,130,89,94,170,100,114,155,11,104,254,220,4,54,0,
+0,4,0,63,255,232,4,186,6,120,0,44,0,60,0,61,0,62,0,0,1,7,38,38,53,52,55,35,
+53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,22,21,16,0,33,34,38,53,52,54,
+54,55,54,54,53,52,38,35,34,21,20,37,22,21,20,6,7,6,6,21,20,33,50,36,53,16,
+39,1,19,1,112,152,25,23,47,152,2,209,105,101,54,133,133,84,82,114,102,107,
+109,254,167,254,197,234,253,89,166,137,164,98,98,86,192,1,202,66,174,180,
+157,123,1,63,235,1,2,229,254,233,100,2,241,64,45,77,46,62,52,159,22,63,53,
+131,130,89,94,170,100,100,140,25,84,229,134,254,243,254,215,180,167,97,129,
+70,19,21,78,90,71,77,133,51,180,74,93,135,152,22,19,76,77,185,211,195,1,24,
+147,254,20,4,153,0,0,4,0,63,255,144,6,25,6,120,0,16,0,73,0,85,0,86,0,0,19,
+53,33,50,54,54,53,52,39,55,22,22,21,20,6,6,35,19,39,6,35,34,38,39,6,6,35,
+34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,
+51,22,22,51,50,55,1,55,1,54,54,53,52,38,39,55,22,17,20,6,7,23,1,50,22,21,
+20,6,35,34,38,53,52,54,3,63,4,41,106,108,53,133,133,84,82,73,160,163,252,
+80,69,76,122,158,72,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,
+80,135,126,1,2,23,157,9,137,114,44,25,254,236,136,1,6,14,14,89,87,144,196,
+47,46,89,253,33,50,70,71,49,49,69,67,6,3,203,159,22,63,53,131,130,89,94,170,
+100,75,129,79,251,197,117,29,75,109,92,92,202,163,142,181,104,87,76,45,13,
+35,31,44,45,93,78,98,113,1,5,127,137,7,1,143,85,254,122,28,78,50,106,196,
+99,97,215,254,243,95,152,57,127,3,106,70,51,50,70,71,49,49,72,3,39,0,5,0,
+63,255,228,5,92,6,120,0,16,0,56,0,68,0,69,0,70,0,0,19,53,33,50,54,54,53,52,
+39,55,22,22,21,20,6,6,35,1,7,38,38,53,52,54,51,50,22,22,23,30,2,51,50,54,
+53,52,38,39,55,22,17,20,6,35,34,38,38,39,46,2,35,34,6,21,20,1,50,22,21,20,
+6,35,34,38,53,52,54,3,3,63,3,108,106,108,53,133,133,84,82,73,160,163,253,
+123,159,51,58,178,129,82,116,91,56,62,76,89,62,95,105,85,86,138,201,201,181,
+89,135,102,62,52,69,65,44,67,77,1,215,50,68,68,50,50,69,69,14,135,3,203,159,
+22,63,53,131,130,89,94,170,100,75,129,79,252,88,63,68,173,85,140,187,48,96,
+98,108,91,46,139,121,107,191,97,97,215,254,252,208,231,61,113,106,88,88,36,
+88,77,126,2,197,71,50,49,71,70,50,50,71,3,2,249,136,0,0,4,0,68,255,232,6,
+37,6,120,0,49,0,61,0,73,0,74,0,0,1,22,21,20,7,54,51,50,22,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,39,33,53,33,50,54,54,53,
+52,39,55,22,22,21,20,6,6,35,1,50,54,53,52,38,35,34,6,21,20,22,33,50,54,53,
+52,38,35,34,6,21,20,22,1,3,9,126,5,102,179,183,211,223,191,118,177,46,50,
+177,118,189,216,223,192,80,136,46,2,130,112,254,76,4,47,106,108,53,133,133,
+84,82,73,160,163,253,77,123,133,133,115,122,135,134,3,9,123,133,133,115,120,
+137,134,254,227,3,203,95,174,30,15,112,218,181,177,217,93,89,89,93,208,186,
+182,217,55,55,11,16,95,156,34,159,22,63,53,131,130,89,94,170,100,75,129,79,
+252,183,128,112,114,132,129,112,115,130,128,112,114,132,131,110,115,130,5,
+246,0,3,252,153,254,140,255,78,255,143,0,11,0,23,0,24,0,0,5,50,22,21,20,6,
+35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,37,254,214,50,70,71,
+49,49,69,67,254,108,50,70,71,49,49,69,67,1,25,131,70,51,50,70,71,49,49,72,
+70,51,50,70,71,49,49,72,18,0,0,1,0,33,255,232,3,80,4,106,0,37,0,0,1,21,33,
+34,6,6,21,20,22,23,30,2,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,38,
+39,38,38,53,52,54,54,51,3,29,254,155,71,82,45,129,146,131,129,71,203,177,
+181,230,24,169,9,140,117,103,108,51,105,140,158,151,94,140,126,4,106,159,
+12,44,37,58,90,62,56,95,130,92,145,174,215,197,11,124,137,82,75,53,74,63,
+61,68,154,113,83,116,50,0,1,254,136,255,232,3,66,4,106,0,36,0,0,19,6,21,20,
+22,51,50,54,53,52,38,38,35,33,39,33,50,4,18,21,20,2,35,34,38,53,52,54,51,
+50,22,21,20,6,35,34,38,207,10,105,99,127,137,128,202,212,254,33,20,2,26,246,
+1,17,153,227,207,161,190,126,101,75,86,65,48,49,62,1,136,28,46,87,105,188,
+179,175,209,94,159,142,254,237,220,248,254,243,183,144,126,144,74,65,58,71,
+45,0,0,5,255,49,0,0,2,134,6,120,0,26,0,37,0,38,0,39,0,40,0,0,3,22,51,50,54,
+61,2,38,53,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,1,38,38,35,34,
+6,21,20,22,51,50,37,3,3,121,160,191,121,113,1,97,138,121,154,163,130,167,
+211,197,183,148,230,73,2,124,30,99,55,67,70,66,53,124,1,39,111,235,3,216,
+195,112,117,20,15,7,7,87,120,108,109,141,240,186,194,201,134,121,1,45,60,
+67,55,47,49,53,14,2,14,249,136,0,8,255,49,255,232,5,158,6,120,0,17,0,27,0,
+54,0,65,0,66,0,67,0,68,0,69,0,0,1,22,22,23,7,38,2,53,52,18,51,50,22,21,20,
+6,35,34,39,22,51,50,54,53,52,35,34,6,37,22,51,50,54,61,2,38,53,6,35,34,38,
+53,52,54,51,50,22,21,20,6,35,34,38,39,1,38,38,35,34,6,21,20,22,51,50,37,3,
+19,37,3,124,11,203,192,89,236,244,230,180,140,159,191,166,104,80,76,92,100,
+107,140,84,131,251,242,160,191,121,113,1,97,138,121,154,163,130,167,211,197,
+183,148,230,73,2,124,30,99,55,67,70,66,53,124,1,155,162,7,2,41,2,104,159,
+242,84,155,114,1,93,223,222,1,14,149,125,138,171,200,56,82,76,137,129,103,
+195,112,117,20,15,7,7,87,120,108,109,141,240,186,194,201,134,121,1,45,60,
+67,55,47,49,53,14,2,14,249,136,142,0,1,255,12,255,232,2,158,4,134,0,19,0,
+0,39,55,22,22,51,50,54,53,52,2,39,55,22,18,21,20,6,35,34,38,244,105,94,180,
+109,121,137,201,201,88,235,247,229,204,133,234,251,112,119,106,158,135,195,
+1,28,89,159,117,254,142,231,215,249,131,0,1,255,5,255,232,5,171,4,130,0,60,
+0,0,39,55,22,22,51,50,54,53,52,39,38,53,52,54,54,51,50,4,18,21,20,2,35,34,
+38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,51,50,54,53,52,2,35,34,
+6,21,20,23,22,21,20,6,35,34,38,251,112,79,152,92,87,88,9,9,128,236,150,184,
+1,14,142,232,202,161,190,128,99,75,86,65,48,49,62,6,10,105,99,123,141,225,
+198,167,184,8,8,188,152,113,207,226,119,105,102,92,90,94,91,91,68,147,224,
+119,164,254,205,196,237,254,238,183,144,124,146,74,65,58,71,45,42,28,46,87,
+105,188,169,228,1,27,184,166,69,94,94,69,163,179,117,0,0,5,253,121,252,175,
+1,43,0,143,0,28,0,38,0,39,0,40,0,41,0,0,55,22,21,16,0,35,34,38,53,52,54,51,
+50,22,21,20,6,35,34,39,22,22,51,50,54,53,52,38,39,1,22,51,50,53,52,38,35,
+34,6,19,23,55,169,130,254,245,252,196,231,175,135,114,124,134,129,74,59,23,
+137,114,180,184,64,51,253,239,50,64,143,51,46,64,85,150,228,151,143,229,232,
+254,253,254,240,218,176,144,188,116,100,106,113,23,87,88,198,196,93,215,81,
+254,33,25,95,39,47,82,1,76,113,117,0,4,253,121,252,175,4,58,0,161,0,63,0,
+73,0,74,0,75,0,0,1,6,21,20,22,51,50,53,52,38,38,35,35,22,21,16,0,35,34,38,
+53,52,54,51,50,22,21,20,6,35,34,39,22,22,51,50,54,53,52,38,39,55,33,50,22,
+22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,37,22,51,50,53,52,
+38,35,34,6,37,39,2,49,11,84,80,212,91,167,192,249,72,254,245,252,196,231,
+175,135,114,124,134,129,74,59,23,137,114,180,184,56,50,84,1,123,214,219,149,
+194,176,138,162,110,90,70,71,56,40,34,52,251,208,50,64,143,51,46,64,85,1,
+101,220,254,139,27,25,69,74,254,110,143,78,173,162,254,253,254,240,218,176,
+144,188,116,100,106,113,23,87,88,198,196,86,204,85,102,93,203,183,184,205,
+148,117,101,117,63,57,46,55,35,4,25,95,39,47,82,219,113,0,2,255,35,0,0,2,
+199,6,120,0,50,0,51,0,0,3,22,22,51,50,54,53,52,38,39,6,35,35,53,51,50,54,
+54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,7,
+22,21,20,6,35,34,36,39,1,100,99,186,119,86,80,48,52,42,75,168,122,153,123,
+62,105,84,59,91,25,49,59,60,53,67,72,182,146,157,189,83,83,93,171,156,156,
+254,255,119,2,84,3,216,156,136,68,68,49,75,24,5,159,38,87,80,81,99,50,45,
+48,40,47,52,90,72,105,156,190,155,104,146,41,86,117,136,148,170,188,252,133,
+0,5,255,35,255,232,5,241,6,120,0,17,0,27,0,78,0,79,0,80,0,0,1,22,22,23,7,
+38,2,53,52,18,51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,35,34,6,37,22,22,
+51,50,54,53,52,38,39,6,35,35,53,51,50,54,54,53,52,38,35,34,6,7,50,22,21,20,
+6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,21,20,6,35,34,36,39,1,37,3,207,
+11,203,192,89,236,244,230,180,140,159,191,166,104,80,76,92,100,107,140,84,
+131,251,180,104,199,129,92,86,54,52,57,94,168,122,153,123,62,105,84,59,91,
+25,49,59,60,53,67,72,182,146,157,189,71,70,108,179,163,164,254,243,124,2,
+151,3,40,2,104,159,242,84,155,114,1,93,223,222,1,14,149,125,138,171,200,56,
+82,76,137,129,103,154,138,68,68,49,78,24,8,159,38,87,80,81,99,50,45,48,40,
+47,52,90,72,105,156,190,155,96,139,43,88,128,136,148,171,187,252,133,142,
+255,255,255,35,252,175,3,103,6,120,0,34,0,64,0,0,0,3,0,72,2,14,0,0,0,3,255,
+35,255,232,7,142,6,120,0,60,0,111,0,112,0,0,55,55,22,22,51,50,54,53,52,39,
+38,53,52,54,54,51,50,4,18,21,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,
+38,39,6,21,20,22,51,50,54,53,52,2,35,34,6,21,20,23,22,21,20,6,35,34,38,1,
+22,22,51,50,54,53,52,38,39,6,35,35,53,51,50,54,54,53,52,38,35,34,6,7,50,22,
+21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,21,20,6,35,34,36,39,1,207,
+112,84,160,95,91,93,9,9,128,236,150,184,1,14,142,232,202,161,190,128,99,75,
+86,65,48,49,62,6,10,105,99,123,141,225,198,167,184,8,8,194,157,117,214,254,
+87,104,199,129,92,86,54,52,57,94,168,122,153,123,62,105,84,59,91,25,49,59,
+60,53,67,72,182,146,157,189,71,70,108,179,163,164,254,243,124,1,193,226,119,
+108,99,92,90,94,91,91,68,147,224,119,164,254,205,196,237,254,238,183,144,
+124,146,74,65,58,71,45,42,28,46,87,105,188,169,228,1,27,184,166,69,94,94,
+69,163,179,117,3,123,154,138,68,68,49,78,24,8,159,38,87,80,81,99,50,45,48,
+40,47,52,90,72,105,156,190,155,96,139,43,88,128,136,148,171,187,252,133,0,
+6,255,35,255,232,10,239,6,120,0,17,0,27,0,88,0,139,0,140,0,141,0,0,1,22,22,
+23,7,38,2,53,52,18,51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,35,34,6,1,
+55,22,22,51,50,54,53,52,39,38,53,52,54,54,51,50,4,18,21,20,2,35,34,38,53,
+52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,51,50,54,53,52,2,35,34,6,21,
+20,23,22,21,20,6,35,34,38,1,22,22,51,50,54,53,52,38,39,6,35,35,53,51,50,54,
+54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,7,
+22,21,20,6,35,34,36,39,1,37,8,205,11,203,192,89,236,244,230,180,140,159,191,
+166,104,80,76,92,100,107,140,84,131,247,233,112,84,160,95,91,93,9,9,128,236,
+150,184,1,14,142,232,202,161,190,128,99,75,86,65,48,49,62,6,10,105,99,123,
+141,225,198,167,184,8,8,194,157,117,214,254,87,104,199,129,92,86,54,52,57,
+94,168,122,153,123,62,105,84,59,91,25,49,59,60,53,67,72,182,146,157,189,71,
+70,108,179,163,164,254,243,124,1,190,9,219,2,104,159,242,84,155,114,1,93,
+223,222,1,14,149,125,138,171,200,56,82,76,137,129,253,113,119,108,99,92,90,
+94,91,91,68,147,224,119,164,254,205,196,237,254,238,183,144,124,146,74,65,
+58,71,45,42,28,46,87,105,188,169,228,1,27,184,166,69,94,94,69,163,179,117,
+3,123,154,138,68,68,49,78,24,8,159,38,87,80,81,99,50,45,48,40,47,52,90,72,
+105,156,190,155,96,139,43,88,128,136,148,171,187,252,133,142,0,2,253,217,
+1,192,3,59,6,120,0,51,0,52,0,0,19,6,21,20,22,51,50,54,53,52,38,38,35,35,22,
+21,20,6,35,35,39,51,50,54,54,53,52,39,33,53,33,50,4,18,21,20,2,35,34,38,53,
+52,54,51,50,22,21,20,6,35,34,38,3,200,10,105,99,126,138,129,209,208,107,54,
+173,172,70,20,42,87,92,49,68,254,135,2,192,246,1,25,147,235,199,162,189,126,
+101,75,86,65,48,49,62,71,3,96,28,46,86,102,187,176,171,214,93,91,108,144,
+129,159,22,61,52,89,89,159,149,254,235,211,239,254,234,183,144,126,144,74,
+65,58,71,45,3,66,0,2,254,176,2,93,2,151,5,145,0,24,0,35,0,0,1,38,35,34,6,
+7,51,50,22,21,20,6,35,34,38,53,53,33,53,33,54,54,51,50,23,1,21,20,22,51,50,
+53,52,38,38,35,2,63,87,92,85,112,26,55,188,175,150,128,148,167,254,178,1,
+96,38,208,151,137,113,254,0,88,78,119,43,72,71,4,209,47,75,75,150,125,118,
+132,191,168,7,159,143,152,63,254,121,15,100,113,107,42,56,23,0,3,0,75,255,
+232,3,16,4,130,0,17,0,27,0,28,0,0,19,22,22,23,7,38,2,53,52,18,51,50,22,21,
+20,6,35,34,39,22,51,50,54,53,52,35,34,6,1,238,11,203,192,89,236,244,230,180,
+140,159,191,166,104,80,76,92,100,107,140,84,131,1,185,2,104,159,242,84,155,
+114,1,93,223,222,1,14,149,125,138,171,200,56,82,76,137,129,253,29,0,5,253,
+146,252,175,1,89,1,160,0,38,0,48,0,49,0,50,0,51,0,0,23,22,21,20,4,35,34,38,
+53,52,54,51,50,22,21,20,6,35,34,39,22,22,51,50,54,53,52,39,54,54,53,52,38,
+39,55,22,22,21,20,1,22,51,50,53,52,38,35,34,6,19,23,1,249,96,254,243,250,
+209,239,175,135,114,124,134,129,74,59,23,146,123,173,194,133,65,47,58,63,
+109,88,86,252,218,50,64,143,51,46,64,85,201,175,1,17,85,138,180,215,231,215,
+179,144,188,116,100,106,113,23,87,88,161,150,173,146,51,83,51,57,98,47,109,
+71,144,89,116,254,110,25,95,39,47,82,1,76,113,1,134,0,4,0,84,255,232,6,155,
+4,130,0,52,0,63,0,74,0,75,0,0,37,6,6,35,34,2,17,52,18,54,51,50,22,21,20,6,
+35,34,39,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,39,6,35,34,38,53,
+52,54,51,50,22,18,21,16,2,35,34,38,1,22,51,50,54,53,52,38,35,34,6,5,38,38,
+35,34,6,21,20,22,51,50,1,3,119,67,166,138,198,234,121,207,126,134,156,190,
+164,120,97,5,137,125,126,152,17,157,16,151,128,124,138,6,99,117,164,190,157,
+134,130,208,115,234,198,140,167,253,101,77,99,101,106,73,61,80,134,4,145,
+34,133,81,61,73,106,101,96,253,215,160,96,88,1,31,1,3,196,1,33,147,149,126,
+141,168,63,54,62,187,192,132,129,126,135,192,187,62,54,63,168,141,125,150,
+155,254,226,191,254,253,254,225,89,2,199,62,83,75,65,73,120,114,112,122,73,
+65,75,83,1,160,0,0,4,0,56,255,232,12,67,6,120,0,132,0,145,0,158,0,159,0,0,
+37,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,54,53,52,38,
+39,22,21,20,6,35,34,38,53,52,54,51,50,22,18,21,20,7,22,22,51,50,54,53,52,
+2,39,35,53,51,50,54,54,53,52,39,55,22,22,21,20,6,7,4,17,20,6,7,22,22,51,50,
+54,53,52,39,38,53,52,54,54,51,50,4,18,21,20,2,35,34,38,53,52,54,51,50,22,
+21,20,6,35,34,38,39,6,21,20,22,51,50,54,53,52,2,35,34,6,21,20,23,22,21,20,
+6,35,34,38,1,38,35,34,6,21,20,22,51,50,54,53,52,3,54,53,52,38,35,34,6,21,
+20,22,51,50,1,5,248,57,174,116,110,200,89,67,199,133,143,176,163,129,119,
+142,12,61,63,65,61,6,150,124,120,159,176,143,157,236,127,39,77,158,92,123,
+139,213,190,110,230,106,108,53,133,133,84,82,139,133,1,34,9,9,66,132,79,87,
+88,9,9,128,236,150,184,1,14,142,232,202,161,190,128,99,75,86,65,48,49,62,
+6,10,105,99,123,141,225,198,167,184,8,8,188,152,94,172,251,122,38,43,72,83,
+67,61,68,73,33,41,71,60,68,70,83,72,40,1,94,136,80,80,90,91,91,90,153,116,
+121,144,137,114,40,45,52,197,135,110,193,64,27,27,114,137,146,119,116,153,
+163,254,229,141,146,119,85,79,156,137,188,1,32,64,159,22,63,53,131,130,89,
+94,170,100,108,150,18,196,254,170,39,75,37,76,74,92,90,94,91,91,68,147,224,
+119,164,254,205,196,237,254,238,183,144,124,146,74,65,58,71,45,42,28,46,87,
+105,188,169,228,1,27,184,166,69,94,94,69,163,179,79,3,182,9,71,57,60,66,67,
+63,59,252,194,64,55,63,67,65,61,57,71,6,5,0,1,0,56,255,232,9,246,4,130,0,
+95,0,0,1,16,0,33,34,38,53,52,54,55,62,2,53,52,38,35,34,6,7,35,38,38,35,34,
+6,21,20,22,23,7,38,53,52,54,51,50,23,54,51,50,22,21,20,6,7,14,2,21,20,33,
+32,36,53,52,38,39,55,33,50,4,18,21,20,2,35,34,38,53,52,54,51,50,22,21,20,
+6,35,34,38,39,6,21,20,22,51,50,54,53,52,38,38,35,33,22,6,119,254,122,254,
+173,229,249,156,185,124,107,52,76,66,76,105,25,161,27,102,68,67,75,19,15,
+155,47,171,129,185,101,106,194,138,160,156,209,113,99,48,1,64,1,5,1,35,68,
+80,88,1,195,246,1,17,153,227,207,161,190,126,101,75,86,65,48,49,62,6,10,105,
+99,127,137,128,202,212,254,238,90,2,79,254,224,254,185,177,162,117,148,46,
+31,52,77,61,69,76,111,108,108,113,78,65,33,77,27,51,94,109,126,162,181,181,
+167,140,134,162,56,30,44,59,43,181,236,213,124,201,109,109,142,254,237,220,
+248,254,243,183,144,126,144,74,65,58,71,45,42,28,46,87,105,188,179,175,209,
+94,180,0,2,253,56,252,86,1,50,255,143,0,50,0,51,0,0,19,6,6,21,20,22,51,50,
+54,55,23,6,35,34,38,53,52,54,55,54,53,52,38,35,34,7,35,38,38,35,34,6,21,20,
+23,7,38,53,52,54,51,50,22,23,54,51,50,22,21,20,6,5,183,111,103,70,53,44,74,
+51,45,109,111,121,143,130,126,24,69,51,128,27,146,11,69,52,49,54,26,146,38,
+124,115,70,109,48,85,146,120,150,39,254,41,253,185,12,63,55,44,49,17,27,122,
+54,128,104,94,124,26,37,59,52,66,139,65,73,55,52,49,55,37,88,91,96,109,49,
+58,107,138,118,52,119,214,0,0,2,253,56,251,205,1,88,255,143,0,66,0,67,0,0,
+19,6,6,21,20,22,51,50,54,55,23,6,35,34,39,6,21,20,22,51,50,54,55,23,6,35,
+34,38,53,52,55,38,53,52,54,55,54,53,52,38,35,34,7,35,38,38,35,34,6,21,20,
+23,7,38,53,52,54,51,50,22,23,54,51,50,22,21,20,1,219,120,121,65,58,46,72,
+44,45,96,117,36,33,12,65,58,46,72,44,45,96,117,120,144,25,61,136,131,4,69,
+51,128,27,146,11,69,52,49,54,26,146,38,124,115,70,109,48,85,146,120,150,253,
+171,253,250,8,52,50,36,38,20,23,125,50,6,15,26,36,38,20,23,125,50,114,93,
+57,43,56,85,89,114,17,16,25,52,66,139,65,73,55,52,49,55,37,88,91,96,109,49,
+58,107,138,118,73,254,200,0,2,0,110,255,232,5,18,5,158,0,15,0,27,0,0,1,50,
+4,18,21,20,2,4,35,34,36,2,53,52,18,36,19,50,18,17,16,2,35,34,2,17,16,18,2,
+190,185,1,13,142,142,254,243,185,182,254,244,142,142,1,10,184,195,220,225,
+196,186,219,225,5,158,183,254,176,208,215,254,173,181,181,1,79,210,219,1,
+83,178,250,240,1,42,1,15,1,10,1,39,254,210,254,244,254,249,254,215,0,0,3,
+0,110,255,229,5,18,5,158,0,25,0,26,0,27,0,0,37,7,38,2,53,52,18,36,51,50,4,
+18,21,16,1,39,54,18,53,52,2,35,34,2,21,16,1,39,2,13,147,139,129,146,1,13,
+179,185,1,12,141,254,244,147,112,122,218,195,195,218,1,153,82,75,102,180,
+1,115,205,205,1,72,176,176,254,187,209,254,101,254,168,102,143,1,85,177,247,
+1,33,254,223,247,254,140,254,148,139,0,0,1,0,62,0,0,5,23,5,158,0,36,0,0,51,
+53,33,50,54,54,53,52,2,35,34,6,21,20,22,51,50,53,55,22,21,20,6,35,34,38,53,
+52,54,51,50,0,17,16,2,4,33,62,1,177,255,228,144,174,154,109,117,61,55,103,
+152,5,131,127,134,159,220,183,234,1,17,161,254,204,254,246,168,91,248,229,
+251,1,35,109,98,69,71,116,10,16,39,100,127,163,139,165,196,254,142,254,192,
+254,253,254,180,157,0,2,0,125,255,232,5,107,5,158,0,54,0,65,0,0,1,54,53,52,
+38,35,34,6,21,20,22,51,50,54,53,55,22,21,20,6,35,34,38,53,52,54,51,50,18,
+17,20,7,23,30,2,51,50,55,23,6,35,34,38,39,6,35,34,38,53,52,54,51,50,22,23,
+38,38,35,34,6,21,20,22,51,50,3,0,29,149,141,77,95,53,48,48,44,147,6,126,116,
+121,158,193,159,220,243,81,41,54,79,79,60,59,72,49,81,99,140,164,98,137,215,
+154,174,190,155,84,136,20,59,115,66,78,93,85,79,154,2,25,115,134,247,245,
+93,69,57,65,38,53,10,15,35,87,116,153,127,138,178,254,175,254,227,237,185,
+62,82,76,32,32,159,39,117,153,175,155,143,138,168,58,229,72,62,81,70,69,73,
+0,5,0,77,255,232,5,51,5,158,0,39,0,50,0,62,0,63,0,64,0,0,19,22,22,23,54,54,
+53,52,38,39,55,22,18,21,20,2,7,22,21,20,6,35,34,38,53,52,55,38,2,53,52,54,
+51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,38,35,34,6,1,6,6,21,20,22,51,
+50,54,53,52,38,7,19,254,17,250,233,189,208,118,124,110,147,165,188,178,121,
+184,162,165,180,96,207,207,226,188,134,156,175,170,96,79,70,82,94,97,67,58,
+85,114,1,205,80,97,90,86,84,93,89,74,115,3,161,166,199,33,52,219,141,112,
+170,69,144,78,255,0,148,165,254,250,83,73,129,125,143,144,124,125,63,75,1,
+24,204,199,248,134,124,136,147,183,31,69,66,49,56,107,252,233,10,78,54,57,
+66,68,57,51,73,12,3,139,0,6,0,60,255,232,5,85,5,158,0,55,0,66,0,76,0,77,0,
+78,0,79,0,0,1,38,38,53,52,54,51,50,18,19,55,38,53,52,54,51,50,22,21,20,6,
+7,22,22,21,20,6,7,39,54,54,53,52,38,39,7,22,21,16,2,35,34,38,53,52,36,37,
+38,38,35,34,6,21,20,22,23,5,54,54,53,52,38,35,34,6,21,20,1,6,6,21,20,22,51,
+50,54,53,37,19,55,1,107,153,150,172,135,167,195,28,137,92,154,131,131,147,
+122,122,89,74,70,81,153,68,57,62,80,197,2,204,200,140,163,1,7,1,2,20,113,
+89,59,71,77,75,2,140,77,77,57,49,55,67,254,142,169,187,75,65,109,108,1,10,
+51,25,3,71,15,153,140,132,159,254,202,254,203,32,159,129,136,163,160,135,
+124,184,60,131,210,106,98,163,91,123,64,114,68,99,154,125,52,57,61,254,224,
+254,223,174,142,169,246,70,249,255,72,66,65,73,4,98,41,119,78,67,73,77,63,
+113,254,107,53,158,121,76,82,204,208,117,253,106,133,0,2,0,127,0,0,5,66,5,
+158,0,45,0,58,0,0,1,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,22,51,33,21,
+33,34,46,2,53,52,54,55,55,54,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,7,
+6,21,20,22,51,50,54,53,52,38,35,34,2,57,57,42,168,178,170,157,146,171,7,65,
+124,196,191,2,25,253,240,196,242,171,82,137,126,18,14,11,47,45,50,71,37,92,
+105,109,117,22,59,4,84,85,71,77,95,91,63,3,252,10,152,127,130,151,152,127,
+93,133,136,163,56,168,52,140,197,124,144,232,68,66,55,66,28,49,51,20,151,
+35,112,100,55,101,220,20,32,90,84,66,56,60,67,0,0,2,0,129,0,0,5,66,5,158,
+0,42,0,43,0,0,37,21,33,34,38,38,53,52,54,55,62,2,53,52,38,35,34,6,21,20,22,
+23,7,34,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,22,51,3,5,66,252,252,
+191,177,77,158,175,128,130,46,99,82,72,100,61,59,17,124,154,192,160,167,190,
+149,211,154,123,81,140,130,59,168,168,104,158,97,122,202,92,67,107,98,61,
+79,91,70,62,43,56,4,154,147,121,121,160,171,157,139,205,116,85,134,72,74,
+91,26,1,191,0,0,2,0,105,255,232,5,91,5,158,0,48,0,59,0,0,1,6,21,20,18,22,
+51,50,54,53,52,38,39,38,38,53,52,54,54,51,51,21,35,34,6,21,20,22,23,22,21,
+20,0,35,34,36,2,53,52,18,54,51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,38,
+35,34,6,1,33,6,111,216,156,170,184,51,43,46,49,77,135,125,103,101,99,58,25,
+68,93,254,226,242,208,254,213,159,110,206,131,132,146,175,170,103,63,61,82,
+96,95,56,55,72,117,3,166,54,61,195,254,199,169,176,155,82,178,104,108,162,
+73,76,112,46,171,38,41,35,95,164,225,172,237,254,252,205,1,137,245,192,1,
+23,148,138,123,134,146,178,26,66,69,49,55,109,0,0,2,0,156,0,0,5,69,5,134,
+0,43,0,54,0,0,1,6,21,20,22,51,51,21,35,34,36,53,52,54,55,38,38,53,52,62,2,
+51,33,21,33,34,14,2,21,20,23,54,54,51,50,22,21,20,6,35,34,38,55,22,22,51,
+50,54,53,52,35,34,6,1,79,17,170,167,38,21,232,254,228,37,38,38,37,80,169,
+217,183,2,32,254,10,166,176,122,58,16,67,164,97,136,146,158,149,91,154,20,
+46,116,70,63,69,131,63,123,2,65,47,55,150,153,172,246,210,68,124,56,61,129,
+68,107,172,124,49,168,32,80,121,83,54,48,56,57,125,115,113,127,58,180,42,
+42,43,43,86,47,0,3,0,33,0,0,4,72,4,106,0,9,0,20,0,31,0,0,1,1,21,33,53,1,1,
+53,33,21,1,55,54,55,6,35,35,34,39,22,23,19,7,6,7,54,51,33,50,23,38,39,2,151,
+1,177,251,217,1,165,254,110,3,235,254,20,170,30,27,32,89,220,88,27,20,38,
+163,183,39,34,26,78,1,71,54,29,23,41,2,76,253,240,60,60,2,6,1,236,60,60,254,
+149,210,37,27,4,4,16,46,254,52,229,49,32,4,4,18,52,0,6,0,67,0,0,5,192,4,106,
+0,11,0,23,0,35,0,47,0,48,0,49,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,50,
+54,53,52,38,35,34,6,21,20,22,1,50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,
+52,38,35,34,6,21,20,22,3,19,1,145,158,174,182,156,153,175,180,151,88,95,95,
+83,88,95,96,3,56,158,174,182,156,153,175,180,151,88,95,95,83,88,95,96,253,
+10,3,111,188,165,159,192,186,164,160,194,253,203,113,99,100,115,112,100,101,
+114,2,53,188,165,159,192,186,164,160,194,253,203,113,99,100,115,112,100,101,
+114,3,48,251,150,0,4,255,171,253,14,0,54,6,120,0,3,0,4,0,5,0,6,0,0,3,17,51,
+17,11,2,54,108,25,59,55,254,173,7,160,248,96,7,203,246,150,2,242,0,0,4,254,
+213,253,14,1,43,6,120,0,14,0,15,0,16,0,17,0,0,19,23,7,39,17,35,17,7,39,55,
+39,55,23,55,23,37,19,3,74,225,75,170,108,170,75,225,225,75,224,224,75,254,
+155,43,80,5,43,220,73,169,249,255,6,1,169,73,220,217,73,220,220,74,117,246,
+150,2,242,0,0,10,0,145,0,0,4,15,4,106,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,
+63,0,64,0,65,0,0,1,34,53,52,51,50,21,20,5,34,53,52,51,50,21,20,33,34,53,52,
+51,50,21,20,19,34,53,52,51,50,21,20,33,34,53,52,51,50,21,20,19,34,53,52,51,
+50,21,20,33,34,53,52,51,50,21,20,5,34,53,52,51,50,21,20,3,19,2,79,64,64,66,
+254,166,64,64,65,1,240,64,64,65,36,65,65,66,252,195,65,65,65,36,64,64,65,
+1,240,64,64,65,254,166,64,64,66,235,25,3,87,65,64,64,65,112,65,64,64,65,65,
+64,64,65,254,242,65,65,65,65,65,65,65,65,254,243,65,64,64,65,65,64,64,65,
+113,65,65,65,65,4,15,251,150,0,1,0,66,0,0,4,107,4,106,0,40,0,0,1,34,14,2,
+21,20,22,22,51,51,21,35,34,14,2,21,20,22,51,51,21,35,34,38,38,53,52,54,55,
+38,38,53,52,62,2,51,33,21,2,80,105,124,86,43,61,122,126,236,198,97,113,80,
+42,116,129,13,10,159,168,89,70,77,81,81,56,122,171,158,2,46,3,203,8,39,64,
+51,54,76,34,159,10,41,62,46,81,84,162,73,141,98,81,119,47,46,137,91,61,118,
+85,33,159,0,255,255,0,56,254,140,5,247,4,130,2,34,0,27,0,0,0,3,0,55,5,37,
+0,0,0,8,0,63,254,140,6,5,6,120,0,16,0,63,0,75,0,79,0,91,0,103,0,104,0,105,
+0,0,19,53,33,50,54,54,53,52,39,55,22,22,21,20,6,6,35,23,22,17,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,
+22,51,32,19,51,22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,38,53,52,
+54,3,19,51,19,55,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,
+53,52,54,1,3,63,4,21,106,108,53,133,133,84,82,73,160,163,200,196,201,158,
+119,154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,
+1,2,23,157,9,132,108,100,106,86,86,254,133,50,70,71,49,49,69,67,26,16,158,
+16,237,50,70,71,49,49,69,67,253,154,50,70,71,49,49,69,67,1,26,70,3,203,159,
+22,63,53,131,130,89,94,170,100,75,129,79,81,215,254,243,202,228,76,108,92,
+92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,131,
+123,107,195,99,56,70,51,50,70,71,49,49,72,251,137,1,69,254,187,163,70,51,
+50,70,71,49,49,72,70,51,50,70,71,49,49,72,6,251,249,23,0,0,4,254,240,253,
+14,1,190,0,198,0,24,0,36,0,37,0,38,0,0,1,22,21,20,6,35,34,38,53,52,55,7,53,
+33,54,53,52,39,55,22,21,20,7,51,21,33,34,6,21,20,22,51,50,54,53,52,38,1,23,
+1,49,93,165,156,147,164,95,133,1,51,60,61,152,65,59,254,254,148,84,88,89,
+83,83,90,91,254,248,13,254,168,56,116,115,123,125,110,114,61,4,132,71,93,
+96,111,43,119,118,88,89,132,76,64,64,70,71,63,66,74,1,92,113,0,0,3,253,24,
+253,14,1,69,0,142,0,48,0,58,0,59,0,0,1,38,53,52,54,51,50,22,21,20,7,22,22,
+51,50,54,53,52,38,39,55,22,17,20,6,35,34,38,39,6,35,34,38,53,52,54,51,50,
+22,23,54,53,52,38,35,34,21,20,23,23,38,38,35,34,21,20,22,51,50,19,253,100,
+15,130,106,143,168,40,40,78,47,96,83,74,71,137,165,167,158,62,115,77,98,161,
+112,119,107,92,55,108,89,11,87,75,94,6,170,62,73,35,75,53,48,87,119,254,129,
+45,43,83,99,163,125,89,80,25,27,116,114,117,245,104,68,250,254,240,186,188,
+37,50,87,92,89,71,91,35,53,37,50,78,92,80,24,18,231,40,26,48,26,28,2,119,
+0,2,253,170,253,14,0,142,255,143,0,19,0,20,0,0,19,35,53,52,38,35,34,6,21,
+21,35,53,52,54,54,51,50,22,22,21,5,142,157,117,93,104,112,157,96,165,109,
+110,164,96,254,114,253,28,115,212,168,178,204,113,114,191,213,109,111,211,
+188,131,0,7,252,163,252,166,1,241,0,251,0,63,0,67,0,68,0,69,0,70,0,71,0,72,
+0,0,55,22,23,22,51,50,54,53,52,38,39,55,22,21,20,6,35,34,39,22,21,20,6,35,
+34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,
+22,51,50,54,55,51,22,22,51,50,53,52,38,39,1,55,51,23,3,23,37,5,3,63,32,34,
+44,70,50,48,45,57,114,144,130,106,34,32,17,148,144,148,80,50,126,90,123,164,
+123,102,84,97,22,119,9,28,32,35,43,85,75,83,98,10,135,7,81,62,144,63,63,254,
+196,10,140,10,133,42,2,57,254,190,35,31,40,67,59,53,43,47,87,49,107,131,154,
+114,117,9,58,64,145,151,117,62,55,141,112,99,123,78,67,56,33,10,24,21,23,
+32,48,47,63,60,81,78,79,81,165,80,174,84,252,205,214,214,3,90,33,145,220,
+253,122,0,0,3,253,35,253,14,1,2,255,143,0,67,0,79,0,80,0,0,19,22,21,20,6,
+35,34,39,6,6,35,34,38,53,52,54,55,54,54,53,52,35,34,21,20,23,7,38,53,52,54,
+51,50,22,23,54,51,50,22,21,20,7,39,54,53,52,35,34,7,6,6,7,6,6,21,20,51,50,
+54,55,51,22,51,50,54,53,52,39,39,50,22,21,20,6,35,34,38,53,52,54,7,229,29,
+127,117,148,86,48,119,77,103,114,76,93,57,52,82,105,12,129,26,133,114,76,
+101,25,110,139,114,127,13,135,6,110,128,93,8,60,64,90,47,79,66,85,24,139,
+33,107,56,60,15,238,36,51,52,35,34,51,50,246,254,102,64,68,99,113,118,61,
+57,94,78,64,92,46,28,44,25,49,62,26,22,42,53,60,70,90,38,39,77,96,88,47,43,
+19,26,25,78,83,41,62,33,46,40,26,52,57,66,123,50,43,37,36,148,48,36,36,48,
+49,35,35,49,193,0,3,253,15,253,14,1,62,0,198,0,67,0,68,0,69,0,0,3,22,22,51,
+50,54,53,52,39,35,53,51,54,53,52,39,55,22,21,20,7,51,21,39,22,21,20,6,35,
+34,38,39,6,35,34,38,53,52,54,55,54,54,53,52,35,34,21,20,23,7,38,53,52,54,
+51,50,21,20,6,7,6,6,21,20,51,50,54,55,19,3,162,16,78,65,68,69,103,166,170,
+60,61,152,65,59,126,118,79,148,125,82,116,41,93,158,103,114,76,93,57,52,82,
+105,12,129,26,133,114,226,70,72,79,55,79,73,92,11,80,196,254,39,77,72,58,
+55,108,53,132,71,93,96,111,43,119,118,88,89,132,4,73,101,108,128,57,61,118,
+94,78,64,92,46,28,44,25,49,62,26,22,42,53,60,70,90,166,62,83,36,40,42,28,
+52,78,71,1,217,254,11,0,5,252,254,252,86,1,69,0,142,0,39,0,49,0,53,0,54,0,
+55,0,0,1,20,22,51,50,54,55,51,22,51,50,54,53,52,38,39,55,22,17,20,6,35,34,
+39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,39,22,51,50,53,52,38,35,34,
+6,1,55,51,23,3,37,253,138,77,88,75,93,10,139,24,125,80,87,77,68,137,165,163,
+152,148,79,52,120,85,134,162,171,134,99,107,118,111,80,44,46,63,108,39,35,
+50,75,1,41,10,140,10,101,1,105,254,65,83,92,79,70,149,106,138,106,251,95,
+68,246,254,246,187,197,118,62,56,167,146,143,185,98,84,88,98,147,29,68,29,
+31,51,253,116,214,214,3,170,10,0,2,253,35,253,14,1,2,255,144,0,66,0,67,0,
+0,19,22,21,20,6,35,34,39,6,6,35,34,38,53,52,54,55,54,54,53,52,35,34,21,20,
+23,7,38,53,52,54,51,50,22,23,22,51,50,54,53,52,39,55,22,21,20,6,35,34,39,
+6,7,6,6,21,20,51,50,55,51,22,51,50,54,53,52,39,5,214,44,127,117,148,86,48,
+119,77,103,114,76,93,57,52,82,105,12,129,26,133,114,77,102,24,93,108,55,61,
+14,136,20,120,108,126,97,23,101,90,47,79,147,28,139,22,118,57,59,29,254,7,
+254,131,73,88,99,113,118,61,57,94,78,64,92,46,28,44,25,49,62,26,22,42,53,
+60,70,90,39,40,95,41,41,30,39,24,44,60,92,103,63,58,52,46,40,26,52,139,139,
+50,44,52,45,70,0,0,3,252,82,252,86,2,94,255,145,0,51,0,63,0,67,0,0,19,6,6,
+35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,
+38,39,55,4,21,20,7,22,22,51,50,54,53,52,38,39,55,4,21,20,6,35,34,1,34,6,21,
+20,22,51,50,54,53,52,38,1,55,51,23,96,36,104,69,69,127,57,45,122,77,158,174,
+179,149,102,149,78,17,37,81,52,71,75,90,112,80,1,11,8,36,78,50,71,75,90,112,
+80,1,11,143,129,128,252,203,85,97,98,86,84,99,96,2,37,10,140,10,253,99,42,
+43,49,48,48,49,181,143,140,177,81,148,84,69,49,38,40,71,67,81,121,53,118,
+129,232,40,38,35,37,71,67,81,121,53,118,129,232,131,151,1,253,99,88,88,102,
+98,86,91,102,253,75,214,214,0,0,2,252,114,252,168,1,134,255,143,0,68,0,79,
+0,0,1,38,53,52,54,51,50,22,23,54,51,50,22,23,54,51,50,22,21,20,7,39,54,54,
+53,52,38,35,34,7,22,21,20,6,7,22,23,7,38,39,6,6,35,34,38,53,52,54,51,50,22,
+23,54,54,53,52,38,35,34,7,35,38,38,35,34,6,21,20,23,5,38,38,35,34,21,20,22,
+51,50,54,252,144,30,127,94,74,105,44,79,142,67,102,35,90,123,95,123,30,133,
+7,10,50,44,80,58,6,53,52,44,21,144,13,24,60,140,80,132,142,137,124,100,164,
+64,22,21,70,67,111,24,139,10,72,53,43,50,17,1,221,43,111,68,121,73,76,57,
+97,254,61,69,78,85,106,52,55,107,46,46,92,108,83,78,69,34,15,50,15,42,50,
+93,33,38,69,134,51,73,94,26,68,48,30,31,103,90,83,98,65,66,30,70,40,84,89,
+123,59,64,50,42,40,40,223,45,45,59,34,32,18,0,3,252,239,253,14,1,32,0,198,
+0,53,0,63,0,64,0,0,1,20,22,51,50,54,55,51,22,51,50,54,53,52,38,39,35,53,51,
+50,54,54,53,52,39,55,22,21,20,7,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+54,51,50,22,21,20,6,35,34,39,22,51,50,53,52,38,35,34,6,1,253,123,77,88,75,
+93,10,139,24,137,69,75,66,63,154,88,59,61,34,72,152,76,79,110,152,126,78,
+127,37,52,120,85,134,162,171,134,99,107,118,111,80,44,46,63,108,39,35,50,
+75,1,80,254,65,83,92,79,70,149,66,61,56,84,21,132,16,50,46,101,144,43,159,
+139,115,66,76,136,126,135,63,55,62,56,167,146,143,185,98,84,88,98,147,29,
+68,29,31,51,1,30,0,0,3,253,163,253,14,0,141,255,143,0,11,0,23,0,35,0,0,19,
+20,6,35,34,38,53,52,54,51,50,22,37,34,6,21,20,22,51,50,54,53,52,38,7,50,22,
+21,20,6,35,34,38,53,52,54,141,202,170,171,203,211,162,168,205,254,142,104,
+127,123,106,107,120,125,104,36,51,52,35,34,51,50,254,71,142,171,170,150,153,
+168,173,41,104,85,88,100,104,84,85,104,103,48,36,36,48,49,35,35,49,0,0,3,
+253,71,253,14,0,239,255,143,0,20,0,45,0,54,0,0,19,22,21,20,6,35,34,38,39,
+6,35,34,38,53,52,54,54,51,50,22,23,5,51,22,51,50,54,55,6,35,34,38,53,52,54,
+55,38,35,35,34,6,21,20,51,50,54,37,38,35,34,6,21,20,51,50,192,47,139,109,
+84,111,38,71,153,106,125,115,212,129,192,232,9,254,8,139,34,119,55,67,6,52,
+64,79,97,88,80,81,103,40,145,167,107,46,64,1,155,29,47,25,29,54,55,254,137,
+55,91,102,131,56,63,119,146,121,115,169,90,144,114,138,115,51,47,33,78,67,
+59,73,3,37,135,109,136,52,157,38,21,17,38,0,4,253,71,252,86,0,239,255,143,
+0,20,0,45,0,54,0,58,0,0,19,22,21,20,6,35,34,38,39,6,35,34,38,53,52,54,54,
+51,50,22,23,5,51,22,51,50,54,55,6,35,34,38,53,52,54,55,38,35,35,34,6,21,20,
+51,50,54,37,38,35,34,6,21,20,51,50,1,55,51,23,192,47,139,109,84,111,38,71,
+153,106,125,115,212,129,192,232,9,254,8,139,34,119,55,67,6,52,64,79,97,88,
+80,81,103,40,145,167,107,46,64,1,155,29,47,25,29,54,55,254,135,10,140,10,
+254,137,55,91,102,131,56,63,119,146,121,115,169,90,144,114,138,115,51,47,
+33,78,67,59,73,3,37,135,109,136,52,157,38,21,17,38,254,25,214,214,0,0,2,253,
+13,253,1,1,68,255,143,0,74,0,75,0,0,19,39,54,53,52,38,35,34,6,21,20,51,50,
+54,53,53,52,38,35,34,6,7,35,38,35,34,21,20,22,51,51,21,35,34,6,21,20,51,50,
+55,23,6,35,34,38,53,52,55,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,
+35,34,38,53,52,54,51,50,22,21,20,5,97,107,2,19,21,22,28,119,78,80,104,91,
+64,87,12,138,17,144,126,47,85,37,41,84,51,94,70,57,69,100,119,103,112,115,
+107,137,115,81,110,54,51,118,84,151,170,160,149,110,130,99,82,71,84,254,122,
+253,186,5,12,13,17,26,30,28,73,90,88,7,95,115,65,59,124,74,25,49,122,35,31,
+59,46,110,63,87,77,104,44,53,106,80,103,50,60,58,52,186,163,144,161,107,91,
+79,100,65,55,43,201,0,0,4,252,109,253,132,0,206,0,0,0,14,0,26,0,27,0,28,0,
+0,1,53,33,38,53,52,54,51,50,22,21,20,6,6,35,55,51,50,54,53,52,38,35,34,6,
+21,20,3,39,252,109,2,77,22,150,129,126,149,105,173,170,64,46,100,88,69,56,
+61,73,29,8,253,132,153,62,66,105,146,142,111,101,126,52,153,60,67,47,66,76,
+60,52,1,62,113,0,4,253,81,252,86,0,223,255,143,0,17,0,34,0,46,0,50,0,0,3,
+6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,55,22,51,50,53,52,38,35,35,
+34,6,21,20,51,50,54,55,55,50,22,21,20,6,35,34,38,53,52,54,3,55,51,23,232,
+41,107,76,108,123,250,206,204,250,121,109,85,103,32,35,100,106,160,135,25,
+134,166,107,47,69,17,69,36,51,52,35,34,51,50,44,10,140,10,253,132,63,55,149,
+118,169,205,208,165,117,151,58,183,109,130,109,138,134,109,134,56,53,198,
+48,36,36,48,49,35,35,49,253,145,214,214,0,2,253,81,253,14,0,223,255,143,0,
+17,0,34,0,0,3,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,55,22,22,51,
+50,53,52,38,35,35,34,6,21,20,51,50,55,232,41,107,76,108,123,250,206,204,250,
+121,109,85,103,32,12,71,52,106,160,135,25,134,166,107,106,27,253,132,63,55,
+149,118,169,205,208,165,117,151,58,223,72,77,130,109,138,134,109,134,149,
+0,0,3,253,81,252,86,0,223,255,143,0,17,0,34,0,38,0,0,3,6,6,35,34,38,53,52,
+54,51,50,22,21,20,6,35,34,38,55,22,22,51,50,53,52,38,35,35,34,6,21,20,51,
+50,55,3,55,51,23,232,41,107,76,108,123,250,206,204,250,121,109,85,103,32,
+12,71,52,106,160,135,25,134,166,107,106,27,10,10,140,10,253,132,63,55,149,
+118,169,205,208,165,117,151,58,223,72,77,130,109,138,134,109,134,149,254,
+47,214,214,0,0,5,253,121,253,14,1,75,0,142,0,35,0,46,0,47,0,48,0,49,0,0,19,
+54,54,53,52,39,55,22,22,21,20,6,7,22,22,51,50,54,55,23,6,6,35,34,38,39,6,
+35,34,38,53,52,54,51,50,22,7,38,38,35,34,6,21,20,22,51,50,19,55,55,1,41,41,
+60,134,38,45,84,84,30,71,58,15,52,7,26,16,64,20,96,126,53,126,149,156,172,
+155,123,119,158,16,66,117,70,60,71,93,92,111,65,1,87,254,111,46,112,66,144,
+107,68,54,161,82,115,184,69,47,41,8,5,138,8,10,74,87,57,148,121,111,135,110,
+234,116,95,63,50,65,71,1,148,113,10,0,5,252,249,253,14,1,65,0,142,0,46,0,
+47,0,48,0,49,0,50,0,0,3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,
+38,35,34,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,55,22,21,20,
+6,35,34,1,5,23,19,222,50,126,90,123,164,123,102,84,97,22,119,9,28,32,35,43,
+85,75,83,98,10,135,7,81,62,80,87,77,68,137,165,163,152,148,1,44,254,48,62,
+189,253,211,62,55,141,112,99,123,78,67,56,33,10,24,21,23,32,48,47,63,60,81,
+78,79,81,94,122,93,222,85,68,223,243,171,179,2,172,10,33,253,47,0,0,6,252,
+249,252,166,1,65,0,142,0,46,0,47,0,48,0,49,0,50,0,54,0,0,3,6,6,35,34,38,53,
+52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,50,54,55,51,22,
+22,51,50,54,53,52,38,39,55,22,21,20,6,35,34,1,5,23,1,5,55,51,23,222,50,126,
+90,123,164,123,102,84,97,22,119,9,28,32,35,43,85,75,83,98,10,135,7,81,62,
+80,87,77,68,137,165,163,152,148,1,32,254,3,133,1,26,254,159,10,140,10,253,
+211,62,55,141,112,99,123,78,67,56,33,10,24,21,23,32,48,47,63,60,81,78,79,
+81,94,122,93,222,85,68,223,243,171,179,2,172,10,33,253,47,104,214,214,0,4,
+253,29,253,14,1,69,0,142,0,52,0,53,0,54,0,55,0,0,3,22,51,50,54,53,52,38,39,
+55,22,17,20,6,35,34,39,6,35,34,38,53,52,54,55,54,54,53,52,35,34,21,20,23,
+7,38,53,52,54,51,50,21,20,6,7,6,6,21,20,51,50,54,55,19,37,1,148,24,125,80,
+87,77,68,137,165,163,152,150,79,93,158,103,114,76,93,57,52,82,105,12,129,
+26,133,114,226,70,72,79,55,79,73,92,11,21,1,155,253,210,254,39,149,106,138,
+106,251,95,68,246,254,246,187,197,118,118,94,78,64,92,46,28,44,25,49,62,26,
+22,42,53,60,70,90,166,62,83,36,40,42,28,52,78,71,1,217,10,254,1,0,5,253,29,
+252,86,1,69,0,142,0,52,0,56,0,57,0,58,0,59,0,0,3,22,51,50,54,53,52,38,39,
+55,22,17,20,6,35,34,39,6,35,34,38,53,52,54,55,54,54,53,52,35,34,21,20,23,
+7,38,53,52,54,51,50,21,20,6,7,6,6,21,20,51,50,54,55,3,55,51,23,3,55,1,148,
+24,125,80,87,77,68,137,165,163,152,150,79,93,158,103,114,76,93,57,52,82,105,
+12,129,26,133,114,226,70,72,79,55,79,73,92,11,10,10,140,10,63,230,254,64,
+254,39,149,106,138,106,251,95,68,246,254,246,187,197,118,118,94,78,64,92,
+46,28,44,25,49,62,26,22,42,53,60,70,90,166,62,83,36,40,42,28,52,78,71,254,
+47,214,214,3,170,10,254,1,0,0,5,255,101,252,127,2,213,0,255,0,39,0,52,0,53,
+0,54,0,55,0,0,23,55,54,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,55,23,
+6,6,35,34,38,53,52,54,55,54,53,52,38,39,55,22,22,21,20,7,6,21,20,22,51,50,
+54,53,52,38,35,34,19,19,39,249,23,136,169,137,127,116,125,78,143,127,107,
+179,61,114,97,217,148,195,223,130,114,17,45,47,94,80,74,40,5,53,52,49,53,
+61,57,48,5,97,32,114,1,6,113,114,98,112,125,116,3,69,110,101,114,66,64,109,
+84,77,194,159,107,183,44,86,37,56,69,24,130,45,114,80,59,205,30,28,53,55,
+43,34,43,54,253,111,3,129,115,0,4,254,97,252,127,2,14,1,18,0,64,0,65,0,66,
+0,67,0,0,1,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,51,50,54,53,52,38,38,
+39,46,2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,30,2,21,20,6,6,35,34,38,
+53,52,54,55,54,54,53,52,35,34,21,20,23,3,1,254,252,129,26,133,114,112,116,
+77,83,78,40,213,149,167,31,52,58,59,51,31,136,104,219,38,146,25,87,40,47,
+46,45,84,73,38,118,220,136,174,182,64,105,66,43,82,105,178,66,1,167,254,168,
+42,53,60,70,90,87,85,66,86,43,42,46,29,98,122,97,51,87,78,64,65,71,83,45,
+95,111,210,24,104,40,38,33,70,47,88,111,119,68,115,166,85,128,110,65,90,57,
+36,39,26,51,62,26,185,1,251,252,127,0,0,5,253,5,253,14,1,4,0,199,0,15,0,16,
+0,17,0,18,0,19,0,0,1,22,51,50,36,53,52,39,55,22,21,20,0,33,34,39,5,19,39,
+55,253,45,144,152,254,1,13,78,141,101,254,154,254,185,161,177,1,251,25,9,
+189,254,91,38,182,165,123,111,77,134,181,235,255,0,43,190,2,129,113,51,0,
+4,252,240,253,14,1,89,255,143,0,31,0,41,0,51,0,67,0,0,3,6,6,35,34,38,53,52,
+54,51,50,22,21,20,7,55,51,50,23,38,53,52,54,51,50,22,21,20,6,35,34,38,1,38,
+38,35,34,6,21,20,51,50,37,22,51,50,53,52,38,35,34,6,23,34,39,22,22,51,50,
+55,51,22,51,50,54,55,6,35,220,53,123,85,137,166,170,135,99,107,13,23,85,14,
+13,15,109,102,132,168,166,137,87,122,1,98,17,76,50,35,39,108,63,253,1,46,
+63,108,39,35,50,75,106,80,62,1,79,90,133,52,139,50,135,90,79,1,62,80,253,
+132,64,54,166,144,145,186,97,85,38,31,1,1,32,37,86,96,185,146,144,166,56,
+1,108,47,52,31,29,68,29,29,68,29,31,51,195,34,84,91,116,116,91,84,34,0,0,
+4,253,17,253,33,0,223,0,0,0,38,0,39,0,40,0,41,0,0,1,54,54,51,50,22,21,20,
+6,7,39,54,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,22,55,55,3,254,247,58,104,69,114,143,89,105,96,76,69,62,57,65,82,
+4,144,9,81,61,57,62,64,81,96,103,91,144,113,76,97,119,2,57,254,241,79,55,
+149,111,91,163,84,106,59,106,59,54,72,94,82,84,92,67,62,55,100,65,107,84,
+164,94,107,149,54,78,113,253,165,0,7,253,149,252,210,1,47,0,142,0,37,0,47,
+0,58,0,59,0,60,0,61,0,62,0,0,19,22,21,20,6,35,34,38,53,52,55,38,38,53,52,
+54,51,50,22,21,20,35,34,39,22,51,50,54,54,53,52,39,55,22,22,21,20,6,37,22,
+51,50,53,52,35,34,6,21,1,34,6,21,20,22,51,50,53,52,38,19,55,3,19,56,29,119,
+118,107,123,35,131,141,138,116,100,118,217,27,37,76,203,47,153,96,125,137,
+80,64,126,253,103,41,56,108,87,57,61,1,82,36,58,47,49,95,61,12,2,50,189,253,
+183,33,49,70,77,76,70,46,35,29,140,96,103,130,98,78,177,7,41,32,97,84,161,
+176,68,121,181,99,125,166,228,17,68,60,56,49,254,239,30,29,22,29,51,29,30,
+1,220,113,254,44,1,222,0,3,252,229,253,14,1,11,0,216,0,59,0,60,0,61,0,0,3,
+6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,
+50,54,55,51,22,22,51,50,54,53,52,38,39,35,53,33,50,54,53,52,38,39,55,22,21,
+20,7,22,21,20,6,35,34,1,55,242,50,126,90,123,164,123,102,84,97,22,119,9,28,
+32,35,43,85,75,83,98,10,135,8,82,73,65,66,98,91,253,1,2,94,64,42,36,132,102,
+137,153,148,128,153,254,166,208,253,131,62,55,141,112,99,123,78,67,56,33,
+10,24,21,23,32,48,47,63,60,81,78,80,80,68,68,74,122,37,133,50,46,36,101,46,
+57,139,115,138,52,106,167,120,133,2,129,113,0,0,6,255,14,252,242,1,251,0,
+227,0,35,0,50,0,51,0,52,0,53,0,54,0,0,3,38,53,52,54,51,50,23,38,39,55,22,
+22,23,22,22,21,20,6,35,34,38,53,52,54,55,54,54,55,38,35,34,6,21,20,23,37,
+6,6,7,6,6,21,20,22,51,50,54,53,52,38,55,39,39,1,222,13,151,150,52,27,32,94,
+136,78,59,6,99,110,229,210,148,162,97,145,83,65,6,36,57,63,80,6,1,111,17,
+123,116,63,68,83,81,134,160,36,36,2,5,254,217,254,147,42,39,96,96,4,134,121,
+68,114,160,83,43,170,106,161,172,112,102,72,96,42,25,56,50,5,40,34,22,21,
+64,79,97,30,17,40,35,40,34,107,92,48,92,195,113,95,253,183,0,0,5,252,255,
+252,198,1,70,0,0,0,53,0,54,0,55,0,56,0,57,0,0,23,22,18,21,20,7,39,54,53,52,
+39,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,
+34,6,21,20,22,51,50,54,55,51,22,51,50,54,53,52,38,39,37,3,1,23,152,87,87,
+23,142,37,3,52,148,71,104,40,47,124,91,123,164,123,102,84,97,22,119,9,28,
+32,35,43,85,75,83,98,10,135,11,133,66,69,45,58,254,1,6,1,42,172,69,111,254,
+241,160,118,97,23,122,101,19,33,126,55,62,61,56,141,112,99,123,78,67,56,33,
+10,24,21,23,32,48,47,63,60,81,78,160,76,69,59,108,64,133,253,27,2,242,201,
+0,5,253,23,253,14,1,65,0,142,0,36,0,37,0,38,0,39,0,40,0,0,1,7,38,38,53,52,
+54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,21,20,6,35,34,38,38,39,38,
+38,35,34,6,21,20,19,23,37,3,253,254,143,42,46,146,108,83,130,72,71,89,52,
+78,80,80,68,140,165,163,151,69,107,84,59,63,69,42,51,55,167,168,1,150,248,
+253,135,47,50,127,65,102,137,68,105,103,67,98,118,94,225,81,68,223,243,171,
+179,39,73,87,94,53,61,55,87,2,19,33,43,253,4,0,5,253,33,253,14,1,11,255,143,
+0,19,0,31,0,43,0,44,0,45,0,0,3,6,35,34,38,53,52,54,51,50,23,54,51,50,22,21,
+20,6,35,34,1,34,6,21,20,22,51,50,54,53,52,38,1,50,54,53,52,38,35,34,6,21,
+20,22,3,3,236,69,158,128,144,151,129,155,67,70,158,127,145,152,128,156,254,
+237,70,76,74,67,68,77,74,1,98,70,76,74,67,68,77,75,132,4,253,217,113,147,
+122,120,145,112,112,145,123,121,145,1,146,71,62,64,73,73,61,63,73,254,242,
+71,62,62,75,72,61,63,74,1,163,253,127,0,0,3,253,8,253,14,1,89,255,143,0,46,
+0,56,0,66,0,0,3,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,39,20,22,51,
+50,54,55,51,22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,
+38,1,38,38,35,34,6,21,20,51,50,37,22,51,50,53,52,38,35,34,6,208,52,121,83,
+134,162,171,134,99,107,118,111,80,62,77,88,75,93,10,139,10,93,75,88,76,1,
+62,80,111,118,109,103,130,169,162,134,85,120,1,87,17,76,50,35,39,108,63,253,
+25,46,63,108,39,35,50,75,253,132,64,54,168,146,142,185,95,87,88,98,34,83,
+92,79,70,70,79,91,84,34,98,88,85,97,186,141,146,168,56,1,108,47,52,31,29,
+68,29,29,68,29,31,51,0,0,2,0,73,255,232,4,80,4,106,0,29,0,41,0,0,1,35,22,
+21,20,7,33,21,39,22,22,21,20,6,35,34,38,53,52,55,7,53,33,54,53,52,39,33,53,
+33,1,34,6,21,20,22,51,50,54,53,52,38,3,102,188,33,26,1,159,199,73,79,250,
+227,214,248,146,191,1,171,53,34,254,66,3,29,254,229,147,157,156,148,148,157,
+158,3,203,55,50,56,41,143,3,44,142,86,179,202,205,172,174,101,2,143,39,60,
+53,50,159,254,8,134,116,113,127,127,113,118,132,0,0,2,0,52,255,232,6,150,
+4,130,0,11,0,77,0,0,37,38,38,35,34,6,21,20,22,51,50,54,37,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,21,20,23,54,51,50,
+22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,6,7,22,22,51,50,54,53,52,2,39,
+35,53,33,21,35,22,18,2,172,93,146,74,74,82,90,86,94,146,4,31,237,223,104,
+199,122,79,206,126,158,180,169,149,100,186,103,16,17,152,130,88,96,11,23,
+84,48,61,83,70,97,125,185,145,211,241,35,35,110,147,82,137,152,213,190,108,
+1,192,56,146,141,249,74,59,66,54,61,71,59,251,209,255,82,97,90,89,153,137,
+112,148,67,74,51,115,63,181,210,81,74,37,24,79,66,55,62,70,128,108,137,166,
+254,223,241,98,169,71,85,63,156,137,188,1,32,64,159,159,100,254,250,0,1,0,
+96,0,0,4,200,4,106,0,27,0,0,1,21,35,22,18,17,21,35,53,52,46,2,35,34,14,3,
+21,21,35,53,16,18,55,33,53,3,253,57,129,131,185,38,104,137,93,70,109,89,79,
+32,185,133,128,254,244,4,106,159,92,254,184,254,216,255,221,193,251,209,97,
+50,100,193,239,168,221,255,1,30,1,86,88,159,0,3,0,63,254,218,7,192,4,131,
+0,66,0,78,0,82,0,0,1,22,22,51,50,54,53,52,39,33,53,33,55,22,22,21,20,6,35,
+34,39,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,
+53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,37,50,22,
+21,20,6,35,34,38,53,52,54,3,19,51,19,5,74,90,127,86,78,84,114,249,150,6,125,
+22,116,122,170,141,94,64,24,206,151,119,154,69,60,167,151,176,223,172,139,
+109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,97,109,79,83,254,
+123,50,70,71,49,49,69,67,26,16,158,16,3,13,127,88,84,73,138,110,159,25,88,
+220,122,143,160,38,53,59,168,204,76,108,92,92,202,163,142,181,104,87,76,45,
+13,35,31,44,45,93,78,98,113,1,5,125,136,117,86,96,165,83,164,70,51,50,70,
+71,49,49,72,251,137,1,69,254,187,0,0,2,0,56,255,232,6,28,4,130,0,80,0,81,
+0,0,1,22,22,21,20,7,51,21,35,34,39,22,22,21,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,
+6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,38,39,33,53,33,54,53,52,
+39,33,53,33,1,5,53,19,23,28,217,85,53,54,81,74,195,182,117,158,63,59,166,
+139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,162,169,107,156,
+85,70,35,98,89,253,23,157,8,140,111,101,108,105,94,254,253,1,3,53,36,254,
+236,1,176,252,199,3,218,24,68,28,53,44,143,3,67,150,92,163,181,88,96,95,89,
+175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,158,130,
+93,152,100,55,63,69,45,73,78,1,5,124,137,102,92,92,153,49,143,39,60,57,46,
+159,253,146,0,0,3,0,85,254,218,6,106,4,130,0,48,0,59,0,63,0,0,1,4,17,20,6,
+35,34,38,39,6,6,35,34,2,17,52,18,54,51,50,22,21,20,6,35,34,39,6,21,20,22,
+51,50,54,55,51,22,22,51,50,54,53,52,2,39,35,53,33,21,5,22,51,50,54,53,52,
+38,35,34,6,1,19,51,19,5,75,1,31,227,197,112,156,62,65,166,140,198,234,121,
+207,126,134,156,190,164,120,97,5,139,123,122,156,17,157,8,140,111,113,135,
+213,190,110,1,204,251,145,77,99,101,106,73,61,80,134,1,217,16,158,16,3,203,
+195,254,177,213,252,90,94,95,89,1,31,1,3,196,1,33,147,148,127,141,168,63,
+54,62,185,194,137,124,124,137,160,133,188,1,32,64,159,159,195,62,83,75,65,
+73,120,251,96,1,69,254,187,0,2,0,56,255,232,5,247,4,130,0,76,0,77,0,0,1,20,
+6,35,34,39,6,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,39,55,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,
+23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,53,33,22,1,5,95,169,
+151,210,141,21,114,108,85,70,35,98,89,253,23,157,8,139,112,101,108,87,145,
+110,195,182,117,158,63,59,166,139,158,188,56,107,120,111,62,166,82,88,41,
+145,62,181,156,124,156,32,73,162,97,83,87,8,254,179,1,162,91,252,162,3,152,
+133,150,133,63,117,69,55,63,69,45,73,78,1,5,125,136,94,85,113,96,95,140,171,
+158,176,88,96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,
+103,118,154,92,92,89,92,68,65,25,24,159,90,253,236,0,0,4,0,85,254,218,10,
+189,6,120,0,11,0,85,0,89,0,90,0,0,1,34,6,21,20,22,51,50,54,53,52,38,1,20,
+6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,36,38,53,16,55,35,53,33,50,54,54,
+53,52,39,55,22,22,21,20,6,7,22,22,21,20,7,22,22,51,50,54,53,52,2,39,55,22,
+18,21,20,7,22,22,51,50,54,53,52,2,39,35,53,33,21,35,22,18,1,19,51,19,1,2,
+159,188,230,223,193,193,219,230,7,106,222,210,108,195,87,58,178,120,116,207,
+103,79,245,153,171,254,245,145,219,219,2,219,106,108,53,133,133,84,82,119,
+110,119,110,29,81,171,106,121,137,201,201,88,235,247,14,76,160,93,123,139,
+213,190,110,1,194,56,146,141,252,122,16,158,16,250,7,3,203,228,187,193,220,
+227,186,188,227,253,237,209,255,86,86,86,86,99,111,104,106,131,248,165,1,
+45,150,159,22,63,53,131,130,90,94,171,100,100,145,24,82,226,157,100,88,98,
+96,158,135,195,1,28,89,159,117,254,142,231,73,63,85,81,156,137,188,1,32,64,
+159,159,100,254,250,252,121,1,69,254,187,7,158,0,0,3,0,82,255,232,6,64,6,
+120,0,72,0,82,0,83,0,0,37,6,6,35,34,38,53,52,54,55,38,38,53,52,54,55,23,6,
+6,21,20,23,54,51,50,22,21,20,6,35,34,39,21,20,22,51,50,19,51,22,22,51,50,
+54,53,52,38,39,35,53,51,50,54,54,53,52,39,33,53,33,21,22,21,20,6,7,22,21,
+20,6,35,34,38,1,22,51,50,53,52,38,35,34,6,1,3,117,75,172,141,192,223,107,
+99,55,59,171,163,16,94,94,127,17,17,127,153,177,159,109,89,137,138,245,44,
+157,11,138,110,101,108,145,116,151,146,69,70,42,40,254,74,2,46,88,61,61,207,
+191,176,116,167,253,86,71,86,192,68,55,80,116,1,211,160,95,89,248,219,148,
+238,63,39,109,57,111,125,5,159,2,50,52,85,41,2,136,115,124,147,52,44,150,
+149,1,5,125,136,102,92,106,161,27,153,19,46,39,51,37,159,72,70,101,66,112,
+36,125,228,162,182,89,2,45,49,120,53,61,96,3,177,0,0,3,0,85,255,232,4,225,
+4,106,0,16,0,28,0,40,0,0,1,22,22,21,20,6,4,35,34,36,38,53,16,55,35,53,33,
+5,34,6,21,20,22,51,50,54,53,52,38,3,50,22,21,20,6,35,34,38,53,52,54,4,4,114,
+107,140,254,246,175,171,254,245,145,219,219,3,175,254,155,188,230,223,193,
+193,219,229,186,50,70,71,49,49,69,67,3,206,80,223,151,158,248,138,131,248,
+165,1,45,150,159,159,228,188,193,220,227,186,188,228,254,228,70,51,50,70,
+71,49,49,72,0,3,0,85,255,232,5,213,4,106,0,27,0,59,0,69,0,0,1,33,53,33,21,
+35,22,22,21,20,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,1,51,22,
+22,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,23,38,38,35,35,34,0,21,20,
+22,51,50,54,1,38,35,34,6,21,20,51,50,54,1,103,254,238,4,158,3,75,77,1,39,
+39,206,160,124,157,64,49,158,132,168,190,142,1,221,157,17,132,100,105,124,
+12,85,132,112,137,130,103,87,69,44,218,147,71,241,254,236,102,109,94,125,
+2,68,61,89,44,55,107,48,79,3,203,159,159,46,145,89,21,19,59,138,78,177,223,
+84,100,86,98,247,226,176,1,17,253,246,114,124,124,116,53,56,89,115,103,97,
+111,34,84,97,254,225,236,157,153,124,1,107,74,44,38,90,51,0,4,0,85,254,218,
+5,213,4,106,0,27,0,59,0,69,0,73,0,0,1,33,53,33,21,35,22,22,21,20,7,22,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,1,51,22,22,51,50,54,53,52,39,6,
+35,34,38,53,52,54,51,50,23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,34,
+6,21,20,51,50,54,1,19,51,19,1,103,254,238,4,158,3,75,77,1,39,39,206,160,124,
+157,64,49,158,132,168,190,142,1,221,157,17,132,100,105,124,12,85,132,112,
+137,130,103,87,69,44,218,147,71,241,254,236,102,109,94,125,2,68,61,89,44,
+55,107,48,79,253,208,16,158,16,3,203,159,159,46,145,89,21,19,59,138,78,177,
+223,84,100,86,98,247,226,176,1,17,253,246,114,124,124,116,53,56,89,115,103,
+97,111,34,84,97,254,225,236,157,153,124,1,107,74,44,38,90,51,252,152,1,69,
+254,187,0,0,2,0,69,255,232,6,154,4,106,0,3,0,80,0,0,19,53,33,21,3,39,54,53,
+52,38,35,34,6,21,20,51,32,17,53,52,38,35,34,6,7,35,38,38,35,34,21,20,22,51,
+51,21,35,34,6,21,20,51,50,54,55,23,6,35,34,38,53,52,54,55,38,53,52,54,51,
+50,22,23,54,54,51,50,18,21,20,6,35,34,38,53,52,54,51,50,22,21,20,77,5,203,
+195,140,13,47,40,54,64,204,1,29,173,155,101,148,23,157,25,158,116,217,114,
+132,57,81,132,102,164,63,101,56,98,146,178,156,170,80,92,160,206,175,133,
+178,71,65,174,126,228,253,239,213,171,190,154,124,113,124,3,203,159,159,253,
+23,13,32,28,41,42,61,52,140,1,45,13,167,185,110,94,98,106,138,59,74,144,68,
+63,120,41,45,125,114,135,114,73,109,44,72,156,115,147,78,89,86,81,254,238,
+236,210,245,154,134,111,148,97,84,73,0,0,2,0,70,255,232,4,175,4,106,0,8,0,
+53,0,0,1,38,35,34,6,21,20,51,50,19,22,22,29,2,22,22,21,20,4,33,32,36,53,52,
+55,23,6,21,20,22,51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,38,38,39,
+33,53,33,3,144,73,96,81,78,133,150,102,54,54,59,63,254,219,254,233,254,251,
+254,216,11,162,8,199,196,208,213,22,45,174,108,135,147,155,146,103,95,15,
+77,63,253,85,3,120,2,139,35,40,43,83,1,209,46,129,83,13,11,54,144,82,216,
+231,236,199,63,56,22,39,40,140,151,151,131,67,52,79,89,118,112,106,117,31,
+56,89,33,159,0,4,0,85,254,218,5,201,4,106,0,20,0,24,0,36,0,59,0,0,1,51,22,
+22,51,50,54,53,52,38,38,35,35,34,0,21,20,22,51,50,54,19,19,51,19,3,50,22,
+21,20,6,35,34,38,53,52,54,37,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+18,55,33,53,33,21,2,192,157,17,128,94,107,106,123,231,155,34,241,254,236,
+102,109,94,125,5,16,158,16,96,50,70,71,49,49,69,67,1,223,130,141,192,173,
+116,154,64,49,158,132,168,190,142,132,254,238,4,151,1,120,112,126,150,155,
+152,243,133,254,225,236,157,153,124,253,212,1,69,254,187,4,17,70,51,50,70,
+71,49,49,72,224,79,254,241,172,228,245,85,99,86,98,247,226,176,1,17,73,159,
+159,0,0,2,0,85,255,232,5,201,4,106,0,20,0,43,0,0,1,51,22,22,51,50,17,52,38,
+38,35,35,34,6,6,21,20,22,51,50,54,1,22,18,21,20,6,35,34,38,39,6,6,35,34,38,
+53,52,18,55,33,53,33,21,2,192,157,8,134,97,214,123,232,155,34,157,235,125,
+102,109,99,130,2,5,130,141,192,173,116,154,64,49,158,132,168,190,142,132,
+254,238,4,151,1,143,122,139,1,49,150,244,134,128,241,155,156,153,138,2,183,
+79,254,241,172,228,245,85,99,86,98,247,226,176,1,17,73,159,159,0,0,3,0,85,
+254,218,5,201,4,106,0,20,0,43,0,47,0,0,1,51,22,22,51,50,17,52,38,38,35,35,
+34,6,6,21,20,22,51,50,54,1,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,
+55,33,53,33,21,1,19,51,19,2,192,157,8,134,97,214,123,232,155,34,157,235,125,
+102,109,99,130,2,5,130,141,192,173,116,154,64,49,158,132,168,190,142,132,
+254,238,4,151,253,196,16,158,16,1,143,122,139,1,49,150,244,134,128,241,155,
+156,153,138,2,183,79,254,241,172,228,245,85,99,86,98,247,226,176,1,17,73,
+159,159,251,15,1,69,254,187,0,2,0,63,255,228,5,91,4,106,0,43,0,44,0,0,1,22,
+18,21,20,6,35,34,38,38,39,46,2,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,
+23,30,2,51,50,54,53,52,2,39,33,53,33,21,1,4,37,153,157,202,179,89,135,102,
+62,52,69,65,44,67,77,103,159,51,58,177,130,108,151,86,63,73,92,64,95,101,
+252,200,253,84,4,59,253,168,3,203,104,254,221,171,202,227,61,113,106,88,88,
+36,88,77,125,143,63,69,172,84,140,188,93,149,109,90,46,133,119,205,1,74,46,
+159,159,252,53,0,0,3,0,63,255,232,6,5,4,106,0,46,0,58,0,62,0,0,1,22,17,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,
+6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,
+38,53,52,54,37,33,53,33,5,65,196,201,158,119,154,69,60,167,151,176,223,172,
+139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,86,
+86,254,133,50,70,71,49,49,69,67,2,32,251,28,4,228,3,122,215,254,243,202,228,
+76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,
+125,136,131,123,107,195,99,56,70,51,50,70,71,49,49,72,122,159,0,0,4,0,63,
+254,218,6,5,4,106,0,46,0,58,0,62,0,66,0,0,1,22,17,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,
+51,22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,38,53,52,54,37,33,53,
+33,1,19,51,19,5,65,196,201,158,119,154,69,60,167,151,176,223,172,139,109,
+132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,86,86,254,
+133,50,70,71,49,49,69,67,2,32,251,28,4,228,253,198,16,158,16,3,122,215,254,
+243,202,228,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,
+98,113,1,5,125,136,131,123,107,195,99,56,70,51,50,70,71,49,49,72,122,159,
+250,112,1,69,254,187,0,2,0,56,255,232,6,30,4,130,0,63,0,64,0,0,1,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,2,
+39,35,53,33,21,35,4,1,6,30,227,197,112,156,62,59,166,139,158,188,56,107,120,
+111,62,166,82,88,41,145,62,181,156,162,169,107,156,85,70,35,98,89,253,23,
+157,8,140,111,113,135,213,190,108,1,202,66,1,31,251,237,1,185,213,252,90,
+94,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,
+158,130,93,152,100,55,63,69,45,73,78,1,5,124,137,160,133,188,1,32,64,159,
+159,195,254,244,0,0,3,0,56,254,218,6,30,4,130,0,63,0,67,0,68,0,0,1,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,2,
+39,35,53,33,21,35,4,1,19,51,19,1,6,30,227,197,112,156,62,59,166,139,158,188,
+56,107,120,111,62,166,82,88,41,145,62,181,156,162,169,107,156,85,70,35,98,
+89,253,23,157,8,140,111,113,135,213,190,108,1,202,66,1,31,252,176,16,158,
+16,254,143,1,185,213,252,90,94,95,89,175,128,78,120,104,77,71,87,49,139,72,
+68,63,57,64,99,103,118,154,158,130,93,152,100,55,63,69,45,73,78,1,5,124,137,
+160,133,188,1,32,64,159,159,195,251,210,1,69,254,187,3,34,0,2,0,63,255,232,
+8,244,6,120,0,86,0,87,0,0,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,
+51,50,54,53,52,0,39,33,53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,18,21,
+20,7,22,22,51,50,54,53,52,2,39,35,53,33,21,35,22,18,1,8,244,222,210,210,173,
+49,154,92,119,154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,
+80,135,126,1,2,23,157,9,132,108,100,106,254,255,191,252,162,4,21,106,108,
+53,133,133,84,82,155,153,150,158,8,76,160,93,123,139,213,190,80,1,164,56,
+146,141,250,8,1,184,209,255,164,81,83,76,108,92,92,202,163,142,181,104,87,
+76,45,13,37,29,44,45,93,78,98,113,1,5,125,136,133,121,205,1,75,43,159,22,
+63,53,131,130,89,94,170,100,114,155,11,104,254,220,173,54,47,85,81,156,137,
+188,1,32,64,159,159,100,254,250,4,23,0,0,3,0,77,255,232,10,97,6,120,0,11,
+0,86,0,87,0,0,1,34,6,21,20,22,51,50,54,53,52,38,1,20,6,35,34,38,39,6,6,35,
+34,38,39,6,6,35,34,38,2,53,52,18,54,51,50,22,18,21,20,7,22,22,51,50,54,53,
+52,2,39,35,53,51,50,54,54,53,52,39,55,22,22,21,20,6,7,4,17,20,7,22,22,51,
+50,54,53,52,2,39,35,53,33,21,35,22,18,1,2,108,172,203,198,180,174,203,201,
+7,66,222,210,110,197,88,56,178,123,117,207,98,74,217,133,170,249,131,139,
+250,156,172,246,128,40,80,168,99,123,139,213,190,110,230,106,108,53,133,133,
+84,82,139,133,1,34,13,79,161,95,123,139,213,190,80,1,164,56,146,141,250,43,
+3,224,227,197,205,225,231,202,197,224,253,216,209,255,88,88,88,88,99,105,
+100,104,150,1,24,166,166,1,12,148,153,254,236,159,129,112,95,92,156,137,188,
+1,32,64,159,22,63,53,131,130,89,94,170,100,108,150,18,196,254,170,70,60,89,
+83,156,137,188,1,32,64,159,159,100,254,250,4,23,0,2,0,85,255,232,4,225,4,
+106,0,11,0,28,0,0,1,34,6,21,20,22,51,50,54,53,52,38,55,22,22,21,20,6,4,35,
+34,36,38,53,16,55,35,53,33,2,159,188,230,223,193,193,219,229,176,114,107,
+140,254,246,175,171,254,245,145,219,219,3,175,3,203,228,188,193,220,227,186,
+188,228,3,80,223,151,158,248,138,131,248,165,1,45,150,159,0,0,2,0,75,255,
+232,5,219,4,130,0,34,0,45,0,0,19,20,22,22,51,32,36,53,52,38,39,35,53,33,21,
+22,17,16,0,33,34,36,2,53,52,54,54,51,50,22,21,20,6,35,34,39,22,51,50,54,53,
+52,38,35,34,6,236,135,248,165,1,4,1,30,114,109,211,1,116,231,254,139,254,
+164,214,254,192,169,112,195,121,132,154,190,164,112,74,77,95,101,107,73,61,
+90,131,2,110,137,222,121,229,205,119,205,71,159,99,179,254,235,254,235,254,
+190,162,1,44,192,157,240,127,148,127,139,170,198,54,83,75,65,73,124,0,4,0,
+66,255,232,5,103,4,130,0,42,0,54,0,67,0,68,0,0,1,22,21,20,6,35,34,38,53,52,
+55,38,38,53,52,54,51,50,22,21,20,6,35,34,39,30,2,51,50,54,54,53,52,39,35,
+53,33,21,22,21,20,6,1,22,51,50,54,53,52,38,35,34,6,21,1,34,6,6,21,20,22,51,
+50,54,53,52,38,7,3,250,49,169,153,140,175,61,198,227,194,165,127,157,174,
+166,50,61,44,166,221,62,107,231,128,165,195,1,69,201,191,252,48,60,75,97,
+101,74,62,89,108,2,19,28,81,51,85,77,80,81,97,89,1,97,52,85,111,129,124,113,
+81,59,40,235,160,165,201,133,114,127,144,16,65,78,32,54,125,94,153,68,159,
+97,92,193,149,205,1,151,25,65,60,50,59,112,91,254,58,23,59,42,50,59,56,53,
+58,66,35,0,0,1,0,63,255,232,6,5,4,106,0,51,0,0,1,22,18,21,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,
+32,19,51,22,22,51,50,54,53,52,0,39,33,53,33,21,4,207,153,157,201,158,119,
+154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,
+2,23,157,9,132,108,100,106,254,255,191,252,162,4,233,3,203,104,254,221,171,
+201,228,76,108,92,92,202,163,142,181,104,87,76,45,13,37,29,44,45,93,78,98,
+113,1,5,125,136,133,121,205,1,75,43,159,159,0,3,0,63,255,232,4,186,4,106,
+0,32,0,48,0,49,0,0,1,7,38,38,53,52,55,35,53,33,21,22,22,21,16,0,33,34,38,
+53,52,54,54,55,54,54,53,52,38,35,34,21,20,37,35,22,21,20,6,7,6,6,21,20,33,
+50,36,53,16,1,1,112,152,25,23,47,152,3,158,110,111,254,167,254,197,234,253,
+89,166,137,164,98,98,86,192,1,217,15,66,174,180,157,123,1,63,235,1,2,254,
+29,2,241,64,45,77,46,62,52,159,141,85,227,135,254,243,254,215,180,167,97,
+129,70,19,21,78,90,71,77,133,51,180,74,93,135,152,22,19,76,77,185,211,195,
+1,24,254,167,0,3,0,63,255,144,6,25,4,106,0,57,0,69,0,73,0,0,5,39,6,6,35,34,
+38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,
+22,51,32,19,51,22,22,51,50,55,1,55,1,54,54,53,52,38,39,55,22,17,20,6,7,23,
+1,50,22,21,20,6,35,34,38,53,52,54,37,33,53,33,5,137,80,35,72,38,122,158,72,
+60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,
+9,137,114,44,25,254,236,136,1,6,14,14,89,87,144,196,47,46,89,253,33,50,70,
+71,49,49,69,67,2,52,251,8,4,248,112,117,14,15,75,109,92,92,202,163,142,181,
+104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,127,137,7,1,143,85,254,122,28,
+78,50,106,196,99,97,215,254,243,95,152,57,127,3,106,70,51,50,70,71,49,49,
+72,122,159,0,4,0,63,255,228,5,92,4,106,0,3,0,43,0,55,0,56,0,0,19,53,33,21,
+1,7,38,38,53,52,54,51,50,22,22,23,30,2,51,50,54,53,52,38,39,55,22,17,20,6,
+35,34,38,38,39,46,2,35,34,6,21,20,1,50,22,21,20,6,35,34,38,53,52,54,3,63,
+4,59,252,209,159,51,58,178,129,82,116,91,56,62,76,89,62,95,105,85,86,138,
+201,201,181,89,135,102,62,52,69,65,44,67,77,1,215,50,68,68,50,50,69,69,120,
+3,203,159,159,252,88,63,68,173,85,140,187,48,96,98,108,91,46,139,121,107,
+191,97,97,215,254,252,208,231,61,113,106,88,88,36,88,77,126,2,197,71,50,49,
+71,70,50,50,71,252,138,0,0,3,0,68,255,232,6,37,4,106,0,36,0,48,0,60,0,0,1,
+22,21,20,7,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,
+23,54,53,52,38,39,33,53,33,21,1,50,54,53,52,38,35,34,6,21,20,22,33,50,54,
+53,52,38,35,34,6,21,20,22,3,9,126,5,102,179,183,211,223,191,118,177,46,50,
+177,118,189,216,223,192,80,136,46,2,130,112,254,76,4,237,252,180,123,133,
+133,115,122,135,134,3,9,123,133,133,115,120,137,134,3,203,95,174,30,15,112,
+218,181,177,217,93,89,89,93,208,186,182,217,55,55,11,16,95,156,34,159,159,
+252,183,128,112,114,132,129,112,115,130,128,112,114,132,131,110,115,130,0,
+255,255,0,56,254,140,5,247,4,130,2,34,0,139,0,0,0,3,0,55,5,38,0,0,0,7,0,63,
+254,140,6,5,4,106,0,46,0,58,0,62,0,74,0,86,0,87,0,91,0,0,1,22,17,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,
+20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,38,53,
+52,54,3,19,51,19,55,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,
+38,53,52,54,55,1,33,53,33,5,65,196,201,158,119,154,69,60,167,151,176,223,
+172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,
+86,86,254,133,50,70,71,49,49,69,67,26,16,158,16,237,50,70,71,49,49,69,67,
+253,154,50,70,71,49,49,69,67,216,2,131,251,28,4,228,3,122,215,254,243,202,
+228,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,98,113,
+1,5,125,136,131,123,107,195,99,56,70,51,50,70,71,49,49,72,251,137,1,69,254,
+187,163,70,51,50,70,71,49,49,72,70,51,50,70,71,49,49,72,18,4,60,159,0,0,3,
+0,73,255,232,7,47,5,145,0,52,0,63,0,75,0,0,1,38,35,34,6,7,51,50,22,21,20,
+6,35,34,38,53,53,33,23,22,21,20,7,33,21,39,22,22,21,20,6,35,34,38,53,52,55,
+7,53,33,54,53,52,39,55,33,53,33,54,54,51,50,23,1,21,20,22,51,50,53,52,38,
+38,35,1,34,6,21,20,22,51,50,54,53,52,38,6,215,87,92,85,112,26,55,188,175,
+150,128,148,167,254,17,3,33,26,1,159,199,73,79,250,227,214,248,146,191,1,
+171,53,34,3,254,63,4,95,38,208,151,137,113,254,0,88,78,119,43,72,71,252,185,
+147,157,156,148,148,157,158,4,209,47,75,75,150,125,118,132,191,168,7,1,54,
+50,56,41,143,3,44,142,86,179,202,205,172,174,101,2,143,39,60,52,50,1,159,
+143,152,63,254,121,15,100,113,107,42,56,23,254,167,134,116,113,127,127,113,
+118,132,0,0,3,0,52,255,232,9,120,5,145,0,11,0,98,0,109,0,0,37,38,38,35,34,
+6,21,20,22,51,50,54,37,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,
+54,54,53,52,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,18,21,20,6,7,22,22,51,50,54,53,52,2,39,35,53,33,54,54,51,50,23,7,38,35,
+34,6,7,51,50,22,21,20,6,35,34,38,53,53,33,22,18,19,21,20,22,51,50,53,52,38,
+38,35,2,172,93,146,74,74,82,90,86,94,146,4,31,237,223,104,199,122,79,206,
+126,158,180,169,149,100,186,103,16,17,152,130,88,96,11,23,84,48,61,83,70,
+97,125,185,145,211,241,35,35,110,147,82,137,152,213,190,108,3,2,38,208,151,
+137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,254,152,146,141,226,
+88,78,119,43,72,71,249,74,59,66,54,61,71,59,251,209,255,82,97,90,89,153,137,
+112,148,67,74,51,115,63,181,210,81,74,37,24,79,66,55,62,70,128,108,137,166,
+254,223,241,98,169,71,85,63,156,137,188,1,32,64,159,143,152,63,129,47,75,
+75,150,125,118,132,191,168,7,100,254,250,1,106,15,100,113,107,42,56,23,0,
+2,0,96,0,0,7,198,5,145,0,48,0,59,0,0,1,38,35,34,6,7,51,50,22,21,20,6,35,34,
+38,53,53,33,22,18,17,21,35,53,52,46,2,35,34,14,3,21,21,35,53,16,18,55,33,
+53,33,54,54,51,50,23,1,21,20,22,51,50,53,52,38,38,35,7,110,87,92,85,112,26,
+55,188,175,150,128,148,167,254,151,129,131,185,38,104,137,93,70,109,89,79,
+32,185,133,128,254,244,4,223,38,208,151,137,113,254,0,88,78,119,43,72,71,
+4,209,47,75,75,150,125,118,132,191,168,7,92,254,184,254,216,255,221,193,251,
+209,97,50,100,193,239,168,221,255,1,30,1,86,88,159,143,152,63,254,121,15,
+100,113,107,42,56,23,0,0,4,0,63,254,218,10,233,5,145,0,11,0,15,0,106,0,117,
+0,0,1,50,22,21,20,6,35,34,38,53,52,54,3,19,51,19,1,20,6,35,34,39,22,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,
+6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,55,22,22,51,50,54,53,52,
+39,33,53,33,55,23,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,
+38,53,53,35,22,37,21,20,22,51,50,53,52,38,38,35,3,54,50,70,71,49,49,69,67,
+26,16,158,16,4,25,170,141,94,64,24,206,151,119,154,69,60,167,151,176,223,
+172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,97,109,
+79,83,143,90,127,86,78,84,114,249,150,6,125,22,31,1,113,38,208,151,137,113,
+88,87,92,85,112,26,55,188,175,150,128,148,167,213,69,1,41,88,78,119,43,72,
+71,3,81,70,51,50,70,71,49,49,72,251,137,1,69,254,187,3,251,143,160,38,53,
+59,168,204,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,
+98,113,1,5,125,136,117,86,96,165,83,96,127,88,84,73,138,110,159,25,25,143,
+152,63,129,47,75,75,150,125,118,132,191,168,7,117,117,15,100,113,107,42,56,
+23,0,0,4,0,56,255,232,11,147,5,145,0,115,0,126,0,138,0,139,0,0,1,54,53,52,
+38,35,34,6,7,6,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,39,55,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,
+23,7,38,53,52,54,51,50,23,54,54,51,50,22,23,22,22,51,50,54,53,52,39,33,53,
+33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,35,22,21,
+20,6,35,34,39,6,7,1,21,20,22,51,50,53,52,38,38,35,5,50,22,21,20,6,35,34,38,
+53,52,54,1,4,234,19,100,96,96,190,83,16,110,125,85,70,35,98,89,253,23,157,
+8,139,112,101,108,87,145,110,195,182,117,158,63,59,166,139,158,188,56,107,
+120,111,62,166,82,88,41,145,62,181,156,234,69,101,189,107,130,175,31,93,191,
+122,92,86,90,254,177,2,216,38,208,151,137,113,88,87,92,85,112,26,55,188,175,
+150,128,148,167,166,49,179,163,238,179,2,6,4,13,88,78,119,43,72,71,249,167,
+50,70,71,49,49,69,67,254,169,2,226,46,57,79,82,105,101,67,128,80,55,63,69,
+45,73,78,1,5,125,136,94,85,113,96,95,140,171,158,176,88,96,95,89,175,128,
+78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,163,86,77,107,100,
+131,124,68,68,92,51,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,
+70,84,136,148,182,9,13,1,22,15,100,113,107,42,56,23,192,70,51,50,70,71,49,
+49,72,254,241,0,3,0,56,255,232,9,0,5,145,0,101,0,112,0,113,0,0,1,33,22,21,
+20,7,51,21,35,34,39,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,
+54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,
+22,51,50,19,51,22,22,51,50,54,53,52,38,39,33,53,33,54,53,52,39,33,53,33,54,
+54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,55,21,20,22,51,50,
+53,52,38,38,35,1,6,103,254,216,32,28,217,85,53,54,81,74,195,182,117,158,63,
+59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,162,169,
+107,156,85,70,35,98,89,253,23,157,8,140,111,101,108,105,94,254,253,1,3,53,
+36,254,236,2,244,38,208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,
+148,167,153,88,78,119,43,72,71,250,165,3,203,50,55,53,44,143,3,67,150,92,
+163,181,88,96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,
+103,118,154,158,130,93,152,100,55,63,69,45,73,78,1,5,124,137,102,92,92,153,
+49,143,39,60,57,46,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,
+15,100,113,107,42,56,23,254,49,0,0,4,0,85,254,218,9,86,5,145,0,69,0,80,0,
+91,0,95,0,0,1,4,17,20,6,35,34,38,39,6,6,35,34,2,17,52,18,54,51,50,22,21,20,
+6,35,34,39,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,2,39,35,53,33,54,
+54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,5,22,51,50,54,
+53,52,38,35,34,6,37,21,20,22,51,50,53,52,38,38,35,1,19,51,19,5,75,1,31,227,
+197,112,156,62,65,166,140,198,234,121,207,126,134,156,190,164,120,97,5,139,
+123,122,156,17,157,8,140,111,113,135,213,190,110,3,14,38,208,151,137,113,
+88,87,92,85,112,26,55,188,175,150,128,148,167,250,97,77,99,101,106,73,61,
+80,134,6,21,88,78,119,43,72,71,251,97,16,158,16,3,203,195,254,177,213,252,
+90,94,95,89,1,31,1,3,196,1,33,147,148,127,141,168,63,54,62,185,194,137,124,
+124,137,160,133,188,1,32,64,159,143,152,63,129,47,75,75,150,125,118,132,191,
+168,7,195,62,83,75,65,73,120,81,15,100,113,107,42,56,23,251,15,1,69,254,187,
+0,0,3,0,56,255,232,8,205,5,145,0,99,0,110,0,111,0,0,1,20,6,35,34,39,6,6,7,
+14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,39,55,22,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,39,33,53,33,54,54,51,50,23,7,38,35,34,6,
+7,51,50,22,21,20,6,35,34,38,53,53,35,22,37,21,20,22,51,50,53,52,38,38,35,
+1,5,95,169,151,210,141,21,114,108,85,70,35,98,89,253,23,157,8,139,112,101,
+108,87,145,110,195,182,117,158,63,59,166,139,158,188,56,107,120,111,62,166,
+82,88,41,145,62,181,156,124,156,32,73,162,97,83,87,8,254,179,2,228,38,208,
+151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,218,5,1,110,88,
+78,119,43,72,71,250,221,3,152,133,150,133,63,117,69,55,63,69,45,73,78,1,5,
+125,136,94,85,113,96,95,140,171,158,176,88,96,95,89,175,128,78,120,104,77,
+71,87,49,139,72,68,63,57,64,99,103,118,154,92,92,89,92,68,65,25,24,159,143,
+152,63,129,47,75,75,150,125,118,132,191,168,7,24,24,15,100,113,107,42,56,
+23,254,49,0,5,0,85,254,218,13,159,6,120,0,11,0,106,0,117,0,121,0,122,0,0,
+1,34,6,21,20,22,51,50,54,53,52,38,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,
+35,34,36,38,53,16,55,35,53,33,50,54,54,53,52,39,55,22,22,21,20,6,7,22,22,
+21,20,7,22,22,51,50,54,53,52,2,39,55,22,18,21,20,7,22,22,51,50,54,53,52,2,
+39,35,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,
+33,22,18,19,21,20,22,51,50,53,52,38,38,35,1,19,51,19,1,2,159,188,230,223,
+193,193,219,230,7,106,222,210,108,195,87,58,178,120,116,207,103,79,245,153,
+171,254,245,145,219,219,2,219,106,108,53,133,133,84,82,119,110,119,110,29,
+81,171,106,121,137,201,201,88,235,247,14,76,160,93,123,139,213,190,110,3,
+4,38,208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,254,152,
+146,141,226,88,78,119,43,72,71,251,53,16,158,16,250,67,3,203,228,187,193,
+220,227,186,188,227,253,237,209,255,86,86,86,86,99,111,104,106,131,248,165,
+1,45,150,159,22,63,53,131,130,90,94,171,100,100,145,24,82,226,157,100,88,
+98,96,158,135,195,1,28,89,159,117,254,142,231,73,63,85,81,156,137,188,1,32,
+64,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,100,254,250,1,106,
+15,100,113,107,42,56,23,251,15,1,69,254,187,7,158,0,0,3,0,56,255,143,13,120,
+5,145,0,10,0,127,0,138,0,0,37,38,38,35,34,6,21,20,51,50,54,1,39,54,54,53,
+52,38,35,34,6,6,21,23,22,21,20,6,7,22,23,7,38,39,6,6,35,34,38,53,52,54,51,
+50,22,23,54,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,23,7,38,53,52,
+54,51,50,22,23,54,54,51,50,22,23,54,54,51,50,22,23,22,22,51,50,54,53,52,39,
+33,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,35,
+22,21,20,6,35,34,39,6,1,21,20,22,51,50,53,52,38,38,35,4,6,72,191,119,104,
+112,238,110,180,3,151,155,15,19,83,75,66,105,51,2,2,81,71,73,36,170,23,44,
+93,221,129,189,203,201,179,150,245,95,38,39,115,114,86,117,17,161,15,119,
+88,75,83,19,15,155,47,180,135,108,147,59,49,155,112,97,156,51,56,145,105,
+107,165,30,95,191,121,92,86,90,254,177,2,216,38,208,151,137,113,88,87,92,
+85,112,26,55,188,175,150,128,148,167,166,49,179,163,239,180,11,4,18,88,78,
+119,43,72,71,233,97,98,75,65,158,51,1,216,49,29,80,34,70,77,75,125,57,29,
+29,29,119,230,83,124,172,33,119,102,66,66,165,145,136,155,114,114,62,149,
+86,173,173,126,112,114,124,77,70,34,80,29,49,94,111,131,165,87,97,88,96,87,
+87,90,84,110,96,134,122,68,68,92,51,159,143,152,63,129,47,75,75,150,125,118,
+132,191,168,7,70,84,136,148,184,32,1,30,15,100,113,107,42,56,23,0,0,4,0,82,
+255,232,9,29,6,120,0,9,0,104,0,115,0,116,0,0,1,22,51,50,53,52,38,35,34,6,
+1,22,21,20,6,7,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,38,38,53,52,
+54,55,23,6,6,21,20,23,54,51,50,22,21,20,6,35,34,39,21,20,22,51,50,19,51,22,
+22,51,50,54,53,52,38,39,35,53,51,50,54,54,53,52,39,33,53,33,54,54,51,50,23,
+7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,51,21,20,22,51,50,53,52,38,
+38,35,1,1,12,71,86,192,68,55,80,116,4,175,18,61,61,207,191,176,116,167,65,
+75,172,141,192,223,107,99,55,59,171,163,16,94,94,127,17,17,127,153,177,159,
+109,89,137,138,245,44,157,11,138,110,101,108,145,116,151,146,69,70,42,40,
+254,74,3,49,38,208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,
+167,153,88,78,119,43,72,71,251,134,2,110,49,120,53,61,96,1,4,40,44,66,112,
+36,125,228,162,182,89,95,95,89,248,219,148,238,63,39,109,57,111,125,5,159,
+2,50,52,85,41,2,136,115,124,147,52,44,150,149,1,5,125,136,102,92,106,161,
+27,153,19,46,39,51,37,159,143,152,63,129,47,75,75,150,125,118,132,191,168,
+7,15,100,113,107,42,56,23,2,173,0,4,0,85,255,232,7,205,5,145,0,38,0,50,0,
+62,0,73,0,0,1,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,33,22,22,21,20,
+6,4,35,34,36,38,53,16,55,35,53,33,54,54,51,50,23,1,34,6,21,20,22,51,50,54,
+53,52,38,3,50,22,21,20,6,35,34,38,53,52,54,1,21,20,22,51,50,53,52,38,38,35,
+7,117,87,92,85,112,26,55,188,175,150,128,148,167,254,212,111,106,140,254,
+246,175,171,254,245,145,219,219,4,241,38,208,151,137,113,250,210,188,230,
+223,193,193,219,229,186,50,70,71,49,49,69,67,3,102,88,78,119,43,72,71,4,209,
+47,75,75,150,125,118,132,191,168,7,77,221,153,158,248,138,131,248,165,1,45,
+150,159,143,152,63,254,121,228,188,193,220,227,186,188,228,254,228,70,51,
+50,70,71,49,49,72,1,28,15,100,113,107,42,56,23,0,0,4,0,85,255,232,8,158,5,
+145,0,31,0,41,0,90,0,101,0,0,1,51,22,22,51,50,54,53,52,39,6,35,34,38,53,52,
+54,51,50,23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,34,6,21,20,51,50,54,
+55,20,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,33,53,33,54,54,
+51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,33,22,22,37,21,20,
+22,51,50,53,52,38,38,35,2,192,157,17,132,100,105,124,12,85,132,112,137,130,
+103,87,69,44,218,147,71,241,254,236,102,109,94,125,2,68,61,89,44,55,107,48,
+79,168,1,39,39,206,160,124,157,64,49,158,132,168,190,142,132,254,238,5,194,
+37,209,151,137,113,88,87,92,84,112,27,55,188,175,150,128,148,167,254,235,
+75,77,1,22,88,78,119,43,72,71,1,120,114,124,124,116,53,56,89,115,103,97,111,
+34,84,97,254,225,236,157,153,124,1,107,74,44,38,90,51,113,21,19,59,138,78,
+177,223,84,100,86,98,247,226,176,1,17,73,159,143,152,63,129,47,75,75,150,
+125,118,132,191,168,7,46,145,191,15,100,113,107,42,56,23,0,0,5,0,85,254,218,
+8,158,5,145,0,31,0,41,0,90,0,101,0,105,0,0,1,51,22,22,51,50,54,53,52,39,6,
+35,34,38,53,52,54,51,50,23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,34,
+6,21,20,51,50,54,55,20,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,
+55,33,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,
+33,22,22,37,21,20,22,51,50,53,52,38,38,35,1,19,51,19,2,192,157,17,132,100,
+105,124,12,85,132,112,137,130,103,87,69,44,218,147,71,241,254,236,102,109,
+94,125,2,68,61,89,44,55,107,48,79,168,1,39,39,206,160,124,157,64,49,158,132,
+168,190,142,132,254,238,5,194,37,209,151,137,113,88,87,92,84,112,27,55,188,
+175,150,128,148,167,254,235,75,77,1,22,88,78,119,43,72,71,251,175,16,158,
+16,1,120,114,124,124,116,53,56,89,115,103,97,111,34,84,97,254,225,236,157,
+153,124,1,107,74,44,38,90,51,113,21,19,59,138,78,177,223,84,100,86,98,247,
+226,176,1,17,73,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,46,
+145,191,15,100,113,107,42,56,23,251,15,1,69,254,187,0,3,0,69,255,232,9,135,
+5,145,0,76,0,101,0,112,0,0,37,39,54,53,52,38,35,34,6,21,20,51,32,17,53,52,
+38,35,34,6,7,35,38,38,35,34,21,20,22,51,51,21,35,34,6,21,20,51,50,54,55,23,
+6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,54,54,51,50,18,21,20,6,35,
+34,38,53,52,54,51,50,22,21,20,1,33,53,33,54,54,51,50,23,7,38,35,34,6,7,51,
+50,22,21,20,6,35,34,38,53,55,21,20,22,51,50,53,52,38,38,35,5,85,140,13,47,
+40,54,64,204,1,29,173,155,101,148,23,157,25,158,116,217,114,132,57,81,132,
+102,164,63,101,56,98,146,178,156,170,80,92,160,206,175,133,178,71,65,174,
+126,228,253,239,213,171,190,154,124,113,124,1,126,249,95,6,179,38,208,151,
+137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,153,88,78,119,43,72,
+71,226,13,32,28,41,42,61,52,140,1,45,13,167,185,110,94,98,106,138,59,74,144,
+68,63,120,41,45,125,114,135,114,73,109,44,72,156,115,147,78,89,86,81,254,
+238,236,210,245,154,134,111,148,97,84,73,2,190,159,143,152,63,129,47,75,75,
+150,125,118,132,191,168,7,15,100,113,107,42,56,23,0,0,3,0,70,255,232,7,146,
+5,145,0,8,0,75,0,86,0,0,1,38,35,34,6,21,20,51,50,19,22,22,29,2,22,22,21,20,
+4,33,32,36,53,52,55,23,6,21,20,22,51,50,54,53,52,39,6,6,35,34,38,53,52,54,
+51,50,23,38,38,39,33,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,
+35,34,38,53,53,51,21,20,22,51,50,53,52,38,38,35,3,144,73,96,81,78,133,150,
+118,46,46,59,63,254,219,254,233,254,251,254,216,11,162,8,199,196,208,213,
+22,45,174,108,135,147,155,146,103,95,15,77,63,253,85,4,186,37,209,151,137,
+113,88,87,92,84,112,27,55,188,175,150,128,148,167,153,88,78,119,43,72,71,
+2,139,35,40,43,83,1,195,45,122,77,13,11,54,144,82,216,231,236,199,63,56,22,
+39,40,140,151,151,131,67,52,79,89,118,112,106,117,31,56,89,33,159,143,152,
+63,129,47,75,75,150,125,118,132,191,168,7,15,100,113,107,42,56,23,0,0,5,0,
+85,254,218,8,181,5,145,0,20,0,24,0,36,0,80,0,91,0,0,1,51,22,22,51,50,54,53,
+52,38,38,35,35,34,0,21,20,22,51,50,54,19,19,51,19,3,50,22,21,20,6,35,34,38,
+53,52,54,37,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,33,53,33,54,
+54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,51,21,20,22,51,
+50,53,52,38,38,35,2,192,157,17,128,94,107,106,123,231,155,34,241,254,236,
+102,109,94,125,5,16,158,16,96,50,70,71,49,49,69,67,1,223,130,141,192,173,
+116,154,64,49,158,132,168,190,142,132,254,238,5,217,38,208,151,137,113,88,
+87,92,85,112,26,55,188,175,150,128,148,167,153,88,78,119,43,72,71,1,120,112,
+126,150,155,152,243,133,254,225,236,157,153,124,253,212,1,69,254,187,4,17,
+70,51,50,70,71,49,49,72,224,79,254,241,172,228,245,85,99,86,98,247,226,176,
+1,17,73,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,15,100,113,
+107,42,56,23,0,3,0,85,255,232,8,181,5,145,0,20,0,64,0,75,0,0,1,51,22,22,51,
+50,17,52,38,38,35,35,34,6,6,21,20,22,51,50,54,1,22,18,21,20,6,35,34,38,39,
+6,6,35,34,38,53,52,18,55,33,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,
+21,20,6,35,34,38,53,53,51,21,20,22,51,50,53,52,38,38,35,2,192,157,8,134,97,
+214,123,232,155,34,157,235,125,102,109,99,130,2,5,130,141,192,173,116,154,
+64,49,158,132,168,190,142,132,254,238,5,217,38,208,151,137,113,88,87,92,85,
+112,26,55,188,175,150,128,148,167,153,88,78,119,43,72,71,1,143,122,139,1,
+49,150,244,134,128,241,155,156,153,138,2,183,79,254,241,172,228,245,85,99,
+86,98,247,226,176,1,17,73,159,143,152,63,129,47,75,75,150,125,118,132,191,
+168,7,15,100,113,107,42,56,23,0,4,0,85,254,218,8,181,5,145,0,20,0,64,0,75,
+0,79,0,0,1,51,22,22,51,50,17,52,38,38,35,35,34,6,6,21,20,22,51,50,54,1,22,
+18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,33,53,33,54,54,51,50,23,7,
+38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,51,21,20,22,51,50,53,52,38,38,
+35,1,19,51,19,2,192,157,8,134,97,214,123,232,155,34,157,235,125,102,109,99,
+130,2,5,130,141,192,173,116,154,64,49,158,132,168,190,142,132,254,238,5,217,
+38,208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,153,88,78,
+119,43,72,71,251,152,16,158,16,1,143,122,139,1,49,150,244,134,128,241,155,
+156,153,138,2,183,79,254,241,172,228,245,85,99,86,98,247,226,176,1,17,73,
+159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,15,100,113,107,42,56,
+23,251,15,1,69,254,187,0,0,3,0,63,255,228,8,71,5,145,0,64,0,75,0,76,0,0,1,
+22,18,21,20,6,35,34,38,38,39,46,2,35,34,6,21,20,23,7,38,38,53,52,54,51,50,
+22,23,30,2,51,50,54,53,52,2,39,33,53,33,54,54,51,50,23,7,38,35,34,6,7,51,
+50,22,21,20,6,35,34,38,53,53,51,21,20,22,51,50,53,52,38,38,35,1,4,37,153,
+157,202,179,89,135,102,62,52,69,65,44,67,77,103,159,51,58,177,130,108,151,
+86,63,73,92,64,95,101,252,200,253,84,5,125,38,208,151,137,113,88,87,92,85,
+112,26,55,188,175,150,128,148,167,153,88,78,119,43,72,71,251,118,3,203,104,
+254,221,171,202,227,61,113,106,88,88,36,88,77,125,143,63,69,172,84,140,188,
+93,149,109,90,46,133,119,205,1,74,46,159,143,152,63,129,47,75,75,150,125,
+118,132,191,168,7,15,100,113,107,42,56,23,252,53,0,4,0,63,255,232,8,236,5,
+145,0,46,0,58,0,83,0,94,0,0,1,22,17,20,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,
+54,53,52,38,39,37,50,22,21,20,6,35,34,38,53,52,54,37,33,53,33,54,54,51,50,
+23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,55,21,20,22,51,50,53,52,38,
+38,35,5,65,196,201,158,119,154,69,60,167,151,176,223,172,139,109,132,27,140,
+13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,86,86,254,133,50,70,71,
+49,49,69,67,3,80,249,236,6,38,38,208,151,137,113,88,87,92,85,112,26,55,188,
+175,150,128,148,167,153,88,78,119,43,72,71,3,122,215,254,243,202,228,76,108,
+92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,
+131,123,107,195,99,56,70,51,50,70,71,49,49,72,122,159,143,152,63,129,47,75,
+75,150,125,118,132,191,168,7,15,100,113,107,42,56,23,0,0,5,0,63,254,218,8,
+236,5,145,0,46,0,58,0,83,0,94,0,98,0,0,1,22,17,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,51,
+22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,38,53,52,54,37,33,53,33,
+54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,55,21,20,22,51,
+50,53,52,38,38,35,1,19,51,19,5,65,196,201,158,119,154,69,60,167,151,176,223,
+172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,
+86,86,254,133,50,70,71,49,49,69,67,3,80,249,236,6,38,38,208,151,137,113,88,
+87,92,85,112,26,55,188,175,150,128,148,167,153,88,78,119,43,72,71,251,154,
+16,158,16,3,122,215,254,243,202,228,76,108,92,92,202,163,142,181,104,87,76,
+45,13,35,31,44,45,93,78,98,113,1,5,125,136,131,123,107,195,99,56,70,51,50,
+70,71,49,49,72,122,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,
+15,100,113,107,42,56,23,251,15,1,69,254,187,0,3,0,56,255,232,9,10,5,145,0,
+84,0,95,0,96,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,
+52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,
+19,51,22,22,51,50,54,53,52,2,39,35,53,33,54,54,51,50,23,7,38,35,34,6,7,51,
+50,22,21,20,6,35,34,38,53,53,33,4,55,21,20,22,51,50,53,52,38,38,35,1,6,30,
+227,197,112,156,62,59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,
+62,181,156,162,169,107,156,85,70,35,98,89,253,23,157,8,140,111,113,135,213,
+190,108,3,12,38,208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,
+167,254,142,1,31,236,88,78,119,43,72,71,250,137,1,185,213,252,90,94,95,89,
+175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,158,130,
+93,152,100,55,63,69,45,73,78,1,5,124,137,160,133,188,1,32,64,159,143,152,
+63,129,47,75,75,150,125,118,132,191,168,7,195,195,15,100,113,107,42,56,23,
+254,49,0,4,0,56,254,218,9,10,5,145,0,84,0,95,0,99,0,100,0,0,1,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,52,
+54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,2,39,
+35,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,33,
+4,55,21,20,22,51,50,53,52,38,38,35,1,19,51,19,1,6,30,227,197,112,156,62,59,
+166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,162,169,107,
+156,85,70,35,98,89,253,23,157,8,140,111,113,135,213,190,108,3,12,38,208,151,
+137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,254,142,1,31,236,88,
+78,119,43,72,71,251,97,16,158,16,254,132,1,185,213,252,90,94,95,89,175,128,
+78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,158,130,93,152,100,
+55,63,69,45,73,78,1,5,124,137,160,133,188,1,32,64,159,143,152,63,129,47,75,
+75,150,125,118,132,191,168,7,195,195,15,100,113,107,42,56,23,251,15,1,69,
+254,187,3,34,0,0,3,0,63,255,232,11,224,6,120,0,107,0,118,0,119,0,0,1,20,6,
+35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,
+52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,0,39,33,53,33,50,
+54,54,53,52,39,55,22,22,21,20,6,7,22,18,21,20,7,22,22,51,50,54,53,52,2,39,
+35,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,33,
+22,18,19,21,20,22,51,50,53,52,38,38,35,1,8,244,222,210,210,173,49,154,92,
+119,154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,
+1,2,23,157,9,132,108,100,106,254,255,191,252,162,4,21,106,108,53,133,133,
+84,82,155,153,150,158,8,76,160,93,123,139,213,190,80,2,240,38,208,151,137,
+113,88,87,92,85,112,26,55,188,175,150,128,148,167,254,142,146,141,236,88,
+78,119,43,72,71,248,206,1,184,209,255,164,81,83,76,108,92,92,202,163,142,
+181,104,87,76,45,13,37,29,44,45,93,78,98,113,1,5,125,136,133,121,205,1,75,
+43,159,22,63,53,131,130,89,94,170,100,114,155,11,104,254,220,173,54,47,85,
+81,156,137,188,1,32,64,159,143,152,63,129,47,75,75,150,125,118,132,191,168,
+7,100,254,250,1,106,15,100,113,107,42,56,23,2,173,0,0,4,0,77,255,232,13,91,
+6,120,0,11,0,107,0,118,0,119,0,0,1,34,6,21,20,22,51,50,54,53,52,38,1,20,6,
+35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,2,53,52,18,54,51,50,22,18,21,20,
+7,22,22,51,50,54,53,52,2,39,35,53,51,50,54,54,53,52,39,55,22,22,21,20,6,7,
+4,17,20,7,22,22,51,50,54,53,52,2,39,35,53,33,54,54,51,50,23,7,38,35,34,6,
+7,51,50,22,21,20,6,35,34,38,53,53,33,22,18,19,21,20,22,51,50,53,52,38,38,
+35,1,2,108,172,203,198,180,174,203,201,7,66,222,210,110,197,88,56,178,123,
+117,207,98,74,217,133,170,249,131,139,250,156,172,246,128,40,80,168,99,123,
+139,213,190,110,230,106,108,53,133,133,84,82,139,133,1,34,13,79,161,95,123,
+139,213,190,80,2,254,38,208,151,137,113,88,87,92,85,112,26,55,188,175,150,
+128,148,167,254,128,146,141,250,88,78,119,43,72,71,248,163,3,224,227,197,
+205,225,231,202,197,224,253,216,209,255,88,88,88,88,99,105,100,104,150,1,
+24,166,166,1,12,148,153,254,236,159,129,112,95,92,156,137,188,1,32,64,159,
+22,63,53,131,130,89,94,170,100,108,150,18,196,254,170,70,60,89,83,156,137,
+188,1,32,64,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,100,254,
+250,1,106,15,100,113,107,42,56,23,2,173,0,3,0,85,255,232,7,205,5,145,0,38,
+0,50,0,61,0,0,1,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,33,22,22,21,
+20,6,4,35,34,36,38,53,16,55,35,53,33,54,54,51,50,23,1,34,6,21,20,22,51,50,
+54,53,52,38,33,21,20,22,51,50,53,52,38,38,35,7,117,87,92,85,112,26,55,188,
+175,150,128,148,167,254,212,111,106,140,254,246,175,171,254,245,145,219,219,
+4,241,38,208,151,137,113,250,210,188,230,223,193,193,219,229,2,121,88,78,
+119,43,72,71,4,209,47,75,75,150,125,118,132,191,168,7,77,221,153,158,248,
+138,131,248,165,1,45,150,159,143,152,63,254,121,228,188,193,220,227,186,188,
+228,15,100,113,107,42,56,23,0,0,5,0,82,255,232,9,207,5,145,0,21,0,32,0,42,
+0,102,0,113,0,0,1,51,22,22,51,50,54,53,52,39,6,35,33,34,39,6,21,20,22,51,
+50,54,1,22,51,50,54,53,52,38,35,34,6,5,38,38,35,34,6,21,20,51,50,5,16,2,35,
+34,38,39,6,6,35,34,2,17,52,18,54,51,50,22,21,20,7,54,51,51,50,23,38,53,52,
+54,51,50,23,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,
+53,35,22,22,1,21,20,22,51,50,53,52,38,38,35,3,64,157,17,159,132,129,145,6,
+103,133,252,187,138,99,5,144,130,132,159,253,236,77,99,102,105,73,61,80,134,
+4,195,34,133,81,61,73,207,96,1,25,240,205,146,172,66,68,171,144,205,240,121,
+207,126,133,157,44,30,28,140,29,30,44,159,133,67,68,1,186,38,208,151,137,
+113,88,87,92,85,112,26,55,188,175,150,128,148,167,225,59,59,1,4,88,78,119,
+43,72,71,1,143,128,133,193,186,51,65,63,63,53,63,185,194,133,1,249,62,80,
+78,65,73,120,114,112,122,73,65,158,192,254,255,254,223,90,94,96,88,1,33,1,
+1,196,1,33,147,149,126,83,72,2,2,71,84,125,150,24,143,152,63,129,47,75,75,
+150,125,118,132,191,168,7,88,225,1,57,15,100,113,107,42,56,23,0,3,0,75,255,
+232,8,209,5,145,0,10,0,67,0,78,0,0,19,22,51,50,54,53,52,38,35,34,6,37,22,
+21,16,0,33,34,36,2,53,52,54,54,51,50,22,21,20,6,35,34,39,20,22,22,51,32,36,
+53,52,38,39,35,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,
+38,53,53,51,21,20,22,51,50,53,52,38,38,35,249,77,95,101,107,73,61,90,131,
+4,38,163,254,139,254,164,214,254,192,169,112,195,121,132,154,190,164,112,
+87,135,248,165,1,4,1,30,114,109,211,2,202,38,208,151,137,113,88,87,92,85,
+112,26,55,188,175,150,128,148,167,153,88,78,119,43,72,71,3,2,54,83,75,65,
+73,124,83,164,232,254,235,254,190,162,1,44,192,157,240,127,148,127,139,170,
+52,137,222,121,229,205,119,205,71,159,143,152,63,129,47,75,75,150,125,118,
+132,191,168,7,15,100,113,107,42,56,23,0,5,0,66,255,232,8,119,5,145,0,11,0,
+24,0,89,0,100,0,101,0,0,1,34,6,21,21,22,51,50,54,53,52,38,1,34,6,6,21,20,
+22,51,50,54,53,52,38,1,22,21,20,6,7,22,21,20,6,35,34,38,53,52,55,38,38,53,
+52,54,51,50,22,21,20,6,35,34,39,30,2,51,50,54,54,53,52,39,35,53,33,54,54,
+51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,51,21,20,22,51,50,
+53,52,38,38,35,1,1,157,89,108,60,75,97,101,74,1,16,28,81,51,85,77,80,81,97,
+1,213,101,191,174,49,169,153,140,175,61,198,227,194,165,127,157,174,166,50,
+61,44,166,221,62,107,231,128,165,195,2,151,38,208,151,137,113,88,87,92,85,
+112,26,55,188,175,150,128,148,167,153,88,78,119,43,72,71,252,38,3,242,112,
+91,6,25,65,60,50,59,253,111,23,59,42,50,59,56,53,58,66,2,106,88,135,149,205,
+41,52,85,111,129,124,113,81,59,40,235,160,165,201,133,114,127,144,16,65,78,
+32,54,125,94,153,68,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,
+15,100,113,107,42,56,23,253,115,0,0,2,0,63,255,232,8,241,5,145,0,72,0,83,
+0,0,1,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,
+54,53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,0,39,33,53,
+33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,51,21,20,
+22,51,50,53,52,38,38,35,4,207,153,157,201,158,119,154,69,60,167,151,176,223,
+172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,
+254,255,191,252,162,6,43,38,208,151,137,113,88,87,92,85,112,26,55,188,175,
+150,128,148,167,153,88,78,119,43,72,71,3,203,104,254,221,171,201,228,76,108,
+92,92,202,163,142,181,104,87,76,45,13,37,29,44,45,93,78,98,113,1,5,125,136,
+133,121,205,1,75,43,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,
+15,100,113,107,42,56,23,0,0,4,0,63,255,232,7,166,5,145,0,53,0,69,0,80,0,81,
+0,0,1,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,33,22,17,16,0,33,34,38,
+53,52,54,54,55,54,54,53,52,38,35,34,21,20,23,7,38,38,53,52,55,35,53,33,54,
+54,51,50,23,1,35,22,21,20,6,7,6,6,21,20,33,50,36,53,16,37,21,20,22,51,50,
+53,52,38,38,35,1,7,78,87,92,85,112,26,55,188,175,150,128,148,167,254,231,
+198,254,167,254,197,234,253,89,166,137,164,98,98,86,192,27,152,25,23,47,152,
+4,224,38,208,151,137,113,251,136,15,66,174,180,157,123,1,63,235,1,2,1,147,
+88,78,119,43,72,71,252,33,4,209,47,75,75,150,125,118,132,191,168,7,169,254,
+252,254,243,254,215,180,167,97,129,70,19,21,78,90,71,77,133,51,38,64,45,77,
+46,62,52,159,143,152,63,254,121,74,93,135,152,22,19,76,77,185,211,195,1,24,
+147,15,100,113,107,42,56,23,254,20,0,0,4,0,63,255,144,9,0,5,145,0,57,0,69,
+0,94,0,105,0,0,5,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,
+7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,55,1,55,1,54,54,
+53,52,38,39,55,22,17,20,6,7,23,1,50,22,21,20,6,35,34,38,53,52,54,37,33,53,
+33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,55,21,20,22,
+51,50,53,52,38,38,35,5,137,80,35,72,38,122,158,72,60,167,151,176,223,172,
+139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,137,114,44,25,254,
+236,136,1,6,14,14,89,87,144,196,47,46,89,253,33,50,70,71,49,49,69,67,3,100,
+249,216,6,58,38,208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,
+167,153,88,78,119,43,72,71,112,117,14,15,75,109,92,92,202,163,142,181,104,
+87,76,45,13,35,31,44,45,93,78,98,113,1,5,127,137,7,1,143,85,254,122,28,78,
+50,106,196,99,97,215,254,243,95,152,57,127,3,106,70,51,50,70,71,49,49,72,
+122,159,143,152,63,129,47,75,75,150,125,118,132,191,168,7,15,100,113,107,
+42,56,23,0,5,0,63,255,228,8,67,5,145,0,39,0,51,0,76,0,87,0,88,0,0,1,20,6,
+35,34,38,38,39,46,2,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,23,30,2,
+51,50,54,53,52,38,39,55,22,37,50,22,21,20,6,35,34,38,53,52,54,1,38,35,34,
+6,7,51,50,22,21,20,6,35,34,38,53,53,33,53,33,54,54,51,50,23,1,21,20,22,51,
+50,53,52,38,38,35,1,5,92,201,181,89,135,102,62,52,69,65,44,67,77,103,159,
+51,58,178,129,82,116,91,56,62,76,89,62,95,105,85,86,138,201,253,95,50,68,
+68,50,50,69,69,5,98,87,92,85,112,26,55,188,175,150,128,148,167,250,149,5,
+125,38,208,151,137,113,254,0,88,78,119,43,72,71,251,150,1,159,208,231,61,
+113,106,88,88,36,88,77,126,142,63,68,173,85,140,187,48,96,98,108,91,46,139,
+121,107,191,97,97,215,211,71,50,49,71,70,50,50,71,1,91,47,75,75,150,125,118,
+132,191,168,7,159,143,152,63,254,121,15,100,113,107,42,56,23,252,53,0,4,0,
+68,255,232,8,181,5,145,0,11,0,23,0,81,0,92,0,0,37,50,54,53,52,38,35,34,6,
+21,20,22,33,50,54,53,52,38,35,34,6,21,20,22,1,22,21,20,7,54,51,50,22,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,39,33,53,33,54,
+54,51,50,23,7,38,35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,51,21,20,22,51,
+50,53,52,38,38,35,1,230,123,133,133,115,122,135,134,3,9,123,133,133,115,120,
+137,134,255,0,126,5,102,179,183,211,223,191,118,177,46,50,177,118,189,216,
+223,192,80,136,46,2,130,112,254,76,5,233,38,208,151,137,113,88,87,92,85,112,
+26,55,188,175,150,128,148,167,153,88,78,119,43,72,71,130,128,112,114,132,
+129,112,115,130,128,112,114,132,131,110,115,130,3,73,95,174,30,15,112,218,
+181,177,217,93,89,89,93,208,186,182,217,55,55,11,16,95,156,34,159,143,152,
+63,129,47,75,75,150,125,118,132,191,168,7,15,100,113,107,42,56,23,0,0,4,0,
+82,255,232,9,155,5,145,0,10,0,21,0,99,0,110,0,0,1,22,51,50,54,53,52,38,35,
+34,6,5,38,38,35,34,6,21,20,22,51,50,5,16,2,35,34,38,39,6,6,35,34,2,17,52,
+18,54,51,50,22,21,20,6,35,34,39,6,21,20,22,51,50,54,55,51,22,22,51,50,54,
+53,52,39,6,35,34,38,53,52,54,51,50,23,33,54,54,51,50,23,7,38,35,34,6,7,51,
+50,22,21,20,6,35,34,38,53,53,35,22,22,1,21,20,22,51,50,53,52,38,38,35,1,27,
+77,99,101,106,73,61,80,134,4,145,34,133,81,61,73,106,101,96,1,25,234,198,
+140,167,65,67,166,138,198,234,121,207,126,134,156,190,164,120,97,5,137,125,
+126,152,17,157,16,151,128,124,138,6,99,117,164,190,157,134,67,68,1,185,38,
+208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,224,59,60,1,
+2,88,78,119,43,72,71,3,8,62,83,75,65,73,120,114,112,122,73,65,75,83,192,254,
+253,254,225,89,95,96,88,1,31,1,3,196,1,33,147,149,126,141,168,63,54,62,187,
+192,132,129,126,135,192,187,62,54,63,168,141,125,150,24,143,152,63,129,47,
+75,75,150,125,118,132,191,168,7,88,225,1,57,15,100,113,107,42,56,23,0,6,0,
+56,254,140,8,205,5,145,0,99,0,110,0,122,0,134,0,135,0,136,0,0,1,20,6,35,34,
+39,6,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,39,55,22,21,20,6,
+35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,
+53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,53,33,54,54,51,50,23,7,38,
+35,34,6,7,51,50,22,21,20,6,35,34,38,53,53,35,22,37,21,20,22,51,50,53,52,38,
+38,35,1,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,
+19,1,5,95,169,151,210,141,21,114,108,85,70,35,98,89,253,23,157,8,139,112,
+101,108,87,145,110,195,182,117,158,63,59,166,139,158,188,56,107,120,111,62,
+166,82,88,41,145,62,181,156,124,156,32,73,162,97,83,87,8,254,179,2,228,38,
+208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,218,5,1,110,
+88,78,119,43,72,71,252,203,50,70,71,49,49,69,67,254,108,50,70,71,49,49,69,
+67,14,1,19,3,152,133,150,133,63,117,69,55,63,69,45,73,78,1,5,125,136,94,85,
+113,96,95,140,171,158,176,88,96,95,89,175,128,78,120,104,77,71,87,49,139,
+72,68,63,57,64,99,103,118,154,92,92,89,92,68,65,25,24,159,143,152,63,129,
+47,75,75,150,125,118,132,191,168,7,24,24,15,100,113,107,42,56,23,251,178,
+70,51,50,70,71,49,49,72,70,51,50,70,71,49,49,72,2,127,253,147,0,8,0,63,254,
+140,8,236,5,145,0,46,0,58,0,62,0,74,0,86,0,87,0,112,0,123,0,0,1,22,17,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,
+6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,
+38,53,52,54,3,19,51,19,55,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,
+6,35,34,38,53,52,54,37,1,33,53,33,54,54,51,50,23,7,38,35,34,6,7,51,50,22,
+21,20,6,35,34,38,53,55,21,20,22,51,50,53,52,38,38,35,5,65,196,201,158,119,
+154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,
+2,23,157,9,132,108,100,106,86,86,254,133,50,70,71,49,49,69,67,26,16,158,16,
+237,50,70,71,49,49,69,67,253,154,50,70,71,49,49,69,67,1,4,3,135,249,236,6,
+38,38,208,151,137,113,88,87,92,85,112,26,55,188,175,150,128,148,167,153,88,
+78,119,43,72,71,3,122,215,254,243,202,228,76,108,92,92,202,163,142,181,104,
+87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,131,123,107,195,99,56,70,
+51,50,70,71,49,49,72,251,137,1,69,254,187,163,70,51,50,70,71,49,49,72,70,
+51,50,70,71,49,49,72,18,4,60,159,143,152,63,129,47,75,75,150,125,118,132,
+191,168,7,15,100,113,107,42,56,23,0,5,0,73,255,232,4,80,6,120,0,32,0,44,0,
+56,0,57,0,58,0,0,1,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,7,33,21,39,
+22,22,21,20,6,35,34,38,53,52,55,7,53,1,38,38,35,34,6,21,20,22,51,50,54,3,
+34,6,21,20,22,51,50,54,53,52,38,1,3,1,247,118,132,4,93,138,121,154,163,132,
+164,198,130,1,70,199,72,80,248,229,214,248,146,191,2,149,27,103,62,67,69,
+66,51,66,100,102,147,157,156,148,148,157,158,253,187,18,3,1,38,157,102,86,
+120,108,109,141,211,158,192,128,143,3,43,141,83,182,204,205,172,174,101,2,
+143,1,179,55,61,55,47,50,52,40,253,238,134,116,113,127,127,113,118,132,1,
+248,2,14,0,4,0,52,255,232,6,220,6,120,0,70,0,81,0,93,0,94,0,0,1,22,22,51,
+50,54,53,52,2,39,6,6,35,34,38,53,52,54,51,50,4,18,17,16,0,33,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,21,20,23,54,51,50,22,
+21,20,6,35,34,38,53,52,54,51,50,18,21,20,6,1,38,35,34,6,21,20,22,51,50,54,
+1,38,38,35,34,6,21,20,22,51,50,54,19,3,122,111,146,83,182,174,100,88,42,153,
+104,137,152,166,135,181,1,39,169,254,243,254,250,101,203,121,78,205,127,158,
+180,169,149,100,186,103,16,17,152,130,88,96,11,23,84,48,61,83,70,97,125,185,
+145,211,241,35,1,100,86,91,62,71,62,59,79,95,253,186,93,146,74,74,82,90,86,
+94,146,134,1,30,85,63,240,241,169,1,85,119,91,94,131,120,107,141,245,254,
+70,255,0,254,193,254,188,82,96,89,89,153,137,112,148,67,74,51,115,63,181,
+210,81,74,37,24,79,66,55,62,70,128,108,137,166,254,223,241,98,169,3,238,56,
+59,48,49,57,82,251,241,74,59,66,54,61,71,59,5,187,0,0,3,0,103,0,0,4,200,6,
+120,0,30,0,45,0,46,0,0,55,52,18,55,38,38,53,52,54,51,50,22,18,18,17,21,35,
+53,52,46,2,35,34,14,3,21,21,35,1,51,2,0,35,34,6,21,20,23,54,54,51,50,22,1,
+103,77,91,59,69,212,164,163,244,209,89,185,36,100,141,97,70,107,90,79,31,
+185,3,186,7,65,254,246,192,114,118,73,62,142,79,131,188,254,96,253,225,1,
+57,118,65,153,74,153,168,126,254,228,254,48,254,111,247,221,193,241,212,104,
+50,100,195,238,167,221,3,55,1,11,1,13,87,80,92,76,53,53,150,2,164,0,0,7,0,
+59,254,218,7,188,6,120,0,22,0,34,0,98,0,102,0,103,0,104,0,105,0,0,1,6,35,
+34,38,53,52,54,51,50,22,21,20,6,35,34,39,55,22,51,50,54,53,39,38,38,35,34,
+6,21,20,22,51,50,54,1,22,22,51,50,54,53,52,39,55,22,22,21,20,6,35,34,39,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,
+35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,1,19,51,19,1,3,19,
+3,122,93,138,122,154,163,130,164,200,178,171,156,124,80,92,103,108,96,24,
+28,101,62,67,70,66,52,66,100,2,16,90,127,86,78,84,183,110,116,122,170,141,
+94,64,24,206,151,119,154,69,60,167,151,176,223,172,139,109,132,27,140,13,
+50,43,69,80,135,126,1,2,23,157,9,132,108,97,109,79,83,254,46,16,158,16,1,
+156,18,10,4,42,86,120,108,109,141,213,163,176,182,64,125,51,96,96,150,55,
+61,55,47,50,52,40,254,137,127,88,84,73,177,127,128,88,220,122,143,160,38,
+53,59,168,204,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,
+78,98,113,1,5,125,136,117,86,96,165,83,252,45,1,69,254,187,5,144,2,14,253,
+83,0,0,5,0,56,255,232,6,28,6,120,0,83,0,95,0,96,0,97,0,98,0,0,1,50,22,21,
+20,7,51,21,35,34,39,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,
+54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,
+22,51,50,19,51,22,22,51,50,54,53,52,38,39,33,53,51,54,54,55,6,35,34,38,53,
+52,54,5,38,38,35,34,6,21,20,22,51,50,54,5,1,19,4,161,164,198,130,147,85,53,
+54,81,74,195,182,117,158,63,59,166,139,158,188,56,107,120,111,62,166,82,88,
+41,145,62,181,156,162,169,107,156,85,70,35,98,89,253,23,157,8,140,111,101,
+108,105,94,254,253,241,118,132,4,93,138,121,154,163,1,64,27,103,62,67,69,
+66,51,66,100,253,217,254,242,159,5,178,211,158,192,128,143,3,67,150,92,163,
+181,88,96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,
+118,154,158,130,93,152,100,55,63,69,45,73,78,1,5,124,137,102,92,92,153,49,
+143,38,157,102,86,120,108,109,141,254,55,61,55,47,50,52,40,26,253,146,4,124,
+0,6,0,85,254,218,6,135,6,120,0,54,0,65,0,76,0,80,0,81,0,82,0,0,37,6,6,35,
+34,2,17,52,18,54,51,50,22,21,20,6,35,34,39,6,21,20,22,51,50,54,55,51,22,22,
+51,50,54,53,52,2,39,6,6,35,34,38,53,52,54,51,50,4,18,17,16,2,35,34,38,19,
+38,35,34,6,21,20,22,51,50,54,1,22,51,50,54,53,52,38,35,34,6,1,19,51,19,1,
+1,3,120,65,166,140,198,234,121,207,126,134,156,190,164,120,97,5,139,123,122,
+156,17,157,8,139,108,145,134,100,88,41,153,105,136,153,166,135,183,1,40,166,
+220,231,113,157,246,86,91,62,71,62,59,79,95,252,129,77,99,101,106,73,61,80,
+134,1,217,16,158,16,254,123,1,68,160,95,89,1,31,1,3,196,1,33,147,148,127,
+141,168,63,54,62,185,194,137,124,123,138,221,250,179,1,88,117,90,96,131,120,
+107,141,250,254,69,254,253,254,191,254,199,90,5,17,56,58,49,49,57,82,254,
+0,62,83,75,65,73,120,251,96,1,69,254,187,7,158,253,242,0,5,0,56,255,232,5,
+247,6,120,0,81,0,92,0,93,0,94,0,95,0,0,1,20,6,35,34,39,6,6,7,14,2,21,20,22,
+51,50,19,51,22,22,51,50,54,53,52,39,55,22,21,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,
+51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,22,7,38,38,35,34,6,21,20,22,51,
+50,37,3,3,5,161,197,183,212,144,18,103,123,85,70,35,98,89,253,23,157,8,139,
+112,101,108,87,145,110,195,182,117,158,63,59,166,139,158,188,56,107,120,111,
+62,166,82,88,41,145,62,181,156,122,155,32,158,187,121,113,1,97,138,124,151,
+162,131,167,211,195,30,99,55,67,70,66,53,124,254,49,3,188,4,8,194,201,136,
+56,116,80,55,63,69,45,73,78,1,5,125,136,94,85,113,96,95,140,171,158,176,88,
+96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,
+89,88,188,112,117,22,27,87,121,107,108,142,240,25,60,67,55,47,49,53,14,2,
+14,251,132,0,0,5,0,85,254,218,10,189,6,120,0,13,0,25,0,82,0,86,0,87,0,0,1,
+50,22,23,55,38,36,35,34,21,20,23,54,54,23,34,6,21,20,22,51,50,54,53,52,38,
+3,32,0,17,52,54,55,38,53,52,54,51,32,0,17,20,7,22,22,51,50,54,53,52,2,39,
+55,22,18,21,20,7,22,22,51,50,54,53,52,2,39,55,22,18,21,20,6,35,34,39,6,35,
+34,38,39,6,6,1,19,51,19,1,2,147,140,194,71,9,76,254,238,164,246,50,68,148,
+92,188,230,223,193,193,219,229,184,254,237,254,204,78,77,93,214,184,1,47,
+1,145,33,85,173,104,121,137,201,201,88,235,247,14,76,160,97,121,137,201,201,
+88,235,247,229,204,214,175,115,241,119,215,95,77,237,3,251,16,158,16,250,
+107,4,106,100,101,4,202,224,167,77,66,40,41,159,228,188,193,220,227,186,188,
+228,252,29,1,51,1,27,106,198,81,125,125,156,165,253,251,254,73,123,106,104,
+95,158,135,195,1,28,89,159,117,254,142,231,72,65,83,82,158,135,195,1,28,89,
+159,117,254,142,231,215,249,172,172,106,107,107,106,254,242,1,69,254,187,
+7,158,0,5,0,82,255,232,6,64,6,120,0,9,0,85,0,97,0,98,0,99,0,0,1,22,51,50,
+53,52,38,35,34,6,1,20,6,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,
+55,38,38,53,52,54,55,23,6,6,21,20,23,54,51,50,22,21,20,6,35,34,39,21,20,22,
+51,50,19,51,22,22,51,50,54,53,52,38,39,35,53,51,54,54,55,6,35,34,38,53,52,
+54,51,50,22,7,38,38,35,34,6,21,20,22,51,50,54,1,19,1,12,71,86,192,68,55,80,
+116,5,15,109,103,113,106,191,176,116,167,65,75,172,141,192,223,107,99,55,
+59,171,163,16,94,94,127,17,17,127,153,177,159,109,89,137,138,245,44,157,11,
+138,110,101,108,145,116,151,192,107,119,4,93,138,121,154,163,132,164,198,
+174,28,102,62,67,69,66,51,66,100,253,150,10,2,110,49,120,53,61,96,1,122,133,
+197,60,68,184,127,162,182,89,95,95,89,248,219,148,238,63,39,109,57,111,125,
+5,159,2,50,52,85,41,2,136,115,124,147,52,44,150,149,1,5,125,136,102,92,106,
+161,27,153,38,152,97,86,120,108,109,141,211,43,55,61,55,47,50,52,40,1,244,
+253,242,0,0,5,0,85,255,232,4,225,6,120,0,13,0,25,0,42,0,54,0,55,0,0,1,50,
+22,23,55,38,36,35,34,21,20,23,54,54,23,34,6,21,20,22,51,50,54,53,52,38,3,
+32,0,17,52,54,55,38,53,52,54,51,32,0,17,16,0,1,50,22,21,20,6,35,34,38,53,
+52,54,3,2,147,141,196,68,9,76,254,238,164,246,50,68,148,92,188,230,223,193,
+193,219,229,184,254,237,254,204,78,77,93,214,184,1,47,1,145,254,204,254,237,
+50,70,71,49,49,69,67,36,4,106,100,101,4,202,224,167,77,66,40,41,159,228,188,
+193,220,227,186,188,228,252,29,1,51,1,27,106,198,81,125,125,156,165,253,251,
+254,73,254,235,254,199,2,199,70,51,50,70,71,49,49,72,3,201,0,5,0,85,255,232,
+5,213,6,120,0,30,0,44,0,76,0,86,0,87,0,0,1,22,22,21,20,6,6,35,34,38,39,6,
+6,35,34,2,53,52,54,55,38,38,53,52,54,51,32,4,18,21,20,1,54,51,32,23,55,38,
+38,36,35,34,6,21,20,1,51,22,22,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,
+23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,34,6,21,20,51,50,54,1,5,149,
+32,32,93,169,104,124,157,64,49,158,132,168,190,91,87,53,63,233,207,1,1,1,
+141,209,251,215,167,230,1,101,179,6,60,218,254,231,170,141,141,1,135,157,
+17,132,100,106,123,13,83,133,112,137,130,103,87,68,44,217,147,71,241,254,
+236,102,109,94,125,2,68,60,90,44,55,107,48,79,253,73,2,114,56,125,69,115,
+184,101,84,100,86,98,1,0,239,127,233,92,60,147,71,155,166,220,254,161,188,
+77,1,81,107,239,3,140,212,113,84,83,90,253,42,114,124,126,114,51,58,89,115,
+103,97,111,35,85,97,254,225,236,157,153,124,1,107,74,44,38,90,50,4,55,0,6,
+0,85,254,218,5,213,6,120,0,30,0,44,0,76,0,86,0,90,0,91,0,0,1,22,22,21,20,
+6,6,35,34,38,39,6,6,35,34,2,53,52,54,55,38,38,53,52,54,51,32,4,18,21,20,1,
+54,51,32,23,55,38,38,36,35,34,6,21,20,1,51,22,22,51,50,54,53,52,39,6,35,34,
+38,53,52,54,51,50,23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,34,6,21,20,
+51,50,54,1,19,51,19,3,5,149,32,32,93,169,104,124,157,64,49,158,132,168,190,
+91,87,53,63,233,207,1,1,1,141,209,251,215,167,230,1,101,179,6,60,218,254,
+231,170,141,141,1,135,157,17,132,100,106,123,13,83,133,112,137,130,103,87,
+68,44,217,147,71,241,254,236,102,109,94,125,2,68,60,90,44,55,107,48,79,253,
+208,16,158,16,170,2,114,56,125,69,115,184,101,84,100,86,98,1,0,239,127,233,
+92,60,147,71,155,166,220,254,161,188,77,1,81,107,239,3,140,212,113,84,83,
+90,253,42,114,124,126,114,51,58,89,115,103,97,111,35,85,97,254,225,236,157,
+153,124,1,107,74,44,38,90,50,252,153,1,69,254,187,7,158,0,2,0,63,255,232,
+6,187,6,120,0,98,0,109,0,0,1,16,2,35,34,38,53,52,54,51,50,22,21,20,7,39,54,
+53,52,38,35,34,6,21,20,22,51,50,54,53,53,52,38,35,34,6,7,35,2,33,34,6,21,
+20,22,51,51,21,35,34,6,6,21,20,22,51,50,54,55,23,6,35,34,38,53,52,55,38,53,
+52,54,51,50,22,23,54,51,50,22,23,54,53,53,6,35,34,38,53,52,54,51,50,22,21,
+20,6,7,22,22,3,38,38,35,34,6,21,20,22,51,50,6,148,235,217,164,197,158,120,
+107,130,27,140,13,47,40,53,65,107,104,136,142,176,152,114,142,16,157,33,254,
+253,109,115,124,147,32,56,95,100,64,85,79,63,101,56,98,146,178,155,171,180,
+168,216,173,132,172,70,121,233,79,137,58,107,91,135,121,149,156,132,161,197,
+77,76,57,57,143,28,93,56,65,67,65,49,122,2,13,254,253,254,222,177,150,125,
+170,104,87,76,45,13,35,31,44,45,78,67,88,92,198,192,16,210,247,134,127,1,
+5,99,90,82,110,144,32,76,69,74,87,41,45,125,114,159,136,185,82,98,188,144,
+186,89,100,189,41,40,37,142,35,84,113,103,106,131,213,163,115,157,42,82,221,
+2,242,48,53,48,42,44,45,0,0,6,0,60,255,232,4,165,6,120,0,52,0,63,0,73,0,74,
+0,75,0,76,0,0,1,6,6,35,34,38,53,52,54,51,50,4,18,21,20,7,22,22,21,20,4,33,
+32,36,53,52,55,23,6,21,20,22,51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,
+23,54,53,52,38,39,38,35,34,6,21,20,22,51,50,54,19,38,35,34,6,21,20,51,50,
+54,1,55,3,3,26,38,161,113,136,153,165,137,166,1,14,154,11,57,58,254,218,254,
+234,254,250,254,217,11,162,8,200,195,208,213,24,52,165,104,138,148,155,146,
+117,99,1,67,194,87,98,60,68,62,59,81,99,248,75,95,81,78,133,74,98,1,29,2,
+1,4,169,107,112,131,120,109,139,172,254,208,171,67,62,56,137,80,217,231,239,
+196,63,56,22,39,40,140,151,152,130,71,51,84,87,119,112,105,117,38,19,21,109,
+183,170,42,57,50,49,57,88,253,213,36,40,45,81,65,1,130,159,2,14,0,0,6,0,85,
+254,218,5,201,6,120,0,22,0,36,0,57,0,69,0,73,0,74,0,0,37,6,6,35,34,38,53,
+52,54,55,38,38,53,52,54,51,32,0,17,16,33,34,38,1,54,54,51,50,4,23,55,38,0,
+35,32,21,20,1,51,22,22,51,50,54,53,52,38,38,35,35,34,0,21,20,22,51,50,54,
+19,50,22,21,20,6,35,34,38,53,52,54,3,19,51,19,3,3,14,49,158,132,169,189,91,
+86,54,61,230,203,1,138,1,251,254,147,116,154,254,51,86,199,113,171,1,2,97,
+9,102,254,131,246,254,236,1,135,157,17,128,94,107,106,123,231,155,34,241,
+254,236,102,109,94,125,99,50,70,71,49,49,69,67,43,16,158,16,203,160,86,98,
+255,240,121,239,92,63,146,69,156,165,253,224,254,14,254,8,85,3,195,53,53,
+135,149,4,243,1,10,167,92,253,44,112,126,150,155,152,243,133,254,225,236,
+157,153,124,1,229,70,51,50,70,71,49,49,72,251,239,1,69,254,187,7,158,0,0,
+4,0,85,255,232,5,201,6,120,0,22,0,36,0,57,0,58,0,0,37,6,6,35,34,38,53,52,
+54,55,38,38,53,52,54,51,32,0,17,16,33,34,38,1,54,54,51,50,4,23,55,38,0,35,
+32,21,20,1,51,22,22,51,50,17,52,38,38,35,35,34,6,6,21,20,22,51,50,54,19,3,
+14,49,158,132,169,189,91,86,54,61,230,203,1,138,1,251,254,147,116,154,254,
+51,86,199,113,171,1,2,97,9,102,254,131,246,254,236,1,135,157,8,134,97,214,
+123,232,155,34,157,235,125,102,109,99,130,105,160,86,98,255,240,121,239,92,
+63,146,69,156,165,253,224,254,14,254,8,85,3,195,53,53,135,149,4,243,1,10,
+167,92,253,67,122,139,1,49,150,244,134,128,241,155,156,153,138,5,100,0,5,
+0,85,254,218,5,201,6,120,0,22,0,36,0,57,0,61,0,62,0,0,37,6,6,35,34,38,53,
+52,54,55,38,38,53,52,54,51,32,0,17,16,33,34,38,1,54,54,51,50,4,23,55,38,0,
+35,32,21,20,1,51,22,22,51,50,17,52,38,38,35,35,34,6,6,21,20,22,51,50,54,3,
+19,51,19,3,3,14,49,158,132,169,189,91,86,54,61,230,203,1,138,1,251,254,147,
+116,154,254,51,86,199,113,171,1,2,97,9,102,254,131,246,254,236,1,135,157,
+8,134,97,214,123,232,155,34,157,235,125,102,109,99,130,5,16,158,16,181,160,
+86,98,255,240,121,239,92,63,146,69,156,165,253,224,254,14,254,8,85,3,195,
+53,53,135,149,4,243,1,10,167,92,253,67,122,139,1,49,150,244,134,128,241,155,
+156,153,138,253,198,1,69,254,187,7,158,0,6,0,63,255,228,5,159,6,120,0,48,
+0,59,0,60,0,61,0,62,0,63,0,0,37,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,
+53,52,2,39,6,6,35,34,38,53,52,54,51,50,0,18,17,16,2,35,34,38,38,39,46,2,35,
+34,6,21,20,1,38,35,34,6,21,20,22,51,50,54,5,19,1,3,1,75,159,51,58,177,130,
+108,151,86,62,75,90,61,131,135,202,177,32,167,123,137,152,166,135,229,1,141,
+233,233,216,87,135,105,61,52,69,65,44,67,77,2,14,92,89,62,71,62,59,81,100,
+254,36,242,1,172,177,35,63,69,172,84,140,188,93,149,108,91,46,198,190,234,
+1,169,127,120,129,131,120,107,141,254,235,254,29,254,232,254,246,254,232,
+61,115,104,88,88,36,88,77,125,4,183,34,57,50,49,57,90,166,251,150,4,130,1,
+246,0,0,5,0,59,255,232,6,1,5,178,0,46,0,69,0,81,0,82,0,83,0,0,1,22,17,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,
+6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,1,6,35,34,38,53,52,54,51,
+50,22,21,20,6,35,34,39,55,22,51,50,54,53,39,38,38,35,34,6,21,20,22,51,50,
+54,5,21,5,61,196,201,158,119,154,69,60,167,151,176,223,172,139,109,132,27,
+140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,86,86,254,205,93,
+138,122,154,163,130,164,200,178,171,156,124,80,92,103,108,96,24,28,101,62,
+67,70,66,52,66,100,1,71,3,122,215,254,243,202,228,76,108,92,92,202,163,142,
+181,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,131,123,107,195,
+99,1,17,86,120,108,109,141,213,163,176,182,64,125,51,96,96,150,55,61,55,47,
+50,52,40,26,159,0,0,6,0,59,254,218,6,1,5,178,0,46,0,69,0,81,0,85,0,86,0,87,
+0,0,1,22,17,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,
+53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,1,6,35,34,
+38,53,52,54,51,50,22,21,20,6,35,34,39,55,22,51,50,54,53,39,38,38,35,34,6,
+21,20,22,51,50,54,3,19,51,19,19,23,5,61,196,201,158,119,154,69,60,167,151,
+176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,
+100,106,86,86,254,205,93,138,122,154,163,130,164,200,178,171,156,124,80,92,
+103,108,96,24,28,101,62,67,70,66,52,66,100,81,16,158,16,234,7,3,122,215,254,
+243,202,228,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,
+98,113,1,5,125,136,131,123,107,195,99,1,17,86,120,108,109,141,213,163,176,
+182,64,125,51,96,96,150,55,61,55,47,50,52,40,250,86,1,69,254,187,5,144,159,
+0,5,0,56,255,232,6,59,6,120,0,69,0,80,0,81,0,82,0,83,0,0,37,6,6,35,34,38,
+53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,
+6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,2,39,6,6,35,34,38,53,52,
+54,51,50,4,18,17,16,2,35,34,38,19,38,35,34,6,21,20,22,51,50,54,1,3,3,3,44,
+59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,162,169,
+107,156,85,70,35,98,89,253,23,157,8,139,108,145,134,100,88,41,153,105,136,
+153,166,135,182,1,40,167,220,231,113,157,246,86,91,62,71,62,59,79,95,254,
+117,64,112,160,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,
+103,118,154,158,130,93,152,100,55,63,69,45,73,78,1,5,123,138,221,250,179,
+1,88,117,90,96,131,120,107,141,248,254,68,254,252,254,191,254,199,90,5,17,
+56,58,49,49,57,82,1,112,253,242,253,146,0,0,6,0,56,254,218,6,59,6,120,0,69,
+0,80,0,84,0,85,0,86,0,87,0,0,37,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,
+22,22,51,50,54,53,52,2,39,6,6,35,34,38,53,52,54,51,50,4,18,17,16,2,35,34,
+38,19,38,35,34,6,21,20,22,51,50,54,1,19,51,19,1,19,3,3,44,59,166,139,158,
+188,56,107,120,111,62,166,82,88,41,145,62,181,156,162,169,107,156,85,70,35,
+98,89,253,23,157,8,139,108,145,134,100,88,41,153,105,136,153,166,135,182,
+1,40,167,220,231,113,157,246,86,91,62,71,62,59,79,95,254,125,16,158,16,254,
+246,25,151,160,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,
+103,118,154,158,130,93,152,100,55,63,69,45,73,78,1,5,123,138,221,250,179,
+1,88,117,90,96,131,120,107,141,248,254,68,254,252,254,191,254,199,90,5,17,
+56,58,49,49,57,82,249,210,1,69,254,187,7,158,253,242,253,146,0,5,0,59,255,
+232,9,36,6,120,0,77,0,88,0,89,0,90,0,91,0,0,37,6,6,35,34,38,53,52,54,51,50,
+22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,
+52,2,39,6,6,35,34,38,53,52,54,51,50,0,18,17,20,7,22,22,51,50,54,53,52,2,39,
+55,22,18,21,20,6,35,34,38,39,6,6,35,34,38,3,38,35,34,6,21,20,22,51,50,54,
+19,3,37,3,68,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,
+126,1,2,23,157,9,130,105,131,131,209,178,33,167,123,138,151,165,135,232,1,
+147,234,21,83,165,97,121,137,201,201,88,235,247,229,204,110,200,89,55,174,
+118,110,146,9,88,93,62,71,62,59,83,100,179,4,252,229,160,92,92,202,163,142,
+181,104,87,76,45,13,37,29,44,45,93,78,98,113,1,5,125,136,194,194,239,1,172,
+122,124,128,131,120,108,140,254,236,254,29,254,231,115,90,95,84,158,135,195,
+1,28,89,159,117,254,142,231,215,249,91,91,91,91,77,5,53,33,57,50,49,57,92,
+1,102,253,242,24,0,0,4,0,77,255,232,10,97,6,120,0,65,0,76,0,88,0,89,0,0,1,
+22,22,51,50,54,53,52,2,39,6,6,35,34,38,53,52,54,51,50,4,18,17,20,6,7,22,22,
+51,50,54,53,16,37,55,22,18,21,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,
+38,2,53,52,18,54,51,50,22,18,21,20,1,38,35,34,6,21,20,22,51,50,54,1,34,6,
+21,20,22,51,50,54,53,52,38,19,4,98,76,154,96,151,136,100,88,41,153,105,138,
+151,166,135,182,1,40,167,14,14,87,168,99,121,137,254,110,88,235,247,229,204,
+112,204,92,55,184,130,115,198,92,73,213,129,170,249,131,139,250,156,172,246,
+128,1,6,86,91,62,71,62,59,79,95,252,229,172,203,198,180,174,203,201,139,1,
+53,85,86,221,250,179,1,88,117,90,96,131,120,107,141,248,254,68,254,252,80,
+141,61,101,89,158,135,1,134,178,159,117,254,142,231,215,249,95,96,96,95,95,
+97,93,99,150,1,24,166,166,1,12,148,153,254,236,159,137,3,166,56,57,50,49,
+57,82,254,216,227,197,205,225,231,202,197,224,2,152,0,4,0,85,255,232,4,225,
+6,120,0,13,0,25,0,42,0,43,0,0,1,50,22,23,55,38,36,35,34,21,20,23,54,54,23,
+34,6,21,20,22,51,50,54,53,52,38,3,32,0,17,52,54,55,38,53,52,54,51,32,0,17,
+16,0,1,2,147,140,194,71,9,76,254,238,164,246,50,68,148,92,188,230,223,193,
+193,219,229,184,254,237,254,204,78,77,93,214,184,1,47,1,145,254,204,254,172,
+4,106,100,101,4,202,224,167,77,66,40,41,159,228,188,193,220,227,186,188,228,
+252,29,1,51,1,27,106,198,81,125,125,156,165,253,251,254,73,254,235,254,199,
+6,144,0,4,0,72,255,232,6,10,6,120,0,40,0,51,0,62,0,63,0,0,19,20,0,33,32,0,
+17,52,38,39,6,6,35,34,38,53,52,54,51,50,4,18,21,16,0,33,34,36,2,53,52,54,
+54,51,50,22,21,20,6,35,34,1,38,35,34,6,21,20,22,51,50,54,1,22,51,50,54,53,
+52,38,35,34,6,1,236,1,28,1,2,1,24,1,59,61,59,41,152,102,136,153,166,135,169,
+1,6,145,254,107,254,134,211,254,198,166,108,196,119,134,160,190,164,112,3,
+49,81,96,62,71,62,59,79,95,252,149,74,97,101,107,73,62,91,129,1,89,2,110,
+218,254,250,1,68,1,37,132,253,95,84,92,131,120,107,141,201,254,139,229,254,
+143,254,98,163,1,46,192,150,239,132,150,125,139,170,3,25,56,58,49,49,57,82,
+253,248,54,83,75,65,73,127,3,5,0,0,6,0,66,255,232,5,128,6,120,0,50,0,61,0,
+73,0,86,0,87,0,88,0,0,1,6,6,35,34,38,53,52,54,51,50,22,18,21,20,2,7,22,21,
+20,6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,34,39,30,2,51,50,
+54,54,53,52,38,39,38,35,34,6,21,20,22,51,50,54,1,22,51,50,54,53,52,38,35,
+34,6,21,1,34,6,6,21,20,22,51,50,54,53,52,38,7,3,4,129,41,152,102,137,152,
+166,135,157,244,137,195,195,49,169,153,140,175,61,198,227,194,165,127,157,
+174,166,50,61,44,166,221,62,114,239,138,47,155,78,99,62,71,62,59,76,98,252,
+215,60,75,97,101,74,62,89,108,2,19,28,81,51,85,77,80,81,97,58,84,4,216,85,
+92,131,120,107,141,178,254,195,174,221,254,242,49,55,82,111,129,124,113,81,
+59,40,235,160,165,201,133,114,127,144,16,65,78,32,64,186,166,91,185,196,54,
+59,48,49,57,79,254,28,25,65,60,50,59,112,91,254,58,23,59,42,50,59,56,53,58,
+66,35,5,58,0,0,5,0,59,255,232,6,54,6,120,0,55,0,66,0,67,0,68,0,69,0,0,37,
+6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,
+32,19,51,22,22,51,32,17,52,2,39,6,6,35,34,38,53,52,54,51,50,0,18,17,16,2,
+35,34,38,3,38,35,34,6,21,20,22,51,50,54,19,3,37,3,68,60,167,151,176,223,172,
+139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,130,105,1,6,209,178,
+33,167,123,138,151,165,135,232,1,147,234,223,206,110,146,9,88,93,62,71,62,
+59,83,100,195,6,252,222,160,92,92,202,163,142,181,104,87,76,45,13,37,29,44,
+45,93,78,98,113,1,5,125,136,1,132,239,1,172,122,124,128,131,120,108,140,254,
+236,254,29,254,231,254,246,254,232,77,5,53,33,57,50,49,57,92,1,102,253,242,
+24,0,0,6,0,63,255,232,4,196,6,120,0,44,0,55,0,69,0,70,0,71,0,72,0,0,1,22,
+18,21,16,0,33,34,38,53,52,54,54,55,54,54,55,38,35,34,21,20,23,7,38,38,53,
+52,54,51,50,23,38,39,6,6,35,34,38,53,52,54,51,50,0,37,38,35,34,6,21,20,22,
+51,50,54,1,6,6,7,6,6,21,20,33,50,36,53,52,38,3,3,1,3,162,140,150,254,168,
+254,186,234,253,89,166,137,187,125,4,103,123,204,27,152,26,22,193,184,115,
+104,25,60,42,153,101,137,152,166,135,225,1,35,254,166,80,97,62,71,62,59,76,
+98,1,114,25,186,198,157,123,1,63,239,1,8,67,247,158,1,5,3,245,82,254,255,
+159,254,252,254,233,180,167,97,129,70,19,25,115,130,38,104,51,38,64,48,79,
+47,105,137,29,145,96,88,91,131,120,107,141,254,170,145,54,59,48,49,57,79,
+253,232,137,167,25,19,76,77,185,196,173,91,163,3,127,251,103,2,139,0,0,5,
+0,59,255,144,6,21,5,178,0,22,0,34,0,89,0,90,0,91,0,0,1,6,35,34,38,53,52,54,
+51,50,22,21,20,6,35,34,39,55,22,51,50,54,53,39,38,38,35,34,6,21,20,22,51,
+50,54,1,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,
+34,6,21,20,22,51,32,19,51,22,22,51,50,55,1,55,1,54,53,52,38,39,55,22,17,20,
+7,23,7,39,6,3,23,3,122,93,138,122,154,163,130,164,200,178,171,156,124,80,
+92,103,108,96,24,28,101,62,67,70,66,52,66,100,1,110,122,158,72,60,167,151,
+176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,137,114,
+44,25,254,236,136,1,6,28,89,87,144,196,93,89,140,80,69,72,4,4,42,86,120,108,
+109,141,213,163,176,182,64,125,51,96,96,150,55,61,55,47,50,52,40,251,100,
+75,109,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,
+127,137,7,1,143,85,254,122,57,99,106,196,99,97,215,254,243,189,115,127,87,
+117,29,4,130,159,0,0,7,0,63,255,228,5,92,5,178,0,22,0,34,0,74,0,75,0,76,0,
+77,0,78,0,0,1,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,39,55,22,51,50,54,
+53,39,38,38,35,34,6,21,20,22,51,50,54,1,7,38,38,53,52,54,51,50,22,22,23,30,
+2,51,50,54,53,52,38,39,55,22,17,20,6,35,34,38,38,39,46,2,35,34,6,21,20,3,
+1,7,1,3,46,93,138,122,154,163,130,164,200,178,171,156,124,80,92,103,108,96,
+24,28,101,62,67,70,66,52,66,100,254,97,159,51,58,178,129,82,116,91,56,62,
+76,89,62,95,105,85,86,138,201,201,181,89,135,102,62,52,69,65,44,67,77,58,
+3,205,8,253,33,4,42,86,120,108,109,141,213,163,176,182,64,125,51,96,96,150,
+55,61,55,47,50,52,40,251,159,63,68,173,85,140,187,48,96,98,108,91,46,139,
+121,107,191,97,97,215,254,252,208,231,61,113,106,88,88,36,88,77,126,1,231,
+1,210,159,252,53,0,6,0,63,255,232,6,32,5,178,0,46,0,58,0,70,0,82,0,83,0,84,
+0,0,1,38,39,55,22,51,50,54,53,53,6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,
+22,23,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,1,38,38,35,
+34,6,21,20,22,51,50,54,3,50,54,53,52,38,35,34,6,21,20,22,33,50,54,53,52,38,
+35,34,6,21,20,22,3,1,1,91,76,52,80,92,103,108,96,93,138,122,154,163,130,164,
+200,118,118,70,103,33,49,179,120,188,214,223,191,118,177,46,50,177,118,189,
+216,145,1,210,28,101,62,67,70,66,52,66,100,149,123,133,133,115,122,135,134,
+3,9,123,133,133,115,120,137,134,78,254,47,2,235,13,28,125,51,96,96,12,86,
+120,108,109,141,213,163,144,168,24,18,79,62,89,93,218,181,177,217,93,89,89,
+93,208,186,147,197,1,234,55,61,55,47,50,52,40,251,254,128,112,114,132,129,
+112,115,130,128,112,114,132,131,110,115,130,3,232,254,106,0,255,255,0,56,
+254,140,5,247,6,120,2,34,0,211,0,0,0,3,0,55,5,40,0,0,0,9,0,59,254,140,6,1,
+5,178,0,46,0,69,0,81,0,85,0,97,0,109,0,110,0,111,0,112,0,0,1,22,17,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,
+20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,1,6,35,34,38,53,52,54,51,50,
+22,21,20,6,35,34,39,55,22,51,50,54,53,39,38,38,35,34,6,21,20,22,51,50,54,
+3,19,51,19,37,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,
+52,54,19,21,1,5,61,196,201,158,119,154,69,60,167,151,176,223,172,139,109,
+132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,86,86,254,
+205,93,138,122,154,163,130,164,200,178,171,156,124,80,92,103,108,96,24,28,
+101,62,67,70,66,52,66,100,81,16,158,16,254,84,50,70,71,49,49,69,67,2,204,
+50,70,71,49,49,69,67,86,253,245,3,122,215,254,243,202,228,76,108,92,92,202,
+163,142,181,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,131,123,
+107,195,99,1,17,86,120,108,109,141,213,163,176,182,64,125,51,96,96,150,55,
+61,55,47,50,52,40,250,86,1,69,254,187,163,70,51,50,70,71,49,49,72,70,51,50,
+70,71,49,49,72,4,237,159,251,196,0,0,2,0,73,255,232,4,87,6,120,0,55,0,67,
+0,0,1,22,21,20,7,33,21,39,22,22,21,20,6,35,34,38,53,52,55,7,53,33,54,53,52,
+39,33,53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,21,20,6,1,34,6,21,20,22,51,50,54,53,52,38,2,170,33,26,1,159,199,73,
+79,250,227,214,248,146,191,1,171,53,34,254,66,2,22,153,123,62,105,84,58,93,
+24,49,59,60,53,67,72,182,146,157,189,200,254,188,147,157,156,148,148,157,
+158,3,203,55,50,56,41,143,3,44,142,86,179,202,205,172,174,101,2,143,39,60,
+52,51,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,159,178,
+254,164,134,116,113,127,127,113,118,132,0,2,0,53,255,232,6,151,6,120,0,11,
+0,103,0,0,37,38,38,35,34,6,21,20,22,51,50,54,37,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,21,20,23,54,51,50,22,21,20,
+6,35,34,38,53,52,54,51,50,18,21,20,6,7,22,22,51,50,54,53,52,2,39,35,53,51,
+50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,
+6,7,22,18,2,173,93,146,74,74,82,90,86,94,146,4,31,237,223,104,199,122,79,
+206,126,158,180,169,149,100,186,103,16,17,152,130,88,96,11,23,84,48,61,83,
+70,97,125,185,145,211,241,35,35,110,147,82,137,152,213,190,108,175,153,123,
+62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,148,149,148,149,249,
+74,59,66,54,61,71,59,251,209,255,82,97,90,89,153,137,111,149,67,74,51,115,
+63,181,210,81,74,37,24,79,66,55,62,70,128,108,137,166,254,223,241,98,169,
+71,85,63,156,137,188,1,32,64,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,
+156,190,155,137,170,22,99,254,241,0,0,1,0,96,0,0,4,200,6,120,0,53,0,0,1,50,
+54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,
+7,22,18,17,17,35,53,52,46,2,35,34,14,3,21,21,35,53,16,18,55,33,53,2,215,121,
+137,73,106,83,58,93,24,49,59,60,53,67,72,182,146,157,189,139,133,131,141,
+187,38,103,138,93,70,109,88,79,32,184,133,128,254,244,4,106,30,88,87,82,101,
+53,45,48,40,47,52,90,72,105,156,190,155,133,167,26,102,254,187,254,214,254,
+252,222,192,251,209,97,50,101,192,237,169,222,255,1,30,1,86,88,159,0,0,4,
+0,63,254,218,7,193,6,120,0,63,0,75,0,79,0,110,0,0,1,20,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,
+19,51,22,22,51,50,54,53,52,38,39,55,22,22,51,50,54,53,52,39,55,22,22,21,20,
+6,35,34,39,22,1,50,22,21,20,6,35,34,38,53,52,54,3,19,51,19,19,33,53,33,50,
+54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,
+6,4,206,151,119,154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,
+69,80,135,126,1,2,23,157,9,132,108,97,109,79,83,143,90,127,86,78,84,183,110,
+116,122,170,141,94,64,24,253,51,50,70,71,49,49,69,67,26,16,158,16,198,251,
+209,4,1,153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,206,
+1,92,168,204,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,
+78,98,113,1,5,125,136,117,86,96,165,83,96,127,88,84,73,177,127,128,88,220,
+122,143,160,38,53,1,186,70,51,50,70,71,49,49,72,251,137,1,69,254,187,4,241,
+159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,161,179,0,2,0,
+56,255,232,6,34,6,120,0,107,0,108,0,0,1,22,21,20,7,51,21,35,34,39,22,22,21,
+20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,
+7,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,
+53,52,38,39,33,53,33,54,53,52,39,7,35,53,51,50,54,54,53,52,38,35,34,6,7,50,
+22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,1,5,48,47,28,217,85,53,54,81,
+74,195,182,117,158,63,59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,
+62,181,156,162,169,107,156,85,70,35,98,89,253,23,157,8,140,111,101,108,105,
+94,254,253,1,3,53,37,32,243,165,153,123,62,105,84,58,93,24,49,59,60,53,67,
+72,182,146,157,189,125,252,77,3,225,56,68,56,44,143,3,67,150,92,163,181,88,
+96,95,89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,
+158,130,93,152,100,55,63,69,45,73,78,1,5,124,137,102,92,92,153,49,143,39,
+60,59,45,1,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,126,
+163,253,254,0,3,0,85,254,218,6,106,6,120,0,10,0,86,0,90,0,0,1,22,51,50,54,
+53,52,38,35,34,6,1,20,6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,2,17,52,18,
+54,51,50,22,21,20,6,35,34,39,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,
+52,2,39,35,53,51,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,
+54,51,50,22,1,19,51,19,1,30,77,99,101,106,73,61,80,134,5,21,141,140,150,151,
+227,197,112,156,62,65,166,140,198,234,121,207,126,134,156,190,164,120,97,
+5,139,123,122,156,17,157,8,140,111,113,135,213,190,110,157,153,123,62,105,
+84,58,93,24,49,59,60,53,67,72,182,146,157,189,252,196,16,158,16,3,8,62,83,
+75,65,73,120,1,165,134,168,24,99,254,240,173,213,252,90,94,95,89,1,31,1,3,
+196,1,33,147,148,127,141,168,63,54,62,185,194,137,124,124,137,160,133,188,
+1,32,64,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,249,32,1,69,
+254,187,0,2,0,56,255,232,5,247,6,120,0,105,0,106,0,0,1,20,6,35,34,39,6,6,
+7,14,2,21,20,22,51,50,19,51,22,22,51,50,54,53,52,39,55,22,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,39,6,35,35,53,51,50,54,54,53,52,38,35,34,
+6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,7,22,1,5,95,169,151,210,
+141,21,114,108,85,70,35,98,89,253,23,157,8,139,112,101,108,87,145,110,195,
+182,117,158,63,59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,
+156,124,156,32,73,162,97,83,87,10,58,70,203,157,153,123,62,105,84,58,93,24,
+49,59,60,53,67,72,182,146,157,189,170,18,252,161,3,152,133,150,133,63,117,
+69,55,63,69,45,73,78,1,5,125,136,94,85,113,96,95,140,171,158,176,88,96,95,
+89,175,128,78,120,104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,92,92,
+89,92,68,65,26,29,6,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,
+155,212,80,47,254,48,0,0,3,0,85,254,218,10,189,6,120,0,11,0,96,0,100,0,0,
+1,34,6,21,20,22,51,50,54,53,52,38,1,20,6,7,22,22,21,20,7,22,22,51,50,54,53,
+52,2,39,55,22,18,21,20,7,22,22,51,50,54,53,52,2,39,55,22,18,21,20,6,35,34,
+38,39,6,6,35,34,38,39,6,6,35,34,36,38,53,16,55,35,53,33,50,54,54,53,52,38,
+35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,1,19,51,19,2,159,188,230,
+223,193,193,219,230,1,142,121,121,127,115,29,81,171,106,121,137,201,201,88,
+235,247,14,76,160,97,121,137,201,201,88,235,247,229,204,107,195,87,58,178,
+120,116,207,103,79,245,153,171,254,245,145,219,219,2,148,153,123,62,105,84,
+58,93,24,49,59,60,53,67,72,182,146,157,189,2,86,16,158,16,3,203,228,187,193,
+220,227,186,188,227,1,84,124,163,31,83,230,160,100,88,98,96,158,135,195,1,
+28,89,159,117,254,142,231,72,65,83,82,158,135,195,1,28,89,159,117,254,142,
+231,215,249,86,86,86,86,99,111,104,106,131,248,165,1,45,150,159,38,87,80,
+81,99,50,45,48,40,47,52,90,72,105,156,190,249,32,1,69,254,187,0,2,0,82,255,
+232,6,70,6,120,0,9,0,111,0,0,1,22,51,50,53,52,38,35,34,6,1,22,21,20,6,7,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,38,38,53,52,54,55,23,6,6,21,
+20,23,54,51,50,22,21,20,6,35,34,39,21,20,22,51,50,19,51,22,22,51,50,54,53,
+52,38,39,35,53,51,50,54,54,53,52,39,6,35,33,53,51,50,54,54,53,52,38,35,34,
+6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,1,12,71,86,192,68,55,
+80,116,4,136,57,61,61,207,191,176,116,167,65,75,172,141,192,223,107,99,55,
+59,171,163,16,94,94,127,17,17,127,153,177,159,109,89,137,138,245,44,157,11,
+138,110,101,108,145,116,151,146,69,70,42,51,66,82,254,233,233,153,123,62,
+105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,78,2,110,49,120,53,61,96,
+1,63,63,80,66,112,36,125,228,162,182,89,95,95,89,248,219,148,238,63,39,109,
+57,111,125,5,159,2,50,52,85,41,2,136,115,124,147,52,44,150,149,1,5,125,136,
+102,92,106,161,27,153,19,46,39,57,40,9,159,38,87,80,81,99,50,45,48,40,47,
+52,90,72,105,156,190,155,102,141,0,0,3,0,85,255,232,4,225,6,120,0,43,0,55,
+0,67,0,0,1,22,22,21,20,6,4,35,34,36,38,53,16,55,35,53,33,50,54,54,53,52,38,
+35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,5,34,6,21,20,22,
+51,50,54,53,52,38,3,50,22,21,20,6,35,34,38,53,52,54,3,239,127,115,140,254,
+246,175,171,254,245,145,219,219,2,148,153,123,62,105,84,58,93,24,49,59,60,
+53,67,72,182,146,157,189,121,254,55,188,230,223,193,193,219,230,185,50,70,
+71,49,49,69,67,3,225,83,230,160,158,248,138,131,248,165,1,45,150,159,38,87,
+80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,124,163,53,228,187,193,220,
+227,186,188,227,254,228,70,51,50,70,71,49,49,72,0,0,3,0,85,255,232,5,213,
+6,120,0,31,0,41,0,95,0,0,1,51,22,22,51,50,54,53,52,39,6,35,34,38,53,52,54,
+51,50,23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,34,6,21,20,51,50,54,19,
+20,6,7,22,22,21,20,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,33,
+53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,
+2,192,157,17,132,100,105,124,12,85,132,112,137,130,103,87,69,44,218,147,71,
+241,254,236,102,109,94,125,2,68,61,89,44,55,107,48,79,245,128,125,86,90,1,
+39,39,206,160,124,157,64,49,158,132,168,190,142,132,254,238,3,136,153,123,
+62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,1,120,114,124,124,116,
+53,56,89,115,103,97,111,34,84,97,254,225,236,157,153,124,1,107,74,44,38,90,
+51,2,221,128,164,28,45,158,97,21,19,59,138,78,177,223,84,100,86,98,247,226,
+176,1,17,73,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,0,4,0,
+85,254,218,5,213,6,120,0,31,0,41,0,95,0,99,0,0,1,51,22,22,51,50,54,53,52,
+39,6,35,34,38,53,52,54,51,50,23,38,38,35,35,34,0,21,20,22,51,50,54,1,38,35,
+34,6,21,20,51,50,54,19,20,6,7,22,22,21,20,7,22,22,21,20,6,35,34,38,39,6,6,
+35,34,38,53,52,18,55,33,53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,
+34,38,53,52,54,51,50,22,1,19,51,19,2,192,157,17,132,100,105,124,12,85,132,
+112,137,130,103,87,69,44,218,147,71,241,254,236,102,109,94,125,2,68,61,89,
+44,55,107,48,79,245,128,125,86,90,1,39,39,206,160,124,157,64,49,158,132,168,
+190,142,132,254,238,3,136,153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,
+146,157,189,252,219,16,158,16,1,120,114,124,124,116,53,56,89,115,103,97,111,
+34,84,97,254,225,236,157,153,124,1,107,74,44,38,90,51,2,221,128,164,28,45,
+158,97,21,19,59,138,78,177,223,84,100,86,98,247,226,176,1,17,73,159,38,87,
+80,81,99,50,45,48,40,47,52,90,72,105,156,190,249,32,1,69,254,187,0,0,2,0,
+69,255,232,6,154,6,120,0,76,0,107,0,0,37,39,54,53,52,38,35,34,6,21,20,51,
+32,17,53,52,38,35,34,6,7,35,38,38,35,34,21,20,22,51,51,21,35,34,6,21,20,51,
+50,54,55,23,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,54,54,51,50,18,
+21,20,6,35,34,38,53,52,54,51,50,22,21,20,3,33,53,33,50,54,54,53,52,38,35,
+34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,5,85,140,13,47,40,
+54,64,204,1,29,173,155,101,148,23,157,25,158,116,217,114,132,57,81,132,102,
+164,63,101,56,98,146,178,156,170,80,92,160,206,175,133,178,71,65,174,126,
+228,253,239,213,171,190,154,124,113,124,160,251,125,4,85,153,123,62,105,84,
+58,93,24,49,59,60,53,67,72,182,146,157,189,206,226,13,32,28,41,42,61,52,140,
+1,45,13,167,185,110,94,98,106,138,59,74,144,68,63,120,41,45,125,114,135,114,
+73,109,44,72,156,115,147,78,89,86,81,254,238,236,210,245,154,134,111,148,
+97,84,73,2,190,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,
+161,179,0,0,2,0,70,255,232,4,175,6,120,0,8,0,80,0,0,1,38,35,34,6,21,20,51,
+50,19,22,22,29,2,22,22,21,20,4,33,32,36,53,52,55,23,6,21,20,22,51,50,54,53,
+52,39,6,6,35,34,38,53,52,54,51,50,23,38,38,39,33,53,33,50,54,54,53,52,38,
+35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,3,144,73,96,81,
+78,133,150,91,59,60,59,63,254,219,254,233,254,251,254,216,11,162,8,199,196,
+208,213,22,45,174,108,135,147,155,146,103,95,15,77,63,253,85,2,102,153,123,
+62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,122,2,139,35,40,43,83,
+1,218,46,134,87,13,11,54,144,82,216,231,236,199,63,56,22,39,40,140,151,151,
+131,67,52,79,89,118,112,106,117,31,57,89,32,159,38,87,80,81,99,50,45,48,40,
+47,52,90,72,105,156,190,155,125,162,0,0,4,0,85,254,218,5,201,6,120,0,20,0,
+24,0,36,0,85,0,0,1,51,22,22,51,50,54,53,52,38,38,35,35,34,0,21,20,22,51,50,
+54,19,19,51,19,3,50,22,21,20,6,35,34,38,53,52,54,37,22,18,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,18,55,33,53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,
+20,6,35,34,38,53,52,54,51,50,22,21,20,6,2,192,157,17,128,94,107,106,123,231,
+155,34,241,254,236,102,109,94,125,5,16,158,16,96,50,70,71,49,49,69,67,1,211,
+136,147,192,173,116,154,64,49,158,132,168,190,142,132,254,238,3,124,153,123,
+62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,137,1,120,112,126,150,
+155,152,243,133,254,225,236,157,153,124,253,212,1,69,254,187,4,17,70,51,50,
+70,71,49,49,72,237,77,254,232,178,228,245,85,99,86,98,247,226,176,1,17,73,
+159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,132,168,0,2,0,
+85,255,232,5,201,6,120,0,20,0,69,0,0,1,51,22,22,51,50,17,52,38,38,35,35,34,
+6,6,21,20,22,51,50,54,1,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,
+33,53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,21,20,6,2,192,157,8,134,97,214,123,232,155,34,157,235,125,102,109,99,130,
+1,249,136,147,192,173,116,154,64,49,158,132,168,190,142,132,254,238,3,124,
+153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,137,1,143,122,
+139,1,49,150,244,134,128,241,155,156,153,138,2,196,77,254,232,178,228,245,
+85,99,86,98,247,226,176,1,17,73,159,38,87,80,81,99,50,45,48,40,47,52,90,72,
+105,156,190,155,132,168,0,3,0,85,254,218,5,201,6,120,0,20,0,69,0,73,0,0,1,
+51,22,22,51,50,17,52,38,38,35,35,34,6,6,21,20,22,51,50,54,1,22,18,21,20,6,
+35,34,38,39,6,6,35,34,38,53,52,18,55,33,53,33,50,54,54,53,52,38,35,34,6,7,
+50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,1,19,51,19,2,192,157,8,134,
+97,214,123,232,155,34,157,235,125,102,109,99,130,1,249,136,147,192,173,116,
+154,64,49,158,132,168,190,142,132,254,238,3,124,153,123,62,105,84,58,93,24,
+49,59,60,53,67,72,182,146,157,189,137,253,112,16,158,16,1,143,122,139,1,49,
+150,244,134,128,241,155,156,153,138,2,196,77,254,232,178,228,245,85,99,86,
+98,247,226,176,1,17,73,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,
+190,155,132,168,250,231,1,69,254,187,0,0,2,0,63,255,228,5,91,6,120,0,69,0,
+70,0,0,1,22,18,21,20,6,35,34,38,38,39,46,2,35,34,6,21,20,23,7,38,38,53,52,
+54,51,50,22,23,30,2,51,50,54,53,52,2,39,33,53,33,50,54,54,53,52,38,35,34,
+6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,1,4,32,154,161,202,179,
+89,135,102,62,52,69,65,44,67,77,103,159,51,58,177,130,108,151,86,63,73,92,
+64,95,101,252,200,253,84,3,32,153,123,62,105,84,58,93,24,49,59,60,53,67,72,
+182,146,157,189,158,253,124,3,211,104,254,217,175,202,227,61,113,106,88,88,
+36,88,77,125,143,63,69,172,84,140,188,93,149,109,90,46,133,119,205,1,74,46,
+159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,142,171,252,26,
+0,3,0,63,255,232,6,5,6,120,0,46,0,58,0,89,0,0,1,22,17,20,6,35,34,38,39,6,
+6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,
+19,51,22,22,51,50,54,53,52,38,39,37,50,22,21,20,6,35,34,38,53,52,54,37,33,
+53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,
+21,20,6,5,65,196,201,158,119,154,69,60,167,151,176,223,172,139,109,132,27,
+140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,86,86,254,133,50,
+70,71,49,49,69,67,1,56,252,4,3,206,153,123,62,105,84,58,93,24,49,59,60,53,
+67,72,182,146,157,189,206,3,122,215,254,243,202,228,76,108,92,92,202,163,
+142,181,104,87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,131,123,107,
+195,99,56,70,51,50,70,71,49,49,72,122,159,38,87,80,81,99,50,45,48,40,47,52,
+90,72,105,156,190,155,161,179,0,4,0,63,254,218,6,5,6,120,0,46,0,58,0,89,0,
+93,0,0,1,22,17,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,
+54,53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,37,50,
+22,21,20,6,35,34,38,53,52,54,37,33,53,33,50,54,54,53,52,38,35,34,6,7,50,22,
+21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,1,19,51,19,5,65,196,201,158,119,
+154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,
+2,23,157,9,132,108,100,106,86,86,254,133,50,70,71,49,49,69,67,1,56,252,4,
+3,206,153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,206,253,
+178,16,158,16,3,122,215,254,243,202,228,76,108,92,92,202,163,142,181,104,
+87,76,45,13,35,31,44,45,93,78,98,113,1,5,125,136,131,123,107,195,99,56,70,
+51,50,70,71,49,49,72,122,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,
+190,155,161,179,251,15,1,69,254,187,0,0,2,0,56,255,232,6,30,6,120,0,90,0,
+91,0,0,1,20,6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,
+54,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,
+51,50,19,51,22,22,51,50,54,53,52,2,39,35,53,51,50,54,54,53,52,38,35,34,6,
+7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,1,6,12,137,145,150,150,227,197,
+112,156,62,59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,
+162,169,107,156,85,70,35,98,89,253,23,157,8,140,111,113,135,213,190,108,157,
+153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,252,6,5,31,132,
+168,27,98,254,240,173,213,252,90,94,95,89,175,128,78,120,104,77,71,87,49,
+139,72,68,63,57,64,99,103,118,154,158,130,93,152,100,55,63,69,45,73,78,1,
+5,124,137,160,133,188,1,32,64,159,38,87,80,81,99,50,45,48,40,47,52,90,72,
+105,156,190,252,66,0,0,3,0,56,254,218,6,30,6,120,0,90,0,94,0,95,0,0,1,20,
+6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,54,53,52,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,19,51,
+22,22,51,50,54,53,52,2,39,35,53,51,50,54,54,53,52,38,35,34,6,7,50,22,21,20,
+6,35,34,38,53,52,54,51,50,22,1,19,51,19,1,6,12,137,145,150,150,227,197,112,
+156,62,59,166,139,158,188,56,107,120,111,62,166,82,88,41,145,62,181,156,162,
+169,107,156,85,70,35,98,89,253,23,157,8,140,111,113,135,213,190,110,159,153,
+123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,252,194,16,158,16,
+254,159,5,31,132,168,27,98,254,240,173,213,252,90,94,95,89,175,128,78,120,
+104,77,71,87,49,139,72,68,63,57,64,99,103,118,154,158,130,93,152,100,55,63,
+69,45,73,78,1,5,124,137,160,133,188,1,32,64,159,38,87,80,81,99,50,45,48,40,
+47,52,90,72,105,156,190,249,32,1,69,254,187,3,34,0,1,0,63,255,232,8,244,6,
+120,0,97,0,0,1,20,6,7,22,18,21,20,7,22,22,51,50,54,53,16,37,55,22,18,21,20,
+6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,
+53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,0,39,33,53,33,
+50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,6,5,
+158,157,154,161,8,76,160,97,121,137,254,110,88,235,247,229,204,105,191,86,
+49,154,92,119,154,69,60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,
+80,135,126,1,2,23,157,9,132,108,100,106,254,255,191,252,162,3,206,153,123,
+62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,5,31,142,171,19,104,
+254,217,175,55,47,83,82,158,135,1,134,178,159,117,254,142,231,215,249,82,
+82,81,83,76,108,92,92,202,163,142,181,104,87,76,45,13,37,29,44,45,93,78,98,
+113,1,5,125,136,133,121,205,1,75,43,159,38,87,80,81,99,50,45,48,40,47,52,
+90,72,105,156,190,0,0,2,0,77,255,232,10,97,6,120,0,11,0,97,0,0,1,34,6,21,
+20,22,51,50,54,53,52,38,1,20,6,7,4,17,20,7,22,22,51,50,54,53,52,2,39,55,22,
+18,21,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,2,53,52,18,54,51,50,22,
+18,21,20,7,22,22,51,50,54,53,52,2,39,35,53,51,50,54,54,53,52,38,35,34,6,7,
+50,22,21,20,6,35,34,38,53,52,54,51,50,22,2,108,172,203,198,180,174,203,201,
+4,64,137,145,1,44,13,80,161,98,121,137,201,201,88,235,247,229,204,109,197,
+88,56,178,123,117,207,98,74,217,133,170,249,131,139,250,156,172,246,128,40,
+80,168,99,123,139,213,190,110,159,153,123,62,105,84,58,93,24,49,59,60,53,
+67,72,182,146,157,189,3,224,227,197,205,225,231,202,197,224,1,63,132,168,
+27,196,254,164,70,60,90,82,158,135,195,1,28,89,159,117,254,142,231,215,249,
+88,88,88,88,99,105,100,104,150,1,24,166,166,1,12,148,153,254,236,159,129,
+112,95,92,156,137,188,1,32,64,159,38,87,80,81,99,50,45,48,40,47,52,90,72,
+105,156,190,0,0,2,0,85,255,232,4,225,6,120,0,43,0,55,0,0,1,22,22,21,20,6,
+4,35,34,36,38,53,16,55,35,53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,
+35,34,38,53,52,54,51,50,22,21,20,6,5,34,6,21,20,22,51,50,54,53,52,38,3,239,
+127,115,140,254,246,175,171,254,245,145,219,219,2,148,153,123,62,105,84,58,
+93,24,49,59,60,53,67,72,182,146,157,189,121,254,55,188,230,223,193,193,219,
+230,3,225,83,230,160,158,248,138,131,248,165,1,45,150,159,38,87,80,81,99,
+50,45,48,40,47,52,90,72,105,156,190,155,124,163,53,228,187,193,220,227,186,
+188,227,0,0,2,0,75,255,232,5,219,6,120,0,61,0,72,0,0,1,53,51,50,54,54,53,
+52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,7,22,17,16,
+0,33,34,36,2,53,52,54,54,51,50,22,21,20,6,35,34,39,20,22,22,51,32,36,53,52,
+38,39,7,5,22,51,50,54,53,52,38,35,34,6,3,128,99,153,123,62,105,84,58,93,24,
+49,59,60,53,67,72,182,146,157,189,197,197,254,139,254,164,214,254,192,169,
+112,195,121,132,154,190,164,112,87,135,248,165,1,4,1,30,114,112,31,252,200,
+77,95,101,107,73,61,90,131,3,203,159,38,87,80,81,99,50,45,48,40,47,52,90,
+72,105,156,190,155,227,77,176,255,0,254,235,254,190,162,1,44,192,157,240,
+127,148,127,139,170,52,137,222,121,229,205,119,204,73,1,203,54,83,75,65,73,
+124,0,4,0,66,255,232,5,110,6,120,0,11,0,24,0,97,0,98,0,0,1,34,6,21,21,22,
+51,50,54,53,52,38,1,34,6,6,21,20,22,51,50,54,53,52,38,1,20,6,7,22,21,20,6,
+7,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,34,39,30,
+2,51,50,54,54,53,52,38,39,6,35,35,53,51,50,54,54,53,52,38,35,34,6,7,50,22,
+21,20,6,35,34,38,53,52,54,51,50,22,1,1,157,89,108,60,75,97,101,74,1,16,28,
+81,51,85,77,80,81,97,2,65,87,77,157,191,174,49,169,153,140,175,61,198,227,
+194,165,127,157,174,166,50,61,44,166,221,62,107,231,128,88,87,51,59,115,69,
+153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,253,129,3,242,
+112,91,6,25,65,60,50,59,253,111,23,59,42,50,59,56,53,58,66,3,190,106,147,
+36,97,177,149,205,41,52,85,111,129,124,113,81,59,40,235,160,165,201,133,114,
+127,144,16,65,78,32,54,125,94,75,116,35,5,159,38,87,80,81,99,50,45,48,40,
+47,52,90,72,105,156,190,251,132,0,0,1,0,63,255,232,6,5,6,120,0,77,0,0,1,20,
+6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,
+53,52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,0,39,33,53,33,
+50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,6,5,
+158,157,154,161,201,158,119,154,69,60,167,151,176,223,172,139,109,132,27,
+140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,254,255,191,252,162,
+3,206,153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,5,31,142,
+171,19,104,254,217,175,201,228,76,108,92,92,202,163,142,181,104,87,76,45,
+13,37,29,44,45,93,78,98,113,1,5,125,136,133,121,205,1,75,43,159,38,87,80,
+81,99,50,45,48,40,47,52,90,72,105,156,190,0,3,0,63,255,232,4,186,6,120,0,
+15,0,75,0,76,0,0,37,50,36,53,16,39,35,22,21,20,6,7,6,6,21,20,1,20,6,7,22,
+22,21,16,0,33,34,38,53,52,54,54,55,54,54,53,52,38,35,34,21,20,23,7,38,38,
+53,52,55,35,53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,
+54,51,50,22,1,2,38,235,1,2,231,14,67,174,180,157,123,3,211,116,109,112,113,
+254,167,254,197,234,253,89,166,137,164,98,98,86,192,27,152,25,23,47,152,2,
+131,153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,253,131,
+138,211,195,1,24,148,72,96,135,152,22,19,76,77,185,4,149,122,160,31,84,232,
+140,254,243,254,215,180,167,97,129,70,19,21,78,90,71,77,133,51,38,64,45,77,
+46,62,52,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,252,37,0,
+0,3,0,63,255,144,6,25,6,120,0,57,0,69,0,100,0,0,5,39,6,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,32,
+19,51,22,22,51,50,55,1,55,1,54,54,53,52,38,39,55,22,17,20,6,7,23,1,50,22,
+21,20,6,35,34,38,53,52,54,37,33,53,33,50,54,54,53,52,38,35,34,6,7,50,22,21,
+20,6,35,34,38,53,52,54,51,50,22,21,20,6,5,137,80,35,72,38,122,158,72,60,167,
+151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,9,137,
+114,44,25,254,236,136,1,6,14,14,89,87,144,196,47,46,89,253,33,50,70,71,49,
+49,69,67,1,76,251,240,3,226,153,123,62,105,84,58,93,24,49,59,60,53,67,72,
+182,146,157,189,206,112,117,14,15,75,109,92,92,202,163,142,181,104,87,76,
+45,13,35,31,44,45,93,78,98,113,1,5,127,137,7,1,143,85,254,122,28,78,50,106,
+196,99,97,215,254,243,95,152,57,127,3,106,70,51,50,70,71,49,49,72,122,159,
+38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,161,179,0,0,4,0,63,
+255,228,5,92,6,120,0,39,0,51,0,82,0,83,0,0,1,22,17,20,6,35,34,38,38,39,46,
+2,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,23,30,2,51,50,54,53,52,38,
+39,37,50,22,21,20,6,35,34,38,53,52,54,37,33,53,33,50,54,54,53,52,38,35,34,
+6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,1,4,147,201,201,181,
+89,135,102,62,52,69,65,44,67,77,103,159,51,58,178,129,82,116,91,56,62,76,
+89,62,95,105,85,86,254,178,50,68,68,50,50,69,69,1,9,252,173,3,37,153,123,
+62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,206,253,174,3,122,215,
+254,252,208,231,61,113,106,88,88,36,88,77,126,142,63,68,173,85,140,187,48,
+96,98,108,91,46,139,121,107,191,97,93,71,50,49,71,70,50,50,71,85,159,38,87,
+80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,161,179,252,53,0,0,3,0,68,
+255,232,6,37,6,120,0,63,0,75,0,87,0,0,1,22,21,20,7,54,51,50,22,21,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,39,33,53,33,50,54,
+54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,35,
+1,50,54,53,52,38,35,34,6,21,20,22,33,50,54,53,52,38,35,34,6,21,20,22,3,9,
+126,5,102,179,183,211,223,191,118,177,46,50,177,118,189,216,223,192,80,136,
+46,2,130,112,254,75,3,233,153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,
+146,157,189,206,252,253,139,123,133,133,115,122,135,134,3,9,123,133,133,115,
+120,137,134,3,203,95,174,30,15,112,218,181,177,217,93,89,89,93,208,186,182,
+217,55,55,11,16,95,156,34,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,
+156,190,155,161,179,252,183,128,112,114,132,129,112,115,130,128,112,114,132,
+131,110,115,130,255,255,0,56,254,140,5,247,6,120,2,34,0,245,0,0,0,3,0,55,
+5,38,0,0,0,7,0,63,254,140,6,5,6,120,0,46,0,58,0,62,0,74,0,86,0,87,0,118,0,
+0,1,22,17,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,
+52,38,35,34,6,21,20,22,51,32,19,51,22,22,51,50,54,53,52,38,39,37,50,22,21,
+20,6,35,34,38,53,52,54,3,19,51,19,55,50,22,21,20,6,35,34,38,53,52,54,33,50,
+22,21,20,6,35,34,38,53,52,54,55,1,33,53,33,50,54,54,53,52,38,35,34,6,7,50,
+22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,5,65,196,201,158,119,154,69,
+60,167,151,176,223,172,139,109,132,27,140,13,50,43,69,80,135,126,1,2,23,157,
+9,132,108,100,106,86,86,254,133,50,70,71,49,49,69,67,26,16,158,16,237,50,
+70,71,49,49,69,67,253,154,50,70,71,49,49,69,67,234,1,137,252,4,3,206,153,
+123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,206,3,122,215,254,
+243,202,228,76,108,92,92,202,163,142,181,104,87,76,45,13,35,31,44,45,93,78,
+98,113,1,5,125,136,131,123,107,195,99,56,70,51,50,70,71,49,49,72,251,137,
+1,69,254,187,163,70,51,50,70,71,49,49,72,70,51,50,70,71,49,49,72,18,4,60,
+159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,190,155,161,179,0,2,255,
+35,255,232,5,94,4,106,0,54,0,55,0,0,3,22,22,51,50,54,53,52,39,33,39,33,50,
+4,18,21,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,51,
+50,54,53,52,38,38,35,35,22,21,20,6,35,34,36,39,1,100,99,186,119,86,80,90,
+254,219,2,2,105,246,1,17,153,227,207,161,190,126,101,75,86,65,48,49,62,6,
+10,105,99,127,137,128,202,212,74,49,171,156,156,254,255,119,2,44,3,216,156,
+136,68,68,92,51,159,142,254,237,220,248,254,243,183,144,126,144,74,65,58,
+71,45,42,28,46,87,105,188,179,175,209,94,70,84,136,148,170,188,252,133,0,
+7,253,46,253,14,1,175,4,106,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,0,5,22,22,
+51,50,54,53,52,2,39,55,22,18,21,16,0,33,32,37,1,19,37,5,1,55,253,135,119,
+222,126,209,220,147,159,139,174,161,254,203,254,232,254,220,254,240,4,72,
+35,254,203,252,206,2,152,117,2,94,92,228,212,193,1,79,165,107,189,254,131,
+223,254,224,254,197,208,253,150,2,129,113,158,4,27,237,0,0,5,253,46,253,14,
+4,217,4,130,0,61,0,62,0,63,0,64,0,65,0,0,5,22,22,51,50,54,53,52,38,39,38,
+38,53,52,0,51,50,4,18,21,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,
+39,6,21,20,22,51,50,54,53,52,2,35,34,6,21,20,23,22,21,20,6,35,34,36,39,1,
+1,37,39,253,135,116,230,121,165,160,14,7,8,14,1,28,237,187,1,17,144,232,202,
+161,190,128,99,75,86,65,48,49,62,6,10,105,99,123,141,229,202,172,186,21,20,
+242,240,141,254,214,125,5,51,251,31,4,216,167,2,92,94,152,159,78,131,62,60,
+127,74,227,1,16,165,254,205,195,236,254,237,183,144,124,146,74,65,58,71,45,
+42,28,46,87,105,188,169,227,1,28,189,161,102,150,151,112,235,238,108,100,
+253,150,2,84,45,113,0,0,7,253,106,253,14,1,175,4,106,0,19,0,20,0,21,0,22,
+0,23,0,24,0,25,0,0,5,22,22,51,50,54,53,52,2,39,55,22,18,21,16,0,33,34,36,
+39,1,19,37,3,55,1,253,195,110,196,101,209,220,147,159,139,174,161,254,203,
+254,232,122,254,251,121,4,12,35,254,203,154,117,253,52,42,77,69,228,212,193,
+1,79,165,107,189,254,131,223,254,224,254,197,87,81,253,190,2,129,113,3,125,
+237,250,208,0,0,5,253,106,253,14,4,217,4,130,0,61,0,62,0,63,0,64,0,65,0,0,
+5,22,22,51,50,54,53,52,38,39,38,38,53,52,0,51,50,4,18,21,20,2,35,34,38,53,
+52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,51,50,54,53,52,2,35,34,6,21,
+20,23,22,21,20,6,35,34,36,39,1,1,37,39,253,195,110,196,101,165,160,14,7,8,
+14,1,28,237,187,1,17,144,232,202,161,190,128,99,75,86,65,48,49,62,6,10,105,
+99,123,141,229,202,172,186,21,20,242,240,121,254,251,122,4,208,251,185,4,
+34,126,42,77,69,152,159,78,131,62,60,127,74,227,1,16,165,254,205,195,236,
+254,237,183,144,124,146,74,65,58,71,45,42,28,46,87,105,188,169,227,1,28,189,
+161,102,150,151,112,235,238,86,82,253,190,2,44,85,113,0,0,4,254,151,255,232,
+2,179,4,134,0,19,0,20,0,21,0,22,0,0,1,55,22,22,51,50,54,53,52,2,39,55,22,
+18,21,20,2,35,34,36,19,19,23,254,151,152,99,220,152,123,138,203,199,89,230,
+251,227,212,180,254,227,164,6,105,1,167,91,192,184,165,144,183,1,26,87,159,
+114,254,151,213,237,254,255,198,1,47,2,141,132,0,0,3,254,151,255,232,5,171,
+4,130,0,60,0,61,0,62,0,0,1,55,22,22,51,50,54,53,52,39,38,53,52,54,54,51,50,
+4,18,21,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,51,
+50,54,53,52,2,35,34,6,21,20,23,22,21,20,6,35,34,36,19,19,254,151,152,90,208,
+111,82,77,9,9,128,236,150,184,1,14,142,232,202,161,190,128,99,75,86,65,48,
+49,62,6,10,105,99,123,141,225,198,167,184,8,8,174,147,158,254,239,179,6,1,
+166,92,185,191,84,98,94,91,91,68,147,224,119,164,254,205,196,237,254,238,
+183,144,124,146,74,65,58,71,45,42,28,46,87,105,188,169,228,1,27,184,166,69,
+94,94,69,165,177,215,1,30,2,141,0,1,0,63,255,232,12,5,6,120,0,138,0,0,5,34,
+38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,
+22,51,32,19,51,22,22,51,50,54,53,52,0,39,33,53,33,50,54,54,53,52,38,35,34,
+6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,18,21,20,7,22,22,
+51,50,54,53,52,39,38,53,52,54,54,51,50,4,18,21,20,2,35,34,38,53,52,54,51,
+50,22,21,20,6,35,34,38,39,6,21,20,22,51,50,54,53,52,2,35,34,6,21,20,23,22,
+21,20,6,35,34,39,6,6,4,158,119,154,69,60,167,151,176,223,172,139,109,132,
+27,140,13,50,43,69,80,135,126,1,2,23,157,9,132,108,100,106,254,255,191,252,
+162,3,206,153,123,62,105,84,58,93,24,49,59,60,53,67,72,182,146,157,189,158,
+157,154,161,10,64,133,82,87,88,9,9,128,236,150,185,1,14,141,232,202,161,190,
+128,99,75,86,65,48,49,62,6,10,105,99,123,141,225,198,167,184,8,8,188,152,
+186,153,49,151,24,76,108,92,92,202,163,142,181,104,87,76,45,13,37,29,44,45,
+93,78,98,113,1,5,125,136,133,121,205,1,75,43,159,38,87,80,81,99,50,45,48,
+40,47,52,90,72,105,156,190,155,142,171,19,104,254,217,175,68,47,75,77,92,
+90,94,91,91,68,147,224,119,165,254,205,195,237,254,238,183,144,124,146,74,
+65,58,71,45,42,28,46,87,105,188,169,228,1,27,184,166,69,94,94,69,163,179,
+154,75,79,0,2,0,77,255,232,13,103,6,120,0,126,0,138,0,0,37,6,6,35,34,38,39,
+6,6,35,34,38,2,53,52,18,54,51,50,22,18,21,20,7,22,22,51,50,54,53,52,2,39,
+35,53,51,50,54,54,53,52,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,21,20,6,7,4,17,20,7,22,22,51,50,54,53,52,39,38,53,52,54,54,51,50,4,18,
+21,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,51,50,54,
+53,52,2,35,34,6,21,20,23,22,21,20,6,35,34,38,1,34,6,21,20,22,51,50,54,53,
+52,38,7,28,57,174,116,116,210,93,75,220,132,172,248,130,133,249,163,171,247,
+128,38,84,165,96,123,139,213,190,110,159,153,123,62,105,84,58,93,24,49,59,
+60,53,67,72,182,146,157,189,137,145,1,44,18,66,132,79,87,88,9,9,128,236,150,
+184,1,14,142,232,202,161,190,128,99,75,86,65,48,49,62,6,10,105,99,123,141,
+225,198,167,184,8,8,188,152,94,172,251,2,181,194,207,171,179,198,203,136,
+80,80,100,101,99,102,149,1,26,175,161,1,7,148,153,254,231,170,118,110,97,
+87,156,137,188,1,32,64,159,38,87,80,81,99,50,45,48,40,47,52,90,72,105,156,
+190,155,132,168,27,196,254,164,77,74,76,74,92,90,94,91,91,68,147,224,119,
+164,254,205,196,237,254,238,183,144,124,146,74,65,58,71,45,42,28,46,87,105,
+188,169,228,1,27,184,166,69,94,94,69,163,179,79,3,168,213,203,198,240,210,
+192,206,246,255,255,0,73,253,47,4,198,6,120,2,34,0,20,0,0,0,3,0,129,3,128,
+0,105,255,255,0,73,253,47,4,198,4,106,2,34,0,133,0,0,0,3,0,129,3,128,0,105,
+255,255,0,73,253,47,7,47,5,145,2,34,0,167,0,0,0,3,0,129,3,128,0,105,255,255,
+0,73,253,47,4,198,6,120,2,34,0,205,0,0,0,3,0,129,3,128,0,105,255,255,0,73,
+253,47,4,198,6,120,2,34,0,239,0,0,0,3,0,129,3,128,0,105,255,255,0,56,252,
+168,5,247,4,130,2,34,0,27,0,0,0,3,0,106,4,86,0,0,255,255,0,56,252,168,5,247,
+4,130,2,34,0,139,0,0,0,3,0,106,4,86,0,0,255,255,0,56,252,168,8,205,5,145,
+2,34,0,174,0,0,0,3,0,106,4,86,0,0,255,255,0,56,252,168,5,247,6,120,2,34,0,
+211,0,0,0,3,0,106,4,86,0,0,255,255,0,56,252,168,5,247,6,120,2,34,0,245,0,
+0,0,3,0,106,4,86,0,0,255,255,254,240,251,193,2,229,0,198,0,35,1,77,1,166,
+0,0,0,2,0,97,0,0,255,255,253,170,251,193,1,217,0,0,0,35,1,77,0,154,0,0,0,
+2,0,99,0,0,255,255,252,239,251,193,2,90,0,198,0,35,1,77,1,27,0,0,0,2,0,107,
+0,0,255,255,253,71,251,193,2,40,0,0,0,34,0,109,0,0,0,3,1,77,0,233,0,0,0,7,
+252,109,251,193,2,7,0,0,0,15,0,27,0,42,0,43,0,44,0,45,0,46,0,0,1,53,33,38,
+53,52,54,51,50,22,21,20,14,2,35,55,51,50,54,53,52,38,35,34,6,21,20,3,22,51,
+32,17,52,39,55,22,21,20,0,33,34,39,1,19,39,1,252,109,2,77,22,148,126,129,
+151,58,107,154,129,64,46,100,88,69,56,61,73,235,97,135,2,54,57,141,75,254,
+136,254,149,127,117,2,173,83,96,254,148,253,129,156,62,66,105,146,142,111,
+79,103,72,28,156,59,67,46,66,76,59,51,254,163,17,1,116,116,109,76,139,171,
+250,254,250,22,3,156,254,239,160,252,50,0,255,255,253,81,251,193,2,25,0,0,
+0,35,1,77,0,218,0,0,0,2,0,114,0,0,0,7,252,249,252,78,2,127,0,142,0,46,0,47,
+0,48,0,49,0,50,0,65,0,66,0,0,3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,
+54,53,52,38,35,34,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,55,
+22,21,20,6,35,34,1,5,23,1,23,22,51,32,17,52,39,55,22,21,20,0,33,34,39,1,222,
+50,126,90,123,164,123,102,84,97,22,119,9,28,32,35,43,85,75,83,98,10,135,7,
+81,62,80,87,77,68,137,165,163,152,148,1,45,254,63,92,254,209,183,97,135,2,
+54,57,141,75,254,136,254,149,127,117,2,252,253,211,62,55,141,112,99,123,78,
+67,56,33,10,24,21,23,32,48,47,63,60,81,78,79,81,94,122,93,222,85,68,223,243,
+171,179,2,172,10,33,253,47,26,17,1,116,116,109,76,139,171,250,254,250,22,
+2,139,0,0,8,253,29,251,193,2,153,0,142,0,52,0,56,0,57,0,58,0,59,0,76,0,77,
+0,78,0,0,3,22,51,50,54,53,52,38,39,55,22,17,20,6,35,34,39,6,35,34,38,53,52,
+54,55,54,54,53,52,35,34,21,20,23,7,38,53,52,54,51,50,21,20,6,7,6,6,21,20,
+51,50,54,55,3,55,51,23,3,37,1,1,23,22,36,54,53,52,39,55,22,21,16,0,33,35,
+34,39,7,1,148,24,125,80,87,77,68,137,165,163,152,150,79,93,158,103,114,76,
+93,57,52,82,105,12,129,26,133,114,226,70,72,79,55,79,73,92,11,10,10,140,10,
+26,1,83,253,188,1,25,31,166,1,25,151,63,142,80,254,136,254,149,25,13,14,58,
+2,204,254,39,149,106,138,106,251,95,68,246,254,246,187,197,118,118,94,78,
+64,92,46,28,44,25,49,62,26,22,42,53,60,70,90,166,62,83,36,40,42,28,52,78,
+71,254,47,214,214,3,170,10,254,1,254,103,1,5,79,196,156,124,129,73,158,172,
+254,233,254,220,1,28,3,11,0,0,5,252,109,251,193,2,169,0,133,0,60,0,72,0,73,
+0,74,0,75,0,0,3,6,35,33,53,33,38,53,52,54,51,50,22,22,21,21,20,6,7,6,6,21,
+20,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,
+30,2,21,20,6,6,35,34,38,53,52,55,51,50,54,53,52,38,35,34,6,21,20,3,1,3,169,
+35,38,253,95,2,77,22,150,129,77,126,72,78,75,70,46,213,149,167,31,52,58,59,
+51,31,136,104,219,38,146,25,87,40,47,46,45,84,73,38,117,220,137,174,182,30,
+46,100,88,69,56,61,73,4,1,191,124,253,134,2,153,62,66,105,146,75,126,58,20,
+61,124,44,42,52,32,98,122,97,51,87,78,64,65,71,83,45,95,111,210,24,104,40,
+38,33,70,47,88,111,119,68,114,166,86,128,110,56,200,60,67,47,66,76,60,52,
+1,175,251,193,3,206,0,8,255,101,251,205,6,65,0,255,0,39,0,52,0,53,0,54,0,
+55,0,120,0,121,0,122,0,0,23,55,54,22,21,20,6,35,34,38,53,53,6,21,20,22,51,
+50,54,55,23,6,6,35,34,38,53,52,54,55,54,53,52,38,39,55,22,22,21,20,7,6,21,
+20,22,51,50,54,53,52,38,35,34,19,19,53,1,7,38,53,52,54,51,50,22,21,20,6,7,
+6,6,21,20,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,23,7,38,35,34,6,21,
+20,22,23,30,2,21,20,6,6,35,34,38,53,52,54,55,54,54,53,52,35,34,21,20,23,3,
+249,23,136,169,137,127,116,125,78,143,127,107,179,61,114,97,217,148,195,223,
+130,114,17,45,47,94,80,74,40,5,53,52,49,53,61,57,48,83,40,1,178,129,26,133,
+114,112,116,77,83,78,40,213,149,167,31,52,58,59,51,31,136,104,219,38,146,
+25,87,40,47,46,45,84,73,38,117,220,137,174,182,64,105,66,43,82,105,216,104,
+114,1,6,113,114,98,112,125,116,3,69,110,101,114,66,64,109,84,77,194,159,107,
+183,44,86,37,56,69,24,130,45,114,80,59,205,30,28,53,55,43,34,43,54,253,111,
+3,129,115,253,70,42,53,60,70,90,87,85,66,86,43,42,46,29,98,122,97,51,87,78,
+64,65,71,83,45,95,111,210,24,104,40,38,33,70,47,88,111,119,68,114,166,86,
+129,109,65,90,57,36,39,26,51,62,26,185,1,252,0,0,6,252,109,252,80,2,93,0,
+143,0,30,0,42,0,43,0,44,0,45,0,46,0,0,3,22,51,50,54,53,52,38,39,55,22,21,
+16,0,35,34,38,39,33,53,33,38,53,52,54,51,50,22,21,20,6,39,51,50,54,53,52,
+38,35,34,6,21,20,1,55,5,3,116,88,141,165,171,64,51,141,130,254,253,243,126,
+210,57,253,143,2,66,10,153,133,123,144,173,222,57,100,88,65,53,64,76,1,223,
+182,254,231,71,253,136,78,198,196,93,215,81,70,229,232,254,253,254,240,112,
+101,153,53,54,125,147,143,110,129,138,141,60,67,46,67,79,69,44,1,179,4,117,
+252,193,0,8,255,101,251,206,5,211,0,255,0,67,0,80,0,90,0,91,0,92,0,93,0,94,
+0,95,0,0,5,22,21,16,0,35,34,38,39,6,6,35,34,38,53,52,54,55,54,53,52,38,39,
+55,22,22,21,20,7,55,54,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,55,54,
+54,51,50,22,21,20,6,35,34,39,22,22,51,50,54,53,52,38,39,5,6,21,20,22,51,50,
+54,53,52,38,35,34,1,22,51,50,53,52,38,35,34,6,1,55,1,23,55,5,81,130,254,253,
+244,162,217,27,67,151,101,195,223,130,114,17,45,47,94,80,74,13,23,136,169,
+137,127,116,125,78,143,127,93,166,62,27,163,110,114,124,134,129,75,59,20,
+133,109,172,175,64,51,252,26,5,53,52,49,53,61,57,48,1,207,50,64,143,51,46,
+64,85,254,142,2,2,17,205,127,82,229,232,254,254,254,239,165,148,37,36,194,
+159,107,183,44,86,37,56,69,24,130,45,114,80,59,71,1,6,113,114,98,112,125,
+116,3,69,110,101,114,53,54,111,128,116,100,106,113,23,84,91,199,195,93,215,
+81,96,30,28,53,55,43,34,43,54,254,121,25,95,39,47,81,2,44,115,254,172,113,
+117,0,0,6,252,109,252,80,2,108,1,160,0,40,0,52,0,53,0,54,0,55,0,56,0,0,1,
+33,53,33,38,53,52,54,51,50,22,21,20,6,7,22,51,50,54,53,52,39,54,54,53,52,
+38,39,55,22,22,21,20,7,22,21,20,4,35,34,38,19,51,50,54,53,52,38,35,34,6,21,
+20,1,23,1,1,254,223,253,142,2,66,10,153,133,123,144,173,150,83,156,163,179,
+133,65,47,58,63,109,88,86,81,96,254,254,243,137,214,43,57,100,88,65,53,64,
+76,1,121,2,1,50,254,168,253,132,153,53,54,125,147,143,110,129,138,8,78,160,
+151,173,146,51,83,51,57,98,47,109,71,144,89,116,81,138,180,216,230,110,1,
+0,60,67,46,67,79,69,44,1,179,113,1,134,251,59,0,8,255,101,251,206,5,232,0,
+255,0,12,0,22,0,99,0,100,0,101,0,102,0,103,0,104,0,0,23,6,21,20,22,51,50,
+54,53,52,38,35,34,1,22,51,50,53,52,38,35,34,6,37,22,21,20,4,35,34,38,39,6,
+6,35,34,38,53,52,54,55,54,53,52,38,39,55,22,22,21,20,7,55,54,22,21,20,6,35,
+34,38,53,53,6,21,20,22,51,50,54,55,54,54,51,50,22,21,20,6,35,34,39,22,51,
+50,54,53,52,39,54,54,53,52,38,39,55,22,22,21,20,37,55,1,23,1,222,5,53,52,
+49,53,61,57,48,1,207,50,64,143,51,46,64,85,2,172,96,254,251,242,174,226,27,
+67,151,101,195,223,130,114,17,45,47,94,80,74,13,23,136,169,137,127,116,125,
+78,143,127,93,166,62,27,163,110,114,124,134,129,75,59,44,235,165,186,133,
+65,47,58,63,109,88,86,251,162,5,2,9,178,1,24,248,30,28,53,55,43,34,43,54,
+254,121,25,95,39,47,81,246,138,180,215,231,164,149,37,36,194,159,107,183,
+44,86,37,56,69,24,130,45,114,80,59,71,1,6,113,114,98,112,125,116,3,69,110,
+101,114,53,54,111,128,116,100,106,113,23,175,160,151,173,146,51,83,51,57,
+98,47,109,71,144,89,116,229,115,254,172,113,1,134,0,10,253,5,251,206,3,220,
+0,199,0,15,0,53,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,0,1,22,51,50,36,
+53,52,39,55,22,21,20,0,33,34,39,37,22,21,20,4,35,34,38,53,52,54,51,50,22,
+21,20,6,35,34,39,22,51,50,54,53,52,39,54,54,53,52,38,39,55,22,22,21,20,1,
+22,51,50,53,52,38,35,34,6,19,23,1,5,37,1,1,253,45,144,152,254,1,13,78,141,
+101,254,153,254,186,161,177,6,119,96,254,251,242,203,231,175,135,114,124,
+134,129,75,59,44,235,165,186,133,65,47,58,63,109,88,86,252,248,50,64,143,
+51,46,64,85,196,175,1,3,254,88,254,248,253,214,2,71,254,91,38,182,165,123,
+111,77,134,181,234,254,255,43,254,138,180,215,231,215,179,143,189,116,100,
+106,113,23,175,160,151,173,146,52,83,51,56,98,47,109,71,144,88,116,254,109,
+25,95,39,47,81,1,75,113,1,134,52,51,252,219,2,129,255,255,0,20,251,206,2,
+226,255,134,0,3,0,97,1,36,254,192,255,255,255,246,251,206,4,35,255,78,0,3,
+0,98,2,222,254,192,255,255,255,236,251,206,2,208,254,79,0,3,0,99,2,66,254,
+192,255,255,0,20,251,193,5,98,0,22,0,3,0,100,3,113,255,27,255,255,0,20,251,
+206,3,243,254,79,0,3,0,101,2,241,254,192,255,255,0,20,251,206,4,67,255,134,
+0,3,0,102,3,5,254,192,255,255,0,20,251,193,4,91,255,249,0,3,0,103,3,22,255,
+107,255,255,0,20,251,206,3,243,254,80,0,3,0,104,2,241,254,192,255,255,0,20,
+251,193,6,32,254,252,0,3,0,105,3,194,255,107,255,255,0,20,251,193,5,40,254,
+168,0,3,0,106,3,162,255,25,255,255,0,0,251,206,4,49,255,134,0,3,0,107,3,17,
+254,192,255,255,0,20,251,206,2,254,254,79,0,3,0,108,2,113,254,192,255,255,
+0,0,251,206,3,168,254,79,0,3,0,109,2,185,254,192,255,255,0,40,251,193,3,208,
+254,250,0,3,0,110,2,225,255,107,255,255,0,20,251,206,4,75,254,92,0,3,0,111,
+3,7,254,205,0,2,253,213,251,206,2,54,253,226,0,14,0,26,0,0,1,53,33,38,53,
+52,54,51,50,22,21,20,6,6,35,55,51,50,54,53,52,38,35,34,6,21,20,253,213,2,
+77,22,150,129,126,149,105,173,170,64,46,100,88,69,56,61,73,251,206,153,62,
+66,105,146,142,111,101,126,52,153,60,67,47,66,76,60,52,0,255,255,0,40,251,
+193,3,182,254,250,0,3,0,113,2,215,255,107,255,255,0,0,251,206,3,142,254,79,
+0,3,0,114,2,175,254,192,255,255,0,40,251,193,3,182,254,250,0,3,0,115,2,215,
+255,107,255,255,0,20,251,206,3,230,255,78,0,3,0,116,2,155,254,192,0,4,255,
+206,251,206,4,22,254,254,0,46,0,47,0,48,0,49,0,0,1,6,6,35,34,38,53,52,54,
+51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,50,54,55,51,22,22,51,
+50,54,53,52,38,39,55,22,21,20,6,35,34,1,5,23,1,247,50,126,90,123,164,123,
+102,84,97,22,119,9,28,32,35,43,85,75,83,98,10,135,7,81,62,80,87,77,68,137,
+165,163,152,148,1,44,254,48,62,252,67,62,55,141,112,99,123,78,67,56,33,10,
+24,21,23,32,48,47,63,60,81,78,79,81,94,122,93,222,85,68,223,243,171,179,2,
+172,10,33,255,255,0,30,251,193,4,102,255,169,0,3,0,118,3,37,255,27,255,255,
+0,20,251,206,4,60,255,78,0,3,0,119,2,247,254,192,255,255,0,40,251,193,4,80,
+255,249,0,3,0,120,3,11,255,107,0,4,0,4,251,206,3,116,0,15,0,39,0,52,0,53,
+0,54,0,0,1,55,54,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,55,23,6,6,
+35,34,38,53,52,54,55,54,53,52,38,39,55,22,22,21,20,7,6,21,20,22,51,50,54,
+53,52,38,35,34,55,53,1,152,23,136,169,137,127,116,125,78,143,127,107,179,
+61,114,97,217,148,195,223,130,114,17,45,47,94,80,74,40,5,53,52,49,53,61,57,
+48,74,254,158,1,6,113,114,98,112,125,116,3,69,110,101,114,66,64,109,84,77,
+194,159,107,183,44,86,37,56,69,24,130,45,114,80,59,205,30,28,53,55,43,34,
+43,54,240,115,0,3,0,20,251,206,3,193,0,36,0,64,0,65,0,66,0,0,19,7,38,53,52,
+54,51,50,22,21,20,6,7,6,6,21,20,51,50,54,53,52,38,38,39,46,2,53,52,54,51,
+50,23,7,38,35,34,6,21,20,22,23,30,2,21,20,6,6,35,34,38,53,52,54,55,54,54,
+53,52,35,34,21,20,23,3,175,129,26,133,114,112,116,77,83,78,40,213,149,167,
+31,52,58,59,51,31,136,104,219,38,146,25,87,40,47,46,45,84,73,38,118,220,136,
+174,182,64,105,66,43,82,105,188,84,253,186,42,53,60,70,90,87,85,66,86,43,
+42,46,29,98,122,97,51,87,78,64,65,71,83,45,95,111,210,24,104,40,38,33,70,
+47,88,111,119,68,115,166,85,128,110,65,90,57,36,39,26,51,62,26,185,1,251,
+0,0,4,253,104,251,193,1,63,0,0,0,14,0,15,0,16,0,17,0,0,1,22,51,32,17,52,39,
+55,22,21,16,0,33,34,39,23,1,3,253,130,97,135,2,54,63,142,80,254,136,254,149,
+127,117,208,2,44,31,252,130,17,1,170,124,129,73,158,172,254,233,254,220,22,
+49,4,63,254,204,0,255,255,0,0,251,206,4,105,254,79,0,3,0,124,3,16,254,192,
+255,255,255,236,251,206,3,186,254,173,0,3,0,125,2,219,254,173,255,255,0,30,
+251,206,3,184,255,138,0,3,0,126,2,137,254,252,255,255,255,206,251,206,3,244,
+255,152,0,3,0,127,2,233,254,192,255,255,0,20,251,206,3,1,255,191,0,3,0,128,
+1,6,254,220,255,255,0,20,251,193,4,91,254,251,0,3,0,129,3,21,254,251,0,4,
+255,193,251,200,3,235,254,254,0,36,0,37,0,38,0,39,0,0,19,7,38,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,21,20,6,35,34,38,38,39,38,38,
+35,34,6,21,20,19,23,37,168,143,42,46,146,108,83,130,72,71,89,52,78,80,80,
+68,140,165,163,151,69,107,84,59,63,69,42,51,55,167,168,1,150,251,247,47,50,
+127,65,102,137,68,105,103,67,98,118,94,225,81,68,223,243,171,179,39,73,87,
+94,53,61,55,87,2,19,33,43,0,0,4,255,226,251,206,3,204,253,245,0,19,0,31,0,
+43,0,44,0,0,1,6,35,34,38,53,52,54,51,50,23,54,51,50,22,21,20,6,35,34,1,34,
+6,21,20,22,51,50,54,53,52,38,1,50,54,53,52,38,35,34,6,21,20,22,3,1,213,69,
+158,128,144,151,129,155,67,70,158,127,145,152,128,156,254,237,70,76,74,67,
+68,77,74,1,98,70,76,74,67,68,77,75,132,252,63,113,147,122,120,145,112,112,
+145,123,121,145,1,146,71,62,64,73,73,61,63,73,254,242,71,62,62,75,72,61,63,
+74,1,163,255,255,0,10,251,206,4,91,254,79,0,3,0,132,3,2,254,192,0,5,0,20,
+251,206,3,198,255,174,0,28,0,38,0,39,0,40,0,41,0,0,5,22,21,16,0,35,34,38,
+53,52,54,51,50,22,21,20,6,35,34,39,22,22,51,50,54,53,52,38,39,1,22,51,50,
+53,52,38,35,34,6,19,23,55,3,68,130,254,245,252,196,231,175,135,114,124,134,
+129,74,59,23,137,114,180,184,64,51,253,239,50,64,143,51,46,64,85,150,228,
+151,82,229,232,254,253,254,240,218,176,144,188,116,100,106,113,23,87,88,198,
+196,93,215,81,254,33,25,95,39,47,82,1,76,113,117,0,255,255,0,20,251,206,6,
+213,255,192,0,3,0,63,2,155,255,31,0,6,0,20,251,206,3,219,0,191,0,38,0,48,
+0,49,0,50,0,51,0,52,0,0,1,22,21,20,4,35,34,38,53,52,54,51,50,22,21,20,6,35,
+34,39,22,22,51,50,54,53,52,39,54,54,53,52,38,39,55,22,22,21,20,1,22,51,50,
+53,52,38,35,34,6,19,23,19,5,3,123,96,254,243,250,209,239,175,135,114,124,
+134,129,74,59,23,146,123,173,194,133,65,47,58,63,109,88,86,252,218,50,64,
+143,51,46,64,85,217,190,230,254,182,254,202,138,180,215,231,215,179,144,188,
+116,100,106,113,23,87,88,161,150,173,146,51,83,51,57,98,47,109,71,144,89,
+116,254,110,25,95,39,47,82,1,76,113,1,134,52,0,255,255,0,40,251,206,4,34,
+255,7,0,3,0,76,2,240,255,120,255,255,0,40,251,205,4,72,255,143,0,3,0,77,2,
+240,0,0,255,255,0,40,251,193,4,29,0,198,0,35,1,77,2,222,0,0,0,3,0,97,1,56,
+0,0,255,255,0,60,251,193,4,107,0,0,0,35,1,77,3,44,0,0,0,3,0,99,2,146,0,0,
+255,255,0,50,251,193,5,157,0,198,0,35,1,77,4,94,0,0,0,3,0,107,3,67,0,0,255,
+255,0,50,251,193,5,19,0,0,0,35,0,109,2,235,0,0,0,3,1,77,3,212,0,0,0,5,254,
+27,251,205,3,181,255,143,0,14,0,30,0,42,0,43,0,44,0,0,3,22,51,32,17,52,39,
+55,22,21,20,0,33,34,39,37,53,33,38,53,52,54,51,50,22,21,20,14,2,35,55,51,
+50,54,53,52,38,35,34,6,21,20,37,1,8,97,135,2,54,57,141,75,254,136,254,149,
+127,117,254,61,2,77,22,148,126,129,151,58,107,154,129,64,46,100,88,69,56,
+61,73,2,128,254,56,252,115,17,1,116,116,109,76,139,171,250,254,250,22,205,
+156,62,66,105,146,142,111,79,103,72,28,156,59,67,46,66,76,59,51,238,1,33,
+255,255,0,50,251,193,4,250,0,0,0,35,1,77,3,187,0,0,0,3,0,114,2,225,0,0,0,
+7,0,50,252,78,5,184,0,142,0,46,0,47,0,48,0,49,0,50,0,65,0,66,0,0,1,6,6,35,
+34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,50,54,
+55,51,22,22,51,50,54,53,52,38,39,55,22,21,20,6,35,34,1,5,23,3,23,22,51,32,
+17,52,39,55,22,21,20,0,33,34,39,1,2,91,50,126,90,123,164,123,102,84,97,22,
+119,9,28,32,35,43,85,75,83,98,10,135,7,81,62,80,87,77,68,137,165,163,152,
+148,1,43,253,178,102,150,163,97,135,2,54,57,141,75,254,136,254,149,127,117,
+3,105,253,211,62,55,141,112,99,123,78,67,56,33,10,24,21,23,32,48,47,63,60,
+81,78,79,81,94,122,93,222,85,68,223,243,171,179,2,172,9,34,253,47,26,17,1,
+116,116,109,76,139,171,250,254,250,22,2,139,0,0,8,0,40,251,193,5,164,0,142,
+0,52,0,56,0,57,0,58,0,59,0,76,0,77,0,78,0,0,1,22,51,50,54,53,52,38,39,55,
+22,17,20,6,35,34,39,6,35,34,38,53,52,54,55,54,54,53,52,35,34,21,20,23,7,38,
+53,52,54,51,50,21,20,6,7,6,6,21,20,51,50,54,55,3,55,51,23,3,37,1,1,23,22,
+36,54,53,52,39,55,22,21,16,0,33,35,34,39,23,1,2,119,24,125,80,87,77,68,137,
+165,163,152,150,79,93,158,103,114,76,93,57,52,82,105,12,129,26,133,114,226,
+70,72,79,55,79,73,92,11,10,10,140,10,8,1,64,253,194,1,20,31,165,1,25,152,
+63,142,80,254,136,254,149,26,12,14,168,2,2,254,39,149,106,138,106,251,95,
+68,246,254,246,187,197,118,118,94,78,64,92,46,28,44,25,49,62,26,22,42,53,
+60,70,90,166,62,83,36,40,42,28,52,78,71,254,47,214,214,3,170,10,254,1,254,
+103,1,5,79,196,156,124,129,73,158,172,254,233,254,220,1,28,3,11,255,255,253,
+213,251,206,5,221,0,36,0,34,1,66,0,0,0,3,1,76,2,28,0,0,255,255,0,20,251,206,
+6,250,0,36,0,34,1,75,16,0,0,3,1,76,3,57,0,0,255,255,253,213,251,206,5,78,
+255,174,0,34,1,66,0,0,0,3,1,87,1,136,0,0,255,255,0,20,251,206,6,238,0,15,
+0,34,1,75,16,0,0,3,1,87,3,40,0,0,255,255,253,213,251,206,5,124,0,191,0,34,
+1,66,0,0,0,3,1,89,1,161,0,0,255,255,0,20,251,206,7,28,0,191,0,34,1,75,16,
+0,0,3,1,89,3,65,0,0,255,255,253,95,251,193,4,247,0,191,0,34,1,77,247,0,0,
+3,1,89,1,28,0,0,255,255,254,246,252,170,1,196,0,98,0,2,0,97,6,156,255,255,
+253,252,252,80,2,41,255,208,0,3,0,98,0,228,255,66,255,255,253,231,252,80,
+0,203,254,209,0,3,0,99,0,61,255,66,255,255,252,246,251,232,2,68,0,61,0,3,
+0,100,0,83,255,66,255,255,254,62,252,80,2,29,254,209,0,3,0,101,1,27,255,66,
+255,255,254,62,252,80,2,109,0,8,0,3,0,102,1,47,255,66,255,255,254,118,251,
+193,2,189,255,249,0,3,0,103,1,120,255,107,255,255,254,62,252,80,2,29,254,
+210,0,3,0,104,1,27,255,66,255,255,254,6,251,193,4,18,254,252,0,3,0,105,1,
+180,255,107,0,4,253,237,251,193,3,1,0,0,0,68,0,79,0,80,0,81,0,0,1,38,53,52,
+54,51,50,22,23,54,51,50,22,23,54,51,50,22,21,20,7,39,54,54,53,52,38,35,34,
+7,22,21,20,6,7,22,23,7,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,54,53,52,
+38,35,34,7,35,38,38,35,34,6,21,20,23,5,38,38,35,34,21,20,22,51,50,54,23,3,
+254,11,30,127,94,74,105,44,79,142,67,102,35,90,123,95,123,30,133,7,10,50,
+44,80,58,6,53,52,44,21,144,13,24,60,140,80,132,142,137,124,100,164,64,22,
+21,70,67,111,24,139,10,72,53,43,50,17,1,221,43,111,68,121,73,76,57,97,141,
+6,253,127,69,78,85,106,52,55,107,46,46,92,108,83,78,69,34,15,50,15,42,50,
+93,33,38,69,134,51,73,94,26,68,48,30,31,103,90,83,98,65,66,30,70,40,84,89,
+123,59,64,50,42,40,40,223,45,45,59,34,32,18,240,4,63,0,255,255,254,28,252,
+80,2,77,0,8,0,3,0,107,1,45,255,66,255,255,254,7,252,80,0,241,254,209,0,3,
+0,108,0,100,255,66,255,255,253,225,252,80,1,137,254,209,0,3,0,109,0,154,255,
+66,255,255,254,51,251,193,1,219,254,250,0,3,0,110,0,236,255,107,255,255,254,
+30,252,67,2,85,254,209,0,3,0,111,1,17,255,66,255,255,252,229,253,63,1,70,
+255,187,0,2,0,112,120,187,255,255,254,51,251,193,1,193,254,250,0,3,0,113,
+0,226,255,107,255,255,253,225,252,80,1,111,254,209,0,3,0,114,0,144,255,66,
+255,255,254,51,251,193,1,193,254,250,0,3,0,115,0,226,255,107,255,255,254,
+18,252,80,1,228,255,208,0,3,0,116,0,153,255,66,255,255,253,50,252,80,1,122,
+255,208,0,3,0,117,0,57,255,66,255,255,253,50,251,232,1,122,255,208,0,3,0,
+118,0,57,255,66,255,255,254,62,252,80,2,102,255,208,0,3,0,119,1,33,255,66,
+255,255,254,182,251,193,2,222,255,249,0,3,0,120,1,153,255,107,255,255,255,
+23,251,193,2,135,0,65,0,3,0,121,255,178,255,66,255,255,254,63,251,193,1,236,
+0,84,0,3,0,122,255,222,255,66,0,6,253,5,253,14,1,4,0,199,0,15,0,16,0,17,0,
+18,0,19,0,20,0,0,1,22,51,50,36,53,52,39,55,22,21,16,0,33,34,39,5,19,39,55,
+3,253,45,144,152,252,1,15,78,141,101,254,146,254,193,161,177,1,251,25,9,189,
+187,254,1,38,222,195,134,120,77,142,193,254,248,254,215,43,100,2,129,113,
+51,254,117,0,255,255,254,28,252,80,2,133,254,209,0,3,0,124,1,44,255,66,0,
+6,254,0,251,193,1,206,0,0,0,38,0,39,0,40,0,41,0,42,0,43,0,0,3,54,54,51,50,
+22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,23,7,38,
+38,53,52,54,51,50,22,55,55,3,19,3,26,58,104,69,114,143,89,105,96,76,69,62,
+57,65,82,4,144,9,81,61,57,62,64,81,96,103,91,144,113,76,97,119,2,57,128,6,
+254,51,79,55,149,111,91,163,84,106,59,106,59,54,72,94,82,84,92,67,62,55,100,
+65,107,84,164,94,107,149,54,78,113,253,165,254,218,4,63,0,0,9,254,119,251,
+193,2,17,0,0,0,37,0,47,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,0,1,22,21,20,
+6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,35,34,39,22,51,50,54,54,
+53,52,39,55,22,22,21,20,6,37,22,51,50,53,52,35,34,6,21,1,34,6,21,20,22,51,
+50,53,52,38,19,55,3,19,3,3,1,26,29,119,118,107,123,35,131,141,138,116,100,
+118,217,27,37,76,203,47,153,96,125,137,80,64,126,253,103,41,56,108,87,57,
+61,1,82,36,58,47,49,95,61,12,2,50,189,155,6,252,249,33,49,70,77,76,70,46,
+35,29,140,96,103,130,98,78,177,7,41,32,97,84,161,176,68,121,181,99,125,166,
+228,17,68,60,56,49,254,239,30,29,22,29,51,29,30,1,220,113,254,44,1,222,252,
+117,4,63,0,255,255,253,42,252,80,1,80,0,26,0,3,0,127,0,69,255,66,0,8,255,
+7,251,193,1,244,0,37,0,35,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,0,3,38,53,
+52,54,51,50,23,38,39,55,22,22,23,22,22,21,20,6,35,34,38,53,52,54,55,54,54,
+55,38,35,34,6,21,20,23,37,6,6,7,6,6,21,20,22,51,50,54,53,52,38,55,39,39,1,
+19,3,229,13,151,150,52,27,32,94,136,78,59,6,99,110,229,210,148,162,97,145,
+83,65,6,36,57,63,80,6,1,111,17,123,116,63,68,83,81,134,160,36,36,2,5,254,
+217,187,6,253,213,42,39,96,96,4,134,121,68,114,160,83,43,170,106,161,172,
+112,102,72,96,42,25,56,50,5,40,34,22,21,64,79,97,30,17,40,35,40,34,107,92,
+48,92,195,113,95,253,183,254,105,4,63,0,0,5,253,50,251,193,1,121,0,0,0,53,
+0,54,0,55,0,56,0,57,0,0,19,22,18,21,20,7,39,54,53,52,39,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,50,
+54,55,51,22,51,50,54,53,52,38,39,37,5,1,3,203,87,87,23,142,37,3,52,148,71,
+104,40,47,124,91,123,164,123,102,84,97,22,119,9,28,32,35,43,85,75,83,98,10,
+135,11,133,66,69,45,58,254,1,1,208,254,249,62,254,233,111,254,241,160,118,
+97,23,122,101,19,33,126,55,62,61,56,141,112,99,123,78,67,56,33,10,24,21,23,
+32,48,47,63,60,81,78,160,76,69,59,108,64,133,188,253,92,4,63,255,255,253,
+62,252,80,1,104,255,208,0,3,0,130,0,39,255,66,255,255,254,37,252,80,2,15,
+254,209,0,3,0,131,1,4,255,66,255,255,254,28,252,80,2,109,254,209,0,3,0,132,
+1,20,255,66,0,2,0,147,255,231,1,145,5,145,0,3,0,15,0,0,1,35,3,51,3,50,22,
+21,20,6,35,34,38,53,52,54,1,78,117,51,219,111,60,67,69,58,59,68,66,1,146,
+3,255,251,107,71,66,67,73,72,68,67,70,0,0,4,0,133,4,73,2,190,6,120,0,3,0,
+7,0,8,0,9,0,0,1,3,35,3,33,3,35,11,2,1,72,41,113,41,2,57,40,113,41,92,1,6,
+89,253,240,2,16,253,240,2,16,254,17,2,14,0,0,2,0,51,0,0,4,246,5,134,0,27,
+0,31,0,0,1,3,33,21,33,3,35,19,33,3,35,19,33,53,33,19,33,53,33,19,51,3,33,
+19,51,3,33,21,1,33,19,33,3,213,64,1,27,254,203,82,145,85,254,220,82,144,83,
+254,249,1,32,63,254,237,1,43,82,147,85,1,40,84,142,86,1,8,252,236,1,37,65,
+254,218,3,95,254,199,137,254,99,1,157,254,99,1,157,137,1,57,135,1,160,254,
+96,1,160,254,96,135,254,199,1,57,0,0,5,0,100,255,232,6,66,5,158,0,11,0,22,
+0,26,0,37,0,48,0,0,1,34,38,53,52,54,51,50,22,21,20,6,39,50,17,52,38,35,34,
+6,21,20,22,1,1,35,1,19,34,38,53,16,33,50,22,21,20,6,39,50,54,53,16,35,34,
+6,21,20,22,1,143,143,156,150,149,148,160,157,151,158,78,80,78,71,71,3,246,
+252,213,157,3,43,116,143,156,1,43,148,160,157,151,80,78,158,78,71,71,2,53,
+229,209,215,220,225,210,216,222,129,1,53,155,153,154,154,153,156,2,208,250,
+122,5,134,250,98,229,208,1,179,227,208,215,222,129,152,156,1,50,153,153,155,
+153,0,0,3,0,133,4,73,1,159,6,120,0,3,0,4,0,5,0,0,1,3,35,3,37,3,1,72,41,113,
+41,1,26,13,6,89,253,240,2,16,31,253,242,0,0,3,0,100,253,14,2,139,6,120,0,
+13,0,14,0,15,0,0,1,51,2,2,17,16,18,19,35,38,2,17,16,18,19,19,1,220,173,184,
+183,182,187,175,183,193,192,86,77,6,89,254,239,253,177,254,195,254,179,253,
+181,254,234,236,2,105,1,92,1,81,2,89,1,15,249,139,0,3,0,133,253,14,2,172,
+6,120,0,13,0,14,0,15,0,0,1,35,18,18,17,16,2,3,51,22,18,17,16,2,3,3,1,52,173,
+186,181,182,187,175,184,192,192,37,90,253,14,1,22,2,73,1,62,1,77,2,75,1,22,
+239,253,153,254,165,254,174,253,167,8,123,249,136,0,3,0,84,0,0,4,16,6,120,
+0,14,0,15,0,16,0,0,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,39,3,2,147,41,1,138,
+28,254,136,243,176,174,158,182,240,254,139,29,1,133,43,94,24,6,89,254,119,
+111,189,30,254,188,96,1,102,254,154,96,1,68,30,189,111,1,137,31,249,136,0,
+3,0,102,0,0,4,41,4,175,0,11,0,12,0,13,0,0,1,33,21,33,17,35,17,33,53,33,17,
+51,7,3,2,145,1,152,254,104,147,254,104,1,152,147,75,9,3,7,146,254,90,1,166,
+146,1,168,69,251,150,0,0,3,0,104,254,253,1,206,0,253,0,6,0,7,0,8,0,0,37,23,
+6,3,35,18,55,37,17,1,143,14,52,124,133,71,31,1,0,243,23,199,254,232,1,31,
+215,10,254,235,0,3,0,82,0,0,2,66,4,106,0,3,0,4,0,5,0,0,19,53,33,21,1,19,82,
+1,240,254,234,19,1,243,160,160,254,13,4,106,0,1,0,147,255,232,1,145,0,253,
+0,11,0,0,37,50,22,21,20,6,35,34,38,53,52,54,1,16,61,68,70,59,58,67,65,253,
+70,67,68,72,72,68,66,71,0,3,0,151,253,14,3,144,6,120,0,3,0,4,0,5,0,0,1,1,
+35,1,37,3,3,144,253,184,177,2,73,254,237,37,6,89,246,181,9,75,31,249,136,
+0,0,2,0,100,255,232,4,47,5,158,0,11,0,23,0,0,5,34,2,17,16,18,51,50,18,17,
+16,2,39,50,18,17,16,2,35,34,2,17,16,18,2,72,238,246,238,246,238,249,241,246,
+158,147,147,158,159,144,144,24,1,117,1,102,1,117,1,102,254,139,254,154,254,
+142,254,151,153,1,19,1,47,1,47,1,18,254,241,254,206,254,206,254,240,0,0,2,
+0,182,0,0,2,215,5,148,0,10,0,11,0,0,33,35,17,52,55,6,7,7,39,1,51,7,2,215,
+176,8,34,57,192,94,1,140,149,63,3,220,165,87,36,47,157,121,1,51,154,0,0,1,
+0,98,0,0,4,41,5,158,0,27,0,0,33,33,53,1,62,3,53,52,38,35,34,6,7,39,54,51,
+50,22,21,20,6,6,7,1,21,33,4,41,252,57,1,82,114,137,95,39,134,124,94,158,100,
+96,204,246,206,235,73,134,129,254,194,2,201,150,1,73,110,145,136,118,59,113,
+124,61,78,121,172,200,175,105,183,173,124,254,206,8,0,1,0,92,255,232,4,31,
+5,158,0,40,0,0,1,21,22,22,21,20,4,33,34,38,39,53,22,22,51,50,54,53,52,38,
+35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,33,50,22,21,20,6,2,195,172,176,
+254,222,254,241,128,190,84,91,215,98,185,185,205,204,142,144,173,193,141,
+125,98,167,104,90,198,1,3,216,237,157,2,234,7,22,173,143,202,223,38,41,168,
+45,51,139,139,124,125,153,140,125,100,114,54,69,123,152,190,163,135,176,0,
+0,3,0,43,0,0,4,106,5,144,0,10,0,18,0,19,0,0,1,35,17,35,17,33,53,1,51,17,51,
+33,17,52,55,35,6,7,1,1,4,106,212,175,253,68,2,176,187,212,254,125,11,9,35,
+60,254,81,2,108,1,65,254,191,1,65,153,3,182,252,83,1,169,119,208,77,85,253,
+178,3,19,0,0,1,0,129,255,232,4,31,5,134,0,28,0,0,55,53,22,22,51,50,54,53,
+52,38,35,34,7,39,19,33,21,33,3,54,51,50,4,21,20,4,33,34,38,129,73,211,97,
+171,189,183,183,113,137,90,54,2,222,253,188,34,117,108,227,1,9,254,221,255,
+0,117,198,55,170,44,52,158,148,143,144,30,57,2,153,164,254,113,23,225,196,
+224,253,41,0,2,0,113,255,233,4,51,5,158,0,23,0,37,0,0,1,21,38,35,34,2,3,51,
+54,51,50,22,21,20,2,35,34,0,17,16,0,33,50,22,3,52,38,35,34,6,6,21,20,22,22,
+51,50,54,3,195,76,101,237,243,13,12,111,235,195,229,251,214,226,254,241,1,
+78,1,79,45,105,35,147,136,87,146,86,79,142,92,138,151,5,139,152,24,254,237,
+254,219,172,233,203,223,254,253,1,73,1,42,1,161,1,161,10,252,55,141,154,71,
+124,66,95,172,98,172,0,1,0,90,255,255,4,47,5,134,0,6,0,0,5,1,33,53,33,21,
+1,1,34,2,77,252,235,3,213,253,185,1,4,227,164,139,251,4,0,3,0,100,255,232,
+4,45,5,158,0,23,0,35,0,48,0,0,1,22,22,21,20,4,35,34,38,53,52,54,55,38,38,
+53,52,54,51,50,22,21,20,6,5,54,54,53,52,38,35,34,6,21,20,22,23,6,6,21,20,
+22,51,50,54,53,52,38,39,2,231,178,148,254,253,220,235,255,151,152,136,120,
+240,197,202,236,132,254,214,134,118,140,122,119,139,117,112,144,133,162,148,
+143,164,143,164,2,238,84,183,118,178,211,200,183,122,191,68,76,175,109,155,
+183,182,158,106,169,3,53,129,88,94,108,109,93,87,124,213,60,147,101,111,128,
+133,112,89,139,62,0,0,2,0,102,255,232,4,41,5,158,0,23,0,37,0,0,23,53,22,51,
+50,18,19,35,6,35,34,38,53,52,18,51,50,0,17,16,0,33,34,38,19,20,22,51,50,54,
+54,53,52,38,38,35,34,6,209,79,101,239,243,12,13,113,235,194,226,255,212,225,
+1,15,254,176,254,176,43,110,41,143,137,96,150,76,80,142,92,135,153,4,154,
+27,1,18,1,36,170,232,202,222,1,7,254,182,254,215,254,94,254,95,10,3,201,142,
+151,78,118,63,95,173,97,172,0,3,0,147,255,232,1,145,4,106,0,11,0,23,0,24,
+0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,50,22,21,20,6,35,34,38,53,52,54,
+3,1,16,61,68,71,58,57,68,65,60,61,68,70,59,58,67,65,60,3,158,71,68,68,71,
+71,68,68,71,253,95,70,67,68,72,72,68,66,71,3,109,0,0,5,0,104,254,253,1,218,
+4,106,0,11,0,18,0,19,0,20,0,21,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,23,
+6,3,35,18,55,1,3,3,1,53,63,66,69,60,57,68,65,152,15,54,122,136,75,30,1,9,
+3,149,3,158,71,68,68,71,71,68,68,71,253,85,23,206,254,239,1,44,202,254,245,
+1,21,3,109,0,0,5,0,102,0,0,4,43,4,201,0,6,0,7,0,8,0,9,0,10,0,0,37,1,53,1,
+21,9,2,23,19,19,4,43,252,59,3,197,252,252,3,4,252,194,5,13,10,218,1,168,102,
+1,225,160,254,148,254,188,1,142,146,1,245,251,150,0,0,5,0,115,0,0,4,29,4,
+106,0,3,0,7,0,8,0,9,0,10,0,0,19,53,33,21,1,53,33,21,1,19,3,115,3,170,252,
+86,3,170,254,46,7,2,3,64,145,145,254,104,146,146,2,194,251,150,3,7,0,5,0,
+102,0,0,4,43,4,201,0,6,0,7,0,8,0,9,0,10,0,0,19,1,1,53,1,21,1,1,17,1,23,102,
+3,4,252,252,3,197,252,59,2,17,1,42,7,1,121,1,66,1,110,160,254,31,102,254,
+88,3,144,251,150,3,7,146,0,2,0,65,255,232,3,108,5,158,0,27,0,38,0,0,1,53,
+52,54,55,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,6,7,6,6,21,21,7,
+50,22,21,20,6,35,34,38,53,52,1,71,71,101,121,84,123,125,79,151,98,63,190,
+213,196,212,48,83,111,94,70,63,59,66,68,57,61,66,1,146,40,128,149,83,97,105,
+84,92,100,38,48,143,101,182,165,77,117,95,91,76,110,102,21,149,71,66,68,72,
+72,68,137,0,3,0,164,253,13,2,111,6,120,0,7,0,8,0,9,0,0,1,33,17,33,21,33,17,
+33,1,19,2,111,254,53,1,203,254,229,1,27,254,224,165,253,13,9,76,147,247,219,
+8,215,249,136,0,3,0,151,253,14,3,144,6,120,0,3,0,4,0,5,0,0,1,1,35,1,37,3,
+1,72,2,72,178,253,185,1,152,111,6,89,246,181,9,75,31,249,136,0,0,3,0,161,
+253,12,2,108,6,120,0,7,0,8,0,9,0,0,19,33,17,33,53,33,17,33,19,3,161,1,27,
+254,229,1,203,254,53,208,36,253,160,8,38,147,246,179,9,108,249,136,0,2,0,
+78,0,0,4,70,5,158,0,6,0,7,0,0,19,1,51,1,35,9,2,78,1,178,102,1,224,160,254,
+143,254,185,1,101,2,0,3,158,252,98,2,223,253,33,254,0,0,2,255,252,254,197,
+3,145,0,0,0,3,0,4,0,0,1,33,53,33,37,3,145,252,107,3,149,254,56,254,197,131,
+184,0,0,3,0,57,253,14,2,201,6,120,0,27,0,28,0,29,0,0,19,54,54,53,17,52,54,
+51,21,6,21,17,20,7,21,22,21,17,20,23,21,38,38,53,17,52,38,35,19,19,57,126,
+124,215,191,228,223,223,228,197,209,120,130,122,54,1,254,1,91,99,2,89,154,
+169,147,6,187,253,175,211,38,13,37,213,253,172,188,2,148,1,167,158,2,84,98,
+95,254,151,6,120,0,3,1,233,253,15,2,127,6,120,0,3,0,4,0,5,0,0,1,51,17,35,
+19,17,1,233,150,150,94,6,90,246,181,2,241,6,120,0,0,3,0,71,253,14,2,214,6,
+120,0,28,0,29,0,30,0,0,1,6,6,21,17,20,6,35,53,54,53,17,52,55,53,38,53,17,
+52,38,39,53,22,22,21,17,20,22,51,1,19,2,214,131,119,214,191,227,223,223,110,
+117,200,205,121,129,254,186,28,1,105,2,92,97,253,168,153,171,148,6,186,2,
+80,211,39,12,39,211,2,85,94,95,2,147,3,167,155,253,171,99,94,4,122,249,136,
+0,0,4,0,102,0,0,4,43,4,106,0,23,0,24,0,25,0,26,0,0,19,53,54,51,50,22,23,22,
+22,51,50,54,55,21,6,35,34,38,39,38,38,35,34,6,1,19,3,102,101,145,70,123,77,
+67,99,47,55,125,56,103,143,71,123,76,69,98,48,52,128,1,140,31,67,2,56,160,
+108,32,33,29,27,64,57,158,110,32,33,30,26,66,1,251,251,150,3,7,255,255,0,
+82,0,0,2,66,4,106,2,2,1,153,0,0,0,3,0,82,0,0,3,174,4,106,0,3,0,4,0,5,0,0,
+19,53,33,21,1,19,82,3,92,254,71,12,1,243,160,160,254,13,4,106,0,3,0,82,0,
+0,7,174,4,106,0,3,0,4,0,5,0,0,19,53,33,21,1,19,82,7,92,252,20,23,1,243,160,
+160,254,13,4,106,0,3,0,65,4,100,1,160,6,120,0,6,0,7,0,8,0,0,19,39,54,19,51,
+2,7,55,3,77,12,55,121,143,69,34,135,1,4,100,22,213,1,10,254,234,223,6,2,14,
+0,3,0,65,4,100,1,128,6,120,0,6,0,7,0,8,0,0,1,23,6,3,35,18,55,39,19,1,113,
+15,53,123,143,68,34,61,236,6,89,22,204,254,237,1,24,221,31,253,242,0,0,4,
+0,65,4,100,3,1,6,120,0,6,0,13,0,14,0,15,0,0,1,39,54,19,51,2,7,33,39,54,19,
+51,2,7,19,1,1,198,15,56,123,133,71,32,253,197,12,56,120,131,71,32,224,1,20,
+4,100,22,210,1,13,254,222,211,22,217,1,6,254,222,211,2,20,253,242,0,0,4,0,
+65,4,100,2,239,6,120,0,6,0,13,0,14,0,15,0,0,1,23,6,3,35,18,55,33,23,6,3,35,
+18,55,39,1,1,101,15,51,125,131,64,36,2,59,15,51,125,136,75,30,82,1,4,6,89,
+22,198,254,231,1,10,235,22,198,254,231,1,43,202,31,253,242,0,3,0,147,255,
+232,5,193,0,253,0,11,0,23,0,35,0,0,37,50,22,21,20,6,35,34,38,53,52,54,33,
+50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,1,16,61,
+68,70,59,58,67,65,2,85,61,66,68,59,60,65,63,2,84,63,67,69,61,58,66,64,253,
+70,67,68,72,72,68,66,71,71,66,67,73,73,67,66,71,71,66,67,73,73,67,66,71,0,
+5,0,131,0,0,4,12,4,132,0,11,0,12,0,13,0,14,0,15,0,0,1,23,1,1,7,1,1,39,1,1,
+55,1,3,19,3,23,3,166,102,254,164,1,90,102,254,162,254,170,107,1,90,254,164,
+107,1,90,22,13,13,5,4,132,105,254,164,254,164,105,1,90,254,166,105,1,92,1,
+90,107,254,161,1,69,251,150,3,7,146,0,0,5,0,102,0,0,4,43,4,150,0,10,0,14,
+0,25,0,26,0,27,0,0,1,50,22,21,20,6,35,34,38,53,52,1,53,33,21,5,50,22,21,20,
+6,35,34,38,53,52,3,19,2,72,55,57,61,51,53,62,254,145,3,197,254,29,55,57,61,
+51,53,62,116,60,4,150,63,60,60,65,64,61,123,253,223,146,146,153,63,60,60,
+65,64,61,123,2,142,251,150,0,0,3,0,102,0,0,4,43,4,106,0,3,0,4,0,5,0,0,19,
+53,33,21,1,19,102,3,197,254,13,16,2,117,146,146,1,245,251,150,0,2,0,162,0,
+0,3,242,5,134,0,27,0,28,0,0,19,33,38,38,35,35,53,33,21,33,22,22,23,33,21,
+33,6,6,7,1,35,1,53,51,50,54,55,33,19,162,1,139,21,169,160,45,3,80,254,125,
+50,58,8,1,15,254,245,15,188,173,1,135,209,254,125,45,180,160,12,254,115,154,
+4,52,105,102,131,131,39,104,64,131,140,164,23,253,150,2,137,90,100,106,254,
+175,0,3,1,142,254,227,2,51,5,158,0,3,0,4,0,5,0,0,1,17,51,17,3,19,1,142,165,
+61,8,254,227,6,187,249,69,1,29,254,242,0,0,4,1,142,254,227,3,245,5,158,0,
+3,0,7,0,8,0,9,0,0,1,17,51,17,33,17,51,17,19,19,3,80,165,253,153,165,140,8,
+254,227,6,187,249,69,6,187,249,69,1,29,254,242,0,0,0,15,0,186,0,3,0,1,4,9,
+0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,128,0,3,0,1,
+4,9,0,3,0,72,0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,0,30,0,214,0,
+3,0,1,4,9,0,6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,9,0,8,0,42,1,
+86,0,3,0,1,4,9,0,9,0,40,1,128,0,3,0,1,4,9,0,10,0,96,1,168,0,3,0,1,4,9,0,11,
+0,62,2,8,0,3,0,1,4,9,0,12,0,60,2,70,0,3,0,1,4,9,0,13,2,150,2,130,0,3,0,1,
+4,9,0,14,0,52,5,24,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,
+32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,75,0,97,0,110,0,110,0,97,0,100,
+0,97,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,
+0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,75,0,97,0,110,
+0,110,0,97,0,100,0,97,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,
+0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,
+115,0,75,0,97,0,110,0,110,0,97,0,100,0,97,0,78,0,111,0,116,0,111,0,32,0,105,
+0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,
+0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,
+0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,
+0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,
+110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,
+0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,
+0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,
+0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,
+0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,
+0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,
+0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,
+105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,
+0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,
+0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,
+0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,
+0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,
+0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,
+0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,
+0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,
+105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,
+44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,
+0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,
+0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,
+103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,
+0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,
+0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,102,0,102,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,
+0,12,0,0,0,0,0,160,0,2,0,24,0,4,0,54,0,1,0,55,0,55,0,3,0,56,0,56,0,1,0,57,
+0,61,0,3,0,62,0,63,0,1,0,64,0,69,0,3,0,70,0,70,0,1,0,71,0,71,0,3,0,72,0,77,
+0,1,0,88,0,89,0,1,0,94,0,94,0,2,0,95,0,96,0,1,0,97,0,132,0,2,0,133,0,164,
+0,1,0,165,1,16,0,2,1,17,1,17,0,3,1,18,1,23,0,1,1,24,1,25,0,2,1,26,1,26,0,
+1,1,27,1,30,0,2,1,31,1,31,0,1,1,32,1,86,0,2,1,87,1,91,0,1,1,92,1,142,0,2,
+0,2,0,5,0,55,0,55,0,1,0,57,0,61,0,2,0,64,0,69,0,2,0,71,0,71,0,2,1,17,1,17,
+0,2,0,0,0,1,0,0,0,10,0,52,0,82,0,2,107,110,100,50,0,14,107,110,100,97,0,18,
+0,8,0,0,0,14,0,0,0,0,255,255,0,2,0,0,0,1,0,0,255,255,0,2,0,0,0,1,0,2,98,108,
+119,109,0,14,100,105,115,116,0,20,0,0,0,1,0,0,0,0,0,3,0,1,0,2,0,3,0,4,0,10,
+5,154,6,186,9,130,0,4,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,58,0,70,0,1,0,1,0,55,
+0,2,0,6,0,20,0,54,0,0,0,73,0,73,0,35,0,133,0,164,0,36,0,167,0,202,0,68,0,
+205,0,236,0,104,0,239,1,14,0,136,0,1,0,0,0,6,0,1,253,244,255,206,0,168,1,
+82,1,88,1,94,1,100,1,106,1,112,1,118,1,124,1,130,1,136,1,142,1,148,1,154,
+1,160,1,166,1,172,1,178,1,184,1,190,1,196,1,202,1,208,1,214,1,220,1,226,1,
+232,1,238,1,244,1,250,2,0,2,6,2,12,2,18,2,24,2,30,2,36,2,42,2,48,2,54,2,60,
+2,66,2,72,2,78,2,84,2,90,2,96,2,102,2,108,2,114,2,120,2,126,2,132,2,138,2,
+144,2,150,2,156,2,162,2,168,2,174,2,180,2,186,2,192,2,198,2,204,2,210,2,216,
+2,222,2,228,2,234,2,240,2,246,2,252,3,2,3,8,3,14,3,20,3,26,3,32,3,38,3,44,
+3,50,3,56,3,62,3,68,3,74,3,80,3,86,3,92,3,98,3,104,3,110,3,116,3,122,3,128,
+3,134,3,140,3,146,3,152,3,158,3,164,3,170,3,176,3,182,3,188,3,194,3,200,3,
+206,3,212,3,218,3,224,3,230,3,236,3,242,3,248,3,254,4,4,4,10,4,16,4,22,4,
+28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,4,88,4,94,4,100,4,106,4,112,
+4,118,4,124,4,130,4,136,4,142,4,148,4,154,4,160,4,166,4,172,4,178,4,184,4,
+190,4,196,4,202,4,208,4,214,4,220,4,226,4,232,4,238,4,244,4,250,5,0,5,6,5,
+12,5,18,5,24,5,30,5,36,5,42,5,48,5,54,5,60,0,1,2,76,255,206,0,1,3,102,255,
+206,0,1,2,151,255,206,0,1,3,71,255,6,0,1,3,44,255,206,0,1,3,44,255,206,0,
+1,3,120,255,6,0,1,3,44,255,206,0,1,4,188,255,206,0,1,3,123,255,206,0,1,3,
+117,255,206,0,1,2,155,255,206,0,1,3,14,255,206,0,1,3,14,255,6,0,1,3,116,255,
+206,0,1,2,138,255,206,0,1,3,14,255,6,0,1,3,14,255,206,0,1,3,14,255,6,0,1,
+2,216,255,206,0,1,3,71,255,206,0,1,3,71,255,6,0,1,3,44,255,206,0,1,3,44,255,
+6,0,1,4,159,255,206,0,1,5,86,255,206,0,1,2,155,255,206,0,1,3,142,255,206,
+0,1,3,9,255,206,0,1,2,236,255,206,0,1,3,71,255,206,0,1,2,133,255,206,0,1,
+3,71,255,206,0,1,2,214,255,206,0,1,3,52,255,206,0,1,3,117,255,206,0,1,2,76,
+255,206,0,1,3,102,255,206,0,1,2,151,255,206,0,1,3,71,255,6,0,1,3,44,255,206,
+0,1,3,120,255,6,0,1,3,44,255,206,0,1,4,188,255,206,0,1,3,117,255,206,0,1,
+2,155,255,206,0,1,3,14,255,206,0,1,3,14,255,6,0,1,3,116,255,206,0,1,2,138,
+255,206,0,1,3,14,255,6,0,1,3,14,255,206,0,1,3,14,255,6,0,1,2,216,255,206,
+0,1,3,71,255,206,0,1,3,71,255,6,0,1,3,44,255,206,0,1,3,44,255,6,0,1,4,159,
+255,206,0,1,5,86,255,206,0,1,2,155,255,206,0,1,3,9,255,206,0,1,2,236,255,
+206,0,1,3,71,255,206,0,1,2,133,255,206,0,1,3,71,255,206,0,1,2,214,255,206,
+0,1,3,52,255,206,0,1,2,76,255,206,0,1,3,102,255,206,0,1,2,151,255,206,0,1,
+3,71,255,6,0,1,3,44,255,206,0,1,3,44,255,206,0,1,3,120,255,6,0,1,3,44,255,
+206,0,1,4,188,255,206,0,1,3,123,255,206,0,1,3,117,255,206,0,1,2,155,255,206,
+0,1,3,14,255,206,0,1,3,14,255,6,0,1,3,116,255,206,0,1,2,138,255,206,0,1,3,
+14,255,6,0,1,3,14,255,206,0,1,3,14,255,6,0,1,2,216,255,206,0,1,3,71,255,206,
+0,1,3,71,255,6,0,1,3,44,255,206,0,1,3,44,255,6,0,1,4,159,255,206,0,1,5,86,
+255,206,0,1,2,155,255,206,0,1,3,142,255,206,0,1,3,9,255,206,0,1,2,236,255,
+206,0,1,3,71,255,206,0,1,2,133,255,206,0,1,3,71,255,206,0,1,2,214,255,206,
+0,1,3,52,255,206,0,1,3,117,255,206,0,1,2,76,255,206,0,1,3,102,255,206,0,1,
+2,151,255,206,0,1,3,71,255,6,0,1,3,44,255,206,0,1,3,120,255,6,0,1,3,44,255,
+206,0,1,4,188,255,206,0,1,3,117,255,206,0,1,2,155,255,206,0,1,3,14,255,206,
+0,1,3,14,255,6,0,1,3,116,255,206,0,1,2,138,255,206,0,1,3,14,255,6,0,1,3,14,
+255,206,0,1,3,14,255,6,0,1,2,216,255,206,0,1,3,71,255,206,0,1,3,71,255,6,
+0,1,3,44,255,206,0,1,3,44,255,6,0,1,4,159,255,206,0,1,5,86,255,206,0,1,2,
+155,255,206,0,1,3,9,255,206,0,1,2,236,255,206,0,1,3,71,255,206,0,1,2,133,
+255,206,0,1,3,71,255,206,0,1,2,214,255,206,0,1,3,52,255,206,0,1,2,76,255,
+206,0,1,3,102,255,206,0,1,2,151,255,206,0,1,3,71,255,6,0,1,3,44,255,206,0,
+1,3,120,255,6,0,1,3,44,255,206,0,1,4,188,255,206,0,1,3,117,255,206,0,1,2,
+155,255,206,0,1,3,14,255,206,0,1,3,14,255,6,0,1,3,116,255,206,0,1,2,138,255,
+206,0,1,3,14,255,6,0,1,3,14,255,206,0,1,3,14,255,6,0,1,2,216,255,206,0,1,
+3,71,255,206,0,1,3,71,255,6,0,1,3,44,255,206,0,1,3,44,255,6,0,1,4,159,255,
+206,0,1,5,86,255,206,0,1,2,155,255,206,0,1,3,9,255,206,0,1,2,236,255,206,
+0,1,3,71,255,206,0,1,2,133,255,206,0,1,3,71,255,206,0,1,2,214,255,206,0,1,
+3,52,255,206,0,2,0,0,0,1,0,8,0,2,0,76,0,4,0,0,0,122,0,192,0,5,0,6,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,255,96,255,226,255,126,0,0,0,0,0,0,0,0,0,0,0,0,255,226,
+0,0,0,0,0,0,0,0,0,0,255,166,0,0,0,0,0,0,0,0,0,0,255,46,255,191,0,2,0,7,0,
+58,0,58,0,0,0,69,0,69,0,1,0,97,0,132,0,2,0,167,0,203,0,38,1,36,1,45,0,75,
+1,51,1,86,0,85,1,92,1,101,0,121,0,2,0,11,0,58,0,58,0,1,0,69,0,69,0,1,0,97,
+0,98,0,3,0,99,0,99,0,2,0,100,0,107,0,3,0,108,0,108,0,2,0,109,0,132,0,3,0,
+167,0,203,0,1,1,36,1,45,0,4,1,51,1,86,0,4,1,92,1,101,0,4,0,2,0,14,0,4,0,5,
+0,5,0,71,0,71,0,4,0,94,0,94,0,5,0,97,0,98,0,1,0,99,0,99,0,2,0,100,0,107,0,
+1,0,108,0,108,0,2,0,109,0,110,0,3,0,111,0,111,0,1,0,112,0,115,0,3,0,116,0,
+124,0,1,0,125,0,125,0,3,0,126,0,132,0,1,1,36,1,45,0,1,0,2,0,0,0,1,0,8,0,1,
+0,84,0,4,0,0,0,37,0,162,0,200,0,214,0,228,0,238,1,8,1,22,1,52,1,82,1,88,1,
+94,1,124,1,134,1,140,1,146,1,152,1,158,1,164,1,170,1,180,1,186,1,192,1,198,
+1,204,1,214,1,228,1,246,1,252,2,18,2,32,2,46,2,68,2,78,2,104,2,110,2,116,
+2,154,0,1,0,37,0,24,0,26,0,28,0,29,0,36,0,38,0,41,0,47,0,58,0,69,0,73,0,94,
+0,95,0,96,0,97,0,121,0,122,0,123,0,136,0,137,0,139,0,159,0,164,0,210,0,212,
+0,219,0,221,0,224,0,244,0,246,0,253,0,255,1,2,1,15,1,16,1,18,1,20,0,9,0,58,
+255,186,0,59,255,186,0,64,255,176,0,65,255,176,0,66,255,176,0,67,255,176,
+0,68,255,176,0,69,0,20,1,17,255,176,0,3,0,103,0,60,0,107,0,110,0,127,0,30,
+0,3,0,107,0,70,0,119,0,60,0,127,0,30,0,2,0,61,255,116,0,69,0,90,0,6,0,62,
+0,30,0,63,0,30,0,113,0,60,0,116,0,30,0,125,0,120,0,127,0,100,0,3,0,62,0,30,
+0,63,0,30,0,127,0,100,0,7,0,62,0,30,0,63,0,30,0,100,0,190,0,107,0,120,0,117,
+0,110,0,125,0,110,0,130,0,80,0,7,0,58,255,166,0,59,255,166,0,64,255,136,0,
+65,255,136,0,66,255,136,0,67,255,136,0,68,255,136,0,1,0,4,255,186,0,1,0,4,
+255,236,0,7,0,58,255,166,0,59,255,166,0,64,255,136,0,65,255,136,0,66,255,
+136,0,67,255,136,0,68,255,136,0,2,0,4,255,135,0,5,255,236,0,1,0,62,1,14,0,
+1,0,62,1,74,0,1,0,4,255,176,0,1,0,4,255,126,0,1,0,4,255,216,0,1,0,4,255,218,
+0,2,0,57,255,186,0,69,0,80,0,1,0,69,0,20,0,1,0,69,255,216,0,1,0,57,255,196,
+0,1,0,69,255,226,0,2,0,103,0,30,0,107,0,77,0,3,0,107,0,70,0,119,0,60,0,127,
+0,30,0,4,0,113,0,60,0,116,0,30,0,125,0,120,0,127,0,100,0,1,0,127,0,100,0,
+5,0,100,0,190,0,107,0,120,0,117,0,110,0,125,0,110,0,130,0,80,0,3,0,103,0,
+60,0,107,0,110,0,127,0,30,0,3,0,107,0,70,0,119,0,60,0,127,0,30,0,5,0,72,0,
+10,0,113,0,60,0,116,0,30,0,125,0,120,0,127,0,100,0,2,0,72,0,10,0,127,0,100,
+0,6,0,72,0,10,0,100,0,190,0,107,0,120,0,117,0,110,0,125,0,110,0,130,0,80,
+0,1,0,72,1,14,0,1,0,72,1,74,0,9,1,36,0,60,1,37,1,74,1,38,2,38,1,39,1,165,
+1,40,0,190,1,41,1,174,1,42,1,254,1,43,2,38,1,44,0,190,0,9,1,36,0,60,1,37,
+1,74,1,38,2,38,1,39,1,165,1,40,0,190,1,41,1,174,1,42,1,254,1,43,2,38,1,44,
+0,190,0,3,0,0,0,1,0,8,0,1,2,58,0,141,0,0,2,98,0,0,2,104,0,0,2,110,0,0,2,116,
+0,0,2,122,0,0,2,128,0,0,2,134,0,0,2,140,0,0,2,146,0,0,2,152,0,0,2,158,0,0,
+2,164,0,0,2,170,0,0,2,176,0,0,2,182,0,0,2,188,0,0,2,194,0,0,2,200,0,0,2,206,
+0,0,2,212,0,0,2,218,0,0,2,224,0,0,2,230,0,0,2,236,0,0,2,242,0,0,2,248,0,0,
+2,254,0,0,3,4,0,0,3,10,0,0,3,16,0,0,3,22,0,0,3,28,0,0,3,34,0,0,3,40,0,0,3,
+46,0,0,3,52,0,0,3,58,0,0,3,64,0,0,3,70,0,0,3,76,0,0,3,82,0,0,3,88,0,0,3,94,
+0,0,3,100,0,0,3,106,0,0,3,112,0,0,3,118,0,0,3,124,0,0,3,130,3,136,3,142,3,
+148,3,154,3,160,3,166,3,172,3,178,3,184,3,190,3,196,3,202,3,208,3,214,3,220,
+3,226,3,232,3,238,3,244,3,250,4,0,4,6,4,12,4,18,4,24,4,30,4,36,4,42,4,48,
+4,54,4,60,4,66,4,72,4,78,4,84,4,90,4,96,4,102,4,108,4,114,4,120,4,126,4,132,
+4,138,4,144,4,150,4,156,4,162,4,168,4,174,4,180,4,186,4,192,4,198,4,204,4,
+210,4,216,4,222,4,228,4,234,4,240,4,246,4,252,5,2,5,8,5,14,5,20,5,26,5,32,
+5,38,5,44,5,50,5,56,0,0,5,62,0,0,5,68,0,0,5,74,0,0,5,80,0,0,5,86,0,0,5,92,
+0,0,5,98,0,0,5,104,0,0,5,110,0,0,5,116,0,0,5,122,0,0,5,128,0,0,5,134,0,0,
+5,140,0,0,5,146,0,0,5,152,0,0,5,158,0,0,5,164,0,0,5,170,0,0,0,0,5,176,0,0,
+5,182,0,0,5,188,0,0,5,194,0,0,5,200,0,0,5,206,0,0,5,212,0,0,5,218,0,0,5,224,
+0,0,5,230,0,0,5,236,0,0,5,242,0,0,5,248,0,0,5,254,0,0,6,4,0,0,6,10,0,0,6,
+16,0,0,6,22,0,0,6,28,0,0,6,34,0,0,6,40,0,0,6,46,0,0,6,52,0,0,6,58,0,0,6,64,
+0,0,6,70,0,0,6,76,0,0,6,82,0,0,6,88,0,0,6,94,0,0,6,100,0,0,6,106,0,0,6,112,
+0,0,6,118,0,0,6,124,0,0,6,130,0,2,0,6,0,97,0,121,0,0,0,123,0,132,0,25,1,26,
+1,26,0,35,1,29,1,31,0,36,1,34,1,43,0,39,1,51,1,142,0,49,0,1,1,214,254,112,
+0,1,1,99,254,112,0,1,0,212,254,112,0,1,1,54,254,112,0,1,1,42,254,112,0,1,
+1,87,254,112,0,1,1,99,254,112,0,1,1,42,254,112,0,1,2,124,254,112,0,1,1,94,
+254,112,0,1,1,72,254,112,0,1,0,181,254,112,0,1,1,28,254,112,0,1,1,28,254,
+112,0,1,1,118,254,112,0,1,0,186,254,112,0,1,1,8,254,112,0,1,1,8,254,112,0,
+1,1,8,254,112,0,1,1,85,254,112,0,1,1,90,254,112,0,1,1,90,254,112,0,1,1,99,
+254,112,0,1,1,99,254,112,0,1,2,175,254,112,0,1,0,160,254,112,0,1,1,130,254,
+112,0,1,0,254,254,112,0,1,1,47,254,112,0,1,1,58,254,112,0,1,2,25,254,112,
+0,1,1,145,254,112,0,1,1,90,254,112,0,1,1,36,254,112,0,1,1,130,254,112,0,1,
+5,2,254,112,0,1,5,2,254,112,0,1,5,2,254,112,0,1,5,180,254,112,0,1,5,180,254,
+112,0,1,5,180,254,112,0,1,3,33,254,112,0,1,2,21,254,112,0,1,2,150,254,112,
+0,1,2,100,254,112,0,1,2,67,254,112,0,1,2,85,254,112,0,1,2,187,254,112,0,1,
+2,213,254,112,0,1,0,0,254,112,0,1,3,20,254,112,0,1,0,0,254,112,0,1,4,85,254,
+112,0,1,0,0,254,112,0,1,3,2,254,112,0,1,0,0,254,112,0,1,5,28,254,112,0,1,
+0,0,254,112,0,1,4,37,254,112,0,1,0,0,254,112,0,1,4,117,254,112,0,1,0,0,254,
+112,0,1,4,141,254,112,0,1,0,0,254,112,0,1,4,37,254,112,0,1,0,0,254,112,0,
+1,6,82,254,112,0,1,0,0,254,112,0,1,5,90,254,112,0,1,0,0,254,112,0,1,4,99,
+254,112,0,1,0,0,254,112,0,1,3,48,254,112,0,1,0,0,254,112,0,1,3,218,254,112,
+0,1,0,0,254,112,0,1,4,2,254,112,0,1,0,0,254,112,0,1,4,125,254,112,0,1,0,0,
+254,112,0,1,2,104,254,112,0,1,0,0,254,112,0,1,3,232,254,112,0,1,0,0,254,112,
+0,1,3,192,254,112,0,1,0,0,254,112,0,1,3,232,254,112,0,1,0,0,254,112,0,1,3,
+219,254,112,0,1,0,0,254,112,0,1,4,22,254,112,0,1,0,0,254,112,0,1,4,152,254,
+112,0,1,0,0,254,112,0,1,4,110,254,112,0,1,0,0,254,112,0,1,4,130,254,112,0,
+1,0,0,254,112,0,1,3,78,254,112,0,1,0,0,254,112,0,1,3,184,254,112,0,1,0,0,
+254,112,0,1,1,113,254,112,0,1,0,0,254,112,0,1,4,155,254,112,0,1,0,0,254,112,
+0,1,3,236,254,112,0,1,0,0,254,112,0,1,3,234,254,112,0,1,0,0,254,112,0,1,4,
+38,254,112,0,1,0,0,254,112,0,1,3,51,254,112,0,1,0,0,254,112,0,1,4,141,254,
+112,0,1,0,0,254,112,0,1,4,29,254,112,0,1,0,0,254,112,0,1,3,254,254,112,0,
+1,0,0,254,112,0,1,4,141,254,112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,
+112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,
+0,254,112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,112,
+0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,
+112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,0,0,254,112,0,1,1,243,254,112,0,1,
+2,106,254,112,0,1,1,52,254,112,0,1,2,16,254,112,0,1,2,91,254,112,0,1,2,156,
+254,112,0,1,2,255,254,112,0,1,2,91,254,112,0,1,4,84,254,112,0,1,3,36,254,
+112,0,1,2,146,254,112,0,1,1,62,254,112,0,1,1,192,254,112,0,1,2,18,254,112,
+0,1,2,162,254,112,0,1,1,122,254,112,0,1,2,4,254,112,0,1,1,178,254,112,0,1,
+2,4,254,112,0,1,1,242,254,112,0,1,1,187,254,112,0,1,1,187,254,112,0,1,2,167,
+254,112,0,1,3,31,254,112,0,1,2,106,254,112,0,1,2,6,254,112,0,1,0,168,254,
+112,0,1,2,206,254,112,0,1,2,6,254,112,0,1,2,76,254,112,0,1,1,162,254,112,
+0,1,2,46,254,112,0,1,1,202,254,112,0,1,1,162,254,112,0,1,2,66,254,112,0,1,
+2,182,254,112,0,1,0,0,0,10,0,80,0,244,0,2,107,110,100,50,0,14,107,110,100,
+97,0,18,0,8,0,0,0,28,0,0,0,0,255,255,0,9,0,9,0,2,0,11,0,4,0,7,0,0,0,6,0,10,
+0,8,0,0,255,255,0,9,0,9,0,1,0,11,0,3,0,7,0,0,0,5,0,10,0,8,0,12,97,98,118,
+115,0,74,97,107,104,110,0,80,97,107,104,110,0,86,98,108,119,102,0,92,98,108,
+119,102,0,98,98,108,119,115,0,106,98,108,119,115,0,112,104,97,108,102,0,120,
+104,97,108,110,0,126,110,117,107,116,0,134,112,115,116,115,0,140,114,112,
+104,102,0,158,0,0,0,1,0,9,0,0,0,1,0,1,0,0,0,1,0,2,0,0,0,1,0,4,0,0,0,2,0,5,
+0,7,0,0,0,1,0,15,0,0,0,2,0,13,0,15,0,0,0,1,0,8,0,0,0,2,0,26,0,27,0,0,0,1,
+0,0,0,0,0,7,0,16,0,20,0,21,0,22,0,25,0,29,0,35,0,0,0,1,0,3,0,38,0,78,0,124,
+0,174,0,224,1,0,2,206,3,34,3,76,4,132,6,228,7,168,7,188,8,64,11,76,11,154,
+12,210,13,152,14,60,14,82,14,104,14,126,14,172,15,74,15,184,16,88,16,112,
+16,152,18,168,18,240,19,106,20,72,20,92,20,118,20,138,20,158,20,190,20,230,
+20,250,0,4,0,0,0,1,0,8,0,1,0,30,0,2,0,10,0,20,0,1,0,4,0,95,0,2,0,55,0,1,0,
+4,0,96,0,2,0,55,0,1,0,2,0,27,0,41,0,4,1,0,0,1,0,8,0,1,0,34,0,2,0,10,0,22,
+0,1,0,4,1,26,0,3,0,52,0,70,0,1,0,4,1,31,0,3,0,29,0,70,0,1,0,2,0,20,0,27,0,
+4,1,0,0,1,0,8,0,1,0,34,0,2,0,10,0,22,0,1,0,4,1,26,0,3,0,70,0,52,0,1,0,4,1,
+31,0,3,0,70,0,29,0,1,0,2,0,20,0,27,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,
+4,0,94,0,2,0,70,0,1,0,1,0,46,0,4,0,8,0,1,0,8,0,1,1,182,0,36,0,78,0,88,0,98,
+0,108,0,118,0,128,0,138,0,148,0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,
+228,0,238,0,248,1,2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,1,92,1,102,1,
+112,1,122,1,132,1,142,1,152,1,162,1,172,0,1,0,4,0,97,0,2,0,70,0,1,0,4,0,98,
+0,2,0,70,0,1,0,4,0,99,0,2,0,70,0,1,0,4,0,100,0,2,0,70,0,1,0,4,0,101,0,2,0,
+70,0,1,0,4,0,102,0,2,0,70,0,1,0,4,0,103,0,2,0,70,0,1,0,4,0,104,0,2,0,70,0,
+1,0,4,0,105,0,2,0,70,0,1,0,4,0,106,0,2,0,70,0,1,0,4,0,107,0,2,0,70,0,1,0,
+4,0,108,0,2,0,70,0,1,0,4,0,109,0,2,0,70,0,1,0,4,0,110,0,2,0,70,0,1,0,4,0,
+111,0,2,0,70,0,1,0,4,0,112,0,2,0,70,0,1,0,4,0,113,0,2,0,70,0,1,0,4,0,114,
+0,2,0,70,0,1,0,4,0,115,0,2,0,70,0,1,0,4,0,116,0,2,0,70,0,1,0,4,0,117,0,2,
+0,70,0,1,0,4,0,118,0,2,0,70,0,1,0,4,0,119,0,2,0,70,0,1,0,4,0,120,0,2,0,70,
+0,1,0,4,0,121,0,2,0,70,0,1,0,4,0,122,0,2,0,70,0,1,0,4,0,123,0,2,0,70,0,1,
+0,4,0,124,0,2,0,70,0,1,0,4,0,125,0,2,0,70,0,1,0,4,0,126,0,2,0,70,0,1,0,4,
+0,127,0,2,0,70,0,1,0,4,0,128,0,2,0,70,0,1,0,4,0,129,0,2,0,70,0,1,0,4,0,130,
+0,2,0,70,0,1,0,4,0,131,0,2,0,70,0,1,0,4,0,132,0,2,0,70,0,2,0,2,0,20,0,54,
+0,0,0,73,0,73,0,35,0,5,0,0,0,1,0,8,0,1,0,12,0,3,0,22,0,48,0,62,0,1,0,3,0,
+70,1,26,1,31,0,2,0,6,0,16,0,2,0,1,1,26,0,1,0,6,0,2,0,1,1,31,0,1,0,6,0,1,0,
+4,0,2,0,1,0,55,0,0,0,6,0,1,0,4,0,2,0,1,0,55,0,0,0,6,0,2,0,0,0,1,0,8,0,1,0,
+26,0,2,0,10,0,18,0,3,0,20,0,70,0,52,0,3,0,27,0,70,0,29,0,1,0,2,1,26,1,31,
+0,4,0,0,0,1,0,8,0,1,1,42,0,1,0,8,0,36,0,74,0,80,0,86,0,92,0,98,0,104,0,110,
+0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,
+188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,254,1,4,
+1,10,1,16,1,22,1,28,0,97,0,2,0,20,0,98,0,2,0,21,0,99,0,2,0,22,0,100,0,2,0,
+23,0,101,0,2,0,24,0,102,0,2,0,25,0,103,0,2,0,26,0,104,0,2,0,27,0,105,0,2,
+0,28,0,106,0,2,0,29,0,107,0,2,0,30,0,108,0,2,0,31,0,109,0,2,0,32,0,110,0,
+2,0,33,0,111,0,2,0,34,0,112,0,2,0,35,0,113,0,2,0,36,0,114,0,2,0,37,0,115,
+0,2,0,38,0,116,0,2,0,39,0,117,0,2,0,40,0,118,0,2,0,41,0,119,0,2,0,42,0,120,
+0,2,0,43,0,121,0,2,0,44,0,122,0,2,0,45,0,123,0,2,0,46,0,124,0,2,0,47,0,125,
+0,2,0,48,0,126,0,2,0,49,0,127,0,2,0,50,0,128,0,2,0,51,0,129,0,2,0,52,0,130,
+0,2,0,53,0,131,0,2,0,54,0,132,0,2,0,73,0,1,0,1,0,70,0,4,0,0,0,1,0,8,0,1,2,
+54,0,40,0,86,0,98,0,110,0,122,0,134,0,146,0,158,0,170,0,182,0,194,0,206,0,
+218,0,230,0,242,0,254,1,10,1,22,1,34,1,46,1,58,1,70,1,82,1,94,1,106,1,118,
+1,130,1,142,1,154,1,166,1,178,1,190,1,202,1,214,1,226,1,238,1,250,2,6,2,18,
+2,30,2,42,0,1,0,4,0,167,0,3,0,70,0,92,0,1,0,4,0,168,0,3,0,70,0,92,0,1,0,4,
+0,169,0,3,0,70,0,92,0,1,0,4,0,170,0,3,0,70,0,92,0,1,0,4,0,171,0,3,0,70,0,
+92,0,1,0,4,0,172,0,3,0,70,0,92,0,1,0,4,0,173,0,3,0,70,0,92,0,1,0,4,0,174,
+0,3,0,70,0,92,0,1,0,4,0,175,0,3,0,70,0,92,0,1,0,4,0,176,0,3,0,70,0,92,0,1,
+0,4,0,177,0,3,0,70,0,92,0,1,0,4,0,178,0,3,0,70,0,92,0,1,0,4,0,179,0,3,0,70,
+0,92,0,1,0,4,0,180,0,3,0,70,0,92,0,1,0,4,0,181,0,3,0,70,0,92,0,1,0,4,0,182,
+0,3,0,70,0,92,0,1,0,4,0,183,0,3,0,70,0,92,0,1,0,4,0,184,0,3,0,70,0,92,0,1,
+0,4,0,185,0,3,0,70,0,92,0,1,0,4,0,186,0,3,0,70,0,92,0,1,0,4,0,187,0,3,0,70,
+0,92,0,1,0,4,0,188,0,3,0,70,0,92,0,1,0,4,0,189,0,3,0,70,0,92,0,1,0,4,0,190,
+0,3,0,70,0,92,0,1,0,4,0,191,0,3,0,70,0,92,0,1,0,4,0,192,0,3,0,70,0,92,0,1,
+0,4,0,193,0,3,0,70,0,92,0,1,0,4,0,194,0,3,0,70,0,92,0,1,0,4,0,195,0,3,0,70,
+0,92,0,1,0,4,0,196,0,3,0,70,0,92,0,1,0,4,0,197,0,3,0,70,0,92,0,1,0,4,0,198,
+0,3,0,70,0,92,0,1,0,4,0,199,0,3,0,70,0,92,0,1,0,4,0,200,0,3,0,70,0,92,0,1,
+0,4,0,201,0,3,0,70,0,92,0,1,0,4,0,202,0,3,0,70,0,92,0,1,0,4,0,203,0,3,0,70,
+0,92,0,1,0,4,0,204,0,3,0,70,0,92,0,1,0,4,1,28,0,3,0,70,0,92,0,1,0,4,1,33,
+0,3,0,70,0,92,0,2,0,5,0,20,0,54,0,0,0,73,0,73,0,35,0,95,0,96,0,36,1,26,1,
+26,0,38,1,31,1,31,0,39,0,5,2,0,0,1,0,8,0,2,0,20,0,54,0,6,0,0,0,136,0,174,
+0,0,0,0,0,0,0,2,0,5,0,20,0,46,0,0,0,48,0,54,0,27,0,95,0,96,0,34,1,26,1,26,
+0,36,1,31,1,31,0,37,0,2,0,13,0,20,0,23,0,1,0,24,0,24,0,2,0,25,0,28,0,1,0,
+29,0,29,0,2,0,30,0,46,0,1,0,48,0,54,0,1,0,57,0,57,0,3,0,58,0,58,0,5,0,64,
+0,64,0,5,0,69,0,69,0,4,0,95,0,96,0,1,1,26,1,26,0,1,1,31,1,31,0,1,0,3,0,8,
+0,18,0,28,0,2,0,1,0,3,0,0,0,11,0,2,0,1,0,4,0,0,0,11,0,2,0,1,0,5,0,0,0,12,
+0,1,0,4,0,2,0,1,0,3,0,1,0,10,0,1,0,0,0,1,0,8,0,1,0,6,0,216,0,1,0,1,0,57,0,
+1,0,0,0,1,0,8,0,2,0,78,0,36,0,133,0,134,0,135,0,136,0,137,0,138,0,139,0,140,
+0,141,0,142,0,143,0,144,0,145,0,146,0,147,0,148,0,149,0,150,0,151,0,152,0,
+153,0,154,0,155,0,156,0,157,0,158,0,159,0,160,0,161,0,162,0,163,0,164,0,165,
+0,166,1,27,1,32,0,2,0,7,0,20,0,23,0,0,0,25,0,28,0,4,0,30,0,46,0,8,0,48,0,
+54,0,25,0,95,0,96,0,32,1,26,1,26,0,34,1,31,1,31,0,35,0,4,2,0,0,1,0,8,0,1,
+2,214,0,36,0,78,0,96,0,114,0,132,0,150,0,168,0,186,0,204,0,222,0,240,1,2,
+1,20,1,38,1,56,1,74,1,92,1,110,1,128,1,146,1,164,1,182,1,200,1,218,1,236,
+1,254,2,16,2,34,2,52,2,70,2,88,2,106,2,124,2,142,2,160,2,178,2,196,0,2,0,
+6,0,12,0,205,0,2,0,58,0,239,0,2,0,64,0,2,0,6,0,12,0,206,0,2,0,58,0,240,0,
+2,0,64,0,2,0,6,0,12,0,207,0,2,0,58,0,241,0,2,0,64,0,2,0,6,0,12,0,208,0,2,
+0,58,0,242,0,2,0,64,0,2,0,6,0,12,0,209,0,2,0,58,0,243,0,2,0,64,0,2,0,6,0,
+12,0,210,0,2,0,58,0,244,0,2,0,64,0,2,0,6,0,12,0,211,0,2,0,58,0,245,0,2,0,
+64,0,2,0,6,0,12,0,212,0,2,0,58,0,246,0,2,0,64,0,2,0,6,0,12,0,213,0,2,0,58,
+0,247,0,2,0,64,0,2,0,6,0,12,0,214,0,2,0,58,0,248,0,2,0,64,0,2,0,6,0,12,0,
+215,0,2,0,58,0,249,0,2,0,64,0,2,0,6,0,12,0,216,0,2,0,58,0,250,0,2,0,64,0,
+2,0,6,0,12,0,217,0,2,0,58,0,251,0,2,0,64,0,2,0,6,0,12,0,218,0,2,0,58,0,252,
+0,2,0,64,0,2,0,6,0,12,0,219,0,2,0,58,0,253,0,2,0,64,0,2,0,6,0,12,0,220,0,
+2,0,58,0,254,0,2,0,64,0,2,0,6,0,12,0,221,0,2,0,58,0,255,0,2,0,64,0,2,0,6,
+0,12,0,222,0,2,0,58,1,0,0,2,0,64,0,2,0,6,0,12,0,223,0,2,0,58,1,1,0,2,0,64,
+0,2,0,6,0,12,0,224,0,2,0,58,1,2,0,2,0,64,0,2,0,6,0,12,0,225,0,2,0,58,1,3,
+0,2,0,64,0,2,0,6,0,12,0,226,0,2,0,58,1,4,0,2,0,64,0,2,0,6,0,12,0,227,0,2,
+0,58,1,5,0,2,0,64,0,2,0,6,0,12,0,228,0,2,0,58,1,6,0,2,0,64,0,2,0,6,0,12,0,
+229,0,2,0,58,1,7,0,2,0,64,0,2,0,6,0,12,0,230,0,2,0,58,1,8,0,2,0,64,0,2,0,
+6,0,12,0,231,0,2,0,58,1,9,0,2,0,64,0,2,0,6,0,12,0,232,0,2,0,58,1,10,0,2,0,
+64,0,2,0,6,0,12,0,233,0,2,0,58,1,11,0,2,0,64,0,2,0,6,0,12,0,234,0,2,0,58,
+1,12,0,2,0,64,0,2,0,6,0,12,0,235,0,2,0,58,1,13,0,2,0,64,0,2,0,6,0,12,0,236,
+0,2,0,58,1,14,0,2,0,64,0,2,0,6,0,12,0,237,0,2,0,58,1,15,0,2,0,64,0,2,0,6,
+0,12,0,238,0,2,0,58,1,16,0,2,0,64,0,2,0,6,0,12,1,29,0,2,0,58,1,30,0,2,0,64,
+0,2,0,6,0,12,1,34,0,2,0,58,1,35,0,2,0,64,0,2,0,7,0,20,0,23,0,0,0,25,0,28,
+0,4,0,30,0,46,0,8,0,48,0,54,0,25,0,95,0,96,0,32,1,26,1,26,0,34,1,31,1,31,
+0,35,0,6,0,0,0,1,0,8,0,2,0,16,0,26,0,34,0,44,0,2,0,0,0,52,0,2,0,1,0,97,0,
+132,0,0,0,1,0,1,0,1,0,1,0,2,0,1,0,97,0,132,0,1,0,1,0,55,0,1,0,1,0,1,0,4,0,
+0,0,1,0,1,0,1,0,1,0,0,0,14,0,2,0,0,0,1,0,8,0,1,1,38,0,36,0,78,0,84,0,90,0,
+96,0,102,0,108,0,114,0,120,0,126,0,132,0,138,0,144,0,150,0,156,0,162,0,168,
+0,174,0,180,0,186,0,192,0,198,0,204,0,210,0,216,0,222,0,228,0,234,0,240,0,
+246,0,252,1,2,1,8,1,14,1,20,1,26,1,32,0,2,0,70,0,20,0,2,0,70,0,21,0,2,0,70,
+0,22,0,2,0,70,0,23,0,2,0,70,0,24,0,2,0,70,0,25,0,2,0,70,0,26,0,2,0,70,0,27,
+0,2,0,70,0,28,0,2,0,70,0,29,0,2,0,70,0,30,0,2,0,70,0,31,0,2,0,70,0,32,0,2,
+0,70,0,33,0,2,0,70,0,34,0,2,0,70,0,35,0,2,0,70,0,36,0,2,0,70,0,37,0,2,0,70,
+0,38,0,2,0,70,0,39,0,2,0,70,0,40,0,2,0,70,0,41,0,2,0,70,0,42,0,2,0,70,0,43,
+0,2,0,70,0,44,0,2,0,70,0,45,0,2,0,70,0,46,0,2,0,70,0,47,0,2,0,70,0,48,0,2,
+0,70,0,49,0,2,0,70,0,50,0,2,0,70,0,51,0,2,0,70,0,52,0,2,0,70,0,53,0,2,0,70,
+0,54,0,2,0,70,0,73,0,2,0,1,0,97,0,132,0,0,0,4,0,0,0,1,0,8,0,1,0,166,0,10,
+0,26,0,36,0,46,0,56,0,66,0,100,0,110,0,120,0,130,0,156,0,1,0,4,1,36,0,2,0,
+123,0,1,0,4,1,37,0,2,0,123,0,1,0,4,1,38,0,2,0,123,0,1,0,4,1,39,0,2,0,123,
+0,4,0,10,0,16,0,22,0,28,1,46,0,2,0,62,1,48,0,2,0,72,1,44,0,2,0,122,1,40,0,
+2,0,123,0,1,0,4,1,41,0,2,0,123,0,1,0,4,1,42,0,2,0,123,0,1,0,4,1,43,0,2,0,
+123,0,3,0,8,0,14,0,20,1,47,0,2,0,62,1,49,0,2,0,72,1,45,0,2,0,122,0,1,0,4,
+1,50,0,2,0,72,0,1,0,10,0,97,0,99,0,107,0,109,0,112,0,114,0,117,0,120,0,121,
+0,123,0,6,0,0,0,1,0,8,0,2,0,16,0,24,0,88,0,98,0,2,0,0,0,106,0,1,0,2,0,60,
+0,61,0,2,0,10,0,23,0,23,0,3,0,40,0,40,0,1,0,41,0,41,0,2,0,49,0,49,0,3,0,50,
+0,50,0,1,0,242,0,242,0,3,1,1,1,1,0,1,1,2,1,2,0,2,1,9,1,9,0,3,1,10,1,10,0,
+1,0,1,0,60,0,2,0,1,0,1,0,1,0,1,0,1,0,1,0,3,0,8,0,22,0,36,0,1,0,1,0,1,0,0,
+0,1,0,0,0,17,0,1,0,2,0,1,0,0,0,1,0,0,0,18,0,1,0,3,0,1,0,0,0,1,0,0,0,19,0,
+1,0,0,0,1,0,8,0,1,0,6,0,214,0,1,0,2,0,60,0,61,0,1,0,0,0,1,0,8,0,1,0,6,0,216,
+0,1,0,2,0,60,0,61,0,1,0,0,0,1,0,8,0,1,0,6,0,218,0,1,0,2,0,60,0,61,0,4,0,0,
+0,1,0,8,0,1,0,30,0,2,0,10,0,20,0,1,0,4,1,24,0,2,0,61,0,1,0,4,1,25,0,2,0,61,
+0,1,0,2,1,5,1,6,0,6,0,8,0,1,0,8,0,2,0,16,0,50,0,90,0,124,0,2,0,0,0,132,0,
+2,0,5,0,62,0,63,0,0,0,72,0,72,0,2,0,76,0,77,0,3,0,97,0,132,0,5,1,36,1,50,
+0,41,0,2,0,6,0,76,0,77,0,1,0,97,0,132,0,1,1,26,1,26,0,1,1,29,1,31,0,1,1,34,
+1,86,0,1,1,92,1,142,0,1,0,2,0,5,0,62,0,63,0,1,0,72,0,72,0,1,0,76,0,77,0,1,
+0,97,0,132,0,1,1,36,1,50,0,1,0,1,0,1,0,1,0,1,0,1,0,4,0,1,0,1,0,1,0,0,0,1,
+0,0,0,23,0,6,0,0,0,1,0,8,0,2,0,16,0,26,0,66,0,76,0,2,0,0,0,84,0,2,0,1,0,97,
+0,132,0,0,0,2,0,6,0,55,0,55,0,1,0,95,0,96,0,1,0,237,0,238,0,1,1,15,1,16,0,
+1,1,18,1,18,0,1,1,20,1,20,0,1,0,2,0,1,0,97,0,132,0,1,0,1,0,1,0,1,0,1,0,1,
+0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,24,0,1,0,0,0,1,0,8,0,2,0,118,0,56,1,87,1,88,
+1,89,1,90,1,91,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,
+1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,
+1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,92,1,93,1,94,1,95,1,96,1,97,
+1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,0,2,0,5,0,62,0,63,0,0,
+0,72,0,72,0,2,0,76,0,77,0,3,0,97,0,132,0,5,1,36,1,50,0,41,0,1,0,0,0,1,0,8,
+0,1,0,6,1,10,0,2,0,1,0,97,0,132,0,0,0,4,0,0,0,1,0,8,0,1,0,26,0,1,0,8,0,2,
+0,6,0,12,0,67,0,2,0,61,0,66,0,2,0,72,0,1,0,1,0,64,0,4,0,12,0,1,0,8,0,1,1,
+230,0,40,0,86,0,96,0,106,0,116,0,126,0,136,0,146,0,156,0,166,0,176,0,186,
+0,196,0,206,0,216,0,226,0,236,0,246,1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,
+1,80,1,90,1,100,1,110,1,120,1,130,1,140,1,150,1,160,1,170,1,180,1,190,1,200,
+1,210,1,220,0,1,0,4,0,167,0,2,0,70,0,1,0,4,0,168,0,2,0,70,0,1,0,4,0,169,0,
+2,0,70,0,1,0,4,0,170,0,2,0,70,0,1,0,4,0,171,0,2,0,70,0,1,0,4,0,172,0,2,0,
+70,0,1,0,4,0,173,0,2,0,70,0,1,0,4,0,174,0,2,0,70,0,1,0,4,0,175,0,2,0,70,0,
+1,0,4,0,176,0,2,0,70,0,1,0,4,0,177,0,2,0,70,0,1,0,4,0,178,0,2,0,70,0,1,0,
+4,0,179,0,2,0,70,0,1,0,4,0,180,0,2,0,70,0,1,0,4,0,181,0,2,0,70,0,1,0,4,0,
+182,0,2,0,70,0,1,0,4,0,183,0,2,0,70,0,1,0,4,0,184,0,2,0,70,0,1,0,4,0,185,
+0,2,0,70,0,1,0,4,0,186,0,2,0,70,0,1,0,4,0,187,0,2,0,70,0,1,0,4,0,188,0,2,
+0,70,0,1,0,4,0,189,0,2,0,70,0,1,0,4,0,190,0,2,0,70,0,1,0,4,0,191,0,2,0,70,
+0,1,0,4,0,192,0,2,0,70,0,1,0,4,0,193,0,2,0,70,0,1,0,4,0,194,0,2,0,70,0,1,
+0,4,0,195,0,2,0,70,0,1,0,4,0,196,0,2,0,70,0,1,0,4,0,197,0,2,0,70,0,1,0,4,
+0,198,0,2,0,70,0,1,0,4,0,199,0,2,0,70,0,1,0,4,0,200,0,2,0,70,0,1,0,4,0,201,
+0,2,0,70,0,1,0,4,0,202,0,2,0,70,0,1,0,4,0,203,0,2,0,70,0,1,0,4,0,204,0,2,
+0,70,0,1,0,4,1,28,0,2,0,70,0,1,0,4,1,33,0,2,0,70,0,2,0,5,0,20,0,54,0,0,0,
+73,0,73,0,35,0,95,0,96,0,36,1,26,1,26,0,38,1,31,1,31,0,39,0,5,0,0,0,1,0,8,
+0,2,0,14,0,22,0,3,0,0,0,50,0,0,0,1,0,2,1,28,1,33,0,2,0,4,1,28,1,28,0,1,1,
+33,1,33,0,1,1,51,1,86,0,2,1,92,1,101,0,2,0,1,0,4,0,2,0,1,0,2,0,1,0,28,0,1,
+0,0,0,1,0,8,0,2,0,98,0,46,0,97,0,98,0,99,0,100,0,101,0,102,0,103,0,104,0,
+105,0,106,0,107,0,108,0,109,0,110,0,111,0,112,0,113,0,114,0,115,0,116,0,117,
+0,118,0,119,0,120,0,121,0,122,0,123,0,124,0,125,0,126,0,127,0,128,0,129,0,
+130,0,131,0,132,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,0,2,0,2,
+1,51,1,86,0,0,1,92,1,101,0,36,0,6,0,8,0,1,0,8,0,2,0,22,0,34,0,74,0,102,0,
+5,0,0,0,110,0,146,0,170,0,194,0,1,0,4,0,62,0,63,0,72,0,94,0,2,0,6,0,46,0,
+46,0,1,0,70,0,70,0,2,0,157,0,157,0,1,0,193,0,193,0,1,0,229,0,229,0,1,1,7,
+1,7,0,1,0,2,0,4,0,62,0,62,0,2,0,63,0,63,0,3,0,72,0,72,0,4,0,94,0,94,0,1,0,
+1,0,1,0,1,0,1,0,2,0,6,0,20,0,1,0,1,0,1,0,0,0,1,0,0,0,30,0,2,0,2,0,1,0,1,0,
+0,0,1,0,0,0,30,0,1,0,4,0,1,0,1,0,2,0,1,0,0,0,2,0,0,0,31,0,1,0,32,0,1,0,4,
+0,1,0,1,0,2,0,1,0,0,0,2,0,0,0,31,0,1,0,33,0,1,0,4,0,1,0,1,0,2,0,1,0,0,0,1,
+0,0,0,34,0,1,0,0,0,1,0,8,0,1,0,6,0,29,0,1,0,1,0,94,0,1,0,0,0,1,0,8,0,2,0,
+10,0,2,0,123,0,123,0,1,0,2,0,62,0,63,0,1,0,0,0,1,0,8,0,1,0,6,0,249,0,1,0,
+1,0,94,0,1,0,0,0,1,0,8,0,1,0,6,0,250,0,1,0,1,0,94,0,4,0,0,0,1,0,8,0,1,0,18,
+0,1,0,8,0,1,0,4,1,50,0,2,0,94,0,1,0,1,0,72,0,5,0,0,0,1,0,8,0,1,0,8,0,1,0,
+14,0,1,0,1,0,71,0,1,0,4,0,2,0,2,0,123,0,0,0,36,0,1,0,37,0,1,0,0,0,1,0,8,0,
+1,0,6,0,52,0,1,0,1,0,71,0,1,0,0,0,1,0,8,0,1,0,6,255,204,0,1,0,1,0,123,0,0,
+};
+#endif
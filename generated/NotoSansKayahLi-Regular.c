@@ -0,0 +1,344 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansKayahLi_Regular_ttf_size = 8096;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansKayahLi_Regular_ttf");
+asm(".type fz_font_NotoSansKayahLi_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansKayahLi_Regular_ttf, 8096");
+asm(".balign 64");
+asm("fz_font_NotoSansKayahLi_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansKayahLi-Regular.ttf\"");
+#else
+const int fz_font_NotoSansKayahLi_Regular_ttf_size = 8096;
+const char fz_font_NotoSansKayahLi_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,214,0,196,0,0,28,232,0,0,0,48,71,
+80,79,83,200,225,192,55,0,0,29,24,0,0,1,202,71,83,85,66,131,180,138,191,0,
+0,30,228,0,0,0,186,79,83,47,50,122,231,107,99,0,0,1,104,0,0,0,96,99,109,97,
+112,86,91,83,45,0,0,2,160,0,0,0,84,103,97,115,112,0,7,0,7,0,0,28,220,0,0,
+0,12,103,108,121,102,6,137,176,52,0,0,3,100,0,0,19,74,104,101,97,100,254,
+193,69,129,0,0,0,236,0,0,0,54,104,104,101,97,8,245,4,171,0,0,1,36,0,0,0,36,
+104,109,116,120,249,23,241,230,0,0,1,200,0,0,0,214,108,111,99,97,131,166,
+127,9,0,0,2,244,0,0,0,110,109,97,120,112,0,58,0,66,0,0,1,72,0,0,0,32,110,
+97,109,101,141,165,184,181,0,0,22,176,0,0,6,10,112,111,115,116,255,105,0,
+102,0,0,28,188,0,0,0,32,0,1,0,0,0,1,5,31,250,80,26,84,95,15,60,245,0,11,8,
+0,0,0,0,0,205,19,43,62,0,0,0,0,210,40,203,241,250,135,254,20,5,223,6,33,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,6,127,250,135,0,78,5,223,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,1,0,0,0,54,0,65,0,3,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,235,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,
+0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,0,0,2,20,
+0,0,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,
+0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,
+45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,
+6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,
+180,6,127,0,180,6,127,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,
+45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,6,45,0,180,0,0,252,129,0,0,251,
+88,0,0,251,88,0,0,251,18,0,0,251,18,0,0,252,129,0,0,250,135,0,0,250,135,6,
+45,0,78,2,20,0,180,0,0,250,135,250,135,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,
+72,0,0,0,14,0,8,0,2,0,6,0,0,0,13,0,32,0,160,169,47,254,255,255,255,0,0,0,
+0,0,13,0,32,0,160,169,0,254,255,255,255,0,1,255,245,255,227,255,99,87,4,1,
+2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,74,0,144,0,164,
+0,220,1,6,1,25,1,75,1,116,1,135,1,175,1,224,2,27,2,75,2,125,2,207,2,251,3,
+55,3,133,3,204,3,247,4,84,4,140,4,209,5,5,5,50,5,116,5,164,5,216,6,38,6,81,
+6,158,6,227,7,19,7,61,7,127,7,167,7,224,8,42,8,63,8,78,8,96,8,129,8,174,8,
+195,8,235,9,33,9,65,9,78,9,114,9,165,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,
+0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,
+74,104,4,230,0,0,2,0,180,255,236,5,121,4,94,0,15,0,31,0,0,1,20,6,4,33,34,
+38,38,53,52,54,54,33,32,22,22,5,20,22,22,51,50,54,54,53,52,38,38,35,34,6,
+6,5,121,104,255,0,254,253,249,247,106,102,249,1,6,1,4,248,100,251,241,74,
+178,174,180,177,74,77,182,174,185,170,69,2,45,243,235,99,103,240,234,248,
+223,90,100,234,227,188,172,74,71,168,195,185,166,67,64,158,0,0,2,0,180,0,
+0,5,121,4,74,0,38,0,47,0,0,33,32,38,38,53,52,54,54,51,32,23,17,33,53,33,17,
+35,46,2,35,34,6,6,21,20,22,22,51,62,2,51,51,21,20,6,6,35,55,50,54,53,53,14,
+2,7,3,0,254,227,220,83,115,255,222,1,58,143,251,231,4,197,172,20,93,180,170,
+170,165,69,51,125,134,104,169,203,142,111,61,123,113,4,56,61,89,109,86,83,
+61,154,172,145,146,67,47,1,2,142,253,164,50,40,16,32,77,104,127,86,33,117,
+111,51,152,97,118,53,141,60,53,31,4,22,46,72,0,0,1,0,180,0,0,5,121,4,74,0,
+6,0,0,1,51,1,35,1,51,1,4,186,191,253,172,31,253,174,203,1,158,4,74,251,182,
+4,74,252,221,0,2,0,180,0,0,5,121,4,74,0,24,0,33,0,0,1,1,51,54,36,51,51,17,
+20,6,6,35,33,53,1,33,34,6,21,35,52,54,54,51,33,3,50,54,53,53,14,2,7,5,59,
+252,68,186,172,1,114,185,105,61,123,113,252,100,3,51,254,107,128,116,168,
+81,165,166,2,233,231,55,64,78,138,126,119,4,47,252,94,193,196,254,250,97,
+118,53,156,3,32,112,105,133,156,70,252,67,60,53,123,3,50,79,104,0,0,1,0,180,
+255,246,5,121,4,94,0,24,0,0,1,17,34,4,4,7,35,17,51,21,20,7,23,54,36,33,51,
+17,16,33,35,53,51,50,54,4,201,179,254,138,254,222,26,176,176,18,10,110,2,
+13,1,4,158,254,176,53,67,66,80,1,61,2,146,142,247,115,2,115,160,139,78,2,
+161,238,252,254,254,154,147,93,0,1,0,180,0,0,5,121,4,74,0,7,0,0,1,17,33,21,
+33,17,33,21,1,100,1,62,254,18,4,197,3,188,252,209,141,4,74,142,0,2,0,180,
+255,236,5,121,4,94,0,17,0,29,0,0,37,52,33,50,23,17,1,17,35,17,51,17,1,51,
+17,16,33,32,37,50,53,53,38,38,35,34,6,21,20,22,3,82,1,12,57,50,252,155,176,
+176,3,119,158,254,233,254,240,1,14,105,19,54,32,56,69,70,219,240,21,1,244,
+253,240,254,102,4,74,253,250,2,26,252,217,254,181,120,181,28,8,21,64,55,55,
+64,0,1,0,180,255,236,5,121,4,74,0,23,0,0,1,33,17,20,6,4,33,34,38,38,53,17,
+51,17,20,22,22,51,50,54,54,53,17,33,3,139,1,238,104,255,0,254,253,249,247,
+106,176,78,181,173,183,180,74,254,194,4,74,253,227,243,235,99,103,240,234,
+1,29,254,227,188,172,74,73,172,189,1,141,0,0,1,0,180,0,0,5,121,4,74,0,7,0,
+0,1,51,17,33,17,51,17,33,4,201,176,251,59,176,3,101,2,23,253,233,4,74,252,
+67,0,1,0,180,255,236,5,121,4,74,0,23,0,0,19,33,21,33,17,20,22,22,51,50,54,
+54,53,17,51,17,20,6,4,33,34,38,38,53,180,1,238,254,194,78,181,173,183,189,
+65,176,104,255,0,254,253,249,247,106,4,74,142,254,113,188,172,74,75,165,194,
+1,29,254,227,243,235,99,103,240,234,0,0,2,0,180,0,0,5,121,4,94,0,22,0,29,
+0,0,1,21,36,33,51,17,35,17,34,4,7,17,20,6,35,35,53,52,18,55,53,33,53,19,51,
+50,54,53,17,6,2,188,1,6,1,25,158,176,131,254,238,120,150,151,219,178,168,
+254,166,152,88,49,57,190,4,74,122,142,251,162,3,209,81,77,253,246,152,145,
+111,221,1,129,140,97,144,252,67,68,57,1,150,220,0,2,0,180,255,236,5,121,4,
+94,0,28,0,37,0,0,19,53,52,54,54,51,50,22,22,21,20,6,6,35,32,38,38,53,51,20,
+22,22,51,50,62,2,55,33,1,34,6,6,7,33,46,2,180,118,252,249,249,247,106,109,
+253,251,255,0,241,111,174,84,180,177,141,155,87,39,2,251,243,2,99,167,178,
+83,9,3,89,9,87,173,2,60,44,188,218,96,103,240,234,232,230,99,84,190,166,114,
+127,56,34,76,138,155,1,193,53,120,134,121,130,56,0,2,0,180,0,0,5,121,4,94,
+0,21,0,27,0,0,1,6,6,21,21,35,17,51,17,20,7,23,54,54,55,54,36,51,51,17,35,
+17,17,34,4,6,7,33,1,151,33,18,176,176,18,10,22,54,53,140,1,158,212,158,176,
+139,254,230,245,86,2,240,1,168,105,138,72,109,4,74,254,215,129,94,3,74,94,
+58,147,170,251,162,1,168,2,45,95,182,139,0,0,1,0,180,255,236,5,121,4,94,0,
+32,0,0,1,20,6,6,35,34,38,38,53,52,54,54,33,50,22,22,21,35,52,38,35,34,6,6,
+21,20,22,22,51,50,54,54,53,5,121,116,253,250,249,247,106,106,249,1,2,253,
+242,113,170,200,245,185,170,69,74,178,174,171,186,84,1,170,167,192,87,103,
+240,234,232,231,98,84,189,167,158,139,64,158,196,188,172,74,57,129,117,0,
+0,2,0,180,0,0,5,121,4,94,0,42,0,54,0,0,1,52,38,38,35,34,6,21,20,22,23,54,
+54,51,50,22,21,20,6,6,35,34,38,39,7,33,21,33,53,19,46,2,53,52,36,33,32,22,
+22,21,17,35,1,34,6,7,22,22,51,50,54,53,52,38,4,201,74,173,183,227,212,56,
+86,83,129,85,87,119,67,117,65,46,110,41,135,1,72,253,200,254,108,93,53,1,
+41,1,55,1,11,247,99,176,254,75,35,63,76,9,93,34,55,74,53,2,45,175,171,72,
+109,121,102,92,55,119,92,104,85,66,101,58,30,25,207,141,27,1,118,62,93,117,
+79,187,179,90,221,250,253,211,2,90,54,112,9,32,56,53,48,50,0,1,0,180,255,
+248,5,121,4,74,0,26,0,0,33,35,38,2,36,35,17,20,6,35,53,50,54,53,17,51,50,
+4,22,23,55,38,53,17,33,53,33,5,121,176,31,203,254,210,159,153,197,79,95,191,
+146,1,37,211,38,10,18,251,235,4,197,165,1,34,176,254,182,173,136,141,82,72,
+1,225,120,210,129,2,94,130,1,165,142,0,0,1,0,180,254,20,5,121,4,94,0,37,0,
+0,1,50,22,21,20,6,6,7,1,21,33,53,33,3,54,54,53,52,38,35,34,4,6,2,21,17,35,
+17,51,17,20,7,23,62,4,4,86,139,152,71,145,59,1,19,253,201,1,75,207,145,122,
+80,64,119,254,232,212,114,176,176,18,10,29,94,176,174,189,4,94,136,142,76,
+154,149,27,254,105,27,141,1,54,82,181,120,64,77,148,239,254,206,173,253,167,
+6,54,254,215,129,94,3,98,129,156,102,58,0,0,1,0,180,254,20,5,121,4,94,0,54,
+0,0,1,34,38,38,17,17,51,20,22,22,51,50,62,2,53,52,38,38,35,34,6,21,35,52,
+54,54,51,32,22,22,21,20,6,6,35,34,38,38,39,7,22,21,20,22,22,51,50,54,54,53,
+51,20,6,6,2,252,255,236,93,176,79,178,180,136,163,89,38,72,173,179,241,202,
+170,117,251,238,1,0,251,106,108,251,243,174,142,84,34,9,9,66,159,176,193,
+160,69,180,102,240,254,20,86,217,1,3,1,96,119,125,55,38,81,151,164,183,166,
+69,142,159,166,191,87,97,235,229,237,236,104,19,45,50,4,47,43,155,136,57,
+26,65,71,131,124,51,0,2,0,180,255,236,5,121,4,74,0,33,0,45,0,0,37,52,54,51,
+50,23,38,38,35,34,4,2,21,35,17,51,5,21,37,17,20,7,23,54,36,51,50,22,22,21,
+20,6,35,32,1,39,38,35,34,6,21,20,22,51,50,54,3,82,140,128,40,34,39,139,92,
+137,254,250,167,176,176,3,248,252,8,18,10,103,1,25,190,145,215,119,147,132,
+254,240,1,139,2,65,58,56,69,70,55,51,74,219,111,129,15,50,57,161,254,244,
+122,4,74,219,150,217,254,129,129,94,2,176,174,100,183,114,145,166,1,24,39,
+39,64,55,55,64,94,0,0,1,0,180,255,236,5,121,5,182,0,25,0,0,1,51,17,20,6,4,
+33,34,38,38,53,17,51,17,20,22,22,51,50,54,54,53,17,33,53,33,4,201,176,104,
+255,0,254,253,249,247,106,174,79,183,172,183,180,74,254,194,1,62,5,182,252,
+119,243,235,99,103,240,234,2,29,253,227,186,174,74,73,172,189,1,143,142,0,
+0,1,0,180,254,20,5,121,4,94,0,64,0,0,1,21,33,32,38,38,53,17,33,21,35,20,22,
+51,50,62,2,53,52,38,39,37,46,2,53,52,54,36,51,50,22,22,21,35,52,38,35,34,
+6,21,20,22,23,5,30,2,21,20,6,4,35,34,38,39,7,22,22,21,20,22,22,51,4,51,254,
+230,254,250,247,104,1,90,161,207,221,116,170,93,47,114,167,254,88,120,133,
+60,120,1,1,215,235,241,111,170,189,235,200,203,120,140,1,121,149,162,70,127,
+254,242,220,215,195,32,8,22,9,77,177,174,254,166,146,90,223,249,1,110,141,
+89,83,20,38,63,55,73,75,28,72,21,61,93,91,117,126,62,76,172,151,134,120,65,
+77,65,61,21,61,25,74,115,112,120,132,65,60,66,2,58,76,46,110,110,50,0,0,2,
+0,180,255,236,5,121,4,94,0,25,0,33,0,0,37,50,54,54,53,51,20,6,4,35,34,38,
+38,53,52,54,54,33,50,22,22,23,5,23,22,22,1,38,38,35,34,6,6,7,3,20,177,182,
+82,172,122,254,252,237,249,247,106,106,249,1,2,246,244,113,5,251,242,5,18,
+185,2,127,17,193,214,175,170,74,4,123,56,130,117,164,193,89,103,240,234,232,
+231,98,86,200,181,169,70,165,124,2,133,108,97,56,140,146,0,1,0,180,255,248,
+5,188,5,223,0,45,0,0,1,20,22,51,21,34,38,38,53,17,34,4,6,2,21,21,35,17,52,
+54,54,33,50,22,22,21,35,52,38,38,35,34,6,6,21,17,20,7,23,54,54,55,54,36,51,
+51,5,80,45,63,114,119,51,166,254,196,225,121,176,102,249,1,6,230,231,104,
+187,66,153,157,189,175,75,18,10,21,51,57,147,1,118,200,162,1,25,84,64,141,
+41,96,125,2,145,131,226,254,197,192,47,3,174,248,223,90,53,119,112,58,57,
+24,60,142,144,254,239,129,94,2,72,91,62,156,160,0,0,2,0,180,255,236,5,121,
+4,74,0,19,0,27,0,0,9,2,54,53,17,51,17,20,6,4,33,34,38,38,53,17,51,17,20,1,
+50,54,55,1,1,22,22,1,107,1,165,1,178,7,176,104,255,0,254,253,249,247,106,
+176,1,176,171,178,38,254,121,254,136,42,178,1,152,1,69,254,193,63,80,2,29,
+253,227,243,235,99,103,240,234,2,29,253,227,82,254,160,63,70,1,33,254,224,
+71,63,0,2,0,180,0,0,5,121,4,74,0,17,0,26,0,0,51,53,1,33,53,33,21,1,51,54,
+36,51,51,17,20,6,6,35,55,50,54,53,53,14,2,7,180,3,45,252,252,4,94,252,68,
+186,173,1,110,186,107,61,123,113,4,56,61,78,138,127,120,156,3,26,148,27,252,
+94,195,194,254,250,97,118,53,141,60,53,123,3,50,78,105,0,0,2,0,180,255,236,
+5,121,4,94,0,29,0,41,0,0,37,52,33,50,23,17,34,4,6,2,21,21,35,17,51,17,20,
+7,23,54,54,55,54,36,51,51,17,16,33,32,1,34,6,21,20,22,51,50,53,53,38,38,3,
+82,1,12,50,57,168,254,178,238,129,176,176,18,10,22,54,53,140,1,158,212,158,
+254,233,254,240,1,14,56,69,70,55,105,10,62,219,240,23,2,33,137,228,254,195,
+190,109,4,74,254,215,129,94,3,74,94,58,147,170,252,217,254,181,1,102,64,55,
+55,64,181,31,7,19,0,0,1,0,180,254,20,5,121,4,94,0,29,0,0,37,21,35,17,51,17,
+20,7,23,54,54,55,54,36,51,51,17,16,33,35,53,51,50,54,53,17,34,4,6,2,1,98,
+174,174,18,10,22,54,53,138,1,160,214,158,254,176,53,67,66,80,168,254,176,
+239,128,109,109,4,74,254,215,129,94,3,74,94,58,146,171,251,29,254,153,142,
+93,87,4,127,137,231,254,198,0,1,0,180,255,236,5,203,4,92,0,34,0,0,1,52,54,
+51,50,22,22,21,17,35,17,52,38,38,35,34,21,17,20,6,35,34,38,38,53,17,51,17,
+20,22,22,51,50,54,53,2,231,174,193,157,151,65,183,34,75,83,190,178,193,156,
+148,63,182,34,75,90,88,94,3,0,179,169,95,222,221,253,190,2,66,150,169,74,
+203,254,72,179,169,95,220,223,2,66,253,190,155,166,72,107,96,0,0,1,0,180,
+254,20,5,203,4,92,0,53,0,0,1,32,36,38,53,51,20,22,22,51,50,54,54,53,52,55,
+39,6,6,35,34,38,53,17,52,35,34,6,6,21,17,35,17,52,54,54,51,50,22,21,17,20,
+22,51,50,54,54,53,17,51,17,20,6,4,3,61,254,240,254,248,109,187,76,177,203,
+195,192,84,9,9,31,93,66,191,172,182,90,76,35,182,67,154,160,191,168,87,87,
+97,76,33,183,114,254,248,254,20,51,126,129,64,63,27,59,134,127,63,47,4,66,
+48,166,182,1,184,203,74,167,152,253,190,2,66,216,225,97,165,183,254,72,98,
+105,72,171,150,2,66,251,254,233,232,97,0,0,1,0,180,255,236,5,121,5,182,0,
+25,0,0,1,17,20,22,22,51,50,54,54,53,17,51,17,20,6,4,33,34,38,38,53,17,51,
+17,33,21,1,100,78,181,173,183,180,74,176,104,255,0,254,253,249,247,106,176,
+1,62,3,186,254,115,188,172,74,73,172,189,2,29,253,227,243,235,99,103,240,
+234,3,137,254,148,144,0,0,1,0,180,254,20,5,121,4,94,0,53,0,0,1,32,38,38,53,
+51,20,22,22,51,50,54,54,53,52,55,39,14,2,35,34,38,38,53,52,54,54,33,50,22,
+22,21,35,52,38,35,34,6,6,21,20,22,22,51,50,54,54,53,51,17,20,6,6,3,20,254,
+252,233,90,180,67,159,175,184,173,74,8,8,34,85,143,173,249,247,106,102,249,
+1,6,246,245,115,170,197,246,185,170,69,74,178,174,171,184,82,176,103,244,
+254,20,47,116,143,73,62,27,59,141,148,48,42,4,50,45,19,103,240,234,248,223,
+90,85,189,166,157,140,64,158,196,188,172,74,57,126,120,254,156,248,223,91,
+0,0,2,0,180,254,20,5,121,4,74,0,36,0,44,0,0,19,52,54,51,51,21,20,2,7,21,50,
+36,54,18,53,53,51,17,16,33,35,53,51,50,54,53,17,52,55,39,6,6,7,6,4,35,35,
+19,54,18,55,35,34,6,21,180,144,151,240,186,173,171,1,79,236,127,176,254,176,
+53,67,66,80,18,10,20,53,56,135,254,108,223,162,176,90,106,5,96,48,57,3,33,
+152,145,105,199,254,138,154,125,129,221,1,52,190,109,251,49,254,153,142,93,
+87,1,211,129,94,2,70,95,60,142,157,1,203,101,1,10,132,65,60,0,0,1,0,180,255,
+236,5,121,4,74,0,27,0,0,1,35,1,17,35,17,51,1,1,51,17,20,6,6,33,34,38,38,39,
+51,22,22,51,50,54,54,53,17,3,41,45,254,104,176,201,1,149,1,158,201,102,249,
+254,250,235,235,121,15,176,12,180,236,191,172,74,2,4,1,137,254,117,2,72,254,
+119,1,137,253,211,248,223,90,52,122,110,75,58,57,138,145,1,207,0,1,0,180,
+0,0,5,121,5,223,0,24,0,0,19,51,1,17,52,38,38,35,34,6,7,35,62,2,51,32,22,22,
+21,17,35,1,17,35,180,176,3,101,75,174,190,225,178,10,191,15,122,236,233,1,
+7,248,102,176,252,155,176,4,12,252,217,3,15,145,140,61,61,78,111,121,52,90,
+222,249,252,82,3,49,252,207,0,1,0,180,255,236,5,121,4,94,0,45,0,0,1,34,6,
+21,20,22,22,51,50,54,54,53,51,20,6,6,35,34,36,38,53,52,54,55,53,38,38,53,
+52,54,36,51,50,22,22,21,35,38,38,35,34,6,21,20,22,51,2,131,144,137,91,186,
+149,179,181,81,172,117,247,240,222,254,243,126,101,125,115,90,120,1,1,215,
+247,246,115,170,2,200,243,205,198,118,142,1,244,91,100,74,77,35,55,128,120,
+166,193,87,65,132,120,123,118,17,8,26,105,119,117,126,62,85,191,164,159,138,
+79,89,96,82,0,1,0,180,255,238,5,121,4,74,0,22,0,0,1,17,50,36,54,18,53,53,
+51,17,35,17,52,55,39,6,6,7,6,4,35,35,17,1,100,169,1,79,237,128,176,176,18,
+10,23,52,48,135,254,92,217,158,4,74,252,51,135,226,1,58,189,109,251,182,1,
+41,129,94,2,79,94,52,145,170,4,92,0,2,0,180,255,236,5,121,4,94,0,23,0,33,
+0,0,1,34,6,6,21,35,52,54,36,51,50,22,22,21,20,6,6,33,34,38,38,39,1,38,3,50,
+54,54,53,52,39,1,22,22,3,25,172,185,84,172,121,1,3,239,249,247,106,104,252,
+254,255,227,217,130,30,3,150,91,216,187,168,69,28,252,241,47,172,3,207,57,
+131,115,165,192,89,103,240,234,232,231,98,40,89,79,2,213,62,252,174,63,154,
+199,166,84,253,155,26,27,0,3,0,180,255,236,5,121,4,94,0,15,0,33,0,45,0,0,
+1,20,6,4,33,34,38,38,53,52,54,54,33,32,22,22,5,34,38,39,6,21,20,22,22,51,
+50,54,54,53,52,39,6,6,3,34,6,7,22,22,51,50,54,55,38,38,5,121,104,255,0,254,
+253,249,247,106,102,249,1,6,1,4,248,100,253,151,121,222,75,4,74,178,174,180,
+177,74,7,83,229,114,187,173,33,91,208,92,98,216,85,39,174,2,45,243,235,99,
+103,240,234,248,223,90,100,234,204,63,51,60,77,188,172,74,71,168,195,75,59,
+49,62,1,137,66,84,45,57,57,42,84,69,0,0,1,252,129,4,227,253,84,5,184,0,10,
+0,0,1,52,51,50,22,21,20,6,35,34,38,252,129,107,49,55,54,50,54,53,5,78,106,
+53,53,50,57,57,0,1,251,88,4,131,254,147,5,223,0,3,0,0,1,5,21,37,251,88,3,
+59,252,197,5,223,198,150,197,0,0,1,251,88,4,131,254,147,5,223,0,5,0,0,1,21,
+37,5,53,37,254,147,254,99,254,98,1,158,5,25,150,199,199,150,198,0,0,1,251,
+18,4,166,254,225,6,20,0,19,0,0,1,20,22,22,51,50,54,54,53,51,20,14,2,35,34,
+46,2,53,251,184,58,132,130,134,132,57,166,50,115,189,139,132,182,113,55,6,
+20,100,97,40,42,98,97,123,128,78,37,36,73,124,133,0,0,2,251,18,4,166,254,
+225,6,33,0,9,0,29,0,0,1,52,51,50,22,21,20,6,35,34,39,20,22,22,51,50,54,54,
+53,51,20,14,2,35,34,46,2,53,252,141,107,50,54,55,49,107,213,58,132,130,134,
+132,57,166,50,115,189,139,132,182,113,55,5,182,107,55,52,51,55,200,100,97,
+40,42,98,97,123,128,78,37,36,73,124,133,0,1,252,129,254,184,253,84,255,141,
+0,10,0,0,5,52,51,50,22,21,20,6,35,34,38,252,129,107,49,55,54,50,54,53,221,
+106,53,53,50,57,57,0,0,1,250,135,254,20,255,76,0,61,0,24,0,0,37,21,6,6,21,
+20,22,22,51,50,54,54,53,51,20,6,6,35,34,36,38,53,52,54,55,251,246,101,90,
+90,189,153,189,179,79,166,121,253,230,222,254,242,125,99,126,61,57,14,76,
+76,75,82,43,47,108,101,143,168,75,65,133,120,120,99,16,0,0,2,250,135,254,
+20,255,76,0,61,0,10,0,35,0,0,5,52,51,50,22,21,20,6,35,34,38,3,21,6,6,21,20,
+22,22,51,50,54,54,53,51,20,6,6,35,34,36,38,53,52,54,55,252,129,107,49,55,
+54,50,54,53,139,101,90,90,189,153,189,179,79,166,121,253,230,222,254,242,
+125,99,126,180,106,53,53,50,57,57,1,35,57,14,76,76,75,82,43,47,108,101,143,
+168,75,65,133,120,120,99,16,0,1,0,78,1,217,5,223,3,39,0,15,0,0,19,54,54,36,
+51,50,4,22,23,7,38,36,35,34,4,7,78,33,203,1,46,168,171,1,51,209,32,43,78,
+254,162,244,244,254,168,79,1,238,85,145,83,83,145,85,21,86,94,93,87,0,0,1,
+0,180,0,2,1,96,4,74,0,3,0,0,37,35,17,51,1,96,172,172,2,4,72,0,0,1,250,135,
+254,20,255,76,0,30,0,23,0,0,7,20,14,2,35,34,46,2,53,53,51,21,20,30,2,51,50,
+62,2,53,180,68,146,229,161,172,236,145,64,176,46,102,165,119,128,172,103,
+44,106,110,148,90,38,35,80,132,97,178,170,63,85,52,22,22,57,100,77,0,0,2,
+250,135,254,20,255,76,0,30,0,10,0,34,0,0,5,52,51,50,22,21,20,6,35,34,38,37,
+20,14,2,35,34,46,2,53,53,51,21,20,30,2,51,50,62,2,53,252,129,107,49,55,53,
+51,54,53,2,203,68,146,229,161,172,236,145,64,176,46,102,165,119,128,172,103,
+44,180,106,52,54,51,56,56,125,110,148,90,38,35,80,132,97,178,170,63,85,52,
+22,22,57,100,77,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,
+0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,0,3,0,
+1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,30,0,248,
+0,3,0,1,4,9,0,7,0,68,1,22,0,3,0,1,4,9,0,8,0,42,1,90,0,3,0,1,4,9,0,9,0,40,
+1,132,0,3,0,1,4,9,0,10,0,96,1,172,0,3,0,1,4,9,0,11,0,62,2,12,0,3,0,1,4,9,
+0,12,0,60,2,74,0,3,0,1,4,9,0,13,2,150,2,134,0,3,0,1,4,9,0,14,0,52,5,28,0,
+67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,
+51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,
+0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,
+0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,
+0,97,0,110,0,115,0,32,0,75,0,97,0,121,0,97,0,104,0,32,0,76,0,105,0,82,0,101,
+0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,75,0,97,0,121,0,97,0,104,0,32,
+0,76,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,
+50,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,75,0,97,
+0,121,0,97,0,104,0,76,0,105,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,
+0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,
+0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,
+105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,
+97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,
+101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,
+98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,
+101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,
+0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,
+0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,
+0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,
+0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,
+79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,40,0,0,0,2,
+0,4,0,0,0,41,0,1,0,42,0,49,0,3,0,50,0,51,0,1,0,52,0,53,0,3,0,4,0,0,0,1,0,
+0,0,1,0,0,0,10,0,48,0,78,0,2,68,70,76,84,0,14,107,97,108,105,0,26,0,4,0,0,
+0,0,255,255,0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,1,0,2,109,97,114,107,0,14,109,
+97,114,107,0,22,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,2,0,6,0,14,0,4,0,0,0,1,
+0,16,0,4,0,0,0,1,0,120,0,1,0,92,0,102,0,1,0,12,0,34,0,5,0,0,1,24,0,0,1,24,
+0,0,1,24,0,0,1,24,0,0,1,24,0,28,0,252,0,252,0,252,0,252,0,252,0,252,0,252,
+0,252,0,252,1,8,0,252,0,252,1,8,0,252,0,252,0,252,0,252,0,252,0,252,1,8,0,
+252,0,252,0,252,1,8,0,252,0,252,0,252,0,252,0,2,0,1,0,42,0,46,0,0,0,2,0,1,
+0,14,0,41,0,0,0,1,0,148,0,164,0,2,0,12,0,34,0,5,0,1,0,216,0,0,0,186,0,0,0,
+186,0,0,0,228,0,0,0,228,0,28,0,158,0,188,0,158,0,188,0,158,0,188,0,158,0,
+188,0,158,0,188,0,158,0,188,0,170,0,188,0,176,0,200,0,158,0,188,0,158,0,188,
+0,176,0,200,0,158,0,188,0,158,0,188,0,158,0,188,0,158,0,188,0,158,0,188,0,
+182,0,188,0,158,0,188,0,176,0,200,0,158,0,188,0,176,0,200,0,182,0,188,0,158,
+0,188,0,158,0,188,0,158,0,188,0,158,0,188,0,158,0,188,0,158,0,188,0,2,0,2,
+0,47,0,49,0,0,0,52,0,53,0,3,0,2,0,1,0,14,0,41,0,0,0,1,3,22,4,216,0,1,252,
+244,4,136,0,1,3,22,6,64,0,1,1,104,0,0,0,1,251,80,0,0,0,1,1,104,255,16,0,1,
+1,104,254,62,0,1,1,104,255,236,0,1,3,22,0,0,0,1,252,234,0,0,0,1,3,22,0,40,
+0,1,251,60,0,0,0,0,0,1,0,0,0,10,0,48,0,74,0,2,68,70,76,84,0,14,107,97,108,
+105,0,26,0,4,0,0,0,0,255,255,0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,1,0,2,99,99,
+109,112,0,14,99,99,109,112,0,20,0,0,0,1,0,0,0,0,0,1,0,0,0,2,0,6,0,14,0,6,
+0,0,0,1,0,16,0,1,0,0,0,1,0,80,0,3,0,1,0,26,0,1,0,18,0,0,0,1,0,0,0,1,0,1,0,
+2,0,48,0,49,0,2,0,7,0,16,0,16,0,0,0,19,0,20,0,1,0,22,0,22,0,3,0,26,0,26,0,
+4,0,29,0,30,0,5,0,35,0,35,0,7,0,37,0,37,0,8,0,2,0,10,0,2,0,52,0,53,0,1,0,
+2,0,48,0,49,0,0,};
+#endif
@@ -0,0 +1,895 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansKharoshthi_Regular_ttf_size = 21868;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansKharoshthi_Regular_ttf");
+asm(".type fz_font_NotoSansKharoshthi_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansKharoshthi_Regular_ttf, 21868");
+asm(".balign 64");
+asm("fz_font_NotoSansKharoshthi_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansKharoshthi-Regular.ttf\"");
+#else
+const int fz_font_NotoSansKharoshthi_Regular_ttf_size = 21868;
+const char fz_font_NotoSansKharoshthi_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,194,0,252,0,0,72,96,0,0,0,54,71,
+80,79,83,206,78,162,104,0,0,72,152,0,0,8,230,71,83,85,66,210,45,235,98,0,
+0,81,128,0,0,3,234,79,83,47,50,133,93,105,100,0,0,1,104,0,0,0,96,99,109,97,
+112,0,233,163,99,0,0,3,220,0,0,1,0,103,97,115,112,0,7,0,7,0,0,72,84,0,0,0,
+12,103,108,121,102,136,100,115,10,0,0,5,232,0,0,60,52,104,101,97,100,6,120,
+19,139,0,0,0,236,0,0,0,54,104,104,101,97,16,1,0,107,0,0,1,36,0,0,0,36,104,
+109,116,120,92,128,72,46,0,0,1,200,0,0,2,20,108,111,99,97,119,43,133,245,
+0,0,4,220,0,0,1,12,109,97,120,112,0,148,0,169,0,0,1,72,0,0,0,32,110,97,109,
+101,143,192,187,75,0,0,66,28,0,0,6,24,112,111,115,116,255,105,0,102,0,0,72,
+52,0,0,0,32,0,1,0,0,0,1,7,174,20,161,214,194,95,15,60,245,0,11,8,0,0,0,0,
+0,205,121,207,188,0,0,0,0,210,109,241,209,255,115,253,152,7,254,7,186,0,0,
+0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,152,0,0,8,20,255,115,250,57,7,254,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,133,0,1,0,0,0,133,0,168,0,14,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,9,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,
+0,0,0,0,0,16,0,71,79,79,71,0,64,0,0,255,255,8,141,253,152,0,0,8,141,2,104,
+0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,5,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,
+0,4,182,0,180,0,0,1,233,0,0,0,6,0,0,0,66,0,0,2,55,0,0,0,10,0,0,3,96,0,0,0,
+33,0,0,255,115,0,0,1,55,6,92,0,180,4,150,0,135,5,113,0,203,5,113,0,203,4,
+172,0,203,5,184,0,135,4,121,0,172,5,8,255,248,5,88,0,203,4,233,0,203,4,158,
+0,172,4,172,0,203,3,94,0,217,4,207,0,180,5,41,0,150,3,227,0,172,4,72,0,180,
+3,178,0,201,4,133,0,68,5,57,0,135,5,10,0,203,5,150,0,203,5,145,0,217,5,8,
+255,207,4,117,0,203,4,68,0,150,4,152,0,203,5,238,0,90,5,162,0,180,4,137,0,
+14,4,227,0,203,4,100,0,203,6,115,0,180,4,244,0,135,0,0,0,145,0,0,2,10,0,0,
+1,158,4,8,0,200,2,154,0,68,5,6,0,68,6,248,0,68,5,18,0,68,3,242,0,68,4,43,
+0,68,2,156,0,68,5,8,0,68,2,37,0,147,2,229,0,135,4,229,0,180,6,109,0,180,5,
+131,0,135,7,45,0,135,2,178,0,90,3,203,0,90,8,20,0,23,6,92,0,171,4,150,0,135,
+5,143,0,111,5,143,0,111,4,172,0,22,5,184,0,135,4,121,255,247,5,8,255,248,
+5,137,0,50,4,233,0,161,4,158,0,172,5,25,0,0,3,243,0,0,4,207,0,151,5,41,0,
+150,3,227,0,172,4,146,0,80,4,127,0,52,4,133,0,68,5,57,0,135,5,46,0,80,6,38,
+0,80,5,145,0,217,5,8,255,207,4,117,0,166,4,68,0,150,4,152,0,156,5,238,0,90,
+5,162,0,180,5,165,0,80,4,227,0,203,4,204,0,91,6,115,0,171,4,244,0,135,5,117,
+0,180,3,176,0,80,6,107,0,180,5,93,0,201,5,163,0,203,5,41,0,150,4,133,0,68,
+5,57,0,135,4,68,0,150,5,238,0,90,6,42,0,170,5,145,0,217,4,133,0,68,5,57,0,
+135,5,8,255,207,5,238,0,90,4,201,255,248,5,50,0,180,5,237,0,120,6,107,0,203,
+5,165,0,203,7,92,255,246,5,67,0,180,5,147,0,203,6,5,0,150,4,219,255,216,6,
+100,0,180,6,227,0,180,6,86,0,120,5,50,0,180,0,0,0,2,0,3,0,1,0,0,0,20,0,3,
+0,10,0,0,0,84,0,4,0,64,0,0,0,12,0,8,0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,
+255,0,0,0,0,0,13,0,32,0,160,254,255,255,255,0,1,255,245,255,227,255,99,1,
+2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,172,0,0,0,0,0,0,0,13,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,
+160,0,0,0,160,0,0,0,3,0,0,254,255,0,0,254,255,0,0,0,1,0,1,10,0,0,1,10,3,0,
+0,0,4,0,1,10,5,0,1,10,6,0,0,0,8,0,1,10,12,0,1,10,19,0,0,0,10,0,1,10,21,0,
+1,10,23,0,0,0,18,0,1,10,25,0,1,10,51,0,0,0,21,0,1,10,56,0,1,10,58,0,0,0,48,
+0,1,10,63,0,1,10,71,0,0,0,51,0,1,10,80,0,1,10,88,0,0,0,60,0,0,0,21,0,21,0,
+21,0,21,0,60,0,82,0,121,0,185,0,206,0,229,0,253,1,65,1,100,1,136,1,193,1,
+244,2,53,2,136,2,196,3,19,3,59,3,122,3,166,3,216,4,3,4,31,4,66,4,119,4,163,
+4,216,5,13,5,68,5,110,5,158,5,214,6,6,6,48,6,86,6,130,6,165,6,200,6,246,7,
+50,7,112,7,160,7,221,8,29,8,87,8,101,8,117,8,140,8,160,8,182,8,229,9,46,9,
+95,9,129,9,179,9,212,10,39,10,61,10,99,10,140,10,201,11,56,12,28,12,50,12,
+87,12,219,13,48,13,130,13,217,14,67,14,150,15,1,15,60,15,142,15,207,16,27,
+16,95,16,142,16,195,17,14,17,80,17,146,17,223,18,39,18,100,18,168,18,239,
+19,52,19,116,19,174,19,237,20,34,20,90,20,159,20,237,21,62,21,132,21,207,
+22,41,22,125,22,187,22,239,23,32,23,94,23,163,23,220,24,17,24,76,24,123,24,
+179,24,228,25,26,25,78,25,138,25,186,25,246,26,108,26,164,26,224,27,36,27,
+92,27,196,28,23,28,83,28,133,28,195,29,18,29,91,29,184,30,26,0,2,0,193,0,
+0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,
+253,135,5,182,250,74,104,4,230,0,0,1,0,180,255,223,4,33,5,186,0,22,0,0,1,
+38,53,52,54,51,50,22,21,16,1,39,18,18,53,52,38,35,34,6,21,20,23,1,68,144,
+235,187,222,233,254,209,164,136,155,141,138,112,138,101,3,10,144,176,161,
+207,242,245,254,126,253,142,45,1,17,1,253,177,169,175,116,95,112,107,0,1,
+1,233,3,0,4,86,6,199,0,7,0,0,1,54,0,55,23,6,0,7,1,233,67,1,3,148,147,105,
+254,228,80,3,59,159,1,243,250,72,173,253,229,183,0,2,0,6,253,244,3,27,0,115,
+0,11,0,21,0,0,37,2,2,35,34,38,53,52,54,51,50,4,1,50,19,38,35,34,6,21,20,22,
+3,27,45,241,220,114,169,218,194,51,1,13,254,91,230,63,77,115,115,125,79,84,
+254,191,254,225,150,114,173,202,20,254,44,1,88,11,111,111,54,79,0,1,0,66,
+254,78,3,172,1,88,0,44,0,0,19,54,51,50,23,22,51,50,54,53,52,38,39,46,2,53,
+52,54,51,50,23,7,38,35,34,6,6,21,20,22,23,30,2,21,20,6,35,34,39,38,35,34,
+7,66,63,152,30,88,87,61,120,97,84,88,181,124,68,171,145,178,135,51,153,99,
+58,67,29,86,88,170,136,69,198,195,74,80,80,30,132,51,254,229,27,13,14,40,
+40,48,44,2,1,38,87,75,115,137,53,146,54,20,33,35,45,42,2,6,40,92,72,119,127,
+10,10,12,0,1,2,55,5,51,5,72,7,186,0,6,0,0,1,0,37,23,6,0,7,2,55,1,61,1,109,
+103,144,254,131,147,5,162,1,30,250,120,97,254,211,129,0,1,0,10,255,236,3,
+12,3,12,0,9,0,0,55,18,18,54,55,23,14,2,7,10,136,200,216,128,90,117,192,175,
+124,53,1,6,1,15,164,30,141,27,143,240,249,0,0,1,3,96,253,254,5,49,2,113,0,
+9,0,0,1,4,17,20,3,39,18,53,16,37,3,176,1,129,80,176,80,254,223,2,113,182,
+254,8,196,254,255,41,1,8,174,1,118,132,0,3,0,33,253,215,4,170,255,184,0,23,
+0,34,0,45,0,0,5,50,22,23,62,2,51,50,22,21,20,6,35,34,38,39,6,35,34,38,53,
+52,54,5,34,6,7,22,51,50,54,53,52,38,33,34,6,21,20,22,51,50,55,38,38,1,74,
+70,127,89,74,79,83,45,135,162,182,138,83,128,53,126,132,138,181,163,2,175,
+28,69,69,88,82,53,64,66,253,152,51,48,70,53,78,86,86,71,72,67,99,77,57,32,
+131,100,107,143,64,45,109,141,109,100,131,151,44,75,76,57,42,42,54,50,34,
+47,64,74,82,39,0,1,255,115,253,190,4,59,0,133,0,19,0,0,37,22,22,21,20,4,35,
+34,36,39,55,22,4,51,50,54,53,52,38,39,2,176,193,202,254,223,233,181,254,144,
+153,94,127,1,71,144,174,182,137,154,133,49,194,130,153,185,115,109,125,89,
+108,90,88,78,110,40,0,2,1,55,6,47,3,186,7,68,0,10,0,21,0,0,1,52,54,51,50,
+22,21,20,35,34,38,37,52,54,51,50,22,21,20,35,34,38,1,55,52,53,52,56,108,53,
+52,1,174,52,53,52,56,108,53,52,6,186,76,62,62,76,139,65,74,76,62,62,76,139,
+65,0,0,1,0,180,255,223,5,236,5,186,0,35,0,0,1,20,7,39,54,53,52,38,39,2,3,
+39,18,18,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,7,22,22,5,
+236,148,129,100,161,170,71,183,164,136,155,141,138,112,138,101,129,144,235,
+187,222,233,19,238,240,1,51,190,150,107,106,113,127,167,42,254,228,254,134,
+45,1,17,1,253,177,169,175,116,95,112,107,107,144,176,161,207,242,245,100,
+101,46,239,0,0,1,0,135,255,221,4,45,5,195,0,31,0,0,1,20,6,7,39,54,54,53,52,
+38,35,34,38,53,16,0,33,50,22,23,7,38,38,35,34,6,21,20,22,51,50,22,3,164,81,
+63,145,40,73,73,75,226,247,1,2,1,6,97,243,74,65,75,203,81,182,156,163,173,
+165,124,1,113,83,234,87,66,63,208,63,64,50,230,198,1,29,1,27,61,42,145,45,
+49,196,214,152,128,121,0,0,2,0,203,255,225,5,53,5,219,0,28,0,38,0,0,1,20,
+6,4,7,6,2,7,39,54,18,55,38,38,53,52,55,23,7,6,21,20,22,23,18,54,51,50,22,
+5,34,6,6,7,54,54,53,52,38,5,53,153,254,233,168,25,99,21,164,18,87,38,166,
+198,143,135,41,71,126,109,81,204,153,130,161,254,213,64,82,79,41,168,225,
+70,4,106,112,183,106,2,103,254,5,148,17,122,1,220,155,31,200,148,190,191,
+69,68,117,112,107,131,25,1,22,245,146,6,72,166,145,9,150,109,52,63,0,2,0,
+203,255,223,5,53,5,219,0,41,0,51,0,0,1,20,6,7,39,54,53,52,38,38,39,2,7,39,
+54,18,55,38,38,53,52,55,23,7,6,21,20,22,23,18,54,51,50,22,21,20,6,4,7,7,22,
+22,3,34,6,6,7,54,54,53,52,38,4,172,83,64,129,100,66,146,122,64,34,164,18,
+87,38,166,198,143,135,41,71,126,109,81,204,153,130,161,153,254,233,168,18,
+251,230,162,64,82,79,41,168,225,70,1,51,84,191,65,107,106,113,66,75,54,18,
+254,217,242,17,122,1,220,155,31,200,148,190,191,69,68,117,112,107,131,25,
+1,22,245,146,117,112,183,106,2,86,26,157,3,15,72,166,145,9,150,109,52,63,
+0,0,1,0,203,255,221,4,59,5,221,0,35,0,0,1,6,2,7,4,17,20,2,7,39,54,18,53,52,
+38,35,34,6,7,39,54,54,55,7,34,38,38,39,55,22,22,51,50,54,54,55,4,59,62,243,
+73,1,65,225,205,129,209,174,119,94,46,127,44,37,80,185,40,39,94,178,141,33,
+139,31,184,102,58,90,78,76,5,109,104,254,240,48,32,254,234,150,254,156,184,
+88,191,1,27,124,81,95,19,17,141,31,102,39,4,87,149,79,86,95,144,37,69,105,
+0,1,0,135,255,225,5,27,5,221,0,50,0,0,1,52,38,39,6,2,7,39,18,19,35,34,6,21,
+20,23,7,38,53,52,54,36,51,51,23,55,38,38,39,55,22,22,51,50,54,55,23,14,3,
+7,22,22,21,20,6,7,39,54,54,4,106,133,129,80,122,27,174,43,184,2,181,202,101,
+129,144,150,1,15,161,24,23,51,121,225,49,139,31,187,100,71,128,91,133,38,
+98,100,95,35,178,195,81,63,145,49,63,2,35,125,172,37,244,254,21,177,15,1,
+64,2,87,163,142,112,107,107,144,176,136,210,117,2,49,14,181,118,86,96,143,
+86,125,84,65,93,80,77,48,48,243,174,87,245,88,66,80,190,0,1,0,172,255,221,
+4,129,5,215,0,17,0,0,1,6,0,0,7,39,54,0,55,38,0,39,55,22,18,23,18,55,4,129,
+44,254,240,254,124,175,102,120,1,24,135,161,254,249,52,156,44,222,146,142,
+44,5,162,227,253,189,253,228,131,125,91,1,99,238,164,1,91,120,90,97,254,214,
+152,1,38,228,0,1,255,248,255,211,4,250,5,188,0,38,0,0,1,52,54,51,23,6,6,21,
+20,23,22,21,20,6,35,34,39,7,6,2,7,39,54,54,18,18,55,23,2,3,22,51,50,54,54,
+53,52,39,38,3,203,134,118,51,68,69,15,15,233,223,119,76,39,81,217,120,67,
+71,150,124,136,31,174,46,79,76,86,110,110,56,9,10,4,217,100,115,141,9,32,
+37,46,73,72,55,157,164,20,127,242,254,192,46,135,29,207,1,56,2,90,228,14,
+254,186,254,218,19,34,74,64,41,81,78,0,1,0,203,255,221,4,209,5,197,0,22,0,
+0,1,6,3,2,7,36,33,21,34,6,6,7,39,54,19,19,4,33,53,50,54,54,55,4,80,87,151,
+150,110,1,44,1,71,143,247,231,227,51,140,249,125,254,213,254,166,143,247,
+231,227,5,61,144,254,151,254,162,220,150,152,57,101,141,135,226,2,63,1,27,
+158,152,57,101,141,0,0,1,0,203,255,223,4,61,5,215,0,28,0,0,1,50,22,21,20,
+2,3,39,54,18,55,39,32,7,39,54,33,50,23,54,53,52,38,35,34,7,39,54,36,2,203,
+189,181,181,111,162,52,122,43,156,254,243,183,37,181,1,50,99,88,32,103,114,
+220,232,37,118,1,18,5,215,143,160,222,253,26,254,251,43,120,1,143,198,4,67,
+141,76,4,177,130,80,71,78,142,44,52,0,0,1,0,172,255,225,4,121,5,203,0,23,
+0,0,5,54,18,55,46,2,53,52,54,55,23,6,21,20,22,22,23,18,55,23,6,0,7,2,55,18,
+90,60,219,233,111,66,57,145,92,78,174,176,128,75,166,89,254,234,37,16,121,
+1,135,204,31,106,175,133,96,163,79,66,152,106,98,117,73,27,1,171,177,45,212,
+252,54,252,0,1,0,203,255,225,4,217,5,178,0,11,0,0,5,54,18,19,33,55,33,7,33,
+2,2,7,1,8,32,226,101,254,92,28,3,242,29,254,105,106,226,35,16,230,3,42,1,
+27,151,151,254,218,252,207,227,0,0,1,0,217,255,223,2,223,5,195,0,15,0,0,1,
+38,38,39,6,17,16,19,7,2,17,16,19,23,22,1,2,80,26,119,35,27,72,172,68,64,174,
+4,1,20,3,123,34,182,62,219,254,230,254,106,254,242,25,1,92,1,97,1,144,1,151,
+15,99,254,132,0,0,1,0,180,255,227,4,117,5,217,0,32,0,0,1,20,51,50,54,51,50,
+22,21,20,2,0,7,39,54,36,18,53,52,38,35,34,6,35,34,38,53,52,54,55,23,6,6,1,
+96,160,71,140,78,175,165,226,254,123,237,43,213,1,71,179,94,95,71,140,78,
+146,161,145,107,51,61,70,4,193,105,16,144,167,174,254,152,254,253,53,148,
+46,215,1,34,147,84,68,17,141,128,103,155,18,141,16,74,0,0,1,0,150,255,225,
+5,27,5,203,0,21,0,0,5,54,18,19,6,7,39,54,37,54,55,23,6,7,4,23,7,38,37,2,2,
+7,1,94,20,131,85,231,169,36,168,1,57,77,54,166,46,71,1,92,148,60,163,254,
+194,84,134,24,16,151,2,25,1,24,5,60,141,72,4,252,127,45,108,230,18,58,152,
+64,16,254,229,253,228,160,0,1,0,172,255,225,3,137,5,217,0,33,0,0,1,20,22,
+23,30,2,21,20,6,6,35,34,39,55,22,51,50,54,53,52,38,38,39,46,2,53,52,54,55,
+23,6,6,1,174,70,121,124,103,57,136,240,138,127,92,37,81,99,151,189,42,78,
+99,119,85,48,145,107,51,63,68,4,193,57,120,118,122,145,156,91,119,203,117,
+29,149,22,156,127,57,104,104,97,119,122,133,77,103,155,18,141,16,74,0,0,1,
+0,180,255,219,3,238,5,203,0,33,0,0,1,20,2,7,39,54,18,53,52,38,35,34,6,7,39,
+62,2,53,52,33,34,7,39,54,51,50,22,21,20,6,7,50,22,3,238,251,220,109,231,172,
+115,118,53,134,30,37,125,106,52,254,243,80,73,23,105,84,221,211,61,54,155,
+165,2,143,144,254,147,183,109,197,1,2,120,76,57,24,13,144,31,68,104,81,164,
+12,145,15,150,157,72,131,51,137,0,1,0,201,255,223,3,66,5,215,0,34,0,0,1,52,
+38,38,39,46,3,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,23,30,2,21,20,2,
+7,39,54,18,2,66,27,53,70,41,81,65,40,197,155,82,158,41,37,84,158,86,92,67,
+97,85,81,43,122,98,145,81,112,2,164,44,63,45,30,18,41,69,108,84,135,182,16,
+13,149,22,82,79,62,80,37,32,71,107,80,146,254,109,193,47,185,1,121,0,0,1,
+0,68,255,225,4,43,5,203,0,20,0,0,1,20,7,39,54,53,52,38,39,2,2,7,39,18,0,55,
+23,6,7,4,4,4,43,147,129,100,199,209,88,134,19,174,40,1,21,94,166,47,72,1,
+13,1,16,2,98,192,148,107,106,113,140,175,37,254,217,253,223,139,15,1,16,3,
+226,233,45,112,232,40,248,0,0,1,0,135,255,225,4,223,5,203,0,25,0,0,23,18,
+19,6,7,39,54,55,18,55,23,6,7,4,4,21,20,7,39,54,53,16,37,6,2,7,240,44,189,
+167,134,37,141,244,80,51,166,49,70,1,12,1,25,147,129,100,254,96,74,143,24,
+16,1,68,2,126,13,46,141,59,15,1,4,121,45,118,224,35,246,205,192,148,107,106,
+113,1,29,67,245,253,194,160,0,1,0,203,255,225,4,131,5,213,0,34,0,0,1,20,22,
+51,50,54,55,62,2,51,50,22,21,16,1,39,0,17,52,38,35,34,6,7,6,6,35,34,38,53,
+52,55,23,6,1,119,40,56,46,61,22,26,73,115,85,132,124,254,148,140,1,72,45,
+41,47,53,31,40,141,114,130,134,63,160,51,4,193,87,83,66,79,95,97,50,140,155,
+254,66,253,44,72,2,152,1,178,59,72,48,94,125,116,172,162,150,122,43,130,0,
+0,1,0,203,255,225,5,14,5,172,0,25,0,0,1,33,6,7,4,4,21,20,6,7,39,54,53,52,
+38,39,2,2,7,39,54,18,19,33,55,33,4,188,254,127,33,38,1,11,1,15,66,57,145,
+92,199,208,95,132,23,174,31,221,106,254,70,28,3,242,5,20,83,123,40,246,198,
+96,163,79,66,152,106,140,175,37,254,208,253,247,154,15,221,3,33,1,38,152,
+0,1,0,217,2,72,5,109,5,217,0,24,0,0,1,20,22,51,50,54,53,52,39,55,22,21,20,
+6,4,35,32,0,53,52,54,55,23,6,6,1,137,235,206,181,202,101,129,144,152,254,
+241,159,254,244,254,190,82,61,146,49,64,4,68,169,188,163,142,113,107,106,
+144,175,137,210,116,1,9,228,89,246,85,65,78,191,0,1,255,207,255,221,4,174,
+5,195,0,15,0,0,1,18,18,19,7,38,2,3,2,0,7,39,54,0,18,55,3,27,22,246,135,162,
+111,198,53,119,254,169,116,145,99,1,61,236,26,5,195,254,204,252,155,254,253,
+74,214,2,112,1,47,254,224,253,101,186,68,155,2,96,2,26,128,0,0,1,0,203,255,
+221,4,27,5,195,0,26,0,0,1,20,2,7,39,54,18,53,52,38,35,34,38,38,53,52,54,55,
+23,6,21,20,22,22,51,50,22,4,27,250,156,149,149,229,98,119,215,172,67,22,15,
+163,38,46,121,148,190,181,3,135,144,253,210,236,76,218,1,249,131,62,49,34,
+85,96,63,144,47,27,132,63,44,31,13,122,0,1,0,150,255,225,4,8,5,203,0,16,0,
+0,5,54,18,55,6,6,7,39,54,37,54,55,23,6,2,2,7,1,199,23,137,75,171,239,94,36,
+159,1,170,73,58,166,52,181,144,26,16,171,2,36,249,5,29,31,141,67,7,239,142,
+45,125,253,186,253,187,181,0,1,0,203,255,221,4,61,5,180,0,18,0,0,1,50,22,
+21,20,0,7,39,54,18,53,52,38,35,34,7,39,54,36,2,203,178,192,254,230,178,142,
+171,255,117,100,223,229,37,118,1,18,5,180,187,177,214,253,104,253,88,228,
+2,83,211,93,120,77,141,44,52,0,1,0,90,255,223,5,133,5,180,0,24,0,0,1,50,22,
+21,20,2,7,39,54,18,53,52,38,35,34,7,2,2,7,39,54,0,55,54,36,4,18,178,193,181,
+112,162,108,171,117,100,211,203,61,222,71,162,67,1,2,36,134,1,76,5,180,186,
+178,217,253,107,251,43,237,2,116,212,93,120,45,254,201,252,216,163,43,158,
+3,197,229,40,52,0,0,1,0,180,255,211,5,72,5,180,0,35,0,0,5,39,54,18,18,19,
+35,34,6,21,20,23,7,38,53,52,54,36,51,50,4,22,21,20,2,7,39,54,54,53,52,38,
+39,10,2,1,55,67,95,190,158,50,2,181,202,101,129,144,152,1,15,159,173,1,14,
+147,125,82,127,70,88,139,128,47,187,233,45,135,40,1,65,2,56,1,34,163,142,
+113,107,106,142,177,137,210,116,119,224,150,131,254,232,69,97,70,205,93,127,
+173,34,254,233,253,134,254,145,0,0,1,0,14,255,211,4,47,5,199,0,38,0,0,1,20,
+6,6,35,34,39,6,2,7,39,54,18,53,52,39,55,22,22,21,23,51,50,54,53,52,38,39,
+46,2,39,55,22,22,23,30,2,4,47,120,214,123,56,46,45,219,156,78,160,203,17,
+136,18,27,38,39,124,153,129,164,136,160,85,22,141,19,135,127,193,171,86,3,
+213,114,179,100,4,211,254,173,87,135,99,1,116,203,95,54,33,24,118,69,2,134,
+110,88,88,18,17,56,92,91,52,73,73,16,24,75,133,0,0,1,0,203,255,225,4,182,
+5,205,0,25,0,0,5,54,19,38,36,39,54,54,53,52,38,39,55,22,22,21,20,7,22,33,
+18,55,23,6,0,3,2,117,34,130,240,254,244,82,106,78,49,64,109,91,77,96,87,1,
+36,125,81,166,83,254,235,43,16,250,1,210,6,33,33,115,173,85,67,98,60,115,
+65,152,97,175,132,14,1,178,199,45,199,252,34,254,232,0,0,1,0,203,255,225,
+4,55,5,184,0,40,0,0,1,38,53,52,54,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,
+55,23,6,6,35,32,17,52,54,55,54,54,53,52,38,35,34,6,21,20,23,1,90,143,106,
+192,124,213,241,155,191,166,139,67,66,130,163,51,69,195,90,254,217,175,210,
+166,96,148,130,112,138,100,3,8,143,177,104,170,94,187,163,127,225,144,121,
+178,79,66,59,73,145,32,42,1,17,95,228,164,127,137,94,105,121,116,95,113,106,
+0,0,1,0,180,255,223,5,236,5,186,0,38,0,0,1,20,7,39,54,53,52,38,39,2,3,39,
+18,18,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,32,19,54,55,23,6,2,7,22,
+22,5,236,148,129,100,161,170,71,183,164,136,155,141,138,112,138,101,129,144,
+235,187,1,72,94,46,58,162,62,140,35,232,231,1,51,190,150,107,106,113,127,
+167,42,254,228,254,134,45,1,17,1,253,177,169,175,116,95,112,107,107,144,176,
+161,207,254,248,126,132,43,140,254,141,130,49,238,0,0,1,0,135,255,223,4,109,
+5,217,0,36,0,0,1,34,38,53,52,19,23,6,2,21,20,22,51,50,54,55,54,53,52,38,35,
+34,6,7,39,54,51,50,22,21,20,2,7,39,54,19,6,1,250,190,181,225,162,97,114,98,
+119,107,166,125,30,92,104,69,114,77,37,171,148,177,174,167,96,161,80,90,195,
+1,164,143,160,247,2,15,43,225,254,124,110,78,73,27,42,126,69,77,74,15,26,
+144,57,145,158,135,253,235,217,43,181,1,32,59,0,1,0,145,5,246,4,154,6,141,
+0,3,0,0,1,33,55,33,4,125,252,20,35,3,230,5,246,151,0,1,2,10,255,233,5,199,
+2,20,0,3,0,0,1,1,39,1,5,199,252,120,53,3,129,1,160,254,73,121,1,178,0,1,1,
+158,254,113,2,156,255,133,0,11,0,0,1,52,54,51,50,22,21,20,6,35,34,38,1,158,
+66,59,61,68,68,61,59,66,254,252,69,68,71,66,64,75,72,0,0,1,0,200,253,152,
+3,64,255,163,0,11,0,0,19,51,53,51,21,51,21,35,21,35,53,35,200,250,132,250,
+250,132,250,254,238,181,181,103,239,239,0,1,0,68,255,223,2,86,5,188,0,7,0,
+0,1,6,0,7,39,54,0,55,2,86,32,254,244,65,165,65,1,9,26,5,174,255,251,208,160,
+45,154,4,69,209,0,1,0,68,255,223,4,172,5,215,0,26,0,0,1,6,7,22,22,51,50,54,
+53,52,38,39,55,22,17,20,2,35,34,38,39,2,7,39,54,0,55,2,86,7,36,5,114,102,
+106,142,20,31,160,63,230,186,113,156,48,164,66,165,65,1,9,26,5,174,55,197,
+232,247,235,160,99,147,88,43,119,254,234,235,254,212,107,116,253,102,153,
+45,154,4,69,209,0,1,0,68,255,223,6,158,5,213,0,45,0,0,1,6,7,22,22,51,50,62,
+2,19,23,7,6,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,2,35,34,38,39,6,
+6,35,34,39,2,2,7,39,54,0,55,2,86,7,36,2,97,102,57,70,44,24,38,164,29,5,118,
+88,92,105,29,23,160,30,34,197,168,122,165,26,18,133,105,218,83,66,126,34,
+165,65,1,9,26,5,174,55,197,246,233,81,136,180,1,92,28,240,45,45,160,227,207,
+186,85,190,59,43,57,211,129,237,254,216,139,132,131,140,207,254,239,254,63,
+81,45,154,4,69,209,0,0,1,0,68,255,236,5,41,5,158,0,24,0,0,55,54,19,38,38,
+39,55,22,22,23,0,55,23,6,0,7,22,18,23,7,38,2,39,0,7,68,124,242,68,187,64,
+104,56,184,102,1,168,223,113,116,254,130,145,162,237,31,178,29,215,135,254,
+254,90,176,181,1,24,63,147,36,155,26,137,95,1,211,191,111,106,254,114,161,
+181,254,184,83,90,80,1,51,151,254,216,132,0,1,0,68,255,227,3,152,4,223,0,
+18,0,0,19,54,54,51,50,22,21,16,1,39,62,2,53,16,33,34,6,7,68,43,208,146,222,
+233,254,61,133,157,158,92,254,234,89,119,34,3,246,107,126,242,245,254,113,
+254,122,107,130,196,220,128,1,88,74,80,0,1,0,68,255,240,3,209,4,221,0,31,
+0,0,1,62,2,53,52,38,35,34,7,39,54,51,50,22,21,20,6,7,22,22,21,20,6,7,39,36,
+53,52,38,38,35,1,2,137,161,73,153,116,101,132,59,115,173,216,237,88,105,190,
+171,207,195,45,1,15,96,219,179,2,188,22,65,86,81,62,78,52,144,59,149,138,
+82,127,57,10,129,131,156,228,54,157,71,185,73,69,30,0,0,1,0,68,255,231,2,
+66,4,233,0,15,0,0,19,54,19,23,6,7,51,16,2,7,39,54,18,55,6,7,117,152,128,150,
+17,45,93,185,164,161,161,148,20,74,63,3,10,159,1,64,57,62,96,254,253,253,
+196,236,66,254,1,127,201,124,67,0,0,2,0,68,255,244,4,174,4,248,0,45,0,55,
+0,0,1,50,22,21,20,7,23,51,50,54,54,53,52,3,55,22,22,21,20,4,35,34,39,6,6,
+21,20,51,50,36,55,23,6,4,35,34,38,53,52,55,55,38,38,53,52,54,19,20,23,54,
+53,52,38,35,34,6,1,76,143,150,52,45,46,173,141,54,51,145,45,27,254,245,241,
+117,69,119,49,145,157,1,159,49,39,55,254,27,124,158,161,123,67,145,135,148,
+24,172,51,69,60,39,55,4,164,159,150,74,109,2,15,38,58,156,1,8,47,197,232,
+130,70,80,8,185,97,27,125,41,21,152,21,38,106,119,67,205,113,40,163,125,111,
+151,254,246,160,45,102,60,72,85,67,0,0,1,0,147,4,176,1,145,5,197,0,11,0,0,
+19,52,54,51,50,22,21,20,6,35,34,38,147,65,60,61,68,68,61,59,66,5,59,66,72,
+72,66,64,75,74,0,2,0,135,2,115,2,94,4,55,0,11,0,23,0,0,1,20,6,35,34,38,53,
+52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,2,94,142,106,103,120,133,
+101,112,125,133,65,50,49,65,59,55,51,64,3,88,98,131,117,100,100,135,122,113,
+54,60,60,54,54,61,61,0,2,0,180,1,102,4,49,4,193,0,13,0,25,0,0,1,20,6,6,35,
+34,38,53,52,54,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,4,49,125,216,
+128,195,229,116,205,122,209,241,166,167,132,135,166,155,146,135,164,3,25,
+123,201,111,221,191,124,207,116,228,215,134,165,165,134,140,159,162,0,1,0,
+180,0,10,6,63,5,174,0,34,0,0,37,6,4,35,32,17,16,0,33,32,23,7,38,36,35,34,
+6,7,54,33,50,4,23,7,38,36,35,32,7,22,0,51,50,36,55,5,205,130,254,178,114,
+253,41,1,72,1,35,1,74,239,65,88,254,203,105,206,223,18,229,1,64,186,1,184,
+70,36,67,254,75,158,254,183,218,22,1,40,250,128,1,32,104,117,48,59,2,240,
+1,68,1,112,102,146,41,53,231,221,47,50,28,141,25,44,61,244,254,250,51,43,
+0,3,0,135,0,250,4,252,5,66,0,13,0,41,0,74,0,0,1,20,6,4,35,34,0,53,52,18,36,
+51,32,0,5,20,7,50,55,38,38,35,34,6,21,20,23,38,53,52,54,55,55,53,52,35,34,
+7,39,54,51,50,1,6,35,6,6,21,20,51,50,54,55,23,6,6,35,34,38,53,52,54,55,6,
+6,21,20,22,23,7,22,51,50,54,53,4,252,158,254,235,165,251,254,222,147,1,5,
+157,1,13,1,51,254,57,8,173,95,37,215,147,187,237,123,57,160,200,2,65,74,84,
+41,122,111,166,1,25,105,229,15,24,57,31,108,42,65,60,172,50,75,73,26,15,97,
+75,19,24,123,109,182,189,231,3,37,157,254,144,1,27,241,159,1,7,150,254,219,
+99,16,37,19,129,151,229,191,212,109,116,119,104,92,9,10,9,75,43,111,63,254,
+179,21,40,67,20,57,63,37,104,53,74,64,71,45,90,43,5,38,49,46,81,57,41,91,
+226,194,0,0,14,0,135,255,238,6,166,5,197,0,11,0,23,0,35,0,47,0,59,0,71,0,
+83,0,95,0,107,0,119,0,131,0,143,0,155,0,167,0,0,1,20,6,35,34,38,53,52,54,
+51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,3,20,6,35,34,38,53,52,54,51,50,
+22,7,52,38,35,34,6,21,20,22,51,50,54,1,20,6,35,34,38,53,52,54,51,50,22,7,
+52,38,35,34,6,21,20,22,51,50,54,1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,
+35,34,6,21,20,22,51,50,54,3,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,
+6,21,20,22,51,50,54,5,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,
+20,22,51,50,54,3,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,
+51,50,54,5,221,142,106,103,120,135,99,112,125,133,65,50,49,65,59,55,51,64,
+192,142,106,103,120,135,98,111,127,134,65,49,50,65,59,56,51,63,254,238,142,
+106,103,120,135,98,111,127,133,65,50,49,65,58,56,51,64,1,57,142,106,103,120,
+135,99,110,127,133,65,50,49,65,59,55,51,64,209,142,106,103,120,135,99,112,
+125,133,65,50,49,65,59,55,51,64,4,205,142,106,103,120,133,100,112,126,133,
+65,50,49,66,59,56,51,64,230,142,105,102,122,133,101,112,125,133,65,49,50,
+65,59,56,51,63,4,197,99,131,117,100,103,133,122,114,54,61,61,54,54,60,60,
+254,99,98,131,117,100,103,133,121,115,54,61,61,54,54,61,61,254,105,98,131,
+117,100,103,133,121,115,54,61,61,54,54,61,61,4,27,98,131,117,100,101,135,
+122,114,54,61,61,54,54,61,61,254,83,99,131,117,100,101,135,122,114,54,61,
+61,54,54,60,60,5,98,131,117,100,102,133,121,114,54,60,60,54,54,61,61,254,
+103,99,130,114,103,100,135,122,113,54,60,60,54,54,61,61,0,1,0,90,255,223,
+2,88,5,188,0,7,0,0,1,6,2,7,39,54,0,55,2,88,31,246,67,166,62,1,33,26,5,174,
+248,251,206,165,45,146,4,74,212,0,0,2,0,90,255,223,3,113,5,188,0,7,0,15,0,
+0,1,6,2,7,39,54,0,55,5,6,2,7,39,54,0,55,2,88,31,246,67,166,62,1,33,26,1,158,
+31,246,67,166,62,1,33,26,5,174,248,251,206,165,45,146,4,74,212,14,248,251,
+206,165,45,146,4,74,212,0,0,2,0,23,1,90,7,254,3,223,0,45,0,91,0,0,1,34,6,
+7,6,35,34,39,38,38,35,34,6,7,39,54,54,51,50,23,22,22,51,50,54,55,54,51,50,
+23,22,22,51,50,54,55,55,23,6,6,35,34,38,39,38,38,3,34,6,7,6,35,34,39,38,38,
+35,34,6,7,39,54,54,51,50,30,2,51,50,54,55,54,51,50,23,22,22,51,50,54,55,55,
+23,6,6,35,34,38,39,38,38,4,190,51,85,55,96,118,116,111,61,94,50,69,123,54,
+68,95,179,66,129,112,73,59,33,33,61,71,110,130,129,112,73,59,33,64,110,74,
+121,57,131,192,103,62,100,52,53,86,93,53,88,51,96,118,116,111,61,94,50,69,
+123,54,67,84,185,70,76,111,92,81,46,32,58,76,111,129,130,110,69,62,34,66,
+108,74,121,57,127,196,103,62,100,52,53,86,3,55,29,35,65,65,35,29,48,27,141,
+49,53,72,48,25,26,47,72,72,48,25,31,37,57,156,64,57,30,35,34,30,254,164,30,
+34,65,65,35,29,48,28,142,45,57,45,55,45,24,49,72,72,46,27,30,37,58,156,62,
+59,30,35,34,30,0,2,0,171,255,223,5,236,6,114,0,42,0,49,0,0,1,20,7,39,54,53,
+52,38,39,2,3,39,54,18,18,53,16,39,2,2,7,39,54,19,7,38,53,52,54,54,51,23,54,
+55,23,6,7,4,17,20,7,22,22,1,54,19,6,6,21,20,5,236,148,129,100,161,170,71,
+183,164,77,146,68,167,86,234,72,151,112,163,122,144,106,192,124,39,32,16,
+100,12,24,1,48,19,238,240,251,213,61,85,109,134,1,51,190,150,107,106,113,
+127,167,42,254,228,254,134,45,147,1,133,1,46,121,1,6,63,254,188,253,56,161,
+72,254,1,198,101,144,176,104,169,95,1,107,78,33,68,100,76,254,118,100,101,
+46,239,1,139,166,1,5,2,115,94,111,0,0,2,0,135,255,221,4,45,6,114,0,41,0,49,
+0,0,55,54,55,38,38,53,16,0,33,23,54,55,23,6,7,22,22,23,7,38,39,2,3,22,51,
+50,22,21,20,6,7,39,54,54,53,52,38,35,34,39,6,7,3,20,22,23,18,19,6,6,201,78,
+69,102,111,1,2,1,6,19,33,12,100,9,24,80,154,49,65,107,149,91,109,52,43,165,
+124,81,63,145,40,73,73,75,58,52,85,61,45,49,49,125,97,174,146,171,183,179,
+49,193,132,1,29,1,27,1,110,66,33,59,96,13,50,27,145,64,21,254,171,254,177,
+5,121,141,83,234,87,66,63,208,63,64,50,8,251,137,3,44,89,107,31,1,77,1,48,
+5,196,0,0,2,0,111,255,225,5,83,6,114,0,42,0,52,0,0,55,54,19,38,38,53,52,54,
+55,23,7,6,21,20,23,18,55,23,6,3,22,23,18,54,51,50,22,21,20,6,4,7,6,2,7,39,
+54,18,55,38,39,2,7,1,34,6,6,7,54,54,53,52,38,111,87,164,85,94,75,68,135,41,
+71,66,182,32,100,39,153,46,51,81,204,153,130,161,153,254,233,168,28,95,22,
+164,18,87,38,55,46,140,94,3,34,64,82,79,41,168,225,70,171,195,1,190,51,157,
+98,101,202,78,69,68,117,112,104,68,2,4,173,33,220,254,3,14,4,1,22,245,146,
+117,112,183,106,2,116,254,21,151,17,122,1,220,155,5,13,254,69,215,4,118,72,
+166,145,9,150,109,52,63,0,2,0,111,255,223,5,83,6,114,0,55,0,65,0,0,1,20,6,
+4,7,7,22,22,21,20,6,7,39,54,53,52,38,38,39,2,7,39,54,18,55,38,39,2,7,39,54,
+19,38,38,53,52,54,55,23,7,6,21,20,23,18,55,23,6,3,22,23,18,54,51,50,22,5,
+34,6,6,7,54,54,53,52,38,5,83,153,254,233,168,20,251,232,83,64,129,100,68,
+148,119,71,26,164,18,87,38,55,46,140,94,151,87,164,85,94,75,68,135,41,71,
+66,182,32,100,39,153,46,51,81,204,153,130,161,254,213,64,82,79,41,168,225,
+70,4,106,112,183,106,2,86,26,160,148,84,191,65,107,106,113,65,75,55,17,254,
+163,187,17,122,1,220,155,5,13,254,69,215,72,195,1,190,51,157,98,101,202,78,
+69,68,117,112,104,68,2,4,173,33,220,254,3,14,4,1,22,245,146,6,72,166,145,
+9,150,109,52,63,0,0,2,0,22,255,221,4,59,6,114,0,43,0,49,0,0,55,54,18,55,38,
+38,39,55,22,23,54,55,23,6,7,22,51,50,54,54,55,23,6,2,7,4,17,20,2,7,39,54,
+18,53,52,38,38,35,34,6,7,39,2,7,1,34,39,7,54,55,22,80,228,72,62,110,27,139,
+30,83,66,19,100,22,58,54,45,58,90,78,76,122,62,243,73,1,65,225,205,129,209,
+174,58,97,58,46,127,44,1,139,107,1,220,68,64,44,151,64,171,180,2,102,215,
+42,129,64,86,90,69,210,98,33,118,219,18,37,69,105,84,104,254,240,48,32,254,
+234,150,254,156,184,88,191,1,27,124,58,78,40,19,17,4,254,63,247,3,233,22,
+151,73,60,0,3,0,135,255,225,5,27,6,114,0,52,0,58,0,66,0,0,55,55,38,53,52,
+54,55,55,38,39,55,22,23,54,55,23,6,7,22,51,50,54,55,23,14,3,7,22,22,21,20,
+6,7,39,54,54,53,52,38,39,6,2,7,39,18,19,34,7,6,2,7,3,20,23,54,55,6,1,38,39,
+7,55,51,23,54,181,60,106,196,177,64,107,45,139,19,49,55,17,100,22,51,75,76,
+71,128,91,133,38,98,100,95,35,178,195,81,63,145,49,63,133,129,80,122,27,174,
+40,185,32,48,59,159,60,25,14,61,62,137,1,252,67,67,26,62,24,23,9,171,142,
+127,152,157,228,50,187,92,109,86,60,56,179,86,33,125,187,43,86,125,84,65,
+93,80,77,48,48,243,174,87,245,88,66,80,190,70,125,172,37,244,254,21,177,15,
+1,45,2,106,5,196,254,48,139,1,243,38,44,158,173,81,1,80,7,33,90,3,2,11,0,
+0,1,255,247,255,221,4,129,6,114,0,30,0,0,39,54,18,55,38,39,55,22,23,54,55,
+23,6,7,22,23,18,55,23,6,0,0,7,39,54,0,55,38,39,2,3,9,74,217,86,101,36,156,
+15,39,53,15,100,23,59,113,159,142,44,168,44,254,240,254,124,175,102,120,1,
+24,135,135,108,180,142,171,166,2,70,255,140,91,90,36,63,172,82,33,127,220,
+155,167,1,38,228,28,227,253,189,253,228,131,125,91,1,99,238,137,136,253,146,
+254,186,0,0,1,255,248,255,211,4,250,6,114,0,48,0,0,37,54,19,38,39,7,6,2,7,
+39,54,18,18,55,23,2,3,22,23,18,18,55,23,2,3,54,54,53,52,39,38,53,52,54,51,
+23,6,6,21,20,23,22,21,20,6,7,6,2,7,1,125,92,109,48,38,39,77,202,119,67,104,
+194,161,33,174,46,79,56,45,94,149,22,100,47,168,111,96,10,10,134,118,51,68,
+69,15,15,218,211,33,118,55,171,213,1,36,4,10,127,250,254,200,46,135,43,1,
+141,2,178,248,14,254,186,254,218,13,3,1,3,1,208,109,33,255,0,253,223,7,82,
+82,47,75,75,57,100,115,141,9,32,37,46,73,72,55,151,165,5,106,254,176,129,
+0,1,0,50,255,221,5,2,6,114,0,36,0,0,55,18,19,6,35,53,50,55,18,55,23,6,3,54,
+54,55,23,6,3,2,7,36,33,21,34,6,6,7,39,54,1,55,6,7,6,2,7,50,134,195,77,50,
+101,80,104,31,100,23,73,105,221,202,53,87,151,150,110,1,44,1,71,143,247,231,
+227,51,138,1,60,60,182,191,71,185,67,171,1,46,2,46,5,152,13,1,47,156,33,128,
+254,242,29,103,126,136,144,254,151,254,162,220,150,152,57,101,141,135,222,
+2,215,135,96,37,246,253,216,154,0,2,0,161,255,223,4,61,6,114,0,33,0,43,0,
+0,55,54,19,6,7,39,54,55,18,55,6,7,39,54,55,54,55,23,7,22,22,21,20,2,3,39,
+54,18,55,39,34,7,2,7,1,52,38,39,6,7,55,50,23,54,161,102,108,79,52,37,93,134,
+96,64,175,175,37,217,219,27,13,100,26,171,161,181,111,162,52,122,43,156,93,
+63,137,87,2,85,93,102,62,69,107,99,88,32,171,234,1,39,17,19,141,37,21,1,6,
+206,15,59,142,77,16,92,66,33,123,7,145,150,222,253,26,254,251,43,120,1,143,
+198,4,7,254,88,201,4,61,75,73,2,235,221,3,4,177,0,0,1,0,172,255,225,4,121,
+6,114,0,38,0,0,55,54,19,38,38,53,52,54,55,23,6,6,21,20,22,23,18,55,23,6,3,
+22,23,54,18,55,23,6,2,2,7,39,54,18,55,38,39,2,7,181,95,143,120,127,66,57,
+145,51,41,57,68,193,33,100,41,155,73,100,40,123,40,166,51,178,149,26,174,
+18,90,60,114,63,145,81,171,214,1,135,49,174,146,96,163,79,66,84,121,53,83,
+111,38,2,29,182,33,229,254,1,19,14,133,1,120,95,45,122,253,201,253,196,173,
+15,121,1,135,204,17,15,254,58,179,0,0,1,0,0,255,225,5,70,6,114,0,24,0,0,53,
+54,18,19,35,55,51,54,55,23,7,33,7,33,2,2,7,39,54,18,19,35,2,2,7,74,248,99,
+109,28,128,35,15,100,34,2,254,29,254,105,106,226,35,174,32,226,101,187,92,
+228,74,171,167,2,149,1,52,151,116,76,33,159,151,254,218,252,207,227,15,230,
+3,42,1,27,254,164,253,78,170,0,0,1,0,0,255,223,3,116,6,114,0,29,0,0,53,54,
+18,55,54,55,23,54,55,23,6,7,23,22,22,23,7,38,38,39,6,17,16,19,7,2,17,53,2,
+7,91,232,75,18,14,42,34,12,100,8,25,19,2,145,133,143,26,119,35,27,72,172,
+68,131,84,171,207,2,115,230,159,81,4,111,68,33,52,104,1,54,241,184,90,34,
+182,62,219,254,230,254,106,254,242,25,1,92,1,97,28,254,109,194,0,2,0,151,
+255,227,4,117,6,114,0,31,0,42,0,0,1,20,22,51,18,55,23,6,3,54,51,50,22,21,
+20,2,0,7,39,55,39,18,19,38,38,53,52,54,55,23,6,6,1,34,7,2,3,54,36,18,53,52,
+38,1,96,81,74,125,37,100,27,97,114,42,175,165,226,254,123,237,43,9,104,118,
+183,132,140,145,107,51,61,70,1,168,41,138,158,121,192,1,38,161,94,4,193,56,
+49,1,103,179,33,159,254,173,9,144,167,174,254,152,254,253,53,148,2,50,1,14,
+2,0,9,138,121,103,155,18,141,16,74,254,215,12,253,239,254,221,53,213,1,18,
+140,84,68,0,0,1,0,150,255,225,5,27,6,14,0,35,0,0,19,54,19,6,7,39,54,55,18,
+55,23,6,7,54,55,54,55,23,6,7,4,23,7,38,37,2,2,7,39,54,18,19,6,7,6,7,165,56,
+76,59,52,36,73,119,81,28,102,27,47,54,98,77,54,166,46,71,1,92,148,60,163,
+254,194,84,134,24,174,20,131,85,74,65,50,65,1,233,164,1,9,13,18,141,31,21,
+1,53,161,19,201,233,5,2,252,127,45,108,230,18,58,152,64,16,254,229,253,228,
+160,15,151,2,25,1,24,1,8,234,241,0,0,1,0,172,255,225,3,137,6,114,0,41,0,0,
+55,54,19,38,38,53,52,54,55,23,6,6,21,20,22,23,18,55,23,6,3,30,2,21,20,6,6,
+35,34,39,55,22,51,50,54,53,52,38,39,2,7,237,96,123,113,85,145,107,51,63,68,
+53,42,166,28,100,36,150,114,103,55,136,240,138,127,92,37,81,99,151,189,69,
+89,108,76,255,229,1,83,116,185,97,103,155,18,141,16,74,49,55,96,48,1,218,
+158,33,218,254,22,112,145,156,88,119,203,117,29,149,22,156,127,70,138,92,
+254,173,187,0,0,2,0,80,255,219,4,56,6,114,0,40,0,47,0,0,55,54,18,19,38,35,
+34,7,39,54,51,50,23,54,55,23,7,22,21,20,6,7,50,22,21,20,2,7,39,54,18,53,52,
+38,35,34,6,7,6,2,7,1,52,39,6,7,54,54,80,99,237,93,36,43,80,73,23,105,84,58,
+53,36,8,100,34,211,61,54,155,165,251,220,109,231,172,115,118,45,124,39,60,
+130,41,1,212,76,44,65,98,87,171,228,2,132,1,32,4,12,145,15,6,128,45,33,160,
+61,220,72,131,51,137,130,144,254,147,183,109,197,1,2,120,76,57,20,14,191,
+254,149,93,4,48,87,41,169,215,34,120,0,0,1,0,52,255,223,4,107,5,215,0,44,
+0,0,19,36,55,38,38,39,46,3,53,52,54,54,51,50,22,23,7,38,35,34,6,21,20,22,
+22,23,22,22,23,54,55,23,6,7,6,2,7,39,54,18,55,4,7,52,1,19,228,19,66,42,41,
+81,65,40,90,159,103,82,158,41,37,84,158,86,92,32,61,71,102,83,14,209,154,
+28,204,179,10,122,86,145,73,105,11,254,216,195,2,176,40,41,32,39,18,18,41,
+69,108,84,87,147,83,16,13,149,22,82,79,45,62,45,27,40,90,66,39,34,114,55,
+43,149,254,132,168,47,165,1,85,103,69,33,0,1,0,68,255,225,4,43,6,14,0,32,
+0,0,1,54,19,38,39,2,2,7,39,18,0,55,23,6,7,22,23,18,55,23,6,3,4,17,20,7,39,
+54,53,52,39,6,7,2,3,54,75,70,91,88,134,19,174,40,1,21,94,166,47,72,89,71,
+80,35,102,26,66,1,0,147,129,100,118,43,48,1,233,155,1,6,25,17,254,217,253,
+223,139,15,1,16,3,226,233,45,112,232,15,20,1,35,200,19,204,254,196,129,254,
+240,192,148,107,106,113,151,90,186,183,0,0,1,0,135,255,225,4,223,6,14,0,38,
+0,0,1,54,55,38,39,6,2,7,39,18,19,6,7,39,54,55,18,55,23,6,7,22,23,18,55,23,
+6,3,22,17,20,7,39,54,53,52,39,6,7,2,193,56,72,77,101,74,143,24,174,44,189,
+167,134,37,141,244,80,51,166,49,70,104,74,80,35,102,26,66,246,147,129,100,
+109,39,51,1,233,163,251,29,16,245,253,194,160,15,1,68,2,126,13,46,141,59,
+15,1,4,121,45,118,224,15,23,1,37,199,19,209,254,199,128,254,241,192,148,107,
+106,113,145,90,174,189,0,1,0,80,255,225,4,167,6,114,0,43,0,0,55,18,19,38,
+53,52,55,23,6,21,20,23,18,55,23,6,3,54,55,62,2,51,50,22,21,20,2,3,39,18,18,
+53,52,38,35,34,6,7,6,6,35,2,7,80,134,155,130,63,160,51,19,140,28,100,30,112,
+49,31,26,73,115,85,132,124,179,185,140,160,168,45,41,47,53,31,41,143,109,
+166,108,171,1,53,1,183,70,232,150,122,43,130,103,90,36,1,159,144,33,170,254,
+123,27,107,95,97,50,140,155,226,253,192,254,144,72,1,68,2,37,225,59,72,48,
+94,129,112,253,226,246,0,0,1,0,80,255,225,5,158,6,114,0,39,0,0,55,54,18,19,
+35,55,51,54,55,23,7,33,7,33,6,7,4,4,21,20,6,7,39,54,54,53,52,38,39,2,2,7,
+39,54,18,19,35,2,2,7,80,65,252,102,152,28,171,37,15,100,35,2,210,29,254,127,
+33,38,1,11,1,15,66,57,145,51,41,199,208,89,137,24,174,31,221,106,165,78,231,
+84,171,144,2,157,1,60,152,121,77,33,165,152,83,123,40,246,198,96,163,79,66,
+84,121,53,140,175,37,254,232,253,228,159,15,221,3,33,1,38,254,222,253,45,
+188,0,0,1,0,217,1,62,5,109,5,217,0,39,0,0,1,54,55,38,38,53,52,54,55,23,6,
+6,21,20,22,23,54,18,55,23,2,3,23,51,50,54,53,52,39,55,22,21,20,6,4,35,35,
+39,6,7,2,8,34,49,186,200,82,61,146,49,64,137,117,45,102,23,107,38,93,20,21,
+181,202,101,129,144,152,254,241,159,24,24,41,26,1,83,103,165,47,245,178,89,
+246,85,65,78,191,71,131,167,34,163,1,167,129,19,254,228,254,76,1,163,142,
+113,107,106,144,175,137,210,116,1,174,93,0,1,255,207,255,221,4,174,6,114,
+0,28,0,0,37,18,19,39,2,0,7,39,54,0,18,55,55,22,23,54,55,23,6,3,18,18,23,7,
+38,2,39,2,7,1,120,135,183,20,119,254,169,116,145,99,1,61,236,26,166,5,8,65,
+21,100,30,108,57,192,93,162,79,151,51,136,92,171,1,51,2,9,107,254,224,253,
+101,186,68,155,2,96,2,26,128,13,75,58,201,107,33,164,254,129,254,234,253,
+193,178,74,151,1,163,202,254,80,206,0,0,1,0,166,255,221,4,27,6,114,0,38,0,
+0,55,18,19,46,2,53,52,54,55,23,6,21,20,22,22,23,18,55,23,6,3,51,50,22,21,
+20,2,7,39,54,18,53,52,38,35,35,2,3,166,149,172,118,118,48,22,15,163,38,31,
+75,70,116,27,100,25,86,7,190,181,250,156,149,149,229,98,119,30,184,126,171,
+1,86,1,240,5,40,82,85,63,144,47,27,132,63,38,30,16,2,1,87,140,33,134,254,
+194,122,140,144,253,210,236,76,218,1,249,131,62,49,253,149,254,224,0,1,0,
+150,255,225,4,8,6,14,0,28,0,0,19,54,55,6,7,39,54,55,18,55,23,6,7,55,54,55,
+23,6,2,2,7,39,54,18,55,6,7,6,7,222,77,58,105,66,36,91,159,78,30,102,26,48,
+199,73,58,166,52,181,144,26,174,23,137,75,107,79,50,65,1,233,232,206,16,24,
+141,37,19,1,39,171,19,202,234,7,239,142,45,125,253,186,253,187,181,15,171,
+2,36,249,3,6,234,241,0,1,0,156,255,221,4,61,6,114,0,30,0,0,55,54,18,19,6,
+7,39,54,55,54,55,23,7,22,22,21,20,2,2,7,39,54,18,18,53,52,38,39,2,2,7,156,
+88,241,89,167,167,37,205,216,34,16,100,34,167,178,113,226,121,142,115,209,
+102,112,97,78,231,84,171,203,2,135,1,18,17,55,141,74,18,112,82,33,158,7,186,
+170,131,254,139,254,58,173,88,154,1,153,1,86,129,91,118,4,254,222,253,45,
+188,0,0,1,0,90,255,223,5,133,6,114,0,37,0,0,37,54,18,19,6,7,2,2,7,39,54,0,
+55,54,36,55,54,55,23,7,22,22,21,20,2,2,7,39,54,18,18,53,52,38,39,2,2,7,1,
+240,97,236,85,169,139,61,222,71,162,72,1,1,32,115,1,28,114,36,14,100,34,162,
+171,72,147,74,162,71,139,69,108,90,92,228,72,171,224,2,126,1,8,12,30,254,
+201,252,216,163,43,169,3,211,201,38,48,6,120,73,33,159,10,186,166,133,254,
+141,254,54,167,43,156,1,178,1,100,131,90,117,5,254,168,253,73,161,0,2,0,180,
+255,211,5,72,6,64,0,39,0,45,0,0,1,55,38,53,52,54,55,55,23,7,54,51,50,4,22,
+21,20,2,7,39,54,54,53,52,38,39,10,2,7,39,54,54,18,18,55,34,7,2,3,3,20,23,
+54,55,6,1,18,47,141,184,160,36,102,19,58,61,173,1,14,147,125,82,127,70,88,
+139,128,47,187,233,131,67,68,141,122,124,36,56,62,84,92,89,30,54,45,129,2,
+27,142,141,175,151,225,50,177,19,130,9,119,224,150,131,254,232,69,97,70,205,
+93,127,173,34,254,233,253,134,254,145,51,135,28,190,1,35,1,237,217,11,254,
+66,254,178,1,230,63,58,187,178,82,0,0,1,0,80,255,211,5,75,6,114,0,50,0,0,
+55,54,18,19,38,39,55,54,55,23,6,7,22,23,30,2,21,20,6,6,35,34,39,6,2,7,39,
+54,54,18,53,52,39,55,22,22,21,23,51,50,54,53,52,38,39,38,39,2,2,7,80,84,253,
+95,18,11,63,41,11,100,16,28,57,194,193,171,86,120,214,123,56,46,45,219,156,
+78,102,167,94,17,136,18,27,38,39,124,153,122,171,190,88,71,221,85,171,189,
+2,175,1,38,35,51,23,144,56,33,89,112,74,25,24,75,133,104,114,179,100,4,211,
+254,173,87,135,63,213,1,6,136,95,54,33,24,118,69,2,134,110,85,88,21,23,49,
+254,245,253,87,196,0,0,1,0,203,255,225,4,182,6,114,0,39,0,0,37,54,19,38,38,
+39,54,54,53,52,38,39,55,22,22,21,20,7,22,23,18,18,55,23,6,3,51,18,55,23,6,
+2,2,7,39,54,19,39,2,7,1,40,78,136,112,139,56,106,78,49,64,109,91,77,96,41,
+66,97,139,16,100,38,166,124,125,81,166,49,179,147,28,174,34,130,129,130,87,
+171,173,1,113,10,26,23,115,173,85,67,98,60,115,65,152,97,175,132,6,4,1,10,
+1,186,88,33,223,253,224,1,178,199,45,117,253,182,253,182,180,15,250,1,210,
+4,254,109,202,0,0,1,0,91,255,225,4,184,5,184,0,49,0,0,1,6,7,6,6,21,20,22,
+51,50,55,23,6,6,35,32,17,52,55,6,7,39,36,37,54,54,53,52,38,35,34,6,21,20,
+23,7,38,53,52,54,54,51,50,22,22,21,20,6,7,55,4,184,251,233,165,131,67,66,
+130,163,51,69,195,90,254,217,170,185,123,27,1,23,1,36,156,85,148,130,112,
+138,100,129,143,106,192,124,146,202,106,67,72,240,2,221,67,55,123,171,77,
+66,59,73,145,32,42,1,17,132,170,40,19,169,40,52,124,125,92,105,121,116,95,
+113,106,107,143,177,104,170,94,87,158,105,88,151,78,50,0,2,0,171,255,223,
+5,236,6,114,0,46,0,53,0,0,55,54,19,7,38,53,52,54,54,51,23,54,55,23,6,7,22,
+23,54,55,23,6,2,7,22,22,21,20,7,39,54,53,52,38,39,2,3,39,54,18,18,53,16,39,
+2,2,7,19,20,23,54,19,6,6,171,112,163,122,144,106,192,124,39,32,16,100,12,
+24,201,70,46,58,162,62,140,35,232,231,148,129,100,161,170,71,183,164,77,146,
+68,167,86,234,72,30,97,61,85,109,134,171,254,1,198,101,144,176,104,169,95,
+1,107,78,33,68,100,48,199,126,132,43,140,254,141,130,49,238,182,190,150,107,
+106,113,127,167,42,254,228,254,134,45,147,1,133,1,46,121,1,6,63,254,188,253,
+56,161,3,237,111,105,166,1,5,2,115,0,0,2,0,135,255,223,4,109,6,114,0,39,0,
+49,0,0,37,54,55,38,38,53,52,19,23,6,2,21,20,22,23,54,55,6,7,39,54,55,18,55,
+23,6,3,22,22,21,20,2,7,39,54,19,6,7,6,7,1,52,38,39,6,7,54,54,55,54,1,55,59,
+46,146,135,225,162,97,114,79,86,81,67,63,61,37,126,91,123,26,100,30,84,160,
+158,167,96,161,80,90,158,136,76,47,1,238,88,100,57,71,68,121,97,30,171,134,
+119,16,144,139,247,2,15,43,225,254,124,110,70,72,7,213,191,9,23,144,41,10,
+1,110,135,33,168,254,217,5,147,150,135,253,235,217,43,181,1,32,48,9,217,106,
+2,233,74,75,2,197,214,6,28,31,126,0,1,0,180,255,223,5,97,5,186,0,37,0,0,1,
+6,7,2,3,39,54,18,55,4,7,39,36,37,54,53,52,38,35,34,6,21,20,23,7,38,53,52,
+54,54,51,50,22,21,20,7,54,55,5,97,142,218,69,194,164,78,125,35,254,112,141,
+27,1,12,1,79,18,141,138,112,138,101,129,144,106,192,124,222,233,13,178,127,
+2,250,40,52,254,210,254,111,45,156,1,70,131,90,21,169,36,61,113,78,169,175,
+116,95,112,107,107,144,176,104,169,95,242,245,74,91,33,29,0,1,0,80,255,225,
+3,76,5,219,0,32,0,0,1,22,22,21,20,2,7,6,6,21,20,22,51,50,55,23,6,35,34,38,
+53,52,54,54,55,62,2,53,52,38,38,39,2,174,78,80,177,228,98,89,69,64,74,92,
+36,113,99,144,151,54,92,150,130,107,59,21,42,58,5,219,105,224,128,163,254,
+234,168,72,102,45,47,52,26,146,26,117,114,61,105,97,116,101,122,135,78,80,
+123,111,101,0,0,1,0,180,255,223,6,67,5,186,0,29,0,0,1,33,2,3,39,54,18,18,
+53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,20,7,33,6,38,253,206,
+73,185,164,77,146,68,141,138,112,138,101,129,144,106,192,124,222,233,15,2,
+49,2,135,254,213,254,131,45,147,1,133,1,46,121,169,175,116,95,112,107,107,
+144,176,104,169,95,242,245,88,93,0,1,0,201,255,223,5,53,5,215,0,38,0,0,1,
+33,6,2,7,39,54,18,53,52,38,38,39,46,3,53,52,54,54,51,50,22,23,7,38,35,34,
+6,21,20,22,22,23,22,22,23,33,5,24,253,211,11,118,88,145,81,112,27,53,70,41,
+81,65,40,90,159,103,82,158,41,37,84,158,86,92,32,61,71,101,85,14,2,80,2,135,
+135,254,139,172,47,185,1,121,100,44,63,45,30,18,41,69,108,84,87,147,83,16,
+13,149,22,82,79,45,62,45,27,40,92,69,0,0,1,0,203,255,225,5,123,5,184,0,46,
+0,0,1,33,7,6,6,21,20,22,51,50,55,23,6,6,35,32,17,52,54,55,62,2,53,52,38,35,
+34,6,21,20,23,7,38,53,52,54,54,51,50,22,22,21,20,6,7,33,5,94,253,165,38,178,
+127,67,66,130,163,51,69,195,90,254,217,175,210,121,100,41,148,130,112,138,
+100,129,143,106,192,124,146,202,106,67,72,1,207,2,135,29,133,170,75,66,59,
+73,145,32,42,1,17,95,228,164,93,103,96,66,105,121,116,95,113,106,107,143,
+177,104,170,94,87,158,105,88,151,77,0,1,0,150,255,225,5,27,6,64,0,29,0,0,
+5,54,18,19,6,7,39,54,55,54,18,55,23,6,3,54,55,54,55,23,6,7,4,23,7,38,37,2,
+2,7,1,94,20,131,85,231,169,36,43,27,44,85,16,109,16,77,110,140,77,54,166,
+46,71,1,92,148,60,163,254,194,84,134,24,16,151,2,25,1,24,5,60,141,17,7,132,
+1,63,97,16,134,254,148,17,1,252,127,45,108,230,18,58,152,64,16,254,229,253,
+228,160,0,0,1,0,68,255,225,4,43,6,15,0,28,0,0,1,20,7,39,54,53,52,38,39,2,
+2,7,39,18,0,55,23,6,7,22,23,54,18,55,23,6,7,7,22,4,43,147,129,100,199,209,
+88,134,19,174,40,1,21,94,166,47,72,90,82,37,78,13,109,17,52,32,233,2,98,192,
+148,107,106,113,140,175,37,254,217,253,223,139,15,1,16,3,226,233,45,112,232,
+13,25,112,1,46,81,16,141,242,153,127,0,1,0,135,255,225,4,223,6,15,0,32,0,
+0,23,18,19,6,7,39,54,55,18,55,23,6,7,22,23,54,18,55,23,6,3,22,17,20,7,39,
+54,53,16,37,6,2,7,240,44,189,167,134,37,141,244,80,51,166,49,70,84,90,36,
+75,16,109,16,84,239,147,129,100,254,96,74,143,24,16,1,68,2,126,13,46,141,
+59,15,1,4,121,45,118,224,11,26,109,1,28,99,16,131,254,113,128,254,245,192,
+148,107,106,113,1,29,67,245,253,194,160,0,1,0,150,255,225,4,8,6,67,0,24,0,
+0,5,54,18,55,6,6,7,39,55,54,18,55,23,6,7,7,54,55,54,55,23,6,2,2,7,1,199,23,
+137,75,171,239,94,36,46,45,87,17,109,18,47,30,155,221,73,58,166,52,181,144,
+26,16,171,2,36,249,5,29,31,141,17,131,1,67,104,16,142,222,145,20,4,239,142,
+45,125,253,186,253,187,181,0,1,0,90,255,223,5,133,7,58,0,30,0,0,37,54,18,
+18,53,52,38,35,34,7,2,2,7,39,54,0,55,54,37,18,55,23,6,7,22,22,21,20,2,2,7,
+3,190,71,139,69,117,100,211,203,61,222,71,162,72,1,1,32,182,1,21,77,21,109,
+17,50,177,186,72,147,74,10,156,1,178,1,100,131,93,120,45,254,201,252,216,
+163,43,169,3,211,201,62,26,1,7,134,16,136,238,3,188,173,133,254,141,254,54,
+167,0,1,0,170,255,240,5,225,5,215,0,28,0,0,1,38,35,34,2,17,20,18,22,51,50,
+54,54,55,23,14,2,35,34,36,2,53,52,18,36,51,50,23,4,123,135,182,243,244,119,
+210,129,133,188,139,92,152,90,189,249,174,189,254,225,157,165,1,43,193,215,
+166,4,255,62,254,208,254,228,186,254,235,152,84,160,203,55,212,227,107,186,
+1,96,240,225,1,75,177,74,0,0,1,0,217,2,72,5,109,5,217,0,32,0,0,1,20,22,23,
+54,18,55,23,6,3,51,50,54,53,52,39,55,22,21,20,6,4,35,34,36,38,53,52,54,55,
+23,6,6,1,137,144,137,40,81,13,109,18,79,14,181,202,101,129,144,152,254,241,
+159,174,254,242,146,82,61,146,49,64,4,68,130,177,33,122,1,53,84,16,146,254,
+142,163,142,113,107,106,144,175,137,210,116,119,222,152,89,246,85,65,78,191,
+0,1,0,68,255,225,4,43,5,203,0,26,0,0,1,20,7,39,54,53,52,39,2,3,39,18,55,38,
+39,2,2,7,39,18,0,55,23,6,7,4,4,4,43,147,129,100,133,46,74,150,108,57,72,98,
+88,134,19,174,40,1,21,94,166,47,72,1,13,1,16,2,98,192,148,107,106,113,159,
+93,254,241,254,199,17,1,113,252,28,18,254,217,253,223,139,15,1,16,3,226,233,
+45,112,232,40,248,0,1,0,135,255,225,4,223,5,203,0,32,0,0,23,18,19,6,7,39,
+54,55,18,55,23,6,7,4,4,21,20,7,39,54,53,52,39,2,3,39,18,19,38,39,6,2,7,240,
+44,189,167,134,37,141,244,80,51,166,49,70,1,12,1,25,147,129,100,132,50,71,
+150,107,58,77,101,74,143,24,16,1,68,2,126,13,46,141,59,15,1,4,121,45,118,
+224,35,246,205,192,148,107,106,113,161,92,254,227,254,212,17,1,109,1,1,29,
+16,245,253,194,160,0,0,1,255,207,255,221,4,174,5,195,0,21,0,0,1,22,18,18,
+23,7,38,2,3,2,3,39,18,19,6,0,7,39,54,0,18,55,3,27,14,123,181,85,162,87,165,
+63,60,65,150,93,83,107,254,202,109,145,99,1,61,236,26,5,195,200,253,226,253,
+237,163,74,167,1,215,1,13,254,182,254,234,17,1,55,1,137,244,253,166,174,68,
+155,2,96,2,26,128,0,0,1,0,90,255,223,5,133,5,180,0,32,0,0,37,54,18,18,53,
+52,38,35,2,3,39,54,18,55,6,7,2,2,7,39,54,0,55,54,36,51,50,22,21,20,2,2,7,
+3,190,71,139,69,117,100,48,115,160,43,129,27,168,122,61,222,71,162,72,1,1,
+32,111,1,95,129,178,193,72,147,74,10,156,1,178,1,100,131,93,120,254,180,254,
+8,17,141,2,22,140,12,29,254,201,252,216,163,43,169,3,211,201,39,56,186,178,
+133,254,141,254,54,167,0,0,3,255,248,253,182,4,111,6,114,0,32,0,71,0,78,0,
+0,1,20,7,39,54,53,52,39,6,6,7,39,54,18,53,52,35,34,6,21,20,23,7,38,53,52,
+54,51,32,17,20,7,4,39,54,54,53,52,38,35,34,6,7,6,7,39,18,19,38,35,34,7,39,
+54,51,50,23,54,55,23,7,22,21,20,6,7,50,22,21,20,2,7,19,52,39,6,7,54,54,3,
+118,111,108,73,187,24,97,48,136,94,102,165,67,79,72,107,106,160,127,1,53,
+9,1,51,253,178,147,115,118,45,124,39,64,35,152,171,127,36,43,80,73,23,105,
+84,58,53,36,8,100,34,211,61,54,155,165,207,206,32,76,44,65,98,87,254,166,
+129,111,91,75,65,145,52,92,242,92,35,194,1,71,111,206,67,54,64,78,89,108,
+119,110,144,254,182,61,58,67,239,159,235,112,76,57,20,14,199,100,45,1,185,
+1,142,4,12,145,15,6,128,45,33,160,61,220,72,131,51,137,130,129,254,184,185,
+4,134,87,41,169,215,34,120,0,1,0,180,255,229,4,146,5,221,0,34,0,0,1,22,22,
+21,20,6,7,22,21,20,2,7,39,54,18,53,39,38,38,53,52,54,55,23,6,6,21,20,33,50,
+54,53,52,38,39,4,62,37,47,204,198,8,113,82,145,71,93,4,192,224,75,53,130,
+34,47,1,64,157,164,29,28,5,221,38,144,63,199,228,22,91,58,204,254,126,95,
+71,79,1,110,177,138,16,210,162,79,173,51,95,30,110,54,254,150,147,40,107,
+43,0,0,1,0,120,255,245,5,157,5,200,0,40,0,0,1,38,38,35,34,6,21,20,23,22,21,
+20,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,53,52,38,39,38,38,53,52,54,
+54,51,50,22,23,5,26,42,124,71,109,126,23,23,202,163,184,211,98,121,43,117,
+103,83,109,8,17,17,8,104,183,124,120,207,41,4,154,76,75,154,138,138,227,227,
+144,143,169,181,159,143,125,85,64,92,99,117,93,74,81,142,153,158,152,71,125,
+195,96,126,96,0,0,1,0,203,255,221,5,203,5,216,0,44,0,0,1,6,21,20,23,22,21,
+20,6,35,34,39,6,2,7,39,54,18,18,53,52,38,35,34,7,39,54,36,51,50,22,21,20,
+7,22,51,50,54,53,52,39,38,53,52,55,5,203,40,15,15,209,177,76,63,70,178,75,
+142,115,209,102,117,100,223,229,37,118,1,18,120,178,192,83,38,51,103,103,
+10,10,72,5,131,69,95,55,93,94,54,185,216,9,167,254,190,105,88,154,1,153,1,
+86,129,93,120,77,141,44,52,187,177,160,236,5,123,129,49,99,98,58,129,116,
+0,0,1,0,203,255,221,5,145,5,180,0,32,0,0,1,52,38,35,34,7,39,54,36,51,50,22,
+21,20,7,22,23,7,38,35,6,2,7,39,54,18,55,6,7,55,54,37,54,3,141,117,100,223,
+229,37,118,1,18,120,178,192,41,198,183,32,202,195,58,200,113,142,95,186,58,
+239,204,32,180,1,24,38,4,63,93,120,77,141,44,52,187,177,116,146,2,12,148,
+11,163,254,119,162,88,126,1,88,158,5,13,155,10,6,139,0,0,1,255,246,255,82,
+7,2,6,251,0,71,0,0,1,22,51,50,54,53,52,38,39,55,22,22,23,54,18,53,52,39,55,
+22,22,21,23,51,50,54,53,52,38,39,46,2,39,55,22,22,23,30,2,21,20,6,6,35,34,
+39,6,2,7,6,7,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,7,34,39,1,231,20,
+36,84,96,71,61,51,85,121,21,104,127,17,136,18,27,38,39,124,153,122,171,133,
+163,85,22,141,19,135,127,193,171,86,120,214,123,56,46,42,225,144,31,48,2,
+196,175,179,203,14,148,6,120,106,190,19,62,46,46,1,28,4,67,61,51,70,5,140,
+14,97,70,112,1,55,156,95,54,33,24,118,69,2,134,110,85,88,21,15,58,92,91,52,
+73,73,16,24,75,133,104,114,179,100,4,198,254,155,95,39,29,170,186,171,141,
+55,59,24,36,27,100,108,175,3,11,0,2,0,180,255,216,4,223,5,217,0,48,0,58,0,
+0,37,54,53,52,39,6,6,35,34,38,53,52,54,54,51,50,23,54,53,52,38,35,34,6,35,
+34,38,53,52,54,55,23,6,6,21,20,51,50,54,51,50,22,21,20,7,22,21,20,7,1,50,
+19,38,35,34,6,21,20,22,3,195,108,18,94,228,150,137,175,121,216,129,124,99,
+7,94,95,71,140,78,146,161,145,107,51,61,70,160,71,140,78,175,165,22,128,174,
+254,32,186,141,76,109,136,158,84,73,140,133,49,44,191,166,156,124,107,178,
+98,31,46,57,84,68,17,141,128,103,155,18,141,16,74,49,105,16,144,167,93,98,
+111,172,199,184,1,17,1,74,31,117,105,63,76,0,1,0,203,255,246,5,47,5,195,0,
+40,0,0,5,34,38,53,52,54,55,54,53,52,38,35,34,38,38,53,52,54,55,23,6,21,20,
+22,22,51,50,22,21,20,7,6,6,21,20,51,50,55,23,6,6,3,232,154,172,50,50,100,
+98,119,215,172,67,22,15,163,38,46,121,148,190,181,100,52,48,145,126,44,161,
+38,168,10,137,125,57,147,103,205,131,62,49,34,85,96,63,144,47,27,132,63,44,
+31,13,122,140,155,190,99,138,58,113,127,63,105,119,0,0,1,0,150,255,225,5,
+171,5,203,0,26,0,0,5,54,18,55,6,6,7,39,54,37,54,55,23,6,7,4,4,21,20,7,39,
+54,53,16,37,2,3,1,199,23,137,75,171,239,94,36,159,1,170,73,58,166,44,77,1,
+12,1,16,147,129,100,254,104,183,55,16,171,2,36,249,5,29,31,141,67,7,239,142,
+45,103,242,40,246,197,192,148,107,106,113,1,22,73,253,159,254,143,0,1,255,
+216,255,225,4,129,5,203,0,36,0,0,5,38,39,6,7,39,54,19,38,35,34,7,39,54,51,
+50,23,18,19,23,6,7,4,4,21,20,7,39,54,53,52,38,39,6,7,22,19,2,104,85,130,49,
+24,174,24,70,86,99,44,41,18,45,63,114,110,163,110,166,47,72,1,13,1,16,147,
+129,100,199,209,65,55,203,126,22,221,130,205,155,15,169,1,28,41,7,172,8,43,
+2,96,1,11,45,112,232,40,248,196,192,148,107,106,113,140,175,37,216,214,158,
+254,210,0,1,0,180,255,223,5,236,5,186,0,53,0,0,5,38,39,6,7,39,54,55,38,35,
+34,7,39,54,51,50,23,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,
+21,20,7,22,22,21,20,7,39,54,53,52,38,39,6,7,22,23,4,12,63,89,55,75,164,93,
+70,123,147,44,41,18,45,63,172,150,71,141,138,112,138,101,129,144,106,192,
+124,222,233,19,238,240,148,129,100,161,170,22,34,148,98,22,163,116,135,155,
+45,183,192,91,7,172,8,93,235,178,169,175,116,95,112,107,107,144,176,104,169,
+95,242,245,100,101,46,239,186,190,150,107,106,113,127,167,42,89,97,152,233,
+0,0,1,0,180,255,246,6,132,5,217,0,48,0,0,1,0,33,34,38,53,52,54,55,54,54,53,
+52,38,35,34,6,35,34,38,53,52,54,55,23,6,6,21,20,51,50,54,51,50,22,21,20,6,
+7,7,6,21,20,22,51,50,0,18,19,6,132,254,234,253,38,153,168,129,169,166,162,
+94,95,71,140,78,146,161,145,107,51,61,70,160,71,140,78,175,165,161,179,44,
+242,70,75,191,1,79,254,60,5,182,250,64,100,114,87,127,70,67,156,106,84,68,
+17,141,128,103,155,18,141,16,74,49,105,16,144,167,134,201,87,19,100,66,37,
+32,1,68,2,109,1,148,0,1,0,120,253,177,5,222,5,186,0,63,0,0,1,20,22,51,50,
+54,55,18,17,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,20,7,22,22,
+21,20,7,39,54,53,52,38,39,6,7,22,21,16,5,39,36,36,53,52,35,34,6,35,34,38,
+53,52,54,55,23,6,6,1,25,65,77,63,126,67,188,141,138,112,138,101,129,144,106,
+192,124,222,233,19,238,240,148,129,100,161,170,55,86,180,253,30,36,1,58,1,
+37,190,66,137,73,131,149,140,94,48,55,66,1,42,46,31,14,2,1,192,1,30,169,175,
+116,95,112,107,107,144,176,104,169,95,242,245,100,101,46,239,186,190,150,
+107,106,113,127,167,42,208,205,58,199,254,103,141,138,57,198,154,132,17,113,
+111,88,138,12,115,13,65,0,0,2,0,180,255,229,4,146,7,44,0,34,0,65,0,0,1,22,
+22,21,20,6,7,22,21,20,2,7,39,54,18,53,39,38,38,53,52,54,55,23,6,6,21,20,33,
+50,54,53,52,38,39,1,54,54,53,52,38,39,38,38,53,52,54,51,50,22,23,7,38,38,
+35,34,6,21,20,22,23,22,22,21,20,7,4,62,37,47,204,198,8,113,82,145,71,93,4,
+192,224,75,53,130,34,47,1,64,157,164,29,28,254,237,43,58,36,31,117,138,161,
+160,49,141,57,49,41,115,47,74,97,75,75,85,88,92,5,221,38,144,63,199,228,22,
+91,58,204,254,126,95,71,79,1,110,177,138,16,210,162,79,173,51,95,30,110,54,
+254,150,147,40,107,43,254,107,57,118,28,22,17,3,12,140,104,147,154,33,28,
+122,23,30,75,64,75,76,10,11,73,83,98,127,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,
+94,0,0,0,3,0,1,4,9,0,1,0,40,0,94,0,3,0,1,4,9,0,2,0,14,0,134,0,3,0,1,4,9,0,
+3,0,78,0,148,0,3,0,1,4,9,0,4,0,40,0,94,0,3,0,1,4,9,0,5,0,30,0,226,0,3,0,1,
+4,9,0,6,0,36,1,0,0,3,0,1,4,9,0,7,0,68,1,36,0,3,0,1,4,9,0,8,0,42,1,104,0,3,
+0,1,4,9,0,9,0,40,1,146,0,3,0,1,4,9,0,10,0,96,1,186,0,3,0,1,4,9,0,11,0,62,
+2,26,0,3,0,1,4,9,0,12,0,60,2,88,0,3,0,1,4,9,0,13,2,150,2,148,0,3,0,1,4,9,
+0,14,0,52,5,42,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,
+0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,75,0,104,0,97,0,114,0,111,0,115,0,104,
+0,116,0,104,0,105,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,75,
+0,104,0,97,0,114,0,111,0,115,0,104,0,116,0,104,0,105,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,
+116,0,111,0,83,0,97,0,110,0,115,0,75,0,104,0,97,0,114,0,111,0,115,0,104,0,
+116,0,104,0,105,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,
+116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,
+97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,
+32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,
+0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,
+0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,
+0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,
+0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,
+110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,
+101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,
+0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,
+111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,
+0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,
+0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,
+73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,
+0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,
+0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,
+0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,
+120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,
+0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,
+0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,
+0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,
+0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,46,0,0,0,2,0,5,0,0,0,
+4,0,1,0,5,0,13,0,3,0,14,0,47,0,1,0,48,0,51,0,3,0,52,0,132,0,1,0,4,0,0,0,1,
+0,0,0,0,0,1,0,0,0,10,0,34,0,78,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,
+3,0,0,0,1,0,2,0,3,100,105,115,116,0,20,109,97,114,107,0,28,109,107,109,107,
+0,38,0,0,0,2,0,4,0,5,0,0,0,3,0,0,0,1,0,2,0,0,0,1,0,3,0,8,0,18,2,144,3,242,
+7,228,8,26,8,58,8,90,8,128,0,4,0,0,0,1,0,8,0,1,0,12,3,246,0,2,0,26,0,54,0,
+1,0,5,0,6,0,7,0,11,0,12,0,50,0,5,0,0,2,44,0,1,0,22,0,0,2,44,0,0,2,44,0,0,
+7,164,0,1,2,38,0,0,0,49,2,16,0,198,2,16,1,248,2,16,0,198,5,36,2,58,5,36,0,
+204,0,210,1,248,5,114,0,216,0,222,1,122,0,228,0,234,0,240,0,246,0,252,1,2,
+1,8,1,14,5,246,1,20,5,246,1,26,6,146,1,248,1,32,1,38,5,114,1,44,1,86,1,248,
+6,176,1,56,1,50,1,56,1,62,1,248,2,16,1,68,6,146,1,248,6,188,1,74,1,104,1,
+80,7,136,1,248,1,86,1,92,7,136,1,98,1,104,1,110,1,116,1,122,1,128,1,134,2,
+16,1,248,1,140,1,146,2,16,1,152,1,158,1,164,1,170,1,176,1,254,1,182,1,188,
+1,194,1,206,1,200,1,206,1,212,1,218,1,224,1,230,1,236,1,242,1,248,1,254,2,
+58,2,4,2,10,2,16,2,22,2,28,2,34,2,40,2,46,2,52,2,58,0,1,3,77,1,144,0,1,2,
+28,1,144,0,1,2,197,0,0,0,1,2,171,1,144,0,1,1,154,0,0,0,1,0,240,0,0,0,1,1,
+89,1,144,0,1,2,54,0,0,0,1,2,184,2,226,0,1,3,52,0,0,0,1,3,71,1,144,0,1,2,249,
+0,0,0,1,2,197,1,144,0,1,1,193,1,144,0,1,1,37,1,144,0,1,2,41,0,0,0,1,2,15,
+1,144,0,1,2,249,1,144,0,1,0,254,0,0,0,1,2,106,1,144,0,1,1,167,0,0,0,1,3,97,
+1,144,0,1,3,32,0,120,0,1,2,80,1,144,0,1,2,132,0,0,0,1,2,119,1,144,0,1,3,19,
+1,144,0,1,4,101,0,0,0,1,2,236,1,144,0,1,1,219,0,0,0,1,2,93,1,144,0,1,0,163,
+0,0,0,1,1,102,1,144,0,1,2,88,0,0,0,1,2,119,254,67,0,1,3,58,1,144,0,1,3,149,
+0,0,0,1,3,45,0,75,0,1,1,144,253,168,0,1,1,30,254,5,0,1,2,128,1,144,0,1,2,
+164,0,0,0,1,3,22,1,144,0,1,2,188,1,144,0,1,2,138,0,0,0,1,2,228,1,144,0,1,
+1,164,255,96,0,1,0,0,0,0,0,1,4,86,0,0,0,1,4,68,0,0,0,1,4,42,0,0,0,1,3,32,
+1,144,0,1,2,128,0,0,0,1,1,104,0,0,0,1,1,43,1,144,0,1,3,32,0,0,0,1,2,168,1,
+144,0,1,3,112,0,0,0,1,4,216,1,144,0,1,1,184,253,228,0,1,2,255,0,0,0,1,2,118,
+0,0,0,1,2,88,1,144,0,4,0,0,0,1,0,8,0,1,0,12,1,120,0,1,0,22,0,42,0,1,0,3,0,
+8,0,13,0,48,0,3,0,0,5,92,0,0,0,120,0,0,0,14,0,1,2,128,4,216,0,49,1,36,1,36,
+0,100,0,106,0,112,0,118,0,124,0,178,0,130,1,36,0,136,0,250,0,178,0,142,0,
+178,0,172,0,148,0,154,1,36,1,36,0,160,0,166,0,244,0,172,0,178,0,250,0,184,
+0,190,0,196,0,202,0,250,0,208,0,214,0,220,0,226,0,232,5,72,0,238,0,244,0,
+250,1,0,1,6,1,12,1,18,1,24,1,36,1,30,1,36,1,42,0,1,2,128,5,80,0,1,4,31,5,
+20,0,1,4,26,5,20,0,1,2,140,5,80,0,1,3,118,5,80,0,1,3,79,5,80,0,1,2,166,5,
+80,0,1,1,110,5,80,0,1,2,10,5,80,0,1,1,162,5,80,0,1,2,205,5,80,0,1,3,157,5,
+20,0,1,3,66,5,80,0,1,2,231,5,80,0,1,2,49,5,80,0,1,2,153,5,80,0,1,3,235,5,
+80,0,1,3,40,5,80,0,1,3,14,5,80,0,1,2,192,5,80,0,1,2,101,5,80,0,1,3,53,5,80,
+0,1,2,168,5,120,0,1,3,248,5,80,0,1,2,244,5,80,0,1,2,179,5,80,0,1,5,220,5,
+220,0,1,1,149,5,80,0,1,1,71,5,80,0,1,3,192,5,80,0,1,2,148,5,80,0,1,3,170,
+5,80,0,1,2,88,5,80,0,1,3,12,6,214,0,4,0,0,0,1,0,8,0,1,0,12,0,22,0,3,0,44,
+0,70,0,1,0,3,0,9,0,10,0,49,0,2,0,3,0,4,0,4,0,0,0,14,0,47,0,1,0,119,0,132,
+0,35,0,3,0,0,0,14,0,1,1,246,0,2,0,20,0,1,2,168,2,188,0,1,2,48,0,0,0,49,2,
+198,1,220,3,152,2,198,1,220,3,152,1,40,1,46,3,152,1,64,1,52,1,58,1,64,2,192,
+1,70,2,198,1,220,1,76,1,82,1,130,2,102,1,88,1,94,1,100,1,106,1,112,1,118,
+1,124,1,130,2,150,2,198,1,220,1,136,1,142,1,148,3,152,1,154,2,162,2,42,1,
+160,1,244,1,166,1,172,2,66,1,232,1,178,1,184,1,190,1,196,1,202,1,208,1,214,
+1,220,1,226,2,138,2,144,1,232,1,238,1,244,1,250,2,0,2,6,2,12,2,18,2,66,2,
+24,2,30,2,36,2,42,2,48,2,54,3,152,2,60,2,66,2,72,2,78,2,84,2,114,2,90,2,96,
+2,102,2,198,2,108,2,114,2,120,2,126,2,132,2,138,2,144,2,150,2,156,2,162,2,
+168,2,174,2,180,3,152,2,186,2,192,3,152,2,198,2,204,2,210,2,216,2,222,2,228,
+2,234,2,240,3,110,2,246,3,152,3,8,2,252,3,38,3,110,3,2,3,38,3,8,3,14,3,20,
+3,26,3,32,3,38,3,44,3,50,3,56,3,62,3,128,3,68,3,74,3,80,3,152,3,158,3,86,
+3,92,3,110,3,98,3,104,3,110,3,146,3,116,3,122,3,128,3,134,3,140,3,146,3,152,
+3,158,0,1,3,32,1,84,0,1,3,19,0,0,0,1,2,106,0,0,0,1,2,6,0,0,0,1,2,93,2,188,
+0,1,2,32,0,0,0,1,2,110,0,0,0,1,2,106,1,84,0,1,1,180,2,71,0,1,2,184,0,0,0,
+1,1,54,0,0,0,1,1,167,3,10,0,1,1,141,0,0,0,1,0,128,0,0,0,1,2,171,2,188,0,1,
+2,145,0,0,0,1,2,218,0,0,0,1,3,6,2,188,0,1,3,45,0,0,0,1,1,245,2,188,0,1,1,
+24,2,188,0,1,1,106,0,0,0,1,3,149,3,192,0,1,2,80,2,188,0,1,2,67,0,0,0,1,1,
+210,0,0,0,1,2,15,3,23,0,1,3,58,0,0,0,1,2,97,0,0,0,1,3,32,2,188,0,1,3,162,
+0,0,0,1,2,71,0,0,0,1,1,249,0,0,0,1,1,50,2,188,0,1,1,76,0,0,0,1,0,167,0,0,
+0,1,1,232,2,188,0,1,1,193,0,0,0,1,1,67,0,0,0,1,3,188,2,188,0,1,3,36,0,0,0,
+1,2,28,2,188,0,1,2,2,0,0,0,1,1,132,0,0,0,1,2,249,2,148,0,1,3,162,0,120,0,
+1,1,76,2,188,0,1,3,214,0,0,0,1,4,53,0,0,0,1,3,123,3,75,0,1,3,123,0,0,0,1,
+2,184,2,188,0,1,2,210,0,0,0,1,2,58,0,0,0,1,3,71,0,0,0,1,2,136,0,0,0,1,4,205,
+2,188,0,1,4,192,0,0,0,1,4,79,0,0,0,1,2,106,2,188,0,1,2,158,0,0,0,1,1,158,
+0,0,0,1,1,102,2,188,0,1,1,232,0,0,0,1,0,206,0,0,0,1,3,58,2,188,0,1,3,97,0,
+0,0,1,2,15,2,19,0,1,2,80,0,0,0,1,3,97,2,188,0,1,3,110,0,0,0,1,2,227,0,0,0,
+1,3,123,1,204,0,1,3,253,0,0,0,1,3,101,0,0,0,1,1,69,2,188,0,1,3,205,0,0,0,
+1,2,177,2,188,0,1,2,190,2,188,0,1,3,25,2,188,0,1,2,73,0,0,0,1,2,164,2,188,
+0,1,3,49,0,0,0,1,2,99,0,0,0,1,2,190,3,140,0,1,3,23,0,0,0,1,2,125,0,0,0,1,
+2,73,2,188,0,1,3,244,0,0,0,1,4,81,0,0,0,1,3,75,0,0,0,1,3,77,0,0,0,1,2,138,
+2,188,0,1,1,160,2,188,0,1,1,223,0,0,0,1,2,86,2,188,0,1,3,179,0,0,0,1,2,203,
+0,0,0,1,4,183,0,0,0,1,3,51,0,0,0,1,3,116,2,188,0,1,3,140,0,0,0,1,3,129,0,
+0,0,1,2,151,2,188,0,1,2,188,0,0,0,1,2,47,0,0,0,6,0,0,0,1,0,8,0,1,0,12,0,18,
+0,1,0,24,0,36,0,1,0,1,0,8,0,1,0,1,0,48,0,1,0,0,0,6,0,1,2,168,5,80,0,1,0,4,
+0,1,2,151,6,154,0,8,0,0,0,1,0,8,0,3,0,0,0,1,0,74,0,1,0,18,0,1,0,0,0,6,0,1,
+0,1,0,6,0,8,0,0,0,1,0,8,0,3,0,0,0,1,0,80,0,1,0,18,0,1,0,0,0,7,0,1,0,1,0,9,
+0,1,0,0,0,1,0,8,0,1,0,10,0,5,0,180,0,180,0,1,0,8,0,20,0,21,0,25,0,26,0,27,
+0,32,0,33,0,43,0,1,0,0,0,1,0,8,0,1,0,10,0,5,0,240,0,240,0,1,0,1,0,26,0,0,
+0,1,0,0,0,10,0,30,0,52,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,
+1,99,99,109,112,0,8,0,0,0,5,0,0,0,1,0,2,0,3,0,4,0,5,0,12,0,236,2,174,2,206,
+3,108,0,4,0,0,0,1,0,8,0,1,0,192,0,10,0,26,0,58,0,74,0,96,0,110,0,122,0,134,
+0,146,0,158,0,170,0,3,0,8,0,16,0,24,0,120,0,3,0,51,0,42,0,129,0,3,0,51,0,
+39,0,131,0,3,0,51,0,27,0,1,0,4,0,132,0,5,0,51,0,14,0,51,0,42,0,2,0,6,0,14,
+0,126,0,3,0,51,0,38,0,130,0,3,0,51,0,40,0,1,0,4,0,119,0,4,0,5,0,14,0,51,0,
+1,0,4,0,128,0,3,0,51,0,39,0,1,0,4,0,121,0,3,0,51,0,38,0,1,0,4,0,125,0,3,0,
+51,0,27,0,1,0,4,0,127,0,3,0,51,0,32,0,1,0,4,0,122,0,3,0,51,0,45,0,2,0,6,0,
+14,0,123,0,3,0,51,0,27,0,124,0,3,0,51,0,37,0,1,0,10,0,14,0,15,0,27,0,30,0,
+32,0,36,0,38,0,39,0,40,0,43,0,4,0,0,0,1,0,8,0,1,1,170,0,35,0,76,0,86,0,96,
+0,106,0,116,0,126,0,136,0,146,0,156,0,166,0,176,0,186,0,196,0,206,0,216,0,
+226,0,236,0,246,1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,1,80,1,90,1,100,1,
+110,1,120,1,130,1,140,1,150,1,160,0,1,0,4,0,103,0,2,0,5,0,1,0,4,0,69,0,2,
+0,5,0,1,0,4,0,70,0,2,0,5,0,1,0,4,0,71,0,2,0,5,0,1,0,4,0,72,0,2,0,5,0,1,0,
+4,0,73,0,2,0,5,0,1,0,4,0,74,0,2,0,5,0,1,0,4,0,75,0,2,0,5,0,1,0,4,0,76,0,2,
+0,5,0,1,0,4,0,77,0,2,0,5,0,1,0,4,0,78,0,2,0,5,0,1,0,4,0,79,0,2,0,5,0,1,0,
+4,0,80,0,2,0,5,0,1,0,4,0,81,0,2,0,5,0,1,0,4,0,82,0,2,0,5,0,1,0,4,0,83,0,2,
+0,5,0,1,0,4,0,84,0,2,0,5,0,1,0,4,0,85,0,2,0,5,0,1,0,4,0,86,0,2,0,5,0,1,0,
+4,0,87,0,2,0,5,0,1,0,4,0,88,0,2,0,5,0,1,0,4,0,89,0,2,0,5,0,1,0,4,0,90,0,2,
+0,5,0,1,0,4,0,91,0,2,0,5,0,1,0,4,0,92,0,2,0,5,0,1,0,4,0,93,0,2,0,5,0,1,0,
+4,0,94,0,2,0,5,0,1,0,4,0,95,0,2,0,5,0,1,0,4,0,96,0,2,0,5,0,1,0,4,0,97,0,2,
+0,5,0,1,0,4,0,98,0,2,0,5,0,1,0,4,0,99,0,2,0,5,0,1,0,4,0,100,0,2,0,5,0,1,0,
+4,0,101,0,2,0,5,0,1,0,4,0,102,0,2,0,5,0,2,0,2,0,4,0,4,0,0,0,14,0,47,0,1,0,
+4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,104,0,2,0,6,0,1,0,1,0,36,0,4,0,0,
+0,1,0,8,0,1,0,126,0,10,0,26,0,36,0,46,0,56,0,66,0,76,0,86,0,96,0,106,0,116,
+0,1,0,4,0,105,0,2,0,8,0,1,0,4,0,108,0,2,0,8,0,1,0,4,0,113,0,2,0,8,0,1,0,4,
+0,106,0,2,0,8,0,1,0,4,0,109,0,2,0,8,0,1,0,4,0,110,0,2,0,8,0,1,0,4,0,114,0,
+2,0,8,0,1,0,4,0,111,0,2,0,8,0,1,0,4,0,112,0,2,0,8,0,1,0,4,0,107,0,2,0,8,0,
+1,0,10,0,4,0,28,0,29,0,31,0,32,0,33,0,36,0,39,0,41,0,45,0,4,0,0,0,1,0,8,0,
+1,0,54,0,4,0,14,0,24,0,34,0,44,0,1,0,4,0,115,0,2,0,9,0,1,0,4,0,116,0,2,0,
+9,0,1,0,4,0,117,0,2,0,9,0,1,0,4,0,118,0,2,0,9,0,1,0,4,0,32,0,33,0,37,0,41,
+0,0,};
+#endif
@@ -0,0 +1,1535 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansKhmer_Regular_ttf_size = 37144;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansKhmer_Regular_ttf");
+asm(".type fz_font_NotoSansKhmer_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansKhmer_Regular_ttf, 37144");
+asm(".balign 64");
+asm("fz_font_NotoSansKhmer_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansKhmer-Regular.ttf\"");
+#else
+const int fz_font_NotoSansKhmer_Regular_ttf_size = 37144;
+const char fz_font_NotoSansKhmer_Regular_ttf[] = {
+0,1,0,0,0,15,0,128,0,3,0,112,71,68,69,70,0,16,1,6,0,0,135,164,0,0,0,22,71,
+80,79,83,0,21,0,10,0,0,135,188,0,0,0,12,71,83,85,66,212,48,194,11,0,0,135,
+200,0,0,9,80,79,83,47,50,122,178,241,178,0,0,1,120,0,0,0,96,99,109,97,112,
+203,180,79,132,0,0,5,252,0,0,0,170,99,118,116,32,57,126,62,76,0,0,6,168,0,
+0,1,252,103,97,115,112,0,4,0,7,0,0,135,152,0,0,0,12,103,108,121,102,235,255,
+55,255,0,0,10,184,0,0,109,106,104,101,97,100,0,177,198,47,0,0,0,252,0,0,0,
+54,104,104,101,97,14,88,13,50,0,0,1,52,0,0,0,36,104,109,116,120,143,92,238,
+105,0,0,1,216,0,0,4,36,108,111,99,97,191,57,217,195,0,0,8,164,0,0,2,20,109,
+97,120,112,3,165,7,187,0,0,1,88,0,0,0,32,110,97,109,101,214,36,30,24,0,0,
+120,36,0,0,5,68,112,111,115,116,74,137,118,170,0,0,125,104,0,0,10,47,0,1,
+0,0,0,1,10,61,128,108,170,223,95,15,60,245,0,31,8,0,0,0,0,0,200,23,79,246,
+0,0,0,0,210,133,32,221,246,222,252,224,16,4,9,66,0,0,0,8,0,2,0,0,0,0,0,0,
+0,1,0,0,7,115,252,224,0,0,16,204,246,222,254,124,16,4,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,9,0,1,0,0,1,9,0,128,0,16,0,4,0,1,0,2,0,16,0,47,0,90,0,0,2,31,
+7,5,0,1,0,1,0,3,5,16,1,144,0,5,0,0,5,154,5,51,0,0,1,30,5,154,5,51,0,0,3,208,
+0,102,1,242,0,0,2,11,6,6,3,8,4,2,2,4,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,71,79,
+79,71,0,64,0,0,37,204,7,115,252,224,0,0,7,115,3,32,32,0,1,17,65,0,0,0,4,74,
+5,182,0,0,0,32,0,2,8,0,0,0,0,0,0,0,8,0,0,0,2,20,0,0,2,39,0,147,3,55,0,133,
+5,43,0,51,4,104,0,123,6,154,0,102,5,158,0,109,1,207,0,133,2,104,0,82,2,104,
+0,61,4,104,0,82,4,104,0,102,2,0,0,63,2,147,0,82,2,37,0,147,2,252,0,20,4,104,
+0,98,4,104,0,178,4,104,0,96,4,104,0,82,4,104,0,23,4,104,0,131,4,104,0,113,
+4,104,0,90,4,104,0,106,4,104,0,106,2,37,0,147,2,37,0,63,4,104,0,102,4,104,
+0,102,4,104,0,102,3,104,0,37,6,238,0,109,2,213,0,61,4,104,1,233,2,213,0,51,
+4,104,0,102,0,0,0,0,3,229,0,82,2,147,0,82,3,229,0,84,5,20,0,200,5,20,0,200,
+5,20,0,200,7,108,0,59,5,20,0,100,5,20,0,100,5,20,0,100,5,20,0,100,10,2,0,
+200,7,158,0,200,5,20,0,200,5,20,0,80,5,20,0,200,7,108,0,200,9,234,0,200,5,
+20,0,200,5,20,0,100,5,20,0,200,5,20,0,100,5,20,0,200,5,20,0,59,5,20,0,100,
+5,20,0,200,5,20,0,40,5,20,0,59,7,158,0,200,2,76,0,12,7,108,0,200,2,76,0,12,
+5,20,0,200,5,20,0,59,7,108,0,200,7,108,0,59,7,108,0,200,5,20,0,59,5,20,0,
+59,7,108,0,59,5,20,0,100,7,108,0,200,5,20,0,200,5,20,0,200,5,20,0,200,5,20,
+0,100,5,20,0,59,5,20,0,59,5,20,0,200,5,20,0,200,5,20,0,100,5,20,0,200,5,20,
+0,100,5,20,0,200,5,20,0,100,2,76,255,56,0,0,251,230,0,0,251,230,0,0,251,230,
+0,0,251,230,0,0,254,19,0,0,252,224,0,0,252,174,0,0,251,230,2,76,253,248,2,
+76,254,124,2,76,0,59,2,76,0,0,2,76,0,0,2,76,255,56,2,76,255,56,0,0,252,149,
+3,82,0,200,2,68,0,180,0,0,252,144,0,0,251,180,0,0,253,43,0,0,252,19,0,0,251,
+230,0,0,252,99,0,0,251,230,0,0,253,68,0,0,251,230,0,0,252,99,0,0,251,230,
+4,176,0,200,5,220,0,200,3,82,0,100,4,176,0,150,16,204,0,200,5,220,0,200,11,
+84,0,200,2,76,0,12,5,20,0,200,5,20,0,200,6,2,0,100,6,228,0,200,5,20,0,100,
+5,20,0,200,5,20,0,200,6,64,0,200,5,20,0,200,5,20,0,200,0,0,251,230,0,0,251,
+230,0,0,251,230,2,76,253,148,0,0,251,230,0,0,251,181,0,0,251,78,0,0,251,189,
+2,76,252,184,0,0,251,130,0,0,249,42,0,0,251,230,0,0,251,228,0,0,251,230,2,
+76,251,230,0,0,246,222,0,0,251,230,0,0,251,180,0,0,251,230,0,0,251,230,0,
+0,251,180,2,76,254,120,0,0,251,230,0,0,251,230,0,0,251,123,0,0,251,180,2,
+76,254,124,2,76,0,59,0,0,251,180,0,0,251,230,2,76,254,12,0,0,251,230,0,0,
+251,130,0,0,253,245,0,0,252,224,0,0,252,174,0,0,251,230,0,0,251,230,0,0,251,
+230,0,0,251,230,0,0,252,149,0,0,252,99,0,0,253,68,7,158,0,200,5,20,0,100,
+2,76,0,59,0,0,251,230,2,76,253,248,2,76,254,124,0,0,252,224,0,0,252,224,0,
+0,252,224,0,0,252,224,0,0,253,163,0,0,253,168,0,0,253,168,0,0,252,222,0,0,
+249,123,0,0,249,116,0,0,249,123,0,0,249,123,0,0,252,224,0,0,252,117,0,0,252,
+174,0,0,251,137,0,0,250,86,0,0,250,36,0,0,251,117,0,0,250,86,0,0,250,36,0,
+0,251,180,0,0,251,230,2,76,255,56,2,76,255,56,6,14,1,44,0,0,249,143,3,32,
+0,150,3,32,0,101,1,44,0,100,5,16,0,100,3,32,0,100,3,32,0,100,2,38,0,100,4,
+26,0,100,1,246,0,100,3,132,0,100,5,20,0,200,5,20,0,200,6,2,0,100,6,228,0,
+200,5,20,0,100,5,20,0,200,5,20,0,200,6,64,0,200,5,20,0,200,5,20,0,200,10,
+40,0,200,10,40,0,200,11,22,0,200,11,248,0,200,10,40,0,200,10,40,0,200,5,20,
+0,200,5,20,0,200,6,2,0,100,6,228,0,200,5,20,0,100,5,20,0,200,5,20,0,200,6,
+64,0,200,5,20,0,200,5,20,0,200,10,40,0,200,10,40,0,200,11,22,0,200,11,248,
+0,200,10,40,0,200,10,40,0,200,0,0,255,213,0,0,255,33,4,193,0,98,0,0,0,1,0,
+3,0,1,0,0,0,12,0,4,0,158,0,0,0,34,0,32,0,4,0,2,0,0,0,13,0,64,0,126,0,171,
+0,173,0,187,23,179,23,181,23,219,23,221,23,233,23,249,25,255,32,13,37,204,
+255,255,0,0,0,0,0,13,0,32,0,123,0,171,0,173,0,187,23,128,23,180,23,182,23,
+220,23,224,23,240,25,224,32,11,37,204,255,255,0,1,255,245,255,227,255,169,
+255,126,255,125,255,112,232,172,233,36,232,170,232,254,232,166,232,236,231,
+6,0,0,219,60,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,6,0,0,0,0,0,40,1,6,1,7,0,0,6,20,0,11,0,78,5,182,0,23,0,117,5,182,5,205,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,74,0,20,0,143,0,0,255,236,0,0,0,0,255,236,0,
+0,0,0,255,236,0,0,254,20,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,172,0,182,0,188,0,0,0,213,
+0,0,0,0,0,0,0,85,0,131,0,151,0,159,0,125,0,229,0,174,0,174,0,113,0,113,0,
+0,0,0,0,186,0,197,0,186,0,0,0,0,0,164,0,159,0,140,0,0,0,0,0,199,0,199,0,125,
+0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,176,0,185,0,138,0,0,0,0,0,155,0,166,0,143,
+0,119,0,0,0,0,0,0,0,0,0,0,0,150,0,0,0,0,0,0,0,0,0,0,0,105,0,110,0,144,0,180,
+0,193,0,213,0,0,0,0,0,0,0,0,0,102,0,111,0,120,0,150,0,192,0,213,1,71,0,0,
+0,0,0,0,0,254,1,58,0,197,0,120,0,254,1,22,1,246,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,238,0,0,0,150,0,136,0,174,0,150,0,137,1,12,0,150,1,24,
+0,0,3,29,0,148,2,90,0,130,3,150,0,0,0,168,0,140,0,0,0,0,2,121,0,217,0,180,
+1,10,0,0,1,131,0,109,0,127,0,160,0,0,0,0,0,109,0,136,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,147,0,160,0,0,0,130,0,137,0,0,0,0,0,0,0,0,0,0,5,182,252,148,
+0,17,255,239,0,131,0,143,0,0,0,0,0,109,0,123,0,0,0,0,0,0,0,0,0,0,0,188,1,
+170,3,84,0,0,0,0,0,188,0,182,1,215,1,149,0,0,0,150,1,0,0,174,5,182,254,188,
+254,111,254,131,0,111,2,173,0,0,0,0,0,0,0,0,0,0,0,40,0,62,0,122,0,217,1,57,
+1,177,1,192,1,226,2,4,2,40,2,64,2,89,2,102,2,134,2,150,2,213,2,244,3,43,3,
+123,3,167,3,231,4,63,4,82,4,188,5,18,5,75,5,126,5,147,5,167,5,188,6,16,6,
+162,6,220,6,233,7,37,7,90,7,90,7,126,7,134,7,171,7,205,8,20,8,66,8,138,8,
+203,9,5,9,79,9,129,9,222,10,70,10,110,10,162,10,244,11,85,11,148,11,194,12,
+2,12,72,12,129,12,203,13,2,13,65,13,123,13,171,13,232,14,64,14,103,14,169,
+14,215,15,23,15,89,15,175,15,242,16,92,16,153,16,214,17,35,17,112,17,219,
+18,32,18,108,18,184,19,27,19,101,19,185,20,2,20,86,20,134,20,227,21,69,21,
+144,21,255,22,22,22,55,22,90,22,164,22,202,22,217,22,240,23,8,23,43,23,103,
+23,143,23,176,23,227,24,30,24,53,24,91,24,141,24,234,25,29,25,49,25,67,25,
+81,25,122,25,151,25,172,25,209,25,237,25,250,26,14,26,64,26,96,26,135,26,
+235,27,26,27,156,27,216,28,33,28,74,28,112,28,156,28,201,28,242,29,26,29,
+96,29,142,29,198,29,243,30,46,30,81,30,123,30,163,30,216,30,242,31,76,31,
+136,31,210,32,16,32,45,32,100,32,141,32,172,32,211,33,9,33,58,33,99,33,130,
+33,165,33,210,34,10,34,50,34,76,34,102,34,139,34,162,34,208,34,254,35,31,
+35,68,35,124,35,158,35,185,35,200,35,224,35,247,36,24,36,59,36,133,36,171,
+36,221,36,242,37,14,37,91,37,141,37,185,37,239,38,41,38,79,38,112,38,147,
+38,221,39,2,39,52,39,72,39,99,39,152,39,193,39,224,40,7,40,41,40,82,40,119,
+40,142,40,157,40,180,40,204,40,219,40,243,41,10,41,34,41,66,41,89,41,112,
+41,222,41,255,42,27,42,47,42,60,42,90,42,109,42,146,42,160,42,185,42,200,
+42,233,43,54,43,124,43,195,44,6,44,71,44,165,44,236,45,62,45,132,45,217,46,
+62,46,169,47,22,47,127,47,230,48,107,48,187,49,1,49,71,49,138,49,203,50,39,
+50,110,50,192,51,4,51,86,51,187,52,38,52,144,52,249,53,94,53,227,53,240,54,
+14,54,181,0,2,0,147,255,227,1,145,5,182,0,3,0,23,0,0,1,35,3,51,3,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,1,80,121,51,223,240,20,34,46,27,26,47,34,
+20,20,34,47,26,27,46,34,20,1,158,4,24,250,185,38,53,33,15,15,33,53,38,37,
+53,34,16,16,34,53,0,0,2,0,133,3,166,2,178,5,182,0,3,0,7,0,0,1,3,35,3,33,3,
+35,3,1,74,41,115,41,2,45,41,114,41,5,182,253,240,2,16,253,240,2,16,0,2,0,
+51,0,0,4,248,5,182,0,27,0,31,0,0,1,3,33,21,33,3,35,19,33,3,35,19,33,53,33,
+19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,19,33,3,215,63,1,24,254,205,82,
+147,84,254,221,82,144,78,254,254,1,29,65,254,238,1,43,82,147,82,1,37,84,144,
+84,1,6,252,235,1,35,64,254,221,3,125,254,184,137,254,84,1,172,254,84,1,172,
+137,1,72,137,1,176,254,80,1,176,254,80,137,254,184,1,72,0,0,3,0,123,255,137,
+3,217,6,18,0,45,0,54,0,63,0,0,1,20,14,2,7,21,35,53,34,46,2,39,53,30,3,51,
+17,46,3,53,52,62,2,55,53,51,21,22,22,23,7,38,38,39,17,30,3,7,52,46,2,39,17,
+54,54,1,20,30,2,23,17,6,6,3,217,50,93,133,84,138,50,102,96,84,32,33,87,96,
+101,47,89,131,86,42,49,91,129,79,138,100,169,67,66,56,140,74,88,135,91,46,
+176,20,43,70,51,93,91,254,18,17,40,66,49,89,83,1,190,70,114,84,55,12,230,
+221,9,18,26,17,172,16,33,26,17,1,178,30,66,85,110,74,67,111,83,53,9,180,176,
+5,42,31,145,25,41,6,254,90,31,66,83,107,72,33,55,45,38,18,254,139,14,98,2,
+163,36,57,47,38,17,1,113,16,89,0,0,5,0,102,255,236,6,51,5,203,0,9,0,29,0,
+39,0,59,0,63,0,0,19,20,22,51,50,17,16,35,34,6,5,20,14,2,35,34,46,2,53,52,
+62,2,51,50,30,2,1,20,22,51,50,17,16,35,34,6,5,20,14,2,35,34,46,2,53,52,62,
+2,51,50,30,2,1,1,35,1,250,71,80,156,156,80,71,1,199,36,74,115,79,73,112,76,
+38,35,73,113,78,75,113,77,39,1,172,71,80,156,156,80,71,1,198,35,74,115,79,
+74,112,75,38,35,73,113,78,75,113,76,39,255,0,252,213,158,3,44,4,2,165,165,
+1,74,1,72,163,165,108,172,118,63,63,118,172,108,108,170,117,62,62,117,170,
+253,74,165,164,1,73,1,72,163,165,108,171,118,63,63,118,171,108,108,170,117,
+62,62,117,170,3,146,250,74,5,182,0,3,0,109,255,236,5,125,5,205,0,17,0,33,
+0,83,0,0,1,20,30,2,23,62,3,53,52,46,2,35,34,6,19,50,62,2,55,1,14,3,21,20,
+30,2,37,52,62,2,55,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,1,62,3,55,51,14,
+3,7,1,35,39,14,3,35,34,46,2,1,166,16,33,52,36,59,86,56,28,25,47,66,42,86,
+100,135,58,98,84,72,32,254,125,52,80,55,28,35,66,96,254,125,40,77,111,71,
+31,60,45,28,50,94,138,88,83,131,91,48,50,84,109,60,1,96,27,43,34,27,10,184,
+15,41,53,65,39,1,21,225,168,49,96,108,124,78,105,167,115,61,4,141,34,65,65,
+67,37,35,62,64,70,41,36,61,44,25,89,251,175,23,40,54,31,1,151,33,63,72,85,
+56,54,91,65,36,240,78,122,100,86,42,36,77,87,99,57,75,119,83,43,43,83,119,
+75,64,109,93,79,36,254,140,29,60,68,78,47,66,111,98,85,41,254,219,172,45,
+71,49,27,53,103,149,0,1,0,133,3,166,1,74,5,182,0,3,0,0,1,3,35,3,1,74,41,115,
+41,5,182,253,240,2,16,0,0,1,0,82,254,188,2,43,5,182,0,19,0,0,19,52,62,2,55,
+51,6,2,21,20,30,2,23,35,46,3,82,36,74,113,78,172,140,145,37,71,106,69,170,
+78,113,74,36,2,49,125,243,229,211,93,193,254,50,244,119,236,226,212,94,90,
+206,225,240,0,0,1,0,61,254,188,2,23,5,182,0,19,0,0,1,20,14,2,7,35,62,3,53,
+52,2,39,51,30,3,2,23,36,75,113,78,170,69,106,72,36,144,141,172,78,113,75,
+36,2,49,124,240,225,206,90,94,212,226,236,119,244,1,206,193,93,211,229,243,
+0,0,1,0,82,2,119,4,20,6,20,0,14,0,0,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,
+2,152,43,1,141,26,254,134,245,178,176,158,184,242,254,137,29,1,135,43,6,20,
+254,119,111,193,28,254,186,96,1,102,254,154,96,1,70,28,193,111,1,137,0,0,
+1,0,102,1,6,4,2,4,162,0,11,0,0,1,33,53,33,17,51,17,33,21,33,17,35,1,233,254,
+125,1,131,150,1,131,254,125,150,2,135,150,1,133,254,123,150,254,127,0,1,0,
+63,254,248,1,121,0,238,0,12,0,0,37,23,14,3,7,35,62,3,55,1,106,15,14,39,47,
+51,25,138,15,29,27,22,8,238,23,54,122,124,123,56,61,132,131,125,53,0,0,1,
+0,82,1,209,2,66,2,121,0,3,0,0,19,53,33,21,82,1,240,1,209,168,168,0,0,1,0,
+147,255,227,1,145,0,250,0,19,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,
+2,147,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,111,38,53,33,15,15,
+33,53,38,37,53,34,16,16,34,53,0,0,1,0,20,0,0,2,231,5,182,0,3,0,0,1,1,35,1,
+2,231,253,224,179,2,33,5,182,250,74,5,182,0,0,2,0,98,255,236,4,8,5,205,0,
+19,0,39,0,0,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,22,18,5,20,30,
+2,51,50,62,2,53,52,46,2,35,34,14,2,4,8,51,113,178,127,118,175,115,57,51,111,
+177,126,119,176,116,58,253,19,30,66,107,77,77,108,69,31,31,69,108,77,77,107,
+66,30,2,221,177,254,232,194,102,102,194,1,24,177,177,1,24,193,102,101,193,
+254,232,178,150,224,149,75,74,148,225,151,150,224,148,74,74,148,224,0,0,1,
+0,178,0,0,2,199,5,182,0,16,0,0,33,35,17,52,62,2,55,14,3,7,7,39,1,51,2,199,
+176,1,3,3,1,17,26,27,30,21,148,96,1,127,150,3,145,43,98,97,89,34,18,26,24,
+27,18,121,123,1,43,0,0,1,0,96,0,0,3,240,5,203,0,35,0,0,33,33,53,1,62,3,53,
+52,46,2,35,34,6,7,39,62,3,51,50,30,2,21,20,14,2,7,1,21,33,3,240,252,112,1,
+94,75,118,83,44,34,63,86,53,95,153,69,102,40,92,106,118,65,96,155,108,59,
+53,93,129,75,254,231,2,177,156,1,125,81,134,128,129,76,59,90,63,32,77,60,
+119,36,63,46,27,54,101,145,91,85,154,149,150,81,254,213,8,0,0,1,0,82,255,
+236,3,238,5,203,0,57,0,0,1,20,14,2,7,21,22,22,21,20,14,2,35,34,38,39,53,22,
+22,51,50,62,2,53,52,46,2,35,35,53,51,50,62,2,53,52,46,2,35,34,6,7,39,62,3,
+51,50,30,2,3,193,46,83,116,71,177,184,65,132,202,138,109,193,85,87,203,93,
+92,134,87,41,53,98,141,89,133,133,81,126,85,44,36,66,92,56,107,163,74,92,
+38,93,110,125,70,108,163,110,56,4,96,73,120,88,57,12,6,22,181,145,96,160,
+116,64,34,45,170,46,50,40,74,108,67,68,97,63,30,151,40,74,102,61,52,82,57,
+30,67,54,125,31,54,41,24,54,97,133,0,0,2,0,23,0,0,4,63,5,190,0,10,0,24,0,
+0,1,35,17,35,17,33,53,1,51,17,51,33,17,52,62,2,55,35,14,3,7,1,4,63,213,176,
+253,93,2,151,188,213,254,123,3,4,5,1,9,7,21,25,26,11,254,101,1,72,254,184,
+1,72,159,3,215,252,48,1,100,56,123,117,102,34,20,49,49,46,16,253,160,0,0,
+1,0,131,255,236,3,246,5,182,0,42,0,0,1,50,30,2,21,20,14,2,35,34,46,2,39,53,
+30,3,51,50,62,2,53,52,38,35,34,14,2,7,39,19,33,21,33,3,54,54,2,33,99,171,
+127,72,68,134,197,128,51,99,91,82,33,33,89,98,99,42,79,124,86,46,176,168,
+27,63,63,57,21,90,55,2,178,253,236,39,32,105,3,129,55,108,160,105,114,182,
+126,67,10,19,30,20,172,23,36,24,13,37,78,118,81,143,151,5,8,9,4,57,2,176,
+166,254,93,6,14,0,0,2,0,113,255,236,4,10,5,203,0,43,0,63,0,0,19,52,62,4,51,
+50,30,2,23,21,38,38,35,34,14,4,7,51,62,3,51,50,30,2,21,20,14,2,35,34,46,2,
+1,50,62,2,53,52,46,2,35,34,14,2,21,20,30,2,113,21,53,92,142,198,133,19,46,
+47,43,17,35,88,43,90,137,100,67,42,20,3,12,20,57,76,95,59,95,154,108,59,62,
+116,164,102,100,175,128,74,1,219,60,99,72,39,33,66,99,66,67,111,78,43,37,
+73,110,2,113,105,208,191,164,121,69,2,5,7,5,155,12,12,43,78,108,131,148,80,
+36,63,45,26,59,114,165,106,114,182,127,68,78,160,242,254,185,41,83,127,87,
+70,111,78,42,47,75,96,48,67,133,106,67,0,0,1,0,90,0,0,4,6,5,182,0,6,0,0,33,
+1,33,53,33,21,1,1,25,2,51,253,14,3,172,253,213,5,16,166,145,250,219,0,0,3,
+0,106,255,236,4,0,5,205,0,39,0,58,0,74,0,0,1,50,30,2,21,20,14,2,7,30,3,21,
+20,14,2,35,34,46,2,53,52,62,2,55,46,3,53,52,62,2,3,20,30,2,51,50,62,2,53,
+52,46,2,39,39,6,6,1,34,6,21,20,30,2,23,62,3,53,52,38,2,53,84,149,113,66,40,
+70,96,56,58,111,87,53,67,121,169,102,110,171,117,61,45,76,104,58,49,86,63,
+37,67,114,149,199,32,68,104,72,70,107,72,36,39,73,102,63,30,126,128,1,22,
+106,125,35,62,87,51,48,85,63,36,126,5,205,44,88,132,88,67,108,87,69,28,31,
+76,95,118,73,92,149,104,56,54,101,146,92,75,120,96,74,28,31,73,90,109,66,
+87,131,88,44,251,166,53,89,63,35,35,65,92,56,52,84,72,64,31,14,60,155,3,84,
+106,101,57,82,64,51,24,22,52,66,84,54,101,106,0,0,2,0,106,255,236,4,4,5,203,
+0,41,0,61,0,0,1,20,14,4,35,34,46,2,39,53,22,22,51,50,62,2,55,35,14,3,35,34,
+46,2,53,52,62,2,51,50,30,2,1,34,14,2,21,20,30,2,51,50,62,2,53,52,46,2,4,4,
+21,53,92,142,198,133,19,46,46,44,17,35,88,43,135,174,102,43,5,13,20,56,76,
+96,59,95,154,108,59,63,115,165,102,101,174,128,74,254,37,60,99,72,39,33,66,
+99,66,68,110,78,43,37,73,110,3,70,105,209,190,165,120,69,2,5,6,5,156,13,12,
+94,161,214,119,36,62,46,26,59,114,165,106,114,183,127,68,78,160,243,1,71,
+40,84,127,87,70,111,78,42,47,75,96,48,67,133,107,66,0,2,0,147,255,227,1,145,
+4,102,0,19,0,39,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,17,52,62,
+2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,20,20,34,47,26,
+27,46,34,20,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,111,38,53,33,
+15,15,33,53,38,37,53,34,16,16,34,53,3,145,39,53,33,14,14,33,53,39,37,52,34,
+16,16,34,52,0,2,0,63,254,248,1,145,4,102,0,12,0,32,0,0,37,23,14,3,7,35,62,
+3,55,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,106,15,14,39,47,51,25,138,
+15,29,27,22,8,17,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,238,23,54,
+122,124,123,56,61,132,131,125,53,2,237,39,53,33,14,14,33,53,39,37,52,34,16,
+16,34,52,0,0,1,0,102,0,238,4,2,4,221,0,6,0,0,37,1,53,1,21,1,1,4,2,252,100,
+3,156,253,33,2,223,238,1,168,102,1,225,160,254,148,254,190,0,2,0,102,1,186,
+4,2,3,233,0,3,0,7,0,0,19,53,33,21,1,53,33,21,102,3,156,252,100,3,156,3,84,
+149,149,254,102,150,150,0,0,1,0,102,0,238,4,2,4,221,0,6,0,0,19,1,1,53,1,21,
+1,102,2,224,253,32,3,156,252,100,1,143,1,66,1,108,160,254,31,102,254,88,0,
+2,0,37,255,227,3,37,5,203,0,39,0,59,0,0,1,53,52,62,2,55,62,3,53,52,46,2,35,
+34,6,7,39,54,54,51,50,30,2,21,20,14,2,7,14,3,21,21,3,52,62,2,51,50,30,2,21,
+20,14,2,35,34,46,2,1,25,15,39,66,50,48,68,43,21,30,57,85,56,83,150,70,63,
+81,188,97,93,149,104,56,27,54,80,54,52,66,38,14,187,20,34,46,27,26,47,34,
+20,20,34,47,26,27,46,34,20,1,158,37,57,92,80,77,42,41,67,69,79,53,48,79,57,
+31,52,34,145,42,59,51,96,139,87,67,105,90,84,47,45,67,63,66,44,18,254,209,
+38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,2,0,109,255,74,6,129,5,182,
+0,87,0,104,0,0,1,20,14,4,35,34,46,2,39,35,14,3,35,34,46,2,53,52,62,2,51,50,
+30,2,23,3,6,6,20,20,21,20,30,2,51,50,62,2,53,52,46,2,35,34,4,6,2,21,20,30,
+2,51,50,62,2,55,21,6,6,35,34,36,38,2,53,52,18,54,36,51,50,4,22,18,1,20,22,
+51,50,62,2,55,55,38,38,35,34,14,2,6,129,19,37,57,76,97,58,45,73,52,33,6,4,
+18,54,71,89,53,77,119,82,43,59,111,158,98,45,90,82,69,23,23,1,1,21,34,43,
+23,46,70,47,24,86,152,209,123,169,254,254,175,90,79,153,227,147,61,119,111,
+100,43,86,216,130,179,254,231,195,102,118,219,1,55,193,156,1,6,191,106,252,
+21,101,85,55,78,50,26,4,14,28,77,42,74,101,63,28,2,219,62,125,113,97,72,41,
+30,50,65,35,37,66,49,28,56,101,142,86,101,168,122,68,8,14,17,8,254,96,22,
+27,16,8,3,53,68,40,15,61,104,140,78,142,221,152,79,111,199,254,239,162,151,
+234,160,82,14,24,31,17,141,38,44,102,195,1,25,179,188,1,69,238,136,101,189,
+254,241,254,213,133,119,45,83,115,69,253,8,13,58,94,120,0,1,0,61,254,188,
+2,162,5,182,0,39,0,0,5,20,30,2,23,21,46,3,53,17,52,38,35,53,50,54,53,17,52,
+62,2,55,21,14,3,21,17,20,6,7,21,22,22,21,1,244,24,45,65,40,77,131,95,54,131,
+125,125,131,54,95,131,77,40,65,45,24,119,115,115,119,16,48,61,35,13,1,150,
+1,33,71,110,78,1,78,103,86,155,86,103,1,77,78,110,71,33,1,149,1,13,35,61,
+48,254,180,105,123,20,12,20,122,106,0,0,1,1,233,254,20,2,127,6,20,0,3,0,0,
+1,51,17,35,1,233,150,150,6,20,248,0,0,1,0,51,254,188,2,152,5,182,0,41,0,0,
+19,52,54,55,53,38,38,53,17,52,46,2,39,53,30,3,21,17,20,30,2,51,21,34,6,21,
+17,20,14,2,7,53,62,3,53,225,119,115,115,119,24,45,65,40,77,131,95,54,33,65,
+96,62,125,131,54,95,131,77,40,65,45,24,1,59,106,122,20,12,20,123,105,1,76,
+48,61,35,13,1,149,1,33,71,110,78,254,179,52,72,45,20,155,86,103,254,178,78,
+110,71,33,1,150,1,13,35,61,48,0,1,0,102,2,74,4,2,3,90,0,35,0,0,1,46,3,35,
+34,14,2,7,53,54,51,50,30,2,23,30,3,51,50,62,2,55,21,6,35,34,46,2,2,18,37,
+55,45,41,22,28,60,59,56,25,100,148,29,50,55,67,47,37,55,47,40,22,28,60,59,
+56,24,99,149,29,50,55,67,2,139,16,22,13,5,19,33,44,25,162,108,5,13,25,20,
+16,22,13,5,19,33,44,25,162,108,5,13,25,0,2,0,82,0,115,3,147,3,199,0,6,0,13,
+0,0,19,1,23,3,19,7,1,37,1,23,3,19,7,1,82,1,53,117,238,238,117,254,203,1,151,
+1,54,116,237,237,116,254,202,2,41,1,158,78,254,164,254,164,78,1,155,27,1,
+158,78,254,164,254,164,78,1,155,255,255,0,82,1,209,2,66,2,121,18,6,0,16,0,
+0,0,2,0,84,0,115,3,150,3,199,0,6,0,13,0,0,1,1,39,19,3,55,1,5,1,39,19,3,55,
+1,3,150,254,202,116,237,237,116,1,54,254,104,254,203,117,238,238,117,1,53,
+2,14,254,101,78,1,92,1,92,78,254,98,27,254,101,78,1,92,1,92,78,254,98,0,0,
+2,0,200,0,0,4,76,4,176,0,3,0,17,0,0,1,21,33,53,19,17,35,17,16,33,32,17,17,
+35,17,52,33,32,4,76,252,124,188,188,1,194,1,194,188,254,250,254,250,4,176,
+138,138,253,168,253,168,2,88,1,67,254,189,253,168,2,88,185,0,1,0,200,0,0,
+4,76,4,176,0,49,0,0,1,21,20,23,22,51,50,55,54,53,53,51,21,20,7,6,35,34,39,
+38,53,17,37,36,53,52,39,38,35,34,7,6,21,20,51,21,35,34,53,53,52,55,54,51,
+50,23,22,21,16,5,1,132,59,58,145,145,59,58,188,100,100,250,250,100,100,1,
+100,1,100,58,59,145,145,58,59,100,150,138,100,100,250,250,100,100,253,234,
+1,217,150,92,46,47,47,46,92,157,157,138,92,93,93,92,138,1,7,50,51,190,92,
+47,46,46,47,72,34,144,144,34,118,93,92,92,93,138,254,210,76,0,0,2,0,200,0,
+0,4,76,4,176,0,3,0,27,0,0,1,21,33,53,19,54,51,51,21,35,34,7,6,7,21,35,17,
+16,33,32,17,17,35,17,52,33,32,21,4,76,252,124,188,69,116,127,104,103,43,42,
+20,188,1,194,1,194,188,254,250,254,250,4,176,138,138,252,144,80,138,46,45,
+85,86,2,88,1,67,254,189,253,168,2,88,185,185,0,0,1,0,59,0,0,6,164,4,176,0,
+51,0,0,1,39,39,38,53,52,63,2,51,21,35,23,17,20,51,50,53,17,39,39,38,53,52,
+63,2,51,21,35,23,17,16,33,34,39,6,35,32,17,17,52,35,53,51,50,21,17,20,51,
+50,53,3,94,80,40,21,19,37,75,248,248,198,231,231,105,52,31,16,37,75,248,248,
+248,254,93,219,106,106,225,254,87,141,179,150,237,237,3,38,99,50,25,25,24,
+24,49,98,138,222,253,251,185,185,1,227,99,50,29,28,21,20,49,98,138,222,253,
+251,254,189,98,98,1,67,2,180,47,138,102,252,249,185,185,0,1,0,100,0,0,4,76,
+5,120,0,44,0,0,19,51,17,20,22,51,50,55,38,53,52,51,50,21,20,7,22,23,22,21,
+17,35,39,7,35,17,52,35,53,51,50,21,17,37,5,17,52,38,39,6,35,34,39,38,53,200,
+188,72,70,74,101,75,190,180,68,21,22,125,218,231,232,219,100,150,138,1,7,
+1,5,48,36,142,156,158,83,89,5,120,254,151,50,66,30,51,52,144,144,62,57,7,
+10,53,147,253,48,210,210,2,23,41,144,144,254,102,239,238,2,41,49,46,19,49,
+70,61,123,0,0,2,0,100,0,0,4,76,4,176,0,4,0,37,0,0,1,53,34,21,20,37,39,38,
+53,52,55,55,33,21,33,7,6,21,20,23,23,17,20,33,32,53,53,34,53,52,51,50,21,
+17,16,33,32,17,3,144,92,253,148,28,72,18,140,3,74,252,187,21,5,67,84,1,6,
+1,6,210,210,188,254,62,254,62,2,128,122,61,61,146,36,92,41,37,25,183,138,
+25,5,8,32,76,96,254,15,185,185,179,199,199,122,254,57,254,189,1,67,0,0,2,
+0,100,0,0,4,76,4,176,0,4,0,51,0,0,1,53,34,21,20,5,17,39,38,53,52,55,55,33,
+21,33,7,6,21,20,23,23,17,51,23,22,22,51,50,54,53,53,34,53,52,51,50,21,17,
+20,6,35,34,39,38,39,35,17,35,38,53,52,3,144,92,253,148,28,72,18,140,3,74,
+252,187,21,5,67,84,248,42,50,67,25,25,67,210,210,188,150,130,130,75,58,43,
+126,188,100,2,128,122,61,61,240,1,130,36,92,41,37,25,183,138,25,5,8,32,76,
+96,254,92,77,92,93,93,92,179,199,199,122,254,57,138,185,93,71,98,254,250,
+162,119,119,0,1,0,100,0,0,4,76,5,120,0,31,0,0,37,37,5,17,51,17,35,39,7,35,
+17,39,38,53,52,55,55,33,50,53,53,51,21,20,33,33,7,6,21,20,23,23,1,132,1,7,
+1,5,188,218,231,232,219,28,72,18,140,2,30,112,188,254,212,253,231,21,5,67,
+84,166,239,238,2,244,252,101,210,210,3,18,36,92,41,37,25,183,50,150,150,188,
+25,5,8,32,76,96,0,2,0,200,0,0,9,58,4,176,0,4,0,66,0,0,1,21,50,53,52,1,16,
+33,32,17,17,20,51,50,53,17,39,39,38,53,52,63,2,51,21,35,23,17,20,51,50,53,
+17,39,39,38,53,52,63,2,51,21,35,23,17,16,33,34,39,6,35,32,17,17,52,35,34,
+21,17,50,21,20,35,34,53,1,132,92,254,232,1,169,1,169,237,237,80,40,21,19,
+37,75,248,248,198,231,231,105,52,31,16,37,75,248,248,248,254,93,219,106,106,
+225,254,87,237,237,210,210,188,1,54,172,111,61,2,55,1,67,254,189,253,214,
+185,185,1,227,99,50,25,25,24,24,49,98,138,222,253,251,185,185,1,227,99,50,
+29,28,21,20,49,98,138,222,253,251,254,189,98,98,1,67,2,42,185,185,254,83,
+199,249,122,0,0,3,0,200,254,12,6,214,4,176,0,19,0,24,0,74,0,0,5,33,21,20,
+33,34,39,38,33,33,53,33,32,23,22,51,50,53,53,35,1,21,50,53,52,1,52,55,54,
+51,50,23,54,51,50,23,54,51,50,23,22,21,17,35,17,52,39,38,35,34,7,6,21,17,
+35,17,52,35,34,7,6,35,34,39,38,35,34,21,17,50,21,20,35,34,53,5,120,1,94,254,
+184,237,160,161,254,248,254,112,1,144,1,91,167,167,141,140,162,252,12,92,
+254,232,75,75,95,94,111,112,95,93,75,101,205,219,100,100,188,58,59,114,114,
+58,59,188,72,49,82,27,32,32,27,81,49,73,210,210,188,100,160,240,100,100,120,
+100,100,120,40,2,18,172,111,61,2,101,113,82,82,124,124,81,81,92,93,138,252,
+147,3,109,92,46,47,47,46,92,252,147,3,155,127,94,31,31,94,127,254,37,199,
+249,122,0,0,2,0,200,0,0,4,76,5,120,0,11,0,23,0,0,37,37,5,17,51,17,35,39,7,
+35,17,51,3,51,21,33,50,53,53,51,21,20,33,33,1,132,1,7,1,5,188,218,231,232,
+219,188,188,188,1,156,112,188,254,212,253,168,166,239,238,2,144,252,201,210,
+210,3,55,1,171,150,50,250,250,188,0,1,0,80,0,0,4,76,5,120,0,34,0,0,19,52,
+35,53,51,50,21,17,20,33,32,53,17,37,38,53,52,63,2,51,50,53,53,51,21,20,33,
+35,5,17,16,33,32,17,200,120,158,150,1,6,1,6,254,245,31,16,37,75,100,70,188,
+254,254,100,1,102,254,62,254,62,3,247,47,138,102,252,249,185,185,1,167,209,
+29,28,21,20,49,98,50,150,150,188,222,253,251,254,189,1,67,0,0,1,0,200,255,
+206,4,76,4,176,0,59,0,0,37,6,7,6,35,34,38,53,17,37,36,53,53,52,35,34,7,6,
+35,34,39,38,35,34,21,21,20,51,21,35,34,53,53,52,55,54,51,50,23,54,51,50,23,
+22,21,21,16,5,7,21,20,22,51,50,36,53,53,51,17,35,3,144,15,17,220,160,160,
+140,1,100,1,100,72,49,82,27,32,32,27,81,49,73,100,150,138,75,75,95,94,111,
+112,95,94,75,74,253,234,178,57,70,70,1,71,188,188,153,10,10,133,185,138,1,
+7,50,51,190,46,127,94,31,31,94,127,26,34,144,144,60,113,82,82,124,124,82,
+82,113,46,254,210,76,26,150,92,93,203,62,77,253,238,0,0,2,0,200,0,0,6,164,
+4,176,0,4,0,70,0,0,1,21,50,53,52,1,52,55,54,51,50,23,54,51,50,23,22,21,17,
+51,23,22,22,51,50,54,53,17,39,39,38,53,52,63,2,51,21,35,23,17,20,6,35,34,
+39,38,39,35,17,35,17,52,35,34,7,6,35,34,39,38,35,34,21,17,50,21,20,35,34,
+53,1,132,92,254,232,75,75,95,94,111,112,95,94,75,74,136,42,50,67,25,25,67,
+105,52,31,16,37,75,248,248,248,150,130,130,75,58,43,14,188,72,49,82,27,32,
+32,27,81,49,73,210,210,188,1,54,172,111,61,2,101,113,82,82,124,124,82,82,
+113,253,245,77,92,93,93,92,1,227,99,50,29,28,21,20,49,98,138,222,253,251,
+138,185,93,71,98,254,250,3,155,127,94,31,31,94,127,254,37,199,249,122,0,2,
+0,200,0,0,9,34,4,176,0,4,0,41,0,0,1,21,50,53,52,1,35,17,52,35,34,21,17,35,
+39,7,35,17,52,35,34,21,17,50,21,20,35,34,53,17,16,33,32,17,17,55,23,17,16,
+33,32,17,1,132,92,7,66,188,231,231,218,200,201,219,231,231,210,210,188,1,
+163,1,163,232,230,1,163,1,163,1,54,172,111,61,254,202,3,109,185,185,252,147,
+182,182,3,109,185,185,254,83,199,249,122,2,243,1,67,254,189,253,57,211,210,
+2,198,1,67,254,189,0,0,3,0,200,0,0,4,76,4,176,0,3,0,8,0,27,0,0,1,21,33,53,
+19,21,50,53,52,1,35,17,52,33,32,21,21,50,21,20,35,34,53,17,16,33,32,17,4,
+76,252,124,188,92,2,108,188,254,250,254,250,210,210,188,1,194,1,194,4,176,
+138,138,252,134,172,111,61,254,202,2,88,185,185,152,199,249,122,1,222,1,67,
+254,189,0,0,2,0,100,0,0,4,76,5,120,0,4,0,43,0,0,1,53,34,21,20,37,39,38,53,
+52,55,55,33,50,53,53,51,21,20,33,33,7,6,21,20,23,23,17,20,33,32,53,53,34,
+53,52,51,50,21,17,16,33,32,17,3,144,92,253,148,28,72,18,140,2,30,112,188,
+254,212,253,231,21,5,67,84,1,6,1,6,210,210,188,254,62,254,62,2,128,122,61,
+61,146,36,92,41,37,25,183,50,150,150,188,25,5,8,32,76,96,254,15,185,185,179,
+199,199,122,254,57,254,189,1,67,0,1,0,200,0,0,4,76,4,176,0,48,0,0,1,21,16,
+33,32,17,53,51,21,20,51,50,53,53,39,36,17,52,55,54,51,50,23,22,21,21,35,53,
+52,39,38,35,34,7,6,21,20,5,23,54,55,54,51,50,22,21,20,7,6,4,14,254,118,254,
+118,188,206,206,116,253,234,100,100,250,250,100,100,188,59,58,145,145,59,
+58,1,100,114,9,20,36,52,52,73,36,12,1,211,144,254,189,1,67,157,157,185,185,
+159,17,76,1,46,138,93,92,92,93,118,50,50,72,47,46,46,47,92,190,51,16,24,20,
+36,73,52,52,36,12,0,2,0,100,0,0,4,76,4,176,0,4,0,35,0,0,1,53,34,21,20,1,35,
+39,7,35,17,39,38,53,52,55,55,33,21,33,7,6,21,20,23,23,17,37,5,17,34,53,52,
+51,50,21,3,144,92,1,24,218,231,232,219,28,72,18,140,3,74,252,187,21,5,67,
+84,1,7,1,5,210,210,188,2,128,122,61,61,253,128,210,210,3,18,36,92,41,37,25,
+183,138,25,5,8,32,76,96,253,114,239,238,1,79,199,199,122,0,0,1,0,200,0,0,
+4,76,4,176,0,52,0,0,1,36,17,52,55,54,51,50,23,22,21,21,20,35,35,53,50,53,
+52,39,38,35,34,7,6,21,20,5,4,21,21,20,6,35,34,39,38,38,35,21,35,17,23,21,
+50,22,22,51,50,54,53,53,52,2,222,253,234,100,100,250,250,100,100,138,150,
+100,59,58,145,145,59,58,1,100,1,100,150,130,130,75,58,93,76,188,188,178,162,
+67,25,25,67,1,243,76,1,46,138,93,92,92,93,118,34,144,144,34,72,47,46,46,47,
+92,190,51,50,223,80,128,155,93,71,48,212,1,248,1,153,119,93,63,72,90,110,
+0,0,1,0,59,0,0,4,76,4,176,0,35,0,0,19,39,39,38,53,52,63,2,51,21,35,23,17,
+20,33,32,53,17,39,39,38,53,52,63,2,51,21,35,23,17,16,33,32,17,200,80,40,21,
+19,37,75,248,248,198,1,6,1,6,105,52,31,16,37,75,248,248,248,254,62,254,62,
+3,38,99,50,25,25,24,24,49,98,138,222,253,251,185,185,1,227,99,50,29,28,21,
+20,49,98,138,222,253,251,254,189,1,67,0,0,2,0,100,0,0,4,76,5,120,0,4,0,41,
+0,0,1,53,34,21,20,1,35,39,7,35,17,39,38,53,52,55,55,33,50,53,53,51,21,20,
+33,33,7,6,21,20,23,23,17,37,5,17,34,53,52,51,50,21,3,144,92,1,24,218,231,
+232,219,28,72,18,140,2,30,112,188,254,212,253,231,21,5,67,84,1,7,1,5,210,
+210,188,2,128,122,61,61,253,128,210,210,3,18,36,92,41,37,25,183,50,150,150,
+188,25,5,8,32,76,96,253,114,239,238,1,79,199,199,122,0,2,0,200,0,0,4,76,4,
+176,0,4,0,39,0,0,1,21,50,53,52,1,52,55,54,51,50,23,54,51,50,23,22,21,17,35,
+17,52,35,34,7,6,35,34,39,38,35,34,21,17,50,21,20,35,34,53,1,132,92,254,232,
+75,75,95,94,111,112,95,94,75,74,188,72,49,82,27,32,32,27,81,49,73,210,210,
+188,1,54,172,111,61,2,101,113,82,82,124,124,82,82,113,252,101,3,155,127,94,
+31,31,94,127,254,37,199,249,122,0,0,2,0,40,0,0,4,76,4,176,0,3,0,29,0,0,1,
+21,33,53,18,22,21,20,35,34,39,55,22,51,50,53,52,38,53,16,33,32,17,17,35,17,
+52,33,32,21,4,76,252,124,188,70,222,156,40,107,34,55,34,70,1,194,1,194,188,
+254,250,254,250,4,176,138,138,253,108,192,124,224,223,41,90,50,43,240,93,
+1,67,254,189,253,168,2,88,185,185,0,0,2,0,59,0,0,4,76,4,176,0,32,0,39,0,0,
+1,16,33,32,17,17,39,39,38,53,52,63,2,51,21,35,23,21,33,53,39,39,38,53,52,
+63,2,51,21,35,23,3,33,21,20,33,32,53,4,76,254,62,254,62,80,40,21,19,37,75,
+248,248,198,2,12,105,52,31,16,37,75,248,248,248,188,253,244,1,6,1,6,1,67,
+254,189,1,67,1,227,99,50,25,25,24,24,49,98,138,222,171,137,99,50,29,28,21,
+20,49,98,138,222,254,203,208,185,185,0,1,0,200,0,0,6,214,4,176,0,63,0,0,19,
+52,51,51,21,34,21,17,20,22,51,50,54,53,17,39,39,38,53,52,63,2,51,21,35,23,
+17,20,23,22,51,50,55,54,53,17,39,39,38,53,52,63,2,51,21,35,23,17,20,6,35,
+34,39,38,39,6,7,6,35,34,38,53,200,150,179,141,117,145,145,117,80,40,21,19,
+37,75,248,248,198,59,58,114,114,59,58,105,52,31,16,37,75,248,248,248,200,
+219,219,100,3,3,3,3,100,250,250,200,4,74,102,138,47,253,76,92,93,93,92,1,
+227,99,50,25,25,24,24,49,98,138,222,253,251,92,46,47,47,46,92,1,227,99,50,
+29,28,21,20,49,98,138,222,253,251,138,185,93,2,3,3,2,93,185,138,0,0,2,0,12,
+0,0,1,132,4,176,0,4,0,25,0,0,19,34,21,20,51,17,39,39,38,53,52,63,2,51,21,
+35,23,17,20,35,35,34,53,52,51,200,42,42,105,52,31,16,37,75,248,248,248,94,
+94,160,160,1,54,61,111,2,156,99,50,29,28,21,20,49,98,138,222,253,50,122,249,
+199,0,2,0,200,0,0,6,164,4,176,0,4,0,44,0,0,1,21,50,53,52,1,39,39,38,53,52,
+63,2,51,21,35,23,17,16,33,32,17,17,52,35,34,21,17,50,21,20,35,34,53,17,16,
+33,32,17,17,20,51,50,53,1,132,92,4,8,105,52,31,16,37,75,248,248,248,254,93,
+254,93,237,237,210,210,188,1,169,1,169,231,231,1,54,172,111,61,1,240,99,50,
+29,28,21,20,49,98,138,222,253,251,254,189,1,67,2,42,185,185,254,83,199,249,
+122,2,243,1,67,254,189,253,214,185,185,0,0,2,0,12,0,0,1,244,5,120,0,4,0,31,
+0,0,19,34,21,20,51,17,39,39,38,53,52,63,2,51,50,53,53,51,21,20,33,35,23,17,
+20,35,35,34,53,52,51,200,42,42,105,52,31,16,37,75,100,72,188,254,252,100,
+248,94,94,160,160,1,54,61,111,2,156,99,50,29,28,21,20,49,98,50,150,150,188,
+222,253,50,122,249,199,0,0,2,0,200,0,0,4,176,4,176,0,3,0,43,0,0,1,21,33,53,
+1,51,21,35,17,35,17,35,53,51,53,52,39,38,35,34,7,6,21,17,54,51,51,21,35,34,
+7,6,7,21,35,17,52,55,54,51,50,23,22,21,4,76,252,124,3,132,100,100,188,172,
+172,58,59,145,145,58,59,69,116,127,104,103,43,42,20,188,100,100,250,250,100,
+100,4,176,138,138,252,224,138,254,250,1,6,138,200,92,47,46,46,47,92,254,232,
+80,138,46,45,85,86,2,88,138,93,92,92,93,138,0,0,1,0,59,0,0,4,176,4,176,0,
+47,0,0,1,53,39,39,38,53,52,63,2,51,21,35,23,21,51,21,35,21,20,6,35,34,38,
+53,17,39,39,38,53,52,63,2,51,21,35,23,17,20,22,51,50,54,53,53,35,53,3,144,
+105,52,31,16,37,75,248,248,248,100,100,200,250,250,200,80,40,21,19,37,75,
+248,248,198,117,145,145,117,172,2,157,137,99,50,29,28,21,20,49,98,138,222,
+171,138,208,138,185,185,138,1,227,99,50,25,25,24,24,49,98,138,222,253,251,
+92,93,93,92,208,138,0,0,2,0,200,0,0,6,164,4,176,0,4,0,60,0,0,1,21,50,53,52,
+1,39,39,38,53,52,63,2,51,21,35,23,17,16,33,32,17,17,52,35,34,21,21,50,21,
+20,35,34,53,17,52,55,54,55,39,39,38,53,52,63,2,33,21,33,23,54,51,32,17,17,
+20,51,50,53,1,132,92,4,8,105,52,31,16,37,75,248,248,248,254,93,254,93,237,
+237,210,210,188,100,19,25,34,40,21,19,37,75,2,58,253,198,130,53,62,1,169,
+231,231,1,54,172,111,61,1,240,99,50,29,28,21,20,49,98,138,222,253,251,254,
+189,1,67,1,21,185,185,152,199,249,122,1,222,138,93,18,14,42,50,25,25,24,24,
+49,98,138,146,7,254,189,254,235,185,185,0,1,0,59,0,0,6,164,4,176,0,46,0,0,
+1,52,38,35,34,6,21,17,20,7,6,35,34,39,38,53,17,39,39,38,53,52,63,2,51,21,
+35,23,17,20,23,22,51,50,55,54,53,17,52,54,51,50,22,21,17,35,5,232,117,114,
+114,117,100,100,225,225,100,100,80,40,21,19,37,75,248,248,198,59,58,120,120,
+59,58,200,213,213,212,188,3,109,92,93,93,92,253,214,138,93,92,92,93,138,1,
+227,99,50,25,25,24,24,49,98,138,222,253,251,92,47,46,46,47,92,2,42,138,185,
+162,161,252,147,0,2,0,200,254,22,6,164,4,176,0,48,0,76,0,0,1,21,16,33,32,
+17,53,51,21,20,51,50,53,53,39,36,17,52,55,54,51,50,23,22,21,21,35,53,52,39,
+38,35,34,7,6,21,20,5,23,54,55,54,51,50,22,21,20,7,6,1,39,39,38,53,52,63,2,
+51,21,35,23,17,35,39,7,35,53,52,35,53,51,50,21,21,55,23,4,14,254,118,254,
+118,188,206,206,116,253,234,100,100,250,250,100,100,188,59,58,145,145,59,
+58,1,100,114,9,20,36,52,52,73,36,12,1,204,105,52,31,16,37,75,248,248,248,
+218,206,207,219,100,150,138,238,236,1,211,144,254,189,1,67,157,157,185,185,
+159,17,76,1,46,138,93,92,92,93,118,50,50,72,47,46,46,47,92,190,51,16,24,20,
+36,73,52,52,36,12,1,75,99,50,29,28,21,20,49,98,138,222,250,206,187,187,255,
+41,144,144,130,216,215,0,1,0,59,0,0,4,76,4,176,0,43,0,0,37,20,35,35,53,50,
+53,17,33,17,20,35,35,53,50,53,17,39,39,38,53,52,63,2,51,21,35,23,21,33,53,
+39,39,38,53,52,63,2,51,21,35,23,4,76,150,179,141,253,244,150,179,141,80,40,
+21,19,37,75,248,248,198,2,12,105,52,31,16,37,75,248,248,248,102,102,138,47,
+1,90,254,83,102,138,47,2,109,99,50,25,25,24,24,49,98,138,222,171,137,99,50,
+29,28,21,20,49,98,138,222,0,0,1,0,59,0,0,4,76,4,176,0,43,0,0,37,20,35,35,
+53,50,53,17,33,17,20,35,35,53,50,53,17,39,39,38,53,52,63,2,51,21,35,23,21,
+33,53,39,39,38,53,52,63,2,51,21,35,23,4,76,150,179,141,253,244,150,179,141,
+80,40,21,19,37,75,248,248,198,2,12,105,52,31,16,37,75,248,248,248,102,102,
+138,47,1,90,254,83,102,138,47,2,109,99,50,25,25,24,24,49,98,138,222,171,137,
+99,50,29,28,21,20,49,98,138,222,0,0,2,0,59,0,0,6,164,4,176,0,11,0,55,0,0,
+1,50,22,21,17,35,17,52,38,35,35,53,3,20,35,35,53,50,53,17,33,17,20,35,35,
+53,50,53,17,39,39,38,53,52,63,2,51,21,35,23,21,33,53,39,39,38,53,52,63,2,
+51,21,35,23,5,100,168,152,188,57,75,230,50,150,179,141,253,244,150,179,141,
+80,40,21,19,37,75,248,248,198,2,12,105,52,31,16,37,75,248,248,248,4,176,132,
+131,252,87,3,169,72,53,138,251,182,102,138,47,1,90,254,83,102,138,47,2,109,
+99,50,25,25,24,24,49,98,138,222,171,137,99,50,29,28,21,20,49,98,138,222,0,
+3,0,100,0,0,4,76,5,120,0,21,0,26,0,53,0,0,19,38,53,52,55,55,33,50,53,53,51,
+21,20,33,33,7,6,21,20,23,23,7,19,21,50,53,52,1,52,55,54,51,50,23,22,21,17,
+35,17,52,39,38,35,34,7,6,21,21,50,21,20,35,34,53,172,72,18,140,2,30,112,188,
+254,212,253,231,21,5,67,10,136,210,92,254,232,100,100,250,250,100,100,188,
+58,59,145,145,58,59,210,210,188,3,54,92,41,37,25,183,50,150,150,188,25,5,
+8,32,76,12,90,254,8,172,111,61,1,34,138,93,92,92,93,138,253,168,2,88,92,47,
+46,46,47,92,152,199,249,122,0,3,0,200,254,12,6,164,7,108,0,45,0,50,0,77,0,
+0,1,52,39,38,35,34,7,6,21,21,20,51,21,35,34,53,53,52,55,54,51,50,23,22,21,
+20,33,50,53,17,52,35,34,7,35,17,51,17,54,51,32,17,17,20,33,32,1,21,50,53,
+52,1,52,55,54,51,50,23,22,21,17,35,17,52,39,38,35,34,7,6,21,17,50,21,20,35,
+34,53,3,115,52,52,129,129,51,53,107,141,133,89,89,222,222,89,89,1,6,200,200,
+200,60,128,188,95,105,1,132,254,124,254,83,254,17,92,254,232,100,100,225,
+225,100,100,188,58,59,120,120,58,59,210,210,188,254,229,66,34,33,33,34,66,
+83,34,100,74,143,99,68,66,66,68,99,77,100,5,230,230,80,1,244,254,164,58,254,
+152,250,26,240,3,42,172,111,61,2,55,138,93,92,92,93,138,252,147,3,109,92,
+47,46,46,47,92,254,83,199,249,122,0,0,1,0,200,255,206,4,76,4,176,0,48,0,0,
+19,37,36,53,52,39,38,35,34,7,6,21,20,51,21,35,34,53,53,52,55,54,51,50,23,
+22,21,16,5,7,21,20,22,51,50,36,53,53,51,17,35,53,6,7,6,35,34,38,53,200,1,
+100,1,100,58,59,145,145,58,59,100,150,138,100,100,250,250,100,100,253,234,
+178,57,70,70,1,71,188,188,15,17,220,160,160,140,2,74,50,51,190,92,47,46,46,
+47,72,34,144,144,34,118,93,92,92,93,138,254,210,76,26,150,92,93,203,62,77,
+253,238,203,10,10,133,185,138,0,2,0,200,255,206,4,76,5,220,0,48,0,52,0,0,
+19,37,36,53,52,39,38,35,34,7,6,21,20,51,21,35,34,53,53,52,55,54,51,50,23,
+22,21,16,5,7,21,20,22,51,50,36,53,53,51,17,35,53,6,7,6,35,34,38,53,1,21,33,
+53,200,1,100,1,100,58,59,145,145,58,59,100,150,138,100,100,250,250,100,100,
+253,234,178,57,70,70,1,71,188,188,15,17,220,160,160,140,3,132,252,124,2,74,
+50,51,190,92,47,46,46,47,72,34,144,144,34,118,93,92,92,93,138,254,210,76,
+26,150,92,93,203,62,77,253,238,203,10,10,133,185,138,4,153,138,138,0,2,0,
+200,255,206,5,120,4,176,0,48,0,52,0,0,19,37,36,53,52,39,38,35,34,7,6,21,20,
+51,21,35,34,53,53,52,55,54,51,50,23,22,21,16,5,7,21,20,22,51,50,36,53,53,
+51,17,35,53,6,7,6,35,34,38,53,37,17,35,17,200,1,100,1,100,58,59,145,145,58,
+59,100,150,138,100,100,250,250,100,100,253,234,178,57,70,70,1,71,188,188,
+15,17,220,160,160,140,4,176,188,2,74,50,51,190,92,47,46,46,47,72,34,144,144,
+34,118,93,92,92,93,138,254,210,76,26,150,92,93,203,62,77,253,238,203,10,10,
+133,185,138,157,253,238,2,18,0,2,0,100,255,206,4,76,6,164,0,48,0,70,0,0,19,
+37,36,53,52,39,38,35,34,7,6,21,20,51,21,35,34,53,53,52,55,54,51,50,23,22,
+21,16,5,7,21,20,22,51,50,36,53,53,51,17,35,53,6,7,6,35,34,38,53,3,38,53,52,
+55,55,33,50,53,53,51,21,20,33,33,7,6,21,20,23,23,7,200,1,100,1,100,58,59,
+145,145,58,59,100,150,138,100,100,250,250,100,100,253,234,178,57,70,70,1,
+71,188,188,15,17,220,160,160,140,28,72,18,140,2,30,112,188,254,212,253,231,
+21,5,67,10,136,2,74,50,51,190,92,47,46,46,47,72,34,144,144,34,118,93,92,92,
+93,138,254,210,76,26,150,92,93,203,62,77,253,238,203,10,10,133,185,138,3,
+31,92,41,37,25,183,50,150,150,188,25,5,8,32,76,12,90,0,0,2,0,59,254,12,4,
+76,4,176,0,10,0,50,0,0,19,33,32,53,35,53,33,21,16,33,33,1,39,39,38,53,52,
+63,2,51,21,35,23,17,20,6,35,34,38,53,17,39,39,38,53,52,63,2,51,21,35,23,17,
+20,22,51,50,54,53,200,1,44,1,156,112,1,44,253,168,254,212,2,200,105,52,31,
+16,37,75,248,248,248,200,250,250,200,80,40,21,19,37,75,248,248,198,117,145,
+145,117,254,132,200,130,130,254,192,5,26,99,50,29,28,21,20,49,98,138,222,
+253,251,138,185,185,138,1,227,99,50,25,25,24,24,49,98,138,222,253,251,92,
+93,93,92,0,2,0,59,254,12,4,226,4,176,0,39,0,59,0,0,1,39,39,38,53,52,63,2,
+51,21,35,23,17,20,6,35,34,38,53,17,39,39,38,53,52,63,2,51,21,35,23,17,20,
+22,51,50,54,53,19,22,51,51,21,35,34,39,6,33,33,53,33,32,53,35,53,33,21,20,
+3,144,105,52,31,16,37,75,248,248,248,200,250,250,200,80,40,21,19,37,75,248,
+248,198,117,145,145,117,168,47,43,80,80,96,99,149,254,186,254,212,1,44,1,
+156,112,1,44,3,38,99,50,29,28,21,20,49,98,138,222,253,251,138,185,185,138,
+1,227,99,50,25,25,24,24,49,98,138,222,253,251,92,93,93,92,253,159,94,120,
+94,94,120,200,130,130,58,0,3,0,200,254,12,4,76,4,176,0,10,0,15,0,50,0,0,19,
+33,32,53,35,53,33,21,16,33,33,19,21,50,53,52,1,52,55,54,51,50,23,54,51,50,
+23,22,21,17,35,17,52,35,34,7,6,35,34,39,38,35,34,21,17,50,21,20,35,34,53,
+200,1,44,1,156,112,1,44,253,168,254,212,188,92,254,232,75,75,95,94,111,112,
+95,94,75,74,188,72,49,82,27,32,32,27,81,49,73,210,210,188,254,132,200,130,
+130,254,192,3,42,172,111,61,2,101,113,82,82,124,124,82,82,113,252,101,3,155,
+127,94,31,31,94,127,254,37,199,249,122,0,3,0,200,254,12,4,226,4,176,0,19,
+0,24,0,59,0,0,1,22,51,51,21,35,34,39,6,33,33,53,33,32,53,35,53,33,21,20,1,
+21,50,53,52,1,52,55,54,51,50,23,54,51,50,23,22,21,17,35,17,52,35,34,7,6,35,
+34,39,38,35,34,21,17,50,21,20,35,34,53,4,56,47,43,80,80,96,99,149,254,186,
+254,212,1,44,1,156,112,1,44,253,56,92,254,232,75,75,95,94,111,112,95,94,75,
+74,188,72,49,82,27,32,32,27,81,49,73,210,210,188,254,226,94,120,94,94,120,
+200,130,130,58,2,36,172,111,61,2,101,113,82,82,124,124,82,82,113,252,101,
+3,155,127,94,31,31,94,127,254,37,199,249,122,0,1,0,100,0,0,4,76,6,4,0,31,
+0,0,19,51,21,20,22,51,33,32,17,17,35,39,7,35,17,52,35,53,51,50,21,17,37,5,
+17,52,35,35,34,39,38,53,200,188,72,70,1,29,1,29,218,231,232,219,100,150,138,
+1,7,1,5,191,191,158,83,89,6,4,224,50,66,254,209,252,127,210,210,2,250,41,
+144,144,253,131,239,238,2,218,165,70,61,123,0,4,0,200,254,12,4,76,4,176,0,
+2,0,7,0,16,0,64,0,0,5,23,53,1,21,50,53,52,3,21,20,51,50,55,54,53,53,1,52,
+55,54,51,50,23,54,51,50,23,22,21,17,20,6,35,39,20,7,6,35,32,53,53,36,36,53,
+17,52,35,34,7,6,35,34,39,38,35,34,21,17,50,21,20,35,34,53,2,158,242,253,244,
+92,97,86,72,28,27,254,116,75,75,95,94,111,112,95,94,75,74,119,165,110,56,
+54,130,254,246,1,30,1,170,72,49,82,27,32,32,27,81,49,73,210,210,188,246,36,
+97,1,239,172,111,61,253,142,40,39,23,21,30,56,4,164,113,82,82,124,124,82,
+82,113,251,82,57,57,26,47,45,45,140,141,51,84,34,3,205,127,94,31,31,94,127,
+254,37,199,249,122,0,0,2,0,100,255,206,4,156,5,220,0,48,0,68,0,0,19,37,36,
+53,52,39,38,35,34,7,6,21,20,51,21,35,34,53,53,52,55,54,51,50,23,22,21,16,
+5,7,21,20,22,51,50,36,53,53,51,17,35,53,6,7,6,35,34,38,53,19,7,6,21,20,23,
+23,7,39,38,53,52,55,55,33,50,19,7,38,35,200,1,100,1,100,58,59,145,145,58,
+59,100,150,138,100,100,250,250,100,100,253,234,178,57,70,70,1,71,188,188,
+15,17,220,160,160,140,63,21,5,67,10,136,6,72,18,140,2,110,250,50,138,50,112,
+2,74,50,51,190,92,47,46,46,47,72,34,144,144,34,118,93,92,92,93,138,254,210,
+76,26,150,92,93,203,62,77,253,238,203,10,10,133,185,138,4,15,25,5,8,32,76,
+12,90,8,92,41,37,25,183,254,234,60,200,0,1,0,200,0,0,4,126,4,176,0,50,0,0,
+1,7,39,1,33,53,33,23,23,22,21,20,15,2,22,21,21,20,7,6,35,34,39,38,53,17,52,
+55,54,51,32,23,7,38,35,34,7,6,21,17,20,23,22,51,50,55,54,53,53,52,3,138,106,
+113,1,79,254,134,1,122,75,37,16,31,52,24,57,100,100,250,250,100,100,100,100,
+225,1,29,140,76,119,230,120,58,59,59,58,145,145,59,58,1,197,93,105,1,41,138,
+98,49,20,21,28,29,50,23,78,104,77,138,93,92,92,93,138,2,42,138,93,92,92,122,
+76,46,47,92,253,214,92,47,46,46,47,92,77,29,0,2,0,100,255,206,4,156,7,98,
+0,48,0,77,0,0,19,37,36,53,52,39,38,35,34,7,6,21,20,51,21,35,34,53,53,52,55,
+54,51,50,23,22,21,16,5,7,21,20,22,51,50,36,53,53,51,17,35,53,6,7,6,35,34,
+38,53,1,33,7,6,21,20,23,23,7,39,38,53,52,55,55,33,38,53,52,55,23,6,21,20,
+23,23,22,23,7,200,1,100,1,100,58,59,145,145,58,59,100,150,138,100,100,250,
+250,100,100,253,234,178,57,70,70,1,71,188,188,15,17,220,160,160,140,2,163,
+253,156,21,5,67,10,136,6,72,18,140,1,247,61,96,134,76,27,63,193,43,126,2,
+74,50,51,190,92,47,46,46,47,72,34,144,144,34,118,93,92,92,93,138,254,210,
+76,26,150,92,93,203,62,77,253,238,203,10,10,133,185,138,4,15,25,5,8,32,76,
+12,90,8,92,41,37,25,183,82,86,107,115,67,105,73,43,32,75,32,241,75,0,0,1,
+255,56,0,0,1,132,4,176,0,11,0,0,19,50,22,21,17,35,17,52,38,35,33,53,68,168,
+152,188,57,75,254,244,4,176,132,131,252,87,3,169,72,53,138,0,0,2,251,230,
+5,120,255,56,7,8,0,10,0,17,0,0,1,52,54,51,50,23,22,23,21,33,34,18,6,21,33,
+38,38,35,251,230,160,150,149,141,140,110,253,18,100,220,70,1,252,112,176,
+60,6,14,100,150,75,75,100,150,1,14,60,80,80,60,0,2,251,230,5,120,255,56,7,
+58,0,6,0,19,0,0,0,21,33,38,38,35,34,1,33,34,53,52,54,51,50,23,22,23,53,51,
+252,124,1,252,112,176,60,90,2,118,253,18,100,160,150,149,141,59,53,138,6,
+74,80,80,60,254,242,150,100,150,75,31,36,192,0,3,251,230,5,120,255,56,7,108,
+0,6,0,30,0,47,0,0,0,21,33,38,38,35,34,5,22,23,21,33,34,53,52,54,51,50,23,
+54,55,54,54,51,50,22,22,21,20,7,6,39,54,55,54,53,52,38,38,35,34,6,7,6,7,22,
+23,22,252,124,1,252,112,176,60,90,2,80,20,18,253,18,100,160,150,78,75,5,6,
+27,96,51,51,96,55,26,6,97,2,2,11,24,41,23,22,42,12,1,1,15,15,64,6,74,80,80,
+60,87,16,17,150,150,100,150,20,10,11,48,51,51,97,52,52,47,10,60,3,3,20,23,
+23,41,23,23,20,2,2,7,8,34,0,2,251,230,5,120,255,56,7,108,0,6,0,22,0,0,0,21,
+33,38,38,35,34,37,53,51,21,22,23,53,51,17,33,34,53,52,54,51,50,252,124,1,
+252,112,176,60,90,1,16,138,42,40,138,253,18,100,160,150,93,6,74,80,80,60,
+101,129,192,24,26,192,254,62,150,100,150,0,0,1,254,19,254,12,255,56,255,186,
+0,5,0,0,7,17,35,17,35,53,200,188,105,70,254,82,1,74,100,0,0,1,252,224,254,
+12,255,56,255,186,0,13,0,0,5,51,21,20,51,50,53,53,51,21,20,33,32,53,252,224,
+178,122,122,178,254,212,254,212,70,220,90,90,220,220,210,210,0,1,252,174,
+254,12,255,56,255,186,0,11,0,0,5,51,17,55,23,17,51,17,35,39,7,35,252,174,
+178,147,147,178,200,125,125,200,70,254,222,130,130,1,34,254,82,130,130,0,
+0,2,251,230,5,120,255,56,7,58,0,6,0,19,0,0,0,21,33,38,38,35,34,1,33,34,53,
+52,54,51,50,23,22,23,53,51,252,124,1,252,112,176,60,90,2,118,253,18,100,160,
+150,149,141,59,53,138,6,74,80,80,60,254,242,150,100,150,75,31,36,192,0,2,
+253,248,254,12,1,132,7,108,0,6,0,41,0,0,1,33,38,38,35,34,6,5,22,21,17,20,
+33,32,53,53,51,21,35,21,20,51,50,53,17,52,35,33,34,53,52,54,51,50,23,53,51,
+21,22,23,53,51,254,142,1,122,112,176,30,40,20,2,58,188,254,124,254,124,238,
+50,200,200,200,254,92,100,110,100,63,89,138,42,40,138,5,250,80,60,60,110,
+67,223,250,66,240,240,210,110,100,100,100,5,190,190,150,100,150,29,129,192,
+24,26,192,0,0,1,254,124,254,12,1,132,7,108,0,26,0,0,1,51,17,54,51,32,17,17,
+20,33,32,53,53,51,21,35,21,20,51,50,53,17,52,35,34,7,35,254,124,188,95,105,
+1,132,254,124,254,124,238,50,200,200,200,200,60,128,7,108,254,164,58,254,
+152,250,26,240,240,210,110,100,100,100,5,230,230,80,0,1,0,59,0,0,2,36,4,176,
+0,20,0,0,37,20,51,51,21,35,34,53,17,39,39,38,53,52,63,2,51,21,35,23,1,132,
+75,85,198,150,80,40,21,19,37,75,248,248,198,185,47,138,102,2,192,99,50,25,
+25,24,24,49,98,138,222,0,0,2,0,0,0,0,2,68,6,214,0,13,0,34,0,0,17,52,33,21,
+34,21,20,51,50,17,51,16,33,32,1,20,51,51,21,35,34,53,17,39,39,38,53,52,63,
+2,51,21,35,23,1,11,117,111,169,150,254,193,254,251,1,132,75,85,198,150,80,
+40,21,19,37,75,248,248,198,5,210,180,130,50,60,1,64,254,62,251,165,47,138,
+102,2,192,99,50,25,25,24,24,49,98,138,222,0,2,0,0,0,0,2,36,7,108,0,22,0,43,
+0,0,0,53,52,35,34,21,35,53,52,35,53,50,21,21,54,51,50,21,20,35,35,53,51,19,
+20,51,51,21,35,34,53,17,39,39,38,53,52,63,2,51,21,35,23,1,134,80,110,150,
+50,200,55,55,230,240,250,250,88,75,85,198,150,80,40,21,19,37,75,248,248,198,
+5,150,75,75,50,170,50,150,150,80,30,195,205,130,251,35,47,138,102,2,192,99,
+50,25,25,24,24,49,98,138,222,0,0,1,255,56,0,0,1,132,4,176,0,11,0,0,19,50,
+22,21,17,35,17,52,38,35,33,53,68,168,152,188,57,75,254,244,4,176,132,131,
+252,87,3,169,72,53,138,0,0,2,255,56,0,0,1,132,6,214,0,11,0,23,0,0,19,52,38,
+35,35,53,51,50,22,21,17,39,7,50,22,21,17,35,17,52,38,35,33,53,200,27,45,128,
+128,158,102,188,132,168,152,188,57,75,254,244,6,1,42,33,138,112,101,254,212,
+2,39,132,131,252,87,3,169,72,53,138,0,2,252,149,5,20,254,87,6,214,0,15,0,
+31,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,
+35,34,38,38,53,52,54,54,253,95,43,24,24,43,23,23,44,23,24,43,23,57,107,61,
+59,107,59,58,107,60,61,107,6,79,23,44,23,23,44,23,23,44,23,23,44,23,135,58,
+108,59,59,107,59,59,107,59,59,108,58,0,0,4,0,200,0,0,2,138,4,176,0,15,0,31,
+0,47,0,63,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,18,6,6,21,20,22,22,51,50,54,54,53,52,38,38,
+35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,146,43,24,24,43,23,23,
+44,23,24,43,23,57,107,61,59,107,59,58,107,60,61,107,34,43,24,24,43,23,23,
+44,23,24,43,23,57,107,61,59,107,59,58,107,60,61,107,1,59,23,44,23,23,44,23,
+23,44,23,23,44,23,135,58,108,59,59,107,59,59,107,59,59,108,58,2,103,23,44,
+23,23,44,23,23,44,23,23,44,23,135,58,108,59,59,107,59,59,107,59,59,108,58,
+0,0,2,0,180,0,115,1,124,4,41,0,15,0,31,0,0,1,50,22,22,21,20,6,6,35,34,38,
+38,53,52,54,54,19,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,24,26,47,27,
+26,48,26,26,47,27,27,47,26,26,47,27,26,48,26,26,47,27,27,47,1,59,26,48,26,
+26,48,26,26,48,26,26,48,26,2,238,26,48,26,26,48,26,26,48,26,26,48,26,0,0,
+2,252,144,5,20,254,92,6,164,0,3,0,7,0,0,1,17,51,17,51,17,51,17,252,144,150,
+160,150,5,20,1,144,254,112,1,144,254,112,0,0,1,251,180,5,20,255,56,5,170,
+0,6,0,0,1,53,33,23,55,33,21,251,180,1,117,77,78,1,116,5,20,150,100,100,150,
+0,0,1,253,43,5,20,253,193,6,164,0,3,0,0,1,17,51,17,253,43,150,5,20,1,144,
+254,112,0,0,1,252,19,5,20,254,217,7,14,0,22,0,0,1,39,54,54,55,23,6,6,7,54,
+51,50,23,22,23,7,38,39,38,35,34,7,6,252,101,82,155,203,31,121,44,55,51,25,
+26,56,66,96,81,115,81,126,42,34,69,38,57,5,29,107,84,212,94,39,116,80,50,
+4,15,21,98,91,100,13,4,17,27,0,0,1,251,230,5,20,255,6,7,8,0,18,0,0,0,51,51,
+21,35,34,53,52,33,51,50,53,51,21,20,33,35,34,21,252,122,95,65,65,243,1,11,
+222,164,147,254,201,222,119,5,130,110,155,195,150,50,230,65,0,0,1,252,99,
+5,20,254,137,7,7,0,11,0,0,1,51,21,35,21,35,53,35,53,51,53,51,253,193,200,
+200,150,200,200,150,6,82,137,181,181,137,181,0,0,1,251,230,5,20,255,6,7,8,
+0,24,0,0,0,51,51,32,53,51,21,20,35,33,34,21,21,55,23,53,51,21,35,39,7,39,
+21,35,53,251,230,250,136,1,8,150,220,254,182,99,249,250,150,180,221,217,1,
+181,6,168,96,38,174,86,87,112,113,98,212,93,93,1,1,202,0,1,253,68,5,120,0,
+100,7,8,0,15,0,0,1,52,33,51,21,35,34,21,20,51,32,17,51,16,33,32,253,68,1,
+11,44,47,114,241,1,3,150,254,103,254,121,6,64,190,130,60,70,1,14,254,112,
+0,0,1,251,230,5,20,255,6,5,170,0,3,0,0,1,53,33,21,251,230,3,32,5,20,150,150,
+0,1,252,99,254,12,254,137,255,206,0,11,0,0,5,51,21,35,21,35,53,35,53,51,53,
+51,253,193,200,200,150,200,200,150,214,122,164,164,122,164,0,2,251,230,5,
+20,255,6,7,8,0,15,0,31,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,39,
+50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,253,65,104,59,59,104,54,57,104,
+56,59,101,57,1,102,190,108,104,192,104,102,190,108,108,192,6,131,31,56,30,
+30,56,31,31,56,30,30,56,31,133,64,121,65,65,119,66,66,119,65,65,121,64,0,
+1,0,200,0,0,3,232,4,176,0,19,0,0,0,21,20,51,50,55,55,51,17,35,17,6,35,32,
+53,52,51,51,21,35,1,132,78,177,85,84,188,188,109,237,254,246,242,53,53,4,
+38,42,82,131,131,251,80,3,178,146,220,180,138,0,0,2,0,200,0,0,5,20,4,176,
+0,19,0,23,0,0,0,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,37,
+17,35,17,1,132,78,177,85,84,188,188,109,237,254,246,242,53,53,3,90,188,4,
+38,42,82,131,131,251,80,3,178,146,220,180,138,138,251,80,4,176,0,0,5,0,100,
+0,0,2,238,4,176,0,15,0,31,0,47,0,63,0,67,0,0,0,6,6,21,20,22,22,51,50,54,54,
+53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,18,6,6,21,20,
+22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,
+54,54,1,21,33,53,1,146,43,24,24,43,23,23,44,23,24,43,23,57,107,61,59,107,
+59,58,107,60,61,107,34,43,24,24,43,23,23,44,23,24,43,23,57,107,61,59,107,
+59,58,107,60,61,107,1,126,253,118,1,59,23,44,23,23,44,23,23,44,23,23,44,23,
+135,58,108,59,59,107,59,59,107,59,59,108,58,2,103,23,44,23,23,44,23,23,44,
+23,23,44,23,135,58,108,59,59,107,59,59,107,59,59,108,58,253,237,138,138,0,
+0,1,0,150,254,112,3,232,4,176,0,32,0,0,1,6,35,34,39,38,35,34,21,21,20,51,
+21,35,34,53,53,52,54,51,50,23,22,51,50,55,51,17,16,33,53,32,53,3,44,103,84,
+64,53,48,69,53,100,150,138,110,115,114,111,14,17,69,112,188,254,62,1,6,3,
+225,89,52,94,77,26,34,144,144,60,63,164,154,10,164,251,0,254,192,138,182,
+0,4,0,200,0,0,16,4,4,176,0,19,0,39,0,44,0,96,0,0,1,20,51,50,55,55,51,17,35,
+17,6,35,32,53,52,51,51,21,35,34,5,20,51,50,55,55,51,17,35,17,6,35,32,53,52,
+51,51,21,35,34,1,21,50,53,52,1,52,55,54,51,50,23,22,21,17,20,22,51,50,54,
+53,17,39,39,38,53,52,63,2,51,21,35,23,17,20,6,35,34,38,53,17,52,39,38,35,
+34,7,6,21,17,50,21,20,35,34,53,13,160,78,177,85,84,188,188,109,237,254,246,
+242,53,53,54,243,228,78,177,85,84,188,188,109,237,254,246,242,53,53,54,4,
+176,92,254,232,100,100,225,225,100,100,117,114,114,117,105,52,31,16,37,75,
+248,248,248,212,213,213,200,58,59,120,120,58,59,210,210,188,3,252,82,131,
+131,251,80,3,178,146,220,180,138,42,82,131,131,251,80,3,178,146,220,180,138,
+253,16,172,111,61,2,55,138,93,92,92,93,138,253,214,92,93,93,92,1,227,99,50,
+29,28,21,20,49,98,138,222,253,251,161,162,185,138,2,42,92,47,46,46,47,92,
+254,83,199,249,122,0,4,0,200,0,0,5,20,4,176,0,7,0,15,0,23,0,31,0,0,33,32,
+17,16,33,32,17,16,1,32,17,16,33,32,17,16,1,32,17,16,33,32,17,16,1,34,17,16,
+51,50,17,16,2,238,253,218,2,38,2,38,253,218,254,100,1,156,1,157,254,99,254,
+237,1,19,1,19,254,237,137,137,138,2,88,2,88,253,168,253,168,4,76,254,12,254,
+12,1,244,1,244,252,124,1,144,1,144,254,112,254,112,2,188,254,212,254,212,
+1,44,1,44,0,0,1,0,200,0,0,10,140,4,176,0,46,0,0,1,32,17,20,33,34,53,52,51,
+50,53,52,35,34,21,17,20,51,50,54,55,19,51,1,19,51,19,55,51,50,21,20,35,35,
+3,35,3,3,35,1,3,0,33,32,17,17,16,2,63,1,123,254,199,63,63,185,248,253,253,
+125,251,125,246,126,1,57,186,125,188,126,250,61,61,188,125,126,187,187,125,
+254,199,209,254,236,254,184,254,137,4,176,254,183,216,54,54,110,218,218,253,
+222,221,241,251,1,233,252,229,2,174,253,198,245,55,55,254,187,2,33,253,114,
+3,77,254,101,253,225,1,71,2,34,1,71,0,1,0,12,0,0,1,232,4,176,0,27,0,0,1,17,
+20,35,35,53,50,53,17,35,53,51,53,39,39,38,53,52,63,2,51,21,35,23,21,51,21,
+1,132,150,179,141,150,150,105,52,31,16,37,75,248,248,248,100,2,19,254,83,
+102,138,47,1,90,138,137,99,50,29,28,21,20,49,98,138,222,171,138,0,0,2,0,200,
+0,0,4,76,4,176,0,9,0,19,0,0,36,33,32,53,17,52,33,32,21,17,3,16,33,32,17,17,
+16,33,32,17,1,132,1,6,1,6,254,250,254,250,188,1,194,1,194,254,62,254,62,138,
+242,1,184,242,242,254,72,1,184,1,124,254,132,254,72,254,132,1,124,0,0,1,0,
+200,0,0,4,76,4,176,0,27,0,0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,
+33,32,17,17,16,33,32,17,51,20,33,32,3,144,254,250,254,250,127,135,135,254,
+197,1,194,1,194,254,62,254,62,188,1,6,1,6,1,64,2,48,182,182,120,80,160,240,
+120,1,64,254,192,253,208,254,192,1,64,182,0,1,0,100,0,0,5,58,5,170,0,27,0,
+0,1,16,33,32,17,17,35,53,51,50,21,17,16,33,32,17,17,7,39,17,51,21,35,17,51,
+23,55,51,5,58,253,199,253,199,100,100,188,1,125,1,125,210,200,50,248,198,
+200,210,188,1,144,254,112,1,144,3,132,150,150,252,124,254,250,1,6,2,120,174,
+174,254,230,150,2,88,174,174,0,1,0,200,0,0,6,28,4,176,0,26,0,0,33,35,17,52,
+35,34,21,17,51,21,33,17,16,33,50,23,54,51,32,17,17,35,17,52,35,34,21,3,208,
+188,200,200,100,254,224,1,132,199,94,94,201,1,132,188,200,200,3,72,222,222,
+253,66,138,3,82,1,94,89,89,254,152,252,184,3,72,222,222,0,0,1,0,100,0,0,4,
+76,5,180,0,23,0,0,36,33,33,1,17,52,54,51,51,21,35,17,19,7,33,32,17,17,35,
+53,51,50,21,17,1,132,1,6,1,64,254,242,100,100,200,212,212,50,254,112,254,
+62,100,100,188,138,1,54,1,96,75,63,138,254,210,254,152,138,1,144,3,132,160,
+150,252,114,0,1,0,200,0,0,4,76,6,34,0,47,0,0,1,20,33,33,39,53,52,54,51,51,
+21,35,17,19,7,33,32,17,17,52,55,54,55,38,53,52,51,50,21,20,7,22,51,50,54,
+53,17,51,17,20,7,6,35,34,39,6,6,21,1,132,1,6,1,44,250,100,88,212,212,212,
+52,254,114,254,62,125,22,21,68,180,190,75,101,74,70,72,188,89,83,158,156,
+142,36,48,1,74,192,230,232,75,125,138,254,248,254,252,138,1,74,2,48,147,53,
+10,7,57,62,144,144,52,51,30,66,50,1,105,254,151,123,61,70,49,19,46,49,0,0,
+1,0,200,0,0,4,76,6,14,0,28,0,0,19,51,17,54,51,32,17,17,16,33,32,17,16,33,
+51,21,35,34,21,20,33,32,17,17,16,33,32,21,35,200,188,128,134,1,194,254,62,
+254,62,1,94,150,150,162,1,6,1,6,254,250,254,250,188,6,14,254,108,54,254,112,
+254,112,254,112,1,94,1,94,138,212,212,1,6,1,144,1,6,202,0,1,0,200,0,0,5,120,
+5,220,0,38,0,0,37,51,17,51,17,20,33,32,53,17,52,35,34,7,6,35,34,39,38,35,
+34,21,17,51,21,33,17,52,55,54,51,50,23,54,51,50,23,22,21,4,26,162,188,254,
+237,254,249,58,46,77,26,30,30,26,76,46,59,162,254,162,71,71,89,89,105,106,
+90,88,71,70,138,5,82,250,174,138,138,3,17,127,94,31,31,94,127,252,239,138,
+3,155,113,82,82,124,124,82,82,113,0,1,0,200,0,0,4,76,6,14,0,28,0,0,19,16,
+33,50,23,17,51,17,35,52,33,32,21,17,37,5,17,52,35,35,53,51,50,21,17,35,39,
+7,35,200,1,194,134,128,188,188,254,250,254,250,1,7,1,5,52,180,180,240,218,
+231,232,219,3,112,1,64,54,1,148,253,98,182,182,253,54,239,238,1,97,80,150,
+230,253,248,210,210,0,1,0,200,0,0,4,76,5,230,0,39,0,0,1,51,17,35,52,33,32,
+21,20,33,33,21,33,32,21,21,20,33,32,53,52,35,35,53,51,32,21,16,33,32,17,53,
+54,55,38,39,16,33,50,23,3,144,188,188,254,250,254,250,1,6,1,44,254,212,254,
+250,1,6,1,6,162,100,100,1,94,254,62,254,62,39,99,99,39,1,194,134,128,5,230,
+253,200,120,160,122,138,116,226,162,160,100,128,233,254,219,1,44,226,146,
+43,44,143,1,42,38,0,1,251,230,254,12,255,6,255,206,0,21,0,0,1,52,55,54,51,
+50,23,22,21,21,35,53,52,39,38,35,34,7,6,21,21,35,251,230,89,89,222,222,89,
+89,167,52,52,129,129,51,53,167,254,229,99,68,66,66,68,99,217,217,66,34,33,
+33,34,66,217,0,0,1,251,230,254,12,255,6,255,206,0,28,0,0,5,35,34,53,53,52,
+33,32,21,20,4,21,20,51,50,53,55,21,20,33,32,53,53,52,36,53,52,35,34,252,152,
+104,74,1,144,1,144,253,146,222,222,178,254,112,254,112,2,110,222,222,206,
+26,25,105,119,96,81,28,51,82,40,62,135,113,51,52,66,43,50,0,0,1,251,230,254,
+12,255,6,255,206,0,25,0,0,1,55,23,7,21,35,53,52,55,54,51,50,23,22,21,21,35,
+53,52,39,38,35,34,7,6,21,252,141,181,72,253,167,89,89,222,222,89,89,167,52,
+52,129,129,51,53,254,197,80,105,141,19,217,99,68,66,66,68,99,217,217,66,34,
+33,33,34,66,0,1,253,148,254,12,1,132,4,176,0,37,0,0,5,16,33,34,39,6,35,32,
+17,53,35,53,51,21,20,51,50,53,53,51,21,20,51,50,53,17,39,39,38,53,52,63,2,
+51,21,35,23,1,132,254,224,112,87,78,113,254,232,50,230,100,100,180,110,100,
+105,52,31,16,37,75,248,248,248,237,254,249,57,57,1,7,97,90,187,113,113,187,
+187,113,113,4,19,99,50,29,28,21,20,49,98,138,222,0,0,1,251,230,254,12,255,
+6,255,206,0,14,0,0,1,32,53,52,33,51,21,34,21,20,51,32,17,51,16,253,72,254,
+158,1,11,89,189,187,1,23,167,254,12,210,195,120,75,80,1,64,254,62,0,1,251,
+181,254,12,255,57,255,206,0,59,0,0,1,22,23,22,21,7,53,52,39,6,7,6,7,6,35,
+35,34,39,38,39,38,53,52,55,54,55,54,54,55,55,23,7,6,6,7,22,51,50,55,54,55,
+54,55,38,39,38,53,52,55,54,51,51,50,23,22,23,21,20,7,6,254,200,49,30,34,149,
+66,33,42,62,74,73,85,8,96,60,103,24,25,6,18,77,93,88,11,15,167,13,16,107,
+89,42,43,36,39,80,50,15,13,20,8,37,17,40,101,6,56,61,52,2,29,10,254,215,18,
+21,28,120,16,18,73,24,22,23,34,18,16,14,16,29,33,30,14,14,43,35,43,78,34,
+65,58,47,51,119,35,8,6,14,26,8,9,9,8,20,35,22,29,70,30,26,39,5,36,27,11,0,
+0,1,251,78,254,12,255,6,255,206,0,41,0,0,5,51,21,50,23,22,23,22,51,50,55,
+54,53,53,35,53,33,17,20,6,35,34,38,38,35,35,21,20,35,34,39,38,39,38,39,38,
+53,52,55,54,51,51,251,229,178,57,58,59,62,59,68,5,4,73,89,1,11,128,96,62,
+147,118,46,26,104,89,53,55,19,4,1,4,23,38,41,49,50,202,21,21,42,42,1,2,63,
+150,112,254,250,111,77,59,69,63,65,28,28,54,11,9,16,14,34,20,34,0,0,1,251,
+189,254,12,255,199,255,206,0,53,0,0,7,51,21,35,6,7,6,35,34,39,6,35,34,39,
+38,39,38,39,38,53,53,52,55,54,51,51,21,35,34,7,6,21,20,23,22,51,50,54,51,
+50,22,51,50,55,38,38,53,53,52,54,51,50,23,22,199,142,151,13,28,46,119,105,
+103,65,138,133,65,35,16,5,4,8,51,53,106,103,64,72,16,9,6,54,43,69,103,26,
+25,112,95,55,7,115,69,64,57,86,57,59,172,144,70,42,70,88,90,68,36,51,16,16,
+35,40,17,84,43,44,131,28,16,22,18,22,69,90,90,61,9,78,60,3,47,48,41,41,0,
+1,252,184,254,12,1,132,4,176,0,45,0,0,19,39,39,38,53,52,63,2,51,21,35,23,
+17,16,33,34,39,6,35,34,17,52,35,34,21,21,51,21,33,17,52,33,32,21,20,51,50,
+53,53,51,21,20,51,50,53,200,105,52,31,16,37,75,248,248,248,254,224,102,77,
+78,93,250,80,80,80,254,252,1,4,1,4,75,75,180,95,95,3,38,99,50,29,28,21,20,
+49,98,138,222,251,203,254,249,57,57,1,7,75,75,150,113,1,7,187,187,113,113,
+187,187,113,113,0,1,251,130,254,12,255,56,255,156,0,17,0,0,5,51,50,23,22,
+51,50,53,35,53,33,21,20,33,34,36,35,35,251,130,83,205,131,131,140,110,188,
+1,82,254,252,186,254,245,110,127,140,108,116,124,140,160,240,200,0,2,249,
+42,254,12,255,56,255,206,0,16,0,34,0,0,1,33,32,4,51,50,53,35,53,33,21,20,
+33,34,36,35,33,1,21,35,53,33,21,35,53,7,37,21,51,21,33,53,51,5,55,249,42,
+1,26,1,71,1,219,139,139,197,1,129,254,136,233,254,85,232,254,230,6,14,188,
+254,50,187,243,254,230,84,254,240,188,1,26,243,254,166,92,31,77,66,104,57,
+1,137,249,144,144,145,86,86,53,92,249,87,87,0,0,1,251,230,254,12,255,6,255,
+206,0,27,0,0,1,52,55,54,51,50,23,22,21,21,35,53,52,39,38,35,34,7,6,21,21,
+20,51,51,21,35,34,53,251,230,89,89,222,222,89,89,167,52,52,129,129,51,53,
+54,133,221,133,254,229,99,68,66,66,68,99,217,217,66,34,33,33,34,66,83,34,
+100,114,0,0,2,251,228,254,21,255,99,0,0,0,12,0,17,0,0,5,33,53,51,21,51,21,
+35,17,35,39,7,35,37,53,33,21,55,251,228,2,115,179,89,89,179,224,224,179,2,
+115,254,64,224,82,82,82,123,254,226,106,106,155,131,131,91,0,1,251,230,254,
+12,255,6,255,206,0,24,0,0,7,20,5,21,37,53,51,21,35,53,5,35,53,36,53,53,7,
+39,21,35,53,51,23,55,51,250,253,146,1,188,178,178,254,68,178,2,110,222,222,
+178,178,222,222,178,228,52,74,48,50,40,188,60,60,216,66,35,28,49,49,66,171,
+66,66,0,0,1,251,230,254,12,1,132,4,176,0,36,0,0,3,21,35,17,7,39,21,51,21,
+33,17,51,23,55,51,21,51,50,23,17,39,39,38,53,52,63,2,51,21,35,23,17,35,52,
+38,35,250,178,222,222,89,254,245,178,222,222,178,150,147,153,105,52,31,16,
+37,75,248,248,248,188,204,96,254,122,110,1,55,117,117,198,113,1,194,118,118,
+240,39,4,111,99,50,29,28,21,20,49,98,138,222,250,196,57,53,0,0,1,246,222,
+254,12,255,56,255,206,0,33,0,0,4,35,34,21,21,51,21,33,17,52,33,32,21,21,55,
+23,53,52,33,32,21,17,35,17,52,35,34,21,17,35,39,7,35,17,249,104,218,244,100,
+254,224,1,172,1,154,231,231,1,154,1,172,188,240,222,188,231,231,188,162,75,
+150,113,1,7,187,180,127,105,105,127,180,187,254,249,1,7,75,75,254,249,120,
+120,1,7,0,1,251,230,254,12,255,6,255,206,0,27,0,0,1,52,55,54,51,50,23,22,
+21,21,35,53,52,39,38,35,34,7,6,21,21,20,51,51,21,35,34,53,251,230,89,89,222,
+222,89,89,167,52,52,129,129,51,53,54,133,221,133,254,229,99,68,66,66,68,99,
+217,217,66,34,33,33,34,66,83,34,100,114,0,0,1,251,180,254,12,255,56,255,206,
+0,18,0,0,3,35,34,39,38,35,34,21,21,51,21,33,53,16,33,50,18,51,51,200,78,175,
+174,59,93,151,162,254,180,1,75,161,236,94,78,254,12,237,74,134,45,131,176,
+1,17,254,196,0,0,1,251,230,254,12,255,6,255,206,0,20,0,0,4,53,35,53,33,21,
+20,7,5,21,37,21,20,35,35,55,53,5,35,53,37,254,84,100,1,22,204,254,94,2,110,
+130,115,58,254,76,177,1,211,160,35,75,74,104,21,51,60,65,122,83,41,42,42,
+246,38,0,0,3,251,230,254,12,255,6,255,206,0,15,0,18,0,27,0,0,5,51,21,20,6,
+35,39,20,7,6,35,34,53,53,54,36,7,23,53,5,21,20,51,50,55,54,53,53,254,96,166,
+106,146,98,50,48,116,236,254,1,124,216,216,254,40,77,64,25,24,50,225,57,57,
+26,47,45,45,140,141,51,84,162,36,97,131,40,39,23,21,30,56,0,0,2,251,180,254,
+12,255,106,255,206,0,28,0,37,0,0,1,34,53,52,33,33,53,51,21,51,21,35,21,50,
+23,22,21,20,7,6,35,34,39,38,53,5,35,6,6,39,20,51,50,55,37,53,33,34,252,174,
+250,1,44,1,94,150,150,150,50,25,25,31,32,62,62,31,32,254,212,27,8,13,152,
+100,73,27,1,44,254,162,150,254,70,157,155,80,80,100,80,31,31,38,38,26,26,
+33,32,25,30,1,1,157,58,3,30,80,0,1,254,120,254,22,1,132,4,176,0,24,0,0,5,
+33,21,35,21,55,23,17,39,39,38,53,52,63,2,51,21,35,23,17,35,39,7,35,254,120,
+1,32,100,203,201,105,52,31,16,37,75,248,248,248,218,171,172,219,50,94,200,
+154,153,4,125,99,50,29,28,21,20,49,98,138,222,250,206,125,125,0,0,1,251,230,
+254,12,255,6,255,206,0,13,0,0,3,35,39,7,35,17,51,17,55,23,53,35,53,33,250,
+178,222,222,178,178,222,222,133,1,55,254,12,132,132,1,194,254,207,132,132,
+185,120,0,0,1,251,230,254,12,255,6,255,206,0,13,0,0,3,35,17,7,39,21,51,21,
+33,17,51,23,55,51,250,178,222,222,89,254,245,178,222,222,178,254,12,1,55,
+117,117,198,113,1,194,118,118,0,0,1,251,123,254,12,255,6,255,206,0,23,0,0,
+1,33,53,51,53,52,55,54,51,50,23,22,21,21,35,53,52,39,38,35,34,7,6,21,252,
+141,254,238,107,89,89,222,222,89,89,167,52,52,129,129,51,53,254,12,100,117,
+99,68,66,66,68,99,217,217,66,34,33,33,34,66,0,1,251,180,254,12,255,136,255,
+206,0,12,0,0,5,53,51,21,22,22,21,20,35,34,39,33,53,254,106,163,79,44,137,
+138,6,253,69,237,187,187,24,72,54,113,113,150,0,1,254,124,254,12,1,132,4,
+176,0,30,0,0,19,39,39,38,53,52,63,2,51,21,35,23,17,20,7,6,35,34,39,38,53,
+53,51,21,20,22,51,50,54,53,200,105,52,31,16,37,75,248,248,248,123,119,150,
+150,119,115,188,113,83,83,121,3,38,99,50,29,28,21,20,49,98,138,222,251,220,
+155,63,62,62,63,155,120,120,75,55,55,75,0,0,1,0,59,254,12,3,208,4,176,0,30,
+0,0,5,20,22,51,50,54,53,53,51,21,20,7,6,35,34,39,38,53,17,39,39,38,53,52,
+63,2,51,21,35,23,1,132,117,83,83,117,188,119,119,150,150,119,119,80,40,21,
+19,37,75,248,248,198,220,75,55,55,75,120,120,155,63,62,62,63,155,4,2,99,50,
+25,25,24,24,49,98,138,222,0,0,1,251,180,254,12,255,56,255,206,0,19,0,0,7,
+16,6,35,34,2,35,34,6,21,35,16,54,51,50,18,51,50,54,53,200,122,163,163,107,
+70,70,17,188,150,125,175,107,64,64,27,50,254,208,146,1,70,84,242,1,28,166,
+254,186,84,242,0,0,2,251,230,254,12,255,6,255,206,0,11,0,20,0,0,1,34,38,53,
+53,54,36,55,51,21,20,4,37,20,22,51,50,54,53,6,6,253,64,217,129,101,1,71,194,
+178,254,244,254,158,138,48,99,159,135,147,254,12,98,89,76,19,94,74,76,185,
+189,182,37,17,114,76,46,49,0,1,254,12,254,12,1,242,4,176,0,40,0,0,55,17,39,
+39,38,53,52,63,2,51,21,35,23,17,51,21,35,21,20,7,6,35,34,39,38,53,53,35,53,
+33,21,20,22,51,50,54,53,53,35,53,200,105,52,31,16,37,75,248,248,248,110,110,
+123,119,150,150,119,115,112,1,44,113,83,83,121,200,138,2,156,99,50,29,28,
+21,20,49,98,138,222,253,66,138,220,155,63,62,62,63,155,70,100,170,75,55,55,
+75,220,138,0,1,251,230,254,12,255,6,255,206,0,19,0,0,1,51,17,33,50,23,22,
+21,17,35,17,35,17,33,34,39,38,53,17,51,252,152,142,1,77,74,37,36,178,142,
+254,179,73,37,37,178,254,147,1,59,34,33,45,254,174,1,59,254,197,34,34,45,
+1,81,0,1,251,130,254,12,255,6,255,206,0,15,0,0,1,21,33,53,51,17,51,21,33,
+53,51,17,33,53,51,53,252,154,254,232,100,180,1,184,180,254,232,100,254,237,
+225,113,1,81,112,112,254,62,113,112,0,1,253,245,252,224,255,6,254,12,0,5,
+0,0,3,17,35,53,35,53,250,188,85,254,12,254,212,200,100,0,0,1,252,224,252,
+224,255,56,254,12,0,13,0,0,1,51,21,20,51,50,53,53,51,21,20,33,32,53,252,224,
+178,122,122,178,254,212,254,212,254,12,160,60,60,160,160,140,140,0,0,1,252,
+174,252,224,255,56,254,12,0,11,0,0,1,51,21,55,23,53,51,17,35,39,7,35,252,
+174,178,147,147,178,200,125,125,200,254,12,207,87,87,207,254,212,87,87,0,
+2,251,230,5,220,255,56,7,108,0,10,0,17,0,0,1,52,54,51,50,23,22,23,21,33,34,
+18,6,21,33,38,38,35,251,230,160,150,149,141,140,110,253,18,100,220,70,1,252,
+112,176,60,6,114,100,150,75,75,100,150,1,14,60,80,80,60,0,2,251,230,5,220,
+255,56,7,108,0,6,0,19,0,0,0,21,33,38,38,35,34,5,33,34,53,52,54,51,50,23,22,
+23,53,51,252,124,1,252,112,176,60,90,2,118,253,18,100,160,150,149,141,59,
+53,138,6,151,71,71,53,240,133,89,134,67,28,32,171,0,0,3,251,230,5,220,255,
+56,7,108,0,6,0,30,0,47,0,0,0,21,33,38,38,35,34,5,22,23,21,33,34,53,52,54,
+51,50,23,54,55,54,54,51,50,22,22,21,20,7,6,39,54,55,54,53,52,38,38,35,34,
+6,7,6,7,22,23,22,252,124,1,252,112,176,60,90,2,80,20,18,253,18,100,160,150,
+78,75,5,6,27,96,51,51,96,55,26,6,97,2,2,11,24,41,23,22,42,12,1,1,15,15,64,
+6,132,64,64,48,70,12,14,120,120,80,120,16,8,9,38,41,41,77,42,42,37,8,48,2,
+3,16,18,18,33,19,19,16,1,2,6,6,27,0,2,251,230,5,220,255,56,7,108,0,6,0,22,
+0,0,0,21,33,38,38,35,34,37,53,51,21,22,23,53,51,17,33,34,53,52,54,51,50,252,
+124,1,252,112,176,60,90,1,16,138,42,40,138,253,18,100,160,150,93,6,132,64,
+64,48,81,103,154,19,21,154,254,152,120,80,120,0,0,2,252,149,5,220,254,87,
+7,108,0,15,0,31,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,
+22,21,20,6,6,35,34,38,38,53,52,54,54,253,95,43,24,24,43,23,23,44,23,24,43,
+23,57,107,61,59,107,59,58,107,60,61,107,6,244,20,40,20,20,40,20,20,40,20,
+20,40,20,120,52,96,52,52,96,52,52,96,52,52,96,52,0,0,1,252,99,5,219,254,137,
+7,107,0,11,0,0,1,51,21,35,21,35,53,35,53,51,53,51,253,193,200,200,150,200,
+200,150,6,218,110,145,145,110,145,0,0,1,253,68,5,220,0,100,7,108,0,15,0,0,
+1,52,33,51,21,35,34,21,20,51,32,17,51,16,33,32,253,68,1,11,44,47,114,241,
+1,3,150,254,103,254,121,6,164,190,130,60,70,1,14,254,112,0,0,2,0,200,0,0,
+6,214,4,176,0,4,0,54,0,0,1,21,50,53,52,1,52,55,54,51,50,23,54,51,50,23,54,
+51,50,23,22,21,17,35,17,52,39,38,35,34,7,6,21,17,35,17,52,35,34,7,6,35,34,
+39,38,35,34,21,17,50,21,20,35,34,53,1,132,92,254,232,75,75,95,94,111,112,
+95,93,75,101,205,219,100,100,188,58,59,114,114,58,59,188,72,49,82,27,32,32,
+27,81,49,73,210,210,188,1,54,172,111,61,2,101,113,82,82,124,124,81,81,92,
+93,138,252,147,3,109,92,46,47,47,46,92,252,147,3,155,127,94,31,31,94,127,
+254,37,199,249,122,0,0,1,0,100,255,136,4,126,4,176,0,32,0,0,5,35,53,6,35,
+34,38,53,17,39,38,53,52,55,55,33,21,33,7,6,21,20,23,23,17,20,22,51,50,36,
+53,17,51,4,76,188,169,193,190,160,28,72,18,140,3,124,252,137,21,5,67,84,77,
+85,95,1,11,188,120,238,118,185,138,1,207,36,92,41,37,25,183,138,25,5,8,32,
+76,96,254,15,92,93,153,92,2,5,0,1,0,59,252,224,3,208,4,176,0,28,0,0,1,20,
+22,51,50,54,53,51,20,7,6,35,34,39,38,53,17,39,39,38,53,52,63,2,51,21,35,23,
+1,132,117,83,83,117,188,119,119,150,150,119,119,80,40,21,19,37,75,248,248,
+198,253,248,75,55,55,75,155,63,62,62,63,155,5,46,99,50,25,25,24,24,49,98,
+138,222,0,2,251,230,5,120,255,156,7,108,0,25,0,35,0,0,1,22,51,21,33,34,53,
+52,54,51,50,23,22,23,54,51,50,53,51,21,20,35,34,7,22,23,7,38,53,38,39,38,
+35,34,6,21,254,182,48,85,253,15,100,160,100,99,126,31,30,48,113,96,147,243,
+29,12,27,27,208,1,99,44,48,60,40,70,5,239,9,110,150,100,150,75,19,20,64,150,
+50,230,23,23,24,20,6,6,70,28,30,60,80,0,0,2,253,248,252,224,1,132,7,108,0,
+6,0,39,0,0,1,33,38,38,35,34,6,19,21,20,51,50,53,17,52,35,33,34,53,52,54,51,
+50,23,53,51,21,22,23,53,51,17,22,21,17,20,33,32,53,53,254,142,1,122,112,176,
+30,40,20,170,200,200,200,254,92,100,110,100,63,89,138,42,40,138,188,254,124,
+254,124,5,250,80,60,60,247,194,60,100,100,6,234,190,150,100,150,29,129,192,
+24,26,192,254,162,67,223,249,22,240,240,60,0,1,254,124,252,224,1,132,7,108,
+0,24,0,0,19,52,35,34,7,35,17,51,17,54,51,32,17,17,20,33,32,53,53,51,21,20,
+51,50,53,200,200,200,60,128,188,95,105,1,132,254,124,254,124,188,200,200,
+4,226,230,80,1,244,254,164,58,254,152,248,238,240,240,60,60,100,100,0,0,2,
+252,224,5,120,255,206,7,8,0,10,0,17,0,0,1,52,54,51,50,23,22,23,21,33,34,18,
+6,21,33,38,38,35,252,224,141,133,131,124,124,97,253,106,88,194,62,1,193,99,
+156,52,6,14,100,150,75,75,100,150,1,14,60,80,80,60,0,2,252,224,5,120,255,
+206,7,58,0,6,0,19,0,0,0,21,33,38,38,35,34,1,33,34,53,52,54,51,50,23,22,23,
+53,51,253,100,1,193,99,156,52,80,2,44,253,106,88,141,133,131,124,52,47,122,
+6,74,80,80,60,254,242,150,100,150,75,31,36,192,0,3,252,224,5,120,255,206,
+7,108,0,6,0,30,0,47,0,0,0,21,33,38,38,35,34,5,22,23,21,33,34,53,52,54,51,
+50,23,54,55,54,54,51,50,22,22,21,20,7,6,39,54,55,54,53,52,38,38,35,34,6,7,
+6,7,22,23,22,253,100,1,193,99,156,52,80,2,10,18,16,253,106,88,141,133,68,
+67,4,5,24,85,45,45,84,49,23,5,86,2,2,9,21,36,20,20,37,10,1,1,13,13,57,6,74,
+80,80,60,87,16,17,150,150,100,150,20,10,11,48,51,51,97,52,52,47,10,60,3,3,
+20,23,23,41,23,23,20,2,2,7,8,34,0,2,252,224,5,120,255,206,7,108,0,6,0,22,
+0,0,0,21,33,38,38,35,34,55,53,51,21,22,23,53,51,17,33,34,53,52,54,51,50,253,
+100,1,193,99,156,52,80,240,122,37,35,122,253,106,88,141,133,82,6,74,80,80,
+60,101,129,192,24,26,192,254,62,150,100,150,0,2,253,163,5,20,255,101,6,214,
+0,15,0,31,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,254,109,43,24,24,43,23,23,44,23,24,43,23,57,
+107,61,59,107,59,58,107,60,61,107,6,79,23,44,23,23,44,23,23,44,23,23,44,23,
+135,58,108,59,59,107,59,59,107,59,59,108,58,0,0,2,253,168,5,20,255,116,6,
+164,0,3,0,7,0,0,1,17,51,17,51,17,51,17,253,168,150,160,150,5,20,1,144,254,
+112,1,144,254,112,0,0,1,253,168,5,20,0,0,7,8,0,16,0,0,0,51,51,21,35,34,53,
+52,33,50,53,51,21,20,33,34,21,254,60,95,65,65,243,1,11,186,147,254,179,119,
+5,130,110,155,195,150,50,230,65,0,0,2,252,222,5,120,0,50,7,108,0,25,0,35,
+0,0,3,22,51,21,33,34,53,52,54,51,50,23,22,23,54,51,50,53,51,21,20,35,34,7,
+22,23,7,38,53,38,39,38,35,34,6,21,156,43,76,253,93,90,143,90,89,113,28,27,
+43,101,86,132,218,26,11,25,24,187,1,89,39,43,54,36,62,5,239,9,110,150,100,
+150,75,19,20,64,150,50,230,23,23,24,20,6,6,70,28,30,60,80,0,1,249,123,254,
+12,252,155,255,206,0,27,0,0,1,52,55,54,51,50,23,22,21,21,35,53,52,39,38,35,
+34,7,6,21,21,20,51,51,21,35,34,53,249,123,89,89,222,222,89,89,167,52,52,129,
+129,51,53,54,133,221,133,254,229,99,68,66,66,68,99,217,217,66,34,33,33,34,
+66,83,34,100,114,0,0,2,249,116,254,21,252,243,0,0,0,12,0,17,0,0,5,33,53,51,
+21,51,21,35,17,35,39,7,35,37,53,33,21,55,249,116,2,115,179,89,89,179,224,
+224,179,2,115,254,64,224,82,82,82,123,254,226,106,106,155,131,131,91,0,1,
+249,123,254,12,252,155,255,206,0,24,0,0,5,20,5,21,37,53,51,21,35,53,5,35,
+53,36,53,53,7,39,21,35,53,51,23,55,51,252,155,253,146,1,188,178,178,254,68,
+178,2,110,222,222,178,178,222,222,178,228,52,74,48,50,40,188,60,60,216,66,
+35,28,49,49,66,171,66,66,0,1,249,123,254,12,252,155,255,206,0,19,0,0,1,51,
+17,33,50,23,22,21,17,35,17,35,17,33,34,39,38,53,17,51,250,45,142,1,77,74,
+37,36,178,142,254,179,73,37,37,178,254,147,1,59,34,33,45,254,174,1,59,254,
+197,34,34,45,1,81,0,1,252,224,254,12,0,0,255,206,0,27,0,0,1,52,55,54,51,50,
+23,22,21,21,35,53,52,39,38,35,34,7,6,21,21,20,51,51,21,35,34,53,252,224,89,
+89,222,222,89,89,167,52,52,129,129,51,53,54,133,221,133,254,229,99,68,66,
+66,68,99,217,217,66,34,33,33,34,66,83,34,100,114,0,0,1,252,117,254,12,0,0,
+255,206,0,23,0,0,1,33,53,51,53,52,55,54,51,50,23,22,21,21,35,53,52,39,38,
+35,34,7,6,21,253,135,254,238,107,89,89,222,222,89,89,167,52,52,129,129,51,
+53,254,12,100,117,99,68,66,66,68,99,217,217,66,34,33,33,34,66,0,1,252,174,
+254,12,0,130,255,206,0,12,0,0,7,53,51,21,22,22,21,20,35,34,39,33,53,156,163,
+79,44,137,138,6,253,69,237,187,187,24,72,54,113,113,150,0,0,1,251,137,254,
+12,252,174,255,186,0,5,0,0,5,17,35,17,35,53,252,174,188,105,70,254,82,1,74,
+100,0,1,250,86,254,12,252,174,255,186,0,13,0,0,5,51,21,20,51,50,53,53,51,
+21,20,33,32,53,250,86,178,122,122,178,254,212,254,212,70,220,90,90,220,220,
+210,210,0,1,250,36,254,12,252,174,255,186,0,11,0,0,5,51,17,55,23,17,51,17,
+35,39,7,35,250,36,178,147,147,178,200,125,125,200,70,254,222,130,130,1,34,
+254,82,130,130,0,0,1,251,117,252,224,252,154,254,12,0,5,0,0,1,17,35,53,35,
+53,252,154,188,105,254,12,254,212,230,70,0,1,250,86,252,224,252,174,254,12,
+0,13,0,0,1,51,21,20,51,50,53,53,51,21,20,33,32,53,250,86,178,122,122,178,
+254,212,254,212,254,12,153,63,63,153,153,147,147,0,0,1,250,36,252,224,252,
+174,254,12,0,11,0,0,1,51,21,55,23,53,51,17,35,39,7,35,250,36,178,147,147,
+178,200,125,125,200,254,12,202,90,90,202,254,212,91,91,0,1,251,180,252,224,
+255,136,254,70,0,12,0,0,1,53,51,21,22,22,21,20,35,34,39,33,53,254,106,163,
+79,44,137,138,6,253,69,253,177,149,149,19,57,43,90,90,119,0,0,1,251,230,252,
+224,255,6,254,12,0,19,0,0,1,51,53,33,50,23,22,21,21,35,53,35,21,33,34,39,
+38,53,53,51,252,152,142,1,77,74,37,36,178,142,254,179,73,37,37,178,253,78,
+190,23,22,30,225,190,190,23,22,30,225,0,0,1,255,56,0,0,1,132,4,176,0,11,0,
+0,19,50,22,21,17,35,17,52,38,35,33,53,68,168,152,188,57,75,254,244,4,176,
+132,131,252,87,3,169,72,53,138,0,0,1,255,56,0,0,1,132,4,176,0,11,0,0,19,50,
+22,21,17,35,17,52,38,35,33,53,68,168,152,188,57,75,254,244,4,176,132,131,
+252,87,3,169,72,53,138,0,0,1,1,44,0,0,4,226,5,120,0,79,0,0,1,20,23,22,51,
+50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,55,50,23,22,21,20,7,6,35,34,7,
+6,21,20,23,22,51,50,55,54,53,52,39,38,35,34,39,38,39,52,55,54,51,50,23,22,
+21,20,7,6,35,34,39,38,53,52,55,54,51,50,55,54,53,52,39,38,35,34,7,6,1,164,
+89,88,178,237,119,119,119,119,237,237,119,119,45,45,89,30,15,15,15,15,30,
+29,15,15,89,88,178,178,89,89,89,89,178,237,119,118,1,119,119,237,237,119,
+119,45,44,89,30,15,15,15,15,30,30,14,15,89,89,178,178,88,89,3,254,132,66,
+66,94,95,190,189,95,95,73,73,147,87,44,43,1,15,15,30,29,14,15,15,14,29,87,
+44,43,65,66,131,132,65,66,95,94,190,189,95,94,73,72,145,88,44,44,15,15,29,
+29,15,14,15,14,30,87,44,43,65,66,0,0,1,249,143,6,114,255,103,7,209,0,19,0,
+0,3,35,35,52,39,38,35,34,7,6,21,35,35,52,55,54,33,32,23,22,153,139,137,118,
+118,236,238,118,120,135,137,187,188,1,117,1,117,188,187,6,114,105,52,54,54,
+52,105,176,88,87,87,88,0,2,0,150,0,0,2,138,2,188,0,7,0,15,0,0,1,52,35,34,
+21,20,51,50,37,16,51,50,17,16,35,34,2,38,150,150,150,150,254,112,250,250,
+250,250,1,94,250,250,250,250,1,94,254,162,254,162,0,1,0,101,0,0,2,189,2,188,
+0,6,0,0,1,19,35,3,3,35,19,1,203,242,105,196,195,104,239,2,188,253,68,2,53,
+253,203,2,188,0,0,1,0,100,0,0,0,200,2,188,0,3,0,0,19,17,35,17,200,100,2,188,
+253,68,2,188,0,1,0,100,0,0,4,172,2,188,0,12,0,0,1,19,19,51,19,35,3,3,35,3,
+3,35,19,1,202,189,188,119,242,105,196,195,105,196,195,104,239,2,188,253,219,
+2,37,253,68,2,53,253,203,2,53,253,203,2,188,0,0,1,0,100,0,0,2,188,2,188,0,
+6,0,0,33,3,51,19,19,51,3,1,86,242,105,196,195,104,239,2,188,253,203,2,53,
+253,68,0,0,2,0,100,0,1,2,189,2,189,0,13,0,21,0,0,55,52,55,39,51,23,55,51,
+7,22,21,20,35,34,37,54,39,6,21,20,55,50,201,125,226,151,149,150,151,227,127,
+200,200,1,43,1,101,99,100,100,201,127,146,226,149,150,227,146,127,200,199,
+82,115,115,81,101,1,0,0,1,0,100,0,0,1,194,2,188,0,3,0,0,19,19,35,3,209,241,
+106,244,2,188,253,68,2,188,0,1,0,100,0,0,3,182,2,188,0,9,0,0,1,19,19,51,3,
+35,3,3,35,19,1,202,189,188,115,250,105,196,195,104,239,2,188,253,219,2,37,
+253,68,2,53,253,203,2,188,0,0,1,0,100,0,0,1,193,2,188,0,3,0,0,1,3,35,19,1,
+193,245,104,239,2,188,253,68,2,188,0,0,1,0,100,254,161,3,83,2,56,0,16,0,0,
+55,1,23,1,37,32,21,6,5,39,53,23,50,53,52,35,33,100,2,72,34,254,41,1,47,1,
+45,1,254,212,50,51,200,200,254,100,112,1,200,99,254,143,1,225,226,1,1,100,
+1,126,125,0,0,2,0,200,253,178,4,76,7,208,0,9,0,50,0,0,1,32,53,17,52,33,32,
+21,17,20,5,6,35,32,17,17,16,33,32,17,17,20,7,51,17,35,52,33,32,21,17,37,5,
+17,52,35,35,53,51,50,21,17,35,39,7,35,17,16,33,50,23,2,138,1,6,254,250,254,
+250,2,12,103,159,254,62,1,194,1,194,55,55,188,254,250,254,250,1,7,1,5,52,
+180,180,240,218,231,232,219,1,194,134,128,3,170,242,1,184,242,242,254,72,
+242,90,48,1,124,1,184,1,124,254,132,254,72,133,87,253,98,182,182,253,54,239,
+238,1,97,80,150,230,253,248,210,210,3,112,1,64,54,0,2,0,200,253,178,4,76,
+7,208,0,27,0,47,0,0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,32,
+17,17,16,33,32,17,51,20,33,32,0,21,20,51,50,55,55,51,17,35,17,6,35,32,53,
+52,51,51,21,35,3,144,254,250,254,250,127,135,135,254,197,1,194,1,194,254,
+62,254,62,188,1,6,1,6,253,244,78,177,85,84,188,188,109,237,254,246,242,53,
+53,4,96,2,48,182,182,120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,
+182,254,46,42,82,131,131,251,80,3,178,146,220,180,138,0,0,2,0,100,253,178,
+5,58,8,202,0,27,0,47,0,0,1,16,33,32,17,17,35,53,51,50,21,17,16,33,32,17,17,
+7,39,17,51,21,35,17,51,23,55,51,0,21,20,51,50,55,55,51,17,35,17,6,35,32,53,
+52,51,51,21,35,5,58,253,199,253,199,100,100,188,1,125,1,125,210,200,50,248,
+198,200,210,188,252,74,78,177,85,84,188,188,109,237,254,246,242,53,53,4,176,
+254,112,1,144,3,132,150,150,252,124,254,250,1,6,2,120,174,174,254,230,150,
+2,88,174,174,250,8,42,82,131,131,251,80,3,178,146,220,180,138,0,0,2,0,200,
+253,178,6,28,7,208,0,26,0,46,0,0,1,35,17,52,35,34,21,17,51,21,33,17,16,33,
+50,23,54,51,32,17,17,35,17,52,35,34,21,0,21,20,51,50,55,55,51,17,35,17,6,
+35,32,53,52,51,51,21,35,3,208,188,200,200,100,254,224,1,132,199,94,94,201,
+1,132,188,200,200,253,180,78,177,85,84,188,188,109,237,254,246,242,53,53,
+3,32,3,72,222,222,253,66,138,3,82,1,94,89,89,254,152,252,184,3,72,222,222,
+251,112,42,82,131,131,251,80,3,178,146,220,180,138,0,2,0,100,253,178,4,76,
+8,212,0,23,0,43,0,0,0,33,33,1,17,52,54,51,51,21,35,17,19,7,33,32,17,17,35,
+53,51,50,21,17,16,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,
+1,132,1,6,1,64,254,242,100,100,200,212,212,50,254,112,254,62,100,100,188,
+78,177,85,84,188,188,109,237,254,246,242,53,53,3,170,1,54,1,96,75,63,138,
+254,210,254,152,138,1,144,3,132,160,150,252,114,253,40,42,82,131,131,251,
+80,3,178,146,220,180,138,0,2,0,200,253,178,4,76,9,66,0,47,0,67,0,0,1,20,33,
+33,39,53,52,54,51,51,21,35,17,19,7,33,32,17,17,52,55,54,55,38,53,52,51,50,
+21,20,7,22,51,50,54,53,17,51,17,20,7,6,35,34,39,6,6,21,16,21,20,51,50,55,
+55,51,17,35,17,6,35,32,53,52,51,51,21,35,1,132,1,6,1,44,250,100,88,212,212,
+212,52,254,114,254,62,125,22,21,68,180,190,75,101,74,70,72,188,89,83,158,
+156,142,36,48,78,177,85,84,188,188,109,237,254,246,242,53,53,4,106,192,230,
+232,75,125,138,254,248,254,252,138,1,74,2,48,147,53,10,7,57,62,144,144,52,
+51,30,66,50,1,105,254,151,123,61,70,49,19,46,49,251,62,42,82,131,131,251,
+80,3,178,146,220,180,138,0,2,0,200,253,178,4,76,9,46,0,28,0,48,0,0,19,51,
+17,54,51,32,17,17,16,33,32,17,16,33,51,21,35,34,21,20,33,32,17,17,16,33,32,
+21,35,18,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,200,188,
+128,134,1,194,254,62,254,62,1,94,150,150,162,1,6,1,6,254,250,254,250,188,
+188,78,177,85,84,188,188,109,237,254,246,242,53,53,9,46,254,108,54,254,112,
+254,112,254,112,1,94,1,94,138,212,212,1,6,1,144,1,6,202,251,92,42,82,131,
+131,251,80,3,178,146,220,180,138,0,2,0,200,253,178,5,120,8,252,0,38,0,58,
+0,0,1,51,17,51,17,20,33,32,53,17,52,35,34,7,6,35,34,39,38,35,34,21,17,51,
+21,33,17,52,55,54,51,50,23,54,51,50,23,22,21,0,21,20,51,50,55,55,51,17,35,
+17,6,35,32,53,52,51,51,21,35,4,26,162,188,254,237,254,249,58,46,77,26,30,
+30,26,76,46,59,162,254,162,71,71,89,89,105,106,90,88,71,70,253,106,78,177,
+85,84,188,188,109,237,254,246,242,53,53,3,170,5,82,250,174,138,138,3,17,127,
+94,31,31,94,127,252,239,138,3,155,113,82,82,124,124,82,82,113,251,29,42,82,
+131,131,251,80,3,178,146,220,180,138,0,2,0,200,253,178,4,76,9,46,0,28,0,48,
+0,0,19,16,33,50,23,17,51,17,35,52,33,32,21,17,37,5,17,52,35,35,53,51,50,21,
+17,35,39,7,35,18,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,
+200,1,194,134,128,188,188,254,250,254,250,1,7,1,5,52,180,180,240,218,231,
+232,219,188,78,177,85,84,188,188,109,237,254,246,242,53,53,6,144,1,64,54,
+1,148,253,98,182,182,253,54,239,238,1,97,80,150,230,253,248,210,210,254,184,
+42,82,131,131,251,80,3,178,146,220,180,138,0,2,0,200,253,178,4,76,9,6,0,39,
+0,59,0,0,1,51,17,35,52,33,32,21,20,33,33,21,33,32,21,21,20,33,32,53,52,35,
+35,53,51,32,21,16,33,32,17,53,54,55,38,39,16,33,50,23,0,21,20,51,50,55,55,
+51,17,35,17,6,35,32,53,52,51,51,21,35,3,144,188,188,254,250,254,250,1,6,1,
+44,254,212,254,250,1,6,1,6,162,100,100,1,94,254,62,254,62,39,99,99,39,1,194,
+134,128,253,244,78,177,85,84,188,188,109,237,254,246,242,53,53,9,6,253,200,
+120,160,122,138,116,226,162,160,100,128,233,254,219,1,44,226,146,43,44,143,
+1,42,38,250,46,42,82,131,131,251,80,3,178,146,220,180,138,0,0,4,0,200,253,
+178,9,96,7,208,0,27,0,37,0,47,0,67,0,0,1,17,52,33,32,21,21,20,51,51,21,35,
+32,53,53,16,33,32,17,17,16,33,32,17,51,20,33,32,32,33,32,53,17,52,33,32,21,
+17,3,16,33,32,17,17,16,33,32,17,0,21,20,51,50,55,55,51,17,35,17,6,35,32,53,
+52,51,51,21,35,3,144,254,250,254,250,127,135,135,254,197,1,194,1,194,254,
+62,254,62,188,1,6,1,6,3,8,1,6,1,6,254,250,254,250,188,1,194,1,194,254,62,
+254,62,254,0,78,177,85,84,188,188,109,237,254,246,242,53,53,4,96,2,48,182,
+182,120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,182,242,1,184,242,
+242,254,72,1,184,1,124,254,132,254,72,254,132,1,124,253,60,42,82,131,131,
+251,80,3,178,146,220,180,138,0,0,3,0,200,253,178,9,96,7,208,0,27,0,55,0,75,
+0,0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,32,17,17,16,33,32,17,
+51,20,33,32,37,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,32,17,17,16,
+33,32,17,51,20,33,32,18,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,
+21,35,8,164,254,250,254,250,127,135,135,254,197,1,194,1,194,254,62,254,62,
+188,1,6,1,6,250,236,254,250,254,250,127,135,135,254,197,1,194,1,194,254,62,
+254,62,188,1,6,1,6,76,78,177,85,84,188,188,109,237,254,246,242,53,53,4,96,
+2,48,182,182,120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,182,182,
+2,48,182,182,120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,182,254,
+46,42,82,131,131,251,80,3,178,146,220,180,138,0,0,3,0,200,253,178,10,78,8,
+202,0,27,0,55,0,75,0,0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,
+32,17,17,16,33,32,17,51,20,33,32,1,16,33,32,17,17,35,53,51,50,21,17,16,33,
+32,17,17,7,39,17,51,21,35,17,51,23,55,51,0,21,20,51,50,55,55,51,17,35,17,
+6,35,32,53,52,51,51,21,35,3,144,254,250,254,250,127,135,135,254,197,1,194,
+1,194,254,62,254,62,188,1,6,1,6,6,190,253,199,253,199,100,100,188,1,125,1,
+125,210,200,50,248,198,200,210,188,249,142,78,177,85,84,188,188,109,237,254,
+246,242,53,53,4,96,2,48,182,182,120,80,160,240,120,1,64,254,192,253,208,254,
+192,1,64,182,1,6,254,112,1,144,3,132,150,150,252,124,254,250,1,6,2,120,174,
+174,254,230,150,2,88,174,174,250,8,42,82,131,131,251,80,3,178,146,220,180,
+138,0,0,3,0,200,253,178,11,48,7,208,0,27,0,54,0,74,0,0,1,17,52,33,32,21,21,
+20,51,51,21,35,32,53,53,16,33,32,17,17,16,33,32,17,51,20,33,32,5,35,17,52,
+35,34,21,17,51,21,33,17,16,33,50,23,54,51,32,17,17,35,17,52,35,34,21,0,21,
+20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,3,144,254,250,254,250,
+127,135,135,254,197,1,194,1,194,254,62,254,62,188,1,6,1,6,5,84,188,200,200,
+100,254,224,1,132,199,94,94,201,1,132,188,200,200,250,248,78,177,85,84,188,
+188,109,237,254,246,242,53,53,4,96,2,48,182,182,120,80,160,240,120,1,64,254,
+192,253,208,254,192,1,64,182,138,3,72,222,222,253,66,138,3,82,1,94,89,89,
+254,152,252,184,3,72,222,222,251,112,42,82,131,131,251,80,3,178,146,220,180,
+138,0,0,3,0,200,253,178,9,96,8,212,0,27,0,51,0,71,0,0,1,17,52,33,32,21,21,
+20,51,51,21,35,32,53,53,16,33,32,17,17,16,33,32,17,51,20,33,32,32,33,33,1,
+17,52,54,51,51,21,35,17,19,7,33,32,17,17,35,53,51,50,21,17,0,21,20,51,50,
+55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,3,144,254,250,254,250,127,135,
+135,254,197,1,194,1,194,254,62,254,62,188,1,6,1,6,3,8,1,6,1,64,254,242,100,
+100,200,212,212,50,254,112,254,62,100,100,188,253,68,78,177,85,84,188,188,
+109,237,254,246,242,53,53,4,96,2,48,182,182,120,80,160,240,120,1,64,254,192,
+253,208,254,192,1,64,182,1,54,1,96,75,63,138,254,210,254,152,138,1,144,3,
+132,160,150,252,114,253,40,42,82,131,131,251,80,3,178,146,220,180,138,0,3,
+0,200,253,178,9,96,9,66,0,27,0,75,0,95,0,0,1,17,52,33,32,21,21,20,51,51,21,
+35,32,53,53,16,33,32,17,17,16,33,32,17,51,20,33,32,37,20,33,33,39,53,52,54,
+51,51,21,35,17,19,7,33,32,17,17,52,55,54,55,38,53,52,51,50,21,20,7,22,51,
+50,54,53,17,51,17,20,7,6,35,34,39,6,6,21,0,21,20,51,50,55,55,51,17,35,17,
+6,35,32,53,52,51,51,21,35,3,144,254,250,254,250,127,135,135,254,197,1,194,
+1,194,254,62,254,62,188,1,6,1,6,3,8,1,6,1,44,250,100,88,212,212,212,52,254,
+114,254,62,125,22,21,68,180,190,75,101,74,70,72,188,89,83,158,156,142,36,
+48,253,68,78,177,85,84,188,188,109,237,254,246,242,53,53,4,96,2,48,182,182,
+120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,182,192,192,230,232,
+75,125,138,254,248,254,252,138,1,74,2,48,147,53,10,7,57,62,144,144,52,51,
+30,66,50,1,105,254,151,123,61,70,49,19,46,49,251,62,42,82,131,131,251,80,
+3,178,146,220,180,138,0,0,1,0,200,253,178,4,76,9,46,0,55,0,0,1,35,52,33,32,
+21,17,37,5,17,52,35,35,53,51,50,21,17,35,39,7,35,17,16,33,50,23,53,35,39,
+7,35,17,16,33,50,23,17,51,17,35,52,33,32,21,17,37,5,17,52,35,35,53,51,50,
+21,4,76,188,254,250,254,250,1,7,1,5,52,180,180,240,218,231,232,219,1,194,
+134,128,30,231,232,219,1,194,134,128,188,188,254,250,254,250,1,7,1,5,52,180,
+180,240,1,34,182,182,253,54,239,238,1,97,80,150,230,253,248,210,210,3,112,
+1,64,54,244,210,210,3,112,1,64,54,1,148,253,98,182,182,253,54,239,238,1,97,
+80,150,230,0,2,0,200,253,178,4,76,7,208,0,27,0,47,0,0,1,17,52,33,32,21,21,
+20,51,51,21,35,32,53,53,16,33,32,17,17,16,33,32,17,51,20,33,32,0,21,20,51,
+50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,3,144,254,250,254,250,127,
+135,135,254,197,1,194,1,194,254,62,254,62,188,1,6,1,6,253,244,78,177,85,84,
+188,188,109,237,254,246,242,53,53,254,242,2,48,182,182,120,80,160,240,120,
+1,64,254,192,253,208,254,192,1,64,182,9,10,42,82,131,131,251,80,3,178,146,
+220,180,138,0,0,2,0,100,253,178,5,58,7,208,0,27,0,47,0,0,5,16,33,32,17,17,
+35,53,51,50,21,17,16,33,32,17,17,7,39,17,51,21,35,17,51,23,55,51,0,21,20,
+51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,5,58,253,199,253,199,100,
+100,188,1,125,1,125,210,200,50,248,198,200,210,188,252,74,78,177,85,84,188,
+188,109,237,254,246,242,53,53,190,254,112,1,144,3,132,150,150,252,124,254,
+250,1,6,2,120,174,174,254,230,150,2,88,174,174,4,228,42,82,131,131,251,80,
+3,178,146,220,180,138,0,2,0,200,253,178,6,28,7,208,0,26,0,46,0,0,1,35,17,
+52,35,34,21,17,51,21,33,17,16,33,50,23,54,51,32,17,17,35,17,52,35,34,21,0,
+21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,3,208,188,200,200,
+100,254,224,1,132,199,94,94,201,1,132,188,200,200,253,180,78,177,85,84,188,
+188,109,237,254,246,242,53,53,253,178,3,72,222,222,253,66,138,3,82,1,94,89,
+89,254,152,252,184,3,72,222,222,6,76,42,82,131,131,251,80,3,178,146,220,180,
+138,0,2,0,100,253,178,4,76,7,208,0,23,0,43,0,0,0,33,33,1,17,52,54,51,51,21,
+35,17,19,7,33,32,17,17,35,53,51,50,21,17,16,21,20,51,50,55,55,51,17,35,17,
+6,35,32,53,52,51,51,21,35,1,132,1,6,1,64,254,242,100,100,200,212,212,50,254,
+112,254,62,100,100,188,78,177,85,84,188,188,109,237,254,246,242,53,53,254,
+60,1,54,1,96,75,63,138,254,210,254,152,138,1,144,3,132,160,150,252,114,8,
+4,42,82,131,131,251,80,3,178,146,220,180,138,0,1,0,200,253,178,4,76,7,208,
+0,67,0,0,1,51,17,20,7,6,35,34,39,6,6,21,17,20,33,33,39,53,52,54,51,51,21,
+35,17,19,7,33,32,17,17,52,55,54,55,38,53,52,51,50,21,20,7,22,51,50,54,53,
+53,35,17,6,35,32,53,52,51,51,21,35,34,21,20,51,50,55,55,51,3,232,100,89,83,
+158,156,142,36,48,1,6,1,44,250,100,88,212,212,212,52,254,114,254,62,125,22,
+21,68,180,190,75,101,74,70,72,100,109,237,254,246,242,53,53,54,78,177,85,
+84,188,3,212,254,151,123,61,70,49,19,46,49,253,208,192,230,232,75,125,138,
+254,248,254,252,138,1,74,2,48,147,53,10,7,57,62,144,144,52,51,30,66,50,181,
+3,178,146,220,180,138,42,82,131,131,0,2,0,200,253,178,4,76,7,208,0,28,0,48,
+0,0,19,51,17,54,51,32,17,17,16,33,32,17,16,33,51,21,35,34,21,20,33,32,17,
+17,16,33,32,21,35,18,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,
+35,200,188,128,134,1,194,254,62,254,62,1,94,150,150,162,1,6,1,6,254,250,254,
+250,188,188,78,177,85,84,188,188,109,237,254,246,242,53,53,3,192,254,108,
+54,254,112,254,112,254,112,1,94,1,94,138,212,212,1,6,1,144,1,6,202,6,56,42,
+82,131,131,251,80,3,178,146,220,180,138,0,2,0,200,253,178,5,120,7,208,0,38,
+0,58,0,0,1,51,17,51,17,20,33,32,53,17,52,35,34,7,6,35,34,39,38,35,34,21,17,
+51,21,33,17,52,55,54,51,50,23,54,51,50,23,22,21,0,21,20,51,50,55,55,51,17,
+35,17,6,35,32,53,52,51,51,21,35,4,26,162,188,254,237,254,249,58,46,77,26,
+30,30,26,76,46,59,162,254,162,71,71,89,89,105,106,90,88,71,70,253,106,78,
+177,85,84,188,188,109,237,254,246,242,53,53,254,60,5,82,250,174,138,138,3,
+17,127,94,31,31,94,127,252,239,138,3,155,113,82,82,124,124,82,82,113,5,249,
+42,82,131,131,251,80,3,178,146,220,180,138,0,1,0,200,253,178,4,76,7,208,0,
+48,0,0,1,51,17,35,52,33,32,21,17,37,5,17,52,35,35,53,51,50,21,17,35,39,7,
+35,17,16,33,50,23,53,35,17,6,35,32,53,52,51,51,21,35,34,21,20,51,50,55,55,
+51,3,232,100,188,254,250,254,250,1,7,1,5,52,180,180,240,218,231,232,219,1,
+194,134,128,100,109,237,254,246,242,53,53,54,78,177,85,84,188,3,192,253,98,
+182,182,253,54,239,238,1,97,80,150,230,253,248,210,210,3,112,1,64,54,244,
+3,178,146,220,180,138,42,82,131,131,0,1,0,200,253,178,4,76,7,208,0,59,0,0,
+1,51,17,35,52,33,32,21,20,33,33,21,33,32,21,21,20,33,32,53,52,35,35,53,51,
+32,21,16,33,32,17,53,54,55,38,39,16,33,50,23,53,35,17,6,35,32,53,52,51,51,
+21,35,34,21,20,51,50,55,55,51,3,232,100,188,254,250,254,250,1,6,1,44,254,
+212,254,250,1,6,1,6,162,100,100,1,94,254,62,254,62,39,99,99,39,1,194,134,
+128,100,109,237,254,246,242,53,53,54,78,177,85,84,188,3,152,253,200,120,160,
+122,138,116,226,162,160,100,128,233,254,219,1,44,226,146,43,44,143,1,42,38,
+228,3,178,146,220,180,138,42,82,131,131,0,0,4,0,200,253,178,9,96,7,208,0,
+27,0,37,0,47,0,67,0,0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,32,
+17,17,16,33,32,17,51,20,33,32,32,33,32,53,17,52,33,32,21,17,3,16,33,32,17,
+17,16,33,32,17,0,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,
+3,144,254,250,254,250,127,135,135,254,197,1,194,1,194,254,62,254,62,188,1,
+6,1,6,3,8,1,6,1,6,254,250,254,250,188,1,194,1,194,254,62,254,62,254,0,78,
+177,85,84,188,188,109,237,254,246,242,53,53,254,242,2,48,182,182,120,80,160,
+240,120,1,64,254,192,253,208,254,192,1,64,182,242,1,184,242,242,254,72,1,
+184,1,124,254,132,254,72,254,132,1,124,8,24,42,82,131,131,251,80,3,178,146,
+220,180,138,0,0,3,0,200,253,178,9,96,7,208,0,27,0,55,0,75,0,0,1,17,52,33,
+32,21,21,20,51,51,21,35,32,53,53,16,33,32,17,17,16,33,32,17,51,20,33,32,37,
+17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,32,17,17,16,33,32,17,51,20,
+33,32,18,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,8,164,254,
+250,254,250,127,135,135,254,197,1,194,1,194,254,62,254,62,188,1,6,1,6,250,
+236,254,250,254,250,127,135,135,254,197,1,194,1,194,254,62,254,62,188,1,6,
+1,6,76,78,177,85,84,188,188,109,237,254,246,242,53,53,254,242,2,48,182,182,
+120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,182,182,2,48,182,182,
+120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,182,9,10,42,82,131,131,
+251,80,3,178,146,220,180,138,0,0,2,0,200,253,178,10,78,7,208,0,27,0,74,0,
+0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,32,17,17,16,33,32,17,
+51,20,33,32,1,22,21,17,16,33,32,17,17,7,39,17,51,21,35,17,51,23,55,51,17,
+16,33,32,17,17,35,53,51,17,6,35,32,53,52,51,51,21,35,34,21,20,51,50,55,55,
+51,3,144,254,250,254,250,127,135,135,254,197,1,194,1,194,254,62,254,62,188,
+1,6,1,6,2,176,88,1,125,1,125,210,200,50,248,198,200,210,188,253,199,253,199,
+100,12,109,237,254,246,242,53,53,54,78,177,85,84,188,254,242,2,48,182,182,
+120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,182,5,17,32,103,252,
+124,254,250,1,6,2,120,174,174,254,230,150,2,88,174,174,252,224,254,112,1,
+144,3,132,150,3,118,146,220,180,138,42,82,131,131,0,0,3,0,200,253,178,11,
+48,7,208,0,27,0,54,0,74,0,0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,
+33,32,17,17,16,33,32,17,51,20,33,32,5,35,17,52,35,34,21,17,51,21,33,17,16,
+33,50,23,54,51,32,17,17,35,17,52,35,34,21,0,21,20,51,50,55,55,51,17,35,17,
+6,35,32,53,52,51,51,21,35,3,144,254,250,254,250,127,135,135,254,197,1,194,
+1,194,254,62,254,62,188,1,6,1,6,5,84,188,200,200,100,254,224,1,132,199,94,
+94,201,1,132,188,200,200,250,248,78,177,85,84,188,188,109,237,254,246,242,
+53,53,254,242,2,48,182,182,120,80,160,240,120,1,64,254,192,253,208,254,192,
+1,64,182,138,3,72,222,222,253,66,138,3,82,1,94,89,89,254,152,252,184,3,72,
+222,222,6,76,42,82,131,131,251,80,3,178,146,220,180,138,0,0,2,0,200,253,178,
+9,96,7,208,0,27,0,70,0,0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,
+32,17,17,16,33,32,17,51,20,33,32,1,22,21,17,16,33,33,1,17,52,54,51,51,21,
+35,17,19,7,33,32,17,17,35,53,51,17,6,35,32,53,52,51,51,21,35,34,21,20,51,
+50,55,55,51,3,144,254,250,254,250,127,135,135,254,197,1,194,1,194,254,62,
+254,62,188,1,6,1,6,2,176,88,1,6,1,64,254,242,100,100,200,212,212,50,254,112,
+254,62,100,12,109,237,254,246,242,53,53,54,78,177,85,84,188,254,242,2,48,
+182,182,120,80,160,240,120,1,64,254,192,253,208,254,192,1,64,182,5,27,32,
+103,252,114,254,250,1,54,1,96,75,63,138,254,210,254,152,138,1,144,3,132,160,
+3,108,146,220,180,138,42,82,131,131,0,3,0,200,253,178,9,96,7,208,0,27,0,75,
+0,95,0,0,1,17,52,33,32,21,21,20,51,51,21,35,32,53,53,16,33,32,17,17,16,33,
+32,17,51,20,33,32,37,20,33,33,39,53,52,54,51,51,21,35,17,19,7,33,32,17,17,
+52,55,54,55,38,53,52,51,50,21,20,7,22,51,50,54,53,17,51,17,20,7,6,35,34,39,
+6,6,21,0,21,20,51,50,55,55,51,17,35,17,6,35,32,53,52,51,51,21,35,3,144,254,
+250,254,250,127,135,135,254,197,1,194,1,194,254,62,254,62,188,1,6,1,6,3,8,
+1,6,1,44,250,100,88,212,212,212,52,254,114,254,62,125,22,21,68,180,190,75,
+101,74,70,72,188,89,83,158,156,142,36,48,253,68,78,177,85,84,188,188,109,
+237,254,246,242,53,53,254,242,2,48,182,182,120,80,160,240,120,1,64,254,192,
+253,208,254,192,1,64,182,192,192,230,232,75,125,138,254,248,254,252,138,1,
+74,2,48,147,53,10,7,57,62,144,144,52,51,30,66,50,1,105,254,151,123,61,70,
+49,19,46,49,6,26,42,82,131,131,251,80,3,178,146,220,180,138,0,0,1,255,213,
+254,240,0,43,5,6,0,3,0,0,19,17,35,17,43,86,5,6,249,234,6,22,0,1,255,33,254,
+240,0,223,5,133,0,14,0,0,19,35,17,7,39,55,39,55,23,55,23,7,23,7,39,43,86,
+127,53,168,168,53,170,170,53,168,168,53,127,254,240,5,88,127,55,168,166,55,
+170,170,55,166,168,55,127,0,0,16,0,98,0,86,4,94,4,82,0,7,0,15,0,23,0,31,0,
+39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,20,35,
+34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,23,20,35,34,
+53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,
+51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,
+1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,37,20,
+35,34,53,52,51,50,19,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,3,215,51,
+55,55,51,147,52,57,57,52,247,55,53,55,53,35,51,55,55,51,254,56,54,53,53,54,
+173,55,53,53,55,2,82,55,53,53,55,253,27,55,54,54,55,2,129,51,55,55,51,147,
+52,57,57,52,253,174,52,57,55,54,35,53,56,56,53,1,199,54,53,53,54,254,92,54,
+55,55,54,247,55,53,53,55,147,55,54,54,55,3,150,54,54,55,43,53,53,55,254,211,
+55,55,53,227,53,53,53,1,148,56,56,53,90,53,53,55,253,119,53,53,55,1,185,54,
+51,58,253,67,53,53,56,154,51,51,55,2,29,55,55,53,227,53,53,53,254,4,55,55,
+54,227,53,53,55,254,213,55,51,55,43,53,53,56,0,0,0,0,0,0,16,0,198,0,3,0,1,
+4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,30,0,94,0,3,0,1,4,9,0,2,0,14,0,124,0,3,
+0,1,4,9,0,3,0,30,0,94,0,3,0,1,4,9,0,4,0,30,0,94,0,3,0,1,4,9,0,5,0,30,0,138,
+0,3,0,1,4,9,0,6,0,26,0,168,0,3,0,1,4,9,0,7,0,68,0,194,0,3,0,1,4,9,0,8,0,18,
+1,6,0,3,0,1,4,9,0,9,0,18,1,6,0,3,0,1,4,9,0,10,0,28,1,24,0,3,0,1,4,9,0,11,
+0,62,1,52,0,3,0,1,4,9,0,12,0,48,1,114,0,3,0,1,4,9,0,13,2,150,1,162,0,3,0,
+1,4,9,0,14,0,52,4,56,0,3,0,1,4,9,0,19,0,18,4,108,0,67,0,111,0,112,0,121,0,
+114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,
+0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,
+82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,
+0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,
+75,0,104,0,109,0,101,0,114,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,
+0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,75,0,104,0,109,0,101,0,114,
+0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,
+100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,68,0,97,0,110,0,104,0,32,0,72,
+0,111,0,110,0,103,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,
+0,116,0,101,0,100,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,
+0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,107,0,104,0,109,0,101,0,114,0,116,
+0,121,0,112,0,101,0,46,0,111,0,114,0,103,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,
+0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,
+79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,23,151,23,182,23,159,23,182,23,129,23,210,23,152,23,194,23,
+154,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,9,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,
+0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,
+0,31,0,32,0,33,0,34,0,35,0,94,0,95,0,96,0,97,1,2,0,169,1,3,0,170,1,4,1,5,
+1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,
+21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,
+1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,
+1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,
+1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,
+1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,
+1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,
+1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,
+121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,
+1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,
+146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,
+1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,
+171,1,172,1,173,1,174,1,175,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,
+1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,
+200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,
+1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,
+225,1,177,1,178,1,179,4,122,119,115,112,7,117,110,105,48,48,65,68,7,117,110,
+105,49,55,56,48,7,117,110,105,49,55,56,49,7,117,110,105,49,55,56,50,7,117,
+110,105,49,55,56,51,7,117,110,105,49,55,56,52,7,117,110,105,49,55,56,53,7,
+117,110,105,49,55,56,54,7,117,110,105,49,55,56,55,7,117,110,105,49,55,56,
+56,7,117,110,105,49,55,56,57,7,117,110,105,49,55,56,65,7,117,110,105,49,55,
+56,66,7,117,110,105,49,55,56,67,7,117,110,105,49,55,56,68,7,117,110,105,49,
+55,56,69,7,117,110,105,49,55,56,70,7,117,110,105,49,55,57,48,7,117,110,105,
+49,55,57,49,7,117,110,105,49,55,57,50,7,117,110,105,49,55,57,51,7,117,110,
+105,49,55,57,52,7,117,110,105,49,55,57,53,7,117,110,105,49,55,57,54,7,117,
+110,105,49,55,57,55,7,117,110,105,49,55,57,56,7,117,110,105,49,55,57,57,7,
+117,110,105,49,55,57,65,7,117,110,105,49,55,57,66,7,117,110,105,49,55,57,
+67,7,117,110,105,49,55,57,68,7,117,110,105,49,55,57,69,7,117,110,105,49,55,
+57,70,7,117,110,105,49,55,65,48,7,117,110,105,49,55,65,49,7,117,110,105,49,
+55,65,50,7,117,110,105,49,55,65,51,7,117,110,105,49,55,65,52,7,117,110,105,
+49,55,65,53,7,117,110,105,49,55,65,54,7,117,110,105,49,55,65,55,7,117,110,
+105,49,55,65,56,7,117,110,105,49,55,65,57,7,117,110,105,49,55,65,65,7,117,
+110,105,49,55,65,66,7,117,110,105,49,55,65,67,7,117,110,105,49,55,65,68,7,
+117,110,105,49,55,65,69,7,117,110,105,49,55,65,70,7,117,110,105,49,55,66,
+48,7,117,110,105,49,55,66,49,7,117,110,105,49,55,66,50,7,117,110,105,49,55,
+66,51,7,117,110,105,49,55,66,54,7,117,110,105,49,55,66,55,7,117,110,105,49,
+55,66,56,7,117,110,105,49,55,66,57,7,117,110,105,49,55,66,65,7,117,110,105,
+49,55,66,66,7,117,110,105,49,55,66,67,7,117,110,105,49,55,66,68,7,117,110,
+105,49,55,66,69,7,117,110,105,49,55,66,70,7,117,110,105,49,55,67,48,7,117,
+110,105,49,55,67,49,7,117,110,105,49,55,67,50,7,117,110,105,49,55,67,51,7,
+117,110,105,49,55,67,52,7,117,110,105,49,55,67,53,7,117,110,105,49,55,67,
+54,7,117,110,105,49,55,67,55,7,117,110,105,49,55,67,56,7,117,110,105,49,55,
+67,57,7,117,110,105,49,55,67,65,7,117,110,105,49,55,67,66,7,117,110,105,49,
+55,67,67,7,117,110,105,49,55,67,68,7,117,110,105,49,55,67,69,7,117,110,105,
+49,55,67,70,7,117,110,105,49,55,68,48,7,117,110,105,49,55,68,49,7,117,110,
+105,49,55,68,50,7,117,110,105,49,55,68,51,7,117,110,105,49,55,68,52,7,117,
+110,105,49,55,68,53,7,117,110,105,49,55,68,54,7,117,110,105,49,55,68,55,7,
+117,110,105,49,55,68,56,7,117,110,105,49,55,68,57,7,117,110,105,49,55,68,
+65,7,117,110,105,49,55,68,66,7,117,110,105,49,55,69,48,7,117,110,105,49,55,
+69,49,7,117,110,105,49,55,69,50,7,117,110,105,49,55,69,51,7,117,110,105,49,
+55,69,52,7,117,110,105,49,55,69,53,7,117,110,105,49,55,69,54,7,117,110,105,
+49,55,69,55,7,117,110,105,49,55,69,56,7,117,110,105,49,55,69,57,11,117,110,
+105,49,55,68,50,49,55,56,48,11,117,110,105,49,55,68,50,49,55,56,49,11,117,
+110,105,49,55,68,50,49,55,56,50,11,117,110,105,49,55,68,50,49,55,56,51,11,
+117,110,105,49,55,68,50,49,55,56,52,11,117,110,105,49,55,68,50,49,55,56,53,
+11,117,110,105,49,55,68,50,49,55,56,54,11,117,110,105,49,55,68,50,49,55,56,
+55,11,117,110,105,49,55,68,50,49,55,56,56,11,117,110,105,49,55,68,50,49,55,
+56,57,13,117,110,105,49,55,68,50,49,55,56,57,46,97,11,117,110,105,49,55,68,
+50,49,55,56,65,11,117,110,105,49,55,68,50,49,55,56,66,11,117,110,105,49,55,
+68,50,49,55,56,67,11,117,110,105,49,55,68,50,49,55,56,68,11,117,110,105,49,
+55,68,50,49,55,56,69,11,117,110,105,49,55,68,50,49,55,56,70,11,117,110,105,
+49,55,68,50,49,55,57,48,11,117,110,105,49,55,68,50,49,55,57,49,11,117,110,
+105,49,55,68,50,49,55,57,50,11,117,110,105,49,55,68,50,49,55,57,51,11,117,
+110,105,49,55,68,50,49,55,57,52,11,117,110,105,49,55,68,50,49,55,57,53,11,
+117,110,105,49,55,68,50,49,55,57,54,11,117,110,105,49,55,68,50,49,55,57,55,
+11,117,110,105,49,55,68,50,49,55,57,56,11,117,110,105,49,55,68,50,49,55,57,
+57,11,117,110,105,49,55,68,50,49,55,57,65,11,117,110,105,49,55,68,50,49,55,
+57,66,11,117,110,105,49,55,68,50,49,55,57,67,11,117,110,105,49,55,68,50,49,
+55,57,70,11,117,110,105,49,55,68,50,49,55,65,48,11,117,110,105,49,55,68,50,
+49,55,65,50,9,117,110,105,49,55,66,66,46,98,9,117,110,105,49,55,66,67,46,
+98,9,117,110,105,49,55,66,68,46,98,9,117,110,105,49,55,66,55,46,97,9,117,
+110,105,49,55,66,56,46,97,9,117,110,105,49,55,66,57,46,97,9,117,110,105,49,
+55,66,65,46,97,9,117,110,105,49,55,67,54,46,97,9,117,110,105,49,55,67,69,
+46,97,9,117,110,105,49,55,68,48,46,97,9,117,110,105,49,55,56,57,46,97,9,117,
+110,105,49,55,57,52,46,97,13,117,110,105,49,55,68,50,49,55,57,65,46,98,11,
+117,110,105,49,55,66,55,49,55,67,68,9,117,110,105,49,55,66,70,46,98,9,117,
+110,105,49,55,67,48,46,98,9,117,110,105,49,55,66,55,46,114,9,117,110,105,
+49,55,66,56,46,114,9,117,110,105,49,55,66,57,46,114,9,117,110,105,49,55,66,
+65,46,114,9,117,110,105,49,55,67,54,46,114,9,117,110,105,49,55,67,57,46,114,
+9,117,110,105,49,55,67,68,46,114,13,117,110,105,49,55,66,55,49,55,67,68,46,
+114,13,117,110,105,49,55,68,50,49,55,56,65,46,110,13,117,110,105,49,55,68,
+50,49,55,56,66,46,110,13,117,110,105,49,55,68,50,49,55,56,67,46,110,13,117,
+110,105,49,55,68,50,49,55,65,48,46,110,13,117,110,105,49,55,68,50,49,55,56,
+65,46,114,13,117,110,105,49,55,68,50,49,55,57,55,46,114,13,117,110,105,49,
+55,68,50,49,55,57,56,46,114,9,117,110,105,49,55,66,66,46,110,9,117,110,105,
+49,55,66,67,46,110,9,117,110,105,49,55,66,68,46,110,10,117,110,105,49,55,
+66,66,46,110,50,10,117,110,105,49,55,66,67,46,110,50,10,117,110,105,49,55,
+66,68,46,110,50,13,117,110,105,49,55,68,50,49,55,57,56,46,98,13,117,110,105,
+49,55,68,50,49,55,65,48,46,98,0,7,117,110,105,50,48,48,67,7,117,110,105,50,
+48,48,68,7,117,110,105,50,53,67,67,7,117,110,105,49,55,66,52,7,117,110,105,
+49,55,66,53,7,117,110,105,49,55,68,67,7,117,110,105,49,55,68,68,7,117,110,
+105,49,55,70,48,7,117,110,105,49,55,70,49,7,117,110,105,49,55,70,50,7,117,
+110,105,49,55,70,51,7,117,110,105,49,55,70,52,7,117,110,105,49,55,70,53,7,
+117,110,105,49,55,70,54,7,117,110,105,49,55,70,55,7,117,110,105,49,55,70,
+56,7,117,110,105,49,55,70,57,7,117,110,105,49,57,69,48,7,117,110,105,49,57,
+69,49,7,117,110,105,49,57,69,50,7,117,110,105,49,57,69,51,7,117,110,105,49,
+57,69,52,7,117,110,105,49,57,69,53,7,117,110,105,49,57,69,54,7,117,110,105,
+49,57,69,55,7,117,110,105,49,57,69,56,7,117,110,105,49,57,69,57,7,117,110,
+105,49,57,69,65,7,117,110,105,49,57,69,66,7,117,110,105,49,57,69,67,7,117,
+110,105,49,57,69,68,7,117,110,105,49,57,69,69,7,117,110,105,49,57,69,70,7,
+117,110,105,49,57,70,48,7,117,110,105,49,57,70,49,7,117,110,105,49,57,70,
+50,7,117,110,105,49,57,70,51,7,117,110,105,49,57,70,52,7,117,110,105,49,57,
+70,53,7,117,110,105,49,57,70,54,7,117,110,105,49,57,70,55,7,117,110,105,49,
+57,70,56,7,117,110,105,49,57,70,57,7,117,110,105,49,57,70,65,7,117,110,105,
+49,57,70,66,7,117,110,105,49,57,70,67,7,117,110,105,49,57,70,68,7,117,110,
+105,49,57,70,69,7,117,110,105,49,57,70,70,0,0,0,0,2,0,5,0,2,255,255,0,3,0,
+1,0,0,0,12,0,0,0,0,0,0,0,2,0,1,0,0,1,5,0,1,0,0,0,1,0,0,0,10,0,10,0,10,0,0,
+0,1,0,0,0,10,0,38,0,140,0,1,107,104,109,114,0,8,0,4,0,0,0,0,255,255,0,5,0,
+0,0,1,0,2,0,4,0,3,0,5,97,98,118,115,0,32,98,108,119,102,0,40,99,108,105,103,
+0,66,112,114,101,102,0,86,112,115,116,102,0,94,0,0,0,2,0,6,0,12,0,0,0,11,
+0,0,0,3,0,8,0,10,0,11,0,13,0,14,0,15,0,16,0,18,0,19,0,0,0,8,0,3,0,4,0,5,0,
+9,0,10,0,17,0,18,0,19,0,0,0,2,0,2,0,5,0,0,0,2,0,1,0,7,0,36,0,74,1,36,1,102,
+1,134,1,242,3,84,3,146,3,178,3,244,4,94,4,120,4,148,5,64,5,188,5,214,5,246,
+6,26,6,84,6,192,6,224,7,26,7,40,7,60,7,80,7,102,7,122,7,164,7,190,7,216,8,
+10,8,48,8,72,8,96,8,130,8,150,8,170,0,4,0,0,0,1,0,8,0,1,1,46,0,1,0,8,0,25,
+0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,0,106,0,112,0,118,0,124,0,130,
+0,136,0,142,0,148,0,154,0,160,0,166,0,172,0,178,0,184,0,190,0,196,0,144,0,
+2,0,44,0,145,0,2,0,45,0,146,0,2,0,46,0,148,0,2,0,48,0,149,0,2,0,49,0,150,
+0,2,0,50,0,151,0,2,0,51,0,153,0,2,0,53,0,155,0,2,0,54,0,156,0,2,0,55,0,157,
+0,2,0,56,0,159,0,2,0,58,0,160,0,2,0,59,0,161,0,2,0,60,0,162,0,2,0,61,0,163,
+0,2,0,62,0,164,0,2,0,63,0,166,0,2,0,65,0,167,0,2,0,66,0,168,0,2,0,67,0,169,
+0,2,0,68,0,172,0,2,0,71,0,173,0,2,0,72,0,175,0,2,0,76,0,176,0,2,0,78,0,4,
+0,0,0,1,0,8,0,1,0,84,0,1,0,8,0,6,0,14,0,20,0,26,0,32,0,38,0,44,0,147,0,2,
+0,47,0,152,0,2,0,52,0,158,0,2,0,57,0,165,0,2,0,64,0,170,0,2,0,69,0,174,0,
+2,0,75,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,171,0,2,0,70,0,1,0,1,0,
+124,0,6,0,0,0,5,0,16,0,34,0,52,0,70,0,90,0,3,0,1,4,218,0,1,6,168,0,0,0,1,
+0,0,0,20,0,3,0,1,5,8,0,1,6,150,0,0,0,1,0,0,0,20,0,3,0,1,6,214,0,1,6,132,0,
+0,0,1,0,0,0,20,0,3,0,2,0,188,6,196,0,1,6,114,0,0,0,1,0,0,0,20,0,3,0,1,5,52,
+0,1,6,94,0,0,0,1,0,0,0,20,0,6,0,0,0,15,0,36,0,54,0,72,0,90,0,110,0,130,0,
+156,0,176,0,196,0,216,0,236,1,0,1,20,1,40,1,66,0,3,0,0,0,1,5,32,0,1,3,30,
+0,1,0,0,0,21,0,3,0,0,0,1,5,14,0,1,1,6,0,1,0,0,0,21,0,3,0,0,0,1,4,252,0,1,
+1,20,0,1,0,0,0,21,0,3,0,0,0,1,4,234,0,2,0,60,2,232,0,1,0,0,0,21,0,3,0,0,0,
+1,4,214,0,2,0,40,0,206,0,1,0,0,0,21,0,3,0,0,0,1,4,194,0,2,0,20,0,218,0,1,
+0,0,0,21,0,1,0,1,0,115,0,3,0,0,0,1,4,168,0,2,4,230,2,166,0,1,0,0,0,21,0,3,
+0,0,0,1,4,148,0,2,4,210,0,140,0,1,0,0,0,21,0,3,0,0,0,1,4,128,0,2,4,190,0,
+152,0,1,0,0,0,21,0,3,0,0,0,1,4,108,0,2,3,166,2,106,0,1,0,0,0,21,0,3,0,0,0,
+1,4,88,0,2,3,146,0,80,0,1,0,0,0,21,0,3,0,0,0,1,4,68,0,2,3,126,0,92,0,1,0,
+0,0,21,0,3,0,0,0,1,4,48,0,2,0,66,2,46,0,1,0,0,0,21,0,3,0,0,0,1,4,28,0,2,0,
+46,0,20,0,1,0,0,0,21,0,1,0,1,0,110,0,3,0,0,0,1,4,2,0,2,0,20,0,26,0,1,0,0,
+0,21,0,1,0,1,0,101,0,1,0,1,0,111,0,6,0,0,0,1,0,8,0,3,0,0,0,1,3,238,0,2,0,
+20,3,20,0,1,0,0,0,22,0,2,0,5,0,44,0,46,0,0,0,48,0,51,0,3,0,54,0,56,0,7,0,
+59,0,68,0,10,0,78,0,78,0,20,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,190,
+0,2,0,119,0,1,0,1,0,97,0,6,0,0,0,3,0,12,0,30,0,48,0,3,0,1,2,178,0,1,3,160,
+0,0,0,1,0,0,0,23,0,3,0,1,4,192,0,1,3,142,0,0,0,1,0,0,0,23,0,3,0,1,2,206,0,
+1,3,124,0,0,0,1,0,0,0,23,0,6,0,0,0,4,0,14,0,34,0,60,0,80,0,3,0,1,0,86,0,1,
+3,114,0,1,0,182,0,1,0,0,0,24,0,3,0,1,0,20,0,1,3,94,0,1,0,162,0,1,0,0,0,24,
+0,1,0,1,0,76,0,3,0,0,0,1,3,68,0,2,1,4,1,10,0,1,0,0,0,24,0,3,0,1,0,20,0,1,
+3,48,0,1,0,172,0,1,0,0,0,24,0,1,0,1,0,75,0,6,0,0,0,1,0,8,0,3,0,1,3,14,0,1,
+3,46,0,0,0,1,0,0,0,25,0,6,0,0,0,1,0,8,0,3,0,1,2,48,0,1,3,54,0,1,0,56,0,1,
+0,0,0,26,0,6,0,0,0,6,0,18,0,46,0,74,0,98,0,116,0,140,0,3,0,0,0,1,3,42,0,1,
+0,18,0,1,0,0,0,27,0,2,0,1,0,97,0,100,0,0,0,3,0,0,0,1,3,14,0,1,0,18,0,1,0,
+0,0,27,0,2,0,1,0,180,0,183,0,0,0,3,0,0,0,1,2,242,0,1,0,18,0,1,0,0,0,27,0,
+1,0,1,0,104,0,3,0,0,0,1,2,218,0,1,0,68,0,1,0,0,0,27,0,3,0,0,0,1,2,200,0,1,
+0,18,0,1,0,0,0,27,0,1,0,1,0,122,0,3,0,0,0,1,2,176,0,2,0,20,0,26,0,1,0,0,0,
+27,0,1,0,1,0,96,0,1,0,1,0,112,0,6,0,0,0,5,0,16,0,34,0,52,0,76,0,100,0,3,0,
+1,0,230,0,1,2,166,0,0,0,1,0,0,0,28,0,3,0,1,0,236,0,1,2,148,0,0,0,1,0,0,0,
+28,0,3,0,1,0,18,0,1,2,130,0,0,0,1,0,0,0,28,0,1,0,1,0,205,0,3,0,1,0,18,0,1,
+2,106,0,0,0,1,0,0,0,28,0,1,0,1,0,206,0,3,0,1,0,18,0,1,2,82,0,0,0,1,0,0,0,
+28,0,1,0,1,0,207,0,6,0,0,0,1,0,8,0,3,0,1,0,44,0,1,2,94,0,0,0,1,0,0,0,29,0,
+6,0,0,0,1,0,8,0,3,0,1,0,18,0,1,2,96,0,0,0,1,0,0,0,30,0,1,0,1,0,58,0,6,0,0,
+0,1,0,8,0,3,0,1,0,18,0,1,2,88,0,0,0,1,0,0,0,31,0,2,0,1,0,201,0,204,0,0,0,
+6,0,0,0,2,0,10,0,34,0,3,0,1,0,18,0,1,2,82,0,0,0,1,0,0,0,32,0,1,0,1,0,70,0,
+3,0,1,0,18,0,1,2,58,0,0,0,1,0,0,0,32,0,1,0,1,0,72,0,6,0,0,0,2,0,10,0,74,0,
+3,0,0,0,1,2,50,0,1,0,18,0,1,0,0,0,33,0,2,0,7,0,144,0,146,0,0,0,148,0,151,
+0,3,0,153,0,157,0,7,0,159,0,164,0,12,0,166,0,169,0,18,0,172,0,173,0,22,0,
+175,0,176,0,24,0,3,0,0,0,1,1,242,0,1,0,18,0,1,0,0,0,33,0,1,0,6,0,147,0,152,
+0,158,0,165,0,170,0,174,0,6,0,0,0,1,0,8,0,3,0,1,0,18,0,1,1,220,0,0,0,1,0,
+0,0,34,0,1,0,1,0,187,0,6,0,0,0,2,0,10,0,34,0,3,0,1,0,18,0,1,1,210,0,0,0,1,
+0,0,0,35,0,1,0,1,0,174,0,3,0,1,0,18,0,1,1,186,0,0,0,1,0,0,0,35,0,1,0,1,0,
+77,0,1,0,0,0,1,0,8,0,1,1,28,0,76,0,1,0,0,0,1,0,8,0,1,0,6,0,124,0,1,0,1,0,
+64,0,1,0,0,0,1,0,8,0,1,0,6,0,18,0,1,0,1,0,171,0,1,0,0,0,1,0,8,0,1,0,6,0,86,
+0,1,0,2,0,105,0,106,0,1,0,0,0,1,0,8,0,1,0,6,255,241,0,1,0,1,0,116,0,1,0,0,
+0,1,0,8,0,2,0,18,0,6,0,180,0,181,0,182,0,183,0,181,0,184,0,1,0,6,0,97,0,98,
+0,99,0,100,0,104,0,112,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,177,0,177,0,1,0,2,0,
+115,0,116,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,101,0,101,0,1,0,2,0,115,0,198,0,
+1,0,0,0,1,0,8,0,2,0,22,0,8,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,
+0,1,0,8,0,97,0,98,0,99,0,100,0,112,0,115,0,119,0,190,0,1,0,0,0,1,0,8,0,2,
+0,16,0,5,0,201,0,202,0,203,0,201,0,204,0,1,0,5,0,155,0,156,0,157,0,160,0,
+175,0,1,0,0,0,1,0,8,0,1,0,6,0,107,0,1,0,3,0,101,0,102,0,103,0,1,0,0,0,1,0,
+8,0,1,0,6,0,34,0,1,0,3,0,177,0,178,0,179,0,1,0,0,0,1,0,8,0,2,0,14,0,4,0,205,
+0,205,0,206,0,207,0,1,0,4,0,155,0,160,0,168,0,169,0,1,0,0,0,1,0,8,0,1,0,6,
+0,134,0,1,0,1,0,53,0,1,0,0,0,1,0,8,0,1,0,6,0,1,0,1,0,1,0,153,0,1,0,0,0,1,
+0,8,0,2,0,10,0,2,0,214,0,215,0,1,0,2,0,169,0,175,};
+#endif
@@ -0,0 +1,1388 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansLao_Regular_ttf_size = 34728;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansLao_Regular_ttf");
+asm(".type fz_font_NotoSansLao_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansLao_Regular_ttf, 34728");
+asm(".balign 64");
+asm("fz_font_NotoSansLao_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansLao-Regular.ttf\"");
+#else
+const int fz_font_NotoSansLao_Regular_ttf_size = 34728;
+const char fz_font_NotoSansLao_Regular_ttf[] = {
+0,1,0,0,0,15,0,128,0,3,0,112,71,68,69,70,0,16,0,162,0,0,128,16,0,0,0,22,71,
+80,79,83,0,21,0,10,0,0,128,40,0,0,0,12,71,83,85,66,153,44,147,116,0,0,128,
+52,0,0,4,138,79,83,47,50,112,163,233,110,0,0,1,120,0,0,0,86,99,109,97,112,
+183,233,179,33,0,0,4,104,0,0,1,18,103,97,115,112,255,255,0,3,0,0,128,8,0,
+0,0,8,103,108,121,102,238,181,12,32,0,0,6,204,0,0,110,240,104,101,97,100,
+255,195,148,227,0,0,0,252,0,0,0,54,104,104,101,97,10,198,3,31,0,0,1,52,0,
+0,0,36,104,109,116,120,46,239,191,239,0,0,1,208,0,0,2,152,108,111,99,97,231,
+198,204,47,0,0,5,124,0,0,1,78,109,97,120,112,0,183,0,148,0,0,1,88,0,0,0,32,
+109,111,114,120,96,113,237,247,0,0,132,192,0,0,2,232,110,97,109,101,113,112,
+163,36,0,0,117,188,0,0,5,30,112,111,115,116,118,41,13,142,0,0,122,220,0,0,
+5,42,0,1,0,0,0,1,7,174,197,170,200,210,95,15,60,245,0,11,8,0,0,0,0,0,203,
+21,99,117,0,0,0,0,210,255,223,209,251,176,252,167,6,223,8,75,0,0,0,8,0,2,
+0,0,0,0,0,0,0,1,0,0,8,52,252,224,0,0,7,135,251,176,254,17,6,223,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,166,0,1,0,0,0,166,0,146,0,16,0,0,0,0,0,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,3,96,1,144,0,5,0,0,5,154,5,51,0,0,1,27,5,154,
+5,51,0,0,3,209,0,102,2,18,0,0,2,0,5,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,71,79,79,71,0,64,0,1,37,204,8,52,252,224,0,0,8,52,3,32,32,0,1,17,
+65,0,0,0,0,0,0,0,0,0,2,128,0,0,2,128,0,0,2,39,0,147,3,55,0,133,5,43,0,51,
+4,104,0,123,6,154,0,102,5,158,0,109,1,207,0,133,2,104,0,82,2,104,0,61,4,104,
+0,82,4,104,0,102,2,0,0,63,2,147,0,82,2,37,0,147,2,252,0,20,4,104,0,98,4,104,
+0,178,4,104,0,96,4,104,0,82,4,104,0,23,4,104,0,131,4,104,0,113,4,104,0,90,
+4,104,0,106,4,104,0,106,2,37,0,147,2,37,0,63,4,104,0,102,4,104,0,102,4,104,
+0,102,3,104,0,37,6,238,0,109,5,117,0,147,5,24,0,147,5,45,0,147,3,109,0,147,
+5,45,0,147,5,24,0,147,5,45,0,147,5,66,0,168,5,64,0,168,5,136,0,100,5,235,
+0,147,5,45,0,147,5,45,0,147,5,1,0,147,5,74,0,168,5,50,0,168,5,63,0,147,5,
+29,0,147,5,138,0,100,4,254,0,147,5,24,0,147,5,45,0,147,5,45,0,147,5,45,0,
+147,5,235,0,147,5,45,0,147,5,24,0,147,5,24,0,147,4,107,0,147,0,0,252,90,3,
+60,0,147,3,60,253,105,0,0,251,176,0,0,251,176,0,0,251,176,0,0,251,176,0,0,
+253,161,0,0,253,69,0,0,252,90,0,0,252,6,4,20,0,100,2,206,0,168,4,215,0,168,
+3,65,0,0,3,181,0,0,3,73,0,0,5,19,0,147,0,0,253,32,0,0,252,144,0,0,252,90,
+0,0,252,200,0,0,253,5,0,0,252,190,4,107,0,147,5,24,0,147,5,24,0,147,5,28,
+0,100,5,24,0,147,5,24,0,147,5,99,0,168,4,191,0,147,5,66,0,168,5,133,0,168,
+7,135,0,147,7,135,0,147,0,0,254,18,0,0,252,158,0,0,252,219,0,0,253,197,0,
+0,253,198,0,0,252,251,0,0,252,134,0,0,252,251,5,117,0,147,5,24,0,147,5,45,
+0,147,3,109,0,147,5,45,0,147,4,244,0,147,5,45,0,147,5,66,0,168,5,64,0,168,
+5,136,0,100,5,235,0,147,5,45,0,147,5,45,0,147,5,1,0,147,5,74,0,168,5,50,0,
+168,5,65,0,147,5,28,0,147,5,138,0,100,4,254,0,147,5,24,0,147,5,45,0,147,5,
+45,0,147,5,45,0,147,5,235,0,147,5,45,0,147,5,24,0,147,7,135,0,147,7,135,0,
+147,3,60,0,147,0,0,252,251,0,0,252,240,0,0,255,89,0,0,255,17,0,0,254,68,0,
+0,254,78,0,0,254,78,0,0,254,79,0,0,254,88,0,0,254,88,3,109,0,147,3,111,0,
+147,0,5,252,6,0,5,252,6,0,0,255,210,0,0,254,182,0,0,254,238,0,0,255,82,0,
+0,253,224,0,0,252,238,0,0,252,219,0,0,253,97,0,5,253,180,0,5,253,190,5,117,
+0,147,5,45,0,147,0,0,0,0,4,193,0,98,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,6,0,0,
+0,52,0,32,0,4,0,20,0,15,0,64,0,160,0,173,3,126,14,130,14,132,14,136,14,138,
+14,141,14,151,14,159,14,163,14,165,14,167,14,171,14,185,14,189,14,196,14,
+198,14,205,14,217,14,223,32,11,37,204,255,255,0,0,0,1,0,32,0,160,0,173,3,
+126,14,129,14,132,14,135,14,138,14,141,14,148,14,153,14,161,14,165,14,167,
+14,170,14,173,14,187,14,192,14,198,14,200,14,208,14,220,32,11,37,204,255,
+255,0,0,255,226,255,98,255,98,252,159,241,162,241,161,241,159,241,158,241,
+156,241,150,241,149,241,148,241,147,241,146,241,144,241,143,241,142,241,140,
+241,139,241,138,241,136,0,0,224,153,218,217,0,1,0,52,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,
+0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,98,
+0,99,0,162,0,163,0,0,0,0,0,0,0,0,0,0,0,40,0,62,0,122,0,217,1,57,1,177,1,192,
+1,226,2,4,2,40,2,64,2,89,2,102,2,134,2,150,2,213,2,244,3,43,3,123,3,167,3,
+231,4,63,4,82,4,188,5,18,5,75,5,126,5,147,5,167,5,188,6,16,6,161,6,242,7,
+85,7,156,7,216,8,44,8,151,8,221,9,19,9,87,9,174,9,241,10,54,10,109,10,178,
+11,25,11,108,11,182,12,15,12,80,12,183,13,39,13,114,13,209,14,59,14,152,15,
+58,15,152,15,203,16,78,16,158,16,202,17,26,17,103,17,180,18,16,18,114,18,
+182,18,250,19,69,19,150,20,41,20,87,20,173,21,6,21,81,21,172,22,21,22,34,
+22,105,22,200,22,221,23,48,23,98,23,147,24,1,24,106,24,189,25,39,25,196,26,
+84,26,165,27,53,27,135,28,5,28,143,28,156,28,228,29,67,29,88,29,171,29,221,
+30,79,30,136,31,5,31,148,32,7,32,111,32,239,33,133,33,247,34,89,34,201,35,
+76,35,187,36,44,36,143,37,0,37,146,38,16,38,133,39,9,39,117,40,7,40,162,41,
+25,41,164,42,57,42,194,43,144,44,26,44,196,45,118,45,162,45,226,46,108,46,
+175,46,242,47,62,47,140,47,232,48,73,48,152,48,226,49,92,49,213,50,100,50,
+243,51,0,51,70,51,165,51,185,51,198,52,14,52,109,52,130,53,17,53,160,54,66,
+54,209,54,209,55,120,0,0,0,2,0,147,255,227,1,145,5,182,0,3,0,23,0,0,1,35,
+3,51,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,80,121,51,223,240,20,34,
+46,27,26,47,34,20,20,34,47,26,27,46,34,20,1,158,4,24,250,185,38,53,33,15,
+15,33,53,38,37,53,34,16,16,34,53,0,0,2,0,133,3,166,2,178,5,182,0,3,0,7,0,
+0,1,3,35,3,33,3,35,3,1,74,41,115,41,2,45,41,114,41,5,182,253,240,2,16,253,
+240,2,16,0,2,0,51,0,0,4,248,5,182,0,27,0,31,0,0,1,3,33,21,33,3,35,19,33,3,
+35,19,33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,19,33,3,215,63,1,
+24,254,205,82,147,84,254,221,82,144,78,254,254,1,29,65,254,238,1,43,82,147,
+82,1,37,84,144,84,1,6,252,235,1,35,64,254,221,3,125,254,184,137,254,84,1,
+172,254,84,1,172,137,1,72,137,1,176,254,80,1,176,254,80,137,254,184,1,72,
+0,0,3,0,123,255,137,3,217,6,18,0,45,0,54,0,63,0,0,1,20,14,2,7,21,35,53,34,
+46,2,39,53,30,3,51,17,46,3,53,52,62,2,55,53,51,21,22,22,23,7,38,38,39,17,
+30,3,7,52,46,2,39,17,54,54,1,20,30,2,23,17,6,6,3,217,50,93,133,84,138,50,
+102,96,84,32,33,87,96,101,47,89,131,86,42,49,91,129,79,138,100,169,67,66,
+56,140,74,88,135,91,46,176,20,43,70,51,93,91,254,18,17,40,66,49,89,83,1,190,
+70,114,84,55,12,230,221,9,18,26,17,172,16,33,26,17,1,178,30,66,85,110,74,
+67,111,83,53,9,180,176,5,42,31,145,25,41,6,254,90,31,66,83,107,72,33,55,45,
+38,18,254,139,14,98,2,163,36,57,47,38,17,1,113,16,89,0,0,5,0,102,255,236,
+6,51,5,203,0,9,0,29,0,39,0,59,0,63,0,0,19,20,22,51,50,17,16,35,34,6,5,20,
+14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,20,22,51,50,17,16,35,34,6,5,20,14,
+2,35,34,46,2,53,52,62,2,51,50,30,2,1,1,35,1,250,71,80,156,156,80,71,1,199,
+36,74,115,79,73,112,76,38,35,73,113,78,75,113,77,39,1,172,71,80,156,156,80,
+71,1,198,35,74,115,79,74,112,75,38,35,73,113,78,75,113,76,39,255,0,252,213,
+158,3,44,4,2,165,165,1,74,1,72,163,165,108,172,118,63,63,118,172,108,108,
+170,117,62,62,117,170,253,74,165,164,1,73,1,72,163,165,108,171,118,63,63,
+118,171,108,108,170,117,62,62,117,170,3,146,250,74,5,182,0,3,0,109,255,236,
+5,125,5,205,0,17,0,33,0,83,0,0,1,20,30,2,23,62,3,53,52,46,2,35,34,6,19,50,
+62,2,55,1,14,3,21,20,30,2,37,52,62,2,55,46,3,53,52,62,2,51,50,30,2,21,20,
+14,2,7,1,62,3,55,51,14,3,7,1,35,39,14,3,35,34,46,2,1,166,16,33,52,36,59,86,
+56,28,25,47,66,42,86,100,135,58,98,84,72,32,254,125,52,80,55,28,35,66,96,
+254,125,40,77,111,71,31,60,45,28,50,94,138,88,83,131,91,48,50,84,109,60,1,
+96,27,43,34,27,10,184,15,41,53,65,39,1,21,225,168,49,96,108,124,78,105,167,
+115,61,4,141,34,65,65,67,37,35,62,64,70,41,36,61,44,25,89,251,175,23,40,54,
+31,1,151,33,63,72,85,56,54,91,65,36,240,78,122,100,86,42,36,77,87,99,57,75,
+119,83,43,43,83,119,75,64,109,93,79,36,254,140,29,60,68,78,47,66,111,98,85,
+41,254,219,172,45,71,49,27,53,103,149,0,1,0,133,3,166,1,74,5,182,0,3,0,0,
+1,3,35,3,1,74,41,115,41,5,182,253,240,2,16,0,0,1,0,82,254,188,2,43,5,182,
+0,19,0,0,19,52,62,2,55,51,6,2,21,20,30,2,23,35,46,3,82,36,74,113,78,172,140,
+145,37,71,106,69,170,78,113,74,36,2,49,125,243,229,211,93,193,254,50,244,
+119,236,226,212,94,90,206,225,240,0,0,1,0,61,254,188,2,23,5,182,0,19,0,0,
+1,20,14,2,7,35,62,3,53,52,2,39,51,30,3,2,23,36,75,113,78,170,69,106,72,36,
+144,141,172,78,113,75,36,2,49,124,240,225,206,90,94,212,226,236,119,244,1,
+206,193,93,211,229,243,0,0,1,0,82,2,119,4,20,6,20,0,14,0,0,1,3,37,23,5,19,
+7,3,3,39,19,37,55,5,3,2,152,43,1,141,26,254,134,245,178,176,158,184,242,254,
+137,29,1,135,43,6,20,254,119,111,193,28,254,186,96,1,102,254,154,96,1,70,
+28,193,111,1,137,0,0,1,0,102,1,6,4,2,4,162,0,11,0,0,1,33,53,33,17,51,17,33,
+21,33,17,35,1,233,254,125,1,131,150,1,131,254,125,150,2,135,150,1,133,254,
+123,150,254,127,0,1,0,63,254,248,1,121,0,238,0,12,0,0,37,23,14,3,7,35,62,
+3,55,1,106,15,14,39,47,51,25,138,15,29,27,22,8,238,23,54,122,124,123,56,61,
+132,131,125,53,0,0,1,0,82,1,209,2,66,2,121,0,3,0,0,19,53,33,21,82,1,240,1,
+209,168,168,0,0,1,0,147,255,227,1,145,0,250,0,19,0,0,55,52,62,2,51,50,30,
+2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,
+20,111,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,0,1,0,20,0,0,2,231,
+5,182,0,3,0,0,1,1,35,1,2,231,253,224,179,2,33,5,182,250,74,5,182,0,0,2,0,
+98,255,236,4,8,5,205,0,19,0,39,0,0,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,
+51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,4,8,51,113,178,
+127,118,175,115,57,51,111,177,126,119,176,116,58,253,19,30,66,107,77,77,108,
+69,31,31,69,108,77,77,107,66,30,2,221,177,254,232,194,102,102,194,1,24,177,
+177,1,24,193,102,101,193,254,232,178,150,224,149,75,74,148,225,151,150,224,
+148,74,74,148,224,0,0,1,0,178,0,0,2,199,5,182,0,16,0,0,33,35,17,52,62,2,55,
+14,3,7,7,39,1,51,2,199,176,1,3,3,1,17,26,27,30,21,148,96,1,127,150,3,145,
+43,98,97,89,34,18,26,24,27,18,121,123,1,43,0,0,1,0,96,0,0,3,240,5,203,0,35,
+0,0,33,33,53,1,62,3,53,52,46,2,35,34,6,7,39,62,3,51,50,30,2,21,20,14,2,7,
+1,21,33,3,240,252,112,1,94,75,118,83,44,34,63,86,53,95,153,69,102,40,92,106,
+118,65,96,155,108,59,53,93,129,75,254,231,2,177,156,1,125,81,134,128,129,
+76,59,90,63,32,77,60,119,36,63,46,27,54,101,145,91,85,154,149,150,81,254,
+213,8,0,0,1,0,82,255,236,3,238,5,203,0,57,0,0,1,20,14,2,7,21,22,22,21,20,
+14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,46,2,35,35,53,51,50,62,2,53,52,
+46,2,35,34,6,7,39,62,3,51,50,30,2,3,193,46,83,116,71,177,184,65,132,202,138,
+109,193,85,87,203,93,92,134,87,41,53,98,141,89,133,133,81,126,85,44,36,66,
+92,56,107,163,74,92,38,93,110,125,70,108,163,110,56,4,96,73,120,88,57,12,
+6,22,181,145,96,160,116,64,34,45,170,46,50,40,74,108,67,68,97,63,30,151,40,
+74,102,61,52,82,57,30,67,54,125,31,54,41,24,54,97,133,0,0,2,0,23,0,0,4,63,
+5,190,0,10,0,24,0,0,1,35,17,35,17,33,53,1,51,17,51,33,17,52,62,2,55,35,14,
+3,7,1,4,63,213,176,253,93,2,151,188,213,254,123,3,4,5,1,9,7,21,25,26,11,254,
+101,1,72,254,184,1,72,159,3,215,252,48,1,100,56,123,117,102,34,20,49,49,46,
+16,253,160,0,0,1,0,131,255,236,3,246,5,182,0,42,0,0,1,50,30,2,21,20,14,2,
+35,34,46,2,39,53,30,3,51,50,62,2,53,52,38,35,34,14,2,7,39,19,33,21,33,3,54,
+54,2,33,99,171,127,72,68,134,197,128,51,99,91,82,33,33,89,98,99,42,79,124,
+86,46,176,168,27,63,63,57,21,90,55,2,178,253,236,39,32,105,3,129,55,108,160,
+105,114,182,126,67,10,19,30,20,172,23,36,24,13,37,78,118,81,143,151,5,8,9,
+4,57,2,176,166,254,93,6,14,0,0,2,0,113,255,236,4,10,5,203,0,43,0,63,0,0,19,
+52,62,4,51,50,30,2,23,21,38,38,35,34,14,4,7,51,62,3,51,50,30,2,21,20,14,2,
+35,34,46,2,1,50,62,2,53,52,46,2,35,34,14,2,21,20,30,2,113,21,53,92,142,198,
+133,19,46,47,43,17,35,88,43,90,137,100,67,42,20,3,12,20,57,76,95,59,95,154,
+108,59,62,116,164,102,100,175,128,74,1,219,60,99,72,39,33,66,99,66,67,111,
+78,43,37,73,110,2,113,105,208,191,164,121,69,2,5,7,5,155,12,12,43,78,108,
+131,148,80,36,63,45,26,59,114,165,106,114,182,127,68,78,160,242,254,185,41,
+83,127,87,70,111,78,42,47,75,96,48,67,133,106,67,0,0,1,0,90,0,0,4,6,5,182,
+0,6,0,0,33,1,33,53,33,21,1,1,25,2,51,253,14,3,172,253,213,5,16,166,145,250,
+219,0,0,3,0,106,255,236,4,0,5,205,0,39,0,58,0,74,0,0,1,50,30,2,21,20,14,2,
+7,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,46,3,53,52,62,2,3,20,30,2,51,50,
+62,2,53,52,46,2,39,39,6,6,1,34,6,21,20,30,2,23,62,3,53,52,38,2,53,84,149,
+113,66,40,70,96,56,58,111,87,53,67,121,169,102,110,171,117,61,45,76,104,58,
+49,86,63,37,67,114,149,199,32,68,104,72,70,107,72,36,39,73,102,63,30,126,
+128,1,22,106,125,35,62,87,51,48,85,63,36,126,5,205,44,88,132,88,67,108,87,
+69,28,31,76,95,118,73,92,149,104,56,54,101,146,92,75,120,96,74,28,31,73,90,
+109,66,87,131,88,44,251,166,53,89,63,35,35,65,92,56,52,84,72,64,31,14,60,
+155,3,84,106,101,57,82,64,51,24,22,52,66,84,54,101,106,0,0,2,0,106,255,236,
+4,4,5,203,0,41,0,61,0,0,1,20,14,4,35,34,46,2,39,53,22,22,51,50,62,2,55,35,
+14,3,35,34,46,2,53,52,62,2,51,50,30,2,1,34,14,2,21,20,30,2,51,50,62,2,53,
+52,46,2,4,4,21,53,92,142,198,133,19,46,46,44,17,35,88,43,135,174,102,43,5,
+13,20,56,76,96,59,95,154,108,59,63,115,165,102,101,174,128,74,254,37,60,99,
+72,39,33,66,99,66,68,110,78,43,37,73,110,3,70,105,209,190,165,120,69,2,5,
+6,5,156,13,12,94,161,214,119,36,62,46,26,59,114,165,106,114,183,127,68,78,
+160,243,1,71,40,84,127,87,70,111,78,42,47,75,96,48,67,133,107,66,0,2,0,147,
+255,227,1,145,4,102,0,19,0,39,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,
+46,2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,
+20,20,34,47,26,27,46,34,20,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,
+111,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,3,145,39,53,33,14,14,33,
+53,39,37,52,34,16,16,34,52,0,2,0,63,254,248,1,145,4,102,0,12,0,32,0,0,37,
+23,14,3,7,35,62,3,55,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,106,15,
+14,39,47,51,25,138,15,29,27,22,8,17,20,34,46,27,26,47,34,20,20,34,47,26,27,
+46,34,20,238,23,54,122,124,123,56,61,132,131,125,53,2,237,39,53,33,14,14,
+33,53,39,37,52,34,16,16,34,52,0,0,1,0,102,0,238,4,2,4,221,0,6,0,0,37,1,53,
+1,21,1,1,4,2,252,100,3,156,253,33,2,223,238,1,168,102,1,225,160,254,148,254,
+190,0,2,0,102,1,186,4,2,3,233,0,3,0,7,0,0,19,53,33,21,1,53,33,21,102,3,156,
+252,100,3,156,3,84,149,149,254,102,150,150,0,0,1,0,102,0,238,4,2,4,221,0,
+6,0,0,19,1,1,53,1,21,1,102,2,224,253,32,3,156,252,100,1,143,1,66,1,108,160,
+254,31,102,254,88,0,2,0,37,255,227,3,37,5,203,0,39,0,59,0,0,1,53,52,62,2,
+55,62,3,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,20,14,2,7,14,3,21,21,
+3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,25,15,39,66,50,48,68,43,21,30,
+57,85,56,83,150,70,63,81,188,97,93,149,104,56,27,54,80,54,52,66,38,14,187,
+20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,1,158,37,57,92,80,77,42,41,
+67,69,79,53,48,79,57,31,52,34,145,42,59,51,96,139,87,67,105,90,84,47,45,67,
+63,66,44,18,254,209,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,2,0,109,
+255,74,6,129,5,182,0,86,0,103,0,0,1,20,14,4,35,34,46,2,39,35,14,3,35,34,46,
+2,53,52,62,2,51,50,30,2,23,3,6,6,21,21,20,30,2,51,50,62,2,53,52,46,2,35,34,
+4,6,2,21,20,30,2,51,50,62,2,55,21,6,6,35,34,36,38,2,53,52,18,54,36,51,50,
+4,22,18,1,20,22,51,50,62,2,55,55,38,38,35,34,14,2,6,129,19,37,57,76,97,58,
+45,73,52,33,6,4,18,54,71,89,53,77,119,82,43,59,111,158,98,45,90,82,69,23,
+23,1,1,21,34,43,23,46,70,47,24,86,152,209,123,169,254,254,175,90,79,153,227,
+147,61,119,111,100,43,86,216,130,179,254,231,195,102,118,219,1,55,193,156,
+1,6,191,106,252,21,101,85,55,78,50,26,4,14,28,77,42,74,101,63,28,2,219,62,
+125,113,97,72,41,30,50,65,35,37,66,49,28,56,101,142,86,101,168,122,68,8,14,
+17,8,254,96,22,27,8,19,53,68,40,15,61,104,140,78,142,221,152,79,111,199,254,
+239,162,151,234,160,82,14,24,31,17,141,38,44,102,195,1,25,179,188,1,69,238,
+136,101,189,254,241,254,213,133,119,45,83,115,69,253,8,13,58,94,120,0,3,0,
+147,0,0,4,205,4,116,0,7,0,17,0,52,0,0,36,53,52,35,34,21,20,51,3,34,21,20,
+23,22,51,50,55,38,19,6,7,38,39,54,55,54,51,50,23,17,6,7,38,53,52,55,50,23,
+54,55,4,19,17,20,35,34,53,17,38,39,6,6,7,1,122,64,64,64,5,60,41,7,8,34,39,
+8,143,7,185,165,9,16,113,21,17,41,23,32,30,169,156,139,71,164,164,1,104,28,
+67,68,1,252,171,137,20,94,61,60,60,61,3,182,43,45,6,1,25,64,252,157,158,13,
+3,158,130,26,3,16,2,27,4,4,14,144,142,5,108,103,5,9,254,248,252,192,35,42,
+3,54,134,17,22,80,21,0,0,2,0,147,0,0,4,133,4,116,0,7,0,67,0,0,1,34,21,20,
+51,50,53,52,2,38,53,52,37,55,36,53,38,38,35,32,7,54,51,50,21,22,21,20,7,38,
+53,16,33,22,23,22,23,22,23,22,21,20,5,7,6,21,22,22,51,50,36,51,50,23,23,22,
+23,21,20,35,34,39,38,38,35,34,4,7,1,122,68,68,67,130,168,1,37,212,1,116,5,
+181,215,254,217,42,40,51,168,2,179,221,1,220,141,72,85,71,71,48,46,254,54,
+239,181,1,81,51,62,1,77,82,100,84,38,28,8,50,57,3,8,87,51,61,254,172,76,3,
+68,69,69,69,69,252,188,145,95,208,84,62,100,124,86,105,122,42,141,16,14,150,
+2,6,225,1,47,2,12,15,37,37,62,63,97,216,128,68,53,110,38,69,121,84,44,43,
+41,10,32,26,20,75,119,2,0,2,0,147,0,0,4,133,4,116,0,7,0,49,0,0,36,35,34,21,
+20,51,50,53,37,52,55,38,53,16,33,32,19,17,20,35,34,53,17,52,33,32,21,20,22,
+23,50,21,20,35,34,7,6,21,21,55,54,51,50,21,22,21,20,7,38,17,1,204,71,71,71,
+71,254,199,166,166,1,248,1,248,2,67,68,254,144,254,142,125,64,79,40,40,125,
+63,9,42,74,156,2,178,242,225,67,68,68,222,159,63,63,168,1,51,254,159,253,
+22,41,41,2,236,227,183,105,69,2,55,55,32,40,95,118,13,42,139,16,15,145,2,
+6,1,33,0,0,2,0,147,254,90,2,197,4,116,0,7,0,40,0,0,0,21,20,51,50,53,52,35,
+2,38,53,52,51,51,22,23,62,3,53,17,52,39,22,21,20,35,6,35,34,39,54,51,32,17,
+17,20,6,6,7,1,22,69,69,69,117,83,35,7,42,31,93,103,86,30,107,42,141,16,15,
+151,20,26,225,1,36,141,169,144,3,204,70,70,70,70,250,144,9,68,61,7,1,4,27,
+77,98,104,3,46,149,13,41,53,173,2,185,228,254,200,252,48,81,142,47,4,0,2,
+0,147,0,0,4,133,4,116,0,9,0,59,0,0,1,21,20,51,51,54,53,52,35,34,3,32,21,20,
+35,34,53,16,33,32,17,20,7,17,20,7,38,39,38,53,52,55,54,53,6,35,35,38,39,53,
+52,55,51,50,23,22,21,20,7,6,7,6,21,20,23,51,50,55,17,52,2,154,74,2,78,75,
+76,7,254,152,77,78,2,7,1,235,1,221,152,44,21,29,52,22,66,6,170,5,188,3,199,
+29,9,37,56,4,1,75,10,68,8,2,69,5,65,1,70,69,1,103,163,44,44,1,37,254,209,
+17,18,253,171,203,2,5,102,47,45,54,51,95,5,20,26,168,10,159,32,147,50,44,
+87,66,99,71,4,4,65,13,80,2,81,208,0,2,0,147,254,122,4,133,4,116,0,7,0,74,
+0,0,0,35,34,21,20,51,50,53,1,52,38,35,34,7,6,35,34,38,53,52,37,55,36,53,38,
+33,32,7,54,51,50,21,22,21,20,7,38,53,16,33,51,32,17,20,5,7,6,21,20,22,51,
+50,55,54,51,50,22,21,17,22,22,23,22,21,20,7,6,35,34,39,38,38,39,38,53,1,178,
+65,66,66,65,2,46,41,51,95,98,164,157,134,105,1,60,208,1,65,5,254,131,254,
+227,39,38,49,162,2,173,213,1,200,6,2,0,254,104,220,219,42,68,107,146,147,
+115,105,117,2,19,9,6,1,4,52,72,7,14,13,1,1,3,65,69,69,69,253,100,74,61,87,
+144,125,91,167,114,77,111,160,165,126,42,141,16,14,150,2,6,225,1,50,254,214,
+253,140,82,76,75,44,39,116,115,137,131,254,199,49,91,11,7,5,2,2,6,21,31,85,
+49,18,127,0,0,2,0,147,0,0,4,133,4,116,0,7,0,48,0,0,1,52,35,34,21,20,51,50,
+2,33,32,53,17,52,51,50,21,3,2,33,32,17,52,55,38,53,53,16,55,22,21,20,7,20,
+35,34,39,39,21,20,22,51,50,21,20,35,34,6,21,1,204,71,71,71,71,176,1,114,1,
+112,68,67,1,1,254,8,254,8,166,166,242,178,2,156,74,42,9,125,72,71,71,72,125,
+3,214,68,68,67,252,233,219,2,254,31,30,253,1,254,169,1,100,159,62,63,159,
+46,1,33,6,2,145,15,16,139,42,13,79,95,68,58,59,68,95,0,0,2,0,168,0,0,4,154,
+4,116,0,7,0,34,0,0,36,35,34,21,20,51,50,53,1,16,33,32,17,17,20,35,34,53,17,
+16,33,32,17,17,55,54,51,50,21,22,21,20,7,38,17,1,225,71,71,71,71,254,199,
+1,251,1,247,67,68,254,144,254,142,9,42,74,156,2,178,242,225,67,68,68,2,65,
+1,149,254,107,253,66,33,33,2,190,1,25,254,231,254,39,13,42,139,16,15,145,
+2,6,1,33,0,2,0,168,0,0,4,152,4,116,0,7,0,46,0,0,37,34,21,20,51,50,53,52,1,
+17,20,35,34,53,17,16,35,34,7,6,35,34,39,38,35,34,17,17,55,54,51,50,21,22,
+21,20,7,38,17,17,16,33,50,23,54,51,32,1,151,71,71,71,2,186,67,68,114,92,77,
+46,41,41,46,76,93,112,9,42,74,155,2,178,239,1,0,125,122,122,125,1,2,225,67,
+68,68,67,1,254,253,66,33,33,2,190,1,25,104,63,63,104,254,231,254,39,13,42,
+139,16,15,145,2,6,1,33,1,184,1,149,157,157,0,3,0,100,254,112,5,15,4,116,0,
+7,0,16,0,59,0,0,37,34,21,20,51,50,53,52,1,34,21,20,23,51,50,55,38,5,38,37,
+6,15,2,17,54,51,50,21,20,35,35,34,53,17,6,35,34,53,52,55,22,23,54,55,4,17,
+17,20,22,23,22,21,6,35,34,46,2,53,2,53,71,71,70,254,149,62,69,14,32,29,9,
+2,255,10,254,246,119,113,70,40,25,25,210,210,14,171,50,26,183,180,139,58,
+182,187,1,146,9,30,8,4,43,71,23,27,15,244,75,75,75,75,3,28,45,46,2,7,86,230,
+189,7,5,53,33,21,253,211,3,175,175,166,2,188,16,147,143,10,10,102,102,10,
+17,254,199,252,100,72,135,54,10,6,9,22,78,105,98,0,0,2,0,147,0,0,5,67,4,116,
+0,7,0,44,0,0,1,50,53,52,35,34,21,20,19,22,51,50,55,17,16,33,32,17,17,20,35,
+34,53,3,38,35,34,21,17,16,33,32,17,52,55,54,55,38,53,52,51,50,21,20,2,1,61,
+64,64,64,30,8,197,197,8,1,52,1,90,67,68,4,5,189,185,254,171,254,171,116,40,
+27,183,185,187,228,3,127,73,74,74,73,253,217,213,222,1,193,1,82,254,158,253,
+16,34,34,2,242,221,223,254,79,254,159,1,88,198,155,52,47,2,170,172,172,146,
+254,188,0,0,2,0,147,0,0,4,133,4,116,0,7,0,47,0,0,0,51,50,53,52,35,34,21,19,
+22,23,22,51,50,53,17,52,51,50,21,17,16,33,34,39,38,39,6,35,35,38,53,52,62,
+2,55,17,6,35,34,53,52,55,22,21,17,20,1,3,59,59,59,59,243,70,54,88,112,204,
+64,63,254,181,152,89,57,56,68,173,9,27,26,110,37,9,29,21,180,180,179,3,125,
+74,73,73,253,66,18,47,76,173,3,43,32,34,252,210,254,220,80,52,19,147,1,52,
+52,7,13,112,98,1,203,3,172,171,2,2,171,253,139,39,0,0,2,0,147,0,0,4,133,4,
+116,0,7,0,34,0,0,1,50,53,52,35,34,21,20,19,20,33,32,17,17,52,51,50,21,3,2,
+33,32,17,52,55,54,55,38,53,52,55,22,21,20,2,1,54,61,61,61,35,1,114,1,112,
+68,67,1,1,254,8,254,8,112,38,25,175,178,178,219,3,125,74,73,73,74,253,218,
+219,1,12,2,201,35,35,253,52,254,123,1,87,198,155,52,47,2,170,171,2,2,171,
+147,254,189,0,2,0,147,0,0,4,123,5,185,0,7,0,46,0,0,1,50,53,52,35,34,21,20,
+1,52,55,62,2,51,50,21,20,7,14,2,21,17,16,33,32,17,52,55,54,55,38,53,52,51,
+51,50,21,20,2,21,20,33,32,17,17,1,46,58,58,58,2,226,2,1,13,21,69,59,2,12,
+15,5,254,27,254,31,107,36,24,167,168,4,171,209,1,93,1,95,3,123,75,75,75,75,
+1,16,57,41,49,85,70,17,3,4,24,88,110,73,253,22,254,112,1,94,202,148,53,38,
+2,173,174,174,149,254,202,157,215,1,9,2,251,0,0,3,0,168,0,0,4,176,4,186,0,
+7,0,15,0,73,0,0,1,52,35,34,21,20,51,50,33,54,55,38,35,34,7,22,3,6,35,32,17,
+17,16,55,22,21,21,6,7,34,39,17,20,51,50,53,53,52,51,50,21,7,21,20,51,50,53,
+17,6,35,38,39,52,55,50,23,54,53,52,39,53,52,51,50,22,23,6,7,22,21,17,16,33,
+34,1,206,64,65,65,64,1,245,61,13,24,50,61,7,7,220,70,152,254,220,230,169,
+19,133,66,46,159,153,67,67,3,151,154,26,77,143,16,178,77,40,8,1,46,48,13,
+2,2,31,19,254,231,152,3,221,64,64,63,16,50,56,69,53,252,201,103,1,79,2,13,
+1,16,8,4,155,11,139,6,48,253,230,208,182,65,50,57,44,7,189,208,2,18,40,6,
+143,154,12,44,35,29,10,10,2,28,31,38,47,85,63,91,253,248,254,177,0,0,2,0,
+168,0,0,4,165,5,185,0,7,0,60,0,0,1,52,35,34,21,20,51,50,1,16,33,34,39,6,35,
+32,17,17,16,55,51,50,21,21,6,7,35,34,53,17,20,51,50,53,53,52,51,50,23,7,21,
+20,51,50,53,17,51,52,55,62,2,51,50,21,20,7,14,2,21,1,188,63,63,63,63,2,206,
+254,224,149,68,68,147,254,238,213,2,166,14,136,13,86,144,146,68,67,1,3,148,
+154,1,2,1,12,20,69,59,2,11,13,1,3,214,69,69,69,253,218,254,149,101,101,1,
+107,1,223,1,39,3,167,10,134,9,26,254,29,228,184,81,60,59,59,15,192,228,3,
+32,57,41,49,85,70,18,3,3,24,88,110,73,0,0,2,0,147,0,0,4,151,4,116,0,7,0,51,
+0,0,1,50,53,52,35,34,21,20,19,50,53,17,52,51,50,21,3,21,20,51,50,55,17,52,
+51,50,21,3,2,33,34,39,6,35,32,17,52,55,54,55,38,53,52,55,22,21,20,2,21,21,
+20,51,1,39,56,56,55,203,148,68,67,3,156,160,3,68,65,3,5,254,228,152,72,71,
+142,254,213,102,34,24,160,163,162,190,159,3,125,74,73,73,74,253,9,201,3,13,
+24,24,252,252,13,197,222,2,248,24,25,253,8,254,157,99,99,1,87,218,135,52,
+47,2,170,171,2,2,171,147,254,208,174,7,201,0,0,2,0,147,0,0,4,144,5,185,0,
+7,0,63,0,0,1,50,53,52,35,34,21,20,1,16,5,34,39,6,35,32,17,52,55,54,55,38,
+53,52,55,22,21,20,2,21,22,51,50,53,52,39,17,52,51,50,21,17,20,51,50,53,52,
+39,17,51,52,55,62,2,51,50,21,20,7,14,2,21,1,55,52,52,52,3,113,254,233,144,
+67,66,132,254,233,95,32,22,175,178,171,192,4,148,130,1,66,66,145,147,1,1,
+2,1,11,19,68,58,2,11,12,3,3,140,67,66,66,67,253,195,254,184,7,101,101,1,94,
+202,138,53,48,12,173,175,2,11,175,149,254,201,157,215,183,15,17,2,246,26,
+26,252,153,102,201,13,14,3,32,57,41,49,85,70,18,3,3,24,88,110,73,0,0,2,0,
+100,0,0,4,226,4,116,0,8,0,45,0,0,55,21,20,51,50,55,52,35,34,5,6,35,34,39,
+54,51,51,22,21,21,20,7,50,55,17,52,51,50,21,3,21,20,33,22,51,50,55,17,52,
+51,50,21,17,2,33,34,192,41,41,1,41,42,1,61,71,157,176,5,2,136,2,129,27,83,
+12,68,67,1,1,15,15,15,224,19,68,67,18,254,121,227,193,2,47,49,49,154,88,193,
+133,1,111,13,45,24,161,3,51,28,28,252,204,1,156,1,160,3,50,28,27,252,203,
+254,220,0,0,2,0,147,0,0,4,123,5,185,0,7,0,72,0,0,1,38,35,6,7,22,51,50,1,2,
+33,32,17,38,53,52,55,38,53,52,55,53,16,55,22,21,20,7,20,35,38,39,21,6,21,
+20,23,22,51,50,21,6,35,34,7,6,21,20,23,21,20,33,51,32,53,17,51,52,55,54,54,
+55,54,51,51,22,21,20,7,14,2,21,1,198,3,66,56,7,3,63,66,2,144,7,254,35,254,
+34,1,129,129,1,230,169,2,148,83,33,1,49,57,81,80,1,80,81,57,48,1,1,69,42,
+1,73,1,2,1,13,11,10,69,2,61,2,12,15,8,3,208,61,3,58,69,253,210,254,163,1,
+87,12,11,153,63,57,136,10,10,47,1,39,3,14,136,14,15,141,2,54,81,13,11,67,
+26,30,68,68,30,26,82,14,16,4,206,216,3,45,57,41,49,85,35,35,1,18,3,3,24,88,
+110,73,0,2,0,147,0,0,4,133,4,116,0,7,0,76,0,0,0,35,34,21,20,51,50,53,19,54,
+51,50,23,30,4,23,22,21,20,7,6,35,34,39,46,4,39,6,6,7,21,20,23,5,4,17,20,7,
+6,7,6,7,6,7,32,17,52,55,22,21,20,7,20,35,34,39,22,33,50,54,55,52,37,37,36,
+53,62,2,55,54,1,197,67,68,68,67,66,16,19,27,33,53,133,125,109,92,16,3,41,
+28,16,15,5,10,74,93,99,152,91,138,83,11,180,1,51,1,125,46,48,71,71,85,72,
+141,254,36,221,179,2,168,51,40,42,1,39,215,181,5,254,236,254,208,254,215,
+10,84,84,55,61,1,168,67,68,68,3,14,1,2,3,16,26,44,77,37,9,8,29,28,19,17,34,
+40,39,12,20,1,9,62,56,13,122,27,60,63,254,255,114,61,61,36,36,14,12,2,1,39,
+200,6,2,130,12,14,137,40,118,102,103,140,60,54,48,223,112,96,45,15,8,0,0,
+2,0,147,0,0,4,133,4,116,0,7,0,52,0,0,36,51,50,53,52,35,34,21,5,34,46,2,39,
+38,35,34,7,54,51,22,21,22,21,20,7,38,53,54,33,51,30,2,51,50,53,17,52,33,35,
+32,7,20,35,34,53,16,33,32,17,17,20,1,76,75,74,74,75,2,91,59,123,80,124,71,
+13,12,136,17,43,56,184,2,196,242,22,1,32,14,120,180,108,56,89,254,164,27,
+254,145,1,67,67,1,249,1,249,85,69,69,69,154,79,194,97,5,1,95,42,20,121,17,
+15,148,2,6,255,246,14,106,246,59,2,88,205,174,31,31,1,53,254,171,253,169,
+200,0,0,2,0,147,0,0,4,133,4,116,0,12,0,68,0,0,0,38,35,34,6,21,20,22,51,50,
+54,53,39,22,51,50,62,2,53,17,52,46,2,35,34,14,3,7,35,34,53,52,62,2,51,50,
+30,2,21,17,20,14,2,35,34,38,39,38,38,53,52,54,55,30,3,21,6,6,7,22,1,171,39,
+31,33,42,42,33,31,41,2,135,59,66,146,117,74,70,115,141,69,43,121,108,74,12,
+62,3,59,96,142,172,76,99,189,146,90,94,148,191,95,90,181,58,65,88,95,83,64,
+82,50,18,2,62,77,36,1,124,38,40,28,31,37,37,31,2,225,23,58,107,85,1,58,81,
+113,70,31,16,44,75,56,1,44,45,126,74,34,46,101,159,112,254,179,110,150,91,
+38,59,35,37,121,85,82,107,12,1,38,59,68,31,60,94,11,23,0,3,0,147,0,0,4,133,
+4,175,0,7,0,66,0,74,0,0,36,53,52,35,34,21,20,51,1,22,21,17,20,35,34,39,38,
+39,38,39,38,35,34,7,54,51,22,21,22,21,20,7,38,53,54,37,50,23,22,23,22,51,
+50,53,17,52,39,6,33,32,53,52,33,51,50,23,54,55,54,51,50,23,22,21,20,7,6,7,
+38,35,32,21,20,51,50,1,218,74,75,75,2,178,67,223,58,61,62,40,40,57,57,81,
+164,14,43,57,183,2,196,242,19,1,56,112,91,90,54,54,55,90,14,182,254,219,254,
+124,1,171,11,249,141,36,7,3,24,18,28,58,1,10,242,106,217,254,224,246,232,
+92,69,69,69,69,3,124,81,123,253,188,200,50,49,97,97,44,43,99,42,10,131,16,
+15,149,2,6,245,247,15,58,58,128,128,59,2,68,31,37,181,233,240,69,96,20,12,
+6,13,21,3,3,26,177,56,106,102,0,0,3,0,147,0,0,5,67,4,116,0,7,0,16,0,63,0,
+0,1,50,53,52,35,34,21,20,37,6,7,20,51,51,50,55,38,19,16,33,32,17,52,55,54,
+55,38,53,52,55,22,21,20,2,21,22,23,50,53,17,6,35,34,53,52,51,50,23,54,51,
+4,19,17,20,35,34,39,17,38,35,34,7,6,7,1,35,55,55,54,1,174,43,3,53,2,20,16,
+4,138,254,157,254,168,100,33,22,155,158,159,183,1,210,222,18,20,136,127,118,
+39,137,111,1,17,2,66,67,1,1,142,125,90,8,1,3,125,74,73,73,74,152,4,40,44,
+2,86,253,76,254,159,1,87,198,155,52,47,2,170,171,2,2,171,147,254,190,154,
+210,1,218,1,248,2,144,143,101,101,2,254,235,252,207,44,47,3,49,142,77,12,
+11,0,3,0,147,0,0,4,133,4,116,0,12,0,40,0,113,0,0,0,38,35,34,6,21,20,22,51,
+50,54,53,53,0,53,52,39,38,38,39,38,35,34,7,6,6,7,6,21,20,23,22,22,23,22,51,
+50,55,54,54,55,1,38,39,38,38,39,54,54,55,54,51,50,23,22,22,23,22,21,20,7,
+6,7,6,35,35,22,23,22,51,50,55,62,2,55,54,53,52,39,53,6,6,7,6,35,34,39,46,
+3,39,38,53,52,55,62,3,51,50,30,2,21,17,20,7,14,2,7,1,104,29,21,24,31,31,24,
+21,29,2,142,35,42,130,81,37,39,49,54,97,108,33,27,2,7,112,118,54,51,60,55,
+103,138,31,254,116,206,97,83,80,4,9,54,50,26,25,21,20,43,45,9,4,2,6,24,24,
+21,3,22,111,84,64,22,19,77,119,84,30,25,1,49,136,103,77,70,23,23,90,128,110,
+64,4,2,6,9,92,159,166,68,94,196,133,84,32,37,92,142,129,1,83,28,29,22,23,
+28,28,23,1,1,219,11,62,39,45,44,10,4,6,13,53,51,42,42,10,9,51,82,12,6,8,14,
+59,70,252,243,9,57,38,120,73,63,77,13,7,5,11,53,29,18,19,13,14,34,31,30,30,
+18,14,1,6,39,55,55,46,79,16,17,159,46,48,9,7,1,3,41,70,106,54,17,17,34,31,
+46,120,69,30,49,86,150,108,254,110,60,68,60,74,61,13,0,2,0,147,0,0,4,133,
+4,116,0,7,0,64,0,0,1,50,53,52,35,34,21,20,19,50,22,51,50,54,53,52,51,50,21,
+20,6,35,38,38,35,34,6,7,20,23,5,4,17,20,7,6,7,6,7,6,7,32,17,52,55,22,21,20,
+7,20,35,34,39,22,33,50,54,55,52,37,37,36,53,52,54,1,122,67,67,68,104,105,
+214,61,119,110,66,65,195,167,120,198,62,51,81,1,190,1,51,1,125,46,48,71,71,
+85,72,141,254,36,221,179,2,168,51,40,42,1,39,215,181,5,254,236,254,208,254,
+215,168,1,40,68,67,67,68,3,76,89,64,13,12,38,39,141,10,78,67,66,114,28,60,
+63,254,236,114,61,61,36,36,14,12,2,1,39,219,6,2,145,15,15,137,40,118,102,
+103,140,79,54,48,223,122,141,0,2,0,147,254,96,4,133,4,117,0,7,0,30,0,0,0,
+35,34,21,20,51,50,53,19,50,36,55,23,1,39,1,6,35,32,17,52,55,22,21,20,7,20,
+35,34,39,22,1,199,70,70,70,70,35,111,1,79,87,134,253,62,102,2,13,173,211,
+254,169,200,201,1,192,46,36,12,4,25,69,69,69,254,213,244,216,72,250,51,68,
+4,76,194,1,66,255,6,2,154,12,14,141,42,179,0,4,0,147,0,40,3,216,4,67,0,11,
+0,45,0,57,0,91,0,0,18,22,51,50,54,53,52,38,35,34,6,21,22,39,38,53,53,54,54,
+55,54,51,50,23,22,22,23,22,21,21,6,6,7,22,51,50,55,54,55,54,55,51,6,6,35,
+34,2,22,51,50,54,53,52,38,35,34,6,21,22,39,38,53,53,54,54,55,54,51,50,23,
+22,22,23,22,21,21,6,6,7,22,51,50,55,54,55,54,55,51,6,6,35,34,254,36,31,31,
+33,37,29,32,33,1,56,52,5,84,50,11,10,38,34,43,47,9,8,1,23,30,36,64,12,12,
+100,74,101,22,131,37,217,180,81,215,36,31,31,33,37,29,32,33,1,56,52,5,84,
+50,11,10,38,34,43,47,9,8,1,23,30,36,64,12,12,100,74,101,22,131,37,217,180,
+81,3,132,36,34,28,28,35,34,28,181,67,62,59,10,64,78,4,1,11,14,58,29,26,27,
+6,30,58,27,19,1,4,55,73,162,195,202,254,84,36,34,28,28,35,34,28,181,67,62,
+59,10,64,78,4,1,11,14,58,29,26,27,6,30,58,27,19,1,4,55,73,162,195,202,0,2,
+252,90,5,12,255,172,6,116,0,11,0,55,0,0,1,52,38,35,34,6,21,20,22,51,50,54,
+37,6,6,7,35,34,7,6,35,34,39,46,2,39,38,53,53,62,3,51,50,30,4,23,21,20,7,6,
+7,20,51,50,55,50,62,2,55,253,80,40,23,27,35,35,29,23,38,2,92,24,195,191,2,
+20,41,14,16,28,30,48,104,83,28,26,2,34,53,56,21,6,45,54,58,23,13,2,4,6,18,
+52,31,49,36,73,63,53,19,5,203,34,26,38,18,19,41,34,172,185,153,1,1,1,2,2,
+22,45,42,38,49,10,42,53,39,16,2,14,39,39,30,21,10,17,16,22,23,3,1,12,35,91,
+76,0,0,2,0,147,0,0,2,148,4,116,0,7,0,27,0,0,1,52,35,34,21,20,51,50,0,35,34,
+53,17,52,39,22,21,20,35,6,35,34,39,54,51,32,17,17,1,121,69,69,69,69,1,27,
+61,62,109,42,141,16,15,149,2,6,225,1,26,3,134,70,70,70,252,192,34,3,26,155,
+13,41,53,173,2,185,228,254,197,252,233,0,0,4,253,105,0,0,2,148,6,131,0,19,
+0,27,0,35,0,55,0,0,2,6,35,34,46,2,53,52,62,2,51,50,22,22,23,22,21,21,6,53,
+52,35,34,21,20,51,1,52,35,34,21,20,51,50,0,35,34,53,17,52,39,22,21,20,35,
+6,35,34,39,54,51,32,17,17,224,123,92,43,82,62,37,35,62,79,48,38,80,62,19,
+16,139,79,79,79,3,51,69,69,69,69,1,27,61,62,109,42,141,16,15,149,2,6,225,
+1,26,5,72,123,32,60,82,41,45,82,61,35,33,57,42,38,43,10,77,80,80,80,80,254,
+47,70,70,70,252,192,34,3,26,155,13,41,53,173,2,185,228,254,197,252,233,0,
+0,1,251,176,5,12,255,40,6,206,0,50,0,0,1,54,54,55,54,55,54,53,52,39,38,39,
+38,35,35,34,7,6,7,6,21,20,23,22,23,22,22,23,6,35,34,39,46,3,39,52,54,54,55,
+30,2,23,20,14,2,7,34,253,224,4,33,47,46,31,21,5,15,74,72,131,21,132,63,67,
+17,6,17,27,38,62,31,2,5,65,11,14,54,75,63,24,5,96,186,154,151,199,101,1,42,
+58,71,73,84,5,60,29,20,20,25,31,20,25,12,14,40,28,27,21,23,43,16,15,24,20,
+33,22,25,26,19,52,2,17,46,58,58,45,52,112,54,6,6,52,122,45,49,65,48,48,15,
+0,0,1,251,176,5,12,255,80,6,206,0,51,0,0,3,33,34,53,54,54,55,54,55,54,53,
+52,39,38,39,38,35,35,34,7,6,7,6,21,20,23,22,23,22,22,23,6,35,34,39,46,3,39,
+52,54,54,55,30,2,23,20,6,7,51,176,254,211,82,3,34,45,46,30,19,5,16,71,67,
+120,38,123,59,64,16,7,17,26,37,60,30,2,5,63,11,13,53,73,61,24,5,94,181,151,
+146,193,97,1,32,49,146,5,12,51,27,22,19,26,31,20,23,12,13,36,29,27,21,24,
+39,15,14,23,20,33,23,25,27,18,54,2,17,47,59,61,45,44,113,55,7,7,54,123,36,
+51,47,43,0,2,251,176,5,12,255,24,6,206,0,50,0,62,0,0,1,54,54,55,54,55,54,
+53,52,39,38,39,38,35,35,34,7,6,7,6,21,20,23,22,23,22,22,23,6,35,34,39,46,
+3,39,52,54,54,55,30,2,23,20,14,2,7,34,38,54,51,50,22,21,20,6,35,34,38,53,
+253,224,4,33,47,46,31,21,5,15,74,70,124,40,124,61,67,17,6,17,27,38,62,31,
+2,5,65,11,14,54,75,63,24,5,96,186,154,151,193,91,1,32,52,71,73,84,213,55,
+38,38,56,56,38,38,55,5,60,29,20,20,25,31,20,25,12,14,40,28,26,20,23,43,16,
+15,24,20,33,22,25,26,19,52,2,17,46,59,57,46,42,121,54,6,6,54,129,36,48,66,
+48,48,15,225,44,44,30,33,45,45,33,0,2,251,176,5,12,255,80,6,206,0,11,0,66,
+0,0,0,54,51,50,22,21,20,6,35,34,38,53,5,33,34,53,54,54,55,54,55,54,53,52,
+39,38,39,38,35,35,34,7,6,7,6,21,20,23,22,23,22,22,23,6,35,34,39,46,3,39,52,
+54,54,55,30,2,23,22,21,20,7,6,7,51,253,2,53,37,37,55,55,37,37,53,2,78,254,
+211,82,3,34,45,46,30,19,5,16,71,67,120,38,123,59,64,16,7,17,26,37,60,30,2,
+5,63,11,13,53,73,61,25,4,94,181,151,146,185,75,13,1,11,14,39,146,5,243,45,
+45,32,32,47,47,32,199,51,27,22,19,26,31,20,23,12,13,36,29,27,21,24,39,15,
+14,23,20,33,23,25,27,18,54,2,17,47,59,57,49,44,113,55,7,7,48,78,63,11,10,
+45,25,31,43,0,0,2,253,161,254,34,254,238,255,164,0,13,0,45,0,0,5,52,38,35,
+34,7,6,21,21,20,22,51,50,54,23,35,14,3,7,39,54,54,55,6,7,35,34,39,38,38,53,
+62,3,55,51,50,22,22,23,22,21,20,254,104,28,16,19,15,14,29,19,16,28,129,1,
+13,17,29,37,59,116,47,63,10,35,19,3,19,30,48,22,12,28,44,38,50,5,13,64,53,
+16,10,221,17,24,12,12,16,2,14,28,29,73,34,28,34,36,38,57,20,59,24,9,1,12,
+22,51,39,45,31,25,10,1,23,41,41,24,35,23,0,0,2,253,69,254,25,254,203,255,
+140,0,13,0,47,0,0,4,6,21,20,22,22,23,54,53,52,38,38,35,34,23,6,21,20,23,22,
+51,50,53,53,51,21,20,35,34,39,38,53,52,55,34,39,38,38,53,52,54,54,51,50,22,
+22,21,20,253,156,11,11,18,33,17,11,18,10,10,104,10,2,7,36,35,110,145,103,
+29,12,9,27,25,27,31,31,54,28,29,53,30,195,19,10,11,18,11,2,23,19,10,19,11,
+105,30,27,13,12,20,115,160,165,206,65,27,26,22,21,14,14,50,27,28,51,26,26,
+51,28,25,0,0,2,252,90,5,12,255,172,6,116,0,14,0,50,0,0,1,38,35,34,14,2,21,
+20,23,22,51,51,50,54,5,53,52,35,35,22,23,22,21,20,7,14,2,7,6,35,34,39,34,
+38,38,39,38,53,53,52,54,55,62,2,51,51,32,19,253,75,10,53,22,25,13,4,20,17,
+19,5,31,31,1,218,239,159,20,8,3,3,8,37,40,28,27,27,2,2,30,69,36,13,22,16,
+11,30,101,120,59,132,1,107,18,5,174,66,15,20,23,7,31,16,15,33,134,6,235,32,
+23,12,14,13,15,31,62,23,8,8,1,22,36,22,49,22,1,20,73,11,49,42,12,254,152,
+0,0,2,252,6,254,19,255,144,255,111,0,15,0,54,0,0,1,51,21,20,23,22,51,50,55,
+54,53,53,52,39,6,6,55,22,21,20,7,14,2,7,6,35,34,39,34,46,2,39,54,54,55,54,
+51,51,22,22,23,22,51,50,55,54,55,51,2,35,35,38,38,252,106,1,19,21,26,24,21,
+19,46,41,40,183,47,1,6,39,32,33,21,24,15,17,7,53,57,22,7,1,43,60,55,71,14,
+80,132,65,58,65,7,7,103,25,120,25,220,3,137,153,254,164,6,23,16,18,19,17,
+25,7,31,45,8,35,51,50,45,5,5,50,42,24,8,5,1,15,40,49,49,56,89,26,23,3,77,
+66,60,1,6,199,254,167,2,195,0,2,0,100,254,90,3,108,4,116,0,13,0,106,0,0,4,
+38,35,34,7,6,21,20,23,22,23,54,53,53,1,20,6,7,6,35,34,39,46,2,39,35,34,7,
+21,20,23,30,4,21,17,20,23,21,20,7,14,2,7,6,35,35,34,39,46,2,53,53,52,55,54,
+55,54,51,50,23,22,22,23,22,21,20,7,6,7,22,51,50,55,62,3,53,17,52,39,37,38,
+53,52,55,62,2,55,51,50,23,22,22,23,22,51,50,53,51,1,137,51,41,39,22,20,1,
+5,118,49,1,226,33,45,23,28,26,28,61,135,153,48,9,40,5,42,47,141,166,144,94,
+1,6,8,36,76,61,57,101,8,97,70,74,125,57,54,55,61,17,15,39,27,38,59,20,15,
+2,8,26,36,38,11,10,49,87,32,8,235,254,213,87,1,8,42,58,53,5,52,87,92,135,
+44,4,4,36,140,166,45,22,20,29,5,6,67,15,34,46,2,5,8,57,80,12,6,5,11,41,47,
+2,19,5,18,10,11,37,51,70,86,53,253,47,19,36,9,33,38,43,78,74,24,23,12,12,
+55,77,65,7,73,53,54,6,1,9,13,48,42,31,39,14,16,57,20,10,1,3,43,94,110,49,
+2,108,87,85,101,27,72,7,8,56,60,22,1,16,18,37,10,1,81,0,0,2,0,168,0,0,2,59,
+4,116,0,7,0,30,0,0,36,35,34,21,20,51,50,53,39,20,23,54,51,50,23,6,35,34,17,
+17,52,54,51,50,23,21,38,35,34,6,21,1,230,48,48,48,48,195,17,10,126,125,2,
+6,165,232,162,75,97,67,90,74,66,48,240,52,52,52,118,103,4,116,121,194,1,50,
+2,47,164,111,39,114,22,78,42,0,0,4,0,168,0,0,4,68,4,116,0,7,0,30,0,38,0,61,
+0,0,36,35,34,21,20,51,50,53,39,20,23,54,51,50,23,6,35,34,17,17,52,54,51,50,
+23,21,38,35,34,6,21,0,35,34,21,20,51,50,53,39,20,23,54,51,50,23,6,35,34,17,
+17,52,54,51,50,23,21,38,35,34,6,21,1,230,48,48,48,48,195,17,10,126,125,2,
+6,165,232,162,75,97,67,90,74,66,48,2,204,48,48,48,48,195,17,10,126,125,2,
+6,165,232,162,75,97,67,90,74,66,48,240,52,52,52,118,103,4,116,121,194,1,50,
+2,47,164,111,39,114,22,78,42,253,119,52,52,52,118,103,4,116,121,194,1,50,
+2,47,164,111,39,114,22,78,42,0,0,2,0,0,0,0,2,174,6,248,0,7,0,58,0,0,36,53,
+52,35,34,21,20,51,1,6,21,20,23,1,23,21,6,6,7,17,22,23,54,51,50,23,6,35,34,
+3,17,54,54,55,1,38,53,54,55,54,51,50,23,23,22,51,50,55,21,6,35,34,39,38,39,
+39,38,35,34,2,84,48,48,48,254,107,10,36,1,25,128,117,55,3,3,17,10,126,125,
+2,6,165,232,12,2,54,23,254,225,63,3,46,65,72,88,64,104,145,78,10,9,34,29,
+30,26,51,162,81,32,33,31,133,53,53,53,53,5,209,12,14,26,33,254,234,111,2,
+31,101,54,253,120,105,4,118,123,198,1,56,2,133,66,120,22,1,33,65,79,77,51,
+58,61,105,153,2,112,10,11,20,160,80,42,0,0,2,0,0,0,0,3,34,6,248,0,7,0,51,
+0,0,36,53,52,35,34,21,20,51,39,20,23,54,51,50,23,6,35,34,17,17,54,55,54,53,
+38,35,32,21,22,23,22,51,50,55,23,6,35,34,39,46,3,53,16,33,32,19,20,7,6,21,
+2,205,48,48,48,147,17,10,126,125,2,6,165,232,2,128,127,3,252,254,246,16,81,
+8,7,57,42,96,91,95,14,15,57,86,61,23,1,145,1,135,3,181,92,138,53,53,53,53,
+174,105,4,118,123,198,1,56,2,97,158,128,127,107,216,216,122,15,1,67,74,120,
+3,4,56,73,80,49,1,87,254,169,143,172,88,117,0,2,0,0,0,0,2,182,6,254,0,7,0,
+65,0,0,37,20,51,50,53,52,35,34,3,52,62,2,55,62,3,53,52,38,35,34,6,35,34,38,
+39,38,38,39,55,30,3,23,30,3,51,50,54,51,50,22,21,20,14,4,7,17,20,23,54,51,
+50,23,6,35,34,3,1,241,48,48,48,48,232,31,37,51,39,15,40,51,29,22,12,23,120,
+31,59,70,24,41,64,92,97,58,87,35,10,11,11,15,12,18,17,22,98,51,51,101,41,
+59,73,60,61,2,17,10,126,125,2,6,165,232,10,191,53,53,53,2,110,49,62,43,38,
+27,9,24,31,27,16,16,11,54,82,98,161,108,78,98,43,112,98,27,42,36,69,37,28,
+54,72,68,47,63,52,45,40,52,32,253,199,105,4,118,123,198,1,56,0,2,0,147,254,
+84,4,107,4,118,0,7,0,76,0,0,0,35,34,21,20,51,50,53,2,51,50,22,23,22,51,51,
+62,2,51,50,30,2,21,17,20,14,2,35,34,46,2,39,55,22,22,51,50,62,2,53,3,52,46,
+2,35,6,7,6,35,34,39,38,38,35,35,34,7,6,21,21,54,51,50,21,22,21,20,7,38,53,
+52,1,169,70,70,70,70,134,101,45,80,46,43,35,3,35,94,63,57,70,105,51,12,100,
+127,166,64,34,143,117,98,47,104,86,176,61,57,127,87,70,1,10,29,51,21,60,66,
+62,57,4,4,61,140,61,5,40,35,35,41,53,173,2,185,198,3,58,69,69,69,1,129,35,
+29,28,1,57,34,59,105,137,76,252,179,92,133,84,39,35,57,74,39,104,78,96,18,
+54,92,71,3,110,60,74,41,14,2,49,47,1,3,100,31,31,65,11,42,141,16,15,149,2,
+6,225,168,0,0,1,253,32,6,224,253,154,8,30,0,3,0,0,1,51,17,35,253,32,122,122,
+8,30,254,194,0,2,252,144,6,224,255,85,8,39,0,16,0,46,0,0,0,53,52,39,38,35,
+34,7,6,7,6,21,20,23,22,51,51,6,39,38,53,53,54,55,54,51,50,23,22,23,22,21,
+21,6,7,54,54,55,23,14,2,35,35,53,54,55,253,128,3,12,22,4,5,29,1,1,26,16,17,
+11,95,30,32,4,44,36,47,10,11,61,22,20,2,87,148,158,41,120,61,112,182,140,
+214,136,54,7,180,11,7,6,22,1,5,25,2,1,23,3,2,54,22,23,39,9,45,26,21,1,6,35,
+32,46,8,52,72,9,116,97,50,105,87,55,60,24,53,0,0,1,252,90,6,238,254,253,8,
+38,0,64,0,0,1,38,38,39,62,3,55,38,39,38,35,35,6,6,35,34,38,39,34,6,21,20,
+30,2,23,6,7,38,38,53,52,62,2,51,50,22,22,23,54,54,55,50,22,22,23,22,21,21,
+54,54,55,22,22,23,22,21,20,7,14,2,254,20,22,29,4,10,27,14,19,1,7,13,12,27,
+5,34,68,18,17,65,27,30,26,21,24,30,11,29,39,68,59,34,38,51,37,19,41,52,11,
+27,55,42,33,59,33,10,7,25,14,12,29,33,12,1,20,22,63,92,6,244,5,30,21,10,18,
+21,19,23,25,12,11,26,62,70,15,27,29,22,23,15,20,10,43,9,29,78,49,37,55,41,
+21,15,49,12,22,49,7,27,39,21,17,22,10,36,45,45,2,21,20,4,5,44,37,41,56,49,
+0,1,252,200,6,212,254,48,8,48,0,11,0,0,1,35,53,35,53,51,53,51,21,51,21,35,
+253,183,119,120,120,119,121,121,6,212,118,111,119,119,111,0,0,2,253,5,6,219,
+254,215,8,75,0,31,0,55,0,0,1,38,53,52,55,54,55,54,51,50,23,22,51,50,55,54,
+55,23,6,7,6,35,35,22,21,20,7,6,6,35,34,38,54,23,22,51,50,55,54,55,54,53,52,
+39,38,39,38,35,34,7,6,7,6,21,20,23,253,6,1,19,25,36,23,39,22,28,16,15,58,
+49,62,26,48,29,48,43,59,12,2,5,8,64,58,58,76,84,17,12,14,6,5,22,12,8,1,4,
+16,13,15,5,6,20,11,9,1,7,74,12,11,39,29,36,13,8,2,2,23,29,61,95,57,29,26,
+10,13,20,26,43,49,56,40,11,9,1,4,16,12,13,5,5,19,11,8,1,3,16,12,14,5,5,0,
+2,252,190,6,209,254,34,8,17,0,15,0,31,0,0,1,50,22,22,21,20,6,6,35,34,38,38,
+53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,253,112,45,86,47,
+46,85,47,46,85,47,48,85,27,35,21,20,35,19,20,36,19,20,35,20,8,17,41,77,42,
+42,76,42,42,76,42,42,77,41,91,17,32,18,18,31,18,18,31,18,18,32,17,0,2,0,147,
+0,0,3,216,4,116,0,15,0,29,0,0,36,6,35,32,17,52,54,54,55,54,51,51,50,23,22,
+17,2,39,38,35,34,14,2,21,16,33,50,54,17,3,216,221,199,254,95,53,106,78,69,
+87,38,204,100,102,135,70,67,148,67,107,71,37,1,26,136,149,238,238,2,67,168,
+207,131,30,25,119,120,254,190,1,4,82,88,43,96,158,133,254,66,169,1,21,0,2,
+0,147,0,0,4,133,4,116,0,68,0,80,0,0,1,14,3,7,6,6,35,34,38,53,52,54,55,62,
+3,53,52,46,2,35,34,14,2,21,20,30,2,23,38,38,53,62,3,51,50,30,2,21,20,14,2,
+7,6,35,34,39,46,2,53,52,54,51,50,30,2,21,37,52,38,35,34,6,21,20,22,51,50,
+54,4,133,6,69,111,148,99,65,113,50,20,56,132,140,76,70,99,45,18,75,154,140,
+74,110,76,37,9,33,64,56,51,21,8,57,73,74,24,4,60,68,56,69,81,67,60,9,10,54,
+72,85,107,51,246,221,122,199,144,78,254,37,47,32,34,46,46,34,32,47,2,64,71,
+149,136,124,45,35,16,10,19,30,67,67,42,62,116,118,55,49,142,130,95,39,66,
+85,47,42,76,61,40,8,33,80,17,63,73,37,10,18,48,78,62,74,95,55,20,5,1,23,27,
+103,136,73,179,204,74,142,207,133,67,31,45,45,31,33,42,42,0,2,0,147,0,0,4,
+133,5,179,0,60,0,72,0,0,0,22,21,20,14,2,7,14,3,7,14,3,21,20,30,2,51,50,55,
+46,2,53,52,54,54,55,54,51,51,30,3,21,20,6,6,7,6,6,35,34,0,17,52,62,2,55,54,
+36,55,22,23,2,38,35,34,6,21,20,22,51,50,54,53,4,131,2,101,136,141,38,44,99,
+84,56,3,37,55,35,18,55,99,141,86,70,53,46,29,19,46,70,40,30,27,16,46,72,50,
+29,6,37,87,93,107,125,254,254,222,51,112,177,124,139,1,4,107,27,9,137,46,
+31,32,44,44,32,31,46,5,148,16,4,74,141,119,84,17,21,63,51,35,2,31,53,62,71,
+49,80,136,110,66,15,45,41,43,18,60,73,41,7,4,2,35,54,67,33,39,49,77,68,43,
+23,1,19,1,10,98,143,121,115,62,60,196,123,6,14,251,167,43,43,31,29,43,43,
+29,0,0,2,0,100,0,0,4,116,6,63,0,7,0,56,0,0,54,53,52,35,34,21,20,51,1,52,38,
+36,38,53,52,54,51,50,23,5,7,37,38,35,34,6,21,20,22,23,5,22,23,17,2,33,34,
+39,6,35,34,39,54,51,50,21,20,7,54,53,17,51,17,20,51,50,53,251,33,33,33,3,
+23,224,254,238,74,81,59,112,101,1,94,66,254,184,118,33,16,17,27,20,1,125,
+118,28,2,254,141,203,93,64,141,157,5,2,120,119,36,87,129,244,244,157,44,44,
+44,44,3,96,40,114,121,106,54,72,71,53,159,100,152,51,30,10,17,35,14,182,58,
+127,253,51,254,212,90,90,197,137,129,46,35,11,165,2,228,253,28,173,173,0,
+0,3,0,147,0,0,4,133,5,195,0,7,0,16,0,76,0,0,1,34,21,20,51,50,53,52,3,50,53,
+52,35,35,34,7,22,3,52,51,50,21,20,35,34,39,21,54,51,50,21,20,35,34,39,6,6,
+35,34,2,17,52,39,52,55,54,54,55,37,62,3,55,54,51,50,22,21,20,14,2,7,5,14,
+3,21,20,22,22,51,50,54,55,3,220,62,62,62,69,56,64,3,23,20,7,153,188,188,188,
+22,21,22,22,163,152,141,41,117,149,69,186,130,1,19,20,98,100,1,214,26,42,
+33,23,6,32,40,40,37,33,52,70,38,254,61,50,71,44,21,13,49,102,66,151,97,2,
+131,75,75,75,75,253,222,45,45,2,88,1,215,175,175,175,3,105,2,147,146,145,
+78,67,1,23,1,16,4,68,59,79,83,168,49,215,13,38,43,39,11,55,41,25,26,74,74,
+63,17,190,19,74,92,98,43,84,170,241,67,58,0,4,0,147,0,0,4,133,5,187,0,9,0,
+17,0,26,0,114,0,0,1,52,38,35,34,6,21,22,23,54,18,21,20,51,50,53,52,35,3,50,
+53,52,35,35,34,7,22,0,22,22,51,50,54,55,17,52,51,50,21,20,35,34,39,21,54,
+51,50,21,20,35,34,39,6,6,35,34,2,17,52,39,53,52,55,62,2,55,55,46,2,39,38,
+53,52,55,62,3,51,50,22,22,23,21,20,7,54,55,54,53,53,52,55,54,51,50,22,21,
+20,6,6,35,6,7,7,14,2,7,6,21,20,23,2,244,44,34,31,46,12,94,49,170,62,62,62,
+7,56,64,3,23,20,7,253,137,13,49,102,66,151,97,188,188,188,22,21,22,22,163,
+152,141,41,117,149,69,186,130,1,15,15,64,91,59,191,42,48,27,2,2,2,7,44,59,
+70,33,75,86,39,5,21,53,43,41,22,24,21,38,38,84,146,154,13,80,108,48,91,72,
+22,21,1,4,250,31,41,41,31,67,1,27,253,178,75,75,75,75,253,222,45,45,2,88,
+1,202,170,241,67,58,1,43,175,175,175,3,105,2,147,146,145,78,67,1,23,1,16,
+4,67,8,63,79,84,109,59,19,84,12,51,55,27,12,10,11,8,43,59,35,17,56,71,31,
+10,30,51,16,60,57,44,11,39,11,11,39,25,29,175,105,41,33,51,21,39,67,53,51,
+82,5,6,0,0,3,0,168,0,0,4,191,5,201,0,7,0,17,0,101,0,0,1,52,35,34,21,20,51,
+50,19,54,53,52,38,35,34,6,21,20,5,16,5,34,38,39,38,39,39,7,6,7,6,6,35,36,
+17,17,16,55,22,21,20,7,20,35,34,39,39,17,20,23,50,54,54,55,38,38,39,53,52,
+54,51,50,22,21,21,6,6,7,30,2,51,54,53,17,52,39,46,3,53,52,54,51,50,22,23,
+23,7,39,38,35,34,6,21,20,22,23,23,22,23,1,220,70,70,70,70,216,26,11,17,18,
+11,2,38,254,236,53,123,27,19,14,9,10,14,19,27,123,53,254,236,238,175,2,153,
+73,41,9,132,41,48,72,47,29,33,6,59,56,55,59,6,33,29,47,72,48,41,132,44,117,
+127,59,12,75,62,67,164,51,79,69,202,39,23,16,18,28,21,223,62,29,3,234,69,
+69,69,253,252,52,41,47,58,58,47,41,106,254,165,16,90,36,25,26,17,17,26,25,
+36,90,16,1,91,1,243,1,39,6,2,148,15,17,141,42,14,253,235,206,26,43,78,72,
+36,115,55,19,76,87,87,76,19,55,115,36,72,78,43,26,206,2,56,40,36,104,104,
+66,43,24,52,81,90,39,55,100,129,26,20,10,17,35,14,183,39,107,0,3,0,147,254,
+116,4,133,4,116,0,7,0,16,0,57,0,0,37,52,35,34,21,20,51,50,3,34,21,20,51,51,
+50,55,38,5,52,35,34,7,6,7,17,20,35,34,53,52,51,50,23,17,6,35,34,53,52,51,
+51,50,23,54,51,51,32,19,17,20,23,22,23,21,38,39,38,53,1,71,44,44,44,44,47,
+48,55,2,21,16,5,2,91,211,146,94,9,12,162,143,143,20,17,18,20,140,126,12,115,
+35,140,129,14,1,69,2,50,29,31,106,58,69,155,55,55,55,3,178,45,45,2,88,186,
+156,88,13,11,253,39,175,165,145,3,2,33,2,147,143,102,102,254,232,252,64,74,
+52,30,18,122,32,66,80,118,0,0,4,0,168,253,129,4,154,4,119,0,15,0,23,0,86,
+0,100,0,0,0,21,20,22,22,51,50,54,54,53,52,38,38,35,34,6,1,34,21,20,51,50,
+53,52,5,17,51,16,35,34,7,6,35,34,39,38,35,34,17,17,55,54,51,50,21,22,21,20,
+7,38,17,17,16,33,50,23,54,51,32,17,17,20,7,7,22,23,22,22,21,20,6,6,35,34,
+38,38,53,53,6,7,6,35,34,38,53,52,37,37,5,7,6,21,20,22,51,50,55,54,55,55,54,
+3,140,22,40,21,21,39,22,22,39,21,21,40,253,246,71,71,70,2,44,1,112,90,77,
+46,41,40,46,76,91,112,9,41,74,154,2,176,240,1,0,125,120,121,125,1,0,88,28,
+11,12,47,53,51,94,51,51,93,52,27,27,128,119,124,113,1,84,1,187,254,219,117,
+238,47,53,75,98,108,92,136,31,254,82,19,19,36,20,20,36,19,19,36,19,19,2,72,
+69,69,69,69,130,2,158,1,30,106,64,64,106,254,226,254,9,14,42,141,17,15,148,
+2,6,1,39,1,213,1,157,160,160,254,99,252,254,145,78,24,5,6,23,88,48,47,86,
+49,49,86,47,11,16,23,105,125,91,167,114,14,102,42,76,75,44,39,76,79,25,117,
+29,0,0,2,0,168,0,0,4,221,4,116,0,44,0,52,0,0,1,17,16,33,32,17,17,52,35,34,
+21,17,54,54,55,54,51,50,23,22,22,23,22,21,20,7,14,3,35,38,38,53,17,16,33,
+32,17,17,20,51,50,53,17,1,38,39,6,7,22,23,54,4,221,254,230,254,229,191,192,
+23,57,29,6,7,26,31,39,53,9,6,1,6,41,57,52,37,117,104,1,63,1,62,156,155,253,
+124,2,52,66,6,6,66,50,4,116,252,227,254,169,1,87,1,185,226,226,254,53,6,27,
+2,1,12,16,60,35,27,34,13,13,51,58,30,10,6,221,97,1,202,1,100,254,156,254,
+71,217,217,3,29,252,77,50,4,4,54,66,6,6,0,0,3,0,147,0,0,6,223,4,116,0,7,0,
+16,0,90,0,0,1,50,53,52,35,34,21,20,37,34,21,20,51,51,50,55,38,5,51,3,2,35,
+34,38,39,6,35,53,51,50,55,54,53,17,52,39,6,6,7,17,2,33,32,17,52,55,54,55,
+38,53,52,55,22,21,20,7,6,21,21,6,21,20,51,50,53,17,6,35,34,53,52,51,50,23,
+54,55,32,19,17,22,22,51,50,53,17,35,19,52,51,50,21,1,38,55,55,55,1,161,48,
+55,2,21,16,6,4,38,1,1,12,219,119,121,31,62,122,1,25,33,33,148,77,101,2,10,
+254,182,254,163,101,33,23,157,160,160,93,91,1,214,207,19,19,139,130,120,37,
+124,85,1,6,13,38,109,83,98,2,2,66,67,3,125,74,73,73,74,152,44,44,2,86,239,
+254,3,254,215,113,9,122,117,47,48,98,2,35,146,2,14,74,11,253,215,254,159,
+1,87,198,155,52,47,2,170,171,2,2,171,147,161,159,156,7,10,10,187,223,1,246,
+2,144,143,103,99,4,254,224,253,149,15,94,173,1,188,1,97,46,46,0,4,0,147,0,
+0,6,223,4,116,0,10,0,18,0,28,0,100,0,0,37,38,35,35,6,21,21,22,23,51,50,1,
+50,53,52,35,34,21,20,37,6,7,20,51,50,55,54,53,52,5,51,17,16,33,34,39,6,35,
+34,53,52,51,50,23,17,52,35,34,7,17,2,33,32,17,52,55,54,55,38,53,52,51,51,
+50,21,20,2,7,22,23,50,53,17,6,35,34,53,52,51,51,50,23,54,51,51,32,19,17,22,
+23,22,51,50,53,17,35,17,52,51,50,21,4,138,17,21,6,39,3,37,2,41,252,172,61,
+61,61,1,154,41,4,46,16,28,2,4,27,2,254,233,66,141,35,120,130,139,18,19,143,
+81,104,11,254,183,254,163,100,33,24,157,158,4,158,179,9,9,208,207,19,19,139,
+125,12,114,35,136,73,6,1,1,11,4,10,91,80,144,2,68,67,176,12,4,38,2,40,4,3,
+25,74,73,73,74,143,3,38,45,8,12,10,52,232,253,245,254,235,103,103,143,144,
+2,2,66,143,84,253,193,254,165,1,87,198,155,52,47,2,170,170,170,147,254,185,
+152,205,6,223,1,246,2,144,140,100,100,254,238,253,139,11,12,87,151,2,3,1,
+50,44,44,0,0,1,254,18,5,13,254,140,6,75,0,3,0,0,1,51,17,35,254,18,122,122,
+6,75,254,194,0,2,252,158,5,4,255,99,6,143,0,17,0,47,0,0,0,53,52,39,38,35,
+34,7,6,7,6,21,20,23,22,51,50,55,6,39,38,53,53,54,55,54,51,50,23,22,23,22,
+21,21,6,7,54,54,55,23,14,2,35,35,53,54,55,253,142,3,12,22,4,5,29,1,1,26,14,
+15,7,8,95,30,32,4,44,36,47,10,11,61,22,20,2,87,148,158,41,120,61,112,182,
+140,214,136,54,6,4,13,9,7,26,1,6,30,2,2,27,4,3,1,65,26,28,47,11,54,32,25,
+1,7,42,39,56,10,63,87,11,141,117,61,126,106,66,73,29,63,0,1,252,219,5,7,255,
+126,6,63,0,64,0,0,1,38,38,39,62,3,55,38,39,38,35,35,6,6,35,34,38,39,34,6,
+21,20,30,2,23,6,7,38,38,53,52,62,2,51,50,22,22,23,54,54,55,50,22,22,23,22,
+21,21,54,54,55,22,22,23,22,21,20,7,14,2,254,149,22,29,4,10,27,14,19,1,7,13,
+12,27,5,34,68,18,17,65,27,30,26,21,24,30,11,29,39,68,59,34,38,51,37,19,41,
+52,11,27,55,42,33,59,33,10,7,25,14,12,29,33,12,1,20,22,63,92,5,13,5,30,21,
+10,18,21,19,23,25,12,11,26,62,70,15,27,29,22,23,15,20,10,43,9,29,78,49,37,
+55,41,21,15,49,12,22,49,7,27,39,21,17,22,10,36,45,45,2,21,20,4,5,44,37,41,
+56,49,0,1,253,197,5,15,255,45,6,107,0,11,0,0,1,35,53,35,53,51,53,51,21,51,
+21,35,254,180,119,120,120,119,121,121,5,15,118,111,119,119,111,0,0,2,253,
+198,5,22,255,152,6,157,0,31,0,55,0,0,1,38,53,52,55,54,55,54,51,50,23,22,51,
+50,55,54,55,23,6,7,6,35,35,22,21,20,7,6,6,35,34,38,54,23,22,51,50,55,54,55,
+54,53,52,39,38,39,38,35,34,7,6,7,6,21,20,23,253,199,1,19,25,36,23,40,22,27,
+15,14,59,50,62,26,48,29,48,44,58,12,2,5,8,64,58,58,76,84,17,12,15,5,5,22,
+12,8,1,4,16,13,15,5,6,20,11,9,1,5,140,13,11,42,31,38,14,8,2,2,25,30,65,101,
+61,30,28,11,13,21,28,46,52,60,42,12,9,1,4,17,13,14,5,5,20,12,9,1,4,17,13,
+14,6,5,0,2,252,251,5,11,254,130,6,136,0,15,0,31,0,0,1,50,22,22,21,20,6,6,
+35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,253,
+191,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,
+6,136,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,21,38,21,
+21,38,21,0,4,252,134,5,11,255,75,8,39,0,15,0,31,0,48,0,78,0,0,1,50,22,22,
+21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,
+38,35,2,53,52,39,38,35,34,7,6,7,6,21,20,23,22,51,51,6,39,38,53,53,54,55,54,
+51,50,23,22,23,22,21,21,6,7,54,54,55,23,14,2,35,35,53,54,55,253,191,49,94,
+52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,73,3,12,22,
+4,5,29,1,1,26,16,17,11,95,30,32,4,44,36,47,10,11,61,22,20,2,87,148,158,41,
+120,61,112,182,140,214,136,54,6,136,49,92,50,49,91,50,50,91,49,50,92,49,108,
+21,38,21,21,38,21,21,38,21,21,38,21,1,152,11,7,6,22,1,5,25,2,1,23,3,2,54,
+22,23,39,9,45,26,21,1,6,35,32,46,8,52,72,9,116,97,50,105,87,55,60,24,53,0,
+3,252,251,5,11,254,130,8,30,0,15,0,31,0,35,0,0,1,50,22,22,21,20,6,6,35,34,
+38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,3,51,17,35,
+253,191,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,
+21,49,122,122,6,136,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,
+21,21,38,21,21,38,21,2,2,254,194,0,0,5,0,147,0,0,4,205,6,136,0,7,0,17,0,52,
+0,68,0,84,0,0,36,53,52,35,34,21,20,51,3,34,21,20,23,22,51,50,55,38,19,6,7,
+38,39,54,55,54,51,50,23,17,6,7,38,53,52,55,50,23,54,55,4,19,17,20,35,34,53,
+17,38,39,6,6,7,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,
+22,22,51,50,54,54,53,52,38,38,35,1,122,64,64,64,5,60,41,7,8,34,39,8,143,7,
+185,165,9,16,113,21,17,41,23,32,30,169,156,139,71,164,164,1,104,28,67,68,
+1,252,171,137,20,1,7,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,
+39,21,22,39,21,94,61,60,60,61,3,182,43,45,6,1,25,64,252,157,158,13,3,158,
+130,26,3,16,2,27,4,4,14,144,142,5,108,103,5,9,254,248,252,192,35,42,3,54,
+134,17,22,80,21,3,12,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,
+38,21,21,38,21,21,38,21,0,0,4,0,147,0,0,4,133,6,136,0,7,0,67,0,83,0,99,0,
+0,1,34,21,20,51,50,53,52,2,38,53,52,37,55,36,53,38,38,35,32,7,54,51,50,21,
+22,21,20,7,38,53,16,33,22,23,22,23,22,23,22,21,20,5,7,6,21,22,22,51,50,36,
+51,50,23,23,22,23,21,20,35,34,39,38,38,35,34,4,7,1,50,22,22,21,20,6,6,35,
+34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,122,
+68,68,67,130,168,1,37,212,1,116,5,181,215,254,217,42,40,51,168,2,179,221,
+1,220,141,72,85,71,71,48,46,254,54,239,181,1,81,51,62,1,77,82,100,84,38,28,
+8,50,57,3,8,87,51,61,254,172,76,1,26,49,94,52,51,93,51,51,93,52,53,93,30,
+39,23,22,39,21,22,39,21,22,39,21,3,68,69,69,69,69,252,188,145,95,208,84,62,
+100,124,86,105,122,42,141,16,14,150,2,6,225,1,47,2,12,15,37,37,62,63,97,216,
+128,68,53,110,38,69,121,84,44,43,41,10,32,26,20,75,119,2,6,136,49,92,50,49,
+91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,21,38,21,21,38,21,0,4,0,147,
+0,0,4,133,6,136,0,7,0,49,0,65,0,81,0,0,36,35,34,21,20,51,50,53,37,52,55,38,
+53,16,33,32,19,17,20,35,34,53,17,52,33,32,21,20,22,23,50,21,20,35,34,7,6,
+21,21,55,54,51,50,21,22,21,20,7,38,17,1,50,22,22,21,20,6,6,35,34,38,38,53,
+52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,204,71,71,71,71,
+254,199,166,166,1,248,1,248,2,67,68,254,144,254,142,125,64,79,40,40,125,63,
+9,42,74,156,2,178,242,2,17,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,
+21,22,39,21,22,39,21,225,67,68,68,222,159,63,63,168,1,51,254,159,253,22,41,
+41,2,236,227,183,105,69,2,55,55,32,40,95,118,13,42,139,16,15,145,2,6,1,33,
+5,97,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,21,38,21,21,
+38,21,0,0,4,0,147,254,90,2,197,6,136,0,7,0,40,0,56,0,72,0,0,0,21,20,51,50,
+53,52,35,2,38,53,52,51,51,22,23,62,3,53,17,52,39,22,21,20,35,6,35,34,39,54,
+51,32,17,17,20,6,6,7,19,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,
+21,20,22,22,51,50,54,54,53,52,38,38,35,1,22,69,69,69,117,83,35,7,42,31,93,
+103,86,30,107,42,141,16,15,151,20,26,225,1,36,141,169,144,191,49,94,52,51,
+93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,3,204,70,70,70,70,
+250,144,9,68,61,7,1,4,27,77,98,104,3,46,149,13,41,53,173,2,185,228,254,200,
+252,48,81,142,47,4,8,46,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,
+21,38,21,21,38,21,21,38,21,0,0,4,0,147,0,0,4,133,6,136,0,9,0,59,0,75,0,91,
+0,0,1,21,20,51,51,54,53,52,35,34,3,32,21,20,35,34,53,16,33,32,17,20,7,17,
+20,7,38,39,38,53,52,55,54,53,6,35,35,38,39,53,52,55,51,50,23,22,21,20,7,6,
+7,6,21,20,23,51,50,55,17,52,3,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,
+22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,2,154,74,2,78,75,76,7,254,152,
+77,78,2,7,1,235,1,221,152,44,21,29,52,22,66,6,170,5,188,3,199,29,9,37,56,
+4,1,75,10,68,8,255,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,
+39,21,22,39,21,2,69,5,65,1,70,69,1,103,163,44,44,1,37,254,209,17,18,253,171,
+203,2,5,102,47,45,54,51,95,5,20,26,168,10,159,32,147,50,44,87,66,99,71,4,
+4,65,13,80,2,81,208,2,150,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,
+21,38,21,21,38,21,21,38,21,0,0,4,0,147,254,122,4,133,6,136,0,15,0,31,0,39,
+0,106,0,0,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,6,6,21,20,22,22,51,
+50,54,54,53,52,38,38,35,34,1,34,21,20,51,50,53,52,1,52,38,35,34,7,6,35,34,
+38,53,52,37,55,36,53,38,33,32,7,54,51,50,21,22,21,20,7,38,53,16,33,51,32,
+17,20,5,7,6,21,20,22,51,50,55,54,51,50,22,21,17,22,22,23,22,21,20,7,6,35,
+34,39,38,38,39,38,53,2,154,49,94,52,51,93,51,51,93,52,53,93,9,23,22,39,21,
+22,39,21,22,39,21,20,254,235,66,66,65,2,46,41,51,95,98,164,157,134,105,1,
+60,208,1,65,5,254,131,254,227,39,38,49,162,2,173,213,1,200,6,2,0,254,104,
+220,219,42,68,107,146,147,115,105,117,2,19,9,6,1,4,52,72,7,14,13,1,1,6,136,
+49,92,50,49,91,50,50,91,49,50,92,49,129,38,21,21,38,21,21,38,21,21,38,21,
+253,37,69,69,69,69,253,31,74,61,87,144,125,91,167,114,77,111,160,165,126,
+42,141,16,14,150,2,6,225,1,50,254,214,253,140,82,76,75,44,39,116,115,137,
+131,254,199,49,91,11,7,5,2,2,6,21,31,85,49,18,127,0,4,0,147,0,0,4,133,6,136,
+0,7,0,48,0,64,0,80,0,0,1,52,35,34,21,20,51,50,2,33,32,53,17,52,51,50,21,3,
+2,33,32,17,52,55,38,53,53,16,55,22,21,20,7,20,35,34,39,39,21,20,22,51,50,
+21,20,35,34,6,21,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,
+22,22,51,50,54,54,53,52,38,38,35,1,204,71,71,71,71,176,1,114,1,112,68,67,
+1,1,254,8,254,8,166,166,242,178,2,156,74,42,9,125,72,71,71,72,125,1,196,49,
+94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,3,214,68,
+68,67,252,233,219,2,254,31,30,253,1,254,169,1,100,159,62,63,159,46,1,33,6,
+2,145,15,16,139,42,13,79,95,68,58,59,68,95,5,36,49,92,50,49,91,50,50,91,49,
+50,92,49,108,21,38,21,21,38,21,21,38,21,21,38,21,0,0,4,0,168,0,0,4,154,6,
+136,0,7,0,34,0,50,0,66,0,0,36,35,34,21,20,51,50,53,1,16,33,32,17,17,20,35,
+34,53,17,16,33,32,17,17,55,54,51,50,21,22,21,20,7,38,17,1,50,22,22,21,20,
+6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,
+1,225,71,71,71,71,254,199,1,251,1,247,67,68,254,144,254,142,9,42,74,156,2,
+178,242,2,17,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,
+22,39,21,225,67,68,68,2,65,1,149,254,107,253,66,33,33,2,190,1,25,254,231,
+254,39,13,42,139,16,15,145,2,6,1,33,5,97,49,92,50,49,91,50,50,91,49,50,92,
+49,108,21,38,21,21,38,21,21,38,21,21,38,21,0,4,0,168,0,0,4,152,6,136,0,7,
+0,46,0,62,0,78,0,0,37,34,21,20,51,50,53,52,1,17,20,35,34,53,17,16,35,34,7,
+6,35,34,39,38,35,34,17,17,55,54,51,50,21,22,21,20,7,38,17,17,16,33,50,23,
+54,51,32,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,
+51,50,54,54,53,52,38,38,35,1,151,71,71,71,2,186,67,68,114,92,77,46,41,41,
+46,76,93,112,9,42,74,155,2,178,239,1,0,125,122,122,125,1,2,254,33,49,94,52,
+51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,225,67,68,68,
+67,1,254,253,66,33,33,2,190,1,25,104,63,63,104,254,231,254,39,13,42,139,16,
+15,145,2,6,1,33,1,184,1,149,157,157,2,20,49,92,50,49,91,50,50,91,49,50,92,
+49,108,21,38,21,21,38,21,21,38,21,21,38,21,0,5,0,100,254,112,5,15,6,136,0,
+7,0,16,0,59,0,75,0,91,0,0,36,35,34,21,20,51,50,53,1,34,21,20,23,51,50,55,
+38,5,38,37,6,15,2,17,54,51,50,21,20,35,35,34,53,17,6,35,34,53,52,55,22,23,
+54,55,4,17,17,20,22,23,22,21,6,35,34,46,2,53,1,50,22,22,21,20,6,6,35,34,38,
+38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,2,123,70,71,
+71,70,254,149,62,69,14,32,29,9,2,255,10,254,246,119,113,70,40,25,25,210,210,
+14,171,50,26,183,180,139,58,182,187,1,146,9,30,8,4,43,71,23,27,15,254,129,
+49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,244,
+75,75,75,3,103,45,46,2,7,86,230,189,7,5,53,33,21,253,211,3,175,175,166,2,
+188,16,147,143,10,10,102,102,10,17,254,199,252,100,72,135,54,10,6,9,22,78,
+105,98,6,233,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,21,
+38,21,21,38,21,0,0,4,0,147,0,0,5,67,6,136,0,7,0,44,0,60,0,76,0,0,1,50,53,
+52,35,34,21,20,19,22,51,50,55,17,16,33,32,17,17,20,35,34,53,3,38,35,34,21,
+17,16,33,32,17,52,55,54,55,38,53,52,51,50,21,20,2,1,50,22,22,21,20,6,6,35,
+34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,61,64,
+64,64,30,8,197,197,8,1,52,1,90,67,68,4,5,189,185,254,171,254,171,116,40,27,
+183,185,187,228,1,229,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,
+22,39,21,22,39,21,3,127,73,74,74,73,253,217,213,222,1,193,1,82,254,158,253,
+16,34,34,2,242,221,223,254,79,254,159,1,88,198,155,52,47,2,170,172,172,146,
+254,188,4,150,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,21,
+38,21,21,38,21,0,0,4,0,147,0,0,4,133,6,136,0,7,0,47,0,63,0,79,0,0,0,51,50,
+53,52,35,34,21,19,22,23,22,51,50,53,17,52,51,50,21,17,16,33,34,39,38,39,6,
+35,35,38,53,52,62,2,55,17,6,35,34,53,52,55,22,21,17,20,1,50,22,22,21,20,6,
+6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,
+3,59,59,59,59,243,70,54,88,112,204,64,63,254,181,152,89,57,56,68,173,9,27,
+26,110,37,9,29,21,180,180,179,1,14,49,94,52,51,93,51,51,93,52,53,93,30,39,
+23,22,39,21,22,39,21,22,39,21,3,125,74,73,73,253,66,18,47,76,173,3,43,32,
+34,252,210,254,220,80,52,19,147,1,52,52,7,13,112,98,1,203,3,172,171,2,2,171,
+253,139,39,5,93,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,
+21,38,21,21,38,21,0,0,4,0,147,0,0,4,133,6,136,0,7,0,34,0,50,0,66,0,0,1,50,
+53,52,35,34,21,20,19,20,33,32,17,17,52,51,50,21,3,2,33,32,17,52,55,54,55,
+38,53,52,55,22,21,20,2,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,
+6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,54,61,61,61,35,1,114,1,112,68,
+67,1,1,254,8,254,8,112,38,25,175,178,178,219,1,216,49,94,52,51,93,51,51,93,
+52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,3,125,74,73,73,74,253,218,219,
+1,12,2,201,35,35,253,52,254,123,1,87,198,155,52,47,2,170,171,2,2,171,147,
+254,189,4,151,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,21,
+38,21,21,38,21,0,4,0,147,0,0,4,123,6,136,0,15,0,23,0,39,0,78,0,0,1,50,22,
+22,21,20,6,6,35,34,38,38,53,52,54,54,1,50,53,52,35,34,21,20,0,21,20,22,22,
+51,50,54,54,53,52,38,38,35,34,6,1,16,33,32,17,52,55,54,55,38,53,52,51,51,
+50,21,20,2,21,20,33,32,17,17,51,52,55,62,2,51,50,21,20,7,14,2,21,2,204,49,
+94,52,51,93,51,51,93,52,53,93,254,148,58,58,58,1,134,22,39,21,22,39,21,22,
+39,21,20,39,1,200,254,27,254,31,107,36,24,167,168,4,171,209,1,93,1,95,1,2,
+1,13,21,69,59,2,12,15,5,6,136,49,92,50,49,91,50,50,91,49,50,92,49,252,243,
+75,75,75,75,2,102,21,21,38,21,21,38,21,21,38,21,21,251,137,254,112,1,94,202,
+148,53,38,2,173,174,174,149,254,202,157,215,1,9,2,251,57,41,49,85,70,17,3,
+4,24,88,110,73,0,0,5,0,168,0,0,4,176,6,136,0,15,0,31,0,39,0,47,0,105,0,0,
+1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,6,6,21,20,22,22,51,50,54,54,
+53,52,38,38,35,34,3,52,35,34,21,20,51,50,33,54,55,38,35,34,7,22,1,16,33,34,
+39,6,35,32,17,17,16,55,22,21,21,6,7,34,39,17,20,51,50,53,53,52,51,50,21,7,
+21,20,51,50,53,17,6,35,38,39,52,55,50,23,54,53,52,39,53,52,51,50,22,23,6,
+7,22,21,2,185,49,94,52,51,93,51,51,93,52,53,93,9,23,22,39,21,22,39,21,22,
+39,21,20,215,64,65,65,64,1,245,61,13,24,50,61,7,7,1,28,254,231,152,71,70,
+152,254,220,230,169,19,133,66,46,159,153,67,67,3,151,154,26,77,143,16,178,
+77,40,8,1,46,48,13,2,2,31,19,6,136,49,92,50,49,91,50,50,91,49,50,92,49,129,
+38,21,21,38,21,21,38,21,21,38,21,253,193,64,64,63,16,50,56,69,53,253,177,
+254,177,103,103,1,79,2,13,1,16,8,4,155,11,139,6,48,253,230,208,182,65,50,
+57,44,7,189,208,2,18,40,6,143,154,12,44,35,29,10,10,2,28,31,38,47,85,63,91,
+0,4,0,168,0,0,4,165,6,136,0,7,0,23,0,39,0,92,0,0,1,52,35,34,21,20,51,50,18,
+21,20,22,22,51,50,54,54,53,52,38,38,35,34,6,55,50,22,22,21,20,6,6,35,34,38,
+38,53,52,54,54,1,16,33,34,39,6,35,32,17,17,16,55,51,50,21,21,6,7,35,34,53,
+17,20,51,50,53,53,52,51,50,23,7,21,20,51,50,53,17,51,52,55,62,2,51,50,21,
+20,7,14,2,21,1,188,63,63,63,63,171,22,39,21,22,39,21,22,39,21,20,39,59,49,
+94,52,51,93,51,51,93,52,53,93,2,3,254,224,149,68,68,147,254,238,213,2,166,
+14,136,13,86,144,146,68,67,1,3,148,154,1,2,1,12,20,69,59,2,11,13,1,3,214,
+69,69,69,2,80,21,21,38,21,21,38,21,21,38,21,21,129,49,92,50,49,91,50,50,91,
+49,50,92,49,250,227,254,149,101,101,1,107,1,223,1,39,3,167,10,134,9,26,254,
+29,228,184,81,60,59,59,15,192,228,3,32,57,41,49,85,70,18,3,3,24,88,110,73,
+0,0,4,0,147,0,0,4,153,6,136,0,7,0,51,0,67,0,83,0,0,1,50,53,52,35,34,21,20,
+19,50,53,17,52,51,50,21,3,21,20,51,50,55,17,52,51,50,21,3,2,33,34,39,6,35,
+32,17,52,55,54,55,38,53,52,55,22,21,20,2,21,21,20,51,19,50,22,22,21,20,6,
+6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,
+39,56,56,55,203,148,68,68,4,156,160,3,68,67,5,5,254,228,152,72,71,142,254,
+213,102,34,24,160,163,162,190,159,245,49,94,52,51,93,51,51,93,52,53,93,30,
+39,23,22,39,21,22,39,21,22,39,21,3,125,74,73,73,74,253,9,201,3,13,24,24,252,
+252,13,197,222,2,248,24,25,253,8,254,157,99,99,1,87,218,135,52,47,2,170,171,
+2,2,171,147,254,208,174,7,201,6,2,49,92,50,49,91,50,50,91,49,50,92,49,108,
+21,38,21,21,38,21,21,38,21,21,38,21,0,4,0,147,0,0,4,144,6,136,0,7,0,23,0,
+39,0,95,0,0,1,50,53,52,35,34,21,20,0,21,20,22,22,51,50,54,54,53,52,38,38,
+35,34,6,55,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,16,5,34,39,6,35,32,
+17,52,55,54,55,38,53,52,55,22,21,20,2,21,22,51,50,53,52,39,17,52,51,50,21,
+17,20,51,50,53,52,39,17,51,52,55,62,2,51,50,21,20,7,14,2,21,1,55,52,52,52,
+1,69,22,39,21,22,39,21,22,39,21,20,39,59,49,94,52,51,93,51,51,93,52,53,93,
+2,12,254,233,144,67,66,132,254,233,95,32,22,175,178,171,192,4,148,130,1,66,
+66,145,147,1,1,2,1,11,19,68,58,2,11,12,3,3,140,67,66,66,67,2,85,21,21,38,
+21,21,38,21,21,38,21,21,129,49,92,50,49,91,50,50,91,49,50,92,49,250,199,254,
+184,7,101,101,1,94,202,138,53,48,12,173,175,2,11,175,149,254,201,157,215,
+183,15,17,2,246,26,26,252,153,102,201,13,14,3,32,57,41,49,85,70,18,3,3,24,
+88,110,73,0,4,0,100,0,0,4,226,6,136,0,8,0,45,0,61,0,77,0,0,55,21,20,51,50,
+55,52,35,34,5,6,35,34,39,54,51,51,22,21,21,20,7,50,55,17,52,51,50,21,3,21,
+20,33,22,51,50,55,17,52,51,50,21,17,2,33,34,19,50,22,22,21,20,6,6,35,34,38,
+38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,192,41,41,1,
+41,42,1,61,71,157,176,5,2,136,2,129,27,83,12,68,67,1,1,15,15,15,224,19,68,
+67,18,254,121,227,225,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,
+22,39,21,22,39,21,193,2,47,49,49,154,88,193,133,1,111,13,45,24,161,3,51,28,
+28,252,204,1,156,1,160,3,50,28,27,252,203,254,220,6,136,49,92,50,49,91,50,
+50,91,49,50,92,49,108,21,38,21,21,38,21,21,38,21,21,38,21,0,4,0,147,0,0,4,
+123,6,136,0,7,0,23,0,39,0,104,0,0,1,38,35,6,7,22,51,50,18,21,20,22,22,51,
+50,54,54,53,52,38,38,35,34,6,55,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,
+1,2,33,32,17,38,53,52,55,38,53,52,55,53,16,55,22,21,20,7,20,35,38,39,21,6,
+21,20,23,22,51,50,21,6,35,34,7,6,21,20,23,21,20,33,51,32,53,17,51,52,55,54,
+54,55,54,51,51,22,21,20,7,14,2,21,1,198,3,66,56,7,3,63,66,170,22,39,21,22,
+39,21,22,39,21,20,39,59,49,94,52,51,93,51,51,93,52,53,93,1,198,7,254,35,254,
+34,1,129,129,1,230,169,2,148,83,33,1,49,57,81,80,1,80,81,57,48,1,1,69,42,
+1,73,1,2,1,13,11,10,69,2,61,2,12,15,8,3,208,61,3,58,69,2,86,21,21,38,21,21,
+38,21,21,38,21,21,129,49,92,50,49,91,50,50,91,49,50,92,49,250,213,254,163,
+1,87,12,11,153,63,57,136,10,10,47,1,39,3,14,136,14,15,141,2,54,81,13,11,67,
+26,30,68,68,30,26,82,14,16,4,206,216,3,45,57,41,49,85,35,35,1,18,3,3,24,88,
+110,73,0,4,0,147,0,0,4,133,6,136,0,7,0,76,0,92,0,108,0,0,0,35,34,21,20,51,
+50,53,19,54,51,50,23,30,4,23,22,21,20,7,6,35,34,39,46,4,39,6,6,7,21,20,23,
+5,4,17,20,7,6,7,6,7,6,7,32,17,52,55,22,21,20,7,20,35,34,39,22,33,50,54,55,
+52,37,37,36,53,62,2,55,54,19,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,
+6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,197,67,68,68,67,66,16,19,27,
+33,53,133,125,109,92,16,3,41,28,16,15,5,10,74,93,99,152,91,138,83,11,180,
+1,51,1,125,46,48,71,71,85,72,141,254,36,221,179,2,168,51,40,42,1,39,215,181,
+5,254,236,254,208,254,215,10,84,84,55,61,205,49,94,52,51,93,51,51,93,52,53,
+93,30,39,23,22,39,21,22,39,21,22,39,21,1,168,67,68,68,3,14,1,2,3,16,26,44,
+77,37,9,8,29,28,19,17,34,40,39,12,20,1,9,62,56,13,122,27,60,63,254,255,114,
+61,61,36,36,14,12,2,1,39,200,6,2,130,12,14,137,40,118,102,103,140,60,54,48,
+223,112,96,45,15,8,2,26,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,
+21,38,21,21,38,21,21,38,21,0,4,0,147,0,0,4,133,6,136,0,7,0,52,0,68,0,84,0,
+0,36,51,50,53,52,35,34,21,5,34,46,2,39,38,35,34,7,54,51,22,21,22,21,20,7,
+38,53,54,33,51,30,2,51,50,53,17,52,33,35,32,7,20,35,34,53,16,33,32,17,17,
+20,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,
+54,54,53,52,38,38,35,1,76,75,74,74,75,2,91,59,123,80,124,71,13,12,136,17,
+43,56,184,2,196,242,22,1,32,14,120,180,108,56,89,254,164,27,254,145,1,67,
+67,1,249,1,249,254,51,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,
+22,39,21,22,39,21,85,69,69,69,154,79,194,97,5,1,95,42,20,121,17,15,148,2,
+6,255,246,14,106,246,59,2,88,205,174,31,31,1,53,254,171,253,169,200,6,136,
+49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,21,38,21,21,38,
+21,0,0,4,0,147,0,0,4,133,6,136,0,12,0,68,0,84,0,100,0,0,0,38,35,34,6,21,20,
+22,51,50,54,53,39,22,51,50,62,2,53,17,52,46,2,35,34,14,3,7,35,34,53,52,62,
+2,51,50,30,2,21,17,20,14,2,35,34,38,39,38,38,53,52,54,55,30,3,21,6,6,7,22,
+19,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,
+54,53,52,38,38,35,1,171,39,31,33,42,42,33,31,41,2,135,59,66,146,117,74,70,
+115,141,69,43,121,108,74,12,62,3,59,96,142,172,76,99,189,146,90,94,148,191,
+95,90,181,58,65,88,95,83,64,82,50,18,2,62,77,36,192,49,94,52,51,93,51,51,
+93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,1,124,38,40,28,31,37,37,31,
+2,225,23,58,107,85,1,58,81,113,70,31,16,44,75,56,1,44,45,126,74,34,46,101,
+159,112,254,179,110,150,91,38,59,35,37,121,85,82,107,12,1,38,59,68,31,60,
+94,11,23,5,239,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,
+21,38,21,21,38,21,0,0,5,0,147,0,0,4,133,6,136,0,7,0,66,0,74,0,90,0,106,0,
+0,36,53,52,35,34,21,20,51,1,22,21,17,20,35,34,39,38,39,38,39,38,35,34,7,54,
+51,22,21,22,21,20,7,38,53,54,37,50,23,22,23,22,51,50,53,17,52,39,6,33,32,
+53,52,33,51,50,23,54,55,54,51,50,23,22,21,20,7,6,7,38,35,32,21,20,51,50,3,
+50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,
+53,52,38,38,35,1,218,74,75,75,2,178,67,223,58,61,62,40,40,57,57,81,164,14,
+43,57,183,2,196,242,19,1,56,112,91,90,54,54,55,90,14,182,254,219,254,124,
+1,171,11,249,141,36,7,3,24,18,28,58,1,10,242,106,217,254,224,246,232,157,
+49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,92,69,
+69,69,69,3,124,81,123,253,188,200,50,49,97,97,44,43,99,42,10,131,16,15,149,
+2,6,245,247,15,58,58,128,128,59,2,68,31,37,181,233,240,69,96,20,12,6,13,21,
+3,3,26,177,56,106,102,3,106,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,
+21,21,38,21,21,38,21,21,38,21,0,5,0,147,0,0,5,67,6,136,0,7,0,16,0,63,0,79,
+0,95,0,0,1,50,53,52,35,34,21,20,37,6,7,20,51,51,50,55,38,19,16,33,32,17,52,
+55,54,55,38,53,52,55,22,21,20,2,21,22,23,50,53,17,6,35,34,53,52,51,50,23,
+54,51,4,19,17,20,35,34,39,17,38,35,34,7,6,7,3,50,22,22,21,20,6,6,35,34,38,
+38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,35,55,55,54,
+1,174,43,3,53,2,20,16,4,138,254,157,254,168,100,33,22,155,158,159,183,1,210,
+222,18,20,136,127,118,39,137,111,1,17,2,66,67,1,1,142,125,90,8,1,70,49,94,
+52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,3,125,74,73,
+73,74,152,4,40,44,2,86,253,76,254,159,1,87,198,155,52,47,2,170,171,2,2,171,
+147,254,190,154,210,1,218,1,248,2,144,143,101,101,2,254,235,252,207,44,47,
+3,49,142,77,12,11,2,254,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,
+21,38,21,21,38,21,21,38,21,0,0,5,0,147,0,0,4,133,6,136,0,12,0,40,0,113,0,
+129,0,145,0,0,0,38,35,34,6,21,20,22,51,50,54,53,53,0,53,52,39,38,38,39,38,
+35,34,7,6,6,7,6,21,20,23,22,22,23,22,51,50,55,54,54,55,1,38,39,38,38,39,54,
+54,55,54,51,50,23,22,22,23,22,21,20,7,6,7,6,35,35,22,23,22,51,50,55,62,2,
+55,54,53,52,39,53,6,6,7,6,35,34,39,46,3,39,38,53,52,55,62,3,51,50,30,2,21,
+17,20,7,14,2,7,3,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,
+22,22,51,50,54,54,53,52,38,38,35,1,104,29,21,24,31,31,24,21,29,2,142,35,42,
+130,81,37,39,49,54,97,108,33,27,2,7,112,118,54,51,60,55,103,138,31,254,116,
+206,97,83,80,4,9,54,50,26,25,21,20,43,45,9,4,2,6,24,24,21,3,22,111,84,64,
+22,19,77,119,84,30,25,1,49,136,103,77,70,23,23,90,128,110,64,4,2,6,9,92,159,
+166,68,94,196,133,84,32,37,92,142,129,99,49,94,52,51,93,51,51,93,52,53,93,
+30,39,23,22,39,21,22,39,21,22,39,21,1,83,28,29,22,23,28,28,23,1,1,219,11,
+62,39,45,44,10,4,6,13,53,51,42,42,10,9,51,82,12,6,8,14,59,70,252,243,9,57,
+38,120,73,63,77,13,7,5,11,53,29,18,19,13,14,34,31,30,30,18,14,1,6,39,55,55,
+46,79,16,17,159,46,48,9,7,1,3,41,70,106,54,17,17,34,31,46,120,69,30,49,86,
+150,108,254,110,60,68,60,74,61,13,6,127,49,92,50,49,91,50,50,91,49,50,92,
+49,108,21,38,21,21,38,21,21,38,21,21,38,21,0,0,4,0,147,0,0,4,133,6,136,0,
+7,0,64,0,80,0,96,0,0,1,50,53,52,35,34,21,20,19,50,22,51,50,54,53,52,51,50,
+21,20,6,35,38,38,35,34,6,7,20,23,5,4,17,20,7,6,7,6,7,6,7,32,17,52,55,22,21,
+20,7,20,35,34,39,22,33,50,54,55,52,37,37,36,53,52,54,1,50,22,22,21,20,6,6,
+35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,1,122,
+67,67,68,104,105,214,61,119,110,66,65,195,167,120,198,62,51,81,1,190,1,51,
+1,125,46,48,71,71,85,72,141,254,36,221,179,2,168,51,40,42,1,39,215,181,5,
+254,236,254,208,254,215,168,1,125,49,94,52,51,93,51,51,93,52,53,93,30,39,
+23,22,39,21,22,39,21,22,39,21,1,40,68,67,67,68,3,76,89,64,13,12,38,39,141,
+10,78,67,66,114,28,60,63,254,236,114,61,61,36,36,14,12,2,1,39,219,6,2,145,
+15,15,137,40,118,102,103,140,79,54,48,223,122,141,2,20,49,92,50,49,91,50,
+50,91,49,50,92,49,108,21,38,21,21,38,21,21,38,21,21,38,21,0,5,0,147,0,0,6,
+223,6,136,0,7,0,16,0,90,0,106,0,122,0,0,1,50,53,52,35,34,21,20,37,34,21,20,
+51,51,50,55,38,5,51,3,2,35,34,38,39,6,35,53,51,50,55,54,53,17,52,39,6,6,7,
+17,2,33,32,17,52,55,54,55,38,53,52,55,22,21,20,7,6,21,21,6,21,20,51,50,53,
+17,6,35,34,53,52,51,50,23,54,55,32,19,17,22,22,51,50,53,17,35,19,52,51,50,
+21,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,22,22,51,50,
+54,54,53,52,38,38,35,1,38,55,55,55,1,161,48,55,2,21,16,6,4,38,1,1,12,219,
+119,121,31,62,122,1,25,33,33,148,77,101,2,10,254,182,254,163,101,33,23,157,
+160,160,93,91,1,214,207,19,19,139,130,120,37,124,85,1,6,13,38,109,83,98,2,
+2,66,67,252,152,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,
+21,22,39,21,3,125,74,73,73,74,152,44,44,2,86,239,254,3,254,215,113,9,122,
+117,47,48,98,2,35,146,2,14,74,11,253,215,254,159,1,87,198,155,52,47,2,170,
+171,2,2,171,147,161,159,156,7,10,10,187,223,1,246,2,144,143,103,99,4,254,
+224,253,149,15,94,173,1,188,1,97,46,46,2,66,49,92,50,49,91,50,50,91,49,50,
+92,49,108,21,38,21,21,38,21,21,38,21,21,38,21,0,6,0,147,0,0,6,223,6,136,0,
+10,0,18,0,28,0,96,0,112,0,128,0,0,37,38,35,35,6,21,21,22,23,51,50,1,50,53,
+52,35,34,21,20,37,6,7,20,51,50,55,54,53,52,1,16,33,34,39,6,35,34,53,52,51,
+50,23,17,52,35,34,7,17,2,33,32,17,52,55,54,55,38,53,52,51,51,50,21,20,2,7,
+22,23,50,53,17,6,35,34,53,52,51,51,50,23,54,51,51,32,19,17,22,23,22,51,50,
+53,3,52,51,50,21,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,6,21,20,
+22,22,51,50,54,54,53,52,38,38,35,4,138,17,21,6,39,3,37,2,41,252,172,61,61,
+61,1,154,41,4,46,16,28,2,4,29,254,233,66,141,35,120,130,139,18,19,143,81,
+104,11,254,183,254,163,100,33,24,157,158,4,158,179,9,9,208,207,19,19,139,
+125,12,114,35,136,73,6,1,1,11,4,10,91,80,144,2,68,67,252,133,49,94,52,51,
+93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,39,21,176,12,4,38,2,40,
+4,3,25,74,73,73,74,143,3,38,45,8,12,10,52,253,13,254,235,103,103,143,144,
+2,2,66,143,84,253,193,254,165,1,87,198,155,52,47,2,170,170,170,147,254,185,
+152,205,6,223,1,246,2,144,140,100,100,254,238,253,139,11,12,87,151,3,53,44,
+44,2,64,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,21,21,38,21,21,38,21,
+21,38,21,0,0,2,0,147,0,0,2,148,4,116,0,7,0,27,0,0,1,52,35,34,21,20,51,50,
+0,35,34,53,17,52,39,22,21,20,35,6,35,34,39,54,51,32,17,17,1,121,69,69,69,
+69,1,27,61,62,109,42,141,16,15,149,2,6,225,1,26,3,134,70,70,70,252,192,34,
+3,26,155,13,41,53,173,2,185,228,254,197,252,233,0,0,3,252,251,5,11,254,138,
+8,48,0,15,0,31,0,43,0,0,1,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,22,6,
+6,21,20,22,22,51,50,54,54,53,52,38,38,35,55,35,53,35,53,51,53,51,21,51,21,
+35,253,191,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,22,
+39,21,82,119,120,120,119,121,121,6,136,49,92,50,49,91,50,50,91,49,50,92,49,
+108,21,38,21,21,38,21,21,38,21,21,38,21,184,118,111,119,119,111,0,0,3,252,
+240,5,11,255,13,7,182,0,15,0,31,0,96,0,0,1,50,22,22,21,20,6,6,35,34,38,38,
+53,52,54,54,22,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,55,38,38,39,62,
+3,55,38,39,38,35,35,6,6,35,34,38,39,34,6,21,20,30,2,23,6,7,38,38,53,52,62,
+2,51,50,22,22,23,54,54,55,50,22,22,23,22,21,21,54,54,55,22,22,23,22,21,20,
+7,14,2,253,191,49,94,52,51,93,51,51,93,52,53,93,30,39,23,22,39,21,22,39,21,
+22,39,21,147,17,24,3,8,22,11,15,1,6,10,9,21,5,27,55,14,14,52,22,24,21,17,
+19,24,9,23,31,55,47,27,31,41,29,15,33,42,9,21,45,33,27,47,26,8,6,20,11,10,
+23,27,9,1,16,18,50,74,6,136,49,92,50,49,91,50,50,91,49,50,92,49,108,21,38,
+21,21,38,21,21,38,21,21,38,21,165,4,24,17,8,14,17,15,19,20,10,8,21,49,56,
+12,22,23,18,18,12,16,8,35,7,23,63,39,30,44,33,16,12,39,9,17,39,6,22,31,17,
+14,16,9,29,36,36,2,16,16,4,4,35,30,32,45,40,0,2,255,89,254,74,0,166,255,214,
+0,13,0,45,0,0,23,52,38,35,34,7,6,21,21,20,22,51,50,54,23,35,14,3,7,39,54,
+54,55,6,7,35,34,39,38,38,53,62,3,55,51,50,22,22,23,22,21,20,32,28,16,19,15,
+14,29,19,16,28,129,1,13,17,29,37,59,116,47,63,10,35,19,3,19,30,48,22,12,28,
+44,38,50,5,13,64,53,16,10,175,18,25,13,12,17,2,13,29,29,75,35,29,34,37,39,
+58,21,60,25,9,1,12,22,53,40,46,32,26,10,1,23,43,42,25,35,24,0,2,255,17,254,
+85,0,151,255,200,0,13,0,47,0,0,6,6,21,20,22,22,23,54,53,52,38,38,35,34,23,
+6,21,20,23,22,51,50,53,53,51,21,20,35,34,39,38,53,52,55,34,39,38,38,53,52,
+54,54,51,50,22,22,21,20,152,11,11,18,33,17,11,18,10,10,104,10,2,7,36,35,110,
+145,103,29,12,9,27,25,27,31,31,54,28,29,53,30,135,19,10,11,18,11,2,23,19,
+10,19,11,105,30,27,13,12,20,115,160,165,206,65,27,26,22,21,14,14,50,27,28,
+51,26,26,51,28,25,0,1,254,68,5,12,1,188,6,206,0,50,0,0,19,54,54,55,54,55,
+54,53,52,39,38,39,38,35,35,34,7,6,7,6,21,20,23,22,23,22,22,23,6,35,34,39,
+46,3,39,52,54,54,55,30,2,23,20,14,2,7,34,116,4,33,47,46,31,21,5,15,74,72,
+131,21,132,63,67,17,6,17,27,38,62,31,2,5,65,11,14,54,75,63,24,5,96,186,154,
+151,199,101,1,42,58,71,73,84,5,60,29,20,20,25,31,20,25,12,14,40,28,27,21,
+23,43,16,15,24,20,33,22,25,26,19,52,2,17,46,58,58,45,52,112,54,6,6,52,122,
+45,49,65,48,48,15,0,1,254,78,5,12,1,238,6,206,0,51,0,0,1,33,34,53,54,54,55,
+54,55,54,53,52,39,38,39,38,35,35,34,7,6,7,6,21,20,23,22,23,22,22,23,6,35,
+34,39,46,3,39,52,54,54,55,30,2,23,20,6,7,51,1,238,254,211,82,3,34,45,46,30,
+19,5,16,71,67,120,38,123,59,64,16,7,17,26,37,60,30,2,5,63,11,13,53,73,61,
+24,5,94,181,151,146,193,97,1,32,49,146,5,12,51,27,22,19,26,31,20,23,12,13,
+36,29,27,21,24,39,15,14,23,20,33,23,25,27,18,54,2,17,47,59,61,45,44,113,55,
+7,7,54,123,36,51,47,43,0,0,2,254,78,5,12,1,182,6,206,0,50,0,62,0,0,19,54,
+54,55,54,55,54,53,52,39,38,39,38,35,35,34,7,6,7,6,21,20,23,22,23,22,22,23,
+6,35,34,39,46,3,39,52,54,54,55,30,2,23,20,14,2,7,34,38,54,51,50,22,21,20,
+6,35,34,38,53,126,4,33,47,46,31,21,5,15,74,70,124,40,124,61,67,17,6,17,27,
+38,62,31,2,5,65,11,14,54,75,63,24,5,96,186,154,151,193,91,1,32,52,71,73,84,
+213,55,38,38,56,56,38,38,55,5,60,29,20,20,25,31,20,25,12,14,40,28,26,20,23,
+43,16,15,24,20,33,22,25,26,19,52,2,17,46,59,57,46,42,121,54,6,6,54,129,36,
+48,66,48,48,15,225,44,44,30,33,45,45,33,0,0,2,254,79,4,248,1,239,6,186,0,
+11,0,66,0,0,2,54,51,50,22,21,20,6,35,34,38,53,5,33,34,53,54,54,55,54,55,54,
+53,52,39,38,39,38,35,35,34,7,6,7,6,21,20,23,22,23,22,22,23,6,35,34,39,46,
+3,39,52,54,54,55,30,2,23,22,21,20,7,6,7,51,95,53,37,37,55,55,37,37,53,2,78,
+254,211,82,3,34,45,46,30,19,5,16,71,67,120,38,123,59,64,16,7,17,26,37,60,
+30,2,5,63,11,13,53,73,61,25,4,94,181,151,146,185,75,13,1,11,14,39,146,5,223,
+45,45,32,32,47,47,32,199,51,27,22,19,26,31,20,23,12,13,36,29,27,21,24,39,
+15,14,23,20,33,23,25,27,18,54,2,17,47,59,57,49,44,113,55,7,7,48,78,63,11,
+10,45,25,31,43,0,2,254,88,5,12,1,170,6,116,0,11,0,55,0,0,3,52,38,35,34,6,
+21,20,22,51,50,54,37,6,6,7,35,34,7,6,35,34,39,46,2,39,38,53,53,62,3,51,50,
+30,4,23,21,20,7,6,7,20,51,50,55,50,62,2,55,178,40,23,27,35,35,29,23,38,2,
+92,24,195,191,2,20,41,14,16,28,30,48,104,83,28,26,2,34,53,56,21,6,45,54,58,
+23,13,2,4,6,18,52,31,49,36,73,63,53,19,5,203,34,26,38,18,19,41,34,172,185,
+153,1,1,1,2,2,22,45,42,38,49,10,42,53,39,16,2,14,39,39,30,21,10,17,16,22,
+23,3,1,12,35,91,76,0,2,254,88,5,12,1,170,6,116,0,14,0,50,0,0,3,38,35,34,14,
+2,21,20,23,22,51,51,50,54,5,53,52,35,35,22,23,22,21,20,7,14,2,7,6,35,34,39,
+34,38,38,39,38,53,53,52,54,55,62,2,51,51,32,19,183,10,53,22,25,13,4,20,17,
+19,5,31,31,1,218,239,159,20,8,3,3,8,37,40,28,27,27,2,2,30,69,36,13,22,16,
+11,30,101,120,59,132,1,107,18,5,174,66,15,20,23,7,31,16,15,33,134,6,235,32,
+23,12,14,13,15,31,62,23,8,8,1,22,36,22,49,22,1,20,73,11,49,42,12,254,152,
+0,4,0,147,252,192,2,197,4,116,0,13,0,45,0,53,0,86,0,0,1,52,38,35,34,7,6,21,
+21,20,22,51,50,54,23,35,14,3,7,39,54,54,55,6,7,35,34,39,38,38,53,62,3,55,
+51,50,22,22,23,22,21,20,0,21,20,51,50,53,52,35,2,38,53,52,51,51,22,23,62,
+3,53,17,52,39,22,21,20,35,6,35,34,39,54,51,32,17,17,20,6,6,7,1,178,28,16,
+19,15,14,29,19,16,28,129,1,13,17,29,37,59,116,47,63,10,35,19,3,19,30,48,22,
+12,28,44,38,50,5,13,64,53,16,10,254,222,69,69,69,117,83,35,7,42,31,93,103,
+86,30,107,42,141,16,15,151,20,26,225,1,36,141,169,144,253,193,17,24,12,12,
+16,2,14,28,29,73,34,28,34,36,38,57,20,59,24,9,1,12,22,51,39,45,31,25,10,1,
+23,41,41,24,35,23,6,69,70,70,70,70,250,144,9,68,61,7,1,4,27,77,98,104,3,46,
+149,13,41,53,173,2,185,228,254,200,252,48,81,142,47,4,0,4,0,147,252,193,2,
+199,4,116,0,13,0,47,0,55,0,88,0,0,18,6,21,20,22,22,23,54,53,52,38,38,35,34,
+23,6,21,20,23,22,51,50,53,53,51,21,20,35,34,39,38,53,52,55,34,39,38,38,53,
+52,54,54,51,50,22,22,21,20,2,21,20,51,50,53,52,35,2,38,53,52,51,51,22,23,
+62,3,53,17,52,39,22,21,20,35,6,35,34,39,54,51,32,17,17,20,6,6,7,234,11,11,
+18,33,17,11,18,10,10,104,10,2,7,36,35,110,145,103,29,12,9,27,25,27,31,31,
+54,28,29,53,30,92,69,69,69,117,83,35,7,42,31,93,103,86,30,107,42,141,16,15,
+151,20,26,225,1,36,141,169,144,253,229,19,10,11,18,11,2,23,19,10,19,11,105,
+30,27,13,12,20,115,160,165,206,65,27,26,22,21,14,14,50,27,28,51,26,26,51,
+28,25,6,26,70,70,70,70,250,144,9,68,61,7,1,4,27,77,98,104,3,46,149,13,41,
+53,173,2,185,228,254,200,252,48,81,142,47,4,0,4,252,6,252,200,255,144,255,
+111,0,13,0,45,0,61,0,100,0,0,1,52,38,35,34,7,6,21,21,20,22,51,50,54,23,35,
+14,3,7,39,54,54,55,6,7,35,34,39,38,38,53,62,3,55,51,50,22,22,23,22,21,20,
+1,51,21,20,23,22,51,50,55,54,53,53,52,39,6,6,55,22,21,20,7,14,2,7,6,35,34,
+39,34,46,2,39,54,54,55,54,51,51,22,22,23,22,51,50,55,54,55,51,2,35,35,38,
+38,253,196,28,16,19,15,14,29,19,16,28,129,1,13,17,29,37,59,116,47,63,10,35,
+19,3,19,30,48,22,12,28,44,38,50,5,13,64,53,16,10,254,32,1,19,21,26,24,21,
+19,46,41,40,183,47,1,6,39,32,33,21,24,15,17,7,53,57,22,7,1,43,60,55,71,14,
+80,132,65,58,65,7,7,103,25,120,25,220,3,137,153,253,201,17,24,12,12,16,2,
+14,28,29,73,34,28,34,36,38,57,20,59,24,9,1,12,22,51,39,45,31,25,10,1,23,41,
+41,24,35,23,1,21,6,23,16,18,19,17,25,7,31,45,8,35,51,50,45,5,5,50,42,24,8,
+5,1,15,40,49,49,56,89,26,23,3,77,66,60,1,6,199,254,167,2,195,0,4,252,6,252,
+167,255,144,255,111,0,15,0,54,0,68,0,102,0,0,1,51,21,20,23,22,51,50,55,54,
+53,53,52,39,6,6,55,22,21,20,7,14,2,7,6,35,34,39,34,46,2,39,54,54,55,54,51,
+51,22,22,23,22,51,50,55,54,55,51,2,35,35,38,38,2,6,21,20,22,22,23,54,53,52,
+38,38,35,34,23,6,21,20,23,22,51,50,53,53,51,21,20,35,34,39,38,53,52,55,34,
+39,38,38,53,52,54,54,51,50,22,22,21,20,252,106,1,19,21,26,24,21,19,46,41,
+40,183,47,1,6,39,32,33,21,24,15,17,7,53,57,22,7,1,43,60,55,71,14,80,132,65,
+58,65,7,7,103,25,120,25,220,3,137,153,62,11,11,18,33,17,11,18,10,10,104,10,
+2,7,36,35,110,145,103,29,12,9,27,25,27,31,31,54,28,29,53,30,254,164,6,23,
+16,18,19,17,25,7,31,45,8,35,51,50,45,5,5,50,42,24,8,5,1,15,40,49,49,56,89,
+26,23,3,77,66,60,1,6,199,254,167,2,195,254,224,18,9,11,17,10,2,22,18,9,18,
+11,100,28,26,12,11,19,109,151,156,195,61,26,25,21,19,14,13,47,26,26,48,25,
+25,48,26,24,0,0,1,255,210,6,224,0,76,8,30,0,3,0,0,3,51,17,35,46,122,122,8,
+30,254,194,0,0,2,254,182,6,224,1,123,8,39,0,16,0,46,0,0,2,53,52,39,38,35,
+34,7,6,7,6,21,20,23,22,51,51,6,39,38,53,53,54,55,54,51,50,23,22,23,22,21,
+21,6,7,54,54,55,23,14,2,35,35,53,54,55,90,3,12,22,4,5,29,1,1,26,16,17,11,
+95,30,32,4,44,36,47,10,11,61,22,20,2,87,148,158,41,120,61,112,182,140,214,
+136,54,7,180,11,7,6,22,1,5,25,2,1,23,3,2,54,22,23,39,9,45,26,21,1,6,35,32,
+46,8,52,72,9,116,97,50,105,87,55,60,24,53,0,1,254,238,6,238,1,145,8,38,0,
+64,0,0,19,38,38,39,62,3,55,38,39,38,35,35,6,6,35,34,38,39,34,6,21,20,30,2,
+23,6,7,38,38,53,52,62,2,51,50,22,22,23,54,54,55,50,22,22,23,22,21,21,54,54,
+55,22,22,23,22,21,20,7,14,2,168,22,29,4,10,27,14,19,1,7,13,12,27,5,34,68,
+18,17,65,27,30,26,21,24,30,11,29,39,68,59,34,38,51,37,19,41,52,11,27,55,42,
+33,59,33,10,7,25,14,12,29,33,12,1,20,22,63,92,6,244,5,30,21,10,18,21,19,23,
+25,12,11,26,62,70,15,27,29,22,23,15,20,10,43,9,29,78,49,37,55,41,21,15,49,
+12,22,49,7,27,39,21,17,22,10,36,45,45,2,21,20,4,5,44,37,41,56,49,0,0,1,255,
+82,6,212,0,186,8,48,0,11,0,0,19,35,53,35,53,51,53,51,21,51,21,35,65,119,120,
+120,119,121,121,6,212,118,111,119,119,111,0,1,253,224,5,13,254,90,6,75,0,
+3,0,0,1,51,17,35,253,224,122,122,6,75,254,194,0,2,252,238,5,4,255,179,6,143,
+0,17,0,47,0,0,0,53,52,39,38,35,34,7,6,7,6,21,20,23,22,51,50,55,6,39,38,53,
+53,54,55,54,51,50,23,22,23,22,21,21,6,7,54,54,55,23,14,2,35,35,53,54,55,253,
+222,3,12,22,4,5,29,1,1,26,14,15,7,8,95,30,32,4,44,36,47,10,11,61,22,20,2,
+87,148,158,41,120,61,112,182,140,214,136,54,6,4,13,9,7,26,1,6,30,2,2,27,4,
+3,1,65,26,28,47,11,54,32,25,1,7,42,39,56,10,63,87,11,141,117,61,126,106,66,
+73,29,63,0,1,252,219,5,7,255,126,6,63,0,64,0,0,1,38,38,39,62,3,55,38,39,38,
+35,35,6,6,35,34,38,39,34,6,21,20,30,2,23,6,7,38,38,53,52,62,2,51,50,22,22,
+23,54,54,55,50,22,22,23,22,21,21,54,54,55,22,22,23,22,21,20,7,14,2,254,149,
+22,29,4,10,27,14,19,1,7,13,12,27,5,34,68,18,17,65,27,30,26,21,24,30,11,29,
+39,68,59,34,38,51,37,19,41,52,11,27,55,42,33,59,33,10,7,25,14,12,29,33,12,
+1,20,22,63,92,5,13,5,30,21,10,18,21,19,23,25,12,11,26,62,70,15,27,29,22,23,
+15,20,10,43,9,29,78,49,37,55,41,21,15,49,12,22,49,7,27,39,21,17,22,10,36,
+45,45,2,21,20,4,5,44,37,41,56,49,0,1,253,97,5,15,254,201,6,107,0,11,0,0,1,
+35,53,35,53,51,53,51,21,51,21,35,254,80,119,120,120,119,121,121,5,15,118,
+111,119,119,111,0,0,4,253,180,252,200,1,62,255,111,0,13,0,45,0,61,0,100,0,
+0,3,52,38,35,34,7,6,21,21,20,22,51,50,54,23,35,14,3,7,39,54,54,55,6,7,35,
+34,39,38,38,53,62,3,55,51,50,22,22,23,22,21,20,1,51,21,20,23,22,51,50,55,
+54,53,53,52,39,6,6,55,22,21,20,7,14,2,7,6,35,34,39,34,46,2,39,54,54,55,54,
+51,51,22,22,23,22,51,50,55,54,55,51,2,35,35,38,38,142,28,16,19,15,14,29,19,
+16,28,129,1,13,17,29,37,59,116,47,63,10,35,19,3,19,30,48,22,12,28,44,38,50,
+5,13,64,53,16,10,254,32,1,19,21,26,24,21,19,46,41,40,183,47,1,6,39,32,33,
+21,24,15,17,7,53,57,22,7,1,43,60,55,71,14,80,132,65,58,65,7,7,103,25,120,
+25,220,3,137,153,253,201,17,24,12,12,16,2,14,28,29,73,34,28,34,36,38,57,20,
+59,24,9,1,12,22,51,39,45,31,25,10,1,23,41,41,24,35,23,1,21,6,23,16,18,19,
+17,25,7,31,45,8,35,51,50,45,5,5,50,42,24,8,5,1,15,40,49,49,56,89,26,23,3,
+77,66,60,1,6,199,254,167,2,195,0,0,4,253,190,252,167,1,72,255,111,0,15,0,
+54,0,68,0,102,0,0,1,51,21,20,23,22,51,50,55,54,53,53,52,39,6,6,55,22,21,20,
+7,14,2,7,6,35,34,39,34,46,2,39,54,54,55,54,51,51,22,22,23,22,51,50,55,54,
+55,51,2,35,35,38,38,2,6,21,20,22,22,23,54,53,52,38,38,35,34,23,6,21,20,23,
+22,51,50,53,53,51,21,20,35,34,39,38,53,52,55,34,39,38,38,53,52,54,54,51,50,
+22,22,21,20,254,34,1,19,21,26,24,21,19,46,41,40,183,47,1,6,39,32,33,21,24,
+15,17,7,53,57,22,7,1,43,60,55,71,14,80,132,65,58,65,7,7,103,25,120,25,220,
+3,137,153,62,11,11,18,33,17,11,18,10,10,104,10,2,7,36,35,110,145,103,29,12,
+9,27,25,27,31,31,54,28,29,53,30,254,164,6,23,16,18,19,17,25,7,31,45,8,35,
+51,50,45,5,5,50,42,24,8,5,1,15,40,49,49,56,89,26,23,3,77,66,60,1,6,199,254,
+167,2,195,254,224,18,9,11,17,10,2,22,18,9,18,11,100,28,26,12,11,19,109,151,
+156,195,61,26,25,21,19,14,13,47,26,26,48,25,25,48,26,24,0,0,4,0,147,0,0,5,
+197,4,116,0,7,0,19,0,29,0,113,0,0,37,52,35,34,21,20,51,50,1,52,38,35,34,6,
+21,20,22,51,50,54,1,34,21,20,23,22,51,50,55,38,1,17,38,39,6,6,7,17,6,7,38,
+39,54,55,54,51,50,23,17,6,7,38,53,52,55,50,23,54,55,4,19,17,54,55,54,54,55,
+55,6,7,6,7,17,20,35,34,53,17,6,35,35,34,7,6,35,34,39,46,2,39,38,53,53,62,
+3,51,50,30,4,23,21,20,7,6,7,20,51,50,1,122,64,64,64,64,1,239,40,23,27,35,
+35,29,23,38,253,204,60,41,7,8,34,39,8,2,212,1,252,171,137,20,7,185,165,9,
+16,113,21,17,41,23,32,30,169,156,139,71,164,164,1,104,28,5,5,31,53,19,135,
+24,97,51,76,67,68,13,14,2,20,41,14,16,28,30,48,104,83,28,26,2,34,53,56,21,
+6,45,54,58,23,13,2,4,6,18,52,30,155,60,60,61,1,218,34,26,38,18,19,41,34,1,
+242,43,45,6,1,25,64,253,232,1,106,134,17,22,80,21,253,47,158,13,3,158,130,
+26,3,16,2,27,4,4,14,144,142,5,108,103,5,9,254,248,254,172,2,3,17,91,76,2,
+185,76,40,20,254,150,35,42,1,82,1,1,1,2,2,22,45,42,38,49,10,42,53,39,16,2,
+14,39,39,30,21,10,17,16,22,23,3,0,0,3,0,147,0,0,5,167,4,116,0,7,0,19,0,105,
+0,0,1,52,35,34,21,20,51,50,1,52,38,35,34,6,21,20,22,51,50,54,5,21,2,33,32,
+17,52,55,38,53,53,16,55,22,21,20,7,20,35,34,39,39,21,20,22,51,50,21,20,35,
+34,6,21,20,33,32,53,53,34,7,6,35,34,39,46,2,39,38,53,53,62,3,51,50,30,4,23,
+21,20,7,6,7,20,51,51,17,52,51,50,21,3,54,55,54,54,55,55,6,7,6,1,204,71,71,
+71,71,1,127,40,23,27,35,35,29,23,38,1,57,1,254,8,254,8,166,166,242,178,2,
+156,74,42,9,125,72,71,71,72,125,1,114,1,112,19,29,14,16,28,30,48,104,83,28,
+26,2,34,53,56,21,6,45,54,58,23,13,2,4,6,18,52,34,68,67,1,28,25,31,53,19,135,
+24,97,65,3,214,68,68,67,254,245,34,26,38,18,19,41,34,158,125,254,169,1,100,
+159,62,63,159,46,1,33,6,2,145,15,16,139,42,13,79,95,68,58,59,68,95,232,219,
+116,1,1,2,2,22,45,42,38,49,10,42,53,39,16,2,14,39,39,30,21,10,17,16,22,23,
+3,2,16,31,30,253,249,7,14,17,91,76,2,185,76,51,0,16,0,98,0,86,4,94,4,82,0,
+7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,119,
+0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,52,
+51,50,23,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,
+50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,
+20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,
+34,53,52,51,50,37,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,39,20,35,34,
+53,52,51,50,3,215,51,55,55,51,147,52,57,57,52,247,55,53,55,53,35,51,55,55,
+51,254,56,54,53,53,54,173,55,53,53,55,2,82,55,53,53,55,253,27,55,54,54,55,
+2,129,51,55,55,51,147,52,57,57,52,253,174,52,57,55,54,35,53,56,56,53,1,199,
+54,53,53,54,254,92,54,55,55,54,247,55,53,53,55,147,55,54,54,55,3,150,54,54,
+55,43,53,53,55,254,211,55,55,53,227,53,53,53,1,148,56,56,53,90,53,53,55,253,
+119,53,53,55,1,185,54,51,58,253,67,53,53,56,154,51,51,55,2,29,55,55,53,227,
+53,53,53,254,4,55,55,54,227,53,53,55,254,213,55,51,55,43,53,53,56,0,0,0,0,
+15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,26,0,94,0,3,0,1,4,9,0,
+2,0,14,0,120,0,3,0,1,4,9,0,3,0,26,0,94,0,3,0,1,4,9,0,4,0,26,0,94,0,3,0,1,
+4,9,0,5,0,30,0,134,0,3,0,1,4,9,0,6,0,22,0,164,0,3,0,1,4,9,0,7,0,68,0,186,
+0,3,0,1,4,9,0,8,0,18,0,254,0,3,0,1,4,9,0,9,0,18,0,254,0,3,0,1,4,9,0,10,0,
+28,1,16,0,3,0,1,4,9,0,11,0,62,1,44,0,3,0,1,4,9,0,12,0,48,1,106,0,3,0,1,4,
+9,0,13,2,150,1,154,0,3,0,1,4,9,0,14,0,52,4,48,0,67,0,111,0,112,0,121,0,114,
+0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,
+0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,
+0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,76,0,
+97,0,111,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,86,0,101,0,114,0,115,0,
+105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,
+0,111,0,83,0,97,0,110,0,115,0,76,0,97,0,111,0,78,0,111,0,116,0,111,0,32,0,
+105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,
+107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,
+110,0,99,0,46,0,68,0,97,0,110,0,104,0,32,0,72,0,111,0,110,0,103,0,68,0,97,
+0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,
+0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,
+0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,107,0,104,0,109,0,101,0,114,0,116,0,121,0,112,0,101,0,46,0,111,
+0,114,0,103,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,
+0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,
+0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,
+0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,
+0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,
+0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,
+0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,
+0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,
+0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,
+0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,
+0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,
+76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,
+0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,
+0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,
+0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,
+0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,
+0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,
+0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,
+0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,
+0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,
+0,0,0,0,255,39,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,0,0,0,
+1,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,
+0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,
+0,34,0,35,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,
+16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,
+1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,
+1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,
+1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,107,1,
+75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,
+1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,
+1,104,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,
+107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,
+1,107,1,107,1,105,1,106,7,117,110,105,48,69,56,49,7,117,110,105,48,69,56,
+50,7,117,110,105,48,69,56,52,7,117,110,105,48,69,56,55,7,117,110,105,48,69,
+56,56,7,117,110,105,48,69,56,65,7,117,110,105,48,69,56,68,7,117,110,105,48,
+69,57,52,7,117,110,105,48,69,57,53,7,117,110,105,48,69,57,54,7,117,110,105,
+48,69,57,55,7,117,110,105,48,69,57,57,7,117,110,105,48,69,57,65,7,117,110,
+105,48,69,57,66,7,117,110,105,48,69,57,67,7,117,110,105,48,69,57,68,7,117,
+110,105,48,69,57,69,7,117,110,105,48,69,57,70,7,117,110,105,48,69,65,49,7,
+117,110,105,48,69,65,50,7,117,110,105,48,69,65,51,7,117,110,105,48,69,65,
+53,7,117,110,105,48,69,65,55,7,117,110,105,48,69,65,65,7,117,110,105,48,69,
+65,66,7,117,110,105,48,69,65,68,7,117,110,105,48,69,65,69,7,117,110,105,48,
+69,65,70,7,117,110,105,48,69,66,48,7,117,110,105,48,69,66,49,7,117,110,105,
+48,69,66,50,7,117,110,105,48,69,66,51,7,117,110,105,48,69,66,52,7,117,110,
+105,48,69,66,53,7,117,110,105,48,69,66,54,7,117,110,105,48,69,66,55,7,117,
+110,105,48,69,66,56,7,117,110,105,48,69,66,57,7,117,110,105,48,69,66,66,7,
+117,110,105,48,69,66,67,7,117,110,105,48,69,66,68,7,117,110,105,48,69,67,
+48,7,117,110,105,48,69,67,49,7,117,110,105,48,69,67,50,7,117,110,105,48,69,
+67,51,7,117,110,105,48,69,67,52,7,117,110,105,48,69,67,54,7,117,110,105,48,
+69,67,56,7,117,110,105,48,69,67,57,7,117,110,105,48,69,67,65,7,117,110,105,
+48,69,67,66,7,117,110,105,48,69,67,67,7,117,110,105,48,69,67,68,7,117,110,
+105,48,69,68,48,7,117,110,105,48,69,68,49,7,117,110,105,48,69,68,50,7,117,
+110,105,48,69,68,51,7,117,110,105,48,69,68,52,7,117,110,105,48,69,68,53,7,
+117,110,105,48,69,68,54,7,117,110,105,48,69,68,55,7,117,110,105,48,69,68,
+56,7,117,110,105,48,69,68,57,7,117,110,105,48,69,68,67,7,117,110,105,48,69,
+68,68,11,117,110,105,48,69,67,56,46,98,108,119,11,117,110,105,48,69,67,57,
+46,98,108,119,11,117,110,105,48,69,67,65,46,98,108,119,11,117,110,105,48,
+69,67,66,46,98,108,119,11,117,110,105,48,69,67,67,46,98,108,119,11,117,110,
+105,48,69,67,68,46,98,108,119,12,117,110,105,48,69,67,68,95,48,69,67,57,0,
+10,117,110,105,48,69,56,49,46,97,109,10,117,110,105,48,69,56,50,46,97,109,
+10,117,110,105,48,69,56,52,46,97,109,10,117,110,105,48,69,56,55,46,97,109,
+10,117,110,105,48,69,56,56,46,97,109,10,117,110,105,48,69,56,65,46,97,109,
+10,117,110,105,48,69,56,68,46,97,109,10,117,110,105,48,69,57,52,46,97,109,
+10,117,110,105,48,69,57,53,46,97,109,10,117,110,105,48,69,57,54,46,97,109,
+10,117,110,105,48,69,57,55,46,97,109,10,117,110,105,48,69,57,57,46,97,109,
+10,117,110,105,48,69,57,65,46,97,109,10,117,110,105,48,69,57,66,46,97,109,
+10,117,110,105,48,69,57,67,46,97,109,10,117,110,105,48,69,57,68,46,97,109,
+10,117,110,105,48,69,57,69,46,97,109,10,117,110,105,48,69,57,70,46,97,109,
+10,117,110,105,48,69,65,49,46,97,109,10,117,110,105,48,69,65,50,46,97,109,
+10,117,110,105,48,69,65,51,46,97,109,10,117,110,105,48,69,65,53,46,97,109,
+10,117,110,105,48,69,65,55,46,97,109,10,117,110,105,48,69,65,65,46,97,109,
+10,117,110,105,48,69,65,66,46,97,109,10,117,110,105,48,69,65,68,46,97,109,
+10,117,110,105,48,69,65,69,46,97,109,10,117,110,105,48,69,68,67,46,97,109,
+10,117,110,105,48,69,68,68,46,97,109,13,117,110,105,48,69,66,51,46,114,105,
+103,104,116,7,117,110,105,50,48,48,66,7,117,110,105,50,53,67,67,0,0,0,0,0,
+0,1,255,255,0,2,0,1,0,0,0,12,0,0,0,0,0,0,0,2,0,1,0,0,0,161,0,1,0,0,0,1,0,
+0,0,10,0,10,0,10,0,0,0,1,0,0,0,10,0,32,0,72,0,1,108,97,111,32,0,8,0,4,0,0,
+0,0,255,255,0,2,0,1,0,0,0,2,108,105,103,97,0,14,114,108,105,103,0,14,0,0,
+0,11,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,18,0,38,0,58,0,84,0,162,
+0,194,1,72,1,122,1,178,2,30,2,62,2,176,3,52,3,140,3,164,3,186,3,210,3,236,
+4,30,0,1,0,0,0,1,0,8,0,1,0,6,0,71,0,1,0,1,0,66,0,6,0,0,0,1,0,8,0,3,0,0,0,
+1,3,58,0,1,0,122,0,1,0,0,0,11,0,6,0,0,0,3,0,12,0,30,0,54,0,3,0,1,3,28,0,1,
+3,58,0,0,0,1,0,0,0,12,0,3,0,1,0,18,0,1,3,40,0,0,0,1,0,0,0,12,0,1,0,1,0,71,
+0,3,0,1,0,18,0,1,3,16,0,0,0,1,0,0,0,12,0,1,0,1,0,72,0,6,0,0,0,1,0,8,0,3,0,
+0,0,1,3,30,0,1,0,18,0,1,0,0,0,13,0,1,0,1,0,137,0,4,0,0,0,1,0,8,0,1,0,110,
+0,8,0,22,0,34,0,46,0,58,0,70,0,80,0,90,0,100,0,2,0,52,0,6,0,107,0,2,0,105,
+0,2,0,50,0,6,0,106,0,2,0,105,0,2,0,48,0,6,0,139,0,2,0,105,0,2,0,46,0,6,0,
+138,0,2,0,105,0,1,0,4,0,107,0,2,0,87,0,1,0,4,0,106,0,2,0,87,0,1,0,4,0,139,
+0,2,0,87,0,1,0,4,0,138,0,2,0,87,0,2,0,2,0,82,0,85,0,0,0,100,0,103,0,4,0,4,
+0,0,0,1,0,8,0,1,0,232,0,1,0,8,0,4,0,10,0,16,0,22,0,28,0,148,0,2,0,71,0,148,
+0,2,0,140,0,149,0,2,0,72,0,149,0,2,0,141,0,4,0,0,0,1,0,8,0,1,0,42,0,1,0,8,
+0,4,0,10,0,16,0,22,0,28,0,150,0,2,0,71,0,150,0,2,0,140,0,151,0,2,0,72,0,151,
+0,2,0,141,0,1,0,1,0,74,0,6,0,0,0,4,0,14,0,32,0,58,0,78,0,3,0,1,0,36,0,1,2,
+8,0,0,0,1,0,0,0,14,0,3,0,0,0,1,1,246,0,1,0,18,0,1,0,0,0,14,0,1,0,2,0,71,0,
+72,0,3,0,2,1,144,0,186,0,1,1,220,0,0,0,1,0,0,0,14,0,3,0,1,0,18,0,1,1,200,
+0,0,0,1,0,0,0,14,0,1,0,4,0,48,0,50,0,52,0,54,0,6,0,0,0,1,0,8,0,3,0,1,0,18,
+0,1,1,190,0,0,0,1,0,0,0,15,0,1,0,1,0,38,0,6,0,0,0,4,0,14,0,34,0,54,0,82,0,
+3,0,0,0,1,1,194,0,2,1,48,0,156,0,1,0,0,0,16,0,3,0,1,1,28,0,1,1,174,0,1,1,
+58,0,1,0,0,0,16,0,3,0,0,0,1,1,154,0,2,1,8,0,20,0,1,0,0,0,16,0,1,0,2,0,140,
+0,141,0,3,0,2,0,236,0,22,0,1,1,126,0,1,0,236,0,1,0,0,0,16,0,2,0,1,0,76,0,
+80,0,0,0,6,0,0,0,3,0,12,0,34,0,90,0,3,0,0,0,1,1,124,0,3,0,222,0,192,1,124,
+0,1,0,0,0,17,0,3,0,0,0,1,1,102,0,3,0,200,0,170,0,22,0,1,0,0,0,17,0,2,0,5,
+0,63,0,65,0,0,0,67,0,74,0,3,0,87,0,87,0,11,0,105,0,105,0,12,0,142,0,147,0,
+13,0,3,0,0,0,1,1,46,0,3,0,114,0,114,0,22,0,1,0,0,0,17,0,1,0,8,0,35,0,38,0,
+41,0,42,0,46,0,47,0,53,0,57,0,1,0,0,0,1,0,8,0,2,0,64,0,29,0,108,0,109,0,110,
+0,111,0,112,0,113,0,114,0,115,0,116,0,117,0,118,0,119,0,120,0,121,0,122,0,
+123,0,124,0,125,0,126,0,127,0,128,0,129,0,130,0,131,0,132,0,133,0,134,0,135,
+0,136,0,2,0,2,0,35,0,61,0,0,0,98,0,99,0,27,0,1,0,0,0,1,0,8,0,1,0,6,0,18,0,
+2,0,1,0,82,0,87,0,0,0,1,0,0,0,1,0,8,0,2,0,28,0,4,0,107,0,106,0,139,0,138,
+0,1,0,0,0,1,0,8,0,1,0,6,0,56,0,2,0,1,0,100,0,103,0,0,0,1,0,0,0,1,0,8,0,2,
+0,10,0,2,0,146,0,147,0,1,0,2,0,64,0,73,0,1,0,0,0,1,0,8,0,2,0,26,0,10,0,67,
+0,68,0,69,0,70,0,64,0,73,0,82,0,83,0,84,0,85,0,2,0,2,0,142,0,147,0,0,0,152,
+0,155,0,6,0,1,0,0,0,1,0,8,0,2,0,18,0,6,0,67,0,68,0,69,0,70,0,64,0,73,0,2,
+0,1,0,142,0,147,0,0,0,0,0,2,0,0,0,0,0,1,0,0,0,31,0,0,2,224,0,0,0,11,0,0,0,
+5,62,128,0,0,0,0,0,1,255,255,255,255,62,128,0,1,0,0,0,0,255,255,255,254,0,
+64,0,1,0,0,0,2,255,255,255,255,0,64,0,2,0,0,0,0,255,255,255,253,0,3,0,4,0,
+0,0,4,255,255,255,255,0,3,0,5,0,0,0,0,255,255,255,251,0,8,0,1,0,0,0,8,255,
+255,255,255,0,8,0,2,0,0,0,0,255,255,255,247,0,1,0,0,0,0,0,16,255,255,255,
+255,0,1,0,1,0,0,0,0,255,255,255,239,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,80,32,0,
+0,5,0,0,0,1,0,0,0,5,0,0,0,20,0,0,0,28,0,0,0,48,0,0,0,64,0,8,0,66,0,1,0,4,
+0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,255,255,255,255,0,0,32,32,
+0,0,255,255,0,65,0,0,0,0,0,20,32,0,0,4,0,0,0,2,0,8,0,66,0,1,0,87,0,0,0,228,
+32,0,0,1,0,0,0,4,0,0,0,6,0,0,0,20,0,0,0,132,0,0,0,168,0,0,0,192,0,8,0,35,
+0,53,0,4,0,4,0,1,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,
+0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,5,0,5,0,5,0,5,0,5,0,5,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,
+0,255,255,255,255,0,2,0,0,255,255,255,255,0,0,0,0,255,255,0,0,0,0,0,4,0,8,
+0,82,0,6,0,100,0,101,0,102,0,103,0,104,0,105,0,0,0,0,0,120,32,0,0,0,0,0,0,
+8,0,0,0,6,0,0,0,16,0,0,0,60,0,0,0,96,0,8,0,65,0,19,0,4,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,5,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,1,0,2,0,0,0,0,0,2,128,0,0,0,
+32,2,0,0,0,140,32,0,0,2,0,0,0,16,0,0,0,6,0,0,0,28,0,0,0,44,0,0,0,80,0,0,0,
+112,0,0,0,120,0,0,0,124,0,8,0,83,0,5,0,5,0,1,0,1,0,1,0,4,0,0,0,0,0,0,0,0,
+0,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,1,0,3,0,1,0,1,0,4,0,0,0,0,0,0,0,0,64,
+0,0,0,0,2,128,0,0,0,0,2,0,0,0,0,0,0,160,0,0,0,0,0,63,255,255,173,191,255,
+255,170,0,0,0,0,0,106,0,0,};
+#endif
@@ -0,0 +1,4094 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansLepcha_Regular_ttf_size = 102072;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansLepcha_Regular_ttf");
+asm(".type fz_font_NotoSansLepcha_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansLepcha_Regular_ttf, 102072");
+asm(".balign 64");
+asm("fz_font_NotoSansLepcha_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansLepcha-Regular.ttf\"");
+#else
+const int fz_font_NotoSansLepcha_Regular_ttf_size = 102072;
+const char fz_font_NotoSansLepcha_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,5,229,17,57,0,1,44,180,0,0,0,54,71,
+80,79,83,195,190,138,120,0,1,44,236,0,0,41,44,71,83,85,66,73,238,212,106,
+0,1,86,24,0,0,56,160,79,83,47,50,125,192,110,226,0,0,1,104,0,0,0,96,99,109,
+97,112,192,64,60,6,0,0,24,180,0,0,0,244,103,97,115,112,0,7,0,7,0,1,44,168,
+0,0,0,12,103,108,121,102,30,191,48,37,0,0,37,40,0,1,1,96,104,101,97,100,11,
+163,56,175,0,0,0,236,0,0,0,54,104,104,101,97,21,123,9,232,0,0,1,36,0,0,0,
+36,104,109,116,120,100,68,74,179,0,0,1,200,0,0,22,234,108,111,99,97,30,81,
+93,99,0,0,25,168,0,0,11,128,109,97,120,112,5,215,0,255,0,0,1,72,0,0,0,32,
+110,97,109,101,140,65,184,98,0,1,38,136,0,0,6,0,112,111,115,116,255,184,0,
+50,0,1,44,136,0,0,0,32,0,1,0,0,0,1,7,174,28,134,85,128,95,15,60,245,0,11,
+8,0,0,0,0,0,205,53,107,128,0,0,0,0,210,99,123,155,254,135,252,174,14,100,
+8,58,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,252,174,0,0,14,172,254,135,248,
+215,14,100,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,182,0,1,0,0,5,191,0,116,0,8,
+0,137,0,11,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,4,8,225,1,144,0,5,0,0,5,
+154,5,51,0,0,0,154,5,154,5,51,0,0,2,205,0,50,2,200,0,0,2,11,5,2,4,5,4,2,2,
+4,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,71,79,79,71,0,64,0,0,254,255,8,141,252,
+174,0,0,8,141,3,82,0,0,0,1,0,0,0,0,5,194,8,58,0,0,0,32,0,5,4,205,0,193,0,
+0,0,0,2,20,0,0,2,20,0,0,4,223,0,113,6,80,0,113,7,244,0,113,6,20,0,113,7,133,
+0,113,9,41,0,113,8,233,0,113,10,90,0,113,7,133,0,113,8,231,255,254,9,178,
+0,113,8,23,0,143,9,135,0,113,7,174,0,113,9,31,0,113,8,49,0,113,9,162,0,113,
+9,8,0,113,10,121,0,113,7,180,0,113,9,37,0,113,6,80,0,113,7,178,255,254,8,
+125,0,113,6,225,0,143,8,82,0,113,6,121,0,113,7,233,0,113,6,201,0,113,8,57,
+0,113,7,211,0,113,9,68,0,113,5,59,0,143,6,172,0,113,8,80,0,113,6,100,0,143,
+7,213,0,113,9,121,0,113,8,8,0,143,9,121,0,113,11,29,0,113,10,221,0,143,12,
+78,0,113,9,121,0,113,10,178,255,254,11,166,0,113,9,174,0,143,11,31,0,113,
+9,162,0,113,11,18,0,113,9,250,0,143,11,106,0,113,10,252,0,143,12,109,0,113,
+9,57,0,143,10,170,0,113,7,213,0,113,9,14,255,254,10,2,0,113,8,10,0,143,9,
+123,0,113,7,254,0,113,9,111,0,113,8,160,0,143,10,16,0,113,9,88,0,143,10,201,
+0,113,7,68,0,143,8,180,0,113,10,88,0,113,10,25,0,143,11,137,0,113,8,180,0,
+113,9,238,255,254,10,225,0,113,8,233,0,143,10,90,0,113,8,221,0,113,10,78,
+0,113,9,53,0,143,10,166,0,113,10,55,0,143,11,168,0,113,8,16,0,143,9,129,0,
+113,6,172,0,113,7,229,255,254,8,217,0,113,6,225,0,143,8,82,0,113,6,213,0,
+113,8,70,0,113,7,6,0,143,8,119,0,113,8,6,0,143,9,119,0,113,7,119,0,143,8,
+231,0,113,10,139,0,113,9,158,0,143,11,14,0,113,12,178,0,113,12,115,0,143,
+13,227,0,113,11,14,0,113,12,72,255,254,13,59,0,113,11,68,0,143,12,180,0,113,
+11,55,0,113,12,168,0,113,11,143,0,143,13,0,0,113,12,145,0,143,14,2,0,113,
+10,76,0,143,11,188,0,113,8,231,0,113,10,33,255,254,11,20,0,113,9,29,0,143,
+10,141,0,113,9,16,0,113,10,129,0,113,9,66,0,143,10,178,0,113,10,66,0,143,
+11,178,0,113,5,106,0,47,6,219,0,113,8,127,0,113,8,63,0,47,9,176,0,113,6,219,
+0,113,8,61,255,254,9,8,0,113,7,27,0,143,8,139,0,113,7,4,0,113,8,117,0,113,
+7,53,0,47,8,166,0,113,8,53,0,47,9,166,0,113,5,143,0,57,7,0,0,113,8,164,0,
+113,8,100,0,57,9,213,0,113,7,0,0,113,8,98,255,254,9,45,0,113,7,145,0,143,
+9,2,0,113,7,41,0,113,8,154,0,113,7,203,0,57,9,59,0,113,8,131,0,57,9,244,0,
+113,0,0,254,188,0,0,254,188,0,0,254,188,0,0,254,182,0,0,254,188,0,0,254,135,
+0,0,254,188,4,219,0,80,6,76,0,113,7,240,0,113,7,20,0,80,8,133,0,113,10,41,
+0,113,9,233,0,80,11,90,0,113,8,133,0,113,9,231,255,254,10,178,0,113,9,23,
+0,143,10,135,0,113,8,225,0,113,10,82,0,113,9,49,0,80,10,162,0,113,10,8,0,
+80,11,121,0,113,7,176,0,80,9,33,0,113,6,76,0,113,7,174,255,254,8,121,0,113,
+6,221,0,143,8,78,0,113,6,168,0,113,8,25,0,113,7,23,0,80,8,135,0,113,7,207,
+0,80,9,63,0,113,5,78,0,96,6,190,0,113,8,98,0,113,8,35,0,96,9,147,0,113,6,
+190,0,113,8,33,255,254,8,236,0,113,7,80,0,143,8,193,0,113,6,231,0,113,8,88,
+0,113,7,137,0,96,8,250,0,113,8,66,0,96,9,178,0,113,4,20,0,106,5,154,0,113,
+4,20,0,106,4,20,0,106,4,20,0,106,6,229,0,113,4,20,0,106,4,20,0,106,4,20,0,
+106,4,20,0,106,4,20,0,106,5,59,0,106,6,100,0,106,6,184,0,106,4,20,0,106,6,
+143,255,254,5,195,0,143,6,250,0,113,5,152,0,106,6,141,0,106,4,188,0,72,6,
+45,0,113,7,209,0,113,4,188,0,72,6,45,0,113,7,209,0,113,7,145,0,72,9,2,0,113,
+6,45,0,113,7,143,255,254,8,90,0,113,6,190,0,143,8,47,0,113,6,86,0,113,7,199,
+0,113,6,248,0,72,8,104,0,113,7,176,0,72,9,33,0,113,7,145,0,72,9,2,0,113,6,
+45,0,113,7,143,255,254,8,90,0,113,6,129,0,143,7,242,0,113,6,86,0,113,7,199,
+0,113,6,248,0,72,8,104,0,113,7,176,0,72,9,33,0,113,5,10,0,121,6,123,0,113,
+8,31,0,113,5,254,0,121,7,111,0,113,9,18,0,113,7,193,0,121,9,49,0,113,10,213,
+0,113,10,150,0,121,12,6,0,113,9,49,0,113,10,147,255,254,11,94,0,113,9,195,
+0,143,11,51,0,113,9,90,0,113,10,203,0,113,9,178,0,121,11,35,0,113,10,180,
+0,121,12,37,0,113,8,211,0,121,10,68,0,113,7,111,0,113,8,209,255,254,9,156,
+0,113,8,0,0,143,9,113,0,113,7,152,0,113,9,8,0,113,8,57,0,121,9,170,0,113,
+8,242,0,121,10,98,0,113,6,242,0,121,8,98,0,113,10,6,0,113,9,199,0,121,11,
+55,0,113,8,98,0,113,9,197,255,254,10,143,0,113,8,244,0,143,10,100,0,113,8,
+139,0,113,9,252,0,113,8,227,0,121,10,84,0,113,9,229,0,121,11,86,0,113,7,223,
+0,121,9,80,0,113,6,123,0,113,7,221,255,254,8,168,0,113,7,12,0,143,8,125,0,
+113,6,164,0,113,8,20,0,113,7,70,0,121,8,182,0,113,7,254,0,121,9,111,0,113,
+7,205,0,143,9,61,0,113,10,225,0,113,9,238,0,143,11,94,0,113,13,2,0,113,12,
+195,0,143,14,51,0,113,11,94,0,113,12,152,255,254,13,139,0,113,11,147,0,143,
+13,4,0,113,11,135,0,113,12,248,0,113,11,223,0,143,13,80,0,113,12,225,0,143,
+14,82,0,113,10,162,0,143,12,18,0,113,9,61,0,113,10,119,255,254,11,106,0,113,
+9,115,0,143,10,227,0,113,9,102,0,113,10,215,0,113,9,152,0,143,11,8,0,113,
+10,152,0,143,12,8,0,113,7,119,0,143,8,231,0,113,10,139,0,113,8,162,0,143,
+10,18,0,113,11,182,0,113,11,119,0,143,12,231,0,113,10,18,0,113,11,76,255,
+254,12,63,0,113,10,72,0,143,11,184,0,113,10,59,0,113,11,172,0,113,10,221,
+0,143,12,78,0,113,11,150,0,143,13,6,0,113,8,162,0,143,10,18,0,113,11,182,
+0,113,10,72,0,143,11,184,0,113,13,92,0,113,13,29,0,143,14,141,0,113,11,184,
+0,113,12,242,255,254,13,229,0,113,11,238,0,143,13,94,0,113,11,225,0,113,13,
+82,0,113,12,57,0,143,13,170,0,113,13,59,0,143,14,172,0,113,11,119,0,143,12,
+231,0,113,10,18,0,113,11,76,255,254,12,63,0,113,10,72,0,143,11,184,0,113,
+10,59,0,113,11,172,0,113,10,172,0,143,12,29,0,113,11,150,0,143,13,6,0,113,
+9,125,0,143,10,238,0,113,12,145,0,113,12,82,0,143,13,195,0,113,10,238,0,113,
+12,39,255,254,13,27,0,113,11,35,0,143,12,147,0,113,11,23,0,113,12,135,0,113,
+11,111,0,143,12,223,0,113,12,113,0,143,13,225,0,113,10,76,0,143,11,188,0,
+113,8,231,0,113,10,33,255,254,11,20,0,113,9,29,0,143,10,141,0,113,9,16,0,
+113,10,129,0,113,9,66,0,143,10,178,0,113,10,66,0,143,11,178,0,113,7,119,0,
+55,8,231,0,113,10,139,0,113,9,125,0,55,10,238,0,113,12,145,0,113,12,82,0,
+55,13,195,0,113,10,238,0,113,12,80,255,254,13,27,0,113,11,127,0,143,12,240,
+0,113,11,23,0,113,12,135,0,113,11,111,0,55,12,223,0,113,12,113,0,55,13,225,
+0,113,10,76,0,55,11,188,0,113,8,231,0,113,10,74,255,254,11,20,0,113,9,121,
+0,143,10,233,0,113,9,16,0,113,10,129,0,113,9,117,0,55,10,229,0,113,10,106,
+0,55,11,219,0,113,5,174,0,72,7,31,0,113,8,195,0,113,6,76,0,72,7,188,0,113,
+9,96,0,113,9,33,0,72,10,145,0,113,7,188,0,113,9,31,255,254,9,233,0,113,8,
+78,0,143,9,190,0,113,8,14,0,113,9,127,0,113,8,184,0,72,10,41,0,113,9,63,0,
+72,10,176,0,113,6,76,0,72,7,188,0,113,9,96,0,113,7,246,0,72,9,102,0,113,11,
+10,0,113,10,203,0,72,12,59,0,113,9,102,0,113,10,201,255,254,11,147,0,113,
+9,248,0,143,11,104,0,113,9,143,0,113,11,0,0,113,9,231,0,72,11,88,0,113,10,
+233,0,72,12,90,0,113,9,33,0,72,10,145,0,113,7,188,0,113,9,31,255,254,9,233,
+0,113,8,78,0,143,9,190,0,113,7,229,0,111,9,86,0,113,8,184,0,72,10,41,0,113,
+9,63,0,72,10,176,0,113,7,102,0,72,8,215,0,113,10,123,0,113,10,59,0,72,11,
+172,0,113,8,215,0,113,10,57,255,254,11,4,0,113,9,104,0,143,10,217,0,113,9,
+41,0,113,10,154,0,113,9,88,0,72,10,201,0,113,10,90,0,72,11,203,0,113,8,131,
+0,72,9,244,0,113,7,31,0,113,8,129,255,254,9,76,0,113,7,176,0,143,9,33,0,113,
+7,113,0,113,8,225,0,113,7,233,0,72,9,90,0,113,8,162,0,72,10,18,0,113,4,184,
+0,61,6,41,0,113,7,164,0,113,6,160,0,61,8,16,0,113,9,139,0,113,9,117,0,61,
+10,229,0,113,8,16,0,113,9,115,255,254,10,61,0,113,8,162,0,143,10,18,0,113,
+8,98,0,113,9,170,0,113,8,219,0,61,10,76,0,113,9,147,0,61,11,4,0,113,7,90,
+0,61,8,203,0,113,6,41,0,113,7,139,255,254,8,86,0,113,6,186,0,143,8,43,0,113,
+6,123,0,113,7,236,0,113,6,244,0,61,8,100,0,113,7,172,0,61,9,29,0,113,5,180,
+0,143,7,37,0,113,8,201,0,113,7,94,0,143,8,207,0,113,10,115,0,113,10,51,0,
+143,11,164,0,113,8,207,0,113,10,49,255,254,10,252,0,113,9,63,0,143,10,176,
+0,113,8,248,0,113,10,104,0,113,9,123,0,143,10,236,0,113,10,82,0,143,11,195,
+0,113,8,137,0,143,9,250,0,113,7,37,0,113,8,135,255,254,9,82,0,113,7,150,0,
+143,9,6,0,113,7,78,0,113,8,190,0,113,7,240,0,143,9,96,0,113,8,168,0,143,10,
+25,0,113,4,209,0,143,6,66,0,113,7,229,0,113,5,193,0,143,7,49,0,113,8,213,
+0,113,8,150,0,143,10,6,0,113,7,49,0,113,8,147,255,254,9,94,0,113,7,133,0,
+143,8,246,0,113,7,90,0,113,8,203,0,113,8,78,0,143,9,190,0,113,8,180,0,143,
+10,37,0,113,5,193,0,143,7,49,0,113,8,213,0,113,7,111,0,143,8,223,0,113,10,
+131,0,113,10,68,0,143,11,180,0,113,8,223,0,113,10,66,255,254,11,12,0,113,
+9,51,0,143,10,164,0,113,9,8,0,113,10,121,0,113,9,170,0,143,11,27,0,113,10,
+98,0,143,11,211,0,113,8,150,0,143,10,6,0,113,7,49,0,113,8,147,255,254,9,94,
+0,113,7,133,0,143,8,246,0,113,7,90,0,113,8,203,0,113,8,78,0,143,9,190,0,113,
+8,180,0,143,10,37,0,113,6,184,0,143,8,41,0,113,9,205,0,113,9,141,0,143,10,
+254,0,113,8,41,0,113,9,139,255,254,10,86,0,113,8,125,0,143,9,238,0,113,8,
+82,0,113,9,195,0,113,8,170,0,143,10,27,0,113,9,172,0,143,11,29,0,113,7,166,
+0,143,9,23,0,113,6,66,0,113,7,164,255,254,8,111,0,113,6,150,0,143,8,6,0,113,
+6,106,0,113,7,219,0,113,7,12,0,143,8,125,0,113,7,197,0,143,9,53,0,113,5,47,
+0,137,6,160,0,113,8,68,0,113,5,254,0,137,7,111,0,113,9,18,0,113,8,211,0,137,
+10,68,0,113,7,111,0,113,8,168,255,254,9,156,0,113,7,174,0,143,9,31,0,113,
+7,152,0,113,9,8,0,113,8,57,0,137,9,170,0,113,8,242,0,137,10,98,0,113,7,0,
+0,137,8,113,0,113,10,20,0,113,9,213,0,137,11,70,0,113,8,113,0,113,9,170,255,
+254,10,158,0,113,8,176,0,143,10,33,0,113,8,154,0,113,10,10,0,113,8,242,0,
+137,10,98,0,113,9,244,0,137,11,100,0,113,8,4,0,137,9,117,0,113,6,160,0,113,
+7,217,255,254,8,205,0,113,6,223,0,143,8,80,0,113,6,201,0,113,8,57,0,113,7,
+106,0,137,8,219,0,113,8,35,0,137,9,147,0,113,4,84,0,72,5,197,0,113,7,104,
+0,113,6,68,0,72,7,180,0,113,9,88,0,113,9,25,0,72,10,137,0,113,7,180,0,113,
+9,23,255,254,9,225,0,113,8,8,0,143,9,121,0,113,7,221,0,113,9,78,0,113,8,96,
+0,72,9,209,0,113,9,55,0,72,10,168,0,113,7,41,0,72,8,154,0,113,5,197,0,113,
+7,39,255,254,7,242,0,113,6,25,0,143,7,137,0,113,5,238,0,113,7,94,0,113,6,
+143,0,72,8,0,0,113,7,72,0,72,8,184,0,113,7,205,0,143,9,61,0,113,10,225,0,
+113,9,238,0,143,11,94,0,113,13,2,0,113,12,195,0,143,14,51,0,113,11,94,0,113,
+12,152,255,254,13,139,0,113,11,147,0,143,13,4,0,113,11,135,0,113,12,248,0,
+113,11,223,0,143,13,80,0,113,12,225,0,143,14,82,0,113,10,162,0,143,12,18,
+0,113,9,61,0,113,10,119,255,254,11,106,0,113,9,115,0,143,10,227,0,113,9,102,
+0,113,10,215,0,113,9,152,0,143,11,8,0,113,10,152,0,143,12,8,0,113,5,238,0,
+143,7,94,0,113,9,2,0,113,6,252,0,143,8,109,0,113,10,16,0,113,8,250,0,143,
+10,106,0,113,12,14,0,113,11,207,0,143,13,63,0,113,10,106,0,113,11,205,255,
+254,12,152,0,113,10,231,0,143,12,88,0,113,10,147,0,113,12,4,0,113,11,23,0,
+143,12,135,0,113,11,238,0,143,13,94,0,113,9,209,0,143,11,66,0,113,8,109,0,
+113,9,207,255,254,10,154,0,113,8,233,0,143,10,90,0,113,8,150,0,113,10,6,0,
+113,8,254,0,143,10,111,0,113,9,240,0,143,11,96,0,113,7,209,0,143,9,66,0,113,
+10,229,0,113,10,166,0,143,12,23,0,113,9,66,0,113,10,164,255,254,11,111,0,
+113,9,190,0,143,11,47,0,113,9,106,0,113,10,219,0,113,9,238,0,143,11,94,0,
+113,10,197,0,143,12,53,0,113,8,195,0,143,10,51,0,113,7,94,0,113,8,193,255,
+254,9,139,0,113,7,240,0,143,9,96,0,113,7,135,0,113,8,248,0,113,8,41,0,143,
+9,154,0,113,8,225,0,143,10,82,0,113,5,238,0,143,7,94,0,113,9,2,0,113,7,209,
+0,143,9,66,0,113,10,229,0,113,10,166,0,143,12,23,0,113,9,66,0,113,10,164,
+255,254,11,111,0,113,9,170,0,143,11,27,0,113,9,106,0,113,10,219,0,113,9,238,
+0,143,11,94,0,113,10,197,0,143,12,53,0,113,8,195,0,143,10,51,0,113,7,94,0,
+113,8,193,255,254,9,139,0,113,7,199,0,143,9,55,0,113,7,135,0,113,8,248,0,
+113,8,41,0,143,9,154,0,113,8,225,0,143,10,82,0,113,5,215,0,143,7,72,0,113,
+8,236,0,113,8,172,0,143,10,29,0,113,7,72,0,113,8,170,255,254,9,117,0,113,
+7,217,0,143,9,74,0,113,7,113,0,113,8,225,0,113,7,203,0,143,9,59,0,113,8,203,
+0,143,10,59,0,113,3,111,0,41,4,223,0,113,6,70,0,113,4,133,0,41,5,246,0,113,
+7,92,0,113,6,43,0,41,7,156,0,113,9,63,0,113,9,0,0,41,10,113,0,113,7,156,0,
+113,8,254,255,254,9,201,0,113,8,45,0,143,9,158,0,113,7,197,0,111,9,53,0,113,
+8,102,0,41,9,215,0,113,9,31,0,41,10,143,0,113,7,90,0,41,8,203,0,113,5,246,
+0,113,7,88,255,254,8,35,0,113,6,135,0,143,7,248,0,113,6,31,0,111,7,143,0,
+113,6,135,0,41,7,248,0,113,7,121,0,41,8,233,0,113,5,59,0,41,6,172,0,113,8,
+80,0,113,8,16,0,41,9,129,0,113,6,172,0,113,8,14,255,254,8,217,0,113,7,61,
+0,143,8,174,0,113,6,213,0,111,8,70,0,113,7,88,0,41,8,201,0,113,8,47,0,41,
+9,160,0,113,6,27,0,41,7,139,0,113,4,223,0,113,6,66,255,254,7,12,0,113,5,113,
+0,143,6,225,0,113,5,8,0,111,6,121,0,113,5,170,0,41,7,27,0,113,6,98,0,41,7,
+211,0,113,4,225,0,66,6,82,0,113,7,246,0,113,7,182,0,66,9,39,0,113,6,82,0,
+113,7,180,255,254,8,127,0,113,6,227,0,143,8,84,0,113,6,123,0,113,7,236,0,
+113,6,244,0,66,8,100,0,113,7,213,0,66,9,70,0,113,4,207,0,96,6,63,0,113,7,
+227,0,113,5,233,0,96,7,90,0,113,8,254,0,113,7,162,0,96,9,18,0,113,10,182,
+0,113,10,119,0,96,11,231,0,113,9,18,0,113,10,117,255,254,11,63,0,113,9,164,
+0,143,11,20,0,113,9,111,0,113,10,223,0,113,9,147,0,96,11,4,0,113,10,150,0,
+96,12,6,0,113,8,190,0,96,10,47,0,113,7,90,0,113,8,188,255,254,9,135,0,113,
+7,236,0,143,9,92,0,113,7,182,0,113,9,39,0,113,8,37,0,96,9,150,0,113,8,221,
+0,96,10,78,0,113,7,35,0,96,8,147,0,113,10,55,0,113,9,248,0,96,11,104,0,113,
+8,147,0,113,9,246,255,254,10,193,0,113,9,37,0,143,10,150,0,113,8,240,0,113,
+10,96,0,113,9,20,0,96,10,133,0,113,10,23,0,96,11,135,0,113,7,164,0,96,9,20,
+0,113,6,63,0,113,7,162,255,254,8,109,0,113,6,209,0,143,8,66,0,113,6,156,0,
+113,8,12,0,113,7,10,0,96,8,123,0,113,7,195,0,96,9,51,0,113,4,207,0,96,6,63,
+0,113,7,227,0,113,7,35,0,96,8,147,0,113,10,55,0,113,9,248,0,96,11,104,0,113,
+8,147,0,113,9,246,255,254,10,193,0,113,9,37,0,143,10,150,0,113,8,188,0,113,
+10,45,0,113,9,20,0,96,10,133,0,113,10,23,0,96,11,135,0,113,7,164,0,96,9,20,
+0,113,6,63,0,113,7,162,255,254,8,109,0,113,6,209,0,143,8,66,0,113,6,156,0,
+113,8,12,0,113,7,10,0,96,8,123,0,113,7,195,0,96,9,51,0,113,4,207,0,96,6,63,
+0,113,7,227,0,113,6,233,0,96,8,90,0,113,9,254,0,113,9,190,0,96,11,47,0,113,
+8,90,0,113,9,188,255,254,10,135,0,113,8,203,0,143,10,59,0,113,8,131,0,113,
+9,244,0,113,9,6,0,96,10,119,0,113,9,221,0,96,11,78,0,113,7,164,0,96,9,20,
+0,113,6,63,0,113,7,162,255,254,8,109,0,113,6,176,0,143,8,33,0,113,6,104,0,
+113,7,217,0,113,7,10,0,96,8,123,0,113,7,195,0,96,9,51,0,113,4,18,0,82,5,131,
+0,113,6,244,0,113,4,18,0,82,5,131,0,113,7,39,0,113,6,231,0,82,8,88,0,113,
+5,131,0,113,6,229,255,254,7,176,0,113,6,20,0,143,7,133,0,113,5,172,0,111,
+7,29,0,113,6,78,0,82,7,190,0,113,7,6,0,82,8,119,0,113,6,8,0,82,7,121,0,113,
+8,233,0,113,8,221,0,82,10,78,0,113,7,121,0,113,8,219,255,254,9,166,0,113,
+8,10,0,143,9,123,0,113,7,162,0,111,9,18,0,113,8,37,0,82,9,150,0,113,8,252,
+0,82,10,109,0,113,6,190,0,82,8,47,0,113,5,131,0,113,6,229,255,254,7,176,0,
+113,6,20,0,143,7,133,0,113,5,172,0,111,7,29,0,113,6,78,0,82,7,190,0,113,7,
+6,0,82,8,119,0,113,8,20,0,143,9,133,0,113,11,41,0,113,10,233,0,143,12,90,
+0,113,9,133,0,113,10,190,255,254,11,178,0,113,9,186,0,143,11,43,0,113,9,174,
+0,113,11,31,0,113,10,80,0,143,11,193,0,113,11,8,0,143,12,121,0,113,5,102,
+0,143,6,215,0,113,8,123,0,113,7,133,0,143,8,246,0,113,10,154,0,113,10,90,
+0,143,11,203,0,113,8,246,0,113,10,47,255,254,11,35,0,113,9,43,0,143,10,156,
+0,113,9,31,0,113,10,143,0,113,9,119,0,143,10,231,0,113,10,121,0,143,11,233,
+0,113,8,59,0,143,9,172,0,113,6,215,0,113,8,16,255,254,9,4,0,113,7,12,0,143,
+8,125,0,113,7,0,0,113,8,113,0,113,7,162,0,143,9,18,0,113,8,90,0,143,9,203,
+0,113,5,29,0,31,6,141,0,113,8,49,0,113,6,188,0,31,8,45,0,113,9,209,0,113,
+9,145,0,31,11,2,0,113,8,45,0,113,9,143,255,254,10,90,0,113,8,119,0,143,9,
+231,0,113,8,45,0,113,9,158,0,113,8,174,0,31,10,31,0,113,9,176,0,31,11,33,
+0,113,7,242,0,31,9,98,0,113,6,141,0,113,7,240,255,254,8,186,0,113,6,215,0,
+143,8,72,0,113,6,141,0,113,7,254,0,113,7,88,0,31,8,201,0,113,8,16,0,31,9,
+129,0,113,5,84,0,72,6,197,0,113,8,104,0,113,7,94,0,72,8,207,0,113,10,115,
+0,113,10,51,0,72,11,164,0,113,8,207,0,113,10,49,255,254,10,252,0,113,9,96,
+0,143,10,209,0,113,8,248,0,113,10,104,0,113,9,123,0,72,10,236,0,113,10,82,
+0,72,11,195,0,113,8,41,0,72,9,154,0,113,6,197,0,113,8,39,255,254,8,242,0,
+113,7,86,0,143,8,199,0,113,6,238,0,113,8,94,0,113,7,143,0,72,9,0,0,113,8,
+72,0,72,9,184,0,113,5,31,0,102,6,143,0,113,8,51,0,113,7,244,0,102,9,100,0,
+113,6,143,0,113,7,242,255,254,8,188,0,113,7,33,0,143,8,145,0,113,6,184,0,
+113,8,41,0,113,7,90,0,102,8,203,0,113,8,18,0,102,9,131,0,113,8,61,0,143,9,
+174,0,113,11,82,0,113,11,18,0,143,12,131,0,113,9,174,0,113,10,231,255,254,
+11,219,0,113,9,227,0,143,11,84,0,113,9,215,0,113,11,72,0,113,10,59,0,143,
+11,172,0,113,11,49,0,143,12,162,0,113,4,131,0,96,5,244,0,113,7,152,0,113,
+7,88,0,96,8,201,0,113,5,244,0,113,7,86,255,254,8,33,0,113,6,133,0,143,7,246,
+0,113,6,29,0,111,7,141,0,113,6,190,0,96,8,47,0,113,7,119,0,96,8,231,0,113,
+4,131,0,96,5,244,0,113,7,152,0,113,7,88,0,96,8,201,0,113,5,244,0,113,7,86,
+255,254,8,33,0,113,6,133,0,143,7,246,0,113,6,29,0,111,7,141,0,113,6,190,0,
+96,8,47,0,113,7,119,0,96,8,231,0,113,5,59,0,143,6,172,0,113,8,80,0,113,7,
+68,0,143,8,180,0,113,10,88,0,113,10,25,0,143,11,137,0,113,8,180,0,113,9,238,
+255,254,10,225,0,113,8,233,0,143,10,90,0,113,8,221,0,113,10,78,0,113,9,53,
+0,143,10,166,0,113,10,55,0,143,11,168,0,113,8,16,0,143,9,129,0,113,6,172,
+0,113,7,229,255,254,8,217,0,113,6,225,0,143,8,82,0,113,6,213,0,113,8,70,0,
+113,7,6,0,143,8,119,0,113,8,6,0,143,9,119,0,113,3,158,0,113,3,115,0,113,1,
+154,0,113,3,10,0,113,1,154,0,113,1,154,0,113,1,154,0,113,1,154,0,113,1,154,
+0,113,1,154,0,113,8,145,0,143,10,2,0,113,11,166,0,113,11,102,0,143,12,215,
+0,113,10,2,0,113,11,100,255,254,12,47,0,113,10,147,0,143,12,4,0,113,10,43,
+0,113,11,156,0,113,10,205,0,143,12,61,0,113,11,133,0,143,12,246,0,113,4,53,
+0,143,5,166,0,113,7,74,0,113,7,10,0,143,8,123,0,113,5,166,0,113,7,8,255,254,
+7,211,0,113,6,55,0,143,7,168,0,113,5,207,0,111,7,63,0,113,6,113,0,143,7,225,
+0,113,7,41,0,143,8,154,0,113,1,113,0,113,3,20,0,113,1,215,0,82,2,197,255,
+195,2,213,0,41,2,211,255,254,2,2,0,143,1,154,0,113,2,59,255,10,2,244,255,
+215,1,154,0,113,1,154,0,111,3,236,0,113,3,236,0,133,4,125,0,102,4,156,0,133,
+5,109,0,113,5,102,0,113,4,186,0,51,3,197,0,72,4,92,0,113,4,8,0,143,4,49,0,
+82,3,113,0,164,2,0,0,164,4,180,0,82,4,131,0,62,4,20,0,106,0,0,255,154,254,
+221,254,233,254,182,255,31,254,135,254,207,255,150,254,188,254,158,0,0,0,
+0,0,1,0,3,0,1,0,0,0,12,0,4,0,232,0,0,0,22,0,16,0,3,0,6,0,0,0,13,0,32,0,160,
+28,55,28,63,28,73,28,79,37,204,254,255,255,255,0,0,0,0,0,13,0,32,0,160,28,
+0,28,59,28,64,28,77,37,204,254,255,255,255,0,1,255,245,255,227,255,99,0,0,
+0,0,233,101,0,0,223,232,1,2,0,1,0,0,0,0,0,0,0,0,0,14,0,124,0,0,0,130,0,0,
+0,0,0,0,2,111,2,239,2,191,1,111,1,191,3,159,0,132,0,148,2,79,3,223,4,207,
+4,239,0,171,3,143,3,239,4,79,4,47,1,15,1,79,0,36,0,100,3,47,3,111,5,15,5,
+31,0,239,5,137,4,111,3,15,1,223,2,47,5,79,4,159,4,175,5,121,0,4,5,156,5,155,
+5,157,5,158,5,159,5,160,5,161,5,162,5,190,5,181,5,183,5,182,5,184,5,185,5,
+186,5,187,5,154,5,153,5,189,5,188,5,177,5,176,5,175,5,179,5,178,5,47,5,63,
+0,203,0,0,0,21,0,21,0,21,0,21,0,88,0,100,0,112,0,202,0,214,0,226,0,238,0,
+254,1,14,1,26,1,43,1,55,1,71,1,83,1,99,1,111,1,127,1,139,1,155,1,167,1,183,
+1,199,1,211,1,228,1,240,2,0,2,12,2,28,2,40,2,56,2,68,2,84,2,130,2,142,2,154,
+2,221,2,233,2,245,3,80,3,92,3,104,3,116,3,132,3,148,3,160,3,177,3,189,3,205,
+3,217,3,233,3,245,4,5,4,17,4,33,4,45,4,61,4,77,4,89,4,106,4,118,4,134,4,146,
+4,162,4,174,4,190,4,202,4,218,5,40,5,52,5,64,5,76,5,92,5,108,5,120,5,137,
+5,149,5,165,5,177,5,193,5,205,5,221,5,233,5,249,6,5,6,21,6,37,6,49,6,66,6,
+78,6,94,6,106,6,122,6,134,6,150,6,162,6,178,6,237,6,249,7,5,7,95,7,107,7,
+119,7,131,7,147,7,163,7,175,7,192,7,204,7,220,7,232,7,248,8,4,8,20,8,32,8,
+48,8,60,8,76,8,92,8,104,8,121,8,133,8,149,8,161,8,177,8,189,8,205,8,217,8,
+233,9,33,9,45,9,57,9,69,9,85,9,101,9,113,9,130,9,142,9,158,9,170,9,186,9,
+198,9,214,9,226,9,242,10,58,10,70,10,82,10,94,10,110,10,126,10,138,10,155,
+10,167,10,183,10,195,10,211,10,223,10,239,10,251,11,11,11,23,11,35,11,47,
+11,59,11,71,11,83,11,95,11,136,11,148,11,160,11,226,11,238,11,250,12,6,12,
+22,12,38,12,50,12,67,12,79,12,95,12,107,12,123,12,135,12,151,12,163,12,179,
+12,191,12,207,12,223,12,235,12,252,13,8,13,24,13,36,13,52,13,64,13,80,13,
+92,13,108,13,172,13,184,13,196,13,208,13,224,13,240,13,252,14,13,14,25,14,
+41,14,53,14,69,14,81,14,97,14,109,14,125,14,137,14,149,14,161,14,173,14,185,
+14,197,14,209,14,221,14,233,14,245,15,1,15,13,15,25,15,37,15,49,15,61,15,
+73,15,85,15,97,15,109,15,167,15,179,15,191,15,203,16,39,16,151,17,1,17,125,
+17,238,18,90,18,111,18,205,19,61,19,170,20,41,20,142,21,5,21,127,22,11,22,
+23,22,39,22,55,22,67,22,84,22,96,22,112,22,124,22,140,22,152,22,168,22,180,
+22,196,23,25,23,37,23,49,23,154,23,166,23,178,24,49,24,61,24,73,24,85,24,
+101,24,117,24,129,24,146,24,158,24,174,24,186,24,202,24,214,24,230,24,242,
+25,2,25,14,25,30,25,46,25,58,25,75,25,87,25,103,25,115,25,131,25,143,25,159,
+25,171,25,187,26,42,26,54,26,66,26,78,26,94,26,110,26,122,26,139,26,151,26,
+167,26,179,26,195,26,207,26,223,26,235,26,251,27,7,27,23,27,39,27,51,27,68,
+27,80,27,96,27,108,27,124,27,136,27,152,27,164,27,180,27,255,28,11,28,23,
+28,129,28,141,28,153,28,165,28,181,28,197,28,209,28,226,28,238,28,254,29,
+10,29,26,29,38,29,54,29,66,29,82,29,94,29,110,29,126,29,138,29,155,29,167,
+29,183,29,195,29,211,29,223,29,239,29,251,30,11,30,71,30,83,30,95,30,107,
+30,222,31,100,31,228,32,118,32,254,33,14,33,163,34,22,34,156,35,34,35,186,
+36,53,36,194,37,82,37,244,38,68,38,80,38,92,38,195,38,207,38,219,38,231,38,
+247,39,7,39,19,39,36,39,48,39,64,39,76,39,92,39,104,39,120,39,132,39,148,
+39,160,39,176,39,192,39,204,39,221,39,233,39,249,40,5,40,21,40,33,40,49,40,
+61,40,77,40,167,40,179,40,191,40,203,40,219,40,235,40,247,41,8,41,20,41,36,
+41,48,41,64,41,76,41,92,41,104,41,120,41,132,41,148,41,164,41,176,41,193,
+41,205,41,221,41,233,41,249,42,5,42,21,42,33,42,49,42,127,42,139,42,151,42,
+255,43,11,43,23,43,35,43,51,43,67,43,79,43,96,43,108,43,124,43,136,43,152,
+43,164,43,180,43,192,43,208,43,220,43,236,43,252,44,8,44,25,44,37,44,53,44,
+65,44,81,44,93,44,109,44,121,44,137,44,202,44,214,44,226,44,238,45,93,45,
+223,46,91,46,233,47,109,47,236,48,125,48,237,49,111,49,127,49,147,50,11,50,
+149,51,33,51,191,52,12,52,24,52,36,52,137,52,149,52,161,52,173,52,189,52,
+205,52,217,52,234,52,246,53,6,53,18,53,34,53,46,53,62,53,74,53,90,53,102,
+53,118,53,134,53,146,53,163,53,175,53,191,53,203,53,219,53,231,53,247,54,
+3,54,19,54,114,54,126,54,138,54,150,54,166,54,182,54,194,54,211,54,223,54,
+239,54,251,55,11,55,23,55,39,55,51,55,67,55,79,55,95,55,111,55,123,55,140,
+55,152,55,168,55,180,55,196,55,208,55,224,55,236,55,252,56,29,56,41,56,53,
+56,111,56,123,56,135,56,147,56,163,56,179,56,191,56,208,56,220,56,236,56,
+248,57,8,57,20,57,36,57,48,57,64,57,76,57,92,57,108,57,120,57,137,57,149,
+57,165,57,177,57,193,57,205,57,221,57,233,57,249,58,62,58,74,58,86,58,179,
+58,191,58,203,58,215,58,231,58,247,59,3,59,20,59,32,59,48,59,60,59,76,59,
+88,59,104,59,116,59,132,59,144,59,160,59,176,59,188,59,205,59,217,59,233,
+59,245,60,5,60,17,60,33,60,45,60,61,60,117,60,129,60,141,60,153,61,5,61,132,
+61,253,62,136,63,9,63,133,64,20,64,129,65,0,65,125,66,12,66,129,67,8,67,146,
+68,46,68,120,68,132,68,144,68,241,68,253,69,9,69,21,69,37,69,53,69,65,69,
+82,69,94,69,110,69,122,69,138,69,150,69,166,69,178,69,194,69,206,69,222,69,
+238,69,250,70,11,70,23,70,39,70,51,70,67,70,79,70,95,70,107,70,123,70,206,
+70,218,70,230,70,242,71,2,71,18,71,30,71,47,71,59,71,75,71,87,71,103,71,115,
+71,131,71,143,71,159,71,171,71,187,71,203,71,215,71,232,71,244,72,4,72,16,
+72,32,72,44,72,60,72,72,72,88,72,154,72,166,72,178,73,5,73,17,73,29,73,41,
+73,57,73,73,73,85,73,102,73,114,73,130,73,142,73,158,73,170,73,186,73,198,
+73,214,74,52,74,64,74,76,74,88,74,104,74,120,74,132,74,149,74,161,74,177,
+74,189,74,205,74,217,74,233,74,245,75,5,75,17,75,33,75,49,75,61,75,78,75,
+90,75,106,75,118,75,134,75,146,75,162,75,174,75,190,75,235,75,247,76,3,76,
+73,76,85,76,97,76,109,76,125,76,141,76,153,76,170,76,182,76,198,76,210,76,
+226,76,238,76,254,77,10,77,26,77,38,77,54,77,70,77,82,77,99,77,111,77,127,
+77,139,77,155,77,167,77,183,77,195,77,211,78,12,78,24,78,36,78,124,78,136,
+78,148,78,160,78,176,78,192,78,204,78,221,78,233,78,249,79,5,79,21,79,33,
+79,49,79,61,79,77,79,89,79,105,79,121,79,133,79,150,79,162,79,178,79,190,
+79,206,79,218,79,234,79,246,80,6,80,78,80,90,80,102,80,188,80,200,80,212,
+81,66,81,78,81,90,81,102,81,118,81,134,81,146,81,163,81,175,81,191,81,203,
+81,219,81,231,81,247,82,3,82,19,82,31,82,47,82,63,82,75,82,92,82,104,82,120,
+82,132,82,148,82,160,82,176,82,188,82,204,83,45,83,57,83,69,83,81,83,97,83,
+113,83,125,83,142,83,154,83,170,83,182,83,198,83,210,83,226,83,238,83,254,
+84,10,84,26,84,42,84,54,84,71,84,83,84,99,84,111,84,127,84,139,84,155,84,
+167,84,183,84,255,85,11,85,23,85,120,85,132,85,144,85,156,85,172,85,188,85,
+200,85,217,85,229,85,245,86,1,86,17,86,29,86,45,86,57,86,73,86,85,86,101,
+86,117,86,129,86,146,86,158,86,174,86,186,86,202,86,214,86,230,86,242,87,
+2,87,56,87,68,87,80,87,92,87,108,87,124,87,136,87,153,87,165,87,181,87,193,
+87,209,87,221,87,237,87,249,88,9,88,44,88,56,88,68,88,116,88,128,88,140,88,
+212,88,224,88,236,88,248,89,8,89,24,89,36,89,53,89,65,89,81,89,93,89,109,
+89,121,89,137,89,149,89,165,89,177,89,193,89,209,89,221,89,238,89,250,90,
+10,90,22,90,38,90,50,90,66,90,78,90,94,90,151,90,163,90,175,90,187,90,203,
+90,219,90,231,90,248,91,4,91,20,91,32,91,48,91,60,91,76,91,88,91,104,91,116,
+91,132,91,148,91,160,91,177,91,189,91,205,91,217,91,233,91,245,92,5,92,17,
+92,33,92,80,92,92,92,104,92,116,92,132,92,148,92,160,92,177,92,189,92,205,
+92,217,92,233,92,245,93,5,93,17,93,33,93,98,93,110,93,122,93,207,93,219,93,
+231,94,84,94,96,94,108,94,120,94,136,94,152,94,164,94,181,94,193,94,209,94,
+221,94,237,94,249,95,9,95,21,95,37,95,49,95,65,95,81,95,93,95,110,95,122,
+95,138,95,150,95,166,95,178,95,194,95,206,95,222,96,64,96,76,96,88,96,100,
+96,116,96,132,96,144,96,161,96,173,96,189,96,201,96,217,96,229,96,245,97,
+1,97,17,97,29,97,45,97,61,97,73,97,90,97,102,97,118,97,130,97,146,97,158,
+97,174,97,186,97,202,98,27,98,39,98,51,98,165,98,177,98,189,98,201,98,217,
+98,233,98,245,99,6,99,18,99,34,99,46,99,62,99,74,99,90,99,102,99,118,99,130,
+99,146,99,162,99,174,99,191,99,203,99,219,99,231,99,247,100,3,100,19,100,
+31,100,47,100,113,100,125,100,137,100,227,100,239,100,251,101,7,101,23,101,
+39,101,51,101,68,101,80,101,96,101,108,101,124,101,136,101,152,101,164,101,
+180,101,192,101,208,101,224,101,236,101,253,102,9,102,25,102,37,102,53,102,
+65,102,81,102,93,102,109,102,145,102,157,102,169,102,181,102,197,102,213,
+102,229,102,249,103,13,103,29,103,50,103,66,103,86,103,170,104,16,104,32,
+104,52,104,68,104,88,104,146,104,158,104,170,104,182,104,198,104,214,104,
+226,104,243,104,255,105,15,105,27,105,43,105,55,105,71,105,83,105,99,105,
+111,105,127,105,143,105,155,105,172,105,184,105,200,105,212,105,228,105,240,
+106,0,106,12,106,28,106,107,106,119,106,131,106,143,106,159,106,175,106,187,
+106,204,106,216,106,232,106,244,107,4,107,16,107,32,107,44,107,60,107,134,
+107,146,107,158,107,255,108,11,108,23,108,35,108,51,108,67,108,79,108,96,
+108,108,108,124,108,136,108,152,108,164,108,180,108,192,108,208,108,220,108,
+236,108,252,109,8,109,25,109,37,109,53,109,65,109,81,109,93,109,109,109,121,
+109,137,109,191,109,203,109,215,110,32,110,44,110,56,110,68,110,84,110,100,
+110,112,110,129,110,141,110,157,110,169,110,185,110,197,110,213,110,225,110,
+241,110,253,111,13,111,29,111,41,111,58,111,70,111,86,111,98,111,114,111,
+126,111,142,111,154,111,170,111,233,111,245,112,1,112,86,112,98,112,110,112,
+122,112,138,112,154,112,166,112,183,112,195,112,211,112,223,112,239,112,251,
+113,11,113,23,113,39,113,51,113,67,113,83,113,95,113,112,113,124,113,140,
+113,152,113,168,113,180,113,196,113,208,113,224,114,28,114,40,114,52,114,
+64,114,80,114,96,114,108,114,125,114,137,114,153,114,165,114,181,114,193,
+114,209,114,221,114,237,115,73,115,85,115,97,115,109,115,125,115,141,115,
+153,115,170,115,182,115,198,115,210,115,226,115,238,115,254,116,10,116,26,
+116,69,116,81,116,93,116,105,116,121,116,137,116,149,116,166,116,178,116,
+194,116,206,116,222,116,234,116,250,117,6,117,22,117,78,117,90,117,102,117,
+114,117,130,117,146,117,158,117,175,117,187,117,203,117,215,117,231,117,243,
+118,3,118,15,118,31,118,83,118,95,118,107,118,189,118,201,118,213,118,225,
+118,241,119,1,119,13,119,30,119,42,119,58,119,70,119,86,119,98,119,114,119,
+126,119,142,119,154,119,170,119,186,119,198,119,215,119,227,119,243,119,255,
+120,15,120,27,120,43,120,55,120,71,120,84,120,96,120,108,120,120,120,132,
+120,144,120,156,120,168,120,180,120,192,121,45,121,57,121,69,121,81,121,97,
+121,113,121,125,121,142,121,154,121,170,121,182,121,198,121,210,121,226,121,
+238,121,254,122,48,122,60,122,72,122,84,122,100,122,116,122,128,122,145,122,
+157,122,173,122,185,122,201,122,213,122,229,122,241,123,1,123,25,123,68,123,
+92,123,128,123,165,123,205,123,231,124,15,124,48,124,102,124,145,124,181,
+124,223,125,26,125,73,125,138,125,175,125,230,126,18,126,62,126,97,126,140,
+126,173,126,185,126,198,127,19,127,35,127,120,127,145,127,195,127,233,128,
+14,128,52,128,90,128,103,128,125,128,149,128,176,0,2,0,193,0,0,4,10,5,182,
+0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,
+182,250,74,104,4,230,0,0,3,0,113,255,229,4,141,4,190,0,23,0,31,0,40,0,0,36,
+4,35,34,38,53,52,54,55,3,6,7,39,54,51,50,22,21,20,6,7,1,55,23,0,54,53,52,
+35,34,7,19,14,2,21,20,51,50,55,1,3,225,254,213,151,201,217,192,164,215,71,
+9,73,243,242,195,194,115,147,1,4,92,88,254,97,73,221,102,86,223,168,117,63,
+254,153,152,254,237,80,107,177,155,156,164,57,1,29,41,6,143,151,159,137,97,
+139,64,254,173,61,139,2,69,76,55,144,27,254,219,211,59,86,66,184,72,1,104,
+255,255,0,113,255,229,5,254,4,190,16,34,5,153,0,0,16,3,0,4,1,113,0,0,255,
+255,0,113,255,158,7,161,4,219,16,34,5,154,0,0,16,3,0,4,3,20,0,0,0,3,0,113,
+255,229,5,184,4,190,0,38,0,46,0,55,0,0,0,39,6,7,1,55,23,6,4,35,34,38,53,52,
+54,55,3,6,7,39,54,51,50,22,23,22,19,23,54,53,52,39,55,22,21,20,6,7,39,0,54,
+53,52,35,34,7,19,14,2,21,20,51,50,55,1,4,25,84,50,198,1,4,65,88,163,254,231,
+143,201,217,188,160,213,37,37,73,243,246,117,158,61,174,94,6,88,49,168,45,
+96,111,157,254,157,78,221,98,98,223,164,115,61,254,143,154,254,237,2,129,
+164,107,82,254,170,41,139,106,97,177,155,154,164,57,1,27,19,24,143,151,59,
+61,174,254,143,2,164,166,127,131,57,135,137,150,250,149,51,1,100,78,55,144,
+29,254,217,209,59,84,66,184,68,1,104,0,255,255,0,113,255,229,7,41,4,190,16,
+34,5,153,0,0,16,3,0,7,1,113,0,0,255,255,0,113,255,158,8,204,4,219,16,34,5,
+154,0,0,16,3,0,7,3,20,0,0,255,255,0,113,255,156,8,192,4,190,16,34,0,7,0,0,
+16,3,5,157,6,20,0,0,255,255,0,113,255,156,10,49,4,190,16,34,5,153,0,0,16,
+35,0,7,1,113,0,0,16,3,5,157,7,133,0,0,255,255,0,113,254,33,7,41,4,190,16,
+34,5,153,0,0,16,35,0,7,1,113,0,0,16,3,5,190,3,225,0,0,255,255,255,254,254,
+152,8,139,6,53,16,34,5,158,0,0,16,3,0,7,2,211,0,0,255,255,0,113,254,152,9,
+86,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,7,3,158,0,0,255,
+255,0,143,255,158,7,186,4,219,16,34,5,159,0,0,16,3,0,7,2,2,0,0,255,255,0,
+113,255,158,9,43,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,7,3,115,
+0,0,255,255,0,113,255,158,7,82,6,111,16,34,5,160,0,0,16,3,0,7,1,154,0,0,255,
+255,0,113,255,158,8,194,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,
+0,7,3,10,0,0,255,255,0,113,254,152,7,152,4,221,16,34,0,7,0,0,16,3,5,161,5,
+246,0,0,255,255,0,113,254,152,9,8,4,221,16,34,5,153,0,0,16,35,0,7,1,113,0,
+0,16,3,5,161,7,102,0,0,255,255,0,113,254,152,8,110,4,197,16,34,0,7,0,0,16,
+3,5,162,6,20,0,0,255,255,0,113,254,152,9,223,4,197,16,34,5,153,0,0,16,35,
+0,7,1,113,0,0,16,3,5,162,7,133,0,0,255,255,0,113,255,156,7,139,4,190,16,34,
+0,4,0,0,16,3,5,157,4,223,0,0,255,255,0,113,255,156,8,252,4,190,16,34,5,153,
+0,0,16,35,0,4,1,113,0,0,16,3,5,157,6,80,0,0,255,255,0,113,254,33,5,254,4,
+190,16,34,5,153,0,0,16,35,0,4,1,113,0,0,16,3,5,190,3,225,0,0,255,255,255,
+254,254,152,7,96,6,53,16,34,5,158,0,0,16,3,0,4,2,211,0,0,255,255,0,113,254,
+152,8,43,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,4,3,158,
+0,0,255,255,0,143,255,158,6,143,4,219,16,34,5,159,0,0,16,3,0,4,2,2,0,0,255,
+255,0,113,255,158,8,0,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,
+4,3,115,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,0,4,1,
+154,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,
+0,0,16,3,0,4,3,10,0,0,255,255,0,113,254,152,6,47,4,221,16,34,0,4,0,0,16,3,
+5,161,4,141,0,0,255,255,0,113,254,152,7,160,4,221,16,34,5,153,0,0,16,35,0,
+4,1,113,0,0,16,3,5,161,5,254,0,0,255,255,0,113,254,152,7,57,4,197,16,34,0,
+4,0,0,16,3,5,162,4,223,0,0,255,255,0,113,254,152,8,170,4,197,16,34,5,153,
+0,0,16,35,0,4,1,113,0,0,16,3,5,162,6,80,0,0,0,2,0,143,255,229,4,172,4,199,
+0,13,0,26,0,0,0,18,21,20,6,6,35,34,38,38,53,52,18,37,2,6,21,20,22,51,50,54,
+54,53,52,38,39,3,182,246,129,238,159,160,240,127,244,1,27,191,162,189,164,
+108,158,84,160,190,4,51,254,166,233,144,239,140,140,239,144,233,1,92,146,
+254,200,249,166,154,201,95,161,99,168,249,115,0,255,255,0,113,255,229,6,29,
+4,199,16,34,5,153,0,0,16,3,0,36,1,113,0,0,255,255,0,113,255,158,7,192,4,219,
+16,34,5,154,0,0,16,3,0,36,3,20,0,0,0,2,0,143,255,150,6,2,4,199,0,29,0,42,
+0,0,36,53,52,38,35,34,7,22,21,20,6,6,35,34,38,38,53,52,18,37,4,23,54,51,50,
+22,21,16,3,39,36,54,54,53,52,38,39,6,6,21,20,22,51,5,94,67,74,31,28,22,129,
+238,159,160,240,127,244,1,27,1,71,117,70,49,145,160,170,121,254,43,158,84,
+160,190,191,162,189,164,201,237,135,125,6,96,100,144,239,140,140,239,144,
+233,1,92,146,172,211,18,213,203,254,244,254,232,65,182,95,161,99,168,249,
+115,117,249,166,154,201,0,255,255,0,113,255,150,7,115,4,199,16,34,5,153,0,
+0,16,3,0,39,1,113,0,0,255,255,0,113,255,150,9,22,4,219,16,34,5,154,0,0,16,
+3,0,39,3,20,0,0,0,2,0,143,255,221,7,172,4,199,0,45,0,58,0,0,0,21,20,6,7,39,
+38,2,39,7,22,21,20,3,39,54,53,52,35,34,7,22,21,20,6,6,35,34,38,38,53,52,18,
+37,4,23,54,51,32,19,23,54,53,52,39,55,0,54,54,53,52,38,39,6,6,21,20,22,51,
+7,172,96,111,158,38,91,65,4,55,65,142,43,82,20,21,27,129,238,159,160,240,
+127,244,1,27,1,67,117,100,109,1,59,72,6,88,49,168,251,139,158,84,160,190,
+191,162,189,164,3,39,137,150,250,149,51,244,1,2,49,6,88,168,232,254,248,31,
+250,254,219,12,95,116,144,239,140,140,239,144,233,1,92,146,168,209,45,253,
+176,2,164,166,127,131,57,252,223,95,161,99,168,249,115,117,249,166,154,201,
+0,255,255,0,113,255,221,9,29,4,199,16,34,5,153,0,0,16,3,0,42,1,113,0,0,255,
+255,0,113,255,158,10,192,4,219,16,34,5,154,0,0,16,3,0,42,3,20,0,0,255,255,
+0,143,255,156,10,180,4,199,16,34,0,42,0,0,16,3,5,157,8,8,0,0,255,255,0,113,
+255,156,12,37,4,199,16,34,5,153,0,0,16,35,0,42,1,113,0,0,16,3,5,157,9,121,
+0,0,255,255,0,113,254,33,9,29,4,199,16,34,5,153,0,0,16,35,0,42,1,113,0,0,
+16,3,5,190,4,14,0,0,255,255,255,254,254,152,10,86,6,53,16,34,5,158,0,0,16,
+3,0,42,2,170,0,0,255,255,0,113,254,152,11,74,6,53,16,35,5,158,0,203,0,0,16,
+35,5,153,0,0,255,68,16,3,0,42,3,158,0,0,255,255,0,143,255,158,9,82,4,219,
+16,34,5,159,0,0,16,3,0,42,1,166,0,0,255,255,0,113,255,158,10,195,4,219,16,
+34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,42,3,23,0,0,255,255,0,113,255,158,
+9,70,6,111,16,34,5,160,0,0,16,3,0,42,1,154,0,0,255,255,0,113,255,158,10,182,
+6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,0,42,3,10,0,0,255,255,0,
+143,254,152,9,96,4,221,16,34,0,42,0,0,16,3,5,161,7,190,0,0,255,255,0,113,
+254,152,10,209,4,221,16,34,5,153,0,0,16,35,0,42,1,113,0,0,16,3,5,161,9,47,
+0,0,255,255,0,143,254,152,10,98,4,199,16,34,0,42,0,0,16,3,5,162,8,8,0,0,255,
+255,0,113,254,152,11,211,4,199,16,34,5,153,0,0,16,35,0,42,1,113,0,0,16,3,
+5,162,9,121,0,0,255,255,0,143,255,150,9,16,4,199,16,34,0,39,0,0,16,3,5,157,
+6,100,0,0,255,255,0,113,255,150,10,129,4,199,16,34,5,153,0,0,16,35,0,39,1,
+113,0,0,16,3,5,157,7,213,0,0,255,255,0,113,254,33,7,115,4,199,16,34,5,153,
+0,0,16,35,0,39,1,113,0,0,16,3,5,190,4,14,0,0,255,255,255,254,254,152,8,172,
+6,53,16,34,5,158,0,0,16,3,0,39,2,170,0,0,255,255,0,113,254,152,9,160,6,53,
+16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,39,3,158,0,0,255,255,
+0,143,255,150,7,168,4,219,16,34,5,159,0,0,16,3,0,39,1,166,0,0,255,255,0,113,
+255,150,9,25,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,39,3,23,0,
+0,255,255,0,113,255,150,7,156,6,111,16,34,5,160,0,0,16,3,0,39,1,154,0,0,255,
+255,0,113,255,150,9,12,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,0,
+39,3,10,0,0,255,255,0,143,254,152,8,6,4,221,16,34,0,39,0,0,16,3,5,161,6,100,
+0,0,255,255,0,113,254,152,9,119,4,221,16,34,5,153,0,0,16,35,0,39,1,113,0,
+0,16,3,5,161,7,213,0,0,255,255,0,143,254,152,8,190,4,199,16,34,0,39,0,0,16,
+3,5,162,6,100,0,0,255,255,0,113,254,152,10,47,4,199,16,34,5,153,0,0,16,35,
+0,39,1,113,0,0,16,3,5,162,7,213,0,0,0,2,0,143,255,229,6,231,4,199,0,35,0,
+48,0,0,0,21,20,6,7,39,2,2,35,35,22,21,20,6,6,35,34,38,38,53,52,18,37,4,23,
+54,51,50,18,19,23,54,53,52,39,55,0,54,54,53,52,38,39,6,6,21,20,22,51,6,231,
+96,110,175,45,110,62,8,35,129,238,159,160,240,127,244,1,27,1,41,120,39,43,
+129,160,51,7,88,50,168,252,80,158,84,160,190,191,162,189,164,3,37,137,150,
+250,149,57,1,14,1,31,115,122,144,239,140,140,239,144,233,1,92,146,154,188,
+12,254,233,254,195,2,164,166,127,131,57,252,225,95,161,99,168,249,115,117,
+249,166,154,201,0,255,255,0,113,255,229,8,88,4,199,16,34,5,153,0,0,16,3,0,
+71,1,113,0,0,255,255,0,113,255,158,9,251,4,219,16,34,5,154,0,0,16,3,0,71,
+3,20,0,0,255,255,0,143,255,156,9,240,4,199,16,34,0,71,0,0,16,3,5,157,7,68,
+0,0,255,255,0,113,255,156,11,96,4,199,16,34,5,153,0,0,16,35,0,71,1,113,0,
+0,16,3,5,157,8,180,0,0,255,255,0,113,254,33,8,88,4,199,16,34,5,153,0,0,16,
+35,0,71,1,113,0,0,16,3,5,190,4,14,0,0,255,255,255,254,254,152,9,145,6,53,
+16,34,5,158,0,0,16,3,0,71,2,170,0,0,255,255,0,113,254,152,10,133,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,71,3,158,0,0,255,255,0,143,
+255,158,8,141,4,219,16,34,5,159,0,0,16,3,0,71,1,166,0,0,255,255,0,113,255,
+158,9,254,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,71,3,23,0,0,
+255,255,0,113,255,158,8,129,6,111,16,34,5,160,0,0,16,3,0,71,1,154,0,0,255,
+255,0,113,255,158,9,241,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,
+0,71,3,10,0,0,255,255,0,143,254,152,8,156,4,221,16,34,0,71,0,0,16,3,5,161,
+6,250,0,0,255,255,0,113,254,152,10,12,4,221,16,34,5,153,0,0,16,35,0,71,1,
+113,0,0,16,3,5,161,8,106,0,0,255,255,0,143,254,152,9,158,4,199,16,34,0,71,
+0,0,16,3,5,162,7,68,0,0,255,255,0,113,254,152,11,14,4,199,16,34,5,153,0,0,
+16,35,0,71,1,113,0,0,16,3,5,162,8,180,0,0,255,255,0,143,255,156,7,231,4,199,
+16,34,0,36,0,0,16,3,5,157,5,59,0,0,255,255,0,113,255,156,9,88,4,199,16,34,
+5,153,0,0,16,35,0,36,1,113,0,0,16,3,5,157,6,172,0,0,255,255,0,113,254,33,
+6,29,4,199,16,34,5,153,0,0,16,35,0,36,1,113,0,0,16,3,5,190,4,14,0,0,255,255,
+255,254,254,152,7,86,6,53,16,34,5,158,0,0,16,3,0,36,2,170,0,0,255,255,0,113,
+254,152,8,74,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,36,
+3,158,0,0,255,255,0,143,255,158,6,82,4,219,16,34,5,159,0,0,16,3,0,36,1,166,
+0,0,255,255,0,113,255,158,7,195,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,
+0,16,3,0,36,3,23,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,
+3,0,36,1,154,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,
+160,1,113,0,0,16,3,0,36,3,10,0,0,255,255,0,143,254,152,6,109,4,221,16,34,
+0,36,0,0,16,3,5,161,4,203,0,0,255,255,0,113,254,152,7,221,4,221,16,34,5,153,
+0,0,16,35,0,36,1,113,0,0,16,3,5,161,6,59,0,0,255,255,0,143,254,152,7,108,
+4,199,16,34,0,36,0,0,16,3,5,162,5,18,0,0,255,255,0,113,254,152,8,221,4,199,
+16,34,5,153,0,0,16,35,0,36,1,113,0,0,16,3,5,162,6,131,0,0,0,1,0,143,255,211,
+6,231,4,199,0,33,0,0,36,0,53,52,18,51,32,19,51,18,33,50,18,21,16,5,39,54,
+18,53,16,33,34,6,19,35,18,33,32,17,20,18,23,7,1,143,255,0,240,203,1,20,90,
+9,90,1,18,203,239,254,5,74,211,196,254,230,129,142,2,172,2,254,240,254,231,
+197,209,70,70,1,123,251,248,1,19,254,247,1,9,254,237,248,253,254,231,158,
+96,1,24,207,1,105,238,254,234,2,4,254,151,207,254,232,96,158,255,255,0,113,
+255,211,8,88,4,199,16,34,5,153,0,0,16,3,0,100,1,113,0,0,255,255,0,113,255,
+158,9,251,4,219,16,34,5,154,0,0,16,3,0,100,3,20,0,0,0,1,0,143,255,211,9,66,
+4,199,0,54,0,0,0,21,20,6,7,39,2,2,35,35,21,16,5,39,54,18,53,16,33,34,6,19,
+35,18,33,32,17,20,18,23,7,36,0,53,52,18,51,32,19,51,18,33,50,22,23,55,50,
+18,19,23,54,53,52,39,55,9,66,97,110,174,45,111,61,5,254,5,74,211,196,254,
+230,129,142,2,172,2,254,240,254,231,197,209,70,255,0,255,0,240,203,1,20,90,
+9,90,1,18,158,221,41,27,129,159,51,7,88,49,167,3,37,137,150,250,149,57,1,
+14,1,31,33,253,254,231,158,96,1,24,207,1,105,238,254,234,2,4,254,151,207,
+254,232,96,158,115,1,123,251,248,1,19,254,247,1,9,172,160,2,254,233,254,195,
+2,164,166,127,131,57,0,255,255,0,113,255,211,10,179,4,199,16,34,5,153,0,0,
+16,3,0,103,1,113,0,0,255,255,0,113,255,158,12,86,4,219,16,34,5,154,0,0,16,
+3,0,103,3,20,0,0,255,255,0,143,255,156,12,74,4,199,16,34,0,103,0,0,16,3,5,
+157,9,158,0,0,255,255,0,113,255,156,13,186,4,199,16,34,5,153,0,0,16,35,0,
+103,1,113,0,0,16,3,5,157,11,14,0,0,255,255,0,113,254,33,10,179,4,199,16,34,
+5,153,0,0,16,35,0,103,1,113,0,0,16,3,5,190,5,45,0,0,255,255,255,254,254,152,
+11,236,6,53,16,34,5,158,0,0,16,3,0,103,2,170,0,0,255,255,0,113,254,152,12,
+224,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,103,3,158,0,
+0,255,255,0,143,255,158,10,232,4,219,16,34,5,159,0,0,16,3,0,103,1,166,0,0,
+255,255,0,113,255,158,12,89,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,
+3,0,103,3,23,0,0,255,255,0,113,255,158,10,220,6,143,16,34,5,163,0,0,16,3,
+0,103,1,154,0,0,255,255,0,113,255,158,12,76,6,143,16,34,5,153,0,0,16,35,5,
+163,1,113,0,0,16,3,0,103,3,10,0,0,255,255,0,143,254,152,10,246,4,221,16,34,
+0,103,0,0,16,3,5,161,9,84,0,0,255,255,0,113,254,152,12,103,4,221,16,34,5,
+153,0,0,16,35,0,103,1,113,0,0,16,3,5,161,10,197,0,0,255,255,0,143,254,152,
+11,248,4,199,16,34,0,103,0,0,16,3,5,162,9,158,0,0,255,255,0,113,254,152,13,
+104,4,199,16,34,5,153,0,0,16,35,0,103,1,113,0,0,16,3,5,162,11,14,0,0,255,
+255,0,143,255,156,10,35,4,199,16,34,0,100,0,0,16,3,5,157,7,119,0,0,255,255,
+0,113,255,156,11,147,4,199,16,34,5,153,0,0,16,35,0,100,1,113,0,0,16,3,5,157,
+8,231,0,0,255,255,0,113,254,33,8,88,4,199,16,34,5,153,0,0,16,35,0,100,1,113,
+0,0,16,3,5,190,5,45,0,0,255,255,255,254,254,152,9,145,6,53,16,34,5,158,0,
+0,16,3,0,100,2,170,0,0,255,255,0,113,254,152,10,133,6,53,16,35,5,158,0,203,
+0,0,16,35,5,153,0,0,255,68,16,3,0,100,3,158,0,0,255,255,0,143,255,158,8,141,
+4,219,16,34,5,159,0,0,16,3,0,100,1,166,0,0,255,255,0,113,255,158,9,254,4,
+219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,100,3,23,0,0,255,255,0,113,
+255,158,8,195,6,143,16,34,5,163,0,0,16,3,0,100,1,154,0,0,255,255,0,113,255,
+158,10,52,6,143,16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,0,100,3,10,0,0,
+255,255,0,143,254,152,8,168,4,221,16,34,0,100,0,0,16,3,5,161,7,6,0,0,255,
+255,0,113,254,152,10,25,4,221,16,34,5,153,0,0,16,35,0,100,1,113,0,0,16,3,
+5,161,8,119,0,0,255,255,0,143,254,152,9,168,4,199,16,34,0,100,0,0,16,3,5,
+162,7,78,0,0,255,255,0,113,254,152,11,24,4,199,16,34,5,153,0,0,16,35,0,100,
+1,113,0,0,16,3,5,162,8,190,0,0,0,2,0,47,255,227,4,219,4,207,0,18,0,34,0,0,
+0,54,54,51,50,22,18,21,20,2,6,35,34,38,38,39,35,53,51,0,54,54,53,52,38,38,
+35,34,6,6,21,20,22,22,51,1,55,133,205,119,129,219,127,127,219,129,119,205,
+133,14,250,250,2,37,141,84,84,141,78,78,141,84,84,141,78,3,70,249,144,170,
+254,223,170,170,254,223,172,146,252,151,166,253,221,127,215,121,121,215,127,
+127,215,121,121,215,127,0,255,255,0,113,255,227,6,76,4,207,16,34,5,153,0,
+0,16,3,0,132,1,113,0,0,255,255,0,113,255,158,7,239,4,219,16,34,5,154,0,0,
+16,3,0,132,3,20,0,0,255,255,0,47,255,156,8,22,4,207,16,34,0,132,0,0,16,3,
+5,157,5,106,0,0,255,255,0,113,255,156,9,135,4,207,16,34,5,153,0,0,16,35,0,
+132,1,113,0,0,16,3,5,157,6,219,0,0,255,255,0,113,254,33,6,76,4,207,16,34,
+5,153,0,0,16,35,0,132,1,113,0,0,16,3,5,190,4,39,0,0,255,255,255,254,254,152,
+7,174,6,53,16,34,5,158,0,0,16,3,0,132,2,211,0,0,255,255,0,113,254,152,8,121,
+6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,132,3,158,0,0,255,
+255,0,143,255,158,6,139,4,219,16,34,5,159,0,0,16,3,0,132,1,176,0,0,255,255,
+0,113,255,158,7,252,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,132,
+3,33,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,0,132,1,154,
+0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,
+16,3,0,132,3,10,0,0,255,255,0,47,254,152,6,156,4,221,16,34,0,132,0,0,16,3,
+5,161,4,250,0,0,255,255,0,113,254,152,8,12,4,221,16,34,5,153,0,0,16,35,0,
+132,1,113,0,0,16,3,5,161,6,106,0,0,255,255,0,47,254,152,7,156,4,207,16,34,
+0,132,0,0,16,3,5,162,5,66,0,0,255,255,0,113,254,152,9,12,4,207,16,34,5,153,
+0,0,16,35,0,132,1,113,0,0,16,3,5,162,6,178,0,0,0,2,0,57,255,219,5,88,4,217,
+0,34,0,45,0,0,0,35,34,21,20,18,1,7,38,38,35,34,6,7,39,0,18,53,52,35,34,7,
+53,54,51,50,22,23,51,54,54,51,50,23,21,0,39,35,6,1,21,54,51,50,23,53,4,127,
+123,172,225,1,31,117,174,241,123,123,244,174,115,1,29,225,172,127,118,122,
+129,119,156,33,6,33,155,119,131,123,254,18,67,6,68,254,131,234,219,211,241,
+4,51,139,92,254,149,254,176,182,51,37,37,51,182,1,80,1,107,92,139,53,174,
+45,98,84,84,98,45,172,254,90,232,230,254,60,9,76,76,9,255,255,0,113,255,219,
+6,201,4,217,16,34,5,153,0,0,16,3,0,148,1,113,0,0,255,255,0,113,255,158,8,
+108,4,219,16,34,5,154,0,0,16,3,0,148,3,20,0,0,255,255,0,57,255,156,8,59,4,
+217,16,34,0,148,0,0,16,3,5,157,5,143,0,0,255,255,0,113,255,156,9,172,4,217,
+16,34,5,153,0,0,16,35,0,148,1,113,0,0,16,3,5,157,7,0,0,0,255,255,0,113,254,
+33,6,201,4,217,16,34,5,153,0,0,16,35,0,148,1,113,0,0,16,3,5,190,4,57,0,0,
+255,255,255,254,254,152,8,43,6,53,16,34,5,158,0,0,16,3,0,148,2,211,0,0,255,
+255,0,113,254,152,8,246,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,
+16,3,0,148,3,158,0,0,255,255,0,143,255,158,7,90,4,219,16,34,5,159,0,0,16,
+3,0,148,2,2,0,0,255,255,0,113,255,158,8,203,4,219,16,34,5,153,0,0,16,35,5,
+159,1,113,0,0,16,3,0,148,3,115,0,0,255,255,0,113,255,158,6,242,6,111,16,34,
+5,160,0,0,16,3,0,148,1,154,0,0,255,255,0,113,255,158,8,98,6,111,16,34,5,153,
+0,0,16,35,5,160,1,113,0,0,16,3,0,148,3,10,0,0,255,255,0,57,254,152,7,49,4,
+221,16,34,0,148,0,0,16,3,5,161,5,143,0,0,255,255,0,113,254,152,8,162,4,221,
+16,34,5,153,0,0,16,35,0,148,1,113,0,0,16,3,5,161,7,0,0,0,255,255,0,57,254,
+152,7,233,4,217,16,34,0,148,0,0,16,3,5,162,5,143,0,0,255,255,0,113,254,152,
+9,90,4,217,16,34,5,153,0,0,16,35,0,148,1,113,0,0,16,3,5,162,7,0,0,0,255,255,
+254,188,5,20,1,68,7,220,16,34,5,181,0,0,16,3,5,189,0,0,1,197,255,255,254,
+188,5,20,1,68,8,48,16,34,5,182,0,0,16,3,5,189,0,0,2,25,255,255,254,188,5,
+20,1,68,7,109,16,34,5,183,0,0,16,3,5,189,0,0,1,86,255,255,254,182,5,10,1,
+68,8,37,16,34,5,184,0,0,16,3,5,189,0,0,2,14,255,255,254,188,5,20,1,68,8,58,
+16,34,5,185,0,0,16,3,5,189,0,0,2,35,255,255,254,135,5,23,1,121,7,179,16,34,
+5,186,0,0,16,3,5,189,0,0,1,156,255,255,254,188,5,43,1,68,7,41,16,34,5,187,
+0,0,16,3,5,189,0,0,1,18,0,1,0,80,1,10,4,139,4,190,0,21,0,0,0,5,17,4,23,21,
+38,33,32,7,53,54,37,17,36,39,53,22,33,32,55,21,3,203,254,248,1,4,196,231,
+254,201,254,202,231,194,1,7,254,247,192,221,1,64,1,65,221,3,227,10,254,74,
+17,100,164,119,119,164,100,17,1,182,10,60,159,65,65,159,255,255,0,113,0,203,
+5,252,4,190,16,34,5,153,0,0,16,3,0,171,1,113,0,0,255,255,0,113,255,158,7,
+159,4,219,16,34,5,154,0,0,16,3,0,171,3,20,0,0,0,1,0,80,1,10,6,184,4,221,0,
+38,0,0,0,21,20,6,7,39,38,2,39,6,7,17,4,23,21,38,33,32,7,53,54,37,17,36,39,
+53,22,33,32,55,22,18,23,23,54,53,52,39,55,6,184,96,111,157,37,117,104,185,
+206,1,4,196,231,254,201,254,202,231,194,1,7,254,247,192,221,1,64,1,65,221,
+129,140,30,6,88,49,168,4,86,137,150,250,149,51,178,1,4,123,45,6,254,74,17,
+100,164,119,119,164,100,17,1,182,10,60,159,65,65,141,254,217,176,2,164,166,
+127,131,57,0,255,255,0,113,0,203,8,41,4,221,16,34,5,153,0,0,16,3,0,174,1,
+113,0,0,255,255,0,113,255,158,9,204,4,221,16,34,5,154,0,0,16,3,0,174,3,20,
+0,0,255,255,0,80,255,156,9,192,4,221,16,34,0,174,0,0,16,3,5,157,7,20,0,0,
+255,255,0,113,255,156,11,49,4,221,16,34,5,153,0,0,16,35,0,174,1,113,0,0,16,
+3,5,157,8,133,0,0,255,255,0,113,255,64,8,41,4,221,16,34,5,153,0,0,16,35,0,
+174,1,113,0,0,16,3,5,190,3,223,1,31,255,255,255,254,254,152,9,139,6,53,16,
+34,5,158,0,0,16,3,0,174,2,211,0,0,255,255,0,113,254,152,10,86,6,53,16,35,
+5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,174,3,158,0,0,255,255,0,143,
+255,158,8,186,4,221,16,34,5,159,0,0,16,3,0,174,2,2,0,0,255,255,0,113,255,
+158,10,43,4,221,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,174,3,115,0,
+0,255,255,0,113,255,158,8,133,6,111,16,34,5,160,0,0,16,3,0,174,1,205,0,0,
+255,255,0,113,255,158,9,245,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,
+3,0,174,3,61,0,0,255,255,0,80,254,152,8,152,4,221,16,34,0,174,0,0,16,3,5,
+161,6,246,0,0,255,255,0,113,254,152,10,8,4,221,16,34,5,153,0,0,16,35,0,174,
+1,113,0,0,16,3,5,161,8,102,0,0,255,255,0,80,254,152,9,110,4,221,16,34,0,174,
+0,0,16,3,5,162,7,20,0,0,255,255,0,113,254,152,10,223,4,221,16,34,5,153,0,
+0,16,35,0,174,1,113,0,0,16,3,5,162,8,133,0,0,255,255,0,80,255,156,7,135,4,
+190,16,34,0,171,0,0,16,3,5,157,4,219,0,0,255,255,0,113,255,156,8,248,4,190,
+16,34,5,153,0,0,16,35,0,171,1,113,0,0,16,3,5,157,6,76,0,0,255,255,0,113,255,
+64,5,252,4,190,16,34,5,153,0,0,16,35,0,171,1,113,0,0,16,3,5,190,3,223,1,31,
+255,255,255,254,254,152,7,94,6,53,16,34,5,158,0,0,16,3,0,171,2,211,0,0,255,
+255,0,113,254,152,8,41,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,
+16,3,0,171,3,158,0,0,255,255,0,143,255,158,6,141,4,219,16,34,5,159,0,0,16,
+3,0,171,2,2,0,0,255,255,0,113,255,158,7,254,4,219,16,34,5,153,0,0,16,35,5,
+159,1,113,0,0,16,3,0,171,3,115,0,0,255,255,0,113,255,158,6,143,6,111,16,34,
+5,160,0,0,16,3,0,171,1,205,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,
+0,0,16,35,5,160,1,113,0,0,16,3,0,171,3,61,0,0,255,255,0,80,254,152,6,125,
+4,221,16,34,0,171,0,0,16,3,5,161,4,219,0,0,255,255,0,113,254,152,7,238,4,
+221,16,34,5,153,0,0,16,35,0,171,1,113,0,0,16,3,5,161,6,76,0,0,255,255,0,80,
+254,152,7,53,4,197,16,34,0,171,0,0,16,3,5,162,4,219,0,0,255,255,0,113,254,
+152,8,166,4,197,16,34,5,153,0,0,16,35,0,171,1,113,0,0,16,3,5,162,6,76,0,0,
+0,1,0,96,0,0,4,180,4,233,0,41,0,0,0,7,54,55,18,17,16,7,35,54,18,53,52,39,
+6,35,6,21,20,23,21,38,35,34,7,53,54,51,50,23,38,53,52,55,38,39,53,22,23,54,
+55,51,2,162,23,201,213,139,153,197,92,84,86,153,197,19,168,165,158,184,140,
+127,197,53,41,113,15,193,127,156,211,16,45,197,4,166,49,8,65,254,222,254,
+192,254,156,248,145,1,29,174,207,203,39,82,94,221,211,158,45,45,160,49,8,
+190,199,86,96,20,54,159,59,12,41,73,255,255,0,113,0,0,6,37,4,233,16,34,5,
+153,0,0,16,3,0,203,1,113,0,0,255,255,0,113,255,158,7,200,4,233,16,34,5,154,
+0,0,16,3,0,203,3,20,0,0,255,255,0,96,255,156,7,250,4,233,16,34,0,203,0,0,
+16,3,5,157,5,78,0,0,255,255,0,113,255,156,9,106,4,233,16,34,5,153,0,0,16,
+35,0,203,1,113,0,0,16,3,5,157,6,190,0,0,255,255,0,113,254,33,6,37,4,233,16,
+34,5,153,0,0,16,35,0,203,1,113,0,0,16,3,5,190,3,221,0,0,255,255,255,254,254,
+152,7,135,6,53,16,34,5,158,0,0,16,3,0,203,2,211,0,0,255,255,0,113,254,152,
+8,82,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,0,203,3,158,0,
+0,255,255,0,143,255,158,6,182,4,233,16,34,5,159,0,0,16,3,0,203,2,2,0,0,255,
+255,0,113,255,158,8,39,4,233,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,0,
+203,3,115,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,0,203,
+1,154,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,
+0,0,16,3,0,203,3,10,0,0,255,255,0,96,254,152,6,240,4,233,16,34,0,203,0,0,
+16,3,5,161,5,78,0,0,255,255,0,113,254,152,8,96,4,233,16,34,5,153,0,0,16,35,
+0,203,1,113,0,0,16,3,5,161,6,190,0,0,255,255,0,96,254,152,7,168,4,233,16,
+34,0,203,0,0,16,3,5,162,5,78,0,0,255,255,0,113,254,152,9,24,4,233,16,34,5,
+153,0,0,16,35,0,203,1,113,0,0,16,3,5,162,6,190,0,0,255,255,0,106,0,201,3,
+170,5,252,16,34,5,180,0,0,16,3,5,181,2,10,255,88,255,255,0,113,0,201,5,47,
+4,8,16,35,5,180,1,133,0,0,16,2,5,153,0,0,255,255,0,106,0,201,3,170,6,16,16,
+34,5,180,0,0,16,3,5,182,2,10,255,88,255,255,0,106,0,201,3,170,5,82,16,34,
+5,180,0,0,16,3,5,183,2,10,255,88,255,255,0,106,0,201,3,170,6,16,16,34,5,180,
+0,0,16,3,5,184,2,10,255,88,255,255,0,113,255,158,6,123,4,219,16,35,5,180,
+2,209,0,0,16,2,5,154,0,0,255,255,0,106,0,201,3,170,6,29,16,34,5,180,0,0,16,
+3,5,185,2,10,255,88,255,255,0,106,0,201,3,170,5,160,16,34,5,180,0,0,16,3,
+5,186,2,10,255,88,255,255,0,106,0,201,3,170,5,20,16,34,5,180,0,0,16,3,5,187,
+2,10,255,88,255,255,0,106,255,28,3,170,4,8,16,34,5,180,0,0,16,3,5,188,2,10,
+0,184,255,255,0,106,0,201,3,170,5,111,16,34,5,180,0,0,16,3,5,189,2,10,255,
+88,255,255,0,106,0,102,4,217,4,72,16,34,5,180,0,0,16,3,5,155,3,100,0,0,255,
+255,0,106,0,201,6,8,4,45,16,34,5,180,0,0,16,3,5,156,3,160,0,0,255,255,0,106,
+255,156,6,143,4,168,16,34,5,180,0,0,16,3,5,157,3,227,0,0,255,255,0,106,254,
+217,3,170,4,8,16,34,5,180,0,0,16,3,5,190,2,10,0,184,255,255,255,254,254,152,
+6,37,6,53,16,35,5,180,2,123,0,0,16,2,5,158,0,0,255,255,0,143,255,158,5,88,
+4,219,16,35,5,180,1,174,0,0,16,2,5,159,0,0,255,255,0,113,255,158,6,143,6,
+111,16,35,5,180,1,174,0,0,16,2,5,160,0,0,255,255,0,106,254,152,4,254,4,221,
+16,34,5,180,0,0,16,3,5,161,3,92,0,0,255,255,0,106,254,152,5,244,4,197,16,
+34,5,180,0,0,16,3,5,162,3,154,0,0,0,1,0,72,0,0,4,117,4,170,0,37,0,0,0,21,
+20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,17,52,55,35,53,51,54,55,51,
+6,7,33,54,55,51,6,7,51,21,35,3,131,70,78,185,139,2,254,176,2,72,78,185,139,
+2,143,161,35,80,176,84,32,1,79,35,80,178,84,32,221,240,2,139,59,184,254,233,
+129,246,1,90,59,31,31,59,184,254,233,129,246,1,90,59,31,154,196,162,170,188,
+196,162,170,188,154,255,255,0,113,0,0,5,230,4,170,16,34,5,153,0,0,16,3,0,
+239,1,113,0,0,255,255,0,113,255,158,7,137,4,219,16,34,5,154,0,0,16,3,0,239,
+3,20,0,0,255,255,0,72,254,100,4,117,4,170,16,34,0,239,0,0,16,3,5,188,2,135,
+0,0,0,3,0,113,254,100,5,229,4,170,0,37,0,49,0,61,0,0,0,21,20,18,23,35,38,
+17,52,55,33,6,21,20,18,23,35,38,17,52,55,35,53,51,54,55,51,6,7,33,54,55,51,
+6,7,51,21,35,36,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,
+52,54,51,4,244,69,78,184,139,2,254,176,2,71,78,184,139,2,144,162,35,80,176,
+84,33,1,80,35,80,178,84,33,221,239,252,28,37,47,155,49,41,114,131,2,193,59,
+59,45,49,60,60,49,2,139,59,184,254,233,129,246,1,90,59,31,31,59,184,254,233,
+129,246,1,90,59,31,154,196,162,170,188,196,162,170,188,154,37,144,83,138,
+78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,4,0,113,254,
+100,7,137,4,219,0,10,0,48,0,60,0,72,0,0,0,17,20,2,7,39,18,17,16,3,55,0,21,
+20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,17,52,55,35,53,51,54,55,51,
+6,7,33,54,55,51,6,7,51,21,35,36,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,
+6,35,34,38,53,52,54,51,2,215,111,122,117,190,190,149,4,138,69,78,184,140,
+2,254,177,2,71,78,184,140,3,144,162,35,80,176,84,33,1,80,35,80,178,84,33,
+221,239,250,120,37,47,155,49,41,114,131,4,101,59,59,45,49,60,60,49,3,170,
+254,139,190,254,198,159,80,1,8,1,51,1,65,1,15,98,253,176,59,184,254,233,129,
+246,1,90,59,31,31,59,184,254,233,129,246,1,90,59,31,154,196,162,170,188,196,
+162,170,188,154,37,144,83,138,78,73,94,164,112,211,140,76,251,250,58,57,55,
+60,60,55,57,58,0,0,3,0,72,254,100,7,104,4,170,0,37,0,57,0,69,0,0,0,7,51,21,
+35,6,21,20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,17,52,55,35,53,51,
+54,55,51,6,7,33,54,55,51,0,21,20,18,23,7,0,17,52,18,55,51,22,22,23,7,38,38,
+39,35,0,22,21,20,6,35,34,38,53,52,54,51,3,184,32,221,240,2,70,78,185,139,
+2,254,176,2,72,78,185,139,2,143,161,35,80,176,84,32,1,79,35,80,178,1,121,
+117,119,131,254,247,113,125,211,12,107,75,129,75,99,16,8,252,149,60,60,45,
+49,59,59,49,4,0,188,154,31,59,184,254,233,129,246,1,90,59,31,31,59,184,254,
+233,129,246,1,90,59,31,154,196,162,170,188,196,162,254,158,250,146,254,218,
+134,116,1,55,1,111,176,1,34,148,123,244,86,100,90,223,113,251,33,58,57,55,
+60,60,55,57,58,0,4,0,113,254,100,8,217,4,170,0,37,0,57,0,69,0,81,0,0,0,7,
+51,21,35,6,21,20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,17,52,55,35,
+53,51,54,55,51,6,7,33,54,55,51,0,21,20,18,23,7,0,17,52,18,55,51,22,22,23,
+7,38,38,39,35,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,
+52,54,51,5,41,33,221,239,2,69,78,184,139,2,254,176,2,71,78,184,139,2,144,
+162,35,80,176,84,33,1,80,35,80,178,1,121,116,119,131,254,248,113,125,211,
+12,106,76,129,76,98,16,9,249,129,37,47,155,49,41,114,131,2,193,59,59,45,49,
+60,60,49,4,0,188,154,31,59,184,254,233,129,246,1,90,59,31,31,59,184,254,233,
+129,246,1,90,59,31,154,196,162,170,188,196,162,254,158,250,146,254,218,134,
+116,1,55,1,111,176,1,34,148,123,244,86,100,90,223,113,254,166,144,83,138,
+78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,4,0,113,252,
+174,5,229,4,170,0,37,0,49,0,61,0,75,0,0,0,21,20,18,23,35,38,17,52,55,33,6,
+21,20,18,23,35,38,17,52,55,35,53,51,54,55,51,6,7,33,54,55,51,6,7,51,21,35,
+36,21,20,22,23,7,38,38,53,52,55,23,0,6,35,34,38,53,52,54,51,50,22,21,2,51,
+50,23,7,38,35,34,7,39,19,23,7,23,4,244,69,78,184,139,2,254,176,2,71,78,184,
+139,2,144,162,35,80,176,84,33,1,80,35,80,178,84,33,221,239,252,28,37,47,155,
+49,41,114,131,2,252,59,45,49,60,60,49,45,59,164,156,139,117,59,107,149,148,
+114,131,188,115,125,4,2,139,59,184,254,233,129,246,1,90,59,31,31,59,184,254,
+233,129,246,1,90,59,31,154,196,162,170,188,196,162,170,188,154,37,144,83,
+138,78,73,94,164,112,211,140,76,251,80,60,60,55,57,58,58,57,254,172,53,160,
+62,58,84,1,41,74,170,4,0,3,255,254,254,100,7,72,6,53,0,20,0,58,0,70,0,0,19,
+0,17,20,2,6,35,34,39,55,22,51,50,54,53,16,9,2,7,39,0,21,20,18,23,35,38,17,
+52,55,33,6,21,20,18,23,35,38,17,52,55,35,53,51,54,55,51,6,7,33,54,55,51,6,
+7,51,21,35,2,22,21,20,6,35,34,38,53,52,54,51,223,1,166,115,200,129,99,65,
+74,43,55,121,145,254,35,1,115,1,98,105,233,4,213,70,77,184,139,2,254,176,
+2,72,78,185,139,2,143,161,35,80,176,84,33,1,80,35,80,178,84,33,222,240,207,
+60,60,45,49,59,59,49,4,154,254,73,254,0,188,254,248,135,49,141,29,213,209,
+2,17,1,170,1,155,254,215,129,197,253,59,59,184,254,233,129,246,1,90,59,31,
+31,59,184,254,233,129,246,1,90,59,31,154,196,162,170,188,196,162,170,188,
+154,252,160,58,57,55,60,60,55,57,58,255,255,0,113,254,100,8,19,6,53,16,35,
+5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,35,0,239,3,158,0,0,16,3,5,188,6,
+37,0,0,0,3,0,143,254,100,6,119,4,219,0,10,0,48,0,60,0,0,0,17,16,19,7,2,17,
+52,18,55,23,0,21,20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,17,52,55,
+35,53,51,54,55,51,6,7,33,54,55,51,6,7,51,21,35,2,22,21,20,6,35,34,38,53,52,
+54,51,1,47,191,150,201,111,123,117,3,151,70,78,185,139,2,254,176,2,72,78,
+185,139,2,143,162,34,80,176,84,32,1,79,35,80,178,84,32,221,240,207,60,60,
+45,49,59,59,49,3,131,254,205,254,190,254,242,98,1,49,1,117,190,1,57,160,80,
+254,0,59,184,254,233,129,246,1,90,59,31,31,59,184,254,233,129,246,1,90,59,
+31,154,196,162,170,188,196,162,170,188,154,252,160,58,57,55,60,60,55,57,58,
+0,0,4,0,113,254,100,7,231,4,219,0,10,0,48,0,60,0,72,0,0,0,17,16,19,7,2,17,
+52,18,55,23,0,21,20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,17,52,55,
+35,53,51,54,55,51,6,7,33,54,55,51,6,7,51,21,35,36,21,20,22,23,7,38,38,53,
+52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,2,160,190,149,201,111,122,117,
+3,152,69,78,184,139,2,254,176,2,71,78,184,139,2,144,162,35,80,176,84,33,1,
+80,35,80,178,84,33,221,239,250,26,37,47,155,49,41,114,131,4,195,59,59,45,
+49,60,60,49,3,131,254,205,254,190,254,242,98,1,49,1,117,190,1,57,160,80,254,
+0,59,184,254,233,129,246,1,90,59,31,31,59,184,254,233,129,246,1,90,59,31,
+154,196,162,170,188,196,162,170,188,154,37,144,83,138,78,73,94,164,112,211,
+140,76,251,250,58,57,55,60,60,55,57,58,0,0,3,0,113,254,100,6,143,6,111,0,
+20,0,58,0,70,0,0,54,2,53,16,18,55,4,51,32,37,21,4,33,34,39,0,17,20,18,23,
+7,0,7,51,21,35,6,21,20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,17,52,
+55,35,53,51,54,55,51,6,7,33,54,55,51,0,22,21,20,6,35,34,38,53,52,54,51,201,
+88,170,176,1,0,235,1,174,1,43,254,230,254,65,213,198,254,247,78,88,147,4,
+45,33,221,239,2,69,78,184,139,2,254,176,2,71,78,184,139,2,144,162,35,80,176,
+84,33,1,80,35,80,178,254,170,59,59,45,49,60,60,49,59,1,78,203,1,37,1,221,
+233,43,91,162,94,36,254,160,254,47,184,254,223,151,84,4,98,188,154,31,59,
+184,254,233,129,246,1,90,59,31,31,59,184,254,233,129,246,1,90,59,31,154,196,
+162,170,188,196,162,250,160,58,57,55,60,60,55,57,58,0,0,4,0,113,254,100,8,
+0,6,111,0,20,0,58,0,70,0,82,0,0,36,2,53,16,18,55,4,51,32,37,21,4,33,34,39,
+0,17,20,18,23,7,0,7,51,21,35,6,21,20,18,23,35,38,17,52,55,33,6,21,20,18,23,
+35,38,17,52,55,35,53,51,54,55,51,6,7,33,54,55,51,0,21,20,22,23,7,38,38,53,
+52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,2,57,88,170,176,1,0,236,1,174,
+1,43,254,229,254,66,213,199,254,248,78,88,147,4,45,33,221,240,2,70,78,185,
+139,2,254,176,2,72,78,185,139,2,143,162,35,79,177,84,33,1,80,34,80,179,249,
+251,37,47,155,49,41,114,131,4,91,59,59,46,49,59,59,49,59,1,78,203,1,37,1,
+221,233,43,91,162,94,36,254,160,254,47,184,254,223,151,84,4,98,188,154,31,
+59,184,254,233,129,246,1,90,59,31,31,59,184,254,233,129,246,1,90,59,31,154,
+196,162,170,188,196,162,254,37,144,83,138,78,73,94,164,112,211,140,76,251,
+250,58,57,55,60,60,55,57,58,0,3,0,72,254,100,6,94,4,221,0,17,0,55,0,67,0,
+0,0,17,20,2,6,35,34,39,55,22,51,50,54,54,53,16,3,55,0,21,20,18,23,35,38,17,
+52,55,33,6,21,20,18,23,35,38,17,52,55,35,53,51,54,55,51,6,7,33,54,55,51,6,
+7,51,21,35,2,22,21,20,6,35,34,38,53,52,54,51,6,94,129,229,142,98,65,73,43,
+56,94,145,82,231,147,254,35,70,78,185,139,2,254,176,2,72,78,185,139,2,143,
+161,35,80,176,84,32,1,79,35,80,178,84,32,221,240,207,60,60,45,49,59,59,49,
+3,117,253,231,213,254,191,174,49,141,29,133,250,170,1,205,1,90,84,253,174,
+59,184,254,233,129,246,1,90,59,31,31,59,184,254,233,129,246,1,90,59,31,154,
+196,162,170,188,196,162,170,188,154,252,160,58,57,55,60,60,55,57,58,0,4,0,
+113,254,100,7,207,4,221,0,17,0,55,0,67,0,79,0,0,0,17,20,2,6,35,34,39,55,22,
+51,50,54,54,53,16,3,55,0,21,20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,
+17,52,55,35,53,51,54,55,51,6,7,33,54,55,51,6,7,51,21,35,36,21,20,22,23,7,
+38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,7,207,129,230,141,98,
+66,74,43,55,95,145,82,232,148,254,35,69,78,184,139,2,254,176,2,71,78,184,
+139,2,144,162,35,80,176,84,33,1,80,35,80,178,84,33,221,239,252,28,37,47,155,
+49,41,114,131,2,193,59,59,45,49,60,60,49,3,117,253,231,213,254,191,174,49,
+141,29,133,250,170,1,205,1,90,84,253,174,59,184,254,233,129,246,1,90,59,31,
+31,59,184,254,233,129,246,1,90,59,31,154,196,162,170,188,196,162,170,188,
+154,37,144,83,138,78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,
+58,0,3,0,72,254,100,7,23,4,197,0,35,0,73,0,85,0,0,0,51,50,22,21,20,7,22,18,
+21,20,6,6,35,34,39,55,22,51,50,54,53,52,39,6,7,39,62,2,53,52,35,34,7,39,4,
+7,51,21,35,6,21,20,18,23,35,38,17,52,55,33,6,21,20,18,23,35,38,17,52,55,35,
+53,51,54,55,51,6,7,33,54,55,51,0,22,21,20,6,35,34,38,53,52,54,51,5,74,170,
+135,145,127,66,72,123,217,140,98,66,74,43,55,140,162,103,74,98,88,137,150,
+65,110,107,108,92,254,247,32,221,240,2,70,78,185,139,2,254,176,2,72,78,185,
+139,2,143,161,35,80,176,84,32,1,79,35,80,178,254,170,60,60,45,49,59,59,49,
+4,197,160,125,150,129,112,254,239,122,166,230,114,49,141,29,172,177,212,183,
+56,61,145,80,117,104,62,121,86,139,86,188,154,31,59,184,254,233,129,246,1,
+90,59,31,31,59,184,254,233,129,246,1,90,59,31,154,196,162,170,188,196,162,
+250,160,58,57,55,60,60,55,57,58,0,4,0,113,254,100,8,135,4,197,0,35,0,73,0,
+85,0,97,0,0,0,51,50,22,21,20,7,22,18,21,20,6,6,35,34,39,55,22,51,50,54,53,
+52,39,6,7,39,62,2,53,52,35,34,7,39,4,7,51,21,35,6,21,20,18,23,35,38,17,52,
+55,33,6,21,20,18,23,35,38,17,52,55,35,53,51,54,55,51,6,7,33,54,55,51,0,21,
+20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,6,186,170,
+136,145,127,65,72,123,217,139,98,66,74,43,55,139,162,102,74,98,88,137,149,
+66,111,106,109,92,254,248,33,221,239,2,69,78,184,139,2,254,176,2,71,78,184,
+139,2,144,162,35,80,176,84,33,1,80,35,80,178,251,149,37,47,155,49,41,114,
+131,2,193,59,59,45,49,60,60,49,4,197,160,125,150,129,112,254,239,122,166,
+230,114,49,141,29,172,177,212,183,56,61,145,80,117,104,62,121,86,139,86,188,
+154,31,59,184,254,233,129,246,1,90,59,31,31,59,184,254,233,129,246,1,90,59,
+31,154,196,162,170,188,196,162,254,37,144,83,138,78,73,94,164,112,211,140,
+76,251,250,58,57,55,60,60,55,57,58,255,255,0,72,255,156,7,104,4,170,16,34,
+0,239,0,0,16,3,5,157,4,188,0,0,255,255,0,113,255,156,8,217,4,170,16,34,5,
+153,0,0,16,35,0,239,1,113,0,0,16,3,5,157,6,45,0,0,255,255,0,113,254,33,5,
+230,4,170,16,34,5,153,0,0,16,35,0,239,1,113,0,0,16,3,5,190,3,248,0,0,255,
+255,255,254,254,152,7,72,6,53,16,34,5,158,0,0,16,3,0,239,2,211,0,0,255,255,
+0,113,254,152,8,19,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,
+0,239,3,158,0,0,255,255,0,143,255,158,6,58,4,219,16,34,5,159,0,0,16,3,0,239,
+1,197,0,0,255,255,0,113,255,158,7,170,4,219,16,34,5,153,0,0,16,35,5,159,1,
+113,0,0,16,3,0,239,3,53,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,
+0,0,16,3,0,239,1,154,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,
+16,35,5,160,1,113,0,0,16,3,0,239,3,10,0,0,255,255,0,72,254,152,6,94,4,221,
+16,34,0,239,0,0,16,3,5,161,4,188,0,0,255,255,0,113,254,152,7,207,4,221,16,
+34,5,153,0,0,16,35,0,239,1,113,0,0,16,3,5,161,6,45,0,0,255,255,0,72,254,152,
+7,22,4,197,16,34,0,239,0,0,16,3,5,162,4,188,0,0,255,255,0,113,254,152,8,135,
+4,197,16,34,5,153,0,0,16,35,0,239,1,113,0,0,16,3,5,162,6,45,0,0,0,2,0,121,
+255,250,4,137,4,190,0,41,0,59,0,0,0,7,22,21,20,6,35,34,38,39,38,35,34,21,
+20,23,35,38,53,52,55,38,53,52,18,55,22,51,50,55,21,6,35,34,39,6,7,22,51,32,
+55,21,6,39,6,35,34,39,21,20,23,51,50,22,23,22,22,51,50,53,4,72,66,76,162,
+141,66,116,80,119,47,80,4,174,4,78,56,88,109,147,193,207,157,145,223,127,
+98,84,31,149,199,1,14,207,231,70,82,92,186,185,45,15,53,94,70,70,88,49,131,
+2,45,12,117,129,147,158,37,37,51,80,19,20,20,19,121,65,111,164,176,1,67,207,
+37,45,159,49,14,152,161,25,57,164,165,114,6,31,41,146,77,31,33,31,30,135,
+255,255,0,113,255,250,5,250,4,190,16,34,5,153,0,0,16,3,1,15,1,113,0,0,255,
+255,0,113,255,158,7,157,4,219,16,34,5,154,0,0,16,3,1,15,3,20,0,0,0,2,0,121,
+255,29,5,156,4,190,0,54,0,74,0,0,0,35,34,39,6,7,22,51,50,55,54,51,50,22,21,
+16,3,39,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,39,38,35,34,21,20,23,35,
+38,53,52,55,38,53,52,18,55,22,51,50,55,21,2,38,39,6,35,34,39,6,21,20,23,51,
+50,22,23,22,22,51,50,53,3,131,223,127,98,76,35,152,192,137,193,82,34,146,
+160,170,121,127,68,74,36,76,49,39,162,141,66,116,80,119,47,80,4,174,4,78,
+56,88,109,147,193,207,157,114,35,49,70,90,188,181,2,45,15,53,94,70,70,88,
+49,131,3,238,14,133,162,23,25,10,213,202,254,243,254,232,65,242,237,134,122,
+10,71,123,70,147,158,37,37,51,80,19,20,20,19,121,65,111,164,176,1,67,207,
+37,45,159,253,71,113,74,6,30,20,41,146,77,31,33,31,30,135,255,255,0,113,255,
+29,7,13,4,190,16,34,5,153,0,0,16,3,1,18,1,113,0,0,255,255,0,113,255,29,8,
+176,4,219,16,34,5,154,0,0,16,3,1,18,3,20,0,0,0,2,0,121,255,72,7,100,4,190,
+0,69,0,88,0,0,0,21,20,6,7,39,38,2,39,7,22,21,20,3,39,54,17,52,35,34,7,22,
+21,20,6,35,34,38,39,38,35,34,21,20,23,35,38,53,52,55,38,53,52,18,55,22,51,
+50,55,21,6,35,34,39,6,7,22,51,50,55,54,51,32,19,23,54,53,52,39,55,0,38,39,
+7,34,39,6,21,20,23,51,50,22,23,22,22,51,50,53,7,100,96,110,158,39,90,66,4,
+55,65,141,43,82,13,106,80,160,137,66,116,80,119,47,80,4,174,4,78,56,88,109,
+147,193,207,157,145,223,127,98,76,35,166,219,137,232,106,47,1,60,71,6,89,
+50,168,252,107,35,47,121,207,203,2,45,15,53,94,70,70,88,49,131,2,145,137,
+149,250,150,52,243,1,2,49,6,90,166,231,254,248,30,248,1,0,219,12,121,137,
+147,158,37,37,51,80,19,20,20,19,121,65,111,164,176,1,67,207,37,45,159,49,
+14,133,160,25,25,14,253,177,3,164,166,127,131,58,254,75,113,72,2,30,20,41,
+146,77,31,33,31,30,135,0,255,255,0,113,255,72,8,213,4,190,16,34,5,153,0,0,
+16,3,1,21,1,113,0,0,255,255,0,113,255,72,10,120,4,219,16,34,5,154,0,0,16,
+3,1,21,3,20,0,0,255,255,0,121,255,72,10,109,4,190,16,34,1,21,0,0,16,3,5,157,
+7,193,0,0,255,255,0,113,255,72,11,221,4,190,16,34,5,153,0,0,16,35,1,21,1,
+113,0,0,16,3,5,157,9,49,0,0,255,255,0,113,254,33,8,213,4,190,16,34,5,153,
+0,0,16,35,1,21,1,113,0,0,16,3,5,190,3,246,0,0,255,255,255,254,254,152,10,
+55,6,53,16,34,5,158,0,0,16,3,1,21,2,211,0,0,255,255,0,113,254,152,11,2,6,
+53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,1,21,3,158,0,0,255,255,
+0,143,255,72,9,102,4,219,16,34,5,159,0,0,16,3,1,21,2,2,0,0,255,255,0,113,
+255,72,10,215,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,1,21,3,115,
+0,0,255,255,0,113,255,72,8,254,6,111,16,34,5,160,0,0,16,3,1,21,1,154,0,0,
+255,255,0,113,255,72,10,110,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,
+3,1,21,3,10,0,0,255,255,0,121,254,152,9,25,4,221,16,34,1,21,0,0,16,3,5,161,
+7,119,0,0,255,255,0,113,254,152,10,137,4,221,16,34,5,153,0,0,16,35,1,21,1,
+113,0,0,16,3,5,161,8,231,0,0,255,255,0,121,254,152,10,27,4,197,16,34,1,21,
+0,0,16,3,5,162,7,193,0,0,255,255,0,113,254,152,11,139,4,197,16,34,5,153,0,
+0,16,35,1,21,1,113,0,0,16,3,5,162,9,49,0,0,255,255,0,121,255,29,8,170,4,190,
+16,34,1,18,0,0,16,3,5,157,5,254,0,0,255,255,0,113,255,29,10,27,4,190,16,34,
+5,153,0,0,16,35,1,18,1,113,0,0,16,3,5,157,7,111,0,0,255,255,0,113,254,33,
+7,13,4,190,16,34,5,153,0,0,16,35,1,18,1,113,0,0,16,3,5,190,3,246,0,0,255,
+255,255,254,254,152,8,111,6,53,16,34,5,158,0,0,16,3,1,18,2,211,0,0,255,255,
+0,113,254,152,9,58,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,
+1,18,3,158,0,0,255,255,0,143,255,29,7,158,4,219,16,34,5,159,0,0,16,3,1,18,
+2,2,0,0,255,255,0,113,255,29,9,15,4,219,16,34,5,153,0,0,16,35,5,159,1,113,
+0,0,16,3,1,18,3,115,0,0,255,255,0,113,255,29,7,54,6,111,16,34,5,160,0,0,16,
+3,1,18,1,154,0,0,255,255,0,113,255,29,8,166,6,111,16,34,5,153,0,0,16,35,5,
+160,1,113,0,0,16,3,1,18,3,10,0,0,255,255,0,121,254,152,7,160,4,221,16,34,
+1,18,0,0,16,3,5,161,5,254,0,0,255,255,0,113,254,152,9,17,4,221,16,34,5,153,
+0,0,16,35,1,18,1,113,0,0,16,3,5,161,7,111,0,0,255,255,0,121,254,152,8,88,
+4,197,16,34,1,18,0,0,16,3,5,162,5,254,0,0,255,255,0,113,254,152,9,201,4,197,
+16,34,5,153,0,0,16,35,1,18,1,113,0,0,16,3,5,162,7,111,0,0,0,2,0,121,255,250,
+6,150,4,190,0,60,0,78,0,0,0,21,20,6,7,39,38,38,35,34,7,22,21,20,6,35,34,38,
+39,38,35,34,21,20,23,35,38,53,52,55,38,53,52,18,55,22,51,50,55,21,6,35,34,
+39,6,7,22,51,50,55,54,51,50,22,23,23,54,53,52,39,55,0,39,6,35,34,39,21,20,
+23,51,50,22,23,22,22,51,50,53,6,150,97,110,174,41,107,57,21,45,72,162,141,
+66,116,80,119,47,80,4,174,4,78,56,88,109,147,193,207,157,145,223,127,98,80,
+35,190,199,137,127,82,29,125,153,49,7,88,49,167,253,58,70,78,55,209,203,45,
+15,53,94,70,70,88,49,131,2,231,137,149,250,150,58,209,219,4,111,129,147,158,
+37,37,51,80,19,20,20,19,121,65,111,164,176,1,67,207,37,45,159,49,14,141,172,
+25,16,9,220,251,3,164,166,127,131,58,254,43,112,4,31,41,146,77,31,33,31,30,
+135,0,255,255,0,113,255,250,8,7,4,190,16,34,5,153,0,0,16,3,1,50,1,113,0,0,
+255,255,0,113,255,158,9,170,4,219,16,34,5,154,0,0,16,3,1,50,3,20,0,0,255,
+255,0,121,255,156,9,158,4,190,16,34,1,50,0,0,16,3,5,157,6,242,0,0,255,255,
+0,113,255,156,11,14,4,190,16,34,5,153,0,0,16,35,1,50,1,113,0,0,16,3,5,157,
+8,98,0,0,255,255,0,113,254,33,8,7,4,190,16,34,5,153,0,0,16,35,1,50,1,113,
+0,0,16,3,5,190,3,246,0,0,255,255,255,254,254,152,9,105,6,53,16,34,5,158,0,
+0,16,3,1,50,2,211,0,0,255,255,0,113,254,152,10,52,6,53,16,35,5,158,0,203,
+0,0,16,35,5,153,0,0,255,68,16,3,1,50,3,158,0,0,255,255,0,143,255,158,8,152,
+4,219,16,34,5,159,0,0,16,3,1,50,2,2,0,0,255,255,0,113,255,158,10,9,4,219,
+16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,1,50,3,115,0,0,255,255,0,113,255,
+158,8,48,6,111,16,34,5,160,0,0,16,3,1,50,1,154,0,0,255,255,0,113,255,158,
+9,160,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,1,50,3,10,0,0,255,
+255,0,121,254,152,8,74,4,221,16,34,1,50,0,0,16,3,5,161,6,168,0,0,255,255,
+0,113,254,152,9,187,4,221,16,34,5,153,0,0,16,35,1,50,1,113,0,0,16,3,5,161,
+8,25,0,0,255,255,0,121,254,152,9,76,4,197,16,34,1,50,0,0,16,3,5,162,6,242,
+0,0,255,255,0,113,254,152,10,188,4,197,16,34,5,153,0,0,16,35,1,50,1,113,0,
+0,16,3,5,162,8,98,0,0,255,255,0,121,255,156,7,182,4,190,16,34,1,15,0,0,16,
+3,5,157,5,10,0,0,255,255,0,113,255,156,9,39,4,190,16,34,5,153,0,0,16,35,1,
+15,1,113,0,0,16,3,5,157,6,123,0,0,255,255,0,113,254,33,5,250,4,190,16,34,
+5,153,0,0,16,35,1,15,1,113,0,0,16,3,5,190,3,246,0,0,255,255,255,254,254,152,
+7,92,6,53,16,34,5,158,0,0,16,3,1,15,2,211,0,0,255,255,0,113,254,152,8,39,
+6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,1,15,3,158,0,0,255,
+255,0,143,255,158,6,139,4,219,16,34,5,159,0,0,16,3,1,15,2,2,0,0,255,255,0,
+113,255,158,7,252,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,1,15,3,
+115,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,1,15,1,154,
+0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,
+16,3,1,15,3,10,0,0,255,255,0,121,254,152,6,172,4,221,16,34,1,15,0,0,16,3,
+5,161,5,10,0,0,255,255,0,113,254,152,8,29,4,221,16,34,5,153,0,0,16,35,1,15,
+1,113,0,0,16,3,5,161,6,123,0,0,255,255,0,121,254,152,7,100,4,197,16,34,1,
+15,0,0,16,3,5,162,5,10,0,0,255,255,0,113,254,152,8,213,4,197,16,34,5,153,
+0,0,16,35,1,15,1,113,0,0,16,3,5,162,6,123,0,0,0,2,0,143,255,233,7,57,4,195,
+0,36,0,46,0,0,0,17,52,39,6,35,34,38,53,52,55,54,51,50,4,18,21,16,5,1,6,17,
+20,22,51,50,55,21,6,35,34,36,2,53,16,37,1,18,55,38,35,35,6,21,20,22,51,6,
+139,12,104,160,148,172,56,55,90,168,1,2,143,254,90,252,129,215,220,188,78,
+55,55,90,168,254,254,144,1,166,3,131,70,78,107,237,35,12,96,82,1,72,1,18,
+76,61,86,170,129,127,119,21,150,254,234,187,254,96,211,3,242,117,254,236,
+217,230,21,170,21,150,1,23,186,1,160,211,252,16,2,65,86,175,48,49,73,91,255,
+255,0,113,255,233,8,170,4,195,16,34,5,153,0,0,16,3,1,79,1,113,0,0,255,255,
+0,113,255,158,10,77,4,219,16,34,5,154,0,0,16,3,1,79,3,20,0,0,0,2,0,143,255,
+233,9,145,4,195,0,58,0,68,0,0,0,21,20,6,7,39,2,2,35,35,22,21,16,5,1,6,17,
+20,22,51,50,55,21,6,35,34,36,2,53,16,37,1,54,17,52,39,6,35,34,38,53,52,55,
+54,51,50,4,23,54,51,50,18,19,23,54,53,52,39,55,4,55,38,35,35,6,21,20,22,51,
+9,145,96,110,175,45,110,62,12,10,254,90,252,129,215,220,188,78,55,55,90,168,
+254,254,144,1,166,3,131,211,12,104,160,148,172,56,55,90,180,1,17,65,25,28,
+129,160,51,7,88,50,168,252,154,78,107,237,35,12,96,82,3,37,137,150,250,149,
+57,1,14,1,31,67,62,254,96,211,3,242,117,254,236,217,230,21,170,21,150,1,23,
+186,1,160,211,252,16,117,1,18,76,61,86,170,129,127,119,21,175,157,6,254,233,
+254,195,2,164,166,127,131,57,152,86,175,48,49,73,91,0,255,255,0,113,255,233,
+11,2,4,195,16,34,5,153,0,0,16,3,1,82,1,113,0,0,255,255,0,113,255,158,12,165,
+4,219,16,34,5,154,0,0,16,3,1,82,3,20,0,0,255,255,0,143,255,156,12,154,4,195,
+16,34,1,82,0,0,16,3,5,157,9,238,0,0,255,255,0,113,255,156,14,10,4,195,16,
+34,5,153,0,0,16,35,1,82,1,113,0,0,16,3,5,157,11,94,0,0,255,255,0,113,254,
+33,11,2,4,195,16,34,5,153,0,0,16,35,1,82,1,113,0,0,16,3,5,190,5,88,0,0,255,
+255,255,254,254,152,12,59,6,53,16,34,5,158,0,0,16,3,1,82,2,170,0,0,255,255,
+0,113,254,152,13,47,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,
+3,1,82,3,158,0,0,255,255,0,143,255,158,11,55,4,219,16,34,5,159,0,0,16,3,1,
+82,1,166,0,0,255,255,0,113,255,158,12,168,4,219,16,34,5,153,0,0,16,35,5,159,
+1,113,0,0,16,3,1,82,3,23,0,0,255,255,0,113,255,158,11,43,6,143,16,34,5,163,
+0,0,16,3,1,82,1,154,0,0,255,255,0,113,255,158,12,155,6,143,16,34,5,153,0,
+0,16,35,5,163,1,113,0,0,16,3,1,82,3,10,0,0,255,255,0,143,254,152,11,70,4,
+221,16,34,1,82,0,0,16,3,5,161,9,164,0,0,255,255,0,113,254,152,12,182,4,221,
+16,34,5,153,0,0,16,35,1,82,1,113,0,0,16,3,5,161,11,20,0,0,255,255,0,143,254,
+152,12,72,4,197,16,34,1,82,0,0,16,3,5,162,9,238,0,0,255,255,0,113,254,152,
+13,184,4,197,16,34,5,153,0,0,16,35,1,82,1,113,0,0,16,3,5,162,11,94,0,0,255,
+255,0,143,255,156,10,121,4,195,16,34,1,79,0,0,16,3,5,157,7,205,0,0,255,255,
+0,113,255,156,11,233,4,195,16,34,5,153,0,0,16,35,1,79,1,113,0,0,16,3,5,157,
+9,61,0,0,255,255,0,113,254,33,8,170,4,195,16,34,5,153,0,0,16,35,1,79,1,113,
+0,0,16,3,5,190,5,88,0,0,255,255,255,254,254,152,9,227,6,53,16,34,5,158,0,
+0,16,3,1,79,2,170,0,0,255,255,0,113,254,152,10,215,6,53,16,35,5,158,0,203,
+0,0,16,35,5,153,0,0,255,68,16,3,1,79,3,158,0,0,255,255,0,143,255,158,8,223,
+4,219,16,34,5,159,0,0,16,3,1,79,1,166,0,0,255,255,0,113,255,158,10,80,4,219,
+16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,1,79,3,23,0,0,255,255,0,113,255,
+158,8,211,6,143,16,34,5,163,0,0,16,3,1,79,1,154,0,0,255,255,0,113,255,158,
+10,67,6,143,16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,1,79,3,10,0,0,255,
+255,0,143,254,152,8,254,4,221,16,34,1,79,0,0,16,3,5,161,7,92,0,0,255,255,
+0,113,254,152,10,111,4,221,16,34,5,153,0,0,16,35,1,79,1,113,0,0,16,3,5,161,
+8,205,0,0,255,255,0,143,254,152,9,254,4,197,16,34,1,79,0,0,16,3,5,162,7,164,
+0,0,255,255,0,113,254,152,11,110,4,197,16,34,5,153,0,0,16,35,1,79,1,113,0,
+0,16,3,5,162,9,20,0,0,0,1,0,143,255,231,6,231,4,219,0,33,0,0,0,0,21,20,2,
+35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,50,54,3,51,2,33,32,17,52,2,
+39,55,5,231,1,0,239,203,254,236,91,8,90,254,238,203,240,1,252,74,211,197,
+1,27,129,141,2,172,2,1,17,1,24,196,209,69,4,104,254,134,252,248,254,237,1,
+9,254,247,1,19,248,2,2,231,158,96,254,232,207,254,151,238,1,22,253,252,1,
+105,207,1,24,96,158,0,255,255,0,113,255,231,8,88,4,219,16,34,5,153,0,0,16,
+3,1,111,1,113,0,0,255,255,0,113,255,158,9,251,4,219,16,34,5,154,0,0,16,3,
+1,111,3,20,0,0,255,255,0,143,254,100,8,63,4,219,16,34,1,130,0,0,16,3,5,188,
+3,188,0,0,0,3,0,113,254,100,9,176,4,219,0,49,0,61,0,73,0,0,0,19,54,51,50,
+22,21,16,3,39,54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,
+23,6,2,21,16,33,50,54,3,51,2,33,32,17,52,2,39,55,0,21,20,22,23,7,38,38,53,
+52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,7,150,122,56,55,145,160,170,121,
+127,67,74,29,30,20,240,202,254,235,90,8,90,254,237,202,240,1,252,74,211,197,
+1,27,129,141,2,172,2,1,16,1,25,197,209,70,250,186,37,47,155,49,41,114,131,
+3,246,60,60,45,49,59,59,49,4,76,254,254,16,213,203,254,244,254,232,65,242,
+237,135,125,6,88,106,248,254,237,1,9,254,247,1,19,248,2,2,231,158,96,254,
+232,207,254,151,238,1,22,253,252,1,105,207,1,24,96,158,253,244,144,83,138,
+78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,0,4,0,113,254,
+100,11,84,4,219,0,10,0,60,0,72,0,84,0,0,0,17,20,2,7,39,18,17,16,3,55,4,19,
+54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,
+2,53,16,37,23,6,2,21,16,33,50,54,3,51,2,33,32,17,52,2,39,55,0,21,20,22,23,
+7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,2,215,111,122,117,190,
+190,149,7,43,123,56,55,145,160,170,121,127,67,74,29,31,21,240,202,254,235,
+90,8,90,254,237,203,239,1,252,73,210,197,1,27,129,141,2,172,2,1,16,1,25,197,
+209,70,249,22,37,47,155,49,41,114,131,5,154,59,59,45,49,60,60,49,3,170,254,
+139,190,254,198,159,80,1,8,1,51,1,65,1,15,98,143,254,254,16,213,203,254,244,
+254,232,65,242,237,135,125,6,88,106,248,254,237,1,9,254,247,1,19,248,2,2,
+231,158,96,254,232,207,254,151,238,1,22,253,252,1,105,207,1,24,96,158,253,
+244,144,83,138,78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,
+0,0,3,0,143,254,100,11,78,4,219,0,49,0,69,0,81,0,0,0,19,54,51,50,22,21,16,
+3,39,54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,
+21,16,33,50,54,3,51,2,33,32,17,52,2,39,55,0,21,20,18,23,7,0,17,52,18,55,51,
+22,22,23,7,38,38,39,35,0,22,21,20,6,35,34,38,53,52,54,51,6,37,123,55,55,146,
+159,169,121,127,68,74,28,31,20,239,203,254,236,91,8,90,254,238,203,240,1,
+252,74,211,197,1,27,129,141,2,172,2,1,17,1,24,196,209,69,4,131,117,119,131,
+254,248,112,125,211,13,106,76,129,76,98,17,8,249,230,59,59,46,49,59,59,49,
+4,76,254,254,16,213,203,254,244,254,232,65,242,237,135,125,6,88,106,248,254,
+237,1,9,254,247,1,19,248,2,2,231,158,96,254,232,207,254,151,238,1,22,253,
+252,1,105,207,1,24,96,158,254,109,250,146,254,218,134,116,1,55,1,111,176,
+1,34,148,123,244,86,100,90,223,113,251,33,58,57,55,60,60,55,57,58,0,4,0,113,
+254,100,12,190,4,219,0,49,0,69,0,81,0,93,0,0,0,19,54,51,50,22,21,16,3,39,
+54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,
+33,50,54,3,51,2,33,32,17,52,2,39,55,0,21,20,18,23,7,0,17,52,18,55,51,22,22,
+23,7,38,38,39,35,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,
+53,52,54,51,7,150,122,56,55,145,160,170,121,127,67,74,29,30,20,240,202,254,
+235,90,8,90,254,237,202,240,1,252,74,211,197,1,27,129,141,2,172,2,1,16,1,
+25,197,209,70,4,131,117,119,131,254,247,113,125,211,12,107,75,129,75,99,16,
+8,245,155,37,47,155,49,41,114,131,3,246,60,60,45,49,59,59,49,4,76,254,254,
+16,213,203,254,244,254,232,65,242,237,135,125,6,88,106,248,254,237,1,9,254,
+247,1,19,248,2,2,231,158,96,254,232,207,254,151,238,1,22,253,252,1,105,207,
+1,24,96,158,254,109,250,146,254,218,134,116,1,55,1,111,176,1,34,148,123,244,
+86,100,90,223,113,254,166,144,83,138,78,73,94,164,112,211,140,76,251,250,
+58,57,55,60,60,55,57,58,0,4,0,113,252,174,9,176,4,219,0,49,0,61,0,73,0,87,
+0,0,0,19,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,
+2,33,34,2,53,16,37,23,6,2,21,16,33,50,54,3,51,2,33,32,17,52,2,39,55,0,21,
+20,22,23,7,38,38,53,52,55,23,0,6,35,34,38,53,52,54,51,50,22,21,2,51,50,23,
+7,38,35,34,7,39,19,23,7,23,7,150,122,56,55,145,160,170,121,127,67,74,29,30,
+20,240,202,254,235,90,8,90,254,237,202,240,1,252,74,211,197,1,27,129,141,
+2,172,2,1,16,1,25,197,209,70,250,186,37,47,155,49,41,114,131,4,50,60,45,49,
+59,59,49,45,60,164,155,140,116,59,109,147,147,115,131,188,115,125,4,4,76,
+254,254,16,213,203,254,244,254,232,65,242,237,135,125,6,88,106,248,254,237,
+1,9,254,247,1,19,248,2,2,231,158,96,254,232,207,254,151,238,1,22,253,252,
+1,105,207,1,24,96,158,253,244,144,83,138,78,73,94,164,112,211,140,76,251,
+80,60,60,55,57,58,58,57,254,172,53,160,62,58,84,1,41,74,170,4,0,255,255,255,
+254,254,100,10,233,6,53,16,34,5,158,0,0,16,35,5,188,6,102,0,0,16,3,1,130,
+2,170,0,0,0,4,0,113,254,100,11,221,6,53,0,20,0,70,0,82,0,94,0,0,1,0,17,20,
+2,6,35,34,39,55,22,51,50,54,53,16,9,2,7,39,0,19,54,51,50,22,21,16,3,39,54,
+53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,
+50,54,3,51,2,33,32,17,52,2,39,55,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,
+20,6,35,34,38,53,52,54,51,1,170,1,166,115,201,129,98,65,73,43,56,120,146,
+254,35,1,114,1,99,105,233,7,119,122,56,55,145,160,170,121,127,67,74,29,30,
+20,239,203,254,235,90,8,90,254,237,202,240,1,252,74,211,197,1,27,129,141,
+2,172,2,1,16,1,25,197,209,70,248,141,37,47,155,49,41,114,131,6,35,60,60,45,
+49,59,59,49,4,154,254,73,254,0,188,254,248,135,49,141,29,213,209,2,17,1,170,
+1,155,254,215,129,197,254,252,254,254,16,213,203,254,244,254,232,65,242,237,
+135,125,6,88,106,248,254,237,1,9,254,247,1,19,248,2,2,231,158,96,254,232,
+207,254,151,238,1,22,253,252,1,105,207,1,24,96,158,253,55,143,84,137,78,74,
+95,163,113,211,139,76,252,183,58,57,55,60,60,55,57,58,0,3,0,143,254,100,9,
+229,4,219,0,10,0,60,0,72,0,0,0,17,16,19,7,2,17,52,18,55,23,4,19,54,51,50,
+22,21,16,3,39,54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,
+23,6,2,21,16,33,50,54,3,51,2,33,32,17,52,2,39,55,2,22,21,20,6,35,34,38,53,
+52,54,51,1,47,191,150,201,111,123,117,5,221,123,55,55,146,159,170,120,127,
+68,74,28,31,20,239,203,254,235,90,8,90,254,238,203,240,1,252,74,211,197,1,
+27,129,141,2,172,2,1,17,1,24,196,209,69,252,60,60,45,49,59,59,49,3,131,254,
+205,254,190,254,242,98,1,49,1,117,190,1,57,160,80,63,254,254,16,213,203,254,
+244,254,232,65,242,237,135,125,6,88,106,248,254,237,1,9,254,247,1,19,248,
+2,2,231,158,96,254,232,207,254,151,238,1,22,253,252,1,105,207,1,24,96,158,
+250,111,58,57,55,60,60,55,57,58,0,4,0,113,254,100,11,86,4,219,0,10,0,60,0,
+72,0,84,0,0,0,17,16,19,7,2,17,52,18,55,23,4,19,54,51,50,22,21,16,3,39,54,
+53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,
+50,54,3,51,2,33,32,17,52,2,39,55,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,
+20,6,35,34,38,53,52,54,51,2,160,190,149,201,111,122,117,5,221,123,56,55,145,
+160,170,121,127,67,74,29,31,21,240,202,254,235,90,8,90,254,237,202,240,1,
+252,74,211,197,1,27,129,141,2,172,2,1,16,1,25,197,209,70,249,20,37,47,155,
+49,41,114,131,5,156,59,59,45,49,60,60,49,3,131,254,205,254,190,254,242,98,
+1,49,1,117,190,1,57,160,80,63,254,254,16,213,203,254,244,254,232,65,242,237,
+135,125,6,88,106,248,254,237,1,9,254,247,1,19,248,2,2,231,158,96,254,232,
+207,254,151,238,1,22,253,252,1,105,207,1,24,96,158,253,244,144,83,138,78,
+73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,0,3,0,113,254,
+100,9,217,6,143,0,21,0,71,0,83,0,0,0,33,32,37,0,17,20,18,23,7,38,2,53,16,
+18,55,4,33,32,36,55,21,0,19,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,22,
+21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,50,54,3,51,2,33,32,
+17,52,2,39,55,2,22,21,20,6,35,34,38,53,52,54,51,7,70,253,172,254,168,254,
+225,254,151,78,88,147,92,88,227,235,1,89,1,90,1,43,1,209,213,254,251,123,
+56,55,145,160,170,121,127,67,74,29,30,20,240,202,254,235,90,8,90,254,237,
+202,240,1,252,74,211,197,1,27,129,141,2,172,2,1,16,1,25,197,209,70,252,60,
+60,45,49,59,59,49,5,111,51,254,149,254,43,184,254,223,151,84,157,1,78,203,
+1,39,1,227,236,54,60,63,161,254,94,254,254,16,213,203,254,244,254,232,65,
+242,237,135,125,6,88,106,248,254,237,1,9,254,247,1,19,248,2,2,231,158,96,
+254,232,207,254,151,238,1,22,253,252,1,105,207,1,24,96,158,250,111,58,57,
+55,60,60,55,57,58,0,0,4,0,113,254,100,11,74,6,143,0,21,0,71,0,83,0,95,0,0,
+0,33,32,37,0,17,20,18,23,7,38,2,53,16,18,55,4,33,32,36,55,21,0,19,54,51,50,
+22,21,16,3,39,54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,
+23,6,2,21,16,33,50,54,3,51,2,33,32,17,52,2,39,55,0,21,20,22,23,7,38,38,53,
+52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,8,182,253,172,254,168,254,226,
+254,151,78,88,147,93,88,228,235,1,88,1,90,1,43,1,209,213,254,252,123,55,56,
+145,160,170,121,127,68,73,29,31,21,240,203,254,236,90,8,91,254,238,203,239,
+1,252,73,211,196,1,26,129,142,2,172,2,1,16,1,25,197,209,70,249,32,37,47,155,
+49,41,114,131,5,144,59,59,45,49,60,60,49,5,111,51,254,149,254,43,184,254,
+223,151,84,157,1,78,203,1,39,1,227,236,54,60,63,161,254,94,254,254,16,213,
+203,254,244,254,232,65,242,237,135,125,6,88,106,248,254,237,1,9,254,247,1,
+19,248,2,2,231,158,96,254,232,207,254,151,238,1,22,253,252,1,105,207,1,24,
+96,158,253,244,144,83,138,78,73,94,164,112,211,140,76,251,250,58,57,55,60,
+60,55,57,58,0,3,0,143,254,100,10,68,4,221,0,17,0,67,0,79,0,0,0,17,20,2,6,
+35,34,39,55,22,51,50,54,54,53,16,3,55,4,19,54,51,50,22,21,16,3,39,54,53,52,
+38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,50,54,
+3,51,2,33,32,17,52,2,39,55,2,22,21,20,6,35,34,38,53,52,54,51,10,68,129,230,
+141,98,66,74,43,55,94,146,82,232,148,252,223,123,55,55,146,159,169,121,127,
+68,74,28,31,20,239,203,254,236,91,8,90,254,238,203,240,1,252,74,211,197,1,
+27,129,141,2,172,2,1,17,1,24,196,209,69,251,59,59,46,49,59,59,49,3,117,253,
+231,213,254,191,174,49,141,29,133,250,170,1,205,1,90,84,145,254,254,16,213,
+203,254,244,254,232,65,242,237,135,125,6,88,106,248,254,237,1,9,254,247,1,
+19,248,2,2,231,158,96,254,232,207,254,151,238,1,22,253,252,1,105,207,1,24,
+96,158,250,111,58,57,55,60,60,55,57,58,0,0,4,0,113,254,100,11,180,4,221,0,
+17,0,67,0,79,0,91,0,0,0,17,20,2,6,35,34,39,55,22,51,50,54,54,53,16,3,55,4,
+19,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,
+34,2,53,16,37,23,6,2,21,16,33,50,54,3,51,2,33,32,17,52,2,39,55,0,21,20,22,
+23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,11,180,129,229,141,
+99,65,73,43,56,94,145,82,231,147,252,224,122,56,55,145,160,170,121,127,67,
+74,29,30,20,240,202,254,235,90,8,90,254,237,202,240,1,252,74,211,197,1,27,
+129,141,2,172,2,1,16,1,25,197,209,70,250,186,37,47,155,49,41,114,131,3,246,
+60,60,45,49,59,59,49,3,117,253,231,213,254,191,174,49,141,29,133,250,170,
+1,205,1,90,84,145,254,254,16,213,203,254,244,254,232,65,242,237,135,125,6,
+88,106,248,254,237,1,9,254,247,1,19,248,2,2,231,158,96,254,232,207,254,151,
+238,1,22,253,252,1,105,207,1,24,96,158,253,244,144,83,138,78,73,94,164,112,
+211,140,76,251,250,58,57,55,60,60,55,57,58,0,3,0,143,254,100,10,252,4,219,
+0,49,0,85,0,97,0,0,0,19,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,22,21,
+20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,50,54,3,51,2,33,32,17,
+52,2,39,55,4,51,50,22,21,20,7,22,18,21,20,6,6,35,34,39,55,22,51,50,54,53,
+52,39,6,7,39,62,2,53,52,35,34,7,39,0,22,21,20,6,35,34,38,53,52,54,51,6,37,
+123,55,55,146,159,169,121,127,68,74,28,31,20,239,203,254,236,91,8,90,254,
+238,203,240,1,252,74,211,197,1,27,129,141,2,172,2,1,17,1,24,196,209,69,4,
+72,170,135,146,127,65,72,123,217,139,99,65,74,43,55,139,162,102,74,99,88,
+138,149,66,111,106,109,92,251,70,59,59,46,49,59,59,49,4,76,254,254,16,213,
+203,254,244,254,232,65,242,237,135,125,6,88,106,248,254,237,1,9,254,247,1,
+19,248,2,2,231,158,96,254,232,207,254,151,238,1,22,253,252,1,105,207,1,24,
+96,158,22,160,125,150,129,112,254,239,122,166,230,114,49,141,29,172,177,212,
+183,56,61,145,80,117,104,62,121,86,139,250,244,58,57,55,60,60,55,57,58,0,
+4,0,113,254,100,12,109,4,219,0,49,0,85,0,97,0,109,0,0,0,19,54,51,50,22,21,
+16,3,39,54,53,52,38,35,34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,
+2,21,16,33,50,54,3,51,2,33,32,17,52,2,39,55,4,51,50,22,21,20,7,22,18,21,20,
+6,6,35,34,39,55,22,51,50,54,53,52,39,6,7,39,62,2,53,52,35,34,7,39,0,21,20,
+22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,7,150,122,56,
+55,145,160,170,121,127,67,74,29,30,20,240,202,254,235,90,8,90,254,237,202,
+240,1,252,74,211,197,1,27,129,141,2,172,2,1,16,1,25,197,209,70,4,72,170,135,
+145,127,66,72,123,217,140,98,66,74,43,56,139,162,103,74,98,88,137,150,65,
+110,107,108,92,246,251,37,47,155,49,41,114,131,3,246,60,60,45,49,59,59,49,
+4,76,254,254,16,213,203,254,244,254,232,65,242,237,135,125,6,88,106,248,254,
+237,1,9,254,247,1,19,248,2,2,231,158,96,254,232,207,254,151,238,1,22,253,
+252,1,105,207,1,24,96,158,22,160,125,150,129,112,254,239,122,166,230,114,
+49,141,29,172,177,212,183,56,61,145,80,117,104,62,121,86,139,254,121,144,
+83,138,78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,1,0,
+143,255,150,8,63,4,219,0,49,0,0,0,19,54,51,50,22,21,16,3,39,54,53,52,38,35,
+34,7,22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,50,54,3,51,
+2,33,32,17,52,2,39,55,6,37,123,55,55,146,159,169,121,127,68,74,28,31,20,239,
+203,254,236,91,8,90,254,238,203,240,1,252,74,211,197,1,27,129,141,2,172,2,
+1,17,1,24,196,209,69,4,76,254,254,16,213,203,254,244,254,232,65,242,237,135,
+125,6,88,106,248,254,237,1,9,254,247,1,19,248,2,2,231,158,96,254,232,207,
+254,151,238,1,22,253,252,1,105,207,1,24,96,158,255,255,0,113,255,150,9,176,
+4,219,16,34,5,153,0,0,16,3,1,130,1,113,0,0,255,255,0,113,255,150,11,83,4,
+219,16,34,5,154,0,0,16,3,1,130,3,20,0,0,0,1,0,143,255,221,9,236,4,219,0,65,
+0,0,0,21,20,6,7,39,38,2,39,7,22,21,20,3,39,54,53,52,35,34,7,22,21,20,2,35,
+32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,50,54,3,51,2,33,32,17,52,2,39,
+55,4,23,54,51,32,19,23,54,53,52,39,55,9,236,97,110,158,39,90,66,4,56,66,141,
+43,82,23,20,24,239,203,254,236,91,8,90,254,238,203,240,1,252,74,211,197,1,
+27,129,141,2,172,2,1,17,1,24,196,209,69,1,60,121,92,110,1,60,71,7,88,49,167,
+3,39,137,150,250,149,51,244,1,2,49,6,88,168,232,254,248,31,250,254,219,12,
+99,110,248,254,237,1,9,254,247,1,19,248,2,2,231,158,96,254,232,207,254,151,
+238,1,22,253,252,1,105,207,1,24,96,158,143,252,43,253,176,2,164,166,127,131,
+57,255,255,0,113,255,221,11,93,4,219,16,34,5,153,0,0,16,3,1,133,1,113,0,0,
+255,255,0,113,255,158,13,0,4,219,16,34,5,154,0,0,16,3,1,133,3,20,0,0,255,
+255,0,143,255,156,12,244,4,219,16,34,1,133,0,0,16,3,5,157,10,72,0,0,255,255,
+0,113,255,156,14,100,4,219,16,34,5,153,0,0,16,35,1,133,1,113,0,0,16,3,5,157,
+11,184,0,0,255,255,0,113,254,33,11,93,4,219,16,34,5,153,0,0,16,35,1,133,1,
+113,0,0,16,3,5,190,5,45,0,0,255,255,255,254,254,152,12,150,6,53,16,34,5,158,
+0,0,16,3,1,133,2,170,0,0,255,255,0,113,254,152,13,138,6,53,16,35,5,158,0,
+203,0,0,16,35,5,153,0,0,255,68,16,3,1,133,3,158,0,0,255,255,0,143,255,158,
+11,146,4,219,16,34,5,159,0,0,16,3,1,133,1,166,0,0,255,255,0,113,255,158,13,
+3,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,1,133,3,23,0,0,255,255,
+0,113,255,158,11,134,6,143,16,34,5,163,0,0,16,3,1,133,1,154,0,0,255,255,0,
+113,255,158,12,246,6,143,16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,1,133,
+3,10,0,0,255,255,0,143,254,152,11,160,4,221,16,34,1,133,0,0,16,3,5,161,9,
+254,0,0,255,255,0,113,254,152,13,17,4,221,16,34,5,153,0,0,16,35,1,133,1,113,
+0,0,16,3,5,161,11,111,0,0,255,255,0,143,254,152,12,162,4,219,16,34,1,133,
+0,0,16,3,5,162,10,72,0,0,255,255,0,113,254,152,14,18,4,219,16,34,5,153,0,
+0,16,35,1,133,1,113,0,0,16,3,5,162,11,184,0,0,255,255,0,143,255,150,11,78,
+4,219,16,34,1,130,0,0,16,3,5,157,8,162,0,0,255,255,0,113,255,150,12,190,4,
+219,16,34,5,153,0,0,16,35,1,130,1,113,0,0,16,3,5,157,10,18,0,0,255,255,0,
+113,254,33,9,176,4,219,16,34,5,153,0,0,16,35,1,130,1,113,0,0,16,3,5,190,5,
+45,0,0,255,255,255,254,254,152,10,233,6,53,16,34,5,158,0,0,16,3,1,130,2,170,
+0,0,255,255,0,113,254,152,11,221,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,
+0,255,68,16,3,1,130,3,158,0,0,255,255,0,143,255,150,9,229,4,219,16,34,5,159,
+0,0,16,3,1,130,1,166,0,0,255,255,0,113,255,150,11,86,4,219,16,34,5,153,0,
+0,16,35,5,159,1,113,0,0,16,3,1,130,3,23,0,0,255,255,0,113,255,150,9,217,6,
+143,16,34,5,163,0,0,16,3,1,130,1,154,0,0,255,255,0,113,255,150,11,73,6,143,
+16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,1,130,3,10,0,0,255,255,0,143,254,
+152,10,19,4,221,16,34,1,130,0,0,16,3,5,161,8,113,0,0,255,255,0,113,254,152,
+11,131,4,221,16,34,5,153,0,0,16,35,1,130,1,113,0,0,16,3,5,161,9,225,0,0,255,
+255,0,143,254,152,10,252,4,219,16,34,1,130,0,0,16,3,5,162,8,162,0,0,255,255,
+0,113,254,152,12,108,4,219,16,34,5,153,0,0,16,35,1,130,1,113,0,0,16,3,5,162,
+10,18,0,0,0,1,0,143,255,231,9,33,4,219,0,55,0,0,0,21,20,6,7,39,2,2,35,35,
+22,21,20,2,35,32,3,35,2,33,34,2,53,16,37,23,6,2,21,16,33,50,54,3,51,2,33,
+32,17,52,2,39,55,4,23,54,51,50,18,19,23,54,53,52,39,55,9,33,96,111,174,45,
+111,61,4,32,239,203,254,236,91,8,90,254,238,203,240,1,252,74,211,197,1,27,
+129,141,2,172,2,1,17,1,24,196,209,69,1,35,127,27,39,129,160,51,6,88,49,168,
+3,37,137,150,250,149,57,1,14,1,31,106,129,248,254,237,1,9,254,247,1,19,248,
+2,2,231,158,96,254,232,207,254,151,238,1,22,253,252,1,105,207,1,24,96,158,
+131,227,8,254,233,254,195,2,164,166,127,131,57,255,255,0,113,255,231,10,146,
+4,219,16,34,5,153,0,0,16,3,1,162,1,113,0,0,255,255,0,113,255,158,12,53,4,
+219,16,34,5,154,0,0,16,3,1,162,3,20,0,0,255,255,0,143,255,156,12,41,4,219,
+16,34,1,162,0,0,16,3,5,157,9,125,0,0,255,255,0,113,255,156,13,154,4,219,16,
+34,5,153,0,0,16,35,1,162,1,113,0,0,16,3,5,157,10,238,0,0,255,255,0,113,254,
+33,10,146,4,219,16,34,5,153,0,0,16,35,1,162,1,113,0,0,16,3,5,190,5,45,0,0,
+255,255,255,254,254,152,11,203,6,53,16,34,5,158,0,0,16,3,1,162,2,170,0,0,
+255,255,0,113,254,152,12,191,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,
+68,16,3,1,162,3,158,0,0,255,255,0,143,255,158,10,199,4,219,16,34,5,159,0,
+0,16,3,1,162,1,166,0,0,255,255,0,113,255,158,12,56,4,219,16,34,5,153,0,0,
+16,35,5,159,1,113,0,0,16,3,1,162,3,23,0,0,255,255,0,113,255,158,10,187,6,
+143,16,34,5,163,0,0,16,3,1,162,1,154,0,0,255,255,0,113,255,158,12,43,6,143,
+16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,1,162,3,10,0,0,255,255,0,143,254,
+152,10,213,4,221,16,34,1,162,0,0,16,3,5,161,9,51,0,0,255,255,0,113,254,152,
+12,70,4,221,16,34,5,153,0,0,16,35,1,162,1,113,0,0,16,3,5,161,10,164,0,0,255,
+255,0,143,254,152,11,215,4,219,16,34,1,162,0,0,16,3,5,162,9,125,0,0,255,255,
+0,113,254,152,13,72,4,219,16,34,5,153,0,0,16,35,1,162,1,113,0,0,16,3,5,162,
+10,238,0,0,255,255,0,143,255,156,10,35,4,219,16,34,1,111,0,0,16,3,5,157,7,
+119,0,0,255,255,0,113,255,156,11,147,4,219,16,34,5,153,0,0,16,35,1,111,1,
+113,0,0,16,3,5,157,8,231,0,0,255,255,0,113,254,33,8,88,4,219,16,34,5,153,
+0,0,16,35,1,111,1,113,0,0,16,3,5,190,5,45,0,0,255,255,255,254,254,152,9,145,
+6,53,16,34,5,158,0,0,16,3,1,111,2,170,0,0,255,255,0,113,254,152,10,133,6,
+53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,1,111,3,158,0,0,255,
+255,0,143,255,158,8,141,4,219,16,34,5,159,0,0,16,3,1,111,1,166,0,0,255,255,
+0,113,255,158,9,254,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,1,111,
+3,23,0,0,255,255,0,113,255,158,8,195,6,143,16,34,5,163,0,0,16,3,1,111,1,154,
+0,0,255,255,0,113,255,158,10,52,6,143,16,34,5,153,0,0,16,35,5,163,1,113,0,
+0,16,3,1,111,3,10,0,0,255,255,0,143,254,152,8,168,4,221,16,34,1,111,0,0,16,
+3,5,161,7,6,0,0,255,255,0,113,254,152,10,25,4,221,16,34,5,153,0,0,16,35,1,
+111,1,113,0,0,16,3,5,161,8,119,0,0,255,255,0,143,254,152,9,168,4,219,16,34,
+1,111,0,0,16,3,5,162,7,78,0,0,255,255,0,113,254,152,11,24,4,219,16,34,5,153,
+0,0,16,35,1,111,1,113,0,0,16,3,5,162,8,190,0,0,0,3,0,55,255,231,7,63,4,219,
+0,31,0,38,0,45,0,0,1,22,21,20,2,35,32,3,35,2,33,34,2,53,52,55,35,53,51,18,
+37,23,4,7,33,38,37,55,4,19,51,21,4,21,16,33,50,19,33,0,51,32,17,52,39,33,
+6,229,2,239,203,254,236,91,8,90,254,238,203,240,2,90,117,94,1,129,74,254,
+219,80,4,180,79,254,221,69,1,131,97,116,249,254,1,27,250,16,253,221,2,230,
+250,1,24,2,253,221,2,59,24,49,248,254,237,1,9,254,247,1,19,248,49,24,154,
+1,86,176,158,135,225,225,135,158,176,254,170,154,22,47,254,151,1,174,254,
+82,1,105,47,22,255,255,0,113,255,231,8,176,4,219,16,34,5,153,0,0,16,3,1,191,
+1,113,0,0,255,255,0,113,255,158,10,83,4,219,16,34,5,154,0,0,16,3,1,191,3,
+20,0,0,0,3,0,55,255,231,9,33,4,219,0,49,0,56,0,63,0,0,0,21,20,6,7,39,2,2,
+35,35,22,21,20,2,35,32,3,35,2,33,34,2,53,52,55,35,53,51,18,37,23,4,7,33,38,
+37,55,4,23,54,51,50,18,19,23,54,53,52,39,55,0,21,16,33,50,19,33,0,51,32,17,
+52,39,33,9,33,96,111,174,45,111,61,4,32,239,203,254,236,91,8,90,254,238,203,
+240,2,90,117,94,1,129,74,254,219,80,4,180,79,254,221,69,1,35,127,27,39,129,
+160,51,6,88,49,168,248,73,1,27,250,16,253,221,2,230,250,1,24,2,253,221,3,
+37,137,150,250,149,57,1,14,1,31,106,129,248,254,237,1,9,254,247,1,19,248,
+49,24,154,1,86,176,158,135,225,225,135,158,131,227,8,254,233,254,195,2,164,
+166,127,131,57,254,121,47,254,151,1,174,254,82,1,105,47,22,255,255,0,113,
+255,231,10,146,4,219,16,34,5,153,0,0,16,3,1,194,1,113,0,0,255,255,0,113,255,
+158,12,53,4,219,16,34,5,154,0,0,16,3,1,194,3,20,0,0,255,255,0,55,255,156,
+12,41,4,219,16,34,1,194,0,0,16,3,5,157,9,125,0,0,255,255,0,113,255,156,13,
+154,4,219,16,34,5,153,0,0,16,35,1,194,1,113,0,0,16,3,5,157,10,238,0,0,255,
+255,0,113,254,33,10,146,4,219,16,34,5,153,0,0,16,35,1,194,1,113,0,0,16,3,
+5,190,5,45,0,0,255,255,255,254,254,152,11,244,6,53,16,34,5,158,0,0,16,3,1,
+194,2,211,0,0,255,255,0,113,254,152,12,191,6,53,16,35,5,158,0,203,0,0,16,
+35,5,153,0,0,255,68,16,3,1,194,3,158,0,0,255,255,0,143,255,158,11,35,4,219,
+16,34,5,159,0,0,16,3,1,194,2,2,0,0,255,255,0,113,255,158,12,148,4,219,16,
+34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,1,194,3,115,0,0,255,255,0,113,255,
+158,10,187,6,143,16,34,5,163,0,0,16,3,1,194,1,154,0,0,255,255,0,113,255,158,
+12,43,6,143,16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,1,194,3,10,0,0,255,
+255,0,55,254,152,10,213,4,221,16,34,1,194,0,0,16,3,5,161,9,51,0,0,255,255,
+0,113,254,152,12,70,4,221,16,34,5,153,0,0,16,35,1,194,1,113,0,0,16,3,5,161,
+10,164,0,0,255,255,0,55,254,152,11,215,4,219,16,34,1,194,0,0,16,3,5,162,9,
+125,0,0,255,255,0,113,254,152,13,72,4,219,16,34,5,153,0,0,16,35,1,194,1,113,
+0,0,16,3,5,162,10,238,0,0,255,255,0,55,255,156,10,35,4,219,16,34,1,191,0,
+0,16,3,5,157,7,119,0,0,255,255,0,113,255,156,11,147,4,219,16,34,5,153,0,0,
+16,35,1,191,1,113,0,0,16,3,5,157,8,231,0,0,255,255,0,113,254,33,8,176,4,219,
+16,34,5,153,0,0,16,35,1,191,1,113,0,0,16,3,5,190,5,45,0,0,255,255,255,254,
+254,152,10,18,6,53,16,34,5,158,0,0,16,3,1,191,2,211,0,0,255,255,0,113,254,
+152,10,221,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,1,191,3,
+158,0,0,255,255,0,143,255,158,9,65,4,219,16,34,5,159,0,0,16,3,1,191,2,2,0,
+0,255,255,0,113,255,158,10,178,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,
+0,16,3,1,191,3,115,0,0,255,255,0,113,255,158,8,217,6,143,16,34,5,163,0,0,
+16,3,1,191,1,154,0,0,255,255,0,113,255,158,10,73,6,143,16,34,5,153,0,0,16,
+35,5,163,1,113,0,0,16,3,1,191,3,10,0,0,255,255,0,55,254,152,8,219,4,221,16,
+34,1,191,0,0,16,3,5,161,7,57,0,0,255,255,0,113,254,152,10,76,4,221,16,34,
+5,153,0,0,16,35,1,191,1,113,0,0,16,3,5,161,8,170,0,0,255,255,0,55,254,152,
+9,209,4,219,16,34,1,191,0,0,16,3,5,162,7,119,0,0,255,255,0,113,254,152,11,
+65,4,219,16,34,5,153,0,0,16,35,1,191,1,113,0,0,16,3,5,162,8,231,0,0,0,2,0,
+72,255,227,5,102,4,190,0,40,0,47,0,0,0,35,34,6,21,21,51,21,35,21,20,6,35,
+34,38,53,53,35,53,51,53,52,38,35,34,7,53,54,51,50,22,21,21,33,53,52,54,51,
+50,23,21,1,21,16,51,50,17,53,5,43,47,74,69,249,249,215,191,188,215,252,252,
+70,74,49,59,47,63,148,166,1,209,163,150,63,45,252,138,231,234,4,25,97,106,
+129,154,155,199,238,238,199,155,154,129,106,97,25,172,18,196,172,129,129,
+174,194,18,174,254,53,155,254,241,1,15,155,255,255,0,113,255,227,6,215,4,
+190,16,34,5,153,0,0,16,3,1,223,1,113,0,0,255,255,0,113,255,158,8,122,4,219,
+16,34,5,154,0,0,16,3,1,223,3,20,0,0,255,255,0,72,254,100,5,233,4,190,16,34,
+1,242,0,0,16,3,5,188,2,215,0,0,0,4,0,113,254,100,7,90,4,190,0,48,0,60,0,67,
+0,79,0,0,0,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,
+38,35,34,7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,
+51,36,21,20,22,23,7,38,38,53,52,55,23,1,21,16,51,50,17,53,2,22,21,20,6,35,
+34,38,53,52,54,51,7,90,170,121,127,174,43,215,190,189,215,252,252,69,74,49,
+60,47,64,147,166,1,209,164,149,64,45,59,47,74,70,43,251,10,37,47,155,49,41,
+114,131,1,250,232,233,186,59,59,45,49,60,60,49,2,205,254,67,254,244,254,232,
+65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,172,18,196,172,
+129,129,174,194,18,174,27,97,106,129,2,144,83,138,78,73,94,164,112,211,140,
+76,254,227,155,254,241,1,15,155,253,23,58,57,55,60,60,55,57,58,0,0,5,0,113,
+254,100,8,254,4,219,0,10,0,59,0,71,0,78,0,90,0,0,0,17,20,2,7,39,18,17,16,
+3,55,0,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,
+35,34,7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,
+36,21,20,22,23,7,38,38,53,52,55,23,1,21,16,51,50,17,53,2,22,21,20,6,35,34,
+38,53,52,54,51,2,215,111,122,117,190,190,149,6,240,170,121,127,174,43,215,
+190,189,215,252,252,70,73,49,60,47,64,147,166,1,209,164,149,64,45,60,47,73,
+70,43,249,102,37,47,155,49,41,114,131,3,158,232,233,186,59,59,45,50,59,59,
+50,3,170,254,139,190,254,198,159,80,1,8,1,51,1,65,1,15,98,253,242,254,67,
+254,244,254,232,65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,
+172,18,196,172,129,129,174,194,18,174,27,97,106,129,2,144,83,138,78,73,94,
+164,112,211,140,76,254,227,155,254,241,1,15,155,253,23,58,57,55,60,60,55,
+57,58,0,4,0,72,254,100,8,248,4,190,0,48,0,68,0,75,0,87,0,0,0,17,16,3,39,54,
+53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,35,34,7,53,54,51,50,
+22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,36,21,20,18,23,7,0,17,
+52,18,55,51,22,22,23,7,38,38,39,35,1,21,16,51,50,17,53,2,22,21,20,6,35,34,
+38,53,52,54,51,5,233,170,120,127,174,43,215,191,188,215,252,252,70,74,49,
+59,47,63,148,166,1,209,163,150,63,45,59,47,74,69,43,2,124,117,119,131,254,
+248,112,125,211,13,106,76,129,76,98,17,8,250,64,231,234,187,60,60,45,49,59,
+59,49,2,205,254,67,254,244,254,232,65,242,237,1,39,155,199,238,238,199,155,
+154,129,106,97,25,172,18,196,172,129,129,174,194,18,174,27,97,106,129,123,
+250,146,254,218,134,116,1,55,1,111,176,1,34,148,123,244,86,100,90,223,113,
+254,10,155,254,241,1,15,155,253,23,58,57,55,60,60,55,57,58,0,5,0,113,254,
+100,10,104,4,190,0,48,0,68,0,80,0,87,0,99,0,0,0,17,16,3,39,54,53,16,35,35,
+21,20,6,35,34,38,53,53,35,53,51,53,52,38,35,34,7,53,54,51,50,22,21,21,33,
+53,52,54,51,50,23,21,38,35,34,6,21,21,51,36,21,20,18,23,7,0,17,52,18,55,51,
+22,22,23,7,38,38,39,35,0,21,20,22,23,7,38,38,53,52,55,23,1,21,16,51,50,17,
+53,2,22,21,20,6,35,34,38,53,52,54,51,7,90,170,121,127,174,43,215,190,189,
+215,252,252,69,74,49,60,47,64,147,166,1,209,164,149,64,45,59,47,74,70,43,
+2,125,117,119,131,254,247,113,125,211,12,107,75,129,75,99,16,8,247,241,37,
+47,155,49,41,114,131,1,250,232,233,186,59,59,45,49,60,60,49,2,205,254,67,
+254,244,254,232,65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,
+172,18,196,172,129,129,174,194,18,174,27,97,106,129,123,250,146,254,218,134,
+116,1,55,1,111,176,1,34,148,123,244,86,100,90,223,113,254,166,144,83,138,
+78,73,94,164,112,211,140,76,254,227,155,254,241,1,15,155,253,23,58,57,55,
+60,60,55,57,58,0,5,0,113,252,174,7,90,4,190,0,48,0,60,0,67,0,79,0,93,0,0,
+0,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,35,34,
+7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,36,21,
+20,22,23,7,38,38,53,52,55,23,1,21,16,51,50,17,53,2,6,35,34,38,53,52,54,51,
+50,22,21,2,51,50,23,7,38,35,34,7,39,19,23,7,23,7,90,170,121,127,174,43,215,
+190,189,215,252,252,69,74,49,60,47,64,147,166,1,209,164,149,64,45,59,47,74,
+70,43,251,10,37,47,155,49,41,114,131,1,250,232,233,127,59,45,49,60,60,49,
+45,59,164,156,139,117,59,107,149,148,115,131,189,114,124,4,2,205,254,67,254,
+244,254,232,65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,172,
+18,196,172,129,129,174,194,18,174,27,97,106,129,2,144,83,138,78,73,94,164,
+112,211,140,76,254,227,155,254,241,1,15,155,252,109,60,60,55,57,58,58,57,
+254,172,53,160,62,58,84,1,41,74,170,4,0,0,4,255,254,254,100,8,188,6,53,0,
+20,0,69,0,76,0,88,0,0,19,0,17,20,2,6,35,34,39,55,22,51,50,54,53,16,9,2,7,
+39,0,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,35,
+34,7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,5,21,
+16,51,50,17,53,2,22,21,20,6,35,34,38,53,52,54,51,223,1,166,115,200,129,99,
+65,74,43,55,121,145,254,35,1,115,1,98,105,233,7,59,170,120,127,175,43,215,
+190,188,215,252,252,70,74,51,57,47,63,148,166,1,208,164,150,63,45,59,47,74,
+70,43,253,89,231,233,186,59,59,45,49,60,60,49,4,154,254,73,254,0,188,254,
+248,135,49,141,29,213,209,2,17,1,170,1,155,254,215,129,197,253,125,254,67,
+254,244,254,232,65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,
+172,18,196,172,129,129,174,194,18,174,27,97,106,129,154,155,254,241,1,15,
+155,253,23,58,57,55,60,60,55,57,58,0,0,5,0,113,254,100,9,135,6,53,0,20,0,
+69,0,81,0,88,0,100,0,0,1,0,17,20,2,6,35,34,39,55,22,51,50,54,53,16,9,2,7,
+39,0,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,35,
+34,7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,4,21,
+20,22,23,7,38,38,53,52,55,23,5,21,16,51,50,17,53,2,22,21,20,6,35,34,38,53,
+52,54,51,1,170,1,166,115,201,129,98,65,73,43,56,120,146,254,35,1,114,1,99,
+105,233,7,59,170,121,127,174,43,215,190,189,215,252,252,69,74,51,58,47,64,
+147,166,1,209,164,150,63,45,59,47,74,70,43,248,221,37,47,155,49,41,114,131,
+4,39,232,233,186,59,59,45,49,60,60,49,4,154,254,73,254,0,188,254,248,135,
+49,141,29,213,209,2,17,1,170,1,155,254,215,129,197,253,125,254,67,254,244,
+254,232,65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,172,18,
+196,172,129,129,174,194,18,174,27,97,106,129,187,143,84,137,78,74,95,163,
+113,211,139,76,96,155,254,241,1,15,155,253,23,58,57,55,60,60,55,57,58,0,0,
+4,0,143,254,100,7,236,4,219,0,10,0,59,0,66,0,78,0,0,0,17,16,19,7,2,17,52,
+18,55,23,0,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,
+38,35,34,7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,
+51,5,21,16,51,50,17,53,2,22,21,20,6,35,34,38,53,52,54,51,1,47,191,150,201,
+111,123,117,5,254,170,121,127,174,43,215,191,188,215,252,252,70,74,49,59,
+47,63,148,166,1,209,163,150,63,45,59,47,74,69,43,253,88,231,234,187,60,60,
+45,49,59,59,49,3,131,254,205,254,190,254,242,98,1,49,1,117,190,1,57,160,80,
+254,66,254,67,254,244,254,232,65,242,237,1,39,155,199,238,238,199,155,154,
+129,106,97,25,172,18,196,172,129,129,174,194,18,174,27,97,106,129,154,155,
+254,241,1,15,155,253,23,58,57,55,60,60,55,57,58,0,5,0,113,254,100,9,92,4,
+219,0,10,0,59,0,71,0,78,0,90,0,0,0,17,16,19,7,2,17,52,18,55,23,0,17,16,3,
+39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,35,34,7,53,54,
+51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,36,21,20,22,23,
+7,38,38,53,52,55,23,1,21,16,51,50,17,53,2,22,21,20,6,35,34,38,53,52,54,51,
+2,160,190,149,201,111,122,117,5,254,170,121,127,174,43,215,190,189,215,252,
+252,69,74,49,60,47,64,147,166,1,209,164,150,63,45,59,47,74,70,43,249,8,37,
+47,155,49,41,114,131,3,252,232,233,186,59,59,45,49,60,60,49,3,131,254,205,
+254,190,254,242,98,1,49,1,117,190,1,57,160,80,254,66,254,67,254,244,254,232,
+65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,172,18,196,172,
+129,129,174,194,18,174,27,97,106,129,2,144,83,138,78,73,94,164,112,211,140,
+76,254,227,155,254,241,1,15,155,253,23,58,57,55,60,60,55,57,58,255,255,0,
+113,254,100,7,172,6,111,16,34,5,160,0,0,16,35,5,188,4,154,0,0,16,3,1,242,
+1,195,0,0,255,255,0,113,254,100,9,28,6,111,16,34,5,153,0,0,16,35,5,160,1,
+113,0,0,16,35,5,188,6,10,0,0,16,3,1,242,3,51,0,0,0,4,0,72,254,100,8,31,4,
+221,0,17,0,66,0,73,0,85,0,0,0,17,20,2,6,35,34,39,55,22,51,50,54,54,53,16,
+3,55,0,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,
+35,34,7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,
+5,21,16,51,50,17,53,2,22,21,20,6,35,34,38,53,52,54,51,8,31,129,230,141,98,
+66,74,43,55,94,146,82,232,148,254,200,170,120,127,174,43,215,191,188,215,
+252,252,70,74,49,59,47,63,148,166,1,209,163,150,63,45,59,47,74,69,43,253,
+88,231,234,187,60,60,45,49,59,59,49,3,117,253,231,213,254,191,174,49,141,
+29,133,250,170,1,205,1,90,84,253,240,254,67,254,244,254,232,65,242,237,1,
+39,155,199,238,238,199,155,154,129,106,97,25,172,18,196,172,129,129,174,194,
+18,174,27,97,106,129,154,155,254,241,1,15,155,253,23,58,57,55,60,60,55,57,
+58,0,0,5,0,113,254,100,9,143,4,221,0,17,0,66,0,78,0,85,0,97,0,0,0,17,20,2,
+6,35,34,39,55,22,51,50,54,54,53,16,3,55,0,17,16,3,39,54,53,16,35,35,21,20,
+6,35,34,38,53,53,35,53,51,53,52,38,35,34,7,53,54,51,50,22,21,21,33,53,52,
+54,51,50,23,21,38,35,34,6,21,21,51,36,21,20,22,23,7,38,38,53,52,55,23,1,21,
+16,51,50,17,53,2,22,21,20,6,35,34,38,53,52,54,51,9,143,129,229,141,99,65,
+74,43,55,94,145,82,231,147,254,201,170,121,127,174,43,215,190,189,215,252,
+252,69,74,49,60,47,64,147,166,1,209,164,149,64,45,59,47,74,70,43,251,10,37,
+47,155,49,41,114,131,1,250,232,233,186,59,59,45,49,60,60,49,3,117,253,231,
+213,254,191,174,49,141,29,133,250,170,1,205,1,90,84,253,240,254,67,254,244,
+254,232,65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,172,18,
+196,172,129,129,174,194,18,174,27,97,106,129,2,144,83,138,78,73,94,164,112,
+211,140,76,254,227,155,254,241,1,15,155,253,23,58,57,55,60,60,55,57,58,0,
+0,4,0,72,254,100,8,166,4,197,0,35,0,84,0,91,0,103,0,0,0,51,50,22,21,20,7,
+22,18,21,20,6,6,35,34,39,55,22,51,50,54,53,52,39,6,7,39,62,2,53,52,35,34,
+7,39,2,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,
+35,34,7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,
+5,21,16,51,50,17,53,2,22,21,20,6,35,34,38,53,52,54,51,6,217,170,135,146,127,
+65,72,123,217,139,99,65,74,43,55,139,162,102,74,99,88,138,149,66,111,106,
+109,92,103,170,120,127,174,43,215,191,188,215,252,252,70,74,51,57,47,63,148,
+166,1,209,163,150,63,45,59,47,74,69,43,253,88,231,234,187,60,60,45,49,59,
+59,49,4,197,160,125,150,129,112,254,239,122,166,230,114,49,141,29,172,177,
+212,183,56,61,145,80,117,104,62,121,86,139,254,119,254,67,254,244,254,232,
+65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,172,18,196,172,
+129,129,174,194,18,174,27,97,106,129,154,155,254,241,1,15,155,253,23,58,57,
+55,60,60,55,57,58,0,5,0,113,254,100,10,23,4,197,0,35,0,84,0,96,0,103,0,115,
+0,0,0,51,50,22,21,20,7,22,18,21,20,6,6,35,34,39,55,22,51,50,54,53,52,39,6,
+7,39,62,2,53,52,35,34,7,39,2,17,16,3,39,54,53,16,35,35,21,20,6,35,34,38,53,
+53,35,53,51,53,52,38,35,34,7,53,54,51,50,22,21,21,33,53,52,54,51,50,23,21,
+38,35,34,6,21,21,51,36,21,20,22,23,7,38,38,53,52,55,23,1,21,16,51,50,17,53,
+2,22,21,20,6,35,34,38,53,52,54,51,8,74,170,135,145,127,66,72,123,217,140,
+98,66,74,43,55,140,162,103,74,98,88,137,150,65,110,107,108,92,103,170,121,
+127,174,43,215,190,189,215,252,252,69,74,51,58,47,64,147,166,1,209,164,149,
+64,45,59,47,74,70,43,251,10,37,47,155,49,41,114,131,1,250,232,233,186,59,
+59,45,49,60,60,49,4,197,160,125,150,129,112,254,239,122,166,230,114,49,141,
+29,172,177,212,183,56,61,145,80,117,104,62,121,86,139,254,119,254,67,254,
+244,254,232,65,242,237,1,39,155,199,238,238,199,155,154,129,106,97,25,172,
+18,196,172,129,129,174,194,18,174,27,97,106,129,2,144,83,138,78,73,94,164,
+112,211,140,76,254,227,155,254,241,1,15,155,253,23,58,57,55,60,60,55,57,58,
+0,2,0,72,254,236,5,233,4,190,0,48,0,55,0,0,0,17,16,3,39,54,53,16,35,35,21,
+20,6,35,34,38,53,53,35,53,51,53,52,38,35,34,7,53,54,51,50,22,21,21,33,53,
+52,54,51,50,23,21,38,35,34,6,21,21,51,5,21,16,51,50,17,53,5,233,170,120,127,
+174,43,215,191,188,215,252,252,70,74,49,59,47,63,148,166,1,209,163,150,63,
+45,59,47,74,69,43,253,88,231,234,2,205,254,67,254,244,254,232,65,242,237,
+1,39,155,199,238,238,199,155,154,129,106,97,25,172,18,196,172,129,129,174,
+194,18,174,27,97,106,129,154,155,254,241,1,15,155,0,255,255,0,113,254,236,
+7,90,4,190,16,34,5,153,0,0,16,3,1,242,1,113,0,0,255,255,0,113,254,236,8,253,
+4,219,16,34,5,154,0,0,16,3,1,242,3,20,0,0,0,2,0,72,255,47,7,154,4,190,0,66,
+0,73,0,0,0,21,20,6,7,39,38,2,39,7,22,21,20,3,39,54,53,52,35,35,21,20,6,35,
+34,38,53,53,35,53,51,53,52,38,35,34,7,53,54,51,50,22,21,21,33,53,52,54,51,
+50,23,21,38,35,34,6,21,21,51,32,19,23,54,53,52,39,55,5,21,16,51,50,17,53,
+7,154,97,110,158,39,90,66,4,56,66,141,43,109,32,215,191,188,215,252,252,70,
+74,49,59,47,63,148,166,1,209,163,150,63,45,59,47,74,69,167,1,60,72,6,88,49,
+168,250,131,231,234,2,121,137,150,250,149,51,244,1,2,49,6,88,168,232,254,
+248,31,250,254,237,155,199,238,238,199,155,154,129,106,97,25,172,18,196,172,
+129,129,174,194,18,174,27,97,106,129,253,176,2,164,166,127,131,57,205,155,
+254,241,1,15,155,255,255,0,113,255,47,9,11,4,190,16,34,5,153,0,0,16,3,1,245,
+1,113,0,0,255,255,0,113,255,47,10,174,4,219,16,34,5,154,0,0,16,3,1,245,3,
+20,0,0,255,255,0,72,255,47,10,162,4,190,16,34,1,245,0,0,16,3,5,157,7,246,
+0,0,255,255,0,113,255,47,12,18,4,190,16,34,5,153,0,0,16,35,1,245,1,113,0,
+0,16,3,5,157,9,102,0,0,255,255,0,113,254,33,9,11,4,190,16,34,5,153,0,0,16,
+35,1,245,1,113,0,0,16,3,5,190,4,72,0,0,255,255,255,254,254,152,10,109,6,53,
+16,34,5,158,0,0,16,3,1,245,2,211,0,0,255,255,0,113,254,152,11,56,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,1,245,3,158,0,0,255,255,0,
+143,255,47,9,156,4,219,16,34,5,159,0,0,16,3,1,245,2,2,0,0,255,255,0,113,255,
+47,11,13,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,1,245,3,115,0,0,
+255,255,0,113,255,47,9,52,6,111,16,34,5,160,0,0,16,3,1,245,1,154,0,0,255,
+255,0,113,255,47,10,164,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,
+1,245,3,10,0,0,255,255,0,72,254,152,9,78,4,221,16,34,1,245,0,0,16,3,5,161,
+7,172,0,0,255,255,0,113,254,152,10,191,4,221,16,34,5,153,0,0,16,35,1,245,
+1,113,0,0,16,3,5,161,9,29,0,0,255,255,0,72,254,152,10,80,4,197,16,34,1,245,
+0,0,16,3,5,162,7,246,0,0,255,255,0,113,254,152,11,192,4,197,16,34,5,153,0,
+0,16,35,1,245,1,113,0,0,16,3,5,162,9,102,0,0,255,255,0,72,254,236,8,248,4,
+190,16,34,1,242,0,0,16,3,5,157,6,76,0,0,255,255,0,113,254,236,10,104,4,190,
+16,34,5,153,0,0,16,35,1,242,1,113,0,0,16,3,5,157,7,188,0,0,255,255,0,113,
+254,33,7,90,4,190,16,34,5,153,0,0,16,35,1,242,1,113,0,0,16,3,5,190,4,72,0,
+0,255,255,255,254,254,152,8,188,6,53,16,34,5,158,0,0,16,3,1,242,2,211,0,0,
+255,255,0,113,254,152,9,135,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,
+68,16,3,1,242,3,158,0,0,255,255,0,143,254,236,7,235,4,219,16,34,5,159,0,0,
+16,3,1,242,2,2,0,0,255,255,0,113,254,236,9,92,4,219,16,34,5,153,0,0,16,35,
+5,159,1,113,0,0,16,3,1,242,3,115,0,0,255,255,0,111,254,236,7,131,6,78,16,
+34,5,164,0,0,16,3,1,242,1,154,0,0,255,255,0,113,254,236,8,243,6,111,16,34,
+5,153,0,0,16,35,5,160,1,113,0,0,16,3,1,242,3,10,0,0,255,255,0,72,254,152,
+8,31,4,221,16,34,1,242,0,0,16,3,5,161,6,125,0,0,255,255,0,113,254,152,9,144,
+4,221,16,34,5,153,0,0,16,35,1,242,1,113,0,0,16,3,5,161,7,238,0,0,255,255,
+0,72,254,152,8,166,4,197,16,34,1,242,0,0,16,3,5,162,6,76,0,0,255,255,0,113,
+254,152,10,22,4,197,16,34,5,153,0,0,16,35,1,242,1,113,0,0,16,3,5,162,7,188,
+0,0,0,2,0,72,255,199,7,10,4,190,0,61,0,68,0,0,0,21,20,6,7,39,2,39,38,38,35,
+35,21,20,6,35,34,38,53,53,35,53,51,53,52,38,35,34,7,53,54,51,50,22,21,21,
+33,53,52,54,51,50,23,21,38,35,34,6,21,21,51,50,22,23,22,19,23,54,53,52,39,
+55,5,21,16,51,50,17,53,7,10,96,111,174,55,74,26,56,43,34,215,191,188,215,
+252,252,70,74,49,59,47,63,148,166,1,209,163,150,63,45,59,47,74,69,34,93,114,
+43,78,49,6,88,49,168,251,19,231,234,2,117,137,150,250,149,57,1,76,143,49,
+39,155,199,238,238,199,155,154,129,106,97,25,172,18,196,172,129,129,174,194,
+18,174,27,97,106,129,70,78,141,254,205,2,164,166,126,132,57,201,155,254,241,
+1,15,155,0,255,255,0,113,255,199,8,123,4,190,16,34,5,153,0,0,16,3,2,18,1,
+113,0,0,255,255,0,113,255,158,10,30,4,219,16,34,5,154,0,0,16,3,2,18,3,20,
+0,0,255,255,0,72,255,156,10,18,4,190,16,34,2,18,0,0,16,3,5,157,7,102,0,0,
+255,255,0,113,255,156,11,131,4,190,16,34,5,153,0,0,16,35,2,18,1,113,0,0,16,
+3,5,157,8,215,0,0,255,255,0,113,254,33,8,123,4,190,16,34,5,153,0,0,16,35,
+2,18,1,113,0,0,16,3,5,190,4,72,0,0,255,255,255,254,254,152,9,221,6,53,16,
+34,5,158,0,0,16,3,2,18,2,211,0,0,255,255,0,113,254,152,10,168,6,53,16,35,
+5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,18,3,158,0,0,255,255,0,143,
+255,158,9,12,4,219,16,34,5,159,0,0,16,3,2,18,2,2,0,0,255,255,0,113,255,158,
+10,125,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,18,3,115,0,0,255,
+255,0,113,255,158,8,205,6,111,16,34,5,160,0,0,16,3,2,18,1,195,0,0,255,255,
+0,113,255,158,10,61,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,2,18,
+3,51,0,0,255,255,0,72,254,152,8,191,4,221,16,34,2,18,0,0,16,3,5,161,7,29,
+0,0,255,255,0,113,254,152,10,47,4,221,16,34,5,153,0,0,16,35,2,18,1,113,0,
+0,16,3,5,161,8,141,0,0,255,255,0,72,254,152,9,192,4,197,16,34,2,18,0,0,16,
+3,5,162,7,102,0,0,255,255,0,113,254,152,11,49,4,197,16,34,5,153,0,0,16,35,
+2,18,1,113,0,0,16,3,5,162,8,215,0,0,255,255,0,72,255,156,8,90,4,190,16,34,
+1,223,0,0,16,3,5,157,5,174,0,0,255,255,0,113,255,156,9,203,4,190,16,34,5,
+153,0,0,16,35,1,223,1,113,0,0,16,3,5,157,7,31,0,0,255,255,0,113,254,33,6,
+215,4,190,16,34,5,153,0,0,16,35,1,223,1,113,0,0,16,3,5,190,4,72,0,0,255,255,
+255,254,254,152,8,57,6,53,16,34,5,158,0,0,16,3,1,223,2,211,0,0,255,255,0,
+113,254,152,9,4,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,1,
+223,3,158,0,0,255,255,0,143,255,158,7,104,4,219,16,34,5,159,0,0,16,3,1,223,
+2,2,0,0,255,255,0,113,255,158,8,217,4,219,16,34,5,153,0,0,16,35,5,159,1,113,
+0,0,16,3,1,223,3,115,0,0,255,255,0,113,255,158,7,41,6,111,16,34,5,160,0,0,
+16,3,1,223,1,195,0,0,255,255,0,113,255,158,8,153,6,111,16,34,5,153,0,0,16,
+35,5,160,1,113,0,0,16,3,1,223,3,51,0,0,255,255,0,72,254,152,7,80,4,221,16,
+34,1,223,0,0,16,3,5,161,5,174,0,0,255,255,0,113,254,152,8,193,4,221,16,34,
+5,153,0,0,16,35,1,223,1,113,0,0,16,3,5,161,7,31,0,0,255,255,0,72,254,152,
+8,8,4,197,16,34,1,223,0,0,16,3,5,162,5,174,0,0,255,255,0,113,254,152,9,121,
+4,197,16,34,5,153,0,0,16,35,1,223,1,113,0,0,16,3,5,162,7,31,0,0,0,1,0,61,
+255,227,4,123,4,199,0,11,0,0,37,7,1,1,39,1,1,55,1,1,23,1,4,123,129,254,98,
+254,98,129,1,177,254,79,129,1,158,1,158,129,254,80,80,109,1,240,254,16,109,
+2,6,2,4,109,254,16,1,240,109,253,252,0,255,255,0,113,255,227,5,236,4,199,
+16,34,5,153,0,0,16,3,2,47,1,113,0,0,255,255,0,113,255,158,7,103,4,219,16,
+34,5,154,0,0,16,3,2,47,2,236,0,0,0,1,0,61,255,227,6,68,4,199,0,28,0,0,0,21,
+20,6,7,39,38,38,39,1,1,7,1,1,39,1,1,55,1,1,22,18,23,23,54,53,52,39,55,6,68,
+97,110,158,35,98,84,254,205,1,176,129,254,98,254,98,129,1,177,254,79,129,
+1,158,1,158,145,150,33,6,88,49,168,4,63,137,149,250,150,52,159,242,109,254,
+145,253,252,109,1,240,254,16,109,2,6,2,4,109,254,16,1,240,152,254,207,186,
+2,163,166,127,131,58,255,255,0,113,255,227,7,181,4,199,16,34,5,153,0,0,16,
+3,2,50,1,113,0,0,255,255,0,113,255,158,9,48,4,219,16,34,5,154,0,0,16,3,2,
+50,2,236,0,0,255,255,0,61,255,156,9,76,4,199,16,34,2,50,0,0,16,3,5,157,6,
+160,0,0,255,255,0,113,255,156,10,188,4,199,16,34,5,153,0,0,16,35,2,50,1,113,
+0,0,16,3,5,157,8,16,0,0,255,255,0,113,254,33,7,181,4,199,16,34,5,153,0,0,
+16,35,2,50,1,113,0,0,16,3,5,190,3,205,0,0,255,255,255,254,254,152,9,23,6,
+53,16,34,5,158,0,0,16,3,2,50,2,211,0,0,255,255,0,113,254,152,9,226,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,50,3,158,0,0,255,255,0,143,
+255,158,8,70,4,219,16,34,5,159,0,0,16,3,2,50,2,2,0,0,255,255,0,113,255,158,
+9,183,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,50,3,115,0,0,255,
+255,0,113,255,158,8,7,6,111,16,34,5,160,0,0,16,3,2,50,1,195,0,0,255,255,0,
+113,255,158,9,78,6,78,16,34,5,153,0,0,16,35,5,164,1,113,0,0,16,3,2,50,3,10,
+0,0,255,255,0,61,254,152,8,66,4,221,16,34,2,50,0,0,16,3,5,161,6,160,0,0,255,
+255,0,113,254,152,9,178,4,221,16,34,5,153,0,0,16,35,2,50,1,113,0,0,16,3,5,
+161,8,16,0,0,255,255,0,61,254,152,8,250,4,199,16,34,2,50,0,0,16,3,5,162,6,
+160,0,0,255,255,0,113,254,152,10,106,4,199,16,34,5,153,0,0,16,35,2,50,1,113,
+0,0,16,3,5,162,8,16,0,0,255,255,0,61,255,156,7,49,4,199,16,34,2,47,0,0,16,
+3,5,157,4,133,0,0,255,255,0,113,255,156,8,162,4,199,16,34,5,153,0,0,16,35,
+2,47,1,113,0,0,16,3,5,157,5,246,0,0,255,255,0,113,254,33,5,236,4,199,16,34,
+5,153,0,0,16,35,2,47,1,113,0,0,16,3,5,190,3,205,0,0,255,255,255,254,254,152,
+7,78,6,53,16,34,5,158,0,0,16,3,2,47,2,211,0,0,255,255,0,113,254,152,8,25,
+6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,47,3,158,0,0,255,
+255,0,143,255,158,6,125,4,219,16,34,5,159,0,0,16,3,2,47,2,2,0,0,255,255,0,
+113,255,158,7,238,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,47,3,
+115,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,2,47,1,195,
+0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,
+16,3,2,47,3,51,0,0,255,255,0,61,254,152,6,90,4,221,16,34,2,47,0,0,16,3,5,
+161,4,184,0,0,255,255,0,113,254,152,7,203,4,221,16,34,5,153,0,0,16,35,2,47,
+1,113,0,0,16,3,5,161,6,41,0,0,255,255,0,61,254,152,7,18,4,199,16,34,2,47,
+0,0,16,3,5,162,4,184,0,0,255,255,0,113,254,152,8,131,4,199,16,34,5,153,0,
+0,16,35,2,47,1,113,0,0,16,3,5,162,6,41,0,0,0,2,0,143,0,0,5,160,4,197,0,36,
+0,46,0,0,54,17,52,18,36,51,50,23,54,51,50,23,21,38,35,34,7,21,22,21,20,6,
+35,34,38,53,52,55,53,38,35,34,2,17,16,19,35,0,21,20,22,51,50,54,53,52,39,
+143,148,1,0,164,159,115,121,151,111,72,72,98,43,31,150,193,178,178,193,170,
+31,38,173,215,103,184,2,28,103,96,96,103,195,244,1,26,228,1,55,156,64,64,
+23,166,23,8,9,149,217,172,213,213,172,223,145,9,6,254,252,254,247,254,252,
+254,242,3,133,231,101,116,116,101,231,96,255,255,0,113,0,0,7,17,4,197,16,
+34,5,153,0,0,16,3,2,79,1,113,0,0,255,255,0,113,255,158,8,180,4,219,16,34,
+5,154,0,0,16,3,2,79,3,20,0,0,0,2,0,143,0,0,7,2,4,197,0,51,0,61,0,0,0,21,20,
+6,7,39,38,39,35,6,6,35,34,38,53,52,55,53,38,35,34,2,17,16,19,35,38,17,52,
+18,36,51,50,23,54,51,50,23,21,38,35,34,7,21,18,19,23,54,53,52,39,55,0,54,
+53,52,39,6,21,20,22,51,7,2,96,111,157,35,66,8,12,181,153,178,193,170,31,38,
+173,215,103,184,93,148,1,0,164,159,115,121,151,111,72,72,98,43,31,246,94,
+6,88,49,168,253,90,103,195,203,103,96,3,166,137,150,250,149,51,178,144,152,
+182,213,172,223,145,9,6,254,252,254,247,254,252,254,242,244,1,26,228,1,55,
+156,64,64,23,166,23,8,9,254,248,254,164,2,164,166,127,131,57,253,152,116,
+101,231,96,96,231,101,116,0,255,255,0,113,0,0,8,115,4,197,16,34,5,153,0,0,
+16,3,2,82,1,113,0,0,255,255,0,113,255,158,10,22,4,219,16,34,5,154,0,0,16,
+3,2,82,3,20,0,0,255,255,0,143,255,156,10,10,4,197,16,34,2,82,0,0,16,3,5,157,
+7,94,0,0,255,255,0,113,255,156,11,123,4,197,16,34,5,153,0,0,16,35,2,82,1,
+113,0,0,16,3,5,157,8,207,0,0,255,255,0,113,254,33,8,115,4,197,16,34,5,153,
+0,0,16,35,2,82,1,113,0,0,16,3,5,190,4,158,0,0,255,255,255,254,254,152,9,213,
+6,53,16,34,5,158,0,0,16,3,2,82,2,211,0,0,255,255,0,113,254,152,10,160,6,53,
+16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,82,3,158,0,0,255,255,
+0,143,255,158,8,227,4,219,16,34,5,159,0,0,16,3,2,82,1,225,0,0,255,255,0,113,
+255,158,10,84,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,82,3,82,
+0,0,255,255,0,113,255,158,8,156,6,111,16,34,5,160,0,0,16,3,2,82,1,154,0,0,
+255,255,0,113,255,158,10,12,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,
+3,2,82,3,10,0,0,255,255,0,143,254,152,8,225,4,221,16,34,2,82,0,0,16,3,5,161,
+7,63,0,0,255,255,0,113,254,152,10,82,4,221,16,34,5,153,0,0,16,35,2,82,1,113,
+0,0,16,3,5,161,8,176,0,0,255,255,0,143,254,152,9,184,4,197,16,34,2,82,0,0,
+16,3,5,162,7,94,0,0,255,255,0,113,254,152,11,41,4,197,16,34,5,153,0,0,16,
+35,2,82,1,113,0,0,16,3,5,162,8,207,0,0,255,255,0,143,255,156,8,96,4,197,16,
+34,2,79,0,0,16,3,5,157,5,180,0,0,255,255,0,113,255,156,9,209,4,197,16,34,
+5,153,0,0,16,35,2,79,1,113,0,0,16,3,5,157,7,37,0,0,255,255,0,113,254,33,7,
+17,4,197,16,34,5,153,0,0,16,35,2,79,1,113,0,0,16,3,5,190,4,158,0,0,255,255,
+255,254,254,152,8,115,6,53,16,34,5,158,0,0,16,3,2,79,2,211,0,0,255,255,0,
+113,254,152,9,62,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,
+79,3,158,0,0,255,255,0,143,255,158,7,129,4,219,16,34,5,159,0,0,16,3,2,79,
+1,225,0,0,255,255,0,113,255,158,8,242,4,219,16,34,5,153,0,0,16,35,5,159,1,
+113,0,0,16,3,2,79,3,82,0,0,255,255,0,113,255,158,7,58,6,111,16,34,5,160,0,
+0,16,3,2,79,1,154,0,0,255,255,0,113,255,158,8,170,6,111,16,34,5,153,0,0,16,
+35,5,160,1,113,0,0,16,3,2,79,3,10,0,0,255,255,0,143,254,152,7,86,4,221,16,
+34,2,79,0,0,16,3,5,161,5,180,0,0,255,255,0,113,254,152,8,199,4,221,16,34,
+5,153,0,0,16,35,2,79,1,113,0,0,16,3,5,161,7,37,0,0,255,255,0,143,254,152,
+8,14,4,197,16,34,2,79,0,0,16,3,5,162,5,180,0,0,255,255,0,113,254,152,9,127,
+4,197,16,34,5,153,0,0,16,35,2,79,1,113,0,0,16,3,5,162,7,37,0,0,0,1,0,143,
+255,242,4,137,4,190,0,36,0,0,0,33,34,39,21,20,22,22,51,50,55,21,6,35,34,36,
+38,53,52,18,55,22,51,50,55,21,6,35,34,39,6,7,22,51,32,55,21,3,201,254,229,
+190,181,95,200,168,168,117,115,168,229,254,233,129,88,109,147,193,207,157,
+145,223,127,98,89,30,149,203,1,14,207,1,242,30,16,137,158,65,36,163,39,104,
+225,189,176,1,63,207,37,45,159,49,14,156,178,24,57,164,255,255,0,113,255,
+242,5,250,4,190,16,34,5,153,0,0,16,3,2,111,1,113,0,0,255,255,0,113,255,158,
+7,157,4,219,16,34,5,154,0,0,16,3,2,111,3,20,0,0,255,255,0,143,254,100,5,135,
+4,190,16,34,2,130,0,0,16,3,5,188,2,164,0,0,0,3,0,113,254,100,6,248,4,190,
+0,50,0,62,0,74,0,0,0,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,
+52,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,
+22,51,50,55,21,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,
+52,54,51,4,244,224,126,99,88,31,150,203,129,186,76,35,145,160,170,121,127,
+68,73,33,78,182,131,191,180,94,201,168,131,100,94,135,229,254,233,129,88,
+109,147,193,206,158,251,141,37,47,155,49,41,114,131,2,222,59,59,45,50,59,
+59,50,3,238,14,156,178,24,24,10,213,202,254,243,254,232,65,242,237,134,122,
+10,24,30,16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,254,176,
+144,83,138,78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,
+4,0,113,254,100,8,156,4,219,0,10,0,61,0,73,0,85,0,0,0,17,20,2,7,39,18,17,
+16,3,55,4,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,52,38,35,
+34,7,6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,22,51,50,
+55,21,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,
+2,215,111,122,117,190,190,149,4,138,224,127,98,88,31,150,203,129,186,76,34,
+146,160,170,121,127,68,74,32,78,182,131,191,180,94,201,168,131,100,94,135,
+230,254,234,129,88,108,148,192,207,158,249,233,37,47,155,49,41,114,131,4,
+129,60,60,45,49,59,59,49,3,170,254,139,190,254,198,159,80,1,8,1,51,1,65,1,
+15,98,237,14,156,178,24,24,10,213,202,254,243,254,232,65,242,237,134,122,
+10,24,30,16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,254,176,
+144,83,138,78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,
+3,0,143,254,100,8,109,4,190,0,50,0,70,0,82,0,0,0,35,34,39,6,7,22,51,50,55,
+54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,
+21,6,35,34,36,38,53,52,18,55,22,51,50,55,21,4,21,20,18,23,7,0,17,52,18,55,
+51,22,22,23,7,38,38,39,35,0,22,21,20,6,35,34,38,53,52,54,51,3,131,223,127,
+98,89,30,149,203,129,186,76,35,145,160,170,121,127,67,74,33,78,182,131,190,
+181,95,200,168,131,101,95,135,229,254,233,129,88,109,147,193,207,157,2,117,
+117,119,131,254,247,113,125,211,12,107,76,129,76,99,16,8,251,174,59,59,45,
+49,60,60,49,3,238,14,156,178,24,24,10,213,202,254,243,254,232,65,242,237,
+134,122,10,24,30,16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,
+215,250,146,254,218,134,116,1,55,1,111,176,1,34,148,123,244,86,100,90,223,
+113,251,33,58,57,55,60,60,55,57,58,0,4,0,113,254,100,9,221,4,190,0,50,0,70,
+0,82,0,94,0,0,0,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,52,
+38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,22,
+51,50,55,21,4,21,20,18,23,7,0,17,52,18,55,51,22,22,23,7,38,38,39,35,0,21,
+20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,4,244,224,
+126,99,88,31,150,203,129,186,76,35,145,160,170,121,127,68,73,33,78,182,131,
+191,180,94,201,168,131,100,94,135,229,254,233,129,88,109,147,193,206,158,
+2,117,117,118,131,254,248,113,125,211,12,106,76,129,76,98,16,8,248,124,37,
+47,155,49,41,114,131,2,222,59,59,45,50,59,59,50,3,238,14,156,178,24,24,10,
+213,202,254,243,254,232,65,242,237,134,122,10,24,30,16,137,158,65,22,164,
+24,104,225,189,176,1,63,207,37,45,159,215,250,146,254,218,134,116,1,55,1,
+111,176,1,34,148,123,244,86,100,90,223,113,254,166,144,83,138,78,73,94,164,
+112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,4,0,113,252,174,6,248,4,
+190,0,50,0,62,0,74,0,88,0,0,0,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,
+3,39,54,53,52,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,
+53,52,18,55,22,51,50,55,21,0,21,20,22,23,7,38,38,53,52,55,23,0,6,35,34,38,
+53,52,54,51,50,22,21,2,51,50,23,7,38,35,34,7,39,19,23,7,23,4,244,224,126,
+99,88,31,150,203,129,186,76,35,145,160,170,121,127,68,73,33,78,182,131,191,
+180,94,201,168,131,100,94,135,229,254,233,129,88,109,147,193,206,158,251,
+141,37,47,155,49,41,114,131,3,25,59,45,50,59,59,50,45,59,164,156,139,117,
+60,106,150,147,115,131,189,114,125,4,3,238,14,156,178,24,24,10,213,202,254,
+243,254,232,65,242,237,134,122,10,24,30,16,137,158,65,22,164,24,104,225,189,
+176,1,63,207,37,45,159,254,176,144,83,138,78,73,94,164,112,211,140,76,251,
+80,60,60,55,57,58,58,57,254,172,53,160,62,58,84,1,41,74,170,4,0,3,255,254,
+254,100,8,90,6,53,0,20,0,71,0,83,0,0,19,0,17,20,2,6,35,34,39,55,22,51,50,
+54,53,16,9,2,7,39,0,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,
+52,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,
+22,51,50,55,21,0,22,21,20,6,35,34,38,53,52,54,51,223,1,166,115,200,129,99,
+65,74,43,55,121,145,254,35,1,115,1,98,105,233,4,213,223,127,98,89,30,149,
+203,129,186,76,35,145,160,170,121,127,67,74,33,78,182,131,188,183,95,200,
+168,131,101,97,133,229,254,233,129,88,109,147,193,207,157,254,191,59,59,45,
+49,60,60,49,4,154,254,73,254,0,188,254,248,135,49,141,29,213,209,2,17,1,170,
+1,155,254,215,129,197,254,158,14,156,178,24,24,10,213,202,254,243,254,232,
+65,242,237,134,122,10,24,30,16,137,158,65,22,164,24,104,225,189,176,1,63,
+207,37,45,159,251,43,58,57,55,60,60,55,57,58,0,4,0,113,254,100,9,37,6,53,
+0,20,0,71,0,83,0,95,0,0,1,0,17,20,2,6,35,34,39,55,22,51,50,54,53,16,9,2,7,
+39,0,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,
+6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,22,51,50,55,
+21,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,1,
+170,1,166,115,201,129,98,65,73,43,56,120,146,254,35,1,114,1,99,105,233,4,
+213,223,127,99,88,31,150,203,129,186,76,35,145,160,170,121,127,68,73,33,78,
+182,131,189,182,94,201,168,131,100,96,133,229,254,233,129,88,109,147,193,
+206,158,249,96,37,47,155,49,41,114,131,5,11,59,59,45,50,59,59,50,4,154,254,
+73,254,0,188,254,248,135,49,141,29,213,209,2,17,1,170,1,155,254,215,129,197,
+254,158,14,156,178,24,24,10,213,202,254,243,254,232,65,242,237,134,122,10,
+24,30,16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,253,243,
+143,84,137,78,74,95,163,113,211,139,76,252,183,58,57,55,60,60,55,57,58,0,
+0,3,0,143,254,100,7,76,4,219,0,10,0,61,0,73,0,0,0,17,16,19,7,2,17,52,18,55,
+23,4,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,
+6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,22,51,50,55,
+21,0,22,21,20,6,35,34,38,53,52,54,51,1,47,191,150,201,111,123,117,3,90,224,
+127,98,88,31,150,203,129,186,76,35,145,160,170,121,127,68,73,33,78,182,131,
+191,180,94,201,168,131,100,94,135,229,254,233,129,88,109,147,193,206,158,
+254,191,59,59,46,49,59,59,49,3,131,254,205,254,190,254,242,98,1,49,1,117,
+190,1,57,160,80,157,14,156,178,24,24,10,213,202,254,243,254,232,65,242,237,
+134,122,10,24,30,16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,
+251,43,58,57,55,60,60,55,57,58,0,4,0,113,254,100,8,188,4,219,0,10,0,61,0,
+73,0,85,0,0,0,17,16,19,7,2,17,52,18,55,23,4,35,34,39,6,7,22,51,50,55,54,51,
+50,22,21,16,3,39,54,53,52,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,21,6,
+35,34,36,38,53,52,18,55,22,51,50,55,21,0,21,20,22,23,7,38,38,53,52,55,23,
+0,22,21,20,6,35,34,38,53,52,54,51,2,160,190,149,201,111,122,117,3,90,223,
+127,98,88,31,150,202,129,187,75,35,146,159,170,120,127,68,74,33,77,183,131,
+190,180,94,201,167,132,100,94,135,230,254,234,129,88,108,148,192,207,158,
+249,200,37,47,155,49,41,114,131,4,162,60,60,45,49,59,59,49,3,131,254,205,
+254,190,254,242,98,1,49,1,117,190,1,57,160,80,157,14,156,178,24,24,10,213,
+202,254,243,254,232,65,242,237,134,122,10,24,30,16,137,158,65,22,164,24,104,
+225,189,176,1,63,207,37,45,159,254,176,144,83,138,78,73,94,164,112,211,140,
+76,251,250,58,57,55,60,60,55,57,58,0,3,0,113,254,100,7,33,6,111,0,20,0,71,
+0,83,0,0,0,33,34,39,0,17,20,18,23,7,38,2,53,16,18,55,4,51,32,37,21,0,35,34,
+39,6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,6,35,34,39,
+21,20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,22,51,50,55,21,0,22,21,
+20,6,35,34,38,53,52,54,51,5,117,254,65,213,198,254,247,78,88,147,92,88,170,
+176,1,0,235,1,174,1,43,254,142,224,127,98,88,31,150,203,129,186,76,35,145,
+160,170,121,127,68,73,33,78,182,131,191,180,94,201,168,131,100,94,135,229,
+254,233,129,88,109,147,193,206,158,254,191,59,59,46,49,59,59,49,5,111,36,
+254,160,254,47,184,254,223,151,84,157,1,78,203,1,37,1,221,233,43,91,162,254,
+33,14,156,178,24,24,10,213,202,254,243,254,232,65,242,237,134,122,10,24,30,
+16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,251,43,58,57,55,
+60,60,55,57,58,0,0,4,0,113,254,100,8,145,6,111,0,20,0,71,0,83,0,95,0,0,0,
+33,34,39,0,17,20,18,23,7,38,2,53,16,18,55,4,51,32,37,21,0,35,34,39,6,7,22,
+51,50,55,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,6,35,34,39,21,20,22,22,
+51,50,55,21,6,35,34,36,38,53,52,18,55,22,51,50,55,21,0,21,20,22,23,7,38,38,
+53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,6,229,254,66,213,199,254,248,
+78,88,147,93,88,170,176,1,0,236,1,174,1,43,254,141,223,127,98,88,31,150,202,
+129,187,75,35,146,159,170,120,127,68,74,33,77,183,131,190,180,94,201,167,
+132,100,94,135,230,254,234,129,88,108,148,192,207,158,249,243,37,47,155,49,
+41,114,131,4,119,60,60,45,49,59,59,49,5,111,36,254,160,254,47,184,254,223,
+151,84,157,1,78,203,1,37,1,221,233,43,91,162,254,33,14,156,178,24,24,10,213,
+202,254,243,254,232,65,242,237,134,122,10,24,30,16,137,158,65,22,164,24,104,
+225,189,176,1,63,207,37,45,159,254,176,144,83,138,78,73,94,164,112,211,140,
+76,251,250,58,57,55,60,60,55,57,58,0,0,3,0,143,254,100,7,180,4,221,0,17,0,
+68,0,80,0,0,0,17,20,2,6,35,34,39,55,22,51,50,54,54,53,16,3,55,4,35,34,39,
+6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,6,35,34,39,21,
+20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,22,51,50,55,21,0,22,21,20,
+6,35,34,38,53,52,54,51,7,180,129,229,141,99,65,73,43,56,94,145,82,231,147,
+252,205,223,127,98,89,30,149,203,129,186,76,35,145,160,170,121,127,67,74,
+33,78,182,131,190,181,95,200,168,131,101,95,135,229,254,233,129,88,109,147,
+193,207,157,254,191,59,59,45,49,60,60,49,3,117,253,231,213,254,191,174,49,
+141,29,133,250,170,1,205,1,90,84,239,14,156,178,24,24,10,213,202,254,243,
+254,232,65,242,237,134,122,10,24,30,16,137,158,65,22,164,24,104,225,189,176,
+1,63,207,37,45,159,251,43,58,57,55,60,60,55,57,58,0,0,4,0,113,254,100,9,37,
+4,221,0,17,0,68,0,80,0,92,0,0,0,17,20,2,6,35,34,39,55,22,51,50,54,54,53,16,
+3,55,4,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,3,39,54,53,52,38,35,34,
+7,6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,22,51,50,55,
+21,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,34,38,53,52,54,51,9,
+37,129,230,141,98,66,74,43,55,95,145,82,232,148,252,205,224,126,99,88,31,
+150,203,129,186,76,35,145,160,170,121,127,68,73,33,78,182,131,191,180,94,
+201,168,131,100,94,135,229,254,233,129,88,109,147,193,206,158,251,141,37,
+47,155,49,41,114,131,2,222,59,59,45,50,59,59,50,3,117,253,231,213,254,191,
+174,49,141,29,133,250,170,1,205,1,90,84,239,14,156,178,24,24,10,213,202,254,
+243,254,232,65,242,237,134,122,10,24,30,16,137,158,65,22,164,24,104,225,189,
+176,1,63,207,37,45,159,254,176,144,83,138,78,73,94,164,112,211,140,76,251,
+250,58,57,55,60,60,55,57,58,0,0,3,0,143,254,100,8,27,4,197,0,35,0,86,0,98,
+0,0,0,51,50,22,21,20,7,22,18,21,20,6,6,35,34,39,55,22,51,50,54,53,52,39,6,
+7,39,62,2,53,52,35,34,7,39,4,35,34,39,6,7,22,51,50,55,54,51,50,22,21,16,3,
+39,54,53,52,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,21,6,35,34,36,38,53,
+52,18,55,22,51,50,55,21,0,22,21,20,6,35,34,38,53,52,54,51,6,78,170,135,145,
+127,66,72,123,217,140,98,65,73,43,56,139,162,103,73,99,88,137,150,65,110,
+107,108,92,253,190,223,127,98,89,30,149,203,129,186,76,35,145,160,170,121,
+127,67,74,33,78,182,131,190,181,95,200,168,131,101,97,133,229,254,233,129,
+88,109,147,193,207,157,254,191,59,59,45,49,60,60,49,4,197,160,125,150,129,
+112,254,239,122,166,230,114,49,141,29,172,177,212,183,56,61,145,80,117,104,
+62,121,86,139,104,14,156,178,24,24,10,213,202,254,243,254,232,65,242,237,
+134,122,10,24,30,16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,
+251,43,58,57,55,60,60,55,57,58,0,0,4,0,113,254,100,9,139,4,197,0,35,0,86,
+0,98,0,110,0,0,0,51,50,22,21,20,7,22,18,21,20,6,6,35,34,39,55,22,51,50,54,
+53,52,39,6,7,39,62,2,53,52,35,34,7,39,4,35,34,39,6,7,22,51,50,55,54,51,50,
+22,21,16,3,39,54,53,52,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,21,6,35,
+34,36,38,53,52,18,55,22,51,50,55,21,0,21,20,22,23,7,38,38,53,52,55,23,0,22,
+21,20,6,35,34,38,53,52,54,51,7,190,170,136,145,127,66,71,123,217,139,98,66,
+74,43,55,139,162,102,74,98,88,137,150,65,111,106,109,92,253,191,224,126,99,
+88,31,150,203,129,186,76,35,145,160,170,121,127,68,73,33,78,182,131,191,180,
+94,201,168,131,100,96,133,229,254,233,129,88,109,147,193,206,158,251,141,
+37,47,155,49,41,114,131,2,222,59,59,45,50,59,59,50,4,197,160,125,150,129,
+112,254,239,122,166,230,114,49,141,29,172,177,212,183,56,61,145,80,117,104,
+62,121,86,139,104,14,156,178,24,24,10,213,202,254,243,254,232,65,242,237,
+134,122,10,24,30,16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,
+254,176,144,83,138,78,73,94,164,112,211,140,76,251,250,58,57,55,60,60,55,
+57,58,0,0,1,0,143,254,244,5,135,4,190,0,50,0,0,0,35,34,39,6,7,22,51,50,55,
+54,51,50,22,21,16,3,39,54,53,52,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,
+21,6,35,34,36,38,53,52,18,55,22,51,50,55,21,3,131,223,127,98,89,30,149,203,
+129,186,76,35,145,160,170,121,127,67,74,33,78,182,131,190,181,95,200,168,
+131,101,95,135,229,254,233,129,88,109,147,193,207,157,3,238,14,156,178,24,
+24,10,213,202,254,243,254,232,65,242,237,134,122,10,24,30,16,137,158,65,22,
+164,24,104,225,189,176,1,63,207,37,45,159,0,255,255,0,113,254,244,6,248,4,
+190,16,34,5,153,0,0,16,3,2,130,1,113,0,0,255,255,0,113,254,244,8,155,4,219,
+16,34,5,154,0,0,16,3,2,130,3,20,0,0,0,1,0,143,255,31,7,18,4,190,0,66,0,0,
+0,21,20,6,7,39,38,2,39,7,22,21,20,3,39,54,17,52,35,34,7,6,35,34,39,21,20,
+22,22,51,50,55,21,6,35,34,36,38,53,52,18,55,22,51,50,55,21,6,35,34,39,6,7,
+22,51,50,55,54,51,32,19,23,54,53,52,39,55,7,18,96,110,158,39,90,66,4,56,66,
+141,43,82,13,65,135,158,190,181,86,183,153,131,101,95,135,215,254,252,121,
+88,109,147,193,207,157,145,223,127,98,89,30,149,203,131,207,100,43,1,60,71,
+7,88,50,168,2,104,137,149,250,150,52,243,1,2,49,6,90,166,231,254,248,30,248,
+1,0,219,8,22,30,16,137,158,65,22,164,24,104,225,189,176,1,63,207,37,45,159,
+49,14,156,178,24,24,14,253,177,3,164,166,127,131,58,255,255,0,113,255,31,
+8,131,4,190,16,34,5,153,0,0,16,3,2,133,1,113,0,0,255,255,0,113,255,31,10,
+38,4,219,16,34,5,154,0,0,16,3,2,133,3,20,0,0,255,255,0,143,255,31,10,27,4,
+190,16,34,2,133,0,0,16,3,5,157,7,111,0,0,255,255,0,113,255,31,11,139,4,190,
+16,34,5,153,0,0,16,35,2,133,1,113,0,0,16,3,5,157,8,223,0,0,255,255,0,113,
+254,33,8,131,4,190,16,34,5,153,0,0,16,35,2,133,1,113,0,0,16,3,5,190,4,20,
+0,0,255,255,255,254,254,152,9,229,6,53,16,34,5,158,0,0,16,3,2,133,2,211,0,
+0,255,255,0,113,254,152,10,176,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,
+255,68,16,3,2,133,3,158,0,0,255,255,0,143,255,31,8,215,4,219,16,34,5,159,
+0,0,16,3,2,133,1,197,0,0,255,255,0,113,255,31,10,71,4,219,16,34,5,153,0,0,
+16,35,5,159,1,113,0,0,16,3,2,133,3,53,0,0,255,255,0,113,255,31,8,172,6,111,
+16,34,5,160,0,0,16,3,2,133,1,154,0,0,255,255,0,113,255,31,10,28,6,111,16,
+34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,2,133,3,10,0,0,255,255,0,143,254,
+152,9,17,4,221,16,34,2,133,0,0,16,3,5,161,7,111,0,0,255,255,0,113,254,152,
+10,129,4,221,16,34,5,153,0,0,16,35,2,133,1,113,0,0,16,3,5,161,8,223,0,0,255,
+255,0,143,254,152,9,201,4,197,16,34,2,133,0,0,16,3,5,162,7,111,0,0,255,255,
+0,113,254,152,11,57,4,197,16,34,5,153,0,0,16,35,2,133,1,113,0,0,16,3,5,162,
+8,223,0,0,255,255,0,143,254,244,8,109,4,190,16,34,2,130,0,0,16,3,5,157,5,
+193,0,0,255,255,0,113,254,244,9,221,4,190,16,34,5,153,0,0,16,35,2,130,1,113,
+0,0,16,3,5,157,7,49,0,0,255,255,0,113,254,33,6,248,4,190,16,34,5,153,0,0,
+16,35,2,130,1,113,0,0,16,3,5,190,4,20,0,0,255,255,255,254,254,152,8,90,6,
+53,16,34,5,158,0,0,16,3,2,130,2,211,0,0,255,255,0,113,254,152,9,37,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,130,3,158,0,0,255,255,0,
+143,254,244,7,76,4,219,16,34,5,159,0,0,16,3,2,130,1,197,0,0,255,255,0,113,
+254,244,8,188,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,130,3,53,
+0,0,255,255,0,113,254,244,7,33,6,111,16,34,5,160,0,0,16,3,2,130,1,154,0,0,
+255,255,0,113,254,244,8,145,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,
+3,2,130,3,10,0,0,255,255,0,143,254,152,7,180,4,221,16,34,2,130,0,0,16,3,5,
+161,6,18,0,0,255,255,0,113,254,152,9,37,4,221,16,34,5,153,0,0,16,35,2,130,
+1,113,0,0,16,3,5,161,7,131,0,0,255,255,0,143,254,152,8,27,4,197,16,34,2,130,
+0,0,16,3,5,162,5,193,0,0,255,255,0,113,254,152,9,139,4,197,16,34,5,153,0,
+0,16,35,2,130,1,113,0,0,16,3,5,162,7,49,0,0,0,1,0,143,255,242,6,92,4,190,
+0,57,0,0,0,21,20,6,7,39,38,38,35,34,7,6,35,34,39,21,20,22,22,51,50,55,21,
+6,35,34,36,38,53,52,18,55,22,51,50,55,21,6,35,34,39,6,7,22,51,50,55,54,51,
+50,22,23,23,54,53,52,39,55,6,92,96,111,174,41,106,58,24,82,119,131,190,181,
+95,200,168,168,117,115,168,229,254,233,129,88,109,147,193,207,157,145,223,
+127,98,89,30,149,203,131,123,78,26,125,154,49,6,88,49,168,2,211,137,150,250,
+149,57,209,219,8,16,30,16,137,158,65,36,163,39,104,225,189,176,1,63,207,37,
+45,159,49,14,156,178,24,16,8,219,252,2,164,166,127,131,57,255,255,0,113,255,
+242,7,205,4,190,16,34,5,153,0,0,16,3,2,162,1,113,0,0,255,255,0,113,255,158,
+9,112,4,219,16,34,5,154,0,0,16,3,2,162,3,20,0,0,255,255,0,143,255,156,9,100,
+4,190,16,34,2,162,0,0,16,3,5,157,6,184,0,0,255,255,0,113,255,156,10,213,4,
+190,16,34,5,153,0,0,16,35,2,162,1,113,0,0,16,3,5,157,8,41,0,0,255,255,0,113,
+254,33,7,205,4,190,16,34,5,153,0,0,16,35,2,162,1,113,0,0,16,3,5,190,4,20,
+0,0,255,255,255,254,254,152,9,47,6,53,16,34,5,158,0,0,16,3,2,162,2,211,0,
+0,255,255,0,113,254,152,9,250,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,
+255,68,16,3,2,162,3,158,0,0,255,255,0,143,255,158,8,33,4,219,16,34,5,159,
+0,0,16,3,2,162,1,197,0,0,255,255,0,113,255,158,9,145,4,219,16,34,5,153,0,
+0,16,35,5,159,1,113,0,0,16,3,2,162,3,53,0,0,255,255,0,113,255,158,7,246,6,
+111,16,34,5,160,0,0,16,3,2,162,1,154,0,0,255,255,0,113,255,158,9,102,6,111,
+16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,2,162,3,10,0,0,255,255,0,143,254,
+152,8,17,4,221,16,34,2,162,0,0,16,3,5,161,6,111,0,0,255,255,0,113,254,152,
+9,129,4,221,16,34,5,153,0,0,16,35,2,162,1,113,0,0,16,3,5,161,7,223,0,0,255,
+255,0,143,254,152,9,18,4,197,16,34,2,162,0,0,16,3,5,162,6,184,0,0,255,255,
+0,113,254,152,10,131,4,197,16,34,5,153,0,0,16,35,2,162,1,113,0,0,16,3,5,162,
+8,41,0,0,255,255,0,143,255,156,7,125,4,190,16,34,2,111,0,0,16,3,5,157,4,209,
+0,0,255,255,0,113,255,156,8,238,4,190,16,34,5,153,0,0,16,35,2,111,1,113,0,
+0,16,3,5,157,6,66,0,0,255,255,0,113,254,33,5,250,4,190,16,34,5,153,0,0,16,
+35,2,111,1,113,0,0,16,3,5,190,4,20,0,0,255,255,255,254,254,152,7,92,6,53,
+16,34,5,158,0,0,16,3,2,111,2,211,0,0,255,255,0,113,254,152,8,39,6,53,16,35,
+5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,111,3,158,0,0,255,255,0,143,
+255,158,6,78,4,219,16,34,5,159,0,0,16,3,2,111,1,197,0,0,255,255,0,113,255,
+158,7,190,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,111,3,53,0,0,
+255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,2,111,1,154,0,0,255,
+255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,2,
+111,3,10,0,0,255,255,0,143,254,152,6,115,4,221,16,34,2,111,0,0,16,3,5,161,
+4,209,0,0,255,255,0,113,254,152,7,228,4,221,16,34,5,153,0,0,16,35,2,111,1,
+113,0,0,16,3,5,161,6,66,0,0,255,255,0,143,254,152,7,43,4,197,16,34,2,111,
+0,0,16,3,5,162,4,209,0,0,255,255,0,113,254,152,8,156,4,197,16,34,5,153,0,
+0,16,35,2,111,1,113,0,0,16,3,5,162,6,66,0,0,0,1,0,137,255,229,5,35,4,190,
+0,43,0,0,0,2,21,20,22,51,50,54,53,52,38,39,38,38,53,52,54,51,50,22,23,7,38,
+38,35,34,21,20,22,23,22,22,21,20,6,6,35,34,0,17,52,18,55,51,1,162,111,189,
+178,133,139,41,41,47,47,160,133,78,116,58,113,43,65,37,111,39,41,47,47,108,
+205,135,246,254,223,107,121,196,3,213,254,209,158,188,191,135,117,60,106,
+72,88,131,78,131,155,61,59,125,45,37,121,58,102,78,90,127,82,117,190,113,
+1,31,1,4,164,1,64,190,255,255,0,113,255,229,6,148,4,190,16,34,5,153,0,0,16,
+3,2,191,1,113,0,0,255,255,0,113,255,158,8,55,4,219,16,34,5,154,0,0,16,3,2,
+191,3,20,0,0,0,1,0,137,255,47,5,156,4,190,0,56,0,0,0,38,35,34,21,20,23,54,
+51,50,22,21,16,3,39,54,53,52,38,35,34,7,22,21,20,6,6,35,34,0,17,52,18,55,
+51,6,2,21,20,22,51,50,54,53,52,38,39,38,38,53,52,54,51,50,22,23,7,4,135,65,
+37,111,58,67,59,146,160,170,121,127,68,74,24,29,43,108,205,135,246,254,223,
+107,121,196,143,111,189,178,133,139,41,41,47,47,160,133,78,116,58,113,3,246,
+37,121,80,115,21,213,203,254,244,254,231,66,241,238,135,125,6,101,96,117,
+190,113,1,31,1,4,164,1,64,190,213,254,209,158,188,191,135,117,60,106,72,88,
+131,78,131,155,61,59,125,0,255,255,0,113,255,47,7,13,4,190,16,34,5,153,0,
+0,16,3,2,194,1,113,0,0,255,255,0,113,255,47,8,176,4,219,16,34,5,154,0,0,16,
+3,2,194,3,20,0,0,255,255,0,137,255,47,8,170,4,190,16,34,2,194,0,0,16,3,5,
+157,5,254,0,0,255,255,0,113,255,47,10,27,4,190,16,34,5,153,0,0,16,35,2,194,
+1,113,0,0,16,3,5,157,7,111,0,0,255,255,0,113,254,33,7,13,4,190,16,34,5,153,
+0,0,16,35,2,194,1,113,0,0,16,3,5,190,4,8,0,0,255,255,255,254,254,152,8,70,
+6,53,16,34,5,158,0,0,16,3,2,194,2,170,0,0,255,255,0,113,254,152,9,58,6,53,
+16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,194,3,158,0,0,255,255,
+0,143,255,47,7,76,4,219,16,34,5,159,0,0,16,3,2,194,1,176,0,0,255,255,0,113,
+255,47,8,189,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,194,3,33,
+0,0,255,255,0,113,255,47,7,54,6,111,16,34,5,160,0,0,16,3,2,194,1,154,0,0,
+255,255,0,113,255,47,8,166,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,
+3,2,194,3,10,0,0,255,255,0,137,254,152,7,160,4,221,16,34,2,194,0,0,16,3,5,
+161,5,254,0,0,255,255,0,113,254,152,9,17,4,221,16,34,5,153,0,0,16,35,2,194,
+1,113,0,0,16,3,5,161,7,111,0,0,255,255,0,137,254,152,8,88,4,197,16,34,2,194,
+0,0,16,3,5,162,5,254,0,0,255,255,0,113,254,152,9,201,4,197,16,34,5,153,0,
+0,16,35,2,194,1,113,0,0,16,3,5,162,7,111,0,0,0,1,0,137,255,211,6,164,4,190,
+0,63,0,0,0,21,20,6,7,39,2,2,35,35,22,21,20,6,6,35,34,0,17,52,18,55,51,6,2,
+21,20,22,51,50,54,53,52,38,39,38,38,53,52,54,51,50,22,23,7,38,38,35,34,21,
+20,22,23,54,51,50,18,19,23,54,53,52,39,55,6,164,96,111,174,45,111,61,17,35,
+108,205,135,246,254,223,107,121,196,143,111,189,178,133,139,41,41,47,47,160,
+133,78,116,58,113,43,65,37,111,33,35,41,47,129,160,51,6,88,49,168,2,129,137,
+150,250,149,57,1,15,1,30,90,86,117,190,113,1,31,1,4,164,1,64,190,213,254,
+209,158,188,191,135,117,60,106,72,88,131,78,131,155,61,59,125,45,37,121,53,
+93,69,14,254,234,254,194,2,164,166,127,131,57,255,255,0,113,255,211,8,21,
+4,190,16,34,5,153,0,0,16,3,2,210,1,113,0,0,255,255,0,113,255,158,9,184,4,
+219,16,34,5,154,0,0,16,3,2,210,3,20,0,0,255,255,0,137,255,156,9,172,4,190,
+16,34,2,210,0,0,16,3,5,157,7,0,0,0,255,255,0,113,255,156,11,29,4,190,16,34,
+5,153,0,0,16,35,2,210,1,113,0,0,16,3,5,157,8,113,0,0,255,255,0,113,254,33,
+8,21,4,190,16,34,5,153,0,0,16,35,2,210,1,113,0,0,16,3,5,190,4,8,0,0,255,255,
+255,254,254,152,9,78,6,53,16,34,5,158,0,0,16,3,2,210,2,170,0,0,255,255,0,
+113,254,152,10,66,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,
+2,210,3,158,0,0,255,255,0,143,255,158,8,84,4,219,16,34,5,159,0,0,16,3,2,210,
+1,176,0,0,255,255,0,113,255,158,9,197,4,219,16,34,5,153,0,0,16,35,5,159,1,
+113,0,0,16,3,2,210,3,33,0,0,255,255,0,113,255,158,8,62,6,111,16,34,5,160,
+0,0,16,3,2,210,1,154,0,0,255,255,0,113,255,158,9,174,6,111,16,34,5,153,0,
+0,16,35,5,160,1,113,0,0,16,3,2,210,3,10,0,0,255,255,0,137,254,152,8,88,4,
+221,16,34,2,210,0,0,16,3,5,161,6,182,0,0,255,255,0,113,254,152,9,201,4,221,
+16,34,5,153,0,0,16,35,2,210,1,113,0,0,16,3,5,161,8,39,0,0,255,255,0,137,254,
+152,9,90,4,197,16,34,2,210,0,0,16,3,5,162,7,0,0,0,255,255,0,113,254,152,10,
+203,4,197,16,34,5,153,0,0,16,35,2,210,1,113,0,0,16,3,5,162,8,113,0,0,255,
+255,0,137,255,156,7,219,4,190,16,34,2,191,0,0,16,3,5,157,5,47,0,0,255,255,
+0,113,255,156,9,76,4,190,16,34,5,153,0,0,16,35,2,191,1,113,0,0,16,3,5,157,
+6,160,0,0,255,255,0,113,254,33,6,148,4,190,16,34,5,153,0,0,16,35,2,191,1,
+113,0,0,16,3,5,190,4,8,0,0,255,255,255,254,254,152,7,205,6,53,16,34,5,158,
+0,0,16,3,2,191,2,170,0,0,255,255,0,113,254,152,8,193,6,53,16,35,5,158,0,203,
+0,0,16,35,5,153,0,0,255,68,16,3,2,191,3,158,0,0,255,255,0,143,255,158,6,211,
+4,219,16,34,5,159,0,0,16,3,2,191,1,176,0,0,255,255,0,113,255,158,8,68,4,219,
+16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,191,3,33,0,0,255,255,0,113,255,
+158,6,189,6,111,16,34,5,160,0,0,16,3,2,191,1,154,0,0,255,255,0,113,255,158,
+8,45,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,2,191,3,10,0,0,255,
+255,0,137,254,152,6,209,4,221,16,34,2,191,0,0,16,3,5,161,5,47,0,0,255,255,
+0,113,254,152,8,66,4,221,16,34,5,153,0,0,16,35,2,191,1,113,0,0,16,3,5,161,
+6,160,0,0,255,255,0,137,254,152,7,137,4,197,16,34,2,191,0,0,16,3,5,162,5,
+47,0,0,255,255,0,113,254,152,8,250,4,197,16,34,5,153,0,0,16,35,2,191,1,113,
+0,0,16,3,5,162,6,160,0,0,0,1,0,72,0,0,3,186,4,190,0,28,0,0,0,7,23,54,51,50,
+22,21,20,7,35,54,53,52,35,34,7,39,19,22,51,50,55,21,6,35,34,39,7,1,33,41,
+6,131,162,190,201,123,203,152,221,158,147,166,168,157,181,215,161,147,229,
+117,99,51,2,213,90,2,90,209,176,186,152,160,180,223,117,99,2,157,45,45,159,
+49,18,203,255,255,0,113,0,0,5,43,4,190,16,34,5,153,0,0,16,3,2,239,1,113,0,
+0,255,255,0,113,255,158,6,206,4,219,16,34,5,154,0,0,16,3,2,239,3,20,0,0,0,
+1,0,72,0,0,5,231,4,221,0,45,0,0,0,21,20,6,7,39,38,2,39,6,35,34,39,7,6,7,23,
+54,51,50,22,21,20,7,35,54,53,52,35,34,7,39,19,22,51,50,55,22,18,23,23,54,
+53,52,39,55,5,231,96,110,158,37,117,104,125,186,117,99,51,22,41,6,131,162,
+190,201,123,203,152,221,158,147,166,168,157,181,215,161,129,140,30,7,88,50,
+168,4,86,137,150,250,149,51,178,1,4,123,30,18,203,96,90,2,90,209,176,186,
+152,160,180,223,117,99,2,157,45,45,141,254,217,176,2,164,166,127,131,57,255,
+255,0,113,0,0,7,88,4,221,16,34,5,153,0,0,16,3,2,242,1,113,0,0,255,255,0,113,
+255,158,8,251,4,221,16,34,5,154,0,0,16,3,2,242,3,20,0,0,255,255,0,72,255,
+156,8,240,4,221,16,34,2,242,0,0,16,3,5,157,6,68,0,0,255,255,0,113,255,156,
+10,96,4,221,16,34,5,153,0,0,16,35,2,242,1,113,0,0,16,3,5,157,7,180,0,0,255,
+255,0,113,254,33,7,88,4,221,16,34,5,153,0,0,16,35,2,242,1,113,0,0,16,3,5,
+190,3,156,0,0,255,255,255,254,254,152,8,186,6,53,16,34,5,158,0,0,16,3,2,242,
+2,211,0,0,255,255,0,113,254,152,9,133,6,53,16,35,5,158,0,203,0,0,16,35,5,
+153,0,0,255,68,16,3,2,242,3,158,0,0,255,255,0,143,255,158,7,172,4,221,16,
+34,5,159,0,0,16,3,2,242,1,197,0,0,255,255,0,113,255,158,9,28,4,221,16,34,
+5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,242,3,53,0,0,255,255,0,113,255,158,
+7,129,6,111,16,34,5,160,0,0,16,3,2,242,1,154,0,0,255,255,0,113,255,158,8,
+241,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,2,242,3,10,0,0,255,255,
+0,72,254,152,7,199,4,221,16,34,2,242,0,0,16,3,5,161,6,37,0,0,255,255,0,113,
+254,152,9,56,4,221,16,34,5,153,0,0,16,35,2,242,1,113,0,0,16,3,5,161,7,150,
+0,0,255,255,0,72,254,152,8,158,4,221,16,34,2,242,0,0,16,3,5,162,6,68,0,0,
+255,255,0,113,254,152,10,14,4,221,16,34,5,153,0,0,16,35,2,242,1,113,0,0,16,
+3,5,162,7,180,0,0,255,255,0,72,255,156,7,0,4,190,16,34,2,239,0,0,16,3,5,157,
+4,84,0,0,255,255,0,113,255,156,8,113,4,190,16,34,5,153,0,0,16,35,2,239,1,
+113,0,0,16,3,5,157,5,197,0,0,255,255,0,113,254,33,5,43,4,190,16,34,5,153,
+0,0,16,35,2,239,1,113,0,0,16,3,5,190,3,156,0,0,255,255,255,254,254,152,6,
+141,6,53,16,34,5,158,0,0,16,3,2,239,2,211,0,0,255,255,0,113,254,152,7,88,
+6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,2,239,3,158,0,0,255,
+255,0,143,255,158,5,127,4,219,16,34,5,159,0,0,16,3,2,239,1,197,0,0,255,255,
+0,113,255,158,6,239,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,2,239,
+3,53,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,2,239,1,154,
+0,0,255,255,0,113,255,158,6,196,6,78,16,34,5,153,0,0,16,35,5,164,1,113,0,
+0,16,3,2,239,3,10,0,0,255,255,0,72,254,152,5,246,4,221,16,34,2,239,0,0,16,
+3,5,161,4,84,0,0,255,255,0,113,254,152,7,103,4,221,16,34,5,153,0,0,16,35,
+2,239,1,113,0,0,16,3,5,161,5,197,0,0,255,255,0,72,254,152,6,174,4,197,16,
+34,2,239,0,0,16,3,5,162,4,84,0,0,255,255,0,113,254,152,8,31,4,197,16,34,5,
+153,0,0,16,35,2,239,1,113,0,0,16,3,5,162,5,197,0,0,0,1,0,143,255,233,7,57,
+4,195,0,33,0,0,0,51,50,4,18,21,16,5,1,6,17,20,22,51,50,55,21,6,35,34,36,2,
+53,16,37,1,54,17,52,38,35,34,7,53,4,166,90,168,1,2,143,254,90,252,129,215,
+220,188,76,57,55,90,168,254,254,144,1,166,3,131,211,219,188,76,57,4,195,150,
+254,234,187,254,96,211,3,242,117,254,236,217,230,21,170,21,150,1,23,186,1,
+160,211,252,16,117,1,18,217,230,21,170,255,255,0,113,255,233,8,170,4,195,
+16,34,5,153,0,0,16,3,3,15,1,113,0,0,255,255,0,113,255,158,10,77,4,219,16,
+34,5,154,0,0,16,3,3,15,3,20,0,0,0,1,0,143,255,233,9,145,4,195,0,55,0,0,0,
+21,20,6,7,39,2,2,35,35,22,21,16,5,1,6,17,20,22,51,50,55,21,6,35,34,36,2,53,
+16,37,1,54,17,52,38,35,34,7,53,54,51,50,4,23,54,51,50,18,19,23,54,53,52,39,
+55,9,145,96,110,175,45,110,62,12,10,254,90,252,129,215,220,188,76,57,55,90,
+168,254,254,144,1,166,3,131,211,219,188,76,57,55,90,180,1,17,65,25,28,129,
+160,51,7,88,50,168,3,37,137,150,250,149,57,1,14,1,31,67,62,254,96,211,3,242,
+117,254,236,217,230,21,170,21,150,1,23,186,1,160,211,252,16,117,1,18,217,
+230,21,170,21,175,157,6,254,233,254,195,2,164,166,127,131,57,0,255,255,0,
+113,255,233,11,2,4,195,16,34,5,153,0,0,16,3,3,18,1,113,0,0,255,255,0,113,
+255,158,12,165,4,219,16,34,5,154,0,0,16,3,3,18,3,20,0,0,255,255,0,143,255,
+156,12,154,4,195,16,34,3,18,0,0,16,3,5,157,9,238,0,0,255,255,0,113,255,156,
+14,10,4,195,16,34,5,153,0,0,16,35,3,18,1,113,0,0,16,3,5,157,11,94,0,0,255,
+255,0,113,254,33,11,2,4,195,16,34,5,153,0,0,16,35,3,18,1,113,0,0,16,3,5,190,
+5,88,0,0,255,255,255,254,254,152,12,59,6,53,16,34,5,158,0,0,16,3,3,18,2,170,
+0,0,255,255,0,113,254,152,13,47,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,
+0,255,68,16,3,3,18,3,158,0,0,255,255,0,143,255,158,11,55,4,219,16,34,5,159,
+0,0,16,3,3,18,1,166,0,0,255,255,0,113,255,158,12,168,4,219,16,34,5,153,0,
+0,16,35,5,159,1,113,0,0,16,3,3,18,3,23,0,0,255,255,0,113,255,158,11,43,6,
+143,16,34,5,163,0,0,16,3,3,18,1,154,0,0,255,255,0,113,255,158,12,155,6,143,
+16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,3,18,3,10,0,0,255,255,0,143,254,
+152,11,70,4,221,16,34,3,18,0,0,16,3,5,161,9,164,0,0,255,255,0,113,254,152,
+12,182,4,221,16,34,5,153,0,0,16,35,3,18,1,113,0,0,16,3,5,161,11,20,0,0,255,
+255,0,143,254,152,12,72,4,197,16,34,3,18,0,0,16,3,5,162,9,238,0,0,255,255,
+0,113,254,152,13,184,4,197,16,34,5,153,0,0,16,35,3,18,1,113,0,0,16,3,5,162,
+11,94,0,0,255,255,0,143,255,156,10,121,4,195,16,34,3,15,0,0,16,3,5,157,7,
+205,0,0,255,255,0,113,255,156,11,233,4,195,16,34,5,153,0,0,16,35,3,15,1,113,
+0,0,16,3,5,157,9,61,0,0,255,255,0,113,254,33,8,170,4,195,16,34,5,153,0,0,
+16,35,3,15,1,113,0,0,16,3,5,190,5,88,0,0,255,255,255,254,254,152,9,227,6,
+53,16,34,5,158,0,0,16,3,3,15,2,170,0,0,255,255,0,113,254,152,10,215,6,53,
+16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,15,3,158,0,0,255,255,
+0,143,255,158,8,223,4,219,16,34,5,159,0,0,16,3,3,15,1,166,0,0,255,255,0,113,
+255,158,10,80,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,3,15,3,23,
+0,0,255,255,0,113,255,158,8,211,6,143,16,34,5,163,0,0,16,3,3,15,1,154,0,0,
+255,255,0,113,255,158,10,67,6,143,16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,
+3,3,15,3,10,0,0,255,255,0,143,254,152,8,254,4,221,16,34,3,15,0,0,16,3,5,161,
+7,92,0,0,255,255,0,113,254,152,10,111,4,221,16,34,5,153,0,0,16,35,3,15,1,
+113,0,0,16,3,5,161,8,205,0,0,255,255,0,143,254,152,9,254,4,197,16,34,3,15,
+0,0,16,3,5,162,7,164,0,0,255,255,0,113,254,152,11,110,4,197,16,34,5,153,0,
+0,16,35,3,15,1,113,0,0,16,3,5,162,9,20,0,0,0,2,0,143,255,227,5,94,4,190,0,
+35,0,44,0,0,0,7,6,7,22,4,21,20,6,35,34,38,53,52,55,4,17,20,23,35,38,53,16,
+0,55,54,55,35,32,37,53,22,33,32,55,21,2,53,16,37,6,21,20,22,51,4,174,172,
+117,61,254,1,16,200,175,182,221,16,254,219,29,176,29,1,21,248,51,84,43,254,
+174,255,0,237,1,101,1,92,244,154,254,94,22,133,115,3,246,19,116,109,14,238,
+178,164,205,240,223,80,78,62,254,175,101,92,92,105,1,0,1,32,25,115,102,70,
+161,65,65,159,252,106,193,1,20,2,86,82,153,150,255,255,0,113,255,227,6,207,
+4,190,16,34,5,153,0,0,16,3,3,47,1,113,0,0,255,255,0,113,255,158,8,114,4,219,
+16,34,5,154,0,0,16,3,3,47,3,20,0,0,0,2,0,143,255,227,6,154,4,190,0,44,0,53,
+0,0,0,33,32,37,4,17,20,7,39,54,53,52,38,39,6,7,6,7,22,4,21,20,6,35,34,38,
+53,52,55,4,17,20,23,35,38,53,16,0,55,54,55,35,32,37,53,0,37,6,21,20,22,51,
+50,53,1,164,1,125,1,117,1,4,1,0,72,139,47,78,72,157,197,113,61,254,1,16,200,
+175,182,221,16,254,219,29,176,29,1,21,248,51,84,2,254,151,254,238,4,8,254,
+94,22,133,115,192,4,125,65,239,254,162,205,205,37,180,189,116,219,84,36,13,
+112,109,14,238,178,164,205,240,223,80,78,62,254,175,101,92,92,105,1,0,1,32,
+25,115,102,70,161,253,160,2,86,82,153,150,193,0,255,255,0,113,255,227,8,11,
+4,190,16,34,5,153,0,0,16,3,3,50,1,113,0,0,255,255,0,113,255,158,9,174,4,219,
+16,34,5,154,0,0,16,3,3,50,3,20,0,0,0,2,0,143,255,227,8,158,4,190,0,61,0,70,
+0,0,0,21,20,6,7,39,2,39,7,22,21,20,7,39,54,53,52,2,39,6,7,6,7,22,4,21,20,
+6,35,34,38,53,52,55,4,17,20,23,35,38,53,16,0,55,54,55,32,37,53,22,33,32,37,
+22,18,23,23,54,53,52,39,55,0,37,6,21,20,22,51,50,53,8,158,97,110,158,76,139,
+6,41,29,141,18,71,56,153,209,107,65,254,1,16,200,175,182,221,16,254,219,29,
+176,29,1,21,248,51,84,254,155,254,238,254,1,125,1,117,1,4,202,232,74,6,88,
+49,168,252,61,254,94,22,133,115,192,4,4,137,150,249,150,51,1,0,168,2,170,
+164,151,144,23,129,131,166,1,59,90,34,17,106,113,14,238,178,164,205,240,223,
+80,78,62,254,175,101,92,92,105,1,0,1,32,25,115,102,70,161,65,65,145,254,182,
+219,2,164,166,127,131,57,253,211,2,86,82,153,150,193,255,255,0,113,255,227,
+10,15,4,190,16,34,5,153,0,0,16,3,3,53,1,113,0,0,255,255,0,113,255,158,11,
+178,4,219,16,34,5,154,0,0,16,3,3,53,3,20,0,0,255,255,0,143,255,156,11,166,
+4,190,16,34,3,53,0,0,16,3,5,157,8,250,0,0,255,255,0,113,255,156,13,22,4,190,
+16,34,5,153,0,0,16,35,3,53,1,113,0,0,16,3,5,157,10,106,0,0,255,255,0,113,
+254,33,10,15,4,190,16,34,5,153,0,0,16,35,3,53,1,113,0,0,16,3,5,190,4,86,0,
+0,255,255,255,254,254,152,11,113,6,53,16,34,5,158,0,0,16,3,3,53,2,211,0,0,
+255,255,0,113,254,152,12,60,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,
+68,16,3,3,53,3,158,0,0,255,255,0,143,255,158,10,140,4,219,16,34,5,159,0,0,
+16,3,3,53,1,238,0,0,255,255,0,113,255,158,11,252,4,219,16,34,5,153,0,0,16,
+35,5,159,1,113,0,0,16,3,3,53,3,94,0,0,255,255,0,113,255,158,10,56,6,111,16,
+34,5,160,0,0,16,3,3,53,1,154,0,0,255,255,0,113,255,158,11,168,6,111,16,34,
+5,153,0,0,16,35,5,160,1,113,0,0,16,3,3,53,3,10,0,0,255,255,0,143,254,152,
+10,125,4,221,16,34,3,53,0,0,16,3,5,161,8,219,0,0,255,255,0,113,254,152,11,
+238,4,221,16,34,5,153,0,0,16,35,3,53,1,113,0,0,16,3,5,161,10,76,0,0,255,255,
+0,143,254,152,11,84,4,197,16,34,3,53,0,0,16,3,5,162,8,250,0,0,255,255,0,113,
+254,152,12,196,4,197,16,34,5,153,0,0,16,35,3,53,1,113,0,0,16,3,5,162,10,106,
+0,0,255,255,0,143,255,156,9,168,4,190,16,34,3,50,0,0,16,3,5,157,6,252,0,0,
+255,255,0,113,255,156,11,25,4,190,16,34,5,153,0,0,16,35,3,50,1,113,0,0,16,
+3,5,157,8,109,0,0,255,255,0,113,254,33,8,11,4,190,16,34,5,153,0,0,16,35,3,
+50,1,113,0,0,16,3,5,190,4,80,0,0,255,255,255,254,254,152,9,109,6,53,16,34,
+5,158,0,0,16,3,3,50,2,211,0,0,255,255,0,113,254,152,10,56,6,53,16,35,5,158,
+0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,50,3,158,0,0,255,255,0,143,255,158,
+8,136,4,219,16,34,5,159,0,0,16,3,3,50,1,238,0,0,255,255,0,113,255,158,9,248,
+4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,3,50,3,94,0,0,255,255,0,
+113,255,158,8,52,6,111,16,34,5,160,0,0,16,3,3,50,1,154,0,0,255,255,0,113,
+255,158,9,164,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,3,50,3,10,
+0,0,255,255,0,143,254,152,8,101,4,221,16,34,3,50,0,0,16,3,5,161,6,195,0,0,
+255,255,0,113,254,152,9,213,4,221,16,34,5,153,0,0,16,35,3,50,1,113,0,0,16,
+3,5,161,8,51,0,0,255,255,0,143,254,152,9,86,4,197,16,34,3,50,0,0,16,3,5,162,
+6,252,0,0,255,255,0,113,254,152,10,199,4,197,16,34,5,153,0,0,16,35,3,50,1,
+113,0,0,16,3,5,162,8,109,0,0,0,2,0,143,255,227,7,117,4,221,0,52,0,61,0,0,
+0,21,20,6,7,39,38,2,39,6,7,6,7,22,4,21,20,6,35,34,38,53,52,55,4,17,20,23,
+35,38,53,16,0,55,54,55,35,32,37,53,22,33,32,55,22,18,23,23,54,53,52,39,55,
+0,37,6,21,20,22,51,50,53,7,117,97,110,158,37,118,105,98,160,117,61,254,1,
+16,200,175,182,221,16,254,219,29,176,29,1,21,248,51,84,43,254,174,255,0,237,
+1,101,1,92,244,129,139,31,6,88,49,168,253,102,254,94,22,133,115,192,4,86,
+137,150,250,149,51,176,1,8,123,24,19,116,109,14,238,178,164,205,240,223,80,
+78,62,254,175,101,92,92,105,1,0,1,32,25,115,102,70,161,65,65,141,254,217,
+176,2,164,166,127,131,57,253,129,2,86,82,153,150,193,255,255,0,113,255,227,
+8,230,4,221,16,34,5,153,0,0,16,3,3,82,1,113,0,0,255,255,0,113,255,158,10,
+137,4,221,16,34,5,154,0,0,16,3,3,82,3,20,0,0,255,255,0,143,255,156,10,125,
+4,221,16,34,3,82,0,0,16,3,5,157,7,209,0,0,255,255,0,113,255,156,11,238,4,
+221,16,34,5,153,0,0,16,35,3,82,1,113,0,0,16,3,5,157,9,66,0,0,255,255,0,113,
+254,33,8,230,4,221,16,34,5,153,0,0,16,35,3,82,1,113,0,0,16,3,5,190,4,86,0,
+0,255,255,255,254,254,152,10,72,6,53,16,34,5,158,0,0,16,3,3,82,2,211,0,0,
+255,255,0,113,254,152,11,19,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,
+68,16,3,3,82,3,158,0,0,255,255,0,143,255,158,9,99,4,221,16,34,5,159,0,0,16,
+3,3,82,1,238,0,0,255,255,0,113,255,158,10,211,4,221,16,34,5,153,0,0,16,35,
+5,159,1,113,0,0,16,3,3,82,3,94,0,0,255,255,0,113,255,158,9,15,6,111,16,34,
+5,160,0,0,16,3,3,82,1,154,0,0,255,255,0,113,255,158,10,127,6,111,16,34,5,
+153,0,0,16,35,5,160,1,113,0,0,16,3,3,82,3,10,0,0,255,255,0,143,254,152,9,
+84,4,221,16,34,3,82,0,0,16,3,5,161,7,178,0,0,255,255,0,113,254,152,10,197,
+4,221,16,34,5,153,0,0,16,35,3,82,1,113,0,0,16,3,5,161,9,35,0,0,255,255,0,
+143,254,152,10,43,4,221,16,34,3,82,0,0,16,3,5,162,7,209,0,0,255,255,0,113,
+254,152,11,156,4,221,16,34,5,153,0,0,16,35,3,82,1,113,0,0,16,3,5,162,9,66,
+0,0,255,255,0,143,255,156,8,154,4,190,16,34,3,47,0,0,16,3,5,157,5,238,0,0,
+255,255,0,113,255,156,10,10,4,190,16,34,5,153,0,0,16,35,3,47,1,113,0,0,16,
+3,5,157,7,94,0,0,255,255,0,113,254,33,6,207,4,190,16,34,5,153,0,0,16,35,3,
+47,1,113,0,0,16,3,5,190,4,86,0,0,255,255,255,254,254,152,8,49,6,53,16,34,
+5,158,0,0,16,3,3,47,2,211,0,0,255,255,0,113,254,152,8,252,6,53,16,35,5,158,
+0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,47,3,158,0,0,255,255,0,143,255,158,
+7,96,4,219,16,34,5,159,0,0,16,3,3,47,2,2,0,0,255,255,0,113,255,158,8,209,
+4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,3,47,3,115,0,0,255,255,0,
+113,255,158,6,248,6,111,16,34,5,160,0,0,16,3,3,47,1,154,0,0,255,255,0,113,
+255,158,8,104,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,3,47,3,10,
+0,0,255,255,0,143,254,152,7,144,4,221,16,34,3,47,0,0,16,3,5,161,5,238,0,0,
+255,255,0,113,254,152,9,0,4,221,16,34,5,153,0,0,16,35,3,47,1,113,0,0,16,3,
+5,161,7,94,0,0,255,255,0,143,254,152,8,72,4,197,16,34,3,47,0,0,16,3,5,162,
+5,238,0,0,255,255,0,113,254,152,9,184,4,197,16,34,5,153,0,0,16,35,3,47,1,
+113,0,0,16,3,5,162,7,94,0,0,0,2,0,143,255,227,5,94,4,190,0,35,0,44,0,0,0,
+33,35,22,23,22,0,17,20,7,35,54,53,16,37,22,21,20,6,35,34,38,53,52,36,55,38,
+39,38,39,53,22,33,32,55,21,0,54,53,52,39,4,17,20,51,4,72,254,174,43,84,51,
+248,1,20,28,177,29,254,219,17,222,182,174,201,1,17,254,62,116,173,153,244,
+1,92,1,100,238,253,43,133,23,254,94,193,3,215,102,115,25,254,224,255,0,105,
+92,92,101,1,81,62,78,80,223,240,205,164,178,238,14,109,116,19,41,159,65,65,
+161,252,108,150,153,82,86,2,254,236,193,255,255,0,113,255,227,6,207,4,190,
+16,34,5,153,0,0,16,3,3,111,1,113,0,0,255,255,0,113,255,158,8,114,4,219,16,
+34,5,154,0,0,16,3,3,111,3,20,0,0,0,2,0,143,255,227,7,117,4,221,0,52,0,61,
+0,0,0,21,20,6,7,39,38,2,39,6,33,35,22,23,22,0,17,20,7,35,54,53,16,37,22,21,
+20,6,35,34,38,53,52,36,55,38,39,38,39,53,22,33,32,55,22,18,23,23,54,53,52,
+39,55,0,54,53,52,39,4,17,20,51,7,117,97,110,158,37,116,105,235,254,219,43,
+84,51,248,1,20,28,177,29,254,219,17,222,182,174,201,1,17,254,62,116,173,153,
+244,1,92,1,100,238,129,139,31,6,88,49,168,251,43,133,23,254,94,193,4,86,137,
+150,250,149,51,178,1,4,123,53,102,115,25,254,224,255,0,105,92,92,101,1,81,
+62,78,80,223,240,205,164,178,238,14,109,116,19,41,159,65,65,141,254,217,176,
+2,164,166,127,131,57,251,172,150,153,82,86,2,254,236,193,255,255,0,113,255,
+227,8,230,4,221,16,34,5,153,0,0,16,3,3,114,1,113,0,0,255,255,0,113,255,158,
+10,137,4,221,16,34,5,154,0,0,16,3,3,114,3,20,0,0,255,255,0,143,255,156,10,
+125,4,221,16,34,3,114,0,0,16,3,5,157,7,209,0,0,255,255,0,113,255,156,11,238,
+4,221,16,34,5,153,0,0,16,35,3,114,1,113,0,0,16,3,5,157,9,66,0,0,255,255,0,
+113,254,33,8,230,4,221,16,34,5,153,0,0,16,35,3,114,1,113,0,0,16,3,5,190,4,
+121,0,0,255,255,255,254,254,152,10,72,6,53,16,34,5,158,0,0,16,3,3,114,2,211,
+0,0,255,255,0,113,254,152,11,19,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,
+0,255,68,16,3,3,114,3,158,0,0,255,255,0,143,255,158,9,78,4,221,16,34,5,159,
+0,0,16,3,3,114,1,217,0,0,255,255,0,113,255,158,10,191,4,221,16,34,5,153,0,
+0,16,35,5,159,1,113,0,0,16,3,3,114,3,74,0,0,255,255,0,113,255,158,9,15,6,
+111,16,34,5,160,0,0,16,3,3,114,1,154,0,0,255,255,0,113,255,158,10,127,6,111,
+16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,3,114,3,10,0,0,255,255,0,143,254,
+152,9,84,4,221,16,34,3,114,0,0,16,3,5,161,7,178,0,0,255,255,0,113,254,152,
+10,197,4,221,16,34,5,153,0,0,16,35,3,114,1,113,0,0,16,3,5,161,9,35,0,0,255,
+255,0,143,254,152,10,43,4,221,16,34,3,114,0,0,16,3,5,162,7,209,0,0,255,255,
+0,113,254,152,11,156,4,221,16,34,5,153,0,0,16,35,3,114,1,113,0,0,16,3,5,162,
+9,66,0,0,255,255,0,143,255,156,8,154,4,190,16,34,3,111,0,0,16,3,5,157,5,238,
+0,0,255,255,0,113,255,156,10,10,4,190,16,34,5,153,0,0,16,35,3,111,1,113,0,
+0,16,3,5,157,7,94,0,0,255,255,0,113,254,33,6,207,4,190,16,34,5,153,0,0,16,
+35,3,111,1,113,0,0,16,3,5,190,4,121,0,0,255,255,255,254,254,152,8,49,6,53,
+16,34,5,158,0,0,16,3,3,111,2,211,0,0,255,255,0,113,254,152,8,252,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,111,3,158,0,0,255,255,0,
+143,255,158,7,55,4,219,16,34,5,159,0,0,16,3,3,111,1,217,0,0,255,255,0,113,
+255,158,8,168,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,3,111,3,74,
+0,0,255,255,0,113,255,158,6,248,6,111,16,34,5,160,0,0,16,3,3,111,1,154,0,
+0,255,255,0,113,255,158,8,104,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,
+16,3,3,111,3,10,0,0,255,255,0,143,254,152,7,144,4,221,16,34,3,111,0,0,16,
+3,5,161,5,238,0,0,255,255,0,113,254,152,9,0,4,221,16,34,5,153,0,0,16,35,3,
+111,1,113,0,0,16,3,5,161,7,94,0,0,255,255,0,143,254,152,8,72,4,197,16,34,
+3,111,0,0,16,3,5,162,5,238,0,0,255,255,0,113,254,152,9,184,4,197,16,34,5,
+153,0,0,16,35,3,111,1,113,0,0,16,3,5,162,7,94,0,0,0,1,0,143,0,0,5,92,4,197,
+0,36,0,0,54,53,16,18,36,51,50,22,22,21,20,6,35,34,38,53,52,55,51,6,21,20,
+22,51,50,54,53,52,38,35,34,6,2,21,20,23,35,143,179,1,53,196,179,245,121,201,
+182,162,190,27,178,29,94,84,99,106,190,185,145,225,134,74,182,190,205,1,13,
+1,116,185,146,244,147,176,221,178,151,91,53,62,77,82,86,122,107,168,205,140,
+254,220,224,206,193,0,255,255,0,113,0,0,6,205,4,197,16,34,5,153,0,0,16,3,
+3,143,1,113,0,0,255,255,0,113,255,158,8,112,4,219,16,34,5,154,0,0,16,3,3,
+143,3,20,0,0,255,255,0,143,255,156,8,131,4,197,16,34,3,143,0,0,16,3,5,157,
+5,215,0,0,255,255,0,113,255,156,9,244,4,197,16,34,5,153,0,0,16,35,3,143,1,
+113,0,0,16,3,5,157,7,72,0,0,255,255,0,113,254,156,6,205,4,197,16,34,5,153,
+0,0,16,35,3,143,1,113,0,0,16,3,5,190,4,133,0,123,255,255,255,254,254,152,
+8,47,6,53,16,34,5,158,0,0,16,3,3,143,2,211,0,0,255,255,0,113,254,152,8,250,
+6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,143,3,158,0,0,255,
+255,0,143,255,158,7,94,4,219,16,34,5,159,0,0,16,3,3,143,2,2,0,0,255,255,0,
+113,255,158,8,207,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,3,143,
+3,115,0,0,255,255,0,113,255,158,6,246,6,111,16,34,5,160,0,0,16,3,3,143,1,
+154,0,0,255,255,0,113,255,158,8,102,6,111,16,34,5,153,0,0,16,35,5,160,1,113,
+0,0,16,3,3,143,3,10,0,0,255,255,0,143,254,152,7,49,4,221,16,34,3,143,0,0,
+16,3,5,161,5,143,0,0,255,255,0,113,254,152,8,162,4,221,16,34,5,153,0,0,16,
+35,3,143,1,113,0,0,16,3,5,161,7,0,0,0,255,255,0,143,254,152,8,49,4,197,16,
+34,3,143,0,0,16,3,5,162,5,215,0,0,255,255,0,113,254,152,9,162,4,197,16,34,
+5,153,0,0,16,35,3,143,1,113,0,0,16,3,5,162,7,72,0,0,0,1,0,41,0,0,3,29,4,190,
+0,19,0,0,18,51,50,55,21,0,17,20,22,23,35,38,17,16,19,6,35,34,39,53,203,215,
+184,195,254,190,84,92,196,154,238,52,69,230,147,4,145,45,157,254,221,254,
+207,133,217,111,190,1,15,1,28,1,13,8,49,159,255,255,0,113,0,0,4,142,4,190,
+16,34,5,153,0,0,16,3,3,159,1,113,0,0,255,255,0,113,255,158,5,244,4,219,16,
+34,5,154,0,0,16,3,3,159,2,215,0,0,0,1,0,41,0,0,4,35,4,199,0,28,0,0,18,51,
+50,55,22,18,21,20,3,39,54,53,52,39,0,17,20,22,23,35,38,17,16,19,6,35,34,39,
+53,203,215,196,217,111,117,154,121,111,115,254,207,84,92,196,154,238,52,69,
+230,147,4,145,54,80,255,0,162,248,255,0,66,215,219,184,137,254,226,254,217,
+133,217,111,190,1,15,1,28,1,13,8,49,159,255,255,0,113,0,0,5,148,4,199,16,
+34,5,153,0,0,16,3,3,162,1,113,0,0,255,255,0,113,255,158,6,250,4,219,16,34,
+5,154,0,0,16,3,3,162,2,215,0,0,0,1,0,41,0,0,5,207,4,199,0,45,0,0,0,21,20,
+6,7,39,38,39,35,22,21,16,3,39,54,53,52,39,0,17,20,22,23,35,38,17,16,19,6,
+35,34,39,53,22,51,50,55,22,18,23,23,54,53,52,39,55,5,207,96,111,158,51,96,
+8,2,56,141,43,49,254,221,84,92,196,154,238,52,69,230,147,162,215,196,217,
+173,184,41,6,88,49,168,4,4,137,150,249,150,51,244,164,23,45,254,236,254,241,
+31,229,248,203,131,254,236,254,221,133,217,111,190,1,15,1,28,1,13,8,49,159,
+45,54,162,254,174,203,2,164,166,127,131,57,255,255,0,113,0,0,7,64,4,199,16,
+34,5,153,0,0,16,3,3,165,1,113,0,0,255,255,0,113,255,158,8,227,4,219,16,34,
+5,154,0,0,16,3,3,165,3,20,0,0,255,255,0,41,255,156,8,215,4,199,16,34,3,165,
+0,0,16,3,5,157,6,43,0,0,255,255,0,113,255,156,10,72,4,199,16,34,5,153,0,0,
+16,35,3,165,1,113,0,0,16,3,5,157,7,156,0,0,255,255,0,113,254,33,7,64,4,199,
+16,34,5,153,0,0,16,35,3,165,1,113,0,0,16,3,5,190,3,82,0,0,255,255,255,254,
+254,152,8,162,6,53,16,34,5,158,0,0,16,3,3,165,2,211,0,0,255,255,0,113,254,
+152,9,109,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,165,3,
+158,0,0,255,255,0,143,255,158,7,209,4,219,16,34,5,159,0,0,16,3,3,165,2,2,
+0,0,255,255,0,113,255,158,9,66,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,
+0,16,3,3,165,3,115,0,0,255,255,0,111,255,158,7,105,6,78,16,34,5,164,0,0,16,
+3,3,165,1,154,0,0,255,255,0,113,255,158,8,217,6,78,16,34,5,153,0,0,16,35,
+5,164,1,113,0,0,16,3,3,165,3,10,0,0,255,255,0,41,254,152,7,205,4,221,16,34,
+3,165,0,0,16,3,5,161,6,43,0,0,255,255,0,113,254,152,9,62,4,221,16,34,5,153,
+0,0,16,35,3,165,1,113,0,0,16,3,5,161,7,156,0,0,255,255,0,41,254,152,8,133,
+4,199,16,34,3,165,0,0,16,3,5,162,6,43,0,0,255,255,0,113,254,152,9,246,4,199,
+16,34,5,153,0,0,16,35,3,165,1,113,0,0,16,3,5,162,7,156,0,0,255,255,0,41,255,
+156,7,49,4,199,16,34,3,162,0,0,16,3,5,157,4,133,0,0,255,255,0,113,255,156,
+8,162,4,199,16,34,5,153,0,0,16,35,3,162,1,113,0,0,16,3,5,157,5,246,0,0,255,
+255,0,113,254,33,5,148,4,199,16,34,5,153,0,0,16,35,3,162,1,113,0,0,16,3,5,
+190,3,82,0,0,255,255,255,254,254,152,6,246,6,53,16,34,5,158,0,0,16,3,3,162,
+2,211,0,0,255,255,0,113,254,152,7,193,6,53,16,35,5,158,0,203,0,0,16,35,5,
+153,0,0,255,68,16,3,3,162,3,158,0,0,255,255,0,143,255,158,6,37,4,219,16,34,
+5,159,0,0,16,3,3,162,2,2,0,0,255,255,0,113,255,158,7,150,4,219,16,34,5,153,
+0,0,16,35,5,159,1,113,0,0,16,3,3,162,3,115,0,0,255,255,0,111,255,158,5,189,
+6,78,16,34,5,164,0,0,16,3,3,162,1,154,0,0,255,255,0,113,255,158,7,45,6,78,
+16,34,5,153,0,0,16,35,5,164,1,113,0,0,16,3,3,162,3,10,0,0,255,255,0,41,254,
+152,5,238,4,221,16,34,3,162,0,0,16,3,5,161,4,76,0,0,255,255,0,113,254,152,
+7,94,4,221,16,34,5,153,0,0,16,35,3,162,1,113,0,0,16,3,5,161,5,188,0,0,255,
+255,0,41,254,152,6,223,4,199,16,34,3,162,0,0,16,3,5,162,4,133,0,0,255,255,
+0,113,254,152,8,80,4,199,16,34,5,153,0,0,16,35,3,162,1,113,0,0,16,3,5,162,
+5,246,0,0,0,1,0,41,0,0,4,223,4,221,0,34,0,0,0,21,20,6,7,39,2,39,2,17,20,22,
+23,35,38,17,16,19,6,35,34,39,53,22,51,50,55,22,19,23,54,53,52,39,55,4,223,
+96,111,174,47,94,250,84,92,196,154,238,52,69,230,147,162,215,184,195,137,
+55,6,88,49,168,4,86,137,150,250,149,57,1,35,217,254,254,254,242,133,217,111,
+190,1,15,1,28,1,13,8,49,159,45,45,251,254,151,2,164,166,127,131,57,255,255,
+0,113,0,0,6,80,4,221,16,34,5,153,0,0,16,3,3,194,1,113,0,0,255,255,0,113,255,
+158,7,243,4,221,16,34,5,154,0,0,16,3,3,194,3,20,0,0,255,255,0,41,255,156,
+7,231,4,221,16,34,3,194,0,0,16,3,5,157,5,59,0,0,255,255,0,113,255,156,9,88,
+4,221,16,34,5,153,0,0,16,35,3,194,1,113,0,0,16,3,5,157,6,172,0,0,255,255,
+0,113,254,33,6,80,4,221,16,34,5,153,0,0,16,35,3,194,1,113,0,0,16,3,5,190,
+3,82,0,0,255,255,255,254,254,152,7,178,6,53,16,34,5,158,0,0,16,3,3,194,2,
+211,0,0,255,255,0,113,254,152,8,125,6,53,16,35,5,158,0,203,0,0,16,35,5,153,
+0,0,255,68,16,3,3,194,3,158,0,0,255,255,0,143,255,158,6,225,4,221,16,34,5,
+159,0,0,16,3,3,194,2,2,0,0,255,255,0,113,255,158,8,82,4,221,16,34,5,153,0,
+0,16,35,5,159,1,113,0,0,16,3,3,194,3,115,0,0,255,255,0,111,255,158,6,121,
+6,78,16,34,5,164,0,0,16,3,3,194,1,154,0,0,255,255,0,113,255,158,7,233,6,78,
+16,34,5,153,0,0,16,35,5,164,1,113,0,0,16,3,3,194,3,10,0,0,255,255,0,41,254,
+152,6,191,4,221,16,34,3,194,0,0,16,3,5,161,5,29,0,0,255,255,0,113,254,152,
+8,47,4,221,16,34,5,153,0,0,16,35,3,194,1,113,0,0,16,3,5,161,6,141,0,0,255,
+255,0,41,254,152,7,149,4,221,16,34,3,194,0,0,16,3,5,162,5,59,0,0,255,255,
+0,113,254,152,9,6,4,221,16,34,5,153,0,0,16,35,3,194,1,113,0,0,16,3,5,162,
+6,172,0,0,255,255,0,41,255,156,5,242,4,190,16,34,3,159,0,0,16,3,5,157,3,70,
+0,0,255,255,0,113,255,156,7,98,4,190,16,34,5,153,0,0,16,35,3,159,1,113,0,
+0,16,3,5,157,4,182,0,0,255,255,0,113,254,33,4,180,4,190,16,34,5,153,0,0,16,
+35,3,159,1,113,0,0,16,3,5,190,3,82,0,0,255,255,255,254,254,152,5,240,6,53,
+16,34,5,158,0,0,16,3,3,159,2,211,0,0,255,255,0,113,254,152,6,187,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,159,3,158,0,0,255,255,0,
+143,255,158,5,31,4,219,16,34,5,159,0,0,16,3,3,159,2,2,0,0,255,255,0,113,255,
+158,6,144,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,3,159,3,115,0,
+0,255,255,0,111,255,158,5,74,6,78,16,34,5,164,0,0,16,3,3,159,1,154,0,0,255,
+255,0,113,255,158,6,187,6,78,16,34,5,153,0,0,16,35,5,164,1,113,0,0,16,3,3,
+159,3,10,0,0,255,255,0,41,254,152,5,17,4,221,16,34,3,159,0,0,16,3,5,161,3,
+111,0,0,255,255,0,113,254,152,6,129,4,221,16,34,5,153,0,0,16,35,3,159,1,113,
+0,0,16,3,5,161,4,223,0,0,255,255,0,41,254,152,5,201,4,197,16,34,3,159,0,0,
+16,3,5,162,3,111,0,0,255,255,0,113,254,152,7,57,4,197,16,34,5,153,0,0,16,
+35,3,159,1,113,0,0,16,3,5,162,4,223,0,0,0,1,0,66,0,0,4,123,4,190,0,23,0,0,
+0,7,18,5,7,36,3,1,22,18,23,35,38,38,39,1,38,39,53,22,33,32,55,21,3,152,236,
+188,1,19,100,254,241,203,254,246,137,179,63,184,56,196,184,1,139,213,166,
+211,1,47,1,49,209,3,225,8,255,0,199,139,201,1,10,254,229,122,254,243,184,
+168,254,147,1,162,12,56,159,65,65,159,255,255,0,113,0,0,5,236,4,190,16,34,
+5,153,0,0,16,3,3,223,1,113,0,0,255,255,0,113,255,158,7,143,4,219,16,34,5,
+154,0,0,16,3,3,223,3,20,0,0,255,255,0,66,255,156,7,141,4,190,16,34,3,223,
+0,0,16,3,5,157,4,225,0,0,255,255,0,113,255,156,8,254,4,190,16,34,5,153,0,
+0,16,35,3,223,1,113,0,0,16,3,5,157,6,82,0,0,255,255,0,113,254,33,5,236,4,
+190,16,34,5,153,0,0,16,35,3,223,1,113,0,0,16,3,5,190,3,225,0,0,255,255,255,
+254,254,152,7,78,6,53,16,34,5,158,0,0,16,3,3,223,2,211,0,0,255,255,0,113,
+254,152,8,25,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,223,
+3,158,0,0,255,255,0,143,255,158,6,125,4,219,16,34,5,159,0,0,16,3,3,223,2,
+2,0,0,255,255,0,113,255,158,7,238,4,219,16,34,5,153,0,0,16,35,5,159,1,113,
+0,0,16,3,3,223,3,115,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,
+0,16,3,3,223,1,154,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,
+35,5,160,1,113,0,0,16,3,3,223,3,10,0,0,255,255,0,66,254,152,6,90,4,221,16,
+34,3,223,0,0,16,3,5,161,4,184,0,0,255,255,0,113,254,152,7,203,4,221,16,34,
+5,153,0,0,16,35,3,223,1,113,0,0,16,3,5,161,6,41,0,0,255,255,0,66,254,152,
+7,59,4,197,16,34,3,223,0,0,16,3,5,162,4,225,0,0,255,255,0,113,254,152,8,172,
+4,197,16,34,5,153,0,0,16,35,3,223,1,113,0,0,16,3,5,162,6,82,0,0,0,1,0,96,
+0,0,4,111,4,190,0,44,0,0,0,7,22,22,21,20,6,35,34,39,46,2,35,34,6,21,20,23,
+35,38,53,52,54,51,50,22,23,22,51,50,53,52,38,39,6,35,32,39,53,22,33,32,55,
+21,4,18,116,102,74,162,141,99,143,12,68,51,20,70,66,43,178,39,170,140,49,
+82,69,123,66,131,80,119,35,69,254,221,221,208,1,48,1,47,209,4,2,20,132,182,
+100,148,157,59,4,25,12,78,88,94,127,117,104,158,174,25,26,49,135,88,172,137,
+2,72,159,65,65,159,255,255,0,113,0,0,5,224,4,190,16,34,5,153,0,0,16,3,3,239,
+1,113,0,0,255,255,0,113,255,158,7,131,4,219,16,34,5,154,0,0,16,3,3,239,3,
+20,0,0,0,1,0,96,255,150,5,135,4,190,0,59,0,0,0,7,22,23,54,51,50,22,21,16,
+3,39,54,53,52,38,35,35,22,21,20,6,35,34,39,46,2,35,34,6,21,20,23,35,38,53,
+52,54,51,50,22,23,22,51,50,53,52,38,39,6,35,32,39,53,22,33,32,55,21,4,18,
+116,78,28,35,43,145,160,170,121,127,67,74,18,10,162,141,99,143,12,68,51,20,
+70,66,43,178,39,170,140,49,82,69,123,66,131,80,119,35,69,254,221,221,208,
+1,48,1,47,209,4,2,20,101,55,8,213,203,254,244,254,232,65,242,237,135,125,
+43,63,148,157,59,4,25,12,78,88,94,127,117,104,158,174,25,26,49,135,88,172,
+137,2,72,159,65,65,159,0,255,255,0,113,255,150,6,248,4,190,16,34,5,153,0,
+0,16,3,3,242,1,113,0,0,255,255,0,113,255,150,8,155,4,219,16,34,5,154,0,0,
+16,3,3,242,3,20,0,0,0,1,0,96,255,205,7,70,4,190,0,76,0,0,0,21,20,6,7,39,38,
+2,39,7,22,21,20,3,39,54,53,52,35,34,7,22,21,20,6,35,34,39,46,2,35,34,6,21,
+20,23,35,38,53,52,54,51,50,22,23,22,51,50,53,52,38,39,6,35,32,39,53,22,33,
+32,55,21,6,7,22,23,54,51,32,19,23,54,53,52,39,55,7,70,97,110,158,39,90,65,
+5,56,66,141,43,82,10,6,10,162,141,99,143,12,68,51,20,70,66,43,178,39,170,
+140,49,82,69,123,66,131,80,119,35,69,254,221,221,208,1,48,1,47,209,93,116,
+71,39,88,93,1,59,72,6,88,49,168,3,23,138,149,250,150,52,243,1,2,50,7,88,168,
+231,254,248,31,249,254,219,2,45,63,148,157,59,4,25,12,78,88,94,127,117,104,
+158,174,25,26,49,135,88,172,137,2,72,159,65,65,159,29,20,91,73,32,253,177,
+2,163,166,127,131,58,255,255,0,113,255,205,8,183,4,190,16,34,5,153,0,0,16,
+3,3,245,1,113,0,0,255,255,0,113,255,158,10,90,4,219,16,34,5,154,0,0,16,3,
+3,245,3,20,0,0,255,255,0,96,255,156,10,78,4,190,16,34,3,245,0,0,16,3,5,157,
+7,162,0,0,255,255,0,113,255,156,11,190,4,190,16,34,5,153,0,0,16,35,3,245,
+1,113,0,0,16,3,5,157,9,18,0,0,255,255,0,113,254,74,8,183,4,190,16,34,5,153,
+0,0,16,35,3,245,1,113,0,0,16,3,5,190,3,223,0,41,255,255,255,254,254,152,10,
+25,6,53,16,34,5,158,0,0,16,3,3,245,2,211,0,0,255,255,0,113,254,152,10,228,
+6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,3,245,3,158,0,0,255,
+255,0,143,255,158,9,72,4,219,16,34,5,159,0,0,16,3,3,245,2,2,0,0,255,255,0,
+113,255,158,10,185,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,3,245,
+3,115,0,0,255,255,0,113,255,158,9,19,6,111,16,34,5,160,0,0,16,3,3,245,1,205,
+0,0,255,255,0,113,255,158,10,131,6,111,16,34,5,153,0,0,16,35,5,160,1,113,
+0,0,16,3,3,245,3,61,0,0,255,255,0,96,254,152,8,250,4,221,16,34,3,245,0,0,
+16,3,5,161,7,88,0,0,255,255,0,113,254,152,10,107,4,221,16,34,5,153,0,0,16,
+35,3,245,1,113,0,0,16,3,5,161,8,201,0,0,255,255,0,96,254,152,9,252,4,197,
+16,34,3,245,0,0,16,3,5,162,7,162,0,0,255,255,0,113,254,152,11,108,4,197,16,
+34,5,153,0,0,16,35,3,245,1,113,0,0,16,3,5,162,9,18,0,0,255,255,0,96,255,150,
+8,149,4,190,16,34,3,242,0,0,16,3,5,157,5,233,0,0,255,255,0,113,255,150,10,
+6,4,190,16,34,5,153,0,0,16,35,3,242,1,113,0,0,16,3,5,157,7,90,0,0,255,255,
+0,113,254,74,6,248,4,190,16,34,5,153,0,0,16,35,3,242,1,113,0,0,16,3,5,190,
+3,223,0,41,255,255,255,254,254,152,8,90,6,53,16,34,5,158,0,0,16,3,3,242,2,
+211,0,0,255,255,0,113,254,152,9,37,6,53,16,35,5,158,0,203,0,0,16,35,5,153,
+0,0,255,68,16,3,3,242,3,158,0,0,255,255,0,143,255,150,7,137,4,219,16,34,5,
+159,0,0,16,3,3,242,2,2,0,0,255,255,0,113,255,150,8,250,4,219,16,34,5,153,
+0,0,16,35,5,159,1,113,0,0,16,3,3,242,3,115,0,0,255,255,0,113,255,150,7,84,
+6,111,16,34,5,160,0,0,16,3,3,242,1,205,0,0,255,255,0,113,255,150,8,196,6,
+111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,3,242,3,61,0,0,255,255,0,96,
+254,152,7,139,4,221,16,34,3,242,0,0,16,3,5,161,5,233,0,0,255,255,0,113,254,
+152,8,252,4,221,16,34,5,153,0,0,16,35,3,242,1,113,0,0,16,3,5,161,7,90,0,0,
+255,255,0,96,254,152,8,67,4,197,16,34,3,242,0,0,16,3,5,162,5,233,0,0,255,
+255,0,113,254,152,9,180,4,197,16,34,5,153,0,0,16,35,3,242,1,113,0,0,16,3,
+5,162,7,90,0,0,0,1,0,96,0,0,6,199,4,190,0,67,0,0,0,21,20,6,7,39,2,2,35,34,
+7,22,21,20,6,35,34,39,46,2,35,34,6,21,20,23,35,38,53,52,54,51,50,22,23,22,
+51,50,53,52,38,39,6,35,32,39,53,22,33,32,55,21,6,7,22,23,54,51,50,18,19,23,
+54,53,52,39,55,6,199,97,110,174,45,119,66,16,16,10,162,141,99,143,12,68,51,
+20,70,66,43,178,39,170,140,49,82,69,123,66,131,80,119,35,69,254,221,221,208,
+1,48,1,47,209,93,116,69,37,47,58,129,159,52,6,88,49,168,3,14,137,149,250,
+150,58,1,16,1,29,11,43,65,148,157,59,4,25,12,78,88,94,127,117,104,158,174,
+25,26,49,135,88,172,137,2,72,159,65,65,159,29,20,88,68,20,254,234,254,194,
+2,164,166,127,131,58,0,255,255,0,113,0,0,8,56,4,190,16,34,5,153,0,0,16,3,
+4,18,1,113,0,0,255,255,0,113,255,158,9,219,4,219,16,34,5,154,0,0,16,3,4,18,
+3,20,0,0,255,255,0,96,255,156,9,207,4,190,16,34,4,18,0,0,16,3,5,157,7,35,
+0,0,255,255,0,113,255,156,11,63,4,190,16,34,5,153,0,0,16,35,4,18,1,113,0,
+0,16,3,5,157,8,147,0,0,255,255,0,113,254,74,8,56,4,190,16,34,5,153,0,0,16,
+35,4,18,1,113,0,0,16,3,5,190,3,223,0,41,255,255,255,254,254,152,9,154,6,53,
+16,34,5,158,0,0,16,3,4,18,2,211,0,0,255,255,0,113,254,152,10,101,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,4,18,3,158,0,0,255,255,0,143,
+255,158,8,201,4,219,16,34,5,159,0,0,16,3,4,18,2,2,0,0,255,255,0,113,255,158,
+10,58,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,18,3,115,0,0,255,
+255,0,113,255,158,8,148,6,111,16,34,5,160,0,0,16,3,4,18,1,205,0,0,255,255,
+0,113,255,158,10,4,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,4,18,
+3,61,0,0,255,255,0,96,254,152,8,123,4,221,16,34,4,18,0,0,16,3,5,161,6,217,
+0,0,255,255,0,113,254,152,9,236,4,221,16,34,5,153,0,0,16,35,4,18,1,113,0,
+0,16,3,5,161,8,74,0,0,255,255,0,96,254,152,9,125,4,197,16,34,4,18,0,0,16,
+3,5,162,7,35,0,0,255,255,0,113,254,152,10,237,4,197,16,34,5,153,0,0,16,35,
+4,18,1,113,0,0,16,3,5,162,8,147,0,0,255,255,0,96,255,156,7,123,4,190,16,34,
+3,239,0,0,16,3,5,157,4,207,0,0,255,255,0,113,255,156,8,235,4,190,16,34,5,
+153,0,0,16,35,3,239,1,113,0,0,16,3,5,157,6,63,0,0,255,255,0,113,254,74,5,
+224,4,190,16,34,5,153,0,0,16,35,3,239,1,113,0,0,16,3,5,190,3,223,0,41,255,
+255,255,254,254,152,7,66,6,53,16,34,5,158,0,0,16,3,3,239,2,211,0,0,255,255,
+0,113,254,152,8,13,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,
+3,239,3,158,0,0,255,255,0,143,255,158,6,113,4,219,16,34,5,159,0,0,16,3,3,
+239,2,2,0,0,255,255,0,113,255,158,7,226,4,219,16,34,5,153,0,0,16,35,5,159,
+1,113,0,0,16,3,3,239,3,115,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,
+160,0,0,16,3,3,239,1,205,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,
+0,0,16,35,5,160,1,113,0,0,16,3,3,239,3,61,0,0,255,255,0,96,254,152,6,113,
+4,221,16,34,3,239,0,0,16,3,5,161,4,207,0,0,255,255,0,113,254,152,7,225,4,
+221,16,34,5,153,0,0,16,35,3,239,1,113,0,0,16,3,5,161,6,63,0,0,255,255,0,96,
+254,152,7,41,4,197,16,34,3,239,0,0,16,3,5,162,4,207,0,0,255,255,0,113,254,
+152,8,153,4,197,16,34,5,153,0,0,16,35,3,239,1,113,0,0,16,3,5,162,6,63,0,0,
+0,2,0,96,0,0,4,111,4,190,0,35,0,55,0,0,0,7,22,22,21,20,6,35,34,39,46,2,35,
+34,6,21,20,23,35,38,53,52,55,38,53,52,55,38,39,53,22,33,32,55,21,2,38,39,
+6,35,34,39,6,21,20,23,54,51,50,22,23,22,51,50,53,4,18,116,102,74,162,141,
+99,143,12,68,51,20,70,66,43,178,39,60,43,90,70,22,208,1,48,1,47,209,209,80,
+119,35,69,129,132,81,16,53,56,49,82,69,123,66,131,4,2,20,132,182,100,148,
+157,59,4,25,12,78,88,94,127,117,104,131,82,115,139,166,174,19,8,159,65,65,
+159,254,133,172,137,2,16,147,164,80,71,16,25,26,49,135,255,255,0,113,0,0,
+5,224,4,190,16,34,5,153,0,0,16,3,4,47,1,113,0,0,255,255,0,113,255,158,7,131,
+4,219,16,34,5,154,0,0,16,3,4,47,3,20,0,0,0,2,0,96,0,0,6,199,4,190,0,58,0,
+78,0,0,0,21,20,6,7,39,2,2,35,34,7,22,21,20,6,35,34,39,46,2,35,34,6,21,20,
+23,35,38,53,52,55,38,53,52,55,38,39,53,22,33,32,55,21,6,7,22,23,54,51,50,
+18,19,23,54,53,52,39,55,0,53,52,38,39,6,35,34,39,6,21,20,23,54,51,50,22,23,
+22,51,6,199,97,110,174,45,119,66,16,16,10,162,141,99,143,12,68,51,20,70,66,
+43,178,39,60,43,90,70,22,208,1,48,1,47,209,93,116,69,37,47,58,129,159,52,
+6,88,49,168,253,4,80,119,35,69,129,132,81,16,53,56,49,82,69,123,66,3,14,137,
+149,250,150,58,1,16,1,29,11,43,65,148,157,59,4,25,12,78,88,94,127,117,104,
+131,82,115,139,166,174,19,8,159,65,65,159,29,20,88,68,20,254,234,254,194,
+2,164,166,127,131,58,254,47,135,88,172,137,2,16,147,164,80,71,16,25,26,49,
+255,255,0,113,0,0,8,56,4,190,16,34,5,153,0,0,16,3,4,50,1,113,0,0,255,255,
+0,113,255,158,9,219,4,219,16,34,5,154,0,0,16,3,4,50,3,20,0,0,255,255,0,96,
+255,156,9,207,4,190,16,34,4,50,0,0,16,3,5,157,7,35,0,0,255,255,0,113,255,
+156,11,63,4,190,16,34,5,153,0,0,16,35,4,50,1,113,0,0,16,3,5,157,8,147,0,0,
+255,255,0,113,254,74,8,56,4,190,16,34,5,153,0,0,16,35,4,50,1,113,0,0,16,3,
+5,190,3,217,0,41,255,255,255,254,254,152,9,154,6,53,16,34,5,158,0,0,16,3,
+4,50,2,211,0,0,255,255,0,113,254,152,10,101,6,53,16,35,5,158,0,203,0,0,16,
+35,5,153,0,0,255,68,16,3,4,50,3,158,0,0,255,255,0,143,255,158,8,201,4,219,
+16,34,5,159,0,0,16,3,4,50,2,2,0,0,255,255,0,113,255,158,10,58,4,219,16,34,
+5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,50,3,115,0,0,255,255,0,113,255,158,
+8,97,6,111,16,34,5,160,0,0,16,3,4,50,1,154,0,0,255,255,0,113,255,158,9,209,
+6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,4,50,3,10,0,0,255,255,0,
+96,254,152,8,123,4,221,16,34,4,50,0,0,16,3,5,161,6,217,0,0,255,255,0,113,
+254,152,9,236,4,221,16,34,5,153,0,0,16,35,4,50,1,113,0,0,16,3,5,161,8,74,
+0,0,255,255,0,96,254,152,9,125,4,197,16,34,4,50,0,0,16,3,5,162,7,35,0,0,255,
+255,0,113,254,152,10,237,4,197,16,34,5,153,0,0,16,35,4,50,1,113,0,0,16,3,
+5,162,8,147,0,0,255,255,0,96,255,156,7,123,4,190,16,34,4,47,0,0,16,3,5,157,
+4,207,0,0,255,255,0,113,255,156,8,235,4,190,16,34,5,153,0,0,16,35,4,47,1,
+113,0,0,16,3,5,157,6,63,0,0,255,255,0,113,254,74,5,224,4,190,16,34,5,153,
+0,0,16,35,4,47,1,113,0,0,16,3,5,190,3,217,0,41,255,255,255,254,254,152,7,
+66,6,53,16,34,5,158,0,0,16,3,4,47,2,211,0,0,255,255,0,113,254,152,8,13,6,
+53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,4,47,3,158,0,0,255,255,
+0,143,255,158,6,113,4,219,16,34,5,159,0,0,16,3,4,47,2,2,0,0,255,255,0,113,
+255,158,7,226,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,47,3,115,
+0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,4,47,1,205,0,0,
+255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,
+3,4,47,3,61,0,0,255,255,0,96,254,152,6,113,4,221,16,34,4,47,0,0,16,3,5,161,
+4,207,0,0,255,255,0,113,254,152,7,225,4,221,16,34,5,153,0,0,16,35,4,47,1,
+113,0,0,16,3,5,161,6,63,0,0,255,255,0,96,254,152,7,41,4,197,16,34,4,47,0,
+0,16,3,5,162,4,207,0,0,255,255,0,113,254,152,8,153,4,197,16,34,5,153,0,0,
+16,35,4,47,1,113,0,0,16,3,5,162,6,63,0,0,0,1,0,96,0,0,4,111,4,190,0,44,0,
+0,0,33,34,39,6,6,21,20,51,50,55,54,54,51,50,22,21,20,7,35,54,53,52,38,35,
+34,6,6,7,6,35,34,38,53,52,54,55,38,39,53,22,33,32,55,21,3,131,254,221,69,
+35,119,80,131,66,123,69,82,49,140,170,39,178,43,66,70,26,68,45,12,144,98,
+141,162,74,102,117,92,209,1,47,1,47,209,3,215,2,137,172,88,135,49,26,25,174,
+158,104,117,127,94,88,78,20,17,4,59,157,148,100,182,132,20,29,159,65,65,159,
+0,255,255,0,113,0,0,5,224,4,190,16,34,5,153,0,0,16,3,4,79,1,113,0,0,255,255,
+0,113,255,158,7,131,4,219,16,34,5,154,0,0,16,3,4,79,3,20,0,0,0,1,0,96,0,0,
+6,141,4,221,0,61,0,0,0,21,20,6,7,39,38,2,39,6,35,34,39,6,6,21,20,51,50,55,
+54,54,51,50,22,21,20,7,35,54,53,52,38,35,34,6,6,7,6,35,34,38,53,52,54,55,
+38,39,53,22,33,32,55,22,18,23,23,54,53,52,39,55,6,141,96,111,157,37,117,104,
+201,246,69,35,119,80,131,66,123,69,82,49,140,170,39,178,43,66,70,26,68,45,
+12,144,98,141,162,74,102,117,92,209,1,47,1,47,209,129,140,30,6,88,49,168,
+4,86,137,150,250,149,51,178,1,4,123,53,2,137,172,88,135,49,26,25,174,158,
+104,117,127,94,88,78,20,17,4,59,157,148,100,182,132,20,29,159,65,65,141,254,
+217,176,2,164,166,127,131,57,255,255,0,113,0,0,7,254,4,221,16,34,5,153,0,
+0,16,3,4,82,1,113,0,0,255,255,0,113,255,158,9,161,4,221,16,34,5,154,0,0,16,
+3,4,82,3,20,0,0,255,255,0,96,255,156,9,149,4,221,16,34,4,82,0,0,16,3,5,157,
+6,233,0,0,255,255,0,113,255,156,11,6,4,221,16,34,5,153,0,0,16,35,4,82,1,113,
+0,0,16,3,5,157,8,90,0,0,255,255,0,113,254,74,7,254,4,221,16,34,5,153,0,0,
+16,35,4,82,1,113,0,0,16,3,5,190,3,209,0,41,255,255,255,254,254,152,9,96,6,
+53,16,34,5,158,0,0,16,3,4,82,2,211,0,0,255,255,0,113,254,152,10,43,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,4,82,3,158,0,0,255,255,0,143,
+255,158,8,110,4,221,16,34,5,159,0,0,16,3,4,82,1,225,0,0,255,255,0,113,255,
+158,9,223,4,221,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,82,3,82,0,0,
+255,255,0,113,255,158,8,39,6,111,16,34,5,160,0,0,16,3,4,82,1,154,0,0,255,
+255,0,113,255,158,9,151,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,
+4,82,3,10,0,0,255,255,0,96,254,152,8,109,4,221,16,34,4,82,0,0,16,3,5,161,
+6,203,0,0,255,255,0,113,254,152,9,221,4,221,16,34,5,153,0,0,16,35,4,82,1,
+113,0,0,16,3,5,161,8,59,0,0,255,255,0,96,254,152,9,67,4,221,16,34,4,82,0,
+0,16,3,5,162,6,233,0,0,255,255,0,113,254,152,10,180,4,221,16,34,5,153,0,0,
+16,35,4,82,1,113,0,0,16,3,5,162,8,90,0,0,255,255,0,96,255,156,7,123,4,190,
+16,34,4,79,0,0,16,3,5,157,4,207,0,0,255,255,0,113,255,156,8,235,4,190,16,
+34,5,153,0,0,16,35,4,79,1,113,0,0,16,3,5,157,6,63,0,0,255,255,0,113,254,74,
+5,224,4,190,16,34,5,153,0,0,16,35,4,79,1,113,0,0,16,3,5,190,3,209,0,41,255,
+255,255,254,254,152,7,66,6,53,16,34,5,158,0,0,16,3,4,79,2,211,0,0,255,255,
+0,113,254,152,8,13,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,
+4,79,3,158,0,0,255,255,0,143,255,158,6,80,4,219,16,34,5,159,0,0,16,3,4,79,
+1,225,0,0,255,255,0,113,255,158,7,193,4,219,16,34,5,153,0,0,16,35,5,159,1,
+113,0,0,16,3,4,79,3,82,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,
+0,0,16,3,4,79,1,154,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,
+35,5,160,1,113,0,0,16,3,4,79,3,10,0,0,255,255,0,96,254,152,6,113,4,221,16,
+34,4,79,0,0,16,3,5,161,4,207,0,0,255,255,0,113,254,152,7,225,4,221,16,34,
+5,153,0,0,16,35,4,79,1,113,0,0,16,3,5,161,6,63,0,0,255,255,0,96,254,152,7,
+41,4,197,16,34,4,79,0,0,16,3,5,162,4,207,0,0,255,255,0,113,254,152,8,153,
+4,197,16,34,5,153,0,0,16,35,4,79,1,113,0,0,16,3,5,162,6,63,0,0,0,1,0,82,0,
+0,3,233,4,190,0,19,0,0,0,33,34,39,21,0,17,20,7,35,54,53,16,1,53,22,51,32,
+55,21,3,55,254,232,172,127,2,22,67,185,78,253,246,242,219,1,0,202,3,229,37,
+8,254,205,254,90,172,125,129,168,1,92,1,80,233,53,53,159,255,255,0,113,0,
+0,5,90,4,190,16,34,5,153,0,0,16,3,4,111,1,113,0,0,255,255,0,113,255,158,6,
+202,4,219,16,34,5,154,0,0,16,3,4,111,2,225,0,0,255,255,0,82,254,100,3,233,
+4,190,16,34,4,111,0,0,16,3,5,188,2,31,0,0,255,255,0,113,254,100,5,90,4,190,
+16,34,5,153,0,0,16,35,5,188,3,143,0,0,16,3,4,111,1,113,0,0,255,255,0,113,
+254,100,6,253,4,219,16,34,5,154,0,0,16,35,5,188,5,51,0,0,16,3,4,111,3,20,
+0,0,255,255,0,82,254,100,6,190,4,190,16,35,5,188,2,31,0,0,16,34,4,111,0,0,
+16,3,5,157,4,18,0,0,255,255,0,113,254,100,8,47,4,190,16,34,5,153,0,0,16,35,
+5,188,3,143,0,0,16,35,4,111,1,113,0,0,16,3,5,157,5,131,0,0,255,255,0,113,
+252,174,5,90,4,190,16,34,5,153,0,0,16,35,4,111,1,113,0,0,16,35,5,188,3,143,
+0,0,16,3,5,190,3,143,254,141,255,255,255,254,254,100,6,188,6,53,16,34,5,158,
+0,0,16,35,5,188,4,242,0,0,16,3,4,111,2,211,0,0,255,255,0,113,254,100,7,135,
+6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,35,4,111,3,158,0,0,16,
+3,5,188,5,188,0,0,255,255,0,143,254,100,5,235,4,219,16,34,5,159,0,0,16,35,
+5,188,4,33,0,0,16,3,4,111,2,2,0,0,255,255,0,113,254,100,7,92,4,219,16,34,
+5,153,0,0,16,35,5,159,1,113,0,0,16,35,5,188,5,145,0,0,16,3,4,111,3,115,0,
+0,0,3,0,111,254,100,5,131,6,78,0,19,0,39,0,51,0,0,0,33,34,39,2,17,20,18,23,
+7,2,17,52,18,55,22,51,32,55,21,2,33,34,39,21,0,17,20,7,35,54,53,16,1,53,22,
+51,32,55,21,0,22,21,20,6,35,34,38,53,52,54,51,4,121,254,201,211,189,160,78,
+88,147,182,114,115,252,248,1,34,224,121,254,231,172,127,2,23,68,184,78,253,
+246,241,219,1,0,203,254,100,60,60,45,49,59,59,49,5,111,32,254,179,254,90,
+203,254,199,166,84,1,75,1,175,237,1,232,210,43,58,162,254,57,37,8,254,205,
+254,90,172,125,129,168,1,92,1,80,233,53,53,159,251,43,58,57,55,60,60,55,57,
+58,0,0,4,0,113,254,100,6,244,6,78,0,19,0,39,0,51,0,63,0,0,0,33,34,39,2,17,
+20,18,23,7,2,17,52,18,55,22,51,32,55,21,2,33,34,39,21,0,17,20,7,35,54,53,
+16,1,53,22,51,32,55,21,0,21,20,22,23,7,38,38,53,52,55,23,0,22,21,20,6,35,
+34,38,53,52,54,51,5,233,254,201,211,188,160,78,88,147,183,115,115,252,247,
+1,35,223,120,254,231,172,127,2,22,67,184,77,253,246,242,219,1,0,203,250,30,
+37,47,155,49,41,114,131,3,242,59,59,45,49,60,60,49,5,111,32,254,179,254,90,
+203,254,199,166,84,1,75,1,175,237,1,232,210,43,58,162,254,57,37,8,254,205,
+254,90,172,125,129,168,1,92,1,80,233,53,53,159,254,176,144,83,138,78,73,94,
+164,112,211,140,76,251,250,58,57,55,60,60,55,57,58,0,255,255,0,82,254,100,
+5,180,4,221,16,35,5,188,2,31,0,0,16,34,4,111,0,0,16,3,5,161,4,18,0,0,255,
+255,0,113,254,100,7,37,4,221,16,34,5,153,0,0,16,35,5,188,3,143,0,0,16,35,
+4,111,1,113,0,0,16,3,5,161,5,131,0,0,255,255,0,82,254,100,6,108,4,197,16,
+35,5,188,2,31,0,0,16,34,4,111,0,0,16,3,5,162,4,18,0,0,255,255,0,113,254,100,
+7,221,4,197,16,34,5,153,0,0,16,35,5,188,3,143,0,0,16,35,4,111,1,113,0,0,16,
+3,5,162,5,131,0,0,0,1,0,82,0,0,5,172,4,221,0,34,0,0,0,21,20,6,7,39,2,39,6,
+35,34,39,21,0,17,20,7,35,54,53,16,1,53,22,51,32,55,22,19,23,54,53,52,39,55,
+5,172,96,111,174,53,107,157,211,172,127,2,22,67,185,78,253,246,242,219,1,
+0,202,138,55,6,88,49,168,4,86,137,150,250,149,57,1,64,229,33,37,8,254,205,
+254,90,172,125,129,168,1,92,1,80,233,53,53,251,254,151,2,164,166,127,131,
+57,0,255,255,0,113,0,0,7,29,4,221,16,34,5,153,0,0,16,3,4,130,1,113,0,0,255,
+255,0,113,255,158,8,141,4,221,16,34,5,154,0,0,16,3,4,130,2,225,0,0,255,255,
+0,82,255,156,8,180,4,221,16,34,4,130,0,0,16,3,5,157,6,8,0,0,255,255,0,113,
+255,156,10,37,4,221,16,34,5,153,0,0,16,35,4,130,1,113,0,0,16,3,5,157,7,121,
+0,0,255,255,0,113,254,33,7,29,4,221,16,34,5,153,0,0,16,35,4,130,1,113,0,0,
+16,3,5,190,3,143,0,0,255,255,255,254,254,152,8,127,6,53,16,34,5,158,0,0,16,
+3,4,130,2,211,0,0,255,255,0,113,254,152,9,74,6,53,16,35,5,158,0,203,0,0,16,
+35,5,153,0,0,255,68,16,3,4,130,3,158,0,0,255,255,0,143,255,158,7,174,4,221,
+16,34,5,159,0,0,16,3,4,130,2,2,0,0,255,255,0,113,255,158,9,31,4,221,16,34,
+5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,130,3,115,0,0,255,255,0,111,255,158,
+7,70,6,78,16,34,5,164,0,0,16,3,4,130,1,154,0,0,255,255,0,113,255,158,8,182,
+6,78,16,34,5,153,0,0,16,35,5,164,1,113,0,0,16,3,4,130,3,10,0,0,255,255,0,
+82,254,152,7,139,4,221,16,34,4,130,0,0,16,3,5,161,5,233,0,0,255,255,0,113,
+254,152,8,252,4,221,16,34,5,153,0,0,16,35,4,130,1,113,0,0,16,3,5,161,7,90,
+0,0,255,255,0,82,254,152,8,98,4,221,16,34,4,130,0,0,16,3,5,162,6,8,0,0,255,
+255,0,113,254,152,9,211,4,221,16,34,5,153,0,0,16,35,4,130,1,113,0,0,16,3,
+5,162,7,121,0,0,255,255,0,82,255,156,6,149,4,190,16,34,4,111,0,0,16,3,5,157,
+3,233,0,0,255,255,0,113,255,156,8,6,4,190,16,34,5,153,0,0,16,35,4,111,1,113,
+0,0,16,3,5,157,5,90,0,0,255,255,0,113,254,33,5,90,4,190,16,34,5,153,0,0,16,
+35,4,111,1,113,0,0,16,3,5,190,3,143,0,0,255,255,255,254,254,152,6,188,6,53,
+16,34,5,158,0,0,16,3,4,111,2,211,0,0,255,255,0,113,254,152,7,135,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,4,111,3,158,0,0,255,255,0,
+143,255,158,5,235,4,219,16,34,5,159,0,0,16,3,4,111,2,2,0,0,255,255,0,113,
+255,158,7,92,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,111,3,115,
+0,0,255,255,0,111,255,158,5,131,6,78,16,34,5,164,0,0,16,3,4,111,1,154,0,0,
+255,255,0,113,255,158,6,243,6,78,16,34,5,153,0,0,16,35,5,164,1,113,0,0,16,
+3,4,111,3,10,0,0,255,255,0,82,254,152,5,180,4,221,16,34,4,111,0,0,16,3,5,
+161,4,18,0,0,255,255,0,113,254,152,7,37,4,221,16,34,5,153,0,0,16,35,4,111,
+1,113,0,0,16,3,5,161,5,131,0,0,255,255,0,82,254,152,6,108,4,197,16,34,4,111,
+0,0,16,3,5,162,4,18,0,0,255,255,0,113,254,152,7,221,4,197,16,34,5,153,0,0,
+16,35,4,111,1,113,0,0,16,3,5,162,5,131,0,0,0,1,0,143,255,242,7,195,4,190,
+0,57,0,0,36,6,35,34,2,17,52,18,36,51,50,23,21,38,35,34,2,21,20,22,51,50,17,
+53,51,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,39,51,22,21,20,6,
+35,34,39,35,6,6,35,34,39,35,3,156,189,151,205,236,138,1,0,176,86,59,65,66,
+201,209,146,135,254,174,61,68,88,88,174,68,74,82,83,22,172,25,177,149,166,
+59,9,12,155,111,137,49,9,137,151,1,32,1,13,202,1,48,165,18,166,19,254,249,
+245,205,180,1,114,142,168,92,82,135,155,168,194,88,84,125,143,96,113,104,
+105,217,221,141,106,127,112,0,255,255,0,113,255,242,9,52,4,190,16,34,5,153,
+0,0,16,3,4,159,1,113,0,0,255,255,0,113,255,158,10,215,4,219,16,34,5,154,0,
+0,16,3,4,159,3,20,0,0,255,255,0,143,255,156,10,192,4,190,16,34,4,159,0,0,
+16,3,5,157,8,20,0,0,255,255,0,113,255,156,12,49,4,190,16,34,5,153,0,0,16,
+35,4,159,1,113,0,0,16,3,5,157,9,133,0,0,255,255,0,113,254,33,9,52,4,190,16,
+34,5,153,0,0,16,35,4,159,1,113,0,0,16,3,5,190,5,133,0,0,255,255,255,254,254,
+152,10,109,6,53,16,34,5,158,0,0,16,3,4,159,2,170,0,0,255,255,0,113,254,152,
+11,97,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,4,159,3,158,
+0,0,255,255,0,143,255,158,9,105,4,219,16,34,5,159,0,0,16,3,4,159,1,166,0,
+0,255,255,0,113,255,158,10,218,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,
+0,16,3,4,159,3,23,0,0,255,255,0,113,255,158,9,93,6,143,16,34,5,163,0,0,16,
+3,4,159,1,154,0,0,255,255,0,113,255,158,10,205,6,143,16,34,5,153,0,0,16,35,
+5,163,1,113,0,0,16,3,4,159,3,10,0,0,255,255,0,143,254,152,9,182,4,221,16,
+34,4,159,0,0,16,3,5,161,8,20,0,0,255,255,0,113,254,152,11,39,4,221,16,34,
+5,153,0,0,16,35,4,159,1,113,0,0,16,3,5,161,9,133,0,0,255,255,0,143,254,152,
+10,110,4,197,16,34,4,159,0,0,16,3,5,162,8,20,0,0,255,255,0,113,254,152,11,
+223,4,197,16,34,5,153,0,0,16,35,4,159,1,113,0,0,16,3,5,162,9,133,0,0,0,1,
+0,143,255,242,5,20,4,190,0,51,0,0,0,21,20,6,35,34,39,35,6,6,35,34,39,7,18,
+33,50,55,23,6,35,34,0,17,52,18,54,51,50,23,21,38,35,34,6,7,22,51,50,54,53,
+53,51,21,20,22,51,50,53,52,39,51,5,20,157,135,162,62,8,22,140,94,139,51,6,
+38,1,48,114,92,62,113,155,244,254,233,131,248,168,88,58,64,67,166,193,22,
+55,129,88,90,174,64,69,133,22,172,3,74,101,166,167,141,84,100,112,2,254,193,
+51,158,63,1,51,1,33,190,1,29,157,18,166,19,187,178,149,100,117,63,63,88,86,
+163,97,84,255,255,0,113,255,242,6,133,4,190,16,34,5,153,0,0,16,3,4,175,1,
+113,0,0,255,255,0,113,255,158,8,40,4,219,16,34,5,154,0,0,16,3,4,175,3,20,
+0,0,0,1,0,143,255,242,7,41,4,190,0,66,0,0,0,21,20,6,7,39,2,39,6,6,35,34,39,
+35,6,6,35,34,39,7,18,33,50,55,23,6,35,34,0,17,52,18,54,51,50,23,21,38,35,
+34,6,7,22,51,50,54,53,53,51,21,20,22,51,50,53,52,39,51,22,18,23,23,54,53,
+52,39,55,7,41,96,111,158,57,121,22,150,110,162,62,8,22,140,94,139,51,6,38,
+1,48,114,92,62,113,155,244,254,233,131,248,168,88,58,64,67,166,193,22,55,
+129,88,90,174,64,69,133,22,172,129,139,31,6,88,49,168,3,49,137,150,249,150,
+51,1,23,176,115,114,141,84,100,112,2,254,193,51,158,63,1,51,1,33,190,1,29,
+157,18,166,19,187,178,149,100,117,63,63,88,86,163,97,84,142,254,217,176,2,
+164,166,127,131,57,0,255,255,0,113,255,242,8,154,4,190,16,34,5,153,0,0,16,
+3,4,178,1,113,0,0,255,255,0,113,255,158,10,61,4,219,16,34,5,154,0,0,16,3,
+4,178,3,20,0,0,255,255,0,143,255,156,10,49,4,190,16,34,4,178,0,0,16,3,5,157,
+7,133,0,0,255,255,0,113,255,156,11,162,4,190,16,34,5,153,0,0,16,35,4,178,
+1,113,0,0,16,3,5,157,8,246,0,0,255,255,0,113,254,33,8,154,4,190,16,34,5,153,
+0,0,16,35,4,178,1,113,0,0,16,3,5,190,4,31,0,0,255,255,255,254,254,152,9,211,
+6,53,16,34,5,158,0,0,16,3,4,178,2,170,0,0,255,255,0,113,254,152,10,199,6,
+53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,4,178,3,158,0,0,255,
+255,0,143,255,158,8,207,4,219,16,34,5,159,0,0,16,3,4,178,1,166,0,0,255,255,
+0,113,255,158,10,64,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,178,
+3,23,0,0,255,255,0,113,255,158,8,195,6,111,16,34,5,160,0,0,16,3,4,178,1,154,
+0,0,255,255,0,113,255,158,10,51,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,
+0,16,3,4,178,3,10,0,0,255,255,0,143,254,152,8,221,4,221,16,34,4,178,0,0,16,
+3,5,161,7,59,0,0,255,255,0,113,254,152,10,78,4,221,16,34,5,153,0,0,16,35,
+4,178,1,113,0,0,16,3,5,161,8,172,0,0,255,255,0,143,254,152,9,223,4,197,16,
+34,4,178,0,0,16,3,5,162,7,133,0,0,255,255,0,113,254,152,11,80,4,197,16,34,
+5,153,0,0,16,35,4,178,1,113,0,0,16,3,5,162,8,246,0,0,255,255,0,143,255,156,
+8,18,4,190,16,34,4,175,0,0,16,3,5,157,5,102,0,0,255,255,0,113,255,156,9,131,
+4,190,16,34,5,153,0,0,16,35,4,175,1,113,0,0,16,3,5,157,6,215,0,0,255,255,
+0,113,254,33,6,133,4,190,16,34,5,153,0,0,16,35,4,175,1,113,0,0,16,3,5,190,
+4,31,0,0,255,255,255,254,254,152,7,190,6,53,16,34,5,158,0,0,16,3,4,175,2,
+170,0,0,255,255,0,113,254,152,8,178,6,53,16,35,5,158,0,203,0,0,16,35,5,153,
+0,0,255,68,16,3,4,175,3,158,0,0,255,255,0,143,255,158,6,186,4,219,16,34,5,
+159,0,0,16,3,4,175,1,166,0,0,255,255,0,113,255,158,8,43,4,219,16,34,5,153,
+0,0,16,35,5,159,1,113,0,0,16,3,4,175,3,23,0,0,255,255,0,113,255,158,6,174,
+6,111,16,34,5,160,0,0,16,3,4,175,1,154,0,0,255,255,0,113,255,158,8,30,6,111,
+16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,4,175,3,10,0,0,255,255,0,143,254,
+152,7,8,4,221,16,34,4,175,0,0,16,3,5,161,5,102,0,0,255,255,0,113,254,152,
+8,121,4,221,16,34,5,153,0,0,16,35,4,175,1,113,0,0,16,3,5,161,6,215,0,0,255,
+255,0,143,254,152,7,192,4,197,16,34,4,175,0,0,16,3,5,162,5,102,0,0,255,255,
+0,113,254,152,9,49,4,197,16,34,5,153,0,0,16,35,4,175,1,113,0,0,16,3,5,162,
+6,215,0,0,0,1,0,31,255,223,4,233,4,215,0,28,0,0,0,22,21,20,6,6,35,34,38,39,
+1,7,1,7,9,2,22,22,51,50,54,53,52,38,39,1,55,1,4,180,53,81,138,82,71,103,65,
+254,244,177,1,187,119,253,203,1,157,1,138,39,47,32,60,69,28,45,254,121,118,
+1,140,3,23,109,68,82,135,78,50,63,1,6,178,254,88,125,2,31,1,168,254,131,37,
+27,68,55,33,53,41,1,119,125,254,133,255,255,0,113,255,223,6,90,4,215,16,34,
+5,153,0,0,16,3,4,207,1,113,0,0,255,255,0,113,255,158,7,253,4,219,16,34,5,
+154,0,0,16,3,4,207,3,20,0,0,0,1,0,31,255,223,6,96,4,215,0,41,0,0,0,21,20,
+6,7,39,38,39,6,6,35,34,38,39,1,7,1,7,9,2,22,22,51,50,54,53,52,38,39,1,55,
+1,22,18,23,23,54,53,52,39,55,6,96,96,111,157,31,37,35,131,78,71,103,65,254,
+244,177,1,187,119,253,203,1,157,1,138,39,47,32,60,69,28,45,254,121,118,1,
+82,127,139,31,6,88,49,168,3,84,137,150,250,149,51,148,92,62,76,50,63,1,6,
+178,254,88,125,2,31,1,168,254,131,37,27,68,55,33,53,41,1,119,125,254,188,
+120,254,241,180,2,164,166,127,131,57,255,255,0,113,255,223,7,209,4,215,16,
+34,5,153,0,0,16,3,4,210,1,113,0,0,255,255,0,113,255,158,9,116,4,219,16,34,
+5,154,0,0,16,3,4,210,3,20,0,0,255,255,0,31,255,156,9,104,4,215,16,34,4,210,
+0,0,16,3,5,157,6,188,0,0,255,255,0,113,255,156,10,217,4,215,16,34,5,153,0,
+0,16,35,4,210,1,113,0,0,16,3,5,157,8,45,0,0,255,255,0,113,254,33,7,209,4,
+215,16,34,5,153,0,0,16,35,4,210,1,113,0,0,16,3,5,190,3,246,0,0,255,255,255,
+254,254,152,9,51,6,53,16,34,5,158,0,0,16,3,4,210,2,211,0,0,255,255,0,113,
+254,152,9,254,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,4,210,
+3,158,0,0,255,255,0,143,255,158,8,26,4,219,16,34,5,159,0,0,16,3,4,210,1,186,
+0,0,255,255,0,113,255,158,9,139,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,
+0,16,3,4,210,3,43,0,0,255,255,0,113,255,158,7,209,6,111,16,34,5,160,0,0,16,
+3,4,210,1,113,0,0,255,255,0,113,255,158,9,65,6,111,16,34,5,153,0,0,16,35,
+5,160,1,113,0,0,16,3,4,210,2,225,0,0,255,255,0,31,254,152,8,21,4,221,16,34,
+4,210,0,0,16,3,5,161,6,115,0,0,255,255,0,113,254,152,9,133,4,221,16,34,5,
+153,0,0,16,35,4,210,1,113,0,0,16,3,5,161,7,227,0,0,255,255,0,31,254,152,9,
+22,4,215,16,34,4,210,0,0,16,3,5,162,6,188,0,0,255,255,0,113,254,152,10,135,
+4,215,16,34,5,153,0,0,16,35,4,210,1,113,0,0,16,3,5,162,8,45,0,0,255,255,0,
+31,255,156,7,201,4,215,16,34,4,207,0,0,16,3,5,157,5,29,0,0,255,255,0,113,
+255,156,9,57,4,215,16,34,5,153,0,0,16,35,4,207,1,113,0,0,16,3,5,157,6,141,
+0,0,255,255,0,113,254,33,6,90,4,215,16,34,5,153,0,0,16,35,4,207,1,113,0,0,
+16,3,5,190,3,246,0,0,255,255,255,254,254,152,7,188,6,53,16,34,5,158,0,0,16,
+3,4,207,2,211,0,0,255,255,0,113,254,152,8,135,6,53,16,35,5,158,0,203,0,0,
+16,35,5,153,0,0,255,68,16,3,4,207,3,158,0,0,255,255,0,143,255,158,6,163,4,
+219,16,34,5,159,0,0,16,3,4,207,1,186,0,0,255,255,0,113,255,158,8,20,4,219,
+16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,207,3,43,0,0,255,255,0,113,255,
+158,6,143,6,111,16,34,5,160,0,0,16,3,4,207,1,113,0,0,255,255,0,113,255,158,
+8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,4,207,2,225,0,0,255,
+255,0,31,254,152,6,191,4,221,16,34,4,207,0,0,16,3,5,161,5,29,0,0,255,255,
+0,113,254,152,8,47,4,221,16,34,5,153,0,0,16,35,4,207,1,113,0,0,16,3,5,161,
+6,141,0,0,255,255,0,31,254,152,7,119,4,215,16,34,4,207,0,0,16,3,5,162,5,29,
+0,0,255,255,0,113,254,152,8,231,4,215,16,34,5,153,0,0,16,35,4,207,1,113,0,
+0,16,3,5,162,6,141,0,0,0,2,0,72,0,0,5,12,4,190,0,28,0,39,0,0,18,21,16,23,
+18,0,51,50,22,21,20,6,4,35,34,39,21,20,23,35,38,53,55,38,2,53,52,55,51,0,
+54,53,52,38,35,34,6,7,22,51,246,186,41,1,16,195,174,178,139,254,246,187,61,
+51,35,177,30,2,170,176,41,174,2,112,211,90,92,145,177,22,49,55,4,72,111,254,
+238,103,1,33,1,61,194,158,139,215,121,6,22,181,190,174,197,63,66,1,30,199,
+117,92,253,127,166,143,86,101,248,242,6,0,255,255,0,113,0,0,6,125,4,190,16,
+34,5,153,0,0,16,3,4,239,1,113,0,0,255,255,0,113,255,158,8,32,4,219,16,34,
+5,154,0,0,16,3,4,239,3,20,0,0,0,2,0,72,0,0,7,2,4,190,0,43,0,54,0,0,0,21,20,
+6,7,39,38,39,6,4,35,34,39,21,20,23,35,38,53,55,38,2,53,52,55,51,6,21,16,23,
+18,0,51,50,22,23,22,19,23,54,53,52,39,55,0,54,53,52,38,35,34,6,7,22,51,7,
+2,96,111,157,39,111,37,254,209,240,61,51,35,177,30,2,170,176,41,174,41,186,
+41,1,16,195,135,178,99,135,49,6,88,49,168,252,186,211,90,92,145,177,22,49,
+55,3,166,137,150,250,149,51,236,219,168,199,6,22,181,190,174,197,63,66,1,
+30,199,117,92,98,111,254,238,103,1,33,1,61,127,161,224,254,236,2,164,166,
+127,131,57,253,252,166,143,86,101,248,242,6,255,255,0,113,0,0,8,115,4,190,
+16,34,5,153,0,0,16,3,4,242,1,113,0,0,255,255,0,113,255,158,10,22,4,219,16,
+34,5,154,0,0,16,3,4,242,3,20,0,0,255,255,0,72,255,156,10,10,4,190,16,34,4,
+242,0,0,16,3,5,157,7,94,0,0,255,255,0,113,255,156,11,123,4,190,16,34,5,153,
+0,0,16,35,4,242,1,113,0,0,16,3,5,157,8,207,0,0,255,255,0,113,254,33,8,115,
+4,190,16,34,5,153,0,0,16,35,4,242,1,113,0,0,16,3,5,190,3,180,0,0,255,255,
+255,254,254,152,9,213,6,53,16,34,5,158,0,0,16,3,4,242,2,211,0,0,255,255,0,
+113,254,152,10,160,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,
+4,242,3,158,0,0,255,255,0,143,255,158,9,4,4,219,16,34,5,159,0,0,16,3,4,242,
+2,2,0,0,255,255,0,113,255,158,10,117,4,219,16,34,5,153,0,0,16,35,5,159,1,
+113,0,0,16,3,4,242,3,115,0,0,255,255,0,113,255,158,8,156,6,111,16,34,5,160,
+0,0,16,3,4,242,1,154,0,0,255,255,0,113,255,158,10,12,6,111,16,34,5,153,0,
+0,16,35,5,160,1,113,0,0,16,3,4,242,3,10,0,0,255,255,0,72,254,152,8,225,4,
+221,16,34,4,242,0,0,16,3,5,161,7,63,0,0,255,255,0,113,254,152,10,82,4,221,
+16,34,5,153,0,0,16,35,4,242,1,113,0,0,16,3,5,161,8,176,0,0,255,255,0,72,254,
+152,9,184,4,197,16,34,4,242,0,0,16,3,5,162,7,94,0,0,255,255,0,113,254,152,
+11,41,4,197,16,34,5,153,0,0,16,35,4,242,1,113,0,0,16,3,5,162,8,207,0,0,255,
+255,0,72,255,156,8,0,4,190,16,34,4,239,0,0,16,3,5,157,5,84,0,0,255,255,0,
+113,255,156,9,113,4,190,16,34,5,153,0,0,16,35,4,239,1,113,0,0,16,3,5,157,
+6,197,0,0,255,255,0,113,254,33,6,125,4,190,16,34,5,153,0,0,16,35,4,239,1,
+113,0,0,16,3,5,190,3,180,0,0,255,255,255,254,254,152,7,223,6,53,16,34,5,158,
+0,0,16,3,4,239,2,211,0,0,255,255,0,113,254,152,8,170,6,53,16,35,5,158,0,203,
+0,0,16,35,5,153,0,0,255,68,16,3,4,239,3,158,0,0,255,255,0,143,255,158,7,14,
+4,219,16,34,5,159,0,0,16,3,4,239,2,2,0,0,255,255,0,113,255,158,8,127,4,219,
+16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,4,239,3,115,0,0,255,255,0,113,
+255,158,6,166,6,111,16,34,5,160,0,0,16,3,4,239,1,154,0,0,255,255,0,113,255,
+158,8,22,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,4,239,3,10,0,0,
+255,255,0,72,254,152,6,246,4,221,16,34,4,239,0,0,16,3,5,161,5,84,0,0,255,
+255,0,113,254,152,8,103,4,221,16,34,5,153,0,0,16,35,4,239,1,113,0,0,16,3,
+5,161,6,197,0,0,255,255,0,72,254,152,7,174,4,197,16,34,4,239,0,0,16,3,5,162,
+5,84,0,0,255,255,0,113,254,152,9,31,4,197,16,34,5,153,0,0,16,35,4,239,1,113,
+0,0,16,3,5,162,6,197,0,0,0,2,0,102,255,231,4,184,4,199,0,21,0,35,0,0,0,7,
+22,22,21,20,0,35,34,0,53,52,54,55,38,39,53,22,33,32,55,21,2,38,39,6,35,34,
+39,6,6,21,16,33,32,17,4,78,113,94,84,254,236,236,235,254,235,84,95,119,101,
+224,1,73,1,70,227,215,86,106,94,52,51,94,107,86,1,82,1,82,4,6,14,144,243,
+131,248,254,237,1,19,248,131,243,142,18,31,160,66,66,160,254,72,225,147,4,
+4,147,225,125,254,157,1,99,255,255,0,113,255,231,6,41,4,199,16,34,5,153,0,
+0,16,3,5,15,1,113,0,0,255,255,0,113,255,158,7,204,4,219,16,34,5,154,0,0,16,
+3,5,15,3,20,0,0,255,255,0,102,255,156,7,203,4,199,16,34,5,15,0,0,16,3,5,157,
+5,31,0,0,255,255,0,113,255,156,9,59,4,199,16,34,5,153,0,0,16,35,5,15,1,113,
+0,0,16,3,5,157,6,143,0,0,255,255,0,113,254,33,6,41,4,199,16,34,5,153,0,0,
+16,35,5,15,1,113,0,0,16,3,5,190,4,0,0,0,255,255,255,254,254,152,7,139,6,53,
+16,34,5,158,0,0,16,3,5,15,2,211,0,0,255,255,0,113,254,152,8,86,6,53,16,35,
+5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,5,15,3,158,0,0,255,255,0,143,
+255,158,6,186,4,219,16,34,5,159,0,0,16,3,5,15,2,2,0,0,255,255,0,113,255,158,
+8,43,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,5,15,3,115,0,0,255,
+255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,3,5,15,1,154,0,0,255,255,
+0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,5,15,3,
+10,0,0,255,255,0,102,254,152,6,193,4,221,16,34,5,15,0,0,16,3,5,161,5,31,0,
+0,255,255,0,113,254,152,8,49,4,221,16,34,5,153,0,0,16,35,5,15,1,113,0,0,16,
+3,5,161,6,143,0,0,255,255,0,102,254,152,7,121,4,199,16,34,5,15,0,0,16,3,5,
+162,5,31,0,0,255,255,0,113,254,152,8,233,4,199,16,34,5,153,0,0,16,35,5,15,
+1,113,0,0,16,3,5,162,6,143,0,0,0,2,0,143,255,231,8,0,4,190,0,55,0,65,0,0,
+0,53,52,54,51,50,22,21,20,7,22,51,50,55,21,6,35,34,39,6,35,34,39,35,6,6,35,
+34,2,17,52,18,36,51,50,23,21,38,35,34,2,21,16,33,50,54,53,53,51,20,22,22,
+51,50,55,53,36,53,52,38,35,34,6,21,20,23,4,184,174,160,160,174,127,55,74,
+98,72,72,98,164,112,136,168,237,76,8,27,211,168,198,230,138,1,0,176,86,59,
+65,66,201,209,1,13,131,135,174,59,117,96,60,57,1,29,82,76,76,82,197,1,229,
+224,153,193,193,153,181,147,8,22,166,22,49,96,145,149,181,1,39,1,17,202,1,
+48,165,18,166,19,254,249,245,254,116,168,187,188,141,158,63,12,8,189,176,
+82,96,96,82,197,88,255,255,0,113,255,231,9,113,4,190,16,34,5,153,0,0,16,3,
+5,31,1,113,0,0,255,255,0,113,255,158,11,20,4,219,16,34,5,154,0,0,16,3,5,31,
+3,20,0,0,255,255,0,143,255,156,10,233,4,190,16,34,5,31,0,0,16,3,5,157,8,61,
+0,0,255,255,0,113,255,156,12,90,4,190,16,34,5,153,0,0,16,35,5,31,1,113,0,
+0,16,3,5,157,9,174,0,0,255,255,0,113,254,33,9,113,4,190,16,34,5,153,0,0,16,
+35,5,31,1,113,0,0,16,3,5,190,5,143,0,0,255,255,255,254,254,152,10,170,6,53,
+16,34,5,158,0,0,16,3,5,31,2,170,0,0,255,255,0,113,254,152,11,158,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,5,31,3,158,0,0,255,255,0,143,
+255,158,9,166,4,219,16,34,5,159,0,0,16,3,5,31,1,166,0,0,255,255,0,113,255,
+158,11,23,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,5,31,3,23,0,0,
+255,255,0,113,255,158,9,154,6,143,16,34,5,163,0,0,16,3,5,31,1,154,0,0,255,
+255,0,113,255,158,11,10,6,143,16,34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,
+5,31,3,10,0,0,255,255,0,143,254,152,9,162,4,221,16,34,5,31,0,0,16,3,5,161,
+8,0,0,0,255,255,0,113,254,152,11,19,4,221,16,34,5,153,0,0,16,35,5,31,1,113,
+0,0,16,3,5,161,9,113,0,0,255,255,0,143,254,152,10,151,4,197,16,34,5,31,0,
+0,16,3,5,162,8,61,0,0,255,255,0,113,254,152,12,8,4,197,16,34,5,153,0,0,16,
+35,5,31,1,113,0,0,16,3,5,162,9,174,0,0,0,1,0,96,0,0,4,49,4,190,0,24,0,0,1,
+2,7,35,54,18,55,33,53,33,38,39,6,35,34,39,53,22,51,50,55,22,19,51,21,3,133,
+10,141,197,84,84,6,253,213,2,41,16,70,84,123,205,131,142,194,162,174,115,
+18,172,2,31,254,198,229,133,1,2,152,153,170,156,16,49,159,45,45,247,254,241,
+153,0,255,255,0,113,0,0,5,162,4,190,16,34,5,153,0,0,16,3,5,47,1,113,0,0,255,
+255,0,113,255,158,7,69,4,219,16,34,5,154,0,0,16,3,5,47,3,20,0,0,255,255,0,
+96,255,156,7,47,4,190,16,34,5,47,0,0,16,3,5,157,4,131,0,0,255,255,0,113,255,
+156,8,160,4,190,16,34,5,153,0,0,16,35,5,47,1,113,0,0,16,3,5,157,5,244,0,0,
+255,255,0,113,254,33,5,162,4,190,16,34,5,153,0,0,16,35,5,47,1,113,0,0,16,
+3,5,190,3,207,0,0,255,255,255,254,254,152,7,4,6,53,16,34,5,158,0,0,16,3,5,
+47,2,211,0,0,255,255,0,113,254,152,7,207,6,53,16,35,5,158,0,203,0,0,16,35,
+5,153,0,0,255,68,16,3,5,47,3,158,0,0,255,255,0,143,255,158,6,51,4,219,16,
+34,5,159,0,0,16,3,5,47,2,2,0,0,255,255,0,113,255,158,7,164,4,219,16,34,5,
+153,0,0,16,35,5,159,1,113,0,0,16,3,5,47,3,115,0,0,255,255,0,111,255,158,5,
+203,6,78,16,34,5,164,0,0,16,3,5,47,1,154,0,0,255,255,0,113,255,158,7,59,6,
+78,16,34,5,153,0,0,16,35,5,164,1,113,0,0,16,3,5,47,3,10,0,0,255,255,0,96,
+254,152,6,37,4,221,16,34,5,47,0,0,16,3,5,161,4,131,0,0,255,255,0,113,254,
+152,7,150,4,221,16,34,5,153,0,0,16,35,5,47,1,113,0,0,16,3,5,161,5,244,0,0,
+255,255,0,96,254,152,6,221,4,197,16,34,5,47,0,0,16,3,5,162,4,131,0,0,255,
+255,0,113,254,152,8,78,4,197,16,34,5,153,0,0,16,35,5,47,1,113,0,0,16,3,5,
+162,5,244,0,0,0,1,0,96,0,0,4,49,4,190,0,36,0,0,1,22,21,7,51,21,35,6,7,35,
+54,55,33,53,33,54,53,52,39,33,53,33,38,39,6,35,34,39,53,22,51,50,55,22,23,
+51,21,3,133,2,2,172,184,31,108,197,121,37,253,229,2,43,2,4,253,215,2,21,21,
+45,84,123,205,131,142,194,162,174,86,31,188,2,174,27,55,72,143,215,174,188,
+201,143,23,49,29,53,143,89,104,16,49,159,45,45,184,201,143,0,255,255,0,113,
+0,0,5,162,4,190,16,34,5,153,0,0,16,3,5,63,1,113,0,0,255,255,0,113,255,158,
+7,69,4,219,16,34,5,154,0,0,16,3,5,63,3,20,0,0,255,255,0,96,255,156,7,47,4,
+190,16,34,5,63,0,0,16,3,5,157,4,131,0,0,255,255,0,113,255,156,8,160,4,190,
+16,34,5,153,0,0,16,35,5,63,1,113,0,0,16,3,5,157,5,244,0,0,255,255,0,113,254,
+33,5,162,4,190,16,34,5,153,0,0,16,35,5,63,1,113,0,0,16,3,5,190,3,207,0,0,
+255,255,255,254,254,152,7,4,6,53,16,34,5,158,0,0,16,3,5,63,2,211,0,0,255,
+255,0,113,254,152,7,207,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,
+16,3,5,63,3,158,0,0,255,255,0,143,255,158,6,51,4,219,16,34,5,159,0,0,16,3,
+5,63,2,2,0,0,255,255,0,113,255,158,7,164,4,219,16,34,5,153,0,0,16,35,5,159,
+1,113,0,0,16,3,5,63,3,115,0,0,255,255,0,111,255,158,5,203,6,78,16,34,5,164,
+0,0,16,3,5,63,1,154,0,0,255,255,0,113,255,158,7,59,6,78,16,34,5,153,0,0,16,
+35,5,164,1,113,0,0,16,3,5,63,3,10,0,0,255,255,0,96,254,152,6,37,4,221,16,
+34,5,63,0,0,16,3,5,161,4,131,0,0,255,255,0,113,254,152,7,150,4,221,16,34,
+5,153,0,0,16,35,5,63,1,113,0,0,16,3,5,161,5,244,0,0,255,255,0,96,254,152,
+6,221,4,197,16,34,5,63,0,0,16,3,5,162,4,131,0,0,255,255,0,113,254,152,8,78,
+4,197,16,34,5,153,0,0,16,35,5,63,1,113,0,0,16,3,5,162,5,244,0,0,0,3,0,143,
+255,229,4,172,4,199,0,13,0,20,0,27,0,0,0,18,21,20,6,6,35,34,38,38,53,52,18,
+37,0,38,39,6,6,7,33,0,22,51,50,54,55,33,3,182,246,129,238,159,160,240,127,
+244,1,27,1,55,160,151,150,162,26,2,162,253,81,189,162,159,189,2,253,65,4,
+51,254,166,233,144,239,140,140,239,144,233,1,92,146,254,34,191,92,92,191,
+114,254,219,197,197,151,0,255,255,0,113,255,229,6,29,4,199,16,34,5,153,0,
+0,16,3,5,79,1,113,0,0,255,255,0,113,255,158,7,192,4,219,16,34,5,154,0,0,16,
+3,5,79,3,20,0,0,0,3,0,143,255,229,6,231,4,199,0,35,0,42,0,49,0,0,0,21,20,
+6,7,39,2,2,35,35,22,21,20,6,6,35,34,38,38,53,52,18,37,4,23,54,51,50,18,19,
+23,54,53,52,39,55,4,38,39,6,6,7,33,0,22,51,50,54,55,33,6,231,96,110,175,45,
+110,62,8,35,129,238,159,160,240,127,244,1,27,1,41,120,39,43,129,160,51,7,
+88,50,168,253,27,160,151,150,162,26,2,162,253,81,189,162,159,189,2,253,65,
+3,37,137,150,250,149,57,1,14,1,31,115,122,144,239,140,140,239,144,233,1,92,
+146,154,188,12,254,233,254,195,2,164,166,127,131,57,195,191,92,92,191,114,
+254,219,197,197,151,255,255,0,113,255,229,8,88,4,199,16,34,5,153,0,0,16,3,
+5,82,1,113,0,0,255,255,0,113,255,158,9,251,4,219,16,34,5,154,0,0,16,3,5,82,
+3,20,0,0,255,255,0,143,255,156,9,240,4,199,16,34,5,82,0,0,16,3,5,157,7,68,
+0,0,255,255,0,113,255,156,11,96,4,199,16,34,5,153,0,0,16,35,5,82,1,113,0,
+0,16,3,5,157,8,180,0,0,255,255,0,113,254,33,8,88,4,199,16,34,5,153,0,0,16,
+35,5,82,1,113,0,0,16,3,5,190,4,14,0,0,255,255,255,254,254,152,9,145,6,53,
+16,34,5,158,0,0,16,3,5,82,2,170,0,0,255,255,0,113,254,152,10,133,6,53,16,
+35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,5,82,3,158,0,0,255,255,0,143,
+255,158,8,141,4,219,16,34,5,159,0,0,16,3,5,82,1,166,0,0,255,255,0,113,255,
+158,9,254,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,0,16,3,5,82,3,23,0,0,
+255,255,0,113,255,158,8,129,6,111,16,34,5,160,0,0,16,3,5,82,1,154,0,0,255,
+255,0,113,255,158,9,241,6,111,16,34,5,153,0,0,16,35,5,160,1,113,0,0,16,3,
+5,82,3,10,0,0,255,255,0,143,254,152,8,156,4,221,16,34,5,82,0,0,16,3,5,161,
+6,250,0,0,255,255,0,113,254,152,10,12,4,221,16,34,5,153,0,0,16,35,5,82,1,
+113,0,0,16,3,5,161,8,106,0,0,255,255,0,143,254,152,9,158,4,199,16,34,5,82,
+0,0,16,3,5,162,7,68,0,0,255,255,0,113,254,152,11,14,4,199,16,34,5,153,0,0,
+16,35,5,82,1,113,0,0,16,3,5,162,8,180,0,0,255,255,0,143,255,156,7,231,4,199,
+16,34,5,79,0,0,16,3,5,157,5,59,0,0,255,255,0,113,255,156,9,88,4,199,16,34,
+5,153,0,0,16,35,5,79,1,113,0,0,16,3,5,157,6,172,0,0,255,255,0,113,254,33,
+6,29,4,199,16,34,5,153,0,0,16,35,5,79,1,113,0,0,16,3,5,190,4,14,0,0,255,255,
+255,254,254,152,7,86,6,53,16,34,5,158,0,0,16,3,5,79,2,170,0,0,255,255,0,113,
+254,152,8,74,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,5,79,
+3,158,0,0,255,255,0,143,255,158,6,82,4,219,16,34,5,159,0,0,16,3,5,79,1,166,
+0,0,255,255,0,113,255,158,7,195,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,
+0,16,3,5,79,3,23,0,0,255,255,0,113,255,158,6,143,6,111,16,34,5,160,0,0,16,
+3,5,79,1,154,0,0,255,255,0,113,255,158,8,0,6,111,16,34,5,153,0,0,16,35,5,
+160,1,113,0,0,16,3,5,79,3,10,0,0,255,255,0,143,254,152,6,109,4,221,16,34,
+5,79,0,0,16,3,5,161,4,203,0,0,255,255,0,113,254,152,7,221,4,221,16,34,5,153,
+0,0,16,35,5,79,1,113,0,0,16,3,5,161,6,59,0,0,255,255,0,143,254,152,7,108,
+4,199,16,34,5,79,0,0,16,3,5,162,5,18,0,0,255,255,0,113,254,152,8,221,4,199,
+16,34,5,153,0,0,16,35,5,79,1,113,0,0,16,3,5,162,6,131,0,0,255,255,0,113,254,
+152,3,158,6,53,16,35,5,153,0,0,255,68,16,3,5,158,0,203,0,0,255,255,0,113,
+255,158,3,95,4,219,16,34,5,153,0,0,16,3,5,159,1,113,0,0,255,255,0,113,255,
+158,6,143,8,25,16,34,5,160,0,0,16,3,5,181,4,8,1,117,255,255,0,113,255,158,
+8,0,6,111,16,34,5,153,0,0,16,3,5,160,1,113,0,0,255,255,0,113,255,158,6,143,
+8,45,16,34,5,160,0,0,16,3,5,182,4,8,1,117,255,255,0,113,255,158,6,143,7,111,
+16,34,5,160,0,0,16,3,5,183,4,8,1,117,255,255,0,113,255,158,6,143,8,45,16,
+34,5,160,0,0,16,3,5,184,4,8,1,117,255,255,0,113,255,158,6,143,8,58,16,34,
+5,160,0,0,16,3,5,185,4,8,1,117,255,255,0,113,255,158,6,143,7,189,16,34,5,
+160,0,0,16,3,5,186,4,8,1,117,255,255,0,113,255,158,6,143,7,49,16,34,5,160,
+0,0,16,3,5,187,4,8,1,117,0,3,0,143,0,0,8,104,4,197,0,54,0,65,0,75,0,0,0,35,
+34,7,21,22,21,20,6,35,34,38,53,52,55,38,35,34,7,22,21,20,6,35,34,38,53,52,
+55,53,38,35,34,2,17,16,19,35,38,17,52,18,36,51,50,23,54,51,50,23,54,51,50,
+23,21,0,54,53,52,38,39,6,21,20,22,51,0,39,6,21,20,22,51,50,54,53,8,33,115,
+70,55,176,159,150,166,180,147,100,109,116,88,143,170,156,157,172,186,29,36,
+173,215,105,186,93,148,1,0,164,145,107,143,194,205,160,139,178,99,71,251,
+117,82,61,64,190,82,75,3,164,172,143,82,76,77,80,4,31,15,4,147,217,160,197,
+197,160,219,141,23,19,143,221,160,197,197,160,223,147,7,6,254,252,254,247,
+254,250,254,244,244,1,26,228,1,55,156,72,72,80,80,23,166,253,217,103,92,94,
+164,49,100,215,86,101,1,137,103,105,200,88,103,101,88,0,255,255,0,113,0,0,
+9,217,4,197,16,34,5,153,0,0,16,3,5,121,1,113,0,0,255,255,0,113,255,158,11,
+124,4,219,16,34,5,154,0,0,16,3,5,121,3,20,0,0,255,255,0,143,255,156,11,61,
+4,197,16,34,5,121,0,0,16,3,5,157,8,145,0,0,255,255,0,113,255,156,12,174,4,
+197,16,34,5,153,0,0,16,35,5,121,1,113,0,0,16,3,5,157,10,2,0,0,255,255,0,113,
+254,33,9,217,4,197,16,34,5,153,0,0,16,35,5,121,1,113,0,0,16,3,5,190,5,176,
+0,0,255,255,255,254,254,152,11,59,6,53,16,34,5,158,0,0,16,3,5,121,2,211,0,
+0,255,255,0,113,254,152,12,6,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,
+68,16,3,5,121,3,158,0,0,255,255,0,143,255,158,10,106,4,219,16,34,5,159,0,
+0,16,3,5,121,2,2,0,0,255,255,0,113,255,158,11,219,4,219,16,34,5,153,0,0,16,
+35,5,159,1,113,0,0,16,3,5,121,3,115,0,0,255,255,0,113,255,158,10,2,6,143,
+16,34,5,163,0,0,16,3,5,121,1,154,0,0,255,255,0,113,255,158,11,114,6,143,16,
+34,5,153,0,0,16,35,5,163,1,113,0,0,16,3,5,121,3,10,0,0,255,255,0,143,254,
+152,10,51,4,221,16,34,5,121,0,0,16,3,5,161,8,145,0,0,255,255,0,113,254,152,
+11,164,4,221,16,34,5,153,0,0,16,35,5,121,1,113,0,0,16,3,5,161,10,2,0,0,255,
+255,0,143,254,152,10,235,4,197,16,34,5,121,0,0,16,3,5,162,8,145,0,0,255,255,
+0,113,254,152,12,92,4,197,16,34,5,153,0,0,16,35,5,121,1,113,0,0,16,3,5,162,
+10,2,0,0,0,1,0,143,255,227,3,199,4,190,0,34,0,0,18,53,52,54,51,50,23,21,38,
+35,34,21,20,51,50,55,21,6,7,6,21,20,33,50,55,23,6,35,34,38,53,52,54,55,53,
+180,226,196,150,127,136,141,248,215,133,152,145,148,244,1,5,178,141,70,170,
+219,226,209,131,129,2,143,224,157,178,26,172,35,172,172,34,172,16,31,51,166,
+170,70,156,78,166,168,107,155,33,8,255,255,0,113,255,227,5,56,4,190,16,34,
+5,153,0,0,16,3,5,137,1,113,0,0,255,255,0,113,255,158,6,219,4,219,16,34,5,
+154,0,0,16,3,5,137,3,20,0,0,255,255,0,143,255,156,6,225,4,190,16,34,5,137,
+0,0,16,3,5,157,4,53,0,0,255,255,0,113,255,156,8,82,4,190,16,34,5,153,0,0,
+16,35,5,137,1,113,0,0,16,3,5,157,5,166,0,0,255,255,0,113,254,33,5,56,4,190,
+16,34,5,153,0,0,16,35,5,137,1,113,0,0,16,3,5,190,3,180,0,0,255,255,255,254,
+254,152,6,154,6,53,16,34,5,158,0,0,16,3,5,137,2,211,0,0,255,255,0,113,254,
+152,7,101,6,53,16,35,5,158,0,203,0,0,16,35,5,153,0,0,255,68,16,3,5,137,3,
+158,0,0,255,255,0,143,255,158,5,201,4,219,16,34,5,159,0,0,16,3,5,137,2,2,
+0,0,255,255,0,113,255,158,7,58,4,219,16,34,5,153,0,0,16,35,5,159,1,113,0,
+0,16,3,5,137,3,115,0,0,255,255,0,111,255,158,5,97,6,78,16,34,5,164,0,0,16,
+3,5,137,1,154,0,0,255,255,0,113,255,158,6,209,6,78,16,34,5,153,0,0,16,35,
+5,164,1,113,0,0,16,3,5,137,3,10,0,0,255,255,0,143,254,152,5,215,4,221,16,
+34,5,137,0,0,16,3,5,161,4,53,0,0,255,255,0,113,254,152,7,72,4,221,16,34,5,
+153,0,0,16,35,5,137,1,113,0,0,16,3,5,161,5,166,0,0,255,255,0,143,254,152,
+6,143,4,197,16,34,5,137,0,0,16,3,5,162,4,53,0,0,255,255,0,113,254,152,8,0,
+4,197,16,34,5,153,0,0,16,35,5,137,1,113,0,0,16,3,5,162,5,166,0,0,0,1,0,113,
+0,203,1,102,3,156,0,11,0,0,0,21,20,22,23,7,38,38,53,52,55,23,1,18,37,47,155,
+49,41,114,131,2,207,144,83,138,78,73,94,164,112,211,140,76,0,2,0,113,255,
+158,2,215,4,219,0,10,0,22,0,0,36,17,16,3,55,18,17,20,2,7,39,2,21,20,22,23,
+7,38,38,53,52,55,23,2,55,190,149,201,111,122,117,103,37,47,155,49,41,114,
+131,246,1,51,1,65,1,15,98,254,207,254,139,190,254,198,159,80,2,225,144,83,
+138,78,73,94,164,112,211,140,76,0,0,1,0,82,0,102,1,117,4,72,0,10,0,0,0,21,
+16,3,39,54,53,52,38,39,55,1,117,170,121,127,49,58,140,3,123,240,254,244,254,
+231,66,242,237,103,172,96,78,0,0,1,255,195,0,248,2,104,4,45,0,18,0,0,0,21,
+20,6,7,39,38,2,39,55,22,18,23,23,54,53,52,39,55,2,104,96,110,158,43,137,133,
+120,129,140,30,7,88,50,168,3,166,137,150,250,149,51,199,1,28,138,118,141,
+254,217,176,2,164,166,127,131,57,0,0,1,0,41,255,156,2,172,4,168,0,19,0,0,
+18,21,20,18,23,7,0,17,52,18,55,51,22,22,23,7,38,38,39,35,201,116,119,131,
+254,248,113,125,210,13,106,76,129,76,98,16,9,3,72,250,146,254,218,134,116,
+1,55,1,111,176,1,34,148,123,244,86,100,90,223,113,0,1,255,254,254,152,2,211,
+6,53,0,20,0,0,0,17,20,2,6,35,34,39,55,22,51,50,54,53,16,9,2,7,39,7,2,133,
+115,200,129,99,65,74,43,55,121,145,254,35,1,115,1,98,105,233,162,2,227,254,
+0,188,254,248,135,49,141,29,213,209,2,17,1,170,1,155,254,215,129,197,182,
+0,0,1,0,143,255,158,1,238,4,219,0,10,0,0,0,17,16,19,7,2,17,52,18,55,23,1,
+47,191,150,201,111,123,117,3,131,254,205,254,190,254,242,98,1,49,1,117,190,
+1,57,160,80,0,0,1,0,113,255,158,6,143,6,111,0,20,0,0,54,2,53,16,18,55,4,51,
+32,37,21,4,33,34,39,0,17,20,18,23,7,201,88,170,176,1,0,235,1,174,1,43,254,
+230,254,65,213,198,254,247,78,88,147,59,1,78,203,1,37,1,221,233,43,91,162,
+94,36,254,160,254,47,184,254,223,151,84,0,1,255,10,254,152,1,162,4,221,0,
+17,0,0,6,51,50,54,54,53,16,3,55,18,17,20,2,6,35,34,39,55,129,55,94,146,82,
+232,148,254,129,230,141,98,66,74,199,133,250,170,1,205,1,90,84,254,152,253,
+231,213,254,191,174,49,141,0,0,1,255,215,254,152,2,90,4,197,0,35,0,0,18,51,
+50,22,21,20,7,22,18,21,20,6,6,35,34,39,55,22,51,50,54,53,52,39,6,7,39,62,
+2,53,52,35,34,7,39,141,170,135,146,127,65,72,123,217,139,98,66,74,43,55,139,
+162,102,74,98,88,137,149,66,111,106,109,92,4,197,160,125,150,129,112,254,
+239,122,166,230,114,49,141,29,172,177,212,183,56,61,145,80,117,104,62,121,
+86,139,0,0,1,0,113,255,158,8,195,6,143,0,21,0,0,54,2,53,16,18,55,4,33,32,
+36,55,21,4,33,32,37,0,17,20,18,23,7,201,88,227,235,1,89,1,90,1,43,1,209,213,
+254,131,253,172,254,168,254,225,254,151,78,88,147,59,1,78,203,1,39,1,227,
+236,54,60,63,161,127,51,254,149,254,43,184,254,223,151,84,0,1,0,111,255,158,
+5,74,6,78,0,19,0,0,54,17,52,18,55,22,51,32,55,21,6,33,34,39,2,17,20,18,23,
+7,111,114,115,252,248,1,34,224,209,254,201,211,189,160,78,88,147,233,1,175,
+237,1,232,210,43,58,162,61,32,254,179,254,90,203,254,199,166,84,0,2,0,113,
+255,227,3,123,4,199,0,11,0,23,0,0,0,18,17,16,2,35,34,2,17,16,18,51,6,6,21,
+20,22,51,50,54,53,52,38,35,2,176,203,203,186,187,202,202,187,103,110,110,
+103,102,111,111,102,4,199,254,186,254,211,254,213,254,186,1,70,1,43,1,45,
+1,70,164,242,221,221,240,240,221,221,242,0,2,0,133,255,227,3,68,4,199,0,20,
+0,36,0,0,0,6,35,34,38,38,53,52,54,54,51,50,22,18,21,16,3,39,54,55,35,2,6,
+6,21,20,22,22,51,50,54,54,53,52,38,38,35,2,139,114,68,94,152,90,90,154,94,
+102,164,99,236,125,184,29,8,250,80,49,49,80,41,41,80,49,49,80,41,1,184,86,
+107,194,129,131,199,109,129,254,245,192,254,123,254,237,86,215,232,2,43,64,
+125,86,86,125,63,63,125,86,86,125,64,0,0,1,0,102,0,2,4,18,4,164,0,27,0,0,
+18,51,50,4,22,21,20,6,4,35,7,1,7,1,55,22,51,50,54,54,53,52,38,38,35,34,7,
+39,248,180,168,1,25,165,155,254,219,195,4,1,187,99,253,166,99,65,72,145,225,
+123,112,201,123,154,126,48,4,164,84,160,108,105,168,98,6,254,176,121,1,238,
+122,10,62,98,57,54,92,53,45,151,0,1,0,133,255,219,3,248,4,199,0,42,0,0,0,
+51,32,4,21,20,7,22,21,20,6,6,35,34,39,7,5,7,1,55,22,51,50,54,53,52,38,35,
+34,7,39,54,51,50,23,54,53,52,38,35,34,7,39,1,18,177,1,16,1,37,158,158,127,
+215,131,31,25,2,1,33,86,254,53,95,73,86,162,199,209,184,158,111,49,141,177,
+124,111,158,215,178,158,111,49,4,199,164,135,113,78,78,129,75,119,68,4,6,
+170,129,1,53,142,17,76,53,60,82,39,151,51,28,51,70,57,78,39,151,0,1,0,113,
+1,23,4,252,3,236,0,19,0,0,0,33,32,37,19,22,51,50,55,23,6,35,34,39,3,22,51,
+50,55,23,4,37,254,239,254,134,254,215,213,217,233,199,155,50,179,219,194,
+160,102,198,254,252,193,53,1,23,155,2,58,86,59,160,65,49,254,233,78,78,160,
+0,0,1,0,113,0,47,4,246,4,123,0,31,0,0,0,6,21,20,22,23,7,38,17,52,55,39,6,
+7,1,39,54,54,53,52,38,39,55,22,17,20,7,23,54,55,1,23,4,158,62,74,76,144,157,
+41,6,86,109,253,203,113,70,61,74,75,143,158,41,6,86,108,2,54,112,3,158,205,
+141,123,211,109,90,223,1,25,158,104,4,115,104,253,223,113,102,205,141,123,
+211,109,90,223,254,231,158,104,4,115,104,2,33,113,0,1,0,51,255,240,4,63,4,
+197,0,24,0,0,0,22,21,20,6,35,34,36,39,55,22,4,51,50,54,53,52,38,38,39,19,
+5,7,39,7,3,129,170,184,168,180,254,204,176,109,153,1,9,141,84,88,68,190,180,
+252,1,126,73,234,102,2,168,234,139,149,174,147,156,131,139,132,84,76,68,121,
+149,94,1,226,189,151,116,192,0,0,1,0,72,255,244,3,53,4,182,0,25,0,0,0,22,
+21,20,2,7,39,54,53,52,38,39,55,22,18,21,20,7,23,54,54,53,52,38,39,55,2,193,
+116,162,204,201,43,100,125,133,135,115,33,6,123,106,98,123,133,4,49,250,151,
+172,254,202,202,118,121,111,127,213,145,111,154,254,246,145,90,93,4,123,223,
+123,115,207,123,110,0,1,0,113,0,53,4,0,4,86,0,17,0,0,0,35,32,3,50,4,23,7,
+38,36,35,35,16,0,33,50,23,21,3,92,119,254,93,31,241,1,95,141,84,125,254,199,
+234,155,1,55,1,61,121,109,3,178,253,199,84,94,146,82,76,1,180,1,207,29,174,
+0,0,1,0,143,255,238,3,152,4,199,0,24,0,0,0,54,53,52,38,35,34,17,20,18,23,
+7,0,17,52,18,51,50,22,21,20,7,23,7,39,2,131,64,99,90,207,146,149,114,254,
+163,205,178,166,182,79,125,111,238,2,102,131,89,108,117,254,168,185,254,220,
+134,122,1,49,1,159,254,1,11,211,174,154,109,106,131,205,0,0,1,0,82,0,119,
+3,223,4,76,0,11,0,0,37,7,1,1,39,1,1,55,1,1,23,1,3,223,125,254,183,254,182,
+125,1,84,254,172,125,1,74,1,73,125,254,172,231,112,1,108,254,148,112,1,121,
+1,121,115,254,147,1,109,115,254,135,0,255,255,0,164,0,0,2,205,4,170,16,34,
+5,177,0,0,16,3,5,177,1,113,0,0,0,1,0,164,0,0,1,92,4,170,0,3,0,0,51,3,51,3,
+195,31,184,31,4,170,251,86,0,4,0,82,255,158,4,98,4,219,0,10,0,21,0,33,0,45,
+0,0,0,17,20,2,7,39,18,17,16,3,55,0,17,16,19,7,2,17,52,18,55,23,4,22,21,20,
+6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,176,110,123,117,
+190,190,147,2,191,190,147,203,111,123,116,254,39,60,60,45,49,59,59,49,45,
+60,60,45,49,59,59,49,3,168,254,141,190,254,198,159,80,1,8,1,51,1,65,1,15,
+98,254,168,254,205,254,190,254,242,98,1,51,1,115,190,1,57,160,80,106,58,57,
+55,60,60,55,57,58,253,51,57,58,55,59,59,55,58,57,255,255,0,62,0,119,4,69,
+4,76,16,34,5,175,41,0,16,35,5,188,0,168,3,137,16,3,5,188,3,219,3,137,0,8,
+0,106,0,201,3,170,4,8,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,0,0,21,20,
+35,34,53,52,51,6,21,20,35,34,53,52,51,32,21,20,35,34,53,52,51,0,21,20,35,
+34,53,52,51,32,21,20,35,34,53,52,51,4,21,20,35,34,53,52,51,32,21,20,35,34,
+53,52,51,6,21,20,35,34,53,52,51,2,70,62,57,57,205,59,57,57,2,78,60,59,59,
+253,205,57,60,60,3,4,59,60,60,253,204,59,57,57,2,78,60,59,59,204,62,57,57,
+4,8,57,60,60,57,100,60,59,59,60,60,59,59,60,255,0,58,59,59,58,58,59,59,58,
+254,60,59,59,60,60,59,59,60,103,59,59,59,59,0,0,1,255,154,5,20,0,109,6,164,
+0,13,0,0,18,21,20,23,22,21,20,6,35,34,53,52,55,23,29,26,54,60,45,106,122,
+76,6,33,33,14,15,28,68,53,58,136,153,111,70,0,0,3,254,221,5,20,1,35,6,184,
+0,10,0,21,0,33,0,0,18,22,21,20,6,35,34,38,53,52,51,6,22,21,20,6,35,34,38,
+53,52,51,32,22,21,20,6,35,34,38,53,52,54,51,43,55,55,41,43,53,96,156,56,56,
+41,43,53,96,1,175,55,55,41,41,54,54,41,6,184,49,51,49,53,53,49,100,217,49,
+51,49,54,54,49,100,49,51,49,54,54,49,51,49,0,2,254,233,5,20,1,27,5,250,0,
+11,0,23,0,0,2,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,
+54,51,127,59,59,45,47,60,60,47,1,139,60,60,45,47,59,59,47,5,250,57,58,55,
+60,60,55,58,57,57,58,55,60,60,55,58,57,0,0,1,254,182,5,10,1,61,6,184,0,23,
+0,0,2,54,51,50,22,21,20,6,35,34,39,53,22,51,50,54,53,52,38,35,34,6,7,39,221,
+190,121,98,129,133,106,74,45,45,74,53,66,60,47,82,137,92,109,6,20,164,112,
+95,98,115,27,121,37,53,47,39,49,131,178,66,0,2,255,31,5,20,0,225,6,197,0,
+11,0,23,0,0,18,22,21,20,6,35,34,38,53,52,54,51,6,6,21,20,22,51,50,54,53,52,
+38,35,96,129,127,100,100,123,123,100,51,64,60,55,51,64,64,51,6,197,115,98,
+103,117,115,103,100,115,101,61,53,54,61,61,54,53,61,0,0,1,254,135,5,23,1,
+121,6,72,0,23,0,0,0,6,35,34,38,39,38,38,35,34,21,35,52,54,51,50,22,23,22,
+22,51,50,53,51,1,121,121,104,48,75,49,43,62,35,112,105,121,104,52,77,50,45,
+55,33,112,105,5,184,159,43,41,36,37,159,143,160,45,43,37,33,160,0,0,1,254,
+207,5,43,1,49,5,188,0,3,0,0,1,53,33,21,254,207,2,98,5,43,145,145,0,1,255,
+150,254,100,0,106,255,74,0,11,0,0,22,22,21,20,6,35,34,38,53,52,54,51,47,59,
+59,45,49,59,59,49,182,58,57,55,60,60,55,57,58,0,0,1,254,188,5,4,1,68,6,23,
+0,11,0,0,18,35,34,39,7,39,55,22,51,50,55,23,203,125,121,100,90,91,177,110,
+115,90,90,66,5,25,77,98,86,189,103,62,134,0,0,1,254,158,254,33,1,98,255,162,
+0,13,0,0,3,23,54,51,50,23,7,38,35,34,7,39,19,23,176,4,115,155,140,116,59,
+109,147,148,114,131,188,115,254,174,4,76,53,160,61,57,84,1,41,74,0,0,0,15,
+0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,1,4,9,0,2,
+0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,0,4,0,32,0,94,0,3,0,1,4,
+9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,1,4,9,0,7,0,68,1,12,0,3,
+0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,0,3,0,1,4,9,0,10,0,96,1,
+162,0,3,0,1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,60,2,64,0,3,0,1,4,9,0,13,
+2,150,2,124,0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,0,112,0,121,0,114,0,105,
+0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,76,0,101,0,
+112,0,99,0,104,0,97,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,
+32,0,76,0,101,0,112,0,99,0,104,0,97,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,
+0,97,0,110,0,115,0,76,0,101,0,112,0,99,0,104,0,97,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,181,
+0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,
+0,1,0,0,0,12,0,0,0,0,0,28,0,2,0,2,0,4,5,164,0,1,5,181,5,190,0,3,0,1,5,181,
+0,10,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,1,0,2,0,1,0,0,0,1,0,0,0,10,0,34,0,74,0,
+1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,3,0,0,0,1,0,2,0,3,107,101,114,110,
+0,20,109,97,114,107,0,26,109,107,109,107,0,32,0,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,2,0,2,0,3,0,4,0,10,5,8,40,22,40,82,0,2,0,0,0,2,0,10,0,142,0,1,0,32,0,4,
+0,0,0,11,0,58,0,64,0,94,0,70,0,76,0,88,0,82,0,88,0,94,0,100,0,110,0,1,0,11,
+0,4,1,130,1,191,2,47,3,143,3,159,3,223,4,111,5,31,5,159,5,160,0,1,5,161,255,
+174,0,1,5,161,255,207,0,1,5,157,255,205,0,1,5,161,255,184,0,1,5,161,255,215,
+0,1,5,157,255,215,0,1,5,161,255,195,0,2,0,132,255,174,0,239,255,195,0,5,1,
+223,0,41,1,226,0,41,2,18,0,41,2,47,0,41,2,50,0,41,0,2,1,134,0,4,0,0,1,236,
+3,22,0,11,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,255,182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,143,0,0,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,199,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,205,255,215,255,195,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,184,0,0,255,174,255,164,0,0,0,0,0,0,0,0,255,223,255,
+215,255,223,255,236,255,195,255,195,0,0,0,51,0,51,255,215,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,49,0,7,0,36,0,42,0,71,0,100,0,103,
+0,132,0,174,1,21,1,50,1,79,1,82,1,111,1,133,1,162,1,194,1,226,1,242,1,245,
+2,18,2,82,2,114,2,130,2,162,2,210,2,242,3,15,3,18,3,50,3,53,3,82,3,114,3,
+162,3,194,3,245,4,18,4,50,4,82,4,130,4,178,4,210,4,242,5,79,5,82,5,154,5,
+158,5,159,5,160,5,161,0,2,0,49,0,7,0,7,0,1,0,36,0,36,0,6,0,42,0,42,0,4,0,
+71,0,71,0,4,0,100,0,100,0,6,0,103,0,103,0,4,0,132,0,132,0,6,0,174,0,174,0,
+1,1,21,1,21,0,4,1,50,1,50,0,4,1,79,1,79,0,6,1,82,1,82,0,4,1,111,1,111,0,6,
+1,133,1,133,0,4,1,162,1,162,0,4,1,194,1,194,0,4,1,226,1,226,0,5,1,242,1,242,
+0,5,1,245,1,245,0,4,2,18,2,18,0,4,2,82,2,82,0,1,2,114,2,114,0,3,2,130,2,130,
+0,3,2,162,2,162,0,4,2,210,2,210,0,4,2,242,2,242,0,1,3,15,3,15,0,6,3,18,3,
+18,0,4,3,50,3,50,0,7,3,53,3,53,0,1,3,82,3,82,0,1,3,114,3,114,0,1,3,162,3,
+162,0,7,3,194,3,194,0,1,3,245,3,245,0,4,4,18,4,18,0,4,4,50,4,50,0,4,4,82,
+4,82,0,1,4,130,4,130,0,1,4,178,4,178,0,4,4,210,4,210,0,4,4,242,4,242,0,1,
+5,79,5,79,0,6,5,82,5,82,0,4,5,154,5,154,0,8,5,158,5,158,0,2,5,159,5,159,0,
+9,5,160,5,160,0,10,5,161,5,161,0,4,0,2,0,57,0,36,0,36,0,6,0,39,0,39,0,6,0,
+42,0,42,0,6,0,71,0,71,0,6,0,100,0,100,0,6,0,103,0,103,0,6,0,171,0,171,0,1,
+0,174,0,174,0,1,1,79,1,79,0,6,1,82,1,82,0,6,1,111,1,111,0,6,1,114,1,114,0,
+6,1,130,1,130,0,6,1,133,1,133,0,6,1,162,1,162,0,6,2,47,2,47,0,9,2,50,2,50,
+0,9,2,79,2,79,0,13,2,82,2,82,0,13,2,111,2,111,0,15,2,114,2,114,0,15,2,130,
+2,130,0,15,2,133,2,133,0,15,2,162,2,162,0,15,2,191,2,191,0,5,2,194,2,194,
+0,5,2,210,2,210,0,5,2,239,2,239,0,16,2,242,2,242,0,16,3,15,3,15,0,6,3,18,
+3,18,0,6,3,50,3,50,0,14,3,53,3,53,0,14,3,82,3,82,0,14,3,111,3,111,0,12,3,
+114,3,114,0,12,3,159,3,159,0,10,3,162,3,162,0,10,3,239,3,239,0,2,3,242,3,
+242,0,2,3,245,3,245,0,2,4,18,4,18,0,2,4,47,4,47,0,2,4,79,4,79,0,11,4,82,4,
+82,0,11,4,111,4,111,0,8,4,130,4,130,0,8,4,159,4,159,0,6,4,175,4,175,0,6,4,
+178,4,178,0,6,4,207,4,207,0,3,4,210,4,210,0,3,5,31,5,31,0,6,5,79,5,79,0,6,
+5,82,5,82,0,6,5,161,5,161,0,4,5,162,5,162,0,7,0,4,0,0,0,1,0,8,0,1,0,12,0,
+22,0,2,0,56,0,98,0,2,0,1,5,181,5,190,0,0,0,2,0,5,0,4,0,163,0,0,0,171,5,110,
+0,160,5,113,5,152,5,100,5,160,5,160,5,140,5,163,5,164,5,141,0,10,0,1,35,90,
+0,1,35,90,0,1,35,90,0,1,35,90,0,1,35,90,0,1,35,90,0,1,35,90,0,0,34,250,0,
+1,35,90,0,0,34,250,5,143,29,148,22,86,29,160,22,92,31,122,31,128,29,148,22,
+86,29,160,22,92,31,122,31,128,29,148,22,86,29,160,22,92,34,208,22,92,29,88,
+22,62,29,100,22,68,29,112,22,74,29,124,22,80,29,136,34,146,29,142,33,156,
+29,148,22,86,29,160,22,92,29,148,22,86,29,160,22,92,29,148,22,86,29,160,22,
+92,34,208,22,92,29,88,22,62,29,100,22,68,29,112,22,74,29,124,22,80,29,136,
+34,146,29,142,33,156,29,148,22,86,29,160,22,92,29,148,22,86,29,160,22,92,
+33,126,33,132,33,138,33,144,33,54,33,60,33,126,33,132,33,138,33,144,33,54,
+33,60,33,126,33,132,33,138,33,144,33,54,33,60,33,126,33,132,33,138,33,144,
+34,208,33,144,33,66,33,72,33,78,33,84,33,90,33,96,33,102,33,108,33,114,34,
+146,33,120,33,156,33,126,33,132,33,138,33,144,33,126,33,132,33,138,33,144,
+33,126,33,132,33,138,33,144,34,208,33,144,33,66,33,72,33,78,33,84,33,90,33,
+96,33,102,33,108,33,114,34,146,33,120,33,156,33,126,33,132,33,138,33,144,
+33,126,33,132,33,138,33,144,33,126,33,132,33,138,33,144,33,54,33,60,33,126,
+33,132,33,138,33,144,34,208,33,144,33,66,33,72,33,78,33,84,33,90,33,96,33,
+102,33,108,33,114,34,146,33,120,33,156,33,126,33,132,33,138,33,144,33,126,
+33,132,33,138,33,144,33,126,33,132,33,138,33,144,34,208,33,144,33,66,33,72,
+33,78,33,84,33,90,33,96,33,102,33,108,33,114,34,146,33,120,33,156,33,126,
+33,132,33,138,33,144,33,126,33,132,33,138,33,144,24,210,24,216,24,222,24,
+228,24,144,24,150,24,210,24,216,24,222,24,228,24,144,24,150,24,210,24,216,
+24,222,24,228,34,208,24,228,24,126,24,132,24,168,24,174,32,34,32,40,24,138,
+27,6,24,198,34,152,24,204,34,14,24,210,24,216,24,222,24,228,24,210,24,216,
+24,222,24,228,24,210,24,216,24,222,24,228,34,208,24,228,24,126,24,132,24,
+168,24,174,32,34,32,40,24,138,27,6,24,198,34,152,24,204,34,14,24,210,24,216,
+24,222,24,228,24,210,24,216,24,222,24,228,22,152,22,158,22,164,22,170,22,
+98,27,222,22,152,22,158,22,164,22,170,34,208,22,170,22,104,22,110,22,116,
+22,122,22,128,28,134,22,134,22,140,27,186,34,146,22,146,33,156,22,152,22,
+158,22,164,22,170,22,152,22,158,22,164,22,170,22,212,22,218,22,224,22,230,
+22,176,26,196,22,212,22,218,22,224,22,230,34,208,22,230,23,196,22,182,24,
+126,24,132,22,188,22,194,33,78,33,84,22,200,34,146,22,206,33,156,22,212,22,
+218,22,224,22,230,22,212,22,218,22,224,22,230,23,22,30,54,23,28,30,66,22,
+236,29,232,23,22,30,54,23,28,30,66,22,236,29,232,23,22,30,54,23,28,30,66,
+34,208,30,66,22,242,30,0,22,248,30,12,22,254,30,24,23,4,34,74,23,10,34,146,
+23,16,33,156,23,22,30,54,23,28,30,66,23,22,30,54,23,28,30,66,23,22,30,54,
+23,28,30,66,34,208,30,66,22,242,30,0,22,248,30,12,22,254,30,24,23,4,34,74,
+23,10,34,146,23,16,33,156,23,22,30,54,23,28,30,66,23,22,30,54,23,28,30,66,
+23,70,23,76,34,104,23,82,27,60,23,34,23,70,23,76,34,104,23,82,34,208,23,82,
+26,166,29,16,25,98,28,50,23,40,23,46,23,52,23,58,23,64,34,146,26,52,33,156,
+23,70,23,76,34,104,23,82,23,70,23,76,34,104,23,82,23,184,23,88,23,94,23,100,
+23,184,23,106,23,184,23,112,23,184,23,118,23,124,23,130,23,184,23,136,23,
+184,23,142,23,184,23,148,23,154,23,190,23,184,34,208,23,184,23,190,23,184,
+23,190,23,184,23,190,34,208,23,190,23,160,23,166,23,172,23,178,23,172,23,
+178,23,184,23,190,23,184,23,190,24,30,24,36,33,18,24,42,23,196,31,14,23,244,
+24,36,23,250,24,42,23,202,31,14,23,244,24,36,23,250,24,42,23,250,24,42,23,
+208,24,6,23,214,24,18,23,220,23,226,23,232,23,238,30,180,34,146,30,186,33,
+156,23,244,24,36,23,250,24,42,23,244,24,36,23,250,24,42,24,30,24,36,33,18,
+24,42,34,208,24,42,24,0,24,6,24,12,24,18,24,24,30,108,30,240,33,60,30,252,
+34,146,31,8,33,156,24,30,24,36,33,18,24,42,24,30,24,36,33,18,24,42,31,212,
+31,218,31,224,31,230,32,88,31,188,31,212,31,218,31,224,31,230,32,88,31,188,
+31,212,31,218,31,224,31,230,32,88,31,188,31,212,31,218,31,224,31,230,34,208,
+31,230,34,44,34,50,31,194,31,200,24,48,24,54,24,60,24,66,32,190,34,146,32,
+202,33,156,31,212,31,218,31,224,31,230,31,212,31,218,31,224,31,230,31,212,
+31,218,31,224,31,230,34,208,31,230,34,44,34,50,31,194,31,200,24,48,24,54,
+24,60,24,66,32,190,34,146,32,202,33,156,31,212,31,218,31,224,31,230,31,212,
+31,218,31,224,31,230,31,212,31,218,31,224,31,230,32,88,31,188,31,212,31,218,
+31,224,31,230,34,208,31,230,34,44,34,50,31,194,31,200,24,48,24,54,24,60,24,
+66,32,190,34,146,32,202,33,156,31,212,31,218,31,224,31,230,31,212,31,218,
+31,224,31,230,31,212,31,218,31,224,31,230,34,208,31,230,34,44,34,50,31,194,
+31,200,24,48,24,54,24,60,24,66,32,190,34,146,32,202,33,156,31,212,31,218,
+31,224,31,230,31,212,31,218,31,224,31,230,27,72,27,78,34,44,27,84,27,0,27,
+6,27,72,27,78,34,44,27,84,27,0,27,6,27,72,27,78,34,44,27,84,34,208,27,84,
+27,12,27,18,27,24,27,30,27,36,27,42,27,48,27,54,27,60,34,152,27,66,34,14,
+27,72,27,78,34,44,27,84,27,72,27,78,34,44,27,84,27,72,27,78,34,44,27,84,34,
+208,27,84,27,12,27,18,27,24,27,30,27,36,27,42,27,48,27,54,27,60,34,152,27,
+66,34,14,27,72,27,78,34,44,27,84,27,72,27,78,34,44,27,84,24,210,24,216,24,
+222,24,228,24,144,24,150,24,114,24,216,24,120,24,228,24,72,24,150,24,114,
+24,216,24,120,24,228,24,120,24,228,24,78,24,132,24,84,24,174,24,90,32,40,
+24,96,27,6,24,102,34,152,24,108,34,14,24,114,24,216,24,120,24,228,24,114,
+24,216,24,120,24,228,24,210,24,216,24,222,24,228,24,144,24,150,24,210,24,
+216,24,222,24,228,24,144,24,150,24,210,24,216,24,222,24,228,34,208,24,228,
+24,126,24,132,24,168,24,174,32,34,32,40,24,138,27,6,24,198,34,152,24,204,
+34,14,24,210,24,216,24,222,24,228,24,210,24,216,24,222,24,228,24,210,24,216,
+24,222,24,228,34,208,24,228,24,126,24,132,24,168,24,174,32,34,32,40,24,138,
+27,6,24,198,34,152,24,204,34,14,24,210,24,216,24,222,24,228,24,210,24,216,
+24,222,24,228,24,210,24,216,24,222,24,228,24,144,24,150,24,210,24,216,24,
+222,24,228,34,208,24,228,24,126,24,132,24,168,24,174,32,34,32,40,24,138,27,
+6,24,198,34,152,24,204,34,14,24,210,24,216,24,222,24,228,24,210,24,216,24,
+222,24,228,24,210,24,216,24,222,24,228,34,208,24,228,24,126,24,132,24,168,
+24,174,32,34,32,40,24,138,27,6,24,198,34,152,24,204,34,14,24,210,24,216,24,
+222,24,228,24,210,24,216,24,222,24,228,24,210,24,216,24,222,24,228,24,144,
+24,150,24,210,24,216,24,222,24,228,24,144,24,150,24,210,24,216,24,222,24,
+228,34,208,24,228,24,156,24,162,24,168,24,174,24,180,31,236,24,186,24,192,
+24,198,34,152,24,204,34,14,24,210,24,216,24,222,24,228,24,210,24,216,24,222,
+24,228,24,210,24,216,24,222,24,228,34,208,24,228,24,156,24,162,24,168,24,
+174,24,180,31,236,24,186,24,192,24,198,34,152,24,204,34,14,24,210,24,216,
+24,222,24,228,24,210,24,216,24,222,24,228,25,104,25,110,31,170,25,116,25,
+38,25,182,25,20,25,110,25,26,25,116,24,234,25,182,25,20,25,110,25,26,25,116,
+25,26,25,116,24,240,25,50,24,246,25,62,24,252,25,74,25,2,25,86,25,8,34,146,
+25,14,33,156,25,20,25,110,25,26,25,116,25,20,25,110,25,26,25,116,25,104,25,
+110,31,170,25,116,25,38,25,182,25,104,25,110,31,170,25,116,25,38,25,182,25,
+104,25,110,31,170,25,116,34,208,25,116,25,44,25,50,25,56,25,62,25,68,25,74,
+25,80,25,86,25,32,34,146,34,68,33,156,25,104,25,110,31,170,25,116,25,104,
+25,110,31,170,25,116,25,104,25,110,31,170,25,116,34,208,25,116,25,44,25,50,
+25,56,25,62,25,68,25,74,25,80,25,86,25,32,34,158,34,68,33,156,25,104,25,110,
+31,170,25,116,25,104,25,110,31,170,25,116,25,104,25,110,31,170,25,116,25,
+38,25,182,25,104,25,110,31,170,25,116,34,208,25,116,25,44,25,50,25,56,25,
+62,25,68,25,74,25,80,25,86,25,92,34,146,25,98,33,156,25,104,25,110,31,170,
+25,116,25,104,25,110,31,170,25,116,25,104,25,110,31,170,25,116,34,208,25,
+116,25,44,25,50,25,56,25,62,25,68,25,74,25,80,25,86,25,92,34,146,25,98,33,
+156,25,104,25,110,31,170,25,116,25,104,25,110,31,170,25,116,25,152,25,158,
+25,164,25,170,33,66,33,72,25,152,25,158,25,164,25,170,33,66,33,72,25,152,
+25,158,25,164,25,170,34,208,25,170,25,122,27,84,27,192,27,102,25,128,25,134,
+25,140,25,146,32,190,34,146,31,206,34,116,25,152,25,158,25,164,25,170,25,
+152,25,158,25,164,25,170,25,152,25,158,25,164,25,170,34,208,25,170,25,122,
+27,84,27,192,27,102,25,128,25,134,25,140,25,146,32,190,34,146,32,202,33,156,
+25,152,25,158,25,164,25,170,25,152,25,158,25,164,25,170,25,224,25,230,25,
+236,25,242,33,234,32,52,25,224,25,230,25,236,25,242,33,234,32,52,25,224,25,
+230,25,236,25,242,34,208,25,242,25,176,25,182,25,188,25,194,25,200,27,246,
+25,206,28,2,25,212,34,146,25,218,33,156,25,224,25,230,25,236,25,242,25,224,
+25,230,25,236,25,242,25,224,25,230,25,236,25,242,34,208,25,242,25,176,25,
+182,25,188,25,194,25,200,27,246,25,206,28,2,25,212,34,146,25,218,33,156,25,
+224,25,230,25,236,25,242,25,224,25,230,25,236,25,242,26,82,26,88,31,110,31,
+116,32,178,26,46,26,34,26,88,26,40,31,116,25,248,26,46,26,34,26,88,26,40,
+31,116,26,40,31,116,25,254,26,58,26,4,33,240,26,10,28,38,26,16,26,70,26,22,
+34,146,26,28,33,156,26,34,26,88,26,40,31,116,26,34,26,88,26,40,31,116,26,
+82,26,88,31,110,31,116,32,178,26,46,26,82,26,88,31,110,31,116,32,178,26,46,
+26,82,26,88,31,110,31,116,34,208,31,116,26,52,26,58,33,234,33,240,26,64,28,
+38,34,2,26,70,26,76,34,146,31,98,33,156,26,82,26,88,31,110,31,116,26,82,26,
+88,31,110,31,116,26,82,26,88,31,110,31,116,34,208,31,116,26,52,26,58,33,234,
+33,240,26,64,28,38,34,2,26,70,26,76,34,146,31,98,33,156,26,82,26,88,31,110,
+31,116,26,82,26,88,31,110,31,116,26,82,26,88,31,110,31,116,32,178,26,46,26,
+82,26,88,31,110,31,116,34,208,31,116,26,52,26,58,33,234,33,240,26,64,28,38,
+34,2,26,70,26,76,34,146,31,98,33,156,26,82,26,88,31,110,31,116,26,82,26,88,
+31,110,31,116,26,82,26,88,31,110,31,116,34,208,31,116,26,52,26,58,33,234,
+33,240,26,64,28,38,34,2,26,70,26,76,34,146,31,98,33,156,26,82,26,88,31,110,
+31,116,26,82,26,88,31,110,31,116,26,142,26,148,26,154,26,160,26,94,30,96,
+26,142,26,148,26,154,26,160,26,94,30,96,26,142,26,148,26,154,26,160,34,208,
+26,160,26,100,26,106,26,112,26,118,31,170,26,124,32,178,28,50,26,130,34,146,
+26,136,33,156,26,142,26,148,26,154,26,160,26,142,26,148,26,154,26,160,26,
+142,26,148,26,154,26,160,26,94,30,96,26,142,26,148,26,154,26,160,34,208,26,
+160,26,100,26,106,26,112,26,118,31,170,26,124,32,178,28,50,26,130,34,146,
+26,136,33,156,26,142,26,148,26,154,26,160,26,142,26,148,26,154,26,160,26,
+142,26,148,26,154,26,160,34,208,26,160,26,100,26,106,26,112,26,118,31,170,
+26,124,32,178,28,50,26,130,34,146,26,136,33,156,26,142,26,148,26,154,26,160,
+26,142,26,148,26,154,26,160,26,232,26,238,26,244,26,250,26,166,26,172,26,
+232,26,238,26,244,26,250,26,166,26,172,26,232,26,238,26,244,26,250,34,208,
+26,250,26,178,26,184,26,190,26,196,26,202,26,208,26,214,30,78,26,220,34,146,
+26,226,33,156,26,232,26,238,26,244,26,250,26,232,26,238,26,244,26,250,26,
+232,26,238,26,244,26,250,34,208,26,250,26,178,26,184,26,190,26,196,26,202,
+26,208,26,214,30,78,26,220,34,146,26,226,34,116,26,232,26,238,26,244,26,250,
+26,232,26,238,26,244,26,250,27,72,27,78,34,44,27,84,27,0,27,6,27,72,27,78,
+34,44,27,84,27,0,27,6,27,72,27,78,34,44,27,84,34,208,27,84,27,12,27,18,27,
+24,27,30,27,36,27,42,27,48,27,54,27,60,34,152,27,66,34,14,27,72,27,78,34,
+44,27,84,27,72,27,78,34,44,27,84,27,72,27,78,34,44,27,84,34,208,27,84,27,
+12,27,18,27,24,27,30,27,36,27,42,27,48,27,54,27,60,34,152,27,66,34,14,27,
+72,27,78,34,44,27,84,27,72,27,78,34,44,27,84,28,20,28,26,28,32,28,38,27,192,
+30,12,27,174,27,180,27,186,32,64,27,90,27,96,28,20,27,120,28,32,27,126,27,
+192,33,84,28,20,27,120,28,32,27,126,34,208,27,126,32,178,27,102,27,228,27,
+108,27,198,29,40,27,210,27,114,28,8,34,146,28,14,33,156,28,20,27,120,28,32,
+27,126,28,20,27,120,28,32,27,126,27,174,27,180,27,186,32,64,34,208,32,64,
+33,54,27,132,27,138,31,68,27,144,27,150,27,156,27,162,28,128,34,146,27,168,
+33,156,27,174,27,180,27,186,32,64,27,174,27,180,27,186,32,64,28,20,28,26,
+28,32,28,38,27,192,30,12,28,20,28,26,28,32,28,38,34,208,28,38,32,178,27,222,
+27,228,27,234,27,198,27,204,27,210,27,216,28,8,34,146,28,14,33,156,28,20,
+28,26,28,32,28,38,28,20,28,26,28,32,28,38,28,20,28,26,28,32,28,38,34,208,
+28,38,32,178,27,222,27,228,27,234,27,240,27,246,27,252,28,2,28,8,34,146,28,
+14,33,156,28,20,28,26,28,32,28,38,28,20,28,26,28,32,28,38,28,116,28,122,28,
+128,28,134,28,44,28,50,28,116,28,122,28,128,28,134,28,44,28,50,28,116,28,
+122,28,128,28,134,34,208,28,134,28,56,28,62,28,68,28,74,28,80,28,86,28,92,
+28,98,28,104,34,146,28,110,33,156,28,116,28,122,28,128,28,134,28,116,28,122,
+28,128,28,134,28,116,28,122,28,128,28,134,34,208,28,134,28,56,28,62,28,68,
+28,74,28,80,28,86,28,92,28,98,28,104,34,146,28,110,33,156,28,116,28,122,28,
+128,28,134,28,116,28,122,28,128,28,134,28,206,28,212,28,218,28,224,28,140,
+28,146,28,206,28,212,28,218,28,224,34,208,28,224,28,152,31,236,28,158,28,
+164,28,170,28,176,28,182,28,188,28,194,34,146,28,200,33,156,28,206,28,212,
+28,218,28,224,28,206,28,212,28,218,28,224,29,58,29,64,29,70,29,76,28,230,
+28,236,29,58,29,64,29,70,29,76,28,230,28,236,29,58,29,64,29,70,29,76,28,242,
+28,248,29,58,29,64,29,70,29,76,34,208,29,76,28,254,29,4,29,10,29,16,29,22,
+29,28,29,34,29,40,29,46,34,158,29,52,34,116,29,58,29,64,29,70,29,76,29,58,
+29,64,29,70,29,76,29,58,29,64,29,70,29,76,34,208,29,76,28,254,29,4,29,10,
+29,16,29,22,29,28,29,34,29,40,29,46,34,158,29,52,34,116,29,58,29,64,29,70,
+29,76,29,58,29,64,29,70,29,76,29,58,29,64,29,70,29,76,28,242,28,248,29,58,
+29,64,29,70,29,76,34,208,29,76,28,254,29,4,29,10,29,16,29,22,29,28,29,34,
+29,40,29,46,34,158,29,52,34,116,29,58,29,64,29,70,29,76,29,58,29,64,29,70,
+29,76,29,58,29,64,29,70,29,76,34,208,29,76,28,254,29,4,29,10,29,16,29,22,
+29,28,29,34,29,40,29,46,34,158,29,52,34,116,29,58,29,64,29,70,29,76,29,58,
+29,64,29,70,29,76,29,148,29,154,29,160,29,166,31,122,29,82,29,148,29,154,
+29,160,29,166,34,208,29,166,29,88,29,94,29,100,29,106,29,112,29,118,29,124,
+29,130,29,136,34,146,29,142,33,156,29,148,29,154,29,160,29,166,29,148,29,
+154,29,160,29,166,29,214,30,54,29,220,30,66,29,172,29,232,29,214,30,54,29,
+220,30,66,29,172,29,232,29,214,30,54,29,220,30,66,29,172,29,232,29,214,30,
+54,29,220,30,66,34,208,30,66,29,178,30,0,29,184,30,12,29,190,30,24,29,196,
+34,74,29,202,34,146,29,208,33,156,29,214,30,54,29,220,30,66,29,214,30,54,
+29,220,30,66,29,214,30,54,29,220,30,66,34,208,30,66,29,178,30,0,29,184,30,
+12,29,190,30,24,29,196,34,74,29,202,34,146,29,208,33,156,29,214,30,54,29,
+220,30,66,29,214,30,54,29,220,30,66,29,214,30,54,29,220,30,66,29,172,29,232,
+29,214,30,54,29,220,30,66,34,208,30,66,29,178,30,0,29,184,30,12,29,190,30,
+24,29,196,34,74,29,202,34,146,29,208,33,156,29,214,30,54,29,220,30,66,29,
+214,30,54,29,220,30,66,29,214,30,54,29,220,30,66,34,208,30,66,29,178,30,0,
+29,184,30,12,29,190,30,24,29,196,34,74,29,202,34,146,29,208,33,156,29,214,
+30,54,29,220,30,66,29,214,30,54,29,220,30,66,30,48,30,54,30,60,30,66,29,226,
+29,232,30,48,30,54,30,60,30,66,29,226,29,232,30,48,30,54,30,60,30,66,34,208,
+30,66,29,250,30,0,30,6,30,12,30,18,30,24,30,30,34,74,29,238,34,146,29,244,
+33,156,30,48,30,54,30,60,30,66,30,48,30,54,30,60,30,66,30,48,30,54,30,60,
+30,66,34,208,30,66,29,250,30,0,30,6,30,12,30,18,30,24,30,30,34,74,30,36,34,
+146,30,42,33,156,30,48,30,54,30,60,30,66,30,48,30,54,30,60,30,66,30,132,30,
+138,30,144,30,150,30,72,30,78,30,132,30,138,30,144,30,150,30,72,30,78,30,
+132,30,138,30,144,30,150,34,208,30,150,30,84,30,162,30,90,30,96,30,102,30,
+108,30,114,33,60,30,120,34,146,30,126,33,156,30,132,30,138,30,144,30,150,
+30,132,30,138,30,144,30,150,30,132,30,138,30,144,30,150,34,208,30,150,30,
+84,30,162,30,90,30,96,30,102,30,108,30,114,33,60,30,120,34,146,30,126,33,
+156,30,132,30,138,30,144,30,150,30,132,30,138,30,144,30,150,31,32,31,38,31,
+44,31,50,30,216,30,222,30,204,31,38,30,210,31,50,30,156,30,162,30,204,31,
+38,30,210,31,50,34,208,31,50,30,168,30,234,30,174,30,246,30,180,31,2,30,186,
+31,14,30,192,34,158,30,198,34,116,30,204,31,38,30,210,31,50,30,204,31,38,
+30,210,31,50,31,32,31,38,31,44,31,50,30,216,30,222,31,32,31,38,31,44,31,50,
+34,208,31,50,30,228,30,234,30,240,30,246,30,252,31,2,31,8,31,14,31,20,34,
+158,31,26,34,116,31,32,31,38,31,44,31,50,31,32,31,38,31,44,31,50,31,32,31,
+38,31,44,31,50,34,208,31,50,30,228,30,234,30,240,30,246,30,252,31,2,31,8,
+31,14,31,20,34,158,31,26,34,116,31,32,31,38,31,44,31,50,31,32,31,38,31,44,
+31,50,31,110,31,116,31,122,31,128,32,184,31,56,31,110,31,116,31,122,31,128,
+34,208,31,128,31,62,31,68,33,246,33,252,31,74,31,80,31,86,31,92,31,98,34,
+152,31,104,34,14,31,110,31,116,31,122,31,128,31,110,31,116,31,122,31,128,
+31,176,31,182,32,190,32,196,31,134,31,140,31,176,31,182,32,190,32,196,31,
+134,31,140,31,176,31,182,32,190,32,196,34,208,32,196,34,44,34,50,31,146,31,
+152,31,158,31,164,32,154,32,160,31,170,34,146,32,178,33,156,31,176,31,182,
+32,190,32,196,31,176,31,182,32,190,32,196,31,176,31,182,32,190,32,196,34,
+208,32,196,34,44,34,50,31,146,31,152,31,158,31,164,32,154,32,160,31,170,34,
+146,32,178,33,156,31,176,31,182,32,190,32,196,31,176,31,182,32,190,32,196,
+31,212,31,218,31,224,31,230,32,88,31,188,31,212,31,218,31,224,31,230,32,88,
+31,188,31,212,31,218,31,224,31,230,34,208,31,230,34,44,34,50,31,194,31,200,
+34,20,34,26,34,32,34,38,31,224,34,146,31,206,33,156,31,212,31,218,31,224,
+31,230,31,212,31,218,31,224,31,230,31,212,31,218,31,224,31,230,34,208,31,
+230,34,44,34,50,31,194,31,200,34,20,34,26,34,32,34,38,31,224,34,146,31,206,
+33,156,31,212,31,218,31,224,31,230,31,212,31,218,31,224,31,230,34,122,32,
+10,34,134,32,16,34,44,31,236,34,122,32,10,34,134,32,16,34,44,31,236,34,122,
+32,10,34,134,32,16,34,208,32,16,34,56,31,242,34,68,31,248,34,80,31,254,34,
+92,32,4,34,104,34,146,34,110,33,156,34,122,32,10,34,134,32,16,34,122,32,10,
+34,134,32,16,34,122,32,10,34,134,32,16,34,208,32,16,34,56,31,242,34,68,31,
+248,34,80,31,254,34,92,32,4,34,104,34,146,34,110,33,156,34,122,32,10,34,134,
+32,16,34,122,32,10,34,134,32,16,32,94,32,100,32,106,32,112,32,22,32,28,32,
+94,32,100,32,106,32,112,34,208,32,112,32,34,32,40,32,46,32,52,32,58,32,64,
+32,70,32,76,32,82,34,146,32,88,33,156,32,94,32,100,32,106,32,112,32,94,32,
+100,32,106,32,112,32,190,32,196,32,202,32,208,32,118,32,124,32,190,32,196,
+32,202,32,208,34,208,32,208,32,130,32,136,32,142,32,148,32,154,32,160,32,
+166,32,172,32,178,34,152,32,184,34,14,32,190,32,196,32,202,32,208,32,190,
+32,196,32,202,32,208,33,30,33,36,33,42,33,48,32,214,32,220,33,30,33,36,33,
+42,33,48,34,208,33,48,32,226,32,232,32,238,32,244,32,250,33,0,33,6,33,12,
+33,18,34,158,33,24,34,116,33,30,33,36,33,42,33,48,33,30,33,36,33,42,33,48,
+33,30,33,36,33,42,33,48,32,214,32,220,33,30,33,36,33,42,33,48,34,208,33,48,
+32,226,32,232,32,238,32,244,32,250,33,0,33,6,33,12,33,18,34,158,33,24,34,
+116,33,30,33,36,33,42,33,48,33,30,33,36,33,42,33,48,33,126,33,132,33,138,
+33,144,33,54,33,60,33,126,33,132,33,138,33,144,33,54,33,60,33,126,33,132,
+33,138,33,144,34,208,33,144,33,66,33,72,33,78,33,84,33,90,33,96,33,102,33,
+108,33,114,34,146,33,120,33,156,33,126,33,132,33,138,33,144,33,126,33,132,
+33,138,33,144,33,126,33,132,33,138,33,144,34,208,33,144,33,66,33,72,33,78,
+33,84,33,90,33,96,33,102,33,108,33,114,34,146,33,120,33,156,33,126,33,132,
+33,138,33,144,33,126,33,132,33,138,33,144,34,208,33,150,34,208,33,156,34,
+208,33,162,34,208,33,168,34,208,33,174,34,208,33,180,34,208,33,186,34,208,
+33,192,34,20,34,26,34,32,34,38,33,198,33,204,34,20,34,26,34,32,34,38,34,208,
+34,38,33,210,33,216,33,222,33,228,33,234,33,240,33,246,33,252,34,2,34,152,
+34,8,34,14,34,20,34,26,34,32,34,38,34,20,34,26,34,32,34,38,34,122,34,128,
+34,134,34,140,34,44,34,50,34,122,34,128,34,134,34,140,34,208,34,140,34,56,
+34,62,34,68,34,74,34,80,34,86,34,92,34,98,34,104,34,158,34,110,34,116,34,
+122,34,128,34,134,34,140,34,122,34,128,34,134,34,140,34,208,34,146,34,208,
+34,152,34,208,34,158,0,1,5,68,4,170,0,1,6,14,4,170,0,1,4,115,4,170,0,1,5,
+227,4,170,0,1,2,113,4,170,0,1,3,225,4,170,0,1,5,203,0,0,0,1,5,137,0,0,0,1,
+5,137,4,170,0,1,6,84,0,0,0,1,6,84,4,170,0,1,4,102,0,0,0,1,5,215,0,0,0,1,5,
+215,4,170,0,1,5,193,0,0,0,1,2,182,0,0,0,1,2,182,4,170,0,1,4,39,0,0,0,1,4,
+39,4,170,0,1,5,221,0,0,0,1,5,156,4,170,0,1,4,203,0,0,0,1,4,203,4,170,0,1,
+4,98,0,0,0,1,5,211,0,0,0,1,2,201,0,0,0,1,2,201,4,170,0,1,4,57,0,0,0,1,4,57,
+4,170,0,1,5,131,1,31,0,1,5,66,1,31,0,1,6,12,1,31,0,1,4,113,1,31,0,1,5,225,
+1,31,0,1,4,59,1,31,0,1,5,172,1,31,0,1,2,111,1,31,0,1,3,223,1,31,0,1,5,129,
+4,170,0,1,4,111,0,0,0,1,4,111,4,170,0,1,5,223,0,0,0,1,5,223,4,170,0,1,4,6,
+0,0,0,1,2,109,0,0,0,1,2,109,4,170,0,1,3,221,4,170,0,1,2,10,5,199,0,1,3,143,
+0,184,0,1,3,143,4,2,0,1,2,10,6,27,0,1,2,10,5,88,0,1,2,10,6,16,0,1,4,219,0,
+184,0,1,4,219,4,2,0,1,2,10,6,37,0,1,2,10,5,158,0,1,2,10,5,20,0,1,2,10,255,
+70,0,1,4,133,0,184,0,1,4,133,4,2,0,1,3,184,0,184,0,1,3,184,4,2,0,1,2,10,0,
+184,0,1,2,10,4,2,0,1,5,156,0,0,0,1,5,156,254,141,0,1,5,90,254,141,0,1,6,37,
+254,141,0,1,4,137,254,141,0,1,4,127,4,170,0,1,5,250,254,141,0,1,5,240,4,170,
+0,1,2,135,254,141,0,1,3,248,254,141,0,1,5,90,0,0,0,1,5,80,4,170,0,1,6,37,
+0,0,0,1,6,27,4,170,0,1,4,76,0,0,0,1,2,135,0,0,0,1,2,125,4,170,0,1,3,238,4,
+170,0,1,4,135,0,0,0,1,4,135,4,170,0,1,5,248,0,0,0,1,5,248,4,170,0,1,6,209,
+254,141,0,1,6,102,254,141,0,1,7,90,254,141,0,1,5,98,254,141,0,1,6,211,254,
+141,0,1,5,86,254,141,0,1,6,199,254,141,0,1,3,188,254,141,0,1,5,45,254,141,
+0,1,6,102,0,0,0,1,6,102,4,170,0,1,6,211,0,0,0,1,6,209,0,0,0,1,6,209,4,170,
+0,1,6,143,0,0,0,1,6,143,4,170,0,1,7,90,0,0,0,1,7,90,4,170,0,1,5,190,0,0,0,
+1,7,47,0,0,0,1,7,47,4,170,0,1,5,86,0,0,0,1,6,199,0,0,0,1,3,188,0,0,0,1,3,
+188,4,170,0,1,5,45,0,0,0,1,5,45,4,170,0,1,5,236,254,141,0,1,5,170,254,141,
+0,1,6,117,254,141,0,1,4,217,254,141,0,1,6,74,254,141,0,1,4,154,254,141,0,
+1,6,10,254,141,0,1,2,215,254,141,0,1,4,72,254,141,0,1,4,113,0,0,0,1,5,236,
+0,0,0,1,5,170,0,0,0,1,5,170,4,170,0,1,6,117,0,0,0,1,6,117,4,170,0,1,4,217,
+0,0,0,1,4,217,4,170,0,1,6,74,0,0,0,1,6,74,4,170,0,1,4,154,0,0,0,1,6,10,0,
+0,0,1,2,215,0,0,0,1,2,215,4,170,0,1,4,72,4,170,0,1,5,47,0,0,0,1,4,94,0,0,
+0,1,4,94,4,170,0,1,5,207,0,0,0,1,5,207,4,170,0,1,2,92,0,0,0,1,2,92,4,170,
+0,1,3,205,0,0,0,1,3,205,4,170,0,1,6,0,0,0,0,1,5,236,4,170,0,1,6,203,0,0,0,
+1,6,182,4,170,0,1,5,14,0,0,0,1,6,127,0,0,0,1,4,199,0,0,0,1,6,55,0,0,0,1,3,
+45,0,0,0,1,3,25,4,170,0,1,4,158,0,0,0,1,4,137,4,170,0,1,5,184,254,141,0,1,
+5,119,254,141,0,1,6,66,254,141,0,1,4,104,254,141,0,1,5,217,254,141,0,1,4,
+61,254,141,0,1,5,174,254,141,0,1,2,164,254,141,0,1,4,20,254,141,0,1,5,184,
+4,170,0,1,5,119,0,0,0,1,5,119,4,170,0,1,4,104,0,0,0,1,5,217,4,170,0,1,4,61,
+0,0,0,1,2,164,0,0,0,1,2,164,4,170,0,1,5,172,0,0,0,1,5,66,0,0,0,1,5,147,4,
+170,0,1,6,53,0,0,0,1,6,135,4,170,0,1,4,154,4,170,0,1,4,49,0,0,0,1,5,162,0,
+0,0,1,2,152,0,0,0,1,2,233,4,170,0,1,4,8,0,0,0,1,4,90,4,170,0,1,5,63,0,0,0,
+1,5,84,4,170,0,1,4,254,0,0,0,1,5,18,4,170,0,1,5,201,0,0,0,1,5,221,4,170,0,
+1,3,240,0,0,0,1,4,4,4,170,0,1,5,96,0,0,0,1,3,197,0,0,0,1,5,53,0,0,0,1,2,43,
+0,0,0,1,2,63,4,170,0,1,3,156,0,0,0,1,3,176,4,170,0,1,6,252,0,0,0,1,6,211,
+4,170,0,1,6,145,0,0,0,1,6,104,4,170,0,1,7,133,0,0,0,1,7,92,4,170,0,1,5,141,
+0,0,0,1,5,100,4,170,0,1,6,254,0,0,0,1,6,213,4,170,0,1,5,129,0,0,0,1,6,242,
+0,0,0,1,3,231,0,0,0,1,3,190,4,170,0,1,5,47,4,170,0,1,5,244,0,0,0,1,6,53,4,
+170,0,1,5,250,4,170,0,1,6,197,4,170,0,1,6,133,4,170,0,1,3,39,4,170,0,1,4,
+152,4,170,0,1,5,244,4,170,0,1,6,125,0,0,0,1,4,205,0,0,0,1,5,14,4,170,0,1,
+6,61,0,0,0,1,6,127,4,170,0,1,5,233,0,0,0,1,2,223,0,0,0,1,3,33,4,170,0,1,4,
+80,0,0,0,1,5,250,0,0,0,1,4,211,0,0,0,1,4,229,4,170,0,1,6,68,0,0,0,1,6,86,
+4,170,0,1,5,203,4,170,0,1,6,131,0,0,0,1,6,150,4,170,0,1,4,231,0,0,0,1,4,250,
+4,170,0,1,6,88,0,0,0,1,6,106,4,170,0,1,4,127,0,0,0,1,5,240,0,0,0,1,2,229,
+0,0,0,1,2,248,4,170,0,1,4,86,0,0,0,1,4,104,4,170,0,1,6,29,0,0,0,1,6,10,4,
+170,0,1,5,219,0,0,0,1,5,201,4,170,0,1,6,166,0,0,0,1,6,147,4,170,0,1,4,225,
+0,0,0,1,4,207,4,170,0,1,6,82,0,0,0,1,6,63,4,170,0,1,4,162,0,0,0,1,6,18,0,
+0,0,1,3,8,0,0,0,1,2,246,4,170,0,1,4,121,0,0,0,1,4,102,4,170,0,1,6,41,0,123,
+0,1,6,0,4,170,0,1,5,231,0,123,0,1,6,178,0,123,0,1,6,137,4,170,0,1,5,23,0,
+123,0,1,4,238,4,170,0,1,6,135,0,123,0,1,6,94,4,170,0,1,4,174,0,123,0,1,6,
+31,0,123,0,1,3,20,0,123,0,1,2,236,4,170,0,1,4,133,0,123,0,1,4,92,4,170,0,
+1,4,184,0,0,0,1,4,121,4,170,0,1,4,246,0,0,0,1,4,182,4,170,0,1,4,180,0,0,0,
+1,4,117,4,170,0,1,5,127,0,0,0,1,5,63,4,170,0,1,3,227,0,0,0,1,3,164,4,170,
+0,1,5,84,0,0,0,1,5,20,4,170,0,1,3,123,0,0,0,1,4,236,0,0,0,1,1,225,0,0,0,1,
+1,162,4,170,0,1,3,82,0,0,0,1,3,18,4,170,0,1,5,104,4,170,0,1,5,68,0,0,0,1,
+5,39,4,170,0,1,6,14,0,0,0,1,5,242,4,170,0,1,4,115,0,0,0,1,4,86,4,170,0,1,
+5,227,0,0,0,1,5,199,4,170,0,1,4,10,0,0,0,1,5,123,0,0,0,1,2,113,0,0,0,1,2,
+84,4,170,0,1,3,225,0,0,0,1,3,197,4,170,0,1,5,131,0,41,0,1,5,66,0,41,0,1,6,
+12,0,41,0,1,4,113,0,41,0,1,5,225,0,41,0,1,4,59,0,41,0,1,5,172,0,41,0,1,2,
+111,0,41,0,1,3,223,0,41,0,1,5,125,0,41,0,1,5,131,4,170,0,1,4,2,0,41,0,1,5,
+115,0,41,0,1,5,59,0,41,0,1,5,66,4,170,0,1,6,6,0,41,0,1,6,12,4,170,0,1,4,106,
+0,41,0,1,4,113,4,170,0,1,5,219,0,41,0,1,4,53,0,41,0,1,5,166,0,41,0,1,2,104,
+0,41,0,1,2,111,4,170,0,1,3,217,0,41,0,1,3,223,4,170,0,1,5,117,0,41,0,1,5,
+117,4,170,0,1,5,51,0,41,0,1,5,254,0,41,0,1,5,254,4,170,0,1,4,66,0,41,0,1,
+4,66,4,170,0,1,5,178,0,41,0,1,3,250,0,41,0,1,5,106,0,41,0,1,2,96,0,41,0,1,
+2,96,4,170,0,1,3,209,0,41,0,1,3,209,4,170,0,1,5,51,254,141,0,1,5,51,4,170,
+0,1,4,242,254,141,0,1,5,188,254,141,0,1,4,33,254,141,0,1,5,145,254,141,0,
+1,3,184,254,141,0,1,5,41,254,141,0,1,2,31,254,141,0,1,3,143,254,141,0,1,5,
+0,0,0,0,1,5,0,4,170,0,1,4,242,0,0,0,1,4,242,4,170,0,1,5,188,0,0,0,1,5,188,
+4,170,0,1,4,33,0,0,0,1,4,33,4,170,0,1,5,145,0,0,0,1,5,145,4,170,0,1,3,184,
+0,0,0,1,5,41,0,0,0,1,2,31,0,0,0,1,2,31,4,170,0,1,3,143,0,0,0,1,3,143,4,170,
+0,1,7,41,4,170,0,1,6,190,0,0,0,1,6,190,4,170,0,1,5,186,0,0,0,1,5,186,4,170,
+0,1,7,43,0,0,0,1,7,43,4,170,0,1,5,174,0,0,0,1,7,31,0,0,0,1,4,20,0,0,0,1,4,
+20,4,170,0,1,5,133,0,0,0,1,5,133,4,170,0,1,5,195,0,0,0,1,5,195,4,170,0,1,
+6,76,0,0,0,1,6,76,4,170,0,1,4,84,0,0,0,1,4,84,4,170,0,1,4,72,0,0,0,1,2,174,
+0,0,0,1,2,174,4,170,0,1,5,154,4,170,0,1,6,35,0,0,0,1,6,35,4,170,0,1,5,102,
+0,0,0,1,2,133,0,0,0,1,2,133,4,170,0,1,3,246,0,0,0,1,3,246,4,170,0,1,5,190,
+4,170,0,1,5,125,4,170,0,1,6,72,4,170,0,1,4,172,4,170,0,1,6,29,4,170,0,1,2,
+170,4,170,0,1,4,27,4,170,0,1,5,164,0,0,0,1,5,164,4,170,0,1,5,98,0,0,0,1,5,
+98,4,170,0,1,6,45,0,0,0,1,6,45,4,170,0,1,4,145,0,0,0,1,4,145,4,170,0,1,6,
+2,0,0,0,1,6,2,4,170,0,1,4,41,0,0,0,1,5,154,0,0,0,1,2,143,0,0,0,1,2,143,4,
+170,0,1,4,0,0,0,0,1,4,0,4,170,0,1,7,51,0,0,0,1,7,51,4,170,0,1,6,201,0,0,0,
+1,6,201,4,170,0,1,7,188,0,0,0,1,7,188,4,170,0,1,5,197,0,0,0,1,5,197,4,170,
+0,1,7,53,0,0,0,1,7,53,4,170,0,1,5,184,0,0,0,1,7,41,0,0,0,1,4,31,0,0,0,1,4,
+31,4,170,0,1,5,143,0,0,0,1,5,143,4,170,0,1,5,115,0,0,0,1,5,74,4,170,0,1,5,
+49,0,0,0,1,5,8,4,170,0,1,5,252,0,0,0,1,5,211,4,170,0,1,4,96,0,0,0,1,4,55,
+4,170,0,1,5,209,0,0,0,1,5,168,4,170,0,1,3,248,0,0,0,1,5,104,0,0,0,1,2,94,
+0,0,0,1,2,53,4,170,0,1,3,207,0,0,0,1,3,166,4,170,0,1,5,178,0,0,0,1,5,178,
+4,170,0,1,5,72,0,0,0,1,5,72,4,170,0,1,6,59,0,0,0,1,6,59,4,170,0,1,4,68,0,
+0,0,1,4,68,4,170,0,1,5,180,0,0,0,1,5,180,4,170,0,1,4,55,0,0,0,1,5,168,0,0,
+0,1,2,158,0,0,0,1,2,158,4,170,0,1,4,14,0,0,0,1,4,14,4,170,0,1,4,8,7,227,0,
+1,5,121,6,31,0,1,4,8,8,55,0,1,4,8,7,117,0,1,4,8,8,45,0,1,4,8,8,66,0,1,4,8,
+7,186,0,1,4,8,7,49,0,1,7,84,0,0,0,1,7,84,4,170,0,1,7,18,0,0,0,1,7,18,4,170,
+0,1,7,221,0,0,0,1,7,221,4,170,0,1,6,66,0,0,0,1,6,66,4,170,0,1,7,178,0,0,0,
+1,7,178,4,170,0,1,5,217,0,0,0,1,7,74,0,0,0,1,6,201,6,31,0,1,4,63,0,0,0,1,
+4,63,4,170,0,1,5,176,0,0,0,1,5,176,4,170,0,1,5,88,0,0,0,1,5,88,4,170,0,1,
+5,23,0,0,0,1,5,23,4,170,0,1,5,225,0,0,0,1,5,225,4,170,0,1,4,70,0,0,0,1,4,
+70,4,170,0,1,5,182,0,0,0,1,5,182,4,170,0,1,3,221,0,0,0,1,5,78,0,0,0,1,4,205,
+6,31,0,1,2,68,0,0,0,1,2,68,4,170,0,1,3,180,0,0,0,1,3,180,4,170,0,1,4,8,6,
+31,0,1,5,88,6,31,0,1,3,92,6,31,0,6,1,0,0,1,0,8,0,1,0,12,0,20,0,1,0,26,0,42,
+0,1,0,2,5,188,5,190,0,1,0,1,5,188,0,2,0,0,0,10,0,0,0,10,0,1,0,0,0,0,0,1,0,
+4,0,1,0,0,254,141,0,6,2,0,0,1,0,8,0,1,0,12,0,28,0,1,0,38,0,78,0,2,0,2,5,181,
+5,187,0,0,5,189,5,189,0,7,0,2,0,1,5,181,5,187,0,0,0,8,0,0,0,34,0,0,0,34,0,
+0,0,34,0,0,0,34,0,0,0,34,0,0,0,34,0,0,0,34,0,0,0,34,0,1,0,0,4,170,0,7,0,16,
+0,22,0,28,0,34,0,40,0,46,0,52,0,1,0,0,6,111,0,1,0,0,6,195,0,1,0,0,6,0,0,1,
+0,0,6,184,0,1,0,0,6,205,0,1,0,0,6,70,0,1,0,0,5,188,0,1,0,0,0,10,0,30,0,44,
+0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,0,8,0,0,
+0,1,0,0,0,1,0,4,0,4,0,0,0,1,0,8,0,1,56,0,0,50,0,106,1,158,4,74,5,126,6,6,
+6,142,7,194,8,74,9,126,12,42,13,94,16,214,18,10,21,130,22,182,23,234,27,98,
+29,66,30,118,31,170,34,86,35,138,36,18,38,190,39,70,41,242,43,38,44,90,46,
+58,46,194,47,246,49,42,50,94,50,230,51,110,51,246,52,126,53,178,54,58,54,
+194,54,204,54,214,55,24,55,186,55,196,55,206,55,216,55,226,55,236,55,246,
+0,31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,
+164,0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,
+1,10,1,16,1,24,1,30,1,38,1,44,0,5,0,2,5,153,0,6,0,2,5,154,0,8,0,3,5,156,5,
+153,0,9,0,3,5,156,5,154,0,11,0,4,5,156,5,157,5,153,0,10,0,3,5,156,5,157,0,
+14,0,4,5,156,5,158,5,153,0,13,0,3,5,156,5,158,0,16,0,4,5,156,5,159,5,153,
+0,15,0,3,5,156,5,159,0,18,0,4,5,156,5,160,5,153,0,17,0,3,5,156,5,160,0,20,
+0,4,5,156,5,161,5,153,0,19,0,3,5,156,5,161,0,22,0,4,5,156,5,162,5,153,0,21,
+0,3,5,156,5,162,0,12,0,4,5,156,5,190,5,153,0,7,0,2,5,156,0,24,0,3,5,157,5,
+153,0,23,0,2,5,157,0,27,0,3,5,158,5,153,0,26,0,2,5,158,0,29,0,3,5,159,5,153,
+0,28,0,2,5,159,0,31,0,3,5,160,5,153,0,30,0,2,5,160,0,33,0,3,5,161,5,153,0,
+32,0,2,5,161,0,35,0,3,5,162,5,153,0,34,0,2,5,162,0,25,0,3,5,190,5,153,0,63,
+0,128,0,134,0,140,0,148,0,156,0,166,0,176,0,188,0,198,0,210,0,220,0,232,0,
+242,0,254,1,8,1,20,1,30,1,42,1,52,1,64,1,72,1,82,1,90,1,100,1,108,1,118,1,
+126,1,136,1,144,1,154,1,162,1,172,1,180,1,190,1,196,1,204,1,212,1,222,1,230,
+1,240,1,248,2,2,2,10,2,20,2,28,2,38,2,46,2,56,2,64,2,74,2,80,2,88,2,94,2,
+102,2,108,2,116,2,122,2,130,2,136,2,144,2,150,2,158,2,164,0,37,0,2,5,153,
+0,38,0,2,5,154,0,40,0,3,5,155,5,153,0,41,0,3,5,155,5,154,0,43,0,4,5,155,5,
+156,5,153,0,44,0,4,5,155,5,156,5,154,0,46,0,5,5,155,5,156,5,157,5,153,0,45,
+0,4,5,155,5,156,5,157,0,49,0,5,5,155,5,156,5,158,5,153,0,48,0,4,5,155,5,156,
+5,158,0,51,0,5,5,155,5,156,5,159,5,153,0,50,0,4,5,155,5,156,5,159,0,53,0,
+5,5,155,5,156,5,160,5,153,0,52,0,4,5,155,5,156,5,160,0,55,0,5,5,155,5,156,
+5,161,5,153,0,54,0,4,5,155,5,156,5,161,0,57,0,5,5,155,5,156,5,162,5,153,0,
+56,0,4,5,155,5,156,5,162,0,47,0,5,5,155,5,156,5,190,5,153,0,42,0,3,5,155,
+5,156,0,59,0,4,5,155,5,157,5,153,0,58,0,3,5,155,5,157,0,62,0,4,5,155,5,158,
+5,153,0,61,0,3,5,155,5,158,0,64,0,4,5,155,5,159,5,153,0,63,0,3,5,155,5,159,
+0,66,0,4,5,155,5,160,5,153,0,65,0,3,5,155,5,160,0,68,0,4,5,155,5,161,5,153,
+0,67,0,3,5,155,5,161,0,70,0,4,5,155,5,162,5,153,0,69,0,3,5,155,5,162,0,60,
+0,4,5,155,5,190,5,153,0,39,0,2,5,155,0,72,0,3,5,156,5,153,0,73,0,3,5,156,
+5,154,0,75,0,4,5,156,5,157,5,153,0,74,0,3,5,156,5,157,0,78,0,4,5,156,5,158,
+5,153,0,77,0,3,5,156,5,158,0,80,0,4,5,156,5,159,5,153,0,79,0,3,5,156,5,159,
+0,82,0,4,5,156,5,160,5,153,0,81,0,3,5,156,5,160,0,84,0,4,5,156,5,161,5,153,
+0,83,0,3,5,156,5,161,0,86,0,4,5,156,5,162,5,153,0,85,0,3,5,156,5,162,0,76,
+0,4,5,156,5,190,5,153,0,71,0,2,5,156,0,88,0,3,5,157,5,153,0,87,0,2,5,157,
+0,91,0,3,5,158,5,153,0,90,0,2,5,158,0,93,0,3,5,159,5,153,0,92,0,2,5,159,0,
+95,0,3,5,160,5,153,0,94,0,2,5,160,0,97,0,3,5,161,5,153,0,96,0,2,5,161,0,99,
+0,3,5,162,5,153,0,98,0,2,5,162,0,89,0,3,5,190,5,153,0,31,0,64,0,70,0,76,0,
+84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,164,0,174,0,182,0,192,
+0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,1,10,1,16,1,24,1,30,1,
+38,1,44,0,101,0,2,5,153,0,102,0,2,5,154,0,104,0,3,5,156,5,153,0,105,0,3,5,
+156,5,154,0,107,0,4,5,156,5,157,5,153,0,106,0,3,5,156,5,157,0,110,0,4,5,156,
+5,158,5,153,0,109,0,3,5,156,5,158,0,112,0,4,5,156,5,159,5,153,0,111,0,3,5,
+156,5,159,0,114,0,4,5,156,5,160,5,153,0,113,0,3,5,156,5,160,0,116,0,4,5,156,
+5,161,5,153,0,115,0,3,5,156,5,161,0,118,0,4,5,156,5,162,5,153,0,117,0,3,5,
+156,5,162,0,108,0,4,5,156,5,190,5,153,0,103,0,2,5,156,0,120,0,3,5,157,5,153,
+0,119,0,2,5,157,0,123,0,3,5,158,5,153,0,122,0,2,5,158,0,125,0,3,5,159,5,153,
+0,124,0,2,5,159,0,127,0,3,5,160,5,153,0,126,0,2,5,160,0,129,0,3,5,161,5,153,
+0,128,0,2,5,161,0,131,0,3,5,162,5,153,0,130,0,2,5,162,0,121,0,3,5,190,5,153,
+0,15,0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,80,0,86,0,94,0,100,0,108,0,114,
+0,122,0,128,0,133,0,2,5,153,0,134,0,2,5,154,0,136,0,3,5,157,5,153,0,135,0,
+2,5,157,0,139,0,3,5,158,5,153,0,138,0,2,5,158,0,141,0,3,5,159,5,153,0,140,
+0,2,5,159,0,143,0,3,5,160,5,153,0,142,0,2,5,160,0,145,0,3,5,161,5,153,0,144,
+0,2,5,161,0,147,0,3,5,162,5,153,0,146,0,2,5,162,0,137,0,3,5,190,5,153,0,15,
+0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,80,0,86,0,94,0,100,0,108,0,114,0,122,
+0,128,0,149,0,2,5,153,0,150,0,2,5,154,0,152,0,3,5,157,5,153,0,151,0,2,5,157,
+0,155,0,3,5,158,5,153,0,154,0,2,5,158,0,157,0,3,5,159,5,153,0,156,0,2,5,159,
+0,159,0,3,5,160,5,153,0,158,0,2,5,160,0,161,0,3,5,161,5,153,0,160,0,2,5,161,
+0,163,0,3,5,162,5,153,0,162,0,2,5,162,0,153,0,3,5,190,5,153,0,31,0,64,0,70,
+0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,164,0,174,0,182,
+0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,1,10,1,16,1,24,
+1,30,1,38,1,44,0,172,0,2,5,153,0,173,0,2,5,154,0,175,0,3,5,156,5,153,0,176,
+0,3,5,156,5,154,0,178,0,4,5,156,5,157,5,153,0,177,0,3,5,156,5,157,0,181,0,
+4,5,156,5,158,5,153,0,180,0,3,5,156,5,158,0,183,0,4,5,156,5,159,5,153,0,182,
+0,3,5,156,5,159,0,185,0,4,5,156,5,160,5,153,0,184,0,3,5,156,5,160,0,187,0,
+4,5,156,5,161,5,153,0,186,0,3,5,156,5,161,0,189,0,4,5,156,5,162,5,153,0,188,
+0,3,5,156,5,162,0,179,0,4,5,156,5,190,5,153,0,174,0,2,5,156,0,191,0,3,5,157,
+5,153,0,190,0,2,5,157,0,194,0,3,5,158,5,153,0,193,0,2,5,158,0,196,0,3,5,159,
+5,153,0,195,0,2,5,159,0,198,0,3,5,160,5,153,0,197,0,2,5,160,0,200,0,3,5,161,
+5,153,0,199,0,2,5,161,0,202,0,3,5,162,5,153,0,201,0,2,5,162,0,192,0,3,5,190,
+5,153,0,15,0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,80,0,86,0,94,0,100,0,108,
+0,114,0,122,0,128,0,204,0,2,5,153,0,205,0,2,5,154,0,207,0,3,5,157,5,153,0,
+206,0,2,5,157,0,210,0,3,5,158,5,153,0,209,0,2,5,158,0,212,0,3,5,159,5,153,
+0,211,0,2,5,159,0,214,0,3,5,160,5,153,0,213,0,2,5,160,0,216,0,3,5,161,5,153,
+0,215,0,2,5,161,0,218,0,3,5,162,5,153,0,217,0,2,5,162,0,208,0,3,5,190,5,153,
+0,31,0,64,0,70,0,76,0,84,0,90,0,98,0,104,0,112,0,118,0,126,0,132,0,140,0,
+146,0,154,0,160,0,168,0,176,0,186,0,194,0,204,0,212,0,222,0,230,0,240,0,248,
+1,2,1,10,1,20,1,28,1,38,1,44,0,240,0,2,5,153,0,241,0,2,5,154,1,3,0,3,5,157,
+5,153,1,2,0,2,5,157,1,6,0,3,5,158,5,153,1,5,0,2,5,158,1,8,0,3,5,159,5,153,
+1,7,0,2,5,159,1,10,0,3,5,160,5,153,1,9,0,2,5,160,1,12,0,3,5,161,5,153,1,11,
+0,2,5,161,1,14,0,3,5,162,5,153,1,13,0,2,5,162,0,243,0,3,5,188,5,153,0,244,
+0,3,5,188,5,154,0,246,0,4,5,188,5,157,5,153,0,245,0,3,5,188,5,157,0,249,0,
+4,5,188,5,158,5,153,0,248,0,3,5,188,5,158,0,251,0,4,5,188,5,159,5,153,0,250,
+0,3,5,188,5,159,0,253,0,4,5,188,5,160,5,153,0,252,0,3,5,188,5,160,0,255,0,
+4,5,188,5,161,5,153,0,254,0,3,5,188,5,161,1,1,0,4,5,188,5,162,5,153,1,0,0,
+3,5,188,5,162,0,247,0,4,5,188,5,190,5,153,0,242,0,2,5,188,1,4,0,3,5,190,5,
+153,0,63,0,128,0,134,0,140,0,148,0,156,0,166,0,176,0,188,0,198,0,210,0,220,
+0,232,0,242,0,254,1,8,1,20,1,30,1,42,1,52,1,64,1,72,1,82,1,90,1,100,1,108,
+1,118,1,126,1,136,1,144,1,154,1,162,1,172,1,180,1,190,1,196,1,204,1,212,1,
+222,1,230,1,240,1,248,2,2,2,10,2,20,2,28,2,38,2,46,2,56,2,64,2,74,2,80,2,
+88,2,94,2,102,2,108,2,116,2,122,2,130,2,136,2,144,2,150,2,158,2,164,1,16,
+0,2,5,153,1,17,0,2,5,154,1,19,0,3,5,155,5,153,1,20,0,3,5,155,5,154,1,22,0,
+4,5,155,5,156,5,153,1,23,0,4,5,155,5,156,5,154,1,25,0,5,5,155,5,156,5,157,
+5,153,1,24,0,4,5,155,5,156,5,157,1,28,0,5,5,155,5,156,5,158,5,153,1,27,0,
+4,5,155,5,156,5,158,1,30,0,5,5,155,5,156,5,159,5,153,1,29,0,4,5,155,5,156,
+5,159,1,32,0,5,5,155,5,156,5,160,5,153,1,31,0,4,5,155,5,156,5,160,1,34,0,
+5,5,155,5,156,5,161,5,153,1,33,0,4,5,155,5,156,5,161,1,36,0,5,5,155,5,156,
+5,162,5,153,1,35,0,4,5,155,5,156,5,162,1,26,0,5,5,155,5,156,5,190,5,153,1,
+21,0,3,5,155,5,156,1,38,0,4,5,155,5,157,5,153,1,37,0,3,5,155,5,157,1,41,0,
+4,5,155,5,158,5,153,1,40,0,3,5,155,5,158,1,43,0,4,5,155,5,159,5,153,1,42,
+0,3,5,155,5,159,1,45,0,4,5,155,5,160,5,153,1,44,0,3,5,155,5,160,1,47,0,4,
+5,155,5,161,5,153,1,46,0,3,5,155,5,161,1,49,0,4,5,155,5,162,5,153,1,48,0,
+3,5,155,5,162,1,39,0,4,5,155,5,190,5,153,1,18,0,2,5,155,1,51,0,3,5,156,5,
+153,1,52,0,3,5,156,5,154,1,54,0,4,5,156,5,157,5,153,1,53,0,3,5,156,5,157,
+1,57,0,4,5,156,5,158,5,153,1,56,0,3,5,156,5,158,1,59,0,4,5,156,5,159,5,153,
+1,58,0,3,5,156,5,159,1,61,0,4,5,156,5,160,5,153,1,60,0,3,5,156,5,160,1,63,
+0,4,5,156,5,161,5,153,1,62,0,3,5,156,5,161,1,65,0,4,5,156,5,162,5,153,1,64,
+0,3,5,156,5,162,1,55,0,4,5,156,5,190,5,153,1,50,0,2,5,156,1,67,0,3,5,157,
+5,153,1,66,0,2,5,157,1,70,0,3,5,158,5,153,1,69,0,2,5,158,1,72,0,3,5,159,5,
+153,1,71,0,2,5,159,1,74,0,3,5,160,5,153,1,73,0,2,5,160,1,76,0,3,5,161,5,153,
+1,75,0,2,5,161,1,78,0,3,5,162,5,153,1,77,0,2,5,162,1,68,0,3,5,190,5,153,0,
+31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,164,
+0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,1,10,
+1,16,1,24,1,30,1,38,1,44,1,80,0,2,5,153,1,81,0,2,5,154,1,83,0,3,5,156,5,153,
+1,84,0,3,5,156,5,154,1,86,0,4,5,156,5,157,5,153,1,85,0,3,5,156,5,157,1,89,
+0,4,5,156,5,158,5,153,1,88,0,3,5,156,5,158,1,91,0,4,5,156,5,159,5,153,1,90,
+0,3,5,156,5,159,1,93,0,4,5,156,5,160,5,153,1,92,0,3,5,156,5,160,1,95,0,4,
+5,156,5,161,5,153,1,94,0,3,5,156,5,161,1,97,0,4,5,156,5,162,5,153,1,96,0,
+3,5,156,5,162,1,87,0,4,5,156,5,190,5,153,1,82,0,2,5,156,1,99,0,3,5,157,5,
+153,1,98,0,2,5,157,1,102,0,3,5,158,5,153,1,101,0,2,5,158,1,104,0,3,5,159,
+5,153,1,103,0,2,5,159,1,106,0,3,5,160,5,153,1,105,0,2,5,160,1,108,0,3,5,161,
+5,153,1,107,0,2,5,161,1,110,0,3,5,162,5,153,1,109,0,2,5,162,1,100,0,3,5,190,
+5,153,0,79,0,160,0,166,0,172,0,180,0,188,0,198,0,208,0,220,0,230,0,242,0,
+252,1,8,1,18,1,30,1,40,1,52,1,62,1,74,1,84,1,96,1,104,1,114,1,122,1,132,1,
+140,1,150,1,158,1,168,1,176,1,186,1,194,1,204,1,212,1,222,1,228,1,236,1,244,
+1,254,2,6,2,16,2,24,2,34,2,42,2,52,2,60,2,70,2,78,2,88,2,96,2,106,2,112,2,
+120,2,126,2,134,2,140,2,148,2,154,2,162,2,168,2,176,2,182,2,190,2,196,2,206,
+2,216,2,228,2,238,2,250,3,4,3,16,3,26,3,38,3,48,3,60,3,70,3,82,3,92,3,104,
+3,112,1,112,0,2,5,153,1,113,0,2,5,154,1,131,0,3,5,155,5,153,1,132,0,3,5,155,
+5,154,1,134,0,4,5,155,5,156,5,153,1,135,0,4,5,155,5,156,5,154,1,137,0,5,5,
+155,5,156,5,157,5,153,1,136,0,4,5,155,5,156,5,157,1,140,0,5,5,155,5,156,5,
+158,5,153,1,139,0,4,5,155,5,156,5,158,1,142,0,5,5,155,5,156,5,159,5,153,1,
+141,0,4,5,155,5,156,5,159,1,144,0,5,5,155,5,156,5,160,5,153,1,143,0,4,5,155,
+5,156,5,160,1,146,0,5,5,155,5,156,5,161,5,153,1,145,0,4,5,155,5,156,5,161,
+1,148,0,5,5,155,5,156,5,162,5,153,1,147,0,4,5,155,5,156,5,162,1,138,0,5,5,
+155,5,156,5,190,5,153,1,133,0,3,5,155,5,156,1,150,0,4,5,155,5,157,5,153,1,
+149,0,3,5,155,5,157,1,153,0,4,5,155,5,158,5,153,1,152,0,3,5,155,5,158,1,155,
+0,4,5,155,5,159,5,153,1,154,0,3,5,155,5,159,1,157,0,4,5,155,5,160,5,153,1,
+156,0,3,5,155,5,160,1,159,0,4,5,155,5,161,5,153,1,158,0,3,5,155,5,161,1,161,
+0,4,5,155,5,162,5,153,1,160,0,3,5,155,5,162,1,151,0,4,5,155,5,190,5,153,1,
+130,0,2,5,155,1,163,0,3,5,156,5,153,1,164,0,3,5,156,5,154,1,166,0,4,5,156,
+5,157,5,153,1,165,0,3,5,156,5,157,1,169,0,4,5,156,5,158,5,153,1,168,0,3,5,
+156,5,158,1,171,0,4,5,156,5,159,5,153,1,170,0,3,5,156,5,159,1,173,0,4,5,156,
+5,160,5,153,1,172,0,3,5,156,5,160,1,175,0,4,5,156,5,161,5,153,1,174,0,3,5,
+156,5,161,1,177,0,4,5,156,5,162,5,153,1,176,0,3,5,156,5,162,1,167,0,4,5,156,
+5,190,5,153,1,162,0,2,5,156,1,179,0,3,5,157,5,153,1,178,0,2,5,157,1,182,0,
+3,5,158,5,153,1,181,0,2,5,158,1,184,0,3,5,159,5,153,1,183,0,2,5,159,1,186,
+0,3,5,160,5,153,1,185,0,2,5,160,1,188,0,3,5,161,5,153,1,187,0,2,5,161,1,190,
+0,3,5,162,5,153,1,189,0,2,5,162,1,115,0,4,5,188,5,155,5,153,1,116,0,4,5,188,
+5,155,5,154,1,118,0,5,5,188,5,155,5,157,5,153,1,117,0,4,5,188,5,155,5,157,
+1,121,0,5,5,188,5,155,5,158,5,153,1,120,0,4,5,188,5,155,5,158,1,123,0,5,5,
+188,5,155,5,159,5,153,1,122,0,4,5,188,5,155,5,159,1,125,0,5,5,188,5,155,5,
+160,5,153,1,124,0,4,5,188,5,155,5,160,1,127,0,5,5,188,5,155,5,161,5,153,1,
+126,0,4,5,188,5,155,5,161,1,129,0,5,5,188,5,155,5,162,5,153,1,128,0,4,5,188,
+5,155,5,162,1,119,0,5,5,188,5,155,5,190,5,153,1,114,0,3,5,188,5,155,1,180,
+0,3,5,190,5,153,0,31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,
+0,146,0,156,0,164,0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,
+244,0,252,1,2,1,10,1,16,1,24,1,30,1,38,1,44,1,192,0,2,5,153,1,193,0,2,5,154,
+1,195,0,3,5,156,5,153,1,196,0,3,5,156,5,154,1,198,0,4,5,156,5,157,5,153,1,
+197,0,3,5,156,5,157,1,201,0,4,5,156,5,158,5,153,1,200,0,3,5,156,5,158,1,203,
+0,4,5,156,5,159,5,153,1,202,0,3,5,156,5,159,1,205,0,4,5,156,5,160,5,153,1,
+204,0,3,5,156,5,160,1,207,0,4,5,156,5,161,5,153,1,206,0,3,5,156,5,161,1,209,
+0,4,5,156,5,162,5,153,1,208,0,3,5,156,5,162,1,199,0,4,5,156,5,190,5,153,1,
+194,0,2,5,156,1,211,0,3,5,157,5,153,1,210,0,2,5,157,1,214,0,3,5,158,5,153,
+1,213,0,2,5,158,1,216,0,3,5,159,5,153,1,215,0,2,5,159,1,218,0,3,5,160,5,153,
+1,217,0,2,5,160,1,220,0,3,5,161,5,153,1,219,0,2,5,161,1,222,0,3,5,162,5,153,
+1,221,0,2,5,162,1,212,0,3,5,190,5,153,0,79,0,160,0,166,0,172,0,180,0,188,
+0,198,0,208,0,220,0,230,0,242,0,252,1,8,1,18,1,30,1,40,1,52,1,62,1,74,1,84,
+1,96,1,104,1,114,1,122,1,132,1,140,1,150,1,158,1,168,1,176,1,186,1,194,1,
+204,1,212,1,222,1,228,1,236,1,244,1,254,2,6,2,16,2,24,2,34,2,42,2,52,2,60,
+2,70,2,78,2,88,2,96,2,106,2,112,2,120,2,126,2,134,2,140,2,148,2,154,2,162,
+2,168,2,176,2,182,2,190,2,196,2,206,2,216,2,228,2,238,2,250,3,4,3,16,3,26,
+3,38,3,48,3,60,3,70,3,82,3,92,3,104,3,112,1,224,0,2,5,153,1,225,0,2,5,154,
+1,243,0,3,5,155,5,153,1,244,0,3,5,155,5,154,1,246,0,4,5,155,5,156,5,153,1,
+247,0,4,5,155,5,156,5,154,1,249,0,5,5,155,5,156,5,157,5,153,1,248,0,4,5,155,
+5,156,5,157,1,252,0,5,5,155,5,156,5,158,5,153,1,251,0,4,5,155,5,156,5,158,
+1,254,0,5,5,155,5,156,5,159,5,153,1,253,0,4,5,155,5,156,5,159,2,0,0,5,5,155,
+5,156,5,160,5,153,1,255,0,4,5,155,5,156,5,160,2,2,0,5,5,155,5,156,5,161,5,
+153,2,1,0,4,5,155,5,156,5,161,2,4,0,5,5,155,5,156,5,162,5,153,2,3,0,4,5,155,
+5,156,5,162,1,250,0,5,5,155,5,156,5,190,5,153,1,245,0,3,5,155,5,156,2,6,0,
+4,5,155,5,157,5,153,2,5,0,3,5,155,5,157,2,9,0,4,5,155,5,158,5,153,2,8,0,3,
+5,155,5,158,2,11,0,4,5,155,5,159,5,153,2,10,0,3,5,155,5,159,2,13,0,4,5,155,
+5,160,5,153,2,12,0,3,5,155,5,160,2,15,0,4,5,155,5,161,5,153,2,14,0,3,5,155,
+5,161,2,17,0,4,5,155,5,162,5,153,2,16,0,3,5,155,5,162,2,7,0,4,5,155,5,190,
+5,153,1,242,0,2,5,155,2,19,0,3,5,156,5,153,2,20,0,3,5,156,5,154,2,22,0,4,
+5,156,5,157,5,153,2,21,0,3,5,156,5,157,2,25,0,4,5,156,5,158,5,153,2,24,0,
+3,5,156,5,158,2,27,0,4,5,156,5,159,5,153,2,26,0,3,5,156,5,159,2,29,0,4,5,
+156,5,160,5,153,2,28,0,3,5,156,5,160,2,31,0,4,5,156,5,161,5,153,2,30,0,3,
+5,156,5,161,2,33,0,4,5,156,5,162,5,153,2,32,0,3,5,156,5,162,2,23,0,4,5,156,
+5,190,5,153,2,18,0,2,5,156,2,35,0,3,5,157,5,153,2,34,0,2,5,157,2,38,0,3,5,
+158,5,153,2,37,0,2,5,158,2,40,0,3,5,159,5,153,2,39,0,2,5,159,2,42,0,3,5,160,
+5,153,2,41,0,2,5,160,2,44,0,3,5,161,5,153,2,43,0,2,5,161,2,46,0,3,5,162,5,
+153,2,45,0,2,5,162,1,227,0,4,5,188,5,155,5,153,1,228,0,4,5,188,5,155,5,154,
+1,230,0,5,5,188,5,155,5,157,5,153,1,229,0,4,5,188,5,155,5,157,1,233,0,5,5,
+188,5,155,5,158,5,153,1,232,0,4,5,188,5,155,5,158,1,235,0,5,5,188,5,155,5,
+159,5,153,1,234,0,4,5,188,5,155,5,159,1,237,0,5,5,188,5,155,5,160,5,153,1,
+236,0,4,5,188,5,155,5,160,1,239,0,5,5,188,5,155,5,161,5,153,1,238,0,4,5,188,
+5,155,5,161,1,241,0,5,5,188,5,155,5,162,5,153,1,240,0,4,5,188,5,155,5,162,
+1,231,0,5,5,188,5,155,5,190,5,153,1,226,0,3,5,188,5,155,2,36,0,3,5,190,5,
+153,0,31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,
+0,164,0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,
+2,1,10,1,16,1,24,1,30,1,38,1,44,2,48,0,2,5,153,2,49,0,2,5,154,2,51,0,3,5,
+156,5,153,2,52,0,3,5,156,5,154,2,54,0,4,5,156,5,157,5,153,2,53,0,3,5,156,
+5,157,2,57,0,4,5,156,5,158,5,153,2,56,0,3,5,156,5,158,2,59,0,4,5,156,5,159,
+5,153,2,58,0,3,5,156,5,159,2,61,0,4,5,156,5,160,5,153,2,60,0,3,5,156,5,160,
+2,63,0,4,5,156,5,161,5,153,2,62,0,3,5,156,5,161,2,65,0,4,5,156,5,162,5,153,
+2,64,0,3,5,156,5,162,2,55,0,4,5,156,5,190,5,153,2,50,0,2,5,156,2,67,0,3,5,
+157,5,153,2,66,0,2,5,157,2,70,0,3,5,158,5,153,2,69,0,2,5,158,2,72,0,3,5,159,
+5,153,2,71,0,2,5,159,2,74,0,3,5,160,5,153,2,73,0,2,5,160,2,76,0,3,5,161,5,
+153,2,75,0,2,5,161,2,78,0,3,5,162,5,153,2,77,0,2,5,162,2,68,0,3,5,190,5,153,
+0,31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,
+164,0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,
+1,10,1,16,1,24,1,30,1,38,1,44,2,80,0,2,5,153,2,81,0,2,5,154,2,83,0,3,5,156,
+5,153,2,84,0,3,5,156,5,154,2,86,0,4,5,156,5,157,5,153,2,85,0,3,5,156,5,157,
+2,89,0,4,5,156,5,158,5,153,2,88,0,3,5,156,5,158,2,91,0,4,5,156,5,159,5,153,
+2,90,0,3,5,156,5,159,2,93,0,4,5,156,5,160,5,153,2,92,0,3,5,156,5,160,2,95,
+0,4,5,156,5,161,5,153,2,94,0,3,5,156,5,161,2,97,0,4,5,156,5,162,5,153,2,96,
+0,3,5,156,5,162,2,87,0,4,5,156,5,190,5,153,2,82,0,2,5,156,2,99,0,3,5,157,
+5,153,2,98,0,2,5,157,2,102,0,3,5,158,5,153,2,101,0,2,5,158,2,104,0,3,5,159,
+5,153,2,103,0,2,5,159,2,106,0,3,5,160,5,153,2,105,0,2,5,160,2,108,0,3,5,161,
+5,153,2,107,0,2,5,161,2,110,0,3,5,162,5,153,2,109,0,2,5,162,2,100,0,3,5,190,
+5,153,0,79,0,160,0,166,0,172,0,180,0,188,0,198,0,208,0,220,0,230,0,242,0,
+252,1,8,1,18,1,30,1,40,1,52,1,62,1,74,1,84,1,96,1,104,1,114,1,122,1,132,1,
+140,1,150,1,158,1,168,1,176,1,186,1,194,1,204,1,212,1,222,1,228,1,236,1,244,
+1,254,2,6,2,16,2,24,2,34,2,42,2,52,2,60,2,70,2,78,2,88,2,96,2,106,2,112,2,
+120,2,126,2,134,2,140,2,148,2,154,2,162,2,168,2,176,2,182,2,190,2,196,2,206,
+2,216,2,228,2,238,2,250,3,4,3,16,3,26,3,38,3,48,3,60,3,70,3,82,3,92,3,104,
+3,112,2,112,0,2,5,153,2,113,0,2,5,154,2,131,0,3,5,155,5,153,2,132,0,3,5,155,
+5,154,2,134,0,4,5,155,5,156,5,153,2,135,0,4,5,155,5,156,5,154,2,137,0,5,5,
+155,5,156,5,157,5,153,2,136,0,4,5,155,5,156,5,157,2,140,0,5,5,155,5,156,5,
+158,5,153,2,139,0,4,5,155,5,156,5,158,2,142,0,5,5,155,5,156,5,159,5,153,2,
+141,0,4,5,155,5,156,5,159,2,144,0,5,5,155,5,156,5,160,5,153,2,143,0,4,5,155,
+5,156,5,160,2,146,0,5,5,155,5,156,5,161,5,153,2,145,0,4,5,155,5,156,5,161,
+2,148,0,5,5,155,5,156,5,162,5,153,2,147,0,4,5,155,5,156,5,162,2,138,0,5,5,
+155,5,156,5,190,5,153,2,133,0,3,5,155,5,156,2,150,0,4,5,155,5,157,5,153,2,
+149,0,3,5,155,5,157,2,153,0,4,5,155,5,158,5,153,2,152,0,3,5,155,5,158,2,155,
+0,4,5,155,5,159,5,153,2,154,0,3,5,155,5,159,2,157,0,4,5,155,5,160,5,153,2,
+156,0,3,5,155,5,160,2,159,0,4,5,155,5,161,5,153,2,158,0,3,5,155,5,161,2,161,
+0,4,5,155,5,162,5,153,2,160,0,3,5,155,5,162,2,151,0,4,5,155,5,190,5,153,2,
+130,0,2,5,155,2,163,0,3,5,156,5,153,2,164,0,3,5,156,5,154,2,166,0,4,5,156,
+5,157,5,153,2,165,0,3,5,156,5,157,2,169,0,4,5,156,5,158,5,153,2,168,0,3,5,
+156,5,158,2,171,0,4,5,156,5,159,5,153,2,170,0,3,5,156,5,159,2,173,0,4,5,156,
+5,160,5,153,2,172,0,3,5,156,5,160,2,175,0,4,5,156,5,161,5,153,2,174,0,3,5,
+156,5,161,2,177,0,4,5,156,5,162,5,153,2,176,0,3,5,156,5,162,2,167,0,4,5,156,
+5,190,5,153,2,162,0,2,5,156,2,179,0,3,5,157,5,153,2,178,0,2,5,157,2,182,0,
+3,5,158,5,153,2,181,0,2,5,158,2,184,0,3,5,159,5,153,2,183,0,2,5,159,2,186,
+0,3,5,160,5,153,2,185,0,2,5,160,2,188,0,3,5,161,5,153,2,187,0,2,5,161,2,190,
+0,3,5,162,5,153,2,189,0,2,5,162,2,115,0,4,5,188,5,155,5,153,2,116,0,4,5,188,
+5,155,5,154,2,118,0,5,5,188,5,155,5,157,5,153,2,117,0,4,5,188,5,155,5,157,
+2,121,0,5,5,188,5,155,5,158,5,153,2,120,0,4,5,188,5,155,5,158,2,123,0,5,5,
+188,5,155,5,159,5,153,2,122,0,4,5,188,5,155,5,159,2,125,0,5,5,188,5,155,5,
+160,5,153,2,124,0,4,5,188,5,155,5,160,2,127,0,5,5,188,5,155,5,161,5,153,2,
+126,0,4,5,188,5,155,5,161,2,129,0,5,5,188,5,155,5,162,5,153,2,128,0,4,5,188,
+5,155,5,162,2,119,0,5,5,188,5,155,5,190,5,153,2,114,0,3,5,188,5,155,2,180,
+0,3,5,190,5,153,0,47,0,96,0,102,0,108,0,116,0,124,0,134,0,142,0,152,0,160,
+0,170,0,178,0,188,0,196,0,206,0,214,0,224,0,232,0,242,0,248,1,0,1,8,1,18,
+1,26,1,36,1,44,1,54,1,62,1,72,1,80,1,90,1,98,1,108,1,116,1,126,1,132,1,140,
+1,146,1,154,1,160,1,168,1,174,1,182,1,188,1,196,1,202,1,210,1,216,2,192,0,
+2,5,153,2,193,0,2,5,154,2,195,0,3,5,155,5,153,2,196,0,3,5,155,5,154,2,198,
+0,4,5,155,5,157,5,153,2,197,0,3,5,155,5,157,2,201,0,4,5,155,5,158,5,153,2,
+200,0,3,5,155,5,158,2,203,0,4,5,155,5,159,5,153,2,202,0,3,5,155,5,159,2,205,
+0,4,5,155,5,160,5,153,2,204,0,3,5,155,5,160,2,207,0,4,5,155,5,161,5,153,2,
+206,0,3,5,155,5,161,2,209,0,4,5,155,5,162,5,153,2,208,0,3,5,155,5,162,2,199,
+0,4,5,155,5,190,5,153,2,194,0,2,5,155,2,211,0,3,5,156,5,153,2,212,0,3,5,156,
+5,154,2,214,0,4,5,156,5,157,5,153,2,213,0,3,5,156,5,157,2,217,0,4,5,156,5,
+158,5,153,2,216,0,3,5,156,5,158,2,219,0,4,5,156,5,159,5,153,2,218,0,3,5,156,
+5,159,2,221,0,4,5,156,5,160,5,153,2,220,0,3,5,156,5,160,2,223,0,4,5,156,5,
+161,5,153,2,222,0,3,5,156,5,161,2,225,0,4,5,156,5,162,5,153,2,224,0,3,5,156,
+5,162,2,215,0,4,5,156,5,190,5,153,2,210,0,2,5,156,2,227,0,3,5,157,5,153,2,
+226,0,2,5,157,2,230,0,3,5,158,5,153,2,229,0,2,5,158,2,232,0,3,5,159,5,153,
+2,231,0,2,5,159,2,234,0,3,5,160,5,153,2,233,0,2,5,160,2,236,0,3,5,161,5,153,
+2,235,0,2,5,161,2,238,0,3,5,162,5,153,2,237,0,2,5,162,2,228,0,3,5,190,5,153,
+0,31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,
+164,0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,
+1,10,1,16,1,24,1,30,1,38,1,44,2,240,0,2,5,153,2,241,0,2,5,154,2,243,0,3,5,
+156,5,153,2,244,0,3,5,156,5,154,2,246,0,4,5,156,5,157,5,153,2,245,0,3,5,156,
+5,157,2,249,0,4,5,156,5,158,5,153,2,248,0,3,5,156,5,158,2,251,0,4,5,156,5,
+159,5,153,2,250,0,3,5,156,5,159,2,253,0,4,5,156,5,160,5,153,2,252,0,3,5,156,
+5,160,2,255,0,4,5,156,5,161,5,153,2,254,0,3,5,156,5,161,3,1,0,4,5,156,5,162,
+5,153,3,0,0,3,5,156,5,162,2,247,0,4,5,156,5,190,5,153,2,242,0,2,5,156,3,3,
+0,3,5,157,5,153,3,2,0,2,5,157,3,6,0,3,5,158,5,153,3,5,0,2,5,158,3,8,0,3,5,
+159,5,153,3,7,0,2,5,159,3,10,0,3,5,160,5,153,3,9,0,2,5,160,3,12,0,3,5,161,
+5,153,3,11,0,2,5,161,3,14,0,3,5,162,5,153,3,13,0,2,5,162,3,4,0,3,5,190,5,
+153,0,31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,
+0,164,0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,
+2,1,10,1,16,1,24,1,30,1,38,1,44,3,16,0,2,5,153,3,17,0,2,5,154,3,19,0,3,5,
+156,5,153,3,20,0,3,5,156,5,154,3,22,0,4,5,156,5,157,5,153,3,21,0,3,5,156,
+5,157,3,25,0,4,5,156,5,158,5,153,3,24,0,3,5,156,5,158,3,27,0,4,5,156,5,159,
+5,153,3,26,0,3,5,156,5,159,3,29,0,4,5,156,5,160,5,153,3,28,0,3,5,156,5,160,
+3,31,0,4,5,156,5,161,5,153,3,30,0,3,5,156,5,161,3,33,0,4,5,156,5,162,5,153,
+3,32,0,3,5,156,5,162,3,23,0,4,5,156,5,190,5,153,3,18,0,2,5,156,3,35,0,3,5,
+157,5,153,3,34,0,2,5,157,3,38,0,3,5,158,5,153,3,37,0,2,5,158,3,40,0,3,5,159,
+5,153,3,39,0,2,5,159,3,42,0,3,5,160,5,153,3,41,0,2,5,160,3,44,0,3,5,161,5,
+153,3,43,0,2,5,161,3,46,0,3,5,162,5,153,3,45,0,2,5,162,3,36,0,3,5,190,5,153,
+0,63,0,128,0,134,0,140,0,148,0,156,0,166,0,176,0,188,0,198,0,210,0,220,0,
+232,0,242,0,254,1,8,1,20,1,30,1,42,1,52,1,64,1,72,1,82,1,90,1,100,1,108,1,
+118,1,126,1,136,1,144,1,154,1,162,1,172,1,180,1,190,1,196,1,204,1,212,1,222,
+1,230,1,240,1,248,2,2,2,10,2,20,2,28,2,38,2,46,2,56,2,64,2,74,2,80,2,88,2,
+94,2,102,2,108,2,116,2,122,2,130,2,136,2,144,2,150,2,158,2,164,3,48,0,2,5,
+153,3,49,0,2,5,154,3,51,0,3,5,155,5,153,3,52,0,3,5,155,5,154,3,54,0,4,5,155,
+5,156,5,153,3,55,0,4,5,155,5,156,5,154,3,57,0,5,5,155,5,156,5,157,5,153,3,
+56,0,4,5,155,5,156,5,157,3,60,0,5,5,155,5,156,5,158,5,153,3,59,0,4,5,155,
+5,156,5,158,3,62,0,5,5,155,5,156,5,159,5,153,3,61,0,4,5,155,5,156,5,159,3,
+64,0,5,5,155,5,156,5,160,5,153,3,63,0,4,5,155,5,156,5,160,3,66,0,5,5,155,
+5,156,5,161,5,153,3,65,0,4,5,155,5,156,5,161,3,68,0,5,5,155,5,156,5,162,5,
+153,3,67,0,4,5,155,5,156,5,162,3,58,0,5,5,155,5,156,5,190,5,153,3,53,0,3,
+5,155,5,156,3,70,0,4,5,155,5,157,5,153,3,69,0,3,5,155,5,157,3,73,0,4,5,155,
+5,158,5,153,3,72,0,3,5,155,5,158,3,75,0,4,5,155,5,159,5,153,3,74,0,3,5,155,
+5,159,3,77,0,4,5,155,5,160,5,153,3,76,0,3,5,155,5,160,3,79,0,4,5,155,5,161,
+5,153,3,78,0,3,5,155,5,161,3,81,0,4,5,155,5,162,5,153,3,80,0,3,5,155,5,162,
+3,71,0,4,5,155,5,190,5,153,3,50,0,2,5,155,3,83,0,3,5,156,5,153,3,84,0,3,5,
+156,5,154,3,86,0,4,5,156,5,157,5,153,3,85,0,3,5,156,5,157,3,89,0,4,5,156,
+5,158,5,153,3,88,0,3,5,156,5,158,3,91,0,4,5,156,5,159,5,153,3,90,0,3,5,156,
+5,159,3,93,0,4,5,156,5,160,5,153,3,92,0,3,5,156,5,160,3,95,0,4,5,156,5,161,
+5,153,3,94,0,3,5,156,5,161,3,97,0,4,5,156,5,162,5,153,3,96,0,3,5,156,5,162,
+3,87,0,4,5,156,5,190,5,153,3,82,0,2,5,156,3,99,0,3,5,157,5,153,3,98,0,2,5,
+157,3,102,0,3,5,158,5,153,3,101,0,2,5,158,3,104,0,3,5,159,5,153,3,103,0,2,
+5,159,3,106,0,3,5,160,5,153,3,105,0,2,5,160,3,108,0,3,5,161,5,153,3,107,0,
+2,5,161,3,110,0,3,5,162,5,153,3,109,0,2,5,162,3,100,0,3,5,190,5,153,0,31,
+0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,164,
+0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,1,10,
+1,16,1,24,1,30,1,38,1,44,3,112,0,2,5,153,3,113,0,2,5,154,3,115,0,3,5,156,
+5,153,3,116,0,3,5,156,5,154,3,118,0,4,5,156,5,157,5,153,3,117,0,3,5,156,5,
+157,3,121,0,4,5,156,5,158,5,153,3,120,0,3,5,156,5,158,3,123,0,4,5,156,5,159,
+5,153,3,122,0,3,5,156,5,159,3,125,0,4,5,156,5,160,5,153,3,124,0,3,5,156,5,
+160,3,127,0,4,5,156,5,161,5,153,3,126,0,3,5,156,5,161,3,129,0,4,5,156,5,162,
+5,153,3,128,0,3,5,156,5,162,3,119,0,4,5,156,5,190,5,153,3,114,0,2,5,156,3,
+131,0,3,5,157,5,153,3,130,0,2,5,157,3,134,0,3,5,158,5,153,3,133,0,2,5,158,
+3,136,0,3,5,159,5,153,3,135,0,2,5,159,3,138,0,3,5,160,5,153,3,137,0,2,5,160,
+3,140,0,3,5,161,5,153,3,139,0,2,5,161,3,142,0,3,5,162,5,153,3,141,0,2,5,162,
+3,132,0,3,5,190,5,153,0,15,0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,80,0,86,0,
+94,0,100,0,108,0,114,0,122,0,128,3,144,0,2,5,153,3,145,0,2,5,154,3,147,0,
+3,5,157,5,153,3,146,0,2,5,157,3,150,0,3,5,158,5,153,3,149,0,2,5,158,3,152,
+0,3,5,159,5,153,3,151,0,2,5,159,3,154,0,3,5,160,5,153,3,153,0,2,5,160,3,156,
+0,3,5,161,5,153,3,155,0,2,5,161,3,158,0,3,5,162,5,153,3,157,0,2,5,162,3,148,
+0,3,5,190,5,153,0,63,0,128,0,134,0,140,0,148,0,156,0,166,0,176,0,188,0,198,
+0,210,0,220,0,232,0,242,0,254,1,8,1,20,1,30,1,42,1,52,1,64,1,72,1,82,1,90,
+1,100,1,108,1,118,1,126,1,136,1,144,1,154,1,162,1,172,1,180,1,190,1,196,1,
+204,1,212,1,222,1,230,1,240,1,248,2,2,2,10,2,20,2,28,2,38,2,46,2,56,2,64,
+2,74,2,80,2,88,2,94,2,102,2,108,2,116,2,122,2,130,2,136,2,144,2,150,2,158,
+2,164,3,160,0,2,5,153,3,161,0,2,5,154,3,163,0,3,5,155,5,153,3,164,0,3,5,155,
+5,154,3,166,0,4,5,155,5,156,5,153,3,167,0,4,5,155,5,156,5,154,3,169,0,5,5,
+155,5,156,5,157,5,153,3,168,0,4,5,155,5,156,5,157,3,172,0,5,5,155,5,156,5,
+158,5,153,3,171,0,4,5,155,5,156,5,158,3,174,0,5,5,155,5,156,5,159,5,153,3,
+173,0,4,5,155,5,156,5,159,3,176,0,5,5,155,5,156,5,160,5,153,3,175,0,4,5,155,
+5,156,5,160,3,178,0,5,5,155,5,156,5,161,5,153,3,177,0,4,5,155,5,156,5,161,
+3,180,0,5,5,155,5,156,5,162,5,153,3,179,0,4,5,155,5,156,5,162,3,170,0,5,5,
+155,5,156,5,190,5,153,3,165,0,3,5,155,5,156,3,182,0,4,5,155,5,157,5,153,3,
+181,0,3,5,155,5,157,3,185,0,4,5,155,5,158,5,153,3,184,0,3,5,155,5,158,3,187,
+0,4,5,155,5,159,5,153,3,186,0,3,5,155,5,159,3,189,0,4,5,155,5,160,5,153,3,
+188,0,3,5,155,5,160,3,191,0,4,5,155,5,161,5,153,3,190,0,3,5,155,5,161,3,193,
+0,4,5,155,5,162,5,153,3,192,0,3,5,155,5,162,3,183,0,4,5,155,5,190,5,153,3,
+162,0,2,5,155,3,195,0,3,5,156,5,153,3,196,0,3,5,156,5,154,3,198,0,4,5,156,
+5,157,5,153,3,197,0,3,5,156,5,157,3,201,0,4,5,156,5,158,5,153,3,200,0,3,5,
+156,5,158,3,203,0,4,5,156,5,159,5,153,3,202,0,3,5,156,5,159,3,205,0,4,5,156,
+5,160,5,153,3,204,0,3,5,156,5,160,3,207,0,4,5,156,5,161,5,153,3,206,0,3,5,
+156,5,161,3,209,0,4,5,156,5,162,5,153,3,208,0,3,5,156,5,162,3,199,0,4,5,156,
+5,190,5,153,3,194,0,2,5,156,3,211,0,3,5,157,5,153,3,210,0,2,5,157,3,214,0,
+3,5,158,5,153,3,213,0,2,5,158,3,216,0,3,5,159,5,153,3,215,0,2,5,159,3,218,
+0,3,5,160,5,153,3,217,0,2,5,160,3,220,0,3,5,161,5,153,3,219,0,2,5,161,3,222,
+0,3,5,162,5,153,3,221,0,2,5,162,3,212,0,3,5,190,5,153,0,15,0,32,0,38,0,44,
+0,52,0,58,0,66,0,72,0,80,0,86,0,94,0,100,0,108,0,114,0,122,0,128,3,224,0,
+2,5,153,3,225,0,2,5,154,3,227,0,3,5,157,5,153,3,226,0,2,5,157,3,230,0,3,5,
+158,5,153,3,229,0,2,5,158,3,232,0,3,5,159,5,153,3,231,0,2,5,159,3,234,0,3,
+5,160,5,153,3,233,0,2,5,160,3,236,0,3,5,161,5,153,3,235,0,2,5,161,3,238,0,
+3,5,162,5,153,3,237,0,2,5,162,3,228,0,3,5,190,5,153,0,63,0,128,0,134,0,140,
+0,148,0,156,0,166,0,176,0,188,0,198,0,210,0,220,0,232,0,242,0,254,1,8,1,20,
+1,30,1,42,1,52,1,64,1,72,1,82,1,90,1,100,1,108,1,118,1,126,1,136,1,144,1,
+154,1,162,1,172,1,180,1,190,1,196,1,204,1,212,1,222,1,230,1,240,1,248,2,2,
+2,10,2,20,2,28,2,38,2,46,2,56,2,64,2,74,2,80,2,88,2,94,2,102,2,108,2,116,
+2,122,2,130,2,136,2,144,2,150,2,158,2,164,3,240,0,2,5,153,3,241,0,2,5,154,
+3,243,0,3,5,155,5,153,3,244,0,3,5,155,5,154,3,246,0,4,5,155,5,156,5,153,3,
+247,0,4,5,155,5,156,5,154,3,249,0,5,5,155,5,156,5,157,5,153,3,248,0,4,5,155,
+5,156,5,157,3,252,0,5,5,155,5,156,5,158,5,153,3,251,0,4,5,155,5,156,5,158,
+3,254,0,5,5,155,5,156,5,159,5,153,3,253,0,4,5,155,5,156,5,159,4,0,0,5,5,155,
+5,156,5,160,5,153,3,255,0,4,5,155,5,156,5,160,4,2,0,5,5,155,5,156,5,161,5,
+153,4,1,0,4,5,155,5,156,5,161,4,4,0,5,5,155,5,156,5,162,5,153,4,3,0,4,5,155,
+5,156,5,162,3,250,0,5,5,155,5,156,5,190,5,153,3,245,0,3,5,155,5,156,4,6,0,
+4,5,155,5,157,5,153,4,5,0,3,5,155,5,157,4,9,0,4,5,155,5,158,5,153,4,8,0,3,
+5,155,5,158,4,11,0,4,5,155,5,159,5,153,4,10,0,3,5,155,5,159,4,13,0,4,5,155,
+5,160,5,153,4,12,0,3,5,155,5,160,4,15,0,4,5,155,5,161,5,153,4,14,0,3,5,155,
+5,161,4,17,0,4,5,155,5,162,5,153,4,16,0,3,5,155,5,162,4,7,0,4,5,155,5,190,
+5,153,3,242,0,2,5,155,4,19,0,3,5,156,5,153,4,20,0,3,5,156,5,154,4,22,0,4,
+5,156,5,157,5,153,4,21,0,3,5,156,5,157,4,25,0,4,5,156,5,158,5,153,4,24,0,
+3,5,156,5,158,4,27,0,4,5,156,5,159,5,153,4,26,0,3,5,156,5,159,4,29,0,4,5,
+156,5,160,5,153,4,28,0,3,5,156,5,160,4,31,0,4,5,156,5,161,5,153,4,30,0,3,
+5,156,5,161,4,33,0,4,5,156,5,162,5,153,4,32,0,3,5,156,5,162,4,23,0,4,5,156,
+5,190,5,153,4,18,0,2,5,156,4,35,0,3,5,157,5,153,4,34,0,2,5,157,4,38,0,3,5,
+158,5,153,4,37,0,2,5,158,4,40,0,3,5,159,5,153,4,39,0,2,5,159,4,42,0,3,5,160,
+5,153,4,41,0,2,5,160,4,44,0,3,5,161,5,153,4,43,0,2,5,161,4,46,0,3,5,162,5,
+153,4,45,0,2,5,162,4,36,0,3,5,190,5,153,0,31,0,64,0,70,0,76,0,84,0,92,0,102,
+0,110,0,120,0,128,0,138,0,146,0,156,0,164,0,174,0,182,0,192,0,200,0,210,0,
+216,0,224,0,230,0,238,0,244,0,252,1,2,1,10,1,16,1,24,1,30,1,38,1,44,4,48,
+0,2,5,153,4,49,0,2,5,154,4,51,0,3,5,156,5,153,4,52,0,3,5,156,5,154,4,54,0,
+4,5,156,5,157,5,153,4,53,0,3,5,156,5,157,4,57,0,4,5,156,5,158,5,153,4,56,
+0,3,5,156,5,158,4,59,0,4,5,156,5,159,5,153,4,58,0,3,5,156,5,159,4,61,0,4,
+5,156,5,160,5,153,4,60,0,3,5,156,5,160,4,63,0,4,5,156,5,161,5,153,4,62,0,
+3,5,156,5,161,4,65,0,4,5,156,5,162,5,153,4,64,0,3,5,156,5,162,4,55,0,4,5,
+156,5,190,5,153,4,50,0,2,5,156,4,67,0,3,5,157,5,153,4,66,0,2,5,157,4,70,0,
+3,5,158,5,153,4,69,0,2,5,158,4,72,0,3,5,159,5,153,4,71,0,2,5,159,4,74,0,3,
+5,160,5,153,4,73,0,2,5,160,4,76,0,3,5,161,5,153,4,75,0,2,5,161,4,78,0,3,5,
+162,5,153,4,77,0,2,5,162,4,68,0,3,5,190,5,153,0,31,0,64,0,70,0,76,0,84,0,
+92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,164,0,174,0,182,0,192,0,200,
+0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,1,10,1,16,1,24,1,30,1,38,1,
+44,4,80,0,2,5,153,4,81,0,2,5,154,4,83,0,3,5,156,5,153,4,84,0,3,5,156,5,154,
+4,86,0,4,5,156,5,157,5,153,4,85,0,3,5,156,5,157,4,89,0,4,5,156,5,158,5,153,
+4,88,0,3,5,156,5,158,4,91,0,4,5,156,5,159,5,153,4,90,0,3,5,156,5,159,4,93,
+0,4,5,156,5,160,5,153,4,92,0,3,5,156,5,160,4,95,0,4,5,156,5,161,5,153,4,94,
+0,3,5,156,5,161,4,97,0,4,5,156,5,162,5,153,4,96,0,3,5,156,5,162,4,87,0,4,
+5,156,5,190,5,153,4,82,0,2,5,156,4,99,0,3,5,157,5,153,4,98,0,2,5,157,4,102,
+0,3,5,158,5,153,4,101,0,2,5,158,4,104,0,3,5,159,5,153,4,103,0,2,5,159,4,106,
+0,3,5,160,5,153,4,105,0,2,5,160,4,108,0,3,5,161,5,153,4,107,0,2,5,161,4,110,
+0,3,5,162,5,153,4,109,0,2,5,162,4,100,0,3,5,190,5,153,0,47,0,96,0,102,0,108,
+0,116,0,124,0,134,0,142,0,152,0,160,0,170,0,178,0,188,0,196,0,206,0,214,0,
+224,0,232,0,242,0,248,1,0,1,6,1,14,1,20,1,28,1,34,1,42,1,48,1,56,1,62,1,70,
+1,76,1,84,1,92,1,102,1,110,1,120,1,128,1,138,1,146,1,156,1,164,1,174,1,182,
+1,192,1,200,1,210,1,216,4,112,0,2,5,153,4,113,0,2,5,154,4,131,0,3,5,156,5,
+153,4,132,0,3,5,156,5,154,4,134,0,4,5,156,5,157,5,153,4,133,0,3,5,156,5,157,
+4,137,0,4,5,156,5,158,5,153,4,136,0,3,5,156,5,158,4,139,0,4,5,156,5,159,5,
+153,4,138,0,3,5,156,5,159,4,141,0,4,5,156,5,160,5,153,4,140,0,3,5,156,5,160,
+4,143,0,4,5,156,5,161,5,153,4,142,0,3,5,156,5,161,4,145,0,4,5,156,5,162,5,
+153,4,144,0,3,5,156,5,162,4,135,0,4,5,156,5,190,5,153,4,130,0,2,5,156,4,147,
+0,3,5,157,5,153,4,146,0,2,5,157,4,150,0,3,5,158,5,153,4,149,0,2,5,158,4,152,
+0,3,5,159,5,153,4,151,0,2,5,159,4,154,0,3,5,160,5,153,4,153,0,2,5,160,4,156,
+0,3,5,161,5,153,4,155,0,2,5,161,4,158,0,3,5,162,5,153,4,157,0,2,5,162,4,115,
+0,3,5,188,5,153,4,116,0,3,5,188,5,154,4,118,0,4,5,188,5,157,5,153,4,117,0,
+3,5,188,5,157,4,121,0,4,5,188,5,158,5,153,4,120,0,3,5,188,5,158,4,123,0,4,
+5,188,5,159,5,153,4,122,0,3,5,188,5,159,4,125,0,4,5,188,5,160,5,153,4,124,
+0,3,5,188,5,160,4,127,0,4,5,188,5,161,5,153,4,126,0,3,5,188,5,161,4,129,0,
+4,5,188,5,162,5,153,4,128,0,3,5,188,5,162,4,119,0,4,5,188,5,190,5,153,4,114,
+0,2,5,188,4,148,0,3,5,190,5,153,0,15,0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,
+80,0,86,0,94,0,100,0,108,0,114,0,122,0,128,4,160,0,2,5,153,4,161,0,2,5,154,
+4,163,0,3,5,157,5,153,4,162,0,2,5,157,4,166,0,3,5,158,5,153,4,165,0,2,5,158,
+4,168,0,3,5,159,5,153,4,167,0,2,5,159,4,170,0,3,5,160,5,153,4,169,0,2,5,160,
+4,172,0,3,5,161,5,153,4,171,0,2,5,161,4,174,0,3,5,162,5,153,4,173,0,2,5,162,
+4,164,0,3,5,190,5,153,0,31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,
+0,138,0,146,0,156,0,164,0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,
+238,0,244,0,252,1,2,1,10,1,16,1,24,1,30,1,38,1,44,4,176,0,2,5,153,4,177,0,
+2,5,154,4,179,0,3,5,156,5,153,4,180,0,3,5,156,5,154,4,182,0,4,5,156,5,157,
+5,153,4,181,0,3,5,156,5,157,4,185,0,4,5,156,5,158,5,153,4,184,0,3,5,156,5,
+158,4,187,0,4,5,156,5,159,5,153,4,186,0,3,5,156,5,159,4,189,0,4,5,156,5,160,
+5,153,4,188,0,3,5,156,5,160,4,191,0,4,5,156,5,161,5,153,4,190,0,3,5,156,5,
+161,4,193,0,4,5,156,5,162,5,153,4,192,0,3,5,156,5,162,4,183,0,4,5,156,5,190,
+5,153,4,178,0,2,5,156,4,195,0,3,5,157,5,153,4,194,0,2,5,157,4,198,0,3,5,158,
+5,153,4,197,0,2,5,158,4,200,0,3,5,159,5,153,4,199,0,2,5,159,4,202,0,3,5,160,
+5,153,4,201,0,2,5,160,4,204,0,3,5,161,5,153,4,203,0,2,5,161,4,206,0,3,5,162,
+5,153,4,205,0,2,5,162,4,196,0,3,5,190,5,153,0,31,0,64,0,70,0,76,0,84,0,92,
+0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,164,0,174,0,182,0,192,0,200,0,
+210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,1,10,1,16,1,24,1,30,1,38,1,44,
+4,208,0,2,5,153,4,209,0,2,5,154,4,211,0,3,5,156,5,153,4,212,0,3,5,156,5,154,
+4,214,0,4,5,156,5,157,5,153,4,213,0,3,5,156,5,157,4,217,0,4,5,156,5,158,5,
+153,4,216,0,3,5,156,5,158,4,219,0,4,5,156,5,159,5,153,4,218,0,3,5,156,5,159,
+4,221,0,4,5,156,5,160,5,153,4,220,0,3,5,156,5,160,4,223,0,4,5,156,5,161,5,
+153,4,222,0,3,5,156,5,161,4,225,0,4,5,156,5,162,5,153,4,224,0,3,5,156,5,162,
+4,215,0,4,5,156,5,190,5,153,4,210,0,2,5,156,4,227,0,3,5,157,5,153,4,226,0,
+2,5,157,4,230,0,3,5,158,5,153,4,229,0,2,5,158,4,232,0,3,5,159,5,153,4,231,
+0,2,5,159,4,234,0,3,5,160,5,153,4,233,0,2,5,160,4,236,0,3,5,161,5,153,4,235,
+0,2,5,161,4,238,0,3,5,162,5,153,4,237,0,2,5,162,4,228,0,3,5,190,5,153,0,31,
+0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,0,156,0,164,
+0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,252,1,2,1,10,
+1,16,1,24,1,30,1,38,1,44,4,240,0,2,5,153,4,241,0,2,5,154,4,243,0,3,5,156,
+5,153,4,244,0,3,5,156,5,154,4,246,0,4,5,156,5,157,5,153,4,245,0,3,5,156,5,
+157,4,249,0,4,5,156,5,158,5,153,4,248,0,3,5,156,5,158,4,251,0,4,5,156,5,159,
+5,153,4,250,0,3,5,156,5,159,4,253,0,4,5,156,5,160,5,153,4,252,0,3,5,156,5,
+160,4,255,0,4,5,156,5,161,5,153,4,254,0,3,5,156,5,161,5,1,0,4,5,156,5,162,
+5,153,5,0,0,3,5,156,5,162,4,247,0,4,5,156,5,190,5,153,4,242,0,2,5,156,5,3,
+0,3,5,157,5,153,5,2,0,2,5,157,5,6,0,3,5,158,5,153,5,5,0,2,5,158,5,8,0,3,5,
+159,5,153,5,7,0,2,5,159,5,10,0,3,5,160,5,153,5,9,0,2,5,160,5,12,0,3,5,161,
+5,153,5,11,0,2,5,161,5,14,0,3,5,162,5,153,5,13,0,2,5,162,5,4,0,3,5,190,5,
+153,0,15,0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,80,0,86,0,94,0,100,0,108,0,
+114,0,122,0,128,5,16,0,2,5,153,5,17,0,2,5,154,5,19,0,3,5,157,5,153,5,18,0,
+2,5,157,5,22,0,3,5,158,5,153,5,21,0,2,5,158,5,24,0,3,5,159,5,153,5,23,0,2,
+5,159,5,26,0,3,5,160,5,153,5,25,0,2,5,160,5,28,0,3,5,161,5,153,5,27,0,2,5,
+161,5,30,0,3,5,162,5,153,5,29,0,2,5,162,5,20,0,3,5,190,5,153,0,15,0,32,0,
+38,0,44,0,52,0,58,0,66,0,72,0,80,0,86,0,94,0,100,0,108,0,114,0,122,0,128,
+5,32,0,2,5,153,5,33,0,2,5,154,5,35,0,3,5,157,5,153,5,34,0,2,5,157,5,38,0,
+3,5,158,5,153,5,37,0,2,5,158,5,40,0,3,5,159,5,153,5,39,0,2,5,159,5,42,0,3,
+5,160,5,153,5,41,0,2,5,160,5,44,0,3,5,161,5,153,5,43,0,2,5,161,5,46,0,3,5,
+162,5,153,5,45,0,2,5,162,5,36,0,3,5,190,5,153,0,15,0,32,0,38,0,44,0,52,0,
+58,0,66,0,72,0,80,0,86,0,94,0,100,0,108,0,114,0,122,0,128,5,48,0,2,5,153,
+5,49,0,2,5,154,5,51,0,3,5,157,5,153,5,50,0,2,5,157,5,54,0,3,5,158,5,153,5,
+53,0,2,5,158,5,56,0,3,5,159,5,153,5,55,0,2,5,159,5,58,0,3,5,160,5,153,5,57,
+0,2,5,160,5,60,0,3,5,161,5,153,5,59,0,2,5,161,5,62,0,3,5,162,5,153,5,61,0,
+2,5,162,5,52,0,3,5,190,5,153,0,15,0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,80,
+0,86,0,94,0,100,0,108,0,114,0,122,0,128,5,64,0,2,5,153,5,65,0,2,5,154,5,67,
+0,3,5,157,5,153,5,66,0,2,5,157,5,70,0,3,5,158,5,153,5,69,0,2,5,158,5,72,0,
+3,5,159,5,153,5,71,0,2,5,159,5,74,0,3,5,160,5,153,5,73,0,2,5,160,5,76,0,3,
+5,161,5,153,5,75,0,2,5,161,5,78,0,3,5,162,5,153,5,77,0,2,5,162,5,68,0,3,5,
+190,5,153,0,31,0,64,0,70,0,76,0,84,0,92,0,102,0,110,0,120,0,128,0,138,0,146,
+0,156,0,164,0,174,0,182,0,192,0,200,0,210,0,216,0,224,0,230,0,238,0,244,0,
+252,1,2,1,10,1,16,1,24,1,30,1,38,1,44,5,80,0,2,5,153,5,81,0,2,5,154,5,83,
+0,3,5,156,5,153,5,84,0,3,5,156,5,154,5,86,0,4,5,156,5,157,5,153,5,85,0,3,
+5,156,5,157,5,89,0,4,5,156,5,158,5,153,5,88,0,3,5,156,5,158,5,91,0,4,5,156,
+5,159,5,153,5,90,0,3,5,156,5,159,5,93,0,4,5,156,5,160,5,153,5,92,0,3,5,156,
+5,160,5,95,0,4,5,156,5,161,5,153,5,94,0,3,5,156,5,161,5,97,0,4,5,156,5,162,
+5,153,5,96,0,3,5,156,5,162,5,87,0,4,5,156,5,190,5,153,5,82,0,2,5,156,5,99,
+0,3,5,157,5,153,5,98,0,2,5,157,5,102,0,3,5,158,5,153,5,101,0,2,5,158,5,104,
+0,3,5,159,5,153,5,103,0,2,5,159,5,106,0,3,5,160,5,153,5,105,0,2,5,160,5,108,
+0,3,5,161,5,153,5,107,0,2,5,161,5,110,0,3,5,162,5,153,5,109,0,2,5,162,5,100,
+0,3,5,190,5,153,0,15,0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,80,0,86,0,94,0,
+100,0,108,0,114,0,122,0,128,5,122,0,2,5,153,5,123,0,2,5,154,5,125,0,3,5,157,
+5,153,5,124,0,2,5,157,5,128,0,3,5,158,5,153,5,127,0,2,5,158,5,130,0,3,5,159,
+5,153,5,129,0,2,5,159,5,132,0,3,5,160,5,153,5,131,0,2,5,160,5,134,0,3,5,161,
+5,153,5,133,0,2,5,161,5,136,0,3,5,162,5,153,5,135,0,2,5,162,5,126,0,3,5,190,
+5,153,0,15,0,32,0,38,0,44,0,52,0,58,0,66,0,72,0,80,0,86,0,94,0,100,0,108,
+0,114,0,122,0,128,5,138,0,2,5,153,5,139,0,2,5,154,5,141,0,3,5,157,5,153,5,
+140,0,2,5,157,5,144,0,3,5,158,5,153,5,143,0,2,5,158,5,146,0,3,5,159,5,153,
+5,145,0,2,5,159,5,148,0,3,5,160,5,153,5,147,0,2,5,160,5,150,0,3,5,161,5,153,
+5,149,0,2,5,161,5,152,0,3,5,162,5,153,5,151,0,2,5,162,5,142,0,3,5,190,5,153,
+0,1,0,4,5,111,0,2,5,153,0,1,0,4,5,112,0,2,5,153,0,8,0,18,0,24,0,30,0,36,0,
+42,0,48,0,54,0,60,5,114,0,2,5,153,5,113,0,2,5,181,5,115,0,2,5,182,5,116,0,
+2,5,183,5,117,0,2,5,184,5,118,0,2,5,185,5,119,0,2,5,186,5,120,0,2,5,187,0,
+20,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,96,0,102,0,108,0,114,0,
+120,0,126,0,132,0,138,0,144,0,150,0,156,0,220,0,2,5,153,0,224,0,2,5,154,0,
+230,0,2,5,155,0,231,0,2,5,156,0,232,0,2,5,157,0,234,0,2,5,158,0,235,0,2,5,
+159,0,236,0,2,5,160,0,237,0,2,5,161,0,238,0,2,5,162,0,219,0,2,5,181,0,221,
+0,2,5,182,0,222,0,2,5,183,0,223,0,2,5,184,0,225,0,2,5,185,0,226,0,2,5,186,
+0,227,0,2,5,187,0,228,0,2,5,188,0,229,0,2,5,189,0,233,0,2,5,190,0,1,0,4,0,
+164,0,2,5,189,0,1,0,4,0,165,0,2,5,189,0,1,0,4,0,166,0,2,5,189,0,1,0,4,0,167,
+0,2,5,189,0,1,0,4,0,168,0,2,5,189,0,1,0,4,0,169,0,2,5,189,0,1,0,4,0,170,0,
+2,5,189,0,1,0,50,0,4,0,36,0,100,0,132,0,148,0,171,0,203,0,239,1,15,1,79,1,
+111,1,191,1,223,2,47,2,79,2,111,2,191,2,239,3,15,3,47,3,111,3,143,3,159,3,
+223,3,239,4,47,4,79,4,111,4,159,4,175,4,207,4,239,5,15,5,31,5,47,5,63,5,79,
+5,121,5,137,5,158,5,159,5,160,5,180,5,181,5,182,5,183,5,184,5,185,5,186,5,
+187,};
+#endif
@@ -0,0 +1,493 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansLimbu_Regular_ttf_size = 11820;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansLimbu_Regular_ttf");
+asm(".type fz_font_NotoSansLimbu_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansLimbu_Regular_ttf, 11820");
+asm(".balign 64");
+asm("fz_font_NotoSansLimbu_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansLimbu-Regular.ttf\"");
+#else
+const int fz_font_NotoSansLimbu_Regular_ttf_size = 11820;
+const char fz_font_NotoSansLimbu_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,2,123,2,90,0,0,41,200,0,0,0,96,71,
+80,79,83,65,188,57,64,0,0,42,40,0,0,3,172,71,83,85,66,168,105,186,77,0,0,
+45,212,0,0,0,88,79,83,47,50,123,3,138,0,0,0,1,104,0,0,0,96,99,109,97,112,
+77,29,59,248,0,0,2,236,0,0,0,124,103,97,115,112,0,7,0,7,0,0,41,188,0,0,0,
+12,103,108,121,102,68,144,226,117,0,0,3,252,0,0,28,218,104,101,97,100,0,178,
+203,63,0,0,0,236,0,0,0,54,104,104,101,97,10,244,3,243,0,0,1,36,0,0,0,36,104,
+109,116,120,11,3,226,37,0,0,1,200,0,0,1,36,108,111,99,97,10,254,17,179,0,
+0,3,104,0,0,0,148,109,97,120,112,0,80,0,86,0,0,1,72,0,0,0,32,110,97,109,101,
+139,82,184,19,0,0,32,216,0,0,5,250,112,111,115,116,238,226,127,232,0,0,38,
+212,0,0,2,231,0,1,0,0,0,1,12,205,61,58,234,247,95,15,60,245,0,11,8,0,0,0,
+0,0,204,193,130,252,0,0,0,0,210,109,241,209,251,54,253,168,7,46,6,255,0,0,
+0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,7,106,251,54,254,151,7,46,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,1,0,0,0,73,0,85,0,6,0,0,0,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,78,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,
+154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,32,
+0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,0,
+0,0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,
+0,5,101,0,10,4,215,0,80,5,155,0,80,4,194,0,50,4,209,0,50,7,106,0,80,5,5,0,
+50,5,15,0,80,5,103,0,50,4,171,0,80,6,56,0,80,4,109,0,60,5,136,0,80,5,0,0,
+40,5,112,0,50,4,215,0,80,5,250,0,80,6,124,0,80,4,236,0,60,5,154,0,60,5,45,
+0,50,4,212,0,80,5,1,0,60,5,63,0,50,5,73,0,0,5,22,0,150,4,43,0,80,5,13,0,80,
+5,69,0,80,0,0,251,248,0,0,253,60,0,0,251,54,2,74,0,10,4,125,0,10,2,74,252,
+22,4,125,252,22,0,0,252,28,0,0,251,217,2,222,255,57,0,0,254,241,3,71,255,
+137,4,96,0,40,2,29,0,0,0,0,253,137,2,41,255,6,3,208,255,184,4,29,255,176,
+4,6,255,176,0,227,255,56,2,151,0,0,0,227,255,56,0,0,253,182,0,0,251,118,4,
+102,0,80,3,133,0,120,3,216,0,120,4,101,0,80,3,254,0,130,3,250,0,40,3,176,
+0,80,4,0,0,40,3,229,0,80,3,240,0,80,3,240,0,80,3,250,0,40,3,240,0,60,2,252,
+1,44,4,80,1,44,0,0,253,211,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,112,0,0,0,24,0,
+16,0,3,0,8,0,0,0,13,0,32,0,160,9,101,25,28,25,43,25,59,25,64,25,79,254,255,
+255,255,0,0,0,0,0,13,0,32,0,160,9,100,25,0,25,32,25,48,25,64,25,68,254,255,
+255,255,0,1,255,245,255,227,255,99,246,226,231,4,231,1,230,253,230,249,230,
+246,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,
+0,21,0,21,0,72,0,104,0,171,0,243,1,24,1,115,1,180,1,238,2,58,2,128,2,210,
+3,13,3,80,3,147,3,222,4,3,4,71,4,157,4,228,5,49,5,85,5,162,5,196,5,250,6,
+34,6,73,6,125,6,176,6,237,7,23,7,65,7,113,7,160,7,250,8,77,8,203,8,219,8,
+252,9,44,9,74,9,128,9,166,9,203,9,241,10,8,10,66,10,107,10,170,10,185,10,
+218,10,232,11,15,11,28,11,90,11,145,11,209,11,254,12,49,12,79,12,141,12,186,
+13,15,13,82,13,161,13,192,13,235,13,249,14,14,14,109,0,2,0,193,0,0,4,10,5,
+182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,
+5,182,250,74,104,4,230,0,0,2,0,10,255,247,4,207,4,156,0,10,0,25,0,0,1,33,
+1,33,1,54,54,51,50,22,23,23,7,38,38,35,34,4,7,39,1,33,1,33,55,33,4,43,254,
+101,254,174,1,145,254,76,84,219,103,107,204,67,164,154,66,192,149,124,254,
+219,224,19,1,223,254,120,1,168,254,41,50,4,107,4,8,254,142,254,34,45,47,49,
+44,113,70,66,62,60,77,40,2,12,1,221,148,0,0,1,0,80,0,0,4,135,4,156,0,13,0,
+0,1,7,6,0,7,33,7,33,55,18,0,55,33,55,4,130,15,207,254,49,146,3,68,50,252,
+3,35,201,1,112,233,252,179,50,4,156,70,195,253,223,222,148,147,1,14,1,148,
+211,148,0,0,2,0,80,255,241,5,95,4,156,0,27,0,40,0,0,37,14,2,35,34,38,39,6,
+6,35,34,2,53,16,1,33,7,14,2,21,20,22,51,50,54,55,1,16,33,50,55,38,53,52,18,
+55,33,6,2,5,95,61,73,86,55,86,127,34,87,200,101,176,209,1,76,3,134,50,110,
+106,58,94,91,54,66,35,251,198,1,12,181,133,8,180,153,253,34,78,95,168,82,
+64,37,111,94,102,103,1,1,230,1,115,1,81,148,112,174,204,126,136,147,40,40,
+1,45,254,131,148,52,55,155,1,95,138,102,254,236,0,0,2,0,50,255,241,4,114,
+4,156,0,33,0,45,0,0,1,33,55,33,7,3,55,50,23,54,54,55,51,6,6,7,22,22,21,20,
+6,6,35,34,38,53,52,54,55,38,35,34,7,55,1,52,38,39,6,6,21,20,22,51,50,54,1,
+114,254,192,50,1,176,18,215,19,165,129,163,180,59,124,58,187,156,135,148,
+97,180,122,183,187,84,123,90,118,60,52,12,2,190,135,126,127,81,121,102,114,
+132,4,8,148,65,254,130,1,25,145,215,111,124,240,139,46,173,121,99,160,93,
+142,133,66,138,112,10,10,63,254,210,78,110,29,107,111,49,69,85,109,0,2,0,
+50,255,246,4,59,4,156,0,10,0,19,0,0,19,55,33,17,7,17,6,35,32,17,17,33,33,
+17,20,22,22,51,50,55,50,50,3,215,164,179,211,254,195,2,195,253,225,47,81,
+89,199,127,4,8,148,251,140,50,2,15,185,1,120,1,68,254,230,102,115,53,147,
+0,0,3,0,80,255,241,7,46,4,171,0,34,0,46,0,58,0,0,1,7,1,50,4,21,20,6,6,35,
+34,36,2,17,52,55,23,6,6,21,20,18,4,51,32,17,52,38,35,7,7,55,1,33,55,5,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,4,252,15,
+254,147,219,1,31,127,246,169,221,254,152,199,15,99,7,5,169,1,52,173,1,146,
+207,204,40,65,10,1,64,253,67,50,3,182,144,112,105,130,131,109,107,144,130,
+72,58,62,65,72,52,64,69,4,156,70,254,165,181,160,131,198,108,231,1,157,1,
+1,121,81,30,35,59,68,222,254,169,198,1,33,118,124,3,3,68,1,50,148,232,107,
+140,126,107,115,143,140,109,57,69,79,67,61,63,75,0,3,0,50,255,246,4,111,4,
+166,0,24,0,28,0,40,0,0,19,51,32,0,21,20,2,6,35,34,38,53,52,54,51,50,22,21,
+7,54,54,53,16,33,35,1,17,55,17,1,20,22,51,50,54,53,52,38,35,34,6,100,106,
+1,13,1,57,135,232,137,94,130,140,94,97,125,4,51,57,254,82,140,3,153,164,252,
+96,53,50,40,59,60,42,44,56,4,156,254,247,236,153,254,237,164,127,98,92,134,
+120,92,42,50,163,128,1,151,251,238,4,126,50,251,130,1,32,48,56,57,46,50,54,
+62,0,1,0,80,255,241,4,211,4,156,0,35,0,0,1,6,7,33,7,7,33,7,33,55,55,33,6,
+21,20,22,51,50,54,55,23,14,2,35,34,38,38,53,52,18,55,33,55,33,7,2,137,196,
+102,2,14,5,162,1,33,85,254,100,5,162,254,119,24,196,179,175,255,121,57,60,
+208,222,115,172,247,131,204,187,254,121,50,4,76,50,4,8,102,140,41,208,148,
+41,208,74,88,165,182,105,113,52,85,152,77,119,218,141,166,1,45,102,148,148,
+0,2,0,50,255,246,4,209,4,156,0,5,0,51,0,0,5,17,33,55,33,17,1,33,50,30,2,21,
+20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,7,22,22,51,50,62,2,53,
+52,46,2,35,33,4,45,252,5,50,4,109,251,197,1,10,161,202,114,42,66,109,140,
+73,53,92,69,39,26,42,54,28,29,51,37,22,20,31,38,17,10,25,31,66,87,51,20,42,
+96,155,113,254,251,10,4,18,148,251,140,3,81,55,92,122,67,93,137,90,44,34,
+61,85,51,37,61,42,23,21,37,51,30,32,46,32,19,4,9,15,43,68,81,39,68,87,49,
+19,0,0,1,0,80,254,192,4,91,4,156,0,45,0,0,1,33,34,6,21,20,22,51,50,54,55,
+23,6,6,35,34,39,6,21,20,33,50,55,23,6,0,7,39,54,36,55,6,35,34,38,53,52,54,
+55,38,53,52,54,54,51,33,3,176,254,131,152,163,156,127,114,218,62,50,104,252,
+121,45,63,142,1,117,254,175,65,107,254,82,212,41,111,1,26,90,129,122,238,
+239,100,87,187,142,235,132,1,149,4,8,102,99,78,99,39,30,66,62,72,5,73,124,
+198,99,65,160,254,238,53,80,37,152,72,36,149,155,70,139,55,60,187,89,181,
+110,0,2,0,80,255,241,5,232,4,156,0,39,0,52,0,0,1,6,7,22,23,7,38,39,6,7,39,
+54,55,38,39,21,20,6,6,35,34,38,53,52,54,54,51,50,23,53,33,55,33,7,33,17,22,
+23,54,55,1,50,54,54,53,53,38,35,34,6,21,20,22,5,220,28,122,96,66,93,64,82,
+110,130,66,117,112,140,156,109,204,142,158,207,128,244,151,67,66,253,127,
+50,4,121,50,254,172,196,167,77,25,252,98,88,135,74,78,77,190,209,137,2,165,
+160,176,135,155,56,131,112,136,107,65,100,175,159,81,100,142,223,125,201,
+157,138,208,118,15,240,148,148,254,216,94,190,150,126,253,173,73,139,99,195,
+20,160,140,107,119,0,0,1,0,60,255,241,4,29,4,171,0,39,0,0,19,54,33,50,22,
+21,20,7,22,21,20,6,6,35,34,36,39,55,22,22,51,50,54,54,53,52,38,35,35,55,51,
+50,23,54,53,52,38,35,34,7,83,189,1,26,194,221,130,214,139,245,142,130,254,
+253,78,65,67,225,112,98,167,91,182,224,141,50,146,101,78,84,138,123,248,152,
+3,197,230,157,137,136,88,86,202,114,184,106,96,77,76,70,81,68,122,81,120,
+103,148,14,66,107,80,83,137,0,0,2,0,80,255,241,5,76,4,156,0,29,0,41,0,0,37,
+54,54,53,52,38,38,39,21,20,6,6,35,34,38,53,52,36,37,17,33,55,33,17,22,22,
+21,20,6,7,1,20,22,22,51,50,54,54,53,53,4,4,4,13,108,109,87,161,106,109,204,
+142,160,205,1,95,1,49,253,127,50,2,243,223,233,146,138,252,134,61,116,80,
+88,135,74,254,241,254,229,74,30,143,101,67,124,74,11,149,142,223,125,189,
+155,196,238,13,1,0,148,254,104,19,210,180,137,193,48,1,88,54,91,51,73,139,
+99,184,10,157,0,1,0,40,255,241,4,176,4,166,0,42,0,0,1,19,36,39,53,22,4,51,
+50,36,55,21,6,4,35,35,7,54,54,51,50,22,21,20,4,35,34,38,38,39,55,22,22,51,
+50,54,53,52,38,38,35,34,7,1,201,31,254,208,144,102,1,36,173,196,1,55,84,75,
+254,190,194,16,18,25,101,38,216,247,254,212,250,114,223,210,58,57,121,254,
+176,182,193,76,142,101,148,85,2,142,1,10,21,101,148,61,64,66,59,148,59,66,
+174,8,14,191,171,186,232,76,155,83,52,112,106,148,139,72,112,63,33,0,0,1,
+0,50,255,241,5,32,4,156,0,47,0,0,1,6,6,21,20,22,51,50,54,55,23,6,6,7,6,21,
+20,22,51,50,54,54,55,54,18,55,23,6,6,7,2,0,33,34,38,53,52,54,55,38,38,53,
+52,55,35,55,33,7,1,115,39,34,107,96,67,126,38,34,71,163,69,165,127,125,144,
+173,73,19,22,132,135,64,88,95,12,33,254,197,254,244,163,208,109,93,88,114,
+128,208,50,2,218,50,4,8,41,76,54,69,84,20,16,59,54,61,8,97,130,98,104,84,
+171,176,204,1,7,149,56,99,225,142,254,173,254,178,169,136,70,152,60,23,124,
+80,114,119,148,148,0,1,0,80,0,0,4,135,4,156,0,17,0,0,1,7,6,7,33,7,33,6,7,
+33,7,33,55,18,0,55,33,55,4,130,15,202,209,1,110,50,254,106,193,122,3,68,50,
+252,3,35,201,1,112,233,252,179,50,4,156,70,190,245,107,235,185,148,147,1,
+14,1,148,211,148,0,0,1,0,80,255,241,5,170,4,171,0,44,0,0,1,22,18,21,20,2,
+6,35,34,38,39,6,35,34,2,53,52,18,55,23,14,2,21,20,22,22,51,50,55,38,53,53,
+55,21,20,22,22,51,50,54,53,52,2,39,4,88,161,177,130,202,101,91,153,48,124,
+152,168,201,214,172,43,73,119,69,58,106,67,118,83,16,164,58,90,59,121,126,
+134,132,4,171,75,254,187,221,148,254,232,161,71,72,143,1,21,239,201,1,123,
+109,59,52,183,233,129,127,181,93,93,58,67,109,50,131,84,106,56,187,180,228,
+1,10,69,0,0,2,0,80,255,241,6,44,4,171,0,41,0,56,0,0,37,50,54,54,55,46,2,35,
+34,7,39,54,54,51,50,22,23,54,54,51,50,18,17,20,2,6,35,34,38,38,39,6,6,35,
+34,2,39,23,30,2,1,23,30,2,51,50,54,53,52,38,38,35,34,6,1,185,55,87,78,75,
+56,79,103,74,155,36,114,43,214,123,112,164,61,77,188,119,176,184,121,189,
+104,91,137,102,49,79,176,114,159,177,2,170,9,42,78,1,249,18,57,80,101,69,
+102,101,61,106,67,89,139,141,84,149,218,213,164,88,216,30,142,182,162,178,
+174,166,254,229,254,236,153,254,198,184,88,166,164,229,189,1,7,228,24,122,
+123,66,2,42,67,216,182,97,211,231,152,210,110,161,0,2,0,60,255,241,4,156,
+4,156,0,33,0,45,0,0,1,33,6,2,21,20,22,22,51,50,55,38,38,53,52,54,51,50,22,
+21,20,6,4,35,32,0,53,52,54,54,55,33,55,33,1,20,22,51,50,54,53,52,38,35,34,
+6,4,67,254,93,212,232,94,190,112,157,112,76,95,128,96,94,140,142,254,246,
+145,254,244,254,213,110,195,124,254,83,50,4,7,254,200,57,50,43,54,54,46,45,
+59,4,8,74,254,228,187,102,158,94,52,19,135,78,92,121,133,94,114,189,115,1,
+3,235,111,209,175,58,148,253,15,50,62,58,46,42,62,56,0,2,0,60,255,246,5,4,
+4,169,0,32,0,51,0,0,5,17,6,6,35,34,39,6,35,34,38,53,52,18,54,51,50,22,21,
+20,6,7,6,21,20,22,51,50,54,55,17,55,17,1,50,55,38,53,52,54,55,54,54,53,52,
+38,35,34,6,21,20,22,4,96,80,153,84,116,81,83,110,169,184,148,243,119,140,
+158,53,54,107,99,83,71,149,64,164,252,186,35,30,25,54,53,54,53,92,82,147,
+181,128,10,1,174,88,76,50,50,194,173,136,1,7,171,118,115,39,97,66,130,75,
+70,79,68,61,2,95,50,251,130,1,108,6,53,67,41,95,60,60,96,41,57,63,200,157,
+140,142,0,0,2,0,50,0,0,4,151,4,156,0,9,0,15,0,0,19,55,33,17,7,38,36,33,39,
+1,1,17,35,1,22,4,52,50,4,49,154,208,254,43,254,237,19,2,191,1,2,97,253,153,
+189,1,121,4,8,148,251,170,70,164,150,64,2,142,252,155,3,101,253,199,15,157,
+0,2,0,80,255,241,4,132,4,156,0,37,0,49,0,0,1,50,22,22,21,20,6,7,22,23,7,38,
+39,6,35,34,38,53,52,54,51,50,22,23,23,54,53,52,38,38,35,7,55,37,33,55,33,
+7,1,50,55,39,38,38,35,34,6,21,20,22,2,168,117,200,113,78,73,104,93,38,116,
+125,158,211,191,237,155,112,95,188,107,115,90,78,148,109,121,10,1,4,253,117,
+50,3,61,15,254,73,126,91,111,93,148,65,68,80,193,3,66,88,155,95,90,176,72,
+69,19,85,34,72,106,160,133,109,140,90,96,100,90,148,77,119,68,6,60,235,148,
+70,252,47,40,77,65,64,56,45,66,79,0,1,0,60,255,246,4,177,4,156,0,14,0,0,1,
+2,7,7,54,0,1,33,55,33,7,6,7,1,7,2,102,225,103,218,113,1,183,1,59,252,149,
+50,4,30,15,250,211,2,1,119,2,34,254,231,225,50,239,2,20,1,15,148,70,223,250,
+253,151,30,0,1,0,50,255,246,4,169,4,171,0,33,0,0,37,7,17,6,6,35,34,38,39,
+7,20,22,51,50,54,55,23,6,6,35,34,38,38,53,52,55,55,22,22,51,50,36,55,23,4,
+169,164,95,246,93,105,170,98,4,176,165,105,201,61,46,95,255,114,130,211,117,
+35,131,71,198,110,160,1,61,100,21,40,50,4,19,56,80,47,66,70,168,183,59,46,
+60,87,106,112,204,141,117,87,88,69,76,85,65,5,0,0,1,0,0,255,246,4,179,4,166,
+0,21,0,0,1,17,20,22,51,50,55,17,55,17,7,17,6,6,35,34,38,53,17,1,39,1,2,27,
+107,97,170,125,165,165,50,201,94,158,164,254,175,34,1,115,4,166,254,8,107,
+114,87,2,76,50,251,130,50,1,220,36,63,155,143,1,19,253,151,124,2,181,0,1,
+0,150,255,241,4,228,4,166,0,22,0,0,1,33,17,20,2,6,35,34,38,53,17,55,17,20,
+22,51,50,54,54,53,17,55,33,4,178,254,237,100,179,123,181,194,164,102,109,
+88,99,51,50,1,183,4,8,254,37,184,254,254,130,238,224,2,181,50,253,12,178,
+173,80,171,138,2,48,148,0,2,0,80,255,246,3,149,4,171,0,17,0,32,0,0,5,17,6,
+6,35,34,38,38,53,52,62,2,51,50,23,55,17,1,50,54,53,53,7,46,2,35,34,6,21,20,
+22,2,241,60,168,103,97,157,88,75,141,175,62,127,108,149,254,65,132,150,1,
+45,73,98,66,104,117,118,10,2,58,106,108,88,165,112,86,166,141,91,69,64,251,
+130,1,198,164,147,110,3,54,50,31,153,142,121,137,0,0,2,0,80,255,246,4,119,
+4,156,0,18,0,32,0,0,1,17,7,17,35,22,21,20,6,6,35,34,38,38,53,52,54,54,51,
+23,35,34,6,21,20,22,22,51,50,54,53,52,38,4,119,164,206,37,100,181,114,99,
+152,84,120,179,88,133,188,76,88,49,87,50,107,117,33,4,156,251,140,50,4,18,
+51,130,135,233,137,82,157,115,103,233,144,148,155,139,76,107,61,160,146,62,
+141,0,0,1,0,80,255,241,5,9,4,156,0,34,0,0,1,38,33,7,55,1,33,14,2,21,20,22,
+51,50,54,55,23,14,2,35,32,0,17,52,18,36,55,33,7,1,50,4,23,4,97,155,254,212,
+121,22,1,139,254,86,73,133,78,237,202,171,247,123,57,62,201,219,113,254,225,
+254,185,163,1,23,166,1,246,15,254,88,103,1,14,70,1,211,103,6,108,1,104,16,
+132,200,117,198,236,104,114,52,87,152,75,1,43,1,9,145,1,23,183,24,70,254,
+111,57,38,0,0,2,251,248,5,60,255,176,6,255,0,13,0,25,0,0,1,52,54,51,50,22,
+21,20,7,33,7,33,34,38,55,20,22,51,50,54,53,52,38,35,34,6,251,248,139,95,97,
+125,19,2,3,50,253,90,94,130,147,53,50,45,54,59,49,38,56,6,28,94,133,115,92,
+58,48,138,130,118,50,60,58,50,44,55,57,0,0,1,253,60,4,8,1,77,6,181,0,26,0,
+0,1,38,53,52,54,51,50,22,21,20,6,7,51,7,33,54,53,52,46,2,35,34,6,21,20,23,
+253,109,49,223,203,201,226,25,17,230,50,254,159,113,43,77,117,88,156,168,
+48,4,235,71,85,143,159,166,151,67,124,29,148,204,145,59,66,41,22,81,77,70,
+54,0,0,2,251,54,254,8,255,96,0,10,0,17,0,29,0,0,39,6,0,35,34,38,53,52,54,
+51,50,22,21,20,7,54,36,55,1,52,38,35,34,6,21,20,22,51,50,54,160,139,254,114,
+220,148,161,107,82,74,104,13,184,1,68,124,253,42,45,32,31,45,45,31,32,45,
+10,243,254,241,115,102,79,108,105,74,40,37,15,183,158,254,228,32,45,45,32,
+31,45,45,0,2,0,10,255,241,2,24,4,171,0,16,0,28,0,0,19,52,54,51,50,22,21,16,
+1,39,54,18,55,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,27,132,98,134,
+145,254,46,60,147,171,13,40,54,92,128,107,67,51,51,68,71,48,48,70,3,195,100,
+132,169,159,254,176,253,222,35,194,1,127,163,16,130,95,50,68,70,48,49,70,
+69,0,4,0,10,255,241,4,75,4,171,0,16,0,28,0,46,0,58,0,0,19,52,54,51,50,22,
+21,16,1,39,54,18,55,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,
+51,50,22,21,20,0,5,39,54,0,55,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,
+6,27,132,98,134,145,254,46,60,157,163,11,40,54,93,127,102,67,51,52,69,63,
+55,51,70,1,205,132,98,134,145,254,173,254,156,49,247,1,35,11,40,54,93,127,
+102,67,51,52,69,63,55,51,70,3,195,100,132,169,159,254,176,253,222,35,208,
+1,121,150,16,128,99,55,74,71,56,56,77,75,59,100,132,169,159,200,254,78,247,
+50,200,1,127,136,16,128,99,55,74,71,56,56,77,75,0,4,252,22,255,241,2,24,6,
+255,0,16,0,28,0,42,0,54,0,0,19,52,54,51,50,22,21,16,1,39,54,18,55,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,1,52,54,51,50,22,21,20,7,33,7,33,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,27,132,98,134,145,254,46,60,157,163,
+11,40,54,93,127,102,67,51,52,69,63,55,51,70,251,149,139,95,97,125,19,2,3,
+50,253,90,94,130,147,53,50,45,54,59,49,38,56,3,195,100,132,169,159,254,176,
+253,222,35,208,1,121,150,16,128,99,55,74,71,56,56,77,75,2,30,94,133,115,92,
+58,48,138,130,118,50,60,58,50,44,55,57,0,0,6,252,22,255,241,4,75,6,255,0,
+16,0,28,0,46,0,58,0,72,0,84,0,0,19,52,54,51,50,22,21,16,1,39,54,18,55,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,0,5,39,54,
+0,55,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,52,54,51,50,22,21,20,
+7,33,7,33,34,38,55,20,22,51,50,54,53,52,38,35,34,6,27,132,98,134,145,254,
+46,60,157,163,11,40,54,93,127,102,67,51,52,69,63,55,51,70,1,205,132,98,134,
+145,254,173,254,156,49,247,1,35,11,40,54,93,127,102,67,51,52,69,63,55,51,
+70,249,98,139,95,97,125,19,2,3,50,253,90,94,130,147,53,50,45,54,59,49,38,
+56,3,195,100,132,169,159,254,176,253,222,35,208,1,121,150,16,128,99,55,74,
+71,56,56,77,75,59,100,132,169,159,200,254,78,247,50,200,1,127,136,16,128,
+99,55,74,71,56,56,77,75,2,30,94,133,115,92,58,48,138,130,118,50,60,58,50,
+44,55,57,0,0,1,252,28,5,50,254,195,6,248,0,3,0,0,1,1,55,1,254,126,253,158,
+56,2,111,5,50,1,99,99,254,177,0,1,251,217,5,60,255,188,6,243,0,17,0,0,1,52,
+38,35,34,7,39,54,51,50,22,23,36,55,23,6,7,7,253,15,82,76,81,43,28,71,85,111,
+148,28,1,33,226,37,205,241,91,5,60,153,173,38,87,49,142,126,181,102,66,110,
+192,71,0,1,255,57,255,181,2,172,1,158,0,29,0,0,39,54,54,51,50,23,22,22,51,
+50,54,55,54,54,55,23,6,6,7,6,6,35,34,39,38,38,35,34,7,7,199,72,209,63,61,
+29,15,31,24,35,68,58,52,101,55,10,41,76,73,57,112,65,111,31,19,28,26,37,98,
+48,84,87,143,120,67,54,63,90,81,94,13,77,19,94,120,92,87,121,74,46,98,47,
+0,1,254,241,254,99,1,92,0,66,0,13,0,0,1,7,38,38,39,6,6,7,39,54,19,23,22,22,
+1,92,80,85,143,35,50,133,32,61,90,254,40,15,129,254,243,144,26,152,108,61,
+142,31,63,87,1,21,19,110,173,0,0,1,255,137,255,246,2,227,2,143,0,36,0,0,37,
+7,6,35,34,38,53,52,62,2,53,52,35,34,6,7,39,54,54,51,50,21,20,14,2,21,20,22,
+51,50,55,17,55,17,7,2,62,65,134,113,70,90,35,42,35,56,25,135,56,61,65,212,
+68,133,35,42,35,24,28,136,139,165,165,175,36,74,66,55,29,72,73,66,23,58,92,
+53,63,79,138,129,36,83,79,69,22,30,21,86,1,90,50,253,153,50,0,1,0,40,1,183,
+3,252,4,156,0,22,0,0,1,6,6,21,20,22,51,50,54,55,23,6,35,34,38,53,52,54,55,
+35,55,33,7,1,165,97,80,141,140,110,216,80,40,244,228,186,237,109,96,241,50,
+3,162,50,4,8,57,120,55,103,110,53,41,51,191,169,151,78,142,53,148,148,0,2,
+0,0,255,241,1,235,1,220,0,11,0,23,0,0,53,52,54,51,50,22,21,20,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,144,112,105,130,138,109,105,139,134,72,
+58,56,63,69,57,59,64,229,107,140,126,107,110,148,136,117,57,69,76,61,56,69,
+75,0,0,2,253,137,253,177,255,116,255,156,0,11,0,23,0,0,1,52,54,51,50,22,21,
+20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,253,137,144,112,105,130,
+138,109,105,139,134,72,58,54,65,72,52,59,66,254,165,107,140,126,107,110,148,
+136,117,57,69,75,63,61,63,75,0,1,255,6,254,164,1,247,255,241,0,10,0,0,3,18,
+51,50,22,23,7,38,35,34,7,250,197,246,98,160,52,129,64,168,204,140,254,214,
+1,27,85,86,132,155,185,0,0,2,255,184,1,171,3,158,4,171,0,26,0,38,0,0,3,30,
+5,23,38,53,52,54,51,50,22,21,20,6,35,34,46,2,39,38,38,39,1,20,22,51,50,54,
+53,52,38,35,34,6,19,28,38,40,55,91,139,104,43,140,116,102,135,201,164,123,
+188,138,103,38,12,18,13,2,95,75,54,53,77,76,54,55,74,4,171,44,121,131,131,
+108,75,10,68,83,100,127,132,105,134,155,61,112,186,168,50,75,16,254,142,54,
+75,73,56,54,76,77,0,1,255,176,255,246,3,135,4,166,0,25,0,0,19,50,22,22,21,
+21,20,22,51,50,55,17,55,17,7,17,6,6,35,32,17,53,52,35,35,55,16,95,103,45,
+93,91,170,125,165,165,50,201,94,254,210,91,80,50,4,156,62,139,145,148,115,
+106,87,2,76,50,251,130,50,1,220,36,63,1,42,209,158,148,0,2,255,176,255,246,
+3,162,4,172,0,31,0,41,0,0,19,50,22,22,21,21,20,22,23,53,52,54,54,51,50,22,
+21,20,6,6,7,17,7,17,38,38,53,53,52,35,35,55,1,54,54,53,52,38,35,34,6,21,16,
+65,75,33,99,113,90,150,75,104,110,95,165,105,164,171,139,91,80,50,2,83,95,
+102,56,45,46,50,4,156,55,114,121,38,81,81,9,89,110,198,118,141,127,106,164,
+106,17,254,17,50,2,30,14,155,154,47,130,148,254,14,18,120,98,55,75,89,76,
+0,0,1,255,56,254,30,0,227,0,20,0,3,0,0,19,7,1,55,227,87,254,172,124,254,97,
+67,1,150,96,0,0,1,0,0,2,4,2,101,4,166,0,18,0,0,1,20,6,6,35,34,38,53,17,55,
+17,20,22,51,50,54,53,17,55,2,101,92,158,88,140,135,164,54,75,82,74,164,3,
+161,112,191,110,131,136,1,101,50,254,171,123,112,113,120,1,37,50,0,0,1,255,
+56,254,30,0,227,0,20,0,3,0,0,55,23,1,39,103,124,254,172,87,20,96,254,106,
+67,0,2,253,182,5,220,0,0,6,186,0,11,0,23,0,0,1,52,54,51,50,22,21,20,6,35,
+34,38,37,52,54,51,50,22,21,20,6,35,34,38,253,182,66,45,45,66,66,45,45,66,
+1,108,66,45,45,66,66,45,45,66,6,75,45,66,66,45,45,66,66,45,45,66,66,45,45,
+66,66,0,0,1,251,118,254,209,255,156,255,81,0,3,0,0,5,33,21,33,251,118,4,38,
+251,218,175,128,0,2,0,80,255,241,4,22,4,171,0,28,0,39,0,0,1,6,2,21,20,22,
+22,51,50,55,38,53,52,54,51,50,22,22,21,20,4,35,34,38,38,53,52,18,55,19,20,
+22,23,54,53,52,38,35,34,6,2,88,177,175,81,140,89,48,46,114,144,111,77,113,
+63,254,234,220,135,215,118,249,225,103,74,54,93,58,49,52,62,4,113,124,254,
+205,193,123,169,88,4,95,118,111,151,69,117,66,163,212,124,225,150,192,1,115,
+148,252,179,56,89,29,55,128,48,57,64,0,0,2,0,120,254,179,2,229,5,60,0,11,
+0,35,0,0,5,52,54,51,50,22,21,20,6,35,34,38,19,17,52,38,38,35,34,6,6,21,20,
+22,23,7,38,53,52,54,54,51,50,22,21,17,2,24,60,43,42,60,59,43,43,60,21,41,
+84,65,34,65,41,21,39,60,107,63,116,77,168,177,216,48,68,68,48,48,69,69,1,
+8,3,85,163,152,74,33,61,49,32,56,42,89,82,135,67,113,63,248,250,252,252,0,
+0,2,0,120,254,179,3,116,5,60,0,29,0,41,0,0,19,22,22,23,54,54,51,50,22,21,
+20,6,7,39,54,53,52,38,35,34,6,6,21,17,7,17,52,2,38,39,19,52,54,51,50,22,21,
+20,6,35,34,38,166,69,92,36,20,146,120,103,132,50,42,64,49,71,50,59,69,32,
+164,44,96,72,191,60,43,42,60,59,43,43,60,5,60,56,117,74,122,125,129,103,58,
+96,30,81,38,68,56,75,105,198,213,253,112,70,2,13,227,1,22,199,67,250,24,48,
+68,68,48,48,69,69,0,2,0,80,255,241,4,21,4,170,0,13,0,25,0,0,1,20,2,6,35,34,
+2,17,52,18,54,51,50,18,3,52,2,35,34,6,21,20,22,51,50,54,4,21,140,234,129,
+216,246,140,238,126,219,242,168,175,150,147,157,172,154,148,155,2,98,159,
+254,221,175,1,44,1,7,169,1,42,179,254,206,254,214,223,1,0,244,235,228,252,
+239,0,0,2,0,130,255,241,3,174,4,156,0,19,0,31,0,0,1,17,20,22,23,38,53,52,
+54,51,50,22,21,20,6,6,35,32,17,17,1,20,22,51,50,54,53,52,38,35,34,6,1,38,
+93,92,42,144,113,105,143,90,162,106,254,58,1,153,70,50,49,72,72,49,50,70,
+4,156,253,135,188,206,39,68,75,118,149,144,98,82,138,77,2,3,2,98,252,169,
+58,81,80,59,59,80,80,0,0,1,0,40,255,246,3,210,4,166,0,11,0,0,5,2,3,2,3,7,
+18,19,55,18,0,23,3,25,220,107,158,63,205,166,227,116,96,1,10,67,10,2,73,1,
+116,254,61,254,56,50,2,68,1,239,125,254,202,253,59,141,0,1,0,80,255,241,3,
+96,4,171,0,43,0,0,1,38,35,34,6,21,20,30,6,21,20,14,2,35,34,38,39,55,30,2,
+51,50,53,52,38,38,39,46,2,53,52,54,54,51,50,23,2,169,90,140,95,108,53,87,
+110,116,110,87,53,80,146,187,67,80,161,49,72,45,73,97,67,248,57,100,151,132,
+114,62,122,220,93,199,112,3,210,79,90,75,55,70,45,30,29,37,62,94,71,75,141,
+119,79,57,45,171,54,50,31,235,55,72,50,38,33,62,91,67,85,164,120,98,0,1,0,
+40,255,245,3,216,4,166,0,21,0,0,5,2,39,6,3,7,39,18,19,2,39,55,22,19,54,55,
+55,23,2,7,18,23,3,66,178,152,159,159,133,5,219,180,204,203,144,145,220,140,
+138,132,12,204,160,228,149,10,1,37,213,237,254,253,11,13,1,43,1,17,1,20,226,
+114,163,254,216,214,235,7,13,254,224,234,254,198,234,0,0,3,0,80,255,241,3,
+149,4,171,0,37,0,48,0,59,0,0,1,6,17,20,22,23,38,53,52,54,51,50,22,21,20,6,
+6,35,34,38,38,53,52,62,2,51,50,22,21,20,6,6,35,34,38,53,52,19,50,54,53,52,
+35,34,6,21,20,22,19,6,6,21,20,22,51,50,53,52,38,1,242,250,124,146,28,129,
+103,88,107,90,156,97,148,224,122,92,166,208,88,120,140,54,99,65,96,110,172,
+56,76,91,38,53,29,1,21,29,53,38,91,75,4,59,127,254,117,185,209,54,43,64,97,
+120,111,89,63,119,70,131,246,171,125,235,188,114,123,103,58,101,57,114,94,
+79,252,100,67,43,91,48,53,38,57,3,185,5,51,38,53,54,91,43,67,0,0,2,0,80,255,
+125,3,160,4,156,0,33,0,43,0,0,5,38,38,39,38,38,53,52,0,33,51,7,33,34,6,6,
+21,20,22,23,38,53,52,54,54,51,50,22,21,20,6,7,22,23,3,54,53,52,38,35,34,6,
+21,20,2,38,22,55,14,172,207,1,68,1,20,161,50,254,219,69,116,65,104,91,5,76,
+127,70,100,117,180,158,36,64,122,212,60,50,50,64,131,40,185,86,31,255,184,
+245,1,29,148,90,163,112,135,199,39,43,57,64,121,72,111,90,120,148,9,138,115,
+1,94,3,156,63,61,79,66,71,0,2,0,80,255,241,3,160,4,172,0,39,0,52,0,0,1,39,
+35,34,6,21,20,22,23,54,55,55,14,2,7,30,2,21,20,6,6,35,34,38,53,52,54,54,55,
+38,38,53,52,54,54,51,51,55,19,52,46,2,39,6,6,21,20,33,50,54,2,27,18,19,98,
+115,107,122,194,57,159,8,70,114,140,154,112,63,145,252,83,168,197,54,98,146,
+143,114,120,230,105,28,26,127,52,86,110,58,108,95,1,5,118,130,4,82,1,86,69,
+73,117,57,165,135,45,55,108,112,107,70,84,101,65,80,162,121,137,120,40,89,
+100,119,70,140,86,80,137,92,1,252,135,45,69,57,51,27,85,129,58,161,100,0,
+0,1,0,40,255,246,3,210,4,166,0,12,0,0,19,22,18,23,18,19,55,2,3,7,2,2,39,225,
+81,172,74,146,75,205,160,233,116,85,245,99,4,166,219,254,28,255,1,162,1,234,
+50,253,209,253,252,125,1,19,2,152,221,0,0,2,0,60,255,246,3,220,4,156,0,15,
+0,20,0,0,1,2,39,55,33,10,2,7,7,18,19,35,7,6,7,39,54,55,33,22,1,27,149,74,
+148,3,12,108,109,80,15,204,151,229,232,44,87,36,74,54,99,254,228,79,1,183,
+1,160,177,148,254,198,254,131,254,166,109,40,2,17,2,1,125,243,130,133,141,
+224,211,0,0,1,1,44,255,226,1,208,4,186,0,3,0,0,5,17,55,17,1,44,164,30,4,146,
+70,251,110,0,0,2,1,44,255,226,3,36,4,186,0,3,0,7,0,0,5,17,55,17,23,17,55,
+17,1,44,164,176,164,30,4,146,70,251,110,70,4,146,70,251,110,0,0,3,253,211,
+253,168,1,105,0,48,0,22,0,53,0,65,0,0,5,62,3,55,23,30,3,23,7,46,3,39,14,3,
+7,1,14,5,35,34,46,2,53,52,62,2,51,50,30,2,21,20,6,7,62,3,55,1,52,38,35,34,
+6,21,20,22,51,50,54,253,211,24,79,91,94,39,41,7,65,87,96,38,81,36,92,85,68,
+13,14,62,73,75,25,3,113,21,59,76,95,116,139,81,69,100,65,32,27,48,67,40,35,
+61,46,26,3,2,96,137,100,71,30,253,228,37,27,26,38,38,26,27,37,195,13,46,62,
+78,44,20,47,71,52,36,11,136,12,44,58,70,38,13,45,50,46,13,1,45,81,156,140,
+119,86,49,34,54,70,36,38,66,48,27,31,51,64,33,8,22,9,13,86,128,157,83,254,
+92,27,38,38,27,26,37,37,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,
+0,1,4,9,0,1,0,30,0,94,0,3,0,1,4,9,0,2,0,14,0,124,0,3,0,1,4,9,0,3,0,68,0,138,
+0,3,0,1,4,9,0,4,0,30,0,94,0,3,0,1,4,9,0,5,0,30,0,206,0,3,0,1,4,9,0,6,0,26,
+0,236,0,3,0,1,4,9,0,7,0,68,1,6,0,3,0,1,4,9,0,8,0,42,1,74,0,3,0,1,4,9,0,9,
+0,40,1,116,0,3,0,1,4,9,0,10,0,96,1,156,0,3,0,1,4,9,0,11,0,62,1,252,0,3,0,
+1,4,9,0,12,0,60,2,58,0,3,0,1,4,9,0,13,2,150,2,118,0,3,0,1,4,9,0,14,0,52,5,
+12,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,
+49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,
+0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,
+101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,
+0,83,0,97,0,110,0,115,0,32,0,76,0,105,0,109,0,98,0,117,0,82,0,101,0,103,0,
+117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,76,0,105,0,109,0,98,0,117,0,86,0,101,
+0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,104,0,
+78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,76,0,105,0,109,0,98,0,117,0,
+78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,
+0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,
+0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,
+32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,
+0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,
+0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,
+0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,
+0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,
+0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,
+65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,
+0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,
+0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,
+0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,
+0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,
+115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,
+0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,
+0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,
+101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,
+0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,
+0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,
+0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,
+0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,
+0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,
+0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,
+0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,
+0,255,39,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,1,2,0,2,0,
+3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,
+1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,
+1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,
+1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,
+1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,4,110,117,108,108,7,117,110,105,49,
+57,48,48,7,117,110,105,49,57,48,49,7,117,110,105,49,57,48,50,7,117,110,105,
+49,57,48,51,7,117,110,105,49,57,48,52,7,117,110,105,49,57,48,53,7,117,110,
+105,49,57,48,54,7,117,110,105,49,57,48,55,7,117,110,105,49,57,48,56,7,117,
+110,105,49,57,48,57,7,117,110,105,49,57,48,65,7,117,110,105,49,57,48,66,7,
+117,110,105,49,57,48,67,7,117,110,105,49,57,48,68,7,117,110,105,49,57,48,
+69,7,117,110,105,49,57,48,70,7,117,110,105,49,57,49,48,7,117,110,105,49,57,
+49,49,7,117,110,105,49,57,49,50,7,117,110,105,49,57,49,51,7,117,110,105,49,
+57,49,52,7,117,110,105,49,57,49,53,7,117,110,105,49,57,49,54,7,117,110,105,
+49,57,49,55,7,117,110,105,49,57,49,56,7,117,110,105,49,57,49,57,7,117,110,
+105,49,57,49,65,7,117,110,105,49,57,49,66,7,117,110,105,49,57,49,67,7,117,
+110,105,49,57,50,48,7,117,110,105,49,57,50,49,7,117,110,105,49,57,50,50,7,
+117,110,105,49,57,50,51,7,117,110,105,49,57,50,52,7,117,110,105,49,57,50,
+53,7,117,110,105,49,57,50,54,7,117,110,105,49,57,50,55,7,117,110,105,49,57,
+50,56,7,117,110,105,49,57,50,57,7,117,110,105,49,57,50,65,7,117,110,105,49,
+57,50,66,7,117,110,105,49,57,51,48,7,117,110,105,49,57,51,49,7,117,110,105,
+49,57,51,50,7,117,110,105,49,57,51,51,7,117,110,105,49,57,51,52,7,117,110,
+105,49,57,51,53,7,117,110,105,49,57,51,54,7,117,110,105,49,57,51,55,7,117,
+110,105,49,57,51,56,7,117,110,105,49,57,51,57,7,117,110,105,49,57,51,65,7,
+117,110,105,49,57,51,66,7,117,110,105,49,57,52,48,7,117,110,105,49,57,52,
+52,7,117,110,105,49,57,52,53,7,117,110,105,49,57,52,54,7,117,110,105,49,57,
+52,55,7,117,110,105,49,57,52,56,7,117,110,105,49,57,52,57,7,117,110,105,49,
+57,52,65,7,117,110,105,49,57,52,66,7,117,110,105,49,57,52,67,7,117,110,105,
+49,57,52,68,7,117,110,105,49,57,52,69,7,117,110,105,49,57,52,70,5,100,97,
+110,100,97,11,100,111,117,98,108,101,100,97,110,100,97,11,117,110,105,49,
+57,50,65,49,57,50,50,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,88,
+0,0,0,2,0,12,0,0,0,32,0,1,0,33,0,35,0,3,0,36,0,39,0,1,0,40,0,41,0,3,0,42,
+0,42,0,1,0,43,0,43,0,3,0,44,0,46,0,1,0,47,0,47,0,3,0,48,0,53,0,1,0,54,0,56,
+0,3,0,57,0,71,0,1,0,72,0,72,0,3,0,4,0,0,0,1,0,0,0,1,0,0,0,10,0,32,0,60,0,
+1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,109,97,114,107,0,14,
+109,107,109,107,0,22,0,0,0,2,0,0,0,1,0,0,0,1,0,2,0,3,0,8,0,24,0,40,0,9,0,
+0,0,1,0,8,0,1,0,4,0,0,0,40,0,9,0,0,0,1,0,8,0,1,0,4,0,0,2,22,0,9,0,0,0,1,0,
+8,0,1,0,6,0,0,2,244,0,1,0,12,0,26,0,3,0,36,0,88,0,1,0,5,0,33,0,34,0,40,0,
+41,0,55,0,2,0,1,0,4,0,32,0,0,0,5,0,0,0,22,0,1,0,28,0,0,0,34,0,0,0,40,0,2,
+0,46,0,1,253,218,5,40,0,1,255,196,3,252,0,1,254,12,5,70,0,1,253,208,5,40,
+0,1,254,212,5,220,0,29,0,176,0,182,1,82,1,76,1,64,1,82,0,188,1,40,0,194,1,
+76,0,200,1,82,1,58,0,206,1,70,1,28,0,212,1,100,1,76,1,154,1,82,1,148,1,94,
+1,82,1,106,0,218,1,82,0,224,0,230,0,236,1,148,0,242,0,248,0,254,1,130,1,118,
+1,58,1,4,1,136,1,10,1,94,1,70,1,10,1,40,1,16,1,76,1,64,1,82,1,148,1,22,1,
+46,1,28,1,34,1,100,1,76,1,64,1,70,1,148,1,40,1,46,1,76,1,52,1,82,1,58,1,130,
+1,118,1,76,1,64,1,70,1,76,1,94,1,82,1,88,1,94,1,100,1,106,1,112,1,118,1,124,
+1,130,1,136,1,148,1,154,1,142,1,148,1,154,1,160,0,1,2,248,5,40,0,1,5,10,3,
+252,0,1,3,32,5,40,0,1,3,112,5,220,0,1,4,136,3,252,0,1,4,156,3,252,0,1,7,108,
+3,252,0,1,5,60,3,252,0,1,2,108,5,40,0,1,4,36,3,252,0,1,2,68,5,220,0,1,5,70,
+3,252,0,1,2,228,5,220,0,1,2,48,5,40,0,1,3,212,3,252,0,1,2,148,5,40,0,1,1,
+204,5,220,0,1,5,140,3,252,0,1,3,72,5,40,0,1,6,64,3,252,0,1,5,100,3,252,0,
+1,2,248,5,220,0,1,5,0,3,252,0,1,2,88,5,40,0,1,4,176,3,252,0,1,2,88,5,220,
+0,1,2,168,5,40,0,1,2,148,5,220,0,1,3,12,5,40,0,1,5,20,3,252,0,1,3,32,5,220,
+0,1,2,188,5,40,0,1,3,232,3,252,0,1,2,28,5,220,0,1,2,68,5,40,0,1,3,252,3,252,
+0,1,2,8,5,220,0,1,2,188,5,220,0,1,2,228,5,40,0,1,4,216,3,252,0,1,3,52,5,220,
+0,1,0,12,0,26,0,1,0,36,0,88,0,1,0,5,0,35,0,43,0,47,0,56,0,72,0,2,0,1,0,4,
+0,32,0,0,0,5,0,0,0,22,0,0,0,28,0,0,0,34,0,0,0,40,0,0,0,46,0,1,253,108,255,
+226,0,1,0,50,0,0,0,1,254,122,0,0,0,1,253,158,0,0,0,1,255,116,0,0,0,29,0,114,
+0,138,0,144,0,114,0,138,0,60,0,66,0,114,0,144,0,72,0,84,0,78,0,114,0,114,
+0,114,0,84,0,90,0,96,0,114,0,102,0,108,0,138,0,114,0,114,0,120,0,126,0,132,
+0,138,0,144,0,1,3,112,0,0,0,1,2,128,0,0,0,1,1,144,255,156,0,1,2,28,0,0,0,
+1,2,88,0,0,0,1,2,228,0,0,0,1,3,32,0,0,0,1,2,248,0,0,0,1,2,133,0,20,0,1,2,
+133,0,0,0,1,2,148,0,0,0,1,2,68,0,0,0,1,1,144,0,0,0,1,2,108,0,0,0,1,2,188,
+0,0,0,1,0,12,0,18,0,1,0,30,0,42,0,1,0,1,0,55,0,1,0,4,0,33,0,34,0,40,0,41,
+0,1,0,0,0,6,0,1,254,212,5,220,0,4,0,10,0,16,0,22,0,28,0,1,254,252,6,64,0,
+1,2,13,5,40,0,1,254,122,6,174,0,1,254,47,7,28,0,1,0,0,0,10,0,30,0,44,0,1,
+68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,0,8,0,0,0,1,
+0,0,0,1,0,4,0,7,0,0,0,1,0,8,0,1,0,4,0,0,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,72,
+0,2,0,35,0,1,0,1,0,43,};
+#endif
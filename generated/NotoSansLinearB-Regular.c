@@ -0,0 +1,2406 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansLinearB_Regular_ttf_size = 57936;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansLinearB_Regular_ttf");
+asm(".type fz_font_NotoSansLinearB_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansLinearB_Regular_ttf, 57936");
+asm(".balign 64");
+asm("fz_font_NotoSansLinearB_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansLinearB-Regular.ttf\"");
+#else
+const int fz_font_NotoSansLinearB_Regular_ttf_size = 57936;
+const char fz_font_NotoSansLinearB_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,121,104,112,145,0,0,1,56,0,0,0,96,
+99,109,97,112,0,237,14,246,0,0,5,216,0,0,1,24,103,97,115,112,0,7,0,7,0,0,
+226,68,0,0,0,12,103,108,121,102,233,0,157,118,0,0,9,20,0,0,211,2,104,101,
+97,100,13,172,141,215,0,0,0,188,0,0,0,54,104,104,101,97,23,190,14,24,0,0,
+0,244,0,0,0,36,104,109,116,120,34,212,199,209,0,0,1,152,0,0,4,64,108,111,
+99,97,41,107,244,101,0,0,6,240,0,0,2,34,109,97,120,112,1,68,1,93,0,0,1,24,
+0,0,0,32,110,97,109,101,141,93,184,237,0,0,220,24,0,0,6,10,112,111,115,116,
+255,184,0,50,0,0,226,36,0,0,0,32,0,1,0,0,0,1,10,61,119,110,60,225,95,15,60,
+245,0,11,8,0,0,0,0,0,205,53,107,128,0,0,0,0,210,40,203,249,0,16,254,250,15,
+31,8,41,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,15,72,0,16,0,23,
+15,31,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,16,0,1,0,0,1,16,1,92,0,51,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,6,189,1,144,0,5,0,0,5,154,5,51,0,
+0,0,0,5,154,5,51,0,0,0,0,0,30,2,194,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,
+0,0,0,0,0,0,0,0,0,32,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,1,0,0,0,0,5,182,8,41,0,0,0,32,0,0,4,205,0,193,0,0,0,0,2,20,0,0,
+2,20,0,0,5,139,0,203,5,174,0,135,5,10,0,113,5,178,0,227,4,98,0,203,4,0,0,
+227,6,63,0,180,5,139,0,203,4,106,0,180,5,162,0,158,5,90,0,227,5,248,0,135,
+5,2,0,158,7,219,0,90,6,154,0,135,6,63,0,180,5,217,0,113,5,35,0,135,5,201,
+0,158,5,254,0,201,6,133,0,135,5,33,0,180,4,217,0,90,6,102,0,180,4,182,0,180,
+5,180,0,135,5,51,0,113,6,219,0,203,5,90,0,227,4,14,0,135,4,27,0,227,5,174,
+0,135,4,205,0,135,5,250,0,45,4,195,0,90,6,154,0,135,6,82,0,68,4,137,0,135,
+5,6,0,227,4,172,0,90,4,219,0,158,4,14,0,135,5,186,0,113,5,121,0,168,5,35,
+0,227,5,164,0,135,4,152,0,135,4,215,0,227,4,246,0,203,5,92,0,180,5,174,0,
+135,4,14,0,135,5,215,0,135,5,90,0,227,4,147,0,135,5,102,0,113,4,158,0,135,
+4,129,0,113,5,57,0,227,5,76,0,90,6,86,0,68,4,221,0,90,6,45,0,135,6,10,0,135,
+8,8,0,135,6,98,0,158,6,8,0,113,5,193,0,227,5,35,0,68,6,0,0,250,5,215,0,135,
+6,4,0,180,4,90,0,227,6,55,0,68,4,129,0,113,4,219,0,158,6,88,0,68,4,123,0,
+113,6,111,0,207,7,180,0,199,5,160,0,227,7,33,0,227,7,98,0,227,6,248,0,23,
+5,51,0,113,6,39,0,135,7,154,0,227,6,45,0,68,4,219,0,158,4,219,0,158,8,129,
+0,121,9,221,0,158,9,2,0,135,9,254,0,135,6,82,0,68,6,82,0,68,6,109,0,68,6,
+109,0,68,6,63,0,156,6,25,0,135,6,25,0,113,6,25,0,113,5,195,0,72,4,184,0,102,
+6,61,0,164,6,10,0,102,4,41,0,225,4,90,0,102,4,78,0,164,6,43,0,102,6,55,0,
+227,5,96,0,90,4,201,0,102,6,23,0,82,4,154,0,225,5,172,0,164,7,31,0,164,6,
+238,0,225,6,0,0,225,6,244,0,102,10,49,0,102,6,203,0,102,5,156,0,102,7,127,
+0,102,4,90,0,102,6,74,0,102,9,252,0,164,6,51,0,225,7,92,0,225,7,168,0,102,
+6,145,0,164,7,150,0,16,6,51,0,225,10,96,0,102,9,162,0,102,11,131,0,164,11,
+72,0,225,12,225,0,225,5,211,0,164,4,225,0,164,8,57,0,102,5,70,0,205,10,162,
+0,164,7,236,0,102,7,133,0,164,9,195,0,164,8,137,0,225,4,248,0,225,5,170,0,
+225,9,162,0,164,5,133,0,164,9,78,0,225,10,82,0,164,7,92,0,225,6,82,0,164,
+6,109,0,164,10,117,0,102,11,66,0,102,14,137,0,102,6,195,0,102,8,215,0,102,
+4,139,0,164,3,82,0,225,4,139,0,164,15,59,0,164,15,59,0,164,15,72,0,102,6,
+154,0,135,8,0,0,164,8,154,0,225,6,0,0,225,4,139,0,164,9,92,0,164,8,61,0,164,
+8,182,0,102,7,182,0,205,10,207,0,102,7,203,0,225,13,18,0,102,8,244,0,225,
+8,172,0,205,8,109,0,225,10,76,0,102,9,152,0,102,7,221,0,102,6,53,0,135,7,
+129,0,90,5,143,0,102,5,37,0,102,6,59,0,102,6,37,0,102,6,195,0,102,5,160,0,
+102,7,203,0,158,10,227,0,102,7,90,0,102,8,104,0,102,9,141,0,102,7,197,0,102,
+4,203,0,102,5,127,0,164,9,74,0,102,7,164,0,225,11,33,0,102,7,180,0,225,11,
+18,0,164,10,242,0,164,7,100,0,102,6,170,0,102,8,254,0,102,8,14,0,102,2,246,
+1,51,3,150,1,51,4,49,0,31,7,51,3,82,7,51,2,174,7,51,2,10,7,51,2,174,7,51,
+2,10,7,51,2,10,7,51,1,102,7,51,1,102,7,51,2,10,7,51,2,92,7,51,2,92,7,51,2,
+92,7,51,0,207,7,51,0,207,7,51,0,207,7,51,0,207,7,51,0,207,7,51,0,158,7,51,
+2,12,7,51,1,166,7,51,2,197,7,51,1,166,7,51,1,166,7,51,1,166,7,51,1,238,7,
+51,1,238,7,51,0,248,7,51,0,205,7,51,1,2,7,51,2,41,7,51,1,2,7,51,1,2,7,51,
+1,2,7,51,1,100,7,51,1,100,7,51,0,111,7,51,0,205,7,51,1,2,7,51,2,41,7,51,1,
+2,7,51,1,2,7,51,1,2,7,51,1,100,7,51,1,100,7,51,0,111,6,201,0,205,3,68,0,205,
+6,246,0,205,4,168,0,205,4,143,0,205,4,143,0,205,5,133,0,205,4,100,0,205,8,
+94,0,205,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,0,12,0,8,
+0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,0,160,254,255,
+255,255,0,1,255,245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,
+0,0,0,0,196,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,
+0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,254,255,0,
+0,254,255,0,0,0,1,0,1,0,0,0,1,0,11,0,0,0,4,0,1,0,13,0,1,0,38,0,0,0,16,0,1,
+0,40,0,1,0,58,0,0,0,42,0,1,0,60,0,1,0,61,0,0,0,61,0,1,0,63,0,1,0,77,0,0,0,
+63,0,1,0,80,0,1,0,93,0,0,0,78,0,1,0,128,0,1,0,250,0,0,0,92,0,1,1,0,0,1,1,
+2,0,0,0,215,0,1,1,7,0,1,1,51,0,0,0,218,0,1,1,55,0,1,1,63,0,0,1,7,0,0,0,21,
+0,21,0,21,0,21,0,51,0,117,0,187,0,252,1,41,1,60,1,208,1,249,2,71,2,172,2,
+209,3,32,3,87,3,139,3,211,4,87,4,175,5,8,5,98,5,214,6,67,6,134,6,207,7,4,
+7,55,7,157,7,253,8,106,8,166,8,202,9,7,9,74,9,99,9,194,10,31,10,114,10,168,
+10,209,10,250,11,43,11,140,11,165,11,237,12,53,12,93,12,157,12,214,12,243,
+13,37,13,89,13,133,13,163,14,15,14,46,14,108,14,173,14,230,15,38,15,105,15,
+161,15,217,16,43,16,144,17,25,17,152,17,254,18,111,18,173,19,26,19,154,20,
+2,20,95,20,146,20,240,21,84,21,174,21,225,22,45,22,165,23,25,23,64,23,168,
+24,19,24,125,24,240,25,70,25,119,25,187,25,246,26,80,27,29,28,28,28,240,29,
+206,30,29,30,104,30,181,30,250,31,125,31,243,32,69,32,144,32,218,32,252,33,
+131,33,204,33,250,34,67,34,203,35,27,35,88,35,239,36,63,36,161,36,194,37,
+66,37,178,38,33,38,134,38,204,39,113,39,229,40,88,40,202,41,45,41,184,42,
+27,42,60,42,106,42,209,43,75,44,14,44,106,44,225,45,55,45,234,46,19,46,196,
+47,50,47,91,47,182,47,234,48,114,48,205,48,253,49,68,49,158,49,223,50,27,
+50,129,50,194,51,96,51,199,52,46,52,139,52,209,53,13,53,143,53,186,53,223,
+54,54,54,113,54,149,54,208,55,253,57,12,57,68,57,230,58,97,58,118,58,186,
+59,7,59,60,60,24,61,6,61,133,61,168,61,212,62,36,62,87,62,247,63,52,63,132,
+63,225,64,153,64,243,65,147,65,243,66,82,66,211,67,78,67,156,68,10,68,179,
+69,70,69,177,69,220,70,98,70,195,71,2,71,83,71,162,71,242,72,121,72,189,73,
+124,74,4,74,46,74,102,74,230,75,147,75,160,75,183,75,217,75,230,75,250,76,
+21,76,55,76,96,76,144,76,198,77,4,77,73,77,87,77,107,77,134,77,169,77,209,
+78,0,78,53,78,117,78,188,78,232,79,46,79,147,80,24,80,189,81,130,82,102,83,
+105,84,140,84,209,85,66,85,229,86,181,87,194,88,240,90,86,91,217,93,133,93,
+209,94,78,95,2,95,234,97,20,98,102,99,244,101,166,103,135,103,196,104,23,
+104,78,104,183,104,232,104,253,105,28,105,62,105,129,0,0,0,2,0,193,0,0,4,
+10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,
+135,5,182,250,74,104,4,230,0,0,1,0,203,0,0,4,193,6,102,0,15,0,0,1,35,17,33,
+17,35,17,33,17,35,17,51,17,33,17,51,4,193,144,254,219,143,254,221,143,143,
+2,215,144,2,164,1,184,251,164,4,92,254,72,3,194,254,119,1,137,0,0,3,0,135,
+0,0,5,39,6,123,0,24,0,30,0,37,0,0,51,18,18,55,35,53,51,18,51,50,22,23,51,
+21,35,22,18,19,35,2,3,33,6,2,7,19,6,7,33,38,39,3,34,6,7,33,38,38,135,14,108,
+79,70,115,164,180,95,179,78,117,70,76,103,16,145,27,82,253,86,40,56,8,194,
+36,23,2,110,30,31,250,51,108,52,1,166,52,108,1,12,2,92,244,129,1,158,210,
+204,129,234,253,161,254,237,1,138,1,118,190,254,101,167,4,92,124,95,125,94,
+1,144,138,133,133,138,0,0,1,0,113,0,0,4,154,6,123,0,43,0,0,1,54,54,19,23,
+3,6,7,23,54,51,21,35,34,39,22,21,17,35,17,52,55,6,35,35,53,50,23,55,38,38,
+1,55,19,18,23,51,38,53,17,51,17,20,7,2,246,6,84,196,134,222,62,34,6,56,57,
+18,204,46,6,144,7,40,210,19,57,56,6,20,41,255,0,133,135,129,20,50,7,144,6,
+3,117,41,238,1,239,53,253,252,146,53,6,6,129,4,76,129,253,207,2,49,139,66,
+4,129,6,6,31,87,2,85,53,254,170,254,191,111,133,98,2,10,253,246,123,108,0,
+0,3,0,227,0,0,4,254,6,102,0,10,0,20,0,39,0,0,1,50,22,23,30,2,51,17,33,17,
+23,17,33,17,38,38,39,38,38,35,5,54,54,51,50,22,21,20,6,7,39,55,54,53,52,38,
+35,34,7,2,20,68,99,43,82,124,178,119,252,6,138,2,225,161,213,86,37,65,40,
+1,84,61,148,55,71,103,78,78,80,35,88,38,29,69,114,6,102,97,103,194,156,82,
+252,18,6,102,129,250,156,2,254,29,199,214,92,80,116,61,84,102,70,47,133,78,
+74,34,81,59,26,41,114,0,0,2,0,203,0,0,3,219,6,113,0,18,0,24,0,0,1,39,33,17,
+35,17,16,18,51,50,23,7,38,39,19,51,21,35,23,3,34,6,6,7,33,2,193,27,254,180,
+143,193,200,156,108,22,53,42,54,190,174,25,230,98,107,55,2,1,60,3,27,192,
+252,37,4,43,1,41,1,29,23,127,9,3,254,117,129,174,2,195,81,178,145,0,0,1,0,
+227,0,0,3,121,6,102,0,7,0,0,1,33,17,35,17,51,17,33,3,121,253,250,144,144,
+2,6,3,61,252,195,6,102,253,88,0,3,0,180,255,238,5,139,6,145,0,49,0,78,0,94,
+0,0,1,39,38,39,35,6,6,7,7,35,2,38,39,7,20,6,7,39,19,39,55,23,22,23,51,54,
+54,55,55,51,23,22,22,23,51,54,54,55,55,23,7,19,7,38,38,53,39,6,6,7,1,54,54,
+55,39,38,39,53,33,21,14,3,7,22,22,23,7,38,39,38,38,39,35,6,7,6,7,1,54,54,
+55,53,6,35,35,34,39,21,22,22,23,22,23,3,199,95,62,7,8,5,39,20,98,127,115,
+35,6,6,9,28,127,82,39,127,101,99,17,8,7,55,25,83,107,86,27,64,13,9,8,59,31,
+100,127,39,82,127,27,5,7,9,62,88,252,227,76,182,145,77,140,77,3,22,33,71,
+74,78,39,145,178,81,134,92,113,99,53,9,8,19,82,147,119,1,119,24,173,28,36,
+81,225,78,39,22,83,33,60,28,3,229,240,170,74,34,158,48,248,1,11,92,24,2,31,
+89,193,22,1,187,86,63,223,232,87,49,199,71,229,227,72,196,53,50,201,68,223,
+63,86,254,69,22,194,84,35,2,31,149,199,252,74,130,231,139,73,131,56,129,129,
+23,60,68,73,36,140,223,137,65,169,127,110,68,27,43,86,152,220,2,112,51,147,
+7,12,6,6,12,5,65,32,52,51,0,0,5,0,203,0,0,4,193,6,102,0,3,0,7,0,11,0,15,0,
+19,0,0,1,33,53,33,1,35,17,51,37,35,17,51,33,17,35,17,1,35,17,51,4,193,252,
+10,3,246,254,75,143,143,254,78,143,143,3,103,144,254,219,143,143,5,229,129,
+249,154,2,215,113,2,41,253,215,2,41,253,215,2,41,0,0,2,0,180,0,0,3,227,6,
+123,0,25,0,49,0,0,1,6,7,6,6,21,20,22,23,22,21,17,35,17,52,38,39,38,38,53,
+52,54,55,54,54,55,1,38,38,53,52,55,54,54,53,52,38,39,55,22,22,21,20,7,6,6,
+21,20,22,23,2,131,39,150,72,63,60,98,158,143,70,86,83,73,65,75,90,83,19,1,
+201,148,141,84,46,38,83,91,33,143,133,83,41,42,90,88,6,80,116,97,47,75,42,
+37,63,67,108,165,252,225,3,31,62,94,54,52,101,65,62,102,55,66,93,54,253,70,
+5,72,78,76,80,44,47,17,41,44,10,122,21,91,84,76,69,35,50,22,31,27,8,0,0,1,
+0,158,255,236,5,27,6,125,0,71,0,0,1,6,21,20,23,35,22,21,20,18,18,23,7,38,
+2,17,52,39,35,22,21,20,7,6,21,20,23,7,38,53,52,55,54,53,52,39,35,22,21,20,
+14,2,21,20,22,23,7,38,53,52,62,2,53,52,39,35,54,53,52,39,55,22,21,20,7,33,
+38,53,52,55,4,236,25,25,148,12,28,69,86,131,109,84,20,179,13,32,32,82,131,
+92,32,31,20,182,12,41,49,41,36,44,123,96,40,49,40,21,139,26,32,143,31,17,
+3,23,10,20,6,102,81,160,135,146,77,68,178,254,247,254,253,226,63,252,1,146,
+1,34,97,95,71,74,109,198,199,82,176,164,63,175,177,79,210,209,94,97,95,77,
+68,95,169,158,152,78,96,117,63,63,133,155,80,157,161,168,90,88,104,145,121,
+153,103,23,108,117,109,82,68,127,131,90,0,4,0,227,0,0,4,119,6,102,0,3,0,7,
+0,11,0,15,0,0,1,17,33,17,19,33,17,33,1,17,33,17,17,33,17,33,4,119,252,108,
+138,2,122,253,134,2,122,253,134,2,122,253,134,6,102,249,154,6,102,251,166,
+2,80,252,37,1,10,254,246,4,92,1,8,0,0,3,0,135,255,236,5,113,6,141,0,30,0,
+34,0,38,0,0,1,55,54,54,1,23,1,7,23,23,1,7,1,38,39,7,6,6,1,39,1,54,54,55,38,
+38,1,55,1,22,23,5,3,55,19,33,19,23,3,2,252,5,7,42,1,157,121,254,143,145,45,
+104,1,109,121,254,141,81,15,6,10,54,254,117,121,1,98,29,53,76,29,103,254,
+132,121,1,104,72,26,1,253,84,127,84,251,22,84,127,84,3,176,10,17,70,2,124,
+73,253,198,207,63,152,253,209,73,2,57,125,37,10,19,89,253,155,73,2,35,45,
+78,104,38,152,2,75,73,253,211,110,53,142,1,197,24,254,58,1,198,24,254,59,
+0,1,0,158,0,0,4,145,6,102,0,34,0,0,1,33,21,54,54,51,50,22,21,20,7,6,6,21,
+20,18,23,35,38,2,53,52,55,54,54,53,52,38,35,34,6,7,39,17,33,4,145,252,156,
+29,96,55,125,139,116,58,59,121,90,168,84,102,117,60,56,69,58,75,115,29,98,
+3,243,5,215,205,28,38,139,121,110,158,79,126,54,114,254,184,127,135,1,40,
+122,146,144,73,112,53,60,80,73,65,27,2,16,0,0,1,0,90,0,0,7,39,6,113,0,32,
+0,0,19,54,51,50,22,21,17,33,17,51,17,33,17,35,17,33,17,35,17,33,17,35,17,
+33,17,35,17,52,38,38,35,34,7,90,115,86,172,141,2,174,137,1,148,137,254,245,
+137,254,230,144,254,252,143,32,70,70,90,86,6,90,23,185,221,254,207,1,25,254,
+231,252,86,3,41,252,215,3,41,252,215,3,41,252,215,4,219,106,119,52,21,0,0,
+5,0,135,0,104,6,18,5,242,0,15,0,21,0,26,0,31,0,36,0,0,19,52,18,36,51,50,4,
+18,21,20,2,4,35,34,36,2,1,62,2,55,33,37,38,0,39,17,5,22,0,23,17,17,6,0,7,
+33,135,191,1,73,191,188,1,71,193,192,254,185,189,190,254,183,192,3,2,125,
+222,140,15,254,10,1,246,24,254,230,196,253,144,20,1,22,195,192,254,235,22,
+1,235,3,45,190,1,74,189,187,254,183,193,191,254,182,188,189,1,73,254,130,
+13,142,227,130,129,197,1,28,22,254,9,129,194,254,220,24,1,254,2,120,26,254,
+230,195,0,3,0,180,255,236,5,139,6,145,0,27,0,31,0,81,0,0,1,21,35,34,38,39,
+7,18,19,7,2,3,38,39,35,6,7,2,3,39,18,19,39,6,6,35,35,53,1,35,17,51,19,39,
+38,39,35,6,6,7,7,35,2,38,39,7,20,6,7,39,19,39,55,23,22,23,51,54,54,55,55,
+51,23,22,22,23,51,54,54,55,55,23,7,19,7,38,38,53,39,6,6,7,5,0,174,23,44,146,
+2,152,171,133,120,125,19,22,9,13,28,130,103,137,152,169,4,22,127,51,201,2,
+61,143,143,103,95,62,7,8,5,39,20,98,127,115,35,6,6,9,28,127,82,39,127,101,
+99,17,8,7,55,25,83,107,86,27,64,13,9,8,59,31,100,127,39,82,127,27,5,7,9,62,
+88,3,168,129,1,11,6,254,221,254,13,43,1,111,1,26,38,126,102,66,254,208,254,
+171,43,1,202,1,82,6,6,12,129,252,88,1,59,2,170,240,170,74,34,158,48,248,1,
+11,92,24,2,31,89,193,22,1,187,86,63,223,232,87,49,199,71,229,227,72,196,53,
+50,201,68,223,63,86,254,69,22,194,84,35,2,31,149,199,0,3,0,113,0,0,5,59,6,
+121,0,9,0,21,0,56,0,0,37,52,54,55,19,33,19,22,22,21,1,34,6,21,20,22,51,50,
+54,53,52,38,23,55,23,6,7,33,21,1,51,21,33,53,51,1,6,6,7,39,55,39,6,6,35,34,
+38,38,53,52,54,51,50,22,21,20,7,3,168,25,16,211,253,254,213,17,24,253,180,
+36,52,94,72,28,41,78,154,195,100,91,130,2,190,254,211,195,253,166,194,254,
+207,34,106,52,103,254,6,28,46,34,60,120,72,126,107,99,128,16,111,52,165,55,
+2,221,253,37,55,176,43,5,129,51,35,66,84,41,31,73,91,222,224,103,91,83,129,
+252,37,129,129,3,240,58,138,52,100,234,6,14,17,62,105,62,104,126,148,100,
+45,59,0,2,0,135,255,236,4,156,6,123,0,25,0,54,0,0,1,20,6,6,7,2,2,6,6,35,34,
+38,38,2,3,46,2,53,52,54,54,51,50,22,22,37,26,2,22,22,51,50,54,54,18,19,51,
+3,54,54,53,52,38,38,35,34,6,6,21,20,22,23,3,4,156,92,153,73,28,31,36,58,56,
+62,65,42,33,17,67,145,87,137,255,135,133,249,136,253,137,5,14,16,20,25,24,
+24,24,20,26,13,129,19,69,97,99,172,103,105,178,100,85,68,14,4,201,97,165,
+113,12,254,106,254,249,133,56,71,162,1,65,1,56,10,112,162,95,114,197,123,
+122,194,29,254,207,254,79,254,222,171,75,103,227,2,58,1,118,254,101,20,151,
+93,91,139,75,77,138,90,94,152,18,1,155,0,0,2,0,158,255,236,5,20,6,131,0,53,
+0,57,0,0,1,7,6,0,7,39,54,18,55,6,7,6,35,34,38,53,52,54,51,23,34,6,21,20,51,
+50,55,54,55,2,2,39,55,22,0,19,55,50,22,21,20,7,6,6,21,21,35,53,52,62,2,53,
+52,19,17,35,17,4,4,80,18,254,246,193,72,162,222,20,75,145,113,73,105,134,
+151,117,4,59,74,133,48,105,119,105,9,222,197,55,228,1,19,11,86,117,149,61,
+35,26,131,36,42,36,17,131,2,252,2,250,254,69,89,114,78,1,99,218,11,38,30,
+125,104,101,130,120,61,50,111,32,35,17,1,2,1,97,65,123,70,254,86,254,224,
+2,98,82,76,50,29,35,21,76,76,40,53,41,36,22,78,254,61,254,199,1,57,0,0,1,
+0,201,0,0,5,53,6,125,0,75,0,0,1,51,52,54,54,1,23,7,22,18,21,20,2,7,22,21,
+20,6,7,39,54,54,53,52,38,35,39,55,50,23,54,18,53,52,39,38,53,35,1,17,35,17,
+1,35,20,7,6,21,20,18,23,54,51,23,7,34,21,20,22,23,7,38,38,53,52,55,38,2,53,
+52,19,39,55,0,22,22,2,254,8,29,56,1,34,127,31,50,38,59,47,86,132,114,27,63,
+75,83,69,16,65,27,24,33,37,18,17,8,254,201,144,254,187,8,8,21,39,31,27,26,
+65,18,152,77,63,27,115,131,84,48,56,88,27,127,1,53,47,21,3,72,33,83,120,2,
+73,64,57,207,254,253,89,114,254,213,140,58,91,92,129,19,123,8,57,45,47,46,
+104,6,6,122,1,22,112,119,115,79,88,253,158,252,248,3,4,2,123,57,69,169,127,
+119,254,230,111,6,6,104,93,45,57,8,123,19,125,96,90,59,144,1,48,105,198,1,
+107,51,64,253,146,104,66,0,0,2,0,135,0,0,6,43,6,113,0,64,0,72,0,0,1,38,38,
+53,52,55,54,54,53,52,35,34,6,17,17,35,17,35,22,23,7,3,7,39,54,51,50,22,23,
+51,54,54,51,50,22,21,20,14,2,21,20,22,23,55,23,7,51,50,55,55,23,7,54,55,23,
+6,7,7,39,55,6,35,7,39,1,22,23,19,51,38,38,35,4,147,74,104,51,26,24,93,90,
+77,144,235,20,17,140,102,92,23,120,185,130,157,27,8,12,132,95,113,115,35,
+41,35,41,35,16,111,35,19,18,45,18,111,31,33,41,39,89,44,16,115,33,32,50,13,
+114,253,2,15,8,44,252,6,119,127,3,215,19,116,74,85,71,38,47,23,64,197,255,
+0,251,213,3,219,71,103,18,2,204,12,121,29,134,147,126,155,95,88,46,67,59,
+62,40,34,50,6,155,16,145,6,155,16,121,10,19,115,29,10,164,21,129,4,146,21,
+2,156,49,56,254,213,209,195,0,1,0,180,0,0,4,199,6,123,0,41,0,0,1,6,6,21,20,
+22,23,22,21,20,6,7,1,35,17,52,38,39,55,30,2,21,17,16,7,23,54,54,55,1,54,54,
+53,52,38,39,38,53,52,54,55,4,168,53,49,33,34,66,50,83,253,112,141,45,68,17,
+98,96,45,20,6,20,54,55,1,160,49,63,35,31,67,66,82,6,20,36,70,47,23,46,30,
+59,63,44,108,117,252,111,5,131,56,43,8,139,8,50,99,85,252,187,254,187,95,
+2,54,104,77,2,72,69,89,26,19,45,30,62,86,85,110,63,0,1,0,90,0,0,4,104,6,113,
+0,46,0,0,1,34,38,39,55,22,22,51,50,55,37,55,5,54,53,52,38,38,39,55,30,2,21,
+20,7,54,54,55,23,14,2,35,7,30,2,21,17,35,17,52,38,39,6,6,1,117,82,147,54,
+76,49,109,47,116,41,254,217,64,1,29,6,69,120,59,49,88,152,86,13,54,144,153,
+75,82,112,94,82,6,65,74,35,144,68,83,45,133,3,195,73,62,96,52,61,70,162,110,
+176,32,36,49,89,65,10,121,18,98,137,87,48,40,14,86,113,123,67,70,29,8,28,
+114,173,173,253,119,2,137,200,182,52,54,66,0,0,2,0,180,0,0,5,223,6,123,0,
+26,0,34,0,0,1,33,53,51,17,33,17,35,17,34,38,53,52,54,51,50,22,22,21,21,33,
+17,33,21,35,17,51,1,20,22,51,53,52,35,34,5,150,254,118,123,253,242,144,131,
+178,118,97,88,98,52,2,14,1,88,200,127,251,163,98,78,88,88,2,162,129,1,57,
+251,164,4,92,174,135,105,129,72,153,123,66,1,137,129,253,62,2,96,78,88,66,
+221,0,3,0,180,0,0,4,2,6,102,0,19,0,23,0,27,0,0,1,62,2,55,23,3,22,21,17,35,
+17,52,55,3,55,23,22,22,23,1,33,53,33,53,33,53,33,2,88,3,30,41,108,127,243,
+4,144,4,249,127,96,24,59,5,1,178,252,178,3,78,252,178,3,78,2,197,16,81,90,
+212,64,254,46,50,86,254,70,1,180,91,48,1,211,64,184,43,142,28,2,24,129,135,
+129,0,0,1,0,135,0,0,5,45,6,121,0,75,0,0,1,20,6,35,34,38,39,7,22,21,17,35,
+17,52,55,39,6,35,34,38,53,52,62,2,53,52,38,35,55,22,22,21,20,14,2,21,20,22,
+51,50,55,38,53,53,35,53,33,21,35,21,20,7,22,22,51,50,54,53,52,46,2,53,52,
+54,55,23,34,6,21,20,30,2,5,12,165,123,70,102,37,7,11,144,11,7,59,149,123,
+160,27,32,27,51,68,17,122,117,29,34,29,80,74,119,92,9,108,1,100,104,8,37,
+94,75,73,81,28,33,27,123,123,16,67,52,27,32,27,4,223,99,134,37,47,4,121,86,
+252,137,3,119,128,81,4,86,133,100,51,66,50,41,26,33,24,119,9,79,84,45,62,
+50,47,28,54,60,59,78,61,172,129,129,172,35,104,25,34,59,55,28,47,50,62,45,
+84,79,9,119,24,33,26,41,50,66,0,1,0,113,0,0,4,195,6,125,0,57,0,0,1,62,2,55,
+46,2,39,55,23,22,23,54,55,23,3,19,7,39,38,38,39,6,6,7,3,22,21,17,35,17,52,
+55,3,38,39,7,6,7,7,39,19,3,55,23,22,22,23,52,54,55,23,7,6,7,18,23,2,156,5,
+41,88,75,12,27,51,107,102,80,53,17,18,88,133,151,199,105,78,37,34,2,2,37,
+50,141,6,143,4,143,52,36,6,25,41,80,104,198,151,133,63,26,17,2,37,111,102,
+73,69,54,187,17,3,133,21,91,176,132,12,31,62,159,74,123,87,36,52,196,64,254,
+236,254,248,78,108,53,76,7,2,92,91,254,248,52,85,253,131,2,119,104,33,1,14,
+94,91,15,65,53,111,78,1,8,1,20,64,127,53,59,5,4,68,170,74,108,100,56,254,
+194,102,0,0,3,0,203,0,0,6,129,6,102,0,39,0,43,0,67,0,0,1,34,38,39,7,22,22,
+18,23,35,38,2,39,6,3,35,54,18,54,55,39,6,6,35,35,3,51,19,51,3,51,19,51,19,
+51,3,51,19,51,3,1,35,53,51,1,54,54,53,52,38,39,38,53,52,54,55,23,6,6,21,20,
+23,23,22,21,20,6,7,4,68,38,181,15,2,47,85,139,47,148,49,140,49,92,125,145,
+44,123,94,54,2,18,172,31,186,129,151,101,139,49,149,39,133,39,148,49,139,
+102,152,131,254,168,246,246,1,165,88,91,39,44,83,113,163,33,91,83,44,40,84,
+141,148,2,35,8,2,8,13,111,254,216,129,140,1,27,52,107,254,144,123,1,16,138,
+16,8,2,8,4,67,252,52,3,204,252,52,3,204,252,52,3,204,251,189,253,221,129,
+1,78,8,26,31,18,42,35,66,81,74,76,26,112,10,33,31,18,40,37,76,83,79,72,5,
+0,0,4,0,227,0,0,4,119,6,102,0,3,0,7,0,22,0,37,0,0,1,17,35,17,1,35,17,51,19,
+52,54,54,51,50,22,23,35,52,38,35,34,6,21,21,20,22,51,50,54,53,51,6,6,35,34,
+38,38,53,4,119,144,253,134,138,138,67,72,120,70,105,132,5,139,55,48,54,62,
+62,54,48,55,139,5,132,105,69,120,73,6,102,249,154,6,102,249,154,6,102,253,
+113,64,125,75,148,116,66,71,71,66,180,67,70,71,66,116,148,75,125,64,0,0,1,
+0,135,0,0,3,135,6,102,0,19,0,0,1,33,17,35,17,33,53,33,17,33,53,33,17,51,17,
+33,21,33,17,33,3,135,254,199,144,254,201,1,55,254,201,1,55,144,1,57,254,199,
+1,57,2,113,253,143,2,113,129,1,24,129,1,219,254,37,129,254,232,0,0,2,0,227,
+255,233,3,80,6,123,0,27,0,34,0,0,1,23,1,39,17,55,1,7,39,38,39,7,22,21,21,
+22,22,21,20,6,6,7,21,20,7,23,54,55,19,52,38,39,17,54,54,2,252,84,254,35,144,
+144,1,221,84,203,136,67,6,19,160,194,96,167,91,19,6,73,130,21,116,95,96,115,
+1,135,121,254,219,74,5,254,74,254,219,121,131,87,63,6,66,215,106,7,173,142,
+91,149,93,7,74,213,67,6,64,85,2,39,79,101,6,254,121,8,112,0,0,2,0,135,0,0,
+5,39,6,123,0,33,0,40,0,0,33,33,53,51,17,35,6,2,3,35,18,18,19,35,53,51,18,
+51,50,22,23,51,21,35,22,18,19,35,2,2,39,35,17,51,3,34,6,7,33,38,38,3,184,
+254,52,155,174,69,110,15,144,14,116,81,80,115,164,180,95,179,78,117,80,79,
+111,15,145,17,109,73,184,161,227,49,112,54,1,174,54,112,129,3,219,218,253,
+154,254,228,1,2,2,87,1,3,129,1,158,210,204,129,243,253,155,254,252,1,25,2,
+92,231,252,37,5,107,134,137,138,133,0,1,0,135,0,0,4,25,6,102,0,13,0,0,33,
+35,17,33,21,35,17,51,21,33,21,33,21,33,3,137,143,254,29,144,144,3,2,252,254,
+2,114,3,219,151,3,34,204,129,189,0,0,1,0,45,0,0,5,115,6,113,0,63,0,0,33,33,
+53,51,38,2,39,38,53,39,6,7,6,7,18,19,51,21,33,53,51,38,2,53,52,55,39,6,6,
+2,7,51,21,33,53,51,54,18,62,2,55,62,2,53,52,38,35,34,7,39,54,51,50,22,21,
+20,6,7,22,18,23,51,5,115,254,196,49,60,115,29,13,6,29,76,81,27,28,97,107,
+254,196,60,31,53,10,4,98,128,76,9,81,254,197,92,9,71,111,156,194,176,140,
+108,45,82,76,102,103,34,122,117,145,156,124,150,46,145,77,111,129,153,1,150,
+152,65,111,6,18,31,35,14,254,73,254,156,129,129,145,1,131,80,65,48,6,77,199,
+254,227,170,129,129,179,1,19,207,158,121,70,56,66,73,52,61,69,39,122,50,130,
+133,102,151,66,249,254,1,178,0,0,4,0,90,0,0,4,104,6,123,0,30,0,42,0,52,0,
+62,0,0,19,52,54,55,54,54,51,50,22,23,22,22,21,20,6,35,6,6,7,22,21,17,35,17,
+52,55,38,38,39,34,38,37,20,22,51,50,54,53,52,38,35,34,6,7,52,55,34,6,21,20,
+22,51,38,37,52,38,35,22,21,20,7,50,54,90,159,165,31,113,50,52,117,28,164,
+159,161,158,20,83,36,10,143,8,37,80,20,160,158,1,119,81,62,63,81,80,64,63,
+80,117,25,81,83,89,73,23,2,150,84,80,26,24,74,88,5,70,100,115,2,41,51,52,
+40,2,115,100,99,114,30,52,8,63,71,252,111,3,143,74,62,8,52,30,115,98,88,109,
+108,89,87,109,110,86,85,46,67,62,63,70,61,72,62,67,52,79,72,59,69,0,0,6,0,
+135,0,104,6,18,5,242,0,3,0,19,0,35,0,39,0,43,0,47,0,0,1,35,53,51,1,52,18,
+36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,18,4,51,50,36,18,53,52,2,36,35,34,
+4,2,5,35,53,51,1,35,53,51,5,35,53,51,2,209,242,242,253,182,191,1,73,191,188,
+1,71,193,192,254,185,189,190,254,183,192,144,154,1,6,151,150,1,6,153,151,
+254,248,150,151,254,248,152,3,165,241,241,254,21,242,242,1,235,241,241,3,
+188,129,254,240,190,1,74,189,187,254,183,193,191,254,182,188,189,1,73,191,
+152,254,244,155,156,1,11,152,151,1,11,158,157,254,245,9,129,253,230,129,129,
+129,0,2,0,68,0,0,5,158,6,96,0,3,0,34,0,0,33,35,17,51,1,20,22,51,50,55,54,
+54,51,50,22,23,23,7,39,38,38,35,34,14,2,35,34,38,38,53,35,53,33,21,4,10,143,
+143,253,72,81,91,106,132,65,100,41,70,122,68,125,94,100,62,81,48,40,99,112,
+123,64,122,136,63,127,5,90,4,115,1,108,128,128,80,40,40,52,59,104,96,90,53,
+39,50,60,50,84,172,129,129,129,0,0,3,0,135,0,0,4,2,6,102,0,7,0,15,0,23,0,
+0,1,35,17,35,17,35,53,33,37,33,53,51,17,51,17,51,5,33,53,51,17,51,17,51,3,
+53,170,143,168,1,225,254,183,254,155,107,137,113,2,22,254,156,102,137,117,
+3,127,252,129,3,127,129,92,129,1,137,254,119,129,129,1,137,254,119,0,2,0,
+227,0,0,4,195,6,102,0,5,0,23,0,0,33,33,17,51,17,33,1,54,51,50,22,21,20,7,
+39,54,54,53,52,38,35,34,6,7,4,195,252,32,138,3,86,253,77,135,144,70,94,146,
+90,57,56,39,29,37,79,56,6,102,250,27,1,182,135,89,72,131,146,82,57,77,34,
+26,42,53,56,0,0,1,0,90,0,0,4,82,6,102,0,28,0,0,1,20,7,54,18,53,51,20,2,6,
+7,22,21,17,35,17,52,55,38,2,17,51,16,18,23,38,53,17,51,2,156,11,145,161,143,
+105,200,142,9,144,8,217,225,143,152,150,11,144,4,221,123,75,27,1,57,251,201,
+254,196,188,18,47,57,252,213,3,37,54,56,23,1,124,1,64,254,253,254,203,26,
+77,124,1,137,0,0,1,0,158,0,0,4,61,6,117,0,67,0,0,33,18,55,39,6,35,35,53,51,
+50,22,23,55,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,54,53,
+52,38,35,34,7,39,54,51,50,22,21,20,6,7,23,54,54,51,51,21,35,34,39,7,22,18,
+19,35,2,2,35,34,2,3,1,49,113,135,4,104,95,192,196,74,104,23,4,63,101,124,
+106,43,28,16,27,28,51,58,64,45,29,53,30,87,79,63,62,22,83,66,139,146,89,77,
+4,40,118,59,172,165,132,96,6,60,108,82,141,75,79,23,29,92,55,3,27,106,10,
+16,129,22,5,11,20,134,75,106,121,10,104,6,65,54,76,100,70,124,80,101,100,
+14,112,19,150,147,115,190,50,10,13,20,129,16,10,54,254,135,254,42,1,179,1,
+91,254,113,254,129,0,1,0,135,0,0,3,135,6,102,0,11,0,0,1,33,17,35,17,33,53,
+33,17,51,17,33,3,135,254,199,144,254,201,1,55,144,1,57,3,61,252,195,3,61,
+129,2,168,253,88,0,0,1,0,113,0,0,5,74,6,123,0,48,0,0,1,22,21,17,35,17,52,
+54,55,39,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,51,22,22,51,
+50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,39,3,27,8,144,5,4,9,45,124,72,
+139,166,56,77,106,46,50,108,97,61,146,55,20,57,148,60,95,107,45,51,107,67,
+66,165,140,76,133,37,4,100,64,97,252,61,3,195,26,118,19,7,56,69,185,155,76,
+130,105,80,60,109,62,99,106,109,91,93,107,104,101,60,102,69,80,77,151,83,
+155,185,64,58,0,0,1,0,168,0,0,4,217,6,125,0,42,0,0,1,30,2,23,54,18,55,55,
+23,6,7,19,7,3,38,53,52,55,39,6,6,7,2,21,17,35,17,52,3,38,38,39,7,22,21,20,
+7,3,39,19,38,39,1,27,130,158,113,25,47,203,125,40,117,83,79,131,125,59,20,
+4,11,3,40,32,148,143,148,32,40,3,11,4,20,59,125,131,87,75,6,125,158,239,238,
+104,163,1,111,157,52,88,93,112,253,225,30,1,0,89,72,44,16,4,22,80,60,254,
+234,211,253,143,2,115,209,1,22,60,80,22,4,16,44,72,89,255,0,30,2,31,122,85,
+0,4,0,227,0,0,4,156,6,102,0,7,0,11,0,15,0,19,0,0,1,33,17,35,17,51,17,33,37,
+35,17,51,1,35,17,51,1,35,17,51,4,156,252,215,144,144,3,41,254,245,143,143,
+1,11,144,144,253,235,143,143,3,219,252,37,6,102,253,246,129,1,137,254,119,
+1,137,254,119,1,137,0,0,1,0,135,255,236,5,29,6,102,0,37,0,0,1,35,17,35,17,
+35,53,51,17,35,2,2,7,39,18,19,23,3,51,17,51,17,51,38,39,55,18,18,19,7,46,
+2,2,39,35,17,51,3,184,149,144,147,147,231,40,94,20,139,170,53,129,38,210,
+144,192,26,13,129,29,135,60,144,8,33,41,46,21,213,149,1,41,254,215,1,41,129,
+1,147,255,0,254,14,95,20,3,8,1,230,17,254,225,2,168,253,88,171,114,23,254,
+249,253,36,254,241,20,43,171,227,1,12,140,254,109,0,0,2,0,135,0,0,3,250,6,
+123,0,11,0,36,0,0,1,51,21,35,21,51,21,35,21,35,17,51,37,22,22,23,22,21,20,
+6,7,6,6,21,17,35,17,52,55,54,54,53,52,38,39,38,39,1,23,239,239,239,239,144,
+144,1,151,14,73,99,146,75,80,81,75,144,155,90,64,62,72,150,43,5,205,129,240,
+129,147,3,30,21,40,71,71,107,139,66,103,50,51,100,62,252,225,3,31,167,103,
+60,66,38,38,69,46,97,129,0,0,2,0,227,0,0,4,35,6,102,0,9,0,13,0,0,19,33,17,
+35,53,33,17,33,21,33,19,33,17,33,227,3,64,137,253,217,2,176,252,192,144,2,
+39,253,217,6,102,253,113,133,252,37,129,4,221,1,8,0,0,1,0,203,255,233,4,66,
+6,123,0,25,0,0,1,19,7,39,33,7,39,18,17,16,3,55,23,33,55,23,3,39,55,33,22,
+17,16,3,33,39,4,12,54,138,24,253,200,20,137,45,45,137,22,2,56,22,138,54,137,
+16,253,224,14,16,2,34,16,2,0,253,248,15,228,225,20,1,159,1,175,1,174,1,106,
+21,223,221,15,253,248,15,170,198,254,249,255,0,255,0,164,0,0,7,0,180,0,0,
+4,168,6,102,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,33,35,17,51,1,33,53,33,17,
+33,53,33,53,33,53,33,37,33,53,33,17,33,53,33,53,33,53,33,2,246,144,144,254,
+231,254,215,1,41,254,215,1,41,254,215,1,41,2,203,254,215,1,41,254,215,1,41,
+254,215,1,41,6,102,253,246,129,253,25,129,178,129,178,129,253,25,129,178,
+129,0,0,2,0,135,0,0,5,39,6,123,0,3,0,21,0,0,37,35,17,51,1,26,2,51,50,18,18,
+19,35,10,2,35,34,2,2,3,3,23,144,144,253,112,22,184,251,133,142,253,180,19,
+145,22,152,186,89,91,193,145,17,205,3,141,251,166,1,136,3,39,1,204,254,56,
+252,198,254,135,1,101,2,223,1,168,254,58,253,31,254,187,0,1,0,135,0,0,3,135,
+6,102,0,15,0,0,1,33,17,35,17,33,53,33,17,33,53,33,21,33,17,33,3,135,254,199,
+144,254,201,1,55,254,201,3,0,254,199,1,57,4,92,251,164,4,92,129,1,8,129,129,
+254,248,0,3,0,135,0,0,5,80,6,113,0,16,0,32,0,76,0,0,1,34,6,21,17,20,7,7,51,
+62,5,53,16,1,20,30,4,23,51,38,53,17,52,38,35,34,5,54,51,50,22,21,20,6,6,7,
+6,6,21,35,52,38,39,46,2,53,52,54,51,50,23,55,38,53,52,54,51,50,23,7,39,38,
+35,34,6,6,21,20,7,4,14,106,115,8,4,8,17,73,90,95,79,50,252,86,50,78,94,89,
+73,17,8,14,112,105,178,2,14,88,145,152,170,67,127,189,91,87,101,87,91,178,
+138,69,170,152,152,77,8,20,134,150,81,108,23,60,58,48,62,57,22,20,4,82,125,
+113,254,109,93,105,52,42,77,81,90,109,133,84,1,19,254,237,84,133,108,90,81,
+78,42,147,103,1,147,114,124,14,143,209,190,108,179,150,139,67,124,69,68,121,
+65,126,158,185,113,189,210,143,4,50,99,213,191,23,127,11,10,47,112,116,99,
+50,0,2,0,227,0,0,4,170,6,102,0,11,0,15,0,0,51,17,33,17,35,17,33,17,35,17,
+33,17,17,33,17,33,227,3,199,137,254,233,143,254,248,2,174,253,82,6,102,249,
+154,4,92,251,164,4,92,251,164,4,221,1,8,0,0,1,0,135,255,236,4,12,6,123,0,
+42,0,0,19,52,54,54,55,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,14,
+6,21,20,22,51,50,54,55,23,6,6,35,34,38,135,72,131,158,174,119,67,139,119,
+117,157,56,125,55,242,154,187,218,62,101,130,135,129,101,62,146,140,112,169,
+63,127,76,243,158,207,217,1,133,88,147,129,103,114,111,125,76,112,136,139,
+160,39,180,209,205,172,88,139,115,95,88,87,97,113,71,138,142,171,179,49,209,
+221,209,0,0,2,0,113,255,236,4,223,6,127,0,23,0,35,0,0,1,6,7,18,18,19,7,38,
+2,53,52,54,55,39,6,7,0,2,17,35,16,18,0,1,1,35,17,51,21,33,53,51,17,35,53,
+33,4,162,158,82,2,156,143,135,114,177,14,19,8,33,29,254,237,243,153,198,1,
+170,1,113,254,237,114,201,253,239,197,119,1,108,6,12,117,67,254,179,253,63,
+254,219,53,212,2,249,157,81,70,27,4,42,29,254,247,253,189,254,135,1,81,2,
+40,1,245,1,17,252,20,253,238,129,129,2,18,129,0,2,0,135,0,0,4,68,6,123,0,
+24,0,36,0,0,1,50,54,53,52,35,55,50,22,21,20,7,22,22,21,20,6,35,39,50,54,53,
+52,38,39,37,35,3,35,19,35,53,33,21,35,19,35,3,78,40,42,80,29,85,105,96,60,
+61,121,94,29,55,51,58,50,254,213,64,200,148,219,98,2,8,100,221,154,5,63,53,
+42,92,129,99,75,107,80,20,101,59,90,115,129,57,36,43,53,4,10,251,35,4,221,
+129,129,251,35,0,0,2,0,113,0,0,4,16,6,117,0,31,0,43,0,0,1,54,51,51,21,35,
+34,39,17,35,17,6,6,35,35,53,51,50,23,55,38,38,53,52,54,51,50,22,21,20,6,7,
+3,34,6,21,20,22,51,50,54,54,53,52,2,139,100,117,172,166,119,104,143,22,121,
+60,192,196,48,153,4,77,87,116,114,105,128,89,75,71,48,53,58,45,27,48,27,3,
+236,20,129,16,252,113,3,145,6,12,129,18,6,34,169,135,166,137,166,131,137,
+181,28,2,14,100,101,124,156,69,127,84,201,0,0,5,0,227,0,0,4,111,6,102,0,21,
+0,27,0,31,0,35,0,39,0,0,33,33,34,46,2,53,17,51,17,22,22,21,20,6,7,21,20,22,
+22,51,33,1,52,38,39,17,54,1,33,53,33,17,33,53,33,17,33,53,33,4,111,254,14,
+146,140,84,40,138,157,168,178,147,46,111,115,1,242,253,176,95,83,178,2,80,
+254,133,1,123,254,133,1,123,254,133,1,123,47,108,177,133,4,149,254,193,14,
+167,141,138,185,17,192,144,135,57,3,100,81,101,11,254,108,26,1,175,129,254,
+76,129,254,76,129,0,0,1,0,90,0,0,4,242,6,131,0,30,0,0,1,33,17,35,17,33,53,
+33,17,52,18,55,35,6,6,7,1,39,1,51,1,7,1,38,39,35,22,22,21,17,33,4,14,254,
+224,144,254,238,1,18,13,6,9,14,48,48,254,207,111,2,35,82,2,35,111,254,209,
+78,39,8,9,14,1,32,2,35,253,221,2,35,129,1,92,146,1,20,39,44,126,68,254,82,
+80,3,2,252,254,80,1,170,108,134,69,255,137,254,164,0,0,3,0,68,0,0,6,18,6,
+102,0,7,0,21,0,35,0,0,1,33,17,35,17,33,53,33,3,20,22,51,50,54,53,51,6,6,35,
+34,38,53,33,20,22,51,50,54,53,51,6,6,35,34,38,53,5,25,254,100,143,254,96,
+3,203,150,68,67,60,65,139,3,126,135,132,148,252,227,68,67,60,65,139,3,126,
+135,132,148,5,229,250,27,5,229,129,254,250,106,113,115,104,178,168,181,165,
+106,113,115,104,178,168,181,165,0,0,4,0,90,255,236,4,41,6,117,0,37,0,41,0,
+45,0,49,0,0,19,22,21,7,6,21,20,22,22,51,33,21,33,22,23,19,7,3,38,39,35,6,
+6,3,39,19,54,55,46,2,53,52,55,54,53,52,39,1,35,17,51,1,35,17,51,1,35,17,51,
+229,54,3,18,30,69,79,2,113,254,244,25,22,176,141,181,23,3,109,2,21,180,143,
+174,24,21,125,128,64,10,10,49,2,197,144,144,1,10,143,143,253,235,143,143,
+6,117,115,96,46,115,17,58,63,27,129,74,98,252,211,22,3,65,116,58,21,141,252,
+179,22,3,55,105,57,2,57,118,98,23,60,60,33,86,98,254,135,1,15,254,241,1,15,
+254,241,1,15,0,3,0,135,0,0,5,211,6,123,0,30,0,56,0,64,0,0,1,17,35,17,38,38,
+53,52,54,51,50,22,22,23,5,22,23,22,22,51,50,55,14,2,7,6,6,35,34,39,3,39,17,
+5,23,50,54,55,51,54,55,34,38,39,38,38,39,22,23,6,35,34,38,38,39,55,1,20,22,
+23,38,38,35,34,2,55,143,147,142,56,65,120,127,62,2,1,80,51,140,76,84,28,98,
+111,38,35,40,57,25,82,65,45,109,209,219,1,160,119,37,37,8,88,31,16,49,105,
+99,62,85,83,23,67,91,53,23,36,23,8,94,253,250,79,77,2,55,62,37,2,213,253,
+43,4,160,28,171,147,63,66,71,157,137,32,6,71,39,30,6,161,100,45,11,62,63,
+8,1,203,20,254,201,39,8,24,29,57,66,25,56,35,31,7,47,21,86,27,48,54,25,1,
+92,65,80,25,117,98,0,3,0,135,0,0,5,131,6,123,0,74,0,95,0,99,0,0,19,52,62,
+2,53,52,38,35,55,22,22,21,20,14,2,21,20,51,50,54,55,17,38,38,53,52,54,54,
+51,50,22,22,21,20,6,7,17,22,22,51,50,53,52,46,2,53,52,54,55,23,34,6,21,20,
+30,2,21,20,6,35,34,38,39,21,33,17,6,6,35,34,38,37,51,17,51,17,54,54,53,52,
+38,38,35,34,6,6,21,20,22,23,17,51,19,53,35,21,209,17,21,17,56,73,17,126,113,
+23,27,22,72,37,89,30,121,156,137,255,135,133,249,136,163,122,35,82,29,71,
+29,34,29,112,128,16,71,58,24,28,24,99,81,43,85,20,254,29,30,90,38,81,99,1,
+215,217,133,63,78,99,172,103,105,178,100,76,57,133,217,217,1,102,51,67,49,
+41,26,28,29,119,12,88,82,41,67,57,47,20,43,29,20,1,248,38,199,124,114,197,
+123,122,194,118,126,200,41,254,8,21,22,43,20,47,57,67,41,86,86,10,119,28,
+29,26,41,49,67,51,70,81,24,19,250,1,0,21,28,82,125,3,190,254,119,31,141,74,
+91,139,75,77,138,90,74,140,24,1,129,251,37,166,166,0,0,6,0,135,0,0,7,129,
+6,121,0,7,0,15,0,23,0,49,0,73,0,81,0,0,1,35,19,33,19,35,53,33,5,35,19,33,
+19,35,53,33,1,33,2,2,39,35,7,7,1,34,6,21,20,51,7,34,38,53,52,54,55,38,38,
+53,52,54,51,23,34,6,21,20,22,23,37,50,54,53,52,35,55,50,22,21,20,7,22,21,
+20,6,35,39,50,54,53,52,38,39,1,33,2,2,39,35,7,7,2,223,147,227,253,88,225,
+145,2,8,4,82,147,227,253,88,225,145,2,8,249,254,1,86,79,81,6,8,23,28,3,65,
+35,34,67,24,74,88,44,38,51,52,101,82,24,48,42,50,42,254,60,34,35,67,24,74,
+88,82,92,100,82,24,46,44,42,40,2,96,1,86,79,81,6,8,23,28,4,221,251,35,4,221,
+129,129,251,35,4,221,129,251,35,2,5,2,13,99,185,206,1,139,45,35,78,110,82,
+65,56,90,20,17,87,50,76,108,121,47,31,36,46,2,4,45,35,78,121,93,65,92,66,
+47,114,76,98,110,47,31,38,44,2,251,131,2,5,2,13,99,185,206,0,1,0,158,0,0,
+5,197,6,102,0,65,0,0,1,54,54,55,17,51,3,51,3,51,17,51,3,51,17,33,34,6,7,6,
+6,7,22,23,18,21,35,52,2,39,38,38,39,35,6,7,6,2,21,35,52,19,54,55,38,39,46,
+3,35,33,17,51,3,51,3,51,3,51,3,51,17,22,22,23,3,55,10,49,74,129,10,90,10,
+129,76,10,127,254,225,54,72,30,37,78,45,39,52,249,157,100,76,18,39,7,8,12,
+36,67,127,147,248,45,47,51,37,32,68,36,54,38,254,226,127,11,88,10,127,10,
+92,10,127,93,37,7,3,168,46,124,145,1,131,254,205,1,51,254,205,1,51,254,93,
+40,61,75,158,66,47,113,253,223,114,62,1,30,166,39,106,25,52,78,144,254,164,
+62,122,2,25,103,57,68,76,64,134,39,19,1,163,254,205,1,51,254,205,1,51,254,
+125,190,91,34,0,1,0,113,0,0,5,152,6,113,0,75,0,0,1,20,7,51,19,54,55,39,55,
+23,52,54,19,23,3,6,7,23,7,39,6,6,7,7,51,21,33,22,21,17,35,17,52,55,33,53,
+51,39,38,38,39,7,39,55,38,38,3,55,22,22,23,55,23,7,22,23,23,51,38,53,17,52,
+55,35,53,51,38,53,51,20,7,51,21,35,22,21,3,72,11,177,41,8,24,168,17,170,7,
+52,141,43,17,15,209,17,217,2,2,6,37,104,254,86,11,144,9,254,90,104,37,6,3,
+3,209,16,202,8,16,51,141,25,29,5,176,17,176,24,11,38,175,9,9,199,196,4,142,
+6,188,193,11,3,100,117,75,1,0,50,95,23,129,23,27,74,1,86,23,254,232,108,46,
+27,129,27,31,76,41,239,129,60,53,254,78,1,172,67,52,129,237,41,76,31,27,129,
+25,27,80,1,75,23,167,188,90,23,129,23,83,62,254,72,120,1,152,66,49,129,36,
+82,64,54,129,60,49,0,0,2,0,227,0,0,4,221,6,102,0,19,0,38,0,0,1,50,30,2,23,
+22,22,51,50,54,55,62,2,51,51,17,33,17,1,17,35,34,6,7,14,2,35,34,38,38,39,
+38,38,35,35,17,1,150,51,68,44,30,22,15,47,38,37,54,20,42,56,81,56,178,252,
+6,3,113,21,35,49,21,39,64,95,63,70,99,56,23,15,42,33,18,6,102,54,88,126,152,
+100,94,94,100,209,139,72,249,154,6,102,250,27,5,100,94,100,194,149,77,90,
+171,159,101,93,250,156,0,0,1,0,68,255,236,4,156,6,123,0,69,0,0,1,33,22,23,
+30,2,21,20,7,3,39,19,54,53,52,38,39,38,38,39,33,22,23,30,2,21,20,7,3,39,19,
+54,53,52,38,39,38,38,39,35,53,51,54,54,55,54,54,55,23,6,7,6,6,7,33,54,54,
+55,54,54,55,23,6,7,6,6,7,33,4,156,254,98,17,76,81,66,38,26,176,131,174,18,
+51,58,61,70,14,254,219,14,76,87,61,37,27,176,131,174,18,55,60,63,68,7,168,
+168,13,77,66,71,82,18,119,38,125,86,61,16,1,37,13,77,66,69,84,19,119,38,125,
+86,61,16,1,154,4,92,29,44,47,58,70,43,80,98,253,101,20,2,166,73,50,51,69,
+31,31,78,55,26,44,52,57,69,43,76,102,253,101,20,2,166,73,50,51,74,33,33,75,
+49,129,49,96,56,59,101,53,68,111,91,63,52,29,49,96,56,58,101,54,68,111,91,
+63,52,29,0,0,8,0,250,0,0,5,14,6,131,0,46,0,58,0,62,0,66,0,70,0,74,0,78,0,
+82,0,0,1,6,21,20,23,22,21,20,6,6,7,22,22,21,17,35,17,52,55,38,38,53,52,55,
+54,53,52,39,55,22,21,20,7,6,21,20,22,51,50,54,53,52,39,38,53,52,55,1,35,6,
+7,7,39,19,51,19,7,39,38,3,33,53,33,53,33,53,33,5,33,53,33,17,33,53,33,17,
+33,53,33,5,33,53,33,4,248,35,29,28,118,214,135,3,10,144,11,209,248,30,29,
+35,140,39,30,30,190,185,187,196,28,29,36,254,146,8,14,56,45,123,180,127,181,
+121,45,67,214,254,215,1,41,254,215,1,41,2,203,254,215,1,41,254,215,1,41,254,
+215,1,41,253,53,254,215,1,41,6,84,48,44,41,84,84,49,117,180,106,9,23,60,42,
+253,35,2,215,62,69,15,223,174,55,77,77,45,42,52,49,46,83,41,87,87,53,138,
+147,149,136,47,89,88,44,79,42,254,211,99,106,88,59,1,82,254,174,63,88,149,
+251,115,129,137,129,129,129,254,117,129,1,148,129,129,129,0,1,0,135,255,236,
+5,80,6,102,0,70,0,0,1,52,38,39,38,38,53,52,55,23,6,21,20,22,23,22,22,21,20,
+6,4,7,36,0,53,52,54,55,54,54,53,52,39,55,22,21,20,6,7,6,6,21,20,22,22,23,
+22,22,23,55,38,53,17,35,53,51,17,51,17,51,21,35,17,20,7,23,54,55,62,2,4,193,
+46,69,71,54,74,100,35,32,34,93,85,137,254,228,191,254,232,254,179,84,94,34,
+32,35,100,74,53,72,69,45,66,112,69,60,79,15,6,12,209,209,143,211,211,12,6,
+64,94,67,113,68,2,53,83,72,21,24,64,43,74,105,60,62,32,20,19,12,32,127,118,
+129,227,184,49,75,1,52,206,117,127,33,12,19,20,32,62,60,105,74,43,64,24,21,
+73,82,84,140,110,30,26,59,22,2,96,127,3,29,129,1,137,254,119,129,252,232,
+134,96,4,71,40,29,108,142,0,7,0,180,0,0,5,80,6,102,0,12,0,33,0,37,0,41,0,
+45,0,49,0,53,0,0,33,38,39,6,6,7,35,16,2,3,33,2,17,39,38,53,52,18,55,33,22,
+18,18,21,20,7,23,54,54,55,51,22,22,23,1,35,17,51,1,35,17,51,3,35,17,51,3,
+35,17,51,19,35,17,51,3,250,80,178,60,137,41,137,108,97,4,156,205,104,15,117,
+39,252,180,19,80,53,13,7,26,159,56,74,45,158,32,254,74,127,127,1,195,127,
+127,226,126,126,112,127,127,225,127,127,148,200,67,197,84,1,46,3,95,1,217,
+251,221,253,189,145,68,106,144,3,91,187,90,253,234,254,33,82,91,88,4,68,243,
+58,47,246,74,3,168,1,43,254,213,1,43,254,213,1,43,253,27,1,43,254,213,1,43,
+0,0,2,0,227,0,0,3,188,6,102,0,14,0,30,0,0,19,51,32,4,21,20,6,7,22,22,21,20,
+6,4,35,1,52,38,39,17,62,2,53,52,38,38,35,53,54,54,227,99,1,28,1,60,125,121,
+143,133,180,254,165,202,2,43,223,188,122,205,115,100,173,100,160,182,6,102,
+231,211,114,172,52,48,191,138,136,218,127,4,172,144,170,6,250,147,10,97,154,
+93,89,138,74,129,3,150,0,5,0,68,0,0,5,244,6,131,0,22,0,40,0,44,0,48,0,52,
+0,0,1,1,7,39,6,2,21,35,39,38,39,35,6,6,7,7,35,52,2,39,7,39,1,1,22,18,21,19,
+51,19,52,18,18,55,1,38,38,39,6,6,7,1,33,53,33,53,33,53,33,39,33,53,33,3,63,
+2,181,111,90,71,136,121,98,90,25,8,13,47,46,107,125,120,54,84,110,2,170,254,
+124,53,134,196,86,195,85,92,22,254,180,50,50,2,2,51,54,1,88,254,51,1,205,
+254,51,1,205,61,254,174,1,82,6,131,252,62,80,125,191,254,18,65,117,106,99,
+48,88,57,129,74,1,247,166,118,80,3,194,252,242,138,254,1,68,1,6,254,240,42,
+1,73,1,40,58,1,204,66,89,5,2,86,76,252,228,129,116,130,120,129,0,2,0,113,
+0,0,4,53,6,102,0,52,0,66,0,0,1,22,23,23,7,39,35,17,35,17,33,53,33,53,38,38,
+53,52,55,3,55,23,22,21,54,55,38,53,53,51,21,20,7,22,23,54,54,55,23,3,22,22,
+21,20,6,7,21,51,55,23,7,6,7,3,34,6,21,20,22,22,51,50,54,54,53,52,38,3,59,
+114,89,47,88,215,123,143,254,117,1,139,95,104,53,100,121,41,22,32,50,14,119,
+17,47,31,1,18,47,121,101,35,39,105,98,121,217,88,47,101,102,249,59,68,39,
+63,27,26,63,40,69,2,92,41,94,49,98,225,253,221,2,35,129,123,47,153,84,130,
+79,1,41,37,141,85,40,14,6,56,43,159,159,29,68,9,13,18,94,154,37,254,223,31,
+117,62,88,155,50,121,227,98,49,106,36,2,150,102,91,50,91,57,57,90,49,94,101,
+0,0,3,0,158,0,0,4,61,6,117,0,37,0,46,0,58,0,0,1,46,2,53,16,51,50,22,21,20,
+6,7,23,55,54,51,51,21,35,34,39,7,22,18,19,33,18,55,39,6,35,35,53,51,50,22,
+23,23,34,6,2,7,33,2,38,38,3,34,6,21,20,22,51,50,54,54,53,52,2,47,48,85,47,
+246,107,142,101,81,6,30,95,90,172,165,132,96,6,60,108,82,253,137,113,135,
+4,104,95,192,196,75,103,23,63,19,44,64,28,1,51,82,34,24,7,48,53,58,45,27,
+48,27,3,240,26,106,133,77,1,47,170,127,114,192,49,10,8,25,129,16,10,54,254,
+135,254,42,3,27,106,10,16,129,20,5,217,148,254,180,173,1,183,153,61,2,242,
+100,101,124,156,69,127,84,201,0,0,2,0,68,0,0,6,41,6,104,0,11,0,27,0,0,19,
+39,1,51,1,7,39,38,39,35,6,7,1,35,17,51,50,23,22,22,23,7,38,38,39,38,38,35,
+166,98,1,96,100,1,96,98,199,69,33,8,31,76,2,177,144,144,217,113,75,75,50,
+41,84,115,48,47,111,84,4,201,106,1,53,254,203,106,178,61,58,55,68,250,137,
+6,102,186,125,81,11,121,17,107,96,92,83,0,0,3,0,113,255,236,3,199,6,131,0,
+25,0,35,0,45,0,0,1,20,6,7,22,22,23,7,38,2,39,38,38,53,52,54,55,54,54,55,23,
+6,6,7,22,22,5,20,23,54,54,53,52,38,39,6,5,20,22,23,38,53,52,55,6,6,3,86,148,
+124,50,196,118,72,141,224,60,144,192,195,149,63,236,155,56,137,189,51,118,
+146,254,186,23,70,96,91,71,27,254,232,99,79,20,26,75,109,3,86,119,180,35,
+145,226,55,114,66,1,24,182,11,194,141,142,194,12,177,240,48,123,45,186,125,
+33,182,139,107,100,8,126,93,92,127,6,128,97,95,126,8,109,100,121,126,4,129,
+0,5,0,207,255,236,5,168,6,143,0,9,0,18,0,28,0,36,0,72,0,0,1,38,39,6,7,22,
+22,51,50,54,3,23,22,23,54,53,52,39,6,39,22,23,54,55,38,38,35,34,6,3,20,23,
+54,55,38,39,6,37,22,21,20,7,18,19,7,2,3,6,35,34,39,2,3,39,18,19,38,53,52,
+55,38,39,55,22,23,54,51,50,23,54,55,23,6,3,221,69,93,86,73,17,94,50,49,92,
+79,41,102,31,43,47,145,252,41,122,46,116,31,95,34,42,91,143,39,39,133,17,
+153,41,2,86,96,114,200,115,133,123,162,97,106,110,92,170,115,133,119,198,
+108,90,102,173,101,163,101,113,118,116,116,104,160,100,127,2,219,112,126,
+116,122,19,26,26,1,91,53,131,46,88,125,102,99,153,249,43,151,64,130,27,29,
+30,254,189,123,85,55,170,20,162,89,175,128,157,166,149,254,173,254,161,57,
+1,112,1,33,72,74,254,209,254,156,57,1,107,1,77,154,155,137,144,100,156,98,
+143,107,91,88,109,140,98,109,0,0,4,0,199,0,0,6,233,6,123,0,15,0,31,0,47,0,
+70,0,0,33,53,51,17,35,53,51,17,51,17,51,21,35,17,51,21,1,23,7,39,3,23,7,37,
+55,23,19,39,55,23,19,23,37,19,55,23,7,19,55,23,5,39,55,3,7,39,55,3,3,34,6,
+7,35,38,35,34,6,7,39,18,33,50,22,23,54,51,32,19,7,38,38,3,59,95,95,95,143,
+92,92,92,253,133,88,16,92,45,86,13,254,181,16,96,49,94,17,98,121,135,3,80,
+114,95,14,88,45,92,12,254,185,12,96,45,101,14,96,110,56,101,111,15,151,28,
+200,85,116,34,133,107,1,5,109,160,34,73,230,1,6,107,133,33,117,123,1,27,122,
+2,205,253,51,122,254,229,123,2,25,9,120,8,254,225,8,121,33,123,11,1,29,10,
+123,10,2,195,15,21,253,55,10,123,10,254,227,11,123,33,121,10,1,31,10,120,
+11,2,194,1,29,84,90,174,88,96,40,1,17,86,88,174,254,239,40,96,88,0,0,5,0,
+227,0,0,4,188,6,102,0,3,0,7,0,11,0,15,0,19,0,0,33,35,17,51,1,33,53,33,17,
+33,53,33,53,33,53,33,1,35,17,51,4,188,143,143,254,209,254,133,1,123,254,133,
+1,123,254,133,1,123,253,230,144,144,6,102,253,246,129,253,25,129,178,129,
+252,86,6,102,0,4,0,227,0,0,6,221,6,102,0,43,0,47,0,51,0,67,0,0,1,50,22,23,
+22,22,51,53,51,17,33,17,51,17,33,17,34,38,38,39,46,2,35,53,50,22,23,22,22,
+51,53,51,17,33,17,34,38,38,39,46,2,35,1,17,33,17,33,33,17,33,1,50,22,23,22,
+22,51,21,34,38,38,39,46,2,35,2,225,110,156,54,66,73,51,137,251,123,144,1,
+110,62,90,68,46,52,59,79,54,110,156,54,66,73,51,144,1,110,62,90,68,46,52,
+59,79,54,1,254,254,146,254,2,1,110,254,146,3,108,110,156,54,66,73,51,62,90,
+68,46,52,59,79,54,6,102,99,97,122,75,189,250,102,5,154,253,6,1,186,39,70,
+88,95,64,37,131,99,97,122,75,189,253,6,1,186,39,70,88,95,64,37,250,158,1,
+158,254,98,1,158,4,71,99,97,122,75,131,39,70,88,95,64,37,0,5,0,227,0,0,6,
+127,6,102,0,18,0,26,0,34,0,50,0,67,0,0,1,33,53,51,63,2,39,39,35,53,33,21,
+35,7,7,23,23,51,1,17,33,53,33,17,33,53,33,21,33,17,33,21,33,17,1,50,23,55,
+38,38,39,35,14,3,7,23,54,51,19,34,39,7,22,23,22,23,51,54,55,54,54,55,39,6,
+35,5,92,252,152,59,217,46,26,48,231,69,3,104,72,206,74,78,211,63,1,35,254,
+100,1,13,254,243,253,156,254,244,1,12,254,100,3,54,77,21,4,41,156,18,8,8,
+28,30,109,36,4,20,78,2,71,23,2,33,92,50,30,8,36,36,86,32,15,2,23,71,1,139,
+129,234,44,23,43,248,129,129,221,70,73,228,4,90,249,154,129,5,100,129,129,
+250,156,129,6,102,251,166,4,6,28,158,56,20,50,40,107,25,6,4,2,80,4,6,15,98,
+54,60,72,36,86,26,7,6,4,0,0,8,0,23,255,236,6,225,6,125,0,3,0,7,0,11,0,15,
+0,19,0,23,0,37,0,50,0,0,1,1,39,9,2,39,1,39,1,39,9,2,39,9,2,39,1,39,1,39,1,
+1,20,18,4,51,50,54,53,52,2,36,35,34,6,7,16,33,50,0,0,21,20,6,35,34,0,0,1,
+125,254,246,92,1,12,2,14,254,244,92,1,12,127,254,246,92,1,12,3,51,254,244,
+92,1,12,2,14,254,244,90,1,10,125,254,244,90,1,10,252,43,232,1,85,132,61,80,
+232,254,171,132,62,79,143,1,28,174,1,148,1,14,156,128,175,254,109,254,242,
+2,168,254,246,90,1,12,253,242,254,246,90,1,12,125,254,246,90,1,12,3,248,254,
+244,92,1,10,253,244,254,243,93,1,10,127,254,243,93,1,10,254,174,137,254,169,
+237,84,70,137,1,87,237,87,67,1,29,254,237,254,106,167,130,155,1,17,1,149,
+0,3,0,113,255,233,4,193,6,125,0,27,0,51,0,75,0,0,19,4,22,22,21,20,6,7,4,17,
+16,5,39,62,2,53,52,38,38,35,53,54,54,53,52,38,37,1,38,38,53,52,55,54,54,53,
+52,38,39,55,22,22,21,20,7,6,6,21,20,22,23,3,38,38,53,52,55,54,54,53,52,38,
+39,55,22,22,21,20,7,6,6,21,20,22,23,160,1,10,223,111,125,121,1,21,253,118,
+28,235,197,102,100,173,100,160,182,207,254,232,4,37,149,140,84,51,33,83,91,
+33,163,113,83,47,36,91,88,27,148,141,84,51,33,83,91,33,163,113,83,39,44,91,
+88,6,123,66,115,162,120,114,172,52,92,254,227,254,140,132,138,49,91,131,95,
+89,138,74,129,3,150,132,127,148,55,254,51,5,72,79,70,76,46,38,13,31,34,9,
+123,25,77,74,67,68,39,41,17,31,26,8,253,31,5,72,78,71,76,46,38,13,31,33,10,
+123,25,77,75,68,66,31,48,18,31,27,8,0,0,3,0,135,0,0,5,115,6,123,0,11,0,15,
+0,56,0,0,1,33,50,22,21,17,35,17,52,38,35,33,19,51,17,35,5,39,55,54,54,51,
+53,34,38,39,55,23,33,55,23,6,6,35,21,50,23,23,7,39,35,17,50,22,22,21,17,35,
+17,52,38,35,33,53,33,17,35,2,57,1,119,117,88,137,27,41,254,137,133,144,144,
+254,58,88,47,65,97,41,42,102,106,88,217,2,113,217,88,106,103,41,74,129,47,
+88,215,113,177,164,75,138,123,149,252,174,1,178,106,2,0,95,124,254,219,1,
+37,43,47,1,119,2,33,226,99,49,68,67,10,78,113,98,227,227,98,113,78,10,135,
+49,99,226,253,223,88,201,176,254,219,1,37,182,154,129,2,33,0,3,0,227,0,0,
+7,86,6,102,0,8,0,15,0,23,0,0,1,1,33,17,51,17,1,33,55,1,33,1,39,6,35,33,37,
+7,17,51,17,39,38,39,7,86,253,252,251,145,138,1,16,4,4,121,251,219,2,63,1,
+5,7,36,138,253,113,254,158,6,217,140,32,28,2,82,253,174,6,102,252,203,254,
+240,141,253,211,1,43,6,18,239,2,253,244,1,31,139,32,51,0,3,0,68,255,240,5,
+233,6,102,0,25,0,30,0,35,0,0,1,33,17,33,53,33,21,33,17,33,17,22,23,7,38,36,
+2,39,35,6,2,4,7,39,54,55,1,22,18,23,17,1,54,18,55,33,1,10,1,197,254,221,2,
+215,254,219,1,207,63,125,36,150,254,183,203,4,9,5,189,254,185,157,36,112,
+86,2,88,17,162,137,252,245,133,160,17,254,202,4,16,1,213,129,129,254,43,252,
+158,30,21,139,24,222,1,45,149,148,254,215,226,25,139,19,40,2,217,211,254,
+178,106,2,139,253,129,108,1,74,201,0,0,1,0,158,0,0,4,61,6,96,0,34,0,0,33,
+54,18,18,55,39,6,6,35,35,53,33,17,51,17,33,21,35,34,38,39,7,22,22,18,19,35,
+38,2,2,35,34,2,2,7,1,8,14,124,106,51,4,28,130,51,188,1,135,143,1,137,159,
+72,139,27,6,48,85,138,24,141,22,93,83,20,25,98,79,15,158,2,99,1,68,29,11,
+6,11,129,1,131,254,125,129,11,6,11,26,219,253,174,254,229,204,1,239,1,49,
+254,120,254,45,145,0,0,5,0,158,0,0,4,61,6,123,0,23,0,32,0,46,0,50,0,54,0,
+0,1,6,6,35,35,53,33,21,35,34,38,39,7,22,18,18,23,23,33,55,54,18,18,55,23,
+34,2,2,7,33,38,2,2,19,34,6,21,20,22,51,7,34,38,53,52,54,51,1,51,21,35,37,
+51,21,35,2,55,28,131,48,202,3,159,165,72,139,27,6,52,142,148,18,15,252,166,
+10,22,146,144,56,52,24,103,112,28,2,11,35,107,94,88,65,88,90,63,4,119,149,
+150,118,254,29,127,127,2,125,127,127,4,109,6,11,129,129,11,6,11,38,254,172,
+253,212,172,16,12,171,2,39,1,95,37,118,254,240,254,78,169,205,1,154,1,4,2,
+32,39,34,34,42,109,102,83,83,101,253,133,145,145,145,0,3,0,121,0,0,8,47,7,
+106,0,116,0,128,0,142,0,0,19,54,54,55,39,38,53,52,55,23,6,21,20,23,23,54,
+55,23,6,21,20,23,23,54,55,55,54,53,52,39,55,22,23,55,54,53,52,39,55,22,23,
+55,54,53,52,39,55,22,22,21,20,6,7,7,54,51,50,22,22,23,22,23,30,2,21,20,6,
+35,34,7,6,35,34,39,22,18,23,35,38,2,39,55,22,22,51,50,55,54,55,62,2,53,52,
+38,39,38,39,38,39,38,38,35,34,4,2,3,33,23,33,54,18,55,35,34,38,37,52,54,51,
+50,22,21,20,6,35,34,38,37,52,38,35,34,7,22,22,51,50,63,3,199,24,136,59,221,
+76,117,118,88,41,58,26,31,119,56,15,145,37,31,30,11,51,116,43,10,37,27,51,
+117,45,12,59,58,101,119,65,60,40,50,180,48,50,80,130,114,122,110,69,148,116,
+57,192,185,59,132,132,49,133,121,46,54,4,127,14,63,77,68,53,194,103,63,108,
+120,76,131,90,51,86,102,54,57,43,91,119,175,96,202,254,195,199,28,1,129,60,
+253,182,9,83,74,14,90,125,3,98,54,42,42,57,59,40,40,56,253,233,55,53,61,54,
+15,67,41,39,33,12,14,2,4,66,21,41,3,207,69,107,115,133,62,88,92,67,41,60,
+80,57,57,69,68,31,33,129,35,21,28,27,29,67,66,59,86,49,33,34,52,70,65,57,
+85,60,55,49,66,75,103,61,55,125,51,60,88,44,162,6,32,54,83,76,21,47,67,87,
+59,129,121,40,40,51,164,254,240,78,142,1,1,232,61,42,60,31,35,6,10,25,44,
+37,51,67,30,15,22,15,67,85,62,249,254,30,254,180,129,221,1,158,166,174,47,
+40,58,56,42,41,55,56,24,21,24,27,49,60,29,22,19,10,0,0,4,0,158,0,0,9,154,
+6,143,0,6,0,17,0,28,0,181,0,0,1,22,23,6,35,34,39,19,52,38,39,6,21,20,22,51,
+50,54,5,52,38,39,6,21,20,22,51,50,54,1,22,23,22,51,50,54,55,22,22,23,54,54,
+53,52,38,36,38,38,35,34,14,3,2,7,33,23,33,52,55,6,35,54,53,52,38,39,38,53,
+52,54,51,50,23,6,21,20,30,2,23,55,6,35,54,53,52,38,39,38,53,52,54,51,50,23,
+6,21,20,22,23,23,55,35,54,54,53,52,38,39,38,38,53,52,54,51,50,23,6,21,20,
+30,2,23,54,55,38,38,53,52,55,30,2,21,7,54,55,38,53,52,55,30,2,21,20,6,7,22,
+4,0,0,21,20,6,6,35,34,39,6,35,34,38,39,6,35,35,34,38,39,7,18,23,35,38,2,53,
+52,54,5,160,19,122,87,62,86,46,23,91,58,25,62,46,29,37,254,107,89,61,23,60,
+49,34,30,1,116,8,37,113,192,29,45,148,176,110,50,41,81,214,254,226,235,203,
+69,134,165,139,117,96,113,43,2,143,60,252,157,35,41,55,59,43,54,97,66,55,
+35,55,74,30,44,52,21,15,19,35,60,47,50,98,66,55,35,55,73,40,40,42,15,33,28,
+31,36,60,49,47,66,55,34,56,74,29,43,50,21,61,75,74,84,104,49,153,87,2,22,
+48,56,105,49,153,87,24,11,111,1,42,1,104,1,34,61,93,40,20,18,39,47,43,158,
+122,65,80,62,110,105,25,6,88,96,151,86,122,55,4,104,62,42,82,139,1,62,37,
+100,20,35,48,56,71,30,57,34,103,21,42,44,53,72,36,254,109,147,160,62,2,19,
+117,64,22,14,80,25,20,230,253,169,98,38,83,144,208,254,101,224,129,36,173,
+12,104,41,18,36,30,54,61,54,73,21,66,32,15,26,27,29,18,58,3,109,37,18,38,
+28,54,63,51,74,21,66,32,16,34,21,26,41,45,71,30,17,33,35,28,53,32,54,73,20,
+66,32,15,26,26,27,17,97,67,8,95,83,135,86,5,98,112,49,12,6,8,49,72,135,86,
+5,98,112,49,17,33,15,25,175,254,211,254,200,39,57,108,67,10,30,82,80,13,42,
+44,2,254,219,186,169,1,154,130,88,102,0,5,0,135,0,0,8,190,6,143,0,105,0,115,
+0,123,0,134,0,145,0,0,1,6,35,34,38,38,53,52,55,22,51,50,55,22,22,23,54,54,
+53,52,38,36,38,38,35,34,14,3,2,7,33,2,53,52,55,6,21,20,18,23,33,52,18,19,
+35,54,54,53,52,38,39,38,38,53,52,54,51,50,23,6,21,20,30,2,23,54,55,38,38,
+53,52,55,30,2,21,7,54,55,38,53,52,55,30,2,21,20,7,22,4,0,0,21,20,6,35,34,
+39,6,35,34,38,1,22,18,23,35,38,2,53,52,54,55,38,38,39,54,51,50,23,1,52,38,
+39,6,21,20,22,51,50,54,5,52,38,39,6,21,20,22,51,50,54,6,61,30,78,57,117,72,
+14,122,134,81,48,79,160,97,43,80,214,254,226,235,203,69,135,165,138,117,97,
+113,42,1,53,78,123,5,74,66,253,127,110,79,33,28,31,36,60,49,47,66,55,34,56,
+74,29,43,50,21,60,75,72,85,104,49,153,87,2,22,48,56,105,48,152,88,24,112,
+1,45,1,95,1,28,126,68,20,17,41,45,41,148,253,107,13,132,113,151,90,118,55,
+198,14,70,58,86,64,85,46,254,254,92,58,24,61,47,26,40,254,106,89,60,23,58,
+51,23,40,1,152,5,37,66,47,38,38,82,4,51,107,45,15,79,25,20,230,253,169,98,
+38,83,144,208,254,99,222,1,100,158,215,41,62,67,197,254,116,177,55,1,207,
+1,12,45,71,30,17,33,35,28,53,32,54,73,20,66,32,15,26,26,27,17,95,69,8,94,
+84,135,86,5,98,112,49,12,6,8,49,72,135,86,5,98,112,49,32,33,28,181,254,216,
+254,203,38,83,149,10,30,75,2,66,204,254,37,220,177,1,147,129,88,102,43,38,
+47,20,81,139,1,154,35,102,20,36,47,55,68,27,58,36,101,21,42,44,51,70,30,0,
+0,4,0,135,0,0,9,186,6,143,0,6,0,17,0,28,0,150,0,0,1,22,23,6,35,34,39,19,52,
+38,39,6,21,20,22,51,50,54,5,52,38,39,6,21,20,22,51,50,54,1,22,22,23,54,54,
+53,52,38,36,38,38,35,34,6,2,7,5,7,37,7,5,7,37,6,21,35,52,55,37,55,5,54,55,
+37,55,5,55,35,54,54,53,52,38,39,38,38,53,52,54,51,50,23,6,21,20,30,2,23,54,
+55,38,38,53,52,55,30,2,21,7,54,55,38,53,52,55,30,2,21,20,6,7,22,4,0,0,21,
+20,6,35,34,39,6,35,34,38,39,6,35,35,34,38,39,7,18,23,35,38,2,53,52,54,51,
+22,23,22,51,50,54,5,193,19,122,87,63,85,46,23,92,58,24,61,47,21,45,254,106,
+89,60,23,58,51,17,46,3,176,79,160,97,43,80,214,254,226,235,203,69,203,244,
+172,59,1,53,33,254,201,43,1,53,33,254,207,41,133,49,254,211,35,1,41,23,22,
+254,215,33,1,43,28,32,28,31,36,60,49,47,63,57,35,56,74,29,43,50,21,60,75,
+72,85,104,49,153,87,2,20,49,55,105,48,152,88,23,11,108,1,45,1,98,1,39,126,
+68,20,17,41,45,41,148,135,62,82,63,109,106,24,6,88,96,151,90,118,55,46,8,
+37,113,192,31,46,4,104,62,42,82,139,1,62,35,102,20,36,47,55,68,30,61,36,101,
+21,42,44,51,70,33,253,16,51,107,45,15,79,25,20,230,253,169,98,121,254,255,
+197,84,125,84,172,84,125,82,198,40,51,221,78,125,78,100,72,78,125,78,92,45,
+71,30,17,33,35,28,53,32,53,74,20,66,32,15,26,26,27,17,95,69,8,94,84,135,86,
+5,98,112,49,12,6,8,50,71,135,86,5,98,112,49,17,33,15,22,178,254,218,254,193,
+39,83,149,10,30,75,87,13,43,43,2,254,219,186,177,1,147,129,88,102,147,160,
+62,3,0,0,2,0,68,0,0,5,158,6,96,0,18,0,49,0,0,33,26,2,54,51,50,22,18,19,35,
+38,2,2,35,34,2,2,7,1,20,22,51,50,55,54,54,51,50,22,23,23,7,39,38,38,35,34,
+14,2,35,34,38,38,53,35,53,33,21,2,94,33,90,81,89,64,86,118,118,36,141,20,
+89,86,22,28,85,83,24,254,107,81,91,106,132,65,100,41,70,122,68,125,94,100,
+62,81,48,40,99,112,123,64,122,136,63,127,5,90,1,2,1,248,1,18,119,248,253,
+168,254,205,190,1,249,1,61,254,215,254,33,236,5,223,128,128,80,40,40,52,59,
+104,96,90,53,39,50,60,50,84,172,129,129,129,0,0,2,0,68,0,0,5,158,6,96,0,30,
+0,50,0,0,1,20,22,51,50,55,54,54,51,50,22,23,23,7,39,38,38,35,34,14,2,35,34,
+38,38,53,35,53,33,21,3,33,17,35,17,33,53,33,53,33,53,33,53,51,21,33,21,33,
+21,33,1,82,81,91,106,132,65,100,41,70,122,68,125,94,100,62,81,48,40,99,112,
+123,64,122,136,63,127,5,90,142,254,250,143,254,252,1,4,254,252,1,4,143,1,
+6,254,250,1,6,5,223,128,128,80,40,40,52,59,104,96,90,53,39,50,60,50,84,172,
+129,129,129,251,238,254,51,1,205,129,178,129,219,219,129,178,0,0,3,0,68,0,
+0,6,41,6,104,0,11,0,29,0,42,0,0,19,39,1,51,1,7,39,38,39,39,6,7,1,54,18,18,
+54,51,50,22,22,18,23,35,2,2,35,34,2,3,19,50,23,22,22,23,7,38,38,39,38,38,
+35,166,98,1,96,100,1,96,98,199,74,26,6,26,85,1,43,18,67,114,93,65,52,72,64,
+142,28,141,32,152,33,39,135,45,252,217,113,75,75,50,41,84,115,48,47,111,84,
+4,201,106,1,53,254,203,106,178,69,47,9,52,77,250,137,139,1,166,2,78,209,103,
+232,252,239,240,1,67,3,126,253,2,254,61,6,102,186,125,81,11,121,17,107,96,
+92,83,0,2,0,68,0,0,6,41,6,104,0,31,0,43,0,0,1,51,21,35,21,51,21,35,17,35,
+17,35,53,51,53,35,53,51,17,51,50,23,22,22,23,7,38,38,39,38,38,35,1,39,1,51,
+1,7,39,38,39,39,6,7,4,23,249,249,249,249,144,252,252,252,252,144,217,113,
+75,75,50,41,84,115,48,47,111,84,252,143,98,1,96,100,1,96,98,199,74,26,6,26,
+85,3,129,129,178,129,254,51,1,205,129,178,129,2,229,186,125,81,11,121,17,
+107,96,92,83,254,228,106,1,53,254,203,106,178,69,47,9,52,77,0,0,3,0,156,0,
+0,5,231,6,123,0,49,0,77,0,85,0,0,1,7,30,4,23,35,38,2,38,35,34,3,35,54,18,
+54,54,55,17,38,38,53,52,54,51,50,22,22,23,5,22,23,22,51,50,55,14,2,7,6,6,
+35,34,39,39,38,19,39,17,5,23,50,54,55,51,54,55,39,39,46,3,39,39,22,23,6,35,
+34,38,38,39,55,1,20,22,23,38,38,35,34,2,70,2,59,72,47,57,45,10,139,20,71,
+84,42,121,98,133,17,88,61,80,36,146,142,55,65,121,125,59,1,1,86,53,137,134,
+55,97,111,32,39,40,59,25,82,65,46,107,205,127,123,225,1,166,118,37,37,8,86,
+29,18,16,61,49,83,83,91,55,43,22,68,91,52,23,36,23,8,94,253,250,78,77,2,53,
+63,37,2,240,7,24,61,87,211,244,118,203,1,37,151,253,121,134,1,106,148,110,
+18,1,156,29,170,147,63,66,72,158,135,32,6,71,69,6,140,118,48,11,62,63,8,19,
+12,1,172,20,254,201,39,8,24,29,49,74,1,7,8,41,47,40,6,4,47,21,86,27,48,54,
+25,1,92,65,80,25,115,100,0,0,3,0,135,0,0,5,211,6,123,0,46,0,72,0,80,0,0,1,
+21,33,21,33,21,33,21,33,21,35,53,35,53,51,53,35,53,51,17,38,38,53,52,54,51,
+50,22,22,23,5,22,23,22,22,51,50,55,14,2,7,6,6,35,34,39,37,5,23,50,54,55,51,
+54,55,34,38,39,38,38,39,22,23,6,35,34,38,38,39,55,53,39,1,20,22,23,38,38,
+35,34,2,55,1,15,254,241,1,15,254,241,143,252,252,252,252,147,142,56,65,120,
+127,62,2,1,80,51,140,76,84,28,98,111,38,35,40,57,25,82,65,45,109,254,84,1,
+160,119,37,37,8,86,31,16,48,106,97,62,85,83,23,67,91,53,23,36,23,8,94,219,
+254,213,79,77,2,55,62,37,2,213,131,129,178,129,158,158,129,178,129,2,78,28,
+171,147,63,66,71,157,137,32,6,71,39,30,6,161,100,45,11,62,63,8,168,39,8,24,
+29,57,66,25,56,35,31,7,47,21,86,27,48,54,25,8,20,1,64,65,80,25,117,98,0,2,
+0,113,0,0,5,156,6,123,0,44,0,52,0,0,1,33,53,51,17,33,21,22,18,18,23,35,38,
+2,2,35,34,2,2,7,35,26,2,55,53,46,2,53,52,54,51,50,22,22,21,21,33,17,33,21,
+35,17,51,1,20,22,51,53,52,35,34,5,82,254,119,123,253,249,57,102,94,28,141,
+20,89,86,22,28,86,83,23,137,34,93,94,56,81,141,81,118,97,88,98,51,2,15,1,
+88,201,127,251,164,98,78,88,88,2,162,129,1,57,8,33,254,199,253,246,240,190,
+1,249,1,61,254,214,254,30,232,1,11,2,7,1,34,32,8,3,81,139,86,105,129,72,152,
+124,66,1,137,129,253,62,2,96,78,88,66,221,0,0,2,0,113,0,0,5,156,6,123,0,43,
+0,51,0,0,1,33,53,51,17,33,21,33,21,33,21,33,21,33,17,35,17,33,53,33,53,33,
+53,33,53,34,38,38,53,52,54,51,50,22,22,21,21,33,17,33,21,35,17,51,1,20,22,
+51,53,52,35,34,5,82,254,119,123,253,241,1,6,254,250,1,6,254,250,143,254,252,
+1,4,254,252,1,4,84,142,83,118,97,88,98,51,2,15,1,88,201,127,251,164,98,78,
+88,88,2,162,129,1,57,219,129,178,129,254,51,1,205,129,178,129,219,77,141,
+91,105,129,72,152,124,66,1,137,129,253,62,2,96,78,88,66,221,0,0,3,0,72,0,
+0,5,123,6,102,0,27,0,37,0,46,0,0,1,33,21,35,22,22,23,22,22,21,21,51,21,33,
+17,35,17,33,53,51,53,52,54,55,54,54,55,35,1,17,35,6,6,7,6,6,21,21,37,52,38,
+39,38,39,35,17,33,1,41,3,113,164,3,56,76,63,60,131,253,174,143,253,174,131,
+63,60,70,61,4,164,1,113,62,5,65,64,67,57,3,14,53,71,127,7,61,1,63,6,102,129,
+48,98,89,75,129,66,101,129,252,250,3,6,129,101,66,133,71,83,104,48,253,162,
+2,94,60,130,81,84,107,43,101,101,42,102,90,160,111,253,162,0,0,1,0,102,0,
+0,3,215,6,102,0,18,0,0,19,20,22,51,33,17,33,53,33,50,22,21,17,35,17,33,34,
+2,3,246,122,128,1,88,254,41,1,192,73,93,143,254,174,208,190,2,6,102,214,210,
+1,39,129,86,65,250,49,4,61,1,12,1,29,0,0,1,0,164,0,0,5,154,6,143,0,105,0,
+0,1,52,54,51,50,22,21,21,20,22,22,51,50,54,54,53,53,52,54,51,50,22,21,21,
+20,6,6,7,6,6,21,17,35,17,52,62,6,53,53,52,38,35,34,6,21,21,20,6,35,34,38,
+53,53,52,38,35,34,6,6,21,21,20,6,35,34,38,53,53,52,38,35,34,6,21,17,20,22,
+22,51,51,23,35,34,38,53,17,52,54,51,50,22,21,21,20,22,22,51,50,54,54,53,2,
+111,88,88,86,90,8,19,24,27,19,9,88,88,87,90,62,120,146,82,70,143,43,70,90,
+94,90,70,43,21,35,30,21,89,87,88,88,21,34,23,19,10,89,87,88,88,21,34,30,21,
+8,19,24,10,4,12,88,88,88,88,87,89,9,19,23,26,20,10,5,152,118,129,127,120,
+91,48,53,26,24,55,48,91,118,129,127,120,199,107,156,106,61,34,76,56,253,131,
+2,123,63,87,62,46,45,50,71,100,72,203,67,60,55,72,91,120,127,129,118,91,67,
+60,23,56,48,91,120,127,129,118,91,71,56,55,72,254,225,49,52,26,119,129,119,
+1,27,118,129,127,120,91,49,53,25,23,54,50,0,0,5,0,102,0,0,5,41,6,117,0,20,
+0,24,0,28,0,31,0,39,0,0,19,54,54,53,52,38,39,38,53,52,54,55,53,1,1,17,33,
+17,6,6,7,1,17,33,17,53,17,33,17,19,33,1,1,20,30,2,23,17,6,156,52,60,38,45,
+83,159,140,1,205,1,203,252,104,16,126,101,1,131,2,121,253,135,26,2,68,254,
+221,253,146,44,57,53,9,163,1,147,7,42,48,25,43,31,57,87,95,107,3,250,1,199,
+254,57,251,82,1,193,74,85,9,1,86,254,18,1,238,129,1,61,254,195,1,190,1,23,
+253,22,32,40,39,50,42,1,39,7,0,1,0,225,0,0,3,195,6,102,0,29,0,0,1,20,14,4,
+7,51,50,54,53,51,2,2,35,35,17,35,17,52,54,54,55,62,2,53,53,51,2,182,37,59,
+72,69,58,16,186,129,121,144,2,190,208,194,144,55,107,11,83,56,34,123,5,217,
+106,147,102,69,58,55,38,208,216,254,227,254,244,252,231,3,72,79,127,95,9,
+73,85,111,76,143,0,5,0,102,255,215,3,244,6,102,0,22,0,27,0,32,0,37,0,42,0,
+0,1,33,17,33,17,22,22,21,20,6,6,35,34,38,38,53,52,54,55,53,33,17,33,1,22,
+22,23,53,23,54,54,55,35,3,6,6,7,51,33,38,38,39,21,2,117,254,170,1,86,164,
+219,121,211,123,123,211,121,217,166,254,170,1,230,254,141,19,125,83,144,85,
+125,17,227,144,88,120,19,227,1,113,18,124,83,5,229,254,205,254,148,24,247,
+166,119,205,118,118,204,120,165,248,24,235,2,53,250,238,93,126,19,238,238,
+22,131,85,1,106,20,126,87,84,127,20,231,0,0,8,0,164,255,215,3,170,8,41,0,
+40,0,48,0,52,0,70,0,75,0,80,0,85,0,90,0,0,1,52,54,55,39,55,51,23,7,22,22,
+21,20,6,7,21,51,21,35,17,22,22,21,20,6,35,34,38,53,52,54,55,53,35,17,35,53,
+33,53,38,38,55,20,51,50,53,52,35,34,3,21,51,53,19,35,7,6,6,7,23,22,23,23,
+51,55,54,55,55,39,38,39,3,22,22,23,53,23,54,54,55,35,3,6,6,7,51,33,38,38,
+39,21,1,133,67,56,174,219,88,219,174,56,69,80,63,186,186,117,149,196,142,
+142,196,149,117,247,117,1,108,62,77,127,84,84,84,84,113,125,76,8,6,7,27,69,
+41,52,11,5,8,6,12,46,45,45,45,13,215,14,75,53,127,49,76,14,139,127,51,75,
+14,140,1,10,16,74,49,5,121,83,118,26,207,254,254,207,26,118,83,91,122,23,
+12,129,254,98,23,184,116,137,191,190,138,117,184,22,88,1,70,129,12,23,122,
+91,119,119,119,254,16,207,207,3,170,13,15,35,66,37,47,31,14,14,33,41,41,43,
+41,32,249,74,52,78,17,147,147,17,78,52,1,5,16,77,51,51,76,17,144,0,2,0,102,
+0,0,5,197,6,102,0,43,0,52,0,0,1,54,51,50,22,21,20,6,7,17,35,17,6,6,7,46,2,
+39,51,22,22,23,54,54,51,51,53,14,2,7,46,2,39,51,22,22,23,54,54,51,51,23,34,
+7,17,54,54,53,52,38,4,98,53,62,103,137,204,151,143,89,127,99,128,248,167,
+19,146,25,232,136,70,163,76,29,61,91,80,83,128,247,168,19,146,24,230,139,
+66,165,78,172,105,63,42,106,130,72,5,86,20,127,98,133,213,27,252,236,4,29,
+2,44,75,3,105,175,96,93,144,13,58,63,198,1,20,38,61,3,104,174,97,92,144,13,
+54,66,239,25,254,180,31,138,81,54,53,0,0,5,0,227,0,0,5,84,6,102,0,15,0,19,
+0,23,0,27,0,31,0,0,1,33,17,35,17,33,17,35,17,33,17,35,17,33,21,33,1,7,39,
+55,19,7,39,55,1,7,39,55,19,7,39,55,1,115,3,225,143,254,157,143,254,160,144,
+4,113,252,31,3,32,94,176,92,178,94,176,92,254,201,92,176,90,178,92,176,90,
+4,221,251,35,4,92,251,164,4,92,251,164,6,102,129,252,189,94,178,92,253,131,
+94,178,92,1,182,94,178,93,253,131,95,179,92,0,8,0,90,0,0,5,6,7,133,0,40,0,
+47,0,54,0,67,0,80,0,87,0,91,0,95,0,0,1,22,22,21,20,6,7,22,23,20,2,7,51,21,
+33,53,51,38,2,39,54,55,38,38,53,52,54,55,53,33,17,51,21,51,50,22,21,20,6,
+7,33,3,38,38,39,17,54,18,37,22,18,23,17,6,6,3,6,21,20,22,23,54,55,38,38,39,
+21,35,37,6,6,7,22,23,54,54,53,52,39,21,35,3,52,38,35,21,54,54,5,22,23,17,
+19,54,55,35,4,86,78,98,131,104,132,27,184,117,99,253,135,94,105,172,22,22,
+132,99,135,96,80,1,8,134,8,109,110,43,35,1,41,37,19,171,123,107,183,253,21,
+24,183,106,118,171,57,45,104,99,16,45,5,68,49,97,2,228,49,71,5,26,31,96,113,
+45,96,238,51,57,60,48,254,242,90,24,144,22,88,110,5,193,8,112,83,93,199,71,
+121,149,94,254,202,104,129,129,93,1,28,127,145,125,65,200,96,82,112,8,15,
+1,188,102,94,80,48,91,29,252,178,96,171,48,252,219,103,1,24,107,106,254,231,
+98,3,30,45,170,2,98,18,59,81,148,52,11,24,97,188,32,123,129,29,189,105,11,
+20,48,150,85,60,18,136,1,170,36,30,211,38,69,250,117,170,1,31,254,227,171,
+114,0,0,5,0,102,0,0,4,98,6,246,0,21,0,41,0,45,0,49,0,53,0,0,1,22,22,23,54,
+54,55,51,6,7,51,21,35,34,39,6,35,35,53,51,38,39,37,35,21,35,53,35,53,51,53,
+35,53,51,53,51,21,51,21,35,21,51,3,17,35,17,1,17,35,17,33,17,35,17,1,164,
+7,104,81,80,104,9,143,17,136,92,152,65,58,62,61,151,90,133,19,1,252,100,143,
+101,101,101,101,143,100,100,100,100,143,2,69,143,253,35,144,4,127,110,189,
+47,47,190,109,245,136,129,16,16,129,135,246,98,157,157,129,76,129,199,199,
+129,76,252,211,253,203,2,53,1,117,254,106,1,150,254,106,1,150,0,0,2,0,82,
+255,233,5,197,6,102,0,62,0,67,0,0,1,23,51,54,54,55,4,21,20,7,6,21,20,22,51,
+50,55,51,6,6,35,34,38,53,52,55,54,54,53,52,38,39,7,17,51,21,35,23,7,38,39,
+35,6,7,39,55,35,53,51,38,38,53,52,54,55,53,39,35,17,35,17,35,53,1,6,21,20,
+23,2,231,121,8,3,14,80,1,98,83,83,31,24,120,30,115,16,140,107,81,111,83,44,
+39,63,66,117,133,88,129,127,108,9,8,8,113,127,134,93,72,77,103,146,104,121,
+201,143,252,2,205,101,101,6,102,204,10,35,159,18,178,82,69,70,76,37,41,162,
+134,151,110,85,87,87,46,57,22,34,29,8,227,252,162,129,250,61,211,38,46,206,
+64,250,129,50,201,109,125,220,38,117,229,253,205,2,51,129,253,140,65,163,
+162,67,0,0,2,0,225,0,0,3,246,6,184,0,11,0,15,0,0,1,17,35,17,33,17,35,17,51,
+17,33,17,1,33,17,33,3,246,144,254,11,144,144,1,245,254,11,1,245,254,11,6,
+102,251,187,1,20,252,203,6,184,254,142,1,32,253,80,1,15,0,0,4,0,164,0,0,5,
+8,6,102,0,43,0,55,0,69,0,83,0,0,1,35,34,6,7,6,7,22,0,19,35,38,2,2,39,6,2,
+2,7,35,54,0,55,38,39,38,38,35,35,53,51,50,22,23,22,22,23,54,54,55,54,54,51,
+51,5,35,21,35,53,35,21,35,53,35,53,33,19,22,22,21,20,6,7,39,54,54,53,52,38,
+39,33,6,6,21,20,22,23,7,38,38,53,52,54,55,4,244,49,40,70,45,101,117,112,1,
+2,72,151,41,150,180,41,44,169,155,46,147,59,1,14,113,117,101,44,71,40,49,
+60,76,120,55,64,104,62,61,104,67,57,120,74,60,254,219,86,123,80,123,86,1,
+242,98,80,115,92,74,47,37,41,52,47,253,152,46,53,42,36,47,74,92,114,81,5,
+229,93,108,247,119,121,253,216,254,243,179,1,109,1,41,13,15,254,224,254,134,
+173,243,2,66,121,119,247,107,94,129,130,132,157,164,37,36,163,159,136,126,
+129,202,202,202,202,129,254,41,17,151,86,86,143,29,117,14,72,49,54,76,10,
+9,77,54,50,72,13,117,29,144,85,85,151,18,0,7,0,164,255,236,6,82,6,102,0,28,
+0,44,0,58,0,62,0,66,0,70,0,74,0,0,1,20,7,54,51,50,4,18,21,20,2,4,35,34,36,
+2,53,52,55,46,2,53,52,54,51,50,22,22,1,20,22,22,51,50,54,54,53,52,38,38,35,
+34,6,6,19,52,38,38,35,34,6,21,20,22,22,51,50,54,1,35,53,51,53,35,53,51,5,
+35,53,51,17,35,53,51,3,47,6,90,96,163,1,32,172,168,254,224,167,168,254,222,
+168,137,88,160,94,145,113,93,184,114,254,211,137,221,125,127,225,128,129,
+223,128,128,223,132,160,74,119,59,53,60,73,113,56,55,68,2,155,241,241,241,
+241,254,62,242,242,242,242,4,227,26,25,29,162,254,218,169,167,254,222,167,
+167,1,35,166,220,169,13,114,168,88,111,151,111,181,253,26,135,229,125,134,
+226,129,130,228,134,131,230,2,0,58,122,78,70,53,56,123,79,70,252,205,129,
+219,129,129,129,254,35,129,0,6,0,225,0,0,6,12,6,117,0,17,0,29,0,41,0,53,0,
+65,0,69,0,0,1,22,23,53,51,21,54,55,51,6,6,7,17,35,17,38,38,39,39,1,17,35,
+17,39,7,17,35,17,55,39,33,7,23,17,35,17,39,7,17,35,17,1,1,32,21,20,33,39,
+50,54,53,52,38,35,33,34,6,21,20,22,51,7,32,53,52,33,1,33,53,33,2,158,43,102,
+143,102,46,154,37,155,110,143,109,156,36,170,1,62,144,86,63,144,119,94,4,
+250,94,118,143,64,86,143,1,62,254,141,1,51,254,205,6,85,109,104,90,254,182,
+91,104,109,86,6,254,205,1,51,1,211,253,174,2,82,6,102,118,31,149,149,32,117,
+121,143,18,251,248,4,8,17,144,121,15,254,172,253,188,2,37,90,65,253,57,2,
+229,127,101,101,127,253,27,2,199,65,90,253,219,2,68,1,84,252,6,223,219,108,
+62,51,49,59,59,49,52,61,108,219,223,253,133,129,0,3,0,225,0,0,5,31,6,102,
+0,22,0,33,0,69,0,0,1,23,20,22,22,51,50,54,54,53,55,51,17,35,53,33,21,35,53,
+33,21,35,17,1,34,38,38,39,17,33,17,14,2,5,54,54,51,50,22,21,20,7,6,6,21,20,
+22,51,50,55,23,6,6,35,34,38,53,52,55,62,2,53,52,38,35,34,6,7,1,72,141,85,
+142,70,72,141,86,143,103,144,254,185,144,254,185,144,2,27,101,176,109,9,3,
+30,10,114,178,254,190,37,116,66,79,109,121,88,34,44,25,63,40,100,37,109,57,
+88,117,122,32,54,36,45,25,44,44,14,6,102,88,89,155,92,92,155,89,88,249,154,
+211,211,211,211,6,102,253,213,106,190,118,251,123,4,133,119,191,104,206,69,
+64,101,71,82,67,49,28,14,28,31,73,63,68,65,88,71,96,67,17,29,25,14,31,33,
+42,32,0,5,0,102,0,0,6,141,6,129,0,5,0,9,0,24,0,36,0,42,0,0,1,17,33,21,33,
+17,33,17,35,17,7,33,38,38,35,34,7,35,54,54,51,50,22,23,51,3,21,20,22,51,51,
+21,35,34,38,53,53,1,35,1,55,23,51,2,80,1,207,253,162,3,61,143,80,254,252,
+24,145,108,210,64,142,44,223,149,124,187,56,170,242,24,42,104,147,71,95,3,
+239,200,254,243,95,227,147,5,147,250,238,129,5,147,250,109,5,147,129,111,
+127,238,172,195,128,110,252,168,168,27,20,129,86,66,192,2,197,1,29,88,244,
+0,0,5,0,102,0,0,9,211,6,78,0,55,0,74,0,85,0,96,0,107,0,0,1,22,21,20,6,35,
+34,39,22,21,21,51,21,33,53,51,53,52,2,36,35,34,0,3,7,38,53,52,18,36,51,32,
+5,62,2,55,22,21,20,6,7,22,23,54,54,55,22,21,20,6,6,7,23,54,54,1,51,53,52,
+2,0,36,33,34,4,2,7,54,36,51,32,4,18,17,3,20,22,51,50,54,53,52,39,6,6,1,20,
+22,51,50,54,53,52,39,6,6,19,20,22,51,50,54,53,52,39,6,6,9,106,105,105,96,
+25,24,31,69,253,89,77,185,254,165,232,250,254,108,116,96,31,252,1,185,245,
+1,79,1,9,9,88,142,48,105,82,66,53,27,38,174,56,105,61,99,49,45,46,145,254,
+55,245,164,254,219,254,95,254,252,195,254,157,215,7,112,1,149,243,1,17,1,
+152,220,158,45,18,49,62,25,59,90,1,49,44,20,52,58,24,60,90,178,45,19,50,58,
+22,60,90,3,240,90,132,91,97,6,122,128,245,109,109,147,230,1,101,195,254,229,
+254,249,58,97,141,223,1,123,219,121,44,103,90,5,90,131,60,93,17,45,27,67,
+121,7,90,132,53,80,47,2,84,53,93,252,129,235,217,1,130,1,14,143,170,254,225,
+160,199,229,222,254,95,254,246,4,43,15,24,63,50,47,37,20,102,254,208,15,24,
+65,48,46,38,21,102,254,139,15,24,59,52,44,42,21,102,0,0,6,0,102,255,236,6,
+100,6,117,0,22,0,43,0,60,0,64,0,68,0,71,0,0,19,22,22,51,51,50,54,54,55,23,
+6,17,20,22,23,1,1,54,54,53,52,38,39,5,6,4,35,35,34,36,39,22,22,21,20,6,7,
+1,1,38,38,53,52,54,3,35,17,51,21,33,53,51,17,35,53,51,1,23,7,23,51,1,51,17,
+35,19,51,17,35,39,51,39,180,196,246,160,174,107,183,164,146,80,233,85,77,
+253,71,253,74,77,85,124,110,5,113,94,254,207,162,129,159,254,204,94,119,92,
+63,52,2,16,2,19,52,63,93,179,61,61,253,109,61,61,94,1,90,76,94,165,72,254,
+41,78,78,205,78,78,135,170,86,6,117,77,56,26,47,60,133,230,255,0,145,214,
+65,253,138,2,118,65,214,145,122,253,111,9,59,68,68,59,138,214,129,124,229,
+56,254,22,1,234,56,231,122,128,216,254,31,254,242,109,109,1,14,108,1,64,78,
+88,154,254,134,1,14,254,242,1,14,108,80,0,0,5,0,102,255,215,5,53,7,164,0,
+21,0,31,0,39,0,55,0,69,0,0,1,50,22,21,20,7,23,21,6,2,7,17,35,17,38,38,39,
+55,38,53,52,54,19,34,39,22,22,51,50,54,55,6,3,34,21,20,51,50,53,52,3,1,6,
+6,21,20,22,23,1,1,54,54,53,52,38,39,1,20,7,1,1,38,53,52,54,55,1,1,22,22,2,
+205,105,128,28,2,25,70,49,127,50,70,25,2,25,126,106,47,39,12,45,31,24,40,
+14,32,46,119,119,119,121,2,104,108,105,96,117,253,152,253,153,115,98,105,
+108,1,76,168,1,195,1,196,168,74,84,254,70,254,71,86,72,6,20,113,85,56,45,
+12,14,217,254,245,45,254,172,1,89,43,244,223,43,44,54,84,114,254,113,12,169,
+185,182,170,10,1,31,84,84,84,84,2,0,253,166,85,184,122,115,184,101,253,164,
+2,92,97,184,119,122,185,84,254,119,243,155,254,64,1,192,155,243,121,194,86,
+1,182,254,74,89,189,0,3,0,102,0,0,7,25,6,193,0,51,0,63,0,75,0,0,1,6,7,1,7,
+39,6,21,20,22,23,21,46,2,53,52,54,55,1,6,35,35,34,39,1,22,22,21,20,6,6,7,
+53,54,54,53,52,39,7,39,1,38,39,53,22,22,51,51,50,54,55,1,17,52,38,35,35,53,
+33,50,22,21,17,51,17,52,54,51,33,21,35,34,6,21,17,5,176,35,30,1,170,86,86,
+97,90,70,86,125,67,66,63,254,210,116,156,51,157,115,254,210,63,66,67,124,
+87,70,90,99,84,86,1,170,36,29,83,255,133,51,134,253,84,253,74,24,42,227,1,
+14,71,95,109,95,71,1,14,227,42,24,6,51,26,13,254,68,84,88,68,127,86,131,14,
+111,7,94,151,88,90,147,48,1,55,22,22,254,203,48,149,90,88,151,94,7,111,14,
+131,86,125,70,88,84,1,188,17,22,142,50,59,58,51,249,63,1,203,28,19,129,86,
+66,254,29,1,227,66,86,129,19,28,254,53,0,0,1,0,102,0,0,3,244,6,102,0,72,0,
+0,1,6,21,20,23,22,23,17,52,54,51,51,21,35,34,6,21,17,55,55,54,53,52,39,53,
+4,21,20,6,6,7,7,21,51,21,35,17,54,53,52,35,53,50,22,21,20,6,6,7,33,46,2,53,
+52,54,51,21,34,21,20,23,17,35,53,51,53,39,38,38,53,52,37,1,143,166,120,53,
+79,91,75,209,166,41,24,78,55,119,166,1,41,41,69,95,178,215,215,153,77,99,
+109,46,74,101,254,242,104,72,45,109,100,78,153,215,215,178,118,87,1,41,4,
+195,9,90,60,90,40,66,2,111,63,88,129,19,28,253,170,64,42,90,60,90,9,112,6,
+205,45,81,77,75,142,53,129,254,98,121,54,69,113,94,88,41,80,78,80,83,76,80,
+40,88,94,113,69,59,116,1,158,129,53,142,91,126,61,205,6,0,3,0,102,255,231,
+5,227,6,137,0,40,0,88,0,97,0,0,1,55,54,53,53,52,54,55,54,54,55,55,23,7,6,
+7,22,22,21,21,20,23,23,7,46,2,39,7,21,51,21,33,53,51,53,39,14,2,7,3,38,38,
+35,34,6,21,20,51,50,54,55,54,54,51,50,22,21,20,6,35,34,38,39,55,22,22,51,
+50,54,53,52,35,34,6,7,6,6,35,34,38,53,52,54,51,50,22,23,19,55,38,38,39,6,
+6,7,23,1,123,39,84,122,119,19,132,112,122,68,125,156,28,109,112,85,38,96,
+75,58,35,2,88,122,254,123,123,90,3,33,56,76,20,19,75,37,36,57,150,96,176,
+130,121,208,117,136,142,133,96,85,116,24,102,19,75,37,41,51,149,97,181,123,
+120,209,118,136,143,133,97,85,116,24,250,151,12,69,74,73,69,12,150,2,76,36,
+76,88,99,114,219,85,80,152,65,71,121,73,95,94,85,207,111,99,88,76,36,105,
+63,75,89,58,145,95,129,129,93,145,58,88,73,64,254,219,42,42,47,45,88,63,84,
+77,69,107,100,88,117,81,73,43,42,42,54,38,88,67,79,77,70,106,101,88,117,81,
+73,1,244,252,53,91,53,52,94,53,250,0,3,0,164,255,236,9,88,6,141,0,26,0,59,
+0,63,0,0,1,21,20,23,33,50,0,18,21,21,33,53,52,18,0,51,33,54,53,53,52,54,55,
+55,23,7,6,19,22,21,21,35,53,52,38,38,39,38,39,6,7,14,2,21,21,35,53,52,55,
+35,34,6,2,7,33,38,2,38,35,1,17,51,17,5,70,55,1,86,148,1,46,195,247,76,197,
+1,43,149,1,84,57,137,132,122,68,125,190,188,76,123,31,59,78,24,21,21,24,77,
+60,31,123,74,213,104,232,156,2,7,146,4,159,228,103,253,221,144,4,231,112,
+107,57,254,236,254,72,202,81,81,205,1,185,1,16,62,104,115,87,182,77,71,121,
+73,116,253,251,104,218,139,141,75,117,87,69,21,25,25,21,68,87,118,75,141,
+139,217,105,238,254,157,148,156,1,96,233,254,51,1,66,254,190,0,0,2,0,225,
+0,0,5,82,6,102,0,11,0,15,0,0,1,33,17,35,17,33,17,35,17,33,17,35,1,33,17,33,
+2,211,254,158,144,4,113,143,254,159,143,254,158,3,82,252,174,1,25,254,231,
+6,102,249,154,1,25,254,231,1,154,4,75,0,0,4,0,225,0,0,6,123,6,102,0,3,0,7,
+0,16,0,20,0,0,19,33,17,33,55,33,17,33,1,1,55,1,1,23,1,17,35,5,51,17,35,225,
+5,154,250,102,144,3,92,252,164,1,102,254,213,92,1,15,1,14,92,254,229,143,
+2,133,144,144,6,102,249,154,129,5,100,253,248,1,55,91,254,231,1,25,91,254,
+218,252,243,96,5,100,0,3,0,102,0,0,7,66,6,102,0,38,0,55,0,62,0,0,1,39,39,
+6,7,17,35,17,39,6,2,3,35,18,0,55,38,2,39,51,22,18,23,17,51,17,54,18,55,51,
+2,7,23,37,23,7,7,22,23,1,17,52,38,35,35,53,51,50,22,21,17,22,21,20,7,17,19,
+52,38,39,21,54,54,6,242,236,137,49,53,144,16,229,233,34,145,34,1,0,242,77,
+135,46,142,54,123,64,144,62,125,54,142,78,115,59,1,9,41,158,2,25,122,249,
+219,24,41,105,148,74,92,233,233,114,62,52,52,62,3,37,153,15,52,22,252,125,
+3,127,8,214,254,80,254,255,1,38,1,221,226,92,1,75,218,223,254,211,57,2,69,
+253,191,58,1,36,227,254,163,195,7,105,115,69,11,8,80,252,115,5,182,28,19,
+129,88,63,254,188,26,193,192,23,253,39,3,178,38,52,11,205,11,53,0,7,0,164,
+0,0,5,238,6,143,0,32,0,36,0,41,0,47,0,53,0,65,0,77,0,0,51,18,1,6,35,34,38,
+53,52,54,51,50,22,21,20,7,33,38,53,52,54,51,50,22,21,20,6,35,34,39,22,18,
+19,1,7,33,39,1,6,7,33,39,1,6,7,33,38,39,1,6,7,33,38,39,37,20,22,51,50,54,
+53,52,38,35,34,6,5,20,22,51,50,54,53,52,38,35,34,6,164,104,1,43,33,36,93,
+131,132,92,91,132,25,1,33,22,132,91,89,134,134,89,38,32,145,199,58,251,108,
+22,4,6,25,252,101,15,20,3,166,35,252,248,28,26,3,27,25,26,254,80,112,91,2,
+67,90,114,253,237,60,45,42,62,64,40,43,62,2,176,60,45,42,62,64,40,43,62,3,
+200,1,23,12,130,93,92,129,133,88,48,52,44,56,92,129,130,91,91,132,10,132,
+253,172,253,251,1,31,158,158,1,30,57,100,157,1,31,72,86,86,72,1,113,53,187,
+185,55,227,44,60,60,44,48,59,61,46,44,60,60,44,48,59,61,0,11,0,16,0,0,6,242,
+7,92,0,21,0,34,0,40,0,46,0,52,0,58,0,66,0,74,0,92,0,110,0,118,0,0,1,51,50,
+22,22,21,20,22,23,22,22,21,33,52,54,55,54,54,53,52,54,54,37,6,33,32,39,53,
+22,23,19,51,19,54,55,1,35,3,55,51,23,1,35,3,55,51,23,1,6,7,33,38,39,1,6,7,
+33,38,39,37,21,7,33,53,39,33,6,19,34,6,7,33,38,38,35,37,35,7,6,6,7,23,22,
+23,23,51,55,54,55,55,39,38,39,37,35,7,6,6,7,23,22,23,23,51,55,54,55,55,39,
+38,39,1,7,6,7,23,50,55,39,3,31,196,102,124,57,40,54,48,46,251,142,46,48,54,
+40,58,124,2,152,134,254,187,254,178,137,78,141,201,88,201,139,82,251,242,
+88,220,220,88,219,3,248,89,219,219,89,219,251,16,27,8,3,68,11,26,253,121,
+16,50,2,152,53,15,254,10,2,1,222,2,254,41,3,162,68,67,14,1,192,14,67,66,253,
+78,9,6,8,37,57,41,52,10,5,9,6,13,44,45,45,45,12,4,205,9,6,8,37,57,41,52,10,
+5,9,6,13,44,45,45,45,12,253,135,6,19,80,105,74,39,105,5,16,119,231,209,77,
+136,105,95,204,120,122,201,96,107,136,75,212,230,117,240,102,102,141,51,31,
+1,33,254,223,31,51,253,113,1,0,254,254,255,0,1,0,254,254,252,33,86,72,82,
+76,1,30,52,105,111,46,168,20,19,39,119,42,1,93,94,84,84,94,238,13,18,44,54,
+37,47,29,14,14,33,39,41,43,43,30,13,13,18,44,54,37,47,29,14,14,33,39,41,43,
+43,30,1,109,14,46,124,4,4,184,0,0,5,0,225,0,0,5,82,6,102,0,11,0,36,0,43,0,
+50,0,57,0,0,37,33,21,35,17,33,17,35,53,33,21,35,1,22,22,21,20,6,7,21,33,53,
+38,38,53,52,54,55,17,35,6,6,35,34,38,39,35,1,20,22,23,17,6,6,5,52,38,39,17,
+54,54,19,50,54,55,33,22,22,2,211,254,158,144,4,113,143,254,159,143,254,158,
+136,191,192,135,3,82,136,192,192,136,99,16,193,127,129,192,14,80,2,137,118,
+83,83,118,254,63,116,84,80,120,215,73,118,16,254,99,14,117,178,178,6,102,
+249,154,178,178,4,184,4,191,136,137,189,2,242,230,2,189,136,137,191,4,1,57,
+125,161,164,122,253,125,90,121,2,1,170,4,121,75,82,125,6,254,86,2,125,2,34,
+95,75,75,95,0,2,0,102,255,236,9,250,5,244,0,43,0,71,0,0,1,7,22,4,51,50,36,
+55,39,55,1,7,39,6,6,21,20,22,23,55,23,1,39,55,38,36,35,34,4,7,23,7,1,55,23,
+54,54,53,52,38,39,7,39,1,1,34,36,39,7,22,22,21,20,6,7,23,54,36,51,50,4,23,
+55,38,38,53,52,54,55,39,6,4,2,244,150,126,1,132,207,212,1,81,172,147,92,2,
+49,86,207,53,58,56,55,207,86,253,207,92,147,166,254,176,219,204,254,122,127,
+150,92,253,206,86,207,50,61,61,50,207,86,2,50,2,157,232,254,73,154,12,69,
+84,81,70,10,157,1,185,227,239,1,124,194,11,67,83,84,68,13,191,254,128,5,160,
+142,106,127,103,132,140,84,253,235,84,195,71,192,89,87,186,76,195,84,253,
+236,83,138,130,107,129,106,140,83,2,20,84,195,70,189,90,92,193,67,195,84,
+2,21,253,176,145,129,10,85,242,119,117,240,90,8,132,144,124,152,8,83,240,
+124,120,245,81,12,152,124,0,0,2,0,102,255,236,9,59,6,102,0,28,0,47,0,0,1,
+6,2,21,20,18,23,7,38,36,33,32,4,7,39,54,18,53,52,38,38,39,55,22,4,33,32,36,
+55,1,32,37,22,17,20,2,7,54,36,33,32,5,38,2,53,16,55,4,9,59,135,106,130,111,
+92,134,253,243,254,133,254,168,253,191,119,91,111,131,49,99,94,93,114,2,67,
+1,89,1,120,2,16,134,251,248,253,199,254,186,133,70,69,155,1,209,1,25,2,60,
+1,61,69,70,131,254,200,6,4,171,254,173,221,211,254,118,126,98,105,112,115,
+102,98,124,1,138,213,154,248,210,119,98,101,116,112,105,254,162,125,253,254,
+167,153,254,193,142,61,68,129,142,1,63,153,1,93,249,125,0,0,2,0,164,0,88,
+10,223,5,229,0,61,0,125,0,0,1,50,22,23,22,4,33,32,36,55,54,54,51,50,22,21,
+20,6,7,6,6,21,21,20,22,23,22,22,21,20,6,35,34,38,39,38,36,33,32,4,7,6,6,35,
+34,38,53,52,54,55,54,54,53,53,52,38,39,38,38,53,52,54,19,50,54,55,54,36,33,
+32,4,23,22,22,51,50,54,53,52,38,39,38,38,53,53,52,62,4,53,52,38,35,34,6,7,
+6,4,33,32,36,39,38,38,35,34,6,21,20,30,4,21,21,20,6,7,6,6,21,20,22,1,123,
+73,114,63,138,1,142,1,52,1,50,1,142,142,65,111,73,100,115,73,81,80,75,76,
+79,83,71,116,99,72,113,64,144,254,112,254,210,254,212,254,110,142,62,116,
+72,99,116,72,83,77,77,76,78,81,74,114,117,35,61,76,131,1,192,1,71,1,72,1,
+192,132,77,59,35,43,45,37,117,74,81,46,68,81,68,46,45,43,34,58,79,131,254,
+68,254,179,254,180,254,68,130,82,56,34,43,45,46,68,81,68,46,81,73,116,39,
+45,5,229,57,64,144,118,117,145,66,55,120,93,60,100,58,57,125,77,39,79,125,
+57,60,98,60,92,121,56,65,146,114,114,146,64,57,121,92,60,99,59,55,126,80,
+39,79,124,56,58,99,61,92,121,250,242,43,79,135,128,128,135,80,42,47,37,26,
+44,92,57,162,98,41,81,118,88,63,52,48,29,38,46,40,82,135,130,130,135,84,38,
+46,38,29,48,52,63,88,118,81,41,99,161,57,91,45,26,37,47,0,0,4,0,225,0,0,10,
+102,4,133,0,5,0,9,0,13,0,17,0,0,1,1,33,17,33,17,1,33,17,1,1,51,17,35,1,51,
+17,35,2,78,6,129,1,151,246,123,1,215,5,215,250,41,6,103,184,184,248,82,184,
+184,3,25,1,108,251,123,3,25,253,104,3,119,254,184,253,209,3,131,252,125,2,
+23,0,5,0,225,0,0,12,0,7,207,0,62,0,81,0,100,0,112,0,124,0,0,1,52,54,51,50,
+22,21,20,6,7,21,20,22,22,23,30,2,21,17,33,17,52,54,54,55,62,2,55,33,30,2,
+23,30,2,21,17,33,17,52,54,54,55,54,54,53,53,38,38,53,52,54,51,50,22,21,20,
+7,33,38,5,34,39,20,6,6,7,6,21,17,33,17,52,39,46,2,53,6,33,34,39,20,6,6,7,
+6,21,17,33,17,52,39,46,2,53,6,1,20,22,51,50,54,53,52,38,35,34,6,5,20,22,51,
+50,54,53,52,38,35,34,6,9,92,197,141,141,197,90,72,14,25,32,36,22,13,253,135,
+12,22,34,33,25,14,1,248,227,2,15,24,33,33,22,13,253,135,13,25,33,41,29,74,
+90,197,141,141,197,92,6,141,90,1,82,27,24,17,30,36,38,1,90,38,36,31,16,19,
+247,99,27,24,17,30,36,38,1,90,38,36,31,16,19,7,134,122,89,89,122,123,88,87,
+124,247,133,122,89,89,122,123,88,87,124,6,131,139,193,193,139,91,146,44,40,
+75,98,64,33,37,54,84,61,252,184,3,72,63,80,52,37,35,58,89,59,65,86,56,34,
+35,51,79,67,252,184,3,72,65,83,54,34,41,126,103,38,44,146,93,139,193,193,
+139,133,92,92,195,4,106,147,79,32,34,103,253,55,2,201,104,33,31,81,145,107,
+4,4,106,147,79,32,34,103,253,55,2,201,104,33,31,81,145,107,4,1,74,90,123,
+127,86,86,127,123,90,90,123,127,86,86,127,123,0,1,0,164,0,96,5,47,6,102,0,
+80,0,0,1,20,6,7,6,6,21,20,22,22,51,50,54,54,53,52,38,35,34,7,7,21,20,22,23,
+22,21,20,6,6,35,34,38,53,52,55,62,2,53,17,51,17,20,6,7,6,6,21,20,51,50,53,
+34,38,38,53,52,54,51,50,22,22,21,20,6,4,35,34,36,38,53,52,62,4,53,17,51,2,
+176,53,67,141,120,114,205,144,129,186,99,126,110,61,68,2,44,78,122,67,129,
+101,155,179,191,49,85,56,143,82,108,96,95,191,168,98,82,47,123,116,118,172,
+93,140,255,0,161,178,254,236,152,56,85,99,85,56,143,4,240,34,61,43,92,240,
+169,125,187,94,90,162,104,97,114,22,9,7,20,14,3,6,103,72,117,71,158,139,201,
+156,40,69,64,35,1,178,254,74,56,104,84,73,154,88,176,137,22,49,44,89,103,
+85,155,96,131,221,125,126,236,158,133,190,135,90,66,51,28,1,73,0,0,1,0,164,
+0,0,4,61,6,102,0,27,0,0,33,33,53,33,17,35,53,51,17,35,53,51,53,33,53,33,21,
+33,21,51,21,35,17,51,21,35,17,33,4,61,252,103,1,133,225,225,225,225,254,123,
+3,153,254,123,246,246,246,246,1,133,129,1,66,129,2,49,129,239,129,129,239,
+129,253,207,129,254,190,0,0,3,0,102,255,236,7,109,6,74,0,26,0,42,0,57,0,0,
+19,4,0,21,20,7,54,54,51,50,4,18,21,20,2,4,35,34,36,2,53,52,55,36,36,53,52,
+1,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,3,52,46,3,39,7,6,21,20,22,22,
+51,54,152,1,68,1,116,4,85,222,127,163,1,32,172,168,254,224,167,168,254,222,
+169,51,254,203,254,221,2,181,137,221,125,127,225,127,129,223,127,128,223,
+132,97,42,72,95,109,122,5,7,112,223,107,10,6,74,19,254,250,211,40,23,80,94,
+162,254,218,169,167,254,222,167,167,1,34,167,127,121,33,241,205,168,252,129,
+135,229,125,135,226,128,130,228,134,131,230,1,152,53,81,63,46,32,24,30,31,
+35,93,146,93,60,0,2,0,205,255,236,4,162,6,102,0,22,0,29,0,0,5,6,35,34,36,
+2,53,52,18,36,51,50,23,21,38,35,34,7,17,22,51,50,55,1,20,18,23,17,6,2,4,162,
+75,71,228,254,125,220,222,1,133,224,75,71,52,75,153,134,134,153,63,64,252,
+186,147,134,134,147,6,14,223,1,127,221,223,1,131,221,12,133,10,57,251,4,57,
+12,2,168,166,254,221,98,4,88,98,254,219,0,0,2,0,164,0,0,9,254,6,102,0,59,
+0,95,0,0,1,35,21,51,21,35,17,35,17,35,3,17,51,21,33,53,51,17,3,35,17,35,17,
+35,53,51,53,35,53,51,17,51,17,51,1,17,35,17,1,35,21,51,1,17,33,17,1,51,53,
+35,1,17,35,17,1,51,17,51,17,51,37,54,54,51,50,22,21,20,7,6,6,21,20,22,51,
+50,55,23,6,6,35,34,38,53,52,54,54,55,54,53,52,38,35,34,6,7,9,254,227,227,
+227,144,39,237,114,250,207,115,238,38,144,227,227,227,227,144,184,1,215,143,
+254,122,122,100,1,63,3,45,1,64,100,123,254,123,143,1,215,184,144,227,250,
+127,37,116,66,81,107,121,78,44,45,24,62,41,100,37,109,57,88,116,38,63,79,
+63,45,24,45,44,14,4,201,138,129,254,230,1,26,254,213,253,238,129,129,2,18,
+1,43,254,230,1,26,129,138,129,1,28,254,228,253,221,253,182,2,33,1,203,138,
+254,125,253,197,2,59,1,131,138,254,53,253,223,2,74,2,35,1,28,254,228,53,69,
+64,102,70,81,67,44,33,15,27,32,74,64,68,65,89,71,40,62,51,41,33,21,31,32,
+42,32,0,2,0,102,0,0,7,133,6,156,0,44,0,47,0,0,1,1,55,23,55,39,55,23,55,39,
+55,1,7,39,7,1,1,39,7,39,1,23,7,23,55,23,7,23,55,23,1,39,55,39,1,17,1,21,33,
+53,1,17,1,7,23,1,33,39,1,180,254,178,91,116,129,194,92,192,123,116,90,1,80,
+93,114,123,1,119,1,129,117,115,92,1,80,90,117,119,197,92,199,133,117,90,254,
+178,92,117,133,254,114,1,27,253,43,1,43,254,111,129,116,1,50,1,86,170,3,63,
+1,76,92,114,129,192,90,190,123,114,93,254,180,90,114,122,254,147,1,113,118,
+114,90,1,76,93,114,121,188,90,190,131,114,92,254,180,93,116,134,254,131,254,
+145,254,215,129,129,1,41,1,94,1,137,129,116,252,229,176,0,1,0,164,0,0,6,225,
+6,123,0,26,0,0,1,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,53,33,
+1,55,1,1,23,1,33,6,225,143,143,246,144,245,144,245,144,143,2,205,254,223,
+90,1,16,1,15,92,254,223,2,221,4,115,251,141,4,115,251,141,4,115,251,141,4,
+115,251,141,4,115,129,1,45,90,254,231,1,25,90,254,211,0,0,2,0,164,0,0,9,31,
+6,150,0,40,0,44,0,0,33,17,52,38,35,35,17,35,17,33,17,35,17,35,34,6,21,17,
+35,17,52,54,51,51,17,33,17,7,39,1,1,7,39,17,33,17,51,50,22,21,17,1,33,17,
+33,8,143,24,41,117,143,251,47,144,116,42,24,143,95,71,159,2,177,127,101,1,
+43,1,43,100,127,2,176,160,73,93,249,90,4,209,251,47,1,111,27,20,254,98,1,
+158,254,98,1,158,20,27,254,145,1,135,66,86,2,69,1,33,127,100,1,44,254,212,
+100,127,254,223,253,187,89,63,254,121,2,31,1,196,0,7,0,225,0,0,7,168,6,145,
+0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,0,1,1,21,51,53,1,55,1,17,33,17,1,23,
+1,21,51,53,1,23,1,21,33,53,1,1,33,17,33,53,33,17,33,1,51,17,35,1,51,17,35,
+37,51,17,35,1,51,17,35,5,53,1,84,144,254,151,105,1,143,249,57,1,144,104,254,
+152,143,1,84,104,254,211,3,107,254,211,253,194,3,107,252,149,3,107,252,149,
+3,250,144,144,250,232,143,143,5,24,144,144,250,232,143,143,5,213,254,141,
+131,215,1,133,86,254,78,251,33,4,223,1,178,86,254,123,215,131,1,115,88,254,
+188,90,90,1,68,251,4,1,88,129,1,4,253,35,1,88,254,168,1,88,129,1,4,254,252,
+1,4,0,2,0,225,0,0,4,84,6,102,0,23,0,41,0,0,33,33,17,51,50,22,23,22,22,23,
+23,6,6,21,20,22,51,21,6,6,21,20,22,23,35,38,53,52,55,38,38,53,52,54,55,38,
+38,39,38,38,39,17,4,84,252,141,156,86,138,72,71,143,90,23,103,113,175,131,
+61,68,78,65,201,61,65,124,148,83,73,94,153,46,22,55,56,6,102,71,80,79,81,
+6,129,36,153,98,129,180,129,6,88,68,60,94,22,81,93,111,82,52,220,135,102,
+172,60,38,128,76,13,15,2,250,156,0,0,2,0,225,0,0,4,201,6,143,0,21,0,34,0,
+0,1,6,7,23,17,20,6,35,33,34,38,53,17,54,1,38,39,55,22,23,54,55,3,39,6,0,7,
+17,20,22,51,33,50,54,53,4,201,99,172,154,95,71,253,217,73,93,184,1,93,170,
+197,105,150,202,174,98,155,101,147,254,243,79,24,41,1,209,41,25,6,57,141,
+203,112,252,39,66,86,89,63,2,73,110,1,128,144,218,86,180,166,197,149,253,
+164,68,169,255,0,38,254,8,28,19,19,28,0,5,0,164,0,0,8,254,6,102,0,34,0,38,
+0,47,0,53,0,60,0,0,33,17,38,38,53,52,0,37,38,38,35,33,53,33,50,22,23,23,55,
+54,54,51,33,21,33,34,6,7,4,0,21,20,6,7,17,37,33,17,33,1,6,7,4,7,33,38,37,
+38,1,54,54,53,52,39,33,6,6,21,20,22,23,1,205,126,171,1,194,1,220,101,121,
+57,254,162,1,96,79,157,90,94,95,91,153,81,1,96,254,162,59,121,99,1,218,1,
+196,175,122,250,135,4,234,251,22,2,117,47,35,254,49,223,5,254,217,254,45,
+46,2,224,70,100,170,249,248,82,88,100,70,1,68,16,202,128,246,1,87,119,79,
+52,129,63,64,65,65,65,62,129,53,78,123,254,174,247,130,201,15,254,188,129,
+2,213,1,172,21,8,109,161,160,110,11,252,202,18,134,78,174,133,63,149,95,80,
+133,17,0,2,0,164,0,0,4,225,6,143,0,22,0,37,0,0,1,20,2,7,51,21,33,53,51,38,
+2,53,53,33,53,1,55,1,1,23,1,21,33,5,33,21,20,18,23,51,54,18,53,53,39,33,17,
+35,4,225,157,144,168,252,205,166,145,154,1,215,254,213,92,1,14,1,15,92,254,
+229,1,215,253,154,254,190,167,157,139,156,168,2,254,192,143,3,211,221,254,
+79,196,129,129,197,1,175,222,180,119,1,55,90,254,232,1,24,90,254,217,135,
+129,59,237,254,70,163,162,1,187,237,30,29,255,0,0,11,0,225,0,0,8,211,6,123,
+0,44,0,58,0,68,0,72,0,76,0,80,0,84,0,88,0,92,0,96,0,100,0,0,1,6,7,39,54,55,
+39,55,23,54,33,23,54,51,50,23,62,3,55,22,21,20,6,7,22,23,35,38,2,38,39,6,
+6,2,7,35,54,18,55,6,7,23,7,1,36,36,55,38,36,37,53,4,4,21,20,4,5,5,52,39,34,
+6,21,20,23,23,36,37,51,21,35,17,51,21,35,17,51,21,35,17,51,21,35,17,51,21,
+35,17,51,21,35,21,51,21,35,17,51,21,35,3,2,121,102,92,104,94,65,90,106,219,
+1,11,106,44,40,77,110,17,73,110,172,181,59,200,228,88,53,145,50,133,147,37,
+35,130,145,54,150,60,175,76,194,156,142,91,254,11,1,165,1,121,56,57,254,151,
+254,76,1,210,2,40,253,217,254,45,6,123,11,158,169,7,5,1,70,248,157,142,142,
+142,142,142,142,142,142,142,142,142,142,142,142,142,142,2,66,49,64,113,63,
+43,61,93,101,78,4,41,158,70,104,70,44,13,71,125,196,211,34,194,164,158,1,
+34,228,12,13,200,254,202,165,183,1,119,112,4,43,129,91,2,68,114,120,36,37,
+116,118,135,115,217,74,73,217,115,113,52,55,135,123,35,31,31,62,14,129,2,
+47,129,253,33,129,6,102,129,251,119,129,4,180,129,86,129,254,211,129,0,0,
+11,0,164,0,0,9,174,6,102,0,21,0,25,0,29,0,33,0,37,0,41,0,45,0,49,0,53,0,57,
+0,61,0,0,1,17,33,17,33,17,33,17,33,17,33,17,33,17,33,17,35,17,33,21,33,53,
+1,33,53,33,1,51,17,35,1,51,53,35,5,51,53,35,5,51,53,35,5,51,53,35,5,51,53,
+35,1,51,53,35,37,51,53,35,5,51,53,35,8,143,1,31,252,21,1,30,251,113,1,31,
+253,51,1,31,144,1,174,4,0,252,0,4,0,252,0,4,144,143,143,1,30,144,144,248,
+164,144,144,1,31,143,143,4,0,143,143,1,31,143,143,250,82,143,143,5,174,143,
+143,250,82,143,143,6,102,251,134,254,20,1,236,1,245,254,11,254,20,1,236,1,
+245,2,133,254,254,253,252,133,253,5,2,251,251,154,233,233,233,233,233,233,
+233,233,233,2,248,133,129,125,125,125,0,5,0,225,0,0,6,123,6,102,0,3,0,7,0,
+51,0,55,0,65,0,0,19,33,17,33,19,17,33,17,3,6,7,21,35,53,6,35,22,18,23,35,
+38,2,39,6,2,7,35,54,18,55,34,39,21,35,53,38,39,53,22,23,38,53,52,54,51,50,
+22,21,20,7,54,55,1,17,35,17,3,20,51,50,53,52,38,35,34,6,225,5,154,250,102,
+144,4,123,82,35,37,123,115,163,75,190,81,140,62,128,33,39,144,54,129,75,196,
+77,165,116,123,39,32,111,183,16,119,92,94,121,18,187,110,254,75,123,18,84,
+84,42,42,42,42,6,102,249,154,5,229,250,156,5,100,253,248,26,15,209,170,22,
+18,254,189,239,170,1,2,10,15,254,244,155,228,1,77,19,22,170,209,16,25,141,
+68,28,46,61,110,138,138,110,61,46,29,67,253,218,254,233,1,23,2,49,119,119,
+55,64,64,0,0,1,0,164,0,0,5,174,6,123,0,67,0,0,1,51,2,35,34,3,51,21,35,7,51,
+21,35,6,7,51,21,35,2,7,35,54,19,35,53,51,54,55,35,53,51,54,55,35,53,51,18,
+51,50,22,23,51,21,35,22,23,51,21,35,23,51,21,35,18,23,35,2,39,35,53,51,39,
+35,53,51,38,39,35,3,98,146,107,98,98,107,150,197,49,194,225,20,17,232,254,
+43,13,143,12,43,108,133,17,20,139,170,20,33,172,217,164,180,95,179,78,213,
+166,13,36,168,135,35,131,108,43,12,146,19,38,250,228,37,221,190,28,23,191,
+4,221,1,15,254,241,129,178,129,80,98,129,254,231,221,233,1,13,129,98,80,129,
+77,101,129,1,158,210,204,129,40,138,129,178,129,254,238,228,1,20,226,129,
+178,129,107,71,0,3,0,164,0,0,5,201,6,102,0,21,0,41,0,46,0,0,33,32,3,33,53,
+52,62,4,51,50,30,4,21,21,35,17,1,20,23,33,55,52,46,5,35,34,14,5,1,22,22,23,
+17,4,240,254,116,4,253,68,50,83,127,132,118,149,109,121,108,150,109,61,92,
+251,192,6,4,8,4,38,62,86,93,57,93,91,92,78,60,92,94,65,41,2,195,1,126,110,
+2,55,246,101,195,180,186,133,30,21,63,188,214,225,114,246,253,201,3,45,68,
+49,117,89,165,146,139,111,37,13,15,36,105,142,148,167,254,179,221,213,4,1,
+182,0,0,4,0,102,0,0,10,14,3,215,0,19,0,23,0,29,0,35,0,0,33,35,17,33,17,35,
+17,38,38,53,52,54,51,33,50,22,21,20,6,7,1,17,33,17,5,20,23,53,6,6,5,52,38,
+39,21,54,8,166,143,250,71,143,188,173,175,186,6,215,183,177,174,186,249,184,
+5,185,248,198,242,127,115,8,187,117,125,242,1,16,254,240,2,29,2,104,113,115,
+108,108,115,113,104,2,1,57,254,59,1,197,92,109,4,221,2,50,56,56,50,2,221,
+4,0,5,0,102,0,0,10,219,5,113,0,24,0,32,0,76,0,82,0,88,0,0,1,33,21,20,22,51,
+33,21,22,22,21,20,6,7,21,33,53,38,38,53,52,54,55,17,35,1,34,38,39,33,17,33,
+17,5,6,6,35,34,39,6,35,34,39,6,35,34,38,53,52,55,55,6,21,20,22,51,50,54,55,
+55,6,21,20,22,51,50,54,55,55,6,21,20,22,51,50,54,55,5,52,39,21,54,54,37,20,
+22,23,53,6,1,4,3,139,124,128,3,232,182,178,176,184,248,92,186,175,177,184,
+203,4,141,197,191,9,254,90,6,133,254,236,20,137,101,95,55,67,101,95,54,67,
+103,81,112,4,125,4,41,25,54,64,23,119,6,41,24,50,64,28,118,8,41,25,49,71,
+21,3,12,241,128,113,246,121,113,129,242,5,113,78,213,211,203,2,104,113,115,
+106,2,246,246,2,106,115,113,104,2,2,64,254,10,247,255,251,145,2,121,180,121,
+137,65,65,67,67,108,86,15,18,8,16,19,37,41,66,63,7,22,36,37,41,61,68,7,37,
+21,37,41,59,70,108,109,4,222,2,52,55,55,52,2,222,4,0,2,0,102,0,209,14,35,
+6,25,0,12,0,22,0,0,19,1,54,51,50,22,22,23,6,35,32,3,1,1,22,22,51,50,55,38,
+38,35,34,145,10,43,230,164,140,217,119,1,218,177,254,119,87,245,174,10,228,
+11,162,128,183,81,35,160,139,115,6,25,252,202,82,136,244,154,78,1,129,3,63,
+252,220,119,142,39,139,128,0,1,0,102,2,94,6,92,4,180,0,19,0,0,1,33,7,39,55,
+35,7,39,55,33,53,33,39,55,23,51,39,55,23,33,6,92,253,14,227,100,143,143,228,
+100,143,254,252,1,13,152,100,242,137,151,100,242,2,227,3,66,228,101,127,228,
+101,127,129,141,100,241,141,100,241,0,0,3,0,102,255,195,8,10,6,102,0,32,0,
+41,0,53,0,0,1,33,21,20,6,7,6,7,51,21,35,22,22,23,14,2,7,46,2,39,54,54,55,
+33,53,33,38,39,38,38,53,1,38,39,35,6,7,22,23,54,1,20,23,23,22,23,51,54,55,
+54,54,53,4,127,3,139,55,61,119,17,252,250,15,98,76,17,125,174,77,69,181,126,
+16,77,96,14,250,239,5,19,16,119,66,49,2,180,150,28,123,23,153,53,185,187,
+254,30,57,54,114,12,117,9,117,73,39,6,102,122,31,111,96,191,124,129,120,205,
+69,85,202,174,40,34,181,204,82,71,207,116,129,121,194,105,102,31,251,167,
+180,251,248,183,158,165,169,4,236,47,89,84,178,148,149,177,113,77,30,0,0,
+3,0,164,0,0,3,231,6,102,0,24,0,28,0,33,0,0,33,33,53,51,53,33,53,52,55,55,
+18,18,54,51,50,22,18,19,23,22,21,21,33,21,51,17,2,3,17,3,6,2,3,51,3,61,254,
+0,185,254,174,51,23,53,99,112,78,79,111,102,58,22,47,254,158,184,97,87,143,
+35,99,42,176,129,254,23,116,239,116,1,32,1,73,144,140,254,190,254,206,112,
+237,115,23,254,1,127,2,60,1,55,252,141,3,90,115,254,31,254,250,0,0,2,0,225,
+0,0,2,174,6,102,0,10,0,17,0,0,1,21,22,18,21,20,2,7,17,35,17,1,52,38,39,17,
+54,54,1,113,149,168,169,148,144,1,62,93,81,80,94,6,102,254,87,254,223,168,
+170,254,220,83,254,217,6,102,252,226,107,198,72,253,14,69,195,0,0,3,0,164,
+0,0,3,231,6,102,0,24,0,28,0,33,0,0,1,35,21,33,21,20,7,7,2,2,6,35,34,38,2,
+3,39,38,53,53,33,53,35,53,33,17,35,17,18,3,17,35,18,18,3,61,184,1,98,47,22,
+61,101,110,78,77,111,98,56,23,51,1,82,185,2,0,184,86,229,176,40,101,5,229,
+254,22,113,239,113,254,197,254,196,137,143,1,63,1,44,115,239,117,22,254,129,
+254,0,252,142,1,46,254,234,3,90,255,0,254,26,0,0,16,0,164,255,236,14,152,
+6,39,0,62,0,85,0,91,0,98,0,114,0,131,0,134,0,151,0,168,0,173,0,177,0,182,
+0,187,0,192,0,197,0,202,0,0,1,52,54,51,50,22,23,17,33,17,35,34,38,38,53,52,
+54,54,51,33,1,54,53,52,39,55,30,2,21,20,6,7,22,22,21,20,6,6,7,39,54,53,52,
+39,5,21,35,53,7,21,35,53,7,21,35,53,7,6,6,35,34,38,1,54,55,55,37,33,21,55,
+23,51,62,2,55,51,23,51,62,2,55,51,23,1,53,33,22,22,51,17,34,6,7,33,53,39,
+1,23,7,6,21,20,6,35,35,39,55,50,54,53,52,54,19,23,14,2,21,20,6,35,35,39,55,
+50,54,53,52,54,1,7,37,19,23,7,6,6,21,20,6,35,35,39,55,50,54,53,52,54,19,23,
+7,6,6,21,20,6,35,35,39,55,50,54,53,52,54,5,55,53,39,7,39,17,55,53,5,55,53,
+39,7,1,22,22,23,53,23,54,54,55,35,3,6,6,7,51,33,38,38,39,21,3,63,197,141,
+81,139,47,253,120,170,121,211,122,122,210,122,5,7,4,161,154,164,21,74,137,
+82,137,101,102,136,81,138,74,21,164,154,253,164,143,182,144,202,144,164,6,
+197,135,142,196,6,50,2,56,22,253,139,254,223,37,121,8,1,6,12,77,121,121,8,
+1,6,12,77,101,120,249,29,254,186,20,166,113,110,166,23,1,70,13,11,214,74,
+28,42,109,92,13,13,20,32,48,62,49,73,36,22,11,109,92,13,14,21,32,48,60,252,
+69,133,2,30,4,64,26,21,13,100,100,13,14,21,39,40,52,30,64,26,20,13,103,98,
+13,14,21,39,41,51,251,162,202,100,102,236,92,1,234,182,94,88,251,84,14,74,
+53,127,49,75,15,139,127,51,74,14,139,1,10,15,75,49,1,51,139,193,68,57,2,70,
+253,12,117,206,119,120,206,117,254,215,55,201,210,44,137,12,117,174,90,126,
+215,34,36,214,125,90,174,118,11,137,44,210,201,55,149,193,156,45,172,137,
+51,158,123,41,134,179,190,2,88,21,103,46,156,154,23,205,6,18,26,155,195,6,
+18,26,155,205,254,217,246,106,140,2,105,135,107,240,2,1,77,86,26,41,66,107,
+122,2,117,65,45,85,105,252,234,86,34,32,41,26,107,122,2,116,64,47,85,104,
+1,75,235,135,2,92,80,21,14,33,30,102,111,2,121,50,40,72,73,252,238,80,21,
+13,32,32,103,110,2,121,50,40,71,74,57,51,94,170,178,154,254,163,23,170,49,
+45,14,158,156,254,115,53,78,17,148,148,17,78,53,1,4,15,77,51,51,75,17,143,
+0,0,14,0,164,0,39,14,152,6,39,0,49,0,58,0,81,0,87,0,90,0,97,0,113,0,130,0,
+134,0,151,0,168,0,173,0,177,0,182,0,0,1,53,35,34,38,38,53,52,54,54,51,33,
+1,54,53,52,39,55,30,2,21,20,6,7,22,22,21,20,6,6,7,39,54,53,52,39,5,21,35,
+53,7,21,35,53,7,21,35,53,7,1,21,51,50,22,21,17,33,17,1,54,54,55,37,33,21,
+55,23,51,62,2,55,51,23,51,62,2,55,51,23,5,22,22,51,51,53,37,3,37,1,39,35,
+34,6,7,33,1,23,7,6,21,20,6,35,35,39,55,50,54,53,52,54,19,23,14,2,21,20,6,
+35,35,39,55,50,54,53,52,54,37,17,51,17,5,23,7,6,6,21,20,6,35,35,39,55,50,
+54,53,52,54,19,23,7,6,6,21,20,6,35,35,39,55,50,54,53,52,54,1,55,53,39,7,39,
+17,55,53,5,55,53,39,7,2,133,27,121,211,122,122,210,122,5,7,4,161,154,164,
+21,74,137,82,137,101,102,136,81,138,74,21,164,154,253,164,143,182,144,202,
+144,92,252,233,111,73,93,1,115,3,213,1,22,54,253,142,254,223,37,121,8,1,6,
+12,77,123,119,8,1,6,12,77,101,120,247,215,20,166,113,27,7,195,146,2,47,246,
+160,13,14,110,166,23,1,70,11,201,74,28,42,109,92,13,13,20,32,48,62,49,73,
+36,22,11,109,92,13,14,21,32,48,60,245,17,134,8,34,64,26,20,13,103,98,13,14,
+21,39,41,51,112,64,26,21,13,100,100,13,14,21,39,40,52,251,121,202,100,102,
+236,92,1,234,182,94,88,1,0,84,117,206,119,120,206,117,254,215,55,201,210,
+44,137,12,117,174,90,126,215,34,36,214,125,90,174,118,11,137,44,210,201,55,
+172,170,129,51,139,98,57,113,72,27,3,72,183,86,65,254,135,2,199,254,186,12,
+50,108,156,154,23,205,6,18,26,155,195,6,18,26,155,205,49,106,140,246,186,
+254,252,158,1,29,2,135,107,2,63,86,26,41,66,107,122,2,117,65,45,85,105,252,
+234,86,34,32,41,26,107,122,2,116,64,47,85,104,208,254,113,1,143,192,80,21,
+13,32,32,103,110,2,121,50,40,71,74,3,84,80,21,14,33,30,102,111,2,121,50,40,
+72,73,252,103,57,133,170,178,154,254,110,25,221,82,51,41,158,156,0,0,3,0,
+102,0,0,15,31,4,143,0,15,0,24,0,28,0,0,55,51,17,33,17,51,54,0,0,37,23,4,0,
+0,7,33,1,21,51,50,22,21,17,33,17,1,17,51,17,102,230,4,104,113,197,3,20,3,
+205,1,35,49,254,127,252,35,253,47,172,250,34,1,117,109,73,93,2,55,252,182,
+131,129,4,14,251,242,160,1,135,1,103,67,125,102,254,143,254,151,149,4,14,
+223,89,62,253,233,3,141,254,160,253,211,2,45,0,9,0,135,0,104,6,18,5,242,0,
+15,0,26,0,36,0,47,0,57,0,67,0,77,0,86,0,96,0,0,19,52,18,36,51,50,4,18,21,
+20,2,4,35,34,36,2,1,54,54,55,38,38,39,33,17,22,22,1,38,38,39,6,6,7,17,33,
+54,1,22,22,23,54,54,55,17,33,6,6,1,6,6,7,22,22,23,33,17,38,55,34,7,22,22,
+51,50,54,55,38,3,50,55,38,38,35,34,6,7,22,1,23,54,54,53,52,38,39,6,5,52,39,
+6,6,21,20,22,23,54,135,191,1,73,191,188,1,71,193,192,254,185,189,190,254,
+183,192,3,119,122,195,43,75,114,22,254,246,53,59,1,109,41,189,128,6,60,53,
+1,13,46,252,109,42,192,125,6,56,48,255,0,23,114,1,29,126,191,42,71,111,25,
+1,4,95,167,36,44,2,43,35,30,45,5,47,33,39,41,5,44,31,34,44,2,37,253,244,4,
+55,74,75,54,4,4,108,6,54,73,73,54,6,3,45,190,1,74,189,187,254,183,193,191,
+254,182,188,189,1,73,254,156,42,195,134,6,58,51,254,247,21,119,2,132,126,
+196,45,79,119,23,255,0,93,254,175,129,196,44,75,114,24,1,15,51,58,2,203,44,
+196,127,6,56,48,1,6,50,196,7,54,83,75,62,7,251,129,6,61,76,86,51,6,2,63,80,
+4,45,31,31,43,4,38,40,40,38,4,44,30,31,45,4,40,0,5,0,164,0,0,7,92,6,102,0,
+61,0,67,0,73,0,78,0,83,0,0,1,21,20,22,23,22,22,21,21,35,53,1,17,35,17,1,21,
+35,53,52,54,55,54,54,53,53,35,21,20,6,7,6,6,21,21,35,53,52,54,55,54,54,53,
+53,33,21,20,22,23,22,22,21,21,35,53,52,38,39,38,38,53,53,33,21,20,7,23,17,
+51,17,55,38,53,53,1,6,7,1,53,51,21,1,38,39,5,41,72,77,77,71,143,254,133,144,
+254,133,143,71,78,75,73,123,72,76,84,65,143,72,77,79,69,4,102,70,79,77,71,
+143,65,83,76,73,253,194,108,190,144,190,108,254,16,53,27,1,94,144,1,94,27,
+53,5,229,161,58,118,73,75,119,59,232,174,254,230,254,6,1,250,1,26,174,232,
+59,120,74,72,118,59,161,143,63,123,70,78,94,45,238,252,60,121,73,75,104,49,
+249,249,49,105,74,74,120,60,252,238,45,94,78,70,123,63,143,184,109,118,150,
+2,49,253,207,150,118,109,184,254,19,58,40,254,235,172,172,1,21,40,58,0,2,
+0,225,1,199,7,184,4,141,0,3,0,7,0,0,19,17,33,17,37,33,17,33,225,6,215,249,
+185,5,184,250,72,1,199,2,198,253,58,129,1,196,0,3,0,225,0,0,5,31,6,102,0,
+16,0,25,0,45,0,0,1,21,23,20,22,22,51,50,54,54,53,55,53,51,17,33,17,1,34,38,
+39,17,33,17,6,6,23,21,35,53,35,21,51,21,35,17,35,17,35,53,51,53,35,21,35,
+53,1,113,116,80,135,70,72,132,75,118,144,251,194,2,31,155,222,22,3,30,24,
+220,115,114,84,102,102,144,102,102,84,114,6,102,86,77,88,149,85,86,147,89,
+77,86,249,154,6,102,253,152,200,164,251,23,4,227,164,194,123,203,74,174,109,
+254,242,1,14,109,174,74,203,0,0,3,0,164,0,0,3,231,6,176,0,11,0,36,0,48,0,
+0,19,52,54,51,50,22,21,20,6,35,34,38,3,55,39,55,23,55,23,7,23,55,39,55,23,
+55,23,7,23,7,39,7,17,35,17,39,7,19,20,22,51,50,54,53,52,38,35,34,6,236,194,
+143,141,197,196,142,143,194,72,98,96,86,86,70,79,65,160,159,65,80,69,86,86,
+96,98,88,94,164,143,164,94,110,122,89,89,122,123,88,87,124,5,100,137,195,
+193,139,136,191,191,254,24,100,86,72,76,74,76,74,141,141,74,76,74,76,72,86,
+100,80,104,147,253,135,2,121,147,104,2,194,88,125,127,86,86,127,125,0,0,2,
+0,164,0,14,8,184,3,227,0,22,0,29,0,0,1,22,21,20,0,4,35,34,36,0,53,52,55,51,
+6,21,20,23,33,54,53,52,39,1,50,36,55,33,22,4,8,170,14,254,214,254,17,239,
+240,254,13,254,215,12,133,10,162,5,196,162,12,252,139,145,1,57,134,251,92,
+134,1,60,3,227,75,70,209,254,126,241,243,1,128,209,74,71,52,75,203,173,175,
+201,63,64,252,187,108,96,96,108,0,12,0,164,255,236,7,113,6,88,0,33,0,41,0,
+53,0,65,0,77,0,89,0,101,0,113,0,125,0,137,0,149,0,161,0,0,1,52,55,35,21,33,
+53,33,17,33,53,33,55,23,7,21,51,50,22,21,20,7,22,21,21,35,17,52,38,35,34,
+21,17,35,3,21,51,50,54,53,52,35,1,52,54,51,50,22,21,20,6,35,34,38,1,52,54,
+51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,
+22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,23,52,54,51,50,22,21,
+20,6,35,34,38,23,52,54,51,50,22,21,20,6,35,34,38,23,52,54,51,50,22,21,20,
+6,35,34,38,23,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,
+34,38,5,174,98,114,253,143,1,225,253,54,3,12,229,84,235,145,157,150,155,133,
+119,44,46,86,119,16,180,72,82,152,250,80,51,37,37,51,51,37,37,51,2,192,51,
+37,38,50,50,38,37,51,3,93,50,38,37,51,51,37,38,50,253,194,51,37,37,51,51,
+37,37,51,252,94,51,37,37,51,51,37,37,51,62,51,37,37,51,51,37,37,51,82,51,
+37,37,51,51,37,37,51,102,51,37,37,51,51,37,37,51,164,51,37,37,51,51,37,37,
+51,3,18,51,37,38,50,50,38,37,51,2,16,219,62,94,129,1,182,129,213,90,219,92,
+100,107,149,42,48,249,243,1,22,68,86,152,254,232,3,51,176,47,43,86,1,164,
+37,51,51,37,37,51,51,250,219,37,51,51,37,37,51,51,65,37,51,51,37,38,50,50,
+66,37,51,51,37,37,51,51,4,195,37,51,51,37,37,51,51,209,37,51,51,37,37,51,
+51,209,38,50,50,38,37,51,51,208,37,51,51,37,37,51,51,189,38,50,50,38,37,51,
+51,210,37,51,51,37,38,50,50,0,13,0,102,255,236,8,18,6,102,0,27,0,35,0,47,
+0,59,0,71,0,83,0,95,0,107,0,119,0,131,0,143,0,155,0,167,0,0,1,36,53,52,54,
+36,51,32,4,21,20,6,7,39,54,54,53,52,38,35,34,4,6,21,20,22,22,23,1,33,53,51,
+17,51,17,51,1,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,
+34,38,1,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,
+7,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,1,52,
+54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,19,52,54,51,
+50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,
+21,20,6,35,34,38,4,27,254,153,203,1,102,215,1,42,1,44,141,127,45,72,92,213,
+221,178,254,219,170,57,93,104,2,28,254,0,185,143,184,253,162,51,37,37,51,
+51,37,37,51,253,164,51,37,37,51,51,37,37,51,2,248,51,37,37,51,51,37,37,51,
+1,225,51,37,37,51,51,37,37,51,233,51,37,37,51,51,37,37,51,251,4,51,37,37,
+51,51,37,37,51,1,227,51,37,37,51,51,37,37,51,253,229,51,37,38,51,51,38,37,
+51,172,51,37,38,51,51,38,37,51,2,127,51,37,38,51,51,38,37,51,2,129,51,37,
+38,51,51,38,37,51,1,16,152,254,125,218,126,206,202,131,198,54,111,38,146,
+90,129,144,89,156,89,63,99,80,55,254,129,129,3,25,252,231,2,35,37,51,51,37,
+37,51,51,217,37,51,51,37,37,51,51,1,242,37,51,51,37,37,51,51,1,14,37,51,51,
+37,37,51,51,102,37,51,51,37,37,51,51,252,2,37,51,51,37,37,51,51,2,242,37,
+51,51,37,37,51,51,252,60,37,51,51,37,38,50,50,2,83,37,51,51,37,38,50,50,2,
+126,37,51,51,37,37,51,51,254,0,37,51,51,37,37,51,51,0,2,0,205,255,207,7,18,
+6,100,0,43,0,86,0,0,1,20,6,35,34,38,39,38,38,35,34,6,6,21,20,18,51,50,54,
+54,55,54,54,51,50,22,22,21,20,14,2,35,34,36,2,53,52,18,36,51,50,4,22,37,32,
+23,23,22,22,51,50,54,53,52,46,2,35,34,4,2,21,20,18,4,51,50,54,54,53,52,38,
+35,34,7,14,2,35,34,36,2,53,52,18,36,6,248,114,60,33,91,83,66,180,137,139,
+222,122,252,212,119,173,137,55,55,54,28,39,92,57,172,214,253,170,233,254,
+147,198,205,1,121,237,184,1,91,229,253,6,1,6,170,41,51,51,15,18,37,120,190,
+218,113,206,254,186,179,166,1,74,193,192,252,233,39,20,12,11,63,169,219,138,
+173,254,245,146,147,1,27,4,90,52,99,72,104,79,80,123,229,147,231,254,239,
+41,88,61,61,40,58,87,44,84,179,125,58,211,1,126,244,253,1,129,210,147,255,
+183,174,47,64,51,34,20,52,150,122,65,181,254,176,219,207,254,194,189,75,179,
+59,35,41,15,85,124,63,154,1,29,184,175,1,21,166,0,1,0,102,1,178,10,104,5,
+63,0,19,0,0,19,33,38,38,39,53,30,2,23,21,14,2,7,53,54,54,55,33,102,9,29,65,
+189,98,99,212,208,62,62,213,210,96,105,203,60,246,211,3,195,73,128,34,145,
+16,120,201,101,33,101,204,117,16,146,36,142,76,0,3,0,225,0,225,6,233,5,229,
+0,11,0,17,0,21,0,0,1,3,17,33,53,33,19,33,17,33,17,19,53,53,33,17,35,17,1,
+17,33,3,1,215,102,3,227,252,174,123,3,102,250,254,103,5,161,143,254,250,253,
+164,82,4,229,254,27,254,98,133,2,248,252,2,2,37,1,223,127,129,250,252,4,131,
+253,4,1,246,254,10,0,3,0,102,0,0,12,172,6,102,0,3,0,23,0,51,0,0,33,33,53,
+33,37,1,46,3,53,52,54,55,23,6,6,21,20,30,2,23,1,1,30,7,23,30,3,23,7,38,36,
+39,46,7,39,12,172,249,213,6,43,253,227,248,201,38,74,58,35,30,21,107,11,12,
+13,21,24,12,7,92,246,33,30,69,75,80,81,80,75,69,29,94,189,177,158,64,41,156,
+254,153,196,32,75,81,86,87,85,80,73,30,129,55,2,60,11,25,36,50,37,36,74,22,
+56,8,37,8,14,19,13,9,4,253,198,5,49,45,146,181,204,205,194,162,118,25,9,28,
+33,37,18,127,50,62,20,19,114,165,204,216,216,190,151,43,0,5,0,225,0,0,8,18,
+6,152,0,7,0,11,0,17,0,21,0,25,0,0,1,35,17,33,17,33,53,33,1,33,17,33,1,21,
+33,17,33,21,19,51,17,35,1,51,17,35,8,14,102,249,57,4,111,2,194,250,125,3,
+107,252,149,254,226,6,18,254,37,225,144,144,250,232,143,143,4,135,251,121,
+6,102,50,249,233,4,6,1,94,221,1,15,50,250,156,4,6,251,250,4,6,0,0,4,0,205,
+255,236,7,223,6,172,0,61,0,90,0,107,0,110,0,0,1,21,51,50,54,54,53,52,38,39,
+55,22,23,30,2,51,50,54,55,54,55,23,6,6,21,20,22,22,51,51,53,51,17,35,17,35,
+6,21,20,22,22,23,7,38,36,39,35,32,5,39,62,2,53,52,38,39,35,17,35,17,37,55,
+6,35,34,39,22,21,20,6,7,22,21,20,6,6,7,54,33,32,23,46,2,53,52,55,38,38,19,
+35,17,35,17,35,17,35,17,35,17,51,1,23,7,23,51,35,39,7,1,92,150,53,97,61,88,
+70,51,57,53,86,121,127,64,89,160,87,124,48,51,70,88,61,97,53,150,143,143,
+119,49,70,124,70,59,176,254,127,224,14,254,53,254,172,59,71,123,70,25,24,
+119,143,4,155,5,131,142,169,118,7,138,102,63,32,54,57,248,1,94,1,86,248,58,
+53,32,61,104,134,41,143,82,143,82,144,95,1,47,90,84,151,39,194,74,76,5,2,
+162,80,132,63,72,117,18,106,19,35,58,51,29,49,52,74,17,106,18,116,73,62,132,
+81,162,253,234,1,0,121,164,112,237,219,71,100,113,107,3,223,100,73,217,235,
+114,68,153,64,255,0,2,22,111,57,68,68,24,33,117,213,41,156,147,89,161,142,
+100,109,109,102,140,159,91,146,157,43,215,252,184,1,56,254,200,1,56,254,200,
+1,185,1,73,80,88,161,77,77,0,3,0,225,255,236,7,139,5,106,0,22,0,26,0,30,0,
+0,1,17,20,2,4,35,34,36,2,53,17,51,17,20,23,1,17,51,17,1,54,53,17,1,36,55,
+1,1,22,5,17,7,139,216,254,123,247,245,254,124,221,144,100,2,25,143,2,25,102,
+253,129,1,29,165,254,62,253,174,169,1,26,5,106,253,70,203,254,186,179,174,
+1,72,206,2,186,253,70,186,135,1,213,2,38,253,218,254,43,140,181,2,186,251,
+9,15,144,1,136,254,120,142,17,2,37,0,0,4,0,102,1,37,9,229,3,248,0,22,0,34,
+0,42,0,50,0,0,1,6,4,35,34,36,39,6,35,34,38,53,52,54,51,33,50,22,21,20,6,35,
+34,1,6,21,20,4,4,51,50,36,36,53,39,5,38,53,53,6,6,21,20,37,20,7,50,53,52,
+38,39,8,29,135,254,74,185,182,254,73,137,43,69,159,188,186,183,6,158,184,
+184,188,158,42,249,204,6,1,11,1,112,133,139,1,102,1,13,4,249,182,57,100,93,
+7,209,57,250,86,107,2,70,124,165,165,124,7,119,99,118,105,108,115,100,118,
+1,56,36,32,69,197,135,131,198,72,68,205,81,89,49,5,51,50,113,170,89,81,113,
+46,54,6,0,4,0,102,0,221,9,49,5,168,0,25,0,51,0,57,0,63,0,0,1,17,22,21,20,
+6,35,33,21,51,21,33,53,51,53,33,34,38,53,52,55,17,33,17,33,17,1,34,6,6,21,
+20,22,51,33,50,22,21,21,33,53,52,54,51,33,50,54,53,52,38,38,35,39,50,23,17,
+35,17,5,54,51,51,17,35,8,254,51,180,170,254,22,80,253,37,80,254,23,171,180,
+52,1,174,5,8,250,67,23,91,68,126,118,1,199,70,95,1,29,94,72,1,199,117,126,
+67,91,24,2,50,65,156,249,74,61,54,40,155,5,168,253,160,86,66,112,119,107,
+129,129,107,120,111,71,81,2,96,254,80,1,176,253,207,74,95,28,51,53,86,66,
+84,84,64,88,53,51,28,95,74,129,35,1,82,254,209,35,35,1,47,0,7,0,102,255,236,
+7,119,7,90,0,70,0,83,0,93,0,102,0,112,0,122,0,131,0,0,1,20,6,7,22,21,20,6,
+7,17,35,17,38,38,53,6,7,22,23,20,6,7,17,35,17,38,38,53,52,55,38,39,6,6,7,
+17,35,17,38,38,53,52,55,38,38,53,53,38,38,53,52,54,51,50,22,21,20,6,7,33,
+38,53,52,54,51,50,22,21,20,6,7,5,6,21,20,22,4,51,50,36,54,53,52,39,1,34,21,
+20,22,51,50,53,52,38,33,34,21,20,51,50,54,53,52,1,7,7,6,21,20,51,50,53,52,
+37,6,6,21,20,51,50,53,52,39,5,34,21,20,51,50,54,53,52,7,16,105,99,71,52,48,
+143,47,54,74,96,18,5,53,48,143,48,52,18,93,73,2,48,50,143,47,54,64,100,107,
+54,49,98,85,74,87,36,29,4,227,65,87,75,85,97,50,53,250,76,6,173,1,71,166,
+171,1,65,171,4,250,148,66,32,31,60,22,5,141,58,60,32,31,254,221,30,31,6,59,
+64,251,221,29,18,59,64,7,1,177,58,60,32,31,5,45,147,248,90,55,105,71,110,
+24,254,17,1,239,20,111,72,25,18,33,65,72,109,24,254,160,1,96,22,110,77,50,
+44,13,28,65,111,25,254,17,1,239,21,109,79,102,52,89,248,150,162,25,112,68,
+91,99,103,83,63,98,26,58,129,84,102,99,91,68,112,25,107,36,60,144,239,153,
+150,240,146,50,46,1,142,84,63,54,117,35,49,84,117,54,63,84,252,12,19,18,18,
+29,117,117,75,7,3,47,32,117,117,27,16,102,84,117,54,63,84,0,2,0,135,255,252,
+5,174,6,102,0,32,0,63,0,0,1,20,14,5,35,34,46,2,2,53,52,54,54,55,54,54,53,
+35,53,33,21,35,20,22,23,30,2,7,52,38,38,39,38,38,39,33,6,6,7,14,2,21,20,30,
+5,51,50,62,5,5,174,22,50,79,108,110,140,148,165,116,156,146,79,45,105,145,
+10,19,88,3,80,89,18,11,146,105,44,137,34,80,103,54,45,2,254,103,5,43,53,99,
+81,35,41,64,85,91,61,79,102,88,93,56,94,88,63,38,3,53,70,134,154,158,156,
+109,44,38,171,238,1,3,119,151,167,92,37,3,112,126,129,129,125,113,3,38,91,
+168,150,114,127,70,27,16,134,200,201,133,16,27,73,131,107,90,164,145,131,
+106,45,19,12,35,112,140,146,164,0,4,0,90,255,252,7,39,6,102,0,61,0,96,0,107,
+0,118,0,0,1,20,6,35,34,39,22,22,21,20,14,5,35,34,46,2,2,53,52,55,6,35,34,
+38,53,52,54,51,50,22,21,20,7,54,55,54,53,52,38,39,53,33,21,6,21,20,23,22,
+22,23,38,53,52,54,51,50,22,1,52,38,38,39,38,38,53,52,55,33,22,21,20,6,7,14,
+2,21,20,30,5,51,50,62,5,19,34,6,21,20,22,51,50,54,53,52,33,34,21,20,22,51,
+50,54,53,52,38,7,39,138,94,21,15,32,27,22,50,79,108,110,140,148,165,116,156,
+146,79,57,16,22,93,139,92,78,76,115,25,53,119,20,45,51,3,82,90,45,51,83,34,
+25,114,77,79,91,254,166,34,81,102,59,54,86,253,193,79,50,38,94,83,38,41,64,
+85,91,61,79,102,88,93,56,94,88,63,38,172,36,50,18,13,49,69,250,80,63,69,49,
+14,17,50,5,104,102,149,6,49,150,119,70,134,154,158,156,109,44,38,171,238,
+1,3,119,228,92,8,150,101,70,82,135,84,61,52,33,31,7,40,28,93,82,120,127,111,
+71,49,12,16,28,22,52,63,83,136,83,253,136,114,126,71,27,16,60,51,88,135,117,
+77,65,83,8,20,71,134,113,90,164,145,131,106,45,19,12,35,112,140,146,164,2,
+190,70,47,29,55,83,52,66,66,53,82,56,28,48,69,0,0,3,0,102,0,0,5,41,6,102,
+0,28,0,48,0,59,0,0,1,35,21,22,22,21,20,6,7,6,3,33,2,39,38,38,53,52,55,7,39,
+37,38,38,53,52,54,51,33,1,20,22,23,22,19,51,18,55,54,54,53,52,37,39,17,35,
+17,7,4,19,34,6,6,21,20,22,23,54,55,53,4,106,104,135,160,41,74,123,34,254,
+67,34,122,77,39,6,174,62,1,86,123,112,133,164,2,112,253,109,32,72,114,36,
+203,36,114,72,32,254,233,20,113,22,254,235,59,120,57,25,124,97,38,40,5,229,
+243,46,204,131,58,105,135,225,254,150,1,106,225,140,100,58,38,33,106,113,
+198,81,153,82,94,67,253,15,47,76,117,185,254,181,1,75,185,117,77,46,234,57,
+2,1,75,254,181,2,58,1,135,7,18,18,46,131,56,19,14,243,0,3,0,102,0,0,4,190,
+6,102,0,26,0,48,0,59,0,0,1,35,21,22,22,21,20,6,7,6,3,33,2,39,38,38,53,52,
+55,38,38,53,52,54,54,51,33,3,18,55,62,2,53,52,37,39,17,35,17,7,4,21,20,22,
+23,23,22,19,3,34,6,6,21,20,22,23,54,55,53,4,0,104,137,157,41,74,123,34,254,
+68,33,124,77,39,117,127,113,55,129,113,2,113,203,35,116,28,46,29,254,234,
+21,112,23,254,236,29,23,52,113,36,194,121,57,25,124,97,46,32,5,229,243,47,
+206,128,58,105,135,225,254,150,1,104,227,140,100,58,161,113,85,151,82,64,
+67,30,250,27,1,70,190,47,76,71,46,233,58,2,1,75,254,181,2,58,233,46,71,38,
+85,188,254,184,5,100,7,18,18,46,131,56,22,11,243,0,0,5,0,102,0,0,5,213,6,
+102,0,37,0,58,0,68,0,77,0,84,0,0,1,35,21,22,23,50,22,21,20,6,7,6,7,14,2,7,
+33,46,2,39,38,39,38,38,53,52,54,55,38,38,53,52,54,54,51,33,3,18,55,62,2,53,
+52,37,39,17,35,17,7,4,21,20,22,23,22,19,3,34,6,6,21,20,23,54,55,53,3,14,2,
+21,20,23,53,52,37,22,23,54,53,52,38,4,78,105,67,60,187,182,109,112,14,21,
+85,70,50,12,254,67,13,48,66,80,21,15,115,115,110,97,59,70,57,131,126,2,96,
+203,35,116,28,46,29,254,233,20,113,22,254,235,32,72,114,36,194,121,57,25,
+221,46,32,190,58,84,45,82,3,164,53,4,82,62,5,229,243,22,42,107,116,91,99,
+19,37,37,152,186,224,134,133,224,176,144,37,36,16,102,93,99,149,32,53,114,
+69,65,67,29,250,27,1,70,190,47,76,71,46,234,57,2,1,75,254,181,2,58,233,47,
+76,117,185,254,181,5,100,7,18,18,90,143,22,11,243,254,150,10,58,77,39,62,
+31,15,153,45,86,106,27,63,40,51,0,5,0,102,0,0,5,190,6,102,0,39,0,48,0,58,
+0,77,0,80,0,0,1,22,22,21,20,7,23,17,35,17,39,6,7,3,35,3,38,39,7,17,35,17,
+55,38,53,52,54,55,38,38,53,52,54,51,33,50,22,21,20,6,5,23,54,54,53,52,38,
+35,35,33,34,6,6,21,20,22,23,55,3,51,19,14,2,21,20,22,22,51,50,54,54,53,52,
+38,38,39,19,3,23,55,4,150,136,160,184,82,143,58,88,114,113,131,115,109,94,
+55,143,80,183,160,137,121,110,133,166,2,113,183,130,108,254,208,35,109,149,
+58,124,66,253,219,120,57,25,150,108,33,43,141,51,133,223,125,143,253,144,
+146,253,142,126,224,131,51,164,53,52,4,139,61,191,110,174,127,164,254,176,
+1,41,137,38,23,254,139,1,117,21,40,137,254,215,1,80,164,126,175,109,192,61,
+80,154,80,93,68,68,93,79,152,23,9,55,146,51,26,17,7,18,18,51,147,54,9,1,30,
+254,127,9,89,138,79,85,147,85,86,145,86,79,140,89,7,1,129,251,129,170,170,
+0,2,0,102,0,0,6,92,3,100,0,34,0,52,0,0,37,35,34,6,7,21,33,53,38,38,35,35,
+53,54,53,52,39,38,38,39,55,22,22,51,33,50,54,55,23,6,7,6,21,20,23,33,50,22,
+23,51,54,54,51,51,38,53,52,55,33,22,21,20,7,5,143,159,63,118,28,254,133,28,
+117,64,160,80,35,71,129,50,107,24,123,66,3,119,67,122,24,106,102,148,35,80,
+252,101,80,148,56,162,55,149,81,29,43,24,253,16,25,43,190,70,54,66,66,54,
+70,129,48,104,67,70,10,98,83,69,58,75,75,58,69,169,22,70,67,104,48,100,90,
+88,102,69,85,65,68,66,67,85,69,0,0,4,0,102,0,0,5,57,6,102,0,28,0,50,0,60,
+0,70,0,0,1,22,21,20,6,7,6,3,33,2,39,38,38,53,52,55,38,38,53,52,54,54,51,33,
+50,22,21,20,6,1,18,55,62,2,53,52,37,35,17,35,17,35,4,21,20,22,23,23,22,19,
+3,34,6,21,20,22,23,54,55,53,5,22,23,54,54,53,52,38,35,35,4,74,116,41,74,123,
+34,254,68,33,124,77,39,117,127,113,57,131,126,2,96,183,130,115,254,111,35,
+116,28,46,29,254,250,37,112,39,254,252,29,23,52,113,36,215,125,57,124,97,
+46,32,1,144,30,45,98,126,59,144,96,4,135,114,160,58,105,135,225,254,150,1,
+104,227,140,100,58,161,113,85,151,82,65,67,29,68,93,81,154,251,167,1,70,190,
+47,76,71,46,227,62,1,79,254,177,62,227,46,71,38,85,188,254,184,5,100,18,25,
+46,131,56,22,11,243,243,10,23,57,131,45,26,17,0,0,5,0,158,255,252,7,90,6,
+102,0,48,0,81,0,93,0,105,0,117,0,0,5,34,46,5,53,52,55,38,38,53,52,62,2,33,
+32,30,2,21,20,6,7,22,23,54,54,53,52,54,54,51,50,22,22,21,20,6,6,7,14,4,1,
+14,2,7,14,2,21,20,30,2,23,22,22,51,50,54,55,62,3,53,52,38,38,39,46,2,53,5,
+52,38,38,39,20,22,23,22,23,54,54,37,20,22,23,54,55,54,54,55,14,2,1,23,54,
+54,53,52,35,34,6,21,20,6,3,70,163,136,69,75,63,45,27,84,91,95,50,117,228,
+1,25,1,52,221,112,45,97,92,52,22,50,32,26,69,110,96,68,26,110,221,138,7,56,
+97,90,138,254,222,2,14,35,49,103,95,38,46,60,58,12,32,132,99,108,131,31,12,
+57,57,44,39,96,103,50,36,14,1,180,62,137,108,12,19,93,40,63,80,251,205,82,
+59,55,78,17,12,2,115,131,59,4,88,2,157,183,69,28,42,92,4,19,57,122,147,159,
+180,100,252,111,60,168,93,71,61,29,13,13,33,60,68,92,168,61,64,135,10,68,
+94,59,41,17,16,41,60,98,165,127,28,121,234,211,110,26,5,246,182,116,52,13,
+28,76,136,139,133,215,156,94,12,29,20,22,27,12,94,156,215,133,142,133,77,
+27,13,58,123,169,58,20,19,14,3,139,110,3,28,19,39,132,72,71,136,36,26,21,
+3,111,138,3,14,19,253,130,47,39,163,105,16,5,11,99,126,0,4,0,102,0,0,10,125,
+6,102,0,38,0,75,0,87,0,99,0,0,1,21,35,7,33,50,22,21,16,5,22,21,20,2,6,7,14,
+2,35,33,34,38,39,38,38,2,53,52,55,36,17,52,54,51,33,39,35,53,1,51,50,62,2,
+53,52,38,39,38,53,55,33,23,20,7,6,17,20,18,22,22,51,51,17,35,21,35,17,51,
+21,33,21,33,17,33,1,54,54,53,52,38,38,35,33,30,2,5,62,2,55,33,34,6,6,21,20,
+22,8,145,88,30,1,47,151,156,254,139,4,96,189,100,38,60,96,103,254,31,139,
+109,49,102,187,96,4,254,139,156,152,1,47,31,88,3,205,47,140,139,191,93,122,
+126,55,80,251,160,79,55,248,95,191,139,139,249,223,143,143,1,227,254,29,1,
+111,2,209,112,142,31,73,68,254,165,92,88,64,249,25,19,64,86,95,254,166,69,
+72,31,138,6,102,129,69,122,120,254,251,26,31,69,141,254,231,251,79,29,21,
+9,20,39,80,253,1,22,141,69,31,26,1,5,120,122,69,129,250,27,61,243,253,125,
+171,201,34,15,89,188,188,89,15,66,254,172,127,255,0,240,59,1,195,60,2,150,
+74,129,254,242,1,82,4,73,64,56,46,21,43,68,90,63,62,90,68,44,21,47,55,63,
+73,0,0,4,0,102,0,0,6,244,5,10,0,33,0,49,0,60,0,71,0,0,1,20,7,22,22,21,20,
+6,35,34,39,6,6,7,51,21,33,53,51,38,38,39,6,35,34,38,53,52,54,55,38,53,53,
+33,5,21,20,22,23,23,18,19,51,18,19,62,2,53,53,1,38,39,35,34,6,21,20,22,51,
+50,37,22,51,50,54,53,52,38,35,35,6,5,252,21,126,143,152,125,107,110,34,56,
+12,157,252,224,157,14,54,34,110,107,123,154,143,126,21,4,158,251,242,42,33,
+73,155,39,211,36,158,40,66,42,252,178,24,87,14,91,91,83,78,66,3,108,80,66,
+78,84,91,92,14,87,4,33,50,55,5,129,103,100,136,39,85,222,82,129,129,89,217,
+83,39,135,101,103,129,5,55,50,233,129,94,46,98,58,128,254,238,254,178,1,73,
+1,23,70,116,98,46,94,253,240,46,150,53,59,48,57,21,21,57,48,60,52,150,0,0,
+2,0,102,0,109,8,2,3,63,0,11,0,23,0,0,1,6,0,4,35,34,36,38,38,39,53,33,5,30,
+3,51,50,62,3,55,8,2,97,254,236,254,138,234,184,254,219,228,187,75,7,156,248,
+252,61,164,198,245,147,153,234,174,126,94,55,2,199,220,254,253,123,72,134,
+222,178,116,129,130,173,108,58,48,81,105,123,112,0,4,0,102,0,0,9,39,6,203,
+0,43,0,65,0,79,0,93,0,0,1,54,51,51,50,22,21,20,6,35,35,34,39,22,22,21,20,
+6,7,6,2,7,33,38,2,39,38,38,53,52,54,55,6,35,35,34,38,53,52,54,51,51,50,23,
+23,21,7,6,6,21,20,22,23,18,19,33,54,19,54,54,53,52,38,39,39,53,37,52,38,35,
+35,34,6,21,20,22,51,51,50,54,37,20,22,51,51,50,54,53,52,38,35,35,34,6,6,160,
+55,215,84,145,148,147,150,76,80,43,92,91,92,98,106,128,29,253,59,27,127,108,
+99,91,90,92,43,80,76,148,149,148,145,84,216,55,59,35,119,96,68,91,184,79,
+1,227,77,187,92,66,95,120,35,252,17,54,75,125,77,52,69,60,125,60,69,4,164,
+69,60,125,59,70,54,75,125,77,52,6,102,101,92,99,115,102,10,59,157,113,101,
+217,142,153,254,248,135,131,1,6,159,145,215,100,113,157,59,10,101,116,98,
+93,101,129,200,20,57,132,88,58,149,138,254,231,254,255,250,1,32,142,146,57,
+87,133,57,20,200,33,35,33,33,35,49,33,33,49,49,33,33,49,35,33,33,0,0,4,0,
+102,0,0,7,94,5,51,0,29,0,41,0,53,0,65,0,0,1,6,35,34,38,53,52,54,51,50,23,
+33,54,51,50,22,21,20,6,35,34,39,1,21,23,21,33,53,55,53,3,1,17,7,21,33,53,
+39,17,1,53,33,39,34,6,21,20,22,51,50,54,53,52,38,33,34,6,21,20,22,51,50,54,
+53,52,38,1,199,75,108,74,96,145,97,143,33,3,178,38,141,98,143,96,74,107,75,
+254,145,123,253,176,123,254,1,142,123,1,49,123,1,141,252,170,221,52,69,27,
+24,62,86,44,4,238,35,42,85,62,23,28,69,3,231,79,101,79,91,140,82,82,141,90,
+79,101,79,254,125,247,193,172,172,193,247,1,215,254,82,254,211,190,33,33,
+190,1,45,1,174,37,105,81,46,31,41,85,56,29,29,30,28,56,85,37,35,47,80,0,3,
+0,102,0,0,4,100,6,102,0,19,0,31,0,34,0,0,1,6,6,21,17,1,21,19,21,33,53,19,
+53,1,17,52,38,39,53,33,5,22,22,21,17,19,51,19,17,52,54,55,3,39,7,4,100,36,
+68,254,174,252,253,127,252,254,174,70,35,3,254,252,189,24,31,242,55,242,31,
+24,186,138,139,5,229,4,104,55,254,167,254,125,198,254,225,129,129,1,31,198,
+1,131,1,89,56,103,4,129,129,24,123,55,255,0,254,237,1,19,1,0,56,122,24,250,
+156,154,154,0,0,3,0,164,0,0,4,219,6,102,0,27,0,52,0,56,0,0,1,20,23,30,2,21,
+20,7,51,21,33,53,51,38,53,52,54,54,55,54,53,17,35,53,33,21,35,1,20,14,6,21,
+20,22,51,51,50,54,53,52,38,38,39,46,2,53,3,35,17,51,3,195,89,94,64,33,129,
+33,252,137,33,129,35,65,92,88,108,2,223,108,254,129,24,39,50,51,50,39,24,
+155,126,239,126,155,28,50,60,71,43,25,8,231,231,4,49,130,74,80,103,147,95,
+186,129,129,129,129,186,99,147,102,77,74,130,1,180,129,129,254,78,62,88,67,
+52,51,57,77,104,73,134,181,181,134,77,112,87,61,70,72,91,61,1,178,254,195,
+0,4,0,102,0,0,8,227,6,102,0,31,0,41,0,45,0,49,0,0,1,33,21,35,6,2,2,21,21,
+33,53,52,3,39,33,17,35,53,52,54,55,53,38,38,53,53,51,17,33,38,39,35,51,18,
+18,17,21,33,53,16,18,55,1,39,35,21,35,51,53,35,2,80,6,147,82,77,136,79,252,
+90,54,2,253,103,144,88,72,71,89,144,2,47,60,71,82,229,126,161,2,139,163,124,
+251,121,43,211,227,83,83,6,102,129,146,254,48,253,234,213,152,152,241,1,68,
+8,254,238,251,63,86,3,190,2,86,64,252,254,238,196,139,254,254,252,253,254,
+202,41,41,1,49,3,12,254,253,113,190,190,190,0,0,4,0,225,0,0,6,195,5,72,0,
+25,0,29,0,41,0,53,0,0,1,20,7,51,17,33,17,51,38,53,52,54,51,50,22,21,20,7,
+33,38,53,52,54,51,50,22,1,33,17,33,19,34,6,21,20,22,51,50,54,53,52,38,33,
+34,6,21,20,22,51,50,54,53,52,38,6,174,37,58,250,30,54,33,77,85,97,85,37,3,
+78,33,77,85,97,85,250,195,4,194,251,62,45,34,24,27,33,35,28,28,4,59,34,23,
+26,33,35,28,28,3,250,182,84,253,16,2,240,78,192,178,152,157,177,182,84,78,
+192,178,152,157,251,214,1,238,2,112,93,134,158,102,101,159,132,95,93,134,
+156,104,101,159,132,95,0,2,0,102,0,0,10,186,4,215,0,74,0,97,0,0,1,35,6,21,
+20,22,23,21,6,35,33,7,33,39,33,34,38,39,53,54,54,53,52,39,38,38,53,53,52,
+62,2,53,52,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,39,55,22,51,50,54,53,
+52,39,46,2,53,52,54,54,51,50,22,22,21,20,7,7,21,33,5,22,21,20,7,22,51,33,
+50,22,22,23,51,54,54,51,33,50,55,38,53,52,55,10,186,245,35,69,64,88,219,254,
+14,2,254,119,2,254,14,105,158,44,69,64,35,82,100,20,25,20,96,76,64,99,49,
+50,53,46,117,88,66,61,21,46,60,25,45,51,67,51,30,79,143,90,81,137,77,37,21,
+8,47,248,142,24,100,55,101,1,145,53,67,43,23,176,31,82,74,1,145,101,55,100,
+24,2,125,68,67,70,120,62,47,142,61,61,71,71,47,69,115,68,67,70,3,51,42,127,
+26,33,30,36,29,45,55,61,39,49,94,55,58,93,49,71,88,12,121,10,31,28,22,61,
+78,79,82,43,63,107,63,63,108,62,46,48,29,117,129,68,65,156,108,50,14,29,38,
+51,30,50,108,156,65,68,0,0,2,0,225,0,20,6,211,6,123,0,18,0,40,0,0,1,17,20,
+14,6,35,34,38,38,10,2,53,17,19,20,22,18,18,23,22,22,51,50,54,55,54,18,18,
+54,53,53,3,33,7,3,6,211,36,60,88,95,111,85,137,148,125,110,94,203,147,83,
+137,73,133,177,31,36,79,96,105,95,27,31,171,123,71,4,251,43,3,4,6,123,253,
+174,77,165,167,180,162,160,91,43,19,67,1,38,1,32,1,12,109,2,82,253,174,98,
+237,254,250,254,253,23,24,17,19,24,25,1,6,1,0,235,99,44,1,165,125,254,221,
+0,9,0,164,0,0,10,111,7,133,0,60,0,64,0,70,0,92,0,103,0,109,0,121,0,125,0,
+129,0,0,1,55,38,53,52,54,51,50,22,21,20,7,51,37,23,7,21,7,23,22,22,21,20,
+6,7,33,21,7,33,21,51,53,51,17,35,53,35,21,33,53,35,21,35,17,51,21,51,53,33,
+39,53,33,38,38,53,52,54,55,55,39,7,1,33,17,33,1,17,33,17,33,17,1,35,21,23,
+14,3,21,20,22,23,51,54,54,53,52,46,2,39,55,19,55,33,23,7,39,7,39,55,33,23,
+1,33,53,33,17,35,5,54,54,53,52,38,35,34,6,21,20,22,1,35,21,51,33,51,53,35,
+3,47,170,154,109,100,92,111,10,229,1,4,82,200,72,34,38,28,48,40,1,158,186,
+1,182,207,123,123,207,249,76,207,123,123,207,1,182,187,1,158,40,48,26,41,
+33,51,219,254,248,5,149,250,107,6,172,1,70,253,53,254,26,237,74,19,35,27,
+16,52,34,111,34,52,16,27,35,18,73,111,234,254,151,88,63,127,125,64,88,254,
+150,233,3,209,1,172,254,187,103,252,25,6,14,43,39,40,44,76,5,107,207,207,
+247,174,207,207,5,111,143,48,151,87,105,88,72,31,34,217,96,172,121,144,62,
+66,77,34,58,142,60,170,162,129,94,254,10,113,129,129,113,1,246,94,129,162,
+170,60,143,57,33,74,70,62,99,187,251,113,1,39,5,164,254,88,254,160,3,6,254,
+217,33,147,47,65,55,53,34,59,146,47,48,146,58,34,53,55,65,47,147,252,39,203,
+115,49,164,164,49,115,203,2,156,94,1,168,109,23,52,34,31,40,44,35,42,53,250,
+215,77,77,0,0,4,0,164,255,131,10,78,7,51,0,61,0,71,0,78,0,84,0,0,33,54,54,
+55,35,2,3,35,0,19,0,1,51,2,7,51,54,19,51,2,7,33,50,22,4,22,21,20,6,7,39,54,
+54,53,52,36,36,35,33,6,7,6,2,3,33,5,17,52,54,51,51,53,51,21,20,6,35,35,17,
+35,53,37,1,51,54,55,54,55,35,6,7,6,1,23,7,39,7,39,55,3,55,23,51,21,35,1,225,
+109,112,39,182,94,158,143,1,41,88,1,70,1,12,143,159,113,178,129,115,145,120,
+115,2,40,63,234,1,20,167,75,62,74,40,44,255,0,254,216,61,253,127,120,119,
+29,153,152,2,166,2,14,94,72,146,143,94,72,145,144,254,13,252,237,186,65,34,
+106,99,174,118,120,22,3,139,243,94,188,189,94,244,242,82,199,157,210,211,
+236,100,254,241,254,236,2,5,2,38,1,17,1,247,254,219,164,188,1,13,254,245,
+190,124,222,209,61,85,164,56,96,44,116,51,52,243,190,161,56,206,254,81,254,
+238,102,1,36,64,88,164,141,64,88,254,45,8,117,2,164,194,213,63,111,145,88,
+160,1,62,183,77,127,127,77,183,254,106,98,124,129,0,2,0,102,1,4,6,254,3,16,
+0,14,0,25,0,0,1,14,3,35,34,46,3,39,33,53,33,7,33,30,3,51,50,62,2,6,254,44,
+114,105,136,154,121,109,75,94,108,40,253,180,6,152,154,252,228,36,88,77,88,
+108,109,95,75,88,2,143,86,160,102,47,17,50,100,151,77,129,129,62,114,69,25,
+20,73,119,0,2,0,102,255,236,6,68,6,123,0,25,0,37,0,0,1,14,3,35,34,46,3,53,
+17,52,35,34,17,35,54,54,51,50,22,21,17,33,7,33,30,3,51,50,62,3,6,68,44,122,
+103,141,143,140,117,111,100,55,149,150,127,8,136,133,141,152,3,164,154,252,
+227,35,91,77,85,110,77,83,56,69,80,1,119,86,169,98,42,25,104,131,126,52,3,
+143,213,254,240,210,179,176,156,252,201,129,60,116,70,25,9,22,71,108,0,5,
+0,102,0,0,8,152,5,229,0,32,0,40,0,59,0,72,0,81,0,0,1,52,38,35,34,7,23,20,
+6,6,7,6,2,3,33,2,0,3,55,22,23,33,62,2,51,50,23,54,51,50,22,23,5,22,18,19,
+51,18,18,55,19,54,54,51,50,22,21,20,6,35,39,32,53,52,38,35,34,6,7,37,6,6,
+21,20,33,7,34,38,53,52,54,55,37,54,54,53,52,38,35,34,7,8,41,67,40,77,27,4,
+105,201,132,130,161,72,254,228,130,254,199,223,115,92,65,4,46,47,65,80,53,
+56,47,62,93,92,129,3,249,81,127,226,76,43,69,224,135,28,21,101,63,75,99,191,
+178,6,1,0,40,26,29,48,11,251,172,95,79,1,0,6,189,180,126,130,4,140,106,135,
+20,17,45,73,5,25,34,66,47,31,79,148,112,27,251,254,75,254,239,1,241,2,134,
+1,12,72,101,96,76,66,40,30,71,113,85,154,204,253,232,254,224,1,12,2,32,216,
+254,100,78,84,107,79,106,113,108,113,40,36,45,35,110,8,52,46,113,108,105,
+114,99,104,14,160,37,124,58,17,22,115,0,9,0,102,255,236,7,168,5,229,0,19,
+0,39,0,51,0,63,0,75,0,87,0,99,0,111,0,123,0,0,19,54,55,6,35,34,38,38,53,52,
+54,54,51,50,22,22,21,20,2,7,37,33,34,6,21,20,22,22,51,33,21,33,34,38,38,53,
+52,54,51,33,1,52,38,35,34,6,21,20,22,51,50,54,1,52,54,51,50,22,21,20,6,35,
+34,38,7,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,
+3,52,54,51,50,22,21,20,6,35,34,38,19,52,54,51,50,22,21,20,6,35,34,38,19,52,
+54,51,50,22,21,20,6,35,34,38,244,165,128,26,26,103,177,103,101,179,103,104,
+179,102,251,197,4,22,254,111,118,126,67,91,25,1,67,254,191,70,140,93,180,
+170,1,157,253,23,140,98,100,135,137,98,97,141,4,37,51,37,37,51,51,37,37,51,
+164,51,37,37,51,51,37,37,51,102,50,38,37,51,51,37,38,50,185,51,37,37,51,51,
+37,37,51,62,51,37,37,51,51,37,37,51,61,51,37,37,51,51,37,37,51,1,150,184,
+176,4,98,173,102,103,172,99,99,173,102,130,254,110,197,239,53,51,28,95,74,
+129,102,162,64,112,119,1,107,96,143,142,97,99,139,140,1,22,37,51,51,37,37,
+51,51,188,37,51,51,37,38,50,50,208,37,51,51,37,37,51,51,253,27,37,51,51,37,
+38,50,50,1,27,37,51,51,37,37,51,51,1,27,37,51,51,37,37,51,51,0,1,1,51,255,
+236,1,195,1,203,0,3,0,0,1,51,17,35,1,51,144,144,1,203,254,33,0,1,1,51,2,76,
+2,98,3,123,0,11,0,0,1,52,54,51,50,22,21,20,6,35,34,38,1,51,89,63,64,87,88,
+63,62,90,2,227,63,89,89,63,63,88,86,0,0,1,0,31,0,61,4,18,4,51,0,11,0,0,9,
+2,7,1,1,39,1,1,55,1,1,4,18,254,99,1,157,92,254,99,254,98,92,1,155,254,101,
+92,1,158,1,157,3,213,254,98,254,101,95,1,158,254,98,95,1,155,1,158,94,254,
+99,1,157,0,0,1,3,82,3,20,3,225,5,113,0,3,0,0,1,51,17,35,3,82,143,143,5,113,
+253,163,0,2,2,174,3,20,4,133,5,113,0,3,0,7,0,0,1,51,17,35,1,51,17,35,2,174,
+143,143,1,72,143,143,5,113,253,163,2,93,253,163,0,3,2,10,3,20,5,41,5,113,
+0,3,0,7,0,11,0,0,1,51,17,35,1,51,17,35,1,51,17,35,2,10,144,144,1,72,143,143,
+1,72,143,143,5,113,253,163,2,93,253,163,2,93,253,163,0,4,2,174,0,0,4,133,
+5,113,0,3,0,7,0,11,0,15,0,0,1,51,17,35,1,51,17,35,5,51,17,35,1,51,17,35,2,
+174,143,143,1,72,143,143,254,184,143,143,1,72,143,143,5,113,253,163,2,93,
+253,163,184,253,164,2,92,253,164,0,0,5,2,10,0,0,5,41,5,113,0,3,0,7,0,11,0,
+15,0,19,0,0,1,51,17,35,1,51,17,35,1,51,17,35,5,51,17,35,1,51,17,35,2,10,144,
+144,1,72,143,143,1,72,143,143,254,20,143,143,1,72,143,143,5,113,253,163,2,
+93,253,163,2,93,253,163,184,253,164,2,92,253,164,0,0,6,2,10,0,0,5,41,5,113,
+0,3,0,7,0,11,0,15,0,19,0,23,0,0,1,51,17,35,1,51,17,35,1,51,17,35,5,51,17,
+35,1,51,17,35,1,51,17,35,2,10,144,144,1,72,143,143,1,72,143,143,253,112,144,
+144,1,72,143,143,1,72,143,143,5,113,253,163,2,93,253,163,2,93,253,163,184,
+253,164,2,92,253,164,2,92,253,164,0,0,7,1,102,0,0,5,205,5,113,0,3,0,7,0,11,
+0,15,0,19,0,23,0,27,0,0,1,51,17,35,1,51,17,35,1,51,17,35,5,51,17,35,1,51,
+17,35,1,51,17,35,19,51,17,35,1,102,144,144,1,72,143,143,1,72,143,143,254,
+20,144,144,1,72,143,143,1,72,143,143,163,144,144,5,113,253,163,2,93,253,163,
+2,93,253,163,184,253,164,2,92,253,164,2,92,253,164,5,113,253,163,0,8,1,102,
+0,0,5,205,5,113,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,0,1,51,17,35,1,51,
+17,35,1,51,17,35,1,51,17,35,1,51,17,35,1,51,17,35,1,51,17,35,1,51,17,35,1,
+102,144,144,1,72,143,143,1,72,143,143,1,71,144,144,252,41,144,144,1,72,143,
+143,1,72,143,143,1,71,144,144,2,92,253,164,2,92,253,164,2,92,253,164,2,92,
+253,164,5,113,253,163,2,93,253,163,2,93,253,163,2,93,253,163,0,9,2,10,0,0,
+5,41,5,113,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,0,1,51,17,35,1,51,
+17,35,1,51,17,35,1,51,17,35,1,51,17,35,1,51,17,35,1,51,17,35,1,51,17,35,1,
+51,17,35,2,10,144,144,1,72,143,143,1,72,143,143,253,112,144,144,1,72,143,
+143,1,72,143,143,253,112,144,144,1,72,143,143,1,72,143,143,1,82,254,174,1,
+82,254,174,1,82,254,174,3,98,254,174,1,82,254,174,1,82,254,174,3,97,254,174,
+1,82,254,174,1,82,254,174,0,1,2,92,2,131,4,215,3,4,0,3,0,0,1,33,53,33,4,215,
+253,133,2,123,2,131,129,0,0,2,2,92,1,166,4,215,3,225,0,3,0,7,0,0,1,33,53,
+33,17,33,53,33,4,215,253,133,2,123,253,133,2,123,1,166,129,1,57,129,0,3,2,
+92,0,201,4,215,4,190,0,3,0,7,0,11,0,0,1,33,53,33,17,33,53,33,17,33,53,33,
+4,215,253,133,2,123,253,133,2,123,253,133,2,123,2,131,129,1,57,129,252,11,
+129,0,0,4,0,207,1,166,6,100,3,225,0,3,0,7,0,11,0,15,0,0,1,33,53,33,5,33,53,
+33,1,33,53,33,5,33,53,33,3,74,253,133,2,123,3,26,253,133,2,123,252,230,253,
+133,2,123,3,26,253,133,2,123,1,166,129,129,129,1,57,129,129,129,0,5,0,207,
+0,201,6,100,4,190,0,3,0,7,0,11,0,15,0,19,0,0,1,33,53,33,17,33,53,33,17,33,
+53,33,37,33,53,33,17,33,53,33,3,74,253,133,2,123,253,133,2,123,253,133,2,
+123,3,26,253,133,2,123,253,133,2,123,2,131,129,1,57,129,252,11,129,92,129,
+1,57,129,0,6,0,207,0,201,6,100,4,190,0,3,0,7,0,11,0,15,0,19,0,23,0,0,1,33,
+53,33,17,33,53,33,17,33,53,33,1,33,53,33,17,33,53,33,17,33,53,33,3,74,253,
+133,2,123,253,133,2,123,253,133,2,123,3,26,253,133,2,123,253,133,2,123,253,
+133,2,123,2,131,129,1,57,129,252,11,129,1,57,129,1,57,129,252,11,129,0,7,
+0,207,255,236,6,100,5,156,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,0,5,33,53,33,
+17,33,53,33,17,33,53,33,17,33,53,33,1,33,53,33,17,33,53,33,17,33,53,33,3,
+74,253,133,2,123,253,133,2,123,253,133,2,123,253,133,2,123,3,26,253,133,2,
+123,253,133,2,123,253,133,2,123,20,129,1,57,129,1,57,129,1,58,129,252,231,
+129,1,57,129,252,11,129,0,8,0,207,255,236,6,100,5,156,0,3,0,7,0,11,0,15,0,
+19,0,23,0,27,0,31,0,0,5,33,53,33,5,33,53,33,1,33,53,33,5,33,53,33,1,33,53,
+33,5,33,53,33,1,33,53,33,5,33,53,33,3,74,253,133,2,123,3,26,253,133,2,123,
+252,230,253,133,2,123,3,26,253,133,2,123,252,230,253,133,2,123,3,26,253,133,
+2,123,252,230,253,133,2,123,3,26,253,133,2,123,20,129,129,129,1,57,129,129,
+129,1,57,129,129,129,1,58,129,129,129,0,0,9,0,158,0,201,6,152,4,190,0,3,0,
+7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,0,1,33,53,33,5,33,53,33,5,33,53,33,
+1,33,53,33,5,33,53,33,5,33,53,33,1,33,53,33,5,33,53,33,5,33,53,33,2,74,254,
+84,1,172,2,39,254,84,1,172,2,39,254,84,1,172,251,178,254,84,1,172,2,39,254,
+84,1,172,2,39,254,84,1,172,251,178,254,84,1,172,2,39,254,84,1,172,2,39,254,
+84,1,172,4,61,129,129,129,129,129,253,197,129,129,129,129,129,253,197,129,
+129,129,129,129,0,0,2,2,12,1,49,5,37,4,51,0,15,0,27,0,0,1,52,54,54,51,50,
+22,22,21,20,6,6,35,34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,2,12,105,184,
+107,107,185,105,105,184,108,108,183,105,131,153,112,108,158,157,109,113,152,
+2,178,105,178,102,102,179,104,105,178,102,103,178,104,112,154,155,111,111,
+157,156,0,4,1,166,1,223,5,139,3,133,0,11,0,23,0,35,0,47,0,0,1,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,
+20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,166,124,87,84,129,129,
+84,86,125,98,66,47,46,69,70,45,46,67,1,219,127,84,84,129,129,84,84,127,99,
+64,48,48,67,68,47,46,66,2,178,86,125,123,88,88,123,124,85,49,66,65,50,51,
+68,68,49,87,124,123,88,88,123,124,85,49,66,67,48,50,69,68,0,0,6,2,197,255,
+182,4,109,5,174,0,11,0,23,0,35,0,47,0,59,0,71,0,0,1,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,2,197,124,87,86,127,127,86,86,125,98,66,
+47,47,67,68,46,46,67,98,124,87,86,127,127,86,86,125,98,66,47,47,67,68,46,
+46,67,98,124,87,86,127,126,87,87,124,98,66,47,47,67,68,46,46,67,4,219,86,
+125,126,85,85,126,124,85,49,66,67,48,50,69,68,253,166,86,125,126,85,85,126,
+124,85,49,66,67,48,50,69,68,253,166,86,125,126,85,83,128,127,82,49,66,67,
+48,50,69,68,0,8,1,166,0,203,5,139,4,154,0,11,0,23,0,35,0,47,0,59,0,71,0,83,
+0,95,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,
+1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,166,124,
+87,85,128,129,84,86,125,98,66,47,48,67,70,45,46,67,98,124,87,85,128,129,84,
+86,125,98,66,47,48,67,70,45,46,67,1,219,126,85,85,128,129,84,84,127,99,63,
+49,49,66,68,47,46,66,99,126,85,85,128,129,84,84,127,99,63,49,49,66,68,47,
+46,66,3,199,84,127,125,86,88,123,124,85,50,65,65,50,50,68,68,253,167,84,127,
+125,86,88,123,124,85,50,65,65,50,50,68,68,1,249,85,126,125,86,88,123,124,
+85,49,66,66,49,49,69,68,253,167,85,126,125,86,88,123,124,85,49,66,66,49,49,
+69,68,0,10,1,166,255,182,5,139,5,174,0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,
+95,0,107,0,119,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,
+52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,
+6,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,
+52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,166,
+124,87,84,129,129,84,86,125,98,66,47,46,69,70,45,46,67,98,124,87,84,129,129,
+84,86,125,98,66,47,46,69,70,45,46,67,98,124,87,84,129,127,86,87,124,98,66,
+47,46,69,70,45,46,67,1,219,126,85,85,128,129,84,84,127,99,63,49,49,66,68,
+47,46,66,99,126,85,85,128,129,84,84,127,99,63,49,49,66,68,47,46,66,4,219,
+86,125,123,88,88,123,124,85,49,66,65,50,51,68,68,253,166,86,125,123,88,88,
+123,124,85,49,66,65,50,51,68,68,253,166,86,125,123,88,86,125,127,82,49,66,
+65,50,51,68,68,3,13,85,126,125,86,88,123,124,85,49,66,66,49,49,69,68,253,
+167,85,126,125,86,88,123,124,85,49,66,66,49,49,69,68,0,0,12,1,166,255,182,
+5,139,5,174,0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,95,0,107,0,119,0,131,0,143,
+0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,
+5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,166,124,87,84,129,129,84,
+86,125,98,66,47,46,69,70,45,46,67,1,219,127,84,84,129,129,84,84,127,99,64,
+48,48,67,68,47,46,66,253,96,124,87,84,129,129,84,86,125,98,66,47,46,69,70,
+45,46,67,1,219,127,84,84,129,129,84,84,127,99,64,48,48,67,68,47,46,66,253,
+96,124,87,84,129,127,86,87,124,98,66,47,46,69,70,45,46,67,1,219,127,84,84,
+129,127,86,85,126,99,64,48,48,67,68,47,46,66,4,219,86,125,123,88,88,123,124,
+85,49,66,65,50,51,68,68,49,87,124,123,88,88,123,124,85,49,66,67,48,50,69,
+68,253,166,86,125,123,88,88,123,124,85,49,66,65,50,51,68,68,49,87,124,123,
+88,88,123,124,85,49,66,67,48,50,69,68,253,166,86,125,123,88,86,125,127,82,
+49,66,65,50,51,68,68,49,87,124,123,88,86,125,126,83,49,66,67,48,50,69,68,
+0,0,14,1,238,255,117,5,70,6,90,0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,95,0,
+107,0,119,0,131,0,143,0,155,0,167,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,
+20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,
+51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,
+54,53,52,38,35,34,6,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,
+52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,
+6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,
+215,107,75,74,111,111,74,75,107,90,54,38,41,54,54,41,38,54,90,106,76,74,111,
+109,76,77,105,90,52,40,41,54,54,41,40,52,90,106,76,74,111,110,75,76,106,90,
+54,38,41,54,54,41,38,54,253,189,109,75,76,106,107,75,74,110,92,52,40,37,57,
+55,39,40,52,92,109,75,76,106,107,75,74,110,92,52,40,37,57,58,36,39,53,92,
+109,75,76,106,107,75,74,110,92,52,40,37,57,55,39,40,52,92,109,75,76,106,107,
+75,74,110,92,52,40,37,57,58,36,39,53,4,186,74,109,108,75,75,107,107,73,41,
+51,52,40,41,56,55,254,5,76,107,107,76,73,111,111,71,39,55,54,40,42,57,58,
+254,4,76,107,107,76,73,109,109,71,41,53,52,42,41,56,55,2,151,75,107,109,73,
+73,109,107,73,40,52,51,41,40,56,56,254,7,75,107,109,73,73,109,107,73,40,52,
+51,41,40,56,57,3,129,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,250,
+97,75,107,109,73,73,109,107,73,40,52,51,41,40,56,57,0,0,16,1,238,255,117,
+5,70,6,90,0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,95,0,107,0,119,0,131,0,143,
+0,155,0,167,0,179,0,191,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,
+50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,
+53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,
+3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,238,109,75,76,
+106,107,75,74,110,92,52,40,37,57,55,39,40,52,92,109,75,76,106,107,75,74,110,
+92,52,40,37,57,58,36,39,53,92,109,75,76,106,107,75,74,110,92,52,40,37,57,
+55,39,40,52,92,109,75,76,106,107,75,74,110,92,52,40,37,57,58,36,39,53,1,141,
+109,75,77,106,107,76,74,110,92,52,40,39,56,55,40,40,52,92,109,75,77,106,107,
+76,74,110,92,52,40,39,56,58,37,39,53,92,109,75,77,106,107,76,74,110,92,52,
+40,39,56,55,40,40,52,92,109,75,77,106,107,76,74,110,92,52,40,39,56,58,37,
+39,53,3,209,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,254,7,75,107,
+109,73,73,109,107,73,40,52,51,41,40,56,57,3,129,75,107,109,73,73,109,107,
+73,40,52,51,41,40,56,56,250,97,75,107,109,73,73,109,107,73,40,52,51,41,40,
+56,57,3,129,75,107,110,72,73,109,107,73,40,52,52,40,40,56,56,254,7,75,107,
+110,72,73,109,107,73,40,52,52,40,40,56,57,3,129,75,107,110,72,73,109,107,
+73,40,52,52,40,40,56,56,250,97,75,107,110,72,73,109,107,73,40,52,52,40,40,
+56,57,0,18,0,248,0,92,6,57,5,113,0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,95,
+0,107,0,119,0,131,0,143,0,155,0,167,0,179,0,191,0,203,0,215,0,0,19,52,54,
+51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,
+20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,52,54,51,50,22,21,20,6,
+35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,
+20,22,51,50,54,53,52,38,35,34,6,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,
+51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,
+54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,
+52,38,35,34,6,248,107,75,74,110,111,73,75,107,90,54,38,40,54,54,40,38,54,
+90,106,76,73,111,109,75,77,105,90,52,40,40,54,54,40,40,52,90,106,76,73,111,
+110,74,76,106,90,54,38,40,54,54,40,38,54,1,143,107,76,74,110,111,73,76,107,
+90,54,39,40,54,54,40,37,56,90,106,77,73,111,109,75,78,105,90,54,39,40,54,
+54,40,39,54,90,106,77,73,111,110,74,77,106,90,54,39,40,54,54,40,37,56,1,144,
+107,75,74,110,111,73,75,107,90,54,38,40,54,54,40,38,54,90,106,76,73,111,109,
+75,77,105,90,52,40,40,54,54,40,40,52,90,106,76,73,111,110,74,76,106,90,54,
+38,40,54,54,40,38,54,4,186,74,109,109,74,75,107,107,73,41,51,52,40,41,56,
+55,254,5,76,107,106,77,73,111,111,71,39,55,54,40,42,57,58,254,4,76,107,106,
+77,73,109,109,71,41,53,52,42,41,56,55,3,128,74,109,109,74,75,107,106,74,40,
+52,52,40,41,56,54,254,4,76,107,106,77,73,111,111,71,40,54,54,40,42,57,57,
+254,3,76,107,106,77,73,109,110,70,42,52,52,42,41,56,54,3,127,74,109,109,74,
+75,107,107,73,41,51,52,40,41,56,55,254,5,76,107,106,77,73,111,111,71,39,55,
+54,40,42,57,58,254,4,76,107,106,77,73,109,109,71,41,53,52,42,41,56,55,0,0,
+6,0,205,255,233,6,100,5,123,0,15,0,27,0,31,0,35,0,39,0,43,0,0,1,52,54,54,
+51,50,22,22,21,20,6,6,35,34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,
+53,51,5,35,53,51,1,51,17,35,17,51,17,35,2,12,105,184,107,107,185,105,105,
+184,108,108,183,105,131,153,112,108,158,157,109,113,152,204,246,246,4,161,
+245,245,252,240,143,143,143,143,2,178,105,178,102,102,179,104,105,178,102,
+103,178,104,112,154,155,111,111,157,156,159,129,129,129,2,119,255,0,252,110,
+255,0,0,0,11,1,2,1,94,6,47,4,6,0,11,0,23,0,35,0,47,0,51,0,55,0,59,0,63,0,
+67,0,71,0,75,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,35,1,35,53,51,1,51,21,35,
+37,51,21,35,1,166,124,87,84,129,129,84,86,125,98,66,47,46,69,70,45,46,67,
+1,219,127,84,84,129,129,84,84,127,99,64,48,48,67,68,47,46,66,253,55,123,123,
+211,82,82,1,123,101,101,194,82,82,1,162,123,123,252,33,82,82,2,61,82,82,2,
+178,86,125,123,88,88,123,124,85,49,66,65,50,51,68,68,49,87,124,123,88,88,
+123,124,85,49,66,67,48,50,69,68,88,78,1,45,104,254,237,78,1,45,104,254,237,
+78,254,238,105,105,105,0,16,2,41,255,23,5,8,6,78,0,11,0,23,0,27,0,31,0,35,
+0,47,0,59,0,63,0,67,0,71,0,83,0,95,0,99,0,103,0,107,0,111,0,0,1,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,
+21,35,1,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,1,52,54,51,50,22,21,20,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,
+1,51,21,35,2,205,124,87,86,127,127,86,86,125,98,66,47,47,67,68,46,46,67,139,
+123,123,211,82,82,1,145,123,123,253,197,124,87,86,127,127,86,86,125,98,66,
+47,47,67,68,46,46,67,139,123,123,211,82,82,1,145,123,123,253,197,124,87,86,
+127,126,87,87,124,98,66,47,47,67,68,46,46,67,139,123,123,211,82,82,1,145,
+123,123,254,111,82,82,4,219,86,125,126,85,85,126,124,85,49,66,67,48,50,69,
+68,88,78,1,76,123,254,225,78,253,176,86,125,126,85,85,126,124,85,49,66,67,
+48,50,69,68,88,78,1,23,82,254,237,78,253,176,86,125,126,85,83,128,127,82,
+49,66,67,48,50,69,68,88,78,1,23,82,254,237,78,254,225,122,0,0,20,1,2,0,72,
+6,47,5,57,0,11,0,23,0,35,0,47,0,51,0,55,0,59,0,63,0,67,0,79,0,91,0,103,0,
+115,0,119,0,123,0,127,0,131,0,135,0,139,0,143,0,0,1,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,
+19,51,21,35,1,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,
+53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,35,1,35,53,51,1,51,
+21,35,37,51,21,35,1,166,124,87,85,128,129,84,86,125,98,66,47,48,67,70,45,
+46,67,1,219,126,85,85,128,129,84,84,127,99,63,49,49,66,68,47,46,66,253,55,
+123,123,211,82,82,1,123,101,101,194,82,82,1,162,123,123,251,119,124,87,85,
+128,129,84,86,125,98,66,47,48,67,70,45,46,67,1,219,126,85,85,128,129,84,84,
+127,99,63,49,49,66,68,47,46,66,253,55,123,123,211,82,82,1,123,101,101,194,
+82,82,1,162,123,123,252,33,82,82,2,61,82,82,3,199,84,127,125,86,88,123,124,
+85,50,65,65,50,50,68,68,48,85,126,125,86,88,123,124,85,49,66,66,49,49,69,
+68,87,78,1,75,123,254,226,78,1,75,123,254,226,78,253,176,84,127,125,86,88,
+123,124,85,50,65,65,50,50,68,68,48,85,126,125,86,88,123,124,85,49,66,66,49,
+49,69,68,87,78,1,22,82,254,238,78,1,22,82,254,238,78,254,237,106,106,106,
+0,0,27,1,2,255,23,6,47,6,78,0,11,0,23,0,27,0,31,0,35,0,47,0,59,0,63,0,67,
+0,71,0,83,0,95,0,99,0,103,0,107,0,111,0,123,0,135,0,139,0,143,0,147,0,159,
+0,171,0,175,0,179,0,183,0,187,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,1,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,
+21,35,1,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,1,51,21,35,1,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,21,35,
+1,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,7,35,53,51,19,51,21,35,1,35,53,51,1,51,21,35,1,166,124,87,84,129,129,
+84,86,125,98,66,47,46,69,70,45,46,67,139,123,123,211,82,82,1,145,123,123,
+253,197,124,87,84,129,129,84,86,125,98,66,47,46,69,70,45,46,67,139,123,123,
+211,82,82,1,145,123,123,253,197,124,87,84,129,127,86,87,124,98,66,47,46,69,
+70,45,46,67,139,123,123,211,82,82,1,145,123,123,254,111,82,82,1,147,126,85,
+85,128,129,84,84,127,99,63,49,49,66,68,47,46,66,123,123,123,194,82,82,1,162,
+123,123,253,180,126,85,85,128,129,84,84,127,99,63,49,49,66,68,47,46,66,123,
+123,123,194,82,82,1,162,123,123,254,94,82,82,4,219,86,125,123,88,88,123,124,
+85,49,66,65,50,51,68,68,88,78,1,76,123,254,225,78,253,176,86,125,123,88,88,
+123,124,85,49,66,65,50,51,68,68,88,78,1,23,82,254,237,78,253,176,86,125,123,
+88,86,125,127,82,49,66,65,50,51,68,68,88,78,1,23,82,254,237,78,254,225,122,
+4,176,85,126,125,86,88,123,124,85,49,66,66,49,49,69,68,87,78,1,75,123,254,
+226,78,253,176,85,126,125,86,88,123,124,85,49,66,66,49,49,69,68,87,78,1,22,
+82,254,238,78,254,237,106,0,29,1,2,255,23,6,47,6,78,0,11,0,23,0,35,0,47,0,
+51,0,55,0,59,0,63,0,67,0,79,0,91,0,103,0,115,0,119,0,123,0,127,0,131,0,135,
+0,147,0,159,0,171,0,183,0,187,0,191,0,195,0,199,0,203,0,207,0,211,0,0,1,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,35,53,51,19,51,
+21,35,1,35,53,51,19,51,21,35,1,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,35,
+1,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,
+5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,35,1,35,53,51,1,51,21,35,37,51,
+21,35,1,166,124,87,84,129,129,84,86,125,98,66,47,46,69,70,45,46,67,1,219,
+127,84,84,129,129,84,84,127,99,64,48,48,67,68,47,46,66,253,55,123,123,211,
+82,82,1,123,101,101,194,82,82,1,162,123,123,251,119,124,87,84,129,129,84,
+86,125,98,66,47,46,69,70,45,46,67,1,219,127,84,84,129,129,84,84,127,99,64,
+48,48,67,68,47,46,66,253,55,123,123,211,82,82,1,123,101,101,194,82,82,1,162,
+123,123,251,119,124,87,84,129,127,86,87,124,98,66,47,46,69,70,45,46,67,1,
+219,127,84,84,129,127,86,85,126,99,64,48,48,67,68,47,46,66,253,55,123,123,
+211,82,82,1,123,101,101,194,82,82,1,162,123,123,252,33,82,82,2,61,82,82,4,
+219,86,125,123,88,88,123,124,85,49,66,65,50,51,68,68,49,87,124,123,88,88,
+123,124,85,49,66,67,48,50,69,68,88,78,1,76,123,254,225,78,1,76,123,254,225,
+78,253,176,86,125,123,88,88,123,124,85,49,66,65,50,51,68,68,49,87,124,123,
+88,88,123,124,85,49,66,67,48,50,69,68,88,78,1,23,82,254,237,78,1,23,82,254,
+237,78,253,176,86,125,123,88,86,125,127,82,49,66,65,50,51,68,68,49,87,124,
+123,88,86,125,126,83,49,66,67,48,50,69,68,88,78,1,23,82,254,237,78,1,23,82,
+254,237,78,254,225,122,122,122,0,37,1,100,254,250,5,205,6,213,0,3,0,7,0,19,
+0,31,0,35,0,39,0,43,0,55,0,67,0,71,0,75,0,79,0,91,0,103,0,107,0,111,0,115,
+0,127,0,139,0,143,0,147,0,151,0,155,0,159,0,171,0,183,0,187,0,191,0,195,0,
+207,0,219,0,223,0,227,0,239,0,251,0,255,1,3,0,0,1,35,53,51,19,51,21,35,7,
+52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,23,51,
+21,35,37,35,53,51,1,35,53,51,23,52,54,51,50,22,21,20,6,35,34,38,55,20,22,
+51,50,54,53,52,38,35,34,6,5,35,53,51,5,51,21,35,7,35,53,51,23,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,35,53,51,5,51,21,
+35,7,35,53,51,23,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,5,35,53,51,5,51,21,35,1,35,53,51,17,35,53,51,17,35,53,51,1,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,
+19,51,21,35,17,51,21,35,7,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,
+54,53,52,38,35,34,6,7,35,53,51,23,51,21,35,7,52,54,51,50,22,21,20,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,23,51,21,35,1,207,107,107,
+176,78,78,145,109,75,76,106,107,75,74,110,92,52,40,37,57,55,39,40,52,53,78,
+78,1,92,106,106,253,244,107,107,31,109,75,76,106,107,75,74,110,92,52,40,37,
+57,55,39,40,52,1,145,106,106,254,164,78,78,176,107,107,31,109,75,76,106,107,
+75,74,110,92,52,40,37,57,55,39,40,52,1,145,106,106,254,164,78,78,176,107,
+107,31,109,75,76,106,107,75,74,110,92,52,40,37,57,55,39,40,52,1,145,106,106,
+254,164,78,78,3,78,107,107,107,107,107,107,254,8,110,74,77,106,107,76,74,
+110,92,52,40,39,56,56,39,40,52,112,107,107,165,78,78,78,78,145,110,74,77,
+106,107,76,74,110,92,52,40,39,56,56,39,40,52,112,107,107,165,78,78,145,110,
+74,77,106,107,76,74,110,92,52,40,39,56,56,39,40,52,112,107,107,165,78,78,
+5,127,74,1,12,94,211,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,241,
+61,227,74,253,227,74,37,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,
+75,74,240,61,240,74,37,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,75,
+74,240,61,240,74,37,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,75,74,
+248,94,5,156,73,253,228,73,253,228,73,3,129,76,107,110,73,73,109,107,73,40,
+52,52,40,41,56,56,75,73,1,13,95,254,99,62,203,76,107,110,73,73,109,107,73,
+40,52,52,40,41,56,56,75,73,239,62,203,76,107,110,73,73,109,107,73,40,52,52,
+40,41,56,56,75,73,239,94,0,38,1,100,254,250,5,207,6,213,0,3,0,7,0,19,0,31,
+0,43,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,91,0,103,0,115,0,127,0,131,0,135,
+0,139,0,143,0,147,0,159,0,171,0,183,0,195,0,199,0,203,0,207,0,211,0,215,0,
+227,0,239,0,251,1,7,1,11,1,15,1,19,1,23,0,0,1,35,53,51,19,51,21,35,7,52,54,
+51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,51,21,35,37,35,53,
+51,5,35,53,51,1,51,21,35,17,51,21,35,5,35,53,51,23,52,54,51,50,22,21,20,6,
+35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,5,35,53,51,5,51,21,35,37,
+51,21,35,5,35,53,51,23,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,
+53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,7,35,53,51,5,35,53,51,5,51,21,35,37,51,21,35,5,35,53,51,23,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,5,35,
+53,51,5,51,21,35,37,51,21,35,1,207,107,107,176,78,78,145,109,75,76,106,107,
+75,74,110,92,52,40,37,57,55,39,40,52,1,141,109,75,77,106,107,76,74,110,92,
+52,40,39,56,55,40,40,52,254,76,78,78,1,68,82,82,2,12,107,107,254,153,78,78,
+78,78,253,103,107,107,31,109,75,76,106,107,75,74,110,92,52,40,37,57,55,39,
+40,52,1,141,109,75,77,106,107,76,74,110,92,52,40,39,56,55,40,40,52,112,82,
+82,2,12,107,107,252,176,78,78,1,233,78,78,253,103,107,107,31,109,75,76,106,
+107,75,74,110,92,52,40,37,57,55,39,40,52,1,141,109,75,77,106,107,76,74,110,
+92,52,40,39,56,55,40,40,52,112,82,82,2,12,107,107,252,176,78,78,1,233,78,
+78,253,103,107,107,31,109,75,76,106,107,75,74,110,92,52,40,37,57,55,39,40,
+52,1,141,109,75,77,106,107,76,74,110,92,52,40,39,56,55,40,40,52,112,82,82,
+2,12,107,107,252,176,78,78,1,233,78,78,5,127,74,1,12,94,211,75,107,109,73,
+73,109,107,73,40,52,51,41,40,56,56,38,75,107,110,72,73,109,107,73,40,52,52,
+40,40,56,56,241,61,227,74,74,74,1,12,94,254,98,61,240,74,37,75,107,109,73,
+73,109,107,73,40,52,51,41,40,56,56,38,75,107,110,72,73,109,107,73,40,52,52,
+40,40,56,56,75,74,74,74,240,61,61,61,240,74,37,75,107,109,73,73,109,107,73,
+40,52,51,41,40,56,56,38,75,107,110,72,73,109,107,73,40,52,52,40,40,56,56,
+75,74,74,74,240,61,61,61,240,74,37,75,107,109,73,73,109,107,73,40,52,51,41,
+40,56,56,38,75,107,110,72,73,109,107,73,40,52,52,40,40,56,56,75,74,74,74,
+248,94,94,94,0,42,0,111,255,236,6,197,5,236,0,3,0,7,0,19,0,31,0,43,0,55,0,
+59,0,63,0,67,0,71,0,75,0,79,0,91,0,103,0,115,0,127,0,131,0,135,0,139,0,143,
+0,147,0,159,0,171,0,183,0,195,0,199,0,203,0,207,0,211,0,223,0,235,0,239,0,
+243,0,247,1,3,1,15,1,19,1,23,1,35,1,47,1,51,1,55,0,0,19,35,53,51,19,51,21,
+35,7,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,
+52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,51,21,
+35,37,35,53,51,5,35,53,51,1,51,21,35,17,51,21,35,5,35,53,51,23,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,
+20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,5,35,53,51,5,
+51,21,35,37,51,21,35,5,35,53,51,23,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,
+50,54,53,52,38,35,34,6,7,35,53,51,5,35,53,51,5,51,21,35,37,51,21,35,1,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,
+19,51,21,35,17,51,21,35,7,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,
+54,53,52,38,35,34,6,7,35,53,51,23,51,21,35,7,52,54,51,50,22,21,20,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,23,51,21,35,217,106,106,
+176,78,78,145,110,74,76,106,107,75,74,110,92,52,40,37,57,56,38,40,52,1,141,
+110,75,76,106,107,75,75,110,92,52,41,37,57,56,38,41,52,254,76,78,78,1,68,
+82,82,3,248,107,107,252,174,78,78,78,78,253,102,106,106,31,110,74,76,106,
+107,75,74,110,92,52,40,37,57,56,38,40,52,1,141,110,75,76,106,107,75,75,110,
+92,52,41,37,57,56,38,41,52,112,82,82,3,248,107,107,250,196,78,78,1,234,78,
+78,253,102,106,106,31,110,74,76,106,107,75,74,110,92,52,40,37,57,56,38,40,
+52,1,141,110,75,76,106,107,75,75,110,92,52,41,37,57,56,38,41,52,112,82,82,
+3,248,107,107,250,196,78,78,1,234,78,78,1,90,110,74,76,106,107,75,74,110,
+92,52,40,37,57,56,38,40,52,113,82,82,166,78,78,78,78,145,110,74,76,106,107,
+75,74,110,92,52,40,37,57,56,38,40,52,113,82,82,166,78,78,145,110,74,76,106,
+107,75,74,110,92,52,40,37,57,56,38,40,52,113,82,82,166,78,78,4,150,73,1,13,
+95,211,76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,39,76,107,109,74,
+73,109,107,73,40,52,51,41,41,56,56,241,62,228,73,73,73,1,13,95,254,99,62,
+239,73,37,76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,39,76,107,109,
+74,73,109,107,73,40,52,51,41,41,56,56,75,73,73,73,239,62,62,62,239,73,37,
+76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,39,76,107,109,74,73,109,
+107,73,40,52,51,41,41,56,56,75,73,73,73,239,94,94,94,4,206,76,107,109,74,
+73,109,107,73,40,52,51,41,41,56,56,75,73,1,13,95,254,99,62,203,76,107,109,
+74,73,109,107,73,40,52,51,41,41,56,56,75,73,239,62,203,76,107,109,74,73,109,
+107,73,40,52,51,41,41,56,56,75,73,239,94,0,0,7,0,205,255,233,6,100,5,123,
+0,15,0,27,0,31,0,35,0,39,0,43,0,47,0,0,1,52,54,54,51,50,22,22,21,20,6,6,35,
+34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,5,35,53,51,1,51,17,
+35,17,51,17,35,19,33,53,33,2,12,105,184,107,107,185,105,105,184,108,108,183,
+105,131,153,112,108,158,157,109,113,152,204,246,246,4,161,245,245,252,240,
+143,143,143,143,211,254,227,1,29,2,178,105,178,102,102,179,104,105,178,102,
+103,178,104,112,154,155,111,111,157,156,173,129,129,129,2,133,255,0,252,110,
+255,0,2,140,129,0,0,13,1,2,1,94,6,47,4,6,0,11,0,23,0,35,0,47,0,51,0,55,0,
+59,0,63,0,67,0,71,0,75,0,79,0,83,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,
+20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,
+51,50,54,53,52,38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,35,1,
+35,53,51,5,35,53,51,5,35,53,51,1,51,21,35,37,51,21,35,1,166,124,87,84,129,
+129,84,86,125,98,66,47,46,69,70,45,46,67,1,219,127,84,84,129,129,84,84,127,
+99,64,48,48,67,68,47,46,66,253,55,123,123,211,82,82,1,123,101,101,194,82,
+82,1,162,123,123,252,137,123,123,2,60,123,123,253,92,82,82,2,61,82,82,2,178,
+86,125,123,88,88,123,124,85,49,66,65,50,51,68,68,49,87,124,123,88,88,123,
+124,85,49,66,67,48,50,69,68,88,78,1,45,104,254,237,78,1,45,104,254,237,78,
+78,78,78,78,254,238,105,105,105,0,19,2,41,255,23,5,8,6,78,0,11,0,23,0,27,
+0,31,0,35,0,39,0,51,0,63,0,67,0,71,0,75,0,79,0,91,0,103,0,107,0,111,0,115,
+0,119,0,123,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,5,35,53,51,1,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,21,35,
+1,35,53,51,5,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,
+53,52,38,35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,5,35,53,51,3,51,21,35,
+2,205,124,87,86,127,127,86,86,125,98,66,47,47,67,68,46,46,67,139,123,123,
+211,82,82,1,145,123,123,254,215,123,123,254,238,124,87,86,127,127,86,86,125,
+98,66,47,47,67,68,46,46,67,139,123,123,211,82,82,1,145,123,123,254,215,123,
+123,254,238,124,87,86,127,126,87,87,124,98,66,47,47,67,68,46,46,67,139,123,
+123,211,82,82,1,145,123,123,254,215,123,123,104,82,82,4,219,86,125,126,85,
+85,126,124,85,49,66,67,48,50,69,68,88,78,1,76,123,254,225,78,78,78,253,176,
+86,125,126,85,85,126,124,85,49,66,67,48,50,69,68,88,78,1,23,82,254,237,78,
+78,78,253,176,86,125,126,85,83,128,127,82,49,66,67,48,50,69,68,88,78,1,23,
+82,254,237,78,78,78,254,225,122,0,24,1,2,0,72,6,47,5,57,0,11,0,23,0,35,0,
+47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,87,0,99,0,111,0,123,0,127,0,131,0,
+135,0,139,0,143,0,147,0,151,0,155,0,159,0,0,1,52,54,51,50,22,21,20,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,
+20,22,51,50,54,53,52,38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,
+35,1,35,53,51,5,35,53,51,5,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,
+20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,
+51,50,54,53,52,38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,35,1,
+35,53,51,5,35,53,51,5,35,53,51,1,51,21,35,37,51,21,35,1,166,124,87,85,128,
+129,84,86,125,98,66,47,48,67,70,45,46,67,1,219,126,85,85,128,129,84,84,127,
+99,63,49,49,66,68,47,46,66,253,55,123,123,211,82,82,1,123,101,101,194,82,
+82,1,162,123,123,252,137,123,123,2,60,123,123,252,178,124,87,85,128,129,84,
+86,125,98,66,47,48,67,70,45,46,67,1,219,126,85,85,128,129,84,84,127,99,63,
+49,49,66,68,47,46,66,253,55,123,123,211,82,82,1,123,101,101,194,82,82,1,162,
+123,123,252,137,123,123,2,60,123,123,253,92,82,82,2,61,82,82,3,199,84,127,
+125,86,88,123,124,85,50,65,65,50,50,68,68,48,85,126,125,86,88,123,124,85,
+49,66,66,49,49,69,68,87,78,1,75,123,254,226,78,1,75,123,254,226,78,78,78,
+78,78,253,176,84,127,125,86,88,123,124,85,50,65,65,50,50,68,68,48,85,126,
+125,86,88,123,124,85,49,66,66,49,49,69,68,87,78,1,22,82,254,238,78,1,22,82,
+254,238,78,78,78,78,78,254,237,106,106,106,0,0,32,1,2,255,23,6,47,6,78,0,
+11,0,23,0,27,0,31,0,35,0,39,0,51,0,63,0,67,0,71,0,75,0,79,0,91,0,103,0,107,
+0,111,0,115,0,119,0,123,0,135,0,147,0,151,0,155,0,159,0,163,0,175,0,187,0,
+191,0,195,0,199,0,203,0,207,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,
+51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,5,35,53,51,1,
+52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,
+51,19,51,21,35,1,35,53,51,5,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,
+20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,5,35,53,
+51,3,51,21,35,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,7,35,53,51,19,51,21,35,1,35,53,51,5,35,53,51,1,52,54,51,50,22,21,
+20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,51,21,35,1,
+35,53,51,5,35,53,51,3,51,21,35,1,166,124,87,84,129,129,84,86,125,98,66,47,
+46,69,70,45,46,67,139,123,123,211,82,82,1,145,123,123,254,215,123,123,254,
+238,124,87,84,129,129,84,86,125,98,66,47,46,69,70,45,46,67,139,123,123,211,
+82,82,1,145,123,123,254,215,123,123,254,238,124,87,84,129,127,86,87,124,98,
+66,47,46,69,70,45,46,67,139,123,123,211,82,82,1,145,123,123,254,215,123,123,
+104,82,82,1,147,126,85,85,128,129,84,84,127,99,63,49,49,66,68,47,46,66,123,
+123,123,194,82,82,1,162,123,123,254,197,123,123,254,239,126,85,85,128,129,
+84,84,127,99,63,49,49,66,68,47,46,66,123,123,123,194,82,82,1,162,123,123,
+254,197,123,123,103,82,82,4,219,86,125,123,88,88,123,124,85,49,66,65,50,51,
+68,68,88,78,1,76,123,254,225,78,78,78,253,176,86,125,123,88,88,123,124,85,
+49,66,65,50,51,68,68,88,78,1,23,82,254,237,78,78,78,253,176,86,125,123,88,
+86,125,127,82,49,66,65,50,51,68,68,88,78,1,23,82,254,237,78,78,78,254,225,
+122,4,176,85,126,125,86,88,123,124,85,49,66,66,49,49,69,68,87,78,1,75,123,
+254,226,78,78,78,253,176,85,126,125,86,88,123,124,85,49,66,66,49,49,69,68,
+87,78,1,22,82,254,238,78,78,78,254,237,106,0,35,1,2,255,23,6,47,6,78,0,11,
+0,23,0,35,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,87,0,99,0,111,0,123,0,
+127,0,131,0,135,0,139,0,143,0,147,0,151,0,163,0,175,0,187,0,199,0,203,0,207,
+0,211,0,215,0,219,0,223,0,227,0,231,0,235,0,0,1,52,54,51,50,22,21,20,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,
+21,35,1,35,53,51,5,35,53,51,5,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,35,
+1,35,53,51,5,35,53,51,5,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,
+50,54,53,52,38,35,34,6,5,35,53,51,19,51,21,35,1,35,53,51,19,51,21,35,1,35,
+53,51,5,35,53,51,5,35,53,51,1,51,21,35,37,51,21,35,1,166,124,87,84,129,129,
+84,86,125,98,66,47,46,69,70,45,46,67,1,219,127,84,84,129,129,84,84,127,99,
+64,48,48,67,68,47,46,66,253,55,123,123,211,82,82,1,123,101,101,194,82,82,
+1,162,123,123,252,137,123,123,2,60,123,123,252,178,124,87,84,129,129,84,86,
+125,98,66,47,46,69,70,45,46,67,1,219,127,84,84,129,129,84,84,127,99,64,48,
+48,67,68,47,46,66,253,55,123,123,211,82,82,1,123,101,101,194,82,82,1,162,
+123,123,252,137,123,123,2,60,123,123,252,178,124,87,84,129,127,86,87,124,
+98,66,47,46,69,70,45,46,67,1,219,127,84,84,129,127,86,85,126,99,64,48,48,
+67,68,47,46,66,253,55,123,123,211,82,82,1,123,101,101,194,82,82,1,162,123,
+123,252,137,123,123,2,60,123,123,253,92,82,82,2,61,82,82,4,219,86,125,123,
+88,88,123,124,85,49,66,65,50,51,68,68,49,87,124,123,88,88,123,124,85,49,66,
+67,48,50,69,68,88,78,1,76,123,254,225,78,1,76,123,254,225,78,78,78,78,78,
+253,176,86,125,123,88,88,123,124,85,49,66,65,50,51,68,68,49,87,124,123,88,
+88,123,124,85,49,66,67,48,50,69,68,88,78,1,23,82,254,237,78,1,23,82,254,237,
+78,78,78,78,78,253,176,86,125,123,88,86,125,127,82,49,66,65,50,51,68,68,49,
+87,124,123,88,86,125,126,83,49,66,67,48,50,69,68,88,78,1,23,82,254,237,78,
+1,23,82,254,237,78,78,78,78,78,254,225,122,122,122,0,44,1,100,254,250,5,205,
+6,213,0,3,0,7,0,19,0,31,0,35,0,39,0,43,0,47,0,59,0,71,0,75,0,79,0,83,0,87,
+0,99,0,111,0,115,0,119,0,123,0,127,0,139,0,151,0,155,0,159,0,163,0,167,0,
+171,0,175,0,187,0,199,0,203,0,207,0,211,0,215,0,227,0,239,0,243,0,247,0,251,
+1,7,1,19,1,23,1,27,1,31,0,0,1,35,53,51,19,51,21,35,7,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,23,51,21,35,55,35,53,51,5,35,
+53,51,1,35,53,51,23,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,
+52,38,35,34,6,23,35,53,51,5,35,53,51,5,51,21,35,7,35,53,51,23,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,23,35,53,51,5,35,53,
+51,5,51,21,35,7,35,53,51,23,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,
+54,53,52,38,35,34,6,23,35,53,51,5,35,53,51,5,51,21,35,1,35,53,51,17,35,53,
+51,17,35,53,51,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,7,35,53,51,19,51,21,35,17,51,21,35,55,35,53,51,3,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,5,35,53,51,
+7,51,21,35,7,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,7,35,53,51,5,35,53,51,7,51,21,35,1,207,107,107,176,78,78,145,109,75,
+76,106,107,75,74,110,92,52,40,37,57,55,39,40,52,53,78,78,92,106,106,1,0,106,
+106,253,244,107,107,31,109,75,76,106,107,75,74,110,92,52,40,37,57,55,39,40,
+52,145,106,106,1,0,106,106,254,164,78,78,176,107,107,31,109,75,76,106,107,
+75,74,110,92,52,40,37,57,55,39,40,52,145,106,106,1,0,106,106,254,164,78,78,
+176,107,107,31,109,75,76,106,107,75,74,110,92,52,40,37,57,55,39,40,52,145,
+106,106,1,0,106,106,254,164,78,78,3,78,107,107,107,107,107,107,254,8,110,
+74,77,106,107,76,74,110,92,52,40,39,56,56,39,40,52,112,107,107,165,78,78,
+78,78,93,107,107,238,110,74,77,106,107,76,74,110,92,52,40,39,56,56,39,40,
+52,112,107,107,1,2,107,107,93,78,78,145,110,74,77,106,107,76,74,110,92,52,
+40,39,56,56,39,40,52,112,107,107,1,2,107,107,93,78,78,5,127,74,1,12,94,211,
+75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,241,61,227,74,74,74,253,
+227,74,37,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,75,74,74,74,240,
+61,240,74,37,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,75,74,74,74,
+240,61,240,74,37,75,107,109,73,73,109,107,73,40,52,51,41,40,56,56,75,74,74,
+74,248,94,5,156,73,253,228,73,253,228,73,3,129,76,107,110,73,73,109,107,73,
+40,52,52,40,41,56,56,75,73,1,13,95,254,99,62,228,73,254,8,76,107,110,73,73,
+109,107,73,40,52,52,40,41,56,56,75,73,73,73,239,62,203,76,107,110,73,73,109,
+107,73,40,52,52,40,41,56,56,75,73,73,73,239,94,0,46,1,100,254,250,5,207,6,
+213,0,3,0,7,0,19,0,31,0,43,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,
+99,0,111,0,123,0,135,0,139,0,143,0,147,0,151,0,155,0,159,0,163,0,175,0,187,
+0,199,0,211,0,215,0,219,0,223,0,227,0,231,0,235,0,239,0,251,1,7,1,19,1,31,
+1,35,1,39,1,43,1,47,1,51,1,55,0,0,1,35,53,51,19,51,21,35,7,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,51,21,35,55,35,53,51,23,35,
+53,51,5,35,53,51,1,51,21,35,17,51,21,35,55,35,53,51,1,35,53,51,23,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,35,53,51,23,35,53,51,
+5,35,53,51,5,35,53,51,5,51,21,35,37,51,21,35,5,35,53,51,23,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,35,53,51,23,35,53,51,5,35,
+53,51,5,35,53,51,5,51,21,35,37,51,21,35,5,35,53,51,23,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,35,53,51,23,35,53,51,5,35,53,51,
+5,35,53,51,5,51,21,35,37,51,21,35,1,207,107,107,176,78,78,145,109,75,76,106,
+107,75,74,110,92,52,40,37,57,55,39,40,52,1,141,109,75,77,106,107,76,74,110,
+92,52,40,39,56,55,40,40,52,254,76,78,78,92,106,106,232,82,82,2,12,107,107,
+254,153,78,78,78,78,93,107,107,253,10,107,107,31,109,75,76,106,107,75,74,
+110,92,52,40,37,57,55,39,40,52,1,141,109,75,77,106,107,76,74,110,92,52,40,
+39,56,55,40,40,52,254,168,106,106,232,82,82,2,12,107,107,254,246,107,107,
+253,186,78,78,1,233,78,78,253,103,107,107,31,109,75,76,106,107,75,74,110,
+92,52,40,37,57,55,39,40,52,1,141,109,75,77,106,107,76,74,110,92,52,40,39,
+56,55,40,40,52,254,168,106,106,232,82,82,2,12,107,107,254,246,107,107,253,
+186,78,78,1,233,78,78,253,103,107,107,31,109,75,76,106,107,75,74,110,92,52,
+40,37,57,55,39,40,52,1,141,109,75,77,106,107,76,74,110,92,52,40,39,56,55,
+40,40,52,254,168,106,106,232,82,82,2,12,107,107,254,246,107,107,253,186,78,
+78,1,233,78,78,5,127,74,1,12,94,211,75,107,109,73,73,109,107,73,40,52,51,
+41,40,56,56,38,75,107,110,72,73,109,107,73,40,52,52,40,40,56,56,241,61,227,
+74,74,74,74,74,1,12,94,254,98,61,227,74,253,227,74,37,75,107,109,73,73,109,
+107,73,40,52,51,41,40,56,56,38,75,107,110,72,73,109,107,73,40,52,52,40,40,
+56,56,75,74,74,74,74,74,74,74,240,61,61,61,240,74,37,75,107,109,73,73,109,
+107,73,40,52,51,41,40,56,56,38,75,107,110,72,73,109,107,73,40,52,52,40,40,
+56,56,75,74,74,74,74,74,74,74,240,61,61,61,240,74,37,75,107,109,73,73,109,
+107,73,40,52,51,41,40,56,56,38,75,107,110,72,73,109,107,73,40,52,52,40,40,
+56,56,75,74,74,74,74,74,74,74,248,94,94,94,0,51,0,111,255,236,6,197,5,236,
+0,3,0,7,0,19,0,31,0,43,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,99,
+0,111,0,123,0,135,0,139,0,143,0,147,0,151,0,155,0,159,0,163,0,175,0,187,0,
+199,0,211,0,215,0,219,0,223,0,227,0,231,0,235,0,247,1,3,1,7,1,11,1,15,1,19,
+1,31,1,43,1,47,1,51,1,55,1,67,1,79,1,83,1,87,1,91,0,0,19,35,53,51,19,51,21,
+35,7,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,
+52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,51,21,
+35,55,35,53,51,23,35,53,51,5,35,53,51,1,51,21,35,17,51,21,35,55,35,53,51,
+1,35,53,51,23,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,
+6,5,35,53,51,23,35,53,51,5,35,53,51,5,35,53,51,5,51,21,35,37,51,21,35,5,35,
+53,51,23,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,
+6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,
+35,53,51,23,35,53,51,5,35,53,51,5,35,53,51,5,51,21,35,37,51,21,35,1,52,54,
+51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,19,
+51,21,35,17,51,21,35,55,35,53,51,3,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,7,35,53,51,5,35,53,51,7,51,21,35,7,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,7,35,53,51,5,35,
+53,51,7,51,21,35,217,106,106,176,78,78,145,110,74,76,106,107,75,74,110,92,
+52,40,37,57,56,38,40,52,1,141,110,75,76,106,107,75,75,110,92,52,41,37,57,
+56,38,41,52,254,76,78,78,92,106,106,232,82,82,3,248,107,107,252,174,78,78,
+78,78,92,107,107,253,10,106,106,31,110,74,76,106,107,75,74,110,92,52,40,37,
+57,56,38,40,52,1,141,110,75,76,106,107,75,75,110,92,52,41,37,57,56,38,41,
+52,254,168,106,106,232,82,82,3,248,107,107,253,10,107,107,253,186,78,78,1,
+234,78,78,253,102,106,106,31,110,74,76,106,107,75,74,110,92,52,40,37,57,56,
+38,40,52,1,141,110,75,76,106,107,75,75,110,92,52,41,37,57,56,38,41,52,254,
+168,106,106,232,82,82,3,248,107,107,253,10,107,107,253,186,78,78,1,234,78,
+78,1,90,110,74,76,106,107,75,74,110,92,52,40,37,57,56,38,40,52,113,82,82,
+166,78,78,78,78,92,106,106,237,110,74,76,106,107,75,74,110,92,52,40,37,57,
+56,38,40,52,113,82,82,1,2,106,106,92,78,78,145,110,74,76,106,107,75,74,110,
+92,52,40,37,57,56,38,40,52,113,82,82,1,2,106,106,92,78,78,4,150,73,1,13,95,
+211,76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,39,76,107,109,74,73,
+109,107,73,40,52,51,41,41,56,56,241,62,228,73,73,73,73,73,1,13,95,254,99,
+62,228,73,253,228,73,37,76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,
+39,76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,75,73,73,73,73,73,73,
+73,239,62,62,62,239,73,37,76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,
+39,76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,75,73,73,73,73,73,73,
+73,239,94,94,94,4,206,76,107,109,74,73,109,107,73,40,52,51,41,41,56,56,75,
+73,1,13,95,254,99,62,228,73,254,8,76,107,109,74,73,109,107,73,40,52,51,41,
+41,56,56,75,73,73,73,239,62,203,76,107,109,74,73,109,107,73,40,52,51,41,41,
+56,56,75,73,73,73,239,94,0,0,3,0,205,0,0,5,252,6,207,0,27,0,30,0,33,0,0,1,
+33,53,19,35,53,33,39,55,1,51,1,23,7,33,21,35,19,21,33,53,19,33,17,35,17,33,
+19,33,51,3,33,3,51,2,182,254,23,168,109,1,168,182,90,1,12,8,1,11,92,184,1,
+170,109,168,254,22,168,254,242,143,254,241,168,1,226,223,113,252,189,113,
+223,2,20,130,2,172,129,178,90,254,244,1,12,90,178,129,253,84,130,130,2,172,
+250,190,5,66,253,84,2,32,253,224,0,0,2,0,205,2,45,2,119,6,137,0,29,0,59,0,
+0,1,6,35,34,38,53,52,55,54,54,53,52,35,34,7,39,54,51,50,21,20,6,7,6,21,20,
+22,51,50,55,19,6,35,34,38,53,52,55,54,54,53,52,35,34,7,39,54,51,50,21,20,
+14,2,21,20,22,51,50,55,2,119,96,93,87,103,75,44,30,36,54,32,74,63,121,146,
+47,64,39,43,23,87,70,23,96,93,87,103,75,44,30,36,54,32,74,63,121,146,47,56,
+47,43,23,87,70,4,193,25,77,62,62,56,33,30,14,33,41,73,82,131,44,71,39,25,
+13,20,23,16,253,27,25,77,62,62,56,33,30,14,33,41,73,82,131,48,62,41,27,14,
+20,23,16,0,2,0,205,0,0,6,41,6,102,0,27,0,31,0,0,1,17,33,21,33,17,33,21,33,
+17,35,17,33,17,35,17,33,53,33,17,33,53,33,17,51,17,33,17,1,33,17,33,4,246,
+1,51,254,205,1,51,254,205,144,254,41,143,254,205,1,51,254,205,1,51,143,1,
+215,254,41,1,215,254,41,6,102,254,99,129,254,57,129,254,0,2,0,254,0,2,0,129,
+1,199,129,1,157,254,99,1,157,252,27,1,199,0,0,3,0,205,255,236,3,219,6,123,
+0,48,0,60,0,72,0,0,1,38,39,6,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,
+54,55,38,39,55,22,23,62,2,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,6,7,
+22,23,5,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,
+3,88,174,135,118,83,108,85,79,159,67,96,85,216,88,173,173,106,142,135,35,
+127,30,103,135,107,59,100,91,156,126,103,92,198,91,159,179,69,121,162,114,
+136,254,145,51,37,37,51,51,37,37,51,51,37,37,51,51,37,37,51,1,221,51,121,
+132,158,68,84,98,77,72,88,85,105,161,150,89,206,159,162,205,10,155,123,146,
+150,137,64,96,93,137,82,89,95,159,140,91,174,175,175,98,45,248,37,51,51,37,
+37,51,51,3,191,37,51,51,37,37,51,51,0,0,1,0,205,0,0,3,195,6,123,0,33,0,0,
+1,53,52,38,35,34,6,21,20,22,51,51,55,21,33,21,33,17,35,17,35,53,51,53,38,
+38,53,52,54,51,50,22,21,21,3,68,151,101,113,139,132,99,38,36,1,10,254,246,
+143,246,246,131,158,211,168,157,222,5,20,29,87,126,123,110,109,145,2,219,
+129,253,59,2,197,129,106,27,198,138,159,193,194,138,27,0,0,2,0,205,0,0,3,
+195,6,102,0,3,0,7,0,0,1,33,53,33,5,17,35,17,3,195,253,10,2,246,254,204,143,
+5,229,129,206,250,104,5,152,0,0,1,0,205,0,0,4,184,6,150,0,13,0,0,1,7,17,35,
+17,33,23,7,1,1,23,7,33,55,4,184,188,143,254,86,153,100,254,213,1,43,100,162,
+1,220,196,5,254,188,250,190,5,35,127,101,1,43,1,44,101,141,190,0,0,1,0,205,
+255,254,3,152,6,102,0,17,0,0,1,17,35,17,6,6,7,22,23,7,46,2,53,54,36,55,17,
+3,152,144,93,198,118,135,176,82,82,198,111,112,1,32,171,6,102,249,152,4,149,
+21,143,133,202,142,108,63,201,156,32,166,226,41,1,75,0,3,0,205,0,113,7,145,
+3,61,0,19,0,29,0,43,0,0,1,20,2,4,35,35,34,36,39,6,35,34,38,53,52,54,51,50,
+23,33,5,30,2,51,51,50,54,54,55,37,52,38,35,35,34,6,21,20,22,51,51,50,54,7,
+145,160,254,253,156,188,193,254,219,61,58,104,130,130,132,128,202,42,4,204,
+251,70,20,132,189,106,188,106,190,130,20,251,68,49,64,41,65,47,60,52,41,53,
+60,2,160,143,254,242,146,213,174,27,90,101,86,79,102,129,96,169,95,96,167,
+97,59,31,29,30,30,43,28,28,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,
+3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,
+144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,
+0,30,0,248,0,3,0,1,4,9,0,7,0,68,1,22,0,3,0,1,4,9,0,8,0,42,1,90,0,3,0,1,4,
+9,0,9,0,40,1,132,0,3,0,1,4,9,0,10,0,96,1,172,0,3,0,1,4,9,0,11,0,62,2,12,0,
+3,0,1,4,9,0,12,0,60,2,74,0,3,0,1,4,9,0,13,2,150,2,134,0,3,0,1,4,9,0,14,0,
+52,5,28,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,
+48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,
+0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,
+82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,
+0,32,0,83,0,97,0,110,0,115,0,32,0,76,0,105,0,110,0,101,0,97,0,114,0,32,0,
+66,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,
+32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,76,0,105,0,110,
+0,101,0,97,0,114,0,32,0,66,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,
+0,115,0,76,0,105,0,110,0,101,0,97,0,114,0,66,0,78,0,111,0,116,0,111,0,32,
+0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,
+0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+181,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,};
+#endif
@@ -0,0 +1,242 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansLisu_Regular_ttf_size = 5676;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansLisu_Regular_ttf");
+asm(".type fz_font_NotoSansLisu_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansLisu_Regular_ttf, 5676");
+asm(".balign 64");
+asm("fz_font_NotoSansLisu_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansLisu-Regular.ttf\"");
+#else
+const int fz_font_NotoSansLisu_Regular_ttf_size = 5676;
+const char fz_font_NotoSansLisu_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,122,231,105,237,0,0,1,56,0,0,0,96,
+99,109,97,112,93,162,77,194,0,0,2,112,0,0,0,100,103,97,115,112,0,22,0,35,
+0,0,22,28,0,0,0,16,103,108,121,102,67,92,89,103,0,0,3,68,0,0,12,196,104,101,
+97,100,5,44,6,214,0,0,0,188,0,0,0,54,104,104,101,97,15,230,5,64,0,0,0,244,
+0,0,0,36,104,109,116,120,240,33,23,73,0,0,1,152,0,0,0,216,108,111,99,97,86,
+68,83,57,0,0,2,212,0,0,0,110,109,97,120,112,0,58,0,39,0,0,1,24,0,0,0,32,110,
+97,109,101,138,179,183,87,0,0,16,8,0,0,5,244,112,111,115,116,255,105,0,102,
+0,0,21,252,0,0,0,32,0,1,0,0,0,1,7,174,58,161,90,149,95,15,60,245,0,27,8,0,
+0,0,0,0,204,125,233,176,0,0,0,0,210,40,203,232,0,0,254,197,7,86,5,205,0,0,
+0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,7,113,0,0,255,240,7,86,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,1,0,0,0,54,0,38,0,3,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,135,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,0,0,0,1,
+0,0,0,0,4,0,5,154,0,0,0,32,0,0,4,0,0,102,0,0,0,0,4,20,0,0,2,20,0,0,5,51,0,
+199,4,215,0,199,4,215,0,104,5,215,0,199,4,115,0,20,4,76,0,20,5,211,0,125,
+4,244,0,199,4,244,0,0,2,247,0,40,5,14,0,125,5,14,0,63,4,147,0,78,4,39,0,199,
+4,39,0,47,7,66,0,199,6,20,0,199,4,49,0,199,4,100,0,104,4,250,0,199,4,250,
+0,31,4,205,0,0,4,205,0,0,5,238,0,199,5,211,0,152,2,247,0,186,7,113,0,25,4,
+176,0,8,4,135,0,0,5,51,0,110,5,29,0,0,5,27,0,0,4,115,0,199,4,115,0,123,2,
+72,0,200,6,63,0,125,5,217,0,184,5,217,0,184,4,49,0,51,5,215,0,125,2,42,0,
+150,2,42,0,130,3,176,0,150,3,176,0,150,2,42,0,130,2,42,0,150,5,16,0,150,4,
+94,0,150,2,42,0,130,3,200,0,150,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,88,0,0,0,18,
+0,16,0,3,0,2,0,0,0,13,0,32,0,160,2,188,2,205,164,255,254,255,255,255,0,0,
+0,0,0,13,0,32,0,160,2,188,2,205,164,208,254,255,255,255,0,1,255,245,255,227,
+255,99,253,120,253,104,91,52,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,20,0,20,0,20,0,20,0,75,0,110,0,144,0,181,0,199,0,217,1,12,1,40,1,68,
+1,93,1,137,1,181,1,204,1,225,1,247,2,29,2,65,2,80,2,138,2,179,2,220,2,245,
+3,14,3,37,3,88,3,114,3,162,3,192,3,215,4,13,4,46,4,80,4,104,4,128,4,140,4,
+190,4,224,5,1,5,17,5,54,5,76,5,104,5,142,5,186,5,228,6,9,6,38,6,58,6,86,6,
+98,0,0,0,2,0,102,0,0,3,154,5,182,0,3,0,7,0,0,51,17,33,17,37,33,17,33,102,
+3,52,253,47,2,110,253,146,5,182,250,74,98,4,242,0,3,0,199,0,0,4,197,5,182,
+0,15,0,24,0,33,0,0,19,33,32,4,21,20,6,7,21,22,22,21,20,4,35,33,19,33,50,54,
+53,52,38,35,35,17,17,33,50,54,53,52,38,35,199,1,161,1,38,1,5,142,136,169,
+159,254,244,240,253,254,184,1,14,172,156,171,185,242,1,39,176,170,180,180,
+5,182,175,187,130,169,25,10,29,176,145,196,220,3,72,110,129,120,106,253,149,
+253,238,136,138,131,125,0,0,2,0,199,0,0,4,111,5,182,0,9,0,18,0,0,1,20,4,33,
+35,17,35,17,33,32,1,51,50,54,53,52,38,35,35,4,111,254,206,254,234,168,184,
+1,131,2,37,253,16,147,218,196,182,193,186,4,8,224,239,253,199,5,182,253,33,
+141,156,141,140,0,0,2,0,104,0,0,4,16,5,182,0,9,0,18,0,0,19,52,36,33,51,17,
+51,17,33,32,1,35,34,6,21,20,22,51,51,104,1,50,1,22,168,184,254,125,253,219,
+2,240,147,218,196,181,194,186,1,174,224,239,2,57,250,74,2,223,141,156,141,
+140,0,2,0,199,0,0,5,90,5,182,0,8,0,16,0,0,1,16,0,33,33,17,33,32,0,3,16,0,
+33,35,17,51,32,5,90,254,117,254,143,254,105,1,194,1,85,1,124,194,254,237,
+254,234,240,199,2,82,2,233,254,150,254,129,5,182,254,137,254,164,1,23,1,31,
+251,133,0,1,0,20,0,0,4,92,5,182,0,7,0,0,33,35,17,33,53,33,21,33,2,150,185,
+254,55,4,72,254,58,5,20,162,162,0,0,1,0,20,0,0,4,92,5,182,0,7,0,0,37,33,21,
+33,53,33,17,51,2,150,1,198,251,184,1,201,185,162,162,162,5,20,0,1,0,125,255,
+236,5,59,5,203,0,27,0,0,1,33,17,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,
+32,0,17,16,0,33,50,55,17,33,3,66,1,249,116,240,158,254,178,254,146,182,1,
+87,233,234,202,70,193,184,254,251,254,218,1,26,1,13,147,140,254,191,3,4,253,
+51,37,38,1,140,1,99,229,1,86,181,86,160,84,254,196,254,238,254,222,254,210,
+35,1,178,0,1,0,199,0,0,4,244,5,182,0,12,0,0,33,35,1,7,17,35,17,51,17,55,1,
+51,1,4,244,217,253,249,149,184,184,126,2,9,215,253,189,2,186,131,253,201,
+5,182,253,47,139,2,70,253,131,0,0,1,0,0,0,0,4,45,5,182,0,12,0,0,17,51,1,55,
+17,51,17,35,17,7,1,35,1,217,2,7,149,184,184,125,253,246,215,2,67,5,182,253,
+70,131,2,55,250,74,2,209,139,253,186,2,125,0,0,1,0,40,255,236,2,61,5,182,
+0,13,0,0,23,34,39,53,22,51,50,54,53,17,51,17,20,6,192,94,58,71,77,100,100,
+185,197,20,27,155,20,121,114,4,61,251,210,198,214,0,0,1,0,125,255,236,4,207,
+5,203,0,23,0,0,1,34,0,17,16,0,51,50,55,21,6,6,35,32,0,17,52,18,36,51,50,23,
+7,38,3,57,236,254,242,1,6,242,156,195,93,172,112,254,189,254,163,167,1,63,
+216,232,172,74,175,5,41,254,196,254,238,254,229,254,205,58,160,34,25,1,137,
+1,104,226,1,84,184,86,156,80,0,1,0,63,255,236,4,145,5,203,0,23,0,0,37,50,
+0,17,16,0,35,34,7,53,54,54,51,32,0,17,20,2,4,35,34,39,55,22,1,213,236,1,14,
+254,250,242,156,195,93,172,112,1,67,1,93,168,254,192,214,232,172,74,175,142,
+1,60,1,18,1,27,1,51,58,160,34,25,254,119,254,152,227,254,172,183,86,156,80,
+0,0,1,0,78,0,0,4,68,5,182,0,9,0,0,33,33,53,1,33,53,33,21,1,33,4,68,252,10,
+3,2,253,22,3,201,252,254,3,23,139,4,135,164,139,251,121,0,0,1,0,199,0,0,3,
+248,5,182,0,9,0,0,33,35,17,33,21,33,17,33,21,33,1,127,184,3,49,253,135,2,
+82,253,174,5,182,162,253,250,161,0,0,1,0,47,0,0,3,96,5,182,0,9,0,0,1,51,17,
+33,53,33,17,33,53,33,2,168,184,252,207,2,121,253,174,2,82,5,182,250,74,162,
+2,6,161,0,0,1,0,199,0,0,6,123,5,182,0,19,0,0,33,1,35,22,21,17,35,17,33,1,
+51,1,33,17,35,17,52,55,35,1,3,76,254,30,8,15,170,1,16,1,195,8,1,203,1,14,
+182,14,8,254,24,5,2,160,235,252,137,5,182,251,82,4,174,250,74,3,131,150,231,
+251,0,0,0,1,0,199,0,0,5,78,5,182,0,19,0,0,33,35,1,35,23,22,21,17,35,17,51,
+23,1,19,51,38,2,53,17,51,5,78,215,252,241,8,5,12,170,213,45,1,224,255,8,2,
+12,172,4,190,81,182,134,252,207,5,182,71,253,26,254,115,24,1,39,66,3,57,0,
+1,0,199,0,0,3,254,5,182,0,5,0,0,51,17,51,17,33,21,199,184,2,127,5,182,250,
+238,164,0,0,1,0,104,255,236,4,4,5,203,0,37,0,0,1,20,4,35,32,39,53,22,22,51,
+50,54,53,52,38,38,39,38,38,53,52,36,51,50,23,7,38,35,34,6,21,20,22,22,23,
+30,2,4,4,254,236,246,254,252,142,93,221,96,164,166,60,141,143,203,174,1,1,
+210,219,184,57,188,162,130,147,57,127,136,163,160,76,1,135,191,220,69,176,
+40,46,126,110,73,94,82,52,74,201,159,171,202,82,158,78,112,101,72,95,78,50,
+60,113,147,0,2,0,199,0,0,4,219,5,182,0,8,0,21,0,0,1,51,50,54,53,52,38,35,
+35,17,17,35,17,33,32,4,21,16,5,1,35,1,1,127,219,178,164,166,186,209,184,1,
+147,1,16,1,5,254,219,1,145,215,254,158,2,248,140,138,138,127,253,69,253,164,
+5,182,207,208,254,221,101,253,113,2,92,0,0,2,0,31,0,0,4,51,5,182,0,8,0,21,
+0,0,1,35,34,6,21,20,22,51,51,17,17,51,17,33,32,36,53,16,37,1,51,1,3,123,219,
+179,163,166,186,209,184,254,109,254,240,254,251,1,37,254,111,215,1,98,2,190,
+140,138,138,127,2,187,2,92,250,74,206,209,1,29,107,2,143,253,164,0,0,1,0,
+0,0,0,4,205,5,182,0,10,0,0,33,35,1,38,39,6,7,1,35,1,51,4,205,193,254,183,
+63,29,25,68,254,185,195,2,10,185,3,170,178,141,126,197,252,90,5,182,0,1,0,
+0,0,0,4,205,5,182,0,10,0,0,17,51,1,22,23,54,55,1,51,1,35,193,1,73,63,29,25,
+68,1,71,195,253,246,185,5,182,252,86,178,141,126,197,3,166,250,74,0,1,0,199,
+0,0,5,37,5,182,0,11,0,0,33,35,17,33,17,35,17,51,17,33,17,51,5,37,184,253,
+18,184,184,2,238,184,2,170,253,86,5,182,253,150,2,106,0,1,0,152,255,236,5,
+86,5,203,0,27,0,0,1,33,17,54,54,51,32,0,17,20,2,4,35,34,39,55,22,51,32,0,
+17,16,0,33,34,7,17,33,2,145,254,7,116,240,158,1,78,1,110,182,254,169,233,
+234,202,70,193,184,1,3,1,40,254,230,254,243,147,140,1,65,2,179,2,205,38,37,
+254,116,254,157,229,254,170,181,86,160,84,1,58,1,20,1,34,1,46,35,254,78,0,
+1,0,186,0,0,2,207,5,202,0,13,0,0,1,50,23,21,38,35,34,6,21,17,35,17,52,54,
+2,55,94,58,71,77,100,100,185,197,5,202,27,155,20,121,114,251,195,4,46,198,
+214,0,0,1,0,25,0,0,7,86,5,182,0,24,0,0,33,35,1,38,39,6,7,1,35,1,51,19,22,
+23,54,55,1,51,1,22,23,54,55,19,51,5,209,186,254,227,63,11,16,54,254,236,186,
+254,125,192,227,46,24,22,56,1,2,190,1,13,52,28,16,55,226,192,3,190,214,75,
+115,180,252,72,5,182,252,131,175,173,164,195,3,114,252,135,173,179,138,212,
+3,123,0,1,0,8,0,0,4,168,5,182,0,11,0,0,33,35,1,1,35,1,1,51,1,1,51,1,4,168,
+209,254,125,254,119,195,1,230,254,57,205,1,102,1,105,194,254,60,2,123,253,
+133,2,250,2,188,253,195,2,61,253,72,0,1,0,0,0,0,4,135,5,182,0,8,0,0,1,1,51,
+1,17,35,17,1,51,2,68,1,125,198,254,25,185,254,25,201,2,231,2,207,252,129,
+253,201,2,47,3,135,0,3,0,110,0,0,4,108,5,182,0,15,0,24,0,33,0,0,33,33,34,
+36,53,52,54,55,53,38,38,53,52,36,33,33,7,35,34,6,21,20,22,51,33,5,34,6,21,
+20,22,51,33,17,4,108,253,254,239,254,243,159,169,136,142,1,4,1,39,1,161,184,
+242,185,171,155,173,1,14,254,231,181,179,172,174,1,39,220,196,144,177,29,
+10,25,169,130,187,175,157,106,120,129,110,154,126,130,139,135,2,18,0,2,0,
+0,0,0,5,27,5,188,0,7,0,13,0,0,33,3,33,3,35,1,51,1,1,3,39,6,7,3,4,92,176,253,
+188,174,186,2,59,166,2,58,254,90,164,70,30,33,166,1,197,254,59,5,188,250,
+68,2,104,1,187,219,120,99,254,69,0,2,0,0,0,0,5,27,5,188,0,7,0,13,0,0,19,19,
+33,19,51,1,35,1,1,19,23,54,55,19,191,176,2,68,174,186,253,197,166,253,198,
+1,166,164,70,21,42,166,5,188,254,59,1,197,250,68,5,188,253,152,254,69,219,
+93,126,1,187,0,0,1,0,199,0,0,3,248,5,182,0,11,0,0,33,33,17,33,21,33,17,33,
+21,33,17,33,3,248,252,207,3,49,253,135,2,84,253,172,2,121,5,182,162,254,56,
+160,253,246,0,1,0,123,0,0,3,172,5,182,0,11,0,0,55,33,17,33,53,33,17,33,53,
+33,17,33,123,2,121,253,172,2,84,253,135,3,49,252,207,162,2,10,160,1,200,162,
+250,74,0,1,0,200,0,0,1,128,5,183,0,3,0,0,51,17,51,17,200,184,5,183,250,73,
+0,2,0,125,255,236,5,195,5,205,0,11,0,23,0,0,1,16,0,33,32,0,17,16,0,33,32,
+0,1,16,18,51,50,18,17,16,2,35,34,2,5,195,254,157,254,193,254,189,254,159,
+1,95,1,71,1,62,1,98,251,124,246,236,235,244,242,235,238,246,2,221,254,161,
+254,110,1,139,1,104,1,101,1,137,254,113,254,159,254,222,254,208,1,44,1,38,
+1,37,1,41,254,211,0,1,0,184,255,236,5,31,5,182,0,17,0,0,1,17,20,0,33,32,0,
+53,17,51,17,20,22,51,50,54,53,17,5,31,254,210,254,244,254,247,254,220,185,
+191,192,181,195,5,182,252,78,250,254,226,1,33,251,3,174,252,76,179,196,194,
+183,3,178,0,0,1,0,184,255,236,5,31,5,182,0,17,0,0,5,17,52,38,35,34,6,21,17,
+35,17,52,0,33,32,0,21,17,4,104,195,181,189,194,185,1,37,1,8,1,12,1,46,20,
+3,178,183,194,192,183,252,76,3,174,252,1,32,254,226,250,252,78,0,1,0,51,0,
+0,3,106,5,182,0,5,0,0,1,17,35,17,33,53,3,106,184,253,129,5,182,250,74,5,18,
+164,0,2,0,125,0,0,5,16,5,182,0,8,0,16,0,0,19,16,0,33,33,17,33,32,0,19,16,
+33,51,17,35,32,0,125,1,123,1,86,1,194,254,105,254,143,254,117,194,2,82,199,
+240,254,236,254,235,2,233,1,86,1,119,250,74,1,126,1,101,253,187,4,123,254,
+226,0,0,1,0,150,255,227,1,148,0,248,0,11,0,0,55,52,54,51,50,22,21,20,6,35,
+34,38,150,65,60,61,68,68,61,59,66,111,66,71,71,66,65,75,74,0,0,1,0,130,254,
+197,1,154,0,248,0,15,0,0,55,52,54,51,50,22,21,20,6,7,53,54,55,7,34,38,150,
+65,60,63,72,150,130,129,31,15,59,66,111,66,71,72,65,167,236,23,95,47,145,
+1,74,0,0,2,0,150,255,227,3,26,0,248,0,11,0,23,0,0,55,52,54,51,50,22,21,20,
+6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,150,65,60,61,68,68,61,59,66,
+1,134,65,60,61,68,68,61,59,66,111,66,71,71,66,65,75,74,66,66,71,71,66,65,
+75,74,0,0,2,0,150,254,197,3,32,0,248,0,11,0,27,0,0,55,52,54,51,50,22,21,20,
+6,35,34,38,37,52,54,51,50,22,21,20,6,7,53,54,55,7,34,38,150,65,60,61,68,68,
+61,59,66,1,134,65,60,63,72,150,130,129,31,15,59,66,111,66,71,71,66,65,75,
+74,66,66,71,72,65,167,236,23,95,47,145,1,74,0,0,2,0,130,254,197,1,154,4,102,
+0,10,0,26,0,0,19,52,54,51,50,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,7,
+53,54,55,7,34,38,150,63,62,129,68,61,59,66,65,60,63,72,150,130,129,31,15,
+59,66,3,219,66,73,139,66,73,74,252,213,66,71,72,65,167,236,23,95,47,145,1,
+74,0,2,0,150,255,227,1,148,4,102,0,11,0,23,0,0,55,52,54,51,50,22,21,20,6,
+35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,150,65,60,61,68,68,61,59,66,63,
+62,63,66,68,61,59,66,111,66,71,71,66,65,75,74,3,174,66,73,72,67,64,75,74,
+0,2,0,150,0,151,4,122,3,79,0,3,0,15,0,0,19,53,33,21,19,52,54,51,50,22,21,
+20,6,35,34,38,150,2,156,74,65,60,61,68,68,61,59,66,2,160,175,175,254,131,
+66,71,71,66,65,75,74,0,0,2,0,150,0,252,3,200,3,79,0,3,0,7,0,0,19,53,33,21,
+1,53,33,21,150,3,50,252,206,3,50,2,160,175,175,254,92,175,175,0,0,1,0,130,
+3,154,1,154,5,205,0,15,0,0,19,52,54,51,50,22,21,20,6,7,53,54,55,7,34,38,150,
+65,60,63,72,150,130,129,31,15,59,66,5,68,66,71,72,65,167,236,23,95,47,145,
+1,74,0,1,0,150,0,0,3,50,0,175,0,3,0,0,51,53,33,21,150,2,156,175,175,0,0,0,
+0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,28,0,94,0,3,0,1,4,9,
+0,2,0,14,0,122,0,3,0,1,4,9,0,3,0,66,0,136,0,3,0,1,4,9,0,4,0,28,0,94,0,3,0,
+1,4,9,0,5,0,30,0,202,0,3,0,1,4,9,0,6,0,24,0,232,0,3,0,1,4,9,0,7,0,68,1,0,
+0,3,0,1,4,9,0,8,0,42,1,68,0,3,0,1,4,9,0,9,0,40,1,110,0,3,0,1,4,9,0,10,0,96,
+1,150,0,3,0,1,4,9,0,11,0,62,1,246,0,3,0,1,4,9,0,12,0,60,2,52,0,3,0,1,4,9,
+0,13,2,150,2,112,0,3,0,1,4,9,0,14,0,52,5,6,0,67,0,111,0,112,0,121,0,114,0,
+105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,76,0,105,0,
+115,0,117,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,76,0,105,
+0,115,0,117,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,
+0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,76,0,
+105,0,115,0,117,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,
+116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,
+97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,
+32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,
+0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,
+0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,
+0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,
+0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,
+110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,
+101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,
+0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,
+111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,
+0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,
+0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,
+73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,
+0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,
+0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,
+0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,
+120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,
+0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,
+0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,
+0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,
+0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,15,};
+#endif
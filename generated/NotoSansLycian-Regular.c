@@ -0,0 +1,186 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansLycian_Regular_ttf_size = 4308;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansLycian_Regular_ttf");
+asm(".type fz_font_NotoSansLycian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansLycian_Regular_ttf, 4308");
+asm(".balign 64");
+asm("fz_font_NotoSansLycian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansLycian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansLycian_Regular_ttf_size = 4308;
+const char fz_font_NotoSansLycian_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,122,231,111,80,0,0,1,56,0,0,0,96,
+99,109,97,112,0,219,5,7,0,0,2,28,0,0,0,172,103,97,115,112,0,22,0,35,0,0,16,
+196,0,0,0,16,103,108,121,102,210,129,49,134,0,0,3,12,0,0,7,150,104,101,97,
+100,4,69,193,49,0,0,0,188,0,0,0,54,104,104,101,97,15,66,4,175,0,0,0,244,0,
+0,0,36,104,109,116,120,157,74,14,73,0,0,1,152,0,0,0,132,108,111,99,97,27,
+52,29,78,0,0,2,200,0,0,0,68,109,97,120,112,0,37,0,35,0,0,1,24,0,0,0,32,110,
+97,109,101,140,63,184,157,0,0,10,164,0,0,6,0,112,111,115,116,255,105,0,102,
+0,0,16,164,0,0,0,32,0,1,0,0,0,1,10,61,241,219,78,201,95,15,60,245,0,11,8,
+0,0,0,0,0,204,74,160,74,0,0,0,0,210,40,203,249,0,10,255,223,6,169,5,212,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,6,219,0,10,0,10,6,169,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,1,0,0,0,33,0,34,0,3,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,234,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,0,0,0,
+2,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,2,88,0,0,0,1,
+0,0,0,0,4,0,5,154,0,0,0,32,0,0,4,0,0,102,0,0,0,0,4,20,0,0,2,20,0,0,4,207,
+0,200,5,121,0,40,5,52,0,200,5,243,0,200,4,115,0,200,4,204,0,40,4,113,0,200,
+4,53,0,200,4,81,0,100,5,34,0,80,2,172,0,250,4,61,0,200,5,190,0,130,5,9,0,
+30,6,219,0,50,5,225,0,200,4,180,0,10,4,230,0,80,6,64,0,125,5,6,0,200,5,243,
+0,120,4,240,0,200,3,108,0,130,4,132,0,30,6,131,0,100,5,9,0,30,6,193,0,100,
+4,230,0,80,5,9,0,30,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,
+0,0,12,0,8,0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,
+0,160,254,255,255,255,0,1,255,245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,12,0,0,0,0,0,88,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,
+0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,
+0,254,255,0,0,254,255,0,0,0,1,0,1,2,128,0,1,2,156,0,0,0,4,0,0,0,20,0,20,0,
+20,0,20,0,44,0,71,0,126,0,161,0,181,0,213,0,237,1,2,1,26,1,76,1,90,1,117,
+1,159,1,185,1,225,2,1,2,31,2,67,2,117,2,147,2,179,2,215,3,4,3,22,3,62,3,100,
+3,146,3,171,3,203,0,2,0,102,0,0,3,154,5,182,0,3,0,7,0,0,51,17,33,17,37,33,
+17,33,102,3,52,253,47,2,110,253,146,5,182,250,74,98,4,242,0,2,0,200,0,0,4,
+126,5,182,0,6,0,9,0,0,1,1,21,33,17,35,17,23,17,33,1,128,2,254,253,2,184,184,
+2,25,5,182,253,11,156,253,219,5,182,227,253,238,0,1,0,40,0,0,5,81,5,182,0,
+9,0,0,1,1,7,1,17,35,17,1,39,1,3,5,2,76,117,254,61,184,254,60,117,2,76,5,182,
+253,168,114,1,205,251,71,4,187,254,49,114,2,88,0,0,3,0,200,0,0,4,198,5,182,
+0,15,0,24,0,33,0,0,19,33,32,4,21,20,6,7,21,22,22,21,20,4,35,33,19,33,50,54,
+53,52,38,35,35,17,33,50,54,53,52,38,35,33,200,1,161,1,38,1,5,142,136,169,
+159,254,244,240,253,254,184,1,14,174,154,171,185,242,1,39,174,172,176,184,
+254,231,5,182,175,187,130,169,25,10,29,176,145,196,220,3,73,110,128,120,105,
+251,134,134,138,129,126,0,0,1,0,200,0,0,5,163,5,194,0,15,0,0,1,19,19,51,19,
+19,23,1,35,3,3,35,3,17,35,17,1,128,235,161,127,161,235,140,254,212,154,146,
+145,154,160,184,5,182,254,102,1,65,254,191,1,166,84,253,243,1,33,254,223,
+1,24,251,135,5,182,0,0,1,0,200,0,0,4,35,5,202,0,7,0,0,51,17,51,17,1,23,1,
+17,200,184,2,44,119,253,93,5,182,253,189,2,87,110,253,41,253,123,0,2,0,40,
+0,0,4,164,5,182,0,5,0,12,0,0,55,1,51,1,21,33,1,6,7,1,33,1,38,40,1,225,184,
+1,227,251,132,2,59,47,52,254,237,2,236,254,240,69,113,5,69,250,185,111,4,
+238,186,144,252,250,2,254,192,0,0,1,0,200,0,0,3,249,5,182,0,11,0,0,33,33,
+17,33,21,33,17,33,21,33,17,33,3,249,252,207,3,49,253,135,2,84,253,172,2,121,
+5,182,158,254,49,156,253,241,0,1,0,200,0,0,3,249,5,182,0,9,0,0,33,35,17,33,
+21,33,17,33,21,33,1,128,184,3,49,253,135,2,82,253,174,5,182,158,253,245,156,
+0,0,1,0,100,0,0,3,237,5,182,0,11,0,0,37,33,21,33,53,33,17,33,53,33,21,33,
+2,132,1,105,252,119,1,104,254,152,3,137,254,151,158,158,158,4,122,158,158,
+0,0,1,0,80,255,236,4,210,5,202,0,25,0,0,1,6,2,21,16,5,7,38,36,39,6,4,7,39,
+36,17,52,2,39,55,22,4,23,54,36,55,4,210,234,246,1,224,33,183,254,233,82,83,
+254,230,179,33,1,224,245,235,33,182,1,24,82,82,1,24,182,5,44,67,254,207,224,
+254,63,141,158,40,186,140,142,185,39,158,141,1,193,224,1,49,67,158,39,186,
+143,143,186,39,0,1,0,250,0,0,1,178,5,182,0,3,0,0,1,17,35,17,1,178,184,5,182,
+250,74,5,182,0,0,1,0,200,0,0,3,237,5,182,0,10,0,0,51,17,51,17,1,23,1,1,7,
+1,17,200,184,2,10,99,253,221,2,35,99,253,246,5,182,253,209,1,170,128,254,
+60,254,61,128,1,169,253,173,0,0,1,0,130,0,0,5,76,5,182,0,17,0,0,1,1,17,51,
+17,1,23,1,1,7,1,17,35,17,1,39,1,1,1,10,1,129,184,1,129,120,254,34,1,238,119,
+254,110,184,254,110,119,1,237,254,35,5,56,254,127,1,255,254,1,1,129,119,254,
+34,254,19,120,1,146,253,240,2,16,254,110,120,1,237,1,222,0,1,0,30,0,0,4,235,
+5,182,0,10,0,0,1,51,1,35,1,38,39,6,7,1,35,2,40,185,2,10,195,254,185,68,25,
+29,63,254,183,193,5,182,250,74,3,166,197,126,141,178,252,86,0,1,0,50,1,124,
+6,169,5,182,0,18,0,0,1,6,7,3,35,1,51,18,18,23,1,51,1,35,3,38,39,1,35,1,183,
+22,48,131,188,1,31,186,176,183,10,1,80,186,1,35,187,133,55,16,254,186,190,
+4,217,156,192,253,255,4,58,254,114,254,85,42,3,99,251,198,1,255,212,138,252,
+163,0,1,0,200,1,124,5,25,5,182,0,16,0,0,1,35,1,35,22,21,17,35,17,51,1,51,
+38,2,53,17,51,5,25,217,253,55,8,17,184,207,2,208,8,2,12,184,1,124,3,76,204,
+203,254,75,4,58,252,165,24,1,75,60,1,188,0,1,0,10,0,0,4,170,5,182,0,11,0,
+0,33,35,1,1,35,1,1,51,1,1,51,1,4,170,209,254,125,254,119,195,1,230,254,57,
+205,1,102,1,105,194,254,60,2,123,253,133,2,250,2,188,253,195,2,61,253,72,
+0,1,0,80,0,0,4,150,5,182,0,19,0,0,1,33,17,33,21,33,53,33,17,33,53,33,17,33,
+53,33,21,33,17,33,4,150,254,57,1,199,251,186,1,199,254,57,1,199,254,57,4,
+70,254,57,1,199,2,154,254,4,158,158,1,252,156,1,226,158,158,254,30,0,0,2,
+0,125,255,236,5,195,5,205,0,11,0,23,0,0,1,16,0,33,32,0,17,16,0,33,32,0,1,
+16,18,51,50,18,17,16,2,35,34,2,5,195,254,157,254,193,254,189,254,159,1,95,
+1,71,1,62,1,98,251,124,246,236,235,244,242,235,238,246,2,221,254,161,254,
+110,1,139,1,104,1,101,1,137,254,113,254,159,254,222,254,208,1,44,1,38,1,37,
+1,41,254,211,0,1,0,200,0,0,4,142,5,182,0,15,0,0,1,50,4,18,21,21,35,53,52,
+2,36,35,35,17,35,17,1,158,214,1,89,193,184,146,254,251,161,30,184,5,182,204,
+254,147,223,58,58,180,1,36,162,250,232,5,182,0,0,2,0,120,255,241,5,123,5,
+197,0,7,0,11,0,0,1,1,35,1,53,1,51,1,7,9,2,5,123,253,184,114,253,183,2,73,
+114,2,72,185,254,56,254,55,1,201,2,171,253,70,2,186,96,2,186,253,70,47,2,
+34,253,222,253,218,0,2,0,200,0,0,4,115,5,182,0,10,0,19,0,0,1,32,4,21,20,4,
+33,35,17,35,17,19,51,50,54,53,52,38,35,35,2,75,1,16,1,24,254,207,254,230,
+168,184,184,147,218,196,182,193,186,5,182,223,217,220,233,253,199,5,182,253,
+33,141,156,141,139,0,0,1,0,130,255,223,2,234,5,212,0,25,0,0,1,6,6,21,20,22,
+22,23,30,2,21,20,0,5,39,54,54,53,52,38,39,38,53,16,37,2,234,244,154,36,63,
+94,84,71,38,254,252,254,252,84,180,230,71,122,193,2,5,5,60,126,139,74,48,
+70,56,52,47,68,86,57,148,254,243,133,156,77,210,83,41,69,72,113,190,1,35,
+223,0,1,0,30,0,0,4,102,5,182,0,7,0,0,33,35,17,33,53,33,21,33,2,159,184,254,
+55,4,72,254,57,5,24,158,158,0,0,2,0,100,0,0,6,31,5,202,0,12,0,16,0,0,1,1,
+35,3,3,35,1,55,1,1,51,9,2,17,35,17,6,31,254,186,154,253,253,154,254,185,127,
+1,18,1,5,141,1,7,1,18,253,254,184,5,101,254,88,1,74,254,182,1,169,100,254,
+154,1,82,254,174,1,102,254,17,252,37,3,219,0,1,0,30,0,0,4,235,5,182,0,17,
+0,0,19,51,1,22,23,54,55,1,51,1,19,3,51,19,19,51,1,35,30,188,1,73,72,25,25,
+70,254,175,148,1,4,97,165,148,89,90,190,253,246,185,5,182,252,86,206,118,
+123,196,3,175,253,27,1,22,1,207,255,0,1,0,250,74,0,2,0,100,0,0,6,93,5,212,
+0,17,0,21,0,0,1,7,23,1,23,1,35,37,5,35,1,55,1,55,39,55,23,55,3,17,35,17,4,
+96,117,225,1,18,127,254,182,134,254,211,254,212,134,254,182,127,1,18,224,
+116,99,156,157,64,184,5,84,85,162,1,109,98,254,85,220,220,1,171,98,254,147,
+162,85,128,113,113,254,7,252,37,3,219,0,1,0,80,0,0,4,150,5,182,0,11,0,0,1,
+33,17,35,17,33,53,33,17,51,17,33,4,150,254,57,184,254,57,1,199,184,1,199,
+2,154,253,102,2,154,156,2,128,253,128,0,0,1,0,30,0,0,4,235,5,182,0,13,0,0,
+1,17,54,55,1,51,1,35,1,51,1,22,23,17,2,212,26,44,1,14,195,253,251,195,253,
+251,193,1,12,29,40,5,182,251,151,140,138,3,83,250,74,5,182,252,174,97,177,
+4,100,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,
+0,94,0,3,0,1,4,9,0,2,0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,0,
+4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,1,
+4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,0,
+3,0,1,4,9,0,10,0,96,1,162,0,3,0,1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,60,
+2,64,0,3,0,1,4,9,0,13,2,150,2,124,0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,0,
+112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,
+0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,
+108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,
+114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,
+115,0,32,0,76,0,121,0,99,0,105,0,97,0,110,0,82,0,101,0,103,0,117,0,108,0,
+97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,
+97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,
+0,97,0,110,0,115,0,32,0,76,0,121,0,99,0,105,0,97,0,110,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,
+0,116,0,111,0,83,0,97,0,110,0,115,0,76,0,121,0,99,0,105,0,97,0,110,0,78,0,
+111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,
+101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,
+112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,
+99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,
+0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,
+0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,
+0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,
+0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,
+0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,
+0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,
+83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,
+0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,
+0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,
+0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,
+0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,
+115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,
+0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,
+0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,
+0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,
+0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,
+0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,
+0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,
+0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,
+255,0,15,};
+#endif
@@ -0,0 +1,2518 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansMalayalam_Regular_ttf_size = 61200;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansMalayalam_Regular_ttf");
+asm(".type fz_font_NotoSansMalayalam_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansMalayalam_Regular_ttf, 61200");
+asm(".balign 64");
+asm("fz_font_NotoSansMalayalam_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansMalayalam-Regular.ttf\"");
+#else
+const int fz_font_NotoSansMalayalam_Regular_ttf_size = 61200;
+const char fz_font_NotoSansMalayalam_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,9,154,10,146,0,0,191,56,0,0,0,126,
+71,80,79,83,47,150,143,229,0,0,191,184,0,0,14,170,71,83,85,66,246,218,152,
+83,0,0,206,100,0,0,32,170,79,83,47,50,120,248,107,128,0,0,1,104,0,0,0,96,
+99,109,97,112,212,132,244,58,0,0,6,192,0,0,1,60,103,97,115,112,0,7,0,7,0,
+0,191,44,0,0,0,12,103,108,121,102,56,93,125,237,0,0,10,124,0,0,174,124,104,
+101,97,100,10,160,229,58,0,0,0,236,0,0,0,54,104,104,101,97,19,44,13,77,0,
+0,1,36,0,0,0,36,104,109,116,120,233,140,48,214,0,0,1,200,0,0,4,246,108,111,
+99,97,65,205,22,23,0,0,7,252,0,0,2,126,109,97,120,112,1,85,1,92,0,0,1,72,
+0,0,0,32,110,97,109,101,142,145,186,165,0,0,184,248,0,0,6,18,112,111,115,
+116,255,105,0,102,0,0,191,12,0,0,0,32,0,1,0,0,0,1,10,61,75,127,176,160,95,
+15,60,245,0,11,8,0,0,0,0,0,205,38,198,86,0,0,0,0,210,40,203,250,249,137,252,
+240,18,170,6,191,0,0,0,9,0,1,0,0,0,0,0,0,0,1,0,0,6,246,252,240,0,0,18,250,
+249,137,252,37,18,170,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,61,0,1,0,0,1,62,0,
+198,0,10,0,148,0,9,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,7,118,1,144,0,
+5,0,0,5,154,5,51,0,0,0,230,5,154,5,51,0,0,2,92,0,102,2,129,0,0,2,11,5,2,4,
+5,4,2,2,4,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,
+6,246,252,240,0,0,6,246,3,16,0,0,0,1,0,0,0,0,4,110,5,183,0,0,0,32,0,5,4,205,
+0,193,0,0,0,0,2,120,0,0,2,120,0,0,3,159,0,65,2,177,0,67,11,242,0,80,13,44,
+0,80,7,227,0,81,13,246,0,81,5,137,0,81,11,156,0,81,6,248,0,75,9,85,0,85,10,
+48,0,65,10,45,0,65,15,233,0,76,5,244,0,80,9,253,0,80,12,1,0,80,8,77,0,65,
+7,255,0,80,7,45,0,80,10,154,0,65,8,127,0,85,7,119,0,35,10,202,0,35,7,131,
+0,75,13,61,0,80,11,145,0,85,4,128,0,41,5,62,0,80,9,201,0,80,10,172,0,80,10,
+242,0,85,8,29,0,80,7,43,0,145,5,30,0,110,7,73,0,80,7,73,0,80,8,44,0,85,7,
+43,0,65,9,8,0,65,10,114,0,85,5,63,0,110,5,205,0,125,8,72,0,80,5,227,0,80,
+5,101,0,80,6,223,0,130,5,186,0,81,5,60,0,75,7,171,0,80,8,82,0,80,9,50,0,65,
+9,201,0,80,9,133,0,65,6,48,0,44,3,186,255,77,4,9,0,34,1,211,254,80,1,211,
+253,180,2,167,255,203,2,167,255,203,1,241,254,217,1,241,253,227,5,185,0,80,
+4,195,0,80,11,119,0,80,11,107,0,80,10,87,0,80,13,121,0,80,0,0,253,170,0,0,
+3,9,6,19,0,73,6,248,0,75,10,144,0,85,0,0,249,137,0,0,249,137,4,155,0,80,7,
+43,0,23,6,223,0,80,8,171,0,80,6,96,0,80,7,197,0,90,9,201,0,80,5,242,0,80,
+7,171,0,80,8,250,0,80,8,173,255,185,7,33,0,80,11,73,0,80,6,70,0,80,7,93,0,
+80,9,221,0,85,9,45,0,80,12,38,0,85,8,125,0,80,5,227,0,80,9,150,0,80,8,91,
+0,80,9,166,0,65,0,0,0,0,0,0,255,202,0,0,254,213,4,160,0,145,8,77,0,65,7,255,
+0,80,7,45,0,80,10,154,0,65,8,127,0,85,7,119,0,35,10,202,0,35,7,131,0,75,13,
+61,0,80,11,145,0,85,4,128,0,41,5,62,0,80,9,201,0,80,10,172,0,80,10,242,0,
+85,8,29,0,80,7,43,0,145,5,30,0,110,7,73,0,80,7,73,0,80,7,43,0,65,9,8,0,65,
+10,114,0,85,5,63,0,110,5,205,0,125,8,72,0,80,5,227,0,80,5,101,0,80,6,223,
+0,130,5,186,0,81,5,60,0,75,7,171,0,80,8,82,0,80,9,50,0,65,9,201,0,80,9,133,
+0,65,13,146,0,65,0,0,250,87,1,241,254,217,1,211,254,133,1,243,0,90,12,13,
+0,65,14,123,0,65,8,77,0,65,8,77,0,65,13,146,0,65,7,45,0,80,7,115,0,80,11,
+60,0,80,9,233,0,80,7,45,0,80,8,121,0,74,12,56,0,80,7,119,0,35,7,119,0,35,
+15,41,0,75,18,250,0,75,13,24,0,85,17,35,0,85,13,53,0,85,17,136,0,85,4,128,
+0,41,9,201,0,80,9,201,0,80,16,23,0,85,16,240,0,85,12,69,0,85,10,242,0,85,
+11,179,0,85,10,174,0,80,11,94,0,80,12,1,0,80,13,46,0,80,14,19,0,80,13,120,
+0,80,8,29,0,80,5,30,0,110,9,124,0,110,7,156,0,80,12,105,0,80,10,15,0,80,8,
+156,0,80,8,125,0,80,10,174,0,80,12,165,0,80,7,44,0,65,7,43,0,65,9,8,0,65,
+10,114,0,85,10,114,0,85,10,114,0,85,10,114,0,85,9,239,0,125,9,143,0,80,9,
+143,0,80,5,205,0,68,8,72,0,80,5,101,0,80,6,223,0,130,6,223,0,130,11,90,0,
+81,7,171,0,80,7,171,0,80,12,25,0,80,16,36,0,80,8,82,0,80,8,82,0,80,9,50,0,
+65,9,201,0,80,9,201,0,80,15,32,0,80,9,201,0,80,9,231,0,65,11,105,0,65,9,133,
+0,65,1,211,254,114,2,203,255,132,2,32,254,142,3,6,255,103,2,207,255,243,2,
+207,255,243,2,185,255,211,3,225,255,211,2,185,255,211,3,43,255,221,2,154,
+0,90,6,90,0,20,6,90,0,20,6,90,0,20,6,90,0,20,6,90,0,20,6,90,0,20,6,90,0,20,
+6,90,0,20,6,90,0,20,6,90,0,20,6,90,0,20,6,90,0,20,6,90,0,20,6,90,0,20,6,90,
+0,20,6,90,0,20,6,90,0,20,6,90,0,20,2,39,0,148,3,105,0,143,5,43,0,51,6,166,
+0,101,2,1,0,143,2,104,0,82,2,104,0,61,4,104,0,82,4,147,0,104,2,0,0,63,2,147,
+0,82,2,37,0,147,3,36,0,40,4,147,0,103,4,147,0,184,4,147,0,100,4,147,0,93,
+4,147,0,44,4,147,0,130,4,147,0,111,4,147,0,91,4,147,0,102,4,147,0,99,2,37,
+0,94,2,37,0,63,4,147,0,103,4,147,0,116,4,147,0,103,3,144,0,77,2,139,0,164,
+3,36,0,41,2,149,0,81,4,147,0,81,3,142,255,252,2,244,0,62,4,104,1,134,2,244,
+0,82,4,147,0,103,2,147,0,82,4,0,0,82,8,0,0,82,1,202,0,73,1,202,0,73,3,75,
+0,73,3,75,0,73,6,111,0,147,4,147,0,133,4,147,0,104,4,147,0,103,4,147,0,147,
+2,205,1,104,4,143,1,104,0,0,252,194,0,0,252,177,7,45,0,80,7,45,0,80,7,73,
+0,80,7,73,0,80,9,28,0,80,9,28,0,80,7,43,0,65,7,43,0,65,5,205,0,125,5,205,
+0,125,7,182,0,80,7,182,0,80,9,201,0,80,0,80,0,0,0,0,0,1,0,3,0,1,0,0,0,12,
+0,4,1,48,0,0,0,70,0,64,0,5,0,6,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,160,0,
+173,0,215,0,247,3,7,3,35,9,101,13,3,13,12,13,16,13,58,13,68,13,72,13,78,13,
+87,13,99,13,117,13,127,32,13,32,20,32,25,32,29,32,38,32,185,34,18,37,204,
+254,255,255,255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,173,0,215,
+0,247,3,7,3,35,9,100,13,2,13,5,13,14,13,18,13,61,13,70,13,74,13,87,13,96,
+13,102,13,121,32,11,32,19,32,24,32,28,32,38,32,185,34,18,37,204,254,255,255,
+255,0,1,255,245,0,0,0,216,0,215,0,188,0,161,255,99,0,115,0,81,0,50,254,39,
+254,12,247,200,243,2,243,1,243,0,242,255,242,253,242,252,242,251,242,243,
+242,235,242,233,242,230,224,91,225,14,225,11,225,9,225,1,224,114,223,24,218,
+157,1,103,0,1,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,3,0,250,0,251,0,252,0,0,0,21,0,21,0,21,0,21,0,62,0,133,1,30,1,212,
+2,71,2,83,2,175,2,187,3,60,3,169,4,23,4,150,4,162,4,250,5,6,5,18,5,115,5,
+189,6,9,6,84,6,193,6,235,7,82,7,231,8,116,8,252,9,49,9,96,9,193,10,51,10,
+167,11,7,11,52,11,121,11,195,12,11,12,103,12,150,12,220,13,61,13,147,13,206,
+14,57,14,132,14,185,14,227,15,84,15,172,15,227,16,65,16,157,17,0,17,79,17,
+109,17,172,17,214,17,252,18,50,18,119,18,212,19,23,19,115,19,188,20,18,20,
+30,20,46,20,62,20,78,20,119,20,139,20,208,21,120,22,4,22,13,22,22,22,71,22,
+135,22,187,23,5,23,96,23,210,24,61,24,143,24,217,25,72,25,159,25,244,26,116,
+26,173,27,10,27,138,27,235,28,134,28,252,29,93,29,233,30,94,30,236,30,236,
+30,249,31,23,31,114,31,126,31,138,31,150,31,162,31,174,31,186,31,198,31,210,
+31,222,31,234,31,246,32,2,32,14,32,26,32,38,32,50,32,62,32,74,32,86,32,98,
+32,110,32,122,32,134,32,146,32,158,32,170,32,182,32,194,32,206,32,218,32,
+230,32,242,32,254,33,10,33,22,33,34,33,46,33,124,33,185,33,208,33,246,34,
+132,35,46,35,192,36,107,36,251,37,124,37,217,38,72,38,171,39,67,39,192,40,
+105,40,174,41,49,42,58,43,53,43,192,44,132,45,84,46,31,46,118,47,39,47,240,
+48,141,49,60,49,189,50,143,51,36,51,152,52,49,52,179,53,66,53,225,54,91,55,
+5,55,101,55,228,56,65,56,183,57,22,57,108,58,13,58,128,58,228,59,57,59,177,
+60,68,60,191,61,82,61,233,62,145,62,250,63,70,63,82,63,209,64,90,64,178,65,
+0,65,116,66,70,66,193,67,18,67,136,68,59,68,232,69,150,70,28,70,203,71,128,
+72,5,72,177,73,12,73,113,74,11,74,45,74,84,74,138,74,192,75,6,75,99,75,167,
+76,3,76,62,76,85,76,123,76,232,77,99,77,111,77,123,77,135,77,147,77,158,77,
+169,77,180,77,192,77,204,77,216,77,228,77,240,77,251,78,6,78,17,78,29,78,
+59,78,87,78,147,78,228,78,249,79,45,79,96,79,138,79,168,79,195,79,213,79,
+245,80,16,80,62,80,85,80,130,80,189,80,225,81,16,81,77,81,96,81,170,81,230,
+82,34,82,90,82,117,82,143,82,170,82,254,83,28,83,55,83,85,83,106,83,126,83,
+198,83,223,84,40,84,95,84,103,84,122,84,141,84,172,84,203,84,252,85,45,85,
+126,85,166,85,215,85,234,86,33,86,52,86,78,86,106,86,134,86,146,86,158,86,
+170,86,182,86,198,86,214,86,226,86,238,86,250,87,6,87,22,87,38,87,50,87,62,
+0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,
+252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,3,0,65,255,232,3,94,
+4,110,0,11,0,23,0,24,0,0,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,
+54,53,52,38,35,34,6,19,65,221,176,179,221,221,178,180,218,173,123,102,103,
+123,122,105,104,120,219,1,105,169,214,210,173,173,212,212,170,112,130,129,
+116,115,128,129,2,147,0,0,4,0,67,255,232,2,110,4,138,0,11,0,23,0,35,0,47,
+0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,
+19,50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,1,88,
+123,155,155,123,124,153,155,122,63,71,73,61,60,72,69,63,123,155,155,123,124,
+153,155,122,63,71,73,61,60,72,69,4,138,151,116,116,149,150,115,115,152,254,
+114,73,60,58,73,72,59,59,74,255,0,151,116,116,149,150,115,115,152,254,114,
+73,60,58,73,72,59,59,74,0,0,4,0,80,255,232,11,162,4,138,0,74,0,93,0,106,0,
+107,0,0,33,35,17,52,38,38,35,34,7,22,22,21,20,6,7,22,22,21,20,6,35,34,2,53,
+52,18,55,38,35,34,4,21,16,23,7,38,2,53,52,18,36,51,50,23,54,51,50,22,23,54,
+54,51,50,4,18,21,20,2,35,34,38,38,53,52,54,51,50,23,38,38,35,34,6,6,21,1,
+6,2,21,20,22,51,50,53,52,38,35,35,53,51,50,53,52,38,1,38,35,34,6,21,20,22,
+51,50,54,53,52,1,7,125,177,73,168,154,34,32,88,88,85,83,92,98,201,185,218,
+246,134,135,59,72,237,254,246,249,101,157,173,159,1,47,209,173,148,134,164,
+151,222,87,93,226,147,211,1,52,163,229,205,119,181,98,210,175,138,107,53,
+249,177,123,167,90,252,198,141,151,155,141,210,124,117,39,29,229,96,6,83,
+96,144,120,127,115,110,135,129,247,75,2,63,175,173,101,3,44,134,89,84,110,
+36,32,128,85,138,165,1,20,229,167,1,11,99,6,250,211,254,216,152,129,89,1,
+49,191,177,1,17,145,51,51,96,109,111,94,160,254,207,202,252,254,245,107,197,
+122,193,232,95,133,149,86,167,170,1,127,64,254,239,148,180,196,170,79,84,
+144,165,79,109,254,128,125,145,133,140,146,193,192,24,254,127,0,0,5,0,80,
+253,78,12,242,4,138,0,92,0,111,0,124,0,125,0,126,0,0,1,54,51,50,22,23,54,
+54,51,50,4,23,22,18,21,16,0,33,34,39,55,22,51,50,54,53,52,38,39,22,21,20,
+6,35,34,38,38,53,52,36,33,50,23,38,38,35,34,6,6,21,17,35,17,52,38,38,35,34,
+7,22,22,21,20,6,7,22,22,21,20,6,35,34,2,53,52,18,55,38,35,34,4,21,16,23,7,
+38,2,53,52,18,36,51,50,23,6,2,21,20,22,51,50,53,52,38,35,35,53,51,50,53,52,
+38,1,38,35,34,6,21,20,22,51,50,54,53,52,1,1,4,48,134,164,150,223,86,83,229,
+146,227,1,58,68,198,220,254,176,254,207,183,160,57,122,169,227,234,103,102,
+7,228,208,118,174,92,1,23,1,2,25,24,58,209,152,112,179,80,177,73,168,154,
+34,32,88,88,85,83,92,98,201,185,218,246,134,135,59,72,237,254,246,249,101,
+157,173,159,1,47,209,173,167,141,151,155,141,210,124,117,39,29,229,96,6,32,
+41,50,184,183,112,103,126,133,247,202,2,241,4,87,51,96,108,102,102,212,199,
+58,254,210,205,254,229,254,197,60,143,53,233,217,136,196,59,59,62,233,249,
+97,176,102,204,226,1,117,117,92,171,161,253,178,2,63,175,173,101,3,44,134,
+89,84,110,36,32,128,85,138,165,1,20,229,167,1,11,99,6,250,211,254,216,152,
+129,89,1,49,191,177,1,17,145,188,64,254,239,148,180,196,170,79,84,144,165,
+79,109,254,202,7,145,144,103,130,177,166,92,254,103,252,190,0,0,3,0,81,253,
+78,7,147,4,138,0,69,0,79,0,80,0,0,1,54,54,51,50,22,22,21,20,6,6,4,35,33,34,
+6,6,21,20,22,51,33,21,33,34,38,53,52,54,54,51,33,50,54,54,53,52,38,38,35,
+34,6,6,21,17,35,17,52,38,38,35,32,7,54,51,50,22,21,20,6,35,34,38,53,52,54,
+36,51,50,22,1,22,51,50,54,53,52,38,35,34,1,4,76,58,186,112,144,219,120,89,
+180,254,254,215,253,106,116,96,45,108,144,5,85,250,164,220,202,65,165,156,
+2,172,214,235,139,74,144,101,91,109,44,177,62,148,136,254,215,111,97,108,
+143,162,183,161,161,189,146,1,16,178,149,206,252,227,5,189,83,93,87,80,112,
+1,140,3,229,81,84,139,252,144,163,238,159,67,28,57,41,72,66,148,148,124,79,
+124,81,75,204,204,97,184,106,87,139,146,254,119,1,127,141,152,93,227,61,165,
+134,140,177,212,189,146,242,137,80,254,51,245,97,79,78,87,250,129,255,255,
+0,81,253,78,13,166,4,138,0,34,0,8,0,0,0,3,0,74,7,227,0,0,0,3,0,81,253,78,
+5,57,4,138,0,51,0,61,0,62,0,0,1,21,33,34,38,53,52,54,54,51,51,32,54,54,53,
+52,38,35,32,7,54,51,50,22,21,20,6,35,34,38,53,52,54,36,51,50,4,18,21,20,6,
+6,4,35,35,34,6,6,21,20,22,51,1,22,51,50,54,53,52,38,35,34,1,5,17,252,250,
+220,202,65,165,156,23,1,6,254,131,240,222,254,196,114,96,109,143,162,183,
+161,161,189,155,1,30,189,197,1,25,148,91,192,254,233,236,4,116,96,45,108,
+144,254,217,5,189,83,93,87,80,112,1,140,254,248,148,148,124,79,124,81,80,
+191,182,184,237,226,60,165,134,140,177,212,189,150,241,134,142,254,249,161,
+154,226,151,65,28,57,41,72,66,3,117,245,97,79,78,87,250,129,255,255,0,81,
+253,78,11,76,4,138,0,34,0,10,0,0,0,3,0,74,5,137,0,0,0,5,0,75,253,78,6,173,
+4,138,0,48,0,60,0,72,0,85,0,86,0,0,37,38,2,53,52,54,51,50,22,21,20,6,35,34,
+39,30,2,51,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,7,22,22,21,
+20,4,33,32,36,53,52,54,1,38,38,35,34,6,21,20,22,51,50,54,37,22,22,51,50,54,
+53,52,38,35,34,6,1,35,32,4,21,20,4,33,32,36,53,52,38,1,1,147,145,183,206,
+178,163,187,172,150,139,100,43,147,224,198,50,195,235,152,44,103,136,153,
+169,196,169,170,199,191,144,133,134,254,146,254,137,254,115,254,152,130,4,
+253,6,110,99,92,103,95,88,64,110,251,17,51,110,66,88,95,100,86,103,117,2,
+144,16,254,219,254,249,1,13,1,51,1,33,1,19,255,254,127,229,56,1,13,181,197,
+230,189,148,138,174,71,95,123,46,42,117,105,71,177,140,146,186,227,193,195,
+254,245,48,41,145,103,196,183,182,203,98,140,2,49,137,135,103,86,81,92,39,
+58,55,42,92,81,84,105,135,253,55,111,116,127,106,108,122,118,112,252,162,
+0,0,3,0,85,255,232,9,4,4,138,0,53,0,66,0,77,0,0,33,35,17,52,38,38,35,34,6,
+7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,23,54,54,51,50,4,18,
+21,20,2,35,34,38,53,52,54,51,50,23,38,38,35,34,6,6,21,5,38,35,34,6,21,20,
+22,51,50,54,53,52,5,22,22,51,50,54,53,52,38,35,34,4,224,177,80,148,112,185,
+255,32,118,130,152,182,189,161,119,187,100,162,1,43,188,145,207,85,88,220,
+147,211,1,52,163,229,205,182,216,210,175,138,107,53,249,177,123,167,90,3,
+121,96,144,120,127,115,110,135,129,248,162,5,128,110,79,96,104,88,116,2,115,
+165,151,72,226,195,78,179,156,166,195,121,235,162,201,1,47,164,89,103,101,
+91,160,254,207,202,252,254,245,240,186,193,232,95,133,149,86,167,170,32,125,
+145,133,140,146,193,192,24,93,151,166,106,97,97,110,0,3,0,65,253,78,9,214,
+4,138,0,60,0,69,0,70,0,0,1,39,54,18,53,16,2,35,34,0,17,20,23,33,17,51,17,
+20,6,6,35,34,38,39,33,39,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,
+50,22,22,21,20,7,33,38,53,16,18,36,51,32,0,17,20,2,1,22,22,51,50,54,54,53,
+53,1,8,158,129,130,131,254,241,236,255,0,4,1,125,178,64,125,94,166,226,43,
+253,244,59,89,121,111,104,128,120,93,99,101,224,181,120,184,100,63,1,109,
+6,164,1,50,210,1,62,1,94,159,252,35,22,137,96,41,48,22,252,10,254,46,102,
+141,1,113,219,1,48,1,89,254,128,254,163,89,48,2,176,252,77,135,142,74,241,
+225,107,83,133,113,128,131,98,150,80,119,68,180,105,163,206,91,166,97,131,
+79,71,80,1,11,1,138,206,254,96,254,127,228,254,73,1,50,157,168,35,64,73,153,
+253,78,0,0,3,0,65,253,78,9,234,4,138,0,77,0,86,0,87,0,0,37,33,17,51,17,20,
+6,6,35,34,38,39,33,39,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,
+22,22,21,20,7,33,38,53,16,0,33,50,4,22,21,20,6,7,4,17,20,6,35,34,38,39,55,
+22,51,50,54,53,52,38,35,53,54,54,53,52,38,35,32,0,17,20,23,22,22,51,50,54,
+54,53,53,1,5,75,1,125,178,64,125,94,166,226,43,253,244,59,89,121,111,104,
+128,120,93,99,101,224,181,120,184,100,63,1,109,6,1,145,1,109,185,1,5,134,
+123,117,1,6,213,192,38,99,19,34,48,64,114,121,161,145,148,136,209,194,254,
+225,254,217,19,22,137,96,41,48,22,252,10,144,2,176,252,77,135,142,74,241,
+225,107,83,133,113,128,131,98,150,80,119,68,180,105,163,206,91,166,97,131,
+79,71,80,1,150,1,205,121,221,140,125,197,62,99,254,242,188,205,11,5,141,13,
+131,122,130,153,140,32,158,136,151,183,254,137,254,154,89,192,157,168,35,
+64,73,153,253,78,255,255,0,76,253,78,15,143,4,138,0,34,0,66,252,0,0,3,0,14,
+5,185,0,0,0,2,0,80,255,232,5,170,4,138,0,50,0,61,0,0,1,54,51,50,22,21,20,
+6,35,34,38,38,53,52,18,36,51,32,4,21,20,7,22,22,21,20,6,35,34,39,55,22,51,
+50,54,53,52,38,38,35,35,53,51,50,54,53,52,38,35,34,4,3,22,22,51,50,54,53,
+52,38,35,34,1,4,115,127,152,182,189,161,117,189,100,193,1,106,242,1,17,1,
+21,193,105,111,188,171,91,98,37,73,71,98,92,64,103,106,34,35,122,127,186,
+183,251,254,186,57,5,129,109,79,96,105,87,117,2,86,74,179,156,166,195,122,
+231,155,202,1,54,166,176,162,178,81,37,143,94,150,165,23,141,20,85,89,64,
+88,44,144,95,87,97,101,219,254,154,154,164,106,97,97,110,0,255,255,0,80,255,
+232,9,168,4,138,0,34,0,17,0,0,0,3,0,59,5,244,0,0,255,255,0,80,255,232,11,
+177,4,138,0,34,0,17,0,0,0,3,0,74,5,238,0,0,0,4,0,65,255,232,8,12,4,138,0,
+37,0,44,0,51,0,62,0,0,37,6,6,35,34,38,53,52,62,2,55,54,18,51,50,22,23,4,22,
+21,20,6,35,34,39,55,22,51,50,53,52,38,39,2,2,35,34,3,33,38,38,35,34,6,1,33,
+22,22,51,50,54,5,38,38,39,6,6,21,20,22,51,50,3,7,81,158,93,181,197,64,125,
+175,165,24,255,198,203,247,25,1,13,245,187,170,125,81,40,72,68,206,160,174,
+12,251,213,179,123,2,86,17,149,132,135,150,2,74,253,163,6,150,145,145,152,
+253,81,40,44,4,182,166,107,100,120,74,51,47,176,159,79,134,91,51,5,233,1,
+2,253,238,5,188,167,158,177,25,138,19,189,104,108,6,254,245,254,228,2,184,
+173,173,173,254,195,204,204,204,136,67,170,102,2,105,102,96,102,0,0,2,0,80,
+255,232,7,110,4,138,0,36,0,47,0,0,37,54,54,53,52,38,35,34,4,7,54,51,50,22,
+21,20,6,35,34,38,38,53,52,18,36,51,32,0,17,20,6,7,33,17,51,17,33,1,22,22,
+51,50,54,53,52,38,35,34,3,207,130,98,241,205,183,254,237,41,116,128,152,182,
+189,161,118,188,100,174,1,61,195,1,36,1,71,73,87,1,242,179,252,170,252,223,
+4,129,110,80,95,105,87,118,111,114,206,123,212,248,225,192,75,179,156,166,
+195,121,227,152,201,1,57,172,254,193,254,245,125,205,102,3,222,251,146,1,
+181,152,166,109,95,96,110,0,0,5,0,80,255,233,6,221,4,138,0,41,0,42,0,43,0,
+44,0,45,0,0,1,52,54,54,51,50,0,21,20,2,7,39,54,17,52,38,35,34,6,6,21,21,20,
+6,6,35,34,0,17,52,18,55,23,6,17,20,22,51,50,54,54,53,1,21,1,21,3,60,88,190,
+167,219,1,9,143,174,110,247,167,140,106,122,34,113,187,139,227,254,250,153,
+164,110,247,165,136,115,116,36,1,85,254,4,2,129,194,202,125,254,204,254,186,
+254,220,139,126,177,1,52,189,231,110,193,195,18,211,208,102,1,43,1,6,197,
+1,42,129,127,177,254,197,190,228,101,185,203,254,42,144,4,110,144,0,2,0,65,
+0,0,10,9,4,138,0,42,0,51,0,0,1,17,33,17,51,17,33,17,33,39,54,53,52,38,35,
+34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,7,33,53,52,54,54,51,50,22,
+21,21,39,52,38,35,34,6,21,21,33,4,238,4,106,177,250,52,254,99,59,89,121,111,
+104,128,120,93,99,101,224,181,120,184,100,63,1,18,118,219,157,246,246,177,
+149,168,166,149,2,120,1,198,254,202,3,222,251,146,1,198,107,83,133,113,128,
+131,98,150,80,119,68,180,105,163,206,91,166,97,131,79,43,193,217,111,252,
+251,205,201,192,171,172,188,60,0,2,0,85,255,232,8,53,4,138,0,67,0,78,0,0,
+1,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,
+23,54,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,
+38,35,35,53,51,32,53,52,38,35,34,6,6,21,17,35,1,22,22,51,50,54,53,52,38,35,
+34,4,47,80,148,112,185,255,32,118,130,152,182,189,161,119,187,100,162,1,43,
+188,150,214,90,75,242,140,200,234,95,100,106,111,193,173,98,104,37,81,64,
+107,102,64,115,123,54,53,1,25,129,124,136,178,87,177,252,205,5,128,110,79,
+96,104,88,116,2,115,165,151,72,226,195,78,179,156,166,195,121,235,162,201,
+1,47,164,97,115,102,110,176,145,98,133,43,37,144,94,149,166,23,141,20,86,
+88,59,88,48,144,192,90,98,109,200,208,254,15,1,180,151,166,106,97,97,110,
+0,1,0,35,0,0,6,230,4,110,0,27,0,0,51,53,33,54,53,52,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,21,20,7,33,17,51,17,35,3,34,94,110,102,100,113,5,170,
+11,217,177,179,200,81,2,53,179,144,87,130,113,129,119,106,51,28,23,60,62,
+158,191,204,164,134,101,3,222,251,146,0,0,3,0,35,255,232,10,122,4,138,0,55,
+0,69,0,70,0,0,1,38,38,35,34,4,21,20,22,23,7,33,53,33,54,53,52,38,35,34,6,
+21,20,23,7,38,53,52,54,51,50,22,21,20,7,33,38,53,52,18,36,51,50,4,18,21,20,
+2,35,34,38,53,52,54,51,50,19,38,38,35,34,6,21,20,22,51,50,54,53,52,1,9,175,
+51,253,174,226,254,254,102,126,73,249,155,3,34,94,110,102,100,113,5,170,11,
+217,177,179,200,81,1,223,166,155,1,46,208,209,1,51,166,229,205,182,216,210,
+175,138,135,47,123,68,120,127,115,110,134,130,251,155,2,220,134,148,242,213,
+125,212,111,111,144,87,130,113,129,119,106,51,28,23,60,62,158,191,204,164,
+134,101,194,229,169,1,19,151,157,254,207,205,252,254,245,240,186,193,232,
+254,246,61,62,145,133,140,146,193,195,19,2,95,0,0,4,0,75,255,232,7,48,4,138,
+0,68,0,81,0,94,0,109,0,0,1,54,54,51,50,22,22,21,20,6,7,22,22,21,20,6,35,34,
+38,39,6,4,35,34,38,53,52,54,54,51,33,50,54,54,53,52,38,35,34,6,6,21,21,35,
+53,52,46,2,35,34,7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,5,6,
+21,20,22,51,50,54,53,52,38,35,34,1,6,21,20,22,51,50,54,53,52,38,35,34,7,6,
+35,33,34,6,6,21,20,51,50,54,54,55,54,4,11,67,184,118,133,198,105,94,101,70,
+70,157,143,144,161,3,119,254,59,200,156,174,53,157,160,2,213,183,196,115,
+145,135,100,121,40,169,35,89,127,106,170,95,51,50,127,138,161,139,146,165,
+125,244,165,140,194,253,56,13,84,81,72,75,76,78,74,3,245,8,85,78,72,75,82,
+70,80,238,109,152,254,108,112,91,47,161,79,179,154,212,64,3,229,82,83,102,
+183,105,119,154,53,28,105,77,124,136,138,125,84,179,130,125,56,107,83,47,
+125,116,107,147,81,132,123,152,130,100,128,94,42,56,15,131,104,113,145,154,
+136,105,174,102,78,237,35,32,82,84,74,64,62,69,253,208,31,38,74,77,69,63,
+66,69,15,15,20,50,37,117,37,59,92,28,0,5,0,80,255,232,12,237,4,138,0,81,0,
+92,0,93,0,94,0,95,0,0,1,51,17,20,30,2,51,50,54,53,16,39,55,22,18,21,20,2,
+6,35,34,38,39,6,35,34,46,2,53,53,16,38,35,34,7,22,18,21,20,6,35,34,38,53,
+52,18,55,38,35,34,6,6,21,16,23,7,38,2,53,52,18,36,51,50,23,54,51,50,22,22,
+21,21,20,22,22,51,50,54,54,53,1,6,6,21,20,22,51,50,17,52,2,1,21,1,9,64,177,
+17,60,108,77,139,183,245,122,162,141,127,232,151,112,166,66,113,237,87,148,
+116,41,201,190,86,66,135,150,219,197,196,222,143,136,70,94,143,215,116,249,
+101,157,173,160,1,32,190,173,142,147,155,211,242,102,42,108,89,83,113,43,
+250,203,111,123,121,117,236,130,253,192,8,144,4,110,253,175,113,133,108,64,
+239,179,1,61,174,130,130,254,213,192,163,254,252,142,88,99,187,58,139,182,
+153,31,1,10,216,18,96,254,222,169,224,248,250,222,173,1,26,98,20,112,213,
+137,254,216,152,129,89,1,49,191,176,1,17,146,67,67,152,233,193,42,174,159,
+86,88,154,140,1,174,76,251,155,166,167,1,77,146,1,4,253,53,144,3,222,0,4,
+0,85,255,232,11,65,4,138,0,69,0,80,0,91,0,92,0,0,33,17,52,38,38,35,34,6,7,
+54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,23,54,54,51,50,23,54,
+51,50,4,18,21,16,5,39,54,54,53,52,38,38,35,34,7,22,18,21,20,6,35,34,38,53,
+52,18,55,38,35,34,6,6,21,17,1,6,2,21,20,22,51,50,17,52,2,1,22,22,51,50,54,
+53,52,38,35,34,1,4,47,80,148,112,185,255,32,118,130,152,182,189,161,119,187,
+100,162,1,43,188,148,209,86,72,221,149,180,137,146,191,186,1,19,147,254,182,
+101,123,126,108,202,136,108,75,129,141,219,198,197,221,151,143,65,91,157,
+163,75,2,173,115,133,121,117,237,119,249,3,5,128,110,79,96,104,88,116,7,235,
+2,115,165,151,72,226,195,78,179,156,166,195,121,235,162,201,1,47,164,93,106,
+99,100,66,66,145,254,243,173,254,128,209,129,75,225,143,135,216,116,20,98,
+254,225,168,223,249,250,222,171,1,28,99,19,109,174,190,253,220,3,169,73,255,
+0,155,166,167,1,77,151,1,3,254,85,151,166,106,97,97,110,254,127,0,1,0,41,
+255,232,4,73,4,138,0,36,0,0,55,55,22,51,50,54,53,52,38,35,35,34,38,53,52,
+54,51,32,23,7,38,35,34,6,21,20,22,51,51,50,22,21,20,6,35,34,36,41,95,210,
+254,149,154,132,198,20,239,243,250,229,1,47,244,95,201,253,144,154,141,222,
+15,242,212,254,237,154,254,254,121,136,133,100,90,96,90,153,170,158,181,139,
+137,128,102,87,94,81,168,164,160,182,67,0,0,2,0,80,255,232,4,238,4,138,0,
+13,0,25,0,0,1,16,0,33,34,36,2,53,52,18,36,51,32,0,3,52,38,35,34,6,21,20,22,
+51,50,54,4,238,254,192,254,240,181,254,246,143,142,1,11,178,1,19,1,64,182,
+217,191,191,219,216,192,193,217,2,54,254,243,254,191,148,1,18,174,173,1,14,
+147,254,192,254,239,202,243,238,207,205,240,240,0,4,0,80,255,232,9,121,4,
+138,0,60,0,61,0,62,0,63,0,0,1,52,38,38,35,34,6,21,16,23,7,38,2,53,16,0,51,
+50,30,2,21,21,20,22,22,51,50,54,54,53,17,51,17,20,30,2,51,50,54,53,16,39,
+55,22,18,21,20,2,6,35,34,38,39,6,35,34,38,38,53,3,21,1,3,59,39,121,100,136,
+171,245,117,165,143,1,19,226,105,161,114,45,42,108,89,83,113,43,177,17,60,
+108,77,139,183,245,122,162,141,127,232,151,112,166,66,113,237,138,180,76,
+158,5,12,2,74,161,169,98,230,190,254,205,175,129,131,1,37,193,1,0,1,50,63,
+132,190,171,54,186,157,86,88,154,140,2,117,253,175,113,133,108,64,239,179,
+1,61,174,130,130,254,213,192,163,254,252,142,88,99,187,133,206,203,254,138,
+144,3,222,0,4,0,80,255,232,10,87,4,138,0,64,0,75,0,76,0,77,0,0,1,20,22,22,
+51,50,54,55,6,35,34,38,53,52,54,51,50,18,21,20,2,4,35,34,38,39,6,35,34,38,
+38,53,53,52,38,38,35,34,6,21,16,23,7,38,2,53,16,0,51,50,30,2,21,21,20,22,
+22,51,50,54,54,53,17,51,1,38,38,35,34,6,21,20,22,51,50,1,21,6,125,76,149,
+115,182,253,35,109,129,160,182,193,165,179,219,160,254,216,187,139,205,91,
+114,234,138,180,76,39,121,100,136,171,245,117,165,143,1,19,226,105,161,114,
+45,42,108,89,83,113,43,177,3,52,7,129,108,79,96,100,92,120,249,87,1,255,161,
+153,74,221,197,75,182,160,161,191,254,253,239,208,254,201,167,80,103,183,
+133,206,203,68,161,169,98,230,190,254,205,175,129,131,1,37,193,1,0,1,50,63,
+132,190,171,54,186,157,86,88,154,140,2,117,254,79,155,163,106,97,100,107,
+254,47,144,0,0,3,0,85,255,232,10,162,4,138,0,67,0,78,0,79,0,0,1,54,54,51,
+50,22,23,54,54,51,50,22,18,21,20,2,7,39,54,54,53,52,38,35,34,14,2,21,17,35,
+17,52,38,38,35,34,6,6,21,17,35,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,
+35,34,38,38,53,52,18,36,51,50,22,1,22,22,51,50,54,53,52,38,35,34,1,4,138,
+65,177,111,121,176,55,67,169,124,148,225,122,153,165,109,125,122,178,139,
+80,104,64,19,177,56,118,93,86,119,61,177,80,148,112,185,255,32,118,130,152,
+182,189,161,119,187,100,162,1,43,188,136,208,252,198,5,128,110,79,96,104,
+88,116,7,15,3,214,90,90,92,92,94,90,143,254,252,161,192,254,217,129,127,88,
+242,159,182,235,55,104,137,122,253,171,2,140,149,142,72,75,145,162,253,135,
+2,115,165,151,72,226,195,78,179,156,166,195,121,235,162,201,1,47,164,84,253,
+126,151,166,106,97,97,110,254,127,0,0,4,0,80,255,232,7,205,4,138,0,47,0,58,
+0,59,0,60,0,0,37,7,38,2,53,52,18,36,51,50,23,54,51,50,4,18,21,16,5,39,54,
+54,53,52,38,38,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,6,6,21,
+16,1,6,6,21,20,22,51,50,17,52,2,1,21,1,255,101,157,173,160,1,32,190,176,147,
+148,200,186,1,19,147,254,182,101,123,126,109,203,135,119,73,136,144,219,198,
+196,222,146,141,75,97,143,215,116,3,11,113,127,121,117,237,127,253,198,111,
+129,89,1,49,191,176,1,17,146,71,71,145,254,243,173,254,128,209,129,75,225,
+143,135,215,117,22,99,254,223,163,223,249,250,222,166,1,26,103,22,112,213,
+137,254,216,2,157,74,252,153,166,167,1,77,144,1,3,253,56,144,0,0,2,0,145,
+0,0,6,169,4,138,0,15,0,26,0,0,37,17,52,62,2,51,50,22,22,21,17,33,17,51,17,
+1,52,38,38,35,34,6,6,21,17,33,2,183,63,132,186,117,172,232,108,249,232,179,
+4,180,58,156,117,115,149,61,2,144,144,1,225,148,187,132,70,130,222,185,253,
+143,4,110,252,34,1,158,162,192,102,101,184,155,254,82,0,2,0,110,255,233,4,
+212,4,138,0,43,0,44,0,0,1,22,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,
+38,35,35,53,51,32,53,52,38,35,34,2,17,20,23,7,38,38,53,16,0,33,50,22,21,20,
+6,1,3,251,106,111,204,182,117,105,37,91,80,113,110,64,115,123,94,93,1,25,
+141,133,226,246,51,168,29,35,1,88,1,57,207,240,95,253,118,2,55,37,144,94,
+148,167,23,141,20,86,88,59,88,48,144,192,90,98,254,210,254,245,240,186,28,
+93,252,113,1,77,1,124,179,142,98,133,253,158,0,0,2,0,80,255,232,6,249,4,138,
+0,46,0,47,0,0,1,23,6,6,21,20,22,51,50,62,2,53,17,51,17,20,30,2,51,50,54,54,
+53,16,39,55,22,18,21,20,2,6,35,34,38,39,6,6,35,34,38,2,53,52,18,5,1,141,110,
+126,121,178,139,72,100,69,26,177,18,60,106,78,89,148,85,245,122,162,141,125,
+232,153,115,167,60,63,172,123,148,224,123,152,1,173,4,137,126,90,242,160,
+183,236,44,96,126,151,2,81,253,175,118,131,105,63,104,196,120,1,58,174,130,
+130,254,215,191,164,254,253,145,90,95,98,87,143,1,5,163,192,1,40,41,0,0,2,
+0,80,255,239,6,249,4,138,0,45,0,46,0,0,5,39,54,54,53,52,38,35,34,14,2,21,
+17,35,17,52,46,2,35,34,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,54,54,51,
+50,22,18,21,20,2,37,5,188,110,125,122,177,140,72,101,70,24,177,18,59,107,
+78,139,183,245,117,162,146,128,232,150,113,168,61,61,172,125,148,225,122,
+151,252,59,17,126,88,242,159,181,235,45,99,130,143,253,171,2,85,116,132,106,
+63,237,180,254,195,168,129,128,1,39,191,166,1,3,140,88,97,95,90,143,254,252,
+161,190,254,217,31,0,0,3,0,85,255,232,7,220,4,138,0,50,0,61,0,62,0,0,33,35,
+17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,
+23,54,54,51,50,22,18,21,20,2,7,39,54,54,53,52,38,35,34,14,2,21,5,22,22,51,
+50,54,53,52,38,35,34,1,4,224,177,80,148,112,185,255,32,118,130,152,182,189,
+161,119,187,100,162,1,43,188,138,206,84,60,171,124,148,225,122,151,166,110,
+125,122,177,140,72,101,70,24,252,28,5,128,110,79,96,104,88,116,4,83,2,115,
+165,151,72,226,195,78,179,156,166,195,121,235,162,201,1,47,164,84,96,92,88,
+143,254,252,161,190,254,217,130,126,88,242,159,181,235,45,99,130,143,161,
+151,166,106,97,97,110,254,127,0,2,0,65,255,242,6,154,4,138,0,28,0,29,0,0,
+33,33,39,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,
+7,33,17,51,37,6,154,252,6,59,89,121,111,104,128,120,93,99,101,224,181,120,
+184,100,63,2,188,179,253,28,107,83,133,113,128,131,98,150,80,119,68,180,105,
+163,206,91,166,97,131,79,3,222,28,0,2,0,65,255,242,8,134,4,138,0,36,0,47,
+0,0,33,33,39,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,
+20,7,33,17,52,62,2,51,50,22,22,21,7,52,38,38,35,34,6,6,21,17,33,8,134,250,
+26,59,89,121,111,104,128,120,93,99,101,224,181,120,184,100,63,1,105,63,132,
+186,117,172,232,108,177,58,156,117,115,149,61,2,144,107,83,133,113,128,131,
+98,150,80,119,68,180,105,163,206,91,166,97,131,79,1,225,148,187,132,70,130,
+222,185,67,162,192,102,101,184,155,254,82,0,0,2,0,85,255,232,9,225,4,138,
+0,55,0,66,0,0,1,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,50,22,23,54,54,51,50,22,18,21,20,6,7,33,17,51,17,33,39,54,54,53,
+52,38,35,34,14,2,21,17,35,1,22,22,51,50,54,53,52,38,35,34,4,47,80,148,112,
+185,255,32,118,130,152,182,189,161,119,187,100,162,1,43,188,137,206,85,63,
+163,129,148,225,122,71,90,1,243,179,252,176,74,133,92,178,139,80,104,64,19,
+177,252,205,5,128,110,79,96,104,88,116,2,115,165,151,72,226,195,78,179,156,
+166,195,121,235,162,201,1,47,164,83,97,91,89,143,254,252,161,125,218,111,
+3,222,251,146,111,127,224,136,182,235,55,104,137,122,253,171,1,180,151,166,
+106,97,97,110,0,0,2,0,110,255,232,4,249,4,138,0,58,0,59,0,0,1,34,6,21,20,
+22,51,51,50,22,21,20,6,35,34,38,39,55,22,51,50,53,52,38,35,35,34,38,53,52,
+54,54,51,51,50,54,53,52,38,35,34,0,17,20,23,7,38,38,53,16,0,33,50,22,21,20,
+6,6,35,1,3,154,129,81,81,120,25,179,156,190,172,101,218,71,63,154,170,196,
+71,100,30,207,152,66,154,143,84,66,43,151,141,250,254,245,51,168,29,35,1,
+109,1,79,211,252,68,115,109,253,226,2,127,40,47,44,39,119,118,121,135,43,
+32,140,70,106,51,48,116,107,68,98,66,39,46,73,75,254,213,254,242,240,186,
+28,93,252,113,1,79,1,122,157,135,81,105,45,253,129,0,3,0,125,0,0,5,80,4,138,
+0,10,0,21,0,34,0,0,33,33,17,52,18,36,51,50,4,18,21,1,51,54,18,53,52,38,35,
+34,6,17,33,52,38,39,22,22,21,20,2,7,54,51,33,5,80,251,45,125,1,11,210,193,
+1,26,158,251,222,10,229,251,83,79,140,188,3,113,152,132,38,31,195,210,89,
+87,1,188,2,37,202,1,2,153,125,254,254,234,254,106,172,1,101,155,91,101,246,
+254,252,248,214,34,47,95,59,156,254,192,190,6,0,5,0,80,255,232,7,243,4,138,
+0,37,0,49,0,65,0,66,0,67,0,0,1,54,54,51,50,18,21,20,2,7,22,51,50,0,53,52,
+38,39,55,22,18,21,20,2,4,35,34,39,6,35,34,36,2,53,52,18,51,50,1,54,18,53,
+52,38,35,34,6,21,20,18,3,38,35,34,6,21,20,18,22,51,50,55,38,2,53,52,1,21,
+3,34,59,137,78,198,232,140,128,56,59,236,1,11,76,74,142,92,95,165,254,202,
+206,159,126,132,167,206,254,200,172,243,201,165,1,121,120,140,135,115,119,
+140,133,250,68,105,124,144,127,239,159,69,50,133,132,3,155,4,43,47,48,254,
+252,223,168,254,221,95,10,1,30,238,116,221,89,97,108,254,245,144,199,254,
+206,162,54,54,173,1,70,211,216,1,4,252,37,69,1,14,165,163,176,180,159,156,
+254,237,2,184,74,179,158,156,254,250,148,9,105,1,28,179,141,1,45,144,0,4,
+0,80,255,232,5,147,4,138,0,30,0,44,0,45,0,46,0,0,1,38,38,35,34,4,21,16,23,
+7,38,2,53,52,18,36,51,50,4,18,21,20,2,35,34,38,53,52,54,51,50,19,38,38,35,
+34,6,21,20,22,51,50,54,53,52,1,21,4,201,50,253,176,226,254,254,249,101,157,
+173,155,1,46,208,209,1,51,166,229,205,182,216,210,175,138,136,47,123,69,120,
+127,115,110,134,130,253,80,2,220,133,149,242,213,254,216,152,129,89,1,49,
+191,169,1,19,151,157,254,207,205,252,254,245,240,186,193,232,254,246,60,63,
+145,133,140,146,193,195,16,254,132,144,0,0,3,0,80,255,238,5,21,4,138,0,28,
+0,29,0,30,0,0,37,54,54,53,52,38,35,34,6,6,21,20,22,23,7,38,2,53,52,18,36,
+51,50,4,18,21,20,2,7,37,21,3,102,120,129,229,198,129,196,105,124,125,101,
+157,173,153,1,24,185,185,1,17,145,165,165,254,210,111,73,228,142,209,251,
+116,210,129,148,224,76,128,88,1,49,191,174,1,19,146,144,254,242,173,192,254,
+215,104,162,144,0,2,0,130,0,0,6,78,4,138,0,15,0,24,0,0,1,17,33,17,51,17,33,
+17,52,54,54,51,50,22,21,21,37,33,53,52,38,35,34,6,21,1,51,4,106,177,250,52,
+118,219,157,246,246,252,215,2,120,149,168,166,149,1,198,254,202,3,222,251,
+146,2,129,193,217,111,252,251,205,144,57,192,171,172,188,0,0,3,0,81,253,78,
+5,112,4,138,0,68,0,79,0,80,0,0,1,54,51,50,22,21,20,6,35,34,38,53,52,54,36,
+51,32,4,21,20,6,7,22,22,21,20,14,2,35,33,34,6,6,21,20,22,51,33,21,33,34,38,
+53,52,54,54,51,33,50,54,54,53,52,38,35,35,53,51,50,62,2,53,52,38,35,34,4,
+3,22,22,51,50,54,53,52,38,35,34,1,1,14,97,103,143,162,183,161,161,189,172,
+1,67,215,1,18,1,48,94,93,105,105,50,109,135,106,254,55,116,96,45,108,144,
+3,57,252,192,219,203,65,165,156,1,200,101,105,66,128,117,62,13,84,90,66,31,
+213,197,182,254,248,101,2,97,95,83,93,87,80,111,1,139,3,26,58,165,134,140,
+177,212,189,146,242,137,179,159,88,129,40,34,132,99,61,122,85,34,28,57,41,
+72,66,148,148,124,79,124,81,26,73,72,81,94,144,23,50,66,43,95,107,114,254,
+228,122,122,97,79,78,87,250,129,0,4,0,75,255,232,4,241,4,138,0,41,0,55,0,
+56,0,57,0,0,1,22,21,20,6,35,34,39,55,22,51,50,54,53,52,39,35,32,0,53,52,55,
+23,6,6,21,20,22,23,38,39,38,38,53,52,54,51,50,22,21,20,2,39,54,54,53,52,38,
+35,34,6,21,20,22,23,22,1,7,3,116,7,169,164,186,143,64,125,136,83,84,3,42,
+254,226,254,197,111,137,37,34,214,205,20,23,43,46,195,169,171,191,204,225,
+118,134,97,92,89,99,44,39,22,254,127,2,1,72,40,37,129,146,80,136,70,61,75,
+22,28,1,19,239,174,166,76,66,115,69,185,199,3,42,41,76,141,79,149,185,205,
+155,169,254,252,91,34,188,128,96,110,104,91,71,135,72,41,2,116,143,0,1,0,
+80,255,238,7,26,4,138,0,33,0,0,37,54,54,53,52,38,35,34,6,6,21,20,22,23,7,
+38,2,53,52,18,36,51,50,4,18,21,20,6,7,33,17,51,17,33,3,119,116,116,230,199,
+127,196,105,124,125,101,157,173,153,1,24,185,185,1,17,145,76,87,1,245,179,
+252,163,121,79,217,137,210,250,115,211,129,148,224,76,129,89,1,49,191,174,
+1,19,146,144,254,242,173,121,207,103,3,223,251,145,0,0,4,0,80,255,232,8,2,
+4,138,0,46,0,60,0,61,0,62,0,0,1,38,38,35,34,6,17,21,20,14,2,35,34,0,17,52,
+18,55,23,6,17,20,22,51,50,54,53,53,52,54,36,51,50,4,18,21,20,2,35,34,38,53,
+52,54,51,50,19,38,38,35,34,6,21,20,22,51,50,54,53,52,1,21,7,60,49,240,151,
+203,201,51,117,160,111,227,254,250,153,164,110,247,167,134,141,126,116,1,
+0,201,198,1,38,157,227,207,182,216,210,175,140,134,47,123,69,120,127,115,
+110,134,130,251,61,2,216,130,156,215,254,252,35,152,181,131,63,1,43,1,6,197,
+1,42,129,127,177,254,197,189,229,165,253,30,196,244,149,162,254,208,201,253,
+254,246,240,186,193,232,254,246,60,63,145,133,140,146,193,195,16,2,98,144,
+0,3,0,65,255,242,8,161,4,138,0,42,0,53,0,61,0,0,1,54,54,55,51,17,33,39,54,
+53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,7,33,17,38,38,
+53,52,54,51,50,22,22,21,7,53,52,38,38,35,34,6,21,20,22,1,6,4,7,17,33,17,52,
+5,245,148,247,115,174,249,255,59,89,121,111,104,128,120,93,99,101,224,181,
+120,184,100,63,2,25,223,240,177,146,113,144,60,177,24,72,52,64,74,145,3,64,
+72,254,239,169,1,251,2,124,33,234,231,251,146,107,83,133,113,128,131,98,150,
+80,119,68,180,105,163,206,91,166,97,131,79,1,81,4,204,164,128,181,90,148,
+134,168,158,89,96,53,85,77,113,121,1,10,162,212,25,254,167,2,107,77,0,4,0,
+80,255,232,9,121,4,138,0,61,0,62,0,63,0,64,0,0,1,20,22,22,51,50,54,53,52,
+38,39,55,22,18,21,16,0,35,34,46,2,53,53,52,38,38,35,34,6,6,21,17,35,17,52,
+38,38,35,34,6,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,54,51,50,22,22,21,
+19,21,1,6,142,39,120,100,138,170,125,120,122,162,141,254,240,229,106,166,
+111,42,45,107,87,83,114,42,177,40,125,97,89,147,86,245,117,162,146,126,232,
+152,111,166,67,113,237,125,174,95,183,251,88,2,40,160,171,97,227,193,153,
+250,85,130,130,254,216,192,254,250,254,206,66,135,190,165,73,174,155,81,89,
+156,137,253,135,2,85,155,159,104,104,195,119,254,197,170,130,128,1,39,192,
+162,1,4,143,86,101,187,111,206,225,2,2,144,252,178,0,0,1,0,65,255,238,9,53,
+4,138,0,53,0,0,37,54,54,53,52,38,35,34,6,6,21,20,22,23,7,33,39,54,53,52,38,
+35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,7,33,38,53,52,18,36,51,
+50,4,18,21,20,2,7,7,134,120,129,229,198,129,196,105,114,118,77,252,223,59,
+89,121,111,104,128,120,93,99,101,224,181,120,184,100,63,1,231,162,154,1,24,
+184,185,1,17,145,165,165,111,73,228,142,209,251,116,210,129,146,213,80,120,
+107,83,133,113,128,131,98,150,80,119,68,180,105,163,206,91,166,97,131,79,
+186,245,170,1,16,145,144,254,242,173,192,254,215,104,0,3,0,44,254,99,6,13,
+4,120,0,10,0,11,0,12,0,0,33,33,39,1,23,1,33,21,33,17,35,19,21,3,27,253,106,
+89,1,139,164,254,150,5,28,253,193,179,144,100,4,20,50,252,74,144,254,99,6,
+12,144,0,0,5,255,77,253,78,4,109,6,190,0,31,0,32,0,33,0,34,0,35,0,0,37,16,
+6,35,34,38,39,55,22,22,51,50,54,54,53,17,52,62,2,51,50,22,23,7,38,38,35,34,
+6,6,21,3,9,2,2,56,194,195,136,183,39,179,27,86,69,70,90,44,32,94,153,110,
+135,184,39,179,30,86,66,73,93,38,246,1,152,254,68,1,233,10,254,245,243,153,
+148,33,99,91,71,136,148,4,61,151,173,136,79,153,148,33,105,85,78,148,158,
+249,7,9,112,249,66,4,111,0,0,1,0,34,255,232,3,180,4,138,0,24,0,0,19,55,18,
+51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,18,17,16,2,35,34,38,34,178,65,
+195,146,150,147,139,97,136,29,177,53,230,167,221,234,242,233,169,229,1,91,
+33,254,252,230,219,216,233,140,120,34,182,188,254,197,254,236,254,223,254,
+206,197,0,0,2,254,80,0,0,1,66,6,191,0,21,0,22,0,0,1,38,53,52,54,51,50,22,
+22,21,17,35,17,52,38,38,35,34,6,21,20,23,23,254,92,12,202,160,153,178,61,
+177,36,95,79,83,107,8,208,5,2,55,43,159,188,140,213,212,251,118,4,87,194,
+187,91,103,92,37,38,179,0,3,253,180,0,0,1,66,6,190,0,21,0,33,0,34,0,0,33,
+35,17,52,38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,1,35,38,6,21,
+20,22,51,50,54,53,52,19,1,66,177,27,90,72,30,150,142,120,162,198,166,190,
+245,111,253,235,14,88,115,69,62,67,73,118,4,52,153,184,129,27,46,77,124,138,
+146,120,123,153,125,242,249,1,230,3,82,71,57,68,75,61,80,254,109,0,5,255,
+203,253,78,2,175,4,138,0,28,0,40,0,41,0,42,0,43,0,0,55,54,18,53,52,38,35,
+34,7,39,54,51,50,22,21,20,2,7,22,22,21,20,6,35,34,38,53,52,54,19,20,22,51,
+50,54,53,52,38,35,34,6,55,19,3,255,55,46,81,82,61,62,35,83,95,159,164,55,
+55,124,137,205,165,168,202,165,3,111,91,90,112,109,94,91,110,201,6,22,243,
+195,1,7,108,104,101,16,141,23,177,165,112,254,219,181,31,183,129,160,197,
+196,161,139,192,254,179,101,118,117,104,102,118,117,253,252,87,2,178,0,6,
+255,203,253,78,2,175,4,138,0,28,0,42,0,58,0,59,0,60,0,61,0,0,55,54,18,53,
+52,38,35,34,7,39,54,51,50,22,21,20,2,7,22,22,21,20,6,35,34,38,53,52,54,23,
+6,21,20,22,51,50,54,53,52,39,38,35,34,7,6,21,20,22,51,50,54,53,52,39,6,6,
+35,34,38,19,19,3,255,55,46,81,82,61,62,35,83,95,159,164,55,55,124,137,206,
+165,168,201,166,86,14,68,64,58,70,20,49,62,64,160,9,131,103,104,130,8,21,
+115,90,89,117,207,6,22,243,195,1,7,108,104,101,16,141,23,177,165,112,254,
+219,181,31,183,129,160,197,197,160,140,193,132,25,25,49,55,57,47,28,25,21,
+153,33,41,103,121,122,104,37,32,78,82,83,1,108,252,87,2,178,0,0,4,254,217,
+253,78,1,230,4,110,0,29,0,40,0,41,0,42,0,0,5,38,38,39,38,38,53,52,18,55,51,
+6,6,21,20,22,23,22,22,21,20,6,35,34,38,53,52,54,51,50,23,38,35,34,6,21,20,
+22,51,50,54,3,3,1,47,12,43,51,67,38,78,74,187,82,77,34,63,75,42,235,187,159,
+200,187,152,142,127,117,141,84,95,99,91,108,128,180,22,134,63,126,126,164,
+188,81,119,1,17,128,137,238,135,81,171,155,186,198,83,189,208,164,137,130,
+156,236,93,79,72,72,78,106,254,220,2,178,0,3,253,227,253,78,1,230,4,110,0,
+62,0,63,0,64,0,0,7,54,54,51,50,22,21,21,35,53,52,38,35,34,6,6,21,21,35,53,
+52,38,35,34,6,21,20,22,51,50,54,53,52,38,38,39,46,2,53,52,18,55,51,6,6,21,
+20,22,23,22,22,21,20,4,35,34,36,53,52,54,51,50,1,3,124,30,83,60,104,107,140,
+43,43,31,41,18,140,42,47,45,51,166,178,167,178,20,39,54,42,39,22,78,74,187,
+82,77,32,66,66,50,254,227,239,247,255,0,134,109,120,1,44,22,166,49,43,124,
+111,51,21,78,54,27,50,52,24,22,74,57,59,54,92,92,127,119,65,116,120,143,108,
+123,129,68,119,1,17,128,137,238,135,71,172,164,162,210,95,190,207,171,161,
+106,135,253,152,2,178,0,0,4,0,80,255,232,5,105,4,138,0,31,0,42,0,43,0,44,
+0,0,37,54,54,53,52,38,35,34,4,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,
+36,51,32,0,17,20,2,7,1,22,22,51,50,54,53,52,38,35,34,1,21,3,186,120,129,241,
+205,184,254,239,40,115,127,152,182,189,161,118,188,100,174,1,60,196,1,36,
+1,71,165,165,252,216,5,128,111,79,95,105,87,117,2,21,111,73,228,142,212,248,
+226,190,74,179,156,166,195,121,227,152,203,1,56,171,254,193,254,244,192,254,
+215,104,1,199,154,164,109,95,96,110,254,127,144,0,0,3,0,80,255,232,4,120,
+4,138,0,35,0,47,0,59,0,0,1,6,6,21,20,22,23,38,53,52,54,51,50,22,21,20,6,35,
+34,36,2,53,52,18,36,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,54,
+53,52,38,35,3,23,22,54,53,52,38,35,34,6,21,20,2,89,163,176,172,153,31,149,
+139,125,163,202,185,194,254,205,164,166,1,55,193,189,205,161,121,143,151,
+197,52,74,66,63,68,106,82,44,13,91,116,68,63,66,74,3,247,37,229,175,168,241,
+38,59,73,121,143,145,122,130,150,144,1,14,186,177,1,8,145,150,130,121,146,
+143,127,67,80,58,83,59,83,71,58,73,81,252,99,1,3,80,77,58,71,83,59,82,255,
+255,0,80,255,232,11,39,4,138,0,35,0,66,5,190,0,0,0,2,0,66,0,0,255,255,0,80,
+255,232,11,22,4,138,0,34,0,66,0,0,0,39,1,5,5,130,1,244,0,3,0,59,7,98,0,0,
+255,255,0,80,255,232,10,2,4,138,0,34,0,67,0,0,0,39,1,5,4,110,1,244,0,3,0,
+59,6,78,0,0,255,255,0,80,255,232,13,41,4,138,0,34,0,66,0,0,0,39,1,5,5,130,
+1,244,0,3,0,74,7,102,0,0,0,3,253,170,4,110,0,144,6,191,0,21,0,22,0,23,0,0,
+1,23,6,21,20,22,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,52,37,19,253,
+190,152,12,108,103,103,108,12,152,20,198,173,173,198,1,102,31,6,139,28,45,
+55,98,99,99,98,55,45,28,71,64,152,177,177,152,71,116,253,175,0,3,3,9,4,110,
+3,219,6,191,0,3,0,4,0,5,0,0,1,3,35,3,55,19,3,219,19,172,19,113,31,6,121,254,
+139,1,117,70,253,175,0,1,0,73,255,232,5,195,4,138,0,47,0,0,19,38,38,53,52,
+54,51,50,23,54,54,51,50,18,21,16,0,33,34,38,39,55,22,22,51,50,54,53,52,38,
+35,34,14,2,21,21,35,53,52,38,38,35,34,6,21,20,23,115,20,22,208,182,185,105,
+56,148,98,193,227,254,220,254,245,136,211,111,89,84,170,105,193,196,126,113,
+67,84,47,14,174,38,97,69,101,115,30,2,9,56,139,59,172,215,156,82,74,254,220,
+246,254,200,254,176,48,57,141,51,47,246,255,187,202,45,76,105,91,169,154,
+132,126,75,138,115,111,97,0,6,0,75,253,78,6,173,4,138,0,48,0,59,0,71,0,84,
+0,117,0,118,0,0,37,38,2,53,52,54,51,50,22,21,20,6,35,34,39,30,2,51,51,50,
+54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,7,22,22,21,20,4,33,32,36,53,
+52,54,1,38,38,35,34,6,21,20,22,51,50,37,22,22,51,50,54,53,52,38,35,34,6,1,
+35,32,4,21,20,4,33,32,36,53,52,36,1,53,52,38,35,34,6,21,21,35,53,52,54,51,
+50,22,23,54,54,51,50,22,21,21,35,53,52,38,35,34,6,21,21,3,1,147,143,185,206,
+178,163,187,172,150,140,99,40,149,225,198,50,194,235,153,44,102,137,153,169,
+196,169,170,199,190,148,135,135,254,146,254,137,254,115,254,152,130,4,252,
+5,110,99,92,103,95,88,137,251,54,47,110,70,88,95,100,86,105,116,2,145,16,
+254,222,254,246,1,18,1,46,1,35,1,17,255,0,254,128,48,42,44,42,140,107,104,
+61,84,30,30,84,61,104,107,140,38,48,44,46,140,229,55,1,13,182,197,230,189,
+148,138,174,71,92,126,46,42,117,105,71,177,140,146,186,227,193,193,254,243,
+48,41,144,104,196,183,182,203,98,140,2,49,136,136,103,86,81,92,97,51,46,92,
+81,84,105,138,253,66,115,120,133,108,113,125,121,117,254,141,26,72,55,55,
+76,22,51,111,124,44,48,48,44,124,111,51,20,74,59,55,71,27,254,13,0,0,4,0,
+85,253,78,10,85,4,138,0,72,0,85,0,96,0,97,0,0,1,38,38,35,34,6,6,21,17,35,
+17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,
+23,54,54,51,50,4,23,22,18,21,16,0,33,34,39,55,22,51,50,54,53,52,38,39,22,
+21,20,6,35,34,38,38,53,52,36,33,50,23,38,35,34,6,21,20,22,51,50,54,53,52,
+5,22,22,51,50,54,53,52,38,35,34,1,7,246,58,209,152,112,179,80,177,80,148,
+112,185,255,32,118,130,152,182,189,161,119,187,100,162,1,43,188,139,212,86,
+82,223,142,227,1,58,68,198,220,254,176,254,207,183,160,57,122,169,227,234,
+103,102,7,228,208,118,174,92,1,23,1,2,25,72,41,50,184,183,112,103,126,133,
+248,198,5,128,110,79,96,104,88,116,3,192,3,12,117,117,92,171,161,253,178,
+2,115,165,151,72,226,195,78,179,156,166,195,121,235,162,201,1,47,164,87,104,
+95,96,212,199,58,254,210,205,254,229,254,197,60,143,53,233,217,136,196,59,
+59,62,233,249,97,176,102,204,226,148,7,145,144,103,130,177,166,92,117,151,
+166,106,97,97,110,251,61,255,255,249,137,253,78,255,187,4,110,0,3,0,232,249,
+117,0,0,255,255,249,137,252,240,0,164,4,110,0,3,0,233,249,117,0,0,0,4,0,80,
+0,0,4,75,4,110,0,13,0,25,0,26,0,27,0,0,19,52,54,54,51,50,0,21,20,6,6,35,34,
+0,55,20,22,51,50,54,53,52,38,35,34,6,1,17,80,129,232,147,229,1,26,128,234,
+148,231,254,234,180,182,147,150,180,178,153,150,178,1,74,2,67,143,223,122,
+254,245,221,145,224,121,1,13,218,159,181,182,161,161,180,180,1,138,251,146,
+0,0,3,0,23,253,78,6,169,4,138,0,29,0,40,0,41,0,0,33,33,34,6,6,21,20,22,51,
+33,21,33,34,38,53,52,54,54,51,33,17,52,62,2,51,50,22,22,21,7,52,38,38,35,
+34,6,6,21,17,33,1,6,169,251,32,116,96,45,108,144,1,92,254,157,220,202,65,
+165,156,1,30,63,132,186,117,172,232,108,177,58,156,117,115,149,61,2,144,253,
+62,28,57,41,72,66,148,148,124,79,124,81,1,225,148,187,132,70,130,222,185,
+67,162,192,102,101,184,155,254,82,252,190,0,1,0,80,255,238,6,188,4,138,0,
+31,0,0,37,54,54,53,52,38,35,34,6,6,21,20,22,23,7,38,2,53,52,18,36,51,50,4,
+18,21,20,6,7,33,21,33,3,123,130,98,230,199,127,196,105,124,125,101,157,173,
+153,1,24,185,185,1,17,145,76,87,2,74,253,8,111,114,206,123,210,250,115,211,
+129,148,224,76,129,89,1,49,191,174,1,19,146,144,254,242,173,121,207,103,144,
+0,0,1,0,80,255,239,8,136,4,138,0,49,0,0,1,54,54,51,50,22,18,21,20,6,7,33,
+21,33,39,54,54,53,52,38,35,34,14,2,21,17,35,17,52,46,2,35,34,6,21,20,22,23,
+7,38,2,53,52,18,54,51,50,22,3,163,68,169,122,148,225,122,71,90,2,48,253,38,
+74,133,92,178,139,80,104,64,19,177,18,59,107,78,139,183,126,119,117,162,146,
+128,232,150,113,168,3,211,96,87,143,254,252,161,125,218,111,144,111,127,224,
+136,182,235,55,104,137,122,253,171,2,85,116,132,106,63,237,180,159,249,77,
+129,128,1,39,191,166,1,3,140,89,0,0,5,0,80,255,232,6,86,6,190,0,42,0,53,0,
+54,0,55,0,56,0,0,1,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,18,55,38,38,
+35,34,6,21,20,22,23,7,38,2,53,52,18,36,51,50,22,23,54,54,53,52,39,3,6,6,21,
+20,22,51,32,17,52,38,1,3,39,6,21,65,143,194,81,81,231,212,192,223,196,238,
+61,141,80,224,255,124,125,101,157,173,162,1,40,199,126,217,91,163,108,51,
+250,203,169,126,112,1,2,64,254,133,240,3,5,215,92,120,106,159,102,96,228,
+131,231,254,219,180,169,1,7,135,37,37,251,206,148,224,76,129,89,1,49,191,
+177,1,17,145,70,69,86,100,63,69,77,253,188,119,208,136,124,131,1,85,105,198,
+3,194,249,66,144,0,0,5,0,90,253,78,7,107,6,191,0,65,0,66,0,67,0,68,0,69,0,
+0,5,39,54,17,52,2,36,35,34,4,2,21,20,18,4,51,50,54,53,52,38,35,35,53,51,50,
+54,53,52,38,35,34,6,21,16,23,7,2,17,16,0,51,50,22,21,20,6,7,22,17,20,0,33,
+34,36,2,17,16,18,36,33,32,4,18,17,16,1,17,53,3,6,218,158,121,165,254,193,
+224,226,254,179,178,138,1,9,188,207,222,176,154,26,53,147,134,123,119,169,
+178,175,151,203,1,25,246,198,220,105,112,239,254,192,254,226,234,254,161,
+188,228,1,168,1,17,1,24,1,141,207,252,155,8,24,84,200,1,34,236,1,99,188,195,
+254,146,249,219,254,176,177,177,161,141,174,144,99,93,90,98,213,193,254,230,
+195,98,1,16,1,45,1,2,1,42,175,146,102,135,50,115,254,253,236,254,253,213,
+1,144,1,14,1,43,1,179,228,218,254,89,254,219,254,190,5,223,249,65,144,252,
+190,0,0,3,0,80,253,78,9,111,4,138,0,66,0,67,0,68,0,0,1,54,54,51,50,18,17,
+16,0,33,34,39,55,22,51,32,0,17,16,2,35,34,14,2,21,17,35,17,52,38,38,35,34,
+6,6,21,17,35,17,52,46,2,35,34,6,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,
+54,54,51,50,22,1,1,6,45,62,161,124,235,252,254,146,254,139,143,104,20,82,
+140,1,28,1,22,162,146,65,93,68,28,177,51,111,90,78,112,61,177,27,68,94,60,
+85,141,79,245,117,162,146,121,223,146,108,160,63,58,174,109,117,169,254,6,
+254,120,3,209,95,90,254,158,254,174,254,64,254,78,21,147,18,1,91,1,123,1,
+12,1,26,40,91,129,157,253,171,2,140,146,142,75,71,145,166,253,135,2,85,148,
+131,94,45,107,194,117,254,197,170,130,128,1,39,192,161,1,5,143,88,98,92,94,
+93,249,33,3,66,0,4,0,80,253,78,5,152,4,138,0,34,0,45,0,46,0,47,0,0,1,55,22,
+51,32,0,17,16,0,35,34,4,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,0,
+17,16,0,33,34,1,22,22,51,50,54,53,52,38,35,34,1,3,1,151,20,83,143,1,41,1,
+44,254,254,231,187,254,234,38,116,128,152,182,189,161,180,226,171,1,61,198,
+1,65,1,89,254,112,254,138,145,254,246,8,130,105,78,97,104,88,117,2,134,11,
+254,121,147,18,1,94,1,88,1,19,1,51,228,189,75,179,156,166,195,1,12,240,197,
+1,53,172,254,124,254,165,254,111,254,74,3,81,153,165,107,92,99,112,251,61,
+2,178,0,2,0,80,253,78,7,26,4,138,0,45,0,46,0,0,37,54,54,53,52,38,35,34,6,
+6,21,20,22,23,7,38,2,53,52,18,36,51,50,4,18,21,20,6,7,33,17,51,17,20,2,4,
+35,34,39,55,22,51,50,54,55,33,19,3,123,130,98,230,199,127,196,105,124,125,
+101,157,173,153,1,24,185,185,1,17,145,76,87,1,245,179,166,254,214,217,132,
+96,20,75,126,202,243,42,253,115,38,111,114,206,123,210,250,115,211,129,148,
+224,76,129,89,1,49,191,174,1,19,146,144,254,242,173,121,207,103,3,223,252,
+110,246,254,247,122,21,147,18,131,131,253,78,0,4,0,80,255,232,8,240,6,190,
+0,60,0,71,0,72,0,73,0,0,1,38,38,35,34,6,6,21,17,35,17,52,46,2,35,34,6,21,
+20,22,23,7,38,2,53,52,18,54,51,50,22,23,54,54,51,50,22,23,54,54,53,52,39,
+55,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,18,37,6,6,21,20,22,51,32,17,
+52,38,1,3,6,154,62,141,80,146,168,72,177,18,59,107,78,139,183,126,119,117,
+162,146,128,232,150,119,178,60,72,226,154,128,219,91,163,108,51,166,65,143,
+194,81,81,231,212,192,223,196,1,100,203,169,126,112,1,2,64,251,235,163,3,
+175,37,37,109,181,182,253,223,2,85,116,132,106,63,237,180,159,249,77,129,
+128,1,39,191,166,1,3,140,102,101,101,102,70,69,86,100,63,69,77,77,92,120,
+106,159,102,96,228,131,231,254,219,180,169,1,8,30,119,208,136,124,131,1,85,
+105,198,3,194,249,210,0,0,4,255,185,253,78,8,93,4,138,0,51,0,52,0,53,0,54,
+0,0,1,17,20,22,22,51,50,54,54,53,17,51,17,20,30,2,51,50,54,53,16,39,55,22,
+18,21,20,2,6,35,34,38,39,6,6,35,34,39,6,4,35,34,39,55,22,51,50,54,54,53,17,
+5,1,1,2,155,56,118,93,87,120,59,177,17,60,108,77,139,183,245,122,161,142,
+127,232,151,111,168,65,61,181,112,176,102,23,254,242,250,104,79,15,57,98,
+131,172,87,4,48,253,209,1,3,4,111,253,119,149,142,72,78,143,161,2,117,253,
+175,113,133,108,64,239,179,1,61,174,130,130,254,213,192,163,254,252,142,87,
+100,93,94,109,253,244,21,147,18,92,182,196,3,159,145,249,112,2,178,0,3,0,
+80,253,78,6,199,4,138,0,49,0,50,0,51,0,0,1,54,54,51,50,0,17,16,0,33,34,39,
+55,22,51,32,0,17,16,2,35,34,14,2,21,17,35,17,52,46,2,35,34,6,6,21,16,23,7,
+38,2,53,52,18,54,51,50,22,3,3,3,133,63,160,124,231,1,0,254,144,254,141,143,
+104,20,82,140,1,28,1,22,164,144,65,93,68,28,177,27,68,94,60,85,141,79,245,
+117,162,146,121,223,146,106,160,134,33,3,208,97,89,254,146,254,175,254,70,
+254,83,21,147,18,1,87,1,107,1,19,1,39,40,91,129,157,253,171,2,85,148,131,
+94,45,107,194,117,254,197,170,130,128,1,39,192,161,1,5,143,86,249,26,3,66,
+0,0,4,0,80,255,232,11,33,4,138,0,65,0,78,0,90,0,91,0,0,33,35,17,52,46,2,35,
+34,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,54,54,51,50,4,23,51,38,53,52,
+54,51,50,22,21,20,14,2,35,33,22,21,20,2,35,34,38,53,52,62,2,51,51,38,38,35,
+34,6,6,21,37,51,50,54,54,53,52,38,35,34,6,21,20,5,35,34,14,2,21,20,51,50,
+54,53,1,3,253,177,18,59,107,78,139,183,245,117,162,146,128,232,150,117,172,
+62,83,214,145,238,1,59,48,197,29,198,156,164,179,54,110,146,122,254,94,1,
+228,208,178,192,85,156,189,153,29,42,220,171,119,162,71,5,47,61,91,111,62,
+87,78,90,95,254,15,35,125,137,104,55,200,131,125,251,123,2,85,116,132,106,
+63,237,180,254,195,168,129,128,1,39,191,166,1,3,140,93,98,98,93,254,236,77,
+80,138,167,162,132,77,118,79,38,17,16,252,254,245,182,153,96,146,90,29,166,
+176,92,171,154,75,27,77,57,73,86,100,90,72,202,16,50,83,60,201,190,197,254,
+151,0,0,3,0,80,255,232,6,25,4,138,0,24,0,35,0,36,0,0,1,21,33,34,14,2,7,54,
+51,50,22,21,20,6,35,34,38,53,52,62,3,51,1,20,22,51,50,54,53,52,38,35,34,19,
+6,25,253,201,211,233,160,107,23,115,122,152,182,189,161,178,223,74,143,199,
+237,189,253,87,131,114,79,95,105,87,116,82,4,38,151,27,71,124,87,70,179,156,
+166,195,248,220,143,210,144,89,32,253,142,149,168,109,95,96,110,2,121,0,0,
+4,0,80,255,232,7,13,6,190,0,36,0,47,0,58,0,59,0,0,1,51,17,4,0,17,20,6,35,
+34,38,38,53,17,38,35,32,4,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,
+50,23,23,17,20,22,22,51,50,54,53,52,2,1,22,22,51,50,54,53,52,38,35,34,1,3,
+229,177,1,48,1,71,215,195,132,181,85,39,40,254,239,254,167,42,116,128,152,
+182,189,161,117,188,101,202,1,126,254,40,39,177,43,104,74,112,116,235,251,
+139,6,130,108,79,95,105,87,117,1,118,6,87,254,34,58,254,138,254,230,214,241,
+111,187,178,2,48,2,218,199,75,179,156,166,195,122,227,151,213,1,55,162,2,
+167,254,16,170,133,74,156,151,213,1,45,254,7,155,162,109,95,96,110,4,173,
+0,4,0,85,255,232,9,211,6,190,0,64,0,75,0,86,0,87,0,0,1,38,38,35,34,6,6,21,
+17,35,17,52,38,38,35,34,4,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,
+50,22,23,54,54,51,50,22,23,54,54,53,52,39,55,22,21,20,6,7,22,22,21,20,6,35,
+34,38,53,52,18,37,6,6,21,20,22,51,32,17,52,38,1,22,22,51,50,54,53,52,38,35,
+34,1,7,125,62,141,80,146,168,72,177,80,148,112,185,255,0,31,116,132,152,182,
+189,161,119,187,100,162,1,43,188,143,212,88,74,224,151,128,219,91,163,108,
+51,166,65,143,194,81,81,231,212,192,223,196,1,100,203,169,126,112,1,2,64,
+248,205,6,129,109,79,96,104,88,116,3,0,3,175,37,37,109,181,182,253,223,2,
+115,165,151,72,227,194,78,179,156,166,195,121,235,162,201,1,47,164,91,108,
+99,100,70,69,86,100,63,69,77,77,92,120,106,159,102,96,228,131,231,254,219,
+180,169,1,8,30,119,208,136,124,131,1,85,105,198,254,184,153,164,106,97,97,
+110,4,173,0,3,0,80,255,232,9,0,4,138,0,53,0,65,0,66,0,0,33,35,17,52,46,2,
+35,34,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,54,54,51,50,4,23,33,21,33,
+22,21,20,2,35,34,38,53,52,62,2,51,51,38,38,35,34,6,6,21,5,35,34,14,2,21,20,
+51,50,54,53,1,3,253,177,18,59,107,78,139,183,245,117,162,146,128,232,150,
+117,172,62,83,214,145,238,1,59,48,1,64,254,207,1,228,208,178,192,85,156,189,
+153,29,42,220,171,119,162,71,3,37,35,125,137,104,55,200,131,125,251,98,2,
+85,116,132,106,63,237,180,254,195,168,129,128,1,39,191,166,1,3,140,93,98,
+98,93,254,236,144,17,16,252,254,245,182,153,96,146,90,29,166,176,92,171,154,
+69,16,50,83,60,201,190,197,254,151,0,0,4,0,85,255,232,11,214,6,190,0,85,0,
+97,0,108,0,109,0,0,33,35,17,52,38,38,35,34,4,7,54,51,50,22,21,20,6,35,34,
+38,38,53,52,18,36,51,50,22,23,54,54,51,50,22,23,54,54,51,50,23,54,54,53,52,
+38,35,34,7,39,54,51,50,22,21,20,6,7,22,18,21,20,6,35,34,38,53,52,18,55,38,
+35,34,6,6,21,17,35,17,52,38,38,35,34,6,6,21,1,6,6,21,20,22,51,50,54,53,52,
+2,1,22,22,51,50,54,53,52,38,35,34,1,4,224,177,80,148,112,185,255,0,31,116,
+132,152,182,189,161,119,187,100,162,1,43,188,136,206,85,65,177,112,129,175,
+64,74,226,153,136,120,64,52,83,76,81,72,40,108,112,151,160,77,85,144,161,
+215,198,195,211,133,134,60,70,152,168,70,177,56,118,93,86,119,61,5,94,113,
+118,117,111,112,117,118,246,81,6,129,109,79,96,104,88,116,3,0,2,115,165,151,
+72,227,194,78,179,156,166,195,121,235,162,201,1,47,164,82,98,90,90,97,107,
+102,102,46,64,101,52,64,78,22,140,30,152,102,86,152,85,99,254,192,174,227,
+250,243,226,149,1,21,129,17,111,181,180,253,223,2,140,149,142,72,75,145,162,
+1,44,101,251,141,159,161,161,159,150,1,10,254,92,153,164,106,97,97,110,4,
+173,0,4,0,80,255,232,8,45,6,191,0,65,0,77,0,78,0,79,0,0,1,54,54,51,50,23,
+54,54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,6,7,22,18,21,20,6,35,34,38,
+53,52,18,55,38,35,34,6,6,21,17,35,17,52,46,2,35,34,6,21,20,22,23,7,38,2,53,
+52,18,54,51,50,22,5,6,6,21,20,22,51,50,54,53,52,2,1,1,3,179,72,226,154,136,
+120,64,52,83,76,81,72,40,108,112,99,139,73,77,85,144,161,215,198,195,211,
+133,134,60,70,152,168,70,177,18,59,107,78,139,183,126,119,117,162,146,128,
+232,150,119,178,3,30,113,118,117,111,112,117,118,252,241,254,156,3,191,101,
+102,46,64,101,52,64,78,22,140,30,68,121,65,86,152,85,99,254,192,174,227,250,
+243,226,149,1,21,129,17,111,181,180,253,223,2,85,116,132,106,63,237,180,159,
+249,77,129,128,1,39,191,166,1,3,140,102,127,101,251,141,159,161,161,159,150,
+1,10,3,103,249,209,0,5,0,80,255,232,5,147,6,191,0,47,0,59,0,60,0,61,0,62,
+0,0,1,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,6,21,20,22,23,7,38,2,53,
+52,18,36,51,50,23,54,54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,6,7,6,6,
+21,20,22,51,50,54,53,52,2,1,7,19,4,97,145,161,215,198,195,211,128,134,68,
+82,211,247,124,125,101,157,173,159,1,33,191,144,124,59,59,83,76,81,72,40,
+108,112,99,139,73,75,195,113,113,117,111,112,117,121,253,238,10,26,4,21,99,
+254,195,176,227,250,243,226,148,1,15,132,20,254,203,148,224,76,129,89,1,49,
+191,175,1,19,145,49,56,110,54,64,78,22,140,30,68,121,65,84,152,204,105,244,
+140,159,161,161,159,150,1,6,253,60,144,6,191,0,6,0,80,255,232,9,70,6,190,
+0,68,0,78,0,90,0,91,0,92,0,93,0,0,1,22,18,21,20,6,35,34,38,53,52,18,55,38,
+35,34,6,6,21,16,23,7,38,2,53,52,18,36,51,50,23,54,54,51,50,23,54,54,53,52,
+38,35,34,7,39,54,51,50,22,22,21,20,6,7,22,18,21,20,6,35,34,38,53,52,18,55,
+38,35,34,5,4,17,20,22,51,50,17,52,38,37,6,6,21,20,22,51,50,54,53,52,38,1,
+7,19,4,182,120,130,219,198,196,222,146,144,76,99,143,215,116,249,101,157,
+173,160,1,32,190,185,156,87,210,141,252,161,78,64,83,76,81,72,40,108,112,
+99,139,73,84,99,160,166,215,198,195,211,120,121,133,168,156,254,233,254,253,
+121,117,237,113,3,12,106,102,117,111,112,117,125,250,63,10,26,3,208,97,254,
+237,156,223,249,250,222,171,1,23,99,24,112,213,137,254,216,152,129,89,1,49,
+191,176,1,18,145,81,40,41,71,72,113,57,64,78,22,140,30,68,121,65,88,161,95,
+94,254,217,183,227,250,243,226,143,1,9,122,39,97,146,254,194,166,167,1,77,
+135,248,76,104,240,128,159,161,161,159,158,240,253,74,144,6,190,0,5,0,80,
+255,232,8,11,6,190,0,63,0,75,0,76,0,77,0,78,0,0,1,54,54,53,52,38,35,34,7,
+39,54,51,50,22,22,21,20,6,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,6,
+17,21,20,6,6,35,34,0,17,52,18,55,23,6,6,21,20,22,51,50,54,54,53,53,52,54,
+54,51,50,23,6,6,21,20,22,51,50,54,53,52,2,1,19,21,6,89,58,54,83,76,81,72,
+40,108,112,99,139,73,73,86,144,158,215,198,195,211,134,135,60,60,174,207,
+122,185,132,225,254,248,155,162,110,126,121,167,134,97,117,54,126,252,179,
+125,143,117,117,117,111,112,117,118,251,131,51,4,95,58,103,53,64,78,22,140,
+30,68,121,65,82,151,87,101,254,190,175,225,250,243,226,149,1,23,130,15,208,
+254,241,41,219,211,91,1,49,1,8,192,1,41,127,127,90,242,160,189,229,75,164,
+164,45,205,247,137,226,106,248,142,159,161,161,159,154,1,8,3,100,253,176,
+144,0,0,6,0,65,255,232,9,101,6,190,0,55,0,62,0,69,0,83,0,94,0,95,0,0,37,6,
+6,35,34,38,53,52,62,2,55,54,18,51,50,22,23,51,54,55,54,54,53,52,38,35,34,
+7,39,54,51,50,22,21,20,6,7,6,7,22,22,21,20,6,35,34,38,53,52,55,35,2,2,35,
+34,3,33,38,38,35,34,6,1,33,22,22,51,50,54,37,6,21,20,22,51,50,54,53,52,46,
+2,35,1,38,38,39,6,6,21,20,22,51,50,1,3,5,82,157,91,181,197,64,119,173,169,
+25,254,198,203,247,24,243,53,64,108,67,82,77,81,72,40,108,112,151,160,79,
+142,47,27,224,221,187,171,170,198,39,173,12,251,213,176,127,2,86,16,149,132,
+134,151,2,74,253,162,6,151,145,146,150,2,22,40,103,89,89,93,47,89,112,77,
+251,52,41,44,4,177,167,107,100,120,1,185,72,51,45,176,159,79,132,90,53,6,
+233,1,2,253,237,100,110,190,170,75,76,82,22,140,30,155,120,111,198,238,80,
+50,6,190,152,164,183,188,154,113,97,254,245,254,227,2,184,173,173,173,254,
+195,204,204,203,205,105,92,102,109,97,96,58,83,55,19,254,169,68,171,103,2,
+105,102,96,102,6,70,0,0,1,255,202,254,173,0,54,6,77,0,3,0,0,3,17,51,17,54,
+108,254,173,7,160,248,96,0,1,254,213,254,174,1,43,6,77,0,14,0,0,19,23,7,39,
+17,35,17,7,39,55,39,55,23,55,23,74,225,75,170,108,170,75,225,225,75,224,224,
+75,5,43,220,73,169,249,255,6,1,169,73,220,217,73,220,220,74,0,0,10,0,145,
+0,0,4,15,4,110,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,64,0,65,0,0,1,34,
+53,52,51,50,21,20,5,34,53,52,51,50,21,20,33,34,53,52,51,50,21,20,19,34,53,
+52,51,50,21,20,33,34,53,52,51,50,21,20,19,34,53,52,51,50,21,20,33,34,53,52,
+51,50,21,20,5,34,53,52,51,50,21,20,3,19,2,79,64,64,66,254,166,64,64,65,1,
+240,64,64,65,36,65,65,66,252,195,65,65,65,36,64,64,65,1,240,64,64,65,254,
+166,64,64,66,30,5,3,87,65,64,64,65,112,65,64,64,65,65,64,64,65,254,242,65,
+65,65,65,65,65,65,65,254,243,65,64,64,65,65,64,64,65,113,65,65,65,65,4,19,
+251,146,255,255,0,65,255,232,8,221,6,191,2,38,0,20,0,0,0,3,0,72,8,77,0,0,
+255,255,0,80,255,232,8,143,6,191,2,38,0,21,0,0,0,3,0,72,7,255,0,0,255,255,
+0,80,255,233,7,189,6,191,2,38,0,22,0,0,0,3,0,72,7,45,0,0,255,255,0,65,0,0,
+11,42,6,191,2,38,0,23,0,0,0,3,0,72,10,154,0,0,255,255,0,85,255,232,9,15,6,
+191,2,38,0,24,0,0,0,3,0,72,8,127,0,0,255,255,0,35,0,0,8,7,6,191,2,38,0,25,
+0,0,0,3,0,72,7,119,0,0,255,255,0,35,255,232,11,90,6,191,2,38,0,26,0,0,0,3,
+0,72,10,202,0,0,255,255,0,75,255,232,8,19,6,191,2,38,0,27,0,0,0,3,0,72,7,
+131,0,0,255,255,0,80,255,232,13,205,6,191,2,38,0,28,0,0,0,3,0,72,13,61,0,
+0,255,255,0,85,255,232,12,33,6,191,2,38,0,29,0,0,0,3,0,72,11,145,0,0,255,
+255,0,41,255,232,5,16,6,191,2,38,0,30,0,0,0,3,0,72,4,128,0,0,255,255,0,80,
+255,232,5,206,6,191,2,38,0,31,0,0,0,3,0,72,5,62,0,0,255,255,0,80,255,232,
+10,89,6,191,2,38,0,32,0,0,0,3,0,72,9,201,0,0,255,255,0,80,255,232,11,60,6,
+191,2,38,0,33,0,0,0,3,0,72,10,172,0,0,255,255,0,85,255,232,11,130,6,191,2,
+38,0,34,0,0,0,3,0,72,10,242,0,0,255,255,0,80,255,232,8,173,6,191,2,38,0,35,
+0,0,0,3,0,72,8,29,0,0,255,255,0,145,0,0,7,187,6,191,2,38,0,36,0,0,0,3,0,72,
+7,43,0,0,255,255,0,110,255,233,5,174,6,191,2,38,0,37,0,0,0,3,0,72,5,30,0,
+0,255,255,0,80,255,232,7,217,6,191,2,38,0,38,0,0,0,3,0,72,7,73,0,0,255,255,
+0,80,255,239,7,217,6,191,2,38,0,39,0,0,0,3,0,72,7,73,0,0,255,255,0,65,255,
+242,7,187,6,191,2,38,0,41,0,0,0,3,0,72,7,43,0,0,255,255,0,65,255,242,9,152,
+6,191,2,38,0,42,0,0,0,3,0,72,9,8,0,0,255,255,0,85,255,232,11,2,6,191,2,38,
+0,43,0,0,0,3,0,72,10,114,0,0,255,255,0,110,255,232,5,207,6,191,2,38,0,44,
+0,0,0,3,0,72,5,63,0,0,255,255,0,125,0,0,6,93,6,191,2,38,0,45,0,0,0,3,0,72,
+5,205,0,0,255,255,0,80,255,232,8,216,6,191,2,38,0,46,0,0,0,3,0,72,8,72,0,
+0,255,255,0,80,255,232,6,115,6,191,2,38,0,47,0,0,0,3,0,72,5,227,0,0,255,255,
+0,80,255,238,5,245,6,191,2,38,0,48,0,0,0,3,0,72,5,101,0,0,255,255,0,130,0,
+0,7,111,6,191,2,38,0,49,0,0,0,3,0,72,6,223,0,0,255,255,0,81,253,78,6,74,6,
+191,2,38,0,50,0,0,0,3,0,72,5,186,0,0,255,255,0,75,255,232,5,204,6,191,2,38,
+0,51,0,0,0,3,0,72,5,60,0,0,255,255,0,80,255,238,8,59,6,191,2,38,0,52,0,0,
+0,3,0,72,7,171,0,0,255,255,0,80,255,232,8,226,6,191,2,38,0,53,0,0,0,3,0,72,
+8,82,0,0,255,255,0,65,255,242,9,194,6,191,2,38,0,54,0,0,0,3,0,72,9,50,0,0,
+255,255,0,80,255,232,10,89,6,191,2,38,0,55,0,0,0,3,0,72,9,201,0,0,255,255,
+0,65,255,238,10,21,6,191,2,38,0,56,0,0,0,3,0,72,9,133,0,0,255,255,0,65,255,
+232,14,34,6,191,2,38,0,151,0,0,0,3,0,72,13,146,0,0,0,4,250,87,253,78,255,
+157,0,144,0,42,0,52,0,53,0,54,0,0,5,54,51,50,22,21,20,6,35,34,38,53,52,54,
+51,50,22,22,21,21,20,22,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,53,52,
+38,35,34,6,7,22,22,51,50,53,52,38,35,34,1,53,250,245,87,85,117,134,150,133,
+138,160,247,192,145,175,90,89,80,84,87,157,119,199,174,153,163,173,122,129,
+106,148,35,3,81,70,135,71,60,80,2,129,224,51,141,116,120,140,196,169,189,
+239,90,170,140,13,143,100,107,104,195,160,86,193,244,159,193,184,183,9,158,
+132,105,222,106,112,140,62,72,1,39,144,0,0,3,254,217,253,78,1,226,4,110,0,
+36,0,37,0,38,0,0,7,6,21,20,22,51,50,54,53,52,38,39,38,38,53,52,18,55,51,6,
+6,21,20,22,23,30,2,21,20,6,35,34,38,53,52,55,1,3,109,6,106,101,106,106,41,
+66,62,43,78,74,187,82,77,36,61,49,40,24,208,182,179,208,6,1,175,22,137,30,
+33,102,107,108,107,70,144,161,150,194,89,119,1,17,128,137,238,135,79,176,
+152,123,117,120,54,169,187,193,161,38,39,253,200,2,178,0,0,3,254,133,253,
+78,1,66,4,110,0,5,0,6,0,7,0,0,1,17,33,53,33,17,3,3,1,66,253,67,2,12,3,22,
+4,110,250,76,146,5,34,248,224,2,178,0,0,3,0,90,253,78,2,189,4,110,0,16,0,
+17,0,18,0,0,1,2,17,20,22,51,50,55,23,6,35,34,2,53,52,18,19,19,3,2,3,246,134,
+156,56,68,18,80,101,212,218,114,124,114,22,4,110,253,237,254,53,195,178,11,
+149,12,1,7,255,221,1,229,1,33,248,224,2,178,0,7,0,65,255,232,11,189,4,138,
+0,54,0,61,0,68,0,80,0,91,0,92,0,93,0,0,37,6,6,35,34,38,53,52,62,2,55,54,18,
+51,50,22,23,51,54,36,51,32,0,17,16,5,39,54,54,53,52,38,35,34,6,7,51,50,22,
+22,21,20,6,35,34,38,53,52,55,35,2,2,35,34,3,33,38,38,35,34,6,1,33,22,22,51,
+50,54,37,6,21,16,51,50,54,53,52,38,38,35,1,38,38,39,6,6,21,20,22,51,50,37,
+21,3,8,85,156,92,181,197,66,129,174,161,24,255,198,202,248,24,184,63,1,92,
+245,1,36,1,71,254,182,101,120,129,241,205,161,254,58,64,171,205,112,190,168,
+185,213,5,155,11,251,214,180,122,2,86,17,149,132,135,150,2,74,253,163,6,150,
+145,145,152,1,251,7,235,89,95,71,136,140,251,21,40,44,4,183,166,107,100,123,
+7,165,74,53,45,176,159,80,135,92,48,5,233,1,2,253,237,235,255,254,193,254,
+244,254,128,209,129,73,228,142,212,248,181,161,74,161,128,155,178,231,211,
+56,54,254,246,254,226,2,184,173,173,173,254,195,204,204,204,204,50,56,254,
+201,100,93,86,94,44,254,172,67,170,102,2,105,102,96,102,24,144,0,6,0,65,255,
+232,14,43,4,138,0,77,0,84,0,95,0,102,0,113,0,114,0,0,1,52,46,2,35,35,2,2,
+35,34,39,6,6,35,34,38,53,52,62,2,55,54,18,51,50,22,23,51,50,23,62,2,51,50,
+22,23,54,54,51,50,4,18,21,16,5,39,54,54,53,52,38,38,35,34,7,22,18,21,20,6,
+35,34,38,53,52,18,55,38,35,34,6,6,21,17,35,1,33,38,38,35,34,6,37,6,2,21,20,
+22,51,50,17,52,2,1,33,22,22,51,50,54,5,38,38,39,6,6,21,20,22,51,50,37,7,25,
+18,46,71,73,60,12,251,213,180,118,79,159,94,181,197,72,141,172,144,25,254,
+198,203,247,24,101,111,60,3,114,246,185,92,149,76,77,159,101,187,1,19,146,
+254,182,101,123,126,108,202,136,113,71,131,140,219,198,197,221,150,144,64,
+92,157,163,75,177,251,233,2,86,16,149,132,134,151,7,101,115,133,121,117,237,
+119,250,121,253,162,6,151,145,146,150,253,82,41,44,3,184,164,107,100,121,
+10,9,1,77,43,78,50,24,254,245,254,227,98,50,48,176,159,84,140,92,39,5,233,
+1,2,253,237,53,181,225,137,31,36,34,33,145,254,243,173,254,128,209,129,75,
+225,143,135,216,116,20,99,254,226,168,223,249,250,222,170,1,29,99,19,109,
+174,190,253,220,2,160,173,173,173,92,73,255,0,155,166,167,1,77,151,1,3,254,
+177,204,204,203,136,69,170,101,3,105,101,96,102,24,0,6,0,65,253,78,8,12,4,
+138,0,59,0,66,0,73,0,84,0,99,0,100,0,0,37,6,6,35,34,38,53,52,62,2,55,54,18,
+51,50,22,23,4,22,21,20,6,7,7,38,35,34,6,21,20,22,51,51,50,22,21,20,6,35,34,
+38,39,55,22,51,50,53,52,38,35,35,34,38,53,52,55,6,35,34,3,33,38,38,35,34,
+6,1,33,22,22,51,50,54,5,38,38,39,6,6,21,20,22,51,50,37,55,22,51,50,54,53,
+52,38,39,2,7,54,51,50,5,3,8,85,156,92,181,197,66,129,174,161,24,255,198,203,
+247,25,1,12,245,72,72,64,155,191,114,116,106,119,64,179,163,200,185,126,203,
+97,64,161,198,229,102,101,51,211,167,27,34,35,180,122,2,86,17,149,132,135,
+150,2,74,253,163,6,150,145,145,152,253,81,40,44,4,183,166,107,100,123,3,193,
+4,66,74,103,103,160,173,12,126,39,43,19,1,247,74,53,45,176,159,80,135,92,
+48,5,233,1,2,253,238,5,188,167,100,140,39,115,83,55,50,56,42,120,120,115,
+132,46,51,130,89,108,57,49,116,111,49,43,5,2,184,173,173,173,254,195,204,
+204,204,136,67,170,102,2,105,102,96,102,5,14,19,94,95,104,108,6,254,240,134,
+5,126,0,8,0,65,253,78,8,12,4,138,0,54,0,59,0,66,0,77,0,104,0,114,0,115,0,
+116,0,0,5,54,51,50,22,21,20,6,35,34,38,53,52,54,55,38,39,6,6,35,34,38,53,
+52,62,2,55,54,18,51,50,22,23,4,22,21,20,6,7,22,21,20,6,35,34,38,38,53,53,
+52,38,35,34,6,3,33,2,33,32,1,33,22,22,51,50,54,5,38,38,39,6,6,21,20,22,51,
+50,5,6,35,34,39,55,22,51,50,53,52,38,39,2,7,22,22,21,21,20,22,22,51,50,54,
+53,52,5,22,22,51,50,53,52,38,35,34,1,5,2,242,87,87,117,134,151,134,137,159,
+113,108,16,24,84,159,93,181,197,74,146,173,137,25,254,198,204,247,23,1,11,
+247,69,68,127,204,177,132,157,65,129,134,117,158,6,2,86,32,254,247,254,244,
+2,57,253,162,6,151,145,146,150,253,81,40,44,3,185,164,107,100,121,4,172,23,
+40,125,81,40,72,68,206,162,171,14,222,73,90,30,90,72,101,120,251,135,2,81,
+71,135,71,60,82,2,126,250,247,226,53,141,116,120,140,197,168,126,194,54,9,
+18,53,47,176,159,85,141,93,37,4,233,1,2,255,236,4,188,168,97,140,44,141,193,
+176,210,100,158,118,2,164,138,114,3,28,1,90,254,22,204,204,203,136,67,170,
+103,3,105,101,96,102,140,4,25,138,19,189,105,107,5,254,153,120,39,158,147,
+8,83,103,62,128,112,175,213,105,113,140,62,72,1,166,127,0,6,0,65,255,232,
+13,1,4,138,0,50,0,57,0,68,0,76,0,83,0,94,0,0,37,6,6,35,34,38,53,52,62,2,55,
+54,18,51,50,22,23,4,22,21,20,7,33,17,38,38,53,52,54,51,50,22,22,21,21,54,
+54,55,51,17,33,39,54,53,52,5,2,2,35,34,3,33,38,38,35,34,6,5,53,52,38,38,35,
+34,6,21,20,22,1,6,4,7,17,33,17,52,1,33,22,22,51,50,54,5,38,38,39,6,6,21,20,
+22,51,50,3,8,85,156,92,181,197,66,129,174,161,24,255,198,203,247,25,1,12,
+235,76,1,238,223,240,177,146,113,144,60,148,247,115,174,249,183,35,188,254,
+189,11,251,214,180,122,2,86,17,149,132,135,150,6,145,24,72,52,64,74,145,3,
+64,72,254,239,169,1,251,249,13,253,163,6,150,145,145,152,253,81,40,44,4,183,
+166,107,100,123,74,53,45,176,159,80,135,92,48,5,233,1,2,254,236,3,181,160,
+106,78,1,81,4,204,164,128,181,90,148,134,154,33,234,231,251,146,138,22,163,
+207,2,254,246,254,226,2,184,173,173,173,223,158,89,96,53,85,77,113,121,1,
+10,162,212,25,254,167,2,107,77,254,200,204,204,204,136,67,170,102,2,105,102,
+96,102,0,6,0,80,253,78,6,221,4,138,0,52,0,82,0,83,0,84,0,85,0,86,0,0,1,52,
+54,54,51,50,0,21,20,2,7,22,22,21,20,6,7,39,54,53,52,38,35,34,6,21,21,20,6,
+6,35,34,38,53,52,55,38,2,53,52,18,55,23,6,17,20,22,51,50,62,2,53,19,52,54,
+54,51,50,23,54,54,53,52,38,35,34,6,6,21,21,20,6,6,7,6,21,20,22,51,50,54,53,
+1,37,1,21,3,60,88,190,167,219,1,9,102,113,73,79,100,111,103,154,118,101,93,
+100,87,161,108,176,202,89,189,208,153,164,110,247,165,136,89,101,57,20,132,
+91,160,115,19,20,106,106,167,140,106,122,34,70,148,112,130,120,100,90,102,
+254,121,2,34,254,58,2,129,194,202,125,254,204,254,157,255,0,113,52,172,112,
+125,208,95,105,130,204,116,136,105,145,13,178,166,84,210,176,163,125,31,1,
+36,231,197,1,42,129,127,177,254,197,190,228,56,103,169,161,252,127,177,163,
+81,2,87,229,142,189,231,110,193,195,18,170,193,129,20,119,180,112,128,103,
+150,1,21,24,4,109,144,0,0,3,0,80,255,233,7,41,4,138,0,62,0,63,0,64,0,0,1,
+23,6,17,20,22,51,50,54,54,53,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,6,
+35,34,39,55,22,51,50,54,53,52,38,38,35,35,53,51,50,54,53,52,38,35,34,6,6,
+21,21,20,6,6,35,34,0,17,52,18,37,21,1,141,110,247,165,136,112,116,39,115,
+241,195,204,228,95,100,106,111,193,173,98,104,37,81,64,107,102,64,115,123,
+54,53,147,134,130,123,126,168,79,122,185,132,227,254,250,153,1,172,4,138,
+127,177,254,197,191,227,95,177,183,13,185,241,143,176,145,98,133,43,37,144,
+94,149,166,23,141,20,86,88,59,88,48,144,99,93,91,97,100,197,178,41,219,211,
+91,1,43,1,6,197,1,42,101,144,0,0,5,0,80,255,233,10,191,4,138,0,46,0,57,0,
+70,0,71,0,72,0,0,33,33,17,52,38,38,35,34,6,6,21,21,20,6,6,35,34,0,17,52,18,
+55,23,6,17,20,22,51,50,54,54,53,53,52,54,54,51,50,22,23,54,54,51,50,4,18,
+21,1,51,54,18,53,52,38,35,34,6,17,33,52,38,39,22,22,21,20,2,7,54,51,33,1,
+21,10,191,251,45,47,110,91,105,119,36,122,185,132,227,254,250,153,164,110,
+247,165,136,115,116,36,106,188,149,121,184,54,74,244,170,193,1,26,158,251,
+222,10,229,251,83,79,140,188,3,113,152,132,38,31,195,210,89,87,1,188,248,
+135,2,140,137,145,80,107,190,201,18,219,211,91,1,43,1,6,197,1,42,129,127,
+177,254,197,191,227,101,185,203,27,211,204,106,115,110,112,113,125,254,254,
+234,254,106,172,1,101,155,91,101,246,254,252,248,214,34,47,95,59,156,254,
+192,190,6,3,222,144,0,4,0,80,255,233,9,153,4,138,0,61,0,62,0,63,0,64,0,0,
+1,52,54,54,51,50,22,23,54,54,51,50,22,18,21,20,2,7,39,54,54,53,52,38,35,34,
+14,2,21,17,35,17,52,38,38,35,34,6,6,21,21,20,6,6,35,34,0,17,52,18,55,23,6,
+17,20,22,51,50,54,54,53,1,1,21,3,60,106,188,149,110,167,58,60,171,125,149,
+225,121,151,166,110,125,122,177,140,72,101,70,24,177,47,110,91,105,119,36,
+122,185,132,227,254,250,153,164,110,247,165,136,115,116,36,4,17,251,72,2,
+129,211,204,106,91,91,93,89,144,254,253,161,190,254,217,130,126,88,242,159,
+181,235,45,99,130,143,253,171,2,140,137,145,80,107,190,201,18,219,211,91,
+1,43,1,6,197,1,42,129,127,177,254,197,191,227,101,185,203,254,42,3,222,144,
+0,9,0,80,253,78,6,221,4,137,0,58,0,86,0,96,0,97,0,98,0,99,0,100,0,101,0,102,
+0,0,1,52,54,54,51,50,0,21,20,6,7,22,22,21,20,6,35,34,38,38,53,53,52,38,35,
+34,6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,55,38,2,53,52,18,55,23,6,17,
+20,22,51,50,62,2,53,1,21,39,54,17,52,38,35,34,6,6,21,21,20,6,7,22,22,21,21,
+20,22,22,51,50,54,53,52,5,22,22,51,50,53,52,38,35,34,19,37,23,1,21,1,3,60,
+88,190,167,219,1,9,97,110,88,89,204,177,133,157,64,126,147,107,154,25,84,
+88,117,134,151,134,137,159,74,66,160,175,153,164,110,247,165,136,89,101,57,
+20,2,100,110,247,167,140,106,122,34,56,63,122,143,30,90,72,101,120,251,135,
+2,81,71,135,71,60,82,31,2,68,60,253,220,2,41,2,128,194,202,125,254,204,254,
+153,253,112,80,192,113,175,211,101,158,117,2,166,146,118,107,52,141,116,120,
+140,197,168,101,173,61,45,1,17,209,197,1,42,129,127,177,254,197,190,228,56,
+103,169,161,253,138,1,126,177,1,52,189,231,110,193,195,18,139,184,64,28,192,
+187,7,84,103,62,128,112,174,212,105,113,140,62,72,1,16,160,137,4,110,144,
+252,178,0,5,0,74,255,232,8,56,4,138,0,44,0,51,0,64,0,71,0,84,0,0,37,6,6,35,
+34,38,53,52,55,38,53,52,54,51,50,22,23,54,54,51,50,22,23,4,22,21,20,6,35,
+34,39,55,22,51,50,54,53,52,38,39,2,2,35,34,38,3,33,38,38,35,34,6,7,54,54,
+55,38,38,35,34,6,21,20,22,51,5,33,22,22,51,50,54,5,38,38,39,14,3,21,20,22,
+51,50,3,51,81,167,102,189,206,228,218,202,164,98,162,89,63,159,95,203,247,
+25,1,12,245,200,172,111,80,40,72,53,107,114,160,173,12,251,213,91,149,62,
+2,86,17,149,132,135,150,192,7,35,27,66,120,68,90,107,132,190,3,70,253,163,
+6,150,145,145,152,253,80,40,43,4,126,133,87,38,115,107,133,75,49,50,175,160,
+194,88,75,197,128,169,56,67,61,62,253,238,5,188,167,156,179,25,138,19,98,
+91,104,108,6,254,245,254,228,49,2,135,173,173,173,173,68,120,52,57,49,89,
+72,89,96,144,204,204,204,135,67,170,102,3,27,59,72,49,96,102,0,0,3,0,80,255,
+232,11,238,4,138,0,93,0,112,0,123,0,0,33,35,17,52,38,38,35,34,7,22,22,21,
+20,6,7,22,22,21,20,6,35,34,2,53,52,18,55,38,35,32,4,7,54,51,50,22,21,20,6,
+35,34,2,53,16,0,33,50,22,23,54,51,50,22,23,54,54,51,50,22,21,20,6,7,22,22,
+21,20,6,35,34,39,55,22,51,50,54,53,52,38,38,35,35,53,51,50,54,53,52,38,35,
+34,6,6,21,1,6,2,21,20,22,51,50,53,52,38,35,35,53,51,50,53,52,38,1,22,22,51,
+50,54,53,52,38,35,34,8,212,177,66,167,162,43,39,96,96,84,85,92,99,201,185,
+218,246,129,129,104,139,254,215,254,135,50,116,127,152,180,189,161,180,226,
+1,226,1,162,131,197,94,140,171,153,226,85,74,222,147,189,223,97,98,106,111,
+193,173,98,104,37,81,64,107,102,64,115,123,54,53,151,130,128,117,130,161,
+59,252,186,136,144,155,141,210,124,117,39,29,229,102,251,3,6,133,105,80,94,
+101,89,119,2,65,164,174,108,4,42,133,90,83,109,38,32,128,85,138,165,1,20,
+229,164,1,7,98,12,219,200,73,179,156,166,195,1,12,240,1,68,1,98,28,29,57,
+99,112,105,106,181,141,98,134,42,37,144,94,149,166,23,141,20,86,88,59,88,
+48,144,101,91,92,101,114,165,154,1,128,67,254,243,144,180,196,170,79,84,144,
+165,77,107,254,10,151,167,108,96,95,111,0,0,3,0,35,253,78,6,230,4,110,0,34,
+0,41,0,42,0,0,1,39,1,54,55,6,35,33,53,33,54,53,52,38,35,34,6,21,20,23,7,38,
+53,52,54,51,50,22,21,20,7,33,17,51,17,39,17,35,1,23,54,51,1,2,214,77,1,137,
+81,122,82,134,252,30,3,34,94,110,102,100,113,5,170,11,217,177,179,200,81,
+2,53,179,179,111,253,184,1,90,172,254,229,253,215,141,1,29,58,73,4,144,87,
+130,113,129,119,106,51,28,23,60,62,158,191,204,164,134,101,3,222,249,105,
+141,1,156,254,96,4,8,254,234,0,2,0,35,253,78,7,22,4,110,0,85,0,97,0,0,33,
+34,39,22,22,21,20,6,35,34,38,53,52,54,51,50,23,38,38,35,34,6,21,20,22,23,
+7,33,53,33,54,53,52,38,35,34,6,21,20,7,7,38,53,52,54,51,50,22,21,20,7,33,
+38,53,52,54,55,6,35,33,53,33,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,22,21,20,7,33,17,51,3,38,35,34,6,21,20,22,51,50,54,53,6,230,53,47,74,74,
+169,145,129,155,144,121,96,70,31,162,113,147,172,59,88,62,251,213,1,229,60,
+68,58,54,56,2,137,7,146,122,122,135,49,1,33,102,65,65,63,85,252,211,3,34,
+94,110,102,100,113,5,170,11,217,177,179,200,81,2,53,179,100,59,87,77,82,72,
+69,84,80,3,62,172,111,167,181,159,120,126,153,62,93,101,153,134,78,127,80,
+118,137,44,80,59,68,60,52,23,15,15,39,37,97,117,127,98,87,64,129,158,77,141,
+52,4,144,87,130,113,129,119,106,51,28,23,60,62,158,191,204,164,134,101,3,
+222,250,76,69,79,72,77,80,114,119,0,0,5,0,75,255,196,14,214,4,138,0,143,0,
+156,0,169,0,182,0,197,0,0,1,38,53,52,54,54,51,50,22,23,54,54,51,50,22,22,
+21,20,6,7,22,21,20,6,35,34,38,39,6,4,35,34,38,53,52,54,54,51,33,50,54,54,
+53,52,38,35,34,6,6,21,21,35,53,52,46,2,35,34,7,54,51,50,22,21,20,6,35,34,
+39,6,0,4,33,32,38,53,52,54,54,51,33,50,54,54,53,52,38,35,34,6,6,21,21,35,
+53,52,46,2,35,34,7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,
+54,51,50,22,22,21,20,6,4,35,33,34,6,6,21,20,22,51,51,32,36,0,1,6,21,20,22,
+51,50,54,53,52,38,35,34,5,6,21,20,22,51,50,54,53,52,38,35,34,1,6,21,20,22,
+51,50,54,53,52,38,35,34,7,6,35,33,34,6,6,21,20,51,50,54,54,55,54,7,255,2,
+125,244,165,140,194,80,67,184,118,133,198,105,94,101,140,157,143,142,162,
+4,126,254,64,198,148,162,53,157,160,2,193,183,196,115,145,135,100,121,40,
+169,35,89,127,106,170,95,51,50,127,138,161,139,155,82,141,254,104,253,239,
+254,91,254,211,244,53,157,160,2,213,189,195,110,145,135,100,121,40,169,35,
+89,127,106,170,95,51,50,127,138,161,139,146,165,125,244,165,140,194,80,67,
+184,118,133,198,105,155,254,239,227,253,77,96,103,51,140,233,15,1,146,1,207,
+1,115,1,77,13,84,81,72,75,76,78,74,248,19,13,84,81,72,75,76,78,74,11,156,
+9,85,78,71,76,82,70,80,238,109,152,254,128,107,94,49,151,74,174,154,212,64,
+2,229,19,21,105,174,102,78,87,82,83,102,183,105,119,154,53,56,154,124,136,
+139,123,86,176,130,125,56,107,83,47,125,116,107,147,81,132,123,152,130,100,
+128,94,42,56,15,131,104,113,145,85,226,254,222,120,145,146,56,107,83,49,126,
+113,107,147,81,132,123,152,130,100,128,94,42,56,15,131,104,113,145,154,136,
+105,174,102,78,87,82,83,102,183,105,154,200,81,17,51,36,70,71,108,1,1,1,134,
+35,32,82,84,74,64,62,69,36,35,32,82,84,74,64,62,69,253,209,36,37,72,76,72,
+60,66,69,15,15,19,51,42,112,37,59,92,28,0,0,5,0,75,255,196,18,170,4,138,0,
+144,0,155,0,168,0,179,0,180,0,0,1,53,52,18,36,51,50,22,23,54,54,51,50,23,
+54,51,50,4,18,21,16,5,39,54,54,53,52,38,38,35,34,7,22,18,21,20,6,35,34,38,
+53,52,18,55,38,35,34,6,6,21,17,35,17,52,38,38,35,34,6,7,54,51,50,22,21,20,
+6,35,34,38,39,6,4,4,33,32,38,53,52,54,54,51,33,50,54,54,53,52,38,35,34,6,
+6,21,21,35,53,52,46,2,35,34,7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,
+50,22,23,54,54,51,50,22,22,21,20,6,4,35,33,34,6,6,21,20,22,51,51,32,36,36,
+1,6,2,21,20,22,51,50,17,52,2,5,6,21,20,22,51,50,54,53,52,38,35,34,1,22,22,
+51,50,54,53,52,38,35,34,1,7,190,162,1,43,188,148,209,86,72,221,149,180,137,
+146,191,186,1,19,147,254,182,101,123,126,108,202,136,108,75,129,141,219,198,
+197,221,151,143,65,91,157,163,75,177,80,148,112,185,255,32,118,130,152,182,
+189,161,143,205,37,120,254,142,254,16,254,115,254,211,244,53,157,160,2,213,
+183,196,115,145,135,100,121,40,169,35,89,127,106,170,95,51,50,127,138,161,
+139,146,165,125,244,165,140,194,80,67,184,118,133,198,105,155,254,239,227,
+253,77,97,103,50,146,227,15,1,144,1,223,1,78,7,193,115,133,121,117,237,119,
+241,145,13,84,81,72,75,76,78,74,7,43,5,128,110,79,96,104,88,116,7,218,1,221,
+17,201,1,47,164,93,106,99,100,66,66,145,254,243,173,254,128,209,129,75,225,
+143,135,216,116,20,98,254,225,168,223,249,250,222,171,1,28,99,19,109,174,
+190,253,220,2,115,165,151,72,226,195,78,179,156,166,195,169,158,115,171,77,
+145,146,56,107,83,47,125,116,107,147,81,132,123,152,130,100,128,94,42,56,
+15,131,104,113,145,154,136,105,174,102,78,87,82,83,102,183,105,154,200,81,
+18,48,36,73,70,81,173,2,79,73,255,0,155,166,167,1,77,151,1,3,16,35,32,82,
+84,74,64,62,69,254,65,151,166,106,97,97,110,254,127,0,0,3,0,85,255,232,12,
+135,4,138,0,74,0,86,0,97,0,0,37,33,54,54,53,52,38,35,34,7,22,22,21,20,6,35,
+34,38,53,52,54,55,38,35,34,6,6,21,17,35,17,52,38,38,35,34,6,7,54,51,50,22,
+21,20,6,35,34,38,38,53,52,18,36,51,50,22,23,54,54,51,50,23,54,51,32,0,17,
+20,6,7,33,17,51,17,33,1,6,6,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,53,
+52,38,35,34,5,230,3,40,95,96,210,175,63,50,100,103,193,156,157,192,110,103,
+40,68,134,155,84,177,80,148,112,185,255,32,118,130,152,182,189,161,119,187,
+100,162,1,43,188,146,211,87,71,210,139,160,116,122,134,1,9,1,37,75,81,1,240,
+179,249,94,1,105,86,91,92,80,85,87,86,249,93,5,128,110,79,96,104,88,116,144,
+87,224,128,196,242,11,78,199,110,163,193,193,163,106,205,78,9,91,178,204,
+253,220,2,115,165,151,72,226,195,78,179,156,166,195,121,235,162,201,1,47,
+164,92,108,100,100,51,51,254,200,254,251,128,217,100,3,222,251,146,3,187,
+55,169,101,107,112,112,108,99,170,254,48,151,166,106,97,97,110,0,0,4,0,85,
+255,232,16,211,4,138,0,103,0,115,0,129,0,140,0,0,1,38,38,35,34,4,21,20,22,
+23,7,33,55,33,54,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,54,55,38,
+35,34,6,6,21,17,35,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,
+53,52,18,36,51,50,22,23,54,54,51,50,23,54,51,32,0,17,20,6,7,33,38,38,53,52,
+18,36,51,50,4,18,21,20,2,35,34,38,53,52,54,51,50,37,6,6,21,20,22,51,50,54,
+53,52,38,1,38,38,35,34,6,21,20,22,51,50,54,53,52,5,22,22,51,50,54,53,52,38,
+35,34,16,9,50,253,176,226,254,254,102,126,73,249,4,1,3,40,95,96,210,175,63,
+50,100,103,193,156,157,192,110,103,40,68,134,155,84,177,80,148,112,185,255,
+32,118,130,152,182,189,161,119,187,100,162,1,43,188,146,211,87,71,210,139,
+160,116,122,134,1,9,1,37,75,81,2,83,84,83,155,1,46,208,209,1,51,166,229,205,
+182,216,210,175,138,247,176,86,91,92,80,85,87,86,8,135,47,123,69,120,127,
+115,110,134,130,240,211,5,128,110,79,96,104,88,116,2,220,133,149,242,213,
+125,212,111,111,144,87,224,128,196,242,11,78,199,110,163,193,193,163,106,
+205,78,9,91,178,204,253,220,2,115,165,151,72,226,195,78,179,156,166,195,121,
+235,162,201,1,47,164,92,108,100,100,51,51,254,200,254,251,128,217,100,97,
+216,110,169,1,19,151,157,254,207,205,252,254,245,240,186,193,232,128,55,169,
+101,107,112,112,108,99,170,254,173,60,63,145,133,140,146,193,195,16,88,151,
+166,106,97,97,110,0,5,0,85,255,232,12,226,4,138,0,105,0,114,0,125,0,138,0,
+153,0,0,1,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,
+51,50,22,23,54,54,51,50,23,54,51,50,22,23,54,54,51,50,22,22,21,20,6,7,22,
+21,20,6,35,34,38,39,6,4,35,34,38,53,52,54,54,51,33,50,54,54,53,52,38,35,34,
+6,6,21,21,35,53,52,46,2,35,34,7,22,22,21,20,6,35,34,38,53,52,55,38,35,34,
+6,6,21,17,35,1,6,6,21,20,51,50,53,52,1,22,22,51,50,54,53,52,38,35,34,5,6,
+21,20,22,51,50,54,53,52,38,35,34,7,6,35,33,34,6,6,21,20,51,50,54,54,55,54,
+4,47,80,148,112,185,255,32,118,130,152,182,189,161,119,187,100,162,1,43,188,
+148,209,86,72,221,149,126,103,110,127,132,195,81,67,184,118,133,198,105,94,
+101,140,157,143,142,162,4,126,254,64,198,156,174,53,157,160,2,213,183,196,
+115,145,135,100,121,40,169,46,92,123,78,31,35,72,78,162,142,141,166,142,35,
+22,150,162,71,177,3,9,70,74,149,146,249,45,5,128,110,79,96,104,88,116,9,120,
+9,83,80,71,76,82,70,79,240,108,152,254,108,112,91,47,161,80,176,146,222,64,
+2,115,165,151,72,226,195,78,179,156,166,195,121,235,162,201,1,47,164,93,106,
+99,100,42,42,76,89,82,83,102,183,105,119,154,53,56,154,124,136,139,123,86,
+176,130,125,56,107,83,47,125,116,107,147,81,132,123,152,130,119,130,83,35,
+5,48,138,81,119,146,146,124,150,108,2,114,173,186,253,220,3,217,38,114,68,
+151,151,146,254,37,151,166,106,97,97,110,206,31,39,73,77,72,62,66,67,15,15,
+20,50,37,117,36,56,96,28,0,0,5,0,85,255,232,17,56,4,138,0,107,0,119,0,130,
+0,141,0,142,0,0,1,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,50,22,23,54,54,51,50,23,54,51,50,22,23,54,54,51,50,23,54,51,50,4,
+18,21,16,5,39,54,54,53,52,38,38,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,
+38,35,34,6,6,21,17,35,17,52,46,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,
+55,38,35,34,6,6,21,17,35,1,6,2,21,20,22,51,50,54,53,52,2,37,6,2,21,20,22,
+51,50,17,52,2,1,22,22,51,50,54,53,52,38,35,34,1,4,47,80,148,112,185,255,32,
+118,130,152,182,189,161,119,187,100,162,1,43,188,148,209,86,72,221,149,178,
+131,138,167,157,228,72,71,228,157,180,137,146,191,186,1,19,147,254,182,101,
+123,126,108,202,136,108,75,129,141,219,198,197,221,151,143,65,91,157,163,
+75,177,50,108,128,104,88,57,135,142,217,195,201,221,145,140,67,81,157,163,
+75,177,3,89,115,128,121,117,121,116,123,5,143,115,133,121,117,237,119,243,
+12,5,128,110,79,96,104,88,116,13,229,2,115,165,151,72,226,195,78,179,156,
+166,195,121,235,162,201,1,47,164,93,106,99,100,62,62,112,111,111,112,66,66,
+145,254,243,173,254,128,209,129,75,225,143,135,216,116,20,98,254,225,168,
+223,249,250,222,171,1,28,99,19,109,174,190,253,220,2,40,158,166,103,42,15,
+99,254,222,169,223,249,250,222,172,1,28,101,16,109,174,190,253,220,3,173,
+75,254,255,156,166,167,167,166,152,1,6,70,73,255,0,155,166,167,1,77,151,1,
+3,254,85,151,166,106,97,97,110,254,127,0,3,0,41,253,78,4,73,4,138,0,56,0,
+57,0,58,0,0,37,22,22,21,20,6,35,34,36,39,55,22,51,50,54,53,52,38,39,6,35,
+33,53,33,50,54,54,53,52,38,38,35,35,32,38,53,52,54,51,32,23,7,38,35,34,6,
+21,20,22,51,51,50,22,22,21,20,6,1,3,3,184,65,65,255,236,147,254,245,136,95,
+212,252,151,156,68,71,55,89,253,231,1,215,157,128,60,58,116,120,37,254,240,
+229,250,229,1,47,244,95,201,253,144,154,141,222,15,150,192,112,65,254,217,
+231,75,48,126,79,160,181,69,76,138,133,100,89,57,99,34,10,144,37,81,53,66,
+78,41,160,163,158,181,139,139,128,100,87,94,81,62,146,125,81,121,252,219,
+2,154,0,0,7,0,80,253,78,9,121,4,138,0,84,0,102,0,117,0,118,0,119,0,120,0,
+121,0,0,1,52,38,38,35,34,6,21,16,23,7,38,2,53,16,0,51,50,30,2,21,21,20,22,
+22,51,50,54,54,53,17,51,17,20,30,2,51,50,54,53,52,38,39,55,22,18,21,20,6,
+7,22,22,21,20,6,35,34,39,6,35,34,38,53,53,52,38,38,35,34,6,21,20,23,7,38,
+38,53,52,54,55,38,38,53,1,38,38,39,6,6,7,22,21,21,20,22,22,51,50,54,54,53,
+1,6,35,34,39,17,20,22,22,51,50,54,53,52,38,37,21,1,1,3,59,39,121,100,136,
+171,245,117,165,143,1,19,226,105,161,114,45,42,108,89,83,113,43,177,17,60,
+108,77,139,183,123,122,122,162,141,97,88,95,90,207,169,170,101,97,176,131,
+186,31,89,68,97,117,154,103,110,101,161,141,61,40,3,106,36,65,29,47,138,90,
+54,30,80,63,59,74,45,1,149,89,102,32,27,32,90,68,102,117,78,249,194,4,248,
+252,191,2,74,161,169,98,230,190,254,205,175,129,131,1,37,193,1,0,1,50,63,
+132,190,171,54,186,157,86,88,154,140,2,117,253,175,113,133,108,64,239,179,
+155,249,87,130,130,254,213,192,142,235,76,85,192,115,172,214,135,135,183,
+234,21,86,105,61,140,111,205,129,105,94,214,131,148,196,23,71,188,143,254,
+24,21,66,45,78,87,10,79,188,17,92,105,57,43,88,121,1,52,33,3,254,222,94,89,
+57,123,113,101,157,201,144,3,222,252,171,0,8,0,80,253,78,9,121,4,138,0,88,
+0,107,0,126,0,137,0,138,0,139,0,140,0,141,0,0,1,52,38,38,35,34,6,21,16,23,
+7,38,2,53,16,0,51,50,30,2,21,21,20,22,22,51,50,54,54,53,17,51,17,20,30,2,
+51,50,54,53,52,38,39,55,22,18,21,20,6,7,22,22,21,20,6,6,35,34,39,6,35,34,
+38,38,53,53,52,38,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,23,38,38,53,
+1,52,55,6,35,34,39,22,22,21,21,20,22,22,51,50,54,54,53,1,38,39,22,21,21,20,
+22,22,51,50,54,55,6,35,34,38,53,52,5,53,52,38,35,34,21,20,22,51,50,3,3,1,
+21,3,59,39,121,100,136,171,245,117,165,143,1,19,226,105,161,114,45,42,108,
+89,83,113,43,177,17,60,108,77,139,183,123,122,122,162,141,108,97,83,92,126,
+227,138,218,110,94,177,83,154,80,28,90,70,97,117,154,103,111,100,206,164,
+70,65,62,42,2,162,2,107,175,75,68,40,32,29,79,65,59,74,45,1,93,110,86,2,53,
+114,86,102,181,34,82,79,117,134,1,178,81,73,135,70,61,82,78,233,250,234,2,
+74,161,169,98,230,190,254,205,175,129,131,1,37,193,1,0,1,50,63,132,190,171,
+54,186,157,86,88,154,140,2,117,253,175,113,133,108,64,239,179,155,249,87,
+130,130,254,213,192,143,241,76,33,167,130,124,202,115,135,135,85,167,153,
+25,80,105,63,138,108,202,125,105,94,211,128,167,215,22,72,196,147,253,194,
+70,78,116,24,49,136,101,11,92,105,57,43,88,121,1,28,15,87,81,72,202,115,114,
+60,108,86,45,144,119,72,156,1,110,118,146,65,75,1,151,3,101,252,178,144,0,
+0,3,0,85,255,232,15,194,4,138,0,101,0,112,0,113,0,0,33,35,17,52,38,38,35,
+34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,23,54,54,51,50,
+22,23,54,54,51,50,22,22,21,21,20,22,22,51,50,54,54,53,17,51,17,20,30,2,51,
+50,54,53,16,39,55,22,18,21,20,2,6,35,34,38,39,6,6,35,34,38,38,53,53,52,38,
+38,35,34,6,6,21,17,35,17,52,38,38,35,34,6,6,21,5,22,22,51,50,54,53,52,38,
+35,34,1,4,224,177,80,148,112,185,255,32,118,130,152,182,189,161,119,187,100,
+162,1,43,188,140,204,84,65,177,111,122,177,56,54,176,122,123,174,96,42,108,
+89,83,113,43,177,17,60,108,77,139,183,245,122,162,141,127,232,151,112,166,
+66,57,175,118,126,175,93,45,107,87,84,112,43,177,56,118,93,86,119,61,252,
+28,5,128,110,79,96,104,88,116,12,67,2,115,165,151,72,226,195,78,179,156,166,
+195,121,235,162,201,1,47,164,83,97,90,90,95,94,94,95,109,206,227,68,186,157,
+86,88,154,140,2,117,253,175,113,133,108,64,239,179,1,61,174,130,130,254,213,
+192,163,254,252,142,88,99,94,93,113,206,223,87,174,155,81,88,155,139,253,
+135,2,140,149,142,72,75,145,162,197,151,166,106,97,97,110,1,205,0,3,0,85,
+255,232,16,160,4,138,0,105,0,116,0,127,0,0,1,20,22,22,51,50,54,55,6,35,34,
+38,53,52,54,51,50,18,21,20,2,4,35,34,38,39,6,6,35,34,38,38,53,53,52,38,38,
+35,34,6,6,21,17,35,17,52,38,38,35,34,6,6,21,17,35,17,52,38,38,35,34,6,7,54,
+51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,23,54,54,51,50,22,23,54,
+54,51,50,22,22,21,21,20,22,22,51,50,54,54,53,17,51,1,38,38,35,34,6,21,20,
+22,51,50,5,22,22,51,50,54,53,52,38,35,34,12,198,76,149,115,182,253,35,109,
+129,160,182,193,165,179,219,160,254,216,187,139,205,91,57,174,117,126,175,
+93,45,107,87,84,112,43,177,56,118,93,86,119,61,177,80,148,112,185,255,32,
+118,130,152,182,189,161,119,187,100,162,1,43,188,140,204,84,65,177,111,122,
+177,56,54,176,122,123,174,96,42,108,89,83,113,43,177,3,52,7,129,108,79,96,
+100,92,120,241,109,5,128,110,79,96,104,88,116,1,255,161,153,74,221,197,75,
+182,160,161,191,254,253,239,208,254,201,167,80,103,92,91,113,206,223,87,174,
+155,81,88,155,139,253,135,2,140,149,142,72,75,145,162,253,135,2,115,165,151,
+72,226,195,78,179,156,166,195,121,235,162,201,1,47,164,83,97,90,90,95,94,
+94,95,109,206,227,68,186,157,86,88,154,140,2,117,254,79,155,163,106,97,100,
+107,173,151,166,106,97,97,110,0,0,4,0,85,255,232,11,200,4,138,0,52,0,63,0,
+76,0,87,0,0,33,33,17,52,38,38,35,34,6,6,21,17,35,17,52,38,38,35,34,6,7,54,
+51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,23,54,54,51,50,22,23,54,
+54,51,50,4,18,21,1,51,54,18,53,52,38,35,34,6,7,5,52,38,39,22,22,21,20,2,7,
+54,51,33,1,22,22,51,50,54,53,52,38,35,34,11,200,251,45,56,118,93,86,119,61,
+177,80,148,112,185,255,32,118,130,152,182,189,161,119,187,100,162,1,43,188,
+140,204,84,65,177,111,134,190,56,74,244,170,193,1,26,158,251,222,10,229,251,
+83,79,139,188,1,3,113,152,132,38,31,195,210,89,87,1,188,245,229,5,128,110,
+79,96,104,88,116,2,140,149,142,72,75,145,162,253,135,2,115,165,151,72,226,
+195,78,179,156,166,195,121,235,162,201,1,47,164,83,97,90,90,113,112,112,113,
+125,254,254,234,254,106,172,1,101,155,91,101,243,251,12,248,214,34,47,95,
+59,156,254,192,190,6,1,36,151,166,106,97,97,110,0,0,6,0,85,253,78,10,162,
+4,138,0,94,0,110,0,126,0,137,0,147,0,148,0,0,37,17,52,38,38,35,34,4,7,54,
+51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,23,54,54,51,50,22,23,54,
+54,51,50,22,18,21,20,6,7,22,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,17,35,
+17,52,46,2,35,34,6,6,21,17,35,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,
+34,38,53,52,54,37,22,22,23,54,54,55,17,52,38,38,35,34,6,6,21,1,54,54,55,54,
+17,52,38,35,34,14,2,21,17,22,1,22,22,51,50,54,53,52,38,35,34,1,22,22,51,50,
+53,52,38,35,34,3,4,47,80,148,112,185,255,0,31,116,132,152,182,189,161,119,
+187,100,162,1,43,188,141,204,82,65,177,112,121,176,55,68,168,124,148,225,
+122,98,105,93,100,100,111,103,154,114,100,70,86,29,155,17,45,72,59,67,86,
+29,155,51,116,90,112,191,27,83,85,117,134,148,130,141,162,188,1,85,82,149,
+66,47,118,71,56,118,93,86,119,61,3,60,46,126,80,214,178,139,80,104,64,19,
+65,249,20,6,129,109,79,96,104,88,116,1,248,2,82,70,135,71,60,82,161,114,2,
+1,165,151,72,227,194,78,179,156,166,195,121,235,162,201,1,47,164,85,95,90,
+90,93,92,96,89,143,254,252,161,153,246,106,48,188,120,124,208,95,105,129,
+208,119,129,69,97,127,254,125,1,131,95,98,65,35,64,111,115,254,122,1,124,
+113,121,66,124,98,49,141,116,118,142,200,176,153,233,59,4,63,59,58,64,5,2,
+8,149,142,72,75,145,162,253,142,62,63,2,170,1,38,182,235,55,104,137,122,254,
+20,30,1,105,153,164,106,97,97,110,252,144,104,114,140,62,72,1,39,0,0,2,0,
+85,255,232,11,109,4,138,0,99,0,110,0,0,1,54,36,51,50,22,21,20,6,6,35,35,34,
+6,21,20,22,51,51,50,22,21,20,6,35,34,38,39,55,22,51,50,53,52,38,35,35,34,
+38,53,52,54,54,51,51,50,54,53,52,38,35,34,6,6,17,17,35,17,52,38,38,35,34,
+6,6,21,17,35,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,50,22,23,54,54,51,50,22,1,22,22,51,50,54,53,52,38,35,34,7,121,90,
+1,18,185,211,252,68,115,109,59,129,81,81,120,25,179,156,190,172,101,218,71,
+63,154,170,196,71,100,30,207,152,66,154,143,84,66,43,151,141,137,227,138,
+177,56,118,93,86,119,61,177,80,148,112,185,255,32,118,130,152,182,189,161,
+119,187,100,162,1,43,188,140,203,84,62,186,108,136,191,249,200,5,128,110,
+79,96,104,88,116,3,159,117,118,157,135,81,105,45,40,47,44,39,119,118,121,
+135,43,32,140,70,106,51,48,116,107,68,98,66,39,46,73,75,102,226,254,254,254,
+84,2,140,149,142,72,75,145,162,253,135,2,115,165,151,72,226,195,78,179,156,
+166,195,121,235,162,201,1,47,164,84,96,87,93,110,253,152,151,166,106,97,97,
+110,0,0,3,0,80,255,232,10,94,4,138,0,65,0,77,0,78,0,0,1,54,54,51,50,22,18,
+21,20,2,7,39,54,54,53,52,38,35,34,14,2,21,17,35,17,52,46,2,35,34,7,22,18,
+21,20,6,35,34,38,53,52,18,55,38,35,34,6,21,16,23,7,38,2,53,52,18,36,51,50,
+23,54,51,50,22,5,6,6,21,20,22,51,50,54,53,52,2,1,6,255,62,174,132,148,225,
+122,151,166,110,125,122,177,140,72,101,70,24,177,50,108,128,104,91,62,136,
+149,217,195,201,221,142,138,72,92,221,254,249,101,157,173,158,1,33,191,166,
+149,143,172,150,221,253,83,112,122,121,117,121,116,130,4,0,3,197,99,98,143,
+254,252,161,190,254,217,130,126,88,242,159,181,235,45,99,130,143,253,171,
+2,40,158,166,103,42,18,98,254,222,167,223,249,250,222,169,1,27,101,20,255,
+207,254,216,152,129,89,1,49,191,175,1,17,147,66,66,99,129,76,253,152,166,
+167,167,166,147,1,4,253,52,0,3,0,80,255,232,11,24,4,138,0,97,0,109,0,110,
+0,0,1,34,6,21,20,22,51,51,50,22,21,20,6,35,34,38,39,55,22,51,50,53,52,38,
+35,35,34,38,53,52,54,54,51,51,50,54,53,52,38,35,34,6,6,21,17,35,17,52,46,
+2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,6,21,16,23,7,38,2,53,
+52,18,36,51,50,23,54,51,50,22,23,54,36,51,50,22,21,20,6,6,35,1,6,6,21,20,
+22,51,50,54,53,52,2,1,9,185,129,81,81,120,25,179,156,190,172,101,218,71,63,
+154,170,196,71,100,30,207,152,66,154,143,84,66,43,151,141,160,207,118,177,
+50,108,128,104,91,62,136,149,217,195,201,221,142,138,72,92,221,254,249,101,
+157,173,158,1,33,191,166,149,143,172,166,235,70,76,1,28,198,211,252,68,115,
+109,250,22,112,122,121,117,121,116,130,253,232,2,127,40,47,44,39,119,118,
+121,135,43,32,140,70,106,51,48,116,107,68,98,66,39,46,73,75,93,213,223,254,
+27,2,40,158,166,103,42,18,98,254,222,167,223,249,250,222,169,1,27,101,20,
+255,207,254,216,152,129,89,1,49,191,175,1,17,147,66,66,124,123,121,126,157,
+135,81,105,45,1,39,76,253,152,166,167,167,166,147,1,4,253,52,0,4,0,80,255,
+232,11,132,4,138,0,50,0,61,0,74,0,86,0,0,1,54,54,51,50,4,18,21,17,33,17,52,
+46,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,6,21,16,23,7,38,
+2,53,52,18,36,51,50,23,54,51,50,22,19,51,54,18,53,52,38,35,34,6,17,33,52,
+38,39,22,22,21,20,2,7,54,51,33,1,6,6,21,20,22,51,50,54,53,52,2,7,24,76,249,
+174,193,1,26,158,251,45,50,108,128,104,91,62,136,149,217,195,201,221,142,
+138,72,92,221,254,249,101,157,173,158,1,33,191,166,149,143,172,164,234,144,
+10,229,251,83,79,140,188,3,113,152,132,38,31,195,210,89,87,1,188,249,55,112,
+122,121,117,121,116,130,3,153,120,121,125,254,254,234,253,223,2,40,158,166,
+103,42,18,98,254,222,167,223,249,250,222,169,1,27,101,20,255,207,254,216,
+152,129,89,1,49,191,175,1,17,147,66,66,121,252,122,172,1,101,155,91,101,246,
+254,252,248,214,34,47,95,59,156,254,192,190,6,3,22,76,253,152,166,167,167,
+166,147,1,4,0,0,5,0,80,255,232,12,222,4,138,0,82,0,94,0,95,0,96,0,97,0,0,
+33,35,17,52,46,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,6,21,
+16,23,7,38,2,53,52,18,36,51,50,23,54,51,50,22,23,54,54,51,50,22,22,21,21,
+20,22,22,51,50,54,53,52,38,39,55,22,18,21,16,0,35,34,46,2,53,53,52,38,38,
+35,34,6,6,21,1,6,6,21,20,22,51,50,54,53,52,2,1,1,53,7,98,177,50,108,128,104,
+91,62,136,149,217,195,201,221,142,138,72,92,221,254,249,101,157,173,158,1,
+33,191,166,149,143,172,146,218,73,66,173,129,126,175,93,39,120,100,138,170,
+125,120,122,162,141,254,240,229,106,166,111,42,45,107,87,83,114,42,252,168,
+112,122,121,117,121,116,130,253,192,8,144,2,40,158,166,103,42,18,98,254,222,
+167,223,249,250,222,169,1,27,101,20,255,207,254,216,152,129,89,1,49,191,175,
+1,17,147,66,66,97,96,99,94,113,206,223,68,160,171,97,227,193,153,250,85,130,
+130,254,216,192,254,250,254,206,66,135,190,165,73,174,155,81,89,156,137,1,
+45,76,253,152,166,167,167,166,147,1,4,253,52,3,78,144,0,0,4,0,80,255,232,
+13,195,4,138,0,84,0,95,0,107,0,108,0,0,1,54,54,51,50,23,54,51,50,4,18,21,
+16,5,39,54,54,53,52,38,38,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,
+34,6,6,21,17,35,17,52,46,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,
+35,34,6,21,16,23,7,38,2,53,52,18,36,51,50,23,54,51,50,22,5,6,2,21,20,22,51,
+50,17,52,2,37,6,6,21,20,22,51,50,54,53,52,2,1,7,13,71,228,157,180,137,146,
+191,186,1,19,147,254,182,101,123,126,108,202,136,108,75,129,141,219,198,197,
+221,151,143,65,91,157,163,75,177,50,108,128,104,91,62,136,149,217,195,201,
+221,142,138,72,92,221,254,249,101,157,173,158,1,33,191,166,149,143,172,157,
+228,3,74,115,133,121,117,237,119,249,143,112,122,121,117,121,116,130,7,82,
+3,171,111,112,66,66,145,254,243,173,254,128,209,129,75,225,143,135,216,116,
+20,98,254,225,168,223,249,250,222,171,1,28,99,19,109,174,190,253,220,2,40,
+158,166,103,42,18,98,254,222,167,223,249,250,222,169,1,27,101,20,255,207,
+254,216,152,129,89,1,49,191,175,1,17,147,66,66,112,113,73,255,0,155,166,167,
+1,77,151,1,3,71,76,253,152,166,167,167,166,147,1,4,253,52,0,0,3,0,80,255,
+232,12,246,4,138,0,60,0,71,0,82,0,0,33,33,39,54,54,53,52,38,38,35,34,7,22,
+18,21,20,6,35,34,38,53,52,18,55,38,35,34,6,6,21,16,23,7,38,2,53,52,18,36,
+51,50,23,54,51,50,4,18,21,16,7,33,17,52,62,2,51,50,22,22,21,7,52,38,38,35,
+34,6,6,21,17,33,1,6,6,21,20,22,51,50,17,52,2,12,246,249,139,74,124,100,109,
+203,135,121,70,133,146,219,198,196,222,146,141,75,97,143,215,116,249,101,
+157,173,160,1,32,190,176,147,147,201,186,1,19,147,155,1,210,63,132,186,117,
+172,232,108,177,58,156,117,115,149,61,2,144,247,204,113,127,121,117,237,127,
+111,101,209,133,135,215,117,21,98,254,225,167,223,249,250,222,166,1,26,103,
+22,112,213,137,254,216,152,129,89,1,49,191,176,1,17,146,71,71,145,254,243,
+173,254,255,174,1,225,148,187,132,70,130,222,185,67,162,192,102,101,184,155,
+254,82,3,20,74,252,153,166,167,1,77,144,1,3,0,0,8,0,80,253,78,7,205,4,138,
+0,61,0,90,0,102,0,112,0,113,0,114,0,115,0,116,0,0,5,54,51,50,22,21,20,6,35,
+34,38,53,52,54,55,38,17,52,18,55,38,35,34,6,6,21,16,23,7,38,2,53,52,18,36,
+51,50,23,54,51,50,4,18,21,20,6,7,22,21,20,6,35,34,38,38,53,53,52,38,35,34,
+6,1,22,18,21,16,7,30,2,21,21,20,22,22,51,50,54,53,52,39,39,54,54,53,52,38,
+38,35,34,7,6,6,21,20,22,51,50,54,53,52,2,1,22,22,51,50,53,52,38,35,34,3,53,
+5,39,2,147,87,86,117,134,151,134,137,159,137,124,142,146,141,76,96,143,215,
+116,249,101,157,173,160,1,32,190,176,147,152,196,186,1,19,147,106,105,168,
+204,177,132,157,65,132,131,116,158,1,238,135,145,216,23,74,44,30,90,72,101,
+120,127,101,123,126,109,203,135,120,208,113,126,121,117,118,119,125,254,10,
+2,81,71,135,71,60,82,147,1,175,153,225,52,141,116,120,140,197,168,144,208,
+47,115,1,3,165,1,26,103,23,112,213,137,254,216,152,129,89,1,49,191,176,1,
+17,146,71,71,145,254,243,173,154,251,98,157,219,175,211,100,158,118,2,165,
+137,113,4,98,99,254,224,164,254,191,98,12,79,132,103,7,84,103,62,128,112,
+179,116,129,75,225,143,135,215,117,90,75,253,150,166,167,166,167,142,1,1,
+251,77,105,113,140,62,72,1,39,144,168,151,0,0,3,0,110,253,78,4,212,4,138,
+0,63,0,64,0,65,0,0,37,6,35,35,53,51,50,54,54,53,52,38,38,35,35,53,51,32,53,
+52,38,35,34,2,17,20,23,7,38,38,53,16,0,33,50,22,21,20,6,7,22,22,21,20,6,7,
+22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,3,3,3,170,16,52,224,
+156,100,104,53,55,112,135,94,93,1,25,141,133,226,246,51,168,29,35,1,88,1,
+57,207,240,97,98,106,111,60,59,59,60,214,193,158,225,142,95,124,196,106,114,
+122,62,201,248,2,2,144,28,75,60,51,79,53,144,192,90,98,254,210,254,245,240,
+186,28,93,252,113,1,77,1,124,179,142,99,133,43,34,135,91,78,120,42,47,122,
+75,160,181,55,66,138,62,47,101,88,53,96,253,109,2,155,0,3,0,110,255,232,9,
+44,4,138,0,87,0,88,0,89,0,0,37,7,38,38,53,16,0,33,50,22,21,20,6,7,22,22,21,
+20,6,6,35,35,34,6,21,20,22,51,50,54,54,53,17,51,17,20,30,2,51,50,54,54,53,
+16,39,55,22,18,21,20,2,6,35,34,38,39,6,6,35,34,38,53,52,54,54,51,51,50,54,
+53,52,38,35,35,53,51,50,54,54,53,52,38,35,34,2,17,20,23,1,1,86,168,29,35,
+1,92,1,65,195,212,83,75,87,93,75,129,130,13,46,32,117,101,130,186,90,177,
+18,60,106,78,89,148,85,245,122,162,141,125,232,153,124,182,57,77,237,161,
+181,203,59,110,108,7,78,62,80,137,121,108,78,82,46,123,116,232,254,170,5,
+110,19,28,93,252,113,1,80,1,121,134,117,75,113,25,24,107,70,81,96,46,25,22,
+51,58,102,187,179,2,36,253,175,118,131,105,63,104,196,120,1,58,174,130,130,
+254,215,191,164,254,253,145,106,107,107,106,141,109,60,89,39,45,51,54,60,
+140,17,56,46,64,71,254,207,254,244,240,205,3,222,0,0,2,0,80,255,233,7,82,
+4,138,0,63,0,64,0,0,1,54,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,39,55,
+22,51,50,54,53,52,38,38,35,35,53,51,50,54,53,52,38,35,34,6,6,21,17,35,17,
+52,46,2,35,34,6,21,16,23,7,38,2,53,52,18,54,51,50,22,1,3,191,78,240,141,200,
+234,95,100,106,111,193,173,98,104,37,81,64,107,102,64,115,123,54,53,142,139,
+130,123,131,177,93,177,18,59,107,78,139,183,245,117,162,146,128,232,150,121,
+188,254,197,3,178,109,107,176,145,98,133,43,37,144,94,149,166,23,141,20,86,
+88,59,88,48,144,95,97,91,97,103,195,221,254,17,2,85,116,132,106,63,237,180,
+254,197,170,129,128,1,39,191,166,1,3,140,110,252,116,0,0,3,0,80,255,232,12,
+25,4,138,0,78,0,79,0,80,0,0,1,20,30,2,51,50,54,53,16,39,55,22,18,21,20,2,
+6,35,34,38,39,6,6,35,34,38,38,53,53,52,38,38,35,34,6,6,21,17,35,17,52,46,
+2,35,34,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,54,51,50,22,22,21,21,20,
+22,22,51,50,54,54,53,17,51,1,1,9,29,17,60,108,77,139,183,245,122,162,141,
+127,232,151,113,167,64,57,175,118,126,175,93,45,107,87,84,112,43,177,18,59,
+107,78,139,183,245,117,162,146,128,232,150,115,168,61,109,242,123,174,96,
+42,108,89,83,113,43,177,249,43,8,1,2,29,113,133,108,64,239,179,1,61,174,130,
+130,254,213,192,163,254,252,142,89,97,93,93,113,206,223,87,174,155,81,88,
+155,139,253,135,2,85,116,132,106,63,237,180,254,195,168,129,128,1,39,191,
+166,1,3,140,90,96,186,109,206,227,68,186,157,86,88,154,140,2,117,252,34,3,
+78,0,0,2,0,80,255,238,9,191,4,138,0,62,0,63,0,0,1,54,54,51,50,22,18,21,20,
+2,7,39,54,54,53,52,38,35,34,14,2,21,17,35,17,52,38,38,35,34,6,6,21,17,35,
+17,52,38,38,35,34,6,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,54,54,51,50,
+22,1,6,105,64,166,129,148,225,122,152,165,110,125,122,177,140,81,104,64,18,
+177,56,118,93,86,119,61,177,40,125,97,89,147,86,245,117,162,146,126,232,152,
+111,167,66,60,181,113,122,176,252,22,3,208,95,91,143,254,252,161,191,254,
+217,129,126,88,242,159,181,235,55,106,136,120,253,171,2,140,149,142,72,75,
+145,162,253,135,2,85,155,159,104,104,195,119,254,197,170,130,128,1,39,192,
+162,1,4,143,87,100,93,94,93,252,99,0,3,0,80,255,239,8,31,4,138,0,30,0,41,
+0,54,0,0,1,54,54,51,50,4,18,21,17,33,17,52,46,2,35,34,6,21,16,23,7,38,2,53,
+52,18,54,51,50,22,19,51,54,18,53,52,38,35,34,6,17,33,52,38,39,22,22,21,20,
+2,7,54,51,33,3,193,76,243,166,193,1,26,158,251,45,18,59,107,78,139,183,245,
+117,162,146,128,232,150,122,186,123,10,229,251,83,79,140,188,3,113,152,132,
+38,31,195,210,89,87,1,188,3,173,110,111,125,254,254,234,253,223,2,85,116,
+132,106,63,237,180,254,198,171,129,128,1,39,191,166,1,3,140,111,252,112,172,
+1,101,155,91,101,246,254,252,248,214,34,47,95,59,156,254,192,190,6,0,0,7,
+0,80,253,78,8,50,6,190,0,89,0,101,0,102,0,103,0,104,0,105,0,106,0,0,1,52,
+46,2,35,34,6,21,20,22,23,7,38,2,53,52,18,54,51,50,22,23,54,54,51,50,23,54,
+54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,6,7,22,18,21,20,6,7,22,22,21,
+20,7,39,54,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,55,38,38,53,52,18,
+55,38,35,34,6,6,21,17,35,1,6,6,21,20,22,51,50,54,53,52,2,1,1,19,1,1,3,76,
+18,59,107,78,139,183,126,119,117,162,146,128,232,150,119,178,60,72,226,154,
+136,120,64,52,83,76,81,72,40,108,112,99,139,73,77,85,144,161,96,95,96,100,
+210,102,73,75,154,130,129,158,71,77,102,210,119,113,79,78,133,134,60,70,152,
+168,70,177,3,73,113,118,117,111,112,117,118,251,51,4,23,45,253,34,2,216,2,
+85,116,132,106,63,237,180,159,249,77,129,128,1,39,191,166,1,3,140,102,101,
+101,102,46,64,101,52,64,78,22,140,30,68,121,65,86,152,85,99,254,192,174,152,
+204,52,49,176,116,239,155,108,48,141,83,135,163,166,126,90,134,54,108,153,
+235,129,188,45,53,193,139,149,1,21,129,17,111,181,180,253,223,3,165,101,251,
+141,159,161,161,159,150,1,10,253,56,253,71,2,17,6,214,249,191,0,0,3,0,80,
+255,232,10,94,4,138,0,64,0,75,0,76,0,0,1,54,54,51,50,23,54,51,50,4,18,21,
+16,5,39,54,54,53,52,38,38,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,
+34,6,6,21,17,35,17,52,46,2,35,34,6,21,16,23,7,38,2,53,52,18,54,51,50,22,5,
+6,2,21,20,22,51,50,17,52,2,1,3,182,72,221,149,180,137,146,191,186,1,19,147,
+254,182,101,123,126,108,202,136,108,75,129,141,219,198,197,221,151,143,65,
+91,157,163,75,177,18,59,107,78,139,183,245,117,162,146,128,232,150,117,173,
+3,58,115,133,121,117,237,119,1,74,3,193,100,101,66,66,145,254,243,173,254,
+128,209,129,75,225,143,135,216,116,20,98,254,225,168,223,249,250,222,171,
+1,28,99,19,109,174,190,253,220,2,85,116,132,106,63,237,180,254,198,171,129,
+128,1,39,191,166,1,3,140,95,130,73,255,0,155,166,167,1,77,151,1,3,253,49,
+0,2,0,80,255,239,12,35,4,138,0,58,0,69,0,0,33,33,39,54,54,53,52,38,35,34,
+14,2,21,17,35,17,52,46,2,35,34,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,
+54,54,51,50,22,18,21,20,6,7,33,17,52,62,2,51,50,22,22,21,7,52,38,38,35,34,
+6,6,21,17,33,12,35,249,139,74,133,92,178,139,80,104,64,19,177,18,59,107,78,
+139,183,245,117,162,146,128,232,150,113,168,60,68,169,122,148,225,122,71,
+90,1,217,63,132,186,117,172,232,108,177,58,156,117,115,149,61,2,144,111,127,
+224,136,182,235,55,104,137,122,253,171,2,85,116,132,106,63,237,180,254,198,
+171,129,128,1,39,191,166,1,3,140,89,94,96,87,143,254,252,161,125,218,111,
+1,225,148,187,132,70,130,222,185,67,162,192,102,101,184,155,254,82,0,3,0,
+65,253,78,6,154,4,138,0,54,0,55,0,56,0,0,1,33,39,54,54,53,52,38,35,34,6,21,
+20,23,7,38,53,52,54,51,50,22,21,20,7,33,17,33,39,54,53,52,38,35,34,6,21,20,
+23,7,38,38,53,52,54,51,50,22,22,21,20,7,33,17,51,1,19,6,154,252,172,45,36,
+25,89,78,78,90,89,93,146,174,143,148,169,30,2,26,252,185,59,89,121,111,104,
+128,120,93,99,101,224,181,120,184,100,63,2,188,179,252,132,156,253,117,106,
+38,65,41,67,83,80,62,95,68,99,109,152,124,154,149,113,77,55,1,254,107,83,
+133,113,128,131,98,150,80,119,68,180,105,163,206,91,166,97,131,79,3,222,248,
+224,7,60,0,0,5,0,65,253,78,6,154,4,138,0,57,0,72,0,82,0,83,0,84,0,0,5,54,
+51,50,22,21,20,6,35,34,38,53,52,54,55,39,54,53,52,38,35,34,6,21,20,23,7,38,
+38,53,52,54,51,50,22,22,21,20,7,33,17,51,17,35,22,21,20,6,35,34,38,53,53,
+52,38,35,34,6,37,34,39,22,22,21,21,20,22,51,50,54,53,52,39,1,22,22,51,50,
+53,52,38,35,34,1,1,1,239,87,88,117,134,150,133,138,160,145,127,1,91,121,111,
+104,128,120,93,99,101,224,181,120,184,100,63,2,188,179,112,112,174,153,163,
+173,123,128,111,151,2,171,41,69,54,48,89,80,84,87,144,252,127,3,81,69,135,
+71,60,81,1,234,254,44,227,54,141,116,120,140,196,169,150,229,49,1,85,134,
+113,128,131,98,150,80,119,68,180,105,163,206,91,166,97,131,79,3,222,251,146,
+159,179,159,193,184,183,9,172,142,121,121,3,51,143,106,13,143,100,107,104,
+189,153,254,161,105,113,140,62,72,5,177,251,255,0,4,0,65,253,78,8,134,4,138,
+0,70,0,81,0,98,0,108,0,0,33,35,22,22,21,20,6,35,34,38,38,53,53,52,38,35,34,
+6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,55,6,35,35,39,54,53,52,38,35,34,
+6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,7,33,17,52,62,2,51,50,22,22,
+21,7,52,38,38,35,34,6,6,21,17,33,7,33,34,39,22,22,21,21,20,22,22,51,50,54,
+53,52,38,1,22,22,51,50,53,52,38,35,34,8,134,106,53,53,204,175,134,157,65,
+130,133,117,158,23,87,87,117,134,151,134,137,159,68,69,61,63,71,59,89,121,
+111,104,128,120,93,99,101,224,181,120,184,100,63,1,105,63,132,186,117,172,
+232,108,177,58,156,117,115,149,61,2,144,130,254,255,75,31,51,46,29,90,73,
+101,120,74,251,209,2,81,71,135,71,60,82,65,152,87,175,211,100,158,118,2,169,
+143,119,107,53,141,116,120,140,197,168,104,164,60,3,107,83,133,113,128,131,
+98,150,80,119,68,180,105,163,206,91,166,97,131,79,1,225,148,187,132,70,130,
+222,185,67,162,192,102,101,184,155,254,82,144,2,48,144,107,13,78,102,63,128,
+112,96,156,254,222,105,113,140,62,72,0,4,0,85,253,78,9,225,4,138,0,62,0,73,
+0,80,0,81,0,0,37,17,51,17,33,39,1,54,55,6,35,35,39,54,54,53,52,38,35,34,14,
+2,21,17,35,17,52,38,38,35,34,4,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,
+36,51,50,22,23,54,54,51,50,22,18,21,20,6,7,1,22,22,51,50,54,53,52,38,35,34,
+1,17,35,1,23,54,51,1,9,46,179,251,240,77,1,137,80,120,48,105,171,74,133,92,
+178,139,80,104,64,19,177,80,148,112,185,255,0,31,116,132,152,182,189,161,
+119,187,100,162,1,43,188,142,202,83,66,166,124,148,225,122,71,90,249,192,
+6,129,109,79,96,104,88,116,7,196,111,253,184,1,90,172,252,132,144,3,222,249,
+105,141,1,29,58,72,3,111,127,224,136,182,235,55,104,137,122,253,171,2,115,
+165,151,72,227,194,78,179,156,166,195,121,235,162,201,1,47,164,85,96,96,85,
+143,254,252,161,125,218,111,1,36,153,164,106,97,97,110,252,83,1,156,254,96,
+4,8,254,234,0,2,0,85,253,78,9,225,4,138,0,97,0,108,0,0,37,17,51,17,35,22,
+21,20,6,7,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,35,35,53,51,50,54,53,
+52,35,34,6,21,20,23,7,38,38,53,52,54,55,35,39,54,54,53,52,38,35,34,14,2,21,
+17,35,17,52,38,38,35,34,4,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,
+50,22,23,54,54,51,50,22,18,21,20,6,7,1,22,22,51,50,54,53,52,38,35,34,9,46,
+179,78,31,69,65,148,150,136,90,75,25,64,56,79,72,89,99,84,93,84,80,205,177,
+188,35,152,21,25,88,74,74,74,133,92,178,139,80,104,64,19,177,80,148,112,185,
+255,0,31,116,132,152,182,189,161,119,187,100,162,1,43,188,142,202,83,66,166,
+124,148,225,122,71,90,249,192,6,129,109,79,96,104,88,116,144,3,222,251,146,
+40,51,75,88,24,55,137,103,117,15,132,13,46,54,55,54,133,53,56,105,201,178,
+163,120,28,69,182,75,124,188,52,111,127,224,136,182,235,55,104,137,122,253,
+171,2,115,165,151,72,227,194,78,179,156,166,195,121,235,162,201,1,47,164,
+85,96,96,85,143,254,252,161,125,218,111,1,36,153,164,106,97,97,110,0,2,0,
+85,253,78,9,251,4,138,0,99,0,110,0,0,37,54,54,53,52,38,35,34,14,2,21,17,35,
+17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,
+23,54,54,51,50,22,18,21,20,6,7,33,17,51,17,35,22,22,21,20,6,35,34,38,39,6,
+6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,54,53,53,51,21,20,30,2,51,
+50,54,53,52,39,55,33,1,22,22,51,50,54,53,52,38,35,34,6,71,133,92,178,139,
+80,104,64,19,177,80,148,112,185,255,32,118,130,152,182,189,161,119,187,100,
+162,1,43,188,139,203,86,63,163,129,148,225,122,71,90,1,243,179,128,79,75,
+195,166,82,125,50,49,127,89,158,195,97,97,104,70,73,110,92,73,82,31,150,15,
+49,70,51,93,110,132,73,253,108,250,107,5,128,110,79,96,104,88,116,111,127,
+224,136,182,235,55,104,137,122,253,171,2,115,165,151,72,226,195,78,179,156,
+166,195,121,235,162,201,1,47,164,82,98,91,89,143,254,252,161,125,218,111,
+3,222,251,146,78,166,103,159,184,57,61,62,56,187,161,115,180,84,96,62,136,
+82,103,114,63,99,116,212,209,90,90,70,31,114,103,148,122,69,1,180,151,166,
+106,97,97,110,0,0,5,0,85,253,78,9,225,4,138,0,70,0,86,0,97,0,112,0,122,0,
+0,37,17,51,17,35,22,21,20,6,35,34,38,53,53,52,38,35,34,6,7,54,51,50,22,21,
+20,6,35,34,38,53,52,55,35,17,52,38,38,35,34,4,7,54,51,50,22,21,20,6,35,34,
+38,38,53,52,18,36,51,50,22,23,54,54,51,50,22,18,21,20,6,7,7,54,54,53,52,38,
+35,34,14,2,21,17,54,51,50,1,22,22,51,50,54,53,52,38,35,34,1,35,34,39,22,22,
+21,21,20,22,51,50,54,53,52,5,22,22,51,50,53,52,38,35,34,9,46,179,113,113,
+182,160,172,180,127,139,110,158,26,86,87,117,134,150,133,138,160,124,171,
+80,148,112,185,255,0,31,116,132,152,182,189,161,119,187,100,162,1,43,188,
+142,202,83,66,166,124,148,225,122,71,90,222,116,87,178,139,80,104,64,19,132,
+193,29,250,185,6,129,109,79,96,104,88,116,7,69,217,46,62,53,46,97,87,93,94,
+251,177,2,81,71,135,71,60,82,144,3,222,251,146,159,179,159,193,185,182,9,
+168,146,117,108,52,141,116,120,140,196,169,193,132,2,115,165,151,72,227,194,
+78,179,156,166,195,121,235,162,201,1,47,164,85,96,96,85,143,254,252,161,125,
+218,111,11,116,215,134,182,235,55,104,137,122,253,177,130,1,44,153,164,106,
+97,97,110,253,239,2,51,146,102,13,142,101,108,103,189,198,105,113,140,62,
+72,0,0,5,0,125,0,0,9,114,4,138,0,16,0,27,0,38,0,51,0,64,0,0,33,33,17,52,18,
+36,51,50,4,23,54,36,51,50,4,18,21,1,51,54,18,53,52,38,35,34,6,17,1,51,54,
+18,53,52,38,35,34,6,17,33,52,38,39,22,22,21,20,2,7,54,51,33,1,52,38,39,22,
+22,21,20,2,7,54,51,33,9,114,247,11,125,1,11,210,199,1,15,73,69,1,2,188,193,
+1,26,158,251,222,10,229,251,83,79,140,188,251,222,10,229,251,83,79,140,188,
+7,147,152,132,38,31,195,210,89,87,1,188,251,222,152,132,38,31,195,210,89,
+87,1,188,2,37,202,1,2,153,138,138,138,138,125,254,254,234,254,106,172,1,101,
+155,91,101,246,254,252,254,142,172,1,101,155,91,101,246,254,252,248,214,34,
+47,95,59,156,254,192,190,6,1,109,248,214,34,47,95,59,156,254,192,190,6,0,
+0,1,0,80,255,239,8,254,4,138,0,50,0,0,1,54,54,51,50,22,18,21,20,6,7,33,17,
+51,17,33,39,54,54,53,52,38,35,34,14,2,21,17,35,17,52,46,2,35,34,6,21,16,23,
+7,38,2,53,52,18,54,51,50,22,3,163,68,169,122,148,225,122,71,90,1,243,179,
+252,176,74,133,92,178,139,80,104,64,19,177,18,59,107,78,139,183,245,117,162,
+146,128,232,150,113,168,3,211,96,87,143,254,252,161,125,218,111,3,222,251,
+146,111,127,224,136,182,235,55,104,137,122,253,171,2,85,116,132,106,63,237,
+180,254,198,171,129,128,1,39,191,166,1,3,140,89,0,255,255,0,80,253,78,9,44,
+4,138,2,38,0,199,0,0,0,3,0,143,9,143,0,0,0,5,0,68,253,78,5,138,4,138,0,40,
+0,51,0,64,0,78,0,88,0,0,23,54,51,50,22,21,20,6,35,34,38,53,52,55,6,35,17,
+52,18,36,51,50,4,18,21,17,35,22,21,20,6,35,34,38,53,53,52,38,35,34,6,19,51,
+54,18,53,52,38,35,34,6,17,33,52,38,39,22,22,21,20,2,7,54,51,33,5,34,39,22,
+21,21,20,22,51,50,54,53,52,39,1,22,22,51,50,53,52,38,35,34,226,85,87,117,
+134,150,133,138,160,131,36,38,125,1,11,210,193,1,26,158,54,112,174,153,163,
+173,123,129,105,149,53,10,229,251,83,79,140,188,3,113,152,132,38,31,195,210,
+89,87,1,188,254,252,39,62,95,89,80,84,87,144,252,126,3,81,70,135,71,60,80,
+225,52,141,116,120,140,196,169,205,122,2,2,37,202,1,2,153,125,254,254,234,
+253,223,159,179,159,193,184,183,9,172,142,118,1,1,172,1,101,155,91,101,246,
+254,252,248,214,34,47,95,59,156,254,192,190,6,144,2,91,208,13,143,100,107,
+104,189,153,254,161,106,112,140,62,72,0,0,8,0,80,253,78,7,243,4,138,0,42,
+0,54,0,70,0,78,0,79,0,80,0,81,0,82,0,0,1,54,54,51,50,18,21,20,2,7,22,51,50,
+0,53,52,38,39,55,22,18,21,20,6,7,17,33,39,1,54,55,38,39,6,35,34,36,2,53,52,
+18,51,50,1,54,18,53,52,38,35,34,6,21,20,18,3,38,35,34,6,21,20,18,22,51,50,
+55,38,2,53,52,1,6,7,1,23,54,51,33,1,1,21,1,3,34,59,137,78,198,232,140,129,
+60,56,236,1,11,76,74,142,92,95,88,88,251,240,77,1,137,70,97,133,101,134,164,
+206,254,200,172,243,201,163,1,123,119,141,135,115,119,140,134,252,69,103,
+124,144,127,239,159,67,52,133,132,4,18,42,57,253,172,1,90,172,1,176,251,66,
+4,59,1,84,4,42,48,48,254,252,223,168,254,221,95,10,1,30,238,116,221,89,97,
+108,254,245,144,149,239,90,253,50,141,1,29,51,57,8,41,54,173,1,70,211,216,
+1,4,252,37,67,1,15,166,163,176,180,159,155,254,235,2,185,74,179,158,156,254,
+250,148,8,105,1,28,180,142,252,233,19,16,254,88,4,8,254,234,7,32,144,252,
+34,0,5,0,80,253,78,5,21,4,138,0,27,0,51,0,52,0,53,0,54,0,0,37,54,54,53,52,
+38,35,34,6,21,20,22,23,7,38,2,53,52,18,36,51,50,4,18,21,20,2,7,3,54,54,53,
+52,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,21,20,7,1,19,1,3,102,120,
+129,229,198,196,234,124,125,101,158,172,154,1,24,184,184,1,17,146,165,165,
+143,73,75,153,131,130,157,71,77,102,210,243,208,208,240,210,254,193,42,254,
+69,171,68,213,133,195,234,240,187,140,210,71,123,85,1,33,181,165,1,5,138,
+135,254,254,165,183,254,231,98,253,144,47,138,81,132,160,163,123,89,130,53,
+108,153,235,181,235,228,182,239,155,3,109,253,28,2,41,0,3,0,130,253,78,6,
+78,4,138,0,41,0,50,0,51,0,0,1,17,33,17,51,17,33,39,54,54,53,52,38,35,34,6,
+21,20,23,7,38,53,52,54,51,50,22,21,20,7,33,17,33,17,52,54,54,51,50,22,21,
+21,37,33,53,52,38,35,34,6,21,1,1,51,4,106,177,252,172,45,36,25,89,78,78,90,
+89,93,146,174,143,148,169,30,2,26,250,231,118,219,157,246,246,252,215,2,120,
+149,168,166,149,1,23,1,198,254,202,3,222,249,7,106,38,65,41,67,83,80,62,95,
+68,99,109,152,124,154,149,113,77,55,1,254,2,129,193,217,111,252,251,205,144,
+57,192,171,172,188,250,188,0,4,0,130,253,78,6,78,4,138,0,48,0,57,0,73,0,83,
+0,0,1,17,33,17,51,17,35,22,21,20,6,35,34,38,38,53,53,52,38,35,34,6,7,54,51,
+50,22,21,20,6,35,34,38,53,52,54,55,6,35,35,17,52,54,54,51,50,22,21,21,37,
+33,53,52,38,35,34,6,21,1,35,34,39,22,22,21,21,20,22,22,51,50,54,53,52,5,22,
+22,51,50,53,52,38,35,34,1,51,4,106,177,106,106,204,177,132,157,65,129,136,
+114,159,23,87,87,117,134,151,134,137,159,67,68,38,71,58,118,219,157,246,246,
+252,215,2,120,149,168,166,149,3,232,247,46,71,51,47,30,90,72,101,120,251,
+135,2,81,71,135,71,60,82,1,198,254,202,3,222,251,146,131,173,175,211,100,
+158,118,2,169,143,120,106,53,141,116,120,140,197,168,103,164,60,2,2,129,193,
+217,111,252,251,205,144,57,192,171,172,188,253,110,3,48,145,107,7,84,103,
+62,128,112,191,229,105,113,140,62,72,0,4,0,81,253,78,11,16,4,138,0,134,0,
+144,0,155,0,156,0,0,1,54,51,50,22,21,20,6,35,34,38,53,52,54,36,51,32,4,21,
+20,6,7,22,22,21,20,14,2,35,33,34,6,6,21,20,22,23,33,21,33,34,38,53,52,54,
+54,51,33,50,54,54,53,52,38,35,35,53,51,50,62,2,53,52,38,35,34,4,7,54,51,50,
+22,21,20,6,35,34,38,53,52,54,36,51,32,4,21,20,6,7,22,22,21,20,14,2,35,33,
+34,6,6,21,20,22,51,33,38,53,52,54,54,51,33,50,54,54,53,52,38,35,35,53,51,
+50,62,2,53,52,38,35,34,4,3,22,51,50,54,53,52,38,35,34,5,22,22,51,50,54,53,
+52,38,35,34,19,6,173,97,104,143,162,183,161,161,189,174,1,64,216,1,18,1,48,
+94,93,105,105,50,109,135,106,254,55,116,96,45,106,121,3,82,247,32,219,203,
+65,165,156,1,200,101,105,66,128,117,62,13,84,90,66,31,213,197,181,254,248,
+68,97,104,143,162,183,161,161,189,174,1,64,216,1,18,1,48,94,93,105,105,50,
+109,135,106,254,55,116,96,45,108,144,4,27,40,65,165,156,1,200,101,105,66,
+128,117,62,13,84,90,66,31,213,197,181,254,248,102,4,190,83,93,87,80,111,250,
+4,2,97,95,83,93,87,80,111,131,3,26,58,165,134,140,177,212,189,144,247,134,
+179,159,88,129,40,34,132,99,61,122,85,34,28,57,41,72,64,2,148,148,124,79,
+124,81,26,73,72,81,94,144,23,50,66,43,95,107,112,112,58,165,134,140,177,212,
+189,144,247,134,179,159,88,129,40,34,132,99,61,122,85,34,28,57,41,72,66,55,
+69,79,124,81,26,73,72,81,94,144,23,50,66,43,95,107,112,254,226,244,97,79,
+78,87,97,122,122,97,79,78,87,250,129,0,0,3,0,80,253,78,7,26,4,138,0,62,0,
+77,0,87,0,0,5,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,54,54,53,52,38,
+35,34,6,6,21,20,22,23,7,38,2,53,52,18,36,51,50,4,18,21,20,6,7,33,17,51,17,
+35,22,21,20,6,35,34,38,53,53,52,38,35,34,6,37,34,39,22,22,21,21,20,22,51,
+50,54,53,52,39,1,22,22,51,50,53,52,38,35,34,2,114,85,87,117,134,150,133,138,
+160,110,202,128,105,106,230,199,127,196,105,124,125,101,157,173,153,1,24,
+185,185,1,17,145,76,87,1,245,179,116,116,174,153,163,173,123,129,105,149,
+2,167,57,58,56,48,89,80,84,87,144,252,126,3,81,70,135,71,60,80,225,52,141,
+116,120,140,196,169,132,210,119,78,209,131,210,250,115,211,129,148,224,76,
+129,89,1,49,191,174,1,19,146,144,254,242,173,121,207,103,3,223,251,145,158,
+180,159,193,184,183,9,172,142,118,118,4,49,137,115,13,143,100,107,104,189,
+153,254,161,106,112,140,62,72,0,0,3,0,80,253,78,7,26,4,138,0,40,0,47,0,48,
+0,0,1,33,39,1,54,55,6,35,35,39,54,54,53,52,38,35,34,6,6,21,20,22,23,7,38,
+2,53,52,18,36,51,50,4,18,21,20,6,7,33,17,51,3,17,35,1,23,54,51,1,7,26,251,
+240,77,1,137,86,119,34,110,198,70,116,116,230,199,127,196,105,124,125,101,
+157,173,153,1,24,185,185,1,17,145,76,87,1,245,179,179,111,253,184,1,90,172,
+253,219,253,215,141,1,29,62,68,3,121,79,217,137,210,250,115,211,129,148,224,
+76,129,89,1,49,191,174,1,19,146,144,254,242,173,121,207,103,3,223,249,245,
+1,156,254,96,4,8,254,234,0,3,0,80,255,233,11,136,4,138,0,68,0,80,0,81,0,0,
+37,33,54,17,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,54,55,38,35,34,6,17,
+21,20,14,2,35,34,0,17,52,18,55,23,6,17,20,22,51,50,54,54,53,53,52,54,54,51,
+50,23,54,51,50,22,18,21,20,6,7,33,17,51,17,33,1,6,6,21,20,22,51,50,54,53,
+52,38,37,4,231,3,40,191,208,177,63,50,100,103,193,156,157,192,110,103,40,
+60,156,210,51,117,160,111,227,254,250,153,164,110,247,167,134,101,118,48,
+122,239,172,144,114,122,134,173,252,133,75,81,1,240,179,249,94,1,105,86,91,
+92,80,85,87,86,251,223,144,174,1,22,193,232,11,78,199,110,163,193,193,163,
+106,205,78,9,198,254,228,35,152,181,131,63,1,43,1,6,197,1,42,129,127,177,
+254,197,189,229,81,172,195,20,191,241,137,51,51,136,254,254,166,135,223,100,
+3,222,251,146,3,187,55,169,101,107,112,112,108,99,170,90,0,5,0,80,255,232,
+15,212,4,138,0,97,0,109,0,123,0,124,0,125,0,0,1,38,38,35,34,4,21,20,22,23,
+7,33,55,33,54,17,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,54,55,38,35,34,
+6,17,21,20,14,2,35,34,0,17,52,18,55,23,6,17,20,22,51,50,54,54,53,53,52,54,
+54,51,50,23,54,51,50,22,18,21,20,6,7,33,38,38,53,52,18,36,51,50,4,18,21,20,
+2,35,34,38,53,52,54,51,50,37,6,6,21,20,22,51,50,54,53,52,38,1,38,38,35,34,
+6,21,20,22,51,50,54,53,52,1,7,15,10,50,253,176,226,254,254,102,126,73,249,
+4,1,3,40,191,208,177,63,50,100,103,193,156,157,192,110,103,40,60,156,210,
+51,117,160,111,227,254,250,153,164,110,247,167,134,101,118,48,122,239,172,
+144,114,122,134,173,252,133,75,81,2,83,84,83,155,1,46,208,209,1,51,166,229,
+205,182,216,210,175,138,247,176,86,91,92,80,85,87,86,8,135,47,123,69,120,
+127,115,110,134,130,243,89,4,2,220,133,149,242,213,125,212,111,111,144,174,
+1,22,193,232,11,78,199,110,163,193,193,163,106,205,78,9,198,254,228,35,152,
+181,131,63,1,43,1,6,197,1,42,129,127,177,254,197,189,229,81,172,195,20,191,
+241,137,51,51,136,254,254,166,135,223,100,97,216,110,169,1,19,151,157,254,
+207,205,252,254,245,240,186,193,232,128,55,169,101,107,112,112,108,99,170,
+254,171,60,63,145,133,140,146,195,195,15,2,99,144,0,8,0,80,253,78,8,2,4,138,
+0,57,0,90,0,104,0,116,0,117,0,118,0,119,0,120,0,0,37,22,22,21,20,6,35,34,
+38,53,52,54,51,50,23,38,38,35,34,6,6,21,21,20,6,35,34,38,53,52,55,35,34,0,
+17,52,18,55,23,6,17,20,22,51,50,54,53,53,52,54,36,51,50,4,18,21,20,6,37,38,
+38,53,52,54,51,50,23,38,38,35,34,6,17,21,20,6,7,6,6,21,20,22,51,50,54,54,
+53,53,52,54,54,1,38,38,35,34,6,21,20,22,51,50,54,53,52,3,38,35,34,6,21,20,
+22,51,50,54,53,1,7,1,7,7,19,79,79,166,146,130,156,144,121,97,67,34,163,107,
+97,119,57,194,164,175,201,88,8,227,254,250,153,164,110,247,167,134,141,126,
+116,1,0,201,198,1,38,157,120,253,166,56,54,210,175,140,109,50,241,149,203,
+201,93,82,96,88,120,100,71,91,30,57,121,2,125,47,123,68,120,127,115,110,134,
+130,59,59,87,77,82,72,69,84,80,251,102,4,1,201,156,22,62,182,120,167,181,
+160,119,126,153,60,82,98,61,122,103,11,199,182,210,176,161,120,1,43,1,6,197,
+1,42,129,127,177,254,197,189,229,165,253,30,196,244,149,162,254,208,201,189,
+236,29,57,157,89,193,232,99,131,155,215,254,252,35,204,197,56,81,177,102,
+112,128,61,103,79,1,127,157,102,1,228,61,62,145,133,140,146,193,195,19,252,
+171,69,79,72,77,80,114,119,5,186,144,252,159,125,0,7,0,80,253,78,8,2,4,138,
+0,59,0,96,0,110,0,120,0,121,0,122,0,123,0,0,37,22,22,21,20,6,35,34,38,38,
+53,53,52,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,55,6,35,34,0,
+17,52,18,55,23,6,17,20,22,51,50,54,53,53,52,54,36,51,50,4,18,21,20,6,7,6,
+35,34,38,53,52,54,51,50,23,38,38,35,34,6,17,21,20,6,7,54,51,50,22,22,21,21,
+20,22,22,51,50,54,53,52,38,19,38,38,35,34,6,21,20,22,51,50,54,53,52,1,22,
+22,51,50,53,52,38,35,34,3,7,1,7,70,69,70,204,177,127,154,73,128,135,117,158,
+23,87,87,117,134,151,134,137,159,61,62,46,57,227,254,250,153,164,110,247,
+167,134,141,126,116,1,0,201,198,1,38,157,94,244,46,50,182,216,210,175,140,
+109,50,241,149,203,201,52,58,55,49,149,183,94,44,89,59,101,120,65,100,47,
+123,68,120,127,115,110,134,130,251,96,2,81,71,135,71,60,82,129,4,254,97,43,
+73,173,101,175,211,92,157,124,7,160,140,114,102,53,141,116,120,140,197,168,
+92,156,63,9,1,43,1,6,197,1,42,129,127,177,254,197,189,229,165,253,30,196,
+244,149,162,254,208,201,163,226,121,9,240,186,193,232,99,131,155,215,254,
+252,35,146,181,63,13,97,174,143,10,111,99,46,128,112,90,149,2,123,61,62,145,
+133,140,146,193,195,19,252,146,105,113,140,62,72,5,149,144,252,34,0,3,0,65,
+253,78,8,161,4,138,0,77,0,88,0,96,0,0,1,54,54,55,51,17,35,7,38,35,35,34,6,
+21,20,22,51,51,50,22,21,20,6,35,34,38,39,55,22,51,50,53,52,38,35,35,34,38,
+53,52,55,33,39,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,
+21,20,7,33,17,38,38,53,52,54,51,50,22,22,21,7,53,52,38,38,35,34,6,21,20,22,
+1,6,4,7,17,33,17,52,5,245,148,247,115,174,36,58,155,191,12,99,119,106,119,
+64,179,163,200,185,126,203,97,64,161,198,229,102,101,51,212,166,42,253,19,
+59,89,121,111,104,128,120,93,99,101,224,181,120,184,100,63,2,25,223,240,177,
+146,113,144,60,177,24,72,52,64,74,145,3,64,72,254,239,169,1,251,2,124,33,
+234,231,251,146,83,83,53,52,56,42,120,120,115,132,46,51,130,89,108,57,49,
+117,110,66,45,107,83,133,113,128,131,98,150,80,119,68,180,105,163,206,91,
+166,97,131,79,1,81,4,204,164,128,181,90,148,134,168,158,89,96,53,85,77,113,
+121,1,10,162,212,25,254,167,2,107,77,0,0,8,0,80,253,78,9,121,4,138,0,110,
+0,111,0,112,0,113,0,114,0,115,0,116,0,117,0,0,1,54,54,53,52,38,35,34,6,21,
+20,22,23,7,38,38,53,52,54,55,46,2,53,53,52,38,38,35,34,6,6,21,17,22,22,21,
+20,7,39,54,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,55,17,52,38,38,
+35,34,6,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,54,54,51,50,22,22,21,21,
+20,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,7,22,22,21,20,7,1,7,1,7,1,
+19,5,8,19,73,75,154,130,129,158,71,77,102,105,105,96,95,56,81,35,45,107,87,
+83,114,42,172,189,210,102,73,75,154,130,129,158,71,77,102,105,105,192,169,
+40,125,97,89,147,86,245,117,162,146,126,232,152,111,166,67,56,175,119,125,
+174,95,39,120,100,138,170,125,120,122,162,141,122,116,93,99,210,249,116,4,
+5,74,4,252,78,51,3,212,253,186,48,141,83,135,163,166,126,90,134,54,108,76,
+202,116,118,179,51,33,114,173,160,73,174,155,81,89,156,137,253,253,24,223,
+161,244,156,108,48,141,83,135,163,166,126,90,134,54,108,76,202,116,158,228,
+27,1,224,155,159,104,104,195,119,254,197,170,130,128,1,39,192,162,1,4,143,
+86,101,93,94,111,206,225,68,160,171,97,227,193,153,250,85,130,130,254,216,
+192,176,249,65,49,178,117,244,156,3,66,144,4,110,144,249,249,2,165,148,0,
+0,7,0,80,253,78,9,121,4,138,0,82,0,103,0,121,0,122,0,123,0,124,0,125,0,0,
+1,20,22,22,51,50,54,53,52,38,39,55,22,18,21,16,7,22,21,20,6,35,34,38,38,53,
+53,52,38,38,35,34,6,6,21,17,35,17,52,38,38,35,34,6,21,20,22,23,7,38,38,53,
+52,54,55,17,52,38,38,35,34,6,6,21,16,23,7,38,2,53,52,18,54,51,50,22,23,54,
+51,50,22,22,21,3,39,46,2,53,53,52,38,38,35,34,6,6,21,17,22,23,54,51,50,5,
+6,35,34,39,22,22,21,21,20,30,2,51,50,54,53,52,1,7,1,55,6,142,39,120,100,138,
+170,125,120,122,162,141,189,169,207,168,124,157,68,37,75,61,59,74,45,155,
+32,90,68,103,116,79,86,114,110,101,125,113,40,125,97,89,147,86,245,117,162,
+146,126,232,152,112,165,67,113,237,125,174,95,66,6,35,45,27,45,107,87,83,
+114,42,141,91,96,178,46,2,15,84,92,82,83,43,41,22,44,72,50,96,118,254,110,
+4,251,5,1,2,40,160,171,97,227,193,153,250,85,130,130,254,216,192,254,200,
+154,159,231,166,212,93,159,150,19,101,96,49,43,88,121,254,107,1,161,94,89,
+57,124,112,104,162,69,96,90,207,123,127,193,42,1,249,155,159,104,104,195,
+119,254,197,170,130,128,1,39,192,162,1,4,143,87,100,187,111,206,225,253,250,
+7,41,86,153,143,73,174,155,81,89,156,137,253,249,12,119,133,113,27,31,44,
+136,106,30,80,82,51,31,135,107,191,4,230,144,252,34,144,0,0,4,0,80,255,232,
+14,158,4,138,0,78,0,89,0,90,0,91,0,0,1,20,22,22,51,50,54,53,52,38,39,55,22,
+18,21,20,7,54,51,33,17,52,62,2,51,50,22,22,21,17,33,6,35,34,46,2,53,53,52,
+38,38,35,34,6,6,21,17,35,17,52,38,38,35,34,6,6,21,16,23,7,38,2,53,52,18,54,
+51,50,22,23,54,54,51,50,22,22,21,5,52,38,38,35,34,6,6,21,17,33,1,7,6,142,
+39,120,100,138,170,125,120,122,162,141,125,72,88,1,16,63,132,186,117,172,
+232,108,249,139,80,85,106,166,111,42,45,107,87,83,114,42,177,40,125,97,89,
+147,86,245,117,162,146,126,232,152,111,166,67,56,175,119,125,174,95,7,95,
+58,156,117,115,149,61,2,144,249,70,4,2,40,160,171,97,227,193,153,250,85,130,
+130,254,216,192,249,154,3,1,225,148,187,132,70,130,222,185,253,143,24,66,
+135,190,165,73,174,155,81,89,156,137,253,135,2,85,155,159,104,104,195,119,
+254,197,170,130,128,1,39,192,162,1,4,143,86,101,93,94,111,206,225,62,162,
+192,102,101,184,155,254,82,3,222,144,0,6,0,80,253,78,9,121,4,138,0,75,0,108,
+0,118,0,119,0,120,0,121,0,0,1,20,22,22,51,50,54,53,52,38,39,55,22,18,21,20,
+2,7,22,21,20,6,35,34,38,38,53,53,52,38,35,34,6,7,54,51,50,22,21,20,6,35,34,
+38,53,52,55,35,17,52,38,38,35,34,6,6,21,16,23,7,38,2,53,52,18,54,51,50,22,
+23,54,51,50,22,22,21,1,6,35,34,46,2,53,53,52,38,38,35,34,6,6,21,17,54,51,
+50,22,22,21,21,20,22,22,51,50,54,53,52,5,22,22,51,50,53,52,38,35,34,1,7,1,
+6,142,39,120,100,138,170,125,120,122,162,141,124,118,137,204,177,132,157,
+65,129,134,117,158,23,87,87,117,134,151,134,137,159,129,153,40,125,97,89,
+147,86,245,117,162,146,126,232,152,112,165,67,113,237,125,174,95,1,96,57,
+49,100,173,109,43,45,107,87,83,114,42,127,173,161,190,75,30,90,72,101,120,
+251,135,2,81,71,135,71,60,82,2,240,4,251,106,2,40,160,171,97,227,193,153,
+250,85,130,130,254,216,192,174,254,252,69,149,196,175,211,100,158,118,2,163,
+139,114,102,53,141,116,120,140,197,168,197,128,2,85,155,159,104,104,195,119,
+254,197,170,130,128,1,39,192,162,1,4,143,87,100,187,111,206,225,253,134,10,
+68,131,189,168,73,174,155,81,89,156,137,253,156,106,127,165,132,7,84,103,
+62,128,112,179,217,105,113,140,62,72,5,149,144,252,178,0,0,3,0,65,255,242,
+9,106,4,138,0,35,0,46,0,59,0,0,33,33,39,54,53,52,38,35,34,6,21,20,23,7,38,
+38,53,52,54,51,50,22,22,21,20,7,33,17,52,18,36,51,50,4,18,21,1,51,54,18,53,
+52,38,35,34,6,17,33,52,38,39,22,22,21,20,2,7,54,51,33,9,106,249,54,59,89,
+121,111,104,128,120,93,99,101,224,181,120,184,100,63,1,108,125,1,11,210,193,
+1,26,158,251,222,17,226,247,83,79,140,188,3,113,152,132,38,31,195,210,89,
+87,1,188,107,83,133,113,128,131,98,150,80,119,68,180,105,163,206,91,166,97,
+131,79,1,149,202,1,2,153,125,254,254,234,254,111,171,1,98,154,91,101,246,
+254,252,248,214,34,47,95,59,156,254,192,190,6,0,0,1,0,65,255,239,11,25,4,
+138,0,71,0,0,5,39,54,54,53,52,38,35,34,14,2,21,17,35,17,52,46,2,35,34,6,21,
+16,23,7,33,39,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,
+20,7,33,38,38,53,52,18,54,51,50,22,23,54,54,51,50,22,18,21,20,2,9,220,110,
+125,122,177,140,72,101,70,24,177,18,59,107,78,139,183,230,73,252,223,59,89,
+121,111,104,128,120,93,99,101,224,181,120,184,100,63,1,235,88,78,125,234,
+151,113,168,61,61,172,125,148,225,122,151,17,126,88,242,159,181,235,45,99,
+130,143,253,171,2,85,116,132,106,63,237,180,254,213,187,111,107,83,133,113,
+128,131,98,150,80,119,68,180,105,163,206,91,166,97,131,79,110,218,125,164,
+1,2,143,88,97,95,90,143,254,252,161,190,254,217,0,4,0,65,253,78,9,53,4,138,
+0,71,0,99,0,109,0,110,0,0,5,54,51,50,22,21,20,6,35,34,38,53,52,54,55,6,35,
+35,39,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,7,33,
+38,38,53,52,18,36,51,50,4,18,21,20,6,7,22,21,20,6,35,34,38,38,53,53,52,38,
+35,34,6,37,54,54,53,52,38,35,34,6,6,21,20,22,23,7,22,22,21,21,20,22,22,51,
+50,54,53,52,39,1,22,22,51,50,53,52,38,35,34,1,3,255,84,88,117,134,151,134,
+137,159,70,70,57,94,182,59,89,121,111,104,128,120,93,99,101,224,181,120,184,
+100,63,1,231,81,81,154,1,24,184,185,1,17,145,106,105,171,204,177,132,157,
+65,130,133,114,156,3,109,120,129,229,198,129,196,105,114,118,18,101,111,30,
+90,72,101,120,131,252,10,2,81,71,135,71,60,82,2,19,225,52,141,116,120,140,
+197,168,105,164,60,4,107,83,133,113,128,131,98,150,80,119,68,180,105,163,
+206,91,166,97,131,79,93,215,123,170,1,16,145,144,254,242,173,152,250,97,159,
+221,175,211,100,158,118,2,169,143,116,227,73,228,142,209,251,116,210,129,
+146,213,80,21,47,177,172,7,84,103,62,128,112,183,115,254,176,105,113,140,
+62,72,1,176,0,0,2,254,114,0,0,1,66,6,191,0,17,0,18,0,0,1,54,54,51,50,22,22,
+21,17,35,17,52,38,38,35,34,6,7,23,254,114,9,191,144,142,169,65,177,35,91,
+70,82,92,3,189,5,113,161,173,132,207,226,251,118,4,123,173,177,86,102,93,
+254,0,2,255,132,0,0,2,58,6,191,0,22,0,23,0,0,3,38,53,52,54,51,50,22,22,21,
+17,35,17,52,46,2,35,34,6,21,20,23,23,112,12,180,156,120,166,72,177,14,41,
+69,56,75,85,8,200,5,2,55,56,161,173,108,199,190,251,50,4,178,112,138,86,45,
+100,90,42,38,179,0,0,3,254,142,0,0,1,143,6,190,0,20,0,33,0,34,0,0,33,35,17,
+52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,1,34,6,21,20,22,51,50,
+54,53,52,39,38,19,1,143,177,30,29,2,135,130,119,151,171,148,138,212,100,254,
+47,72,85,64,62,62,65,32,31,94,4,52,186,170,47,15,16,130,134,149,123,122,148,
+134,251,236,1,235,75,66,65,69,71,61,86,51,6,254,50,0,3,255,103,0,0,2,117,
+6,190,0,20,0,33,0,34,0,0,33,35,17,52,38,39,22,21,20,6,35,34,38,53,52,54,51,
+50,22,22,21,1,34,6,21,20,22,51,50,54,53,52,39,38,19,2,117,177,30,29,2,135,
+130,123,160,180,152,138,212,100,254,47,72,85,64,62,62,65,32,33,166,4,52,186,
+170,47,15,16,130,134,147,119,123,153,134,251,236,1,235,75,66,65,69,71,61,
+86,51,6,254,50,0,5,255,243,253,78,2,215,4,138,0,28,0,40,0,41,0,42,0,43,0,
+0,37,54,18,53,52,38,35,34,7,39,54,51,50,22,21,20,2,7,22,22,21,20,6,35,34,
+38,53,52,54,19,20,22,51,50,54,53,52,38,35,34,6,55,3,19,1,39,55,46,81,82,61,
+62,35,83,95,159,164,55,55,124,137,205,165,168,202,165,3,111,91,90,112,109,
+94,91,110,211,61,90,243,195,1,7,108,104,101,16,141,23,177,165,112,254,219,
+181,31,183,129,160,197,196,161,139,192,254,179,101,118,117,104,102,118,117,
+253,252,87,2,178,0,0,6,255,243,253,78,2,215,4,138,0,28,0,42,0,58,0,59,0,60,
+0,61,0,0,37,54,18,53,52,38,35,34,7,39,54,51,50,22,21,20,2,7,22,22,21,20,6,
+35,34,38,53,52,54,23,6,21,20,22,51,50,54,53,52,39,38,35,34,7,6,21,20,22,51,
+50,54,53,52,39,6,6,35,34,38,19,3,19,1,39,55,46,81,82,61,62,35,83,95,159,164,
+55,55,124,137,206,165,168,201,166,86,14,68,64,58,70,20,49,62,64,160,9,131,
+103,104,130,8,21,115,90,89,117,209,3,9,243,195,1,7,108,104,101,16,141,23,
+177,165,112,254,219,181,31,183,129,160,197,197,160,140,193,132,25,25,49,55,
+57,47,28,25,21,153,33,41,103,121,122,104,37,32,78,82,83,1,108,252,87,2,178,
+0,4,255,211,253,78,2,174,4,110,0,30,0,41,0,42,0,43,0,0,5,38,39,46,2,53,52,
+18,55,51,6,6,21,20,22,23,30,2,21,20,6,35,34,38,53,52,54,51,50,23,38,35,34,
+6,21,20,22,51,50,54,3,19,1,243,21,53,62,44,27,78,74,187,82,77,34,63,49,43,
+25,220,175,147,189,181,148,116,115,99,118,81,91,88,80,101,115,244,19,112,
+93,131,151,128,150,73,119,1,17,128,137,238,135,81,171,155,122,137,138,70,
+189,208,162,134,132,159,213,70,79,72,72,78,118,254,208,2,178,0,0,3,255,211,
+253,78,3,214,4,110,0,62,0,63,0,64,0,0,5,54,54,51,50,22,21,21,35,53,52,38,
+35,34,6,6,21,21,35,53,52,38,35,34,6,21,20,22,51,50,54,53,52,38,38,39,46,2,
+53,52,18,55,51,6,6,21,20,22,23,22,22,21,20,4,35,34,36,53,52,54,51,50,3,19,
+1,116,30,83,60,104,107,140,43,43,31,41,18,140,42,47,45,51,166,178,167,178,
+20,39,54,42,39,22,78,74,187,82,77,32,66,66,50,254,227,239,247,255,0,134,109,
+120,52,19,166,49,43,124,111,51,21,78,54,27,50,52,24,22,74,57,59,54,92,92,
+127,119,65,116,120,143,108,123,129,68,119,1,17,128,137,238,135,71,172,164,
+162,210,95,190,207,171,161,106,135,253,152,2,178,0,0,3,255,211,253,78,2,170,
+4,110,0,35,0,36,0,37,0,0,23,6,21,20,51,50,54,53,52,38,39,38,38,53,52,18,55,
+51,6,6,21,20,22,23,30,2,21,20,6,35,34,38,53,52,55,1,19,141,6,182,97,90,41,
+66,62,43,78,74,187,82,77,36,61,49,40,24,195,170,167,195,6,1,49,19,137,30,
+42,200,102,115,69,144,160,150,194,89,119,1,17,128,137,238,135,79,176,152,
+123,117,120,54,170,186,192,162,38,39,253,200,2,178,0,3,255,221,253,78,2,154,
+4,110,0,5,0,6,0,7,0,0,1,17,33,53,33,17,3,19,2,154,253,67,2,12,223,19,4,110,
+250,76,146,5,34,248,224,2,178,0,0,3,0,90,253,78,2,189,4,110,0,16,0,17,0,18,
+0,0,1,2,17,20,22,51,50,55,23,6,35,34,2,53,52,18,27,2,2,3,246,134,156,56,68,
+18,80,101,212,218,114,124,118,19,4,110,253,237,254,53,195,178,11,149,12,1,
+7,255,221,1,229,1,33,248,224,2,178,0,0,5,0,20,253,78,6,70,4,110,0,51,0,63,
+0,74,0,75,0,76,0,0,1,35,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,
+53,52,54,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,23,
+38,38,35,34,6,6,21,37,38,35,34,6,21,20,22,51,50,54,53,5,21,20,22,51,50,53,
+52,38,35,34,3,19,3,108,150,45,109,89,87,163,39,76,72,117,134,150,133,134,
+156,120,217,133,95,151,80,50,160,110,215,255,166,143,130,154,144,121,88,65,
+42,152,99,98,118,46,2,75,59,87,76,83,72,69,84,80,250,232,81,73,135,71,60,
+81,116,81,253,88,1,78,95,106,61,78,64,38,137,113,116,136,180,157,112,180,
+100,56,73,63,62,220,184,155,166,149,112,119,143,49,62,70,67,119,105,20,66,
+71,66,70,72,103,107,8,4,96,103,132,59,68,1,54,4,110,0,0,5,0,20,252,240,7,
+47,4,110,0,62,0,74,0,85,0,86,0,87,0,0,5,38,35,34,6,6,21,17,35,17,52,38,38,
+35,34,6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,54,51,50,
+22,23,22,22,21,20,6,7,39,54,54,53,52,39,22,21,20,6,35,34,38,53,52,54,23,38,
+35,34,6,21,20,22,51,50,53,52,5,21,20,22,51,50,53,52,38,35,34,3,19,5,103,79,
+166,98,118,46,150,45,109,89,87,163,39,76,72,117,134,150,133,134,156,120,217,
+133,95,151,80,50,160,110,157,214,49,139,144,36,31,132,22,27,95,2,156,138,
+139,150,193,239,21,32,112,122,69,66,160,250,242,81,73,135,71,60,81,116,81,
+166,82,67,119,105,254,207,1,78,95,106,61,78,64,38,137,113,116,136,180,157,
+112,180,100,56,73,63,62,114,107,44,188,139,61,130,36,61,30,94,46,142,76,24,
+24,147,160,128,119,131,146,122,2,87,77,56,62,200,43,41,4,96,103,132,59,68,
+1,54,4,110,0,255,255,0,20,253,78,6,70,4,138,2,38,0,232,0,0,0,3,0,30,0,249,
+0,0,255,255,0,20,253,78,6,70,4,138,2,38,0,232,0,0,0,3,0,31,0,142,0,0,255,
+255,0,20,253,78,6,70,4,138,2,38,0,232,0,0,0,3,0,37,0,154,0,0,255,255,0,20,
+253,78,6,70,4,138,2,38,0,232,0,0,0,3,0,44,0,131,0,0,255,255,0,20,253,78,6,
+70,4,138,2,38,0,232,0,0,0,2,0,45,71,0,255,255,0,20,253,78,6,70,4,138,2,38,
+0,232,0,0,0,2,0,47,60,0,255,255,0,20,253,78,6,70,4,138,2,38,0,232,0,0,0,2,
+0,48,123,0,255,255,0,20,253,78,6,70,4,138,2,38,0,232,0,0,0,3,0,51,0,143,0,
+0,255,255,0,20,252,240,7,47,4,138,2,38,0,233,0,0,0,3,0,30,0,249,0,0,255,255,
+0,20,252,240,7,47,4,138,2,38,0,233,0,0,0,3,0,31,0,142,0,0,255,255,0,20,252,
+240,7,47,4,138,2,38,0,233,0,0,0,3,0,37,0,154,0,0,255,255,0,20,252,240,7,47,
+4,138,2,38,0,233,0,0,0,3,0,44,0,131,0,0,255,255,0,20,252,240,7,47,4,138,2,
+38,0,233,0,0,0,2,0,45,71,0,255,255,0,20,252,240,7,47,4,138,2,38,0,233,0,0,
+0,2,0,47,60,0,255,255,0,20,252,240,7,47,4,138,2,38,0,233,0,0,0,2,0,48,123,
+0,255,255,0,20,252,240,7,47,4,138,2,38,0,233,0,0,0,3,0,51,0,143,0,0,0,2,0,
+148,255,228,1,146,5,183,0,3,0,15,0,0,1,35,3,51,3,50,22,23,20,6,35,34,38,53,
+52,54,1,78,117,51,219,110,60,66,1,70,57,59,68,65,1,156,4,27,251,65,71,66,
+68,71,70,69,66,71,0,4,0,143,4,86,2,218,6,190,0,3,0,7,0,8,0,9,0,0,1,3,35,3,
+33,3,35,3,7,3,1,114,51,125,51,2,75,51,124,51,53,10,6,102,253,240,2,16,253,
+240,2,16,175,1,7,0,0,2,0,51,0,0,4,248,5,182,0,27,0,31,0,0,1,3,33,21,33,3,
+35,19,33,3,35,19,33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,19,33,
+3,215,63,1,24,254,205,82,147,84,254,221,82,144,78,254,254,1,29,65,254,238,
+1,43,82,147,82,1,37,84,144,84,1,6,252,235,1,35,64,254,221,3,125,254,184,137,
+254,84,1,172,254,84,1,172,137,1,72,137,1,176,254,80,1,176,254,80,137,254,
+184,1,72,0,0,5,0,101,255,236,6,66,5,203,0,11,0,23,0,27,0,39,0,51,0,0,1,34,
+38,53,52,54,51,50,22,23,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,1,35,1,
+19,34,38,53,52,54,51,50,22,23,6,6,39,50,54,53,52,38,35,34,6,21,20,22,1,144,
+143,156,149,150,147,159,1,157,150,78,79,79,78,79,71,71,3,247,252,213,158,
+3,43,117,142,157,149,150,146,160,1,1,156,150,79,78,79,78,79,71,71,2,53,239,
+222,228,229,236,221,228,233,130,165,166,165,165,166,164,165,166,3,0,250,73,
+5,183,250,53,238,223,228,228,237,219,229,232,129,164,168,163,164,163,164,
+166,166,0,0,3,0,143,4,86,1,195,6,190,0,3,0,4,0,5,0,0,1,3,35,3,5,3,1,114,51,
+125,51,1,52,10,6,102,253,240,2,16,175,1,7,0,0,5,0,82,253,110,2,43,6,190,0,
+19,0,20,0,21,0,22,0,23,0,0,19,52,18,18,54,55,51,6,2,17,20,18,18,22,23,35,
+38,38,2,2,1,3,3,19,82,36,74,113,78,172,140,145,37,71,106,69,170,78,113,74,
+36,1,183,10,121,22,2,48,150,1,35,1,18,253,111,231,253,215,254,219,142,254,
+229,254,241,253,113,108,247,1,13,1,31,4,28,1,7,249,66,253,110,0,0,5,0,61,
+253,110,2,23,6,190,0,19,0,20,0,21,0,22,0,23,0,0,1,20,2,2,6,7,35,54,54,18,
+18,53,16,2,39,51,22,22,18,18,11,2,19,2,23,36,75,113,78,170,69,106,72,36,144,
+141,172,78,113,75,36,84,10,251,22,2,47,148,254,225,254,242,246,108,113,253,
+1,15,1,26,143,1,36,2,41,231,111,253,254,238,254,221,2,242,1,7,249,66,253,
+110,0,3,0,82,2,201,4,20,6,190,0,14,0,15,0,16,0,0,1,3,37,23,5,19,7,3,3,39,
+19,37,55,5,3,5,3,2,152,43,1,141,26,254,134,245,178,176,158,184,242,254,137,
+29,1,135,43,1,36,10,6,102,254,119,111,193,28,254,186,96,1,102,254,154,96,
+1,70,28,193,111,1,137,175,1,7,0,0,3,0,104,0,0,4,43,5,183,0,11,0,12,0,13,0,
+0,1,33,21,33,17,35,17,33,53,33,17,51,3,19,2,147,1,152,254,104,147,254,104,
+1,152,147,79,11,3,27,146,254,90,1,166,146,1,168,251,61,5,183,0,2,0,63,254,
+248,1,121,0,238,0,12,0,13,0,0,37,23,14,3,7,35,62,3,55,7,1,106,15,14,39,47,
+51,25,138,15,29,27,22,8,70,238,23,54,122,124,123,56,61,132,131,125,53,238,
+0,3,0,82,0,0,2,66,4,110,0,3,0,4,0,5,0,0,19,53,33,21,3,17,82,1,240,254,1,209,
+168,168,2,157,251,146,0,1,0,147,255,227,1,145,0,250,0,19,0,0,55,52,62,2,51,
+50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,20,20,34,47,26,27,
+46,34,20,111,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,0,5,0,40,253,
+78,2,251,6,190,0,3,0,4,0,5,0,6,0,7,0,0,1,1,35,1,7,3,3,19,2,251,253,224,179,
+2,33,134,10,51,22,6,102,247,166,8,90,175,1,7,249,66,253,78,0,2,0,103,255,
+236,4,49,5,205,0,11,0,23,0,0,5,34,2,17,16,18,51,50,18,17,16,2,39,50,18,17,
+16,2,35,34,2,17,16,18,2,74,238,245,239,244,237,250,241,246,159,146,147,158,
+160,143,143,20,1,126,1,115,1,130,1,110,254,129,254,143,254,132,254,139,153,
+1,30,1,58,1,57,1,29,254,228,254,198,254,197,254,227,0,0,1,0,184,0,0,2,216,
+5,183,0,10,0,0,33,35,17,52,55,6,7,7,39,1,51,2,216,176,8,29,49,204,94,1,139,
+149,3,254,165,87,31,41,168,121,1,52,0,1,0,100,0,0,4,42,5,203,0,26,0,0,33,
+33,53,1,62,2,53,52,38,35,34,6,7,39,54,51,50,22,23,20,6,6,7,1,21,33,4,42,252,
+58,1,127,152,125,62,139,119,96,160,96,96,206,242,205,237,1,87,148,140,254,
+207,2,227,150,1,131,154,155,151,87,115,130,64,75,121,172,210,179,108,194,
+183,136,254,211,8,0,0,1,0,93,255,236,4,32,5,203,0,39,0,0,1,21,22,22,21,20,
+4,33,34,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,55,38,38,35,34,6,
+7,39,54,33,50,22,21,20,6,2,196,171,177,254,222,254,241,243,159,93,213,98,
+185,186,205,205,141,143,174,192,1,1,142,124,97,169,102,90,197,1,3,216,237,
+155,3,2,8,22,176,148,207,229,80,168,47,50,144,145,129,129,154,148,128,105,
+118,54,68,122,152,195,167,139,181,0,2,0,44,0,0,4,108,5,191,0,10,0,18,0,0,
+1,35,17,35,17,33,53,1,51,17,51,33,17,52,55,35,6,7,1,4,108,213,174,253,67,
+2,176,187,213,254,125,10,8,35,53,254,73,1,76,254,180,1,76,154,3,217,252,47,
+1,205,122,201,77,83,253,144,0,1,0,130,255,236,4,32,5,183,0,28,0,0,55,53,22,
+22,51,50,54,53,52,38,35,34,7,39,19,33,21,33,3,54,51,50,4,21,20,0,33,34,38,
+130,72,211,98,172,189,184,183,108,142,90,55,2,222,253,188,35,125,100,228,
+1,8,254,225,254,252,118,197,60,170,44,53,163,153,148,149,31,57,2,179,164,
+254,88,22,230,200,228,254,253,41,0,0,2,0,111,255,236,4,49,5,203,0,23,0,37,
+0,0,1,21,38,35,34,2,3,51,54,54,51,50,22,21,20,2,35,34,0,17,16,0,33,50,19,
+52,38,35,34,6,6,21,20,22,22,51,50,54,3,193,75,101,237,244,13,12,55,177,115,
+193,230,252,212,227,254,241,1,79,1,79,107,7,145,137,93,149,78,81,142,91,137,
+151,5,185,154,25,254,226,254,206,84,88,238,207,228,254,249,1,84,1,49,1,173,
+1,173,252,12,144,159,81,123,64,100,176,99,177,0,1,0,91,0,0,4,48,5,183,0,6,
+0,0,33,1,33,53,33,21,1,1,24,2,88,252,235,3,213,253,174,5,19,164,140,250,213,
+0,0,3,0,102,255,236,4,46,5,203,0,23,0,35,0,48,0,0,1,22,22,21,20,4,35,34,38,
+53,52,54,55,38,38,55,38,54,51,50,22,21,20,6,5,54,54,53,52,38,35,34,6,21,6,
+22,23,6,6,21,20,22,51,50,54,53,52,38,39,2,233,174,151,254,253,220,237,252,
+151,152,133,124,1,1,241,196,200,238,135,254,217,134,118,141,121,118,140,1,
+114,116,145,131,161,148,143,164,145,162,3,6,85,188,122,182,217,205,188,126,
+195,70,75,181,115,159,189,188,162,110,176,3,55,135,93,98,113,114,97,89,129,
+219,62,152,105,114,134,137,117,94,144,63,0,2,0,99,255,236,4,37,5,203,0,23,
+0,37,0,0,51,53,22,51,50,18,19,35,6,35,34,38,53,52,18,51,50,0,17,16,0,33,34,
+38,19,20,22,51,50,54,54,53,46,2,35,34,6,205,83,97,239,244,11,12,112,237,194,
+225,253,214,225,1,14,254,176,254,176,47,109,44,143,137,88,149,85,1,76,143,
+93,137,152,154,27,1,31,1,47,170,237,205,227,1,11,254,172,254,207,254,83,254,
+83,11,3,232,146,155,72,127,68,95,176,103,178,0,0,3,0,94,255,227,1,145,4,110,
+0,19,0,39,0,40,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,17,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,39,147,20,34,46,27,26,47,34,20,20,34,47,
+26,27,46,34,20,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,53,111,38,
+53,33,15,15,33,53,38,37,53,34,16,16,34,53,3,145,39,53,33,14,14,33,53,39,37,
+52,34,16,16,34,52,184,0,0,4,0,63,254,248,1,145,4,110,0,12,0,32,0,33,0,34,
+0,0,37,23,14,3,7,35,62,3,55,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,39,
+17,1,106,15,14,39,47,51,25,138,15,29,27,22,8,17,20,34,46,27,26,47,34,20,20,
+34,47,26,27,46,34,20,53,238,23,54,122,124,123,56,61,132,131,125,53,2,237,
+39,53,33,14,14,33,53,39,37,52,34,16,16,34,52,184,251,146,0,0,3,0,103,0,0,
+4,44,5,183,0,6,0,7,0,8,0,0,37,1,53,1,21,9,2,19,4,44,252,59,3,197,252,252,
+3,4,254,24,11,238,1,168,102,1,225,160,254,148,254,188,254,115,5,183,0,4,0,
+116,0,0,4,30,5,183,0,3,0,7,0,8,0,9,0,0,19,53,33,21,1,53,33,21,1,19,116,3,
+170,252,86,3,170,254,38,11,3,84,145,145,254,104,146,146,254,68,5,183,0,3,
+0,103,0,0,4,44,5,183,0,6,0,7,0,8,0,0,19,1,1,53,1,21,1,5,19,103,3,4,252,252,
+3,197,252,59,1,221,11,1,141,1,66,1,110,160,254,31,102,254,88,238,5,183,0,
+2,0,77,255,227,3,77,5,203,0,39,0,59,0,0,1,53,52,62,2,55,62,3,53,52,46,2,35,
+34,6,7,39,54,54,51,50,30,2,21,20,14,2,7,14,3,21,21,3,52,62,2,51,50,30,2,21,
+20,14,2,35,34,46,2,1,65,15,39,66,50,48,68,43,21,30,57,85,56,83,150,70,63,
+81,188,97,93,149,104,56,27,54,80,54,52,66,38,14,187,20,34,46,27,26,47,34,
+20,20,34,47,26,27,46,34,20,1,158,37,57,92,80,77,42,41,67,69,79,53,48,79,57,
+31,52,34,145,42,59,51,96,139,87,67,105,90,84,47,45,67,63,66,44,18,254,209,
+38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,5,0,164,253,78,2,57,6,190,
+0,7,0,8,0,9,0,10,0,11,0,0,1,33,17,33,21,35,17,51,11,2,19,2,57,254,107,1,149,
+223,223,118,10,51,22,254,12,8,90,139,248,189,7,31,1,7,249,66,253,78,0,5,0,
+41,253,78,2,251,6,190,0,3,0,4,0,5,0,6,0,7,0,0,19,1,35,1,5,3,3,19,219,2,32,
+178,253,224,1,154,10,51,22,6,102,247,166,8,90,175,1,7,249,66,253,78,0,5,0,
+81,253,78,1,231,6,190,0,7,0,8,0,9,0,10,0,11,0,0,19,51,17,35,53,33,17,33,19,
+3,3,19,81,223,223,1,150,254,106,170,10,51,22,254,152,7,67,139,247,166,7,171,
+1,7,249,66,253,78,0,1,0,81,2,37,4,65,5,193,0,6,0,0,19,1,51,1,35,1,1,81,1,
+203,102,1,191,161,254,175,254,163,2,37,3,156,252,100,2,223,253,33,0,3,255,
+252,253,78,3,145,0,0,0,3,0,4,0,5,0,0,1,33,53,33,37,19,3,145,252,107,3,149,
+253,130,2,254,197,131,184,253,78,0,0,5,0,62,253,78,2,163,6,190,0,41,0,42,
+0,43,0,44,0,45,0,0,1,20,6,7,21,22,22,21,17,20,30,2,23,21,46,3,53,17,52,46,
+2,35,53,50,54,53,17,52,62,2,55,21,14,3,21,39,3,3,19,1,245,119,115,115,119,
+24,45,65,40,77,131,95,54,33,65,96,62,125,131,54,95,131,77,40,65,45,24,250,
+10,51,22,3,114,131,151,25,12,25,152,130,254,101,60,75,44,16,1,149,1,40,87,
+133,95,1,149,63,88,55,24,155,105,125,1,150,95,133,87,40,1,150,1,16,44,75,
+60,171,1,7,249,66,253,78,0,5,1,134,253,78,2,127,6,190,0,3,0,4,0,5,0,6,0,7,
+0,0,1,51,17,35,11,2,19,1,233,150,150,38,10,51,22,6,103,247,165,7,171,1,7,
+249,66,253,78,0,0,5,0,82,253,78,2,183,6,190,0,41,0,42,0,43,0,44,0,45,0,0,
+1,52,54,55,53,38,38,53,17,52,46,2,39,53,30,3,21,17,20,30,2,51,21,34,6,21,
+17,20,14,2,7,53,62,3,53,19,3,19,19,1,0,119,115,115,119,24,45,65,40,77,131,
+95,54,33,65,96,62,125,131,54,95,131,77,40,65,45,24,195,10,49,22,1,0,131,151,
+25,12,25,152,130,1,155,60,75,44,16,1,149,1,40,87,133,95,254,107,63,88,55,
+24,155,105,125,254,106,95,133,87,40,1,150,1,16,44,75,60,6,81,1,7,249,66,253,
+78,0,0,1,0,103,2,76,4,44,3,88,0,36,0,0,1,46,3,35,34,14,2,7,53,54,51,50,30,
+2,23,30,3,51,50,62,2,55,21,6,6,35,34,46,2,2,40,37,60,51,45,22,29,61,61,58,
+25,100,146,29,57,63,74,47,37,60,51,44,21,30,63,61,57,25,50,121,75,29,57,64,
+74,2,141,16,22,13,5,19,33,44,25,160,108,5,15,25,20,16,22,13,5,19,32,44,26,
+158,54,56,5,15,25,0,255,255,0,82,0,0,2,66,4,110,2,6,1,4,0,0,0,3,0,82,0,0,
+3,174,4,110,0,3,0,4,0,5,0,0,19,53,33,21,1,17,82,3,92,253,150,1,209,168,168,
+2,157,251,146,0,0,3,0,82,0,0,7,174,4,110,0,3,0,4,0,5,0,0,19,53,33,21,1,17,
+82,7,92,249,150,1,209,168,168,2,157,251,146,0,0,3,0,73,4,113,1,130,6,190,
+0,12,0,13,0,14,0,0,19,39,62,3,55,51,14,3,7,3,3,87,14,14,39,46,52,25,137,15,
+29,26,22,8,155,10,4,113,22,54,122,124,123,56,61,132,131,124,53,1,70,1,7,0,
+0,3,0,73,4,113,1,155,6,190,0,12,0,13,0,14,0,0,1,23,14,3,7,35,62,3,55,23,3,
+1,116,14,14,39,47,51,25,137,14,29,27,22,8,238,10,6,102,22,55,121,125,122,
+56,60,132,132,124,53,175,1,7,0,0,4,0,73,4,113,3,3,6,190,0,12,0,25,0,26,0,
+27,0,0,1,39,62,3,55,51,14,3,7,33,39,62,3,55,51,14,3,7,19,3,1,216,14,14,39,
+46,52,25,137,15,29,26,22,8,253,184,14,14,39,46,52,25,137,15,29,26,22,8,165,
+10,4,113,22,54,122,124,123,56,61,132,131,124,53,22,54,122,124,123,56,61,132,
+131,124,53,1,70,1,7,0,4,0,73,4,113,3,3,6,190,0,12,0,25,0,26,0,27,0,0,1,23,
+14,3,7,35,62,3,55,33,23,14,3,7,35,62,3,55,7,3,1,116,14,14,39,47,51,25,137,
+14,29,27,22,8,2,72,14,14,39,47,51,25,137,14,29,27,22,8,107,10,6,102,22,55,
+121,125,122,56,60,132,132,124,53,22,55,121,125,122,56,60,132,132,124,53,175,
+1,7,0,0,3,0,147,255,227,5,219,0,250,0,19,0,39,0,57,0,0,55,52,62,2,51,50,30,
+2,21,20,14,2,35,34,46,2,37,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,37,52,
+62,2,51,50,30,2,21,20,14,2,35,34,38,147,20,34,46,27,26,47,34,20,20,34,47,
+26,27,46,34,20,2,37,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,2,37,
+19,35,46,27,26,47,34,20,20,34,47,26,54,73,111,38,53,33,15,15,33,53,38,37,
+53,34,16,16,34,53,37,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,37,38,53,
+33,15,15,33,53,38,37,53,34,16,66,0,3,0,133,0,0,4,14,5,183,0,11,0,12,0,13,
+0,0,1,1,23,1,1,7,1,1,39,1,1,55,1,19,2,74,1,94,102,254,164,1,90,102,254,162,
+254,170,107,1,90,254,164,107,1,84,11,3,57,1,95,105,254,164,254,164,105,1,
+90,254,166,105,1,92,1,90,107,251,104,5,183,0,0,5,0,104,0,0,4,44,5,183,0,10,
+0,14,0,25,0,26,0,27,0,0,1,50,22,21,6,6,35,34,38,53,52,1,53,33,21,5,50,22,
+21,20,6,35,34,38,53,52,19,19,2,73,54,59,1,61,51,53,62,254,146,3,196,254,29,
+54,59,61,52,55,60,110,11,4,170,62,61,61,64,65,60,123,253,223,146,146,153,
+62,61,60,65,65,60,123,254,16,5,183,0,3,0,103,0,0,4,44,5,183,0,3,0,4,0,5,0,
+0,19,53,33,21,1,19,103,3,197,254,24,11,2,137,146,146,253,119,5,183,0,1,0,
+147,0,0,4,27,5,182,0,34,0,0,1,14,3,7,1,35,1,55,51,50,62,3,55,33,53,33,46,
+3,35,35,53,33,21,33,22,22,23,33,21,2,220,3,52,94,134,87,1,187,228,254,82,
+21,74,54,79,59,53,49,10,254,113,1,142,9,36,55,89,78,131,3,136,254,102,34,
+45,10,1,65,3,188,75,127,99,66,14,253,193,2,55,158,10,20,41,86,74,148,52,77,
+53,28,148,148,36,105,69,148,0,3,1,104,255,156,2,116,4,210,0,3,0,4,0,5,0,0,
+5,17,51,17,19,3,1,104,177,91,11,100,5,54,250,202,4,210,251,146,0,4,1,104,
+255,156,3,219,4,210,0,3,0,7,0,8,0,9,0,0,5,17,51,17,33,17,51,17,1,19,1,104,
+177,1,17,177,254,184,25,100,5,54,250,202,5,54,250,202,4,210,251,146,0,3,252,
+194,5,41,254,6,6,190,0,11,0,12,0,13,0,0,1,50,22,21,20,6,35,34,38,53,52,54,
+39,3,253,156,48,58,58,48,49,58,58,156,13,6,14,60,55,53,61,60,54,56,59,176,
+254,248,0,3,252,177,253,78,254,6,0,0,0,11,0,12,0,13,0,0,5,50,22,21,20,6,35,
+34,38,53,52,54,39,19,253,156,48,58,58,48,49,58,58,186,4,163,60,55,53,61,60,
+54,56,59,163,253,78,0,255,255,0,80,255,233,6,221,6,190,2,38,0,22,0,0,0,3,
+1,46,5,250,0,0,255,255,0,80,253,78,6,221,4,138,2,38,0,22,0,0,0,3,1,47,5,250,
+0,0,255,255,0,80,255,232,6,249,6,190,2,38,0,38,0,0,0,3,1,46,6,8,0,0,255,255,
+0,80,253,78,6,249,4,138,2,38,0,38,0,0,0,3,1,47,6,8,0,0,255,255,0,80,255,239,
+8,139,6,191,0,38,0,39,0,0,0,35,1,46,6,8,0,0,0,3,0,60,7,73,0,0,255,255,0,80,
+253,78,8,139,6,191,0,38,0,39,0,0,0,35,1,47,6,8,0,0,0,3,0,60,7,73,0,0,255,
+255,0,65,255,242,6,154,6,190,2,38,0,41,0,0,0,3,1,46,5,249,0,0,255,255,0,65,
+253,78,6,154,4,138,2,38,0,41,0,0,0,3,1,47,5,249,0,0,255,255,0,125,0,0,5,80,
+6,190,2,38,0,45,0,0,0,3,1,46,5,74,0,0,255,255,0,125,253,78,5,80,4,138,2,38,
+0,45,0,0,0,3,1,47,5,74,0,0,255,255,0,80,255,232,7,37,6,191,0,38,0,47,0,0,
+0,35,1,46,5,85,0,0,0,3,0,60,5,227,0,0,255,255,0,80,253,78,7,37,6,191,0,38,
+0,47,0,0,0,35,1,47,5,85,0,0,0,3,0,60,5,227,0,0,255,255,0,80,255,232,9,121,
+6,190,2,38,0,55,0,0,0,3,1,46,7,72,0,0,255,255,0,80,253,78,9,121,4,138,2,38,
+0,55,0,0,0,3,1,47,7,72,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,
+1,4,9,0,1,0,38,0,94,0,3,0,1,4,9,0,2,0,14,0,132,0,3,0,1,4,9,0,3,0,76,0,146,
+0,3,0,1,4,9,0,4,0,38,0,94,0,3,0,1,4,9,0,5,0,30,0,222,0,3,0,1,4,9,0,6,0,34,
+0,252,0,3,0,1,4,9,0,7,0,68,1,30,0,3,0,1,4,9,0,8,0,42,1,98,0,3,0,1,4,9,0,9,
+0,40,1,140,0,3,0,1,4,9,0,10,0,96,1,180,0,3,0,1,4,9,0,11,0,62,2,20,0,3,0,1,
+4,9,0,12,0,60,2,82,0,3,0,1,4,9,0,13,2,150,2,142,0,3,0,1,4,9,0,14,0,52,5,36,
+0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,
+0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,
+0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,
+0,97,0,110,0,115,0,32,0,77,0,97,0,108,0,97,0,121,0,97,0,108,0,97,0,109,0,
+82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,
+78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,77,0,97,0,108,0,97,
+0,121,0,97,0,108,0,97,0,109,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,
+0,115,0,77,0,97,0,108,0,97,0,121,0,97,0,108,0,97,0,109,0,78,0,111,0,116,0,
+111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,
+97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,
+0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,
+104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,
+0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,
+0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,
+0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,
+0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,0,0,0,0,0,106,0,2,0,15,0,4,0,71,0,1,0,72,0,73,0,3,0,74,0,
+76,0,1,0,77,0,78,0,3,0,96,0,101,0,1,0,105,0,105,0,1,0,106,0,142,0,2,0,143,
+0,143,0,3,0,144,0,220,0,2,0,221,0,228,0,1,0,229,0,231,0,2,0,232,0,233,0,1,
+0,234,0,249,0,2,1,46,1,47,0,3,1,48,1,61,0,2,0,1,0,72,0,7,0,2,0,1,0,0,0,0,
+0,0,0,2,0,2,0,0,0,1,0,0,0,10,0,84,0,112,0,2,109,108,109,50,0,14,109,108,121,
+109,0,24,0,20,0,1,77,65,76,32,0,30,0,30,0,1,77,65,76,32,0,40,0,0,255,255,
+0,2,0,0,0,1,0,0,255,255,0,2,0,0,0,1,0,0,255,255,0,2,0,0,0,1,0,0,255,255,0,
+2,0,0,0,1,0,2,97,98,118,109,0,14,100,105,115,116,0,20,0,0,0,1,0,6,0,0,0,2,
+0,0,0,1,0,7,0,16,6,180,7,168,7,190,7,212,7,250,8,32,0,2,0,8,0,1,0,8,0,1,0,
+148,0,4,0,0,0,69,1,34,1,44,1,54,1,64,1,74,1,84,1,94,1,104,1,114,1,124,1,134,
+1,144,1,154,1,164,1,174,1,184,1,194,1,204,1,222,1,232,1,242,1,252,2,6,2,24,
+2,42,2,60,2,94,2,104,4,42,4,52,4,62,4,88,4,106,4,132,4,142,4,152,4,162,4,
+172,4,182,4,192,4,202,4,228,4,254,5,8,5,18,5,28,5,38,5,48,5,74,5,84,5,94,
+5,104,5,130,5,140,5,158,5,168,5,194,5,220,5,238,5,248,6,18,6,24,6,50,6,76,
+6,86,6,100,6,114,6,124,6,150,0,1,0,69,0,20,0,22,0,26,0,27,0,28,0,29,0,31,
+0,32,0,33,0,34,0,35,0,38,0,39,0,40,0,46,0,47,0,48,0,50,0,51,0,53,0,55,0,56,
+0,57,0,62,0,63,0,144,0,145,0,146,0,147,0,148,0,149,0,150,0,152,0,155,0,157,
+0,161,0,162,0,164,0,165,0,166,0,167,0,168,0,170,0,171,0,175,0,178,0,179,0,
+182,0,183,0,185,0,186,0,188,0,189,0,195,0,201,0,202,0,203,0,206,0,210,0,211,
+0,212,0,213,0,217,0,219,0,225,0,226,0,227,0,229,0,231,0,2,0,60,255,246,0,
+61,255,246,0,2,0,62,255,181,0,63,255,181,0,2,0,62,255,216,0,63,255,216,0,
+2,0,62,255,216,0,63,255,216,0,2,0,62,255,196,0,63,255,196,0,2,0,62,255,181,
+0,63,255,181,0,2,0,62,255,196,0,63,255,196,0,2,0,62,255,196,0,63,255,196,
+0,2,0,62,255,186,0,63,255,186,0,2,0,62,255,181,0,63,255,181,0,2,0,62,255,
+181,0,63,255,181,0,2,0,62,255,196,0,63,255,196,0,2,0,62,255,181,0,63,255,
+181,0,2,0,62,255,181,0,63,255,181,0,2,0,62,255,186,0,63,255,186,0,2,0,62,
+255,216,0,63,255,216,0,2,0,62,255,196,0,63,255,196,0,4,0,225,255,231,0,226,
+255,231,0,227,255,106,0,228,255,56,0,2,0,62,255,196,0,63,255,196,0,2,0,62,
+255,216,0,63,255,216,0,2,0,62,255,196,0,63,255,196,0,2,0,62,255,196,0,63,
+255,196,0,4,0,62,0,80,0,63,0,80,0,64,0,80,0,65,0,120,0,4,0,4,255,236,0,5,
+255,236,0,62,0,110,0,63,0,110,0,4,0,4,255,236,0,5,255,236,0,62,0,110,0,63,
+0,110,0,8,0,225,0,90,0,226,0,90,0,227,0,81,0,228,255,156,0,229,0,100,0,230,
+0,80,0,232,255,146,0,233,255,146,0,2,0,232,255,186,0,233,255,186,0,112,0,
+20,255,166,0,21,255,226,0,22,255,246,0,23,0,15,0,24,255,231,0,25,255,186,
+0,26,255,186,0,28,255,232,0,29,255,231,0,30,0,20,0,31,255,236,0,34,255,231,
+0,35,255,232,0,37,255,199,0,38,255,246,0,40,255,226,0,41,255,177,0,42,255,
+177,0,43,255,226,0,44,255,199,0,45,255,204,0,47,255,232,0,48,255,236,0,49,
+255,241,0,51,0,25,0,52,255,236,0,53,255,246,0,54,255,177,0,56,255,177,0,96,
+255,241,0,98,255,232,0,99,255,232,0,100,255,246,0,101,255,166,0,106,255,166,
+0,107,255,226,0,108,255,246,0,109,0,15,0,110,255,231,0,111,255,186,0,112,
+255,186,0,114,255,232,0,115,255,231,0,116,0,20,0,117,255,236,0,120,255,231,
+0,121,255,232,0,123,255,199,0,124,255,246,0,126,255,177,0,127,255,177,0,128,
+255,231,0,129,255,199,0,130,255,204,0,132,255,232,0,133,255,236,0,134,255,
+241,0,136,0,25,0,137,255,236,0,138,255,246,0,139,255,177,0,141,255,177,0,
+142,255,166,0,147,255,166,0,148,255,166,0,149,255,166,0,150,255,166,0,151,
+255,166,0,152,255,246,0,153,255,246,0,154,255,246,0,155,255,246,0,156,255,
+246,0,157,0,25,0,158,255,222,0,159,255,186,0,163,255,231,0,164,255,231,0,
+165,255,231,0,166,255,231,0,170,255,231,0,171,255,231,0,172,255,231,0,173,
+255,231,0,174,255,231,0,175,255,232,0,176,255,232,0,177,255,232,0,178,255,
+232,0,179,255,232,0,180,255,232,0,181,255,232,0,183,255,201,0,191,255,196,
+0,193,255,177,0,194,255,231,0,195,255,231,0,196,255,231,0,197,255,231,0,198,
+255,204,0,204,255,241,0,205,0,69,0,207,255,236,0,208,255,236,0,209,255,246,
+0,210,255,246,0,211,255,246,0,212,255,246,0,213,255,177,0,218,255,177,0,219,
+255,177,0,220,255,177,0,2,0,62,255,181,0,63,255,181,0,2,0,62,255,181,0,63,
+255,181,0,6,0,60,255,246,0,61,255,246,0,227,255,176,0,228,255,166,0,229,255,
+166,0,230,255,156,0,4,0,60,255,246,0,61,255,246,0,225,0,22,0,226,0,22,0,6,
+0,225,255,216,0,226,255,216,0,227,255,216,0,228,255,216,0,229,255,226,0,230,
+255,216,0,2,0,62,255,181,0,63,255,181,0,2,0,60,255,246,0,61,255,246,0,2,0,
+62,255,216,0,63,255,216,0,2,0,62,255,181,0,63,255,181,0,2,0,62,255,216,0,
+63,255,216,0,2,0,62,255,216,0,63,255,216,0,2,0,62,255,181,0,63,255,181,0,
+6,0,225,0,54,0,226,0,54,0,227,0,30,0,228,0,40,0,229,0,50,0,230,0,30,0,6,0,
+225,0,15,0,226,0,15,0,227,0,20,0,228,0,20,0,229,0,30,0,230,0,20,0,2,0,62,
+255,196,0,63,255,196,0,2,0,62,255,186,0,63,255,186,0,2,0,62,255,181,0,63,
+255,181,0,2,0,62,255,196,0,63,255,196,0,2,0,62,255,181,0,63,255,181,0,6,0,
+225,0,54,0,226,0,54,0,227,0,30,0,228,0,40,0,229,0,60,0,230,0,40,0,2,0,62,
+255,196,0,63,255,196,0,2,0,62,255,196,0,63,255,196,0,2,0,62,255,181,0,63,
+255,181,0,6,0,225,0,25,0,226,0,25,0,227,0,40,0,228,0,40,0,229,0,40,0,230,
+0,20,0,2,0,62,255,181,0,63,255,181,0,4,0,227,255,216,0,228,255,216,0,229,
+255,226,0,230,255,216,0,2,0,225,0,26,0,226,0,26,0,6,0,225,255,166,0,226,255,
+166,0,227,255,126,0,228,255,146,0,229,255,136,0,230,255,136,0,6,0,225,255,
+186,0,226,255,186,0,227,255,146,0,228,255,146,0,229,255,146,0,230,255,133,
+0,4,0,225,255,231,0,226,255,231,0,227,255,106,0,228,255,56,0,2,0,62,255,216,
+0,63,255,216,0,6,0,225,255,206,0,226,255,206,0,227,255,216,0,228,255,216,
+0,229,255,210,0,230,255,196,0,1,0,230,255,236,0,6,0,225,255,236,0,226,255,
+236,0,227,255,206,0,228,255,206,0,229,255,206,0,230,255,186,0,6,0,225,255,
+186,0,226,255,186,0,227,255,196,0,228,255,196,0,229,255,206,0,230,255,176,
+0,2,0,62,255,181,0,63,255,181,0,3,0,4,255,236,0,62,0,110,0,63,0,110,0,3,0,
+4,255,236,0,62,0,110,0,63,0,110,0,2,0,225,0,100,0,226,0,100,0,6,0,225,0,90,
+0,226,0,90,0,227,0,81,0,228,255,156,0,229,0,100,0,230,0,80,0,1,0,205,255,
+196,0,8,0,0,0,1,0,8,0,2,0,18,0,42,0,70,0,128,0,3,0,0,0,174,0,214,0,1,0,10,
+0,72,0,250,0,251,0,254,1,0,1,22,1,25,1,30,1,36,1,38,0,2,0,4,0,72,0,72,0,2,
+0,96,0,100,0,1,0,106,0,142,0,2,0,188,0,188,0,1,0,2,0,9,0,72,0,72,0,1,0,250,
+0,251,0,2,0,254,0,254,0,2,1,0,1,0,0,2,1,22,1,22,0,2,1,25,1,25,0,2,1,30,1,
+30,0,2,1,36,1,36,0,2,1,38,1,38,0,2,0,2,0,7,0,6,0,57,0,1,0,66,0,67,0,1,0,96,
+0,101,0,1,0,105,0,142,0,1,0,146,0,220,0,1,0,231,0,231,0,1,0,234,0,249,0,1,
+0,2,0,6,0,22,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,2,0,1,0,1,0,1,0,0,0,2,0,0,0,2,
+0,0,0,3,0,1,0,4,0,1,0,2,0,1,0,0,0,2,0,0,0,4,0,0,0,5,0,1,0,0,0,1,0,8,0,1,0,
+8,0,1,1,124,0,1,0,1,0,72,0,1,0,0,0,1,0,8,0,1,0,8,0,4,1,124,0,1,0,1,0,72,0,
+1,0,0,0,1,0,8,0,1,0,8,0,1,0,150,0,1,0,9,0,250,0,251,0,254,1,0,1,22,1,25,1,
+30,1,36,1,38,0,1,0,0,0,1,0,8,0,1,0,8,0,4,0,150,0,1,0,9,0,250,0,251,0,254,
+1,0,1,22,1,25,1,30,1,36,1,38,0,4,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,52,0,64,
+0,1,0,1,0,73,0,2,0,5,0,6,0,57,0,0,0,96,0,101,0,52,0,105,0,142,0,58,0,147,
+0,220,0,96,0,234,0,249,0,170,0,1,0,0,0,6,0,1,3,114,0,0,0,186,1,118,1,124,
+1,130,1,136,1,142,1,148,1,154,1,160,1,166,1,172,1,178,1,184,1,190,1,196,1,
+202,1,208,1,214,1,220,1,226,1,232,1,238,1,244,1,250,2,0,2,6,2,12,2,18,2,24,
+2,30,2,36,2,42,2,48,2,54,2,60,2,66,2,72,2,78,2,84,2,90,2,96,2,102,2,108,2,
+114,2,120,2,126,2,132,2,138,2,144,2,150,2,156,2,162,2,168,2,174,2,180,2,186,
+2,192,2,198,2,204,2,210,2,216,2,222,2,228,2,234,2,240,2,246,2,252,3,2,3,8,
+3,14,3,20,3,26,3,32,3,38,3,44,3,50,3,56,3,62,3,68,3,74,3,80,3,86,3,92,3,98,
+3,104,3,110,3,116,3,122,3,128,3,134,3,140,3,146,3,152,3,158,3,164,3,170,3,
+176,3,182,3,188,3,194,3,200,3,206,3,212,3,218,3,224,3,230,3,236,3,242,3,248,
+3,254,4,4,4,10,4,16,4,22,4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,
+4,88,4,94,4,100,4,106,4,112,4,118,4,124,4,130,4,136,4,142,4,148,4,154,4,160,
+4,166,4,172,4,178,4,184,4,190,4,196,4,202,4,208,4,214,4,220,4,226,4,232,4,
+238,4,244,4,250,5,0,5,6,5,12,5,18,5,24,5,30,5,36,5,42,5,48,5,54,5,60,5,66,
+5,72,5,78,5,84,5,90,5,96,5,102,5,108,5,114,5,120,5,126,5,132,5,138,5,144,
+5,150,5,156,5,162,5,168,5,174,5,180,5,186,5,192,5,198,5,204,0,1,5,249,0,0,
+0,1,6,150,0,0,0,1,3,241,0,0,0,1,6,251,0,0,0,1,2,196,0,0,0,1,5,206,0,0,0,1,
+3,124,0,0,0,1,4,170,0,0,0,1,5,24,0,0,0,1,5,22,0,0,0,1,7,244,0,0,0,1,2,250,
+0,0,0,1,4,254,0,0,0,1,6,0,0,0,0,1,4,38,0,0,0,1,3,255,0,0,0,1,3,150,0,0,0,
+1,5,77,0,0,0,1,4,63,0,0,0,1,3,187,0,0,0,1,5,101,0,0,0,1,3,193,0,0,0,1,6,158,
+0,0,0,1,5,200,0,0,0,1,2,64,0,0,0,1,2,159,0,0,0,1,4,228,0,0,0,1,5,86,0,0,0,
+1,5,121,0,0,0,1,4,14,0,0,0,1,3,149,0,0,0,1,2,143,0,0,0,1,3,164,0,0,0,1,3,
+164,0,0,0,1,4,22,0,0,0,1,3,149,0,0,0,1,4,132,0,0,0,1,5,57,0,0,0,1,2,159,0,
+0,0,1,2,230,0,0,0,1,4,36,0,0,0,1,2,241,0,0,0,1,2,178,0,0,0,1,3,111,0,0,0,
+1,2,221,0,0,0,1,2,158,0,0,0,1,3,213,0,0,0,1,4,41,0,0,0,1,4,153,0,0,0,1,4,
+228,0,0,0,1,4,194,0,0,0,1,3,24,0,0,0,1,6,19,0,0,0,1,4,62,0,0,0,1,2,241,0,
+0,0,1,4,203,0,0,0,1,4,45,0,0,0,1,4,211,0,0,0,1,2,80,0,0,0,1,4,38,0,0,0,1,
+3,255,0,0,0,1,3,150,0,0,0,1,5,77,0,0,0,1,4,63,0,0,0,1,3,187,0,0,0,1,5,101,
+0,0,0,1,3,193,0,0,0,1,6,158,0,0,0,1,5,200,0,0,0,1,2,64,0,0,0,1,2,159,0,0,
+0,1,4,228,0,0,0,1,5,86,0,0,0,1,5,121,0,0,0,1,4,14,0,0,0,1,3,149,0,0,0,1,2,
+143,0,0,0,1,3,164,0,0,0,1,3,164,0,0,0,1,3,149,0,0,0,1,4,132,0,0,0,1,5,57,
+0,0,0,1,2,159,0,0,0,1,2,230,0,0,0,1,4,36,0,0,0,1,2,241,0,0,0,1,2,178,0,0,
+0,1,3,111,0,0,0,1,2,221,0,0,0,1,2,158,0,0,0,1,3,213,0,0,0,1,4,41,0,0,0,1,
+4,153,0,0,0,1,4,228,0,0,0,1,4,194,0,0,0,1,6,201,0,0,0,1,6,6,0,0,0,1,7,61,
+0,0,0,1,4,38,0,0,0,1,4,38,0,0,0,1,6,201,0,0,0,1,3,150,0,0,0,1,3,185,0,0,0,
+1,5,158,0,0,0,1,4,244,0,0,0,1,3,150,0,0,0,1,4,60,0,0,0,1,6,28,0,0,0,1,3,187,
+0,0,0,1,3,187,0,0,0,1,7,148,0,0,0,1,9,125,0,0,0,1,6,140,0,0,0,1,8,145,0,0,
+0,1,6,154,0,0,0,1,8,196,0,0,0,1,2,64,0,0,0,1,4,228,0,0,0,1,4,228,0,0,0,1,
+8,11,0,0,0,1,8,120,0,0,0,1,6,34,0,0,0,1,5,121,0,0,0,1,5,217,0,0,0,1,5,87,
+0,0,0,1,5,175,0,0,0,1,6,0,0,0,0,1,6,151,0,0,0,1,7,9,0,0,0,1,6,188,0,0,0,1,
+4,14,0,0,0,1,2,143,0,0,0,1,4,190,0,0,0,1,3,206,0,0,0,1,6,52,0,0,0,1,5,7,0,
+0,0,1,4,78,0,0,0,1,4,62,0,0,0,1,5,87,0,0,0,1,6,82,0,0,0,1,3,150,0,0,0,1,3,
+149,0,0,0,1,4,132,0,0,0,1,5,57,0,0,0,1,5,57,0,0,0,1,5,57,0,0,0,1,5,57,0,0,
+0,1,4,247,0,0,0,1,4,199,0,0,0,1,4,199,0,0,0,1,2,230,0,0,0,1,4,36,0,0,0,1,
+2,178,0,0,0,1,3,111,0,0,0,1,3,111,0,0,0,1,5,173,0,0,0,1,3,213,0,0,0,1,3,213,
+0,0,0,1,6,12,0,0,0,1,8,18,0,0,0,1,4,41,0,0,0,1,4,41,0,0,0,1,4,153,0,0,0,1,
+4,228,0,0,0,1,4,228,0,0,0,1,7,144,0,0,0,1,4,228,0,0,0,1,4,243,0,0,0,1,5,180,
+0,0,0,1,4,194,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,
+3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,
+0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,0,0,0,1,3,45,
+0,0,0,0,0,1,0,0,0,10,0,116,1,44,0,2,109,108,109,50,0,14,109,108,121,109,0,
+24,0,20,0,1,77,65,76,32,0,36,0,42,0,1,77,65,76,32,0,62,0,0,255,255,0,5,0,
+0,0,7,0,8,0,10,0,12,0,0,255,255,0,5,0,1,0,7,0,8,0,10,0,12,0,0,255,255,0,7,
+0,2,0,5,0,4,0,9,0,11,0,6,0,12,0,0,255,255,0,7,0,3,0,5,0,4,0,9,0,11,0,6,0,
+12,0,13,97,107,104,110,0,80,97,107,104,110,0,86,97,107,104,110,0,92,97,107,
+104,110,0,98,98,108,119,102,0,104,104,97,108,102,0,112,104,97,108,110,0,118,
+112,114,101,102,0,124,112,115,116,102,0,132,112,115,116,102,0,140,112,115,
+116,115,0,146,112,115,116,115,0,160,114,108,105,103,0,178,0,0,0,1,0,0,0,0,
+0,1,0,1,0,0,0,1,0,2,0,0,0,1,0,3,0,0,0,2,0,7,0,8,0,0,0,1,0,6,0,0,0,1,0,29,
+0,0,0,2,0,4,0,5,0,0,0,2,0,9,0,10,0,0,0,1,0,11,0,0,0,5,0,17,0,21,0,22,0,25,
+0,28,0,0,0,7,0,12,0,13,0,19,0,21,0,23,0,25,0,28,0,0,0,1,0,28,0,30,0,62,4,
+160,9,22,13,94,17,186,17,218,18,18,20,46,20,78,20,106,20,146,20,186,20,246,
+21,72,21,134,21,160,21,186,21,224,22,212,24,128,25,116,26,222,27,160,28,2,
+28,154,28,174,29,222,29,248,30,48,31,12,0,4,0,0,0,1,0,8,0,1,4,32,0,27,0,60,
+0,124,0,202,0,224,0,246,1,12,1,56,1,68,1,90,1,154,1,238,2,4,2,110,2,132,2,
+144,2,190,2,236,2,248,3,4,3,16,3,60,3,82,3,104,3,148,3,162,3,220,4,20,0,6,
+0,14,0,22,0,30,0,38,0,46,0,54,0,147,0,3,0,72,0,20,0,148,0,3,0,72,0,35,0,150,
+0,3,0,72,0,49,0,151,0,3,0,72,0,54,0,101,0,3,0,72,0,104,0,149,0,4,0,104,0,
+72,0,30,0,7,0,16,0,24,0,32,0,40,0,48,0,58,0,68,0,152,0,3,0,72,0,22,0,155,
+0,3,0,72,0,39,0,154,0,3,0,72,0,45,0,156,0,3,0,72,0,49,0,153,0,4,0,104,0,72,
+0,37,0,155,0,4,0,104,0,72,0,39,0,154,0,4,0,104,0,72,0,45,0,2,0,6,0,14,0,157,
+0,3,0,72,0,20,0,158,0,3,0,72,0,24,0,2,0,6,0,14,0,159,0,3,0,72,0,25,0,160,
+0,3,0,72,0,26,0,2,0,6,0,14,0,161,0,3,0,72,0,27,0,162,0,3,0,72,0,29,0,4,0,
+10,0,18,0,26,0,34,0,163,0,3,0,72,0,25,0,165,0,3,0,72,0,27,0,166,0,3,0,72,
+0,29,0,164,0,4,0,104,0,72,0,26,0,1,0,4,0,167,0,3,0,72,0,30,0,2,0,6,0,14,0,
+168,0,3,0,72,0,32,0,169,0,3,0,72,0,33,0,6,0,14,0,22,0,30,0,38,0,46,0,54,0,
+174,0,3,0,72,0,30,0,170,0,3,0,72,0,32,0,173,0,3,0,72,0,34,0,172,0,3,0,72,
+0,45,0,96,0,3,0,72,0,104,0,171,0,4,0,104,0,72,0,33,0,8,0,18,0,26,0,34,0,42,
+0,50,0,58,0,66,0,74,0,179,0,3,0,72,0,35,0,180,0,3,0,72,0,36,0,175,0,3,0,72,
+0,39,0,176,0,3,0,72,0,44,0,177,0,3,0,72,0,45,0,181,0,3,0,72,0,49,0,178,0,
+3,0,72,0,55,0,176,0,4,0,104,0,72,0,44,0,2,0,6,0,14,0,182,0,3,0,72,0,37,0,
+183,0,3,0,72,0,38,0,10,0,22,0,30,0,38,0,46,0,54,0,62,0,70,0,78,0,88,0,96,
+0,189,0,3,0,72,0,35,0,190,0,3,0,72,0,36,0,184,0,3,0,72,0,37,0,185,0,3,0,72,
+0,38,0,186,0,3,0,72,0,39,0,187,0,3,0,72,0,45,0,188,0,3,0,72,0,48,0,188,0,
+4,0,72,0,104,0,48,0,97,0,3,0,72,0,104,0,190,0,4,0,104,0,72,0,36,0,2,0,6,0,
+14,0,191,0,3,0,72,0,41,0,192,0,3,0,72,0,49,0,1,0,4,0,193,0,3,0,72,0,49,0,
+4,0,10,0,18,0,26,0,36,0,194,0,3,0,72,0,43,0,197,0,3,0,72,0,49,0,195,0,4,0,
+104,0,72,0,37,0,196,0,4,0,104,0,72,0,38,0,4,0,10,0,22,0,30,0,38,0,200,0,5,
+0,72,0,41,0,72,0,49,0,199,0,3,0,72,0,41,0,198,0,3,0,72,0,45,0,201,0,3,0,72,
+0,49,0,1,0,4,0,202,0,3,0,72,0,46,0,1,0,4,0,98,0,3,0,72,0,104,0,1,0,4,0,203,
+0,3,0,72,0,48,0,4,0,10,0,18,0,26,0,34,0,204,0,3,0,72,0,41,0,205,0,3,0,72,
+0,49,0,99,0,3,0,72,0,104,0,204,0,4,0,104,0,72,0,41,0,2,0,6,0,14,0,206,0,3,
+0,72,0,50,0,100,0,3,0,72,0,104,0,2,0,6,0,14,0,207,0,3,0,72,0,49,0,208,0,3,
+0,72,0,52,0,4,0,10,0,18,0,26,0,34,0,209,0,3,0,72,0,25,0,212,0,3,0,72,0,49,
+0,211,0,3,0,72,0,53,0,210,0,4,0,104,0,72,0,26,0,1,0,4,0,213,0,4,0,104,0,72,
+0,30,0,5,0,12,0,20,0,32,0,40,0,48,0,216,0,3,0,72,0,36,0,214,0,5,0,72,0,48,
+0,72,0,48,0,217,0,3,0,72,0,49,0,215,0,3,0,72,0,55,0,216,0,4,0,104,0,72,0,
+36,0,5,0,12,0,20,0,28,0,36,0,46,0,219,0,3,0,72,0,39,0,218,0,3,0,72,0,45,0,
+220,0,3,0,72,0,49,0,219,0,4,0,104,0,72,0,39,0,218,0,4,0,104,0,72,0,45,0,1,
+0,4,0,188,0,3,0,72,0,48,0,1,0,27,0,20,0,22,0,24,0,25,0,27,0,29,0,30,0,32,
+0,34,0,35,0,37,0,39,0,41,0,42,0,43,0,45,0,46,0,47,0,48,0,49,0,50,0,52,0,53,
+0,54,0,55,0,56,0,97,0,4,0,0,0,1,0,8,0,1,4,52,0,27,0,60,0,134,0,222,0,244,
+1,10,1,32,1,76,1,88,1,110,1,174,2,2,2,24,2,130,2,152,2,164,2,210,3,0,3,12,
+3,24,3,36,3,80,3,102,3,124,3,168,3,182,3,240,4,40,0,7,0,16,0,24,0,32,0,40,
+0,48,0,56,0,64,0,147,0,3,0,72,0,20,0,149,0,3,0,72,0,30,0,148,0,3,0,72,0,35,
+0,150,0,3,0,72,0,49,0,151,0,3,0,72,0,54,0,101,0,3,0,72,0,104,0,149,0,4,0,
+104,0,72,0,30,0,8,0,18,0,26,0,34,0,42,0,50,0,58,0,68,0,78,0,152,0,3,0,72,
+0,22,0,153,0,3,0,72,0,37,0,155,0,3,0,72,0,39,0,154,0,3,0,72,0,45,0,156,0,
+3,0,72,0,49,0,153,0,4,0,104,0,72,0,37,0,155,0,4,0,104,0,72,0,39,0,154,0,4,
+0,104,0,72,0,45,0,2,0,6,0,14,0,157,0,3,0,72,0,20,0,158,0,3,0,72,0,24,0,2,
+0,6,0,14,0,159,0,3,0,72,0,25,0,160,0,3,0,72,0,26,0,2,0,6,0,14,0,161,0,3,0,
+72,0,27,0,162,0,3,0,72,0,29,0,4,0,10,0,18,0,26,0,34,0,163,0,3,0,72,0,25,0,
+165,0,3,0,72,0,27,0,166,0,3,0,72,0,29,0,164,0,4,0,104,0,72,0,26,0,1,0,4,0,
+167,0,3,0,72,0,30,0,2,0,6,0,14,0,168,0,3,0,72,0,32,0,169,0,3,0,72,0,33,0,
+6,0,14,0,22,0,30,0,38,0,46,0,54,0,174,0,3,0,72,0,30,0,170,0,3,0,72,0,32,0,
+173,0,3,0,72,0,34,0,172,0,3,0,72,0,45,0,96,0,3,0,72,0,104,0,171,0,4,0,104,
+0,72,0,33,0,8,0,18,0,26,0,34,0,42,0,50,0,58,0,66,0,74,0,179,0,3,0,72,0,35,
+0,180,0,3,0,72,0,36,0,175,0,3,0,72,0,39,0,176,0,3,0,72,0,44,0,177,0,3,0,72,
+0,45,0,181,0,3,0,72,0,49,0,178,0,3,0,72,0,55,0,176,0,4,0,104,0,72,0,44,0,
+2,0,6,0,14,0,182,0,3,0,72,0,37,0,183,0,3,0,72,0,38,0,10,0,22,0,30,0,38,0,
+46,0,54,0,62,0,70,0,78,0,88,0,96,0,189,0,3,0,72,0,35,0,190,0,3,0,72,0,36,
+0,184,0,3,0,72,0,37,0,185,0,3,0,72,0,38,0,186,0,3,0,72,0,39,0,187,0,3,0,72,
+0,45,0,188,0,3,0,72,0,48,0,188,0,4,0,72,0,104,0,48,0,97,0,3,0,72,0,104,0,
+190,0,4,0,104,0,72,0,36,0,2,0,6,0,14,0,191,0,3,0,72,0,41,0,192,0,3,0,72,0,
+49,0,1,0,4,0,193,0,3,0,72,0,49,0,4,0,10,0,18,0,26,0,36,0,194,0,3,0,72,0,43,
+0,197,0,3,0,72,0,49,0,195,0,4,0,104,0,72,0,37,0,196,0,4,0,104,0,72,0,38,0,
+4,0,10,0,22,0,30,0,38,0,200,0,5,0,72,0,41,0,72,0,49,0,199,0,3,0,72,0,41,0,
+198,0,3,0,72,0,45,0,201,0,3,0,72,0,49,0,1,0,4,0,202,0,3,0,72,0,46,0,1,0,4,
+0,98,0,3,0,72,0,104,0,1,0,4,0,203,0,3,0,72,0,48,0,4,0,10,0,18,0,26,0,34,0,
+204,0,3,0,72,0,41,0,205,0,3,0,72,0,49,0,99,0,3,0,72,0,104,0,204,0,4,0,104,
+0,72,0,41,0,2,0,6,0,14,0,206,0,3,0,72,0,50,0,100,0,3,0,72,0,104,0,2,0,6,0,
+14,0,207,0,3,0,72,0,49,0,208,0,3,0,72,0,52,0,4,0,10,0,18,0,26,0,34,0,209,
+0,3,0,72,0,25,0,212,0,3,0,72,0,49,0,211,0,3,0,72,0,53,0,210,0,4,0,104,0,72,
+0,26,0,1,0,4,0,213,0,4,0,104,0,72,0,30,0,5,0,12,0,20,0,32,0,40,0,48,0,216,
+0,3,0,72,0,36,0,214,0,5,0,72,0,48,0,72,0,48,0,217,0,3,0,72,0,49,0,215,0,3,
+0,72,0,55,0,216,0,4,0,104,0,72,0,36,0,5,0,12,0,20,0,28,0,36,0,46,0,219,0,
+3,0,72,0,39,0,218,0,3,0,72,0,45,0,220,0,3,0,72,0,49,0,219,0,4,0,104,0,72,
+0,39,0,218,0,4,0,104,0,72,0,45,0,1,0,4,0,188,0,3,0,72,0,48,0,1,0,27,0,20,
+0,22,0,24,0,25,0,27,0,29,0,30,0,32,0,34,0,35,0,37,0,39,0,41,0,42,0,43,0,45,
+0,46,0,47,0,48,0,49,0,50,0,52,0,53,0,54,0,55,0,56,0,97,0,4,0,0,0,1,0,8,0,
+1,4,8,0,26,0,58,0,122,0,200,0,222,0,244,1,10,1,54,1,66,1,88,1,152,1,236,2,
+2,2,108,2,130,2,142,2,188,2,234,2,246,3,2,3,46,3,68,3,80,3,124,3,138,3,196,
+3,252,0,6,0,14,0,22,0,30,0,38,0,46,0,54,0,150,0,3,0,49,0,72,0,147,0,3,0,72,
+0,20,0,148,0,3,0,72,0,35,0,151,0,3,0,72,0,54,0,101,0,3,0,72,0,104,0,149,0,
+4,0,104,0,72,0,30,0,7,0,16,0,24,0,32,0,40,0,48,0,58,0,68,0,156,0,3,0,49,0,
+72,0,152,0,3,0,72,0,22,0,155,0,3,0,72,0,39,0,154,0,3,0,72,0,45,0,153,0,4,
+0,104,0,72,0,37,0,155,0,4,0,104,0,72,0,39,0,154,0,4,0,104,0,72,0,45,0,2,0,
+6,0,14,0,157,0,3,0,72,0,20,0,158,0,3,0,72,0,24,0,2,0,6,0,14,0,159,0,3,0,72,
+0,25,0,160,0,3,0,72,0,26,0,2,0,6,0,14,0,161,0,3,0,72,0,27,0,162,0,3,0,72,
+0,29,0,4,0,10,0,18,0,26,0,34,0,163,0,3,0,72,0,25,0,165,0,3,0,72,0,27,0,166,
+0,3,0,72,0,29,0,164,0,4,0,104,0,72,0,26,0,1,0,4,0,167,0,3,0,72,0,30,0,2,0,
+6,0,14,0,168,0,3,0,72,0,32,0,169,0,3,0,72,0,33,0,6,0,14,0,22,0,30,0,38,0,
+46,0,54,0,174,0,3,0,72,0,30,0,170,0,3,0,72,0,32,0,173,0,3,0,72,0,34,0,172,
+0,3,0,72,0,45,0,96,0,3,0,72,0,104,0,171,0,4,0,104,0,72,0,33,0,8,0,18,0,26,
+0,34,0,42,0,50,0,58,0,66,0,74,0,181,0,3,0,49,0,72,0,179,0,3,0,72,0,35,0,180,
+0,3,0,72,0,36,0,175,0,3,0,72,0,39,0,176,0,3,0,72,0,44,0,177,0,3,0,72,0,45,
+0,178,0,3,0,72,0,55,0,176,0,4,0,104,0,72,0,44,0,2,0,6,0,14,0,182,0,3,0,72,
+0,37,0,183,0,3,0,72,0,38,0,10,0,22,0,30,0,38,0,46,0,54,0,62,0,70,0,78,0,88,
+0,96,0,189,0,3,0,72,0,35,0,190,0,3,0,72,0,36,0,184,0,3,0,72,0,37,0,185,0,
+3,0,72,0,38,0,186,0,3,0,72,0,39,0,187,0,3,0,72,0,45,0,188,0,3,0,72,0,48,0,
+188,0,4,0,72,0,104,0,48,0,97,0,3,0,72,0,104,0,190,0,4,0,104,0,72,0,36,0,2,
+0,6,0,14,0,192,0,3,0,49,0,72,0,191,0,3,0,72,0,41,0,1,0,4,0,193,0,3,0,49,0,
+72,0,4,0,10,0,18,0,26,0,36,0,197,0,3,0,49,0,72,0,194,0,3,0,72,0,43,0,195,
+0,4,0,104,0,72,0,37,0,196,0,4,0,104,0,72,0,38,0,4,0,10,0,18,0,30,0,38,0,201,
+0,3,0,49,0,72,0,200,0,5,0,72,0,41,0,49,0,72,0,199,0,3,0,72,0,41,0,198,0,3,
+0,72,0,45,0,1,0,4,0,98,0,3,0,72,0,104,0,1,0,4,0,203,0,3,0,72,0,48,0,4,0,10,
+0,18,0,26,0,34,0,205,0,3,0,49,0,72,0,204,0,3,0,72,0,41,0,99,0,3,0,72,0,104,
+0,204,0,4,0,104,0,72,0,41,0,2,0,6,0,14,0,206,0,3,0,72,0,50,0,100,0,3,0,72,
+0,104,0,1,0,4,0,207,0,3,0,49,0,72,0,4,0,10,0,18,0,26,0,34,0,212,0,3,0,49,
+0,72,0,209,0,3,0,72,0,25,0,211,0,3,0,72,0,53,0,210,0,4,0,104,0,72,0,26,0,
+1,0,4,0,213,0,4,0,104,0,72,0,30,0,5,0,12,0,20,0,28,0,40,0,48,0,217,0,3,0,
+49,0,72,0,216,0,3,0,72,0,36,0,214,0,5,0,72,0,48,0,72,0,48,0,215,0,3,0,72,
+0,55,0,216,0,4,0,104,0,72,0,36,0,5,0,12,0,20,0,28,0,36,0,46,0,220,0,3,0,49,
+0,72,0,219,0,3,0,72,0,39,0,218,0,3,0,72,0,45,0,219,0,4,0,104,0,72,0,39,0,
+218,0,4,0,104,0,72,0,45,0,1,0,4,0,188,0,3,0,72,0,48,0,1,0,26,0,20,0,22,0,
+24,0,25,0,27,0,29,0,30,0,32,0,34,0,35,0,37,0,39,0,41,0,42,0,43,0,45,0,47,
+0,48,0,49,0,50,0,52,0,53,0,54,0,55,0,56,0,97,0,4,0,0,0,1,0,8,0,1,4,28,0,26,
+0,58,0,132,0,220,0,242,1,8,1,30,1,74,1,86,1,108,1,172,2,0,2,22,2,128,2,150,
+2,162,2,208,2,254,3,10,3,22,3,66,3,88,3,100,3,144,3,158,3,216,4,16,0,7,0,
+16,0,24,0,32,0,40,0,48,0,56,0,64,0,150,0,3,0,49,0,72,0,147,0,3,0,72,0,20,
+0,149,0,3,0,72,0,30,0,148,0,3,0,72,0,35,0,151,0,3,0,72,0,54,0,101,0,3,0,72,
+0,104,0,149,0,4,0,104,0,72,0,30,0,8,0,18,0,26,0,34,0,42,0,50,0,58,0,68,0,
+78,0,156,0,3,0,49,0,72,0,152,0,3,0,72,0,22,0,153,0,3,0,72,0,37,0,155,0,3,
+0,72,0,39,0,154,0,3,0,72,0,45,0,153,0,4,0,104,0,72,0,37,0,155,0,4,0,104,0,
+72,0,39,0,154,0,4,0,104,0,72,0,45,0,2,0,6,0,14,0,157,0,3,0,72,0,20,0,158,
+0,3,0,72,0,24,0,2,0,6,0,14,0,159,0,3,0,72,0,25,0,160,0,3,0,72,0,26,0,2,0,
+6,0,14,0,161,0,3,0,72,0,27,0,162,0,3,0,72,0,29,0,4,0,10,0,18,0,26,0,34,0,
+163,0,3,0,72,0,25,0,165,0,3,0,72,0,27,0,166,0,3,0,72,0,29,0,164,0,4,0,104,
+0,72,0,26,0,1,0,4,0,167,0,3,0,72,0,30,0,2,0,6,0,14,0,168,0,3,0,72,0,32,0,
+169,0,3,0,72,0,33,0,6,0,14,0,22,0,30,0,38,0,46,0,54,0,174,0,3,0,72,0,30,0,
+170,0,3,0,72,0,32,0,173,0,3,0,72,0,34,0,172,0,3,0,72,0,45,0,96,0,3,0,72,0,
+104,0,171,0,4,0,104,0,72,0,33,0,8,0,18,0,26,0,34,0,42,0,50,0,58,0,66,0,74,
+0,181,0,3,0,49,0,72,0,179,0,3,0,72,0,35,0,180,0,3,0,72,0,36,0,175,0,3,0,72,
+0,39,0,176,0,3,0,72,0,44,0,177,0,3,0,72,0,45,0,178,0,3,0,72,0,55,0,176,0,
+4,0,104,0,72,0,44,0,2,0,6,0,14,0,182,0,3,0,72,0,37,0,183,0,3,0,72,0,38,0,
+10,0,22,0,30,0,38,0,46,0,54,0,62,0,70,0,78,0,88,0,96,0,189,0,3,0,72,0,35,
+0,190,0,3,0,72,0,36,0,184,0,3,0,72,0,37,0,185,0,3,0,72,0,38,0,186,0,3,0,72,
+0,39,0,187,0,3,0,72,0,45,0,188,0,3,0,72,0,48,0,188,0,4,0,72,0,104,0,48,0,
+97,0,3,0,72,0,104,0,190,0,4,0,104,0,72,0,36,0,2,0,6,0,14,0,192,0,3,0,49,0,
+72,0,191,0,3,0,72,0,41,0,1,0,4,0,193,0,3,0,49,0,72,0,4,0,10,0,18,0,26,0,36,
+0,197,0,3,0,49,0,72,0,194,0,3,0,72,0,43,0,195,0,4,0,104,0,72,0,37,0,196,0,
+4,0,104,0,72,0,38,0,4,0,10,0,18,0,30,0,38,0,201,0,3,0,49,0,72,0,200,0,5,0,
+72,0,41,0,49,0,72,0,199,0,3,0,72,0,41,0,198,0,3,0,72,0,45,0,1,0,4,0,98,0,
+3,0,72,0,104,0,1,0,4,0,203,0,3,0,72,0,48,0,4,0,10,0,18,0,26,0,34,0,205,0,
+3,0,49,0,72,0,204,0,3,0,72,0,41,0,99,0,3,0,72,0,104,0,204,0,4,0,104,0,72,
+0,41,0,2,0,6,0,14,0,206,0,3,0,72,0,50,0,100,0,3,0,72,0,104,0,1,0,4,0,207,
+0,3,0,49,0,72,0,4,0,10,0,18,0,26,0,34,0,212,0,3,0,49,0,72,0,209,0,3,0,72,
+0,25,0,211,0,3,0,72,0,53,0,210,0,4,0,104,0,72,0,26,0,1,0,4,0,213,0,4,0,104,
+0,72,0,30,0,5,0,12,0,20,0,28,0,40,0,48,0,217,0,3,0,49,0,72,0,216,0,3,0,72,
+0,36,0,214,0,5,0,72,0,48,0,72,0,48,0,215,0,3,0,72,0,55,0,216,0,4,0,104,0,
+72,0,36,0,5,0,12,0,20,0,28,0,36,0,46,0,220,0,3,0,49,0,72,0,219,0,3,0,72,0,
+39,0,218,0,3,0,72,0,45,0,219,0,4,0,104,0,72,0,39,0,218,0,4,0,104,0,72,0,45,
+0,1,0,4,0,188,0,3,0,72,0,48,0,1,0,26,0,20,0,22,0,24,0,25,0,27,0,29,0,30,0,
+32,0,34,0,35,0,37,0,39,0,41,0,42,0,43,0,45,0,47,0,48,0,49,0,50,0,52,0,53,
+0,54,0,55,0,56,0,97,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,4,0,146,0,2,0,
+47,0,1,0,1,0,72,0,6,0,0,0,1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,0,146,0,2,0,6,0,
+20,0,1,0,46,0,1,0,0,0,1,0,0,0,16,0,1,0,51,0,1,0,0,0,1,0,0,0,16,0,4,0,0,0,
+1,0,8,0,1,1,254,0,37,0,80,0,100,0,110,0,120,0,130,0,140,0,150,0,160,0,170,
+0,180,0,190,0,200,0,210,0,220,0,230,0,250,1,4,1,14,1,24,1,34,1,54,1,64,1,
+74,1,84,1,94,1,104,1,114,1,134,1,144,1,164,1,184,1,194,1,204,1,214,1,224,
+1,234,1,244,0,2,0,6,0,14,0,101,0,3,0,72,0,104,0,106,0,2,0,72,0,1,0,4,0,107,
+0,2,0,72,0,1,0,4,0,108,0,2,0,72,0,1,0,4,0,109,0,2,0,72,0,1,0,4,0,110,0,2,
+0,72,0,1,0,4,0,111,0,2,0,72,0,1,0,4,0,112,0,2,0,72,0,1,0,4,0,113,0,2,0,72,
+0,1,0,4,0,114,0,2,0,72,0,1,0,4,0,115,0,2,0,72,0,1,0,4,0,116,0,2,0,72,0,1,
+0,4,0,117,0,2,0,72,0,1,0,4,0,118,0,2,0,72,0,1,0,4,0,119,0,2,0,72,0,2,0,6,
+0,14,0,96,0,3,0,72,0,104,0,120,0,2,0,72,0,1,0,4,0,121,0,2,0,72,0,1,0,4,0,
+122,0,2,0,72,0,1,0,4,0,123,0,2,0,72,0,1,0,4,0,124,0,2,0,72,0,2,0,6,0,14,0,
+97,0,3,0,72,0,104,0,125,0,2,0,72,0,1,0,4,0,126,0,2,0,72,0,1,0,4,0,127,0,2,
+0,72,0,1,0,4,0,128,0,2,0,72,0,1,0,4,0,129,0,2,0,72,0,1,0,4,0,130,0,2,0,72,
+0,1,0,4,0,131,0,2,0,72,0,2,0,6,0,14,0,98,0,3,0,72,0,104,0,132,0,2,0,72,0,
+1,0,4,0,133,0,2,0,72,0,2,0,6,0,14,0,99,0,3,0,72,0,104,0,134,0,2,0,72,0,2,
+0,6,0,14,0,100,0,3,0,72,0,104,0,135,0,2,0,72,0,1,0,4,0,136,0,2,0,72,0,1,0,
+4,0,137,0,2,0,72,0,1,0,4,0,138,0,2,0,72,0,1,0,4,0,139,0,2,0,72,0,1,0,4,0,
+140,0,2,0,72,0,1,0,4,0,141,0,2,0,72,0,1,0,4,0,142,0,2,0,72,0,2,0,3,0,20,0,
+39,0,0,0,41,0,56,0,20,0,151,0,151,0,36,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,
+1,0,4,0,143,0,2,0,72,0,1,0,1,0,49,0,2,0,0,0,1,0,8,0,1,0,14,0,1,0,8,0,2,0,
+72,0,49,0,1,0,1,0,143,0,4,0,0,0,1,0,8,0,1,0,26,0,1,0,8,0,2,0,6,0,12,0,144,
+0,2,0,46,0,145,0,2,0,52,0,1,0,1,0,72,0,6,0,0,0,1,0,8,0,1,0,8,0,1,0,14,0,1,
+0,1,0,146,0,1,0,4,0,1,0,145,0,1,0,0,0,1,0,0,0,16,0,4,0,0,0,1,0,8,0,1,0,42,
+0,3,0,12,0,22,0,32,0,1,0,4,0,144,0,2,0,72,0,1,0,4,0,146,0,2,0,72,0,1,0,4,
+0,145,0,2,0,72,0,1,0,3,0,46,0,47,0,52,0,4,0,0,0,1,0,8,0,1,0,64,0,3,0,12,0,
+32,0,44,0,2,0,6,0,14,0,202,0,3,0,72,0,46,0,202,0,2,0,144,0,1,0,4,0,205,0,
+3,0,72,0,49,0,2,0,6,0,14,0,208,0,3,0,72,0,52,0,208,0,2,0,145,0,1,0,3,0,46,
+0,49,0,52,0,5,2,0,0,1,0,8,0,1,0,10,0,2,0,18,0,36,0,1,0,2,0,144,0,145,0,1,
+0,4,0,2,0,2,0,144,0,0,0,14,0,1,0,15,0,1,0,4,0,2,0,2,0,145,0,0,0,14,0,1,0,
+15,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,72,0,72,0,1,0,2,0,144,0,145,0,1,0,0,0,1,
+0,8,0,2,0,10,0,2,0,202,0,208,0,1,0,2,0,144,0,145,0,2,0,0,0,1,0,8,0,1,0,22,
+0,2,0,10,0,16,0,2,0,72,0,52,0,2,0,72,0,47,0,1,0,2,0,145,0,146,0,6,2,0,0,1,
+0,8,0,2,0,18,0,94,0,102,0,190,0,3,0,0,0,200,0,218,0,1,0,36,0,77,0,78,0,149,
+0,150,0,152,0,156,0,159,0,160,0,167,0,168,0,169,0,173,0,181,0,182,0,191,0,
+192,0,193,0,194,0,195,0,196,0,197,0,200,0,201,0,202,0,203,0,204,0,205,0,207,
+0,208,0,211,0,212,0,213,0,214,0,215,0,217,0,220,0,1,0,188,0,1,0,1,0,2,0,14,
+0,77,0,78,0,2,0,149,0,150,0,1,0,152,0,152,0,1,0,156,0,156,0,1,0,159,0,160,
+0,1,0,167,0,169,0,1,0,173,0,173,0,1,0,181,0,182,0,1,0,191,0,197,0,1,0,200,
+0,205,0,1,0,207,0,208,0,1,0,211,0,215,0,1,0,217,0,217,0,1,0,220,0,220,0,1,
+0,1,0,77,0,2,0,1,0,1,0,1,0,4,0,0,0,1,0,1,0,1,0,1,0,0,0,18,0,1,0,4,0,1,0,1,
+0,1,0,0,0,1,0,0,0,27,0,2,0,0,0,1,0,8,0,1,1,92,0,34,0,74,0,82,0,90,0,98,0,
+106,0,114,0,122,0,130,0,138,0,146,0,154,0,162,0,170,0,178,0,186,0,194,0,202,
+0,210,0,218,0,226,0,234,0,242,0,250,1,2,1,10,1,18,1,26,1,34,1,42,1,50,1,58,
+1,68,1,76,1,84,0,3,0,20,0,72,0,30,0,3,0,20,0,72,0,49,0,3,0,22,0,72,0,22,0,
+3,0,22,0,72,0,49,0,3,0,25,0,72,0,25,0,3,0,25,0,72,0,26,0,3,0,30,0,72,0,30,
+0,3,0,32,0,72,0,32,0,3,0,32,0,72,0,33,0,3,0,34,0,72,0,34,0,3,0,35,0,72,0,
+49,0,3,0,37,0,72,0,37,0,3,0,41,0,72,0,41,0,3,0,41,0,72,0,49,0,3,0,42,0,72,
+0,49,0,3,0,43,0,72,0,43,0,3,0,43,0,72,0,37,0,3,0,43,0,72,0,38,0,3,0,43,0,
+72,0,49,0,3,0,199,0,72,0,49,0,3,0,45,0,72,0,49,0,3,0,46,0,72,0,46,0,3,0,48,
+0,72,0,48,0,3,0,49,0,72,0,41,0,3,0,49,0,72,0,49,0,3,0,52,0,72,0,49,0,3,0,
+52,0,72,0,52,0,3,0,53,0,72,0,53,0,3,0,53,0,72,0,49,0,3,0,54,0,72,0,30,0,4,
+0,55,0,72,0,133,0,48,0,3,0,55,0,72,0,55,0,3,0,55,0,72,0,49,0,3,0,56,0,72,
+0,49,0,1,0,34,0,149,0,150,0,152,0,156,0,159,0,160,0,167,0,168,0,169,0,173,
+0,181,0,182,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,200,0,201,0,202,0,
+203,0,204,0,205,0,207,0,208,0,211,0,212,0,213,0,214,0,215,0,217,0,220,0,6,
+2,0,0,1,0,8,0,2,0,18,0,94,0,102,0,190,0,3,0,0,0,200,0,218,0,1,0,36,0,77,0,
+78,0,149,0,150,0,152,0,156,0,159,0,160,0,167,0,168,0,169,0,173,0,181,0,182,
+0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,200,0,201,0,202,0,203,0,204,0,
+205,0,207,0,208,0,211,0,212,0,213,0,214,0,215,0,217,0,220,0,1,0,188,0,1,0,
+1,0,2,0,14,0,77,0,78,0,2,0,149,0,150,0,1,0,152,0,152,0,1,0,156,0,156,0,1,
+0,159,0,160,0,1,0,167,0,169,0,1,0,173,0,173,0,1,0,181,0,182,0,1,0,191,0,197,
+0,1,0,200,0,205,0,1,0,207,0,208,0,1,0,211,0,215,0,1,0,217,0,217,0,1,0,220,
+0,220,0,1,0,1,0,77,0,2,0,1,0,1,0,1,0,4,0,0,0,1,0,1,0,1,0,1,0,0,0,20,0,1,0,
+4,0,1,0,1,0,1,0,0,0,1,0,0,0,27,0,2,0,0,0,1,0,8,0,1,1,26,0,34,0,74,0,80,0,
+86,0,92,0,98,0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,
+0,164,0,170,0,176,0,182,0,188,0,196,0,202,0,208,0,214,0,220,0,226,0,232,0,
+238,0,244,0,250,1,0,1,8,1,14,1,20,0,2,0,106,0,30,0,2,0,106,0,49,0,2,0,108,
+0,22,0,2,0,108,0,49,0,2,0,111,0,25,0,2,0,111,0,26,0,2,0,116,0,30,0,2,0,118,
+0,32,0,2,0,118,0,33,0,2,0,120,0,34,0,2,0,121,0,49,0,2,0,123,0,37,0,2,0,126,
+0,41,0,2,0,126,0,49,0,2,0,127,0,49,0,2,0,128,0,43,0,2,0,128,0,37,0,2,0,128,
+0,38,0,2,0,128,0,49,0,3,0,179,0,72,0,49,0,2,0,130,0,49,0,2,0,131,0,49,0,2,
+0,133,0,48,0,2,0,134,0,41,0,2,0,134,0,49,0,2,0,137,0,49,0,2,0,137,0,49,0,
+2,0,138,0,53,0,2,0,138,0,49,0,2,0,139,0,30,0,3,0,140,0,133,0,48,0,2,0,140,
+0,55,0,2,0,140,0,49,0,2,0,141,0,49,0,1,0,34,0,149,0,150,0,152,0,156,0,159,
+0,160,0,167,0,168,0,169,0,173,0,181,0,182,0,191,0,192,0,193,0,194,0,195,0,
+196,0,197,0,200,0,201,0,202,0,203,0,204,0,205,0,207,0,208,0,211,0,212,0,213,
+0,214,0,215,0,217,0,220,0,4,2,0,0,1,0,8,0,1,0,166,0,8,0,22,0,40,0,58,0,76,
+0,94,0,112,0,130,0,148,0,2,0,6,0,12,0,234,0,2,0,77,0,242,0,2,0,78,0,2,0,6,
+0,12,0,235,0,2,0,77,0,243,0,2,0,78,0,2,0,6,0,12,0,236,0,2,0,77,0,244,0,2,
+0,78,0,2,0,6,0,12,0,237,0,2,0,77,0,245,0,2,0,78,0,2,0,6,0,12,0,238,0,2,0,
+77,0,246,0,2,0,78,0,2,0,6,0,12,0,239,0,2,0,77,0,247,0,2,0,78,0,2,0,6,0,12,
+0,240,0,2,0,77,0,248,0,2,0,78,0,2,0,6,0,12,0,241,0,2,0,77,0,249,0,2,0,78,
+0,1,0,8,0,30,0,31,0,37,0,44,0,45,0,47,0,48,0,51,0,6,2,0,0,1,0,8,0,2,0,16,
+0,22,0,30,0,38,0,2,0,0,0,72,0,1,0,1,0,146,0,1,0,1,0,1,0,1,0,1,0,146,0,1,0,
+1,0,2,0,5,0,50,0,50,0,1,0,160,0,160,0,1,0,167,0,167,0,1,0,201,0,201,0,1,0,
+206,0,206,0,1,0,1,0,4,0,0,0,1,0,1,0,1,0,1,0,0,0,24,0,6,2,0,0,1,0,8,0,2,0,
+16,0,22,0,62,0,70,0,2,0,0,0,110,0,1,0,1,0,146,0,2,0,6,0,50,0,50,0,1,0,135,
+0,135,0,1,0,160,0,160,0,1,0,167,0,167,0,1,0,201,0,201,0,1,0,206,0,206,0,1,
+0,1,0,146,0,1,0,1,0,2,0,6,0,50,0,50,0,1,0,135,0,135,0,1,0,160,0,160,0,1,0,
+167,0,167,0,1,0,201,0,201,0,1,0,206,0,206,0,1,0,2,0,6,0,20,0,0,0,1,0,1,0,
+1,0,1,0,0,0,24,0,1,0,1,0,1,0,0,0,1,0,0,0,24,0,1,0,0,0,1,0,8,0,1,0,6,0,85,
+0,1,0,1,0,146,0,6,2,0,0,1,0,8,0,2,0,18,0,40,0,176,0,204,0,3,0,0,0,212,0,246,
+0,2,0,3,0,60,0,65,0,0,0,77,0,78,0,6,0,144,0,145,0,8,0,2,0,22,0,50,0,50,0,
+1,0,60,0,61,0,3,0,64,0,65,0,1,0,77,0,78,0,1,0,96,0,101,0,2,0,144,0,145,0,
+1,0,149,0,150,0,1,0,152,0,152,0,1,0,156,0,156,0,1,0,159,0,160,0,1,0,167,0,
+169,0,1,0,173,0,173,0,1,0,181,0,182,0,1,0,188,0,188,0,4,0,191,0,197,0,1,0,
+200,0,208,0,1,0,211,0,215,0,1,0,217,0,217,0,1,0,220,0,220,0,1,0,221,0,224,
+0,3,0,227,0,230,0,1,0,232,0,249,0,1,0,2,0,4,0,60,0,61,0,2,0,62,0,65,0,1,0,
+77,0,78,0,1,0,144,0,145,0,1,0,1,0,1,0,1,0,1,0,2,0,6,0,20,0,1,0,1,0,1,0,0,
+0,1,0,0,0,27,0,1,0,4,0,1,0,0,0,1,0,0,0,27,0,3,0,8,0,22,0,36,0,1,0,2,0,1,0,
+0,0,1,0,0,0,27,0,1,0,3,0,1,0,0,0,1,0,0,0,26,0,1,0,4,0,1,0,0,0,1,0,0,0,27,
+0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,222,0,224,0,1,0,2,0,60,0,61,0,1,0,0,0,1,0,
+8,0,2,0,26,0,10,0,221,0,223,0,225,0,226,0,227,0,228,0,232,0,233,0,229,0,230,
+0,2,0,3,0,60,0,65,0,0,0,77,0,78,0,6,0,144,0,145,0,8,0,4,0,0,0,1,0,8,0,1,0,
+194,0,7,0,20,0,38,0,56,0,98,0,116,0,134,0,176,0,2,0,6,0,12,1,48,0,2,1,46,
+1,49,0,2,1,47,0,2,0,6,0,12,1,50,0,2,1,46,1,51,0,2,1,47,0,4,0,10,0,18,0,26,
+0,34,1,52,0,3,0,60,1,46,1,53,0,3,0,60,1,47,1,52,0,3,1,46,0,60,1,53,0,3,1,
+47,0,60,0,2,0,6,0,12,1,54,0,2,1,46,1,55,0,2,1,47,0,2,0,6,0,12,1,56,0,2,1,
+46,1,57,0,2,1,47,0,4,0,10,0,18,0,26,0,34,1,58,0,3,0,60,1,46,1,59,0,3,0,60,
+1,47,1,58,0,3,1,46,0,60,1,59,0,3,1,47,0,60,0,2,0,6,0,12,1,60,0,2,1,46,1,61,
+0,2,1,47,0,1,0,7,0,22,0,38,0,39,0,41,0,45,0,47,0,55,0,4,0,0,0,1,0,8,0,1,0,
+90,0,6,0,18,0,30,0,42,0,54,0,66,0,78,0,1,0,4,0,101,0,3,0,72,0,104,0,1,0,4,
+0,96,0,3,0,72,0,104,0,1,0,4,0,97,0,3,0,72,0,104,0,1,0,4,0,98,0,3,0,72,0,104,
+0,1,0,4,0,99,0,3,0,72,0,104,0,1,0,4,0,100,0,3,0,72,0,104,0,1,0,6,0,20,0,34,
+0,39,0,47,0,49,0,50,0,0,};
+#endif
@@ -0,0 +1,626 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansMandaic_Regular_ttf_size = 15364;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansMandaic_Regular_ttf");
+asm(".type fz_font_NotoSansMandaic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansMandaic_Regular_ttf, 15364");
+asm(".balign 64");
+asm("fz_font_NotoSansMandaic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansMandaic-Regular.ttf\"");
+#else
+const int fz_font_NotoSansMandaic_Regular_ttf_size = 15364;
+const char fz_font_NotoSansMandaic_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,1,22,1,101,0,0,51,164,0,0,0,42,71,
+80,79,83,111,126,118,163,0,0,51,208,0,0,2,246,71,83,85,66,169,200,223,246,
+0,0,54,200,0,0,5,58,79,83,47,50,121,54,103,37,0,0,1,104,0,0,0,96,99,109,97,
+112,5,60,34,36,0,0,3,200,0,0,0,156,103,97,115,112,0,7,0,7,0,0,51,152,0,0,
+0,12,103,108,121,102,86,18,87,209,0,0,5,104,0,0,40,6,104,101,97,100,6,103,
+196,42,0,0,0,236,0,0,0,54,104,104,101,97,13,99,5,81,0,0,1,36,0,0,0,36,104,
+109,116,120,149,105,22,174,0,0,1,200,0,0,2,0,108,111,99,97,82,239,72,1,0,
+0,4,100,0,0,1,2,109,97,120,112,0,137,0,120,0,0,1,72,0,0,0,32,110,97,109,101,
+140,225,185,37,0,0,45,112,0,0,6,6,112,111,115,116,255,105,0,102,0,0,51,120,
+0,0,0,32,0,1,0,0,0,1,5,31,120,137,151,38,95,15,60,245,0,11,8,0,0,0,0,0,205,
+137,171,131,0,0,0,0,210,40,203,250,254,249,252,198,8,157,5,202,0,0,0,9,0,
+2,0,0,0,0,0,0,0,1,0,0,5,202,252,198,0,0,9,17,254,249,254,249,8,157,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,1,0,0,0,128,0,60,0,4,0,58,0,3,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,1,0,4,5,85,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,71,79,79,71,0,64,0,0,254,255,5,202,252,198,0,0,5,202,3,58,0,0,0,1,
+0,0,0,0,4,13,5,202,0,0,0,32,0,2,4,205,0,193,0,0,0,0,2,20,0,0,2,20,0,0,2,255,
+255,176,4,70,0,140,4,70,0,140,4,93,0,130,7,39,0,100,7,39,0,100,6,245,0,100,
+6,52,255,175,6,1,255,175,3,208,0,100,3,208,0,100,4,40,0,100,3,220,255,175,
+3,240,255,175,5,75,0,100,5,75,0,100,5,127,0,100,4,69,255,175,4,112,255,175,
+7,53,0,100,7,53,0,100,5,254,0,100,5,224,255,175,4,169,255,175,3,75,0,100,
+3,75,0,100,3,181,0,100,2,80,255,175,2,73,255,177,1,254,0,180,1,254,0,180,
+2,43,0,180,6,61,0,120,6,61,0,120,6,75,0,120,5,104,0,80,5,104,0,80,5,146,0,
+100,4,155,255,175,4,176,255,175,3,138,0,120,3,138,0,120,3,72,0,120,5,94,0,
+140,5,94,0,140,5,80,0,140,4,249,255,175,4,232,255,175,3,174,0,100,3,174,0,
+100,3,197,0,100,2,71,255,175,2,95,255,175,7,237,0,100,7,237,0,100,8,24,0,
+100,7,0,255,175,7,42,255,175,4,178,0,140,4,178,0,140,4,197,0,140,4,70,255,
+175,4,118,255,175,7,241,0,100,7,241,0,100,8,4,0,100,6,66,255,175,6,85,255,
+175,6,212,0,100,6,212,0,100,6,213,0,100,5,232,255,175,5,233,255,175,5,194,
+0,140,5,194,0,140,5,206,0,140,5,39,255,175,5,51,255,175,8,47,0,140,8,47,0,
+140,6,188,0,140,7,225,255,175,6,110,255,175,6,229,0,100,6,229,0,100,7,16,
+0,100,5,242,255,175,6,28,255,175,6,165,0,100,6,165,0,100,6,207,0,100,5,178,
+255,175,5,220,255,175,7,78,0,140,7,78,0,140,7,96,0,140,5,34,0,100,5,34,0,
+100,5,78,0,100,4,39,255,175,4,82,255,175,6,27,0,140,6,27,0,140,9,17,0,133,
+9,17,0,133,3,206,0,116,3,206,0,116,0,0,254,249,0,0,255,3,0,0,255,164,4,116,
+0,160,6,80,255,175,5,244,0,100,5,18,255,175,5,40,255,175,6,10,0,100,2,228,
+0,120,2,128,0,120,3,249,0,130,6,5,0,120,3,235,255,175,5,64,0,100,4,28,255,
+175,4,253,0,100,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,144,0,0,0,18,0,16,0,3,0,2,
+0,0,0,13,0,32,0,160,6,64,8,91,8,94,254,255,255,255,0,0,0,0,0,13,0,32,0,160,
+6,64,8,64,8,94,254,255,255,255,0,1,255,245,255,227,255,99,249,196,0,0,248,
+20,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,5,0,8,0,13,0,18,0,23,0,28,
+0,33,0,36,0,39,0,44,0,47,0,52,0,57,0,62,0,67,0,72,0,77,0,82,0,87,0,92,0,97,
+0,100,0,105,0,107,0,109,0,111,0,112,0,113,0,0,0,21,0,21,0,21,0,21,0,39,0,
+78,0,86,0,126,0,176,0,184,0,233,1,32,1,88,1,144,1,152,1,210,2,17,2,81,2,105,
+2,113,2,139,2,168,2,199,3,4,3,12,3,67,3,131,3,189,3,218,3,226,3,244,4,18,
+4,40,4,53,4,61,4,83,4,132,4,140,4,205,4,251,5,3,5,49,5,100,5,151,5,178,5,
+186,5,211,6,12,6,20,6,74,6,139,6,201,6,216,6,224,6,242,7,6,7,29,7,81,7,89,
+7,150,7,207,8,18,8,59,8,67,8,116,8,166,8,228,9,34,9,42,9,104,9,170,9,236,
+10,23,10,31,10,74,10,122,10,171,10,238,10,246,11,61,11,136,11,214,12,38,12,
+46,12,116,12,205,13,27,13,77,13,85,13,137,13,193,13,250,14,28,14,36,14,72,
+14,111,14,154,14,241,14,249,15,81,15,128,15,136,15,192,15,245,16,50,16,92,
+16,100,16,175,16,183,16,241,16,249,17,31,17,44,17,66,17,144,17,218,18,8,18,
+59,18,110,18,156,18,181,18,206,18,246,19,53,19,109,19,162,19,213,20,3,0,0,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,255,176,0,0,2,255,0,155,
+0,8,0,0,51,34,38,53,52,54,51,33,21,1,34,47,47,34,2,254,41,37,36,41,155,0,
+0,2,0,140,255,162,3,186,2,160,0,13,0,24,0,0,55,52,54,54,51,50,22,22,21,20,
+6,35,34,38,55,20,33,50,54,53,52,38,35,34,6,140,112,195,118,112,179,98,229,
+177,191,217,146,1,6,124,136,136,107,111,168,242,116,200,114,106,182,112,163,
+203,180,176,201,110,101,112,138,152,255,255,0,140,255,162,3,186,2,160,2,6,
+0,5,0,0,0,2,0,130,0,0,4,93,2,158,0,11,0,23,0,0,37,46,2,35,34,6,6,21,20,22,
+51,33,21,33,34,38,53,52,54,54,51,32,19,3,41,4,48,92,82,78,140,86,37,38,2,
+251,252,242,97,108,124,217,126,1,104,9,155,134,161,70,88,143,66,29,39,155,
+103,88,123,223,133,253,253,0,0,1,0,100,0,0,6,195,3,255,0,29,0,0,1,17,33,21,
+33,53,33,17,33,53,54,54,1,23,7,6,7,33,50,54,54,53,52,39,55,22,21,20,6,35,
+4,73,2,122,249,161,3,79,253,230,16,75,1,11,113,126,87,70,2,20,150,139,59,
+14,142,20,214,236,1,230,254,181,155,155,1,75,127,12,80,1,58,73,150,103,57,
+32,75,78,67,98,37,80,105,188,164,0,255,255,0,100,0,0,6,195,3,255,2,6,0,8,
+0,0,0,1,0,100,0,0,6,245,3,255,0,29,0,0,1,17,33,21,33,53,33,17,33,53,54,55,
+55,23,6,6,7,33,50,54,54,53,52,39,55,22,21,20,6,35,4,73,2,172,249,111,3,79,
+253,230,40,102,217,112,170,77,35,2,19,150,139,59,13,141,20,214,236,1,230,
+254,181,155,155,1,75,127,31,121,254,73,202,79,29,32,75,78,74,91,37,80,105,
+188,164,0,0,1,255,175,0,0,5,208,3,255,0,34,0,0,1,17,33,21,33,34,38,53,52,
+54,51,33,17,33,53,54,55,55,23,6,6,7,33,50,54,54,53,52,39,55,22,21,20,6,35,
+3,85,2,123,250,48,34,47,47,34,2,191,253,230,40,102,217,112,170,77,35,2,19,
+150,139,59,13,141,20,214,236,1,230,254,181,155,41,37,36,41,1,75,127,31,121,
+254,73,202,79,29,32,75,78,74,91,37,80,105,188,164,0,0,1,255,175,0,0,6,1,3,
+255,0,34,0,0,1,17,33,21,33,34,38,53,52,54,51,33,17,33,53,54,54,1,23,7,6,7,
+33,50,54,54,53,52,39,55,22,21,20,6,35,3,85,2,172,249,255,34,47,47,34,2,191,
+253,230,16,75,1,11,113,126,87,70,2,20,150,139,59,14,142,20,214,236,1,230,
+254,181,155,40,37,36,42,1,75,127,12,80,1,58,73,150,103,57,32,75,78,67,98,
+37,80,105,188,164,0,0,2,0,100,0,0,3,108,5,182,0,21,0,34,0,0,55,33,39,0,17,
+52,54,54,51,50,22,22,21,20,6,35,39,22,0,23,21,33,19,20,23,22,51,50,54,53,
+52,38,35,34,6,100,2,59,103,254,142,82,146,99,88,141,76,180,168,99,47,1,28,
+162,252,248,250,6,36,76,105,110,88,70,77,98,155,127,1,198,1,72,105,185,108,
+88,150,89,132,142,5,135,254,109,175,153,4,51,41,25,11,74,68,79,98,134,255,
+255,0,100,0,0,3,108,5,182,2,6,0,13,0,0,0,2,0,100,0,0,4,40,5,182,0,12,0,35,
+0,0,1,20,23,22,51,50,54,53,52,38,35,34,6,1,53,33,39,0,17,52,54,54,51,50,22,
+22,21,20,6,35,39,22,0,23,51,21,1,162,6,36,76,105,110,88,70,77,98,254,194,
+2,127,103,254,142,82,146,99,88,141,76,180,168,99,47,1,32,156,122,4,51,41,
+25,11,74,68,79,98,134,251,97,155,127,1,198,1,72,105,185,108,88,150,89,132,
+142,5,135,254,105,169,155,0,2,255,175,0,0,3,120,5,182,0,12,0,39,0,0,1,20,
+23,22,51,50,54,53,52,38,35,34,6,1,34,38,53,52,54,51,33,39,0,17,52,54,54,51,
+50,22,22,21,20,6,35,39,22,0,23,21,1,106,6,36,76,105,110,88,70,77,98,254,150,
+34,47,47,34,2,171,103,254,142,82,146,99,88,141,76,180,168,99,47,1,28,162,
+4,51,41,25,11,74,68,79,98,134,251,97,41,37,36,41,127,1,198,1,72,105,185,108,
+88,150,89,132,142,5,135,254,109,175,153,0,2,255,175,0,0,3,240,5,182,0,12,
+0,40,0,0,1,20,23,22,51,50,54,53,52,38,35,34,6,1,34,38,53,52,54,51,33,39,0,
+17,52,54,54,51,50,22,22,21,20,6,35,39,22,0,23,51,21,1,106,6,36,76,105,110,
+88,70,77,98,254,150,34,47,47,34,2,171,103,254,142,82,146,99,88,141,76,180,
+168,99,47,1,32,156,122,4,51,41,25,11,74,68,79,98,134,251,97,41,37,36,41,127,
+1,198,1,72,105,185,108,88,150,89,132,142,5,135,254,105,169,155,0,1,0,100,
+0,0,4,161,3,241,0,11,0,0,33,33,53,33,17,33,17,51,17,33,17,51,4,161,251,195,
+3,167,253,182,150,1,180,150,155,1,75,2,11,254,139,1,117,0,255,255,0,100,0,
+0,4,161,3,241,2,6,0,18,0,0,0,1,0,100,0,0,5,127,3,241,0,13,0,0,55,33,17,33,
+17,51,17,33,17,51,17,51,21,33,100,3,177,253,182,151,1,179,150,212,250,229,
+155,1,75,2,11,254,139,1,117,252,170,155,0,1,255,175,0,0,3,155,3,241,0,16,
+0,0,49,34,38,53,52,54,51,33,17,33,17,51,17,33,17,51,17,34,47,47,34,3,5,253,
+183,150,1,179,150,41,37,36,41,1,75,2,11,254,139,1,117,252,15,0,0,1,255,175,
+0,0,4,112,3,241,0,18,0,0,49,34,38,53,52,54,51,33,17,33,17,51,17,33,17,51,
+17,51,21,33,48,48,33,3,5,253,183,150,1,179,151,212,41,37,36,41,1,75,2,11,
+254,139,1,117,252,170,155,0,0,1,0,100,0,0,6,179,1,212,0,42,0,0,51,53,33,50,
+54,55,55,23,21,20,7,22,22,51,50,53,55,23,21,20,7,22,22,51,50,53,52,39,55,
+22,21,20,6,35,34,39,6,35,34,39,6,6,35,100,1,43,134,129,5,138,2,6,9,79,56,
+184,139,2,8,6,74,52,176,4,135,14,167,142,157,61,84,150,164,71,44,172,122,
+155,106,125,16,23,23,41,39,56,65,241,16,28,28,40,48,52,61,224,31,30,28,52,
+67,156,193,122,122,122,55,67,255,255,0,100,0,0,6,179,1,212,2,6,0,23,0,0,0,
+1,0,100,0,0,5,254,1,156,0,36,0,0,33,34,39,6,6,35,33,53,33,50,54,55,55,23,
+21,20,7,22,22,51,50,53,55,23,21,20,7,22,22,51,51,21,35,34,38,39,6,3,186,161,
+74,44,172,122,254,231,1,43,134,129,5,138,2,6,9,79,56,184,139,2,7,14,128,94,
+35,41,109,156,36,85,121,55,66,155,106,125,16,23,23,41,39,56,65,241,16,28,
+28,46,35,59,61,155,66,61,127,0,0,1,255,175,0,0,5,94,1,212,0,46,0,0,49,34,
+38,53,52,54,51,51,50,54,53,55,23,21,20,7,22,22,51,50,53,55,23,21,20,7,22,
+22,51,50,53,52,39,55,22,21,20,6,35,34,39,6,35,34,39,6,35,33,48,48,33,80,127,
+119,138,2,6,9,79,56,184,139,2,8,6,74,52,176,4,135,14,167,142,157,61,84,150,
+156,74,97,226,41,37,36,41,106,125,16,23,23,41,39,56,65,241,16,28,28,40,48,
+52,61,222,33,30,28,52,67,156,193,122,122,121,121,0,1,255,175,0,0,4,169,1,
+156,0,40,0,0,33,34,39,6,35,35,34,38,53,52,54,51,51,50,54,53,55,23,21,20,7,
+22,22,51,50,53,55,23,21,20,7,22,22,51,51,21,35,34,38,39,6,2,101,156,74,97,
+226,60,33,48,48,33,80,127,119,138,2,6,9,79,56,184,139,2,7,14,128,94,35,41,
+109,156,36,85,121,121,41,37,36,41,106,125,16,23,23,41,39,56,65,241,16,28,
+28,46,35,59,61,155,66,61,127,0,0,1,0,100,0,0,2,171,2,178,0,16,0,0,51,53,33,
+50,54,53,52,38,39,55,22,22,21,20,6,6,35,100,1,25,93,59,64,54,125,66,77,64,
+133,135,155,46,55,56,194,94,90,104,241,100,85,106,54,0,255,255,0,100,0,0,
+2,171,2,178,2,6,0,28,0,0,0,1,0,100,0,0,3,181,2,124,0,7,0,0,55,33,17,51,17,
+51,21,33,100,1,229,150,214,252,175,155,1,225,254,31,155,0,0,1,255,175,0,0,
+1,176,2,178,0,18,0,0,49,34,38,53,52,54,51,51,50,54,53,52,39,55,22,22,21,16,
+33,34,47,47,34,108,96,78,117,125,69,73,254,193,41,37,36,41,61,66,114,204,
+90,107,220,92,254,241,0,1,255,177,0,0,2,73,2,124,0,12,0,0,49,34,38,53,52,
+54,51,51,17,51,17,51,21,33,46,46,33,221,150,214,41,37,36,41,1,225,254,31,
+155,0,0,1,0,180,254,186,1,74,5,142,0,3,0,0,19,17,51,17,180,150,254,186,6,
+212,249,44,255,255,0,180,254,186,1,74,5,142,2,6,0,33,0,0,0,1,0,180,254,186,
+2,43,5,142,0,10,0,0,19,17,51,17,20,22,51,21,38,39,17,180,150,104,121,155,
+70,254,186,6,212,251,107,46,48,155,2,74,254,110,0,2,0,120,255,245,5,177,2,
+178,0,14,0,28,0,0,37,20,6,7,5,5,34,38,53,52,36,36,51,50,18,7,52,38,38,35,
+34,4,6,21,20,51,37,55,50,5,177,171,188,254,131,254,123,97,111,1,37,1,206,
+151,192,239,160,74,132,87,95,254,126,251,87,2,131,139,156,212,107,102,3,6,
+5,102,89,138,215,157,254,250,180,62,155,75,127,144,59,65,8,2,255,255,0,120,
+255,245,5,177,2,178,2,6,0,36,0,0,0,2,0,120,255,245,6,75,2,178,0,24,0,39,0,
+0,33,34,38,39,6,6,7,5,5,34,38,53,52,54,36,36,51,50,22,23,30,2,51,21,1,34,
+4,4,21,20,51,37,55,50,54,53,52,38,38,6,67,91,110,35,30,135,126,254,150,254,
+122,96,108,133,1,47,1,95,119,163,200,61,19,38,59,45,253,161,91,254,128,254,
+255,86,2,109,122,95,103,82,128,42,46,46,40,2,6,5,102,89,90,162,157,101,184,
+209,65,53,24,155,2,28,126,143,61,65,8,2,49,45,39,180,72,0,0,2,0,80,0,0,5,
+54,5,202,0,15,0,26,0,0,33,33,53,33,1,54,54,51,50,22,21,20,6,7,3,51,33,33,
+19,54,54,53,52,38,35,34,7,4,206,251,130,1,10,1,155,52,169,105,116,135,49,
+61,231,237,253,47,1,59,253,61,45,58,51,104,71,155,4,27,136,140,147,128,66,
+196,165,253,143,2,151,163,170,50,64,69,184,0,255,255,0,80,0,0,5,54,5,202,
+2,6,0,39,0,0,0,2,0,100,0,0,5,146,5,202,0,15,0,26,0,0,51,53,33,1,54,54,51,
+50,22,21,20,6,7,3,33,21,37,33,19,54,54,53,52,38,35,34,7,100,1,10,1,155,52,
+169,105,116,135,49,61,231,1,157,252,127,1,59,253,61,45,58,51,104,71,155,4,
+27,136,140,147,128,66,196,165,253,143,155,155,2,151,163,170,50,64,69,184,
+0,0,2,255,175,0,0,4,104,5,202,0,19,0,31,0,0,49,34,38,53,52,54,51,51,1,54,
+54,51,50,22,21,20,3,3,51,21,37,33,19,54,54,53,52,38,35,34,6,7,34,47,47,34,
+140,1,156,52,166,107,116,135,109,231,236,253,48,1,59,251,64,43,55,54,53,84,
+37,41,37,36,41,4,27,135,141,147,128,135,254,220,253,143,155,155,2,151,172,
+162,49,63,70,88,96,0,0,2,255,175,0,0,4,176,5,202,0,19,0,31,0,0,49,34,38,53,
+52,54,51,51,1,54,54,51,50,22,21,20,3,3,33,21,37,33,19,54,54,53,52,38,35,34,
+6,7,34,47,47,34,141,1,155,52,166,107,116,135,109,231,1,156,252,128,1,59,251,
+64,43,55,54,53,84,37,41,37,36,41,4,27,135,141,147,128,135,254,220,253,143,
+155,155,2,151,172,162,49,63,70,88,96,0,1,0,120,0,0,3,38,2,183,0,13,0,0,33,
+33,34,38,53,52,54,54,55,23,6,2,7,33,3,38,253,217,64,71,101,202,97,95,91,237,
+21,2,28,58,70,65,193,235,74,91,80,254,218,75,255,255,0,120,0,0,3,38,2,183,
+2,6,0,44,0,0,0,1,0,120,0,0,3,72,2,183,0,11,0,0,33,33,34,53,52,18,55,23,6,
+2,7,33,3,72,253,183,135,252,149,95,91,237,21,2,61,128,108,1,88,115,91,80,
+254,218,75,0,0,1,0,140,253,28,4,230,2,182,0,31,0,0,1,54,18,55,33,34,38,53,
+52,18,55,23,6,2,7,33,50,22,21,20,7,6,0,7,35,38,2,2,39,55,18,18,2,203,83,233,
+57,254,238,75,78,250,132,97,125,207,7,1,94,45,58,13,66,254,251,166,107,134,
+201,128,38,141,76,211,253,193,90,1,100,129,74,67,114,1,91,92,97,98,254,236,
+68,48,46,32,35,174,254,124,172,221,1,183,1,114,177,38,254,224,253,246,255,
+255,0,140,253,28,4,230,2,182,2,6,0,47,0,0,0,1,0,140,253,28,5,80,2,182,0,29,
+0,0,33,6,0,7,35,38,2,2,39,55,18,18,19,54,18,55,35,34,38,53,52,54,54,55,23,
+6,2,7,33,21,4,199,60,254,254,157,107,134,201,128,38,141,76,211,147,74,229,
+50,252,75,78,109,184,88,98,125,207,7,2,45,177,254,111,162,221,1,183,1,114,
+177,38,254,224,253,246,254,242,81,1,105,133,74,67,72,206,214,61,97,98,254,
+236,68,155,0,0,1,255,175,252,244,4,129,2,182,0,40,0,0,1,38,39,46,2,35,34,
+38,53,52,54,51,50,30,3,19,54,18,55,33,34,38,53,52,18,55,23,6,2,7,33,50,22,
+21,20,2,2,7,2,23,66,83,86,123,105,72,33,48,48,33,61,109,98,88,89,164,92,230,
+55,254,240,76,79,250,132,97,122,209,7,1,93,46,58,132,223,155,252,244,130,
+182,188,194,86,41,37,36,41,37,75,114,171,254,145,109,1,111,133,73,68,114,
+1,91,92,97,96,254,234,68,48,46,52,254,232,254,185,182,0,1,255,175,252,244,
+4,232,2,182,0,39,0,0,1,38,39,46,2,35,34,38,53,52,54,51,50,30,3,19,54,18,55,
+35,34,38,53,52,18,55,23,6,2,7,33,21,35,14,2,7,2,23,71,78,80,128,103,75,34,
+47,47,34,64,109,99,87,87,163,88,221,48,253,75,79,250,132,97,125,207,7,2,45,
+136,48,125,149,155,252,244,143,172,179,206,80,41,37,36,41,35,75,115,170,254,
+144,104,1,107,141,73,68,114,1,91,92,97,98,254,236,68,155,136,239,219,186,
+0,1,0,100,0,0,2,230,5,142,0,5,0,0,51,53,33,17,51,17,100,1,236,150,155,4,243,
+250,114,0,255,255,0,100,0,0,2,230,5,142,2,6,0,52,0,0,0,1,0,100,0,0,3,197,
+5,142,0,7,0,0,33,33,53,33,17,51,17,51,3,197,252,159,1,236,150,223,155,4,243,
+251,13,0,0,1,255,175,0,0,1,127,5,142,0,10,0,0,49,34,38,53,52,54,51,51,17,
+51,17,34,47,47,34,233,150,41,37,36,41,4,243,250,114,0,0,1,255,175,0,0,2,95,
+5,142,0,12,0,0,33,33,34,38,53,52,54,51,51,17,51,17,51,2,95,253,161,34,47,
+47,34,233,151,223,41,37,36,41,4,243,251,13,0,1,0,100,254,186,7,67,3,251,0,
+31,0,0,1,17,35,17,33,22,21,20,6,35,33,53,33,50,54,53,52,38,35,33,53,62,2,
+1,23,7,6,6,7,33,17,7,67,150,254,95,54,178,156,252,112,3,144,87,96,92,83,253,
+151,14,40,85,1,139,97,173,34,140,48,4,46,3,241,250,201,3,44,69,96,154,167,
+155,85,81,77,88,111,7,27,66,1,66,93,145,28,92,25,1,117,0,255,255,0,100,254,
+186,7,67,3,251,2,6,0,57,0,0,0,1,0,100,0,0,8,24,3,251,0,40,0,0,1,7,6,6,7,33,
+17,51,17,20,22,22,51,51,21,35,34,38,53,53,33,22,21,20,6,35,33,53,33,50,54,
+53,52,38,35,33,53,62,2,1,4,9,173,30,139,52,4,46,150,34,63,73,43,57,157,149,
+254,95,54,178,156,252,112,3,144,87,96,92,83,253,150,14,40,85,1,139,3,158,
+145,24,94,27,1,117,253,140,86,97,43,155,180,186,120,69,96,154,167,155,85,
+81,77,88,111,7,27,66,1,66,0,1,255,175,254,186,6,86,3,252,0,35,0,0,1,17,35,
+17,33,22,21,20,6,35,33,34,38,53,52,54,51,33,50,54,53,52,38,35,33,53,54,55,
+1,23,7,6,6,7,33,17,6,86,150,254,95,54,178,156,252,249,33,48,48,33,3,7,88,
+94,90,84,253,150,37,118,1,123,96,173,37,144,40,4,47,3,241,250,201,3,44,69,
+96,154,167,41,37,36,41,86,80,79,86,111,20,93,1,54,94,145,31,92,22,1,117,0,
+0,1,255,175,0,0,7,42,3,252,0,45,0,0,1,7,6,6,7,33,17,51,17,20,22,22,51,51,
+21,35,34,38,53,53,33,22,21,20,6,35,33,34,38,53,52,54,51,33,50,54,53,52,38,
+35,33,53,62,2,1,3,27,172,30,140,52,4,47,150,33,63,74,42,68,154,140,254,95,
+54,178,156,252,249,34,47,47,34,3,7,87,96,91,84,253,150,25,85,25,1,143,3,158,
+145,25,93,27,1,117,253,140,86,96,44,155,179,187,120,69,96,154,167,41,37,36,
+41,85,81,79,86,111,13,65,19,1,70,0,1,0,140,253,28,4,38,1,249,0,19,0,0,1,2,
+2,3,55,26,2,23,54,18,55,52,39,55,22,21,20,0,7,2,3,139,198,38,143,55,76,103,
+73,121,195,10,7,142,11,254,234,163,253,28,1,26,2,136,1,33,26,254,227,254,
+212,254,218,171,205,1,247,159,105,58,20,49,103,219,253,113,219,0,255,255,
+0,140,253,28,4,38,1,249,2,6,0,62,0,0,0,1,0,140,253,28,4,197,1,249,0,26,0,
+0,37,6,2,7,35,38,2,3,55,18,18,23,54,18,18,55,53,39,55,22,21,21,22,22,51,21,
+38,3,243,55,213,122,106,121,215,39,143,55,148,101,68,142,93,6,2,137,11,11,
+95,73,146,79,210,254,60,157,223,2,173,1,55,26,254,201,254,11,247,108,1,60,
+1,52,104,51,61,20,49,72,20,60,58,155,3,0,0,1,255,175,253,14,3,188,1,249,0,
+28,0,0,1,3,38,39,38,38,35,34,38,53,52,54,51,50,22,23,22,19,54,18,55,52,39,
+55,22,21,20,0,3,1,148,140,74,29,28,67,66,34,47,47,34,133,158,51,37,105,117,
+198,11,7,142,11,254,255,194,253,14,1,159,216,44,42,37,41,37,36,41,124,138,
+98,254,172,199,1,250,162,79,84,20,30,122,209,253,142,254,240,0,1,255,175,
+252,244,4,118,1,158,0,37,0,0,1,3,38,39,38,38,35,34,38,53,52,54,51,50,22,23,
+22,22,19,54,18,55,52,39,55,22,21,21,7,22,22,51,21,38,39,6,2,7,1,156,148,74,
+29,28,67,66,34,47,47,34,133,158,51,18,34,98,125,190,10,6,142,11,1,12,95,72,
+144,65,51,235,134,252,244,1,185,216,44,42,37,41,37,36,41,124,138,49,99,254,
+196,213,1,231,153,40,72,20,30,91,13,12,57,56,155,4,73,196,254,39,188,0,0,
+2,0,100,0,0,7,101,2,158,0,29,0,39,0,0,51,53,33,50,54,55,55,23,21,20,7,22,
+23,18,36,51,50,22,22,21,20,6,35,33,34,38,39,6,6,35,1,34,6,7,33,50,54,53,52,
+38,100,1,13,134,129,5,138,2,6,19,107,124,1,35,177,122,183,99,172,187,254,
+28,133,167,59,43,173,124,4,117,124,237,77,2,25,72,80,138,155,106,125,16,23,
+23,40,39,71,32,1,1,239,108,193,119,133,117,58,67,57,68,2,7,197,167,51,47,
+122,144,255,255,0,100,0,0,7,101,2,158,2,6,0,67,0,0,0,2,0,100,0,0,8,4,2,158,
+0,30,0,39,0,0,37,6,6,35,35,53,33,50,54,55,55,23,21,20,7,22,23,18,36,51,50,
+22,22,21,20,7,51,21,33,34,38,1,34,6,7,33,50,53,52,38,2,179,43,173,124,251,
+1,13,134,129,5,138,2,6,19,107,124,1,35,177,122,183,99,23,182,252,22,133,167,
+2,230,124,237,77,2,51,126,138,125,57,68,155,106,125,16,23,23,40,39,71,32,
+1,1,239,107,189,114,62,43,155,58,1,205,197,167,98,122,144,0,2,255,175,0,0,
+5,182,2,158,0,33,0,43,0,0,37,6,35,35,34,38,53,52,54,51,51,50,54,53,55,23,
+21,20,7,22,23,18,36,51,50,22,22,21,20,6,35,33,34,38,1,34,6,7,33,50,54,53,
+52,38,1,4,91,164,5,34,47,47,34,10,93,98,143,2,6,19,107,124,1,35,177,122,183,
+99,172,187,254,28,134,168,2,232,124,237,77,2,25,72,80,138,124,124,41,37,36,
+41,121,110,16,23,23,40,39,71,32,1,1,239,108,193,119,133,117,59,1,204,197,
+167,51,47,122,144,0,2,255,175,0,0,6,85,2,158,0,34,0,43,0,0,37,6,35,35,34,
+38,53,52,54,51,51,50,54,53,55,23,21,20,7,22,23,18,36,51,50,22,22,21,20,7,
+51,21,33,34,38,1,34,6,7,33,50,53,52,38,1,4,91,164,5,34,47,47,34,10,93,98,
+143,2,6,19,107,124,1,35,177,122,183,99,23,182,252,22,134,168,2,232,124,237,
+77,2,51,126,138,124,124,41,37,36,41,121,110,16,23,23,40,39,71,32,1,1,239,
+107,189,114,62,43,155,59,1,204,197,167,98,122,144,0,0,1,0,100,0,0,6,52,3,
+252,0,25,0,0,1,53,54,54,55,1,23,7,6,7,33,50,22,21,20,6,35,33,53,33,50,54,
+53,52,38,35,1,146,30,116,16,1,186,92,229,105,96,2,74,159,175,178,156,251,
+126,4,130,89,95,96,88,1,230,111,15,76,12,1,64,100,166,70,48,163,152,154,167,
+155,89,77,79,86,255,255,0,100,0,0,6,52,3,252,2,6,0,72,0,0,0,1,0,100,0,0,6,
+213,3,252,0,25,0,0,1,7,6,7,33,50,22,21,20,7,51,21,33,53,33,50,54,53,52,38,
+35,33,53,54,55,1,4,74,230,108,92,2,74,159,175,44,205,249,143,4,130,88,96,
+95,89,252,172,69,93,1,185,3,152,166,72,46,163,152,93,73,155,155,86,79,78,
+88,111,35,68,1,64,0,0,1,255,175,0,0,5,72,3,252,0,29,0,0,1,7,6,7,33,50,22,
+21,20,6,35,33,34,38,53,52,54,51,33,50,54,53,52,38,35,33,53,54,55,1,3,94,230,
+108,92,2,74,159,175,178,156,252,6,34,47,47,34,3,250,88,96,95,89,252,172,69,
+93,1,185,3,152,166,72,46,163,152,154,167,41,37,36,41,86,79,78,88,111,35,68,
+1,64,0,0,1,255,175,0,0,5,233,3,252,0,30,0,0,1,7,6,7,33,50,22,21,20,7,51,21,
+33,34,38,53,52,54,51,33,50,54,53,52,38,35,33,53,54,55,1,3,94,230,108,92,2,
+74,159,175,44,205,250,23,34,47,47,34,3,250,88,96,95,89,252,172,69,93,1,185,
+3,152,166,72,46,163,152,93,73,155,41,37,36,41,86,79,78,88,111,35,68,1,64,
+0,0,2,0,140,252,244,5,54,2,164,0,29,0,41,0,0,1,0,19,35,34,38,53,52,54,54,
+51,50,22,22,21,20,14,3,7,35,38,2,2,39,55,26,2,19,20,51,51,54,53,52,38,35,
+34,6,6,2,224,1,17,102,136,161,167,98,159,95,99,153,83,41,99,119,134,167,105,
+136,180,174,39,140,82,115,154,158,190,185,23,106,85,56,95,56,253,162,1,73,
+1,21,151,141,95,187,102,87,156,91,96,189,239,211,189,198,236,1,107,1,221,
+169,40,254,239,254,205,254,178,2,212,160,73,93,93,115,62,103,255,255,0,140,
+252,244,5,54,2,164,2,6,0,77,0,0,0,2,0,140,252,244,5,206,2,164,0,33,0,45,0,
+0,1,54,18,55,35,34,38,53,52,54,54,51,50,22,22,21,20,7,51,21,35,14,2,7,35,
+38,2,2,39,55,26,2,19,20,51,51,54,53,52,38,35,34,6,6,2,224,122,197,56,140,
+160,168,98,159,95,99,153,83,21,177,218,53,125,142,174,105,136,180,174,39,
+140,82,115,154,154,190,184,24,107,84,55,94,58,253,162,147,1,64,139,150,142,
+95,187,102,88,152,94,110,77,155,137,228,205,210,236,1,107,1,221,169,40,254,
+239,254,205,254,178,2,211,159,65,102,95,112,61,103,0,2,255,175,252,244,4,
+154,2,165,0,11,0,49,0,0,1,20,51,51,54,53,52,38,35,34,6,6,3,38,39,46,2,35,
+34,38,53,52,54,51,50,30,2,19,54,18,55,35,34,38,53,52,54,54,51,50,22,22,21,
+20,6,2,2,7,2,120,190,185,24,107,85,56,95,56,98,85,108,45,115,103,78,34,47,
+47,34,85,136,117,108,163,89,203,54,135,162,169,98,160,95,100,152,84,63,123,
+185,169,1,59,160,65,102,95,112,62,100,251,133,170,234,103,184,89,41,37,36,
+41,63,127,206,254,145,105,1,98,149,151,142,95,187,102,88,156,91,111,240,254,
+230,254,221,198,0,2,255,175,252,244,5,51,2,165,0,39,0,51,0,0,1,38,39,46,2,
+35,34,38,53,52,54,51,50,22,22,19,23,54,18,55,35,34,38,53,52,54,54,51,50,22,
+22,21,20,7,51,21,35,2,1,3,20,51,51,54,53,52,38,35,34,6,6,2,22,112,80,47,119,
+103,73,34,47,47,34,108,166,139,130,66,86,213,46,137,162,169,98,158,97,100,
+152,84,22,178,220,159,254,198,9,190,185,24,108,84,56,95,56,252,244,224,180,
+107,188,81,41,37,36,41,103,211,254,216,152,106,1,112,133,151,142,95,187,102,
+88,156,91,106,81,155,254,97,254,147,4,71,160,65,102,93,114,62,100,0,0,1,0,
+140,253,28,7,163,1,249,0,50,0,0,1,38,2,3,55,18,18,23,54,18,18,55,53,39,55,
+22,21,21,22,22,51,50,53,55,23,21,20,7,22,22,51,50,54,53,39,55,22,21,20,6,
+35,34,39,6,35,34,39,6,2,2,7,2,3,121,215,39,143,55,148,101,68,142,93,6,2,137,
+11,9,77,57,184,139,2,10,8,76,50,86,91,5,135,14,167,142,152,66,84,150,120,
+62,24,133,154,80,253,28,223,2,173,1,55,26,254,201,254,11,247,108,1,60,1,52,
+104,51,61,20,49,72,20,53,65,241,16,28,28,52,46,44,59,100,101,82,30,52,67,
+156,193,122,122,82,101,254,176,254,230,103,255,255,0,140,253,28,7,163,1,249,
+2,6,0,82,0,0,0,1,0,140,253,28,6,188,1,249,0,43,0,0,33,34,39,6,2,2,7,35,38,
+2,3,55,18,18,23,54,18,18,55,53,39,55,22,21,21,22,22,51,50,53,55,23,21,20,
+7,22,22,51,51,21,35,34,39,6,4,170,120,62,24,133,154,80,106,121,215,39,143,
+55,148,101,68,142,93,6,1,137,10,9,77,57,184,139,2,7,14,116,86,5,11,206,75,
+85,82,101,254,176,254,230,103,223,2,173,1,55,26,254,201,254,11,247,108,1,
+60,1,52,104,44,56,20,40,69,20,53,65,243,16,29,29,46,35,59,61,155,127,127,
+0,0,1,255,175,252,244,7,85,1,212,0,59,0,0,1,39,2,39,38,38,35,34,38,53,52,
+54,51,50,22,23,22,23,23,54,18,63,2,22,21,21,22,22,51,50,53,55,23,21,20,7,
+22,22,51,50,54,53,39,55,22,21,20,6,35,34,39,6,35,34,39,6,2,2,7,1,156,42,167,
+41,28,66,68,33,48,48,33,132,156,54,34,67,50,120,196,8,1,136,10,9,78,56,184,
+139,2,10,8,76,50,86,91,5,135,14,167,142,152,66,84,150,123,62,60,129,146,82,
+252,244,129,1,254,62,42,37,41,37,36,41,121,141,91,211,153,204,1,240,155,89,
+20,37,72,19,55,64,243,16,29,29,52,46,44,59,100,101,82,30,52,67,156,193,122,
+122,87,194,254,218,254,250,117,0,0,1,255,175,252,244,6,110,1,158,0,52,0,0,
+33,34,39,6,35,34,39,6,2,2,7,35,39,2,39,38,38,35,34,38,53,52,54,51,50,22,23,
+22,23,23,54,18,63,2,22,21,21,22,22,51,50,53,55,23,21,20,7,22,22,51,51,21,
+6,99,206,75,85,153,123,62,60,129,146,82,102,42,167,41,28,66,68,33,48,48,33,
+132,156,54,34,67,50,120,196,8,1,136,10,9,78,56,184,139,2,7,14,116,86,5,127,
+127,87,194,254,218,254,250,117,129,1,254,62,42,37,41,37,36,41,121,141,91,
+211,153,204,1,240,155,89,20,37,72,19,55,64,243,16,29,29,46,35,59,61,155,0,
+2,0,100,0,0,6,59,3,251,0,21,0,28,0,0,55,33,50,54,53,52,38,35,33,53,54,55,
+1,23,7,6,7,33,17,51,17,33,1,20,7,33,17,33,22,100,2,97,94,100,97,87,254,202,
+35,66,1,31,112,159,60,74,3,61,150,250,41,3,185,97,1,233,254,33,87,155,86,
+80,79,86,112,27,73,1,65,75,182,67,59,1,106,252,26,1,65,115,51,1,75,51,255,
+255,0,100,0,0,6,59,3,251,2,6,0,87,0,0,0,2,0,100,0,0,7,16,3,251,0,23,0,30,
+0,0,55,33,50,54,53,52,38,35,33,53,54,54,1,23,7,6,7,33,17,51,17,51,21,33,1,
+20,7,33,17,33,22,100,2,97,94,100,102,92,254,212,21,68,1,43,113,160,63,70,
+3,61,150,212,249,84,3,185,97,1,234,254,32,87,155,86,80,81,84,112,16,68,1,
+81,75,182,70,56,1,106,252,181,155,1,65,117,49,1,75,51,0,2,255,175,0,0,5,72,
+3,251,0,27,0,34,0,0,49,34,38,53,52,54,51,33,50,54,53,52,38,35,33,53,54,55,
+1,23,7,6,6,7,33,17,51,17,1,20,7,33,17,33,22,33,48,48,33,1,210,94,100,102,
+92,254,212,35,66,1,30,113,159,12,87,34,3,60,150,253,226,97,1,233,254,33,87,
+41,37,36,41,86,80,81,84,112,27,73,1,65,75,182,15,84,27,1,106,252,26,1,65,
+115,51,1,75,51,0,2,255,175,0,0,6,28,3,251,0,28,0,35,0,0,49,34,38,53,52,54,
+51,33,50,54,53,52,38,35,33,53,54,55,1,23,7,6,7,33,17,51,17,51,21,1,20,7,33,
+17,33,22,34,47,47,34,1,210,94,100,102,92,254,212,35,66,1,31,112,159,63,70,
+3,60,150,212,253,14,97,1,233,254,33,87,41,37,36,41,86,80,81,84,112,27,73,
+1,65,75,182,70,56,1,106,252,181,155,1,65,115,51,1,75,51,0,0,1,0,100,0,0,5,
+251,3,251,0,17,0,0,55,33,17,33,53,54,55,19,23,7,6,6,7,33,17,51,17,33,100,
+5,1,252,52,50,87,236,113,145,20,96,37,3,16,150,250,105,155,1,75,127,41,98,
+1,11,76,166,24,88,29,1,106,252,26,0,255,255,0,100,0,0,5,251,3,251,2,6,0,92,
+0,0,0,1,0,100,0,0,6,207,3,251,0,19,0,0,1,7,6,6,7,33,17,51,17,51,21,33,53,
+33,17,33,53,54,55,19,3,127,145,20,96,37,3,16,150,212,249,149,5,1,252,52,50,
+87,236,3,175,166,24,88,29,1,106,252,181,155,155,1,75,127,41,98,1,11,0,1,255,
+175,0,0,5,8,3,251,0,22,0,0,49,34,38,53,52,54,51,33,17,33,53,54,54,1,23,7,
+6,6,7,33,17,51,17,34,47,47,34,4,114,252,52,20,57,1,40,111,143,13,87,52,3,
+15,150,41,37,36,41,1,75,127,15,57,1,78,76,166,15,86,40,1,106,252,26,0,0,1,
+255,175,0,0,5,220,3,251,0,24,0,0,1,7,6,6,7,33,17,51,17,51,21,33,34,38,53,
+52,54,51,33,17,33,53,54,54,1,2,137,143,13,94,44,3,15,150,212,250,36,34,47,
+47,34,4,114,252,51,17,66,1,35,3,175,166,16,92,33,1,106,252,181,155,41,37,
+36,41,1,75,127,13,66,1,71,0,0,3,0,140,254,20,6,194,2,178,0,33,0,46,0,57,0,
+0,33,3,35,38,39,39,35,34,38,53,52,54,54,51,50,30,2,18,23,51,54,18,18,54,54,
+51,50,22,22,21,20,6,35,1,20,22,51,51,46,3,35,34,6,6,37,34,6,6,7,51,50,54,
+53,52,38,4,90,128,151,31,18,50,223,176,197,86,152,93,78,111,90,62,83,11,19,
+21,67,72,91,134,102,94,144,80,207,185,251,229,118,112,184,14,28,48,75,59,
+56,86,48,4,104,61,84,65,52,192,112,120,88,254,20,136,101,255,169,147,94,176,
+104,44,101,168,254,18,192,150,1,90,1,6,153,88,90,161,95,165,179,1,73,86,88,
+74,139,107,65,59,98,157,65,131,189,96,89,93,107,0,255,255,0,140,254,20,6,
+194,2,178,2,6,0,97,0,0,0,3,0,140,254,20,7,96,2,178,0,34,0,47,0,58,0,0,33,
+3,35,38,39,39,35,34,38,53,52,54,54,51,50,30,2,18,23,51,54,18,18,54,54,51,
+50,22,22,21,20,7,51,21,1,20,22,51,51,46,3,35,34,6,6,37,34,6,6,7,51,50,54,
+53,52,38,4,90,128,151,31,18,50,223,176,197,86,152,93,78,111,90,62,83,11,19,
+21,67,72,91,134,102,94,144,80,64,222,249,191,118,112,184,14,28,48,75,59,56,
+86,48,4,104,61,84,65,52,192,112,120,88,254,20,136,101,255,169,147,94,176,
+104,44,101,168,254,18,192,150,1,90,1,6,153,88,90,161,95,115,74,155,1,73,86,
+88,74,139,107,65,59,98,157,65,131,189,96,89,93,107,0,0,1,0,100,254,186,4,
+120,3,241,0,29,0,0,1,17,35,17,6,6,35,35,39,22,21,20,6,35,35,53,33,50,54,53,
+52,39,55,22,23,23,50,54,55,17,4,120,150,65,148,96,13,15,26,168,161,254,1,
+3,96,78,117,124,31,28,56,111,181,47,3,241,250,201,3,87,48,45,1,97,69,134,
+137,155,61,66,114,204,90,50,53,4,61,53,1,56,255,255,0,100,254,186,4,120,3,
+241,2,6,0,100,0,0,0,1,0,100,0,0,5,78,3,241,0,38,0,0,51,53,33,50,54,53,52,
+39,55,22,23,23,50,54,55,17,51,17,20,22,22,51,51,21,35,34,38,53,53,6,6,35,
+35,39,22,21,20,6,35,100,1,4,96,78,117,124,31,28,56,111,181,47,150,34,64,74,
+41,68,153,142,65,148,96,13,15,26,168,161,155,61,66,114,204,90,50,53,4,61,
+53,1,56,253,140,86,96,44,155,178,188,163,48,45,1,97,69,134,137,0,0,1,255,
+175,254,186,3,125,3,241,0,34,0,0,1,17,35,17,6,6,35,35,39,22,21,20,6,35,35,
+34,38,53,52,54,51,51,50,54,53,52,39,55,22,23,23,50,54,55,17,3,125,150,65,
+148,96,13,15,26,168,161,103,34,47,47,34,108,96,78,117,124,31,28,56,111,181,
+47,3,241,250,201,3,87,48,45,1,97,69,134,137,41,37,36,41,61,66,114,204,90,
+50,53,4,61,53,1,56,0,0,1,255,175,0,0,4,82,3,241,0,43,0,0,49,34,38,53,52,54,
+51,51,50,54,53,52,39,55,22,23,23,50,54,55,17,51,17,20,22,22,51,51,21,35,34,
+38,53,53,6,6,35,35,39,22,21,20,6,35,34,47,47,34,108,96,78,117,124,31,28,56,
+111,181,47,150,34,64,74,41,68,153,142,65,148,96,13,15,26,168,161,41,37,36,
+41,61,66,114,204,90,50,53,4,61,53,1,56,253,140,86,96,44,155,178,188,163,48,
+45,1,97,69,134,137,0,0,1,0,140,0,0,5,183,2,183,0,24,0,0,33,33,34,53,52,18,
+55,23,6,2,7,33,38,53,52,18,55,23,6,6,21,20,22,51,33,5,183,251,92,135,252,
+149,104,105,233,20,2,121,5,200,153,104,125,182,63,68,1,11,128,108,1,88,115,
+91,92,254,224,69,23,36,101,1,6,118,91,102,220,53,47,27,255,255,0,140,0,0,
+5,183,2,183,2,6,0,105,0,0,0,1,0,133,252,244,8,157,2,183,0,43,0,0,1,22,18,
+19,54,0,55,33,34,38,53,52,18,55,23,6,2,7,33,50,22,21,20,7,6,0,7,35,38,3,39,
+33,34,53,52,18,55,23,6,2,7,33,2,39,4,124,62,166,239,76,1,24,67,254,250,76,
+79,250,132,97,125,207,7,1,84,46,58,13,71,254,167,139,108,67,138,83,252,51,
+135,252,149,104,105,233,20,3,139,104,77,2,169,130,254,71,253,55,76,1,138,
+133,73,68,114,1,91,92,97,98,254,236,68,48,46,34,33,173,254,41,130,152,1,140,
+232,128,108,1,88,115,91,92,254,224,69,1,41,163,255,255,0,133,252,244,8,157,
+2,183,2,6,0,107,0,0,0,1,0,116,252,198,3,71,2,227,0,33,0,0,5,6,0,7,22,4,23,
+7,38,36,38,53,52,54,55,55,38,39,38,53,52,62,3,55,23,14,2,7,22,4,23,3,25,149,
+254,158,34,28,1,105,194,57,128,254,91,117,132,183,137,188,87,108,41,100,167,
+174,70,81,56,226,200,16,34,1,72,111,37,94,254,240,46,28,136,55,158,30,158,
+94,67,87,152,126,95,34,26,31,99,52,82,112,149,129,42,125,36,171,178,33,14,
+67,19,0,255,255,0,116,252,198,3,71,2,227,2,6,0,109,0,0,0,2,254,249,254,155,
+1,7,255,106,0,11,0,23,0,0,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,
+22,21,20,6,35,34,38,254,249,54,38,37,54,54,37,38,54,1,87,52,39,43,49,54,38,
+39,52,253,54,49,49,54,53,51,51,53,54,49,57,46,53,51,51,0,1,255,3,254,181,
+0,253,255,79,0,3,0,0,7,33,21,33,253,1,250,254,6,177,154,0,0,1,255,164,254,
+155,0,91,255,106,0,11,0,0,7,52,54,51,50,22,21,20,6,35,34,38,92,54,38,37,54,
+54,37,38,54,253,54,49,49,54,53,51,51,0,0,4,0,160,254,208,3,212,2,4,0,11,0,
+23,0,39,0,53,0,0,37,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,
+6,35,34,38,39,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,7,52,54,54,51,50,
+22,21,20,6,6,35,34,38,1,144,96,74,70,100,96,74,70,100,60,136,94,98,132,136,
+94,98,132,120,88,162,100,96,162,92,88,162,100,96,162,92,60,108,192,110,180,
+230,109,190,111,180,230,106,74,96,99,71,74,96,99,71,95,135,130,100,95,135,
+130,100,104,159,87,91,163,96,104,159,87,91,163,96,112,190,108,229,181,113,
+189,108,229,0,0,2,255,175,255,245,6,80,2,178,0,31,0,46,0,0,33,34,38,39,6,
+6,7,5,5,34,39,6,35,34,38,53,52,54,51,50,55,54,36,36,51,50,22,23,22,22,51,
+21,1,34,4,4,21,20,51,37,55,50,54,53,52,38,38,6,72,91,110,35,30,135,126,254,
+150,254,126,124,52,57,100,34,47,47,34,95,38,32,1,44,1,171,139,164,200,61,
+26,68,66,253,161,91,254,128,254,255,86,2,109,122,95,103,82,128,42,46,46,40,
+2,6,5,75,64,41,37,36,41,86,118,194,137,186,209,87,53,155,2,28,126,143,61,
+65,8,2,49,45,39,180,72,0,0,2,0,100,0,0,5,74,5,202,0,15,0,26,0,0,33,33,53,
+33,1,54,54,51,50,22,21,20,6,7,3,51,33,33,19,54,54,53,52,38,35,34,7,4,226,
+251,130,1,10,1,155,52,169,105,116,135,49,61,231,237,253,47,1,59,253,61,45,
+58,51,104,71,155,4,27,136,140,147,128,66,196,165,253,143,2,151,163,170,50,
+64,69,184,0,0,2,255,175,0,0,4,104,5,202,0,19,0,31,0,0,49,34,38,53,52,54,51,
+51,1,54,54,51,50,22,21,20,3,3,51,21,37,33,19,54,54,53,52,38,35,34,6,7,34,
+47,47,34,140,1,156,52,166,107,116,135,109,231,236,253,48,1,59,251,64,43,55,
+54,53,84,37,41,37,36,41,4,27,135,141,147,128,135,254,220,253,143,155,155,
+2,151,172,162,49,63,70,88,96,0,0,2,255,175,0,0,5,40,5,202,0,19,0,31,0,0,49,
+34,38,53,52,54,51,51,1,54,54,51,50,22,21,20,3,3,33,21,37,33,19,54,54,53,52,
+38,35,34,6,7,34,47,47,34,141,1,155,52,166,107,116,135,109,231,2,20,252,8,
+1,59,251,64,43,55,54,53,84,37,41,37,36,41,4,27,135,141,147,128,135,254,220,
+253,143,155,155,2,151,172,162,49,63,70,88,96,0,2,0,100,0,0,6,10,5,202,0,15,
+0,26,0,0,51,53,33,1,54,54,51,50,22,21,20,6,7,3,33,21,37,33,19,54,54,53,52,
+38,35,34,7,100,1,10,1,155,52,169,105,116,135,49,61,231,2,21,252,7,1,59,253,
+61,45,58,51,104,71,155,4,27,136,140,147,128,66,196,165,253,143,155,155,2,
+151,163,170,50,64,69,184,0,0,1,0,120,0,0,2,228,2,183,0,11,0,0,33,33,34,53,
+52,18,55,23,6,2,7,33,2,228,254,27,135,252,149,95,91,237,21,1,217,128,108,
+1,88,115,91,80,254,218,75,0,0,1,0,120,0,0,2,128,2,183,0,11,0,0,33,33,34,53,
+52,18,55,23,6,2,7,33,2,128,254,127,135,252,149,95,91,237,21,1,117,128,108,
+1,88,115,91,80,254,218,75,0,0,2,0,130,0,0,3,249,2,158,0,11,0,23,0,0,37,46,
+2,35,34,6,6,21,20,22,51,33,21,33,34,38,53,52,54,54,51,32,19,3,41,4,48,92,
+82,78,140,86,37,38,2,151,253,86,97,108,124,217,126,1,104,9,155,134,161,70,
+88,143,66,29,39,155,103,88,123,223,133,253,253,0,0,2,0,120,255,245,6,5,2,
+178,0,24,0,39,0,0,33,34,39,14,3,4,35,34,38,53,52,54,36,36,51,50,22,23,30,
+2,51,21,1,34,4,4,21,20,51,37,55,50,54,53,52,38,38,5,237,114,36,20,69,111,
+165,254,28,190,97,111,128,1,40,1,104,122,169,203,50,21,21,29,22,253,231,91,
+254,128,254,255,86,2,109,122,95,103,82,128,88,31,36,19,4,9,100,91,88,159,
+158,105,197,198,83,38,19,155,2,28,126,143,61,65,8,2,49,45,39,180,72,0,0,1,
+255,175,0,0,3,235,1,161,0,38,0,0,37,6,35,35,34,38,53,52,54,51,51,50,54,53,
+55,23,21,20,7,22,22,51,50,53,39,55,22,21,21,7,22,51,21,34,38,39,6,35,34,1,
+127,97,226,60,33,48,48,33,80,127,119,138,2,6,9,79,56,165,2,137,7,1,8,85,60,
+99,24,70,140,153,121,121,41,37,36,41,106,125,16,23,23,41,39,56,65,191,45,
+26,32,62,25,22,121,155,59,51,110,0,0,1,0,100,0,0,5,64,1,161,0,34,0,0,33,34,
+39,6,6,35,33,53,33,50,54,55,55,23,21,20,7,22,22,51,50,53,39,55,22,21,21,7,
+22,51,21,34,38,39,6,3,183,158,74,44,172,122,254,231,1,43,134,129,5,138,2,
+6,9,79,56,165,2,137,7,1,8,85,60,99,24,70,121,55,66,155,106,125,16,23,23,41,
+39,56,65,191,45,26,32,62,25,22,121,155,59,51,110,0,0,2,255,175,0,0,4,104,
+5,202,0,19,0,31,0,0,49,34,38,53,52,54,51,51,1,54,54,51,50,22,21,20,3,3,33,
+21,37,33,19,54,54,53,52,38,35,34,6,7,34,47,47,34,141,1,155,52,166,107,116,
+135,109,231,1,8,253,20,1,59,251,64,43,55,54,53,84,37,41,37,36,41,4,27,135,
+141,147,128,135,254,220,253,143,155,155,2,151,172,162,49,63,70,88,96,0,2,
+0,100,0,0,5,74,5,202,0,15,0,26,0,0,51,53,33,1,54,54,51,50,22,21,20,6,7,3,
+33,21,37,33,19,54,54,53,52,38,35,34,7,100,1,10,1,155,52,169,105,116,135,49,
+61,231,1,8,253,20,1,59,253,61,45,58,51,104,71,155,4,27,136,140,147,128,66,
+196,165,253,143,155,155,2,151,163,170,50,64,69,184,0,0,0,0,0,0,15,0,186,0,
+3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,128,
+0,3,0,1,4,9,0,3,0,72,0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,0,30,
+0,214,0,3,0,1,4,9,0,6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,9,0,
+8,0,42,1,86,0,3,0,1,4,9,0,9,0,40,1,128,0,3,0,1,4,9,0,10,0,96,1,168,0,3,0,
+1,4,9,0,11,0,62,2,8,0,3,0,1,4,9,0,12,0,60,2,70,0,3,0,1,4,9,0,13,2,150,2,130,
+0,3,0,1,4,9,0,14,0,52,5,24,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,77,0,97,0,110,0,100,0,
+97,0,105,0,99,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,77,
+0,97,0,110,0,100,0,97,0,105,0,99,0,86,0,101,0,114,0,115,0,105,0,111,0,110,
+0,32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,
+0,110,0,115,0,77,0,97,0,110,0,100,0,97,0,105,0,99,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,0,0,0,34,0,0,0,2,0,3,0,0,0,109,0,1,0,110,0,113,0,3,0,114,
+0,127,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,30,0,44,0,1,109,97,110,100,0,
+8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,109,97,114,107,0,8,0,0,0,1,0,0,0,1,0,4,
+0,9,0,1,0,1,0,8,0,1,0,4,0,0,0,8,0,1,0,12,0,22,0,1,0,38,0,52,0,1,0,3,0,111,
+0,112,0,113,0,2,0,2,0,5,0,110,0,0,0,115,0,127,0,106,0,3,0,0,0,254,0,0,0,254,
+0,0,0,254,0,119,0,246,0,246,0,252,1,2,1,2,1,2,1,8,1,8,1,14,1,14,1,20,1,26,
+1,26,1,32,1,32,1,38,1,44,1,44,1,50,1,50,1,56,1,62,1,68,1,74,1,74,1,80,1,86,
+1,92,1,98,1,98,1,98,1,104,1,104,1,110,1,116,1,116,1,116,1,122,1,122,1,128,
+1,134,1,134,1,140,1,140,1,140,1,146,1,146,1,152,1,152,1,152,1,158,1,164,1,
+170,1,170,1,170,1,176,1,182,1,188,1,194,1,200,1,206,1,212,1,2,1,2,1,2,1,218,
+1,218,1,224,1,230,1,224,1,236,1,236,1,242,1,242,1,242,1,248,1,248,1,188,1,
+188,1,254,2,4,2,4,2,10,2,16,2,22,2,28,2,34,2,40,2,40,2,46,2,52,2,58,2,64,
+2,64,2,70,1,74,1,74,1,122,2,76,2,76,2,82,2,82,2,88,2,88,2,94,2,94,2,100,2,
+106,2,112,2,112,2,106,1,134,1,134,0,252,1,104,2,118,2,124,2,112,2,106,0,1,
+0,0,255,156,0,1,2,36,255,76,0,1,2,51,255,156,0,1,3,99,255,156,0,1,2,111,255,
+156,0,1,1,185,255,156,0,1,1,253,255,156,0,1,1,195,255,156,0,1,2,210,255,156,
+0,1,2,219,255,156,0,1,1,205,255,156,0,1,4,133,255,156,0,1,3,178,255,156,0,
+1,3,49,255,156,0,1,2,93,255,156,0,1,1,96,255,156,0,1,1,161,255,156,0,1,0,
+172,255,156,0,1,0,140,255,156,0,1,1,0,254,126,0,1,3,39,255,156,0,1,3,40,255,
+156,0,1,2,47,255,156,0,1,1,99,255,156,0,1,1,215,255,156,0,1,1,214,255,156,
+0,1,2,181,252,247,0,1,2,79,252,244,0,1,1,164,255,156,0,1,0,173,255,156,0,
+1,0,153,255,156,0,1,2,144,255,156,0,1,1,162,255,156,0,1,1,163,255,156,0,1,
+2,55,252,247,0,1,2,56,252,247,0,1,2,55,252,244,0,1,1,200,252,247,0,1,1,206,
+252,244,0,1,1,180,255,156,0,1,3,47,255,156,0,1,3,46,255,156,0,1,2,67,255,
+156,0,1,2,209,252,244,0,1,2,72,252,244,0,1,2,54,252,247,0,1,1,208,252,244,
+0,1,3,130,255,156,0,1,3,128,255,156,0,1,3,133,255,156,0,1,2,145,255,156,0,
+1,2,146,255,156,0,1,3,117,255,156,0,1,3,127,255,156,0,1,2,139,255,156,0,1,
+2,137,255,156,0,1,3,139,253,246,0,1,3,138,253,246,0,1,0,103,255,156,0,1,2,
+112,255,156,0,1,3,89,255,156,0,1,1,113,252,246,0,1,3,44,255,156,0,1,2,66,
+255,156,0,1,1,97,255,156,0,1,2,92,255,156,0,1,3,177,255,156,0,0,0,1,0,0,0,
+10,0,38,0,118,0,1,109,97,110,100,0,8,0,4,0,0,0,0,255,255,0,5,0,0,0,1,0,2,
+0,3,0,4,0,5,99,97,108,116,0,32,102,105,110,97,0,56,105,110,105,116,0,62,105,
+115,111,108,0,68,109,101,100,105,0,74,0,0,0,10,0,4,0,5,0,6,0,7,0,8,0,9,0,
+10,0,11,0,12,0,13,0,0,0,1,0,3,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,2,0,24,0,
+50,0,66,0,82,0,98,0,114,0,130,0,146,0,162,0,178,0,194,0,210,0,226,0,242,1,
+2,1,18,1,34,1,50,1,66,1,82,1,98,1,114,1,130,1,146,1,162,0,7,0,9,0,1,0,8,0,
+1,0,1,0,0,1,120,0,7,0,9,0,1,0,8,0,1,0,1,0,0,1,148,0,7,0,9,0,1,0,8,0,1,0,1,
+0,0,1,192,0,7,0,9,0,1,0,8,0,1,0,1,0,0,2,2,0,7,0,9,0,1,0,8,0,1,0,6,0,0,2,40,
+0,7,0,9,0,1,0,8,0,1,0,6,0,0,2,58,0,7,0,9,0,1,0,8,0,1,0,6,0,0,2,76,0,7,0,9,
+0,1,0,8,0,1,0,6,0,0,2,102,0,7,0,9,0,1,0,8,0,1,0,6,0,0,2,130,0,7,0,9,0,1,0,
+8,0,1,0,6,0,0,2,162,0,7,0,9,0,1,0,8,0,1,0,6,0,0,2,194,0,7,0,9,0,1,0,8,0,1,
+0,6,0,0,2,226,0,7,0,9,0,1,0,8,0,1,0,6,0,0,3,2,0,7,0,9,0,1,0,8,0,1,0,6,0,0,
+3,16,0,7,0,9,0,1,0,8,0,1,0,1,0,0,3,32,0,7,0,9,0,1,0,8,0,1,0,1,0,0,3,34,0,
+7,0,9,0,1,0,8,0,1,0,1,0,0,3,36,0,7,0,9,0,1,0,8,0,1,0,1,0,0,3,38,0,7,0,9,0,
+1,0,8,0,1,0,1,0,0,3,34,0,7,0,9,0,1,0,8,0,1,0,1,0,0,3,30,0,7,0,9,0,1,0,8,0,
+1,0,1,0,0,3,26,0,7,0,9,0,1,0,8,0,1,0,1,0,0,3,22,0,7,0,9,0,1,0,8,0,1,0,1,0,
+0,3,18,0,7,0,9,0,1,0,8,0,1,0,1,0,0,3,14,0,1,0,6,0,3,0,1,0,17,0,8,0,13,0,18,
+0,23,0,28,0,39,0,47,0,52,0,57,0,62,0,67,0,72,0,77,0,82,0,87,0,92,0,100,0,
+1,0,6,0,1,0,1,0,25,0,5,0,8,0,13,0,18,0,23,0,28,0,33,0,36,0,39,0,44,0,47,0,
+52,0,57,0,62,0,67,0,72,0,77,0,82,0,87,0,92,0,97,0,100,0,105,0,107,0,109,0,
+2,0,42,0,18,0,12,0,17,0,22,0,27,0,32,0,115,0,43,0,51,0,56,0,61,0,66,0,71,
+0,76,0,81,0,86,0,91,0,96,0,104,0,1,0,18,0,8,0,13,0,18,0,23,0,28,0,36,0,39,
+0,47,0,52,0,57,0,62,0,67,0,72,0,77,0,82,0,87,0,92,0,100,0,1,0,6,0,2,0,1,0,
+22,0,5,0,8,0,13,0,18,0,23,0,28,0,33,0,36,0,39,0,44,0,47,0,52,0,57,0,62,0,
+67,0,72,0,77,0,82,0,87,0,92,0,97,0,100,0,3,0,1,0,26,0,1,0,18,0,0,0,1,0,0,
+0,14,0,1,0,2,0,41,0,43,0,1,0,2,0,55,0,56,0,3,0,1,0,18,0,1,0,26,0,0,0,1,0,
+0,0,15,0,1,0,2,0,34,0,35,0,1,0,2,0,40,0,42,0,3,0,1,0,18,0,1,0,34,0,0,0,1,
+0,0,0,16,0,1,0,6,0,16,0,17,0,26,0,27,0,42,0,43,0,1,0,2,0,41,0,46,0,3,0,1,
+0,24,0,1,0,18,0,0,0,1,0,0,0,17,0,1,0,1,0,46,0,1,0,8,0,50,0,51,0,65,0,66,0,
+80,0,81,0,85,0,86,0,3,0,1,0,24,0,1,0,18,0,0,0,1,0,0,0,18,0,1,0,1,0,7,0,1,
+0,10,0,16,0,17,0,50,0,51,0,65,0,66,0,80,0,81,0,85,0,86,0,3,0,1,0,18,0,1,0,
+42,0,0,0,1,0,0,0,19,0,1,0,10,0,16,0,17,0,50,0,51,0,65,0,66,0,80,0,81,0,85,
+0,86,0,1,0,1,0,38,0,3,0,1,0,18,0,1,0,42,0,0,0,1,0,0,0,20,0,1,0,10,0,16,0,
+17,0,50,0,51,0,65,0,66,0,80,0,81,0,85,0,86,0,1,0,1,0,25,0,3,0,1,0,18,0,1,
+0,42,0,0,0,1,0,0,0,21,0,1,0,10,0,16,0,17,0,50,0,51,0,65,0,66,0,80,0,81,0,
+85,0,86,0,1,0,1,0,27,0,3,0,1,0,18,0,1,0,24,0,0,0,1,0,0,0,22,0,1,0,1,0,26,
+0,1,0,1,0,43,0,3,0,1,0,18,0,1,0,26,0,0,0,1,0,0,0,23,0,1,0,2,0,27,0,124,0,
+1,0,1,0,43,0,2,0,10,0,2,0,119,0,118,0,1,0,2,0,41,0,43,0,2,0,10,0,2,0,116,
+0,117,0,1,0,2,0,40,0,42,0,2,0,10,0,2,0,127,0,120,0,1,0,2,0,41,0,46,0,1,0,
+6,0,75,0,1,0,1,0,46,0,1,0,6,0,115,0,1,0,1,0,7,0,1,0,6,0,85,0,1,0,1,0,38,0,
+1,0,6,0,100,0,1,0,1,0,25,0,1,0,6,0,97,0,1,0,1,0,27,0,1,0,6,0,83,0,1,0,1,0,
+43,0,1,0,6,0,83,0,1,0,1,0,43,0,0,};
+#endif
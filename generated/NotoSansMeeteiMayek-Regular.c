@@ -0,0 +1,619 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansMeeteiMayek_Regular_ttf_size = 14876;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansMeeteiMayek_Regular_ttf");
+asm(".type fz_font_NotoSansMeeteiMayek_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansMeeteiMayek_Regular_ttf, 14876");
+asm(".balign 64");
+asm("fz_font_NotoSansMeeteiMayek_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansMeeteiMayek-Regular.ttf\"");
+#else
+const int fz_font_NotoSansMeeteiMayek_Regular_ttf_size = 14876;
+const char fz_font_NotoSansMeeteiMayek_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,2,92,2,94,0,0,50,244,0,0,0,90,71,
+80,79,83,0,255,23,108,0,0,51,80,0,0,4,186,71,83,85,66,197,207,199,56,0,0,
+56,12,0,0,2,16,79,83,47,50,123,26,107,192,0,0,1,104,0,0,0,96,99,109,97,112,
+0,135,3,45,0,0,3,40,0,0,0,100,103,97,115,112,0,7,0,7,0,0,50,232,0,0,0,12,
+103,108,121,102,102,225,193,39,0,0,4,68,0,0,36,190,104,101,97,100,254,198,
+17,68,0,0,0,236,0,0,0,54,104,104,101,97,8,143,254,4,0,0,1,36,0,0,0,36,104,
+109,116,120,97,170,221,32,0,0,1,200,0,0,1,94,108,111,99,97,165,138,174,235,
+0,0,3,140,0,0,0,184,109,97,120,112,0,99,0,97,0,0,1,72,0,0,0,32,110,97,109,
+101,144,153,187,218,0,0,41,4,0,0,6,34,112,111,115,116,170,117,88,234,0,0,
+47,40,0,0,3,189,0,1,0,0,0,1,10,61,124,228,88,113,95,15,60,245,0,11,8,0,0,
+0,0,0,205,54,145,234,0,0,0,0,210,112,42,86,246,210,253,117,9,46,8,84,0,0,
+0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,117,0,0,9,104,246,210,246,210,9,46,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,1,0,0,0,91,0,96,0,7,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,68,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,117,0,0,8,141,2,139,
+0,0,0,1,0,0,0,0,5,70,5,154,0,0,0,32,0,3,4,205,0,193,0,0,0,0,0,0,0,0,2,20,
+0,0,5,117,0,80,5,41,0,66,6,106,0,82,6,2,0,70,8,127,0,55,5,117,0,80,6,190,
+0,70,7,33,0,113,5,51,0,76,9,104,0,96,4,242,0,80,3,63,0,39,0,0,252,213,0,0,
+252,4,3,63,0,39,3,39,0,39,1,221,0,176,5,47,0,76,3,158,0,104,5,78,0,92,3,4,
+0,80,2,133,0,41,0,0,251,29,6,240,0,68,6,139,0,78,5,16,0,57,5,186,0,70,7,203,
+0,68,5,197,0,94,6,25,0,25,6,70,0,57,5,211,0,59,6,231,0,12,5,102,0,86,6,174,
+0,45,6,92,0,76,5,137,0,55,6,29,0,66,6,14,0,45,5,246,0,53,6,53,0,76,6,76,0,
+82,5,129,0,76,6,74,0,76,5,168,0,70,5,84,0,68,6,29,0,76,6,18,0,39,4,184,0,
+84,4,217,0,47,6,215,0,86,4,82,0,78,4,190,0,88,6,127,0,53,6,27,0,76,5,127,
+0,45,5,59,0,86,6,2,0,45,2,31,255,240,3,70,0,39,0,0,253,137,2,117,0,33,2,168,
+255,116,0,0,252,213,0,0,253,141,0,0,254,202,3,145,0,176,2,4,0,137,0,0,251,
+100,5,33,0,90,4,172,0,84,5,23,0,74,6,193,0,74,4,150,0,80,4,240,0,66,5,23,
+0,70,6,78,0,86,5,0,0,72,5,20,0,76,0,0,250,86,250,86,249,42,249,42,249,42,
+246,210,246,210,246,210,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,88,0,0,0,18,0,
+16,0,3,0,2,0,0,0,13,0,32,0,160,170,246,171,237,171,249,254,255,255,255,0,
+0,0,0,0,13,0,32,0,160,170,224,171,192,171,240,254,255,255,255,0,1,255,245,
+255,227,255,99,85,36,84,91,84,89,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,21,0,21,0,21,0,21,0,71,0,105,0,204,0,244,1,100,1,136,1,213,2,36,
+2,83,2,187,2,230,3,12,3,53,3,97,3,138,3,178,3,191,3,239,4,65,4,121,4,158,
+4,202,4,223,5,29,5,102,5,150,5,208,6,15,6,60,6,115,6,197,7,10,7,65,7,129,
+7,191,8,10,8,78,8,187,8,255,9,84,9,141,9,184,9,239,10,41,10,107,10,154,10,
+236,11,52,11,93,11,131,11,168,11,201,11,237,12,39,12,108,12,172,12,203,13,
+11,13,57,13,95,13,111,13,149,13,213,14,7,14,54,14,97,14,116,14,139,14,152,
+14,202,15,19,15,121,15,253,16,72,16,142,16,220,17,76,17,158,17,247,18,4,18,
+17,18,30,18,43,18,56,18,69,18,82,18,95,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,
+0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,
+104,4,230,0,0,1,0,80,255,252,4,250,5,88,0,30,0,0,19,18,33,32,0,17,17,38,35,
+34,7,6,35,34,39,55,22,51,50,55,54,51,50,23,17,52,38,35,34,6,7,223,150,1,110,
+1,4,1,19,148,165,105,151,144,106,238,137,100,99,182,96,160,157,87,65,82,193,
+180,129,172,65,4,29,1,59,254,225,254,238,252,213,82,41,41,162,110,123,43,
+43,20,2,123,174,194,110,129,0,1,0,66,0,0,4,225,5,70,0,17,0,0,19,53,33,21,
+33,17,16,33,32,55,23,6,6,35,32,0,17,17,66,4,159,252,140,1,120,1,0,111,141,
+61,252,193,254,240,254,238,4,176,150,150,253,84,254,150,252,78,152,176,1,
+33,1,16,2,127,0,1,0,82,255,248,6,23,5,68,0,70,0,0,1,33,53,52,54,51,50,22,
+21,20,6,6,7,6,6,21,20,22,23,7,46,2,53,52,54,55,54,53,52,38,35,34,6,21,20,
+23,33,54,55,52,38,35,34,6,21,20,23,22,22,21,20,6,6,7,39,54,54,53,52,38,39,
+46,2,53,52,54,51,50,22,2,131,1,98,154,117,131,160,33,62,121,71,80,119,65,
+43,76,143,88,94,111,164,58,67,56,63,14,253,78,14,3,66,55,68,57,164,112,92,
+88,141,78,43,66,119,80,72,121,59,35,158,133,121,149,4,72,10,98,144,154,127,
+57,105,108,156,86,141,84,70,98,8,162,10,90,141,97,92,196,127,187,135,47,78,
+76,74,43,47,47,43,72,78,78,47,135,187,131,194,90,97,141,90,10,162,8,98,70,
+84,141,86,154,106,107,59,127,154,142,0,1,0,70,0,0,5,190,5,70,0,26,0,0,51,
+52,54,51,50,23,19,51,7,20,51,50,17,51,20,6,35,34,39,3,21,35,52,38,35,34,21,
+70,172,153,156,72,163,164,4,176,183,165,184,162,139,88,149,166,86,101,174,
+170,207,111,4,60,70,201,1,15,197,213,88,252,8,12,98,133,231,0,0,3,0,55,255,
+248,8,39,5,78,0,53,0,64,0,75,0,0,1,34,6,7,7,22,18,21,20,6,35,34,38,53,52,
+18,0,54,51,50,22,22,23,62,2,51,50,22,21,17,35,17,52,38,35,34,15,2,22,18,21,
+20,6,35,34,38,53,52,54,55,38,38,19,20,22,51,50,54,53,52,3,6,6,5,20,22,51,
+50,54,53,52,3,6,6,3,94,57,133,109,41,135,134,201,166,162,207,131,1,117,203,
+102,70,123,121,118,129,121,129,74,174,164,174,80,96,129,166,35,12,141,129,
+199,168,163,207,116,154,135,141,178,110,86,86,111,199,90,104,252,149,113,
+84,86,113,201,90,105,4,170,107,151,53,189,254,254,112,156,176,182,150,104,
+1,10,1,246,154,62,114,156,166,112,62,197,207,252,70,3,178,137,119,254,51,
+10,191,254,252,110,152,180,182,150,102,244,211,190,121,252,182,104,103,103,
+108,127,1,11,125,195,80,104,103,103,108,125,1,13,125,195,0,0,3,0,80,0,0,5,
+29,5,70,0,11,0,15,0,19,0,0,51,17,33,17,33,53,33,21,33,17,33,17,39,17,35,17,
+35,17,35,17,182,1,164,253,246,4,205,253,227,1,162,170,248,166,248,3,123,1,
+51,152,152,254,205,252,133,143,2,84,253,172,2,84,253,172,0,2,0,70,255,254,
+6,92,5,76,0,36,0,46,0,0,37,36,17,16,35,34,6,6,21,35,46,2,35,32,17,20,22,23,
+21,36,0,17,52,18,55,54,54,51,50,22,23,32,17,16,0,5,3,54,55,38,38,35,34,6,
+7,22,4,35,1,145,235,111,113,61,168,2,57,105,104,255,0,205,196,254,236,254,
+209,219,203,34,195,131,135,197,37,1,151,254,219,254,236,203,51,164,20,113,
+84,78,112,21,166,154,18,1,152,1,116,88,194,154,158,188,88,254,140,220,200,
+4,156,4,1,47,1,17,243,1,19,6,117,137,133,121,253,246,254,237,254,213,8,3,
+51,195,65,64,82,74,70,57,0,2,0,113,255,250,6,158,5,70,0,40,0,51,0,0,1,32,
+17,17,35,17,52,38,35,34,6,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,35,
+34,6,21,17,35,17,16,33,50,22,23,54,54,1,20,22,51,50,54,53,52,3,6,6,5,78,1,
+80,174,82,92,39,84,93,126,157,111,201,166,162,206,98,170,148,141,53,94,80,
+176,1,82,112,203,137,150,196,253,226,112,84,86,113,199,92,104,5,70,254,125,
+252,61,3,186,127,113,55,92,164,219,238,100,156,176,182,150,98,221,238,192,
+119,113,127,252,70,3,195,1,131,142,190,196,136,252,26,104,103,103,108,131,
+1,9,127,193,0,0,2,0,76,255,242,4,236,5,70,0,7,0,27,0,0,1,17,35,17,35,53,33,
+21,1,53,33,50,30,2,21,20,6,7,3,39,19,54,54,53,52,38,35,1,113,166,127,4,160,
+252,253,1,166,46,94,77,49,4,4,141,149,133,2,3,70,66,4,178,251,78,4,176,150,
+148,254,207,143,21,52,88,68,18,38,22,253,21,30,2,209,14,24,11,61,50,0,5,0,
+96,255,238,9,16,5,70,0,36,0,46,0,56,0,61,0,66,0,0,19,33,21,6,4,7,22,22,21,
+20,6,35,34,38,53,52,54,55,38,39,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,
+36,39,1,20,22,51,50,54,53,52,39,6,5,20,22,51,50,54,53,52,39,6,1,22,23,54,
+55,33,22,23,54,55,96,8,176,75,254,206,122,176,125,224,182,186,221,116,183,
+205,189,196,201,176,125,223,182,187,221,117,182,119,254,215,88,5,107,127,
+102,100,127,227,229,252,20,127,103,100,127,227,230,3,117,164,184,154,207,
+249,79,164,185,153,207,5,70,150,41,219,111,163,203,103,174,204,206,172,95,
+200,176,181,129,133,179,163,203,103,174,204,206,172,95,200,176,105,215,49,
+252,191,109,131,135,105,165,183,166,182,109,131,135,105,165,183,166,2,139,
+123,149,135,137,123,149,135,137,0,3,0,80,0,0,4,143,5,80,0,8,0,12,0,21,0,0,
+33,33,17,16,0,51,32,0,17,1,33,17,33,37,52,38,35,34,6,21,21,33,4,143,251,193,
+1,37,248,1,0,1,34,252,107,2,237,253,19,2,237,196,180,179,194,2,237,3,23,1,
+8,1,49,254,209,254,246,253,122,1,177,239,187,200,203,184,94,0,0,2,0,39,255,
+252,3,10,6,195,0,13,0,22,0,0,5,17,36,17,52,54,51,32,17,21,51,21,35,17,3,52,
+38,35,34,21,20,22,51,1,154,254,141,145,121,1,23,194,194,174,50,51,98,106,
+93,4,4,176,10,1,13,114,142,254,241,106,158,251,80,5,184,72,53,108,76,47,0,
+1,252,213,254,100,255,129,255,133,0,28,0,0,7,22,21,20,35,34,39,6,35,34,53,
+55,51,7,20,51,50,54,53,53,51,21,20,22,51,50,54,53,39,135,8,192,101,47,47,
+107,190,8,113,6,82,32,56,118,50,32,47,37,6,123,16,70,203,80,80,203,86,80,
+96,39,43,94,94,39,43,47,49,80,0,2,252,4,5,174,253,240,8,84,0,15,0,25,0,0,
+1,22,22,21,20,6,35,34,38,53,52,54,55,38,38,39,1,52,39,6,21,20,22,51,50,54,
+252,76,200,220,117,96,97,112,73,64,35,110,62,1,98,59,96,43,33,26,53,8,84,
+119,252,108,90,109,111,92,72,98,45,39,69,39,254,156,82,51,63,76,41,43,43,
+0,0,2,0,39,255,252,2,227,6,195,0,15,0,25,0,0,5,17,35,34,38,53,52,54,51,32,
+17,17,51,21,35,17,3,52,38,35,34,21,20,51,51,55,1,154,23,168,180,145,121,1,
+23,155,155,174,50,51,98,160,20,19,4,4,176,145,134,114,142,254,241,254,135,
+157,252,94,5,184,72,53,108,125,2,0,0,2,0,39,255,252,2,227,6,195,0,15,0,25,
+0,0,23,17,35,53,51,17,16,33,50,22,21,20,6,35,35,17,17,23,51,50,53,52,35,34,
+6,21,195,156,156,1,22,119,147,178,170,22,20,19,159,98,51,49,4,3,162,157,1,
+121,1,15,140,116,134,145,251,80,5,78,2,125,108,53,72,0,0,1,0,176,255,195,
+1,88,5,129,0,3,0,0,23,17,51,17,176,168,61,5,190,250,66,0,0,2,0,76,0,170,4,
+219,3,215,0,12,0,26,0,0,1,6,4,35,34,36,39,55,22,33,50,54,55,17,38,38,35,34,
+6,7,39,54,36,51,50,4,23,4,219,108,254,221,187,190,254,229,108,108,162,1,55,
+154,236,90,90,236,154,151,234,88,108,110,1,23,192,187,1,35,108,3,117,135,
+111,106,140,98,203,90,113,252,211,115,90,92,113,100,138,106,108,136,0,3,0,
+104,255,250,3,84,6,205,0,33,0,45,0,56,0,0,37,6,35,34,38,53,52,54,55,62,2,
+53,52,38,35,34,7,39,54,51,50,22,21,20,7,6,6,21,20,22,51,50,55,1,52,54,51,
+50,22,21,20,6,35,34,38,7,22,51,50,55,23,6,6,35,34,39,3,84,131,252,166,199,
+115,205,151,60,31,99,82,149,70,139,111,247,152,182,203,215,139,121,84,160,
+100,254,178,49,35,35,49,49,35,35,49,114,61,139,146,55,121,33,168,121,246,
+75,225,231,174,145,90,158,150,110,58,55,37,80,84,146,70,215,168,143,154,137,
+150,149,68,90,82,178,5,66,35,49,49,35,35,49,49,29,133,129,41,94,104,198,0,
+2,0,92,255,238,4,248,5,70,0,11,0,31,0,0,1,54,54,53,52,38,35,34,6,21,20,22,
+19,50,22,21,20,6,7,22,1,7,1,1,39,0,55,38,38,53,52,54,2,170,127,102,125,104,
+104,125,100,125,190,222,134,168,140,1,88,107,254,29,254,29,107,1,113,112,
+170,129,220,2,123,98,154,88,106,123,123,106,88,148,2,99,197,172,107,202,137,
+134,254,211,118,1,200,254,56,118,1,74,102,140,200,109,174,195,0,1,0,80,255,
+238,2,178,5,70,0,20,0,0,19,55,50,22,21,20,6,7,23,23,7,38,1,54,54,53,52,38,
+35,35,7,80,74,178,215,131,131,194,211,119,90,254,115,158,131,131,103,20,21,
+5,66,4,195,174,125,203,116,222,233,100,100,1,213,137,180,97,114,113,2,0,0,
+2,0,41,0,0,2,82,2,229,0,16,0,28,0,0,51,53,38,39,38,53,52,54,51,50,22,21,20,
+7,6,7,21,3,34,6,21,20,22,51,50,54,53,52,38,227,61,47,78,158,112,121,162,82,
+52,65,84,51,70,70,51,56,71,71,242,17,44,72,106,111,149,151,109,106,72,45,
+17,241,2,100,71,54,55,70,70,55,54,71,0,1,251,29,253,117,252,240,255,72,0,
+11,0,0,1,53,35,53,51,53,51,21,51,21,35,21,251,195,166,166,137,164,164,253,
+117,170,129,168,168,129,170,0,0,7,0,68,0,0,6,139,5,70,0,7,0,11,0,15,0,19,
+0,23,0,27,0,31,0,0,33,33,17,35,53,33,21,35,3,17,5,17,37,37,17,33,1,51,17,
+7,53,55,17,35,33,33,21,37,1,33,53,5,6,61,250,74,67,6,71,78,163,254,237,252,
+170,1,12,254,244,1,180,254,254,254,254,2,181,254,237,1,19,251,151,1,12,254,
+244,4,174,152,152,251,223,3,117,213,253,96,189,205,2,151,251,223,2,33,197,
+173,194,1,86,219,209,251,233,219,208,0,0,1,0,78,255,254,6,59,5,90,0,44,0,
+0,37,54,18,17,52,38,38,35,34,6,6,7,35,2,38,35,34,6,6,21,16,18,23,21,38,36,
+2,53,52,18,54,51,32,19,51,54,54,51,50,18,17,20,2,4,7,4,10,189,204,48,92,87,
+96,113,61,2,168,3,125,132,91,101,52,202,191,171,254,252,140,106,191,135,1,
+9,65,8,41,184,141,188,193,133,254,255,171,158,8,1,61,1,25,159,196,91,106,
+223,181,1,2,250,90,194,162,254,222,254,202,4,160,3,188,1,90,227,199,1,15,
+136,254,227,141,146,254,200,254,218,232,254,172,189,5,0,0,1,0,57,255,248,
+4,164,5,70,0,29,0,0,1,38,35,34,6,21,20,22,51,50,54,55,23,6,4,35,34,0,53,16,
+33,50,23,17,33,53,33,21,35,17,3,178,123,217,156,165,178,160,117,229,90,106,
+116,254,250,164,231,254,229,1,229,190,162,252,135,4,107,74,2,215,166,196,
+181,175,198,97,82,115,104,111,1,19,251,2,6,110,1,18,150,150,254,39,0,2,0,
+70,255,250,5,109,5,70,0,31,0,35,0,0,1,20,22,51,50,55,23,6,35,34,38,53,52,
+55,33,17,35,17,33,17,35,17,35,53,33,21,33,17,33,7,6,6,1,33,17,33,4,86,101,
+96,24,25,33,38,69,152,176,109,254,209,166,254,225,166,71,5,22,253,156,2,37,
+2,88,109,252,221,1,31,254,225,1,82,90,103,5,146,10,172,141,160,90,253,211,
+2,45,253,211,4,176,150,150,254,14,145,9,126,1,24,1,242,0,1,0,68,0,0,7,162,
+5,70,0,39,0,0,33,17,35,17,35,17,33,22,18,21,20,6,6,7,39,54,54,53,52,2,39,
+53,33,21,6,2,21,20,22,23,7,46,2,53,52,18,55,33,17,4,94,215,168,254,86,130,
+141,113,209,143,47,164,180,173,141,7,33,152,161,180,164,45,143,211,113,143,
+125,254,88,4,176,251,80,4,176,157,254,180,154,139,239,155,24,150,35,224,175,
+153,1,77,130,150,150,136,254,189,157,172,227,35,150,24,154,237,142,155,1,
+81,151,251,80,0,0,1,0,94,255,242,5,123,5,70,0,25,0,0,37,6,33,34,36,2,53,52,
+19,35,53,33,21,35,3,39,19,33,2,17,20,22,22,51,50,55,5,23,249,254,222,179,
+254,225,159,92,137,5,29,103,227,151,194,253,80,106,110,203,133,228,206,201,
+215,165,1,48,204,247,1,38,150,150,254,74,80,1,102,254,238,254,245,157,228,
+122,174,0,0,2,0,25,0,0,5,221,5,70,0,24,0,30,0,0,19,33,21,6,2,21,20,22,23,
+7,46,2,39,33,6,2,7,39,54,54,53,52,2,39,1,33,18,55,33,22,47,5,150,141,171,
+174,162,47,138,205,109,3,254,39,5,245,204,47,163,174,167,148,1,209,1,246,
+50,210,252,10,206,5,70,150,132,254,175,147,174,225,35,150,21,151,231,142,
+221,254,220,32,150,35,225,174,161,1,70,129,254,4,1,1,251,251,0,2,0,57,255,
+250,5,242,5,186,0,42,0,53,0,0,19,33,50,23,54,55,23,6,7,22,22,21,20,6,6,35,
+34,38,53,52,54,55,38,35,33,22,18,21,20,6,35,34,39,55,22,22,51,50,54,53,52,
+0,39,1,20,22,51,50,54,53,52,38,39,6,117,2,98,230,188,148,67,104,136,42,125,
+111,81,143,88,147,172,77,70,128,197,254,161,197,219,213,172,203,133,125,45,
+107,51,102,117,254,246,221,3,164,84,77,69,87,101,89,127,5,70,78,138,56,112,
+112,42,81,177,106,93,138,73,171,149,70,157,74,47,186,254,110,184,197,237,
+168,108,62,61,159,130,188,1,161,159,254,164,89,97,93,77,79,141,48,134,0,0,
+1,0,59,0,0,5,141,5,70,0,45,0,0,19,33,21,33,18,23,54,54,51,50,22,22,21,20,
+7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,55,52,38,35,34,6,7,6,6,7,39,54,
+54,53,52,2,39,70,5,71,251,123,227,37,53,164,125,96,158,86,19,20,60,39,37,
+102,76,110,97,118,29,5,97,81,118,150,51,40,221,178,47,164,172,182,143,5,70,
+150,254,240,221,111,110,75,136,90,46,81,82,41,64,35,108,76,115,98,32,174,
+44,69,86,172,198,165,210,37,147,41,211,162,151,1,99,133,0,0,3,0,12,0,0,6,
+168,5,70,0,25,0,29,0,33,0,0,19,54,51,50,22,21,20,7,51,17,33,21,35,17,51,21,
+33,53,54,54,53,52,38,35,34,7,1,33,17,33,1,51,17,35,12,67,103,150,172,96,194,
+4,68,76,86,249,233,93,106,85,81,55,57,4,106,1,0,255,0,254,94,254,254,2,139,
+31,154,141,133,107,4,179,148,251,225,147,147,19,120,79,77,93,23,254,147,4,
+31,251,225,4,31,0,0,1,0,86,255,250,5,12,5,70,0,43,0,0,1,20,22,51,50,54,53,
+52,38,39,55,22,22,21,20,6,35,34,39,6,6,35,34,38,53,52,54,55,23,6,6,21,20,
+22,51,50,54,53,17,33,53,33,21,33,3,20,98,81,78,81,66,56,30,119,135,170,149,
+180,80,50,141,74,150,167,133,117,29,55,62,79,83,77,97,253,229,4,182,254,8,
+1,74,89,100,91,69,50,72,11,154,26,153,108,143,164,143,69,74,164,143,109,152,
+26,154,11,72,50,71,89,101,88,3,100,152,152,0,1,0,45,0,0,6,127,5,70,0,34,0,
+0,1,0,17,20,6,6,7,39,54,54,53,52,2,39,53,33,21,6,2,21,20,22,23,7,38,36,0,
+3,55,22,23,39,53,16,1,1,39,1,12,110,221,142,45,170,180,168,151,6,30,165,166,
+183,169,47,124,254,253,254,254,180,137,125,96,2,1,25,4,176,254,199,254,188,
+150,233,156,24,164,36,212,163,145,1,84,144,146,146,162,254,178,153,146,215,
+44,150,30,174,1,30,1,6,96,198,118,23,20,1,61,1,52,0,0,1,0,76,255,246,6,8,
+5,70,0,50,0,0,1,51,50,54,53,52,38,35,33,34,6,21,20,22,51,51,21,1,39,1,46,
+2,53,52,55,35,53,33,21,35,22,21,20,6,6,7,7,22,23,22,22,51,50,55,23,6,35,34,
+39,3,3,162,90,142,151,176,148,254,135,143,170,148,137,94,254,72,125,1,145,
+103,178,102,133,188,5,188,205,140,101,184,98,9,119,80,37,70,45,26,45,31,48,
+69,133,116,244,2,125,146,130,131,156,149,131,144,139,170,254,35,116,1,146,
+2,100,180,121,179,110,150,150,117,184,110,175,103,3,2,147,105,50,61,17,152,
+18,157,1,72,0,2,0,55,255,255,5,88,5,70,0,3,0,43,0,0,19,33,21,33,1,22,22,51,
+50,54,53,52,38,35,34,6,6,7,14,2,35,34,39,55,23,50,54,54,55,54,18,51,50,22,
+22,21,20,6,6,35,34,38,39,55,5,33,250,223,3,70,12,73,21,79,85,82,73,80,118,
+99,35,41,132,188,141,41,43,16,45,124,134,93,39,64,235,166,88,144,83,79,141,
+87,51,107,29,5,70,150,253,182,9,21,90,82,80,94,95,207,145,165,207,112,5,146,
+1,86,175,155,249,1,3,74,139,100,101,142,75,30,20,0,0,2,0,66,0,0,5,193,5,70,
+0,66,0,75,0,0,19,33,21,33,6,21,22,0,51,50,55,38,38,53,52,54,51,50,22,21,20,
+6,7,22,22,21,20,7,35,38,35,34,6,7,35,38,38,35,34,6,7,35,62,2,51,50,22,23,
+54,54,51,50,22,23,54,53,52,39,6,35,32,0,3,52,55,35,1,20,23,54,53,52,35,34,
+6,66,5,127,251,96,4,2,1,24,254,136,85,49,55,151,115,115,147,92,100,96,68,
+84,178,9,127,72,72,3,168,5,89,78,85,100,3,168,5,87,149,101,101,141,28,20,
+124,87,87,123,24,16,160,139,168,254,189,254,131,2,6,57,4,8,78,127,99,46,60,
+5,70,150,40,66,245,254,251,33,54,116,47,118,138,146,112,86,132,65,109,133,
+100,98,113,197,90,107,97,106,102,101,101,165,82,87,83,76,88,100,86,40,40,
+94,157,47,1,88,1,45,65,50,254,152,87,81,65,99,110,57,0,1,0,45,255,246,5,199,
+5,70,0,43,0,0,19,33,21,33,22,22,23,23,30,2,21,20,6,35,34,38,39,55,22,51,50,
+54,53,52,38,38,39,38,38,39,22,21,20,0,7,39,54,54,53,52,2,39,35,76,5,112,251,
+99,108,211,156,133,234,238,112,198,167,70,142,50,94,83,85,92,105,81,156,187,
+90,188,91,78,254,241,233,47,187,198,192,158,4,5,70,150,139,126,44,39,68,133,
+170,106,180,205,47,41,127,62,129,107,74,104,79,52,26,62,49,156,145,207,254,
+231,36,160,26,194,159,149,1,114,142,0,0,1,0,53,255,229,5,207,5,70,0,57,0,
+0,19,33,21,33,22,23,54,51,50,23,22,22,51,50,54,55,23,6,6,35,34,39,38,38,35,
+34,7,23,21,20,7,54,51,50,23,22,51,50,54,55,23,6,35,34,39,38,35,34,6,7,38,
+39,18,17,52,38,38,39,53,5,92,251,107,136,46,100,87,74,141,49,96,51,65,140,
+55,76,74,171,91,59,115,53,115,69,73,93,2,92,123,94,115,147,156,112,84,122,
+48,121,137,238,104,148,164,110,109,182,57,75,67,185,62,105,61,5,70,150,227,
+195,37,31,11,19,43,47,133,63,42,27,11,20,35,16,17,204,204,33,35,39,51,62,
+102,162,35,39,52,45,34,40,1,33,1,2,112,220,202,72,0,3,0,76,255,248,5,254,
+5,70,0,16,0,24,0,31,0,0,37,4,33,34,36,2,53,52,55,35,53,33,21,33,17,54,55,
+1,20,18,23,17,33,6,6,1,50,55,17,35,17,22,5,254,254,240,254,157,238,254,133,
+188,58,84,5,157,254,181,135,119,251,118,166,164,254,255,32,41,2,119,64,45,
+242,68,178,186,196,1,90,238,226,202,150,150,252,4,43,86,1,207,207,254,222,
+73,3,230,88,223,253,22,5,4,28,251,233,10,0,1,0,82,0,0,6,14,5,70,0,26,0,0,
+1,6,6,35,32,17,17,35,17,35,17,35,17,35,17,35,53,33,21,33,17,20,22,51,50,54,
+55,6,14,19,145,114,254,244,220,170,239,166,127,5,129,254,184,55,56,56,55,
+10,3,41,140,147,1,27,1,139,251,80,4,176,251,80,4,176,150,148,254,105,67,60,
+93,89,0,1,0,76,255,242,5,43,5,70,0,32,0,0,19,33,21,35,1,23,37,23,7,6,6,21,
+20,22,51,50,55,23,23,6,6,35,34,38,38,53,52,54,55,5,39,1,33,76,4,223,129,252,
+180,2,2,232,49,187,109,134,119,98,99,114,37,39,78,154,71,106,168,97,53,51,
+254,144,117,2,223,252,199,5,70,150,254,2,10,113,162,27,15,133,100,101,118,
+70,64,65,57,35,83,156,115,71,120,40,57,246,1,184,0,3,0,76,0,0,5,248,5,115,
+0,21,0,30,0,34,0,0,1,38,38,35,34,6,21,17,33,17,52,18,51,50,22,23,54,54,51,
+50,22,23,5,52,38,35,34,6,21,21,33,1,33,17,33,5,82,2,69,85,91,75,252,60,246,
+233,135,177,63,27,145,110,150,161,5,253,112,166,149,148,163,2,114,253,142,
+2,114,253,142,3,152,158,161,119,153,252,57,3,88,245,1,19,90,98,100,107,229,
+224,41,151,169,175,163,160,253,190,1,177,0,3,0,70,255,238,5,92,5,70,0,24,
+0,35,0,40,0,0,19,33,21,6,4,7,30,2,21,20,6,6,35,34,38,38,53,52,54,55,46,2,
+39,1,20,22,51,50,54,53,52,38,39,6,3,22,23,54,55,70,5,22,95,254,189,127,130,
+112,59,94,192,119,117,185,106,126,173,72,199,231,42,1,168,128,101,99,128,
+118,109,229,158,214,173,156,227,5,70,150,47,213,111,121,141,135,72,111,168,
+99,89,169,120,98,209,164,64,144,141,20,252,191,108,132,134,106,80,181,87,
+163,2,136,128,144,138,134,0,1,0,68,255,238,5,8,5,70,0,28,0,0,1,14,4,21,20,
+22,51,50,55,22,22,23,14,2,35,34,38,38,53,52,0,37,33,53,33,5,8,245,218,179,
+128,74,154,152,160,151,14,84,19,79,123,149,90,137,225,109,1,76,1,109,252,
+129,4,196,4,178,126,131,134,140,150,83,144,155,146,16,84,17,73,70,43,111,
+196,133,207,1,121,194,150,0,0,2,0,76,255,250,5,236,5,70,0,42,0,52,0,0,1,6,
+6,21,20,22,51,55,23,6,35,34,38,38,53,52,55,4,7,22,22,21,20,6,6,35,34,38,38,
+53,16,37,38,38,39,53,33,21,33,22,23,54,37,1,52,39,4,21,20,22,51,50,54,5,76,
+75,85,126,118,55,21,23,53,122,186,104,154,254,234,202,81,79,99,173,113,94,
+167,97,1,82,138,151,92,5,112,251,117,191,104,220,1,112,254,20,141,254,244,
+112,86,101,110,3,139,102,246,115,136,144,4,154,4,102,192,134,230,252,57,83,
+109,192,96,124,174,91,92,165,107,1,24,193,149,144,76,150,150,182,117,92,78,
+253,82,142,182,154,201,95,107,123,0,2,0,39,0,10,5,217,5,70,0,38,0,49,0,0,
+37,6,35,38,38,53,52,54,55,33,21,20,6,35,34,38,38,53,52,54,51,51,17,33,53,
+33,21,33,17,33,21,6,6,21,20,22,51,50,55,1,35,34,6,21,20,22,51,50,54,53,5,
+217,90,80,148,171,50,50,254,158,186,171,100,157,87,216,198,117,253,223,5,
+137,253,66,2,151,115,133,97,77,51,44,252,170,131,108,124,97,75,93,98,43,33,
+2,168,142,60,113,42,134,184,203,95,160,87,159,169,2,2,150,150,253,254,149,
+3,106,94,79,91,20,1,97,96,85,82,104,129,123,0,1,0,84,255,250,4,121,5,70,0,
+25,0,0,33,53,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,17,33,53,33,
+21,33,17,2,152,101,149,136,186,102,111,78,125,100,82,74,123,27,253,188,4,
+37,254,196,106,112,190,135,114,158,50,141,71,107,77,98,106,85,3,92,152,152,
+251,82,0,0,1,0,47,0,0,4,131,5,70,0,22,0,0,33,17,33,17,20,6,35,34,3,55,22,
+22,51,50,54,53,17,33,53,33,21,35,17,3,162,254,196,139,121,243,64,154,23,64,
+60,53,50,254,151,4,41,59,4,176,254,12,132,148,1,14,51,89,77,71,52,1,246,150,
+150,251,80,0,0,3,0,86,0,0,6,125,5,70,0,11,0,15,0,19,0,0,33,33,17,35,53,33,
+21,35,17,35,17,35,1,33,17,33,1,51,17,35,4,147,252,9,70,6,39,70,166,254,252,
+177,1,4,254,252,1,174,252,252,4,174,152,152,254,49,1,207,251,225,4,31,251,
+225,4,31,0,1,0,78,0,0,4,2,5,70,0,18,0,0,33,53,16,0,33,35,53,51,50,4,23,51,
+17,33,53,33,21,35,17,3,25,254,221,254,227,72,72,231,1,6,74,9,253,53,3,180,
+70,80,1,69,1,80,150,135,138,2,70,150,150,251,80,0,0,2,0,88,0,0,4,127,5,70,
+0,15,0,19,0,0,1,33,17,35,17,33,17,35,17,35,53,33,21,33,17,41,2,17,33,4,61,
+254,203,166,254,226,166,70,4,39,254,137,1,53,253,7,1,30,254,226,2,45,253,
+211,2,45,253,211,4,174,152,152,254,16,1,240,0,1,0,53,0,0,6,74,5,70,0,35,0,
+0,33,17,33,22,18,21,20,6,6,7,39,54,54,53,52,2,39,53,33,21,6,2,21,20,22,23,
+7,46,2,53,52,18,55,33,17,2,238,254,61,129,137,113,209,143,47,166,180,166,
+149,5,213,141,168,178,164,45,143,210,114,140,130,254,59,4,176,157,254,178,
+152,140,238,155,24,150,35,227,172,154,1,71,135,150,150,139,254,178,143,173,
+226,35,150,24,155,238,140,150,1,80,157,251,80,0,0,1,0,76,255,248,5,207,5,
+70,0,43,0,0,37,4,33,34,36,2,53,16,19,35,53,33,21,35,3,39,19,33,2,21,20,22,
+51,50,54,55,23,6,6,35,34,38,53,52,55,35,2,17,20,22,22,51,32,55,5,164,254,
+204,254,162,190,254,199,162,82,127,5,131,125,186,150,166,254,88,88,111,102,
+58,139,57,92,86,189,83,172,193,76,207,90,123,228,155,1,40,249,201,209,176,
+1,42,193,1,4,1,25,150,150,254,156,53,1,47,254,248,131,112,124,45,39,125,55,
+55,204,185,146,247,254,228,254,255,161,233,122,179,0,2,0,45,255,250,5,41,
+5,86,0,28,0,38,0,0,19,32,23,54,54,55,23,0,7,22,22,21,20,6,6,35,34,38,38,53,
+52,55,38,35,34,7,39,1,23,19,20,22,51,50,54,53,52,37,6,252,1,51,174,58,198,
+219,113,254,219,129,194,193,97,167,92,115,174,98,104,147,189,73,82,111,1,
+64,147,201,110,99,87,111,254,201,96,3,100,37,77,226,228,105,254,219,173,64,
+219,150,107,165,92,89,166,122,153,172,21,6,125,2,18,82,252,113,108,113,109,
+93,214,89,150,0,0,3,0,86,0,0,4,225,5,70,0,7,0,11,0,15,0,0,33,33,17,35,53,
+33,21,35,1,51,17,35,1,51,17,35,4,147,252,9,70,4,139,78,254,89,253,253,254,
+92,254,254,4,174,152,152,251,225,4,31,251,225,4,31,0,1,0,45,0,0,5,193,5,70,
+0,40,0,0,1,22,22,51,50,54,53,52,38,35,34,7,23,20,0,7,39,54,54,53,52,2,39,
+53,33,21,33,22,23,54,51,32,4,21,20,6,6,35,34,38,39,3,227,16,76,68,68,84,192,
+218,127,178,4,254,241,233,47,187,198,193,161,5,114,251,97,196,76,193,139,
+1,44,1,26,85,145,88,141,164,19,1,109,95,86,97,79,138,137,41,70,207,254,231,
+36,160,26,194,159,155,1,108,142,150,150,222,239,43,206,209,104,147,81,150,
+139,0,0,2,255,240,4,20,1,219,6,186,0,15,0,27,0,0,19,22,22,21,20,6,35,34,38,
+53,52,54,55,38,38,39,1,52,38,39,6,6,21,20,22,51,50,54,55,207,213,121,92,95,
+114,74,63,34,110,62,1,98,32,27,44,53,44,32,31,49,6,186,123,248,108,90,109,
+110,93,70,101,44,38,72,38,254,155,38,71,24,27,65,47,40,44,49,0,2,0,39,255,
+252,3,10,6,195,0,15,0,24,0,0,23,17,35,53,51,53,52,54,51,50,22,21,20,6,7,17,
+17,50,54,53,52,35,34,6,21,233,194,194,144,131,122,148,188,182,103,95,98,51,
+49,4,4,172,158,110,137,134,137,119,137,144,2,251,84,5,74,65,68,102,54,71,
+0,1,253,137,5,233,255,68,7,123,0,3,0,0,1,1,7,1,253,240,1,84,91,254,160,7,
+123,254,221,111,1,13,0,2,0,33,3,78,2,74,5,76,0,11,0,23,0,0,19,52,54,51,50,
+22,21,20,6,35,34,38,37,34,6,21,20,22,51,50,54,53,52,38,33,159,111,120,163,
+160,123,114,156,1,14,49,72,69,52,56,71,74,4,72,110,150,150,110,106,144,144,
+237,73,52,54,71,69,56,53,72,0,2,255,116,4,19,2,108,6,192,0,33,0,43,0,0,1,
+20,14,2,35,35,53,51,50,62,2,55,34,38,39,51,22,22,23,38,38,53,52,54,51,50,
+30,2,21,20,6,39,20,22,23,54,54,53,52,35,34,1,124,13,52,104,90,81,84,41,47,
+23,6,2,182,196,5,137,3,121,114,8,7,106,97,43,73,52,29,119,152,7,8,66,61,68,
+74,5,28,48,94,76,47,141,21,34,41,20,204,218,157,149,1,29,48,34,97,105,30,
+52,71,41,92,105,184,25,38,27,15,46,36,75,0,1,252,213,254,102,255,129,255,
+135,0,34,0,0,3,55,55,52,38,35,34,6,21,21,35,53,52,38,35,34,6,21,20,23,35,
+38,53,52,54,51,50,23,54,54,51,50,21,20,7,248,3,3,37,47,32,50,118,51,37,45,
+37,6,113,8,98,92,108,46,23,78,47,192,8,254,102,27,53,50,47,44,38,95,95,38,
+44,47,50,59,21,56,30,102,101,80,38,42,203,66,20,0,0,2,253,141,5,129,0,158,
+7,223,0,20,0,29,0,0,1,30,2,23,53,52,54,51,50,22,21,20,6,7,21,35,53,38,38,
+53,1,54,54,53,52,35,34,6,21,254,27,2,43,88,71,114,106,94,125,157,138,144,
+170,176,1,234,76,73,69,44,36,7,215,114,122,69,4,98,106,113,117,88,103,130,
+4,164,164,5,205,224,254,203,2,52,58,78,48,50,0,2,254,202,5,116,0,106,8,17,
+0,14,0,25,0,0,1,54,55,38,38,53,52,54,51,50,22,21,20,6,7,19,54,53,52,38,35,
+34,6,21,20,22,254,210,108,52,68,100,119,88,87,122,165,153,141,50,45,35,35,
+43,39,5,212,85,64,29,134,63,84,114,112,82,96,247,132,1,77,59,62,38,56,52,
+34,29,54,0,0,2,0,176,255,195,2,238,5,129,0,3,0,7,0,0,23,17,51,17,51,17,51,
+17,176,168,240,166,61,5,190,250,66,5,190,250,66,0,0,1,0,137,0,154,1,137,1,
+160,0,11,0,0,1,50,22,21,20,6,35,34,38,53,52,54,1,6,56,75,74,57,51,74,75,1,
+160,76,53,56,77,77,56,54,75,0,0,1,251,100,254,143,5,49,255,33,0,3,0,0,5,33,
+21,33,251,100,9,205,246,51,223,146,0,2,0,90,255,231,4,184,5,92,0,12,0,24,
+0,0,19,16,0,51,32,0,17,20,2,4,35,34,0,1,34,2,17,16,18,51,50,18,17,16,2,90,
+1,39,254,1,15,1,42,138,254,254,173,252,254,215,2,37,186,197,194,189,199,192,
+193,2,147,1,73,1,128,254,137,254,174,204,254,200,168,1,113,3,107,254,231,
+254,244,254,246,254,237,1,0,1,29,1,30,1,7,0,0,1,0,84,255,227,4,80,5,82,0,
+50,0,0,1,22,22,51,50,54,53,52,33,34,6,21,20,22,23,22,22,21,20,6,35,34,38,
+39,55,22,22,51,50,54,53,52,38,39,46,2,53,52,36,51,50,22,22,21,20,6,35,34,
+38,39,2,168,16,74,37,61,68,254,182,169,187,153,189,176,131,163,130,101,171,
+60,134,36,107,49,62,75,121,141,172,141,78,1,23,241,146,228,126,150,143,81,
+141,44,3,156,31,49,73,72,228,134,118,98,171,94,91,166,109,120,145,94,87,81,
+53,65,69,60,66,119,77,93,123,147,96,182,215,96,171,104,142,161,79,69,0,2,
+0,74,255,238,4,227,5,82,0,61,0,72,0,0,1,22,22,51,50,54,53,52,38,35,34,6,21,
+20,22,23,23,55,51,55,51,50,22,21,20,7,39,54,53,52,38,39,22,21,20,6,35,34,
+38,53,52,54,55,39,39,46,2,53,52,36,51,50,22,22,21,20,6,35,34,38,39,19,52,
+39,6,6,21,20,22,51,50,54,2,168,16,74,37,61,68,172,162,174,186,158,190,100,
+12,9,31,34,228,247,18,164,18,136,130,80,161,124,129,153,89,81,19,28,153,149,
+81,1,24,246,146,230,126,151,140,84,144,38,186,86,63,84,58,60,53,62,3,156,
+31,49,73,72,114,114,133,126,97,176,95,51,2,2,204,185,72,70,33,58,61,116,134,
+4,82,98,112,144,131,112,73,131,46,10,19,83,129,148,94,190,214,96,170,105,
+144,159,82,66,253,165,105,53,16,88,60,42,58,57,0,3,0,74,255,238,6,150,5,82,
+0,10,0,86,0,95,0,0,37,52,39,6,6,21,20,22,51,50,54,3,22,22,51,50,54,53,52,
+38,35,34,6,21,20,22,22,23,23,54,51,50,23,54,54,51,50,22,23,7,38,38,35,34,
+7,22,22,21,20,6,35,34,38,53,52,55,38,35,34,7,22,21,20,6,35,34,38,53,52,55,
+46,2,53,52,36,51,50,22,22,21,20,6,35,34,38,39,1,52,39,6,21,20,22,51,50,2,
+213,82,61,82,57,57,45,66,47,19,75,37,61,66,173,163,172,184,67,121,166,88,
+120,114,158,116,54,100,59,86,134,59,111,41,77,56,42,40,52,44,120,99,91,118,
+86,64,63,81,54,74,149,122,126,154,170,191,157,82,1,24,244,146,231,127,148,
+141,86,141,39,2,215,72,76,36,34,78,233,96,62,16,89,59,42,58,50,2,235,32,48,
+72,73,114,114,132,127,74,117,99,88,48,21,55,34,37,59,74,90,50,44,22,53,96,
+60,94,109,110,89,106,95,22,16,83,100,116,131,132,111,150,92,102,134,155,100,
+190,214,96,169,106,143,160,80,68,253,155,82,60,58,86,42,50,0,1,0,80,255,231,
+4,66,5,82,0,52,0,0,1,54,51,50,22,21,20,6,6,35,34,36,53,52,54,54,55,54,54,
+53,52,38,35,34,6,7,39,62,2,51,50,22,21,20,6,6,7,14,2,21,20,22,51,50,54,53,
+52,35,34,6,7,2,25,98,176,133,146,126,226,146,242,254,242,89,181,189,137,94,
+76,61,87,112,10,158,16,104,154,93,130,169,62,113,165,137,136,77,181,171,156,
+176,119,47,64,26,1,252,145,159,140,107,175,97,217,193,102,161,138,88,67,93,
+53,58,72,100,91,35,100,132,69,154,123,70,105,88,81,67,103,118,68,127,135,
+125,108,154,39,43,0,2,0,66,0,0,4,182,5,76,0,35,0,46,0,0,1,54,53,52,38,35,
+34,6,21,20,22,23,53,52,54,51,50,22,21,20,6,7,17,35,17,38,38,53,52,36,33,50,
+4,21,20,7,37,34,6,6,21,50,54,54,53,52,38,3,215,51,207,178,203,204,117,106,
+121,129,107,120,161,146,170,187,212,1,45,1,30,245,1,52,92,254,115,34,35,15,
+57,64,30,34,3,111,56,64,94,109,147,154,118,144,21,52,139,133,123,104,117,
+128,7,254,49,1,215,29,231,168,223,234,212,167,116,105,45,27,60,98,23,40,40,
+36,46,0,0,2,0,70,0,0,4,225,5,76,0,38,0,49,0,0,1,54,53,52,38,35,32,17,20,22,
+23,53,52,54,51,50,22,21,20,6,7,17,1,23,4,1,35,17,38,38,53,52,36,33,50,4,21,
+20,7,37,34,6,6,21,50,54,54,53,52,38,3,221,49,207,178,254,105,118,107,119,
+129,107,120,163,148,2,10,92,254,243,254,171,168,190,211,1,48,1,27,245,1,52,
+92,254,115,34,35,15,57,64,30,34,3,111,51,69,94,109,254,219,115,153,23,52,
+140,132,123,104,114,130,8,254,227,1,152,117,203,254,246,1,215,28,235,175,
+217,230,212,167,116,105,45,27,60,98,23,40,40,36,46,0,0,3,0,86,255,231,6,0,
+5,111,0,53,0,64,0,75,0,0,19,38,53,52,54,54,51,50,18,19,37,38,38,53,52,54,
+51,50,22,21,20,6,7,18,21,20,6,7,39,54,54,53,52,39,6,7,23,20,6,35,34,38,53,
+52,54,55,2,2,35,34,6,21,20,23,1,53,39,6,6,21,20,22,51,50,54,1,54,54,53,52,
+38,35,34,6,21,20,109,23,75,134,80,147,192,36,1,51,25,37,148,114,122,157,128,
+163,84,177,163,41,115,106,65,215,127,4,171,161,120,167,199,236,25,111,79,
+49,62,14,1,70,2,154,125,62,57,78,84,2,90,80,94,58,48,52,63,3,231,62,65,61,
+114,67,254,187,254,206,125,81,143,63,105,137,145,116,101,158,87,254,192,175,
+138,167,9,152,12,94,95,171,214,88,47,136,221,235,155,119,120,197,97,1,0,1,
+37,53,44,30,39,253,153,32,36,72,118,64,53,72,163,2,122,41,115,61,49,63,62,
+52,76,0,0,2,0,72,255,244,4,188,5,76,0,45,0,56,0,0,1,54,53,52,38,35,32,17,
+20,22,23,53,52,54,51,50,22,21,20,6,7,21,20,6,35,34,38,39,55,22,22,51,50,53,
+53,38,38,53,52,36,33,50,4,21,20,7,37,34,6,6,21,50,54,54,53,52,38,3,221,51,
+206,179,254,103,118,107,121,129,107,120,161,146,131,104,93,127,61,125,50,
+53,38,80,188,211,1,48,1,27,245,1,52,92,254,115,34,35,15,56,66,30,36,3,111,
+56,64,94,109,254,219,113,155,23,52,139,133,123,104,117,128,7,252,101,122,
+83,97,92,80,45,92,244,28,235,175,217,230,212,167,116,105,45,27,60,98,23,39,
+41,37,45,0,3,0,76,255,244,4,193,5,76,0,44,0,52,0,61,0,0,1,33,21,20,6,35,34,
+38,53,52,33,51,53,36,17,52,36,33,50,4,21,20,7,39,54,53,52,38,35,34,6,21,20,
+23,53,16,51,50,22,21,20,6,7,21,33,1,50,53,53,34,6,21,20,1,34,6,21,50,54,53,
+52,38,4,0,254,127,134,112,102,131,1,30,39,254,103,1,51,1,25,245,1,52,76,142,
+45,207,178,194,215,231,244,106,121,157,156,1,129,253,141,88,99,67,1,152,54,
+40,79,83,37,1,53,90,106,125,121,98,225,90,63,1,85,205,225,212,167,126,89,
+106,63,68,96,115,150,134,230,49,53,1,17,127,101,104,109,10,90,254,199,104,
+88,46,48,98,2,200,72,114,50,55,37,44,0,1,250,86,254,143,6,214,255,33,0,3,
+0,0,5,33,21,33,250,86,12,128,243,128,223,146,0,1,250,86,254,143,9,46,255,
+33,0,3,0,0,5,33,21,33,250,86,14,216,241,40,223,146,0,1,249,42,254,143,5,170,
+255,33,0,3,0,0,5,33,21,33,249,42,12,128,243,128,223,146,0,1,249,42,254,143,
+6,214,255,33,0,3,0,0,5,33,21,33,249,42,13,172,242,84,223,146,0,1,249,42,254,
+143,9,46,255,33,0,3,0,0,5,33,21,33,249,42,16,4,239,252,223,146,0,1,246,210,
+254,143,5,170,255,33,0,3,0,0,5,33,21,33,246,210,14,216,241,40,223,146,0,1,
+246,210,254,143,6,214,255,33,0,3,0,0,5,33,21,33,246,210,16,4,239,252,223,
+146,0,1,246,210,254,143,9,46,255,33,0,3,0,0,5,33,21,33,246,210,18,92,237,
+164,223,146,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,
+44,0,94,0,3,0,1,4,9,0,2,0,14,0,138,0,3,0,1,4,9,0,3,0,82,0,152,0,3,0,1,4,9,
+0,4,0,44,0,94,0,3,0,1,4,9,0,5,0,30,0,234,0,3,0,1,4,9,0,6,0,38,1,8,0,3,0,1,
+4,9,0,7,0,68,1,46,0,3,0,1,4,9,0,8,0,42,1,114,0,3,0,1,4,9,0,9,0,40,1,156,0,
+3,0,1,4,9,0,10,0,96,1,196,0,3,0,1,4,9,0,11,0,62,2,36,0,3,0,1,4,9,0,12,0,60,
+2,98,0,3,0,1,4,9,0,13,2,150,2,158,0,3,0,1,4,9,0,14,0,52,5,52,0,67,0,111,0,
+112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,
+0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,
+108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,
+114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,
+115,0,32,0,77,0,101,0,101,0,116,0,101,0,105,0,32,0,77,0,97,0,121,0,101,0,
+107,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,
+0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,77,0,101,0,
+101,0,116,0,101,0,105,0,32,0,77,0,97,0,121,0,101,0,107,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,
+0,116,0,111,0,83,0,97,0,110,0,115,0,77,0,101,0,101,0,116,0,101,0,105,0,77,
+0,97,0,121,0,101,0,107,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,
+0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,
+0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,
+111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,
+0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,
+0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,
+0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,
+0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,
+0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,
+112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,
+110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,91,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,
+1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,
+1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,
+1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,
+1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,
+1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,
+1,87,1,88,1,89,4,110,117,108,108,7,117,110,105,65,65,69,48,7,117,110,105,
+65,65,69,49,7,117,110,105,65,65,69,50,7,117,110,105,65,65,69,51,7,117,110,
+105,65,65,69,52,7,117,110,105,65,65,69,53,7,117,110,105,65,65,69,54,7,117,
+110,105,65,65,69,55,7,117,110,105,65,65,69,56,7,117,110,105,65,65,69,57,7,
+117,110,105,65,65,69,65,7,117,110,105,65,65,69,66,7,117,110,105,65,65,69,
+67,7,117,110,105,65,65,69,68,7,117,110,105,65,65,69,69,7,117,110,105,65,65,
+69,70,7,117,110,105,65,65,70,48,7,117,110,105,65,65,70,49,7,117,110,105,65,
+65,70,50,7,117,110,105,65,65,70,51,7,117,110,105,65,65,70,52,7,117,110,105,
+65,65,70,53,7,117,110,105,65,65,70,54,7,117,110,105,65,66,67,48,7,117,110,
+105,65,66,67,49,7,117,110,105,65,66,67,50,7,117,110,105,65,66,67,51,7,117,
+110,105,65,66,67,52,7,117,110,105,65,66,67,53,7,117,110,105,65,66,67,54,7,
+117,110,105,65,66,67,55,7,117,110,105,65,66,67,56,7,117,110,105,65,66,67,
+57,7,117,110,105,65,66,67,65,7,117,110,105,65,66,67,66,7,117,110,105,65,66,
+67,67,7,117,110,105,65,66,67,68,7,117,110,105,65,66,67,69,7,117,110,105,65,
+66,67,70,7,117,110,105,65,66,68,48,7,117,110,105,65,66,68,49,7,117,110,105,
+65,66,68,50,7,117,110,105,65,66,68,51,7,117,110,105,65,66,68,52,7,117,110,
+105,65,66,68,53,7,117,110,105,65,66,68,54,7,117,110,105,65,66,68,55,7,117,
+110,105,65,66,68,56,7,117,110,105,65,66,68,57,7,117,110,105,65,66,68,65,7,
+117,110,105,65,66,68,66,7,117,110,105,65,66,68,67,7,117,110,105,65,66,68,
+68,7,117,110,105,65,66,68,69,7,117,110,105,65,66,68,70,7,117,110,105,65,66,
+69,48,7,117,110,105,65,66,69,49,7,117,110,105,65,66,69,50,7,117,110,105,65,
+66,69,51,7,117,110,105,65,66,69,52,7,117,110,105,65,66,69,53,7,117,110,105,
+65,66,69,54,7,117,110,105,65,66,69,55,7,117,110,105,65,66,69,56,7,117,110,
+105,65,66,69,57,7,117,110,105,65,66,69,65,7,117,110,105,65,66,69,66,7,117,
+110,105,65,66,69,67,7,117,110,105,65,66,69,68,7,117,110,105,65,66,70,48,7,
+117,110,105,65,66,70,49,7,117,110,105,65,66,70,50,7,117,110,105,65,66,70,
+51,7,117,110,105,65,66,70,52,7,117,110,105,65,66,70,53,7,117,110,105,65,66,
+70,54,7,117,110,105,65,66,70,55,7,117,110,105,65,66,70,56,7,117,110,105,65,
+66,70,57,12,117,110,105,65,66,69,68,46,97,108,116,49,12,117,110,105,65,66,
+69,68,46,97,108,116,50,12,117,110,105,65,66,69,68,46,97,108,116,51,12,117,
+110,105,65,66,69,68,46,97,108,116,52,12,117,110,105,65,66,69,68,46,97,108,
+116,53,12,117,110,105,65,66,69,68,46,97,108,116,54,12,117,110,105,65,66,69,
+68,46,97,108,116,55,12,117,110,105,65,66,69,68,46,97,108,116,56,0,0,0,0,0,
+0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,82,0,0,0,2,0,11,0,0,0,15,0,1,0,
+16,0,17,0,3,0,18,0,25,0,1,0,26,0,26,0,3,0,27,0,63,0,1,0,64,0,64,0,3,0,65,
+0,66,0,1,0,67,0,69,0,3,0,70,0,71,0,1,0,72,0,72,0,3,0,73,0,90,0,1,0,4,0,0,
+0,1,0,0,0,0,0,1,0,0,0,10,0,32,0,60,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,
+0,2,0,0,0,1,0,2,100,105,115,116,0,14,109,97,114,107,0,20,0,0,0,1,0,2,0,0,
+0,2,0,0,0,1,0,3,0,8,1,70,2,178,0,4,0,0,0,1,0,8,0,1,0,12,1,82,0,1,0,24,0,66,
+0,1,0,4,0,17,0,64,0,68,0,69,0,4,0,0,0,18,0,0,0,24,0,0,0,30,0,0,0,36,0,1,252,
+244,5,150,0,1,254,192,5,200,0,1,254,212,5,120,0,1,254,232,5,120,0,46,0,184,
+0,184,0,154,0,166,0,94,0,184,0,154,0,100,0,184,0,106,0,232,0,196,0,112,0,
+208,0,178,0,118,0,124,0,130,0,136,0,220,0,142,0,148,0,196,0,154,0,178,0,166,
+0,238,0,160,0,214,0,166,0,172,0,238,0,178,0,184,0,238,0,238,0,190,0,190,0,
+196,0,202,0,208,0,214,0,220,0,226,0,232,0,238,0,1,7,88,5,180,0,1,5,200,5,
+180,0,1,8,52,5,180,0,1,5,120,5,180,0,1,6,104,5,180,0,1,4,136,5,180,0,1,4,
+236,5,180,0,1,4,26,5,180,0,1,5,180,5,180,0,1,4,56,5,180,0,1,5,60,5,180,0,
+1,4,196,5,180,0,1,5,20,5,180,0,1,4,116,5,180,0,1,4,176,5,180,0,1,4,76,5,180,
+0,1,3,172,5,180,0,1,5,140,5,180,0,1,3,32,5,180,0,1,3,192,5,180,0,1,5,40,5,
+180,0,1,4,216,5,180,0,1,4,96,5,180,0,1,3,232,5,180,0,1,5,0,5,180,0,4,0,0,
+0,1,0,8,0,1,0,12,0,20,0,1,0,36,0,52,0,1,0,2,0,16,0,67,0,2,0,2,0,4,0,14,0,
+0,0,27,0,61,0,11,0,2,0,0,0,10,0,0,0,10,0,1,255,126,0,0,0,46,0,94,0,112,1,
+24,0,100,0,106,0,112,1,18,0,118,0,124,0,130,1,36,0,136,0,142,0,220,0,148,
+0,154,0,160,0,202,0,202,0,166,0,172,0,178,0,184,0,190,0,196,0,244,0,202,0,
+208,0,238,0,214,0,220,0,226,0,226,0,232,0,238,0,244,0,250,1,0,1,18,1,6,1,
+12,1,18,1,24,1,30,1,36,1,42,0,1,4,236,0,0,0,1,4,76,0,0,0,1,8,22,0,0,0,1,4,
+176,0,0,0,1,6,164,0,0,0,1,4,42,0,0,0,1,8,45,0,0,0,1,6,64,0,0,0,1,5,180,0,
+0,0,1,5,60,0,0,0,1,7,106,0,0,0,1,4,224,0,0,0,1,5,59,0,0,0,1,6,102,0,0,0,1,
+4,250,0,0,0,1,6,76,0,0,0,1,5,215,0,0,0,1,4,198,0,0,0,1,5,163,0,0,0,1,5,150,
+0,0,0,1,5,241,0,0,0,1,4,133,0,0,0,1,5,85,0,0,0,1,4,159,0,0,0,1,5,189,0,0,
+0,1,5,137,0,0,0,1,3,51,0,0,0,1,4,81,0,0,0,1,3,202,0,0,0,1,4,56,0,0,0,1,6,
+44,0,0,0,1,5,120,0,0,0,1,4,246,0,0,0,1,4,146,0,0,0,1,5,190,0,0,0,2,0,0,0,
+1,0,8,0,1,0,86,0,1,0,1,0,38,0,102,0,102,1,98,1,0,0,116,0,130,1,42,0,144,0,
+214,0,158,0,172,0,186,0,200,0,214,0,242,0,228,0,242,1,140,1,154,1,0,1,14,
+1,28,1,42,1,98,1,84,1,140,1,140,1,56,1,70,1,98,1,84,1,98,1,112,1,126,1,140,
+1,154,1,168,1,182,0,2,0,2,0,4,0,14,0,0,0,27,0,53,0,11,0,2,0,15,3,112,250,
+216,0,18,3,112,250,216,0,2,0,15,3,112,247,144,0,18,3,112,247,144,0,2,0,15,
+3,112,250,156,0,18,3,112,250,156,0,2,0,15,3,112,248,248,0,18,3,112,248,248,
+0,2,0,15,3,112,246,180,0,18,3,112,246,180,0,2,0,15,3,112,251,40,0,18,3,112,
+251,40,0,2,0,15,3,112,249,12,0,18,3,112,249,12,0,2,0,15,3,112,249,122,0,18,
+3,112,249,122,0,2,0,15,3,112,250,236,0,18,3,112,250,236,0,2,0,15,3,112,248,
+118,0,18,3,112,248,118,0,2,0,15,3,112,250,76,0,18,3,112,250,76,0,2,0,15,3,
+112,250,56,0,18,3,112,250,56,0,2,0,15,3,112,249,32,0,18,3,112,249,32,0,2,
+0,15,3,112,250,176,0,18,3,112,250,176,0,2,0,15,3,112,249,92,0,18,3,112,249,
+92,0,2,0,15,3,112,250,36,0,18,3,112,250,36,0,2,0,15,3,112,249,212,0,18,3,
+112,249,212,0,2,0,15,3,112,250,136,0,18,3,112,250,136,0,2,0,15,3,112,249,
+192,0,18,3,112,249,192,0,2,0,15,3,112,250,116,0,18,3,112,250,116,0,2,0,15,
+3,112,250,196,0,18,3,112,250,196,0,2,0,15,3,112,249,252,0,18,3,112,249,252,
+0,2,0,15,3,112,249,232,0,18,3,112,249,232,0,2,0,15,3,112,251,80,0,18,3,112,
+251,80,0,2,0,15,3,112,251,60,0,18,3,112,251,60,0,0,0,1,0,0,0,10,0,30,0,58,
+0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,0,8,0,0,
+0,8,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,16,0,34,0,62,0,90,0,118,0,146,0,174,
+1,10,1,58,1,96,1,110,1,124,1,138,1,152,1,166,1,180,1,194,0,6,0,0,0,1,0,8,
+0,3,0,1,0,160,0,1,1,166,0,1,0,252,0,1,0,0,0,8,0,6,0,0,0,1,0,8,0,3,0,1,0,132,
+0,1,1,138,0,1,1,16,0,1,0,0,0,9,0,6,0,0,0,1,0,8,0,3,0,1,0,196,0,1,1,110,0,
+1,0,104,0,1,0,0,0,10,0,6,0,0,0,1,0,8,0,3,0,1,0,168,0,1,1,82,0,1,0,168,0,1,
+0,0,0,11,0,6,0,0,0,1,0,8,0,3,0,1,0,140,0,1,1,54,0,1,0,188,0,1,0,0,0,12,0,
+6,0,0,0,1,0,8,0,3,0,1,0,160,0,1,1,26,0,1,0,20,0,1,0,0,0,13,0,2,0,10,0,4,0,
+7,0,0,0,9,0,9,0,4,0,12,0,12,0,5,0,14,0,14,0,6,0,29,0,30,0,7,0,32,0,35,0,9,
+0,37,0,37,0,13,0,39,0,53,0,14,0,55,0,56,0,29,0,58,0,61,0,31,0,6,0,0,0,1,0,
+8,0,3,0,1,0,68,0,1,0,190,0,1,0,20,0,1,0,0,0,14,0,1,0,8,0,10,0,11,0,27,0,28,
+0,36,0,38,0,54,0,57,0,6,0,0,0,1,0,8,0,3,0,1,0,20,0,1,0,142,0,1,0,20,0,1,0,
+0,0,15,0,1,0,3,0,8,0,13,0,31,0,1,0,0,0,1,0,8,0,1,0,104,0,11,0,1,0,0,0,1,0,
+8,0,1,0,90,0,12,0,1,0,0,0,1,0,8,0,1,0,76,0,13,0,1,0,0,0,1,0,8,0,1,0,62,0,
+14,0,1,0,0,0,1,0,8,0,1,0,48,0,15,0,1,0,0,0,1,0,8,0,1,0,34,0,16,0,1,0,0,0,
+1,0,8,0,1,0,20,0,17,0,1,0,0,0,1,0,8,0,1,0,6,0,18,0,1,0,1,0,72,};
+#endif
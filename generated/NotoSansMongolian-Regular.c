@@ -0,0 +1,5522 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansMongolian_Regular_ttf_size = 135484;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansMongolian_Regular_ttf");
+asm(".type fz_font_NotoSansMongolian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansMongolian_Regular_ttf, 135484");
+asm(".balign 64");
+asm("fz_font_NotoSansMongolian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansMongolian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansMongolian_Regular_ttf_size = 135484;
+const char fz_font_NotoSansMongolian_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,8,189,8,179,0,1,212,132,0,0,0,28,
+71,80,79,83,178,248,186,12,0,1,212,160,0,0,0,48,71,83,85,66,32,179,108,214,
+0,1,212,208,0,0,60,106,79,83,47,50,126,138,109,193,0,0,1,104,0,0,0,96,99,
+109,97,112,39,52,124,43,0,0,25,100,0,0,2,40,103,97,115,112,0,7,0,7,0,1,212,
+120,0,0,0,12,103,108,121,102,248,18,159,78,0,0,39,92,0,1,84,178,104,101,97,
+100,9,96,127,223,0,0,0,236,0,0,0,54,104,104,101,97,18,118,14,19,0,0,1,36,
+0,0,0,36,104,109,116,120,192,255,240,156,0,0,1,200,0,0,23,156,108,111,99,
+97,104,173,192,100,0,0,27,140,0,0,11,208,109,97,120,112,6,7,1,10,0,0,1,72,
+0,0,0,32,110,97,109,101,142,197,186,176,0,1,124,16,0,0,6,18,112,111,115,116,
+88,242,216,206,0,1,130,36,0,0,82,84,0,1,0,0,0,1,10,61,13,51,115,68,95,15,
+60,245,0,11,8,0,0,0,0,0,206,50,94,81,0,0,0,0,210,40,203,251,254,199,253,223,
+11,31,8,121,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,11,123,254,
+199,255,8,11,31,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,231,0,1,0,0,5,231,0,174,
+0,20,0,90,0,7,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,4,6,104,1,144,0,5,0,0,
+5,154,5,51,0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,196,0,0,2,11,5,2,4,5,4,2,
+2,4,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,
+168,0,0,8,141,2,88,0,0,0,1,0,0,0,0,5,238,8,121,0,0,0,32,0,3,4,205,0,193,0,
+0,0,0,2,20,0,0,2,20,0,0,3,106,255,188,4,150,0,0,5,18,255,254,3,240,0,20,3,
+133,0,0,2,227,0,0,4,162,0,0,4,137,0,20,4,152,0,0,3,16,255,188,1,170,0,53,
+4,137,0,20,3,240,0,20,3,240,0,20,4,242,0,92,1,88,0,0,4,139,0,0,7,86,0,92,
+6,123,0,92,6,25,255,250,5,123,0,0,4,61,0,0,5,137,0,92,2,0,0,0,6,248,255,254,
+5,139,0,92,4,242,0,92,4,121,0,0,4,8,255,252,4,231,0,0,5,246,0,92,5,92,0,92,
+5,252,0,92,5,98,0,92,5,92,0,92,6,35,0,92,4,166,0,0,5,78,0,0,5,78,0,0,5,115,
+0,92,6,96,0,92,6,2,255,254,7,119,0,92,7,16,255,254,7,119,0,92,7,25,255,254,
+6,2,255,254,6,96,0,92,5,231,0,92,4,244,0,92,6,188,0,0,3,106,255,188,3,106,
+255,188,3,106,255,188,4,2,255,252,6,131,0,20,4,139,0,0,3,240,0,20,3,240,0,
+20,6,74,0,20,2,70,0,0,5,18,255,254,5,18,255,254,5,113,0,92,6,96,0,92,6,2,
+255,254,9,203,0,92,7,25,255,254,9,25,255,254,6,96,0,92,3,240,0,20,2,70,254,
+201,4,137,0,20,6,221,0,0,3,164,255,201,6,78,0,92,5,115,0,92,4,166,0,0,6,12,
+0,92,6,12,0,92,5,123,0,0,3,109,255,188,4,43,0,0,6,170,0,92,6,76,255,254,7,
+111,0,20,6,152,0,20,6,74,0,20,6,231,0,92,3,170,0,0,5,254,0,92,7,20,0,92,5,
+182,0,92,6,164,0,92,6,96,0,92,5,182,0,92,6,137,0,92,4,61,0,0,3,94,0,92,5,
+84,255,250,5,158,255,252,9,113,0,92,6,231,0,92,3,109,0,92,6,29,0,92,6,215,
+0,0,7,51,0,92,5,193,0,0,9,135,0,92,7,41,0,92,6,205,0,0,6,180,255,252,7,20,
+0,92,6,178,255,250,7,20,0,92,7,223,0,92,7,131,0,0,6,137,255,254,8,12,0,92,
+7,174,255,254,6,152,0,20,4,41,0,92,3,170,0,0,6,72,0,0,3,18,2,20,6,231,0,92,
+7,86,0,92,4,104,0,92,3,111,0,92,3,18,0,0,3,248,0,92,2,227,0,0,5,182,0,92,
+5,84,255,250,6,178,255,250,9,106,0,92,8,66,0,0,8,209,0,92,8,117,0,0,4,43,
+0,0,4,135,0,92,5,33,0,92,3,248,0,0,5,18,255,254,5,250,255,254,5,184,0,0,4,
+246,0,0,0,166,0,0,1,2,0,92,3,49,0,0,1,156,0,92,1,63,0,0,4,90,0,0,6,96,0,92,
+5,201,0,92,5,47,0,92,4,201,255,246,6,152,255,246,4,53,0,92,4,61,0,0,5,137,
+0,92,6,35,0,92,3,98,0,0,4,123,0,0,4,193,0,92,7,242,0,20,9,2,0,20,3,211,255,
+250,6,12,0,92,7,117,0,20,8,133,0,20,4,150,0,0,6,219,0,0,10,225,0,20,9,55,
+0,0,10,225,0,20,6,43,0,0,6,61,0,0,8,133,0,20,6,219,0,0,9,225,0,20,5,242,0,
+0,8,0,0,0,9,119,0,92,9,109,255,254,11,123,0,20,9,20,0,92,6,61,0,0,6,231,0,
+92,2,70,255,193,4,139,255,193,4,139,255,152,6,166,0,0,8,27,0,20,9,31,0,20,
+4,180,254,199,6,231,0,0,5,84,255,250,9,86,0,92,8,248,255,254,8,205,0,0,8,
+25,255,250,3,240,0,20,5,170,0,0,2,137,0,80,4,117,0,92,3,223,0,0,6,160,0,0,
+3,80,0,0,7,63,0,20,3,66,0,0,6,37,0,0,8,74,0,20,7,207,0,20,7,49,0,20,6,219,
+0,0,8,106,0,20,7,82,0,20,9,2,0,20,7,117,0,20,8,133,0,20,4,150,0,0,6,219,0,
+0,4,150,0,0,5,18,255,254,5,18,255,254,7,82,0,20,8,106,0,20,4,123,255,184,
+6,193,0,0,3,98,255,184,9,2,0,20,7,117,0,20,8,133,0,20,4,150,0,0,6,219,0,0,
+5,18,255,254,8,141,0,92,8,49,0,0,4,244,0,92,4,152,0,0,6,221,0,0,7,102,0,92,
+4,117,0,92,4,23,255,254,7,10,0,0,9,92,0,92,6,231,0,92,6,137,255,254,8,254,
+255,254,6,231,0,92,6,137,255,254,7,186,0,92,8,88,0,92,7,92,255,254,7,250,
+255,254,8,211,0,92,8,117,255,254,6,96,0,92,7,119,0,92,7,25,255,254,6,2,255,
+254,6,96,0,92,7,119,0,92,7,25,255,254,6,2,255,254,6,96,0,92,7,119,0,92,7,
+25,255,254,6,2,255,254,6,96,0,92,7,119,0,92,7,25,255,254,6,2,255,254,4,100,
+0,0,5,186,0,92,6,72,0,0,7,80,0,92,8,102,0,92,8,10,0,0,6,244,0,0,8,2,0,92,
+8,160,0,92,8,68,0,0,7,166,0,0,11,27,0,92,9,27,0,92,8,190,0,0,10,190,0,0,7,
+8,0,92,6,172,0,0,9,33,0,0,9,125,0,92,8,102,0,92,8,10,0,0,6,244,0,0,7,80,0,
+92,7,80,0,92,8,102,0,92,8,10,0,0,6,244,0,0,7,80,0,92,8,102,0,92,8,10,0,0,
+6,244,0,0,7,80,0,92,8,102,0,92,8,10,0,0,6,244,0,0,6,227,0,20,6,74,0,20,4,
+139,0,0,3,109,0,92,4,246,255,252,4,246,255,252,3,240,0,20,2,70,255,193,4,
+139,255,193,4,139,255,152,5,51,0,92,4,154,0,92,4,61,0,0,6,61,0,0,5,209,0,
+92,5,55,0,92,4,102,0,0,6,102,0,0,7,27,0,92,10,225,0,20,6,242,0,0,6,150,0,
+0,4,244,0,92,4,152,0,0,6,221,0,0,6,78,0,92,4,139,0,0,3,106,255,188,9,55,0,
+0,5,18,255,254,5,242,0,0,9,154,0,20,7,154,0,20,5,170,0,0,3,158,0,0,4,23,255,
+254,6,143,0,0,9,92,0,92,8,254,255,254,9,92,0,92,6,231,0,92,6,137,255,254,
+8,254,255,254,6,137,255,254,5,78,0,0,9,203,0,92,7,25,255,254,9,109,255,254,
+6,2,255,254,9,25,255,254,10,12,0,92,9,174,255,254,5,102,0,92,4,106,0,92,4,
+14,0,0,9,25,0,92,8,188,0,0,9,25,0,92,6,164,0,92,6,72,0,0,8,188,0,0,9,41,0,
+92,6,29,0,92,7,51,0,92,6,215,0,0,5,193,0,0,6,29,0,92,9,51,0,92,6,215,0,0,
+5,193,0,0,9,43,0,0,8,213,255,254,6,29,0,92,9,51,0,92,8,213,255,254,6,215,
+0,0,5,193,0,0,9,135,0,92,9,43,0,0,9,131,0,0,9,223,0,92,8,43,0,92,8,43,0,92,
+7,201,255,250,7,201,255,250,8,123,0,92,8,123,0,92,6,25,255,250,8,25,255,250,
+4,254,255,254,6,254,255,254,4,98,0,92,3,248,0,92,3,94,0,92,3,12,255,252,6,
+61,0,0,3,94,0,92,2,227,0,0,3,12,255,252,4,2,255,252,4,102,0,92,3,12,255,252,
+8,43,0,92,5,84,255,250,7,201,255,250,8,43,0,92,5,182,0,92,5,84,255,250,7,
+201,255,250,6,123,0,92,8,123,0,92,6,25,255,250,8,25,255,250,7,20,0,92,6,180,
+255,252,5,254,0,92,5,158,255,252,5,254,0,92,7,20,0,92,6,180,255,252,5,158,
+255,252,5,254,0,92,5,158,255,252,5,254,0,92,5,158,255,252,6,180,255,252,6,
+180,255,252,9,20,0,92,8,180,255,252,9,20,0,92,8,180,255,252,9,104,0,92,9,
+119,0,92,6,137,255,254,9,92,0,92,5,113,0,92,5,250,255,254,4,117,0,92,4,23,
+255,254,8,254,255,254,9,92,0,92,6,231,0,92,6,137,255,254,8,254,255,254,9,
+86,0,92,6,248,255,254,9,86,0,92,7,119,0,92,7,25,255,254,6,2,255,254,6,96,
+0,92,7,119,0,92,7,25,255,254,6,2,255,254,6,96,0,92,7,25,255,254,6,2,255,254,
+6,96,0,92,7,25,255,254,6,2,255,254,9,119,0,92,9,203,0,92,9,109,255,254,9,
+203,0,92,9,109,255,254,9,25,255,254,9,119,0,92,9,25,255,254,7,20,0,92,9,113,
+0,92,9,16,255,252,5,158,255,252,8,180,255,252,5,254,0,92,9,20,0,92,9,113,
+0,92,7,20,0,92,6,180,255,252,6,180,255,252,9,16,255,252,5,158,255,252,8,180,
+255,252,5,158,255,252,8,180,255,252,9,20,0,92,9,20,0,92,8,178,255,250,8,178,
+255,250,6,231,0,92,6,78,0,92,6,78,0,92,5,78,0,0,8,43,0,92,8,43,0,92,5,182,
+0,92,5,182,0,92,5,84,255,250,5,84,255,250,7,201,255,250,7,201,255,250,8,123,
+0,92,8,123,0,92,6,123,0,92,6,123,0,92,6,25,255,250,6,25,255,250,8,178,255,
+250,8,178,255,250,5,254,0,92,5,254,0,92,9,20,0,92,9,113,0,92,9,113,0,92,6,
+180,255,252,6,180,255,252,9,16,255,252,5,158,255,252,5,158,255,252,8,180,
+255,252,5,254,0,92,9,20,0,92,5,254,0,92,9,20,0,92,9,113,0,92,9,113,0,92,6,
+180,255,252,9,16,255,252,6,180,255,252,9,16,255,252,5,158,255,252,5,158,255,
+252,8,180,255,252,9,20,0,92,9,20,0,92,7,20,0,92,7,20,0,92,6,178,255,250,6,
+178,255,250,8,178,255,250,8,178,255,250,4,195,0,92,3,109,0,92,3,12,255,252,
+8,180,0,20,7,68,0,92,8,76,255,254,8,180,0,20,8,27,0,20,6,113,254,201,7,10,
+254,201,6,133,0,92,5,236,0,92,4,160,0,0,6,160,0,0,5,182,0,92,5,90,0,0,8,43,
+0,92,7,207,0,0,8,43,0,92,5,182,0,92,5,90,0,0,7,207,0,0,6,123,0,92,8,123,0,
+92,6,31,0,0,8,31,0,0,5,254,0,92,7,20,0,92,6,184,0,0,5,162,0,0,5,254,0,92,
+7,20,0,92,6,184,0,0,5,162,0,0,5,254,0,92,9,20,0,92,8,184,0,0,9,20,0,92,8,
+184,0,0,6,184,0,0,5,162,0,0,5,254,0,92,5,162,0,0,6,184,0,0,9,104,0,92,9,12,
+0,0,9,104,0,92,9,12,0,0,7,20,0,92,6,184,0,0,8,184,0,0,9,20,0,92,9,70,255,
+252,9,104,0,92,9,8,255,252,7,20,0,92,6,178,255,250,9,20,0,92,8,178,255,250,
+7,35,0,92,5,61,0,0,7,61,0,0,5,12,0,92,3,4,0,92,3,109,0,92,3,12,255,252,7,
+78,0,92,6,78,255,250,6,176,0,92,6,236,255,250,7,201,0,92,9,201,0,92,7,102,
+255,250,9,102,255,250,5,254,0,92,7,20,0,92,6,180,255,252,5,158,255,252,5,
+254,0,92,7,20,0,92,6,180,255,252,5,158,255,252,6,227,0,20,6,74,0,20,3,109,
+0,92,4,139,0,0,5,84,255,250,6,176,0,92,7,78,0,92,6,236,255,250,6,78,255,250,
+7,201,0,92,7,102,255,250,9,102,255,250,9,201,0,92,5,254,0,92,7,20,0,92,6,
+180,255,252,5,158,255,252,5,254,0,92,7,20,0,92,6,180,255,252,5,158,255,252,
+4,98,0,0,6,72,0,92,6,98,0,0,4,139,0,92,3,145,0,92,3,12,255,215,4,246,255,
+215,5,182,0,55,5,84,255,213,7,201,255,213,8,43,0,55,5,254,0,55,7,20,0,55,
+6,180,255,215,5,158,255,215,5,254,0,55,7,20,0,55,5,158,255,215,6,180,255,
+215,4,98,255,215,3,109,255,215,3,12,255,119,4,2,255,119,5,182,255,215,5,84,
+255,117,7,201,255,117,8,43,255,215,5,254,255,215,7,20,255,215,6,180,255,119,
+5,158,255,119,5,254,255,215,7,20,255,215,6,180,255,119,5,158,255,119,8,205,
+0,92,6,113,0,0,8,113,0,0,8,27,0,20,5,233,0,92,6,236,0,92,6,141,255,254,5,
+139,255,254,4,37,0,92,7,92,0,92,3,139,0,92,3,47,0,0,3,201,0,0,10,117,255,
+254,10,211,0,92,4,104,0,92,4,14,0,0,4,156,0,92,3,219,0,0,4,10,0,92,3,106,
+255,188,3,106,255,188,2,70,255,211,2,70,0,0,3,240,0,20,2,209,0,0,2,209,0,
+0,5,152,0,92,6,131,0,20,4,162,0,0,2,227,0,0,2,227,0,0,4,2,255,252,4,227,0,
+0,2,0,0,0,6,72,0,0,2,70,255,135,2,211,0,20,2,70,255,135,3,229,255,135,7,117,
+0,20,8,133,0,20,4,150,0,0,5,18,255,254,4,150,0,0,5,18,255,254,3,133,0,0,3,
+133,0,0,6,219,0,0,7,0,0,0,3,106,255,188,4,10,0,92,8,43,0,92,5,182,0,92,5,
+84,255,250,7,201,255,250,6,25,255,250,8,25,255,250,8,123,0,92,6,123,0,92,
+3,109,0,92,5,254,0,92,7,20,0,92,5,158,255,252,6,180,255,252,3,162,255,178,
+6,231,0,92,6,78,0,92,6,78,0,92,4,139,0,0,4,139,0,0,8,43,0,92,5,182,0,92,5,
+84,255,250,7,201,255,250,8,123,0,92,6,123,0,92,6,25,255,250,8,25,255,250,
+8,123,0,92,6,123,0,92,6,25,255,250,8,25,255,250,5,254,0,92,7,20,0,92,6,180,
+255,252,5,158,255,252,7,178,0,92,7,25,0,92,5,139,0,92,6,86,0,92,4,139,0,0,
+5,37,0,0,5,246,255,252,8,43,0,92,5,182,0,92,5,84,255,250,7,201,255,250,8,
+123,0,92,6,123,0,92,6,25,255,250,8,25,255,250,5,254,0,92,7,20,0,92,6,180,
+255,252,5,158,255,252,8,123,0,92,6,123,0,92,6,25,255,250,8,25,255,250,4,190,
+0,92,5,190,0,92,4,96,255,254,5,96,255,254,7,37,0,92,9,154,0,92,9,59,255,254,
+6,199,255,254,7,119,0,92,7,37,0,92,7,119,0,92,6,96,0,92,7,25,255,254,6,2,
+255,254,9,154,0,92,6,199,255,254,9,59,255,254,7,205,0,92,9,205,0,92,7,111,
+255,254,9,111,255,254,7,25,255,254,6,2,255,254,9,119,0,92,9,203,0,92,9,109,
+255,254,9,25,255,254,9,205,0,92,7,205,0,92,7,111,255,254,9,111,255,254,9,
+205,0,92,7,205,0,92,7,111,255,254,9,111,255,254,5,115,0,92,4,166,0,0,5,115,
+0,92,6,150,0,0,4,231,0,0,6,219,0,0,8,0,0,0,5,92,0,92,6,168,0,92,6,14,0,92,
+4,231,0,0,5,246,0,92,6,14,0,92,5,92,0,92,4,231,0,0,5,129,0,0,4,231,0,0,3,
+94,0,92,2,225,0,0,4,25,0,61,3,123,0,0,4,195,0,20,4,41,0,20,4,82,0,0,4,236,
+0,0,4,104,0,92,3,111,0,92,3,18,0,0,4,12,0,0,8,43,0,92,5,182,0,92,5,90,0,0,
+7,207,0,0,5,254,0,92,7,20,0,92,6,184,0,0,5,162,0,0,8,43,0,92,5,182,0,92,5,
+90,0,0,7,207,0,0,5,254,0,92,7,20,0,92,6,184,0,0,5,162,0,0,9,20,0,92,7,20,
+0,92,6,184,0,0,8,184,0,0,4,104,0,92,3,111,0,92,8,43,0,92,5,182,0,92,5,254,
+0,92,7,20,0,92,3,18,0,0,4,12,0,0,5,90,0,0,7,207,0,0,6,184,0,0,5,162,0,0,5,
+115,0,92,4,166,0,0,5,63,0,0,6,12,0,92,4,166,0,0,5,115,0,92,6,166,0,0,3,102,
+0,92,2,203,0,0,2,252,0,92,2,78,0,92,2,6,0,0,2,160,0,0,6,225,0,102,6,225,0,
+102,6,225,0,102,6,225,0,102,4,70,0,123,5,145,0,123,6,164,0,123,5,63,0,123,
+4,238,0,123,4,147,0,100,5,178,0,61,4,70,0,102,5,10,0,61,4,215,0,100,7,0,0,
+100,4,147,0,100,4,70,0,102,4,131,0,82,5,10,0,86,8,61,0,147,4,168,0,147,5,
+27,2,20,2,209,0,0,3,195,0,205,3,195,0,205,7,117,0,20,9,225,0,20,4,139,0,0,
+4,139,0,0,4,139,0,0,5,78,0,0,3,12,255,252,6,242,0,0,4,150,0,0,6,242,0,0,4,
+150,0,0,2,70,0,0,2,70,0,0,5,166,0,92,5,166,0,92,3,4,0,92,6,78,0,92,3,12,255,
+252,4,139,0,0,6,123,0,92,5,166,0,92,5,88,0,0,4,231,0,0,6,219,0,0,6,152,0,
+20,7,242,0,20,9,225,0,20,6,35,0,92,5,137,0,92,4,61,0,0,4,215,0,0,4,25,0,61,
+3,94,0,92,2,225,0,0,3,123,0,0,7,242,0,20,6,76,0,92,6,131,0,20,2,227,0,0,4,
+162,0,0,5,55,0,0,4,2,255,252,2,0,0,0,4,246,255,252,4,246,255,252,5,170,0,
+92,5,78,0,0,4,139,0,0,4,139,0,0,4,96,0,92,6,78,0,92,8,43,0,92,5,84,255,250,
+5,182,0,92,7,201,255,250,8,123,0,92,6,123,0,92,6,25,255,250,8,25,255,250,
+5,254,0,92,7,20,0,92,6,180,255,252,5,158,255,252,9,113,0,92,9,16,255,252,
+8,123,0,92,6,123,0,92,6,25,255,250,8,25,255,250,6,242,0,92,4,242,0,92,4,121,
+0,0,6,121,0,0,4,123,0,92,4,41,0,20,4,82,0,0,4,31,0,0,3,248,0,92,3,94,0,92,
+4,61,0,0,4,215,0,0,4,170,0,92,4,92,0,92,6,82,0,92,5,98,0,92,2,227,0,0,2,0,
+0,0,8,43,0,92,5,182,0,92,5,84,255,250,7,201,255,250,8,123,0,92,6,123,0,92,
+6,25,255,250,8,25,255,250,5,254,0,92,7,20,0,92,6,180,255,252,5,158,255,252,
+5,254,0,92,7,20,0,92,9,20,0,92,6,180,255,252,5,158,255,252,9,113,0,92,9,16,
+255,252,8,180,255,252,6,176,0,92,7,78,0,92,6,236,255,250,6,78,255,250,9,201,
+0,92,7,102,255,250,9,102,255,250,7,201,0,92,5,254,0,92,7,20,0,92,6,184,0,
+0,5,162,0,0,5,254,0,92,7,20,0,92,6,180,255,252,5,158,255,252,8,123,0,92,6,
+123,0,92,6,25,255,250,8,25,255,250,6,86,0,92,4,10,0,92,3,162,0,0,4,18,0,92,
+3,154,0,0,6,125,0,0,6,217,0,92,5,250,0,0,5,113,0,92,4,117,0,92,7,86,0,92,
+9,92,0,92,6,231,0,92,6,139,0,0,9,0,0,0,4,25,0,0,5,20,0,0,9,86,0,92,8,250,
+0,0,6,250,0,0,6,96,0,92,7,119,0,92,7,27,0,0,6,4,0,0,6,96,0,92,9,119,0,92,
+7,119,0,92,7,27,0,0,6,4,0,0,9,119,0,92,9,203,0,92,9,111,0,0,6,96,0,92,7,119,
+0,92,7,27,0,0,6,4,0,0,6,250,0,0,8,250,0,0,9,86,0,92,7,86,0,92,9,86,0,92,7,
+86,0,92,6,250,0,0,8,250,0,0,6,139,0,0,9,0,0,0,9,92,0,92,6,231,0,92,8,12,0,
+92,10,12,0,92,7,176,0,0,9,176,0,0,7,186,0,92,8,88,0,92,7,252,0,0,7,94,0,0,
+8,211,0,92,10,211,0,92,8,119,0,0,10,119,0,0,6,29,0,92,7,43,0,92,6,207,0,0,
+5,193,0,0,6,170,0,92,6,170,0,92,6,78,0,0,6,231,0,0,5,209,0,92,4,102,0,0,5,
+55,0,92,4,51,0,0,0,0,0,0,0,0,0,0,4,242,0,0,5,139,0,0,9,88,0,92,8,190,0,92,
+6,203,0,20,4,135,0,0,6,49,0,20,5,33,0,0,6,12,0,92,4,166,0,0,5,115,0,92,4,
+115,0,0,9,86,0,92,7,86,0,92,6,248,255,254,8,248,255,254,9,86,0,92,6,248,255,
+254,8,248,255,254,7,86,0,92,6,96,0,92,7,119,0,92,7,25,255,254,6,2,255,254,
+9,92,0,92,6,231,0,92,6,137,255,254,8,254,255,254,6,96,0,92,7,119,0,92,7,25,
+255,254,6,2,255,254,9,92,0,92,6,231,0,92,6,137,255,254,8,254,255,254,7,252,
+0,92,7,98,0,92,7,4,255,254,7,158,255,254,6,12,0,92,5,115,0,92,4,166,0,0,4,
+115,0,0,6,12,0,92,5,115,0,92,4,166,0,0,4,115,0,0,8,98,0,92,7,201,0,92,8,123,
+0,92,4,231,0,0,5,129,0,0,4,231,0,0,4,51,0,92,3,180,0,0,3,170,0,0,4,41,0,92,
+7,72,0,20,6,84,0,20,4,41,0,20,3,143,0,20,4,41,0,20,3,143,0,20,4,61,0,0,4,
+10,0,0,5,72,0,0,5,225,0,0,5,147,0,92,4,250,0,92,5,55,0,0,5,209,0,0,6,12,0,
+92,5,115,0,92,4,166,0,0,5,63,0,0,5,174,0,92,4,90,0,92,4,14,0,0,4,141,0,92,
+3,219,0,0,5,0,0,92,5,51,0,92,4,166,0,0,4,115,0,0,4,104,0,92,4,156,0,92,4,
+14,0,0,3,219,0,0,4,104,0,92,4,14,0,0,4,156,0,92,3,219,0,0,5,4,0,92,4,102,
+0,0,5,55,0,92,4,51,0,0,5,102,0,92,4,106,0,92,4,14,0,0,5,10,0,0,7,41,0,92,
+6,29,0,92,7,51,0,92,7,223,0,92,6,164,0,92,9,25,0,92,6,72,0,0,8,188,0,0,9,
+41,0,92,6,205,0,0,8,205,0,0,5,193,0,0,6,29,0,92,6,215,0,0,7,51,0,92,9,51,
+0,92,9,135,0,92,9,43,0,0,6,215,0,0,5,193,0,0,8,215,0,0,9,223,0,92,7,131,0,
+0,9,131,0,0,9,41,0,92,7,41,0,92,6,250,0,0,8,205,0,0,5,61,0,33,4,164,0,33,
+4,66,255,191,4,219,255,191,4,102,0,92,3,109,0,92,3,12,255,252,4,6,255,252,
+7,98,0,92,6,45,0,0,6,201,0,92,6,199,0,0,6,225,0,92,7,20,0,92,6,180,255,252,
+6,129,255,252,4,117,0,92,4,168,0,92,4,76,0,0,4,25,0,0,4,20,0,92,4,113,0,92,
+4,20,0,0,3,184,0,0,2,227,0,0,4,227,0,0,6,72,0,0,9,86,0,92,7,86,0,92,6,248,
+255,254,8,248,255,254,8,12,0,92,10,12,0,92,7,174,255,254,9,174,255,254,7,
+20,0,92,5,254,0,92,6,180,255,252,5,158,255,252,8,123,0,92,6,25,255,250,8,
+25,255,250,6,123,0,92,4,139,0,0,2,113,0,0,3,156,0,92,3,2,0,92,2,166,0,0,2,
+115,0,0,5,254,0,92,4,219,0,0,5,100,0,92,6,219,0,0,5,78,0,0,3,88,0,92,2,252,
+0,0,4,236,0,92,5,31,0,92,4,158,0,0,4,106,0,0,3,233,0,0,5,166,0,20,4,152,0,
+0,5,190,0,20,6,178,255,250,8,178,255,250,9,20,0,92,7,20,0,92,9,41,0,92,6,
+205,0,0,8,205,0,0,7,41,0,92,8,123,0,92,8,123,0,92,8,25,255,250,8,25,255,250,
+6,123,0,92,6,123,0,92,6,25,255,250,6,25,255,250,3,221,0,82,8,117,0,82,7,229,
+0,82,7,18,0,72,2,164,255,252,2,164,255,252,3,174,255,242,3,18,2,20,0,246,
+0,0,5,139,0,0,7,186,0,92,8,88,0,92,10,211,0,92,8,211,0,92,7,250,255,254,7,
+92,255,254,8,117,255,254,10,117,255,254,6,96,0,92,7,119,0,92,7,25,255,254,
+6,2,255,254,6,96,0,92,7,119,0,92,7,25,255,254,6,2,255,254,6,96,0,92,7,119,
+0,92,7,25,255,254,6,2,255,254,9,92,0,92,6,231,0,92,6,137,255,254,8,254,255,
+254,6,248,255,254,8,248,255,254,7,86,0,92,9,86,0,92,6,96,0,92,7,119,0,92,
+7,25,255,254,6,2,255,254,9,109,255,254,6,2,255,254,9,203,0,92,8,16,0,92,9,
+86,0,92,7,86,0,92,6,248,255,254,8,248,255,254,9,86,0,92,7,86,0,92,6,248,255,
+254,8,248,255,254,7,113,0,92,6,211,0,92,7,20,0,0,6,119,0,0,9,236,0,92,7,236,
+0,92,7,143,0,0,9,143,0,0,5,254,0,92,7,20,0,92,6,184,0,0,5,162,0,0,8,43,0,
+92,5,182,0,92,5,84,255,250,7,201,255,250,5,254,0,92,7,20,0,92,6,180,255,252,
+5,158,255,252,8,123,0,92,7,20,0,92,6,178,255,250,8,25,255,250,6,123,0,92,
+6,31,0,0,8,31,0,0,8,123,0,92,8,123,0,92,8,123,0,92,6,123,0,92,6,123,0,92,
+6,25,255,250,6,25,255,250,8,25,255,250,8,25,255,250,3,12,255,252,5,166,0,
+92,3,12,255,252,4,2,255,252,4,2,255,252,2,227,0,0,6,131,0,20,2,168,0,0,4,
+59,0,0,8,43,0,20,5,215,0,92,2,209,0,0,6,127,0,0,7,242,0,20,4,2,255,252,3,
+51,0,0,4,70,0,0,3,18,0,0,3,96,2,0,5,35,2,0,7,231,2,0,7,231,2,0,3,170,2,0,
+3,231,2,0,4,193,0,98,4,213,0,184,4,225,0,197,3,88,0,205,3,88,0,123,3,150,
+0,205,3,150,0,123,8,205,0,102,8,205,0,102,8,205,0,102,8,205,0,102,8,205,0,
+102,8,205,0,102,8,205,0,102,8,205,0,102,8,205,0,102,8,205,0,102,8,205,0,102,
+8,205,0,102,8,205,0,102,8,205,0,102,8,205,0,102,8,205,0,102,8,205,0,102,8,
+205,0,102,8,205,0,102,8,205,0,102,2,147,0,82,4,0,0,82,8,0,0,82,9,20,0,92,
+5,254,0,92,6,180,255,252,9,16,255,252,8,180,255,252,5,254,0,92,9,20,0,92,
+9,113,0,92,7,20,0,92,9,16,255,252,9,20,0,92,9,16,255,252,8,180,255,252,8,
+180,255,252,3,221,0,92,5,37,0,20,3,201,254,201,7,231,2,20,7,231,2,0,2,70,
+0,0,6,102,0,20,6,0,0,92,0,0,0,1,0,3,0,1,0,0,0,12,0,4,2,28,0,0,0,46,0,32,0,
+4,0,14,0,0,0,13,0,33,0,45,0,63,0,160,24,14,24,25,24,119,24,170,32,13,32,20,
+32,47,32,73,36,105,36,114,36,115,37,204,48,2,254,62,254,68,254,255,255,255,
+0,0,0,0,0,13,0,32,0,45,0,63,0,160,24,0,24,16,24,32,24,128,32,12,32,19,32,
+47,32,72,36,96,36,106,36,115,37,204,48,1,254,61,254,65,254,255,255,255,0,
+1,255,245,0,0,5,161,5,164,255,99,0,0,0,0,0,0,0,0,0,0,229,188,229,26,229,103,
+0,0,225,91,225,81,223,231,213,176,7,119,7,117,1,2,0,1,0,0,0,0,0,42,0,0,0,
+0,0,0,0,38,0,66,0,84,1,2,1,86,0,0,0,0,0,0,1,82,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,3,5,226,3,146,3,161,0,128,3,163,5,72,3,162,5,170,5,171,5,173,5,174,
+0,19,3,142,3,143,3,144,3,145,3,151,3,157,3,155,3,156,3,153,3,152,3,154,3,
+160,3,159,3,158,0,89,0,124,0,169,0,173,0,198,0,184,0,189,1,88,0,15,0,52,0,
+67,1,109,0,106,1,245,0,11,0,76,0,83,0,82,0,34,0,36,0,39,1,149,0,134,0,29,
+2,41,1,192,0,131,1,157,2,100,2,51,2,44,2,45,2,47,0,145,0,139,0,154,0,218,
+0,213,0,221,0,222,0,230,0,235,0,241,0,246,1,23,1,57,2,123,0,162,0,158,2,194,
+2,145,0,165,1,67,5,30,5,34,2,147,2,163,2,179,2,183,2,187,1,71,2,198,2,206,
+2,215,2,219,1,75,2,188,2,230,2,245,3,10,3,34,3,68,3,76,3,79,3,87,3,89,3,93,
+3,117,0,172,3,132,3,138,3,194,3,198,3,203,3,212,3,236,3,240,3,244,3,248,3,
+250,3,251,5,65,5,223,5,66,5,67,5,164,5,168,5,156,4,170,4,205,5,5,4,38,5,41,
+4,166,4,189,4,201,4,46,4,209,4,241,4,102,4,106,4,245,4,193,4,253,4,114,4,
+116,4,120,4,249,4,174,4,180,4,197,4,160,4,156,4,172,4,184,4,152,4,39,5,1,
+4,148,5,29,5,48,4,111,4,110,5,186,5,188,5,189,5,190,5,191,5,192,5,187,5,193,
+5,194,5,195,0,0,0,21,0,21,0,21,0,21,0,54,0,94,0,153,0,194,0,233,0,255,1,26,
+1,85,1,128,1,172,1,189,1,201,1,213,1,221,2,6,2,19,2,27,2,100,2,152,2,160,
+2,213,2,247,2,255,3,22,3,30,3,69,3,77,3,117,3,170,3,221,4,12,4,20,4,71,4,
+79,4,87,4,121,4,168,4,205,4,221,4,229,5,50,5,58,5,140,5,148,5,156,5,164,5,
+172,5,180,5,188,5,196,5,253,6,9,6,17,6,29,6,67,6,120,6,144,6,152,6,160,6,
+168,6,176,6,184,6,192,6,200,6,208,6,216,7,53,7,61,7,69,7,77,7,85,7,122,7,
+184,8,0,8,49,8,102,8,118,8,134,8,150,8,196,8,212,8,244,9,27,9,35,9,43,9,106,
+9,177,9,225,10,35,10,69,10,137,10,212,11,2,11,64,11,153,11,204,11,212,11,
+244,11,252,12,4,12,12,12,97,12,105,12,142,12,214,12,222,13,43,13,51,13,139,
+13,209,13,217,13,225,14,34,14,42,14,58,14,139,14,147,14,155,14,240,14,248,
+15,0,15,8,15,16,15,24,15,47,15,123,15,208,15,247,16,30,16,38,16,69,16,100,
+16,116,16,132,16,147,16,215,17,27,17,35,17,103,17,111,17,119,17,127,17,166,
+17,174,18,0,18,78,18,143,18,161,18,169,18,217,18,225,18,233,19,12,19,98,19,
+152,19,160,19,168,19,232,20,24,20,71,20,79,20,127,20,156,20,188,20,235,21,
+47,21,139,21,147,21,206,22,19,22,27,22,35,22,43,22,124,22,180,22,188,22,239,
+23,28,23,98,23,143,23,225,24,21,24,83,24,177,24,185,24,193,25,23,25,82,25,
+167,25,204,26,10,26,75,26,133,26,141,26,149,26,212,27,18,27,83,27,168,27,
+176,27,184,27,192,27,200,27,246,28,27,28,87,28,118,28,158,28,191,29,2,29,
+33,29,68,29,133,29,193,29,253,30,5,30,68,30,129,30,228,31,49,31,127,31,175,
+31,228,31,236,32,46,32,54,32,122,32,194,32,234,33,25,33,63,33,71,33,79,33,
+87,33,95,33,103,33,111,33,177,33,185,33,193,33,201,33,209,34,24,34,32,34,
+40,34,109,34,117,34,125,34,133,34,141,34,149,34,157,34,165,34,173,34,181,
+34,189,34,197,34,205,34,213,34,221,34,229,34,237,34,245,34,253,35,5,35,13,
+35,98,35,188,35,196,35,204,35,212,35,220,35,228,35,236,35,244,36,35,36,105,
+36,181,37,8,37,16,37,24,37,89,37,154,37,162,37,170,37,250,38,62,38,70,38,
+78,38,134,38,142,38,150,38,236,38,244,38,252,39,4,39,12,39,95,39,185,39,193,
+39,201,40,29,40,119,40,127,40,135,40,143,40,151,40,159,40,167,40,183,40,199,
+40,214,41,0,41,66,41,74,41,82,41,90,41,98,41,106,41,114,41,122,41,130,41,
+173,41,222,41,230,42,23,42,83,42,135,42,143,42,151,42,159,42,167,42,175,42,
+183,42,191,42,199,42,207,42,215,42,223,42,231,43,51,43,116,43,162,43,193,
+43,201,44,16,44,111,44,119,44,127,44,135,44,143,44,151,44,159,44,175,44,183,
+44,191,44,199,44,207,44,215,45,55,45,63,45,120,45,177,45,185,46,22,46,30,
+46,38,46,46,46,54,46,62,46,144,46,152,46,160,46,168,46,176,46,184,47,17,47,
+25,47,33,47,41,47,49,47,57,47,65,47,73,47,81,47,89,47,97,47,105,47,113,47,
+206,48,26,48,42,48,50,48,66,48,130,48,146,48,161,48,176,48,222,49,23,49,31,
+49,54,49,62,49,70,49,114,49,122,49,130,49,166,49,174,49,217,49,225,50,50,
+50,58,50,66,50,74,50,82,50,90,50,98,50,154,50,222,50,230,50,238,51,60,51,
+68,51,140,51,148,51,156,51,164,51,172,51,180,51,188,51,196,51,204,51,212,
+51,220,51,228,52,61,52,69,52,77,52,85,52,173,52,181,52,189,53,39,53,110,53,
+204,54,19,54,27,54,35,54,43,54,51,54,59,54,67,54,163,54,171,54,179,55,17,
+55,25,55,33,55,41,55,49,55,57,55,65,55,73,55,81,55,89,55,97,55,105,55,113,
+55,219,56,68,56,76,56,84,56,92,56,100,56,108,56,116,56,132,56,148,56,164,
+56,180,56,196,56,204,56,220,56,228,56,244,56,252,57,12,57,28,57,36,57,44,
+57,60,57,76,57,152,57,168,57,176,57,191,57,207,57,223,57,231,57,239,57,247,
+58,7,58,15,58,31,58,39,58,55,58,63,58,79,58,87,58,103,58,111,58,127,58,135,
+58,150,58,158,58,173,58,181,58,197,58,213,58,221,58,237,58,245,59,5,59,21,
+59,29,59,45,59,61,59,69,59,77,59,93,59,109,59,117,59,133,59,141,59,149,59,
+165,59,181,59,189,59,205,59,221,59,229,59,245,59,253,60,13,60,21,60,36,60,
+44,60,59,60,93,60,101,60,109,60,178,61,5,61,99,61,189,61,197,62,6,62,14,62,
+59,62,67,62,111,62,167,62,216,62,224,63,46,63,54,63,62,63,70,63,78,63,86,
+63,141,63,208,63,216,63,224,64,38,64,114,64,122,64,130,64,138,64,146,64,154,
+64,162,64,170,65,2,65,10,65,18,65,26,65,34,65,42,65,50,65,58,65,66,65,153,
+65,161,65,169,65,177,65,245,65,253,66,5,66,84,66,92,66,100,66,108,66,177,
+66,185,67,9,67,17,67,85,67,152,67,232,68,16,68,50,68,58,68,66,68,126,68,134,
+68,194,68,202,69,10,69,86,69,94,69,102,69,181,70,11,70,19,70,27,70,99,70,
+177,70,185,70,193,70,205,70,217,70,225,70,236,70,244,71,43,71,98,71,106,71,
+114,71,173,71,181,71,189,72,3,72,79,72,161,72,169,72,177,72,185,72,193,72,
+201,72,209,73,10,73,67,73,135,73,174,73,213,73,222,74,28,74,75,74,83,74,91,
+74,168,74,237,75,56,75,64,75,72,75,148,75,230,75,238,75,246,76,35,76,80,76,
+88,76,96,76,151,76,159,76,167,76,252,77,73,77,156,77,164,77,172,78,0,78,90,
+78,98,78,106,78,162,78,208,78,216,78,224,79,41,79,118,79,126,79,134,79,182,
+79,235,79,243,79,251,80,3,80,11,80,19,80,47,80,75,80,103,80,131,80,144,80,
+156,80,164,80,176,80,184,80,192,80,204,80,212,80,220,80,228,80,236,80,244,
+80,252,81,4,81,38,81,46,81,91,81,123,81,132,81,140,81,189,81,201,81,213,81,
+225,81,237,81,245,81,253,82,9,82,17,82,29,82,37,82,52,82,68,82,76,82,84,82,
+92,82,100,82,108,82,116,82,124,82,132,82,140,82,148,82,156,82,164,82,172,
+82,210,82,222,82,234,82,246,83,2,83,14,83,26,83,38,83,50,83,62,83,74,83,86,
+83,98,83,110,83,122,83,134,83,146,83,158,83,170,83,182,83,194,83,206,84,34,
+84,42,84,93,84,166,84,178,84,190,84,198,84,210,84,222,84,234,84,246,85,2,
+85,14,85,26,85,38,85,50,85,62,85,74,85,86,85,98,85,110,85,122,85,134,85,203,
+86,18,86,26,86,34,86,113,86,221,86,229,86,237,87,72,87,84,87,96,87,108,87,
+116,87,124,87,136,87,148,87,160,87,243,88,83,88,91,88,99,88,111,88,123,88,
+226,89,72,89,80,89,88,89,96,89,104,89,112,89,120,89,128,89,136,89,144,89,
+152,89,211,90,16,90,24,90,99,90,107,90,115,90,123,90,131,90,180,90,188,90,
+243,90,255,91,11,91,23,91,35,91,47,91,59,91,67,91,102,91,134,91,142,91,189,
+91,197,91,247,91,255,92,11,92,23,92,35,92,47,92,59,92,71,92,83,92,95,92,107,
+92,119,92,131,92,143,92,155,92,167,92,179,92,191,92,203,92,215,92,227,92,
+239,92,251,93,7,93,19,93,31,93,43,93,55,93,67,93,79,93,91,93,103,93,115,93,
+127,93,139,93,151,93,163,93,175,93,183,93,241,94,43,94,96,94,148,94,156,94,
+218,95,5,95,47,95,65,95,73,95,81,95,89,96,40,97,8,97,243,98,190,98,232,99,
+37,99,78,99,179,100,66,100,112,100,163,100,209,101,12,101,59,101,131,101,
+186,101,234,102,11,102,75,102,96,102,117,102,129,102,171,102,213,102,221,
+102,229,102,237,102,252,103,4,103,19,103,35,103,43,103,94,103,102,103,110,
+103,118,103,126,103,137,103,145,103,161,103,169,103,185,103,193,103,208,103,
+224,103,232,104,28,104,36,104,83,104,91,104,99,104,107,104,119,104,131,104,
+143,104,155,104,167,104,179,104,191,104,203,104,211,104,245,104,253,105,5,
+105,13,105,47,105,55,105,63,105,122,105,204,105,220,105,236,105,244,106,3,
+106,11,106,19,106,27,106,35,106,43,106,51,106,59,106,67,106,75,106,83,106,
+91,106,99,106,107,106,115,106,123,106,131,106,139,106,147,106,155,106,163,
+106,214,106,222,106,230,107,25,107,77,107,85,107,93,107,101,107,113,107,125,
+107,137,107,149,107,214,107,252,108,62,108,127,108,135,108,143,108,151,108,
+159,108,167,108,175,108,183,108,191,108,199,108,207,108,215,108,223,108,231,
+108,239,108,247,108,255,109,7,109,15,109,23,109,31,109,39,109,47,109,55,109,
+63,109,71,109,79,109,87,109,95,109,103,109,111,109,119,109,127,109,135,109,
+143,109,218,110,43,110,51,110,59,110,67,110,75,110,83,110,91,110,149,110,
+183,110,219,110,254,111,33,111,92,111,152,111,210,112,12,112,71,112,143,112,
+237,113,46,113,54,113,62,113,70,113,78,113,161,113,169,113,177,113,252,114,
+77,114,85,114,93,114,101,114,193,114,201,114,209,114,217,114,225,115,60,115,
+68,115,80,115,92,115,104,115,116,115,124,115,132,115,140,115,148,115,156,
+115,164,115,172,115,180,115,192,115,204,115,216,115,228,116,55,116,150,116,
+158,116,166,116,243,117,64,117,72,117,80,117,159,117,250,118,2,118,10,118,
+88,118,173,118,181,118,189,119,1,119,9,119,17,119,25,119,75,119,126,119,134,
+119,184,119,184,119,184,119,251,120,3,120,98,120,106,120,180,120,228,120,
+236,120,244,121,0,121,12,121,24,121,107,121,223,122,71,122,79,122,87,122,
+95,122,103,122,111,122,119,122,237,123,104,123,112,123,120,124,1,124,110,
+124,118,124,126,124,234,125,91,125,99,125,107,125,234,126,76,126,84,126,92,
+126,186,126,194,126,202,126,210,126,222,126,234,126,246,127,69,127,85,127,
+101,127,116,127,184,128,17,128,25,128,116,128,132,128,148,128,164,128,199,
+128,235,129,15,129,50,129,129,129,137,129,156,129,164,129,176,129,188,129,
+228,130,12,130,84,130,92,130,177,130,185,131,25,131,33,131,45,131,57,131,
+69,131,81,131,89,131,136,131,183,131,230,132,21,132,52,132,83,132,115,132,
+147,132,159,132,197,132,209,132,247,133,17,133,44,133,70,133,97,133,148,133,
+198,133,249,134,43,134,117,134,190,134,198,134,206,135,37,135,127,135,222,
+136,64,136,143,136,252,137,4,137,12,137,110,137,118,137,126,137,134,137,142,
+137,150,137,158,138,9,138,21,138,127,138,135,138,143,138,151,139,4,139,12,
+139,20,139,28,139,36,139,44,139,52,139,120,139,128,139,136,139,144,139,192,
+139,240,139,248,140,0,140,84,140,167,140,175,140,183,141,5,141,83,141,91,
+141,99,141,151,141,203,141,211,141,219,141,248,142,21,142,29,142,37,142,61,
+142,97,142,105,142,113,142,121,142,129,142,137,142,232,143,83,143,91,143,
+99,143,184,144,7,144,15,144,23,144,31,144,39,144,47,144,55,144,66,144,90,
+144,118,144,126,144,134,144,162,144,211,145,5,145,13,145,74,145,85,145,118,
+145,126,145,187,145,248,146,55,146,118,146,164,146,234,146,245,147,84,147,
+92,147,100,147,108,147,116,147,124,147,132,147,140,147,148,147,156,147,172,
+147,180,147,195,147,203,147,219,147,227,147,242,148,45,148,130,149,104,149,
+199,149,207,149,223,150,6,150,19,150,19,150,30,150,108,150,186,151,22,151,
+103,151,111,151,119,151,127,151,135,151,217,152,48,152,56,152,64,152,72,152,
+80,152,88,152,96,152,104,152,112,152,120,152,128,152,140,152,152,152,164,
+152,176,152,184,152,192,152,200,152,208,152,220,152,232,152,244,153,0,153,
+8,153,16,153,24,153,32,153,40,153,48,153,56,153,64,153,72,153,80,153,88,153,
+96,153,159,153,220,153,228,153,236,154,58,154,124,154,132,154,140,154,217,
+155,44,155,52,155,60,155,68,155,76,155,84,155,92,155,100,155,108,155,116,
+155,124,155,132,155,140,155,148,155,156,155,164,155,172,155,180,155,188,155,
+196,155,212,155,220,155,236,155,244,156,3,156,11,156,26,156,34,156,42,156,
+50,156,58,156,66,156,74,156,82,156,104,156,121,156,167,156,231,157,18,157,
+40,157,113,157,154,157,167,157,186,157,204,157,232,157,244,158,1,158,14,158,
+31,158,69,158,236,159,12,159,43,159,59,159,75,159,100,159,125,159,208,160,
+31,160,135,160,253,161,92,161,196,162,61,162,194,163,58,163,178,164,62,164,
+164,165,31,165,165,166,23,166,147,167,24,167,121,168,15,168,150,168,163,168,
+176,168,189,168,205,168,213,168,229,168,237,168,245,169,5,169,13,169,29,169,
+37,169,45,169,53,169,61,169,69,169,77,169,136,169,144,169,213,169,243,170,
+48,170,65,170,77,170,89,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,
+55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,
+1,255,188,0,109,3,86,6,176,0,16,0,0,37,38,38,2,53,53,51,20,18,23,16,18,55,
+51,6,2,17,1,211,152,242,141,152,104,121,198,159,188,184,203,109,8,169,1,38,
+165,164,250,254,244,72,1,194,2,223,208,228,253,42,254,73,0,0,2,0,0,0,82,4,
+211,3,141,0,14,0,24,0,0,17,33,21,33,22,21,20,6,35,34,38,53,52,55,35,5,52,
+39,33,6,21,16,51,50,54,4,211,254,41,45,212,194,186,217,41,41,2,135,41,254,
+109,41,241,113,131,3,141,164,100,135,196,232,215,213,139,96,231,137,94,94,
+137,254,250,131,0,2,255,254,0,82,4,182,6,66,0,24,0,32,0,0,1,22,22,21,20,6,
+6,35,34,2,17,16,0,33,50,4,18,23,7,2,2,35,34,2,7,1,50,54,53,52,39,33,18,3,
+14,19,28,94,168,106,237,226,1,61,1,21,168,1,14,163,13,164,20,238,192,198,
+230,4,1,30,97,125,21,254,25,8,3,141,57,216,73,141,220,120,1,122,1,120,1,101,
+1,153,187,254,171,216,20,1,21,1,61,254,230,241,253,111,156,155,119,63,254,
+19,0,1,0,20,0,152,4,45,5,57,0,24,0,0,37,3,38,38,35,34,7,53,54,51,50,22,23,
+23,51,54,33,51,21,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,151,126,
+7,6,9,68,1,1,160,158,116,112,56,9,20,152,2,231,154,129,52,150,61,198,228,
+172,170,164,51,121,124,254,215,0,2,0,0,0,82,3,41,3,141,0,13,0,23,0,0,17,33,
+22,22,21,20,6,35,34,38,53,52,55,35,5,52,39,33,6,21,16,51,50,54,2,201,42,54,
+212,194,186,217,41,41,2,135,45,254,113,41,241,113,131,3,141,78,211,110,196,
+232,215,213,139,96,231,127,104,94,137,254,250,131,0,1,0,0,255,119,3,33,3,
+141,0,8,0,0,19,18,19,7,2,3,53,33,21,162,117,225,150,241,113,3,33,2,233,254,
+104,254,112,74,1,195,1,175,164,164,0,1,0,0,255,119,4,223,3,141,0,12,0,0,17,
+53,33,21,33,18,19,7,2,3,35,3,35,4,223,253,129,119,223,149,238,117,233,39,
+135,2,233,164,164,254,104,254,112,74,1,185,1,185,253,220,0,1,0,20,0,152,4,
+45,6,119,0,37,0,0,1,50,23,38,39,53,51,50,54,55,21,6,6,35,35,22,18,19,51,54,
+33,51,21,35,34,6,6,7,3,35,3,38,38,35,34,7,53,54,1,29,61,41,34,58,248,160,
+153,53,50,148,168,74,49,53,4,9,68,1,1,160,158,116,112,56,9,20,135,53,11,73,
+84,93,129,144,5,57,14,87,56,117,36,36,158,43,35,106,254,201,254,249,170,164,
+51,121,124,254,215,2,231,154,129,52,150,61,0,1,0,0,0,143,5,47,5,43,0,24,0,
+0,17,53,33,54,54,51,50,18,19,35,38,38,35,34,6,21,20,18,23,7,2,3,33,3,35,1,
+246,22,213,172,191,215,12,151,13,143,111,123,129,87,100,152,178,16,254,227,
+39,135,2,233,164,191,223,254,209,254,237,207,201,182,160,144,254,242,168,
+86,1,60,1,30,253,220,0,1,255,188,0,92,2,180,6,0,0,24,0,0,1,6,2,17,21,38,36,
+2,53,53,51,20,18,23,16,19,35,34,38,39,53,22,22,51,33,2,180,94,98,158,254,
+248,146,166,114,126,154,160,160,154,55,75,151,143,1,104,5,57,213,254,25,254,
+197,230,7,185,1,41,164,164,249,254,249,71,2,59,1,145,33,45,160,46,28,0,0,
+1,0,53,254,178,1,170,0,45,0,5,0,0,5,6,7,39,54,55,1,170,185,100,88,130,118,
+96,132,106,80,181,118,0,255,255,0,20,254,178,4,45,5,57,0,34,0,7,0,0,0,3,0,
+14,1,139,0,0,255,255,0,20,254,178,4,45,5,57,2,34,0,7,0,0,0,3,0,14,1,139,0,
+0,255,255,0,20,0,152,4,45,5,57,2,2,0,7,0,0,0,2,0,92,0,82,5,47,3,141,0,13,
+0,23,0,0,1,21,33,22,21,20,6,35,34,38,53,52,54,55,1,52,39,33,6,21,16,51,50,
+54,5,47,254,45,41,212,193,187,217,45,47,2,43,41,254,109,41,242,112,131,3,
+141,164,96,139,196,232,225,225,117,180,80,254,117,137,94,84,124,254,227,131,
+0,0,1,0,0,2,233,1,129,3,141,0,3,0,0,17,33,21,33,1,129,254,127,3,141,164,0,
+255,255,0,0,0,197,4,201,3,141,2,2,0,60,0,0,0,2,0,92,255,119,7,147,6,66,0,
+32,0,40,0,0,1,22,22,21,20,6,6,35,34,2,17,16,0,33,50,0,19,33,21,33,22,18,23,
+7,2,2,3,2,2,35,34,2,7,1,50,54,53,52,39,33,18,3,109,19,28,95,169,107,232,229,
+1,56,1,16,249,1,36,67,2,143,253,144,40,165,122,149,170,149,44,52,212,190,
+193,225,4,1,31,96,125,21,254,25,8,3,141,62,221,63,140,222,119,1,118,1,124,
+1,103,1,151,254,188,254,143,164,193,254,118,221,74,1,68,1,156,1,1,1,50,1,
+14,254,232,243,253,111,156,155,125,57,254,19,0,1,0,92,255,119,6,184,6,20,
+0,27,0,0,37,0,17,16,0,51,50,18,19,33,21,33,18,1,7,38,2,39,46,2,35,34,2,17,
+20,18,23,1,100,254,248,1,15,225,215,227,41,2,137,253,140,75,1,0,149,148,182,
+29,25,78,122,102,150,184,118,130,86,1,151,1,105,1,68,1,122,254,199,254,178,
+164,254,108,254,108,74,241,2,0,240,205,222,103,254,248,254,244,179,254,201,
+190,255,255,255,250,255,119,6,86,6,20,0,2,0,22,158,0,0,1,0,0,0,150,5,31,5,
+223,0,29,0,0,55,38,2,53,53,51,18,19,51,16,18,19,51,54,18,55,51,6,2,3,35,38,
+2,3,35,6,2,21,16,23,55,23,32,66,63,193,165,111,127,8,56,200,123,199,183,227,
+65,164,140,155,29,8,78,86,39,150,130,1,70,139,164,1,49,1,33,254,236,254,2,
+254,252,246,1,181,175,250,253,237,254,195,248,1,246,1,32,165,254,184,197,
+254,252,155,0,1,0,0,0,33,4,123,3,141,0,19,0,0,1,51,38,17,33,53,33,21,33,20,
+22,23,21,35,34,6,7,53,54,54,1,225,74,61,254,18,4,123,254,10,43,41,248,171,
+215,95,73,197,1,37,192,1,4,164,164,129,229,123,135,38,58,174,47,39,255,255,
+0,92,0,33,5,199,3,141,0,2,0,39,0,0,0,1,0,0,1,76,1,164,3,141,0,12,0,0,17,51,
+32,17,20,7,35,54,53,52,38,35,35,61,1,103,51,152,45,92,109,61,3,141,254,174,
+126,113,104,135,84,90,255,255,255,254,255,119,7,53,6,66,0,2,0,21,162,0,0,
+1,0,92,254,244,5,47,3,141,0,22,0,0,1,22,23,51,50,22,21,20,7,35,54,53,52,38,
+35,35,22,23,7,0,3,33,21,1,25,34,45,238,197,221,33,162,31,121,139,172,90,131,
+149,254,195,83,4,211,2,233,152,136,224,184,100,82,63,97,129,137,246,244,71,
+2,122,2,31,164,255,255,0,92,254,244,5,47,3,141,0,2,0,29,0,0,0,1,0,0,254,244,
+4,182,3,141,0,23,0,0,19,22,23,51,50,22,21,20,7,35,54,53,52,38,35,35,22,19,
+7,2,3,53,33,21,160,36,44,237,197,221,33,162,31,121,139,172,85,136,149,253,
+118,4,182,2,233,159,129,224,184,100,82,63,97,129,137,233,254,255,71,1,247,
+1,254,164,164,0,0,1,255,252,0,25,3,172,5,205,0,32,0,0,37,0,17,16,0,51,50,
+18,19,7,38,38,35,34,6,21,20,23,51,50,22,21,20,7,35,54,53,52,38,35,35,22,23,
+1,25,254,227,1,2,215,206,246,19,164,16,156,135,141,170,16,227,189,209,33,
+164,31,111,127,176,65,142,25,1,173,1,124,1,51,1,88,254,187,254,210,20,229,
+248,238,243,114,75,211,176,96,66,56,84,118,129,175,195,0,0,2,0,0,254,190,
+5,37,3,141,0,18,0,30,0,0,19,22,23,54,54,51,50,22,21,20,6,35,34,38,2,3,53,
+33,21,1,34,6,7,22,22,51,50,54,53,52,38,162,52,77,49,158,96,190,222,201,152,
+156,221,205,71,5,37,253,45,78,129,35,70,145,86,86,107,125,2,233,211,219,72,
+88,229,191,170,207,238,2,17,1,44,164,164,254,80,86,71,168,146,113,100,117,
+141,0,0,2,0,92,0,197,5,154,6,55,0,17,0,26,0,0,1,33,38,38,53,52,54,54,51,50,
+22,18,23,33,21,33,3,35,3,2,38,35,34,6,21,20,23,3,23,253,163,41,53,103,185,
+118,149,184,101,10,1,236,254,82,39,136,51,10,131,139,111,133,47,2,233,78,
+219,111,127,203,108,140,254,211,241,164,253,220,2,200,1,8,248,141,127,156,
+88,0,255,255,0,92,0,197,5,154,6,55,0,2,0,34,0,0,0,2,0,92,254,190,5,160,3,
+141,0,17,0,29,0,0,1,22,23,54,54,51,50,22,21,20,6,35,34,2,2,3,33,21,1,34,6,
+7,22,22,51,50,54,53,52,38,1,29,52,77,49,158,96,189,222,200,152,164,231,238,
+51,5,68,253,45,78,129,35,70,145,86,86,107,125,2,233,211,219,72,88,226,194,
+172,205,1,9,2,141,1,57,164,254,80,86,71,168,146,113,100,117,141,0,255,255,
+0,92,254,190,5,160,3,141,0,2,0,36,0,0,255,255,0,92,0,197,5,154,6,55,0,2,0,
+34,0,0,0,1,0,92,0,33,5,199,3,141,0,19,0,0,37,54,54,51,51,38,17,33,55,33,21,
+33,20,22,23,21,35,34,6,7,1,76,73,197,211,74,62,253,35,37,5,70,254,10,43,41,
+248,171,215,95,207,47,39,195,1,1,164,164,129,229,123,135,38,58,0,1,0,0,0,
+150,4,227,5,223,0,25,0,0,19,18,19,51,16,19,33,21,33,18,19,35,38,2,3,35,6,
+2,21,20,23,35,38,2,53,53,102,88,199,166,51,2,133,253,158,75,142,174,113,131,
+28,9,115,98,25,158,23,34,3,141,1,65,1,17,254,211,254,219,164,254,208,254,
+221,255,2,5,1,86,216,254,110,238,156,102,109,1,88,142,164,0,0,1,0,0,0,152,
+4,242,5,84,0,19,0,0,37,34,38,2,53,33,3,35,3,53,33,20,22,23,16,19,51,6,2,17,
+4,12,141,243,138,254,211,39,135,39,2,145,97,120,201,191,115,115,152,164,1,
+20,153,253,220,2,36,164,218,237,69,2,67,1,144,207,254,41,254,207,255,255,
+0,0,254,110,4,242,5,84,0,35,0,14,1,100,0,45,0,35,0,14,3,37,255,188,0,2,0,
+41,0,0,255,255,0,92,0,150,5,176,5,223,0,2,0,83,0,0,0,4,0,92,0,82,6,4,6,66,
+0,19,0,26,0,34,0,43,0,0,37,34,38,39,6,6,35,34,2,17,52,18,36,51,50,4,18,21,
+16,2,1,32,0,7,33,38,0,19,50,54,54,55,33,21,16,1,20,22,22,51,50,54,53,53,4,
+78,98,150,43,41,168,92,218,200,177,1,78,226,221,1,66,168,215,254,16,254,248,
+254,236,29,4,84,35,254,231,50,103,114,57,2,254,31,253,125,54,108,94,98,127,
+82,96,98,98,96,1,92,1,82,247,1,123,208,209,254,132,245,254,161,254,177,5,
+70,254,233,244,246,1,21,251,100,96,219,178,159,254,178,1,237,174,223,96,166,
+168,159,255,255,255,254,0,82,5,166,6,66,0,2,0,44,162,0,0,4,0,92,0,82,7,180,
+6,66,0,22,0,29,0,37,0,46,0,0,37,34,38,39,6,6,35,34,2,17,52,18,36,51,50,4,
+18,23,33,21,33,2,2,1,32,0,7,33,38,0,19,50,54,54,55,33,21,16,1,20,22,22,51,
+50,54,53,53,4,78,98,150,43,41,168,92,218,200,177,1,78,226,197,1,44,182,24,
+1,184,254,80,4,215,254,20,254,248,254,236,29,4,84,35,254,231,50,103,114,57,
+2,254,31,253,125,54,108,94,98,127,82,96,98,98,96,1,92,1,82,247,1,123,208,
+166,254,198,213,164,254,177,254,184,5,70,254,233,244,246,1,21,251,100,96,
+219,178,159,254,178,1,237,174,223,96,166,168,159,255,255,255,254,0,82,7,86,
+6,66,0,2,0,46,162,0,255,255,0,92,0,82,7,180,6,66,2,2,0,46,0,0,255,255,255,
+254,0,82,7,86,6,66,0,2,0,46,162,0,255,255,255,254,0,82,5,166,6,66,0,2,0,44,
+162,0,255,255,0,92,0,82,6,4,6,66,2,2,0,44,0,0,255,255,0,92,0,143,5,139,5,
+43,0,2,0,12,92,0,255,255,0,92,0,143,5,139,5,43,0,2,0,12,92,0,0,1,0,0,253,
+227,6,96,3,141,0,35,0,0,17,53,33,50,22,21,20,2,7,14,2,21,20,23,35,38,53,52,
+54,55,54,54,53,52,38,35,33,18,19,7,2,3,35,3,35,4,135,236,237,126,146,55,59,
+23,43,168,39,89,105,119,101,152,164,253,219,119,223,149,238,117,233,39,135,
+2,233,164,211,196,121,254,255,187,71,104,81,64,83,75,65,93,101,200,139,153,
+195,97,123,120,254,104,254,112,74,1,185,1,185,253,220,0,255,255,255,188,254,
+133,3,86,6,176,2,34,0,4,0,0,0,3,0,14,0,231,255,211,255,255,255,188,0,109,
+3,86,6,176,2,2,0,4,0,0,255,255,255,188,254,133,3,86,6,176,2,34,0,4,0,0,0,
+3,0,14,0,231,255,211,0,1,255,252,0,86,3,166,5,209,0,18,0,0,1,34,6,21,20,18,
+23,7,0,17,16,18,51,50,18,19,7,2,2,1,207,141,164,125,123,146,254,248,252,215,
+207,245,19,164,16,156,5,39,240,245,180,254,203,171,88,1,139,1,97,1,48,1,95,
+254,148,254,178,21,1,6,1,31,0,1,0,20,255,119,6,193,5,57,0,30,0,0,37,3,38,
+38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,21,33,18,19,7,2,3,35,34,6,6,7,
+3,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,3,52,253,129,117,
+225,150,239,115,17,116,112,56,9,20,152,2,231,154,129,52,150,61,198,228,172,
+170,164,254,104,254,112,74,1,188,1,182,51,121,124,254,215,0,0,1,0,0,0,197,
+4,201,3,141,0,10,0,0,1,33,3,35,3,53,33,21,33,3,35,2,70,254,143,39,135,39,
+4,201,254,82,39,135,2,233,253,220,2,36,164,164,253,220,255,255,0,20,0,152,
+4,45,5,57,2,2,0,7,0,0,255,255,0,20,0,152,4,45,5,57,2,2,0,7,0,0,255,255,0,
+20,0,152,6,135,5,57,2,2,0,91,0,0,255,255,0,0,0,197,2,131,3,141,2,2,5,228,
+0,0,255,255,255,254,0,82,4,182,6,66,2,2,0,6,0,0,255,255,255,254,0,82,4,182,
+6,66,2,2,0,6,0,0,255,255,0,92,0,82,5,20,6,66,0,2,0,6,94,0,255,255,0,92,0,
+82,6,4,6,66,2,2,0,44,0,0,255,255,255,254,0,82,5,166,6,66,0,2,0,44,162,0,0,
+4,0,92,255,119,10,8,6,66,0,28,0,35,0,43,0,52,0,0,37,34,38,39,6,6,35,34,2,
+17,52,18,36,51,50,4,18,23,33,21,33,18,19,7,2,3,35,2,2,1,32,0,7,33,38,0,19,
+50,54,54,55,33,21,16,1,20,22,22,51,50,54,53,53,4,78,98,150,43,41,168,92,218,
+200,177,1,78,226,197,1,44,182,24,4,12,253,129,121,221,149,238,117,227,4,215,
+254,20,254,248,254,236,29,4,84,35,254,231,50,103,114,57,2,254,31,253,125,
+54,108,94,98,127,82,96,98,98,96,1,92,1,82,247,1,123,208,166,254,198,213,164,
+254,97,254,119,74,1,185,1,185,254,177,254,184,5,70,254,233,244,246,1,21,251,
+100,96,219,178,159,254,178,1,237,174,223,96,166,168,159,0,255,255,255,254,
+0,82,7,86,6,66,0,2,0,46,162,0,255,255,255,254,0,82,8,189,6,66,0,2,0,187,162,
+0,255,255,0,92,0,82,6,4,6,66,2,2,0,44,0,0,255,255,0,20,0,152,4,45,6,242,0,
+2,0,76,0,0,0,1,254,201,0,197,2,131,6,10,0,22,0,0,17,53,51,54,55,35,34,38,
+39,53,22,22,51,51,21,6,6,7,33,21,33,3,35,33,9,85,70,171,147,50,59,153,156,
+246,59,64,4,1,211,254,82,39,135,2,233,164,217,183,34,43,160,41,32,136,110,
+205,113,164,253,220,0,1,0,20,0,152,4,45,6,242,0,40,0,0,37,3,38,38,35,34,7,
+53,54,51,50,23,54,55,35,34,38,39,53,22,22,51,51,21,6,6,7,22,23,23,51,54,33,
+51,21,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,69,56,37,59,57,174,148,
+47,52,156,161,245,71,82,11,33,6,6,9,68,1,1,160,158,116,112,56,9,20,152,2,
+231,154,129,52,150,61,22,135,90,37,41,160,38,36,135,105,188,102,95,168,172,
+170,164,51,121,124,254,215,0,1,0,0,0,143,7,27,6,242,0,46,0,0,17,53,33,54,
+54,51,50,23,54,55,35,34,38,39,53,22,22,51,51,21,6,6,21,22,22,23,33,21,33,
+3,35,3,38,38,35,34,6,21,20,18,23,7,2,3,33,3,35,1,246,22,213,172,129,95,27,
+61,58,174,148,46,52,156,160,246,72,75,16,20,11,1,254,254,82,39,136,38,13,
+143,111,123,129,87,100,152,178,16,254,227,39,135,2,233,164,191,223,76,168,
+125,37,41,160,38,36,135,127,236,135,35,82,45,164,253,220,2,36,207,201,182,
+160,144,254,242,168,86,1,60,1,30,253,220,0,1,255,201,0,152,3,143,5,199,0,
+29,0,0,1,16,18,55,51,2,2,17,21,38,38,2,53,53,52,39,53,51,50,54,55,21,6,6,
+35,22,21,20,22,22,1,135,154,164,202,193,165,153,255,145,55,147,144,142,58,
+49,151,136,43,49,104,1,119,1,71,2,31,225,254,241,254,9,254,197,229,2,163,
+1,19,153,175,177,173,135,32,42,160,43,35,147,174,151,204,139,0,1,0,92,0,197,
+6,139,5,209,0,29,0,0,37,18,17,16,2,35,34,6,7,22,19,35,2,38,35,34,7,53,54,
+55,18,0,51,32,19,33,21,33,20,3,3,246,35,154,154,137,170,12,160,30,159,25,
+104,95,85,52,72,100,23,1,2,196,1,158,55,1,209,254,54,43,197,1,17,1,48,1,29,
+1,4,221,232,141,253,240,1,49,248,27,164,33,4,1,10,1,43,253,188,164,253,254,
+217,0,255,255,0,92,0,150,5,176,7,178,0,35,0,14,1,33,7,133,0,35,0,14,2,201,
+7,133,0,2,0,83,0,0,255,255,0,0,0,150,4,227,7,178,2,34,0,40,0,0,0,35,0,14,
+0,145,7,133,0,3,0,14,2,57,7,133,255,255,0,92,0,150,5,176,7,178,0,35,0,14,
+1,33,7,133,0,35,0,14,2,201,7,133,0,2,0,83,0,0,0,1,0,92,0,150,5,176,5,223,
+0,25,0,0,19,22,51,50,54,19,51,18,19,33,21,33,22,18,23,35,2,2,39,35,6,2,6,
+35,34,39,92,94,80,92,100,64,193,89,83,2,57,253,242,35,63,35,156,66,150,64,
+9,15,87,130,110,96,88,3,145,39,242,1,131,254,230,254,200,164,139,254,217,
+161,1,91,2,81,180,128,254,196,117,51,255,255,0,0,0,150,5,31,7,178,2,34,0,
+24,0,0,0,35,0,14,0,80,7,133,0,3,0,14,1,248,7,133,0,1,255,188,0,217,3,16,5,
+35,0,16,0,0,55,38,2,53,53,51,20,22,23,51,54,18,55,51,6,2,3,164,107,125,144,
+50,73,8,50,203,126,198,175,230,70,217,121,1,29,122,164,158,206,88,231,1,195,
+176,239,253,243,254,178,0,0,1,0,0,254,139,4,104,3,141,0,19,0,0,1,22,18,23,
+1,2,2,17,53,51,21,16,18,23,55,2,17,53,33,21,2,92,4,115,115,253,217,152,135,
+154,96,117,254,172,2,167,2,233,229,254,92,213,255,0,1,23,2,33,1,38,164,164,
+255,0,254,95,219,112,1,81,1,192,159,164,255,255,0,92,255,16,6,231,6,86,0,
+2,2,45,0,0,255,255,255,254,255,16,6,137,6,86,0,2,2,45,162,0,0,1,0,20,0,109,
+7,90,6,176,0,38,0,0,37,38,38,2,53,35,34,6,6,7,3,35,3,38,38,35,34,7,53,54,
+51,50,22,23,23,51,54,33,51,20,18,23,16,18,55,51,6,2,17,5,215,152,243,139,
+50,116,112,56,9,20,135,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,203,
+104,121,196,161,188,184,203,109,8,170,1,37,165,51,121,124,254,215,2,231,154,
+129,52,150,61,198,228,172,170,250,254,244,72,1,185,2,230,210,228,253,42,254,
+73,0,0,1,0,20,253,227,6,59,5,57,0,47,0,0,37,3,38,38,35,34,7,53,54,51,50,22,
+23,23,51,54,33,51,50,22,21,20,2,7,14,2,21,20,23,35,38,53,52,54,55,54,54,53,
+52,38,35,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,
+1,1,213,236,237,126,146,55,59,23,43,168,39,90,105,121,98,152,164,209,116,
+112,56,9,20,152,2,231,154,129,52,150,61,198,228,172,170,211,196,121,254,255,
+187,71,104,81,64,83,75,65,93,102,200,138,160,189,96,123,120,51,121,124,254,
+215,0,0,1,0,20,0,152,6,135,5,57,0,28,0,0,1,35,34,6,6,7,3,35,3,38,38,35,34,
+7,53,54,51,50,22,23,23,51,54,33,33,21,33,3,35,4,4,117,116,112,56,9,20,135,
+53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,2,250,254,82,39,135,2,233,
+51,121,124,254,215,2,231,154,129,52,150,61,198,228,172,170,164,253,220,0,
+0,2,0,92,0,82,7,37,6,66,0,28,0,36,0,0,1,34,2,7,33,22,22,21,20,6,6,35,34,2,
+17,16,0,33,50,0,19,33,21,33,3,35,3,2,2,1,50,54,53,52,39,33,18,2,209,216,247,
+4,2,111,19,28,95,169,107,232,229,1,80,1,37,255,1,58,45,1,238,254,82,39,135,
+39,25,223,254,115,96,125,21,254,25,8,5,152,254,229,240,62,221,63,140,222,
+119,1,118,1,124,1,104,1,150,254,153,254,178,164,253,220,2,36,1,86,1,89,251,
+100,156,155,125,57,254,19,0,1,0,0,255,12,3,231,3,141,0,18,0,0,1,21,33,22,
+18,22,51,50,55,21,6,6,35,34,38,38,2,39,53,3,231,252,187,61,193,138,79,110,
+60,23,90,57,114,162,139,158,60,3,141,164,214,254,73,166,86,186,33,37,120,
+246,1,145,222,164,0,2,0,92,0,82,5,162,6,20,0,30,0,40,0,0,37,38,2,53,52,18,
+36,51,50,4,18,17,20,6,6,35,34,38,53,52,54,55,33,2,33,34,0,17,20,18,23,1,52,
+39,33,6,21,16,51,50,54,1,43,100,107,164,1,43,193,218,1,53,167,103,185,114,
+186,221,43,35,2,34,86,254,89,228,254,246,92,103,3,63,4,254,63,32,233,111,
+141,86,188,1,132,174,214,1,72,178,209,254,87,254,211,160,247,132,242,239,
+92,189,65,1,221,254,214,254,253,141,254,166,192,1,215,64,60,71,111,254,201,
+184,0,2,0,92,0,82,7,82,6,20,0,34,0,44,0,0,1,2,33,34,0,17,20,18,23,7,38,2,
+53,52,18,36,51,32,0,19,33,21,33,22,21,20,6,6,35,34,38,53,52,54,55,1,52,39,
+33,6,21,16,51,50,54,4,233,86,254,89,228,254,246,92,103,150,100,107,164,1,
+43,193,1,21,1,84,54,1,199,254,76,4,103,185,114,186,221,43,35,2,57,4,254,63,
+32,233,111,141,3,141,1,221,254,214,254,253,141,254,166,192,64,188,1,132,174,
+214,1,72,178,254,181,254,196,164,60,64,160,247,132,242,239,92,189,65,254,
+224,64,60,71,111,254,201,184,0,0,1,0,92,0,86,5,244,5,209,0,25,0,0,37,0,17,
+52,18,54,51,50,18,19,33,21,33,3,35,3,46,2,35,34,6,21,20,18,23,1,100,254,248,
+114,215,140,209,223,37,1,238,254,82,39,135,39,19,70,125,106,141,166,118,130,
+86,1,151,1,105,192,1,33,154,254,229,254,215,164,253,220,2,36,232,235,107,
+229,236,179,254,201,190,0,0,1,0,92,0,86,6,225,6,66,0,37,0,0,55,54,54,51,50,
+54,53,52,39,33,53,16,0,33,50,0,19,33,21,33,3,35,3,2,2,35,34,2,7,33,22,21,
+20,6,35,34,6,7,127,56,153,137,96,125,20,253,186,1,56,1,16,242,1,43,49,1,239,
+254,82,39,135,39,24,217,201,193,225,4,2,47,43,215,168,106,167,73,250,37,26,
+127,123,122,60,91,1,103,1,151,254,159,254,172,164,253,220,2,36,1,86,1,89,
+254,232,243,172,174,189,224,24,40,0,4,0,92,254,139,6,4,6,66,0,28,0,35,0,43,
+0,52,0,0,37,34,38,39,6,6,7,6,21,20,23,35,38,53,52,55,38,2,17,52,18,36,51,
+50,4,18,21,16,2,1,32,0,7,33,38,0,19,50,54,54,55,33,21,16,1,20,22,22,51,50,
+54,53,53,4,78,98,150,43,37,139,80,43,78,184,62,62,156,158,177,1,78,226,221,
+1,66,168,215,254,16,254,248,254,236,29,4,84,35,254,231,50,103,114,57,2,254,
+31,253,125,54,108,94,98,127,82,96,98,86,96,10,92,121,139,105,92,150,116,107,
+38,1,72,1,54,247,1,123,208,209,254,132,245,254,161,254,177,5,70,254,233,244,
+246,1,21,251,100,96,219,178,159,254,178,1,237,174,223,96,166,168,159,0,1,
+0,92,0,86,5,244,5,209,0,28,0,0,37,0,17,52,18,54,51,50,18,19,33,21,33,3,35,
+3,46,2,35,34,6,7,33,21,33,22,18,23,1,100,254,248,114,215,140,209,223,37,1,
+238,254,82,39,135,39,19,70,125,106,133,164,10,1,74,254,186,14,109,121,86,
+1,151,1,105,192,1,33,154,254,229,254,215,164,253,220,2,36,232,235,107,203,
+207,164,127,254,240,172,0,255,255,0,92,254,162,6,199,3,141,0,2,2,100,0,0,
+0,1,0,0,0,10,4,123,3,141,0,17,0,0,17,33,21,33,20,6,7,7,6,7,53,54,55,55,54,
+54,53,33,4,123,254,84,103,114,221,147,134,68,165,168,97,63,253,207,3,141,
+164,157,199,59,119,79,122,195,68,92,90,51,137,102,255,255,0,92,255,12,3,156,
+3,141,0,2,0,134,0,0,255,255,255,250,0,86,5,146,5,209,0,2,0,96,158,0,255,255,
+255,252,0,82,5,66,6,20,0,2,0,94,160,0,0,2,0,92,255,119,9,174,6,20,0,40,0,
+50,0,0,1,18,19,7,2,3,35,22,21,20,6,6,35,34,38,53,52,54,55,33,2,33,34,0,17,
+20,18,23,7,38,2,53,52,18,36,51,32,0,19,33,21,5,52,39,33,6,21,16,51,50,54,
+7,47,117,225,149,238,117,239,4,103,185,114,186,221,43,35,2,34,86,254,89,228,
+254,246,92,103,150,100,107,164,1,43,193,1,21,1,84,54,4,35,251,82,4,254,63,
+32,233,111,141,2,233,254,104,254,112,74,1,185,1,185,60,64,160,247,132,242,
+239,92,189,65,1,221,254,214,254,253,141,254,166,192,64,188,1,132,174,214,
+1,72,178,254,181,254,196,164,124,64,60,71,111,254,201,184,0,255,255,0,92,
+0,197,6,139,5,209,0,2,0,79,0,0,0,1,0,92,0,86,4,4,5,209,0,19,0,0,37,0,17,52,
+18,54,51,50,18,19,35,2,38,35,34,6,21,20,18,23,1,100,254,248,114,212,141,228,
+226,15,151,22,139,157,141,164,125,123,86,1,139,1,97,198,1,42,159,254,147,
+254,133,1,69,249,240,245,180,254,203,171,0,3,0,92,0,82,5,193,6,66,0,27,0,
+35,0,43,0,0,37,34,39,6,35,34,6,7,53,54,54,51,50,54,53,53,33,53,52,18,36,51,
+50,4,18,21,16,2,19,38,0,35,34,6,6,7,1,50,54,54,55,33,21,16,4,10,213,78,107,
+175,102,160,72,56,144,134,90,117,253,192,165,1,50,199,221,1,66,168,216,43,
+35,254,230,221,149,229,128,2,3,12,104,113,57,3,254,30,82,197,129,24,40,164,
+37,26,127,123,182,91,233,1,92,185,210,254,133,245,254,164,254,174,3,59,246,
+1,21,131,241,151,253,111,96,214,183,159,254,178,255,255,0,0,0,82,7,21,6,66,
+0,2,0,110,164,0,0,3,0,92,0,82,7,113,6,66,0,30,0,38,0,46,0,0,37,34,39,6,35,
+34,6,7,53,54,54,51,50,54,53,53,33,53,52,18,36,51,50,4,18,23,33,21,33,2,2,
+19,38,0,35,34,6,6,7,1,50,54,54,55,33,21,16,4,10,213,78,107,175,102,160,72,
+56,144,134,90,117,253,192,165,1,50,199,197,1,44,181,24,1,185,254,80,5,215,
+47,35,254,230,221,149,229,128,2,3,12,104,113,57,3,254,30,82,197,129,24,40,
+164,37,26,127,123,182,91,233,1,92,185,166,254,198,213,164,254,174,254,187,
+3,59,246,1,21,131,241,151,253,111,96,214,183,159,254,178,255,255,0,0,0,82,
+5,101,6,66,0,2,0,108,164,0,0,3,0,92,255,119,9,197,6,66,0,36,0,44,0,52,0,0,
+37,34,39,6,35,34,6,7,53,54,54,51,50,54,53,53,33,53,52,18,36,51,50,4,18,23,
+33,21,33,18,19,7,2,3,35,2,2,19,38,0,35,34,6,6,7,1,50,54,54,55,33,21,16,4,
+10,213,78,107,175,102,160,72,56,144,134,90,117,253,192,165,1,50,199,197,1,
+44,181,24,4,13,253,129,117,225,150,239,115,227,5,215,47,35,254,230,221,149,
+229,128,2,3,12,104,113,57,3,254,30,82,197,129,24,40,164,37,26,127,123,182,
+91,233,1,92,185,166,254,198,213,164,254,104,254,112,74,1,188,1,182,254,174,
+254,187,3,59,246,1,21,131,241,151,253,111,96,214,183,159,254,178,0,0,1,0,
+92,255,119,7,102,6,66,0,41,0,0,5,2,2,3,2,2,35,34,2,7,33,22,21,20,6,35,34,
+6,7,53,54,54,51,50,54,53,52,39,33,53,16,0,33,50,0,19,33,21,33,22,18,23,5,
+168,170,149,44,47,207,178,182,213,4,2,47,43,215,168,106,167,73,56,153,137,
+96,125,20,253,186,1,46,1,3,254,1,17,59,2,143,253,144,38,156,133,137,1,68,
+1,156,1,1,1,27,1,37,254,230,241,172,174,189,224,24,40,164,37,26,127,123,122,
+60,91,1,106,1,148,254,163,254,168,164,185,254,131,242,0,255,255,0,0,255,119,
+7,10,6,66,0,2,0,113,164,0,255,255,255,252,0,82,6,242,6,20,0,2,0,95,160,0,
+0,1,0,92,255,12,7,82,6,20,0,37,0,0,37,0,17,16,0,51,50,18,19,33,21,33,18,23,
+30,2,51,50,55,21,6,6,35,34,38,39,2,3,2,38,35,34,2,17,20,18,23,1,100,254,248,
+1,15,225,213,225,41,3,39,252,235,37,105,50,98,83,51,113,55,22,88,58,126,180,
+83,164,45,31,142,150,150,184,118,130,86,1,151,1,105,1,68,1,122,254,199,254,
+178,164,254,228,221,110,144,60,86,186,33,37,152,176,1,92,1,168,1,27,247,254,
+248,254,244,179,254,201,190,0,255,255,255,250,255,12,6,240,6,20,0,2,0,116,
+158,0,255,255,0,92,254,110,7,82,6,20,2,34,0,116,0,0,0,35,0,14,0,190,255,188,
+0,3,0,14,2,119,255,188,0,1,0,92,255,12,8,29,6,66,0,50,0,0,5,6,6,35,34,38,
+39,2,3,2,2,35,34,2,7,33,22,21,20,6,35,34,6,7,53,54,54,51,50,54,53,52,39,33,
+53,16,0,33,50,0,19,33,21,33,22,18,18,22,51,50,55,7,88,22,89,57,130,182,79,
+163,73,53,202,177,182,213,4,2,47,43,215,168,106,167,73,56,153,137,96,125,
+20,253,186,1,46,1,3,234,1,27,67,3,72,252,215,22,84,133,130,75,111,57,174,
+33,37,159,169,1,89,1,171,1,57,1,7,254,230,241,172,174,189,224,24,40,164,37,
+26,127,123,122,60,91,1,106,1,148,254,193,254,138,164,118,254,245,254,226,
+148,86,255,255,0,0,255,12,7,193,6,66,0,2,0,119,164,0,255,255,255,254,0,82,
+6,199,6,66,0,2,0,92,162,0,0,2,0,92,255,12,8,74,6,66,0,41,0,49,0,0,1,22,22,
+21,20,6,6,35,34,2,17,16,0,33,32,0,19,33,21,33,22,18,18,22,51,50,55,21,6,6,
+35,34,38,39,2,3,2,2,35,34,2,7,1,50,54,53,52,39,33,18,3,109,19,28,95,169,107,
+232,229,1,56,1,16,1,4,1,29,61,3,72,252,215,22,84,133,130,75,111,57,22,88,
+58,130,182,79,163,73,52,212,190,193,225,4,1,31,96,125,21,254,25,8,3,141,62,
+221,63,140,222,119,1,118,1,124,1,103,1,151,254,165,254,166,164,118,254,245,
+254,226,148,86,186,33,37,159,169,1,89,1,171,1,50,1,14,254,232,243,253,111,
+156,155,125,57,254,19,0,255,255,255,254,255,12,7,236,6,66,0,2,0,122,162,0,
+255,255,0,20,253,227,6,59,5,57,2,2,0,90,0,0,255,255,0,92,255,12,4,102,3,141,
+0,2,2,41,0,0,255,255,0,0,255,12,3,231,3,141,2,2,0,93,0,0,255,255,0,0,0,86,
+6,133,6,66,0,2,0,97,164,0,0,1,2,20,2,182,3,18,3,203,0,11,0,0,1,52,54,51,50,
+22,21,20,6,35,34,38,2,20,72,53,54,75,75,54,53,72,3,66,75,62,62,75,74,66,66,
+0,0,2,0,92,254,139,7,37,6,66,0,7,0,45,0,0,37,50,54,53,52,39,33,18,3,16,0,
+33,50,0,19,33,21,33,3,35,3,2,2,35,34,2,7,33,22,22,21,20,6,6,35,6,21,20,23,
+35,38,53,52,55,38,2,2,29,96,125,21,254,25,8,170,1,80,1,37,255,1,58,45,1,238,
+254,82,39,135,39,25,223,217,216,247,4,2,111,19,28,95,169,105,41,78,184,62,
+66,162,158,252,156,155,125,57,254,19,2,72,1,104,1,150,254,153,254,178,164,
+253,220,2,36,1,86,1,89,254,229,240,62,221,63,140,222,119,94,117,139,105,92,
+150,122,111,52,1,109,0,2,0,92,254,139,7,147,6,66,0,41,0,49,0,0,1,22,22,21,
+20,6,6,35,6,21,20,23,35,38,53,52,55,38,2,17,16,0,33,50,0,19,33,21,33,22,18,
+23,7,2,2,3,2,2,35,34,2,7,1,50,54,53,52,39,33,18,3,109,19,28,95,169,105,41,
+78,184,62,66,162,158,1,56,1,16,249,1,36,67,2,143,253,144,40,165,122,149,170,
+149,44,52,212,190,193,225,4,1,31,96,125,21,254,25,8,3,141,62,221,63,140,222,
+119,94,117,139,105,92,150,122,111,52,1,109,1,61,1,103,1,151,254,188,254,143,
+164,193,254,118,221,74,1,68,1,156,1,1,1,50,1,14,254,232,243,253,111,156,155,
+125,57,254,19,0,0,1,0,92,0,72,4,12,5,209,0,21,0,0,19,16,18,51,50,18,19,7,
+38,38,35,34,6,21,20,18,23,7,38,39,7,35,92,253,216,211,242,22,162,18,158,137,
+141,166,181,192,127,172,84,17,135,3,90,1,36,1,83,254,182,254,211,20,252,229,
+225,236,139,254,184,207,112,191,177,243,0,1,0,92,0,72,4,6,5,209,0,21,0,0,
+19,16,18,51,50,18,19,35,2,38,35,34,6,21,20,18,23,7,38,39,7,35,92,253,216,
+228,226,15,151,22,139,157,141,166,181,192,127,172,84,17,135,3,90,1,36,1,83,
+254,147,254,133,1,69,249,225,236,139,254,184,207,112,191,177,243,255,255,
+0,0,0,72,3,170,5,209,0,2,0,132,164,0,0,1,0,92,255,12,3,156,3,141,0,14,0,0,
+1,22,18,23,6,6,7,39,54,55,38,2,39,33,21,1,27,41,180,96,78,233,33,78,97,106,
+92,160,37,3,64,2,233,149,254,80,178,44,159,27,101,105,89,185,1,196,221,164,
+0,1,0,0,255,12,3,33,3,141,0,14,0,0,37,2,3,53,33,21,33,22,18,23,6,6,7,39,54,
+1,2,168,90,3,33,253,127,41,180,96,78,233,33,78,97,51,1,95,1,87,164,164,149,
+254,80,178,44,159,27,101,105,0,255,255,0,92,254,110,5,244,5,209,2,34,0,96,
+0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,164,255,188,255,255,255,250,254,110,
+5,146,5,209,0,34,0,96,158,0,0,35,0,14,0,137,255,188,0,3,0,14,2,63,255,188,
+255,255,255,250,254,110,6,240,6,20,0,34,0,116,158,0,0,34,0,14,92,188,0,3,
+0,14,2,18,255,188,0,3,0,92,0,82,9,14,3,141,0,24,0,34,0,44,0,0,1,22,21,20,
+6,35,34,38,53,52,54,55,33,21,33,22,21,20,6,35,34,38,53,52,55,5,52,39,33,6,
+21,16,51,50,54,37,52,39,33,6,21,16,51,50,54,3,92,41,212,193,187,217,45,47,
+8,86,254,41,45,212,193,187,217,41,2,95,41,254,108,41,242,112,132,252,32,41,
+254,109,41,242,112,131,2,233,96,139,196,232,225,225,117,180,80,164,96,139,
+196,232,215,213,135,100,231,132,99,99,132,254,250,131,131,137,94,84,124,254,
+227,131,0,3,0,0,0,82,7,229,3,141,0,25,0,35,0,45,0,0,17,33,21,33,22,21,20,
+6,35,34,38,53,52,55,33,22,21,20,6,35,34,38,53,52,55,35,5,52,39,33,6,21,16,
+51,50,54,37,52,39,33,6,21,16,51,50,54,7,229,254,246,45,212,193,187,217,41,
+254,244,45,212,194,186,217,41,41,2,135,41,254,109,41,241,113,131,3,223,41,
+254,109,41,242,112,131,3,141,164,96,139,196,232,215,213,135,100,100,135,196,
+232,215,213,139,96,231,137,94,94,137,254,250,131,131,137,94,94,137,254,250,
+131,255,255,0,92,0,82,9,14,3,141,0,2,0,139,0,0,0,3,0,0,0,82,8,178,3,141,0,
+25,0,35,0,45,0,0,17,33,21,33,22,21,20,6,35,34,38,53,52,55,33,22,21,20,6,35,
+34,38,53,52,55,35,5,52,39,33,6,21,16,51,50,54,37,52,39,33,6,21,16,51,50,54,
+8,178,254,41,45,212,193,187,217,41,254,244,45,212,194,186,217,41,41,2,135,
+41,254,109,41,241,113,131,3,223,41,254,109,41,242,112,131,3,141,164,96,139,
+196,232,215,213,135,100,100,135,196,232,215,213,139,96,231,137,94,94,137,
+254,250,131,131,137,94,94,137,254,250,131,255,255,0,0,254,139,4,104,3,141,
+2,2,0,86,0,0,255,255,0,92,254,139,4,196,3,141,0,2,0,86,92,0,255,255,0,92,
+254,139,4,196,3,141,0,2,0,86,92,0,0,1,0,0,254,139,3,156,3,141,0,19,0,0,1,
+22,18,23,1,2,2,17,53,51,21,16,18,23,55,2,17,53,33,21,2,92,4,115,115,253,217,
+152,135,154,96,117,254,172,1,219,2,233,229,254,92,213,255,0,1,23,2,33,1,38,
+164,164,255,0,254,95,219,112,1,81,1,192,159,164,255,255,255,254,0,82,4,182,
+6,66,2,2,0,6,0,0,0,2,255,254,253,227,5,158,6,66,0,41,0,49,0,0,1,34,0,7,33,
+22,22,21,20,6,6,35,34,2,17,16,0,33,50,4,18,21,20,2,7,6,6,21,20,23,35,38,53,
+52,54,55,54,18,53,52,2,36,1,50,54,53,52,39,33,18,2,193,250,254,222,5,2,110,
+19,28,94,168,106,237,226,1,123,1,72,229,1,77,171,162,178,95,65,43,168,39,
+99,118,168,117,132,254,255,254,71,97,125,21,254,25,8,5,152,254,235,246,57,
+216,73,141,220,120,1,122,1,120,1,106,1,148,196,254,147,246,203,254,142,236,
+128,142,99,79,79,76,82,119,210,156,225,1,32,180,198,1,31,152,251,100,156,
+155,119,63,254,19,0,1,0,0,253,227,5,92,6,66,0,50,0,0,17,52,18,36,51,50,4,
+18,21,20,2,7,6,6,21,20,23,35,38,53,52,54,55,54,18,53,16,0,33,34,0,7,33,22,
+21,20,6,35,34,6,7,53,54,54,51,50,54,53,52,39,33,157,1,44,202,225,1,66,166,
+161,179,92,68,43,167,39,102,115,162,122,254,225,254,248,229,254,249,5,2,47,
+43,215,168,107,168,73,58,152,138,96,125,20,253,186,3,68,236,1,90,184,197,
+254,147,245,203,254,141,235,125,148,96,79,79,65,93,123,212,150,217,1,35,185,
+1,49,1,76,254,231,242,172,174,189,224,25,39,164,37,26,127,123,122,60,0,1,
+0,0,253,227,4,154,5,209,0,40,0,0,37,38,39,7,35,17,52,18,36,51,32,0,17,20,
+6,2,7,6,6,21,20,23,35,38,53,52,54,55,62,2,53,52,2,35,34,6,21,20,18,23,1,84,
+126,62,17,135,143,1,9,174,1,21,1,63,69,154,130,97,73,43,168,38,96,129,118,
+127,56,237,199,191,229,136,169,150,155,135,243,2,149,195,1,30,150,254,142,
+254,188,144,238,254,248,163,121,156,92,79,79,74,84,124,203,158,148,215,198,
+132,248,1,20,227,234,117,254,230,197,0,0,1,0,0,2,233,0,227,5,14,0,7,0,0,17,
+51,3,51,3,51,21,35,45,45,180,47,94,227,3,141,1,129,254,127,164,0,255,255,
+0,92,2,233,1,63,5,14,0,2,0,151,92,0,0,1,0,0,253,227,2,203,5,14,0,31,0,0,17,
+51,3,51,3,51,50,22,21,20,6,7,14,2,21,20,23,35,38,53,52,54,55,62,2,53,52,38,
+35,35,45,45,180,47,109,235,238,117,156,55,59,23,43,168,39,88,107,86,97,36,
+152,163,240,3,141,1,129,254,127,211,196,113,251,201,71,104,81,64,79,79,68,
+90,98,200,142,113,157,108,67,123,120,0,255,255,0,92,2,233,1,63,5,14,0,2,0,
+151,92,0,255,255,0,0,2,233,0,227,5,14,0,2,0,151,0,0,0,1,0,0,0,18,4,152,3,
+141,0,20,0,0,19,17,20,51,51,17,33,21,33,17,51,50,22,23,21,38,35,33,32,17,
+17,162,198,68,2,236,253,182,59,76,111,28,61,154,254,223,254,152,3,141,254,
+60,213,2,153,164,254,11,31,25,170,56,1,127,1,196,0,4,0,92,0,82,6,4,5,221,
+0,22,0,35,0,43,0,52,0,0,19,16,18,51,50,23,54,54,51,50,18,17,16,2,35,34,38,
+39,6,6,35,34,2,1,34,6,7,33,38,38,35,34,6,7,38,38,1,50,54,54,55,33,21,16,1,
+20,22,22,51,50,54,53,53,92,235,228,156,100,53,111,82,239,244,215,223,98,150,
+43,41,168,92,218,200,1,207,135,146,16,4,90,18,153,144,82,111,53,51,121,1,
+207,103,114,57,2,254,31,253,125,54,108,94,98,127,3,0,1,99,1,122,129,64,65,
+254,130,254,161,254,161,254,177,96,98,98,96,1,92,3,133,205,217,216,206,76,
+86,86,76,251,201,96,219,178,159,254,178,1,237,174,223,96,166,168,159,0,2,
+0,92,0,197,5,109,5,176,0,16,0,30,0,0,37,2,37,38,53,52,18,54,51,50,18,19,33,
+21,33,2,7,39,54,54,53,16,38,35,34,6,6,21,23,22,22,2,63,181,254,220,10,106,
+195,125,193,190,6,1,226,254,30,13,136,94,47,34,107,120,77,120,67,4,104,218,
+197,1,95,197,58,57,184,1,13,143,254,244,254,233,164,254,201,237,163,111,227,
+140,1,2,200,104,199,133,31,71,242,0,255,255,0,92,0,197,5,109,5,176,0,2,0,
+158,0,0,255,255,255,246,0,197,5,7,5,176,0,2,0,158,154,0,0,2,255,246,0,197,
+6,59,5,176,0,25,0,38,0,0,1,2,7,35,2,37,38,53,52,18,54,51,50,18,19,33,32,17,
+20,7,35,54,53,52,38,35,1,54,54,53,52,38,35,34,6,21,23,22,22,3,37,13,137,182,
+180,254,219,10,105,197,124,192,191,6,1,176,1,102,51,151,45,92,109,253,92,
+47,35,105,122,122,142,4,104,217,2,233,254,199,235,1,92,200,58,57,185,1,11,
+144,254,244,254,233,254,174,131,108,108,131,84,90,254,127,111,227,140,251,
+207,238,198,31,71,242,0,2,0,92,0,152,4,33,5,190,0,16,0,26,0,0,1,50,23,54,
+55,51,2,2,17,21,38,36,2,53,52,54,54,19,16,19,38,35,34,6,21,20,22,1,248,137,
+82,59,72,203,196,163,174,254,234,154,108,189,148,127,60,100,111,149,147,5,
+82,105,113,100,254,236,254,10,254,201,229,5,176,1,55,194,157,238,129,252,
+37,1,172,1,63,92,194,182,164,246,0,1,0,0,254,152,4,123,3,141,0,32,0,0,17,
+53,33,21,33,20,23,21,33,34,6,21,20,22,51,51,50,22,23,21,38,38,35,35,34,38,
+53,52,54,51,51,38,53,4,123,254,10,84,254,152,129,95,86,86,43,138,168,63,65,
+149,155,43,159,158,184,185,182,57,2,233,164,164,225,229,125,76,65,58,69,32,
+48,178,50,44,149,142,147,158,185,230,255,255,0,92,254,152,5,199,3,141,0,2,
+0,165,0,0,0,1,0,92,254,152,5,199,3,141,0,31,0,0,19,55,33,21,33,20,23,21,33,
+34,6,21,20,22,51,51,50,22,23,21,38,38,35,35,32,17,52,54,51,51,38,53,92,37,
+5,70,254,10,84,254,151,129,94,86,86,43,138,168,63,65,149,155,43,254,195,184,
+184,183,58,2,233,164,164,225,229,125,76,65,58,69,32,48,178,50,44,1,35,147,
+158,186,229,0,0,2,0,0,0,6,3,6,3,141,0,6,0,13,0,0,1,17,37,38,38,53,17,23,21,
+20,22,23,23,17,3,6,254,98,182,178,162,121,123,208,3,141,252,121,90,41,236,
+174,1,106,164,198,109,149,29,47,2,20,0,2,0,0,0,6,4,184,3,141,0,8,0,15,0,0,
+1,21,33,17,37,38,38,53,17,23,21,20,22,23,23,17,4,184,254,78,254,98,182,178,
+162,121,123,208,3,141,164,253,29,90,41,236,174,1,106,164,198,109,149,29,47,
+2,20,0,0,2,0,92,0,129,5,88,5,209,0,20,0,25,0,0,19,51,54,18,54,51,50,18,19,
+35,2,38,35,34,6,21,16,19,33,17,51,1,38,39,35,17,238,192,2,119,211,137,228,
+226,15,151,22,141,155,141,166,237,253,31,146,1,71,103,26,198,3,141,176,1,
+9,139,254,147,254,133,1,71,247,215,223,254,175,254,97,5,47,251,123,228,218,
+254,66,0,0,1,0,20,0,86,7,150,5,137,0,42,0,0,37,2,3,35,34,6,6,7,3,35,3,38,
+38,35,34,7,53,54,51,50,22,23,23,51,54,33,51,54,18,51,50,18,19,7,38,38,35,
+34,6,21,20,18,23,4,244,231,29,97,116,112,56,9,20,135,53,11,73,84,93,129,144,
+121,151,126,7,6,9,68,1,1,97,18,248,198,207,245,20,164,17,155,136,141,164,
+124,126,86,1,83,1,64,51,121,124,254,215,2,231,154,129,52,150,61,198,228,172,
+170,246,1,6,254,188,254,210,21,229,248,203,210,169,254,195,174,0,2,0,20,0,
+82,8,166,6,66,0,48,0,56,0,0,1,22,22,21,20,6,6,35,34,2,3,35,34,6,6,7,3,35,
+3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,51,18,0,33,50,4,18,23,7,2,2,
+35,34,2,7,1,50,54,53,52,39,33,18,6,254,21,26,93,169,107,215,232,15,95,116,
+112,56,9,20,135,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,99,16,1,58,
+1,5,168,1,13,165,13,164,20,238,193,200,228,4,1,31,96,125,20,254,24,9,3,141,
+68,209,69,141,219,121,1,64,1,87,51,121,124,254,215,2,231,154,129,52,150,61,
+198,228,172,170,1,69,1,112,185,254,169,216,20,1,18,1,64,254,227,238,253,111,
+156,155,122,60,254,19,255,255,255,250,0,152,3,191,5,190,0,2,0,162,158,0,0,
+1,0,92,0,150,5,176,7,27,0,34,0,0,1,17,33,21,33,18,19,33,21,33,18,23,35,2,
+2,39,35,6,2,6,35,34,39,53,22,51,50,54,55,54,55,33,53,33,17,2,172,1,82,254,
+211,86,70,2,67,253,234,105,36,156,54,155,67,8,28,84,127,108,96,88,94,80,70,
+86,39,54,13,254,217,1,66,7,27,254,241,127,255,0,255,0,164,254,84,167,1,30,
+2,77,183,139,254,254,102,51,153,39,115,141,223,68,127,1,15,0,0,2,0,20,0,82,
+7,25,5,57,0,34,0,44,0,0,37,3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,
+33,22,22,21,20,6,35,34,38,53,52,55,35,34,6,6,7,3,1,52,39,33,6,21,16,51,50,
+54,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,3,43,44,53,212,194,
+186,217,41,138,116,112,56,9,20,4,33,45,254,112,41,242,113,131,152,2,231,154,
+129,52,150,61,198,228,172,170,77,221,101,193,235,215,213,139,96,51,121,124,
+254,215,1,106,123,108,99,132,254,250,131,255,255,0,20,0,82,8,195,5,57,2,2,
+0,182,0,0,255,255,0,0,0,82,4,211,3,141,2,2,0,5,0,0,255,255,0,0,0,82,7,25,
+3,141,2,2,0,183,0,0,0,2,0,20,255,119,11,31,5,57,0,41,0,51,0,0,1,34,6,6,7,
+3,35,3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,21,33,18,19,7,2,3,33,
+22,21,20,6,35,34,38,53,52,55,5,52,39,33,6,21,16,51,50,54,3,143,116,112,56,
+9,20,135,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,7,146,253,129,117,
+225,150,241,113,254,238,45,212,194,186,217,41,2,94,41,254,108,41,242,113,
+131,2,233,51,121,124,254,215,2,231,154,129,52,150,61,198,228,172,170,164,
+254,104,254,112,74,1,195,1,175,100,135,193,235,215,213,139,96,231,132,99,
+99,132,254,250,131,0,2,0,0,255,119,9,117,3,141,0,23,0,33,0,0,55,35,3,53,33,
+21,33,18,19,7,2,3,33,22,21,20,6,35,34,38,53,52,55,33,5,52,39,33,6,21,16,51,
+50,54,174,135,39,9,117,253,129,117,225,150,241,113,254,238,45,212,194,186,
+217,41,254,102,3,248,41,254,108,41,242,113,131,197,2,36,164,164,254,104,254,
+112,74,1,195,1,175,100,135,193,235,215,213,139,96,231,132,99,99,132,254,250,
+131,0,255,255,0,20,255,119,11,31,5,57,2,2,0,177,0,0,0,1,0,0,254,139,5,207,
+3,141,0,28,0,0,1,22,18,23,1,2,2,17,53,51,21,16,18,23,55,2,17,53,33,32,17,
+20,7,35,54,53,52,38,35,2,92,4,115,115,253,217,152,135,154,96,117,254,172,
+2,167,1,103,51,152,45,92,109,2,233,229,254,92,213,255,0,1,23,2,33,1,38,164,
+164,255,0,254,95,219,112,1,81,1,192,159,254,174,126,113,104,135,84,90,0,0,
+1,0,0,0,33,5,225,3,141,0,28,0,0,1,21,35,34,6,7,53,54,54,51,51,38,17,33,53,
+33,32,17,20,7,35,54,53,52,38,35,33,20,22,2,217,248,171,215,95,73,197,211,
+74,61,254,18,4,123,1,102,51,151,45,93,108,254,10,43,1,8,135,38,58,174,47,
+39,192,1,4,164,254,174,131,108,108,131,84,90,129,229,0,2,0,20,0,82,8,195,
+5,57,0,35,0,45,0,0,37,3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,21,
+33,22,21,20,6,35,34,38,53,52,55,35,34,6,6,7,3,1,52,39,33,6,21,16,51,50,54,
+1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,5,54,254,41,45,212,
+194,186,217,41,138,116,112,56,9,20,4,33,41,254,108,41,242,113,131,152,2,231,
+154,129,52,150,61,198,228,172,170,164,100,135,193,235,215,213,139,96,51,121,
+124,254,215,1,106,132,99,99,132,254,250,131,0,2,0,0,0,82,7,25,3,141,0,17,
+0,27,0,0,55,35,3,53,33,21,33,22,21,20,6,35,34,38,53,52,55,33,5,52,39,33,6,
+21,16,51,50,54,174,135,39,7,25,254,41,45,212,194,186,217,41,254,102,3,248,
+41,254,108,41,242,113,131,197,2,36,164,164,100,135,193,235,215,213,139,96,
+231,132,99,99,132,254,250,131,0,0,2,0,20,0,82,9,133,5,57,0,44,0,54,0,0,1,
+34,6,6,7,3,35,3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,32,17,20,7,
+35,54,53,52,38,35,33,22,21,20,6,35,34,38,53,52,55,5,52,39,33,6,21,16,51,50,
+54,3,143,116,112,56,9,20,135,53,11,73,84,93,129,144,121,151,126,7,6,9,68,
+1,1,4,146,1,102,51,152,45,92,108,254,205,45,212,194,186,217,41,2,94,41,254,
+108,41,242,113,131,2,233,51,121,124,254,215,2,231,154,129,52,150,61,198,228,
+172,170,254,174,126,113,104,135,84,90,100,135,193,235,215,213,139,96,231,
+132,99,99,132,254,250,131,0,0,2,0,0,0,82,5,150,3,141,0,23,0,33,0,0,17,33,
+32,17,20,7,35,54,53,52,38,35,33,22,21,20,6,35,34,38,53,52,55,35,5,52,39,33,
+6,21,16,51,50,54,4,47,1,103,52,151,45,92,109,254,205,45,212,194,186,217,41,
+41,2,135,41,254,109,41,241,113,131,3,141,254,174,129,110,108,131,84,90,100,
+135,196,232,215,213,139,96,231,137,94,94,137,254,250,131,0,0,2,0,0,0,82,7,
+236,6,176,0,28,0,38,0,0,37,38,38,2,53,33,22,21,20,6,35,34,38,53,52,55,35,
+53,33,20,18,23,16,18,55,51,6,2,17,37,52,39,33,6,21,16,51,50,54,6,104,151,
+241,142,254,170,45,212,194,186,217,41,41,4,233,105,121,196,160,189,188,200,
+252,31,41,254,109,41,241,113,131,109,8,167,1,40,165,100,135,196,232,215,213,
+139,96,164,251,254,243,70,1,191,2,226,208,233,253,39,254,81,195,137,94,94,
+137,254,250,131,0,4,0,92,0,82,9,27,6,66,0,31,0,38,0,46,0,55,0,0,37,34,38,
+39,6,6,35,34,2,17,52,18,36,51,50,4,18,23,33,32,17,20,7,35,54,53,52,38,35,
+33,2,2,1,32,0,7,33,38,0,19,50,54,54,55,33,21,16,1,20,22,22,51,50,54,53,53,
+4,78,98,150,43,41,168,92,218,200,177,1,78,226,197,1,44,182,24,1,184,1,103,
+52,151,45,92,109,254,80,4,215,254,20,254,248,254,236,29,4,84,35,254,231,50,
+103,114,57,2,254,31,253,125,54,108,94,98,127,82,96,98,98,96,1,92,1,82,247,
+1,123,208,166,254,198,213,254,174,129,110,108,131,84,90,254,177,254,184,5,
+70,254,233,244,246,1,21,251,100,96,219,178,159,254,178,1,237,174,223,96,166,
+168,159,0,255,255,255,254,255,119,9,170,6,66,0,2,0,70,162,0,255,255,0,20,
+255,119,11,31,5,57,0,2,0,177,0,0,0,2,0,92,0,82,8,184,6,20,0,43,0,53,0,0,1,
+2,33,34,0,17,20,18,23,7,38,2,53,52,18,36,51,32,0,19,33,32,17,20,7,35,54,53,
+52,38,35,33,22,21,20,6,6,35,34,38,53,52,54,55,1,52,39,33,6,21,16,51,50,54,
+4,233,86,254,89,228,254,246,92,103,150,100,107,164,1,43,193,1,21,1,84,54,
+1,199,1,102,51,151,45,93,108,254,76,4,103,185,114,186,221,43,35,2,57,4,254,
+63,32,233,111,141,3,141,1,221,254,214,254,253,141,254,166,192,64,188,1,132,
+174,214,1,72,178,254,181,254,196,254,174,131,108,108,131,84,90,60,64,160,
+247,132,242,239,92,189,65,254,224,64,60,71,111,254,201,184,0,1,0,0,254,152,
+5,225,3,141,0,41,0,0,17,53,33,32,17,20,7,35,54,53,52,38,35,33,20,23,21,33,
+34,6,21,20,22,51,51,50,22,23,21,38,38,35,35,34,38,53,52,54,51,51,38,53,4,
+123,1,102,51,151,45,93,108,254,10,84,254,152,129,95,86,86,43,138,168,63,65,
+149,155,43,159,158,184,185,182,57,2,233,164,254,174,131,108,108,131,84,90,
+225,229,125,76,65,58,69,32,48,178,50,44,149,142,147,158,185,230,0,0,2,0,92,
+0,82,7,37,7,154,0,44,0,52,0,0,1,34,6,7,33,22,22,21,20,6,6,35,34,2,17,16,0,
+33,50,23,54,55,35,34,38,39,53,22,22,51,51,21,6,6,7,22,23,33,21,33,3,35,3,
+2,2,1,50,54,53,52,39,33,18,2,201,207,248,4,2,111,19,28,95,169,107,232,229,
+1,71,1,38,226,146,29,80,57,173,147,49,61,155,153,245,79,84,5,85,36,1,238,
+254,82,39,135,39,23,237,254,127,96,125,21,254,25,8,5,70,235,206,62,221,63,
+140,222,119,1,118,1,124,1,63,1,109,121,164,145,36,42,160,43,31,135,125,232,
+129,140,202,164,253,220,2,36,1,43,1,50,251,182,156,155,125,57,254,19,0,1,
+255,193,0,197,2,131,6,8,0,22,0,0,17,53,51,38,38,39,53,51,50,54,55,21,6,6,
+35,35,22,23,33,21,33,3,35,29,4,41,47,247,142,153,72,55,145,167,73,52,9,1,
+215,254,82,39,135,2,233,164,113,205,110,136,27,44,158,45,32,171,229,164,253,
+220,0,1,255,193,0,197,4,201,6,57,0,39,0,0,17,53,51,2,39,53,33,50,55,21,6,
+6,35,35,22,19,33,38,39,53,51,50,54,55,21,6,6,35,35,22,23,33,21,33,3,35,3,
+33,3,35,29,8,84,1,12,161,62,33,98,92,94,57,4,1,182,4,35,195,151,150,66,52,
+144,171,31,14,5,1,215,254,82,39,135,39,254,143,39,135,2,233,164,1,24,230,
+135,39,159,23,20,225,254,255,184,142,135,30,44,160,43,35,125,172,164,253,
+220,2,36,253,220,0,0,1,255,152,0,197,4,201,6,63,0,42,0,0,17,53,51,38,38,39,
+53,51,50,54,55,21,6,6,35,35,22,23,33,18,55,35,34,38,39,53,22,22,51,51,21,
+6,6,7,33,21,33,3,35,3,33,3,35,27,4,62,65,233,88,84,31,29,90,84,45,79,9,1,
+199,9,114,50,102,109,34,37,102,106,226,76,76,4,1,199,254,82,39,135,39,254,
+143,39,135,2,233,164,90,164,92,136,12,16,159,19,14,136,182,1,15,211,20,29,
+159,24,21,135,129,246,135,164,253,220,2,36,253,220,0,1,0,0,0,150,6,74,5,223,
+0,34,0,0,19,18,19,51,16,19,33,32,17,20,7,35,54,53,52,38,35,33,18,19,35,38,
+2,3,35,6,2,21,20,23,35,38,2,53,53,102,88,199,166,51,2,133,1,103,51,152,45,
+92,109,253,158,75,142,174,113,131,28,9,115,98,25,158,23,34,3,141,1,65,1,17,
+254,211,254,219,254,174,126,113,104,135,84,90,254,208,254,221,255,2,5,1,86,
+216,254,110,238,156,102,109,1,88,142,164,255,255,0,20,254,139,8,88,5,57,0,
+2,2,44,0,0,255,255,0,20,0,82,8,195,5,57,0,2,0,182,0,0,0,1,254,199,0,197,4,
+242,6,72,0,40,0,0,17,53,51,54,55,35,34,38,39,53,22,22,51,51,21,6,7,33,18,
+55,35,34,38,39,53,22,22,51,51,21,6,3,33,21,33,3,35,3,33,3,35,33,4,29,13,171,
+146,49,54,153,159,187,61,3,1,223,4,70,37,108,117,39,39,111,114,211,100,4,
+1,211,254,82,39,135,39,254,102,39,135,2,233,164,165,132,36,42,160,39,35,135,
+179,147,1,5,221,26,31,160,31,23,135,253,254,255,164,253,220,2,36,253,220,
+0,0,2,0,0,254,190,6,139,3,141,0,27,0,39,0,0,19,22,23,54,54,51,50,22,21,20,
+6,35,34,38,2,3,53,33,32,17,20,7,35,54,53,52,38,35,1,34,6,7,22,22,51,50,54,
+53,52,38,162,52,77,49,158,96,190,222,201,152,156,221,205,71,5,37,1,102,51,
+151,45,93,108,253,45,78,129,35,70,145,86,86,107,125,2,233,211,219,72,88,229,
+191,170,207,238,2,17,1,44,164,254,174,131,108,108,131,84,90,254,80,86,71,
+168,146,113,100,117,141,0,1,255,250,0,86,5,145,7,154,0,41,0,0,37,0,17,52,
+18,54,51,50,23,54,55,35,34,38,39,53,22,22,51,51,21,6,6,21,22,23,33,21,33,
+3,35,3,46,2,35,34,6,21,20,18,23,1,2,254,248,113,215,141,153,103,30,78,57,
+173,148,48,59,153,157,246,84,84,59,25,1,237,254,82,39,135,39,17,69,125,108,
+141,166,114,133,86,1,151,1,105,193,1,33,153,80,165,134,37,41,160,42,32,135,
+127,238,133,135,195,164,253,220,2,36,226,237,111,229,236,177,254,206,197,
+0,2,0,92,255,119,8,250,6,66,0,41,0,49,0,0,1,22,22,21,20,6,6,35,34,2,17,16,
+0,33,50,0,19,33,32,17,20,7,35,54,53,52,38,35,33,22,18,23,7,2,2,3,2,2,35,34,
+2,7,1,50,54,53,52,39,33,18,3,109,19,28,95,169,107,232,229,1,56,1,16,249,1,
+36,67,2,143,1,103,51,152,45,92,109,253,144,40,165,122,149,170,149,44,52,212,
+190,193,225,4,1,31,96,125,21,254,25,8,3,141,62,221,63,140,222,119,1,118,1,
+124,1,103,1,151,254,188,254,143,254,174,126,113,104,135,84,90,193,254,118,
+221,74,1,68,1,156,1,1,1,50,1,14,254,232,243,253,111,156,155,125,57,254,19,
+0,255,255,255,254,255,119,8,156,6,66,0,2,0,202,162,0,255,255,0,0,255,119,
+8,113,6,66,0,2,1,118,164,0,255,255,255,250,255,119,7,189,6,20,0,2,1,142,158,
+0,255,255,0,20,0,152,4,45,6,119,0,2,0,11,0,0,0,1,0,0,255,12,5,78,3,141,0,
+27,0,0,1,32,17,20,7,35,54,53,52,38,35,33,22,18,22,51,50,55,21,6,6,35,34,38,
+38,2,39,53,3,231,1,103,51,152,45,92,109,252,187,61,193,138,79,110,60,23,90,
+57,114,162,139,158,60,3,141,254,174,126,113,104,135,84,90,214,254,73,166,
+86,186,33,37,120,246,1,145,222,164,0,0,2,0,80,254,80,2,55,0,55,0,11,0,23,
+0,0,23,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,
+184,80,60,59,82,82,59,60,80,104,142,102,100,143,143,100,101,143,188,60,82,
+82,60,59,80,80,59,100,143,142,101,101,143,143,0,2,0,92,0,82,5,12,6,66,0,25,
+0,33,0,0,1,22,22,21,20,6,6,35,34,2,17,16,0,33,50,4,18,17,35,38,2,38,35,34,
+2,7,1,50,54,53,52,39,33,18,3,109,19,28,95,169,105,235,228,1,61,1,21,176,1,
+21,153,151,5,113,203,134,198,230,4,1,31,96,125,21,254,25,8,3,141,62,221,63,
+140,222,119,1,120,1,122,1,101,1,153,208,254,120,254,255,217,1,52,162,254,
+230,241,253,111,156,155,125,57,254,19,0,0,1,0,0,0,18,4,29,3,141,0,17,0,0,
+1,21,33,21,16,33,51,50,22,23,21,38,35,35,34,38,53,17,4,29,252,133,1,24,84,
+76,111,28,61,154,84,213,229,3,141,164,206,254,217,31,25,170,56,229,236,1,
+114,0,0,1,0,0,0,18,6,221,3,141,0,24,0,0,17,53,33,17,20,51,51,17,33,21,33,
+17,51,50,23,21,38,35,33,32,17,17,33,3,35,2,231,199,68,2,235,253,182,60,150,
+65,62,153,254,223,254,152,254,143,39,135,2,233,164,254,60,213,2,153,164,254,
+11,56,170,56,1,127,1,32,253,220,0,1,0,0,0,178,2,244,5,182,0,16,0,0,1,20,2,
+7,39,54,54,53,52,2,39,17,35,17,50,4,18,2,244,90,97,141,86,80,221,211,162,
+232,1,89,179,2,252,178,254,229,125,94,107,235,150,219,1,12,37,251,189,4,241,
+172,254,195,0,1,0,20,0,152,6,227,5,182,0,41,0,0,1,20,2,7,39,54,54,53,52,2,
+39,17,35,17,35,34,6,6,7,3,35,3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,
+51,17,50,4,18,6,227,90,96,141,86,80,219,214,161,97,116,112,56,9,20,135,53,
+11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,99,232,1,88,179,2,252,178,254,
+229,125,94,107,235,150,216,1,14,38,251,189,2,36,51,121,124,254,215,2,231,
+154,129,52,150,61,198,228,172,170,2,41,172,254,195,0,0,1,0,0,0,18,2,229,3,
+141,0,17,0,0,1,21,33,21,16,33,51,50,22,23,21,38,35,35,34,38,53,17,2,229,253,
+189,1,24,84,76,111,28,61,154,84,213,229,3,141,164,206,254,217,31,25,170,56,
+229,236,1,114,0,0,1,0,0,0,18,6,98,3,141,0,21,0,0,17,53,33,21,33,21,16,33,
+51,50,23,21,38,35,35,34,38,53,53,33,3,35,6,98,252,133,1,25,84,150,65,61,154,
+84,213,229,254,143,39,135,2,233,164,164,206,254,217,56,170,56,229,236,206,
+253,220,0,0,1,0,20,0,18,8,135,5,57,0,42,0,0,37,3,38,38,35,34,7,53,54,51,50,
+22,23,23,51,54,33,33,17,20,51,51,17,33,21,33,17,51,50,23,21,38,35,33,32,17,
+17,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,1,
+4,199,68,2,235,253,182,60,150,65,62,153,254,223,254,152,97,116,112,56,9,20,
+152,2,231,154,129,52,150,61,198,228,172,170,254,60,213,2,153,164,254,11,56,
+170,56,1,127,1,32,51,121,124,254,215,0,1,0,20,0,18,8,12,5,57,0,39,0,0,37,
+3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,21,33,21,16,33,51,50,23,
+21,38,35,35,34,38,53,53,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,151,
+126,7,6,9,68,1,1,4,127,252,133,1,25,84,150,65,61,154,84,213,229,97,116,112,
+56,9,20,152,2,231,154,129,52,150,61,198,228,172,170,164,206,254,217,56,170,
+56,229,236,206,51,121,124,254,215,0,0,1,0,20,0,18,6,213,5,57,0,39,0,0,37,
+3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,21,33,21,16,33,51,50,23,
+21,38,35,35,34,38,53,53,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,151,
+126,7,6,9,68,1,1,3,72,253,188,1,25,84,150,65,61,154,84,213,229,97,116,112,
+56,9,20,152,2,231,154,129,52,150,61,198,228,172,170,164,206,254,217,56,170,
+56,229,236,206,51,121,124,254,215,0,255,255,0,0,0,82,7,25,3,141,2,2,0,183,
+0,0,0,2,0,20,0,6,8,168,5,57,0,31,0,38,0,0,37,3,38,38,35,34,7,53,54,51,50,
+22,23,23,51,54,33,33,21,33,17,37,38,38,53,53,35,34,6,6,7,3,1,21,20,22,23,
+23,17,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,5,27,254,78,254,
+98,182,178,97,116,112,56,9,20,2,59,121,123,209,152,2,231,154,129,52,150,61,
+198,228,172,170,164,253,29,90,41,236,174,198,51,121,124,254,215,2,81,198,
+109,149,29,47,2,20,0,2,0,20,0,6,6,246,5,57,0,29,0,36,0,0,37,3,38,38,35,34,
+7,53,54,51,50,22,23,23,51,54,33,33,17,37,38,38,53,53,35,34,6,6,7,3,1,21,20,
+22,23,23,17,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,3,105,254,
+98,182,178,97,116,112,56,9,20,2,59,121,123,209,152,2,231,154,129,52,150,61,
+198,228,172,170,252,121,90,41,236,174,198,51,121,124,254,215,2,81,198,109,
+149,29,47,2,20,0,0,2,0,20,255,8,8,166,6,66,0,52,0,60,0,0,1,22,22,21,20,6,
+7,22,23,7,38,39,38,2,3,35,34,6,6,7,3,35,3,38,38,35,34,7,53,54,51,50,22,23,
+23,51,54,33,51,18,0,33,50,4,18,23,7,2,2,35,34,2,7,1,50,54,53,52,39,33,18,
+6,254,21,26,119,96,71,74,145,96,68,213,224,15,95,116,112,56,9,20,135,53,11,
+73,84,93,129,144,121,151,126,7,6,9,68,1,1,99,16,1,58,1,5,168,1,13,165,13,
+164,20,238,193,200,228,4,1,31,96,125,20,254,24,9,3,141,68,209,69,166,227,
+51,156,129,82,176,154,5,1,64,1,82,51,121,124,254,215,2,231,154,129,52,150,
+61,198,228,172,170,1,69,1,112,185,254,169,216,20,1,18,1,64,254,227,238,253,
+111,156,155,122,60,254,19,0,2,0,20,255,8,7,25,5,57,0,39,0,49,0,0,37,3,38,
+38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,22,22,21,20,6,7,22,23,7,38,39,
+34,38,53,52,55,35,34,6,6,7,3,1,52,39,33,6,21,16,51,50,54,1,207,53,11,73,84,
+93,129,144,121,151,126,7,6,9,68,1,1,3,43,44,53,129,111,63,78,145,96,68,184,
+217,41,138,116,112,56,9,20,4,33,45,254,112,41,242,113,131,152,2,231,154,129,
+52,150,61,198,228,172,170,77,221,101,160,198,41,140,137,82,176,154,215,213,
+139,96,51,121,124,254,215,1,106,123,108,99,132,254,250,131,0,2,0,20,255,8,
+8,195,5,57,0,40,0,50,0,0,37,3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,
+33,21,33,22,21,20,6,7,22,23,7,38,39,34,38,53,52,55,35,34,6,6,7,3,1,52,39,
+33,6,21,16,51,50,54,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,
+5,54,254,41,45,129,111,63,78,145,96,68,184,217,41,138,116,112,56,9,20,4,33,
+41,254,108,41,242,113,131,152,2,231,154,129,52,150,61,198,228,172,170,164,
+100,135,160,198,41,140,137,82,176,154,215,213,139,96,51,121,124,254,215,1,
+106,132,99,99,132,254,250,131,0,2,0,0,255,8,4,211,3,141,0,19,0,29,0,0,17,
+33,21,33,22,21,20,6,7,22,23,7,38,39,34,38,53,52,55,35,5,52,39,33,6,21,16,
+51,50,54,4,211,254,41,45,127,112,55,86,146,91,72,188,214,41,41,2,135,41,254,
+109,41,241,113,131,3,141,164,100,135,150,210,41,121,154,82,168,162,217,211,
+139,96,231,137,94,94,137,254,250,131,0,2,0,0,255,8,7,25,3,141,0,22,0,32,0,
+0,55,35,3,53,33,21,33,22,21,20,6,7,22,23,7,38,39,34,38,53,52,55,33,5,52,39,
+33,6,21,16,51,50,54,174,135,39,7,25,254,41,45,129,111,63,78,145,96,68,184,
+217,41,254,102,3,248,41,254,108,41,242,113,131,197,2,36,164,164,100,135,160,
+198,41,140,137,82,176,154,215,213,139,96,231,132,99,99,132,254,250,131,0,
+255,255,0,0,0,82,4,211,3,141,2,2,0,5,0,0,0,2,255,254,255,8,4,182,6,66,0,28,
+0,36,0,0,1,22,22,21,20,6,7,22,23,7,38,39,38,2,17,16,0,33,50,4,18,23,7,2,2,
+35,34,2,7,1,50,54,53,52,39,33,18,3,14,19,28,118,97,67,79,146,100,63,234,219,
+1,61,1,21,168,1,14,163,13,164,20,238,192,198,230,4,1,30,97,125,21,254,25,
+8,3,141,57,216,73,166,227,51,147,138,82,183,147,5,1,125,1,112,1,101,1,153,
+187,254,171,216,20,1,21,1,61,254,230,241,253,111,156,155,119,63,254,19,255,
+255,255,254,0,82,4,182,6,66,2,2,0,6,0,0,0,2,0,20,0,6,6,246,5,74,0,35,0,42,
+0,0,37,37,38,38,53,53,35,34,6,6,7,3,35,3,38,38,35,34,7,53,54,51,50,22,23,
+23,51,54,33,51,38,39,55,22,23,33,5,21,20,22,23,23,17,6,246,254,98,182,178,
+97,116,112,56,9,20,135,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,207,
+79,101,145,120,91,1,234,253,155,121,123,209,6,90,41,236,174,198,51,121,124,
+254,215,2,231,154,129,52,150,61,198,228,172,170,173,190,82,219,226,164,198,
+109,149,29,47,2,20,0,2,0,20,0,6,8,168,5,74,0,37,0,44,0,0,37,3,38,38,35,34,
+7,53,54,51,50,22,23,23,51,54,33,51,38,39,55,22,23,33,21,33,17,37,38,38,53,
+53,35,34,6,6,7,3,1,21,20,22,23,23,17,1,207,53,11,73,84,93,129,144,121,151,
+126,7,6,9,68,1,1,207,79,101,145,120,91,3,156,254,78,254,98,182,178,97,116,
+112,56,9,20,2,59,121,123,209,152,2,231,154,129,52,150,61,198,228,172,170,
+173,190,82,219,226,164,253,29,90,41,236,174,198,51,121,124,254,215,2,81,198,
+109,149,29,47,2,20,0,0,2,255,184,0,6,4,184,5,74,0,14,0,21,0,0,19,38,39,55,
+22,23,33,21,33,17,37,38,38,53,17,23,21,20,22,23,23,17,109,100,81,146,126,
+85,3,155,254,78,254,98,182,178,162,121,123,208,3,141,220,143,82,233,212,164,
+253,29,90,41,236,174,1,106,164,198,109,149,29,47,2,20,0,2,0,0,0,6,6,254,5,
+74,0,19,0,26,0,0,17,53,33,38,39,55,22,23,33,21,33,17,37,38,38,53,53,33,3,
+35,1,21,20,22,23,23,17,2,178,98,82,145,120,91,3,156,254,78,254,98,182,178,
+254,143,39,135,2,192,121,123,209,2,233,164,215,148,82,219,226,164,253,29,
+90,41,236,174,198,253,220,2,36,198,109,149,29,47,2,20,0,2,255,184,0,6,3,6,
+5,74,0,12,0,19,0,0,1,17,37,38,38,53,17,51,38,39,55,22,23,7,21,20,22,23,23,
+17,3,6,254,98,182,178,108,86,94,146,126,85,123,121,123,208,3,141,252,121,
+90,41,236,174,1,106,195,168,82,233,212,164,198,109,149,29,47,2,20,0,255,255,
+0,20,0,82,8,166,6,66,2,2,0,170,0,0,255,255,0,20,0,82,7,25,5,57,2,2,0,173,
+0,0,255,255,0,20,0,82,8,195,5,57,2,2,0,182,0,0,255,255,0,0,0,82,4,211,3,141,
+2,2,0,5,0,0,255,255,0,0,0,82,7,25,3,141,2,2,0,183,0,0,255,255,255,254,0,82,
+4,182,6,66,2,2,0,6,0,0,0,1,0,92,253,227,8,49,3,141,0,45,0,0,19,53,33,50,22,
+21,20,2,7,14,2,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,33,21,16,33,51,
+50,23,21,38,35,35,34,38,53,53,33,3,35,92,5,252,236,237,123,149,55,59,23,43,
+168,39,89,105,86,96,37,151,164,252,238,1,24,84,150,65,61,154,84,213,229,254,
+143,39,135,2,233,164,211,196,116,254,255,192,71,104,81,64,83,75,65,93,101,
+200,139,111,156,111,67,123,120,206,254,217,56,170,56,229,236,206,253,220,
+0,255,255,0,0,253,227,7,213,3,141,0,2,0,241,164,0,255,255,0,92,0,143,5,139,
+5,43,0,2,0,12,92,0,255,255,0,0,0,143,5,47,5,43,2,2,0,12,0,0,255,255,0,0,0,
+143,7,27,6,242,2,2,0,77,0,0,0,2,0,92,253,227,7,10,3,141,0,37,0,47,0,0,1,50,
+22,21,20,2,7,14,2,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,33,22,21,20,
+6,35,34,38,53,52,54,55,1,52,39,33,6,21,16,51,50,54,5,49,236,237,126,146,55,
+59,23,43,168,39,89,105,86,96,37,151,164,254,45,41,212,193,187,217,45,47,2,
+43,41,254,109,41,242,112,131,3,141,211,196,121,254,255,187,71,104,81,64,83,
+75,65,93,101,200,139,111,156,111,67,123,120,96,139,196,232,225,225,117,180,
+80,254,117,137,94,84,124,254,227,131,255,255,0,92,0,82,5,12,6,66,2,2,0,209,
+0,0,255,255,255,254,0,82,4,174,6,66,0,2,0,209,162,0,0,2,0,0,253,227,6,174,
+3,141,0,37,0,47,0,0,17,33,50,22,21,20,6,7,6,6,21,20,23,35,38,53,52,54,55,
+62,2,53,52,38,35,33,22,21,20,6,35,34,38,53,52,55,35,5,52,39,33,6,21,16,51,
+50,54,4,213,236,237,113,159,81,57,43,167,39,89,105,86,96,37,151,164,254,41,
+45,212,194,186,217,41,41,2,135,41,254,109,41,241,113,131,3,141,211,196,111,
+245,209,105,128,87,79,79,65,93,101,200,139,111,156,111,67,123,120,100,135,
+196,232,215,213,139,96,231,137,94,94,137,254,250,131,255,255,0,92,253,227,
+9,0,6,66,2,2,1,94,0,0,255,255,0,92,0,82,7,37,6,66,2,2,0,92,0,0,255,255,255,
+254,0,82,6,199,6,66,0,2,0,92,162,0,255,255,255,254,253,227,8,162,6,66,0,2,
+1,94,162,0,255,255,0,92,0,82,7,37,7,154,2,2,0,192,0,0,255,255,255,254,0,82,
+6,199,7,154,0,2,0,192,162,0,255,255,0,92,0,18,7,94,6,66,2,2,5,75,0,0,255,
+255,0,92,0,18,8,150,6,66,2,2,5,76,0,0,255,255,255,254,0,18,7,0,6,66,0,2,5,
+75,162,0,255,255,255,254,0,18,8,56,6,66,0,2,5,76,162,0,255,255,0,92,0,18,
+9,16,6,66,2,2,5,78,0,0,255,255,255,254,0,18,8,178,6,66,0,2,5,78,162,0,255,
+255,0,92,0,82,6,4,6,66,2,2,0,44,0,0,255,255,0,92,0,82,7,180,6,66,2,2,0,46,
+0,0,255,255,255,254,0,82,7,86,6,66,0,2,0,46,162,0,255,255,255,254,0,82,5,
+166,6,66,0,2,0,44,162,0,255,255,0,92,255,8,6,4,6,66,2,2,5,83,0,0,255,255,
+0,92,255,8,7,180,6,66,2,2,5,84,0,0,255,255,255,254,255,8,7,86,6,66,0,2,5,
+84,162,0,255,255,255,254,255,8,5,166,6,66,0,2,5,83,162,0,0,4,0,92,0,82,6,
+4,7,160,0,23,0,30,0,38,0,47,0,0,37,34,38,39,6,6,35,34,2,17,52,18,36,55,38,
+39,55,22,23,4,0,17,16,2,1,32,0,7,33,38,0,19,50,54,54,55,33,21,16,1,20,22,
+22,51,50,54,53,53,4,78,98,150,43,41,168,92,218,200,161,1,47,206,46,91,145,
+110,64,1,18,1,66,215,254,16,254,248,254,236,29,4,84,35,254,231,50,103,114,
+57,2,254,31,253,125,54,108,94,98,127,82,96,98,98,96,1,92,1,82,234,1,112,212,
+15,100,173,82,207,152,36,254,73,254,162,254,161,254,177,5,70,254,233,244,
+246,1,21,251,100,96,219,178,159,254,178,1,237,174,223,96,166,168,159,0,4,
+0,92,0,82,7,180,7,160,0,26,0,33,0,41,0,50,0,0,37,34,38,39,6,6,35,34,2,17,
+52,18,36,55,38,39,55,22,23,22,0,19,33,21,33,2,2,1,32,0,7,33,38,0,19,50,54,
+54,55,33,21,16,1,20,22,22,51,50,54,53,53,4,78,98,150,43,41,168,92,218,200,
+161,1,47,206,46,91,145,110,64,241,1,59,32,1,184,254,80,4,215,254,20,254,248,
+254,236,29,4,84,35,254,231,50,103,114,57,2,254,31,253,125,54,108,94,98,127,
+82,96,98,98,96,1,92,1,82,234,1,112,212,15,100,173,82,207,152,32,254,153,254,
+219,164,254,177,254,184,5,70,254,233,244,246,1,21,251,100,96,219,178,159,
+254,178,1,237,174,223,96,166,168,159,0,255,255,255,254,0,82,7,86,7,160,0,
+2,1,15,162,0,255,255,255,254,0,82,5,166,7,160,0,2,1,14,162,0,255,255,0,92,
+0,82,6,4,6,66,2,2,0,44,0,0,255,255,0,92,0,82,7,180,6,66,2,2,0,46,0,0,255,
+255,255,254,0,82,7,86,6,66,0,2,0,46,162,0,255,255,255,254,0,82,5,166,6,66,
+0,2,0,44,162,0,255,255,0,0,0,129,4,252,5,209,0,2,0,168,164,0,0,2,0,92,0,129,
+5,94,5,209,0,20,0,25,0,0,1,38,38,35,34,6,21,16,19,33,17,51,17,51,54,18,54,
+51,50,18,19,1,38,39,35,17,4,188,18,158,137,141,166,237,253,31,146,192,2,119,
+211,137,211,242,22,252,215,103,26,198,3,70,252,229,215,223,254,175,254,97,
+5,47,253,221,176,1,9,139,254,182,254,211,253,209,228,218,254,66,0,2,0,0,253,
+227,5,236,5,209,0,37,0,42,0,0,19,51,18,0,51,32,0,17,20,6,2,7,6,6,21,20,23,
+35,38,53,52,54,55,62,2,53,52,2,35,34,6,21,16,19,33,17,51,1,38,39,35,17,145,
+193,15,1,58,253,1,21,1,63,69,154,130,104,66,43,168,39,95,131,118,127,56,237,
+199,191,229,237,253,31,145,1,70,109,20,197,3,141,1,16,1,52,254,142,254,188,
+144,238,254,248,163,129,152,88,79,79,76,82,120,203,162,148,215,198,132,248,
+1,20,227,234,254,183,254,112,5,47,251,123,231,215,254,66,0,3,0,92,0,82,6,
+244,6,20,0,29,0,39,0,44,0,0,1,16,19,33,17,51,17,51,54,18,36,51,32,0,17,20,
+6,6,35,34,38,53,52,54,55,33,2,33,34,0,1,52,39,33,6,21,16,51,50,54,5,38,39,
+35,17,2,80,237,253,31,146,194,15,172,1,30,180,1,84,1,99,103,185,114,186,221,
+43,35,2,34,86,254,88,226,254,245,4,2,4,254,63,32,233,111,141,251,221,108,
+19,194,3,61,254,196,254,128,5,47,253,221,195,1,40,156,254,20,254,69,160,247,
+132,242,239,92,189,65,1,221,254,215,254,44,64,60,71,111,254,201,184,137,225,
+221,254,66,0,3,0,92,0,82,8,164,6,20,0,34,0,44,0,49,0,0,1,16,19,33,17,51,17,
+51,54,18,36,51,32,0,19,33,21,33,22,21,20,6,6,35,34,38,53,52,54,55,33,2,33,
+34,0,1,52,39,33,6,21,16,51,50,54,5,38,39,35,17,2,80,237,253,31,146,194,15,
+172,1,30,180,1,22,1,85,53,1,199,254,76,4,103,185,114,186,221,43,35,2,34,86,
+254,88,226,254,245,4,2,4,254,63,32,233,111,141,251,221,108,19,194,3,61,254,
+196,254,128,5,47,253,221,195,1,40,156,254,180,254,197,164,60,64,160,247,132,
+242,239,92,189,65,1,221,254,215,254,44,64,60,71,111,254,201,184,137,225,221,
+254,66,255,255,0,0,0,82,8,72,6,20,0,2,1,26,164,0,255,255,0,0,0,82,6,152,6,
+20,0,2,1,25,164,0,0,2,0,92,0,18,7,166,5,209,0,35,0,40,0,0,19,51,54,18,54,
+51,50,18,19,33,21,33,21,16,33,51,50,23,21,38,35,35,34,38,53,53,16,33,34,6,
+21,16,19,33,17,51,1,38,39,35,17,238,192,2,119,211,137,203,244,26,2,74,253,
+188,1,25,84,150,65,62,153,84,213,229,254,194,141,166,237,253,31,146,1,71,
+103,26,198,3,141,176,1,9,139,254,205,254,239,164,206,254,217,56,170,56,229,
+236,227,2,41,215,223,254,175,254,97,5,47,251,123,228,218,254,66,0,0,2,0,92,
+0,18,8,221,5,209,0,35,0,40,0,0,19,51,54,18,54,51,50,18,19,33,21,33,21,16,
+33,51,50,23,21,38,35,35,34,38,53,53,16,33,34,6,21,16,19,33,17,51,1,38,39,
+35,17,238,192,2,119,211,137,203,244,26,3,129,252,133,1,25,84,150,65,62,153,
+84,213,229,254,194,141,166,237,253,31,146,1,71,103,26,198,3,141,176,1,9,139,
+254,205,254,239,164,206,254,217,56,170,56,229,236,227,2,41,215,223,254,175,
+254,97,5,47,251,123,228,218,254,66,0,255,255,0,0,0,18,8,129,5,209,0,2,1,30,
+164,0,255,255,0,0,0,18,7,74,5,209,0,2,1,29,164,0,0,2,0,92,0,18,10,190,5,209,
+0,46,0,51,0,0,37,51,50,23,21,38,35,33,32,17,17,16,33,34,6,21,16,19,33,17,
+51,17,51,54,18,54,51,50,18,17,17,20,51,51,17,33,32,17,20,7,35,54,53,52,38,
+35,33,1,38,39,35,17,7,14,60,150,65,62,153,254,223,254,152,254,194,141,166,
+237,253,31,146,192,2,119,211,137,225,254,199,68,2,235,1,102,51,151,45,92,
+109,253,182,251,39,103,26,198,244,56,170,56,1,127,1,53,2,41,215,223,254,175,
+254,97,5,47,253,221,176,1,9,139,254,134,254,167,254,203,213,2,153,254,174,
+131,108,108,131,84,90,254,66,228,218,254,66,0,0,2,0,92,0,18,9,88,5,209,0,
+37,0,42,0,0,37,38,35,33,32,17,17,16,33,34,6,21,16,19,33,17,51,17,51,54,18,
+54,51,50,18,17,17,20,51,51,17,33,21,33,17,51,50,23,37,38,39,35,17,8,33,62,
+153,254,223,254,152,254,194,141,166,237,253,31,146,192,2,119,211,137,225,
+254,199,68,2,235,253,182,60,150,65,250,20,103,26,198,18,56,1,127,1,53,2,41,
+215,223,254,175,254,97,5,47,253,221,176,1,9,139,254,134,254,167,254,203,213,
+2,153,164,254,11,56,111,228,218,254,66,255,255,0,0,0,18,8,252,5,209,0,2,1,
+34,164,0,255,255,0,0,0,18,10,98,5,209,0,2,1,33,164,0,0,2,0,92,0,129,7,70,
+5,209,0,26,0,31,0,0,1,33,3,35,3,46,2,35,34,6,21,16,19,33,17,51,17,51,54,18,
+54,51,50,18,19,33,1,38,39,35,17,7,70,254,82,39,136,38,19,70,125,106,141,166,
+237,253,31,146,192,2,119,211,137,209,223,37,1,238,250,239,103,26,198,2,233,
+253,220,2,36,232,234,108,215,223,254,175,254,97,5,47,253,221,176,1,9,139,
+254,229,254,215,253,158,228,218,254,66,255,255,0,0,0,129,6,234,5,209,0,2,
+1,37,164,0,255,255,0,0,253,227,8,197,5,209,0,2,1,40,164,0,0,2,0,92,253,227,
+9,33,5,209,0,50,0,55,0,0,1,50,22,21,20,6,7,14,2,21,20,23,35,38,53,52,54,55,
+62,2,53,52,38,35,33,3,35,3,46,2,35,34,6,21,16,19,33,17,51,17,51,54,18,54,
+51,50,18,19,1,38,39,35,17,7,72,235,238,117,156,55,59,23,43,168,39,88,107,
+86,97,36,152,163,254,82,39,136,38,19,70,125,106,141,166,237,253,31,146,192,
+2,119,211,137,209,223,37,252,221,103,26,198,3,141,211,196,113,251,201,71,
+104,81,64,79,79,68,90,98,200,142,113,157,108,67,123,120,253,220,2,36,232,
+234,108,215,223,254,175,254,97,5,47,253,221,176,1,9,139,254,229,254,215,253,
+158,228,218,254,66,0,255,255,0,92,0,82,8,164,6,20,2,2,1,26,0,0,255,255,0,
+0,0,82,8,72,6,20,0,2,1,26,164,0,255,255,0,0,0,82,6,152,6,20,0,2,1,25,164,
+0,255,255,0,92,0,82,6,244,6,20,2,2,1,25,0,0,0,3,0,92,255,8,6,244,6,20,0,33,
+0,43,0,48,0,0,1,16,19,33,17,51,17,51,54,18,36,51,32,0,17,20,2,7,22,23,7,38,
+39,34,38,53,52,54,55,33,2,33,34,0,1,52,39,33,6,21,16,51,50,54,5,38,39,35,
+17,2,80,237,253,31,146,194,15,172,1,30,180,1,84,1,99,133,107,72,74,146,96,
+68,184,221,43,35,2,34,86,254,88,226,254,245,4,2,4,254,63,32,233,111,141,251,
+221,108,19,194,3,61,254,196,254,128,5,47,253,221,195,1,40,156,254,20,254,
+69,189,255,0,55,157,130,82,176,154,244,237,92,189,65,1,221,254,215,254,44,
+64,60,71,111,254,201,184,137,225,221,254,66,0,3,0,92,255,8,8,164,6,20,0,38,
+0,48,0,53,0,0,1,16,19,33,17,51,17,51,54,18,36,51,32,0,19,33,21,33,22,21,20,
+2,7,22,23,7,38,39,34,38,53,52,54,55,33,2,33,34,0,1,52,39,33,6,21,16,51,50,
+54,5,38,39,35,17,2,80,237,253,31,146,194,15,172,1,30,180,1,22,1,85,53,1,199,
+254,76,4,133,107,72,74,146,96,68,184,221,43,35,2,34,86,254,88,226,254,245,
+4,2,4,254,63,32,233,111,141,251,221,108,19,194,3,61,254,196,254,128,5,47,
+253,221,195,1,40,156,254,180,254,197,164,60,64,189,255,0,55,157,130,82,176,
+154,244,237,92,189,65,1,221,254,215,254,44,64,60,71,111,254,201,184,137,225,
+221,254,66,255,255,0,0,255,8,8,72,6,20,0,2,1,46,164,0,255,255,0,0,255,8,6,
+152,6,20,0,2,1,45,164,0,0,3,0,92,0,82,6,244,7,160,0,33,0,43,0,48,0,0,1,16,
+19,33,17,51,17,51,18,0,55,38,39,55,22,23,4,0,17,20,6,6,35,34,38,53,52,54,
+55,33,2,33,34,0,1,52,39,33,6,21,16,51,50,54,5,38,39,35,17,2,80,237,253,31,
+146,194,23,1,77,250,55,102,145,114,81,1,13,1,34,103,185,114,186,221,43,35,
+2,34,86,254,88,226,254,245,4,2,4,254,63,32,233,111,141,251,221,108,19,194,
+3,61,254,196,254,128,5,47,253,221,1,30,1,91,12,126,190,82,209,199,47,254,
+36,254,112,160,247,132,242,239,92,189,65,1,221,254,215,254,44,64,60,71,111,
+254,201,184,137,225,221,254,66,0,0,3,0,92,0,82,8,164,7,160,0,38,0,48,0,53,
+0,0,1,16,19,33,17,51,17,51,18,0,55,38,39,55,22,23,22,0,19,33,21,33,22,21,
+20,6,6,35,34,38,53,52,54,55,33,2,33,34,0,1,52,39,33,6,21,16,51,50,54,5,38,
+39,35,17,2,80,237,253,31,146,194,23,1,77,250,55,102,145,114,81,206,1,27,47,
+1,199,254,76,4,103,185,114,186,221,43,35,2,34,86,254,88,226,254,245,4,2,4,
+254,63,32,233,111,141,251,221,108,19,194,3,61,254,196,254,128,5,47,253,221,
+1,30,1,91,12,126,190,82,209,199,37,254,199,254,227,164,60,64,160,247,132,
+242,239,92,189,65,1,221,254,215,254,44,64,60,71,111,254,201,184,137,225,221,
+254,66,255,255,0,0,0,82,8,72,7,160,0,2,1,50,164,0,255,255,0,0,0,82,6,152,
+7,160,0,2,1,49,164,0,255,255,0,92,0,82,6,244,6,20,2,2,1,25,0,0,255,255,0,
+92,0,82,8,164,6,20,2,2,1,26,0,0,255,255,0,0,0,82,8,72,6,20,0,2,1,26,164,0,
+255,255,0,0,0,82,6,152,6,20,0,2,1,25,164,0,255,255,0,20,254,178,6,135,5,57,
+0,35,0,14,1,139,0,0,0,35,0,14,3,211,0,0,0,2,0,91,0,0,255,255,0,20,254,178,
+6,135,5,57,0,35,0,14,1,139,0,0,0,35,0,14,3,211,0,0,0,2,0,91,0,0,255,255,0,
+0,254,178,4,201,3,141,2,34,0,60,0,0,0,34,0,14,207,0,0,3,0,14,2,18,0,0,0,1,
+0,92,0,86,4,4,5,209,0,22,0,0,37,0,17,52,18,54,51,50,18,19,35,2,38,35,34,6,
+7,33,21,33,22,18,23,1,100,254,248,114,212,141,228,226,15,151,22,139,157,131,
+160,12,1,72,254,185,14,124,107,86,1,139,1,97,198,1,42,159,254,147,254,133,
+1,69,249,207,203,164,146,254,235,148,0,1,255,252,253,227,4,154,5,209,0,39,
+0,0,37,0,17,16,0,33,32,0,17,20,6,2,7,6,6,21,20,23,35,38,53,52,54,55,62,2,
+53,52,2,35,34,6,7,33,21,33,22,18,23,1,4,254,248,1,58,1,16,1,21,1,63,69,154,
+130,97,73,43,168,38,96,129,118,127,56,237,199,181,223,18,1,71,254,187,13,
+120,111,86,1,139,1,97,1,47,1,96,254,142,254,188,144,238,254,248,163,121,156,
+92,79,79,74,84,124,203,158,148,215,198,132,248,1,20,203,207,164,144,254,239,
+154,255,255,255,252,253,227,4,154,5,209,2,2,1,61,0,0,255,255,0,20,0,152,4,
+45,6,119,0,2,0,11,0,0,255,255,255,193,0,197,2,131,6,8,2,2,0,193,0,0,255,255,
+255,193,0,197,4,201,6,57,2,2,0,194,0,0,255,255,255,152,0,197,4,201,6,63,2,
+2,0,195,0,0,255,255,0,92,0,10,4,215,3,141,0,2,0,101,92,0,255,255,0,92,0,10,
+4,215,3,141,0,2,0,101,92,0,255,255,0,0,0,10,4,123,3,141,2,2,0,101,0,0,0,1,
+0,0,0,10,5,225,3,141,0,26,0,0,53,53,54,55,55,54,54,53,33,53,33,32,17,20,7,
+35,54,53,52,38,35,33,20,6,7,7,6,68,165,168,97,63,253,207,4,123,1,102,51,151,
+45,93,108,254,84,103,114,221,147,10,195,68,92,90,51,137,102,164,254,174,131,
+108,108,131,84,90,157,199,59,119,79,0,0,1,0,92,254,176,5,117,3,141,0,31,0,
+0,5,38,39,35,34,6,7,53,54,54,51,51,54,55,33,55,33,21,33,6,21,20,23,21,35,
+34,6,7,53,54,54,51,3,41,32,7,80,170,219,92,74,198,209,76,4,55,253,35,37,4,
+244,254,92,62,68,248,156,165,70,60,162,169,78,136,126,37,59,174,48,38,208,
+189,164,164,218,218,217,198,136,42,52,172,48,38,255,255,0,92,254,176,5,117,
+3,141,0,2,1,71,0,0,0,1,0,0,254,176,4,164,3,141,0,31,0,0,5,38,39,35,34,6,7,
+53,54,54,51,51,54,55,33,53,33,21,33,6,21,20,23,21,35,34,6,7,53,54,54,51,2,
+88,32,7,80,170,219,92,74,198,209,76,4,55,253,152,4,164,254,92,61,67,248,158,
+164,69,60,166,165,78,136,126,37,59,174,48,38,208,189,164,164,214,222,219,
+196,136,43,51,172,48,38,0,0,1,0,0,254,176,6,10,3,141,0,40,0,0,5,38,39,35,
+34,6,7,53,54,54,51,51,54,55,33,53,33,32,17,20,7,35,54,53,52,38,35,33,6,21,
+20,23,21,35,34,6,7,53,54,54,51,2,88,32,7,80,170,219,92,74,198,209,76,4,55,
+253,152,4,164,1,102,51,152,46,93,108,254,92,61,67,248,158,164,69,60,166,165,
+78,136,126,37,59,174,48,38,208,189,164,254,174,131,108,106,133,84,90,214,
+222,219,196,136,43,51,172,48,38,0,2,0,92,255,119,6,190,3,141,0,19,0,29,0,
+0,1,21,33,18,19,7,2,3,33,22,21,20,6,35,34,38,53,52,54,55,1,52,39,33,6,21,
+16,51,50,54,6,190,254,78,119,223,149,238,117,254,242,41,212,193,187,217,45,
+47,2,43,41,254,109,41,242,112,131,3,141,164,254,104,254,112,74,1,185,1,185,
+96,139,196,232,225,225,117,180,80,254,117,137,94,84,124,254,227,131,0,255,
+255,0,20,255,119,11,31,5,57,2,2,0,177,0,0,255,255,0,0,255,119,7,47,3,141,
+2,2,3,174,0,0,255,255,0,0,0,82,5,150,3,141,0,2,0,185,0,0,255,255,0,92,0,143,
+5,139,5,43,0,2,0,12,92,0,255,255,0,0,0,143,5,47,5,43,2,2,0,12,0,0,255,255,
+0,0,0,143,7,27,6,242,2,2,0,77,0,0,255,255,0,92,0,197,6,139,5,209,2,2,0,79,
+0,0,255,255,0,0,0,197,4,201,3,141,2,2,0,60,0,0,255,255,255,188,0,109,3,86,
+6,176,2,2,0,4,0,0,255,255,0,0,255,119,9,117,3,141,2,2,0,178,0,0,255,255,255,
+254,0,82,4,182,6,66,2,2,0,6,0,0,255,255,0,0,0,82,5,150,3,141,2,2,0,185,0,
+0,0,1,0,20,255,12,9,61,5,57,0,49,0,0,37,3,38,38,35,34,7,53,54,51,50,22,23,
+23,51,54,33,33,32,17,20,7,35,54,53,52,38,35,33,22,18,22,51,50,55,21,6,6,35,
+34,38,38,2,3,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,
+68,1,1,4,74,1,102,51,151,45,92,109,252,186,62,192,137,80,111,59,22,90,58,
+103,149,130,180,70,97,116,112,56,9,20,152,2,231,154,129,52,150,61,198,228,
+172,170,254,174,131,108,108,131,84,90,213,254,75,169,86,186,33,37,96,200,
+1,180,1,1,51,121,124,254,215,0,1,0,20,255,12,7,215,5,57,0,40,0,0,37,3,38,
+38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,21,33,22,18,22,51,50,55,21,6,
+6,35,34,38,38,2,3,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,151,126,
+7,6,9,68,1,1,4,74,252,186,62,192,137,80,111,59,22,90,58,103,149,130,180,70,
+97,116,112,56,9,20,152,2,231,154,129,52,150,61,198,228,172,170,164,213,254,
+75,169,86,186,33,37,96,200,1,180,1,1,51,121,124,254,215,0,0,1,0,0,255,12,
+5,78,3,141,0,27,0,0,1,32,17,20,7,35,54,53,52,38,35,33,22,18,22,51,50,55,21,
+6,6,35,34,38,38,2,39,53,3,231,1,103,51,152,45,92,109,252,187,61,193,138,79,
+110,60,23,90,57,114,162,139,158,60,3,141,254,174,126,113,104,135,84,90,214,
+254,73,166,86,186,33,37,120,246,1,145,222,164,0,0,2,0,0,254,178,3,219,3,141,
+0,5,0,13,0,0,5,6,7,39,54,55,1,33,21,33,3,35,3,33,2,209,185,100,88,126,122,
+253,172,3,219,254,82,39,135,39,254,168,96,132,106,80,179,120,3,96,164,253,
+220,2,36,0,255,255,255,254,0,82,4,174,6,66,0,2,0,209,162,0,0,2,0,0,253,227,
+6,51,3,141,0,38,0,48,0,0,17,33,50,22,21,20,2,7,14,2,21,20,23,35,38,53,52,
+54,55,62,2,53,52,38,35,33,22,21,20,6,35,34,38,53,52,55,35,5,52,39,33,6,21,
+16,51,50,54,4,90,236,237,126,146,55,59,23,43,168,39,89,105,86,96,37,151,164,
+254,164,45,212,194,186,217,41,41,2,135,41,254,109,41,241,113,131,3,141,211,
+196,121,254,255,187,71,104,81,64,83,75,65,93,101,200,139,111,156,111,67,123,
+120,100,135,196,232,215,213,139,96,231,137,94,94,137,254,250,131,0,0,2,0,
+92,253,227,9,0,6,66,0,51,0,59,0,0,1,34,2,7,33,22,22,21,20,6,6,35,34,2,17,
+16,0,33,50,0,19,33,50,22,21,20,6,7,6,6,21,20,23,35,38,53,52,54,55,62,2,53,
+52,38,35,33,3,35,3,2,2,1,50,54,53,52,39,33,18,2,209,216,247,4,2,111,19,28,
+95,169,107,232,229,1,80,1,37,255,1,58,45,1,240,235,238,113,159,81,57,43,168,
+38,89,105,86,96,37,151,164,254,82,39,135,39,25,223,254,115,96,125,21,254,
+25,8,5,152,254,229,240,62,221,63,140,222,119,1,118,1,124,1,104,1,150,254,
+153,254,178,211,196,111,245,209,105,128,87,79,79,67,91,101,200,139,111,156,
+111,67,123,120,253,220,2,36,1,86,1,89,251,100,156,155,125,57,254,19,255,255,
+255,254,253,227,8,162,6,66,0,2,1,94,162,0,255,255,0,92,253,227,9,0,6,66,2,
+2,1,94,0,0,255,255,0,92,0,82,7,37,6,66,2,2,0,92,0,0,255,255,255,254,0,82,
+6,199,6,66,0,2,0,92,162,0,255,255,255,254,253,227,8,162,6,66,0,2,1,94,162,
+0,255,255,255,254,0,82,6,199,7,154,0,2,0,192,162,0,255,255,0,0,254,110,4,
+242,5,84,0,35,0,14,1,100,0,45,0,35,0,14,3,37,255,188,0,2,0,41,0,0,255,255,
+0,92,255,119,10,8,6,66,2,2,0,70,0,0,255,255,255,254,0,82,7,86,6,66,0,2,0,
+46,162,0,255,255,255,254,255,119,9,170,6,66,0,2,0,70,162,0,255,255,255,254,
+0,82,5,166,6,66,0,2,0,44,162,0,255,255,255,254,0,82,8,189,6,66,0,2,0,187,
+162,0,0,2,0,92,255,12,9,176,6,66,0,50,0,58,0,0,1,22,18,18,22,51,50,55,21,
+6,6,35,34,38,39,2,3,2,2,35,34,2,7,33,22,22,21,20,6,6,35,34,2,17,16,0,33,32,
+0,19,33,32,17,20,7,35,54,53,52,38,35,1,50,54,53,52,39,33,18,5,33,22,84,133,
+130,75,111,57,22,88,58,130,182,79,163,73,52,212,190,193,225,4,2,111,19,28,
+95,169,107,232,229,1,56,1,16,1,4,1,29,61,3,72,1,102,51,152,45,92,108,249,
+211,96,125,21,254,25,8,2,233,118,254,245,254,226,148,86,186,33,37,159,169,
+1,89,1,171,1,50,1,14,254,232,243,62,221,63,140,222,119,1,118,1,124,1,103,
+1,151,254,165,254,166,254,174,131,108,104,135,84,90,254,19,156,155,125,57,
+254,19,255,255,255,254,255,12,9,82,6,66,0,2,1,107,162,0,0,1,0,92,0,86,5,10,
+6,66,0,33,0,0,1,34,2,7,33,22,21,20,6,35,34,6,7,53,54,54,51,50,54,53,52,39,
+33,53,16,0,33,50,4,18,23,7,2,2,2,164,193,225,4,2,47,43,215,168,106,167,73,
+56,153,137,96,125,20,253,186,1,56,1,16,168,1,14,163,13,164,20,236,5,152,254,
+232,243,172,174,189,224,24,40,164,37,26,127,123,122,60,91,1,103,1,151,187,
+254,171,216,20,1,17,1,65,0,0,1,0,92,0,86,5,2,6,66,0,34,0,0,1,34,2,7,33,22,
+21,20,6,35,34,6,7,53,54,54,51,50,54,53,52,39,33,53,16,0,33,50,4,18,17,35,
+38,2,38,2,164,193,225,4,2,47,43,215,168,106,167,73,56,153,137,96,125,20,253,
+186,1,56,1,16,176,1,21,153,152,5,112,203,5,152,254,232,243,172,174,189,224,
+24,40,164,37,26,127,123,122,60,91,1,103,1,151,208,254,120,254,255,219,1,51,
+161,255,255,0,0,0,86,4,166,6,66,0,2,1,110,164,0,0,1,0,92,253,227,8,188,6,
+66,0,60,0,0,1,52,39,33,53,16,0,33,50,0,19,33,50,22,21,20,2,7,14,2,21,20,23,
+35,38,53,52,54,55,54,54,53,52,38,35,33,3,35,3,2,2,35,34,2,7,33,22,21,20,6,
+35,34,6,7,53,54,54,51,50,54,2,182,20,253,186,1,56,1,16,242,1,43,49,1,241,
+236,237,126,146,55,59,23,43,168,39,96,99,121,98,152,164,254,82,39,135,39,
+24,217,201,193,225,4,2,47,43,215,168,106,167,73,56,153,137,96,125,2,51,122,
+60,91,1,103,1,151,254,159,254,172,211,196,121,254,255,187,71,104,81,64,83,
+75,65,93,105,205,130,160,189,96,123,120,253,220,2,36,1,86,1,89,254,232,243,
+172,174,189,224,24,40,164,37,26,127,0,255,255,0,0,253,227,8,96,6,66,0,2,1,
+112,164,0,255,255,0,92,253,227,8,188,6,66,2,2,1,112,0,0,255,255,0,92,0,86,
+6,225,6,66,2,2,0,97,0,0,255,255,0,0,0,86,6,133,6,66,0,2,0,97,164,0,255,255,
+0,0,253,227,8,96,6,66,0,2,1,112,164,0,0,1,0,92,255,119,8,205,6,66,0,50,0,
+0,1,22,18,23,7,2,2,3,2,2,35,34,2,7,33,22,21,20,6,35,34,6,7,53,54,54,51,50,
+54,53,52,39,33,53,16,0,33,50,0,19,33,32,17,20,7,35,54,53,52,38,35,4,246,38,
+156,133,149,170,149,44,47,207,178,182,213,4,2,47,43,215,168,106,167,73,56,
+153,137,96,125,20,253,186,1,46,1,3,254,1,17,59,2,143,1,103,51,152,45,92,109,
+2,233,185,254,131,242,74,1,68,1,156,1,1,1,27,1,37,254,230,241,172,174,189,
+224,24,40,164,37,26,127,123,122,60,91,1,106,1,148,254,163,254,168,254,174,
+126,113,104,135,84,90,0,255,255,0,92,0,82,5,193,6,66,2,2,0,108,0,0,255,255,
+0,92,0,82,7,113,6,66,2,2,0,110,0,0,255,255,0,0,0,82,7,21,6,66,0,2,0,110,164,
+0,255,255,0,0,0,82,5,101,6,66,0,2,0,108,164,0,255,255,0,92,0,82,5,193,6,66,
+2,2,0,108,0,0,0,3,0,92,0,82,8,215,6,66,0,39,0,47,0,55,0,0,37,34,39,6,35,34,
+6,7,53,54,54,51,50,54,53,53,33,53,52,18,36,51,50,4,18,23,33,32,17,20,7,35,
+54,53,52,38,35,33,2,2,19,38,0,35,34,6,6,7,1,50,54,54,55,33,21,16,4,10,213,
+78,107,175,102,160,72,56,144,134,90,117,253,192,165,1,50,199,197,1,44,181,
+24,1,185,1,102,51,152,45,92,108,254,80,5,215,47,35,254,230,221,149,229,128,
+2,3,12,104,113,57,3,254,30,82,197,129,24,40,164,37,26,127,123,182,91,233,
+1,92,185,166,254,198,213,254,174,126,113,104,135,84,90,254,174,254,187,3,
+59,246,1,21,131,241,151,253,111,96,214,183,159,254,178,0,255,255,0,0,0,82,
+7,21,6,66,0,2,0,110,164,0,255,255,0,0,0,82,5,101,6,66,0,2,0,108,164,0,255,
+255,0,0,255,119,9,105,6,66,0,2,0,112,164,0,255,255,255,254,0,82,8,121,6,66,
+0,2,1,124,162,0,255,255,0,92,0,82,5,193,6,66,2,2,0,108,0,0,255,255,0,92,0,
+82,8,215,6,66,2,2,1,124,0,0,255,255,255,254,0,82,8,121,6,66,0,2,1,124,162,
+0,255,255,0,0,0,82,7,21,6,66,0,2,0,110,164,0,255,255,0,0,0,82,5,101,6,66,
+0,2,0,108,164,0,255,255,0,92,255,119,9,197,6,66,2,2,0,112,0,0,255,255,0,0,
+255,119,9,105,6,66,0,2,0,112,164,0,255,255,0,0,255,12,9,39,6,66,0,2,1,137,
+164,0,0,1,0,92,255,12,9,131,6,66,0,59,0,0,5,6,6,35,34,38,39,2,3,2,2,35,34,
+2,7,33,22,21,20,6,35,34,6,7,53,54,54,51,50,54,53,52,39,33,53,16,0,33,50,0,
+19,33,32,17,20,7,35,54,53,52,38,35,33,22,18,18,22,51,50,55,7,88,22,89,57,
+130,182,79,163,73,53,202,177,182,213,4,2,47,43,215,168,106,167,73,56,153,
+137,96,125,20,253,186,1,46,1,3,234,1,27,67,3,72,1,102,51,152,45,92,108,252,
+215,22,84,133,130,75,111,57,174,33,37,159,169,1,89,1,171,1,57,1,7,254,230,
+241,172,174,189,224,24,40,164,37,26,127,123,122,60,91,1,106,1,148,254,193,
+254,138,254,174,126,113,104,135,84,90,118,254,245,254,226,148,86,0,0,1,0,
+92,253,227,7,207,5,209,0,49,0,0,37,0,17,52,18,54,51,50,18,19,33,50,22,21,
+20,6,7,14,2,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,33,3,35,3,46,2,35,
+34,6,21,20,18,23,1,100,254,248,114,215,140,209,223,37,1,240,235,238,117,156,
+55,59,23,43,168,39,88,107,86,96,37,151,164,254,82,39,135,39,19,70,125,106,
+141,166,118,130,86,1,151,1,105,192,1,33,154,254,229,254,215,211,196,113,251,
+201,71,104,81,64,79,79,68,90,98,200,142,111,156,111,67,123,120,253,220,2,
+36,232,235,107,229,236,179,254,201,190,0,255,255,0,92,253,227,7,207,5,209,
+2,34,1,138,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,164,255,188,255,255,255,
+250,253,227,7,109,5,209,0,2,1,138,158,0,255,255,255,250,253,227,7,109,5,209,
+0,34,1,138,158,0,0,35,0,14,0,137,255,188,0,3,0,14,2,66,255,188,0,1,0,92,255,
+119,8,31,6,20,0,36,0,0,37,0,17,16,0,51,50,18,19,33,32,17,20,7,35,54,53,52,
+38,35,33,18,1,7,38,2,39,46,2,35,34,2,17,20,18,23,1,100,254,248,1,15,225,215,
+227,41,2,137,1,103,51,152,45,92,109,253,140,75,1,0,149,148,182,29,25,78,122,
+102,150,184,118,130,86,1,151,1,105,1,68,1,122,254,199,254,178,254,174,126,
+113,108,131,84,90,254,108,254,108,74,241,2,0,240,205,222,103,254,248,254,
+244,179,254,201,190,0,255,255,0,92,254,110,8,31,6,20,2,34,1,142,0,0,0,35,
+0,14,0,236,255,188,0,3,0,14,2,164,255,188,255,255,255,250,254,110,6,86,6,
+20,0,34,0,22,158,0,0,34,0,14,92,188,0,3,0,14,2,20,255,188,255,255,255,250,
+254,110,7,189,6,20,0,34,1,142,158,0,0,34,0,14,92,188,0,3,0,14,2,20,255,188,
+0,2,255,254,0,197,5,59,6,55,0,17,0,26,0,0,1,33,53,51,38,53,52,54,51,50,22,
+18,23,33,21,33,3,35,3,2,38,35,34,6,21,20,23,2,184,253,72,49,51,224,181,150,
+184,101,10,1,235,254,82,39,135,51,10,131,140,110,133,47,2,233,164,118,126,
+196,242,140,254,210,240,164,253,220,2,200,1,8,248,141,127,160,84,0,0,2,255,
+254,0,197,6,162,6,55,0,26,0,35,0,0,1,33,53,51,38,53,52,54,51,50,22,18,23,
+33,32,17,20,7,35,54,53,52,38,35,33,3,35,3,2,38,35,34,6,21,20,23,2,184,253,
+72,49,51,224,181,150,184,101,10,1,235,1,103,51,152,45,92,109,254,82,39,135,
+51,10,131,140,110,133,47,2,233,164,118,126,196,242,140,254,210,240,254,174,
+126,113,104,135,84,90,253,220,2,200,1,8,248,141,127,160,84,255,255,0,92,0,
+86,4,6,5,209,0,2,0,58,96,0,0,1,0,92,255,119,3,156,3,141,0,8,0,0,1,18,19,7,
+38,2,3,33,21,1,29,117,225,150,133,205,47,3,64,2,233,254,104,254,112,74,254,
+2,0,1,24,164,255,255,0,92,255,119,3,156,3,141,0,2,1,149,0,0,255,255,255,252,
+0,86,3,164,5,209,0,2,0,107,160,0,0,1,0,0,0,10,5,225,3,141,0,26,0,0,1,20,6,
+7,7,6,7,53,54,55,55,54,54,53,33,53,33,32,17,20,7,35,54,53,52,38,35,2,207,
+103,114,221,147,134,68,165,168,97,63,253,207,4,123,1,102,51,151,45,93,108,
+2,233,157,199,59,119,79,122,195,68,92,90,51,137,102,164,254,174,131,108,108,
+131,84,90,255,255,0,92,255,119,3,156,3,141,0,2,1,149,0,0,255,255,0,0,255,
+119,3,33,3,141,2,2,0,9,0,0,0,1,255,252,0,86,3,164,5,137,0,18,0,0,37,0,17,
+16,18,51,50,18,19,35,2,38,35,34,6,21,20,18,23,1,4,254,248,252,215,229,225,
+15,152,20,142,155,141,164,126,124,86,1,139,1,97,1,16,1,55,254,183,254,169,
+1,27,219,203,210,173,254,196,171,255,255,255,252,0,86,3,166,5,209,2,2,0,58,
+0,0,0,1,0,92,0,86,4,10,5,209,0,22,0,0,1,34,6,7,33,21,33,22,18,23,7,0,17,52,
+18,54,51,50,18,19,7,38,38,2,47,129,162,12,1,72,254,186,13,120,111,146,254,
+248,114,212,141,211,242,22,162,18,158,5,39,203,207,164,144,254,239,154,88,
+1,139,1,97,198,1,42,159,254,182,254,211,20,252,229,255,255,255,252,0,86,3,
+164,5,209,0,2,1,60,160,0,0,1,0,92,253,227,7,207,5,209,0,52,0,0,37,0,17,52,
+18,54,51,50,18,19,33,50,22,21,20,6,7,14,2,21,20,23,35,38,53,52,54,55,62,2,
+53,52,38,35,33,3,35,3,46,2,35,34,6,7,33,21,33,22,18,23,1,100,254,248,114,
+215,140,209,223,37,1,240,235,238,117,156,55,59,23,43,168,39,88,107,86,96,
+37,151,164,254,82,39,135,39,19,70,125,106,133,164,10,1,74,254,186,14,109,
+121,86,1,151,1,105,192,1,33,154,254,229,254,215,211,196,113,251,201,71,104,
+81,64,79,79,68,90,98,200,142,111,156,111,67,123,120,253,220,2,36,232,235,
+107,203,207,164,127,254,240,172,0,255,255,255,250,0,86,5,146,5,209,0,2,0,
+99,158,0,255,255,255,250,253,227,7,109,5,209,0,2,1,159,158,0,255,255,0,92,
+253,227,7,207,5,209,2,2,1,159,0,0,255,255,0,92,0,86,5,244,5,209,2,2,0,99,
+0,0,255,255,255,250,0,86,5,146,5,209,0,2,0,99,158,0,255,255,255,250,253,227,
+7,109,5,209,0,2,1,159,158,0,0,1,0,92,255,119,6,184,6,20,0,30,0,0,37,0,17,
+16,0,51,50,18,19,33,21,33,18,1,7,38,2,39,46,2,35,34,6,7,33,21,33,22,18,23,
+1,100,254,248,1,15,225,215,227,41,2,137,253,140,75,1,0,149,148,182,29,25,
+78,122,102,142,182,10,1,74,254,186,14,109,121,86,1,151,1,105,1,68,1,122,254,
+199,254,178,164,254,108,254,108,74,241,2,0,240,205,222,103,235,242,164,127,
+254,240,172,0,1,0,92,255,119,8,31,6,20,0,39,0,0,37,0,17,16,0,51,50,18,19,
+33,32,17,20,7,35,54,53,52,38,35,33,18,1,7,38,2,39,46,2,35,34,6,7,33,21,33,
+22,18,23,1,100,254,248,1,15,225,215,227,41,2,137,1,103,51,152,45,92,109,253,
+140,75,1,0,149,148,182,29,25,78,122,102,142,182,10,1,74,254,186,14,109,121,
+86,1,151,1,105,1,68,1,122,254,199,254,178,254,174,126,113,108,131,84,90,254,
+108,254,108,74,241,2,0,240,205,222,103,235,242,164,127,254,240,172,0,255,
+255,255,250,255,119,6,86,6,20,0,2,1,166,158,0,255,255,255,250,255,119,7,189,
+6,20,0,2,1,167,158,0,0,2,0,92,0,82,7,82,6,20,0,36,0,46,0,0,1,2,33,34,4,7,
+33,21,33,18,19,7,38,2,53,52,18,36,51,32,0,19,33,21,33,22,21,20,6,6,35,34,
+38,53,52,54,55,1,52,39,33,6,21,16,51,50,54,4,233,86,254,89,203,254,246,23,
+1,27,254,231,22,169,150,100,107,164,1,43,193,1,21,1,84,54,1,199,254,76,4,
+99,174,108,178,209,43,35,2,16,4,254,104,32,213,102,129,3,141,1,221,245,232,
+164,254,226,254,203,64,188,1,132,174,214,1,72,178,254,181,254,196,164,60,
+64,158,248,133,242,239,92,189,65,254,224,64,60,68,114,254,201,184,0,255,255,
+255,252,0,82,6,242,6,20,0,2,1,170,160,0,0,2,0,92,0,82,5,162,6,20,0,32,0,42,
+0,0,1,2,33,34,4,7,33,21,33,18,19,7,38,2,53,52,18,36,51,50,4,18,17,20,6,6,
+35,34,38,53,52,54,55,1,52,39,33,6,21,16,51,50,54,4,233,86,254,89,203,254,
+246,23,1,27,254,231,22,169,150,100,107,164,1,43,193,218,1,53,167,99,174,108,
+178,209,43,35,2,16,4,254,104,32,213,102,129,3,141,1,221,245,232,164,254,226,
+254,203,64,188,1,132,174,214,1,72,178,209,254,87,254,211,158,248,133,242,
+239,92,189,65,254,224,64,60,68,114,254,201,184,0,255,255,255,252,0,82,5,66,
+6,20,0,2,1,172,160,0,255,255,0,92,0,82,5,162,6,20,2,2,1,172,0,0,255,255,0,
+92,0,82,7,82,6,20,2,2,1,170,0,0,255,255,255,252,0,82,6,242,6,20,0,2,1,170,
+160,0,255,255,255,252,0,82,5,66,6,20,0,2,1,172,160,0,255,255,0,92,0,82,5,
+162,6,20,2,2,1,172,0,0,255,255,255,252,0,82,5,66,6,20,0,2,1,172,160,0,255,
+255,0,92,0,82,5,162,6,20,2,2,1,172,0,0,255,255,255,252,0,82,5,66,6,20,0,2,
+1,172,160,0,255,255,255,252,0,82,6,242,6,20,0,2,1,170,160,0,255,255,255,252,
+0,82,6,242,6,20,0,2,1,170,160,0,0,2,0,92,0,82,8,184,6,20,0,45,0,55,0,0,1,
+22,21,20,6,6,35,34,38,53,52,54,55,33,2,33,34,4,7,33,21,33,18,19,7,38,2,53,
+52,18,36,51,32,0,19,33,32,17,20,7,35,54,53,52,38,35,5,52,39,33,6,21,16,51,
+50,54,5,158,4,99,174,108,178,209,43,35,1,249,86,254,89,203,254,246,23,1,27,
+254,231,22,169,150,100,107,164,1,43,193,1,21,1,84,54,1,199,1,102,51,151,45,
+93,108,253,174,4,254,104,32,213,102,129,2,233,60,64,158,248,133,242,239,92,
+189,65,1,221,245,232,164,254,226,254,203,64,188,1,132,174,214,1,72,178,254,
+181,254,196,254,174,131,108,108,131,84,90,124,64,60,68,114,254,201,184,0,
+255,255,255,252,0,82,8,88,6,20,0,2,1,184,160,0,255,255,0,92,0,82,8,184,6,
+20,2,2,1,184,0,0,255,255,255,252,0,82,8,88,6,20,0,2,1,184,160,0,0,2,0,92,
+255,119,9,166,6,20,0,42,0,52,0,0,1,18,19,7,2,3,35,22,21,20,6,6,35,34,38,53,
+52,54,55,33,2,33,34,4,7,33,21,33,18,19,7,38,2,53,52,18,36,51,32,0,19,33,21,
+5,52,39,33,6,21,16,51,50,54,7,39,117,225,150,238,116,231,4,99,174,108,178,
+209,43,35,1,249,86,254,89,203,254,246,23,1,27,254,231,22,169,150,100,107,
+164,1,43,193,1,21,1,84,54,4,27,251,90,4,254,104,32,213,102,129,2,233,254,
+104,254,112,74,1,188,1,182,60,64,158,248,133,242,239,92,189,65,1,221,245,
+232,164,254,226,254,203,64,188,1,132,174,214,1,72,178,254,181,254,196,164,
+124,64,60,68,114,254,201,184,0,255,255,0,92,0,82,9,27,6,66,2,2,0,187,0,0,
+255,255,255,254,254,139,6,199,6,66,0,2,0,129,162,0,0,2,0,92,253,227,9,0,6,
+66,0,60,0,68,0,0,19,16,0,33,50,0,19,33,50,22,21,20,6,7,6,6,21,20,23,35,38,
+53,52,54,55,62,2,53,52,38,35,33,3,35,3,2,2,35,34,2,7,33,22,22,21,20,6,6,35,
+6,21,20,23,35,38,53,52,55,38,2,1,50,54,53,52,39,33,18,92,1,80,1,37,255,1,
+58,45,1,240,235,238,113,159,81,57,43,168,38,89,105,86,96,37,151,164,254,82,
+39,135,39,25,223,217,216,247,4,2,111,19,28,95,169,105,41,78,184,62,66,162,
+158,1,193,96,125,21,254,25,8,3,68,1,104,1,150,254,153,254,178,211,196,111,
+245,209,105,128,87,79,79,67,91,101,200,139,111,156,111,67,123,120,253,220,
+2,36,1,86,1,89,254,229,240,62,221,63,140,222,119,94,117,139,105,92,150,122,
+111,52,1,109,254,245,156,155,125,57,254,19,0,0,2,0,92,254,139,5,20,6,66,0,
+33,0,41,0,0,1,22,22,21,20,6,6,35,6,21,20,23,35,38,53,52,55,38,2,17,16,0,33,
+50,4,18,23,7,2,2,35,34,2,7,1,50,54,53,52,39,33,18,3,109,19,28,95,169,105,
+41,78,184,62,66,162,158,1,61,1,21,168,1,14,163,13,163,22,237,192,198,230,
+4,1,31,96,125,21,254,25,8,3,141,62,221,63,140,222,119,94,117,139,105,92,150,
+122,111,52,1,109,1,61,1,101,1,153,187,254,171,216,20,1,24,1,58,254,230,241,
+253,111,156,155,125,57,254,19,0,0,2,255,254,253,227,5,158,6,66,0,50,0,58,
+0,0,1,34,0,7,33,22,22,21,20,6,6,35,6,21,20,23,35,38,53,52,55,38,2,17,16,0,
+33,50,4,18,21,20,2,7,6,6,21,20,23,35,38,53,52,54,55,54,18,53,52,2,36,1,50,
+54,53,52,39,33,18,2,193,250,254,222,5,2,110,19,28,94,168,106,41,78,185,61,
+65,162,157,1,123,1,72,229,1,77,171,162,178,95,65,43,168,39,99,118,168,117,
+132,254,255,254,71,97,125,21,254,25,8,5,152,254,235,246,57,216,73,141,220,
+120,94,117,139,105,93,149,120,113,52,1,110,1,60,1,106,1,148,196,254,147,246,
+203,254,142,236,128,142,99,79,79,76,82,119,210,156,225,1,32,180,198,1,31,
+152,251,100,156,155,119,63,254,19,0,0,2,0,92,254,139,5,12,6,66,0,34,0,42,
+0,0,1,22,22,21,20,6,6,35,6,21,20,23,35,38,53,52,55,38,2,17,16,0,33,50,4,18,
+17,35,38,2,38,35,34,2,7,1,50,54,53,52,39,33,18,3,109,19,28,95,169,105,41,
+78,184,62,66,162,158,1,61,1,21,176,1,21,153,151,5,113,203,134,198,230,4,1,
+31,96,125,21,254,25,8,3,141,62,221,63,140,222,119,94,117,139,105,92,150,122,
+111,52,1,109,1,61,1,101,1,153,208,254,120,254,255,217,1,52,162,254,230,241,
+253,111,156,155,125,57,254,19,255,255,255,254,254,139,4,174,6,66,0,2,1,194,
+162,0,255,255,255,254,253,227,8,162,6,66,0,2,1,191,162,0,255,255,0,92,253,
+227,9,0,6,66,2,2,1,191,0,0,255,255,0,92,254,139,7,37,6,66,2,2,0,129,0,0,255,
+255,255,254,254,139,6,199,6,66,0,2,0,129,162,0,255,255,255,254,253,227,8,
+162,6,66,0,2,1,191,162,0,0,2,0,92,254,139,8,250,6,66,0,50,0,58,0,0,1,22,22,
+21,20,6,6,35,6,21,20,23,35,38,53,52,55,38,2,17,16,0,33,50,0,19,33,32,17,20,
+7,35,54,53,52,38,35,33,22,18,23,7,2,2,3,2,2,35,34,2,7,1,50,54,53,52,39,33,
+18,3,109,19,28,95,169,105,41,78,184,62,66,162,158,1,56,1,16,249,1,36,67,2,
+143,1,103,51,152,45,92,109,253,144,40,165,122,149,170,149,44,52,212,190,193,
+225,4,1,31,96,125,21,254,25,8,3,141,62,221,63,140,222,119,94,117,139,105,
+92,150,122,111,52,1,109,1,61,1,103,1,151,254,188,254,143,254,174,126,113,
+104,135,84,90,193,254,118,221,74,1,68,1,156,1,1,1,50,1,14,254,232,243,253,
+111,156,155,125,57,254,19,255,255,255,254,254,139,7,53,6,66,0,2,0,130,162,
+0,255,255,0,92,254,139,8,250,6,66,2,2,1,201,0,0,0,4,0,92,254,139,7,180,6,
+66,0,31,0,38,0,46,0,55,0,0,37,34,38,39,6,6,7,6,21,20,23,35,38,53,52,55,38,
+2,17,52,18,36,51,50,4,18,23,33,21,33,2,2,1,32,0,7,33,38,0,19,50,54,54,55,
+33,21,16,1,20,22,22,51,50,54,53,53,4,78,98,150,43,37,139,80,43,78,184,62,
+62,156,158,177,1,78,226,197,1,44,182,24,1,184,254,80,4,215,254,20,254,248,
+254,236,29,4,84,35,254,231,50,103,114,57,2,254,31,253,125,54,108,94,98,127,
+82,96,98,86,96,10,92,121,139,105,92,150,116,107,38,1,72,1,54,247,1,123,208,
+166,254,198,213,164,254,177,254,184,5,70,254,233,244,246,1,21,251,100,96,
+219,178,159,254,178,1,237,174,223,96,166,168,159,255,255,255,254,254,139,
+7,86,6,66,0,2,1,204,162,0,255,255,255,254,254,139,5,166,6,66,0,2,0,98,162,
+0,255,255,0,92,254,139,6,4,6,66,2,2,0,98,0,0,255,255,0,92,254,139,7,180,6,
+66,2,2,1,204,0,0,255,255,255,254,254,139,7,86,6,66,0,2,1,204,162,0,255,255,
+255,254,254,139,5,166,6,66,0,2,0,98,162,0,255,255,0,92,254,139,6,4,6,66,2,
+2,0,98,0,0,255,255,255,254,254,139,7,86,6,66,0,2,1,204,162,0,255,255,255,
+254,254,139,5,166,6,66,0,2,0,98,162,0,255,255,0,92,254,139,6,4,6,66,2,2,0,
+98,0,0,255,255,255,254,254,139,7,86,6,66,0,2,1,204,162,0,255,255,255,254,
+254,139,5,166,6,66,0,2,0,98,162,0,0,4,0,92,254,139,9,27,6,66,0,40,0,47,0,
+55,0,64,0,0,1,2,2,35,34,38,39,6,6,7,6,21,20,23,35,38,53,52,55,38,2,17,52,
+18,36,51,50,4,18,23,33,32,17,20,7,35,54,53,52,38,35,1,32,0,7,33,38,0,19,50,
+54,54,55,33,21,16,1,20,22,22,51,50,54,53,53,6,4,4,215,219,98,150,43,37,139,
+80,43,78,184,62,62,156,158,177,1,78,226,197,1,44,182,24,1,184,1,103,52,151,
+45,92,109,251,137,254,248,254,236,29,4,84,35,254,231,50,103,114,57,2,254,
+31,253,125,54,108,94,98,127,2,233,254,177,254,184,96,98,86,96,10,92,121,139,
+105,92,150,116,107,38,1,72,1,54,247,1,123,208,166,254,198,213,254,174,129,
+110,108,131,84,90,2,175,254,233,244,246,1,21,251,100,96,219,178,159,254,178,
+1,237,174,223,96,166,168,159,0,0,4,0,92,254,139,10,8,6,66,0,37,0,44,0,52,
+0,61,0,0,37,34,38,39,6,6,7,6,21,20,23,35,38,53,52,55,38,2,17,52,18,36,51,
+50,4,18,23,33,21,33,18,19,7,2,3,35,2,2,1,32,0,7,33,38,0,19,50,54,54,55,33,
+21,16,1,20,22,22,51,50,54,53,53,4,78,98,150,43,37,139,80,43,78,184,62,62,
+156,158,177,1,78,226,197,1,44,182,24,4,12,253,129,121,221,149,238,117,227,
+4,215,254,20,254,248,254,236,29,4,84,35,254,231,50,103,114,57,2,254,31,253,
+125,54,108,94,98,127,82,96,98,86,96,10,92,121,139,105,92,150,116,107,38,1,
+72,1,54,247,1,123,208,166,254,198,213,164,254,97,254,119,74,1,185,1,185,254,
+177,254,184,5,70,254,233,244,246,1,21,251,100,96,219,178,159,254,178,1,237,
+174,223,96,166,168,159,0,255,255,255,254,254,139,9,170,6,66,0,2,1,218,162,
+0,255,255,0,92,254,139,10,8,6,66,2,2,1,218,0,0,255,255,255,254,254,139,9,
+170,6,66,0,2,1,218,162,0,255,255,255,254,254,139,8,189,6,66,0,2,1,217,162,
+0,255,255,0,92,254,139,9,27,6,66,2,2,1,217,0,0,255,255,255,254,254,139,8,
+189,6,66,0,2,1,217,162,0,255,255,0,92,254,110,7,82,6,20,0,35,0,14,0,236,255,
+188,0,35,0,14,2,254,255,188,0,2,0,95,0,0,255,255,0,92,254,110,9,174,6,20,
+2,34,0,105,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,254,255,188,255,255,255,
+252,254,110,9,78,6,20,0,34,0,105,160,0,0,35,0,14,0,139,255,188,0,3,0,14,2,
+158,255,188,255,255,255,252,254,110,5,66,6,20,0,34,0,94,160,0,0,35,0,14,0,
+139,255,188,0,3,0,14,2,156,255,188,255,255,255,252,254,110,8,88,6,20,0,34,
+0,190,160,0,0,35,0,14,0,139,255,188,0,3,0,14,2,158,255,188,255,255,0,92,0,
+82,5,162,6,20,2,2,0,94,0,0,255,255,0,92,254,110,8,184,6,20,2,34,0,190,0,0,
+0,35,0,14,0,236,255,188,0,3,0,14,2,254,255,188,255,255,0,92,255,119,9,174,
+6,20,2,2,0,105,0,0,255,255,0,92,254,110,7,82,6,20,0,35,0,14,0,236,255,188,
+0,35,0,14,2,254,255,188,0,2,0,95,0,0,255,255,255,252,0,82,6,242,6,20,0,2,
+0,95,160,0,255,255,255,252,254,110,6,242,6,20,0,35,0,14,0,139,255,188,0,35,
+0,14,2,158,255,188,0,2,0,95,160,0,255,255,255,252,254,110,9,78,6,20,0,34,
+0,105,160,0,0,35,0,14,0,139,255,188,0,3,0,14,2,158,255,188,255,255,255,252,
+0,82,5,66,6,20,0,2,0,94,160,0,255,255,255,252,0,82,8,88,6,20,0,2,0,190,160,
+0,255,255,255,252,254,110,5,66,6,20,0,34,0,94,160,0,0,35,0,14,0,139,255,188,
+0,3,0,14,2,156,255,188,255,255,255,252,254,110,8,88,6,20,0,34,0,190,160,0,
+0,35,0,14,0,139,255,188,0,3,0,14,2,158,255,188,0,1,0,92,255,12,8,184,6,20,
+0,46,0,0,37,0,17,16,0,51,50,18,19,33,32,17,20,7,35,54,53,52,38,35,33,18,23,
+30,2,51,50,55,21,6,6,35,34,38,39,2,3,2,38,35,34,2,17,20,18,23,1,100,254,248,
+1,15,225,213,225,41,3,39,1,102,51,151,45,93,108,252,235,37,105,50,98,83,51,
+113,55,22,88,58,126,180,83,164,45,31,142,150,150,184,118,130,86,1,151,1,105,
+1,68,1,122,254,199,254,178,254,174,131,108,108,131,84,90,254,228,221,110,
+144,60,86,186,33,37,152,176,1,92,1,168,1,27,247,254,248,254,244,179,254,201,
+190,255,255,0,92,254,110,8,184,6,20,2,34,1,241,0,0,0,35,0,14,0,190,255,188,
+0,3,0,14,2,117,255,188,255,255,255,250,255,12,8,86,6,20,0,2,1,241,158,0,255,
+255,255,250,254,110,8,86,6,20,0,34,1,241,158,0,0,34,0,14,92,188,0,3,0,14,
+2,18,255,188,255,255,0,92,254,65,6,139,5,209,0,34,0,79,0,0,0,35,0,14,1,43,
+0,45,0,3,0,14,2,147,255,143,255,255,0,92,254,65,6,139,5,209,2,34,0,79,0,0,
+0,35,0,14,1,43,0,45,0,3,0,14,2,147,255,143,255,255,0,92,0,197,6,139,5,209,
+2,2,0,79,0,0,255,255,0,0,0,152,4,242,5,84,2,2,0,41,0,0,255,255,0,92,253,227,
+7,207,5,209,2,2,1,138,0,0,255,255,0,92,253,227,7,207,5,209,2,34,1,138,0,0,
+0,35,0,14,0,236,255,188,0,3,0,14,2,164,255,188,255,255,0,92,0,86,5,244,5,
+209,2,2,0,96,0,0,255,255,0,92,254,110,5,244,5,209,2,34,0,96,0,0,0,35,0,14,
+0,236,255,188,0,3,0,14,2,162,255,188,255,255,255,250,0,86,5,146,5,209,0,2,
+0,96,158,0,255,255,255,250,254,110,5,146,5,209,0,34,0,96,158,0,0,35,0,14,
+0,137,255,188,0,3,0,14,2,63,255,188,255,255,255,250,253,227,7,109,5,209,0,
+2,1,138,158,0,255,255,255,250,253,227,7,109,5,209,0,34,1,138,158,0,0,35,0,
+14,0,137,255,188,0,3,0,14,2,66,255,188,255,255,0,92,255,119,8,31,6,20,2,2,
+1,142,0,0,255,255,0,92,254,110,8,31,6,20,0,35,0,14,0,190,255,188,0,35,0,14,
+2,119,255,188,0,2,1,142,0,0,255,255,0,92,255,119,6,184,6,20,2,2,0,22,0,0,
+255,255,0,92,254,110,6,184,6,20,2,34,0,22,0,0,0,35,0,14,0,190,255,188,0,3,
+0,14,2,119,255,188,255,255,255,250,255,119,6,86,6,20,0,2,0,22,158,0,255,255,
+255,250,254,110,6,86,6,20,0,34,0,22,158,0,0,34,0,14,92,188,0,3,0,14,2,20,
+255,188,255,255,255,250,255,12,8,86,6,20,0,2,1,241,158,0,255,255,255,250,
+254,110,8,86,6,20,0,34,1,241,158,0,0,34,0,14,92,188,0,3,0,14,2,18,255,188,
+255,255,0,92,0,82,5,162,6,20,2,2,0,94,0,0,255,255,0,92,254,110,5,162,6,20,
+2,34,0,94,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,252,255,188,255,255,0,92,
+254,110,8,184,6,20,2,34,0,190,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,254,
+255,188,255,255,0,92,255,119,9,174,6,20,2,2,0,105,0,0,255,255,0,92,254,110,
+9,174,6,20,2,34,0,105,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,254,255,188,
+255,255,255,252,0,82,6,242,6,20,0,2,0,95,160,0,255,255,255,252,254,110,6,
+242,6,20,0,35,0,14,0,139,255,188,0,35,0,14,2,158,255,188,0,2,0,95,160,0,255,
+255,255,252,254,110,9,78,6,20,0,34,0,105,160,0,0,35,0,14,0,139,255,188,0,
+3,0,14,2,158,255,188,255,255,255,252,0,82,5,66,6,20,0,2,0,94,160,0,255,255,
+255,252,254,110,5,66,6,20,0,34,0,94,160,0,0,35,0,14,0,139,255,188,0,3,0,14,
+2,156,255,188,255,255,255,252,254,110,8,88,6,20,0,34,0,190,160,0,0,35,0,14,
+0,139,255,188,0,3,0,14,2,158,255,188,255,255,0,92,0,82,5,162,6,20,2,2,0,94,
+0,0,255,255,0,92,0,82,8,184,6,20,2,2,0,190,0,0,255,255,0,92,254,110,5,162,
+6,20,2,34,0,94,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,252,255,188,255,255,
+0,92,254,110,8,184,6,20,2,34,0,190,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,
+254,255,188,255,255,0,92,255,119,9,174,6,20,2,2,0,105,0,0,255,255,0,92,254,
+110,9,174,6,20,2,34,0,105,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,254,255,
+188,255,255,255,252,0,82,6,242,6,20,0,2,0,95,160,0,255,255,255,252,255,119,
+9,78,6,20,0,2,0,105,160,0,255,255,255,252,254,110,6,242,6,20,0,35,0,14,0,
+139,255,188,0,35,0,14,2,158,255,188,0,2,0,95,160,0,255,255,255,252,254,110,
+9,78,6,20,0,34,0,105,160,0,0,35,0,14,0,139,255,188,0,3,0,14,2,158,255,188,
+255,255,255,252,0,82,5,66,6,20,0,2,0,94,160,0,255,255,255,252,254,110,5,66,
+6,20,0,34,0,94,160,0,0,35,0,14,0,139,255,188,0,3,0,14,2,156,255,188,255,255,
+255,252,254,110,8,88,6,20,0,34,0,190,160,0,0,35,0,14,0,139,255,188,0,3,0,
+14,2,158,255,188,255,255,0,92,255,12,8,184,6,20,2,2,1,241,0,0,255,255,0,92,
+254,110,8,184,6,20,2,34,1,241,0,0,0,35,0,14,0,190,255,188,0,3,0,14,2,117,
+255,188,255,255,0,92,255,12,7,82,6,20,2,2,0,116,0,0,255,255,0,92,254,110,
+7,82,6,20,2,34,0,116,0,0,0,35,0,14,0,190,255,188,0,3,0,14,2,117,255,188,255,
+255,255,250,255,12,6,240,6,20,0,2,0,116,158,0,255,255,255,250,254,110,6,240,
+6,20,0,34,0,116,158,0,0,34,0,14,92,188,0,3,0,14,2,18,255,188,255,255,255,
+250,255,12,8,86,6,20,0,2,1,241,158,0,255,255,255,250,254,110,8,86,6,20,0,
+34,1,241,158,0,0,34,0,14,92,188,0,3,0,14,2,18,255,188,0,1,0,92,255,12,4,102,
+3,141,0,17,0,0,5,50,55,21,6,6,35,34,38,39,2,3,33,21,33,22,18,22,2,248,110,
+60,23,90,57,130,180,79,202,77,4,10,252,187,61,193,138,74,86,186,33,37,160,
+168,1,161,1,152,164,214,254,73,166,0,255,255,0,92,0,86,4,4,5,209,2,2,0,107,
+0,0,255,255,255,252,0,86,3,164,5,209,0,2,0,107,160,0,0,1,0,20,254,139,8,88,
+5,57,0,41,0,0,1,22,18,23,1,2,2,17,35,34,6,6,7,3,35,3,38,38,35,34,7,53,54,
+51,50,22,23,23,51,54,33,51,21,20,18,23,55,2,17,53,33,21,6,76,4,115,114,253,
+217,151,135,97,116,112,56,9,20,135,53,11,73,84,93,129,144,121,151,126,7,6,
+9,68,1,1,252,95,118,254,172,2,168,2,233,229,254,92,213,255,0,1,23,2,33,1,
+38,51,121,124,254,215,2,231,154,129,52,150,61,198,228,172,170,164,248,254,
+91,223,112,1,84,1,189,159,164,0,0,1,0,92,255,16,6,231,6,86,0,52,0,0,1,50,
+23,55,38,38,35,34,6,2,21,20,18,22,51,50,54,55,23,6,35,34,0,2,17,52,18,36,
+51,50,18,19,23,51,54,33,51,21,35,34,6,6,7,3,35,3,38,38,35,34,7,53,54,3,215,
+53,39,4,39,143,121,152,240,130,141,243,144,66,106,27,135,113,221,195,254,
+195,178,177,1,61,190,236,243,13,6,8,68,1,2,159,157,115,113,56,9,21,135,49,
+10,78,84,94,127,145,4,211,27,4,136,116,173,254,196,209,228,254,122,220,68,
+59,84,211,1,2,1,209,1,27,241,1,136,223,254,156,254,155,170,170,164,50,117,
+129,254,215,2,163,138,110,51,150,61,0,0,1,255,254,255,16,7,240,6,86,0,61,
+0,0,1,50,23,55,38,38,35,34,6,2,21,20,18,22,51,50,54,55,23,6,35,34,0,2,17,
+52,18,36,51,50,18,19,23,51,54,33,51,32,17,20,7,35,54,53,52,38,35,35,34,6,
+6,7,3,35,3,38,38,35,34,7,53,54,3,121,53,39,4,39,143,121,153,239,130,141,243,
+144,66,106,27,135,113,221,195,254,193,176,175,1,64,189,236,243,13,6,8,68,
+1,1,160,1,103,52,151,45,92,109,157,115,113,56,9,21,135,49,10,78,84,96,125,
+143,4,211,27,4,136,116,173,254,196,209,228,254,122,220,68,59,84,211,1,4,1,
+208,1,26,242,1,134,224,254,156,254,155,170,170,254,174,129,110,108,131,84,
+90,50,117,129,254,215,2,163,138,110,51,150,61,0,1,0,20,254,139,8,88,6,242,
+0,57,0,0,37,3,38,38,35,34,7,53,54,51,50,23,54,55,35,34,38,39,53,22,22,51,
+51,21,6,6,7,22,23,23,51,54,33,51,21,20,18,23,55,2,17,53,33,21,33,22,18,23,
+1,2,2,17,35,34,6,6,7,3,1,207,53,11,73,84,93,129,144,121,69,56,37,59,57,174,
+148,47,52,156,161,245,71,82,11,33,6,6,9,68,1,1,252,95,118,254,172,2,168,253,
+244,4,115,114,253,217,151,135,97,116,112,56,9,20,152,2,231,154,129,52,150,
+61,22,135,90,37,41,160,38,36,135,105,188,102,95,168,172,170,164,248,254,91,
+223,112,1,84,1,189,159,164,229,254,92,213,255,0,1,23,2,33,1,38,51,121,124,
+254,215,0,255,255,0,20,254,139,8,88,6,242,0,2,2,47,0,0,0,1,254,201,254,139,
+6,174,6,10,0,39,0,0,17,53,51,54,55,35,34,38,39,53,22,22,51,51,21,6,6,7,33,
+21,20,18,23,55,2,17,53,33,21,33,22,18,23,1,2,2,17,33,3,35,33,9,85,70,171,
+147,50,59,153,156,246,59,64,4,2,47,95,118,254,172,2,168,253,244,4,115,114,
+253,217,151,135,254,143,39,135,2,233,164,217,183,34,43,160,41,32,136,110,
+205,113,164,248,254,91,223,112,1,84,1,189,159,164,229,254,92,213,255,0,1,
+23,2,33,1,38,253,220,0,255,255,254,201,254,139,6,174,6,10,0,2,2,49,0,0,0,
+1,0,92,255,12,6,41,3,141,0,28,0,0,5,34,38,39,35,34,6,7,53,54,54,51,51,52,
+55,33,55,33,21,33,6,21,20,22,51,50,55,21,6,4,227,153,189,24,72,171,215,95,
+73,197,211,64,57,252,182,37,5,168,254,22,61,129,102,106,62,52,244,199,174,
+38,58,174,47,39,244,208,164,164,236,200,205,178,86,186,70,0,255,255,0,92,
+255,12,6,41,3,141,0,2,2,51,0,0,0,1,0,0,255,12,4,221,3,141,0,28,0,0,5,34,38,
+39,35,34,6,7,53,54,54,51,51,52,55,33,53,33,21,33,6,21,20,22,51,50,55,21,6,
+3,152,154,188,25,72,171,215,95,73,197,211,64,57,253,166,4,221,254,23,62,129,
+103,104,64,54,244,199,174,38,58,174,47,39,244,208,164,164,232,204,205,178,
+86,186,70,0,1,0,0,255,12,6,68,3,141,0,37,0,0,5,34,38,39,35,34,6,7,53,54,54,
+51,51,52,55,33,53,33,32,17,20,7,35,54,53,52,38,35,33,6,21,20,22,51,50,55,
+21,6,3,152,154,188,25,72,171,215,95,73,197,211,64,57,253,166,4,221,1,103,
+52,151,45,92,109,254,23,62,129,103,104,64,54,244,199,174,38,58,174,47,39,
+244,208,164,254,174,129,110,108,131,84,90,232,204,205,178,86,186,70,0,0,1,
+0,92,0,72,5,244,5,209,0,27,0,0,1,33,3,35,3,46,2,35,34,6,21,20,18,23,7,38,
+39,7,35,17,16,18,51,50,18,19,33,5,244,254,82,39,135,39,19,70,125,106,141,
+166,181,192,127,172,84,17,135,253,216,209,223,37,1,238,2,233,253,220,2,36,
+232,235,107,225,236,139,254,184,207,112,191,177,243,2,149,1,36,1,83,254,229,
+254,215,0,255,255,0,0,0,72,5,152,5,209,0,2,2,55,164,0,0,1,0,92,253,227,7,
+207,5,209,0,51,0,0,1,50,22,21,20,6,7,14,2,21,20,23,35,38,53,52,54,55,62,2,
+53,52,38,35,33,3,35,3,46,2,35,34,6,21,20,18,23,7,38,39,7,35,17,16,18,51,50,
+18,19,5,246,235,238,117,156,55,59,23,43,168,39,88,107,86,96,37,151,164,254,
+82,39,135,39,19,70,125,106,141,166,181,192,127,172,84,17,135,253,216,209,
+223,37,3,141,211,196,113,251,201,71,104,81,64,79,79,68,90,98,200,142,111,
+156,111,67,123,120,253,220,2,36,232,235,107,225,236,139,254,184,207,112,191,
+177,243,2,149,1,36,1,83,254,229,254,215,255,255,0,0,253,227,7,115,5,209,0,
+2,2,57,164,0,255,255,0,92,253,227,7,207,5,209,2,2,2,57,0,0,255,255,0,92,0,
+72,5,244,5,209,2,2,2,55,0,0,255,255,0,0,0,72,5,152,5,209,0,2,2,55,164,0,255,
+255,0,0,253,227,7,115,5,209,0,2,2,57,164,0,0,1,0,92,255,119,6,184,6,20,0,
+30,0,0,19,16,0,51,50,18,19,33,21,33,18,1,7,38,2,39,46,2,35,34,2,17,20,18,
+23,7,38,39,7,35,92,1,12,228,215,227,41,2,137,253,140,75,1,0,149,148,182,29,
+25,78,122,102,150,184,181,192,127,172,84,17,135,3,90,1,64,1,122,254,199,254,
+178,164,254,108,254,108,74,241,2,0,240,205,222,103,254,250,254,246,139,254,
+184,207,112,191,177,243,0,1,0,92,255,119,8,31,6,20,0,39,0,0,19,16,0,51,50,
+18,19,33,32,17,20,7,35,54,53,52,38,35,33,18,1,7,38,2,39,46,2,35,34,2,17,20,
+18,23,7,38,39,7,35,92,1,12,228,215,227,41,2,137,1,103,51,152,45,92,109,253,
+140,75,1,0,149,148,182,29,25,78,122,102,150,184,181,192,127,172,84,17,135,
+3,90,1,64,1,122,254,199,254,178,254,174,126,113,108,131,84,90,254,108,254,
+108,74,241,2,0,240,205,222,103,254,250,254,246,139,254,184,207,112,191,177,
+243,0,255,255,0,0,255,119,6,92,6,20,0,2,2,63,164,0,255,255,0,0,255,119,7,
+195,6,20,0,2,2,64,164,0,0,2,0,92,0,72,5,162,6,20,0,32,0,42,0,0,19,52,18,36,
+51,50,4,18,17,20,6,6,35,34,38,53,52,54,55,33,2,33,34,0,21,20,18,23,7,38,39,
+7,35,1,52,39,33,6,21,16,51,50,54,92,161,1,41,198,218,1,53,167,99,174,108,
+178,209,43,35,1,249,86,254,89,227,254,245,166,166,127,145,70,17,135,4,164,
+4,254,104,32,213,102,129,3,68,221,1,71,172,209,254,87,254,211,158,248,133,
+242,239,92,189,65,1,221,254,233,249,158,254,182,206,92,183,138,237,1,209,
+64,60,68,114,254,201,184,0,2,0,92,0,72,7,82,6,20,0,36,0,46,0,0,19,52,18,36,
+51,32,0,19,33,21,33,22,21,20,6,6,35,34,38,53,52,54,55,33,2,33,34,0,21,20,
+18,23,7,38,39,7,35,1,52,39,33,6,21,16,51,50,54,92,161,1,41,198,1,21,1,84,
+54,1,199,254,76,4,99,174,108,178,209,43,35,1,249,86,254,89,227,254,245,166,
+166,127,145,70,17,135,4,164,4,254,104,32,213,102,129,3,68,221,1,71,172,254,
+181,254,196,164,60,64,158,248,133,242,239,92,189,65,1,221,254,233,249,158,
+254,182,206,92,183,138,237,1,209,64,60,68,114,254,201,184,255,255,0,0,0,72,
+6,246,6,20,0,2,2,68,164,0,255,255,0,0,0,72,5,70,6,20,0,2,2,67,164,0,255,255,
+0,92,0,72,5,162,6,20,2,2,2,67,0,0,255,255,0,92,0,72,7,82,6,20,2,2,2,68,0,
+0,255,255,0,0,0,72,6,246,6,20,0,2,2,68,164,0,255,255,0,0,0,72,5,70,6,20,0,
+2,2,67,164,0,255,255,0,92,0,72,5,162,6,20,2,2,2,67,0,0,0,2,0,92,0,72,8,184,
+6,20,0,45,0,55,0,0,1,22,21,20,6,6,35,34,38,53,52,54,55,33,2,33,34,0,21,20,
+18,23,7,38,39,7,35,17,52,18,36,51,32,0,19,33,32,17,20,7,35,54,53,52,38,35,
+5,52,39,33,6,21,16,51,50,54,5,158,4,99,174,108,178,209,43,35,1,249,86,254,
+89,227,254,245,166,166,127,145,70,17,135,161,1,41,198,1,21,1,84,54,1,199,
+1,102,51,151,45,93,108,253,174,4,254,104,32,213,102,129,2,233,60,64,158,248,
+133,242,239,92,189,65,1,221,254,233,249,158,254,182,206,92,183,138,237,2,
+168,221,1,71,172,254,181,254,196,254,174,131,108,108,131,84,90,124,64,60,
+68,114,254,201,184,0,255,255,0,0,0,72,8,92,6,20,0,2,2,76,164,0,255,255,0,
+92,0,72,8,184,6,20,2,2,2,76,0,0,255,255,0,0,0,72,8,92,6,20,0,2,2,76,164,0,
+255,255,0,0,0,72,6,246,6,20,0,2,2,68,164,0,255,255,0,0,0,72,5,70,6,20,0,2,
+2,67,164,0,255,255,0,92,0,72,5,162,6,20,2,2,2,67,0,0,255,255,0,0,0,72,5,70,
+6,20,0,2,2,67,164,0,255,255,0,0,0,72,6,246,6,20,0,2,2,68,164,0,0,2,0,92,255,
+119,9,166,6,20,0,42,0,52,0,0,1,18,19,7,2,3,35,22,21,20,6,6,35,34,38,53,52,
+54,55,33,2,33,34,0,21,20,18,23,7,38,39,7,35,17,52,18,36,51,32,0,19,33,21,
+5,52,39,33,6,21,16,51,50,54,7,39,117,225,150,238,116,231,4,99,174,108,178,
+209,43,35,1,249,86,254,89,227,254,245,166,166,127,145,70,17,135,161,1,41,
+198,1,21,1,84,54,4,27,251,90,4,254,104,32,213,102,129,2,233,254,104,254,112,
+74,1,188,1,182,60,64,158,248,133,242,239,92,189,65,1,221,254,233,249,158,
+254,182,206,92,183,138,237,2,168,221,1,71,172,254,181,254,196,164,124,64,
+60,68,114,254,201,184,0,255,255,0,0,255,119,9,74,6,20,0,2,2,85,164,0,255,
+255,0,92,255,119,9,166,6,20,2,2,2,85,0,0,255,255,0,0,255,119,9,74,6,20,0,
+2,2,85,164,0,0,1,0,92,255,12,7,82,6,20,0,40,0,0,55,17,16,0,51,50,18,19,33,
+21,33,18,23,30,2,51,50,55,21,6,6,35,34,38,39,2,3,2,38,35,34,2,17,20,18,23,
+7,38,39,7,92,1,12,228,213,225,41,3,39,252,235,37,105,50,98,83,51,113,55,22,
+88,58,126,180,83,164,45,31,142,150,150,184,181,192,127,172,84,17,197,2,149,
+1,64,1,122,254,199,254,178,164,254,228,221,110,144,60,86,186,33,37,152,176,
+1,92,1,168,1,27,247,254,250,254,246,139,254,184,207,112,191,177,243,0,255,
+255,0,0,255,12,6,246,6,20,0,2,2,89,164,0,255,255,0,0,255,12,8,92,6,20,0,2,
+2,92,164,0,0,1,0,92,255,12,8,184,6,20,0,49,0,0,55,17,16,0,51,50,18,19,33,
+32,17,20,7,35,54,53,52,38,35,33,18,23,30,2,51,50,55,21,6,6,35,34,38,39,2,
+3,2,38,35,34,2,17,20,18,23,7,38,39,7,92,1,12,228,213,225,41,3,39,1,102,51,
+151,45,93,108,252,235,37,105,50,98,83,51,113,55,22,88,58,126,180,83,164,45,
+31,142,150,150,184,181,192,127,172,84,17,197,2,149,1,64,1,122,254,199,254,
+178,254,174,131,108,108,131,84,90,254,228,221,110,144,60,86,186,33,37,152,
+176,1,92,1,168,1,27,247,254,250,254,246,139,254,184,207,112,191,177,243,255,
+255,255,252,255,119,9,70,6,20,0,2,1,188,160,0,255,255,0,92,255,119,9,166,
+6,20,2,2,1,188,0,0,255,255,255,252,255,119,9,70,6,20,0,2,1,188,160,0,0,1,
+0,92,255,12,7,82,6,20,0,40,0,0,37,0,17,16,0,51,50,18,19,33,21,33,18,23,30,
+2,51,50,55,21,6,6,35,34,38,39,2,3,2,38,35,34,6,7,33,21,33,22,18,23,1,100,
+254,248,1,15,225,213,225,41,3,39,252,235,37,105,50,98,83,51,113,55,22,88,
+58,126,180,83,164,45,31,142,150,142,182,10,1,74,254,186,14,109,121,86,1,151,
+1,105,1,68,1,122,254,199,254,178,164,254,228,221,110,144,60,86,186,33,37,
+152,176,1,92,1,168,1,27,247,235,242,164,127,254,240,172,0,255,255,255,250,
+255,12,6,240,6,20,0,2,2,96,158,0,0,1,0,92,255,12,8,184,6,20,0,49,0,0,37,0,
+17,16,0,51,50,18,19,33,32,17,20,7,35,54,53,52,38,35,33,18,23,30,2,51,50,55,
+21,6,6,35,34,38,39,2,3,2,38,35,34,6,7,33,21,33,22,18,23,1,100,254,248,1,15,
+225,213,225,41,3,39,1,102,51,151,45,93,108,252,235,37,105,50,98,83,51,113,
+55,22,88,58,126,180,83,164,45,31,142,150,142,182,10,1,74,254,186,14,109,121,
+86,1,151,1,105,1,68,1,122,254,199,254,178,254,174,131,108,108,131,84,90,254,
+228,221,110,144,60,86,186,33,37,152,176,1,92,1,168,1,27,247,235,242,164,127,
+254,240,172,255,255,255,250,255,12,8,86,6,20,0,2,2,98,158,0,0,2,0,92,254,
+162,6,199,3,141,0,33,0,45,0,0,37,54,54,51,50,22,21,20,6,35,34,2,39,35,34,
+6,7,53,54,54,51,51,52,55,33,55,33,21,33,6,6,21,20,23,23,22,22,51,50,54,53,
+52,38,35,34,6,4,8,29,98,60,122,146,158,131,132,174,13,66,171,215,95,73,197,
+211,64,57,252,182,37,6,70,253,120,34,35,8,23,10,86,61,66,71,71,74,51,82,127,
+35,43,154,117,129,155,1,2,221,38,58,174,47,39,244,208,164,164,114,228,147,
+69,58,145,76,111,78,59,56,86,51,0,0,2,0,0,254,162,5,123,3,141,0,33,0,45,0,
+0,37,54,54,51,50,22,21,20,6,35,34,2,39,35,34,6,7,53,54,54,51,51,52,55,33,
+53,33,21,33,6,6,21,20,23,23,22,22,51,50,54,53,52,38,35,34,6,2,188,29,98,60,
+123,145,158,131,132,174,13,66,171,215,95,73,197,211,64,57,253,166,5,123,253,
+121,35,35,8,23,10,86,61,66,72,72,74,51,82,127,35,43,154,117,129,155,1,2,221,
+38,58,174,47,39,244,208,164,164,114,228,147,69,58,145,76,111,78,59,56,86,
+51,0,2,0,0,254,162,6,225,3,141,0,42,0,54,0,0,1,6,6,21,20,23,23,54,54,51,50,
+22,21,20,6,35,34,2,39,35,34,6,7,53,54,54,51,51,52,55,33,53,33,32,17,20,7,
+35,54,53,52,38,35,1,22,22,51,50,54,53,52,38,35,34,6,2,244,35,35,8,6,29,98,
+60,123,145,158,131,132,174,13,66,171,215,95,73,197,211,64,57,253,166,5,123,
+1,102,51,151,45,93,108,253,82,10,86,61,66,72,72,74,51,82,2,233,114,228,147,
+69,58,2,35,43,154,117,129,155,1,2,221,38,58,174,47,39,244,208,164,254,174,
+131,108,108,131,84,90,253,7,76,111,78,59,56,86,51,0,1,0,92,0,86,5,74,5,209,
+0,21,0,0,37,0,17,52,18,54,51,50,18,19,33,21,33,2,38,35,34,6,21,20,18,23,1,
+100,254,248,114,212,141,195,227,35,1,82,254,35,22,139,157,141,164,125,123,
+86,1,139,1,97,198,1,42,159,254,240,254,204,164,1,69,249,240,245,180,254,203,
+171,0,1,0,92,0,143,3,156,5,2,0,18,0,0,37,2,17,52,54,51,50,18,19,35,38,38,
+35,34,6,21,20,18,23,1,33,197,224,190,190,215,13,152,12,144,110,123,129,86,
+100,143,1,101,1,63,212,251,254,231,255,0,187,180,156,137,150,254,242,170,
+255,255,0,92,0,86,4,10,5,209,0,2,1,157,0,0,255,255,255,252,0,86,3,170,5,209,
+0,2,1,157,160,0,0,1,0,92,0,18,7,139,5,209,0,37,0,0,37,0,17,52,18,54,51,50,
+18,19,33,21,33,21,16,33,51,50,23,21,38,35,35,34,38,53,53,16,33,34,6,7,33,
+21,33,22,18,23,1,100,254,248,114,215,140,203,244,26,3,129,252,133,1,25,84,
+150,65,61,154,84,213,229,254,194,133,164,10,1,74,254,186,14,109,121,86,1,
+151,1,105,192,1,33,154,254,205,254,239,164,206,254,217,56,170,56,229,236,
+227,2,41,203,207,164,127,254,240,172,255,255,255,250,0,18,5,242,5,209,0,2,
+2,109,158,0,0,1,0,92,0,18,6,84,5,209,0,37,0,0,37,0,17,52,18,54,51,50,18,19,
+33,21,33,21,16,33,51,50,23,21,38,35,35,34,38,53,53,16,33,34,6,7,33,21,33,
+22,18,23,1,100,254,248,114,215,140,203,244,26,2,74,253,188,1,25,84,150,65,
+61,154,84,213,229,254,194,133,164,10,1,74,254,186,14,109,121,86,1,151,1,105,
+192,1,33,154,254,205,254,239,164,206,254,217,56,170,56,229,236,227,2,41,203,
+207,164,127,254,240,172,255,255,255,250,0,18,7,41,5,209,0,2,2,107,158,0,0,
+1,0,92,0,18,8,6,5,209,0,39,0,0,37,38,35,33,32,17,17,16,33,34,6,7,33,21,33,
+22,18,23,7,0,17,52,18,54,51,50,18,17,17,20,51,51,17,33,21,33,17,51,50,23,
+6,207,62,153,254,223,254,152,254,194,133,164,10,1,74,254,186,14,109,121,146,
+254,248,114,215,140,225,254,199,68,2,235,253,182,60,150,65,18,56,1,127,1,
+53,2,41,203,207,164,127,254,240,172,88,1,151,1,105,192,1,33,154,254,134,254,
+167,254,203,213,2,153,164,254,11,56,0,1,0,92,0,18,9,109,5,209,0,48,0,0,37,
+38,35,33,32,17,17,16,33,34,6,7,33,21,33,22,18,23,7,0,17,52,18,54,51,50,18,
+17,17,20,51,51,17,33,32,17,20,7,35,54,53,52,38,35,33,17,51,50,23,6,207,62,
+153,254,223,254,152,254,194,133,164,10,1,74,254,186,14,109,121,146,254,248,
+114,215,140,225,254,199,68,2,235,1,103,52,151,45,92,109,253,182,60,150,65,
+18,56,1,127,1,53,2,41,203,207,164,127,254,240,172,88,1,151,1,105,192,1,33,
+154,254,134,254,167,254,203,213,2,153,254,174,129,110,108,131,84,90,254,11,
+56,0,255,255,255,250,0,18,7,164,5,209,0,2,2,111,158,0,255,255,255,250,0,18,
+9,11,5,209,0,2,2,112,158,0,0,2,0,92,0,82,5,162,7,160,0,36,0,46,0,0,1,2,33,
+34,4,7,33,21,33,18,19,7,38,2,53,52,18,36,55,38,39,55,22,23,4,0,17,20,6,6,
+35,34,38,53,52,54,55,1,52,39,33,6,21,16,51,50,54,4,233,86,254,89,203,254,
+246,23,1,27,254,231,22,169,150,100,107,149,1,20,183,55,102,145,114,81,1,15,
+1,32,99,174,108,178,209,43,35,2,16,4,254,104,32,213,102,129,3,141,1,221,245,
+232,164,254,226,254,203,64,188,1,132,174,206,1,63,181,12,126,190,82,209,199,
+47,254,35,254,113,158,248,133,242,239,92,189,65,254,224,64,60,68,114,254,
+201,184,0,2,0,92,0,82,7,82,7,160,0,41,0,51,0,0,1,2,33,34,4,7,33,21,33,18,
+19,7,38,2,53,52,18,36,55,38,39,55,22,23,22,0,19,33,21,33,22,21,20,6,6,35,
+34,38,53,52,54,55,1,52,39,33,6,21,16,51,50,54,4,233,86,254,89,203,254,246,
+23,1,27,254,231,22,169,150,100,107,149,1,20,183,55,102,145,114,81,207,1,26,
+47,1,199,254,76,4,99,174,108,178,209,43,35,2,16,4,254,104,32,213,102,129,
+3,141,1,221,245,232,164,254,226,254,203,64,188,1,132,174,206,1,63,181,12,
+126,190,82,209,199,37,254,199,254,227,164,60,64,158,248,133,242,239,92,189,
+65,254,224,64,60,68,114,254,201,184,0,255,255,255,252,0,82,6,242,7,160,0,
+2,2,116,160,0,255,255,255,252,0,82,5,66,7,160,0,2,2,115,160,0,0,2,0,92,0,
+82,5,162,6,20,0,32,0,42,0,0,1,2,33,34,4,7,33,21,33,18,19,7,38,2,53,52,18,
+36,51,50,4,18,17,20,6,6,35,34,38,53,52,54,55,1,52,39,33,6,21,16,51,50,54,
+4,233,86,254,89,203,254,246,23,1,27,254,231,22,169,150,100,107,164,1,43,193,
+218,1,53,167,99,174,108,178,209,43,35,2,16,4,254,104,32,213,102,129,3,141,
+1,221,245,232,164,254,226,254,203,64,188,1,132,174,214,1,72,178,209,254,87,
+254,211,158,248,133,242,239,92,189,65,254,224,64,60,68,114,254,201,184,0,
+0,2,0,92,0,82,7,82,6,20,0,36,0,46,0,0,1,2,33,34,4,7,33,21,33,18,19,7,38,2,
+53,52,18,36,51,32,0,19,33,21,33,22,21,20,6,6,35,34,38,53,52,54,55,1,52,39,
+33,6,21,16,51,50,54,4,233,86,254,89,203,254,246,23,1,27,254,231,22,169,150,
+100,107,164,1,43,193,1,21,1,84,54,1,199,254,76,4,99,174,108,178,209,43,35,
+2,16,4,254,104,32,213,102,129,3,141,1,221,245,232,164,254,226,254,203,64,
+188,1,132,174,214,1,72,178,254,181,254,196,164,60,64,158,248,133,242,239,
+92,189,65,254,224,64,60,68,114,254,201,184,0,255,255,255,252,0,82,6,242,6,
+20,0,2,2,120,160,0,255,255,255,252,0,82,5,66,6,20,0,2,2,119,160,0,255,255,
+0,20,254,80,6,135,5,57,0,35,0,208,1,233,0,0,0,2,0,91,0,0,255,255,0,20,254,
+80,6,135,5,57,0,35,0,208,1,233,0,0,0,2,0,91,0,0,255,255,0,92,0,86,4,4,5,209,
+2,2,0,107,0,0,255,255,0,0,254,80,4,201,3,141,0,34,0,208,72,0,0,2,0,60,0,0,
+255,255,255,250,0,86,5,145,7,154,2,2,0,201,0,0,0,1,0,92,0,18,6,84,5,209,0,
+34,0,0,37,0,17,52,18,54,51,50,18,19,33,21,33,21,16,33,51,50,23,21,38,35,35,
+34,38,53,53,16,33,34,6,21,20,18,23,1,100,254,248,114,215,140,203,244,26,2,
+74,253,188,1,25,84,150,65,61,154,84,213,229,254,194,141,166,118,130,86,1,
+151,1,105,192,1,33,154,254,205,254,239,164,206,254,217,56,170,56,229,236,
+227,2,41,229,236,179,254,201,190,0,1,0,92,0,18,7,139,5,209,0,34,0,0,37,0,
+17,52,18,54,51,50,18,19,33,21,33,21,16,33,51,50,23,21,38,35,35,34,38,53,53,
+16,33,34,6,21,20,18,23,1,100,254,248,114,215,140,203,244,26,3,129,252,133,
+1,25,84,150,65,61,154,84,213,229,254,194,141,166,118,130,86,1,151,1,105,192,
+1,33,154,254,205,254,239,164,206,254,217,56,170,56,229,236,227,2,41,229,236,
+179,254,201,190,255,255,255,250,0,18,7,41,5,209,0,2,2,129,158,0,255,255,255,
+250,0,18,5,242,5,209,0,2,2,128,158,0,0,1,0,92,0,18,8,6,5,209,0,36,0,0,37,
+38,35,33,32,17,17,16,33,34,6,21,20,18,23,7,0,17,52,18,54,51,50,18,17,17,20,
+51,51,17,33,21,33,17,51,50,23,6,207,62,153,254,223,254,152,254,194,141,166,
+118,130,146,254,248,114,215,140,225,254,199,68,2,235,253,182,60,150,65,18,
+56,1,127,1,53,2,41,229,236,179,254,201,190,88,1,151,1,105,192,1,33,154,254,
+134,254,167,254,203,213,2,153,164,254,11,56,255,255,255,250,0,18,7,164,5,
+209,0,2,2,132,158,0,255,255,255,250,0,18,9,11,5,209,0,2,2,135,158,0,0,1,0,
+92,0,18,9,109,5,209,0,45,0,0,37,51,50,23,21,38,35,33,32,17,17,16,33,34,6,
+21,20,18,23,7,0,17,52,18,54,51,50,18,17,17,20,51,51,17,33,32,17,20,7,35,54,
+53,52,38,35,33,5,188,60,150,65,62,153,254,223,254,152,254,194,141,166,118,
+130,146,254,248,114,215,140,225,254,199,68,2,235,1,103,52,151,45,92,109,253,
+182,244,56,170,56,1,127,1,53,2,41,229,236,179,254,201,190,88,1,151,1,105,
+192,1,33,154,254,134,254,167,254,203,213,2,153,254,174,129,110,108,131,84,
+90,0,2,0,92,0,82,5,162,7,160,0,34,0,44,0,0,37,38,2,53,52,18,36,55,38,39,55,
+22,23,4,0,17,20,6,6,35,34,38,53,52,54,55,33,2,33,34,0,17,20,18,23,1,52,39,
+33,6,21,16,51,50,54,1,43,100,107,149,1,20,183,55,102,145,114,81,1,15,1,32,
+103,185,114,186,221,43,35,2,34,86,254,89,228,254,246,92,103,3,63,4,254,63,
+32,233,111,141,86,188,1,132,174,206,1,63,181,12,126,190,82,209,199,47,254,
+35,254,113,160,247,132,242,239,92,189,65,1,221,254,214,254,253,141,254,166,
+192,1,215,64,60,71,111,254,201,184,0,0,2,0,92,0,82,7,82,7,160,0,39,0,49,0,
+0,37,38,2,53,52,18,36,55,38,39,55,22,23,22,0,19,33,21,33,22,21,20,6,6,35,
+34,38,53,52,54,55,33,2,33,34,0,17,20,18,23,1,52,39,33,6,21,16,51,50,54,1,
+43,100,107,149,1,20,183,55,102,145,114,81,207,1,26,47,1,199,254,76,4,103,
+185,114,186,221,43,35,2,34,86,254,89,228,254,246,92,103,3,63,4,254,63,32,
+233,111,141,86,188,1,132,174,206,1,63,181,12,126,190,82,209,199,37,254,199,
+254,227,164,60,64,160,247,132,242,239,92,189,65,1,221,254,214,254,253,141,
+254,166,192,1,215,64,60,71,111,254,201,184,255,255,255,252,0,82,6,242,7,160,
+0,2,2,137,160,0,255,255,255,252,0,82,5,66,7,160,0,2,2,136,160,0,255,255,0,
+92,0,82,5,162,6,20,2,2,0,94,0,0,255,255,0,92,0,82,7,82,6,20,2,2,0,95,0,0,
+255,255,255,252,0,82,6,242,6,20,0,2,0,95,160,0,255,255,255,252,0,82,5,66,
+6,20,0,2,0,94,160,0,0,2,0,0,255,10,4,160,3,141,0,24,0,36,0,0,17,33,21,33,
+20,6,7,7,22,22,21,20,6,35,34,38,53,52,54,55,55,54,54,53,33,1,52,38,35,34,
+6,21,20,22,51,50,54,4,160,254,84,103,114,119,59,72,157,113,121,160,98,111,
+229,97,63,253,170,1,152,72,55,60,69,71,58,55,72,3,141,164,157,199,59,64,33,
+124,80,119,156,159,112,110,137,60,123,51,137,102,253,54,59,72,76,57,58,73,
+73,0,0,2,0,92,255,10,5,236,3,141,0,24,0,36,0,0,19,33,21,33,20,6,7,7,22,22,
+21,20,6,35,34,38,53,52,54,55,55,54,54,53,33,1,52,38,35,34,6,21,20,22,51,50,
+54,129,5,107,254,83,102,115,118,59,72,157,114,120,160,98,111,229,96,64,252,
+186,2,135,71,56,59,70,72,57,56,71,3,141,164,157,199,59,64,33,124,80,119,156,
+161,110,110,137,60,123,51,137,102,253,54,59,72,76,57,58,73,73,0,2,0,0,255,
+10,6,6,3,141,0,33,0,45,0,0,17,33,32,17,20,7,35,54,53,52,38,35,33,20,6,7,7,
+22,22,21,20,6,35,34,38,53,52,54,55,55,54,54,53,33,1,52,38,35,34,6,21,20,22,
+51,50,54,4,160,1,102,51,152,45,92,108,254,84,103,114,119,59,72,157,113,121,
+160,98,111,229,97,63,253,170,1,152,72,55,60,69,71,58,55,72,3,141,254,174,
+131,108,104,135,84,90,157,199,59,64,33,124,80,119,156,159,112,110,137,60,
+123,51,137,102,253,54,59,72,76,57,58,73,73,0,1,0,92,0,197,4,47,5,209,0,21,
+0,0,1,34,6,21,20,18,23,33,53,51,38,53,52,18,54,51,50,18,19,7,38,38,2,84,141,
+164,111,122,254,80,147,110,115,213,139,211,242,22,162,18,158,5,39,240,245,
+167,254,216,174,163,235,239,199,1,44,156,254,182,254,211,20,252,229,0,0,1,
+0,92,0,197,4,41,5,209,0,22,0,0,19,38,53,52,18,54,51,50,18,19,35,46,2,35,34,
+6,21,20,18,23,33,53,238,109,115,213,139,226,228,15,152,14,68,127,108,141,
+164,111,122,254,80,1,104,244,230,199,1,44,156,254,148,254,132,222,242,110,
+240,245,167,254,216,174,163,0,255,255,255,215,0,197,3,164,5,209,0,3,2,148,
+255,123,0,0,0,1,255,215,253,227,4,154,5,209,0,38,0,0,19,38,53,16,0,33,32,
+0,17,20,6,2,7,6,6,21,20,23,35,38,53,52,54,55,62,2,53,52,2,35,34,6,21,20,18,
+23,33,53,104,108,1,58,1,16,1,21,1,63,69,154,130,97,73,43,168,38,96,129,118,
+127,56,237,199,195,229,106,127,254,80,1,104,244,230,1,47,1,96,254,142,254,
+188,144,238,254,248,163,121,156,92,79,79,74,84,124,203,158,148,215,198,132,
+248,1,20,240,245,163,254,221,183,163,0,1,0,55,0,197,5,244,5,209,0,27,0,0,
+19,38,53,52,18,54,51,50,18,19,33,21,33,3,35,3,46,2,35,34,6,21,20,18,23,33,
+53,203,111,114,215,140,209,223,37,1,238,254,82,39,135,39,19,70,125,106,141,
+166,107,126,254,80,1,104,253,241,192,1,33,154,254,229,254,215,164,253,220,
+2,36,232,235,107,229,236,167,254,210,188,163,0,255,255,255,213,0,197,5,146,
+5,209,0,2,2,151,158,0,255,255,255,213,253,227,7,109,5,209,0,2,2,154,158,0,
+0,1,0,55,253,227,7,207,5,209,0,51,0,0,19,38,53,52,18,54,51,50,18,19,33,50,
+22,21,20,6,7,14,2,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,33,3,35,3,46,
+2,35,34,6,21,20,18,23,33,53,203,111,114,215,140,209,223,37,1,240,235,238,
+117,156,55,59,23,43,168,39,88,107,86,96,37,151,164,254,82,39,135,39,19,70,
+125,106,141,166,107,126,254,80,1,104,253,241,192,1,33,154,254,229,254,215,
+211,196,113,251,201,71,104,81,64,79,79,68,90,98,200,142,111,156,111,67,123,
+120,253,220,2,36,232,235,107,229,236,167,254,210,188,163,0,0,2,0,55,0,82,
+5,162,6,20,0,31,0,41,0,0,19,38,53,52,18,36,51,50,4,18,17,20,6,6,35,34,38,
+53,52,54,55,33,2,33,34,0,17,20,18,23,33,53,1,52,39,33,6,21,16,51,50,54,201,
+109,163,1,43,194,218,1,53,167,103,185,114,186,221,43,35,2,34,86,254,89,231,
+254,249,111,122,254,80,4,201,4,254,63,32,233,111,141,1,104,244,230,214,1,
+74,178,209,254,87,254,211,160,247,132,242,239,92,189,65,1,221,254,216,255,
+0,167,254,216,174,163,1,5,64,60,71,111,254,201,184,0,0,2,0,55,0,82,7,82,6,
+20,0,35,0,45,0,0,19,38,53,52,18,36,51,32,0,19,33,21,33,22,21,20,6,6,35,34,
+38,53,52,54,55,33,2,33,34,0,17,20,18,23,33,53,1,52,39,33,6,21,16,51,50,54,
+201,109,163,1,43,194,1,21,1,84,54,1,199,254,76,4,103,185,114,186,221,43,35,
+2,34,86,254,89,231,254,249,111,122,254,80,4,201,4,254,63,32,233,111,141,1,
+104,244,230,214,1,74,178,254,181,254,196,164,60,64,160,247,132,242,239,92,
+189,65,1,221,254,216,255,0,167,254,216,174,163,1,5,64,60,71,111,254,201,184,
+0,255,255,255,215,0,82,6,242,6,20,0,2,2,156,160,0,255,255,255,215,0,82,5,
+66,6,20,0,2,2,155,160,0,0,2,0,55,255,8,5,162,6,20,0,35,0,45,0,0,19,38,53,
+52,18,36,51,50,4,18,17,20,2,7,22,23,7,38,39,34,38,53,52,54,55,33,2,33,34,
+0,17,20,18,23,33,53,1,52,39,33,6,21,16,51,50,54,201,109,163,1,43,194,218,
+1,53,167,133,107,72,74,146,96,68,184,221,43,35,2,34,86,254,89,231,254,249,
+111,122,254,80,4,201,4,254,63,32,233,111,141,1,104,244,230,214,1,74,178,209,
+254,87,254,211,189,255,0,55,157,130,82,176,154,244,237,92,189,65,1,221,254,
+216,255,0,167,254,216,174,163,1,5,64,60,71,111,254,201,184,0,0,2,0,55,255,
+8,7,82,6,20,0,39,0,49,0,0,19,38,53,52,18,36,51,32,0,19,33,21,33,22,21,20,
+2,7,22,23,7,38,39,34,38,53,52,54,55,33,2,33,34,0,17,20,18,23,33,53,1,52,39,
+33,6,21,16,51,50,54,201,109,163,1,43,194,1,21,1,84,54,1,199,254,76,4,133,
+107,72,74,146,96,68,184,221,43,35,2,34,86,254,89,231,254,249,111,122,254,
+80,4,201,4,254,63,32,233,111,141,1,104,244,230,214,1,74,178,254,181,254,196,
+164,60,64,189,255,0,55,157,130,82,176,154,244,237,92,189,65,1,221,254,216,
+255,0,167,254,216,174,163,1,5,64,60,71,111,254,201,184,0,255,255,255,215,
+255,8,5,66,6,20,0,2,2,159,160,0,255,255,255,215,255,8,6,242,6,20,0,2,2,160,
+160,0,0,1,255,215,0,86,4,6,5,137,0,25,0,0,37,38,39,6,7,39,54,55,38,53,16,
+18,51,50,18,19,7,38,38,35,34,6,21,20,18,23,1,100,82,61,56,55,143,88,94,49,
+253,214,206,246,19,164,16,156,135,141,164,124,126,86,123,125,83,93,88,139,
+131,162,156,1,14,1,57,254,187,254,211,21,229,248,203,210,169,254,195,174,
+0,1,255,215,0,86,4,4,5,137,0,25,0,0,37,38,39,6,7,39,54,55,38,53,16,18,51,
+50,18,19,35,2,38,35,34,6,21,20,18,23,1,100,82,61,56,55,143,88,94,49,253,214,
+231,223,15,151,22,140,156,141,164,125,123,86,123,125,83,93,88,139,131,162,
+156,1,14,1,57,254,182,254,170,1,29,217,203,210,180,254,203,171,255,255,255,
+119,0,86,3,164,5,137,0,2,2,164,160,0,255,255,255,119,0,86,3,166,5,137,0,2,
+2,163,160,0,0,1,255,215,0,86,5,244,5,209,0,32,0,0,37,38,39,6,7,39,54,55,38,
+53,52,18,54,51,50,18,19,33,21,33,3,35,3,46,2,35,34,6,21,20,18,23,1,100,85,
+56,63,50,143,90,94,51,114,215,140,209,223,37,1,238,254,82,39,135,39,19,70,
+125,106,141,166,118,130,86,131,119,93,85,88,142,130,172,164,192,1,33,154,
+254,229,254,215,164,253,220,2,36,232,235,107,229,236,179,254,201,190,0,255,
+255,255,117,0,86,5,146,5,209,0,2,2,167,158,0,255,255,255,117,253,227,7,109,
+5,209,0,2,2,170,158,0,0,1,255,215,253,227,7,207,5,209,0,56,0,0,37,38,39,6,
+7,39,54,55,38,53,52,18,54,51,50,18,19,33,50,22,21,20,6,7,14,2,21,20,23,35,
+38,53,52,54,55,62,2,53,52,38,35,33,3,35,3,46,2,35,34,6,21,20,18,23,1,100,
+85,56,63,50,143,90,94,51,114,215,140,209,223,37,1,240,235,238,117,156,55,
+59,23,43,168,39,88,107,86,96,37,151,164,254,82,39,135,39,19,70,125,106,141,
+166,118,130,86,131,119,93,85,88,142,130,172,164,192,1,33,154,254,229,254,
+215,211,196,113,251,201,71,104,81,64,79,79,68,90,98,200,142,111,156,111,67,
+123,120,253,220,2,36,232,235,107,229,236,179,254,201,190,0,0,2,255,215,0,
+82,5,162,6,20,0,36,0,46,0,0,37,38,39,6,7,39,54,55,38,53,52,18,36,51,50,4,
+18,17,20,6,6,35,34,38,53,52,54,55,33,2,33,34,0,17,20,18,23,1,52,39,33,6,21,
+16,51,50,54,1,43,59,43,30,65,143,84,92,43,164,1,43,193,218,1,53,167,103,185,
+114,186,221,43,35,2,34,86,254,89,228,254,246,92,103,3,63,4,254,63,32,233,
+111,141,86,113,110,44,107,88,134,126,172,158,214,1,72,178,209,254,87,254,
+211,160,247,132,242,239,92,189,65,1,221,254,214,254,253,141,254,166,192,1,
+215,64,60,71,111,254,201,184,0,0,2,255,215,0,82,7,82,6,20,0,40,0,50,0,0,37,
+38,39,6,7,39,54,55,38,53,52,18,36,51,32,0,19,33,21,33,22,21,20,6,6,35,34,
+38,53,52,54,55,33,2,33,34,0,17,20,18,23,1,52,39,33,6,21,16,51,50,54,1,43,
+59,43,30,65,143,84,92,43,164,1,43,193,1,21,1,84,54,1,199,254,76,4,103,185,
+114,186,221,43,35,2,34,86,254,89,228,254,246,92,103,3,63,4,254,63,32,233,
+111,141,86,113,110,44,107,88,134,126,172,158,214,1,72,178,254,181,254,196,
+164,60,64,160,247,132,242,239,92,189,65,1,221,254,214,254,253,141,254,166,
+192,1,215,64,60,71,111,254,201,184,0,255,255,255,119,0,82,6,242,6,20,0,2,
+2,172,160,0,255,255,255,119,0,82,5,66,6,20,0,2,2,171,160,0,0,2,255,215,255,
+8,5,162,6,20,0,40,0,50,0,0,37,38,39,6,7,39,54,55,38,53,52,18,36,51,50,4,18,
+17,20,2,7,22,23,7,38,39,38,38,53,52,54,55,33,2,33,34,0,17,20,18,23,1,52,39,
+33,6,21,16,51,50,54,1,43,59,43,30,65,143,84,92,43,164,1,43,193,218,1,53,167,
+135,109,63,82,145,96,68,184,217,43,35,2,34,86,254,89,228,254,246,92,103,3,
+63,4,254,63,32,233,111,141,86,113,110,44,107,88,134,126,172,158,214,1,72,
+178,209,254,87,254,211,191,254,254,53,137,148,82,176,154,2,242,237,92,189,
+65,1,221,254,214,254,253,141,254,166,192,1,215,64,60,71,111,254,201,184,0,
+2,255,215,255,8,7,82,6,20,0,44,0,54,0,0,37,38,39,6,7,39,54,55,38,53,52,18,
+36,51,32,0,19,33,21,33,22,21,20,2,7,22,23,7,38,39,34,38,53,52,54,55,33,2,
+33,34,0,17,20,18,23,1,52,39,33,6,21,16,51,50,54,1,43,59,43,30,65,143,84,92,
+43,164,1,43,193,1,21,1,84,54,1,199,254,76,4,133,107,72,74,146,96,68,184,221,
+43,35,2,34,86,254,89,228,254,246,92,103,3,63,4,254,63,32,233,111,141,86,113,
+110,44,107,88,134,126,172,158,214,1,72,178,254,181,254,196,164,60,64,189,
+255,0,55,157,130,82,176,154,244,237,92,189,65,1,221,254,214,254,253,141,254,
+166,192,1,215,64,60,71,111,254,201,184,0,255,255,255,119,255,8,6,242,6,20,
+0,2,2,176,160,0,255,255,255,119,255,8,5,66,6,20,0,2,2,175,160,0,0,1,0,92,
+254,139,8,113,3,141,0,32,0,0,19,53,33,21,20,18,23,55,2,17,53,33,32,17,20,
+7,35,54,53,52,38,35,33,22,18,23,1,2,2,17,33,3,35,92,2,223,95,118,254,172,
+2,168,1,103,52,151,45,92,109,253,244,4,115,114,253,218,152,135,254,143,39,
+135,2,233,164,164,248,254,91,223,112,1,84,1,189,159,254,174,129,110,108,131,
+84,90,229,254,92,213,255,0,1,23,2,33,1,38,253,220,0,1,0,0,254,139,6,174,3,
+141,0,23,0,0,1,22,18,23,1,2,2,17,33,3,35,3,53,33,21,20,18,23,55,2,17,53,33,
+21,4,162,4,115,114,253,217,151,135,254,143,39,135,39,2,223,95,118,254,172,
+2,168,2,233,229,254,92,213,255,0,1,23,2,33,1,38,253,220,2,36,164,164,248,
+254,91,223,112,1,84,1,189,159,164,0,255,255,0,0,254,139,8,21,3,141,0,2,2,
+179,164,0,255,255,0,20,254,139,8,88,5,57,0,2,2,44,0,0,0,2,0,92,255,86,5,141,
+6,66,0,34,0,42,0,0,1,34,2,7,33,22,22,21,20,6,6,35,34,2,17,52,18,36,51,50,
+4,18,17,20,2,7,33,21,33,53,54,18,53,16,0,1,50,54,53,52,39,33,18,2,225,224,
+255,4,2,111,19,28,95,169,105,235,228,155,1,38,196,207,1,46,163,137,121,1,
+14,254,41,146,151,254,247,254,71,96,125,21,254,25,8,5,152,254,229,240,62,
+221,63,140,222,119,1,120,1,122,237,1,91,182,200,254,126,254,250,222,254,125,
+151,164,152,172,1,116,228,1,72,1,94,251,100,156,155,125,57,254,19,0,0,2,0,
+92,255,86,7,41,6,66,0,36,0,44,0,0,1,34,2,7,33,22,22,21,20,6,6,35,34,2,17,
+52,18,36,51,32,0,19,33,21,33,6,2,7,33,21,33,53,54,18,53,16,0,1,50,54,53,52,
+39,33,18,2,225,224,255,4,2,111,19,28,95,169,105,235,228,155,1,38,196,1,21,
+1,94,37,1,176,254,88,2,137,119,1,14,254,41,146,151,254,247,254,71,96,125,
+21,254,25,8,5,152,254,229,240,62,221,63,140,222,119,1,120,1,122,237,1,91,
+182,254,154,254,177,164,219,254,129,149,164,152,172,1,116,228,1,72,1,94,251,
+100,156,155,125,57,254,19,0,255,255,255,254,255,86,6,203,6,66,0,2,2,184,162,
+0,255,255,255,254,255,86,5,47,6,66,0,2,2,183,162,0,0,2,0,92,255,12,3,201,
+5,174,0,22,0,27,0,0,19,22,51,51,17,33,21,33,20,18,22,51,50,55,21,6,6,35,34,
+38,2,2,53,1,34,39,17,33,92,230,241,146,1,4,253,37,96,159,109,110,60,22,91,
+57,139,184,140,47,1,215,170,155,1,69,5,174,74,254,41,164,207,254,134,234,
+86,186,33,37,154,1,71,1,82,170,1,216,36,254,168,0,0,1,0,92,253,227,7,0,3,
+141,0,33,0,0,1,33,3,35,3,53,33,50,22,21,20,6,7,6,6,21,20,23,35,38,53,52,54,
+55,62,2,53,52,38,35,33,3,35,2,162,254,143,39,135,39,4,203,235,238,113,159,
+81,57,43,168,38,89,105,86,96,37,151,164,254,82,39,135,2,233,253,220,2,36,
+164,211,196,111,245,209,105,128,87,79,79,67,91,101,200,139,111,156,111,67,
+123,120,253,220,255,255,0,92,255,12,3,201,5,174,0,2,2,187,0,0,255,255,0,0,
+255,12,3,109,5,174,0,2,2,187,164,0,255,255,0,0,255,12,3,109,5,174,0,2,2,187,
+164,0,255,255,255,254,0,18,10,25,6,66,0,2,5,77,162,0,255,255,0,92,0,18,10,
+119,6,66,2,2,5,77,0,0,0,2,0,92,255,72,4,12,3,141,0,5,0,9,0,0,1,21,33,9,2,
+23,19,55,1,4,12,254,105,1,55,253,248,254,184,207,207,231,254,236,3,141,164,
+253,150,254,201,4,69,164,253,80,140,2,36,0,0,2,0,0,255,72,4,76,3,141,0,6,
+0,10,0,0,17,33,21,33,9,2,51,19,55,1,4,76,253,155,1,56,253,248,254,233,158,
+207,231,254,235,3,141,164,253,150,254,201,3,161,253,80,140,2,36,0,0,2,0,92,
+255,72,4,217,3,141,0,5,0,9,0,0,1,21,33,9,2,23,19,55,1,4,217,253,156,1,55,
+253,248,254,184,207,207,231,254,236,3,141,164,253,150,254,201,4,69,164,253,
+80,140,2,36,0,0,2,0,0,255,72,3,127,3,141,0,6,0,10,0,0,17,33,21,33,9,2,51,
+19,55,1,3,127,254,104,1,56,253,248,254,233,158,207,231,254,235,3,141,164,
+253,150,254,201,3,161,253,80,140,2,36,0,255,255,0,92,0,109,3,246,6,176,0,
+35,0,4,0,160,0,0,0,3,0,14,0,41,5,215,255,255,255,188,0,109,3,86,6,176,2,34,
+0,4,0,0,0,3,0,14,255,137,5,215,255,255,255,188,0,109,3,86,6,176,2,2,0,4,0,
+0,255,255,255,211,0,197,2,131,5,178,2,34,5,228,0,0,0,3,0,14,255,158,5,133,
+255,255,0,0,0,197,2,131,3,141,2,2,5,228,0,0,255,255,0,20,0,152,4,45,5,57,
+2,2,0,7,0,0,255,255,0,0,253,227,2,117,5,178,0,35,0,14,255,240,5,133,0,2,3,
+164,0,0,255,255,0,0,253,227,2,117,3,141,2,2,3,164,0,0,255,255,0,92,255,119,
+5,59,3,141,0,2,0,10,92,0,255,255,0,20,255,119,6,193,5,57,2,2,0,59,0,0,255,
+255,0,0,255,119,4,223,3,141,2,2,0,10,0,0,255,255,0,0,255,119,3,33,3,141,2,
+2,0,9,0,0,255,255,0,0,255,119,3,33,3,141,2,2,0,9,0,0,255,255,255,252,0,86,
+3,166,5,209,2,2,0,58,0,0,0,1,0,0,255,119,4,135,3,141,0,17,0,0,19,18,19,7,
+2,3,53,33,32,17,20,7,35,54,53,52,38,35,162,117,225,150,241,113,3,33,1,102,
+51,152,45,92,108,2,233,254,104,254,112,74,1,195,1,175,164,254,174,131,108,
+104,135,84,90,0,255,255,0,0,1,76,1,164,3,141,2,2,0,27,0,0,0,1,0,0,0,86,5,
+236,5,137,0,24,0,0,37,2,3,33,3,35,3,53,33,54,18,51,50,18,19,7,38,38,35,34,
+6,21,20,18,23,3,74,231,29,254,143,39,135,39,2,68,18,248,198,207,245,20,164,
+17,155,136,141,164,120,130,86,1,83,1,64,253,220,2,36,164,246,1,6,254,188,
+254,210,21,229,248,203,210,166,254,201,183,0,1,255,135,0,197,2,131,5,86,0,
+17,0,0,17,53,51,3,51,23,23,51,63,2,51,3,33,21,33,3,35,53,174,137,68,25,8,
+9,13,68,137,176,1,219,254,82,39,135,2,233,164,1,201,186,80,38,42,186,254,
+55,164,253,220,0,255,255,0,20,0,197,3,16,5,86,0,3,2,215,0,141,0,0,255,255,
+255,135,0,197,2,131,5,86,2,2,2,215,0,0,0,1,255,135,0,109,3,209,6,176,0,28,
+0,0,19,35,53,51,3,51,23,23,51,63,2,51,3,51,16,18,23,16,18,55,51,6,2,17,21,
+38,38,2,55,55,53,174,137,68,25,8,9,13,68,137,176,39,106,119,197,159,189,184,
+203,152,241,142,2,233,164,1,201,186,80,38,42,186,254,55,254,255,254,249,70,
+1,194,2,222,209,228,253,42,254,73,210,8,167,1,39,255,255,0,20,0,82,7,25,5,
+178,0,35,0,14,4,174,5,133,0,2,0,173,0,0,255,255,0,20,0,82,8,195,5,178,0,35,
+0,14,4,174,5,133,0,2,0,182,0,0,255,255,0,0,0,82,4,211,5,178,2,34,0,5,0,0,
+0,3,0,14,0,190,5,133,255,255,255,254,0,82,4,182,7,240,2,34,0,6,0,0,0,3,0,
+14,255,250,7,195,255,255,0,0,0,82,4,211,3,141,2,2,0,5,0,0,255,255,255,254,
+0,82,4,182,6,66,2,2,0,6,0,0,255,255,0,0,0,82,3,41,5,178,2,34,0,8,0,0,0,3,
+0,14,0,190,5,133,255,255,0,0,0,82,3,41,3,141,2,2,0,8,0,0,255,255,0,0,0,82,
+7,25,5,178,0,35,0,14,3,4,5,133,0,2,0,183,0,0,255,255,0,0,253,227,6,164,3,
+141,0,2,2,188,164,0,255,255,255,188,254,69,3,86,6,176,2,34,0,4,0,0,0,34,0,
+14,223,219,0,3,0,14,1,160,255,147,255,255,0,92,254,69,3,246,6,176,0,35,0,
+4,0,160,0,0,0,34,0,14,127,219,0,3,0,14,2,63,255,147,255,255,0,92,253,227,
+7,207,5,209,2,2,1,138,0,0,255,255,0,92,0,86,5,244,5,209,2,2,0,96,0,0,255,
+255,255,250,0,86,5,146,5,209,0,2,0,96,158,0,255,255,255,250,253,227,7,109,
+5,209,0,2,1,138,158,0,255,255,255,250,255,119,6,86,6,20,0,2,0,22,158,0,255,
+255,255,250,255,119,7,189,6,20,0,2,1,142,158,0,255,255,0,92,255,119,8,31,
+6,20,2,2,1,142,0,0,255,255,0,92,255,119,6,184,6,20,2,2,0,22,0,0,255,255,0,
+92,0,86,4,4,5,209,2,2,0,107,0,0,255,255,0,92,0,82,5,162,6,20,2,2,0,94,0,0,
+255,255,0,92,0,82,7,82,6,20,2,2,0,95,0,0,255,255,255,252,0,82,5,66,6,20,0,
+2,0,94,160,0,255,255,255,252,0,82,6,242,6,20,0,2,0,95,160,0,0,3,255,178,254,
+96,3,223,3,141,0,6,0,12,0,18,0,0,17,53,33,21,33,3,35,1,6,7,39,54,55,5,6,7,
+39,54,55,3,223,252,246,39,135,1,0,185,100,88,126,122,2,70,184,101,88,126,
+122,2,233,164,164,253,220,254,219,132,106,80,179,120,223,128,110,80,179,120,
+255,255,0,92,0,197,6,139,5,219,0,34,0,79,0,0,0,3,0,14,4,205,5,174,255,255,
+0,92,0,197,6,139,5,219,2,34,0,79,0,0,0,3,0,14,4,205,5,174,255,255,0,92,0,
+197,6,139,5,219,2,34,0,79,0,0,0,3,0,14,4,205,5,174,255,255,0,0,0,197,4,201,
+5,178,0,35,0,14,1,227,5,133,0,2,0,60,0,0,255,255,0,0,0,197,4,201,5,178,0,
+35,0,14,1,227,5,133,0,2,0,60,0,0,255,255,0,92,253,227,7,207,7,199,0,35,0,
+14,1,113,7,154,0,2,1,138,0,0,255,255,0,92,0,86,5,244,7,199,2,34,0,96,0,0,
+0,3,0,14,1,113,7,154,255,255,255,250,0,86,5,146,7,199,0,34,0,96,158,0,0,3,
+0,14,1,14,7,154,255,255,255,250,253,227,7,109,7,199,0,35,0,14,1,14,7,154,
+0,2,1,138,158,0,255,255,0,92,255,119,8,31,8,4,0,35,0,14,1,113,7,215,0,2,1,
+142,0,0,255,255,0,92,255,119,6,184,8,4,2,34,0,22,0,0,0,3,0,14,1,113,7,215,
+255,255,255,250,255,119,6,86,8,4,0,34,0,22,158,0,0,3,0,14,1,14,7,215,255,
+255,255,250,255,119,7,189,8,4,0,35,0,14,1,14,7,215,0,2,1,142,158,0,255,255,
+0,92,255,119,8,31,8,4,0,35,0,14,1,113,7,215,0,2,1,142,0,0,255,255,0,92,255,
+119,6,184,8,4,2,34,0,22,0,0,0,3,0,14,1,113,7,215,255,255,255,250,255,119,
+6,86,8,4,0,34,0,22,158,0,0,3,0,14,1,14,7,215,255,255,255,250,255,119,7,189,
+8,4,0,35,0,14,1,14,7,215,0,2,1,142,158,0,255,255,0,92,0,82,5,162,8,4,2,34,
+0,94,0,0,0,3,0,14,2,20,7,215,255,255,0,92,0,82,7,82,8,4,2,34,0,95,0,0,0,3,
+0,14,2,20,7,215,255,255,255,252,0,82,6,242,8,4,0,34,0,95,160,0,0,3,0,14,1,
+180,7,215,255,255,255,252,0,82,5,66,8,4,0,34,0,94,160,0,0,3,0,14,1,180,7,
+215,0,3,0,92,0,197,7,86,6,14,0,29,0,41,0,53,0,0,37,18,17,16,2,35,34,6,7,22,
+19,35,2,38,35,34,7,53,54,55,18,0,51,32,19,33,21,33,20,3,19,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,246,35,154,154,137,
+170,12,160,30,159,25,104,95,85,52,72,100,23,1,2,196,1,158,55,2,156,253,107,
+43,55,142,102,100,143,143,100,101,143,104,80,60,59,82,82,59,60,80,197,1,17,
+1,48,1,29,1,4,221,232,141,253,240,1,49,248,27,164,33,4,1,10,1,43,253,188,
+164,253,254,217,4,86,100,143,142,101,101,143,143,101,60,82,82,60,59,80,80,
+255,255,0,92,0,197,7,86,6,14,0,2,3,10,0,0,0,2,0,92,0,86,5,201,5,219,0,21,
+0,27,0,0,1,2,38,35,34,6,21,20,18,23,7,0,17,52,18,54,51,50,18,19,33,21,3,6,
+7,39,54,55,3,109,22,139,157,141,164,125,123,146,254,248,114,212,141,195,227,
+35,1,209,21,181,103,89,130,118,2,233,1,69,249,240,245,180,254,203,171,88,
+1,139,1,97,198,1,42,159,254,240,254,204,164,2,101,126,112,80,181,118,0,3,
+0,92,0,86,6,147,6,14,0,21,0,33,0,45,0,0,1,2,38,35,34,6,21,20,18,23,7,0,17,
+52,18,54,51,50,18,19,33,21,1,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,
+22,21,20,6,35,34,38,3,109,22,139,157,141,164,125,123,146,254,248,114,212,
+141,195,227,35,2,155,253,224,80,59,59,82,82,59,59,80,105,145,99,99,145,145,
+99,99,145,2,233,1,69,249,240,245,180,254,203,171,88,1,139,1,97,198,1,42,159,
+254,240,254,204,164,2,50,60,82,82,60,59,80,80,59,101,142,142,101,102,142,
+142,0,255,255,0,0,0,197,4,201,6,14,0,35,0,208,1,23,5,215,0,2,0,60,0,0,255,
+255,0,0,0,197,4,201,6,14,0,35,0,208,1,23,5,215,0,2,0,60,0,0,255,255,255,252,
+0,86,6,51,6,14,0,2,3,13,160,0,255,255,0,92,253,227,7,207,8,35,0,35,0,208,
+1,10,7,236,0,2,1,138,0,0,255,255,0,92,0,86,5,244,8,35,2,34,0,96,0,0,0,3,0,
+208,1,10,7,236,255,255,255,250,0,86,5,146,8,35,0,34,0,96,158,0,0,3,0,208,
+0,168,7,236,255,255,255,250,253,227,7,109,8,35,0,35,0,208,0,168,7,236,0,2,
+1,138,158,0,255,255,0,92,255,119,8,31,8,96,0,35,0,208,1,51,8,41,0,2,1,142,
+0,0,255,255,0,92,255,119,6,184,8,96,2,34,0,22,0,0,0,3,0,208,1,51,8,41,255,
+255,255,250,255,119,6,86,8,96,0,34,0,22,158,0,0,3,0,208,0,209,8,41,255,255,
+255,250,255,119,7,189,8,96,0,35,0,208,0,209,8,41,0,2,1,142,158,0,255,255,
+0,92,0,82,5,162,8,96,2,34,0,94,0,0,0,3,0,208,1,195,8,41,255,255,0,92,0,82,
+7,82,8,96,2,34,0,95,0,0,0,3,0,208,1,195,8,41,255,255,255,252,0,82,6,242,8,
+96,0,34,0,95,160,0,0,3,0,208,1,98,8,41,255,255,255,252,0,82,5,66,8,96,0,34,
+0,94,160,0,0,3,0,208,1,98,8,41,255,255,0,92,255,119,8,31,8,96,0,35,0,208,
+1,51,8,41,0,2,1,142,0,0,255,255,0,92,255,119,6,184,8,96,2,34,0,22,0,0,0,3,
+0,208,1,51,8,41,255,255,255,250,255,119,6,86,8,96,0,34,0,22,158,0,0,3,0,208,
+0,209,8,41,255,255,255,250,255,119,7,189,8,96,0,35,0,208,0,209,8,41,0,2,1,
+142,158,0,0,2,0,92,0,82,5,86,5,221,0,34,0,42,0,0,1,22,22,21,20,6,6,35,34,
+2,17,16,18,51,50,23,54,54,51,50,18,17,35,16,2,35,34,6,7,38,38,35,34,6,7,1,
+50,54,53,52,39,33,18,3,109,19,28,95,169,105,235,228,202,200,143,92,47,103,
+75,200,212,152,127,133,75,101,49,47,111,77,115,117,8,1,31,96,125,21,254,25,
+8,3,141,62,221,63,140,222,119,1,120,1,122,1,64,1,89,108,53,55,254,131,254,
+137,1,48,1,26,76,86,86,76,205,217,253,111,156,155,125,57,254,19,0,2,0,92,
+0,82,5,98,5,221,0,34,0,42,0,0,1,34,6,7,38,38,35,34,6,7,33,22,22,21,20,6,6,
+35,34,2,17,16,18,51,50,23,54,54,51,50,18,19,7,38,2,1,50,54,53,52,39,33,18,
+3,186,75,101,49,47,111,77,115,117,8,2,111,19,28,95,169,105,235,228,202,200,
+143,92,47,103,75,182,225,17,164,10,139,253,244,96,125,21,254,25,8,5,51,76,
+86,86,76,205,217,62,221,63,140,222,119,1,120,1,122,1,64,1,89,108,53,55,254,
+170,254,211,20,229,1,8,251,201,156,155,125,57,254,19,0,255,255,255,254,0,
+82,4,248,5,221,0,2,3,33,162,0,255,255,255,254,0,82,5,4,5,221,0,2,3,34,162,
+0,0,2,0,92,0,82,7,98,5,221,0,39,0,47,0,0,1,34,6,7,38,38,35,34,6,7,33,22,22,
+21,20,6,6,35,34,2,17,16,18,51,50,23,54,54,51,50,18,19,33,21,33,3,35,3,2,2,
+1,50,54,53,52,39,33,18,3,186,75,101,49,47,111,77,115,117,8,2,111,19,28,95,
+169,105,235,228,202,200,143,92,47,103,75,191,217,35,1,237,254,82,39,135,39,
+20,133,253,215,96,125,21,254,25,8,5,51,76,86,86,76,205,217,62,221,63,140,
+222,119,1,120,1,122,1,64,1,89,108,53,55,254,197,254,235,164,253,220,2,36,
+1,29,1,45,251,201,156,155,125,57,254,19,0,0,2,0,92,253,227,9,61,5,221,0,62,
+0,70,0,0,1,34,6,7,38,38,35,34,6,7,33,22,22,21,20,6,6,35,34,2,17,16,18,51,
+50,23,54,54,51,50,18,19,33,50,22,21,20,2,7,14,2,21,20,23,35,38,53,52,54,55,
+54,54,53,52,38,35,33,3,35,3,2,2,1,50,54,53,52,39,33,18,3,186,75,101,49,47,
+111,77,115,117,8,2,111,19,28,95,169,105,235,228,202,200,143,92,47,103,75,
+191,217,35,1,239,236,237,126,146,55,59,23,43,168,39,96,99,121,98,152,164,
+254,82,39,135,39,20,133,253,215,96,125,21,254,25,8,5,51,76,86,86,76,205,217,
+62,221,63,140,222,119,1,120,1,122,1,64,1,89,108,53,55,254,197,254,235,211,
+196,121,254,255,187,71,104,81,64,83,75,65,93,105,205,130,160,189,96,123,120,
+253,220,2,36,1,29,1,45,251,201,156,155,125,57,254,19,255,255,255,254,253,
+227,8,223,5,221,0,2,3,38,162,0,255,255,255,254,0,82,7,4,5,221,0,2,3,37,162,
+0,0,4,0,92,0,82,7,180,5,221,0,25,0,38,0,46,0,55,0,0,19,16,18,51,50,23,54,
+54,51,50,18,19,33,21,33,2,2,35,34,38,39,6,6,35,34,2,1,34,6,7,33,38,38,35,
+34,6,7,38,38,1,50,54,54,55,33,21,16,1,20,22,22,51,50,54,53,53,92,235,228,
+156,100,53,111,82,215,241,21,1,182,254,80,4,215,219,98,150,43,41,168,92,218,
+200,1,207,135,146,16,4,90,18,153,144,82,111,53,51,121,1,207,103,114,57,2,
+254,31,253,125,54,108,94,98,127,3,0,1,99,1,122,129,64,65,254,200,254,232,
+164,254,177,254,184,96,98,98,96,1,92,3,133,205,217,216,206,76,86,86,76,251,
+201,96,219,178,159,254,178,1,237,174,223,96,166,168,159,255,255,0,92,0,82,
+7,98,7,199,2,34,3,37,0,0,0,3,0,14,2,33,7,154,255,255,0,92,0,82,7,180,7,199,
+2,34,3,41,0,0,0,3,0,14,2,115,7,154,255,255,0,92,0,82,6,4,7,199,2,34,0,157,
+0,0,0,3,0,14,2,115,7,154,255,255,255,254,0,82,7,86,5,221,0,2,3,41,162,0,255,
+255,255,254,0,82,5,166,5,221,0,2,0,157,162,0,255,255,0,92,253,227,9,61,7,
+199,2,34,3,38,0,0,0,3,0,14,2,33,7,154,255,255,255,254,0,82,7,4,7,199,0,34,
+3,37,162,0,0,3,0,14,1,195,7,154,255,255,255,254,253,227,8,223,7,199,0,34,
+3,38,162,0,0,3,0,14,1,195,7,154,0,2,0,92,255,119,8,10,5,221,0,42,0,50,0,0,
+5,2,2,3,38,38,35,34,6,7,38,38,35,34,6,7,33,22,22,21,20,6,6,35,34,2,17,16,
+18,51,50,23,54,54,51,50,18,19,33,21,33,18,19,1,50,54,53,52,39,33,18,6,76,
+170,149,44,39,135,121,75,101,49,47,111,77,115,117,8,2,111,19,28,95,169,105,
+235,228,202,200,143,92,47,103,75,182,213,55,2,142,253,144,77,250,251,60,96,
+125,21,254,25,8,137,1,68,1,156,1,1,252,223,76,86,86,76,205,217,62,221,63,
+140,222,119,1,120,1,122,1,64,1,89,108,53,55,254,237,254,195,164,254,157,254,
+59,1,59,156,155,125,57,254,19,0,2,0,92,255,119,9,113,5,221,0,52,0,60,0,0,
+1,22,18,23,7,2,2,3,38,38,35,34,6,7,38,38,35,34,6,7,33,22,22,21,20,6,6,35,
+34,2,17,16,18,51,50,23,54,54,51,50,18,19,33,32,17,20,7,35,54,53,52,38,35,
+1,50,54,53,52,39,33,18,5,154,41,156,130,149,170,149,44,39,135,121,75,101,
+49,47,111,77,115,117,8,2,111,19,28,95,169,105,235,228,202,200,143,92,47,103,
+75,179,212,60,2,141,1,103,52,151,45,92,109,250,19,96,125,21,254,25,8,2,233,
+195,254,135,236,74,1,68,1,156,1,1,252,223,76,86,86,76,205,217,62,221,63,140,
+222,119,1,120,1,122,1,64,1,89,108,53,55,254,245,254,187,254,174,129,110,108,
+131,84,90,254,19,156,155,125,57,254,19,255,255,255,254,255,119,7,172,5,221,
+0,2,3,50,162,0,255,255,255,254,255,119,9,19,5,221,0,2,3,51,162,0,255,255,
+255,254,0,82,7,86,7,199,0,34,3,41,162,0,0,3,0,14,2,20,7,154,255,255,255,254,
+0,82,5,166,7,199,0,34,0,157,162,0,0,3,0,14,2,20,7,154,0,4,0,92,0,82,9,27,
+5,221,0,34,0,47,0,55,0,64,0,0,1,2,2,35,34,38,39,6,6,35,34,2,17,16,18,51,50,
+23,54,54,51,50,18,19,33,32,17,20,7,35,54,53,52,38,35,1,34,6,7,33,38,38,35,
+34,6,7,38,38,1,50,54,54,55,33,21,16,1,20,22,22,51,50,54,53,53,6,4,4,215,219,
+98,150,43,41,168,92,218,200,235,228,156,100,53,111,82,215,241,21,1,182,1,
+103,52,151,45,92,109,250,119,135,146,16,4,90,18,153,144,82,111,53,51,121,
+1,207,103,114,57,2,254,31,253,125,54,108,94,98,127,2,233,254,177,254,184,
+96,98,98,96,1,92,1,82,1,99,1,122,129,64,65,254,200,254,232,254,174,129,110,
+108,131,84,90,2,74,205,217,216,206,76,86,86,76,251,201,96,219,178,159,254,
+178,1,237,174,223,96,166,168,159,0,4,0,92,255,119,10,8,5,221,0,31,0,44,0,
+52,0,61,0,0,1,18,19,7,2,3,35,2,2,35,34,38,39,6,6,35,34,2,17,16,18,51,50,23,
+54,54,51,50,18,19,33,21,1,34,6,7,33,38,38,35,34,6,7,38,38,1,50,54,54,55,33,
+21,16,1,20,22,22,51,50,54,53,53,7,137,121,221,149,238,117,227,4,215,219,98,
+150,43,41,168,92,218,200,235,228,156,100,53,111,82,215,241,21,4,10,248,35,
+135,146,16,4,90,18,153,144,82,111,53,51,121,1,207,103,114,57,2,254,31,253,
+125,54,108,94,98,127,2,233,254,97,254,119,74,1,185,1,185,254,177,254,184,
+96,98,98,96,1,92,1,82,1,99,1,122,129,64,65,254,200,254,232,164,2,74,205,217,
+216,206,76,86,86,76,251,201,96,219,178,159,254,178,1,237,174,223,96,166,168,
+159,255,255,255,254,255,119,9,170,5,221,0,2,3,57,162,0,255,255,255,254,0,
+82,8,189,5,221,0,2,3,56,162,0,255,255,0,92,255,119,9,113,5,221,2,2,3,51,0,
+0,255,255,0,92,255,119,8,10,5,221,2,2,3,50,0,0,255,255,255,254,255,119,7,
+172,5,221,0,2,3,50,162,0,255,255,255,254,255,119,9,19,5,221,0,2,3,51,162,
+0,255,255,0,92,255,119,9,113,5,221,2,2,3,51,0,0,255,255,0,92,255,119,8,10,
+5,221,2,2,3,50,0,0,255,255,255,254,255,119,7,172,5,221,0,2,3,50,162,0,255,
+255,255,254,255,119,9,19,5,221,0,2,3,51,162,0,0,2,0,92,0,143,5,176,5,223,
+0,25,0,33,0,0,19,22,51,50,54,19,51,18,19,33,21,33,22,18,23,35,2,2,39,35,6,
+2,6,35,34,39,23,22,22,23,7,38,38,39,92,94,80,92,100,64,193,89,83,2,57,253,
+242,35,63,35,156,66,150,64,9,15,87,130,110,96,88,158,108,246,111,90,102,246,
+101,3,145,39,242,1,131,254,230,254,200,164,139,254,217,161,1,91,2,81,180,
+128,254,196,117,51,174,54,172,106,111,102,173,49,0,2,0,0,254,82,4,227,5,223,
+0,25,0,33,0,0,19,18,19,51,16,19,33,21,33,18,19,35,38,2,3,35,6,2,21,20,23,
+35,38,2,53,53,1,22,22,23,7,38,38,39,102,88,199,166,51,2,133,253,158,75,142,
+174,113,131,28,9,115,98,25,158,23,34,1,14,109,246,110,90,96,250,102,3,141,
+1,65,1,17,254,211,254,219,164,254,208,254,221,255,2,5,1,86,216,254,110,238,
+156,102,109,1,88,142,164,252,127,53,172,106,111,96,178,50,0,255,255,0,92,
+0,143,5,176,5,223,2,2,3,68,0,0,0,2,0,0,254,82,6,129,6,176,0,35,0,43,0,0,1,
+38,3,35,6,2,21,20,23,35,38,2,53,53,51,18,19,51,16,19,33,20,18,23,16,18,55,
+51,6,2,17,21,38,38,2,53,1,22,22,23,7,38,38,39,1,229,48,25,9,115,98,25,158,
+23,34,102,88,199,166,51,1,33,104,121,196,161,188,184,203,152,242,141,254,
+39,109,246,110,90,96,250,102,2,233,217,1,46,216,254,110,238,156,102,109,1,
+88,142,164,1,65,1,17,254,187,254,243,250,254,244,72,1,185,2,230,210,228,253,
+42,254,73,210,8,169,1,38,165,253,35,53,172,106,111,96,178,50,255,255,0,0,
+254,190,5,37,3,141,2,2,0,33,0,0,255,255,0,0,0,82,7,25,3,141,2,2,3,190,0,0,
+255,255,0,0,0,82,7,236,6,176,2,2,0,186,0,0,255,255,0,92,0,197,5,154,6,55,
+0,2,0,34,0,0,0,2,0,92,0,197,6,76,5,211,0,17,0,26,0,0,1,21,33,3,35,3,33,53,
+33,38,39,53,54,54,51,50,18,19,1,22,23,33,38,38,35,34,6,6,76,254,82,39,135,
+39,252,147,1,55,83,125,98,219,139,230,227,12,252,228,158,104,1,114,10,143,
+152,96,160,3,141,164,253,220,2,36,164,118,63,182,110,109,254,227,254,215,
+1,25,99,182,205,207,59,0,255,255,0,92,0,197,6,76,5,211,0,2,3,76,0,0,0,2,0,
+0,253,223,5,37,3,141,0,20,0,32,0,0,19,18,23,54,51,50,22,21,20,6,35,39,22,
+23,7,2,0,3,53,33,21,1,34,6,21,20,22,51,50,54,53,52,38,162,81,60,82,219,164,
+197,198,159,33,69,52,143,213,254,247,75,5,37,253,55,98,105,103,98,92,111,
+103,2,233,254,214,162,190,208,165,164,206,2,117,76,86,1,75,2,113,1,78,164,
+164,254,80,116,97,94,123,111,104,99,116,0,255,255,0,92,0,197,5,154,6,55,2,
+34,0,34,0,0,0,3,0,14,3,219,5,174,255,255,0,92,0,197,6,76,5,219,0,34,3,76,
+0,0,0,3,0,14,4,141,5,174,255,255,0,92,0,197,5,154,6,55,0,34,0,34,0,0,0,3,
+0,14,3,219,5,174,255,255,0,0,253,223,5,37,5,219,2,34,3,78,0,0,0,3,0,14,1,
+111,5,174,255,255,0,0,253,223,5,37,5,219,0,34,3,78,0,0,0,3,0,14,1,111,5,174,
+255,255,0,0,254,190,5,37,5,219,2,34,0,33,0,0,0,3,0,14,1,111,5,174,255,255,
+0,92,255,119,3,156,3,141,0,2,1,149,0,0,0,1,0,0,255,63,3,31,3,141,0,20,0,0,
+23,54,53,52,46,2,2,39,53,33,21,33,23,30,2,21,20,6,7,233,107,12,23,40,195,
+70,3,31,253,137,57,123,110,44,49,41,193,76,135,34,72,68,87,1,96,114,164,164,
+91,201,207,146,82,69,113,29,0,1,0,61,255,63,3,188,3,141,0,16,0,0,5,54,53,
+52,38,0,39,33,21,33,23,22,18,21,20,6,7,1,135,107,64,254,201,62,3,127,253,
+138,56,158,119,49,41,193,76,135,81,165,2,33,100,164,91,253,254,253,124,69,
+113,29,255,255,0,0,255,63,3,31,3,141,0,2,3,86,0,0,0,1,0,20,255,135,4,102,
+6,35,0,29,0,0,1,20,18,22,51,50,55,21,6,6,35,34,38,2,17,53,52,38,35,34,7,53,
+54,51,50,22,17,21,33,21,1,205,70,109,79,113,57,23,90,57,149,176,93,75,85,
+78,43,43,95,163,140,2,153,2,233,174,254,166,176,86,186,33,37,219,1,212,1,
+16,247,185,131,37,174,33,229,254,255,176,164,0,255,255,0,20,255,135,4,102,
+6,35,0,2,3,89,0,0,0,1,0,0,255,135,4,143,6,35,0,32,0,0,17,33,53,52,38,35,34,
+7,53,54,51,50,22,17,21,33,21,33,20,18,22,51,50,55,21,6,6,35,34,38,2,39,33,
+1,86,75,85,78,43,43,95,163,140,2,153,253,103,71,109,78,113,57,23,90,57,142,
+172,96,8,254,170,3,141,176,185,131,37,174,33,229,254,255,176,164,176,254,
+163,171,86,186,33,37,199,1,165,246,255,255,0,0,255,135,4,143,6,35,0,2,3,91,
+0,0,255,255,0,92,0,72,4,12,7,199,2,34,0,131,0,0,0,3,0,14,1,113,7,154,255,
+255,0,92,0,72,4,6,7,199,2,34,0,132,0,0,0,3,0,14,1,113,7,154,255,255,0,0,0,
+72,3,170,7,199,0,34,0,132,164,0,0,3,0,14,1,20,7,154,255,255,0,0,0,72,3,176,
+7,199,0,34,0,131,164,0,0,3,0,14,1,20,7,154,255,255,0,92,253,227,7,207,7,199,
+0,35,0,14,1,113,7,154,0,2,2,57,0,0,255,255,0,92,0,72,5,244,7,199,2,34,2,55,
+0,0,0,3,0,14,1,113,7,154,255,255,0,0,0,72,5,152,7,199,0,34,2,55,164,0,0,3,
+0,14,1,20,7,154,255,255,0,0,253,227,7,115,7,199,0,35,0,14,1,20,7,154,0,2,
+2,57,164,0,255,255,0,92,0,72,5,162,8,4,2,34,2,67,0,0,0,3,0,14,2,20,7,215,
+255,255,0,92,0,72,7,82,8,4,2,34,2,68,0,0,0,3,0,14,2,20,7,215,255,255,0,0,
+0,72,6,246,8,4,0,34,2,68,164,0,0,3,0,14,1,184,7,215,255,255,0,0,0,72,5,70,
+8,4,0,34,2,67,164,0,0,3,0,14,1,184,7,215,255,255,0,92,253,227,7,207,7,199,
+0,35,0,14,1,113,7,154,0,2,2,57,0,0,255,255,0,92,0,72,5,244,7,199,2,34,2,55,
+0,0,0,3,0,14,1,113,7,154,255,255,0,0,0,72,5,152,7,199,0,34,2,55,164,0,0,3,
+0,14,1,20,7,154,255,255,0,0,253,227,7,115,7,199,0,35,0,14,1,20,7,154,0,2,
+2,57,164,0,255,255,0,92,0,72,5,162,8,4,2,34,2,67,0,0,0,3,0,14,2,20,7,215,
+255,255,0,92,0,72,7,82,8,4,2,34,2,68,0,0,0,3,0,14,2,20,7,215,255,255,0,0,
+0,72,6,246,8,4,0,34,2,68,164,0,0,3,0,14,1,184,7,215,255,255,0,0,0,72,5,70,
+8,4,0,34,2,67,164,0,0,3,0,14,1,184,7,215,255,255,0,92,255,12,8,184,8,4,0,
+35,0,14,1,113,7,215,0,2,2,92,0,0,255,255,0,92,255,12,7,82,8,4,2,34,2,89,0,
+0,0,3,0,14,1,113,7,215,255,255,0,0,255,12,6,246,8,4,0,34,2,89,164,0,0,3,0,
+14,1,20,7,215,255,255,0,0,255,12,8,92,8,4,0,35,0,14,1,20,7,215,0,2,2,92,164,
+0,255,255,0,92,0,72,4,12,8,35,2,34,0,131,0,0,0,3,0,208,1,10,7,236,255,255,
+0,92,0,72,4,6,8,35,2,34,0,132,0,0,0,3,0,208,1,10,7,236,255,255,0,92,253,227,
+7,207,8,35,0,35,0,208,1,10,7,236,0,2,2,57,0,0,255,255,0,92,0,72,5,244,8,35,
+2,34,2,55,0,0,0,3,0,208,1,10,7,236,255,255,0,92,0,72,5,162,8,96,2,34,2,67,
+0,0,0,3,0,208,1,195,8,41,255,255,0,92,0,72,7,82,8,96,2,34,2,68,0,0,0,3,0,
+208,1,195,8,41,255,255,0,0,0,72,3,170,8,35,0,34,0,132,164,0,0,3,0,208,0,174,
+7,236,255,255,0,0,0,72,3,176,8,35,0,34,0,131,164,0,0,3,0,208,0,174,7,236,
+255,255,0,0,0,72,5,152,8,35,0,34,2,55,164,0,0,3,0,208,0,174,7,236,255,255,
+0,0,253,227,7,115,8,35,0,35,0,208,0,174,7,236,0,2,2,57,164,0,255,255,0,0,
+0,72,6,246,8,96,0,34,2,68,164,0,0,3,0,208,1,102,8,41,255,255,0,0,0,72,5,70,
+8,96,0,34,2,67,164,0,0,3,0,208,1,102,8,41,255,255,0,92,0,150,5,176,7,27,0,
+2,0,172,0,0,0,1,0,0,0,150,4,227,7,27,0,33,0,0,1,17,33,21,33,18,23,33,21,33,
+18,19,35,2,2,3,35,6,2,21,20,23,35,38,2,53,53,51,18,55,33,53,33,17,1,252,1,
+82,254,205,6,49,2,145,253,148,76,151,174,125,128,30,8,110,93,25,158,23,34,
+102,70,160,254,237,1,66,7,27,254,241,127,254,240,240,164,254,217,254,212,
+1,11,1,241,1,73,209,254,111,225,156,102,109,1,88,142,164,1,5,251,127,1,15,
+0,1,0,0,0,150,4,227,7,27,0,33,0,0,1,17,33,21,33,18,23,33,21,33,18,19,35,2,
+2,3,35,6,2,21,20,23,35,38,2,53,53,51,18,55,33,53,33,17,1,252,1,82,254,205,
+6,49,2,145,253,148,76,151,174,125,128,30,8,110,93,25,158,23,34,102,70,160,
+254,237,1,66,7,27,254,241,127,254,240,240,164,254,217,254,212,1,11,1,241,
+1,73,209,254,111,225,156,102,109,1,88,142,164,1,5,251,127,1,15,0,1,0,92,0,
+150,5,176,6,12,0,30,0,0,19,33,21,33,18,19,33,21,33,18,23,35,2,2,39,35,6,2,
+6,35,34,39,53,22,51,50,54,55,54,55,33,233,3,21,254,211,86,70,2,67,253,234,
+105,36,156,54,155,67,8,28,84,127,108,96,88,94,80,70,86,39,54,13,254,217,6,
+12,127,255,0,255,0,164,254,84,167,1,30,2,77,183,139,254,254,102,51,153,39,
+115,141,223,68,0,0,1,0,0,0,150,4,227,6,12,0,29,0,0,19,33,21,33,18,23,33,21,
+33,18,19,35,2,2,3,35,6,2,21,20,23,35,38,2,53,53,51,18,55,35,78,3,20,254,185,
+6,49,2,145,253,148,76,151,174,125,128,30,8,110,93,25,158,23,34,102,70,160,
+254,6,12,127,254,240,240,164,254,217,254,212,1,11,1,241,1,73,209,254,111,
+225,156,102,109,1,88,142,164,1,5,251,0,255,255,0,92,0,150,5,176,6,12,0,2,
+3,132,0,0,0,1,0,0,0,150,6,74,6,12,0,38,0,0,37,35,2,2,3,35,6,2,21,20,23,35,
+38,2,53,53,51,18,55,35,53,33,21,33,18,23,33,32,17,20,7,35,54,53,52,38,35,
+33,18,3,90,174,125,128,30,8,110,93,25,158,23,34,102,70,160,254,3,20,254,185,
+6,49,2,145,1,103,51,152,45,92,109,253,148,76,150,1,11,1,241,1,73,209,254,
+111,225,156,102,109,1,88,142,164,1,5,251,127,127,254,240,240,254,174,126,
+113,104,135,84,90,254,217,0,1,0,92,2,197,3,254,6,12,0,24,0,0,19,33,21,33,
+18,19,35,2,39,35,6,2,6,35,34,39,53,22,51,50,54,55,54,55,33,233,3,21,254,211,
+109,92,150,70,71,8,28,84,127,108,96,88,94,80,70,86,39,54,13,254,217,6,12,
+127,254,179,254,169,1,17,190,139,254,254,102,51,153,39,115,141,223,68,0,1,
+0,0,0,150,3,98,6,12,0,23,0,0,19,33,21,33,18,19,35,2,39,35,6,2,21,20,23,35,
+38,2,53,53,51,18,55,35,78,3,20,254,211,111,90,150,81,97,8,127,113,25,158,
+23,34,102,70,160,254,6,12,127,254,180,254,168,1,55,255,222,254,82,251,156,
+102,109,1,88,142,164,1,5,251,0,0,1,0,92,0,197,2,160,5,178,0,7,0,0,19,51,17,
+33,21,33,17,35,92,150,1,174,254,82,150,5,178,253,219,164,253,220,255,255,
+0,92,0,197,2,160,5,178,0,2,3,138,0,0,255,255,0,0,0,197,2,68,5,178,0,2,3,138,
+164,0,255,255,0,0,0,197,2,68,5,178,0,2,3,138,164,0,0,20,0,102,0,0,6,123,6,
+20,0,32,0,42,0,53,0,63,0,69,0,75,0,81,0,87,0,91,0,95,0,99,0,103,0,107,0,111,
+0,115,0,119,0,123,0,127,0,131,0,135,0,0,1,20,6,35,34,39,53,22,51,50,53,52,
+38,39,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,22,22,1,35,17,33,21,
+33,21,33,21,33,1,51,19,22,23,54,54,19,51,3,35,19,35,17,52,55,6,7,39,55,51,
+1,53,51,21,51,21,33,53,51,53,51,21,1,21,35,53,51,21,5,53,35,53,51,21,1,53,
+51,21,3,53,51,21,1,51,21,35,1,53,51,21,1,51,21,35,17,51,21,35,1,51,21,35,
+1,51,21,35,1,51,21,35,1,53,51,21,3,53,51,21,1,53,51,21,2,238,117,103,102,
+57,81,83,122,55,76,73,74,106,86,91,71,28,71,65,47,49,51,68,80,78,254,239,
+92,1,111,254,237,1,0,255,0,1,162,90,107,49,10,11,50,105,90,211,90,125,88,
+4,20,121,48,199,74,251,151,93,153,4,41,154,92,250,72,93,246,4,195,154,246,
+251,51,246,246,246,253,194,93,93,2,144,246,2,51,92,92,92,92,250,71,93,93,
+5,185,92,92,250,71,93,93,3,215,246,246,246,253,195,246,1,80,78,84,35,88,43,
+74,37,41,24,25,77,68,68,73,41,77,39,33,29,39,39,22,25,69,1,174,2,14,80,158,
+80,1,62,254,248,121,39,39,128,1,1,253,242,253,127,1,51,67,58,20,99,59,154,
+253,47,246,154,92,92,154,246,5,184,153,245,92,153,153,92,245,250,225,92,92,
+5,184,92,92,253,205,246,253,113,92,92,2,61,245,3,133,246,254,102,245,2,61,
+246,2,62,246,1,225,92,92,250,72,92,92,5,184,92,92,0,0,20,0,102,0,0,6,123,
+6,20,0,32,0,57,0,67,0,78,0,84,0,90,0,96,0,102,0,106,0,110,0,114,0,118,0,122,
+0,126,0,130,0,134,0,138,0,142,0,146,0,150,0,0,1,20,6,35,34,39,53,22,51,50,
+53,52,38,39,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,22,22,5,33,53,
+55,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,7,7,21,33,1,35,17,33,21,
+33,21,33,21,33,1,51,19,22,23,54,54,19,51,3,35,1,51,53,51,21,35,33,53,51,21,
+51,21,3,21,35,53,51,21,33,35,53,51,21,35,1,53,51,21,3,53,51,21,1,51,21,35,
+1,53,51,21,1,51,21,35,37,51,21,35,1,51,21,35,21,51,21,35,1,51,21,35,1,53,
+51,21,3,53,51,21,1,53,51,21,2,238,117,103,102,57,81,83,122,55,76,73,74,106,
+86,91,71,28,71,65,47,49,51,68,80,78,2,106,254,90,162,83,54,51,45,45,68,35,
+47,86,109,90,98,69,86,103,1,33,252,133,92,1,111,254,237,1,0,255,0,1,162,90,
+107,49,10,11,50,105,90,211,90,1,51,154,92,246,250,225,93,153,153,93,246,4,
+195,154,246,92,251,143,246,246,246,253,194,93,93,2,144,246,2,51,92,92,250,
+71,93,93,5,185,92,92,92,92,250,71,93,93,3,215,246,246,246,253,195,246,1,80,
+78,84,35,88,43,74,37,41,24,25,77,68,68,73,41,77,39,33,29,39,39,22,25,69,211,
+73,127,66,69,48,40,46,35,35,61,86,84,73,60,100,66,77,5,2,48,2,14,80,158,80,
+1,62,254,248,121,39,39,128,1,1,253,242,253,24,154,246,246,154,92,5,184,153,
+245,92,92,245,250,225,92,92,5,184,92,92,253,205,246,253,113,92,92,2,61,245,
+245,245,3,133,246,82,246,2,62,246,1,225,92,92,250,72,92,92,5,184,92,92,0,
+0,20,0,102,0,0,6,123,6,20,0,35,0,68,0,78,0,89,0,95,0,101,0,107,0,113,0,117,
+0,121,0,125,0,129,0,133,0,137,0,141,0,145,0,149,0,153,0,157,0,161,0,0,1,20,
+6,7,21,22,21,20,6,35,34,39,53,22,51,50,54,53,52,35,35,53,51,50,54,53,52,35,
+34,6,7,39,54,51,50,22,1,20,6,35,34,39,53,22,51,50,53,52,38,39,38,38,53,52,
+54,51,50,23,7,38,35,34,6,21,20,22,23,22,22,1,35,17,33,21,33,21,33,21,33,1,
+51,19,22,23,54,54,19,51,3,35,1,51,53,51,21,35,33,53,51,21,51,21,3,21,35,53,
+51,21,5,53,35,53,51,21,1,53,51,21,3,53,51,21,1,51,21,35,1,53,51,21,1,51,21,
+35,37,51,21,35,1,51,21,35,21,51,21,35,1,51,21,35,1,53,51,21,3,53,51,21,1,
+53,51,21,5,55,59,51,133,115,125,91,69,78,84,78,66,164,49,51,69,72,92,47,64,
+32,45,80,108,92,92,253,183,117,103,102,57,81,83,122,55,76,73,74,106,86,91,
+71,28,71,65,47,49,51,68,80,78,254,239,92,1,111,254,237,1,0,255,0,1,162,90,
+107,49,10,11,50,105,90,211,90,1,51,154,92,246,250,225,93,153,153,93,246,4,
+195,154,246,251,51,246,246,246,253,194,93,93,2,144,246,2,51,92,92,250,71,
+93,93,5,185,92,92,92,92,250,71,93,93,3,215,246,246,246,253,195,246,2,92,53,
+70,10,4,16,107,76,94,41,84,49,49,47,80,76,53,43,68,33,29,62,75,77,254,184,
+78,84,35,88,43,74,37,41,24,25,77,68,68,73,41,77,39,33,29,39,39,22,25,69,1,
+174,2,14,80,158,80,1,62,254,248,121,39,39,128,1,1,253,242,253,24,154,246,
+246,154,92,5,184,153,245,92,153,153,92,245,250,225,92,92,5,184,92,92,253,
+205,246,253,113,92,92,2,61,245,245,245,3,133,246,82,246,2,62,246,1,225,92,
+92,250,72,92,92,5,184,92,92,0,19,0,102,0,0,6,123,6,20,0,32,0,43,0,49,0,55,
+0,61,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,
+0,135,0,0,1,20,6,35,34,39,53,22,51,50,53,52,38,39,38,38,53,52,54,51,50,23,
+7,38,35,34,6,21,20,22,23,22,22,1,51,19,22,23,54,54,19,51,3,35,5,51,53,51,
+21,35,33,53,51,21,51,21,3,21,35,53,51,21,5,53,35,53,51,21,1,53,51,21,3,53,
+51,21,1,51,21,35,1,53,51,21,1,51,21,35,37,51,21,35,1,51,21,35,21,51,21,35,
+1,51,21,35,1,53,51,21,3,53,51,21,1,53,51,21,3,3,35,22,21,21,35,17,51,19,51,
+19,51,17,35,53,52,55,35,3,5,84,117,102,103,57,83,81,123,55,76,74,74,107,86,
+91,71,29,71,64,47,50,52,67,80,78,251,217,90,107,49,10,11,50,105,90,211,90,
+3,133,154,92,246,250,225,93,153,153,93,246,4,195,154,246,251,51,246,246,246,
+253,194,93,93,2,144,246,2,51,92,92,250,71,93,93,5,185,92,92,92,92,250,71,
+93,93,3,215,246,246,246,253,195,246,160,193,4,8,86,138,170,4,172,135,92,8,
+4,193,1,80,78,84,35,88,43,74,37,41,24,25,77,68,68,73,41,77,39,33,29,39,39,
+22,25,69,1,59,254,248,121,39,39,128,1,1,253,242,103,154,246,246,154,92,5,
+184,153,245,92,153,153,92,245,250,225,92,92,5,184,92,92,253,205,246,253,113,
+92,92,2,61,245,245,245,3,133,246,82,246,2,62,246,1,225,92,92,250,72,92,92,
+5,184,92,92,253,140,1,186,62,135,245,2,14,254,119,1,137,253,242,251,121,70,
+254,70,0,0,1,0,123,255,53,3,203,4,227,0,23,0,0,5,0,18,53,52,38,35,34,6,21,
+20,23,7,36,17,52,54,51,50,18,21,20,2,3,1,82,1,10,207,139,133,117,139,209,
+82,254,225,229,187,203,229,217,219,203,1,93,1,162,179,160,184,145,137,192,
+99,141,137,1,39,205,241,254,236,232,204,254,57,254,225,0,0,2,0,123,255,53,
+5,23,4,227,0,11,0,35,0,0,1,54,17,16,39,51,22,22,21,20,6,7,1,0,18,53,52,38,
+35,34,6,21,20,23,7,36,17,52,54,51,50,18,21,20,2,3,3,225,150,150,172,62,76,
+76,62,252,197,1,10,207,139,133,117,139,209,82,254,225,229,187,203,229,217,
+219,1,53,176,1,13,1,12,176,78,229,137,138,229,78,254,0,1,93,1,162,179,160,
+184,145,137,192,99,141,137,1,39,205,241,254,236,232,204,254,57,254,225,0,
+0,1,0,123,1,70,6,41,4,150,0,23,0,0,19,4,4,51,50,54,53,52,38,35,34,7,39,18,
+33,50,22,21,20,4,35,34,36,37,123,1,74,1,177,183,160,184,145,138,190,100,142,
+138,1,38,204,243,254,241,237,205,254,58,254,225,3,190,253,220,140,133,116,
+140,209,82,1,31,230,186,198,234,217,219,0,2,0,123,254,92,4,197,5,174,0,48,
+0,70,0,0,1,38,53,52,54,51,50,22,21,20,6,7,22,21,20,2,3,35,18,18,53,52,38,
+35,34,6,21,20,23,7,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,21,20,22,23,
+5,54,54,53,52,38,39,51,22,22,21,20,6,7,22,21,20,7,35,54,53,52,1,18,151,208,
+167,182,209,84,67,151,160,215,197,227,185,119,112,99,116,147,102,205,212,
+163,52,46,71,62,119,112,99,116,43,47,2,26,76,74,74,76,172,62,76,76,62,138,
+138,172,150,3,16,118,163,179,210,236,202,89,189,67,123,247,136,254,190,254,
+249,1,6,1,75,128,133,150,111,111,153,76,131,117,243,181,205,11,60,134,85,
+127,147,114,111,41,88,33,246,72,168,115,121,186,80,66,198,123,117,168,70,
+154,200,235,160,151,244,217,0,0,2,0,123,254,20,4,115,6,20,0,73,0,105,0,0,
+19,38,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,21,20,6,7,22,21,20,6,7,22,21,20,6,7,35,62,2,53,52,38,35,34,6,21,
+20,23,7,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,21,20,23,1,54,54,53,52,
+39,51,22,21,20,6,7,22,21,20,6,7,22,21,20,6,7,35,54,54,53,52,39,54,54,53,52,
+227,53,51,186,148,35,32,65,58,98,92,78,96,63,119,104,187,147,159,191,71,61,
+132,69,58,127,137,156,197,128,144,58,98,92,78,96,127,82,205,186,148,37,33,
+66,54,98,92,78,96,63,1,227,76,74,150,172,138,76,62,138,76,62,138,76,62,172,
+76,74,150,76,74,1,164,49,117,57,152,176,5,49,113,72,90,103,84,80,71,52,100,
+96,127,152,175,189,167,77,156,60,98,195,76,154,59,95,189,119,250,164,135,
+187,135,76,88,94,86,78,102,57,140,92,207,152,176,5,51,112,69,91,102,84,80,
+71,52,1,127,60,137,96,180,113,118,175,98,140,55,118,175,98,139,56,118,174,
+111,158,65,67,158,109,180,112,60,137,96,181,0,0,2,0,100,255,236,4,47,5,205,
+0,11,0,23,0,0,1,16,2,35,34,2,17,16,18,51,50,18,1,16,18,51,50,18,17,16,2,35,
+34,2,4,47,241,246,236,248,239,245,245,242,252,234,137,166,166,139,139,166,
+166,137,2,221,254,128,254,143,1,126,1,115,1,124,1,116,254,117,254,155,254,
+209,254,215,1,39,1,49,1,45,1,41,254,215,0,1,0,61,255,236,5,127,5,182,0,30,
+0,0,33,3,38,39,6,7,3,14,2,35,34,38,53,52,54,55,51,6,6,21,20,22,51,50,54,54,
+55,19,51,1,4,201,242,16,41,39,19,112,42,102,143,111,145,152,35,41,182,45,
+36,67,53,58,73,66,33,217,233,1,113,3,221,62,252,242,72,254,12,189,218,102,
+170,157,103,157,86,86,157,103,86,88,80,176,143,3,162,250,74,0,0,1,0,102,255,
+236,3,223,5,182,0,26,0,0,1,6,6,21,20,22,51,50,54,53,52,0,39,51,22,18,18,21,
+20,2,35,34,2,53,52,18,55,2,6,135,104,149,117,119,151,254,242,191,219,113,
+214,91,234,212,215,228,162,158,3,162,99,199,145,168,186,186,168,237,2,3,223,
+138,254,141,254,219,173,240,254,245,1,17,234,191,1,10,107,0,0,1,0,61,255,
+236,4,59,5,203,0,37,0,0,1,51,21,55,51,50,22,21,20,6,35,32,0,17,16,0,33,50,
+22,23,21,38,35,34,2,17,16,18,51,50,54,53,52,38,35,35,21,35,1,229,177,13,7,
+195,206,245,228,254,246,254,229,1,84,1,74,78,156,49,115,164,251,242,198,170,
+129,162,108,111,20,177,4,23,173,3,221,210,237,229,1,118,1,82,1,129,1,150,
+27,24,168,65,254,197,254,190,254,244,254,221,148,165,148,137,244,0,0,1,0,
+100,0,0,4,133,5,203,0,26,0,0,33,18,18,53,52,38,35,34,2,21,20,18,23,35,38,
+2,53,16,0,51,50,18,17,16,3,33,21,2,123,164,121,163,149,156,176,76,86,176,
+80,82,1,14,238,235,253,235,1,40,1,60,1,126,195,209,227,254,252,238,204,254,
+112,227,197,1,170,208,1,45,1,95,254,197,254,237,254,171,254,124,164,0,0,1,
+0,100,0,0,6,174,5,203,0,45,0,0,33,18,18,53,52,2,35,34,2,21,20,18,23,35,38,
+2,53,16,18,51,50,23,54,51,50,18,17,20,2,7,33,21,33,18,18,53,52,38,35,34,7,
+22,21,20,2,7,2,184,103,59,150,141,136,155,76,86,176,80,82,253,214,191,121,
+102,201,224,243,108,126,1,39,253,246,164,121,154,137,142,75,69,79,83,1,76,
+1,62,181,233,1,9,254,248,234,204,254,112,227,197,1,170,208,1,49,1,91,131,
+131,254,197,254,237,174,254,181,224,164,1,60,1,126,195,209,227,110,158,230,
+200,254,127,246,0,1,0,100,255,236,4,47,5,205,0,33,0,0,1,6,35,34,38,53,16,
+0,51,50,18,17,16,0,33,34,39,53,22,51,50,18,17,16,2,35,34,6,21,20,22,51,50,
+55,2,61,45,65,170,193,1,0,219,250,246,254,193,254,180,117,82,86,113,250,219,
+146,168,153,141,94,92,61,45,2,51,22,190,207,1,20,1,15,254,151,254,183,254,
+108,254,101,28,162,37,1,70,1,80,1,12,1,12,180,213,129,115,21,0,1,0,102,0,
+0,3,229,5,203,0,29,0,0,1,54,53,52,38,35,34,6,21,20,0,23,35,38,2,38,38,53,
+52,18,51,50,22,21,20,6,7,51,21,33,2,106,183,139,113,127,143,1,2,202,219,71,
+182,118,47,233,214,215,215,86,86,190,254,133,2,147,172,226,131,141,186,168,
+231,254,10,242,88,1,31,255,226,119,237,1,15,230,196,92,189,76,163,0,0,1,0,
+82,0,0,4,29,5,182,0,14,0,0,1,6,17,33,18,18,19,51,2,2,3,33,52,54,55,4,29,62,
+252,115,30,206,239,205,241,227,18,2,37,33,29,2,88,230,254,142,1,175,2,134,
+1,129,254,138,253,155,254,201,110,236,90,0,0,1,0,86,255,236,4,188,5,203,0,
+41,0,0,1,20,2,35,32,17,53,52,38,35,34,6,21,16,23,35,38,17,52,54,51,50,22,
+21,21,20,22,51,50,54,53,16,0,33,34,7,53,54,54,51,32,0,4,188,200,189,254,209,
+57,60,61,76,113,184,109,166,151,150,143,72,55,92,117,254,220,254,229,144,
+94,43,133,66,1,105,1,134,1,252,247,254,231,1,88,225,98,72,115,135,254,228,
+185,193,1,20,207,196,170,153,225,105,86,197,178,1,148,1,161,57,160,24,27,
+254,8,0,255,255,0,147,2,182,7,170,3,203,0,35,0,128,254,127,0,0,0,35,0,128,
+0,135,0,0,0,35,0,128,2,143,0,0,0,3,0,128,4,152,0,0,255,255,0,147,1,28,4,20,
+5,101,0,35,0,128,1,2,0,0,0,35,0,128,254,127,0,0,0,35,0,128,255,193,1,154,
+0,3,0,128,255,193,254,102,255,255,2,20,2,182,5,26,3,203,0,34,0,128,0,0,0,
+3,0,128,2,8,0,0,0,1,0,0,253,227,2,117,3,141,0,27,0,0,19,50,22,21,20,6,7,14,
+2,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,35,53,156,235,238,117,156,55,
+59,23,43,168,39,88,107,86,97,36,152,163,154,3,141,211,196,113,251,201,71,
+104,81,64,79,79,68,90,98,200,142,113,157,108,67,123,120,164,0,1,0,205,253,
+227,3,102,3,141,0,26,0,0,19,51,50,22,21,20,2,7,14,2,21,20,23,35,38,53,52,
+54,55,54,54,53,52,38,35,35,242,155,236,237,126,146,55,59,23,43,168,39,90,
+105,121,98,152,164,190,3,141,211,196,121,254,255,187,71,104,81,64,83,75,65,
+93,102,200,138,160,189,96,123,120,0,255,255,0,205,253,227,3,102,3,141,2,2,
+3,165,0,0,255,255,0,20,0,82,7,25,5,57,2,2,0,173,0,0,255,255,0,20,0,82,9,133,
+5,57,2,2,0,184,0,0,255,255,0,0,254,178,4,201,3,141,2,34,0,60,0,0,0,34,0,14,
+207,0,0,3,0,14,2,18,0,0,255,255,0,0,0,197,4,201,3,141,2,2,0,60,0,0,255,255,
+0,0,254,178,4,201,3,141,2,34,0,60,0,0,0,34,0,14,207,0,0,3,0,14,2,18,0,0,255,
+255,0,0,254,110,4,242,5,84,2,34,0,41,0,0,0,35,0,14,1,100,0,45,0,3,0,14,3,
+37,255,188,255,255,255,252,0,86,3,164,5,209,0,2,0,107,160,0,0,2,0,0,255,119,
+7,47,3,141,0,20,0,30,0,0,17,33,21,33,18,19,7,2,3,33,22,21,20,6,35,34,38,53,
+52,55,35,5,52,39,33,6,21,16,51,50,54,7,47,253,129,117,225,149,238,117,254,
+238,45,212,194,186,217,41,41,2,135,41,254,109,41,241,113,131,3,141,164,254,
+104,254,112,74,1,185,1,185,100,135,196,232,215,213,139,96,231,137,94,94,137,
+254,250,131,255,255,0,0,0,82,4,211,3,141,2,2,0,5,0,0,255,255,0,0,255,119,
+7,47,3,141,2,2,3,174,0,0,255,255,0,0,0,82,4,211,3,141,2,2,0,5,0,0,255,255,
+0,0,0,197,2,131,3,141,2,2,5,228,0,0,255,255,0,0,254,178,2,131,3,141,2,34,
+5,228,0,0,0,2,0,14,207,0,255,255,0,92,0,86,5,74,5,209,0,2,2,103,0,0,255,255,
+0,92,254,110,5,74,5,209,0,35,0,14,0,236,255,188,0,35,0,14,2,164,255,188,0,
+2,2,103,0,0,255,255,0,92,0,143,3,156,5,2,2,2,2,104,0,0,255,255,0,92,254,65,
+6,139,5,209,2,34,0,79,0,0,0,35,0,14,1,43,0,45,0,3,0,14,2,147,255,143,255,
+255,255,252,0,86,3,164,5,209,0,2,0,107,160,0,255,255,0,0,254,178,4,201,3,
+141,2,34,0,60,0,0,0,34,0,14,207,0,0,3,0,14,2,18,0,0,255,255,0,92,254,110,
+6,184,6,20,2,34,0,22,0,0,0,35,0,14,0,190,255,188,0,3,0,14,2,119,255,188,255,
+255,0,92,0,86,5,74,5,209,0,2,2,103,0,0,0,1,0,0,253,227,4,252,3,141,0,31,0,
+0,1,50,22,21,20,6,7,6,6,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,33,18,
+19,7,2,3,53,3,35,235,238,113,159,81,57,43,168,39,88,107,86,96,37,151,164,
+253,129,117,225,150,241,113,3,141,211,196,111,245,209,105,128,87,79,79,68,
+90,98,200,142,111,156,111,67,123,120,254,104,254,112,74,1,195,1,175,164,0,
+255,255,0,0,254,190,5,37,3,141,2,2,0,33,0,0,0,2,0,0,0,82,7,25,3,141,0,18,
+0,28,0,0,1,33,22,21,20,6,35,34,38,53,52,55,35,53,33,21,33,3,35,1,52,39,33,
+6,21,16,51,50,54,4,150,254,102,45,212,194,186,217,41,41,7,25,254,81,38,136,
+253,203,41,254,109,41,241,113,131,2,233,100,135,196,232,215,213,139,96,164,
+164,253,220,1,61,137,94,94,137,254,250,131,255,255,0,20,253,227,6,59,5,57,
+2,2,0,90,0,0,255,255,0,20,0,86,7,150,5,137,2,2,0,169,0,0,255,255,0,20,0,82,
+9,133,5,57,2,2,0,184,0,0,255,255,0,92,0,33,5,199,6,14,0,35,0,208,1,193,5,
+215,0,2,0,39,0,0,255,255,0,92,0,33,5,199,6,14,0,35,0,208,1,193,5,215,0,2,
+0,39,0,0,255,255,0,0,0,33,4,123,6,14,2,34,0,25,0,0,0,3,0,208,0,117,5,215,
+255,255,0,0,0,33,4,123,6,14,0,34,0,25,0,0,0,3,0,208,0,117,5,215,255,255,0,
+61,255,63,3,188,6,14,2,34,3,87,0,0,0,3,0,208,0,100,5,215,255,255,0,92,255,
+119,3,156,6,14,0,34,1,149,0,0,0,3,0,208,0,80,5,215,255,255,0,0,255,63,3,31,
+6,14,2,34,3,86,0,0,0,3,0,208,255,199,5,215,255,255,0,0,255,63,3,31,6,14,0,
+34,3,86,0,0,0,3,0,208,255,199,5,215,255,255,0,20,0,86,7,150,5,137,2,2,0,169,
+0,0,0,1,0,92,255,119,5,240,3,141,0,14,0,0,1,18,19,7,2,3,33,18,19,7,38,2,3,
+33,21,3,113,117,225,150,239,115,254,78,117,225,150,133,205,47,5,148,2,233,
+254,104,254,112,74,1,188,1,182,254,104,254,112,74,254,2,0,1,24,164,255,255,
+0,20,255,119,6,193,5,57,2,2,0,59,0,0,255,255,0,0,255,119,3,33,3,141,2,2,0,
+9,0,0,255,255,0,0,255,119,4,223,3,141,2,2,0,10,0,0,0,1,0,0,255,119,5,117,
+3,141,0,14,0,0,1,18,19,7,2,3,33,18,19,7,2,3,53,33,21,2,246,117,225,150,241,
+113,254,78,117,225,150,241,113,5,117,2,233,254,104,254,112,74,1,195,1,175,
+254,104,254,112,74,1,195,1,175,164,164,0,255,255,255,252,0,86,3,166,5,209,
+2,2,0,58,0,0,255,255,0,0,1,76,1,164,3,141,2,2,0,27,0,0,0,1,255,252,253,227,
+4,154,5,209,0,35,0,0,55,2,17,16,0,33,32,0,17,20,6,2,7,6,6,21,20,23,35,38,
+53,52,54,55,54,18,53,52,2,35,34,6,21,20,22,23,193,197,1,58,1,16,1,21,1,63,
+59,145,128,89,61,43,168,39,85,110,159,132,237,199,195,229,82,94,213,1,55,
+1,54,1,47,1,96,254,142,254,188,165,246,254,242,169,117,144,87,69,69,57,81,
+117,188,145,205,1,77,210,248,1,20,240,245,141,246,146,0,3,255,252,253,227,
+4,154,5,209,0,37,0,43,0,49,0,0,19,38,53,16,0,33,32,0,17,20,6,2,7,6,6,21,20,
+22,23,35,38,53,52,54,55,62,2,53,52,2,35,34,6,21,20,22,23,5,6,7,39,54,55,1,
+6,7,39,54,55,90,94,1,58,1,16,1,19,1,65,64,153,136,97,73,25,18,168,38,96,129,
+115,129,57,233,203,195,229,37,49,2,65,181,103,88,124,123,254,205,177,108,
+88,125,123,1,137,224,217,1,47,1,96,254,133,254,176,150,237,254,242,172,121,
+156,92,29,65,23,53,64,124,203,158,144,222,204,143,252,1,37,240,245,89,167,
+117,82,126,112,80,176,123,254,223,123,114,80,174,125,255,255,0,92,254,110,
+5,78,5,84,0,35,0,14,1,193,0,45,0,35,0,14,3,129,255,188,0,2,0,41,92,0,255,
+255,0,0,254,110,4,242,5,84,0,35,0,14,1,100,0,45,0,35,0,14,3,37,255,188,0,
+2,0,41,0,0,255,255,0,0,0,197,4,201,3,141,2,2,0,60,0,0,255,255,0,0,254,178,
+4,201,3,141,0,34,0,14,207,0,0,35,0,14,2,18,0,0,0,2,0,60,0,0,255,255,0,92,
+0,86,4,4,5,209,0,2,0,107,0,0,255,255,0,92,0,197,6,139,5,209,2,2,0,79,0,0,
+255,255,0,92,253,227,7,207,5,209,2,2,1,138,0,0,255,255,255,250,0,86,5,146,
+5,209,0,2,0,96,158,0,255,255,0,92,0,86,5,244,5,209,2,2,0,96,0,0,255,255,255,
+250,253,227,7,109,5,209,0,2,1,138,158,0,255,255,0,92,255,119,8,31,6,20,2,
+2,1,142,0,0,255,255,0,92,255,119,6,184,6,20,2,2,0,22,0,0,255,255,255,250,
+255,119,6,86,6,20,0,2,0,22,158,0,255,255,255,250,255,119,7,189,6,20,0,2,1,
+142,158,0,255,255,0,92,0,82,5,162,6,20,2,2,0,94,0,0,255,255,0,92,0,82,7,82,
+6,20,2,2,0,95,0,0,255,255,255,252,0,82,6,242,6,20,0,2,0,95,160,0,255,255,
+255,252,0,82,5,66,6,20,0,2,0,94,160,0,255,255,0,92,255,119,9,174,6,20,2,2,
+0,105,0,0,255,255,255,252,255,119,9,78,6,20,0,2,0,105,160,0,255,255,0,92,
+255,119,8,31,6,20,2,2,1,142,0,0,255,255,0,92,255,119,6,184,6,20,2,2,0,22,
+0,0,255,255,255,250,255,119,6,86,6,20,0,2,0,22,158,0,255,255,255,250,255,
+119,7,189,6,20,0,2,1,142,158,0,0,1,0,92,254,244,6,150,3,141,0,31,0,0,1,51,
+50,22,21,20,7,35,54,53,52,38,35,35,22,23,7,0,3,33,32,17,20,7,35,54,53,52,
+38,35,33,22,1,104,238,197,221,33,162,31,121,139,172,90,131,149,254,195,83,
+4,211,1,103,52,151,45,92,109,251,234,34,1,201,224,184,100,82,63,97,129,137,
+246,244,71,2,122,2,31,254,174,129,110,108,131,84,90,152,0,255,255,0,92,254,
+244,5,47,3,141,0,2,0,29,0,0,255,255,0,0,254,244,4,182,3,141,2,2,0,31,0,0,
+0,1,0,0,254,244,6,29,3,141,0,32,0,0,19,22,23,51,50,22,21,20,7,35,54,53,52,
+38,35,35,22,19,7,2,3,53,33,32,17,20,7,35,54,53,52,38,35,160,36,44,237,197,
+221,33,162,31,121,139,172,85,136,149,253,118,4,182,1,103,52,151,45,92,109,
+2,233,159,129,224,184,100,82,63,97,129,137,233,254,255,71,1,247,1,254,164,
+254,174,129,110,108,131,84,90,0,1,0,92,255,135,4,31,6,35,0,33,0,0,19,33,53,
+52,38,35,34,7,53,54,51,50,22,17,21,33,21,33,20,18,22,51,50,55,21,6,6,35,34,
+38,38,2,39,33,92,1,86,75,85,79,41,43,94,163,140,1,205,254,51,68,111,79,113,
+57,23,90,57,98,138,100,75,7,254,170,3,141,176,185,131,37,174,33,229,254,255,
+176,164,164,254,160,180,86,186,33,37,90,193,1,103,224,255,255,0,20,255,135,
+4,102,6,35,0,2,3,89,0,0,255,255,0,0,255,135,4,143,6,35,2,2,3,91,0,0,255,255,
+0,0,255,135,3,195,6,35,0,2,3,240,164,0,255,255,0,92,255,119,3,156,6,14,2,
+34,1,149,0,0,0,3,0,208,0,80,5,215,255,255,0,92,255,119,3,156,6,14,0,34,1,
+149,0,0,0,3,0,208,0,80,5,215,255,255,0,0,0,10,4,123,6,14,2,34,0,101,0,0,0,
+3,0,208,0,117,5,215,255,255,0,0,0,10,4,123,6,14,0,34,0,101,0,0,0,3,0,208,
+0,117,5,215,0,3,0,92,0,127,4,78,5,244,0,14,0,26,0,40,0,0,19,52,54,51,50,22,
+22,21,20,6,6,35,34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,1,54,18,53,52,
+2,39,55,22,18,21,20,2,7,92,185,139,87,152,86,84,153,88,87,152,85,144,104,
+76,71,111,106,76,76,104,1,102,160,184,186,158,45,215,248,249,214,3,57,134,
+192,87,152,87,86,149,88,86,152,85,75,105,105,75,76,107,107,253,129,60,1,40,
+207,209,1,38,61,135,69,254,130,248,249,254,132,69,0,2,0,92,1,123,4,0,4,250,
+0,11,0,23,0,0,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,92,244,221,223,244,244,223,221,244,160,162,143,145,162,162,145,
+143,162,3,57,213,236,236,213,211,235,235,211,135,147,147,135,136,149,149,
+0,0,3,0,92,1,184,5,246,4,188,0,20,0,32,0,44,0,0,19,52,54,51,50,22,23,54,51,
+50,22,21,20,6,35,34,39,6,35,34,38,37,20,22,51,50,54,53,52,38,35,34,6,5,20,
+22,51,50,54,53,52,38,35,34,6,92,212,183,103,166,53,107,214,183,213,215,181,
+209,112,112,210,181,214,3,27,133,110,111,133,133,111,110,133,253,125,133,
+110,111,133,133,111,110,133,3,57,169,218,74,73,147,217,170,168,217,147,147,
+218,167,104,127,127,104,105,129,129,105,104,127,127,104,105,129,129,0,0,3,
+0,92,0,131,5,6,5,244,0,9,0,22,0,35,0,0,55,17,51,1,1,51,17,35,1,1,3,22,21,
+17,20,7,51,54,54,19,39,38,39,1,51,38,53,17,52,55,35,6,6,3,23,22,92,150,1,
+190,1,193,149,149,254,63,254,66,11,11,11,9,34,105,219,195,120,43,3,131,8,
+10,10,8,35,115,209,195,104,131,5,113,253,188,2,68,250,143,2,66,253,190,4,
+154,136,137,254,94,136,136,55,143,1,27,252,159,71,252,61,155,117,1,162,118,
+155,55,157,254,242,252,137,0,255,255,0,0,255,119,3,33,3,141,2,2,0,9,0,0,255,
+255,0,0,1,76,1,164,3,141,2,2,0,27,0,0,255,255,0,92,253,227,7,207,5,209,2,
+2,1,138,0,0,255,255,0,92,0,86,5,244,5,209,2,2,0,96,0,0,255,255,255,250,0,
+86,5,146,5,209,0,2,0,96,158,0,255,255,255,250,253,227,7,109,5,209,0,2,1,138,
+158,0,255,255,0,92,255,119,8,31,6,20,2,2,1,142,0,0,255,255,0,92,255,119,6,
+184,6,20,2,2,0,22,0,0,255,255,255,250,255,119,6,86,6,20,0,2,0,22,158,0,255,
+255,255,250,255,119,7,189,6,20,0,2,1,142,158,0,255,255,0,92,0,82,5,162,6,
+20,2,2,0,94,0,0,255,255,0,92,0,82,7,82,6,20,2,2,0,95,0,0,255,255,255,252,
+0,82,6,242,6,20,0,2,0,95,160,0,255,255,255,252,0,82,5,66,6,20,0,2,0,94,160,
+0,255,255,0,92,0,82,5,162,6,20,2,2,0,94,0,0,255,255,0,92,0,82,7,82,6,20,2,
+2,0,95,0,0,255,255,0,92,0,82,8,184,6,20,2,2,0,190,0,0,255,255,255,252,0,82,
+6,242,6,20,0,2,0,95,160,0,255,255,255,252,0,82,5,66,6,20,0,2,0,94,160,0,255,
+255,0,92,255,119,9,174,6,20,2,2,0,105,0,0,255,255,255,252,255,119,9,78,6,
+20,0,2,0,105,160,0,255,255,255,252,0,82,8,88,6,20,0,2,0,190,160,0,255,255,
+0,92,0,18,6,84,5,209,2,2,2,128,0,0,255,255,0,92,0,18,7,139,5,209,2,2,2,129,
+0,0,255,255,255,250,0,18,7,41,5,209,0,2,2,129,158,0,255,255,255,250,0,18,
+5,242,5,209,0,2,2,128,158,0,255,255,0,92,0,18,9,109,5,209,2,2,2,135,0,0,255,
+255,255,250,0,18,7,164,5,209,0,2,2,132,158,0,255,255,255,250,0,18,9,11,5,
+209,0,2,2,135,158,0,255,255,0,92,0,18,8,6,5,209,2,2,2,132,0,0,255,255,0,92,
+0,72,5,162,6,20,2,2,2,67,0,0,255,255,0,92,0,72,7,82,6,20,2,2,2,68,0,0,255,
+255,0,0,0,72,6,246,6,20,0,2,2,68,164,0,255,255,0,0,0,72,5,70,6,20,0,2,2,67,
+164,0,0,2,0,92,255,8,5,162,6,20,0,34,0,44,0,0,37,38,2,53,52,18,36,51,50,4,
+18,17,20,2,7,22,23,7,38,39,34,38,53,52,54,55,33,2,33,34,0,17,20,18,23,1,52,
+39,33,6,21,16,51,50,54,1,43,100,107,164,1,43,193,218,1,53,167,133,107,72,
+74,146,96,68,184,221,43,35,2,34,86,254,89,228,254,246,92,103,3,63,4,254,63,
+32,233,111,141,86,188,1,132,174,214,1,72,178,209,254,87,254,211,189,255,0,
+55,157,130,82,176,154,244,237,92,189,65,1,221,254,214,254,253,141,254,166,
+192,1,215,64,60,71,111,254,201,184,0,2,0,92,255,8,7,82,6,20,0,38,0,48,0,0,
+37,38,2,53,52,18,36,51,32,0,19,33,21,33,22,21,20,2,7,22,23,7,38,39,34,38,
+53,52,54,55,33,2,33,34,0,17,20,18,23,1,52,39,33,6,21,16,51,50,54,1,43,100,
+107,164,1,43,193,1,21,1,84,54,1,199,254,76,4,133,107,72,74,146,96,68,184,
+221,43,35,2,34,86,254,89,228,254,246,92,103,3,63,4,254,63,32,233,111,141,
+86,188,1,132,174,214,1,72,178,254,181,254,196,164,60,64,189,255,0,55,157,
+130,82,176,154,244,237,92,189,65,1,221,254,214,254,253,141,254,166,192,1,
+215,64,60,71,111,254,201,184,255,255,255,252,255,8,6,242,6,20,0,2,4,31,160,
+0,255,255,255,252,255,8,5,66,6,20,0,2,4,30,160,0,255,255,0,92,255,119,8,31,
+6,20,2,2,1,142,0,0,255,255,0,92,255,119,6,184,6,20,2,2,0,22,0,0,255,255,255,
+250,255,119,6,86,6,20,0,2,0,22,158,0,255,255,255,250,255,119,7,189,6,20,0,
+2,1,142,158,0,0,3,0,92,0,59,5,250,3,141,0,9,0,25,0,32,0,0,1,52,39,33,6,21,
+16,51,50,54,3,34,38,53,52,54,55,33,21,2,3,35,38,39,6,6,37,54,18,55,33,22,
+18,2,227,41,254,109,41,242,112,131,243,187,217,45,47,5,66,196,117,211,79,
+67,47,190,1,219,43,129,67,254,31,23,126,2,2,137,94,84,124,254,227,131,254,
+211,225,225,117,180,80,164,254,205,254,133,104,138,111,108,127,131,1,34,115,
+98,254,216,0,2,0,92,0,59,3,174,3,141,0,7,0,14,0,0,1,21,2,3,35,38,2,39,1,54,
+18,55,33,22,18,3,174,196,117,211,144,169,13,1,162,44,133,63,254,43,16,119,
+3,141,164,254,205,254,133,201,1,191,202,253,68,134,1,42,104,110,254,229,0,
+2,0,0,0,59,3,223,3,141,0,9,0,16,0,0,17,33,21,35,2,3,35,38,2,39,1,54,18,55,
+33,22,18,3,223,162,196,117,211,114,169,22,1,141,57,129,54,254,43,16,119,3,
+141,164,254,205,254,133,158,1,129,143,253,232,167,1,23,90,110,254,229,0,0,
+2,0,92,0,59,4,80,3,141,0,8,0,15,0,0,1,21,35,2,3,35,38,2,39,1,54,18,55,33,
+22,18,4,80,162,196,117,211,144,169,13,1,162,44,133,63,254,43,16,119,3,141,
+164,254,205,254,133,201,1,191,202,253,68,134,1,42,104,110,254,229,0,2,0,0,
+0,59,3,61,3,141,0,8,0,15,0,0,17,33,21,2,3,35,38,2,39,1,54,18,55,33,22,18,
+3,61,196,117,211,114,169,22,1,141,57,129,54,254,43,16,119,3,141,164,254,205,
+254,133,158,1,129,143,253,232,167,1,23,90,110,254,229,0,0,3,0,0,0,59,6,186,
+3,141,0,17,0,27,0,34,0,0,17,33,21,33,2,3,35,38,39,6,6,35,34,38,53,52,55,35,
+5,52,39,33,6,21,16,51,50,54,5,54,18,55,33,22,18,6,186,254,228,192,122,211,
+76,69,47,191,127,186,217,41,41,2,135,41,254,109,41,241,113,131,1,103,50,134,
+55,254,31,25,126,3,141,164,254,215,254,123,101,141,111,108,215,213,139,96,
+231,137,94,94,137,254,250,131,174,153,1,36,91,107,254,224,0,3,0,92,0,59,7,
+23,3,141,0,9,0,26,0,33,0,0,1,52,39,33,6,21,16,51,50,54,3,34,38,53,52,54,55,
+33,21,33,2,3,35,38,39,6,6,37,54,18,55,33,22,18,2,227,41,254,109,41,242,112,
+131,243,187,217,45,47,6,95,254,227,196,117,211,79,67,47,190,1,219,43,129,
+67,254,31,23,126,2,2,137,94,84,124,254,227,131,254,211,225,225,117,180,80,
+164,254,205,254,133,104,138,111,108,127,131,1,34,115,98,254,216,0,0,3,0,0,
+0,59,5,158,3,141,0,16,0,26,0,33,0,0,17,33,21,2,3,35,38,39,6,6,35,34,38,53,
+52,55,35,5,52,39,33,6,21,16,51,50,54,5,54,18,55,33,22,18,5,158,192,122,211,
+76,69,47,191,127,186,217,41,41,2,135,41,254,109,41,241,113,131,1,103,50,134,
+55,254,31,25,126,3,141,164,254,215,254,123,101,141,111,108,215,213,139,96,
+231,137,94,94,137,254,250,131,174,153,1,36,91,107,254,224,0,0,1,0,92,0,82,
+5,20,6,66,0,33,0,0,19,16,0,33,50,4,18,23,7,2,2,35,34,2,7,33,22,22,21,20,6,
+6,35,32,3,51,18,51,50,54,53,52,39,33,92,1,61,1,21,168,1,14,163,13,163,22,
+237,192,198,230,4,2,111,19,28,95,169,105,254,142,72,157,52,219,96,125,21,
+253,119,3,68,1,101,1,153,187,254,171,216,20,1,24,1,58,254,230,241,62,221,
+63,140,222,119,1,213,254,213,156,155,125,57,0,0,1,0,92,0,82,5,12,6,66,0,34,
+0,0,1,34,2,7,33,22,22,21,20,6,6,35,32,3,51,18,51,50,54,53,52,39,33,53,16,
+0,33,50,4,18,17,35,38,2,38,2,174,198,230,4,2,111,19,28,95,169,105,254,142,
+72,157,52,219,96,125,21,253,119,1,61,1,21,176,1,21,153,151,5,113,203,5,152,
+254,230,241,62,221,63,140,222,119,1,213,254,213,156,155,125,57,91,1,101,1,
+153,208,254,120,254,255,217,1,52,162,0,0,1,0,92,255,119,7,147,6,66,0,41,0,
+0,1,22,22,21,20,6,6,35,32,3,51,18,51,50,54,53,52,39,33,53,16,0,33,50,0,19,
+33,21,33,22,18,23,7,2,2,3,2,2,35,34,2,7,3,109,19,28,95,169,105,254,142,72,
+157,52,219,96,125,21,253,119,1,56,1,16,249,1,36,67,2,143,253,144,40,165,122,
+149,170,149,44,52,212,190,193,225,4,3,141,62,221,63,140,222,119,1,213,254,
+213,156,155,125,57,91,1,103,1,151,254,188,254,143,164,193,254,118,221,74,
+1,68,1,156,1,1,1,50,1,14,254,232,243,0,0,1,0,92,253,227,9,0,6,66,0,60,0,0,
+1,34,2,7,33,22,22,21,20,6,6,35,32,3,51,18,51,50,54,53,52,39,33,53,16,0,33,
+50,0,19,33,50,22,21,20,6,7,6,6,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,
+33,3,35,3,2,2,2,209,216,247,4,2,111,19,28,95,169,105,254,142,72,157,52,219,
+96,125,21,253,119,1,80,1,37,255,1,58,45,1,240,235,238,113,159,81,57,43,168,
+38,89,105,86,96,37,151,164,254,82,39,135,39,25,223,5,152,254,229,240,62,221,
+63,140,222,119,1,213,254,213,156,155,125,57,91,1,104,1,150,254,153,254,178,
+211,196,111,245,209,105,128,87,79,79,67,91,101,200,139,111,156,111,67,123,
+120,253,220,2,36,1,86,1,89,0,0,1,0,92,0,82,7,37,6,66,0,37,0,0,1,34,2,7,33,
+22,22,21,20,6,6,35,32,3,51,18,51,50,54,53,52,39,33,53,16,0,33,50,0,19,33,
+21,33,3,35,3,2,2,2,209,216,247,4,2,111,19,28,95,169,105,254,142,72,157,52,
+219,96,125,21,253,119,1,80,1,37,255,1,58,45,1,238,254,82,39,135,39,25,223,
+5,152,254,229,240,62,221,63,140,222,119,1,213,254,213,156,155,125,57,91,1,
+104,1,150,254,153,254,178,164,253,220,2,36,1,86,1,89,0,255,255,0,0,0,82,6,
+201,6,66,0,2,4,50,164,0,255,255,0,0,253,227,8,164,6,66,0,2,4,49,164,0,255,
+255,0,0,0,82,4,176,6,66,0,2,4,47,164,0,255,255,0,0,0,82,4,184,6,66,0,2,4,
+46,164,0,0,1,0,92,255,119,8,250,6,66,0,50,0,0,1,22,18,23,7,2,2,3,2,2,35,34,
+2,7,33,22,22,21,20,6,6,35,32,3,51,18,51,50,54,53,52,39,33,53,16,0,33,50,0,
+19,33,32,17,20,7,35,54,53,52,38,35,5,35,40,165,122,149,170,149,44,52,212,
+190,193,225,4,2,111,19,28,95,169,105,254,142,72,157,52,219,96,125,21,253,
+119,1,56,1,16,249,1,36,67,2,143,1,103,51,152,45,92,109,2,233,193,254,118,
+221,74,1,68,1,156,1,1,1,50,1,14,254,232,243,62,221,63,140,222,119,1,213,254,
+213,156,155,125,57,91,1,103,1,151,254,188,254,143,254,174,126,113,104,135,
+84,90,255,255,0,0,255,119,8,158,6,66,0,2,4,55,164,0,255,255,0,0,255,119,7,
+55,6,66,0,2,4,48,164,0,0,3,0,92,0,82,6,4,6,66,0,29,0,36,0,44,0,0,19,53,52,
+18,36,51,50,4,18,21,16,2,35,34,38,39,6,6,35,34,38,39,51,22,22,51,50,54,53,
+53,19,32,0,7,33,38,0,19,50,54,54,55,33,21,16,92,177,1,78,226,221,1,66,168,
+215,223,98,150,43,41,168,92,176,200,30,160,21,121,104,98,127,94,254,248,254,
+236,29,4,84,35,254,231,50,103,114,57,2,254,31,2,233,23,247,1,123,208,209,
+254,132,245,254,161,254,177,96,98,98,96,234,235,168,131,166,168,159,2,175,
+254,233,244,246,1,21,251,100,96,219,178,159,254,178,0,0,3,0,92,0,82,7,180,
+6,66,0,32,0,39,0,47,0,0,1,2,2,35,34,38,39,6,6,35,34,38,39,51,22,22,51,50,
+54,53,53,33,53,52,18,36,51,50,4,18,23,33,21,1,32,0,7,33,38,0,19,50,54,54,
+55,33,21,16,6,4,4,215,219,98,150,43,41,168,92,176,200,30,160,21,121,104,98,
+127,253,125,177,1,78,226,197,1,44,182,24,1,184,251,137,254,248,254,236,29,
+4,84,35,254,231,50,103,114,57,2,254,31,2,233,254,177,254,184,96,98,98,96,
+234,235,168,131,166,168,159,23,247,1,123,208,166,254,198,213,164,2,175,254,
+233,244,246,1,21,251,100,96,219,178,159,254,178,0,255,255,0,0,0,82,7,88,6,
+66,0,2,4,59,164,0,255,255,0,0,0,82,5,168,6,66,0,2,4,58,164,0,255,255,0,92,
+0,82,6,4,6,66,2,2,4,58,0,0,0,3,0,92,0,82,9,27,6,66,0,41,0,48,0,56,0,0,1,2,
+2,35,34,38,39,6,6,35,34,38,39,51,22,22,51,50,54,53,53,33,53,52,18,36,51,50,
+4,18,23,33,32,17,20,7,35,54,53,52,38,35,1,32,0,7,33,38,0,19,50,54,54,55,33,
+21,16,6,4,4,215,219,98,150,43,41,168,92,176,200,30,160,21,121,104,98,127,
+253,125,177,1,78,226,197,1,44,182,24,1,184,1,103,52,151,45,92,109,251,137,
+254,248,254,236,29,4,84,35,254,231,50,103,114,57,2,254,31,2,233,254,177,254,
+184,96,98,98,96,234,235,168,131,166,168,159,23,247,1,123,208,166,254,198,
+213,254,174,129,110,108,131,84,90,2,175,254,233,244,246,1,21,251,100,96,219,
+178,159,254,178,255,255,0,92,0,82,7,180,6,66,2,2,4,59,0,0,255,255,0,0,0,82,
+7,88,6,66,0,2,4,59,164,0,255,255,0,0,0,82,5,168,6,66,0,2,4,58,164,0,255,255,
+0,92,0,82,9,27,6,66,2,2,4,63,0,0,0,3,0,92,255,119,10,8,6,66,0,38,0,45,0,53,
+0,0,1,18,19,7,2,3,35,2,2,35,34,38,39,6,6,35,34,38,39,51,22,22,51,50,54,53,
+53,33,53,52,18,36,51,50,4,18,23,33,21,1,32,0,7,33,38,0,19,50,54,54,55,33,
+21,16,7,137,121,221,149,238,117,227,4,215,219,98,150,43,41,168,92,176,200,
+30,160,21,121,104,98,127,253,125,177,1,78,226,197,1,44,182,24,4,12,249,53,
+254,248,254,236,29,4,84,35,254,231,50,103,114,57,2,254,31,2,233,254,97,254,
+119,74,1,185,1,185,254,177,254,184,96,98,98,96,234,235,168,131,166,168,159,
+23,247,1,123,208,166,254,198,213,164,2,175,254,233,244,246,1,21,251,100,96,
+219,178,159,254,178,255,255,0,0,255,119,9,172,6,66,0,2,4,68,164,0,255,255,
+0,92,0,82,6,4,8,49,2,34,4,58,0,0,0,3,0,14,2,133,8,4,255,255,0,92,0,82,7,180,
+8,49,2,34,4,59,0,0,0,3,0,14,2,133,8,4,255,255,0,0,0,82,7,88,8,49,0,34,4,59,
+164,0,0,3,0,14,2,41,8,4,255,255,0,0,0,82,5,168,8,49,0,34,4,58,164,0,0,3,0,
+14,2,41,8,4,255,255,0,0,255,119,7,55,6,66,0,2,4,48,164,0,255,255,0,0,255,
+119,8,158,6,66,0,2,4,55,164,0,255,255,0,92,255,119,8,250,6,66,2,2,4,55,0,
+0,255,255,0,92,255,119,7,147,6,66,2,2,4,48,0,0,255,255,0,92,255,119,8,250,
+6,66,2,2,4,55,0,0,255,255,0,92,255,119,7,147,6,66,2,2,4,48,0,0,255,255,0,
+0,255,119,7,55,6,66,0,2,4,48,164,0,255,255,0,0,255,119,8,158,6,66,0,2,4,55,
+164,0,255,255,0,0,0,82,6,201,8,55,0,34,4,50,164,0,0,3,0,14,1,184,8,10,255,
+255,0,0,253,227,8,164,8,55,0,35,0,14,1,184,8,10,0,2,4,49,164,0,255,255,0,
+92,253,227,9,0,8,55,0,35,0,14,2,20,8,10,0,2,4,49,0,0,255,255,0,92,0,82,7,
+37,8,55,2,34,4,50,0,0,0,3,0,14,2,20,8,10,0,1,0,92,255,12,8,74,6,66,0,50,0,
+0,19,16,0,33,32,0,19,33,21,33,22,18,18,22,51,50,55,21,6,6,35,34,38,39,2,3,
+2,2,35,34,2,7,33,22,22,21,20,6,6,35,32,3,51,18,51,50,54,53,52,39,33,92,1,
+56,1,16,1,4,1,29,61,3,72,252,215,22,84,133,130,75,111,57,22,88,58,130,182,
+79,163,73,52,212,190,193,225,4,2,111,19,28,95,169,105,254,142,72,157,52,219,
+96,125,21,253,119,3,68,1,103,1,151,254,165,254,166,164,118,254,245,254,226,
+148,86,186,33,37,159,169,1,89,1,171,1,50,1,14,254,232,243,62,221,63,140,222,
+119,1,213,254,213,156,155,125,57,0,1,0,92,255,12,9,176,6,66,0,59,0,0,19,16,
+0,33,32,0,19,33,32,17,20,7,35,54,53,52,38,35,33,22,18,18,22,51,50,55,21,6,
+6,35,34,38,39,2,3,2,2,35,34,2,7,33,22,22,21,20,6,6,35,32,3,51,18,51,50,54,
+53,52,39,33,92,1,56,1,16,1,4,1,29,61,3,72,1,102,51,152,45,92,108,252,215,
+22,84,133,130,75,111,57,22,88,58,130,182,79,163,73,52,212,190,193,225,4,2,
+111,19,28,95,169,105,254,142,72,157,52,219,96,125,21,253,119,3,68,1,103,1,
+151,254,165,254,166,254,174,131,108,104,135,84,90,118,254,245,254,226,148,
+86,186,33,37,159,169,1,89,1,171,1,50,1,14,254,232,243,62,221,63,140,222,119,
+1,213,254,213,156,155,125,57,0,255,255,0,0,255,12,7,238,6,66,0,2,4,86,164,
+0,255,255,0,0,255,12,9,84,6,66,0,2,4,87,164,0,0,1,0,92,0,18,7,94,6,66,0,49,
+0,0,19,16,0,33,50,0,19,33,21,33,21,16,33,51,50,22,23,21,38,35,35,34,38,53,
+53,16,2,35,34,2,7,33,22,22,21,20,6,6,35,32,3,51,18,51,50,54,53,52,39,33,92,
+1,69,1,23,253,1,65,28,2,76,253,189,1,24,84,76,111,28,61,154,84,213,229,221,
+228,204,234,4,2,111,19,28,95,169,105,254,142,72,157,52,219,96,125,21,253,
+119,3,68,1,106,1,148,254,148,254,183,164,206,254,217,31,25,170,56,229,236,
+227,1,68,1,86,254,233,244,62,221,63,140,222,119,1,213,254,213,156,155,125,
+57,0,0,1,0,92,0,18,8,150,6,66,0,49,0,0,19,16,0,33,50,0,19,33,21,33,21,16,
+33,51,50,22,23,21,38,35,35,34,38,53,53,16,2,35,34,2,7,33,22,22,21,20,6,6,
+35,32,3,51,18,51,50,54,53,52,39,33,92,1,69,1,23,253,1,65,28,3,132,252,133,
+1,24,84,76,111,28,61,154,84,213,229,221,228,204,234,4,2,111,19,28,95,169,
+105,254,142,72,157,52,219,96,125,21,253,119,3,68,1,106,1,148,254,148,254,
+183,164,206,254,217,31,25,170,56,229,236,227,1,68,1,86,254,233,244,62,221,
+63,140,222,119,1,213,254,213,156,155,125,57,0,255,255,0,0,0,18,8,58,6,66,
+0,2,4,91,164,0,255,255,0,0,0,18,7,2,6,66,0,2,4,90,164,0,0,1,0,92,0,18,9,16,
+6,66,0,51,0,0,19,53,16,0,33,50,4,18,21,17,20,51,51,17,33,21,33,17,51,50,23,
+21,38,35,33,32,17,17,16,2,35,34,2,7,33,22,22,21,20,6,6,35,32,3,51,18,51,50,
+54,53,52,39,92,1,69,1,23,187,1,21,147,198,68,2,235,253,183,59,150,65,61,154,
+254,223,254,152,221,228,204,234,4,2,111,19,28,95,169,105,254,142,72,157,52,
+219,96,125,21,2,233,91,1,106,1,148,201,254,129,252,254,203,213,2,153,164,
+254,11,56,170,56,1,127,1,53,1,68,1,86,254,233,244,62,221,63,140,222,119,1,
+213,254,213,156,155,125,57,0,1,0,92,0,18,10,119,6,66,0,60,0,0,19,53,16,0,
+33,50,4,18,21,17,20,51,51,17,33,32,17,20,7,35,54,53,52,38,35,33,17,51,50,
+23,21,38,35,33,32,17,17,16,2,35,34,2,7,33,22,22,21,20,6,6,35,32,3,51,18,51,
+50,54,53,52,39,92,1,69,1,23,187,1,21,147,198,68,2,235,1,103,51,152,45,92,
+109,253,183,59,150,65,61,154,254,223,254,152,221,228,204,234,4,2,111,19,28,
+95,169,105,254,142,72,157,52,219,96,125,21,2,233,91,1,106,1,148,201,254,129,
+252,254,203,213,2,153,254,174,126,113,104,135,84,90,254,11,56,170,56,1,127,
+1,53,1,68,1,86,254,233,244,62,221,63,140,222,119,1,213,254,213,156,155,125,
+57,0,255,255,0,0,0,18,8,180,6,66,0,2,4,94,164,0,255,255,0,0,0,18,10,27,6,
+66,0,2,4,95,164,0,0,3,0,92,255,8,5,193,6,66,0,31,0,39,0,47,0,0,5,38,39,34,
+39,6,35,34,6,7,53,54,54,51,50,54,53,53,33,53,52,18,36,51,50,4,18,21,16,5,
+22,23,3,38,0,35,34,6,6,7,1,50,54,54,55,33,21,16,4,172,96,68,211,78,107,175,
+102,160,72,56,144,134,90,117,253,192,165,1,50,199,221,1,66,168,254,239,64,
+77,41,35,254,230,221,149,229,128,2,3,12,104,113,57,3,254,30,248,176,154,197,
+129,24,40,170,37,26,123,121,182,91,233,1,92,185,210,254,133,245,253,217,106,
+140,137,4,51,246,1,21,131,241,151,253,111,96,214,183,159,254,178,0,3,0,92,
+255,8,7,104,6,66,0,35,0,43,0,51,0,0,5,38,39,34,39,6,35,34,6,7,53,54,54,51,
+50,54,53,53,33,53,52,18,36,51,50,4,18,23,33,21,33,2,2,7,22,23,3,38,0,35,34,
+6,6,7,1,50,54,54,55,33,21,16,4,172,96,68,211,78,107,175,102,160,72,56,144,
+134,90,117,253,192,165,1,50,199,197,1,44,181,24,1,176,254,89,6,138,129,64,
+77,41,35,254,230,221,149,229,128,2,3,12,104,113,57,3,254,30,248,176,154,197,
+129,24,40,170,37,26,123,121,182,91,233,1,92,185,166,254,198,213,164,254,231,
+254,209,50,140,137,4,51,246,1,21,131,241,151,253,111,96,214,183,159,254,178,
+0,255,255,0,0,255,8,7,12,6,66,0,2,4,99,164,0,255,255,0,0,255,8,5,101,6,66,
+0,2,4,98,164,0,0,1,0,92,255,16,6,231,5,240,0,40,0,0,1,35,34,6,6,7,3,35,3,
+2,2,35,34,6,2,21,20,18,22,51,50,54,55,23,6,35,34,36,2,17,52,18,36,51,50,0,
+19,51,54,33,51,6,231,157,115,113,56,9,21,135,43,22,181,180,141,217,123,141,
+245,142,66,106,27,135,113,221,194,254,194,178,168,1,41,178,255,1,0,28,8,68,
+1,2,159,2,233,50,117,129,254,215,2,81,1,48,1,57,151,254,227,181,223,254,134,
+216,68,59,84,211,254,1,199,1,20,216,1,102,201,254,138,254,105,170,255,255,
+0,92,255,16,6,231,5,240,2,2,4,102,0,0,255,255,0,0,255,16,6,139,5,240,0,2,
+4,102,164,0,255,255,0,0,255,16,6,139,5,240,0,2,4,102,164,0,0,1,0,92,254,147,
+5,117,3,141,0,32,0,0,37,53,35,34,6,7,53,54,54,51,51,54,55,33,55,33,21,33,
+6,21,21,20,6,35,34,6,7,53,54,54,51,50,54,2,254,76,170,219,92,74,198,209,76,
+4,55,253,35,37,4,244,254,92,62,204,166,100,128,57,45,123,117,96,125,113,71,
+37,59,174,48,38,208,189,164,164,218,218,196,182,232,26,38,164,37,27,127,0,
+0,1,0,0,254,147,4,164,3,141,0,33,0,0,37,53,35,34,6,7,53,54,54,51,51,54,55,
+33,53,33,21,33,6,21,21,20,6,6,35,34,6,7,53,54,54,51,50,54,2,45,76,170,219,
+92,74,198,209,76,4,55,253,152,4,164,254,92,61,98,167,106,98,130,57,45,123,
+117,96,125,113,71,37,59,174,48,38,208,189,164,164,214,222,196,122,191,101,
+26,38,164,37,27,127,0,255,255,0,92,254,147,5,117,3,141,0,2,4,106,0,0,0,1,
+0,0,254,147,3,215,3,141,0,33,0,0,37,53,35,34,6,7,53,54,54,51,51,54,55,33,
+53,33,21,35,6,21,21,20,6,6,35,34,6,7,53,54,54,51,50,54,2,45,76,170,219,92,
+74,198,209,76,4,55,253,152,3,215,215,61,98,167,106,98,130,57,45,123,117,96,
+125,113,71,37,59,174,48,38,208,189,164,164,214,222,196,122,191,101,26,38,
+164,37,27,127,0,4,0,0,0,197,5,47,6,14,0,5,0,17,0,29,0,41,0,0,1,6,7,39,54,
+55,5,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,19,
+33,3,35,3,35,53,33,21,33,3,35,1,223,181,103,89,130,118,1,37,80,59,60,82,82,
+60,59,80,104,142,101,101,143,143,101,100,143,141,254,143,39,135,39,102,5,
+47,254,82,39,135,5,78,126,112,80,181,118,192,60,82,82,60,59,80,80,59,100,
+143,143,100,101,143,142,254,52,253,220,2,36,164,164,253,220,255,255,0,0,0,
+197,5,47,6,14,0,2,4,112,0,0,0,4,0,92,0,197,8,252,6,14,0,29,0,41,0,53,0,59,
+0,0,37,18,17,16,2,35,34,6,7,22,19,35,2,38,35,34,7,53,54,55,18,0,51,32,19,
+33,21,33,20,3,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,7,6,7,39,54,55,3,246,35,154,154,137,170,12,160,30,159,25,104,95,85,
+52,72,100,23,1,2,196,1,158,55,4,66,251,197,43,1,221,142,101,101,143,143,101,
+100,143,104,80,59,60,82,82,60,59,80,170,179,106,88,130,118,197,1,17,1,48,
+1,29,1,4,221,232,141,253,240,1,49,248,27,164,33,4,1,10,1,43,253,188,164,253,
+254,217,4,86,100,143,143,100,101,143,142,102,60,82,82,60,59,80,80,8,125,113,
+80,181,118,0,255,255,0,92,0,197,8,252,6,14,0,2,4,114,0,0,0,3,0,20,0,100,6,
+111,5,57,0,24,0,36,0,48,0,0,37,3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,
+33,33,21,33,34,6,6,7,3,37,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,
+21,20,6,35,34,38,1,207,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,2,
+226,253,32,116,112,56,9,20,1,39,80,59,60,82,82,60,59,80,105,144,100,100,144,
+144,100,100,144,152,2,231,154,129,52,150,61,198,228,172,170,164,51,121,124,
+254,215,192,59,82,82,59,59,80,80,59,100,144,144,100,100,144,144,0,0,3,0,0,
+0,100,4,197,3,141,0,6,0,18,0,30,0,0,17,53,33,21,33,3,35,37,20,22,51,50,54,
+53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,4,197,252,16,39,135,1,
+172,80,59,60,82,82,60,59,80,105,144,100,100,144,144,100,100,144,2,233,164,
+164,253,220,147,59,82,82,59,59,80,80,59,100,144,144,100,100,144,144,255,255,
+0,20,0,100,6,111,5,57,0,2,4,116,0,0,255,255,0,0,0,100,4,197,3,141,0,2,4,117,
+0,0,255,255,0,92,0,150,5,176,8,121,2,34,3,132,0,0,0,3,0,208,1,47,8,66,255,
+255,0,0,0,150,4,227,8,121,2,34,3,133,0,0,0,3,0,208,0,147,8,66,255,255,0,92,
+0,150,5,176,8,121,0,34,3,132,0,0,0,3,0,208,1,47,8,66,0,3,0,0,0,150,4,23,8,
+121,0,29,0,41,0,53,0,0,19,33,21,33,18,23,33,21,33,18,19,35,2,2,3,35,6,2,21,
+20,23,35,38,2,53,53,51,18,55,35,19,20,22,51,50,54,53,52,38,35,34,6,7,52,54,
+51,50,22,21,20,6,35,34,38,78,3,20,254,185,6,49,1,197,254,96,76,151,174,125,
+128,30,8,110,93,25,158,23,34,102,70,160,254,254,80,59,59,82,82,59,59,80,105,
+144,100,100,144,144,100,100,144,6,12,127,254,240,240,164,254,217,254,212,
+1,11,1,241,1,73,209,254,111,225,156,102,109,1,88,142,164,1,5,251,1,248,59,
+82,82,59,60,79,79,60,100,144,144,100,100,144,144,0,4,0,92,255,119,8,250,8,
+80,0,41,0,49,0,61,0,73,0,0,1,22,22,21,20,6,6,35,34,2,17,16,0,33,32,0,19,33,
+32,17,20,7,35,54,53,52,38,35,33,22,18,23,7,2,2,3,38,2,35,34,6,7,1,50,54,53,
+52,39,33,18,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,3,109,19,28,95,169,107,232,229,1,55,1,17,1,10,1,31,57,2,141,1,103,
+51,152,45,92,109,253,144,40,165,122,149,170,149,44,40,211,203,189,229,4,1,
+31,96,125,21,254,25,8,207,142,102,99,144,144,99,102,142,104,80,60,59,82,82,
+59,60,80,3,141,62,221,63,140,222,119,1,118,1,124,1,74,1,118,254,195,254,198,
+254,174,126,113,104,135,84,90,193,254,118,221,74,1,68,1,156,1,1,252,1,6,245,
+216,253,111,156,155,125,57,254,19,6,96,99,145,142,102,102,142,145,99,59,82,
+82,59,60,79,79,0,0,4,0,92,255,119,7,147,8,80,0,32,0,40,0,52,0,64,0,0,1,22,
+22,21,20,6,6,35,34,2,17,16,0,33,32,0,19,33,21,33,22,18,23,7,2,2,3,38,2,35,
+34,6,7,1,50,54,53,52,39,33,18,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,
+51,50,54,53,52,38,35,34,6,3,109,19,28,95,169,107,232,229,1,55,1,17,1,10,1,
+31,57,2,141,253,144,40,165,122,149,170,149,44,40,211,203,189,229,4,1,31,96,
+125,21,254,25,8,207,142,102,99,144,144,99,102,142,104,80,60,59,82,82,59,60,
+80,3,141,62,221,63,140,222,119,1,118,1,124,1,74,1,118,254,195,254,198,164,
+193,254,118,221,74,1,68,1,156,1,1,252,1,6,245,216,253,111,156,155,125,57,
+254,19,6,96,99,145,142,102,102,142,145,99,59,82,82,59,60,79,79,255,255,255,
+254,255,119,7,53,8,80,0,2,4,125,162,0,255,255,255,254,255,119,8,156,8,80,
+0,2,4,124,162,0,255,255,0,92,255,119,8,250,8,80,2,2,4,124,0,0,255,255,255,
+254,255,119,7,53,8,80,0,2,4,125,162,0,255,255,255,254,255,119,8,156,8,80,
+0,2,4,124,162,0,255,255,0,92,255,119,7,147,8,80,2,2,4,125,0,0,0,7,0,92,0,
+82,6,4,8,76,0,19,0,26,0,34,0,43,0,55,0,67,0,73,0,0,37,34,38,39,6,6,35,34,
+2,17,52,18,36,51,50,4,18,21,16,2,1,32,4,7,33,38,36,19,50,54,54,55,33,21,16,
+1,20,22,22,51,50,54,53,53,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,
+50,54,53,52,38,35,34,6,7,6,7,39,54,55,4,78,98,150,43,41,168,92,218,200,179,
+1,77,225,221,1,63,171,215,254,16,254,252,254,236,31,4,80,35,254,223,60,103,
+114,57,2,254,31,253,125,54,108,94,98,127,96,144,100,100,144,144,100,100,144,
+105,80,59,60,82,82,60,59,80,168,177,108,88,131,117,82,96,98,98,96,1,92,1,
+82,228,1,98,190,190,254,162,232,254,161,254,177,5,8,244,217,219,242,251,162,
+96,219,178,159,254,178,1,237,174,223,96,166,168,159,4,111,100,144,144,100,
+100,144,144,100,59,82,82,59,59,80,80,8,123,114,80,180,119,0,0,7,0,92,0,82,
+7,180,8,76,0,22,0,29,0,37,0,46,0,58,0,70,0,76,0,0,37,34,38,39,6,6,35,34,2,
+17,52,18,36,51,50,4,18,23,33,21,33,2,2,1,32,4,7,33,38,36,19,50,54,54,55,33,
+21,16,1,20,22,22,51,50,54,53,53,19,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,7,6,7,39,54,55,4,78,98,150,43,41,168,92,218,
+200,179,1,77,225,195,1,41,184,25,1,186,254,80,4,215,254,20,254,252,254,236,
+31,4,80,35,254,223,60,103,114,57,2,254,31,253,125,54,108,94,98,127,96,144,
+100,100,144,144,100,100,144,105,80,59,60,82,82,60,59,80,168,177,108,88,131,
+117,82,96,98,98,96,1,92,1,82,228,1,98,190,150,254,226,195,164,254,177,254,
+184,5,8,244,217,219,242,251,162,96,219,178,159,254,178,1,237,174,223,96,166,
+168,159,4,111,100,144,144,100,100,144,144,100,59,82,82,59,59,80,80,8,123,
+114,80,180,119,0,255,255,255,254,0,82,7,86,8,76,0,2,4,133,162,0,255,255,255,
+254,0,82,5,166,8,76,0,2,4,132,162,0,0,5,0,92,253,227,9,0,8,80,0,51,0,59,0,
+71,0,83,0,89,0,0,1,34,6,7,33,22,22,21,20,6,6,35,34,2,17,16,0,33,32,0,19,33,
+50,22,21,20,6,7,6,6,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,33,3,35,3,
+2,2,1,50,54,53,52,39,33,18,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,
+50,54,53,52,38,35,34,6,7,6,7,39,54,55,2,209,212,250,5,2,111,19,28,95,169,
+107,232,229,1,80,1,37,1,14,1,45,43,1,240,235,238,113,159,81,57,43,168,38,
+89,105,86,96,37,151,164,254,82,39,135,39,23,225,254,115,96,125,21,254,25,
+8,1,209,142,102,99,144,144,99,102,142,104,80,60,59,82,82,59,60,80,167,182,
+103,88,128,120,5,90,245,216,62,221,63,140,222,119,1,118,1,124,1,75,1,117,
+254,176,254,217,211,196,111,245,209,105,128,87,79,79,67,91,101,200,139,111,
+156,111,67,123,120,253,220,2,36,1,54,1,59,251,162,156,155,125,57,254,19,6,
+96,99,145,142,102,102,142,145,99,59,82,82,59,60,79,79,9,127,110,80,179,120,
+0,5,0,92,0,82,7,37,8,80,0,28,0,36,0,42,0,54,0,66,0,0,1,34,6,7,33,22,22,21,
+20,6,6,35,34,2,17,16,0,33,32,0,19,33,21,33,3,35,3,2,2,1,50,54,53,52,39,33,
+18,1,6,7,39,54,55,5,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,
+6,35,34,38,2,209,212,250,5,2,111,19,28,95,169,107,232,229,1,80,1,37,1,14,
+1,45,43,1,238,254,82,39,135,39,23,225,254,115,96,125,21,254,25,8,1,146,182,
+103,88,128,120,1,36,80,60,59,82,82,59,60,80,104,142,102,99,144,144,99,102,
+142,5,90,245,216,62,221,63,140,222,119,1,118,1,124,1,75,1,117,254,176,254,
+217,164,253,220,2,36,1,54,1,59,251,162,156,155,125,57,254,19,6,147,127,110,
+80,179,120,193,59,82,82,59,60,79,79,60,99,145,142,102,102,142,145,0,255,255,
+255,254,0,82,6,199,8,80,0,2,4,137,162,0,255,255,255,254,253,227,8,162,8,80,
+0,2,4,136,162,0,0,6,0,92,0,82,6,4,8,80,0,19,0,26,0,34,0,43,0,55,0,67,0,0,
+37,34,38,39,6,6,35,34,2,17,52,18,36,51,50,4,18,21,16,2,1,32,4,7,33,38,36,
+19,50,54,54,55,33,21,16,1,20,22,22,51,50,54,53,53,3,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,4,78,98,150,43,41,168,92,218,
+200,179,1,77,225,221,1,63,171,215,254,16,254,252,254,236,31,4,80,35,254,223,
+60,103,114,57,2,254,31,253,125,54,108,94,98,127,149,142,101,102,142,142,102,
+101,142,104,80,59,60,82,82,60,59,80,82,96,98,98,96,1,92,1,82,228,1,98,190,
+190,254,162,232,254,161,254,177,5,8,244,217,219,242,251,162,96,219,178,159,
+254,178,1,237,174,223,96,166,168,159,4,115,99,145,145,99,99,145,145,99,59,
+82,82,59,60,79,79,0,0,6,0,92,0,82,7,180,8,80,0,22,0,29,0,37,0,46,0,58,0,70,
+0,0,37,34,38,39,6,6,35,34,2,17,52,18,36,51,50,4,18,23,33,21,33,2,2,1,32,4,
+7,33,38,36,19,50,54,54,55,33,21,16,1,20,22,22,51,50,54,53,53,3,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,4,78,98,150,43,41,
+168,92,218,200,179,1,77,225,195,1,41,184,25,1,186,254,80,4,215,254,20,254,
+252,254,236,31,4,80,35,254,223,60,103,114,57,2,254,31,253,125,54,108,94,98,
+127,149,142,101,102,142,142,102,101,142,104,80,59,60,82,82,60,59,80,82,96,
+98,98,96,1,92,1,82,228,1,98,190,150,254,226,195,164,254,177,254,184,5,8,244,
+217,219,242,251,162,96,219,178,159,254,178,1,237,174,223,96,166,168,159,4,
+115,99,145,145,99,99,145,145,99,59,82,82,59,60,79,79,0,255,255,255,254,0,
+82,7,86,8,80,0,2,4,141,162,0,255,255,255,254,0,82,5,166,8,80,0,2,4,140,162,
+0,0,4,0,92,253,227,9,0,8,80,0,51,0,59,0,71,0,83,0,0,1,34,6,7,33,22,22,21,
+20,6,6,35,34,2,17,16,0,33,32,0,19,33,50,22,21,20,6,7,6,6,21,20,23,35,38,53,
+52,54,55,62,2,53,52,38,35,33,3,35,3,2,2,1,50,54,53,52,39,33,18,19,52,54,51,
+50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,2,209,212,250,5,
+2,111,19,28,95,169,107,232,229,1,80,1,37,1,14,1,45,43,1,240,235,238,113,159,
+81,57,43,168,38,89,105,86,96,37,151,164,254,82,39,135,39,23,225,254,115,96,
+125,21,254,25,8,217,144,100,100,144,144,100,100,144,105,80,59,59,82,82,59,
+59,80,5,90,245,216,62,221,63,140,222,119,1,118,1,124,1,75,1,117,254,176,254,
+217,211,196,111,245,209,105,128,87,79,79,67,91,101,200,139,111,156,111,67,
+123,120,253,220,2,36,1,54,1,59,251,162,156,155,125,57,254,19,6,96,100,144,
+144,100,100,144,144,100,59,82,82,59,60,79,79,0,0,4,0,92,0,82,7,37,8,80,0,
+28,0,36,0,48,0,60,0,0,1,34,6,7,33,22,22,21,20,6,6,35,34,2,17,16,0,33,32,0,
+19,33,21,33,3,35,3,2,2,1,50,54,53,52,39,33,18,1,20,22,51,50,54,53,52,38,35,
+34,6,7,52,54,51,50,22,21,20,6,35,34,38,2,209,212,250,5,2,111,19,28,95,169,
+107,232,229,1,80,1,37,1,14,1,45,43,1,238,254,82,39,135,39,23,225,254,115,
+96,125,21,254,25,8,1,66,80,59,59,82,82,59,59,80,105,144,100,100,144,144,100,
+100,144,5,90,245,216,62,221,63,140,222,119,1,118,1,124,1,75,1,117,254,176,
+254,217,164,253,220,2,36,1,54,1,59,251,162,156,155,125,57,254,19,6,96,59,
+82,82,59,60,79,79,60,100,144,144,100,100,144,144,255,255,255,254,0,82,6,199,
+8,80,0,2,4,145,162,0,255,255,255,254,253,227,8,162,8,80,0,2,4,144,162,0,0,
+4,0,92,0,82,7,160,6,66,0,27,0,35,0,47,0,59,0,0,1,22,22,21,20,6,6,35,34,2,
+17,16,0,33,50,22,18,23,33,21,33,38,2,38,35,34,2,7,1,50,54,53,52,39,33,18,
+1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,109,
+19,28,95,169,105,235,228,1,61,1,21,156,253,166,23,2,156,252,213,5,113,203,
+134,198,230,4,1,31,96,125,21,254,25,8,4,17,144,99,101,143,143,101,98,145,
+104,80,59,60,82,82,60,59,80,3,141,62,221,63,140,222,119,1,120,1,122,1,101,
+1,153,163,254,194,212,164,217,1,52,162,254,230,241,253,111,156,155,125,57,
+254,19,4,31,103,140,143,100,101,143,140,104,60,82,82,60,59,80,80,255,255,
+0,92,0,82,7,160,6,66,0,2,4,148,0,0,255,255,255,254,0,82,7,66,6,66,0,2,4,148,
+162,0,255,255,255,254,0,82,7,66,6,66,0,2,4,148,162,0,255,255,0,92,0,150,5,
+176,8,80,0,35,0,208,1,43,8,25,0,2,0,83,0,0,255,255,0,92,0,150,5,176,8,80,
+0,35,0,208,1,43,8,25,0,2,0,83,0,0,255,255,0,0,0,150,4,227,8,80,2,34,0,40,
+0,0,0,3,0,208,0,115,8,25,0,3,0,0,0,150,4,23,8,80,0,25,0,37,0,49,0,0,19,18,
+19,51,16,19,33,21,33,18,19,35,38,2,3,35,6,2,21,20,23,35,38,2,53,53,1,20,22,
+51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,102,88,199,166,
+51,1,185,254,106,75,142,174,113,131,28,9,115,98,25,158,23,34,1,43,80,59,60,
+82,82,60,59,80,104,144,99,102,142,142,102,99,144,3,141,1,65,1,17,254,211,
+254,219,164,254,208,254,221,255,2,5,1,86,216,254,110,238,156,102,109,1,88,
+142,164,3,207,59,82,82,59,60,79,79,60,102,142,145,99,99,145,142,0,255,255,
+0,92,254,178,5,176,5,223,0,35,0,14,0,166,0,0,0,35,0,14,2,78,0,0,0,2,0,83,
+0,0,255,255,0,92,254,178,5,176,5,223,0,35,0,14,0,166,0,0,0,35,0,14,2,78,0,
+0,0,2,0,83,0,0,255,255,0,0,254,178,4,227,5,223,2,34,0,40,0,0,0,34,0,14,238,
+0,0,3,0,14,1,150,0,0,0,3,0,0,254,178,4,23,5,223,0,25,0,31,0,37,0,0,19,18,
+19,51,16,19,33,21,33,18,19,35,38,2,3,35,6,2,21,20,23,35,38,2,53,53,1,6,7,
+39,54,55,5,6,7,39,54,55,102,88,199,166,51,1,185,254,106,75,142,174,113,131,
+28,9,115,98,25,158,23,34,3,63,192,92,88,126,122,254,213,190,95,88,126,122,
+3,141,1,65,1,17,254,211,254,219,164,254,208,254,221,255,2,5,1,86,216,254,
+110,238,156,102,109,1,88,142,164,252,19,138,100,80,179,120,141,135,103,80,
+179,120,0,5,0,92,0,197,8,6,6,55,0,17,0,26,0,32,0,44,0,56,0,0,1,33,38,38,53,
+52,54,54,51,50,22,18,23,33,21,33,3,35,3,2,38,35,34,6,21,20,23,1,6,7,39,54,
+55,5,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,3,
+23,253,163,41,53,103,185,118,149,184,101,10,4,88,251,230,39,136,51,10,131,
+139,111,133,47,4,14,185,99,88,124,123,1,39,80,60,59,82,82,59,60,80,104,142,
+102,100,143,143,100,101,143,2,233,78,219,111,127,203,108,140,254,211,241,
+164,253,220,2,200,1,8,248,141,127,156,88,1,193,131,107,80,176,123,192,60,
+82,82,60,59,80,80,59,100,143,142,101,101,143,143,255,255,0,92,0,197,8,6,6,
+55,0,2,4,160,0,0,0,5,0,92,0,197,8,184,6,14,0,17,0,29,0,38,0,50,0,56,0,0,1,
+21,33,3,35,3,33,53,33,38,39,53,54,54,51,50,18,19,1,52,54,51,50,22,21,20,6,
+35,34,38,5,22,23,33,38,38,35,34,6,37,20,22,51,50,54,53,52,38,35,34,6,7,6,
+7,39,54,55,8,184,251,230,39,135,39,252,147,1,55,83,125,98,219,139,230,227,
+12,1,207,145,99,99,145,145,99,99,145,251,21,158,104,1,114,10,143,152,96,160,
+5,13,79,60,59,82,82,59,60,79,170,184,101,88,126,122,3,141,164,253,220,2,36,
+164,118,63,182,110,109,254,227,254,215,1,142,101,142,142,101,102,142,142,
+15,99,182,205,207,59,45,60,82,82,60,59,80,80,8,128,110,80,179,120,0,255,255,
+0,0,254,190,5,37,6,14,2,34,0,33,0,0,0,35,0,14,0,33,5,174,0,3,0,208,1,186,
+5,215,255,255,0,0,254,190,5,37,6,14,0,34,0,33,0,0,0,35,0,14,0,33,5,174,0,
+3,0,208,1,186,5,215,255,255,0,0,253,223,5,37,6,14,2,34,3,78,0,0,0,35,0,14,
+0,33,5,174,0,3,0,208,1,186,5,215,0,1,0,92,255,12,3,215,3,141,0,18,0,0,5,34,
+38,2,3,33,21,33,22,18,23,54,54,51,50,22,21,20,6,2,227,133,207,253,54,3,123,
+253,74,56,173,62,26,82,51,78,113,114,244,236,2,116,1,33,164,197,254,109,94,
+39,47,114,76,78,113,0,0,1,0,0,255,12,3,88,3,141,0,19,0,0,5,34,38,2,3,53,33,
+21,33,22,18,23,54,54,51,50,22,21,20,6,2,100,118,189,224,81,3,88,253,74,56,
+173,62,26,82,51,78,113,114,244,185,1,248,1,44,164,164,197,254,109,94,39,47,
+114,76,78,113,0,0,1,0,0,255,12,3,231,3,141,0,19,0,0,5,34,38,2,3,53,33,21,
+33,22,18,23,54,54,51,50,22,21,20,6,2,100,118,189,224,81,3,231,252,187,56,
+173,62,26,82,51,78,113,114,244,185,1,248,1,44,164,164,197,254,109,94,39,47,
+114,76,78,113,0,0,1,0,92,255,12,4,102,3,141,0,18,0,0,5,34,38,2,3,33,21,33,
+22,18,23,54,54,51,50,22,21,20,6,2,227,133,207,253,54,4,10,252,187,56,173,
+62,26,82,51,78,113,114,244,236,2,116,1,33,164,197,254,109,94,39,47,114,76,
+78,113,0,0,2,0,20,254,178,6,236,5,57,0,42,0,48,0,0,1,34,6,6,7,3,35,3,38,38,
+35,34,7,53,54,51,50,22,23,23,51,54,33,51,54,54,51,50,18,19,35,38,38,35,34,
+6,21,20,18,23,7,2,3,3,6,7,39,54,55,3,143,116,112,56,9,20,135,53,11,73,84,
+93,129,144,121,151,126,7,6,9,68,1,1,37,23,213,172,190,215,13,152,12,144,110,
+123,129,87,99,151,179,16,121,187,97,88,124,123,2,233,51,121,124,254,215,2,
+231,154,129,52,150,61,198,228,172,170,191,223,254,209,254,237,207,201,182,
+160,149,254,244,165,86,1,60,1,30,252,183,133,105,80,176,123,0,255,255,0,20,
+254,178,6,236,5,57,0,2,4,170,0,0,0,1,0,20,0,135,3,205,5,43,0,7,0,0,19,51,
+19,33,21,33,19,35,20,144,155,2,142,253,178,231,184,5,43,254,98,164,253,158,
+255,255,0,20,0,135,3,205,5,43,0,2,4,172,0,0,255,255,0,20,0,135,3,205,6,14,
+2,34,4,172,0,0,0,3,0,208,0,244,5,215,255,255,0,20,0,135,3,205,6,14,0,34,4,
+172,0,0,0,3,0,208,0,244,5,215,0,1,0,0,0,10,4,123,4,229,0,23,0,0,1,21,33,20,
+6,7,7,6,7,53,54,55,55,54,54,53,33,53,33,52,39,51,22,21,4,123,254,84,103,114,
+221,147,134,68,165,168,97,63,253,207,2,49,57,158,57,3,141,164,157,199,59,
+119,79,122,195,68,92,90,51,137,102,164,181,163,157,187,0,1,0,0,0,10,3,174,
+4,229,0,23,0,0,1,21,35,20,6,7,7,6,7,53,54,55,55,54,54,53,33,53,33,52,39,51,
+22,21,3,174,223,103,114,221,147,134,68,165,168,97,63,253,207,2,49,57,158,
+57,3,141,164,157,199,59,119,79,122,195,68,92,90,51,137,102,164,181,163,157,
+187,0,0,3,0,0,0,10,5,133,6,14,0,23,0,35,0,47,0,0,17,33,52,39,51,22,21,33,
+21,33,20,6,7,7,6,7,53,54,55,55,54,54,53,33,1,52,54,51,50,22,21,20,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,2,49,57,158,57,2,182,253,74,103,114,
+221,147,134,68,165,168,97,63,253,207,2,252,142,102,100,143,143,100,101,143,
+104,80,60,59,82,82,59,60,80,3,141,181,163,157,187,164,157,199,59,119,79,122,
+195,68,92,90,51,137,102,2,50,100,143,142,101,101,143,143,101,60,82,82,60,
+59,80,80,0,255,255,0,0,0,10,5,133,6,14,0,2,4,178,0,0,0,5,0,92,255,119,5,55,
+6,14,0,8,0,20,0,32,0,44,0,56,0,0,5,7,38,2,3,33,21,33,18,3,20,22,51,50,54,
+53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,37,20,22,51,50,54,53,52,
+38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,2,115,150,133,205,47,4,219,251,
+230,106,194,79,60,59,82,82,59,60,79,105,145,99,99,145,145,99,99,145,2,187,
+79,60,59,82,82,59,60,79,105,145,99,99,145,145,99,99,145,63,74,254,2,0,1,24,
+164,254,134,3,172,60,82,82,60,59,80,80,59,101,142,142,101,102,142,142,102,
+60,82,82,60,59,80,80,59,101,142,142,101,102,142,142,255,255,0,92,255,119,
+5,55,6,14,0,2,4,180,0,0,0,5,0,0,0,10,5,117,6,14,0,11,0,23,0,35,0,47,0,65,
+0,0,1,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,37,
+20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,1,21,33,
+20,6,7,7,6,7,53,54,55,55,54,54,53,33,53,1,23,79,60,59,82,82,59,60,79,105,
+145,99,99,145,145,99,99,145,2,166,80,59,60,82,82,60,59,80,104,144,99,99,145,
+145,99,98,145,2,137,253,90,103,114,221,147,134,68,165,168,97,63,253,207,5,
+27,60,82,82,60,59,80,80,59,101,142,142,101,102,142,142,102,60,82,82,60,59,
+80,80,59,103,140,142,101,102,142,140,254,218,164,157,199,59,119,79,122,195,
+68,92,90,51,137,102,164,255,255,0,0,0,10,5,117,6,14,0,2,4,182,0,0,255,255,
+0,92,0,143,5,176,8,80,0,34,3,68,0,0,0,3,0,208,1,43,8,25,255,255,0,92,0,143,
+5,176,8,80,2,34,3,68,0,0,0,3,0,208,1,43,8,25,255,255,0,0,254,82,4,227,8,80,
+2,34,3,69,0,0,0,3,0,208,0,115,8,25,255,255,0,0,254,82,4,227,8,80,0,34,3,69,
+0,0,0,3,0,208,0,115,8,25,255,255,0,92,255,10,5,236,3,141,0,2,2,145,0,0,0,
+2,0,92,255,135,3,254,3,141,0,13,0,25,0,0,1,21,33,22,22,21,20,6,35,34,38,39,
+2,3,1,52,2,39,35,22,18,22,22,51,50,54,3,254,254,84,160,141,164,129,125,144,
+44,124,73,2,131,162,174,118,47,112,51,68,43,55,78,3,141,164,149,248,137,147,
+185,133,146,1,129,1,110,253,70,108,1,5,165,192,254,147,95,44,82,0,0,2,0,0,
+255,135,4,76,3,141,0,14,0,26,0,0,17,33,21,33,22,22,21,20,6,35,34,38,39,2,
+3,1,52,2,39,35,22,18,22,22,51,50,54,4,76,253,135,160,141,164,129,120,147,
+46,100,62,2,96,162,174,118,47,112,51,68,43,55,78,3,141,164,149,248,137,147,
+185,125,154,1,61,1,14,253,234,108,1,5,165,192,254,147,95,44,82,0,2,0,92,255,
+135,4,203,3,141,0,13,0,25,0,0,1,21,33,22,22,21,20,6,35,34,38,39,2,3,1,52,
+2,39,35,22,18,22,22,51,50,54,4,203,253,135,160,141,164,129,125,144,44,124,
+73,2,131,162,174,118,47,112,51,68,43,55,78,3,141,164,149,248,137,147,185,
+133,146,1,129,1,110,253,70,108,1,5,165,192,254,147,95,44,82,0,0,2,0,0,255,
+135,3,127,3,141,0,14,0,26,0,0,17,33,21,33,22,22,21,20,6,35,34,38,39,2,3,1,
+52,2,39,35,22,18,22,22,51,50,54,3,127,254,84,160,141,164,129,120,147,46,100,
+62,2,96,162,174,118,47,112,51,68,43,55,78,3,141,164,149,248,137,147,185,125,
+154,1,61,1,14,253,234,108,1,5,165,192,254,147,95,44,82,0,2,0,92,255,72,4,
+164,3,141,0,8,0,12,0,0,1,21,33,19,51,21,35,1,1,23,19,55,1,4,164,253,209,250,
+213,197,254,37,254,184,207,207,231,254,236,3,141,164,254,15,148,254,228,4,
+69,164,253,80,140,2,36,0,0,2,0,92,255,72,5,113,3,141,0,8,0,12,0,0,1,21,33,
+19,51,21,35,1,1,23,19,55,1,5,113,253,4,250,213,197,254,37,254,184,207,207,
+231,254,236,3,141,164,254,15,148,254,228,4,69,164,253,80,140,2,36,0,0,2,0,
+0,255,72,4,227,3,141,0,9,0,13,0,0,1,21,33,19,51,21,35,1,1,53,23,19,55,1,4,
+227,253,4,250,213,196,254,37,254,233,158,207,231,254,235,3,141,164,254,15,
+148,254,228,3,161,164,164,253,80,140,2,36,0,0,2,0,0,255,72,4,23,3,141,0,9,
+0,13,0,0,1,21,33,19,51,21,35,1,1,53,23,19,55,1,4,23,253,208,250,213,196,254,
+37,254,233,158,207,231,254,235,3,141,164,254,15,148,254,228,3,161,164,164,
+253,80,140,2,36,0,255,255,0,92,255,72,4,12,5,178,2,34,2,194,0,0,0,3,0,14,
+0,231,5,133,0,3,0,92,255,72,4,217,5,178,0,5,0,9,0,15,0,0,1,21,33,9,2,23,19,
+55,1,19,6,7,39,54,55,4,217,253,156,1,55,253,248,254,184,207,207,231,254,236,
+196,185,99,88,124,123,3,141,164,253,150,254,201,4,69,164,253,80,140,2,36,
+2,60,131,107,80,176,123,255,255,0,0,255,72,4,76,5,178,2,34,2,195,0,0,0,3,
+0,14,0,90,5,133,0,3,0,0,255,72,3,127,5,178,0,6,0,10,0,16,0,0,17,33,21,33,
+9,2,51,19,55,1,19,6,7,39,54,55,3,127,254,104,1,56,253,248,254,233,158,207,
+231,254,235,197,179,106,88,130,118,3,141,164,253,150,254,201,3,161,253,80,
+140,2,36,2,60,125,113,80,181,118,0,1,0,92,255,72,4,12,3,141,0,9,0,0,1,19,
+1,1,33,21,33,19,55,3,2,238,190,253,248,254,184,3,176,253,31,207,231,155,1,
+248,254,135,254,201,4,69,164,253,80,138,1,53,0,1,0,0,255,72,4,76,3,141,0,
+10,0,0,1,19,1,1,53,33,21,33,19,55,3,2,96,191,253,248,254,233,4,76,252,82,
+207,231,156,1,248,254,135,254,201,3,161,164,164,253,80,138,1,53,0,1,0,92,
+255,72,4,217,3,141,0,9,0,0,1,19,1,1,33,21,33,19,55,3,2,238,190,253,248,254,
+184,4,125,252,82,207,231,155,1,248,254,135,254,201,4,69,164,253,80,138,1,
+53,0,1,0,0,255,72,3,127,3,141,0,10,0,0,1,19,1,1,53,33,21,33,19,55,3,2,96,
+191,253,248,254,233,3,127,253,31,207,231,156,1,248,254,135,254,201,3,161,
+164,164,253,80,138,1,53,0,1,0,92,254,176,4,168,3,141,0,32,0,0,1,22,22,21,
+20,6,35,34,39,53,22,51,50,54,53,52,39,34,6,7,53,54,54,51,54,55,33,55,33,21,
+33,6,21,3,45,100,70,127,113,72,75,85,62,35,43,133,168,220,91,78,199,178,4,
+55,253,137,37,4,39,254,194,61,1,27,139,163,73,123,121,51,187,68,39,35,92,
+184,38,58,174,48,38,215,182,164,164,221,215,0,0,1,0,0,254,176,4,164,3,141,
+0,32,0,0,1,22,22,21,20,6,35,34,39,53,22,51,50,54,53,52,39,34,6,7,53,54,54,
+51,54,55,33,53,33,21,33,6,21,2,92,100,70,127,112,73,75,85,63,34,43,133,168,
+220,91,78,199,178,4,55,253,254,4,164,253,246,62,1,27,139,163,73,123,121,51,
+187,68,39,35,92,184,38,58,174,48,38,215,182,164,164,218,218,0,1,0,92,254,
+176,5,117,3,141,0,32,0,0,1,22,22,21,20,6,35,34,39,53,22,51,50,54,53,52,39,
+34,6,7,53,54,54,51,54,55,33,55,33,21,33,6,21,3,45,100,70,127,113,72,75,85,
+62,35,43,133,168,220,91,78,199,178,4,55,253,137,37,4,244,253,245,61,1,27,
+139,163,73,123,121,51,187,68,39,35,92,184,38,58,174,48,38,215,182,164,164,
+221,215,0,0,1,0,0,254,176,3,215,3,141,0,32,0,0,1,22,22,21,20,6,35,34,39,53,
+22,51,50,54,53,52,39,34,6,7,53,54,54,51,54,55,33,53,33,21,33,6,21,2,92,100,
+70,127,112,73,75,85,63,34,43,133,168,220,91,78,199,178,4,55,253,254,3,215,
+254,195,62,1,27,139,163,73,123,121,51,187,68,39,35,92,184,38,58,174,48,38,
+215,182,164,164,218,218,0,1,0,92,254,152,5,10,6,66,0,47,0,0,1,52,39,33,53,
+16,0,33,50,4,18,23,7,2,2,35,34,2,7,33,22,22,21,20,6,35,34,6,21,20,22,51,51,
+50,22,23,21,38,38,35,35,32,17,52,54,51,50,54,2,182,20,253,186,1,56,1,16,168,
+1,14,163,13,164,20,236,194,193,225,4,2,47,18,25,214,169,129,94,86,86,43,138,
+168,63,64,152,153,43,254,194,185,184,96,125,2,68,109,56,91,1,103,1,151,187,
+254,171,216,20,1,17,1,65,254,232,243,63,180,86,188,226,76,65,58,69,32,48,
+178,49,45,1,35,147,158,127,0,0,1,0,92,254,152,5,2,6,66,0,48,0,0,19,53,16,
+0,33,50,4,18,17,35,38,2,38,35,34,2,7,33,22,22,21,20,6,35,34,6,21,20,22,51,
+51,50,22,23,21,38,38,35,35,32,17,52,54,51,50,54,53,52,39,92,1,56,1,16,176,
+1,21,153,152,5,112,203,134,193,225,4,2,47,18,25,214,169,129,94,86,86,43,138,
+168,63,64,152,153,43,254,194,185,184,96,125,20,2,233,91,1,103,1,151,208,254,
+120,254,255,219,1,51,161,254,232,243,63,180,86,188,226,76,65,58,69,32,48,
+178,49,45,1,35,147,158,127,123,109,56,255,255,0,0,254,152,4,166,6,66,0,2,
+4,210,164,0,255,255,0,0,254,152,4,174,6,66,0,2,4,209,164,0,0,1,0,92,254,152,
+7,102,6,66,0,55,0,0,19,53,16,0,33,50,0,19,33,21,33,22,18,23,7,2,2,3,2,2,35,
+34,2,7,33,22,22,21,20,6,35,34,6,21,20,22,51,51,50,22,23,21,38,38,35,35,32,
+17,52,54,51,50,54,53,52,39,92,1,46,1,3,254,1,17,59,2,143,253,144,38,156,133,
+149,170,149,44,47,207,178,182,213,4,2,47,18,25,214,169,129,94,86,86,43,138,
+168,63,64,152,153,43,254,194,185,184,96,125,20,2,233,91,1,106,1,148,254,163,
+254,168,164,185,254,131,242,74,1,68,1,156,1,1,1,27,1,37,254,230,241,63,180,
+86,188,226,76,65,58,69,32,48,178,49,45,1,35,147,158,127,123,109,56,0,0,3,
+0,92,254,152,5,193,6,66,0,41,0,49,0,57,0,0,1,33,53,52,18,36,51,50,4,18,21,
+16,2,35,34,39,6,6,35,34,6,21,20,22,51,51,50,22,23,21,38,38,35,35,32,17,52,
+54,51,50,54,53,1,38,0,35,34,6,6,7,1,50,54,54,55,33,21,16,2,156,253,192,165,
+1,50,199,221,1,66,168,216,223,214,83,47,139,78,129,94,86,86,43,138,168,63,
+64,152,153,43,254,194,185,184,86,109,2,120,35,254,230,221,149,229,128,2,3,
+12,104,113,57,3,254,30,2,233,91,233,1,92,185,210,254,133,245,254,164,254,
+174,207,60,63,76,65,58,69,32,48,178,49,45,1,35,147,158,116,113,1,94,246,1,
+21,131,241,151,253,111,96,214,183,159,254,178,0,3,0,92,254,152,7,113,6,66,
+0,44,0,52,0,60,0,0,1,33,53,52,18,36,51,50,4,18,23,33,21,33,2,2,35,34,39,6,
+6,35,34,6,21,20,22,51,51,50,22,23,21,38,38,35,35,32,17,52,54,51,50,54,53,
+1,38,0,35,34,6,6,7,1,50,54,54,55,33,21,16,2,156,253,192,165,1,50,199,197,
+1,44,181,24,1,185,254,80,5,215,219,214,83,47,139,78,129,94,86,86,43,138,168,
+63,64,152,153,43,254,194,185,184,86,109,2,120,35,254,230,221,149,229,128,
+2,3,12,104,113,57,3,254,30,2,233,91,233,1,92,185,166,254,198,213,164,254,
+174,254,187,207,60,63,76,65,58,69,32,48,178,49,45,1,35,147,158,116,113,1,
+94,246,1,21,131,241,151,253,111,96,214,183,159,254,178,0,1,0,92,254,152,8,
+29,6,66,0,64,0,0,19,53,16,0,33,50,0,19,33,21,33,22,18,18,22,51,50,55,21,6,
+6,35,34,38,39,2,3,2,2,35,34,2,7,33,22,22,21,20,6,35,34,6,21,20,22,51,51,50,
+22,23,21,38,38,35,35,32,17,52,54,51,50,54,53,52,39,92,1,46,1,3,234,1,27,67,
+3,72,252,215,22,84,133,130,75,111,57,22,89,57,130,182,79,163,73,53,202,177,
+182,213,4,2,47,18,25,214,169,129,94,86,86,43,138,168,63,64,152,153,43,254,
+194,185,184,96,125,20,2,233,91,1,106,1,148,254,193,254,138,164,118,254,245,
+254,226,148,86,186,33,37,159,169,1,89,1,171,1,57,1,7,254,230,241,63,180,86,
+188,226,76,65,58,69,32,48,178,49,45,1,35,147,158,127,123,109,56,0,0,1,0,92,
+254,152,6,225,6,66,0,51,0,0,19,53,16,0,33,50,0,19,33,21,33,3,35,3,2,2,35,
+34,2,7,33,22,22,21,20,6,35,34,6,21,20,22,51,51,50,22,23,21,38,38,35,35,32,
+17,52,54,51,50,54,53,52,39,92,1,56,1,16,242,1,43,49,1,239,254,82,39,135,39,
+24,217,201,193,225,4,2,47,18,25,214,169,129,94,86,86,43,138,168,63,64,152,
+153,43,254,194,185,184,96,125,20,2,233,91,1,103,1,151,254,159,254,172,164,
+253,220,2,36,1,86,1,89,254,232,243,63,180,86,188,226,76,65,58,69,32,48,178,
+49,45,1,35,147,158,127,123,109,56,0,1,0,92,253,227,8,188,6,66,0,74,0,0,19,
+53,16,0,33,50,0,19,33,50,22,21,20,2,7,14,2,21,20,23,35,38,53,52,54,55,54,
+54,53,52,38,35,33,3,35,3,2,2,35,34,2,7,33,22,22,21,20,6,35,34,6,21,20,22,
+51,51,50,22,23,21,38,38,35,35,32,17,52,54,51,50,54,53,52,39,92,1,56,1,16,
+242,1,43,49,1,241,236,237,126,146,55,59,23,43,168,39,96,99,121,98,152,164,
+254,82,39,135,39,24,217,201,193,225,4,2,47,18,25,214,169,129,94,86,86,43,
+138,168,63,64,152,153,43,254,194,185,184,96,125,20,2,233,91,1,103,1,151,254,
+159,254,172,211,196,121,254,255,187,71,104,81,64,83,75,65,93,105,205,130,
+160,189,96,123,120,253,220,2,36,1,86,1,89,254,232,243,63,180,86,188,226,76,
+65,58,69,32,48,178,49,45,1,35,147,158,127,123,109,56,0,255,255,0,0,254,152,
+6,133,6,66,0,2,4,217,164,0,255,255,0,0,253,227,8,96,6,66,0,2,4,218,164,0,
+0,1,0,92,254,152,8,205,6,66,0,64,0,0,19,53,16,0,33,50,0,19,33,32,17,20,7,
+35,54,53,52,38,35,33,22,18,23,7,2,2,3,2,2,35,34,2,7,33,22,22,21,20,6,35,34,
+6,21,20,22,51,51,50,22,23,21,38,38,35,35,32,17,52,54,51,50,54,53,52,39,92,
+1,46,1,3,254,1,17,59,2,143,1,103,51,152,45,92,109,253,144,38,156,133,149,
+170,149,44,47,207,178,182,213,4,2,47,18,25,214,169,129,94,86,86,43,138,168,
+63,64,152,153,43,254,194,185,184,96,125,20,2,233,91,1,106,1,148,254,163,254,
+168,254,174,126,113,104,135,84,90,185,254,131,242,74,1,68,1,156,1,1,1,27,
+1,37,254,230,241,63,180,86,188,226,76,65,58,69,32,48,178,49,45,1,35,147,158,
+127,123,109,56,255,255,0,0,254,152,7,10,6,66,0,2,4,213,164,0,255,255,0,0,
+254,152,8,113,6,66,0,2,4,221,164,0,255,255,0,0,254,152,5,101,6,66,0,2,4,214,
+164,0,255,255,0,92,254,152,5,193,6,66,2,2,4,214,0,0,255,255,0,0,254,152,7,
+21,6,66,0,2,4,215,164,0,255,255,0,92,254,152,7,113,6,66,2,2,4,215,0,0,0,3,
+0,92,254,152,8,215,6,66,0,53,0,61,0,69,0,0,1,33,53,52,18,36,51,50,4,18,23,
+33,32,17,20,7,35,54,53,52,38,35,33,2,2,35,34,39,6,6,35,34,6,21,20,22,51,51,
+50,22,23,21,38,38,35,35,32,17,52,54,51,50,54,53,1,38,0,35,34,6,6,7,1,50,54,
+54,55,33,21,16,2,156,253,192,165,1,50,199,197,1,44,181,24,1,185,1,102,51,
+152,45,92,108,254,80,5,215,219,214,83,47,139,78,129,94,86,86,43,138,168,63,
+64,152,153,43,254,194,185,184,86,109,2,120,35,254,230,221,149,229,128,2,3,
+12,104,113,57,3,254,30,2,233,91,233,1,92,185,166,254,198,213,254,174,126,
+113,104,135,84,90,254,174,254,187,207,60,63,76,65,58,69,32,48,178,49,45,1,
+35,147,158,116,113,1,94,246,1,21,131,241,151,253,111,96,214,183,159,254,178,
+0,255,255,0,92,254,152,9,197,6,66,0,35,0,9,6,164,0,0,0,2,4,215,0,0,0,3,0,
+0,254,152,9,104,6,66,0,50,0,58,0,66,0,0,1,33,53,52,18,36,51,50,4,18,23,33,
+21,33,18,19,7,2,3,35,2,2,35,34,39,6,6,35,34,6,21,20,22,51,51,50,22,23,21,
+38,38,35,35,32,17,52,54,51,50,54,53,1,38,0,35,34,6,6,7,1,50,54,54,55,33,21,
+16,2,63,253,193,165,1,50,199,197,1,44,182,23,4,12,253,129,119,223,149,239,
+115,228,4,215,219,214,83,47,139,78,129,94,86,86,43,139,169,60,60,151,157,
+43,254,194,185,184,86,108,2,121,35,254,231,222,149,229,128,2,3,12,104,113,
+57,3,254,30,2,233,91,233,1,93,184,167,254,198,212,164,254,104,254,112,74,
+1,188,1,182,254,177,254,184,207,60,63,76,65,58,69,33,47,178,48,46,1,35,147,
+158,116,113,1,94,246,1,21,131,241,151,253,111,96,214,183,159,254,178,0,255,
+255,0,0,254,152,7,21,6,66,0,2,4,215,164,0,255,255,0,0,254,152,5,101,6,66,
+0,2,4,214,164,0,255,255,0,0,254,152,8,123,6,66,0,2,4,228,164,0,0,1,0,92,254,
+152,9,131,6,66,0,73,0,0,19,53,16,0,33,50,0,19,33,32,17,20,7,35,54,53,52,38,
+35,33,22,18,18,22,51,50,55,21,6,6,35,34,38,39,2,3,2,2,35,34,2,7,33,22,22,
+21,20,6,35,34,6,21,20,22,51,51,50,22,23,21,38,38,35,35,32,17,52,54,51,50,
+54,53,52,39,92,1,46,1,3,234,1,27,67,3,72,1,102,51,152,45,92,108,252,215,22,
+84,133,130,75,111,57,22,89,57,130,182,79,163,73,53,202,177,182,213,4,2,47,
+18,25,214,169,129,94,86,86,43,138,168,63,64,152,153,43,254,194,185,184,96,
+125,20,2,233,91,1,106,1,148,254,193,254,138,254,174,126,113,104,135,84,90,
+118,254,245,254,226,148,86,186,33,37,159,169,1,89,1,171,1,57,1,7,254,230,
+241,63,180,86,188,226,76,65,58,69,32,48,178,49,45,1,35,147,158,127,123,109,
+56,255,255,0,0,254,152,7,193,6,66,0,2,4,216,164,0,255,255,0,0,254,152,9,39,
+6,66,0,2,4,234,164,0,255,255,0,92,254,152,8,205,6,66,2,2,4,221,0,0,255,255,
+0,92,254,152,7,102,6,66,2,2,4,213,0,0,255,255,0,0,255,119,7,55,6,66,0,2,4,
+48,164,0,255,255,0,0,254,152,8,113,6,66,0,2,4,221,164,0,0,3,0,33,254,178,
+4,225,5,223,0,24,0,30,0,36,0,0,1,6,2,21,20,22,23,35,38,38,53,16,18,55,51,
+18,19,33,21,33,18,19,35,2,3,1,6,7,39,54,55,5,6,7,39,54,55,1,248,123,127,27,
+26,157,29,29,203,199,161,7,36,2,39,253,242,43,90,170,148,26,1,61,192,92,88,
+126,122,254,213,190,95,88,126,122,5,4,108,254,180,242,104,244,104,104,244,
+104,1,47,1,182,160,254,217,254,213,164,254,241,254,188,2,27,2,83,250,156,
+138,100,80,179,120,141,135,103,80,179,120,0,255,255,0,33,254,178,4,225,5,
+223,0,2,4,241,0,0,255,255,255,191,254,178,4,127,5,223,0,2,4,241,158,0,255,
+255,255,191,254,178,4,127,5,223,0,2,4,241,158,0,0,1,0,92,0,61,4,10,5,209,
+0,28,0,0,1,34,6,21,20,18,22,51,50,55,21,6,6,35,34,38,38,2,53,52,18,54,51,
+50,18,19,7,38,38,2,47,141,164,118,140,76,110,60,23,90,57,112,167,147,70,114,
+212,141,211,242,22,162,18,158,5,39,240,245,165,254,200,126,86,186,33,37,114,
+255,1,13,135,198,1,42,159,254,182,254,211,20,252,229,0,1,0,92,0,61,4,4,5,
+209,0,28,0,0,37,6,6,35,34,38,38,2,53,52,18,54,51,50,18,19,35,2,38,35,34,6,
+21,20,18,22,51,50,55,2,246,23,90,57,112,167,147,70,114,212,141,228,226,15,
+151,22,139,157,141,164,118,140,76,110,60,131,33,37,114,255,1,13,135,198,1,
+42,159,254,147,254,133,1,69,249,240,245,165,254,200,126,86,0,255,255,255,
+252,0,61,3,164,5,209,0,2,4,246,160,0,255,255,255,252,0,61,3,170,5,209,0,2,
+4,245,160,0,0,3,0,92,0,150,7,6,6,14,0,30,0,42,0,54,0,0,19,33,21,35,18,19,
+33,21,33,18,23,35,2,2,39,35,6,2,6,35,34,39,53,22,51,50,54,55,54,55,33,5,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,233,2,195,
+219,86,70,3,153,252,148,105,36,156,54,155,67,8,28,84,127,108,96,88,94,80,
+70,86,39,54,13,254,217,3,13,142,101,101,143,143,101,100,143,104,80,59,60,
+82,82,60,59,80,6,12,127,255,0,255,0,164,254,84,167,1,30,2,77,183,139,254,
+254,102,51,153,39,115,141,223,68,114,100,143,143,100,101,143,142,102,60,82,
+82,60,59,80,80,0,0,3,0,0,0,150,6,106,6,14,0,29,0,41,0,53,0,0,19,33,21,35,
+18,23,33,21,33,18,19,35,2,2,3,35,6,2,21,20,23,35,38,2,53,53,51,18,55,35,5,
+52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,78,2,194,
+245,6,49,4,24,252,13,76,151,174,125,128,30,8,110,93,25,158,23,34,102,70,160,
+254,3,12,145,99,99,145,145,99,99,145,105,79,60,59,82,82,59,60,79,6,12,127,
+254,240,240,164,254,217,254,212,1,11,1,241,1,73,209,254,111,225,156,102,109,
+1,88,142,164,1,5,251,114,101,142,142,101,102,142,142,102,60,82,82,60,59,80,
+80,0,255,255,0,92,0,150,7,6,6,14,0,2,4,249,0,0,255,255,0,0,0,150,6,106,6,
+14,0,2,4,250,0,0,0,2,0,92,0,86,6,133,6,20,0,36,0,48,0,0,1,22,21,20,6,6,35,
+34,38,53,52,54,51,50,23,2,0,35,34,0,17,20,18,23,7,38,2,53,52,18,36,51,32,
+0,19,51,21,5,52,38,35,34,6,21,20,22,51,50,54,5,158,4,105,197,120,171,216,
+211,176,150,100,29,254,254,235,228,254,246,92,103,150,100,107,164,1,43,193,
+1,21,1,84,54,250,254,100,122,115,105,120,120,105,102,135,2,233,60,64,150,
+234,135,215,185,178,229,96,1,37,1,24,254,214,254,253,141,254,166,192,64,188,
+1,132,174,214,1,72,178,254,181,254,196,164,235,98,137,127,116,113,117,136,
+0,0,2,0,92,0,86,7,82,6,20,0,36,0,48,0,0,1,22,21,20,6,6,35,34,38,53,52,54,
+51,50,23,2,0,35,34,0,17,20,18,23,7,38,2,53,52,18,36,51,32,0,19,33,21,5,52,
+38,35,34,6,21,20,22,51,50,54,5,158,4,105,197,120,171,216,211,176,150,100,
+29,254,254,235,228,254,246,92,103,150,100,107,164,1,43,193,1,21,1,84,54,1,
+199,253,151,122,115,105,120,120,105,102,135,2,233,60,64,150,234,135,215,185,
+178,229,96,1,37,1,24,254,214,254,253,141,254,166,192,64,188,1,132,174,214,
+1,72,178,254,181,254,196,164,235,98,137,127,116,113,117,136,255,255,255,252,
+0,86,6,242,6,20,0,2,4,254,160,0,255,255,255,252,0,86,6,37,6,20,0,2,4,253,
+160,0,0,1,0,92,255,47,4,25,3,141,0,32,0,0,1,21,33,22,22,21,20,4,5,39,54,54,
+53,52,46,2,35,53,51,50,22,18,21,20,7,54,54,53,52,38,39,53,4,25,254,186,124,
+75,254,219,254,213,47,36,29,34,66,74,82,62,97,159,90,56,170,144,103,106,3,
+141,164,165,187,121,203,234,44,160,92,174,115,97,151,120,45,164,147,254,243,
+161,201,156,27,158,112,97,221,155,164,0,0,1,0,92,255,47,4,229,3,141,0,32,
+0,0,1,21,33,22,22,21,20,4,5,39,54,54,53,52,46,2,35,53,51,50,22,18,21,20,7,
+54,54,53,52,38,39,53,4,229,253,238,124,75,254,219,254,213,47,36,29,34,66,
+74,82,62,97,159,90,56,170,144,103,106,3,141,164,165,187,121,203,234,44,160,
+92,174,115,97,151,120,45,164,147,254,243,161,201,156,27,158,112,97,221,155,
+164,0,255,255,0,0,255,47,4,137,3,141,0,2,5,2,164,0,255,255,0,0,255,47,3,189,
+3,141,0,2,5,1,164,0,0,1,0,92,255,88,3,184,3,141,0,11,0,0,1,19,55,1,35,53,
+33,21,33,9,2,1,35,192,170,254,193,242,3,92,254,76,1,84,254,113,254,172,1,
+168,254,174,164,1,239,164,164,253,242,254,125,2,80,0,0,1,0,92,255,88,4,174,
+3,141,0,11,0,0,1,19,55,1,35,53,33,21,33,9,2,1,35,192,170,254,193,242,4,82,
+253,86,1,84,254,113,254,172,1,168,254,174,164,1,239,164,164,253,242,254,125,
+2,80,0,255,255,0,0,255,88,4,82,3,141,0,2,5,6,164,0,255,255,0,0,255,88,3,92,
+3,141,0,2,5,5,164,0,0,1,0,0,255,242,3,33,3,141,0,9,0,0,1,21,33,18,19,7,38,
+2,39,53,3,33,253,129,80,229,137,123,164,47,3,141,164,254,172,254,187,94,184,
+1,111,208,164,0,0,1,0,0,255,242,4,135,3,141,0,19,0,0,19,22,18,23,7,38,2,39,
+53,33,32,17,20,7,35,54,53,52,38,35,160,41,147,123,137,123,164,47,3,33,1,102,
+51,152,45,92,108,2,233,172,254,189,170,94,184,1,111,208,164,254,174,131,108,
+104,135,84,90,0,255,255,0,0,0,86,5,236,5,137,2,2,2,214,0,0,255,255,0,92,254,
+139,8,250,6,66,2,2,1,201,0,0,255,255,0,92,254,139,7,147,6,66,2,2,0,130,0,
+0,255,255,255,254,254,139,7,53,6,66,0,2,0,130,162,0,255,255,255,254,254,139,
+8,156,6,66,0,2,1,201,162,0,0,2,0,92,254,139,8,74,6,66,0,7,0,58,0,0,37,50,
+54,53,52,39,33,18,3,16,0,33,32,0,19,33,21,33,22,18,18,22,51,50,55,21,6,6,
+35,34,38,39,2,3,2,2,35,34,2,7,33,22,22,21,20,6,6,35,6,21,20,23,35,38,53,52,
+55,38,2,2,29,96,125,21,254,25,8,170,1,56,1,16,1,4,1,29,61,3,72,252,215,22,
+84,133,130,75,111,57,22,88,58,130,182,79,163,73,52,212,190,193,225,4,2,111,
+19,28,95,169,105,41,78,184,62,66,162,158,252,156,155,125,57,254,19,2,72,1,
+103,1,151,254,165,254,166,164,118,254,245,254,226,148,86,186,33,37,159,169,
+1,89,1,171,1,50,1,14,254,232,243,62,221,63,140,222,119,94,117,139,105,92,
+150,122,111,52,1,109,0,2,0,92,254,139,9,176,6,66,0,7,0,67,0,0,37,50,54,53,
+52,39,33,18,3,16,0,33,32,0,19,33,32,17,20,7,35,54,53,52,38,35,33,22,18,18,
+22,51,50,55,21,6,6,35,34,38,39,2,3,2,2,35,34,2,7,33,22,22,21,20,6,6,35,6,
+21,20,23,35,38,53,52,55,38,2,2,29,96,125,21,254,25,8,170,1,56,1,16,1,4,1,
+29,61,3,72,1,102,51,152,45,92,108,252,215,22,84,133,130,75,111,57,22,88,58,
+130,182,79,163,73,52,212,190,193,225,4,2,111,19,28,95,169,105,41,78,184,62,
+66,162,158,252,156,155,125,57,254,19,2,72,1,103,1,151,254,165,254,166,254,
+174,131,108,104,135,84,90,118,254,245,254,226,148,86,186,33,37,159,169,1,
+89,1,171,1,50,1,14,254,232,243,62,221,63,140,222,119,94,117,139,105,92,150,
+122,111,52,1,109,0,255,255,255,254,254,139,7,236,6,66,0,2,5,16,162,0,255,
+255,255,254,254,139,9,82,6,66,0,2,5,17,162,0,0,2,0,92,255,8,7,82,6,20,0,40,
+0,50,0,0,1,2,33,34,4,7,33,21,33,18,19,7,38,2,53,52,18,36,51,32,0,19,33,21,
+33,22,21,20,2,7,22,23,7,38,39,38,38,53,52,54,55,1,52,39,33,6,21,16,51,50,
+54,4,233,86,254,89,203,254,246,23,1,27,254,231,22,169,150,100,107,164,1,43,
+193,1,21,1,84,54,1,199,254,76,4,133,109,36,107,145,96,68,166,194,43,35,2,
+16,4,254,104,32,213,102,129,3,141,1,221,245,232,164,254,226,254,203,64,188,
+1,132,174,214,1,72,178,254,181,254,196,164,60,64,195,254,252,53,75,204,82,
+176,154,8,242,231,92,189,65,254,224,64,60,68,114,254,201,184,0,2,0,92,255,
+8,5,162,6,20,0,36,0,46,0,0,1,2,33,34,4,7,33,21,33,18,19,7,38,2,53,52,18,36,
+51,50,4,18,17,20,2,7,22,23,7,38,39,38,38,53,52,54,55,1,52,39,33,6,21,16,51,
+50,54,4,233,86,254,89,203,254,246,23,1,27,254,231,22,169,150,100,107,164,
+1,43,193,218,1,53,167,133,109,36,107,145,96,68,166,194,43,35,2,16,4,254,104,
+32,213,102,129,3,141,1,221,245,232,164,254,226,254,203,64,188,1,132,174,214,
+1,72,178,209,254,87,254,211,195,254,252,53,75,204,82,176,154,8,242,231,92,
+189,65,254,224,64,60,68,114,254,201,184,255,255,255,252,255,8,6,242,6,20,
+0,2,5,20,160,0,255,255,255,252,255,8,5,66,6,20,0,2,5,21,160,0,255,255,0,92,
+255,119,8,31,6,20,2,2,1,167,0,0,255,255,255,250,255,119,6,86,6,20,0,2,1,166,
+158,0,255,255,255,250,255,119,7,189,6,20,0,2,1,167,158,0,255,255,0,92,255,
+119,6,184,6,20,2,2,1,166,0,0,255,255,0,0,254,96,4,201,3,141,0,34,5,29,111,
+0,0,2,0,60,0,0,0,1,0,0,254,96,2,20,255,213,0,13,0,0,21,33,50,22,21,20,7,35,
+54,53,52,38,35,33,1,20,125,131,30,152,25,45,54,254,236,43,131,125,70,47,51,
+66,45,47,0,1,0,92,255,119,3,63,3,141,0,13,0,0,19,20,22,18,23,7,38,2,38,53,
+53,33,21,33,238,63,143,91,150,92,145,56,2,227,253,175,2,154,82,182,254,206,
+159,74,170,1,80,198,111,231,164,0,255,255,0,92,255,119,3,63,3,141,0,2,5,30,
+0,0,255,255,0,0,255,119,2,227,3,141,0,2,5,30,164,0,0,1,0,0,255,119,2,23,3,
+141,0,13,0,0,19,20,22,18,23,7,38,2,38,53,53,33,21,33,145,66,143,88,149,93,
+138,62,2,23,254,122,2,154,81,189,254,209,156,74,172,1,62,210,115,231,164,
+0,0,2,0,92,254,190,5,162,3,141,0,17,0,29,0,0,1,19,54,54,51,50,22,21,20,6,
+6,35,34,38,39,3,33,21,1,20,22,51,50,54,53,52,38,35,34,6,1,43,123,39,170,112,
+178,209,95,179,113,160,192,55,244,5,70,252,98,127,100,101,127,127,101,100,
+127,2,233,254,58,78,104,221,174,116,183,101,165,196,3,102,164,253,101,105,
+131,131,105,104,131,131,0,2,0,0,254,190,5,25,3,141,0,18,0,30,0,0,19,19,54,
+54,51,50,22,21,20,6,6,35,34,38,39,3,53,33,21,1,20,22,51,50,54,53,52,38,35,
+34,6,162,123,39,170,112,178,209,95,179,113,160,192,55,199,5,25,252,98,127,
+100,101,127,127,101,100,127,2,233,254,58,78,104,221,174,116,183,101,165,196,
+2,194,164,164,253,101,105,131,131,105,104,131,131,0,255,255,0,92,254,190,
+5,162,3,141,0,2,5,34,0,0,0,2,0,0,254,190,6,127,3,141,0,27,0,39,0,0,1,54,54,
+51,50,22,21,20,6,6,35,34,38,39,3,53,33,32,17,20,7,35,54,53,52,38,35,33,19,
+20,22,51,50,54,53,52,38,35,34,6,1,29,39,170,112,178,209,95,179,113,160,192,
+55,199,5,25,1,102,51,152,45,92,108,251,137,217,127,100,101,127,127,101,100,
+127,1,35,78,104,221,174,116,183,101,165,196,2,194,164,254,174,126,113,104,
+135,84,90,253,101,105,131,131,105,104,131,131,0,255,255,0,0,254,96,4,242,
+5,84,2,34,0,41,0,0,0,2,5,29,111,0,0,1,0,92,255,135,3,150,3,141,0,18,0,0,19,
+20,18,22,51,50,55,21,6,6,35,34,38,38,2,53,53,33,21,252,68,111,79,113,57,23,
+90,57,101,141,101,75,3,58,2,233,164,254,160,180,86,186,33,37,97,207,1,140,
+166,164,164,0,255,255,0,0,255,135,3,58,3,141,0,2,5,39,164,0,0,1,0,92,255,
+12,4,143,3,141,0,39,0,0,1,22,18,22,51,50,54,53,52,46,2,53,52,54,51,50,22,
+23,7,38,38,35,34,6,21,20,30,2,21,20,6,35,34,2,2,3,33,21,1,23,36,204,152,79,
+32,37,71,89,71,119,86,75,113,51,112,39,54,34,33,37,74,88,73,114,99,143,214,
+244,52,4,51,2,233,141,254,12,196,39,35,63,100,101,119,79,95,110,74,79,82,
+59,41,41,29,57,90,100,123,90,109,119,1,3,2,102,1,24,164,0,0,1,0,92,255,12,
+5,92,3,141,0,39,0,0,1,22,18,22,51,50,54,53,52,46,2,53,52,54,51,50,22,23,7,
+38,38,35,34,6,21,20,30,2,21,20,6,35,34,2,2,3,33,21,1,23,36,204,152,79,32,
+37,71,89,71,119,86,75,113,51,112,39,54,34,33,37,74,88,73,114,99,143,214,244,
+52,5,0,2,233,141,254,12,196,39,35,63,100,101,119,79,95,110,74,79,82,59,41,
+41,29,57,90,100,123,90,109,119,1,3,2,102,1,24,164,0,0,1,0,0,255,12,4,219,
+3,141,0,42,0,0,19,22,18,30,2,51,50,54,53,52,46,2,53,52,54,51,50,22,23,7,38,
+38,35,34,6,21,20,30,2,21,20,6,35,34,38,2,3,53,33,21,150,21,124,116,88,78,
+44,32,37,72,88,71,119,86,75,113,51,112,39,54,34,33,37,74,88,73,114,99,128,
+194,222,72,4,219,2,233,81,254,178,248,122,52,39,35,63,100,101,119,79,95,110,
+74,79,82,59,41,41,29,57,90,100,123,90,109,119,203,1,249,1,25,164,164,0,1,
+0,0,255,12,4,14,3,141,0,42,0,0,19,22,18,30,2,51,50,54,53,52,46,2,53,52,54,
+51,50,22,23,7,38,38,35,34,6,21,20,30,2,21,20,6,35,34,38,2,3,53,33,21,150,
+21,124,116,88,78,44,32,37,72,88,71,119,86,75,113,51,112,39,54,34,33,37,74,
+88,73,114,99,128,194,222,72,4,14,2,233,81,254,178,248,122,52,39,35,63,100,
+101,119,79,95,110,74,79,82,59,41,41,29,57,90,100,123,90,109,119,203,1,249,
+1,25,164,164,0,2,0,0,254,178,3,141,5,43,0,5,0,24,0,0,5,6,7,39,54,55,1,53,
+33,54,54,51,21,34,6,21,20,18,23,7,2,3,33,3,35,1,139,187,97,88,124,123,254,
+242,1,246,22,213,172,123,129,87,100,152,178,16,254,227,39,135,96,133,105,
+80,176,123,2,188,164,191,223,170,182,160,144,254,242,168,86,1,60,1,30,253,
+220,0,0,2,0,20,254,178,5,74,5,57,0,36,0,42,0,0,1,34,6,6,7,3,35,3,38,38,35,
+34,7,53,54,51,50,22,23,23,51,54,33,51,54,54,51,21,34,6,21,20,18,23,7,2,3,
+3,6,7,39,54,55,3,143,116,112,56,9,20,135,53,11,73,84,93,129,144,121,151,126,
+7,6,9,68,1,1,37,23,213,172,123,129,87,99,151,179,16,121,187,97,88,124,123,
+2,233,51,121,124,254,215,2,231,154,129,52,150,61,198,228,172,170,191,223,
+170,182,160,149,254,244,165,86,1,60,1,30,252,183,133,105,80,176,123,0,255,
+255,0,0,254,178,5,47,5,43,2,34,0,12,0,0,0,2,0,14,225,0,0,3,0,20,0,152,5,98,
+6,242,0,40,0,52,0,64,0,0,37,3,38,38,35,34,7,53,54,51,50,23,54,55,35,34,38,
+39,53,22,22,51,51,21,6,6,7,22,23,23,51,54,33,33,21,33,34,6,6,7,3,19,52,54,
+51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,207,53,11,
+73,84,93,129,144,121,69,56,37,59,57,174,148,47,52,156,161,245,71,82,11,33,
+6,6,9,68,1,1,1,213,254,45,116,112,56,9,20,131,145,99,99,145,145,99,99,145,
+105,79,60,59,82,82,59,60,79,152,2,231,154,129,52,150,61,22,135,90,37,41,160,
+38,36,135,105,188,102,95,168,172,170,164,51,121,124,254,215,4,131,101,142,
+142,101,102,142,142,102,60,82,82,60,59,80,80,0,255,255,255,250,255,12,6,240,
+6,20,0,2,0,116,158,0,255,255,255,250,255,12,8,86,6,20,0,2,1,241,158,0,255,
+255,0,92,255,12,8,184,6,20,2,2,1,241,0,0,255,255,0,92,255,12,7,82,6,20,2,
+2,0,116,0,0,255,255,0,92,255,119,8,205,6,66,2,2,1,118,0,0,255,255,0,0,255,
+119,7,10,6,66,0,2,0,113,164,0,255,255,0,0,255,119,8,113,6,66,0,2,1,118,164,
+0,255,255,0,92,255,119,7,102,6,66,2,2,0,113,0,0,255,255,0,92,255,119,8,31,
+6,20,2,2,1,142,0,0,255,255,0,92,254,110,8,31,6,20,2,34,1,142,0,0,0,35,0,14,
+0,190,255,188,0,3,0,14,2,119,255,188,255,255,255,250,255,119,7,189,6,20,0,
+2,1,142,158,0,255,255,255,250,254,110,7,189,6,20,0,34,1,142,158,0,0,34,0,
+14,92,188,0,3,0,14,2,20,255,188,255,255,0,92,255,119,6,184,6,20,2,2,0,22,
+0,0,255,255,0,92,254,110,6,184,6,20,2,34,0,22,0,0,0,35,0,14,0,190,255,188,
+0,3,0,14,2,119,255,188,255,255,255,250,255,119,6,86,6,20,0,2,0,22,158,0,255,
+255,255,250,254,110,6,86,6,20,0,34,0,22,158,0,0,34,0,14,92,188,0,3,0,14,2,
+20,255,188,0,1,0,82,0,88,3,129,6,31,0,40,0,0,1,22,22,21,20,6,35,34,38,39,
+55,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,51,
+50,22,21,20,6,7,2,139,117,129,221,189,106,197,102,78,84,153,86,127,131,159,
+172,207,207,172,159,131,127,86,153,84,78,190,215,187,223,129,117,3,55,41,
+176,131,183,204,55,66,153,59,55,131,104,119,143,164,144,118,105,131,55,60,
+154,121,202,185,131,177,41,0,1,0,82,1,88,8,25,5,31,0,58,0,0,1,54,55,23,2,
+17,35,2,2,38,35,34,6,21,20,22,51,50,54,53,51,20,6,35,34,38,39,38,38,35,34,
+6,21,20,22,51,50,54,53,51,20,6,35,34,38,53,52,18,51,50,22,23,51,54,54,51,
+50,18,19,6,238,45,110,144,199,164,54,116,141,121,127,141,90,78,65,72,164,
+154,147,146,164,32,29,160,137,127,141,90,78,65,72,164,154,147,150,178,233,
+195,147,191,59,6,48,188,129,195,227,67,3,4,252,219,65,254,134,254,103,1,25,
+1,68,147,189,157,142,143,84,72,152,172,211,219,193,176,189,157,142,143,84,
+72,152,172,231,222,240,1,18,127,129,123,133,254,239,254,246,0,0,3,0,82,255,
+109,7,137,7,10,0,57,0,115,0,173,0,0,1,20,6,35,34,38,53,52,54,51,50,22,23,
+51,54,54,51,32,19,51,54,55,23,6,6,7,35,38,38,35,34,6,21,20,22,51,50,54,53,
+51,20,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,54,53,19,20,6,35,34,38,53,
+52,54,51,50,22,23,51,54,54,51,32,19,51,54,55,23,6,6,7,35,38,38,35,34,6,21,
+20,22,51,50,54,53,51,20,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,54,53,
+19,20,6,35,34,38,53,52,54,51,50,22,23,51,54,54,51,32,19,51,54,55,23,6,6,7,
+35,38,38,35,34,6,21,20,22,51,50,54,53,51,20,6,35,34,38,39,38,38,35,34,6,21,
+20,22,51,50,54,53,2,63,131,112,121,129,156,161,140,182,72,6,28,166,129,1,
+67,191,6,41,111,135,76,98,33,127,106,213,143,115,98,69,64,53,61,136,129,132,
+103,134,86,57,150,111,100,88,61,54,47,65,135,131,112,121,129,156,161,140,
+182,72,6,28,166,129,1,67,191,6,41,111,135,76,98,33,127,106,213,143,115,98,
+69,64,53,61,136,129,132,107,134,82,57,150,111,100,88,61,54,47,65,135,131,
+112,121,129,156,161,140,182,72,6,28,166,129,1,67,191,6,41,111,135,76,98,33,
+127,106,213,143,115,98,69,64,53,61,136,129,132,104,135,84,57,150,111,100,
+88,61,54,47,65,3,2,115,127,146,137,145,170,127,112,117,122,254,117,176,213,
+61,127,238,139,220,212,98,76,65,80,55,47,115,127,102,146,98,113,96,78,70,
+75,53,49,253,92,114,127,145,137,146,170,127,113,117,123,254,116,176,213,61,
+127,238,139,220,212,98,76,65,80,55,47,114,127,108,139,99,112,96,78,69,76,
+53,49,5,72,115,127,146,137,145,170,127,112,116,123,254,117,176,213,61,127,
+238,139,220,212,98,76,66,80,56,47,115,127,105,143,98,113,96,78,70,76,54,49,
+0,3,0,72,1,14,6,244,5,104,0,13,0,27,0,56,0,0,1,6,7,7,23,22,23,51,54,55,55,
+39,38,39,33,6,7,7,23,22,23,51,54,55,55,39,38,39,5,54,55,55,51,1,35,39,38,
+39,35,6,6,7,35,1,1,51,23,22,23,51,54,55,55,51,23,22,23,4,39,55,70,80,80,70,
+55,8,55,70,80,80,70,55,253,158,55,70,80,80,70,55,8,55,70,80,80,70,55,3,135,
+55,70,98,185,253,129,148,98,74,51,8,68,42,113,148,254,193,1,63,148,98,70,
+55,8,55,70,98,148,98,70,55,4,186,118,125,140,139,125,119,119,125,139,140,
+125,118,118,125,140,139,125,119,119,125,139,140,125,118,241,118,125,172,251,
+166,170,125,119,138,80,196,2,45,2,45,172,125,118,118,125,172,172,125,118,
+0,255,255,255,252,0,143,3,60,5,2,0,2,2,104,160,0,255,255,255,252,254,65,3,
+156,5,2,0,35,0,14,0,219,0,106,0,35,0,14,1,242,255,143,0,2,2,104,160,0,0,1,
+255,242,0,109,3,154,6,176,0,20,0,0,37,38,38,2,53,53,51,3,51,3,51,20,18,23,
+16,18,55,51,6,2,17,2,23,152,241,142,31,45,180,47,33,104,121,196,160,189,187,
+200,109,8,167,1,39,166,164,1,129,254,127,254,254,247,71,1,191,2,226,208,232,
+253,43,254,76,0,255,255,2,20,1,172,3,18,4,213,0,35,0,128,0,0,254,246,0,3,
+0,128,0,0,1,10,255,255,0,0,254,178,5,47,5,43,0,34,0,12,0,0,0,2,0,14,225,0,
+0,2,0,92,0,18,7,94,6,66,0,40,0,48,0,0,1,22,22,21,20,6,6,35,34,2,17,16,0,33,
+50,0,19,33,21,33,21,16,33,51,50,22,23,21,38,35,35,34,38,53,53,16,2,35,34,
+2,7,1,50,54,53,52,39,33,18,3,109,19,28,95,169,107,232,229,1,69,1,23,253,1,
+65,28,2,76,253,189,1,24,84,76,111,28,61,154,84,213,229,221,228,204,234,4,
+1,31,96,125,21,254,25,8,3,141,62,221,63,140,222,119,1,118,1,124,1,106,1,148,
+254,148,254,183,164,206,254,217,31,25,170,56,229,236,227,1,68,1,86,254,233,
+244,253,111,156,155,125,57,254,19,0,2,0,92,0,18,8,150,6,66,0,40,0,48,0,0,
+1,22,22,21,20,6,6,35,34,2,17,16,0,33,50,0,19,33,21,33,21,16,33,51,50,22,23,
+21,38,35,35,34,38,53,53,16,2,35,34,2,7,1,50,54,53,52,39,33,18,3,109,19,28,
+95,169,107,232,229,1,69,1,23,253,1,65,28,3,132,252,133,1,24,84,76,111,28,
+61,154,84,213,229,221,228,204,234,4,1,31,96,125,21,254,25,8,3,141,62,221,
+63,140,222,119,1,118,1,124,1,106,1,148,254,148,254,183,164,206,254,217,31,
+25,170,56,229,236,227,1,68,1,86,254,233,244,253,111,156,155,125,57,254,19,
+0,2,0,92,0,18,10,119,6,66,0,51,0,59,0,0,37,38,35,33,32,17,17,16,2,35,34,2,
+7,33,22,22,21,20,6,6,35,34,2,17,16,0,33,50,4,18,21,17,20,51,51,17,33,32,17,
+20,7,35,54,53,52,38,35,33,17,51,50,23,37,50,54,53,52,39,33,18,7,217,61,154,
+254,223,254,152,221,228,204,234,4,2,111,19,28,95,169,107,232,229,1,69,1,23,
+187,1,21,147,198,68,2,235,1,103,51,152,45,92,109,253,183,59,150,65,250,68,
+96,125,21,254,25,8,18,56,1,127,1,53,1,68,1,86,254,233,244,62,221,63,140,222,
+119,1,118,1,124,1,106,1,148,201,254,129,252,254,203,213,2,153,254,174,126,
+113,104,135,84,90,254,11,56,64,156,155,125,57,254,19,0,2,0,92,0,18,9,16,6,
+66,0,42,0,50,0,0,37,38,35,33,32,17,17,16,2,35,34,2,7,33,22,22,21,20,6,6,35,
+34,2,17,16,0,33,50,4,18,21,17,20,51,51,17,33,21,33,17,51,50,23,37,50,54,53,
+52,39,33,18,7,217,61,154,254,223,254,152,221,228,204,234,4,2,111,19,28,95,
+169,107,232,229,1,69,1,23,187,1,21,147,198,68,2,235,253,183,59,150,65,250,
+68,96,125,21,254,25,8,18,56,1,127,1,53,1,68,1,86,254,233,244,62,221,63,140,
+222,119,1,118,1,124,1,106,1,148,201,254,129,252,254,203,213,2,153,164,254,
+11,56,64,156,155,125,57,254,19,0,255,255,255,254,0,18,8,56,6,66,0,2,5,76,
+162,0,255,255,255,254,0,18,7,0,6,66,0,2,5,75,162,0,255,255,255,254,0,18,8,
+178,6,66,0,2,5,78,162,0,255,255,255,254,0,18,10,25,6,66,0,2,5,77,162,0,0,
+4,0,92,255,8,6,4,6,66,0,22,0,29,0,37,0,46,0,0,5,38,39,34,39,6,6,35,34,2,17,
+52,18,36,51,50,4,18,21,16,5,22,23,1,32,0,7,33,38,0,19,50,54,54,55,33,21,16,
+1,20,22,22,51,50,54,53,53,4,240,96,68,204,85,41,168,92,218,200,177,1,78,226,
+221,1,66,168,254,240,63,78,253,188,254,248,254,236,29,4,84,35,254,231,50,
+103,114,57,2,254,31,253,125,54,108,94,98,127,248,176,154,194,98,96,1,92,1,
+82,247,1,123,208,209,254,132,245,253,218,107,140,137,6,62,254,233,244,246,
+1,21,251,100,96,219,178,159,254,178,1,237,174,223,96,166,168,159,0,0,4,0,
+92,255,8,7,180,6,66,0,25,0,32,0,40,0,49,0,0,5,38,39,34,39,6,6,35,34,2,17,
+52,18,36,51,50,4,18,23,33,21,33,2,5,22,23,1,32,0,7,33,38,0,19,50,54,54,55,
+33,21,16,1,20,22,22,51,50,54,53,53,4,240,96,68,204,85,41,168,92,218,200,177,
+1,78,226,197,1,44,182,24,1,184,254,80,7,254,247,63,78,253,188,254,248,254,
+236,29,4,84,35,254,231,50,103,114,57,2,254,31,253,125,54,108,94,98,127,248,
+176,154,194,98,96,1,92,1,82,247,1,123,208,166,254,198,213,164,253,238,104,
+140,137,6,62,254,233,244,246,1,21,251,100,96,219,178,159,254,178,1,237,174,
+223,96,166,168,159,0,255,255,255,254,255,8,7,86,6,66,0,2,5,84,162,0,255,255,
+255,254,255,8,5,166,6,66,0,2,5,83,162,0,255,255,0,92,0,82,6,4,6,66,2,2,0,
+44,0,0,255,255,0,92,0,82,7,180,6,66,2,2,0,46,0,0,255,255,255,254,0,82,7,86,
+6,66,0,2,0,46,162,0,255,255,255,254,0,82,5,166,6,66,0,2,0,44,162,0,255,255,
+0,92,0,82,6,4,6,66,2,2,0,44,0,0,255,255,0,92,0,82,7,180,6,66,2,2,0,46,0,0,
+255,255,255,254,0,82,7,86,6,66,0,2,0,46,162,0,255,255,255,254,0,82,5,166,
+6,66,0,2,0,44,162,0,255,255,0,92,253,227,9,0,8,55,2,34,1,94,0,0,0,3,0,14,
+2,20,8,10,255,255,0,92,0,82,7,37,8,55,2,34,0,92,0,0,0,3,0,14,2,20,8,10,255,
+255,255,254,0,82,6,199,8,55,0,34,0,92,162,0,0,3,0,14,1,182,8,10,255,255,255,
+254,253,227,8,162,8,55,0,34,1,94,162,0,0,3,0,14,1,182,8,10,255,255,255,254,
+255,119,7,53,6,66,0,2,0,21,162,0,255,255,255,254,255,119,8,156,6,66,0,2,0,
+202,162,0,255,255,0,92,255,119,7,147,6,66,2,2,0,21,0,0,255,255,0,92,255,119,
+8,250,6,66,2,2,0,202,0,0,255,255,0,92,0,82,6,4,8,49,2,34,0,44,0,0,0,3,0,14,
+2,133,8,4,255,255,0,92,0,82,7,180,8,49,2,34,0,46,0,0,0,3,0,14,2,133,8,4,255,
+255,255,254,0,82,7,86,8,49,0,34,0,46,162,0,0,3,0,14,2,41,8,4,255,255,255,
+254,0,82,5,166,8,49,0,34,0,44,162,0,0,3,0,14,2,41,8,4,255,255,255,254,255,
+119,9,170,6,66,0,2,0,70,162,0,255,255,255,254,0,82,5,166,6,66,0,2,0,44,162,
+0,255,255,0,92,255,119,10,8,6,66,2,2,0,70,0,0,255,255,0,92,0,82,7,180,6,66,
+0,2,0,46,0,0,255,255,0,92,255,119,8,250,6,66,2,2,0,202,0,0,255,255,0,92,255,
+119,7,147,6,66,2,2,0,21,0,0,255,255,255,254,255,119,7,53,6,66,0,2,0,21,162,
+0,255,255,255,254,255,119,8,156,6,66,0,2,0,202,162,0,255,255,0,92,255,119,
+8,250,6,66,2,2,0,202,0,0,255,255,0,92,255,119,7,147,6,66,2,2,0,21,0,0,255,
+255,255,254,255,119,7,53,6,66,0,2,0,21,162,0,255,255,255,254,255,119,8,156,
+6,66,0,2,0,202,162,0,0,1,0,92,0,18,7,174,6,20,0,39,0,0,19,16,0,51,50,22,18,
+23,33,21,33,21,16,33,51,50,23,21,38,35,35,34,38,53,17,16,2,35,34,2,17,20,
+18,23,7,38,38,39,7,35,92,1,12,228,145,211,119,10,3,125,252,133,1,25,84,150,
+65,62,153,84,213,230,163,162,150,184,181,192,127,96,129,31,17,135,3,90,1,
+64,1,122,156,254,216,195,164,206,254,217,56,170,56,229,236,1,32,1,19,1,28,
+254,250,254,246,139,254,184,207,112,110,190,69,244,0,1,0,92,0,18,6,119,6,
+20,0,37,0,0,19,16,0,51,50,0,19,33,21,33,21,16,33,51,50,23,21,38,35,35,34,
+38,53,17,16,2,35,34,2,17,20,18,23,7,38,39,7,35,92,1,12,228,209,1,3,17,2,70,
+253,188,1,25,84,150,65,62,153,84,213,230,163,162,150,184,181,192,127,172,
+84,17,135,3,90,1,64,1,122,254,177,254,200,164,206,254,217,56,170,56,229,236,
+1,32,1,19,1,28,254,250,254,246,139,254,184,207,112,191,177,243,255,255,0,
+0,0,18,7,82,6,20,0,2,5,119,164,0,255,255,0,0,0,18,6,27,6,20,0,2,5,120,164,
+0,0,1,0,92,0,18,9,143,6,20,0,50,0,0,19,16,0,51,50,0,17,17,20,51,51,17,33,
+32,17,20,7,35,54,53,52,38,35,33,17,51,50,22,23,21,38,35,33,34,38,53,17,16,
+2,35,34,2,17,20,18,23,7,38,39,7,35,92,1,12,228,224,1,7,199,67,2,236,1,102,
+51,151,45,92,109,253,182,60,75,111,29,62,153,254,223,176,185,163,162,150,
+184,181,192,127,172,84,17,135,3,90,1,64,1,122,254,128,254,167,254,142,213,
+2,153,254,174,131,108,108,131,84,90,254,11,31,25,170,56,190,193,1,114,1,19,
+1,28,254,250,254,246,139,254,184,207,112,191,177,243,0,0,1,0,92,0,18,8,41,
+6,20,0,41,0,0,19,16,0,51,50,0,17,17,20,51,51,17,33,21,33,17,51,50,22,23,21,
+38,35,33,34,38,53,17,16,2,35,34,2,17,20,18,23,7,38,39,7,35,92,1,12,228,224,
+1,7,199,67,2,236,253,182,60,75,111,29,62,153,254,223,176,185,163,162,150,
+184,181,192,127,172,84,17,135,3,90,1,64,1,122,254,128,254,167,254,142,213,
+2,153,164,254,11,31,25,170,56,190,193,1,114,1,19,1,28,254,250,254,246,139,
+254,184,207,112,191,177,243,255,255,0,0,0,18,7,205,6,20,0,2,5,124,164,0,255,
+255,0,0,0,18,9,51,6,20,0,2,5,123,164,0,0,2,0,92,255,8,5,162,6,20,0,36,0,46,
+0,0,19,52,18,36,51,50,4,18,17,20,6,7,22,23,7,38,39,34,38,53,52,54,55,33,2,
+33,34,0,21,20,18,23,7,38,39,7,35,1,52,39,33,6,21,16,51,50,54,92,161,1,41,
+198,218,1,53,167,123,98,58,89,145,96,68,176,209,43,35,1,249,86,254,89,227,
+254,245,166,166,127,145,70,17,135,4,164,4,254,104,32,213,102,129,3,68,221,
+1,71,172,209,254,87,254,211,187,252,57,130,161,82,176,154,242,239,92,189,
+65,1,221,254,233,249,158,254,182,206,92,183,138,237,1,209,64,60,68,114,254,
+201,184,0,0,2,0,92,255,8,7,82,6,20,0,40,0,50,0,0,19,52,18,36,51,32,0,19,33,
+21,33,22,21,20,6,7,22,23,7,38,39,34,38,53,52,54,55,33,2,33,34,0,21,20,18,
+23,7,38,39,7,35,1,52,39,33,6,21,16,51,50,54,92,161,1,41,198,1,21,1,84,54,
+1,199,254,76,4,123,98,58,89,145,96,68,176,209,43,35,1,249,86,254,89,227,254,
+245,166,166,127,145,70,17,135,4,164,4,254,104,32,213,102,129,3,68,221,1,71,
+172,254,181,254,196,164,60,64,187,252,57,130,161,82,176,154,242,239,92,189,
+65,1,221,254,233,249,158,254,182,206,92,183,138,237,1,209,64,60,68,114,254,
+201,184,0,255,255,0,0,255,8,6,246,6,20,0,2,5,128,164,0,255,255,0,0,255,8,
+5,70,6,20,0,2,5,127,164,0,255,255,0,92,253,227,7,207,5,209,2,2,1,138,0,0,
+255,255,0,92,0,86,5,244,5,209,2,2,0,96,0,0,255,255,255,250,0,86,5,146,5,209,
+0,2,0,96,158,0,255,255,255,250,253,227,7,109,5,209,0,2,1,138,158,0,255,255,
+0,92,0,82,5,162,6,20,2,2,0,94,0,0,255,255,0,92,0,82,7,82,6,20,2,2,0,95,0,
+0,255,255,255,252,0,82,6,242,6,20,0,2,0,95,160,0,255,255,255,252,0,82,5,66,
+6,20,0,2,0,94,160,0,255,255,0,92,255,119,8,31,6,20,2,2,1,142,0,0,255,255,
+0,92,255,12,7,82,6,20,2,2,0,116,0,0,255,255,255,250,255,12,6,240,6,20,0,2,
+0,116,158,0,255,255,255,250,255,119,7,189,6,20,0,2,1,142,158,0,255,255,0,
+92,255,119,6,184,6,20,2,2,2,63,0,0,255,255,0,0,255,119,6,92,6,20,0,2,2,63,
+164,0,255,255,0,0,255,119,7,195,6,20,0,2,2,64,164,0,255,255,0,92,255,119,
+8,31,6,20,2,2,2,64,0,0,255,255,0,92,255,119,8,31,6,20,2,2,1,142,0,0,255,255,
+0,92,254,110,8,31,6,20,2,34,1,142,0,0,0,35,0,14,0,190,255,188,0,3,0,14,2,
+119,255,188,255,255,0,92,255,119,6,184,6,20,2,2,0,22,0,0,255,255,0,92,254,
+110,6,184,6,20,2,34,0,22,0,0,0,35,0,14,0,190,255,188,0,3,0,14,2,119,255,188,
+255,255,255,250,255,119,6,86,6,20,0,2,0,22,158,0,255,255,255,250,254,110,
+6,86,6,20,0,34,0,22,158,0,0,34,0,14,92,188,0,3,0,14,2,20,255,188,255,255,
+255,250,255,119,7,189,6,20,0,2,1,142,158,0,255,255,255,250,254,110,7,189,
+6,20,0,34,1,142,158,0,0,34,0,14,92,188,0,3,0,14,2,20,255,188,255,255,255,
+252,0,86,3,164,5,209,0,2,0,107,160,0,255,255,0,92,0,86,5,74,5,209,0,2,2,103,
+0,0,255,255,255,252,0,86,3,164,5,209,0,2,0,107,160,0,255,255,255,252,0,86,
+3,166,5,209,2,2,0,58,0,0,255,255,255,252,0,86,3,166,5,209,2,2,0,58,0,0,255,
+255,0,0,255,242,3,33,3,141,2,2,5,9,0,0,255,255,0,20,255,119,6,193,5,57,2,
+2,0,59,0,0,0,1,0,0,2,233,2,147,6,176,0,9,0,0,17,53,51,54,18,55,51,6,2,3,163,
+42,163,103,188,129,190,41,2,233,164,245,1,163,139,162,254,31,254,188,0,1,
+0,0,1,166,3,223,3,141,0,5,0,0,1,35,19,33,53,33,3,76,172,98,252,254,3,223,
+1,166,1,67,164,0,0,1,0,20,0,152,7,207,5,57,0,26,0,0,1,35,19,33,34,6,6,7,3,
+35,3,38,38,35,34,7,53,54,51,50,22,23,23,51,54,33,33,7,59,172,99,252,157,116,
+112,56,9,20,135,53,11,73,84,93,129,144,121,151,126,7,6,9,68,1,1,4,66,1,166,
+1,67,51,121,124,254,215,2,231,154,129,52,150,61,198,228,172,170,0,0,1,0,92,
+253,227,5,123,3,141,0,43,0,0,19,33,50,22,21,20,6,7,6,6,21,20,23,35,38,53,
+52,54,55,62,2,53,52,38,35,33,22,21,7,55,54,51,50,23,21,38,35,34,7,54,53,52,
+39,92,3,70,235,238,117,156,77,60,43,168,39,88,107,86,96,37,151,164,253,88,
+33,4,12,43,47,168,117,117,168,146,141,29,29,3,141,211,196,113,251,201,100,
+132,88,79,79,68,90,98,200,142,111,156,111,67,123,120,122,148,70,1,6,52,163,
+51,51,104,172,145,127,0,0,1,0,0,254,176,2,117,5,39,0,27,0,0,19,50,18,21,20,
+2,7,14,2,21,20,23,35,38,53,52,54,55,62,2,53,52,38,35,35,53,156,235,238,106,
+167,54,60,23,43,168,39,85,110,96,90,33,152,163,154,5,39,254,244,242,176,254,
+237,217,68,104,83,64,79,79,68,90,96,196,148,126,161,142,118,176,170,164,0,
+1,0,0,0,197,6,35,3,141,0,8,0,0,1,35,19,33,3,35,3,53,33,5,143,172,99,251,143,
+39,135,39,6,35,1,166,1,67,253,220,2,36,164,0,0,1,0,20,0,152,7,150,5,137,0,
+47,0,0,37,6,35,34,2,3,35,34,6,6,7,3,35,3,38,38,35,34,7,53,54,51,50,22,23,
+23,51,54,33,51,54,18,51,50,18,19,7,38,38,35,34,6,21,20,22,51,50,55,6,104,
+81,103,208,227,15,95,116,112,56,9,20,135,53,11,73,84,93,129,144,121,151,126,
+7,6,9,68,1,1,97,18,248,198,207,245,20,164,17,155,136,141,164,145,146,112,
+72,219,51,1,37,1,28,51,121,124,254,215,2,231,154,129,52,150,61,198,228,172,
+170,246,1,6,254,188,254,210,21,229,248,203,210,254,242,51,0,1,255,252,0,168,
+3,166,5,137,0,23,0,0,37,6,35,34,2,17,16,18,51,50,18,19,7,38,38,35,34,6,21,
+20,22,51,50,55,2,121,83,101,221,232,252,215,206,246,19,164,16,156,135,141,
+164,144,147,112,72,219,51,1,80,1,74,1,16,1,55,254,187,254,211,21,229,248,
+203,210,253,243,51,0,0,1,0,0,2,233,3,113,3,141,0,3,0,0,17,33,21,33,3,113,
+252,143,3,141,164,0,0,1,0,0,0,197,4,131,3,141,0,7,0,0,17,33,21,33,3,35,3,
+33,4,131,254,82,39,135,39,254,0,3,141,164,253,220,2,36,0,1,0,0,0,197,3,80,
+3,141,0,7,0,0,19,35,53,33,21,33,3,35,205,205,3,80,254,82,39,135,2,233,164,
+164,253,220,0,1,2,0,1,190,3,96,4,184,0,14,0,0,1,20,6,6,7,53,54,54,53,52,38,
+39,53,22,22,3,96,76,146,130,96,90,90,96,190,162,3,59,123,163,84,11,160,10,
+101,110,111,100,11,159,14,189,255,255,2,0,1,190,5,35,4,184,0,34,5,173,0,0,
+0,3,5,173,1,195,0,0,255,255,2,0,0,105,7,231,5,84,0,35,5,226,0,0,1,154,0,3,
+5,227,0,0,254,164,255,255,2,0,1,0,7,231,5,217,0,35,5,226,0,0,254,68,0,3,5,
+227,0,0,0,233,0,1,2,0,2,96,3,170,4,25,0,5,0,0,1,6,7,39,54,55,3,170,186,152,
+88,124,177,3,139,134,165,80,184,177,0,2,2,0,2,72,3,231,4,47,0,11,0,23,0,0,
+1,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,2,104,
+80,60,59,82,82,59,60,80,104,143,101,98,145,144,99,101,143,3,59,59,82,82,59,
+60,80,80,60,101,143,140,104,103,140,143,0,16,0,98,0,86,4,94,4,82,0,7,0,15,
+0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,119,0,127,
+0,0,1,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,
+23,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,
+35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,
+53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,
+51,50,37,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,39,20,35,34,53,52,51,
+50,3,215,51,55,55,51,147,52,57,57,52,247,55,53,55,53,35,51,55,55,51,254,56,
+54,53,53,54,173,55,53,53,55,2,82,55,53,53,55,253,27,55,54,54,55,2,129,51,
+55,55,51,147,52,57,57,52,253,174,52,57,55,54,35,53,56,56,53,1,199,54,53,53,
+54,254,92,54,55,55,54,247,55,53,53,55,147,55,54,54,55,3,150,54,54,55,43,53,
+53,55,254,211,55,55,53,227,53,53,53,1,148,56,56,53,90,53,53,55,253,119,53,
+53,55,1,185,54,51,58,253,67,53,53,56,154,51,51,55,2,29,55,55,53,227,53,53,
+53,254,4,55,55,54,227,53,53,55,254,213,55,51,55,43,53,53,56,0,0,2,0,184,0,
+55,4,90,6,63,0,5,0,11,0,0,1,1,51,1,1,35,1,1,51,1,1,35,2,31,1,153,162,254,
+103,1,153,162,253,0,1,154,162,254,102,1,154,162,3,59,3,4,252,252,252,252,
+3,4,3,4,252,252,252,252,0,2,0,197,0,55,4,102,6,63,0,5,0,11,0,0,37,35,1,1,
+51,1,3,35,1,1,51,1,1,102,161,1,153,254,103,161,1,154,51,162,1,154,254,102,
+162,1,153,55,3,4,3,4,252,252,252,252,3,4,3,4,252,252,0,1,0,205,2,115,2,221,
+6,166,0,5,0,0,19,33,21,33,17,35,205,2,16,254,119,135,6,166,143,252,92,0,0,
+1,0,123,255,209,2,139,4,4,0,5,0,0,5,33,53,33,17,51,2,139,253,240,1,137,135,
+47,143,3,164,0,0,2,0,205,2,115,3,27,6,166,0,5,0,11,0,0,19,33,21,33,17,35,
+55,51,17,33,53,33,205,2,78,254,118,196,49,98,1,137,254,21,6,166,205,252,154,
+49,3,102,107,0,0,2,0,123,255,209,2,201,4,4,0,5,0,11,0,0,5,33,53,33,17,51,
+7,35,17,33,21,33,2,201,253,178,1,137,197,49,99,254,119,1,236,47,205,3,102,
+49,252,154,107,0,0,3,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,0,19,16,0,0,
+33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,
+5,21,33,34,39,22,22,23,7,1,53,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,
+254,36,254,239,254,239,254,36,254,237,103,247,1,172,246,247,1,172,247,247,
+254,84,247,246,254,84,247,6,43,252,131,151,81,26,39,148,116,254,225,3,59,
+1,18,1,219,1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,220,
+1,17,246,254,84,247,247,1,172,246,247,1,172,247,247,254,84,118,176,6,25,49,
+194,92,1,125,149,0,3,0,102,255,59,8,102,7,59,0,15,0,31,0,38,0,0,19,16,0,0,
+33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,
+1,1,17,35,17,51,1,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,
+239,254,239,254,36,254,237,103,247,1,172,246,247,1,172,247,247,254,84,247,
+246,254,84,247,6,43,251,127,162,133,4,158,3,59,1,18,1,219,1,19,254,238,254,
+35,254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,84,247,247,1,172,
+246,247,1,172,247,247,254,84,253,226,2,54,253,24,3,168,253,207,0,3,0,102,
+255,59,8,102,7,59,0,15,0,31,0,58,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,
+0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,37,17,35,1,46,2,35,34,6,21,
+20,22,23,7,38,38,53,52,54,51,50,22,23,1,51,17,102,1,18,1,219,1,19,1,17,1,
+221,1,18,254,237,254,36,254,239,254,239,254,36,254,237,103,247,1,172,246,
+247,1,172,247,247,254,84,247,246,254,84,247,6,43,144,254,166,148,138,125,
+70,104,107,68,59,119,67,94,190,162,127,245,187,1,0,6,3,59,1,18,1,219,1,19,
+254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,84,
+247,247,1,172,246,247,1,172,247,247,254,84,220,252,103,1,106,158,113,51,133,
+107,102,152,80,96,82,211,139,195,225,151,207,254,231,2,182,0,3,0,102,255,
+59,8,102,7,59,0,15,0,31,0,71,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,0,0,
+19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,37,50,22,23,51,54,54,51,50,18,
+17,20,6,7,35,54,53,16,35,34,6,21,21,35,53,52,38,35,34,6,21,20,22,23,7,38,
+38,53,52,54,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,239,254,
+239,254,36,254,237,103,247,1,172,246,247,1,172,247,247,254,84,247,246,254,
+84,247,2,57,135,156,27,6,20,160,131,187,206,30,41,164,86,250,117,106,150,
+131,106,93,100,62,47,125,56,79,182,3,59,1,18,1,219,1,19,254,238,254,35,254,
+239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,84,247,247,1,172,246,247,
+1,172,247,247,254,84,171,155,134,168,164,254,234,255,0,111,186,86,185,198,
+1,90,199,186,131,133,174,172,133,117,111,159,76,88,74,219,141,219,213,0,0,
+4,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,50,0,0,19,16,0,0,33,32,0,0,17,
+16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,37,21,33,21,
+33,17,35,1,53,33,53,17,33,34,39,21,22,23,1,102,1,18,1,219,1,19,1,17,1,221,
+1,18,254,237,254,36,254,239,254,239,254,36,254,237,103,247,1,172,246,247,
+1,172,247,247,254,84,247,246,254,84,247,5,6,1,37,254,219,148,252,150,3,98,
+254,133,153,137,95,48,2,14,3,59,1,18,1,219,1,19,254,238,254,35,254,239,254,
+236,254,38,254,238,1,19,1,220,1,17,246,254,84,247,247,1,172,246,247,1,172,
+247,247,254,84,218,200,174,253,108,2,139,183,200,254,138,10,8,47,37,254,108,
+0,3,0,102,255,59,8,102,7,59,0,15,0,31,0,59,0,0,19,16,0,0,33,32,0,0,17,16,
+0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,5,52,54,51,50,18,
+21,20,7,35,54,54,53,52,38,35,34,6,21,20,23,7,37,17,51,17,5,38,102,1,18,1,
+219,1,19,1,17,1,221,1,18,254,237,254,36,254,239,254,239,254,36,254,237,103,
+247,1,172,246,247,1,172,247,247,254,84,247,246,254,84,247,2,254,206,183,207,
+235,71,168,41,47,144,129,125,131,27,51,253,139,162,1,104,20,3,59,1,18,1,219,
+1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,
+84,247,247,1,172,246,247,1,172,247,247,254,84,253,220,245,254,238,248,223,
+138,72,199,92,162,174,162,180,94,142,88,53,2,189,253,221,33,117,0,4,0,102,
+255,59,8,102,7,59,0,15,0,31,0,57,0,71,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,
+32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,1,32,36,2,53,52,55,51,
+6,21,20,22,22,23,53,38,38,53,52,54,51,50,22,21,20,4,19,52,38,35,34,6,21,20,
+22,22,51,50,54,54,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,
+239,254,239,254,36,254,237,103,247,1,172,246,247,1,172,247,247,254,84,247,
+246,254,84,247,3,250,254,248,254,182,180,14,153,22,114,215,187,66,90,215,
+189,209,235,254,202,161,144,151,123,139,66,108,57,86,153,87,3,59,1,18,1,219,
+1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,
+84,247,247,1,172,246,247,1,172,247,247,254,84,253,18,137,1,26,222,114,58,
+74,94,154,199,104,10,12,43,158,125,185,218,241,203,222,253,1,217,121,147,
+131,131,82,138,77,74,132,0,5,0,102,255,59,8,102,7,59,0,15,0,31,0,55,0,68,
+0,80,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,
+52,2,36,35,34,4,2,23,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,
+6,6,35,34,38,5,50,54,53,52,38,35,34,6,7,7,22,22,1,20,22,51,50,54,55,38,38,
+35,34,6,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,239,254,239,
+254,36,254,237,103,247,1,172,246,247,1,172,247,247,254,84,247,246,254,84,
+247,244,170,145,96,156,69,77,172,106,165,197,188,168,112,182,58,56,157,119,
+143,170,3,229,92,123,121,98,92,121,49,13,52,129,253,10,94,86,76,113,55,50,
+120,74,86,94,3,59,1,18,1,219,1,19,254,238,254,35,254,239,254,236,254,38,254,
+238,1,19,1,220,1,17,246,254,84,247,247,1,172,246,247,1,172,247,247,254,84,
+249,197,223,123,141,168,139,248,209,227,239,147,139,102,139,224,93,139,147,
+142,145,156,129,30,127,131,1,26,104,135,108,142,129,104,133,0,4,0,102,255,
+59,8,102,7,59,0,15,0,31,0,56,0,70,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,
+0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,37,32,4,18,21,20,7,35,54,
+53,52,38,37,21,22,22,21,20,6,35,34,38,53,52,36,3,20,22,51,50,54,53,52,38,
+38,35,34,6,6,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,239,254,
+239,254,36,254,237,103,247,1,172,246,247,1,172,247,247,254,84,247,246,254,
+84,247,3,55,1,8,1,76,178,18,152,25,248,254,246,63,88,207,192,203,243,1,56,
+163,143,152,121,139,66,106,59,86,152,86,3,59,1,18,1,219,1,19,254,238,254,
+35,254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,84,247,247,1,172,
+246,247,1,172,247,247,254,84,218,140,254,229,220,117,59,88,84,224,233,10,
+12,43,158,129,178,219,239,207,224,249,254,39,119,149,127,133,82,141,76,75,
+131,0,0,5,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,54,0,66,0,0,19,16,0,0,
+33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,
+1,21,33,34,39,22,22,23,7,1,53,1,32,4,21,20,4,33,32,36,53,52,36,1,50,54,53,
+52,38,35,34,6,21,20,22,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,
+254,239,254,239,254,36,254,237,103,247,1,172,246,247,1,172,247,247,254,84,
+247,246,254,84,247,5,225,252,248,137,74,15,27,148,110,254,250,2,71,1,46,1,
+44,254,193,254,229,254,198,254,224,1,60,1,30,230,227,225,232,229,227,227,
+3,59,1,18,1,219,1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,
+220,1,17,246,254,84,247,247,1,172,246,247,1,172,247,247,254,84,253,243,170,
+6,12,27,172,86,1,64,141,3,164,181,192,190,181,186,185,190,183,253,196,88,
+111,111,88,88,111,111,88,0,5,0,102,255,59,8,102,7,59,0,15,0,31,0,43,0,55,
+0,82,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,
+52,2,36,35,34,4,2,1,32,4,21,20,4,33,32,36,53,52,36,1,50,54,53,52,38,35,34,
+6,21,20,22,5,17,35,37,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,30,
+2,5,51,17,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,239,254,
+239,254,36,254,237,103,247,1,172,246,247,1,172,247,247,254,84,247,246,254,
+84,247,3,131,1,41,1,49,254,192,254,230,254,198,254,224,1,59,1,31,229,228,
+228,229,230,227,227,3,48,138,254,209,168,162,90,88,90,60,53,115,61,86,170,
+143,59,105,116,126,1,49,8,3,59,1,18,1,219,1,19,254,238,254,35,254,239,254,
+236,254,38,254,238,1,19,1,220,1,17,246,254,84,247,247,1,172,246,247,1,172,
+247,247,254,84,1,220,167,183,180,168,175,173,178,172,253,242,78,98,98,78,
+78,98,98,78,229,253,114,242,133,74,74,59,60,104,55,95,60,147,117,137,160,
+26,55,88,237,1,181,0,0,4,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,53,0,0,
+19,16,0,0,33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,
+35,34,4,2,1,21,33,34,39,22,22,23,7,1,53,1,21,33,34,39,22,23,23,7,1,53,102,
+1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,239,254,239,254,36,254,
+237,103,247,1,172,246,247,1,172,247,247,254,84,247,246,254,84,247,5,225,252,
+248,137,74,14,25,151,110,254,250,4,145,252,248,137,74,25,61,104,110,254,250,
+3,59,1,18,1,219,1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,
+220,1,17,246,254,84,247,247,1,172,246,247,1,172,247,247,254,84,254,48,170,
+6,11,25,174,86,1,63,141,2,185,170,6,21,69,121,86,1,63,142,0,0,4,0,102,255,
+59,8,102,7,59,0,15,0,31,0,42,0,70,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,
+0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,1,21,33,34,39,22,22,23,7,
+1,53,1,17,35,1,46,2,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,22,23,23,
+51,17,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,239,254,239,
+254,36,254,237,103,247,1,172,246,247,1,172,247,247,254,84,247,246,254,84,
+247,5,225,252,248,137,74,15,27,148,110,254,250,4,145,135,254,207,152,109,
+101,56,90,92,59,53,114,60,86,172,144,74,133,140,152,211,8,3,59,1,18,1,219,
+1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,
+84,247,247,1,172,246,247,1,172,247,247,254,84,253,243,170,6,12,27,172,86,
+1,64,141,3,156,253,26,1,27,136,76,34,95,75,76,119,64,94,68,168,123,157,181,
+48,99,142,197,2,13,0,4,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,81,0,0,19,
+16,0,0,33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,
+34,4,2,1,21,33,34,39,22,22,23,7,1,53,1,50,22,23,51,54,54,51,50,22,21,20,7,
+35,54,54,53,52,38,35,34,6,21,21,35,53,16,35,34,6,21,20,22,23,7,38,53,52,54,
+102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,254,36,254,239,254,239,254,36,
+254,237,103,247,1,172,246,247,1,172,247,247,254,84,247,246,254,84,247,5,225,
+252,248,142,69,14,26,150,110,254,250,1,12,119,141,23,6,16,143,117,171,181,
+63,158,39,39,113,102,98,94,142,203,77,88,55,39,119,119,158,3,59,1,18,1,219,
+1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,
+84,247,247,1,172,246,247,1,172,247,247,254,84,253,222,170,7,12,27,172,86,
+1,63,141,3,115,127,102,131,131,227,201,183,124,69,158,72,139,117,142,149,
+96,98,1,8,92,90,86,121,53,84,148,200,172,178,0,0,5,0,102,255,59,8,102,7,59,
+0,15,0,31,0,42,0,53,0,61,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,0,0,19,20,
+18,4,51,50,36,18,53,52,2,36,35,34,4,2,1,21,33,34,39,22,22,23,7,1,53,1,21,
+33,21,33,17,35,1,53,33,53,17,33,34,39,21,22,23,1,102,1,18,1,219,1,19,1,17,
+1,221,1,18,254,237,254,36,254,239,254,239,254,36,254,237,103,247,1,172,246,
+247,1,172,247,247,254,84,247,246,254,84,247,5,225,252,248,142,69,14,26,150,
+110,254,250,3,143,1,2,254,254,137,252,250,2,252,254,196,164,94,73,56,1,189,
+3,59,1,18,1,219,1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,
+220,1,17,246,254,84,247,247,1,172,246,247,1,172,247,247,254,84,253,222,170,
+7,12,27,172,86,1,63,141,3,160,147,168,254,8,1,246,170,147,254,197,8,6,33,
+33,254,232,0,0,4,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,71,0,0,19,16,0,
+0,33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,
+2,1,21,33,34,39,22,22,23,7,1,53,1,52,54,51,50,22,21,20,7,35,54,54,53,52,38,
+35,34,21,20,22,23,7,37,17,51,17,5,38,38,102,1,18,1,219,1,19,1,17,1,221,1,
+18,254,237,254,36,254,239,254,239,254,36,254,237,103,247,1,172,246,247,1,
+172,247,247,254,84,247,246,254,84,247,5,225,252,248,137,74,15,27,148,110,
+254,250,1,186,182,166,187,208,63,160,35,43,113,120,220,15,10,47,253,203,153,
+1,51,4,14,3,59,1,18,1,219,1,19,254,238,254,35,254,239,254,236,254,38,254,
+238,1,19,1,220,1,17,246,254,84,247,247,1,172,246,247,1,172,247,247,254,84,
+253,216,170,6,12,27,172,86,1,64,141,2,47,162,199,215,205,188,101,55,160,72,
+115,133,254,43,103,32,78,41,2,55,254,94,24,26,78,0,0,5,0,102,255,59,8,102,
+7,59,0,15,0,31,0,42,0,67,0,79,0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,0,0,
+19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,1,21,33,34,39,22,22,23,7,1,53,
+37,34,36,38,53,52,55,51,6,21,20,22,22,23,53,38,53,52,54,51,50,22,21,20,4,
+19,52,38,35,34,6,21,20,22,51,50,54,102,1,18,1,219,1,19,1,17,1,221,1,18,254,
+237,254,36,254,239,254,239,254,36,254,237,103,247,1,172,246,247,1,172,247,
+247,254,84,247,246,254,84,247,5,225,252,248,142,69,14,26,150,110,254,250,
+2,157,236,254,220,160,15,145,18,94,182,166,137,186,174,187,210,254,237,132,
+123,129,104,121,119,80,115,163,3,59,1,18,1,219,1,19,254,238,254,35,254,239,
+254,236,254,38,254,238,1,19,1,220,1,17,246,254,84,247,247,1,172,246,247,1,
+172,247,247,254,84,253,224,170,7,12,27,172,86,1,63,141,177,112,229,179,93,
+48,52,81,119,154,81,9,9,82,170,143,172,193,165,180,203,1,124,87,106,92,96,
+87,124,113,0,4,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,49,0,0,19,16,0,0,
+33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,
+1,21,33,34,39,22,22,23,7,1,53,1,1,17,35,17,51,1,102,1,18,1,219,1,19,1,17,
+1,221,1,18,254,237,254,36,254,239,254,239,254,36,254,237,103,247,1,172,246,
+247,1,172,247,247,254,84,247,246,254,84,247,6,10,252,248,137,74,15,27,148,
+110,254,250,4,145,252,8,153,125,4,20,3,59,1,18,1,219,1,19,254,238,254,35,
+254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,84,247,247,1,172,246,
+247,1,172,247,247,254,84,253,243,170,6,12,27,172,86,1,64,141,1,22,1,179,253,
+196,2,244,254,78,0,6,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,65,0,78,0,90,
+0,0,19,16,0,0,33,32,0,0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,
+2,36,35,34,4,2,1,21,33,34,39,22,22,23,7,1,53,3,52,54,51,50,22,23,54,54,51,
+50,22,21,20,6,35,34,39,6,6,35,34,38,5,50,54,53,52,38,35,34,6,7,7,22,22,37,
+20,22,51,50,54,55,38,38,35,34,6,102,1,18,1,219,1,19,1,17,1,221,1,18,254,237,
+254,36,254,239,254,239,254,36,254,237,103,247,1,172,246,247,1,172,247,247,
+254,84,247,246,254,84,247,5,225,252,248,142,69,14,26,150,110,254,250,19,153,
+128,106,133,48,66,153,98,147,172,165,148,206,109,49,140,108,125,154,3,119,
+78,104,102,82,80,108,39,11,43,113,253,100,80,74,82,92,35,33,94,82,74,80,3,
+59,1,18,1,219,1,19,254,238,254,35,254,239,254,236,254,38,254,238,1,19,1,220,
+1,17,246,254,84,247,247,1,172,246,247,1,172,247,247,254,84,253,222,170,7,
+12,27,172,86,1,63,141,2,33,159,179,119,86,124,116,203,166,182,193,222,78,
+109,186,57,103,104,105,104,115,88,24,90,99,207,76,94,103,71,70,98,94,0,0,
+5,0,102,255,59,8,102,7,59,0,15,0,31,0,42,0,68,0,80,0,0,19,16,0,0,33,32,0,
+0,17,16,0,0,33,32,0,0,19,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,1,21,33,
+34,39,22,22,23,7,1,53,1,50,4,22,21,20,7,35,54,53,52,38,39,21,22,22,21,20,
+6,35,34,38,53,52,54,54,3,20,22,51,50,54,53,52,38,35,34,6,102,1,18,1,219,1,
+19,1,17,1,221,1,18,254,237,254,36,254,239,254,239,254,36,254,237,103,247,
+1,172,246,247,1,172,247,247,254,84,247,246,254,84,247,5,225,252,248,137,74,
+15,27,148,110,254,250,1,241,234,1,38,160,14,145,20,207,237,57,80,184,174,
+187,213,123,234,213,125,129,104,119,116,83,117,161,3,59,1,18,1,219,1,19,254,
+238,254,35,254,239,254,236,254,38,254,238,1,19,1,220,1,17,246,254,84,247,
+247,1,172,246,247,1,172,247,247,254,84,253,243,170,6,12,27,172,86,1,64,141,
+3,145,111,228,181,94,49,56,79,174,178,10,8,35,116,103,141,172,194,164,114,
+176,93,254,131,86,106,92,96,87,126,115,0,0,1,0,82,2,236,2,66,3,139,0,3,0,
+0,19,53,33,21,82,1,240,2,236,159,159,0,0,1,0,82,2,236,3,174,3,139,0,3,0,0,
+19,53,33,21,82,3,92,2,236,159,159,0,0,1,0,82,2,236,7,174,3,139,0,3,0,0,19,
+53,33,21,82,7,92,2,236,159,159,0,255,255,0,92,254,110,8,184,6,20,2,34,0,190,
+0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,254,255,188,255,255,0,92,0,82,5,162,
+6,20,2,2,0,94,0,0,255,255,255,252,254,110,6,242,6,20,0,35,0,14,0,139,255,
+188,0,35,0,14,2,158,255,188,0,2,0,95,160,0,255,255,255,252,255,119,9,78,6,
+20,0,2,0,105,160,0,255,255,255,252,0,82,8,88,6,20,0,2,0,190,160,0,255,255,
+0,92,254,110,5,162,6,20,2,34,0,94,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,
+252,255,188,255,255,0,92,0,82,8,184,6,20,2,2,0,190,0,0,255,255,0,92,254,110,
+9,174,6,20,2,34,0,105,0,0,0,35,0,14,0,236,255,188,0,3,0,14,2,254,255,188,
+255,255,0,92,0,82,7,82,6,20,2,2,0,95,0,0,255,255,255,252,255,119,9,78,6,20,
+0,2,0,105,160,0,255,255,0,92,0,82,8,184,6,20,2,2,0,190,0,0,255,255,255,252,
+255,119,9,78,6,20,0,2,0,105,160,0,255,255,255,252,0,82,8,88,6,20,0,2,0,190,
+160,0,255,255,255,252,0,82,8,88,6,20,0,2,0,190,160,0,0,1,0,92,0,88,3,139,
+6,31,0,40,0,0,1,38,38,53,52,54,51,50,23,7,38,38,35,34,6,21,20,22,51,51,21,
+35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,55,1,82,117,129,224,
+186,215,190,78,84,153,86,127,131,160,172,206,206,172,160,131,127,86,153,84,
+78,102,197,106,190,220,129,117,3,63,41,177,131,184,203,121,154,60,55,131,
+105,118,144,164,143,119,104,131,55,59,153,66,55,204,183,131,176,41,255,255,
+0,20,0,152,5,98,6,242,0,2,5,48,0,0,0,3,254,201,0,197,4,6,6,14,0,22,0,34,0,
+46,0,0,17,53,51,54,55,35,34,38,39,53,22,22,51,51,21,6,6,7,33,21,33,3,35,1,
+52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,33,9,85,
+70,171,147,50,59,153,156,246,59,64,4,3,86,252,207,39,135,1,86,142,102,100,
+143,143,100,101,143,104,80,60,59,82,82,59,60,80,2,233,164,217,183,34,43,160,
+41,32,136,110,205,113,164,253,220,4,86,100,143,142,101,101,143,143,101,60,
+82,82,60,59,80,80,0,2,2,20,2,188,7,231,3,186,0,3,0,15,0,0,1,21,5,53,5,34,
+38,53,52,54,51,50,22,21,20,6,6,47,251,229,5,72,76,61,61,76,74,65,65,3,119,
+117,51,219,238,74,53,52,75,75,52,53,74,0,0,2,2,0,1,197,7,231,4,240,0,29,0,
+40,0,0,1,35,34,38,39,46,2,35,34,6,21,20,22,23,7,38,53,52,54,51,50,30,2,23,
+22,22,51,51,5,34,53,52,54,51,50,22,21,20,6,6,47,55,112,141,95,88,81,81,56,
+98,106,51,35,144,100,193,165,70,104,89,81,48,83,112,91,35,1,45,137,61,76,
+74,65,65,2,203,64,108,104,69,32,127,121,103,153,72,63,191,212,197,211,35,
+62,90,55,99,65,190,127,51,74,74,51,56,71,0,0,1,0,0,0,197,2,131,3,141,0,6,
+0,0,17,53,33,21,33,3,35,2,131,254,82,39,135,2,233,164,164,253,220,0,255,255,
+0,20,253,227,6,8,6,119,0,34,0,11,0,0,0,3,3,165,2,162,0,0,255,255,0,92,253,
+227,5,163,5,2,0,34,2,104,0,0,0,3,3,165,2,61,0,0,0,0,0,0,0,15,0,186,0,3,0,
+1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,38,0,94,0,3,0,1,4,9,0,2,0,14,0,132,0,
+3,0,1,4,9,0,3,0,76,0,146,0,3,0,1,4,9,0,4,0,38,0,94,0,3,0,1,4,9,0,5,0,30,0,
+222,0,3,0,1,4,9,0,6,0,34,0,252,0,3,0,1,4,9,0,7,0,68,1,30,0,3,0,1,4,9,0,8,
+0,42,1,98,0,3,0,1,4,9,0,9,0,40,1,140,0,3,0,1,4,9,0,10,0,96,1,180,0,3,0,1,
+4,9,0,11,0,62,2,20,0,3,0,1,4,9,0,12,0,60,2,82,0,3,0,1,4,9,0,13,2,150,2,142,
+0,3,0,1,4,9,0,14,0,52,5,36,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,77,0,111,0,110,0,103,
+0,111,0,108,0,105,0,97,0,110,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,
+115,0,32,0,77,0,111,0,110,0,103,0,111,0,108,0,105,0,97,0,110,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,
+0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,77,0,111,0,110,0,103,0,111,0,108,
+0,105,0,97,0,110,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,
+116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,
+97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,
+32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,
+0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,
+0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,
+0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,
+0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,
+110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,
+101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,
+0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,
+111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,
+0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,
+0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,
+73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,
+0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,
+0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,
+0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,
+120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,
+0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,
+0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,
+0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,
+0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,5,231,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,
+1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,
+1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,
+1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,
+1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,
+1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,
+1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,
+102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,
+1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,
+127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,
+1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,
+152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,
+1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,
+177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,
+1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,
+202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,
+1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,1,226,1,
+227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,238,1,239,
+1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,1,251,1,
+252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,
+12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,
+2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,
+2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,
+2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,
+2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,
+2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,
+101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,113,
+2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,
+126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,
+2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,
+151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,
+2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,
+176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,
+2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,2,
+201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,
+2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,
+226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,
+2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,2,
+251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,
+3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,
+3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,
+3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,
+3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,
+3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,
+3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,
+3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,3,111,3,112,3,
+113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,
+3,126,3,127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,
+138,3,139,3,140,3,141,3,142,3,143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,
+3,151,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,3,162,3,
+163,3,164,3,165,3,166,3,167,3,168,3,169,3,170,3,171,3,172,3,173,3,174,3,175,
+3,176,3,177,3,178,3,179,3,180,3,181,3,182,3,183,3,184,3,185,3,186,3,187,3,
+188,3,189,3,190,3,191,3,192,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,200,
+3,201,3,202,3,203,3,204,3,205,3,206,3,207,3,208,3,209,3,210,3,211,3,212,3,
+213,3,214,3,215,3,216,3,217,3,218,3,219,3,220,3,221,3,222,3,223,3,224,3,225,
+3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,
+238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,
+3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,
+4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,19,4,20,4,21,4,22,4,23,4,24,4,25,
+4,26,4,27,4,28,4,29,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,
+4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,
+4,56,4,57,4,58,4,59,4,60,4,61,4,62,4,63,4,64,4,65,4,66,4,67,4,68,4,69,4,70,
+4,71,4,72,4,73,4,74,4,75,4,76,4,77,4,78,4,79,4,80,4,81,4,82,4,83,4,84,4,85,
+4,86,4,87,4,88,4,89,4,90,4,91,4,92,4,93,4,94,4,95,4,96,4,97,4,98,4,99,4,100,
+4,101,4,102,4,103,4,104,4,105,4,106,4,107,4,108,4,109,4,110,4,111,4,112,4,
+113,4,114,4,115,4,116,4,117,4,118,4,119,4,120,4,121,4,122,4,123,4,124,4,125,
+4,126,4,127,4,128,4,129,4,130,4,131,4,132,4,133,4,134,4,135,4,136,4,137,4,
+138,4,139,4,140,4,141,4,142,4,143,4,144,4,145,4,146,4,147,4,148,4,149,4,150,
+4,151,4,152,4,153,4,154,4,155,4,156,4,157,4,158,4,159,4,160,4,161,4,162,4,
+163,4,164,4,165,4,166,4,167,4,168,4,169,4,170,4,171,4,172,4,173,4,174,4,175,
+4,176,4,177,4,178,4,179,4,180,4,181,4,182,4,183,4,184,4,185,4,186,4,187,4,
+188,4,189,4,190,4,191,4,192,4,193,4,194,4,195,4,196,4,197,4,198,4,199,4,200,
+4,201,4,202,4,203,4,204,4,205,4,206,4,207,4,208,4,209,4,210,4,211,4,212,4,
+213,4,214,4,215,4,216,4,217,4,218,4,219,4,220,4,221,4,222,4,223,4,224,4,225,
+4,226,4,227,4,228,4,229,4,230,4,231,4,232,4,233,4,234,4,235,4,236,4,237,4,
+238,4,239,4,240,4,241,4,242,4,243,4,244,4,245,4,246,4,247,4,248,4,249,4,250,
+4,251,4,252,4,253,4,254,4,255,5,0,5,1,5,2,5,3,5,4,5,5,5,6,5,7,5,8,5,9,5,10,
+5,11,5,12,5,13,5,14,5,15,5,16,5,17,5,18,5,19,5,20,5,21,5,22,5,23,5,24,5,25,
+5,26,5,27,5,28,5,29,5,30,5,31,5,32,5,33,5,34,5,35,5,36,5,37,5,38,5,39,5,40,
+5,41,5,42,5,43,5,44,5,45,5,46,5,47,5,48,5,49,5,50,5,51,5,52,5,53,5,54,5,55,
+5,56,5,57,5,58,5,59,5,60,5,61,5,62,5,63,5,64,5,65,5,66,5,67,5,68,5,69,5,70,
+5,71,5,72,5,73,5,74,5,75,5,76,5,77,5,78,5,79,5,80,5,81,5,82,5,83,5,84,5,85,
+5,86,5,87,5,88,5,89,5,90,5,91,5,92,5,93,5,94,5,95,5,96,5,97,5,98,5,99,5,100,
+5,101,5,102,5,103,5,104,5,105,5,106,5,107,5,108,5,109,5,110,5,111,5,112,5,
+113,5,114,5,115,5,116,5,117,5,118,5,119,5,120,5,121,5,122,5,123,5,124,5,125,
+5,126,5,127,5,128,5,129,5,130,5,131,5,132,5,133,5,134,5,135,5,136,5,137,5,
+138,5,139,5,140,5,141,5,142,5,143,5,144,5,145,5,146,5,147,5,148,5,149,5,150,
+5,151,5,152,5,153,5,154,5,155,5,156,5,157,5,158,5,159,5,160,5,161,5,162,5,
+163,5,164,5,165,5,166,5,167,5,168,5,169,5,170,5,171,5,172,5,173,5,174,5,175,
+5,176,5,177,5,178,5,179,5,180,5,181,5,182,5,183,5,184,5,185,5,186,5,187,5,
+188,5,189,5,190,5,191,5,192,5,193,5,194,5,195,5,196,5,197,5,198,5,199,5,200,
+5,201,5,202,5,203,5,204,5,205,5,206,5,207,5,208,5,209,5,210,5,211,5,212,5,
+213,5,214,5,215,5,216,5,217,5,218,5,219,5,220,5,221,5,222,5,223,5,224,5,225,
+5,226,5,227,5,228,5,229,5,230,5,231,5,232,5,233,5,234,5,235,5,236,5,237,5,
+238,5,239,5,240,5,241,5,242,5,243,5,244,5,245,5,246,5,247,5,248,5,249,5,250,
+5,251,5,252,5,253,5,254,5,255,6,0,6,1,6,2,6,3,6,4,6,5,6,6,6,7,6,8,6,9,6,10,
+6,11,6,12,6,13,6,14,6,15,6,16,6,17,6,18,6,19,6,20,6,21,6,22,6,23,6,24,6,25,
+6,26,6,27,6,28,6,29,6,30,6,31,6,32,6,33,6,34,6,35,6,36,6,37,6,38,6,39,6,40,
+6,41,6,42,6,43,6,44,6,45,6,46,6,47,6,48,6,49,6,50,6,51,6,52,6,53,6,54,6,55,
+6,56,6,57,6,58,6,59,6,60,6,61,6,62,6,63,6,64,6,65,6,66,6,67,6,68,6,69,6,70,
+6,71,6,72,6,73,6,74,6,75,6,76,6,77,6,78,6,79,6,80,6,81,6,82,6,83,6,84,6,85,
+6,86,6,87,6,88,6,89,6,90,6,91,6,92,6,93,6,94,6,95,6,96,6,97,6,98,6,99,6,100,
+6,101,6,102,6,103,6,104,6,105,6,106,6,107,6,108,6,109,6,110,6,111,6,112,6,
+113,6,114,6,115,6,116,6,117,6,118,6,119,6,120,6,121,6,122,6,123,6,124,6,125,
+6,126,6,127,6,128,6,129,6,130,6,131,6,132,6,133,6,134,6,135,6,136,6,137,6,
+138,6,139,6,140,6,141,6,142,6,143,6,144,6,145,6,146,6,147,6,148,6,149,6,150,
+6,151,6,152,6,153,6,154,6,155,6,156,6,157,6,158,6,159,6,160,6,161,6,162,6,
+163,6,164,6,165,6,166,6,167,6,168,6,169,6,170,6,171,6,172,6,173,6,174,6,175,
+6,176,6,177,6,178,6,179,6,180,6,181,6,182,6,183,6,184,6,185,6,186,6,187,6,
+188,6,189,6,190,6,191,6,192,6,193,6,194,6,195,6,196,6,197,6,198,6,199,6,200,
+6,201,6,202,6,203,6,204,0,16,0,178,0,179,6,205,6,206,6,207,6,208,6,209,6,
+210,6,211,6,212,6,213,6,214,6,215,6,216,6,217,6,218,6,219,6,220,6,221,0,4,
+0,34,6,222,6,224,6,223,4,110,117,108,108,9,117,49,56,50,48,46,102,105,110,
+9,117,49,56,50,51,46,109,101,100,9,117,49,56,50,51,46,102,105,110,11,117,
+49,56,50,48,46,105,110,105,86,49,11,117,49,56,50,51,46,102,105,110,86,49,
+9,117,49,56,50,50,46,109,101,100,11,117,49,56,50,50,46,109,101,100,86,49,
+5,117,49,56,50,69,9,117,49,56,50,57,46,109,101,100,9,117,49,56,50,70,46,102,
+105,110,12,77,111,110,103,111,108,105,97,110,68,111,116,5,117,49,56,50,56,
+9,117,49,56,50,56,46,105,110,105,11,117,49,56,50,56,46,105,110,105,86,49,
+11,117,49,56,50,54,46,105,110,105,86,49,5,117,49,56,48,65,9,117,49,56,50,
+67,46,109,101,100,14,117,49,56,50,65,95,49,56,50,50,46,105,110,105,14,117,
+49,56,50,67,95,49,56,50,50,46,105,110,105,14,117,49,56,50,67,95,49,56,50,
+50,46,109,101,100,9,117,49,56,51,48,46,102,105,110,9,117,49,56,51,52,46,109,
+101,100,9,117,49,56,51,52,46,105,110,105,4,116,97,105,108,14,117,49,56,50,
+65,95,49,56,50,50,46,109,101,100,5,117,49,56,51,55,9,117,49,56,51,55,46,105,
+110,105,9,117,49,56,51,55,46,109,101,100,9,117,49,56,51,55,46,102,105,110,
+9,117,49,56,51,50,46,109,101,100,5,117,49,56,51,50,9,117,49,56,51,50,46,105,
+110,105,5,117,49,56,51,51,11,117,49,56,51,51,46,105,110,105,86,49,9,117,49,
+56,51,51,46,105,110,105,5,117,49,56,51,52,9,117,49,56,51,48,46,109,101,100,
+9,117,49,56,50,67,46,102,105,110,11,117,49,56,50,67,46,102,105,110,86,49,
+9,117,49,56,51,48,46,105,110,105,10,117,49,56,50,65,95,49,56,50,51,14,117,
+49,56,50,65,95,49,56,50,51,46,102,105,110,14,117,49,56,50,65,95,49,56,50,
+51,46,105,110,105,14,117,49,56,50,65,95,49,56,50,51,46,109,101,100,14,117,
+49,56,50,65,95,49,56,50,52,46,105,110,105,14,117,49,56,50,65,95,49,56,50,
+52,46,109,101,100,14,117,49,56,50,65,95,49,56,50,52,46,102,105,110,10,117,
+49,56,50,65,95,49,56,50,52,5,117,49,56,50,57,9,117,49,56,50,57,46,105,110,
+105,9,117,49,56,50,57,46,102,105,110,11,117,49,56,50,56,46,109,101,100,86,
+50,9,117,49,56,50,56,46,102,105,110,11,117,49,56,50,56,46,102,105,110,86,
+49,9,117,49,56,50,50,46,102,105,110,9,117,49,56,50,50,46,105,110,105,11,117,
+49,56,50,48,46,109,101,100,86,49,11,117,49,56,50,48,46,109,101,100,86,50,
+9,117,49,56,50,49,46,105,110,105,11,117,49,56,50,49,46,105,110,105,86,49,
+9,117,49,56,50,49,46,109,101,100,9,117,49,56,50,52,46,102,105,110,9,117,49,
+56,50,53,46,102,105,110,5,117,49,56,50,65,10,117,49,56,50,65,95,49,56,50,
+53,14,117,49,56,50,65,95,49,56,50,53,46,102,105,110,14,117,49,56,50,65,95,
+49,56,50,53,46,105,110,105,14,117,49,56,50,65,95,49,56,50,53,46,109,101,100,
+16,117,49,56,50,65,95,49,56,50,53,46,102,105,110,86,49,10,117,49,56,50,65,
+95,49,56,50,54,9,117,49,56,50,70,46,105,110,105,9,117,49,56,50,70,46,109,
+101,100,5,117,49,56,50,70,14,117,49,56,50,57,95,49,56,50,70,46,109,101,100,
+9,117,49,56,50,69,46,102,105,110,9,117,49,56,50,67,46,105,110,105,9,117,49,
+56,51,49,46,105,110,105,9,117,49,56,51,49,46,109,101,100,5,117,49,56,51,49,
+5,117,49,56,51,48,9,117,49,56,51,49,46,102,105,110,11,117,49,56,51,48,46,
+102,105,110,86,49,9,117,49,56,51,69,46,109,101,100,9,117,49,56,51,70,46,105,
+110,105,9,117,49,56,51,70,46,109,101,100,5,117,49,56,50,48,8,117,49,56,50,
+48,46,86,49,9,117,49,56,50,48,46,105,110,105,14,117,49,56,50,65,95,49,56,
+50,48,46,105,110,105,9,117,49,56,50,55,46,109,101,100,13,117,49,56,50,67,
+95,49,56,50,53,46,86,49,16,117,49,56,50,67,95,49,56,50,53,46,105,110,105,
+86,49,14,117,49,56,50,67,95,49,56,50,49,46,105,110,105,14,117,49,56,50,66,
+95,49,56,50,48,46,105,110,105,10,117,49,56,51,57,95,49,56,50,51,14,117,49,
+56,51,66,95,49,56,50,48,46,105,110,105,9,117,49,56,51,67,46,105,110,105,9,
+117,49,56,51,53,46,109,101,100,9,117,49,56,51,54,46,105,110,105,14,117,49,
+56,50,67,95,49,56,50,49,46,109,101,100,14,117,49,56,50,67,95,49,56,50,53,
+46,102,105,110,14,117,49,56,50,67,95,49,56,50,53,46,105,110,105,5,117,49,
+56,50,67,12,117,49,56,50,67,46,105,110,105,70,101,109,10,117,49,56,50,66,
+95,49,56,50,51,14,117,49,56,50,66,95,49,56,50,51,46,109,101,100,14,117,49,
+56,50,66,95,49,56,50,51,46,105,110,105,14,117,49,56,50,66,95,49,56,50,51,
+46,102,105,110,14,117,49,56,50,66,95,49,56,50,53,46,105,110,105,14,117,49,
+56,50,66,95,49,56,50,50,46,105,110,105,14,117,49,56,50,66,95,49,56,50,50,
+46,109,101,100,14,117,49,56,50,67,95,49,56,50,53,46,109,101,100,14,117,49,
+56,50,67,95,49,56,50,55,46,105,110,105,14,117,49,56,50,67,95,49,56,50,55,
+46,109,101,100,16,117,49,56,50,67,95,49,56,50,55,46,105,110,105,86,49,14,
+117,49,56,50,66,95,49,56,50,55,46,105,110,105,14,117,49,56,50,66,95,49,56,
+50,55,46,109,101,100,14,117,49,56,50,65,95,49,56,50,48,46,109,101,100,14,
+117,49,56,50,65,95,49,56,50,55,46,105,110,105,14,117,49,56,50,65,95,49,56,
+50,55,46,109,101,100,5,117,49,56,50,49,9,117,49,56,51,56,46,105,110,105,9,
+117,49,56,51,56,46,109,101,100,14,117,49,56,50,66,95,49,56,50,48,46,109,101,
+100,5,117,49,56,48,50,14,117,49,56,51,57,95,49,56,50,48,46,105,110,105,14,
+117,49,56,51,57,95,49,56,50,50,46,105,110,105,5,117,49,56,51,65,9,117,49,
+56,51,65,46,105,110,105,9,117,49,56,51,65,46,109,101,100,5,117,49,56,51,54,
+9,117,49,56,51,54,46,109,101,100,16,117,49,56,50,67,95,49,56,50,49,46,105,
+110,105,86,49,16,117,49,56,50,67,95,49,56,50,49,46,109,101,100,86,49,16,117,
+49,56,50,67,95,49,56,50,55,46,109,101,100,86,49,5,117,49,56,52,50,9,117,49,
+56,52,50,46,102,105,110,9,117,49,56,52,50,46,105,110,105,9,117,49,56,52,50,
+46,109,101,100,9,117,49,56,52,49,46,109,101,100,9,117,49,56,52,49,46,105,
+110,105,5,117,49,56,52,49,9,117,49,56,52,49,46,102,105,110,11,117,49,56,51,
+56,46,102,105,110,86,49,9,117,49,56,50,65,46,102,105,110,9,117,49,56,50,66,
+46,102,105,110,9,117,49,56,51,65,46,102,105,110,9,117,49,56,52,51,46,109,
+101,100,9,117,49,56,52,51,46,105,110,105,9,117,49,56,52,51,46,102,105,110,
+5,117,49,56,52,51,11,117,49,56,52,51,46,102,105,110,86,49,9,117,49,56,52,
+53,46,109,101,100,10,117,49,56,54,54,95,49,56,50,51,5,117,49,56,53,48,9,117,
+49,56,53,48,46,105,110,105,9,117,49,56,53,48,46,109,101,100,9,117,49,56,53,
+48,46,102,105,110,5,117,49,56,52,70,9,117,49,56,53,51,46,109,101,100,9,117,
+49,56,53,51,46,105,110,105,5,117,49,56,53,51,9,117,49,56,52,54,46,102,105,
+110,9,117,49,56,52,54,46,109,101,100,9,117,49,56,52,67,46,105,110,105,5,117,
+49,56,50,50,11,117,49,56,50,54,46,105,115,111,86,49,9,117,49,56,52,70,46,
+102,105,110,5,117,49,56,54,69,5,117,49,56,50,51,9,117,49,56,50,52,46,105,
+110,105,9,117,49,56,50,52,46,109,101,100,11,117,49,56,50,52,46,109,101,100,
+86,49,9,117,49,56,50,53,46,105,110,105,11,117,49,56,50,53,46,109,101,100,
+86,50,9,117,49,56,50,54,46,105,110,105,9,117,49,56,51,69,46,102,105,110,9,
+117,49,56,51,52,46,102,105,110,9,117,49,56,50,51,46,105,110,105,11,117,49,
+56,50,51,46,109,101,100,86,49,5,117,49,56,50,53,11,117,49,56,50,53,46,102,
+105,110,86,49,9,117,49,56,51,51,46,102,105,110,13,117,49,56,50,65,95,49,56,
+50,53,46,86,49,16,117,49,56,50,65,95,49,56,50,53,46,109,101,100,86,49,5,117,
+49,56,50,54,10,117,49,56,50,67,95,49,56,50,53,9,117,49,56,53,51,46,102,105,
+110,14,117,49,56,50,65,95,49,56,50,70,46,105,110,105,9,117,49,56,50,69,46,
+109,101,100,14,117,49,56,50,69,95,49,56,50,69,46,109,101,100,14,117,49,56,
+50,69,95,49,56,50,70,46,109,101,100,11,117,49,56,51,48,46,102,105,110,86,
+50,9,117,49,56,51,69,46,105,110,105,5,117,49,56,50,52,14,117,49,56,50,70,
+95,49,56,50,70,46,109,101,100,11,117,49,56,51,51,46,102,105,110,86,49,14,
+117,49,56,50,68,95,49,56,50,70,46,109,101,100,10,117,49,56,50,65,95,49,56,
+50,50,14,117,49,56,50,65,95,49,56,50,50,46,102,105,110,14,117,49,56,50,66,
+95,49,56,50,50,46,102,105,110,14,117,49,56,50,67,95,49,56,50,50,46,102,105,
+110,9,117,49,56,50,69,46,105,110,105,9,117,49,56,51,56,46,102,105,110,13,
+77,111,110,103,111,108,105,97,110,82,105,110,103,9,117,49,56,50,65,46,105,
+110,105,9,117,49,56,52,52,46,109,101,100,11,117,49,56,52,53,46,109,101,100,
+86,49,9,117,49,56,52,53,46,102,105,110,5,117,49,56,52,53,9,117,49,56,52,52,
+46,102,105,110,11,117,49,56,52,52,46,109,101,100,86,49,9,117,49,56,52,53,
+46,105,110,105,9,117,49,56,52,52,46,105,110,105,5,117,49,56,52,52,11,117,
+49,56,52,54,46,109,101,100,86,49,9,117,49,56,52,54,46,105,110,105,5,117,49,
+56,52,54,5,117,49,56,52,55,8,117,49,56,52,55,46,86,49,9,117,49,56,52,55,46,
+105,110,105,9,117,49,56,52,55,46,109,101,100,11,117,49,56,52,55,46,109,101,
+100,86,49,11,117,49,56,52,55,46,109,101,100,86,50,9,117,49,56,52,55,46,102,
+105,110,11,117,49,56,52,55,46,102,105,110,86,49,5,117,49,56,52,56,9,117,49,
+56,52,56,46,105,110,105,9,117,49,56,52,56,46,109,101,100,11,117,49,56,52,
+56,46,109,101,100,86,49,9,117,49,56,52,56,46,102,105,110,5,117,49,56,52,57,
+8,117,49,56,52,57,46,86,49,9,117,49,56,52,57,46,105,110,105,9,117,49,56,52,
+57,46,109,101,100,11,117,49,56,52,57,46,109,101,100,86,49,9,117,49,56,52,
+57,46,102,105,110,5,117,49,56,52,65,9,117,49,56,52,65,46,102,105,110,9,117,
+49,56,52,65,46,105,110,105,9,117,49,56,52,65,46,109,101,100,14,117,49,56,
+52,65,95,49,56,50,70,46,109,101,100,5,117,49,56,52,66,9,117,49,56,52,66,46,
+105,110,105,9,117,49,56,52,66,46,109,101,100,9,117,49,56,52,66,46,102,105,
+110,10,117,49,56,52,66,95,49,56,50,48,14,117,49,56,52,66,95,49,56,50,48,46,
+105,110,105,14,117,49,56,52,66,95,49,56,50,48,46,109,101,100,14,117,49,56,
+52,66,95,49,56,50,48,46,102,105,110,14,117,49,56,52,66,95,49,56,50,70,46,
+105,110,105,14,117,49,56,52,66,95,49,56,50,70,46,109,101,100,10,117,49,56,
+52,66,95,49,56,52,52,14,117,49,56,52,66,95,49,56,52,52,46,105,110,105,14,
+117,49,56,52,66,95,49,56,52,52,46,102,105,110,14,117,49,56,52,66,95,49,56,
+52,52,46,109,101,100,14,117,49,56,52,66,95,49,56,52,53,46,105,110,105,14,
+117,49,56,52,66,95,49,56,52,53,46,109,101,100,10,117,49,56,52,66,95,49,56,
+52,54,14,117,49,56,52,66,95,49,56,52,54,46,105,110,105,14,117,49,56,52,66,
+95,49,56,52,54,46,109,101,100,14,117,49,56,52,66,95,49,56,52,54,46,102,105,
+110,10,117,49,56,52,66,95,49,56,52,55,14,117,49,56,52,66,95,49,56,52,55,46,
+105,110,105,14,117,49,56,52,66,95,49,56,52,55,46,109,101,100,14,117,49,56,
+52,66,95,49,56,52,55,46,102,105,110,10,117,49,56,52,66,95,49,56,52,56,14,
+117,49,56,52,66,95,49,56,52,56,46,105,110,105,14,117,49,56,52,66,95,49,56,
+52,56,46,109,101,100,14,117,49,56,52,66,95,49,56,52,56,46,102,105,110,10,
+117,49,56,52,66,95,49,56,52,57,14,117,49,56,52,66,95,49,56,52,57,46,105,110,
+105,14,117,49,56,52,66,95,49,56,52,57,46,109,101,100,14,117,49,56,52,66,95,
+49,56,52,57,46,102,105,110,9,117,49,56,52,67,46,109,101,100,5,117,49,56,52,
+67,9,117,49,56,52,67,46,102,105,110,10,117,49,56,52,67,95,49,56,50,51,14,
+117,49,56,52,67,95,49,56,50,51,46,105,110,105,14,117,49,56,52,67,95,49,56,
+50,51,46,109,101,100,14,117,49,56,52,67,95,49,56,50,51,46,102,105,110,10,
+117,49,56,52,67,95,49,56,52,52,14,117,49,56,52,67,95,49,56,52,52,46,105,110,
+105,14,117,49,56,52,67,95,49,56,52,52,46,109,101,100,14,117,49,56,52,67,95,
+49,56,52,52,46,102,105,110,10,117,49,56,52,67,95,49,56,52,53,14,117,49,56,
+52,67,95,49,56,52,53,46,105,110,105,14,117,49,56,52,67,95,49,56,52,53,46,
+109,101,100,14,117,49,56,52,67,95,49,56,52,53,46,102,105,110,14,117,49,56,
+52,67,95,49,56,50,48,46,105,110,105,14,117,49,56,52,67,95,49,56,50,48,46,
+109,101,100,14,117,49,56,52,67,95,49,56,50,48,46,102,105,110,10,117,49,56,
+52,67,95,49,56,50,48,14,117,49,56,52,67,95,49,56,52,54,46,105,110,105,14,
+117,49,56,52,67,95,49,56,52,54,46,109,101,100,14,117,49,56,52,67,95,49,56,
+52,54,46,102,105,110,10,117,49,56,52,67,95,49,56,52,54,10,117,49,56,52,67,
+95,49,56,52,55,14,117,49,56,52,67,95,49,56,52,55,46,105,110,105,14,117,49,
+56,52,67,95,49,56,52,55,46,109,101,100,14,117,49,56,52,67,95,49,56,52,55,
+46,102,105,110,10,117,49,56,52,67,95,49,56,52,56,14,117,49,56,52,67,95,49,
+56,52,56,46,105,110,105,14,117,49,56,52,67,95,49,56,52,56,46,109,101,100,
+14,117,49,56,52,67,95,49,56,52,56,46,102,105,110,10,117,49,56,52,67,95,49,
+56,52,57,14,117,49,56,52,67,95,49,56,52,57,46,105,110,105,14,117,49,56,52,
+67,95,49,56,52,57,46,109,101,100,14,117,49,56,52,67,95,49,56,52,57,46,102,
+105,110,5,117,49,56,52,68,9,117,49,56,52,68,46,105,110,105,9,117,49,56,52,
+68,46,109,101,100,9,117,49,56,51,66,46,105,110,105,9,117,49,56,51,66,46,102,
+105,110,12,117,49,56,52,68,46,102,105,110,70,101,109,9,117,49,56,52,70,46,
+105,110,105,9,117,49,56,52,70,46,109,101,100,14,117,49,56,52,70,95,49,56,
+52,70,46,109,101,100,14,117,49,56,52,70,95,49,56,50,70,46,109,101,100,5,117,
+49,56,53,52,9,117,49,56,53,52,46,105,110,105,9,117,49,56,53,52,46,109,101,
+100,9,117,49,56,53,52,46,102,105,110,5,117,49,56,53,67,9,117,49,56,53,67,
+46,105,110,105,9,117,49,56,53,67,46,109,101,100,9,117,49,56,53,67,46,102,
+105,110,5,117,49,56,54,49,9,117,49,56,54,49,46,105,110,105,9,117,49,56,54,
+49,46,109,101,100,9,117,49,56,54,49,46,102,105,110,9,117,49,56,54,50,46,105,
+110,105,9,117,49,56,54,50,46,109,101,100,14,117,49,56,54,50,95,49,56,50,70,
+46,109,101,100,9,117,49,56,54,51,46,105,110,105,9,117,49,56,54,51,46,109,
+101,100,9,117,49,56,50,49,46,102,105,110,11,117,49,56,50,54,46,109,101,100,
+86,50,9,117,49,56,50,54,46,102,105,110,11,117,49,56,50,54,46,102,105,110,
+86,49,5,117,49,56,50,55,9,117,49,56,50,55,46,105,110,105,9,117,49,56,50,55,
+46,102,105,110,11,117,49,56,50,56,46,109,101,100,86,51,9,117,49,56,50,65,
+46,109,101,100,11,117,49,56,50,65,46,102,105,110,86,49,10,117,49,56,50,65,
+95,49,56,50,48,14,117,49,56,50,65,95,49,56,50,48,46,102,105,110,10,117,49,
+56,50,65,95,49,56,50,49,14,117,49,56,50,65,95,49,56,50,49,46,105,110,105,
+14,117,49,56,50,65,95,49,56,50,49,46,109,101,100,14,117,49,56,50,65,95,49,
+56,50,49,46,102,105,110,14,117,49,56,50,65,95,49,56,50,70,46,109,101,100,
+11,117,49,56,50,67,46,109,101,100,86,51,14,117,49,56,50,65,95,49,56,50,54,
+46,105,110,105,14,117,49,56,50,65,95,49,56,50,54,46,109,101,100,16,117,49,
+56,50,65,95,49,56,50,54,46,109,101,100,86,49,14,117,49,56,50,65,95,49,56,
+50,54,46,102,105,110,16,117,49,56,50,65,95,49,56,50,54,46,102,105,110,86,
+49,10,117,49,56,50,65,95,49,56,50,55,14,117,49,56,50,65,95,49,56,50,55,46,
+102,105,110,5,117,49,56,50,66,9,117,49,56,50,66,46,105,110,105,9,117,49,56,
+50,66,46,109,101,100,10,117,49,56,50,66,95,49,56,50,48,14,117,49,56,50,66,
+95,49,56,50,48,46,102,105,110,10,117,49,56,50,66,95,49,56,50,49,14,117,49,
+56,50,66,95,49,56,50,49,46,105,110,105,14,117,49,56,50,66,95,49,56,50,49,
+46,109,101,100,14,117,49,56,50,66,95,49,56,50,49,46,102,105,110,10,117,49,
+56,50,66,95,49,56,50,50,10,117,49,56,50,66,95,49,56,50,52,14,117,49,56,50,
+66,95,49,56,50,52,46,105,110,105,14,117,49,56,50,66,95,49,56,50,52,46,109,
+101,100,14,117,49,56,50,66,95,49,56,50,52,46,102,105,110,10,117,49,56,50,
+66,95,49,56,50,53,13,117,49,56,50,66,95,49,56,50,53,46,86,49,14,117,49,56,
+50,66,95,49,56,50,53,46,109,101,100,14,117,49,56,50,66,95,49,56,50,53,46,
+102,105,110,16,117,49,56,50,66,95,49,56,50,53,46,109,101,100,86,49,16,117,
+49,56,50,66,95,49,56,50,53,46,102,105,110,86,49,10,117,49,56,50,66,95,49,
+56,50,54,13,117,49,56,50,66,95,49,56,50,54,46,86,49,16,117,49,56,50,66,95,
+49,56,50,54,46,102,105,110,86,49,14,117,49,56,50,66,95,49,56,50,54,46,109,
+101,100,14,117,49,56,50,66,95,49,56,50,54,46,102,105,110,14,117,49,56,50,
+66,95,49,56,50,54,46,105,110,105,16,117,49,56,50,66,95,49,56,50,54,46,109,
+101,100,86,49,14,117,49,56,50,66,95,49,56,50,55,46,102,105,110,10,117,49,
+56,50,66,95,49,56,50,55,10,117,49,56,50,67,95,49,56,50,49,13,117,49,56,50,
+67,95,49,56,50,49,46,86,49,14,117,49,56,50,67,95,49,56,50,49,46,102,105,110,
+16,117,49,56,50,67,95,49,56,50,49,46,102,105,110,86,49,10,117,49,56,50,67,
+95,49,56,50,50,13,117,49,56,50,67,95,49,56,50,50,46,86,49,16,117,49,56,50,
+67,95,49,56,50,50,46,109,101,100,86,49,16,117,49,56,50,67,95,49,56,50,50,
+46,102,105,110,86,49,11,117,49,56,51,50,46,109,101,100,86,49,9,117,49,56,
+51,50,46,102,105,110,8,117,49,56,51,53,46,86,49,5,117,49,56,51,53,9,117,49,
+56,51,53,46,105,110,105,11,117,49,56,51,53,46,109,101,100,86,49,9,117,49,
+56,51,53,46,102,105,110,11,117,49,56,51,54,46,105,110,105,86,49,11,117,49,
+56,51,54,46,109,101,100,86,49,11,117,49,56,51,54,46,109,101,100,86,50,9,117,
+49,56,51,54,46,102,105,110,5,117,49,56,51,66,9,117,49,56,51,66,46,109,101,
+100,10,117,49,56,51,66,95,49,56,50,48,14,117,49,56,51,66,95,49,56,50,48,46,
+109,101,100,14,117,49,56,51,66,95,49,56,50,48,46,102,105,110,10,117,49,56,
+51,66,95,49,56,50,49,14,117,49,56,51,66,95,49,56,50,49,46,105,110,105,14,
+117,49,56,51,66,95,49,56,50,49,46,109,101,100,14,117,49,56,51,66,95,49,56,
+50,49,46,102,105,110,14,117,49,56,51,66,95,49,56,50,50,46,105,110,105,10,
+117,49,56,51,66,95,49,56,50,50,14,117,49,56,51,66,95,49,56,50,50,46,109,101,
+100,14,117,49,56,51,66,95,49,56,50,50,46,102,105,110,14,117,49,56,51,66,95,
+49,56,50,51,46,105,110,105,14,117,49,56,51,66,95,49,56,50,51,46,109,101,100,
+10,117,49,56,51,66,95,49,56,50,51,14,117,49,56,51,66,95,49,56,50,51,46,102,
+105,110,10,117,49,56,51,66,95,49,56,50,52,14,117,49,56,51,66,95,49,56,50,
+52,46,105,110,105,14,117,49,56,51,66,95,49,56,50,52,46,109,101,100,14,117,
+49,56,51,66,95,49,56,50,52,46,102,105,110,10,117,49,56,51,66,95,49,56,50,
+53,14,117,49,56,51,66,95,49,56,50,53,46,102,105,110,10,117,49,56,51,66,95,
+49,56,50,54,14,117,49,56,51,66,95,49,56,50,54,46,102,105,110,14,117,49,56,
+51,66,95,49,56,50,53,46,109,101,100,14,117,49,56,51,66,95,49,56,50,54,46,
+109,101,100,13,117,49,56,51,66,95,49,56,50,53,46,86,49,16,117,49,56,51,66,
+95,49,56,50,53,46,102,105,110,86,49,13,117,49,56,51,66,95,49,56,50,54,46,
+86,49,16,117,49,56,51,66,95,49,56,50,54,46,102,105,110,86,49,14,117,49,56,
+51,66,95,49,56,50,53,46,105,110,105,13,117,49,56,50,65,95,49,56,50,54,46,
+86,49,14,117,49,56,51,57,95,49,56,50,48,46,109,101,100,10,117,49,56,51,57,
+95,49,56,50,48,5,117,49,56,51,57,9,117,49,56,51,57,46,102,105,110,9,117,49,
+56,51,57,46,105,110,105,9,117,49,56,51,57,46,109,101,100,14,117,49,56,51,
+57,95,49,56,50,48,46,102,105,110,10,117,49,56,51,57,95,49,56,50,49,14,117,
+49,56,51,57,95,49,56,50,49,46,105,110,105,14,117,49,56,51,57,95,49,56,50,
+49,46,109,101,100,14,117,49,56,51,57,95,49,56,50,49,46,102,105,110,10,117,
+49,56,51,57,95,49,56,50,50,14,117,49,56,51,57,95,49,56,50,50,46,109,101,100,
+14,117,49,56,51,57,95,49,56,50,50,46,102,105,110,14,117,49,56,51,57,95,49,
+56,50,51,46,105,110,105,14,117,49,56,51,57,95,49,56,50,51,46,109,101,100,
+14,117,49,56,51,57,95,49,56,50,51,46,102,105,110,10,117,49,56,51,57,95,49,
+56,50,52,14,117,49,56,51,57,95,49,56,50,52,46,105,110,105,14,117,49,56,51,
+57,95,49,56,50,52,46,109,101,100,14,117,49,56,51,57,95,49,56,50,52,46,102,
+105,110,10,117,49,56,51,57,95,49,56,50,53,14,117,49,56,51,57,95,49,56,50,
+53,46,109,101,100,14,117,49,56,51,57,95,49,56,50,53,46,102,105,110,10,117,
+49,56,51,57,95,49,56,50,54,14,117,49,56,51,57,95,49,56,50,54,46,109,101,100,
+14,117,49,56,51,57,95,49,56,50,54,46,102,105,110,13,117,49,56,51,57,95,49,
+56,50,53,46,86,49,14,117,49,56,51,57,95,49,56,50,53,46,105,110,105,16,117,
+49,56,51,57,95,49,56,50,53,46,109,101,100,86,49,14,117,49,56,51,57,95,49,
+56,50,54,46,105,110,105,16,117,49,56,51,57,95,49,56,50,54,46,109,101,100,
+86,49,16,117,49,56,51,57,95,49,56,50,53,46,102,105,110,86,49,13,117,49,56,
+51,57,95,49,56,50,54,46,86,49,16,117,49,56,51,57,95,49,56,50,54,46,102,105,
+110,86,49,16,117,49,56,50,67,95,49,56,50,53,46,105,110,105,86,51,16,117,49,
+56,50,67,95,49,56,50,53,46,105,110,105,86,50,16,117,49,56,50,67,95,49,56,
+50,53,46,109,101,100,86,51,16,117,49,56,50,67,95,49,56,50,53,46,102,105,110,
+86,50,16,117,49,56,50,67,95,49,56,50,53,46,102,105,110,86,51,10,117,49,56,
+50,67,95,49,56,50,54,13,117,49,56,50,67,95,49,56,50,54,46,86,51,14,117,49,
+56,50,67,95,49,56,50,54,46,105,110,105,16,117,49,56,50,67,95,49,56,50,54,
+46,105,110,105,86,51,14,117,49,56,50,67,95,49,56,50,54,46,109,101,100,16,
+117,49,56,50,67,95,49,56,50,54,46,109,101,100,86,50,16,117,49,56,50,67,95,
+49,56,50,54,46,109,101,100,86,51,14,117,49,56,50,67,95,49,56,50,54,46,102,
+105,110,16,117,49,56,50,67,95,49,56,50,54,46,102,105,110,86,49,16,117,49,
+56,50,67,95,49,56,50,54,46,102,105,110,86,50,16,117,49,56,50,67,95,49,56,
+50,54,46,102,105,110,86,51,10,117,49,56,50,67,95,49,56,50,55,13,117,49,56,
+50,67,95,49,56,50,55,46,86,49,14,117,49,56,50,67,95,49,56,50,55,46,102,105,
+110,16,117,49,56,50,67,95,49,56,50,55,46,102,105,110,86,49,5,117,49,56,50,
+68,9,117,49,56,50,68,46,105,110,105,11,117,49,56,50,68,46,105,110,105,86,
+49,9,117,49,56,50,68,46,102,105,110,10,117,49,56,50,68,95,49,56,50,49,13,
+117,49,56,50,68,95,49,56,50,49,46,86,49,14,117,49,56,50,68,95,49,56,50,49,
+46,105,110,105,16,117,49,56,50,68,95,49,56,50,49,46,105,110,105,86,49,14,
+117,49,56,50,68,95,49,56,50,49,46,109,101,100,16,117,49,56,50,68,95,49,56,
+50,49,46,109,101,100,86,49,14,117,49,56,50,68,95,49,56,50,49,46,102,105,110,
+16,117,49,56,50,68,95,49,56,50,49,46,102,105,110,86,49,10,117,49,56,50,68,
+95,49,56,50,50,13,117,49,56,50,68,95,49,56,50,50,46,86,49,14,117,49,56,50,
+68,95,49,56,50,50,46,105,110,105,16,117,49,56,50,68,95,49,56,50,50,46,105,
+110,105,86,49,14,117,49,56,50,68,95,49,56,50,50,46,109,101,100,16,117,49,
+56,50,68,95,49,56,50,50,46,109,101,100,86,49,14,117,49,56,50,68,95,49,56,
+50,50,46,102,105,110,16,117,49,56,50,68,95,49,56,50,50,46,102,105,110,86,
+49,10,117,49,56,50,68,95,49,56,50,53,13,117,49,56,50,68,95,49,56,50,53,46,
+86,50,13,117,49,56,50,68,95,49,56,50,53,46,86,51,14,117,49,56,50,68,95,49,
+56,50,53,46,105,110,105,16,117,49,56,50,68,95,49,56,50,53,46,105,110,105,
+86,49,14,117,49,56,50,68,95,49,56,50,53,46,109,101,100,16,117,49,56,50,68,
+95,49,56,50,53,46,109,101,100,86,50,16,117,49,56,50,68,95,49,56,50,53,46,
+109,101,100,86,51,14,117,49,56,50,68,95,49,56,50,53,46,102,105,110,16,117,
+49,56,50,68,95,49,56,50,53,46,102,105,110,86,50,16,117,49,56,50,68,95,49,
+56,50,53,46,102,105,110,86,51,10,117,49,56,50,68,95,49,56,50,54,13,117,49,
+56,50,68,95,49,56,50,54,46,86,49,13,117,49,56,50,68,95,49,56,50,54,46,86,
+50,13,117,49,56,50,68,95,49,56,50,54,46,86,51,14,117,49,56,50,68,95,49,56,
+50,54,46,105,110,105,16,117,49,56,50,68,95,49,56,50,54,46,105,110,105,86,
+49,14,117,49,56,50,68,95,49,56,50,54,46,109,101,100,16,117,49,56,50,68,95,
+49,56,50,54,46,109,101,100,86,49,16,117,49,56,50,68,95,49,56,50,54,46,109,
+101,100,86,50,16,117,49,56,50,68,95,49,56,50,54,46,109,101,100,86,51,14,117,
+49,56,50,68,95,49,56,50,54,46,102,105,110,16,117,49,56,50,68,95,49,56,50,
+54,46,102,105,110,86,50,16,117,49,56,50,68,95,49,56,50,54,46,102,105,110,
+86,51,10,117,49,56,50,68,95,49,56,50,55,13,117,49,56,50,68,95,49,56,50,55,
+46,86,49,14,117,49,56,50,68,95,49,56,50,55,46,105,110,105,16,117,49,56,50,
+68,95,49,56,50,55,46,105,110,105,86,49,14,117,49,56,50,68,95,49,56,50,55,
+46,109,101,100,16,117,49,56,50,68,95,49,56,50,55,46,109,101,100,86,49,14,
+117,49,56,50,68,95,49,56,50,55,46,102,105,110,16,117,49,56,50,68,95,49,56,
+50,55,46,102,105,110,86,49,5,117,49,56,51,56,11,117,49,56,51,65,46,105,110,
+105,86,49,11,117,49,56,51,65,46,109,101,100,86,49,5,117,49,56,51,69,5,117,
+49,56,51,70,9,117,49,56,51,70,46,102,105,110,5,117,49,56,52,48,9,117,49,56,
+52,48,46,105,110,105,9,117,49,56,52,48,46,109,101,100,9,117,49,56,52,48,46,
+102,105,110,5,117,49,56,51,68,9,117,49,56,51,68,46,105,110,105,9,117,49,56,
+51,68,46,109,101,100,9,117,49,56,51,68,46,102,105,110,14,117,49,56,51,65,
+95,49,56,50,48,46,105,110,105,14,117,49,56,51,65,95,49,56,50,48,46,109,101,
+100,10,117,49,56,51,65,95,49,56,50,48,14,117,49,56,51,65,95,49,56,50,48,46,
+102,105,110,10,117,49,56,51,65,95,49,56,50,49,14,117,49,56,51,65,95,49,56,
+50,49,46,105,110,105,14,117,49,56,51,65,95,49,56,50,49,46,109,101,100,14,
+117,49,56,51,65,95,49,56,50,49,46,102,105,110,14,117,49,56,51,65,95,49,56,
+50,50,46,105,110,105,10,117,49,56,51,65,95,49,56,50,50,14,117,49,56,51,65,
+95,49,56,50,50,46,109,101,100,14,117,49,56,51,65,95,49,56,50,50,46,102,105,
+110,10,117,49,56,51,65,95,49,56,50,51,14,117,49,56,51,65,95,49,56,50,51,46,
+105,110,105,14,117,49,56,51,65,95,49,56,50,51,46,109,101,100,14,117,49,56,
+51,65,95,49,56,50,51,46,102,105,110,10,117,49,56,51,65,95,49,56,50,52,14,
+117,49,56,51,65,95,49,56,50,52,46,105,110,105,14,117,49,56,51,65,95,49,56,
+50,52,46,109,101,100,14,117,49,56,51,65,95,49,56,50,52,46,102,105,110,10,
+117,49,56,51,65,95,49,56,50,53,13,117,49,56,51,65,95,49,56,50,53,46,86,49,
+16,117,49,56,51,65,95,49,56,50,53,46,102,105,110,86,49,13,117,49,56,51,65,
+95,49,56,50,54,46,86,49,16,117,49,56,51,65,95,49,56,50,54,46,102,105,110,
+86,49,14,117,49,56,51,65,95,49,56,50,53,46,109,101,100,14,117,49,56,51,65,
+95,49,56,50,53,46,102,105,110,10,117,49,56,51,65,95,49,56,50,54,14,117,49,
+56,51,65,95,49,56,50,54,46,102,105,110,14,117,49,56,51,65,95,49,56,50,54,
+46,109,101,100,14,117,49,56,51,65,95,49,56,50,53,46,105,110,105,16,117,49,
+56,51,65,95,49,56,50,53,46,109,101,100,86,49,14,117,49,56,51,65,95,49,56,
+50,54,46,105,110,105,16,117,49,56,51,65,95,49,56,50,54,46,109,101,100,86,
+49,14,117,49,56,51,65,95,49,56,50,55,46,105,110,105,14,117,49,56,51,65,95,
+49,56,50,55,46,109,101,100,14,117,49,56,51,65,95,49,56,50,55,46,102,105,110,
+10,117,49,56,51,65,95,49,56,50,55,16,117,49,56,51,66,95,49,56,50,53,46,109,
+101,100,86,49,14,117,49,56,51,66,95,49,56,50,54,46,105,110,105,16,117,49,
+56,51,66,95,49,56,50,54,46,109,101,100,86,49,14,117,49,56,51,66,95,49,56,
+50,55,46,105,110,105,14,117,49,56,51,66,95,49,56,50,55,46,109,101,100,10,
+117,49,56,51,66,95,49,56,50,55,14,117,49,56,51,66,95,49,56,50,55,46,102,105,
+110,5,117,49,56,51,67,9,117,49,56,51,67,46,109,101,100,9,117,49,56,51,67,
+46,102,105,110,12,117,49,56,50,68,46,105,110,105,70,101,109,11,117,49,56,
+50,68,46,105,110,105,86,50,12,117,49,56,52,68,46,105,110,105,70,101,109,12,
+117,49,56,52,68,46,109,101,100,70,101,109,14,117,49,56,52,68,95,49,56,52,
+52,46,105,110,105,14,117,49,56,52,68,95,49,56,52,52,46,102,105,110,10,117,
+49,56,52,68,95,49,56,52,52,14,117,49,56,52,68,95,49,56,52,52,46,109,101,100,
+14,117,49,56,52,68,95,49,56,52,53,46,105,110,105,10,117,49,56,52,68,95,49,
+56,52,53,14,117,49,56,52,68,95,49,56,52,53,46,109,101,100,14,117,49,56,52,
+68,95,49,56,52,53,46,102,105,110,10,117,49,56,52,68,95,49,56,52,56,14,117,
+49,56,52,68,95,49,56,52,56,46,105,110,105,14,117,49,56,52,68,95,49,56,52,
+56,46,109,101,100,14,117,49,56,52,68,95,49,56,52,56,46,102,105,110,10,117,
+49,56,52,68,95,49,56,52,57,14,117,49,56,52,68,95,49,56,52,57,46,105,110,105,
+14,117,49,56,52,68,95,49,56,52,57,46,109,101,100,14,117,49,56,52,68,95,49,
+56,52,57,46,102,105,110,5,117,49,56,52,69,9,117,49,56,52,69,46,105,110,105,
+12,117,49,56,52,69,46,105,110,105,70,101,109,9,117,49,56,52,69,46,109,101,
+100,14,117,49,56,52,69,95,49,56,50,70,46,109,101,100,10,117,49,56,52,69,95,
+49,56,52,52,14,117,49,56,52,69,95,49,56,52,52,46,105,110,105,14,117,49,56,
+52,69,95,49,56,52,52,46,109,101,100,14,117,49,56,52,69,95,49,56,52,52,46,
+102,105,110,14,117,49,56,52,69,95,49,56,52,53,46,105,110,105,14,117,49,56,
+52,69,95,49,56,52,53,46,109,101,100,14,117,49,56,52,69,95,49,56,52,53,46,
+102,105,110,10,117,49,56,52,69,95,49,56,52,53,10,117,49,56,52,69,95,49,56,
+52,56,14,117,49,56,52,69,95,49,56,52,56,46,105,110,105,14,117,49,56,52,69,
+95,49,56,52,56,46,109,101,100,14,117,49,56,52,69,95,49,56,52,56,46,102,105,
+110,10,117,49,56,52,69,95,49,56,52,57,14,117,49,56,52,69,95,49,56,52,57,46,
+105,110,105,14,117,49,56,52,69,95,49,56,52,57,46,109,101,100,14,117,49,56,
+52,69,95,49,56,52,57,46,102,105,110,9,117,49,56,53,50,46,109,101,100,5,117,
+49,56,53,50,9,117,49,56,53,50,46,102,105,110,5,117,49,56,53,55,9,117,49,56,
+53,55,46,105,110,105,9,117,49,56,53,55,46,109,101,100,9,117,49,56,53,55,46,
+102,105,110,14,117,49,56,53,55,95,49,56,50,48,46,105,110,105,14,117,49,56,
+53,55,95,49,56,50,48,46,109,101,100,14,117,49,56,53,55,95,49,56,50,48,46,
+102,105,110,10,117,49,56,53,55,95,49,56,50,48,10,117,49,56,53,55,95,49,56,
+52,54,14,117,49,56,53,55,95,49,56,52,54,46,105,110,105,14,117,49,56,53,55,
+95,49,56,52,54,46,109,101,100,14,117,49,56,53,55,95,49,56,52,54,46,102,105,
+110,10,117,49,56,53,55,95,49,56,52,55,14,117,49,56,53,55,95,49,56,52,55,46,
+105,110,105,14,117,49,56,53,55,95,49,56,52,55,46,102,105,110,14,117,49,56,
+53,55,95,49,56,52,55,46,109,101,100,5,117,49,56,53,56,9,117,49,56,53,56,46,
+105,110,105,9,117,49,56,53,56,46,109,101,100,9,117,49,56,53,56,46,102,105,
+110,14,117,49,56,53,56,95,49,56,50,48,46,105,110,105,14,117,49,56,53,56,95,
+49,56,50,48,46,109,101,100,14,117,49,56,53,56,95,49,56,50,48,46,102,105,110,
+10,117,49,56,53,56,95,49,56,50,48,10,117,49,56,53,56,95,49,56,52,54,14,117,
+49,56,53,56,95,49,56,52,54,46,105,110,105,14,117,49,56,53,56,95,49,56,52,
+54,46,109,101,100,14,117,49,56,53,56,95,49,56,52,54,46,102,105,110,10,117,
+49,56,53,56,95,49,56,52,55,14,117,49,56,53,56,95,49,56,52,55,46,105,110,105,
+14,117,49,56,53,56,95,49,56,52,55,46,109,101,100,14,117,49,56,53,56,95,49,
+56,52,55,46,102,105,110,5,117,49,56,53,57,9,117,49,56,53,57,46,109,101,100,
+9,117,49,56,53,57,46,102,105,110,9,117,49,56,53,57,46,105,110,105,5,117,49,
+56,53,65,9,117,49,56,53,65,46,105,110,105,9,117,49,56,53,65,46,109,101,100,
+9,117,49,56,53,65,46,102,105,110,5,117,49,56,53,66,5,117,49,56,54,50,9,117,
+49,56,53,66,46,105,110,105,9,117,49,56,53,66,46,109,101,100,9,117,49,56,53,
+66,46,102,105,110,14,117,49,56,52,66,95,49,56,52,53,46,102,105,110,10,117,
+49,56,52,66,95,49,56,52,53,5,117,49,56,53,49,9,117,49,56,53,49,46,109,101,
+100,9,117,49,56,53,49,46,105,110,105,9,117,49,56,53,49,46,102,105,110,5,117,
+49,56,53,68,9,117,49,56,53,68,46,102,105,110,11,117,49,56,53,68,46,102,105,
+110,86,49,9,117,49,56,53,68,46,109,101,100,11,117,49,56,53,68,46,109,101,
+100,86,49,9,117,49,56,53,68,46,105,110,105,11,117,49,56,53,68,46,102,105,
+110,86,50,11,117,49,56,53,68,46,102,105,110,86,51,5,117,49,56,53,69,9,117,
+49,56,53,69,46,105,110,105,11,117,49,56,53,69,46,109,101,100,86,49,9,117,
+49,56,53,69,46,109,101,100,11,117,49,56,53,69,46,109,101,100,86,50,9,117,
+49,56,53,69,46,102,105,110,11,117,49,56,53,69,46,102,105,110,86,49,11,117,
+49,56,53,69,46,102,105,110,86,50,11,117,49,56,53,69,46,102,105,110,86,51,
+5,117,49,56,53,70,9,117,49,56,53,70,46,105,110,105,9,117,49,56,53,70,46,109,
+101,100,9,117,49,56,53,70,46,102,105,110,5,117,49,56,54,48,9,117,49,56,54,
+48,46,105,110,105,9,117,49,56,54,48,46,109,101,100,9,117,49,56,54,48,46,102,
+105,110,11,117,49,56,54,48,46,109,101,100,86,49,11,117,49,56,54,48,46,102,
+105,110,86,49,11,117,49,56,54,48,46,102,105,110,86,50,11,117,49,56,54,48,
+46,102,105,110,86,51,11,117,49,56,54,48,46,109,101,100,86,50,9,117,49,56,
+54,50,46,102,105,110,9,117,49,56,54,51,46,102,105,110,5,117,49,56,54,51,10,
+117,49,56,54,51,95,49,56,53,68,14,117,49,56,54,51,95,49,56,53,68,46,105,110,
+105,14,117,49,56,54,51,95,49,56,53,68,46,109,101,100,14,117,49,56,54,51,95,
+49,56,53,68,46,102,105,110,14,117,49,56,54,51,95,49,56,53,69,46,109,101,100,
+14,117,49,56,54,51,95,49,56,53,69,46,102,105,110,10,117,49,56,54,51,95,49,
+56,53,69,14,117,49,56,54,51,95,49,56,53,69,46,105,110,105,12,117,49,56,54,
+51,46,105,110,105,70,101,109,10,117,49,56,54,51,95,49,56,54,48,14,117,49,
+56,54,51,95,49,56,54,48,46,105,110,105,14,117,49,56,54,51,95,49,56,54,48,
+46,102,105,110,14,117,49,56,54,51,95,49,56,54,48,46,109,101,100,11,117,49,
+56,54,51,46,109,101,100,86,49,5,117,49,56,54,52,9,117,49,56,54,52,46,105,
+110,105,11,117,49,56,54,52,46,105,110,105,86,49,9,117,49,56,54,52,46,109,
+101,100,9,117,49,56,54,52,46,102,105,110,10,117,49,56,54,52,95,49,56,53,68,
+14,117,49,56,54,52,95,49,56,53,68,46,105,110,105,14,117,49,56,54,52,95,49,
+56,53,68,46,109,101,100,14,117,49,56,54,52,95,49,56,53,68,46,102,105,110,
+10,117,49,56,54,52,95,49,56,53,69,14,117,49,56,54,52,95,49,56,53,69,46,105,
+110,105,14,117,49,56,54,52,95,49,56,53,69,46,109,101,100,14,117,49,56,54,
+52,95,49,56,53,69,46,102,105,110,10,117,49,56,54,52,95,49,56,55,51,14,117,
+49,56,54,52,95,49,56,55,51,46,105,110,105,14,117,49,56,54,52,95,49,56,55,
+51,46,109,101,100,14,117,49,56,54,52,95,49,56,55,51,46,102,105,110,10,117,
+49,56,54,52,95,49,56,54,48,14,117,49,56,54,52,95,49,56,54,48,46,105,110,105,
+14,117,49,56,54,52,95,49,56,54,48,46,109,101,100,14,117,49,56,54,52,95,49,
+56,54,48,46,102,105,110,5,117,49,56,54,53,9,117,49,56,54,53,46,105,110,105,
+12,117,49,56,54,52,46,105,110,105,70,101,109,12,117,49,56,54,53,46,105,110,
+105,70,101,109,9,117,49,56,54,53,46,109,101,100,9,117,49,56,54,53,46,102,
+105,110,11,117,49,56,54,53,46,109,101,100,86,49,10,117,49,56,54,53,95,49,
+56,53,68,14,117,49,56,54,53,95,49,56,53,68,46,105,110,105,14,117,49,56,54,
+53,95,49,56,53,68,46,109,101,100,14,117,49,56,54,53,95,49,56,53,68,46,102,
+105,110,10,117,49,56,54,53,95,49,56,53,69,14,117,49,56,54,53,95,49,56,53,
+69,46,105,110,105,14,117,49,56,54,53,95,49,56,53,69,46,109,101,100,14,117,
+49,56,54,53,95,49,56,53,69,46,102,105,110,10,117,49,56,54,53,95,49,56,54,
+48,14,117,49,56,54,53,95,49,56,54,48,46,105,110,105,14,117,49,56,54,53,95,
+49,56,54,48,46,109,101,100,14,117,49,56,54,53,95,49,56,54,48,46,102,105,110,
+10,117,49,56,54,53,95,49,56,55,51,14,117,49,56,54,53,95,49,56,55,51,46,105,
+110,105,14,117,49,56,54,53,95,49,56,55,51,46,109,101,100,14,117,49,56,54,
+53,95,49,56,55,51,46,102,105,110,9,117,49,56,54,54,46,105,110,105,5,117,49,
+56,54,54,9,117,49,56,54,54,46,109,101,100,9,117,49,56,54,54,46,102,105,110,
+14,117,49,56,54,54,95,49,56,50,48,46,105,110,105,10,117,49,56,54,54,95,49,
+56,50,48,14,117,49,56,54,54,95,49,56,50,48,46,102,105,110,14,117,49,56,54,
+54,95,49,56,50,48,46,109,101,100,14,117,49,56,54,54,95,49,56,50,51,46,105,
+110,105,14,117,49,56,54,54,95,49,56,53,68,46,105,110,105,14,117,49,56,54,
+54,95,49,56,54,48,46,105,110,105,10,117,49,56,54,54,95,49,56,54,48,14,117,
+49,56,54,54,95,49,56,50,51,46,109,101,100,14,117,49,56,54,54,95,49,56,50,
+51,46,102,105,110,10,117,49,56,54,54,95,49,56,53,68,14,117,49,56,54,54,95,
+49,56,53,68,46,109,101,100,14,117,49,56,54,54,95,49,56,53,68,46,102,105,110,
+14,117,49,56,54,54,95,49,56,53,69,46,105,110,105,10,117,49,56,54,54,95,49,
+56,53,69,14,117,49,56,54,54,95,49,56,53,69,46,109,101,100,14,117,49,56,54,
+54,95,49,56,53,69,46,102,105,110,14,117,49,56,54,54,95,49,56,54,48,46,109,
+101,100,14,117,49,56,54,54,95,49,56,54,48,46,102,105,110,10,117,49,56,54,
+54,95,49,56,54,49,14,117,49,56,54,54,95,49,56,54,49,46,105,110,105,14,117,
+49,56,54,54,95,49,56,54,49,46,109,101,100,14,117,49,56,54,54,95,49,56,54,
+49,46,102,105,110,10,117,49,56,54,54,95,49,56,55,51,14,117,49,56,54,54,95,
+49,56,55,51,46,105,110,105,14,117,49,56,54,54,95,49,56,55,51,46,109,101,100,
+14,117,49,56,54,54,95,49,56,55,51,46,102,105,110,10,117,49,56,54,54,95,49,
+56,56,56,14,117,49,56,54,54,95,49,56,56,56,46,105,110,105,14,117,49,56,54,
+54,95,49,56,56,56,46,109,101,100,14,117,49,56,54,54,95,49,56,56,56,46,102,
+105,110,5,117,49,56,54,55,9,117,49,56,54,55,46,109,101,100,9,117,49,56,54,
+55,46,105,110,105,9,117,49,56,54,55,46,102,105,110,11,117,49,56,54,56,46,
+109,101,100,86,49,11,117,49,56,54,56,46,109,101,100,86,50,9,117,49,56,54,
+56,46,102,105,110,11,117,49,56,54,56,46,105,110,105,86,49,5,117,49,56,54,
+56,9,117,49,56,54,56,46,105,110,105,9,117,49,56,54,56,46,109,101,100,5,117,
+49,56,54,57,11,117,49,56,54,57,46,105,110,105,86,49,9,117,49,56,54,57,46,
+105,110,105,9,117,49,56,54,57,46,109,101,100,9,117,49,56,54,57,46,102,105,
+110,11,117,49,56,54,57,46,109,101,100,86,49,9,117,49,56,54,65,46,105,110,
+105,9,117,49,56,54,65,46,109,101,100,5,117,49,56,54,65,9,117,49,56,54,65,
+46,102,105,110,5,117,49,56,54,66,9,117,49,56,54,66,46,105,110,105,9,117,49,
+56,54,66,46,109,101,100,9,117,49,56,54,66,46,102,105,110,5,117,49,56,54,67,
+9,117,49,56,54,67,46,105,110,105,9,117,49,56,54,67,46,109,101,100,9,117,49,
+56,54,67,46,102,105,110,10,117,49,56,54,67,95,49,56,50,48,14,117,49,56,54,
+67,95,49,56,50,48,46,105,110,105,14,117,49,56,54,67,95,49,56,50,48,46,109,
+101,100,14,117,49,56,54,67,95,49,56,50,48,46,102,105,110,10,117,49,56,54,
+67,95,49,56,50,51,14,117,49,56,54,67,95,49,56,50,51,46,105,110,105,14,117,
+49,56,54,67,95,49,56,50,51,46,109,101,100,14,117,49,56,54,67,95,49,56,50,
+51,46,102,105,110,10,117,49,56,54,67,95,49,56,53,68,14,117,49,56,54,67,95,
+49,56,53,68,46,105,110,105,14,117,49,56,54,67,95,49,56,53,68,46,109,101,100,
+14,117,49,56,54,67,95,49,56,53,68,46,102,105,110,10,117,49,56,54,67,95,49,
+56,54,48,14,117,49,56,54,67,95,49,56,54,48,46,105,110,105,14,117,49,56,54,
+67,95,49,56,54,48,46,109,101,100,14,117,49,56,54,67,95,49,56,54,48,46,102,
+105,110,10,117,49,56,54,67,95,49,56,56,56,14,117,49,56,54,67,95,49,56,56,
+56,46,105,110,105,14,117,49,56,54,67,95,49,56,56,56,46,109,101,100,14,117,
+49,56,54,67,95,49,56,56,56,46,102,105,110,5,117,49,56,54,68,9,117,49,56,54,
+68,46,105,110,105,10,117,49,56,54,68,95,49,56,50,48,14,117,49,56,54,68,95,
+49,56,50,48,46,105,110,105,10,117,49,56,54,68,95,49,56,50,51,14,117,49,56,
+54,68,95,49,56,50,51,46,105,110,105,9,117,49,56,54,68,46,109,101,100,9,117,
+49,56,54,68,46,102,105,110,14,117,49,56,54,68,95,49,56,50,48,46,109,101,100,
+14,117,49,56,54,68,95,49,56,50,48,46,102,105,110,14,117,49,56,54,68,95,49,
+56,50,51,46,109,101,100,14,117,49,56,54,68,95,49,56,50,51,46,102,105,110,
+9,117,49,56,54,69,46,105,110,105,9,117,49,56,54,69,46,109,101,100,9,117,49,
+56,54,69,46,102,105,110,5,117,49,56,54,70,9,117,49,56,54,70,46,109,101,100,
+9,117,49,56,54,70,46,105,110,105,9,117,49,56,54,70,46,102,105,110,11,117,
+49,56,54,70,46,105,110,105,86,49,11,117,49,56,54,70,46,109,101,100,86,49,
+5,117,49,56,55,48,9,117,49,56,55,48,46,105,110,105,9,117,49,56,55,48,46,109,
+101,100,9,117,49,56,55,48,46,102,105,110,4,70,86,83,49,4,70,86,83,50,4,70,
+86,83,51,3,77,86,83,5,117,49,56,48,48,8,117,49,56,48,48,46,86,49,8,117,49,
+56,48,48,46,86,50,8,117,49,56,48,48,46,86,51,8,117,49,56,48,48,46,86,52,5,
+117,49,56,49,48,5,117,49,56,49,53,5,117,49,56,49,52,5,117,49,56,49,54,5,117,
+49,56,49,50,5,117,49,56,49,51,5,117,49,56,49,49,5,117,49,56,49,57,5,117,49,
+56,49,56,5,117,49,56,49,55,5,117,49,56,48,49,5,117,49,56,48,53,5,117,49,56,
+48,51,8,76,101,102,116,84,97,105,108,11,117,49,56,50,48,46,102,105,110,86,
+49,11,117,49,56,50,49,46,102,105,110,86,49,9,117,49,56,50,52,46,105,115,111,
+9,117,49,56,50,54,46,105,115,111,11,117,49,56,50,68,46,109,101,100,78,86,
+11,117,49,56,50,68,46,109,101,100,86,49,9,117,49,56,50,68,46,109,101,100,
+11,117,49,56,50,68,46,109,101,100,86,51,11,117,49,56,50,68,46,109,101,100,
+86,50,11,117,49,56,50,53,46,109,101,100,86,49,9,117,49,56,50,53,46,109,101,
+100,11,117,49,56,50,54,46,109,101,100,86,49,9,117,49,56,50,54,46,109,101,
+100,11,117,49,56,50,56,46,109,101,100,86,49,9,117,49,56,50,56,46,109,101,
+100,11,117,49,56,50,67,46,105,115,111,86,49,11,117,49,56,50,67,46,105,115,
+111,86,50,11,117,49,56,50,67,46,105,110,105,86,49,11,117,49,56,50,67,46,105,
+110,105,86,50,11,117,49,56,50,67,46,109,101,100,86,49,11,117,49,56,50,67,
+46,109,101,100,86,50,16,117,49,56,50,67,95,49,56,50,50,46,105,110,105,86,
+50,11,117,49,56,50,68,46,105,115,111,86,50,11,117,49,56,50,68,46,102,105,
+110,86,50,9,117,49,56,51,51,46,109,101,100,11,117,49,56,51,51,46,109,101,
+100,86,49,9,117,49,56,53,68,46,105,115,111,9,117,49,56,53,69,46,105,115,111,
+9,117,49,56,54,49,46,105,115,111,5,117,49,56,55,49,9,117,49,56,55,49,46,105,
+110,105,9,117,49,56,55,49,46,109,101,100,9,117,49,56,55,49,46,102,105,110,
+5,117,49,56,55,50,9,117,49,56,55,50,46,105,110,105,9,117,49,56,55,50,46,109,
+101,100,9,117,49,56,55,50,46,102,105,110,9,117,49,56,55,51,46,105,115,111,
+5,117,49,56,55,51,9,117,49,56,55,51,46,105,110,105,9,117,49,56,55,51,46,109,
+101,100,11,117,49,56,55,51,46,109,101,100,86,49,11,117,49,56,55,51,46,109,
+101,100,86,50,9,117,49,56,55,51,46,102,105,110,11,117,49,56,55,51,46,102,
+105,110,86,50,12,117,49,56,55,52,46,102,105,110,70,101,109,14,117,49,56,55,
+52,46,102,105,110,70,101,109,86,49,5,117,49,56,55,52,9,117,49,56,55,52,46,
+102,105,110,9,117,49,56,55,52,46,109,101,100,11,117,49,56,55,52,46,109,101,
+100,86,49,12,117,49,56,55,52,46,105,115,111,70,101,109,9,117,49,56,55,52,
+46,105,110,105,10,117,49,56,55,52,95,49,56,53,68,14,117,49,56,55,52,95,49,
+56,53,68,46,109,101,100,14,117,49,56,55,52,95,49,56,53,68,46,105,110,105,
+14,117,49,56,55,52,95,49,56,53,68,46,102,105,110,10,117,49,56,55,52,95,49,
+56,53,69,14,117,49,56,55,52,95,49,56,53,69,46,105,110,105,14,117,49,56,55,
+52,95,49,56,53,69,46,109,101,100,14,117,49,56,55,52,95,49,56,53,69,46,102,
+105,110,10,117,49,56,55,52,95,49,56,54,48,14,117,49,56,55,52,95,49,56,54,
+48,46,105,110,105,14,117,49,56,55,52,95,49,56,54,48,46,109,101,100,14,117,
+49,56,55,52,95,49,56,54,48,46,102,105,110,16,117,49,56,55,52,95,49,56,54,
+49,46,105,110,105,86,49,16,117,49,56,55,52,95,49,56,54,49,46,109,101,100,
+86,49,10,117,49,56,55,52,95,49,56,55,51,14,117,49,56,55,52,95,49,56,55,51,
+46,105,110,105,14,117,49,56,55,52,95,49,56,55,51,46,109,101,100,14,117,49,
+56,55,52,95,49,56,55,51,46,102,105,110,5,117,49,56,55,53,9,117,49,56,55,53,
+46,105,110,105,9,117,49,56,55,53,46,109,101,100,9,117,49,56,55,53,46,102,
+105,110,5,117,49,56,55,54,9,117,49,56,55,54,46,105,110,105,9,117,49,56,55,
+54,46,109,101,100,9,117,49,56,55,54,46,102,105,110,5,117,49,56,55,55,9,117,
+49,56,55,55,46,105,110,105,9,117,49,56,55,55,46,109,101,100,9,117,49,56,55,
+55,46,102,105,110,5,117,49,56,56,48,8,117,49,56,56,48,46,86,49,5,117,49,56,
+56,49,5,117,49,56,56,50,9,117,49,56,56,56,46,109,101,100,11,117,49,56,56,
+56,46,102,105,110,86,49,10,117,49,56,56,57,95,49,56,50,48,14,117,49,56,56,
+57,95,49,56,50,48,46,105,110,105,14,117,49,56,56,57,95,49,56,50,48,46,109,
+101,100,14,117,49,56,56,57,95,49,56,50,48,46,102,105,110,10,117,49,56,56,
+57,95,49,56,50,50,14,117,49,56,56,57,95,49,56,50,50,46,105,110,105,14,117,
+49,56,56,57,95,49,56,50,50,46,109,101,100,14,117,49,56,56,57,95,49,56,50,
+50,46,102,105,110,10,117,49,56,56,57,95,49,56,50,51,14,117,49,56,56,57,95,
+49,56,50,51,46,105,110,105,14,117,49,56,56,57,95,49,56,50,51,46,109,101,100,
+14,117,49,56,56,57,95,49,56,50,51,46,102,105,110,10,117,49,56,56,57,95,49,
+56,50,54,14,117,49,56,56,57,95,49,56,50,54,46,105,110,105,13,117,49,56,56,
+57,95,49,56,50,54,46,86,49,14,117,49,56,56,57,95,49,56,50,54,46,109,101,100,
+14,117,49,56,56,57,95,49,56,50,54,46,102,105,110,16,117,49,56,56,57,95,49,
+56,50,54,46,105,110,105,86,49,16,117,49,56,56,57,95,49,56,50,54,46,109,101,
+100,86,49,16,117,49,56,56,57,95,49,56,50,54,46,102,105,110,86,49,10,117,49,
+56,56,57,95,49,56,52,52,14,117,49,56,56,57,95,49,56,52,52,46,105,110,105,
+14,117,49,56,56,57,95,49,56,52,52,46,109,101,100,14,117,49,56,56,57,95,49,
+56,52,52,46,102,105,110,10,117,49,56,56,57,95,49,56,52,53,14,117,49,56,56,
+57,95,49,56,52,53,46,109,101,100,14,117,49,56,56,57,95,49,56,52,53,46,102,
+105,110,14,117,49,56,56,57,95,49,56,52,53,46,105,110,105,10,117,49,56,56,
+57,95,49,56,52,54,14,117,49,56,56,57,95,49,56,52,54,46,105,110,105,14,117,
+49,56,56,57,95,49,56,52,54,46,109,101,100,14,117,49,56,56,57,95,49,56,52,
+54,46,102,105,110,10,117,49,56,56,57,95,49,56,52,55,14,117,49,56,56,57,95,
+49,56,52,55,46,105,110,105,14,117,49,56,56,57,95,49,56,52,55,46,109,101,100,
+14,117,49,56,56,57,95,49,56,52,55,46,102,105,110,10,117,49,56,56,57,95,49,
+56,56,56,14,117,49,56,56,57,95,49,56,56,56,46,105,110,105,14,117,49,56,56,
+57,95,49,56,56,56,46,109,101,100,14,117,49,56,56,57,95,49,56,56,56,46,102,
+105,110,5,117,49,56,56,68,5,117,49,56,65,54,9,117,49,56,65,54,46,109,101,
+100,9,117,49,56,65,54,46,105,110,105,9,117,49,56,65,54,46,102,105,110,9,117,
+49,56,56,68,46,109,101,100,9,117,49,56,56,68,46,105,110,105,9,117,49,56,56,
+68,46,102,105,110,5,117,49,56,57,50,9,117,49,56,57,50,46,105,110,105,14,117,
+49,56,57,50,95,49,56,50,50,46,105,110,105,10,117,49,56,57,50,95,49,56,50,
+48,14,117,49,56,57,50,95,49,56,50,48,46,105,110,105,14,117,49,56,57,50,95,
+49,56,50,48,46,109,101,100,14,117,49,56,57,50,95,49,56,50,48,46,102,105,110,
+9,117,49,56,57,50,46,109,101,100,9,117,49,56,57,50,46,102,105,110,10,117,
+49,56,57,50,95,49,56,50,50,14,117,49,56,57,50,95,49,56,50,50,46,102,105,110,
+14,117,49,56,57,50,95,49,56,50,50,46,109,101,100,10,117,49,56,57,50,95,49,
+56,50,51,14,117,49,56,57,50,95,49,56,50,51,46,105,110,105,14,117,49,56,57,
+50,95,49,56,50,51,46,109,101,100,14,117,49,56,57,50,95,49,56,50,51,46,102,
+105,110,10,117,49,56,57,50,95,49,56,50,54,13,117,49,56,57,50,95,49,56,50,
+54,46,86,49,14,117,49,56,57,50,95,49,56,50,54,46,105,110,105,14,117,49,56,
+57,50,95,49,56,50,54,46,109,101,100,14,117,49,56,57,50,95,49,56,50,54,46,
+102,105,110,16,117,49,56,57,50,95,49,56,50,54,46,102,105,110,86,49,16,117,
+49,56,57,50,95,49,56,50,54,46,105,110,105,86,49,16,117,49,56,57,50,95,49,
+56,50,54,46,109,101,100,86,49,10,117,49,56,57,50,95,49,56,54,48,14,117,49,
+56,57,50,95,49,56,54,48,46,105,110,105,14,117,49,56,57,50,95,49,56,54,48,
+46,109,101,100,14,117,49,56,57,50,95,49,56,54,48,46,102,105,110,14,117,49,
+56,57,50,95,49,56,55,51,46,109,101,100,14,117,49,56,57,50,95,49,56,55,51,
+46,102,105,110,10,117,49,56,57,50,95,49,56,55,51,14,117,49,56,57,50,95,49,
+56,55,51,46,105,110,105,10,117,49,56,57,50,95,49,56,56,56,14,117,49,56,57,
+50,95,49,56,56,56,46,105,110,105,14,117,49,56,57,50,95,49,56,56,56,46,109,
+101,100,14,117,49,56,57,50,95,49,56,56,56,46,102,105,110,14,117,49,56,57,
+50,95,49,56,53,68,46,109,101,100,14,117,49,56,57,50,95,49,56,53,68,46,102,
+105,110,10,117,49,56,57,50,95,49,56,53,68,14,117,49,56,57,50,95,49,56,53,
+68,46,105,110,105,14,117,49,56,57,50,95,49,56,50,55,46,105,110,105,10,117,
+49,56,57,50,95,49,56,50,55,14,117,49,56,57,50,95,49,56,50,55,46,109,101,100,
+14,117,49,56,57,50,95,49,56,50,55,46,102,105,110,10,117,49,56,57,50,95,49,
+56,52,52,14,117,49,56,57,50,95,49,56,52,52,46,105,110,105,14,117,49,56,57,
+50,95,49,56,52,52,46,109,101,100,14,117,49,56,57,50,95,49,56,52,52,46,102,
+105,110,14,117,49,56,57,50,95,49,56,52,53,46,105,110,105,10,117,49,56,57,
+50,95,49,56,52,53,14,117,49,56,57,50,95,49,56,52,53,46,109,101,100,14,117,
+49,56,57,50,95,49,56,52,53,46,102,105,110,10,117,49,56,57,50,95,49,56,52,
+55,14,117,49,56,57,50,95,49,56,52,55,46,105,110,105,14,117,49,56,57,50,95,
+49,56,52,55,46,109,101,100,14,117,49,56,57,50,95,49,56,52,55,46,102,105,110,
+5,117,49,56,57,53,9,117,49,56,57,53,46,105,110,105,9,117,49,56,57,53,46,109,
+101,100,9,117,49,56,57,53,46,102,105,110,5,117,49,56,57,54,9,117,49,56,57,
+54,46,109,101,100,9,117,49,56,57,54,46,105,110,105,9,117,49,56,57,54,46,102,
+105,110,3,90,87,74,4,90,87,78,74,9,117,49,56,57,65,46,109,101,100,9,117,49,
+56,57,65,46,102,105,110,5,117,49,56,57,65,9,117,49,56,57,65,46,105,110,105,
+5,117,49,56,57,66,9,117,49,56,57,66,46,109,101,100,9,117,49,56,57,66,46,105,
+110,105,9,117,49,56,57,66,46,102,105,110,5,117,49,56,57,67,9,117,49,56,57,
+67,46,109,101,100,9,117,49,56,57,67,46,105,110,105,9,117,49,56,57,67,46,102,
+105,110,10,117,49,56,65,56,95,49,56,55,51,14,117,49,56,65,56,95,49,56,55,
+51,46,105,110,105,14,117,49,56,65,56,95,49,56,55,51,46,109,101,100,14,117,
+49,56,65,56,95,49,56,55,51,46,102,105,110,10,117,49,56,65,56,95,49,56,56,
+56,14,117,49,56,65,56,95,49,56,56,56,46,109,101,100,14,117,49,56,65,56,95,
+49,56,56,56,46,102,105,110,14,117,49,56,65,56,95,49,56,56,56,46,105,110,105,
+10,117,49,56,65,56,95,49,56,54,48,14,117,49,56,65,56,95,49,56,54,48,46,105,
+110,105,14,117,49,56,65,56,95,49,56,54,48,46,109,101,100,14,117,49,56,65,
+56,95,49,56,54,48,46,102,105,110,10,117,49,56,65,56,95,49,56,53,68,14,117,
+49,56,65,56,95,49,56,53,68,46,105,110,105,14,117,49,56,65,56,95,49,56,53,
+68,46,109,101,100,14,117,49,56,65,56,95,49,56,53,68,46,102,105,110,10,117,
+49,56,65,56,95,49,56,50,51,14,117,49,56,65,56,95,49,56,50,51,46,105,110,105,
+14,117,49,56,65,56,95,49,56,50,51,46,109,101,100,14,117,49,56,65,56,95,49,
+56,50,51,46,102,105,110,10,117,49,56,65,56,95,49,56,50,48,14,117,49,56,65,
+56,95,49,56,50,48,46,105,110,105,14,117,49,56,65,56,95,49,56,50,48,46,109,
+101,100,14,117,49,56,65,56,95,49,56,50,48,46,102,105,110,5,117,49,56,65,56,
+9,117,49,56,65,56,46,105,110,105,9,117,49,56,65,56,46,109,101,100,9,117,49,
+56,65,56,46,102,105,110,5,117,49,56,65,53,9,117,49,56,65,53,46,105,110,105,
+9,117,49,56,65,53,46,109,101,100,9,117,49,56,65,53,46,102,105,110,5,117,49,
+56,65,50,9,117,49,56,65,50,46,105,110,105,9,117,49,56,65,50,46,109,101,100,
+9,117,49,56,65,50,46,102,105,110,5,117,49,56,65,49,9,117,49,56,65,49,46,105,
+110,105,11,117,49,56,65,49,46,105,110,105,86,49,9,117,49,56,65,49,46,109,
+101,100,9,117,49,56,65,49,46,102,105,110,11,117,49,56,65,49,46,109,101,100,
+86,49,5,117,49,56,56,70,9,117,49,56,56,70,46,102,105,110,9,117,49,56,56,70,
+46,109,101,100,9,117,49,56,56,70,46,105,110,105,5,117,49,56,56,65,9,117,49,
+56,56,65,46,105,110,105,5,117,49,56,65,51,9,117,49,56,65,51,46,105,110,105,
+5,117,49,56,57,69,9,117,49,56,57,69,46,105,110,105,9,117,49,56,65,51,46,109,
+101,100,9,117,49,56,65,51,46,102,105,110,9,117,49,56,57,69,46,109,101,100,
+9,117,49,56,57,69,46,102,105,110,5,117,49,56,57,70,9,117,49,56,57,70,46,105,
+110,105,9,117,49,56,57,70,46,109,101,100,9,117,49,56,57,70,46,102,105,110,
+5,117,49,56,65,52,9,117,49,56,65,52,46,105,110,105,9,117,49,56,65,52,46,109,
+101,100,9,117,49,56,65,52,46,102,105,110,9,117,49,56,53,50,46,105,110,105,
+5,117,49,56,57,48,9,117,49,56,57,48,46,109,101,100,9,117,49,56,57,48,46,105,
+110,105,9,117,49,56,57,48,46,102,105,110,5,117,49,56,57,56,9,117,49,56,57,
+56,46,105,110,105,9,117,49,56,57,56,46,109,101,100,9,117,49,56,57,56,46,102,
+105,110,5,117,49,56,65,48,9,117,49,56,65,48,46,105,110,105,9,117,49,56,65,
+48,46,109,101,100,9,117,49,56,65,48,46,102,105,110,5,117,49,56,57,49,9,117,
+49,56,57,49,46,109,101,100,9,117,49,56,57,49,46,105,110,105,9,117,49,56,57,
+49,46,102,105,110,5,117,49,56,56,66,9,117,49,56,56,66,46,109,101,100,9,117,
+49,56,56,66,46,105,110,105,9,117,49,56,56,66,46,102,105,110,5,117,49,56,57,
+51,9,117,49,56,57,51,46,105,110,105,9,117,49,56,57,51,46,109,101,100,9,117,
+49,56,57,51,46,102,105,110,14,117,49,56,57,51,95,49,56,50,50,46,105,110,105,
+10,117,49,56,57,51,95,49,56,50,51,14,117,49,56,57,51,95,49,56,50,51,46,105,
+110,105,14,117,49,56,57,51,95,49,56,50,55,46,105,110,105,14,117,49,56,57,
+51,95,49,56,50,48,46,105,110,105,10,117,49,56,57,51,95,49,56,50,48,14,117,
+49,56,57,51,95,49,56,50,48,46,109,101,100,14,117,49,56,57,51,95,49,56,50,
+48,46,102,105,110,10,117,49,56,57,51,95,49,56,50,50,14,117,49,56,57,51,95,
+49,56,50,50,46,109,101,100,14,117,49,56,57,51,95,49,56,50,50,46,102,105,110,
+14,117,49,56,57,51,95,49,56,50,51,46,102,105,110,10,117,49,56,57,51,95,49,
+56,50,54,14,117,49,56,57,51,95,49,56,50,51,46,109,101,100,14,117,49,56,57,
+51,95,49,56,50,54,46,105,110,105,13,117,49,56,57,51,95,49,56,50,54,46,86,
+49,16,117,49,56,57,51,95,49,56,50,54,46,105,110,105,86,49,16,117,49,56,57,
+51,95,49,56,50,54,46,109,101,100,86,49,14,117,49,56,57,51,95,49,56,50,54,
+46,109,101,100,14,117,49,56,57,51,95,49,56,50,54,46,102,105,110,16,117,49,
+56,57,51,95,49,56,50,54,46,102,105,110,86,49,10,117,49,56,57,51,95,49,56,
+50,55,14,117,49,56,57,51,95,49,56,50,55,46,109,101,100,14,117,49,56,57,51,
+95,49,56,50,55,46,102,105,110,10,117,49,56,57,51,95,49,56,56,56,14,117,49,
+56,57,51,95,49,56,56,56,46,105,110,105,14,117,49,56,57,51,95,49,56,56,56,
+46,109,101,100,14,117,49,56,57,51,95,49,56,56,56,46,102,105,110,5,117,49,
+56,57,52,9,117,49,56,57,52,46,105,110,105,9,117,49,56,57,52,46,109,101,100,
+9,117,49,56,57,52,46,102,105,110,5,117,49,56,57,55,9,117,49,56,57,55,46,105,
+110,105,9,117,49,56,57,55,46,109,101,100,9,117,49,56,57,55,46,102,105,110,
+5,117,49,56,57,68,9,117,49,56,57,68,46,109,101,100,9,117,49,56,57,68,46,105,
+110,105,9,117,49,56,57,68,46,102,105,110,5,117,49,56,57,57,9,117,49,56,57,
+57,46,105,110,105,9,117,49,56,57,57,46,109,101,100,9,117,49,56,57,57,46,102,
+105,110,5,117,49,56,65,55,9,117,49,56,65,55,46,105,110,105,9,117,49,56,65,
+55,46,109,101,100,9,117,49,56,65,55,46,102,105,110,5,117,49,56,56,67,9,117,
+49,56,56,67,46,105,110,105,9,117,49,56,56,67,46,109,101,100,9,117,49,56,56,
+67,46,102,105,110,11,117,49,56,55,51,46,109,101,100,86,51,11,117,49,56,55,
+51,46,102,105,110,86,49,11,117,49,56,55,51,46,102,105,110,86,51,10,117,49,
+56,51,57,95,49,56,56,56,14,117,49,56,51,57,95,49,56,56,56,46,105,110,105,
+14,117,49,56,51,57,95,49,56,56,56,46,109,101,100,14,117,49,56,51,57,95,49,
+56,56,56,46,102,105,110,14,117,49,56,51,57,95,49,56,50,55,46,105,110,105,
+10,117,49,56,51,57,95,49,56,50,55,14,117,49,56,51,57,95,49,56,50,55,46,109,
+101,100,14,117,49,56,51,57,95,49,56,50,55,46,102,105,110,14,117,49,56,51,
+66,95,49,56,52,55,46,105,110,105,10,117,49,56,51,66,95,49,56,52,55,14,117,
+49,56,51,66,95,49,56,52,55,46,109,101,100,14,117,49,56,51,66,95,49,56,52,
+55,46,102,105,110,10,117,49,56,51,66,95,49,56,56,56,14,117,49,56,51,66,95,
+49,56,56,56,46,109,101,100,14,117,49,56,51,66,95,49,56,56,56,46,102,105,110,
+14,117,49,56,51,66,95,49,56,56,56,46,105,110,105,11,117,49,56,52,69,46,109,
+101,100,86,49,5,117,49,56,65,57,5,117,49,56,53,53,9,117,49,56,53,53,46,105,
+110,105,9,117,49,56,53,53,46,109,101,100,9,117,49,56,53,53,46,102,105,110,
+5,117,49,56,53,54,9,117,49,56,53,54,46,109,101,100,9,117,49,56,53,54,46,105,
+110,105,9,117,49,56,53,54,46,102,105,110,9,117,49,56,52,69,46,102,105,110,
+11,117,49,56,55,54,46,105,110,105,86,49,11,117,49,56,55,54,46,109,101,100,
+86,49,5,117,49,56,56,69,9,117,49,56,56,69,46,105,110,105,9,117,49,56,56,69,
+46,109,101,100,9,117,49,56,56,69,46,102,105,110,9,117,49,56,56,65,46,109,
+101,100,11,117,49,56,56,65,46,105,110,105,86,49,11,117,49,56,56,65,46,109,
+101,100,86,49,5,117,49,56,65,65,14,117,49,56,56,57,95,49,56,50,55,46,109,
+101,100,14,117,49,56,56,57,95,49,56,50,55,46,102,105,110,10,117,49,56,56,
+57,95,49,56,50,55,14,117,49,56,56,57,95,49,56,50,55,46,105,110,105,10,117,
+49,56,50,66,95,49,56,56,56,14,117,49,56,50,66,95,49,56,56,56,46,109,101,100,
+14,117,49,56,50,66,95,49,56,56,56,46,102,105,110,14,117,49,56,50,66,95,49,
+56,56,56,46,105,110,105,10,117,49,56,50,67,95,49,56,56,56,13,117,49,56,50,
+67,95,49,56,56,56,46,86,49,14,117,49,56,50,67,95,49,56,56,56,46,102,105,110,
+16,117,49,56,50,67,95,49,56,56,56,46,102,105,110,86,49,14,117,49,56,50,67,
+95,49,56,56,56,46,105,110,105,16,117,49,56,50,67,95,49,56,56,56,46,105,110,
+105,86,49,14,117,49,56,50,67,95,49,56,56,56,46,109,101,100,16,117,49,56,50,
+67,95,49,56,56,56,46,109,101,100,86,49,5,117,49,56,56,51,5,117,49,56,56,53,
+5,117,49,56,56,54,8,117,49,56,56,49,46,86,49,12,117,49,56,55,52,46,109,101,
+100,70,101,109,14,117,49,56,55,52,46,109,101,100,70,101,109,86,49,14,117,
+49,56,50,48,95,49,56,52,51,46,102,105,110,5,117,49,56,48,52,5,78,78,66,83,
+80,9,117,49,56,56,65,46,102,105,110,10,117,49,56,50,65,95,49,56,52,52,14,
+117,49,56,50,65,95,49,56,52,52,46,105,110,105,10,117,49,56,50,65,95,49,56,
+52,53,14,117,49,56,50,65,95,49,56,52,53,46,105,110,105,14,117,49,56,50,65,
+95,49,56,52,52,46,109,101,100,14,117,49,56,50,65,95,49,56,52,52,46,102,105,
+110,14,117,49,56,50,65,95,49,56,52,53,46,109,101,100,14,117,49,56,50,65,95,
+49,56,52,53,46,102,105,110,10,117,49,56,50,65,95,49,56,52,55,14,117,49,56,
+50,65,95,49,56,52,55,46,105,110,105,14,117,49,56,50,65,95,49,56,52,55,46,
+109,101,100,14,117,49,56,50,65,95,49,56,52,55,46,102,105,110,10,117,49,56,
+50,65,95,49,56,52,56,14,117,49,56,50,65,95,49,56,52,56,46,105,110,105,14,
+117,49,56,50,65,95,49,56,52,56,46,109,101,100,14,117,49,56,50,65,95,49,56,
+52,56,46,102,105,110,10,117,49,56,50,65,95,49,56,52,57,14,117,49,56,50,65,
+95,49,56,52,57,46,105,110,105,14,117,49,56,50,65,95,49,56,52,57,46,109,101,
+100,14,117,49,56,50,65,95,49,56,52,57,46,102,105,110,10,117,49,56,50,65,95,
+49,56,53,68,14,117,49,56,50,65,95,49,56,53,68,46,105,110,105,14,117,49,56,
+50,65,95,49,56,53,68,46,109,101,100,14,117,49,56,50,65,95,49,56,53,68,46,
+102,105,110,14,117,49,56,50,65,95,49,56,53,69,46,109,101,100,14,117,49,56,
+50,65,95,49,56,53,69,46,102,105,110,14,117,49,56,50,65,95,49,56,53,69,46,
+105,110,105,10,117,49,56,50,65,95,49,56,53,69,10,117,49,56,50,65,95,49,56,
+54,48,14,117,49,56,50,65,95,49,56,54,48,46,105,110,105,14,117,49,56,50,65,
+95,49,56,54,48,46,109,101,100,14,117,49,56,50,65,95,49,56,54,48,46,102,105,
+110,14,117,49,56,50,65,95,49,56,54,49,46,109,101,100,14,117,49,56,50,65,95,
+49,56,54,49,46,102,105,110,14,117,49,56,50,65,95,49,56,54,49,46,105,110,105,
+10,117,49,56,50,65,95,49,56,54,49,10,117,49,56,50,65,95,49,56,55,51,14,117,
+49,56,50,65,95,49,56,55,51,46,105,110,105,14,117,49,56,50,65,95,49,56,55,
+51,46,109,101,100,14,117,49,56,50,65,95,49,56,55,51,46,102,105,110,10,117,
+49,56,50,65,95,49,56,56,56,14,117,49,56,50,65,95,49,56,56,56,46,105,110,105,
+14,117,49,56,50,65,95,49,56,56,56,46,109,101,100,14,117,49,56,50,65,95,49,
+56,56,56,46,102,105,110,14,117,49,56,51,65,95,49,56,52,52,46,105,110,105,
+10,117,49,56,51,65,95,49,56,52,52,14,117,49,56,51,65,95,49,56,52,52,46,109,
+101,100,14,117,49,56,51,65,95,49,56,52,52,46,102,105,110,10,117,49,56,51,
+65,95,49,56,52,53,14,117,49,56,51,65,95,49,56,52,53,46,105,110,105,14,117,
+49,56,51,65,95,49,56,52,53,46,109,101,100,14,117,49,56,51,65,95,49,56,52,
+53,46,102,105,110,10,117,49,56,51,65,95,49,56,52,55,14,117,49,56,51,65,95,
+49,56,52,55,46,105,110,105,14,117,49,56,51,65,95,49,56,52,55,46,109,101,100,
+14,117,49,56,51,65,95,49,56,52,55,46,102,105,110,10,117,49,56,51,65,95,49,
+56,53,68,14,117,49,56,51,65,95,49,56,53,68,46,105,110,105,14,117,49,56,51,
+65,95,49,56,53,68,46,109,101,100,14,117,49,56,51,65,95,49,56,53,68,46,102,
+105,110,10,117,49,56,51,65,95,49,56,54,48,14,117,49,56,51,65,95,49,56,54,
+48,46,105,110,105,14,117,49,56,51,65,95,49,56,54,48,46,109,101,100,14,117,
+49,56,51,65,95,49,56,54,48,46,102,105,110,10,117,49,56,51,65,95,49,56,55,
+51,14,117,49,56,51,65,95,49,56,55,51,46,105,110,105,14,117,49,56,51,65,95,
+49,56,55,51,46,109,101,100,14,117,49,56,51,65,95,49,56,55,51,46,102,105,110,
+14,117,49,56,51,65,95,49,56,56,56,46,105,110,105,14,117,49,56,51,65,95,49,
+56,56,56,46,109,101,100,14,117,49,56,51,65,95,49,56,56,56,46,102,105,110,
+10,117,49,56,51,65,95,49,56,56,56,10,117,49,56,50,68,95,49,56,56,56,13,117,
+49,56,50,68,95,49,56,56,56,46,86,49,14,117,49,56,50,68,95,49,56,56,56,46,
+105,110,105,16,117,49,56,50,68,95,49,56,56,56,46,105,110,105,86,49,14,117,
+49,56,50,68,95,49,56,56,56,46,109,101,100,16,117,49,56,50,68,95,49,56,56,
+56,46,109,101,100,86,49,14,117,49,56,50,68,95,49,56,56,56,46,102,105,110,
+16,117,49,56,50,68,95,49,56,56,56,46,102,105,110,86,49,9,117,49,56,56,57,
+46,109,101,100,5,117,49,56,56,57,9,117,49,56,56,57,46,105,110,105,11,117,
+49,56,56,56,46,102,105,110,86,50,9,117,49,56,56,57,46,102,105,110,11,117,
+49,56,56,56,46,109,101,100,86,49,9,117,49,56,56,56,46,105,110,105,11,117,
+49,56,56,55,46,102,105,110,86,49,9,117,49,56,56,55,46,102,105,110,5,117,49,
+56,56,55,8,117,49,56,56,55,46,86,49,11,117,49,56,56,55,46,102,105,110,86,
+50,11,117,49,56,56,55,46,102,105,110,86,51,5,117,49,56,56,56,9,117,49,56,
+56,56,46,102,105,110,5,117,49,56,48,54,5,117,49,56,48,55,9,117,49,56,48,55,
+46,109,101,100,5,117,49,56,48,56,5,117,49,56,48,57,5,117,50,48,52,56,5,117,
+50,48,52,57,5,117,51,48,48,49,5,117,51,48,48,50,12,100,111,116,116,101,100,
+99,105,114,99,108,101,5,117,70,69,51,68,5,117,70,69,51,69,5,117,70,69,52,
+49,5,117,70,69,52,50,5,117,70,69,52,51,5,117,70,69,52,52,5,117,50,52,54,48,
+5,117,50,52,54,54,5,117,50,52,54,49,5,117,50,52,54,50,5,117,50,52,54,51,5,
+117,50,52,54,52,5,117,50,52,54,53,5,117,50,52,54,55,5,117,50,52,54,56,5,117,
+50,52,54,57,5,117,50,52,55,51,5,117,50,52,54,65,5,117,50,52,54,66,5,117,50,
+52,54,67,5,117,50,52,54,68,5,117,50,52,54,69,5,117,50,52,54,70,5,117,50,52,
+55,48,5,117,50,52,55,49,5,117,50,52,55,50,13,117,49,56,50,67,95,49,56,50,
+53,46,86,50,13,117,49,56,50,67,95,49,56,50,53,46,86,51,16,117,49,56,50,67,
+95,49,56,50,53,46,109,101,100,86,50,16,117,49,56,50,67,95,49,56,50,53,46,
+109,101,100,86,49,16,117,49,56,50,67,95,49,56,50,53,46,102,105,110,86,49,
+13,117,49,56,50,67,95,49,56,50,54,46,86,50,13,117,49,56,50,67,95,49,56,50,
+54,46,86,49,16,117,49,56,50,67,95,49,56,50,54,46,105,110,105,86,49,16,117,
+49,56,50,67,95,49,56,50,54,46,105,110,105,86,50,16,117,49,56,50,67,95,49,
+56,50,54,46,109,101,100,86,49,13,117,49,56,50,68,95,49,56,50,53,46,86,49,
+16,117,49,56,50,68,95,49,56,50,53,46,109,101,100,86,49,16,117,49,56,50,68,
+95,49,56,50,53,46,102,105,110,86,49,16,117,49,56,50,68,95,49,56,50,54,46,
+102,105,110,86,49,5,117,49,56,56,52,9,117,49,56,65,65,46,105,110,105,9,117,
+49,56,65,65,46,109,101,100,9,117,49,56,50,48,46,109,101,100,20,117,49,56,
+50,67,118,49,95,49,56,50,48,95,49,46,102,105,110,86,49,18,117,49,56,50,69,
+95,49,56,50,48,95,49,46,102,105,110,86,49,0,0,0,2,0,8,0,2,255,255,0,3,0,1,
+0,0,0,12,0,0,0,0,0,0,0,2,0,2,3,142,3,145,0,3,5,29,5,29,0,3,0,1,0,0,0,10,0,
+44,0,46,0,2,68,70,76,84,0,14,109,111,110,103,0,24,0,4,0,0,0,0,255,255,0,0,
+0,4,0,0,0,0,255,255,0,0,0,0,0,0,0,1,0,0,0,10,0,38,0,124,0,1,109,111,110,103,
+0,8,0,4,0,0,0,0,255,255,0,5,0,0,0,1,0,2,0,3,0,4,0,5,102,105,110,97,0,32,105,
+110,105,116,0,40,105,115,111,108,0,48,109,101,100,105,0,56,114,108,105,103,
+0,64,0,0,0,2,0,3,0,4,0,0,0,2,0,7,0,8,0,0,0,2,0,1,0,2,0,0,0,2,0,5,0,6,0,0,
+0,9,0,0,0,9,0,10,0,11,0,12,0,13,0,21,0,22,0,23,0,25,0,52,0,136,1,110,1,168,
+3,44,5,38,7,156,9,154,10,206,12,200,18,30,19,160,25,196,26,140,29,142,29,
+252,30,34,30,80,30,106,30,156,30,186,30,228,58,164,59,26,59,206,0,4,0,0,0,
+1,0,8,0,1,0,66,0,3,0,12,0,46,0,56,0,4,0,10,0,16,0,22,0,28,3,147,0,2,3,142,
+3,148,0,2,3,143,3,149,0,2,3,144,3,150,0,2,4,110,0,1,0,4,3,249,0,2,3,142,0,
+1,0,4,5,68,0,2,3,142,0,1,0,3,3,146,3,248,3,250,0,4,0,0,0,1,0,8,0,1,0,190,
+0,14,0,34,0,44,0,54,0,72,0,82,0,92,0,102,0,112,0,130,0,140,0,150,0,160,0,
+170,0,180,0,1,0,4,0,17,0,2,3,142,0,1,0,4,0,90,0,2,3,142,0,2,0,6,0,12,3,180,
+0,2,3,142,3,181,0,2,3,143,0,1,0,4,0,223,0,2,3,142,0,1,0,4,0,236,0,2,3,142,
+0,1,0,4,3,193,0,2,3,142,0,1,0,4,1,148,0,2,3,142,0,2,0,6,0,12,3,180,0,2,3,
+142,3,187,0,2,3,143,0,1,0,4,2,125,0,2,3,142,0,1,0,4,3,191,0,2,3,142,0,1,0,
+4,3,192,0,2,3,142,0,1,0,4,3,202,0,2,3,142,0,1,0,4,3,216,0,2,3,142,0,1,0,4,
+5,165,0,2,3,142,0,1,0,14,0,15,0,89,0,106,0,222,0,235,1,75,1,149,1,245,2,123,
+2,198,2,206,3,203,3,212,5,164,0,1,0,0,0,1,0,8,0,2,0,26,0,10,3,168,3,167,3,
+193,3,191,3,192,2,239,3,12,3,13,3,202,3,216,0,1,0,10,0,189,0,198,1,75,2,198,
+2,206,2,230,2,245,3,10,3,203,3,212,0,4,0,0,0,1,0,8,0,1,1,82,0,19,0,44,0,54,
+0,64,0,74,0,92,0,102,0,112,0,122,0,132,0,142,0,152,0,162,0,172,0,198,0,224,
+0,250,1,20,1,38,1,64,0,1,0,4,0,57,0,2,3,143,0,1,0,4,0,200,0,2,3,142,0,1,0,
+4,1,93,0,2,3,142,0,2,0,6,0,12,0,85,0,2,3,142,0,196,0,2,3,143,0,1,0,4,3,165,
+0,2,3,142,0,1,0,4,0,42,0,2,3,142,0,1,0,4,3,166,0,2,3,142,0,1,0,4,0,155,0,
+2,3,142,0,1,0,4,0,8,0,2,3,142,0,1,0,4,0,229,0,2,3,142,0,1,0,4,3,188,0,2,3,
+143,0,1,0,4,0,147,0,2,3,142,0,3,0,8,0,14,0,20,2,200,0,2,3,142,2,204,0,2,3,
+143,2,205,0,2,3,144,0,3,0,8,0,14,0,20,2,212,0,2,3,142,2,213,0,2,3,143,2,214,
+0,2,3,144,0,3,0,8,0,14,0,20,2,224,0,2,3,142,2,225,0,2,3,143,2,226,0,2,3,144,
+0,3,0,8,0,14,0,20,5,10,0,2,3,142,3,209,0,2,3,143,5,11,0,2,3,144,0,2,0,6,0,
+12,3,210,0,2,3,142,3,211,0,2,3,143,0,3,0,8,0,14,0,20,5,162,0,2,3,142,5,166,
+0,2,3,143,5,167,0,2,3,144,0,2,0,6,0,12,3,253,0,2,3,142,5,158,0,2,3,143,0,
+1,0,19,0,15,0,36,0,67,0,83,0,89,0,106,0,124,0,154,0,173,0,222,1,245,2,41,
+2,198,2,206,2,219,3,203,3,212,5,164,5,168,0,1,0,0,0,1,0,8,0,2,0,250,0,122,
+0,78,0,56,0,32,1,147,0,186,0,181,0,54,0,148,0,13,0,84,0,24,0,4,0,41,1,84,
+0,150,1,156,0,140,0,146,0,153,0,161,0,171,0,191,0,58,3,131,0,6,0,66,1,86,
+0,65,0,212,0,214,0,166,0,228,0,234,0,240,0,242,0,249,1,24,1,62,1,70,1,74,
+1,78,1,90,0,149,1,152,1,61,1,193,1,248,0,207,0,180,2,46,2,50,2,54,2,102,5,
+38,2,146,2,150,2,166,2,181,2,186,2,191,2,228,2,197,2,199,2,211,2,218,2,222,
+2,229,2,249,3,15,3,36,3,71,3,74,3,83,3,88,3,92,3,96,3,124,3,135,3,141,3,197,
+3,201,3,208,3,213,3,239,3,243,3,247,4,45,4,42,4,54,4,105,4,109,4,113,4,119,
+4,123,4,151,4,155,4,159,4,164,4,167,5,74,4,177,4,179,4,183,4,187,4,192,4,
+196,4,200,4,204,4,208,4,212,4,244,4,248,4,252,5,0,5,4,5,8,5,33,5,37,5,44,
+5,159,5,163,5,169,0,1,0,122,0,11,0,15,0,29,0,34,0,36,0,39,0,52,0,67,0,76,
+0,82,0,83,0,89,0,106,0,124,0,131,0,134,0,139,0,145,0,154,0,158,0,162,0,165,
+0,169,0,172,0,173,0,184,0,189,0,198,0,213,0,218,0,221,0,222,0,230,0,235,0,
+241,0,246,1,23,1,57,1,67,1,71,1,75,1,88,1,109,1,149,1,157,1,192,1,245,2,41,
+2,44,2,45,2,47,2,51,2,100,2,123,2,145,2,147,2,163,2,179,2,183,2,187,2,188,
+2,194,2,198,2,206,2,215,2,219,2,230,2,245,3,10,3,34,3,68,3,76,3,79,3,87,3,
+89,3,93,3,117,3,132,3,138,3,194,3,198,3,203,3,212,3,236,3,240,3,244,4,38,
+4,39,4,46,4,102,4,106,4,114,4,116,4,120,4,148,4,152,4,156,4,160,4,166,4,170,
+4,172,4,174,4,180,4,184,4,189,4,193,4,197,4,201,4,205,4,209,4,241,4,245,4,
+249,4,253,5,1,5,5,5,30,5,34,5,41,5,156,5,164,5,168,0,4,0,0,0,1,0,8,0,1,2,
+38,0,34,0,74,0,100,0,110,0,120,0,138,0,164,0,174,0,192,0,202,0,212,0,222,
+0,232,0,242,0,252,1,14,1,24,1,34,1,44,1,54,1,88,1,98,1,108,1,126,1,144,1,
+154,1,164,1,182,1,192,1,202,1,228,1,254,2,8,2,18,2,28,0,3,0,8,0,14,0,20,3,
+178,0,2,3,142,0,55,0,2,3,143,1,91,0,2,3,144,0,1,0,4,1,146,0,2,3,142,0,1,0,
+4,3,190,0,2,3,142,0,2,0,6,0,12,0,60,0,2,3,142,0,61,0,2,3,143,0,3,0,8,0,14,
+0,20,3,184,0,2,3,142,3,185,0,2,3,143,1,101,0,2,3,144,0,1,0,4,2,43,0,2,3,142,
+0,2,0,6,0,12,1,154,0,2,3,142,1,155,0,2,3,143,0,1,0,4,0,10,0,2,3,142,0,1,0,
+4,0,183,0,2,3,142,0,1,0,4,0,176,0,2,3,142,0,1,0,4,0,211,0,2,3,142,0,1,0,4,
+0,215,0,2,3,142,0,1,0,4,0,219,0,2,3,142,0,2,0,6,0,12,0,226,0,2,3,142,0,227,
+0,2,3,143,0,1,0,4,0,233,0,2,3,142,0,1,0,4,0,239,0,2,3,142,0,1,0,4,2,106,0,
+2,3,142,0,1,0,4,1,151,0,2,3,142,0,4,0,10,0,16,0,22,0,28,3,170,0,2,3,142,3,
+173,0,2,3,143,3,172,0,2,3,144,3,169,0,2,4,110,0,1,0,4,5,28,0,2,3,142,0,1,
+0,4,2,202,0,2,3,142,0,2,0,6,0,12,2,208,0,2,3,142,2,210,0,2,3,143,0,2,0,6,
+0,12,2,223,0,2,3,142,2,227,0,2,3,143,0,1,0,4,2,244,0,2,3,142,0,1,0,4,3,16,
+0,2,3,142,0,2,0,6,0,12,3,72,0,2,3,142,3,73,0,2,3,143,0,1,0,4,3,84,0,2,3,142,
+0,1,0,4,3,137,0,2,3,142,0,3,0,8,0,14,0,20,3,206,0,2,3,142,3,207,0,2,3,143,
+5,9,0,2,3,144,0,3,0,8,0,14,0,20,3,215,0,2,3,142,5,69,0,2,3,143,5,70,0,2,3,
+144,0,1,0,4,5,40,0,2,3,142,0,1,0,4,4,165,0,2,3,142,0,1,0,4,5,47,0,2,3,142,
+0,1,0,4,5,160,0,2,3,142,0,1,0,34,0,15,0,34,0,36,0,89,0,106,0,131,0,134,0,
+169,0,173,0,198,0,213,0,218,0,221,0,222,0,230,0,235,1,57,1,149,1,245,2,123,
+2,198,2,206,2,219,2,230,3,10,3,76,3,79,3,132,3,203,3,212,3,240,4,160,4,170,
+5,168,0,1,0,0,0,1,0,8,0,2,0,252,0,123,0,193,3,179,0,31,0,33,3,189,0,25,0,
+12,1,92,0,75,0,81,0,40,5,228,0,20,0,64,0,133,0,135,0,142,0,143,0,151,0,160,
+1,64,0,163,0,9,3,130,0,5,3,175,3,177,0,175,0,156,0,210,0,167,0,225,0,232,
+0,238,0,244,0,248,1,22,1,59,1,69,1,73,1,77,0,93,1,111,0,101,1,158,1,195,3,
+171,0,126,0,86,0,88,2,49,2,53,2,101,2,126,2,144,2,149,2,165,2,180,2,185,2,
+190,1,80,2,195,2,201,2,209,2,217,2,221,1,83,2,248,3,14,3,35,3,69,3,78,3,82,
+3,86,3,91,3,95,3,123,3,133,3,140,3,196,3,200,3,205,3,214,3,238,3,242,3,246,
+4,43,4,40,4,53,4,104,4,107,4,112,4,117,4,121,4,150,4,154,4,158,4,163,4,168,
+5,45,4,176,4,178,4,182,4,186,4,190,4,195,4,199,4,202,4,206,4,211,4,243,4,
+247,4,250,4,255,5,3,5,7,5,32,5,35,5,43,5,225,5,155,3,252,5,172,0,1,0,123,
+0,11,0,15,0,29,0,34,0,36,0,39,0,52,0,67,0,76,0,82,0,83,0,89,0,106,0,124,0,
+131,0,134,0,139,0,145,0,154,0,158,0,162,0,165,0,169,0,172,0,173,0,184,0,189,
+0,198,0,213,0,218,0,221,0,222,0,230,0,235,0,241,0,246,1,23,1,57,1,67,1,71,
+1,75,1,88,1,109,1,149,1,157,1,192,1,245,2,41,2,44,2,45,2,47,2,51,2,100,2,
+123,2,145,2,147,2,163,2,179,2,183,2,187,2,188,2,194,2,198,2,206,2,215,2,219,
+2,230,2,245,3,10,3,34,3,68,3,76,3,79,3,87,3,89,3,93,3,117,3,132,3,138,3,194,
+3,198,3,203,3,212,3,236,3,240,3,244,4,38,4,39,4,46,4,102,4,106,4,114,4,116,
+4,120,4,148,4,152,4,156,4,160,4,166,4,170,4,172,4,174,4,180,4,184,4,189,4,
+193,4,197,4,201,4,205,4,209,4,241,4,245,4,249,4,253,5,1,5,5,5,30,5,34,5,41,
+5,48,5,156,5,168,5,171,0,4,0,0,0,1,0,8,0,1,1,2,0,19,0,44,0,62,0,72,0,82,0,
+100,0,110,0,120,0,130,0,140,0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,228,
+0,238,0,248,0,2,0,6,0,12,0,17,0,2,3,142,1,91,0,2,3,143,0,1,0,4,0,37,0,2,3,
+142,0,1,0,4,0,7,0,2,3,142,0,2,0,6,0,12,3,182,0,2,3,142,3,183,0,2,3,143,0,
+1,0,4,0,63,0,2,3,142,0,1,0,4,2,42,0,2,3,142,0,1,0,4,1,153,0,2,3,142,0,1,0,
+4,2,105,0,2,3,142,0,2,0,6,0,12,1,247,0,2,3,142,2,104,0,2,3,143,0,1,0,4,2,
+125,0,2,3,142,0,1,0,4,2,239,0,2,3,142,0,1,0,4,2,247,0,2,3,142,0,1,0,4,3,75,
+0,2,3,142,0,1,0,4,3,80,0,2,3,142,0,1,0,4,3,136,0,2,3,142,0,1,0,4,3,216,0,
+2,3,142,0,1,0,4,5,39,0,2,3,142,0,1,0,4,4,162,0,2,3,142,0,1,0,4,5,46,0,2,3,
+142,0,1,0,19,0,15,0,36,0,89,0,106,0,124,0,131,0,134,1,57,1,245,2,123,2,230,
+2,245,3,76,3,79,3,132,3,212,3,240,4,160,4,170,0,1,0,0,0,1,0,8,0,2,0,250,0,
+122,0,206,0,16,0,30,0,35,0,38,0,26,0,53,0,209,0,74,0,80,0,43,0,91,0,79,0,
+62,0,132,0,102,0,141,0,144,0,152,0,159,1,63,0,164,0,59,3,129,0,182,0,177,
+0,179,0,174,0,216,0,217,0,220,0,224,0,231,0,237,0,243,0,247,0,168,1,58,1,
+68,1,72,1,76,1,89,1,110,1,150,1,60,1,194,1,246,0,125,0,197,0,87,2,48,2,52,
+0,100,2,124,4,188,2,148,2,164,2,182,2,184,2,189,1,79,2,196,2,203,2,207,2,
+216,2,220,1,82,2,246,3,11,3,33,3,70,3,77,3,81,3,85,3,90,3,94,3,118,3,134,
+3,139,3,195,3,199,3,204,3,217,3,237,3,241,3,245,4,44,4,41,4,47,4,103,4,108,
+4,115,4,118,4,122,4,149,4,153,4,157,4,161,4,169,4,171,4,173,4,175,4,181,4,
+185,4,191,4,194,4,198,4,203,4,207,4,210,4,242,4,246,4,251,4,254,5,2,5,6,5,
+31,5,36,5,42,5,224,5,157,5,161,0,1,0,122,0,11,0,15,0,29,0,34,0,36,0,39,0,
+52,0,67,0,76,0,82,0,83,0,89,0,106,0,124,0,131,0,134,0,139,0,145,0,154,0,158,
+0,162,0,165,0,169,0,172,0,173,0,184,0,189,0,198,0,213,0,218,0,221,0,222,0,
+230,0,235,0,241,0,246,1,23,1,57,1,67,1,71,1,75,1,88,1,109,1,149,1,157,1,192,
+1,245,2,41,2,44,2,45,2,47,2,51,2,100,2,123,2,145,2,147,2,163,2,179,2,183,
+2,187,2,188,2,194,2,198,2,206,2,215,2,219,2,230,2,245,3,10,3,34,3,68,3,76,
+3,79,3,87,3,89,3,93,3,117,3,132,3,138,3,194,3,198,3,203,3,212,3,236,3,240,
+3,244,4,38,4,39,4,46,4,102,4,106,4,114,4,116,4,120,4,148,4,152,4,156,4,160,
+4,166,4,170,4,172,4,174,4,180,4,184,4,189,4,193,4,197,4,201,4,205,4,209,4,
+241,4,245,4,249,4,253,5,1,5,5,5,30,5,34,5,41,5,48,5,156,5,168,0,6,0,0,0,1,
+0,8,0,1,0,50,0,22,0,98,0,136,0,174,1,136,1,154,1,172,1,246,2,26,2,46,2,120,
+2,138,2,228,3,82,3,192,3,210,3,228,3,246,4,8,4,46,4,172,5,42,5,60,0,1,0,22,
+0,16,0,36,0,38,0,56,0,57,0,59,0,89,0,91,0,102,0,124,0,169,0,174,0,179,1,149,
+1,152,1,248,2,41,2,124,3,167,3,168,3,192,3,202,0,2,0,6,0,22,0,1,5,73,0,1,
+0,1,0,210,0,1,0,0,0,17,0,1,5,73,0,1,0,1,0,214,0,1,0,0,0,17,0,2,0,6,0,22,0,
+1,5,73,0,1,0,1,0,64,0,1,0,0,0,18,0,1,5,73,0,1,0,1,1,84,0,1,0,0,0,18,0,12,
+0,26,0,42,0,58,0,74,0,90,0,106,0,122,0,138,0,154,0,170,0,186,0,202,0,1,5,
+73,0,1,0,1,0,175,0,1,0,0,0,14,0,1,5,73,0,1,0,1,0,65,0,1,0,0,0,14,0,1,5,73,
+0,1,0,1,3,177,0,1,0,0,0,14,0,1,5,73,0,1,0,1,1,86,0,1,0,0,0,14,0,1,5,73,0,
+1,0,1,0,175,0,1,0,0,0,14,0,1,5,73,0,1,0,1,0,65,0,1,0,0,0,14,0,1,5,73,0,1,
+0,1,3,177,0,1,0,0,0,14,0,1,5,73,0,1,0,1,1,86,0,1,0,0,0,14,0,1,5,73,0,1,0,
+1,5,228,0,1,0,0,0,14,0,1,5,73,0,1,0,1,0,4,0,1,0,0,0,14,0,1,5,73,0,1,0,1,0,
+64,0,1,0,0,0,18,0,1,5,73,0,1,0,1,1,84,0,1,0,0,0,18,0,1,0,4,0,0,0,1,0,1,3,
+145,0,1,0,0,0,16,0,1,0,4,0,0,0,1,0,1,3,145,0,1,0,0,0,20,0,4,0,10,0,26,0,42,
+0,58,0,1,5,73,0,1,0,1,0,135,0,1,0,0,0,18,0,1,5,73,0,1,0,1,1,156,0,1,0,0,0,
+18,0,1,5,73,0,1,0,1,0,9,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,58,0,1,0,0,0,18,0,
+2,0,6,0,22,0,1,5,73,0,1,0,1,0,181,0,1,0,0,0,14,0,1,3,145,0,1,0,0,0,1,0,0,
+0,15,0,1,0,4,0,1,5,73,0,1,0,1,0,25,0,1,0,0,0,14,0,4,0,10,0,26,0,42,0,58,0,
+1,5,73,0,1,0,1,0,9,0,1,0,0,0,14,0,1,5,73,0,1,0,1,0,58,0,1,0,0,0,14,0,1,5,
+73,0,1,0,1,0,9,0,1,0,0,0,14,0,1,5,73,0,1,0,1,0,58,0,1,0,0,0,14,0,1,0,4,0,
+1,3,145,0,1,0,0,0,1,0,0,0,15,0,5,0,12,0,28,0,44,0,58,0,74,0,1,5,73,0,1,0,
+1,0,135,0,1,0,0,0,18,0,1,5,73,0,1,0,1,1,156,0,1,0,0,0,18,0,1,5,73,0,1,0,0,
+0,1,0,0,0,20,0,1,5,73,0,1,0,1,0,9,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,58,0,1,
+0,0,0,18,0,6,0,14,0,30,0,46,0,62,0,78,0,94,0,1,5,73,0,1,0,1,3,189,0,1,0,0,
+0,18,0,1,5,73,0,1,0,1,0,186,0,1,0,0,0,18,0,1,5,73,0,1,0,1,3,179,0,1,0,0,0,
+18,0,1,5,73,0,1,0,1,0,56,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,175,0,1,0,0,0,18,
+0,1,5,73,0,1,0,1,0,65,0,1,0,0,0,18,0,6,0,14,0,30,0,46,0,62,0,78,0,94,0,1,
+5,73,0,1,0,1,3,189,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,186,0,1,0,0,0,18,0,1,5,
+73,0,1,0,1,3,179,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,56,0,1,0,0,0,18,0,1,5,73,
+0,1,0,1,3,177,0,1,0,0,0,18,0,1,5,73,0,1,0,1,1,86,0,1,0,0,0,18,0,1,0,4,0,0,
+0,1,0,1,3,145,0,1,0,0,0,15,0,1,0,4,0,0,0,1,0,1,3,145,0,1,0,0,0,15,0,1,0,4,
+0,0,0,1,0,1,3,145,0,1,0,0,0,17,0,1,0,4,0,0,0,1,0,1,3,145,0,1,0,0,0,15,0,2,
+0,6,0,22,0,1,5,73,0,1,0,1,0,210,0,1,0,0,0,19,0,1,5,73,0,1,0,1,0,214,0,1,0,
+0,0,19,0,7,0,16,0,30,0,46,0,62,0,78,0,94,0,110,0,1,5,73,0,1,0,0,0,1,0,0,0,
+20,0,1,5,73,0,1,0,1,3,189,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,186,0,1,0,0,0,18,
+0,1,5,73,0,1,0,1,3,179,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,56,0,1,0,0,0,18,0,
+1,5,73,0,1,0,1,0,175,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,65,0,1,0,0,0,18,0,7,
+0,16,0,30,0,46,0,62,0,78,0,94,0,110,0,1,5,73,0,1,0,0,0,1,0,0,0,20,0,1,5,73,
+0,1,0,1,3,189,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,186,0,1,0,0,0,18,0,1,5,73,0,
+1,0,1,3,179,0,1,0,0,0,18,0,1,5,73,0,1,0,1,0,56,0,1,0,0,0,18,0,1,5,73,0,1,
+0,1,3,177,0,1,0,0,0,18,0,1,5,73,0,1,0,1,1,86,0,1,0,0,0,18,0,1,0,4,0,1,5,73,
+0,1,0,0,0,1,0,0,0,20,0,1,0,4,0,1,5,73,0,1,0,0,0,1,0,0,0,20,0,6,0,0,0,1,0,
+8,0,2,0,18,0,0,0,38,0,90,0,3,0,0,1,102,0,0,0,1,0,8,0,5,0,9,0,59,0,91,0,174,
+0,175,0,182,5,228,0,2,0,8,0,5,0,5,0,1,0,9,0,9,0,1,0,59,0,59,0,1,0,91,0,91,
+0,1,0,174,0,175,0,1,0,182,0,182,0,1,3,171,3,171,0,2,5,228,5,228,0,1,0,2,0,
+44,0,12,0,13,0,1,0,20,0,20,0,1,0,24,0,25,0,1,0,31,0,33,0,1,0,40,0,42,0,1,
+0,54,0,57,0,1,0,75,0,75,0,1,0,78,0,78,0,1,0,81,0,81,0,1,0,84,0,86,0,1,0,88,
+0,88,0,1,0,101,0,101,0,1,0,126,0,126,0,1,0,133,0,133,0,1,0,135,0,135,0,1,
+0,140,0,140,0,1,0,142,0,143,0,1,0,146,0,150,0,1,0,180,0,181,0,1,0,186,0,186,
+0,1,0,193,0,193,0,1,0,196,0,196,0,1,0,200,0,200,0,1,0,207,0,207,0,1,1,61,
+1,61,0,1,1,91,1,93,0,1,1,101,1,101,0,1,1,111,1,111,0,1,1,146,1,147,0,1,1,
+151,1,152,0,1,1,154,1,156,0,1,1,158,1,158,0,1,1,193,1,193,0,1,1,195,1,195,
+0,1,1,248,1,248,0,1,2,43,2,43,0,1,2,46,2,46,0,1,2,49,2,50,0,1,2,53,2,54,0,
+1,2,101,2,102,0,1,3,169,3,173,0,1,3,178,3,179,0,1,3,185,3,185,0,1,3,188,3,
+190,0,1,0,1,0,4,0,0,0,2,0,2,0,1,0,1,0,1,0,1,0,14,0,6,0,0,0,1,0,8,0,2,0,34,
+0,148,1,184,2,226,0,11,0,0,4,66,4,120,4,158,4,176,4,196,4,234,5,152,0,0,5,
+172,5,210,0,1,0,55,0,9,0,12,0,20,0,25,0,31,0,33,0,40,0,55,0,59,0,62,0,64,
+0,75,0,79,0,81,0,86,0,88,0,93,0,101,0,126,0,133,0,135,0,142,0,143,0,177,0,
+179,0,193,1,89,1,91,1,92,1,101,1,111,1,146,1,151,1,154,1,155,1,158,1,195,
+1,246,1,248,2,43,2,49,2,53,2,101,3,169,3,170,3,171,3,172,3,173,3,175,3,177,
+3,178,3,179,3,185,3,189,3,190,0,2,0,48,0,5,0,5,0,1,0,9,0,9,0,5,0,12,0,12,
+0,3,0,20,0,20,0,3,0,25,0,25,0,3,0,31,0,31,0,3,0,33,0,33,0,3,0,40,0,40,0,3,
+0,55,0,55,0,3,0,59,0,59,0,5,0,62,0,62,0,4,0,64,0,64,0,4,0,75,0,75,0,3,0,81,
+0,81,0,3,0,86,0,86,0,3,0,88,0,88,0,3,0,91,0,91,0,1,0,93,0,93,0,4,0,101,0,
+101,0,3,0,126,0,126,0,3,0,133,0,133,0,3,0,135,0,135,0,3,0,142,0,143,0,3,0,
+174,0,175,0,1,0,177,0,177,0,4,0,179,0,179,0,4,0,182,0,182,0,1,0,193,0,193,
+0,3,1,89,1,89,0,4,1,91,1,92,0,3,1,101,1,101,0,3,1,111,1,111,0,3,1,146,1,146,
+0,3,1,151,1,151,0,3,1,154,1,155,0,3,1,158,1,158,0,3,1,195,1,195,0,3,2,43,
+2,43,0,3,2,49,2,49,0,3,2,53,2,53,0,3,2,101,2,101,0,3,3,169,3,173,0,3,3,175,
+3,175,0,4,3,177,3,177,0,4,3,178,3,179,0,3,3,185,3,185,0,3,3,189,3,190,0,3,
+5,228,5,228,0,1,0,2,0,49,0,9,0,9,0,6,0,12,0,12,0,9,0,20,0,20,0,5,0,25,0,25,
+0,9,0,31,0,31,0,9,0,33,0,33,0,9,0,40,0,40,0,9,0,55,0,55,0,1,0,59,0,59,0,6,
+0,62,0,62,0,7,0,64,0,64,0,7,0,75,0,75,0,9,0,79,0,79,0,4,0,81,0,81,0,9,0,86,
+0,86,0,9,0,88,0,88,0,9,0,93,0,93,0,7,0,101,0,101,0,9,0,126,0,126,0,9,0,133,
+0,133,0,9,0,135,0,135,0,9,0,142,0,143,0,9,0,177,0,177,0,7,0,179,0,179,0,7,
+0,193,0,193,0,9,1,89,1,89,0,7,1,91,1,91,0,1,1,92,1,92,0,9,1,101,1,101,0,5,
+1,111,1,111,0,9,1,146,1,146,0,9,1,151,1,151,0,9,1,154,1,155,0,9,1,158,1,158,
+0,9,1,195,1,195,0,9,1,246,1,246,0,10,1,248,1,248,0,3,2,43,2,43,0,9,2,49,2,
+49,0,9,2,53,2,53,0,9,2,101,2,101,0,9,3,169,3,170,0,3,3,171,3,171,0,2,3,172,
+3,173,0,3,3,175,3,175,0,7,3,177,3,177,0,7,3,178,3,179,0,1,3,185,3,185,0,5,
+3,189,3,190,0,1,0,2,0,58,0,4,0,6,0,2,0,9,0,9,0,4,0,12,0,13,0,1,0,20,0,20,
+0,1,0,24,0,25,0,1,0,31,0,33,0,1,0,40,0,42,0,1,0,54,0,57,0,1,0,58,0,58,0,4,
+0,64,0,64,0,3,0,65,0,65,0,2,0,66,0,66,0,3,0,75,0,75,0,1,0,78,0,78,0,1,0,81,
+0,81,0,1,0,84,0,86,0,1,0,88,0,88,0,1,0,93,0,93,0,3,0,101,0,101,0,1,0,126,
+0,126,0,1,0,133,0,133,0,1,0,135,0,135,0,1,0,140,0,140,0,1,0,142,0,143,0,1,
+0,146,0,150,0,1,0,175,0,175,0,2,0,180,0,181,0,1,0,186,0,186,0,1,0,193,0,193,
+0,1,0,196,0,196,0,1,0,200,0,200,0,1,0,207,0,207,0,1,1,61,1,61,0,1,1,84,1,
+84,0,3,1,86,1,86,0,3,1,90,1,90,0,3,1,91,1,93,0,1,1,101,1,101,0,1,1,111,1,
+111,0,1,1,146,1,147,0,1,1,151,1,152,0,1,1,154,1,156,0,1,1,158,1,158,0,1,1,
+193,1,193,0,1,1,195,1,195,0,1,1,248,1,248,0,1,2,43,2,43,0,1,2,46,2,46,0,1,
+2,49,2,50,0,1,2,53,2,54,0,1,2,101,2,102,0,1,3,169,3,173,0,1,3,175,3,175,0,
+3,3,177,3,177,0,3,3,178,3,179,0,1,3,185,3,185,0,1,3,188,3,190,0,1,5,228,5,
+228,0,2,0,3,0,8,0,22,0,38,0,0,0,1,0,1,0,1,0,1,0,0,0,14,0,1,0,4,0,2,0,3,0,
+0,0,1,0,1,0,16,0,1,0,5,0,2,0,3,0,0,0,1,0,1,0,16,0,2,0,6,0,22,0,1,0,4,0,2,
+0,3,0,0,0,1,0,1,0,16,0,1,0,5,0,2,0,3,0,0,0,1,0,1,0,16,0,1,0,4,0,1,0,4,0,1,
+0,0,0,1,0,0,0,16,0,1,0,4,0,0,0,2,0,5,0,1,0,4,0,1,0,0,0,14,0,2,0,6,0,22,0,
+1,0,4,0,2,0,3,0,0,0,1,0,1,0,16,0,1,0,5,0,2,0,3,0,0,0,1,0,1,0,16,0,8,0,18,
+0,36,0,54,0,72,0,90,0,110,0,130,0,152,0,0,0,2,0,3,0,2,0,1,0,3,0,1,0,1,0,16,
+0,0,0,2,0,3,0,2,0,1,0,4,0,1,0,1,0,16,0,2,0,3,0,4,0,2,0,3,0,0,0,1,0,1,0,16,
+0,2,0,3,0,5,0,2,0,3,0,0,0,1,0,1,0,16,0,3,0,3,0,3,0,4,0,2,0,3,0,0,0,1,0,1,
+0,16,0,3,0,3,0,3,0,5,0,2,0,3,0,0,0,1,0,1,0,16,0,4,0,3,0,3,0,3,0,4,0,2,0,3,
+0,0,0,1,0,1,0,16,0,4,0,3,0,3,0,3,0,5,0,2,0,3,0,0,0,1,0,1,0,16,0,1,0,4,0,0,
+0,2,0,2,0,1,0,1,0,1,0,1,0,16,0,2,0,6,0,22,0,1,0,4,0,2,0,3,0,0,0,1,0,1,0,16,
+0,1,0,5,0,2,0,3,0,0,0,1,0,1,0,16,0,4,0,10,0,26,0,42,0,58,0,0,0,2,0,9,0,1,
+0,3,0,1,0,0,0,19,0,0,0,2,0,1,0,1,0,3,0,1,0,0,0,19,0,0,0,2,0,2,0,1,0,3,0,1,
+0,0,0,19,0,0,0,2,0,5,0,1,0,3,0,1,0,0,0,19,0,6,0,0,0,1,0,8,0,2,0,18,0,52,0,
+62,0,0,0,3,0,0,0,156,0,174,0,1,0,15,0,5,0,9,0,156,0,167,0,175,0,210,0,225,
+0,232,0,238,2,209,2,221,3,175,3,177,3,205,5,228,0,2,0,1,5,206,5,208,0,1,0,
+2,0,15,0,5,0,5,0,1,0,9,0,9,0,1,0,156,0,156,0,1,0,167,0,167,0,1,0,175,0,175,
+0,1,0,210,0,210,0,1,0,225,0,225,0,1,0,232,0,232,0,1,0,238,0,238,0,1,2,209,
+2,209,0,1,2,221,2,221,0,2,3,175,3,175,0,1,3,177,3,177,0,1,3,205,3,205,0,1,
+5,228,5,228,0,1,0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,14,0,1,0,4,0,1,0,1,0,1,
+0,0,0,1,0,0,0,16,0,6,0,0,0,1,0,8,0,2,0,18,0,28,2,168,0,0,0,3,0,0,2,182,2,
+232,0,2,0,1,3,174,3,177,0,0,0,2,0,108,0,16,0,16,0,1,0,20,0,20,0,4,0,26,0,
+26,0,1,0,30,0,30,0,1,0,35,0,35,0,1,0,38,0,38,0,1,0,43,0,43,0,1,0,53,0,53,
+0,1,0,74,0,74,0,1,0,79,0,79,0,2,0,80,0,80,0,1,0,87,0,87,0,1,0,100,0,100,0,
+1,0,102,0,102,0,1,0,125,0,125,0,1,0,132,0,132,0,1,0,133,0,133,0,3,0,141,0,
+141,0,1,0,144,0,144,0,1,0,159,0,159,0,1,0,164,0,164,0,1,0,168,0,168,0,1,0,
+197,0,197,0,1,0,206,0,206,0,1,0,209,0,209,0,1,0,243,0,243,0,1,0,247,0,247,
+0,1,1,58,1,58,0,1,1,60,1,60,0,1,1,63,1,63,0,1,1,68,1,68,0,1,1,72,1,72,0,1,
+1,79,1,79,0,1,1,82,1,82,0,1,1,110,1,110,0,1,1,111,1,111,0,3,1,150,1,150,0,
+1,1,158,1,158,0,3,1,194,1,194,0,1,1,195,1,195,0,3,1,246,1,246,0,2,2,48,2,
+48,0,1,2,52,2,52,0,1,2,124,2,124,0,1,2,148,2,148,0,1,2,164,2,164,0,1,2,182,
+2,182,0,1,2,184,2,184,0,1,2,189,2,189,0,1,2,196,2,196,0,1,2,246,2,246,0,1,
+3,11,3,11,0,1,3,33,3,33,0,1,3,70,3,70,0,1,3,77,3,77,0,1,3,81,3,81,0,1,3,85,
+3,85,0,1,3,90,3,90,0,1,3,94,3,94,0,1,3,118,3,118,0,1,3,129,3,129,0,1,3,134,
+3,134,0,1,3,139,3,139,0,1,3,171,3,171,0,4,3,195,3,195,0,1,3,199,3,199,0,1,
+3,217,3,217,0,1,3,237,3,237,0,1,3,241,3,241,0,1,3,245,3,245,0,1,4,44,4,44,
+0,1,4,47,4,47,0,1,4,53,4,53,0,3,4,103,4,103,0,1,4,108,4,108,0,1,4,115,4,115,
+0,1,4,118,4,118,0,1,4,122,4,122,0,1,4,149,4,149,0,1,4,153,4,153,0,1,4,157,
+4,157,0,1,4,161,4,161,0,1,4,169,4,169,0,1,4,171,4,171,0,1,4,173,4,173,0,1,
+4,175,4,175,0,1,4,181,4,181,0,1,4,185,4,185,0,1,4,188,4,188,0,1,4,191,4,191,
+0,1,4,194,4,194,0,1,4,198,4,198,0,1,4,202,4,202,0,3,4,203,4,203,0,1,4,207,
+4,207,0,1,4,210,4,210,0,1,4,211,4,211,0,3,4,242,4,242,0,1,4,246,4,246,0,1,
+4,251,4,251,0,1,4,254,4,254,0,1,5,2,5,2,0,1,5,6,5,6,0,1,5,31,5,31,0,1,5,36,
+5,36,0,1,5,42,5,42,0,1,5,157,5,157,0,1,5,224,5,224,0,1,0,1,3,174,0,4,0,2,
+0,1,0,2,0,1,0,3,0,8,0,22,0,36,0,1,0,1,0,1,0,0,0,1,0,0,0,14,0,1,0,2,0,1,0,
+0,0,1,0,0,0,14,0,1,0,4,0,1,0,0,0,1,0,0,0,16,0,1,0,4,0,1,0,4,0,1,0,0,0,1,0,
+0,0,16,0,1,0,0,0,1,0,8,0,2,0,52,0,23,0,183,0,10,3,184,0,37,3,182,0,90,0,7,
+1,153,0,211,0,219,0,176,0,215,0,226,0,233,0,239,2,208,3,170,3,174,3,176,3,
+178,3,190,3,206,0,60,0,1,0,23,0,5,0,9,0,20,0,38,0,79,0,89,0,91,0,102,0,156,
+0,167,0,175,0,210,0,225,0,232,0,238,2,209,3,171,3,175,3,177,3,179,3,189,3,
+205,5,228,0,1,0,0,0,1,0,8,0,2,0,16,0,5,3,165,3,166,1,151,1,151,0,147,0,1,
+0,5,0,89,0,124,1,149,1,152,2,41,0,1,0,0,0,1,0,8,0,2,0,20,0,7,0,55,3,188,2,
+227,3,173,3,173,0,178,1,85,0,1,0,7,0,56,1,248,2,221,3,170,3,171,3,174,3,176,
+0,1,0,0,0,1,0,8,0,2,0,10,0,2,1,91,3,172,0,1,0,2,0,16,1,248,0,1,0,0,0,1,0,
+8,0,2,0,22,0,8,3,189,3,189,0,9,0,9,0,175,3,177,0,175,3,177,0,1,0,8,0,36,0,
+38,0,59,0,169,0,174,0,179,3,167,3,168,0,1,0,0,0,1,0,8,0,2,0,12,0,3,0,107,
+2,103,2,125,0,1,0,3,0,79,1,246,2,124,0,1,0,0,0,1,0,8,0,2,0,18,0,6,0,56,0,
+58,0,65,1,86,2,211,3,208,0,1,0,6,0,57,0,169,3,167,3,168,3,192,3,202,0,4,0,
+0,0,1,0,8,0,1,27,54,0,63,0,132,1,94,1,104,2,66,3,68,4,86,4,216,4,234,4,252,
+6,110,6,120,6,242,7,108,7,238,8,48,8,114,9,48,9,66,9,76,9,126,9,176,11,50,
+11,236,12,166,13,112,14,50,14,236,15,158,15,224,16,34,16,108,16,158,16,208,
+17,2,17,52,17,118,17,184,17,250,18,60,18,190,19,64,19,146,19,228,20,6,20,
+40,20,106,21,68,21,78,21,152,21,162,21,228,22,38,22,48,22,58,22,124,23,78,
+24,32,24,130,24,228,25,86,25,200,26,122,27,44,0,24,0,50,0,56,0,62,0,68,0,
+76,0,84,0,92,0,98,0,104,0,110,0,118,0,126,0,134,0,140,0,146,0,154,0,162,0,
+170,0,176,0,184,0,192,0,200,0,206,0,212,0,23,0,2,0,9,0,205,0,2,0,58,0,103,
+0,2,0,64,5,213,0,3,0,66,3,142,1,228,0,3,0,66,3,143,1,229,0,3,0,66,3,144,0,
+104,0,2,0,66,0,117,0,2,0,93,1,140,0,2,1,84,1,238,0,3,1,86,3,142,1,239,0,3,
+1,86,3,143,1,240,0,3,1,86,3,144,1,237,0,2,1,86,1,243,0,2,1,90,5,212,0,3,3,
+175,3,142,5,211,0,3,3,175,3,143,1,227,0,3,3,175,3,144,0,115,0,2,3,175,5,218,
+0,3,3,177,3,142,1,235,0,3,3,177,3,143,1,236,0,3,3,177,3,144,1,234,0,2,3,177,
+5,63,0,2,3,252,5,59,0,2,5,169,0,1,0,4,0,199,0,2,0,75,0,24,0,50,0,56,0,62,
+0,68,0,76,0,84,0,92,0,98,0,104,0,110,0,118,0,126,0,134,0,140,0,146,0,154,
+0,162,0,170,0,176,0,184,0,192,0,200,0,206,0,212,0,22,0,2,0,9,1,142,0,2,0,
+58,0,96,0,2,0,64,0,94,0,3,0,66,3,142,5,209,0,3,0,66,3,143,5,210,0,3,0,66,
+3,144,0,190,0,2,0,66,0,116,0,2,0,93,1,138,0,2,1,84,5,215,0,3,1,86,3,142,5,
+214,0,3,1,86,3,143,1,231,0,3,1,86,3,144,1,230,0,2,1,86,1,241,0,2,1,90,0,95,
+0,3,3,174,3,142,1,226,0,3,3,174,3,143,1,225,0,3,3,174,3,144,0,105,0,2,3,174,
+5,216,0,3,3,176,3,142,5,217,0,3,3,176,3,143,1,233,0,3,3,176,3,144,1,232,0,
+2,3,176,5,61,0,2,3,252,5,57,0,2,5,169,0,32,0,66,0,72,0,78,0,84,0,90,0,96,
+0,102,0,108,0,114,0,120,0,126,0,132,0,138,0,144,0,150,0,156,0,162,0,168,0,
+174,0,180,0,186,0,192,0,198,0,204,0,210,0,216,0,222,0,228,0,234,0,240,0,246,
+0,252,2,57,0,2,0,4,2,68,0,2,0,5,2,67,0,2,0,6,2,63,0,2,0,9,2,64,0,2,0,58,2,
+60,0,2,0,64,2,71,0,2,0,65,2,75,0,2,0,66,2,89,0,2,0,93,5,124,0,2,0,156,2,72,
+0,2,0,175,2,76,0,2,0,185,5,119,0,2,0,210,5,123,0,2,0,212,5,120,0,2,0,214,
+5,128,0,2,0,225,5,127,0,2,0,228,2,59,0,2,1,84,2,82,0,2,1,86,2,78,0,2,1,87,
+2,92,0,2,1,90,5,131,0,2,2,199,5,132,0,2,2,201,5,136,0,2,2,221,5,135,0,2,2,
+222,2,85,0,2,3,174,2,87,0,2,3,176,5,140,0,2,3,205,5,139,0,2,3,208,5,143,0,
+2,3,252,5,146,0,2,5,169,2,55,0,2,5,228,0,34,0,70,0,76,0,82,0,88,0,94,0,100,
+0,106,0,112,0,118,0,124,0,130,0,136,0,142,0,148,0,154,0,160,0,166,0,172,0,
+178,0,184,0,190,0,196,0,202,0,208,0,214,0,220,0,226,0,232,0,238,0,244,0,250,
+1,0,1,6,1,12,2,58,0,2,0,4,2,69,0,2,0,5,2,70,0,2,0,6,2,65,0,2,0,9,2,66,0,2,
+0,58,2,61,0,2,0,64,2,74,0,2,0,65,2,81,0,2,0,66,2,90,0,2,0,93,5,125,0,2,0,
+156,2,73,0,2,0,175,2,77,0,2,0,185,5,121,0,2,0,210,5,126,0,2,0,212,5,122,0,
+2,0,214,5,129,0,2,0,225,5,130,0,2,0,228,2,62,0,2,1,84,2,83,0,2,1,86,2,79,
+0,2,1,87,2,91,0,2,1,90,5,134,0,2,2,199,5,133,0,2,2,201,5,137,0,2,2,221,5,
+138,0,2,2,222,2,86,0,2,3,174,2,80,0,2,3,175,2,88,0,2,3,176,2,84,0,2,3,177,
+5,141,0,2,3,205,5,142,0,2,3,208,5,144,0,2,3,252,5,145,0,2,5,169,2,56,0,2,
+5,228,0,16,0,34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,0,
+106,0,112,0,118,0,124,1,40,0,2,0,4,1,26,0,2,0,5,1,25,0,2,0,6,1,34,0,2,0,156,
+1,44,0,2,0,166,1,41,0,2,0,167,1,30,0,2,0,210,1,33,0,2,0,212,1,29,0,2,0,214,
+1,46,0,2,0,225,1,45,0,2,0,228,1,50,0,2,0,232,1,49,0,2,0,234,1,54,0,2,0,238,
+1,53,0,2,0,240,1,37,0,2,5,228,0,2,0,6,0,12,0,195,0,2,0,75,0,194,0,2,0,193,
+0,2,0,6,0,12,5,229,0,2,3,165,5,229,0,2,3,166,0,45,0,92,0,98,0,104,0,110,0,
+116,0,122,0,128,0,134,0,142,0,148,0,154,0,160,0,166,0,172,0,178,0,184,0,190,
+0,196,0,202,0,208,0,214,0,220,0,226,0,232,0,238,0,244,0,250,1,2,1,8,1,14,
+1,20,1,26,1,32,1,38,1,44,1,50,1,56,1,62,1,70,1,76,1,84,1,90,1,96,1,102,1,
+108,1,94,0,2,0,4,0,46,0,2,0,5,0,44,0,2,0,6,0,21,0,2,0,9,0,202,0,2,0,58,1,
+97,0,2,0,64,0,51,0,2,0,65,0,187,0,3,0,66,3,142,0,68,0,2,0,66,0,192,0,2,0,
+75,0,122,0,2,0,93,5,78,0,2,0,156,0,48,0,2,0,175,0,187,0,2,0,185,5,76,0,2,
+0,210,5,77,0,2,0,212,5,75,0,2,0,214,5,84,0,2,0,225,5,83,0,2,0,228,5,88,0,
+2,0,232,5,87,0,2,0,234,5,92,0,2,0,238,5,91,0,2,0,240,5,109,0,2,1,77,5,110,
+0,2,1,78,1,96,0,2,1,84,1,189,0,3,1,86,3,142,0,73,0,2,1,86,1,189,0,2,1,87,
+1,107,0,2,1,90,5,95,0,2,2,199,5,96,0,2,2,201,5,101,0,2,2,209,5,102,0,2,2,
+211,5,104,0,2,2,221,5,103,0,2,2,222,0,70,0,2,3,174,0,70,0,3,3,175,3,142,1,
+102,0,2,3,176,1,102,0,3,3,177,3,142,5,112,0,2,3,205,5,111,0,2,3,208,5,116,
+0,2,3,252,5,115,0,2,5,169,0,92,0,2,5,228,0,1,0,4,0,245,0,2,0,75,0,15,0,32,
+0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,
+0,250,0,2,0,4,0,254,0,2,0,75,1,4,0,2,0,156,1,6,0,2,0,166,1,7,0,2,0,167,1,
+1,0,2,0,210,2,193,0,2,0,212,1,0,0,2,0,214,1,11,0,2,0,225,1,10,0,2,0,228,1,
+15,0,2,0,232,1,14,0,2,0,234,1,19,0,2,0,238,1,18,0,2,0,240,0,251,0,2,5,228,
+0,15,0,32,0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,
+110,0,116,0,253,0,2,0,4,0,255,0,2,0,75,1,5,0,2,0,156,1,9,0,2,0,166,1,8,0,
+2,0,167,1,3,0,2,0,210,2,192,0,2,0,212,1,2,0,2,0,214,1,12,0,2,0,225,1,13,0,
+2,0,228,1,16,0,2,0,232,1,17,0,2,0,234,1,20,0,2,0,238,1,21,0,2,0,240,0,252,
+0,2,5,228,0,16,0,34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,
+0,106,0,112,0,118,0,124,1,39,0,2,0,4,1,27,0,2,0,5,1,28,0,2,0,6,1,35,0,2,0,
+156,1,43,0,2,0,166,1,42,0,2,0,167,1,31,0,2,0,210,1,36,0,2,0,212,1,32,0,2,
+0,214,1,47,0,2,0,225,1,48,0,2,0,228,1,51,0,2,0,232,1,52,0,2,0,234,1,55,0,
+2,0,238,1,56,0,2,0,240,1,38,0,2,5,228,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,
+54,0,60,2,111,0,2,0,156,2,107,0,2,0,210,2,112,0,2,0,212,2,109,0,2,0,214,2,
+116,0,2,0,232,2,115,0,2,0,234,2,120,0,2,0,238,2,119,0,2,0,240,0,8,0,18,0,
+24,0,30,0,36,0,42,0,48,0,54,0,60,2,113,0,2,0,156,2,110,0,2,0,210,2,114,0,
+2,0,212,2,108,0,2,0,214,2,117,0,2,0,232,2,118,0,2,0,234,2,121,0,2,0,238,2,
+122,0,2,0,240,0,23,0,48,0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,98,0,104,0,110,
+0,116,0,122,0,128,0,134,0,142,0,148,0,154,0,160,0,166,0,172,0,178,0,184,1,
+159,0,2,0,4,1,170,0,2,0,5,1,172,0,2,0,6,1,166,0,2,0,9,1,167,0,2,0,58,1,163,
+0,2,0,64,1,174,0,2,0,65,1,184,0,3,0,66,3,142,1,178,0,2,0,66,2,96,0,2,0,93,
+1,175,0,2,0,175,5,20,0,2,0,225,5,21,0,2,0,228,1,162,0,2,1,84,1,186,0,3,1,
+86,3,142,1,180,0,2,1,86,2,98,0,2,1,90,1,188,0,2,3,174,1,188,0,2,3,175,2,94,
+0,2,3,176,5,27,0,2,3,252,5,24,0,2,5,169,0,99,0,2,5,228,0,2,0,6,0,12,1,66,
+0,2,0,75,1,65,0,2,1,64,0,1,0,4,1,81,0,2,0,75,0,6,0,14,0,20,0,26,0,32,0,38,
+0,44,2,231,0,2,2,199,2,232,0,2,2,201,2,238,0,2,2,209,2,237,0,2,2,211,2,241,
+0,2,2,221,2,240,0,2,2,222,0,6,0,14,0,20,0,26,0,32,0,38,0,44,2,234,0,2,2,199,
+2,233,0,2,2,201,2,235,0,2,2,209,2,236,0,2,2,211,2,243,0,2,2,221,2,242,0,2,
+2,222,0,47,0,96,0,102,0,108,0,114,0,120,0,126,0,132,0,138,0,146,0,152,0,158,
+0,164,0,170,0,176,0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,
+236,0,242,0,248,0,254,1,6,1,12,1,18,1,24,1,30,1,36,1,42,1,48,1,54,1,60,1,
+66,1,74,1,80,1,86,1,94,1,100,1,106,1,112,1,118,1,124,1,95,0,2,0,4,0,47,0,
+2,0,5,0,45,0,2,0,6,0,28,0,2,0,9,0,203,0,2,0,58,1,98,0,2,0,64,0,50,0,2,0,65,
+0,72,0,3,0,66,3,142,0,69,0,2,0,66,1,100,0,2,0,75,0,123,0,2,0,93,5,81,0,2,
+0,156,0,49,0,2,0,175,0,72,0,2,0,185,5,79,0,2,0,210,5,82,0,2,0,212,5,80,0,
+2,0,214,5,85,0,2,0,225,5,86,0,2,0,228,5,89,0,2,0,232,5,90,0,2,0,234,5,93,
+0,2,0,238,5,94,0,2,0,240,5,107,0,2,1,77,5,108,0,2,1,78,1,99,0,2,1,84,1,106,
+0,3,1,86,3,142,1,105,0,2,1,86,1,106,0,2,1,87,1,108,0,2,1,90,5,98,0,2,2,199,
+5,97,0,2,2,201,5,99,0,2,2,209,5,100,0,2,2,211,5,105,0,2,2,221,5,106,0,2,2,
+222,0,188,0,2,3,174,0,188,0,3,3,175,3,142,0,71,0,2,3,175,1,104,0,2,3,176,
+1,104,0,3,3,177,3,142,1,103,0,2,3,177,5,113,0,2,3,205,5,114,0,2,3,208,5,117,
+0,2,3,252,5,118,0,2,5,169,0,121,0,2,5,228,0,22,0,46,0,52,0,58,0,64,0,70,0,
+76,0,82,0,88,0,96,0,102,0,108,0,114,0,120,0,128,0,134,0,140,0,146,0,154,0,
+160,0,168,0,174,0,180,1,112,0,2,0,4,0,110,0,2,0,5,0,108,0,2,0,6,0,113,0,2,
+0,9,1,118,0,2,0,58,1,115,0,2,0,64,1,119,0,2,0,65,1,124,0,3,0,66,3,142,1,123,
+0,2,0,66,0,119,0,2,0,93,1,120,0,2,0,175,1,114,0,2,1,84,1,130,0,3,1,86,3,142,
+1,129,0,2,1,86,1,137,0,2,1,90,0,112,0,2,3,174,0,112,0,3,3,175,3,142,1,134,
+0,2,3,176,1,134,0,3,3,177,3,142,5,56,0,2,3,252,5,53,0,2,5,169,0,97,0,2,5,
+228,0,22,0,46,0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,96,0,102,0,108,0,114,0,
+120,0,128,0,134,0,140,0,148,0,154,0,162,0,168,0,174,0,180,1,113,0,2,0,4,0,
+109,0,2,0,5,0,111,0,2,0,6,0,114,0,2,0,9,0,204,0,2,0,58,1,116,0,2,0,64,1,122,
+0,2,0,65,1,128,0,3,0,66,3,142,1,126,0,2,0,66,0,120,0,2,0,93,1,121,0,2,0,175,
+1,117,0,2,1,84,1,131,0,3,1,86,3,142,1,133,0,2,1,86,1,136,0,2,1,90,1,127,0,
+3,3,175,3,142,1,125,0,2,3,175,1,135,0,3,3,177,3,142,1,132,0,2,3,177,5,54,
+0,2,3,252,5,55,0,2,5,169,0,127,0,2,5,228,0,24,0,50,0,56,0,62,0,68,0,74,0,
+80,0,86,0,92,0,100,0,106,0,112,0,118,0,124,0,130,0,136,0,144,0,150,0,156,
+0,164,0,170,0,178,0,184,0,190,0,196,1,161,0,2,0,4,1,171,0,2,0,5,1,173,0,2,
+0,6,1,168,0,2,0,9,1,169,0,2,0,58,1,164,0,2,0,64,1,177,0,2,0,65,1,185,0,3,
+0,66,3,142,1,179,0,2,0,66,2,97,0,2,0,93,1,176,0,2,0,175,5,22,0,2,0,225,5,
+23,0,2,0,228,1,165,0,2,1,84,1,187,0,3,1,86,3,142,1,181,0,2,1,86,2,99,0,2,
+1,90,2,93,0,3,3,175,3,142,1,182,0,2,3,175,2,95,0,3,3,177,3,142,1,183,0,2,
+3,177,5,25,0,2,3,252,5,26,0,2,5,169,1,160,0,2,5,228,0,23,0,48,0,54,0,60,0,
+66,0,72,0,78,0,84,0,90,0,98,0,104,0,110,0,116,0,122,0,130,0,136,0,142,0,148,
+0,156,0,162,0,170,0,176,0,182,0,188,1,191,0,2,0,4,1,204,0,2,0,5,0,98,0,2,
+0,6,0,130,0,2,0,9,1,201,0,2,0,58,1,198,0,2,0,64,1,207,0,2,0,65,1,217,0,3,
+0,66,3,142,1,211,0,2,0,66,5,16,0,2,0,93,1,208,0,2,0,175,1,197,0,2,1,84,1,
+223,0,3,1,86,3,142,1,214,0,2,1,86,5,17,0,2,1,90,1,218,0,2,3,174,1,218,0,3,
+3,175,3,142,1,220,0,2,3,176,1,220,0,3,3,177,3,142,1,220,0,2,3,177,5,13,0,
+2,3,252,5,12,0,2,5,169,0,129,0,2,5,228,0,22,0,46,0,52,0,58,0,64,0,70,0,76,
+0,82,0,88,0,96,0,102,0,108,0,114,0,120,0,128,0,134,0,140,0,148,0,154,0,162,
+0,168,0,174,0,180,1,196,0,2,0,4,1,205,0,2,0,5,1,206,0,2,0,6,1,202,0,2,0,9,
+1,203,0,2,0,58,1,199,0,2,0,64,1,210,0,2,0,65,1,222,0,3,0,66,3,142,1,213,0,
+2,0,66,5,18,0,2,0,93,1,209,0,2,0,175,1,200,0,2,1,84,1,224,0,3,1,86,3,142,
+1,216,0,2,1,86,5,19,0,2,1,90,1,219,0,3,3,175,3,142,1,212,0,2,3,175,1,221,
+0,3,3,177,3,142,1,215,0,2,3,177,5,14,0,2,3,252,5,15,0,2,5,169,1,190,0,2,5,
+228,0,20,0,42,0,48,0,54,0,60,0,68,0,76,0,84,0,90,0,96,0,102,0,110,0,118,0,
+126,0,132,0,138,0,146,0,152,0,160,0,166,0,172,2,3,0,2,0,9,2,1,0,2,0,58,1,
+251,0,2,0,64,5,219,0,3,0,66,3,142,2,10,0,3,0,66,3,143,2,11,0,3,0,66,3,144,
+2,9,0,2,0,66,2,35,0,2,0,93,1,249,0,2,1,84,2,21,0,3,1,86,3,142,2,22,0,3,1,
+86,3,143,2,23,0,3,1,86,3,144,2,20,0,2,1,86,2,33,0,2,1,90,2,13,0,3,3,174,3,
+142,2,12,0,2,3,174,2,25,0,3,3,176,3,142,2,24,0,2,3,176,5,149,0,2,3,252,5,
+147,0,2,5,169,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,2,4,0,2,0,9,2,2,
+0,2,0,58,1,252,0,2,0,64,2,36,0,2,0,93,1,250,0,2,1,84,2,34,0,2,1,90,5,150,
+0,2,3,252,5,148,0,2,5,169,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,2,132,
+0,2,0,156,2,129,0,2,0,210,2,135,0,2,0,212,2,128,0,2,0,214,2,137,0,2,0,232,
+2,136,0,2,0,234,2,141,0,2,0,238,2,140,0,2,0,240,0,9,0,20,0,26,0,32,0,38,0,
+44,0,50,0,56,0,62,0,68,2,127,0,2,0,75,2,133,0,2,0,156,2,130,0,2,0,210,2,134,
+0,2,0,212,2,131,0,2,0,214,2,138,0,2,0,232,2,139,0,2,0,234,2,142,0,2,0,238,
+2,143,0,2,0,240,0,6,0,14,0,20,0,26,0,32,0,38,0,44,2,154,0,2,0,4,2,155,0,2,
+0,166,2,156,0,2,0,167,2,160,0,2,0,225,2,159,0,2,0,228,2,151,0,2,5,228,0,6,
+0,14,0,20,0,26,0,32,0,38,0,44,2,153,0,2,0,4,2,158,0,2,0,166,2,157,0,2,0,167,
+2,162,0,2,0,225,2,161,0,2,0,228,2,152,0,2,5,228,0,6,0,14,0,20,0,26,0,32,0,
+38,0,44,2,170,0,2,0,4,2,171,0,2,0,166,2,172,0,2,0,167,2,176,0,2,0,225,2,175,
+0,2,0,228,2,167,0,2,5,228,0,6,0,14,0,20,0,26,0,32,0,38,0,44,2,169,0,2,0,4,
+2,174,0,2,0,166,2,173,0,2,0,167,2,177,0,2,0,225,2,178,0,2,0,228,2,168,0,2,
+5,228,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,2,250,0,2,2,199,2,251,0,
+2,2,201,2,255,0,2,2,209,2,254,0,2,2,211,3,7,0,2,2,221,3,6,0,2,2,222,3,3,0,
+2,3,205,3,2,0,2,3,208,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,2,253,0,
+2,2,199,2,252,0,2,2,201,3,0,0,2,2,209,3,1,0,2,2,211,3,8,0,2,2,221,3,9,0,2,
+2,222,3,4,0,2,3,205,3,5,0,2,3,208,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,
+0,60,3,17,0,2,2,199,3,18,0,2,2,201,3,22,0,2,2,209,3,21,0,2,2,211,3,26,0,2,
+2,221,3,25,0,2,2,222,3,30,0,2,3,205,3,29,0,2,3,208,0,8,0,18,0,24,0,30,0,36,
+0,42,0,48,0,54,0,60,3,20,0,2,2,199,3,19,0,2,2,201,3,23,0,2,2,209,3,24,0,2,
+2,211,3,27,0,2,2,221,3,28,0,2,2,222,3,31,0,2,3,205,3,32,0,2,3,208,0,16,0,
+34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,0,106,0,112,0,
+118,0,124,3,38,0,2,0,4,3,41,0,2,0,5,0,157,0,2,0,6,3,57,0,2,1,77,3,56,0,2,
+1,78,3,47,0,2,2,199,3,42,0,2,2,201,3,50,0,2,2,209,3,51,0,2,2,211,3,43,0,2,
+2,221,3,44,0,2,2,222,3,61,0,2,3,205,3,60,0,2,3,208,3,65,0,2,3,252,3,64,0,
+2,5,169,3,37,0,2,5,228,0,16,0,34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,0,82,
+0,88,0,94,0,100,0,106,0,112,0,118,0,124,3,39,0,2,0,4,3,45,0,2,0,5,3,46,0,
+2,0,6,3,58,0,2,1,77,3,59,0,2,1,78,3,49,0,2,2,199,3,48,0,2,2,201,3,52,0,2,
+2,209,3,53,0,2,2,211,3,54,0,2,2,221,3,55,0,2,2,222,3,62,0,2,3,205,3,63,0,
+2,3,208,3,66,0,2,3,252,3,67,0,2,5,169,3,40,0,2,5,228,0,10,0,22,0,28,0,34,
+0,40,0,46,0,52,0,58,0,64,0,70,0,76,3,97,0,2,0,4,3,102,0,2,0,5,3,101,0,2,0,
+6,3,105,0,2,2,199,3,106,0,2,2,201,3,110,0,2,2,221,3,109,0,2,2,222,3,114,0,
+2,3,252,3,113,0,2,5,169,3,98,0,2,5,228,0,10,0,22,0,28,0,34,0,40,0,46,0,52,
+0,58,0,64,0,70,0,76,3,100,0,2,0,4,3,103,0,2,0,5,3,104,0,2,0,6,3,108,0,2,2,
+199,3,107,0,2,2,201,3,111,0,2,2,221,3,112,0,2,2,222,3,115,0,2,3,252,3,116,
+0,2,5,169,3,99,0,2,5,228,0,4,0,10,0,16,0,22,0,28,3,119,0,2,0,4,3,122,0,2,
+0,5,3,121,0,2,0,6,3,120,0,2,5,228,0,4,0,10,0,16,0,22,0,28,3,126,0,2,0,4,3,
+127,0,2,0,5,3,128,0,2,0,6,3,125,0,2,5,228,0,8,0,18,0,24,0,30,0,36,0,42,0,
+48,0,54,0,60,2,6,0,2,0,9,2,8,0,2,0,58,1,254,0,2,0,64,2,38,0,2,0,93,2,0,0,
+2,1,84,2,40,0,2,1,90,5,152,0,2,3,252,5,154,0,2,5,169,0,24,0,50,0,56,0,62,
+0,68,0,76,0,84,0,92,0,98,0,104,0,110,0,118,0,126,0,134,0,140,0,146,0,154,
+0,162,0,170,0,176,0,184,0,192,0,200,0,206,0,212,2,5,0,2,0,9,2,7,0,2,0,58,
+1,253,0,2,0,64,5,221,0,3,0,66,3,142,2,18,0,3,0,66,3,143,2,19,0,3,0,66,3,144,
+2,17,0,2,0,66,2,37,0,2,0,93,1,255,0,2,1,84,5,222,0,3,1,86,3,142,2,31,0,3,
+1,86,3,143,2,32,0,3,1,86,3,144,2,30,0,2,1,86,2,39,0,2,1,90,5,220,0,3,3,175,
+3,142,2,15,0,3,3,175,3,143,2,16,0,3,3,175,3,144,2,14,0,2,3,175,2,27,0,3,3,
+177,3,142,2,28,0,3,3,177,3,143,2,29,0,3,3,177,3,144,2,26,0,2,3,177,5,151,
+0,2,3,252,5,153,0,2,5,169,0,1,0,4,0,201,0,2,0,75,0,9,0,20,0,26,0,32,0,38,
+0,44,0,50,0,56,0,62,0,68,1,143,0,2,0,58,0,136,0,2,0,64,0,118,0,2,0,93,1,139,
+0,2,1,84,1,242,0,2,1,90,5,230,0,2,3,165,5,230,0,2,3,166,5,62,0,2,3,252,5,
+58,0,2,5,169,0,1,0,4,3,186,0,2,0,9,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,
+0,60,1,144,0,2,0,9,1,145,0,2,0,58,0,137,0,2,0,64,0,138,0,2,0,93,1,141,0,2,
+1,84,1,244,0,2,1,90,5,64,0,2,3,252,5,60,0,2,5,169,0,8,0,18,0,24,0,30,0,36,
+0,42,0,48,0,54,0,60,3,221,0,2,2,199,3,219,0,2,2,201,3,224,0,2,2,209,3,225,
+0,2,2,211,3,228,0,2,2,221,3,229,0,2,2,222,3,234,0,2,3,205,3,235,0,2,3,208,
+0,1,0,4,3,231,0,2,1,77,0,1,0,4,3,230,0,2,1,77,0,8,0,18,0,24,0,30,0,36,0,42,
+0,48,0,54,0,60,3,218,0,2,2,199,3,220,0,2,2,201,3,223,0,2,2,209,3,222,0,2,
+2,211,3,227,0,2,2,221,3,226,0,2,2,222,3,233,0,2,3,205,3,232,0,2,3,208,0,26,
+0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,96,0,102,0,108,0,114,0,120,0,126,0,132,
+0,138,0,144,0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,204,4,
+49,0,2,0,4,4,59,0,2,0,5,4,58,0,2,0,6,4,48,0,2,0,9,4,55,0,2,0,58,4,86,0,2,
+0,93,4,94,0,2,0,156,4,91,0,2,0,210,4,95,0,2,0,212,4,90,0,2,0,214,4,99,0,2,
+0,225,4,98,0,2,0,228,4,62,0,2,1,86,4,63,0,2,1,87,4,87,0,2,1,90,4,84,0,2,2,
+199,4,85,0,2,2,201,4,71,0,2,2,221,4,70,0,2,2,222,4,68,0,2,3,176,4,64,0,2,
+3,177,4,77,0,2,3,205,4,76,0,2,3,208,4,79,0,2,3,252,4,78,0,2,5,169,4,50,0,
+2,5,228,0,26,0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,96,0,102,0,108,0,114,0,
+120,0,126,0,132,0,138,0,144,0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,
+0,198,0,204,4,52,0,2,0,4,4,60,0,2,0,5,4,61,0,2,0,6,4,57,0,2,0,9,4,56,0,2,
+0,58,4,88,0,2,0,93,4,96,0,2,0,156,4,92,0,2,0,210,4,97,0,2,0,212,4,93,0,2,
+0,214,4,100,0,2,0,225,4,101,0,2,0,228,4,66,0,2,1,86,4,67,0,2,1,87,4,89,0,
+2,1,90,4,83,0,2,2,199,4,82,0,2,2,201,4,72,0,2,2,221,4,73,0,2,2,222,4,69,0,
+2,3,176,4,65,0,2,3,177,4,74,0,2,3,205,4,75,0,2,3,208,4,80,0,2,3,252,4,81,
+0,2,5,169,4,51,0,2,5,228,0,12,0,26,0,32,0,38,0,44,0,50,0,56,0,62,0,68,0,74,
+0,80,0,86,0,92,4,144,0,2,0,4,4,141,0,2,0,5,4,140,0,2,0,6,4,136,0,2,2,199,
+4,137,0,2,2,201,4,133,0,2,2,221,4,132,0,2,2,222,4,125,0,2,3,205,4,124,0,2,
+3,208,4,131,0,2,3,252,4,128,0,2,5,169,4,145,0,2,5,228,0,12,0,26,0,32,0,38,
+0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,4,147,0,2,0,4,4,142,0,2,0,5,
+4,143,0,2,0,6,4,139,0,2,2,199,4,138,0,2,2,201,4,134,0,2,2,221,4,135,0,2,2,
+222,4,126,0,2,3,205,4,127,0,2,3,208,4,129,0,2,3,252,4,130,0,2,5,169,4,146,
+0,2,5,228,0,14,0,30,0,36,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,96,
+0,102,0,108,4,218,0,2,0,4,4,215,0,2,0,5,4,214,0,2,0,6,4,213,0,2,0,9,4,221,
+0,2,0,58,4,216,0,2,0,93,4,225,0,2,1,86,4,228,0,2,1,87,4,234,0,2,1,90,4,229,
+0,2,3,176,4,227,0,2,3,177,4,238,0,2,3,252,4,237,0,2,5,169,4,217,0,2,5,228,
+0,14,0,30,0,36,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,96,0,102,0,
+108,4,220,0,2,0,4,4,226,0,2,0,5,4,224,0,2,0,6,4,222,0,2,0,9,4,223,0,2,0,58,
+4,235,0,2,0,93,4,232,0,2,1,86,4,233,0,2,1,87,4,236,0,2,1,90,4,230,0,2,3,176,
+4,231,0,2,3,177,4,239,0,2,3,252,4,240,0,2,5,169,4,219,0,2,5,228,0,22,0,46,
+0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,0,106,0,112,0,118,0,124,0,130,
+0,136,0,142,0,148,0,154,0,160,0,166,0,172,4,1,0,2,0,4,4,8,0,2,0,5,4,9,0,2,
+0,6,4,4,0,2,0,9,4,5,0,2,0,58,5,49,0,2,0,93,4,23,0,2,0,156,4,29,0,2,0,166,
+4,28,0,2,0,167,4,20,0,2,0,210,4,24,0,2,0,212,4,21,0,2,0,214,4,32,0,2,0,225,
+4,33,0,2,0,228,4,14,0,2,1,86,4,17,0,2,1,87,5,50,0,2,1,90,4,16,0,2,3,176,4,
+13,0,2,3,177,4,36,0,2,3,252,4,37,0,2,5,169,4,0,0,2,5,228,0,22,0,46,0,52,0,
+58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,0,106,0,112,0,118,0,124,0,130,0,136,
+0,142,0,148,0,154,0,160,0,166,0,172,3,254,0,2,0,4,4,7,0,2,0,5,4,6,0,2,0,6,
+4,3,0,2,0,9,4,2,0,2,0,58,5,52,0,2,0,93,4,25,0,2,0,156,4,26,0,2,0,166,4,27,
+0,2,0,167,4,19,0,2,0,210,4,22,0,2,0,212,4,18,0,2,0,214,4,31,0,2,0,225,4,30,
+0,2,0,228,4,10,0,2,1,86,4,12,0,2,1,87,5,51,0,2,1,90,4,11,0,2,3,176,4,15,0,
+2,3,177,4,35,0,2,3,252,4,34,0,2,5,169,3,255,0,2,5,228,0,1,0,4,5,71,0,2,0,
+153,0,1,0,63,0,20,0,75,0,79,0,132,0,133,0,168,0,193,0,206,0,209,0,244,0,247,
+0,248,1,22,1,58,1,59,1,60,1,64,1,80,1,82,1,83,1,92,1,110,1,111,1,158,1,194,
+1,195,1,246,1,247,2,124,2,126,2,148,2,149,2,164,2,165,2,246,2,248,3,11,3,
+14,3,33,3,35,3,94,3,95,3,118,3,123,3,170,3,171,3,173,3,182,3,183,3,184,3,
+214,3,215,3,216,3,217,4,47,4,53,4,149,4,150,4,210,4,211,5,155,5,157,5,228,
+0,4,0,0,0,1,0,8,0,1,0,94,0,6,0,18,0,28,0,38,0,48,0,58,0,76,0,1,0,4,0,185,
+0,2,3,142,0,1,0,4,0,18,0,2,3,142,0,1,0,4,1,87,0,2,3,142,0,1,0,4,0,170,0,2,
+3,142,0,2,0,6,0,12,3,174,0,2,3,142,0,178,0,2,3,143,0,2,0,6,0,12,3,176,0,2,
+3,142,1,85,0,2,3,143,0,1,0,6,0,66,0,179,1,86,3,168,3,175,3,177,0,6,0,0,0,
+1,0,8,0,2,0,18,0,24,0,76,0,92,0,3,0,0,0,132,0,0,0,1,0,1,3,171,0,2,0,8,0,9,
+0,9,0,2,0,59,0,59,0,2,0,62,0,62,0,1,0,64,0,64,0,1,0,177,0,177,0,1,0,179,0,
+179,0,1,3,175,3,175,0,1,3,177,3,177,0,1,0,2,0,2,0,75,0,75,0,2,3,171,3,171,
+0,1,0,2,0,6,0,64,0,64,0,1,0,66,0,66,0,1,1,84,1,84,0,1,1,86,1,86,0,1,3,175,
+3,175,0,1,3,177,3,177,0,1,0,2,0,6,0,22,0,1,0,1,0,2,0,2,0,0,0,1,0,0,0,24,0,
+1,0,2,0,2,0,2,0,1,0,1,0,1,0,0,0,24,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,
+4,0,201,0,2,0,75,0,1,0,1,3,171,0,0,};
+#endif
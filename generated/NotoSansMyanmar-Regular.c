@@ -0,0 +1,4787 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansMyanmar_Regular_ttf_size = 119604;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansMyanmar_Regular_ttf");
+asm(".type fz_font_NotoSansMyanmar_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansMyanmar_Regular_ttf, 119604");
+asm(".balign 64");
+asm("fz_font_NotoSansMyanmar_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansMyanmar-Regular.ttf\"");
+#else
+const int fz_font_NotoSansMyanmar_Regular_ttf_size = 119604;
+const char fz_font_NotoSansMyanmar_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,121,71,134,157,0,1,75,16,0,0,10,98,
+71,80,79,83,152,18,122,62,0,1,85,116,0,0,78,54,71,83,85,66,47,163,195,49,
+0,1,163,172,0,0,47,136,79,83,47,50,128,72,98,65,0,0,1,104,0,0,0,96,99,109,
+97,112,220,35,66,209,0,0,10,56,0,0,0,166,103,97,115,112,0,7,0,7,0,1,75,4,
+0,0,0,12,103,108,121,102,131,167,129,137,0,0,15,28,0,1,26,16,104,101,97,100,
+8,142,83,113,0,0,0,236,0,0,0,54,104,104,101,97,22,220,2,212,0,0,1,36,0,0,
+0,36,104,109,116,120,98,90,209,23,0,0,1,200,0,0,8,112,108,111,99,97,73,157,
+2,197,0,0,10,224,0,0,4,58,109,97,120,112,2,65,1,54,0,0,1,72,0,0,0,32,110,
+97,109,101,141,36,185,89,0,1,41,44,0,0,6,6,112,111,115,116,43,6,133,194,0,
+1,47,52,0,0,27,205,0,1,0,0,0,1,25,154,26,116,192,215,95,15,60,245,0,11,8,
+0,0,0,0,0,203,6,37,40,0,0,0,0,210,40,203,251,249,17,249,29,19,47,10,153,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,10,153,249,29,0,0,19,158,249,17,243,252,19,
+47,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,28,0,1,0,0,2,28,0,135,0,19,0,173,0,13,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,4,4,200,1,144,0,5,0,0,2,188,2,138,0,
+0,1,31,2,188,2,138,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,
+0,0,0,0,0,4,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,10,153,249,29,0,0,10,153,
+6,227,0,0,0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,4,4,205,0,193,0,0,0,0,2,20,0,
+0,2,20,0,0,8,254,0,113,5,104,0,106,5,89,0,113,9,1,0,109,5,52,0,113,5,101,
+0,113,9,5,0,94,5,121,0,113,6,244,0,113,5,74,0,186,8,223,0,186,5,84,0,127,
+5,70,0,113,5,84,0,188,5,106,0,109,10,10,0,113,8,254,0,113,9,0,0,113,5,31,
+0,100,5,100,0,113,4,143,0,70,5,104,0,113,5,103,0,113,5,105,0,113,8,254,0,
+102,5,104,0,113,9,2,0,113,5,131,0,113,9,2,0,113,5,100,0,113,9,4,0,102,8,253,
+0,113,5,84,0,127,8,139,0,100,8,251,0,109,8,205,0,113,10,190,0,113,5,74,0,
+186,5,74,0,186,5,13,0,113,5,127,0,186,10,244,0,186,19,158,0,113,1,213,0,186,
+0,0,251,238,12,172,0,102,5,55,0,113,4,252,0,113,5,102,0,88,4,242,0,102,4,
+242,0,113,5,102,0,88,5,195,0,186,5,43,0,102,5,55,0,113,5,195,0,186,2,41,0,
+186,3,178,0,186,5,84,0,188,7,35,0,113,5,70,0,113,9,25,0,113,5,89,0,113,5,
+104,0,113,5,74,0,113,5,74,0,109,5,71,0,113,5,54,0,113,4,106,0,88,4,137,0,
+70,0,0,251,195,0,0,251,195,4,242,0,113,6,244,0,113,5,91,0,113,5,70,0,113,
+0,0,251,119,0,0,251,160,0,0,251,199,5,131,0,73,2,176,0,63,5,74,0,186,3,53,
+0,63,5,86,0,157,5,57,0,113,3,121,0,96,2,176,0,63,3,98,0,109,3,121,0,96,3,
+121,0,96,3,121,0,186,3,98,0,109,10,7,0,113,8,209,0,113,8,213,0,109,0,0,251,
+113,0,0,252,27,0,0,251,100,0,0,251,100,5,85,0,113,5,97,0,96,5,101,0,106,9,
+1,0,113,9,2,0,113,8,213,0,113,9,3,0,113,9,8,0,94,9,7,0,109,8,202,0,109,5,
+106,0,113,8,253,0,94,5,57,0,113,0,0,252,125,2,176,0,63,4,188,0,100,0,0,252,
+41,0,0,252,240,2,199,0,129,2,197,0,129,2,197,0,129,3,121,0,129,2,197,0,129,
+5,59,0,129,0,0,251,109,5,99,0,113,2,197,0,129,6,23,0,186,5,43,0,117,5,109,
+0,186,5,195,0,35,5,223,0,35,5,190,0,115,5,190,0,115,4,113,0,63,5,57,0,123,
+5,57,0,123,2,197,0,129,2,199,0,129,3,121,0,129,0,0,251,229,2,176,0,63,7,162,
+0,113,9,1,0,113,8,254,0,109,7,10,0,186,9,6,0,109,9,2,0,113,8,213,0,113,8,
+254,0,113,9,0,0,113,9,3,0,113,9,5,0,113,9,5,0,113,5,89,255,248,10,10,0,113,
+7,253,255,243,9,0,0,113,7,8,0,186,3,47,255,90,8,250,0,113,10,9,0,88,7,10,
+0,186,7,162,0,113,11,14,0,109,11,78,0,102,7,203,0,113,5,195,0,86,5,131,0,
+113,10,172,0,186,2,197,0,129,2,35,253,178,0,0,252,29,0,0,252,176,0,0,252,
+29,0,0,251,111,0,0,250,143,0,0,250,47,0,0,251,183,0,0,252,115,0,0,252,115,
+0,0,252,115,0,0,251,101,0,0,251,101,0,0,251,101,0,0,251,101,0,0,252,115,0,
+0,250,212,0,0,250,232,0,0,250,232,0,0,251,246,1,213,0,186,1,213,0,186,1,213,
+0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,
+186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,
+0,0,253,14,2,22,0,166,0,0,250,119,0,0,251,43,0,0,251,209,0,0,252,51,0,0,251,
+195,0,0,252,35,0,0,250,102,0,0,251,43,0,0,251,197,0,0,252,35,0,0,251,197,
+0,0,252,33,0,0,250,123,0,0,251,41,0,0,251,186,0,0,252,27,2,35,251,197,5,74,
+0,186,0,0,250,70,0,0,251,18,5,74,0,186,8,225,0,186,5,84,0,127,0,0,250,152,
+0,0,251,82,5,84,0,127,5,70,0,127,5,84,0,127,0,0,250,29,0,0,251,80,0,0,250,
+70,0,0,251,18,5,84,0,184,5,57,0,113,0,0,250,29,0,0,250,244,0,0,251,182,0,
+0,252,20,10,10,0,113,10,10,0,113,10,10,0,113,0,0,249,229,0,0,250,199,0,0,
+250,121,0,0,251,47,0,0,250,121,0,0,251,33,0,0,251,215,0,0,252,57,0,0,251,
+197,0,0,252,35,5,10,0,70,0,0,251,231,0,0,252,72,0,0,251,195,0,0,252,35,0,
+0,251,195,0,0,252,35,0,0,251,195,0,0,252,35,0,0,250,152,0,0,251,74,0,0,251,
+195,0,0,252,35,0,0,250,117,0,0,251,47,5,111,0,113,0,0,251,143,0,0,252,12,
+0,0,250,100,0,0,251,41,0,0,250,150,0,0,251,82,0,0,250,117,0,0,251,41,5,84,
+0,127,0,0,250,6,0,0,250,242,0,0,250,119,0,0,251,68,0,0,250,102,0,0,251,43,
+0,0,251,199,0,0,252,35,0,0,249,84,0,0,250,100,0,0,251,164,0,0,252,18,5,70,
+0,119,5,70,0,119,0,0,251,164,0,0,252,18,0,0,251,199,0,0,252,35,0,0,251,182,
+0,0,252,20,0,0,252,53,0,0,252,132,0,0,251,61,0,0,251,180,0,0,251,162,0,0,
+252,23,0,0,251,195,0,0,252,35,0,0,251,238,0,0,252,23,0,0,251,236,0,0,251,
+154,0,0,252,12,0,0,251,227,0,0,252,68,0,0,251,195,0,0,252,35,0,0,249,190,
+0,0,250,166,0,0,250,117,0,0,251,41,0,0,250,102,0,0,251,43,0,0,251,182,0,0,
+252,20,0,0,251,209,0,0,252,43,0,0,251,190,0,0,252,35,0,0,250,121,0,0,251,
+47,0,0,250,96,0,0,251,47,0,0,250,100,0,0,251,41,0,0,250,96,0,0,251,47,0,0,
+250,127,0,0,251,63,0,0,250,92,0,0,251,37,0,0,250,92,0,0,251,37,0,0,251,195,
+0,0,252,35,0,0,250,133,0,0,251,70,0,0,251,195,0,0,252,35,0,0,251,197,0,0,
+252,35,0,0,250,98,0,0,251,49,0,0,250,129,0,0,251,37,0,0,251,166,0,0,252,35,
+0,0,250,106,0,0,251,39,0,0,250,121,0,0,251,39,0,0,250,98,0,0,251,41,0,0,250,
+121,0,0,251,47,0,0,250,121,0,0,251,33,0,0,250,119,0,0,251,47,0,0,250,121,
+0,0,251,33,0,0,250,121,0,0,251,33,0,0,251,14,0,0,251,156,0,0,249,229,0,0,
+250,199,0,0,250,106,0,0,251,70,0,0,250,100,0,0,251,41,0,0,251,35,0,0,251,
+170,0,0,249,190,0,0,250,166,0,0,249,141,0,0,250,137,0,0,251,139,0,0,251,252,
+0,0,250,0,0,0,250,205,0,0,252,106,3,176,0,166,0,0,250,47,2,15,251,209,2,15,
+254,119,2,15,250,96,2,15,251,197,2,35,254,33,3,225,254,236,0,0,251,243,0,
+0,251,233,0,0,252,113,4,242,0,113,0,0,252,214,0,0,251,215,0,0,252,83,0,0,
+252,27,0,0,252,137,0,0,252,137,2,197,0,129,0,0,252,45,0,0,252,29,2,15,254,
+175,0,0,251,238,0,0,252,37,0,0,252,0,0,0,252,27,0,0,252,145,4,193,0,98,0,
+0,252,150,0,0,251,183,0,0,251,101,0,0,250,47,0,0,251,238,0,0,251,111,0,0,
+250,143,0,0,252,37,0,0,252,216,0,0,254,35,3,193,0,166,5,91,0,166,1,158,255,
+169,0,0,251,47,0,0,249,177,2,18,0,63,1,213,0,186,1,213,0,186,1,213,0,186,
+1,213,0,186,0,0,0,0,0,0,255,220,0,0,255,37,0,0,250,0,0,0,250,116,0,0,250,
+157,0,0,251,232,2,22,254,107,3,176,254,107,0,0,251,61,0,0,250,186,0,0,249,
+218,2,35,254,33,2,35,254,33,3,225,254,236,3,225,254,236,5,111,0,113,0,0,252,
+27,2,15,253,90,0,0,249,241,0,0,249,17,0,0,249,177,0,0,251,47,1,213,0,186,
+1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,0,0,250,49,0,
+0,250,49,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,
+0,186,1,213,0,186,2,15,250,96,2,15,252,8,1,213,0,186,1,213,0,186,1,213,0,
+186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,
+1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,
+213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,2,15,
+254,119,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,
+0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,
+186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,1,213,0,186,6,95,0,113,
+6,25,0,113,2,222,0,166,4,120,0,166,4,87,0,166,5,241,0,166,2,222,254,107,4,
+120,254,107,2,102,255,169,6,45,0,78,1,213,0,186,4,201,0,113,6,25,0,113,2,
+15,251,209,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,154,0,0,0,30,0,16,0,3,0,14,0,0,
+0,13,0,32,0,160,16,42,16,48,16,59,16,62,16,159,32,13,37,204,169,46,170,123,
+254,255,255,255,0,0,0,0,0,13,0,32,0,160,16,0,16,43,16,49,16,60,16,63,32,11,
+37,204,169,46,170,96,254,255,255,255,0,1,255,245,255,227,255,99,240,4,0,0,
+241,105,0,0,239,242,225,180,219,222,88,233,86,50,1,2,0,1,0,0,0,0,0,0,0,0,
+0,0,0,20,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,149,1,150,1,151,1,152,0,209,
+1,142,0,47,0,48,1,166,0,0,0,0,0,21,0,21,0,21,0,21,0,111,0,184,0,238,1,94,
+1,148,1,228,2,91,2,181,3,30,3,107,3,219,4,64,4,154,4,240,5,59,5,199,6,33,
+6,126,6,202,7,27,7,117,7,170,7,243,8,62,8,154,8,229,9,64,9,139,9,223,10,21,
+10,113,10,204,11,45,11,169,12,21,12,154,13,46,13,140,13,152,13,248,14,87,
+14,208,14,228,15,22,15,66,15,193,15,237,16,40,16,72,16,129,16,190,17,12,17,
+100,17,170,17,236,18,69,18,83,18,95,18,224,19,99,19,153,20,38,20,108,20,177,
+21,0,21,96,21,171,22,5,22,59,22,129,22,194,23,20,23,124,23,243,24,74,24,187,
+24,237,25,27,25,47,25,125,25,146,25,203,25,227,26,28,26,88,26,134,26,185,
+26,248,27,22,27,51,27,81,27,144,28,7,28,109,28,227,29,46,29,90,29,113,29,
+137,29,206,30,39,30,129,30,220,31,66,31,164,32,11,32,142,33,18,33,156,33,
+228,34,86,34,154,34,194,34,213,35,18,35,81,35,128,35,172,35,248,36,30,36,
+109,36,147,36,218,36,238,37,63,37,139,37,192,37,215,38,16,38,53,38,89,38,
+140,38,189,38,209,39,31,39,110,39,148,39,193,40,17,40,48,40,99,40,190,41,
+38,41,143,41,221,42,92,42,177,43,15,43,121,43,231,44,94,44,211,45,55,45,148,
+46,17,46,123,46,220,47,37,47,87,47,199,48,67,48,139,49,30,49,215,50,130,50,
+219,51,62,51,112,51,244,52,32,52,89,52,142,52,181,52,237,53,10,53,45,53,57,
+53,69,53,81,53,93,53,105,53,122,53,135,53,148,53,161,53,228,53,241,53,254,
+54,11,54,64,54,135,54,206,55,11,55,73,55,123,55,164,55,206,55,246,56,31,56,
+70,56,110,56,141,56,173,56,203,56,234,56,253,57,14,57,93,57,174,57,238,58,
+43,58,91,58,138,58,236,59,74,59,122,59,169,59,232,60,38,60,142,60,243,61,
+71,61,152,61,224,62,40,62,108,62,176,62,242,63,91,63,177,64,23,64,117,64,
+230,65,81,65,165,66,0,66,87,66,174,66,254,67,136,67,253,68,70,68,142,68,211,
+69,15,69,191,69,203,69,215,70,87,70,215,71,37,71,116,71,198,72,23,72,95,72,
+164,72,231,73,37,73,133,73,216,74,34,74,82,74,129,74,194,74,255,75,66,75,
+131,75,213,76,38,76,112,76,176,77,1,77,81,77,149,77,220,78,23,78,95,78,165,
+78,247,79,72,79,154,79,236,80,103,80,187,81,14,81,136,81,245,82,87,82,181,
+83,9,83,91,83,204,84,58,84,138,84,201,85,82,85,191,86,14,86,77,86,140,86,
+200,87,27,87,101,87,158,87,210,88,69,88,177,88,255,89,59,89,172,90,18,90,
+73,90,119,90,144,90,217,91,21,91,68,91,114,91,169,91,224,92,76,92,181,93,
+14,93,103,93,210,94,55,94,122,94,184,95,14,95,89,95,172,95,251,96,76,96,154,
+96,253,97,84,97,165,97,244,98,87,98,173,99,35,99,149,100,14,100,125,100,251,
+101,114,101,181,101,244,102,90,102,186,102,244,103,44,103,112,103,173,104,
+19,104,110,104,213,105,48,105,118,105,183,106,40,106,149,106,228,107,52,107,
+133,107,211,108,49,108,143,108,236,109,71,109,186,110,33,110,139,110,249,
+111,83,111,177,112,8,112,89,112,190,113,37,113,132,113,224,114,61,114,141,
+114,199,115,1,115,125,115,245,116,102,116,215,117,20,117,75,117,180,118,27,
+118,56,118,80,118,140,118,173,118,194,119,9,119,65,119,104,119,155,119,203,
+120,15,120,33,120,96,120,115,120,191,120,210,121,15,121,60,121,101,121,171,
+121,199,121,237,122,4,122,56,122,76,122,100,122,146,122,165,123,84,123,110,
+123,122,123,139,123,151,123,163,123,175,123,187,123,199,123,211,123,224,123,
+236,123,248,124,1,124,109,124,216,124,225,124,237,124,249,125,5,125,17,125,
+17,125,30,125,59,125,71,125,83,125,95,125,108,125,120,125,132,125,158,125,
+171,125,183,125,195,125,207,125,219,125,231,126,43,126,110,126,134,126,151,
+126,167,127,28,127,142,127,192,127,234,128,55,128,132,128,199,129,12,129,
+69,129,81,129,165,129,249,130,67,130,143,130,213,131,34,131,103,131,174,131,
+233,132,61,132,137,132,199,133,5,133,82,133,124,133,157,133,207,133,249,134,
+34,134,66,134,116,134,158,134,199,134,231,135,14,135,26,135,38,135,108,135,
+120,135,160,135,181,135,223,136,0,136,41,136,73,136,104,136,174,136,186,137,
+7,137,91,137,167,137,229,137,241,138,62,138,131,138,215,139,35,139,103,139,
+178,139,246,140,7,140,31,140,43,140,55,140,67,140,79,140,88,140,124,140,155,
+140,223,140,231,141,8,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,
+55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,
+4,0,113,255,206,8,141,4,217,0,52,0,53,0,54,0,55,0,0,37,22,51,50,54,53,52,
+38,35,34,6,7,23,22,21,20,2,7,39,54,54,53,52,38,35,34,6,21,20,22,23,7,38,2,
+53,16,0,51,50,22,23,54,54,51,32,0,21,16,0,35,34,38,39,19,1,5,5,158,78,115,
+168,204,206,173,133,187,79,12,7,150,115,104,88,94,207,171,172,208,94,88,104,
+112,152,1,69,241,144,238,88,81,243,148,1,7,1,49,254,213,230,94,135,59,248,
+254,57,1,207,169,37,223,190,189,231,142,127,69,45,54,192,254,235,79,131,71,
+205,137,203,238,237,204,137,205,71,131,73,1,43,176,1,7,1,71,119,122,118,123,
+254,184,241,254,252,254,204,24,29,4,183,251,39,50,0,5,0,106,255,206,4,247,
+4,217,0,26,0,38,0,39,0,40,0,41,0,0,19,54,36,51,32,0,21,20,0,33,34,36,39,54,
+54,51,50,22,23,54,53,52,38,35,34,6,7,19,22,22,51,50,54,55,38,38,35,34,6,1,
+3,7,123,57,1,36,193,1,23,1,71,254,187,254,231,204,254,206,49,141,252,133,
+134,219,82,18,228,188,135,210,58,35,61,191,118,115,168,55,69,187,127,92,164,
+1,42,21,1,3,16,150,184,254,185,240,240,254,181,212,181,93,85,76,63,69,72,
+187,227,129,127,254,116,92,92,76,65,58,71,51,3,123,251,39,50,0,0,4,0,113,
+255,206,4,232,4,217,0,26,0,27,0,28,0,29,0,0,5,38,2,53,16,0,51,50,4,18,21,
+20,2,7,39,54,54,53,52,38,35,34,6,21,20,22,23,19,19,23,1,121,112,152,1,72,
+245,149,1,7,158,151,114,104,88,94,216,167,171,216,94,88,199,2,3,20,73,1,43,
+176,1,6,1,72,139,254,241,180,168,254,207,75,131,71,205,137,207,236,237,206,
+137,205,71,4,106,251,39,50,0,4,0,109,255,206,8,144,4,217,0,70,0,71,0,72,0,
+73,0,0,1,54,54,51,50,0,17,20,0,33,34,38,39,6,6,35,34,36,53,52,54,55,55,54,
+54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,14,2,21,20,22,51,50,54,53,52,
+38,39,55,22,18,21,20,7,7,22,22,51,50,54,53,52,38,35,34,7,19,1,5,5,92,59,136,
+94,232,1,43,254,206,254,251,149,249,80,96,246,142,242,254,220,70,59,70,39,
+43,41,35,31,57,35,102,61,100,78,114,124,47,169,57,186,178,162,216,94,88,104,
+124,141,7,12,72,215,118,174,204,206,168,116,78,212,254,10,1,227,4,41,29,24,
+254,202,254,252,241,254,185,122,119,136,105,239,191,99,150,53,62,33,53,35,
+29,43,35,41,104,66,57,138,75,68,98,147,118,64,121,158,237,205,138,204,72,
+131,88,254,212,161,53,45,70,129,141,231,190,191,224,37,1,55,251,39,50,0,0,
+4,0,113,255,206,4,195,4,217,0,25,0,26,0,27,0,28,0,0,1,6,4,35,32,0,53,52,0,
+33,50,4,23,7,38,38,35,34,6,21,20,22,51,50,54,55,1,3,7,4,195,55,254,230,184,
+254,237,254,202,1,61,1,12,184,1,26,55,143,55,199,127,182,214,223,173,127,
+199,55,254,126,6,1,1,57,149,184,1,68,247,243,1,68,185,149,73,127,129,230,
+184,182,240,129,127,3,86,251,39,50,0,6,0,113,255,206,4,244,4,217,0,13,0,30,
+0,42,0,43,0,44,0,45,0,0,18,0,33,50,4,18,21,20,2,4,35,32,0,53,1,22,22,21,20,
+6,7,22,51,50,54,53,52,38,35,34,6,3,54,54,53,52,38,39,6,6,21,20,22,1,3,7,113,
+1,57,1,8,170,1,3,149,152,254,251,171,254,251,254,202,1,157,72,96,88,72,66,
+84,179,218,215,180,45,80,160,64,63,63,68,57,61,63,1,92,2,3,3,24,1,70,140,
+254,243,160,159,254,241,139,1,69,244,1,131,74,192,128,119,191,75,27,229,186,
+190,232,17,253,57,61,154,88,87,157,66,57,158,92,93,156,3,177,251,39,50,0,
+6,0,94,255,206,8,148,4,217,0,41,0,53,0,71,0,72,0,73,0,74,0,0,19,54,36,51,
+50,22,23,54,54,51,50,4,18,21,20,2,4,35,34,38,39,6,6,35,34,36,39,54,36,51,
+50,22,23,54,54,53,52,38,35,34,6,7,19,22,22,51,50,54,55,38,38,35,34,6,1,22,
+22,21,20,6,7,22,22,51,50,54,53,52,38,35,34,6,1,1,5,111,57,1,26,187,150,245,
+80,95,234,172,172,1,5,150,153,254,249,173,171,249,71,95,238,146,198,254,214,
+47,108,1,1,160,124,199,83,5,4,217,180,129,199,55,35,60,179,110,123,173,49,
+79,190,94,100,164,3,68,10,18,14,12,51,217,143,187,217,207,184,134,213,1,82,
+254,19,1,236,3,16,151,183,108,107,107,108,140,254,244,161,160,254,243,140,
+121,100,117,104,213,180,74,106,49,45,22,47,25,186,228,129,127,254,114,92,
+90,98,86,39,56,54,1,129,34,111,51,39,107,34,102,132,228,186,195,227,96,1,
+114,251,39,50,0,0,5,0,113,255,206,5,77,4,217,0,45,0,57,0,58,0,59,0,60,0,0,
+1,38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,38,2,53,52,18,36,51,50,22,22,
+21,20,6,21,20,22,51,21,35,34,38,53,6,6,35,34,38,53,52,54,22,6,21,20,22,51,
+50,54,53,52,38,35,3,19,7,3,8,47,43,173,214,189,211,215,122,121,72,245,102,
+228,240,157,149,1,1,169,190,237,98,8,70,82,37,123,131,25,63,35,111,149,52,
+159,66,66,47,47,66,66,47,253,18,1,3,193,6,222,177,198,239,112,122,60,81,127,
+1,7,181,159,1,14,138,108,158,80,49,102,25,66,43,149,121,98,14,13,139,105,
+64,94,43,66,47,47,65,65,47,47,66,1,96,251,39,50,0,7,0,113,252,68,6,55,4,217,
+0,30,0,47,0,59,0,60,0,61,0,62,0,63,0,0,1,17,6,35,34,0,53,52,18,54,51,50,22,
+18,21,20,6,7,17,20,22,51,50,54,53,17,51,17,16,33,32,1,22,22,21,20,6,7,22,
+51,50,54,53,52,38,35,34,6,3,54,54,53,52,38,39,6,6,21,20,22,1,5,1,1,3,55,73,
+88,250,254,213,143,247,165,164,248,143,103,114,98,104,105,96,182,254,127,
+254,129,254,199,73,95,88,72,66,84,166,202,197,169,45,80,152,60,59,59,64,53,
+57,59,3,119,252,12,1,200,254,228,254,86,1,168,18,1,67,246,163,1,10,140,141,
+254,245,161,127,252,86,253,240,175,188,188,175,6,6,250,10,253,240,7,100,75,
+191,127,119,191,75,27,230,184,188,234,17,253,58,61,154,88,86,157,66,57,158,
+92,92,156,254,215,50,5,11,250,245,0,0,4,0,186,252,68,8,106,4,217,0,43,0,44,
+0,45,0,46,0,0,1,50,54,53,53,51,16,33,33,32,17,17,55,22,22,51,50,54,53,52,
+38,35,34,6,7,39,54,36,51,50,22,18,21,20,2,6,35,34,38,39,17,20,22,51,9,2,6,
+207,119,110,182,254,93,251,151,254,92,144,51,184,119,171,196,199,168,119,
+184,51,144,56,1,10,174,163,250,142,142,249,164,92,156,65,110,119,2,100,253,
+238,3,201,252,217,133,123,33,254,74,1,182,3,63,74,127,129,231,191,182,232,
+129,127,73,154,180,141,254,249,163,164,254,247,142,49,45,253,143,123,133,
+3,39,4,217,250,245,0,0,4,0,186,252,68,8,111,4,217,0,69,0,70,0,71,0,72,0,0,
+0,6,7,39,54,36,51,50,22,18,21,20,7,22,22,51,50,54,53,52,38,35,34,7,39,54,
+54,51,50,0,17,20,2,6,35,34,38,39,6,6,35,34,38,39,17,20,22,51,33,50,54,53,
+53,51,16,33,33,32,17,17,55,22,22,51,50,54,53,52,38,35,1,1,3,2,53,184,51,144,
+56,1,10,174,163,250,142,18,61,186,140,169,197,199,163,113,76,65,57,133,92,
+227,1,38,143,248,164,142,241,78,66,226,169,92,156,65,110,119,4,121,119,110,
+182,254,93,251,151,254,92,144,51,184,119,171,196,199,168,1,209,1,225,31,3,
+199,129,127,73,154,180,141,254,249,163,74,76,133,137,234,188,190,224,37,135,
+29,24,254,203,254,252,161,254,245,141,120,121,104,137,49,45,253,143,123,133,
+133,123,33,254,74,1,182,3,63,74,127,129,231,191,182,232,252,57,4,217,250,
+245,0,0,4,0,127,252,68,5,154,4,217,0,62,0,63,0,64,0,65,0,0,51,31,2,22,22,
+51,50,54,55,53,6,6,35,34,38,2,53,52,18,54,51,50,4,23,7,38,38,35,34,6,21,20,
+22,51,50,54,55,23,17,6,4,35,34,38,39,21,22,22,51,50,54,55,17,33,21,33,17,
+6,6,35,32,39,5,19,1,186,37,33,20,91,206,107,86,160,71,65,158,92,164,249,142,
+142,250,163,174,1,10,56,144,51,184,119,166,201,198,169,119,184,51,144,101,
+254,252,137,88,168,78,72,157,105,133,248,117,1,0,254,75,77,158,82,254,248,
+230,1,168,60,254,192,25,24,14,58,63,43,41,176,47,49,142,1,9,164,163,1,7,141,
+180,154,73,127,129,228,186,195,227,129,127,74,254,29,74,92,35,31,176,27,27,
+68,61,254,66,139,1,94,23,22,108,87,7,79,248,177,0,4,0,113,252,18,4,139,4,
+217,0,55,0,56,0,57,0,58,0,0,1,50,54,53,17,6,6,35,34,38,2,53,52,18,54,51,50,
+4,23,7,38,38,35,34,6,21,20,22,51,50,54,55,23,17,2,33,35,34,38,53,52,54,51,
+50,22,23,7,38,38,35,34,6,21,20,22,51,23,3,19,2,242,118,111,65,158,92,164,
+249,142,142,249,164,175,1,11,53,143,51,185,118,168,199,196,171,118,185,51,
+143,6,254,98,198,199,213,178,133,100,133,62,112,36,77,59,49,89,125,99,133,
+4,4,252,217,133,123,2,115,47,49,141,1,11,163,163,1,8,140,185,149,73,127,129,
+229,185,194,228,129,127,74,252,183,254,84,158,153,133,164,67,58,107,34,46,
+70,77,79,81,169,8,169,247,57,0,5,0,188,252,68,5,156,4,217,0,47,0,48,0,49,
+0,50,0,51,0,0,1,6,6,35,34,36,39,17,55,22,22,51,50,54,53,52,38,35,34,6,7,39,
+54,36,51,50,22,18,21,20,2,6,35,34,38,39,21,22,22,51,50,54,55,55,17,33,21,
+33,9,2,3,3,231,73,158,82,137,254,252,101,144,51,184,119,169,198,201,166,119,
+184,51,144,56,1,10,174,163,250,142,142,249,164,92,158,65,71,160,86,100,201,
+88,105,1,0,254,75,1,21,252,118,1,54,50,254,233,28,29,92,74,1,227,74,127,129,
+227,195,186,228,129,127,73,154,180,141,254,249,163,164,254,247,142,49,47,
+176,41,43,59,53,72,252,207,139,3,188,254,182,6,35,249,221,0,4,0,109,255,206,
+4,250,4,217,0,43,0,44,0,45,0,46,0,0,1,54,54,53,52,38,35,34,6,7,39,54,54,51,
+50,22,21,20,14,2,21,20,22,51,50,54,53,52,38,39,55,22,18,21,16,0,35,34,36,
+53,52,54,55,1,19,21,1,72,39,43,41,35,31,57,35,102,61,100,78,114,124,47,169,
+57,194,186,177,217,103,96,104,132,150,254,173,248,254,254,208,70,59,1,165,
+6,3,6,33,53,35,29,43,35,41,104,66,57,138,75,68,98,147,118,64,121,158,239,
+203,138,204,72,131,88,254,210,159,254,253,254,182,239,191,99,150,53,2,17,
+251,39,50,0,0,5,0,113,255,206,9,154,4,217,0,69,0,93,0,94,0,95,0,96,0,0,0,
+54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,0,53,52,18,54,51,50,
+22,23,54,54,51,50,22,23,54,54,51,50,22,18,21,20,0,35,34,38,39,55,22,22,51,
+50,54,53,52,38,35,34,6,21,20,22,21,20,6,35,34,38,53,1,38,38,35,34,6,7,22,
+22,21,20,6,21,20,22,51,50,54,53,52,38,53,52,54,3,1,19,3,197,41,194,157,158,
+198,206,157,30,56,26,43,41,84,57,220,254,210,139,244,161,113,182,68,53,119,
+94,92,126,46,68,182,113,161,244,140,254,211,222,59,84,41,41,29,55,31,157,
+205,192,156,162,194,41,179,143,151,168,1,241,39,82,53,67,80,33,41,45,43,68,
+67,67,66,41,43,147,2,118,14,1,53,156,74,199,231,231,193,190,224,4,8,143,12,
+8,1,67,248,158,1,13,140,67,60,57,70,75,52,60,67,140,254,242,157,246,254,187,
+8,12,143,8,4,220,194,191,233,231,199,78,156,57,135,133,142,126,2,112,43,54,
+60,37,65,158,86,91,144,64,53,78,78,53,66,140,91,86,160,252,217,4,217,250,
+245,0,5,0,113,255,206,8,141,4,217,0,38,0,50,0,51,0,52,0,53,0,0,1,54,54,51,
+32,0,21,16,0,35,34,38,39,55,22,51,50,54,53,52,38,35,34,6,7,23,22,21,20,0,
+33,34,0,53,52,0,33,50,22,2,38,35,34,6,21,20,22,51,50,54,53,1,1,5,4,124,82,
+242,148,1,8,1,49,254,213,233,94,136,59,66,78,116,172,203,203,176,138,186,
+76,12,7,254,201,254,252,254,254,207,1,50,1,4,144,237,4,203,173,175,206,214,
+165,172,206,2,52,254,57,1,231,3,109,118,123,254,182,239,254,253,254,202,24,
+29,135,37,227,187,185,235,144,125,68,44,43,236,254,187,1,67,246,242,1,71,
+119,254,248,232,231,191,190,224,230,184,2,184,251,39,50,0,0,6,0,113,255,206,
+8,143,4,217,0,23,0,41,0,53,0,54,0,55,0,56,0,0,37,6,6,35,34,0,53,52,0,33,50,
+22,23,54,54,51,32,0,21,20,0,33,34,38,3,22,22,21,20,6,7,22,22,51,50,54,53,
+52,38,35,34,6,6,38,35,34,6,21,20,22,51,50,54,53,1,1,5,4,114,97,232,136,255,
+254,207,1,49,1,5,138,237,80,92,229,168,1,4,1,52,254,202,254,243,161,236,1,
+10,19,15,12,53,207,137,182,210,200,179,127,204,239,203,173,174,207,214,165,
+172,206,2,52,254,47,1,198,200,124,97,1,67,247,240,1,72,103,112,107,108,254,
+185,242,250,254,193,115,2,134,35,110,51,39,107,34,107,127,230,184,196,226,
+94,138,232,231,190,192,223,230,184,2,185,251,39,50,0,4,0,100,255,206,4,196,
+4,217,0,46,0,47,0,48,0,49,0,0,19,38,38,53,52,36,51,50,22,21,20,6,7,21,22,
+22,21,20,4,33,34,36,39,55,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,
+38,35,34,6,21,20,23,1,3,21,221,22,33,1,16,231,254,255,122,99,142,121,254,
+221,254,236,213,254,228,56,144,52,220,139,202,183,137,141,28,11,104,157,150,
+187,163,170,26,1,51,17,2,172,31,71,48,126,158,151,140,100,111,28,10,40,140,
+99,153,166,162,145,73,122,111,104,91,70,106,147,90,78,72,86,82,62,36,29,1,
+223,251,39,50,0,0,6,0,113,255,206,4,243,4,217,0,13,0,31,0,43,0,44,0,45,0,
+46,0,0,18,0,33,50,4,18,21,20,2,4,35,32,0,53,23,54,54,51,50,22,23,54,54,53,
+52,38,35,34,6,21,20,22,5,38,38,35,34,6,7,22,22,51,50,54,1,3,23,113,1,54,1,
+11,170,1,1,150,151,254,251,171,254,251,254,202,196,74,189,122,115,187,74,
+4,6,211,177,179,214,4,2,200,66,163,92,92,168,67,51,159,113,112,162,254,238,
+8,3,3,20,1,74,140,254,243,160,159,254,241,139,1,69,244,115,60,79,75,60,27,
+51,29,190,232,231,191,29,55,166,61,72,72,65,74,86,88,3,254,251,39,50,0,0,
+6,0,70,252,68,4,195,4,217,0,43,0,54,0,55,0,56,0,57,0,58,0,0,5,35,34,38,53,
+52,54,51,50,22,23,54,54,53,52,38,36,38,53,52,54,51,50,22,22,23,7,38,38,35,
+34,6,21,20,30,3,21,20,6,7,17,35,3,51,53,52,38,35,34,6,21,20,22,5,33,3,1,2,
+35,70,193,214,181,128,155,183,10,104,91,169,254,203,133,193,131,103,130,62,
+80,107,9,135,116,65,95,125,254,159,75,197,170,182,78,78,105,77,53,83,133,
+3,89,253,186,9,2,29,20,150,140,127,152,203,215,10,92,76,79,105,108,134,105,
+120,158,43,39,73,115,7,116,70,53,64,75,85,94,124,93,147,168,14,252,84,4,61,
+2,141,125,61,68,66,73,129,4,217,250,245,0,4,0,113,255,206,4,247,4,217,0,25,
+0,26,0,27,0,28,0,0,1,22,18,21,16,0,35,34,0,17,52,18,55,23,6,6,21,20,22,51,
+50,54,53,52,38,39,39,19,7,3,222,129,152,254,182,249,251,254,184,143,121,104,
+88,94,217,176,177,215,102,96,201,3,3,4,94,85,254,212,164,254,252,254,183,
+1,74,1,3,169,1,38,86,131,72,204,138,203,239,240,202,138,204,72,254,251,39,
+50,0,5,0,113,255,206,4,246,4,217,0,27,0,39,0,40,0,41,0,42,0,0,37,38,38,53,
+52,18,55,22,18,21,16,0,35,34,36,2,53,52,18,55,23,6,6,21,20,22,51,50,55,54,
+54,53,52,38,39,6,6,21,20,22,3,19,23,3,72,68,92,144,145,148,153,254,182,249,
+153,254,249,162,143,121,104,88,94,218,174,80,204,58,71,75,58,69,58,66,241,
+13,3,160,77,214,137,176,1,4,92,96,254,223,162,254,252,254,183,135,1,18,180,
+169,1,38,86,131,72,204,138,204,238,113,57,164,108,103,166,65,65,148,106,99,
+180,3,164,251,39,50,0,5,0,113,255,206,4,248,4,217,0,23,0,41,0,42,0,43,0,44,
+0,0,1,6,21,20,22,51,50,54,53,52,39,55,22,18,21,16,0,35,34,0,17,52,18,55,3,
+6,6,21,20,22,51,50,54,53,52,38,39,6,6,35,34,38,1,19,21,1,238,15,126,82,78,
+123,14,116,132,150,254,181,249,249,254,182,143,121,23,28,27,217,177,177,215,
+34,38,35,159,137,129,169,1,45,7,3,242,43,41,80,109,108,81,41,43,108,88,254,
+210,159,254,251,254,184,1,73,1,4,169,1,38,86,254,213,55,113,78,203,239,240,
+202,76,115,55,108,125,127,2,16,251,39,50,0,4,0,102,255,206,8,141,4,217,0,
+53,0,54,0,55,0,56,0,0,1,22,21,20,0,33,34,36,39,55,22,22,51,50,54,53,52,38,
+35,34,6,7,39,54,36,51,50,22,23,54,54,51,50,4,18,21,16,0,35,34,38,39,55,22,
+51,50,54,53,52,38,35,34,6,7,1,1,5,4,172,7,254,197,254,246,183,254,233,58,
+144,55,196,128,180,212,214,178,128,196,55,144,58,1,25,183,148,247,90,85,250,
+155,174,1,7,153,254,202,241,98,141,60,65,82,123,180,213,214,183,156,198,66,
+1,158,254,31,1,248,2,117,43,41,234,254,181,182,151,74,127,129,226,196,185,
+229,129,127,73,153,181,119,122,118,123,140,254,243,161,254,253,254,202,24,
+29,135,37,226,188,187,234,138,131,2,33,251,39,50,0,5,0,113,255,206,4,247,
+4,217,0,29,0,40,0,41,0,42,0,43,0,0,1,54,53,52,38,39,55,22,18,21,16,0,35,34,
+0,17,52,18,55,23,6,6,21,20,23,54,54,51,50,22,23,38,38,35,34,6,7,22,51,50,
+54,1,19,21,4,48,12,102,96,104,129,152,254,182,249,251,254,184,143,121,104,
+88,94,12,75,190,120,113,186,22,67,161,93,90,169,68,108,215,106,166,254,234,
+6,1,184,62,71,138,204,72,131,85,254,212,164,254,252,254,183,1,74,1,3,169,
+1,38,86,131,72,204,138,73,64,60,77,73,203,61,70,72,63,162,84,4,2,251,39,50,
+0,4,0,113,255,206,8,145,4,217,0,52,0,53,0,54,0,55,0,0,1,54,54,51,50,0,17,
+20,0,33,34,38,39,6,6,35,34,0,17,52,18,55,23,6,6,21,20,22,51,50,54,53,52,38,
+39,55,22,18,21,20,7,7,22,22,51,50,54,53,52,38,35,34,7,19,1,5,5,92,59,136,
+94,233,1,43,254,205,254,249,149,242,82,88,238,144,245,254,190,143,121,104,
+88,94,207,173,175,204,96,90,104,125,144,7,12,81,186,134,176,204,206,169,116,
+78,222,253,254,1,226,4,41,29,24,254,202,254,253,240,254,183,122,119,123,118,
+1,73,1,4,169,1,38,86,131,72,204,138,202,238,241,199,138,204,72,131,87,254,
+210,160,53,45,70,122,146,234,186,190,224,37,1,55,251,39,50,0,0,6,0,113,252,
+68,5,199,4,217,0,27,0,36,0,37,0,38,0,39,0,40,0,0,1,52,38,35,34,6,7,4,0,17,
+6,6,35,34,0,53,52,18,54,51,50,22,18,21,17,33,21,33,1,38,38,39,20,22,51,50,
+54,5,5,1,3,4,18,201,171,142,180,33,1,10,1,48,47,115,61,250,254,213,143,247,
+165,164,248,143,1,0,254,75,254,185,8,233,175,203,166,12,22,2,13,252,167,1,
+33,79,2,33,186,236,154,125,24,254,166,254,212,16,22,1,67,246,163,1,10,140,
+141,254,245,161,250,170,139,4,65,179,215,16,190,222,2,133,50,5,11,250,245,
+0,0,4,0,113,255,206,8,145,4,217,0,45,0,46,0,47,0,48,0,0,36,55,23,6,6,35,34,
+0,17,52,0,33,50,0,18,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,0,17,20,
+0,35,34,0,2,38,35,34,6,21,20,22,51,1,1,5,3,4,78,65,57,133,92,227,254,219,
+1,42,1,1,233,1,15,119,198,169,148,201,200,163,112,76,66,58,133,92,226,1,38,
+254,210,239,237,254,245,151,197,143,163,195,198,165,3,241,253,233,2,4,131,
+37,135,29,24,1,54,1,3,240,1,73,254,212,254,64,237,227,193,191,223,37,135,
+29,24,254,203,254,252,244,254,187,1,14,1,245,214,231,189,189,225,4,86,251,
+39,50,0,0,5,0,113,255,206,4,243,4,217,0,12,0,24,0,25,0,26,0,27,0,0,18,0,33,
+32,0,21,20,2,4,35,32,0,53,36,38,35,34,6,21,20,22,51,50,54,53,1,3,23,113,1,
+57,1,8,1,8,1,57,151,254,252,172,254,250,254,203,3,199,208,180,179,214,220,
+171,176,214,254,122,8,3,3,24,1,70,254,183,240,159,254,241,139,1,69,244,184,
+234,231,191,189,225,229,185,2,184,251,39,50,0,4,0,102,255,206,8,148,4,217,
+0,53,0,54,0,55,0,56,0,0,1,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,
+0,17,20,2,4,35,34,38,39,6,6,35,34,36,39,55,22,22,51,50,54,53,52,38,35,34,
+6,7,39,54,36,51,32,0,21,20,7,1,1,5,4,164,72,198,151,185,215,213,179,122,82,
+65,60,141,97,240,1,54,153,254,248,175,156,251,85,91,247,149,184,254,231,58,
+144,55,197,128,180,214,215,179,128,197,55,144,58,1,25,182,1,12,1,59,7,1,184,
+253,243,1,236,1,145,114,154,235,185,187,227,37,135,29,24,254,202,254,253,
+162,254,246,141,122,119,123,118,183,150,74,127,129,244,178,186,228,129,127,
+73,153,181,254,191,238,45,44,3,3,251,39,50,0,4,0,113,255,206,8,140,4,217,
+0,52,0,53,0,54,0,55,0,0,1,23,6,6,21,20,22,51,50,54,53,52,38,39,55,22,22,23,
+54,54,51,32,0,21,16,0,35,34,38,39,55,22,51,50,54,53,52,38,35,34,6,7,23,22,
+21,20,0,35,34,0,17,52,18,37,1,5,1,121,104,88,94,211,168,169,209,96,90,104,
+61,92,36,78,240,139,1,4,1,52,254,212,231,94,136,59,66,78,116,172,202,203,
+176,129,190,74,9,4,254,195,248,245,254,192,143,5,85,254,56,1,229,4,94,131,
+72,204,138,206,236,237,205,138,204,72,131,41,104,74,105,114,254,185,242,254,
+253,254,202,24,29,135,37,227,187,185,235,134,122,81,42,41,230,254,177,1,74,
+1,3,169,1,38,209,251,39,50,0,5,0,127,252,68,4,221,4,217,0,57,0,58,0,59,0,
+60,0,61,0,0,1,50,54,53,53,51,16,33,35,32,17,17,22,22,51,50,54,55,53,6,6,35,
+34,38,2,53,52,18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,50,54,55,23,17,
+6,4,35,34,38,39,17,20,22,51,19,1,5,7,3,0,117,110,183,254,92,152,254,92,121,
+236,139,86,158,71,65,158,92,163,249,143,142,250,163,174,1,15,51,144,51,184,
+117,171,198,196,173,117,184,51,144,101,254,252,135,84,158,71,110,119,82,2,
+53,253,253,190,252,215,113,102,27,254,123,1,133,2,61,72,77,37,34,148,47,49,
+143,1,10,164,161,1,7,141,183,151,73,129,129,233,181,192,232,129,127,74,254,
+52,66,82,29,26,254,156,100,113,8,2,251,39,154,185,0,6,0,100,255,206,8,160,
+4,217,0,67,0,75,0,76,0,77,0,78,0,79,0,0,0,23,7,38,38,53,52,54,51,50,22,23,
+54,54,51,50,4,18,21,20,0,35,34,38,39,16,0,37,38,38,35,34,6,7,6,7,21,22,22,
+21,20,4,35,34,36,39,55,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,
+35,34,6,21,0,54,53,6,6,7,22,51,5,33,1,19,1,80,26,141,23,32,252,213,166,207,
+47,69,213,146,194,1,16,130,254,213,250,62,114,47,1,45,1,8,35,197,166,117,
+178,73,2,203,132,112,254,240,255,197,254,248,53,144,47,198,125,183,164,121,
+127,25,10,93,139,133,166,144,151,5,70,202,178,233,4,10,24,2,189,251,178,1,
+108,58,3,23,29,78,32,70,48,125,159,76,59,59,76,169,254,251,139,243,254,186,
+22,16,1,41,1,93,24,123,154,72,70,178,57,10,40,139,100,153,166,161,146,73,
+122,111,104,91,69,107,147,90,78,72,86,83,61,253,72,223,189,17,215,178,2,131,
+4,217,250,245,0,4,0,109,255,206,8,138,4,217,0,68,0,69,0,70,0,71,0,0,37,22,
+51,50,54,53,52,38,35,34,6,7,23,22,21,20,2,7,39,54,54,53,52,38,35,34,6,21,
+20,30,2,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,46,2,53,52,36,51,50,22,
+23,54,54,51,32,0,21,16,0,35,34,38,39,19,1,5,5,153,78,115,172,202,204,174,
+133,192,74,12,7,153,114,104,89,95,219,159,178,186,55,167,51,124,114,78,100,
+61,102,35,57,31,35,41,129,103,49,1,37,241,143,247,94,82,241,148,1,7,1,49,
+254,213,231,94,136,59,243,254,59,1,219,168,37,227,187,191,231,144,127,69,
+45,54,169,254,208,75,131,71,205,137,208,235,158,121,64,115,147,99,70,76,137,
+57,65,105,41,35,43,29,53,105,111,138,78,190,240,110,131,118,123,254,184,241,
+254,253,254,202,24,29,4,184,251,39,50,0,0,6,0,113,252,38,8,96,4,217,0,40,
+0,84,0,85,0,86,0,87,0,88,0,0,1,54,54,51,50,0,17,20,2,7,39,54,54,53,52,38,
+35,34,6,21,21,35,53,52,2,35,34,6,21,20,22,23,7,38,2,53,16,0,51,50,22,3,52,
+38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,
+6,7,51,21,33,39,54,54,53,52,38,35,34,6,21,21,35,9,2,3,4,102,68,248,143,235,
+1,64,147,117,104,88,94,206,163,181,187,181,182,186,162,207,94,88,104,112,
+152,1,63,236,145,253,22,138,128,112,144,68,61,92,86,115,241,179,105,190,51,
+50,190,113,174,243,39,34,202,254,185,101,66,70,144,110,129,140,164,4,76,252,
+4,1,210,66,3,59,146,145,254,186,254,248,166,254,208,78,131,71,205,137,204,
+239,253,235,235,223,231,1,13,235,208,137,205,71,131,73,1,43,176,1,7,1,71,
+152,249,246,161,183,153,143,105,154,53,112,63,225,140,192,238,99,110,104,
+105,240,199,77,144,59,139,112,53,150,100,148,157,176,170,178,2,248,252,184,
+8,33,247,77,0,3,0,113,252,68,10,4,8,8,0,68,0,97,0,98,0,0,0,4,23,7,38,36,35,
+32,21,20,22,51,33,50,54,55,17,52,38,35,34,6,7,22,22,21,20,2,7,39,54,54,53,
+52,38,35,34,6,21,20,22,23,7,38,2,53,16,0,51,50,22,23,54,54,51,50,22,18,21,
+17,2,33,33,34,38,53,52,36,33,1,52,2,38,36,38,53,52,54,51,50,22,23,7,38,38,
+35,34,6,21,20,30,3,18,21,17,35,1,3,231,1,129,142,80,123,254,168,211,254,41,
+164,178,4,72,116,111,2,195,178,129,182,76,5,14,150,115,104,88,94,202,166,
+165,204,94,88,104,112,152,1,63,236,141,233,86,80,236,145,174,246,135,6,254,
+98,251,170,255,246,1,87,1,56,6,80,72,156,254,225,112,229,175,147,201,47,139,
+35,127,84,110,130,75,206,184,113,55,180,249,78,254,225,86,65,137,59,76,205,
+80,82,131,119,4,33,221,244,142,127,22,94,52,188,254,231,79,131,71,205,137,
+205,236,235,206,137,205,71,131,73,1,43,176,1,7,1,71,119,122,118,123,145,254,
+232,185,251,244,254,84,140,163,181,185,2,234,170,1,41,217,214,184,128,157,
+230,129,117,73,90,92,147,103,80,119,154,197,219,254,240,182,250,134,8,149,
+0,0,5,0,186,252,68,5,6,4,217,0,55,0,56,0,57,0,58,0,59,0,0,0,6,7,39,54,36,
+51,50,22,18,21,20,2,6,35,34,38,39,17,20,22,51,51,50,54,53,52,38,35,34,6,7,
+39,54,54,51,50,22,21,20,6,35,35,32,17,17,55,22,22,51,50,54,53,52,38,35,1,
+5,3,19,2,53,184,51,144,56,1,10,174,163,250,142,142,249,164,92,156,65,110,
+119,231,98,126,88,50,59,77,36,112,62,133,100,133,178,213,199,219,254,92,144,
+51,184,119,171,196,199,168,2,90,253,201,39,66,3,199,129,127,73,154,180,141,
+254,249,163,164,254,247,142,49,45,253,143,123,133,81,79,77,70,46,34,107,58,
+67,164,133,153,158,1,182,3,63,74,127,129,231,191,182,232,252,57,16,4,233,
+250,245,0,255,255,0,186,252,68,5,6,8,4,2,38,0,41,0,0,0,7,1,152,5,27,0,0,0,
+7,0,113,255,206,4,221,4,217,0,31,0,42,0,53,0,54,0,55,0,56,0,57,0,0,1,6,6,
+35,34,38,39,6,6,21,20,22,23,54,54,51,50,22,23,6,4,35,34,38,2,53,52,18,54,
+51,50,4,5,22,22,51,50,54,55,38,35,34,6,1,38,38,35,34,6,7,22,22,51,50,5,33,
+19,3,4,156,101,245,136,122,183,65,15,14,16,13,65,182,123,136,245,101,60,254,
+250,190,164,249,142,141,250,164,190,1,6,253,45,53,140,115,61,145,66,105,206,
+105,127,2,31,66,145,61,115,140,53,37,127,105,206,1,117,253,191,1,1,3,14,67,
+97,66,47,35,98,53,47,97,34,47,65,96,68,151,184,140,1,8,163,164,1,10,141,184,
+76,42,54,37,41,127,62,253,121,41,37,54,42,47,62,131,4,217,250,245,0,2,0,186,
+252,68,5,14,4,217,0,64,0,65,0,0,36,54,54,53,52,38,35,34,6,7,39,54,54,51,50,
+22,21,20,6,6,21,20,22,51,50,54,54,53,52,38,35,34,6,21,17,20,22,51,50,54,55,
+51,20,14,2,35,34,0,17,17,16,0,51,50,22,18,21,20,2,6,35,34,38,53,19,2,143,
+48,98,33,35,37,49,22,117,41,104,92,95,125,55,91,21,24,50,122,84,206,173,178,
+203,204,175,168,209,4,174,89,148,187,141,248,254,217,1,35,252,168,254,143,
+104,202,132,80,121,76,229,95,105,54,29,47,51,51,59,86,100,116,97,56,108,109,
+44,20,29,101,197,134,191,235,247,210,252,138,214,243,227,182,106,218,142,
+80,1,73,1,13,3,110,1,3,1,83,141,254,250,166,123,254,248,182,98,90,4,49,0,
+1,0,186,252,68,10,92,8,6,0,83,0,0,1,34,6,21,17,20,22,51,33,50,54,53,17,6,
+35,34,38,39,6,6,35,34,36,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,36,
+51,32,0,21,20,7,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,0,17,20,7,
+17,16,33,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,2,86,119,110,110,119,
+6,61,119,111,137,204,148,241,82,88,237,144,175,254,242,60,143,53,189,122,
+170,205,205,170,122,189,53,143,55,1,15,178,1,7,1,46,19,78,188,133,173,205,
+204,170,116,78,66,59,136,94,231,1,44,45,254,92,249,211,254,92,1,164,6,45,
+1,164,182,111,119,7,113,133,123,247,104,123,133,133,123,2,117,98,122,119,
+123,118,178,155,74,127,129,242,180,185,229,129,127,73,152,182,254,188,235,
+72,86,129,139,231,189,186,228,37,135,29,24,254,202,254,253,131,109,252,197,
+254,74,1,182,8,86,1,182,254,74,60,93,123,133,0,255,255,0,113,252,68,19,47,
+8,6,0,38,1,154,0,0,0,39,0,45,4,246,0,0,0,39,1,150,15,188,0,0,0,7,1,163,20,
+70,0,0,0,1,0,186,252,70,6,152,8,6,0,31,0,0,1,34,6,21,17,20,22,51,33,50,54,
+53,17,51,17,16,33,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,2,86,119,108,
+108,119,2,166,117,112,183,254,90,253,108,254,92,1,164,2,148,1,166,183,112,
+117,7,115,135,121,247,104,123,135,135,123,3,94,252,195,254,74,1,182,8,84,
+1,182,254,74,60,95,121,135,0,4,251,238,252,154,254,221,255,206,0,11,0,23,
+0,24,0,25,0,0,0,6,35,34,38,53,52,54,51,50,22,21,4,22,51,50,54,53,52,38,35,
+34,6,21,19,51,254,221,203,178,168,202,203,171,178,199,253,178,117,98,93,118,
+112,99,100,115,215,180,253,122,224,221,164,164,221,233,161,100,137,132,103,
+111,145,141,111,1,186,0,0,4,0,102,255,206,12,59,4,217,0,79,0,80,0,81,0,82,
+0,0,1,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,0,17,20,0,33,34,38,39,
+6,6,35,34,38,39,6,6,35,34,36,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,
+36,51,32,0,21,20,7,7,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,0,17,
+20,6,1,1,5,8,100,78,190,141,180,208,213,174,120,81,66,61,139,96,237,1,51,
+254,202,254,244,152,246,83,91,246,149,158,247,82,90,243,147,182,254,235,58,
+144,54,194,126,179,208,212,175,126,194,54,144,57,1,20,182,1,8,1,56,7,11,78,
+194,142,178,213,209,177,121,81,65,60,139,96,238,1,51,15,1,172,252,30,3,192,
+1,145,127,141,234,186,190,224,37,135,29,24,254,202,254,253,239,254,182,122,
+119,123,118,124,117,123,118,181,152,74,127,129,229,193,185,229,129,127,73,
+152,182,254,186,245,35,43,68,127,141,231,189,187,227,37,135,29,24,254,200,
+254,255,41,80,3,45,251,39,50,0,2,0,113,255,236,4,199,4,94,0,11,0,23,0,0,18,
+0,33,32,0,21,20,0,33,34,0,53,36,38,35,34,6,21,20,22,51,50,54,53,113,1,42,
+1,1,1,0,1,43,254,211,254,252,250,254,213,3,155,198,168,171,200,207,162,166,
+202,3,21,1,73,254,182,239,236,254,179,1,67,246,185,233,232,190,189,225,230,
+184,0,0,5,0,113,255,206,4,195,4,217,0,27,0,28,0,29,0,30,0,31,0,0,0,6,7,39,
+54,36,51,50,22,18,21,20,2,6,35,34,36,39,55,22,22,51,50,54,53,52,38,35,1,33,
+19,3,1,236,185,51,143,53,1,11,175,164,249,142,142,249,164,175,254,246,54,
+143,51,185,118,171,196,199,168,2,97,253,156,1,1,3,199,129,127,73,152,182,
+140,254,248,163,163,254,245,141,182,151,74,127,129,228,194,185,229,252,57,
+4,217,250,245,0,0,1,0,88,252,68,4,172,4,74,0,17,0,0,1,17,16,0,35,34,0,53,
+53,51,21,20,22,51,50,54,53,17,4,172,254,211,252,247,254,204,174,217,166,174,
+203,4,74,250,100,254,223,254,183,1,56,238,5,9,173,230,240,229,5,162,0,1,0,
+102,252,68,4,129,4,94,0,33,0,0,0,6,7,39,54,36,51,50,22,18,21,20,2,6,35,34,
+39,7,22,22,23,1,35,1,55,22,22,51,50,54,53,52,38,35,1,225,184,51,144,56,1,
+10,174,163,250,142,142,249,164,80,74,4,60,119,12,1,90,199,253,92,144,51,184,
+119,169,198,201,166,3,199,129,127,73,154,180,141,254,249,163,164,254,247,
+142,28,2,89,210,20,253,125,4,245,74,127,129,227,195,186,228,0,0,1,0,113,252,
+68,4,139,4,94,0,36,0,0,36,54,55,23,1,35,1,54,54,55,55,54,55,39,6,35,34,38,
+2,53,52,18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,3,16,185,51,143,253,
+92,198,1,90,18,47,27,52,24,22,4,73,80,164,249,142,142,249,164,175,1,11,53,
+143,51,185,118,168,199,196,171,131,129,127,74,251,11,2,131,33,85,45,85,40,
+31,2,28,141,1,11,163,163,1,8,140,185,149,73,127,129,229,185,194,228,0,0,2,
+0,88,252,68,4,172,4,94,0,40,0,52,0,0,0,0,21,17,16,0,35,34,0,53,53,51,21,20,
+22,51,50,54,53,17,52,38,35,34,6,7,54,54,51,50,22,21,20,6,35,34,38,53,52,0,
+51,2,54,53,52,38,35,34,6,21,20,22,51,3,146,1,26,254,211,252,253,254,210,174,
+212,171,174,203,187,173,115,174,47,18,72,37,114,166,176,131,141,172,1,59,
+236,177,86,86,61,59,86,86,59,4,94,254,191,248,252,137,254,223,254,183,1,58,
+236,5,9,174,229,240,229,3,127,192,232,98,89,17,12,156,122,124,169,182,150,
+244,1,40,253,35,86,59,62,86,86,62,59,86,0,1,0,186,255,236,5,88,8,6,0,60,0,
+0,0,0,33,32,0,17,17,16,0,33,50,4,22,21,21,35,53,52,38,35,34,6,21,17,20,22,
+51,50,54,53,52,38,35,34,6,35,34,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,
+20,22,51,50,54,51,50,22,21,5,88,254,199,254,229,254,230,254,208,1,55,1,19,
+209,1,13,118,174,222,194,192,226,221,203,183,227,29,35,54,174,77,137,162,
+156,145,74,119,45,125,16,60,26,66,72,80,58,55,180,78,104,113,1,34,254,202,
+1,74,1,12,3,90,1,40,1,66,164,247,138,6,10,171,231,230,245,252,174,226,237,
+221,174,29,51,59,166,131,115,169,51,65,66,23,22,90,57,72,88,69,126,97,0,0,
+1,0,102,252,68,4,186,4,94,0,42,0,0,1,6,6,35,34,38,53,52,54,55,19,54,0,53,
+52,38,35,34,6,7,20,22,23,7,38,2,53,16,0,33,50,0,21,20,2,0,6,21,20,22,51,50,
+55,4,10,57,141,104,159,168,87,49,211,14,1,14,208,169,166,216,2,109,61,86,
+88,169,1,42,1,1,239,1,58,132,254,155,140,85,75,113,51,252,240,97,75,181,140,
+96,206,67,1,35,21,1,115,189,156,213,241,218,141,193,36,109,33,1,9,180,1,21,
+1,70,254,225,235,122,254,228,254,47,246,110,95,93,127,0,0,2,0,113,255,233,
+4,199,4,94,0,27,0,39,0,0,1,22,22,21,20,2,7,7,38,2,53,16,0,51,50,0,17,20,2,
+7,39,54,54,53,52,38,35,34,7,6,6,21,20,22,23,54,54,53,52,38,2,0,74,92,140,
+126,2,141,156,1,63,236,234,1,65,151,114,104,88,94,206,162,80,199,53,57,59,
+51,49,74,57,3,166,72,199,137,144,254,238,126,5,83,1,43,169,1,7,1,71,254,186,
+254,248,168,254,207,75,131,71,205,137,207,236,117,57,164,105,98,160,63,67,
+158,96,88,176,0,0,1,0,186,252,68,5,88,4,94,0,61,0,0,0,6,21,20,22,51,50,54,
+55,23,6,6,35,34,38,53,52,54,51,50,22,51,50,54,53,52,38,35,34,6,21,17,20,22,
+51,50,54,53,53,51,21,20,6,4,35,32,0,17,17,16,0,33,32,0,21,20,6,35,34,38,38,
+35,3,12,80,72,66,26,60,16,125,45,119,74,148,153,161,138,76,173,56,35,29,229,
+181,206,218,226,192,194,222,174,119,254,244,209,254,234,254,204,1,46,1,28,
+1,25,1,59,112,105,60,88,121,44,1,166,88,72,57,90,22,23,66,65,52,172,113,129,
+168,59,51,29,176,219,241,222,252,174,246,229,230,171,11,7,138,247,163,1,67,
+1,39,3,90,1,10,1,76,254,200,231,94,129,28,42,0,1,0,186,0,0,1,111,4,74,0,3,
+0,0,1,17,35,17,1,111,181,4,74,251,182,4,74,0,255,255,0,186,0,0,2,248,4,74,
+0,38,0,60,0,0,0,7,0,60,1,137,0,0,0,2,0,188,252,68,4,215,8,4,0,70,0,90,0,0,
+0,22,23,7,38,35,34,6,21,20,22,51,51,50,54,53,17,6,6,35,34,36,39,17,55,22,
+22,51,50,54,53,52,38,35,34,6,7,39,54,36,51,50,22,18,21,20,2,6,35,34,38,39,
+21,22,22,51,50,54,63,2,17,16,33,35,34,38,53,52,54,51,1,38,38,35,34,6,21,20,
+22,23,7,38,38,53,52,54,51,50,22,23,2,23,116,62,103,69,70,47,62,93,118,197,
+119,110,73,158,82,137,254,252,101,144,51,184,119,169,198,201,166,119,184,
+51,144,56,1,10,174,163,250,142,142,249,164,92,158,65,71,160,86,121,240,98,
+8,27,254,92,244,153,175,144,117,2,120,32,103,63,101,110,98,64,91,104,131,
+211,162,104,166,47,254,70,58,65,105,78,55,41,60,59,133,123,1,16,28,29,92,
+74,1,227,74,127,129,227,195,186,228,129,127,73,154,180,141,254,249,163,164,
+254,247,142,49,47,176,41,43,86,71,7,20,253,250,254,74,148,114,108,144,8,190,
+55,64,139,99,109,136,43,107,57,203,135,173,202,86,80,0,3,0,113,252,68,6,104,
+8,8,0,51,0,77,0,86,0,0,1,52,2,38,36,38,53,52,54,51,50,22,23,7,38,38,35,34,
+6,21,20,4,18,18,17,17,16,33,33,34,38,53,52,54,51,50,22,23,7,38,38,35,34,6,
+21,20,22,51,33,50,54,53,1,52,38,35,34,6,7,4,0,17,6,6,35,34,0,53,52,18,54,
+51,50,22,18,21,17,35,1,38,38,39,20,22,51,50,54,5,180,72,157,254,227,112,229,
+174,147,201,47,139,35,127,84,107,132,1,35,229,112,254,95,253,69,196,215,178,
+133,99,132,64,113,36,75,61,49,88,123,100,2,199,119,110,254,94,201,171,142,
+180,33,1,10,1,48,47,115,61,250,254,213,143,247,165,164,248,143,181,254,185,
+8,233,175,203,166,12,22,1,203,170,1,41,218,212,184,129,159,228,129,117,73,
+90,92,144,106,146,210,254,245,254,170,254,254,252,60,254,74,157,154,133,164,
+67,58,107,34,46,70,77,78,82,133,123,4,72,186,236,154,125,24,254,166,254,212,
+16,22,1,67,246,163,1,10,140,141,254,245,161,251,184,2,168,179,215,16,190,
+222,2,0,2,0,113,252,68,4,139,4,217,0,30,0,31,0,0,1,17,6,6,35,34,38,2,53,52,
+18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,50,54,55,23,17,1,3,215,65,158,
+92,164,249,142,142,249,164,175,1,11,53,143,51,185,118,168,199,196,171,118,
+185,51,143,254,17,252,68,4,8,47,49,141,1,11,163,163,1,8,140,185,149,73,127,
+129,229,185,194,228,129,127,74,251,11,8,149,0,0,4,0,113,255,236,8,94,8,6,
+0,46,0,72,0,83,0,94,0,0,1,6,6,35,34,38,39,6,6,21,20,22,23,54,54,51,50,22,
+23,6,4,35,34,38,2,53,52,18,54,51,50,22,23,54,54,51,50,22,21,17,35,17,52,38,
+35,34,6,5,16,2,36,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,30,2,18,17,17,
+35,1,22,22,51,50,54,55,38,35,34,6,1,38,38,35,34,6,7,22,22,51,50,4,156,101,
+245,136,122,183,65,15,14,16,13,65,182,123,136,245,101,60,254,250,190,164,
+249,142,141,250,164,129,204,72,41,148,102,170,190,180,92,92,59,109,3,2,149,
+254,187,153,228,163,154,201,47,133,72,180,100,134,103,244,184,102,180,249,
+227,53,140,115,61,145,66,105,206,105,127,2,31,66,145,61,115,140,53,37,127,
+105,206,3,14,67,97,66,47,35,98,53,47,97,34,47,65,96,68,151,184,140,1,8,163,
+164,1,10,141,90,78,78,90,209,168,253,27,2,231,101,123,84,209,1,9,1,9,158,
+197,141,149,205,131,117,69,182,132,83,95,121,120,187,254,216,254,248,253,
+147,3,90,42,54,37,41,127,62,253,121,41,37,54,42,47,62,0,0,5,0,113,255,206,
+4,232,4,217,0,26,0,27,0,28,0,29,0,41,0,0,5,38,2,53,16,0,51,50,4,18,21,20,
+2,7,39,54,54,53,52,38,35,34,6,21,20,22,23,19,19,23,18,22,21,20,6,35,34,38,
+53,52,54,51,1,121,112,152,1,72,245,149,1,7,158,151,114,104,88,94,216,167,
+171,216,94,88,199,2,3,60,73,75,54,53,72,71,54,20,73,1,43,176,1,6,1,72,139,
+254,241,180,168,254,207,75,131,71,205,137,207,236,237,206,137,205,71,4,106,
+251,39,50,2,210,64,73,72,68,66,74,73,64,0,5,0,113,255,206,4,247,4,217,0,25,
+0,26,0,27,0,28,0,40,0,0,1,22,18,21,16,0,35,34,0,17,52,18,55,23,6,6,21,20,
+22,51,50,54,53,52,38,39,39,19,7,18,22,21,20,6,35,34,38,53,52,54,51,3,222,
+129,152,254,182,249,251,254,184,143,121,104,88,94,217,176,177,215,102,96,
+201,3,3,60,73,75,54,53,72,71,54,4,94,85,254,212,164,254,252,254,183,1,74,
+1,3,169,1,38,86,131,72,204,138,203,239,240,202,138,204,72,254,251,39,50,2,
+241,64,73,72,68,66,74,73,64,0,4,0,113,255,206,4,232,4,217,0,45,0,46,0,47,
+0,48,0,0,1,6,6,21,20,22,51,50,54,53,52,38,39,39,38,38,53,52,54,51,50,22,23,
+7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,4,35,32,0,17,52,18,55,37,19,23,
+1,225,88,94,219,179,170,183,51,44,52,96,40,128,115,80,102,64,103,36,62,32,
+37,43,45,40,72,62,72,254,213,247,254,246,254,203,143,121,1,47,12,3,3,219,
+72,204,138,213,229,158,121,63,105,41,47,83,95,61,82,131,57,66,104,41,35,43,
+29,35,53,33,62,55,149,98,194,236,1,62,1,15,169,1,38,86,123,251,39,50,0,0,
+4,0,109,255,206,4,232,4,217,0,61,0,62,0,63,0,64,0,0,1,54,54,53,52,38,35,34,
+6,7,39,54,54,51,50,22,21,20,14,2,21,20,22,51,50,54,53,52,38,39,39,38,38,53,
+52,54,51,50,22,23,7,38,38,35,34,6,21,20,30,2,21,20,4,35,34,36,53,52,54,55,
+1,19,7,1,80,42,44,43,38,32,61,37,102,63,102,80,118,126,49,177,59,188,182,
+181,187,51,44,52,97,40,128,115,80,102,64,103,36,62,32,37,43,132,108,52,254,
+205,252,254,254,219,74,61,1,160,6,1,3,6,33,53,35,29,43,35,41,104,66,57,139,
+74,68,97,149,116,65,121,158,158,121,63,105,41,47,82,96,61,82,131,57,66,104,
+41,35,43,29,52,105,111,139,78,189,241,234,196,98,151,53,2,17,251,39,50,0,
+5,0,113,255,206,4,214,4,217,0,27,0,39,0,40,0,41,0,42,0,0,1,6,4,35,32,0,53,
+52,0,33,50,4,23,6,6,35,34,38,39,6,6,21,20,22,51,50,54,55,3,38,38,35,34,6,
+7,22,22,51,50,54,1,3,23,4,196,54,254,231,187,254,246,254,193,1,60,1,13,199,
+1,38,47,159,230,115,129,212,79,9,6,214,182,127,200,55,34,60,180,109,109,159,
+51,65,179,117,85,157,254,233,7,5,1,57,146,187,1,67,244,243,1,72,215,178,105,
+73,74,65,33,71,37,184,230,129,127,1,139,92,93,76,68,55,72,49,1,240,251,39,
+50,0,0,5,0,113,255,206,4,214,4,217,0,41,0,53,0,54,0,55,0,56,0,0,1,51,21,20,
+22,51,50,54,55,23,20,6,35,34,38,39,6,35,34,2,17,52,0,33,50,4,23,6,6,35,34,
+38,39,6,6,21,20,22,51,50,54,53,1,38,38,35,34,6,7,22,22,51,50,54,1,19,21,2,
+112,174,64,53,56,63,4,183,148,133,85,106,41,75,137,178,205,1,60,1,13,199,
+1,38,47,159,230,115,129,212,79,9,6,105,95,59,66,1,163,60,180,109,109,159,
+51,65,179,117,85,157,254,229,13,1,35,21,65,74,84,76,30,122,159,49,53,102,
+1,46,1,9,243,1,72,215,178,105,73,74,65,33,71,37,207,207,80,59,2,0,92,93,76,
+68,55,72,49,1,240,251,39,50,0,1,0,88,255,236,4,4,4,94,0,35,0,0,0,54,51,50,
+22,23,7,38,38,35,34,6,21,20,30,2,21,20,6,35,34,38,39,55,22,22,51,50,54,53,
+52,46,2,53,1,182,145,126,89,127,62,108,41,78,43,49,62,201,141,80,250,209,
+163,247,71,131,57,181,116,134,153,112,190,120,3,195,155,52,75,104,51,37,68,
+37,99,110,94,131,98,159,199,146,138,86,106,113,122,95,63,98,91,157,107,0,
+0,1,0,70,255,236,4,35,4,94,0,50,0,0,37,6,6,35,34,38,53,55,22,22,51,50,54,
+53,53,51,21,20,22,51,50,54,53,52,46,2,53,52,54,51,50,22,23,7,38,38,35,34,
+6,21,20,30,2,21,20,6,35,34,38,2,41,41,106,68,129,139,155,4,62,55,53,64,174,
+61,54,66,73,111,196,115,145,125,89,127,63,109,41,77,43,50,61,194,146,82,163,
+122,80,106,82,53,49,159,123,29,76,84,74,65,21,21,59,80,95,65,88,127,97,156,
+105,100,154,52,75,104,51,37,68,37,98,108,113,149,101,146,175,51,0,4,251,195,
+252,68,254,236,4,217,0,26,0,37,0,38,0,39,0,0,0,54,55,23,6,6,35,34,38,53,52,
+54,51,50,22,23,6,6,35,34,38,39,6,21,20,22,51,19,38,35,34,6,7,22,22,51,50,
+54,3,19,253,190,123,41,123,41,183,153,196,221,227,190,152,205,35,145,147,
+71,76,139,59,7,141,115,224,76,150,65,111,35,46,114,74,57,101,181,39,252,203,
+82,90,62,112,133,250,178,180,248,164,154,95,36,41,47,35,39,125,161,1,200,
+138,58,53,37,43,31,1,81,5,11,0,4,251,195,252,68,254,236,4,217,0,40,0,51,0,
+52,0,53,0,0,0,54,53,53,51,21,20,22,51,50,55,23,20,6,35,34,38,39,6,35,34,38,
+53,52,54,51,50,22,23,6,6,35,34,38,39,6,6,21,20,22,51,1,38,35,34,6,7,22,22,
+51,50,54,3,19,253,0,41,145,43,37,74,6,127,103,98,51,80,30,54,98,120,156,225,
+192,146,213,33,145,147,71,76,139,59,5,2,66,55,1,103,76,150,65,111,35,46,114,
+74,57,101,181,39,252,203,57,47,15,15,49,55,119,21,112,121,36,41,77,209,210,
+186,251,168,150,95,36,41,47,16,41,31,132,140,1,200,138,58,53,37,43,31,1,81,
+5,11,0,0,6,0,113,252,4,4,201,4,217,0,27,0,61,0,62,0,63,0,64,0,65,0,0,36,54,
+55,23,6,4,35,34,38,2,53,52,18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,1,
+6,6,35,34,38,53,52,54,54,53,52,38,35,34,6,7,35,54,54,51,50,22,21,20,6,6,21,
+20,22,51,50,54,55,1,1,3,19,3,16,185,51,143,53,254,245,175,164,249,142,142,
+249,164,175,1,11,53,143,51,185,118,168,199,196,171,1,47,31,86,39,108,115,
+72,151,82,57,66,80,10,164,4,171,141,135,172,67,156,53,29,18,33,16,1,66,253,
+223,12,13,131,129,127,74,149,184,141,1,11,163,163,1,8,140,185,149,73,127,
+129,229,185,194,228,251,227,20,14,114,78,67,116,139,77,58,71,79,62,120,159,
+157,116,67,115,149,56,37,28,8,10,3,37,252,54,8,163,247,43,0,0,7,0,113,252,
+68,6,55,4,217,0,28,0,62,0,74,0,75,0,76,0,77,0,78,0,0,1,17,6,35,34,38,2,53,
+52,18,36,51,50,22,22,21,20,6,21,20,22,51,51,17,51,17,16,33,32,19,38,35,34,
+6,21,20,22,51,50,55,23,6,7,17,20,22,51,50,54,53,17,35,34,38,53,6,6,35,34,
+38,53,52,54,18,54,53,52,38,35,34,6,21,20,22,51,9,2,51,2,250,41,53,164,249,
+142,129,1,4,186,190,237,99,8,70,82,51,182,254,97,254,98,14,47,43,175,212,
+196,171,147,105,108,37,45,113,121,118,113,88,123,131,25,63,35,110,150,51,
+254,66,66,47,47,66,66,47,1,47,253,213,253,221,192,254,86,1,158,8,141,1,11,
+163,144,1,7,160,109,158,79,49,102,25,66,43,2,99,250,10,253,240,7,125,6,227,
+187,194,228,100,122,33,27,254,19,174,189,189,174,3,14,121,98,14,13,138,106,
+64,94,254,244,65,47,47,66,66,47,47,65,253,104,4,217,250,245,0,0,7,0,113,255,
+206,4,244,4,217,0,13,0,25,0,37,0,49,0,50,0,51,0,52,0,0,18,0,33,50,4,18,21,
+20,2,4,35,32,0,53,36,38,35,34,6,21,20,22,51,50,54,53,36,22,21,20,6,35,34,
+38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,3,3,23,113,1,57,1,8,170,
+1,3,149,152,254,251,171,254,251,254,202,3,200,211,177,180,214,220,172,176,
+214,254,218,129,129,98,101,123,123,101,49,61,61,47,47,62,55,54,1,9,4,3,24,
+1,70,140,254,243,160,159,254,241,139,1,69,244,186,232,231,191,189,225,230,
+184,231,114,101,104,115,113,104,103,114,254,187,57,51,51,58,58,51,51,57,3,
+22,251,39,50,0,0,5,0,113,252,46,4,199,4,217,0,59,0,70,0,71,0,72,0,73,0,0,
+1,54,53,52,38,39,55,22,18,21,20,6,7,17,2,33,35,34,38,53,52,54,51,50,22,23,
+7,38,38,35,34,6,21,20,22,51,51,50,54,55,17,6,35,34,0,17,52,18,55,23,6,6,21,
+20,23,54,54,51,50,22,23,38,38,35,34,6,7,22,51,50,54,3,19,19,4,0,12,94,88,
+104,124,141,31,29,6,254,98,198,199,213,178,133,100,133,62,112,36,77,59,49,
+89,125,99,213,116,111,2,141,174,239,254,196,143,121,104,88,94,12,71,177,113,
+106,174,17,62,149,86,84,156,63,100,199,98,154,252,2,5,1,184,62,71,138,204,
+72,131,88,254,212,161,82,141,59,252,209,254,84,158,153,133,164,67,58,107,
+34,46,70,77,79,81,131,119,2,119,94,1,73,1,4,169,1,38,86,131,72,204,138,73,
+64,61,76,73,203,61,70,72,63,162,84,251,109,8,149,247,85,0,3,251,119,252,68,
+255,47,255,206,0,19,0,28,0,29,0,0,5,17,22,22,23,7,38,38,39,21,20,6,35,34,
+38,53,52,54,55,17,17,53,6,6,21,20,22,51,50,19,253,227,113,177,42,86,35,128,
+83,164,147,139,170,228,212,133,129,84,47,131,86,82,254,232,23,80,29,122,24,
+65,21,127,158,165,158,124,144,175,7,1,10,253,197,166,5,104,86,69,66,2,255,
+0,0,2,251,160,252,68,255,88,255,206,0,25,0,26,0,0,1,51,17,51,17,38,38,35,
+35,6,6,21,20,33,50,54,55,23,6,4,35,34,38,53,52,54,1,253,41,6,180,34,82,41,
+13,126,105,1,29,101,201,101,86,107,254,252,139,215,231,209,1,22,254,164,1,
+10,254,90,6,11,5,94,69,162,61,68,123,66,79,163,148,131,166,1,42,0,0,2,251,
+199,252,68,254,250,255,206,0,5,0,6,0,0,5,51,1,33,21,33,1,253,166,176,254,
+111,2,53,252,205,1,139,100,253,51,139,3,138,0,6,0,73,252,68,4,201,4,217,0,
+30,0,39,0,40,0,41,0,42,0,43,0,0,1,33,17,34,6,35,34,0,53,52,18,54,51,50,22,
+18,21,17,35,17,52,38,35,34,6,7,4,0,17,17,33,1,38,38,39,20,22,51,50,54,5,1,
+1,51,1,205,1,0,15,26,14,251,254,214,143,249,165,163,249,143,183,204,166,146,
+178,33,1,13,1,57,254,76,1,0,8,231,179,199,172,10,22,1,250,253,230,253,171,
+192,252,207,3,31,2,1,68,247,162,1,9,140,141,254,246,160,250,29,5,221,187,
+237,156,125,24,254,163,254,215,252,50,4,65,179,214,17,189,223,2,133,4,217,
+250,245,0,3,0,63,0,0,1,246,4,240,0,5,0,6,0,7,0,0,33,35,17,33,53,33,3,17,1,
+246,180,254,253,1,183,90,3,191,139,251,182,4,240,0,0,3,0,186,252,68,4,215,
+4,217,0,30,0,31,0,32,0,0,19,17,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,
+36,51,50,22,18,21,20,2,6,35,34,38,39,17,1,1,186,144,51,184,119,172,197,199,
+170,119,184,51,144,56,1,10,174,163,249,145,145,249,163,92,156,63,2,232,254,
+79,252,68,4,245,74,127,129,230,194,182,232,129,129,73,154,180,141,254,246,
+158,161,254,243,143,49,45,251,250,3,138,5,11,0,0,3,0,63,0,0,2,246,4,240,0,
+7,0,8,0,9,0,0,33,33,17,33,53,33,17,33,5,17,2,246,254,76,254,253,1,183,1,0,
+254,166,3,191,139,252,65,139,4,240,0,4,0,157,255,206,4,239,4,217,0,27,0,28,
+0,29,0,30,0,0,1,20,2,4,35,34,36,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,
+54,36,51,50,4,18,1,19,3,4,239,126,254,247,194,184,254,230,55,143,55,199,127,
+174,222,214,182,127,199,55,143,55,1,26,184,193,1,11,125,253,182,1,1,2,39,
+150,254,251,160,184,149,74,127,129,241,181,184,230,129,127,73,149,185,166,
+255,0,253,72,4,217,250,245,0,4,0,113,252,68,4,220,4,217,0,29,0,30,0,31,0,
+32,0,0,0,39,55,22,18,21,20,0,7,17,33,53,33,17,38,0,53,52,18,55,23,6,6,21,
+20,22,51,50,54,53,19,53,1,4,12,182,107,124,140,254,245,194,254,74,1,2,209,
+254,250,146,118,104,88,94,205,166,164,202,208,253,194,3,78,141,131,88,254,
+213,162,240,254,200,29,252,80,139,3,35,30,1,59,238,173,1,40,80,131,69,205,
+140,204,238,235,207,253,145,50,4,217,0,0,3,0,96,255,206,2,190,4,74,0,14,0,
+26,0,27,0,0,1,20,6,35,34,38,53,52,54,51,50,22,23,17,51,0,6,21,20,22,51,50,
+54,53,52,38,35,3,2,190,162,145,135,164,166,129,47,78,29,157,254,146,82,76,
+69,67,79,84,62,4,1,41,157,163,152,139,138,153,20,23,2,70,253,84,78,68,67,
+78,79,66,68,78,254,48,0,4,0,63,0,0,2,106,6,231,0,11,0,23,0,29,0,30,0,0,0,
+38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,19,33,53,
+33,17,51,3,1,33,123,123,100,98,131,129,100,45,61,57,51,49,62,64,47,111,254,
+73,1,3,180,78,5,53,115,104,101,114,114,101,104,115,1,70,57,50,51,59,59,51,
+50,57,249,133,139,3,191,251,182,0,2,0,109,255,206,2,246,4,94,0,39,0,40,0,
+0,36,54,55,23,6,6,35,34,38,53,52,54,55,55,54,54,53,52,38,35,34,6,7,39,54,
+54,51,50,22,21,20,6,7,7,6,6,21,20,22,51,7,1,227,99,53,106,70,148,101,136,
+177,83,107,143,88,60,90,64,51,102,52,106,71,154,94,145,169,97,92,145,59,89,
+91,61,6,119,43,59,104,83,61,160,127,98,145,60,84,51,95,51,53,80,45,60,105,
+85,56,167,113,116,139,53,81,35,92,66,59,78,169,0,0,2,0,96,255,206,2,190,4,
+74,0,15,0,16,0,0,1,51,17,20,6,35,34,38,53,51,20,22,51,50,54,53,3,2,33,157,
+162,145,135,164,158,76,69,66,80,150,4,74,252,223,157,163,152,139,67,78,86,
+98,254,155,0,2,0,96,0,0,2,190,4,94,0,15,0,16,0,0,1,52,38,35,34,6,21,35,52,
+54,51,50,22,21,17,35,51,2,33,80,66,69,76,158,164,135,144,163,157,79,3,20,
+98,86,78,67,141,150,162,156,252,224,0,2,0,186,255,206,3,25,4,74,0,15,0,16,
+0,0,1,20,22,51,50,54,53,51,20,6,35,34,38,53,17,51,19,1,88,80,65,72,76,156,
+164,135,146,162,158,150,1,51,98,86,78,67,139,152,165,155,3,33,251,132,0,2,
+0,109,255,206,2,246,4,94,0,39,0,40,0,0,1,23,22,22,21,20,6,35,34,38,39,55,
+22,22,51,50,54,53,52,38,39,39,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,
+21,20,22,19,1,168,119,112,103,173,141,96,153,70,106,52,102,51,64,90,58,90,
+116,95,122,173,140,101,148,70,106,53,99,55,61,91,89,79,2,133,67,66,145,95,
+129,170,60,84,104,59,43,78,53,51,94,51,68,53,142,114,133,162,58,83,105,60,
+45,80,59,66,92,253,38,0,4,0,113,255,206,9,150,4,217,0,74,0,75,0,76,0,77,0,
+0,5,38,2,53,16,0,51,50,22,23,54,51,50,22,23,54,54,51,50,22,18,21,16,0,35,
+34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,22,22,21,20,2,7,39,54,54,53,
+52,38,35,34,7,22,22,21,20,2,7,39,54,54,53,52,38,35,34,6,21,20,22,23,1,1,5,
+1,121,112,152,1,36,212,65,129,55,113,141,128,211,78,71,214,131,166,229,106,
+254,249,207,83,120,52,65,34,80,46,142,172,173,146,113,158,66,4,15,143,105,
+107,82,84,181,144,69,60,60,70,148,116,107,90,92,175,138,139,178,94,88,5,192,
+253,93,2,193,20,73,1,43,176,1,10,1,68,35,34,69,119,122,118,123,169,254,255,
+141,254,255,254,198,24,29,135,18,19,222,192,189,233,144,127,14,102,52,196,
+254,239,79,131,71,205,137,215,228,29,74,207,129,167,254,211,80,131,71,205,
+137,215,230,234,211,137,205,71,4,106,251,39,50,0,5,0,113,252,68,8,141,4,217,
+0,58,0,59,0,60,0,61,0,62,0,0,4,0,17,52,18,55,23,6,6,21,20,22,51,50,54,53,
+52,38,39,55,22,22,23,54,54,51,50,22,18,21,20,2,7,17,33,53,33,17,38,38,39,
+55,22,51,50,54,53,52,38,35,34,6,7,23,22,21,20,0,35,37,1,1,23,1,173,254,196,
+143,121,104,88,94,205,164,165,203,94,88,104,60,90,35,76,235,135,165,247,143,
+215,182,254,74,1,2,72,106,48,66,76,112,165,198,197,170,125,184,72,9,4,254,
+202,245,5,241,253,170,252,98,4,20,1,73,1,4,169,1,38,86,131,72,204,138,205,
+237,239,203,138,204,72,131,41,104,74,105,114,140,254,246,163,224,254,221,
+40,252,74,139,3,31,4,24,23,135,37,225,189,186,234,134,122,81,42,41,229,254,
+176,20,4,217,251,39,50,0,0,4,0,109,252,68,8,98,4,217,0,74,0,75,0,76,0,77,
+0,0,1,54,54,51,50,0,17,20,2,7,17,33,53,33,17,38,38,39,6,6,35,34,36,53,52,
+54,55,55,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,21,20,22,51,
+50,54,53,16,39,55,22,18,21,20,6,7,22,22,51,50,54,53,52,38,35,34,6,7,19,1,
+7,5,63,58,133,92,227,1,37,238,206,254,74,1,2,123,205,64,97,237,143,237,254,
+225,70,59,70,39,43,41,35,31,57,35,102,61,100,78,113,127,165,110,181,176,158,
+208,182,107,124,140,8,11,75,196,116,169,200,209,158,53,94,39,201,252,69,5,
+4,43,29,22,254,203,254,254,209,254,191,31,252,78,139,3,33,12,127,98,135,106,
+240,190,99,150,53,62,33,53,35,29,45,37,39,102,66,57,133,80,122,142,134,97,
+121,158,241,201,1,17,141,131,88,254,213,162,34,93,41,134,136,234,190,194,
+220,21,16,1,53,251,39,50,0,0,5,251,113,5,71,255,133,7,43,0,11,0,23,0,35,0,
+47,0,48,0,0,0,38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,
+38,35,0,38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,
+1,254,61,122,121,102,98,129,127,100,45,62,56,53,47,61,61,47,253,74,125,125,
+100,98,129,129,98,45,64,58,53,47,62,62,47,1,57,5,123,113,104,99,116,115,98,
+106,113,1,67,55,51,51,60,60,51,51,55,254,189,113,104,100,115,115,98,106,113,
+1,67,55,51,51,60,60,51,51,55,254,137,0,0,2,252,27,4,217,254,238,8,4,0,25,
+0,26,0,0,0,54,55,23,6,6,35,34,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,
+20,22,51,23,253,213,117,30,134,43,189,117,172,202,207,172,120,176,41,131,
+28,113,70,98,113,107,98,2,5,139,72,78,64,104,119,221,164,162,223,117,104,
+68,78,74,139,105,110,142,178,0,2,251,100,4,217,255,199,7,152,0,5,0,6,0,0,
+3,7,1,1,39,1,3,57,103,254,54,254,51,101,2,50,9,5,117,115,1,191,254,65,115,
+2,35,253,65,0,0,2,251,100,4,217,255,199,7,152,0,5,0,6,0,0,1,1,55,1,1,23,1,
+253,150,253,206,101,1,205,1,202,103,253,198,5,2,2,35,115,254,65,1,191,115,
+253,180,0,0,4,0,113,255,206,4,233,4,217,0,40,0,41,0,42,0,43,0,0,37,54,54,
+53,52,38,35,34,6,21,20,30,2,21,20,6,35,34,38,39,55,22,51,50,54,53,52,46,2,
+53,52,36,51,50,0,17,20,2,7,1,19,21,3,111,93,98,213,171,181,188,63,170,52,
+127,117,80,102,63,102,72,61,37,41,129,111,53,1,36,255,236,1,85,155,116,254,
+204,20,111,71,205,137,206,239,158,123,68,119,137,100,71,75,138,57,65,105,
+76,43,29,52,102,114,139,78,191,239,254,189,254,245,168,254,207,75,4,237,251,
+39,50,0,5,0,96,255,206,4,248,4,217,0,40,0,52,0,53,0,54,0,55,0,0,19,54,54,
+51,50,22,23,54,53,52,38,35,34,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,
+50,54,54,51,50,0,21,16,0,33,34,36,55,22,22,51,50,54,55,38,38,35,34,6,1,3,
+23,96,143,254,135,137,224,83,16,152,120,115,154,122,94,84,151,58,65,105,39,
+37,56,37,65,152,148,97,206,1,7,254,188,254,224,200,254,205,140,63,193,118,
+117,171,55,70,191,128,91,167,1,49,9,3,1,119,93,85,78,63,69,74,201,207,208,
+87,111,102,77,103,59,102,31,49,29,30,35,200,72,254,212,238,254,246,254,180,
+203,132,92,92,74,69,56,71,49,3,121,251,39,50,0,0,5,0,106,255,206,4,231,4,
+217,0,42,0,54,0,55,0,56,0,57,0,0,5,38,2,53,52,54,55,38,35,34,6,21,20,30,2,
+21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,46,2,53,52,36,51,50,0,17,20,2,
+39,54,54,53,52,38,39,6,6,21,20,22,3,3,7,3,189,143,144,93,69,71,78,184,189,
+58,176,55,128,119,80,103,63,102,37,61,34,37,44,130,113,52,1,38,255,248,1,
+76,168,127,59,70,68,59,63,65,57,215,4,1,17,92,1,4,176,140,213,74,31,158,123,
+66,113,145,103,67,77,137,57,65,105,40,35,43,29,53,101,112,139,79,192,238,
+254,186,254,249,174,254,218,130,66,166,102,111,164,57,65,181,100,109,145,
+3,216,251,39,50,0,0,5,0,113,255,206,8,144,4,217,0,39,0,51,0,52,0,53,0,54,
+0,0,0,55,55,38,38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,0,17,52,0,33,50,
+22,23,54,54,51,32,0,21,20,0,35,34,38,2,53,36,38,35,34,6,21,20,22,51,50,54,
+53,1,1,5,4,33,8,11,76,186,137,173,205,198,165,110,78,65,57,133,92,228,254,
+220,1,51,1,5,148,241,81,88,239,144,1,8,1,50,254,202,253,168,254,150,3,181,
+209,176,170,205,206,171,172,211,254,126,254,37,1,227,2,72,44,68,125,144,231,
+189,189,225,37,135,29,24,1,56,1,3,242,1,69,123,118,122,119,254,185,240,250,
+254,191,138,1,12,155,195,233,235,189,185,229,231,183,2,184,251,39,50,0,0,
+6,0,113,255,206,8,145,4,217,0,36,0,44,0,56,0,57,0,58,0,59,0,0,1,54,54,51,
+50,0,21,20,0,35,32,0,53,52,55,55,38,38,35,34,6,7,4,0,17,6,6,35,34,0,53,52,
+18,36,51,50,22,1,38,38,39,20,22,51,50,0,38,35,34,6,21,20,22,51,50,54,53,1,
+1,5,4,141,87,238,144,252,1,51,254,207,250,254,253,254,204,7,11,74,183,134,
+153,193,35,1,8,1,54,47,116,62,254,254,213,156,1,9,176,140,234,254,149,4,236,
+182,198,188,26,5,16,206,169,170,203,205,170,162,211,254,136,254,46,1,216,
+3,109,122,119,254,189,244,248,254,189,1,70,235,43,44,68,125,144,154,123,24,
+254,167,254,211,16,22,1,75,240,159,1,11,141,123,252,162,175,218,17,181,231,
+2,92,234,235,189,183,231,226,188,2,184,251,39,50,0,0,5,0,113,252,68,8,100,
+4,217,0,57,0,58,0,59,0,60,0,61,0,0,1,52,38,35,34,6,21,20,22,51,50,54,55,23,
+6,6,35,34,0,53,52,18,54,51,50,0,21,20,22,51,50,54,53,52,38,35,34,6,7,39,54,
+54,51,50,22,18,21,20,2,6,35,34,38,39,17,33,21,33,1,33,1,1,4,20,193,179,169,
+204,198,162,29,62,26,62,38,95,60,238,254,218,123,251,183,251,1,48,202,175,
+163,197,196,164,52,74,30,64,50,104,84,165,242,121,144,244,165,125,188,57,
+1,0,254,75,4,56,251,254,2,1,2,1,2,33,197,227,227,197,184,230,10,11,140,11,
+21,1,63,252,146,1,6,159,254,199,246,195,233,234,190,179,235,15,10,137,21,
+16,167,254,248,136,160,254,241,140,83,68,252,76,139,3,188,4,217,250,245,0,
+0,6,0,113,255,206,8,146,4,217,0,37,0,45,0,57,0,58,0,59,0,60,0,0,37,16,0,37,
+38,38,35,34,6,7,23,22,21,20,2,6,35,34,0,53,52,0,33,50,22,23,54,54,51,50,4,
+18,21,20,0,35,34,38,1,6,6,7,22,51,50,54,0,38,35,34,6,21,20,22,51,50,54,53,
+1,1,5,5,136,1,51,1,8,35,193,156,134,182,75,12,7,148,251,166,252,254,211,1,
+47,1,2,143,232,87,81,242,138,196,1,14,131,254,208,251,62,116,2,35,184,234,
+4,10,25,183,204,252,60,202,168,174,201,209,166,166,204,2,34,254,67,1,238,
+18,1,43,1,91,24,123,154,144,125,68,44,43,156,254,245,138,1,67,248,242,1,69,
+119,122,118,123,169,254,252,138,245,254,186,22,2,29,17,217,176,2,227,1,119,
+234,230,192,187,227,231,183,2,184,251,39,50,0,0,6,0,94,255,206,8,124,4,217,
+0,55,0,67,0,79,0,80,0,81,0,82,0,0,1,54,54,51,50,4,23,7,38,38,35,34,6,21,20,
+23,54,54,51,50,4,23,6,4,35,34,38,39,6,6,35,34,36,39,54,36,51,50,22,23,54,
+54,53,52,38,35,34,6,7,39,54,36,51,50,22,23,1,22,22,51,50,54,55,38,38,35,34,
+6,5,22,22,51,50,54,55,38,38,35,34,6,1,1,5,4,113,80,250,157,184,1,30,61,146,
+55,201,129,184,215,6,86,203,122,161,1,6,107,55,254,215,196,166,247,76,61,
+243,191,195,254,216,55,108,1,3,163,122,203,84,4,4,217,185,126,201,56,145,
+58,1,28,186,194,239,61,252,182,58,181,110,124,177,47,79,192,95,100,162,3,
+148,50,173,125,110,180,61,69,165,100,94,192,1,8,254,25,1,236,3,86,142,122,
+178,156,73,129,129,233,181,51,43,43,51,108,72,192,203,129,137,113,153,204,
+191,72,108,51,43,22,45,27,182,232,129,129,73,152,182,151,113,253,229,92,92,
+98,86,39,56,52,43,86,98,92,92,43,52,56,3,119,251,39,50,0,0,5,0,109,255,206,
+8,122,4,217,0,71,0,83,0,84,0,85,0,86,0,0,1,54,54,53,52,38,35,34,6,7,39,54,
+54,51,50,22,21,20,6,7,7,6,6,21,20,22,51,50,54,53,16,39,55,22,22,23,54,54,
+51,50,4,23,7,38,38,35,34,6,21,20,23,54,54,51,50,22,23,6,4,35,34,38,39,6,6,
+35,34,36,53,52,54,55,1,22,22,51,50,54,55,38,38,35,34,6,19,1,5,1,83,42,44,
+44,38,33,61,38,102,63,103,80,118,130,45,93,53,49,50,189,184,171,212,192,107,
+60,99,39,61,221,174,177,1,23,59,145,54,191,124,173,208,6,81,194,121,154,250,
+106,50,254,224,192,166,250,58,81,245,168,250,254,219,74,62,4,20,45,168,117,
+106,170,59,65,156,96,90,183,246,254,47,1,218,3,6,33,53,35,29,45,37,39,102,
+66,57,134,79,62,99,76,49,45,101,63,121,158,234,208,1,17,141,131,43,131,80,
+111,143,178,156,73,129,129,228,184,47,49,43,51,108,72,188,207,145,127,133,
+139,237,193,98,151,53,254,115,86,98,92,92,43,52,56,3,119,251,39,50,0,0,6,
+0,109,252,68,8,119,4,217,0,73,0,85,0,86,0,87,0,88,0,89,0,0,18,54,55,55,54,
+54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,21,20,22,51,50,54,53,16,
+39,55,22,22,23,54,54,51,50,4,23,7,38,38,35,34,6,21,20,23,54,54,51,50,22,23,
+6,6,7,17,33,53,33,17,38,38,39,6,6,35,34,36,53,5,22,22,51,50,54,55,38,38,35,
+34,6,1,5,1,1,129,70,59,70,39,43,41,35,31,57,35,102,61,100,78,113,127,165,
+110,181,176,164,202,182,107,57,94,37,59,214,169,173,1,14,57,145,52,184,119,
+167,199,6,78,188,117,149,241,103,41,221,153,254,75,1,0,146,187,45,78,238,
+162,244,254,230,4,123,43,160,112,101,163,56,63,148,92,86,174,3,51,249,180,
+4,6,251,251,1,253,150,53,62,33,53,35,29,45,37,39,102,66,57,133,80,122,142,
+134,97,121,158,235,207,1,17,141,131,43,131,80,112,142,178,156,73,129,129,
+230,182,47,49,43,51,107,73,162,201,24,252,80,139,3,35,18,150,98,133,139,239,
+191,95,86,98,92,92,43,52,56,254,158,50,5,11,251,38,0,5,0,113,255,206,4,249,
+4,217,0,25,0,37,0,38,0,39,0,40,0,0,1,22,18,21,16,0,35,34,0,17,52,18,55,4,
+17,20,6,7,22,51,50,54,53,52,38,39,5,6,6,21,20,22,23,54,54,53,52,38,19,3,7,
+3,225,127,153,254,182,249,250,254,181,162,141,1,32,91,71,70,82,180,212,102,
+96,254,36,58,75,70,59,68,62,56,218,2,3,4,94,83,254,213,167,254,252,254,183,
+1,73,1,4,167,1,41,83,184,254,170,143,210,77,29,243,199,140,205,69,80,63,166,
+105,108,166,55,65,180,101,106,148,1,141,251,39,50,0,5,0,94,255,206,8,149,
+4,217,0,55,0,67,0,68,0,69,0,70,0,0,1,18,51,50,54,53,52,38,35,34,6,7,39,54,
+54,51,50,0,17,20,2,4,35,34,38,39,6,6,35,34,36,39,54,36,51,50,22,23,54,54,
+53,52,38,35,34,6,7,39,54,36,51,32,0,21,20,6,5,22,22,51,50,54,55,38,38,35,
+34,6,1,1,5,4,176,167,249,183,211,220,172,59,103,43,66,62,139,98,236,1,59,
+134,254,250,190,146,253,88,102,247,140,196,254,219,52,106,1,1,162,121,201,
+83,5,3,212,185,125,199,55,145,55,1,26,184,1,16,1,58,10,252,107,58,178,109,
+122,174,47,78,189,94,99,160,5,0,253,253,1,232,1,145,254,242,237,187,191,223,
+21,16,135,29,22,254,205,254,252,143,254,245,161,119,122,133,108,207,188,72,
+108,51,43,31,33,30,180,234,129,129,73,151,183,254,196,243,41,76,127,92,92,
+98,86,39,56,52,3,115,251,39,50,0,0,6,0,113,252,68,5,65,4,217,0,25,0,31,0,
+32,0,33,0,34,0,35,0,0,0,22,23,7,38,2,53,16,0,51,50,0,17,20,2,7,39,54,54,53,
+52,38,35,34,6,21,19,33,17,51,17,33,1,33,3,1,1,43,94,88,104,112,152,1,66,235,
+234,1,65,148,116,107,90,92,205,161,163,208,41,1,0,180,254,76,3,237,253,121,
+28,2,63,1,131,205,71,131,73,1,43,176,1,9,1,69,254,186,254,248,167,254,211,
+80,131,71,205,137,215,230,235,210,250,195,2,223,252,150,3,188,4,217,250,245,
+0,3,252,125,252,63,255,125,255,206,0,19,0,20,0,21,0,0,3,6,6,35,34,38,53,52,
+54,55,23,6,6,21,20,22,51,50,54,55,3,19,131,53,181,116,176,242,150,114,100,
+85,115,142,114,73,121,37,246,3,252,250,90,97,221,185,159,235,61,121,61,156,
+121,111,151,73,66,2,120,252,123,0,0,2,0,63,252,68,1,246,4,240,0,5,0,6,0,0,
+1,35,17,33,53,33,39,1,246,180,254,253,1,183,192,252,68,7,123,139,166,0,0,
+1,0,100,255,236,4,119,4,94,0,40,0,0,1,21,35,34,6,21,20,22,51,50,54,55,23,
+6,4,35,32,36,53,52,54,55,53,38,38,53,52,54,51,32,23,7,38,38,35,34,6,21,20,
+22,51,2,43,27,127,120,161,187,123,200,47,144,52,254,249,199,254,254,254,241,
+129,115,105,100,244,227,1,121,119,137,47,170,123,155,152,112,111,2,133,147,
+107,67,93,104,111,122,71,147,162,169,150,108,140,31,12,31,118,88,137,154,
+233,76,92,72,84,84,64,96,0,2,252,41,4,217,254,233,8,6,0,40,0,41,0,0,1,21,
+35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,55,53,38,38,53,52,54,
+51,32,23,7,38,38,35,34,6,21,20,22,51,19,253,139,37,69,84,100,84,80,121,33,
+122,36,193,119,192,164,98,66,54,85,151,170,1,0,78,119,29,104,78,72,88,88,
+68,10,6,215,133,55,47,58,45,66,73,61,109,100,127,102,74,86,17,8,16,72,71,
+82,117,160,69,53,43,37,51,43,39,254,2,0,0,3,252,240,4,217,255,10,8,6,0,15,
+0,27,0,28,0,0,1,7,35,55,35,34,38,53,52,54,51,50,22,21,20,6,0,6,21,20,22,51,
+50,54,53,52,38,35,3,254,176,182,180,194,12,119,149,150,114,119,155,32,254,
+215,68,72,59,59,70,72,57,115,5,244,242,252,135,127,119,139,139,117,63,135,
+1,67,70,61,63,68,82,49,61,70,253,86,0,2,0,129,254,201,2,70,1,158,0,15,0,27,
+0,0,5,3,35,19,35,34,38,53,52,54,51,50,22,21,20,6,2,6,21,20,22,51,50,54,53,
+52,38,35,1,244,148,149,162,11,100,125,129,92,102,130,41,236,57,59,49,52,59,
+61,50,39,254,240,1,32,113,105,106,113,120,97,47,113,1,8,55,51,54,57,68,43,
+51,55,0,4,0,129,254,201,2,70,4,76,0,11,0,23,0,39,0,51,0,0,18,38,53,52,54,
+51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,19,3,35,19,35,34,38,
+53,52,54,51,50,22,21,20,6,2,6,21,20,22,51,50,54,53,52,38,35,252,123,123,100,
+99,129,129,99,45,61,55,53,49,60,62,47,146,148,149,162,11,100,125,129,92,102,
+130,41,236,57,59,49,52,59,61,50,2,154,112,105,102,115,115,100,107,112,1,67,
+57,49,54,57,57,54,49,57,251,252,254,240,1,32,113,105,106,113,120,97,47,113,
+1,8,55,51,54,57,68,43,51,55,0,2,0,129,255,233,2,68,1,156,0,11,0,23,0,0,22,
+38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,252,123,
+123,100,99,129,129,99,45,61,55,53,49,60,62,47,23,113,105,102,115,115,100,
+105,115,1,70,57,51,52,57,57,52,51,57,0,0,4,0,129,0,0,3,100,4,98,0,14,0,26,
+0,41,0,52,0,0,1,37,21,5,6,35,34,38,53,52,54,51,50,22,21,36,6,21,20,22,51,
+50,54,53,52,38,35,2,54,51,50,22,21,21,37,21,5,6,35,34,38,53,54,6,21,20,51,
+50,54,53,52,38,35,2,68,1,32,254,240,154,90,100,123,123,100,99,129,254,239,
+61,55,53,49,60,62,47,225,123,100,99,129,1,32,254,240,152,92,100,123,178,61,
+108,49,60,62,47,3,135,164,149,148,82,113,104,103,114,114,101,107,58,51,51,
+57,57,51,51,58,253,76,114,114,103,2,164,152,145,84,115,102,111,60,51,106,
+55,51,51,60,0,0,2,0,129,1,66,2,68,2,244,0,11,0,23,0,0,18,38,53,52,54,51,50,
+22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,252,123,123,100,99,129,129,
+99,45,61,55,53,49,60,62,47,1,66,112,105,102,115,115,100,107,112,1,69,57,51,
+52,57,57,52,51,57,0,4,0,129,1,66,4,186,2,244,0,11,0,23,0,35,0,47,0,0,18,38,
+53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,0,38,53,52,
+54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,252,123,123,100,
+99,129,129,99,45,61,55,53,49,60,62,47,2,17,123,123,100,98,129,129,98,45,61,
+55,53,47,62,62,47,1,66,112,105,102,115,115,100,107,112,1,69,57,51,52,57,57,
+52,51,57,254,187,112,105,102,115,115,100,107,112,1,69,57,51,52,57,57,52,51,
+57,0,0,3,251,109,254,154,255,53,4,217,0,3,0,4,0,5,0,0,1,53,33,21,1,19,251,
+109,3,200,254,23,65,254,154,139,139,1,52,5,11,0,0,6,0,113,255,206,4,242,4,
+217,0,13,0,31,0,43,0,44,0,45,0,46,0,0,0,2,4,35,32,0,53,52,0,33,50,4,18,21,
+39,6,6,35,34,38,39,6,6,21,20,22,51,50,54,53,52,38,37,22,22,51,50,54,55,38,
+38,35,34,6,1,19,7,4,242,148,254,255,170,254,243,254,203,1,57,1,0,171,1,6,
+151,200,74,185,112,124,188,74,6,4,213,181,178,206,4,253,62,67,169,92,92,161,
+66,50,162,112,112,161,1,15,10,3,1,133,254,244,141,1,73,242,248,1,63,139,254,
+244,160,108,59,76,82,60,29,53,29,192,232,238,186,29,51,174,66,71,69,64,74,
+90,86,1,102,251,39,50,0,4,0,129,254,201,2,70,4,76,0,11,0,23,0,39,0,50,0,0,
+0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,18,22,
+21,20,6,35,35,19,35,3,38,38,53,52,54,51,18,54,53,52,35,34,6,21,20,22,51,1,
+203,123,123,101,98,131,131,98,52,55,62,47,47,61,61,47,95,131,125,101,12,164,
+150,147,41,41,131,98,45,60,109,49,61,61,49,4,76,115,102,105,112,112,107,100,
+115,254,184,57,54,49,57,57,49,54,57,254,154,113,106,105,113,254,224,1,16,
+76,113,47,98,119,254,182,57,54,106,55,51,43,68,0,0,2,0,186,252,68,5,92,4,
+94,0,13,0,27,0,0,1,17,16,0,33,32,0,17,17,16,0,33,32,0,1,17,20,22,51,50,54,
+53,17,52,38,35,34,6,5,92,254,204,254,232,254,234,254,192,1,54,1,28,1,24,1,
+56,252,12,226,194,200,218,216,202,207,213,2,8,252,148,254,238,254,186,1,53,
+1,55,3,88,1,17,1,69,254,191,254,227,252,176,248,227,243,220,3,92,218,247,
+251,0,0,1,0,117,252,68,4,182,4,78,0,7,0,0,1,5,39,1,17,37,23,1,2,72,254,112,
+67,2,137,1,115,69,253,146,3,74,209,121,1,92,248,248,211,121,254,164,0,1,0,
+186,252,68,4,250,4,94,0,34,0,0,1,21,54,54,51,50,0,21,20,2,0,2,21,20,22,23,
+35,38,38,53,52,18,36,0,54,53,52,38,35,34,6,21,21,35,17,1,86,59,193,156,236,
+1,32,197,253,250,197,15,12,178,12,13,158,1,9,1,120,115,196,181,163,218,156,
+4,76,160,78,100,254,236,228,164,254,193,254,55,254,226,146,71,97,30,48,83,
+55,164,1,21,249,1,105,212,115,163,206,220,169,58,2,58,0,1,0,35,252,68,5,92,
+4,74,0,19,0,0,37,54,54,51,32,0,17,17,35,17,52,38,35,34,6,7,1,35,1,51,2,141,
+29,72,55,1,23,1,28,174,211,207,55,92,41,254,147,192,3,49,192,115,10,12,254,
+207,254,217,254,19,1,229,230,233,21,18,252,115,8,6,0,1,0,35,252,68,5,205,
+4,74,0,16,0,0,37,52,18,55,35,7,6,6,7,1,35,1,51,3,37,23,1,3,94,9,8,9,57,14,
+27,8,253,231,192,3,49,192,2,1,117,70,253,145,209,120,1,55,79,179,44,78,27,
+250,209,7,242,248,252,211,121,254,164,0,0,2,0,115,252,68,5,176,4,74,0,17,
+0,28,0,0,37,17,16,0,33,34,0,53,52,18,36,51,33,17,51,17,51,21,1,17,35,34,4,
+21,20,22,51,50,18,4,203,254,213,254,248,250,254,213,138,1,46,221,1,12,183,
+229,254,100,233,252,254,252,200,171,172,202,55,254,135,254,226,254,164,1,
+80,253,148,1,3,165,3,125,252,131,150,254,144,1,112,233,193,194,240,1,2,0,
+0,2,0,115,252,68,5,176,4,94,0,16,0,27,0,0,1,17,33,32,0,53,52,0,51,32,0,17,
+17,51,21,35,17,3,17,52,2,35,34,6,21,20,22,51,4,20,254,222,254,207,254,178,
+1,42,251,1,8,1,43,229,229,183,201,173,169,202,235,232,252,68,3,188,1,50,245,
+242,1,69,254,164,254,225,254,179,150,252,68,4,82,1,69,233,1,5,228,186,203,
+202,0,1,0,63,252,68,4,49,4,74,0,7,0,0,1,33,53,33,1,33,21,33,3,53,253,53,3,
+199,253,10,2,220,252,40,3,180,150,248,141,147,0,2,0,123,252,68,4,188,4,94,
+0,37,0,49,0,0,0,38,39,55,22,18,21,20,6,7,22,18,21,20,0,35,34,0,53,52,18,55,
+38,38,53,52,18,55,23,6,6,21,20,22,51,50,54,53,0,22,51,50,54,53,52,38,35,34,
+6,21,4,12,92,90,107,119,132,147,119,122,144,254,221,247,244,254,205,137,127,
+119,145,130,124,104,88,94,206,165,163,203,253,31,205,166,165,201,192,172,
+176,197,2,211,197,67,131,91,254,222,149,180,248,70,68,254,251,160,227,254,
+182,1,54,247,152,1,10,71,70,248,180,153,1,30,91,131,67,197,135,198,228,225,
+201,251,108,221,224,180,180,231,228,183,0,2,0,123,252,68,4,188,4,94,0,38,
+0,50,0,0,0,22,23,7,38,2,53,52,54,55,38,2,53,52,0,51,50,22,18,21,20,2,7,22,
+22,21,20,2,7,39,54,54,53,52,38,35,34,6,21,0,38,35,34,6,21,20,22,51,50,54,
+53,1,43,94,88,104,116,138,145,119,126,138,1,48,247,157,241,140,145,121,119,
+147,139,112,107,90,92,201,165,167,204,2,225,205,161,166,205,198,175,171,193,
+253,209,197,69,131,83,1,33,160,178,250,70,70,1,11,150,243,1,58,139,254,249,
+155,158,254,251,68,70,250,178,155,254,218,83,131,69,197,135,196,230,233,193,
+4,145,224,221,185,181,228,231,178,0,2,0,129,2,154,2,68,4,76,0,11,0,23,0,0,
+18,38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,252,
+123,123,100,99,129,129,99,45,61,55,53,49,60,62,47,2,154,112,105,102,115,115,
+100,107,112,1,67,57,49,54,57,57,54,49,57,0,2,0,129,4,90,2,70,7,45,0,15,0,
+27,0,0,1,3,35,19,35,34,38,53,52,54,51,50,22,21,20,6,2,6,21,20,22,51,50,54,
+53,52,38,35,1,244,148,149,162,11,100,125,126,95,101,131,41,236,57,59,49,52,
+59,61,50,5,106,254,240,1,33,113,104,98,119,117,98,47,113,1,8,55,51,55,58,
+70,43,51,55,0,0,4,0,129,0,0,3,100,4,98,0,14,0,26,0,41,0,53,0,0,1,20,6,35,
+34,38,53,52,54,51,50,23,5,21,37,36,6,21,20,22,51,50,54,53,52,38,35,19,5,21,
+37,21,20,6,35,34,38,53,52,54,51,50,6,6,21,20,22,51,50,54,53,52,38,35,2,68,
+129,99,100,123,123,100,94,150,1,16,254,224,254,233,55,61,47,47,62,60,49,242,
+1,16,254,224,129,99,100,123,123,100,92,143,55,61,47,47,62,60,49,3,135,100,
+115,115,102,105,112,82,145,152,162,109,58,51,51,57,57,51,51,58,253,106,145,
+152,162,2,100,115,115,102,105,114,110,58,51,51,57,57,51,51,58,0,0,2,251,229,
+3,25,255,82,8,6,0,15,0,16,0,0,1,52,38,35,34,6,21,35,52,54,51,50,22,21,17,
+35,1,254,180,155,125,136,145,158,239,196,204,238,158,254,217,6,49,169,155,
+146,129,194,226,235,224,252,222,1,192,0,0,3,0,63,252,68,2,246,6,231,0,7,0,
+19,0,31,0,0,1,33,53,33,17,33,21,33,2,38,53,52,54,51,50,22,21,20,6,35,2,6,
+21,20,22,51,50,54,53,52,38,35,1,66,254,253,1,183,1,0,254,76,93,123,123,101,
+98,129,127,100,45,62,56,53,47,61,61,47,3,191,139,248,133,139,8,241,115,104,
+101,114,114,101,104,115,1,70,57,50,51,59,59,51,50,57,0,1,0,113,252,68,6,231,
+8,6,0,60,0,0,1,20,22,51,50,54,53,17,52,2,38,39,39,38,38,53,52,54,51,50,22,
+23,7,38,38,35,34,6,21,20,4,18,18,21,17,20,6,35,34,38,53,17,52,38,35,34,6,
+21,20,22,23,7,38,2,53,16,0,51,50,0,17,4,199,90,94,90,90,71,122,118,115,98,
+102,224,179,147,203,45,139,35,125,86,106,133,1,62,214,100,195,173,166,197,
+205,161,163,208,94,88,104,112,152,1,66,235,254,1,43,253,201,119,119,129,111,
+4,0,184,1,13,192,98,92,78,177,120,154,231,127,117,71,86,92,143,105,144,235,
+254,244,254,176,242,252,27,196,207,195,210,4,51,215,230,235,210,137,205,71,
+131,73,1,43,176,1,9,1,69,254,182,254,252,0,5,0,113,255,206,8,144,4,217,0,
+50,0,58,0,59,0,60,0,61,0,0,37,16,0,37,38,38,35,34,6,7,22,22,21,20,2,7,39,
+54,54,53,52,38,35,34,6,21,20,22,23,7,38,2,53,16,0,51,50,22,23,54,54,51,50,
+4,18,21,20,0,33,34,38,1,6,6,7,22,51,50,54,1,1,5,5,123,1,61,1,12,39,190,147,
+111,188,87,6,13,157,111,107,93,95,208,169,171,211,94,88,104,112,152,1,72,
+241,144,234,90,88,245,134,169,1,1,149,254,209,254,254,62,118,2,43,189,240,
+4,10,26,192,205,254,116,254,57,1,217,18,1,47,1,88,23,133,144,130,139,42,75,
+51,180,254,220,76,131,71,205,137,209,232,235,206,137,205,71,131,73,1,43,176,
+1,8,1,70,117,124,127,114,139,254,243,159,240,254,181,22,2,29,17,219,174,2,
+228,3,114,251,39,50,0,0,5,0,109,255,206,8,141,4,217,0,52,0,64,0,65,0,66,0,
+67,0,0,37,6,6,7,39,54,54,53,52,38,35,34,6,21,20,30,2,21,20,6,35,34,38,39,
+55,22,22,51,50,54,53,52,38,38,53,52,36,51,50,4,23,54,54,51,32,0,21,16,0,35,
+34,38,18,22,51,50,54,53,52,38,35,34,6,21,1,1,5,4,147,38,97,59,107,93,95,217,
+160,181,187,65,168,52,128,117,80,102,62,102,37,60,32,37,43,198,93,1,32,248,
+145,1,7,77,78,247,148,1,4,1,50,254,209,244,158,239,2,205,171,177,205,211,
+169,158,220,1,117,254,57,1,208,233,79,129,45,131,71,205,137,207,238,158,123,
+70,118,136,104,67,76,137,57,65,107,41,37,43,29,61,146,169,109,189,241,121,
+137,135,123,254,186,241,254,249,254,204,123,1,1,229,225,189,193,231,228,196,
+2,184,251,39,50,0,0,4,0,186,255,206,6,152,4,217,0,44,0,45,0,46,0,47,0,0,0,
+38,35,34,6,7,39,54,54,51,50,0,17,20,2,6,35,34,46,2,35,34,6,3,35,17,51,17,
+20,6,7,23,62,2,51,50,30,2,51,50,54,53,1,1,19,5,224,186,148,35,65,25,65,41,
+98,68,217,1,28,110,212,136,108,149,88,145,66,46,128,158,156,181,5,4,4,40,
+84,118,66,91,137,137,110,83,118,158,253,112,1,79,5,2,232,225,6,9,136,16,12,
+254,205,254,252,140,254,246,165,106,119,201,144,254,250,4,74,253,211,52,114,
+51,7,56,107,75,96,203,127,254,172,253,213,4,217,250,245,0,0,6,0,109,255,206,
+8,150,4,217,0,55,0,67,0,79,0,80,0,81,0,82,0,0,37,6,6,7,38,2,53,52,54,55,38,
+38,35,34,6,21,20,30,2,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,38,53,
+52,36,51,50,4,23,54,54,51,50,22,18,21,16,0,35,34,38,0,38,35,34,6,21,20,22,
+51,50,54,53,1,54,54,53,52,38,39,6,6,21,20,22,1,1,19,4,174,35,106,72,137,139,
+92,69,34,113,41,160,209,63,163,49,125,115,78,100,61,102,35,57,31,35,41,192,
+89,1,34,249,185,1,8,63,75,242,145,164,249,143,254,215,240,159,234,2,231,200,
+166,156,213,200,166,172,197,252,0,57,66,63,54,61,60,54,1,3,1,191,27,233,79,
+115,59,94,1,4,176,142,212,74,16,15,150,131,70,117,138,104,66,77,136,57,65,
+107,41,37,43,29,61,146,170,108,190,240,142,116,135,123,140,254,245,160,254,
+248,254,205,125,2,118,234,228,196,185,229,225,189,254,157,66,166,102,111,
+164,57,65,181,100,109,145,255,0,4,217,250,245,0,5,0,113,255,206,8,145,4,217,
+0,35,0,47,0,48,0,49,0,50,0,0,37,6,6,35,34,0,17,52,18,55,23,6,6,21,20,22,51,
+50,54,53,16,39,55,22,23,54,54,51,32,0,21,20,0,35,34,38,0,38,35,34,6,21,20,
+22,51,50,54,53,1,1,5,4,128,73,253,144,244,254,187,146,118,104,88,94,214,168,
+166,211,188,107,120,74,69,241,144,1,5,1,51,254,207,253,185,241,3,30,211,170,
+172,207,207,172,167,214,254,126,254,41,1,228,248,142,126,1,72,1,5,173,1,40,
+80,131,69,205,140,204,236,233,207,1,17,141,131,80,149,114,115,254,186,241,
+238,254,179,151,2,100,226,234,190,184,230,226,188,2,184,251,39,50,0,4,0,113,
+252,68,8,100,4,217,0,57,0,58,0,59,0,60,0,0,1,33,53,33,17,6,6,35,34,38,2,53,
+52,18,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,53,52,0,51,50,22,18,
+21,20,0,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,21,1,1,21,4,193,254,
+75,1,0,57,188,125,165,244,144,121,242,165,84,104,50,64,30,74,52,164,196,197,
+163,175,202,1,48,251,183,251,123,254,218,238,60,95,38,62,26,62,29,162,198,
+204,169,179,193,1,117,2,22,252,68,139,3,180,68,83,140,1,15,160,136,1,8,167,
+16,21,137,10,15,229,185,190,234,233,195,246,1,57,159,254,250,146,252,254,
+193,21,11,140,11,10,230,184,197,227,227,197,2,184,251,39,60,0,0,6,0,113,255,
+206,8,141,4,217,0,38,0,50,0,62,0,63,0,64,0,65,0,0,1,54,54,51,32,0,21,16,0,
+35,34,38,39,55,22,51,50,54,53,52,38,35,34,6,7,23,22,21,20,0,33,34,0,53,52,
+0,33,50,22,2,38,35,34,6,21,20,22,51,50,54,53,4,38,53,52,54,51,50,22,21,20,
+6,35,1,1,5,4,126,82,241,148,1,7,1,49,254,213,233,94,136,59,66,78,116,172,
+203,205,173,137,186,76,12,7,254,201,254,251,255,254,207,1,49,1,6,144,238,
+4,204,173,175,207,214,166,172,207,254,81,73,71,56,53,76,78,51,3,171,254,37,
+1,247,3,109,118,123,254,184,241,254,253,254,202,24,29,135,37,227,187,189,
+231,144,125,68,44,43,237,254,188,1,67,246,241,1,72,119,254,249,231,231,191,
+190,224,230,184,127,67,72,74,63,64,73,72,67,3,55,251,39,50,0,0,7,0,113,255,
+206,8,143,4,217,0,23,0,41,0,53,0,65,0,66,0,67,0,68,0,0,37,6,6,35,32,0,53,
+52,0,33,50,22,23,54,54,51,32,0,21,20,0,33,34,38,3,22,22,21,20,6,7,22,22,51,
+50,54,53,52,38,35,34,6,6,38,35,34,6,21,20,22,51,50,54,53,4,38,53,52,54,51,
+50,22,21,20,6,35,1,1,5,4,116,97,233,136,255,0,254,207,1,49,1,6,137,239,80,
+92,228,168,1,6,1,49,254,204,254,242,157,237,3,10,19,15,12,53,207,136,180,
+211,203,175,129,205,235,204,173,175,207,214,166,172,207,254,81,73,71,56,53,
+76,78,51,3,171,254,32,1,212,201,124,97,1,66,247,241,1,72,103,112,107,108,
+254,184,241,249,254,192,113,2,136,35,110,51,39,107,34,106,128,226,188,199,
+223,97,134,231,231,191,190,224,230,184,127,67,72,74,63,64,73,72,67,3,55,251,
+39,50,0,0,7,0,113,255,206,8,146,4,217,0,37,0,45,0,57,0,69,0,70,0,71,0,72,
+0,0,37,16,0,37,38,38,35,34,6,7,23,22,21,20,2,6,35,34,0,53,52,0,33,50,22,23,
+54,54,51,50,4,18,21,20,0,35,34,38,1,6,6,7,22,51,50,54,0,38,35,34,6,21,20,
+22,51,50,54,53,4,38,53,52,54,51,50,22,21,20,6,35,1,1,5,5,135,1,50,1,10,35,
+193,156,134,182,75,12,7,148,251,166,252,254,211,1,47,1,2,143,232,87,81,242,
+138,196,1,14,131,254,208,252,62,116,2,36,183,236,4,10,25,185,203,252,60,202,
+168,174,201,209,166,166,204,254,86,73,71,56,53,76,78,51,3,160,254,57,1,238,
+15,1,44,1,93,24,123,154,144,125,68,44,43,156,254,245,138,1,67,248,242,1,69,
+119,122,118,123,169,254,252,138,247,254,185,22,2,32,17,216,180,2,229,1,120,
+234,230,192,187,227,231,183,127,67,72,74,63,64,73,72,67,3,55,251,39,50,0,
+0,8,0,113,255,206,8,148,4,217,0,23,0,35,0,47,0,55,0,67,0,68,0,69,0,70,0,0,
+37,6,6,35,32,0,53,52,0,33,50,22,23,54,54,51,32,0,21,20,0,33,34,38,2,38,35,
+34,6,21,20,22,51,50,54,53,55,22,0,23,54,54,53,52,38,35,34,6,1,38,38,39,20,
+22,51,50,0,38,53,52,54,51,50,22,21,20,6,35,1,1,5,4,130,60,235,184,254,255,
+254,207,1,53,1,5,181,230,60,61,231,182,1,3,1,53,254,205,254,245,176,231,155,
+206,170,176,209,213,170,170,208,205,231,1,43,41,86,88,208,173,146,184,1,125,
+4,227,200,208,187,24,251,239,73,71,56,53,76,78,51,3,181,254,32,1,212,240,
+111,149,1,69,246,243,1,68,149,111,111,149,254,188,243,239,254,180,143,2,98,
+236,235,189,187,227,231,183,145,24,254,255,221,56,188,113,190,234,156,253,
+88,168,218,24,181,231,1,31,67,72,74,63,64,73,72,67,3,55,251,39,50,0,0,7,0,
+113,255,206,8,148,4,217,0,23,0,35,0,47,0,55,0,56,0,57,0,58,0,0,37,6,6,35,
+32,0,53,52,0,33,50,22,23,54,54,51,32,0,21,20,0,33,34,38,2,38,35,34,6,21,20,
+22,51,50,54,53,55,22,0,23,54,54,53,52,38,35,34,6,1,38,38,39,20,22,51,50,3,
+1,5,4,130,60,235,184,254,255,254,207,1,53,1,5,181,230,60,61,231,182,1,3,1,
+53,254,205,254,245,176,231,155,206,170,176,209,213,170,170,208,205,231,1,
+43,41,86,88,208,173,146,184,1,125,4,227,200,208,187,24,38,254,32,1,212,240,
+111,149,1,69,246,243,1,68,149,111,111,149,254,188,243,239,254,180,143,2,98,
+236,235,189,187,227,231,183,145,24,254,255,221,56,188,113,190,234,156,253,
+88,168,218,24,181,231,4,86,251,39,50,0,0,5,255,248,255,206,4,232,4,217,0,
+43,0,54,0,55,0,56,0,57,0,0,1,22,22,21,20,6,7,38,2,53,52,54,55,38,38,53,52,
+54,55,51,7,6,21,20,22,23,54,54,51,50,0,17,20,2,7,39,54,54,53,52,38,35,34,
+6,3,6,21,20,22,23,54,54,53,52,38,19,19,7,1,121,167,139,121,95,114,173,2,2,
+100,92,6,4,171,9,3,35,31,57,241,161,243,1,71,147,118,105,88,96,209,165,107,
+179,64,2,70,51,34,23,81,253,20,3,2,197,68,183,108,108,208,54,59,1,45,180,
+24,50,23,59,191,107,36,60,28,66,23,28,54,108,33,153,179,254,189,254,245,166,
+254,212,82,131,71,205,137,205,238,148,254,248,10,20,117,178,48,35,92,39,59,
+109,2,213,251,39,50,0,0,4,0,113,255,206,9,154,4,217,0,81,0,82,0,83,0,84,0,
+0,0,6,21,20,22,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,0,21,20,2,4,35,
+34,0,53,52,54,55,55,54,53,52,38,35,34,6,21,20,23,23,22,22,21,20,0,35,34,38,
+2,53,52,0,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,53,52,38,53,52,54,
+51,50,22,21,1,1,3,6,70,41,176,139,177,214,207,157,31,55,29,41,41,84,59,226,
+1,41,128,254,253,185,210,254,227,10,6,11,5,88,53,49,86,5,11,7,10,254,229,
+215,167,254,148,1,43,223,57,84,41,43,26,56,30,156,207,218,173,138,178,41,
+176,143,145,177,254,180,2,138,38,2,123,119,70,127,188,239,185,190,224,4,9,
+144,10,8,254,187,242,143,254,248,164,1,6,176,49,68,28,47,21,28,54,51,51,54,
+28,21,47,29,69,47,180,254,254,141,1,14,160,246,1,65,8,10,144,9,4,225,189,
+186,238,183,132,67,112,63,97,139,139,97,253,80,4,217,250,245,0,6,255,243,
+252,68,7,139,4,217,0,53,0,65,0,66,0,67,0,68,0,69,0,0,1,6,6,35,34,38,53,52,
+54,51,50,22,23,54,54,51,50,4,18,21,20,0,35,34,38,39,55,22,51,50,54,53,52,
+38,35,34,6,7,17,20,2,35,34,0,53,53,51,21,20,22,51,50,54,53,2,6,21,20,22,51,
+50,54,53,52,38,35,9,2,21,2,255,35,75,47,130,167,172,127,96,156,43,131,204,
+111,182,1,8,132,254,210,221,92,131,57,63,80,111,161,199,220,179,125,209,68,
+246,231,217,254,252,174,168,135,154,149,205,86,93,53,65,82,92,55,1,53,1,158,
+1,170,2,43,20,23,171,132,137,164,92,88,113,69,167,254,251,137,250,254,189,
+24,29,135,37,226,198,184,228,134,108,251,119,239,254,231,1,4,213,32,36,168,
+164,196,174,5,130,82,66,65,80,86,59,66,82,252,63,4,217,251,39,50,0,6,0,113,
+255,206,8,141,4,217,0,43,0,51,0,52,0,53,0,54,0,55,0,0,36,54,53,52,38,35,34,
+6,7,39,54,54,51,50,0,17,20,0,35,34,0,2,38,35,34,6,7,4,0,17,6,6,35,34,0,53,
+52,0,51,50,0,18,22,51,33,38,38,39,20,22,51,50,5,33,1,3,7,13,198,204,159,53,
+96,39,66,56,133,94,227,1,37,254,212,238,232,254,247,151,193,136,134,193,30,
+1,6,1,50,47,115,61,252,254,215,1,48,236,234,1,21,138,196,159,252,82,4,232,
+180,195,174,39,5,202,251,236,2,3,11,133,230,192,191,223,21,16,135,29,22,254,
+203,254,254,246,254,187,1,3,1,243,229,148,131,24,254,167,254,211,16,22,1,
+73,242,253,1,58,254,232,254,24,217,175,218,17,182,230,131,4,217,250,245,0,
+0,5,0,186,255,206,6,150,4,217,0,26,0,38,0,39,0,40,0,41,0,0,0,2,6,35,34,0,
+39,39,38,38,39,35,22,22,21,17,35,17,51,1,54,36,51,50,22,18,21,4,22,51,50,
+54,53,52,38,35,34,6,21,19,19,3,6,150,125,253,184,233,254,216,20,34,33,106,
+46,8,10,11,183,158,1,0,48,1,19,207,164,249,143,252,98,206,164,168,199,199,
+165,169,204,163,212,7,1,152,254,247,163,1,28,234,53,45,160,84,90,252,176,
+254,190,4,74,254,143,174,215,140,254,245,160,194,226,231,183,189,235,232,
+192,253,223,4,217,250,245,0,0,2,255,90,5,71,3,213,8,27,0,13,0,27,0,0,3,54,
+36,51,50,4,23,7,38,36,35,34,4,7,3,54,36,51,50,4,23,7,38,38,35,34,6,7,166,
+135,1,46,137,135,1,44,138,78,117,254,251,117,118,254,251,117,70,127,1,34,
+144,145,1,35,126,91,141,231,99,94,225,152,7,113,80,90,88,82,127,72,78,79,
+71,254,203,100,117,118,99,118,106,80,75,111,0,5,0,113,255,206,8,137,4,217,
+0,54,0,66,0,67,0,68,0,69,0,0,1,22,22,21,20,2,7,38,2,53,16,0,51,50,22,23,54,
+54,51,32,0,21,16,0,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,23,22,
+21,20,2,7,39,54,54,53,52,38,35,34,7,6,6,21,20,22,23,54,54,53,52,38,1,1,5,
+2,17,70,92,140,142,132,164,1,72,240,144,237,88,81,241,148,1,4,1,49,254,216,
+234,93,136,59,66,40,97,54,173,202,204,172,133,187,77,12,7,155,115,107,93,
+95,210,165,84,197,55,66,70,56,67,53,60,4,131,254,57,1,227,3,170,74,212,143,
+176,254,252,92,77,1,42,172,1,8,1,70,119,122,118,123,254,187,242,254,254,254,
+198,24,29,135,18,19,227,188,189,231,142,127,69,45,54,192,254,234,79,131,71,
+206,137,215,230,113,57,164,111,103,166,66,66,145,109,101,181,1,194,251,39,
+50,0,0,6,0,88,255,206,9,152,4,217,0,56,0,68,0,79,0,80,0,81,0,82,0,0,19,22,
+22,21,20,6,7,50,54,53,52,38,53,52,18,51,50,22,23,54,54,51,50,22,18,21,20,
+2,6,35,34,38,39,6,6,7,39,54,54,53,52,38,35,34,6,21,20,22,21,20,6,35,34,2,
+53,52,54,0,22,51,50,54,53,52,38,35,34,6,21,37,6,21,20,22,23,54,54,53,52,38,
+1,1,5,149,215,216,6,2,66,84,41,254,192,132,221,62,50,210,154,166,228,106,
+106,226,165,135,208,56,32,87,55,104,82,83,174,131,126,150,32,184,155,216,
+255,33,5,235,173,143,145,173,175,142,134,183,250,172,10,90,70,2,3,72,6,61,
+252,229,3,37,2,253,30,255,237,35,41,31,88,68,66,183,88,210,1,23,125,141,117,
+149,167,254,253,141,143,254,250,166,121,110,76,110,45,131,71,205,137,207,
+238,195,170,67,153,94,131,180,1,2,231,86,150,254,169,230,222,192,194,230,
+230,194,42,49,54,147,154,34,10,47,35,143,163,2,182,251,39,50,0,4,0,186,255,
+206,6,152,4,217,0,38,0,39,0,40,0,41,0,0,1,38,38,39,35,22,22,21,17,35,17,51,
+1,22,22,51,50,54,54,53,52,38,35,34,6,7,39,54,54,51,50,0,17,20,2,35,34,38,
+39,1,1,5,2,52,39,115,53,9,10,11,183,158,2,91,91,134,71,55,104,94,185,141,
+35,65,27,65,40,99,69,217,1,29,253,207,121,170,118,1,107,254,227,1,29,2,39,
+45,158,86,90,252,176,254,190,4,74,253,10,114,97,72,197,151,213,207,6,9,136,
+16,12,254,206,254,251,228,254,169,103,148,3,242,251,39,50,0,0,3,0,113,252,
+68,6,231,8,6,0,77,0,87,0,99,0,0,1,52,38,38,39,39,38,38,53,52,54,51,50,22,
+23,7,38,38,35,34,6,21,20,4,22,18,21,17,20,2,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,17,38,0,53,52,18,55,23,6,6,21,20,22,23,17,52,18,55,22,18,
+21,20,2,7,17,22,22,51,50,54,53,1,54,54,53,52,38,39,6,6,21,0,6,21,20,22,51,
+50,54,53,52,38,35,6,51,67,120,124,115,98,102,224,179,147,203,45,139,35,125,
+86,106,133,1,66,210,100,128,249,171,116,187,123,41,158,96,126,173,166,131,
+47,76,34,235,254,207,142,124,102,88,94,199,155,156,119,142,155,218,180,71,
+197,113,170,209,253,8,115,117,60,51,49,72,254,140,93,87,59,57,90,82,65,1,
+250,167,249,181,99,92,78,177,120,154,231,127,117,71,86,92,143,105,145,237,
+248,254,195,230,252,131,138,254,255,160,69,111,86,90,163,138,130,173,25,18,
+1,112,7,1,73,254,162,1,41,90,131,72,204,138,209,229,6,1,176,164,1,37,102,
+85,254,215,169,212,254,206,49,253,205,115,125,226,182,2,43,49,223,139,98,
+160,64,68,170,96,251,217,80,65,66,82,82,66,59,86,0,2,0,109,252,68,10,84,8,
+6,0,122,0,134,0,0,37,22,51,50,54,53,52,38,35,34,6,7,23,22,21,20,2,7,39,54,
+54,53,52,38,35,34,6,21,20,30,2,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,
+46,2,53,52,36,51,50,22,23,54,54,51,50,22,18,21,20,2,7,17,22,22,51,50,54,53,
+17,52,2,39,39,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,4,22,18,21,
+17,20,2,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,17,38,39,2,6,21,20,
+22,51,50,54,53,52,38,35,5,127,76,112,165,198,197,170,129,186,72,12,7,151,
+114,104,88,94,212,156,174,181,55,167,51,124,114,78,100,61,102,35,57,31,35,
+41,128,104,49,1,30,238,141,242,92,80,236,145,165,247,143,243,197,73,198,108,
+175,204,128,184,115,95,105,228,175,148,201,47,142,34,125,86,106,130,1,43,
+223,111,129,250,170,111,188,127,41,158,96,128,171,168,129,47,76,35,109,80,
+17,87,88,57,58,90,82,66,168,37,225,189,189,233,144,127,69,45,54,168,254,207,
+75,131,71,205,137,207,236,158,121,64,115,147,99,70,76,137,57,65,105,41,35,
+43,29,53,104,111,139,78,189,241,110,131,118,123,140,254,246,163,240,254,215,
+26,253,219,119,121,232,176,3,133,215,1,81,144,92,75,182,118,155,230,127,117,
+71,86,92,147,101,140,226,244,254,189,244,252,131,137,254,254,160,65,115,86,
+90,163,138,131,172,25,18,1,119,8,41,253,231,87,58,66,82,82,66,59,86,0,2,0,
+102,252,68,10,145,8,6,0,110,0,122,0,0,37,54,54,53,52,38,35,34,6,21,17,16,
+33,35,34,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,51,50,54,53,
+17,52,38,35,34,6,7,39,54,36,51,50,22,23,54,54,51,50,4,18,21,20,2,7,17,22,
+22,51,50,54,53,17,16,2,36,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,4,
+18,18,17,17,20,0,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,6,6,21,20,
+22,51,50,54,53,52,38,35,6,117,137,145,217,178,191,202,254,90,180,198,214,
+179,132,77,127,91,112,36,75,59,51,89,124,102,194,119,111,203,164,119,184,
+51,144,56,1,10,174,169,224,64,71,244,172,187,1,6,133,156,141,62,182,104,154,
+196,168,254,166,113,224,180,145,205,45,139,35,127,86,103,132,1,51,218,105,
+254,226,228,103,174,122,33,139,100,127,166,158,126,39,72,31,193,71,84,47,
+53,82,76,59,150,38,213,144,195,229,227,197,251,209,254,82,159,152,134,163,
+43,82,106,34,46,71,77,77,84,135,123,4,79,191,225,129,129,73,154,180,135,102,
+108,129,157,254,247,145,170,254,244,70,253,162,111,129,222,186,3,86,1,22,
+1,106,255,201,114,152,233,127,117,71,86,92,143,105,143,228,254,246,254,183,
+254,253,252,187,233,254,182,64,116,72,104,162,139,130,173,25,18,113,88,57,
+78,70,84,64,60,85,0,2,0,113,252,70,7,137,8,4,0,39,0,59,0,0,33,33,17,33,22,
+22,21,17,33,21,33,17,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,0,53,
+52,18,54,51,50,23,33,17,33,1,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,
+50,22,23,7,137,254,76,254,93,77,74,1,0,254,75,193,179,169,204,198,162,29,
+62,26,62,38,95,60,238,254,218,123,251,183,87,83,3,65,1,0,252,152,33,102,64,
+100,111,98,64,90,105,131,210,163,105,165,48,3,191,76,208,116,250,162,139,
+5,219,197,227,227,197,184,230,10,11,140,11,21,1,63,252,146,1,6,159,20,252,
+65,6,121,55,64,139,99,109,136,43,107,57,203,135,170,205,86,80,0,3,0,86,255,
+221,7,223,6,250,0,35,0,49,0,63,0,0,37,54,54,51,50,22,23,50,53,38,53,53,16,
+18,0,51,50,22,23,7,38,38,35,34,2,2,17,20,23,7,38,38,35,34,6,7,1,54,54,53,
+52,38,39,55,22,22,21,20,6,7,19,22,22,51,50,54,55,23,6,6,35,34,38,39,1,23,
+75,215,131,136,208,72,4,8,188,1,61,177,70,116,35,98,16,62,39,138,250,152,
+12,236,53,164,108,105,164,53,254,209,72,108,108,72,96,98,132,131,99,207,53,
+164,105,108,164,53,111,76,223,148,131,215,75,63,99,131,110,85,2,47,69,134,
+1,89,2,174,1,149,51,43,99,21,26,254,138,253,149,254,201,125,94,152,72,110,
+110,72,1,4,54,163,105,108,166,51,111,74,223,147,131,218,73,3,250,72,111,111,
+72,99,97,132,131,98,0,1,0,113,252,68,5,201,4,94,0,30,0,0,1,33,21,33,17,52,
+38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,0,53,52,18,54,51,50,0,21,4,201,
+1,0,254,75,193,179,169,204,198,162,29,62,26,62,38,95,60,238,254,218,123,251,
+183,251,1,48,252,207,139,5,221,197,227,227,197,184,230,10,11,140,11,21,1,
+63,252,146,1,6,159,254,199,246,0,0,5,0,186,252,68,10,68,8,6,0,83,0,84,0,85,
+0,86,0,87,0,0,1,34,6,21,17,20,22,51,33,50,54,53,17,52,38,35,34,6,21,20,22,
+51,50,54,55,23,6,6,35,34,0,53,52,18,54,51,50,0,21,20,22,51,50,54,53,52,38,
+35,34,6,7,39,54,54,51,50,22,18,21,20,2,6,35,34,38,39,17,16,33,33,32,17,17,
+16,33,33,50,54,53,53,51,21,16,33,1,33,1,1,2,86,119,108,108,119,2,184,117,
+113,193,180,165,206,199,162,28,62,26,62,38,95,60,243,254,223,143,246,166,
+252,1,49,195,180,163,197,196,162,52,77,29,61,47,104,84,168,242,119,142,245,
+164,125,189,57,254,90,253,90,254,92,1,164,2,174,117,113,182,254,90,5,51,250,
+68,253,231,6,60,6,10,135,121,248,207,123,135,135,123,4,72,197,227,226,198,
+184,230,10,11,140,11,21,1,69,246,162,1,11,138,254,199,246,194,234,234,190,
+184,230,15,10,137,21,16,169,254,250,136,161,254,242,140,83,68,253,119,254,
+74,1,182,6,239,1,183,135,123,100,67,254,71,249,246,4,217,250,245,0,0,2,0,
+129,254,201,2,70,1,158,0,15,0,26,0,0,0,22,21,20,6,35,35,19,35,3,38,38,53,
+52,54,51,18,54,53,52,35,34,6,21,20,22,51,1,195,131,125,101,12,164,150,147,
+41,41,131,98,45,60,109,49,61,61,49,1,158,113,106,105,113,254,224,1,16,76,
+113,47,98,119,254,182,57,54,106,55,51,43,68,0,0,5,253,178,255,206,4,113,8,
+6,0,32,0,33,0,34,0,35,0,36,0,0,51,17,52,38,35,34,6,21,21,35,53,52,36,51,50,
+22,23,54,54,51,50,4,21,21,35,53,52,38,35,34,6,21,17,51,35,7,19,186,150,151,
+135,166,174,1,3,214,144,196,53,52,190,144,214,1,5,174,168,136,151,148,183,
+254,2,250,6,76,133,172,153,152,33,29,202,244,104,86,86,104,243,203,29,33,
+152,153,170,135,249,180,50,4,183,0,0,3,252,29,4,217,254,207,8,4,0,11,0,31,
+0,32,0,0,0,22,21,20,6,35,34,38,53,52,54,51,55,38,38,35,34,6,21,20,22,23,7,
+38,38,53,52,54,51,50,22,23,1,253,201,55,51,43,41,60,56,43,186,33,102,64,100,
+110,98,63,90,104,131,212,160,105,166,47,254,190,6,250,51,47,41,60,53,48,47,
+51,10,55,64,139,99,108,137,43,107,57,203,135,173,202,86,80,253,123,0,3,252,
+176,4,217,255,72,7,119,0,14,0,18,0,19,0,0,1,38,38,53,52,54,51,50,22,21,20,
+6,7,23,7,19,7,39,55,1,253,12,37,55,117,78,80,104,55,39,225,88,242,88,177,
+93,254,241,6,2,31,90,59,93,100,103,88,62,72,30,198,107,1,33,104,151,107,254,
+59,0,0,3,252,29,4,217,254,207,8,4,0,12,0,32,0,33,0,0,1,38,35,34,6,7,39,54,
+54,51,50,22,23,55,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,
+1,253,217,14,58,26,37,4,88,12,88,53,56,73,27,47,33,102,64,100,110,98,63,90,
+104,131,212,160,105,166,47,254,190,6,164,47,35,29,43,48,69,49,35,37,55,64,
+139,99,108,137,43,107,57,203,135,173,202,86,80,253,123,0,3,251,111,252,68,
+255,109,255,206,0,5,0,11,0,12,0,0,1,33,17,51,17,41,2,17,51,17,33,1,251,111,
+1,0,180,254,76,3,254,254,73,180,1,3,254,0,252,207,2,205,252,168,3,88,253,
+51,2,255,0,4,250,143,252,68,255,213,255,206,0,5,0,11,0,15,0,16,0,0,3,33,17,
+51,17,41,2,17,51,17,33,1,51,17,35,19,43,254,78,178,1,0,250,186,1,0,181,254,
+75,2,74,180,180,82,252,68,3,88,253,51,2,205,252,168,3,88,252,168,3,138,255,
+255,250,47,4,217,254,182,8,20,2,38,1,168,0,0,0,7,1,169,253,158,0,0,255,255,
+251,183,4,217,0,64,8,4,0,39,1,159,1,244,0,0,0,6,1,168,156,0,255,255,252,115,
+4,217,255,254,8,20,2,38,0,189,0,0,0,7,1,169,1,174,0,0,255,255,252,115,4,217,
+0,34,8,6,2,38,0,189,0,0,0,7,1,159,1,214,0,0,255,255,252,115,4,217,1,19,8,
+6,2,38,0,189,0,0,0,7,1,163,2,68,0,0,255,255,251,101,4,217,1,198,8,6,0,39,
+0,189,254,242,0,0,0,39,1,159,3,122,0,0,0,7,1,168,1,44,0,0,255,255,251,101,
+4,217,255,226,8,6,0,39,0,189,254,242,0,0,0,7,1,168,1,44,0,0,255,255,251,101,
+4,217,255,226,8,6,0,39,0,189,254,242,0,0,0,7,1,208,1,44,0,0,255,255,251,101,
+4,217,0,124,8,6,0,39,0,189,254,242,0,0,0,7,1,156,1,114,0,0,0,3,252,115,4,
+217,254,95,8,6,0,41,0,42,0,43,0,0,1,38,38,35,34,6,21,20,23,51,50,22,23,7,
+38,38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,38,53,52,54,55,38,53,52,54,51,
+50,23,3,33,253,184,20,45,29,39,47,55,29,74,112,27,117,12,49,29,41,49,47,41,
+62,32,115,27,112,74,102,127,37,30,65,125,102,125,68,193,1,7,7,90,19,20,45,
+41,57,52,63,59,60,23,26,49,41,41,45,47,59,59,64,117,104,53,84,29,72,94,104,
+115,86,253,41,0,255,255,250,212,4,217,0,65,8,6,0,39,0,193,254,222,0,0,0,7,
+1,163,1,114,0,0,255,255,250,232,4,217,0,40,8,6,0,39,0,193,254,242,0,0,0,7,
+1,168,1,114,0,0,255,255,250,232,4,217,0,40,8,6,0,39,0,193,254,242,0,0,0,7,
+1,208,1,114,0,0,0,3,251,246,4,217,254,170,8,6,0,21,0,29,0,30,0,0,1,22,22,
+23,6,6,35,34,38,53,52,54,51,50,22,23,7,38,38,35,34,6,19,38,39,38,39,22,23,
+22,23,252,172,168,186,9,37,80,45,178,205,199,176,114,164,39,119,28,107,68,
+65,98,174,11,63,64,86,13,56,56,45,6,248,29,218,216,23,16,216,171,171,214,
+88,80,90,62,57,72,254,84,109,56,56,11,95,67,68,176,0,2,0,186,252,68,6,154,
+8,6,0,35,0,47,0,0,0,6,35,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,33,
+34,6,21,17,20,22,51,33,38,38,53,52,54,51,50,22,21,4,22,51,50,54,53,52,38,
+35,34,6,21,6,150,205,176,253,69,254,92,1,164,2,152,1,164,183,110,117,253,
+86,119,108,108,119,1,152,37,35,203,172,177,200,253,180,114,99,94,117,113,
+98,101,112,253,33,221,1,182,8,86,1,182,254,74,60,95,121,135,135,121,247,102,
+123,135,49,123,66,164,221,235,159,100,139,136,99,111,149,143,108,0,0,2,0,
+186,252,68,10,55,8,6,0,35,0,47,0,0,0,6,35,33,32,17,17,16,33,33,32,17,21,35,
+53,52,38,35,33,34,6,21,17,20,22,51,33,38,38,53,52,54,51,50,22,21,4,22,51,
+50,54,53,52,38,35,34,6,21,10,51,205,176,249,168,254,92,1,164,6,53,1,164,182,
+111,116,249,184,119,108,108,119,5,53,37,34,203,171,178,199,253,180,115,98,
+93,118,112,99,100,113,253,31,219,1,182,8,86,1,182,254,74,60,95,121,135,135,
+121,247,102,123,135,49,123,66,164,221,233,161,100,139,133,102,111,149,143,
+108,0,0,2,0,186,252,68,6,150,8,6,0,28,0,40,0,0,0,6,35,33,32,17,17,16,33,51,
+21,35,34,6,21,17,20,22,51,33,38,38,53,52,54,51,50,22,21,4,22,51,50,54,53,
+52,38,35,34,6,21,6,150,205,176,253,69,254,92,1,164,170,178,119,108,108,119,
+1,152,37,35,203,172,177,200,253,180,114,99,94,117,113,98,101,112,253,33,221,
+1,182,8,86,1,182,147,135,121,247,102,123,135,49,123,66,164,221,235,159,100,
+139,136,99,111,149,143,108,0,2,0,186,252,68,10,51,8,6,0,28,0,40,0,0,0,6,35,
+33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,38,38,53,52,54,51,50,22,
+21,4,22,51,50,54,53,52,38,35,34,6,21,10,51,205,176,249,168,254,92,1,164,3,
+25,252,223,119,108,108,119,5,53,37,34,203,171,178,199,253,180,115,98,93,118,
+112,99,100,113,253,31,219,1,182,8,86,1,182,147,135,121,247,102,123,135,49,
+123,66,164,221,233,161,100,139,133,102,111,149,143,108,0,1,0,186,252,70,10,
+55,8,6,0,31,0,0,1,34,6,21,17,20,22,51,33,50,54,53,17,51,17,16,33,33,32,17,
+17,16,33,33,32,17,21,35,53,52,38,35,2,86,119,108,108,119,6,72,116,111,182,
+254,92,249,203,254,92,1,164,6,53,1,164,182,111,116,7,115,135,121,247,104,
+123,135,135,123,3,94,252,195,254,74,1,182,8,84,1,182,254,74,60,95,121,135,
+0,1,0,186,252,70,6,152,8,6,0,24,0,0,1,34,6,21,17,20,22,51,33,50,54,53,17,
+51,17,16,33,33,32,17,17,16,33,51,21,2,86,119,108,108,119,2,168,117,110,183,
+254,92,253,106,254,92,1,164,170,7,115,135,121,247,104,123,135,135,123,3,94,
+252,195,254,74,1,182,8,84,1,182,147,0,1,0,186,252,70,10,55,8,6,0,24,0,0,1,
+34,6,21,17,20,22,51,33,50,54,53,17,51,17,16,33,33,32,17,17,16,33,33,21,2,
+86,119,108,108,119,6,72,116,111,182,254,92,249,203,254,92,1,164,3,25,7,115,
+135,121,247,104,123,135,135,123,3,94,252,195,254,74,1,182,8,84,1,182,147,
+0,0,1,0,186,252,68,6,152,8,6,0,24,0,0,1,34,6,21,17,20,22,51,51,21,35,32,17,
+17,16,33,33,32,17,21,35,53,52,38,35,2,86,119,108,108,119,88,80,254,92,1,164,
+2,148,1,166,183,112,117,7,115,135,121,247,102,123,135,147,1,182,8,86,1,182,
+254,74,60,95,121,135,0,0,1,0,186,252,68,10,55,8,6,0,24,0,0,1,34,6,21,17,20,
+22,51,33,21,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,2,86,119,108,108,
+119,4,47,251,217,254,92,1,164,6,51,1,166,182,113,116,7,115,135,121,247,102,
+123,135,147,1,182,8,86,1,182,254,74,60,95,121,135,0,0,1,0,186,252,82,10,55,
+8,6,0,22,0,0,1,36,17,17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,20,
+22,23,1,213,254,229,1,164,6,51,1,166,183,112,117,249,187,119,108,57,41,252,
+82,65,1,103,8,86,1,182,254,74,60,95,121,135,135,121,247,102,98,106,24,0,1,
+0,186,252,68,10,55,8,6,0,24,0,0,1,34,6,21,17,20,22,51,51,21,35,32,17,17,16,
+33,33,32,17,21,35,53,52,38,35,2,86,119,108,108,119,88,80,254,92,1,164,6,51,
+1,166,182,113,116,7,115,135,121,247,102,123,135,147,1,182,8,86,1,182,254,
+74,60,95,121,135,0,0,1,0,186,252,68,3,8,8,6,0,17,0,0,1,34,6,21,17,20,22,51,
+51,21,35,32,17,17,16,33,51,21,2,86,119,108,108,119,88,80,254,92,1,164,170,
+7,115,135,121,247,102,123,135,147,1,182,8,86,1,182,147,0,0,1,0,186,252,68,
+6,133,8,6,0,17,0,0,1,34,6,21,17,20,22,51,33,21,33,32,17,17,16,33,33,21,2,
+86,119,108,108,119,4,47,251,217,254,92,1,164,3,25,7,115,135,121,247,102,123,
+135,147,1,182,8,86,1,182,147,0,1,0,186,252,82,3,8,8,6,0,15,0,0,1,36,17,17,
+16,33,51,21,35,34,6,21,17,20,22,23,1,213,254,229,1,164,170,178,119,108,63,
+35,252,82,65,1,103,8,86,1,182,147,135,121,247,102,100,109,19,0,0,1,0,186,
+252,68,5,119,8,6,0,17,0,0,1,34,6,21,17,20,22,51,51,21,35,32,17,17,16,33,33,
+21,2,86,119,108,108,119,88,80,254,92,1,164,3,25,7,115,135,121,247,102,123,
+135,147,1,182,8,86,1,182,147,0,2,253,14,252,68,254,197,255,206,0,5,0,6,0,
+0,5,51,17,33,21,33,19,253,14,183,1,0,254,73,90,100,253,51,139,3,138,0,0,1,
+0,166,252,68,2,92,4,74,0,5,0,0,1,33,17,51,17,33,2,92,254,74,180,1,2,252,68,
+8,6,248,133,0,0,3,250,119,252,66,1,0,0,0,0,50,0,51,0,52,0,0,1,22,51,50,54,
+53,52,38,35,34,6,7,22,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,22,23,
+7,38,38,53,52,54,51,50,23,54,51,50,18,21,20,6,35,34,38,39,1,33,254,76,51,
+76,105,151,133,123,84,150,49,4,8,108,94,90,62,83,152,118,115,143,67,60,91,
+86,112,237,181,217,127,125,219,193,229,240,168,59,99,43,2,242,252,113,252,
+227,24,147,131,131,172,102,82,16,64,39,135,217,59,114,54,145,98,138,165,151,
+146,100,149,54,114,59,217,135,207,236,181,181,254,255,184,183,234,16,20,3,
+154,0,4,251,43,252,181,0,127,0,0,0,50,0,51,0,52,0,53,0,0,1,22,22,51,50,54,
+53,52,38,35,34,6,7,22,21,20,7,39,54,54,53,52,38,35,34,6,21,20,23,7,38,38,
+53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,1,33,17,254,18,19,
+51,25,63,96,88,82,67,90,29,6,166,80,52,45,105,74,73,96,81,79,64,88,184,133,
+79,134,48,32,131,80,156,172,169,126,53,72,33,2,156,252,242,253,174,8,10,88,
+98,84,109,66,59,41,37,217,88,118,39,86,64,98,105,105,98,125,64,118,45,164,
+100,153,179,56,77,55,78,185,137,148,173,16,16,2,199,252,181,0,4,251,209,252,
+63,1,0,0,0,0,26,0,36,0,37,0,38,0,0,4,6,7,39,54,54,51,50,22,21,20,2,35,34,
+38,39,54,54,51,50,22,23,54,53,52,38,35,3,22,51,50,55,38,38,35,34,6,1,33,253,
+25,125,35,133,41,196,135,193,223,222,194,145,223,39,102,181,96,86,135,51,
+8,141,109,217,76,141,125,64,41,107,69,53,95,4,70,252,113,238,90,88,66,110,
+140,248,178,179,255,0,158,144,72,69,51,47,38,54,134,152,254,48,119,88,37,
+47,31,2,168,0,0,4,252,51,252,181,254,162,0,0,0,26,0,35,0,36,0,37,0,0,4,6,
+7,39,54,54,51,50,22,21,20,6,35,34,38,39,54,54,51,50,22,23,54,53,52,38,35,
+3,22,51,50,55,38,38,35,34,19,17,253,51,90,27,120,34,154,104,140,172,169,143,
+110,172,29,55,146,82,55,94,35,6,75,89,145,51,96,87,38,24,76,47,70,99,231,
+52,59,59,86,97,184,136,135,188,118,123,41,66,33,23,21,22,66,111,254,200,82,
+62,22,29,2,0,252,181,0,3,251,195,252,70,255,33,0,0,0,25,0,26,0,27,0,0,0,22,
+23,7,38,38,53,52,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,1,33,
+252,104,66,59,94,86,110,237,178,186,238,119,86,92,60,71,139,117,110,142,2,
+185,254,80,253,131,139,47,131,59,217,135,202,241,243,200,135,217,59,131,47,
+137,94,139,166,159,144,2,31,0,0,3,252,35,252,181,254,170,0,0,0,25,0,26,0,
+27,0,0,0,22,23,7,38,38,53,52,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,
+6,21,19,17,252,182,56,38,86,63,92,177,144,147,179,98,66,84,40,58,96,78,73,
+103,187,254,20,94,32,123,45,164,100,158,174,176,148,103,169,45,125,32,88,
+64,94,107,101,96,1,172,252,181,0,3,250,102,252,63,1,0,0,0,0,66,0,67,0,68,
+0,0,5,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,62,2,53,52,38,
+35,34,6,7,39,54,54,51,50,22,21,20,6,6,21,20,22,51,50,54,53,52,38,39,55,22,
+22,21,20,7,22,22,51,50,54,53,52,38,35,34,7,1,33,254,4,43,100,70,170,219,227,
+189,108,184,54,70,179,107,175,218,36,74,86,22,23,16,41,25,86,50,77,68,84,
+96,66,126,121,116,109,162,64,59,94,98,94,12,41,133,99,118,129,141,104,76,
+51,2,188,252,113,137,20,19,232,196,182,253,95,94,104,85,184,146,56,101,85,
+72,43,16,22,18,27,88,52,43,99,71,72,89,114,94,72,106,164,141,94,137,50,131,
+76,217,121,63,58,76,106,166,127,137,141,24,1,12,0,0,3,251,43,252,181,255,
+166,0,0,0,64,0,65,0,66,0,0,5,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,54,53,52,35,34,6,7,39,54,54,51,50,22,21,20,6,6,21,20,22,51,50,
+54,53,52,39,55,22,22,21,20,6,7,22,22,51,50,54,53,52,38,35,34,7,39,17,253,
+238,33,63,51,126,167,168,145,82,138,41,56,129,83,137,156,53,85,27,14,23,14,
+72,36,63,57,65,72,55,76,76,79,83,104,82,80,73,78,6,6,35,94,66,79,89,97,61,
+51,33,180,129,15,14,175,147,133,188,63,68,76,55,137,104,67,92,68,29,27,17,
+14,72,38,40,86,56,52,71,75,58,47,67,121,81,121,70,119,56,163,93,22,49,17,
+53,61,112,82,94,97,19,248,252,181,0,3,251,197,252,63,1,0,0,0,0,25,0,26,0,
+27,0,0,0,54,55,23,6,6,35,34,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,
+22,51,1,33,253,188,134,34,133,47,202,129,202,224,221,194,138,198,47,131,35,
+135,86,111,139,136,120,3,154,252,113,252,201,84,92,66,116,132,253,180,176,
+252,129,117,68,90,86,161,125,131,168,3,55,0,0,3,252,35,252,181,254,137,0,
+0,0,25,0,26,0,27,0,0,0,54,55,23,6,6,35,34,38,53,52,54,51,50,22,23,7,38,38,
+35,34,6,21,20,22,51,19,17,253,162,84,18,129,35,151,98,158,172,173,150,103,
+147,35,125,16,90,58,79,93,94,82,11,253,156,53,51,49,90,96,178,143,136,186,
+97,88,55,51,58,104,85,88,104,2,100,252,181,0,5,251,197,252,63,1,0,0,0,0,11,
+0,27,0,36,0,37,0,38,0,0,2,6,35,34,38,53,52,54,51,50,22,21,1,22,22,21,20,6,
+7,22,51,50,54,53,52,38,35,34,3,54,53,52,38,39,6,21,20,1,33,246,224,202,186,
+225,227,190,193,227,254,4,49,60,57,50,41,54,113,134,141,106,52,149,76,37,
+39,64,4,154,252,113,253,57,250,247,186,180,248,255,184,1,29,53,137,88,84,
+136,55,14,165,113,131,174,254,21,82,115,55,104,41,80,123,118,2,141,0,5,252,
+33,252,181,254,170,0,0,0,11,0,28,0,36,0,37,0,38,0,0,0,6,35,34,38,53,52,54,
+51,50,22,21,37,22,22,21,20,7,22,51,51,50,54,53,52,38,35,34,6,3,54,53,52,39,
+6,21,20,19,17,254,170,171,153,151,174,173,152,150,174,254,152,28,33,61,10,
+11,22,71,96,90,80,10,20,113,41,41,47,197,253,205,180,180,137,140,186,177,
+143,184,38,92,58,106,78,4,107,75,88,111,2,254,190,55,76,76,55,51,82,76,1,
+246,252,181,0,5,250,123,252,63,1,0,0,0,0,38,0,54,0,66,0,67,0,68,0,0,0,38,
+35,34,6,7,39,54,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,
+34,38,39,54,54,51,50,22,23,54,53,55,22,21,20,7,22,22,51,50,54,53,52,38,35,
+34,6,1,22,22,51,50,54,55,38,38,35,34,6,1,33,253,10,130,120,86,131,37,131,
+41,203,137,92,177,59,66,167,109,194,228,222,190,119,168,65,59,179,98,141,
+217,35,70,190,123,82,133,55,2,146,18,18,41,145,86,129,127,137,119,86,145,
+253,96,39,119,71,78,109,28,41,118,64,65,109,5,172,252,113,254,110,166,90,
+86,68,108,136,72,78,68,82,243,185,182,251,85,65,78,72,154,139,82,105,47,41,
+10,23,141,54,73,92,52,65,90,166,131,131,155,92,254,148,64,63,63,53,35,49,
+41,2,150,0,5,251,41,252,181,255,150,0,0,0,38,0,47,0,64,0,65,0,66,0,0,4,6,
+7,39,54,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,39,
+54,54,51,50,22,23,54,53,52,38,35,3,22,51,50,55,38,38,35,34,36,38,35,34,6,
+7,22,21,20,6,7,22,22,51,50,54,53,1,17,252,41,88,29,121,35,156,102,71,132,
+47,33,127,86,153,173,170,150,82,129,49,48,119,75,110,170,31,55,146,82,57,
+96,35,2,91,73,145,51,96,84,43,26,74,47,72,2,250,88,82,68,90,28,6,6,4,40,91,
+59,85,85,254,115,231,52,59,59,86,97,56,77,55,78,183,145,132,183,61,47,55,
+53,118,123,41,66,27,20,8,33,68,102,254,200,82,62,22,29,172,107,66,59,37,31,
+16,52,18,47,51,111,73,1,170,252,181,0,4,251,186,252,63,1,0,0,0,0,44,0,56,
+0,57,0,58,0,0,5,39,34,39,34,6,21,20,22,51,50,54,55,23,6,35,34,38,53,52,54,
+51,50,22,22,21,20,6,21,20,22,51,21,35,34,38,53,6,6,35,34,38,53,52,54,22,54,
+53,52,38,35,34,6,21,20,22,51,1,33,253,135,24,9,16,111,137,133,123,49,93,34,
+97,107,158,201,227,227,199,145,186,69,8,51,61,29,92,116,19,43,35,90,106,32,
+203,39,39,28,29,41,41,29,2,231,252,113,242,3,1,157,129,133,164,28,33,106,
+95,251,182,179,249,85,118,57,35,64,18,49,33,137,84,71,10,10,108,74,47,70,
+174,39,28,29,41,41,29,28,39,1,180,0,4,252,27,252,181,254,213,0,0,0,42,0,54,
+0,55,0,56,0,0,5,38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,38,53,52,54,51,
+50,22,21,20,6,21,20,22,51,21,35,34,38,39,6,6,35,34,38,53,52,54,22,54,53,52,
+38,35,34,6,21,20,22,51,3,17,253,84,6,12,62,86,92,84,72,47,92,47,94,72,150,
+171,171,148,149,150,6,38,48,23,69,92,11,16,29,22,68,86,17,170,30,30,23,22,
+29,29,22,104,236,3,112,73,88,108,43,101,39,32,181,140,138,184,115,80,29,30,
+17,36,23,131,45,59,6,6,78,65,27,41,104,28,23,22,29,29,22,23,28,1,106,252,
+181,0,3,251,197,251,182,1,104,4,74,0,19,0,35,0,45,0,0,1,17,1,6,6,35,34,38,
+53,52,54,51,50,22,21,20,6,7,5,17,1,22,22,21,20,6,7,22,51,50,54,53,52,38,35,
+34,3,54,54,53,52,38,39,6,21,20,1,104,253,48,54,152,106,184,227,226,189,193,
+229,16,19,1,211,252,86,46,61,57,48,41,52,113,134,138,107,52,151,39,37,35,
+41,62,4,74,247,108,1,2,53,68,244,187,181,249,254,187,43,90,45,170,7,195,250,
+184,52,138,88,84,136,55,14,165,113,129,176,254,21,41,100,56,55,104,41,80,
+123,116,0,3,0,186,252,68,4,215,4,217,0,43,0,44,0,45,0,0,1,50,54,53,53,51,
+16,33,35,32,17,17,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,36,51,50,22,
+18,21,20,2,6,35,34,38,39,17,20,22,51,19,19,3,57,119,111,184,254,90,211,254,
+92,144,51,184,119,172,197,199,170,119,184,51,144,56,1,10,174,163,249,145,
+145,249,163,92,156,63,108,119,82,42,252,215,135,123,33,254,74,1,182,3,63,
+74,127,129,230,194,182,232,129,129,73,154,180,141,254,246,158,161,254,243,
+143,49,45,253,143,123,135,8,2,250,245,0,3,250,70,252,61,1,0,0,0,0,43,0,44,
+0,45,0,0,19,52,38,35,35,53,50,22,21,21,20,6,35,33,39,54,54,53,52,38,35,34,
+6,21,20,22,23,7,38,38,53,52,54,51,50,22,21,20,6,7,37,50,54,53,19,33,23,91,
+82,22,170,180,164,166,253,66,66,91,86,159,130,131,166,84,92,66,116,131,251,
+181,176,252,31,35,2,10,82,91,233,252,113,254,27,82,73,164,162,168,127,159,
+174,131,34,136,86,107,143,136,120,87,133,34,134,48,202,129,201,225,220,197,
+68,102,50,2,76,80,2,125,0,3,251,18,252,181,255,227,0,0,0,43,0,44,0,45,0,0,
+3,52,38,35,35,53,51,50,22,21,21,20,6,35,33,39,54,54,53,52,38,35,34,6,21,20,
+23,7,38,38,53,52,54,51,50,22,21,20,6,7,33,50,54,53,1,17,166,61,54,34,24,126,
+136,123,122,253,241,53,49,57,102,86,88,106,106,51,88,99,178,146,138,184,17,
+20,1,116,54,61,254,23,254,135,55,52,141,122,109,134,120,129,125,16,90,57,
+78,94,92,84,121,41,129,37,152,96,154,178,177,149,45,65,33,51,53,1,242,252,
+181,0,0,4,0,186,252,68,4,213,4,217,0,36,0,37,0,38,0,39,0,0,1,34,38,53,17,
+55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,36,51,50,22,18,21,20,2,6,35,34,
+38,39,17,20,22,51,1,7,3,1,203,152,121,144,51,184,119,171,196,199,168,119,
+184,51,144,56,1,10,174,163,250,142,142,249,164,92,156,65,43,47,2,79,202,178,
+252,68,129,145,3,227,74,127,129,231,191,182,232,129,127,73,154,180,141,254,
+249,163,164,254,247,142,49,45,253,14,59,68,3,39,50,5,11,0,5,0,186,252,68,
+8,113,4,217,0,64,0,65,0,66,0,67,0,68,0,0,37,6,6,35,34,38,39,17,20,22,51,51,
+21,35,32,17,17,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,36,51,50,22,18,
+21,20,7,7,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,0,17,20,2,6,35,34,
+38,5,33,23,19,4,123,88,234,143,92,156,63,108,119,28,20,254,92,144,51,184,
+119,172,197,199,170,119,184,51,144,56,1,10,174,164,249,144,7,11,67,182,138,
+169,197,199,163,113,76,65,57,133,92,227,1,38,143,248,164,146,233,3,153,253,
+122,106,22,219,123,116,49,45,253,143,123,135,147,1,182,3,63,74,127,129,230,
+194,182,232,129,129,73,154,180,139,254,250,158,45,44,69,116,152,233,187,190,
+224,37,135,29,24,254,203,254,252,161,254,245,141,120,100,50,5,11,0,0,4,0,
+127,252,68,4,154,4,217,0,50,0,51,0,52,0,53,0,0,1,34,38,53,17,23,22,22,51,
+50,54,55,53,6,6,35,34,38,2,53,52,18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,
+51,50,54,55,23,17,6,4,35,34,39,17,20,22,51,9,2,1,203,152,121,27,98,246,123,
+86,160,71,65,158,92,164,249,142,142,250,163,174,1,10,56,144,51,184,119,166,
+201,198,169,119,184,51,144,101,254,252,137,162,149,43,47,2,109,254,112,1,
+144,252,68,129,145,2,170,20,76,88,43,41,176,47,49,142,1,9,164,163,1,7,141,
+180,154,73,127,129,228,186,195,227,129,127,74,254,29,74,92,57,254,111,59,
+68,1,221,6,35,249,181,0,2,250,152,249,135,0,96,0,0,0,69,0,70,0,0,4,6,7,39,
+54,54,51,50,22,22,21,20,6,7,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,
+22,21,20,2,35,34,38,39,6,6,35,34,38,39,17,20,22,51,33,50,54,53,53,51,16,33,
+33,32,17,17,55,22,22,51,50,54,53,52,38,35,37,251,203,133,35,139,41,198,150,
+123,187,107,6,4,45,143,83,111,136,134,111,70,57,64,43,98,70,167,224,221,197,
+106,170,57,52,168,129,69,107,39,74,80,3,72,80,73,166,254,197,252,176,254,
+197,135,35,131,86,123,133,144,106,1,80,238,86,90,64,110,140,103,202,117,34,
+51,22,83,103,161,132,124,154,24,129,22,17,227,199,178,254,255,87,86,75,98,
+33,27,254,78,82,90,90,82,8,254,182,1,74,2,104,64,92,82,166,131,129,157,238,
+0,0,2,251,82,251,14,255,168,0,0,0,66,0,67,0,0,4,6,7,39,54,54,51,50,22,21,
+20,7,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,38,39,6,
+6,35,34,39,17,20,22,51,33,50,54,53,53,51,21,20,35,33,34,53,17,55,22,22,51,
+50,54,53,52,38,35,55,252,63,86,22,129,29,147,111,152,173,6,35,94,64,77,89,
+95,63,45,37,55,55,90,127,168,171,144,82,129,37,39,141,87,79,54,52,53,2,90,
+53,49,152,238,253,133,235,125,22,86,54,84,92,94,78,252,231,54,55,51,86,103,
+189,125,39,26,62,71,110,82,94,97,19,119,29,174,148,135,184,61,59,55,67,26,
+254,219,56,61,61,56,6,17,245,245,1,206,51,53,51,106,86,80,109,231,0,0,6,0,
+127,252,38,5,156,4,217,0,26,0,44,0,70,0,71,0,72,0,73,0,0,36,54,55,23,6,4,
+35,34,0,53,52,18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,1,33,21,33,17,
+6,6,35,34,36,39,53,22,4,51,50,36,55,1,38,38,35,34,6,21,20,22,51,50,55,21,
+51,21,33,53,35,34,38,53,52,54,51,50,23,3,17,53,3,33,184,51,144,58,254,243,
+187,242,254,215,145,249,163,174,1,10,56,144,51,184,119,169,200,208,161,1,
+240,1,2,254,73,87,171,57,144,254,249,89,119,1,3,122,116,1,1,119,254,69,22,
+54,28,92,78,71,76,66,51,158,254,217,4,150,145,174,160,90,73,116,131,129,127,
+74,154,179,1,68,249,158,1,10,141,180,154,73,129,129,229,177,192,240,252,76,
+139,2,184,35,14,70,69,170,94,64,64,94,253,221,4,8,32,35,27,33,11,166,139,
+155,115,82,101,108,19,6,119,247,77,30,0,4,0,127,252,38,4,156,4,217,0,40,0,
+67,0,68,0,69,0,0,1,6,6,35,34,36,39,53,22,4,51,50,36,55,17,16,33,35,34,38,
+53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,51,50,54,53,2,54,55,23,6,
+4,35,34,0,53,52,18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,19,3,3,229,87,
+171,57,144,254,249,89,119,1,3,122,116,1,1,119,254,82,203,197,215,186,134,
+100,135,66,127,33,73,58,53,93,120,106,219,123,112,196,184,51,144,58,254,243,
+187,242,254,215,145,249,163,174,1,10,56,144,51,184,119,169,200,208,161,8,
+20,254,252,35,14,70,69,170,94,64,64,94,253,195,254,129,141,135,121,143,60,
+52,107,27,41,56,59,59,68,115,102,2,211,129,127,74,154,179,1,68,249,158,1,
+10,141,180,154,73,129,129,229,177,192,240,4,86,247,77,0,0,6,0,127,252,68,
+5,156,4,217,0,26,0,44,0,45,0,46,0,47,0,48,0,0,36,54,55,23,6,4,35,34,0,53,
+52,18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,1,33,21,33,17,6,6,35,34,36,
+39,53,22,4,51,50,54,55,1,33,19,3,3,33,184,51,144,58,254,243,187,242,254,215,
+145,249,163,174,1,10,56,144,51,184,119,169,200,208,161,1,240,1,2,254,73,87,
+171,57,146,254,251,89,119,1,5,120,140,246,106,252,198,1,4,78,28,131,129,127,
+74,154,179,1,68,249,158,1,10,141,180,154,73,129,129,229,177,192,240,252,76,
+139,2,168,35,15,77,79,170,102,72,84,90,254,182,6,35,250,245,0,3,250,29,251,
+139,1,0,0,0,0,58,0,59,0,60,0,0,1,38,38,53,52,54,51,50,22,21,20,6,7,39,54,
+54,53,52,38,35,34,6,21,20,22,23,7,33,38,38,53,52,54,55,35,6,6,21,20,22,23,
+33,21,35,17,51,38,38,53,52,54,55,33,6,6,21,20,22,23,1,33,253,29,31,35,241,
+187,179,253,131,117,63,90,84,168,129,132,157,86,90,65,254,133,55,72,16,21,
+133,15,12,53,48,254,217,127,215,17,12,41,41,1,195,83,57,29,25,4,106,252,113,
+252,227,56,105,79,165,230,224,202,129,203,47,133,35,133,86,121,135,143,106,
+86,136,34,132,78,203,105,59,104,47,43,106,61,99,200,87,180,1,88,58,102,62,
+102,182,86,103,194,73,60,110,52,3,29,0,0,3,251,80,252,145,255,227,0,0,0,56,
+0,57,0,58,0,0,1,38,38,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,
+21,20,22,23,7,33,38,38,53,52,55,35,6,6,21,20,22,23,35,21,35,17,51,38,38,53,
+52,54,55,33,6,6,21,20,22,23,19,17,253,131,18,17,184,138,148,173,96,88,51,
+104,104,90,84,103,56,53,55,254,206,41,55,21,95,10,8,41,35,178,117,117,11,
+8,31,29,1,116,58,38,18,15,78,253,166,33,65,45,148,178,180,152,96,152,37,129,
+41,121,84,92,94,78,57,90,16,125,57,154,77,74,68,35,60,47,73,148,65,138,1,
+21,41,61,45,78,135,66,74,146,59,43,75,29,2,90,252,181,0,0,4,250,70,252,57,
+1,0,0,0,0,54,0,55,0,56,0,57,0,0,1,20,22,51,5,38,38,53,52,54,51,50,22,21,20,
+6,7,39,54,54,53,52,38,35,34,6,21,20,22,23,7,33,34,38,53,53,52,54,51,50,22,
+21,20,6,7,39,54,54,53,52,38,35,34,6,21,1,33,19,250,223,92,80,2,13,35,31,252,
+176,179,253,131,117,63,90,84,168,129,125,164,86,88,65,253,67,166,163,154,
+120,107,139,51,43,111,22,29,45,49,68,51,6,33,252,113,10,253,127,80,76,2,49,
+103,67,197,221,224,202,129,203,47,133,35,133,86,121,135,135,114,86,136,34,
+132,175,159,158,152,155,125,106,79,118,47,84,28,58,43,39,68,105,67,1,233,
+252,68,0,0,3,251,18,252,181,255,227,0,0,0,52,0,53,0,54,0,0,1,20,22,51,33,
+38,38,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,23,7,33,
+34,38,53,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,1,17,251,156,
+61,55,1,115,18,17,184,138,148,173,96,88,51,104,104,90,84,103,56,53,55,253,
+241,123,125,115,109,86,116,35,26,111,31,31,34,48,34,1,213,254,14,53,51,33,
+65,45,148,178,180,152,96,152,37,129,41,121,84,92,94,78,57,90,16,125,129,120,
+123,105,137,100,88,58,87,34,64,37,53,27,45,72,47,1,133,252,181,0,5,0,184,
+252,38,5,156,4,217,0,43,0,90,0,91,0,92,0,93,0,0,1,22,22,51,50,54,55,21,51,
+21,35,39,6,6,35,34,38,39,53,50,22,51,50,54,53,52,38,35,34,7,7,39,54,54,51,
+50,22,21,20,6,35,34,38,39,1,6,6,35,34,36,39,19,55,22,22,51,50,54,53,52,38,
+35,34,6,7,39,54,36,51,50,22,18,21,20,2,6,35,34,38,39,21,22,22,51,50,54,55,
+17,33,21,33,1,17,7,1,170,31,63,23,59,131,51,119,229,2,41,70,39,62,97,48,35,
+78,47,109,78,70,96,60,42,77,34,47,114,64,149,136,145,122,41,41,18,2,57,73,
+156,82,137,254,252,103,2,144,51,184,119,172,197,199,170,119,184,51,144,56,
+1,10,174,163,249,145,145,249,163,92,158,65,71,160,86,147,251,96,1,2,254,73,
+254,195,6,253,35,8,4,32,31,172,102,147,10,10,16,14,236,4,35,22,29,37,11,22,
+100,17,18,81,79,81,87,2,2,1,164,28,19,64,59,1,227,74,127,129,230,194,182,
+232,129,129,73,154,180,141,254,246,158,161,254,243,143,49,47,158,33,26,82,
+59,252,207,139,8,149,247,107,30,0,0,3,0,113,252,68,4,205,4,217,0,77,0,78,
+0,79,0,0,5,17,33,21,33,17,38,38,53,52,54,55,55,54,54,53,52,38,35,34,6,7,39,
+54,54,51,50,22,21,20,14,2,21,20,22,23,52,38,39,53,22,23,23,51,50,54,53,52,
+38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,22,23,54,54,53,52,38,39,55,22,18,
+21,20,2,1,17,3,14,1,0,254,74,222,245,70,59,70,39,43,39,35,31,59,35,102,61,
+100,78,112,126,41,174,58,144,139,22,35,22,23,49,11,59,73,71,58,37,69,23,35,
+41,86,41,133,119,100,78,35,12,121,145,94,90,107,121,143,247,254,200,8,252,
+215,139,3,172,16,238,172,99,150,53,62,33,53,35,29,45,37,39,102,66,57,134,
+79,62,98,151,118,66,109,149,17,60,51,6,115,5,2,4,41,43,45,39,14,6,106,17,
+16,117,82,84,90,14,35,76,35,219,174,140,205,69,131,83,254,210,164,219,254,
+193,4,186,247,107,0,0,4,250,29,252,57,1,0,0,0,0,43,0,44,0,45,0,46,0,0,1,22,
+22,21,20,6,7,33,39,54,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,
+50,22,21,20,6,7,51,54,53,52,38,39,33,53,51,17,19,33,3,254,82,22,19,72,55,
+254,133,66,91,86,160,127,131,168,84,92,66,116,131,251,181,176,252,37,29,135,
+54,57,81,2,162,125,119,252,113,31,254,147,52,115,43,95,213,78,132,34,136,
+86,111,138,135,121,86,133,35,133,47,203,129,201,225,221,197,67,97,53,103,
+119,73,194,103,121,254,231,1,109,252,68,0,3,250,244,252,181,255,135,0,0,0,
+44,0,45,0,46,0,0,1,22,22,21,20,6,7,33,39,54,54,53,52,38,35,34,6,21,20,22,
+23,7,38,38,53,52,54,51,50,22,21,20,6,7,51,54,54,53,52,38,39,33,53,51,21,1,
+17,254,59,11,10,55,41,254,206,53,53,54,105,82,86,108,51,55,53,88,96,186,137,
+132,188,22,19,102,17,16,39,57,1,159,115,253,234,254,199,37,76,29,71,162,55,
+125,22,88,53,80,92,92,84,53,86,23,129,37,152,96,154,178,166,147,51,70,35,
+35,82,55,51,125,78,90,227,1,57,252,181,0,0,3,251,182,252,63,1,0,0,0,0,42,
+0,43,0,44,0,0,0,54,55,55,54,54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,14,
+2,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,53,1,33,251,199,
+52,46,53,23,22,22,23,37,45,86,50,82,63,81,99,53,91,51,111,129,125,145,63,
+59,92,84,110,234,188,204,211,5,57,252,113,253,212,113,42,47,22,35,23,16,22,
+45,88,49,44,104,64,71,76,83,83,56,72,106,174,131,94,140,47,129,60,219,133,
+201,248,180,150,2,119,0,0,3,252,20,252,181,254,162,0,0,0,36,0,37,0,38,0,0,
+0,54,54,53,52,35,34,7,39,54,54,51,50,22,21,20,6,6,21,20,22,51,50,54,53,52,
+39,55,22,22,21,20,6,35,34,38,53,1,17,252,33,57,80,29,22,29,70,38,66,58,65,
+66,61,70,72,78,86,106,82,78,66,88,194,150,141,156,1,80,254,87,95,64,28,27,
+31,72,38,32,78,51,61,74,71,61,47,69,116,86,125,66,119,45,164,101,151,182,
+133,110,1,244,252,181,0,6,0,113,252,68,10,6,4,217,0,26,0,96,0,120,0,121,0,
+122,0,123,0,0,1,38,38,35,34,6,21,20,22,51,50,55,17,51,21,33,17,35,34,38,53,
+52,54,51,50,22,23,0,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,
+0,53,52,18,54,51,50,22,23,54,54,51,50,22,23,54,54,51,50,22,18,21,20,0,35,
+34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,21,20,22,21,20,6,35,34,38,53,
+1,38,38,35,34,6,7,22,22,21,20,6,21,20,22,51,50,54,53,52,38,53,52,54,1,5,1,
+8,115,45,95,53,178,154,157,147,98,78,231,254,141,73,212,227,255,241,66,122,
+58,251,37,41,194,157,158,198,206,157,30,56,26,43,41,84,57,220,254,210,139,
+244,161,113,182,68,53,119,94,92,126,46,68,182,113,161,244,140,254,211,222,
+59,84,41,41,29,55,31,157,205,192,156,162,194,41,179,143,151,168,1,241,39,
+82,53,67,80,33,41,45,43,68,67,67,66,41,43,4,121,248,242,4,120,254,213,10,
+13,76,70,62,75,16,254,238,139,1,2,155,105,155,148,17,14,1,219,156,74,199,
+231,231,193,190,224,4,8,143,12,8,1,67,248,158,1,13,140,67,60,57,70,75,52,
+60,67,140,254,242,157,246,254,187,8,12,143,8,4,220,194,191,233,231,199,78,
+156,57,135,133,142,126,2,112,43,54,60,37,65,158,86,91,144,64,53,78,78,53,
+66,140,91,86,160,252,176,41,5,43,255,255,0,113,252,61,9,154,4,217,2,38,0,
+19,0,0,0,7,0,241,7,138,0,4,255,255,0,113,252,59,9,154,4,217,2,38,0,19,0,0,
+0,7,0,245,7,178,0,2,0,4,249,229,252,63,1,0,0,0,0,66,0,89,0,90,0,91,0,0,0,
+54,53,52,38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,38,53,52,54,54,51,50,22,
+23,54,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,55,22,51,50,54,53,
+52,38,35,34,6,21,20,22,21,20,6,35,34,38,53,1,38,38,35,34,6,7,22,22,21,20,
+6,21,20,22,51,50,54,53,52,38,53,52,1,33,252,100,29,143,107,121,129,138,106,
+45,33,41,33,61,45,171,221,107,189,122,88,137,54,42,91,78,63,90,39,53,140,
+88,189,226,221,170,43,63,31,39,33,45,102,142,132,118,107,143,28,130,130,123,
+135,1,123,24,52,41,46,51,23,26,29,35,49,47,50,49,33,3,88,252,113,253,74,108,
+70,129,141,162,122,127,154,8,141,10,7,251,180,121,201,108,50,45,44,51,54,
+41,45,50,249,181,182,249,7,10,141,8,145,136,122,162,139,131,69,106,42,100,
+128,121,107,1,180,29,35,37,27,47,105,59,65,105,47,39,57,57,39,47,103,65,121,
+1,133,0,0,4,250,199,252,181,0,10,0,0,0,67,0,90,0,91,0,92,0,0,0,54,53,52,38,
+35,34,6,21,20,22,51,51,50,55,23,6,6,35,34,38,53,52,54,51,50,22,23,54,54,51,
+50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,55,22,51,51,50,54,53,52,38,35,
+34,6,21,20,22,21,20,6,35,34,38,53,1,38,38,35,34,6,7,22,21,20,6,21,20,22,51,
+50,54,53,52,38,53,52,54,3,17,252,150,20,98,72,82,88,98,68,28,13,10,37,25,
+47,32,131,162,173,140,66,104,41,31,68,57,47,65,31,39,106,66,138,175,168,125,
+34,48,22,35,10,15,28,68,96,88,82,72,96,20,102,111,95,113,1,32,15,34,27,28,
+36,15,28,24,37,34,37,37,24,16,55,253,244,55,55,86,99,109,86,92,94,4,127,6,
+4,185,134,143,181,37,31,31,37,39,29,31,37,183,141,137,182,4,6,127,4,94,92,
+86,109,95,90,55,55,35,76,108,97,87,1,45,15,22,22,15,61,70,47,76,33,28,39,
+39,28,33,74,47,37,65,1,33,252,181,0,0,4,250,121,252,63,1,0,0,0,0,37,0,49,
+0,50,0,51,0,0,1,54,54,51,50,18,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,
+35,34,6,7,22,22,21,20,6,35,34,38,53,52,54,51,50,0,22,51,50,54,53,52,38,35,
+34,6,21,1,33,253,113,61,178,105,193,229,240,168,59,99,43,62,51,76,105,151,
+133,123,84,148,49,4,8,227,199,187,224,225,191,217,254,41,139,117,109,147,
+145,111,115,141,5,229,252,113,254,231,91,90,254,255,184,183,234,16,20,125,
+24,147,131,131,172,100,82,16,64,37,170,252,248,183,181,249,253,211,164,157,
+121,137,168,161,136,2,23,0,4,251,47,252,181,255,174,0,0,0,38,0,50,0,51,0,
+52,0,0,5,54,54,51,50,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,
+34,6,7,22,21,20,6,35,34,38,53,52,54,51,50,22,0,22,51,50,54,53,52,38,35,34,
+6,21,1,17,253,113,39,129,79,151,175,170,123,51,74,32,47,18,49,27,63,99,90,
+80,55,100,34,6,171,152,152,176,178,150,92,119,254,125,88,88,86,88,93,79,86,
+92,1,170,227,59,68,179,143,152,169,16,16,117,8,10,88,98,84,109,53,72,37,37,
+138,173,172,151,142,178,68,254,170,102,104,78,89,110,111,88,1,174,252,181,
+0,0,5,250,121,252,63,1,0,0,0,0,23,0,35,0,51,0,52,0,53,0,0,5,54,54,51,50,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,0,22,51,50,54,53,52,38,
+35,34,6,21,37,22,21,20,7,22,22,51,50,54,53,52,38,35,34,6,1,33,253,88,66,170,
+110,192,226,229,185,116,169,65,59,176,89,187,224,225,191,86,174,253,254,139,
+117,109,147,145,111,115,141,2,133,18,18,41,145,86,129,127,137,119,86,145,
+3,55,252,113,250,68,82,248,182,185,246,85,65,78,72,248,183,181,249,72,254,
+27,164,157,121,137,168,161,136,140,54,73,92,52,65,90,166,131,131,155,92,1,
+74,0,0,5,251,33,252,181,255,172,0,0,0,22,0,34,0,50,0,51,0,52,0,0,5,54,54,
+51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,0,22,51,50,54,53,
+52,38,35,34,6,21,36,38,35,34,7,22,22,21,20,6,7,22,51,50,54,53,1,17,253,102,
+44,123,93,152,170,168,158,86,127,43,45,129,82,159,166,169,152,174,254,166,
+90,88,93,90,94,87,90,90,3,94,88,82,122,68,4,6,6,4,68,122,84,86,254,93,205,
+44,61,185,143,135,180,61,43,53,51,181,134,143,185,254,104,104,108,80,84,109,
+111,84,86,107,99,18,60,16,16,52,18,98,108,76,1,170,252,181,0,0,3,251,215,
+252,63,1,0,0,0,0,46,0,47,0,48,0,0,0,23,7,38,38,53,52,54,51,50,22,21,20,6,
+7,21,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,35,53,51,50,
+54,53,52,38,35,34,6,21,1,33,252,156,16,117,20,27,186,164,178,177,70,59,67,
+90,196,193,144,212,37,133,35,135,96,99,121,91,98,16,8,70,104,84,106,114,95,
+4,100,252,113,254,145,16,63,26,64,39,92,125,128,104,69,80,23,8,21,86,86,118,
+138,122,110,67,79,76,70,59,39,61,142,53,53,39,59,63,35,1,84,0,3,252,57,252,
+181,254,131,0,0,0,44,0,45,0,46,0,0,0,23,7,38,38,53,52,54,51,50,22,21,20,7,
+21,22,22,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,35,53,51,50,54,53,
+52,38,35,34,6,21,19,17,252,231,11,113,16,19,129,133,131,134,80,43,59,140,
+136,111,166,33,117,45,143,70,72,62,65,12,4,47,71,57,72,61,66,138,254,217,
+10,55,20,49,29,63,99,97,82,94,24,9,17,65,63,89,103,79,93,59,104,47,30,29,
+35,125,26,31,27,39,31,18,1,20,252,181,0,0,5,251,197,252,63,1,0,0,0,0,11,0,
+28,0,39,0,40,0,41,0,0,2,6,35,34,38,53,52,54,51,50,22,21,4,22,21,54,54,51,
+50,22,23,54,53,52,38,35,34,6,21,5,38,35,34,6,7,22,22,51,50,54,1,33,246,227,
+199,185,226,226,189,196,226,253,92,2,52,125,77,78,125,51,2,146,110,111,145,
+1,211,90,121,55,108,45,32,107,69,72,107,2,231,252,113,253,59,252,247,184,
+181,249,254,185,6,18,8,39,49,47,41,6,14,149,164,162,135,172,86,47,41,53,61,
+63,2,248,0,5,252,35,252,181,254,172,0,0,0,11,0,25,0,35,0,36,0,37,0,0,0,6,
+35,34,38,53,52,54,51,50,22,21,5,21,54,54,51,50,22,23,53,52,38,35,34,6,5,38,
+35,34,6,7,22,51,50,54,3,17,254,172,170,156,150,173,170,153,156,170,254,12,
+35,86,53,54,86,34,83,91,86,88,1,60,56,86,36,74,31,49,92,48,71,108,253,205,
+180,183,132,142,186,185,135,6,6,26,29,29,24,4,79,116,115,201,47,28,23,67,
+38,2,68,252,181,0,0,5,0,70,255,206,4,197,4,217,0,47,0,59,0,60,0,61,0,62,0,
+0,5,39,6,6,35,35,34,36,53,52,54,51,50,4,23,54,53,52,38,36,38,53,52,54,51,
+50,22,22,23,7,39,38,35,34,6,21,20,22,23,23,30,2,21,20,6,7,23,37,50,55,38,
+38,35,34,6,21,20,22,51,19,3,23,4,15,54,52,133,55,162,245,254,244,189,130,
+143,1,89,124,37,150,254,145,178,219,150,104,131,92,97,109,86,90,141,80,115,
+87,91,158,165,137,68,55,36,53,254,75,50,41,125,241,100,67,75,158,140,181,
+72,2,33,45,16,16,143,139,116,128,181,122,45,61,72,96,118,131,116,120,156,
+33,43,77,115,60,63,70,53,49,65,30,53,52,87,117,84,77,115,31,53,92,6,98,121,
+47,49,60,69,4,88,251,39,50,0,4,251,231,251,253,1,0,0,0,0,43,0,53,0,54,0,55,
+0,0,1,35,34,38,53,52,54,51,50,22,23,54,53,52,46,2,53,52,54,51,50,22,22,23,
+7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,7,21,35,39,51,38,38,35,34,6,
+21,20,22,1,33,253,68,41,148,160,136,98,122,141,9,115,91,254,93,143,100,73,
+96,52,60,90,43,86,57,37,62,41,69,101,105,122,141,123,157,37,37,5,71,49,32,
+50,95,4,44,252,113,252,70,111,106,93,118,151,140,14,94,52,75,97,99,77,91,
+118,31,31,53,100,39,45,37,33,34,35,26,40,43,119,107,108,125,12,77,206,86,
+73,34,41,41,43,3,53,0,4,252,72,252,127,254,137,0,0,0,38,0,47,0,48,0,49,0,
+0,1,35,34,38,53,52,54,51,50,22,23,54,53,52,38,38,53,52,54,51,50,22,23,7,38,
+38,35,34,6,21,20,22,22,21,20,6,7,21,35,39,51,38,38,35,34,6,21,20,19,17,253,
+66,23,109,118,90,71,84,120,20,57,214,91,102,80,79,88,44,80,26,60,41,22,31,
+178,129,100,86,141,13,10,8,45,28,10,29,170,253,29,84,77,66,90,96,94,16,49,
+72,70,84,65,72,84,46,40,88,22,33,17,16,30,61,99,101,78,100,14,62,176,41,37,
+12,20,46,2,109,252,127,0,3,251,195,252,63,1,0,0,0,0,25,0,26,0,27,0,0,0,38,
+39,55,22,22,21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,1,33,
+254,100,71,60,92,86,119,237,187,180,235,110,86,94,59,66,142,110,117,139,2,
+156,252,113,254,90,143,50,129,60,223,133,200,245,246,199,133,223,60,129,50,
+145,92,143,160,164,141,2,2,0,0,3,252,35,252,181,254,170,0,0,0,25,0,26,0,27,
+0,0,0,38,39,55,22,22,21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,
+53,3,17,254,20,57,41,84,66,98,180,146,145,176,92,63,86,38,56,103,73,78,96,
+163,254,164,92,31,125,45,170,107,148,173,175,156,101,166,45,123,31,96,64,
+98,100,106,96,1,154,252,181,0,4,251,195,252,63,1,0,0,0,0,26,0,37,0,38,0,39,
+0,0,1,38,38,53,16,55,22,22,21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,
+50,54,55,54,53,52,38,39,6,6,21,20,22,1,33,253,184,44,54,201,102,133,247,175,
+174,243,110,86,94,59,66,142,110,23,43,141,58,37,29,39,33,41,2,244,252,113,
+252,223,57,142,98,1,6,142,60,217,135,203,246,247,202,135,217,60,129,50,139,
+94,145,158,8,96,70,137,65,105,41,41,94,70,59,113,2,158,0,0,4,252,35,252,181,
+254,170,0,0,0,25,0,35,0,36,0,37,0,0,1,38,38,53,52,55,22,22,21,20,6,35,34,
+38,53,52,54,55,23,6,6,21,20,22,51,50,55,54,53,52,38,39,6,21,20,22,3,17,253,
+143,25,34,152,92,98,183,143,141,180,96,59,86,40,54,101,75,23,125,33,27,20,
+31,22,114,253,162,41,96,66,198,105,47,170,105,149,172,172,159,114,157,41,
+123,31,98,62,96,102,75,45,82,41,72,29,45,82,41,74,1,254,252,181,0,0,4,251,
+195,252,63,1,0,0,0,0,23,0,40,0,41,0,42,0,0,5,6,21,20,22,51,50,54,53,52,39,
+55,22,22,21,20,6,35,34,38,53,52,54,55,3,6,21,20,22,51,50,54,53,52,38,39,6,
+6,35,34,38,1,33,252,240,13,83,52,46,86,13,92,89,116,243,181,176,239,110,86,
+8,23,142,110,113,143,10,10,30,111,93,88,116,4,102,252,113,195,30,27,55,72,
+68,61,27,30,93,60,223,133,200,245,247,198,135,221,60,254,239,61,82,148,155,
+157,148,37,63,29,60,83,91,1,181,0,0,4,252,35,252,181,254,170,0,0,0,23,0,40,
+0,41,0,42,0,0,5,6,21,20,22,51,50,54,53,52,39,55,22,22,21,20,6,35,34,38,53,
+52,54,55,21,6,6,21,20,22,51,50,54,53,52,39,6,6,35,34,38,19,17,253,20,10,62,
+32,31,60,11,78,66,98,180,146,145,176,92,63,4,4,103,73,78,96,6,22,79,67,65,
+84,160,174,25,14,41,45,45,41,20,19,74,47,169,106,148,173,175,156,101,164,
+47,236,16,39,23,96,102,104,98,33,29,35,51,57,1,121,252,181,0,3,250,152,252,
+63,1,0,0,0,0,52,0,53,0,54,0,0,4,6,7,39,54,54,51,50,22,23,54,54,51,50,18,21,
+20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,34,6,7,22,22,21,20,6,35,34,38,
+39,55,22,22,51,50,54,53,52,38,35,37,33,251,203,135,35,131,47,201,133,104,
+172,66,61,180,103,193,229,240,168,59,99,43,62,51,76,105,151,133,123,84,150,
+49,4,8,228,198,129,202,47,133,34,132,86,122,136,140,112,4,225,252,113,238,
+86,90,68,117,129,88,93,91,90,254,255,184,183,234,16,20,125,24,147,131,131,
+172,102,82,16,60,28,183,250,134,116,64,92,82,166,131,127,159,238,0,0,3,251,
+74,252,181,255,168,0,0,0,52,0,53,0,54,0,0,4,6,7,39,54,54,51,50,22,23,54,54,
+51,50,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,22,22,21,
+20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,37,17,252,55,90,16,125,35,151,
+99,92,123,41,34,122,87,156,172,169,126,53,72,33,47,19,51,25,63,96,88,82,67,
+90,29,4,2,178,154,96,153,35,129,41,121,81,95,95,77,1,0,231,58,51,55,88,97,
+68,65,55,78,185,137,148,173,16,16,117,8,10,88,98,84,109,66,59,21,33,20,137,
+174,96,90,49,104,104,88,86,103,231,252,181,0,4,251,195,252,63,1,0,0,0,0,31,
+0,43,0,44,0,45,0,0,1,54,54,51,50,22,23,54,54,53,52,38,39,55,22,22,21,20,6,
+35,34,38,53,52,54,55,23,6,6,21,20,22,5,38,38,35,34,6,7,22,22,51,50,54,1,33,
+252,109,51,125,77,72,123,51,2,2,71,60,92,86,119,237,187,180,235,110,86,94,
+59,66,2,1,203,41,104,58,57,108,45,30,105,69,74,105,2,233,252,113,253,176,
+41,47,47,39,21,34,21,92,143,50,129,60,223,133,200,245,246,199,133,223,60,
+129,50,145,92,21,36,144,39,43,43,41,53,59,61,3,2,0,0,4,252,35,252,181,254,
+170,0,0,0,29,0,37,0,38,0,39,0,0,1,54,54,51,50,22,23,53,52,38,39,55,22,22,
+21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,5,38,35,34,7,22,51,50,3,17,252,
+184,37,86,53,50,86,36,57,41,84,66,98,180,146,145,176,92,63,86,38,56,2,1,56,
+62,74,73,64,47,88,93,82,254,66,24,31,31,24,36,62,92,31,125,45,170,107,148,
+173,175,156,101,166,45,123,31,96,64,10,14,119,45,45,66,2,111,252,181,0,3,
+250,117,252,63,1,0,0,0,0,51,0,52,0,53,0,0,0,38,39,55,22,22,21,20,7,22,22,
+51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,1,33,253,23,74,60,95,86,118,6,
+41,125,101,118,129,141,104,76,51,64,43,100,70,170,219,224,192,104,178,58,
+55,172,115,182,233,112,84,95,60,67,143,111,114,142,3,233,252,113,254,90,143,
+50,129,60,223,133,59,46,74,114,164,123,137,141,24,131,20,19,232,196,180,246,
+80,92,82,99,242,203,134,221,61,129,50,145,92,143,160,164,141,2,2,0,0,3,251,
+47,252,181,255,166,0,0,0,51,0,52,0,53,0,0,0,38,39,55,22,22,21,20,6,7,22,22,
+51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,35,34,38,39,6,35,34,38,
+53,52,54,55,23,6,6,21,20,22,51,50,54,53,19,17,253,35,58,40,83,66,98,2,2,27,
+94,66,79,89,97,61,51,33,55,33,63,51,126,167,170,143,78,140,36,105,147,149,
+175,94,64,88,41,55,102,74,78,96,78,254,164,92,31,125,45,170,107,18,29,12,
+60,71,110,82,94,97,19,119,15,14,175,147,134,185,61,59,122,180,151,101,166,
+45,123,31,96,64,98,100,106,96,1,154,252,181,0,5,0,113,252,68,4,201,4,217,
+0,25,0,34,0,35,0,36,0,37,0,0,1,52,38,35,34,6,7,4,0,17,6,6,35,34,0,53,52,18,
+54,51,50,22,18,21,17,35,1,38,38,39,20,22,51,50,54,3,1,51,4,18,204,166,146,
+178,33,1,15,1,45,47,117,61,251,254,214,143,249,165,163,249,143,183,254,187,
+8,231,179,199,172,10,22,32,254,212,210,2,33,187,237,156,125,24,254,160,254,
+218,16,22,1,68,247,162,1,9,140,141,254,246,160,250,29,4,65,179,214,17,189,
+223,2,4,84,250,245,0,0,4,251,143,249,135,1,0,0,0,0,24,0,40,0,41,0,42,0,0,
+1,22,22,23,6,35,34,38,53,52,54,51,50,4,21,17,51,21,33,17,52,38,35,34,6,19,
+38,39,38,39,38,39,38,39,20,23,22,23,22,23,22,1,33,252,57,193,215,10,78,84,
+197,229,223,193,184,1,0,193,254,162,155,132,86,125,234,9,27,28,38,38,45,45,
+43,18,17,35,35,50,50,4,2,252,113,254,94,31,242,239,31,243,190,177,251,240,
+186,252,20,127,4,105,112,178,96,254,25,65,50,49,34,33,19,18,6,57,50,51,36,
+37,21,22,3,53,0,4,252,12,251,14,255,70,0,0,0,24,0,32,0,33,0,34,0,0,1,22,22,
+23,6,35,34,38,53,52,54,51,50,22,21,17,51,21,33,17,52,38,35,34,6,19,38,39,
+38,39,20,23,22,19,1,252,166,149,136,4,54,69,152,168,177,149,165,189,146,254,
+227,118,97,55,99,142,11,46,46,78,47,46,131,254,202,254,180,30,185,174,22,
+186,135,142,180,186,144,253,47,115,3,66,91,118,56,254,173,83,41,41,23,86,
+51,51,2,106,252,181,0,3,250,100,252,63,1,0,0,0,0,45,0,46,0,47,0,0,4,6,21,
+20,22,51,50,55,23,6,6,35,34,38,53,52,54,51,50,22,18,22,51,50,54,53,52,38,
+35,34,7,39,54,54,51,50,22,21,20,6,35,34,38,2,38,35,37,33,251,147,135,142,
+104,74,53,61,40,97,71,169,225,229,189,154,225,110,143,105,101,137,138,112,
+69,58,59,41,100,70,170,221,224,180,173,213,112,147,98,5,0,252,113,244,159,
+125,134,149,25,129,23,23,237,196,181,247,201,254,139,139,162,129,127,151,
+26,131,20,19,233,195,183,250,216,1,104,141,244,0,0,3,251,41,252,181,255,184,
+0,0,0,44,0,45,0,46,0,0,4,6,21,20,22,51,50,55,23,6,6,35,34,38,53,52,54,51,
+50,22,18,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,35,34,38,2,
+35,37,17,252,25,97,86,72,49,35,55,30,64,53,126,167,167,144,115,182,102,154,
+70,88,88,70,24,39,21,53,31,63,53,127,166,162,141,128,171,113,147,1,23,229,
+99,96,86,100,16,123,14,12,174,147,135,187,148,254,148,108,84,90,101,9,10,
+119,16,13,176,146,129,192,148,1,110,229,252,181,0,3,250,150,252,63,1,0,0,
+0,0,52,0,53,0,54,0,0,4,6,7,39,54,54,51,50,22,21,20,6,7,22,22,51,50,54,53,
+52,38,35,34,7,39,54,54,51,50,22,21,20,2,35,34,38,39,6,6,35,34,38,39,55,22,
+22,51,50,54,53,52,38,35,37,33,251,201,133,35,131,45,198,138,195,222,4,4,44,
+143,82,110,137,143,102,76,51,64,43,100,70,168,221,222,194,102,174,57,52,171,
+128,129,204,47,135,34,132,86,122,134,139,111,4,225,252,113,238,86,90,68,117,
+129,251,177,29,51,21,82,104,158,133,137,141,24,131,20,19,229,197,179,255,
+0,87,86,74,99,134,116,64,92,82,166,131,125,161,238,0,0,3,251,82,252,181,255,
+166,0,0,0,52,0,53,0,54,0,0,4,6,7,39,54,54,51,50,22,21,20,6,7,22,22,51,50,
+54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,39,
+55,22,22,51,50,54,53,52,38,35,55,17,252,61,88,16,127,35,147,105,147,176,2,
+2,29,96,62,79,89,97,61,51,33,55,33,63,51,126,167,168,145,72,131,49,41,123,
+96,97,151,35,127,20,84,58,82,94,93,79,250,231,58,51,55,88,97,185,137,20,33,
+14,54,71,112,82,94,97,19,119,15,14,175,147,133,188,57,61,55,63,96,90,49,51,
+53,104,88,85,104,231,252,181,0,0,3,250,117,252,63,1,0,0,0,0,52,0,53,0,54,
+0,0,0,38,39,55,22,22,23,54,54,51,50,22,21,20,6,35,34,39,55,22,22,51,50,54,
+53,52,38,35,34,6,7,22,22,21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,
+50,54,53,1,33,253,25,74,60,93,41,71,29,55,168,98,196,222,221,172,125,84,64,
+24,68,35,112,133,127,120,81,131,59,4,4,235,186,185,233,110,86,95,60,65,141,
+111,114,144,3,231,252,113,254,90,143,50,129,29,82,51,78,84,246,186,196,233,
+39,134,15,12,153,125,129,162,83,103,21,51,26,190,241,247,198,133,223,60,129,
+50,145,92,143,160,164,141,2,2,0,3,251,41,252,181,255,168,0,0,0,52,0,53,0,
+54,0,0,0,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,52,38,39,55,22,22,23,
+54,54,51,50,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,22,
+21,20,6,35,1,17,251,216,175,94,64,86,39,56,103,74,77,97,58,41,84,29,53,23,
+35,127,71,156,172,169,126,53,72,33,47,19,51,25,63,96,88,82,59,100,27,6,174,
+151,1,4,253,25,180,151,101,166,45,123,31,96,64,98,100,106,96,62,92,31,125,
+21,57,37,51,64,185,137,148,173,16,16,117,8,10,88,98,84,109,74,55,29,35,142,
+175,2,231,252,181,0,4,0,127,252,68,4,154,4,217,0,57,0,83,0,84,0,85,0,0,1,
+50,54,53,53,51,16,33,35,32,17,17,22,22,51,50,54,55,53,6,6,35,34,38,2,53,52,
+18,54,51,50,4,23,7,38,38,35,34,6,21,20,22,51,50,54,55,23,17,6,4,35,34,38,
+39,17,20,22,51,19,38,35,34,6,21,20,51,50,54,55,21,51,21,35,53,35,34,38,53,
+52,54,51,50,22,23,3,19,3,0,117,110,183,254,92,152,254,92,121,236,139,86,158,
+71,65,158,92,163,249,143,142,250,163,174,1,15,51,144,51,184,117,171,198,196,
+173,117,184,51,144,101,254,252,135,84,158,71,110,119,195,41,39,68,59,110,
+27,44,17,117,219,4,113,108,112,138,34,62,28,161,12,252,215,113,102,27,254,
+123,1,133,2,61,72,77,37,34,148,47,49,143,1,10,164,161,1,7,141,183,151,73,
+129,129,233,181,192,232,129,127,74,254,52,66,82,29,26,254,156,100,113,1,104,
+11,27,27,45,7,4,127,105,119,86,59,68,92,8,6,6,53,247,107,0,3,250,6,252,57,
+1,0,0,0,0,56,0,57,0,58,0,0,5,6,6,21,20,23,51,38,38,53,52,54,51,50,22,21,20,
+6,7,39,54,54,53,52,38,35,34,6,21,20,22,23,7,33,38,38,53,52,54,55,35,34,6,
+21,21,20,22,51,51,21,34,38,53,53,52,54,51,37,33,253,35,83,56,53,135,31,35,
+243,185,180,253,131,117,66,90,84,166,131,128,158,86,88,66,254,135,55,74,17,
+20,229,84,90,90,84,22,172,178,164,166,5,176,252,113,203,102,197,73,119,103,
+56,105,79,166,229,224,202,129,203,47,133,35,133,86,121,135,139,110,86,136,
+34,132,78,203,105,59,104,47,75,80,121,82,74,164,162,168,96,160,172,203,0,
+0,3,250,242,252,181,255,195,0,0,0,55,0,56,0,57,0,0,1,34,6,21,21,20,22,51,
+51,21,35,34,38,53,53,52,54,51,33,6,6,21,20,22,23,51,38,53,52,54,51,50,22,
+21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,23,7,33,38,38,53,52,55,19,17,251,
+240,56,61,61,56,22,12,126,138,126,121,1,97,62,43,19,12,102,39,183,137,146,
+178,97,90,51,106,104,90,84,102,55,51,53,254,192,34,48,21,246,254,197,52,55,
+76,53,51,141,118,113,86,122,128,77,146,56,43,75,29,74,86,134,175,178,154,
+96,152,37,129,41,121,84,92,94,78,57,90,16,125,57,156,77,70,68,1,59,252,181,
+0,0,4,250,119,252,63,1,0,0,0,0,65,0,81,0,82,0,83,0,0,3,38,38,35,34,6,7,6,
+6,7,21,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,35,53,51,50,
+54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,51,50,18,21,
+20,6,35,34,39,54,54,3,50,55,54,55,54,55,54,53,6,7,6,7,6,7,6,1,33,115,32,152,
+88,92,137,52,8,63,54,60,98,196,193,146,212,35,135,33,135,96,99,120,90,96,
+19,7,71,107,86,109,113,94,19,119,20,25,182,166,117,158,38,123,183,204,250,
+228,198,84,80,11,217,74,68,51,51,34,34,17,17,43,44,44,38,39,28,28,2,117,252,
+113,254,94,84,96,65,62,53,67,19,8,19,82,92,118,138,124,108,67,79,76,71,58,
+39,61,142,53,53,39,59,63,35,27,16,63,26,64,39,91,126,58,53,111,255,0,172,
+190,243,31,240,241,254,140,22,21,37,36,51,50,57,6,18,19,33,34,49,50,2,244,
+0,0,4,251,68,252,181,255,147,0,0,0,64,0,72,0,73,0,74,0,0,0,23,7,38,38,53,
+52,54,51,50,23,54,54,51,50,22,21,20,6,35,34,39,54,54,55,38,38,35,34,6,7,6,
+7,21,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,35,53,51,50,
+54,53,52,38,35,34,6,21,1,50,55,54,53,6,7,6,3,17,251,244,10,115,14,21,132,
+131,165,66,53,127,53,158,182,168,151,70,53,4,135,152,23,98,59,68,104,39,17,
+59,41,61,141,137,111,166,32,118,23,94,70,71,70,61,66,12,6,47,72,60,71,60,
+65,2,102,88,46,46,77,46,47,243,254,217,10,55,20,49,29,63,99,78,41,37,187,
+135,138,183,22,174,185,30,53,56,51,41,64,18,9,17,66,62,88,104,79,93,59,53,
+51,47,30,29,35,125,26,31,27,39,31,18,254,170,51,51,86,23,41,41,2,23,252,181,
+0,0,3,250,102,252,63,1,0,0,0,0,66,0,67,0,68,0,0,1,22,51,50,54,53,52,38,35,
+34,6,7,22,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,22,21,20,6,35,34,38,
+39,55,22,22,51,50,54,53,52,46,2,53,52,54,51,50,22,23,54,54,51,50,22,21,20,
+6,35,34,38,39,1,33,254,68,51,76,111,134,129,118,87,137,43,4,2,94,98,94,123,
+161,110,116,121,102,90,95,85,68,77,50,86,25,41,16,23,22,87,73,36,218,175,
+104,185,71,54,180,108,190,226,219,170,70,100,43,2,252,252,113,252,236,27,
+151,127,127,166,100,78,31,57,37,121,217,76,132,98,180,141,166,106,72,88,101,
+95,85,70,100,44,51,88,27,18,22,17,42,72,86,101,55,147,183,69,103,80,92,254,
+180,197,232,19,22,3,152,0,3,251,43,252,181,255,166,0,0,0,63,0,64,0,65,0,0,
+1,22,51,50,54,53,52,38,35,34,6,7,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,
+22,22,21,20,6,35,34,38,39,55,22,22,51,50,53,52,38,38,53,52,54,51,50,22,23,
+54,54,51,50,22,21,20,6,35,34,38,39,3,17,254,37,31,53,61,97,91,79,66,92,29,
+6,78,73,80,82,107,80,79,76,71,60,70,67,57,63,36,72,14,23,14,27,90,48,156,
+137,78,144,57,37,131,82,144,169,160,133,52,62,33,125,253,172,16,92,94,86,
+111,70,59,41,33,92,164,55,118,70,121,94,111,68,49,56,73,71,56,55,86,40,37,
+72,14,17,27,29,74,90,63,104,138,46,87,57,76,189,135,142,177,14,14,2,203,252,
+181,0,0,5,251,199,252,63,1,0,0,0,0,29,0,39,0,50,0,51,0,52,0,0,4,22,23,6,6,
+35,34,38,39,6,6,21,20,22,23,54,54,51,50,22,23,6,6,35,34,38,53,52,54,51,3,
+22,51,50,55,38,38,35,34,6,1,38,38,35,34,7,22,22,51,50,54,1,33,253,244,230,
+36,69,185,121,82,141,51,6,5,5,6,51,139,84,121,185,69,36,228,144,191,224,224,
+191,178,58,118,133,72,37,88,49,65,103,1,86,35,108,60,120,58,39,104,64,47,
+90,2,244,252,113,100,159,112,45,80,37,35,22,56,30,29,51,25,35,39,80,45,111,
+162,252,179,178,252,253,114,67,80,22,31,37,1,152,41,38,69,27,37,31,1,84,0,
+5,252,35,252,181,254,154,0,0,0,28,0,39,0,49,0,50,0,51,0,0,4,22,23,6,6,35,
+34,38,39,6,21,20,22,23,54,54,51,50,22,23,6,6,35,34,38,53,52,54,51,3,22,22,
+51,50,54,55,38,38,35,34,19,38,38,35,34,7,22,51,50,54,3,17,253,202,177,31,
+55,138,94,60,98,33,6,2,4,33,96,60,91,137,61,29,172,107,149,174,168,153,123,
+19,63,43,45,78,23,29,69,37,86,221,23,78,41,90,39,50,86,37,69,106,100,113,
+98,35,57,22,23,29,35,16,35,14,22,25,54,41,92,116,187,132,130,194,254,28,18,
+23,27,25,16,16,1,13,24,29,43,43,16,1,33,252,181,0,0,3,249,84,252,63,1,186,
+0,0,0,77,0,78,0,79,0,0,3,22,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,
+21,20,6,35,34,38,39,6,6,35,34,39,6,6,35,34,38,39,55,22,22,51,50,54,53,52,
+38,35,34,6,7,39,54,54,51,50,22,21,20,7,22,22,51,50,54,53,52,38,35,34,7,39,
+54,54,51,50,22,21,20,6,1,33,238,48,131,88,116,131,141,104,76,51,64,43,101,
+67,167,224,224,191,105,166,67,51,183,100,205,135,51,185,108,137,201,41,133,
+37,129,84,125,133,125,123,86,135,35,131,41,205,147,185,221,8,47,131,90,113,
+135,138,108,78,49,63,40,99,69,172,222,4,1,233,252,113,253,139,90,98,165,130,
+137,141,24,129,20,19,227,199,183,252,82,86,86,82,168,86,82,140,110,64,82,
+88,163,130,123,157,84,86,68,110,136,235,191,72,31,90,98,164,131,127,151,24,
+129,20,19,237,189,33,53,2,100,0,0,3,250,100,252,181,0,174,0,0,0,75,0,76,0,
+77,0,0,1,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,39,
+6,6,35,34,39,6,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,54,
+51,50,22,21,20,6,7,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,
+1,17,254,184,27,102,62,82,86,90,70,49,33,55,55,92,124,169,168,143,154,100,
+37,131,78,149,101,37,135,92,102,152,31,129,21,86,59,90,88,90,77,62,94,19,
+125,29,148,125,139,170,2,2,26,103,59,82,86,90,68,49,33,57,57,91,122,170,2,
+254,183,254,27,56,71,112,80,88,103,19,119,29,170,152,133,188,114,49,65,114,
+49,65,102,84,49,53,51,110,82,92,97,54,55,55,78,107,166,150,22,37,10,56,71,
+112,80,92,99,19,119,29,169,147,22,37,1,219,252,181,0,5,251,164,252,70,1,0,
+0,0,0,25,0,37,0,49,0,50,0,51,0,0,0,22,23,7,38,38,53,52,54,51,50,22,21,20,
+6,7,39,54,54,53,52,38,35,34,6,21,36,22,21,20,6,35,34,38,53,52,54,51,18,54,
+53,52,38,35,34,6,21,20,22,51,1,33,252,72,82,75,104,94,123,252,194,204,253,
+126,101,103,74,90,160,129,123,161,1,116,117,115,88,90,112,116,86,43,56,58,
+43,41,55,53,43,3,156,252,113,253,131,139,47,131,59,217,135,203,240,245,198,
+121,225,65,131,47,137,94,139,166,159,144,211,114,89,92,110,114,88,89,114,
+254,209,57,43,43,56,56,43,43,57,2,123,0,0,4,252,18,252,181,254,186,0,0,0,
+25,0,37,0,38,0,39,0,0,0,22,23,7,38,38,53,52,54,51,50,22,21,20,6,7,39,54,54,
+53,52,38,35,34,6,21,54,22,21,20,6,35,34,38,53,52,54,51,19,17,252,168,63,45,
+90,69,99,191,147,151,191,106,68,90,47,68,105,86,79,111,231,62,62,41,41,61,
+61,41,11,254,20,94,32,123,45,164,100,164,168,173,151,103,169,45,125,32,88,
+64,94,107,101,96,113,58,55,53,60,60,53,55,58,1,59,252,181,0,0,6,0,119,252,
+68,4,207,4,217,0,40,0,66,0,78,0,89,0,90,0,91,0,0,1,6,6,35,34,36,39,53,22,
+4,51,50,36,55,17,16,33,35,34,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,
+22,51,51,50,54,53,18,38,39,55,22,18,21,16,0,35,34,0,17,52,18,55,23,6,6,21,
+20,22,51,50,54,53,4,38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,51,50,54,53,
+52,38,35,3,19,3,229,87,171,57,144,254,249,89,119,1,3,122,116,1,1,119,254,
+82,203,197,215,186,134,100,135,66,125,33,75,58,53,93,120,106,219,123,112,
+47,94,88,105,124,140,254,194,237,238,254,193,144,120,104,86,96,205,166,166,
+202,254,38,121,120,105,98,127,127,98,45,64,111,47,59,61,45,6,6,254,252,35,
+14,70,69,170,94,64,64,94,253,195,254,129,141,135,121,143,60,52,107,27,41,
+56,59,59,68,111,100,5,31,205,69,131,88,254,213,162,254,250,254,185,1,71,1,
+6,172,1,39,82,131,69,205,140,204,238,240,202,231,116,101,102,115,114,101,
+104,115,1,72,60,51,106,55,51,51,60,2,59,247,107,0,6,0,119,252,68,5,156,4,
+217,0,17,0,43,0,55,0,66,0,67,0,68,0,0,1,33,21,33,17,6,6,35,34,36,39,53,22,
+4,51,50,54,55,2,38,39,55,22,18,21,16,0,35,34,0,17,52,18,55,23,6,6,21,20,22,
+51,50,54,53,4,38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,51,50,54,53,52,38,
+35,3,1,4,154,1,2,254,73,87,171,57,146,254,251,89,119,1,5,120,140,246,106,
+134,94,88,105,124,140,254,194,237,238,254,193,144,120,104,86,96,205,166,166,
+202,254,38,121,120,105,98,127,127,98,45,64,111,47,59,61,45,6,254,194,252,
+207,139,2,168,35,15,77,79,170,102,72,84,90,2,201,205,69,131,88,254,213,162,
+254,250,254,185,1,71,1,6,172,1,39,82,131,69,205,140,204,238,240,202,231,116,
+101,102,115,114,101,104,115,1,72,60,51,106,55,51,51,60,2,59,249,205,0,5,251,
+164,252,63,1,0,0,0,0,25,0,37,0,49,0,50,0,51,0,0,0,38,39,55,22,22,21,20,6,
+35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,38,22,21,20,6,35,34,38,53,
+52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,1,33,254,133,90,74,103,105,122,
+252,205,196,250,123,94,104,75,82,161,123,129,160,199,115,116,87,87,115,112,
+90,41,58,56,45,43,53,55,41,3,156,252,113,254,90,139,47,132,69,227,116,198,
+247,245,200,133,219,60,132,47,141,92,143,160,164,141,192,110,92,87,116,116,
+87,88,114,254,211,56,43,41,57,57,41,43,56,2,111,0,4,252,18,252,181,254,186,
+0,0,0,11,0,37,0,38,0,39,0,0,0,22,21,20,6,35,34,38,53,52,54,51,22,38,39,55,
+22,22,21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,3,17,253,143,
+62,62,41,41,61,61,41,191,68,47,90,68,106,193,149,147,191,99,69,90,45,63,111,
+79,86,105,180,254,209,57,58,53,57,59,51,58,57,45,90,31,125,45,169,106,150,
+171,170,161,101,164,45,123,31,94,64,97,101,106,96,1,154,252,181,0,0,3,251,
+199,252,63,1,0,0,0,0,39,0,40,0,41,0,0,5,23,6,6,21,20,22,51,50,54,53,52,38,
+38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,21,20,6,35,34,38,53,52,
+54,37,33,252,145,95,61,73,146,127,93,144,125,69,96,84,66,82,47,86,25,41,16,
+23,22,129,67,224,183,200,230,104,4,209,252,113,100,129,50,136,97,141,166,
+103,79,92,113,91,73,71,99,45,50,88,27,18,22,16,46,103,123,85,148,182,239,
+206,129,217,170,0,3,252,35,252,181,254,180,0,0,0,37,0,38,0,39,0,0,5,23,6,
+6,21,20,22,51,50,54,53,52,38,53,52,54,51,50,22,23,7,38,38,35,34,21,20,22,
+22,21,20,6,35,34,38,53,52,54,55,17,252,190,86,39,55,102,91,80,75,131,73,65,
+55,65,35,71,17,22,13,26,84,53,172,135,154,184,92,242,100,123,33,92,64,93,
+107,67,47,71,105,80,58,84,41,37,72,14,17,27,31,65,94,66,105,136,170,163,101,
+164,145,252,181,0,0,3,251,182,252,63,1,0,0,0,0,54,0,55,0,56,0,0,0,62,2,53,
+52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,21,20,22,51,50,54,53,52,38,38,
+53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,21,20,6,35,34,38,53,1,33,
+251,199,35,74,87,22,23,16,41,25,86,61,75,59,83,99,91,103,124,125,129,129,
+125,69,96,84,66,82,47,86,25,41,16,23,22,129,67,226,196,189,226,5,57,252,113,
+253,193,102,84,72,43,16,22,18,27,88,61,34,98,72,83,98,101,87,72,110,110,72,
+92,113,91,73,71,99,45,50,88,27,18,22,16,46,103,123,85,150,180,181,149,2,119,
+0,0,3,252,20,252,181,254,180,0,0,0,48,0,49,0,50,0,0,0,54,54,53,52,35,34,7,
+39,54,54,51,50,22,21,20,6,21,20,22,51,50,54,53,52,38,53,52,54,51,50,22,23,
+7,38,38,35,34,21,20,22,22,21,20,6,35,34,38,53,1,17,252,35,50,85,27,20,31,
+72,35,66,55,61,76,131,80,96,93,79,131,73,65,55,65,35,71,17,22,13,26,84,53,
+173,149,165,158,1,78,254,76,92,68,30,27,31,72,37,41,79,63,80,106,70,47,67,
+67,47,71,105,80,58,84,41,37,72,14,17,27,31,65,94,66,103,138,137,104,1,246,
+252,181,0,3,252,53,252,68,1,0,0,0,0,33,0,34,0,35,0,0,1,6,6,35,34,38,53,52,
+54,54,53,52,38,35,34,6,7,35,54,54,51,50,22,21,20,6,6,21,20,22,51,50,54,55,
+1,33,254,156,31,86,39,108,115,72,151,82,57,66,80,10,164,4,171,141,135,172,
+67,156,53,29,18,33,16,2,166,252,113,252,102,20,14,114,78,67,116,139,77,58,
+71,79,62,120,159,157,116,67,115,149,56,37,28,8,10,3,37,0,0,3,252,132,252,
+181,254,87,0,0,0,31,0,32,0,33,0,0,1,6,6,35,34,38,53,52,54,54,53,52,38,35,
+34,6,21,35,52,54,51,50,22,21,20,6,21,20,22,51,50,55,3,17,254,81,25,67,19,
+91,103,61,107,50,34,41,56,143,123,114,111,119,166,37,22,29,23,175,253,29,
+14,14,91,68,67,91,99,53,32,41,59,47,100,131,123,82,87,154,49,27,23,15,2,118,
+252,181,0,5,251,61,249,135,1,0,0,0,0,26,0,63,0,75,0,76,0,77,0,0,0,54,51,50,
+22,22,21,20,6,21,20,22,23,17,51,17,16,33,32,17,17,6,6,35,34,38,53,1,7,6,7,
+17,20,22,51,50,54,53,17,35,34,38,53,6,6,35,34,38,53,52,54,55,39,34,39,34,
+6,21,20,22,51,50,54,55,18,54,53,52,38,35,34,6,21,20,22,51,1,33,251,61,231,
+195,146,184,68,6,61,72,162,254,184,254,186,10,23,12,187,227,2,181,33,16,23,
+80,86,86,78,49,93,116,21,42,34,90,108,35,28,24,9,16,111,137,133,121,51,93,
+34,39,39,39,28,31,39,39,31,3,100,252,113,254,170,242,86,117,57,35,58,20,49,
+35,2,1,186,251,135,254,117,1,141,1,48,2,3,252,181,254,174,25,12,12,254,184,
+129,139,139,129,2,35,84,71,10,10,108,74,47,70,20,3,1,157,129,133,164,28,33,
+1,68,39,28,29,41,41,29,28,39,1,180,0,0,5,251,180,251,12,255,27,0,0,0,27,0,
+61,0,73,0,74,0,75,0,0,0,54,51,50,22,21,20,6,21,20,22,51,51,17,51,17,16,33,
+34,38,53,53,34,6,35,34,38,53,5,6,7,7,21,20,51,50,53,17,35,34,38,39,6,6,35,
+34,38,53,52,54,55,38,35,34,6,21,20,22,51,50,54,55,54,54,53,52,38,35,34,6,
+21,20,22,51,3,1,251,180,175,145,149,150,6,44,58,18,138,255,0,127,125,11,16,
+10,153,173,2,33,10,12,25,121,114,57,68,94,10,16,31,23,65,84,17,12,7,12,57,
+88,90,86,35,69,25,16,29,29,22,23,31,31,23,4,254,72,254,230,182,115,80,29,
+38,13,35,20,1,61,252,199,254,182,175,169,183,2,183,138,244,8,8,16,230,207,
+203,1,115,45,59,6,6,78,65,29,44,17,3,104,81,88,108,28,23,201,28,23,22,29,
+29,22,23,28,1,106,252,181,0,6,251,162,252,63,1,0,0,0,0,11,0,23,0,35,0,47,
+0,48,0,49,0,0,4,4,21,20,4,35,34,36,53,52,36,51,18,54,53,52,38,35,34,6,21,
+20,22,51,18,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,
+22,51,1,33,254,44,1,5,254,254,197,195,254,251,1,5,195,135,169,173,131,127,
+178,171,134,88,115,114,89,90,112,116,86,44,55,58,45,41,53,51,43,3,154,252,
+113,100,250,180,189,242,244,187,185,245,253,37,168,135,127,176,172,131,133,
+170,1,249,115,87,93,110,115,88,88,114,254,211,56,43,43,55,55,43,43,56,2,115,
+0,5,252,23,252,181,254,182,0,0,0,11,0,23,0,35,0,36,0,37,0,0,4,22,21,20,6,
+35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,18,22,21,20,6,35,
+34,38,53,52,54,51,19,17,253,252,186,191,145,150,185,190,145,88,99,103,84,
+82,104,103,83,41,62,62,41,41,61,61,41,11,100,181,147,138,177,182,133,145,
+183,253,250,114,78,78,117,111,84,85,107,1,49,58,55,53,60,60,53,57,56,1,57,
+252,181,0,0,4,251,195,249,135,1,0,0,0,0,62,0,74,0,75,0,76,0,0,1,50,54,53,
+17,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,23,54,54,51,50,22,23,54,54,53,
+52,38,39,55,22,22,21,20,7,17,20,6,35,35,34,38,53,52,54,51,50,22,23,7,38,38,
+35,34,6,21,20,22,51,1,38,38,35,34,6,7,22,22,51,50,54,1,33,253,168,80,76,48,
+112,66,180,235,110,86,94,59,66,2,3,51,125,77,72,123,51,2,2,71,60,92,86,119,
+37,172,159,162,144,165,127,106,78,119,47,84,27,58,46,39,68,105,67,1,43,41,
+104,58,57,108,45,30,105,69,74,105,2,233,252,113,250,35,90,82,1,172,29,31,
+246,199,133,223,60,129,50,145,92,21,36,19,41,47,47,39,21,34,21,92,143,50,
+129,60,223,133,111,88,253,158,166,166,151,126,106,139,53,43,109,22,30,45,
+50,67,51,3,16,39,43,43,41,53,59,61,3,2,0,4,252,35,251,14,0,75,0,0,0,59,0,
+67,0,68,0,69,0,0,1,54,54,51,50,22,23,54,53,52,38,39,55,22,22,21,20,7,17,20,
+6,35,35,34,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,51,50,54,53,
+17,6,35,34,38,53,52,54,55,23,6,6,21,20,5,38,35,34,7,22,51,50,3,1,252,184,
+37,86,53,50,86,34,2,57,41,84,66,98,35,131,119,121,98,143,107,84,53,83,37,
+63,17,49,27,30,39,57,56,114,54,51,68,82,145,176,92,63,86,38,56,1,58,62,74,
+73,64,47,88,93,82,2,218,254,66,24,31,31,25,19,18,62,92,31,125,45,170,107,
+90,70,254,74,123,123,106,107,82,108,32,28,91,12,18,35,32,40,38,61,54,1,43,
+28,175,156,101,166,45,123,31,96,64,16,127,45,45,66,2,111,252,181,0,5,251,
+238,252,181,254,190,0,0,0,19,0,29,0,30,0,31,0,32,0,0,5,21,22,22,23,7,38,38,
+39,21,20,6,35,34,38,53,52,54,55,53,19,53,6,6,21,20,22,51,50,54,19,35,17,253,
+190,86,140,30,84,27,84,61,121,112,98,133,161,148,2,82,78,45,35,39,41,78,2,
+82,178,14,68,20,121,20,46,16,80,116,128,111,100,117,134,7,174,254,121,76,
+2,60,49,37,41,54,2,20,252,181,0,4,252,23,252,181,254,223,0,0,0,23,0,24,0,
+25,0,26,0,0,1,53,51,17,39,38,35,34,6,21,20,51,50,54,55,23,6,6,35,34,38,53,
+52,54,19,35,17,253,43,158,56,30,31,92,72,193,66,150,81,69,51,214,114,158,
+175,138,218,10,254,254,176,254,197,8,4,61,35,107,38,48,114,38,71,120,120,
+89,134,1,6,252,181,0,0,4,251,236,252,181,254,84,0,0,0,5,0,6,0,7,0,8,0,0,5,
+51,1,33,21,33,1,51,17,253,82,174,254,233,1,107,253,152,1,102,31,82,254,6,
+139,2,215,252,181,0,0,4,251,154,249,135,1,0,0,0,0,26,0,42,0,43,0,44,0,0,1,
+51,17,35,34,38,53,52,54,51,50,22,21,17,35,17,52,38,35,34,6,7,22,22,21,17,
+33,19,38,39,38,39,38,39,38,39,20,23,22,23,22,23,22,1,33,252,137,193,6,200,
+226,222,195,186,253,158,154,133,86,125,30,192,225,254,164,197,8,28,28,38,
+39,45,46,43,18,17,35,35,51,51,3,246,252,113,250,4,2,59,244,189,177,251,242,
+184,251,149,4,105,112,178,96,84,31,242,239,253,41,3,68,65,50,49,34,33,19,
+18,6,57,50,51,36,37,21,22,3,53,0,4,252,12,251,14,0,111,0,0,0,25,0,33,0,34,
+0,35,0,0,1,51,17,38,38,53,52,54,51,50,22,21,17,35,17,52,38,35,34,6,7,22,22,
+21,17,33,19,38,39,38,39,20,23,22,19,33,252,170,145,142,161,177,149,165,189,
+139,118,97,55,99,18,149,140,254,227,156,11,46,46,78,47,46,131,2,254,251,129,
+1,152,3,186,132,142,180,186,144,252,188,3,66,91,118,56,53,30,185,174,253,
+223,2,136,83,41,41,23,86,51,51,2,106,0,3,251,227,252,63,1,0,0,0,0,25,0,26,
+0,27,0,0,4,6,7,39,54,54,51,50,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,
+52,38,35,37,33,253,23,136,34,132,48,198,135,198,220,224,202,129,203,47,133,
+35,131,86,123,135,139,110,3,147,252,113,238,86,90,68,117,129,253,175,180,
+253,134,116,64,92,82,166,131,128,158,238,0,0,3,252,68,252,181,254,170,0,0,
+0,25,0,26,0,27,0,0,4,6,7,39,54,54,51,50,22,21,20,6,35,34,38,39,55,22,22,51,
+50,54,53,52,38,35,55,17,253,47,88,16,127,34,148,102,149,177,180,152,96,152,
+34,127,20,84,57,83,93,93,79,9,231,58,51,55,88,97,184,138,148,173,96,90,49,
+51,53,103,89,85,104,231,252,181,0,3,251,195,249,135,1,0,0,0,0,30,0,31,0,32,
+0,0,1,51,17,38,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,52,38,39,55,22,
+22,21,20,6,7,17,33,1,33,252,92,193,161,185,110,86,94,59,66,142,110,117,139,
+71,60,92,86,119,184,154,254,164,4,164,252,113,250,4,2,66,26,238,174,133,223,
+60,129,50,145,92,143,160,164,141,92,143,50,129,60,223,133,178,230,28,253,
+63,6,121,0,3,252,35,251,14,0,107,0,0,0,30,0,31,0,32,0,0,0,38,39,55,22,22,
+21,20,6,7,17,33,53,51,17,38,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,3,
+33,254,20,57,41,84,66,98,143,111,254,227,146,115,139,92,63,86,38,56,103,73,
+78,96,163,2,250,254,164,92,31,125,45,170,107,135,160,20,253,239,115,1,158,
+18,166,141,101,166,45,123,31,96,64,98,100,106,96,1,154,0,0,3,249,190,252,
+63,1,94,0,0,0,72,0,73,0,74,0,0,0,22,23,7,38,38,53,52,54,51,50,22,23,54,54,
+51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,
+34,6,7,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,22,21,20,6,7,39,54,54,53,
+52,38,35,34,6,21,1,33,250,98,68,59,94,86,111,237,179,62,118,48,49,101,71,
+100,182,52,67,160,110,189,227,222,169,70,102,43,66,51,84,101,138,136,111,
+89,141,45,8,123,88,92,66,71,133,106,27,65,23,86,117,86,94,60,73,141,115,110,
+144,6,158,252,113,253,127,141,47,132,60,219,133,205,244,31,29,28,32,82,86,
+86,82,253,182,200,223,16,20,129,24,151,127,138,161,92,100,39,59,152,221,58,
+115,53,146,98,148,161,10,12,115,172,133,219,60,132,47,139,92,141,170,166,
+143,2,37,0,3,250,166,252,181,0,115,0,0,0,70,0,71,0,72,0,0,0,22,23,7,38,38,
+53,52,54,51,50,23,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,55,22,
+22,51,50,54,53,52,38,35,34,6,7,22,21,20,6,7,39,54,54,53,52,38,35,34,7,22,
+21,20,6,7,39,54,54,53,52,38,35,34,6,21,1,17,251,59,56,39,86,64,94,177,146,
+95,78,69,88,80,131,43,50,123,91,143,171,168,125,53,74,33,47,21,49,24,64,98,
+90,82,59,94,35,8,84,82,80,53,43,104,74,30,23,47,98,66,84,40,59,97,77,74,103,
+2,54,254,20,94,32,123,45,165,99,155,179,39,37,58,65,52,71,180,142,148,173,
+16,16,117,8,10,88,98,84,109,66,47,39,47,107,161,43,118,39,86,64,98,107,9,
+75,109,103,169,45,125,32,88,64,94,109,103,96,1,172,252,181,0,3,250,117,249,
+135,1,0,0,0,0,56,0,57,0,58,0,0,1,51,17,38,39,55,22,51,50,54,53,52,38,35,34,
+6,7,22,22,21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,52,38,
+39,55,22,22,23,54,54,51,50,18,21,20,6,7,17,33,1,33,253,207,190,71,56,62,51,
+76,109,147,133,123,105,135,39,4,4,235,186,185,233,110,86,95,60,65,141,111,
+114,144,74,60,93,43,69,29,55,170,107,193,229,188,136,254,164,3,49,252,113,
+250,4,2,66,6,26,125,26,152,128,131,172,111,81,21,51,26,190,241,247,198,133,
+223,60,129,50,145,92,143,160,164,141,92,143,50,129,29,82,51,78,84,254,255,
+184,159,225,25,253,61,6,121,0,0,3,251,41,251,14,255,168,0,0,0,56,0,57,0,58,
+0,0,1,51,17,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,22,21,20,6,35,34,38,
+53,52,54,55,23,6,6,21,20,22,51,50,54,53,52,38,39,55,22,22,23,54,54,51,50,
+22,21,20,6,7,17,33,3,1,253,182,146,56,45,47,19,51,25,63,96,88,82,59,100,27,
+6,186,139,149,175,94,64,86,39,56,103,74,77,97,58,41,84,29,53,23,41,121,71,
+156,172,123,90,254,227,69,253,228,251,129,1,156,6,22,117,8,10,88,98,84,109,
+74,55,29,39,145,168,180,151,101,166,45,123,31,96,64,98,100,106,96,62,92,31,
+125,21,57,37,53,62,185,137,131,156,24,253,235,4,242,252,181,0,0,3,250,102,
+249,135,1,0,0,0,0,72,0,73,0,74,0,0,5,54,54,51,50,22,21,20,6,7,17,33,53,51,
+17,38,38,39,6,6,35,34,38,53,52,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,
+21,20,6,6,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,7,22,22,51,50,54,
+53,52,38,35,34,7,1,33,254,4,43,100,70,170,219,184,150,254,162,193,86,135,
+46,71,185,104,175,218,36,74,86,22,23,16,41,25,86,50,77,68,84,96,66,126,121,
+116,109,162,64,59,94,98,94,2,4,43,137,87,118,129,141,104,76,51,2,188,252,
+113,137,20,19,232,196,164,238,24,253,63,125,2,68,12,86,66,104,69,184,146,
+56,101,85,72,43,16,22,18,27,88,52,43,99,71,72,89,114,94,72,106,164,141,94,
+137,50,131,76,217,121,37,57,31,78,100,166,127,137,141,24,1,12,0,0,3,251,43,
+251,14,255,166,0,0,0,68,0,69,0,70,0,0,5,54,54,51,50,22,21,20,6,7,17,33,53,
+51,17,38,39,6,6,35,34,38,53,52,54,54,53,52,35,34,6,7,39,54,54,51,50,22,21,
+20,6,6,21,20,22,51,50,54,53,52,39,55,22,22,21,20,6,7,22,22,51,50,54,53,52,
+38,35,34,7,39,1,253,238,33,63,51,126,167,127,111,254,230,141,115,75,48,131,
+94,137,156,53,85,27,14,23,14,72,36,63,57,65,72,55,76,76,79,82,105,82,80,73,
+78,2,4,31,90,66,81,89,97,61,51,33,180,253,238,129,15,14,175,147,112,180,21,
+253,237,115,1,158,16,103,62,63,137,104,67,92,68,29,27,17,14,72,38,40,86,56,
+52,71,75,58,47,69,111,93,121,70,119,56,166,98,19,27,19,62,67,112,82,94,97,
+19,248,252,181,0,3,251,182,252,63,1,0,0,0,0,41,0,42,0,43,0,0,2,6,7,39,54,
+54,53,52,38,35,34,6,21,20,22,22,21,20,6,35,34,38,39,55,22,51,50,54,53,52,
+38,39,39,38,38,53,52,54,51,50,22,21,1,33,244,110,84,92,59,63,150,120,129,
+111,106,89,99,81,63,82,50,86,43,39,23,22,22,23,53,45,53,210,205,187,235,1,
+244,252,113,253,86,219,60,130,47,141,92,137,170,108,72,82,103,99,83,65,105,
+45,48,88,43,20,17,24,35,22,48,40,114,75,146,182,247,200,2,35,0,4,252,20,252,
+181,254,162,0,0,0,36,0,37,0,38,0,39,0,0,0,6,7,39,54,53,52,38,35,34,6,21,20,
+22,22,21,20,6,35,34,38,39,55,22,51,50,53,52,38,38,53,52,54,51,50,22,21,1,
+51,17,254,162,88,66,78,82,110,82,78,72,71,60,66,65,58,66,38,70,31,20,29,77,
+60,152,145,151,193,254,167,40,253,233,163,45,118,70,121,87,118,72,47,60,74,
+72,60,52,77,31,38,72,31,27,28,61,96,77,111,133,183,151,1,178,252,181,0,4,
+251,209,252,63,1,0,0,0,0,43,0,53,0,54,0,55,0,0,0,38,39,54,54,51,50,22,23,
+54,53,52,38,35,34,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,55,
+54,54,51,50,22,21,20,2,35,3,22,51,50,55,38,38,35,34,6,1,33,252,215,223,39,
+102,181,96,86,135,51,8,86,65,63,82,102,77,71,109,51,49,88,26,19,23,14,17,
+34,19,39,32,109,70,141,178,221,195,215,76,141,125,64,41,107,69,53,95,4,70,
+252,113,252,63,158,144,72,69,51,47,38,54,137,143,109,98,86,80,56,82,47,86,
+25,35,16,17,18,18,27,50,41,61,221,191,191,254,254,1,3,119,88,37,47,31,2,168,
+0,0,4,252,43,252,181,254,162,0,0,0,38,0,47,0,48,0,49,0,0,4,6,6,35,34,38,53,
+52,54,55,23,6,21,20,51,50,54,51,50,22,21,20,6,35,34,38,39,54,54,51,50,22,
+23,54,54,53,52,38,35,3,22,51,50,55,38,38,35,34,19,17,253,127,57,83,59,57,
+84,43,37,72,31,26,20,124,100,109,131,167,145,110,172,29,55,146,82,55,94,35,
+4,2,53,43,213,51,96,87,38,24,76,47,70,99,229,71,67,68,59,45,60,35,68,29,18,
+27,142,166,142,145,190,118,123,41,66,33,23,11,23,32,76,80,254,198,82,62,22,
+29,2,0,252,181,0,4,251,190,252,63,1,0,0,0,0,41,0,52,0,53,0,54,0,0,2,6,7,38,
+17,52,54,55,38,35,34,6,21,20,22,22,21,20,6,35,34,38,39,55,22,22,51,50,53,
+52,38,39,39,38,38,53,52,54,51,50,22,21,7,54,54,53,52,39,6,6,21,20,22,1,33,
+246,133,102,201,53,45,37,57,119,123,122,59,91,73,58,80,49,86,25,35,16,35,
+18,27,49,44,59,224,188,187,245,223,29,37,58,35,45,33,2,252,252,113,253,86,
+219,60,142,1,6,92,150,57,12,114,86,81,100,86,63,76,109,53,50,88,27,18,39,
+16,35,18,41,35,111,71,153,196,247,202,219,41,105,65,139,70,39,107,69,68,96,
+2,215,0,4,252,35,252,181,254,170,0,0,0,39,0,49,0,50,0,51,0,0,0,22,22,21,20,
+6,35,34,38,39,55,22,22,51,50,53,52,38,38,53,52,54,51,50,22,21,20,6,7,38,53,
+52,54,55,38,38,35,34,6,21,5,54,54,53,52,39,6,6,21,20,3,17,252,182,64,57,67,
+60,43,58,36,67,15,20,13,24,99,44,175,130,156,186,98,92,152,34,25,12,25,22,
+72,86,1,54,20,27,33,23,22,92,254,109,57,83,59,57,84,40,37,74,14,17,27,19,
+86,82,57,110,142,172,152,104,168,47,104,199,66,96,40,5,2,70,57,215,26,72,
+43,80,45,27,74,38,82,2,16,252,181,0,0,4,250,121,252,63,1,0,0,0,0,39,0,51,
+0,52,0,53,0,0,18,6,35,34,38,53,52,54,55,38,38,35,34,6,21,20,22,51,50,55,23,
+6,6,35,34,38,53,52,18,51,50,22,23,54,54,51,50,22,22,21,4,22,51,50,54,53,52,
+38,35,34,6,21,1,33,111,229,185,197,227,8,4,49,147,86,123,131,145,109,73,54,
+61,43,100,60,170,233,226,194,104,180,62,65,172,105,135,192,91,253,94,141,
+113,115,141,142,114,121,133,3,51,252,113,253,54,247,246,176,29,72,16,82,100,
+172,131,127,151,24,125,20,16,236,181,185,1,0,90,91,93,88,126,199,105,131,
+160,165,121,133,164,174,131,2,31,0,0,4,251,47,252,181,255,174,0,0,0,38,0,
+50,0,51,0,52,0,0,2,6,35,34,38,53,52,55,38,38,35,34,6,21,20,22,51,50,54,55,
+23,6,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,21,4,22,51,50,54,53,52,
+38,35,34,6,21,3,17,82,172,154,152,171,6,34,100,54,80,90,98,63,25,49,19,49,
+33,74,51,128,167,172,156,80,129,39,39,119,91,152,174,254,12,88,86,89,88,93,
+86,78,94,73,253,199,174,175,136,37,37,72,53,109,84,98,88,10,8,117,16,16,174,
+147,137,185,68,59,59,68,180,140,88,104,102,80,88,111,110,89,1,174,252,181,
+0,5,250,96,252,63,1,0,0,0,0,33,0,45,0,61,0,62,0,63,0,0,18,6,35,34,38,53,52,
+55,38,38,35,34,6,7,22,22,23,6,35,34,38,53,52,18,51,50,22,23,54,54,51,50,22,
+21,4,22,51,50,54,53,52,38,35,34,6,21,1,38,39,38,39,38,39,38,39,20,23,22,23,
+22,23,22,1,33,86,227,197,185,229,31,47,137,92,86,154,31,191,217,10,78,86,
+197,229,250,207,106,166,60,51,156,110,195,225,253,94,139,117,113,141,140,
+114,114,142,254,96,8,27,28,38,38,45,45,43,18,17,35,35,50,50,5,47,252,113,
+253,53,246,247,184,86,84,59,63,96,84,31,241,240,31,242,191,170,1,2,72,66,
+60,78,254,185,116,166,160,118,134,171,164,133,254,226,65,50,49,34,33,19,18,
+6,57,50,51,36,37,21,22,3,53,0,5,251,47,252,181,255,174,0,0,0,34,0,46,0,54,
+0,55,0,56,0,0,2,6,35,34,38,53,52,54,55,38,38,35,34,6,7,22,22,23,6,35,34,38,
+53,52,54,51,50,22,23,54,54,51,50,22,21,38,38,35,34,6,21,20,22,51,50,54,53,
+5,38,39,38,39,20,23,22,1,17,82,171,153,151,174,10,12,36,97,59,60,98,20,149,
+135,4,53,69,153,167,186,156,57,136,53,39,117,83,154,170,149,93,86,79,93,90,
+84,81,96,253,79,10,46,46,78,47,47,1,95,253,206,181,180,135,33,65,33,33,41,
+56,53,30,185,174,22,187,134,136,186,43,47,40,50,181,139,80,109,108,87,72,
+114,109,77,192,83,41,41,23,86,51,51,2,106,252,181,0,3,250,100,249,135,1,0,
+0,0,0,52,0,53,0,54,0,0,1,52,38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,38,
+53,52,54,51,50,22,22,18,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,21,
+20,6,35,34,38,39,17,51,21,33,1,33,253,49,143,142,114,146,127,115,64,38,56,
+35,84,59,169,225,241,208,133,178,105,22,144,124,101,137,138,112,69,58,59,
+41,100,70,170,221,224,180,81,144,55,190,254,164,3,207,252,113,253,162,198,
+164,165,121,142,139,23,130,20,23,237,196,175,253,98,203,254,242,142,162,129,
+127,151,26,131,20,19,233,195,183,250,62,51,253,84,125,6,121,0,0,3,251,41,
+251,14,1,121,0,0,0,52,0,53,0,54,0,0,1,52,38,35,34,6,21,20,22,51,50,55,23,
+6,6,35,34,38,53,52,54,51,50,30,2,51,50,54,53,52,38,35,34,6,7,39,54,54,51,
+50,22,21,20,6,35,34,38,39,17,51,21,33,19,33,253,43,106,89,73,103,86,72,35,
+35,55,29,58,46,126,167,182,154,151,153,18,106,94,80,84,88,70,24,50,20,55,
+32,74,53,127,166,162,141,55,117,41,146,254,229,70,4,8,254,53,124,106,99,100,
+82,100,14,119,13,15,174,147,138,184,169,228,115,112,80,90,101,9,10,117,16,
+15,176,146,129,192,38,41,254,25,115,4,242,0,5,250,96,252,63,1,0,0,0,0,33,
+0,45,0,61,0,62,0,63,0,0,5,54,54,51,50,18,21,20,6,35,34,39,54,54,55,38,38,
+35,34,6,7,22,21,20,6,35,34,38,53,52,54,51,50,22,0,22,51,50,54,53,52,38,35,
+34,6,21,1,50,55,54,55,54,55,54,53,6,7,6,7,6,7,6,1,33,253,68,59,168,106,205,
+248,224,202,82,80,8,217,193,31,153,86,92,136,49,31,229,185,197,229,229,193,
+110,156,253,244,146,110,117,139,140,116,112,144,3,160,67,51,50,35,34,18,17,
+43,45,45,39,39,26,27,2,84,252,113,238,66,72,254,255,171,188,245,31,239,242,
+31,84,96,63,59,84,86,185,246,250,172,187,252,78,254,26,157,166,120,133,164,
+168,137,254,234,22,21,37,36,51,50,57,6,18,19,33,34,49,50,2,244,0,0,5,251,
+47,252,181,255,174,0,0,0,34,0,46,0,54,0,55,0,56,0,0,5,54,54,51,50,22,21,20,
+6,35,34,39,54,54,55,38,38,35,34,6,7,22,22,21,20,6,35,34,38,53,52,54,51,50,
+22,6,38,35,34,6,21,20,22,51,50,54,53,5,50,55,54,53,6,7,6,1,17,253,100,54,
+135,57,158,182,166,151,70,53,4,135,150,21,98,60,59,96,37,12,10,173,152,151,
+175,170,156,84,116,24,92,80,86,92,96,80,84,90,1,82,86,47,47,78,46,46,254,
+240,190,47,43,187,135,135,186,22,174,185,30,53,56,41,33,33,65,33,130,185,
+178,145,135,185,50,190,109,109,86,79,107,114,72,192,51,51,86,23,41,41,2,23,
+252,181,0,5,250,127,252,63,1,0,0,0,0,55,0,65,0,76,0,77,0,78,0,0,1,54,54,51,
+50,22,23,6,6,35,34,38,39,6,6,35,34,38,39,54,54,51,50,22,23,54,54,53,52,38,
+35,34,6,7,39,54,54,51,50,22,23,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,
+23,22,51,50,55,38,38,35,34,6,5,22,51,50,54,55,38,38,35,34,6,1,33,253,184,
+54,143,86,121,186,72,39,223,148,124,162,48,49,165,119,148,223,39,102,181,
+96,86,141,53,5,4,143,115,82,125,35,131,39,198,136,119,165,49,48,164,122,135,
+199,41,133,35,127,80,123,137,4,62,69,125,139,76,41,92,53,72,111,253,40,75,
+140,63,96,33,39,111,71,53,93,5,150,252,113,253,147,46,57,89,52,144,158,101,
+78,78,101,158,144,72,69,53,45,21,29,23,135,170,90,88,66,110,140,101,78,78,
+101,140,110,66,88,90,174,131,25,30,137,86,119,22,31,50,3,119,45,41,37,49,
+31,2,168,0,5,251,63,252,181,255,143,0,0,0,55,0,64,0,73,0,74,0,75,0,0,1,54,
+54,51,50,22,23,6,6,35,34,38,39,6,6,35,34,38,39,54,54,51,50,22,23,54,54,53,
+52,38,35,34,6,7,39,54,54,51,50,22,23,54,54,51,50,22,23,7,38,38,35,34,6,21,
+20,22,23,22,51,50,55,38,35,34,6,5,22,51,50,55,38,38,35,34,1,17,253,180,35,
+100,58,80,147,55,30,170,111,86,117,39,36,117,86,111,170,31,56,145,82,57,99,
+35,4,2,82,86,56,88,28,121,35,155,103,84,115,40,37,119,86,102,156,35,121,29,
+88,55,86,84,2,41,43,84,96,52,56,71,48,73,253,239,52,96,84,43,27,76,47,69,
+1,86,254,57,25,35,66,41,123,118,59,47,47,59,118,123,41,66,35,25,13,17,13,
+67,114,52,59,59,86,97,63,48,47,64,97,86,59,59,52,114,67,13,17,121,62,82,31,
+29,2,82,62,22,29,2,0,252,181,0,0,4,250,92,252,63,1,0,0,0,0,69,0,79,0,80,0,
+81,0,0,0,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,14,2,21,20,22,51,
+50,54,53,52,38,39,55,22,22,23,54,54,51,50,22,23,7,38,38,35,34,6,7,7,22,22,
+23,54,54,51,50,22,23,6,6,35,34,38,39,6,6,35,34,38,53,5,22,51,50,55,38,38,
+35,34,6,1,33,250,109,69,127,22,23,22,35,25,86,50,82,63,82,100,55,91,51,113,
+127,126,144,63,60,93,41,65,27,47,155,117,135,199,41,133,35,127,80,114,134,
+10,2,1,3,4,54,143,86,121,186,72,39,223,148,122,164,48,53,180,113,204,211,
+3,133,69,125,139,76,41,92,53,72,111,2,230,252,113,253,224,124,100,46,16,22,
+22,23,88,49,44,103,65,71,76,83,83,56,72,106,177,128,94,140,47,129,29,80,47,
+68,88,140,110,66,88,90,153,119,42,17,29,23,46,57,89,52,144,158,101,78,86,
+93,180,150,104,86,119,22,31,50,2,187,0,0,4,251,37,252,181,255,143,0,0,0,64,
+0,73,0,74,0,75,0,0,0,54,54,53,52,35,34,7,39,54,54,51,50,22,21,20,6,6,21,20,
+22,51,50,54,53,52,38,39,55,22,23,54,54,51,50,22,23,7,38,38,35,34,6,21,20,
+22,23,54,54,51,50,22,23,6,6,35,34,38,39,6,6,35,34,38,53,5,22,51,50,55,38,
+35,34,6,3,17,251,49,46,91,26,27,24,72,38,66,58,65,66,64,67,73,76,88,107,47,
+39,78,53,39,37,114,78,102,156,35,121,29,88,55,86,84,2,4,35,100,58,80,147,
+55,30,170,111,86,121,41,43,133,86,140,157,2,168,43,84,96,52,56,71,48,73,131,
+254,76,95,73,30,27,31,72,38,32,78,51,61,75,71,60,47,69,116,86,64,94,33,119,
+35,66,43,58,97,86,59,59,52,114,67,13,17,13,25,35,66,41,123,118,61,49,53,57,
+133,110,63,62,82,31,29,2,29,252,181,0,0,4,250,92,249,135,1,0,0,0,0,73,0,83,
+0,84,0,85,0,0,1,51,17,38,38,39,6,6,35,34,38,53,52,54,54,53,52,38,35,34,6,
+7,39,54,54,51,50,22,21,20,14,2,21,20,22,51,50,54,53,52,38,39,55,22,22,23,
+54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,54,54,51,50,22,23,6,6,7,17,
+33,19,22,51,50,55,38,38,35,34,6,1,33,253,190,191,100,138,41,53,176,117,204,
+211,69,127,22,23,22,35,25,86,50,82,63,82,100,55,91,51,113,127,126,144,63,
+60,93,41,65,23,47,159,117,135,199,41,133,35,127,80,123,137,4,4,54,143,86,
+121,186,72,33,164,110,254,163,52,69,125,139,76,41,92,53,72,111,2,230,252,
+113,250,4,2,64,12,94,68,86,93,180,150,87,124,100,46,16,22,22,23,88,49,44,
+103,65,71,76,83,83,56,72,106,177,128,94,140,47,129,29,82,49,70,90,140,110,
+66,88,90,174,131,25,30,23,46,57,89,52,117,150,22,253,59,3,154,86,119,22,31,
+50,2,187,0,0,4,251,37,251,14,255,143,0,0,0,69,0,78,0,79,0,80,0,0,1,51,17,
+38,38,39,6,6,35,34,38,53,52,54,54,53,52,35,34,7,39,54,54,51,50,22,21,20,6,
+6,21,20,22,51,50,54,53,52,38,39,55,22,23,54,54,51,50,22,23,7,38,38,35,34,
+6,21,20,22,23,54,54,51,50,22,23,6,6,7,17,33,19,22,51,50,55,38,35,34,6,3,1,
+253,145,146,64,96,33,45,133,86,140,157,46,91,26,27,24,72,38,66,58,65,66,64,
+67,73,76,88,107,47,39,78,53,39,39,113,77,102,156,35,121,29,88,55,86,84,2,
+4,35,100,58,80,147,55,24,121,82,254,229,72,43,84,96,52,56,71,48,73,131,253,
+238,251,129,1,156,10,55,41,53,57,133,110,64,95,73,30,27,31,72,38,32,78,51,
+61,75,71,60,47,69,116,86,64,94,33,119,35,66,43,58,97,86,59,59,52,114,67,13,
+17,13,25,35,66,41,98,115,20,253,237,2,191,62,82,31,29,2,29,252,181,0,4,251,
+195,252,63,1,0,0,0,0,26,0,38,0,39,0,40,0,0,0,38,39,55,22,22,21,20,6,35,34,
+38,53,52,54,55,22,17,20,6,7,22,22,51,50,54,53,37,6,6,21,20,22,23,54,54,53,
+52,38,1,33,254,100,65,60,95,86,110,243,175,175,246,133,102,201,55,44,19,43,
+22,113,139,254,62,29,39,31,29,41,38,32,4,55,252,113,254,94,139,50,129,60,
+217,135,202,247,246,203,135,217,60,142,254,250,98,142,57,6,8,158,145,219,
+40,105,66,65,107,35,41,113,59,70,94,1,78,0,4,252,35,252,181,254,170,0,0,0,
+25,0,36,0,37,0,38,0,0,0,38,39,55,22,22,21,20,6,35,34,38,53,52,54,55,22,21,
+20,6,7,22,51,50,54,53,37,6,6,21,20,23,54,54,53,52,38,19,17,254,20,53,41,86,
+60,98,180,144,143,180,98,90,154,35,27,21,20,76,100,254,203,20,27,35,22,23,
+14,127,254,160,98,31,123,41,157,114,159,172,173,148,105,170,47,107,196,66,
+95,42,6,102,96,146,29,72,41,82,45,27,74,41,41,61,1,37,252,181,0,4,250,133,
+252,63,1,0,0,0,0,55,0,66,0,67,0,68,0,0,1,6,6,35,34,38,39,54,54,51,50,22,23,
+54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,6,7,22,22,51,50,54,53,
+52,38,35,34,7,39,54,54,51,50,22,21,20,6,35,34,38,37,22,51,50,54,55,38,38,
+35,34,6,1,33,253,100,50,159,131,143,215,37,72,190,123,82,135,53,3,2,136,116,
+86,131,37,131,41,202,138,125,189,107,8,6,53,136,86,113,132,141,104,76,51,
+64,43,100,70,170,219,227,189,104,176,253,139,80,150,77,109,29,41,119,64,65,
+109,5,160,252,113,252,225,68,94,157,136,82,105,47,41,10,22,13,125,163,90,
+86,68,108,136,103,199,120,35,64,24,78,92,163,130,137,141,24,131,20,19,232,
+196,187,248,87,180,127,63,53,35,49,41,2,150,0,4,251,70,252,181,255,166,0,
+0,0,53,0,62,0,63,0,64,0,0,1,6,6,35,34,38,39,54,54,51,50,22,23,54,53,52,38,
+35,34,6,7,39,54,54,51,50,22,21,20,6,7,22,22,51,50,54,53,52,38,35,34,7,39,
+54,54,51,50,22,21,20,6,35,34,38,37,22,51,50,55,38,38,35,34,1,17,253,104,28,
+120,87,111,170,30,55,147,80,58,98,35,6,82,86,55,88,27,123,35,156,102,137,
+174,8,6,43,100,58,82,86,97,61,51,33,55,33,63,51,126,167,170,143,68,141,254,
+77,52,96,84,43,27,73,48,71,1,80,253,131,35,71,118,123,41,66,35,23,21,22,67,
+112,52,59,59,86,97,179,129,32,47,25,45,55,110,82,94,97,19,119,15,14,175,147,
+134,185,59,139,82,62,22,29,2,0,252,181,0,4,251,195,249,135,1,0,0,0,0,25,0,
+31,0,32,0,33,0,0,0,22,23,7,38,38,53,52,54,51,50,22,21,20,6,7,39,54,54,53,
+52,38,35,34,6,21,1,17,33,53,51,17,1,33,252,104,66,59,94,86,110,237,178,186,
+238,113,92,92,60,71,139,117,110,142,1,80,254,164,193,3,227,252,113,253,131,
+145,47,132,60,223,135,202,241,243,200,123,229,66,132,47,143,94,139,166,159,
+144,254,94,253,72,125,2,59,3,193,0,0,4,252,35,251,14,0,105,0,0,0,25,0,31,
+0,32,0,33,0,0,0,22,23,7,38,38,53,52,54,51,50,22,21,20,6,7,39,54,54,53,52,
+38,35,34,6,21,19,33,53,51,17,51,3,33,252,182,56,38,86,63,92,177,144,147,179,
+98,66,84,40,58,96,78,73,103,244,254,229,144,139,57,2,248,254,20,96,33,122,
+45,166,100,158,174,176,148,104,170,45,125,32,90,64,94,107,101,96,252,186,
+115,1,152,2,231,0,5,251,197,252,63,1,0,0,0,0,11,0,28,0,39,0,40,0,41,0,0,0,
+54,51,50,22,21,20,6,35,34,38,53,36,39,6,6,35,34,38,39,20,6,21,20,22,51,50,
+54,53,37,22,22,51,50,55,38,38,35,34,6,1,33,251,197,228,183,197,229,226,196,
+191,224,2,161,2,51,125,78,77,125,52,2,144,112,110,146,254,48,45,108,55,121,
+90,32,107,72,69,107,4,74,252,113,254,169,243,248,172,187,254,252,181,32,7,
+39,47,47,41,11,16,10,133,164,164,148,157,41,45,84,53,63,61,1,43,0,0,5,252,
+35,252,181,254,172,0,0,0,11,0,25,0,35,0,36,0,37,0,0,0,54,51,50,22,21,20,6,
+35,34,38,53,5,53,6,6,35,34,38,39,21,20,22,51,50,54,37,22,22,51,50,55,38,38,
+35,34,55,17,252,35,175,148,155,171,169,157,154,169,1,241,34,86,54,53,86,35,
+88,86,91,83,254,197,31,74,36,86,56,23,71,48,94,105,254,229,183,180,144,135,
+184,184,143,2,6,24,33,33,24,8,78,112,113,202,22,27,47,31,41,225,252,181,0,
+4,250,98,252,63,1,0,0,0,0,47,0,63,0,64,0,65,0,0,0,22,23,7,38,38,53,52,54,
+51,50,22,23,54,54,51,50,18,21,20,6,35,34,39,54,54,55,38,38,35,34,6,7,22,21,
+20,6,7,39,54,54,53,52,38,35,34,6,21,1,50,55,54,55,54,55,54,53,6,7,6,7,6,7,
+6,1,33,251,6,68,59,94,86,111,234,182,102,164,56,59,168,106,205,248,224,202,
+82,80,8,217,193,31,153,86,92,134,49,31,113,92,94,61,72,141,115,110,144,3,
+158,67,51,50,35,34,18,17,43,45,45,39,39,26,27,2,84,252,113,253,131,145,47,
+132,60,225,133,203,240,72,66,66,72,254,255,171,188,245,31,239,242,31,84,96,
+61,59,84,101,123,229,66,132,47,143,94,139,166,159,144,254,234,22,21,37,36,
+51,50,57,6,18,19,33,34,49,50,2,244,0,4,251,49,252,181,255,174,0,0,0,48,0,
+56,0,57,0,58,0,0,0,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,
+6,35,34,39,54,54,55,38,38,35,34,6,7,22,22,21,20,6,7,39,54,54,53,52,38,35,
+34,6,21,5,50,55,54,53,6,7,6,1,17,251,199,55,41,86,66,94,177,147,71,125,43,
+54,135,57,158,182,166,151,70,53,4,135,150,21,98,60,59,94,37,10,10,98,63,86,
+40,58,96,78,74,102,2,176,86,47,47,78,46,46,254,240,254,20,96,33,122,45,166,
+100,154,178,45,48,50,43,187,135,135,186,22,174,185,30,53,56,41,33,29,61,37,
+103,171,45,125,32,90,64,94,107,101,96,190,51,51,86,23,41,41,2,23,252,181,
+0,0,6,250,129,252,63,1,0,0,14,0,51,0,63,0,64,0,65,0,66,0,67,0,0,1,54,54,51,
+50,22,22,21,20,6,35,34,38,39,6,6,7,39,54,54,53,38,38,35,34,6,21,20,22,22,
+21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,38,53,52,54,51,50,22,19,22,22,
+51,50,54,53,52,38,35,34,6,1,5,5,33,253,127,47,164,123,135,192,91,229,185,
+116,156,52,24,70,37,94,59,76,4,159,130,104,111,103,92,99,83,63,80,52,86,45,
+39,20,23,135,62,209,181,129,178,131,4,143,107,115,141,142,114,121,133,1,0,
+254,178,3,129,252,113,254,229,82,101,126,199,105,184,247,88,72,45,86,29,130,
+47,142,103,137,158,108,72,83,103,96,85,63,107,45,48,88,43,20,17,48,108,125,
+77,136,192,103,254,160,116,150,165,121,133,164,176,1,172,2,12,0,4,251,37,
+252,181,255,172,0,0,0,48,0,60,0,61,0,62,0,0,5,54,54,51,50,22,21,20,6,35,34,
+39,6,6,7,39,54,54,53,52,38,35,34,6,21,20,22,22,21,20,6,35,34,38,39,55,22,
+51,50,53,52,38,38,53,52,54,51,50,22,18,22,51,50,54,53,52,38,35,34,6,21,3,
+17,253,98,42,126,96,155,167,168,158,155,92,19,41,24,82,41,45,107,88,76,73,
+69,62,66,65,58,66,38,72,26,25,26,85,52,157,136,94,133,119,91,89,90,89,93,
+82,92,92,63,219,50,69,186,142,135,180,102,33,53,16,118,35,92,64,86,119,72,
+47,59,74,73,60,52,77,31,38,72,31,27,32,64,97,69,109,135,66,254,168,102,104,
+82,84,111,107,92,1,174,252,181,0,0,3,251,166,252,63,1,0,0,0,0,42,0,43,0,44,
+0,0,0,38,35,34,6,7,39,54,54,51,50,22,21,20,2,35,34,38,38,35,34,6,7,35,17,
+51,17,20,6,7,23,54,54,51,50,22,23,23,22,51,50,54,53,1,33,254,213,115,96,35,
+47,16,66,31,92,51,162,215,172,135,90,115,105,48,29,76,104,117,172,2,4,4,33,
+92,49,54,98,61,62,22,41,53,80,2,43,252,113,254,125,139,6,4,129,12,19,236,
+198,171,254,254,97,223,100,203,3,63,254,176,34,78,35,2,53,58,69,101,113,41,
+147,146,2,6,0,3,252,35,252,181,255,10,0,0,0,39,0,40,0,41,0,0,0,38,35,34,6,
+7,39,54,54,51,50,22,21,20,6,35,34,38,38,35,34,6,7,35,17,51,17,20,7,23,54,
+54,51,50,22,22,51,50,54,53,3,17,254,109,74,60,26,41,10,48,25,70,39,123,159,
+118,97,90,92,66,39,22,65,68,86,151,4,4,29,53,33,66,87,68,29,29,41,252,254,
+193,86,9,4,121,10,15,182,144,142,175,94,141,90,133,2,106,254,255,27,25,2,
+35,27,110,140,104,98,1,154,252,181,0,0,5,250,106,252,61,1,0,0,0,0,51,0,63,
+0,75,0,76,0,77,0,0,1,54,54,51,50,22,21,20,6,35,34,38,39,6,7,38,17,52,54,55,
+38,35,34,6,21,20,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,46,2,53,
+52,54,51,50,22,18,22,51,50,54,53,52,38,35,34,6,21,7,54,54,53,52,38,39,6,6,
+21,20,22,1,33,253,98,49,165,122,192,226,229,185,122,158,47,62,102,201,53,
+45,34,60,119,123,124,57,84,80,57,82,48,87,24,35,16,17,18,87,74,36,229,183,
+111,182,133,146,108,117,141,142,116,109,145,217,28,40,31,29,35,45,33,4,80,
+252,113,254,229,80,103,248,182,185,246,95,73,108,62,142,1,6,92,148,57,14,
+114,89,80,99,87,63,72,111,52,49,90,29,16,20,17,38,62,77,97,53,156,195,95,
+254,46,158,165,121,133,164,169,136,227,40,103,68,67,107,35,41,106,70,68,94,
+2,217,0,5,251,39,252,181,255,172,0,0,0,49,0,61,0,72,0,73,0,74,0,0,0,22,22,
+21,20,6,35,34,38,39,55,22,51,50,53,52,38,38,53,52,54,51,50,22,23,54,54,51,
+50,22,21,20,6,35,34,38,39,6,7,38,53,52,54,55,38,38,35,34,6,21,4,22,51,50,
+54,53,52,38,35,34,6,21,7,54,54,53,52,39,6,6,21,20,22,19,17,251,188,63,58,
+67,60,43,61,35,70,26,21,24,101,44,175,130,86,139,45,41,127,92,152,170,168,
+158,77,131,44,47,73,154,36,26,13,24,23,72,86,1,244,91,89,90,89,93,82,92,92,
+190,20,27,33,23,24,14,146,254,109,56,85,58,57,84,41,36,74,31,27,20,84,83,
+57,110,142,56,55,49,62,185,143,135,180,49,53,66,36,106,197,66,96,40,5,2,70,
+57,152,102,104,82,84,111,107,92,143,26,72,43,80,45,27,74,38,43,60,2,37,252,
+181,0,0,4,250,121,252,63,1,0,0,0,0,37,0,49,0,50,0,51,0,0,0,38,39,55,22,22,
+23,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,23,6,6,21,
+20,22,51,50,54,53,22,22,51,50,54,53,52,38,35,34,6,21,1,33,253,27,72,59,92,
+41,63,25,47,155,115,192,226,229,185,124,162,48,51,170,114,182,234,110,86,
+95,60,65,141,111,114,142,149,146,108,117,141,142,116,109,145,3,80,252,113,
+254,90,143,50,129,29,80,49,70,88,248,182,185,246,99,78,84,93,242,203,133,
+223,60,129,50,145,92,143,160,164,141,149,158,165,121,133,164,169,136,2,31,
+0,4,251,39,252,181,255,172,0,0,0,38,0,50,0,51,0,52,0,0,0,38,39,55,22,22,23,
+54,54,51,50,22,21,20,6,35,34,38,39,53,6,6,35,34,38,53,52,54,55,23,6,6,21,
+20,22,51,50,54,53,22,22,51,50,54,53,52,38,35,34,6,21,3,17,253,27,58,41,84,
+27,49,21,38,123,92,152,170,168,158,82,129,45,45,129,78,147,176,94,64,86,39,
+56,103,74,77,97,149,91,89,90,89,93,82,92,92,63,254,164,92,31,125,19,51,31,
+45,56,185,143,135,180,51,53,2,53,53,179,152,101,166,45,123,31,96,64,98,100,
+106,96,100,102,104,82,84,111,107,92,1,174,252,181,0,0,3,250,98,249,135,1,
+0,0,0,0,52,0,53,0,54,0,0,1,33,53,51,17,6,6,35,34,38,53,52,54,51,50,22,23,
+7,38,35,34,6,21,20,22,51,50,54,18,54,54,51,50,22,21,20,6,35,34,38,39,55,22,
+51,50,54,53,52,38,35,34,6,21,1,33,253,174,254,164,190,55,141,82,181,227,229,
+165,71,99,43,64,53,72,111,137,136,100,124,144,22,106,178,132,207,242,226,
+167,60,82,34,55,37,63,117,127,147,115,140,145,3,82,252,113,249,135,125,2,
+172,51,62,235,181,198,247,19,20,131,26,152,126,133,158,142,1,14,202,99,250,
+178,196,237,23,20,130,23,139,142,122,164,164,198,2,94,0,0,3,251,41,251,14,
+1,119,0,0,0,51,0,52,0,53,0,0,1,33,53,51,17,6,6,35,34,38,53,52,54,51,50,22,
+23,7,38,35,34,6,21,20,22,51,50,62,2,51,50,22,21,20,6,35,34,38,39,55,22,51,
+50,54,53,52,38,35,34,6,21,3,33,253,182,254,230,143,45,113,55,133,168,167,
+126,51,76,31,56,37,57,68,90,84,80,96,104,18,155,151,154,182,170,125,46,58,
+29,56,34,35,73,87,104,74,88,105,69,4,6,251,14,115,1,227,43,32,185,136,150,
+172,15,16,117,19,101,90,80,112,112,230,170,185,137,149,172,15,13,119,14,101,
+81,100,99,106,124,1,203,0,0,5,250,121,252,63,1,0,0,0,0,37,0,49,0,61,0,62,
+0,63,0,0,1,54,54,51,50,18,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,
+34,6,7,22,22,21,20,6,35,34,38,53,52,54,51,50,0,22,51,50,54,53,52,38,35,34,
+6,21,36,22,21,20,6,35,34,38,53,52,54,51,1,33,253,113,61,178,105,193,229,240,
+168,59,99,43,62,51,76,105,151,133,123,84,148,49,4,8,227,199,187,224,225,191,
+217,254,41,139,117,109,147,145,111,115,141,1,47,59,57,47,45,66,62,47,4,229,
+252,113,254,231,91,90,254,255,184,183,234,16,20,125,24,147,131,131,172,100,
+82,16,72,29,170,252,248,183,181,249,253,211,164,157,121,137,168,161,136,115,
+59,49,47,66,59,54,53,55,1,164,0,5,251,47,252,181,255,174,0,0,0,38,0,50,0,
+62,0,63,0,64,0,0,5,54,54,51,50,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,
+52,38,35,34,6,7,22,21,20,6,35,34,38,53,52,54,51,50,22,0,22,51,50,54,53,52,
+38,35,34,6,21,54,22,21,20,6,35,34,38,53,52,54,51,19,17,253,113,41,127,79,
+151,175,170,123,51,74,32,47,18,49,27,63,99,90,80,55,100,34,6,171,152,152,
+176,178,150,92,119,254,119,101,81,86,94,98,84,84,96,223,59,59,41,41,64,64,
+41,250,227,59,68,179,143,152,169,16,16,117,8,10,88,98,84,109,53,72,37,37,
+138,173,172,151,142,178,68,254,175,107,104,78,88,111,111,88,121,58,57,53,
+58,60,51,57,58,1,53,252,181,0,0,6,250,121,252,63,1,0,0,0,0,23,0,35,0,47,0,
+59,0,60,0,61,0,0,1,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+54,51,50,22,0,22,51,50,54,53,52,38,35,34,6,21,4,22,51,50,54,53,52,38,35,34,
+6,21,36,22,21,20,6,35,34,38,53,52,54,51,1,33,253,102,48,162,122,192,226,229,
+185,126,162,48,49,163,126,187,224,225,191,121,163,253,230,139,117,109,147,
+145,111,115,141,2,149,146,108,117,141,142,116,109,145,254,154,59,57,47,45,
+66,62,47,4,229,252,113,254,233,78,101,248,182,185,246,101,78,79,100,248,183,
+181,249,101,254,56,164,157,121,137,168,161,136,128,158,165,121,133,164,169,
+136,123,59,49,47,66,59,54,53,55,1,164,0,0,6,251,33,252,181,255,172,0,0,0,
+23,0,35,0,47,0,59,0,60,0,61,0,0,5,54,54,51,50,22,21,20,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,18,22,51,50,54,53,52,38,35,34,6,21,4,22,51,50,
+54,53,52,38,35,34,6,21,54,22,21,20,6,35,34,38,53,52,54,51,1,17,253,102,39,
+125,96,152,170,168,158,82,129,45,45,129,82,159,166,169,152,97,122,115,91,
+89,90,89,93,82,92,92,254,6,100,80,87,94,97,86,80,98,221,62,59,41,41,64,62,
+40,1,7,211,49,62,185,143,135,180,51,53,53,51,181,134,143,185,60,254,162,102,
+104,82,84,111,107,92,72,110,104,78,88,111,110,89,121,58,57,53,58,60,51,57,
+58,1,53,252,181,0,6,250,119,252,63,1,0,0,0,0,33,0,45,0,61,0,73,0,74,0,75,
+0,0,5,54,54,51,50,18,21,20,6,35,34,39,54,54,55,38,38,35,34,6,7,22,21,20,6,
+35,34,38,53,52,54,51,50,22,0,22,51,50,54,53,52,38,35,34,6,21,1,50,55,54,55,
+54,55,54,53,6,7,6,7,6,7,6,0,22,21,20,6,35,34,38,53,52,54,51,1,33,253,88,62,
+165,107,207,248,230,196,86,76,8,217,193,31,154,88,92,135,47,28,228,185,197,
+227,223,197,110,156,253,246,143,111,114,144,145,113,112,142,3,157,68,51,51,
+35,35,18,17,43,45,45,39,39,27,28,253,137,59,57,47,45,66,62,47,4,229,252,113,
+238,66,72,254,253,169,191,242,31,239,242,31,84,96,63,59,86,84,185,246,246,
+176,184,255,78,254,26,157,163,123,135,162,168,137,254,234,22,21,37,36,51,
+50,57,6,18,19,33,34,49,50,1,80,59,49,47,66,59,54,53,55,1,164,0,6,251,47,252,
+181,255,174,0,0,0,34,0,46,0,58,0,66,0,67,0,68,0,0,5,54,54,51,50,22,21,20,
+6,35,34,39,54,54,55,38,38,35,34,6,7,22,22,21,20,6,35,34,38,53,52,54,51,50,
+22,0,22,51,50,54,53,52,38,35,34,6,21,54,22,21,20,6,35,34,38,53,52,54,51,1,
+50,55,54,53,6,7,6,1,17,253,100,54,135,57,158,182,166,151,70,53,4,135,150,
+21,98,60,59,96,37,12,10,173,152,151,175,170,156,84,116,254,132,101,81,86,
+94,98,84,84,96,223,59,59,41,41,64,64,41,2,0,86,47,47,78,46,46,254,240,190,
+47,43,187,135,135,186,22,174,185,30,53,56,41,33,33,65,33,130,185,178,145,
+135,185,50,254,157,107,104,78,88,111,111,88,121,58,57,53,58,60,51,57,58,254,
+203,51,51,86,23,41,41,2,23,252,181,0,7,250,121,252,63,1,0,0,0,0,23,0,35,0,
+47,0,54,0,66,0,67,0,68,0,0,1,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,0,22,51,50,54,53,52,38,35,34,6,21,37,22,22,23,54,54,
+53,52,38,35,34,6,19,38,38,39,22,22,51,0,22,21,20,6,35,34,38,53,52,54,51,1,
+33,253,102,48,162,122,192,226,229,185,123,164,49,49,163,126,187,224,225,191,
+121,163,253,230,139,117,109,147,145,111,115,141,2,168,129,226,28,53,57,142,
+116,90,121,232,9,156,110,4,145,105,253,156,59,57,47,45,66,62,47,4,229,252,
+113,254,233,78,101,248,182,185,246,105,74,79,100,248,183,181,249,101,254,
+56,164,157,121,137,168,161,136,109,7,183,160,39,125,77,133,164,102,254,31,
+103,155,8,117,149,1,145,59,49,47,66,59,54,53,55,1,164,0,7,251,33,252,181,
+255,172,0,0,0,23,0,35,0,46,0,58,0,70,0,71,0,72,0,0,5,54,54,51,50,22,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,0,22,51,50,54,53,52,38,35,34,
+6,21,37,22,22,23,54,54,53,52,38,35,34,4,22,21,20,6,35,34,38,53,52,54,51,5,
+20,23,22,23,22,23,22,51,38,39,38,3,17,253,102,39,125,96,152,170,168,158,82,
+129,45,45,129,82,159,166,169,152,97,122,254,121,100,80,87,94,97,86,80,98,
+2,19,110,141,17,33,33,93,82,114,254,157,62,59,41,41,64,62,40,1,70,10,9,22,
+21,34,33,49,10,51,53,127,211,49,62,185,143,135,180,51,53,53,51,181,134,143,
+185,60,254,170,110,104,78,88,111,110,89,115,21,139,105,25,80,49,84,111,78,
+58,57,53,58,60,51,57,58,121,35,31,32,27,27,15,15,69,51,50,1,186,252,181,0,
+6,250,121,252,63,1,0,0,0,0,23,0,35,0,47,0,54,0,55,0,56,0,0,1,54,54,51,50,
+22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,0,22,51,50,54,53,52,
+38,35,34,6,21,37,22,22,23,54,54,53,52,38,35,34,6,19,38,38,39,22,22,51,1,33,
+253,102,48,162,122,192,226,229,185,123,164,49,49,163,126,187,224,225,191,
+121,163,253,230,139,117,109,147,145,111,115,141,2,168,142,215,26,53,57,142,
+116,90,121,232,9,156,110,4,145,105,2,82,252,113,254,233,78,101,248,182,185,
+246,105,74,79,100,248,183,181,249,101,254,56,164,157,121,137,168,161,136,
+109,8,194,148,39,125,77,133,164,102,254,31,103,155,8,117,149,3,53,0,0,6,251,
+33,252,181,255,172,0,0,0,23,0,35,0,46,0,58,0,59,0,60,0,0,5,54,54,51,50,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,0,22,51,50,54,53,52,38,
+35,34,6,21,37,22,22,23,54,54,53,52,38,35,34,7,20,23,22,23,22,23,22,51,38,
+39,38,3,17,253,102,39,125,96,152,170,168,158,82,129,45,45,129,82,159,166,
+169,152,97,122,254,121,100,80,87,94,97,86,80,98,2,19,110,141,17,33,33,93,
+82,114,70,10,9,22,21,34,33,49,10,51,53,127,211,49,62,185,143,135,180,51,53,
+53,51,181,134,143,185,60,254,170,110,104,78,88,111,110,89,115,21,139,105,
+25,80,49,84,111,199,35,31,32,27,27,15,15,69,51,50,1,186,252,181,0,0,4,251,
+14,252,63,1,0,0,0,0,43,0,54,0,55,0,56,0,0,1,22,22,21,20,6,7,38,38,53,52,54,
+55,38,38,53,52,54,55,51,7,6,21,20,22,23,54,54,51,50,22,21,20,6,7,39,54,54,
+53,52,38,35,34,6,7,6,21,20,22,23,54,54,53,52,38,1,33,252,129,129,107,102,
+89,97,138,2,2,107,78,4,5,149,6,2,29,43,44,197,133,179,245,114,86,95,62,67,
+143,113,80,122,50,2,39,37,23,20,53,4,88,252,93,254,119,53,144,86,75,163,47,
+39,225,154,17,37,16,46,145,73,27,43,22,46,17,19,37,75,27,105,133,240,203,
+135,221,62,136,47,139,94,148,157,90,198,11,16,76,127,33,23,66,24,45,76,2,
+45,0,4,251,156,252,181,254,170,0,0,0,40,0,50,0,51,0,52,0,0,1,22,22,21,20,
+6,7,38,38,53,52,55,38,38,53,52,55,51,6,6,21,20,22,23,54,54,51,50,22,21,20,
+6,7,39,54,53,52,38,35,34,6,7,6,21,20,23,54,54,53,52,38,19,17,252,211,96,78,
+92,68,80,110,2,80,57,6,133,4,2,17,24,26,142,116,143,181,92,72,84,98,96,78,
+53,78,43,2,45,17,12,33,146,254,201,41,101,67,74,134,15,30,170,125,25,12,36,
+108,57,37,30,20,21,14,23,46,19,59,97,181,143,102,170,47,127,63,121,96,105,
+48,155,4,11,83,48,15,33,12,26,43,1,195,252,181,0,0,3,249,229,252,63,1,0,0,
+0,0,71,0,72,0,73,0,0,0,6,21,20,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,
+22,21,20,6,35,34,38,53,52,54,53,52,38,35,34,6,21,20,22,21,20,6,35,34,38,53,
+52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,53,52,38,53,52,54,51,50,
+22,21,1,33,254,106,28,106,115,141,138,142,102,45,33,39,31,63,43,169,222,228,
+200,181,224,33,49,50,47,49,35,222,181,199,234,221,171,46,60,33,41,33,45,104,
+140,135,136,116,113,29,132,126,127,133,2,150,252,113,254,30,89,50,77,117,
+164,123,135,143,8,143,11,4,247,181,182,251,189,147,52,77,37,29,59,59,29,37,
+77,54,143,191,248,185,179,249,4,11,143,8,149,129,122,165,117,77,52,89,42,
+87,118,118,85,1,180,0,0,3,250,199,252,181,0,10,0,0,0,73,0,74,0,75,0,0,0,6,
+21,20,22,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,35,34,38,53,
+52,54,53,52,38,35,34,6,21,20,22,21,20,6,35,34,38,53,52,54,51,50,22,23,7,38,
+38,35,34,6,21,20,22,51,50,54,53,52,38,53,52,54,51,50,22,21,3,17,254,59,20,
+72,77,97,92,96,68,14,29,10,35,22,48,34,121,172,169,152,137,173,23,33,35,30,
+33,22,172,135,148,175,167,126,32,47,25,37,10,27,14,68,98,92,92,78,78,20,102,
+106,107,106,202,254,123,63,31,54,77,108,84,92,97,3,4,129,7,4,183,139,131,
+190,142,107,41,58,22,23,39,39,23,22,58,43,103,144,180,141,137,185,4,7,129,
+4,3,97,92,84,108,77,54,31,63,29,78,92,96,74,1,104,252,181,0,4,250,106,249,
+29,1,0,0,0,0,52,0,64,0,65,0,66,0,0,1,6,6,35,34,38,53,52,54,51,50,22,23,54,
+54,51,50,18,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,34,6,7,17,20,6,
+35,34,38,53,53,51,21,20,22,51,50,54,53,2,6,21,20,22,51,50,54,53,52,38,35,
+37,33,252,180,28,70,41,114,146,151,111,86,123,33,102,149,85,197,235,229,162,
+70,98,43,59,51,76,110,136,142,129,92,149,41,195,180,165,196,152,115,94,102,
+123,182,72,76,43,57,68,78,47,4,211,252,113,253,180,16,21,148,112,122,141,
+70,66,86,52,254,254,168,189,239,18,21,131,27,153,134,118,160,98,66,252,101,
+203,227,197,157,27,27,113,114,145,154,4,71,67,56,53,65,71,47,56,67,242,0,
+4,251,70,251,16,255,101,0,0,0,50,0,62,0,63,0,64,0,0,1,6,6,35,34,38,53,52,
+54,51,50,23,54,54,51,50,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,35,34,
+6,7,17,20,6,35,34,38,53,53,51,21,20,22,51,50,54,53,2,6,21,20,22,51,50,54,
+53,52,38,35,55,1,252,203,18,34,24,86,98,112,72,123,47,51,105,86,145,180,168,
+127,96,61,49,33,47,86,104,104,92,60,119,28,136,129,112,137,125,75,60,59,70,
+101,41,43,23,33,41,45,29,242,1,244,254,61,8,10,107,77,90,93,95,44,53,194,
+128,138,183,28,109,17,105,98,90,107,60,57,253,143,142,157,131,117,37,33,71,
+72,102,92,2,234,39,31,30,37,39,28,31,39,215,252,181,0,4,250,100,252,63,1,
+0,0,0,0,41,0,57,0,58,0,59,0,0,2,54,53,52,38,35,34,7,39,54,54,51,50,22,21,
+20,6,35,34,38,2,38,35,34,6,7,22,22,23,6,35,34,38,53,52,54,51,50,22,18,22,
+51,5,38,39,38,39,38,39,38,39,20,23,22,23,22,23,22,1,33,180,137,138,112,69,
+58,59,41,100,70,170,221,224,180,172,213,110,147,107,92,117,25,191,217,10,
+78,86,196,230,227,191,154,225,110,143,105,253,50,9,27,28,38,38,45,45,43,18,
+17,35,35,50,50,5,43,252,113,252,211,162,129,127,151,26,131,20,19,233,195,
+183,250,212,1,99,150,96,78,31,241,240,31,242,191,179,249,201,254,139,139,
+8,65,50,49,34,33,19,18,6,57,50,51,36,37,21,22,3,53,0,4,251,41,252,181,255,
+184,0,0,0,40,0,48,0,49,0,50,0,0,1,22,22,23,6,35,34,38,53,52,54,51,50,22,18,
+51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,35,34,38,2,35,34,6,
+19,38,39,38,39,20,23,22,1,17,251,193,151,133,4,53,68,153,166,165,142,116,
+185,102,154,70,88,88,70,24,39,21,53,31,63,53,127,166,162,141,128,171,113,
+147,47,86,139,8,46,46,80,47,47,1,103,254,180,30,185,174,22,187,134,135,187,
+147,254,147,108,84,90,101,9,10,119,16,13,176,146,129,192,148,1,110,50,254,
+173,83,41,41,23,86,51,51,2,106,252,181,0,0,4,251,35,252,63,1,0,0,0,0,21,0,
+33,0,34,0,35,0,0,2,6,35,34,38,53,53,39,7,22,21,17,35,17,51,23,54,54,51,50,
+22,21,4,22,51,50,54,53,52,38,35,34,6,21,1,33,96,230,194,185,229,141,4,6,172,
+117,231,43,188,150,193,227,253,94,138,118,112,142,141,113,116,140,4,2,252,
+113,253,52,245,246,185,22,133,2,72,75,254,92,3,63,229,101,141,254,185,115,
+167,159,119,135,170,164,133,2,23,0,0,4,251,170,252,181,255,29,0,0,0,21,0,
+33,0,34,0,35,0,0,2,6,35,34,38,53,39,7,22,22,21,17,35,17,51,23,54,54,51,50,
+22,21,4,22,51,50,54,53,52,38,35,34,6,21,19,17,227,168,150,145,164,109,2,2,
+2,149,109,176,30,139,113,148,168,254,24,97,77,80,92,92,80,82,92,60,253,212,
+187,186,131,102,2,26,39,27,254,197,2,110,170,74,107,192,136,82,108,110,78,
+88,117,115,86,1,170,252,181,0,0,4,249,190,252,63,1,94,0,0,0,72,0,83,0,84,
+0,85,0,0,1,22,22,21,16,7,38,38,53,52,54,51,50,23,54,51,50,22,23,54,54,51,
+50,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,22,22,21,20,
+6,7,39,54,54,53,52,38,35,34,7,22,22,21,20,6,7,39,54,54,53,52,38,35,34,7,6,
+21,20,22,23,54,54,53,52,38,1,33,251,16,42,57,201,102,134,247,175,113,94,92,
+123,107,184,61,58,170,108,193,227,227,176,60,100,43,66,26,74,35,101,140,139,
+115,94,139,37,4,4,116,95,92,66,71,149,111,57,41,43,47,110,87,92,60,65,141,
+111,47,159,60,39,29,39,30,37,6,66,252,113,254,254,56,146,97,254,250,142,60,
+219,133,203,246,54,54,68,96,74,90,253,182,183,240,16,20,129,12,12,151,127,
+139,160,104,78,24,56,28,133,235,63,115,53,146,98,148,161,16,55,146,92,133,
+219,60,132,47,139,94,148,155,102,72,137,66,105,40,41,96,70,59,113,1,133,0,
+0,4,250,166,252,181,0,115,0,0,0,70,0,81,0,82,0,83,0,0,5,22,22,21,20,7,38,
+38,53,52,54,51,50,23,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,55,
+22,22,51,50,54,53,52,38,35,34,6,7,22,21,20,6,7,39,54,54,53,52,38,35,34,7,
+22,21,20,6,7,39,54,54,53,52,38,35,34,7,6,21,20,22,23,54,54,53,52,38,1,17,
+251,193,26,35,154,90,100,182,144,98,72,69,88,80,135,43,46,122,84,150,172,
+168,125,53,74,33,47,21,49,24,64,98,90,82,59,94,35,8,84,82,80,53,43,104,74,
+30,23,47,98,60,86,41,54,101,76,22,125,33,27,20,19,14,24,2,4,238,41,96,65,
+197,106,47,168,104,150,174,37,37,54,65,48,71,179,143,148,173,16,16,117,8,
+10,88,98,84,109,66,47,39,53,105,157,43,118,39,86,64,98,107,9,77,115,113,157,
+41,122,33,96,64,96,101,76,45,80,43,72,26,24,60,43,38,74,1,78,252,181,0,0,
+5,249,141,252,63,1,199,0,0,0,55,0,67,0,74,0,75,0,76,0,0,0,54,55,22,4,23,50,
+54,53,52,39,39,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,
+6,6,7,39,54,53,52,38,35,34,6,21,20,23,23,22,22,21,20,6,35,34,38,53,36,38,
+35,34,6,21,20,22,51,50,54,53,37,20,22,51,51,38,38,1,33,249,141,17,14,209,
+1,1,44,31,59,5,20,6,230,172,127,188,41,41,170,123,191,223,225,193,127,156,
+35,24,64,41,94,133,145,111,129,131,4,9,5,7,199,158,187,245,7,150,133,123,
+109,145,133,121,108,148,248,244,146,114,16,19,136,6,112,252,113,254,26,80,
+35,9,178,230,59,61,29,21,88,24,37,165,204,95,77,77,95,250,178,180,253,99,
+57,49,76,31,132,98,186,148,157,137,104,27,22,46,31,50,31,120,153,224,202,
+134,163,158,132,127,166,147,150,2,122,153,112,142,2,31,0,5,250,137,252,181,
+0,188,0,0,0,54,0,66,0,74,0,75,0,76,0,0,0,54,55,22,22,23,50,54,53,52,39,39,
+38,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,39,6,6,7,39,54,
+54,53,52,38,35,34,6,21,20,22,21,20,6,35,34,38,53,36,38,35,34,6,21,20,22,51,
+50,54,53,5,20,23,22,51,38,39,38,1,17,250,137,13,10,176,182,35,22,37,3,6,3,
+4,162,133,76,135,41,39,123,96,148,175,171,150,100,118,36,16,50,28,86,47,51,
+100,74,72,82,13,153,136,143,183,5,158,93,85,80,100,100,86,86,86,250,223,53,
+52,86,23,41,41,2,21,254,123,61,27,2,137,150,43,33,20,15,28,13,35,26,118,159,
+58,49,47,60,175,141,148,179,62,38,29,53,18,122,39,86,62,98,105,95,73,35,47,
+49,92,121,169,148,95,100,95,92,96,98,114,78,8,86,47,47,78,46,46,1,182,252,
+181,0,3,251,139,252,63,1,0,0,0,0,34,0,35,0,36,0,0,1,22,22,21,17,35,17,51,
+1,22,22,51,50,17,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,35,34,38,39,39,
+3,1,33,252,49,4,2,172,172,1,115,47,84,43,125,117,94,33,45,16,70,31,90,51,
+165,214,155,142,79,132,50,50,240,4,203,252,113,254,115,35,78,35,254,113,3,
+63,253,234,68,96,1,35,131,141,8,8,135,12,17,232,198,190,241,88,71,71,1,80,
+1,139,0,3,251,252,252,181,254,248,0,0,0,31,0,32,0,33,0,0,1,22,21,17,35,17,
+51,1,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,38,39,39,
+19,17,252,141,4,149,149,1,21,31,61,31,41,30,79,64,41,20,64,51,76,123,162,
+101,102,67,120,71,154,224,254,143,26,29,254,203,2,110,254,121,45,65,95,87,
+98,101,13,123,21,174,150,144,175,61,98,217,1,111,252,181,0,3,250,0,249,137,
+1,6,0,0,0,71,0,72,0,73,0,0,1,20,6,35,33,34,38,53,17,52,54,55,51,6,6,21,17,
+20,22,51,33,50,54,53,17,52,38,35,34,6,21,20,22,51,50,55,23,6,6,35,34,38,53,
+52,54,51,50,22,18,22,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,
+35,34,38,39,1,33,254,90,156,157,254,24,149,164,35,35,176,35,51,73,99,1,194,
+100,74,143,139,117,145,129,114,64,37,55,35,82,59,166,227,242,204,204,204,
+28,147,126,101,134,135,113,69,58,61,43,100,68,168,223,223,180,82,142,57,2,
+166,252,113,250,211,145,185,174,156,3,215,82,113,47,29,113,88,252,45,98,94,
+102,90,2,191,198,164,165,121,142,139,23,130,20,23,230,203,178,250,228,254,
+174,147,160,131,125,153,26,131,20,19,230,198,182,251,62,51,3,80,0,0,3,250,
+205,251,14,0,39,0,0,0,70,0,71,0,72,0,0,1,52,38,35,34,6,21,20,22,51,50,55,
+23,6,6,35,34,38,53,52,54,51,50,30,2,51,50,54,53,52,38,35,34,7,39,54,54,51,
+50,22,21,20,6,35,34,38,39,17,20,6,35,33,34,38,53,17,52,54,55,51,6,6,21,17,
+20,22,51,33,50,53,3,1,253,154,105,88,74,102,86,72,34,35,56,29,58,47,123,171,
+184,151,152,155,18,104,96,80,84,89,69,57,37,56,31,74,53,123,170,168,135,58,
+112,41,111,123,254,125,113,122,24,27,152,25,39,47,62,1,106,107,41,2,108,254,
+53,124,106,99,100,82,100,14,119,13,15,172,149,140,182,170,230,112,112,80,
+90,101,19,117,16,15,169,153,133,188,38,35,254,178,116,146,128,118,2,227,62,
+84,35,23,82,67,253,43,66,65,118,3,242,252,181,0,0,4,252,106,252,68,255,104,
+255,206,0,5,0,9,0,10,0,11,0,0,3,33,17,51,17,33,1,51,17,35,1,35,152,254,76,
+180,1,0,253,2,181,181,1,3,177,252,68,3,88,253,51,2,205,252,168,3,138,0,0,
+2,0,166,252,68,3,246,4,76,0,5,0,9,0,0,1,33,17,51,17,33,1,51,17,35,3,246,254,
+73,181,1,2,252,176,180,180,252,68,8,8,248,131,7,125,247,248,0,0,4,250,47,
+252,154,254,223,255,206,0,23,0,35,0,36,0,37,0,0,1,55,22,22,51,50,62,2,51,
+50,22,21,20,6,35,34,38,39,6,6,35,34,38,4,22,51,50,54,53,52,38,35,34,6,21,
+19,51,250,47,123,27,77,54,56,100,76,179,129,179,200,203,178,145,195,22,29,
+96,57,83,151,2,57,118,97,93,118,119,94,97,116,210,183,254,43,61,58,46,84,
+200,128,232,162,152,224,177,122,35,39,80,30,136,132,103,112,144,138,111,1,
+183,0,0,2,251,209,252,68,1,104,4,217,0,12,0,13,0,0,5,51,17,5,17,51,17,1,17,
+1,37,55,5,1,254,154,174,1,114,174,253,50,254,200,254,111,70,1,14,3,223,82,
+253,238,136,7,54,247,250,1,0,1,77,254,41,240,121,160,7,86,0,2,254,119,252,
+72,1,104,4,217,0,5,0,6,0,0,1,17,1,55,5,17,55,1,104,253,15,47,2,20,74,4,74,
+247,254,1,12,135,195,7,50,143,0,3,250,96,251,182,1,104,4,217,0,31,0,43,0,
+44,0,0,1,55,22,22,51,50,62,2,51,50,22,21,20,6,7,5,17,51,17,1,6,6,35,34,38,
+39,6,6,35,34,38,4,22,51,50,54,53,52,38,35,34,6,21,1,250,96,123,27,78,53,54,
+101,78,179,129,177,201,30,33,1,233,174,252,248,41,100,64,146,195,21,29,96,
+57,83,151,2,58,116,99,93,118,118,95,98,115,4,65,254,43,61,58,46,81,204,127,
+232,162,53,112,50,180,7,195,247,108,1,25,25,28,179,120,35,39,80,29,137,134,
+101,109,147,137,112,6,194,0,3,251,197,251,182,1,104,4,217,0,19,0,31,0,32,
+0,0,1,17,1,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,5,17,0,22,51,50,54,53,
+52,38,35,34,6,21,1,1,104,253,48,54,152,106,184,227,226,189,193,229,16,19,
+1,211,251,172,144,112,109,147,146,110,118,138,4,158,4,74,247,108,1,2,53,68,
+244,187,181,249,254,187,43,90,45,170,7,195,249,36,163,155,123,140,163,168,
+129,6,242,0,0,5,254,33,255,206,2,31,8,6,0,17,0,18,0,19,0,20,0,21,0,0,51,17,
+52,38,35,34,6,21,21,35,53,52,54,51,50,18,21,17,51,33,19,3,186,120,125,111,
+135,174,231,189,199,220,183,254,248,64,64,6,61,146,174,152,153,33,29,205,
+241,254,254,227,249,223,7,216,247,246,0,4,254,236,255,206,3,115,4,217,0,25,
+0,26,0,27,0,28,0,0,55,22,51,50,54,53,52,38,35,34,6,7,39,54,36,51,50,4,18,
+21,20,0,35,34,38,39,19,19,21,143,76,113,169,193,219,184,118,232,111,106,110,
+1,14,185,192,1,14,132,254,210,221,92,133,57,214,61,168,37,231,193,179,235,
+118,128,113,129,153,169,254,250,134,250,254,189,24,29,4,184,251,39,50,0,0,
+6,251,243,4,217,255,59,8,4,0,11,0,23,0,24,0,25,0,26,0,27,0,0,2,6,35,34,38,
+53,52,54,51,50,22,21,4,22,51,50,54,53,52,38,35,34,6,21,19,41,2,246,208,173,
+167,203,203,171,177,200,253,180,115,98,93,118,112,99,100,113,207,254,102,
+3,72,253,118,5,219,217,223,162,160,225,232,161,100,140,134,102,110,150,143,
+109,254,90,0,6,251,233,4,217,255,10,8,4,0,11,0,27,0,39,0,40,0,41,0,42,0,0,
+2,6,35,34,38,53,52,54,51,50,22,21,4,22,21,54,54,51,50,22,23,53,52,38,35,34,
+6,21,5,38,38,35,34,6,7,22,22,51,50,54,7,35,35,246,208,173,167,203,203,171,
+177,200,253,180,3,40,105,65,66,102,43,112,99,100,113,1,132,39,86,50,47,86,
+41,29,86,59,60,86,152,220,200,5,219,217,223,162,160,225,232,161,6,8,9,35,
+45,41,37,17,110,150,143,109,147,30,37,37,33,43,51,54,232,0,0,2,252,113,253,
+230,253,170,0,0,0,5,0,6,0,0,1,33,53,51,17,51,39,253,170,254,199,164,149,95,
+253,230,125,1,117,40,0,2,0,113,255,236,4,156,4,94,0,26,0,38,0,0,1,54,54,51,
+50,22,23,6,4,35,34,0,53,52,0,51,50,4,23,7,38,38,35,34,6,21,20,23,22,22,51,
+50,54,55,38,38,35,34,6,1,57,74,199,121,106,215,152,45,254,233,188,255,254,
+212,1,45,254,175,1,11,53,143,51,185,118,167,200,76,47,145,99,100,164,55,59,
+144,77,109,162,1,156,63,76,72,106,180,213,1,72,243,243,1,68,185,149,73,127,
+129,228,186,82,199,65,76,92,92,35,51,71,0,0,2,252,214,4,177,254,210,6,222,
+0,3,0,4,0,0,1,1,7,1,19,253,61,1,149,100,254,104,183,6,222,254,113,115,1,144,
+254,69,0,6,251,215,4,217,255,10,8,4,0,11,0,23,0,35,0,47,0,48,0,49,0,0,0,22,
+21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,18,22,21,
+20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,17,33,254,30,
+236,234,175,180,230,234,176,118,154,159,113,114,159,152,121,77,105,105,77,
+79,104,105,78,39,49,51,39,35,51,47,39,254,232,8,4,220,165,171,214,219,166,
+162,223,253,113,147,123,117,155,152,120,119,151,1,196,102,80,80,100,101,79,
+80,102,254,242,49,39,41,49,49,41,39,49,254,174,0,0,2,252,83,4,177,254,76,
+6,222,0,3,0,4,0,0,1,1,39,1,3,254,76,254,109,102,1,147,89,6,108,254,112,115,
+1,143,253,211,0,3,252,27,4,217,255,0,8,4,0,25,0,37,0,38,0,0,1,6,6,35,34,38,
+53,52,54,51,50,22,23,7,38,38,35,34,6,21,21,54,54,51,50,22,7,38,38,35,34,6,
+7,22,22,51,50,54,7,255,0,36,193,129,183,200,216,185,103,188,39,131,24,113,
+70,111,119,46,112,72,117,173,124,35,86,51,47,95,41,27,86,59,60,92,158,6,18,
+126,146,220,165,166,219,108,99,67,61,76,143,105,29,35,41,95,97,26,31,31,35,
+45,49,56,234,0,0,4,252,137,4,217,254,76,7,154,0,11,0,23,0,24,0,25,0,0,0,38,
+53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,3,19,253,4,
+123,123,100,99,129,129,99,45,61,55,53,48,61,61,48,8,43,5,6,113,104,103,114,
+114,101,104,115,1,70,58,51,51,57,57,51,51,58,1,78,253,63,0,0,3,252,137,253,
+109,254,76,255,206,0,11,0,23,0,24,0,0,4,22,21,20,6,35,34,38,53,52,54,51,18,
+54,53,52,38,35,34,6,21,20,22,51,3,253,203,129,129,99,100,123,123,100,50,61,
+61,48,47,61,55,53,8,225,115,100,105,114,112,105,102,115,254,186,57,52,51,
+57,57,51,52,57,1,245,0,4,0,129,255,233,2,68,4,74,0,11,0,23,0,35,0,47,0,0,
+22,38,53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,2,38,
+53,52,54,51,50,22,21,20,6,35,2,6,21,20,22,51,50,54,53,52,38,35,252,123,123,
+100,99,129,129,99,45,61,55,53,47,62,62,47,102,123,123,100,99,129,129,99,45,
+61,55,53,47,62,62,47,23,113,105,102,115,115,100,105,115,1,70,57,51,52,57,
+57,52,51,57,1,105,112,105,102,115,115,100,105,114,1,69,57,51,52,57,57,52,
+51,57,0,0,2,252,45,252,172,254,197,0,0,0,11,0,12,0,0,1,33,17,51,17,33,21,
+33,17,35,17,33,1,252,45,1,0,152,1,0,255,0,152,255,0,1,74,254,55,1,0,255,0,
+139,255,0,1,0,2,84,0,2,252,29,4,217,254,207,8,4,0,19,0,20,0,0,1,38,38,35,
+34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,1,254,90,33,102,64,100,110,
+100,61,90,104,131,212,160,105,166,47,254,190,7,4,55,64,139,99,108,139,41,
+107,57,203,135,173,202,86,80,253,123,0,0,2,254,175,252,68,1,104,4,219,0,7,
+0,8,0,0,1,17,37,17,51,17,5,17,55,1,104,253,71,174,1,93,74,4,74,247,250,248,
+3,253,252,91,128,7,54,145,0,5,251,238,252,57,254,225,255,206,0,13,0,27,0,
+28,0,29,0,30,0,0,5,23,22,22,21,20,6,35,34,38,53,52,54,55,55,7,6,6,21,20,22,
+51,50,54,53,52,38,39,3,51,33,253,102,232,78,69,203,180,171,201,71,78,227,
+120,31,62,113,102,102,111,57,35,123,176,254,152,82,237,78,156,84,134,196,
+195,135,84,156,80,55,146,38,118,71,76,118,115,79,72,113,42,1,102,0,2,252,
+37,252,68,253,217,255,206,0,5,0,6,0,0,1,33,17,51,17,33,1,252,37,1,0,180,254,
+76,1,82,252,207,2,205,252,168,3,138,0,4,252,0,252,186,253,201,0,0,0,5,0,6,
+0,7,0,8,0,0,1,33,53,51,19,51,39,55,19,253,28,254,228,176,121,160,182,34,20,
+253,223,125,1,117,40,7,252,186,0,5,252,27,4,217,254,182,8,4,0,11,0,23,0,24,
+0,25,0,26,0,0,0,38,53,52,54,51,50,22,21,20,6,35,18,38,35,34,6,21,20,22,51,
+50,54,53,3,35,35,252,205,178,185,148,152,182,182,156,174,90,80,79,91,93,77,
+74,96,173,250,80,5,2,223,162,167,218,225,168,156,221,1,227,150,143,109,104,
+140,131,105,254,98,0,0,2,252,145,4,217,254,80,8,20,0,3,0,4,0,0,1,1,7,1,19,
+253,29,1,51,139,254,204,252,8,20,253,37,65,2,219,253,6,0,19,0,98,255,206,
+4,94,4,132,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,
+0,111,0,119,0,127,0,128,0,129,0,130,0,0,0,53,52,51,50,21,20,35,38,53,52,51,
+50,21,20,35,22,53,52,51,50,21,20,35,6,53,52,51,50,21,20,35,0,53,52,51,50,
+21,20,35,6,53,52,51,50,21,20,35,0,53,52,51,50,21,20,35,0,53,52,51,50,21,20,
+35,0,53,52,51,50,21,20,35,6,53,52,51,50,21,20,35,0,53,52,51,50,21,20,35,6,
+53,52,51,50,21,20,35,0,53,52,51,50,21,20,35,0,53,52,51,50,21,20,35,22,53,
+52,51,50,21,20,35,38,53,52,51,50,21,20,35,1,17,17,3,109,55,51,51,205,57,52,
+52,191,55,53,55,16,55,51,51,254,0,53,54,54,227,53,55,55,2,29,53,55,55,252,
+229,54,55,55,2,78,55,51,51,205,57,52,52,253,117,55,54,52,92,56,53,53,1,145,
+53,54,54,254,37,55,54,54,193,53,55,55,201,54,55,55,1,65,3,96,54,55,55,54,
+99,53,55,55,53,248,55,53,53,55,172,53,53,53,53,1,198,56,53,53,56,34,53,55,
+55,53,253,174,53,55,55,53,1,239,51,58,55,54,253,123,53,56,56,53,96,51,55,
+55,51,2,80,55,53,53,55,172,53,53,53,53,254,55,55,54,54,55,1,27,53,55,55,53,
+246,51,55,51,55,96,53,56,56,53,254,243,4,182,251,124,0,0,1,252,150,253,125,
+254,184,254,160,0,12,0,0,1,6,35,34,38,39,55,22,22,51,50,54,55,254,184,96,
+135,112,171,32,122,31,113,63,56,100,41,253,215,90,124,105,62,86,74,55,58,
+0,255,255,251,183,4,217,0,64,8,4,0,38,1,208,156,0,0,7,1,159,1,244,0,0,255,
+255,251,101,4,217,1,198,8,6,0,39,0,189,254,242,0,0,0,39,1,159,3,122,0,0,0,
+7,1,208,1,44,0,0,255,255,250,47,252,154,1,7,255,206,2,38,1,144,0,0,0,7,1,
+160,2,187,0,0,255,255,251,238,252,154,1,5,255,206,2,38,0,48,0,0,0,7,1,160,
+2,185,0,0,255,255,251,111,252,68,0,159,255,206,2,38,0,178,0,0,0,7,1,160,2,
+83,0,0,255,255,250,143,252,68,1,10,255,206,2,38,0,179,0,0,0,7,1,160,2,190,
+0,0,255,255,252,37,252,68,0,8,255,206,2,38,1,166,0,0,0,7,1,160,1,188,0,0,
+255,255,252,216,252,68,1,11,255,206,0,39,1,160,2,191,0,0,0,6,1,142,110,0,
+255,255,254,35,252,68,1,15,255,206,0,39,1,160,2,195,0,0,0,7,0,209,1,21,0,
+0,255,255,0,166,252,68,3,143,4,74,0,38,0,210,0,0,0,7,1,160,5,67,0,0,255,255,
+0,166,252,68,5,41,4,76,0,39,1,160,6,221,0,0,0,6,1,143,0,0,255,255,255,169,
+253,109,1,108,255,206,0,7,1,160,3,32,0,0,0,5,251,47,251,161,255,174,0,0,0,
+38,0,50,0,62,0,74,0,75,0,0,5,54,54,51,50,22,21,20,6,35,34,38,39,55,22,22,
+51,50,54,53,52,38,35,34,6,7,22,21,20,6,35,34,38,53,52,54,51,50,22,6,38,35,
+34,6,21,20,22,51,50,54,53,0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,
+35,34,6,21,20,22,51,1,253,113,39,129,79,151,175,170,123,51,74,32,47,18,49,
+27,63,99,90,80,56,100,33,6,171,152,152,176,178,150,92,119,37,93,79,86,92,
+88,88,86,88,1,225,129,129,99,100,123,122,101,50,61,61,48,47,61,55,53,254,
+204,227,59,68,179,143,152,169,16,16,117,8,10,88,98,84,109,54,71,37,37,138,
+173,172,151,142,178,68,173,110,111,88,80,102,104,78,254,189,97,84,89,96,94,
+89,85,98,254,254,39,36,35,39,39,35,36,39,3,243,0,0,5,249,177,250,197,255,
+167,0,0,0,11,0,23,0,61,0,73,0,74,0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,
+54,53,52,38,35,34,6,21,20,22,51,1,54,54,51,50,18,21,20,6,35,34,38,39,55,22,
+51,50,54,53,52,38,35,34,6,7,22,22,21,20,6,35,34,38,53,52,54,51,50,18,38,35,
+34,6,21,20,22,51,50,54,53,19,254,142,129,129,99,100,123,123,100,50,61,61,
+48,47,61,55,53,254,124,61,178,105,193,229,240,168,59,99,43,62,51,76,105,151,
+133,123,84,148,49,4,8,227,199,187,224,225,191,217,41,145,111,115,141,139,
+117,109,147,86,252,56,98,86,90,97,96,89,88,98,254,249,40,37,37,40,40,37,37,
+40,3,182,91,90,254,255,184,183,234,16,20,125,24,147,131,131,172,100,82,16,
+64,37,170,252,248,183,181,249,254,206,168,161,136,122,164,157,121,2,31,255,
+255,0,63,253,109,2,2,255,206,0,7,1,160,3,182,0,0,255,255,0,186,252,68,6,154,
+8,6,2,38,0,194,0,0,0,7,1,171,5,63,0,49,255,255,0,186,252,68,10,55,8,6,2,38,
+0,195,0,0,0,7,1,171,8,221,0,49,255,255,0,186,252,68,6,150,8,6,2,38,0,196,
+0,0,0,7,1,171,5,63,0,49,255,255,0,186,252,68,10,51,8,6,2,38,0,197,0,0,0,7,
+1,171,8,221,0,49,0,1,255,220,0,183,0,36,6,131,0,3,0,0,19,17,35,17,36,72,6,
+131,250,52,5,204,0,1,255,37,0,183,0,219,6,131,0,14,0,0,55,35,17,7,39,55,39,
+55,23,55,23,7,23,7,39,36,72,134,49,171,171,49,170,170,49,171,171,49,134,183,
+4,161,136,49,169,168,49,171,171,49,168,169,49,136,255,255,250,0,252,57,254,
+225,255,206,2,38,1,165,0,0,0,7,1,160,253,119,0,0,255,255,250,116,252,68,254,
+9,255,206,2,38,1,200,0,0,0,7,1,160,253,235,0,0,255,255,250,157,252,68,255,
+214,255,206,0,39,1,160,254,20,0,0,0,6,1,142,110,0,255,255,251,232,252,68,
+255,218,255,206,0,39,1,160,255,95,0,0,0,7,0,209,1,21,0,0,255,255,254,107,
+252,68,2,92,4,74,2,38,0,210,0,0,0,7,1,160,1,226,0,0,255,255,254,107,252,68,
+3,246,4,76,2,38,1,143,0,0,0,7,1,160,1,226,0,0,0,4,251,61,252,68,254,9,255,
+206,0,5,0,6,0,7,0,8,0,0,1,33,19,51,1,33,1,35,51,251,61,1,0,232,180,254,235,
+254,121,2,58,100,246,252,207,2,205,252,168,3,138,0,255,255,250,186,252,68,
+255,109,255,206,0,39,0,209,0,168,0,0,0,7,1,200,255,125,0,0,255,255,249,218,
+252,68,255,215,255,206,0,38,1,142,111,0,0,7,1,200,254,157,0,0,255,255,254,
+33,255,206,2,31,10,153,2,38,1,149,0,0,0,7,1,159,3,202,2,255,255,255,254,33,
+255,206,2,156,10,5,2,38,1,149,0,0,0,7,1,155,3,202,3,39,255,255,254,236,255,
+206,3,115,7,154,2,38,1,150,0,0,0,7,1,159,3,181,0,0,255,255,254,236,255,206,
+3,115,7,6,2,38,1,150,0,0,0,7,1,155,3,181,0,40,0,5,0,113,253,62,4,201,4,217,
+0,25,0,34,0,35,0,36,0,37,0,0,1,52,38,35,34,6,7,4,0,17,6,6,35,34,0,53,52,18,
+54,51,50,22,18,21,17,35,1,38,38,39,20,22,51,50,54,3,1,51,4,18,204,166,146,
+178,33,1,15,1,45,47,117,61,251,254,214,143,249,165,163,249,143,183,254,187,
+8,231,179,199,172,10,22,32,254,212,170,2,33,187,237,156,125,24,254,160,254,
+218,16,22,1,68,247,162,1,9,140,141,254,246,160,251,23,3,71,179,214,17,189,
+223,2,4,84,250,245,0,0,6,252,27,4,217,254,182,8,4,0,11,0,26,0,38,0,39,0,40,
+0,41,0,0,0,38,53,52,54,51,50,22,21,20,6,35,3,54,54,51,50,22,23,53,52,38,35,
+34,6,21,20,5,38,38,35,34,6,7,22,22,51,50,54,7,35,35,252,205,178,185,148,152,
+182,182,156,163,32,84,51,54,82,34,90,80,79,91,1,56,31,68,41,36,70,33,23,69,
+47,48,69,122,250,80,5,2,223,162,167,218,225,168,156,221,1,98,35,45,41,37,
+17,110,150,143,116,11,129,30,37,37,33,43,51,54,232,0,0,2,253,90,252,68,1,
+104,4,219,0,7,0,8,0,0,1,17,1,17,51,17,5,17,55,1,104,251,242,174,2,178,74,
+4,74,247,250,1,17,3,3,253,106,174,7,54,145,0,255,255,249,241,252,68,255,109,
+255,206,0,39,0,209,0,168,0,0,0,39,1,200,255,125,0,0,0,7,1,160,253,104,0,0,
+255,255,249,17,252,68,255,215,255,206,0,38,1,142,111,0,0,39,1,200,254,157,
+0,0,0,7,1,160,252,136,0,0,0,6,249,177,250,197,0,56,0,0,0,37,0,49,0,63,0,77,
+0,78,0,79,0,0,1,54,54,51,50,18,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,
+35,34,6,7,22,22,21,20,6,35,34,38,53,52,54,51,50,18,38,35,34,6,21,20,22,51,
+50,54,53,1,23,22,22,21,20,6,35,34,38,53,52,54,55,23,7,6,6,21,20,22,51,50,
+54,53,52,38,39,1,33,252,169,61,178,105,193,229,240,168,59,99,43,62,51,76,
+105,151,133,123,84,148,49,4,8,227,199,187,224,225,191,217,41,145,111,115,
+141,139,117,109,147,1,218,138,47,41,117,111,108,115,41,47,137,53,22,21,43,
+53,54,43,21,22,254,70,3,143,254,231,91,90,254,255,184,183,234,16,20,125,24,
+147,131,131,172,100,82,16,64,37,170,252,248,183,181,249,254,206,168,161,136,
+122,164,157,121,254,87,89,31,71,36,59,85,89,55,36,71,31,43,32,14,24,16,15,
+30,30,15,16,24,14,4,108,0,0,5,251,47,251,161,255,174,0,0,0,38,0,50,0,64,0,
+78,0,79,0,0,5,54,54,51,50,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,
+38,35,34,6,7,22,21,20,6,35,34,38,53,52,54,51,50,22,6,38,35,34,6,21,20,22,
+51,50,54,53,1,23,22,22,21,20,6,35,34,38,53,52,54,55,23,7,6,6,21,20,22,51,
+50,54,53,52,38,39,1,253,113,39,129,79,151,175,170,123,51,74,32,47,18,49,27,
+63,99,90,80,56,100,33,6,171,152,152,176,178,150,92,119,37,93,79,86,92,88,
+88,86,88,1,128,138,47,41,117,111,108,115,41,47,137,53,22,21,43,53,54,43,21,
+22,254,150,227,59,68,179,143,152,169,16,16,117,8,10,88,98,84,109,54,71,37,
+37,138,173,172,151,142,178,68,173,110,111,88,80,102,104,78,254,194,89,31,
+71,36,59,85,89,55,36,71,31,43,32,14,24,16,15,30,30,15,16,24,14,3,144,0,1,
+0,186,252,70,11,67,8,6,0,31,0,0,1,34,6,21,17,20,22,51,33,50,54,53,17,51,17,
+16,33,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,2,86,119,108,108,119,7,
+84,116,111,182,254,92,248,191,254,92,1,164,7,65,1,164,182,111,116,7,115,135,
+121,247,104,123,135,135,123,3,94,252,195,254,74,1,182,8,84,1,182,254,74,60,
+95,121,135,0,1,0,186,252,70,11,67,8,6,0,24,0,0,1,34,6,21,17,20,22,51,33,50,
+54,53,17,51,17,16,33,33,32,17,17,16,33,33,21,2,86,119,108,108,119,7,84,116,
+111,182,254,92,248,191,254,92,1,164,4,53,7,115,135,121,247,104,123,135,135,
+123,3,94,252,195,254,74,1,182,8,84,1,182,147,0,0,2,0,186,252,68,6,154,8,6,
+0,37,0,51,0,0,5,23,22,22,21,20,6,35,33,32,17,17,16,33,33,32,17,21,35,53,52,
+38,35,33,34,6,21,17,20,22,51,33,38,38,53,52,54,55,55,7,6,6,21,20,22,51,50,
+54,53,52,38,39,5,29,232,78,69,203,180,253,69,254,92,1,164,2,152,1,164,183,
+110,117,253,86,119,108,108,119,1,134,27,28,71,78,227,120,31,62,112,103,103,
+110,57,35,82,234,77,154,83,132,194,1,182,8,86,1,182,254,74,60,95,121,135,
+135,121,247,102,123,135,38,99,42,83,154,79,52,143,37,117,69,74,116,114,76,
+71,110,42,0,0,2,0,186,252,68,10,55,8,6,0,37,0,51,0,0,5,23,22,22,21,20,6,35,
+33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,20,22,51,33,38,
+38,53,52,54,55,55,7,6,6,21,20,22,51,50,54,53,52,38,39,8,184,232,78,69,203,
+180,249,170,254,92,1,164,6,53,1,164,182,111,116,249,184,119,108,108,119,5,
+33,27,28,71,78,227,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,194,
+1,182,8,86,1,182,254,74,60,95,121,135,135,121,247,102,123,135,38,99,42,83,
+154,79,52,143,37,117,69,74,116,114,76,71,110,42,0,0,2,0,186,252,68,6,152,
+8,6,0,30,0,44,0,0,5,23,22,22,21,20,6,35,33,32,17,17,16,33,51,21,35,34,6,21,
+17,20,22,51,33,38,38,53,52,54,55,55,7,6,6,21,20,22,51,50,54,53,52,38,39,5,
+29,232,78,69,203,180,253,69,254,92,1,164,170,178,119,108,108,119,1,134,27,
+28,71,78,227,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,194,1,182,
+8,86,1,182,147,135,121,247,102,123,135,38,99,42,83,154,79,52,143,37,117,69,
+74,116,114,76,71,110,42,0,2,0,186,252,68,10,51,8,6,0,30,0,44,0,0,5,23,22,
+22,21,20,6,7,33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,38,38,53,52,
+54,55,55,7,6,6,21,20,22,51,50,54,53,52,38,39,8,184,232,78,69,201,180,249,
+168,254,92,1,164,3,25,252,223,119,108,108,119,5,33,27,28,71,78,227,120,31,
+62,112,103,103,110,57,35,82,234,77,154,83,132,192,2,1,182,8,86,1,182,147,
+135,121,247,102,123,135,38,99,42,83,154,79,52,143,37,117,69,74,116,114,76,
+71,110,42,0,0,3,250,49,252,57,254,225,255,206,0,18,0,32,0,33,0,0,5,23,22,
+22,21,20,6,35,34,38,39,5,3,55,23,55,54,54,55,55,7,6,6,21,20,22,51,50,54,53,
+52,38,39,3,253,102,232,78,69,203,180,140,190,30,254,226,171,121,106,224,12,
+69,62,227,120,31,62,113,102,102,111,57,35,123,82,237,78,156,84,134,196,135,
+110,147,1,54,68,194,117,64,123,64,55,146,38,119,70,76,118,115,79,72,113,42,
+1,102,255,255,250,49,252,57,254,225,0,154,2,38,1,220,0,0,0,7,1,160,253,186,
+0,204,0,2,0,186,252,68,6,154,8,6,0,41,0,55,0,0,5,23,22,22,21,20,6,35,33,32,
+17,17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,20,22,51,33,38,38,53,
+52,55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,5,29,232,78,69,
+203,180,253,69,254,92,1,164,2,152,1,164,183,110,117,253,86,119,108,108,119,
+1,134,27,28,11,233,180,121,115,1,55,231,120,31,62,112,103,103,110,57,35,82,
+234,77,154,83,132,194,1,182,8,86,1,182,254,74,60,95,121,135,135,121,247,102,
+123,135,38,99,42,47,44,125,1,82,68,222,162,56,143,37,117,69,74,116,114,76,
+71,110,42,0,0,2,0,186,252,68,10,55,8,6,0,41,0,55,0,0,5,23,22,22,21,20,6,7,
+33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,20,22,51,33,38,
+38,53,52,55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,8,184,232,
+78,69,201,180,249,168,254,92,1,164,6,53,1,164,182,111,116,249,184,119,108,
+108,119,5,33,27,28,11,237,180,121,115,1,63,227,120,31,62,112,103,103,110,
+57,35,82,234,77,154,83,132,192,2,1,182,8,86,1,182,254,74,60,95,121,135,135,
+121,247,102,123,135,38,99,42,48,46,128,1,82,68,222,167,51,143,37,117,69,74,
+116,114,76,71,110,42,0,2,0,186,252,68,6,152,8,6,0,34,0,48,0,0,5,23,22,22,
+21,20,6,35,33,32,17,17,16,33,51,21,35,34,6,21,17,20,22,51,33,38,38,53,52,
+55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,5,29,232,78,69,203,
+180,253,69,254,92,1,164,170,178,119,108,108,119,1,134,27,28,11,233,180,121,
+115,1,55,231,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,194,1,182,
+8,86,1,182,147,135,121,247,102,123,135,38,99,42,47,44,125,1,82,68,222,162,
+56,143,37,117,69,74,116,114,76,71,110,42,0,2,0,186,252,68,10,51,8,6,0,34,
+0,48,0,0,5,23,22,22,21,20,6,7,33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,
+51,33,38,38,53,52,55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,
+8,184,232,78,69,201,180,249,168,254,92,1,164,3,25,252,223,119,108,108,119,
+5,33,27,28,11,237,180,121,115,1,63,227,120,31,62,112,103,103,110,57,35,82,
+234,77,154,83,132,192,2,1,182,8,86,1,182,147,135,121,247,102,123,135,38,99,
+42,48,46,128,1,82,68,222,167,51,143,37,117,69,74,116,114,76,71,110,42,0,0,
+2,0,186,252,68,11,68,8,6,0,35,0,47,0,0,1,32,17,17,16,33,33,32,17,21,35,53,
+52,38,35,33,34,6,21,17,20,22,51,33,38,38,53,52,54,51,50,22,21,20,6,35,18,
+38,35,34,6,21,20,22,51,50,54,53,2,94,254,92,1,164,7,66,1,164,182,111,116,
+248,171,119,108,108,119,6,66,37,34,203,171,178,199,205,176,217,112,99,100,
+113,115,98,93,118,252,68,1,182,8,86,1,182,254,74,60,95,121,135,135,121,247,
+102,123,135,49,123,66,164,221,233,161,157,219,1,227,149,143,108,105,139,133,
+102,0,2,0,186,252,68,11,69,8,6,0,37,0,51,0,0,5,23,22,22,21,20,6,35,33,32,
+17,17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,20,22,51,33,38,38,53,
+52,54,55,55,7,6,6,21,20,22,51,50,54,53,52,38,39,9,198,232,78,69,203,180,248,
+156,254,92,1,164,7,67,1,164,182,111,116,248,170,119,108,108,119,6,47,27,28,
+71,78,227,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,194,1,182,
+8,86,1,182,254,74,60,95,121,135,135,121,247,102,123,135,38,99,42,83,154,79,
+52,143,37,117,69,74,116,114,76,71,110,42,0,0,2,0,186,252,68,11,66,8,6,0,30,
+0,44,0,0,5,23,22,22,21,20,6,7,33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,
+51,33,38,38,53,52,54,55,55,7,6,6,21,20,22,51,50,54,53,52,38,39,9,199,232,
+78,69,201,180,248,153,254,92,1,164,4,56,251,192,119,108,108,119,6,48,27,28,
+71,78,227,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,192,2,1,182,
+8,86,1,182,147,135,121,247,102,123,135,38,99,42,83,154,79,52,143,37,117,69,
+74,116,114,76,71,110,42,0,0,3,250,96,251,182,1,104,4,217,0,26,0,40,0,41,0,
+0,37,23,22,22,21,20,6,7,5,17,51,17,1,6,6,35,34,38,39,5,3,55,23,55,54,54,55,
+55,7,6,6,21,20,22,51,50,54,53,52,38,39,1,253,149,232,78,69,23,22,1,215,174,
+253,11,52,108,66,140,190,30,254,226,171,121,106,224,12,69,62,227,120,31,62,
+113,102,102,111,57,35,2,244,1,237,78,156,84,36,92,37,170,7,195,247,108,1,
+14,32,24,135,110,147,1,54,68,194,117,64,123,64,55,146,38,119,70,76,118,115,
+79,72,113,42,6,30,0,0,3,252,8,251,182,1,104,4,217,0,20,0,34,0,35,0,0,5,23,
+22,22,21,20,7,5,17,51,17,37,6,6,35,34,38,53,52,54,55,55,7,6,6,21,20,22,51,
+50,54,53,52,38,39,1,253,128,232,78,69,15,1,206,174,253,60,45,142,109,171,
+201,71,78,227,120,31,62,113,102,102,111,57,35,3,9,70,237,78,156,84,42,53,
+169,7,195,247,108,254,47,64,195,135,84,156,80,55,146,38,119,70,76,118,115,
+79,72,113,42,6,101,0,2,0,186,252,68,11,74,8,6,0,41,0,55,0,0,5,23,22,22,21,
+20,6,7,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,20,22,51,
+33,38,38,53,52,55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,9,203,
+232,78,69,201,180,248,149,254,92,1,164,7,72,1,164,182,111,116,248,165,119,
+108,108,119,6,52,27,28,11,237,180,121,115,1,63,227,120,31,62,112,103,103,
+110,57,35,82,234,77,154,83,132,192,2,1,182,8,86,1,182,254,74,60,95,121,135,
+135,121,247,102,123,135,38,99,42,48,46,128,1,82,68,222,167,51,143,37,117,
+69,74,116,114,76,71,110,42,0,2,0,186,252,68,11,69,8,6,0,34,0,48,0,0,5,23,
+22,22,21,20,6,7,33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,38,38,53,
+52,55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,9,202,232,78,69,
+201,180,248,150,254,92,1,164,4,59,251,189,119,108,108,119,6,51,27,28,11,237,
+180,121,115,1,63,227,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,
+192,2,1,182,8,86,1,182,147,135,121,247,102,123,135,38,99,42,48,46,128,1,82,
+68,222,167,51,143,37,117,69,74,116,114,76,71,110,42,0,0,2,0,186,252,68,11,
+70,8,6,0,28,0,40,0,0,1,32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,38,
+38,53,52,54,51,50,22,21,20,6,35,18,38,35,34,6,21,20,22,51,50,54,53,2,94,254,
+92,1,164,4,53,251,195,119,108,108,119,6,72,37,35,203,172,177,200,205,176,
+217,113,98,101,112,114,99,93,118,252,68,1,182,8,86,1,182,147,135,121,247,
+102,123,135,49,123,66,164,221,235,159,155,221,1,227,149,143,108,105,139,135,
+100,0,0,2,0,186,252,68,8,56,8,6,0,28,0,40,0,0,1,32,17,17,16,33,33,21,33,34,
+6,21,17,20,22,51,33,38,38,53,52,54,51,50,22,21,20,6,35,18,38,35,34,6,21,20,
+22,51,50,54,53,2,94,254,92,1,164,1,52,254,196,119,108,108,119,3,58,37,35,
+203,172,177,200,205,176,217,113,98,101,112,114,99,93,118,252,68,1,182,8,86,
+1,182,147,135,121,247,102,123,135,49,123,66,164,221,235,159,155,221,1,227,
+149,143,108,105,139,135,100,0,0,2,0,186,252,68,11,67,8,6,0,40,0,52,0,0,1,
+32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,38,38,53,53,6,35,34,38,39,
+55,22,22,51,50,62,2,51,50,22,21,20,6,35,18,38,35,34,6,21,20,22,51,50,54,53,
+2,94,254,92,1,164,4,53,251,195,119,108,108,119,6,69,37,34,68,82,112,171,32,
+122,31,113,63,58,104,80,156,112,178,199,205,176,217,112,99,100,113,115,98,
+93,118,252,68,1,182,8,86,1,182,147,135,121,247,102,123,135,49,123,66,11,34,
+124,105,62,86,74,61,125,91,233,161,157,219,1,227,149,143,108,105,139,133,
+102,0,1,0,186,252,70,11,68,8,6,0,24,0,0,1,33,32,17,19,16,33,33,32,17,21,35,
+53,52,38,35,33,34,6,21,3,20,22,51,33,7,164,250,187,254,91,1,1,164,7,65,1,
+164,182,111,116,248,172,119,108,1,108,120,5,77,252,70,1,182,8,84,1,182,254,
+74,60,95,121,135,135,121,247,104,123,135,0,1,0,186,252,70,7,164,8,6,0,17,
+0,0,1,33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,7,164,250,186,254,
+92,1,164,4,53,251,195,119,108,108,119,5,78,252,70,1,182,8,84,1,182,147,135,
+121,247,104,123,135,0,0,1,0,186,252,70,13,217,8,6,0,31,0,0,1,34,6,21,17,20,
+22,51,33,50,54,53,17,51,17,16,33,33,32,17,17,16,33,33,32,17,21,35,53,52,38,
+35,2,86,119,108,108,119,9,231,117,112,183,254,90,246,43,254,92,1,164,9,213,
+1,166,183,112,117,7,115,135,121,247,104,123,135,135,123,3,94,252,195,254,
+74,1,182,8,84,1,182,254,74,60,95,121,135,0,1,0,186,252,70,13,217,8,6,0,24,
+0,0,1,34,6,21,17,20,22,51,33,50,54,53,17,51,17,16,33,33,32,17,17,16,33,33,
+21,2,86,119,108,108,119,9,233,117,110,183,254,92,246,41,254,92,1,164,6,217,
+7,115,135,121,247,104,123,135,135,123,3,94,252,195,254,74,1,182,8,84,1,182,
+147,0,0,1,0,186,252,68,13,217,8,6,0,24,0,0,1,34,6,21,17,20,22,51,33,21,33,
+32,17,17,16,33,33,32,17,21,35,53,52,38,35,2,86,119,108,108,119,7,196,248,
+68,254,92,1,164,9,213,1,166,183,112,117,7,115,135,121,247,102,123,135,147,
+1,182,8,86,1,182,254,74,60,95,121,135,0,0,1,0,186,252,68,10,26,8,6,0,17,0,
+0,1,34,6,21,17,20,22,51,33,21,33,32,17,17,16,33,33,21,2,86,119,108,108,119,
+7,196,248,68,254,92,1,164,7,145,7,115,135,121,247,102,123,135,147,1,182,8,
+86,1,182,147,0,1,0,186,252,70,8,60,8,6,0,31,0,0,1,34,6,21,17,20,22,51,33,
+50,54,53,17,51,17,16,33,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,2,86,
+119,108,108,119,4,74,117,112,183,254,90,251,200,254,92,1,164,4,56,1,166,183,
+112,117,7,115,135,121,247,104,123,135,135,123,3,94,252,195,254,74,1,182,8,
+84,1,182,254,74,60,95,121,135,0,1,0,186,252,70,8,60,8,6,0,24,0,0,1,34,6,21,
+17,20,22,51,33,50,54,53,17,51,17,16,33,33,32,17,17,16,33,33,21,2,86,119,108,
+108,119,4,76,117,110,183,254,92,251,198,254,92,1,164,1,52,7,115,135,121,247,
+104,123,135,135,123,3,94,252,195,254,74,1,182,8,84,1,182,147,0,0,1,0,186,
+252,68,8,60,8,6,0,24,0,0,1,34,6,21,17,20,22,51,33,21,33,32,17,17,16,33,33,
+32,17,21,35,53,52,38,35,2,86,119,108,108,119,2,56,253,208,254,92,1,164,4,
+56,1,166,183,112,117,7,115,135,121,247,102,123,135,147,1,182,8,86,1,182,254,
+74,60,95,121,135,0,0,1,0,186,252,68,4,142,8,6,0,17,0,0,1,34,6,21,17,20,22,
+51,33,21,33,32,17,17,16,33,33,21,2,86,119,108,108,119,2,56,253,208,254,92,
+1,164,1,52,7,115,135,121,247,102,123,135,147,1,182,8,86,1,182,147,0,1,0,186,
+252,82,6,152,8,6,0,22,0,0,1,36,17,17,16,33,33,32,17,21,35,53,52,38,35,33,
+34,6,21,17,20,22,23,1,213,254,229,1,164,2,148,1,166,183,112,117,253,90,119,
+108,57,41,252,82,65,1,103,8,86,1,182,254,74,60,95,121,135,135,121,247,102,
+98,106,24,255,255,0,186,252,68,8,56,8,6,2,38,1,234,0,0,0,7,1,171,6,233,0,
+49,255,255,0,186,252,68,11,68,8,6,2,38,1,226,0,0,0,7,1,171,9,241,0,49,0,2,
+0,186,252,68,13,217,8,6,0,35,0,47,0,0,1,32,17,17,16,33,33,32,17,21,35,53,
+52,38,35,33,34,6,21,17,20,22,51,33,38,38,53,52,54,51,50,22,21,20,6,35,18,
+38,35,34,6,21,20,22,51,50,54,53,2,94,254,92,1,164,9,215,1,164,182,111,116,
+246,22,119,108,108,119,8,215,37,34,203,171,178,199,205,176,217,112,99,100,
+113,115,98,93,118,252,68,1,182,8,86,1,182,254,74,60,95,121,135,135,121,247,
+102,123,135,49,123,66,164,221,233,161,157,219,1,227,149,143,108,105,139,133,
+102,255,255,0,186,252,68,13,217,8,6,2,38,1,249,0,0,0,7,1,171,12,127,0,49,
+0,1,0,186,252,68,8,60,8,6,0,24,0,0,1,34,6,21,17,20,22,51,51,21,35,32,17,17,
+16,33,33,32,17,21,35,53,52,38,35,2,86,119,108,108,119,38,30,254,92,1,164,
+4,56,1,166,183,112,117,7,115,135,121,247,102,123,135,147,1,182,8,86,1,182,
+254,74,60,95,121,135,0,0,2,254,119,250,123,1,104,4,217,0,5,0,6,0,0,1,17,1,
+55,5,17,55,1,104,253,15,47,2,20,103,4,74,246,49,1,11,136,195,8,255,143,0,
+1,0,186,252,70,11,68,8,6,0,24,0,0,1,33,32,17,19,16,33,33,32,17,21,35,53,52,
+38,35,33,34,6,21,3,20,22,51,33,3,219,254,132,254,91,1,1,164,7,65,1,164,182,
+111,116,248,172,119,108,1,108,120,1,132,252,70,1,182,8,84,1,182,254,74,60,
+95,121,135,135,121,247,104,123,135,0,1,0,186,252,70,6,147,8,6,0,17,0,0,1,
+33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,3,219,254,131,254,92,1,
+164,4,53,251,195,119,108,108,119,1,133,252,70,1,182,8,84,1,182,147,135,121,
+247,104,123,135,0,0,1,0,186,252,68,13,217,8,6,0,24,0,0,1,34,6,21,17,20,22,
+51,33,21,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,2,86,119,108,108,119,
+2,176,253,88,254,92,1,164,9,213,1,166,183,112,117,7,115,135,121,247,102,123,
+135,147,1,182,8,86,1,182,254,74,60,95,121,135,0,0,1,0,186,252,68,9,239,8,
+6,0,17,0,0,1,34,6,21,17,20,22,51,33,21,33,32,17,17,16,33,33,21,2,86,119,108,
+108,119,2,176,253,88,254,92,1,164,7,145,7,115,135,121,247,102,123,135,147,
+1,182,8,86,1,182,147,0,1,0,186,252,68,3,146,8,6,0,17,0,0,1,34,6,21,17,20,
+22,51,51,21,35,32,17,17,16,33,33,21,2,86,119,108,108,119,68,60,254,92,1,164,
+1,52,7,115,135,121,247,102,123,135,147,1,182,8,86,1,182,147,0,2,0,186,252,
+68,8,60,8,6,0,35,0,47,0,0,1,32,17,17,16,33,33,32,17,21,35,53,52,38,35,33,
+34,6,21,17,20,22,51,33,38,38,53,52,54,51,50,22,21,20,6,35,18,38,35,34,6,21,
+20,22,51,50,54,53,2,94,254,92,1,164,4,58,1,164,182,111,116,251,179,119,108,
+108,119,3,58,37,33,202,171,178,199,205,176,217,112,99,100,113,115,98,93,118,
+252,68,1,182,8,86,1,182,254,74,60,95,121,135,135,121,247,102,123,135,49,123,
+66,164,221,233,161,157,219,1,227,149,143,108,105,139,133,102,255,255,0,186,
+252,68,8,60,8,6,2,38,2,2,0,0,0,7,1,171,6,233,0,49,0,2,0,186,252,68,8,60,8,
+6,0,37,0,51,0,0,5,23,22,22,21,20,6,35,33,32,17,17,16,33,33,32,17,21,35,53,
+52,38,35,33,34,6,21,17,20,22,51,33,38,38,53,52,54,55,55,7,6,6,21,20,22,51,
+50,54,53,52,38,39,6,189,232,78,69,203,180,251,165,254,92,1,164,4,58,1,164,
+182,111,116,251,179,119,108,108,119,3,38,27,28,71,78,227,120,31,62,112,103,
+103,110,57,35,82,234,77,154,83,132,194,1,182,8,86,1,182,254,74,60,95,121,
+135,135,121,247,102,123,135,38,99,42,83,154,79,52,143,37,117,69,74,116,114,
+76,71,110,42,0,0,2,0,186,252,68,8,60,8,6,0,41,0,55,0,0,5,23,22,22,21,20,6,
+7,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,20,22,51,33,
+38,38,53,52,55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,6,189,
+232,78,69,201,180,251,163,254,92,1,164,4,58,1,164,182,111,116,251,179,119,
+108,108,119,3,38,27,28,11,237,180,121,115,1,63,227,120,31,62,112,103,103,
+110,57,35,82,234,77,154,83,132,192,2,1,182,8,86,1,182,254,74,60,95,121,135,
+135,121,247,102,123,135,38,99,42,48,46,128,1,82,68,222,167,51,143,37,117,
+69,74,116,114,76,71,110,42,0,2,0,186,252,68,8,56,8,6,0,34,0,48,0,0,5,23,22,
+22,21,20,6,7,33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,38,38,53,52,
+55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,6,189,232,78,69,201,
+180,251,163,254,92,1,164,1,52,254,196,119,108,108,119,3,38,27,28,11,237,180,
+121,115,1,63,227,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,192,
+2,1,182,8,86,1,182,147,135,121,247,102,123,135,38,99,42,48,46,128,1,82,68,
+222,167,51,143,37,117,69,74,116,114,76,71,110,42,0,0,2,0,186,252,68,13,213,
+8,6,0,28,0,40,0,0,1,32,17,17,16,33,33,21,33,34,6,21,17,20,22,51,33,38,38,
+53,52,54,51,50,22,21,20,6,35,18,38,35,34,6,21,20,22,51,50,54,53,2,94,254,
+92,1,164,6,217,249,31,119,108,108,119,8,215,37,35,203,172,177,200,205,176,
+217,113,98,101,112,114,99,93,118,252,68,1,182,8,86,1,182,147,135,121,247,
+102,123,135,49,123,66,164,221,235,159,155,221,1,227,149,143,108,105,139,135,
+100,0,255,255,0,186,252,68,13,213,8,6,2,38,2,7,0,0,0,7,1,171,12,127,0,49,
+0,2,0,186,252,68,13,217,8,6,0,37,0,51,0,0,5,23,22,22,21,20,6,35,33,32,17,
+17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,20,22,51,33,38,38,53,52,
+54,55,55,7,6,6,21,20,22,51,50,54,53,52,38,39,12,90,232,78,69,203,180,246,
+8,254,92,1,164,9,215,1,164,182,111,116,246,22,119,108,108,119,8,195,27,28,
+71,78,227,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,194,1,182,
+8,86,1,182,254,74,60,95,121,135,135,121,247,102,123,135,38,99,42,83,154,79,
+52,143,37,117,69,74,116,114,76,71,110,42,0,0,2,0,186,252,68,13,213,8,6,0,
+30,0,44,0,0,5,23,22,22,21,20,6,7,33,32,17,17,16,33,33,21,33,34,6,21,17,20,
+22,51,33,38,38,53,52,54,55,55,7,6,6,21,20,22,51,50,54,53,52,38,39,12,90,232,
+78,69,201,180,246,6,254,92,1,164,6,217,249,31,119,108,108,119,8,195,27,28,
+71,78,227,120,31,62,112,103,103,110,57,35,82,234,77,154,83,132,192,2,1,182,
+8,86,1,182,147,135,121,247,102,123,135,38,99,42,83,154,79,52,143,37,117,69,
+74,116,114,76,71,110,42,0,0,2,0,186,252,68,13,217,8,6,0,41,0,55,0,0,5,23,
+22,22,21,20,6,7,33,32,17,17,16,33,33,32,17,21,35,53,52,38,35,33,34,6,21,17,
+20,22,51,33,38,38,53,52,55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,
+38,39,12,90,232,78,69,201,180,246,6,254,92,1,164,9,215,1,164,182,111,116,
+246,22,119,108,108,119,8,195,27,28,11,237,180,121,115,1,63,227,120,31,62,
+112,103,103,110,57,35,82,234,77,154,83,132,192,2,1,182,8,86,1,182,254,74,
+60,95,121,135,135,121,247,102,123,135,38,99,42,48,46,128,1,82,68,222,167,
+51,143,37,117,69,74,116,114,76,71,110,42,0,2,0,186,252,68,13,213,8,6,0,34,
+0,48,0,0,5,23,22,22,21,20,6,7,33,32,17,17,16,33,33,21,33,34,6,21,17,20,22,
+51,33,38,38,53,52,55,7,3,55,23,37,55,7,6,6,21,20,22,51,50,54,53,52,38,39,
+12,90,232,78,69,201,180,246,6,254,92,1,164,6,217,249,31,119,108,108,119,8,
+195,27,28,11,237,180,121,115,1,63,227,120,31,62,112,103,103,110,57,35,82,
+234,77,154,83,132,192,2,1,182,8,86,1,182,147,135,121,247,102,123,135,38,99,
+42,48,46,128,1,82,68,222,167,51,143,37,117,69,74,116,114,76,71,110,42,0,0,
+2,0,186,252,68,8,56,8,6,0,30,0,44,0,0,5,23,22,22,21,20,6,35,33,32,17,17,16,
+33,33,21,33,34,6,21,17,20,22,51,33,38,38,53,52,54,55,55,7,6,6,21,20,22,51,
+50,54,53,52,38,39,6,189,232,78,69,203,180,251,165,254,92,1,164,1,52,254,196,
+119,108,108,119,3,38,27,28,71,78,227,120,31,62,112,103,103,110,57,35,82,234,
+77,154,83,132,194,1,182,8,86,1,182,147,135,121,247,102,123,135,38,99,42,83,
+154,79,52,143,37,117,69,74,116,114,76,71,110,42,0,6,0,113,252,68,5,199,4,
+217,0,27,0,36,0,37,0,38,0,39,0,40,0,0,1,52,38,35,34,6,7,4,0,17,6,6,35,34,
+0,53,52,18,54,51,50,22,18,21,17,33,21,33,1,38,38,39,20,22,51,50,54,5,5,1,
+3,4,18,201,171,142,180,33,1,10,1,48,47,115,61,250,254,213,143,247,165,164,
+248,143,1,0,254,75,254,185,8,233,175,203,166,12,22,2,13,252,167,1,33,79,2,
+33,186,236,154,125,24,254,166,254,212,16,22,1,67,246,163,1,10,140,141,254,
+245,161,250,170,139,4,65,179,215,16,190,222,2,133,50,5,11,250,245,0,0,5,0,
+113,253,62,4,201,4,217,0,25,0,34,0,35,0,36,0,37,0,0,1,52,38,35,34,6,7,4,0,
+17,6,6,35,34,0,53,52,18,54,51,50,22,18,21,17,35,1,38,38,39,20,22,51,50,54,
+3,1,51,4,18,204,166,146,178,33,1,15,1,45,47,117,61,251,254,214,143,249,165,
+163,249,143,183,254,187,8,231,179,199,172,10,22,32,254,212,170,2,33,187,237,
+156,125,24,254,160,254,218,16,22,1,68,247,162,1,9,140,141,254,246,160,251,
+23,3,71,179,214,17,189,223,2,4,84,250,245,0,0,1,0,166,252,68,2,92,4,74,0,
+5,0,0,1,33,17,51,17,33,2,92,254,74,180,1,2,252,68,8,6,248,133,0,0,2,0,166,
+252,68,3,246,4,76,0,5,0,9,0,0,1,33,17,51,17,33,1,51,17,35,3,246,254,73,181,
+1,2,252,176,180,180,252,68,8,8,248,131,7,125,247,248,0,255,255,0,166,252,
+68,3,143,4,74,0,38,0,210,0,0,0,7,1,160,5,67,0,0,255,255,0,166,252,68,5,41,
+4,76,0,38,1,143,0,0,0,7,1,160,6,221,0,0,255,255,254,107,252,68,2,92,4,74,
+0,38,0,210,0,0,0,7,1,160,1,226,0,0,255,255,254,107,252,68,3,246,4,76,0,38,
+1,143,0,0,0,7,1,160,1,226,0,0,255,255,255,169,253,109,1,108,255,206,0,7,1,
+160,3,32,0,0,0,1,0,78,1,217,5,223,3,39,0,21,0,0,19,62,3,51,50,30,2,23,7,46,
+3,35,34,14,2,7,78,22,123,185,237,139,140,241,189,127,22,43,30,111,164,223,
+144,143,221,164,108,31,1,238,61,113,86,53,51,88,113,61,21,35,65,50,30,30,
+50,65,35,0,0,1,0,186,252,82,5,119,8,6,0,15,0,0,1,36,17,17,16,33,33,21,33,
+34,6,21,17,20,22,23,1,213,254,229,1,164,3,25,252,223,119,108,57,41,252,82,
+65,1,103,8,86,1,182,147,135,121,247,102,98,106,24,0,0,5,0,113,254,88,4,201,
+4,217,0,25,0,34,0,35,0,36,0,37,0,0,1,52,38,35,34,6,7,4,0,17,6,6,35,34,0,53,
+52,18,54,51,50,22,18,21,17,35,1,38,38,39,20,22,51,50,54,3,1,51,4,18,204,166,
+146,178,33,1,15,1,45,47,117,61,251,254,214,143,249,165,163,249,143,183,254,
+187,8,231,179,199,172,10,22,32,254,212,170,2,33,187,237,156,125,24,254,160,
+254,218,16,22,1,68,247,162,1,9,140,141,254,246,160,252,49,2,45,179,214,17,
+189,223,2,4,84,250,245,0,255,255,0,113,252,68,4,201,4,217,0,6,1,21,0,0,0,
+2,251,209,251,182,1,104,4,217,0,12,0,13,0,0,1,51,17,5,17,51,17,1,53,1,37,
+55,5,1,254,154,174,1,114,174,253,50,254,200,254,111,70,1,14,3,223,254,38,
+254,232,136,7,196,247,108,1,0,133,254,241,240,121,160,7,228,0,0,0,15,0,186,
+0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,
+128,0,3,0,1,4,9,0,3,0,72,0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,
+0,30,0,214,0,3,0,1,4,9,0,6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,
+9,0,8,0,42,1,86,0,3,0,1,4,9,0,9,0,40,1,128,0,3,0,1,4,9,0,10,0,96,1,168,0,
+3,0,1,4,9,0,11,0,62,2,8,0,3,0,1,4,9,0,12,0,60,2,70,0,3,0,1,4,9,0,13,2,150,
+2,130,0,3,0,1,4,9,0,14,0,52,5,24,0,67,0,111,0,112,0,121,0,114,0,105,0,103,
+0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,
+101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,
+0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,
+0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,77,0,121,0,97,0,
+110,0,109,0,97,0,114,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,
+32,0,77,0,121,0,97,0,110,0,109,0,97,0,114,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,49,0,48,0,32,0,117,0,104,0,78,0,111,0,116,0,111,
+0,83,0,97,0,110,0,115,0,77,0,121,0,97,0,110,0,109,0,97,0,114,0,78,0,111,0,
+116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,
+109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,
+101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,
+101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,
+0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,
+110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,
+0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,
+0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,
+0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,
+0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,
+0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,28,1,2,1,3,0,2,0,3,1,
+4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,
+20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,
+1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,
+1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,
+1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,
+1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,
+1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,
+120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,
+1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,
+145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,
+1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,
+170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,
+1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,
+195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,
+1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,
+220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,
+1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,
+245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,
+2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,
+2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,
+2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,
+2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,
+2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,
+2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,
+2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,
+107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,
+2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,
+132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,
+2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,
+157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,
+2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,
+182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,
+2,195,2,196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,
+207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,
+2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,
+232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,
+2,245,2,246,2,247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,
+3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,
+18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,7,46,110,111,116,100,101,
+102,4,110,117,108,108,2,107,97,3,107,104,97,2,103,97,3,103,104,97,3,110,103,
+97,2,99,97,3,99,104,97,2,106,97,3,106,104,97,3,110,121,97,4,110,110,121,97,
+3,116,116,97,4,116,116,104,97,3,100,100,97,4,100,100,104,97,3,110,110,97,
+2,116,97,3,116,104,97,2,100,97,3,100,104,97,2,110,97,2,112,97,3,112,104,97,
+2,98,97,3,98,104,97,2,109,97,2,121,97,2,114,97,2,108,97,2,119,97,2,115,97,
+2,104,97,3,108,108,97,3,97,95,109,5,97,95,115,104,110,3,105,95,109,2,105,
+105,3,117,95,109,2,117,117,3,101,95,109,5,101,95,109,111,110,3,111,95,109,
+2,97,117,9,109,101,100,105,97,108,95,114,97,9,109,101,100,105,97,108,95,119,
+97,8,103,114,101,97,116,95,115,97,6,122,101,114,111,95,109,5,111,110,101,
+95,109,5,116,119,111,95,109,7,116,104,114,101,101,95,109,6,102,111,117,114,
+95,109,6,102,105,118,101,95,109,5,115,105,120,95,109,7,115,101,118,101,110,
+95,109,7,101,105,103,104,116,95,109,6,110,105,110,101,95,109,14,108,105,116,
+116,108,101,95,115,101,99,116,105,111,110,11,98,105,103,95,115,101,99,116,
+105,111,110,8,108,111,99,97,116,105,118,101,9,99,111,109,112,108,101,116,
+101,100,14,97,102,111,114,101,109,101,110,116,105,111,110,101,100,8,103,101,
+110,105,116,105,118,101,7,115,104,97,95,115,107,116,7,115,115,97,95,115,107,
+116,8,118,111,99,82,95,115,107,116,9,118,111,99,82,82,95,115,107,116,8,118,
+111,99,76,95,115,107,116,9,118,111,99,76,76,95,115,107,116,9,95,118,111,99,
+82,95,115,107,116,10,95,118,111,99,82,82,95,115,107,116,9,95,118,111,99,76,
+95,115,107,116,10,95,118,111,99,76,76,95,115,107,116,7,110,103,97,95,109,
+111,110,7,106,104,97,95,109,111,110,7,98,98,97,95,109,111,110,7,98,98,101,
+95,109,111,110,13,95,109,101,100,105,97,108,78,97,95,109,111,110,13,95,109,
+101,100,105,97,108,77,97,95,109,111,110,13,95,109,101,100,105,97,108,76,97,
+95,109,111,110,7,115,104,97,95,115,107,110,6,101,117,95,115,107,110,9,104,
+97,116,104,105,95,115,107,110,9,107,101,112,104,111,95,115,107,110,7,116,
+104,97,95,119,112,107,7,112,119,97,95,119,112,107,6,101,117,95,119,112,107,
+6,117,101,95,119,112,107,9,116,111,110,101,49,95,119,112,107,9,116,111,110,
+101,50,95,119,112,107,9,116,111,110,101,51,95,119,112,107,9,116,111,110,101,
+52,95,119,112,107,9,116,111,110,101,53,95,119,112,107,7,110,110,97,95,101,
+112,107,7,121,119,97,95,101,112,107,8,103,104,119,97,95,101,112,107,5,105,
+95,103,107,110,6,111,101,95,107,121,104,5,117,95,107,121,104,6,101,101,95,
+107,121,104,6,107,97,95,115,104,110,7,107,104,97,95,115,104,110,6,103,97,
+95,115,104,110,6,99,97,95,115,104,110,6,122,97,95,115,104,110,7,110,121,97,
+95,115,104,110,6,100,97,95,115,104,110,6,110,97,95,115,104,110,7,112,104,
+97,95,115,104,110,6,102,97,95,115,104,110,6,98,97,95,115,104,110,7,116,104,
+97,95,115,104,110,6,104,97,95,115,104,110,13,109,101,100,105,97,108,95,119,
+97,95,115,104,110,6,97,97,95,115,104,110,5,101,95,115,104,110,12,95,101,95,
+97,98,111,118,101,95,115,104,110,12,95,102,95,97,98,111,118,101,95,115,104,
+110,9,116,111,110,101,50,95,115,104,110,9,116,111,110,101,51,95,115,104,110,
+9,116,111,110,101,53,95,115,104,110,9,116,111,110,101,54,95,115,104,110,10,
+99,116,111,110,101,50,95,115,104,110,10,99,116,111,110,101,51,95,115,104,
+110,9,101,116,111,110,101,95,115,104,110,6,102,97,95,114,112,103,9,116,111,
+110,101,53,95,114,112,103,8,122,101,114,111,95,115,104,110,7,111,110,101,
+95,115,104,110,7,116,119,111,95,115,104,110,9,116,104,114,101,101,95,115,
+104,110,8,102,111,117,114,95,115,104,110,8,102,105,118,101,95,115,104,110,
+7,115,105,120,95,115,104,110,9,115,101,118,101,110,95,115,104,110,9,101,105,
+103,104,116,95,115,104,110,8,110,105,110,101,95,115,104,110,9,116,111,110,
+101,49,95,107,104,109,9,116,111,110,101,51,95,107,104,109,6,95,97,95,97,116,
+110,7,95,97,105,95,97,116,110,8,115,111,110,101,95,115,104,110,10,101,120,
+99,108,97,109,95,115,104,110,6,103,97,95,107,104,109,6,99,97,95,107,104,109,
+7,99,104,97,95,107,104,109,6,106,97,95,107,104,109,7,106,104,97,95,107,104,
+109,8,110,121,97,95,107,104,109,110,7,116,116,97,95,107,104,109,8,116,116,
+104,97,95,107,104,109,7,100,100,97,95,107,104,109,8,100,100,104,97,95,107,
+104,109,7,100,104,97,95,107,104,109,6,110,97,95,107,104,109,6,115,97,95,107,
+104,109,6,104,97,95,107,104,109,7,104,104,97,95,107,104,109,6,102,97,95,107,
+104,109,9,114,101,100,117,112,95,107,104,109,6,120,97,95,107,104,109,6,122,
+97,95,107,104,109,6,114,97,95,107,104,109,7,113,97,121,95,107,104,109,6,113,
+110,95,107,104,109,6,104,109,95,107,104,109,10,101,120,99,108,97,109,95,97,
+116,110,7,111,110,101,95,97,116,110,7,116,119,111,95,97,116,110,6,114,97,
+95,97,116,110,8,116,111,110,101,95,112,97,107,13,95,116,97,108,108,95,97,
+97,95,97,115,97,116,13,97,115,97,116,95,97,110,117,115,118,97,114,97,6,97,
+105,95,100,117,112,8,97,115,97,116,95,100,117,112,11,109,101,100,105,97,108,
+95,104,97,95,117,12,109,101,100,105,97,108,95,104,97,95,117,117,5,95,105,
+95,97,105,11,95,105,95,97,110,117,115,118,97,114,97,8,107,105,110,122,105,
+95,97,105,14,107,105,110,122,105,95,97,110,117,115,118,97,114,97,10,107,105,
+110,122,105,95,97,115,97,116,16,107,105,110,122,105,95,105,95,97,110,117,
+115,118,97,114,97,7,107,105,110,122,105,95,105,8,107,105,110,122,105,95,105,
+105,12,107,105,110,122,105,95,105,105,95,109,111,110,5,107,105,110,122,105,
+7,114,97,95,97,115,97,116,4,114,97,95,105,5,114,97,95,105,105,7,114,97,95,
+109,97,114,107,12,109,101,100,105,97,108,95,114,97,95,119,97,15,109,101,100,
+105,97,108,95,114,97,95,119,97,46,119,50,15,109,101,100,105,97,108,95,114,
+97,95,119,97,95,116,116,18,109,101,100,105,97,108,95,114,97,95,119,97,95,
+116,116,46,119,50,12,109,101,100,105,97,108,95,114,97,46,119,50,12,109,101,
+100,105,97,108,95,114,97,95,116,116,15,109,101,100,105,97,108,95,114,97,95,
+116,116,46,119,50,12,109,101,100,105,97,108,95,114,97,95,98,116,15,109,101,
+100,105,97,108,95,114,97,95,98,116,46,119,50,16,109,101,100,105,97,108,95,
+114,97,95,98,116,51,46,119,50,16,109,101,100,105,97,108,95,114,97,95,98,116,
+50,46,119,50,15,109,101,100,105,97,108,95,114,97,95,116,116,95,98,116,18,
+109,101,100,105,97,108,95,114,97,95,116,116,95,98,116,46,119,50,16,109,101,
+100,105,97,108,95,114,97,95,116,116,95,98,116,51,19,109,101,100,105,97,108,
+95,114,97,95,116,116,95,98,116,50,46,119,50,2,95,117,10,95,117,95,115,112,
+97,99,105,110,103,6,107,97,46,115,117,98,7,107,97,46,115,117,98,50,7,107,
+104,97,46,115,117,98,8,107,104,97,46,115,117,98,50,6,103,97,46,115,117,98,
+7,103,97,46,115,117,98,50,7,103,104,97,46,115,117,98,8,103,104,97,46,115,
+117,98,50,7,110,103,97,46,115,117,98,8,110,103,97,46,115,117,98,50,6,99,97,
+46,115,117,98,7,99,97,46,115,117,98,50,7,99,104,97,46,115,117,98,8,99,104,
+97,46,115,117,98,50,6,106,97,46,115,117,98,7,106,97,46,115,117,98,50,7,106,
+104,97,46,115,117,98,10,110,121,97,46,110,97,114,114,111,119,7,110,121,97,
+46,115,117,98,8,110,121,97,46,115,117,98,50,10,110,121,97,46,110,111,116,
+97,105,108,11,110,110,121,97,46,110,111,116,97,105,108,10,108,108,97,46,110,
+111,116,97,105,108,8,110,110,121,97,46,115,117,98,9,110,110,121,97,46,115,
+117,98,50,7,116,116,97,95,116,116,97,8,116,116,97,95,116,116,104,97,7,116,
+116,97,46,97,108,116,7,116,116,97,46,115,117,98,8,116,116,97,46,115,117,98,
+50,8,116,116,104,97,46,115,117,98,9,116,116,104,97,46,115,117,98,50,7,100,
+100,97,95,100,100,97,8,100,100,97,95,100,100,104,97,7,100,100,97,46,115,117,
+98,8,100,100,97,46,115,117,98,50,8,100,100,104,97,46,115,117,98,9,100,100,
+104,97,46,115,117,98,50,7,110,110,97,95,116,116,97,8,110,110,97,95,116,116,
+104,97,7,110,110,97,95,100,100,97,7,110,110,97,46,115,117,98,8,110,110,97,
+46,115,117,98,50,6,116,97,46,115,117,98,7,116,97,46,115,117,98,50,7,116,104,
+97,46,115,117,98,8,116,104,97,46,115,117,98,50,6,100,97,46,115,117,98,7,100,
+97,46,115,117,98,50,7,100,104,97,46,115,117,98,8,100,104,97,46,115,117,98,
+50,6,110,97,46,97,108,116,6,110,97,46,115,117,98,7,110,97,46,115,117,98,50,
+6,112,97,46,115,117,98,7,112,97,46,115,117,98,50,7,112,104,97,46,115,117,
+98,8,112,104,97,46,115,117,98,50,6,98,97,46,115,117,98,7,98,97,46,115,117,
+98,50,7,98,104,97,46,115,117,98,8,98,104,97,46,115,117,98,50,6,109,97,46,
+115,117,98,7,109,97,46,115,117,98,50,6,121,97,46,115,117,98,7,121,97,46,115,
+117,98,50,6,114,97,46,97,108,116,6,114,97,46,115,117,98,7,114,97,46,115,117,
+98,50,6,108,97,46,115,117,98,7,108,97,46,115,117,98,50,6,115,97,46,115,117,
+98,7,115,97,46,115,117,98,50,6,104,97,46,115,117,98,7,104,97,46,115,117,98,
+50,7,108,108,97,95,108,108,97,7,108,108,97,46,115,117,98,8,108,108,97,46,
+115,117,98,50,7,97,95,109,46,115,117,98,8,97,95,109,46,115,117,98,50,9,97,
+95,115,104,110,46,115,117,98,10,97,95,115,104,110,46,115,117,98,50,7,101,
+95,109,46,115,117,98,8,101,95,109,46,115,117,98,50,12,103,114,101,97,116,
+95,115,97,46,115,117,98,13,103,114,101,97,116,95,115,97,46,115,117,98,50,
+11,115,104,97,95,115,107,116,46,115,117,98,12,115,104,97,95,115,107,116,46,
+115,117,98,50,8,115,115,97,95,116,116,104,97,7,115,115,97,95,100,100,97,11,
+115,115,97,95,115,107,116,46,115,117,98,12,115,115,97,95,115,107,116,46,115,
+117,98,50,12,118,111,99,82,95,115,107,116,46,115,117,98,13,118,111,99,82,
+95,115,107,116,46,115,117,98,50,13,118,111,99,82,82,95,115,107,116,46,115,
+117,98,14,118,111,99,82,82,95,115,107,116,46,115,117,98,50,11,110,103,97,
+95,109,111,110,46,115,117,98,12,110,103,97,95,109,111,110,46,115,117,98,50,
+11,106,104,97,95,109,111,110,46,115,117,98,12,106,104,97,95,109,111,110,46,
+115,117,98,50,11,98,98,97,95,109,111,110,46,115,117,98,12,98,98,97,95,109,
+111,110,46,115,117,98,50,11,98,98,101,95,109,111,110,46,115,117,98,12,98,
+98,101,95,109,111,110,46,115,117,98,50,18,95,109,101,100,105,97,108,78,97,
+95,109,111,110,46,115,117,98,50,18,95,109,101,100,105,97,108,77,97,95,109,
+111,110,46,115,117,98,50,18,95,109,101,100,105,97,108,76,97,95,109,111,110,
+46,115,117,98,50,11,115,104,97,95,115,107,110,46,115,117,98,12,115,104,97,
+95,115,107,110,46,115,117,98,50,11,116,104,97,95,119,112,107,46,115,117,98,
+12,116,104,97,95,119,112,107,46,115,117,98,50,11,112,119,97,95,119,112,107,
+46,115,117,98,12,112,119,97,95,119,112,107,46,115,117,98,50,11,110,110,97,
+95,101,112,107,46,115,117,98,12,110,110,97,95,101,112,107,46,115,117,98,50,
+11,121,119,97,95,101,112,107,46,115,117,98,12,121,119,97,95,101,112,107,46,
+115,117,98,50,12,103,104,119,97,95,101,112,107,46,115,117,98,13,103,104,119,
+97,95,101,112,107,46,115,117,98,50,10,107,97,95,115,104,110,46,115,117,98,
+11,107,97,95,115,104,110,46,115,117,98,50,11,107,104,97,95,115,104,110,46,
+115,117,98,12,107,104,97,95,115,104,110,46,115,117,98,50,10,103,97,95,115,
+104,110,46,115,117,98,11,103,97,95,115,104,110,46,115,117,98,50,10,99,97,
+95,115,104,110,46,115,117,98,11,99,97,95,115,104,110,46,115,117,98,50,10,
+122,97,95,115,104,110,46,115,117,98,11,122,97,95,115,104,110,46,115,117,98,
+50,11,110,121,97,95,115,104,110,46,115,117,98,12,110,121,97,95,115,104,110,
+46,115,117,98,50,10,100,97,95,115,104,110,46,115,117,98,11,100,97,95,115,
+104,110,46,115,117,98,50,10,110,97,95,115,104,110,46,115,117,98,11,110,97,
+95,115,104,110,46,115,117,98,50,11,112,104,97,95,115,104,110,46,115,117,98,
+12,112,104,97,95,115,104,110,46,115,117,98,50,10,102,97,95,115,104,110,46,
+115,117,98,11,102,97,95,115,104,110,46,115,117,98,50,10,98,97,95,115,104,
+110,46,115,117,98,11,98,97,95,115,104,110,46,115,117,98,50,11,116,104,97,
+95,115,104,110,46,115,117,98,12,116,104,97,95,115,104,110,46,115,117,98,50,
+10,104,97,95,115,104,110,46,115,117,98,11,104,97,95,115,104,110,46,115,117,
+98,50,10,102,97,95,114,112,103,46,115,117,98,11,102,97,95,114,112,103,46,
+115,117,98,50,10,103,97,95,107,104,109,46,115,117,98,11,103,97,95,107,104,
+109,46,115,117,98,50,10,99,97,95,107,104,109,46,115,117,98,11,99,97,95,107,
+104,109,46,115,117,98,50,11,99,104,97,95,107,104,109,46,115,117,98,12,99,
+104,97,95,107,104,109,46,115,117,98,50,10,106,97,95,107,104,109,46,115,117,
+98,11,106,97,95,107,104,109,46,115,117,98,50,11,106,104,97,95,107,104,109,
+46,115,117,98,12,106,104,97,95,107,104,109,46,115,117,98,50,12,110,121,97,
+95,107,104,109,110,46,115,117,98,13,110,121,97,95,107,104,109,110,46,115,
+117,98,50,11,116,116,97,95,107,104,109,46,115,117,98,12,116,116,97,95,107,
+104,109,46,115,117,98,50,12,116,116,104,97,95,107,104,109,46,115,117,98,13,
+116,116,104,97,95,107,104,109,46,115,117,98,50,11,100,100,97,95,107,104,109,
+46,115,117,98,12,100,100,97,95,107,104,109,46,115,117,98,50,12,100,100,104,
+97,95,107,104,109,46,115,117,98,13,100,100,104,97,95,107,104,109,46,115,117,
+98,50,11,100,104,97,95,107,104,109,46,115,117,98,12,100,104,97,95,107,104,
+109,46,115,117,98,50,10,110,97,95,107,104,109,46,115,117,98,11,110,97,95,
+107,104,109,46,115,117,98,50,10,115,97,95,107,104,109,46,115,117,98,11,115,
+97,95,107,104,109,46,115,117,98,50,10,104,97,95,107,104,109,46,115,117,98,
+11,104,97,95,107,104,109,46,115,117,98,50,11,104,104,97,95,107,104,109,46,
+115,117,98,12,104,104,97,95,107,104,109,46,115,117,98,50,10,102,97,95,107,
+104,109,46,115,117,98,11,102,97,95,107,104,109,46,115,117,98,50,10,120,97,
+95,107,104,109,46,115,117,98,11,120,97,95,107,104,109,46,115,117,98,50,10,
+122,97,95,107,104,109,46,115,117,98,11,122,97,95,107,104,109,46,115,117,98,
+50,10,114,97,95,107,104,109,46,115,117,98,11,114,97,95,107,104,109,46,115,
+117,98,50,10,114,97,95,97,116,110,46,115,117,98,11,114,97,95,97,116,110,46,
+115,117,98,50,3,95,117,117,11,95,117,117,95,115,112,97,99,105,110,103,12,
+109,101,100,105,97,108,95,119,97,95,104,97,12,109,101,100,105,97,108,95,121,
+97,95,104,97,14,109,101,100,105,97,108,95,121,97,46,97,108,116,49,15,109,
+101,100,105,97,108,95,121,97,95,119,97,95,104,97,12,109,101,100,105,97,108,
+95,121,97,95,119,97,8,95,116,97,108,108,95,97,97,3,95,97,97,2,95,105,3,95,
+105,105,14,109,101,100,105,97,108,95,104,97,46,115,117,98,50,2,95,101,3,95,
+97,105,7,95,105,105,95,109,111,110,6,95,111,95,109,111,110,8,95,101,95,97,
+98,111,118,101,8,97,110,117,115,118,97,114,97,9,100,111,116,95,98,101,108,
+111,119,7,118,105,115,97,114,103,97,6,118,105,114,97,109,97,4,97,115,97,116,
+9,109,101,100,105,97,108,95,121,97,13,109,101,100,105,97,108,95,119,97,95,
+111,118,108,9,109,101,100,105,97,108,95,104,97,18,109,101,100,105,97,108,
+95,104,97,95,111,98,108,46,115,117,98,50,6,95,105,46,97,108,116,7,95,97,105,
+46,97,108,116,7,117,110,105,50,53,67,67,11,104,97,95,116,97,105,108,46,97,
+108,116,12,95,105,105,95,97,110,117,115,118,97,114,97,17,107,105,110,122,
+105,95,105,105,95,97,110,117,115,118,97,114,97,16,109,101,100,105,97,108,
+95,119,97,95,104,97,95,100,111,116,13,109,101,100,105,97,108,95,119,97,95,
+100,111,116,15,109,101,100,105,97,108,95,104,97,95,117,95,100,111,116,16,
+109,101,100,105,97,108,95,104,97,95,117,117,95,100,111,116,13,109,101,100,
+105,97,108,95,104,97,95,100,111,116,7,95,117,117,95,100,111,116,6,95,117,
+95,100,111,116,14,95,117,95,100,111,116,95,115,112,97,99,105,110,103,15,95,
+117,117,95,100,111,116,95,115,112,97,99,105,110,103,17,100,111,116,95,98,
+101,108,111,119,95,115,112,97,99,105,110,103,10,116,97,95,119,97,46,115,117,
+98,50,9,116,97,95,119,97,46,115,117,98,12,100,111,116,95,98,101,108,111,119,
+95,112,114,15,109,101,100,105,97,108,95,114,97,95,119,97,95,104,97,18,109,
+101,100,105,97,108,95,114,97,95,119,97,95,104,97,46,119,50,18,109,101,100,
+105,97,108,95,114,97,95,119,97,95,104,97,95,116,116,21,109,101,100,105,97,
+108,95,114,97,95,119,97,95,104,97,95,116,116,46,119,50,7,117,110,105,50,48,
+48,66,9,97,102,105,105,54,49,54,54,52,7,97,102,105,105,51,48,49,17,109,101,
+100,105,97,108,95,119,97,95,100,111,116,95,111,118,108,17,109,101,100,105,
+97,108,95,104,97,95,100,111,116,95,111,98,108,11,95,117,117,95,100,111,116,
+46,97,108,116,10,95,117,95,100,111,116,46,97,108,116,18,95,117,95,100,111,
+116,95,115,112,97,99,105,110,103,46,97,108,116,19,95,117,117,95,100,111,116,
+95,115,112,97,99,105,110,103,46,97,108,116,13,109,101,100,105,97,108,95,104,
+97,95,111,98,108,15,109,101,100,105,97,108,95,104,97,95,111,98,108,95,117,
+16,109,101,100,105,97,108,95,104,97,95,111,98,108,95,117,117,16,116,97,108,
+108,95,97,97,95,97,110,117,115,118,97,114,97,10,116,97,108,108,95,97,97,95,
+97,105,12,95,97,97,95,97,110,117,115,118,97,114,97,6,95,97,97,95,97,105,7,
+114,97,46,97,108,116,50,7,95,105,105,46,97,108,116,14,109,101,100,105,97,
+108,95,121,97,46,97,108,116,50,19,109,101,100,105,97,108,95,104,97,95,111,
+98,108,95,117,95,100,111,116,20,109,101,100,105,97,108,95,104,97,95,111,98,
+108,95,117,117,95,100,111,116,13,116,97,95,119,97,95,111,118,108,46,115,117,
+98,14,116,97,95,119,97,95,111,118,108,46,115,117,98,50,14,109,101,100,105,
+97,108,95,114,97,46,119,50,95,53,17,109,101,100,105,97,108,95,114,97,95,116,
+116,46,119,50,95,53,16,109,101,100,105,97,108,95,114,97,95,119,97,95,111,
+118,108,19,109,101,100,105,97,108,95,114,97,95,119,97,95,111,118,108,46,119,
+50,19,109,101,100,105,97,108,95,114,97,95,119,97,95,111,118,108,95,116,116,
+22,109,101,100,105,97,108,95,114,97,95,119,97,95,111,118,108,95,116,116,46,
+119,50,16,109,101,100,105,97,108,95,119,97,95,104,97,95,111,118,108,20,109,
+101,100,105,97,108,95,119,97,95,104,97,95,100,111,116,95,111,118,108,19,109,
+101,100,105,97,108,95,114,97,95,119,97,95,104,97,95,111,118,108,22,109,101,
+100,105,97,108,95,114,97,95,119,97,95,104,97,95,111,118,108,46,119,50,22,
+109,101,100,105,97,108,95,114,97,95,119,97,95,104,97,95,111,118,108,95,116,
+116,25,109,101,100,105,97,108,95,114,97,95,119,97,95,104,97,95,111,118,108,
+95,116,116,46,119,50,17,109,101,100,105,97,108,95,114,97,95,119,97,46,119,
+50,95,53,21,109,101,100,105,97,108,95,114,97,95,119,97,95,111,118,108,46,
+119,50,95,53,24,109,101,100,105,97,108,95,114,97,95,119,97,95,111,118,108,
+95,116,116,46,119,50,95,53,19,109,101,100,105,97,108,95,121,97,95,119,97,
+95,104,97,95,111,118,108,16,109,101,100,105,97,108,95,121,97,95,119,97,95,
+111,118,108,24,109,101,100,105,97,108,95,114,97,95,119,97,95,104,97,95,111,
+118,108,46,119,50,95,53,27,109,101,100,105,97,108,95,114,97,95,119,97,95,
+104,97,95,111,118,108,95,116,116,46,119,50,95,53,20,109,101,100,105,97,108,
+95,114,97,95,119,97,95,116,116,46,119,50,95,53,20,109,101,100,105,97,108,
+95,114,97,95,119,97,95,116,116,46,119,49,95,53,23,109,101,100,105,97,108,
+95,114,97,95,119,97,95,104,97,95,116,116,46,119,50,95,53,17,109,101,100,105,
+97,108,95,114,97,95,98,116,46,119,50,95,53,20,109,101,100,105,97,108,95,114,
+97,95,116,116,95,98,116,46,119,50,95,53,12,109,101,100,105,97,108,95,114,
+97,46,119,51,15,109,101,100,105,97,108,95,114,97,95,116,116,46,119,51,15,
+109,101,100,105,97,108,95,114,97,95,98,116,46,119,51,18,109,101,100,105,97,
+108,95,114,97,95,116,116,95,98,116,46,119,51,14,109,101,100,105,97,108,95,
+114,97,46,119,49,95,53,17,109,101,100,105,97,108,95,114,97,95,116,116,46,
+119,49,95,53,17,109,101,100,105,97,108,95,114,97,95,98,116,46,119,49,95,53,
+20,109,101,100,105,97,108,95,114,97,95,116,116,95,98,116,46,119,49,95,53,
+13,109,101,100,105,97,108,95,114,97,95,98,116,51,23,109,101,100,105,97,108,
+95,114,97,95,119,97,95,104,97,95,116,116,46,119,49,95,53,20,109,101,100,105,
+97,108,95,114,97,95,119,97,95,104,97,46,119,50,95,53,15,109,101,100,105,97,
+108,95,114,97,95,119,97,46,119,51,18,109,101,100,105,97,108,95,114,97,95,
+119,97,95,104,97,46,119,51,18,109,101,100,105,97,108,95,114,97,95,98,116,
+50,46,119,49,95,53,14,109,101,100,105,97,108,95,121,97,46,97,108,116,51,18,
+109,101,100,105,97,108,95,114,97,95,98,116,50,46,119,50,95,53,21,109,101,
+100,105,97,108,95,114,97,95,116,116,95,98,116,50,46,119,50,95,53,16,109,101,
+100,105,97,108,95,114,97,95,98,116,50,46,119,51,19,109,101,100,105,97,108,
+95,114,97,95,116,116,95,98,116,50,46,119,51,21,109,101,100,105,97,108,95,
+114,97,95,116,116,95,98,116,50,46,119,49,95,53,17,109,101,100,105,97,108,
+95,114,97,95,119,97,46,119,49,95,53,20,109,101,100,105,97,108,95,114,97,95,
+119,97,95,104,97,46,119,49,95,53,21,109,101,100,105,97,108,95,114,97,95,119,
+97,95,111,118,108,46,119,49,95,53,24,109,101,100,105,97,108,95,114,97,95,
+119,97,95,104,97,95,111,118,108,46,119,49,95,53,27,109,101,100,105,97,108,
+95,114,97,95,119,97,95,104,97,95,111,118,108,95,116,116,46,119,49,95,53,18,
+109,101,100,105,97,108,95,114,97,95,119,97,95,116,116,46,119,51,21,109,101,
+100,105,97,108,95,114,97,95,119,97,95,104,97,95,116,116,46,119,51,19,109,
+101,100,105,97,108,95,114,97,95,119,97,95,111,118,108,46,119,51,22,109,101,
+100,105,97,108,95,114,97,95,119,97,95,111,118,108,95,116,116,46,119,51,22,
+109,101,100,105,97,108,95,114,97,95,119,97,95,104,97,95,111,118,108,46,119,
+51,25,109,101,100,105,97,108,95,114,97,95,119,97,95,104,97,95,111,118,108,
+95,116,116,46,119,51,24,109,101,100,105,97,108,95,114,97,95,119,97,95,111,
+118,108,95,116,116,46,119,49,95,53,13,114,97,95,114,115,98,119,105,100,101,
+50,50,48,18,114,97,95,114,115,98,119,105,100,101,49,53,48,46,97,108,116,50,
+18,95,117,95,115,112,97,99,105,110,103,95,114,115,98,119,105,100,101,19,95,
+117,117,95,115,112,97,99,105,110,103,95,114,115,98,119,105,100,101,22,95,
+117,95,100,111,116,95,115,112,97,99,105,110,103,95,114,115,98,119,105,100,
+101,23,95,117,117,95,100,111,116,95,115,112,97,99,105,110,103,95,114,115,
+98,119,105,100,101,26,95,117,95,100,111,116,95,115,112,97,99,105,110,103,
+95,114,115,98,119,105,100,101,46,97,108,116,27,95,117,117,95,100,111,116,
+95,115,112,97,99,105,110,103,95,114,115,98,119,105,100,101,46,97,108,116,
+28,100,111,116,95,98,101,108,111,119,95,115,112,97,99,105,110,103,95,114,
+115,98,119,105,100,101,49,48,48,5,117,65,57,50,69,19,109,101,100,105,97,108,
+95,114,97,95,116,116,95,98,116,51,46,119,50,7,114,97,46,97,108,116,49,17,
+114,97,95,114,115,98,119,105,100,101,49,53,48,46,97,108,116,16,109,101,100,
+105,97,108,95,121,97,95,104,97,46,97,108,116,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,1,192,0,0,9,116,0,2,0,72,0,4,0,45,0,1,0,47,0,47,0,4,0,48,
+0,48,0,3,0,49,0,49,0,1,0,64,0,64,0,1,0,66,0,71,0,1,0,74,0,75,0,3,0,76,0,79,
+0,1,0,80,0,82,0,3,0,83,0,98,0,1,0,99,0,102,0,3,0,103,0,115,0,1,0,116,0,116,
+0,3,0,117,0,117,0,1,0,119,0,120,0,3,0,121,0,126,0,1,0,127,0,127,0,3,0,128,
+0,129,0,1,0,140,0,142,0,1,0,143,0,143,0,3,0,146,0,161,0,1,0,163,0,165,0,1,
+0,172,0,174,0,1,0,175,0,193,0,3,0,194,0,208,0,4,0,209,0,209,0,3,0,211,0,226,
+0,3,0,227,0,228,0,1,0,229,0,230,0,3,0,231,0,233,0,1,0,234,0,235,0,3,0,236,
+0,238,0,1,0,239,0,242,0,3,0,243,0,244,0,1,0,245,0,248,0,3,0,249,0,251,0,1,
+0,252,1,5,0,3,1,6,1,6,0,1,1,7,1,20,0,3,1,21,1,21,0,1,1,22,1,29,0,3,1,30,1,
+30,0,1,1,31,1,42,0,3,1,43,1,44,0,1,1,45,1,142,0,3,1,144,1,144,0,3,1,145,1,
+150,0,1,1,151,1,153,0,3,1,155,1,160,0,3,1,162,1,163,0,3,1,164,1,164,0,1,1,
+165,1,169,0,3,1,170,1,170,0,1,1,172,1,180,0,3,1,184,1,186,0,3,1,187,1,190,
+0,4,1,194,1,197,0,3,1,200,1,202,0,3,1,207,1,207,0,1,1,208,1,208,0,3,1,209,
+1,209,0,1,1,210,1,213,0,3,1,214,1,219,0,4,1,220,1,221,0,3,1,222,1,228,0,4,
+1,229,1,230,0,1,1,231,1,251,0,4,1,252,1,252,0,1,1,253,2,13,0,4,2,14,2,15,
+0,1,2,24,2,24,0,4,2,25,2,27,0,1,3,0,1,126,5,10,5,34,4,32,5,108,7,36,3,196,
+3,204,4,210,3,212,4,178,4,226,4,218,4,242,3,220,4,178,3,228,5,96,4,64,3,236,
+4,178,6,118,7,36,4,56,3,244,4,64,4,116,5,10,7,160,4,40,3,252,4,64,5,10,4,
+140,4,4,4,12,4,20,4,28,6,38,4,250,6,114,7,92,5,26,7,116,4,32,7,36,4,40,4,
+48,4,56,4,64,7,52,5,230,4,218,4,72,4,80,5,108,4,88,4,112,7,156,4,116,7,156,
+6,32,4,92,4,96,6,6,6,22,5,72,7,44,7,100,7,100,7,100,7,44,4,104,5,170,4,104,
+7,48,4,112,7,156,7,156,4,116,5,10,4,250,4,124,4,132,4,140,4,210,5,26,4,148,
+4,156,7,160,4,234,4,164,4,172,7,148,7,112,7,72,4,178,7,100,4,186,4,194,5,
+116,5,26,4,202,4,210,4,218,5,88,4,226,4,234,4,242,4,250,5,2,5,18,5,10,5,34,
+5,18,5,26,5,34,5,42,6,230,7,24,5,48,7,144,7,96,7,100,7,56,5,52,6,48,5,188,
+6,48,5,56,5,104,6,236,5,60,5,188,5,64,5,68,5,72,7,156,5,230,6,158,7,52,6,
+108,6,22,6,26,6,184,5,76,6,22,6,26,7,52,6,102,6,184,5,76,6,38,6,86,5,82,5,
+184,5,82,6,52,5,88,5,96,5,104,6,124,5,108,6,0,5,116,5,124,6,118,6,194,6,80,
+5,128,5,136,5,184,5,202,7,20,6,102,5,142,5,148,5,154,5,160,5,164,6,150,6,
+198,6,76,6,198,7,48,5,202,7,148,6,108,5,170,6,60,6,64,6,22,6,26,7,124,6,108,
+5,188,5,178,6,154,6,80,5,184,5,246,6,76,6,158,7,168,5,188,5,192,5,198,5,202,
+6,154,6,80,6,154,6,80,5,208,6,38,5,214,5,220,6,144,6,184,5,224,5,230,6,70,
+7,140,5,234,6,150,5,246,5,240,6,178,6,150,5,246,7,148,5,246,6,194,6,224,7,
+152,7,0,6,140,6,204,5,252,6,108,6,246,6,0,6,6,6,14,7,64,7,20,6,230,6,22,6,
+26,7,24,6,32,7,108,7,10,6,38,6,118,7,108,6,42,6,48,6,52,6,60,6,64,6,154,6,
+70,6,76,6,198,6,164,6,86,6,154,6,80,6,164,6,86,7,136,6,204,6,92,6,204,6,236,
+6,96,7,44,6,102,6,184,6,214,7,144,7,0,7,148,6,108,6,114,6,118,6,124,6,128,
+7,20,6,134,6,140,6,144,6,150,6,198,6,154,6,158,6,164,6,214,6,168,6,172,7,
+104,6,178,6,184,7,10,6,194,6,188,6,194,6,198,7,6,6,204,6,210,6,214,6,220,
+6,224,7,152,6,230,6,236,6,240,6,246,6,250,7,88,7,0,7,6,7,10,7,16,7,88,7,176,
+7,156,7,20,7,24,7,28,7,36,7,92,7,44,7,156,7,72,7,48,7,72,7,52,7,56,7,92,7,
+96,7,60,7,112,7,156,7,64,7,92,7,72,7,76,7,124,7,84,7,88,7,92,7,96,7,100,7,
+156,7,152,7,116,7,104,7,108,7,112,7,156,7,152,7,116,7,120,7,128,7,132,7,168,
+7,124,7,128,7,132,7,136,7,140,7,144,7,144,7,148,7,152,7,156,7,160,7,168,7,
+168,7,168,7,176,0,2,0,32,0,4,0,41,0,0,0,43,0,44,0,38,0,48,0,49,0,40,0,64,
+0,64,0,42,0,66,0,71,0,43,0,74,0,116,0,49,0,119,0,120,0,92,0,127,0,128,0,94,
+0,143,0,143,0,96,0,146,0,161,0,97,0,163,0,165,0,113,0,172,0,172,0,116,0,174,
+0,189,0,117,0,191,0,193,0,133,0,209,0,209,0,136,0,211,0,226,0,137,0,228,1,
+142,0,153,1,144,1,153,1,68,1,155,1,160,1,78,1,162,1,163,1,84,1,165,1,170,
+1,86,1,172,1,180,1,92,1,184,1,185,1,101,1,194,1,197,1,103,1,200,1,202,1,107,
+1,207,1,208,1,110,1,210,1,213,1,112,1,220,1,221,1,116,1,229,1,230,1,118,1,
+252,1,252,1,120,2,14,2,15,1,121,2,25,2,27,1,123,0,3,0,43,0,44,0,45,0,3,0,
+72,0,73,0,74,0,3,0,61,0,62,0,63,0,3,0,49,0,50,0,51,0,3,0,94,0,95,0,96,0,3,
+0,47,0,48,0,49,0,3,0,42,0,43,0,44,0,3,0,25,0,26,0,27,0,3,0,77,0,78,0,79,0,
+3,0,69,0,70,0,71,0,3,0,86,0,87,0,88,0,1,0,98,0,3,0,27,0,28,0,29,0,3,0,46,
+0,47,0,48,0,3,0,62,0,63,0,64,0,3,0,40,0,41,0,42,0,3,0,54,0,55,0,56,0,3,0,
+76,0,77,0,78,0,3,0,50,0,51,0,52,0,1,0,29,0,1,0,8,0,3,0,28,0,29,0,30,0,3,0,
+75,0,76,0,77,0,1,0,26,0,3,0,41,0,42,0,43,0,3,0,52,0,53,0,54,0,3,0,57,0,58,
+0,59,0,3,0,58,0,60,0,61,0,3,0,84,0,85,0,86,0,3,0,87,0,88,0,89,0,3,0,32,0,
+34,0,35,0,2,0,20,0,21,0,3,0,44,0,45,0,46,0,3,0,59,0,60,0,61,0,3,0,65,0,66,
+0,67,0,3,0,48,0,49,0,50,0,3,0,58,0,59,0,60,0,3,0,63,0,64,0,65,0,3,0,70,0,
+71,0,72,0,3,0,68,0,69,0,70,0,3,0,56,0,57,0,58,0,3,0,55,0,56,0,57,0,3,0,82,
+0,83,0,84,0,3,0,53,0,54,0,55,0,3,0,67,0,68,0,69,0,3,0,80,0,81,0,82,0,3,0,
+39,0,40,0,41,0,2,0,84,0,87,0,1,0,19,0,1,0,50,0,1,0,96,0,1,0,93,0,1,0,57,0,
+1,0,72,0,1,0,30,0,2,0,65,0,66,0,2,0,44,0,45,0,3,0,66,0,67,0,68,0,3,0,51,0,
+52,0,53,0,1,0,70,0,3,0,71,0,72,0,73,0,3,0,45,0,46,0,47,0,1,0,60,0,3,0,91,
+0,92,0,93,0,2,0,78,0,79,0,2,0,122,0,123,0,2,0,95,0,154,0,2,0,95,0,143,0,1,
+0,91,0,2,0,91,0,92,0,3,0,60,0,61,0,62,0,2,0,41,0,42,0,1,0,45,0,1,0,42,0,2,
+0,33,0,34,0,1,0,47,0,2,0,45,0,46,0,2,0,84,0,85,0,2,0,56,0,57,0,1,0,83,0,2,
+0,64,0,65,0,1,0,52,0,2,0,76,0,77,0,2,0,90,0,91,0,2,0,38,0,39,0,1,0,49,0,2,
+0,68,0,69,0,3,0,30,0,31,0,32,0,3,0,24,0,25,0,26,0,1,0,27,0,2,0,26,0,27,0,
+2,0,31,0,32,0,1,0,58,0,2,0,69,0,70,0,1,0,43,0,3,0,37,0,38,0,39,0,1,0,55,0,
+2,0,48,0,49,0,2,0,50,0,51,0,1,0,53,0,2,0,53,0,54,0,2,0,55,0,56,0,1,0,81,0,
+2,0,79,0,80,0,2,0,37,0,38,0,2,0,36,0,37,0,1,0,65,0,2,0,57,0,58,0,1,0,67,0,
+2,0,61,0,62,0,2,0,40,0,41,0,1,0,77,0,2,0,73,0,74,0,1,0,51,0,1,0,54,0,2,0,
+52,0,53,0,1,0,63,0,1,0,61,0,2,0,60,0,61,0,2,0,67,0,68,0,1,0,68,0,2,0,59,0,
+60,0,1,0,56,0,2,0,51,0,52,0,2,0,74,0,75,0,1,0,66,0,2,0,63,0,64,0,1,0,59,0,
+2,0,49,0,50,0,2,0,34,0,35,0,1,0,85,0,2,0,82,0,83,0,1,0,76,0,2,0,75,0,76,0,
+2,0,32,0,33,0,1,0,73,0,2,0,71,0,72,0,1,0,10,0,1,0,44,0,1,0,32,0,3,0,19,0,
+20,0,21,0,3,0,26,0,27,0,28,0,1,0,40,0,1,0,48,0,1,0,38,0,1,0,25,0,1,0,20,0,
+3,0,6,0,7,0,8,0,1,0,4,0,3,0,128,0,129,0,130,0,1,0,111,0,1,0,36,0,1,0,24,0,
+1,0,12,0,1,0,16,0,1,0,75,0,1,0,74,0,1,0,28,0,1,0,31,0,1,0,7,0,1,0,39,0,1,
+0,15,0,1,0,11,0,1,0,78,0,1,0,79,0,1,0,33,0,1,0,41,0,1,0,35,0,1,0,6,0,3,0,
+38,0,39,0,40,0,3,0,35,0,36,0,37,0,1,0,13,0,2,0,39,0,48,0,48,0,2,0,74,0,75,
+0,2,0,80,0,82,0,2,0,99,0,102,0,1,0,116,0,116,0,2,0,119,0,120,0,1,0,127,0,
+127,0,2,0,143,0,143,0,1,0,175,0,177,0,1,0,178,0,179,0,2,0,180,0,193,0,1,0,
+209,0,209,0,2,0,211,0,226,0,2,0,229,0,230,0,2,0,234,0,235,0,2,0,239,0,242,
+0,2,0,245,0,248,0,2,0,252,1,5,0,2,1,7,1,20,0,2,1,22,1,29,0,2,1,31,1,42,0,
+2,1,45,1,142,0,2,1,144,1,144,0,2,1,151,1,152,0,1,1,153,1,153,0,2,1,155,1,
+159,0,1,1,160,1,160,0,2,1,162,1,162,0,3,1,163,1,163,0,1,1,165,1,167,0,2,1,
+168,1,169,0,1,1,172,1,173,0,1,1,174,1,180,0,2,1,184,1,186,0,2,1,194,1,197,
+0,2,1,200,1,202,0,2,1,208,1,208,0,1,1,210,1,213,0,2,1,220,1,221,0,2,0,0,0,
+1,0,0,0,10,0,34,0,80,0,1,109,121,109,50,0,8,0,4,0,0,0,0,255,255,0,3,0,0,0,
+1,0,2,0,3,107,101,114,110,0,20,109,97,114,107,0,30,109,107,109,107,0,40,0,
+0,0,3,0,0,0,1,0,28,0,0,0,3,0,31,0,32,0,33,0,0,0,1,0,34,0,35,0,72,0,88,0,104,
+0,120,0,136,0,152,0,168,0,184,0,200,0,216,0,232,0,248,1,8,1,24,1,40,1,56,
+1,72,1,88,1,104,1,120,1,136,1,152,1,168,1,184,1,200,1,216,1,232,1,248,2,8,
+2,24,2,40,2,56,2,72,2,88,2,104,0,9,2,0,0,1,0,8,0,1,0,8,0,0,2,40,0,9,2,0,0,
+1,0,8,0,1,0,8,0,0,25,32,0,9,0,0,0,1,0,8,0,1,0,1,0,0,27,116,0,9,0,0,0,1,0,
+8,0,1,0,1,0,0,27,250,0,9,0,0,0,1,0,8,0,1,0,1,0,0,28,128,0,9,0,0,0,1,0,8,0,
+1,0,1,0,0,29,6,0,9,0,0,0,1,0,8,0,1,0,1,0,0,29,140,0,9,0,0,0,1,0,8,0,1,0,1,
+0,0,30,18,0,9,0,0,0,1,0,8,0,1,0,1,0,0,30,152,0,9,0,0,0,1,0,8,0,1,0,1,0,0,
+31,30,0,9,0,0,0,1,0,8,0,1,0,1,0,0,31,164,0,9,0,0,0,1,0,8,0,1,0,1,0,0,32,42,
+0,9,0,0,0,1,0,8,0,1,0,1,0,0,32,176,0,9,0,0,0,1,0,8,0,1,0,1,0,0,33,54,0,9,
+0,0,0,1,0,8,0,1,0,1,0,0,33,70,0,9,0,0,0,1,0,8,0,1,0,1,0,0,33,86,0,9,0,0,0,
+1,0,8,0,1,0,1,0,0,33,102,0,9,0,0,0,1,0,8,0,1,0,1,0,0,33,138,0,9,0,0,0,1,0,
+8,0,1,0,1,0,0,33,154,0,9,0,0,0,1,0,8,0,1,0,1,0,0,33,170,0,9,0,0,0,1,0,8,0,
+1,0,1,0,0,33,186,0,9,0,8,0,1,0,8,0,1,0,1,0,0,34,64,0,9,0,8,0,1,0,8,0,1,0,
+1,0,0,34,100,0,9,0,8,0,1,0,8,0,1,0,1,0,0,34,136,0,9,0,0,0,1,0,8,0,1,0,1,0,
+0,34,172,0,9,0,0,0,1,0,8,0,1,0,1,0,0,35,50,0,9,0,0,0,1,0,8,0,1,0,1,0,0,35,
+184,0,9,0,0,0,1,0,8,0,1,0,1,0,0,35,188,0,9,1,0,0,1,0,8,0,1,0,7,0,0,35,188,
+0,9,1,0,0,1,0,8,0,1,0,1,0,0,37,90,0,9,1,0,0,1,0,8,0,1,0,1,0,0,37,88,0,9,0,
+0,0,1,0,8,0,1,0,4,0,0,37,86,0,9,0,0,0,1,0,8,0,1,0,4,0,0,45,30,0,9,0,0,0,1,
+0,8,0,1,0,4,0,0,54,244,0,9,2,0,0,1,0,8,0,1,0,6,0,0,66,136,0,2,0,66,0,0,1,
+30,7,148,0,27,0,0,14,10,14,78,0,0,0,0,14,118,14,130,0,0,14,142,14,168,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,180,14,186,14,224,0,0,
+0,2,0,36,0,4,0,12,0,0,0,14,0,38,0,9,0,40,0,45,0,34,0,47,0,47,0,40,0,49,0,
+49,0,41,0,66,0,71,0,42,0,76,0,79,0,48,0,83,0,83,0,52,0,87,0,88,0,53,0,96,
+0,96,0,55,0,103,0,107,0,56,0,109,0,111,0,61,0,113,0,115,0,64,0,128,0,128,
+0,67,0,146,0,158,0,68,0,160,0,161,0,81,0,163,0,165,0,83,0,194,0,208,0,86,
+0,228,0,228,0,101,0,236,0,237,0,102,0,243,0,243,0,104,1,6,1,6,0,105,1,21,
+1,21,0,106,1,30,1,30,0,107,1,43,1,44,0,108,1,145,1,148,0,110,1,164,1,164,
+0,114,1,170,1,170,0,115,1,187,1,190,0,116,1,198,1,199,0,120,1,207,1,207,0,
+122,1,209,1,209,0,123,1,214,1,219,0,124,1,222,2,15,0,130,2,20,2,21,0,180,
+2,25,2,27,0,182,0,2,1,19,0,4,0,4,0,2,0,5,0,6,0,1,0,7,0,7,0,2,0,8,0,9,0,1,
+0,10,0,10,0,2,0,11,0,11,0,1,0,12,0,12,0,6,0,13,0,13,0,7,0,14,0,16,0,5,0,17,
+0,17,0,6,0,18,0,18,0,1,0,19,0,21,0,2,0,22,0,27,0,1,0,28,0,28,0,2,0,29,0,29,
+0,1,0,30,0,30,0,2,0,31,0,31,0,9,0,32,0,32,0,2,0,33,0,33,0,1,0,34,0,35,0,2,
+0,36,0,36,0,5,0,37,0,38,0,2,0,39,0,39,0,10,0,40,0,42,0,5,0,43,0,43,0,1,0,
+44,0,45,0,5,0,47,0,47,0,25,0,48,0,48,0,11,0,49,0,49,0,2,0,66,0,71,0,1,0,76,
+0,77,0,6,0,78,0,78,0,1,0,79,0,79,0,5,0,80,0,82,0,26,0,83,0,83,0,6,0,85,0,
+85,0,7,0,87,0,88,0,1,0,96,0,96,0,2,0,103,0,105,0,1,0,106,0,107,0,2,0,109,
+0,111,0,2,0,113,0,113,0,1,0,114,0,114,0,2,0,115,0,115,0,1,0,128,0,128,0,1,
+0,146,0,147,0,2,0,148,0,148,0,1,0,149,0,156,0,2,0,157,0,157,0,1,0,158,0,158,
+0,2,0,159,0,159,0,16,0,160,0,160,0,2,0,161,0,161,0,1,0,163,0,164,0,2,0,165,
+0,165,0,1,0,172,0,172,0,7,0,179,0,179,0,14,0,194,0,200,0,25,0,201,0,208,0,
+24,0,211,0,211,0,3,0,212,0,212,0,4,0,213,0,213,0,26,0,214,0,214,0,4,0,215,
+0,215,0,26,0,216,0,216,0,4,0,217,0,217,0,3,0,218,0,218,0,4,0,219,0,219,0,
+26,0,220,0,220,0,4,0,221,0,221,0,26,0,222,0,222,0,4,0,223,0,223,0,3,0,224,
+0,224,0,4,0,225,0,225,0,26,0,226,0,226,0,4,0,228,0,228,0,5,0,229,0,229,0,
+3,0,230,0,230,0,4,0,231,0,233,0,7,0,234,0,234,0,3,0,235,0,235,0,4,0,236,0,
+237,0,5,0,239,0,239,0,3,0,240,0,240,0,4,0,241,0,241,0,3,0,242,0,242,0,4,0,
+243,0,243,0,5,0,245,0,245,0,3,0,246,0,246,0,4,0,247,0,247,0,26,0,248,0,248,
+0,4,0,252,0,252,0,3,0,253,0,253,0,4,0,254,0,254,0,3,0,255,0,255,0,4,1,0,1,
+0,0,3,1,1,1,1,0,4,1,2,1,2,0,26,1,3,1,3,0,4,1,4,1,4,0,26,1,5,1,5,0,4,1,6,1,
+6,0,1,1,7,1,7,0,26,1,8,1,8,0,4,1,9,1,9,0,26,1,10,1,10,0,4,1,11,1,11,0,26,
+1,12,1,12,0,4,1,13,1,13,0,26,1,14,1,14,0,4,1,15,1,15,0,3,1,16,1,16,0,4,1,
+17,1,17,0,26,1,18,1,18,0,4,1,19,1,19,0,3,1,20,1,20,0,4,1,21,1,21,0,9,1,22,
+1,22,0,26,1,23,1,23,0,4,1,24,1,24,0,3,1,25,1,25,0,4,1,26,1,26,0,3,1,27,1,
+27,0,4,1,28,1,28,0,3,1,29,1,29,0,4,1,30,1,30,0,5,1,31,1,31,0,3,1,32,1,32,
+0,4,1,33,1,33,0,3,1,34,1,34,0,4,1,35,1,35,0,3,1,36,1,36,0,4,1,37,1,37,0,26,
+1,38,1,38,0,4,1,39,1,39,0,3,1,40,1,40,0,4,1,41,1,41,0,26,1,42,1,42,0,4,1,
+43,1,43,0,5,1,44,1,44,0,6,1,45,1,45,0,26,1,46,1,46,0,4,1,47,1,47,0,26,1,48,
+1,48,0,4,1,49,1,49,0,26,1,50,1,50,0,4,1,51,1,51,0,26,1,52,1,52,0,4,1,53,1,
+53,0,26,1,54,1,54,0,4,1,55,1,55,0,26,1,56,1,56,0,4,1,57,1,57,0,26,1,58,1,
+58,0,4,1,62,1,62,0,26,1,63,1,63,0,4,1,64,1,64,0,26,1,65,1,65,0,4,1,66,1,66,
+0,26,1,67,1,67,0,4,1,68,1,68,0,3,1,69,1,69,0,4,1,70,1,70,0,3,1,71,1,71,0,
+4,1,72,1,72,0,3,1,73,1,73,0,4,1,74,1,74,0,26,1,75,1,75,0,4,1,76,1,76,0,26,
+1,77,1,77,0,4,1,78,1,78,0,26,1,79,1,79,0,4,1,80,1,80,0,3,1,81,1,81,0,4,1,
+82,1,82,0,3,1,83,1,83,0,4,1,84,1,84,0,3,1,85,1,85,0,4,1,86,1,86,0,3,1,87,
+1,87,0,4,1,88,1,88,0,3,1,89,1,89,0,4,1,90,1,90,0,3,1,91,1,91,0,4,1,92,1,92,
+0,3,1,93,1,93,0,4,1,94,1,94,0,26,1,95,1,95,0,4,1,96,1,96,0,3,1,97,1,97,0,
+4,1,98,1,98,0,26,1,99,1,99,0,4,1,100,1,100,0,26,1,101,1,101,0,4,1,102,1,102,
+0,3,1,103,1,103,0,4,1,104,1,104,0,3,1,105,1,105,0,4,1,106,1,106,0,26,1,107,
+1,107,0,4,1,108,1,108,0,3,1,109,1,109,0,4,1,110,1,110,0,3,1,111,1,111,0,4,
+1,112,1,112,0,3,1,113,1,113,0,4,1,114,1,114,0,3,1,115,1,115,0,4,1,116,1,116,
+0,3,1,117,1,117,0,4,1,118,1,118,0,3,1,119,1,119,0,4,1,120,1,120,0,3,1,121,
+1,121,0,4,1,122,1,122,0,3,1,123,1,123,0,4,1,125,1,125,0,4,1,126,1,126,0,3,
+1,127,1,127,0,4,1,128,1,128,0,3,1,129,1,129,0,4,1,130,1,130,0,3,1,131,1,131,
+0,4,1,132,1,132,0,26,1,133,1,133,0,4,1,134,1,134,0,3,1,135,1,135,0,4,1,136,
+1,136,0,3,1,137,1,137,0,4,1,138,1,138,0,26,1,139,1,139,0,4,1,140,1,140,0,
+3,1,141,1,141,0,4,1,145,1,148,0,8,1,160,1,160,0,22,1,164,1,164,0,8,1,165,
+1,166,0,11,1,167,1,167,0,22,1,170,1,170,0,1,1,174,1,176,0,12,1,177,1,177,
+0,15,1,178,1,178,0,13,1,179,1,179,0,12,1,180,1,180,0,13,1,186,1,186,0,22,
+1,187,1,190,0,25,1,194,1,194,0,18,1,195,1,196,0,20,1,198,1,199,0,23,1,200,
+1,200,0,21,1,201,1,201,0,18,1,202,1,202,0,17,1,207,1,207,0,9,1,209,1,209,
+0,8,1,210,1,210,0,18,1,211,1,211,0,19,1,214,1,219,0,25,1,220,1,221,0,20,1,
+222,1,228,0,25,1,229,1,230,0,8,1,231,1,235,0,25,1,236,1,237,0,24,1,238,1,
+239,0,25,1,240,1,241,0,24,1,242,1,243,0,25,1,244,1,246,0,24,1,247,1,250,0,
+25,1,251,1,251,0,24,1,252,1,252,0,8,1,253,2,1,0,24,2,2,2,13,0,25,2,14,2,15,
+0,9,2,20,2,21,0,23,2,25,2,26,0,9,2,27,2,27,0,8,0,2,1,19,0,4,0,4,0,2,0,5,0,
+6,0,1,0,7,0,7,0,2,0,8,0,9,0,1,0,10,0,10,0,2,0,11,0,11,0,1,0,12,0,12,0,6,0,
+13,0,14,0,7,0,15,0,16,0,5,0,17,0,17,0,6,0,18,0,18,0,1,0,19,0,21,0,2,0,22,
+0,27,0,1,0,28,0,28,0,2,0,29,0,29,0,1,0,30,0,30,0,2,0,31,0,31,0,9,0,32,0,32,
+0,2,0,33,0,33,0,1,0,34,0,35,0,2,0,36,0,36,0,5,0,37,0,38,0,2,0,39,0,39,0,10,
+0,40,0,42,0,5,0,43,0,43,0,1,0,44,0,45,0,5,0,47,0,47,0,25,0,48,0,48,0,11,0,
+49,0,49,0,2,0,66,0,71,0,1,0,76,0,77,0,6,0,78,0,78,0,1,0,79,0,79,0,5,0,80,
+0,82,0,26,0,83,0,83,0,6,0,85,0,85,0,7,0,87,0,88,0,1,0,96,0,96,0,2,0,103,0,
+105,0,1,0,106,0,107,0,2,0,109,0,111,0,2,0,113,0,113,0,1,0,114,0,114,0,2,0,
+115,0,115,0,1,0,128,0,128,0,1,0,146,0,147,0,2,0,148,0,148,0,1,0,149,0,156,
+0,2,0,157,0,157,0,1,0,158,0,158,0,2,0,159,0,159,0,16,0,160,0,160,0,2,0,161,
+0,161,0,1,0,163,0,164,0,2,0,165,0,165,0,1,0,172,0,172,0,7,0,179,0,179,0,14,
+0,194,0,200,0,25,0,201,0,208,0,24,0,211,0,211,0,3,0,212,0,212,0,4,0,213,0,
+213,0,26,0,214,0,214,0,4,0,215,0,215,0,26,0,216,0,216,0,4,0,217,0,217,0,3,
+0,218,0,218,0,4,0,219,0,219,0,26,0,220,0,220,0,4,0,221,0,221,0,26,0,222,0,
+222,0,4,0,223,0,223,0,3,0,224,0,224,0,4,0,225,0,225,0,26,0,226,0,226,0,4,
+0,228,0,228,0,7,0,229,0,229,0,3,0,230,0,230,0,4,0,231,0,233,0,7,0,234,0,234,
+0,3,0,235,0,235,0,4,0,236,0,237,0,5,0,239,0,239,0,3,0,240,0,240,0,4,0,241,
+0,241,0,3,0,242,0,242,0,4,0,243,0,243,0,5,0,245,0,245,0,3,0,246,0,246,0,4,
+0,247,0,247,0,26,0,248,0,248,0,4,0,252,0,252,0,3,0,253,0,253,0,4,0,254,0,
+254,0,3,0,255,0,255,0,4,1,0,1,0,0,3,1,1,1,1,0,4,1,2,1,2,0,26,1,3,1,3,0,4,
+1,4,1,4,0,26,1,5,1,5,0,4,1,6,1,6,0,1,1,7,1,7,0,26,1,8,1,8,0,4,1,9,1,9,0,26,
+1,10,1,10,0,4,1,11,1,11,0,26,1,12,1,12,0,4,1,13,1,13,0,26,1,14,1,14,0,4,1,
+15,1,15,0,3,1,16,1,16,0,4,1,17,1,17,0,26,1,18,1,18,0,4,1,19,1,19,0,3,1,20,
+1,20,0,4,1,21,1,21,0,9,1,22,1,22,0,26,1,23,1,23,0,4,1,24,1,24,0,3,1,25,1,
+25,0,4,1,26,1,26,0,3,1,27,1,27,0,4,1,28,1,28,0,3,1,29,1,29,0,4,1,30,1,30,
+0,5,1,31,1,31,0,3,1,32,1,32,0,4,1,33,1,33,0,3,1,34,1,34,0,4,1,35,1,35,0,3,
+1,36,1,36,0,4,1,37,1,37,0,26,1,38,1,38,0,4,1,39,1,39,0,3,1,40,1,40,0,4,1,
+41,1,41,0,26,1,42,1,42,0,4,1,43,1,43,0,5,1,44,1,44,0,6,1,45,1,45,0,26,1,46,
+1,46,0,4,1,47,1,47,0,26,1,48,1,48,0,4,1,49,1,49,0,26,1,50,1,50,0,4,1,51,1,
+51,0,26,1,52,1,52,0,4,1,53,1,53,0,26,1,54,1,54,0,4,1,55,1,55,0,26,1,56,1,
+56,0,4,1,57,1,57,0,26,1,58,1,58,0,4,1,62,1,62,0,26,1,63,1,63,0,4,1,64,1,64,
+0,26,1,65,1,65,0,4,1,66,1,66,0,26,1,67,1,67,0,4,1,68,1,68,0,3,1,69,1,69,0,
+4,1,70,1,70,0,3,1,71,1,71,0,4,1,72,1,72,0,3,1,73,1,73,0,4,1,74,1,74,0,26,
+1,75,1,75,0,4,1,76,1,76,0,26,1,77,1,77,0,4,1,78,1,78,0,26,1,79,1,79,0,4,1,
+80,1,80,0,3,1,81,1,81,0,4,1,82,1,82,0,3,1,83,1,83,0,4,1,84,1,84,0,3,1,85,
+1,85,0,4,1,86,1,86,0,3,1,87,1,87,0,4,1,88,1,88,0,3,1,89,1,89,0,4,1,90,1,90,
+0,3,1,91,1,91,0,4,1,92,1,92,0,3,1,93,1,93,0,4,1,94,1,94,0,26,1,95,1,95,0,
+4,1,96,1,96,0,3,1,97,1,97,0,4,1,98,1,98,0,26,1,99,1,99,0,4,1,100,1,100,0,
+26,1,101,1,101,0,4,1,102,1,102,0,3,1,103,1,103,0,4,1,104,1,104,0,3,1,105,
+1,105,0,4,1,106,1,106,0,26,1,107,1,107,0,4,1,108,1,108,0,3,1,109,1,109,0,
+4,1,110,1,110,0,3,1,111,1,111,0,4,1,112,1,112,0,3,1,113,1,113,0,4,1,114,1,
+114,0,3,1,115,1,115,0,4,1,116,1,116,0,3,1,117,1,117,0,4,1,118,1,118,0,3,1,
+119,1,119,0,4,1,120,1,120,0,3,1,121,1,121,0,4,1,122,1,122,0,3,1,123,1,123,
+0,4,1,125,1,125,0,4,1,126,1,126,0,3,1,127,1,127,0,4,1,128,1,128,0,3,1,129,
+1,129,0,4,1,130,1,130,0,3,1,131,1,131,0,4,1,132,1,132,0,26,1,133,1,133,0,
+4,1,134,1,134,0,3,1,135,1,135,0,4,1,136,1,136,0,3,1,137,1,137,0,4,1,138,1,
+138,0,26,1,139,1,139,0,4,1,140,1,140,0,3,1,141,1,141,0,4,1,145,1,148,0,8,
+1,160,1,160,0,22,1,164,1,164,0,8,1,165,1,166,0,11,1,167,1,167,0,22,1,170,
+1,170,0,1,1,174,1,176,0,12,1,177,1,177,0,15,1,178,1,178,0,13,1,179,1,179,
+0,12,1,180,1,180,0,13,1,186,1,186,0,22,1,187,1,190,0,25,1,194,1,194,0,18,
+1,195,1,196,0,20,1,198,1,199,0,23,1,200,1,200,0,21,1,201,1,201,0,18,1,202,
+1,202,0,17,1,207,1,207,0,9,1,209,1,209,0,8,1,210,1,210,0,18,1,211,1,211,0,
+19,1,214,1,219,0,25,1,220,1,221,0,20,1,222,1,228,0,25,1,229,1,230,0,8,1,231,
+1,235,0,25,1,236,1,237,0,24,1,238,1,239,0,25,1,240,1,241,0,24,1,242,1,243,
+0,25,1,244,1,246,0,24,1,247,1,250,0,25,1,251,1,251,0,24,1,252,1,252,0,8,1,
+253,2,0,0,24,2,2,2,13,0,25,2,14,2,15,0,9,2,20,2,21,0,23,2,25,2,26,0,9,2,27,
+2,27,0,8,0,33,1,0,1,16,1,32,1,48,1,64,1,82,1,100,1,118,1,136,1,154,1,172,
+1,188,1,204,1,220,1,236,1,252,2,12,2,28,2,46,2,64,2,82,2,100,2,118,2,136,
+2,154,2,172,2,188,2,204,2,220,2,236,2,252,3,12,3,28,0,19,2,232,2,248,3,8,
+3,24,3,40,3,58,3,76,3,94,3,112,3,130,3,148,3,164,3,180,3,196,3,212,3,228,
+3,244,4,4,4,22,0,5,3,254,4,14,4,30,4,46,4,62,0,5,4,64,4,80,4,96,4,112,4,128,
+0,12,4,130,4,146,4,160,4,176,4,192,4,208,4,224,4,240,5,0,5,16,5,32,5,48,0,
+5,5,38,5,54,5,72,5,90,5,108,0,2,5,114,5,130,0,18,5,138,5,156,5,174,5,192,
+5,210,5,228,5,246,6,8,6,26,6,46,6,64,6,84,6,102,6,122,6,142,6,162,6,182,6,
+200,0,20,6,180,6,198,6,216,6,234,6,252,7,12,7,30,7,48,7,66,7,84,7,100,7,120,
+7,140,7,160,7,180,7,198,7,218,7,238,8,2,8,22,0,0,0,2,0,12,0,1,0,5,0,1,0,0,
+0,2,0,0,0,2,0,12,0,1,0,7,0,1,0,0,0,2,0,0,0,2,0,12,0,1,0,24,0,1,0,0,0,2,0,
+0,0,2,0,12,0,1,0,25,0,1,0,0,0,2,0,0,0,2,0,12,0,2,0,1,0,3,0,1,0,0,0,4,0,0,
+0,2,0,13,0,2,0,1,0,3,0,1,0,0,0,8,0,0,0,2,0,14,0,2,0,1,0,3,0,1,0,0,0,6,0,0,
+0,2,0,15,0,2,0,1,0,3,0,1,0,0,0,9,0,0,0,2,0,17,0,2,0,1,0,3,0,1,0,0,0,24,0,
+0,0,2,0,19,0,2,0,1,0,3,0,1,0,0,0,24,0,0,0,2,0,12,0,1,0,16,0,1,0,0,0,4,0,0,
+0,2,0,13,0,1,0,16,0,1,0,0,0,5,0,0,0,2,0,15,0,1,0,16,0,1,0,0,0,4,0,0,0,2,0,
+15,0,1,0,7,0,1,0,0,0,4,0,0,0,2,0,15,0,1,0,5,0,1,0,0,0,4,0,0,0,2,0,15,0,1,
+0,24,0,1,0,0,0,4,0,0,0,2,0,15,0,1,0,25,0,1,0,0,0,4,0,0,0,2,0,3,0,2,0,1,0,
+3,0,1,0,0,0,2,0,0,0,2,0,3,0,2,0,1,0,12,0,1,0,0,0,5,0,0,0,2,0,3,0,2,0,1,0,
+13,0,1,0,0,0,5,0,0,0,2,0,3,0,2,0,1,0,14,0,1,0,0,0,5,0,0,0,2,0,3,0,2,0,1,0,
+17,0,1,0,0,0,6,0,0,0,2,0,3,0,2,0,1,0,18,0,1,0,0,0,10,0,0,0,2,0,3,0,2,0,1,
+0,19,0,1,0,0,0,11,0,0,0,2,0,3,0,2,0,1,0,20,0,1,0,0,0,20,0,0,0,2,0,3,0,1,0,
+5,0,1,0,0,0,24,0,0,0,2,0,3,0,1,0,7,0,1,0,0,0,24,0,0,0,2,0,3,0,1,0,16,0,1,
+0,0,0,6,0,0,0,2,0,3,0,1,0,23,0,1,0,0,0,12,0,0,0,2,0,3,0,1,0,24,0,1,0,0,0,
+24,0,0,0,2,0,3,0,1,0,25,0,1,0,0,0,24,0,0,0,2,0,3,0,1,0,8,0,1,0,0,0,3,0,0,
+0,2,0,26,0,1,0,23,0,1,0,0,0,8,0,0,0,2,0,12,0,1,0,5,0,1,0,0,0,2,0,0,0,2,0,
+12,0,1,0,7,0,1,0,0,0,2,0,0,0,2,0,12,0,1,0,24,0,1,0,0,0,2,0,0,0,2,0,12,0,1,
+0,25,0,1,0,0,0,2,0,0,0,2,0,12,0,2,0,1,0,3,0,1,0,0,0,4,0,0,0,2,0,13,0,2,0,
+1,0,3,0,1,0,0,0,8,0,0,0,2,0,14,0,2,0,1,0,3,0,1,0,0,0,6,0,0,0,2,0,15,0,2,0,
+1,0,3,0,1,0,0,0,9,0,0,0,2,0,17,0,2,0,1,0,3,0,1,0,0,0,24,0,0,0,2,0,19,0,2,
+0,1,0,3,0,1,0,0,0,25,0,0,0,2,0,12,0,1,0,16,0,1,0,0,0,4,0,0,0,2,0,13,0,1,0,
+16,0,1,0,0,0,5,0,0,0,2,0,15,0,1,0,16,0,1,0,0,0,4,0,0,0,2,0,15,0,1,0,7,0,1,
+0,0,0,4,0,0,0,2,0,15,0,1,0,5,0,1,0,0,0,4,0,0,0,2,0,15,0,1,0,24,0,1,0,0,0,
+4,0,0,0,2,0,15,0,1,0,25,0,1,0,0,0,4,0,0,0,2,0,3,0,2,0,1,0,19,0,1,0,0,0,5,
+0,0,0,2,0,3,0,1,0,23,0,1,0,0,0,5,0,0,0,1,0,2,0,1,0,3,0,1,0,0,0,21,0,0,0,1,
+0,2,0,1,0,18,0,1,0,0,0,21,0,0,0,1,0,2,0,1,0,19,0,1,0,0,0,23,0,0,0,1,0,2,0,
+1,0,20,0,1,0,0,0,22,0,0,0,1,0,1,0,23,0,1,0,0,0,23,0,0,0,1,0,2,0,1,0,3,0,1,
+0,0,0,21,0,0,0,1,0,2,0,1,0,18,0,1,0,0,0,21,0,0,0,1,0,2,0,1,0,19,0,1,0,0,0,
+23,0,0,0,1,0,2,0,1,0,20,0,1,0,0,0,22,0,0,0,1,0,1,0,23,0,1,0,0,0,23,0,0,0,
+1,0,2,0,1,0,3,0,1,0,0,0,14,0,0,0,1,0,1,0,23,0,1,0,0,0,17,0,0,0,1,0,2,0,1,
+0,17,0,1,0,0,0,15,0,0,0,1,0,2,0,1,0,18,0,1,0,0,0,16,0,0,0,1,0,2,0,1,0,19,
+0,1,0,0,0,18,0,0,0,1,0,2,0,1,0,20,0,1,0,0,0,19,0,0,0,1,0,2,0,9,0,14,0,1,0,
+0,0,13,0,0,0,1,0,2,0,9,0,15,0,1,0,0,0,13,0,0,0,1,0,2,0,9,0,17,0,1,0,0,0,15,
+0,0,0,1,0,2,0,9,0,18,0,1,0,0,0,16,0,0,0,1,0,2,0,9,0,19,0,1,0,0,0,18,0,0,0,
+1,0,2,0,9,0,20,0,1,0,0,0,19,0,0,0,1,0,2,0,1,0,3,0,1,0,0,0,27,0,0,0,2,0,4,
+0,2,0,1,0,3,0,1,0,0,0,27,0,0,0,2,0,20,0,2,0,1,0,3,0,1,0,0,0,27,0,0,0,2,0,
+21,0,2,0,1,0,3,0,1,0,0,0,27,0,0,0,2,0,26,0,2,0,1,0,3,0,1,0,0,0,27,0,0,0,1,
+0,2,0,1,0,3,0,1,0,0,0,26,0,0,0,1,0,1,0,16,0,1,0,0,0,26,0,0,0,2,0,1,0,2,0,
+1,0,3,0,1,0,1,0,2,0,0,0,2,0,1,0,2,0,1,0,18,0,1,0,1,0,20,0,0,0,2,0,1,0,2,0,
+1,0,19,0,1,0,1,0,9,0,0,0,2,0,1,0,2,0,1,0,20,0,1,0,1,0,5,0,0,0,2,0,2,0,2,0,
+1,0,3,0,1,0,1,0,2,0,0,0,2,0,2,0,2,0,1,0,18,0,1,0,1,0,20,0,0,0,2,0,2,0,2,0,
+1,0,19,0,1,0,1,0,9,0,0,0,2,0,2,0,2,0,1,0,20,0,1,0,1,0,5,0,0,0,3,0,1,0,26,
+0,2,0,1,0,19,0,1,0,1,0,7,0,0,0,3,0,1,0,26,0,1,0,23,0,1,0,1,0,10,0,0,0,3,0,
+2,0,26,0,2,0,1,0,19,0,1,0,1,0,7,0,0,0,3,0,2,0,26,0,1,0,23,0,1,0,1,0,10,0,
+0,0,3,0,1,0,4,0,2,0,1,0,3,0,1,0,1,0,20,0,0,0,3,0,1,0,4,0,2,0,1,0,18,0,1,0,
+1,0,7,0,0,0,3,0,1,0,4,0,2,0,1,0,19,0,1,0,1,0,4,0,0,0,3,0,1,0,4,0,2,0,1,0,
+20,0,1,0,1,0,6,0,0,0,3,0,1,0,4,0,1,0,23,0,1,0,1,0,4,0,0,0,3,0,2,0,3,0,1,0,
+23,0,1,0,1,0,2,0,0,0,2,0,1,0,2,0,1,0,3,0,1,0,1,0,2,0,0,0,2,0,1,0,2,0,1,0,
+18,0,1,0,1,0,20,0,0,0,2,0,1,0,2,0,1,0,19,0,1,0,1,0,4,0,0,0,2,0,1,0,2,0,1,
+0,20,0,1,0,1,0,6,0,0,0,2,0,1,0,1,0,23,0,1,0,1,0,4,0,0,0,2,0,2,0,2,0,1,0,3,
+0,1,0,1,0,2,0,0,0,2,0,2,0,2,0,1,0,18,0,1,0,1,0,20,0,0,0,2,0,2,0,2,0,1,0,19,
+0,1,0,1,0,4,0,0,0,2,0,2,0,2,0,1,0,20,0,1,0,1,0,6,0,0,0,2,0,2,0,1,0,23,0,1,
+0,1,0,4,0,0,0,3,0,1,0,22,0,2,0,1,0,3,0,1,0,1,0,2,0,0,0,3,0,1,0,22,0,2,0,1,
+0,18,0,1,0,1,0,20,0,0,0,3,0,1,0,22,0,2,0,1,0,19,0,1,0,1,0,4,0,0,0,3,0,1,0,
+22,0,2,0,1,0,20,0,1,0,1,0,6,0,0,0,3,0,1,0,22,0,1,0,23,0,1,0,1,0,4,0,0,0,3,
+0,2,0,22,0,2,0,1,0,3,0,1,0,1,0,2,0,0,0,3,0,2,0,22,0,2,0,1,0,18,0,1,0,1,0,
+20,0,0,0,3,0,2,0,22,0,2,0,1,0,19,0,1,0,1,0,4,0,0,0,3,0,2,0,22,0,2,0,1,0,20,
+0,1,0,1,0,6,0,0,0,3,0,2,0,22,0,1,0,23,0,1,0,1,0,4,0,2,0,18,0,0,0,94,1,250,
+0,3,0,0,2,58,0,0,0,1,0,36,0,5,0,6,0,8,0,9,0,11,0,18,0,22,0,23,0,24,0,25,0,
+26,0,27,0,29,0,33,0,43,0,66,0,67,0,68,0,69,0,70,0,71,0,78,0,87,0,88,0,103,
+0,104,0,105,0,113,0,115,0,128,0,148,0,157,0,161,0,165,1,6,1,170,0,2,0,68,
+0,5,0,6,0,1,0,8,0,9,0,1,0,11,0,11,0,1,0,18,0,18,0,1,0,22,0,27,0,1,0,29,0,
+29,0,1,0,33,0,33,0,1,0,43,0,43,0,1,0,66,0,71,0,1,0,78,0,78,0,1,0,87,0,88,
+0,1,0,103,0,105,0,1,0,113,0,113,0,1,0,115,0,115,0,1,0,128,0,128,0,1,0,148,
+0,148,0,1,0,157,0,157,0,1,0,161,0,161,0,1,0,165,0,165,0,1,0,211,0,211,0,2,
+0,217,0,217,0,2,0,223,0,223,0,2,0,229,0,229,0,2,0,234,0,234,0,2,0,239,0,239,
+0,2,0,241,0,241,0,2,0,245,0,245,0,2,0,252,0,252,0,2,0,254,0,254,0,2,1,0,1,
+0,0,2,1,6,1,6,0,1,1,15,1,15,0,2,1,19,1,19,0,2,1,24,1,24,0,2,1,26,1,26,0,2,
+1,28,1,28,0,2,1,31,1,31,0,2,1,33,1,33,0,2,1,35,1,35,0,2,1,39,1,39,0,2,1,68,
+1,68,0,2,1,70,1,70,0,2,1,72,1,72,0,2,1,80,1,80,0,2,1,82,1,82,0,2,1,84,1,84,
+0,2,1,86,1,86,0,2,1,88,1,88,0,2,1,90,1,90,0,2,1,92,1,92,0,2,1,96,1,96,0,2,
+1,102,1,102,0,2,1,104,1,104,0,2,1,108,1,108,0,2,1,110,1,110,0,2,1,112,1,112,
+0,2,1,114,1,114,0,2,1,116,1,116,0,2,1,118,1,118,0,2,1,120,1,120,0,2,1,122,
+1,122,0,2,1,126,1,126,0,2,1,128,1,128,0,2,1,130,1,130,0,2,1,134,1,134,0,2,
+1,136,1,136,0,2,1,140,1,140,0,2,1,170,1,170,0,1,0,2,0,10,0,31,0,31,0,4,0,
+179,0,179,0,5,1,21,1,21,0,4,1,144,1,144,0,5,1,201,1,202,0,6,1,207,1,207,0,
+4,1,220,1,220,0,5,1,221,1,221,0,6,2,14,2,15,0,4,2,25,2,26,0,4,0,2,0,6,0,24,
+0,0,0,2,0,2,0,2,0,4,0,5,0,1,0,0,0,10,0,0,0,2,0,2,0,2,0,4,0,6,0,1,0,0,0,4,
+0,1,0,8,0,4,1,19,0,2,0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,
+0,30,0,11,0,32,0,35,0,24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,
+0,71,0,33,0,76,0,78,0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,
+0,107,0,46,0,109,0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,0,146,0,158,
+0,58,0,160,0,161,0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,
+1,170,0,78,0,1,0,8,0,4,1,34,0,2,0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,
+0,10,0,18,0,30,0,11,0,32,0,35,0,24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,
+0,32,0,66,0,71,0,33,0,76,0,78,0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,
+0,45,0,103,0,107,0,46,0,109,0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,
+0,146,0,158,0,58,0,160,0,161,0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,
+6,0,77,1,170,1,170,0,78,0,1,0,8,0,4,1,124,0,2,0,23,0,4,0,11,0,0,0,13,0,14,
+0,8,0,16,0,16,0,10,0,18,0,30,0,11,0,32,0,35,0,24,0,37,0,39,0,28,0,43,0,43,
+0,31,0,49,0,49,0,32,0,66,0,71,0,33,0,76,0,78,0,39,0,83,0,83,0,42,0,87,0,88,
+0,43,0,96,0,96,0,45,0,103,0,107,0,46,0,109,0,111,0,51,0,113,0,115,0,54,0,
+128,0,128,0,57,0,146,0,158,0,58,0,160,0,161,0,71,0,163,0,165,0,73,0,232,0,
+232,0,76,1,6,1,6,0,77,1,170,1,170,0,78,0,1,0,8,0,4,0,50,0,2,0,23,0,4,0,11,
+0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,0,30,0,11,0,32,0,35,0,24,0,37,0,39,
+0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,0,71,0,33,0,76,0,78,0,39,0,83,0,83,
+0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,0,107,0,46,0,109,0,111,0,51,0,113,
+0,115,0,54,0,128,0,128,0,57,0,146,0,158,0,58,0,160,0,161,0,71,0,163,0,165,
+0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,1,170,0,78,0,1,0,8,0,4,0,100,0,2,
+0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,0,30,0,11,0,32,0,35,0,
+24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,0,71,0,33,0,76,0,78,
+0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,0,107,0,46,0,109,
+0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,0,146,0,158,0,58,0,160,0,161,
+0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,1,170,0,78,0,1,
+0,8,0,4,0,125,0,2,0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,0,30,
+0,11,0,32,0,35,0,24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,0,71,
+0,33,0,76,0,78,0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,0,
+107,0,46,0,109,0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,0,146,0,158,0,
+58,0,160,0,161,0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,
+1,170,0,78,0,1,0,8,0,4,0,200,0,2,0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,
+0,10,0,18,0,30,0,11,0,32,0,35,0,24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,
+0,32,0,66,0,71,0,33,0,76,0,78,0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,
+0,45,0,103,0,107,0,46,0,109,0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,
+0,146,0,158,0,58,0,160,0,161,0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,
+6,0,77,1,170,1,170,0,78,0,1,0,8,0,4,1,194,0,2,0,23,0,4,0,11,0,0,0,13,0,14,
+0,8,0,16,0,16,0,10,0,18,0,30,0,11,0,32,0,35,0,24,0,37,0,39,0,28,0,43,0,43,
+0,31,0,49,0,49,0,32,0,66,0,71,0,33,0,76,0,78,0,39,0,83,0,83,0,42,0,87,0,88,
+0,43,0,96,0,96,0,45,0,103,0,107,0,46,0,109,0,111,0,51,0,113,0,115,0,54,0,
+128,0,128,0,57,0,146,0,158,0,58,0,160,0,161,0,71,0,163,0,165,0,73,0,232,0,
+232,0,76,1,6,1,6,0,77,1,170,1,170,0,78,0,1,0,8,0,4,1,64,0,2,0,23,0,4,0,11,
+0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,0,30,0,11,0,32,0,35,0,24,0,37,0,39,
+0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,0,71,0,33,0,76,0,78,0,39,0,83,0,83,
+0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,0,107,0,46,0,109,0,111,0,51,0,113,
+0,115,0,54,0,128,0,128,0,57,0,146,0,158,0,58,0,160,0,161,0,71,0,163,0,165,
+0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,1,170,0,78,0,1,0,8,0,4,1,224,0,2,
+0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,0,30,0,11,0,32,0,35,0,
+24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,0,71,0,33,0,76,0,78,
+0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,0,107,0,46,0,109,
+0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,0,146,0,158,0,58,0,160,0,161,
+0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,1,170,0,78,0,1,
+0,8,0,4,2,38,0,2,0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,0,30,
+0,11,0,32,0,35,0,24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,0,71,
+0,33,0,76,0,78,0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,0,
+107,0,46,0,109,0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,0,146,0,158,0,
+58,0,160,0,161,0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,
+1,170,0,78,0,1,0,8,0,4,0,50,0,1,0,10,1,145,1,146,1,147,1,148,1,164,1,209,
+1,229,1,230,1,252,2,27,0,1,0,8,0,4,0,100,0,1,0,10,1,145,1,146,1,147,1,148,
+1,164,1,209,1,229,1,230,1,252,2,27,0,1,0,8,0,4,1,69,0,1,0,10,1,145,1,146,
+1,147,1,148,1,164,1,209,1,229,1,230,1,252,2,27,0,2,0,28,0,4,0,10,0,225,0,
+225,0,225,0,225,0,225,0,225,0,225,0,225,1,69,0,225,0,1,0,10,1,145,1,146,1,
+147,1,148,1,164,1,209,1,229,1,230,1,252,2,27,0,1,0,8,0,4,1,124,0,1,0,10,1,
+145,1,146,1,147,1,148,1,164,1,209,1,229,1,230,1,252,2,27,0,1,0,8,0,4,1,194,
+0,1,0,10,1,145,1,146,1,147,1,148,1,164,1,209,1,229,1,230,1,252,2,27,0,1,0,
+8,0,4,0,100,0,1,0,10,1,145,1,146,1,147,1,148,1,164,1,209,1,229,1,230,1,252,
+2,27,0,1,0,8,0,4,0,240,0,2,0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,0,10,
+0,18,0,30,0,11,0,32,0,35,0,24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,0,32,
+0,66,0,71,0,33,0,76,0,78,0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,0,45,
+0,103,0,107,0,46,0,109,0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,0,146,
+0,158,0,58,0,160,0,161,0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,6,0,77,
+1,170,1,170,0,78,0,1,0,8,0,4,0,160,0,1,0,20,0,12,0,15,0,16,0,17,0,36,0,40,
+0,41,0,42,0,44,0,45,0,76,0,77,0,79,0,83,0,236,0,237,0,243,1,30,1,43,1,44,
+0,1,0,8,0,4,0,50,0,1,0,20,0,12,0,15,0,16,0,17,0,36,0,40,0,41,0,42,0,44,0,
+45,0,76,0,77,0,79,0,83,0,236,0,237,0,243,1,30,1,43,1,44,0,1,0,8,0,4,1,124,
+0,1,0,20,0,12,0,15,0,16,0,17,0,36,0,40,0,41,0,42,0,44,0,45,0,76,0,77,0,79,
+0,83,0,236,0,237,0,243,1,30,1,43,1,44,0,1,0,8,0,4,0,160,0,2,0,23,0,4,0,11,
+0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,0,30,0,11,0,32,0,35,0,24,0,37,0,39,
+0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,0,71,0,33,0,76,0,78,0,39,0,83,0,83,
+0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,0,107,0,46,0,109,0,111,0,51,0,113,
+0,115,0,54,0,128,0,128,0,57,0,146,0,158,0,58,0,160,0,161,0,71,0,163,0,165,
+0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,1,170,0,78,0,1,0,8,0,4,0,180,0,2,
+0,23,0,4,0,11,0,0,0,13,0,14,0,8,0,16,0,16,0,10,0,18,0,30,0,11,0,32,0,35,0,
+24,0,37,0,39,0,28,0,43,0,43,0,31,0,49,0,49,0,32,0,66,0,71,0,33,0,76,0,78,
+0,39,0,83,0,83,0,42,0,87,0,88,0,43,0,96,0,96,0,45,0,103,0,107,0,46,0,109,
+0,111,0,51,0,113,0,115,0,54,0,128,0,128,0,57,0,146,0,158,0,58,0,160,0,161,
+0,71,0,163,0,165,0,73,0,232,0,232,0,76,1,6,1,6,0,77,1,170,1,170,0,78,0,1,
+0,8,0,4,0,50,0,1,0,4,1,198,1,199,2,20,2,21,0,1,0,8,0,4,0,220,0,1,0,2,0,31,
+1,207,0,2,0,14,0,114,0,3,0,0,0,0,1,126,0,2,0,16,0,4,0,38,0,0,0,43,0,43,0,
+35,0,49,0,49,0,36,0,66,0,71,0,37,0,76,0,79,0,43,0,83,0,83,0,47,0,87,0,88,
+0,48,0,96,0,98,0,50,0,103,0,115,0,53,0,128,0,128,0,66,0,146,0,161,0,67,0,
+163,0,165,0,83,0,231,0,233,0,86,0,238,0,238,0,89,1,6,1,6,0,90,1,170,1,170,
+0,91,0,2,0,44,0,4,0,38,0,2,0,42,0,42,0,5,0,43,0,43,0,2,0,45,0,45,0,5,0,47,
+0,47,0,5,0,49,0,49,0,2,0,66,0,71,0,2,0,76,0,79,0,2,0,83,0,83,0,2,0,87,0,88,
+0,2,0,96,0,98,0,2,0,99,0,99,0,4,0,100,0,101,0,3,0,102,0,102,0,4,0,103,0,115,
+0,2,0,119,0,120,0,3,0,128,0,128,0,2,0,146,0,161,0,2,0,163,0,165,0,2,0,172,
+0,172,0,5,0,174,0,174,0,1,0,180,0,180,0,4,0,181,0,183,0,3,0,184,0,188,0,4,
+0,189,0,189,0,3,0,190,0,192,0,4,0,193,0,193,0,3,0,194,0,208,0,5,0,231,0,233,
+0,2,0,238,0,238,0,2,1,6,1,6,0,2,1,151,1,152,0,3,1,155,1,159,0,3,1,163,1,163,
+0,3,1,170,1,170,0,2,1,172,1,172,0,3,1,173,1,173,0,4,1,187,1,190,0,5,1,214,
+1,219,0,5,1,222,1,228,0,5,1,231,1,251,0,5,1,253,2,0,0,5,2,2,2,13,0,5,2,24,
+2,24,0,5,0,3,0,8,0,22,0,36,0,4,0,1,0,1,0,2,0,3,0,1,0,29,0,4,0,1,0,1,0,2,0,
+4,0,1,0,30,0,3,0,1,0,1,0,5,0,1,0,30,0,1,0,8,0,4,1,194,0,1,0,1,0,174,0,1,0,
+8,0,4,2,68,0,1,0,1,0,174,0,1,0,12,0,82,0,1,1,16,1,166,0,2,0,11,0,99,0,102,
+0,0,0,119,0,120,0,4,0,143,0,143,0,6,0,175,0,177,0,7,0,180,0,193,0,10,1,151,
+1,152,0,24,1,155,1,159,0,26,1,163,1,163,0,31,1,168,1,169,0,32,1,172,1,173,
+0,34,1,208,1,208,0,36,0,2,0,31,0,4,0,41,0,0,0,43,0,44,0,38,0,49,0,49,0,40,
+0,64,0,64,0,41,0,66,0,71,0,42,0,76,0,79,0,48,0,83,0,88,0,52,0,96,0,98,0,58,
+0,103,0,115,0,61,0,117,0,117,0,74,0,128,0,128,0,75,0,146,0,161,0,76,0,163,
+0,165,0,92,0,228,0,228,0,95,0,231,0,233,0,96,0,236,0,238,0,99,0,243,0,244,
+0,102,0,249,0,251,0,104,1,6,1,6,0,107,1,21,1,21,0,108,1,30,1,30,0,109,1,43,
+1,44,0,110,1,145,1,150,0,112,1,164,1,164,0,118,1,170,1,170,0,119,1,207,1,
+207,0,120,1,209,1,209,0,121,1,229,1,230,0,122,1,252,1,252,0,124,2,14,2,15,
+0,125,2,25,2,27,0,127,0,37,0,0,2,162,0,0,2,90,0,0,2,34,0,0,2,42,0,0,2,138,
+0,0,2,98,0,0,2,50,0,0,2,106,0,0,2,58,0,0,2,114,0,0,1,156,0,0,1,172,0,0,2,
+178,0,0,1,220,0,0,2,186,0,0,1,204,0,0,1,188,0,0,1,196,0,0,2,170,0,0,1,228,
+0,0,2,4,0,0,2,146,0,0,2,154,0,0,1,180,0,0,2,74,0,0,2,130,0,0,2,10,0,0,1,252,
+0,0,2,18,0,0,2,122,0,0,2,82,0,0,2,66,0,0,1,236,0,0,2,26,0,0,1,164,0,0,1,212,
+0,0,1,244,0,130,5,74,2,194,3,170,5,210,4,66,4,74,5,10,4,50,2,242,3,194,5,
+162,3,74,3,66,3,210,3,162,5,242,5,58,5,82,2,226,4,82,2,162,4,10,2,218,4,26,
+4,250,4,34,5,218,2,170,5,234,4,58,5,194,5,130,3,226,4,202,5,26,4,234,3,130,
+3,234,2,234,4,162,6,42,2,186,3,178,4,18,3,202,3,242,4,138,4,130,2,210,4,114,
+4,98,3,98,3,58,2,142,4,2,2,148,3,146,2,250,6,34,4,242,5,34,3,154,2,202,3,
+138,5,66,5,178,5,42,4,218,5,50,5,170,4,210,4,146,5,202,3,2,2,128,4,42,5,18,
+5,98,4,186,5,186,5,122,4,226,5,90,5,106,5,2,5,146,5,138,4,122,6,18,4,194,
+5,226,4,170,5,114,6,26,4,178,3,186,3,50,5,154,3,218,3,90,4,106,4,90,3,250,
+3,106,6,10,5,250,6,2,4,154,3,10,3,114,3,122,3,82,2,64,2,56,2,104,2,80,2,134,
+2,120,2,44,2,154,3,18,2,50,2,96,2,88,2,112,2,178,3,26,3,34,3,42,2,72,0,2,
+252,107,4,217,0,25,0,2,253,1,4,217,0,39,0,2,253,1,4,217,0,50,0,2,253,61,4,
+217,0,30,0,2,253,71,4,217,0,70,0,2,253,71,4,217,0,85,0,2,253,71,4,217,0,96,
+0,2,253,71,4,217,0,111,0,2,253,88,4,217,0,42,0,2,253,88,4,217,0,42,0,2,253,
+101,4,217,0,24,0,2,253,101,4,217,0,39,0,2,253,111,4,217,0,48,0,1,253,121,
+4,217,0,2,253,141,4,177,0,4,0,2,253,141,4,177,0,4,0,2,253,141,4,217,0,4,0,
+2,253,141,4,217,0,6,0,2,253,141,4,217,0,6,0,2,253,141,4,217,0,16,0,2,253,
+141,4,217,0,19,0,2,253,141,4,217,0,20,0,2,253,141,4,217,0,24,0,2,253,141,
+4,217,0,25,0,2,253,141,4,217,0,26,0,2,253,141,4,217,0,28,0,2,253,141,4,217,
+0,32,0,2,253,141,4,217,0,33,0,2,253,141,4,217,0,38,0,2,253,141,4,217,0,40,
+0,2,253,141,4,217,0,41,0,2,253,141,4,217,0,57,0,2,253,141,4,217,0,72,0,2,
+253,141,5,71,0,48,0,2,253,201,4,217,0,93,0,2,254,95,4,217,0,43,0,2,254,95,
+4,217,0,43,0,1,1,4,4,217,0,1,1,4,4,217,0,2,1,4,4,217,0,6,0,2,1,4,4,217,0,
+13,0,2,1,4,4,217,0,13,0,2,1,4,4,217,0,32,0,2,1,4,4,217,0,35,0,2,1,4,4,217,
+0,41,0,2,1,4,4,217,0,44,0,2,1,33,4,217,0,6,0,2,1,36,4,217,0,26,0,1,1,54,4,
+217,0,2,1,87,7,216,0,20,0,1,1,156,4,217,0,1,1,156,4,217,0,2,2,96,4,132,0,
+129,0,2,2,116,4,217,0,57,0,2,2,147,4,217,0,39,0,2,2,147,4,217,0,39,0,2,2,
+156,4,217,0,31,0,2,2,156,4,217,0,39,0,2,2,156,4,217,0,53,0,2,2,156,4,217,
+0,64,0,2,2,157,4,217,0,40,0,2,2,157,4,217,0,47,0,2,2,157,4,217,0,56,0,2,2,
+157,4,217,0,62,0,2,2,158,4,217,0,32,0,2,2,158,4,217,0,34,0,2,2,158,4,217,
+0,35,0,2,2,158,4,217,0,35,0,2,2,158,4,217,0,35,0,2,2,158,4,217,0,35,0,2,2,
+158,4,217,0,35,0,2,2,158,4,217,0,39,0,2,2,158,4,217,0,41,0,2,2,158,4,217,
+0,57,0,2,2,158,4,217,0,64,0,2,2,158,4,217,0,67,0,2,2,158,4,217,0,71,0,2,2,
+158,4,217,0,72,0,2,2,158,4,217,0,78,0,2,2,158,4,217,0,84,0,2,2,158,4,217,
+0,90,0,2,2,158,4,217,0,98,0,2,2,164,4,217,0,55,0,2,2,166,4,217,0,29,0,2,2,
+166,4,217,0,41,0,2,2,167,4,217,0,44,0,2,2,168,4,217,0,27,0,2,2,168,4,217,
+0,27,0,2,2,168,4,217,0,44,0,2,2,168,4,217,0,45,0,2,2,168,4,217,0,46,0,2,2,
+168,4,217,0,50,0,2,2,168,4,217,0,52,0,2,2,168,4,217,0,58,0,2,2,168,4,217,
+0,58,0,2,2,168,4,217,0,62,0,2,2,168,4,217,0,91,0,2,2,170,4,217,0,32,0,2,2,
+173,4,217,0,26,0,2,2,173,4,217,0,26,0,2,2,173,4,217,0,42,0,2,2,174,4,217,
+0,41,0,2,2,176,4,217,0,44,0,2,2,176,4,217,0,58,0,2,2,178,4,217,0,25,0,2,2,
+178,4,217,0,26,0,2,2,178,4,217,0,43,0,2,2,178,4,217,0,44,0,2,2,178,4,217,
+0,47,0,2,2,178,4,217,0,50,0,2,2,178,4,217,0,68,0,2,2,178,4,217,0,76,0,2,2,
+182,4,217,0,55,0,2,2,183,4,217,0,54,0,2,2,187,4,217,0,40,0,2,2,188,4,217,
+0,38,0,2,2,196,4,217,0,60,0,2,2,219,4,217,0,65,0,2,4,111,4,217,0,40,0,2,4,
+158,4,217,0,39,0,2,4,159,4,217,0,46,0,2,5,65,4,217,0,67,0,2,5,190,4,217,0,
+78,0,2,6,49,4,217,0,88,0,2,6,54,4,217,0,58,0,2,6,54,4,217,0,58,0,2,6,54,4,
+217,0,87,0,2,6,55,4,217,0,60,0,2,6,63,4,217,0,54,0,2,6,64,4,217,0,70,0,2,
+6,73,4,217,0,72,0,2,6,74,4,217,0,59,0,2,6,74,4,217,0,69,0,2,6,74,4,217,0,
+75,0,2,6,75,4,217,0,60,0,2,6,83,4,217,0,80,0,2,6,84,4,217,0,51,0,2,6,84,4,
+217,0,52,0,2,6,84,4,217,0,53,0,2,6,84,4,217,0,54,0,2,6,84,4,217,0,63,0,2,
+6,84,4,217,0,65,0,2,6,84,4,217,0,66,0,2,6,84,4,217,0,67,0,2,6,85,4,217,0,
+48,0,2,6,85,4,217,0,53,0,2,6,94,4,217,0,56,0,2,6,94,4,217,0,68,0,2,6,94,4,
+217,0,68,0,2,6,94,4,217,0,71,0,2,6,94,4,217,0,84,0,2,6,95,4,217,0,57,0,2,
+6,96,4,217,0,81,0,2,6,103,4,217,0,54,0,2,6,103,4,217,0,68,0,2,6,114,4,217,
+0,71,0,2,6,124,4,217,0,53,0,2,6,124,4,217,0,54,0,2,6,135,4,217,0,46,0,2,7,
+112,4,217,0,95,0,2,7,112,4,217,0,95,0,2,7,112,4,217,0,95,0,2,7,112,4,217,
+0,123,0,2,7,132,4,217,0,83,0,2,7,160,4,217,0,80,0,2,7,161,4,217,0,75,0,2,
+10,20,4,217,0,80,0,1,0,12,0,154,0,1,1,58,2,196,0,2,0,23,0,211,0,212,0,0,0,
+217,0,218,0,2,0,223,0,224,0,4,0,229,0,230,0,6,0,234,0,235,0,8,0,239,0,242,
+0,10,0,245,0,246,0,14,0,252,1,1,0,16,1,15,1,16,0,22,1,19,1,20,0,24,1,24,1,
+29,0,26,1,31,1,36,0,32,1,39,1,40,0,38,1,68,1,73,0,40,1,80,1,93,0,46,1,96,
+1,97,0,60,1,102,1,105,0,62,1,108,1,123,0,66,1,126,1,131,0,82,1,134,1,137,
+0,88,1,140,1,141,0,92,1,184,1,185,0,94,1,212,1,213,0,96,0,2,0,26,0,4,0,23,
+0,0,0,25,0,39,0,20,0,43,0,43,0,35,0,49,0,49,0,36,0,66,0,71,0,37,0,76,0,79,
+0,43,0,83,0,83,0,47,0,87,0,88,0,48,0,96,0,98,0,50,0,103,0,115,0,53,0,128,
+0,128,0,66,0,146,0,161,0,67,0,163,0,165,0,83,0,172,0,172,0,86,0,174,0,174,
+0,87,0,231,0,233,0,88,0,236,0,236,0,91,0,238,0,238,0,92,0,243,0,243,0,93,
+1,6,1,6,0,94,1,21,1,21,0,95,1,149,1,150,0,96,1,170,1,170,0,98,1,207,1,207,
+0,99,2,14,2,15,0,100,2,25,2,26,0,102,0,98,0,0,2,212,0,0,2,220,0,0,4,76,0,
+0,4,20,0,0,4,84,0,0,4,28,0,0,2,116,0,0,2,108,0,0,4,124,0,0,4,52,0,0,3,188,
+0,0,3,132,0,0,3,108,0,0,2,244,0,0,2,124,0,0,2,132,0,0,5,92,0,0,5,100,0,0,
+2,164,0,0,2,172,0,0,2,252,0,0,2,180,0,0,3,52,0,0,3,4,0,0,3,12,0,0,2,228,0,
+0,2,148,0,0,2,140,0,0,3,60,0,0,3,20,0,0,3,68,0,0,3,28,0,0,3,156,0,0,3,116,
+0,0,5,68,0,0,4,156,0,0,4,92,0,0,4,12,0,0,5,28,0,0,4,252,0,0,4,188,0,0,4,132,
+0,0,3,164,0,0,3,140,0,0,4,196,0,0,4,116,0,0,3,36,0,0,2,188,0,0,3,220,0,0,
+3,92,0,0,3,76,0,0,3,44,0,0,3,228,0,0,3,100,0,0,5,20,0,0,4,204,0,0,5,52,0,
+0,4,212,0,0,5,76,0,0,5,36,0,0,4,100,0,0,3,236,0,0,4,36,0,0,3,148,0,0,4,60,
+0,0,3,204,0,0,5,12,0,0,4,164,0,0,2,196,0,0,2,204,0,0,3,84,0,0,2,236,0,0,3,
+244,0,0,3,252,0,0,3,212,0,0,3,196,0,0,4,228,0,0,4,68,0,0,4,108,0,0,4,140,
+0,0,3,124,0,0,3,172,0,0,4,172,0,0,4,220,0,0,4,44,0,0,4,4,0,0,3,180,0,0,2,
+156,0,0,5,84,0,0,5,60,0,0,5,4,0,0,4,236,0,0,4,180,0,0,4,148,0,0,4,244,0,0,
+2,92,0,0,2,100,0,0,5,44,0,104,6,138,4,130,4,250,6,58,5,26,5,66,5,210,5,130,
+3,242,6,194,6,66,4,10,4,202,4,34,5,34,6,218,6,130,6,98,4,138,5,18,5,50,5,
+10,5,90,5,218,5,82,6,50,4,82,5,250,4,242,5,202,6,146,4,98,5,194,6,114,5,226,
+4,178,6,250,5,2,5,58,5,98,5,42,5,74,5,138,4,218,3,234,4,234,4,170,3,226,4,
+210,6,202,6,226,4,162,4,146,5,114,4,154,4,194,6,10,6,154,7,10,6,26,5,242,
+6,178,4,106,5,106,5,234,6,234,5,122,6,106,6,162,5,154,6,186,6,74,7,18,6,34,
+6,2,6,42,6,90,6,82,5,146,6,210,7,2,6,18,5,170,6,170,6,122,5,162,7,26,4,2,
+5,178,6,242,5,186,4,186,4,18,4,226,4,122,4,42,3,250,4,26,4,114,4,50,4,90,
+4,58,4,66,4,74,0,2,252,169,0,0,0,74,0,2,252,169,0,0,0,78,0,2,253,113,0,0,
+0,44,0,2,253,113,0,0,0,45,0,2,253,113,0,0,0,45,0,2,253,113,0,0,0,45,0,2,253,
+113,0,0,0,45,0,2,253,113,0,0,0,47,0,2,253,113,0,0,0,49,0,2,253,113,0,0,0,
+51,0,2,253,113,0,0,0,51,0,2,253,113,0,0,0,51,0,2,253,113,0,0,0,51,0,2,253,
+113,0,0,0,51,0,2,253,113,0,0,0,51,0,2,253,113,0,0,0,52,0,2,253,113,0,0,0,
+52,0,2,253,113,0,0,0,52,0,2,253,113,0,0,0,52,0,2,253,113,0,0,0,53,0,2,253,
+113,0,0,0,53,0,2,253,113,0,0,0,53,0,2,253,113,0,0,0,53,0,2,253,113,0,0,0,
+53,0,2,253,113,0,0,0,53,0,2,253,113,0,0,0,53,0,2,253,113,0,0,0,53,0,2,253,
+113,0,0,0,54,0,2,253,113,0,0,0,54,0,2,253,113,0,0,0,54,0,2,253,113,0,0,0,
+54,0,2,253,113,0,0,0,54,0,2,253,113,0,0,0,55,0,2,253,113,0,0,0,55,0,2,253,
+113,0,0,0,56,0,2,253,113,0,0,0,56,0,2,253,113,0,0,0,56,0,2,253,113,0,0,0,
+57,0,2,253,113,0,0,0,57,0,2,253,113,0,0,0,57,0,2,253,113,0,0,0,58,0,2,253,
+113,0,0,0,58,0,2,253,113,0,0,0,59,0,2,253,113,0,0,0,59,0,2,253,113,0,0,0,
+60,0,2,253,113,0,0,0,60,0,2,253,113,0,0,0,61,0,2,253,113,0,0,0,61,0,2,253,
+113,0,0,0,63,0,2,253,113,0,0,0,63,0,2,253,113,0,0,0,63,0,2,253,113,0,0,0,
+63,0,2,253,113,0,0,0,63,0,2,253,113,0,0,0,63,0,2,253,113,0,0,0,64,0,2,253,
+113,0,0,0,65,0,2,253,113,0,0,0,65,0,2,253,113,0,0,0,65,0,2,253,113,0,0,0,
+66,0,2,253,113,0,0,0,67,0,2,253,113,0,0,0,67,0,2,253,113,0,0,0,67,0,2,253,
+113,0,0,0,68,0,2,253,113,0,0,0,68,0,2,253,113,0,0,0,68,0,2,253,113,0,0,0,
+68,0,2,253,113,0,0,0,68,0,2,253,113,0,0,0,69,0,2,253,113,0,0,0,70,0,2,253,
+113,0,0,0,71,0,2,253,113,0,0,0,71,0,2,253,113,0,0,0,71,0,2,253,113,0,0,0,
+73,0,2,253,113,0,0,0,73,0,2,253,113,0,0,0,73,0,2,253,113,0,0,0,73,0,2,253,
+113,0,0,0,74,0,2,253,113,0,0,0,74,0,2,253,113,0,0,0,74,0,2,253,113,0,0,0,
+74,0,2,253,113,0,0,0,74,0,2,253,113,0,0,0,75,0,2,253,113,0,0,0,75,0,2,253,
+113,0,0,0,75,0,2,253,113,0,0,0,76,0,2,253,113,0,0,0,76,0,2,253,113,0,0,0,
+77,0,2,253,113,0,0,0,78,0,2,253,113,0,0,0,79,0,2,253,113,0,0,0,79,0,2,253,
+113,0,0,0,79,0,2,253,113,0,0,0,81,0,2,253,113,0,0,0,82,0,2,253,113,0,0,0,
+83,0,2,253,113,0,0,0,85,0,2,253,113,0,0,0,85,0,2,253,113,0,0,0,91,0,2,253,
+113,0,0,0,91,0,2,0,73,255,206,0,42,0,2,0,143,255,206,0,77,0,2,0,213,255,206,
+0,61,0,2,1,23,0,0,0,19,0,2,1,33,0,0,0,34,0,2,1,94,253,138,0,65,0,2,1,96,254,
+182,0,45,0,2,1,97,0,0,0,27,0,2,1,114,254,182,0,49,0,2,1,114,255,206,0,36,
+0,2,1,114,255,206,0,36,0,2,1,114,255,206,0,36,0,2,1,114,255,206,0,36,0,2,
+1,114,255,206,0,36,0,2,1,114,255,206,0,38,0,2,1,114,255,206,0,38,0,2,2,28,
+254,173,0,61,0,2,2,44,255,255,0,89,0,2,2,96,0,0,0,130,0,2,2,124,0,0,0,61,
+0,2,2,135,0,0,0,40,0,2,2,140,0,0,0,48,0,2,2,143,0,0,0,76,0,2,2,147,0,0,0,
+54,0,2,2,153,0,0,0,61,0,2,2,156,252,68,0,71,0,2,2,156,0,0,0,55,0,2,2,158,
+252,68,0,73,0,2,2,160,0,0,0,56,0,2,2,162,252,48,0,56,0,2,2,165,0,0,0,28,0,
+2,2,168,252,54,0,63,0,2,2,168,252,68,0,92,0,2,2,169,0,0,0,51,0,2,2,170,0,
+0,0,26,0,2,2,170,0,0,0,28,0,2,2,170,0,0,0,28,0,2,2,170,0,0,0,41,0,2,2,170,
+0,0,0,45,0,2,2,172,0,0,0,27,0,2,2,173,0,0,0,45,0,2,2,174,0,0,0,63,0,2,2,176,
+0,0,0,27,0,2,2,176,0,0,0,27,0,2,2,176,0,0,0,44,0,2,2,180,0,0,0,41,0,2,2,180,
+0,0,0,42,0,2,2,180,0,0,0,43,0,2,2,180,0,0,0,47,0,2,2,186,0,0,0,39,0,2,2,186,
+0,0,0,42,0,2,2,186,0,0,0,45,0,2,2,194,0,0,0,59,0,2,2,196,0,0,0,55,0,2,2,202,
+0,0,0,56,0,2,3,80,0,0,0,45,0,2,3,129,0,0,0,40,0,2,3,155,0,0,0,39,0,2,4,26,
+0,0,0,37,0,2,4,56,254,182,0,51,0,2,4,82,0,0,0,77,0,2,4,90,0,0,0,55,0,2,4,
+92,0,0,0,73,0,2,4,94,0,0,0,55,0,2,4,100,252,184,0,86,0,2,4,100,0,0,0,69,0,
+2,4,108,0,0,0,81,0,2,4,112,0,0,0,47,0,2,4,116,0,0,0,67,0,2,4,121,0,0,0,53,
+0,2,4,121,0,0,0,53,0,2,4,121,0,0,0,59,0,2,4,121,0,0,0,64,0,2,4,121,0,0,0,
+71,0,2,4,122,0,0,0,54,0,2,4,124,0,0,0,72,0,2,4,125,0,0,0,70,0,2,4,126,0,0,
+0,49,0,2,4,126,0,0,0,57,0,2,4,126,0,0,0,69,0,2,4,131,0,0,0,55,0,2,4,131,0,
+0,0,60,0,2,4,133,0,0,0,70,0,2,4,133,0,0,0,81,0,2,4,141,0,0,0,52,0,2,4,141,
+0,0,0,54,0,2,4,141,0,0,0,54,0,2,4,141,0,0,0,58,0,2,4,141,0,0,0,66,0,2,4,141,
+0,0,0,68,0,2,4,141,0,0,0,85,0,2,4,161,0,0,0,80,0,2,4,186,0,0,0,44,0,2,4,220,
+0,0,0,31,0,2,4,250,0,0,0,82,0,2,4,250,0,0,0,94,0,2,4,254,0,0,0,76,0,2,5,65,
+0,0,0,32,0,2,5,222,0,0,0,66,0,2,6,50,0,0,0,81,0,2,6,235,0,0,0,68,0,2,8,76,
+0,0,0,58,0,2,8,76,0,0,0,59,0,2,10,53,0,0,0,84,0,1,0,12,0,232,0,1,1,136,3,
+74,0,2,0,36,0,48,0,48,0,0,0,74,0,75,0,1,0,80,0,82,0,3,0,116,0,116,0,6,0,127,
+0,127,0,7,0,178,0,179,0,8,0,209,0,209,0,10,0,213,0,216,0,11,0,219,0,222,0,
+15,0,225,0,226,0,19,0,247,0,248,0,21,1,2,1,5,0,23,1,7,1,14,0,27,1,17,1,18,
+0,35,1,22,1,23,0,37,1,37,1,38,0,39,1,41,1,42,0,41,1,45,1,67,0,43,1,74,1,79,
+0,66,1,94,1,95,0,72,1,98,1,101,0,74,1,106,1,107,0,78,1,124,1,125,0,80,1,132,
+1,133,0,82,1,138,1,139,0,84,1,142,1,142,0,86,1,144,1,144,0,87,1,153,1,153,
+0,88,1,160,1,160,0,89,1,162,1,162,0,90,1,165,1,167,0,91,1,174,1,180,0,94,
+1,194,1,197,0,101,1,200,1,202,0,105,1,210,1,211,0,108,1,220,1,221,0,110,0,
+2,0,26,0,4,0,39,0,0,0,43,0,43,0,36,0,49,0,49,0,37,0,66,0,71,0,38,0,76,0,79,
+0,44,0,83,0,98,0,48,0,103,0,115,0,64,0,128,0,128,0,77,0,146,0,161,0,78,0,
+163,0,165,0,94,0,172,0,172,0,97,0,174,0,174,0,98,0,228,0,228,0,99,0,231,0,
+233,0,100,0,236,0,238,0,103,0,243,0,244,0,106,0,249,0,251,0,108,1,6,1,6,0,
+111,1,21,1,21,0,112,1,30,1,30,0,113,1,43,1,44,0,114,1,149,1,150,0,116,1,170,
+1,170,0,118,1,207,1,207,0,119,2,14,2,15,0,120,2,25,2,26,0,122,0,112,0,0,3,
+52,0,0,3,100,0,0,3,108,0,0,5,244,0,0,6,12,0,0,3,4,0,0,6,36,0,0,2,252,0,0,
+3,132,0,0,2,220,0,0,3,116,0,0,4,116,0,0,4,44,0,0,3,180,0,0,3,148,0,0,3,188,
+0,0,3,156,0,0,4,124,0,0,4,92,0,0,5,156,0,0,5,124,0,0,4,244,0,0,4,100,0,0,
+5,28,0,0,5,12,0,0,4,188,0,0,4,52,0,0,5,132,0,0,5,36,0,0,3,196,0,0,3,164,0,
+0,4,164,0,0,4,60,0,0,4,220,0,0,4,196,0,0,5,20,0,0,4,132,0,0,4,228,0,0,3,252,
+0,0,5,108,0,0,5,68,0,0,5,84,0,0,4,140,0,0,5,92,0,0,4,148,0,0,4,204,0,0,4,
+156,0,0,5,148,0,0,5,52,0,0,4,28,0,0,3,220,0,0,5,188,0,0,5,172,0,0,5,60,0,
+0,4,68,0,0,5,180,0,0,5,164,0,0,5,196,0,0,5,236,0,0,3,12,0,0,4,252,0,0,4,12,
+0,0,3,204,0,0,3,172,0,0,3,228,0,0,3,212,0,0,4,236,0,0,2,236,0,0,5,140,0,0,
+5,44,0,0,5,116,0,0,5,76,0,0,4,172,0,0,4,108,0,0,4,4,0,0,3,236,0,0,4,212,0,
+0,4,76,0,0,5,4,0,0,4,180,0,0,3,20,0,0,5,100,0,0,4,36,0,0,4,20,0,0,4,84,0,
+0,3,244,0,0,3,124,0,0,3,36,0,0,2,244,0,0,3,28,0,0,5,228,0,0,3,68,0,0,5,204,
+0,0,2,196,0,0,3,44,0,0,3,60,0,0,3,140,0,0,2,228,0,0,5,212,0,0,6,20,0,0,6,
+44,0,0,3,76,0,0,5,220,0,0,6,28,0,0,6,52,0,0,2,188,0,0,5,252,0,0,2,204,0,0,
+6,4,0,0,2,212,0,0,3,84,0,0,3,92,0,124,7,122,5,98,6,10,7,154,5,234,6,34,7,
+58,6,130,4,170,7,226,7,26,5,58,5,178,5,82,6,42,8,34,8,2,7,66,5,114,6,50,6,
+210,5,250,6,26,6,82,7,98,6,74,7,130,5,34,7,250,5,242,7,34,7,242,6,162,7,18,
+7,162,7,10,5,130,8,82,6,18,6,2,6,106,6,66,6,114,6,138,5,218,4,146,6,58,5,
+194,4,122,4,194,6,194,4,202,5,210,6,234,4,186,4,218,4,210,4,178,5,74,4,234,
+4,226,8,50,5,138,5,106,6,122,5,122,5,170,7,114,7,178,8,66,7,186,7,106,7,202,
+5,10,6,90,7,74,6,242,6,98,7,138,7,146,6,226,8,10,7,170,8,58,7,210,7,50,7,
+194,7,90,7,82,6,146,8,26,8,18,7,234,6,202,7,218,8,42,6,218,8,74,4,138,6,154,
+6,178,7,42,6,186,5,154,5,146,5,66,5,186,5,162,6,170,7,2,6,250,5,90,5,18,5,
+226,5,202,4,154,4,130,4,162,5,50,4,242,5,42,4,250,5,2,5,26,0,2,253,19,255,
+206,0,7,0,2,253,19,255,249,0,6,0,2,253,43,255,206,0,11,0,2,253,43,255,206,
+0,11,0,2,253,43,255,206,0,16,0,2,253,43,255,206,0,16,0,2,253,73,0,0,0,37,
+0,2,253,75,0,0,0,6,0,2,253,76,255,206,0,4,0,2,253,82,255,206,0,6,0,2,253,
+82,0,0,0,6,0,2,253,93,0,0,0,56,0,2,253,98,255,206,0,24,0,2,253,99,255,206,
+0,36,0,2,253,99,255,206,0,36,0,2,253,102,255,206,0,24,0,2,253,102,255,206,
+0,24,0,2,253,102,255,206,0,28,0,2,253,102,255,206,0,28,0,2,253,102,255,206,
+0,33,0,2,253,102,255,206,0,33,0,2,253,102,255,206,0,38,0,2,253,102,255,206,
+0,52,0,2,253,104,255,206,0,6,0,2,253,109,255,206,0,10,0,2,253,109,255,206,
+0,12,0,2,253,109,255,206,0,12,0,2,253,113,0,0,0,26,0,2,253,113,0,0,0,26,0,
+2,253,113,0,0,0,26,0,2,253,113,0,0,0,26,0,2,253,113,0,0,0,27,0,2,253,113,
+0,0,0,27,0,2,253,113,0,0,0,27,0,2,253,113,0,0,0,27,0,2,253,113,0,0,0,31,0,
+2,253,113,0,0,0,32,0,2,253,113,0,0,0,32,0,2,253,113,0,0,0,32,0,2,253,113,
+0,0,0,32,0,2,253,113,0,0,0,33,0,2,253,113,0,0,0,33,0,2,253,113,0,0,0,34,0,
+2,253,113,0,0,0,34,0,2,253,113,0,0,0,35,0,2,253,113,0,0,0,35,0,2,253,113,
+0,0,0,36,0,2,253,113,0,0,0,36,0,2,253,113,0,0,0,36,0,2,253,113,0,0,0,36,0,
+2,253,113,0,0,0,36,0,2,253,113,0,0,0,36,0,2,253,113,0,0,0,37,0,2,253,113,
+0,0,0,37,0,2,253,113,0,0,0,37,0,2,253,113,0,0,0,38,0,2,253,113,0,0,0,38,0,
+2,253,113,0,0,0,38,0,2,253,113,0,0,0,38,0,2,253,113,0,0,0,38,0,2,253,113,
+0,0,0,38,0,2,253,113,0,0,0,39,0,2,253,113,0,0,0,40,0,2,253,113,0,0,0,40,0,
+2,253,113,0,0,0,41,0,2,253,113,0,0,0,41,0,2,253,113,0,0,0,41,0,2,253,113,
+0,0,0,41,0,2,253,113,0,0,0,42,0,2,253,113,0,0,0,42,0,2,253,113,0,0,0,43,0,
+2,253,113,0,0,0,44,0,2,253,113,0,0,0,44,0,2,253,113,0,0,0,44,0,2,253,113,
+0,0,0,45,0,2,253,113,0,0,0,45,0,2,253,113,0,0,0,48,0,2,253,113,0,0,0,48,0,
+2,253,113,0,0,0,48,0,2,253,113,0,0,0,49,0,2,253,113,0,0,0,49,0,2,253,113,
+0,0,0,50,0,2,253,113,0,0,0,50,0,2,253,113,0,0,0,51,0,2,253,113,0,0,0,51,0,
+2,253,113,0,0,0,51,0,2,253,113,0,0,0,52,0,2,253,113,0,0,0,54,0,2,253,113,
+0,0,0,55,0,2,253,113,0,0,0,55,0,2,253,113,0,0,0,55,0,2,253,113,0,0,0,56,0,
+2,253,113,0,0,0,58,0,2,253,113,0,0,0,68,0,2,253,113,0,0,0,74,0,2,253,113,
+0,0,0,76,0,2,253,113,0,0,0,77,0,2,253,115,0,0,0,30,0,2,253,119,255,206,0,
+6,0,2,253,119,255,206,0,6,0,2,253,119,255,206,0,6,0,2,253,119,0,0,0,12,0,
+2,253,123,0,0,0,24,0,2,253,133,255,206,0,29,0,2,253,134,255,206,0,15,0,2,
+253,134,255,206,0,15,0,2,253,135,255,206,0,26,0,2,253,219,255,206,0,35,0,
+2,253,219,255,206,0,35,0,2,254,18,255,206,0,20,0,2,254,125,255,206,0,31,0,
+2,254,125,255,206,0,31,0,2,1,9,255,206,0,43,0,2,1,23,255,206,0,21,0,2,1,31,
+255,206,0,35,0,2,1,79,255,206,0,78,0,2,1,96,254,166,0,68,0,2,1,97,255,206,
+0,28,0,2,1,129,255,206,0,63,0,2,1,139,255,206,0,16,0,2,1,139,255,206,0,27,
+0,2,1,156,0,0,0,6,0,2,1,156,0,0,0,8,0,2,1,166,255,206,0,40,0,2,1,168,0,0,
+0,30,0,2,1,188,255,206,0,40,0,2,1,238,255,206,0,16,0,2,2,28,255,206,0,37,
+0,2,2,28,255,206,0,37,0,2,2,28,255,206,0,37,0,2,2,43,255,206,0,87,0,2,2,68,
+255,206,0,37,0,2,2,68,255,206,0,37,0,2,2,68,255,206,0,40,0,2,2,68,255,206,
+0,40,0,2,2,96,255,206,0,128,0,2,2,98,253,138,0,63,0,2,2,100,254,182,0,46,
+0,2,2,112,0,0,0,16,0,2,2,118,254,182,0,51,0,2,2,126,255,206,0,62,0,2,2,134,
+255,206,0,41,0,2,2,138,255,206,0,77,0,2,2,140,255,206,0,49,0,2,2,150,255,
+206,0,55,0,2,2,156,255,206,0,57,0,2,2,157,255,206,0,62,0,2,2,158,252,38,0,
+69,0,2,2,158,252,38,0,72,0,2,2,158,252,68,0,79,0,2,2,159,255,206,0,57,0,2,
+2,162,252,18,0,58,0,2,2,162,252,38,0,93,0,2,2,163,252,46,0,73,0,2,2,164,252,
+68,0,91,0,2,2,165,255,206,0,30,0,2,2,169,252,4,0,65,0,2,2,170,252,68,0,85,
+0,2,2,171,255,206,0,28,0,2,2,173,255,206,0,27,0,2,2,173,255,206,0,28,0,2,
+2,173,255,206,0,28,0,2,2,173,255,206,0,29,0,2,2,173,255,206,0,29,0,2,2,173,
+255,206,0,42,0,2,2,173,255,206,0,45,0,2,2,173,255,206,0,46,0,2,2,173,255,
+206,0,46,0,2,2,173,255,206,0,52,0,2,2,173,255,206,0,64,0,2,2,180,255,206,
+0,43,0,2,2,180,255,206,0,44,0,2,2,183,255,206,0,40,0,2,2,183,255,206,0,46,
+0,2,2,183,255,206,0,48,0,2,2,185,255,206,0,42,0,2,2,186,255,206,0,43,0,2,
+2,193,255,206,0,60,0,2,2,196,255,206,0,56,0,2,2,199,255,206,0,57,0,2,2,210,
+255,206,0,45,0,2,2,218,255,102,0,60,0,2,2,248,255,174,0,122,0,2,3,80,255,
+206,0,38,0,2,4,56,254,142,0,53,0,2,4,91,255,206,0,31,0,2,4,104,255,206,0,
+41,0,2,4,145,255,206,0,58,0,2,4,158,255,206,0,41,0,2,4,164,255,206,0,47,0,
+2,4,220,255,206,0,30,0,2,4,221,255,206,0,35,0,2,5,4,252,70,0,143,0,2,5,5,
+252,72,0,154,0,2,5,244,252,38,0,88,0,2,5,248,255,206,0,79,0,2,6,63,255,206,
+0,72,0,2,6,70,255,206,0,56,0,2,6,72,255,206,0,67,0,2,6,72,255,206,0,68,0,
+2,6,72,255,206,0,74,0,2,6,73,255,206,0,56,0,2,6,76,255,206,0,70,0,2,6,82,
+255,206,0,58,0,2,6,82,255,206,0,70,0,2,6,86,255,206,0,56,0,2,6,88,255,206,
+0,82,0,2,6,92,255,206,0,54,0,2,6,92,255,206,0,55,0,2,6,92,255,206,0,55,0,
+2,6,92,255,206,0,61,0,2,6,93,255,206,0,67,0,2,6,95,255,206,0,73,0,2,6,96,
+255,206,0,71,0,2,6,98,255,206,0,50,0,2,6,101,255,206,0,59,0,2,6,103,255,206,
+0,60,0,2,6,103,255,206,0,72,0,2,6,103,255,206,0,86,0,2,6,112,255,206,0,65,
+0,2,6,112,255,206,0,69,0,2,6,113,255,206,0,46,0,2,6,113,255,206,0,55,0,2,
+6,114,255,206,0,55,0,2,6,116,255,206,0,48,0,2,6,116,255,206,0,53,0,2,6,123,
+255,206,0,82,0,2,6,235,255,206,0,69,0,2,7,94,255,206,0,84,0,2,7,126,255,206,
+0,96,0,2,7,170,255,206,0,82,0,2,7,191,255,206,0,77,0,2,8,76,255,196,0,60,
+0,2,8,76,255,206,0,61,0,2,8,156,255,206,0,87,0,2,9,242,255,206,0,82,0,1,0,
+12,0,190,0,1,1,112,2,206,0,1,0,87,0,212,0,214,0,216,0,218,0,220,0,222,0,224,
+0,226,0,230,0,235,0,240,0,242,0,246,0,248,0,253,0,255,1,1,1,3,1,5,1,8,1,10,
+1,12,1,14,1,16,1,18,1,20,1,23,1,25,1,27,1,29,1,32,1,34,1,36,1,38,1,40,1,42,
+1,46,1,48,1,50,1,52,1,54,1,56,1,58,1,59,1,60,1,61,1,63,1,65,1,67,1,69,1,71,
+1,73,1,75,1,77,1,79,1,81,1,83,1,85,1,87,1,89,1,91,1,93,1,95,1,97,1,99,1,101,
+1,103,1,105,1,107,1,109,1,111,1,113,1,115,1,117,1,119,1,121,1,123,1,125,1,
+127,1,129,1,131,1,133,1,135,1,137,1,139,1,141,1,167,0,1,0,87,0,116,0,212,
+0,214,0,216,0,218,0,220,0,222,0,224,0,226,0,230,0,240,0,242,0,246,0,248,0,
+253,0,255,1,1,1,3,1,5,1,8,1,10,1,12,1,14,1,16,1,18,1,20,1,23,1,25,1,27,1,
+29,1,32,1,34,1,36,1,38,1,40,1,42,1,46,1,48,1,50,1,52,1,54,1,56,1,58,1,59,
+1,60,1,61,1,63,1,65,1,67,1,69,1,71,1,73,1,75,1,77,1,79,1,81,1,83,1,85,1,87,
+1,89,1,91,1,93,1,95,1,97,1,99,1,101,1,103,1,105,1,107,1,109,1,111,1,113,1,
+115,1,117,1,119,1,121,1,123,1,125,1,127,1,129,1,131,1,133,1,135,1,137,1,139,
+1,141,1,167,0,87,0,0,5,230,0,0,4,246,0,0,4,150,0,0,6,150,0,0,4,158,0,0,5,
+30,0,0,6,158,0,0,6,38,0,0,5,110,0,0,6,166,0,0,6,70,0,0,5,254,0,0,5,118,0,
+0,5,38,0,0,7,46,0,0,5,190,0,0,5,198,0,0,5,126,0,0,4,254,0,0,5,142,0,0,4,166,
+0,0,5,6,0,0,5,102,0,0,6,6,0,0,5,54,0,0,5,238,0,0,4,222,0,0,5,134,0,0,6,14,
+0,0,6,22,0,0,6,62,0,0,6,222,0,0,6,142,0,0,5,174,0,0,7,22,0,0,5,62,0,0,5,70,
+0,0,5,78,0,0,5,158,0,0,4,198,0,0,6,238,0,0,5,14,0,0,6,182,0,0,4,182,0,0,4,
+142,0,0,4,134,0,0,4,230,0,0,4,174,0,0,4,190,0,0,6,198,0,0,6,78,0,0,6,190,
+0,0,5,86,0,0,5,150,0,0,5,182,0,0,5,206,0,0,6,46,0,0,6,30,0,0,6,54,0,0,6,246,
+0,0,6,254,0,0,7,30,0,0,5,46,0,0,6,118,0,0,4,206,0,0,5,22,0,0,6,86,0,0,6,110,
+0,0,5,94,0,0,6,230,0,0,5,214,0,0,5,246,0,0,6,126,0,0,6,102,0,0,6,174,0,0,
+6,206,0,0,6,94,0,0,5,222,0,0,7,6,0,0,6,134,0,0,5,166,0,0,4,238,0,0,7,38,0,
+0,7,14,0,0,4,214,0,0,6,214,0,0,2,54,0,87,5,216,2,40,1,64,1,0,2,184,1,8,1,
+104,2,192,2,88,1,184,2,120,2,56,1,192,1,112,3,32,2,0,2,8,1,200,1,72,0,232,
+1,16,1,80,1,176,2,64,1,128,2,48,0,208,1,208,2,72,2,80,2,112,2,224,2,176,1,
+240,3,16,1,136,1,144,1,152,1,224,1,40,0,200,1,88,5,240,1,32,0,248,0,240,6,
+8,1,24,6,0,2,208,0,176,0,184,1,160,1,216,1,248,2,16,2,96,6,24,2,104,2,240,
+2,248,0,192,1,120,2,160,5,248,1,96,2,128,2,152,1,168,2,232,2,24,6,16,2,168,
+2,144,2,200,2,216,2,136,2,32,3,0,5,224,1,232,1,56,3,24,3,8,1,48,5,232,0,224,
+0,2,251,85,252,181,0,58,0,2,251,95,252,181,0,70,0,2,251,95,252,181,0,80,0,
+2,251,185,252,181,0,75,0,2,252,59,252,181,0,34,0,2,253,53,0,0,0,7,0,2,253,
+73,252,186,0,8,0,2,253,113,252,127,0,49,0,2,253,113,252,181,0,8,0,2,253,113,
+252,181,0,26,0,2,253,113,252,181,0,27,0,2,253,113,252,181,0,27,0,2,253,113,
+252,181,0,27,0,2,253,113,252,181,0,27,0,2,253,113,252,181,0,32,0,2,253,113,
+252,181,0,33,0,2,253,113,252,181,0,33,0,2,253,113,252,181,0,35,0,2,253,113,
+252,181,0,37,0,2,253,113,252,181,0,37,0,2,253,113,252,181,0,37,0,2,253,113,
+252,181,0,37,0,2,253,113,252,181,0,37,0,2,253,113,252,181,0,38,0,2,253,113,
+252,181,0,38,0,2,253,113,252,181,0,38,0,2,253,113,252,181,0,39,0,2,253,113,
+252,181,0,39,0,2,253,113,252,181,0,39,0,2,253,113,252,181,0,39,0,2,253,113,
+252,181,0,39,0,2,253,113,252,181,0,41,0,2,253,113,252,181,0,42,0,2,253,113,
+252,181,0,45,0,2,253,113,252,181,0,46,0,2,253,113,252,181,0,46,0,2,253,113,
+252,181,0,46,0,2,253,113,252,181,0,49,0,2,253,113,252,181,0,50,0,2,253,113,
+252,181,0,50,0,2,253,113,252,181,0,51,0,2,253,113,252,181,0,51,0,2,253,113,
+252,181,0,52,0,2,253,113,252,181,0,52,0,2,253,113,252,181,0,52,0,2,253,113,
+252,181,0,52,0,2,253,113,252,181,0,52,0,2,253,113,252,181,0,53,0,2,253,113,
+252,181,0,53,0,2,253,113,252,181,0,54,0,2,253,113,252,181,0,54,0,2,253,113,
+252,181,0,54,0,2,253,113,252,181,0,54,0,2,253,113,252,181,0,56,0,2,253,113,
+252,181,0,56,0,2,253,113,252,181,0,56,0,2,253,113,252,181,0,57,0,2,253,113,
+252,181,0,58,0,2,253,113,252,181,0,58,0,2,253,113,252,181,0,60,0,2,253,113,
+252,181,0,61,0,2,253,113,252,181,0,62,0,2,253,113,252,181,0,64,0,2,253,113,
+252,181,0,64,0,2,253,113,252,181,0,65,0,2,253,113,252,181,0,66,0,2,253,113,
+252,181,0,66,0,2,253,113,252,181,0,68,0,2,253,113,252,181,0,72,0,2,253,113,
+252,181,0,72,0,2,253,113,252,181,0,74,0,2,253,113,252,181,0,74,0,2,253,113,
+252,181,0,75,0,2,253,113,252,181,0,75,0,2,253,113,252,181,0,75,0,2,253,113,
+252,181,0,76,0,2,253,113,252,181,0,77,0,2,253,113,252,181,0,83,0,2,253,113,
+252,181,0,92,0,2,253,113,0,0,0,7,0,2,253,113,0,0,0,25,0,2,253,113,0,0,0,26,
+0,2,253,113,0,0,0,26,0,2,253,113,0,0,0,26,0,2,253,113,0,0,0,26,0,2,253,113,
+0,0,0,31,0,2,253,113,0,0,0,31,0,2,253,113,0,0,0,32,0,2,253,113,0,0,0,32,0,
+2,253,113,0,0,0,32,0,2,253,113,0,0,0,33,0,2,253,113,0,0,0,34,0,2,253,113,
+0,0,0,34,0,2,253,113,0,0,0,36,0,2,253,113,0,0,0,36,0,2,253,113,0,0,0,36,0,
+2,253,113,0,0,0,36,0,2,253,113,0,0,0,36,0,2,253,113,0,0,0,37,0,2,253,113,
+0,0,0,37,0,2,253,113,0,0,0,37,0,2,253,113,0,0,0,38,0,2,253,113,0,0,0,38,0,
+2,253,113,0,0,0,38,0,2,253,113,0,0,0,38,0,2,253,113,0,0,0,38,0,2,253,113,
+0,0,0,40,0,2,253,113,0,0,0,41,0,2,253,113,0,0,0,44,0,2,253,113,0,0,0,45,0,
+2,253,113,0,0,0,45,0,2,253,113,0,0,0,45,0,2,253,113,0,0,0,48,0,2,253,113,
+0,0,0,48,0,2,253,113,0,0,0,49,0,2,253,113,0,0,0,49,0,2,253,113,0,0,0,50,0,
+2,253,113,0,0,0,50,0,2,253,113,0,0,0,51,0,2,253,113,0,0,0,51,0,2,253,113,
+0,0,0,51,0,2,253,113,0,0,0,51,0,2,253,113,0,0,0,51,0,2,253,113,0,0,0,52,0,
+2,253,113,0,0,0,52,0,2,253,113,0,0,0,52,0,2,253,113,0,0,0,53,0,2,253,113,
+0,0,0,53,0,2,253,113,0,0,0,53,0,2,253,113,0,0,0,53,0,2,253,113,0,0,0,53,0,
+2,253,113,0,0,0,55,0,2,253,113,0,0,0,55,0,2,253,113,0,0,0,55,0,2,253,113,
+0,0,0,56,0,2,253,113,0,0,0,57,0,2,253,113,0,0,0,57,0,2,253,113,0,0,0,57,0,
+2,253,113,0,0,0,59,0,2,253,113,0,0,0,60,0,2,253,113,0,0,0,61,0,2,253,113,
+0,0,0,63,0,2,253,113,0,0,0,63,0,2,253,113,0,0,0,63,0,2,253,113,0,0,0,64,0,
+2,253,113,0,0,0,65,0,2,253,113,0,0,0,65,0,2,253,113,0,0,0,67,0,2,253,113,
+0,0,0,67,0,2,253,113,0,0,0,68,0,2,253,113,0,0,0,69,0,2,253,113,0,0,0,71,0,
+2,253,113,0,0,0,71,0,2,253,113,0,0,0,71,0,2,253,113,0,0,0,73,0,2,253,113,
+0,0,0,73,0,2,253,113,0,0,0,74,0,2,253,113,0,0,0,74,0,2,253,113,0,0,0,74,0,
+2,253,113,0,0,0,74,0,2,253,113,0,0,0,75,0,2,253,113,0,0,0,76,0,2,253,113,
+0,0,0,79,0,2,253,113,0,0,0,82,0,2,253,113,0,0,0,91,0,2,254,21,252,73,0,21,
+0,2,255,101,252,181,0,64,0,2,255,221,252,181,0,72,0,2,0,75,252,181,0,69,0,
+2,0,105,0,0,0,33,0,2,0,107,0,0,0,32,0,2,0,111,0,0,0,35,0,2,1,119,0,0,0,53,
+0,2,1,121,0,0,0,54,0,0,0,1,0,0,0,10,0,74,0,168,0,1,109,121,109,50,0,8,0,16,
+0,2,75,83,87,32,0,28,77,79,78,32,0,42,0,0,255,255,0,3,0,0,0,1,0,2,0,0,255,
+255,0,4,0,0,0,1,0,2,0,3,0,0,255,255,0,4,0,0,0,1,0,2,0,4,0,5,97,98,118,115,
+0,32,98,108,119,102,0,42,98,108,119,115,0,52,108,111,99,108,0,78,108,111,
+99,108,0,86,0,0,0,3,0,4,0,5,0,6,0,0,0,3,0,7,0,8,0,9,0,0,0,11,0,10,0,12,0,
+13,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,0,0,2,0,0,0,1,0,0,0,2,0,2,0,
+3,0,43,0,88,0,104,0,120,0,136,0,152,0,168,0,184,0,200,0,216,0,232,0,248,1,
+8,1,24,1,40,1,56,1,72,1,88,1,104,1,120,1,136,1,152,1,168,1,184,1,200,1,216,
+1,232,1,248,2,8,2,24,2,40,2,56,2,72,2,88,2,104,2,120,2,136,2,152,2,168,2,
+184,2,200,2,216,2,232,2,248,0,7,2,0,0,1,0,8,0,1,0,1,0,0,2,168,0,7,2,0,0,1,
+0,8,0,1,0,4,0,0,2,170,0,7,0,0,0,1,0,8,0,1,0,4,0,0,2,192,0,7,0,0,0,1,0,8,0,
+1,0,2,0,0,2,230,0,7,0,0,0,1,0,8,0,1,0,4,0,0,3,6,0,7,1,0,0,1,0,8,0,1,0,4,0,
+0,3,62,0,7,1,0,0,1,0,8,0,1,0,5,0,0,3,232,0,7,2,0,0,1,0,8,0,1,0,4,0,0,4,8,
+0,7,0,0,0,1,0,8,0,1,0,4,0,0,4,248,0,7,0,0,0,1,0,8,0,1,0,4,0,0,7,152,0,7,2,
+0,0,1,0,8,0,1,0,5,0,0,8,0,0,7,0,0,0,1,0,8,0,1,0,1,0,0,12,174,0,7,2,0,0,1,
+0,8,0,1,0,5,0,0,14,0,0,7,2,0,0,1,0,8,0,1,0,5,0,0,14,146,0,7,2,2,0,1,0,8,0,
+1,0,4,0,0,15,50,0,7,2,0,0,1,0,8,0,1,0,4,0,0,15,82,0,7,2,0,0,1,0,8,0,1,0,6,
+0,0,15,120,0,7,2,0,0,1,0,8,0,1,0,6,0,0,22,40,0,7,2,0,0,1,0,8,0,1,0,5,0,0,
+27,36,0,7,0,0,0,1,0,8,0,1,0,5,0,0,29,8,0,7,0,0,0,1,0,8,0,1,0,5,0,0,30,84,
+0,7,1,0,0,1,0,8,0,1,0,5,0,0,32,38,0,7,2,0,0,1,0,8,0,1,0,5,0,0,33,192,0,7,
+0,0,0,1,0,8,0,1,0,1,0,0,40,58,0,7,0,0,0,1,0,8,0,1,0,1,0,0,40,76,0,7,0,0,0,
+1,0,8,0,1,0,1,0,0,40,94,0,7,0,0,0,1,0,8,0,1,0,1,0,0,40,96,0,7,0,0,0,1,0,8,
+0,1,0,1,0,0,40,92,0,7,0,0,0,1,0,8,0,1,0,1,0,0,40,88,0,7,0,0,0,1,0,8,0,1,0,
+2,0,0,40,84,0,7,0,0,0,1,0,8,0,1,0,2,0,0,40,150,0,7,0,0,0,1,0,8,0,1,0,2,0,
+0,41,84,0,7,0,0,0,1,0,8,0,1,0,2,0,0,41,218,0,7,0,0,0,1,0,8,0,1,0,2,0,0,42,
+92,0,7,0,0,0,1,0,8,0,1,0,1,0,0,42,222,0,7,0,0,0,1,0,8,0,1,0,1,0,0,42,244,
+0,7,0,0,0,1,0,8,0,1,0,1,0,0,43,2,0,7,0,0,0,1,0,8,0,1,0,1,0,0,43,16,0,7,0,
+0,0,1,0,8,0,1,0,1,0,0,43,30,0,7,0,0,0,1,0,8,0,1,0,1,0,0,43,44,0,7,0,0,0,1,
+0,8,0,1,0,1,0,0,43,138,0,7,0,0,0,1,0,8,0,1,0,1,0,0,43,172,0,7,0,0,0,1,0,8,
+0,1,0,1,0,0,43,198,0,2,0,10,0,2,1,165,1,200,0,1,0,2,0,48,1,166,0,1,0,10,0,
+2,0,18,0,22,0,1,0,2,0,209,1,142,0,1,0,8,0,1,0,10,1,197,0,2,1,160,1,196,0,
+2,1,160,0,1,0,10,0,2,0,18,0,24,0,1,0,2,1,149,1,150,0,2,0,12,0,18,0,2,0,18,
+0,24,1,204,0,2,1,155,1,203,0,2,1,159,1,206,0,2,1,155,1,205,0,2,1,159,0,1,
+0,14,0,4,0,24,0,30,0,36,0,42,0,2,0,1,1,203,1,206,0,0,0,2,1,159,1,149,0,2,
+1,155,1,149,0,2,1,159,1,150,0,2,1,155,1,150,0,1,0,14,0,4,0,26,0,30,0,34,0,
+38,0,1,0,4,0,8,0,31,0,76,1,149,0,1,0,16,0,1,0,20,0,1,0,24,0,1,0,28,0,189,
+0,3,1,163,1,162,0,193,0,3,1,163,1,162,0,189,0,3,1,163,1,162,0,174,0,2,1,163,
+0,1,0,18,0,6,0,34,0,52,0,60,0,66,0,70,0,74,0,1,0,6,0,189,0,193,1,151,1,152,
+1,155,1,163,0,8,0,46,0,54,0,60,0,68,0,74,0,80,0,86,0,92,0,3,0,80,0,86,0,92,
+0,2,0,90,0,96,0,1,0,96,0,1,0,98,0,2,0,100,0,106,0,185,0,3,1,151,1,159,0,186,
+0,2,1,151,1,173,0,3,1,152,1,159,0,187,0,2,1,152,0,182,0,2,1,155,0,188,0,2,
+1,156,0,183,0,2,1,159,0,184,0,2,1,163,0,191,0,2,1,151,0,192,0,2,1,152,0,190,
+0,2,1,163,0,180,0,2,1,155,0,181,0,2,1,159,1,172,0,2,1,159,0,176,0,2,0,162,
+0,177,0,2,0,162,0,175,0,2,1,159,0,2,0,12,0,18,0,2,0,0,0,34,0,1,0,1,0,13,0,
+2,0,2,0,13,0,13,0,1,1,163,1,163,0,2,0,1,0,4,0,2,0,1,0,2,0,0,0,23,0,1,0,20,
+0,7,0,38,0,46,0,50,0,54,0,68,0,76,0,88,0,1,0,7,0,48,0,209,1,142,1,164,1,165,
+1,166,1,200,0,3,0,62,0,68,0,76,0,1,0,74,0,1,0,76,0,6,0,78,0,86,0,92,0,100,
+0,106,0,112,0,3,0,104,0,110,0,118,0,5,0,116,0,124,0,130,0,138,0,144,0,5,0,
+138,0,144,0,150,0,156,0,162,1,175,0,2,1,160,1,174,0,3,1,166,1,160,1,144,0,
+2,1,166,1,180,0,2,1,160,1,179,0,2,1,160,1,147,0,3,0,48,1,166,1,148,0,2,0,
+48,1,229,0,3,1,165,1,200,1,230,0,2,1,165,1,145,0,2,1,166,1,145,0,2,1,200,
+1,194,0,2,1,160,1,221,0,3,1,200,1,160,1,220,0,2,1,200,1,176,0,3,0,209,1,160,
+0,178,0,2,0,209,1,177,0,3,1,142,1,160,0,179,0,2,1,142,1,178,0,2,1,160,1,201,
+0,2,0,209,1,202,0,2,1,142,1,195,0,2,1,160,1,211,0,2,1,196,1,210,0,2,1,197,
+0,1,0,8,0,1,0,14,0,1,0,1,1,162,0,84,0,170,0,176,0,182,0,188,0,194,0,200,0,
+206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,254,1,4,1,10,1,16,1,22,1,
+28,1,34,1,40,1,46,1,52,1,58,1,64,1,70,1,76,1,82,1,88,1,94,1,100,1,106,1,112,
+1,118,1,124,1,130,1,136,1,142,1,148,1,154,1,160,1,166,1,172,1,178,1,184,1,
+190,1,196,1,202,1,208,1,214,1,220,1,226,1,232,1,238,1,244,1,250,2,0,2,6,2,
+12,2,18,2,24,2,30,2,36,2,42,2,48,2,54,2,60,2,66,2,72,2,78,2,84,2,90,2,96,
+2,102,2,108,2,114,2,120,2,126,2,132,2,138,2,144,2,150,2,156,0,211,0,2,0,4,
+0,213,0,2,0,5,0,215,0,2,0,6,0,217,0,2,0,7,0,219,0,2,0,8,0,221,0,2,0,9,0,223,
+0,2,0,10,0,225,0,2,0,11,0,227,0,2,0,12,0,229,0,2,0,13,0,234,0,2,0,14,0,239,
+0,2,0,15,0,241,0,2,0,16,0,245,0,2,0,17,0,247,0,2,0,18,0,252,0,2,0,19,0,254,
+0,2,0,20,1,0,0,2,0,21,1,2,0,2,0,22,1,4,0,2,0,23,1,7,0,2,0,24,1,9,0,2,0,25,
+1,11,0,2,0,26,1,13,0,2,0,27,1,15,0,2,0,28,1,17,0,2,0,29,1,19,0,2,0,30,1,22,
+0,2,0,31,1,24,0,2,0,32,1,26,0,2,0,34,1,28,0,2,0,35,1,31,0,2,0,36,1,33,0,2,
+0,37,1,35,0,2,0,38,1,37,0,2,0,43,1,39,0,2,0,49,1,41,0,2,0,66,1,45,0,2,0,67,
+1,47,0,2,0,68,1,49,0,2,0,69,1,51,0,2,0,76,1,53,0,2,0,77,1,55,0,2,0,78,1,57,
+0,2,0,79,1,62,0,2,0,83,1,64,0,2,0,87,1,66,0,2,0,88,1,68,0,2,0,96,1,70,0,2,
+0,97,1,72,0,2,0,98,1,74,0,2,0,103,1,76,0,2,0,104,1,78,0,2,0,105,1,80,0,2,
+0,106,1,82,0,2,0,107,1,84,0,2,0,108,1,86,0,2,0,109,1,88,0,2,0,110,1,90,0,
+2,0,111,1,92,0,2,0,112,1,94,0,2,0,113,1,96,0,2,0,114,1,98,0,2,0,115,1,100,
+0,2,0,128,1,102,0,2,0,146,1,104,0,2,0,147,1,106,0,2,0,148,1,108,0,2,0,149,
+1,110,0,2,0,150,1,112,0,2,0,151,1,114,0,2,0,152,1,116,0,2,0,153,1,118,0,2,
+0,154,1,120,0,2,0,155,1,122,0,2,0,156,1,124,0,2,0,157,1,126,0,2,0,158,1,128,
+0,2,0,159,1,130,0,2,0,160,1,132,0,2,0,161,1,134,0,2,0,163,1,136,0,2,0,164,
+1,138,0,2,0,165,1,140,0,2,0,172,0,1,0,16,0,5,0,30,0,36,0,42,0,50,0,54,0,1,
+0,5,0,15,0,17,0,19,0,36,0,67,0,2,0,30,0,36,0,2,0,36,0,42,0,3,0,42,0,48,0,
+54,0,1,0,52,0,2,0,54,0,60,0,236,0,2,0,239,0,237,0,2,0,241,0,243,0,2,0,245,
+0,244,0,2,0,247,0,249,0,2,0,239,0,250,0,2,0,241,0,251,0,2,0,245,1,30,0,2,
+1,31,1,43,0,2,0,241,1,44,0,2,0,245,0,2,0,22,0,162,0,7,0,0,3,184,0,0,0,0,3,
+194,3,208,3,218,0,1,0,68,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,
+0,15,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,
+0,31,0,32,0,34,0,35,0,36,0,37,0,39,0,43,0,47,0,49,0,66,0,67,0,68,0,69,0,76,
+0,77,0,78,0,79,0,83,0,87,0,88,0,97,0,98,0,103,0,104,0,105,0,108,0,112,0,113,
+0,115,0,128,0,148,0,151,0,157,0,159,0,161,0,165,0,172,0,231,0,232,0,233,0,
+238,0,2,0,131,0,4,0,4,0,5,0,5,0,6,0,1,0,7,0,7,0,5,0,8,0,9,0,1,0,10,0,10,0,
+5,0,11,0,11,0,1,0,12,0,15,0,4,0,17,0,17,0,4,0,18,0,18,0,1,0,19,0,21,0,5,0,
+22,0,27,0,1,0,28,0,28,0,5,0,29,0,29,0,1,0,30,0,30,0,5,0,31,0,31,0,4,0,32,
+0,32,0,5,0,34,0,35,0,5,0,36,0,36,0,4,0,37,0,37,0,5,0,39,0,39,0,5,0,43,0,43,
+0,1,0,47,0,47,0,6,0,49,0,49,0,5,0,66,0,69,0,1,0,76,0,77,0,4,0,78,0,78,0,1,
+0,79,0,79,0,4,0,80,0,82,0,3,0,83,0,83,0,4,0,87,0,87,0,1,0,88,0,88,0,4,0,97,
+0,98,0,4,0,103,0,105,0,1,0,108,0,108,0,4,0,112,0,112,0,4,0,113,0,113,0,1,
+0,115,0,115,0,1,0,128,0,128,0,1,0,148,0,148,0,5,0,151,0,151,0,4,0,157,0,157,
+0,1,0,159,0,159,0,4,0,161,0,161,0,5,0,165,0,165,0,5,0,172,0,172,0,4,0,211,
+0,211,0,2,0,213,0,213,0,3,0,215,0,215,0,3,0,217,0,217,0,2,0,219,0,219,0,3,
+0,221,0,221,0,3,0,223,0,223,0,2,0,225,0,225,0,3,0,227,0,227,0,3,0,229,0,229,
+0,2,0,231,0,233,0,4,0,234,0,234,0,2,0,238,0,238,0,4,0,239,0,239,0,2,0,241,
+0,241,0,2,0,245,0,245,0,2,0,247,0,247,0,3,0,252,0,252,0,2,0,254,0,254,0,2,
+1,0,1,0,0,2,1,2,1,2,0,3,1,4,1,4,0,3,1,7,1,7,0,3,1,9,1,9,0,3,1,11,1,11,0,3,
+1,13,1,13,0,3,1,15,1,15,0,2,1,17,1,17,0,3,1,19,1,19,0,2,1,22,1,22,0,3,1,24,
+1,24,0,2,1,26,1,26,0,2,1,28,1,28,0,2,1,31,1,31,0,2,1,33,1,33,0,2,1,35,1,35,
+0,2,1,37,1,37,0,3,1,39,1,39,0,2,1,41,1,41,0,3,1,45,1,45,0,3,1,47,1,47,0,3,
+1,49,1,49,0,3,1,51,1,51,0,3,1,53,1,53,0,3,1,55,1,55,0,3,1,57,1,57,0,3,1,62,
+1,62,0,3,1,64,1,64,0,3,1,66,1,66,0,3,1,68,1,68,0,2,1,70,1,70,0,2,1,72,1,72,
+0,2,1,74,1,74,0,3,1,76,1,76,0,3,1,78,1,78,0,3,1,80,1,80,0,2,1,82,1,82,0,2,
+1,84,1,84,0,2,1,86,1,86,0,2,1,88,1,88,0,2,1,90,1,90,0,2,1,92,1,92,0,2,1,94,
+1,94,0,3,1,96,1,96,0,2,1,98,1,98,0,3,1,100,1,100,0,3,1,102,1,102,0,2,1,104,
+1,104,0,2,1,106,1,106,0,3,1,108,1,108,0,2,1,110,1,110,0,2,1,112,1,112,0,2,
+1,114,1,114,0,2,1,116,1,116,0,2,1,118,1,118,0,2,1,120,1,120,0,2,1,122,1,122,
+0,2,1,124,1,124,0,3,1,126,1,126,0,2,1,128,1,128,0,2,1,130,1,130,0,2,1,132,
+1,132,0,3,1,134,1,134,0,2,1,136,1,136,0,2,1,138,1,138,0,3,1,140,1,140,0,2,
+0,4,0,38,0,54,0,70,0,86,0,6,0,92,0,102,0,112,0,128,0,144,0,160,0,4,0,162,
+0,178,0,194,0,210,0,1,0,216,0,3,0,2,0,2,0,3,0,1,0,11,0,2,0,11,0,3,0,2,0,3,
+0,2,0,1,0,11,0,2,0,11,0,3,0,2,0,2,0,2,0,1,0,11,0,2,0,11,0,3,0,2,0,3,0,3,0,
+1,0,11,0,2,0,11,0,2,0,1,0,2,0,1,0,11,0,2,0,1,0,3,0,1,0,11,0,3,0,2,0,2,0,2,
+0,1,0,11,0,2,0,11,0,3,0,2,0,2,0,3,0,1,0,11,0,2,0,11,0,3,0,2,0,3,0,2,0,1,0,
+11,0,2,0,11,0,3,0,2,0,3,0,3,0,1,0,11,0,2,0,11,0,3,0,2,0,2,0,2,0,1,0,11,0,
+2,0,11,0,3,0,2,0,2,0,3,0,1,0,11,0,2,0,11,0,3,0,2,0,3,0,2,0,1,0,11,0,2,0,11,
+0,3,0,2,0,3,0,3,0,1,0,11,0,2,0,11,0,3,0,1,0,1,0,2,0,2,0,11,0,2,0,178,0,86,
+1,59,1,60,1,61,0,212,0,214,0,216,0,218,0,220,0,222,0,224,0,226,0,230,0,235,
+0,240,0,242,0,246,0,248,0,253,0,255,1,1,1,3,1,5,1,8,1,10,1,12,1,14,1,16,1,
+18,1,20,1,23,1,25,1,27,1,29,1,32,1,34,1,36,1,38,1,40,1,42,1,46,1,48,1,50,
+1,52,1,54,1,56,1,58,1,63,1,65,1,67,1,69,1,71,1,73,1,75,1,77,1,79,1,81,1,83,
+1,85,1,87,1,89,1,91,1,93,1,95,1,97,1,99,1,101,1,103,1,105,1,107,1,109,1,111,
+1,113,1,115,1,117,1,119,1,121,1,123,1,125,1,127,1,129,1,131,1,133,1,135,1,
+137,1,139,1,141,0,1,0,86,0,80,0,81,0,82,0,211,0,213,0,215,0,217,0,219,0,221,
+0,223,0,225,0,229,0,234,0,239,0,241,0,245,0,247,0,252,0,254,1,0,1,2,1,4,1,
+7,1,9,1,11,1,13,1,15,1,17,1,19,1,22,1,24,1,26,1,28,1,31,1,33,1,35,1,37,1,
+39,1,41,1,45,1,47,1,49,1,51,1,53,1,55,1,57,1,62,1,64,1,66,1,68,1,70,1,72,
+1,74,1,76,1,78,1,80,1,82,1,84,1,86,1,88,1,90,1,92,1,94,1,96,1,98,1,100,1,
+102,1,104,1,106,1,108,1,110,1,112,1,114,1,116,1,118,1,120,1,122,1,124,1,126,
+1,128,1,130,1,132,1,134,1,136,1,138,1,140,0,2,0,12,0,18,0,2,0,0,0,130,0,1,
+0,1,0,47,0,2,0,18,0,4,0,36,0,4,0,47,0,47,0,1,0,49,0,49,0,4,0,66,0,71,0,4,
+0,76,0,79,0,4,0,83,0,83,0,4,0,87,0,88,0,4,0,96,0,98,0,4,0,103,0,115,0,4,0,
+128,0,128,0,4,0,146,0,161,0,4,0,163,0,165,0,4,0,172,0,172,0,4,1,166,1,166,
+0,3,1,174,1,175,0,2,1,194,1,194,0,2,1,200,1,200,0,3,1,221,1,221,0,2,0,2,0,
+6,0,18,0,3,0,1,0,4,0,2,0,2,0,29,0,4,0,1,0,4,0,3,0,2,0,3,0,29,0,2,0,12,0,18,
+0,2,0,0,0,160,0,1,0,1,0,47,0,2,0,23,0,4,0,11,0,3,0,18,0,30,0,3,0,32,0,35,
+0,3,0,37,0,38,0,3,0,43,0,43,0,3,0,47,0,47,0,1,0,48,0,48,0,2,0,49,0,49,0,3,
+0,66,0,71,0,3,0,78,0,78,0,3,0,87,0,87,0,3,0,96,0,96,0,3,0,103,0,107,0,3,0,
+109,0,111,0,3,0,113,0,114,0,3,0,128,0,128,0,3,0,146,0,150,0,3,0,152,0,158,
+0,3,0,160,0,161,0,3,0,163,0,165,0,3,1,144,1,144,0,2,1,165,1,165,0,2,1,220,
+1,220,0,2,0,1,0,4,0,3,0,1,0,3,0,2,0,0,0,14,0,1,0,8,0,1,0,14,0,1,0,1,0,47,
+0,4,0,10,0,16,0,22,0,28,0,194,0,2,0,48,1,187,0,2,1,144,1,216,0,2,1,165,1,
+222,0,2,1,220,0,1,0,10,0,2,0,18,0,24,0,1,0,2,0,254,0,255,0,2,0,12,0,18,0,
+2,0,18,0,24,1,185,0,2,0,48,1,212,0,2,1,165,1,184,0,2,0,48,1,213,0,2,1,165,
+0,2,0,46,0,136,2,84,3,102,0,17,0,0,0,0,4,24,4,28,4,36,4,46,4,58,4,66,4,70,
+0,0,0,0,0,0,4,82,4,102,0,0,4,112,4,116,0,1,0,43,0,12,0,13,0,14,0,15,0,16,
+0,17,0,22,0,24,0,36,0,71,0,76,0,77,0,79,0,83,0,178,0,179,0,209,1,142,1,144,
+1,145,1,147,1,148,1,160,1,164,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,
+194,1,195,1,196,1,197,1,201,1,202,1,210,1,211,1,220,1,221,1,229,1,230,0,2,
+0,76,0,4,0,11,0,5,0,12,0,12,0,2,0,13,0,13,0,8,0,14,0,14,0,9,0,15,0,17,0,2,
+0,18,0,23,0,5,0,24,0,24,0,7,0,25,0,30,0,5,0,32,0,35,0,5,0,36,0,36,0,2,0,37,
+0,38,0,5,0,39,0,42,0,2,0,43,0,44,0,5,0,45,0,46,0,2,0,47,0,47,0,4,0,48,0,48,
+0,6,0,49,0,49,0,5,0,66,0,71,0,5,0,76,0,77,0,2,0,78,0,78,0,5,0,79,0,79,0,2,
+0,80,0,82,0,1,0,83,0,83,0,2,0,87,0,87,0,5,0,88,0,88,0,2,0,96,0,96,0,5,0,97,
+0,98,0,2,0,103,0,107,0,5,0,108,0,108,0,2,0,109,0,111,0,5,0,112,0,112,0,2,
+0,113,0,114,0,5,0,115,0,115,0,2,0,128,0,128,0,5,0,146,0,158,0,5,0,159,0,159,
+0,2,0,160,0,165,0,5,0,172,0,172,0,2,0,178,0,179,0,6,0,194,0,194,0,4,0,209,
+0,210,0,6,0,211,0,227,0,1,0,228,0,228,0,2,0,229,0,230,0,1,0,231,0,231,0,2,
+0,233,0,233,0,2,0,234,0,235,0,1,0,236,0,238,0,2,0,239,0,242,0,1,0,243,0,244,
+0,2,0,245,0,248,0,1,0,249,0,251,0,2,0,252,1,5,0,1,1,6,1,6,0,10,1,7,1,20,0,
+1,1,22,1,29,0,1,1,30,1,30,0,2,1,31,1,42,0,1,1,43,1,44,0,2,1,45,1,141,0,1,
+1,142,1,144,0,6,1,145,1,148,0,3,1,164,1,164,0,3,1,165,1,166,0,6,1,179,1,180,
+0,6,1,184,1,185,0,1,1,187,1,187,0,4,1,196,1,197,0,6,1,200,1,202,0,6,1,209,
+1,209,0,3,1,212,1,213,0,1,1,216,1,216,0,4,1,220,1,220,0,6,1,222,1,222,0,4,
+1,229,1,230,0,3,1,252,1,252,0,3,0,2,0,45,0,12,0,12,0,7,0,13,0,13,0,5,0,14,
+0,14,0,6,0,15,0,15,0,4,0,16,0,16,0,7,0,17,0,17,0,4,0,22,0,22,0,2,0,24,0,24,
+0,8,0,31,0,31,0,9,0,36,0,36,0,3,0,71,0,71,0,2,0,76,0,77,0,7,0,79,0,79,0,7,
+0,80,0,82,0,1,0,83,0,83,0,4,0,178,0,179,0,13,0,209,0,209,0,12,0,211,0,227,
+0,1,0,229,0,230,0,1,0,234,0,235,0,1,0,239,0,242,0,1,0,245,0,248,0,1,0,252,
+1,5,0,1,1,6,1,6,0,10,1,7,1,20,0,1,1,22,1,29,0,1,1,31,1,42,0,1,1,45,1,141,
+0,1,1,142,1,142,0,12,1,144,1,145,0,13,1,147,1,148,0,13,1,160,1,160,0,16,1,
+164,1,164,0,15,1,166,1,166,0,14,1,174,1,178,0,13,1,179,1,180,0,12,1,184,1,
+185,0,1,1,194,1,195,0,13,1,196,1,197,0,12,1,200,1,200,0,14,1,201,1,202,0,
+13,1,210,1,211,0,13,1,212,1,213,0,1,1,220,1,221,0,13,1,229,1,230,0,13,0,2,
+0,29,0,48,0,48,0,1,0,80,0,82,0,2,0,178,0,179,0,3,0,209,0,209,0,3,0,211,0,
+227,0,2,0,229,0,230,0,2,0,234,0,235,0,2,0,239,0,242,0,2,0,245,0,248,0,2,0,
+252,1,5,0,2,1,7,1,20,0,2,1,22,1,29,0,2,1,31,1,42,0,2,1,45,1,141,0,2,1,142,
+1,142,0,3,1,144,1,145,0,1,1,147,1,148,0,1,1,165,1,165,0,1,1,166,1,166,0,3,
+1,174,1,175,0,1,1,176,1,180,0,3,1,184,1,184,0,2,1,194,1,194,0,1,1,195,1,197,
+0,3,1,200,1,202,0,3,1,210,1,211,0,3,1,213,1,213,0,2,1,220,1,221,0,1,1,229,
+1,230,0,1,0,1,0,102,0,3,0,112,0,126,0,140,0,4,0,150,0,164,0,178,0,192,0,5,
+0,196,0,210,0,224,0,238,1,0,0,3,1,2,1,16,1,30,0,1,1,36,0,5,1,46,1,60,1,74,
+1,88,1,102,0,9,1,108,1,122,1,136,1,150,1,164,1,178,1,192,1,206,1,222,0,4,
+1,218,1,232,1,246,2,4,0,1,2,10,0,4,2,20,2,34,2,48,2,62,0,0,0,2,0,15,0,0,0,
+1,0,1,0,24,0,0,0,1,0,1,0,2,0,1,0,0,0,24,0,0,0,1,0,1,0,1,0,1,0,0,0,24,0,0,
+0,2,0,15,0,0,0,2,0,0,0,24,0,1,0,23,0,0,0,1,0,1,0,2,0,1,0,0,0,23,0,0,0,1,0,
+1,0,1,0,1,0,0,0,23,0,0,0,1,0,1,0,3,0,1,0,0,0,23,0,0,0,2,0,15,0,0,0,1,0,1,
+0,25,0,0,0,1,0,1,0,2,0,1,0,0,0,24,0,0,0,1,0,1,0,1,0,1,0,0,0,24,0,0,0,1,0,
+1,0,3,0,1,0,0,0,23,0,0,0,2,0,15,0,0,0,2,0,0,0,24,0,1,0,23,0,1,0,4,0,1,0,0,
+0,1,0,0,0,23,0,0,0,1,0,1,0,2,0,1,0,0,0,24,0,0,0,1,0,1,0,1,0,1,0,0,0,24,0,
+0,0,2,0,15,0,0,0,1,0,0,0,24,0,0,0,2,0,15,0,0,0,1,0,1,0,23,0,1,0,4,0,1,0,0,
+0,1,0,0,0,23,0,0,0,1,0,1,0,2,0,1,0,0,0,23,0,0,0,1,0,1,0,1,0,1,0,0,0,23,0,
+0,0,1,0,1,0,3,0,1,0,0,0,23,0,0,0,2,0,15,0,0,0,2,0,0,0,23,0,1,0,24,0,1,0,1,
+0,1,0,0,0,1,0,0,0,30,0,1,0,2,0,1,0,0,0,1,0,0,0,30,0,1,0,3,0,1,0,0,0,1,0,0,
+0,30,0,1,0,6,0,1,0,0,0,1,0,0,0,30,0,1,0,7,0,1,0,0,0,1,0,0,0,30,0,1,0,8,0,
+1,0,0,0,1,0,0,0,30,0,1,0,9,0,1,0,0,0,1,0,0,0,30,0,2,0,5,0,4,0,1,0,0,0,1,0,
+0,0,30,0,2,0,10,0,4,0,1,0,0,0,1,0,0,0,30,0,1,0,2,0,1,0,0,0,1,0,0,0,30,0,1,
+0,8,0,1,0,0,0,1,0,0,0,30,0,1,0,9,0,1,0,0,0,1,0,0,0,30,0,2,0,5,0,4,0,1,0,0,
+0,1,0,0,0,31,0,1,0,1,0,1,0,0,0,1,0,0,0,23,0,1,0,1,0,1,0,0,0,1,0,0,0,30,0,
+1,0,2,0,1,0,0,0,1,0,0,0,30,0,1,0,3,0,1,0,0,0,1,0,0,0,30,0,1,0,6,0,1,0,0,0,
+1,0,0,0,30,0,2,0,38,0,0,0,44,2,112,0,13,0,0,0,0,0,0,0,0,4,12,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,31,0,2,0,96,0,5,0,6,0,1,0,8,0,9,0,1,0,11,0,
+11,0,1,0,18,0,18,0,1,0,22,0,27,0,1,0,29,0,29,0,1,0,31,0,31,0,4,0,33,0,33,
+0,1,0,43,0,43,0,1,0,47,0,47,0,9,0,48,0,48,0,8,0,66,0,71,0,1,0,78,0,78,0,1,
+0,87,0,88,0,1,0,103,0,105,0,1,0,113,0,113,0,1,0,115,0,115,0,1,0,128,0,128,
+0,1,0,148,0,148,0,1,0,157,0,157,0,1,0,161,0,161,0,1,0,165,0,165,0,1,0,178,
+0,179,0,5,0,194,0,194,0,9,0,209,0,209,0,5,0,211,0,211,0,2,0,217,0,217,0,2,
+0,223,0,223,0,2,0,229,0,229,0,2,0,234,0,234,0,2,0,239,0,239,0,2,0,241,0,241,
+0,2,0,245,0,245,0,2,0,252,0,252,0,2,0,254,0,254,0,2,1,0,1,0,0,2,1,6,1,6,0,
+1,1,15,1,15,0,2,1,19,1,19,0,2,1,24,1,24,0,2,1,26,1,26,0,2,1,28,1,28,0,2,1,
+31,1,31,0,2,1,33,1,33,0,2,1,35,1,35,0,2,1,39,1,39,0,2,1,68,1,68,0,2,1,70,
+1,70,0,2,1,72,1,72,0,2,1,80,1,80,0,2,1,82,1,82,0,2,1,84,1,84,0,2,1,86,1,86,
+0,2,1,88,1,88,0,2,1,90,1,90,0,2,1,92,1,92,0,2,1,96,1,96,0,2,1,102,1,102,0,
+2,1,104,1,104,0,2,1,108,1,108,0,2,1,110,1,110,0,2,1,112,1,112,0,2,1,114,1,
+114,0,2,1,116,1,116,0,2,1,118,1,118,0,2,1,120,1,120,0,2,1,122,1,122,0,2,1,
+126,1,126,0,2,1,128,1,128,0,2,1,130,1,130,0,2,1,134,1,134,0,2,1,136,1,136,
+0,2,1,140,1,140,0,2,1,142,1,142,0,5,1,144,1,144,0,8,1,145,1,145,0,11,1,147,
+1,148,0,11,1,160,1,160,0,7,1,164,1,164,0,11,1,165,1,165,0,8,1,166,1,166,0,
+10,1,170,1,170,0,1,1,174,1,175,0,7,1,176,1,177,0,6,1,178,1,178,0,12,1,179,
+1,180,0,6,1,194,1,194,0,7,1,195,1,195,0,12,1,196,1,197,0,6,1,200,1,200,0,
+10,1,201,1,202,0,5,1,210,1,211,0,6,1,216,1,216,0,9,1,220,1,220,0,8,1,221,
+1,221,0,7,1,229,1,230,0,11,0,2,0,68,0,5,0,6,0,1,0,8,0,9,0,1,0,11,0,11,0,1,
+0,18,0,18,0,1,0,22,0,27,0,1,0,29,0,29,0,1,0,33,0,33,0,1,0,43,0,43,0,1,0,66,
+0,71,0,1,0,78,0,78,0,1,0,87,0,88,0,1,0,103,0,105,0,1,0,113,0,113,0,1,0,115,
+0,115,0,1,0,128,0,128,0,1,0,148,0,148,0,1,0,157,0,157,0,1,0,161,0,161,0,1,
+0,165,0,165,0,1,0,211,0,211,0,2,0,217,0,217,0,2,0,223,0,223,0,2,0,229,0,229,
+0,2,0,234,0,234,0,2,0,239,0,239,0,2,0,241,0,241,0,2,0,245,0,245,0,2,0,252,
+0,252,0,2,0,254,0,254,0,2,1,0,1,0,0,2,1,6,1,6,0,1,1,15,1,15,0,2,1,19,1,19,
+0,2,1,24,1,24,0,2,1,26,1,26,0,2,1,28,1,28,0,2,1,31,1,31,0,2,1,33,1,33,0,2,
+1,35,1,35,0,2,1,39,1,39,0,2,1,68,1,68,0,2,1,70,1,70,0,2,1,72,1,72,0,2,1,80,
+1,80,0,2,1,82,1,82,0,2,1,84,1,84,0,2,1,86,1,86,0,2,1,88,1,88,0,2,1,90,1,90,
+0,2,1,92,1,92,0,2,1,96,1,96,0,2,1,102,1,102,0,2,1,104,1,104,0,2,1,108,1,108,
+0,2,1,110,1,110,0,2,1,112,1,112,0,2,1,114,1,114,0,2,1,116,1,116,0,2,1,118,
+1,118,0,2,1,120,1,120,0,2,1,122,1,122,0,2,1,126,1,126,0,2,1,128,1,128,0,2,
+1,130,1,130,0,2,1,134,1,134,0,2,1,136,1,136,0,2,1,140,1,140,0,2,1,170,1,170,
+0,1,0,13,0,28,0,46,0,60,0,82,0,100,0,118,0,132,0,150,0,168,0,182,0,204,0,
+222,0,240,0,0,0,2,0,5,0,2,0,1,0,2,0,1,0,0,0,26,0,0,0,2,0,5,0,0,0,1,0,0,0,
+24,0,0,0,2,0,6,0,2,0,1,0,2,0,2,0,0,0,24,0,1,0,33,0,0,0,2,0,6,0,0,0,2,0,0,
+0,24,0,1,0,32,0,0,0,2,0,7,0,2,0,1,0,2,0,1,0,1,0,33,0,0,0,2,0,7,0,0,0,1,0,
+1,0,32,0,0,0,2,0,8,0,2,0,1,0,2,0,1,0,0,0,25,0,0,0,2,0,10,0,2,0,1,0,2,0,1,
+0,0,0,27,0,0,0,2,0,10,0,0,0,1,0,0,0,23,0,0,0,2,0,12,0,2,0,1,0,2,0,2,0,0,0,
+23,0,1,0,33,0,0,0,2,0,12,0,0,0,2,0,0,0,23,0,1,0,32,0,0,0,2,0,11,0,0,0,2,0,
+0,0,28,0,1,0,23,0,0,0,1,0,2,0,1,0,2,0,1,0,0,0,25,0,2,0,12,0,30,0,2,0,0,1,
+228,0,1,0,7,0,210,1,143,1,181,1,182,1,183,1,198,1,199,0,2,0,75,0,5,0,6,0,
+2,0,8,0,9,0,2,0,11,0,11,0,2,0,18,0,18,0,2,0,22,0,27,0,2,0,29,0,29,0,2,0,33,
+0,33,0,2,0,43,0,43,0,2,0,47,0,47,0,4,0,66,0,71,0,2,0,78,0,78,0,2,0,87,0,88,
+0,2,0,103,0,105,0,2,0,113,0,113,0,2,0,115,0,115,0,2,0,128,0,128,0,2,0,148,
+0,148,0,2,0,157,0,157,0,2,0,161,0,161,0,2,0,165,0,165,0,2,0,194,0,194,0,4,
+0,210,0,210,0,1,0,211,0,211,0,3,0,217,0,217,0,3,0,223,0,223,0,3,0,229,0,229,
+0,3,0,234,0,234,0,3,0,239,0,239,0,3,0,241,0,241,0,3,0,245,0,245,0,3,0,252,
+0,252,0,3,0,254,0,254,0,3,1,0,1,0,0,3,1,6,1,6,0,2,1,15,1,15,0,3,1,19,1,19,
+0,3,1,24,1,24,0,3,1,26,1,26,0,3,1,28,1,28,0,3,1,31,1,31,0,3,1,33,1,33,0,3,
+1,35,1,35,0,3,1,39,1,39,0,3,1,68,1,68,0,3,1,70,1,70,0,3,1,72,1,72,0,3,1,80,
+1,80,0,3,1,82,1,82,0,3,1,84,1,84,0,3,1,86,1,86,0,3,1,88,1,88,0,3,1,90,1,90,
+0,3,1,92,1,92,0,3,1,96,1,96,0,3,1,102,1,102,0,3,1,104,1,104,0,3,1,108,1,108,
+0,3,1,110,1,110,0,3,1,112,1,112,0,3,1,114,1,114,0,3,1,116,1,116,0,3,1,118,
+1,118,0,3,1,120,1,120,0,3,1,122,1,122,0,3,1,126,1,126,0,3,1,128,1,128,0,3,
+1,130,1,130,0,3,1,134,1,134,0,3,1,136,1,136,0,3,1,140,1,140,0,3,1,143,1,143,
+0,1,1,170,1,170,0,2,1,181,1,183,0,1,1,198,1,199,0,1,1,216,1,216,0,4,0,1,0,
+4,0,3,0,1,0,2,0,3,0,0,0,34,0,2,0,22,0,40,0,7,0,0,0,248,0,0,0,0,1,2,1,6,1,
+10,0,1,0,7,0,13,0,14,0,36,0,47,0,194,0,228,1,216,0,2,0,34,0,4,0,12,0,3,0,
+13,0,13,0,6,0,14,0,14,0,4,0,15,0,35,0,3,0,36,0,36,0,5,0,47,0,47,0,1,0,49,
+0,49,0,3,0,66,0,71,0,3,0,76,0,79,0,3,0,83,0,83,0,3,0,85,0,88,0,3,0,96,0,98,
+0,3,0,103,0,115,0,3,0,117,0,117,0,3,0,128,0,128,0,3,0,146,0,161,0,3,0,163,
+0,165,0,3,0,172,0,172,0,3,0,194,0,194,0,1,0,228,0,228,0,6,0,231,0,233,0,3,
+0,236,0,238,0,3,0,243,0,244,0,3,0,249,0,251,0,3,1,6,1,6,0,3,1,21,1,21,0,3,
+1,30,1,30,0,3,1,43,1,44,0,3,1,166,1,166,0,2,1,200,1,200,0,2,1,207,1,207,0,
+3,1,216,1,216,0,1,2,14,2,15,0,3,2,25,2,26,0,3,0,4,0,22,0,34,0,46,0,58,0,1,
+0,60,0,1,0,66,0,1,0,72,0,3,0,1,0,3,0,2,0,2,0,29,0,3,0,1,0,4,0,2,0,2,0,29,
+0,3,0,1,0,5,0,2,0,2,0,29,0,3,0,1,0,6,0,2,0,2,0,29,0,2,0,1,0,2,0,1,0,29,0,
+2,0,1,0,2,0,1,0,29,0,2,0,1,0,2,0,1,0,29,0,2,0,24,0,38,0,8,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,176,0,1,0,5,0,47,0,194,1,187,1,216,1,222,0,2,0,65,0,4,0,4,0,
+2,0,5,0,6,0,1,0,7,0,7,0,2,0,8,0,9,0,1,0,10,0,10,0,2,0,11,0,11,0,1,0,12,0,
+12,0,5,0,13,0,13,0,1,0,14,0,14,0,2,0,15,0,18,0,1,0,19,0,19,0,3,0,20,0,21,
+0,2,0,22,0,27,0,1,0,28,0,28,0,2,0,29,0,29,0,1,0,30,0,30,0,2,0,31,0,31,0,1,
+0,32,0,32,0,2,0,33,0,33,0,1,0,34,0,35,0,2,0,36,0,36,0,1,0,37,0,40,0,2,0,41,
+0,45,0,1,0,47,0,47,0,7,0,49,0,49,0,4,0,76,0,76,0,1,0,77,0,77,0,5,0,78,0,79,
+0,1,0,83,0,83,0,1,0,85,0,85,0,1,0,88,0,88,0,1,0,96,0,96,0,3,0,97,0,98,0,2,
+0,103,0,105,0,1,0,106,0,112,0,2,0,113,0,113,0,1,0,114,0,114,0,2,0,115,0,115,
+0,1,0,128,0,128,0,1,0,146,0,147,0,2,0,148,0,148,0,5,0,149,0,156,0,2,0,157,
+0,157,0,1,0,158,0,158,0,3,0,159,0,160,0,2,0,161,0,161,0,5,0,163,0,163,0,2,
+0,164,0,164,0,3,0,165,0,165,0,5,0,194,0,194,0,7,0,228,0,228,0,1,0,232,0,232,
+0,2,0,233,0,233,0,1,0,237,0,237,0,1,0,244,0,244,0,1,0,249,0,249,0,2,0,251,
+0,251,0,2,1,21,1,21,0,1,1,30,1,30,0,1,1,187,1,187,0,7,1,207,1,207,0,1,1,216,
+1,216,0,7,1,222,1,222,0,7,2,14,2,15,0,1,2,25,2,26,0,1,0,4,0,10,0,20,0,30,
+0,40,0,2,0,1,0,5,0,0,0,35,0,2,0,1,0,2,0,0,0,36,0,2,0,1,0,3,0,0,0,37,0,2,0,
+1,0,4,0,0,0,38,0,2,0,12,0,66,0,2,0,0,1,126,0,1,0,25,0,47,0,194,0,195,0,198,
+1,187,1,188,1,214,1,216,1,217,1,222,1,223,1,226,1,227,1,231,1,238,1,242,1,
+248,1,249,1,250,2,2,2,3,2,4,2,5,2,9,2,11,0,2,0,52,0,4,0,32,0,3,0,34,0,38,
+0,3,0,40,0,40,0,5,0,41,0,41,0,3,0,42,0,42,0,5,0,43,0,44,0,3,0,45,0,45,0,5,
+0,47,0,47,0,1,0,49,0,49,0,3,0,66,0,69,0,3,0,76,0,79,0,3,0,83,0,83,0,3,0,87,
+0,88,0,3,0,96,0,98,0,3,0,100,0,102,0,2,0,103,0,115,0,3,0,128,0,128,0,3,0,
+146,0,161,0,3,0,163,0,165,0,3,0,172,0,172,0,3,0,174,0,174,0,2,0,180,0,193,
+0,2,0,194,0,195,0,1,0,198,0,198,0,1,0,210,0,210,0,4,0,228,0,228,0,3,0,231,
+0,233,0,3,0,238,0,238,0,3,1,6,1,6,0,3,1,21,1,21,0,3,1,143,1,143,0,4,1,151,
+1,152,0,2,1,155,1,158,0,2,1,163,1,163,0,2,1,172,1,173,0,2,1,181,1,182,0,4,
+1,187,1,188,0,1,1,198,1,199,0,4,1,207,1,207,0,3,1,214,1,214,0,1,1,216,1,217,
+0,1,1,222,1,223,0,1,1,226,1,227,0,1,1,231,1,231,0,1,1,238,1,238,0,1,1,242,
+1,242,0,1,1,248,1,250,0,1,2,2,2,5,0,1,2,9,2,9,0,1,2,11,2,11,0,1,2,14,2,15,
+0,3,2,25,2,26,0,3,0,3,0,8,0,20,0,34,0,3,0,1,0,3,0,2,0,0,0,39,0,4,0,1,0,3,
+0,4,0,2,0,0,0,39,0,2,0,1,0,5,0,0,0,39,0,2,0,12,0,36,0,2,0,0,5,230,0,1,0,10,
+0,47,0,198,0,199,0,200,1,214,1,215,1,238,1,239,1,242,1,243,0,2,0,245,0,4,
+0,4,0,7,0,5,0,6,0,2,0,7,0,7,0,7,0,8,0,9,0,2,0,10,0,10,0,7,0,11,0,11,0,2,0,
+12,0,12,0,4,0,14,0,14,0,6,0,15,0,15,0,4,0,16,0,16,0,6,0,17,0,17,0,4,0,18,
+0,18,0,2,0,19,0,21,0,7,0,22,0,27,0,2,0,28,0,28,0,7,0,29,0,29,0,2,0,30,0,30,
+0,7,0,31,0,31,0,4,0,32,0,32,0,7,0,34,0,35,0,7,0,36,0,36,0,6,0,37,0,38,0,2,
+0,39,0,42,0,6,0,43,0,43,0,2,0,44,0,45,0,6,0,47,0,47,0,1,0,49,0,49,0,7,0,66,
+0,69,0,2,0,76,0,77,0,4,0,78,0,78,0,2,0,79,0,79,0,6,0,80,0,82,0,3,0,83,0,83,
+0,6,0,87,0,87,0,2,0,88,0,88,0,6,0,96,0,96,0,7,0,97,0,98,0,5,0,103,0,105,0,
+2,0,106,0,107,0,7,0,108,0,108,0,5,0,109,0,111,0,7,0,112,0,112,0,5,0,113,0,
+113,0,2,0,114,0,114,0,7,0,115,0,115,0,6,0,128,0,128,0,2,0,146,0,147,0,7,0,
+148,0,148,0,2,0,149,0,150,0,7,0,151,0,151,0,5,0,152,0,156,0,7,0,157,0,157,
+0,2,0,158,0,158,0,7,0,159,0,159,0,6,0,160,0,160,0,7,0,161,0,161,0,2,0,163,
+0,164,0,7,0,165,0,165,0,2,0,198,0,200,0,1,0,211,0,211,0,8,0,212,0,212,0,9,
+0,213,0,213,0,3,0,214,0,214,0,9,0,215,0,215,0,3,0,216,0,216,0,9,0,217,0,217,
+0,8,0,218,0,218,0,9,0,219,0,219,0,3,0,220,0,220,0,9,0,221,0,221,0,3,0,222,
+0,222,0,9,0,223,0,223,0,8,0,224,0,224,0,9,0,225,0,225,0,3,0,226,0,226,0,9,
+0,227,0,227,0,3,0,228,0,228,0,6,0,229,0,229,0,8,0,230,0,230,0,9,0,231,0,233,
+0,6,0,234,0,234,0,8,0,235,0,235,0,9,0,238,0,238,0,4,0,239,0,239,0,8,0,240,
+0,240,0,9,0,241,0,241,0,8,0,242,0,242,0,9,0,245,0,245,0,8,0,246,0,246,0,9,
+0,247,0,247,0,3,0,248,0,248,0,9,0,252,0,252,0,8,0,253,0,253,0,9,0,254,0,254,
+0,8,0,255,0,255,0,9,1,0,1,0,0,8,1,1,1,1,0,9,1,2,1,2,0,3,1,3,1,3,0,9,1,4,1,
+4,0,3,1,5,1,5,0,9,1,6,1,6,0,2,1,7,1,7,0,3,1,8,1,8,0,9,1,9,1,9,0,3,1,10,1,
+10,0,9,1,11,1,11,0,3,1,12,1,12,0,9,1,13,1,13,0,3,1,14,1,14,0,9,1,15,1,15,
+0,8,1,16,1,16,0,9,1,17,1,17,0,3,1,18,1,18,0,9,1,19,1,19,0,8,1,20,1,20,0,9,
+1,21,1,21,0,4,1,22,1,22,0,3,1,23,1,23,0,9,1,24,1,24,0,8,1,25,1,25,0,9,1,26,
+1,26,0,8,1,27,1,27,0,9,1,28,1,28,0,8,1,29,1,29,0,9,1,31,1,31,0,8,1,32,1,32,
+0,9,1,33,1,33,0,8,1,34,1,34,0,9,1,35,1,35,0,8,1,36,1,36,0,9,1,37,1,37,0,3,
+1,38,1,38,0,9,1,39,1,39,0,8,1,40,1,40,0,9,1,41,1,41,0,3,1,42,1,42,0,9,1,45,
+1,45,0,3,1,46,1,46,0,9,1,47,1,47,0,3,1,48,1,48,0,9,1,49,1,49,0,3,1,50,1,50,
+0,9,1,51,1,51,0,3,1,52,1,52,0,9,1,53,1,53,0,3,1,54,1,54,0,9,1,55,1,55,0,3,
+1,56,1,56,0,9,1,57,1,57,0,3,1,58,1,61,0,9,1,62,1,62,0,3,1,63,1,63,0,9,1,64,
+1,64,0,3,1,65,1,65,0,9,1,66,1,66,0,3,1,67,1,67,0,9,1,68,1,68,0,8,1,69,1,69,
+0,9,1,70,1,70,0,8,1,71,1,71,0,9,1,72,1,72,0,8,1,73,1,73,0,9,1,74,1,74,0,3,
+1,75,1,75,0,9,1,76,1,76,0,3,1,77,1,77,0,9,1,78,1,78,0,3,1,79,1,79,0,9,1,80,
+1,80,0,8,1,81,1,81,0,9,1,82,1,82,0,8,1,83,1,83,0,9,1,84,1,84,0,8,1,85,1,85,
+0,9,1,86,1,86,0,8,1,87,1,87,0,9,1,88,1,88,0,8,1,89,1,89,0,9,1,90,1,90,0,8,
+1,91,1,91,0,9,1,92,1,92,0,8,1,93,1,93,0,9,1,94,1,94,0,3,1,95,1,95,0,9,1,96,
+1,96,0,8,1,97,1,97,0,9,1,98,1,98,0,3,1,99,1,99,0,9,1,100,1,100,0,3,1,101,
+1,101,0,9,1,102,1,102,0,8,1,103,1,103,0,9,1,104,1,104,0,8,1,105,1,105,0,9,
+1,106,1,106,0,3,1,107,1,107,0,9,1,108,1,108,0,8,1,109,1,109,0,9,1,110,1,110,
+0,8,1,111,1,111,0,9,1,112,1,112,0,8,1,113,1,113,0,9,1,114,1,114,0,8,1,115,
+1,115,0,9,1,116,1,116,0,8,1,117,1,117,0,9,1,118,1,118,0,8,1,119,1,119,0,9,
+1,120,1,120,0,8,1,121,1,121,0,9,1,122,1,122,0,8,1,123,1,123,0,9,1,124,1,124,
+0,3,1,125,1,125,0,9,1,126,1,126,0,8,1,127,1,127,0,9,1,128,1,128,0,8,1,129,
+1,129,0,9,1,130,1,130,0,8,1,131,1,131,0,9,1,132,1,132,0,3,1,133,1,133,0,9,
+1,134,1,134,0,8,1,135,1,135,0,9,1,136,1,136,0,8,1,137,1,137,0,9,1,138,1,138,
+0,3,1,139,1,139,0,9,1,140,1,140,0,8,1,141,1,141,0,9,1,145,1,148,0,10,1,164,
+1,164,0,10,1,207,1,207,0,6,1,209,1,209,0,10,1,214,1,215,0,1,1,229,1,229,0,
+11,1,230,1,230,0,10,1,238,1,239,0,1,1,242,1,243,0,1,1,252,1,252,0,10,2,14,
+2,14,0,4,2,15,2,15,0,6,2,25,2,26,0,4,2,27,2,27,0,10,0,12,0,26,0,38,0,50,0,
+62,0,72,0,82,0,94,0,106,0,116,0,128,0,140,0,152,0,3,0,1,0,2,0,3,0,0,0,40,
+0,3,0,1,0,2,0,8,0,0,0,41,0,3,0,1,0,2,0,9,0,0,0,40,0,2,0,1,0,4,0,0,0,40,0,
+2,0,1,0,5,0,0,0,41,0,3,0,1,0,7,0,3,0,0,0,40,0,3,0,1,0,7,0,8,0,0,0,41,0,2,
+0,1,0,6,0,0,0,42,0,3,0,1,0,2,0,10,0,0,0,40,0,3,0,1,0,2,0,11,0,0,0,40,0,3,
+0,1,0,7,0,10,0,0,0,40,0,3,0,1,0,7,0,11,0,0,0,40,0,2,0,18,0,6,0,228,0,238,
+1,6,1,21,2,27,1,146,0,1,0,6,0,13,0,15,0,24,0,31,1,145,1,164,0,2,0,18,0,6,
+0,231,0,232,1,207,0,233,0,231,1,209,0,1,0,6,0,13,0,14,0,31,0,36,0,228,1,164,
+0,2,0,10,0,2,2,14,1,252,0,1,0,2,0,31,1,164,0,1,0,6,1,240,0,1,0,1,0,31,0,1,
+0,6,1,251,0,1,0,1,0,31,0,1,0,6,1,250,0,1,0,1,0,31,0,1,0,24,0,9,0,46,0,46,
+0,46,0,50,0,54,0,60,0,66,0,72,0,76,0,1,0,9,0,48,1,160,1,165,1,166,1,174,1,
+175,1,194,1,200,1,221,0,1,1,186,0,1,1,153,0,2,1,144,1,186,0,2,0,48,1,186,
+0,2,1,165,1,186,0,1,1,167,0,2,1,220,1,186,0,1,0,48,0,21,0,94,0,100,0,106,
+0,110,0,114,0,118,0,124,0,130,0,136,0,142,0,148,0,152,0,156,0,162,0,168,0,
+172,0,176,0,182,0,188,0,194,0,200,0,1,0,21,0,178,0,179,0,209,1,142,1,160,
+1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,194,1,195,1,196,1,197,1,201,1,
+202,1,210,1,211,1,221,0,2,1,166,0,210,0,2,1,166,1,143,0,1,0,210,0,1,1,143,
+0,1,1,183,0,2,1,144,1,183,0,2,0,48,1,183,0,2,1,166,1,181,0,2,1,166,1,182,
+0,2,1,166,1,183,0,1,1,182,0,1,1,181,0,2,1,165,1,183,0,2,1,200,1,183,0,1,1,
+199,0,1,1,198,0,2,1,200,0,210,0,2,1,200,1,143,0,2,1,200,1,198,0,2,1,200,1,
+199,0,2,1,220,1,183,0,1,0,34,0,14,0,66,0,72,0,78,0,84,0,90,0,96,0,102,0,108,
+0,114,0,120,0,126,0,132,0,138,0,144,0,1,0,14,0,178,0,179,1,174,1,175,1,176,
+1,177,1,178,1,194,1,195,1,201,1,202,1,210,1,211,1,221,0,2,1,166,0,210,0,2,
+1,166,1,143,0,2,1,144,1,186,0,2,0,48,1,186,0,2,1,166,1,181,0,2,1,166,1,182,
+0,2,1,166,1,186,0,2,1,165,1,186,0,2,1,200,1,186,0,2,1,200,0,210,0,2,1,200,
+1,143,0,2,1,200,1,198,0,2,1,200,1,199,0,2,1,220,1,186,0,1,0,36,0,15,0,70,
+0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,122,0,104,0,110,0,128,0,134,
+0,140,0,1,0,15,1,160,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,194,1,195,
+1,196,1,197,1,210,1,211,1,221,0,1,1,183,0,2,1,144,1,183,0,2,0,48,1,183,0,
+2,0,178,1,183,0,2,0,179,1,183,0,2,1,166,1,183,0,2,1,142,1,183,0,2,0,209,1,
+183,0,2,1,165,1,183,0,2,1,200,1,183,0,2,1,201,1,183,0,2,1,202,1,183,0,2,1,
+220,1,183,0,1,0,36,0,15,0,70,0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,
+122,0,104,0,110,0,128,0,134,0,140,0,1,0,15,1,160,1,174,1,175,1,176,1,177,
+1,178,1,179,1,180,1,194,1,195,1,196,1,197,1,210,1,211,1,221,0,1,2,22,0,2,
+1,144,2,22,0,2,0,48,2,22,0,2,0,178,2,22,0,2,0,179,2,22,0,2,1,166,2,22,0,2,
+1,142,2,22,0,2,0,209,2,22,0,2,1,165,2,22,0,2,1,200,2,22,0,2,1,201,2,22,0,
+2,1,202,2,22,0,2,1,220,2,22,0,2,0,20,0,7,2,16,2,17,2,18,2,19,2,22,2,20,2,
+21,0,1,0,7,0,210,1,143,1,181,1,182,1,183,1,198,1,199,0,2,0,16,0,5,1,242,2,
+2,2,3,2,4,2,5,0,1,0,5,0,47,0,194,1,187,1,216,1,222,0,2,0,16,0,5,0,198,0,195,
+1,188,1,217,1,223,0,1,0,5,0,47,0,194,1,187,1,216,1,222,0,2,0,16,0,5,1,214,
+1,226,1,248,1,227,1,231,0,1,0,5,0,47,0,194,1,187,1,216,1,222,0,2,0,16,0,5,
+1,238,1,249,1,250,2,9,2,11,0,1,0,5,0,47,0,194,1,187,1,216,1,222,0,2,0,56,
+0,25,0,199,0,196,0,197,0,200,1,189,1,190,1,215,1,218,1,219,1,224,1,225,1,
+233,1,228,1,232,1,239,1,243,1,235,2,7,2,8,1,234,1,247,2,13,2,6,2,10,2,12,
+0,1,0,25,0,47,0,194,0,195,0,198,1,187,1,188,1,214,1,216,1,217,1,222,1,223,
+1,226,1,227,1,231,1,238,1,242,1,248,1,249,1,250,2,2,2,3,2,4,2,5,2,9,2,11,
+0,2,0,26,0,10,0,201,0,202,0,205,0,206,1,236,1,237,1,240,1,241,1,244,1,245,
+0,1,0,10,0,47,0,198,0,199,0,200,1,214,1,215,1,238,1,239,1,242,1,243,0,2,0,
+22,0,8,0,204,0,208,1,253,1,254,1,255,2,0,1,251,2,1,0,1,0,8,0,198,0,200,1,
+214,1,215,1,238,1,239,1,242,1,243,0,2,0,14,0,4,1,246,0,203,0,207,2,24,0,1,
+0,4,0,47,0,198,0,199,0,200,};
+#endif
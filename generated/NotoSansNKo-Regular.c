@@ -0,0 +1,779 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansNKo_Regular_ttf_size = 18792;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansNKo_Regular_ttf");
+asm(".type fz_font_NotoSansNKo_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansNKo_Regular_ttf, 18792");
+asm(".balign 64");
+asm("fz_font_NotoSansNKo_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansNKo-Regular.ttf\"");
+#else
+const int fz_font_NotoSansNKo_Regular_ttf_size = 18792;
+const char fz_font_NotoSansNKo_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,170,1,29,0,0,66,180,0,0,0,42,71,
+80,79,83,101,158,94,128,0,0,66,224,0,0,4,146,71,83,85,66,25,198,35,58,0,0,
+71,116,0,0,1,242,79,83,47,50,181,141,101,176,0,0,1,104,0,0,0,96,99,109,97,
+112,43,8,66,171,0,0,4,124,0,0,0,140,103,97,115,112,0,7,0,7,0,0,66,168,0,0,
+0,12,103,108,121,102,112,203,209,232,0,0,6,104,0,0,54,46,104,101,97,100,3,
+175,186,235,0,0,0,236,0,0,0,54,104,104,101,97,14,20,2,46,0,0,1,36,0,0,0,36,
+104,109,116,120,161,215,31,11,0,0,1,200,0,0,2,180,108,111,99,97,54,228,41,
+88,0,0,5,8,0,0,1,94,109,97,120,112,0,180,0,104,0,0,1,72,0,0,0,32,110,97,109,
+101,137,105,182,158,0,0,60,152,0,0,5,238,112,111,115,116,255,105,0,102,0,
+0,66,136,0,0,0,32,0,1,0,0,0,1,5,31,221,79,237,220,95,15,60,245,0,11,8,0,0,
+0,0,0,204,227,158,134,0,0,0,0,210,40,203,252,254,81,253,211,7,51,8,121,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,7,154,254,81,252,63,7,51,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,0,1,0,0,0,174,0,103,0,5,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,64,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,64,0,0,0,0,0,
+0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,
+0,0,0,65,0,8,0,0,0,0,0,0,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,
+0,1,179,0,81,1,179,0,90,3,102,0,113,3,54,0,70,4,82,0,111,4,86,0,184,4,92,
+0,240,4,29,1,47,4,80,0,203,4,80,1,37,4,51,0,203,4,86,0,211,4,86,0,211,4,111,
+0,195,2,31,0,180,5,72,0,141,3,127,0,8,4,244,0,63,4,190,0,180,4,104,0,100,
+5,41,0,127,4,45,0,102,5,123,0,94,3,90,0,180,3,90,0,139,4,131,0,180,3,229,
+0,80,3,4,0,72,6,86,0,180,3,33,0,80,5,51,0,80,5,170,0,180,4,156,0,80,5,221,
+0,180,4,90,0,160,4,160,0,94,4,43,0,102,4,156,0,80,4,84,0,100,4,90,0,160,4,
+90,0,160,4,51,0,180,4,43,0,139,4,59,0,100,3,160,0,100,3,160,0,100,3,33,0,
+80,0,0,0,104,0,0,0,29,0,0,1,125,0,0,0,150,0,0,0,104,0,0,0,31,0,0,0,55,0,0,
+1,125,0,0,0,127,2,180,0,168,2,180,0,168,4,111,0,80,7,154,0,102,3,217,0,102,
+3,217,0,102,3,86,255,186,0,0,255,220,0,0,255,37,0,0,255,220,0,0,254,81,4,
+205,0,133,4,205,0,153,4,1,0,17,4,1,0,87,2,31,0,180,2,31,255,186,2,31,255,
+186,5,72,0,141,5,72,255,186,5,72,255,186,3,127,0,8,3,127,255,186,3,127,255,
+186,4,244,0,63,4,244,255,186,4,244,255,186,4,188,0,180,4,188,255,186,4,188,
+255,186,4,104,0,100,4,104,255,186,4,104,255,186,5,41,0,127,5,41,255,186,5,
+41,255,186,4,45,0,102,4,45,255,186,4,45,255,186,5,123,0,94,5,123,255,186,
+5,123,255,186,3,90,0,180,3,90,255,186,3,90,255,186,3,90,0,139,3,90,255,186,
+3,90,255,186,4,131,0,180,4,131,255,186,4,131,255,186,3,229,0,80,3,229,255,
+186,3,229,255,186,3,4,0,72,3,4,255,186,3,4,255,186,6,86,0,180,6,86,255,186,
+6,86,255,186,3,33,0,80,3,33,255,186,3,33,255,186,5,51,0,80,5,51,255,186,5,
+51,255,186,5,170,0,180,5,170,255,186,5,170,255,186,4,156,0,80,4,156,255,186,
+4,156,255,186,5,221,0,180,5,221,255,186,5,221,255,186,4,90,0,160,4,90,255,
+186,4,90,255,186,4,160,0,94,4,160,255,186,4,160,255,186,4,43,0,102,4,43,255,
+186,4,43,255,186,4,156,0,80,4,156,255,186,4,156,255,186,4,84,0,100,4,84,255,
+186,4,84,255,186,4,90,0,160,4,90,255,186,4,90,255,186,4,90,0,160,4,90,255,
+186,4,90,255,186,4,51,0,180,4,51,255,186,4,51,255,186,4,43,0,139,4,43,255,
+186,4,43,255,186,4,59,0,100,4,59,255,186,4,59,255,186,3,160,0,176,3,160,255,
+186,3,160,255,186,3,160,0,176,3,160,255,186,3,160,255,186,3,33,0,80,255,186,
+255,186,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,128,0,0,0,28,0,16,0,3,0,12,0,0,0,13,
+0,32,0,160,6,12,6,27,6,31,6,106,7,250,32,15,46,29,253,63,254,255,255,255,
+0,0,0,0,0,13,0,32,0,160,6,12,6,27,6,31,6,106,7,192,32,12,46,28,253,62,254,
+255,255,255,0,1,255,245,255,227,255,99,249,248,249,234,249,231,249,157,248,
+72,224,55,210,43,3,11,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,52,0,97,0,164,0,224,1,14,1,44,1,66,
+1,88,1,111,1,130,1,150,1,175,1,206,1,249,2,7,2,56,2,84,2,110,2,130,2,148,
+2,199,2,228,3,18,3,40,3,62,3,98,3,124,3,149,3,202,3,224,4,3,4,31,4,59,4,118,
+4,143,4,187,4,206,4,235,5,30,5,56,5,78,5,111,5,159,5,212,6,2,6,58,6,81,6,
+94,6,144,6,167,6,195,6,217,7,9,7,31,7,54,7,92,7,113,7,133,7,187,8,74,8,104,
+8,151,8,164,8,177,8,206,8,230,8,253,9,13,9,28,9,136,9,241,10,1,10,31,10,53,
+10,109,10,171,10,225,11,1,11,49,11,87,11,115,11,149,11,181,11,213,12,4,12,
+42,12,73,12,107,12,133,12,181,12,245,13,43,13,72,13,104,13,136,13,184,13,
+248,14,47,14,72,14,112,14,142,14,166,14,207,14,239,15,28,15,78,15,118,15,
+147,15,191,15,227,15,255,16,42,16,76,16,157,16,246,17,69,17,95,17,136,17,
+168,17,215,18,22,18,77,18,118,18,165,18,203,18,234,19,29,19,69,19,141,19,
+219,20,27,20,54,20,96,20,129,20,176,20,240,21,38,21,60,21,100,21,129,21,159,
+21,190,21,224,22,22,22,94,22,155,22,184,22,229,23,10,23,35,23,76,23,109,23,
+154,23,205,23,248,24,43,24,112,24,169,24,225,25,43,25,106,25,156,25,215,26,
+9,26,69,26,138,26,198,26,222,26,251,27,23,0,0,0,2,0,193,0,0,4,10,5,182,0,
+3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,
+250,74,104,4,230,0,0,1,0,81,0,154,1,90,2,183,0,16,0,0,1,6,6,21,20,22,23,6,
+6,35,34,38,38,53,52,54,55,1,90,49,65,61,53,9,77,51,38,58,32,122,87,2,137,
+54,170,54,28,35,17,61,76,38,66,31,77,236,93,0,0,2,0,90,0,141,1,99,4,153,0,
+16,0,25,0,0,1,6,6,21,20,22,23,6,6,35,34,38,38,53,52,54,55,3,54,54,55,22,21,
+20,7,38,1,99,49,65,61,53,9,77,51,38,58,32,122,87,205,23,42,26,156,84,100,
+4,107,54,170,54,28,35,17,61,76,38,66,31,77,236,93,252,95,41,80,38,91,30,23,
+122,69,0,0,2,0,113,0,131,2,252,5,146,0,31,0,42,0,0,1,54,53,52,38,39,38,38,
+53,52,54,54,51,50,23,22,21,20,7,38,38,35,34,6,7,22,23,22,22,21,20,7,7,54,
+54,55,22,22,21,20,7,39,38,1,156,14,64,92,79,78,108,177,100,150,88,28,62,61,
+95,71,94,161,34,29,39,183,122,70,207,24,41,26,84,72,84,46,47,2,13,84,28,40,
+64,51,43,111,73,95,195,117,94,30,37,59,54,57,42,124,101,18,17,83,126,80,86,
+140,238,41,80,38,48,61,11,22,124,33,34,0,0,3,0,70,0,153,2,240,5,32,0,12,0,
+22,0,32,0,0,55,38,39,54,0,55,22,22,23,20,7,6,0,3,54,54,55,22,22,21,20,7,38,
+1,54,54,55,22,22,21,20,7,38,181,47,26,80,1,71,133,24,32,1,7,131,254,200,185,
+29,50,32,102,86,103,117,1,47,29,51,32,102,86,103,100,153,38,62,170,2,134,
+243,17,60,30,20,14,247,253,152,2,229,50,97,48,59,75,16,29,146,86,253,142,
+50,97,48,59,75,16,28,148,77,0,0,2,0,111,255,236,3,227,5,182,0,11,0,23,0,0,
+1,16,2,35,34,2,17,16,18,51,50,18,1,16,18,51,50,18,17,16,2,35,34,2,3,227,218,
+210,224,232,218,222,219,225,253,64,128,140,129,125,121,141,138,122,2,209,
+254,155,254,128,1,113,1,116,1,116,1,113,254,131,254,148,254,209,254,237,1,
+28,1,38,1,37,1,37,254,230,0,1,0,184,0,0,3,250,5,182,0,14,0,0,37,33,21,33,
+53,33,17,33,1,7,3,38,39,22,21,2,143,1,74,252,223,1,33,1,12,1,21,144,147,48,
+28,4,160,160,160,5,22,253,246,78,1,23,96,70,108,116,0,1,0,240,0,0,3,203,5,
+182,0,9,0,0,1,17,33,17,35,17,51,17,33,17,3,203,253,219,182,182,1,110,5,182,
+253,70,253,4,5,182,253,230,2,26,0,1,1,47,0,0,3,82,5,182,0,9,0,0,1,17,33,53,
+33,17,33,53,33,17,3,82,253,221,1,109,254,147,1,109,5,182,250,74,160,1,162,
+159,2,213,0,1,0,203,0,0,3,43,5,182,0,9,0,0,1,17,33,17,33,21,33,17,33,17,3,
+43,254,86,1,170,253,160,1,170,5,182,252,246,253,244,160,3,76,2,106,0,0,1,
+1,37,0,0,3,104,5,182,0,7,0,0,1,33,17,35,17,51,17,33,3,104,254,115,182,182,
+1,141,2,172,253,84,5,182,253,150,0,1,0,203,0,0,3,104,5,182,0,7,0,0,1,17,33,
+17,35,17,33,17,1,129,1,231,182,254,25,5,182,253,150,252,180,2,172,3,10,0,
+0,1,0,211,0,0,3,246,5,182,0,10,0,0,1,20,7,54,55,1,23,1,35,17,51,1,137,4,35,
+45,1,145,144,253,190,225,182,1,190,115,108,88,76,2,193,78,252,10,5,182,0,
+2,0,211,0,0,3,227,5,182,0,6,0,13,0,0,1,33,21,1,35,17,51,3,54,55,1,33,17,20,
+1,137,2,90,253,209,225,182,4,35,45,1,43,254,137,4,45,90,252,45,5,182,251,
+41,88,76,2,10,254,49,115,0,0,2,0,195,255,233,3,172,5,182,0,14,0,26,0,0,5,
+17,38,38,53,52,54,51,50,22,21,20,6,7,17,3,34,6,21,20,22,51,50,54,53,52,38,
+1,219,131,149,202,168,173,202,152,131,90,87,101,100,88,86,103,103,23,3,58,
+23,175,129,149,183,179,157,129,171,23,252,198,5,56,100,76,90,101,99,83,82,
+103,0,1,0,180,0,0,1,106,5,182,0,3,0,0,1,17,35,17,1,106,182,5,182,250,74,5,
+182,0,0,2,0,141,255,236,4,186,4,70,0,15,0,29,0,0,1,20,2,6,35,34,38,2,53,52,
+54,54,51,50,22,22,5,20,22,22,51,50,54,54,53,52,38,35,34,6,4,186,136,246,154,
+157,244,132,141,248,150,155,244,131,252,142,84,159,107,101,159,86,187,161,
+154,194,2,43,164,254,249,148,139,1,0,166,156,254,143,139,246,183,111,177,
+99,104,185,113,177,216,228,0,0,1,0,8,0,0,3,119,5,182,0,12,0,0,19,51,19,22,
+23,54,54,19,51,1,17,35,17,8,180,177,51,30,16,41,204,180,254,164,183,5,182,
+254,129,114,82,44,96,1,183,253,23,253,51,2,205,0,0,1,0,63,0,0,4,180,4,27,
+0,10,0,0,1,51,1,35,2,2,39,6,7,3,35,2,31,182,1,223,196,157,171,47,62,69,242,
+197,4,27,251,229,1,91,1,121,142,176,151,253,229,0,0,1,0,180,0,0,4,10,4,27,
+0,7,0,0,1,17,33,17,51,17,33,17,1,106,1,234,182,252,170,4,27,252,133,3,123,
+251,229,4,27,0,0,1,0,100,0,0,3,180,4,27,0,7,0,0,33,33,53,33,17,33,53,33,3,
+180,252,176,2,154,253,102,3,80,160,2,219,160,0,2,0,127,0,0,4,170,5,182,0,
+19,0,31,0,0,33,33,53,33,17,38,38,53,52,54,54,51,50,4,21,20,6,7,17,33,1,34,
+6,21,20,22,51,50,54,53,52,38,4,68,252,159,1,86,207,235,128,244,165,247,1,
+27,235,207,1,84,254,82,164,189,191,170,155,187,189,160,1,209,20,217,176,128,
+192,104,225,199,175,222,18,254,49,4,119,143,120,121,139,143,115,123,142,0,
+0,2,0,102,0,0,3,199,5,90,0,3,0,12,0,0,33,33,53,33,1,39,54,18,55,51,6,2,7,
+3,199,252,159,3,97,253,231,14,23,94,59,133,31,60,11,160,2,78,22,112,1,69,
+161,147,254,147,108,0,0,2,0,94,0,0,4,199,5,182,0,18,0,29,0,0,33,17,35,17,
+35,17,35,34,38,53,52,54,51,50,22,21,21,33,17,1,20,22,51,51,53,52,38,35,34,
+6,4,16,245,183,131,181,206,198,159,161,183,1,172,252,77,111,107,118,89,79,
+77,91,3,2,254,242,1,16,185,169,153,183,192,174,164,252,92,4,98,88,102,182,
+90,99,97,0,0,1,0,180,0,0,2,207,5,182,0,9,0,0,1,33,17,35,17,33,21,33,17,33,
+2,207,254,155,182,2,27,254,155,1,101,2,209,253,47,5,182,159,254,90,0,1,0,
+139,0,0,2,166,5,182,0,9,0,0,19,33,17,35,17,33,53,33,17,33,139,2,27,182,254,
+155,1,101,254,155,5,182,250,74,2,209,160,1,166,0,0,2,0,180,0,0,3,242,5,182,
+0,11,0,20,0,0,1,17,51,50,22,21,20,6,6,35,33,17,19,17,51,50,54,53,52,38,35,
+1,106,185,227,236,112,206,139,254,139,182,197,125,139,143,135,5,182,253,189,
+230,213,123,203,114,5,182,253,29,253,205,149,131,132,151,0,1,0,80,0,0,3,127,
+5,182,0,12,0,0,33,53,52,2,2,39,53,33,21,33,0,17,21,2,80,89,207,216,3,47,253,
+172,1,219,254,229,1,70,1,43,195,159,159,254,91,253,140,254,0,1,0,72,0,0,2,
+80,5,182,0,11,0,0,1,52,55,14,2,7,39,1,51,17,35,1,154,4,6,24,36,133,143,1,
+39,225,182,3,248,115,108,16,51,73,235,78,2,8,250,74,0,3,0,180,0,0,5,162,4,
+41,0,14,0,22,0,31,0,0,19,52,54,51,50,22,23,54,54,51,50,22,21,17,33,37,33,
+17,16,35,34,6,21,1,33,17,52,38,35,34,6,21,180,172,154,85,125,29,33,169,118,
+186,191,251,18,2,168,1,144,197,99,104,254,14,1,60,78,80,83,75,1,233,237,226,
+68,53,109,125,235,222,253,160,160,1,215,1,18,150,139,254,56,1,100,147,130,
+136,155,0,0,1,0,80,0,0,2,209,5,182,0,11,0,0,19,51,17,51,17,51,21,35,17,35,
+17,35,80,229,183,229,229,183,229,4,27,1,155,254,101,160,252,133,3,123,0,2,
+0,80,0,0,4,227,5,182,0,15,0,19,0,0,19,51,17,51,17,33,17,51,17,51,21,35,17,
+33,17,35,33,17,33,17,80,229,183,1,92,182,229,229,253,55,229,1,156,1,92,4,
+27,1,155,254,101,1,155,254,101,160,252,133,3,123,253,37,2,219,0,2,0,180,0,
+0,4,246,4,27,0,6,0,13,0,0,33,33,17,52,54,51,33,1,33,17,33,34,6,21,4,246,251,
+190,162,168,2,248,252,116,2,213,253,177,67,67,2,227,158,154,252,133,2,219,
+77,89,0,2,0,80,0,0,4,76,5,182,0,5,0,12,0,0,33,35,1,53,33,21,7,33,19,22,23,
+54,55,2,170,182,254,92,3,252,207,253,166,231,58,14,34,31,5,92,90,90,69,252,
+251,189,89,172,102,0,0,3,0,180,0,0,5,121,5,182,0,20,0,30,0,39,0,0,1,53,52,
+54,51,50,22,21,20,6,35,35,17,20,6,35,33,17,52,54,51,3,51,50,54,53,17,35,34,
+6,21,1,51,50,53,52,38,35,34,21,2,227,178,162,143,179,213,191,75,162,168,254,
+100,162,168,148,244,69,64,243,67,67,2,48,82,215,79,71,147,3,164,168,170,192,
+188,148,165,189,254,51,158,153,2,109,157,154,252,252,80,86,1,190,77,89,1,
+70,198,81,92,187,0,1,0,160,0,0,3,166,5,182,0,11,0,0,1,17,35,17,33,17,35,17,
+51,17,33,17,3,166,182,254,102,182,182,1,154,5,182,250,74,3,123,254,207,2,
+219,254,246,1,155,0,0,2,0,94,0,0,4,80,5,182,0,16,0,27,0,0,1,17,35,17,35,34,
+38,53,52,54,51,50,22,21,21,33,21,1,20,22,51,51,53,52,38,35,34,6,3,27,183,
+84,207,227,200,161,159,181,1,53,252,196,133,126,77,79,80,82,95,2,211,253,
+45,2,211,201,176,164,198,193,171,215,160,1,129,112,113,229,91,100,107,0,0,
+1,0,102,0,0,3,197,5,182,0,7,0,0,19,33,21,33,17,35,17,33,102,3,95,254,172,
+183,254,172,5,182,159,250,233,5,23,0,0,2,0,80,0,0,4,76,5,182,0,5,0,12,0,0,
+1,51,1,21,33,53,55,33,3,38,39,6,6,1,242,182,1,164,252,4,207,2,90,232,55,16,
+24,23,5,182,250,164,90,90,70,3,4,182,96,122,90,0,0,2,0,100,0,0,3,199,5,182,
+0,19,0,31,0,0,19,33,17,22,22,21,20,6,7,17,35,17,38,38,53,52,54,55,53,33,1,
+34,6,21,20,22,51,50,54,53,52,38,100,2,52,147,156,164,139,183,144,159,158,
+145,254,131,1,215,96,113,110,103,101,106,108,5,182,254,121,21,172,135,136,
+175,18,254,98,1,160,20,169,140,133,172,21,232,254,127,91,84,82,92,93,81,82,
+93,0,1,0,160,0,0,3,166,5,182,0,13,0,0,1,17,35,17,33,34,6,21,17,35,17,52,54,
+51,3,166,182,254,235,66,67,182,161,168,5,182,250,74,5,23,78,88,254,204,1,
+66,158,153,0,1,0,160,0,0,3,166,5,182,0,9,0,0,1,17,33,17,35,17,33,17,35,17,
+1,86,2,80,182,254,102,182,5,182,254,195,251,135,3,217,254,201,3,20,0,2,0,
+180,0,0,3,127,5,182,0,10,0,17,0,0,19,33,17,33,17,52,54,51,51,17,33,19,33,
+17,35,34,6,21,201,2,182,253,53,162,168,203,254,0,161,1,95,217,67,67,5,182,
+250,74,2,59,158,154,1,164,251,137,2,51,77,89,0,2,0,139,0,0,3,160,5,182,0,
+17,0,29,0,0,33,17,38,38,53,52,54,55,17,51,17,22,22,21,20,6,7,17,3,34,6,21,
+20,22,51,50,54,53,52,38,1,186,144,159,158,145,183,147,156,164,139,93,97,111,
+113,100,100,106,108,1,160,20,169,140,133,172,21,1,135,254,121,21,172,135,
+136,175,18,254,98,3,150,93,82,84,90,93,81,82,93,0,0,2,0,100,0,0,3,215,5,182,
+0,21,0,33,0,0,19,33,21,33,21,22,22,21,20,6,7,17,35,17,38,38,53,52,54,55,53,
+33,1,34,6,21,20,22,51,50,54,53,52,38,100,3,115,254,162,147,156,163,140,182,
+146,158,158,146,254,161,1,185,98,111,113,100,100,107,109,5,182,159,232,21,
+170,137,136,175,18,254,98,1,160,20,173,136,133,171,22,232,254,127,92,83,84,
+90,93,81,82,93,0,1,0,100,253,211,3,117,2,61,0,27,0,0,5,51,6,4,35,34,38,53,
+52,55,54,55,53,33,53,33,54,55,51,6,3,7,3,22,51,50,54,54,2,238,135,55,254,
+253,184,91,120,85,125,15,254,211,1,127,101,92,188,54,145,85,197,18,29,66,
+121,109,90,230,237,69,54,21,155,227,29,2,160,199,214,136,254,222,174,254,
+146,6,78,154,0,2,0,100,253,211,3,96,2,61,0,24,0,35,0,0,33,33,53,33,18,55,
+51,6,2,7,51,50,22,21,20,6,6,35,34,38,53,52,54,55,55,3,22,51,50,54,53,52,38,
+35,35,7,1,145,254,211,1,127,150,43,188,54,152,80,36,112,124,127,209,115,102,
+121,68,75,82,18,18,34,80,153,58,51,53,60,160,1,44,113,136,254,204,158,98,
+84,78,165,103,70,53,16,130,133,153,254,121,6,107,63,41,22,113,0,0,1,0,80,
+253,211,2,209,2,152,0,11,0,0,1,17,51,21,35,17,35,17,35,53,51,17,1,236,229,
+229,183,229,229,2,152,254,8,160,253,211,2,45,160,1,248,0,0,1,0,104,6,127,
+3,119,7,16,0,3,0,0,19,33,21,33,104,3,15,252,241,7,16,145,0,1,0,29,6,102,3,
+190,7,170,0,29,0,0,1,50,54,55,23,7,6,6,35,34,38,39,39,38,38,35,34,6,7,39,
+55,54,54,51,50,22,23,23,22,22,2,139,23,81,99,104,33,115,110,51,35,55,53,105,
+14,26,25,23,81,99,104,33,112,112,54,39,58,46,105,14,26,6,254,67,105,102,32,
+121,67,19,39,84,11,17,67,105,103,32,118,69,20,37,84,11,18,0,0,1,1,125,6,111,
+2,98,7,100,0,11,0,0,1,34,38,53,52,54,51,50,22,21,20,6,1,240,55,60,67,48,52,
+62,62,6,111,65,57,65,58,63,60,58,64,0,0,1,0,150,6,102,3,74,8,80,0,13,0,0,
+19,54,18,55,51,22,19,21,35,38,39,6,7,35,150,67,143,41,185,53,203,127,83,140,
+109,111,122,6,125,101,1,12,98,142,254,187,23,75,224,195,104,0,0,1,0,104,6,
+115,3,168,8,121,0,8,0,0,1,33,53,33,38,38,39,55,1,3,119,252,241,2,123,21,66,
+146,108,1,66,6,115,145,23,76,182,92,254,112,0,1,0,31,6,102,3,193,7,170,0,
+28,0,0,1,50,22,23,23,7,38,38,35,34,6,7,6,6,35,34,38,39,39,55,22,22,51,50,
+54,55,55,54,54,2,137,49,102,86,75,105,98,81,24,22,27,121,51,55,37,52,113,
+111,33,104,98,81,24,23,26,14,105,46,57,7,168,57,87,75,103,105,67,15,97,38,
+20,71,117,32,102,105,67,18,11,84,37,20,0,1,0,55,6,115,3,119,8,121,0,8,0,0,
+19,1,23,6,6,7,33,21,33,55,1,66,108,134,58,41,2,123,252,241,6,233,1,144,92,
+169,68,44,145,0,0,1,1,125,254,135,2,98,255,125,0,11,0,0,1,34,38,53,52,54,
+51,50,22,21,20,6,1,240,48,67,67,48,52,62,61,254,135,58,65,65,58,63,60,59,
+64,0,0,2,0,127,6,111,3,94,7,100,0,11,0,23,0,0,19,34,38,53,52,54,51,50,22,
+21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,242,55,60,67,48,52,62,62,1,198,
+55,60,67,48,52,62,62,6,111,65,57,65,58,63,60,58,64,65,57,65,58,63,60,58,64,
+0,0,1,0,168,2,238,1,221,5,90,0,7,0,0,1,23,6,2,7,35,18,19,1,207,14,25,96,55,
+133,64,38,5,90,22,121,254,185,150,1,48,1,60,0,1,0,168,2,238,1,221,5,90,0,
+7,0,0,19,39,54,19,51,6,2,7,182,14,51,125,133,31,60,11,2,238,22,243,1,99,147,
+254,147,108,0,2,0,80,0,0,4,8,5,182,0,22,0,34,0,0,33,33,53,54,0,55,6,35,34,
+38,53,52,54,51,50,22,21,20,14,2,7,33,1,34,6,21,20,22,51,50,54,53,52,38,4,
+8,252,72,251,1,54,88,51,53,198,228,236,194,192,211,74,150,204,194,2,110,254,
+94,107,124,126,112,110,117,126,90,197,1,68,147,17,190,171,162,198,195,180,
+103,215,225,214,170,4,119,115,86,96,109,113,100,87,106,0,5,0,102,255,170,
+7,51,5,225,0,30,0,66,0,78,0,90,0,102,0,0,19,52,54,54,51,38,53,52,54,54,51,
+50,4,21,20,6,7,50,22,22,21,20,6,35,32,39,6,6,35,34,36,37,20,22,51,50,54,53,
+52,38,35,34,7,39,54,54,53,52,38,35,34,6,21,20,23,7,38,35,34,6,21,20,22,51,
+50,54,53,5,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,
+38,1,52,54,51,50,22,21,20,6,35,34,38,102,120,216,131,86,125,222,133,230,1,
+5,48,34,138,213,120,252,221,254,231,120,65,204,118,224,255,0,3,183,156,145,
+144,165,160,149,78,55,93,79,67,160,149,148,153,153,88,57,88,148,153,158,143,
+145,164,1,82,66,59,61,68,68,61,59,66,254,123,66,59,61,68,68,61,59,66,254,
+131,66,59,61,68,68,61,59,66,1,119,130,203,111,97,159,128,196,106,231,211,
+79,127,38,105,201,138,213,248,170,88,82,243,222,149,164,160,147,145,156,21,
+129,47,133,91,145,156,157,144,191,88,127,27,157,144,146,161,164,149,8,69,
+68,71,66,65,75,71,2,237,69,68,71,66,65,75,71,253,157,69,68,71,66,65,75,71,
+0,0,2,0,102,0,0,3,115,3,244,0,11,0,15,0,0,1,52,54,51,50,22,21,20,6,35,34,
+38,1,33,53,33,1,109,65,59,61,68,68,61,58,66,2,6,252,243,3,13,3,106,68,70,
+72,66,64,75,73,252,216,160,0,3,0,102,255,236,3,115,4,201,0,11,0,15,0,27,0,
+0,1,52,54,51,50,22,21,20,6,35,34,38,1,33,53,33,1,52,54,51,50,22,21,20,6,35,
+34,38,1,109,66,58,61,68,68,61,52,72,2,6,252,243,3,13,253,250,66,58,61,68,
+70,59,52,72,2,115,69,68,71,66,65,75,66,2,0,160,251,174,69,68,71,66,66,73,
+65,0,0,1,255,186,0,0,3,156,0,160,0,3,0,0,33,33,53,33,3,156,252,30,3,226,160,
+0,0,1,255,220,0,183,0,36,6,131,0,3,0,0,19,17,35,17,36,72,6,131,250,52,5,204,
+0,1,255,37,0,183,0,219,6,131,0,14,0,0,55,35,17,7,39,55,39,55,23,55,23,7,23,
+7,39,36,72,134,49,171,171,49,170,170,49,171,171,49,134,183,4,161,136,49,169,
+168,49,171,171,49,168,169,49,136,0,1,255,220,0,183,1,174,6,131,0,10,0,0,1,
+7,39,55,33,17,35,17,33,39,55,1,174,217,49,137,254,246,71,1,81,137,49,5,172,
+214,49,130,251,46,5,25,130,49,0,1,254,81,0,183,0,35,6,131,0,10,0,0,55,35,
+17,33,23,7,39,55,23,7,33,35,71,254,246,137,49,217,217,49,137,1,81,183,4,210,
+130,49,214,215,49,130,0,1,0,133,0,110,4,60,4,36,0,3,0,0,19,1,7,1,243,3,73,
+110,252,183,4,36,252,184,110,3,72,0,0,1,0,153,0,110,4,80,4,36,0,3,0,0,55,
+1,23,1,153,3,73,110,252,183,220,3,72,110,252,184,0,5,0,17,254,203,3,170,6,
+225,0,22,0,30,0,47,0,54,0,61,0,0,1,7,6,6,7,3,6,7,7,6,6,35,34,39,54,54,55,
+55,16,55,54,55,55,1,6,7,38,39,54,55,22,5,22,23,22,19,22,22,23,23,7,39,38,
+39,38,39,38,39,1,6,7,38,39,54,55,19,6,7,38,39,54,55,3,134,51,60,49,11,52,
+4,61,21,49,92,20,68,42,89,89,58,1,14,20,176,108,253,187,48,84,88,59,79,64,
+62,1,126,57,27,14,29,13,52,55,51,25,108,176,20,13,5,5,10,1,142,31,30,40,26,
+17,49,61,31,30,47,19,17,49,6,1,18,23,86,91,254,99,28,105,37,36,46,96,20,36,
+32,102,1,15,117,183,59,36,252,168,69,81,69,65,77,73,69,144,98,121,63,255,
+0,96,85,19,17,70,37,59,183,103,226,120,59,252,150,40,28,31,30,15,53,7,88,
+40,28,39,22,15,53,0,5,0,87,254,202,3,240,6,223,0,22,0,30,0,47,0,54,0,60,0,
+0,23,55,54,54,55,19,54,55,55,54,54,51,50,23,6,6,7,7,16,7,6,7,7,1,54,55,22,
+23,6,7,38,37,38,38,39,39,38,38,39,39,55,23,22,23,22,23,22,23,1,54,55,22,23,
+7,39,3,54,55,22,23,7,123,51,55,53,12,53,5,60,20,43,98,20,69,41,87,85,64,1,
+14,21,175,108,2,69,51,82,84,62,79,64,61,254,130,42,51,14,21,12,48,60,51,25,
+108,175,21,13,5,5,10,254,114,20,41,40,26,66,31,30,20,41,38,28,66,86,17,19,
+86,96,1,156,32,102,37,32,49,95,20,33,36,63,254,202,116,185,57,37,3,89,73,
+77,67,67,77,73,68,144,71,166,124,177,93,84,23,18,70,37,57,185,103,226,122,
+57,3,105,29,39,30,31,68,33,248,135,29,39,29,31,68,0,1,0,180,0,0,2,100,5,182,
+0,5,0,0,1,17,51,21,33,17,1,106,250,254,80,5,182,250,234,160,5,182,0,1,255,
+186,0,0,2,100,5,182,0,18,0,0,51,34,38,39,53,51,17,51,17,22,51,51,21,35,34,
+38,39,6,35,31,17,65,19,250,182,53,158,39,69,64,92,53,59,162,20,13,127,5,22,
+251,94,116,160,45,70,115,0,1,255,186,0,0,1,106,5,182,0,11,0,0,51,34,38,39,
+53,51,17,51,17,20,6,35,31,17,65,19,250,182,132,117,20,13,127,5,22,251,58,
+114,126,0,0,2,0,141,0,0,5,141,4,70,0,22,0,36,0,0,33,35,34,38,39,6,35,34,0,
+53,52,54,54,51,50,22,22,21,20,7,22,51,51,1,20,22,22,51,50,54,54,53,52,38,
+35,34,6,5,141,141,81,103,70,146,206,244,254,223,140,249,150,155,243,132,106,
+62,106,149,251,187,84,156,110,101,158,87,187,161,156,192,47,80,127,1,46,247,
+153,251,141,136,244,151,202,148,53,1,123,109,173,97,100,181,110,174,211,223,
+0,2,255,186,0,0,5,141,4,70,0,27,0,41,0,0,33,35,34,38,39,6,35,33,34,38,39,
+53,33,38,53,52,54,54,51,50,22,22,21,20,7,22,51,51,1,20,22,22,51,50,54,54,
+53,52,38,35,34,6,5,141,141,81,103,70,146,206,253,125,17,65,19,1,90,135,140,
+249,150,155,243,132,106,62,106,149,251,187,84,156,110,101,158,87,187,161,
+156,192,47,80,127,20,13,127,147,242,153,251,141,136,244,151,202,148,53,1,
+123,109,173,97,100,181,110,174,211,223,0,2,255,186,0,0,4,186,4,70,0,19,0,
+33,0,0,1,20,2,6,35,33,34,38,39,53,33,38,53,52,54,54,51,50,22,22,5,20,22,22,
+51,50,54,54,53,52,38,35,34,6,4,186,135,248,153,253,125,17,65,19,1,90,135,
+140,249,150,155,243,132,252,142,84,156,110,101,158,87,187,161,156,192,2,51,
+161,254,255,145,20,13,127,147,242,153,251,141,136,244,175,109,173,97,100,
+181,110,174,211,223,0,0,1,0,8,0,0,3,197,5,182,0,14,0,0,33,33,17,1,51,19,22,
+23,54,54,19,51,1,17,33,3,197,253,159,254,164,180,177,51,30,16,41,204,180,
+254,164,1,170,2,205,2,233,254,129,114,82,44,96,1,183,253,23,253,211,0,0,1,
+255,186,0,0,3,197,5,182,0,27,0,0,33,35,34,38,39,6,35,33,34,38,39,53,33,17,
+1,51,19,22,23,54,54,19,51,1,17,22,51,51,3,197,207,77,107,62,60,163,254,254,
+17,65,19,1,170,254,164,180,177,51,30,16,41,204,180,254,164,51,160,215,47,
+70,117,20,13,127,2,45,2,233,254,129,114,82,44,96,1,183,253,23,254,71,116,
+0,0,1,255,186,0,0,3,119,5,182,0,20,0,0,51,34,38,39,53,33,17,1,51,19,22,23,
+54,54,19,51,1,17,20,6,35,31,17,65,19,1,170,254,164,180,177,51,30,16,41,204,
+180,254,164,134,116,20,13,127,2,45,2,233,254,129,114,82,44,96,1,183,253,23,
+254,35,115,125,0,1,0,63,0,0,5,57,4,27,0,12,0,0,1,51,1,51,21,33,2,2,39,6,7,
+3,35,2,31,182,1,149,207,254,183,157,171,47,62,69,242,197,4,27,252,133,160,
+1,91,1,121,142,176,151,253,229,0,1,255,186,0,0,5,57,4,27,0,17,0,0,39,53,51,
+1,51,1,51,21,33,2,2,39,6,7,3,35,34,38,70,205,1,152,182,1,149,207,254,183,
+157,171,47,62,69,242,229,17,65,33,127,3,123,252,133,160,1,91,1,121,142,176,
+151,253,229,20,0,1,255,186,0,0,4,180,4,27,0,15,0,0,51,34,38,39,53,51,1,51,
+1,35,2,2,39,6,7,3,31,17,65,19,205,1,152,182,1,223,196,157,171,47,62,69,242,
+20,13,127,3,123,251,229,1,91,1,121,142,176,151,253,229,0,0,1,0,180,0,0,5,
+2,4,27,0,17,0,0,1,17,33,17,51,17,22,51,51,21,35,34,38,39,6,35,33,17,1,106,
+1,234,182,51,158,39,70,63,92,53,59,163,253,166,4,27,252,133,3,123,252,245,
+112,160,45,70,115,4,27,0,0,1,255,186,0,0,5,2,4,27,0,30,0,0,1,17,22,51,33,
+17,51,17,22,51,51,21,35,34,38,39,6,35,35,34,38,39,6,35,35,34,38,39,53,51,
+17,1,106,53,158,1,23,182,51,158,39,70,63,92,53,59,163,239,64,92,53,59,162,
+82,17,65,19,250,4,27,252,249,116,3,123,252,245,112,160,45,70,115,45,70,115,
+20,13,127,3,123,0,1,255,186,0,0,4,10,4,27,0,23,0,0,1,51,17,20,6,35,35,34,
+38,39,6,35,35,34,38,39,53,51,17,51,17,22,51,33,3,84,182,132,118,241,64,92,
+53,59,162,82,17,65,19,250,182,53,158,1,23,4,27,252,213,114,126,45,70,115,
+20,13,127,3,123,252,249,116,0,1,0,100,0,0,4,174,4,27,0,17,0,0,1,22,51,51,
+21,35,34,38,39,6,35,33,53,33,17,33,53,33,3,180,53,158,39,70,63,92,53,59,163,
+253,170,2,154,253,102,3,80,1,20,116,160,45,70,115,160,2,219,160,0,1,255,186,
+0,0,4,174,4,27,0,20,0,0,51,34,38,39,53,33,17,33,53,33,17,22,51,51,21,35,34,
+38,39,6,35,31,17,65,19,3,68,253,102,3,80,53,158,39,70,63,92,53,59,163,20,
+13,127,2,219,160,252,249,116,160,45,70,115,0,0,1,255,186,0,0,3,180,4,27,0,
+13,0,0,37,20,6,35,33,34,38,39,53,33,17,33,53,33,3,180,132,118,253,101,17,
+65,19,3,68,253,102,3,80,240,114,126,20,13,127,2,219,160,0,2,0,127,0,0,5,111,
+5,182,0,17,0,29,0,0,33,33,17,38,38,53,52,54,54,51,50,4,21,20,6,7,17,33,1,
+34,6,21,20,22,51,50,54,53,52,38,5,111,252,202,207,235,128,244,165,247,1,27,
+235,207,2,127,253,39,164,189,191,170,155,187,189,2,113,20,217,176,128,192,
+104,225,199,175,222,18,254,49,4,119,143,120,121,139,143,115,123,142,0,2,255,
+186,0,0,5,111,5,182,0,30,0,42,0,0,51,34,38,39,53,33,17,38,38,53,52,54,54,
+51,50,4,21,20,6,7,17,22,51,33,21,33,34,38,39,6,35,19,34,6,21,20,22,51,50,
+54,53,52,38,31,17,65,19,2,127,207,235,128,244,165,247,1,27,235,207,51,158,
+1,174,254,90,75,107,62,59,164,160,164,189,191,170,155,187,189,20,13,127,1,
+209,20,217,176,128,192,104,225,199,175,222,18,254,161,112,160,46,69,115,5,
+23,143,120,121,139,143,115,123,142,0,0,2,255,186,0,0,4,170,5,182,0,23,0,35,
+0,0,51,34,38,39,53,33,17,38,38,53,52,54,54,51,50,4,21,20,6,7,17,20,6,35,19,
+34,6,21,20,22,51,50,54,53,52,38,31,17,65,19,2,127,207,235,128,244,165,247,
+1,27,235,207,134,116,160,164,189,191,170,155,187,189,20,13,127,1,209,20,217,
+176,128,192,104,225,199,175,222,18,254,129,115,125,5,23,143,120,121,139,143,
+115,123,142,0,2,0,102,0,0,4,111,5,90,0,3,0,12,0,0,33,33,53,33,1,39,54,18,
+55,51,6,2,7,4,111,251,247,4,9,253,63,14,23,94,59,133,31,60,11,160,2,78,22,
+112,1,69,161,147,254,147,108,0,0,2,255,186,0,0,4,111,5,90,0,6,0,15,0,0,51,
+34,38,39,53,33,21,1,39,54,18,55,51,6,2,7,31,17,65,19,4,181,253,63,14,23,94,
+59,133,31,60,11,20,13,127,160,2,238,22,112,1,69,161,147,254,147,108,0,0,2,
+255,186,0,0,3,197,5,90,0,6,0,15,0,0,51,34,38,39,53,33,21,1,39,54,18,55,51,
+6,2,7,31,17,65,19,4,11,253,233,14,23,94,59,133,31,60,11,20,13,127,160,2,238,
+22,112,1,69,161,147,254,147,108,0,0,2,0,94,0,0,5,193,5,182,0,20,0,31,0,0,
+33,33,17,35,17,35,17,35,34,38,53,52,54,51,50,22,21,21,33,17,51,1,20,22,51,
+51,53,52,38,35,34,6,5,193,254,79,245,183,131,181,206,198,159,161,183,1,172,
+250,251,83,111,107,118,89,79,77,91,3,2,254,242,1,16,185,169,153,183,192,174,
+164,252,252,3,194,88,102,182,90,99,97,0,2,255,186,0,0,5,193,5,182,0,33,0,
+44,0,0,51,34,38,39,53,33,17,35,17,35,17,35,34,38,53,52,54,51,50,22,21,21,
+33,17,22,51,51,21,35,34,38,39,6,35,1,20,22,51,51,53,52,38,35,34,6,31,17,65,
+19,4,86,245,183,131,181,206,198,159,161,183,1,172,51,160,39,70,64,92,53,59,
+162,253,71,111,107,118,89,79,77,91,20,13,127,2,98,254,242,1,16,185,169,153,
+183,192,174,164,253,112,116,160,45,70,115,4,98,88,102,182,90,99,97,0,0,2,
+255,186,0,0,4,199,5,182,0,26,0,37,0,0,51,34,38,39,53,33,17,35,17,35,17,35,
+34,38,53,52,54,51,50,22,21,21,33,17,20,6,35,1,20,22,51,51,53,52,38,35,34,
+6,31,17,65,19,4,86,245,183,131,181,206,198,159,161,183,1,172,134,116,253,
+71,111,107,118,89,79,77,91,20,13,127,2,98,254,242,1,16,185,169,153,183,192,
+174,164,253,76,115,125,4,98,88,102,182,90,99,97,0,1,0,180,0,0,3,160,5,182,
+0,11,0,0,1,33,17,33,21,33,17,33,21,33,17,33,2,207,254,155,2,54,253,20,2,27,
+254,155,1,101,2,209,253,207,160,5,182,159,254,90,0,1,255,186,0,0,3,160,5,
+182,0,24,0,0,51,34,38,39,53,51,17,33,21,33,17,33,21,33,17,22,51,33,21,33,
+34,38,39,6,35,31,17,65,19,250,2,27,254,155,1,101,254,155,53,158,1,99,254,
+166,77,107,62,60,163,20,13,127,5,22,159,254,90,160,254,67,116,160,47,70,117,
+0,0,1,255,186,0,0,2,207,5,182,0,17,0,0,51,34,38,39,53,51,17,33,21,33,17,33,
+21,33,17,20,6,35,31,17,65,19,250,2,27,254,155,1,101,254,155,132,117,20,13,
+127,5,22,159,254,90,160,254,31,114,126,0,1,0,139,0,0,3,160,5,182,0,11,0,0,
+19,33,17,51,21,33,17,33,53,33,17,33,139,2,27,250,254,80,254,155,1,101,254,
+155,5,182,250,234,160,2,209,160,1,166,0,1,255,186,0,0,3,160,5,182,0,24,0,
+0,19,33,17,22,51,51,21,35,34,38,39,6,35,33,34,38,39,53,33,17,33,53,33,17,
+33,139,2,27,53,158,39,70,65,93,51,59,162,254,115,17,65,19,2,54,254,155,1,
+101,254,155,5,182,251,94,116,160,47,68,115,20,13,127,2,49,160,1,166,0,0,1,
+255,186,0,0,2,166,5,182,0,17,0,0,19,33,17,20,6,35,33,34,38,39,53,33,17,33,
+53,33,17,33,139,2,27,134,116,254,115,17,65,19,2,54,254,155,1,101,254,155,
+5,182,251,58,115,125,20,13,127,2,49,160,1,166,0,2,0,180,0,0,4,201,5,182,0,
+19,0,28,0,0,33,35,34,38,39,6,35,33,17,51,17,51,50,22,21,20,7,22,51,51,1,17,
+51,50,54,53,52,38,35,4,201,140,63,90,55,123,201,254,139,182,185,227,236,60,
+57,109,109,252,161,197,125,139,143,135,45,72,117,5,182,253,189,230,213,126,
+103,51,2,51,253,205,149,131,132,151,0,2,255,186,0,0,4,201,5,182,0,24,0,33,
+0,0,51,34,38,39,53,51,17,51,17,51,50,22,21,20,7,22,51,51,21,35,34,38,39,6,
+35,3,17,51,50,54,53,52,38,35,31,17,65,19,250,182,185,227,236,60,57,109,109,
+101,74,104,69,124,200,191,197,125,139,143,135,20,13,127,5,22,253,189,230,
+213,126,103,51,160,44,73,117,2,211,253,205,149,131,132,151,0,0,2,255,186,
+0,0,3,242,5,182,0,16,0,25,0,0,51,34,38,39,53,51,17,51,17,51,50,22,21,20,6,
+6,35,3,17,51,50,54,53,52,38,35,31,17,65,19,250,182,185,227,236,112,206,139,
+191,197,125,139,143,135,20,13,127,5,22,253,189,230,213,123,203,114,2,211,
+253,205,149,131,132,151,0,1,0,80,0,0,4,43,5,182,0,14,0,0,33,33,53,52,2,2,
+39,53,33,21,33,0,17,21,33,4,43,254,37,89,207,216,3,47,253,172,1,219,1,37,
+254,229,1,70,1,43,195,159,159,254,91,253,140,94,0,1,255,186,0,0,4,43,5,182,
+0,26,0,0,51,34,38,39,53,33,53,52,2,2,39,53,33,21,33,0,19,22,51,51,21,35,34,
+38,39,6,35,31,17,65,19,2,150,89,207,216,3,47,253,172,1,209,10,53,158,82,113,
+65,93,51,57,164,20,13,127,94,229,1,70,1,43,195,159,159,254,99,253,154,116,
+160,47,68,115,0,0,1,255,186,0,0,3,127,5,182,0,20,0,0,51,34,38,39,53,33,53,
+52,2,2,39,53,33,21,33,0,17,21,20,6,35,31,17,65,19,2,150,89,207,216,3,47,253,
+172,1,219,132,118,20,13,127,94,229,1,70,1,43,195,159,159,254,91,253,140,14,
+114,126,0,0,1,0,72,0,0,3,74,5,182,0,13,0,0,1,52,55,14,2,7,39,1,51,17,51,21,
+33,1,154,4,6,24,36,133,143,1,39,225,250,254,80,3,248,115,108,16,51,73,235,
+78,2,8,250,234,160,0,0,1,255,186,0,0,3,74,5,182,0,26,0,0,51,34,38,39,53,33,
+17,52,55,14,2,7,39,1,51,17,22,51,51,21,35,34,38,39,6,35,31,17,65,19,1,224,
+4,6,24,36,133,143,1,39,225,53,158,39,70,65,93,51,59,162,20,13,127,3,88,115,
+108,16,51,73,235,78,2,8,251,94,116,160,47,68,115,0,0,1,255,186,0,0,2,80,5,
+182,0,19,0,0,51,34,38,39,53,33,17,52,55,14,2,7,39,1,51,17,20,6,35,31,17,65,
+19,1,224,4,6,24,36,133,143,1,39,225,134,116,20,13,127,3,88,115,108,16,51,
+73,235,78,2,8,251,58,115,125,0,3,0,180,0,0,6,199,4,41,0,31,0,42,0,55,0,0,
+51,17,52,54,51,50,22,23,62,3,51,50,30,2,21,17,22,51,51,21,35,34,46,2,39,6,
+6,35,37,33,17,52,38,35,34,14,2,21,1,33,17,52,46,2,35,34,14,2,21,180,172,154,
+85,125,29,16,58,81,103,62,88,140,97,52,53,158,82,113,39,58,48,42,22,31,116,
+74,254,180,1,144,93,104,52,77,50,24,254,14,1,60,15,37,61,45,49,62,34,13,1,
+233,237,226,68,53,52,86,62,34,55,113,172,117,254,180,116,160,15,28,43,29,
+60,55,160,1,215,129,145,41,76,106,66,254,56,1,100,64,102,72,39,44,78,107,
+62,0,0,3,255,186,0,0,6,199,4,41,0,38,0,49,0,62,0,0,51,34,46,2,39,53,51,17,
+52,54,51,50,22,23,62,3,51,50,30,2,21,17,22,51,51,21,35,34,46,2,39,6,6,35,
+37,33,17,52,38,35,34,14,2,21,1,33,17,52,46,2,35,34,14,2,21,31,9,28,29,26,
+9,250,172,154,85,125,29,16,58,81,103,62,88,140,97,52,53,158,82,113,39,58,
+48,42,22,31,116,74,254,180,1,144,93,104,52,77,50,24,254,14,1,60,15,37,61,
+45,49,62,34,13,6,9,12,6,127,1,73,237,226,68,53,52,86,62,34,55,113,172,117,
+254,180,116,160,15,28,43,29,60,55,160,1,215,129,145,41,76,106,66,254,56,1,
+100,64,102,72,39,44,78,107,62,0,3,255,186,0,0,5,162,4,41,0,30,0,41,0,54,0,
+0,51,34,46,2,39,53,51,17,52,54,51,50,22,23,62,3,51,50,30,2,21,17,20,14,2,
+35,37,33,17,52,38,35,34,14,2,21,1,33,17,52,46,2,35,34,14,2,21,31,9,28,29,
+26,9,250,172,154,85,125,29,16,58,81,103,62,88,140,97,52,38,68,91,53,254,180,
+1,144,93,104,52,77,50,24,254,14,1,60,15,37,61,45,49,62,34,13,6,9,12,6,127,
+1,73,237,226,68,53,52,86,62,34,55,113,172,117,254,144,62,91,59,28,160,1,215,
+129,145,41,76,106,66,254,56,1,100,64,102,72,39,44,78,107,62,0,1,0,80,0,0,
+3,102,5,182,0,13,0,0,1,17,51,21,35,17,33,21,33,17,35,53,51,17,1,236,229,229,
+1,122,253,207,229,229,5,182,254,101,160,253,37,160,3,123,160,1,155,0,0,1,
+255,186,0,0,3,102,5,182,0,26,0,0,19,51,17,51,17,51,21,35,17,22,51,51,21,35,
+34,38,39,6,35,35,34,38,39,53,33,17,35,80,229,183,229,229,52,158,168,198,64,
+92,53,59,162,211,17,65,19,1,123,229,4,27,1,155,254,101,160,253,153,116,160,
+45,70,115,20,13,127,2,219,0,0,1,255,186,0,0,2,209,5,182,0,19,0,0,19,51,17,
+51,17,51,21,35,17,20,6,35,35,34,38,39,53,33,17,35,80,229,183,229,229,134,
+116,211,17,65,19,1,123,229,4,27,1,155,254,101,160,253,117,115,125,20,13,127,
+2,219,0,2,0,80,0,0,5,121,5,182,0,25,0,29,0,0,19,51,17,51,17,33,17,51,17,51,
+21,35,17,22,51,51,21,35,34,38,39,6,35,33,17,35,33,17,33,17,80,229,183,1,92,
+182,229,229,53,158,168,199,65,93,51,59,162,254,49,229,1,156,1,92,4,27,1,155,
+254,101,1,155,254,101,160,253,153,116,160,47,68,115,3,123,253,37,2,219,0,
+2,255,186,0,0,5,121,5,182,0,36,0,42,0,0,19,51,17,51,17,33,17,51,17,51,21,
+35,17,22,51,51,21,35,34,38,39,6,35,35,34,38,39,6,35,35,34,38,39,53,33,17,
+35,33,33,17,22,23,51,80,229,183,1,92,182,229,229,53,158,168,199,65,93,51,
+59,162,100,64,92,53,59,162,211,17,65,19,1,123,229,2,248,254,164,48,146,154,
+4,27,1,155,254,101,1,155,254,101,160,253,153,116,160,47,68,115,45,70,115,
+20,13,127,2,219,253,153,110,6,0,2,255,186,0,0,4,227,5,182,0,29,0,35,0,0,19,
+51,17,51,17,33,17,51,17,51,21,35,17,20,6,35,35,34,38,39,6,35,35,34,38,39,
+53,33,17,35,1,22,51,51,17,33,80,229,183,1,92,182,229,229,134,116,100,64,92,
+53,59,162,211,17,65,19,1,123,229,1,156,52,158,138,254,164,4,27,1,155,254,
+101,1,155,254,101,160,253,117,115,125,45,70,115,20,13,127,2,219,253,153,116,
+2,219,0,2,0,180,0,0,5,240,4,27,0,16,0,23,0,0,1,17,22,51,51,21,35,34,38,39,
+6,35,33,17,52,54,51,3,33,17,33,34,6,21,4,246,53,158,39,70,65,93,51,59,162,
+252,184,162,168,148,2,213,253,177,67,67,4,27,252,249,116,160,47,68,115,2,
+227,158,154,252,133,2,219,77,89,0,0,2,255,186,0,0,5,240,4,27,0,21,0,28,0,
+0,1,17,22,51,51,21,35,34,38,39,6,35,33,34,38,39,53,51,17,52,54,51,3,33,17,
+33,34,6,21,4,246,53,158,39,70,65,93,51,59,162,252,35,17,65,19,250,162,168,
+148,2,213,253,177,67,67,4,27,252,249,116,160,47,68,115,20,13,127,2,67,158,
+154,252,133,2,219,77,89,0,0,2,255,186,0,0,4,246,4,27,0,14,0,21,0,0,37,20,
+6,35,33,34,38,39,53,51,17,52,54,51,33,1,33,17,33,34,6,21,4,246,134,116,252,
+35,17,65,19,250,162,168,2,248,252,116,2,213,253,177,67,67,240,115,125,20,
+13,127,2,67,158,154,252,133,2,219,77,89,0,2,0,80,0,0,4,225,5,182,0,7,0,14,
+0,0,37,33,21,33,1,53,33,21,7,33,19,22,23,54,55,2,217,2,8,253,19,254,92,3,
+252,207,253,166,231,58,14,34,31,160,160,5,92,90,90,69,252,251,189,89,172,
+102,0,2,255,186,0,0,4,225,5,182,0,21,0,28,0,0,51,34,38,39,53,33,1,53,33,21,
+1,22,51,33,21,33,34,38,39,6,6,35,1,33,19,22,23,54,55,31,17,65,19,2,9,254,
+141,3,252,254,172,54,147,1,32,254,232,80,105,65,29,124,77,1,148,253,166,231,
+58,14,34,31,20,13,127,4,188,90,90,251,164,96,160,48,75,65,58,5,23,252,251,
+189,89,172,102,0,0,2,255,186,0,0,4,76,5,182,0,13,0,20,0,0,51,34,38,39,53,
+33,1,53,33,21,1,6,6,35,1,33,19,22,23,54,55,31,17,65,19,2,9,254,141,3,252,
+254,145,21,126,97,1,148,253,166,231,58,14,34,31,20,13,127,4,188,90,90,251,
+72,81,83,5,23,252,251,189,89,172,102,0,3,0,180,0,0,6,35,5,182,0,29,0,39,0,
+48,0,0,1,53,52,54,51,50,22,21,20,6,35,35,17,7,22,51,33,21,33,34,38,38,39,
+6,35,33,17,52,54,51,3,51,50,54,53,17,35,34,6,21,1,51,50,53,52,38,35,34,21,
+2,227,178,162,143,179,213,191,75,2,52,156,1,187,254,78,56,81,68,51,75,214,
+254,100,162,168,148,244,69,64,243,67,67,2,48,82,215,79,71,147,3,164,168,170,
+192,188,148,165,189,254,51,41,110,160,23,48,58,129,2,109,157,154,252,252,
+80,86,1,190,77,89,1,70,198,81,92,187,0,0,3,255,186,0,0,6,35,5,182,0,34,0,
+44,0,53,0,0,1,53,52,54,51,50,22,21,20,6,35,35,17,7,22,51,33,21,33,34,38,38,
+39,6,35,33,34,38,39,53,51,17,52,54,51,3,51,50,54,53,17,35,34,6,21,1,51,50,
+53,52,38,35,34,21,2,227,178,162,143,179,213,191,75,2,52,156,1,187,254,78,
+56,81,68,51,75,214,253,207,17,65,19,250,162,168,148,244,69,64,243,67,67,2,
+48,82,215,79,71,147,3,164,168,170,192,188,148,165,189,254,51,41,110,160,23,
+48,58,129,20,13,127,1,205,157,154,252,252,80,86,1,190,77,89,1,70,198,81,92,
+187,0,0,3,255,186,0,0,5,121,5,182,0,25,0,34,0,43,0,0,1,53,52,54,51,50,22,
+21,20,6,35,35,17,20,6,35,33,34,38,39,53,51,17,52,54,51,3,51,50,55,17,35,34,
+6,21,1,51,50,53,52,38,35,34,21,2,227,178,162,143,179,213,191,75,162,168,253,
+207,17,65,19,250,162,168,148,244,127,6,243,67,67,2,48,82,215,79,71,147,3,
+164,168,170,192,188,148,165,189,254,51,158,153,20,13,127,1,205,157,154,252,
+252,149,1,207,77,89,1,70,198,81,92,187,0,1,0,160,0,0,4,160,5,182,0,13,0,0,
+1,17,51,21,33,17,33,17,35,17,51,17,33,17,3,166,250,254,80,254,102,182,182,
+1,154,5,182,250,234,160,3,123,254,207,2,219,254,246,1,155,0,1,255,186,0,0,
+4,160,5,182,0,26,0,0,51,34,38,39,53,33,17,33,17,35,17,51,17,33,17,51,17,22,
+51,51,21,35,34,38,39,6,35,31,17,65,19,3,54,254,102,182,182,1,154,182,53,158,
+39,70,65,93,51,59,162,20,13,127,2,219,254,207,2,219,254,246,1,155,251,94,
+116,160,47,68,115,0,0,1,255,186,0,0,3,166,5,182,0,19,0,0,51,34,38,39,53,33,
+17,33,17,35,17,51,17,33,17,51,17,20,6,35,31,17,65,19,3,54,254,102,182,182,
+1,154,182,134,116,20,13,127,2,219,254,207,2,219,254,246,1,155,251,58,115,
+125,0,2,0,94,0,0,4,229,5,182,0,18,0,29,0,0,1,17,33,21,33,17,35,34,38,53,52,
+54,51,50,22,21,21,33,21,1,20,22,51,51,53,52,38,35,34,6,3,27,1,202,253,127,
+84,207,227,200,161,159,181,1,53,252,196,133,126,77,79,80,82,95,2,211,253,
+205,160,2,211,201,176,164,198,193,171,215,160,1,129,112,113,229,91,100,107,
+0,0,2,255,186,0,0,4,229,5,182,0,32,0,43,0,0,33,35,34,38,39,6,6,35,33,34,38,
+39,53,33,17,35,34,38,53,52,54,51,50,22,21,21,33,21,33,17,22,51,51,1,20,22,
+51,51,53,52,38,35,34,6,4,229,239,77,107,62,31,118,74,253,254,17,65,19,2,170,
+84,207,227,200,161,159,181,1,53,254,203,51,160,247,252,47,133,126,77,79,80,
+82,95,47,70,60,57,20,13,127,2,51,201,176,164,198,193,171,215,160,254,65,116,
+3,180,112,113,229,91,100,107,0,0,2,255,186,0,0,4,80,5,182,0,24,0,35,0,0,1,
+17,20,6,35,33,34,38,39,53,33,17,35,34,38,53,52,54,51,50,22,21,21,33,21,1,
+20,22,51,51,53,52,38,35,34,6,3,27,134,116,253,254,17,65,19,2,170,84,207,227,
+200,161,159,181,1,53,252,196,133,126,77,79,80,82,95,2,211,254,29,115,125,
+20,13,127,2,51,201,176,164,198,193,171,215,160,1,129,112,113,229,91,100,107,
+0,1,0,102,0,0,4,113,5,182,0,9,0,0,19,33,21,33,17,33,21,33,17,33,102,3,95,
+254,172,2,0,253,73,254,172,5,182,159,251,137,160,5,23,0,0,1,255,186,0,0,4,
+113,5,182,0,23,0,0,19,33,21,33,17,22,51,33,21,33,34,38,39,6,6,35,33,34,38,
+39,53,33,17,33,102,3,95,254,172,51,160,1,45,254,219,77,107,62,31,118,74,254,
+168,17,65,19,2,0,254,172,5,182,159,251,253,116,160,47,70,60,57,20,13,127,
+4,119,0,1,255,186,0,0,3,197,5,182,0,15,0,0,19,33,21,33,17,20,6,35,33,34,38,
+39,53,33,17,33,102,3,95,254,172,134,116,254,168,17,65,19,2,0,254,172,5,182,
+159,251,217,115,125,20,13,127,4,119,0,2,0,80,0,0,4,225,5,182,0,6,0,13,0,0,
+1,51,1,51,21,33,53,55,33,3,38,39,6,6,1,242,182,1,141,172,251,111,207,2,90,
+232,55,16,24,23,5,182,250,234,160,90,70,3,4,182,96,122,90,0,0,2,255,186,0,
+0,4,225,5,182,0,7,0,14,0,0,33,33,53,51,1,51,1,51,33,33,3,38,39,6,6,4,225,
+250,217,170,1,142,182,1,141,172,252,62,2,90,232,55,16,24,23,160,5,22,250,
+234,3,4,182,96,122,90,0,2,255,186,0,0,4,76,5,182,0,9,0,16,0,0,51,34,38,39,
+53,51,1,51,1,21,37,33,3,38,39,6,6,31,17,65,19,170,1,142,182,1,164,252,211,
+2,90,232,55,16,24,23,20,13,127,5,22,250,164,90,160,3,4,182,96,122,90,0,0,
+2,0,100,0,0,4,154,5,182,0,21,0,33,0,0,19,33,17,22,22,21,20,6,7,21,33,21,33,
+17,38,38,53,52,54,55,53,33,1,34,6,21,20,22,51,50,54,53,52,38,100,2,52,147,
+156,164,139,2,2,253,71,144,159,158,145,254,131,1,215,96,113,110,103,101,106,
+108,5,182,254,121,21,172,135,136,175,18,254,160,1,160,20,169,140,133,172,
+21,232,254,127,91,84,82,92,93,81,82,93,0,0,2,255,186,0,0,4,154,5,182,0,35,
+0,47,0,0,19,33,17,22,22,21,20,6,7,21,22,51,33,21,33,34,38,39,6,6,35,33,34,
+38,39,53,33,17,38,38,53,52,54,55,53,33,1,34,6,21,20,22,51,50,54,53,52,38,
+100,2,52,147,156,164,139,52,158,1,48,254,217,77,107,62,31,118,74,254,129,
+17,65,19,2,39,144,159,158,145,254,131,1,215,96,113,110,103,101,106,108,5,
+182,254,121,21,172,135,136,175,18,138,116,160,47,70,60,57,20,13,127,1,0,20,
+169,140,133,172,21,232,254,127,91,84,82,92,93,81,82,93,0,2,255,186,0,0,3,
+199,5,182,0,27,0,39,0,0,19,33,17,22,22,21,20,6,7,21,20,6,35,33,34,38,39,53,
+33,17,38,38,53,52,54,55,53,33,1,34,6,21,20,22,51,50,54,53,52,38,100,2,52,
+147,156,164,139,134,116,254,129,17,65,19,2,39,144,159,158,145,254,131,1,215,
+96,113,110,103,101,106,108,5,182,254,121,21,172,135,136,175,18,174,115,125,
+20,13,127,1,0,20,169,140,133,172,21,232,254,127,91,84,82,92,93,81,82,93,0,
+1,0,160,0,0,4,160,5,182,0,15,0,0,1,17,51,21,33,17,33,34,6,21,17,35,17,52,
+54,51,3,166,250,254,80,254,235,66,67,182,161,168,5,182,250,234,160,5,23,78,
+88,254,204,1,66,158,153,0,0,1,255,186,0,0,4,160,5,182,0,28,0,0,1,17,22,51,
+51,21,35,34,38,39,6,35,33,34,38,39,53,33,17,33,34,6,21,17,35,17,52,54,51,
+3,166,53,158,39,70,65,93,51,59,162,253,115,17,65,19,3,54,254,235,66,67,182,
+161,168,5,182,251,94,116,160,47,68,115,20,13,127,4,119,78,88,254,204,1,66,
+158,153,0,1,255,186,0,0,3,166,5,182,0,21,0,0,1,17,20,6,35,33,34,38,39,53,
+33,17,33,34,6,21,17,35,17,52,54,51,3,166,134,116,253,115,17,65,19,3,54,254,
+235,66,67,182,161,168,5,182,251,58,115,125,20,13,127,4,119,78,88,254,204,
+1,66,158,153,0,0,1,0,160,0,0,4,160,5,182,0,11,0,0,1,17,33,17,51,21,33,17,
+33,17,35,17,1,86,2,80,250,254,80,254,102,182,5,182,254,195,252,39,160,3,217,
+254,201,3,20,0,0,1,255,186,0,0,4,160,5,182,0,24,0,0,1,17,33,17,22,51,51,21,
+35,34,38,39,6,35,33,34,38,39,53,33,17,33,17,35,17,1,86,2,80,53,158,39,70,
+65,93,51,59,162,253,115,17,65,19,3,54,254,102,182,5,182,254,195,252,155,116,
+160,47,68,115,20,13,127,3,57,254,201,3,20,0,1,255,186,0,0,3,166,5,182,0,17,
+0,0,1,17,33,17,20,6,35,33,34,38,39,53,33,17,33,17,35,17,1,86,2,80,134,116,
+253,115,17,65,19,3,54,254,102,182,5,182,254,195,252,119,115,125,20,13,127,
+3,57,254,201,3,20,0,0,2,0,180,0,0,4,121,5,182,0,20,0,27,0,0,19,33,17,22,51,
+51,21,35,34,38,39,6,35,33,17,52,54,51,51,17,33,19,33,17,35,34,6,21,201,2,
+182,53,158,39,70,65,93,51,59,162,254,47,162,168,203,254,0,161,1,95,217,67,
+67,5,182,251,94,116,160,47,68,115,2,59,158,154,1,164,251,137,2,51,77,89,0,
+2,255,186,0,0,4,121,5,182,0,25,0,32,0,0,19,33,17,22,51,51,21,35,34,38,39,
+6,35,33,34,38,39,53,51,17,52,54,51,51,17,33,19,33,17,35,34,6,21,201,2,182,
+53,158,39,70,65,93,51,59,162,253,154,17,65,19,250,162,168,203,254,0,161,1,
+95,217,67,67,5,182,251,94,116,160,47,68,115,20,13,127,1,155,158,154,1,164,
+251,137,2,51,77,89,0,2,255,186,0,0,3,127,5,182,0,18,0,25,0,0,19,33,17,20,
+6,35,33,34,38,39,53,51,17,52,54,51,51,17,33,19,33,17,35,34,6,21,201,2,182,
+134,116,253,154,17,65,19,250,162,168,203,254,0,161,1,95,217,67,67,5,182,251,
+58,115,125,20,13,127,1,155,158,154,1,164,251,137,2,51,77,89,0,0,2,0,139,0,
+0,4,113,5,182,0,19,0,31,0,0,33,33,17,38,38,53,52,54,55,17,51,17,22,22,21,
+20,6,7,21,33,1,34,6,21,20,22,51,50,54,53,52,38,4,113,253,73,144,159,158,145,
+183,147,156,164,139,2,0,253,163,97,111,113,100,100,106,108,1,160,20,169,140,
+133,172,21,1,135,254,121,21,172,135,136,175,18,254,2,246,93,82,84,90,93,81,
+82,93,0,0,2,255,186,0,0,4,113,5,182,0,33,0,45,0,0,33,33,34,38,39,6,6,35,33,
+34,38,39,53,33,17,38,38,53,52,54,55,17,51,17,22,22,21,20,6,7,21,22,51,33,
+1,34,6,21,20,22,51,50,54,53,52,38,4,113,254,219,77,107,62,31,118,74,254,168,
+17,65,19,2,0,144,159,158,145,183,147,156,164,139,51,160,1,45,253,163,97,111,
+113,100,100,106,108,47,70,60,57,20,13,127,1,0,20,169,140,133,172,21,1,135,
+254,121,21,172,135,136,175,18,138,116,2,246,93,82,84,90,93,81,82,93,0,2,255,
+186,0,0,3,160,5,182,0,25,0,37,0,0,51,34,38,39,53,33,17,38,38,53,52,54,55,
+17,51,17,22,22,21,20,6,7,21,20,6,35,19,34,6,21,20,22,51,50,54,53,52,38,31,
+17,65,19,2,0,144,159,158,145,183,147,156,164,139,134,116,157,97,111,113,100,
+100,106,108,20,13,127,1,0,20,169,140,133,172,21,1,135,254,121,21,172,135,
+136,175,18,174,115,125,3,150,93,82,84,90,93,81,82,93,0,0,2,0,100,0,0,4,129,
+5,182,0,23,0,35,0,0,19,33,21,33,21,22,22,21,20,6,7,21,33,21,33,17,38,38,53,
+52,54,55,53,33,1,34,6,21,20,22,51,50,54,53,52,38,100,3,115,254,162,147,156,
+163,140,2,8,253,66,146,158,158,146,254,161,1,185,98,111,113,100,100,107,109,
+5,182,159,232,21,170,137,136,175,18,254,160,1,160,20,173,136,133,171,22,232,
+254,127,92,83,84,90,93,81,82,93,0,0,2,255,186,0,0,4,129,5,182,0,37,0,49,0,
+0,19,33,21,33,21,22,22,21,20,6,7,21,22,51,33,21,33,34,38,39,6,6,35,33,34,
+38,39,53,33,17,38,38,53,52,54,55,53,33,1,34,6,21,20,22,51,50,54,53,52,38,
+100,3,115,254,162,147,156,163,140,53,158,1,53,254,211,77,107,62,31,118,74,
+254,160,17,65,19,2,9,146,158,158,146,254,161,1,185,98,111,113,100,100,107,
+109,5,182,159,232,21,170,137,136,175,18,138,116,160,47,70,60,57,20,13,127,
+1,0,20,173,136,133,171,22,232,254,127,92,83,84,90,93,81,82,93,0,2,255,186,
+0,0,3,215,5,182,0,29,0,41,0,0,19,33,21,33,21,22,22,21,20,6,7,21,20,6,35,33,
+34,38,39,53,33,17,38,38,53,52,54,55,53,33,1,34,6,21,20,22,51,50,54,53,52,
+38,100,3,115,254,162,147,156,163,140,134,116,254,160,17,65,19,2,9,146,158,
+158,146,254,161,1,185,98,111,113,100,100,107,109,5,182,159,232,21,170,137,
+136,175,18,174,115,125,20,13,127,1,0,20,173,136,133,171,22,232,254,127,92,
+83,84,90,93,81,82,93,0,1,0,176,253,211,3,229,2,61,0,30,0,0,33,35,34,38,39,
+7,3,22,51,50,54,54,55,51,6,4,35,34,38,53,52,55,55,18,19,51,6,7,22,51,51,3,
+229,98,76,105,67,71,197,18,29,66,121,109,24,135,55,254,253,184,91,120,85,
+49,204,162,188,59,98,59,125,106,44,75,146,254,146,6,78,154,77,230,237,69,
+54,21,155,88,1,111,1,120,143,199,71,0,0,1,255,186,253,211,3,229,2,61,0,38,
+0,0,5,51,6,4,35,34,38,53,52,55,54,55,53,33,34,38,39,53,33,54,55,51,6,7,22,
+51,51,21,35,34,38,39,7,3,22,51,50,54,54,2,238,135,55,254,253,184,91,120,85,
+125,15,254,142,17,65,19,2,41,101,92,188,59,98,59,125,106,98,76,105,67,71,
+197,18,29,66,121,109,90,230,237,69,54,21,155,227,29,2,20,13,127,199,214,143,
+199,71,160,44,75,146,254,146,6,78,154,0,1,255,186,253,211,3,117,2,61,0,30,
+0,0,37,54,55,51,6,3,7,3,22,51,50,54,54,55,51,6,4,35,34,38,53,52,55,54,55,
+53,33,34,38,39,53,1,227,101,92,188,54,145,85,197,18,29,66,121,109,24,135,
+55,254,253,184,91,120,85,125,15,254,142,17,65,19,160,199,214,136,254,222,
+174,254,146,6,78,154,77,230,237,69,54,21,155,227,29,2,20,13,127,0,2,0,176,
+253,211,3,229,2,61,0,28,0,39,0,0,33,35,34,38,39,7,51,50,22,21,20,6,6,35,34,
+38,53,52,54,55,54,18,55,51,6,7,22,51,51,1,22,51,50,54,53,52,38,35,35,7,3,
+229,98,76,105,67,73,36,112,124,127,209,115,102,121,68,75,88,243,26,188,55,
+102,60,124,106,253,154,18,34,80,153,58,51,53,60,44,75,148,98,84,78,165,103,
+70,53,16,130,133,157,1,237,78,139,205,69,253,215,6,107,63,41,22,113,0,2,255,
+186,253,211,3,229,2,61,0,35,0,46,0,0,33,35,34,38,39,7,51,50,22,21,20,6,6,
+35,34,38,53,52,54,55,55,53,33,34,38,39,53,33,18,55,51,6,7,22,51,51,1,22,51,
+50,54,53,52,38,35,35,7,3,229,98,76,105,67,73,36,112,124,127,209,115,102,121,
+68,75,82,254,142,17,65,19,2,41,150,43,188,55,102,60,124,106,253,154,18,34,
+80,153,58,51,53,60,44,75,148,98,84,78,165,103,70,53,16,130,133,153,2,20,13,
+127,1,44,113,139,205,69,253,215,6,107,63,41,22,113,0,2,255,186,253,211,3,
+96,2,61,0,27,0,38,0,0,33,33,34,38,39,53,33,18,55,51,6,2,7,51,50,22,21,20,
+6,6,35,34,38,53,52,54,55,55,3,22,51,50,54,53,52,38,35,35,7,1,145,254,142,
+17,65,19,2,41,150,43,188,54,152,80,36,112,124,127,209,115,102,121,68,75,82,
+18,18,34,80,153,58,51,53,60,20,13,127,1,44,113,136,254,204,158,98,84,78,165,
+103,70,53,16,130,133,153,254,121,6,107,63,41,22,113,0,0,1,0,80,253,211,3,
+102,2,152,0,11,0,0,1,17,33,21,33,17,35,17,35,53,51,17,1,236,1,122,254,134,
+183,229,229,2,152,254,8,160,253,211,2,45,160,1,248,0,0,1,255,186,253,211,
+3,102,2,152,0,14,0,0,1,17,33,21,33,17,35,17,33,34,38,39,53,33,17,1,236,1,
+122,254,134,183,254,234,17,65,19,1,123,2,152,254,8,160,253,211,2,45,20,13,
+127,1,248,0,0,1,255,186,253,211,2,209,2,152,0,14,0,0,1,17,51,21,35,17,35,
+17,33,34,38,39,53,33,17,1,236,229,229,183,254,234,17,65,19,1,123,2,152,254,
+8,160,253,211,2,45,20,13,127,1,248,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,
+94,0,0,0,3,0,1,4,9,0,1,0,26,0,94,0,3,0,1,4,9,0,2,0,14,0,120,0,3,0,1,4,9,0,
+3,0,64,0,134,0,3,0,1,4,9,0,4,0,26,0,94,0,3,0,1,4,9,0,5,0,30,0,198,0,3,0,1,
+4,9,0,6,0,22,0,228,0,3,0,1,4,9,0,7,0,68,0,250,0,3,0,1,4,9,0,8,0,42,1,62,0,
+3,0,1,4,9,0,9,0,40,1,104,0,3,0,1,4,9,0,10,0,96,1,144,0,3,0,1,4,9,0,11,0,62,
+1,240,0,3,0,1,4,9,0,12,0,60,2,46,0,3,0,1,4,9,0,13,2,150,2,106,0,3,0,1,4,9,
+0,14,0,52,5,0,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,
+50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,78,0,75,0,111,0,82,0,101,0,103,0,117,
+0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,
+0,32,0,83,0,97,0,110,0,115,0,32,0,78,0,75,0,111,0,86,0,101,0,114,0,115,0,
+105,0,111,0,110,0,32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,78,0,111,0,116,
+0,111,0,83,0,97,0,110,0,115,0,78,0,75,0,111,0,78,0,111,0,116,0,111,0,32,0,
+105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,
+107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,
+110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,
+109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,
+0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,
+110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,
+0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,
+0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,
+0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,
+0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,
+0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,
+0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,
+105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,
+0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,
+0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,
+0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,
+0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,
+0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,
+0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,
+0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,
+105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,
+44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,
+0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,
+0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,
+103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,
+0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,
+0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,102,0,102,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,
+0,12,0,0,0,34,0,0,0,2,0,3,0,0,0,50,0,1,0,51,0,59,0,3,0,60,0,173,0,1,0,4,0,
+0,0,1,0,0,0,0,0,1,0,0,0,10,0,48,0,78,0,2,68,70,76,84,0,14,110,107,111,32,
+0,26,0,4,0,0,0,0,255,255,0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,1,0,2,109,97,114,
+107,0,14,109,97,114,107,0,22,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,2,0,6,0,14,
+0,4,0,0,0,1,0,16,0,4,0,0,0,1,1,96,0,1,1,56,1,72,0,1,0,12,0,46,0,8,0,0,2,132,
+0,0,2,132,0,0,2,132,0,0,2,132,0,0,2,132,0,0,2,132,0,0,2,132,0,0,2,132,0,132,
+2,92,2,104,2,110,2,116,2,122,2,128,2,134,2,140,2,146,2,152,2,158,2,92,2,164,
+2,170,2,176,2,158,2,134,2,182,2,188,2,194,2,200,2,110,2,200,2,206,2,140,2,
+200,2,200,2,200,2,200,2,200,2,212,2,212,2,218,2,92,2,92,2,92,2,104,2,104,
+2,104,2,110,2,110,2,110,2,116,2,116,2,116,2,122,2,122,2,122,2,128,2,128,2,
+128,2,134,2,134,2,134,2,140,2,140,2,140,2,146,2,146,2,146,2,152,2,152,2,152,
+2,158,2,158,2,158,2,92,2,92,2,92,2,164,2,164,2,164,2,170,2,170,2,170,2,176,
+2,176,2,176,2,158,2,158,2,158,2,134,2,134,2,134,2,182,2,182,2,182,2,188,2,
+188,2,188,2,194,2,194,2,194,2,200,2,200,2,200,2,110,2,110,2,110,2,200,2,200,
+2,200,2,206,2,206,2,206,2,140,2,140,2,140,2,200,2,200,2,200,2,200,2,200,2,
+200,2,200,2,200,2,200,2,200,2,200,2,200,2,200,2,200,2,200,2,212,2,212,2,212,
+2,212,2,212,2,212,2,218,2,218,2,218,0,2,0,2,0,51,0,57,0,0,0,59,0,59,0,7,0,
+2,0,2,0,18,0,50,0,0,0,75,0,173,0,33,0,1,1,28,1,34,0,1,0,12,0,18,0,1,0,0,1,
+176,0,132,1,176,1,182,1,188,1,194,1,200,1,170,1,206,1,212,1,218,1,176,1,224,
+1,230,1,236,1,170,1,242,1,248,1,254,2,4,1,200,1,170,2,10,1,254,2,16,1,224,
+2,22,2,10,2,10,2,28,1,212,1,230,2,34,2,34,2,40,1,248,1,176,1,164,1,182,1,
+182,1,182,1,182,1,188,2,118,1,194,1,194,1,194,1,200,1,200,1,200,1,170,1,170,
+1,170,2,46,1,206,2,124,1,212,1,212,1,212,2,52,1,200,1,200,2,58,2,160,1,164,
+2,4,2,130,2,130,1,230,1,230,1,230,2,64,2,184,2,136,2,70,2,166,2,118,1,242,
+1,242,1,242,1,224,1,248,2,142,1,254,1,254,1,254,2,4,2,4,2,4,2,76,1,200,2,
+148,2,64,2,64,1,170,2,46,1,188,1,188,2,82,2,190,2,136,2,88,2,16,2,154,1,224,
+1,224,1,224,2,94,1,224,2,160,2,100,2,166,2,166,2,106,2,172,2,172,2,28,2,28,
+2,28,2,112,1,230,1,176,2,112,2,28,2,178,2,34,2,34,2,34,2,34,2,34,2,34,2,40,
+2,40,2,40,0,1,0,1,0,58,0,2,0,2,0,18,0,50,0,0,0,75,0,173,0,33,0,1,1,24,6,94,
+0,1,1,234,6,94,0,1,2,168,5,50,0,1,1,184,6,94,0,1,2,128,5,50,0,1,2,88,5,50,
+0,1,1,244,5,50,0,1,2,148,6,94,0,1,2,8,6,94,0,1,1,204,6,94,0,1,1,194,6,94,
+0,1,1,144,6,94,0,1,1,224,6,94,0,1,1,244,6,94,0,1,2,248,5,50,0,1,2,208,5,50,
+0,1,2,88,6,94,0,1,2,248,6,94,0,1,2,28,6,94,0,1,2,68,6,94,0,1,2,88,3,162,0,
+1,1,144,3,162,0,1,0,160,255,156,0,1,1,244,255,156,0,1,1,24,255,156,0,1,2,
+168,255,156,0,1,1,194,255,156,0,1,2,128,255,156,0,1,2,88,255,156,0,1,2,148,
+255,156,0,1,2,8,255,156,0,1,4,116,255,156,0,1,2,68,255,156,0,1,2,28,255,156,
+0,1,2,178,255,156,0,1,3,2,255,156,0,1,1,144,255,156,0,1,2,188,255,156,0,1,
+2,208,255,156,0,1,3,72,255,156,0,1,2,18,255,156,0,1,2,58,255,156,0,1,2,38,
+255,156,0,1,1,184,253,148,0,1,1,144,253,148,0,1,3,192,255,156,0,1,4,246,255,
+156,0,1,2,48,255,156,0,1,3,62,255,156,0,1,2,108,255,156,0,1,3,112,255,156,
+0,1,3,182,255,156,0,1,3,12,255,156,0,1,3,82,255,156,0,1,3,242,255,156,0,1,
+3,232,255,156,0,1,3,42,255,156,0,1,0,230,255,156,0,1,1,204,255,156,0,1,1,
+64,255,156,0,1,1,84,255,156,0,1,0,220,255,156,0,1,1,154,255,156,0,1,1,4,255,
+156,0,1,1,44,255,156,0,1,1,234,255,156,0,1,1,224,255,156,0,1,1,34,255,156,
+0,1,2,158,255,156,0,1,2,198,255,156,0,0,0,1,0,0,0,10,0,60,0,158,0,2,68,70,
+76,84,0,14,110,107,111,32,0,32,0,4,0,0,0,0,255,255,0,4,0,0,0,4,0,6,0,2,0,
+4,0,0,0,0,255,255,0,4,0,1,0,5,0,7,0,3,0,8,99,99,109,112,0,50,99,99,109,112,
+0,56,102,105,110,97,0,62,102,105,110,97,0,68,105,110,105,116,0,74,105,110,
+105,116,0,80,109,101,100,105,0,86,109,101,100,105,0,92,0,0,0,1,0,0,0,0,0,
+1,0,0,0,0,0,1,0,1,0,0,0,1,0,1,0,0,0,1,0,3,0,0,0,1,0,3,0,0,0,1,0,2,0,0,0,1,
+0,2,0,4,0,10,0,18,0,26,0,34,0,4,0,1,0,1,0,32,0,1,0,9,0,1,0,76,0,1,0,9,0,1,
+0,150,0,1,0,9,0,1,0,224,0,1,0,42,0,3,0,12,0,22,0,32,0,1,0,4,0,55,0,2,0,54,
+0,1,0,4,0,56,0,2,0,54,0,1,0,4,0,57,0,2,0,54,0,2,0,1,0,51,0,53,0,0,0,2,0,72,
+0,33,0,75,0,78,0,81,0,84,0,87,0,90,0,93,0,96,0,99,0,102,0,105,0,108,0,111,
+0,114,0,117,0,120,0,123,0,126,0,129,0,132,0,135,0,138,0,141,0,144,0,147,0,
+150,0,153,0,156,0,159,0,162,0,165,0,168,0,171,0,2,0,1,0,18,0,50,0,0,0,2,0,
+72,0,33,0,76,0,79,0,82,0,85,0,88,0,91,0,94,0,97,0,100,0,103,0,106,0,109,0,
+112,0,115,0,118,0,121,0,124,0,127,0,130,0,133,0,136,0,139,0,142,0,145,0,148,
+0,151,0,154,0,157,0,160,0,163,0,166,0,169,0,172,0,2,0,1,0,18,0,50,0,0,0,2,
+0,72,0,33,0,77,0,80,0,83,0,86,0,89,0,92,0,95,0,98,0,101,0,104,0,107,0,110,
+0,113,0,116,0,119,0,122,0,125,0,128,0,131,0,134,0,137,0,140,0,143,0,146,0,
+149,0,152,0,155,0,158,0,161,0,164,0,167,0,170,0,173,0,2,0,1,0,18,0,50,0,0,
+0,0,};
+#endif
@@ -0,0 +1,681 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansNewTaiLue_Regular_ttf_size = 15832;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansNewTaiLue_Regular_ttf");
+asm(".type fz_font_NotoSansNewTaiLue_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansNewTaiLue_Regular_ttf, 15832");
+asm(".balign 64");
+asm("fz_font_NotoSansNewTaiLue_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansNewTaiLue-Regular.ttf\"");
+#else
+const int fz_font_NotoSansNewTaiLue_Regular_ttf_size = 15832;
+const char fz_font_NotoSansNewTaiLue_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,38,0,96,0,0,59,236,0,0,0,30,71,
+80,79,83,161,176,178,180,0,0,60,12,0,0,1,154,71,83,85,66,177,6,192,254,0,
+0,61,168,0,0,0,48,79,83,47,50,122,231,234,222,0,0,1,104,0,0,0,96,99,109,97,
+112,52,200,51,179,0,0,3,52,0,0,0,108,103,97,115,112,0,7,0,7,0,0,59,224,0,
+0,0,12,103,108,121,102,253,212,154,196,0,0,4,88,0,0,45,206,104,101,97,100,
+7,102,187,233,0,0,0,236,0,0,0,54,104,104,101,97,17,203,7,163,0,0,1,36,0,0,
+0,36,104,109,116,120,235,143,29,108,0,0,1,200,0,0,1,108,108,111,99,97,24,
+141,36,165,0,0,3,160,0,0,0,184,109,97,120,112,0,102,0,189,0,0,1,72,0,0,0,
+32,110,97,109,101,143,27,186,157,0,0,50,40,0,0,6,26,112,111,115,116,215,124,
+240,71,0,0,56,68,0,0,3,156,0,1,0,0,0,1,12,205,94,221,231,198,95,15,60,245,
+0,11,8,0,0,0,0,0,204,227,153,174,0,0,0,0,210,40,203,252,255,56,253,168,10,
+3,6,204,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,10,103,255,56,255,
+56,10,3,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,0,1,0,0,0,91,0,99,0,4,0,88,0,
+4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,5,118,1,144,0,5,0,0,5,154,5,51,
+0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,
+0,0,0,0,128,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,
+8,141,2,88,0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,
+0,0,2,20,0,0,7,110,0,80,7,110,0,80,7,68,0,100,4,61,0,40,7,79,0,100,4,228,
+0,100,4,200,0,100,5,44,0,100,4,159,0,100,7,110,0,80,4,248,0,100,4,228,0,100,
+4,200,0,100,7,68,0,100,7,68,0,100,5,9,0,100,7,79,0,100,5,34,0,100,5,253,0,
+100,4,155,0,68,5,20,0,100,6,171,0,100,7,79,0,100,7,68,0,100,7,110,0,80,4,
+228,0,100,5,34,0,100,7,79,0,100,7,79,0,100,7,68,0,100,4,111,0,100,7,79,0,
+100,7,79,0,100,4,88,255,244,4,228,0,100,5,109,0,80,4,88,255,244,4,228,0,100,
+7,68,0,100,4,84,0,100,4,228,0,100,4,200,0,100,7,110,0,80,4,200,0,100,5,83,
+0,100,4,88,0,80,4,212,0,100,4,88,0,80,4,199,0,20,5,159,0,100,10,103,0,100,
+4,58,0,100,4,39,255,216,4,212,0,100,4,128,0,100,6,117,0,80,6,144,0,20,6,140,
+0,100,5,202,255,216,6,241,0,100,6,241,0,100,4,111,0,100,5,45,0,100,4,173,
+0,100,4,228,0,100,7,68,0,100,4,88,0,118,4,228,0,100,4,24,0,100,4,45,0,100,
+4,111,0,100,4,88,0,80,2,224,255,56,4,77,0,80,4,77,0,100,6,54,0,100,5,6,0,
+100,6,54,0,100,4,125,0,30,4,200,0,100,4,240,0,100,6,177,0,100,6,177,0,100,
+3,144,0,87,4,92,0,100,3,208,0,100,3,36,0,80,0,0,0,1,0,3,0,1,0,0,0,12,0,4,
+0,96,0,0,0,20,0,16,0,3,0,4,0,0,0,13,0,32,0,160,25,171,25,201,25,218,25,223,
+254,255,255,255,0,0,0,0,0,13,0,32,0,160,25,128,25,176,25,208,25,222,254,255,
+255,255,0,1,255,245,255,227,255,99,230,132,230,128,230,122,230,119,1,2,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,122,0,
+134,0,207,1,31,1,165,1,211,2,23,2,103,2,166,2,245,3,69,3,143,3,237,4,54,4,
+133,4,216,5,76,5,160,5,217,6,32,6,89,6,194,7,55,7,171,7,249,8,80,8,183,8,
+195,9,75,9,166,9,212,10,39,10,122,10,183,10,229,11,55,11,67,11,79,11,91,11,
+191,11,203,11,215,11,227,12,84,12,209,12,253,13,65,13,128,13,192,13,251,14,
+107,14,168,14,236,15,52,15,112,15,179,15,250,16,62,16,153,16,248,17,81,17,
+93,17,190,18,24,18,132,18,144,18,226,18,238,19,42,19,104,19,150,19,194,19,
+240,20,44,20,104,20,170,20,252,21,76,21,108,21,176,21,236,22,68,22,80,22,
+128,22,166,22,204,22,231,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,
+55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,
+1,0,80,253,198,7,10,4,94,0,71,0,0,37,55,51,50,54,53,52,38,35,34,6,7,22,21,
+20,2,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,54,51,32,23,
+54,54,51,50,22,22,21,20,6,7,22,22,21,20,6,6,35,34,36,39,55,22,22,51,50,54,
+53,52,38,35,35,7,5,18,20,19,130,151,171,148,106,157,39,15,121,224,146,138,
+228,75,132,34,177,97,140,168,169,150,78,141,41,131,72,212,116,1,15,129,74,
+205,123,143,219,120,109,94,89,96,131,227,150,136,254,234,84,121,66,203,108,
+159,166,143,129,15,16,137,1,229,192,199,222,128,129,77,93,178,254,253,136,
+133,125,75,76,119,240,197,205,220,76,65,76,98,105,192,90,102,134,255,176,
+153,236,69,43,140,86,114,188,94,125,106,89,80,102,128,127,86,91,1,255,255,
+0,80,253,198,7,10,6,24,2,34,0,4,0,0,0,3,0,90,2,26,0,0,0,1,0,100,255,236,6,
+224,4,94,0,50,0,0,37,6,35,34,38,2,53,52,54,54,51,50,22,23,54,54,51,50,22,
+22,21,20,2,6,35,34,39,55,22,51,50,54,53,52,38,35,34,6,7,35,38,38,35,34,6,
+21,20,22,51,50,55,3,45,106,133,135,217,122,119,217,138,113,194,48,52,194,
+111,136,217,121,123,218,133,133,106,81,72,78,143,155,155,140,115,141,10,170,
+11,140,115,139,156,155,143,78,72,41,61,142,1,9,178,166,251,136,123,102,105,
+120,135,250,168,179,254,247,141,61,117,40,228,217,197,220,168,149,150,167,
+220,197,218,227,40,0,0,2,0,40,253,198,3,217,4,94,0,44,0,54,0,0,19,22,22,51,
+50,54,53,52,39,6,35,34,38,53,52,54,54,51,50,23,54,53,52,38,35,34,6,7,39,54,
+33,50,0,21,20,7,22,21,20,2,6,35,34,38,39,1,38,35,34,6,21,20,22,51,50,157,
+58,172,88,157,169,23,127,179,157,178,87,157,89,170,137,21,162,147,91,142,
+42,126,140,1,23,216,1,3,83,86,122,231,157,134,230,71,2,158,88,155,68,94,93,
+80,154,254,222,65,77,220,198,90,77,103,126,110,66,113,64,100,85,109,169,188,
+73,66,74,203,254,233,231,164,146,133,161,172,254,251,141,99,86,2,160,106,
+51,42,51,61,0,2,0,100,253,168,6,235,4,94,0,56,0,95,0,0,1,38,35,34,6,21,20,
+22,51,50,54,55,19,62,2,51,50,22,22,21,20,2,6,35,34,38,39,55,22,51,50,54,53,
+52,38,38,35,34,6,7,3,14,2,35,34,38,38,53,52,18,54,51,50,22,23,19,6,35,34,
+38,53,52,54,51,50,22,21,20,6,4,35,34,36,38,39,55,22,4,51,50,54,54,53,52,38,
+35,34,6,21,20,22,51,50,55,2,212,68,122,117,133,121,104,54,99,78,200,84,121,
+137,81,116,188,104,119,200,112,98,149,48,102,68,122,117,133,57,101,67,54,
+98,79,200,84,121,137,81,117,188,103,119,200,112,98,149,48,207,58,83,117,140,
+225,170,243,251,141,254,250,177,149,254,245,219,72,70,127,1,83,173,136,190,
+102,170,170,134,115,61,53,47,48,3,115,97,242,209,190,221,96,145,1,115,156,
+148,84,138,248,161,161,254,237,155,79,65,91,97,242,209,129,187,95,95,146,
+254,141,156,148,84,139,248,160,161,1,19,155,79,65,250,193,16,74,60,74,97,
+131,119,77,124,69,54,93,60,99,89,97,39,71,45,69,56,26,16,14,19,6,0,1,0,100,
+255,246,4,128,4,94,0,27,0,0,5,38,2,53,52,18,54,51,50,22,18,21,20,2,7,39,54,
+54,53,52,38,35,34,6,21,20,22,23,1,175,158,173,137,241,148,145,243,138,172,
+159,56,94,109,178,164,166,176,109,94,10,85,1,28,179,163,1,10,151,155,254,
+245,158,180,254,228,84,134,40,215,181,201,219,217,203,181,215,40,0,0,1,0,
+100,255,246,4,100,6,204,0,42,0,0,5,38,2,17,53,16,18,36,51,50,23,7,38,38,35,
+34,2,3,54,51,50,22,18,21,20,2,7,39,54,54,53,52,38,35,34,6,6,21,21,20,22,22,
+23,1,177,169,164,140,1,5,174,228,139,133,35,147,78,171,173,19,137,175,152,
+242,132,174,157,56,94,109,178,164,88,150,82,42,92,77,10,81,1,75,1,14,176,
+1,13,1,149,218,176,103,64,77,254,240,254,184,116,140,254,254,172,182,254,
+219,83,139,40,211,180,201,219,70,120,69,81,158,181,130,42,0,0,1,0,100,253,
+198,4,200,4,94,0,52,0,0,1,22,22,51,50,54,18,17,16,33,34,6,21,20,22,51,50,
+54,55,54,51,50,22,21,7,7,55,52,38,35,34,14,4,35,34,2,53,52,18,54,51,32,0,
+17,16,2,4,35,34,39,1,231,26,87,28,139,183,90,254,111,168,187,41,44,24,47,
+41,70,95,90,96,3,150,3,36,21,18,26,25,31,49,70,52,125,129,143,252,148,1,16,
+1,53,148,254,241,181,114,89,254,115,15,20,155,1,69,1,35,2,129,248,215,212,
+187,58,76,134,133,116,69,68,85,84,79,40,59,70,59,40,1,6,251,183,1,29,157,
+254,97,254,148,254,245,254,92,222,40,0,0,2,0,100,255,236,4,59,4,94,0,22,0,
+42,0,0,1,20,2,6,35,34,38,38,53,52,54,55,53,38,38,53,52,54,54,51,50,22,18,
+5,35,34,6,21,20,22,51,50,54,53,52,38,35,34,6,21,20,51,51,4,59,149,255,154,
+117,195,113,119,115,92,117,117,194,104,149,252,142,253,250,40,113,128,138,
+144,163,170,172,164,122,132,231,25,2,39,157,254,244,146,82,154,97,94,130,
+29,5,19,123,81,87,151,86,149,254,251,212,91,83,97,107,222,211,209,220,98,
+90,158,0,1,0,80,255,236,7,10,4,94,0,54,0,0,19,54,54,51,50,22,22,21,20,7,22,
+22,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,2,6,35,32,39,6,
+6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,118,72,212,116,151,222,
+121,42,38,195,97,150,168,160,139,57,95,29,130,60,171,103,127,212,121,126,
+229,146,254,236,148,72,193,101,135,220,76,132,34,177,97,140,168,169,150,78,
+141,41,3,147,98,105,130,254,181,137,113,74,111,240,207,194,221,54,45,80,88,
+69,136,248,171,176,254,247,142,164,83,81,131,127,75,76,119,240,197,205,220,
+76,65,0,1,0,100,255,236,5,192,6,204,0,54,0,0,1,38,35,34,6,2,17,16,33,34,38,
+38,53,52,54,55,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,
+51,21,39,34,6,21,20,22,51,50,18,17,53,52,18,54,51,50,23,5,125,43,49,74,78,
+33,253,179,129,198,112,97,87,101,83,97,178,113,84,168,56,68,40,127,54,111,
+112,65,135,121,60,123,138,130,126,212,198,101,178,115,55,73,6,51,15,140,254,
+198,254,185,252,183,81,166,100,89,143,39,41,113,83,77,131,75,47,38,114,29,
+32,80,65,64,85,40,121,2,100,91,103,115,1,57,1,58,206,225,1,112,196,26,0,1,
+0,100,253,198,4,158,4,94,0,49,0,0,37,55,51,50,54,53,52,38,35,34,6,21,20,22,
+23,7,38,2,53,52,18,54,51,50,22,18,21,16,7,22,22,21,20,6,6,35,34,36,39,55,
+22,22,51,50,54,53,52,33,35,7,2,184,22,21,106,123,178,164,166,176,109,94,56,
+158,173,137,241,148,145,243,138,175,98,107,131,227,150,136,254,234,84,121,
+66,203,108,159,166,254,240,15,16,137,1,234,188,201,219,217,203,181,215,40,
+134,85,1,28,179,163,1,10,151,155,254,245,158,254,253,175,42,145,91,114,188,
+94,125,106,89,80,102,128,127,177,1,0,0,1,0,100,253,198,4,130,6,204,0,63,0,
+0,5,38,2,17,53,16,18,36,51,50,23,7,38,38,35,34,2,3,54,51,50,22,18,21,20,6,
+7,22,21,20,6,6,35,34,36,39,55,22,22,51,50,54,53,52,33,35,7,53,51,50,54,54,
+53,52,38,35,34,6,7,21,20,22,22,23,1,177,169,164,140,1,5,174,228,139,133,35,
+147,78,171,173,19,137,175,152,242,132,93,84,207,131,227,150,136,254,234,84,
+121,66,203,108,159,166,254,240,15,16,32,65,112,63,178,164,132,182,6,42,92,
+77,10,81,1,75,1,14,176,1,13,1,149,218,176,103,64,77,254,240,254,184,116,140,
+254,254,172,133,237,84,88,180,114,188,94,125,106,89,80,102,128,127,177,1,
+138,112,194,117,201,219,142,104,94,158,181,130,42,0,0,1,0,100,255,236,6,224,
+4,94,0,50,0,0,1,38,35,34,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,
+35,34,7,39,54,51,50,22,18,21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,
+54,51,50,23,2,220,72,78,143,155,155,140,115,141,10,170,11,140,115,139,156,
+155,143,78,72,81,106,133,134,218,122,120,218,136,115,191,51,49,191,115,137,
+218,119,122,217,135,133,106,3,172,40,228,217,197,220,168,149,150,167,220,
+197,218,227,40,117,61,141,254,246,178,166,252,135,120,105,104,121,136,252,
+165,178,1,9,142,61,0,2,0,100,255,236,6,224,4,94,0,40,0,52,0,0,37,22,51,50,
+54,53,52,38,35,34,6,7,22,21,16,0,35,34,38,2,53,52,18,54,51,50,22,23,54,54,
+51,50,22,22,21,20,2,6,35,34,39,1,20,22,51,50,54,53,52,38,35,34,6,4,104,72,
+78,136,162,155,140,105,136,17,12,255,0,216,130,214,119,117,214,139,121,183,
+60,56,190,106,138,217,119,118,216,140,133,106,253,5,150,134,137,146,148,138,
+133,148,158,40,240,205,197,220,152,138,68,71,254,253,254,200,148,1,8,159,
+164,1,5,142,103,90,88,105,132,246,165,184,254,244,143,61,1,254,201,232,229,
+204,206,223,226,0,0,1,0,100,253,198,4,165,4,94,0,55,0,0,1,22,51,50,54,18,
+17,16,2,35,34,6,21,20,22,51,51,21,39,34,6,21,20,22,51,50,54,55,23,6,6,35,
+34,38,38,53,52,54,55,38,38,53,52,54,54,51,50,4,18,21,16,2,4,35,34,39,1,198,
+74,66,138,184,89,216,222,128,155,145,164,12,60,123,138,137,117,64,91,55,68,
+76,135,80,134,191,100,95,89,98,86,120,213,137,186,1,25,152,149,254,239,188,
+97,95,254,115,35,153,1,71,1,43,1,64,1,57,87,71,86,90,121,2,100,91,101,117,
+25,36,121,41,37,91,157,103,87,141,39,40,114,86,68,132,80,194,254,157,222,
+254,233,254,94,220,40,0,0,1,0,100,253,168,6,235,4,94,0,80,0,0,5,54,55,38,
+39,55,22,51,50,54,53,52,38,38,35,34,6,7,3,14,2,35,34,38,38,53,52,18,54,51,
+50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,19,62,2,51,50,22,22,21,20,2,6,
+7,6,7,22,22,21,20,6,6,35,34,36,39,55,22,4,51,50,54,53,52,38,39,4,152,43,20,
+119,75,102,68,122,117,133,57,101,67,54,98,79,200,84,121,137,81,117,188,103,
+119,200,112,98,149,48,102,68,122,117,133,121,104,54,99,78,200,84,121,137,
+81,116,188,104,113,199,112,12,12,198,215,108,206,150,165,254,200,114,59,67,
+1,59,146,137,157,153,210,173,91,75,31,100,91,97,242,209,129,187,95,95,146,
+254,141,156,148,84,139,248,160,161,1,19,155,79,65,91,97,242,209,190,221,96,
+145,1,115,156,148,84,138,248,161,158,254,242,160,3,44,25,9,132,112,76,116,
+66,60,53,117,36,59,67,67,59,59,6,0,1,0,100,255,236,4,190,6,204,0,56,0,0,1,
+54,54,51,50,22,22,21,20,7,22,22,21,20,14,2,35,34,36,2,53,52,18,36,51,50,22,
+23,7,38,38,35,32,17,20,18,22,51,50,54,53,52,38,35,7,53,55,54,54,53,52,38,
+35,34,6,7,2,6,55,168,85,114,177,97,188,91,97,48,112,186,139,187,254,225,155,
+162,1,20,162,115,197,66,133,35,138,75,254,99,110,203,134,146,153,138,123,
+61,67,132,123,112,111,55,126,40,4,9,38,47,75,131,77,167,71,41,134,88,53,124,
+106,71,215,1,131,239,249,1,173,241,92,84,103,64,77,252,243,217,254,192,166,
+114,104,91,100,2,121,3,5,93,88,65,80,33,28,0,0,2,0,100,255,236,5,153,4,94,
+0,17,0,32,0,0,5,34,39,6,35,34,2,53,52,18,36,51,50,4,18,21,20,2,1,34,0,21,
+16,51,50,19,51,18,51,50,17,52,0,4,31,212,77,77,211,175,203,173,1,53,186,182,
+1,50,177,204,254,51,227,254,255,178,189,30,171,30,189,178,254,253,20,196,
+196,1,11,226,188,1,39,162,163,254,219,189,226,254,245,3,232,254,248,231,254,
+145,1,56,254,200,1,111,228,1,11,0,0,1,0,68,253,198,4,50,4,94,0,48,0,0,1,38,
+35,34,6,21,20,22,51,50,55,54,51,50,22,22,21,20,6,6,35,34,36,39,55,22,22,51,
+50,54,53,52,38,35,34,7,6,35,34,38,38,53,52,18,54,51,50,22,23,3,93,89,163,
+168,157,79,65,45,73,73,67,110,178,100,131,227,150,136,254,234,84,121,66,203,
+108,159,166,122,100,40,80,80,69,81,139,80,134,235,140,123,186,76,3,71,141,
+212,223,187,230,15,15,86,154,92,114,188,94,125,106,89,80,102,128,127,88,109,
+15,15,139,249,155,156,1,15,158,89,87,0,0,1,0,100,255,236,5,220,6,204,0,34,
+0,0,1,38,35,34,6,2,17,16,0,33,34,38,2,53,52,18,55,23,6,6,21,20,22,51,50,54,
+18,53,53,52,18,54,51,50,23,5,153,43,49,74,78,33,254,247,254,233,139,239,134,
+178,153,56,105,98,174,160,135,155,70,101,178,115,55,73,6,51,15,138,254,198,
+254,183,254,79,254,104,149,1,3,157,179,1,51,77,132,52,214,167,204,221,121,
+1,6,244,206,225,1,112,196,26,0,2,0,100,255,236,6,211,4,94,0,64,0,74,0,0,37,
+6,6,35,34,39,6,33,34,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,23,7,38,
+38,35,34,6,21,20,30,2,51,51,21,39,34,6,21,20,22,51,32,55,38,2,53,52,54,54,
+51,50,22,22,21,16,7,22,51,50,55,37,54,53,52,38,35,34,6,21,20,6,211,50,87,
+55,209,187,253,254,197,149,219,123,95,89,96,88,96,176,116,84,168,56,68,40,
+127,54,111,112,35,65,108,101,12,60,123,138,156,150,1,1,206,85,97,81,150,96,
+95,159,80,239,128,139,72,55,254,14,159,69,81,72,71,18,23,15,153,153,80,164,
+109,87,139,39,40,118,87,74,127,74,47,38,114,29,32,80,65,49,68,46,26,121,2,
+100,91,104,114,122,103,1,3,146,103,170,97,95,165,109,254,211,217,113,21,207,
+163,236,123,112,103,114,225,0,1,0,100,253,168,7,124,4,94,0,80,0,0,1,20,22,
+51,50,36,55,23,6,4,35,34,38,38,53,52,54,55,38,39,38,39,55,22,51,50,54,53,
+52,38,38,35,34,6,7,3,14,2,35,34,38,38,53,52,18,54,51,50,22,23,7,38,35,34,
+6,21,20,22,51,50,54,55,19,62,2,51,50,22,22,21,20,2,6,7,22,23,7,6,6,4,11,159,
+135,143,1,57,72,59,115,254,200,164,148,208,108,215,198,17,10,126,76,102,68,
+122,117,133,57,101,67,54,98,79,200,84,121,137,81,117,188,103,119,200,112,
+98,149,48,102,68,122,117,133,121,104,54,99,78,200,84,121,137,81,116,188,104,
+109,191,110,23,37,23,211,152,254,181,67,67,58,37,117,53,60,65,117,76,112,
+133,8,36,44,29,104,91,97,242,209,129,187,95,95,146,254,141,156,148,84,139,
+248,160,161,1,19,155,79,65,91,97,242,209,190,221,96,145,1,115,156,148,84,
+138,248,161,156,254,248,162,8,81,73,34,6,59,0,1,0,100,253,168,6,224,4,94,
+0,83,0,0,1,23,50,54,53,52,38,35,34,6,21,20,22,51,50,36,19,6,35,34,39,55,22,
+51,50,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,51,50,55,23,6,35,34,
+38,2,53,52,54,54,51,50,22,23,54,54,51,50,22,22,21,21,16,0,33,34,38,53,52,
+54,54,51,50,22,21,20,6,35,39,3,86,103,52,64,98,85,140,140,176,162,238,1,26,
+64,112,134,133,106,81,72,78,143,155,155,140,115,141,10,170,11,140,115,139,
+156,155,143,78,72,81,106,133,135,217,122,119,217,138,113,194,48,52,194,111,
+136,217,121,254,87,254,112,228,247,107,190,124,157,185,145,125,70,254,211,
+6,26,26,23,27,67,73,67,68,255,1,22,73,61,117,40,228,217,197,220,168,149,150,
+167,220,197,218,227,40,117,61,142,1,9,178,166,251,136,123,102,105,120,135,
+250,168,9,253,208,253,172,132,122,69,123,69,90,78,71,93,4,0,0,1,0,80,255,
+236,7,10,4,94,0,53,0,0,19,54,54,51,32,23,54,54,51,50,22,22,21,20,2,6,35,34,
+38,39,55,22,51,50,54,53,52,38,35,34,6,7,22,21,20,2,6,35,34,38,39,55,22,22,
+51,50,54,53,52,38,35,34,6,7,118,72,212,116,1,15,129,74,205,123,143,219,120,
+110,197,125,98,149,48,102,68,122,117,134,171,148,106,157,39,15,121,224,146,
+138,228,75,132,34,177,97,140,168,169,150,78,141,41,3,147,98,105,192,90,102,
+134,255,176,163,254,248,146,79,65,91,97,230,211,199,222,128,129,77,93,178,
+254,253,136,133,125,75,76,119,240,197,205,220,76,65,0,2,0,100,253,198,4,128,
+4,84,0,48,0,57,0,0,1,6,6,21,20,23,54,54,51,50,23,54,53,52,38,39,55,22,18,
+21,20,7,22,21,20,6,6,35,34,38,39,55,22,22,51,50,54,53,52,39,6,35,34,38,2,
+53,52,18,55,19,34,6,7,22,51,50,55,38,1,231,94,109,18,73,175,86,190,129,13,
+109,94,56,156,175,75,53,124,226,141,138,228,75,132,34,177,97,137,171,9,136,
+175,146,244,136,180,151,196,76,140,43,88,170,169,88,85,3,208,40,211,180,93,
+73,67,62,103,69,71,180,211,40,132,83,254,219,182,168,137,114,158,162,247,
+134,133,125,75,76,119,228,179,58,50,103,147,1,4,163,178,1,43,81,253,30,75,
+64,113,115,137,0,0,1,0,100,255,236,4,190,6,204,0,71,0,0,1,22,18,21,20,2,4,
+35,34,38,38,53,52,54,55,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,
+22,23,23,21,39,34,6,21,20,22,51,50,18,17,52,2,39,6,35,34,36,53,52,54,54,51,
+50,23,7,38,35,34,6,21,20,22,51,50,54,55,4,8,73,109,157,254,225,185,141,216,
+128,97,91,188,97,178,113,84,168,56,68,40,127,54,111,112,122,133,67,61,123,
+138,153,146,227,220,32,24,122,222,218,254,252,116,219,143,209,122,75,82,178,
+134,160,157,137,106,195,31,5,184,95,254,47,171,215,254,166,192,84,170,100,
+88,134,41,71,167,77,131,75,47,38,114,29,32,80,65,88,92,6,3,121,2,100,91,104,
+114,1,71,1,86,149,1,34,80,66,136,113,73,114,64,60,115,45,62,58,55,62,44,31,
+0,255,255,0,100,253,168,6,235,4,94,2,34,0,36,0,0,0,3,0,88,1,117,0,0,0,1,0,
+100,253,168,6,235,4,94,0,98,0,0,1,38,35,34,6,21,20,22,51,50,54,55,19,62,2,
+51,50,22,22,21,20,7,22,21,20,2,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,
+55,23,6,6,35,34,38,53,52,54,54,51,50,22,23,22,22,51,50,54,53,52,39,6,35,34,
+38,39,55,22,51,50,54,53,52,38,38,35,34,6,7,3,14,2,35,34,38,38,53,52,18,54,
+51,50,22,23,2,212,68,122,117,133,121,104,54,99,78,200,84,121,137,81,116,188,
+104,99,29,91,167,110,88,194,121,135,158,68,81,88,82,62,97,60,86,48,117,81,
+134,157,79,143,94,100,214,123,153,126,50,105,104,9,91,101,98,149,48,102,68,
+122,117,133,57,101,67,54,98,79,200,84,121,137,81,117,188,103,119,200,112,
+98,149,48,3,115,97,242,209,190,221,96,145,1,115,156,148,84,138,248,161,216,
+161,123,102,169,254,252,140,94,96,107,83,72,65,53,70,58,94,44,40,130,108,
+73,122,67,95,95,119,71,220,209,42,52,63,79,65,91,97,242,209,129,187,95,95,
+146,254,141,156,148,84,139,248,160,161,1,19,155,79,65,0,0,1,0,100,255,236,
+6,224,6,204,0,62,0,0,37,6,35,34,38,2,53,17,16,18,36,51,50,23,7,38,38,35,34,
+2,3,54,51,50,22,23,54,54,51,50,22,22,21,20,2,6,35,34,39,55,22,51,50,54,53,
+52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,51,50,55,3,45,106,133,135,217,122,
+140,1,5,174,228,139,133,35,147,78,167,169,21,120,162,113,194,48,52,194,111,
+136,217,121,123,218,133,133,106,81,72,78,143,155,155,140,115,141,10,170,11,
+140,115,139,156,155,143,78,72,41,61,142,1,9,178,1,27,1,13,1,149,218,176,103,
+64,77,254,251,254,195,94,123,102,105,120,135,250,168,179,254,247,141,61,117,
+40,228,217,197,220,168,149,150,167,220,197,218,227,40,0,2,0,100,255,236,4,
+11,4,94,0,14,0,26,0,0,1,16,0,35,34,38,2,53,52,18,54,51,50,22,18,5,20,22,51,
+50,54,53,52,38,35,34,6,4,11,255,0,216,130,214,119,117,214,139,138,212,115,
+253,17,150,134,137,146,148,138,133,148,2,39,254,253,254,200,148,1,8,159,164,
+1,5,142,143,254,252,164,201,232,229,204,206,223,226,0,1,0,100,255,236,6,235,
+4,94,0,56,0,0,37,6,6,35,34,38,2,53,52,54,54,51,50,22,22,23,19,22,22,51,50,
+54,54,53,52,38,35,34,7,39,54,54,51,50,22,18,21,20,6,6,35,34,38,38,39,3,38,
+38,35,34,6,21,20,22,51,50,55,3,58,48,149,98,113,200,118,104,188,116,80,137,
+120,86,200,78,99,54,66,102,57,133,117,122,68,102,48,149,98,113,200,118,104,
+189,115,80,137,120,86,200,78,99,54,105,120,133,117,122,68,124,65,79,156,1,
+19,160,160,248,139,83,146,159,254,141,145,96,95,186,130,211,240,97,91,65,
+79,156,254,237,160,160,249,138,83,146,159,1,115,146,95,221,190,211,240,97,
+0,1,0,100,255,236,6,235,4,94,0,56,0,0,1,38,35,34,6,21,20,22,51,50,54,55,19,
+62,2,51,50,22,22,21,20,2,6,35,34,38,39,55,22,51,50,54,53,52,38,38,35,34,6,
+7,3,14,2,35,34,38,38,53,52,18,54,51,50,22,23,2,212,68,122,117,133,121,104,
+54,99,78,200,84,121,137,81,116,188,104,119,200,112,98,149,48,102,68,122,117,
+133,57,101,67,54,98,79,200,84,121,137,81,117,188,103,119,200,112,98,149,48,
+3,115,97,242,209,190,221,96,145,1,115,156,148,84,138,248,161,161,254,237,
+155,79,65,91,97,242,209,129,187,95,95,146,254,141,156,148,84,139,248,160,
+161,1,19,155,79,65,0,0,1,255,244,253,198,3,244,4,94,0,41,0,0,19,54,54,51,
+50,22,22,21,20,6,7,22,21,20,6,6,35,34,36,39,55,22,22,51,50,54,53,52,33,35,
+7,53,55,51,50,54,53,52,38,35,34,7,118,77,212,123,143,219,120,105,98,185,131,
+227,150,136,254,234,84,121,66,203,108,159,166,254,240,15,16,20,19,130,151,
+171,148,165,95,3,148,99,103,134,255,176,145,250,73,89,170,114,188,94,125,
+106,89,80,102,128,127,177,1,138,1,229,192,199,222,141,0,1,0,100,255,236,4,
+128,4,84,0,27,0,0,1,6,6,21,20,22,51,50,54,53,52,38,39,55,22,18,21,20,2,6,
+35,34,38,2,53,52,18,55,1,231,94,109,175,167,164,178,109,94,56,156,175,137,
+244,145,146,244,136,180,151,3,208,40,211,180,208,219,219,208,180,211,40,132,
+83,254,219,182,161,254,250,147,147,1,4,163,178,1,43,81,0,1,0,80,253,198,5,
+9,4,94,0,52,0,0,1,50,54,18,17,16,0,35,32,21,20,22,23,23,22,22,21,20,6,6,35,
+34,39,55,22,22,51,50,53,52,38,38,39,38,38,53,52,54,54,51,50,4,18,21,16,2,
+4,35,34,39,55,22,22,2,195,132,176,90,254,243,232,254,218,73,78,87,134,104,
+99,176,108,215,108,102,32,118,63,207,44,77,117,140,98,123,221,134,191,1,59,
+179,152,254,245,178,116,89,68,30,84,254,80,153,1,68,1,38,1,53,1,76,153,45,
+87,51,57,88,146,81,79,136,77,144,91,40,57,157,43,73,68,75,88,133,73,75,136,
+79,202,254,151,223,254,247,254,97,222,40,133,16,19,0,255,255,255,244,253,
+198,3,244,6,24,2,34,0,37,0,0,0,3,0,90,0,136,0,0,255,255,0,100,255,236,4,128,
+6,24,2,34,0,38,0,0,0,3,0,90,0,224,0,0,255,255,0,100,253,168,6,224,4,94,2,
+34,0,6,0,0,0,3,0,88,1,126,0,0,0,4,0,100,253,168,3,240,4,94,0,33,0,45,0,57,
+0,68,0,0,5,38,39,6,35,34,38,38,53,52,54,54,51,50,23,54,53,52,38,35,34,6,7,
+39,54,54,51,50,0,21,20,7,22,23,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,
+51,50,54,53,52,38,35,34,6,19,50,55,38,38,35,34,6,21,20,22,3,67,4,19,133,183,
+109,168,98,96,166,99,193,130,19,170,169,78,141,41,125,60,216,127,232,1,17,
+91,53,19,252,195,223,165,166,222,223,165,166,222,150,116,118,119,123,123,
+119,118,116,195,157,83,44,128,68,85,115,108,50,82,73,125,67,119,69,71,129,
+74,116,89,99,192,207,76,65,72,95,112,254,228,237,200,158,111,148,254,167,
+105,130,131,104,105,130,131,105,50,63,63,50,51,63,63,1,175,127,58,68,69,53,
+60,71,255,255,0,100,253,168,4,128,4,94,2,34,0,9,0,0,0,3,0,89,0,139,0,0,255,
+255,0,100,253,168,4,100,6,204,2,34,0,10,0,0,0,3,0,89,0,139,0,0,255,255,0,
+80,253,168,7,10,4,94,2,34,0,13,0,0,0,3,0,88,1,157,0,0,0,3,0,100,253,168,4,
+225,6,204,0,52,0,65,0,77,0,0,5,38,2,17,53,16,18,36,51,50,23,7,38,38,35,34,
+2,3,54,51,50,22,18,21,16,7,22,22,21,20,7,39,54,53,52,38,35,35,7,53,54,17,
+52,38,35,34,6,7,21,20,22,22,23,3,52,54,51,50,22,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,1,177,169,164,140,1,5,174,228,139,133,35,147,
+78,171,173,19,137,175,152,242,132,175,131,169,105,121,58,165,147,15,16,202,
+178,164,132,182,6,42,92,77,239,209,149,97,167,94,211,147,147,211,150,116,
+88,89,123,118,94,92,112,10,81,1,75,1,14,176,1,13,1,149,218,176,103,64,77,
+254,240,254,184,116,140,254,254,172,254,251,180,30,187,120,190,142,97,87,
+123,118,137,1,136,86,1,83,201,219,142,104,94,158,181,130,42,254,19,99,135,
+63,108,63,99,137,137,100,50,67,67,50,49,64,64,0,2,0,100,255,236,4,239,4,94,
+0,44,0,89,0,0,1,22,22,21,20,6,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,
+55,23,6,35,34,38,38,53,52,54,54,51,50,22,23,22,22,51,50,54,53,52,38,39,19,
+22,22,21,20,6,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,55,23,6,35,34,38,
+38,53,52,54,54,51,50,22,23,22,22,51,50,54,53,52,38,39,4,148,43,48,73,127,
+84,85,152,83,93,113,59,58,71,63,50,52,41,62,70,102,68,122,71,80,138,85,92,
+163,81,97,97,51,56,73,28,22,109,43,48,73,127,84,85,152,83,93,113,59,58,71,
+63,50,52,41,62,70,102,68,122,71,80,138,85,92,163,81,97,97,51,56,73,28,22,
+1,171,34,97,56,60,124,76,94,99,109,83,68,62,59,68,18,116,30,63,112,69,66,
+127,76,94,98,118,75,64,53,27,64,20,2,204,34,97,56,60,124,76,94,99,109,83,
+68,62,59,68,18,116,30,63,112,69,66,127,76,94,98,118,75,64,53,27,64,20,0,0,
+1,0,80,255,236,3,244,4,94,0,27,0,0,19,54,54,51,50,22,22,21,20,2,6,35,34,38,
+39,55,22,22,51,50,54,53,52,38,35,34,6,7,118,72,212,116,151,222,121,130,231,
+140,135,220,76,132,34,177,97,140,168,169,150,78,141,41,3,147,98,105,130,254,
+181,173,254,253,141,131,127,75,76,119,240,197,205,220,76,65,0,3,0,100,255,
+236,4,112,6,204,0,11,0,23,0,34,0,0,1,32,0,17,16,0,35,34,0,17,16,0,19,50,18,
+19,38,38,35,34,6,7,18,18,19,34,2,3,54,54,51,50,23,2,2,2,104,1,0,1,8,254,242,
+250,246,254,242,1,7,253,155,164,13,50,180,113,94,173,52,13,163,154,172,156,
+4,69,169,88,190,152,4,162,6,204,254,54,254,70,254,108,254,56,1,202,1,146,
+1,185,1,203,249,170,1,22,1,44,82,92,87,76,254,213,254,222,5,204,254,185,254,
+135,52,58,118,1,118,1,82,0,0,1,0,80,253,198,3,244,4,94,0,40,0,0,19,54,54,
+51,50,22,22,21,20,2,6,35,34,39,18,22,51,50,54,55,23,6,6,35,32,2,17,53,55,
+22,22,51,50,54,53,52,38,35,34,6,7,118,72,212,116,151,222,121,130,231,140,
+130,109,17,147,159,75,149,51,102,67,196,117,254,248,248,132,34,177,97,140,
+168,169,150,78,141,41,3,147,98,105,130,254,181,173,254,253,141,62,254,251,
+213,73,63,98,85,91,1,128,1,154,14,75,76,119,240,197,205,220,76,65,0,0,1,0,
+20,253,196,5,103,4,94,0,41,0,0,1,17,16,18,22,51,50,55,23,6,35,34,2,3,6,35,
+34,38,38,53,17,52,38,35,34,7,39,54,51,50,22,22,21,17,20,22,22,51,50,54,53,
+17,4,15,38,85,79,31,44,67,73,55,164,212,16,128,155,105,181,109,43,41,36,31,
+14,45,63,63,108,64,46,97,81,129,145,4,74,252,197,254,231,254,221,133,15,127,
+26,1,128,1,60,148,120,204,108,1,207,50,55,9,132,15,87,162,106,254,165,114,
+120,64,185,179,2,105,0,1,0,100,255,236,5,53,4,94,0,39,0,0,37,6,35,34,38,53,
+52,55,54,53,52,38,38,35,34,6,21,20,22,23,7,38,2,53,52,18,54,51,50,22,18,21,
+20,7,6,21,20,51,50,55,5,53,90,63,114,128,17,16,84,155,106,166,176,109,94,
+56,158,173,137,241,148,148,236,145,24,24,79,44,43,10,30,124,106,36,99,99,
+126,125,193,92,217,203,181,215,40,134,85,1,28,179,163,1,10,151,132,254,252,
+144,80,112,112,55,105,13,0,2,0,100,255,236,10,3,4,94,0,39,0,79,0,0,37,6,35,
+34,38,53,52,55,54,53,52,38,38,35,34,6,21,20,22,23,7,38,2,53,52,18,54,51,50,
+22,18,21,20,7,6,21,20,51,50,55,5,6,35,34,38,53,52,55,54,53,52,38,38,35,34,
+6,21,20,22,23,7,38,2,53,52,18,54,51,50,22,18,21,20,7,6,21,20,51,50,55,5,53,
+90,63,114,128,17,16,84,155,106,166,176,109,94,56,158,173,137,241,148,148,
+236,145,24,24,79,44,43,5,10,90,63,114,128,17,16,84,155,106,166,176,109,94,
+56,158,173,137,241,148,148,236,145,24,24,79,44,43,10,30,124,106,36,99,99,
+126,125,193,92,217,203,181,215,40,134,85,1,28,179,163,1,10,151,132,254,252,
+144,80,112,112,55,105,13,121,30,124,106,36,99,99,126,125,193,92,217,203,181,
+215,40,134,85,1,28,179,163,1,10,151,132,254,252,144,80,112,112,55,105,13,
+0,1,0,100,255,236,3,234,5,184,0,41,0,0,37,6,6,35,34,38,38,53,52,54,55,38,
+38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,51,21,6,6,21,20,22,
+51,50,54,55,3,234,70,202,151,136,221,122,112,99,97,114,126,211,134,115,196,
+65,108,48,151,85,131,141,145,128,64,165,171,163,145,102,137,48,193,107,106,
+124,222,137,114,187,64,36,150,94,97,172,87,69,60,113,48,56,105,99,96,107,
+132,2,163,157,161,186,76,76,0,2,255,216,255,236,4,79,4,94,0,33,0,44,0,0,37,
+6,6,35,34,39,6,35,34,39,55,22,51,50,54,55,38,17,52,54,54,51,50,22,22,21,20,
+2,7,22,51,50,54,55,37,54,54,53,52,38,35,34,6,21,20,4,79,52,127,56,197,186,
+210,207,56,52,32,36,27,78,172,79,200,88,151,88,95,151,88,134,118,132,148,
+39,96,27,253,228,74,92,69,81,72,71,42,32,30,162,162,9,135,6,68,61,243,1,17,
+98,163,94,88,164,117,117,254,236,119,119,26,18,188,83,202,110,123,112,103,
+114,225,0,0,4,0,100,255,236,4,112,6,204,0,11,0,23,0,29,0,35,0,0,1,32,0,17,
+16,0,35,34,0,17,16,0,19,50,18,19,38,38,35,34,6,7,18,18,19,6,2,3,54,55,5,2,
+2,39,17,22,2,104,1,0,1,8,254,242,250,246,254,242,1,7,253,155,164,13,50,180,
+113,94,173,52,13,163,72,126,120,4,110,140,1,162,4,120,126,140,6,204,254,54,
+254,70,254,108,254,56,1,202,1,146,1,185,1,203,249,170,1,22,1,44,82,92,87,
+76,254,213,254,222,5,193,34,254,191,254,174,84,20,112,1,71,1,79,38,253,178,
+24,0,1,0,100,255,236,4,8,6,204,0,39,0,0,1,38,38,35,34,6,21,20,22,51,50,54,
+55,23,6,6,35,34,38,2,53,52,54,54,51,50,23,46,2,35,34,7,39,54,51,50,18,17,
+21,3,95,46,139,75,150,169,168,140,95,175,38,132,76,219,136,140,231,130,121,
+222,151,127,112,5,42,90,81,73,72,80,114,85,204,220,3,71,68,73,219,206,197,
+240,115,80,75,126,132,141,1,3,173,180,255,130,62,239,212,95,35,122,51,254,
+93,254,147,41,0,1,0,80,253,198,5,233,4,94,0,45,0,0,19,54,54,51,50,22,22,21,
+17,20,22,22,51,50,54,54,53,17,51,17,20,2,35,34,38,38,53,53,6,35,34,38,39,
+55,22,22,51,50,54,53,52,38,35,34,6,7,118,72,212,116,151,222,121,32,70,60,
+60,70,31,178,186,153,98,155,87,136,187,135,220,76,132,34,177,97,140,168,169,
+150,78,141,41,3,147,98,105,130,254,181,253,141,148,139,71,72,142,144,4,148,
+251,111,217,254,230,125,230,132,183,120,131,127,75,76,119,240,197,205,220,
+76,65,0,0,1,0,20,253,198,6,4,4,94,0,48,0,0,1,17,20,22,22,51,50,54,54,53,17,
+51,17,20,2,35,34,38,38,53,53,6,35,34,38,38,53,17,52,38,35,34,7,39,54,51,50,
+22,22,21,17,20,22,22,51,50,54,53,17,4,15,32,70,60,60,70,31,178,186,153,98,
+155,87,126,155,105,181,109,43,41,36,31,14,45,63,63,108,64,46,97,81,127,147,
+4,74,251,108,148,139,71,72,142,144,4,148,251,111,217,254,230,125,230,132,
+209,146,120,204,108,1,207,50,55,9,132,15,87,162,106,254,165,114,120,64,181,
+165,2,122,0,0,2,0,100,253,198,6,0,4,94,0,33,0,45,0,0,5,20,22,22,51,50,54,
+54,53,17,51,17,20,2,35,34,38,38,53,53,6,35,34,38,2,53,52,18,54,51,50,22,18,
+21,33,20,22,51,50,54,53,52,38,35,34,6,4,11,32,70,60,60,70,31,178,186,153,
+98,155,87,119,175,130,214,119,117,214,139,138,212,115,253,17,150,134,137,
+146,148,138,133,148,74,148,139,71,72,142,144,4,148,251,111,217,254,230,125,
+230,132,167,104,148,1,8,159,164,1,5,142,143,254,252,164,201,232,229,204,206,
+223,226,0,0,2,255,216,255,236,6,146,6,204,0,49,0,60,0,0,1,38,35,34,6,2,17,
+21,20,2,6,35,34,39,6,35,34,39,55,22,51,50,54,55,38,17,52,54,54,51,50,22,22,
+21,20,2,7,22,22,51,50,18,17,53,52,18,54,51,50,23,1,54,54,53,52,38,35,34,6,
+21,20,6,79,43,49,72,79,34,116,211,143,197,186,210,207,56,52,32,36,27,78,172,
+79,200,95,153,79,90,161,83,134,118,73,129,78,147,140,101,178,115,55,73,251,
+93,74,92,69,81,72,71,6,51,15,134,254,213,254,208,44,247,254,121,203,162,162,
+9,135,6,68,61,243,1,17,96,164,95,100,163,106,117,254,236,119,67,50,1,46,1,
+67,206,225,1,112,196,26,250,172,83,202,110,123,112,103,114,225,0,0,4,0,100,
+253,198,6,101,6,204,0,30,0,42,0,48,0,54,0,0,5,20,6,6,35,34,2,53,17,6,35,34,
+0,17,16,0,51,32,0,17,17,20,22,22,51,50,54,54,53,17,51,1,38,38,35,34,6,7,18,
+18,51,50,18,1,6,2,3,54,55,5,2,2,39,17,22,6,101,87,154,99,153,186,140,202,
+246,254,242,1,7,253,1,0,1,8,32,70,59,60,70,32,178,253,79,50,180,113,94,173,
+52,13,163,154,155,164,254,111,126,120,4,110,140,1,162,4,120,126,140,83,130,
+231,126,1,18,225,1,1,206,1,202,1,146,1,185,1,203,254,54,254,70,252,110,148,
+139,71,71,140,147,4,148,254,110,82,92,87,76,254,213,254,222,1,22,4,171,34,
+254,191,254,174,84,20,112,1,71,1,79,38,253,178,24,0,0,3,0,100,253,198,6,101,
+6,204,0,30,0,42,0,53,0,0,5,20,6,6,35,34,2,53,17,6,35,34,0,17,16,0,51,32,0,
+17,17,20,22,22,51,50,54,54,53,17,51,1,38,38,35,34,6,7,18,18,51,50,18,19,2,
+2,35,34,2,3,54,54,51,50,6,101,87,154,99,153,186,140,202,246,254,242,1,7,253,
+1,0,1,8,32,70,59,60,70,32,178,253,79,50,180,113,94,173,52,13,163,154,155,
+164,17,4,162,170,172,156,4,69,169,88,190,83,130,231,126,1,18,225,1,2,207,
+1,202,1,146,1,185,1,203,254,54,254,70,252,110,148,139,71,71,140,147,4,148,
+254,110,82,92,87,76,254,213,254,222,1,22,1,238,1,118,1,82,254,185,254,135,
+52,58,255,255,0,100,253,168,4,11,4,94,2,34,0,34,0,0,0,3,0,87,0,175,0,0,0,
+2,0,100,253,168,4,201,4,94,0,54,0,66,0,0,1,54,18,53,16,33,34,6,21,20,22,51,
+50,54,55,54,51,50,22,21,7,7,55,52,38,35,34,14,4,35,34,2,53,52,18,54,51,32,
+0,17,20,2,2,35,34,38,53,52,54,51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,
+3,157,56,59,254,111,168,187,41,44,24,47,41,70,95,90,96,3,150,3,36,21,18,26,
+25,31,49,70,52,125,129,143,252,148,1,17,1,53,152,237,130,102,130,131,107,
+79,122,254,210,56,41,40,54,55,39,41,56,254,169,119,1,74,233,2,129,248,215,
+212,187,58,76,134,133,116,69,68,85,84,79,40,59,70,59,40,1,6,251,183,1,29,
+157,254,90,254,148,221,254,64,254,249,122,101,91,116,97,116,43,54,56,41,43,
+58,56,0,0,2,0,100,253,168,4,73,4,94,0,51,0,63,0,0,1,38,35,34,6,21,20,22,51,
+50,55,54,51,50,22,21,20,6,4,35,34,38,53,52,54,51,50,22,21,20,7,54,54,53,52,
+38,35,34,7,6,35,34,38,38,53,52,18,54,51,50,22,23,1,20,22,51,50,54,53,52,38,
+35,34,6,3,93,89,163,168,157,79,65,45,73,73,67,176,235,141,255,0,123,138,154,
+130,102,97,125,6,81,93,125,113,40,80,80,69,81,139,80,134,235,140,123,186,
+76,253,196,56,41,40,54,55,39,41,56,3,71,141,212,223,187,230,15,15,183,140,
+114,198,123,113,105,92,120,123,99,40,28,33,139,101,95,112,15,15,139,249,155,
+156,1,15,158,89,87,250,211,43,54,56,41,43,58,56,0,0,3,0,100,253,168,4,128,
+4,84,0,52,0,61,0,73,0,0,1,6,6,21,20,23,54,54,51,50,23,54,53,52,38,39,55,22,
+18,21,20,7,22,21,20,2,6,35,34,38,53,52,54,51,50,22,21,20,7,54,54,53,52,39,
+6,35,34,38,2,53,52,18,55,19,34,6,7,22,51,50,55,38,1,20,22,51,50,54,53,52,
+38,35,34,6,1,231,94,109,17,74,175,86,185,132,15,109,94,56,156,175,77,55,139,
+242,142,138,154,129,104,94,128,6,82,100,8,131,181,153,242,131,176,155,196,
+76,140,43,88,170,168,89,85,254,166,56,41,40,54,55,39,41,56,3,201,40,211,180,
+86,74,68,62,118,66,82,180,211,40,139,83,254,219,182,186,135,116,133,173,254,
+249,144,113,105,89,123,122,99,41,28,42,244,149,54,46,95,140,1,1,173,182,1,
+37,83,253,30,75,64,113,115,137,253,15,43,54,56,41,43,58,56,0,255,255,0,100,
+253,168,6,224,4,94,0,35,0,87,3,131,0,0,0,2,0,6,0,0,0,2,0,118,253,168,3,244,
+4,94,0,46,0,58,0,0,19,54,54,51,50,22,22,21,20,6,7,22,22,21,20,6,6,35,34,38,
+53,52,54,51,50,22,21,7,54,54,53,52,38,35,35,7,53,55,51,50,54,53,52,38,35,
+34,7,19,20,22,51,50,54,53,52,38,35,34,6,118,77,212,123,143,219,120,109,94,
+82,103,129,241,127,143,149,132,100,96,124,5,83,76,140,132,15,16,20,19,131,
+150,171,148,165,95,93,56,41,40,54,55,39,41,56,3,148,99,103,134,255,176,153,
+236,69,30,140,87,115,196,127,111,107,91,121,122,99,69,39,128,100,97,106,1,
+138,1,219,192,199,222,141,251,58,43,54,56,41,43,58,56,255,255,0,100,253,168,
+4,128,4,84,2,34,0,38,0,0,0,3,0,87,1,36,0,0,0,2,0,100,255,236,3,180,4,94,0,
+27,0,38,0,0,1,38,35,34,6,21,21,23,54,51,50,22,22,21,20,6,6,35,34,38,38,53,
+52,18,54,51,50,23,1,34,7,22,22,51,50,54,53,52,38,3,53,101,117,150,169,1,137,
+156,99,173,98,97,173,105,127,221,125,129,228,137,187,144,254,143,152,99,32,
+142,93,89,103,113,3,124,88,210,218,20,20,106,78,138,89,85,156,92,142,252,
+161,169,1,11,147,128,254,2,113,122,127,100,85,78,99,0,0,2,0,100,255,236,3,
+201,4,94,0,28,0,40,0,0,37,6,6,35,34,38,2,53,52,18,54,51,50,22,22,21,20,6,
+6,35,34,39,21,20,22,51,50,54,55,1,22,22,51,50,54,53,52,38,35,34,6,3,201,82,
+182,111,139,226,129,127,221,125,111,172,92,107,176,87,159,135,169,150,76,
+134,51,253,206,51,133,70,90,118,104,88,99,142,151,87,84,142,1,7,168,162,1,
+2,145,83,147,87,89,157,95,106,20,218,210,72,59,1,210,60,57,114,83,85,100,
+138,0,2,0,100,255,236,4,11,4,94,0,14,0,26,0,0,1,16,0,35,34,38,2,53,52,18,
+54,51,50,22,18,5,20,22,51,50,54,53,52,38,35,34,6,4,11,255,0,216,130,214,119,
+117,214,139,138,212,115,253,17,150,134,137,146,148,138,133,148,2,39,254,253,
+254,200,148,1,8,159,164,1,5,142,143,254,252,164,201,232,229,204,206,223,226,
+0,1,0,80,255,236,3,244,4,94,0,27,0,0,19,54,54,51,50,22,22,21,20,2,6,35,34,
+38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,118,72,212,116,151,222,121,130,
+231,140,135,220,76,132,34,177,97,140,168,169,150,78,141,41,3,147,98,105,130,
+254,181,173,254,253,141,131,127,75,76,119,240,197,205,220,76,65,0,1,255,56,
+253,198,2,84,4,94,0,26,0,0,1,50,22,22,21,17,16,2,4,35,34,39,55,22,51,50,54,
+18,17,17,52,38,35,34,7,39,54,1,105,63,108,64,149,254,242,185,97,95,67,74,
+66,138,184,89,43,41,36,31,14,45,4,94,87,162,106,254,96,254,228,254,94,215,
+40,133,35,153,1,71,1,43,2,16,50,55,9,132,15,0,0,1,0,80,254,62,3,233,4,94,
+0,38,0,0,1,6,35,34,36,2,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,54,
+51,50,22,22,21,20,2,6,35,34,39,22,22,51,50,55,3,163,52,70,146,254,239,235,
+75,132,59,140,98,140,168,169,150,78,141,41,131,72,212,116,151,222,121,130,
+231,140,73,83,108,215,131,59,49,254,80,18,155,1,59,203,68,96,77,240,197,205,
+220,76,65,76,98,105,130,254,181,173,254,253,141,34,169,157,15,0,1,0,100,254,
+62,3,253,4,94,0,38,0,0,19,22,51,50,54,55,6,35,34,38,2,53,52,54,54,51,50,22,
+23,7,38,38,35,34,6,21,20,22,51,50,54,55,23,6,2,4,35,34,39,195,49,59,130,215,
+109,83,73,140,231,130,121,222,151,117,211,72,131,46,139,75,150,169,168,140,
+97,140,60,132,76,236,254,241,146,70,52,254,215,15,156,170,34,141,1,3,173,
+180,255,130,105,98,76,68,73,219,206,197,240,76,97,71,203,254,199,154,18,0,
+0,1,0,100,253,198,5,210,4,94,0,41,0,0,1,2,35,34,6,21,20,22,23,7,38,2,53,52,
+18,51,50,22,23,54,54,51,50,18,21,16,2,2,35,34,39,55,22,51,50,18,17,52,38,
+35,34,3,2,196,18,188,107,111,110,98,56,164,172,215,194,88,158,40,42,158,86,
+194,215,124,223,150,79,114,74,72,73,141,146,111,107,188,18,2,181,1,31,201,
+198,180,239,38,134,90,1,48,198,244,1,36,120,102,106,116,254,219,243,254,178,
+253,234,254,228,51,122,35,1,251,1,250,199,200,254,225,0,1,0,100,255,236,4,
+162,6,204,0,54,0,0,1,38,38,35,34,6,21,20,22,23,30,2,21,20,6,6,35,34,36,2,
+53,16,18,36,51,50,23,7,38,38,35,34,2,17,16,18,51,50,54,53,52,38,38,39,46,
+2,53,52,54,54,51,50,23,4,63,51,97,62,80,90,76,76,170,104,53,110,192,124,196,
+254,209,161,154,1,29,176,228,139,133,35,147,78,212,193,245,227,118,128,44,
+79,116,101,90,49,91,159,98,190,120,3,133,43,36,85,68,45,86,46,103,94,102,
+59,83,145,84,210,1,127,250,1,11,1,161,233,176,103,64,77,254,130,254,83,254,
+189,254,162,90,87,43,72,66,70,61,83,92,56,73,130,77,107,0,1,0,100,253,198,
+6,154,4,94,0,52,0,0,1,2,35,34,6,21,20,22,23,7,38,2,53,52,18,51,50,22,23,54,
+54,51,50,18,21,20,2,3,6,21,20,22,51,50,55,55,23,6,6,35,34,38,38,53,52,55,
+54,17,52,38,35,34,3,2,196,18,188,107,111,110,98,56,164,172,215,194,88,158,
+40,42,158,86,194,215,31,49,28,48,56,44,65,28,67,33,119,34,66,119,71,29,29,
+111,107,188,18,2,181,1,31,201,198,180,239,38,134,90,1,48,198,244,1,36,120,
+102,106,116,254,219,243,112,254,215,254,220,167,40,51,55,23,8,118,19,32,77,
+123,63,65,243,243,1,81,199,200,254,225,0,0,1,0,30,0,0,4,95,4,74,0,14,0,0,
+1,6,2,7,35,54,18,19,51,18,18,23,35,38,2,2,63,41,191,122,191,158,244,58,173,
+59,239,158,190,120,193,3,108,189,254,33,208,248,2,69,1,13,254,243,253,186,
+247,204,1,225,0,1,0,100,253,198,4,100,4,94,0,44,0,0,1,6,33,34,36,2,53,52,
+18,36,51,50,22,22,21,20,6,6,35,34,38,38,53,52,55,23,6,21,20,22,51,50,54,53,
+52,38,35,34,2,17,16,18,51,50,55,4,100,149,254,246,182,254,237,152,151,1,14,
+170,133,195,105,94,165,98,86,138,79,29,153,7,69,60,76,96,121,124,204,207,
+211,215,208,101,254,122,180,215,1,155,249,226,1,123,208,104,189,117,98,172,
+98,76,127,66,62,52,74,20,31,61,69,132,102,130,148,254,169,254,184,254,126,
+254,157,132,0,1,0,100,255,236,4,242,6,50,0,36,0,0,1,38,38,35,34,6,21,20,22,
+51,50,54,55,23,6,6,35,34,38,2,53,52,18,54,51,50,22,23,54,18,53,23,6,2,2,7,
+7,3,116,19,153,109,150,169,168,140,95,175,38,132,76,219,136,140,231,130,129,
+232,149,129,210,56,38,41,182,4,58,92,58,2,2,242,105,121,219,206,197,240,115,
+80,75,126,132,141,1,3,173,174,1,0,135,109,97,108,1,96,214,30,118,254,197,
+254,254,94,1,0,0,1,0,100,255,236,7,121,6,204,0,63,0,0,37,6,6,35,34,38,2,53,
+52,54,54,51,50,30,6,51,50,54,53,52,46,2,53,52,18,54,51,50,23,7,38,35,34,6,
+21,20,30,2,21,20,2,35,34,38,3,46,2,35,34,6,21,20,22,51,50,55,2,253,47,112,
+75,113,200,118,105,191,112,111,147,95,55,38,33,52,82,68,86,79,20,23,20,123,
+188,112,85,114,80,72,73,114,99,20,23,20,191,158,160,180,48,42,67,107,76,105,
+120,133,117,86,58,59,42,37,156,1,19,160,152,250,145,86,141,179,188,179,141,
+86,140,148,104,188,183,185,102,131,1,31,154,51,122,35,208,235,93,181,174,
+165,76,222,254,244,222,1,22,244,170,86,221,190,211,240,47,0,255,255,0,100,
+253,168,7,121,6,204,2,34,0,85,0,0,0,3,0,88,1,64,0,0,0,2,0,87,253,168,3,92,
+2,20,0,16,0,28,0,0,19,52,54,51,50,22,23,54,18,55,55,16,2,2,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,87,132,106,79,122,12,54,68,4,196,156,243,141,
+105,128,137,56,41,40,54,55,39,41,56,254,130,94,118,99,77,111,1,84,178,249,
+254,232,253,216,254,212,123,94,43,54,56,41,43,58,56,0,0,2,0,100,253,168,3,
+248,255,126,0,11,0,23,0,0,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,
+50,54,53,52,38,35,34,6,100,244,214,213,245,244,214,213,245,150,162,142,146,
+166,165,147,144,160,254,145,107,130,129,108,107,126,126,108,53,61,61,53,54,
+62,61,0,0,2,0,100,253,168,3,108,255,126,0,11,0,23,0,0,19,52,54,51,50,22,21,
+20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,100,223,165,166,222,223,
+165,166,222,150,116,118,119,123,123,119,118,116,254,147,105,130,131,104,105,
+130,131,105,50,63,63,50,51,63,63,0,0,1,0,80,4,216,2,212,6,24,0,12,0,0,1,38,
+38,39,6,7,35,54,55,51,22,22,23,2,38,22,93,33,76,73,173,160,120,95,48,166,
+55,4,216,22,135,61,139,79,129,191,84,198,38,0,0,0,0,0,0,15,0,186,0,3,0,1,
+4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,42,0,94,0,3,0,1,4,9,0,2,0,14,0,136,0,3,
+0,1,4,9,0,3,0,80,0,150,0,3,0,1,4,9,0,4,0,42,0,94,0,3,0,1,4,9,0,5,0,30,0,230,
+0,3,0,1,4,9,0,6,0,34,1,4,0,3,0,1,4,9,0,7,0,68,1,38,0,3,0,1,4,9,0,8,0,42,1,
+106,0,3,0,1,4,9,0,9,0,40,1,148,0,3,0,1,4,9,0,10,0,96,1,188,0,3,0,1,4,9,0,
+11,0,62,2,28,0,3,0,1,4,9,0,12,0,60,2,90,0,3,0,1,4,9,0,13,2,150,2,150,0,3,
+0,1,4,9,0,14,0,52,5,44,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,78,0,101,0,119,0,32,0,84,0,97,
+0,105,0,32,0,76,0,117,0,101,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,
+115,0,32,0,78,0,101,0,119,0,32,0,84,0,97,0,105,0,32,0,76,0,117,0,101,0,86,
+0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,
+104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,78,0,101,0,119,0,84,0,
+97,0,105,0,76,0,117,0,101,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,
+97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,
+102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,
+0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,
+0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,
+0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,
+0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,
+0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,
+112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,
+110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,91,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,
+1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,
+1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,
+1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,
+1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,
+1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,
+1,87,1,88,1,89,4,110,117,108,108,7,117,110,105,49,57,56,48,7,117,110,105,
+49,57,56,49,7,117,110,105,49,57,56,50,7,117,110,105,49,57,56,51,7,117,110,
+105,49,57,56,52,7,117,110,105,49,57,56,53,7,117,110,105,49,57,56,54,7,117,
+110,105,49,57,56,55,7,117,110,105,49,57,56,56,7,117,110,105,49,57,56,57,7,
+117,110,105,49,57,56,65,7,117,110,105,49,57,56,66,7,117,110,105,49,57,56,
+67,7,117,110,105,49,57,56,68,7,117,110,105,49,57,56,69,7,117,110,105,49,57,
+56,70,7,117,110,105,49,57,57,48,7,117,110,105,49,57,57,49,7,117,110,105,49,
+57,57,50,7,117,110,105,49,57,57,51,7,117,110,105,49,57,57,52,7,117,110,105,
+49,57,57,53,7,117,110,105,49,57,57,54,7,117,110,105,49,57,57,55,7,117,110,
+105,49,57,57,56,7,117,110,105,49,57,57,57,7,117,110,105,49,57,57,65,7,117,
+110,105,49,57,57,66,7,117,110,105,49,57,57,67,7,117,110,105,49,57,57,68,7,
+117,110,105,49,57,57,69,7,117,110,105,49,57,57,70,7,117,110,105,49,57,65,
+48,7,117,110,105,49,57,65,49,7,117,110,105,49,57,65,50,7,117,110,105,49,57,
+65,51,7,117,110,105,49,57,65,52,7,117,110,105,49,57,65,53,7,117,110,105,49,
+57,65,54,7,117,110,105,49,57,65,55,7,117,110,105,49,57,65,56,7,117,110,105,
+49,57,65,57,7,117,110,105,49,57,65,65,7,117,110,105,49,57,65,66,7,117,110,
+105,49,57,66,48,7,117,110,105,49,57,66,49,7,117,110,105,49,57,66,50,7,117,
+110,105,49,57,66,51,7,117,110,105,49,57,66,52,7,117,110,105,49,57,66,53,7,
+117,110,105,49,57,66,54,7,117,110,105,49,57,66,55,7,117,110,105,49,57,66,
+56,7,117,110,105,49,57,66,57,7,117,110,105,49,57,66,65,7,117,110,105,49,57,
+66,66,7,117,110,105,49,57,66,67,7,117,110,105,49,57,66,68,7,117,110,105,49,
+57,66,69,7,117,110,105,49,57,66,70,7,117,110,105,49,57,67,48,7,117,110,105,
+49,57,67,49,7,117,110,105,49,57,67,50,7,117,110,105,49,57,67,51,7,117,110,
+105,49,57,67,52,7,117,110,105,49,57,67,53,7,117,110,105,49,57,67,54,7,117,
+110,105,49,57,67,55,7,117,110,105,49,57,67,56,7,117,110,105,49,57,67,57,7,
+117,110,105,49,57,68,48,7,117,110,105,49,57,68,49,7,117,110,105,49,57,68,
+50,7,117,110,105,49,57,68,51,7,117,110,105,49,57,68,52,7,117,110,105,49,57,
+68,53,7,117,110,105,49,57,68,54,7,117,110,105,49,57,68,55,7,117,110,105,49,
+57,68,56,7,117,110,105,49,57,68,57,7,117,110,105,49,57,68,65,7,117,110,105,
+49,57,68,69,7,117,110,105,49,57,68,70,11,102,105,110,97,108,99,111,110,115,
+109,107,8,98,101,108,111,119,109,107,49,8,98,101,108,111,119,109,107,50,8,
+97,98,111,118,101,109,107,49,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,
+0,22,0,0,0,2,0,1,0,0,0,90,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,48,0,74,
+0,2,68,70,76,84,0,14,116,97,108,117,0,26,0,4,0,0,0,0,255,255,0,1,0,0,0,4,
+0,0,0,0,255,255,0,1,0,1,0,2,100,105,115,116,0,14,100,105,115,116,0,20,0,0,
+0,1,0,0,0,0,0,1,0,0,0,1,0,4,0,9,0,0,0,1,0,8,0,1,0,2,0,0,0,8,0,1,0,98,0,1,
+0,1,0,44,0,108,0,108,0,108,0,134,0,108,0,160,0,160,0,186,0,134,0,108,0,186,
+0,160,0,160,0,108,0,108,0,186,0,108,0,186,0,212,0,238,0,186,1,8,0,108,0,108,
+0,108,0,160,0,186,0,108,0,108,0,108,0,134,0,108,0,108,0,134,0,160,1,34,0,
+134,0,160,0,108,0,134,0,160,0,160,0,108,0,160,0,2,0,1,0,4,0,47,0,0,0,4,0,
+53,5,80,248,168,0,54,10,80,248,168,0,55,4,56,248,208,0,58,4,136,248,188,0,
+4,0,53,5,120,251,180,0,54,10,40,251,140,0,55,4,56,251,180,0,58,4,136,251,
+180,0,4,0,53,4,236,251,20,0,54,10,80,251,50,0,55,4,56,251,40,0,58,4,176,251,
+80,0,4,0,53,5,50,250,206,0,54,10,40,250,236,0,55,4,56,250,236,0,58,4,116,
+250,236,0,4,0,53,5,100,249,252,0,54,10,80,250,36,0,55,4,96,250,16,0,58,4,
+136,250,36,0,4,0,53,5,160,251,80,0,54,10,120,251,80,0,55,4,76,251,120,0,58,
+4,156,251,100,0,4,0,53,5,40,249,92,0,54,9,236,249,52,0,55,3,252,249,92,0,
+58,4,36,249,72,0,4,0,53,5,120,250,136,0,54,10,70,250,156,0,55,4,36,250,156,
+0,58,4,96,250,136,0,0,0,1,0,0,0,10,0,44,0,46,0,2,68,70,76,84,0,14,116,97,
+108,117,0,24,0,4,0,0,0,0,255,255,0,0,0,4,0,0,0,0,255,255,0,0,0,0,0,0,};
+#endif
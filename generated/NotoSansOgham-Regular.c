@@ -0,0 +1,195 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansOgham_Regular_ttf_size = 4464;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansOgham_Regular_ttf");
+asm(".type fz_font_NotoSansOgham_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansOgham_Regular_ttf, 4464");
+asm(".balign 64");
+asm("fz_font_NotoSansOgham_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansOgham-Regular.ttf\"");
+#else
+const int fz_font_NotoSansOgham_Regular_ttf_size = 4464;
+const char fz_font_NotoSansOgham_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,189,122,107,54,0,0,1,56,0,0,0,96,
+99,109,97,112,232,218,46,26,0,0,2,28,0,0,0,84,103,97,115,112,0,22,0,35,0,
+0,17,96,0,0,0,16,103,108,121,102,92,66,31,26,0,0,2,180,0,0,8,142,104,101,
+97,100,254,31,228,214,0,0,0,188,0,0,0,54,104,104,101,97,15,218,4,135,0,0,
+0,244,0,0,0,36,104,109,116,120,138,86,0,193,0,0,1,152,0,0,0,130,108,111,99,
+97,28,37,30,46,0,0,2,112,0,0,0,68,109,97,120,112,0,47,0,101,0,0,1,24,0,0,
+0,32,110,97,109,101,139,65,183,251,0,0,11,68,0,0,5,250,112,111,115,116,255,
+105,0,102,0,0,17,64,0,0,0,32,0,1,0,0,0,1,10,61,186,62,251,5,95,15,60,245,
+0,11,8,0,0,0,0,0,197,141,194,188,0,0,0,0,210,40,203,252,0,0,255,51,7,74,7,
+176,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,7,4,0,0,255,186,7,74,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,1,0,0,0,33,0,100,0,13,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,111,1,144,0,5,0,0,5,154,5,51,0,0,1,
+31,5,154,5,51,0,0,3,209,0,102,2,125,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,
+0,0,0,0,64,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,1,0,0,0,0,5,97,7,176,0,0,0,32,0,0,4,205,0,193,0,0,0,0,4,20,0,0,
+2,20,0,0,3,143,0,0,2,104,0,0,3,143,0,0,4,182,0,0,5,221,0,0,7,4,0,0,2,104,
+0,0,3,143,0,0,4,182,0,0,5,221,0,0,7,4,0,0,2,104,0,0,3,143,0,0,4,182,0,0,5,
+221,0,0,7,4,0,0,2,104,0,0,3,143,0,0,4,182,0,0,5,221,0,0,7,4,0,0,2,104,0,0,
+3,143,0,0,4,182,0,0,4,182,0,0,5,221,0,0,4,182,0,0,3,164,0,0,0,0,0,0,0,0,0,
+1,0,3,0,1,0,0,0,12,0,4,0,72,0,0,0,14,0,8,0,2,0,6,0,0,0,13,0,32,0,160,22,156,
+254,255,255,255,0,0,0,0,0,13,0,32,0,160,22,128,254,255,255,255,0,1,255,245,
+255,227,255,99,233,132,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,
+0,21,0,21,0,35,0,54,0,78,0,106,0,139,0,177,0,196,0,220,0,247,1,23,1,60,1,
+86,1,123,1,173,1,235,2,53,2,74,2,101,2,134,2,173,2,218,2,252,3,32,3,59,3,
+128,4,6,4,26,4,48,4,71,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,
+33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,
+0,0,2,63,3,213,2,131,0,3,0,0,1,33,53,33,3,213,252,43,3,213,2,63,68,0,0,1,
+0,0,255,51,2,174,2,131,0,7,0,0,1,33,17,35,17,35,53,33,2,174,254,209,150,233,
+2,174,2,63,252,244,3,12,68,0,0,1,0,0,255,51,3,213,2,131,0,11,0,0,1,33,17,
+35,17,35,17,35,17,35,53,33,3,213,254,209,150,145,150,233,3,213,2,63,252,244,
+3,12,252,244,3,12,68,0,0,1,0,0,255,51,4,252,2,131,0,15,0,0,1,21,33,17,35,
+17,35,17,35,17,35,17,35,17,35,53,4,252,254,209,150,145,150,145,150,233,2,
+131,68,252,244,3,12,252,244,3,12,252,244,3,12,68,0,1,0,0,255,51,6,35,2,131,
+0,19,0,0,1,21,33,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,53,6,35,
+254,209,150,145,150,145,150,145,150,233,2,131,68,252,244,3,12,252,244,3,12,
+252,244,3,12,252,244,3,12,68,0,1,0,0,255,51,7,74,2,131,0,23,0,0,1,21,33,17,
+35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,17,35,53,7,74,254,209,
+150,145,150,145,150,145,150,145,150,233,2,131,68,252,244,3,12,252,244,3,12,
+252,244,3,12,252,244,3,12,252,244,3,12,68,0,1,0,0,2,63,2,174,5,143,0,7,0,
+0,1,33,53,51,17,51,17,33,2,174,253,82,233,150,1,47,2,63,68,3,12,252,244,0,
+0,1,0,0,2,63,3,213,5,143,0,11,0,0,1,33,53,51,17,51,17,51,17,51,17,33,3,213,
+252,43,233,150,145,150,1,47,2,63,68,3,12,252,244,3,12,252,244,0,0,1,0,0,2,
+63,4,252,5,143,0,15,0,0,17,53,51,17,51,17,51,17,51,17,51,17,51,17,33,21,233,
+150,145,150,145,150,1,47,2,63,68,3,12,252,244,3,12,252,244,3,12,252,244,68,
+0,1,0,0,2,63,6,35,5,143,0,19,0,0,17,53,51,17,51,17,51,17,51,17,51,17,51,17,
+51,17,51,17,33,21,233,150,145,150,145,150,145,150,1,47,2,63,68,3,12,252,244,
+3,12,252,244,3,12,252,244,3,12,252,244,68,0,1,0,0,2,63,7,74,5,143,0,23,0,
+0,17,53,51,17,51,17,51,17,51,17,51,17,51,17,51,17,51,17,51,17,51,17,33,21,
+233,150,145,150,145,150,145,150,145,150,1,47,2,63,68,3,12,252,244,3,12,252,
+244,3,12,252,244,3,12,252,244,3,12,252,244,68,0,1,0,0,255,51,2,174,5,143,
+0,11,0,0,1,3,33,21,33,3,35,19,35,53,51,19,2,76,197,1,39,254,201,195,149,194,
+225,242,196,5,143,252,244,68,252,244,3,12,68,3,12,0,0,1,0,0,255,51,3,213,
+5,143,0,19,0,0,1,51,3,33,21,33,3,35,19,35,3,35,19,35,53,51,19,51,3,51,2,221,
+150,197,1,39,254,201,195,149,194,145,195,149,194,225,242,196,150,197,146,
+5,143,252,244,68,252,244,3,12,252,244,3,12,68,3,12,252,244,0,0,1,0,0,255,
+51,4,252,5,143,0,27,0,0,1,19,51,3,33,21,33,3,35,19,35,3,35,19,35,3,35,19,
+35,53,51,19,51,3,51,19,51,3,3,63,197,150,197,1,39,254,201,195,149,194,145,
+195,149,194,145,195,149,194,225,242,196,150,197,146,196,150,197,2,131,3,12,
+252,244,68,252,244,3,12,252,244,3,12,252,244,3,12,68,3,12,252,244,3,12,252,
+244,0,0,1,0,0,255,51,6,35,5,143,0,35,0,0,1,19,51,3,33,21,33,3,35,19,35,3,
+35,19,35,3,35,19,35,3,35,19,35,53,51,19,51,3,51,19,51,3,51,19,51,3,4,102,
+197,150,197,1,39,254,201,195,150,195,145,195,149,194,145,195,149,194,145,
+195,149,194,225,242,196,150,197,146,196,150,197,145,197,150,197,2,131,3,12,
+252,244,68,252,244,3,12,252,244,3,12,252,244,3,12,252,244,3,12,68,3,12,252,
+244,3,12,252,244,3,12,252,244,0,0,1,0,0,255,51,7,74,5,143,0,43,0,0,1,19,51,
+3,33,21,33,3,35,19,35,3,35,19,35,3,35,19,35,3,35,19,35,3,35,19,35,53,51,19,
+51,3,51,19,51,3,51,19,51,3,51,19,51,3,5,141,197,149,196,1,39,254,200,194,
+150,195,145,195,150,195,145,195,149,194,145,195,149,194,145,195,149,194,225,
+242,196,150,197,146,196,150,197,145,197,150,197,145,197,150,197,2,131,3,12,
+252,244,68,252,244,3,12,252,244,3,12,252,244,3,12,252,244,3,12,252,244,3,
+12,68,3,12,252,244,3,12,252,244,3,12,252,244,3,12,252,244,0,0,1,0,0,1,174,
+2,174,3,23,0,9,0,0,1,7,39,35,53,51,55,23,51,21,1,203,150,151,158,158,151,
+150,227,2,63,145,145,68,148,148,68,0,0,1,0,0,1,174,3,213,3,23,0,13,0,0,1,
+7,39,7,39,35,53,51,55,23,55,23,51,21,2,242,150,149,146,151,158,158,151,146,
+149,150,227,2,63,145,141,141,145,68,148,146,146,148,68,0,0,1,0,0,1,174,4,
+252,3,23,0,17,0,0,1,7,39,7,39,7,39,35,53,51,55,23,55,23,55,23,51,21,4,25,
+150,149,146,149,146,151,158,158,151,146,149,146,149,150,227,2,63,145,141,
+141,141,141,145,68,148,146,146,146,146,148,68,0,0,1,0,0,1,174,6,35,3,23,0,
+21,0,0,1,7,39,7,39,7,39,7,39,35,53,51,55,23,55,23,55,23,55,23,51,21,5,63,
+149,150,145,149,146,149,146,151,158,158,151,146,149,146,149,145,150,149,228,
+2,63,145,141,141,141,141,141,141,145,68,148,146,146,146,146,146,146,148,68,
+0,0,1,0,0,1,174,7,74,3,23,0,25,0,0,1,7,39,7,39,7,39,7,39,7,39,35,53,51,55,
+23,55,23,55,23,55,23,55,23,51,21,6,102,149,150,145,150,145,149,146,149,146,
+151,158,158,151,146,149,146,149,145,150,145,150,149,228,2,63,145,141,141,
+141,141,141,141,141,141,145,68,148,146,146,146,146,146,146,146,146,148,68,
+0,0,1,0,0,255,51,2,174,5,143,0,17,0,0,19,51,19,19,51,3,33,21,33,19,35,3,3,
+35,19,35,53,51,29,149,129,131,150,197,1,39,254,215,197,150,129,127,149,194,
+225,223,5,143,253,250,2,6,252,244,68,252,244,2,0,254,0,3,12,68,0,3,0,0,255,
+51,3,213,5,143,0,9,0,12,0,15,0,0,1,1,51,21,35,1,1,35,53,51,51,33,1,17,1,33,
+1,201,1,170,98,98,254,86,254,84,29,29,149,2,45,254,234,1,22,253,211,5,143,
+252,244,68,252,244,3,12,68,1,254,251,193,1,253,0,0,1,0,0,255,51,4,252,2,131,
+0,13,0,0,1,33,17,33,17,35,53,33,21,33,17,33,53,35,2,90,1,115,253,28,233,4,
+252,252,131,1,184,221,1,61,253,246,3,12,68,68,253,138,223,0,0,5,0,0,255,51,
+4,252,2,131,0,20,0,24,0,28,0,32,0,35,0,0,5,35,55,39,3,35,1,1,35,53,33,21,
+35,1,1,35,3,7,23,35,39,19,23,19,35,1,55,39,35,1,55,39,7,19,23,55,2,10,153,
+157,82,239,154,1,62,254,217,74,4,252,143,254,219,1,61,153,242,82,160,154,
+82,76,82,217,164,254,141,82,135,164,1,121,82,82,82,23,59,58,205,203,104,254,
+205,1,150,1,118,68,68,254,138,254,106,1,51,104,203,105,1,245,104,1,22,254,
+236,104,172,254,33,105,104,104,1,118,75,75,0,13,0,0,2,63,6,35,7,176,0,51,
+0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,0,19,53,51,
+53,35,53,51,53,35,53,51,53,35,53,51,53,51,21,51,53,51,21,51,53,51,21,51,53,
+51,21,51,21,35,21,51,21,35,21,51,21,35,21,51,21,35,21,33,21,33,53,51,53,55,
+51,53,35,1,53,35,21,1,51,53,35,1,51,53,35,17,51,53,35,19,53,35,21,1,51,53,
+35,17,51,53,35,3,53,35,21,1,51,53,35,5,51,53,35,5,51,53,35,88,145,145,145,
+145,145,145,145,150,145,150,145,150,145,150,145,145,145,145,145,145,145,145,
+1,47,249,221,233,150,145,145,1,184,145,254,217,145,145,2,78,145,145,145,145,
+145,145,254,217,145,145,145,145,150,145,2,78,145,145,254,217,145,145,254,
+217,145,145,3,20,150,145,150,145,150,145,150,145,145,145,145,145,145,145,
+145,150,145,150,145,150,145,150,145,68,68,145,150,145,254,72,145,145,3,117,
+145,253,33,145,1,189,145,251,250,145,145,1,39,145,1,189,145,251,250,145,145,
+2,78,145,145,145,145,145,0,2,0,0,1,98,4,252,2,131,0,3,0,7,0,0,1,21,33,53,
+23,33,21,33,4,252,251,4,193,3,53,252,203,2,131,68,68,139,150,0,0,1,0,0,255,
+51,3,234,5,143,0,8,0,0,17,51,1,33,21,33,1,35,1,150,1,196,1,144,254,112,254,
+60,150,1,215,5,143,252,244,68,252,244,3,47,0,1,0,0,255,51,3,164,5,143,0,8,
+0,0,1,1,35,1,33,53,33,1,51,1,205,1,215,150,254,60,254,182,1,74,1,196,150,
+2,98,252,209,3,12,68,3,12,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,
+0,1,4,9,0,1,0,30,0,94,0,3,0,1,4,9,0,2,0,14,0,124,0,3,0,1,4,9,0,3,0,68,0,138,
+0,3,0,1,4,9,0,4,0,30,0,94,0,3,0,1,4,9,0,5,0,30,0,206,0,3,0,1,4,9,0,6,0,26,
+0,236,0,3,0,1,4,9,0,7,0,68,1,6,0,3,0,1,4,9,0,8,0,42,1,74,0,3,0,1,4,9,0,9,
+0,40,1,116,0,3,0,1,4,9,0,10,0,96,1,156,0,3,0,1,4,9,0,11,0,62,1,252,0,3,0,
+1,4,9,0,12,0,60,2,58,0,3,0,1,4,9,0,13,2,150,2,118,0,3,0,1,4,9,0,14,0,52,5,
+12,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,
+49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,
+0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,
+101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,
+0,83,0,97,0,110,0,115,0,32,0,79,0,103,0,104,0,97,0,109,0,82,0,101,0,103,0,
+117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,79,0,103,0,104,0,97,0,109,0,86,0,101,
+0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,
+78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,79,0,103,0,104,0,97,0,109,0,
+78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,
+0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,
+0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,
+32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,
+0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,
+0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,
+0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,
+0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,
+0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,
+65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,
+0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,
+0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,
+0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,
+0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,
+115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,
+0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,
+0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,
+101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,
+0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,
+0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,
+0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,
+0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,
+0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,
+0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,
+0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,
+0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,
+0,14,0,7,255,255,0,15,};
+#endif
@@ -0,0 +1,215 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansOldItalic_Regular_ttf_size = 5000;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansOldItalic_Regular_ttf");
+asm(".type fz_font_NotoSansOldItalic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansOldItalic_Regular_ttf, 5000");
+asm(".balign 64");
+asm("fz_font_NotoSansOldItalic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansOldItalic-Regular.ttf\"");
+#else
+const int fz_font_NotoSansOldItalic_Regular_ttf_size = 5000;
+const char fz_font_NotoSansOldItalic_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,123,3,109,222,0,0,1,56,0,0,0,96,99,
+109,97,112,0,221,12,124,0,0,2,52,0,0,0,184,103,97,115,112,0,22,0,35,0,0,19,
+120,0,0,0,16,103,108,121,102,2,130,120,13,0,0,3,60,0,0,10,4,104,101,97,100,
+4,159,171,162,0,0,0,188,0,0,0,54,104,104,101,97,15,29,4,211,0,0,0,244,0,0,
+0,36,104,109,116,120,192,51,16,209,0,0,1,152,0,0,0,156,108,111,99,97,46,24,
+49,14,0,0,2,236,0,0,0,80,109,97,120,112,0,45,0,55,0,0,1,24,0,0,0,32,110,97,
+109,101,143,41,186,46,0,0,13,64,0,0,6,22,112,111,115,116,255,105,0,102,0,
+0,19,88,0,0,0,32,0,1,0,0,0,1,5,31,31,180,165,141,95,15,60,245,0,11,8,0,0,
+0,0,0,204,201,144,5,0,0,0,0,210,40,203,253,0,27,255,154,6,115,5,233,0,0,0,
+9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,6,233,0,27,0,26,6,115,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,1,0,0,0,39,0,54,0,5,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,4,5,14,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,5,
+51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,32,0,0,
+0,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,2,88,0,0,0,1,
+0,0,0,0,4,74,5,182,0,0,0,32,0,0,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,0,5,190,
+0,55,5,4,0,143,4,51,0,78,5,43,0,106,4,154,0,84,4,139,0,96,4,174,0,96,6,102,
+0,240,6,117,0,143,2,152,0,240,5,53,0,98,4,137,0,76,6,233,0,82,5,211,0,82,
+6,225,0,240,6,117,0,143,5,72,0,160,6,47,0,225,5,170,0,125,5,104,0,113,4,20,
+0,158,5,4,0,47,5,104,0,27,5,27,0,61,5,248,0,133,5,176,0,27,5,57,0,154,4,195,
+0,106,4,195,0,106,3,240,0,240,5,104,0,27,2,205,1,10,5,104,0,27,5,27,0,61,
+4,213,0,47,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,0,12,0,
+8,0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,0,160,254,
+255,255,255,0,1,255,245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+12,0,0,0,0,0,100,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,
+0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,254,255,
+0,0,254,255,0,0,0,1,0,1,3,0,0,1,3,30,0,0,0,4,0,1,3,32,0,1,3,35,0,0,0,35,0,
+0,0,21,0,21,0,21,0,21,0,62,0,117,0,154,0,193,0,227,0,253,1,38,1,66,1,143,
+1,155,1,182,1,203,1,237,2,7,2,52,2,107,2,126,2,154,2,211,2,255,3,46,3,73,
+3,94,3,127,3,185,3,214,4,39,4,75,4,111,4,130,4,167,4,180,4,200,4,233,5,2,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,2,0,55,255,242,4,207,5,190,
+0,12,0,17,0,0,33,1,6,2,3,39,26,2,36,37,23,17,3,6,6,7,1,4,43,253,160,52,102,
+67,183,87,147,206,1,77,1,46,101,182,211,203,66,1,224,2,229,97,254,171,254,
+195,28,1,147,1,145,1,10,236,150,30,250,96,4,221,122,153,75,253,164,0,0,3,
+0,143,255,223,4,20,5,211,0,16,0,23,0,30,0,0,37,7,38,36,38,53,52,54,55,38,
+38,53,52,54,36,55,23,7,6,4,21,20,4,23,21,6,4,21,20,4,23,4,20,114,237,254,
+156,194,211,234,232,184,194,1,95,219,108,184,199,254,232,1,15,208,229,254,
+239,1,14,232,16,49,44,126,144,67,94,192,114,106,148,71,74,159,140,45,43,135,
+50,135,55,48,159,86,63,102,183,57,41,125,55,0,0,1,0,78,255,211,3,186,5,219,
+0,18,0,0,19,22,4,18,21,20,2,0,7,39,54,36,54,53,52,46,2,39,164,231,1,103,200,
+209,254,147,224,78,197,1,50,173,73,161,255,183,5,219,77,247,254,220,135,132,
+254,205,254,244,86,154,79,224,238,91,52,152,165,165,66,0,0,1,0,106,0,0,4,
+59,5,201,0,20,0,0,33,17,14,2,21,20,5,21,1,39,1,38,38,53,52,54,36,55,23,17,
+3,131,145,236,139,1,98,254,15,130,1,148,179,155,195,1,109,243,104,5,16,41,
+110,115,41,131,203,86,254,33,125,1,127,122,176,85,85,183,169,63,31,250,86,
+0,0,1,0,84,255,231,3,170,5,201,0,14,0,0,1,23,17,35,17,1,39,1,17,5,39,1,17,
+5,39,3,94,76,184,253,178,80,2,158,253,213,66,2,109,253,219,62,5,201,25,250,
+80,1,23,254,208,150,1,82,1,55,237,151,1,4,1,68,211,156,0,1,0,96,0,0,3,156,
+5,205,0,10,0,0,19,39,1,17,5,39,1,23,17,35,17,170,74,2,131,253,228,76,2,215,
+74,185,1,102,162,1,12,1,209,237,162,1,51,25,250,76,2,92,0,1,0,96,0,0,4,78,
+5,184,0,19,0,0,1,5,39,37,17,5,39,37,17,51,17,37,23,5,17,37,23,5,17,35,1,248,
+254,162,58,1,152,254,162,58,1,152,184,1,100,58,254,98,1,100,58,254,98,184,
+1,31,123,155,144,1,239,129,156,143,1,80,254,242,127,156,143,254,16,129,155,
+148,254,160,0,3,0,240,0,82,5,119,5,100,0,3,0,7,0,11,0,0,19,33,17,33,55,33,
+17,33,37,17,33,17,240,4,135,251,121,178,3,35,252,221,3,35,252,221,5,100,250,
+238,162,1,151,162,1,150,254,106,0,5,0,143,0,66,5,225,5,127,0,15,0,21,0,27,
+0,33,0,39,0,0,37,34,36,2,53,52,18,36,51,50,4,18,21,20,2,4,1,52,39,1,1,54,
+37,20,23,1,1,6,19,22,51,50,55,1,53,1,38,35,34,7,3,53,190,254,199,175,176,
+1,56,194,187,1,59,178,175,254,196,1,65,106,254,205,1,55,102,252,2,97,1,47,
+254,213,101,211,123,176,170,123,254,217,1,33,123,166,168,123,66,176,1,55,
+188,196,1,49,165,169,254,208,193,189,254,201,175,2,163,195,141,254,180,254,
+177,134,197,189,140,1,77,1,72,137,253,139,86,82,1,72,229,1,62,77,79,0,0,1,
+0,240,0,0,1,168,5,182,0,3,0,0,51,17,51,17,240,184,5,182,250,74,0,1,0,98,0,
+0,4,70,5,182,0,10,0,0,1,1,55,1,17,51,17,35,17,1,39,2,158,253,196,119,2,180,
+185,185,253,101,136,3,6,1,217,135,253,177,2,159,250,74,2,236,253,122,134,
+0,0,1,0,76,255,236,3,154,5,182,0,6,0,0,1,17,7,1,55,1,17,3,154,84,253,6,84,
+2,65,5,182,250,88,34,1,63,164,254,254,4,233,0,0,1,0,82,255,233,6,115,5,141,
+0,12,0,0,1,1,3,39,1,51,1,1,51,1,7,1,1,2,240,254,217,205,170,1,33,170,1,34,
+1,72,184,1,52,181,255,0,254,199,1,236,2,172,253,233,55,2,213,253,78,2,178,
+250,131,39,4,160,253,99,0,1,0,82,255,236,5,92,5,160,0,9,0,0,19,55,1,1,51,
+1,7,3,1,35,82,176,1,0,1,141,174,1,31,182,240,254,129,157,5,102,58,253,55,
+2,182,250,135,40,4,155,253,101,0,5,0,240,0,82,5,242,5,100,0,3,0,7,0,11,0,
+15,0,19,0,0,19,33,17,33,1,17,33,17,1,33,17,33,37,17,33,17,1,17,33,17,240,
+5,2,250,254,2,215,1,127,252,86,1,127,254,129,1,127,254,129,2,43,1,127,5,100,
+250,238,2,59,254,99,1,157,254,99,1,157,158,1,156,254,100,1,156,254,100,1,
+156,0,2,0,143,0,55,5,229,5,131,0,15,0,31,0,0,1,20,2,4,35,34,36,2,53,52,18,
+36,51,50,4,18,5,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,5,229,179,254,
+190,181,190,254,194,176,182,1,63,185,181,1,60,183,251,101,130,229,138,138,
+228,128,129,228,135,138,231,130,2,223,189,254,202,181,182,1,52,192,187,1,
+55,176,176,254,202,190,145,236,133,132,235,147,145,236,131,133,235,0,0,1,
+0,160,0,0,4,88,5,121,0,7,0,0,1,17,35,17,33,17,35,17,4,88,184,253,184,184,
+5,121,250,135,4,213,254,23,2,141,0,1,0,225,0,0,5,78,5,195,0,11,0,0,1,1,17,
+35,17,55,1,1,23,17,35,17,3,16,254,123,170,97,1,208,1,220,96,182,3,90,1,82,
+251,84,5,174,21,254,112,1,144,21,250,82,4,172,0,2,0,125,255,154,5,45,5,143,
+0,18,0,34,0,0,1,20,6,6,7,17,35,17,46,2,53,52,18,36,51,50,4,22,5,20,22,22,
+51,50,54,54,53,52,38,38,35,34,6,6,5,45,132,234,144,184,144,233,129,160,1,
+22,164,166,1,25,151,252,10,109,190,115,113,192,109,106,192,118,117,191,104,
+3,92,148,246,155,20,254,119,1,137,22,157,243,147,159,1,3,145,151,251,161,
+121,196,109,109,194,123,119,188,105,106,188,0,0,2,0,113,255,244,4,121,5,203,
+0,11,0,20,0,0,19,52,18,0,37,23,17,7,36,36,38,38,1,6,4,6,21,20,22,4,23,113,
+234,1,161,1,16,109,105,254,252,254,157,218,94,3,80,167,254,211,178,160,1,
+34,196,2,219,107,1,16,1,10,107,25,250,103,37,101,213,199,171,2,82,64,195,
+204,72,68,188,192,80,0,0,1,0,158,255,184,3,129,5,231,0,26,0,0,19,4,4,21,20,
+6,7,6,6,21,20,22,22,23,7,36,36,53,52,54,55,54,54,53,52,36,39,238,1,48,1,99,
+137,136,156,118,141,235,157,66,254,172,254,193,130,138,169,99,254,208,218,
+5,231,93,237,112,78,180,108,124,130,48,36,113,113,51,160,121,227,117,77,178,
+116,140,112,43,58,168,69,0,0,1,0,47,0,0,4,213,5,184,0,11,0,0,1,37,55,5,17,
+51,17,5,7,37,17,35,2,37,254,10,53,1,193,184,1,248,53,254,61,184,3,100,148,
+164,129,1,157,254,47,141,162,127,252,201,0,1,0,27,0,80,5,78,5,131,0,6,0,0,
+1,23,1,35,1,55,1,4,160,174,253,180,176,253,201,174,1,225,5,131,61,251,10,
+4,246,61,251,166,0,1,0,61,0,41,4,221,5,141,0,11,0,0,37,7,1,1,39,1,1,55,1,
+1,23,1,4,221,168,254,84,254,78,154,1,228,254,59,164,1,143,1,146,153,254,62,
+123,82,2,72,253,184,82,2,117,2,75,82,253,226,2,30,82,253,185,0,0,3,0,133,
+255,154,5,115,5,143,0,18,0,25,0,32,0,0,1,50,4,22,21,20,6,6,7,17,35,17,46,
+2,53,52,54,36,1,20,22,23,17,6,6,5,52,38,39,17,54,54,2,254,190,1,31,152,136,
+244,159,176,166,247,134,163,1,36,254,246,194,164,165,193,3,118,194,158,160,
+192,5,143,142,252,157,142,244,152,15,254,91,1,165,14,152,244,143,158,252,
+141,253,217,163,215,23,3,27,19,212,163,162,209,21,252,231,23,217,0,0,1,0,
+27,0,0,5,150,5,182,0,11,0,0,1,51,17,1,23,1,17,35,17,1,55,1,2,131,184,1,211,
+136,253,165,184,253,152,141,1,219,5,182,252,248,2,37,115,253,92,254,68,1,
+188,2,170,117,253,211,0,3,0,154,255,236,4,160,5,203,0,27,0,39,0,53,0,0,1,
+20,6,7,22,22,21,20,6,6,35,34,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,
+22,1,20,22,51,50,54,53,52,38,35,34,6,1,34,6,6,21,20,22,51,50,54,53,52,38,
+38,4,133,140,124,147,144,132,235,145,147,239,132,144,140,118,144,132,226,
+134,139,223,127,252,207,191,137,141,188,195,135,139,188,1,68,82,137,78,180,
+125,122,171,79,138,4,57,104,183,55,53,182,121,112,185,106,102,182,113,117,
+187,54,43,188,105,109,192,111,106,188,252,226,107,147,152,123,104,143,152,
+3,46,70,120,66,104,146,143,107,67,119,70,0,0,2,0,106,0,0,3,211,5,201,0,9,
+0,15,0,0,33,17,36,0,53,52,0,37,23,17,1,20,5,17,6,4,3,27,254,162,254,173,1,
+146,1,106,109,253,96,1,232,230,254,254,1,119,124,1,11,158,139,1,39,123,39,
+250,94,3,150,179,188,2,227,89,194,0,0,2,0,106,255,240,3,211,5,184,0,9,0,15,
+0,0,1,17,7,36,0,53,52,0,37,17,1,20,5,17,6,6,3,211,109,254,134,254,126,1,102,
+1,75,254,24,1,232,240,248,5,184,250,88,32,110,1,25,162,133,1,18,123,1,141,
+252,90,179,177,2,217,94,190,0,1,0,240,0,0,3,147,5,182,0,7,0,0,1,33,21,33,
+17,35,17,51,1,168,1,235,254,21,184,184,3,41,162,253,121,5,182,0,0,2,0,27,
+0,100,5,78,5,156,0,6,0,18,0,0,1,23,1,35,1,55,1,3,52,54,51,50,22,21,20,6,35,
+34,38,4,160,174,253,180,176,253,201,174,1,225,98,61,45,49,56,58,47,45,61,
+5,152,62,251,10,4,246,62,251,165,3,236,60,55,63,52,54,61,56,0,1,1,10,0,0,
+1,195,5,182,0,3,0,0,33,17,51,17,1,10,185,5,182,250,74,0,0,1,0,27,0,59,5,78,
+5,111,0,6,0,0,55,39,1,51,1,7,1,201,174,2,75,177,2,55,174,254,30,59,62,4,246,
+251,10,62,4,91,0,1,0,61,0,41,4,221,5,141,0,11,0,0,37,7,1,1,39,1,1,55,1,1,
+23,1,4,221,168,254,84,254,78,154,1,228,254,59,164,1,143,1,146,153,254,62,
+123,82,2,72,253,184,82,2,117,2,75,82,253,226,2,30,82,253,185,0,0,1,0,47,0,
+0,4,166,5,233,0,8,0,0,33,17,1,39,1,1,7,1,17,2,14,254,123,90,2,59,2,60,90,
+254,123,4,227,254,230,131,1,157,254,99,131,1,26,251,29,0,0,0,0,15,0,186,0,
+3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,40,0,94,0,3,0,1,4,9,0,2,0,14,0,134,
+0,3,0,1,4,9,0,3,0,78,0,148,0,3,0,1,4,9,0,4,0,40,0,94,0,3,0,1,4,9,0,5,0,30,
+0,226,0,3,0,1,4,9,0,6,0,34,1,0,0,3,0,1,4,9,0,7,0,68,1,34,0,3,0,1,4,9,0,8,
+0,42,1,102,0,3,0,1,4,9,0,9,0,40,1,144,0,3,0,1,4,9,0,10,0,96,1,184,0,3,0,1,
+4,9,0,11,0,62,2,24,0,3,0,1,4,9,0,12,0,60,2,86,0,3,0,1,4,9,0,13,2,150,2,146,
+0,3,0,1,4,9,0,14,0,52,5,40,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,79,0,108,0,100,0,32,0,
+73,0,116,0,97,0,108,0,105,0,99,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,
+105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,
+0,115,0,32,0,79,0,108,0,100,0,32,0,73,0,116,0,97,0,108,0,105,0,99,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,
+0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,79,0,108,0,100,0,73,0,116,
+0,97,0,108,0,105,0,99,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,
+32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,
+32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,
+0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,
+0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,
+0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,
+0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,
+0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,
+0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,
+0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,
+0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,
+0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,
+101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,
+115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,
+46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,
+0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,
+0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,
+83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,
+0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,
+0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,
+0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,
+101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,
+0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,
+0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,
+0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,
+0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,
+0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,
+0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,
+117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,15,};
+#endif
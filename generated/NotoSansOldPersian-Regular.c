@@ -0,0 +1,514 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansOldPersian_Regular_ttf_size = 12420;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansOldPersian_Regular_ttf");
+asm(".type fz_font_NotoSansOldPersian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansOldPersian_Regular_ttf, 12420");
+asm(".balign 64");
+asm("fz_font_NotoSansOldPersian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansOldPersian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansOldPersian_Regular_ttf_size = 12420;
+const char fz_font_NotoSansOldPersian_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,124,3,113,121,0,0,1,56,0,0,0,96,99,
+109,97,112,0,221,15,32,0,0,2,112,0,0,0,184,103,97,115,112,0,22,0,35,0,0,48,
+116,0,0,0,16,103,108,121,102,8,229,54,194,0,0,3,152,0,0,38,158,104,101,97,
+100,10,159,157,84,0,0,0,188,0,0,0,54,104,104,101,97,22,60,12,109,0,0,0,244,
+0,0,0,36,104,109,116,120,209,197,58,153,0,0,1,152,0,0,0,216,108,111,99,97,
+251,165,242,6,0,0,3,40,0,0,0,110,109,97,120,112,0,61,0,146,0,0,1,24,0,0,0,
+32,110,97,109,101,143,140,187,133,0,0,42,56,0,0,6,28,112,111,115,116,255,
+105,0,102,0,0,48,84,0,0,0,32,0,1,0,0,0,1,10,61,55,138,219,107,95,15,60,245,
+0,11,8,0,0,0,0,0,203,170,125,12,0,0,0,0,210,40,203,253,0,193,254,211,12,236,
+6,61,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,13,203,0,193,0,195,
+12,236,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,1,0,0,0,54,0,145,0,6,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,8,201,1,144,0,5,0,0,5,154,5,51,
+0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,1,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,
+141,2,88,0,0,0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,0,4,205,0,193,0,0,0,0,4,20,
+0,0,2,20,0,0,8,227,1,80,8,45,1,51,9,125,0,250,7,178,1,80,7,213,0,250,12,18,
+0,250,9,215,0,250,11,182,0,250,8,137,1,80,9,84,1,10,9,225,1,10,9,131,1,57,
+10,47,1,80,6,86,1,12,8,221,1,80,10,203,0,250,9,55,1,80,9,18,1,78,7,203,1,
+33,9,70,1,80,8,41,1,49,9,217,0,252,9,162,1,10,9,84,1,80,9,229,1,94,9,12,1,
+80,10,178,1,23,8,166,1,51,8,59,1,80,10,39,1,25,8,182,1,37,8,250,1,80,10,10,
+1,80,9,29,1,61,6,240,1,100,10,80,0,250,11,203,1,57,11,6,1,59,13,203,1,57,
+12,246,1,37,8,72,1,2,10,78,1,2,12,190,1,25,9,45,0,225,6,254,1,27,4,90,1,80,
+4,90,1,80,5,145,0,250,4,57,0,250,7,12,1,10,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,
+10,0,0,0,84,0,4,0,64,0,0,0,12,0,8,0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,
+255,0,0,0,0,0,13,0,32,0,160,254,255,255,255,0,1,255,245,255,227,255,99,1,
+2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,100,0,0,0,0,0,0,0,7,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,
+160,0,0,0,160,0,0,0,3,0,0,254,255,0,0,254,255,0,0,0,1,0,1,3,160,0,1,3,195,
+0,0,0,4,0,1,3,200,0,1,3,213,0,0,0,40,0,0,0,21,0,21,0,21,0,21,0,119,0,209,
+1,57,1,130,1,188,2,31,2,147,2,252,3,91,3,170,4,28,4,139,4,229,5,49,5,163,
+6,25,6,104,6,219,7,34,7,120,7,197,8,48,8,138,8,236,9,98,9,177,10,35,10,140,
+10,247,11,72,11,165,12,1,12,88,12,171,13,12,13,117,13,253,14,214,15,202,16,
+70,16,195,17,86,17,191,18,82,18,112,18,140,18,184,18,218,19,15,19,79,0,0,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,4,1,80,255,55,7,147,6,41,
+0,13,0,26,0,40,0,54,0,0,1,6,2,3,35,10,2,39,22,22,51,50,54,1,22,4,5,21,12,
+2,7,54,55,53,52,1,6,2,3,35,10,2,39,22,22,51,50,54,37,6,2,3,35,2,2,38,39,22,
+22,51,50,54,3,68,81,70,19,54,36,51,64,68,53,105,55,54,114,254,74,218,2,241,
+2,120,254,97,253,171,254,106,185,16,2,6,0,78,73,19,53,39,45,62,73,52,105,
+54,54,115,254,44,71,76,23,53,50,57,60,52,53,105,54,54,114,4,57,212,253,206,
+254,4,1,157,1,140,1,36,181,10,10,9,1,251,76,75,19,47,30,58,71,66,104,108,
+15,101,254,130,206,253,189,254,15,1,171,1,102,1,46,195,10,10,9,11,195,253,
+224,253,225,2,28,1,114,234,138,10,10,9,0,3,1,51,255,55,7,45,6,41,0,24,0,38,
+0,50,0,0,1,22,4,23,38,39,22,4,5,21,6,4,7,54,54,53,52,39,4,4,7,54,55,53,52,
+1,6,2,3,35,10,2,39,22,22,51,50,54,37,6,2,3,35,10,2,39,22,23,50,1,51,119,1,
+136,249,6,12,120,1,150,1,6,255,254,131,144,4,7,1,254,226,254,170,122,10,1,
+5,12,76,73,23,53,39,51,57,70,53,105,54,54,114,253,140,78,73,19,53,39,53,63,
+65,105,109,107,6,41,64,84,20,79,89,66,84,20,47,40,102,83,40,97,41,20,21,47,
+99,73,104,108,9,103,254,134,199,253,214,253,239,1,191,1,119,1,11,193,10,10,
+9,11,206,253,189,254,15,1,165,1,153,1,21,175,20,1,0,4,0,250,255,10,8,45,6,
+25,0,13,0,27,0,40,0,55,0,0,1,6,2,3,35,2,2,38,39,22,22,23,50,54,37,6,2,3,35,
+10,2,39,22,22,23,50,54,1,22,4,5,21,6,4,7,54,54,53,52,38,1,54,0,19,23,6,2,
+7,7,22,0,19,7,38,0,6,51,72,75,23,53,51,57,58,53,53,105,59,57,109,2,53,72,
+75,23,53,41,48,64,64,52,104,59,57,109,253,6,116,1,129,1,31,243,254,129,154,
+5,6,9,251,248,155,1,228,227,39,90,206,86,105,75,1,6,195,35,222,254,104,4,
+41,199,253,222,253,229,2,45,1,105,225,141,9,10,1,11,9,199,253,222,253,229,
+1,194,1,123,1,28,171,9,10,1,11,1,249,61,87,24,48,35,99,89,53,105,55,54,114,
+252,103,142,2,30,1,34,22,181,254,114,158,191,130,254,109,254,230,33,218,1,
+118,0,3,1,80,255,27,6,129,5,227,0,13,0,26,0,39,0,0,1,2,2,3,35,10,2,3,22,22,
+23,50,54,23,22,4,5,21,4,4,7,54,54,53,52,38,17,22,4,5,21,4,4,7,54,54,53,52,
+38,3,10,79,72,19,53,27,53,68,71,52,105,58,56,111,120,99,1,147,1,59,254,236,
+254,112,135,5,7,8,102,1,145,1,58,254,235,254,111,131,5,7,9,5,227,254,229,
+252,241,253,98,1,155,2,128,1,172,1,1,13,13,1,14,245,55,92,25,47,40,107,76,
+51,105,55,54,115,253,50,56,91,23,49,41,107,75,52,105,54,54,115,0,2,0,250,
+255,10,6,133,6,14,0,12,0,27,0,0,1,6,2,2,3,35,10,2,39,22,51,50,1,54,0,19,23,
+6,2,7,7,22,0,19,7,38,0,6,133,61,60,37,12,53,51,58,59,51,105,111,110,250,233,
+162,1,205,243,39,94,197,91,105,75,1,6,195,35,235,254,66,5,225,224,254,52,
+253,146,254,84,2,244,1,233,1,49,184,22,252,116,153,2,2,1,52,20,189,254,131,
+169,191,128,254,109,254,228,31,231,1,146,0,0,4,0,250,255,10,11,10,6,14,0,
+11,0,26,0,38,0,52,0,0,1,2,2,3,35,10,2,39,22,51,50,1,54,0,19,23,6,2,7,7,22,
+18,19,7,38,0,1,2,2,3,35,10,2,3,22,51,50,1,22,4,23,21,6,4,7,54,54,53,53,52,
+38,8,76,78,73,19,53,50,57,60,53,107,110,111,249,33,156,1,174,206,41,88,175,
+80,95,66,239,178,43,176,254,130,4,53,86,68,16,54,39,44,62,72,104,110,111,
+2,136,97,1,102,235,229,254,173,114,6,6,10,5,225,254,235,252,240,253,95,2,
+223,1,242,1,53,192,22,252,116,161,2,13,1,33,20,197,254,133,163,191,129,254,
+112,254,226,31,189,1,128,4,154,254,195,252,182,253,193,2,56,1,224,1,171,1,
+3,22,253,149,61,87,22,49,39,107,77,48,98,50,15,54,115,0,4,0,250,255,10,8,
+166,6,14,0,14,0,27,0,52,0,65,0,0,19,54,0,19,23,6,2,7,7,22,18,19,7,38,0,5,
+22,4,5,21,4,4,7,54,54,53,52,38,3,22,4,23,38,38,39,22,4,23,21,6,4,7,54,54,
+53,6,6,7,54,54,55,52,38,3,22,4,5,21,4,4,7,54,54,53,52,38,250,156,1,175,207,
+39,83,184,75,94,66,239,176,41,206,254,116,2,138,149,2,57,1,105,254,140,253,
+226,155,6,9,12,30,69,1,8,204,3,10,10,71,1,21,213,176,254,237,102,7,10,186,
+245,100,6,9,1,12,12,140,2,66,1,101,254,112,254,11,164,9,10,14,2,63,158,2,
+15,1,34,20,188,254,115,154,191,128,254,110,254,227,31,222,1,135,9,57,91,22,
+49,42,111,70,48,100,57,61,114,4,87,48,93,31,42,84,46,50,95,31,39,40,109,78,
+54,110,57,44,102,75,52,106,59,58,109,254,44,55,93,24,47,48,106,70,53,105,
+55,54,114,0,4,0,250,255,10,10,102,6,14,0,11,0,26,0,38,0,52,0,0,1,2,2,3,35,
+10,2,39,22,51,50,1,54,0,19,23,6,2,7,7,22,18,19,7,38,0,1,2,2,3,35,10,2,3,22,
+51,50,1,54,0,19,23,6,2,3,22,18,19,7,38,0,10,102,78,73,19,53,41,52,59,67,105,
+110,111,249,34,164,1,188,183,43,89,181,75,95,68,239,178,43,181,254,138,4,
+47,71,76,23,53,39,44,61,75,107,110,111,249,16,162,1,181,191,43,102,205,129,
+66,236,177,41,204,254,119,5,225,254,235,252,240,253,95,2,86,2,19,1,107,242,
+22,252,116,169,2,35,1,3,20,197,254,123,153,191,129,254,111,254,227,31,195,
+1,118,4,158,254,250,253,31,253,33,2,65,1,221,1,155,1,13,22,252,116,164,2,
+27,1,16,20,229,254,71,254,252,128,254,110,254,227,31,220,1,135,0,0,4,1,80,
+255,37,7,127,6,23,0,13,0,27,0,40,0,52,0,0,1,6,2,3,35,10,2,39,22,22,23,50,
+54,37,6,2,3,35,2,2,38,39,22,22,23,50,54,1,22,4,5,21,4,4,7,54,54,53,52,38,
+1,22,4,23,21,6,4,7,54,55,53,52,3,12,77,74,19,53,40,45,60,74,53,105,59,58,
+108,2,53,77,74,19,53,51,58,59,51,53,105,59,58,108,252,133,136,1,202,1,71,
+254,216,254,68,173,7,9,11,3,241,72,1,20,213,167,254,234,108,14,2,4,39,199,
+253,188,254,9,1,181,1,98,1,41,194,9,9,1,10,9,199,253,188,254,9,2,46,1,107,
+225,136,9,9,1,10,1,249,61,86,23,48,38,101,86,53,105,55,54,114,254,92,50,95,
+29,41,37,108,82,105,108,15,101,0,3,1,10,255,10,8,117,6,14,0,11,0,27,0,41,
+0,0,1,2,2,3,35,10,2,39,22,51,50,19,54,0,19,23,6,2,7,7,22,18,19,7,38,0,39,
+1,22,4,5,21,6,4,7,54,54,53,53,52,38,5,59,78,73,19,53,36,51,64,68,106,111,
+110,62,164,1,188,183,43,85,160,101,95,70,237,179,43,193,254,156,138,251,111,
+85,1,83,1,6,231,254,177,112,4,6,9,5,225,254,235,252,240,253,95,2,43,2,32,
+1,133,246,22,252,116,169,2,35,1,3,20,192,254,170,205,191,129,254,109,254,
+229,31,208,1,97,125,1,168,52,95,23,49,40,106,77,46,101,49,15,54,115,0,4,1,
+10,255,10,8,174,6,14,0,26,0,39,0,52,0,65,0,0,1,22,4,23,54,0,19,23,6,2,7,7,
+22,18,19,7,38,0,39,39,6,4,7,54,55,53,52,37,22,4,23,21,6,4,7,54,54,53,52,38,
+3,22,4,23,21,6,4,7,54,54,53,52,38,3,22,4,23,21,6,4,7,54,54,53,52,38,1,10,
+76,1,22,179,151,1,160,199,43,85,160,101,95,66,240,180,43,190,254,170,129,
+146,153,254,253,117,11,2,5,94,69,1,23,213,167,254,242,116,6,9,11,12,79,1,
+27,199,163,254,237,115,6,9,11,12,69,1,22,214,175,254,239,105,6,9,11,3,2,53,
+88,27,155,2,1,1,24,20,192,254,170,205,191,128,254,109,254,228,31,203,1,84,
+119,133,33,99,87,104,107,17,100,216,47,96,29,43,36,103,88,53,106,55,54,114,
+254,42,56,90,28,41,37,104,84,51,105,55,54,114,4,100,50,95,31,39,39,109,79,
+52,106,55,54,114,0,5,1,57,255,27,8,53,5,227,0,12,0,25,0,37,0,49,0,61,0,0,
+1,22,4,23,21,6,4,7,54,54,53,52,38,3,22,4,23,21,6,4,7,54,54,53,52,38,1,2,2,
+3,35,3,2,2,3,22,51,50,37,2,2,3,35,10,2,39,22,51,50,1,6,2,3,35,10,2,39,22,
+23,50,1,57,70,1,25,213,174,254,232,101,6,8,11,6,70,1,23,213,171,254,246,116,
+6,8,11,6,234,75,76,23,51,25,35,78,79,104,110,111,253,41,82,70,20,53,40,48,
+60,67,105,110,110,2,32,79,72,19,54,36,51,63,69,106,109,106,4,160,50,95,29,
+41,39,109,78,52,105,55,54,114,254,48,47,96,29,43,35,102,88,52,105,55,54,114,
+3,140,254,243,253,11,253,58,1,107,1,241,2,78,1,30,24,24,254,204,252,232,253,
+132,2,115,1,241,1,114,242,24,254,94,208,253,187,254,17,1,156,1,145,1,31,184,
+19,1,0,4,1,80,255,27,9,37,5,227,0,12,0,24,0,36,0,48,0,0,1,22,4,23,21,6,4,
+7,54,54,53,52,38,1,2,2,3,35,10,2,39,22,51,50,37,2,2,3,35,10,2,39,22,51,50,
+37,2,2,3,35,10,2,3,22,51,50,6,244,69,1,23,213,168,254,238,111,5,7,9,253,255,
+83,70,17,53,50,57,61,51,105,111,110,2,110,81,71,18,53,29,54,66,71,106,110,
+111,252,134,79,72,19,53,27,53,68,71,105,110,111,3,143,50,96,28,43,35,106,
+84,51,105,55,55,115,2,145,254,202,252,222,253,144,2,220,1,252,1,57,183,24,
+24,254,208,252,247,253,113,1,199,2,92,1,166,255,24,24,254,229,252,241,253,
+98,1,155,2,128,1,172,1,1,24,0,0,3,1,12,255,37,5,80,6,23,0,13,0,27,0,40,0,
+0,1,6,2,3,35,10,2,39,22,22,23,50,54,37,6,2,3,35,2,2,38,39,22,22,23,50,54,
+19,4,4,7,54,54,53,52,38,39,22,4,5,3,12,80,72,18,53,40,45,60,74,53,105,59,
+58,108,2,53,80,72,18,53,51,58,59,51,53,105,59,58,108,133,254,98,253,222,124,
+6,10,12,12,110,2,73,1,141,4,39,215,253,181,254,32,1,181,1,98,1,41,194,9,9,
+1,10,9,215,253,181,254,32,2,46,1,107,225,136,9,9,1,10,1,31,53,111,61,49,101,
+57,60,114,62,49,92,29,0,0,5,1,80,255,27,7,141,5,227,0,12,0,25,0,38,0,51,0,
+63,0,0,1,22,4,23,21,6,4,7,54,54,55,52,38,3,22,4,23,21,6,4,7,54,54,55,52,38,
+3,22,4,23,21,6,4,7,54,54,55,52,38,1,2,2,3,35,3,10,2,39,22,51,50,37,2,2,3,
+35,10,2,3,22,51,50,1,80,78,1,43,233,198,254,223,115,7,9,1,12,13,78,1,43,233,
+196,254,224,118,7,9,1,12,13,78,1,43,233,188,254,215,117,7,9,1,12,6,48,75,
+76,23,49,25,22,49,60,63,105,111,110,254,106,77,72,21,53,30,53,65,71,106,110,
+111,1,90,50,95,31,39,41,105,81,52,106,59,58,109,4,97,51,96,29,41,41,104,80,
+51,105,60,58,109,254,39,50,94,31,43,36,107,82,53,105,59,58,109,2,177,254,
+243,253,11,253,58,1,107,1,56,1,226,1,95,228,24,24,254,223,252,231,253,114,
+1,209,2,79,1,168,1,0,24,0,0,5,0,250,255,10,9,125,6,14,0,12,0,24,0,36,0,50,
+0,63,0,0,1,22,4,5,21,4,4,7,54,54,53,52,38,1,2,2,3,35,10,2,39,22,51,50,5,22,
+4,5,21,4,4,7,54,55,53,52,1,54,0,19,23,6,2,3,22,18,19,7,38,0,1,22,4,23,21,
+6,4,7,54,54,53,52,38,4,76,105,1,174,1,73,254,191,254,108,131,4,6,8,5,39,80,
+71,21,53,34,56,65,60,105,110,110,251,49,109,1,176,1,70,254,202,254,108,142,
+12,2,252,166,156,1,175,207,39,102,205,129,66,239,176,43,207,254,120,3,30,
+90,1,55,207,201,254,222,109,7,10,11,1,119,50,96,26,47,46,106,72,53,105,55,
+54,114,4,168,254,218,252,246,253,106,2,24,2,96,1,118,216,22,172,49,96,25,
+47,46,104,76,105,108,11,103,253,148,158,2,15,1,34,20,229,254,71,254,252,128,
+254,110,254,227,31,225,1,131,1,220,57,88,27,41,42,108,76,52,106,54,54,113,
+0,0,3,1,80,255,10,7,231,6,14,0,11,0,27,0,40,0,0,1,2,2,3,35,10,2,39,22,51,
+50,1,54,0,19,23,6,2,7,7,22,18,19,7,38,0,39,3,6,2,2,3,35,10,2,39,22,51,50,
+7,231,71,76,23,53,36,51,64,68,106,111,110,251,91,160,1,185,189,43,81,174,
+90,95,66,240,179,43,194,254,160,140,90,57,57,41,17,53,46,62,50,59,104,110,
+111,5,225,254,250,253,31,253,33,2,43,2,32,1,133,246,22,252,116,165,2,29,1,
+13,20,183,254,138,182,191,128,254,110,254,227,31,209,1,92,129,4,41,210,254,
+96,253,189,253,239,2,208,2,9,1,16,221,22,0,5,1,78,255,18,7,223,6,25,0,11,
+0,24,0,36,0,49,0,64,0,0,1,6,2,7,35,38,2,39,22,23,51,50,37,6,2,7,35,38,2,39,
+22,22,51,50,54,1,4,4,5,21,12,2,7,54,53,52,3,22,4,4,5,21,12,2,7,54,53,52,1,
+22,4,5,21,4,4,6,6,7,54,54,55,52,38,6,160,50,93,31,43,37,102,87,106,107,17,
+100,254,103,48,96,31,41,36,107,84,53,106,55,54,114,252,245,1,62,2,235,2,104,
+253,235,253,248,254,139,255,27,27,227,1,166,2,74,1,190,253,151,254,44,254,
+163,247,26,1,160,222,2,40,1,197,254,212,254,124,218,163,158,9,10,1,11,1,72,
+68,254,233,214,171,1,15,113,13,2,17,73,254,236,213,167,1,19,111,6,8,11,4,
+225,85,65,20,54,35,50,61,71,106,110,110,253,43,61,58,39,14,53,40,50,59,68,
+106,110,111,2,31,86,67,17,53,26,47,42,45,59,53,105,59,57,109,0,0,3,1,33,255,
+27,6,123,5,227,0,10,0,23,0,37,0,0,1,2,2,3,35,2,2,3,22,51,50,1,22,4,5,21,4,
+4,7,7,54,55,53,52,3,22,4,5,21,4,4,6,7,54,54,53,52,38,6,123,83,70,17,53,52,
+78,89,105,111,110,251,26,196,1,187,1,41,254,223,254,119,149,95,15,2,11,195,
+1,200,1,29,254,236,254,225,208,153,5,8,13,5,227,254,202,252,222,253,144,2,
+253,2,138,1,65,24,254,153,74,78,20,45,35,86,62,40,104,107,14,101,254,104,
+75,78,17,49,34,57,61,71,48,100,57,61,114,0,3,1,80,255,10,8,102,6,14,0,14,
+0,27,0,42,0,0,1,54,0,19,23,6,2,7,22,18,19,7,38,0,39,1,6,2,2,3,35,10,2,3,22,
+51,50,19,54,0,19,23,6,2,7,7,22,18,19,7,38,0,4,252,149,1,185,200,41,106,212,
+120,66,239,176,39,194,254,160,140,253,119,55,59,39,17,53,30,55,63,69,104,
+110,110,77,164,1,186,183,45,85,160,101,95,70,237,177,41,193,254,123,2,63,
+154,2,28,1,25,20,236,254,61,243,128,254,110,254,227,31,209,1,92,129,4,41,
+204,254,78,253,196,253,244,1,215,2,97,1,139,1,3,23,252,117,169,2,33,1,5,20,
+192,254,170,205,191,128,254,108,254,229,31,208,1,129,0,0,3,1,49,255,10,7,
+74,6,14,0,13,0,26,0,39,0,0,1,54,0,19,23,6,2,3,22,18,19,7,38,0,1,22,4,5,21,
+4,4,7,54,54,53,52,38,19,22,4,5,21,4,4,7,54,54,53,52,38,3,223,166,1,166,201,
+45,102,207,130,66,236,178,37,214,254,101,252,125,185,1,237,1,59,254,249,254,
+31,235,6,10,15,4,148,1,240,1,93,254,173,254,48,180,6,7,11,2,63,171,2,6,1,
+30,20,225,254,70,254,249,128,254,109,254,228,31,227,1,149,3,101,69,82,19,
+49,30,93,100,48,101,57,60,114,252,163,59,88,23,49,40,99,85,53,105,55,54,114,
+0,4,0,252,255,10,8,180,6,14,0,14,0,29,0,43,0,57,0,0,1,54,0,19,23,6,2,7,7,
+22,18,19,7,38,0,37,54,0,19,23,6,2,7,7,22,18,19,7,38,0,1,22,4,5,21,6,4,7,54,
+54,53,53,52,38,3,22,4,5,21,6,4,7,54,54,53,53,52,38,3,20,160,1,192,183,43,
+76,182,86,94,67,240,176,43,198,254,110,252,252,163,1,180,191,41,83,184,75,
+94,66,237,176,39,176,254,130,3,245,85,1,82,1,7,232,254,183,117,4,6,9,9,85,
+1,83,1,6,230,254,176,112,4,6,9,2,63,165,2,38,1,4,20,171,254,119,175,191,129,
+254,110,254,228,31,214,1,142,209,168,2,26,1,13,20,188,254,115,154,191,128,
+254,110,254,227,31,189,1,128,3,52,53,94,25,47,41,104,78,45,101,49,16,54,115,
+254,35,52,92,26,49,39,104,80,47,101,49,15,54,114,0,4,1,10,255,27,8,82,5,227,
+0,11,0,23,0,35,0,48,0,0,1,22,4,23,21,6,4,7,54,55,53,52,1,2,2,3,35,10,2,39,
+22,51,50,37,2,2,3,35,10,2,39,22,51,50,1,6,2,2,3,35,10,2,39,22,23,50,1,10,
+66,1,101,222,221,254,175,79,13,2,7,49,75,72,23,53,50,57,61,51,106,110,111,
+253,41,80,70,20,53,50,57,61,51,106,111,110,2,31,57,57,39,17,53,40,52,58,67,
+103,109,107,3,63,46,97,31,43,46,119,60,106,107,16,100,3,21,254,242,253,24,
+253,46,2,220,1,252,1,57,183,24,24,254,214,252,228,253,126,2,220,1,252,1,57,
+183,24,254,94,156,254,193,254,96,254,119,1,186,1,133,1,11,186,19,1,0,4,1,
+80,255,10,8,61,6,14,0,11,0,27,0,38,0,52,0,0,1,2,2,3,35,10,2,3,22,51,50,19,
+54,0,19,23,6,2,7,7,22,18,19,7,38,0,39,37,22,4,5,21,6,4,7,54,53,52,3,22,4,
+5,21,4,4,7,54,54,53,53,52,38,3,10,78,73,19,53,39,44,61,75,105,110,111,63,
+164,1,188,183,43,72,185,89,95,67,239,180,43,193,254,156,138,2,33,85,1,84,
+1,9,254,254,193,106,9,20,85,1,83,1,10,254,246,254,202,103,3,6,10,5,225,254,
+235,252,240,253,95,2,65,1,221,1,155,1,13,22,252,116,169,2,35,1,3,20,163,254,
+117,181,191,128,254,109,254,228,31,208,1,97,125,170,52,92,26,47,45,105,73,
+104,107,106,2,103,55,91,26,47,49,104,71,43,98,44,28,54,114,0,0,4,1,94,255,
+10,8,205,6,14,0,27,0,41,0,54,0,67,0,0,1,22,22,23,54,0,19,23,6,2,7,7,22,18,
+19,7,38,0,39,39,6,6,7,54,54,53,52,38,3,22,4,5,21,4,4,7,54,54,53,53,52,38,
+3,22,4,5,21,4,4,7,54,54,53,52,38,1,22,4,23,21,6,4,7,54,54,53,52,38,2,74,66,
+250,188,142,1,160,203,43,81,174,90,95,67,239,179,43,199,254,192,146,148,154,
+244,87,4,8,12,236,136,2,25,1,75,254,134,254,31,130,4,6,13,24,132,2,9,1,93,
+254,176,254,10,156,8,10,12,5,48,69,1,23,213,180,254,244,105,7,8,10,3,8,46,
+93,31,148,1,255,1,29,20,183,254,138,182,191,128,254,110,254,227,31,213,1,
+61,135,134,38,105,76,48,102,57,61,113,254,100,56,94,22,47,50,109,64,45,101,
+49,16,54,115,3,230,56,91,25,45,45,108,72,52,105,55,54,114,254,156,47,96,29,
+43,39,106,82,53,106,55,54,113,0,3,1,80,255,10,8,6,6,14,0,11,0,27,0,40,0,0,
+1,2,2,3,35,10,2,3,22,51,50,19,54,0,19,23,6,2,7,7,22,18,19,7,38,0,39,1,22,
+4,5,21,6,4,7,54,54,53,52,38,3,10,80,72,18,53,39,44,61,75,105,111,110,63,160,
+1,192,183,43,72,185,89,95,69,238,179,43,193,254,156,138,1,234,85,1,84,1,9,
+233,254,175,110,4,5,9,5,225,254,215,252,232,253,123,2,65,1,221,1,155,1,13,
+22,252,116,165,2,38,1,4,20,163,254,117,181,191,128,254,109,254,228,31,208,
+1,97,125,1,168,52,95,23,49,40,107,76,52,105,54,54,115,0,0,5,1,23,255,27,9,
+156,5,227,0,12,0,25,0,38,0,51,0,64,0,0,1,22,4,5,21,4,4,7,54,54,53,52,38,1,
+22,4,5,21,4,4,7,54,54,53,52,38,3,6,2,2,3,35,10,2,39,22,51,50,23,22,4,5,21,
+4,4,7,54,54,53,52,38,1,22,4,23,21,6,4,7,54,54,53,52,38,6,20,132,1,199,1,61,
+254,189,254,86,146,6,9,12,254,234,135,2,1,1,73,254,126,254,67,136,5,9,12,
+83,62,59,37,12,54,35,52,64,68,105,111,111,175,135,1,255,1,69,254,173,254,
+42,154,7,9,11,252,12,72,1,18,215,217,255,0,80,6,9,10,3,84,59,89,22,49,45,
+105,73,48,100,57,60,115,254,97,55,92,23,47,51,106,69,48,103,56,61,113,4,170,
+232,254,52,253,150,254,86,2,35,2,35,1,141,245,24,170,58,91,21,49,43,107,74,
+52,105,55,54,115,254,84,49,88,37,43,56,106,63,53,105,55,54,113,0,3,1,51,254,
+231,7,133,6,10,0,35,0,48,0,61,0,0,1,22,4,23,38,38,39,22,22,51,50,54,55,6,
+6,7,22,4,23,21,5,6,7,6,6,7,35,38,38,39,6,4,7,54,53,52,1,6,2,3,35,2,2,39,22,
+22,51,50,54,37,6,2,3,35,2,2,39,22,22,51,50,54,1,51,170,1,113,209,31,75,48,
+53,105,54,54,113,61,34,65,28,150,1,88,217,254,104,179,142,8,12,5,47,9,18,
+10,255,254,185,198,26,2,183,58,89,23,49,49,106,68,48,100,57,61,114,2,236,
+59,91,20,47,43,109,71,51,105,54,54,114,4,152,50,57,16,151,239,95,7,9,11,13,
+78,250,178,11,15,8,54,30,14,13,59,125,68,68,118,54,27,61,58,103,111,110,254,
+147,144,254,4,254,187,1,129,1,192,134,5,8,12,26,147,253,252,254,202,1,84,
+1,217,151,7,10,11,0,0,4,1,80,255,27,6,236,5,227,0,17,0,31,0,47,0,63,0,0,1,
+14,2,10,2,7,35,10,2,46,2,39,22,50,3,6,4,6,6,7,54,54,52,38,39,22,4,5,3,6,4,
+6,6,7,54,54,52,38,39,30,2,4,23,19,14,3,7,54,54,52,38,39,30,3,23,6,236,24,
+40,33,27,22,17,7,54,18,30,30,31,37,45,28,104,222,244,196,254,212,231,172,
+66,7,10,11,14,121,1,232,1,108,102,196,254,211,231,171,66,7,9,10,14,61,182,
+244,1,48,182,61,153,246,191,141,49,7,9,11,13,45,150,201,248,144,5,227,86,
+183,218,254,250,254,183,254,106,252,1,10,1,151,1,63,246,208,189,101,24,250,
+184,26,54,55,59,31,52,105,109,114,62,52,93,25,3,193,25,53,56,59,31,52,105,
+109,115,62,26,51,45,36,12,253,225,25,52,56,59,31,52,104,108,114,62,25,50,
+45,38,12,0,2,1,25,255,10,9,72,6,14,0,27,0,41,0,0,1,22,4,23,54,0,19,23,6,2,
+7,7,22,18,19,7,38,0,39,39,6,4,7,54,54,53,52,38,5,54,0,19,23,6,2,7,22,18,19,
+7,38,0,1,25,101,1,112,237,153,1,158,199,43,81,174,90,95,68,239,178,43,190,
+254,170,130,147,214,254,181,153,9,12,14,4,177,169,1,180,186,43,95,229,115,
+66,239,177,39,201,254,127,3,2,55,89,26,162,1,254,1,22,20,183,254,138,182,
+191,129,254,111,254,227,31,203,1,84,120,134,37,98,86,52,105,55,54,113,134,
+174,2,24,1,9,20,210,254,24,232,128,254,110,254,227,31,214,1,125,0,0,4,1,37,
+255,27,7,102,5,227,0,11,0,24,0,37,0,50,0,0,1,2,2,3,35,10,2,39,22,51,50,1,
+4,4,7,54,54,53,52,38,39,22,4,5,1,22,4,5,21,4,4,7,54,54,53,52,38,3,22,4,5,
+21,4,4,7,54,54,53,52,38,7,102,83,70,17,53,35,52,64,68,105,111,110,254,0,254,
+145,254,72,158,8,10,12,14,120,1,230,1,111,253,73,138,1,218,1,36,254,186,254,
+95,152,7,9,12,13,123,1,206,1,63,254,168,254,101,140,7,9,12,5,227,254,202,
+252,222,253,144,2,35,2,35,1,141,245,24,252,166,48,103,73,52,105,54,54,114,
+62,50,95,25,2,133,59,91,20,47,46,101,76,53,104,54,54,113,252,150,55,91,24,
+49,47,104,72,53,105,54,54,114,0,4,1,80,255,27,7,227,5,227,0,12,0,25,0,37,
+0,50,0,0,1,22,4,5,21,4,4,7,54,54,53,52,38,1,22,4,5,21,4,4,7,54,54,53,52,38,
+3,2,2,3,35,10,2,3,22,51,50,23,22,4,5,21,4,4,7,54,54,53,52,38,4,92,134,1,198,
+1,59,254,195,254,82,148,7,9,11,254,233,138,2,3,1,68,254,126,254,67,136,5,
+9,12,84,79,72,19,53,27,53,68,71,105,111,110,176,131,2,0,1,71,254,176,254,
+41,157,7,11,11,3,84,60,88,22,49,45,104,74,52,105,54,54,115,254,97,56,91,23,
+47,51,106,69,48,103,56,61,113,4,170,254,229,252,241,253,98,1,155,2,128,1,
+172,1,1,24,170,57,91,22,49,43,107,74,52,105,55,54,115,0,3,1,80,255,27,8,186,
+5,227,0,11,0,23,0,48,0,0,1,2,2,3,35,10,2,39,22,51,50,37,2,2,3,35,10,2,3,22,
+51,50,19,22,4,23,38,38,39,22,4,23,21,6,4,7,54,54,53,6,4,7,54,54,53,52,38,
+8,186,79,72,19,53,35,52,64,68,106,111,110,250,195,79,72,19,53,27,53,68,71,
+105,110,111,108,67,1,13,205,2,10,11,70,1,25,212,166,254,236,113,7,8,178,255,
+0,99,6,9,11,5,227,254,229,252,241,253,98,2,35,2,35,1,141,245,24,24,254,229,
+252,241,253,98,1,155,2,128,1,172,1,1,24,253,166,48,93,29,45,91,50,47,96,29,
+41,37,106,82,49,101,53,42,105,77,53,106,55,55,113,0,3,1,61,254,250,8,6,5,
+242,0,16,0,28,0,43,0,0,1,54,0,55,23,6,2,7,7,22,18,23,7,46,3,1,4,4,5,21,12,
+2,7,54,53,52,3,54,0,55,23,6,6,7,7,22,18,23,7,0,0,3,211,213,1,176,172,37,75,
+175,97,95,65,242,180,37,110,194,244,206,252,254,1,55,3,65,2,81,253,180,254,
+18,254,102,245,25,10,193,1,182,180,41,81,158,109,95,67,240,177,33,254,171,
+254,62,1,106,160,1,132,186,31,125,254,239,145,141,96,254,213,209,39,90,150,
+178,134,4,208,84,70,16,54,40,46,63,68,104,110,111,251,236,145,1,137,196,31,
+134,247,162,141,97,254,214,209,39,1,21,1,48,0,4,1,100,255,37,5,156,6,61,0,
+12,0,26,0,40,0,53,0,0,1,22,4,5,21,4,4,7,54,54,53,52,38,1,6,2,3,35,2,2,39,
+22,22,23,51,50,54,37,6,2,3,35,2,2,39,22,22,23,51,50,54,1,22,4,5,21,4,4,7,
+54,54,53,52,38,1,100,136,2,56,1,120,254,87,254,17,145,6,9,15,1,250,79,74,
+17,54,53,84,82,52,105,55,27,49,101,2,47,75,76,19,53,48,85,86,52,105,55,27,
+49,100,252,52,156,2,58,1,98,254,110,254,3,154,6,9,15,4,82,53,92,25,49,50,
+107,66,49,100,57,60,114,254,107,152,254,99,254,219,1,109,1,80,157,5,7,1,6,
+7,145,254,107,254,204,1,71,1,110,165,5,7,1,6,3,197,56,91,23,47,47,108,68,
+49,100,57,60,113,0,0,4,0,250,255,10,9,113,6,14,0,12,0,26,0,42,0,55,0,0,1,
+22,4,23,21,6,4,7,54,54,53,52,38,1,54,0,19,23,6,2,3,22,18,19,7,38,0,37,54,
+0,19,23,6,2,7,7,22,18,19,7,38,0,39,37,22,4,23,21,6,4,7,54,54,53,52,38,4,33,
+83,1,40,182,176,254,245,110,5,7,9,252,206,156,1,174,206,41,102,205,129,65,
+238,178,43,204,254,119,4,32,154,1,184,193,43,86,170,87,94,66,237,177,37,197,
+254,163,141,253,132,72,1,20,213,179,254,245,107,5,7,9,4,98,55,93,26,39,39,
+105,83,52,106,55,54,113,254,25,161,2,13,1,33,20,229,254,71,254,252,129,254,
+112,254,226,31,220,1,135,210,159,2,29,1,19,20,193,254,144,178,191,128,254,
+109,254,228,31,211,1,89,130,52,48,96,31,41,38,105,84,53,106,55,54,114,0,0,
+4,1,57,255,10,10,236,6,14,0,14,0,26,0,51,0,76,0,0,1,54,0,19,23,6,2,7,7,22,
+18,19,7,38,0,3,2,2,3,35,10,2,3,22,51,50,1,22,4,23,38,38,39,22,4,5,21,4,4,
+7,55,54,53,6,4,7,54,54,53,52,38,3,22,4,23,38,38,39,22,4,5,21,4,4,7,55,54,
+53,6,4,7,54,54,53,52,38,7,125,149,1,185,200,43,81,174,90,95,67,241,178,43,
+181,254,138,228,71,76,23,53,39,44,61,75,106,110,111,249,250,81,1,25,179,2,
+6,8,88,1,116,1,0,254,253,254,161,98,6,2,173,254,247,94,6,8,11,12,76,1,22,
+187,2,6,8,88,1,116,1,0,254,219,254,188,91,6,2,175,254,247,92,6,8,11,2,63,
+154,2,28,1,25,20,183,254,138,182,191,128,254,110,254,227,31,195,1,118,4,158,
+254,250,253,31,253,33,2,65,1,221,1,155,1,13,22,254,239,56,94,26,44,93,50,
+55,90,25,50,44,110,69,102,51,54,39,105,73,53,106,55,54,114,253,103,52,95,
+29,44,93,50,55,90,25,47,54,108,62,102,50,53,38,105,74,53,106,55,54,114,0,
+5,1,59,254,221,9,182,5,252,0,34,0,70,0,81,0,105,0,130,0,0,1,22,4,23,38,39,
+22,4,23,21,6,4,7,54,54,53,6,4,7,54,54,53,6,4,7,54,55,53,52,39,22,4,23,38,
+38,3,22,4,23,38,39,22,4,5,21,4,4,7,54,54,53,6,4,7,54,54,53,6,4,7,54,54,53,
+52,38,39,22,4,23,38,38,1,2,2,3,35,2,2,3,22,51,50,1,22,4,23,38,38,39,22,4,
+5,21,4,4,7,54,54,53,6,4,7,54,55,53,52,3,22,4,23,38,38,39,22,4,5,21,4,4,7,
+54,54,53,6,4,7,54,54,53,52,38,3,63,94,1,30,163,3,15,87,1,120,254,248,254,
+155,104,5,5,177,254,253,98,5,7,185,254,252,85,12,2,21,77,1,23,179,2,9,8,87,
+1,27,173,3,15,85,1,109,1,11,254,253,254,167,105,5,5,176,254,246,92,5,7,181,
+254,249,86,6,8,9,12,77,1,17,187,2,11,6,111,77,72,21,53,55,76,84,103,111,110,
+249,251,102,1,26,159,2,8,8,85,1,109,1,11,254,236,254,175,96,5,5,169,254,249,
+102,11,2,22,80,1,24,183,2,8,8,85,1,109,1,11,254,238,254,176,99,5,5,166,254,
+249,105,5,7,9,4,33,60,86,24,85,95,53,88,21,47,42,107,68,48,98,53,40,98,71,
+51,102,54,40,102,65,100,104,16,97,109,54,87,27,40,83,254,96,56,89,25,85,95,
+50,88,26,45,44,104,69,50,98,51,38,99,72,53,101,53,38,100,69,51,102,53,52,
+109,59,52,88,28,40,83,3,188,254,223,252,231,253,114,3,51,2,101,1,48,24,250,
+192,65,87,20,44,89,50,52,90,24,47,47,105,64,50,96,51,35,97,77,103,105,12,
+99,5,216,58,89,27,43,89,50,55,86,25,45,47,103,69,51,99,51,36,97,76,50,102,
+53,53,112,0,6,1,57,254,221,12,236,6,16,0,14,0,50,0,86,0,97,0,121,0,144,0,
+0,1,54,0,19,23,6,2,7,22,18,19,7,38,0,39,1,22,4,23,38,39,22,4,5,21,4,4,7,54,
+54,53,6,4,7,54,54,53,6,6,7,54,54,53,52,38,39,22,4,23,38,38,3,22,4,23,38,39,
+22,4,5,21,6,4,7,54,54,53,6,4,7,54,54,53,6,4,7,54,54,53,52,38,39,22,4,23,38,
+38,1,2,2,3,35,2,2,3,22,51,50,1,22,4,23,38,38,39,22,4,5,21,4,4,7,54,54,53,
+6,4,7,54,55,53,52,3,22,4,23,38,39,22,4,5,21,4,4,7,54,54,53,6,4,7,54,55,53,
+52,9,125,143,1,199,195,38,107,212,119,67,241,178,43,204,254,177,147,249,44,
+70,1,12,205,3,15,85,1,109,1,9,254,239,254,174,96,5,5,174,254,254,104,6,8,
+196,255,79,6,8,11,12,67,1,14,202,2,11,8,70,1,12,205,3,15,85,1,110,1,8,247,
+254,152,100,5,5,178,254,254,100,6,8,172,254,241,87,6,8,11,12,83,1,15,183,
+2,9,6,111,77,72,21,53,55,76,84,103,111,110,249,251,98,1,26,163,2,8,8,85,1,
+109,1,9,254,224,254,186,93,5,5,167,254,250,107,12,2,21,78,1,15,194,3,15,85,
+1,109,1,9,254,223,254,184,90,5,5,164,254,249,109,12,2,2,66,143,2,45,1,18,
+22,242,254,61,235,130,254,110,254,229,33,220,1,78,134,2,103,47,94,31,88,94,
+52,88,22,49,47,104,64,48,98,53,41,95,73,51,102,54,44,102,61,50,101,53,52,
+111,59,45,94,31,40,85,254,96,46,93,31,85,95,52,86,26,45,42,108,67,50,98,51,
+38,98,73,51,103,53,36,102,69,51,101,53,52,110,59,53,88,27,40,83,3,188,254,
+223,252,231,253,114,3,51,2,101,1,48,24,250,190,62,87,21,44,89,50,52,90,24,
+47,51,103,64,50,98,51,35,96,78,102,105,16,97,5,213,56,88,28,84,96,53,88,23,
+45,51,104,64,51,99,51,36,96,77,100,104,17,97,0,5,1,37,255,10,12,23,6,14,0,
+11,0,27,0,38,0,49,0,65,0,0,1,2,2,3,35,10,2,39,22,51,50,1,54,0,19,23,6,2,7,
+7,22,18,19,7,38,0,39,37,22,4,5,21,6,4,7,54,55,52,3,22,4,5,21,6,4,7,54,55,
+52,1,54,0,19,23,6,2,7,7,22,18,19,7,38,0,39,8,223,80,72,18,53,41,52,59,67,
+105,111,110,251,55,152,1,180,202,39,83,184,75,94,66,239,178,41,194,254,160,
+140,252,238,85,1,84,1,9,250,254,186,106,10,1,19,85,1,83,1,10,253,254,185,
+102,10,1,7,114,154,1,187,194,43,80,195,71,95,66,240,178,41,197,254,163,141,
+5,225,254,215,252,232,253,123,2,86,2,19,1,107,242,22,252,116,157,2,23,1,27,
+20,188,254,115,154,191,129,254,112,254,226,31,209,1,92,129,144,54,92,24,47,
+46,107,71,103,110,108,2,99,56,91,25,47,47,108,68,103,110,107,254,134,159,
+2,33,1,15,20,177,254,94,144,191,128,254,110,254,227,31,211,1,89,130,0,5,1,
+2,254,211,6,248,6,43,0,13,0,25,0,39,0,53,0,67,0,0,1,54,0,55,23,6,6,7,22,22,
+23,7,38,36,1,2,2,3,35,10,2,39,22,51,50,1,54,0,55,23,6,6,7,22,22,23,7,38,36,
+1,54,0,55,23,6,6,7,22,22,23,7,38,36,37,54,0,55,23,6,6,7,22,22,23,7,38,36,
+2,215,100,1,51,115,45,58,119,54,61,143,54,43,116,254,197,3,169,79,72,19,53,
+29,54,66,71,106,110,111,250,126,110,1,42,114,45,60,117,54,62,141,53,43,120,
+254,193,1,103,107,1,52,107,45,58,119,54,62,148,48,43,128,254,204,253,184,
+121,1,40,105,45,60,117,54,62,146,48,43,132,254,199,4,74,74,1,24,127,27,128,
+230,90,82,231,97,30,110,251,1,226,254,229,252,241,253,98,1,199,2,92,1,166,
+255,24,254,127,83,1,17,125,27,128,230,90,82,230,98,30,114,252,252,127,81,
+1,26,116,24,128,231,88,85,238,86,33,122,242,70,93,1,17,113,24,128,231,88,
+86,234,89,33,126,244,0,0,6,1,2,254,211,8,254,6,43,0,13,0,24,0,38,0,52,0,66,
+0,79,0,0,1,54,0,55,23,6,6,7,22,22,23,7,38,36,1,2,2,3,35,2,2,3,22,51,50,1,
+54,0,55,23,6,6,7,22,22,23,7,38,36,1,54,0,55,23,6,6,7,22,22,23,7,38,36,37,
+54,0,55,23,6,6,7,22,22,23,7,38,36,1,6,2,2,3,35,10,2,3,22,51,50,2,215,96,1,
+39,129,45,57,120,54,51,137,70,41,119,254,200,3,169,81,73,18,53,47,81,90,104,
+111,111,250,127,110,1,42,114,45,60,117,54,51,139,64,41,120,254,193,1,103,
+104,1,40,120,45,57,120,54,52,147,59,41,131,254,206,253,185,121,1,40,105,45,
+60,117,54,52,146,56,41,132,254,199,7,148,61,56,38,15,53,40,46,61,72,106,110,
+111,4,74,71,1,13,141,27,128,230,90,66,218,126,30,113,246,1,228,254,224,252,
+216,253,128,2,230,2,157,1,69,24,254,127,83,1,17,125,27,128,230,90,68,223,
+119,30,114,252,252,127,79,1,14,130,24,128,231,88,69,234,106,33,125,238,71,
+93,1,17,113,24,128,231,88,71,233,105,33,126,244,5,158,238,254,62,253,179,
+254,53,2,77,1,235,1,142,1,2,24,0,0,3,1,25,255,10,11,221,6,14,0,15,0,31,0,
+55,0,0,1,54,0,19,23,6,2,7,7,22,18,19,7,38,0,39,37,54,0,19,23,6,2,7,7,22,18,
+19,7,38,0,39,1,22,4,23,38,39,22,4,5,21,4,4,7,55,54,53,6,4,7,54,54,53,52,38,
+6,88,158,1,179,196,45,72,185,89,95,69,236,179,41,193,254,156,138,1,134,152,
+1,180,202,43,76,192,78,94,66,239,176,39,194,254,160,140,248,17,85,1,33,168,
+3,15,86,1,109,1,8,254,231,254,179,91,6,2,168,254,251,107,6,9,9,2,63,163,2,
+21,1,23,20,163,254,117,181,191,129,254,109,254,229,31,208,1,97,125,135,157,
+2,23,1,27,20,168,254,100,159,191,128,254,110,254,227,31,209,1,92,129,1,88,
+65,103,24,97,108,60,101,28,51,52,114,69,108,54,57,41,109,84,57,114,59,58,
+123,0,0,4,0,225,254,254,8,57,6,4,0,35,0,51,0,68,0,82,0,0,1,22,4,23,38,38,
+39,22,4,23,21,4,4,7,55,54,53,6,6,7,54,54,53,6,4,7,54,55,53,52,39,22,4,23,
+38,38,1,54,0,55,23,6,2,7,22,23,19,22,23,7,38,0,37,54,0,55,23,6,2,7,22,23,
+23,22,23,23,7,38,0,37,54,0,55,23,6,2,7,22,23,1,7,38,0,3,94,85,1,20,182,2,
+6,8,94,1,115,251,254,239,254,170,93,6,2,180,255,98,7,8,167,254,250,106,16,
+2,24,76,1,25,182,3,11,253,122,137,1,98,140,49,95,159,71,29,38,179,51,57,43,
+202,254,189,4,5,127,1,105,142,48,94,161,69,28,38,82,45,52,109,43,174,254,
+171,253,40,137,1,98,140,47,96,158,70,28,37,1,30,43,165,254,167,5,250,56,87,
+27,42,90,48,55,86,23,49,47,104,64,99,49,53,41,99,71,51,104,54,36,99,74,100,
+105,11,100,112,51,92,27,42,83,251,135,124,1,114,174,27,193,254,193,129,43,
+60,254,223,83,90,33,193,1,36,113,114,1,121,177,27,196,254,192,125,43,60,133,
+73,83,173,33,165,1,55,122,124,1,114,174,27,195,254,191,125,43,60,254,50,33,
+159,1,59,0,1,1,27,255,164,5,193,5,199,0,10,0,0,1,18,0,1,7,8,2,39,54,54,2,
+137,102,1,129,1,81,43,254,155,254,241,254,208,215,102,183,5,199,254,213,253,
+66,253,229,31,1,209,1,81,1,85,182,37,124,0,0,1,1,80,255,27,3,10,5,227,0,11,
+0,0,1,2,2,3,35,10,2,3,22,51,50,3,10,79,72,19,53,27,53,68,71,105,110,111,5,
+227,254,229,252,241,253,98,1,155,2,128,1,172,1,1,24,0,0,1,1,80,255,27,3,12,
+5,252,0,22,0,0,1,6,2,7,54,54,55,6,2,3,35,2,2,39,22,22,51,38,2,39,22,51,50,
+3,12,73,97,22,45,94,51,74,86,18,53,39,87,85,51,99,53,38,99,64,103,110,114,
+5,252,174,254,121,203,2,9,9,179,254,24,254,166,1,125,1,171,205,11,9,232,1,
+131,141,16,0,0,1,0,250,255,10,4,178,6,14,0,13,0,0,19,54,0,19,23,6,2,3,22,
+0,19,7,38,0,250,170,1,216,224,39,125,214,146,74,1,6,196,35,254,254,77,2,63,
+158,2,19,1,30,20,253,254,101,254,246,128,254,109,254,228,31,248,1,134,0,0,
+2,0,250,254,211,3,49,6,45,0,13,0,28,0,0,55,54,0,55,23,6,6,7,22,22,23,7,38,
+38,3,55,54,54,55,23,6,6,7,22,22,23,7,38,38,250,106,1,22,111,46,80,117,53,
+58,132,86,43,183,239,102,94,105,210,86,46,80,117,53,62,129,85,43,192,226,
+133,89,1,7,127,28,143,220,88,91,195,111,37,163,197,4,17,83,92,206,100,33,
+140,220,88,98,190,110,36,170,184,0,3,1,10,255,27,6,2,5,252,0,12,0,23,0,34,
+0,0,1,6,2,3,35,3,2,2,39,22,23,51,50,5,38,36,39,53,54,36,55,6,21,20,1,22,4,
+23,21,6,4,7,54,53,52,4,94,64,79,27,53,33,41,78,65,106,106,10,101,2,25,98,
+254,202,182,203,1,37,86,13,251,29,100,1,53,181,212,254,227,85,13,4,96,172,
+253,144,253,215,1,67,1,144,1,190,180,18,1,11,59,103,24,43,44,110,59,102,107,
+110,1,40,60,101,25,43,48,105,60,102,107,110,0,0,0,0,0,15,0,186,0,3,0,1,4,
+9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,42,0,94,0,3,0,1,4,9,0,2,0,14,0,136,0,3,0,
+1,4,9,0,3,0,80,0,150,0,3,0,1,4,9,0,4,0,42,0,94,0,3,0,1,4,9,0,5,0,30,0,230,
+0,3,0,1,4,9,0,6,0,36,1,4,0,3,0,1,4,9,0,7,0,68,1,40,0,3,0,1,4,9,0,8,0,42,1,
+108,0,3,0,1,4,9,0,9,0,40,1,150,0,3,0,1,4,9,0,10,0,96,1,190,0,3,0,1,4,9,0,
+11,0,62,2,30,0,3,0,1,4,9,0,12,0,60,2,92,0,3,0,1,4,9,0,13,2,150,2,152,0,3,
+0,1,4,9,0,14,0,52,5,46,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,79,0,108,0,100,0,32,0,80,0,101,
+0,114,0,115,0,105,0,97,0,110,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,
+115,0,32,0,79,0,108,0,100,0,32,0,80,0,101,0,114,0,115,0,105,0,97,0,110,0,
+86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,117,
+0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,79,0,108,0,100,0,80,
+0,101,0,114,0,115,0,105,0,97,0,110,0,78,0,111,0,116,0,111,0,32,0,105,0,115,
+0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,
+111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,
+46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,
+103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,
+116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,
+101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,
+116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,
+0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,
+0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,
+0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,
+0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,
+0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,
+0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,
+0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,
+0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,
+99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,
+0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,
+0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,
+0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,
+0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,
+0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,
+0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,
+0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,
+102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,
+0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,
+0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,
+32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,
+111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,
+0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,
+0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,
+0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,15,};
+#endif
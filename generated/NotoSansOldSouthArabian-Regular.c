@@ -0,0 +1,204 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansOldSouthArabian_Regular_ttf_size = 4724;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansOldSouthArabian_Regular_ttf");
+asm(".type fz_font_NotoSansOldSouthArabian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansOldSouthArabian_Regular_ttf, 4724");
+asm(".balign 64");
+asm("fz_font_NotoSansOldSouthArabian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansOldSouthArabian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansOldSouthArabian_Regular_ttf_size = 4724;
+const char fz_font_NotoSansOldSouthArabian_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,123,3,109,34,0,0,1,56,0,0,0,96,99,
+109,97,112,0,219,20,202,0,0,2,40,0,0,0,172,103,97,115,112,0,22,0,35,0,0,18,
+100,0,0,0,16,103,108,121,102,44,7,201,26,0,0,3,32,0,0,8,226,104,101,97,100,
+2,155,117,26,0,0,0,188,0,0,0,54,104,104,101,97,13,153,3,181,0,0,0,244,0,0,
+0,36,104,109,116,120,155,169,23,114,0,0,1,152,0,0,0,144,108,111,99,97,38,
+62,36,12,0,0,2,212,0,0,0,74,109,97,120,112,0,42,0,54,0,0,1,24,0,0,0,32,110,
+97,109,101,148,45,190,117,0,0,12,4,0,0,6,62,112,111,115,116,255,42,0,150,
+0,0,18,68,0,0,0,32,0,1,0,0,0,1,7,174,35,2,108,45,95,15,60,245,0,11,8,0,0,
+0,0,0,204,73,85,145,0,0,0,0,210,40,203,253,0,100,255,226,4,166,6,254,0,0,
+0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,5,130,0,100,0,102,4,166,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,1,0,0,0,36,0,53,0,5,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,114,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,2,88,0,0,0,1,
+0,0,0,0,4,74,5,182,0,0,0,32,0,0,4,0,0,102,0,0,0,0,4,20,0,0,2,20,0,0,5,100,
+0,220,3,181,0,100,5,100,0,220,4,164,0,120,4,86,0,220,5,4,0,160,3,210,0,160,
+4,2,0,160,4,136,0,220,5,40,0,160,4,136,0,220,4,136,0,220,3,252,0,220,5,100,
+0,220,5,100,0,220,4,91,0,160,5,3,0,160,4,136,0,220,3,222,0,160,4,136,0,220,
+3,217,0,120,3,210,0,120,5,109,0,100,5,130,0,220,4,72,0,160,4,136,0,220,4,
+86,0,220,4,86,0,220,5,30,0,120,3,2,1,44,4,164,0,120,4,136,0,220,0,0,0,2,0,
+3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,0,12,0,8,0,2,0,4,0,0,0,13,0,
+32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,0,160,254,255,255,255,0,1,255,
+245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,88,0,0,
+0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,0,0,0,32,0,
+0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,254,255,0,0,254,255,0,0,0,
+1,0,1,10,96,0,1,10,127,0,0,0,4,0,0,0,20,0,20,0,20,0,20,0,56,0,74,0,114,0,
+153,0,201,0,252,1,31,1,67,1,85,1,116,1,140,1,164,1,183,1,225,2,38,2,85,2,
+113,2,143,2,185,2,213,2,229,3,3,3,28,3,55,3,88,3,119,3,163,3,240,4,36,4,48,
+4,74,4,113,0,0,0,2,0,102,0,0,3,154,5,182,0,3,0,7,0,0,51,17,33,17,37,33,17,
+33,102,3,52,253,47,2,110,253,146,5,182,250,74,98,4,242,0,1,0,220,0,0,4,136,
+6,224,0,20,0,0,1,17,20,6,7,17,35,17,38,38,53,17,51,17,20,22,51,50,54,53,17,
+4,136,193,192,170,192,193,170,147,153,154,146,6,224,254,167,177,201,18,252,
+5,3,252,18,200,177,1,89,254,174,129,122,121,130,1,82,0,0,1,0,100,0,0,2,217,
+6,254,0,5,0,0,1,5,39,1,17,35,2,47,254,128,75,2,117,170,5,238,215,134,1,97,
+249,2,0,1,0,220,0,0,4,136,6,224,0,23,0,0,1,54,54,53,17,51,17,20,6,7,17,35,
+17,38,38,53,17,51,17,20,22,23,17,51,3,7,101,114,170,193,192,170,192,193,170,
+114,101,170,4,152,14,115,117,1,82,254,167,177,201,18,252,5,3,252,18,200,177,
+1,89,254,174,117,115,14,2,72,0,3,0,120,255,226,3,200,6,254,0,6,0,10,0,14,
+0,0,5,1,53,1,1,53,1,1,5,17,1,17,1,17,5,3,200,252,176,2,24,253,232,3,80,253,
+164,1,178,254,78,1,178,254,78,30,1,240,72,1,86,1,86,72,1,240,250,245,246,
+2,24,254,235,2,224,254,234,2,25,246,0,2,0,220,0,0,3,122,6,224,0,17,0,29,0,
+0,1,22,22,21,20,6,7,17,35,17,38,38,53,52,54,55,17,51,3,20,22,51,50,54,53,
+52,38,35,34,6,2,128,110,140,140,110,170,109,141,139,111,170,255,102,68,70,
+100,100,70,68,102,4,180,30,174,109,107,176,29,253,189,2,67,29,175,108,106,
+177,30,2,44,252,156,70,99,99,70,71,98,98,0,3,0,160,1,198,4,100,5,16,0,15,
+0,22,0,29,0,0,19,52,54,54,51,50,22,22,21,20,6,6,35,34,38,38,55,20,22,23,17,
+6,6,5,52,38,39,17,54,54,160,119,219,142,142,221,121,122,221,141,141,219,120,
+165,123,109,112,120,2,122,121,111,111,121,3,105,120,193,110,109,194,120,119,
+193,107,107,192,121,104,139,18,2,12,21,140,102,103,138,21,253,245,20,139,
+0,0,1,0,160,255,226,3,50,6,254,0,14,0,0,55,1,53,1,53,1,53,1,53,1,21,1,1,21,
+1,160,1,162,254,94,1,162,254,94,2,146,254,82,1,174,253,110,171,1,56,13,1,
+98,60,1,98,13,1,56,201,254,23,60,254,151,254,151,60,254,23,0,0,1,0,160,255,
+226,3,38,6,254,0,17,0,0,19,22,0,18,21,20,2,0,7,53,54,54,18,53,52,2,38,39,
+160,192,1,38,160,163,254,219,190,140,212,119,118,215,138,6,254,44,254,252,
+254,122,219,214,254,118,254,253,40,160,47,213,1,60,171,174,1,62,217,39,0,
+1,0,220,0,0,3,172,6,224,0,7,0,0,33,35,17,33,17,35,17,33,3,172,170,254,132,
+170,2,208,6,74,249,182,6,224,0,1,0,160,0,0,4,136,6,224,0,11,0,0,1,1,51,1,
+1,35,1,1,35,1,1,51,2,148,1,59,185,254,105,1,151,186,254,198,254,198,186,1,
+151,254,105,185,4,56,2,168,252,143,252,145,2,166,253,90,3,111,3,113,0,1,0,
+220,0,0,3,172,6,224,0,11,0,0,33,35,17,33,17,35,17,33,17,51,17,33,3,172,170,
+254,132,170,1,19,170,1,19,3,82,252,174,3,232,2,248,253,8,0,0,1,0,220,0,0,
+3,172,6,224,0,10,0,0,33,35,17,33,17,35,17,1,51,1,33,3,172,170,254,132,170,
+1,3,165,254,252,2,44,3,82,252,174,3,232,2,248,253,8,0,1,0,220,0,0,3,32,6,
+224,0,7,0,0,1,33,17,35,17,33,17,51,1,134,1,154,170,254,102,170,4,16,251,240,
+3,122,3,102,0,1,0,220,0,0,4,136,6,224,0,24,0,0,1,17,20,6,7,17,33,17,35,17,
+33,17,38,38,53,17,51,17,20,22,51,50,54,53,17,4,136,193,192,1,94,170,254,162,
+192,193,170,147,153,154,146,6,224,254,167,177,200,18,254,142,253,118,1,244,
+2,8,18,200,177,1,89,254,174,129,122,121,130,1,82,0,0,2,0,220,0,0,4,136,6,
+254,0,33,0,45,0,0,33,17,52,39,17,35,17,6,21,17,35,17,52,54,55,17,38,38,53,
+52,54,51,50,22,22,21,20,6,7,17,22,22,21,17,1,20,22,51,50,54,53,52,38,35,34,
+6,3,222,215,170,215,170,193,192,109,141,198,137,87,156,92,140,110,192,193,
+253,128,102,68,70,100,100,70,68,102,1,82,215,30,253,185,2,71,30,215,254,174,
+1,89,177,200,18,1,157,29,175,108,130,195,87,152,86,107,176,29,254,99,18,200,
+177,254,167,5,186,70,99,99,70,71,98,98,0,0,2,0,160,0,0,3,187,6,225,0,15,0,
+19,0,0,1,1,35,3,3,35,9,3,51,19,19,51,9,2,3,19,19,2,143,1,44,195,203,202,195,
+1,44,254,212,1,44,254,212,195,202,203,195,254,212,1,44,254,114,202,202,202,
+1,184,254,72,1,41,254,215,1,184,1,184,1,184,1,185,254,214,1,42,254,71,254,
+72,1,41,254,215,254,215,1,41,0,2,0,160,0,0,4,99,6,224,0,5,0,9,0,0,33,35,1,
+1,51,9,4,2,162,65,254,63,1,193,65,1,193,254,30,254,225,1,31,1,32,3,112,3,
+112,252,144,2,74,253,182,253,182,2,74,0,0,1,0,220,0,0,3,172,6,224,0,15,0,
+0,33,35,17,33,17,35,17,33,17,33,17,51,17,33,17,33,3,172,170,254,132,170,1,
+19,254,237,170,1,19,1,19,3,82,252,174,3,232,1,17,1,231,254,175,254,89,0,0,
+2,0,160,2,46,3,62,4,182,0,14,0,26,0,0,19,52,54,51,50,22,22,21,20,6,6,35,34,
+38,38,55,20,22,51,50,54,53,52,38,35,34,6,160,198,137,87,156,92,92,155,88,
+87,155,93,165,102,68,70,100,100,70,68,102,3,113,130,195,87,152,86,86,150,
+87,87,151,86,70,99,99,70,71,98,98,0,3,0,220,0,0,3,172,6,224,0,3,0,7,0,11,
+0,0,33,33,17,33,1,33,17,33,53,33,17,33,3,172,253,48,2,208,253,218,1,124,254,
+132,1,124,254,132,6,224,249,182,2,168,150,2,118,0,0,1,0,120,0,0,2,253,6,224,
+0,5,0,0,19,33,17,35,17,33,120,2,133,170,254,37,6,224,249,32,6,74,0,2,0,120,
+0,0,2,246,6,224,0,9,0,13,0,0,33,35,17,1,35,17,51,1,17,51,1,17,37,53,2,246,
+170,254,99,55,55,1,157,170,254,44,1,42,2,187,254,226,3,215,254,226,2,138,
+253,132,254,73,215,13,0,1,0,100,0,0,4,145,6,224,0,10,0,0,19,1,33,17,35,17,
+33,17,35,17,3,100,1,93,2,208,170,254,132,170,206,4,192,2,32,249,32,6,74,249,
+182,5,183,254,188,0,0,3,0,220,0,0,4,166,6,224,0,3,0,7,0,11,0,0,33,33,17,33,
+1,51,17,35,1,51,17,35,4,166,252,54,3,202,254,112,230,230,254,112,230,230,
+6,224,249,183,5,179,250,77,5,179,0,3,0,160,0,0,3,168,6,225,0,5,0,8,0,11,0,
+0,33,33,1,1,33,1,19,3,3,19,19,33,3,168,252,248,1,55,254,201,3,8,254,200,79,
+155,156,156,152,254,207,3,121,3,104,252,152,253,30,2,30,253,226,3,207,1,228,
+0,0,2,0,220,0,0,3,172,6,224,0,11,0,15,0,0,33,35,17,33,17,35,17,51,17,33,17,
+51,1,33,17,33,3,172,170,254,132,170,170,1,124,170,253,218,1,124,254,132,2,
+18,253,238,6,224,254,32,1,224,251,200,1,194,0,2,0,220,0,0,3,122,6,254,0,15,
+0,27,0,0,19,52,54,51,50,22,22,21,20,6,7,17,35,17,38,38,55,20,22,51,50,54,
+53,52,38,35,34,6,220,198,137,87,156,92,140,110,170,109,141,165,102,68,70,
+100,100,70,68,102,5,185,130,195,87,152,86,107,176,29,251,127,4,129,29,175,
+109,70,99,99,70,71,98,98,0,3,0,220,255,226,3,122,6,254,0,28,0,40,0,52,0,0,
+19,52,54,55,17,38,38,53,52,54,51,50,22,22,21,20,6,7,17,22,22,21,20,6,6,35,
+34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,17,20,22,51,50,54,53,52,38,35,
+34,6,220,139,111,109,141,198,137,87,156,92,140,110,110,140,92,155,88,87,155,
+93,165,102,68,70,100,100,70,68,102,102,68,70,100,100,70,68,102,1,37,106,177,
+30,2,35,29,175,108,130,195,87,152,86,107,176,29,253,221,30,174,109,86,150,
+87,87,151,86,70,99,99,70,71,98,98,4,77,70,99,99,70,71,98,98,0,0,2,0,120,0,
+0,4,66,6,254,0,21,0,33,0,0,19,52,54,51,50,22,22,21,20,6,7,21,33,17,35,17,
+33,17,35,17,38,38,55,20,22,51,50,54,53,52,38,35,34,6,120,198,137,87,156,92,
+140,110,2,38,170,254,132,170,109,141,165,102,68,70,100,100,70,68,102,5,185,
+130,195,87,152,86,107,176,29,213,252,84,3,22,252,234,4,129,29,175,109,70,
+99,99,70,71,98,98,0,1,1,44,0,0,1,214,6,224,0,3,0,0,33,35,17,51,1,214,170,
+170,6,224,0,2,0,120,0,0,3,200,6,254,0,5,0,9,0,0,33,35,17,1,53,9,2,17,5,3,
+200,170,253,90,3,80,253,164,1,178,254,78,3,19,1,179,72,1,240,253,226,254,
+236,2,23,246,0,5,0,220,0,0,3,172,6,224,0,3,0,7,0,11,0,15,0,19,0,0,19,33,17,
+33,55,33,53,33,17,33,53,33,17,33,53,33,53,33,53,33,220,2,208,253,48,170,1,
+124,254,132,1,124,254,132,1,124,254,132,1,124,254,132,6,224,249,32,150,254,
+3,186,252,251,224,252,150,252,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,
+0,3,0,1,4,9,0,1,0,54,0,94,0,3,0,1,4,9,0,2,0,14,0,148,0,3,0,1,4,9,0,3,0,92,
+0,162,0,3,0,1,4,9,0,4,0,54,0,94,0,3,0,1,4,9,0,5,0,30,0,254,0,3,0,1,4,9,0,
+6,0,46,1,28,0,3,0,1,4,9,0,7,0,68,1,74,0,3,0,1,4,9,0,8,0,42,1,142,0,3,0,1,
+4,9,0,9,0,40,1,184,0,3,0,1,4,9,0,10,0,96,1,224,0,3,0,1,4,9,0,11,0,62,2,64,
+0,3,0,1,4,9,0,12,0,60,2,126,0,3,0,1,4,9,0,13,2,150,2,186,0,3,0,1,4,9,0,14,
+0,52,5,80,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,
+0,48,0,49,0,49,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,
+99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,
+0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,
+0,32,0,83,0,97,0,110,0,115,0,32,0,79,0,108,0,100,0,32,0,83,0,111,0,117,0,
+116,0,104,0,32,0,65,0,114,0,97,0,98,0,105,0,97,0,110,0,82,0,101,0,103,0,117,
+0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,
+0,32,0,83,0,97,0,110,0,115,0,32,0,79,0,108,0,100,0,32,0,83,0,111,0,117,0,
+116,0,104,0,32,0,65,0,114,0,97,0,98,0,105,0,97,0,110,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,
+116,0,111,0,83,0,97,0,110,0,115,0,79,0,108,0,100,0,83,0,111,0,117,0,116,0,
+104,0,65,0,114,0,97,0,98,0,105,0,97,0,110,0,78,0,111,0,116,0,111,0,32,0,105,
+0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,
+0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,
+0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,
+0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,
+110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,
+0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,
+0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,
+0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,
+0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,
+0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,
+0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,
+105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,
+0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,
+0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,
+0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,
+0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,
+0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,
+0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,
+0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,
+105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,
+44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,
+0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,
+0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,
+103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,
+0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,
+0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,39,0,150,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,
+15,};
+#endif
@@ -0,0 +1,4215 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansOriya_Regular_ttf_size = 103684;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansOriya_Regular_ttf");
+asm(".type fz_font_NotoSansOriya_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansOriya_Regular_ttf, 103684");
+asm(".balign 64");
+asm("fz_font_NotoSansOriya_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansOriya-Regular.ttf\"");
+#else
+const int fz_font_NotoSansOriya_Regular_ttf_size = 103684;
+const char fz_font_NotoSansOriya_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,48,24,48,188,0,1,49,96,0,0,1,52,71,
+80,79,83,100,249,194,143,0,1,50,148,0,0,56,168,71,83,85,66,197,248,184,109,
+0,1,107,60,0,0,41,200,79,83,47,50,121,176,104,171,0,0,1,104,0,0,0,96,99,109,
+97,112,242,147,228,193,0,0,12,68,0,0,1,68,103,97,115,112,0,7,0,7,0,1,49,84,
+0,0,0,12,103,108,121,102,153,45,18,71,0,0,18,200,0,0,234,206,104,101,97,100,
+4,0,98,149,0,0,0,236,0,0,0,54,104,104,101,97,9,198,3,14,0,0,1,36,0,0,0,36,
+104,109,116,120,215,199,55,150,0,0,1,200,0,0,10,124,108,111,99,97,230,57,
+32,132,0,0,13,136,0,0,5,64,109,97,120,112,2,177,1,7,0,0,1,72,0,0,0,32,110,
+97,109,101,139,127,184,5,0,0,253,152,0,0,5,250,112,111,115,116,144,22,24,
+172,0,1,3,148,0,0,45,189,0,1,0,0,0,1,2,143,211,33,80,247,95,15,60,245,0,11,
+8,0,0,0,0,0,208,76,75,136,0,0,0,0,210,40,203,253,250,127,252,45,7,238,7,86,
+0,0,0,9,0,1,0,0,0,0,0,0,0,1,0,0,7,86,252,34,0,0,8,0,250,127,252,76,7,238,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,159,0,1,0,0,2,159,0,140,0,8,0,121,0,6,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,4,182,1,144,0,5,0,0,5,153,5,51,0,0,
+0,191,5,153,5,51,0,0,2,130,0,102,2,129,0,0,2,11,5,2,4,5,4,2,2,4,0,8,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,86,252,34,0,0,7,86,3,
+222,0,0,0,1,0,0,0,0,5,66,5,66,0,0,0,32,0,4,4,205,0,193,0,0,0,0,3,112,0,0,
+3,113,0,0,0,0,253,121,2,106,0,37,3,66,0,72,5,4,0,61,6,145,0,61,5,84,0,76,
+5,98,0,63,5,78,0,76,5,123,0,76,5,115,0,76,4,16,0,61,5,35,0,0,6,145,0,0,5,
+29,0,94,6,143,0,94,5,74,0,76,5,68,0,76,5,61,0,76,5,47,0,76,5,174,0,76,5,20,
+0,76,5,37,0,76,5,74,0,76,5,33,0,76,5,53,0,84,5,27,0,76,5,186,0,84,5,37,0,
+76,5,37,0,76,5,41,0,82,5,37,0,76,5,4,0,61,5,18,0,76,4,166,0,72,5,18,0,76,
+5,47,0,76,6,80,0,76,5,20,0,76,5,102,0,76,5,47,0,76,5,119,0,31,5,59,0,76,5,
+156,0,76,5,74,0,76,5,20,0,76,5,68,0,61,5,72,0,76,5,37,0,76,4,246,0,76,0,0,
+253,74,2,197,0,59,1,131,0,125,0,0,251,35,2,94,255,252,0,0,252,238,0,0,253,
+252,0,0,254,88,0,0,254,106,3,156,0,90,6,113,0,90,6,156,0,90,6,156,0,90,0,
+0,254,203,0,0,252,0,1,131,253,131,5,37,0,76,5,37,0,76,5,219,0,31,5,125,0,
+76,4,16,0,61,0,0,254,8,0,0,254,8,4,147,0,74,4,147,0,186,4,147,0,168,4,147,
+0,63,4,147,0,51,4,147,0,18,4,147,0,74,4,147,0,84,4,147,0,240,4,147,0,111,
+4,119,0,72,4,150,0,78,1,197,0,158,3,8,0,80,4,57,0,80,3,203,0,31,4,96,0,49,
+4,236,0,53,5,74,0,76,5,68,0,76,5,61,0,76,5,47,0,76,5,174,0,76,5,20,0,76,5,
+37,0,76,5,74,0,76,5,33,0,76,5,53,0,84,5,27,0,76,5,186,0,84,5,41,0,82,5,37,
+0,76,5,4,0,61,5,18,0,76,4,166,0,72,5,18,0,76,5,47,0,76,6,80,0,76,5,20,0,76,
+5,102,0,76,5,47,0,76,5,119,0,31,5,59,0,76,5,156,0,76,5,74,0,76,5,20,0,76,
+5,68,0,61,5,72,0,76,5,37,0,76,4,246,0,76,5,219,0,31,4,150,0,78,0,0,253,209,
+0,0,253,23,0,0,253,86,0,0,253,102,0,0,253,111,0,0,253,125,0,0,253,158,0,0,
+253,178,0,0,253,41,0,0,253,129,0,0,253,145,0,0,253,219,0,0,253,152,0,0,254,
+59,0,0,253,111,0,0,251,238,0,0,251,254,0,0,253,166,0,0,253,182,0,0,253,53,
+0,0,253,111,0,0,253,111,0,0,253,39,0,0,253,84,0,0,252,227,0,0,252,66,0,0,
+253,43,0,0,253,43,0,0,253,78,0,0,253,96,0,0,253,117,0,0,253,154,0,0,253,6,
+0,0,252,106,3,0,0,72,5,74,0,76,5,74,0,76,5,74,0,76,5,74,0,76,5,143,0,31,6,
+2,0,31,5,74,0,76,5,139,0,76,5,61,0,76,5,61,0,76,5,238,0,76,6,125,0,76,6,119,
+0,76,6,80,0,76,5,174,0,76,5,49,0,76,5,37,0,72,5,74,0,76,4,209,0,55,4,217,
+0,45,4,143,0,45,6,72,0,45,5,176,0,45,5,39,0,76,5,14,0,76,5,14,0,76,5,170,
+0,82,5,53,0,82,5,41,0,82,5,41,0,82,5,41,0,82,5,74,0,76,5,117,0,76,5,37,0,
+76,5,18,0,76,5,47,0,76,5,47,0,76,5,37,0,76,5,14,0,76,5,74,0,76,5,74,0,76,
+5,209,0,76,4,186,0,66,5,18,0,76,5,18,0,76,5,18,0,76,5,92,0,31,5,92,0,31,5,
+18,0,76,5,47,0,76,5,47,0,76,5,72,0,76,5,47,0,76,5,57,0,76,5,20,0,76,5,74,
+0,76,5,88,0,76,6,121,0,76,5,59,0,76,5,47,0,76,5,162,0,76,5,162,0,76,5,156,
+0,76,5,78,0,76,5,74,0,76,5,74,0,76,5,74,0,76,5,195,0,61,5,68,0,61,5,106,0,
+61,5,193,0,76,5,184,0,76,5,84,0,76,5,72,0,76,5,72,0,76,5,160,0,76,5,158,0,
+76,5,164,0,76,5,37,0,76,5,47,0,76,5,37,0,76,5,37,0,76,5,125,0,76,0,0,253,
+10,6,145,0,0,6,145,0,0,5,170,0,98,6,143,0,94,6,143,0,94,0,0,251,35,0,0,251,
+35,0,0,251,35,0,0,251,193,0,0,251,193,0,0,251,160,1,131,252,139,1,131,252,
+244,1,193,251,158,0,0,253,250,0,0,250,127,0,0,250,127,0,0,250,127,0,0,250,
+127,0,0,251,137,0,0,251,137,0,0,251,137,0,0,251,137,0,0,252,238,0,0,253,252,
+0,0,254,88,0,0,254,106,0,0,252,238,0,0,253,252,0,0,254,88,0,0,254,106,0,0,
+254,203,0,0,254,8,0,0,254,8,0,0,252,238,0,0,253,252,0,0,254,88,0,0,254,203,
+0,0,253,29,0,0,254,43,0,0,254,141,0,0,255,215,0,0,254,203,0,0,0,0,0,0,0,0,
+5,74,0,76,5,68,0,76,5,61,0,76,5,47,0,76,5,174,0,76,5,20,0,76,5,37,0,76,5,
+74,0,76,5,33,0,76,5,53,0,84,5,27,0,76,5,186,0,84,5,37,0,76,5,37,0,76,5,41,
+0,82,5,37,0,76,5,4,0,61,5,18,0,76,4,166,0,72,5,18,0,76,5,47,0,76,6,80,0,76,
+5,20,0,76,5,102,0,76,5,47,0,76,5,119,0,31,5,59,0,76,5,156,0,76,5,74,0,76,
+5,20,0,76,5,68,0,61,5,72,0,76,5,37,0,76,4,246,0,76,5,37,0,76,5,37,0,76,5,
+219,0,31,4,150,0,78,5,74,0,76,5,68,0,76,5,61,0,76,5,47,0,76,5,174,0,76,5,
+20,0,76,5,37,0,76,5,74,0,76,5,33,0,76,5,53,0,84,5,27,0,76,5,186,0,84,5,41,
+0,82,5,37,0,76,5,4,0,61,5,18,0,76,4,166,0,72,5,18,0,76,5,47,0,76,6,80,0,76,
+5,20,0,76,5,102,0,76,5,47,0,76,5,119,0,31,5,59,0,76,5,156,0,76,5,74,0,76,
+5,20,0,76,5,68,0,61,5,72,0,76,5,37,0,76,4,246,0,76,5,219,0,31,4,150,0,78,
+5,143,0,31,2,68,0,168,3,121,0,156,5,57,0,70,6,166,0,100,2,2,0,156,2,213,0,
+133,2,213,0,111,3,250,0,63,4,147,0,102,2,37,0,106,2,147,0,82,1,252,0,133,
+3,100,0,74,4,147,0,139,4,147,0,201,4,147,0,137,4,147,0,131,4,147,0,86,4,147,
+0,166,4,147,0,147,4,147,0,129,4,147,0,139,4,147,0,139,2,76,0,172,2,76,0,106,
+4,147,0,102,4,147,0,115,4,147,0,102,3,162,0,43,3,29,0,205,3,100,0,74,3,29,
+0,131,4,147,0,82,3,74,255,252,3,113,0,90,4,104,1,233,3,113,0,131,4,147,0,
+102,2,147,0,82,4,0,0,82,8,0,0,82,2,35,0,123,2,35,0,121,3,156,0,123,3,156,
+0,121,6,84,0,154,4,147,0,135,4,147,0,102,4,147,0,102,4,147,0,141,3,63,1,211,
+4,201,1,211,0,0,0,0,0,0,255,203,0,0,254,213,4,20,0,106,0,0,251,216,0,0,251,
+216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,216,
+0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,252,110,0,0,251,216,0,
+0,251,106,0,0,251,124,0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,
+251,216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,192,0,0,251,216,0,0,251,
+216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,216,0,0,251,192,
+0,0,252,48,0,0,252,48,0,0,252,52,0,0,252,1,0,0,252,1,5,74,0,76,5,74,0,76,
+5,74,0,76,5,82,0,76,5,74,0,76,5,188,0,82,5,53,0,82,5,57,0,82,5,41,0,82,5,
+14,0,76,5,18,0,76,5,18,0,76,5,18,0,76,5,47,0,76,5,47,0,76,5,162,0,76,5,162,
+0,76,5,74,0,76,5,74,0,76,5,98,0,61,5,106,0,61,5,199,0,76,5,84,0,76,5,72,0,
+76,5,180,0,76,5,37,0,76,5,47,0,76,5,51,0,76,5,150,0,76,0,0,253,23,0,0,253,
+86,0,0,253,102,0,0,253,111,0,0,253,125,0,0,253,158,0,0,253,178,0,0,253,41,
+0,0,253,129,0,0,253,145,0,0,253,219,0,0,253,152,0,0,254,59,0,0,253,111,0,
+0,251,238,0,0,251,254,0,0,253,166,0,0,253,182,0,0,253,53,0,0,253,111,0,0,
+253,111,0,0,253,39,0,0,253,84,0,0,252,227,0,0,252,66,0,0,253,43,0,0,253,43,
+0,0,253,78,0,0,253,96,0,0,253,117,0,0,253,154,0,0,253,6,0,0,253,23,0,0,253,
+41,0,0,251,238,0,0,251,254,0,0,253,53,0,0,253,39,0,0,252,227,0,0,252,147,
+0,0,253,43,0,0,253,43,0,0,253,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,253,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,
+70,0,0,252,84,0,0,0,0,0,0,0,0,0,0,253,109,0,0,0,0,0,0,0,0,0,0,253,92,0,0,
+0,0,0,0,253,12,0,0,252,147,0,0,253,92,0,0,253,92,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,1,109,255,215,0,0,0,0,1,248,0,0,1,
+248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,252,66,0,0,252,127,0,0,252,188,4,246,0,76,4,246,0,76,4,
+246,0,76,4,246,0,76,4,246,0,76,4,246,0,76,4,246,0,76,4,246,0,76,4,246,0,76,
+4,246,0,76,4,246,0,76,5,219,0,31,5,219,0,31,5,219,0,31,5,219,0,31,5,219,0,
+31,5,219,0,31,5,219,0,31,5,219,0,31,5,219,0,31,5,219,0,31,5,219,0,31,0,0,
+253,29,0,0,254,43,0,0,254,141,0,0,254,203,0,0,252,147,0,0,252,106,5,57,0,
+82,5,74,0,76,4,246,0,76,0,0,252,106,2,6,0,0,1,246,0,0,1,238,0,0,2,49,0,0,
+1,231,0,0,1,246,0,0,2,4,0,0,1,244,0,0,1,164,0,0,1,254,0,0,1,74,0,0,1,238,
+0,0,1,240,0,0,1,166,0,0,1,238,0,0,2,145,0,0,2,68,0,0,2,14,0,0,1,252,0,0,1,
+231,0,0,1,231,0,0,2,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,145,0,6,1,41,0,
+0,1,61,0,0,1,199,0,0,1,184,0,0,1,174,0,0,1,184,0,0,1,23,0,0,1,39,0,0,1,123,
+0,0,1,199,0,0,1,213,0,0,1,182,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,56,0,0,0,
+72,0,64,0,5,0,8,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,160,0,173,0,215,0,247,
+9,101,11,3,11,12,11,16,11,40,11,48,11,51,11,57,11,68,11,72,11,77,11,87,11,
+93,11,99,11,119,32,13,32,20,32,25,32,29,32,38,32,185,34,18,37,204,254,255,
+255,255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,173,0,215,0,247,9,
+100,11,1,11,5,11,15,11,19,11,42,11,50,11,53,11,60,11,71,11,75,11,86,11,92,
+11,95,11,102,32,11,32,19,32,24,32,28,32,38,32,185,34,18,37,204,254,255,255,
+255,0,1,255,245,0,0,1,75,1,74,1,47,1,20,255,99,0,230,0,196,0,165,248,59,245,
+3,245,2,245,0,244,254,244,253,244,252,244,251,244,249,244,247,244,245,244,
+237,244,233,244,232,244,230,225,150,225,129,225,126,225,124,225,116,224,229,
+223,139,219,216,2,162,0,1,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,109,1,110,1,111,0,0,0,21,0,21,0,21,0,21,0,61,
+0,100,0,171,1,7,1,19,1,120,1,235,2,62,2,160,3,0,3,87,3,134,3,235,4,61,4,196,
+5,27,5,114,5,186,6,7,6,109,6,186,7,57,7,145,7,244,8,113,8,188,8,241,9,67,
+9,167,9,249,10,76,10,150,10,219,11,9,11,78,11,143,11,238,12,62,12,154,12,
+215,13,41,13,123,13,205,14,30,14,125,14,210,15,34,15,87,15,168,15,191,15,
+223,15,237,16,9,16,28,16,89,16,135,16,178,16,236,17,38,17,54,17,70,17,86,
+17,101,17,146,17,193,17,205,17,217,18,73,18,182,19,25,19,107,19,197,19,242,
+20,39,20,90,20,164,20,229,21,60,21,132,21,197,21,213,22,1,22,57,22,162,22,
+176,22,210,23,3,23,25,23,91,23,149,23,161,23,173,23,185,23,197,23,209,23,
+221,23,233,23,245,24,1,24,13,24,25,24,37,24,49,24,61,24,73,24,85,24,97,24,
+109,24,121,24,133,24,145,24,157,24,169,24,181,24,193,24,205,24,217,24,229,
+24,241,24,253,25,9,25,21,25,33,25,45,25,65,25,121,25,201,26,9,26,80,26,175,
+26,244,27,107,27,152,27,239,28,48,28,86,28,155,28,203,29,24,29,76,29,146,
+29,209,29,251,30,30,30,84,30,165,30,198,31,28,31,84,31,99,31,145,31,189,32,
+15,32,91,32,140,32,210,33,45,33,90,33,124,34,2,34,156,35,30,35,154,35,253,
+36,160,37,34,37,155,37,254,38,102,38,235,39,121,39,244,40,97,41,23,41,121,
+42,23,42,151,43,17,43,142,44,78,44,228,45,118,45,209,46,87,46,224,47,113,
+47,225,48,99,48,220,49,105,49,200,50,50,50,183,51,5,51,81,51,153,51,217,52,
+82,52,169,53,7,53,111,53,173,54,28,54,135,55,9,55,96,55,190,56,29,56,137,
+56,243,57,81,57,182,58,16,58,131,58,230,59,62,59,174,60,8,60,115,60,251,61,
+136,62,5,62,133,62,255,63,151,64,15,64,160,64,172,65,39,65,166,66,46,66,153,
+67,31,67,153,68,48,68,151,69,17,69,114,69,205,70,63,70,161,71,31,71,86,71,
+220,72,74,72,192,73,104,73,248,74,53,74,89,74,159,74,233,75,30,75,119,75,
+202,76,9,76,103,76,124,76,153,76,213,76,249,77,63,77,91,77,151,77,187,78,
+1,78,65,78,73,78,81,78,89,78,150,78,197,78,240,79,44,79,53,79,139,79,226,
+80,32,80,77,80,120,80,129,80,186,80,230,81,17,81,26,81,41,81,50,81,59,81,
+71,81,83,81,95,81,107,81,119,81,131,81,143,81,155,81,167,81,179,81,191,81,
+203,81,215,81,227,81,239,81,251,82,7,82,19,82,31,82,43,82,55,82,67,82,79,
+82,91,82,103,82,115,82,127,82,139,82,151,82,163,82,175,82,187,82,199,82,211,
+82,227,82,243,82,255,83,11,83,27,83,43,83,59,83,75,83,91,83,107,83,123,83,
+139,83,155,83,171,83,187,83,203,83,219,83,235,83,251,84,11,84,27,84,43,84,
+59,84,75,84,91,84,107,84,123,84,139,84,155,84,171,84,187,84,203,84,219,84,
+235,84,251,85,11,85,27,85,43,85,55,85,83,85,105,85,164,85,239,85,254,86,28,
+86,58,86,94,86,118,86,137,86,150,86,172,86,188,86,234,87,8,87,53,87,111,87,
+148,87,193,87,248,88,10,88,83,88,140,88,177,88,209,88,229,88,249,89,13,89,
+73,89,93,89,108,89,127,89,147,89,160,89,205,89,218,90,7,90,46,90,54,90,67,
+90,80,90,98,90,117,90,147,90,178,90,228,91,5,91,51,91,64,91,112,91,125,91,
+145,91,145,91,158,91,188,92,34,92,46,92,58,92,70,92,82,92,95,92,108,92,121,
+92,133,92,146,92,159,92,172,92,185,92,198,92,211,92,224,92,237,92,250,93,
+7,93,19,93,31,93,43,93,55,93,67,93,79,93,91,93,103,93,115,93,127,93,139,93,
+152,93,165,93,177,93,190,93,203,93,216,93,229,93,242,93,255,94,141,95,21,
+95,149,96,5,96,132,97,15,97,130,98,3,98,137,99,12,99,123,99,228,100,69,100,
+172,101,23,101,153,102,18,102,147,103,7,103,153,104,18,104,153,105,8,105,
+139,106,8,106,106,106,197,107,39,107,166,107,175,107,184,107,193,107,202,
+107,211,107,220,107,229,107,238,107,247,108,0,108,9,108,18,108,27,108,36,
+108,45,108,54,108,63,108,72,108,81,108,90,108,99,108,108,108,117,108,126,
+108,135,108,144,108,153,108,162,108,171,108,180,108,189,108,198,108,254,109,
+45,109,54,109,63,109,72,109,81,109,90,109,106,109,152,109,196,109,249,110,
+2,110,11,110,20,110,29,110,38,110,47,110,92,110,101,110,110,110,119,110,128,
+110,137,110,146,110,192,111,5,111,14,111,23,111,56,111,65,111,74,111,106,
+111,115,111,169,111,185,111,231,112,19,112,28,112,37,112,46,112,55,112,64,
+112,73,112,82,112,91,112,100,112,109,112,118,112,127,112,136,112,145,112,
+153,112,161,112,170,112,179,112,188,112,196,112,205,112,214,112,222,112,237,
+112,252,113,8,113,20,113,32,113,44,113,56,113,68,113,80,113,92,113,104,113,
+116,113,128,113,140,113,152,113,164,113,176,113,188,113,200,113,212,113,224,
+113,236,113,248,114,4,114,12,114,20,114,28,114,36,114,44,114,79,114,91,114,
+103,114,184,114,250,115,3,115,12,115,21,115,30,115,39,115,48,115,57,115,66,
+115,75,115,84,115,93,115,102,115,111,115,120,115,129,115,138,115,147,115,
+156,115,165,115,174,115,183,115,192,115,201,115,210,115,219,115,228,115,237,
+115,246,115,255,116,8,116,17,116,26,116,35,116,44,116,53,116,62,116,71,116,
+80,116,89,116,98,116,107,116,116,116,125,116,134,116,143,116,152,116,161,
+116,170,116,179,116,226,117,42,117,51,117,60,117,69,117,85,117,94,117,103,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,2,253,121,5,170,0,104,7,
+70,0,11,0,23,0,0,3,20,6,35,34,38,53,52,54,51,50,22,37,6,6,35,34,38,39,55,
+22,51,50,55,180,52,40,42,53,55,40,38,54,1,28,18,194,164,163,195,17,123,24,
+228,225,27,6,231,40,52,52,40,42,53,53,1,174,186,185,175,15,248,248,0,0,2,
+0,37,3,41,2,70,5,66,0,11,0,23,0,0,1,34,38,53,52,54,51,50,22,21,20,6,3,34,
+6,21,20,22,51,50,54,53,52,38,1,53,119,153,149,123,118,155,151,122,66,77,82,
+61,64,80,81,3,41,148,122,116,151,151,120,118,148,1,160,85,63,66,81,83,62,
+66,84,0,0,3,0,72,255,236,2,250,5,86,0,22,0,35,0,47,0,0,1,38,38,53,52,54,51,
+50,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,37,54,54,53,52,38,35,34,6,6,
+21,20,22,23,6,6,21,20,22,51,50,54,53,52,38,1,51,125,108,191,155,151,189,105,
+129,126,110,192,154,151,193,1,91,109,95,109,96,66,94,47,92,113,115,92,115,
+94,93,114,89,2,165,88,178,104,142,177,179,143,102,171,92,91,188,107,135,178,
+178,139,212,241,72,138,78,93,106,51,86,53,84,138,222,79,143,82,85,105,107,
+81,87,138,0,0,1,0,61,255,236,4,135,5,86,0,66,0,0,33,35,55,6,4,35,34,38,53,
+52,54,54,55,55,62,2,53,52,35,34,6,21,21,35,53,52,38,35,34,6,21,20,23,7,38,
+38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,7,7,14,3,21,20,22,51,50,36,
+55,17,51,4,135,137,4,107,254,235,161,203,217,76,166,168,18,84,112,58,106,
+51,54,131,50,50,43,61,41,121,23,28,131,92,60,84,35,30,97,56,105,123,155,189,
+43,71,100,80,40,146,136,162,1,5,116,137,242,133,129,202,170,96,155,121,56,
+6,28,65,106,88,174,66,89,166,166,85,70,61,62,83,93,37,48,118,51,106,132,46,
+48,48,46,148,139,152,198,63,15,25,44,74,89,61,118,129,153,157,3,157,0,255,
+255,0,61,255,236,6,20,5,86,0,34,0,7,0,0,0,3,0,55,5,14,0,0,0,3,0,76,255,170,
+5,86,5,86,0,48,0,59,0,69,0,0,37,6,35,34,38,53,52,55,38,53,52,18,36,51,32,
+0,17,20,7,19,7,3,54,54,53,52,2,35,34,6,6,21,20,23,54,51,50,22,23,54,51,50,
+22,21,20,6,35,34,38,3,34,21,20,22,51,50,54,53,52,38,33,34,21,20,22,51,50,
+53,52,38,2,57,64,116,104,113,17,113,144,1,19,185,1,29,1,59,121,207,125,233,
+71,60,240,221,144,211,110,48,57,75,51,92,31,63,122,100,113,112,105,52,94,
+196,105,51,54,52,48,52,1,23,100,44,58,101,54,90,110,172,161,83,63,150,202,
+155,1,1,143,254,178,254,230,229,247,254,238,86,1,80,137,225,127,232,1,6,107,
+197,122,124,91,53,54,56,110,170,162,164,169,53,1,237,204,115,109,110,111,
+102,105,207,106,115,224,99,105,0,0,3,0,63,255,170,5,100,5,86,0,58,0,70,0,
+80,0,0,37,6,35,34,38,53,52,55,38,38,53,52,54,55,54,54,51,50,0,17,20,7,19,
+7,3,54,54,53,52,2,35,34,7,22,23,7,38,38,35,34,6,21,20,23,54,51,50,22,23,54,
+51,50,22,21,20,6,35,34,38,3,34,21,20,22,51,50,54,54,53,52,38,33,34,21,20,
+22,51,50,53,52,38,2,71,63,117,104,113,7,61,69,134,121,51,238,171,239,1,21,
+120,206,125,233,71,60,203,182,210,85,163,134,98,40,111,62,120,138,44,60,103,
+51,91,32,64,120,100,113,112,105,55,93,194,105,51,54,32,44,24,52,1,24,101,
+45,58,100,53,89,109,173,160,60,40,51,154,84,124,185,36,155,164,254,179,254,
+237,239,245,254,238,86,1,80,137,225,127,229,1,9,166,3,128,94,45,51,134,102,
+90,57,90,53,56,109,169,163,164,169,57,1,233,204,115,109,42,98,81,102,105,
+207,106,115,224,100,104,0,0,1,0,76,255,170,5,80,5,86,0,55,0,0,1,23,7,22,21,
+20,6,35,34,38,53,52,55,38,53,52,54,36,51,50,4,18,21,20,7,19,7,3,54,54,53,
+52,2,35,34,6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,53,52,39,7,39,3,76,
+102,102,92,186,156,175,198,9,154,145,1,12,181,189,1,17,142,121,207,123,236,
+73,59,237,220,142,209,112,74,48,97,84,90,74,127,117,102,107,50,118,100,2,
+205,96,102,87,133,145,174,196,174,44,39,155,235,155,251,137,148,254,231,187,
+229,247,254,238,86,1,80,139,223,127,231,1,7,103,193,122,146,103,77,74,105,
+62,126,80,114,126,107,82,86,51,119,95,0,1,0,76,255,170,5,88,5,86,0,68,0,0,
+1,23,7,22,21,20,6,35,34,38,53,52,55,38,53,52,54,36,51,50,4,22,21,20,7,22,
+22,21,20,6,7,23,7,3,55,54,54,53,52,38,35,35,54,53,52,38,35,34,6,6,21,20,23,
+54,55,23,6,6,21,20,22,51,50,54,53,52,39,7,39,3,76,102,102,92,186,156,175,
+198,9,154,146,1,7,170,174,1,3,141,17,74,82,99,112,174,119,217,60,95,87,100,
+88,7,50,235,200,137,200,107,74,48,97,84,90,74,127,117,102,107,50,118,100,
+2,205,96,102,87,133,145,174,196,174,44,39,155,235,154,252,137,140,254,161,
+78,61,26,116,75,94,115,31,217,84,1,57,84,15,66,61,66,71,101,112,192,238,105,
+193,118,148,103,77,74,105,62,126,80,114,126,107,82,86,51,119,95,0,2,0,76,
+255,170,5,80,5,86,0,54,0,66,0,0,1,38,17,52,54,36,51,50,4,22,21,20,7,22,22,
+21,20,6,7,23,7,3,55,54,54,53,52,38,35,35,54,53,52,38,35,34,6,21,20,23,54,
+54,51,50,22,22,21,20,6,35,34,38,38,53,52,37,34,6,21,20,22,51,50,54,53,52,
+38,1,6,186,143,1,5,169,173,1,3,140,17,74,82,100,111,174,119,217,60,94,88,
+100,89,6,49,233,199,204,234,107,47,144,87,94,157,91,190,152,98,162,84,1,86,
+92,117,120,91,91,118,119,1,147,162,1,2,152,253,138,140,254,161,78,61,26,116,
+75,95,115,31,216,84,1,57,84,15,66,61,66,71,98,115,192,238,234,182,178,113,
+65,66,83,156,103,148,187,86,160,96,43,167,120,93,97,118,118,93,96,121,0,0,
+2,0,61,255,236,3,242,5,86,0,51,0,62,0,0,37,38,53,52,54,51,50,22,21,20,6,35,
+34,38,53,52,54,54,55,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,
+22,21,20,6,7,7,14,2,21,20,22,51,55,54,54,53,52,38,35,34,6,21,20,2,40,73,147,
+119,122,143,246,225,233,245,76,166,168,18,72,103,57,115,102,102,132,41,131,
+47,206,161,161,197,165,183,18,112,115,64,171,167,149,95,98,72,59,65,77,104,
+94,115,107,141,143,113,141,184,198,174,96,155,121,56,6,24,56,88,70,96,117,
+118,101,82,76,29,94,101,155,185,189,145,140,175,60,6,37,74,108,74,123,131,
+14,21,96,70,61,74,76,65,95,0,0,1,0,0,0,0,4,166,5,66,0,26,0,0,33,35,36,0,39,
+55,22,0,23,38,53,17,6,6,7,22,22,21,20,35,34,38,53,52,0,55,51,4,166,150,254,
+196,253,231,187,111,179,2,28,226,3,137,171,10,41,43,100,55,66,1,0,221,115,
+230,1,237,227,84,221,254,13,160,48,138,3,99,28,168,101,6,51,38,94,90,66,157,
+1,14,42,0,0,1,0,0,0,0,6,150,7,25,0,67,0,0,1,22,51,50,55,17,54,54,53,52,35,
+34,6,7,6,35,34,38,39,55,22,22,51,50,54,55,54,51,50,22,21,20,6,7,17,35,17,
+6,35,34,39,17,35,36,0,39,55,22,0,23,38,53,17,6,6,7,22,22,21,20,35,34,38,53,
+52,0,55,51,4,166,48,58,66,57,66,63,116,35,93,92,163,95,125,130,42,111,34,
+76,58,54,109,75,150,116,120,126,67,63,137,63,60,55,51,150,254,196,253,231,
+187,111,179,2,28,226,3,137,171,10,41,43,100,55,66,1,0,221,115,3,21,23,37,
+2,129,36,69,42,95,22,28,51,81,81,68,56,43,25,26,50,107,100,63,102,32,250,
+123,2,163,30,20,253,103,230,1,237,227,84,221,254,13,160,48,138,3,99,28,168,
+101,6,51,38,94,90,66,157,1,14,42,0,0,1,0,94,255,236,4,221,6,4,0,55,0,0,1,
+54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,22,
+22,21,20,6,35,34,36,2,53,52,18,55,23,6,2,21,20,18,22,51,50,54,54,53,52,38,
+35,34,7,2,88,75,85,173,154,111,91,105,116,41,132,47,200,155,153,191,114,124,
+122,136,252,231,199,254,207,164,208,198,86,172,181,127,239,161,109,155,82,
+130,114,110,88,2,178,28,25,49,131,111,87,116,107,88,86,65,29,88,97,145,174,
+187,137,121,154,58,31,176,121,189,212,178,1,76,225,242,1,170,157,100,133,
+254,143,223,176,254,236,150,62,122,82,111,122,41,0,0,1,0,94,255,236,6,147,
+7,25,0,96,0,0,1,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,
+22,21,20,6,7,22,23,22,51,50,55,17,54,54,53,52,35,34,6,7,6,35,34,38,39,55,
+22,22,51,50,54,55,54,51,50,22,21,20,6,7,17,35,17,6,35,34,39,22,21,20,6,35,
+34,36,2,53,52,18,55,23,6,2,21,20,18,22,51,50,54,54,53,52,38,35,34,7,2,88,
+75,85,173,154,111,91,105,116,41,132,47,200,155,153,191,114,124,95,61,65,82,
+67,60,66,63,116,36,95,89,163,95,125,130,42,111,34,76,58,54,109,75,150,116,
+120,125,67,62,137,64,63,26,29,10,252,231,199,254,207,164,208,198,86,172,181,
+127,239,161,109,155,82,130,114,110,88,2,178,28,25,49,131,111,87,116,107,88,
+86,65,29,88,97,145,174,187,137,121,154,58,24,58,45,39,3,55,36,69,42,95,23,
+27,51,81,81,68,56,43,25,26,50,106,101,64,102,31,250,123,1,237,32,5,37,48,
+189,212,178,1,76,225,242,1,170,157,100,133,254,143,223,176,254,236,150,62,
+122,82,111,122,41,0,0,2,0,76,0,0,4,254,5,86,0,51,0,61,0,0,1,54,53,52,38,38,
+35,34,6,6,21,20,23,54,51,50,22,23,54,51,50,22,21,17,35,17,52,35,34,21,17,
+35,53,6,35,34,38,53,52,55,38,53,52,18,36,51,50,4,18,21,20,7,37,34,6,21,20,
+51,50,54,53,52,4,35,78,116,210,135,147,212,104,30,71,118,62,93,23,64,110,
+101,119,136,98,94,135,43,80,110,132,2,102,148,1,17,177,178,1,19,151,98,253,
+14,57,64,123,58,63,2,12,113,149,129,207,111,122,197,109,101,78,91,50,46,96,
+123,115,254,33,1,199,143,143,254,57,203,51,155,133,28,12,130,197,153,1,2,
+148,143,254,248,168,180,146,133,86,72,170,88,76,164,0,2,0,76,255,236,4,199,
+5,78,0,50,0,62,0,0,19,38,53,52,54,54,51,50,23,23,6,6,21,20,22,51,50,55,17,
+51,17,35,17,6,35,34,38,53,52,55,35,34,6,6,21,20,22,23,54,51,50,22,21,20,6,
+35,34,38,38,53,52,37,34,6,21,20,22,51,50,54,53,52,38,240,164,138,254,167,
+48,52,99,40,38,104,78,91,56,138,138,62,87,140,173,31,15,128,194,104,46,49,
+97,164,148,194,190,152,98,162,84,1,86,92,117,121,90,91,118,119,1,172,158,
+237,148,248,139,4,45,62,106,66,85,109,53,1,156,250,190,3,20,32,171,148,83,
+71,105,188,115,84,128,61,109,189,153,148,187,86,160,96,60,150,120,93,96,119,
+119,92,96,121,0,2,0,76,255,236,4,193,5,86,0,37,0,49,0,0,19,38,53,52,54,36,
+51,50,22,23,39,51,17,35,17,38,38,35,34,6,6,21,20,22,23,54,51,50,22,21,20,
+6,35,34,38,38,53,52,37,34,6,21,20,22,51,50,54,53,52,38,240,164,140,1,1,164,
+136,213,95,2,138,138,81,221,132,130,196,106,46,49,97,164,148,194,190,152,
+98,162,84,1,86,92,117,121,90,91,118,119,1,172,158,237,148,254,141,96,106,
+182,250,190,3,203,130,132,105,190,117,84,128,61,109,189,153,148,187,86,160,
+96,60,150,120,93,96,119,119,92,96,121,0,2,0,76,255,236,4,178,5,86,0,23,0,
+53,0,0,33,55,6,35,34,39,6,35,34,38,53,52,55,38,17,52,54,54,51,32,23,39,51,
+17,39,17,38,38,35,34,6,6,21,20,22,23,54,55,23,6,21,20,51,50,53,53,51,21,20,
+22,22,51,50,54,4,41,3,68,95,120,48,70,130,125,152,8,192,141,254,162,1,13,
+164,1,137,137,70,222,134,128,193,105,49,57,60,127,84,195,152,125,135,15,53,
+45,49,67,65,85,109,109,184,151,52,36,163,1,1,149,252,142,193,173,250,190,
+214,2,255,121,131,108,190,114,87,134,63,108,88,100,128,194,205,162,201,174,
+71,76,42,51,0,2,0,76,255,236,5,137,5,86,0,59,0,71,0,0,1,7,39,1,23,7,22,21,
+20,6,35,34,38,53,52,55,38,53,52,54,36,51,50,23,54,51,50,22,21,20,6,35,34,
+38,38,53,52,55,38,35,34,6,21,20,22,23,54,55,23,6,6,21,20,22,51,50,54,54,53,
+52,1,34,6,21,20,22,51,50,54,53,52,38,3,1,118,100,1,51,103,102,91,186,156,
+175,197,6,166,145,1,9,173,178,131,74,103,117,155,150,122,75,125,73,18,98,
+130,210,239,40,41,51,101,84,89,74,127,116,67,94,48,1,70,65,79,83,61,63,80,
+81,1,173,118,95,1,55,96,102,90,130,145,174,196,174,36,33,163,241,153,252,
+138,76,56,151,120,117,149,64,123,83,55,48,51,233,179,84,127,54,85,76,105,
+61,127,80,113,127,48,88,53,86,3,78,84,64,67,80,82,63,66,84,0,2,0,76,255,236,
+4,201,5,86,0,40,0,52,0,0,1,38,53,52,54,36,51,50,4,22,21,20,6,7,39,54,53,52,
+38,35,34,6,6,21,20,23,54,54,51,50,22,22,21,20,6,35,34,38,38,53,52,37,34,6,
+21,20,22,51,50,54,53,52,38,1,5,185,140,1,5,170,173,1,7,142,66,59,123,106,
+236,198,133,196,107,107,47,144,87,94,157,91,190,152,98,162,84,1,86,92,117,
+120,91,91,118,119,1,146,166,255,150,252,141,140,255,160,105,199,75,66,136,
+169,191,239,104,192,120,178,113,65,66,83,156,103,148,187,86,160,96,48,162,
+120,93,97,118,118,93,96,121,0,0,4,0,76,255,236,4,217,5,86,0,54,0,66,0,78,
+0,90,0,0,37,6,6,35,34,38,53,52,55,38,35,55,22,23,38,39,38,53,52,54,54,51,
+50,4,22,21,20,7,39,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,7,22,
+22,21,20,6,35,34,38,3,34,6,21,20,22,51,50,54,53,52,38,3,22,22,51,50,54,53,
+52,38,35,34,6,7,38,38,35,34,6,21,20,22,51,50,54,2,122,73,135,82,98,131,90,
+46,44,18,101,96,21,3,230,139,253,163,187,1,20,147,51,127,37,247,214,201,225,
+113,36,164,111,142,188,32,99,119,128,101,82,135,72,87,112,114,87,86,113,113,
+16,57,90,51,56,65,66,61,51,89,199,58,86,47,62,65,65,55,51,91,123,77,66,120,
+97,116,50,6,120,8,49,45,50,143,245,125,210,116,138,254,163,129,123,53,87,
+104,193,237,181,145,146,86,92,103,178,139,73,61,6,120,92,98,123,65,2,188,
+111,87,92,111,112,85,90,114,253,230,61,46,58,49,53,57,49,61,66,44,57,53,49,
+58,46,0,0,1,0,76,255,236,4,254,5,86,0,61,0,0,1,54,53,52,38,38,35,34,6,6,21,
+20,23,54,55,23,6,6,21,20,22,51,50,54,55,38,53,52,54,51,50,23,17,35,17,35,
+34,6,21,20,23,21,20,6,35,34,38,53,52,55,38,53,52,18,36,51,50,4,18,21,20,7,
+4,35,78,116,210,135,147,212,104,62,57,88,84,94,86,75,72,59,70,6,102,181,167,
+67,72,135,16,99,104,102,143,129,130,149,23,135,148,1,17,177,178,1,19,151,
+98,2,12,113,149,129,207,111,122,197,109,134,103,84,65,105,66,148,93,99,102,
+58,54,69,121,119,132,12,253,123,2,23,69,60,95,30,15,136,150,175,152,70,65,
+157,208,153,1,2,148,143,254,248,168,180,146,0,0,2,0,76,255,236,4,248,5,78,
+0,58,0,70,0,0,37,5,7,39,6,6,35,34,38,38,53,52,55,38,53,52,54,54,51,50,23,
+23,6,6,21,20,22,51,50,54,53,52,39,55,22,22,21,20,6,35,34,38,53,52,55,35,34,
+6,6,21,20,22,23,54,51,50,22,21,20,37,34,6,21,20,22,51,50,54,53,52,38,3,137,
+1,6,73,241,46,147,91,98,162,84,15,164,138,254,167,48,52,99,40,38,103,87,89,
+100,88,120,60,45,176,150,146,177,31,15,128,194,104,46,49,97,164,148,194,254,
+168,92,117,121,90,91,118,119,245,130,135,138,67,71,86,160,96,60,46,158,237,
+148,248,139,4,45,62,106,66,87,107,105,81,122,81,76,74,131,76,136,173,173,
+146,83,71,105,188,115,84,128,61,109,189,153,37,254,120,93,96,119,119,92,96,
+121,0,0,2,0,84,255,236,4,233,5,86,0,57,0,92,0,0,1,22,22,21,20,4,33,34,36,
+38,53,52,55,38,53,52,55,23,6,21,20,22,51,50,54,53,52,35,34,6,21,21,35,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,5,38,
+39,6,21,20,22,51,50,54,53,52,38,35,34,6,6,21,21,35,53,52,39,38,35,34,6,6,
+21,20,23,7,38,53,52,4,67,80,86,254,209,254,240,188,254,244,142,103,60,63,
+125,53,216,216,209,199,125,57,60,129,51,53,43,64,41,119,51,133,90,62,86,34,
+31,102,62,109,139,252,219,89,62,62,235,224,212,228,81,66,38,47,24,129,33,
+25,50,31,53,33,45,121,53,3,0,34,157,112,230,255,127,242,155,209,161,97,125,
+143,127,41,100,121,160,164,139,150,178,65,90,166,166,85,70,61,62,80,96,37,
+112,107,104,132,47,48,45,50,153,138,206,180,30,48,103,150,189,214,183,171,
+102,117,28,67,57,202,182,97,32,33,31,65,48,75,103,37,116,108,89,0,0,2,0,76,
+255,236,4,172,5,86,0,39,0,51,0,0,1,38,38,53,52,54,54,51,50,22,23,39,51,17,
+35,53,38,38,35,34,6,6,21,20,23,54,54,51,50,22,22,21,20,6,35,34,38,38,53,52,
+37,34,6,21,20,22,51,50,54,53,52,38,1,7,97,90,138,253,164,136,204,89,1,137,
+137,81,214,123,129,193,106,108,49,142,86,94,157,91,190,152,98,162,84,1,86,
+92,117,120,91,91,118,119,1,149,91,205,122,150,251,142,91,102,173,253,155,
+255,121,124,102,190,120,173,117,62,64,83,156,103,148,187,86,160,96,43,167,
+120,93,97,118,118,93,96,121,0,0,2,0,84,255,236,5,102,5,86,0,13,0,25,0,0,5,
+34,36,2,53,52,18,36,51,32,0,17,16,0,1,34,0,17,16,0,51,50,0,17,16,0,2,219,
+203,254,220,152,160,1,37,194,1,51,1,88,254,169,254,208,233,254,237,1,11,241,
+234,1,14,254,246,20,168,1,58,212,213,1,57,166,254,141,254,189,254,183,254,
+149,4,229,254,207,254,254,254,247,254,220,1,43,1,4,1,10,1,39,0,1,0,76,255,
+236,4,217,5,86,0,55,0,0,1,7,39,1,23,7,22,21,20,6,35,34,38,53,52,55,38,53,
+52,54,36,51,50,4,22,21,20,6,7,39,54,54,53,52,38,35,34,6,6,21,20,23,54,55,
+23,6,6,21,20,22,51,50,54,54,53,52,3,1,118,100,1,51,103,102,91,186,156,175,
+197,6,166,145,1,9,173,175,1,8,143,64,61,123,59,48,236,202,138,202,109,81,
+51,101,84,89,74,127,116,67,94,48,1,173,118,95,1,55,96,102,90,130,145,174,
+196,174,37,33,160,243,153,252,138,140,254,161,103,198,78,66,76,146,83,192,
+238,103,193,120,157,104,85,76,105,61,127,80,113,127,48,88,53,86,0,2,0,76,
+255,199,4,217,5,86,0,58,0,69,0,0,1,54,53,52,38,35,34,6,6,21,20,23,54,55,23,
+6,6,21,20,22,51,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,7,38,39,6,35,
+34,38,53,52,55,38,53,52,54,36,51,50,4,22,21,20,7,1,54,53,52,38,35,34,6,21,
+20,22,3,246,86,236,202,138,202,109,81,51,101,84,87,76,126,115,17,9,8,138,
+136,108,116,131,54,49,14,83,61,74,66,82,100,172,198,6,166,145,1,9,173,175,
+1,8,143,104,254,150,95,67,55,52,67,70,2,6,116,169,192,238,103,193,120,157,
+104,85,76,105,60,128,80,115,127,1,102,147,95,133,140,116,65,123,48,6,31,108,
+36,35,34,198,172,37,33,160,243,153,252,138,140,254,161,208,150,254,204,61,
+124,64,73,62,53,65,98,0,0,2,0,82,255,236,4,172,5,86,0,45,0,55,0,0,33,17,38,
+38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,7,54,51,50,22,22,21,20,6,35,
+34,2,17,52,54,55,38,53,52,54,51,50,22,23,39,51,17,1,18,33,50,54,53,52,38,
+35,34,4,35,77,198,106,110,109,5,37,52,137,107,56,88,102,154,169,8,138,131,
+100,168,93,170,162,197,239,131,123,14,181,156,121,194,86,1,137,252,51,32,
+1,1,98,103,127,113,128,3,230,114,121,91,79,31,23,7,47,121,37,173,164,38,73,
+136,94,142,161,1,18,1,4,165,236,57,53,52,123,166,86,92,158,250,190,1,167,
+254,200,87,76,88,97,0,0,1,0,76,255,236,4,217,5,86,0,58,0,0,1,54,53,52,38,
+35,34,6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,53,52,39,6,35,34,38,53,
+52,54,51,50,22,22,21,20,6,6,35,34,38,53,52,55,38,53,52,54,36,51,50,4,22,21,
+20,7,3,246,86,236,202,138,202,109,81,51,101,84,89,74,125,114,120,120,24,20,
+26,43,57,57,47,54,90,55,88,169,116,172,198,6,166,145,1,9,173,175,1,8,143,
+104,2,6,116,169,192,238,103,193,120,157,104,85,76,105,61,127,80,112,128,129,
+111,72,58,5,51,39,42,56,69,144,102,99,170,93,198,172,37,33,160,243,153,252,
+138,140,254,161,208,150,0,0,1,0,61,255,236,4,135,5,86,0,50,0,0,1,17,35,55,
+6,4,35,34,38,53,52,54,54,55,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,
+54,51,50,22,21,20,6,7,7,14,2,21,20,22,51,50,36,55,17,4,135,137,4,105,254,
+231,161,201,217,76,166,168,18,72,103,57,115,102,102,132,41,131,47,206,161,
+161,197,165,183,18,112,115,64,146,136,162,1,5,116,5,66,250,190,244,129,135,
+202,170,96,155,121,56,6,24,56,88,70,96,117,118,101,82,76,29,94,101,155,185,
+189,145,140,175,60,6,37,74,108,74,118,129,153,157,3,157,0,1,0,76,0,0,4,199,
+5,86,0,46,0,0,33,53,6,35,34,38,39,38,53,52,54,36,51,50,4,22,21,20,6,7,39,
+54,53,52,38,35,34,6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,17,51,17,
+2,246,86,117,131,169,1,178,145,1,3,167,173,1,5,142,67,58,123,106,234,202,
+132,196,104,78,44,107,84,78,63,99,81,64,90,39,135,184,69,161,134,160,253,
+153,253,137,141,255,159,104,200,75,66,136,169,193,237,107,193,116,154,104,
+80,78,105,49,94,57,78,94,44,47,1,58,253,123,0,0,1,0,72,255,236,4,41,5,86,
+0,26,0,0,1,17,35,55,6,35,34,38,53,52,54,55,1,55,1,7,39,6,6,21,20,22,51,50,
+54,55,17,4,41,137,3,156,232,218,253,178,162,254,213,114,2,4,104,150,140,140,
+179,155,122,180,83,5,66,250,190,156,176,244,216,142,234,68,1,152,74,253,49,
+72,204,54,178,117,146,173,106,114,3,247,0,1,0,76,255,242,4,199,5,86,0,47,
+0,0,33,17,35,34,6,7,50,22,21,20,6,35,34,38,53,52,55,38,17,52,54,36,51,50,
+4,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,23,54,54,51,50,23,17,2,246,
+15,167,221,15,46,56,58,50,62,67,63,192,145,1,3,167,173,1,5,142,67,58,123,
+106,234,202,132,196,104,133,77,208,114,77,71,2,16,194,158,50,44,46,50,94,
+67,137,114,164,1,5,153,253,137,141,255,159,104,200,75,66,136,169,193,237,
+107,193,116,200,117,76,81,12,253,123,0,2,0,76,255,236,4,178,5,86,0,19,0,41,
+0,0,33,55,6,6,35,34,38,39,38,38,53,52,54,54,51,32,23,39,51,17,3,17,38,38,
+35,34,6,6,21,20,22,23,54,55,23,6,21,20,22,51,50,54,4,41,1,71,161,103,191,
+230,7,110,117,141,254,162,1,13,164,1,137,137,70,222,134,128,193,105,53,60,
+43,114,97,142,155,132,113,166,128,76,72,210,186,79,228,140,149,252,142,193,
+173,250,190,1,57,2,156,121,131,108,190,114,91,136,64,116,87,86,97,155,131,
+153,99,0,0,3,0,76,255,236,6,43,5,86,0,30,0,52,0,64,0,0,33,55,6,6,35,34,38,
+39,38,38,53,52,54,54,51,32,23,39,51,7,54,51,50,22,21,20,6,35,34,39,17,3,17,
+38,38,35,34,6,6,21,20,22,23,54,55,23,6,21,20,22,51,50,54,1,34,6,21,20,22,
+51,50,54,53,52,38,4,41,1,71,161,103,191,230,7,110,117,142,253,158,1,18,163,
+1,137,3,53,81,106,140,138,106,79,54,137,71,221,132,128,193,107,53,60,43,114,
+97,142,155,132,113,166,1,67,60,69,73,56,59,70,71,128,76,72,210,186,79,228,
+140,150,253,140,193,173,44,44,138,114,107,137,46,252,128,1,57,2,156,122,130,
+106,191,115,91,136,64,116,87,86,94,158,131,153,99,3,253,73,60,61,72,72,61,
+59,74,0,0,2,0,76,0,0,4,201,5,86,0,42,0,54,0,0,33,53,52,55,6,35,34,38,39,38,
+38,53,52,54,36,51,50,4,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,23,54,
+54,51,50,22,22,21,17,1,34,6,21,20,22,51,50,54,53,52,38,2,248,1,64,117,103,
+155,18,109,119,145,1,3,167,173,1,7,142,67,58,123,106,236,202,132,196,104,
+101,32,154,98,84,137,76,254,211,75,93,85,83,77,91,93,177,19,19,65,115,105,
+73,240,140,153,253,137,140,255,160,104,200,75,66,136,169,192,238,107,193,
+116,168,118,88,98,70,140,101,254,106,2,82,90,72,77,83,86,70,77,89,0,0,1,0,
+76,255,170,5,104,5,86,0,63,0,0,37,6,35,34,38,53,52,55,23,6,21,20,51,50,55,
+52,55,17,51,21,20,6,35,34,38,53,52,55,38,53,52,18,36,51,32,0,17,20,7,19,7,
+3,54,54,53,52,2,35,34,6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,3,43,17,30,
+96,127,30,123,24,108,31,24,1,131,190,175,174,209,5,146,147,1,19,184,1,36,
+1,68,120,206,122,236,71,60,244,225,145,215,115,61,43,84,86,71,68,138,116,
+159,235,4,129,115,96,86,16,79,77,139,6,9,9,1,19,235,212,218,206,168,40,26,
+157,234,156,1,1,142,254,183,254,225,230,246,254,238,86,1,80,137,225,127,233,
+1,5,105,197,124,137,102,75,74,88,60,127,82,120,136,0,1,0,76,255,242,4,178,
+5,86,0,39,0,0,1,6,6,7,22,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,54,51,
+32,23,39,51,17,35,17,38,38,35,34,6,6,21,20,23,54,37,3,61,199,248,19,46,54,
+57,52,61,68,63,103,109,141,254,162,1,13,164,1,137,137,71,221,132,128,193,
+107,154,161,1,0,2,100,48,233,153,3,53,40,46,50,94,72,120,115,79,222,135,149,
+252,142,193,173,250,190,3,213,122,130,106,191,115,207,114,182,59,0,2,0,31,
+255,236,4,250,5,86,0,34,0,55,0,0,33,55,6,6,35,34,38,53,52,55,6,7,22,21,20,
+6,35,34,38,53,52,54,54,55,38,53,52,54,54,51,32,23,39,51,17,1,6,6,21,20,22,
+51,50,54,55,17,38,38,35,34,6,6,21,20,23,55,4,113,1,69,162,104,192,234,6,126,
+61,60,59,47,54,65,32,98,97,111,141,255,162,1,15,162,1,137,253,151,77,70,155,
+132,113,166,61,70,222,134,127,193,106,75,209,129,76,73,224,175,30,27,109,
+76,22,65,47,51,67,55,36,73,109,83,145,189,149,252,142,193,173,250,190,2,133,
+55,124,91,118,146,99,103,2,156,121,131,107,191,114,146,100,166,0,2,0,76,255,
+170,5,61,5,86,0,42,0,54,0,0,19,38,38,53,52,18,36,51,50,4,18,21,20,7,19,7,
+3,54,54,53,52,2,35,34,6,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,
+52,37,34,6,21,20,22,51,50,54,53,52,38,234,77,81,144,1,10,176,183,1,11,143,
+120,206,122,236,71,60,234,214,137,205,111,85,47,139,85,148,194,190,152,98,
+162,84,1,86,92,117,121,90,91,118,119,1,151,77,207,120,157,1,0,142,146,254,
+231,189,230,246,254,238,86,1,80,137,225,127,230,1,8,106,198,122,160,113,60,
+63,189,153,148,187,86,160,96,46,164,120,93,96,119,119,92,96,121,0,0,1,0,76,
+255,170,5,158,5,86,0,55,0,0,19,54,51,50,23,54,51,50,22,21,17,35,17,52,35,
+34,21,17,35,17,52,35,34,21,20,22,23,7,38,53,52,55,38,53,52,18,36,51,32,0,
+17,20,7,19,7,3,54,54,53,52,0,35,34,6,21,20,255,62,129,109,60,65,106,98,117,
+135,92,98,135,84,117,29,26,131,59,4,133,148,1,28,192,1,63,1,77,121,207,123,
+236,71,60,254,250,254,226,255,2,92,113,88,88,120,118,254,33,1,199,143,137,
+254,51,1,225,117,246,76,191,75,24,190,186,51,27,152,219,159,1,0,140,254,184,
+254,213,216,249,254,238,86,1,80,136,224,121,244,1,2,237,189,116,0,0,1,0,76,
+255,242,4,254,5,86,0,56,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,51,50,
+23,54,51,50,22,21,17,35,17,52,35,34,21,17,35,17,52,35,34,21,20,22,23,7,38,
+38,53,52,55,38,53,52,18,36,51,50,4,18,21,20,7,4,35,78,116,210,135,147,212,
+104,48,63,137,108,60,65,107,100,115,135,93,98,135,84,117,30,26,131,28,32,
+3,146,148,1,17,177,178,1,19,151,98,2,12,113,149,129,207,111,122,197,109,127,
+88,127,88,88,122,116,254,33,1,199,143,137,254,51,1,225,117,246,77,188,77,
+24,88,202,86,35,31,156,223,153,1,2,148,143,254,248,168,180,146,0,0,3,0,76,
+0,0,4,201,5,86,0,42,0,54,0,66,0,0,33,53,52,55,6,35,34,38,39,38,38,53,52,54,
+36,51,50,4,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,23,54,54,51,50,22,
+22,21,17,1,34,6,21,20,22,51,50,54,53,52,38,7,34,38,53,52,54,51,50,22,21,20,
+6,2,248,1,64,117,103,155,18,109,119,145,1,3,167,173,1,7,142,67,58,123,106,
+236,202,132,196,104,101,32,154,98,84,137,76,254,211,75,93,85,83,77,91,93,
+75,36,48,49,37,35,47,48,177,19,19,65,115,105,73,240,140,153,253,137,140,255,
+160,104,200,75,66,136,169,192,238,107,193,116,168,118,88,98,70,140,101,254,
+106,2,82,90,72,77,83,86,70,77,89,242,46,36,35,47,47,35,37,45,0,2,0,61,255,
+236,4,199,5,86,0,47,0,59,0,0,19,38,53,52,54,55,53,52,54,51,50,22,23,39,51,
+17,35,17,38,38,35,34,6,7,22,23,7,38,35,34,6,21,20,23,54,54,51,50,22,21,20,
+6,35,34,38,38,53,52,37,34,6,21,20,22,51,50,54,53,52,38,228,167,153,134,182,
+156,120,194,86,1,138,138,77,197,106,105,113,2,158,125,98,89,124,120,138,80,
+48,149,91,148,194,190,152,98,162,84,1,86,92,117,121,90,91,118,119,1,129,125,
+192,134,190,29,22,124,165,86,91,157,250,190,3,230,113,122,85,82,9,121,94,
+96,133,103,116,70,69,72,189,153,148,187,86,160,96,37,173,120,93,96,119,118,
+93,96,121,0,0,4,0,76,255,236,4,203,5,86,0,17,0,26,0,37,0,46,0,0,33,55,6,35,
+34,38,39,38,17,52,54,36,51,32,23,39,51,17,1,22,23,17,2,33,34,7,23,1,54,54,
+55,39,38,39,6,6,21,20,1,1,6,6,21,20,22,51,50,4,66,1,144,212,195,228,8,228,
+145,1,3,165,1,23,167,1,137,254,219,137,19,155,254,222,110,85,136,254,252,
+30,135,92,110,65,66,61,68,3,21,254,168,107,113,156,139,154,140,160,206,190,
+162,1,29,152,252,139,213,193,250,190,2,18,190,31,2,135,1,21,37,184,254,31,
+82,139,42,150,88,96,55,159,93,175,254,88,1,213,47,151,98,132,152,0,0,2,0,
+76,0,0,4,168,5,86,0,14,0,29,0,0,33,37,39,55,38,17,52,54,54,51,32,23,39,51,
+17,1,5,17,38,38,35,34,6,6,21,20,22,23,1,23,4,31,252,182,31,121,227,143,252,
+158,1,11,160,1,137,252,207,2,168,73,214,133,126,191,105,89,93,1,6,97,219,
+84,118,138,1,19,145,248,139,185,165,250,190,1,58,183,3,92,120,122,107,189,
+110,115,149,51,1,0,94,0,0,1,0,76,255,127,4,170,5,86,0,53,0,0,37,53,6,35,34,
+39,7,5,7,37,39,55,38,39,38,17,52,54,54,51,50,4,22,21,20,6,7,39,54,53,52,38,
+35,34,6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,17,51,17,2,221,78,106,
+53,47,127,2,210,28,252,196,36,189,55,13,197,141,251,159,171,1,0,140,59,56,
+125,99,228,198,133,189,92,78,38,122,84,72,62,90,72,53,81,36,135,190,129,65,
+15,135,144,119,164,90,211,58,87,134,1,8,142,224,121,138,255,162,98,192,77,
+64,127,168,193,237,103,167,97,152,77,95,85,106,42,85,52,71,82,43,47,1,18,
+253,215,0,0,1,253,74,254,104,254,35,255,70,0,11,0,0,1,34,38,53,52,54,51,50,
+22,21,20,6,253,182,43,65,64,44,44,65,63,254,104,64,47,46,65,65,46,48,63,0,
+0,1,0,59,255,236,2,172,5,86,0,12,0,0,37,7,1,53,1,1,53,1,23,5,1,21,1,2,172,
+68,253,211,1,168,254,88,2,45,68,254,51,1,168,254,90,98,118,1,53,96,1,33,1,
+31,96,1,53,119,245,254,227,86,254,225,0,1,0,125,0,0,1,6,5,66,0,3,0,0,1,17,
+35,17,1,6,137,5,66,250,190,5,66,0,0,1,251,35,5,145,255,176,6,227,0,13,0,0,
+1,54,36,51,50,4,23,7,38,38,35,34,6,7,251,35,151,1,22,154,153,1,14,159,92,
+131,229,132,132,237,120,5,242,129,112,107,134,97,113,94,98,109,0,1,255,252,
+0,0,1,225,5,66,0,6,0,0,1,17,35,17,5,39,37,1,225,137,254,244,80,1,108,5,66,
+250,190,4,165,192,113,236,0,2,252,238,253,203,0,215,0,35,0,30,0,41,0,0,5,
+54,53,53,55,21,20,7,30,2,51,50,54,55,23,6,35,34,38,39,6,35,34,38,53,52,54,
+51,50,22,23,38,38,35,34,6,21,20,22,51,50,254,234,18,135,45,38,63,57,41,29,
+44,21,92,72,114,70,119,67,106,191,122,140,140,103,65,122,36,64,95,53,58,65,
+69,68,129,231,74,91,66,35,123,132,102,33,44,23,27,26,84,92,64,59,143,116,
+105,104,115,47,168,53,49,55,51,53,56,0,1,253,252,253,203,1,115,0,25,0,30,
+0,0,7,35,34,21,20,22,51,50,54,54,55,22,51,50,55,23,6,35,34,38,39,6,35,34,
+38,53,52,54,55,53,55,125,61,197,68,59,51,77,84,48,153,132,33,26,23,30,58,
+64,135,64,100,180,112,144,140,116,135,221,119,49,60,30,75,68,140,8,122,15,
+56,54,130,121,108,94,118,7,117,25,0,1,254,88,253,203,0,174,0,66,0,28,0,0,
+7,54,51,50,22,21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,53,52,38,
+35,34,7,123,51,62,84,100,141,135,150,172,109,133,84,114,79,101,94,147,42,
+34,34,27,197,25,101,77,102,113,147,127,92,169,96,99,83,115,66,75,79,93,36,
+37,12,0,0,1,254,106,253,74,0,188,0,109,0,40,0,0,5,38,38,53,52,54,55,23,6,
+6,21,20,22,51,51,7,6,21,20,22,51,50,53,52,38,35,34,7,39,54,51,50,22,21,20,
+6,35,34,38,53,52,254,245,65,74,117,115,49,75,72,81,72,29,8,162,96,88,142,
+42,34,35,27,37,54,59,84,100,137,131,140,173,246,19,85,54,76,94,27,109,10,
+41,37,43,43,115,25,126,67,75,78,29,33,13,101,24,94,72,94,104,137,111,133,
+0,2,0,90,255,236,3,182,5,86,0,24,0,35,0,0,1,7,38,35,34,2,3,54,51,50,22,22,
+21,20,6,35,34,38,2,53,52,18,36,51,50,1,22,22,51,50,54,53,52,38,35,34,3,182,
+67,88,127,196,237,8,149,132,114,193,105,182,177,143,216,112,142,1,12,172,
+160,253,166,13,163,147,113,114,149,131,147,5,16,110,47,254,226,254,249,35,
+85,167,117,175,195,154,1,46,215,225,1,65,169,252,214,217,226,118,107,121,
+131,0,255,255,0,90,255,236,6,117,7,25,0,34,0,62,0,0,0,35,0,67,6,113,0,0,0,
+3,0,53,6,193,3,152,255,255,0,90,255,236,6,31,5,86,0,34,0,62,0,0,0,35,0,55,
+5,25,0,0,0,3,0,53,6,193,3,152,255,255,0,90,255,236,6,160,7,25,0,34,0,62,0,
+0,0,35,0,68,5,25,0,0,0,3,0,53,6,193,3,152,0,1,254,203,253,205,0,109,255,182,
+0,3,0,0,5,55,1,7,254,203,108,1,54,109,156,82,254,101,78,0,0,1,252,0,5,111,
+0,4,7,25,0,28,0,0,3,54,54,53,52,35,34,6,7,6,35,34,38,39,55,22,22,51,50,54,
+55,54,51,50,22,21,20,6,7,231,55,43,117,34,94,91,162,96,125,130,42,111,35,
+75,58,53,107,78,149,116,123,123,68,81,5,178,38,59,36,95,22,28,51,81,81,68,
+57,42,24,27,50,109,98,68,102,49,0,1,253,131,0,0,1,135,7,25,0,30,0,0,51,17,
+54,54,53,52,35,34,6,7,6,35,34,38,39,55,22,22,51,50,54,55,54,51,50,22,21,20,
+6,7,17,125,66,63,117,34,94,91,162,96,125,130,42,111,35,75,58,53,107,78,149,
+116,120,126,67,62,5,164,36,69,42,95,22,28,51,81,81,68,57,42,24,27,50,107,
+100,64,102,31,250,123,255,255,0,76,254,104,4,217,5,86,2,34,0,31,0,0,0,3,0,
+53,4,190,0,0,255,255,0,76,254,104,4,217,5,86,2,34,0,32,0,0,0,3,0,53,4,182,
+0,0,0,2,0,31,254,254,6,57,5,86,0,52,0,76,0,0,1,6,7,22,21,20,6,35,34,38,53,
+52,54,54,55,38,53,52,54,54,51,32,23,39,51,17,22,22,21,20,7,23,7,37,55,23,
+54,54,53,52,38,35,34,6,7,14,2,35,34,38,53,52,1,6,6,21,20,22,51,50,54,54,55,
+54,55,17,38,38,35,34,6,6,21,20,23,55,1,134,133,61,60,59,47,54,65,32,98,97,
+111,141,255,162,1,15,162,1,137,105,126,121,209,39,254,35,33,110,72,82,73,
+50,54,77,90,67,85,101,68,145,187,1,20,74,71,116,87,55,74,64,65,99,69,70,222,
+134,127,193,106,75,209,1,186,113,78,22,65,47,51,67,55,36,73,109,83,145,189,
+149,252,142,193,173,252,48,9,132,100,130,70,56,131,143,117,28,12,77,56,59,
+66,44,81,61,51,27,198,164,51,1,0,60,147,94,116,121,23,43,61,93,22,2,116,121,
+131,107,191,114,146,100,166,0,0,2,0,76,255,10,5,80,5,86,0,65,0,77,0,0,1,38,
+17,52,54,36,51,50,4,22,21,20,7,22,21,20,7,22,22,21,20,7,23,7,3,55,54,54,53,
+52,38,35,35,55,54,54,53,52,38,35,35,54,53,52,38,35,34,6,21,20,23,54,54,51,
+50,22,22,21,20,6,35,34,38,38,53,52,37,34,6,21,20,22,51,50,54,53,52,38,1,6,
+186,143,1,5,169,173,1,3,140,10,149,138,68,70,210,140,119,184,60,96,86,83,
+73,29,9,92,84,82,74,24,34,233,199,204,234,107,47,144,87,94,157,91,190,152,
+98,162,84,1,86,92,117,120,91,91,118,119,1,147,162,1,2,152,253,138,140,254,
+161,63,43,43,136,116,43,20,89,59,153,45,163,84,1,10,84,8,48,47,49,49,115,
+8,46,48,48,51,79,103,192,238,234,182,178,113,65,66,83,156,103,148,187,86,
+160,96,43,167,120,93,97,118,118,93,96,121,0,2,0,61,254,211,3,242,5,86,0,57,
+0,69,0,0,1,38,39,6,35,34,38,53,52,54,54,55,55,62,2,53,52,38,35,34,6,21,20,
+23,7,38,53,52,54,51,50,22,21,20,6,7,7,14,2,21,20,22,23,38,53,52,54,51,50,
+22,21,20,6,7,22,23,3,54,54,53,52,38,35,34,6,21,20,22,3,33,100,99,30,33,235,
+243,76,166,168,18,72,103,57,115,102,102,132,41,131,47,206,161,161,197,165,
+183,18,112,115,64,171,160,53,147,119,122,143,138,130,69,107,251,104,110,72,
+59,65,77,31,254,211,131,152,2,196,176,96,155,121,56,6,24,56,88,70,96,117,
+118,101,82,76,29,94,101,155,185,189,145,140,175,60,6,37,74,108,74,124,129,
+1,100,109,107,141,143,113,103,162,36,96,125,1,75,19,98,74,61,74,76,65,56,
+85,0,0,2,254,8,253,25,0,188,0,12,0,48,0,58,0,0,3,38,53,52,54,51,50,22,21,
+20,6,35,32,53,52,54,54,55,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,21,20,6,7,7,14,2,21,20,22,23,54,54,53,52,35,34,6,21,20,196,17,115,
+100,86,100,168,163,254,151,56,102,100,41,99,61,67,66,73,79,17,117,23,147,
+128,120,136,90,131,139,35,44,18,94,200,86,73,74,49,49,253,136,36,43,66,88,
+90,68,91,95,219,64,82,55,30,12,29,42,36,36,40,50,45,38,27,18,51,53,87,97,
+102,84,78,92,41,44,11,30,33,21,53,52,2,4,34,36,49,38,29,30,0,2,254,8,252,
+113,0,188,0,12,0,54,0,64,0,0,17,38,39,35,34,38,53,52,54,54,55,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,7,14,2,21,20,22,23,
+38,53,52,54,51,50,22,21,20,7,22,23,39,54,54,53,52,35,34,6,21,20,105,35,3,
+179,182,56,102,100,41,96,64,67,66,73,79,17,117,23,147,128,120,136,90,131,
+74,72,58,32,89,89,12,113,102,85,101,197,43,56,174,81,77,74,45,53,252,113,
+118,50,107,112,64,82,55,30,12,28,43,36,36,40,50,45,38,27,18,51,53,87,97,102,
+84,79,92,40,23,22,27,39,28,52,52,4,39,38,69,87,93,65,143,33,50,61,213,3,34,
+37,49,41,26,27,0,2,0,74,0,166,4,74,4,168,0,14,0,27,0,0,37,34,38,38,53,52,
+54,54,51,50,22,22,21,20,0,3,34,6,6,21,20,22,51,50,54,53,52,38,2,74,156,232,
+124,128,234,150,160,233,119,254,235,235,112,168,89,199,170,166,202,198,166,
+129,236,151,149,233,128,134,233,147,235,254,235,3,125,97,175,113,175,200,
+206,173,178,203,0,2,0,186,255,242,3,236,5,86,0,19,0,30,0,0,1,22,0,5,7,36,
+0,17,52,18,54,51,50,22,22,21,20,6,35,34,39,22,51,50,54,53,52,38,35,34,6,1,
+69,12,1,52,1,64,43,254,137,254,151,116,209,128,110,166,89,207,170,179,118,
+116,148,126,144,123,98,121,171,2,224,231,254,206,80,133,99,1,142,1,49,167,
+1,9,146,90,164,106,167,200,244,113,126,110,103,126,183,0,0,2,0,168,255,242,
+3,217,5,86,0,18,0,29,0,0,55,36,0,55,6,35,34,38,53,52,54,51,50,22,18,21,16,
+0,5,1,38,38,35,34,6,21,20,22,51,50,207,1,63,1,52,12,123,178,170,207,199,165,
+127,205,121,254,153,254,136,2,80,22,172,120,98,123,145,126,148,119,81,1,50,
+230,97,200,167,163,197,141,254,251,176,254,206,254,116,100,3,129,170,182,
+126,103,110,126,0,3,0,63,0,0,4,25,5,86,0,29,0,40,0,50,0,0,1,54,54,51,50,22,
+22,21,17,35,17,52,38,35,34,6,21,17,35,17,6,35,34,38,53,52,54,54,51,50,3,53,
+52,38,35,34,6,7,54,51,50,5,22,51,50,54,53,52,38,35,34,2,83,38,107,59,80,118,
+52,138,57,66,69,62,137,68,108,126,155,84,156,96,129,8,66,61,85,108,5,85,93,
+88,254,249,22,130,68,71,71,62,77,4,247,46,49,75,136,123,251,248,4,14,101,
+96,96,95,251,236,2,35,70,228,184,150,216,111,254,69,142,101,69,167,146,61,
+184,197,68,63,57,68,0,2,0,51,255,236,4,98,5,80,0,27,0,39,0,0,1,23,6,2,7,22,
+22,21,20,6,6,35,34,38,38,53,52,54,55,38,2,39,55,22,22,23,54,54,1,6,6,21,20,
+22,51,50,54,53,52,38,3,205,149,29,200,194,143,137,92,180,127,121,178,95,138,
+145,189,199,30,150,27,169,186,190,172,254,151,135,123,135,127,120,132,120,
+5,80,25,162,254,225,138,102,183,133,96,164,90,88,163,95,136,185,102,133,1,
+30,167,25,155,244,133,134,243,253,236,88,151,98,107,118,122,101,99,151,0,
+3,0,18,255,236,4,129,5,86,0,35,0,47,0,58,0,0,1,38,38,39,55,22,23,38,53,52,
+54,51,50,22,21,20,6,7,22,22,23,7,38,38,39,22,22,21,20,6,35,34,38,53,52,54,
+37,54,54,53,52,38,35,34,6,21,20,22,23,6,21,20,22,51,50,54,53,52,38,1,157,
+137,185,73,107,121,199,134,193,158,150,181,112,120,138,184,70,106,67,148,
+103,70,65,191,161,147,187,116,1,66,125,115,106,93,96,112,82,27,243,110,95,
+95,112,79,2,137,29,99,85,82,142,49,146,148,139,180,176,146,102,170,76,29,
+100,82,82,74,88,27,78,141,74,143,176,178,143,107,170,154,69,150,91,91,104,
+112,89,82,148,190,129,182,92,104,109,91,82,147,0,1,0,74,255,238,4,53,5,86,
+0,46,0,0,23,39,36,0,17,52,38,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,38,
+39,55,22,22,51,50,54,53,52,38,38,39,38,38,53,52,54,51,50,22,18,21,16,0,178,
+45,1,174,1,117,101,176,102,65,72,58,54,97,73,149,125,122,174,58,121,43,114,
+76,65,70,23,39,55,86,75,157,117,151,237,130,254,87,18,133,85,1,51,1,19,125,
+210,118,57,41,43,62,37,64,117,71,106,129,130,132,49,93,89,60,51,29,45,35,
+38,58,108,76,102,127,152,254,247,158,254,191,254,120,0,0,2,0,84,255,238,4,
+53,5,86,0,31,0,42,0,0,23,39,36,17,52,38,35,34,6,7,54,51,50,22,21,20,6,35,
+34,38,38,53,52,54,54,51,50,22,22,21,16,0,1,22,22,51,50,54,53,52,38,35,34,
+162,45,3,51,201,164,149,196,9,106,95,118,134,143,128,91,144,80,125,220,142,
+147,230,129,254,41,254,132,12,86,69,69,70,71,64,80,18,133,163,2,39,190,216,
+183,148,79,133,117,118,138,105,188,111,139,224,122,130,247,164,254,194,254,
+81,2,195,89,92,67,64,57,68,0,1,0,240,0,0,4,16,5,66,0,5,0,0,1,21,33,17,35,
+17,4,16,253,107,139,5,66,134,251,68,5,66,0,1,0,111,255,236,4,25,5,86,0,21,
+0,0,1,7,1,6,2,21,16,0,5,7,38,36,2,53,52,18,55,1,38,53,53,51,4,25,146,254,
+155,147,147,1,48,1,40,12,224,254,182,175,230,226,1,94,6,138,3,18,26,1,168,
+93,254,251,156,254,255,254,225,19,131,6,173,1,60,193,216,1,100,126,254,81,
+69,110,232,0,0,2,0,72,0,166,4,47,4,240,0,20,0,32,0,0,1,6,2,2,14,2,35,34,2,
+3,55,22,22,51,50,62,2,18,55,1,34,38,53,52,54,51,50,22,21,20,6,4,47,45,102,
+109,106,92,87,69,157,186,46,137,35,121,102,52,83,79,87,109,57,254,78,46,69,
+69,46,45,69,67,4,205,198,254,160,254,255,155,71,30,1,53,1,39,25,249,247,55,
+115,199,1,98,242,253,194,68,49,47,70,70,47,52,65,0,0,2,0,78,0,0,4,86,5,119,
+0,64,0,76,0,0,33,53,6,35,34,38,53,52,55,38,38,53,52,55,23,6,21,20,22,51,50,
+54,53,52,38,35,34,7,39,54,55,55,62,3,53,52,38,35,34,6,21,20,23,7,38,38,53,
+52,54,51,50,22,22,21,20,6,7,22,22,21,20,7,17,3,53,6,35,34,39,6,21,20,22,51,
+50,3,80,106,156,150,164,17,104,107,176,106,145,238,219,150,149,100,95,82,
+106,60,44,76,105,51,78,50,22,85,81,88,108,20,127,9,15,176,143,100,142,70,
+92,94,100,104,125,137,72,110,137,112,7,91,99,140,163,81,147,142,56,73,72,
+223,139,246,219,74,173,224,187,219,79,75,63,68,43,110,18,21,30,14,33,44,50,
+32,61,64,76,63,47,37,27,21,71,25,119,139,68,110,64,84,112,37,23,116,82,143,
+70,254,55,1,45,108,16,41,37,26,85,79,0,1,0,158,0,0,1,39,4,117,0,3,0,0,1,17,
+35,17,1,39,137,4,117,251,139,4,117,0,0,1,0,80,0,0,2,139,4,123,0,20,0,0,33,
+17,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,17,51,17,2,2,65,89,144,136,
+35,135,33,68,80,45,68,36,137,2,56,48,166,164,125,172,8,148,123,116,101,25,
+33,1,176,251,139,0,1,0,80,0,0,3,188,4,123,0,32,0,0,33,17,6,35,34,38,39,6,
+6,35,34,38,53,52,55,23,6,21,20,51,50,53,17,51,17,20,22,51,50,55,17,51,17,
+3,51,48,60,60,102,31,36,87,59,125,131,35,135,33,119,117,137,60,67,55,47,137,
+2,34,26,47,49,48,48,170,164,122,171,8,147,144,197,140,1,94,254,170,76,72,
+40,1,194,251,139,0,0,1,0,31,0,49,3,172,4,70,0,6,0,0,1,0,1,39,54,0,55,3,172,
+254,136,254,79,100,202,1,184,161,3,240,254,7,254,58,98,211,2,6,218,0,0,2,
+0,49,255,248,4,47,4,123,0,31,0,43,0,0,37,54,54,53,52,38,35,34,7,7,54,51,50,
+22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,55,19,23,1,1,21,20,22,51,50,54,
+53,52,38,35,34,2,63,27,21,132,108,118,68,1,45,58,85,105,113,97,96,134,191,
+145,120,174,34,31,16,172,139,254,148,253,227,61,47,47,52,51,43,61,23,86,116,
+58,124,152,82,1,28,109,84,93,109,144,126,126,179,126,118,117,47,2,31,33,251,
+158,1,101,1,55,74,48,46,39,45,0,1,0,53,255,242,4,186,4,123,0,38,0,0,37,54,
+53,52,38,35,34,21,21,35,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,
+23,54,54,51,50,22,23,54,55,19,23,1,2,199,22,50,56,105,129,51,51,46,63,54,
+119,64,136,92,62,83,32,28,90,53,76,98,17,13,52,186,139,254,148,12,86,86,89,
+89,149,213,207,85,70,74,63,93,109,37,118,125,111,141,47,47,46,48,76,75,65,
+164,2,76,33,251,158,255,255,0,76,254,104,4,254,5,86,2,34,0,19,0,0,0,3,0,53,
+4,238,0,0,255,255,0,76,254,104,4,199,5,78,2,34,0,20,0,0,0,3,0,53,4,156,0,
+0,255,255,0,76,254,104,4,193,5,86,2,34,0,21,0,0,0,3,0,53,4,154,0,0,255,255,
+0,76,254,104,4,178,5,86,2,34,0,22,0,0,0,3,0,53,4,184,0,0,255,255,0,76,254,
+104,5,137,5,86,2,34,0,23,0,0,0,3,0,53,4,193,0,0,255,255,0,76,254,104,4,201,
+5,86,2,34,0,24,0,0,0,3,0,53,4,182,0,0,255,255,0,76,254,104,4,217,5,86,2,34,
+0,25,0,0,0,3,0,53,4,197,0,0,255,255,0,76,254,104,4,254,5,86,2,34,0,26,0,0,
+0,3,0,53,4,168,0,0,255,255,0,76,254,104,4,248,5,78,2,34,0,27,0,0,0,3,0,53,
+4,152,0,0,255,255,0,84,254,104,4,233,5,86,2,34,0,28,0,0,0,3,0,53,4,227,0,
+0,255,255,0,76,254,104,4,172,5,86,2,34,0,29,0,0,0,3,0,53,4,135,0,0,255,255,
+0,84,254,104,5,102,5,86,2,34,0,30,0,0,0,3,0,53,5,39,0,0,255,255,0,82,254,
+104,4,172,5,86,2,34,0,33,0,0,0,3,0,53,4,184,0,0,255,255,0,76,254,104,4,217,
+5,86,2,34,0,34,0,0,0,3,0,53,4,178,0,0,255,255,0,61,254,104,4,135,5,86,2,34,
+0,35,0,0,0,3,0,53,4,141,0,0,255,255,0,76,254,104,4,199,5,86,2,34,0,36,0,0,
+0,3,0,53,4,174,0,0,255,255,0,72,254,104,4,41,5,86,2,34,0,37,0,0,0,3,0,53,
+4,115,0,0,255,255,0,76,254,104,4,199,5,86,2,34,0,38,0,0,0,3,0,53,4,184,0,
+0,255,255,0,76,254,104,4,178,5,86,2,34,0,39,0,0,0,3,0,53,4,225,0,0,255,255,
+0,76,254,104,6,43,5,86,2,34,0,40,0,0,0,3,0,53,4,225,0,0,255,255,0,76,254,
+104,4,201,5,86,2,34,0,41,0,0,0,3,0,53,4,190,0,0,255,255,0,76,254,104,5,104,
+5,86,2,34,0,42,0,0,0,3,0,53,4,229,0,0,255,255,0,76,254,104,4,178,5,86,2,34,
+0,43,0,0,0,3,0,53,4,242,0,0,255,255,0,31,254,104,4,250,5,86,2,34,0,44,0,0,
+0,3,0,53,4,236,0,0,255,255,0,76,254,104,5,61,5,86,2,34,0,45,0,0,0,3,0,53,
+4,152,0,0,255,255,0,76,254,104,5,158,5,86,2,34,0,46,0,0,0,3,0,53,4,205,0,
+0,255,255,0,76,254,104,4,254,5,86,2,34,0,47,0,0,0,3,0,53,4,213,0,0,255,255,
+0,76,254,104,4,201,5,86,2,34,0,48,0,0,0,3,0,53,4,190,0,0,255,255,0,61,254,
+104,4,199,5,86,2,34,0,49,0,0,0,3,0,53,4,150,0,0,255,255,0,76,254,104,4,203,
+5,86,2,34,0,50,0,0,0,3,0,53,4,182,0,0,255,255,0,76,254,104,4,168,5,86,2,34,
+0,51,0,0,0,3,0,53,4,160,0,0,255,255,0,76,254,66,4,170,5,86,2,34,0,52,0,0,
+0,3,0,53,4,156,255,218,255,255,0,31,254,104,6,57,5,86,2,34,0,71,0,0,0,3,0,
+53,4,227,0,0,255,255,0,78,254,104,4,86,5,119,2,34,0,87,0,0,0,3,0,53,4,147,
+0,0,0,1,253,209,5,100,0,61,7,86,0,6,0,0,1,5,7,37,55,37,23,254,83,1,19,43,
+254,150,22,2,45,41,6,49,94,111,142,149,207,117,0,2,253,23,253,205,0,18,0,
+10,0,26,0,37,0,0,3,17,52,38,35,34,21,17,35,53,6,6,35,34,38,53,52,54,51,50,
+23,54,51,50,22,21,17,1,34,6,21,20,51,50,54,53,52,38,111,41,43,88,129,17,62,
+33,103,118,123,104,107,61,63,103,93,109,253,240,50,56,106,52,55,56,253,205,
+1,67,69,65,130,254,185,149,23,28,125,115,102,133,88,88,121,116,254,176,1,
+205,66,55,129,66,59,61,64,0,0,2,253,86,253,25,0,47,0,8,0,44,0,56,0,0,3,17,
+6,35,34,38,53,52,55,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,55,38,
+53,52,54,51,50,23,23,6,21,20,22,51,50,55,53,51,17,1,34,6,21,20,22,51,50,54,
+53,52,38,74,39,47,87,109,6,93,118,38,60,90,92,115,110,97,93,112,3,107,187,
+153,28,38,71,35,47,35,53,31,121,254,92,42,52,52,42,44,50,53,253,37,1,156,
+13,97,92,20,21,3,106,74,75,48,58,108,91,90,104,105,91,18,18,91,137,122,169,
+4,43,51,51,39,47,22,205,253,37,1,20,52,40,41,51,49,43,42,50,0,0,2,253,102,
+253,25,0,47,0,12,0,32,0,44,0,0,1,38,53,52,54,51,50,23,39,51,17,35,17,38,38,
+35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,55,34,6,21,20,22,51,50,
+54,53,52,38,253,209,107,186,150,154,105,3,121,121,54,123,79,93,122,38,60,
+91,91,115,109,97,91,114,205,43,52,52,43,45,49,53,254,0,92,137,124,171,97,
+85,253,37,1,236,69,66,106,75,75,48,58,108,91,90,104,102,94,18,74,52,40,41,
+51,50,42,41,51,0,2,253,111,253,25,0,47,0,12,0,22,0,49,0,0,3,55,6,35,34,39,
+6,35,34,38,53,52,55,38,53,52,54,51,50,23,39,51,17,39,17,38,38,35,34,6,21,
+20,23,54,55,23,6,6,21,20,51,50,53,53,51,21,20,22,51,50,74,1,32,47,60,40,43,
+76,81,97,3,111,185,146,147,107,2,121,121,56,121,75,91,120,36,35,60,72,51,
+47,65,60,117,24,29,40,253,37,16,28,50,50,102,88,20,18,94,136,125,172,93,81,
+253,37,138,1,106,67,60,108,73,75,46,51,40,78,33,75,50,82,74,102,100,40,36,
+0,0,2,253,125,253,25,0,178,0,12,0,56,0,68,0,0,3,7,39,55,23,7,22,21,20,6,35,
+34,38,53,52,55,53,38,53,52,54,51,50,23,54,51,50,22,22,21,20,6,35,34,38,53,
+52,55,38,35,34,6,21,20,23,54,55,23,6,21,20,22,51,50,54,53,52,19,34,6,21,20,
+22,51,50,54,53,52,38,231,52,73,174,82,47,51,116,101,105,119,1,107,194,166,
+106,81,43,55,47,81,48,100,76,75,99,4,53,58,113,130,26,30,54,68,82,60,55,48,
+52,213,30,35,37,28,31,37,38,254,4,47,72,172,78,43,52,71,85,103,117,102,3,
+3,6,91,132,130,171,37,25,41,76,49,71,93,92,74,25,15,20,107,84,58,44,45,41,
+82,61,74,52,59,44,34,34,1,171,35,31,29,34,35,28,31,35,0,0,2,253,158,253,25,
+0,102,0,12,0,36,0,48,0,0,1,38,53,52,54,51,50,22,22,21,20,7,39,54,53,52,38,
+35,34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,53,52,55,34,6,21,20,22,
+51,50,54,53,52,38,254,19,117,197,161,108,162,84,57,108,43,128,106,72,107,
+56,42,60,98,89,118,110,97,93,112,205,42,52,52,42,44,50,53,253,246,93,140,
+128,173,82,140,85,116,87,47,68,70,94,115,51,87,53,73,49,67,105,94,90,104,
+105,91,13,6,73,52,40,41,51,49,43,42,50,0,0,4,253,178,253,25,0,137,0,12,0,
+53,0,65,0,75,0,85,0,0,3,6,6,35,34,38,53,52,55,38,35,55,22,23,38,39,38,38,
+53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,6,21,20,23,54,51,50,22,21,
+20,7,22,22,21,20,6,35,34,38,3,34,6,21,20,22,51,50,54,53,52,38,3,38,35,34,
+21,20,22,51,50,54,55,22,51,50,54,53,52,35,34,6,238,49,84,51,66,85,49,22,34,
+17,72,64,9,5,70,79,185,163,179,200,26,113,16,131,121,83,104,44,41,52,134,
+93,110,12,67,72,84,67,48,81,50,45,49,51,43,43,52,51,111,45,47,62,28,29,31,
+46,153,46,50,28,27,55,30,45,253,96,40,31,75,60,53,33,4,84,9,45,18,21,37,111,
+68,107,138,164,139,72,71,35,42,58,88,107,40,64,38,55,31,109,103,82,39,30,
+5,70,54,61,76,29,1,132,48,44,43,49,50,40,42,52,254,239,44,49,19,26,28,15,
+43,26,19,49,27,0,0,1,253,41,253,193,0,18,0,20,0,30,0,0,3,20,6,35,34,38,53,
+52,55,23,6,21,20,51,50,55,38,53,52,54,51,50,23,17,35,17,35,34,21,20,23,213,
+137,117,121,139,176,80,127,135,99,23,91,156,141,101,52,129,28,168,94,254,
+172,108,127,142,128,190,135,94,106,123,158,74,50,106,95,107,10,253,244,1,
+162,91,69,23,0,2,253,129,253,25,0,96,0,8,0,50,0,62,0,0,3,39,6,35,34,38,53,
+52,55,38,53,52,54,51,50,23,23,6,21,20,22,51,50,54,53,52,39,55,22,21,20,6,
+35,34,38,53,52,55,14,2,21,20,23,54,51,50,22,21,21,23,37,34,6,21,20,22,51,
+50,54,53,52,38,4,155,55,116,93,112,3,107,187,153,28,38,71,35,43,43,45,41,
+32,100,53,106,96,99,108,6,61,98,52,38,60,90,92,115,170,254,135,42,52,52,42,
+44,50,53,253,25,73,73,105,91,18,18,91,137,122,169,4,43,51,51,41,45,41,43,
+43,47,55,65,87,85,97,96,93,20,21,1,52,82,48,75,48,58,108,91,19,67,180,52,
+40,41,51,49,43,42,50,0,0,2,253,145,253,25,0,78,0,12,0,33,0,45,0,0,1,38,53,
+52,54,51,50,23,39,51,17,35,53,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,
+35,34,38,53,52,55,55,34,6,21,20,22,51,50,54,53,52,38,254,11,122,185,149,147,
+99,2,123,123,102,146,88,121,46,27,85,47,89,118,110,97,93,112,1,204,42,52,
+52,42,45,49,53,253,245,95,145,124,171,92,80,254,172,108,128,106,75,81,52,
+32,36,105,94,90,104,105,91,6,6,80,52,40,41,51,50,42,41,51,0,2,253,219,253,
+117,0,137,0,12,0,11,0,23,0,0,3,34,38,53,52,54,51,50,22,21,20,6,3,34,6,21,
+20,22,51,50,54,53,52,38,207,156,186,187,155,161,183,187,157,98,111,113,96,
+100,111,112,253,117,181,148,149,185,183,146,151,183,2,26,110,96,95,112,110,
+97,95,111,0,1,253,152,253,25,0,119,0,12,0,48,0,0,3,7,39,55,23,7,22,21,20,
+6,35,34,38,53,53,38,53,52,54,51,50,22,22,21,20,7,39,54,53,52,38,35,34,6,21,
+20,23,54,55,23,6,21,20,22,51,50,54,53,52,203,53,74,174,82,47,51,119,98,106,
+117,106,199,171,113,166,86,58,108,43,129,115,114,134,27,30,54,68,82,60,54,
+47,56,254,5,48,72,172,78,43,51,72,84,104,118,101,11,92,132,131,170,81,140,
+86,114,89,47,68,70,96,113,107,84,58,44,45,41,82,60,75,51,60,44,34,34,0,2,
+254,59,253,37,1,14,0,12,0,16,0,29,0,0,1,32,0,53,52,54,51,50,22,21,20,6,35,
+34,39,22,33,1,22,51,50,54,53,52,38,35,34,6,21,20,1,8,254,167,254,140,137,
+111,104,128,119,109,38,42,123,1,172,253,181,42,56,56,57,56,43,56,58,253,37,
+1,4,215,119,149,118,99,105,116,12,192,1,62,27,59,51,45,58,78,74,16,0,2,253,
+111,253,25,0,47,0,12,0,43,0,53,0,0,3,17,38,35,34,21,20,23,21,55,50,22,23,
+7,38,35,34,7,54,51,50,22,22,21,20,6,35,34,38,53,52,54,55,38,53,52,54,51,50,
+22,23,39,51,17,37,22,51,50,54,53,52,38,35,34,74,93,128,100,1,16,57,69,35,
+39,40,73,141,24,69,78,63,103,55,112,107,123,149,78,74,7,109,98,64,112,57,
+2,121,253,187,21,122,50,54,64,59,70,253,37,1,251,122,76,2,3,6,1,11,14,100,
+16,111,19,43,81,56,82,92,149,139,86,125,31,23,36,75,91,48,52,88,253,37,220,
+124,35,31,36,37,0,0,2,251,238,253,205,255,244,255,190,0,21,0,32,0,0,5,22,
+4,51,50,55,38,38,53,52,54,51,50,22,22,21,20,6,35,34,36,39,5,54,53,52,38,35,
+34,6,21,20,22,252,86,100,1,1,141,30,28,44,45,128,99,78,106,48,219,193,194,
+254,195,107,3,30,105,52,49,49,57,50,145,145,152,3,28,88,53,92,112,60,97,58,
+134,148,177,171,195,39,92,43,54,55,46,41,68,0,0,3,251,254,253,244,0,12,255,
+190,0,24,0,35,0,47,0,0,1,6,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,
+22,21,20,6,35,34,38,55,22,22,51,50,53,52,38,35,34,6,7,38,38,35,34,6,21,20,
+22,51,50,54,254,6,76,130,74,109,131,127,106,76,133,77,68,129,77,81,112,52,
+128,111,78,131,2,53,91,54,121,62,63,52,86,200,55,95,54,55,62,60,57,54,95,
+254,135,81,66,124,107,104,123,65,83,78,70,62,103,64,108,121,69,159,57,53,
+111,51,60,50,61,62,49,59,50,55,58,51,0,1,253,166,253,37,0,119,0,12,0,43,0,
+0,3,54,53,52,38,35,34,6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,53,51,
+17,35,53,6,35,34,38,39,38,53,52,54,51,50,22,21,20,7,47,43,129,109,73,109,
+57,19,26,49,70,31,35,45,37,31,40,17,119,119,39,57,75,107,6,105,199,163,161,
+198,58,254,61,68,70,94,115,51,87,53,54,35,37,36,82,22,47,32,36,39,20,18,179,
+254,133,83,28,89,76,90,132,128,173,173,134,114,89,0,0,1,253,182,253,25,0,
+47,0,12,0,25,0,0,51,17,35,55,6,35,34,38,53,52,55,39,55,1,7,39,6,6,21,20,22,
+51,50,54,55,17,47,121,2,98,143,126,147,180,141,101,1,40,94,93,63,65,81,75,
+70,113,52,253,37,79,91,135,116,164,89,178,73,254,125,69,118,28,79,56,68,72,
+56,60,2,1,0,1,253,53,253,193,255,131,255,193,0,20,0,0,1,17,35,34,6,7,22,21,
+20,6,35,34,38,53,52,54,54,51,50,23,17,254,254,8,120,166,28,88,56,44,59,64,
+118,207,124,57,84,253,205,1,125,110,99,10,84,42,48,77,62,103,172,98,11,254,
+23,0,0,2,253,111,253,25,0,47,0,12,0,16,0,34,0,0,3,55,6,35,34,38,39,38,53,
+52,54,51,50,23,39,51,17,39,17,38,38,35,34,6,21,20,23,54,55,23,6,21,20,51,
+50,74,3,81,118,109,136,8,134,185,146,147,107,2,121,121,56,121,75,91,120,41,
+27,57,84,78,146,119,253,37,58,70,112,99,98,149,125,172,93,81,253,37,205,1,
+39,67,60,108,73,79,48,49,46,72,58,61,119,0,0,3,253,111,253,25,1,35,0,12,0,
+27,0,45,0,56,0,0,3,55,6,35,34,38,39,38,53,52,54,51,50,23,39,51,21,54,51,50,
+22,21,20,6,35,34,39,17,39,17,38,38,35,34,6,21,20,23,54,55,23,6,21,20,51,50,
+19,34,6,21,20,22,51,50,53,52,38,74,3,81,118,109,136,8,134,185,146,147,107,
+2,117,37,51,68,92,89,73,45,37,121,56,121,75,91,120,41,27,57,84,78,146,119,
+250,28,38,37,29,67,35,253,37,58,70,112,99,98,149,125,172,93,81,26,26,91,81,
+76,92,25,254,96,205,1,39,67,60,108,73,79,48,49,46,72,58,61,119,2,11,35,31,
+31,35,66,30,36,0,1,253,39,253,205,255,131,255,184,0,19,0,0,1,53,6,35,34,38,
+53,52,55,23,6,21,20,22,51,50,55,53,51,17,254,254,89,120,128,134,12,133,12,
+65,74,115,84,133,253,205,186,69,130,126,59,59,10,55,45,76,68,95,155,254,25,
+0,0,1,253,84,253,25,0,141,0,12,0,62,0,0,3,6,35,34,38,53,52,55,23,6,21,20,
+22,51,51,50,55,53,51,21,20,6,35,34,38,53,52,55,38,53,52,54,51,50,22,22,21,
+20,7,23,7,39,54,54,53,52,38,35,34,6,21,20,23,54,55,23,6,21,20,22,51,50,54,
+237,14,25,56,71,18,100,12,29,22,12,5,4,108,123,112,110,134,2,90,209,176,131,
+175,85,55,104,96,139,32,33,141,133,123,137,14,28,32,71,69,75,62,53,50,253,
+192,4,67,58,59,48,12,44,36,31,33,1,149,133,127,129,122,97,13,14,84,126,128,
+171,87,158,107,112,97,125,69,178,48,102,73,115,123,108,87,48,30,40,26,64,
+59,82,60,65,36,0,0,2,252,227,253,193,255,131,255,225,0,25,0,35,0,0,1,17,38,
+35,34,7,22,21,20,6,35,34,38,53,52,55,38,39,55,22,23,54,51,50,23,17,1,6,6,
+21,20,22,51,50,53,52,255,0,23,32,91,58,98,108,97,96,109,105,56,74,35,117,
+86,99,151,85,99,254,68,39,45,49,37,86,253,205,1,123,4,16,76,107,95,101,107,
+87,110,83,26,10,121,28,53,49,19,254,31,1,68,27,67,46,40,44,84,80,0,1,252,
+66,254,137,255,131,255,213,0,5,0,0,5,53,51,17,33,53,254,254,133,252,191,246,
+203,254,180,129,0,1,253,43,253,193,0,223,0,10,0,31,0,0,3,17,52,35,34,21,17,
+35,17,52,35,34,6,21,20,23,7,38,53,52,54,51,50,23,54,51,50,22,21,21,51,21,
+111,84,88,129,77,51,56,45,121,53,121,98,104,58,65,97,97,103,205,253,205,1,
+67,134,130,254,185,1,84,117,92,87,138,124,28,141,145,140,159,80,80,127,110,
+213,123,0,0,1,253,43,253,193,0,18,0,10,0,29,0,0,5,54,51,50,22,21,17,35,17,
+52,35,34,21,17,35,17,52,35,34,6,21,20,23,7,38,53,52,54,51,50,254,168,65,97,
+97,103,129,84,88,129,77,51,56,45,121,53,121,98,104,70,80,127,110,254,176,
+1,67,134,130,254,185,1,84,117,92,87,138,124,28,141,145,140,159,0,0,2,253,
+78,253,25,0,47,0,12,0,45,0,57,0,0,1,38,38,53,52,54,55,54,54,51,50,22,23,39,
+51,17,35,17,38,35,34,7,22,23,7,38,38,35,34,6,21,20,23,54,51,50,22,21,20,6,
+35,34,38,53,53,52,55,34,6,21,20,22,51,50,54,53,52,38,253,187,54,55,95,83,
+2,111,94,65,112,58,4,121,121,93,128,79,17,73,68,80,23,65,33,54,66,27,55,112,
+92,115,110,97,93,112,205,42,52,52,42,44,50,53,253,236,35,97,54,72,105,17,
+77,87,48,53,89,253,37,1,251,122,49,10,54,84,22,23,56,38,50,25,73,108,91,90,
+104,105,91,8,3,81,52,40,41,51,49,43,41,51,0,4,253,96,253,25,0,47,0,12,0,17,
+0,29,0,39,0,47,0,0,3,55,6,35,34,38,39,38,53,52,54,51,50,22,23,39,51,17,3,
+22,22,23,17,38,38,35,34,7,22,23,7,54,55,39,38,39,6,21,20,22,5,39,6,6,21,20,
+51,50,74,3,87,127,108,138,7,134,188,148,77,124,63,2,121,178,1,41,15,65,125,
+78,26,24,36,20,175,44,87,60,36,12,63,18,1,130,164,55,54,146,71,253,37,79,
+91,113,99,96,150,125,172,46,56,90,253,37,1,35,2,49,22,1,16,76,61,5,42,27,
+233,77,42,75,46,16,55,75,40,58,204,207,21,67,40,119,0,2,253,117,253,37,0,
+47,0,12,0,14,0,28,0,0,3,37,39,55,38,53,52,54,51,50,22,23,39,51,17,37,5,17,
+38,38,35,34,6,21,20,22,23,55,23,74,254,23,39,56,105,183,144,78,122,52,2,121,
+254,43,1,92,58,118,72,92,116,32,38,151,80,253,37,104,74,49,86,139,124,167,
+47,45,80,253,37,190,78,1,133,69,57,104,73,48,67,31,134,90,0,1,253,154,253,
+25,0,98,0,12,0,47,0,0,3,53,6,35,34,39,7,5,7,37,39,55,38,39,38,53,52,54,51,
+50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,23,54,55,23,6,21,20,51,50,55,
+53,51,17,227,39,53,18,18,68,1,128,18,254,32,32,124,17,5,147,182,156,176,198,
+20,29,108,34,132,119,103,121,20,19,68,67,57,72,50,34,116,253,199,73,24,3,
+63,57,106,69,74,126,15,9,76,138,109,139,171,144,48,83,49,45,57,72,91,114,
+79,57,39,24,47,55,78,32,45,60,34,140,254,185,0,4,253,6,253,25,0,47,0,12,0,
+30,0,42,0,51,0,59,0,0,3,55,6,35,34,38,39,6,7,22,21,20,6,35,34,38,53,52,54,
+55,38,53,52,54,51,50,22,23,39,51,17,3,22,22,23,17,38,38,35,34,7,22,23,7,54,
+55,39,38,39,6,21,20,5,39,6,6,21,20,51,50,74,3,87,127,111,131,5,49,33,20,45,
+37,37,49,74,71,55,188,148,77,124,63,2,121,178,1,41,15,65,125,78,26,24,36,
+20,189,20,127,62,34,14,63,1,148,163,56,54,146,71,253,37,79,91,117,105,39,
+36,18,33,35,37,48,42,39,82,52,75,96,125,172,46,56,90,253,37,1,35,2,49,22,
+1,16,76,61,5,42,27,213,15,82,77,42,20,55,75,64,238,207,21,67,40,119,0,1,252,
+106,253,37,0,25,0,37,0,27,0,0,3,34,36,39,55,22,4,51,51,17,6,6,7,22,21,20,
+6,35,34,38,53,52,54,54,51,50,23,17,164,218,254,142,166,72,177,1,31,208,65,
+102,142,27,87,57,43,59,64,114,199,107,69,52,253,37,113,116,107,119,92,2,12,
+3,88,74,10,83,42,48,77,56,93,154,87,10,253,10,0,1,0,72,0,0,2,131,5,72,0,20,
+0,0,33,17,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,17,51,17,1,250,65,
+89,145,135,34,138,35,69,78,48,65,37,137,2,210,48,186,182,142,168,13,149,156,
+123,106,24,34,1,227,250,190,0,4,0,76,254,78,5,2,5,86,0,66,0,76,0,86,0,97,
+0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,51,50,22,23,54,51,50,22,21,17,
+54,51,50,22,21,17,35,17,52,35,34,21,17,35,53,6,6,35,34,38,53,52,55,53,6,35,
+34,38,53,52,55,38,53,52,18,36,51,50,4,18,21,20,7,1,54,51,50,23,17,52,35,34,
+21,39,34,6,21,20,51,50,54,53,52,19,34,6,21,20,51,50,54,53,52,38,4,35,78,116,
+210,135,147,212,104,30,71,118,62,93,23,64,110,101,119,37,38,96,107,129,84,
+88,129,18,61,34,103,118,23,43,80,110,132,2,102,148,1,17,177,178,1,19,151,
+98,254,8,30,39,71,52,98,94,250,57,64,123,58,63,205,50,57,107,51,55,56,2,12,
+113,149,129,207,111,122,197,109,101,78,91,50,46,96,123,115,254,154,18,124,
+113,254,176,1,67,134,129,254,184,149,23,28,126,114,59,50,190,51,155,133,28,
+12,130,197,153,1,2,148,143,254,248,168,180,146,254,175,11,44,1,104,143,143,
+143,86,72,170,88,76,164,253,197,65,56,129,66,59,61,64,0,0,4,0,76,254,66,4,
+254,5,86,0,78,0,87,0,99,0,111,0,0,1,54,53,52,38,35,34,6,6,21,20,23,54,54,
+51,50,22,23,54,54,51,50,22,22,21,17,22,23,39,51,17,35,53,38,35,34,6,21,20,
+23,54,54,51,50,22,21,20,6,35,34,38,53,53,52,55,38,38,53,52,55,35,53,6,35,
+34,38,39,38,53,52,54,36,51,50,4,22,21,20,7,1,54,55,17,52,35,34,6,21,39,34,
+6,21,20,22,51,50,54,53,52,38,1,34,6,21,20,22,51,50,54,53,52,38,4,35,78,248,
+213,147,212,106,28,32,109,69,56,93,27,28,89,53,66,95,52,81,67,1,123,123,102,
+146,88,121,45,28,85,47,92,115,110,97,91,114,1,57,64,69,92,43,76,101,127,7,
+125,146,1,14,172,192,1,22,144,98,254,22,75,107,88,48,46,244,54,62,60,56,56,
+61,61,1,145,42,52,52,42,45,49,53,2,74,100,139,182,226,99,168,102,83,60,56,
+59,50,47,47,50,56,105,77,254,212,19,63,81,254,172,107,129,106,75,80,53,32,
+36,108,91,90,104,102,94,12,6,5,45,116,80,107,80,149,51,131,118,126,184,141,
+236,131,138,245,154,168,135,254,226,57,10,1,12,142,70,74,144,77,67,77,78,
+77,72,73,77,252,149,52,40,41,51,50,42,41,51,0,0,3,0,76,254,66,4,254,5,86,
+0,70,0,80,0,92,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,51,50,22,23,54,
+51,50,22,21,17,22,22,21,20,6,35,34,36,39,55,22,22,51,50,55,38,38,53,52,55,
+17,52,35,34,21,17,35,53,6,35,34,38,53,52,55,38,53,52,18,36,51,50,4,18,21,
+20,7,37,34,6,21,20,51,50,54,53,52,1,54,54,53,52,38,35,34,6,21,20,22,4,35,
+78,116,210,135,147,212,104,30,71,118,62,93,23,64,110,101,119,105,112,217,
+191,211,254,206,106,105,95,253,150,29,30,45,45,106,98,94,135,43,80,110,132,
+2,102,148,1,17,177,178,1,19,151,98,253,14,57,64,123,58,63,1,184,52,53,53,
+48,49,57,50,2,12,113,149,129,207,111,122,197,109,101,78,91,50,46,96,123,115,
+254,84,5,117,93,133,149,155,152,69,125,131,3,28,88,53,120,57,1,176,143,143,
+254,57,203,51,155,133,28,12,130,197,153,1,2,148,143,254,248,168,180,146,133,
+86,72,170,88,76,164,252,133,18,68,45,43,53,55,45,42,67,0,0,3,0,76,254,66,
+4,254,5,86,0,68,0,79,0,89,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,51,50,
+22,23,54,51,50,22,21,17,22,22,21,17,35,17,52,35,34,21,17,35,17,52,35,34,6,
+21,20,23,7,38,53,52,55,53,6,35,34,38,53,52,55,38,53,52,18,36,51,50,4,18,21,
+20,7,1,51,50,23,54,55,17,52,35,34,21,39,34,6,21,20,51,50,54,53,52,4,35,78,
+116,210,135,147,212,104,30,71,118,62,93,23,64,110,101,119,95,103,129,84,88,
+129,78,51,55,45,121,53,82,43,80,110,132,2,102,148,1,17,177,178,1,19,151,98,
+254,8,2,105,56,16,13,98,94,250,57,64,123,58,63,2,12,113,149,129,207,111,122,
+197,109,101,78,91,50,46,96,123,115,254,172,2,123,112,254,176,1,67,134,129,
+254,184,1,84,117,92,87,138,124,28,141,145,163,81,119,51,155,133,28,12,130,
+197,153,1,2,148,143,254,248,168,180,146,254,186,81,20,10,1,111,143,143,143,
+86,72,170,88,76,164,0,0,4,0,31,255,236,5,18,5,86,0,33,0,41,0,52,0,62,0,0,
+33,55,6,35,34,38,53,52,55,6,7,22,21,20,6,35,34,38,53,52,54,54,55,38,53,52,
+54,36,51,32,23,39,51,17,1,22,23,17,2,33,34,7,19,39,38,39,6,6,21,20,23,54,
+54,1,1,6,6,21,20,22,51,50,54,4,137,1,146,209,199,233,6,120,65,60,59,47,54,
+65,41,96,89,110,144,1,3,167,1,22,167,1,137,254,220,132,23,153,254,221,110,
+85,133,110,87,44,62,67,75,127,124,1,206,254,168,108,111,156,139,79,129,139,
+159,222,189,22,21,103,80,22,65,47,51,67,55,43,79,102,76,142,193,151,252,140,
+212,192,250,190,2,18,182,37,2,133,1,21,37,254,109,151,119,65,56,159,92,146,
+101,104,93,253,218,1,214,48,151,97,133,151,54,0,0,5,0,31,253,193,6,12,5,86,
+0,73,0,81,0,93,0,102,0,112,0,0,1,17,38,35,34,21,21,20,23,55,50,22,23,7,38,
+35,34,7,54,51,50,22,21,20,6,35,34,38,53,52,54,55,38,53,52,54,55,53,6,35,34,
+38,53,52,55,6,7,22,21,20,6,35,34,38,53,52,54,55,38,53,52,54,54,51,32,23,39,
+51,17,22,23,39,51,17,1,22,23,17,2,33,34,7,19,39,39,6,6,21,20,22,23,54,55,
+54,1,1,6,6,21,20,22,51,50,19,22,51,50,54,53,52,38,35,34,5,147,93,128,100,
+1,15,56,69,35,39,40,73,141,24,74,73,96,125,112,107,123,149,78,76,7,94,80,
+150,214,200,224,2,122,58,59,59,47,54,65,130,101,115,141,251,161,1,39,167,
+1,137,63,68,2,121,253,226,93,62,152,254,208,100,81,129,104,133,63,68,41,39,
+30,31,158,1,226,254,176,105,115,150,135,159,11,19,124,50,54,63,59,71,253,
+205,1,250,123,76,5,3,3,1,11,14,100,16,111,19,94,86,83,91,149,139,87,124,31,
+23,36,63,93,8,52,156,204,179,14,12,100,71,22,65,46,52,67,56,69,140,82,131,
+186,143,236,129,204,184,251,97,22,62,89,253,37,4,125,119,85,2,70,1,13,31,
+254,140,133,178,51,150,84,77,111,45,23,25,125,254,21,1,172,43,139,92,122,
+132,253,220,124,35,31,35,38,0,0,4,0,76,254,78,4,254,5,86,0,51,0,61,0,73,0,
+88,0,0,1,37,39,55,38,53,52,54,55,53,6,35,34,38,39,38,53,52,54,36,51,50,4,
+22,21,20,7,39,54,53,52,38,35,34,6,6,21,20,23,54,51,50,22,23,54,54,51,50,22,
+22,21,17,1,22,23,39,17,52,35,34,6,21,39,34,6,21,20,22,51,50,54,53,52,38,19,
+5,17,38,38,35,34,6,6,21,20,22,23,55,23,3,104,254,23,39,55,104,140,120,45,
+74,99,128,7,126,146,1,14,172,192,1,22,144,98,121,78,248,213,147,212,106,27,
+71,140,56,93,27,28,89,53,66,95,52,254,194,100,83,1,88,48,46,244,55,61,60,
+56,56,61,59,19,1,93,57,117,73,63,96,50,32,37,152,80,254,78,104,74,50,85,139,
+108,157,20,55,51,127,114,126,184,141,236,131,138,245,154,168,135,60,100,139,
+182,226,99,168,102,79,63,114,50,47,47,50,56,105,77,251,248,2,226,15,72,80,
+1,22,142,70,74,144,75,64,76,76,76,69,71,75,252,63,78,1,132,69,58,51,82,44,
+48,67,31,134,90,0,0,2,0,76,254,78,5,201,5,86,0,76,0,88,0,0,19,38,53,52,54,
+54,51,32,23,39,51,17,22,22,21,20,7,39,54,53,52,38,35,34,6,6,21,20,23,54,55,
+23,6,6,21,20,22,51,50,55,53,51,17,35,53,6,35,34,38,39,38,53,52,54,55,17,38,
+38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,52,37,34,6,21,20,22,
+51,50,54,53,52,38,232,156,133,243,158,1,18,196,1,138,126,138,58,108,43,129,
+109,73,109,57,19,26,49,69,30,35,45,37,53,35,119,119,40,56,75,107,7,104,169,
+150,87,238,144,183,214,78,98,180,148,194,189,153,95,157,92,1,86,92,117,121,
+90,91,118,119,2,22,137,216,139,222,118,200,180,251,234,26,163,109,116,87,
+47,68,70,94,115,51,87,53,54,35,37,36,82,22,47,32,36,39,38,179,254,133,83,
+28,88,76,90,133,117,169,13,2,162,124,128,195,151,138,87,131,189,153,148,188,
+81,156,105,46,165,120,93,97,118,118,93,96,121,0,2,0,76,253,193,4,193,5,86,
+0,56,0,68,0,0,1,55,6,35,34,38,53,52,55,39,55,1,7,39,6,6,21,20,22,51,50,54,
+55,17,38,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,52,55,38,
+53,52,54,54,51,32,23,39,51,17,1,34,6,21,20,22,51,50,54,53,52,38,4,55,1,96,
+144,126,147,180,114,100,1,15,95,93,64,64,82,74,70,113,52,87,238,144,183,214,
+78,98,180,148,194,189,153,95,157,92,7,156,133,243,158,1,18,196,1,138,253,
+118,92,117,121,90,91,118,119,253,205,79,91,135,116,164,89,143,73,254,160,
+69,117,28,78,57,68,71,56,60,5,46,124,128,195,151,138,87,131,189,153,148,188,
+81,156,105,46,31,137,216,139,222,118,200,180,248,139,4,207,120,93,97,118,
+118,93,96,121,0,2,0,76,254,66,5,80,5,86,0,63,0,75,0,0,19,38,53,52,54,54,51,
+32,23,39,51,17,22,22,21,17,35,17,52,35,34,21,17,35,17,52,35,34,6,21,20,23,
+7,38,53,52,54,51,50,23,54,55,17,38,38,35,34,6,21,20,22,23,54,51,50,22,21,
+20,6,35,34,38,53,52,37,34,6,21,20,22,51,50,54,53,52,38,239,163,133,243,158,
+1,18,196,1,138,70,73,129,84,88,129,78,51,56,46,121,54,122,98,105,56,37,45,
+87,238,144,183,214,42,51,96,167,148,194,189,153,150,194,1,86,92,117,121,90,
+91,118,119,2,16,137,222,139,222,118,200,180,251,66,18,121,91,254,176,1,67,
+134,129,254,184,1,84,117,92,87,135,127,28,144,142,141,158,81,45,19,3,91,124,
+128,195,151,73,114,54,112,189,153,148,188,188,154,58,153,120,93,96,119,118,
+93,96,121,0,0,4,0,76,0,0,5,201,5,86,0,65,0,77,0,88,0,98,0,0,1,38,35,34,6,
+21,20,23,54,54,51,50,22,23,54,51,50,23,54,51,50,22,21,17,35,17,52,35,34,21,
+17,35,53,6,35,34,39,6,35,34,38,53,52,55,38,53,52,54,36,51,50,22,23,54,51,
+50,22,21,20,6,35,34,38,38,53,52,37,34,6,21,20,22,51,50,54,53,52,38,1,34,6,
+21,20,22,51,50,54,53,52,51,34,6,21,20,22,51,50,53,52,3,177,122,161,210,239,
+34,27,74,39,45,81,28,56,93,104,44,63,105,97,116,136,92,90,135,35,47,91,54,
+57,99,92,103,2,114,145,1,9,173,104,168,86,76,115,118,155,152,121,74,124,74,
+1,16,66,77,83,60,63,81,81,252,150,45,43,42,46,44,42,203,45,43,42,46,86,4,
+130,79,233,179,108,77,40,41,44,45,89,92,92,123,115,254,33,1,199,143,143,254,
+57,171,19,89,89,149,133,32,12,145,200,153,252,138,43,46,69,151,120,117,149,
+63,123,84,40,106,85,63,66,81,82,63,66,84,253,141,78,84,85,81,79,85,164,78,
+84,85,81,164,164,0,0,4,0,76,255,236,6,88,5,78,0,71,0,83,0,94,0,104,0,0,37,
+6,35,34,38,53,52,55,38,53,52,54,36,51,50,23,23,6,6,21,20,22,51,50,55,17,51,
+7,54,51,50,22,21,20,6,35,34,39,17,35,17,6,35,34,38,53,52,55,39,34,14,3,21,
+20,23,54,51,50,22,23,54,51,50,22,21,20,6,35,34,38,1,34,6,21,20,22,51,50,54,
+53,52,38,1,34,21,20,22,51,50,54,53,52,38,33,34,21,20,22,51,50,53,52,38,2,
+59,63,117,104,113,22,120,139,1,5,173,45,66,98,42,36,104,79,91,56,137,3,53,
+81,106,140,138,106,79,54,137,62,87,142,172,32,14,65,114,125,97,51,58,54,70,
+52,91,32,64,120,100,113,112,105,55,93,3,2,60,69,73,56,59,70,71,252,2,105,
+51,54,52,48,52,1,23,100,44,58,101,54,89,109,173,160,98,65,143,204,149,247,
+139,4,45,67,106,61,85,109,53,1,156,44,44,138,114,107,137,46,252,128,3,20,
+32,173,146,83,70,1,18,60,108,140,82,131,90,45,53,56,109,170,162,164,169,57,
+4,170,73,60,61,72,72,61,59,74,253,63,204,115,109,110,111,102,105,207,106,
+115,224,99,105,0,0,4,0,76,255,236,6,82,5,86,0,55,0,67,0,78,0,88,0,0,37,6,
+35,34,38,53,52,55,38,53,52,54,36,51,50,22,23,39,51,7,54,51,50,22,21,20,6,
+35,34,39,17,35,17,2,33,34,6,6,21,20,23,54,51,50,22,23,54,51,50,22,21,20,6,
+35,34,38,1,34,6,21,20,22,51,50,54,53,52,38,1,34,21,20,22,51,50,54,53,52,38,
+33,34,21,20,22,51,50,53,52,38,2,59,63,117,104,113,22,120,141,1,6,170,144,
+217,96,2,137,3,53,81,106,140,138,106,79,54,137,168,254,233,134,200,110,58,
+54,70,52,91,32,64,120,100,113,112,105,55,93,2,252,60,69,73,56,59,70,71,252,
+8,105,51,54,52,48,52,1,23,100,44,58,101,54,89,109,173,160,98,65,143,204,149,
+252,142,96,108,184,44,44,138,114,107,137,46,252,128,3,200,1,9,103,190,119,
+131,90,45,53,56,109,170,162,164,169,57,4,170,73,60,61,72,72,61,59,74,253,
+63,204,115,109,110,111,102,105,207,106,115,224,99,105,0,3,0,76,255,236,6,
+43,5,86,0,34,0,65,0,77,0,0,33,55,6,35,34,39,6,35,34,38,53,52,55,38,17,52,
+54,54,51,32,23,39,51,7,54,51,50,22,21,20,6,35,34,39,17,39,17,38,38,35,34,
+6,6,21,20,22,23,54,55,23,6,21,20,22,51,50,53,53,51,21,20,22,22,51,50,54,1,
+34,6,21,20,22,51,50,54,53,52,38,4,41,3,68,95,120,48,70,130,125,152,8,192,
+141,254,162,1,13,164,1,137,3,53,81,106,140,138,106,79,54,137,70,222,134,128,
+193,105,49,57,60,127,84,195,76,76,125,135,15,53,45,49,67,1,35,60,69,73,56,
+59,70,71,65,85,109,109,184,151,52,36,163,1,1,149,252,142,193,173,44,44,138,
+114,107,137,46,252,128,214,2,255,121,131,108,190,114,87,134,63,108,88,100,
+128,194,100,105,162,201,174,71,76,42,51,4,50,73,60,61,72,72,61,59,74,0,0,
+5,0,76,254,66,5,137,5,86,0,89,0,101,0,110,0,119,0,127,0,0,1,55,6,35,34,38,
+39,6,7,22,21,20,6,35,34,38,53,52,54,55,38,53,52,55,38,38,53,53,52,55,38,53,
+52,54,54,51,50,23,54,51,50,22,21,20,6,35,34,38,38,53,52,55,38,35,34,6,6,21,
+20,22,23,54,55,23,6,6,21,20,22,51,50,54,54,53,52,39,7,39,1,23,7,22,21,20,
+7,22,23,39,51,17,19,34,6,21,20,22,51,50,54,53,52,38,1,1,22,23,17,38,38,35,
+34,3,54,55,39,38,39,6,21,20,5,39,6,6,21,20,51,50,3,225,3,88,126,111,132,4,
+38,45,21,45,37,37,49,79,66,55,84,110,113,1,181,136,252,163,209,132,74,103,
+117,155,150,122,75,125,73,18,101,154,135,192,95,44,45,50,101,84,83,67,113,
+108,78,100,43,45,125,94,1,41,96,84,87,89,67,55,1,121,31,65,79,83,61,63,80,
+81,253,236,1,35,14,13,63,125,80,27,156,39,107,81,11,17,63,1,147,163,56,53,
+146,70,254,78,78,90,118,104,31,44,21,30,35,37,48,42,41,84,48,75,96,114,79,
+28,162,121,16,8,8,129,228,130,213,118,76,56,151,120,117,149,64,123,83,55,
+48,51,88,153,97,72,103,40,87,71,105,55,103,65,95,104,48,73,39,64,39,119,94,
+1,33,97,80,79,111,119,78,22,47,92,253,37,6,123,84,64,67,80,82,63,66,84,251,
+243,254,144,18,18,1,15,75,63,254,225,28,68,103,13,24,57,73,64,238,207,20,
+68,40,119,0,3,0,76,255,236,4,229,5,86,0,48,0,59,0,69,0,0,37,6,35,34,38,53,
+52,55,38,53,52,54,36,51,50,4,18,21,20,6,7,39,54,53,52,38,38,35,34,6,6,21,
+20,23,54,51,50,22,23,54,51,50,22,21,20,6,35,34,38,3,34,21,20,22,51,50,54,
+53,52,38,33,34,21,20,22,51,50,53,52,38,2,89,64,115,104,113,13,142,147,1,12,
+171,188,1,13,134,54,48,125,86,109,204,135,137,206,108,67,57,89,51,92,31,63,
+121,100,113,112,105,55,93,194,104,51,53,52,49,53,1,24,100,44,58,100,53,90,
+110,173,160,78,52,157,223,149,252,142,152,254,255,158,83,177,74,59,128,143,
+127,201,110,108,193,115,142,99,69,54,56,110,169,163,166,167,57,1,233,204,
+115,109,108,113,101,106,207,106,115,224,101,103,0,0,6,0,72,255,78,4,225,5,
+86,0,59,0,70,0,80,0,88,0,100,0,112,0,0,5,6,6,35,34,38,53,52,55,38,35,55,22,
+23,38,53,53,38,53,52,54,54,51,32,0,21,20,7,39,54,53,52,38,35,34,6,21,20,23,
+54,54,51,50,22,23,54,51,50,22,21,20,7,22,22,21,20,6,35,34,38,3,34,21,20,22,
+51,50,54,53,52,38,33,34,21,20,22,51,50,53,52,38,1,22,23,54,55,38,39,6,23,
+22,22,51,50,54,53,52,38,35,34,6,7,38,38,35,34,6,21,20,22,51,50,54,2,118,75,
+135,80,98,131,91,46,45,18,90,88,74,161,142,254,165,1,31,1,73,51,127,37,249,
+218,205,227,53,28,100,65,52,91,32,64,119,100,113,90,100,113,128,101,82,134,
+237,105,51,54,51,49,53,1,25,101,44,59,100,53,254,171,62,66,74,55,84,46,48,
+121,55,89,54,56,65,63,64,51,89,198,57,86,49,64,63,65,55,53,91,34,79,65,120,
+97,115,51,6,121,6,37,81,179,27,135,204,128,209,114,254,207,250,129,123,53,
+82,109,193,237,181,145,118,63,71,73,52,54,106,165,156,203,73,9,125,96,98,
+123,64,3,98,203,104,99,101,104,97,104,201,99,106,205,100,101,253,253,34,72,
+75,30,21,77,78,207,59,47,58,48,51,60,50,61,64,47,60,51,48,58,48,0,0,2,0,76,
+254,66,4,254,5,86,0,68,0,91,0,0,5,20,6,35,34,38,53,52,55,38,38,53,52,55,38,
+53,52,18,36,51,50,4,18,21,20,7,39,54,53,52,38,38,35,34,6,6,21,20,23,54,55,
+23,6,6,21,20,22,51,50,54,55,38,53,52,54,51,50,23,17,22,23,17,35,17,35,34,
+21,20,23,3,20,6,7,6,21,20,51,50,54,55,38,53,52,54,55,17,35,34,6,21,20,23,
+3,63,137,116,122,139,80,99,110,10,122,148,1,17,177,178,1,19,151,98,121,78,
+116,210,135,147,212,104,45,60,102,84,94,86,75,72,59,70,6,102,181,167,67,72,
+51,21,129,29,168,94,92,86,80,127,136,51,61,9,91,124,120,16,98,105,102,211,
+108,127,143,127,125,97,22,169,130,41,49,150,200,153,1,2,148,143,254,248,168,
+180,146,59,113,149,129,207,111,122,197,109,114,91,101,75,104,66,148,93,99,
+102,57,54,67,123,120,132,12,253,161,4,4,253,244,1,162,90,70,23,2,13,107,137,
+27,105,124,158,42,32,50,106,84,105,11,1,240,67,62,95,30,0,0,3,0,55,0,0,4,
+143,5,86,0,71,0,81,0,91,0,0,1,22,21,17,35,17,52,35,34,21,17,35,53,6,35,34,
+39,6,35,34,38,53,52,55,38,38,53,52,55,23,6,21,20,22,51,50,54,53,52,35,34,
+6,6,21,21,35,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,
+50,22,22,21,20,5,34,21,20,22,51,50,53,52,38,5,34,21,20,22,51,50,53,52,38,
+3,238,116,137,92,90,137,34,42,96,61,57,104,100,109,129,71,66,64,125,54,215,
+218,215,192,125,41,53,23,129,50,54,45,61,40,118,52,133,91,62,85,34,31,102,
+63,65,111,71,252,142,92,44,48,88,47,1,0,86,38,50,86,46,2,241,61,176,253,252,
+1,250,166,162,254,2,208,18,93,93,158,154,229,58,61,160,86,146,124,41,103,
+118,159,165,144,145,178,33,67,55,166,166,85,70,65,58,83,93,37,109,110,104,
+132,47,48,45,50,60,136,103,213,158,194,97,96,199,93,95,24,176,90,97,189,85,
+89,0,0,1,0,45,255,236,4,102,5,86,0,92,0,0,1,17,35,55,6,35,34,38,53,52,54,
+55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,55,38,38,53,52,55,23,6,21,16,
+33,50,54,53,52,38,35,34,6,21,21,35,53,52,38,35,34,6,21,20,22,23,7,38,53,52,
+54,51,50,22,23,54,54,51,50,22,21,20,6,7,22,21,20,6,6,7,6,6,21,20,22,51,50,
+55,17,4,102,137,2,179,239,156,165,127,156,69,76,33,83,79,77,89,14,131,16,
+70,136,141,64,124,53,1,158,197,194,59,52,54,48,129,51,51,49,54,20,13,119,
+43,131,90,60,82,35,29,96,57,102,131,168,160,52,65,120,86,95,91,93,91,241,
+175,2,252,253,4,121,141,128,115,96,117,35,15,33,40,37,53,56,60,55,30,40,31,
+53,60,92,54,47,192,131,126,122,41,96,105,254,219,125,127,80,84,73,82,125,
+133,76,71,57,51,45,72,33,37,107,94,95,118,46,48,46,48,146,128,145,191,34,
+55,77,73,84,55,20,21,62,52,56,61,159,1,243,0,5,0,45,254,76,4,121,5,86,0,89,
+0,108,0,116,0,128,0,139,0,0,1,6,6,35,34,38,53,52,54,55,38,38,53,52,54,55,
+62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,55,38,38,53,52,55,23,6,21,16,33,
+50,54,53,52,38,35,34,6,21,21,35,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,
+51,50,22,23,54,54,51,50,22,21,20,7,17,22,22,21,20,6,35,34,38,19,6,7,22,21,
+20,6,6,7,6,6,21,20,22,51,50,55,17,52,19,6,7,22,23,54,54,55,5,38,38,35,34,
+6,21,20,22,51,50,54,55,22,22,51,50,53,52,38,35,34,6,2,114,81,126,73,109,131,
+96,88,67,73,125,157,71,76,31,83,78,74,92,14,131,16,110,107,108,64,124,53,
+1,158,197,194,59,52,54,48,129,51,51,49,54,20,13,119,43,131,90,60,82,35,29,
+96,57,102,131,98,59,62,128,112,76,130,192,85,103,40,47,116,107,95,91,93,91,
+241,175,2,170,225,60,72,72,120,69,254,177,53,95,54,54,63,60,57,53,93,204,
+54,91,52,121,62,63,49,83,254,222,84,62,125,106,86,118,15,28,108,73,94,118,
+36,16,33,40,36,53,56,57,58,30,40,31,53,60,115,56,53,179,113,126,122,41,96,
+105,254,219,125,127,80,84,73,82,125,133,76,71,57,51,45,72,33,37,107,94,95,
+118,46,48,46,48,146,128,157,99,252,187,28,108,70,108,121,66,4,97,34,9,52,
+66,64,78,65,25,21,62,52,56,61,159,1,69,99,253,200,133,6,31,77,79,68,2,230,
+60,49,57,50,52,58,47,59,58,48,108,50,59,44,0,3,0,45,255,236,5,211,5,86,0,
+63,0,100,0,107,0,0,1,22,21,20,6,7,22,22,21,20,6,35,34,0,53,52,55,38,38,53,
+52,55,23,6,21,16,33,50,54,53,52,38,35,34,6,21,21,35,53,52,38,35,34,6,21,20,
+22,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,1,38,53,52,55,38,39,
+6,21,20,22,51,50,54,53,52,38,35,34,7,39,54,55,55,62,3,53,52,38,35,34,6,21,
+20,23,1,17,35,17,7,39,37,3,158,90,75,73,83,89,202,193,245,254,233,88,79,85,
+64,124,53,1,158,197,194,59,52,54,48,129,51,51,49,54,20,13,119,43,131,90,60,
+82,35,29,96,57,102,131,253,121,20,36,92,72,69,201,184,129,131,78,75,78,86,
+56,31,69,76,38,71,45,19,70,64,74,85,16,3,121,137,248,80,1,88,2,255,51,104,
+65,92,33,19,106,70,117,130,1,6,229,175,157,52,161,102,126,122,41,96,105,254,
+219,125,127,80,84,73,82,125,133,76,71,57,51,45,72,33,37,107,94,95,118,46,
+48,46,48,146,128,225,254,137,56,52,64,47,11,24,124,153,174,189,65,62,51,56,
+35,96,14,22,22,12,32,39,41,23,48,51,59,52,34,40,1,187,252,61,3,38,177,112,
+222,0,0,2,0,45,255,236,5,190,5,86,0,85,0,104,0,0,9,2,7,3,22,21,17,35,55,6,
+35,34,38,38,53,52,54,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,55,38,38,
+53,52,55,23,6,21,16,33,50,54,53,52,38,35,34,6,21,21,35,53,52,38,35,34,6,21,
+20,22,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,21,20,7,19,1,17,52,55,
+6,7,22,21,20,6,6,7,6,6,21,20,22,51,50,5,190,254,151,1,105,118,236,6,133,2,
+184,244,114,146,61,125,157,71,76,31,83,78,74,92,14,131,16,73,131,139,64,124,
+53,1,158,197,194,59,52,54,48,129,51,51,49,54,20,13,119,43,131,90,60,82,35,
+29,96,57,102,131,4,234,254,149,5,84,124,50,65,120,86,95,91,93,91,247,4,115,
+254,42,254,42,80,1,82,107,69,254,231,129,149,68,108,67,94,118,36,16,33,40,
+36,53,56,57,58,30,40,31,53,60,92,56,47,191,130,126,122,41,96,105,254,219,
+125,127,80,84,73,82,125,133,76,71,57,51,45,72,33,37,107,94,95,118,46,48,46,
+48,146,128,58,53,98,1,80,252,79,1,97,107,74,65,23,57,73,73,84,55,20,21,62,
+52,56,61,0,3,0,76,255,236,4,184,5,86,0,44,0,55,0,65,0,0,37,6,35,34,38,53,
+52,55,38,53,52,54,36,51,50,22,23,39,51,17,35,53,38,38,35,34,6,21,20,23,54,
+51,50,22,23,54,51,50,22,21,20,6,35,34,38,3,34,21,20,22,51,50,54,53,52,38,
+33,34,21,20,22,51,50,53,52,38,2,89,64,115,104,113,13,142,137,1,0,166,132,
+211,94,1,137,137,81,219,126,198,234,67,58,88,51,92,31,63,121,100,113,112,
+105,55,93,194,104,51,53,52,49,53,1,24,100,44,58,100,53,90,110,173,160,77,
+54,162,217,149,252,142,90,104,174,253,155,254,120,126,232,180,147,97,68,54,
+56,110,169,163,166,167,57,1,233,204,115,109,108,113,101,106,207,106,115,224,
+100,104,0,2,0,76,254,66,4,195,5,86,0,85,0,97,0,0,1,23,7,22,21,20,7,22,23,
+39,51,17,35,17,38,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,
+55,38,53,52,55,38,38,53,53,52,55,38,53,52,54,54,51,50,4,22,21,20,7,39,54,
+53,52,38,35,34,6,21,20,22,23,54,55,23,6,6,21,20,22,51,50,54,54,53,52,39,7,
+39,19,34,6,21,20,22,51,50,54,53,52,38,3,94,96,84,87,79,58,52,3,121,121,54,
+123,79,93,122,38,58,93,88,118,109,97,91,114,2,107,81,109,113,1,181,131,252,
+168,194,1,11,131,60,129,47,235,207,200,222,44,45,50,101,84,83,67,113,108,
+78,100,43,45,125,94,142,43,52,52,43,44,50,53,3,70,97,80,79,111,117,76,23,
+45,87,253,37,1,235,69,67,106,75,77,46,58,105,94,90,104,102,94,25,10,92,137,
+108,82,31,160,121,16,8,8,129,228,127,211,123,147,247,153,147,137,47,104,117,
+195,235,185,153,72,103,40,87,71,105,55,103,65,95,104,48,73,39,64,39,119,94,
+253,61,52,40,41,51,50,42,41,51,0,1,0,76,254,66,4,195,5,86,0,99,0,0,5,7,39,
+55,23,7,22,21,20,6,35,34,38,53,53,38,53,52,55,38,53,53,52,55,38,53,52,54,
+54,51,50,4,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,23,54,55,23,6,6,21,
+20,22,51,50,54,54,53,52,39,7,39,1,23,7,22,21,20,7,22,22,21,20,7,39,54,53,
+52,38,35,34,6,21,20,23,54,55,23,6,21,20,22,51,50,54,53,52,2,220,52,74,174,
+82,48,52,119,98,105,118,107,109,172,1,181,131,252,168,194,1,11,131,60,129,
+47,235,207,200,222,44,45,50,101,84,83,67,113,108,78,100,43,45,125,94,1,41,
+96,84,87,95,92,97,58,108,43,129,115,114,134,27,32,52,67,81,60,54,49,54,210,
+48,72,172,78,43,54,69,84,104,117,102,11,90,134,142,78,74,214,16,8,8,129,228,
+127,211,123,147,247,153,147,137,47,104,117,195,235,185,153,72,103,40,87,71,
+105,55,103,65,95,104,48,73,39,64,39,119,94,1,33,97,80,79,111,130,73,35,139,
+92,116,87,47,68,70,96,113,107,84,58,44,47,39,82,60,75,52,59,45,33,35,0,0,
+4,0,82,254,66,5,170,5,86,0,52,0,81,0,91,0,103,0,0,5,38,38,53,52,55,6,35,34,
+2,17,52,54,55,38,53,52,54,51,50,22,23,39,51,17,22,23,39,51,17,35,53,38,35,
+34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,53,52,3,54,55,17,38,38,35,
+34,6,21,20,23,54,51,50,23,7,38,35,34,6,7,54,51,50,22,22,21,20,37,18,33,50,
+54,53,52,38,35,34,1,34,6,21,20,22,51,50,54,53,52,38,3,103,57,64,2,83,151,
+197,239,138,131,13,181,157,120,194,86,1,137,61,55,1,123,123,102,146,88,121,
+45,28,85,47,92,115,110,97,93,112,24,91,138,77,198,106,107,112,5,35,38,137,
+107,56,88,102,154,169,8,138,131,100,168,93,253,141,32,1,1,98,103,127,113,
+128,2,218,42,52,52,42,44,50,53,227,45,116,80,24,11,69,1,18,1,4,169,240,55,
+48,51,123,166,86,91,157,251,222,21,51,81,254,172,107,129,106,75,80,53,32,
+36,108,91,90,104,105,91,12,6,1,203,79,2,2,178,114,121,89,81,36,16,5,47,121,
+37,173,164,38,73,136,94,36,176,254,200,87,76,88,97,253,151,52,40,41,51,49,
+43,41,51,0,0,3,0,82,254,66,5,158,5,86,0,56,0,66,0,78,0,0,37,17,38,38,35,34,
+6,21,20,23,54,51,50,23,7,38,35,34,6,7,54,51,50,22,22,21,20,6,35,34,2,17,52,
+54,55,38,53,52,54,51,50,22,23,39,51,17,22,22,21,20,6,35,34,38,53,52,54,37,
+18,33,50,54,53,52,38,35,34,1,34,6,21,20,22,51,50,54,53,52,38,4,35,77,198,
+106,110,109,5,37,52,137,107,56,88,102,154,169,8,138,131,100,168,93,170,162,
+197,239,131,123,14,181,156,121,194,86,1,137,115,127,187,157,156,186,163,253,
+76,32,1,1,98,103,127,113,128,2,237,97,112,113,96,100,111,112,215,3,15,114,
+121,91,79,31,23,7,47,121,37,173,164,38,73,136,94,142,161,1,18,1,4,165,236,
+57,53,52,123,166,86,92,158,251,140,28,172,119,150,183,181,148,139,181,220,
+254,200,87,76,88,97,254,145,111,96,95,112,110,97,96,111,0,0,3,0,82,254,66,
+5,84,5,86,0,68,0,78,0,91,0,0,5,22,22,51,50,54,55,6,35,34,38,53,52,54,55,17,
+38,38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,7,54,51,50,22,22,21,20,6,
+35,34,2,17,52,54,55,38,53,52,54,51,50,22,23,39,51,17,22,22,21,20,4,33,34,
+38,39,3,18,33,50,54,53,52,38,35,34,1,54,53,52,38,35,34,6,21,20,22,51,50,1,
+121,67,200,93,176,205,53,30,29,103,124,96,78,77,198,106,110,109,5,37,52,137,
+107,56,88,102,154,169,8,138,131,100,168,93,170,162,197,239,131,123,14,181,
+156,121,194,86,1,137,79,89,254,198,254,207,103,238,80,101,32,1,1,98,103,127,
+113,128,3,113,5,57,54,45,57,57,55,55,238,38,46,58,55,6,111,96,80,119,20,3,
+19,114,121,91,79,31,23,7,47,121,37,173,164,38,73,136,94,142,161,1,18,1,4,
+165,236,57,53,52,123,166,86,92,158,251,142,23,134,94,196,207,52,44,3,5,254,
+200,87,76,88,97,253,223,23,24,65,74,57,45,52,59,0,0,3,0,82,254,31,6,53,5,
+86,0,62,0,72,0,84,0,0,1,34,36,38,53,52,54,55,17,38,38,35,34,6,21,20,23,54,
+51,50,23,7,38,35,34,6,7,54,51,50,22,22,21,20,6,35,34,2,17,52,54,55,38,53,
+52,54,51,50,22,23,39,51,17,22,22,21,20,6,35,34,39,22,33,1,18,33,50,54,53,
+52,38,35,34,1,22,51,50,54,53,52,38,35,34,21,20,6,47,229,254,190,166,104,89,
+77,198,106,110,109,5,37,52,137,107,56,88,102,154,169,8,138,131,100,168,93,
+170,162,197,239,131,123,14,181,156,121,194,86,1,137,72,78,119,109,39,42,123,
+1,173,250,170,32,1,1,98,103,127,113,128,2,144,40,59,54,58,56,46,111,254,31,
+117,216,140,100,144,20,2,230,114,121,91,79,31,23,7,47,121,37,173,164,38,73,
+136,94,142,161,1,18,1,4,165,236,57,53,52,123,166,86,92,158,251,185,22,108,
+76,105,116,12,192,3,11,254,200,87,76,88,97,254,16,29,58,53,44,58,155,20,0,
+3,0,82,253,193,5,61,5,86,0,35,0,90,0,100,0,0,5,35,34,2,17,52,54,55,38,53,
+52,54,51,50,22,23,39,51,17,22,22,21,20,6,7,22,22,21,20,6,35,34,38,38,53,52,
+37,54,55,17,38,38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,7,54,51,50,22,
+22,21,20,6,7,6,21,20,22,51,50,54,53,52,38,35,34,7,39,54,55,54,54,53,52,38,
+35,34,7,1,18,33,50,54,53,52,38,35,34,2,8,2,197,239,131,123,14,181,156,121,
+194,86,1,137,63,68,53,61,64,64,177,160,150,222,118,1,121,79,89,77,198,106,
+110,109,5,37,52,137,107,56,88,102,154,169,8,138,131,100,168,93,103,94,6,188,
+164,98,111,61,55,48,47,53,15,75,84,78,49,45,61,76,253,26,32,1,1,98,103,127,
+113,128,20,1,18,1,4,165,236,57,53,52,123,166,86,92,158,251,142,21,98,58,65,
+86,34,25,96,59,111,130,122,223,134,35,208,57,13,3,13,114,121,91,79,31,23,
+7,47,121,37,173,164,38,73,136,94,111,147,27,34,58,155,202,65,60,46,47,21,
+104,8,21,23,64,52,38,42,51,1,120,254,200,87,76,88,97,0,2,0,76,254,205,4,254,
+5,86,0,55,0,65,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,51,50,22,23,54,
+51,50,22,21,17,35,17,52,35,34,21,17,35,53,7,5,7,37,39,55,38,38,53,52,55,38,
+53,52,18,36,51,50,4,18,21,20,7,37,34,6,21,20,51,50,54,53,52,4,35,78,116,210,
+135,147,212,104,30,71,118,62,93,23,64,110,101,119,136,98,94,135,241,2,175,
+29,252,238,41,205,77,83,2,102,148,1,17,177,178,1,19,151,98,253,14,57,64,123,
+58,63,2,12,113,149,129,207,111,122,197,109,101,78,91,50,46,96,123,115,254,
+64,1,168,143,143,254,88,172,229,162,119,182,98,199,24,139,105,28,12,130,197,
+153,1,2,148,143,254,248,168,180,146,133,86,72,170,88,76,164,0,1,0,76,255,
+170,5,119,5,86,0,73,0,0,19,38,53,52,18,36,51,32,0,17,20,7,19,7,3,54,54,53,
+52,2,35,34,6,6,21,20,23,54,55,23,6,21,20,22,51,50,54,53,52,38,35,34,6,7,39,
+54,55,54,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,
+38,53,52,209,133,148,1,22,186,1,41,1,72,121,207,123,236,71,60,246,229,148,
+219,116,45,31,63,103,115,145,133,106,122,76,68,26,64,20,55,37,59,101,95,62,
+56,75,87,74,115,129,114,132,70,75,77,84,192,171,190,221,1,178,154,223,156,
+1,1,142,254,184,254,224,229,247,254,238,86,1,80,137,225,127,234,1,4,105,196,
+125,120,88,62,72,78,116,154,132,147,82,72,55,66,13,10,103,16,17,30,75,58,
+49,54,58,101,84,129,86,76,98,38,25,114,69,125,147,226,181,33,0,1,0,76,253,
+193,4,217,5,86,0,98,0,0,1,6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,21,20,
+6,7,6,6,21,20,51,50,55,17,51,17,35,55,6,35,34,38,53,52,54,54,55,62,2,53,52,
+35,34,6,21,20,23,7,38,53,52,55,38,38,53,52,55,38,53,52,54,36,51,50,4,22,21,
+20,7,39,54,53,52,38,35,34,6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,53,
+52,3,40,20,26,43,57,57,47,86,113,83,76,56,93,122,98,66,146,174,125,121,121,
+2,129,170,133,136,51,95,84,66,57,28,102,58,59,17,115,23,34,107,109,3,148,
+144,1,9,174,175,1,8,143,104,123,86,236,202,135,203,111,61,51,107,84,94,70,
+126,114,117,122,2,19,5,51,39,43,56,165,140,98,153,41,47,81,82,93,48,39,53,
+44,90,140,1,231,253,37,102,114,110,100,55,87,62,32,24,30,38,27,78,50,41,41,
+30,29,58,59,58,40,34,166,126,24,22,148,226,148,244,136,140,254,161,208,150,
+65,116,169,192,238,100,186,113,139,88,87,80,104,64,119,75,109,121,119,109,
+68,0,1,0,76,254,205,4,199,5,86,0,52,0,0,5,5,7,37,39,37,17,35,34,6,7,50,22,
+21,20,6,35,34,38,53,52,55,38,53,52,54,36,51,50,4,22,21,20,6,7,39,54,53,52,
+38,35,34,6,6,21,20,23,54,54,51,50,23,17,2,81,2,107,28,253,35,41,1,53,10,162,
+210,15,47,55,58,51,59,70,28,138,145,1,3,167,173,1,5,142,67,58,123,106,234,
+202,132,196,104,68,74,227,129,73,70,42,146,119,170,102,243,1,181,183,149,
+50,44,46,50,89,69,89,80,153,220,153,253,137,141,255,159,104,200,75,66,136,
+169,193,237,107,193,116,141,101,96,103,12,253,160,0,2,0,76,254,205,4,178,
+5,86,0,26,0,48,0,0,33,55,6,6,35,34,39,7,5,7,37,39,55,38,39,38,38,53,52,54,
+54,51,32,23,39,51,17,3,17,38,38,35,34,6,6,21,20,22,23,54,55,23,6,21,20,22,
+51,50,54,4,41,1,73,164,98,73,54,123,2,170,28,252,237,41,167,159,12,111,116,
+133,249,165,1,10,177,1,137,137,76,232,139,129,186,90,52,60,42,116,97,142,
+156,131,114,163,214,74,66,13,114,161,119,182,98,164,97,210,75,216,131,142,
+230,128,195,175,250,190,1,142,2,70,123,130,104,167,96,81,131,63,112,85,86,
+91,142,122,142,95,0,1,0,76,254,205,5,176,5,86,0,44,0,0,1,6,6,7,22,22,21,20,
+6,35,34,38,53,52,55,38,38,53,52,54,54,51,32,23,39,51,17,5,5,7,37,39,1,17,
+38,38,35,34,6,6,21,20,23,54,37,3,61,199,248,19,46,54,57,52,61,68,63,103,109,
+141,254,162,1,13,164,1,137,254,190,2,64,29,253,78,41,1,113,71,221,132,128,
+193,107,154,161,1,0,2,100,48,233,153,3,53,40,46,50,94,72,120,115,79,222,135,
+149,252,142,193,173,251,122,240,136,119,160,104,1,31,2,225,122,130,106,191,
+115,207,114,182,59,0,0,2,0,76,254,205,4,168,5,86,0,21,0,36,0,0,33,37,7,5,
+7,37,39,55,39,39,55,38,17,52,54,54,51,32,23,39,51,17,1,5,17,38,38,35,34,6,
+6,21,20,22,23,1,23,4,31,254,56,156,2,171,28,252,237,41,186,243,31,121,227,
+143,252,158,1,11,160,1,137,252,207,2,168,73,214,133,126,191,105,89,93,1,6,
+97,118,145,161,119,182,98,182,64,84,118,138,1,19,145,248,139,185,165,250,
+190,1,58,183,3,92,120,122,107,189,110,115,149,51,1,0,94,0,2,0,76,254,66,4,
+195,5,86,0,77,0,89,0,0,5,38,53,52,54,51,51,53,6,35,34,38,39,38,53,52,54,54,
+51,50,4,22,21,20,7,39,54,53,52,38,35,34,6,21,20,23,54,55,23,6,6,21,20,22,
+51,50,55,53,51,17,22,23,39,51,17,35,17,38,38,35,34,6,21,20,23,54,54,51,50,
+22,21,20,6,35,34,38,53,52,55,34,6,21,20,22,51,50,54,53,52,38,2,18,106,186,
+150,8,87,120,106,141,18,220,131,252,168,194,1,11,131,60,129,47,235,207,199,
+223,96,36,108,84,56,59,74,73,116,83,135,60,56,3,121,121,54,123,79,93,122,
+37,31,80,40,92,115,110,97,91,114,205,42,52,52,42,46,48,53,214,90,138,124,
+171,89,62,98,89,137,245,127,211,123,147,247,153,147,137,47,104,117,195,235,
+183,151,139,86,92,72,105,36,73,46,56,61,81,224,254,30,23,50,86,253,37,1,235,
+69,67,106,75,77,46,30,28,108,91,90,104,102,94,18,74,52,40,41,51,50,42,41,
+51,0,1,0,76,0,0,4,254,5,86,0,61,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,
+55,23,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,55,17,51,17,35,53,
+6,35,34,39,6,35,34,38,53,52,55,38,53,52,18,36,51,50,4,18,21,20,7,4,35,78,
+116,210,135,147,212,104,27,46,89,76,79,67,63,58,56,55,135,44,48,35,44,19,
+135,135,40,62,109,47,63,121,111,133,3,103,148,1,17,177,178,1,19,151,98,2,
+12,113,149,129,207,111,122,197,109,92,79,76,64,92,59,116,83,63,85,63,69,170,
+175,65,62,24,27,1,62,253,123,192,40,94,94,152,124,26,25,132,196,153,1,2,148,
+143,254,248,168,180,146,0,2,0,76,0,0,4,254,5,86,0,36,0,63,0,0,1,54,53,52,
+38,38,35,34,7,23,1,17,35,53,6,35,34,39,6,35,34,38,53,52,55,38,53,52,18,36,
+51,50,4,18,21,20,7,5,17,1,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,53,53,
+51,21,20,22,51,50,54,4,35,78,116,210,135,189,126,133,1,247,135,40,62,109,
+47,63,121,111,133,3,103,148,1,17,177,178,1,19,151,98,254,194,253,184,65,27,
+46,89,76,79,67,63,58,56,55,135,44,48,35,44,2,12,113,149,129,207,111,104,95,
+254,123,253,123,192,40,94,94,152,124,26,25,132,196,153,1,2,148,143,254,248,
+168,180,146,138,1,1,1,196,103,128,92,79,76,64,92,59,116,83,63,85,63,69,170,
+175,65,62,24,0,1,0,76,255,170,5,211,5,86,0,73,0,0,1,6,35,34,39,6,35,34,38,
+53,52,55,23,6,21,20,51,50,53,53,51,21,20,22,51,50,55,53,51,21,20,6,35,34,
+38,53,52,55,38,53,52,18,36,51,32,0,17,20,7,19,7,3,54,54,53,52,36,33,34,6,
+6,21,20,23,54,55,23,6,21,20,22,51,50,54,3,186,28,33,76,40,50,96,80,96,30,
+121,22,63,68,129,28,33,35,27,129,220,237,197,225,2,143,155,1,43,205,1,67,
+1,91,121,207,123,235,71,60,254,246,254,255,166,238,124,44,23,29,119,84,159,
+140,139,142,1,28,18,65,65,106,105,73,101,16,84,76,94,88,176,176,48,40,32,
+232,201,234,230,212,179,37,15,157,231,160,1,0,139,254,189,254,219,229,247,
+254,238,86,1,80,137,225,127,239,255,103,195,128,119,88,60,57,55,140,137,137,
+144,90,0,0,1,0,66,0,0,4,61,5,86,0,39,0,0,1,17,35,55,6,35,34,38,53,53,38,38,
+53,52,54,55,39,55,1,7,39,6,21,20,22,51,51,54,55,23,6,6,21,20,22,51,50,54,
+55,17,4,61,137,2,90,123,139,174,169,189,143,135,156,115,1,98,104,130,220,
+130,116,6,42,111,90,78,63,105,86,63,96,41,5,66,250,190,143,71,163,136,10,
+7,187,154,120,182,50,211,74,254,18,71,175,68,183,104,109,83,81,105,49,94,
+57,77,91,42,46,4,31,0,0,2,0,76,254,66,4,199,5,86,0,67,0,78,0,0,23,22,4,51,
+50,55,38,38,53,52,55,17,35,34,6,7,50,22,21,20,6,35,34,38,53,52,55,38,17,52,
+54,36,51,50,4,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,23,54,54,51,50,
+23,17,54,51,50,22,21,20,6,35,32,3,5,54,53,52,38,35,34,6,21,20,22,217,102,
+1,6,136,35,33,45,46,64,15,167,221,15,46,56,58,50,62,67,63,192,145,1,3,167,
+173,1,5,142,67,58,123,106,234,202,132,196,104,133,77,208,114,77,71,14,15,
+109,122,221,193,254,148,250,3,32,101,52,48,50,57,55,100,108,118,2,28,89,53,
+90,58,2,22,194,158,50,44,46,50,94,67,137,114,164,1,5,153,253,137,141,255,
+159,104,200,75,66,136,169,193,237,107,193,116,200,117,76,81,12,253,172,2,
+118,97,134,148,1,4,109,40,93,42,54,55,45,44,69,0,0,1,0,76,254,74,4,199,5,
+86,0,75,0,0,1,54,53,52,38,35,34,6,6,21,20,23,54,54,51,50,23,17,54,51,50,23,
+17,35,34,36,39,55,22,4,51,51,17,6,6,7,22,21,20,6,35,34,38,53,52,54,55,17,
+35,34,6,7,50,22,21,20,6,35,34,38,53,52,55,38,53,52,54,36,51,50,4,22,21,20,
+6,7,3,207,106,234,202,132,196,104,81,76,207,113,75,69,54,58,69,52,188,218,
+254,142,166,72,176,1,29,210,66,101,143,28,88,58,43,59,64,88,84,10,162,210,
+15,46,56,58,50,59,70,51,141,145,1,3,167,173,1,5,142,67,58,1,242,136,169,193,
+237,107,193,116,154,106,79,81,12,254,100,12,10,253,35,113,116,107,119,92,
+1,243,3,86,75,12,82,41,49,77,56,81,140,49,1,91,183,149,50,44,46,50,89,68,
+124,100,151,225,153,253,137,141,255,159,104,200,75,0,0,4,0,76,254,184,4,199,
+5,86,0,53,0,67,0,79,0,91,0,0,5,6,6,35,34,38,53,52,54,55,38,53,52,55,38,53,
+52,54,36,51,50,4,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,23,54,54,51,
+50,23,17,30,2,21,20,6,35,34,38,1,22,23,54,55,17,35,34,6,7,50,22,21,20,23,
+22,22,51,50,54,53,52,38,35,34,6,7,38,38,35,34,6,21,20,22,51,50,54,2,105,77,
+127,75,109,131,76,72,41,32,161,145,1,3,167,173,1,5,142,67,58,123,106,234,
+202,132,196,104,89,75,235,133,83,65,80,111,53,128,112,76,131,254,246,91,102,
+75,66,15,168,219,16,47,55,249,55,91,52,57,64,65,60,50,85,206,52,94,56,54,
+63,60,57,52,94,181,81,66,125,107,78,114,23,46,79,99,83,157,240,153,253,137,
+141,255,159,104,200,75,66,136,169,193,237,107,193,116,162,109,100,108,13,
+253,152,1,57,101,64,107,123,68,1,122,25,109,83,30,2,16,194,159,50,44,36,242,
+59,48,53,56,51,57,46,62,57,51,57,49,53,58,49,0,0,1,0,31,0,0,5,16,5,86,0,60,
+0,0,1,6,6,21,20,22,51,50,54,55,17,51,17,35,53,6,35,34,38,53,53,6,7,22,21,
+20,6,35,34,38,53,52,54,55,38,53,52,54,36,51,50,4,18,21,20,6,7,39,54,53,52,
+38,35,34,6,6,21,20,23,54,55,2,88,77,54,98,78,61,87,38,136,136,85,113,127,
+168,91,51,60,59,47,54,65,110,110,101,142,1,3,170,172,1,5,142,65,60,122,106,
+234,202,133,196,103,63,43,123,2,109,58,96,61,73,93,44,46,1,59,253,123,182,
+67,157,127,13,86,75,22,65,47,51,67,55,63,144,99,138,191,151,252,140,140,255,
+0,159,102,199,78,66,136,169,193,237,108,192,116,138,99,37,100,0,0,2,0,31,
+0,0,5,16,5,86,0,44,0,62,0,0,33,53,6,35,34,38,53,53,6,7,22,21,20,6,35,34,38,
+53,52,54,55,38,53,52,54,36,51,50,4,18,21,20,6,7,39,54,53,52,38,35,34,7,23,
+1,17,1,6,6,21,20,22,51,50,54,55,17,1,6,21,20,23,54,55,3,63,85,113,127,168,
+91,51,60,59,47,54,65,110,110,101,142,1,3,170,172,1,5,142,65,60,122,106,234,
+202,169,115,140,1,136,254,145,77,54,98,78,61,87,38,254,34,66,63,43,123,182,
+67,157,127,13,86,75,22,65,47,51,67,55,63,144,99,138,191,151,252,140,140,255,
+0,159,102,199,78,66,136,169,193,237,89,122,254,135,253,123,2,109,58,96,61,
+73,93,44,46,1,7,1,204,104,132,138,99,37,100,0,0,1,0,76,254,66,4,199,5,86,
+0,66,0,0,1,17,35,34,6,7,22,21,20,6,35,34,38,53,52,54,55,17,35,34,6,7,50,22,
+21,20,6,35,34,38,53,52,55,38,17,52,54,36,51,50,4,22,21,20,6,7,39,54,53,52,
+38,35,34,6,6,21,20,23,54,54,51,50,23,17,22,23,17,3,84,8,121,166,28,89,56,
+44,59,64,198,165,15,167,221,15,46,56,58,50,62,67,63,192,145,1,3,167,173,1,
+5,142,67,58,123,106,234,202,132,196,104,133,77,208,114,77,71,49,43,254,78,
+1,125,110,99,10,84,42,48,77,62,135,205,26,1,213,194,158,50,44,46,50,94,67,
+137,114,164,1,5,153,253,137,141,255,159,104,200,75,66,136,169,193,237,107,
+193,116,200,117,76,81,12,253,187,3,6,254,23,0,0,3,0,76,254,66,5,35,5,86,0,
+39,0,61,0,73,0,0,5,22,22,51,50,55,38,38,53,52,54,55,53,6,6,35,34,38,39,38,
+38,53,52,54,54,51,32,23,39,51,17,22,22,21,20,6,35,34,36,39,1,17,38,38,35,
+34,6,6,21,20,22,23,54,55,23,6,21,20,22,51,50,54,19,54,54,53,52,38,35,34,6,
+21,20,22,1,133,95,253,150,29,30,44,46,115,98,74,162,102,191,230,7,110,117,
+141,254,162,1,13,164,1,137,56,57,217,191,211,254,206,105,3,12,70,222,134,
+128,193,105,53,60,43,114,97,142,155,132,113,166,79,52,53,53,48,52,54,50,70,
+125,131,3,28,88,53,86,113,6,84,80,75,210,186,79,228,140,149,252,142,193,173,
+250,217,26,100,65,133,149,155,152,1,196,2,156,121,131,108,190,114,91,136,
+64,116,87,86,97,155,131,153,99,254,9,18,68,45,43,53,57,43,42,67,0,4,0,76,
+254,66,4,178,5,86,0,25,0,47,0,52,0,70,0,0,1,55,6,35,34,38,39,38,53,52,55,
+38,38,39,38,17,52,54,54,51,50,22,23,39,51,17,3,17,38,38,35,34,6,6,21,20,22,
+23,54,55,23,6,21,20,22,51,50,54,23,22,23,53,6,19,17,38,38,35,34,6,21,20,23,
+54,55,23,6,21,20,51,50,4,41,2,81,118,107,139,8,133,79,108,127,8,241,133,246,
+155,146,218,93,2,137,137,88,216,147,119,183,99,59,64,42,111,84,120,144,126,
+102,163,2,42,37,42,38,59,121,72,91,120,40,33,52,84,78,146,118,254,78,58,70,
+112,100,97,149,111,81,33,157,116,132,1,7,127,214,120,80,87,147,249,12,3,136,
+2,38,108,105,86,154,98,80,114,46,114,75,101,78,130,106,124,76,122,22,33,109,
+34,254,6,1,37,69,58,108,73,80,47,55,40,72,58,61,119,0,2,0,76,254,184,5,131,
+5,86,0,38,0,63,0,0,5,38,38,39,38,38,53,52,54,36,51,32,23,39,51,17,22,22,21,
+17,35,17,52,35,34,21,17,35,17,52,35,34,6,21,20,23,7,38,53,55,54,54,51,50,
+23,54,55,39,17,2,33,34,6,21,20,22,23,54,55,23,6,21,20,22,2,156,165,193,7,
+110,117,145,1,3,165,1,23,167,1,137,85,99,129,84,88,129,78,50,56,45,121,53,
+24,27,101,67,105,56,20,23,1,155,254,222,197,235,53,60,43,114,97,142,133,17,
+17,207,169,79,228,140,152,252,139,213,193,251,191,5,121,111,254,177,1,67,
+133,129,254,185,1,84,116,91,87,138,124,29,141,146,153,71,75,81,24,17,81,2,
+145,1,21,236,176,91,136,64,116,87,86,97,155,119,153,0,0,4,0,76,254,78,4,178,
+5,86,0,22,0,44,0,49,0,63,0,0,1,37,39,55,38,53,52,55,38,38,39,38,17,52,54,
+54,51,50,22,23,39,51,17,3,17,38,38,35,34,6,6,21,20,22,23,54,55,23,6,21,20,
+22,51,50,54,23,6,7,22,23,1,5,17,38,38,35,34,6,21,20,22,23,55,23,4,41,254,
+22,38,55,105,74,109,128,7,241,133,246,155,146,218,93,2,137,137,88,216,147,
+119,183,99,59,64,42,111,84,120,144,126,102,163,81,26,52,35,43,254,159,1,93,
+56,118,74,92,117,34,35,152,80,254,78,104,74,50,86,138,107,78,33,159,115,132,
+1,7,127,214,120,80,87,147,249,12,3,136,2,38,108,105,86,154,98,80,114,46,114,
+75,101,78,130,106,124,76,68,23,31,17,38,254,64,78,1,132,68,59,105,72,50,67,
+30,135,90,0,0,2,0,76,0,0,4,238,5,86,0,53,0,63,0,0,33,53,6,35,34,39,6,35,34,
+38,53,53,52,55,38,53,52,18,36,51,50,4,18,21,20,7,39,54,54,53,52,38,38,35,
+34,6,6,21,20,23,54,51,50,22,21,21,20,22,51,50,55,17,51,17,1,34,21,20,51,50,
+54,53,52,38,3,78,34,50,112,57,62,119,107,125,1,105,149,1,14,171,174,1,15,
+151,99,121,36,42,111,208,133,134,207,114,28,68,115,102,129,58,53,52,28,135,
+253,203,111,111,51,59,57,163,16,91,91,156,131,22,11,10,134,208,148,1,0,143,
+143,254,250,164,175,157,59,54,141,74,122,204,114,111,195,114,100,79,83,148,
+135,18,72,78,39,1,84,253,123,2,86,166,166,79,87,81,85,0,0,3,0,76,253,193,
+4,201,5,86,0,41,0,52,0,78,0,0,37,53,52,55,6,35,34,38,39,38,38,53,52,54,36,
+51,50,4,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,23,54,54,51,50,22,21,
+17,1,34,6,21,20,51,50,54,53,52,38,1,17,35,55,6,35,34,38,53,52,55,39,55,1,
+7,39,6,6,21,20,22,51,50,54,55,17,2,227,1,60,113,103,155,12,109,112,138,1,
+0,169,187,1,9,134,67,58,123,106,240,208,129,191,102,104,34,145,88,132,158,
+254,218,71,87,158,74,87,87,1,159,121,1,96,144,124,149,180,141,100,1,41,94,
+93,64,64,82,74,70,113,52,82,174,17,17,59,121,112,77,214,128,139,222,122,150,
+252,153,104,200,75,66,136,169,193,237,89,164,99,167,100,77,83,154,143,254,
+117,2,57,83,66,148,79,65,70,83,254,29,253,37,79,91,133,118,164,89,177,74,
+254,125,69,117,28,78,57,68,71,56,60,2,1,0,0,3,0,76,0,0,4,254,5,86,0,50,0,
+60,0,70,0,0,33,53,6,35,34,39,6,35,34,38,53,53,52,55,38,53,52,18,36,51,50,
+4,18,21,20,7,39,54,53,52,38,38,35,34,6,6,21,20,23,54,51,50,22,23,54,51,50,
+22,22,21,17,3,34,21,20,51,50,54,53,52,38,33,34,21,20,51,50,54,53,52,38,3,
+104,37,73,118,53,63,127,99,122,1,105,148,1,17,177,178,1,19,151,98,121,78,
+116,210,135,147,212,104,28,65,110,54,92,30,61,125,75,105,50,242,111,111,53,
+58,58,254,109,111,111,51,59,57,180,33,102,102,159,128,22,10,10,132,199,153,
+1,2,148,143,254,248,168,180,146,59,113,149,129,207,111,122,197,109,95,79,
+86,54,52,106,73,121,120,254,109,2,86,166,166,83,83,80,86,166,166,79,87,81,
+85,0,0,2,0,76,255,242,5,55,6,37,0,48,0,57,0,0,1,6,6,7,22,22,21,20,6,35,34,
+38,53,52,55,38,38,53,52,18,55,39,55,1,22,23,53,51,17,23,7,39,17,35,17,6,35,
+34,38,53,52,55,6,6,21,20,23,54,55,37,53,37,6,21,20,22,51,50,3,39,199,248,
+19,46,53,57,51,61,68,70,96,101,250,227,209,74,1,254,51,127,137,92,65,27,137,
+70,108,152,178,32,193,224,141,162,246,1,88,254,159,22,108,87,120,2,100,47,
+232,155,3,53,40,46,50,94,72,125,122,78,219,127,206,1,33,24,124,107,254,174,
+34,89,234,254,193,60,115,18,252,154,3,33,45,172,147,83,71,4,229,175,200,111,
+176,55,218,2,237,57,66,86,108,0,0,3,0,76,255,242,6,84,6,37,0,55,0,67,0,76,
+0,0,1,6,6,7,22,22,21,20,6,35,34,38,53,52,55,38,38,53,52,18,55,39,55,1,22,
+23,53,51,7,54,51,50,22,21,20,6,35,34,39,17,35,17,6,35,34,38,53,52,55,6,6,
+21,20,23,54,55,1,34,6,21,20,22,51,50,54,53,52,38,1,53,37,6,21,20,22,51,50,
+3,39,199,248,19,46,53,57,51,61,68,70,96,101,250,227,209,74,1,254,51,127,137,
+3,53,81,106,140,138,106,79,54,137,70,108,152,178,32,193,224,141,162,246,2,
+94,60,69,73,56,59,70,71,254,192,254,159,22,108,87,120,2,100,47,232,155,3,
+53,40,46,50,94,72,125,122,78,219,127,206,1,33,24,124,107,254,174,34,89,234,
+44,44,138,114,107,137,46,252,128,3,33,45,172,147,83,71,4,229,175,200,111,
+176,55,1,234,73,60,61,72,72,61,59,74,254,240,2,237,57,66,86,108,0,1,0,76,
+255,152,5,70,5,86,0,60,0,0,1,6,6,7,22,22,21,20,6,35,34,38,53,52,55,38,38,
+53,52,54,54,51,32,23,39,51,17,22,21,20,7,23,7,37,55,23,54,54,53,52,38,35,
+34,7,39,54,51,50,23,17,38,38,35,34,6,6,21,20,23,54,37,3,61,199,248,19,46,
+54,57,52,61,68,63,103,109,141,254,162,1,13,164,1,137,96,120,172,39,253,237,
+33,202,69,83,72,55,80,86,51,107,96,19,20,71,221,132,128,193,107,154,161,1,
+0,2,100,48,233,153,3,53,40,46,50,94,72,120,115,79,222,135,149,252,142,193,
+173,252,145,66,129,130,69,46,131,157,117,52,11,77,56,59,66,41,117,51,2,1,
+213,122,130,106,191,115,207,114,182,59,0,0,1,0,76,254,66,4,178,5,86,0,74,
+0,0,1,17,38,38,35,34,6,21,20,22,23,54,55,23,6,6,7,22,21,20,6,35,34,38,53,
+52,55,38,53,52,54,51,50,23,39,17,38,38,35,34,6,6,21,20,23,54,37,23,6,6,7,
+22,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,54,51,50,22,23,39,51,17,4,
+41,53,116,71,90,117,23,38,93,141,39,96,128,18,46,41,37,43,49,29,117,183,144,
+139,102,1,76,239,138,115,183,101,109,162,1,3,45,199,248,19,46,54,57,52,62,
+67,62,88,82,138,243,149,148,221,91,1,137,254,78,1,254,62,55,109,72,44,66,
+40,90,32,111,21,97,63,15,52,34,37,56,52,60,55,93,142,126,171,85,73,2,171,
+122,131,96,169,96,155,100,188,59,129,48,233,153,3,52,41,46,50,94,71,116,117,
+75,182,119,129,225,129,95,101,176,249,12,0,0,3,0,76,254,78,5,184,5,86,0,73,
+0,83,0,95,0,0,1,17,52,38,35,34,21,17,35,53,6,6,35,34,38,53,52,54,55,17,52,
+35,34,6,21,20,22,23,7,38,38,53,52,55,38,53,52,18,36,51,32,0,17,20,6,7,19,
+7,3,54,53,52,0,35,34,6,21,20,23,54,51,50,23,54,51,50,22,21,17,51,50,22,21,
+17,1,54,55,17,52,35,34,21,17,22,7,34,6,21,20,22,51,50,54,53,52,38,4,57,41,
+43,88,129,17,62,33,104,118,48,47,84,61,56,29,24,131,27,30,2,131,148,1,28,
+192,1,63,1,77,49,46,207,123,233,102,254,250,254,226,255,41,60,132,109,60,
+65,106,98,117,7,95,107,254,144,14,10,92,98,105,99,50,57,56,51,52,54,56,254,
+78,1,67,69,65,129,254,184,149,23,28,126,114,62,103,32,1,124,117,112,115,78,
+171,63,24,83,185,80,30,29,154,215,159,1,0,140,254,184,254,213,96,212,97,254,
+239,86,1,78,192,230,244,1,2,237,189,115,87,112,88,88,120,118,254,172,124,
+113,254,176,1,229,20,9,1,119,143,137,254,190,2,110,65,56,64,65,66,59,61,64,
+0,3,0,76,254,66,5,207,5,86,0,78,0,88,0,100,0,0,5,38,53,52,55,17,52,35,34,
+21,20,22,23,7,38,39,38,53,52,18,36,51,32,0,17,20,7,23,7,3,54,54,53,52,0,35,
+34,6,21,20,23,54,54,51,50,23,54,51,50,22,21,17,22,23,39,51,17,35,17,38,38,
+35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,19,54,51,50,23,53,52,
+35,34,21,19,34,6,21,20,22,51,50,54,53,52,38,2,51,106,78,84,117,28,25,129,
+54,5,123,148,1,28,192,1,63,1,77,58,193,123,217,31,32,254,250,254,226,255,
+24,30,106,67,109,60,67,104,101,114,30,27,3,120,120,54,123,79,93,122,37,60,
+91,92,115,110,97,93,112,109,59,64,35,32,92,98,96,42,52,52,42,44,50,53,214,
+90,138,113,82,1,74,116,200,65,149,63,22,142,154,148,211,159,1,0,140,254,184,
+254,213,144,173,252,86,1,55,72,176,88,244,1,2,237,189,89,71,63,64,88,88,121,
+116,254,229,20,24,87,253,37,1,235,69,67,106,75,77,46,58,108,91,90,104,105,
+91,26,2,3,18,5,208,143,137,253,92,52,40,41,51,50,42,41,51,0,0,2,0,76,254,
+66,5,158,5,86,0,77,0,87,0,0,1,17,52,35,34,21,17,35,17,52,38,35,34,6,21,20,
+23,7,38,53,52,54,55,17,52,35,34,6,21,20,22,23,7,38,38,53,52,55,38,53,52,18,
+36,51,32,0,17,20,7,19,7,3,54,54,53,52,0,35,34,6,21,20,23,54,51,50,23,54,51,
+50,22,21,17,22,21,21,51,21,1,22,23,54,55,17,52,35,34,21,3,186,84,88,129,39,
+39,50,56,45,121,53,106,95,84,61,56,29,24,131,27,30,2,131,148,1,28,192,1,63,
+1,77,121,207,123,236,71,60,254,250,254,226,255,41,60,132,109,60,65,106,98,
+117,82,205,253,156,27,18,57,88,92,98,254,78,1,67,134,129,254,184,1,84,62,
+55,92,87,138,124,28,141,145,130,159,9,1,87,117,112,115,78,171,63,24,83,185,
+80,30,29,154,215,159,1,0,140,254,184,254,213,216,249,254,238,86,1,80,136,
+224,121,244,1,2,237,189,115,87,112,88,88,120,118,254,137,62,140,213,123,2,
+27,20,26,70,9,1,61,143,137,0,3,0,76,254,78,5,2,5,86,0,71,0,81,0,92,0,0,1,
+17,52,35,34,21,17,35,53,6,6,35,34,38,53,52,55,17,52,35,34,21,20,22,23,7,38,
+38,53,52,55,38,53,52,18,36,51,50,4,18,21,20,7,39,54,53,52,38,38,35,34,6,6,
+21,20,23,54,51,50,23,54,51,50,22,21,17,54,51,50,22,21,17,1,17,52,35,34,21,
+17,54,51,50,7,34,6,21,20,51,50,54,53,52,38,4,129,84,88,129,18,61,34,103,118,
+37,84,117,30,26,131,28,32,3,146,148,1,17,177,178,1,19,151,98,121,78,116,210,
+135,147,212,104,48,63,137,108,60,65,107,100,115,32,31,96,107,254,111,93,98,
+20,35,82,73,50,57,107,51,55,56,254,78,1,67,134,129,254,184,149,23,28,126,
+114,74,61,1,186,117,246,77,188,77,24,88,202,86,35,31,156,223,153,1,2,148,
+143,254,248,168,180,146,59,113,149,129,207,111,122,197,109,127,88,127,88,
+88,122,116,254,159,13,124,113,254,176,2,4,1,117,143,137,254,183,7,112,65,
+56,129,66,59,61,64,0,0,3,0,76,254,66,4,254,5,86,0,58,0,67,0,85,0,0,1,55,6,
+35,34,38,39,38,53,52,54,55,17,52,35,34,21,20,23,7,38,38,53,53,38,53,52,54,
+36,51,50,4,22,21,20,7,39,54,53,52,38,35,34,6,6,21,20,23,54,54,51,50,23,54,
+51,50,22,21,17,1,22,23,39,17,52,35,34,21,19,17,38,38,35,34,6,21,20,23,54,
+55,23,6,21,20,51,50,3,98,2,80,118,109,137,8,133,140,118,84,117,51,127,29,
+30,129,146,1,14,172,192,1,22,144,98,121,78,248,213,147,212,106,33,30,105,
+67,108,61,65,106,96,119,254,187,107,84,1,92,98,190,59,121,72,91,120,40,33,
+52,84,77,145,118,254,78,58,70,112,99,97,150,108,161,22,1,41,117,201,134,142,
+23,77,168,73,10,126,187,141,236,131,138,245,154,168,135,60,100,139,182,226,
+99,168,102,89,65,62,64,88,88,118,120,251,248,2,227,16,73,81,1,20,144,137,
+252,215,1,39,69,58,108,73,80,47,55,40,72,57,62,119,0,0,4,0,76,254,66,4,254,
+5,86,0,70,0,79,0,97,0,108,0,0,1,55,6,35,34,38,39,38,53,52,54,55,17,52,35,
+34,21,20,23,7,38,38,53,53,38,53,52,54,36,51,50,4,22,21,20,7,39,54,53,52,38,
+35,34,6,6,21,20,23,54,54,51,50,23,54,51,50,22,21,17,7,54,51,50,22,21,20,6,
+35,34,39,17,1,22,23,39,17,52,35,34,21,19,17,38,38,35,34,6,21,20,23,54,55,
+23,6,21,20,51,50,1,34,6,21,20,22,51,50,53,52,38,3,98,2,80,118,109,137,8,133,
+140,118,84,117,51,127,29,30,129,146,1,14,172,192,1,22,144,98,121,78,248,213,
+147,212,106,33,30,105,67,108,61,65,106,96,119,2,38,48,69,91,88,74,45,37,254,
+187,107,84,1,92,98,190,59,121,72,91,120,40,33,52,84,77,145,118,1,9,29,37,
+37,29,67,35,254,78,58,70,112,99,97,150,108,161,22,1,41,117,201,134,142,23,
+77,168,73,10,126,187,141,236,131,138,245,154,168,135,60,100,139,182,226,99,
+168,102,89,65,62,64,88,88,118,120,254,211,25,25,91,81,77,91,25,254,96,2,227,
+16,73,81,1,20,144,137,252,215,1,39,69,58,108,73,80,47,55,40,72,57,62,119,
+2,11,36,30,31,35,66,30,36,0,0,2,0,76,254,66,4,254,5,86,0,75,0,85,0,0,1,54,
+53,52,38,38,35,34,6,6,21,20,23,54,51,50,23,54,51,50,22,21,17,22,21,17,35,
+17,52,35,34,21,17,35,17,52,35,34,6,21,20,23,7,38,53,52,54,55,17,52,35,34,
+6,21,20,22,23,7,38,38,53,53,52,55,38,53,52,18,36,51,50,4,18,21,20,7,1,22,
+23,54,55,17,52,35,34,21,4,35,78,116,210,135,147,212,104,48,56,144,108,60,
+65,107,100,115,82,129,84,88,129,78,51,56,45,120,54,106,95,84,61,56,28,26,
+132,28,29,1,144,148,1,17,177,178,1,19,151,98,254,22,23,22,61,85,93,98,2,12,
+113,149,129,207,111,122,197,109,129,87,128,88,88,122,116,254,137,64,138,254,
+176,1,67,134,129,254,184,1,84,117,92,87,131,131,28,144,142,129,160,9,1,87,
+117,112,115,72,172,68,24,89,184,75,24,12,11,157,220,153,1,2,148,143,254,248,
+168,180,146,254,152,18,29,74,6,1,61,143,137,0,0,3,0,61,254,66,6,0,5,86,0,
+83,0,95,0,107,0,0,19,38,53,52,54,55,53,52,54,51,50,22,23,39,51,17,22,22,21,
+20,7,39,54,53,52,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,53,52,
+55,38,53,52,54,55,17,38,38,35,34,6,21,21,22,23,7,38,35,34,6,21,20,23,54,54,
+51,50,22,22,21,20,6,35,34,46,2,53,37,34,6,21,20,22,51,50,54,53,52,38,1,34,
+6,21,20,22,51,50,54,53,52,38,246,185,181,159,182,156,121,194,86,1,137,122,
+138,57,109,43,127,106,107,129,42,62,97,92,115,110,97,93,112,1,118,170,146,
+77,198,106,107,112,124,105,98,89,124,120,138,79,42,164,106,96,162,84,187,
+155,73,125,93,53,1,86,92,117,120,91,91,118,119,1,209,42,52,52,42,45,49,53,
+1,135,127,195,141,192,18,13,124,165,86,92,158,251,234,25,162,111,115,88,47,
+65,73,95,114,107,84,71,50,66,108,91,90,104,105,91,13,6,6,94,139,118,168,13,
+2,179,114,121,89,81,4,22,101,94,96,127,98,109,68,89,96,87,160,95,149,177,
+42,84,124,82,211,120,93,97,118,118,93,96,121,253,14,51,41,41,51,50,42,41,
+51,255,255,0,61,253,244,5,80,5,86,2,34,0,49,0,0,0,3,0,144,5,68,0,0,0,3,0,
+61,254,66,5,125,5,86,0,45,0,77,0,89,0,0,37,6,35,34,38,53,53,38,53,52,54,55,
+53,52,54,51,50,22,23,39,51,17,22,22,21,17,35,17,52,35,34,21,17,35,17,52,35,
+34,6,21,20,23,7,38,53,52,55,54,51,50,23,54,55,17,38,38,35,34,6,21,21,22,23,
+7,38,35,34,6,21,20,23,54,54,51,50,22,21,20,1,34,6,21,20,22,51,50,54,53,52,
+38,2,218,60,80,155,189,185,172,154,182,156,120,194,86,1,138,70,73,129,84,
+88,129,78,51,55,45,121,53,175,21,23,105,56,37,45,77,198,106,107,112,133,111,
+98,89,124,120,138,81,43,162,105,148,194,254,168,94,115,120,91,91,118,119,
+69,22,178,154,12,128,194,138,190,21,15,124,165,86,91,157,251,66,18,121,91,
+254,176,1,67,134,129,254,184,1,84,117,92,87,138,124,28,141,145,148,146,5,
+81,45,19,3,108,114,121,90,80,1,19,107,94,96,127,98,110,69,86,95,190,152,149,
+1,110,121,92,97,118,118,93,96,121,0,0,5,0,76,254,197,5,248,5,86,0,38,0,47,
+0,58,0,72,0,83,0,0,1,17,52,38,35,34,21,17,35,53,6,6,35,34,38,39,35,6,35,34,
+38,39,38,17,52,54,36,51,32,23,39,51,17,54,51,50,22,21,17,1,22,23,17,2,33,
+34,7,23,1,54,54,55,39,38,39,6,6,21,20,1,54,54,55,38,39,3,6,6,21,20,22,51,
+50,55,34,6,21,20,51,50,54,53,52,38,5,119,40,44,88,129,18,61,34,93,116,10,
+15,7,9,195,228,8,228,145,1,3,165,1,23,167,1,137,44,54,93,110,253,174,137,
+19,155,254,222,110,85,136,254,252,30,135,92,110,65,66,61,68,2,54,25,107,72,
+72,51,202,107,113,156,139,23,243,50,56,106,51,56,56,254,197,1,67,67,66,129,
+254,185,149,24,27,104,94,1,206,190,162,1,29,152,252,139,213,193,251,167,25,
+122,116,254,177,3,77,190,31,2,135,1,21,37,184,254,31,82,139,42,150,88,96,
+55,159,93,175,253,235,69,74,2,88,70,1,19,47,151,98,132,152,34,64,56,129,65,
+59,61,64,0,5,0,76,254,66,5,184,5,86,0,47,0,56,0,67,0,78,0,90,0,0,5,38,39,
+7,34,46,2,39,38,17,52,54,36,51,32,23,39,51,17,22,23,39,51,17,35,53,38,35,
+34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,53,52,19,22,23,17,2,33,34,
+7,23,1,54,54,55,39,38,39,6,6,21,20,1,54,55,1,6,6,21,20,22,51,50,1,34,6,21,
+20,22,51,50,54,53,52,38,3,118,109,12,15,82,140,135,84,5,228,145,1,3,165,1,
+23,167,1,137,59,56,1,123,123,103,144,88,121,44,28,86,47,91,115,109,97,93,
+112,49,137,19,155,254,222,110,85,136,254,252,30,135,92,110,65,66,61,68,2,
+57,47,127,254,214,107,113,156,139,25,1,76,43,52,52,43,45,49,53,227,85,123,
+1,30,91,163,112,162,1,29,152,252,139,213,193,251,222,20,52,81,254,172,108,
+128,106,75,82,51,32,36,108,91,90,104,105,91,12,6,2,250,190,31,2,135,1,21,
+37,184,254,31,82,139,42,150,88,96,55,159,93,175,253,235,122,49,1,151,47,151,
+98,132,152,254,243,52,40,41,51,50,42,41,51,0,5,0,76,254,63,5,188,5,86,0,26,
+0,35,0,46,0,56,0,68,0,0,5,6,35,34,38,39,38,17,52,54,36,51,32,23,39,51,17,
+22,22,21,20,6,35,34,38,53,52,19,22,23,17,2,33,34,7,23,1,54,54,55,39,38,39,
+6,6,21,20,1,1,6,6,21,20,22,51,50,54,23,34,6,21,20,22,51,50,54,53,52,38,3,
+29,34,38,189,224,8,228,145,1,3,165,1,23,167,1,137,117,124,186,158,155,187,
+152,137,19,155,254,222,110,85,136,254,252,30,135,92,110,65,66,61,68,3,23,
+254,166,107,113,153,132,89,127,185,97,112,113,96,99,112,112,14,6,208,188,
+162,1,29,152,252,139,213,193,251,137,28,171,119,150,184,182,148,56,2,81,190,
+31,2,135,1,21,37,184,254,31,82,139,42,150,88,96,55,159,93,175,254,85,1,216,
+47,151,98,132,152,51,72,111,96,95,112,110,97,96,111,0,5,0,76,253,193,5,90,
+5,86,0,29,0,38,0,49,0,58,0,87,0,0,37,38,3,38,17,52,54,36,51,32,23,39,51,17,
+22,22,21,20,6,7,22,22,21,20,6,35,34,0,53,52,1,22,23,17,2,33,34,7,23,1,54,
+54,55,39,38,39,6,6,21,20,1,1,6,6,21,20,22,51,50,23,6,35,34,39,6,21,20,22,
+51,50,54,53,52,38,35,34,7,39,54,55,54,54,53,52,38,35,34,7,2,39,234,13,228,
+145,1,3,165,1,23,167,1,137,60,69,53,61,63,65,178,160,233,255,0,1,135,137,
+19,155,254,222,110,85,136,254,252,30,135,92,110,65,66,61,68,3,21,254,168,
+107,113,156,139,154,97,110,139,28,27,4,183,169,98,111,61,56,47,47,53,11,79,
+84,78,49,46,61,76,9,87,1,24,162,1,29,152,252,139,213,193,251,142,21,98,58,
+65,86,34,25,95,60,111,130,1,13,226,50,2,48,190,31,2,135,1,21,37,184,254,31,
+82,139,42,150,88,96,55,159,93,175,254,88,1,213,47,151,98,132,152,52,79,2,
+25,33,174,201,65,60,45,48,21,104,7,22,23,64,52,38,42,51,0,6,0,76,254,66,4,
+203,5,86,0,24,0,32,0,43,0,52,0,57,0,76,0,0,1,55,6,35,34,38,39,38,53,52,55,
+38,39,38,17,52,54,54,51,50,22,23,39,51,17,1,1,22,23,17,38,33,34,3,54,55,39,
+38,39,6,6,21,20,22,1,1,6,6,21,20,22,51,50,55,6,7,22,23,3,17,38,38,35,34,6,
+6,21,20,23,54,55,23,6,21,20,51,50,4,66,2,78,121,109,137,8,133,74,245,17,242,
+131,247,162,153,230,92,1,137,253,27,1,235,47,66,156,254,205,78,214,59,184,
+78,60,77,75,75,59,2,197,254,190,101,105,147,131,144,219,40,44,39,45,4,57,
+122,73,63,98,50,40,29,56,84,78,145,119,254,78,59,71,112,99,97,150,107,80,
+65,246,132,1,7,127,211,123,88,95,163,249,12,6,116,253,144,60,87,2,36,238,
+253,187,162,76,99,76,104,46,141,87,80,117,254,198,1,148,41,124,88,108,122,
+18,36,25,20,38,254,81,1,36,69,59,54,83,44,80,47,52,43,72,57,62,119,0,7,0,
+76,254,66,5,190,5,86,0,35,0,43,0,54,0,63,0,68,0,87,0,98,0,0,1,55,6,35,34,
+38,39,38,53,52,55,38,39,38,17,52,54,54,51,50,22,23,39,51,17,54,51,50,22,21,
+20,6,35,34,39,17,1,1,22,23,17,38,33,34,3,54,55,39,38,39,6,6,21,20,22,1,1,
+6,6,21,20,22,51,50,55,6,7,22,23,3,17,38,38,35,34,6,6,21,20,23,54,55,23,6,
+21,20,51,50,1,34,6,21,20,22,51,50,53,52,38,4,66,2,78,121,109,137,8,133,74,
+245,17,242,131,247,162,153,230,92,1,137,35,49,70,89,88,73,44,38,253,27,1,
+235,47,66,156,254,205,78,214,59,184,78,60,77,75,75,59,2,197,254,190,101,105,
+147,131,144,219,40,44,39,45,4,57,122,73,63,98,50,40,29,56,84,78,145,119,1,
+10,28,37,36,29,68,35,254,78,59,71,112,99,97,150,107,80,65,246,132,1,7,127,
+211,123,88,95,163,251,207,24,93,79,77,91,24,254,97,6,116,253,144,60,87,2,
+36,238,253,187,162,76,99,76,104,46,141,87,80,117,254,198,1,148,41,124,88,
+108,122,18,36,25,20,38,254,81,1,36,69,59,54,83,44,80,47,52,43,72,57,62,119,
+2,11,35,31,31,35,66,30,36,0,0,3,0,76,254,197,5,213,5,86,0,38,0,57,0,68,0,
+0,1,17,52,38,35,34,21,17,35,53,6,6,35,34,38,53,52,55,37,39,55,38,17,52,54,
+54,51,32,23,39,51,17,54,51,50,22,22,21,17,1,5,54,51,50,23,17,38,38,35,34,
+6,6,21,20,22,23,1,23,19,34,6,21,20,51,50,54,53,52,38,5,84,40,44,88,129,18,
+61,34,102,119,6,253,246,31,121,227,143,252,158,1,11,160,1,137,45,53,65,92,
+46,251,162,1,169,62,94,53,46,73,214,133,126,191,105,89,93,1,6,97,211,52,55,
+107,51,55,56,254,197,1,67,67,66,129,254,185,149,24,27,125,115,31,28,137,84,
+118,138,1,19,145,248,139,185,165,251,158,34,59,104,75,254,177,2,117,114,58,
+29,2,250,120,122,107,189,110,115,149,51,1,0,94,253,239,65,55,129,66,58,61,
+64,0,0,3,0,76,254,66,5,164,5,86,0,54,0,71,0,83,0,0,1,17,6,35,34,38,53,52,
+55,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,55,38,53,52,55,37,39,55,
+38,17,52,54,54,51,32,23,39,51,17,6,21,20,22,51,50,55,53,51,17,1,5,54,51,17,
+38,38,35,34,6,6,21,20,22,23,1,23,1,34,6,21,20,22,51,50,54,53,52,38,5,43,35,
+51,91,106,6,93,117,37,60,91,89,118,110,97,93,112,2,106,9,254,1,31,121,227,
+143,252,158,1,11,160,1,137,35,47,35,53,31,121,251,211,1,159,98,167,73,214,
+133,126,191,105,89,93,1,6,97,1,14,42,52,52,42,45,49,53,254,78,1,156,13,100,
+89,20,21,3,107,73,77,46,58,105,94,90,104,105,91,26,10,90,138,37,34,134,84,
+118,138,1,19,145,248,139,185,165,251,192,50,52,39,47,22,205,253,37,2,236,
+111,102,2,174,120,122,107,189,110,115,149,51,1,0,94,252,192,52,40,41,51,50,
+42,41,51,0,0,3,0,76,254,66,5,25,5,86,0,34,0,49,0,61,0,0,5,22,4,51,50,55,38,
+38,53,52,54,55,37,39,55,38,17,52,54,54,51,32,23,39,51,17,22,22,21,20,6,35,
+34,36,39,19,5,17,38,38,35,34,6,6,21,20,22,23,1,23,1,54,54,53,52,38,35,34,
+6,21,20,22,1,123,100,1,0,142,29,30,45,45,57,53,253,25,31,121,227,143,252,
+158,1,11,160,1,137,58,55,219,193,194,254,194,107,101,2,168,73,214,133,126,
+191,105,89,93,1,6,97,1,63,52,53,53,48,49,57,50,29,145,152,3,28,88,53,59,94,
+26,194,84,118,138,1,19,145,248,139,185,165,250,217,27,101,63,134,148,177,
+171,1,156,183,3,92,120,122,107,189,110,115,149,51,1,0,94,252,57,18,68,45,
+43,53,55,45,42,67,0,0,2,0,76,254,78,4,244,5,86,0,40,0,57,0,0,1,34,36,39,55,
+22,4,51,51,17,6,6,7,22,21,20,6,35,34,38,53,52,55,37,39,55,38,17,52,54,54,
+51,50,22,23,39,51,17,22,23,17,1,5,54,55,17,38,38,35,34,6,6,21,20,22,23,37,
+23,4,55,217,254,143,167,71,180,1,29,207,66,101,143,28,87,57,43,59,64,67,253,
+187,31,121,227,132,244,158,127,214,105,1,137,41,35,252,135,2,37,60,67,93,
+214,132,124,182,97,89,96,1,3,97,254,78,112,117,107,121,90,1,243,3,86,75,10,
+84,42,48,77,56,100,83,137,84,111,130,1,1,135,227,127,82,99,161,251,242,3,
+6,253,35,3,57,131,29,12,2,191,119,110,93,169,101,106,138,49,238,94,0,4,0,
+76,254,184,5,49,5,86,0,37,0,52,0,64,0,76,0,0,5,6,6,35,34,38,53,52,54,51,50,
+22,23,54,55,37,39,55,38,17,52,54,54,51,50,22,23,39,51,17,22,22,21,20,6,35,
+34,38,1,5,17,38,38,35,34,6,6,21,20,22,23,37,23,19,22,22,51,50,54,53,52,38,
+35,34,6,7,38,38,35,34,6,21,20,22,51,50,54,3,42,80,127,73,107,132,127,106,
+78,132,75,94,86,252,248,31,121,227,132,244,158,127,214,105,1,137,66,71,128,
+111,76,131,254,8,2,164,93,214,132,124,182,97,89,96,1,3,97,130,56,89,52,57,
+64,65,60,50,84,207,51,94,56,54,63,60,57,52,94,181,83,64,122,110,104,123,67,
+80,102,26,183,84,111,130,1,1,135,227,127,82,99,161,251,42,24,106,76,108,122,
+68,2,139,162,3,7,119,110,93,169,101,106,138,49,238,94,252,203,60,47,53,56,
+51,57,45,63,57,51,57,49,53,58,49,0,3,0,76,254,66,4,168,5,86,0,24,0,44,0,62,
+0,0,1,55,6,35,34,38,39,38,53,52,55,37,39,55,38,17,52,54,54,51,32,23,39,51,
+17,1,23,54,51,50,23,39,17,38,38,35,34,6,6,21,20,22,23,1,23,1,17,38,38,35,
+34,6,21,20,23,54,55,23,6,21,20,51,50,4,31,2,78,121,109,137,8,133,31,254,223,
+31,121,227,143,252,158,1,11,160,1,137,252,207,227,87,114,145,108,1,73,214,
+133,126,191,105,89,93,1,6,97,1,45,57,122,73,91,120,40,33,52,84,78,145,119,
+254,78,59,71,112,99,97,150,70,62,75,84,118,138,1,19,145,248,139,185,165,249,
+12,2,236,61,56,93,81,2,182,120,122,107,189,110,115,149,51,1,0,94,252,123,
+1,36,69,59,108,73,80,47,55,40,72,58,61,119,0,0,4,0,76,254,66,5,156,5,86,0,
+35,0,55,0,73,0,84,0,0,1,55,6,35,34,38,39,38,53,52,55,37,39,55,38,17,52,54,
+54,51,32,23,39,51,17,54,51,50,22,21,20,6,35,34,39,17,1,23,54,51,50,23,39,
+17,38,38,35,34,6,6,21,20,22,23,1,23,1,17,38,38,35,34,6,21,20,23,54,55,23,
+6,21,20,51,50,1,34,6,21,20,22,51,50,53,52,38,4,31,2,78,121,109,137,8,133,
+31,254,223,31,121,227,143,252,158,1,11,160,1,137,35,49,70,90,89,73,44,38,
+252,207,227,87,114,145,108,1,73,214,133,126,191,105,89,93,1,6,97,1,45,57,
+122,73,91,120,40,33,52,84,78,145,119,1,10,28,37,36,29,68,35,254,78,59,71,
+112,99,97,150,70,62,75,84,118,138,1,19,145,248,139,185,165,251,207,24,94,
+78,76,92,24,254,97,2,236,61,56,93,81,2,182,120,122,107,189,110,115,149,51,
+1,0,94,252,123,1,36,69,59,108,73,80,47,55,40,72,58,61,119,2,11,36,30,30,36,
+66,30,36,0,2,253,10,5,125,1,25,7,86,0,20,0,32,0,0,3,7,22,22,51,50,54,55,23,
+6,6,35,34,38,39,5,5,7,37,55,37,5,20,6,35,34,38,53,52,54,51,50,22,207,37,15,
+95,89,98,97,10,121,16,166,144,125,162,27,254,243,1,20,43,254,149,23,1,231,
+1,37,50,40,40,52,53,39,38,52,6,225,14,84,90,111,100,15,157,162,130,126,96,
+94,111,141,150,182,121,39,49,51,37,41,51,52,0,2,0,0,0,0,7,238,7,86,0,11,0,
+91,0,0,1,20,6,35,34,38,53,52,54,51,50,22,1,22,51,50,55,17,54,54,53,52,35,
+34,6,7,6,35,34,38,39,55,22,22,51,50,55,54,55,38,39,55,22,22,51,50,55,23,6,
+6,35,35,20,23,21,20,6,7,17,35,17,6,35,34,39,17,35,36,0,39,55,22,0,23,38,53,
+17,6,6,7,22,22,21,20,35,34,38,53,52,0,55,51,7,4,50,40,41,51,53,39,38,52,253,
+162,48,58,66,57,66,63,116,38,110,72,162,96,125,130,42,111,34,76,58,88,137,
+144,101,20,6,119,11,97,97,186,19,121,16,166,144,19,1,67,63,137,63,60,55,51,
+150,254,196,253,231,187,111,179,2,28,226,3,137,171,10,41,43,100,55,66,1,0,
+221,115,6,250,39,49,51,37,40,52,52,251,243,23,37,2,31,36,69,42,94,28,22,50,
+81,81,67,55,43,46,49,4,56,66,14,104,107,211,14,157,162,2,2,5,63,102,31,250,
+221,2,163,30,20,253,103,230,1,237,227,84,221,254,13,160,48,138,3,99,28,168,
+101,6,51,38,94,90,66,157,1,14,42,0,0,1,0,0,0,0,7,184,7,86,0,72,0,0,1,22,51,
+50,55,17,54,54,53,52,35,34,6,7,6,35,34,38,39,55,22,22,51,50,54,55,54,51,50,
+23,55,37,23,5,23,7,39,6,7,17,35,17,6,35,34,39,17,35,36,0,39,55,22,0,23,38,
+53,17,6,6,7,22,22,21,20,35,34,38,53,52,0,55,51,4,166,48,58,66,57,66,63,116,
+38,110,72,162,96,125,130,42,111,34,76,58,56,113,69,148,118,10,24,7,1,200,
+39,254,126,231,43,92,4,126,137,63,60,55,51,150,254,196,253,231,187,111,179,
+2,28,226,3,137,171,10,41,43,100,55,66,1,0,221,115,3,21,23,37,2,31,36,69,42,
+94,28,22,50,81,81,67,55,43,27,23,50,4,43,121,115,94,96,111,45,129,63,250,
+221,2,163,30,20,253,103,230,1,237,227,84,221,254,13,160,48,138,3,99,28,168,
+101,6,51,38,94,90,66,157,1,14,42,0,2,0,98,255,236,6,170,7,70,0,11,0,81,0,
+0,1,20,6,35,34,38,53,52,54,51,50,22,55,23,6,6,35,34,39,38,35,34,0,17,16,0,
+33,50,54,54,53,52,38,35,34,7,39,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,
+53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,36,2,17,52,18,36,51,50,23,
+22,51,50,54,5,160,52,40,41,54,55,40,38,54,137,129,9,168,151,115,186,185,114,
+253,254,225,1,30,1,2,109,156,81,129,114,111,88,63,78,81,175,153,111,92,103,
+118,41,131,47,199,155,153,191,114,124,122,137,255,241,201,254,211,172,162,
+1,50,210,109,191,192,100,110,94,6,231,40,52,52,40,42,53,53,16,15,185,181,
+50,50,254,137,254,179,254,172,254,129,64,122,80,111,122,41,119,29,24,49,133,
+109,86,117,105,90,86,65,29,87,98,145,174,186,138,121,154,58,30,176,122,191,
+210,193,1,128,1,23,240,1,133,212,50,50,117,0,0,2,0,94,255,236,7,236,7,86,
+0,11,0,120,0,0,1,20,6,35,34,38,53,52,54,51,50,22,1,54,55,54,54,53,52,38,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,22,23,22,51,50,55,17,54,54,
+53,52,35,34,6,7,6,35,34,38,39,55,22,22,51,50,55,54,55,38,39,55,22,22,51,50,
+55,23,6,6,35,35,20,23,21,20,6,7,17,35,17,6,35,34,39,22,21,20,6,35,34,36,2,
+53,52,18,55,23,6,2,21,20,18,22,51,50,54,54,53,52,38,35,34,7,7,2,50,40,41,
+51,53,39,37,53,251,86,75,85,173,154,111,91,105,116,41,132,47,200,155,153,
+191,114,124,94,64,66,79,67,60,66,63,116,39,113,68,162,96,125,130,42,111,34,
+76,58,88,137,144,101,20,6,119,10,98,97,186,19,121,16,166,144,20,1,67,62,137,
+64,63,27,27,9,252,231,199,254,207,164,208,198,86,172,181,127,239,161,109,
+155,82,130,114,110,88,6,250,39,49,51,37,40,52,52,251,144,28,25,49,131,111,
+87,116,107,88,86,65,29,88,97,145,174,187,137,121,154,58,22,61,44,39,2,213,
+36,69,42,94,29,21,50,81,81,67,55,43,46,49,4,56,66,14,103,108,211,14,157,162,
+2,2,5,64,101,31,250,221,1,237,32,5,40,45,189,212,178,1,76,225,242,1,170,157,
+100,133,254,143,223,176,254,236,150,62,122,82,111,122,41,0,0,1,0,94,255,236,
+7,182,7,86,0,101,0,0,1,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,21,20,6,7,22,23,22,51,50,55,17,54,54,53,52,35,34,6,7,6,35,34,38,
+39,55,22,22,51,50,54,55,54,51,50,23,55,37,23,5,23,7,39,6,7,17,35,17,6,35,
+34,39,22,21,20,6,35,34,36,2,53,52,18,55,23,6,2,21,20,18,22,51,50,54,54,53,
+52,38,35,34,7,2,88,75,85,173,154,111,91,105,116,41,132,47,200,155,153,191,
+114,124,94,64,66,79,67,60,66,63,116,39,113,68,162,96,125,130,42,111,34,76,
+58,56,113,69,148,118,10,24,7,1,200,39,254,126,231,43,93,3,126,137,64,63,26,
+29,10,252,231,199,254,207,164,208,198,86,172,181,127,239,161,109,155,82,130,
+114,110,88,2,178,28,25,49,131,111,87,116,107,88,86,65,29,88,97,145,174,187,
+137,121,154,58,22,61,44,39,2,213,36,69,42,94,29,21,50,81,81,67,55,43,27,23,
+50,4,43,121,115,94,96,111,46,130,63,250,221,1,237,32,5,37,48,189,212,178,
+1,76,225,242,1,170,157,100,133,254,143,223,176,254,236,150,62,122,82,111,
+122,41,0,2,251,35,5,147,0,131,7,86,0,11,0,37,0,0,3,20,6,35,34,38,53,52,54,
+51,50,22,1,54,36,51,50,23,38,39,55,22,22,51,50,55,23,6,6,7,23,7,38,38,35,
+34,6,7,102,51,40,40,52,53,39,37,54,251,137,151,1,22,154,83,82,15,6,121,10,
+97,97,184,19,121,13,122,96,18,90,131,229,132,132,237,120,6,250,38,50,51,37,
+40,52,51,254,207,129,112,22,45,53,14,103,108,211,14,132,154,22,13,91,113,
+94,98,109,0,0,1,251,35,5,100,0,145,7,86,0,17,0,0,1,54,36,51,50,23,37,23,5,
+5,7,37,55,38,35,34,6,7,251,35,151,1,22,154,160,138,1,212,41,254,22,1,19,43,
+254,150,12,94,107,132,237,120,5,242,129,112,59,174,117,176,94,111,142,82,
+30,98,109,0,0,2,251,35,5,125,1,229,7,86,0,31,0,43,0,0,19,7,22,22,51,50,54,
+55,23,6,6,35,34,38,39,7,5,7,37,55,38,35,34,6,7,39,54,36,51,50,23,37,5,20,
+6,35,34,38,53,52,54,51,50,22,63,61,15,84,79,88,87,10,120,14,156,135,116,149,
+27,246,1,20,43,254,150,10,85,102,132,237,120,92,151,1,22,154,143,119,1,167,
+1,0,51,40,41,51,53,39,37,54,6,225,22,81,85,110,101,15,156,163,127,121,88,
+94,111,141,64,24,98,109,95,129,112,43,158,121,38,50,51,37,41,51,51,0,0,2,
+251,193,5,90,1,0,7,86,0,11,0,49,0,0,19,20,6,35,34,38,53,52,54,51,50,22,1,
+54,53,52,35,34,6,7,6,35,34,38,39,55,22,22,51,50,54,55,54,55,38,39,55,22,22,
+51,50,55,23,6,6,35,35,21,20,7,23,51,40,41,51,53,39,37,54,254,227,37,117,32,
+105,69,158,85,124,129,43,110,34,76,58,47,95,69,141,90,20,6,119,10,97,97,186,
+19,121,14,168,144,18,51,6,250,38,50,51,37,40,52,51,254,96,39,43,94,28,22,
+50,78,84,67,55,43,22,24,48,5,54,68,14,103,108,211,14,156,163,9,80,61,0,1,
+251,193,5,90,0,203,7,86,0,32,0,0,19,5,23,7,39,6,7,39,54,53,52,35,34,6,7,6,
+35,34,38,39,55,22,22,51,50,54,55,54,51,50,23,55,37,203,254,125,231,43,92,
+2,49,123,37,117,32,105,69,158,85,124,129,43,110,34,76,58,51,108,65,142,109,
+11,23,7,1,201,6,227,94,96,111,45,80,57,41,39,43,94,28,22,50,78,84,67,55,43,
+27,23,50,4,43,121,0,2,251,160,5,90,1,209,7,86,0,47,0,59,0,0,1,6,6,35,34,38,
+39,7,23,7,39,6,7,39,54,53,52,38,35,34,7,6,35,34,38,38,39,55,22,22,51,50,54,
+55,54,51,50,23,55,37,23,7,22,22,51,50,54,55,7,20,6,35,34,38,53,52,54,51,50,
+22,1,209,14,157,134,122,154,21,223,231,43,92,2,49,123,37,53,44,67,124,124,
+72,62,80,65,28,110,26,56,43,38,84,52,115,96,12,12,7,1,201,39,48,13,87,81,
+88,87,9,86,50,40,40,52,53,39,38,52,6,233,156,163,141,132,54,96,111,45,80,
+57,41,39,43,44,50,50,50,28,71,63,67,53,45,28,22,50,3,42,121,115,12,88,90,
+109,102,27,39,49,51,37,41,51,52,0,2,252,139,0,0,1,135,7,86,0,11,0,56,0,0,
+1,20,6,35,34,38,53,52,54,51,50,22,5,22,22,51,50,54,55,23,6,7,22,51,50,54,
+55,54,51,50,22,21,20,6,7,17,35,17,54,54,53,52,38,35,34,6,7,6,6,35,34,39,6,
+35,34,38,39,254,43,52,40,40,50,52,38,38,54,254,217,11,96,98,93,99,11,120,
+6,28,20,25,34,74,68,115,94,111,120,67,62,137,66,63,55,52,29,60,83,46,99,53,
+76,49,82,129,144,166,16,6,250,37,51,49,39,40,52,50,16,101,109,105,105,14,
+83,60,6,14,21,34,109,98,64,101,31,250,221,5,66,36,69,42,45,49,11,23,14,21,
+30,69,162,157,0,1,252,244,0,0,1,135,7,86,0,39,0,0,1,22,22,51,50,54,55,54,
+51,50,22,21,20,6,7,17,35,17,54,54,53,52,38,35,34,6,7,6,6,35,34,38,39,7,5,
+7,37,55,37,23,254,194,14,42,37,34,74,68,115,94,111,120,67,62,137,66,63,55,
+52,29,60,83,46,99,53,78,105,36,209,1,20,43,254,150,22,2,45,41,6,168,29,26,
+14,21,34,109,98,64,101,31,250,221,5,66,36,69,42,45,49,11,23,14,21,69,73,75,
+94,111,142,149,207,117,0,2,251,158,0,0,1,197,7,86,0,50,0,62,0,0,1,7,22,22,
+51,50,54,55,23,6,7,51,50,54,55,54,51,50,22,21,20,6,7,17,35,17,54,54,53,52,
+38,35,34,6,7,6,6,35,34,39,6,35,34,38,39,7,5,7,37,55,37,5,20,6,35,34,38,53,
+52,54,51,50,22,253,197,61,15,83,79,89,86,10,120,7,16,9,34,74,68,115,94,111,
+121,67,62,138,66,63,54,52,29,60,83,46,99,54,48,34,76,135,116,149,27,246,1,
+20,43,254,150,22,1,232,1,0,50,40,41,52,53,40,38,52,6,225,22,81,85,109,102,
+15,72,48,14,21,34,108,99,63,101,32,250,221,5,66,36,69,42,45,49,11,23,14,21,
+11,79,127,121,88,94,111,141,150,182,121,39,49,51,37,41,51,52,0,0,1,253,250,
+253,233,0,209,255,246,0,6,0,0,1,5,7,37,39,1,23,254,168,2,41,29,253,109,39,
+1,26,93,254,224,132,115,152,94,1,23,86,0,0,1,250,127,5,147,255,176,6,227,
+0,13,0,0,1,54,36,51,50,4,23,7,38,36,35,34,4,7,250,127,164,1,66,180,175,1,
+53,179,86,149,254,238,156,158,254,231,139,5,246,125,112,105,132,99,111,96,
+100,107,0,2,250,127,5,147,0,104,7,86,0,11,0,36,0,0,3,20,6,35,34,38,53,52,
+54,51,50,22,1,54,36,51,50,23,38,39,55,22,22,51,50,55,23,6,7,23,7,38,36,35,
+34,4,7,129,50,40,40,52,53,39,38,52,251,0,164,1,66,180,110,111,17,6,121,10,
+98,97,183,20,120,24,181,21,86,149,254,238,156,158,254,231,139,6,250,39,49,
+51,37,40,52,52,254,212,125,112,28,49,55,14,103,108,211,14,242,59,12,99,111,
+96,100,107,0,1,250,127,5,100,0,145,7,86,0,17,0,0,1,54,36,51,50,23,37,23,5,
+5,7,37,55,38,35,34,4,7,250,127,164,1,66,180,200,164,1,227,41,254,22,1,19,
+43,254,150,10,130,150,158,254,231,139,5,246,125,112,65,180,117,176,94,111,
+142,67,45,100,107,0,2,250,127,5,125,1,229,7,86,0,31,0,43,0,0,19,7,22,22,51,
+50,54,55,23,6,6,35,34,38,39,7,5,7,37,55,38,35,34,4,7,39,54,36,51,50,23,37,
+5,20,6,35,34,38,53,52,54,51,50,22,63,61,15,84,79,88,87,10,120,14,156,135,
+116,149,27,246,1,20,43,254,150,8,122,144,158,254,231,139,86,164,1,66,180,
+176,149,1,185,1,0,51,40,41,51,53,39,37,54,6,225,22,81,85,110,101,15,156,163,
+127,121,88,94,111,141,50,38,100,107,99,125,112,50,165,121,38,50,51,37,41,
+51,51,0,1,251,137,5,147,255,176,6,227,0,13,0,0,1,54,36,51,50,22,23,7,38,38,
+35,34,6,7,251,137,136,1,3,138,138,251,141,84,119,208,121,121,213,113,5,242,
+127,114,111,130,95,112,95,97,110,0,0,2,251,137,5,147,0,147,7,86,0,11,0,36,
+0,0,3,20,6,35,34,38,53,52,54,51,50,22,1,54,36,51,50,23,38,39,55,22,22,51,
+50,55,23,2,7,23,7,38,38,35,34,6,7,86,50,40,40,52,53,39,38,52,251,223,136,
+1,3,138,62,66,14,6,121,10,98,97,183,20,120,27,210,10,84,119,208,121,121,213,
+113,6,250,39,49,51,37,40,52,52,254,208,127,114,15,37,54,14,103,108,211,14,
+254,248,45,8,95,112,95,97,110,0,0,1,251,137,5,100,0,145,7,86,0,17,0,0,1,54,
+36,51,50,23,37,23,5,5,7,37,55,38,35,34,6,7,251,137,136,1,3,138,138,124,1,
+196,41,254,22,1,19,43,254,150,14,71,80,121,213,113,5,242,127,114,53,168,117,
+176,94,111,142,91,21,97,110,0,0,2,251,137,5,125,1,229,7,86,0,31,0,43,0,0,
+19,7,22,22,51,50,54,55,23,6,6,35,34,38,39,7,5,7,37,55,38,35,34,6,7,39,54,
+36,51,50,23,37,5,20,6,35,34,38,53,52,54,51,50,22,63,61,15,84,79,88,87,10,
+120,14,156,135,116,149,27,246,1,20,43,254,150,11,60,76,121,213,113,84,136,
+1,3,138,118,104,1,155,1,0,51,40,41,51,53,39,37,54,6,225,22,81,85,110,101,
+15,156,163,127,121,88,94,111,141,72,16,97,110,95,127,114,39,154,121,38,50,
+51,37,41,51,51,0,0,2,252,238,253,203,0,215,255,242,0,32,0,43,0,0,5,54,53,
+52,39,55,22,21,20,7,30,2,51,50,54,55,23,6,35,34,38,39,6,35,34,38,53,52,54,
+51,50,22,23,38,38,35,34,6,21,20,22,51,50,254,237,13,4,135,4,42,40,63,56,39,
+29,44,21,92,72,114,70,119,67,105,192,122,140,140,103,70,128,26,68,94,51,58,
+65,69,68,128,233,54,70,32,44,19,53,31,134,91,35,42,22,27,26,84,92,64,59,143,
+116,105,104,115,53,163,57,46,55,51,53,56,255,255,253,252,253,203,1,115,0,
+25,2,2,0,59,0,0,255,255,254,88,253,203,0,174,0,66,2,2,0,60,0,0,255,255,254,
+106,253,74,0,188,0,109,2,2,0,61,0,0,0,2,252,238,252,203,0,215,254,184,0,30,
+0,41,0,0,3,21,20,7,30,2,51,50,54,55,23,6,35,34,38,39,6,35,34,38,53,52,54,
+51,50,22,23,54,53,53,7,38,38,35,34,6,21,20,22,51,50,125,43,45,69,50,33,29,
+44,21,92,72,114,70,119,67,108,189,122,140,140,103,67,126,76,14,60,65,95,52,
+58,65,69,68,126,254,184,34,129,88,40,43,16,27,26,84,92,64,59,143,116,105,
+104,115,51,58,55,66,27,255,55,48,55,51,53,56,0,1,253,252,252,203,1,115,254,
+184,0,30,0,0,3,35,34,21,20,22,51,50,54,54,55,22,51,50,55,23,6,35,34,38,39,
+6,35,34,38,53,52,54,55,53,55,125,61,197,68,59,51,77,84,48,153,132,33,26,23,
+30,58,64,135,64,100,180,112,144,140,114,137,254,35,119,49,60,30,75,68,140,
+8,122,15,56,54,130,121,108,94,117,8,31,14,0,0,1,254,88,252,203,0,174,254,
+240,0,28,0,0,3,54,51,50,22,21,20,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,
+50,53,52,38,35,34,7,123,51,62,84,100,141,135,148,174,93,104,80,71,73,101,
+94,147,42,34,34,27,254,59,25,101,77,102,113,145,123,84,134,63,97,32,95,57,
+75,79,93,36,37,12,0,1,254,106,252,45,0,188,255,49,0,41,0,0,1,38,38,53,52,
+54,55,23,6,6,21,20,22,51,51,7,6,6,21,20,22,51,50,53,52,38,35,34,7,39,54,51,
+50,22,21,20,6,35,34,38,53,52,254,245,65,74,119,113,49,75,72,78,75,29,8,83,
+79,96,88,142,42,34,30,32,37,54,59,85,99,139,129,141,172,253,217,18,83,53,
+73,92,25,108,10,39,35,40,42,113,11,74,56,64,69,69,26,30,13,99,24,90,68,90,
+98,131,105,127,255,255,254,203,252,206,0,109,254,183,0,3,0,66,0,0,255,1,0,
+2,254,8,252,45,0,188,254,215,0,50,0,61,0,0,3,38,53,52,54,51,50,22,21,20,6,
+35,34,38,53,52,54,54,55,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,22,21,20,6,7,7,14,2,21,20,22,23,54,54,53,52,38,35,34,6,21,20,195,18,114,
+101,86,100,167,164,178,183,49,98,111,43,39,92,27,69,64,71,81,17,117,23,149,
+126,119,137,86,131,78,61,69,32,94,201,84,74,35,39,49,49,252,146,32,43,60,
+79,80,61,85,89,103,100,49,69,52,33,12,11,32,29,22,32,36,44,42,32,26,16,46,
+50,77,89,95,73,75,74,39,23,18,26,34,22,50,49,2,4,33,33,19,24,38,25,27,0,0,
+2,254,8,252,45,0,188,254,229,0,51,0,61,0,0,3,38,39,38,38,53,52,54,55,55,62,
+2,53,52,35,34,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,7,14,2,21,20,22,23,
+38,53,52,54,51,50,22,21,20,7,22,23,39,54,54,53,52,38,35,34,21,20,80,48,23,
+176,177,94,156,49,78,47,35,133,152,17,117,23,147,128,122,134,96,121,80,72,
+60,28,91,84,9,115,100,86,100,218,38,33,133,84,82,35,39,98,252,45,55,31,1,
+89,84,67,82,38,12,19,15,27,25,59,74,29,24,14,41,43,70,79,83,68,70,67,31,21,
+19,20,30,21,43,41,3,26,24,62,78,76,55,123,23,42,32,161,2,25,32,18,23,70,13,
+0,0,2,252,238,252,84,0,215,254,57,0,30,0,41,0,0,3,21,20,7,22,22,51,50,54,
+55,23,6,35,34,38,39,6,35,34,38,38,53,52,54,51,50,22,23,54,53,53,7,38,38,35,
+34,6,21,20,22,51,50,125,43,69,85,43,29,44,21,92,71,115,70,119,67,108,189,
+78,118,66,140,103,67,127,74,15,60,65,94,53,56,67,70,67,126,254,57,26,128,
+88,60,40,27,27,84,93,64,59,143,49,100,72,104,115,52,57,60,62,18,247,55,49,
+56,51,53,55,0,0,1,253,252,252,84,1,115,254,66,0,29,0,0,3,35,34,21,20,22,51,
+50,54,55,22,51,50,55,23,6,35,34,38,39,6,35,34,38,53,52,54,55,53,55,125,61,
+197,68,59,85,117,58,153,132,29,30,23,35,53,64,135,64,100,180,111,145,140,
+114,137,253,172,119,49,59,90,82,140,9,123,15,56,54,130,121,108,94,117,8,31,
+15,0,1,254,88,252,84,0,174,254,121,0,28,0,0,3,54,51,50,22,21,20,6,35,34,38,
+53,52,54,55,23,6,6,21,20,22,51,50,53,52,38,35,34,7,123,54,59,84,100,141,135,
+146,176,93,104,80,72,72,100,95,147,42,34,31,30,253,197,24,101,77,102,113,
+143,125,84,134,63,96,34,95,56,74,79,92,36,38,13,255,255,254,203,252,87,0,
+109,254,64,0,3,0,66,0,0,254,138,0,2,253,29,252,45,0,133,253,176,0,26,0,36,
+0,0,1,54,55,55,6,7,22,22,51,50,55,23,6,35,34,38,39,6,35,34,38,53,52,54,51,
+50,22,23,38,38,35,34,6,21,20,51,50,254,240,21,5,125,14,46,33,71,44,53,29,
+84,66,96,61,90,63,105,170,103,118,118,89,75,116,14,54,84,53,46,48,108,104,
+253,59,52,59,6,108,84,26,36,41,80,78,41,53,110,107,86,84,100,52,143,46,42,
+43,36,84,0,0,1,254,43,252,45,1,49,253,193,0,28,0,0,3,35,34,21,20,22,51,50,
+54,55,22,51,50,55,23,6,35,34,39,6,35,34,38,53,52,54,55,53,55,125,47,170,54,
+55,69,98,54,129,119,24,25,20,21,55,114,114,89,154,101,126,122,101,121,253,
+70,90,38,46,71,74,117,6,112,13,97,113,102,89,80,97,5,18,13,0,0,1,254,141,
+252,45,0,219,254,16,0,28,0,0,3,6,21,20,22,51,50,53,52,38,35,34,7,39,54,51,
+50,22,22,21,20,6,35,34,38,38,53,52,55,123,121,94,101,147,36,33,27,29,34,48,
+58,56,80,38,142,132,97,141,78,187,253,178,67,86,65,64,81,28,30,10,96,20,43,
+71,43,91,104,51,104,76,155,97,255,255,255,215,252,45,2,41,255,49,0,3,1,21,
+1,109,0,0,0,1,254,203,252,45,0,43,253,193,0,3,0,0,1,55,19,7,254,203,108,244,
+109,253,111,82,254,186,78,0,255,255,0,0,252,45,2,180,254,215,0,3,1,23,1,248,
+0,0,255,255,0,0,252,45,2,180,254,229,0,3,1,24,1,248,0,0,255,255,0,76,253,
+205,4,254,5,86,2,34,0,19,0,0,0,3,0,66,4,106,0,0,255,255,0,76,253,205,5,177,
+5,78,2,34,0,20,0,0,0,3,0,66,5,68,0,0,255,255,0,76,253,205,5,170,5,86,2,34,
+0,21,0,0,0,3,0,66,5,61,0,0,255,255,0,76,253,205,5,156,5,86,2,34,0,22,0,0,
+0,3,0,66,5,47,0,0,255,255,0,76,253,205,5,137,5,86,2,34,0,23,0,0,0,3,0,66,
+3,152,0,0,255,255,0,76,253,205,4,201,5,86,2,34,0,24,0,0,0,3,0,66,3,139,0,
+0,255,255,0,76,253,205,4,217,5,86,2,34,0,25,0,0,0,3,0,66,4,92,0,0,255,255,
+0,76,253,205,4,254,5,86,2,34,0,26,0,0,0,3,0,66,4,94,0,0,255,255,0,76,253,
+205,4,248,5,78,2,34,0,27,0,0,0,3,0,66,3,176,0,0,255,255,0,84,253,205,4,233,
+5,86,2,34,0,28,0,0,0,3,0,66,3,242,0,0,255,255,0,76,253,205,4,172,5,86,2,34,
+0,29,0,0,0,3,0,66,3,113,0,0,255,255,0,84,253,205,5,102,5,86,2,34,0,30,0,0,
+0,3,0,66,4,29,0,0,255,255,0,76,253,205,4,217,5,86,2,34,0,31,0,0,0,3,0,66,
+3,152,0,0,255,255,0,76,253,205,4,217,5,86,2,34,0,32,0,0,0,3,0,66,3,203,0,
+0,255,255,0,82,253,205,5,150,5,86,2,34,0,33,0,0,0,3,0,66,5,41,0,0,255,255,
+0,76,253,205,4,217,5,86,2,34,0,34,0,0,0,3,0,66,3,178,0,0,255,255,0,61,253,
+205,5,117,5,86,2,34,0,35,0,0,0,3,0,66,5,8,0,0,255,255,0,76,253,205,4,199,
+5,86,2,34,0,36,0,0,0,3,0,66,3,250,0,0,255,255,0,72,253,205,5,19,5,86,2,34,
+0,37,0,0,0,3,0,66,4,166,0,0,255,255,0,76,253,205,4,199,5,86,2,34,0,38,0,0,
+0,3,0,66,3,252,0,0,255,255,0,76,253,205,5,156,5,86,2,34,0,39,0,0,0,3,0,66,
+5,47,0,0,255,255,0,76,253,205,6,43,5,86,2,34,0,40,0,0,0,3,0,66,5,47,0,0,255,
+255,0,76,253,205,4,201,5,86,2,34,0,41,0,0,0,3,0,66,3,254,0,0,255,255,0,76,
+253,205,5,104,5,86,2,34,0,42,0,0,0,3,0,66,4,74,0,0,255,255,0,76,253,205,5,
+156,5,86,2,34,0,43,0,0,0,3,0,66,5,47,0,0,255,255,0,31,253,205,5,228,5,86,
+2,34,0,44,0,0,0,3,0,66,5,119,0,0,255,255,0,76,253,205,5,61,5,86,2,34,0,45,
+0,0,0,3,0,66,3,182,0,0,255,255,0,76,253,205,5,158,5,86,2,34,0,46,0,0,0,3,
+0,66,4,104,0,0,255,255,0,76,253,205,4,254,5,86,2,34,0,47,0,0,0,3,0,66,4,119,
+0,0,255,255,0,76,253,205,4,201,5,86,2,34,0,48,0,0,0,3,0,66,4,0,0,0,255,255,
+0,61,253,205,5,177,5,86,2,34,0,49,0,0,0,3,0,66,5,68,0,0,255,255,0,76,253,
+205,5,181,5,86,2,34,0,50,0,0,0,3,0,66,5,72,0,0,255,255,0,76,253,205,5,146,
+5,86,2,34,0,51,0,0,0,3,0,66,5,37,0,0,255,255,0,76,253,145,4,170,5,86,2,34,
+0,52,0,0,0,3,0,66,3,227,255,196,255,255,0,76,253,205,4,217,5,86,2,34,0,31,
+0,0,0,35,0,53,4,190,0,0,0,3,0,66,4,106,0,0,255,255,0,76,253,205,4,217,5,86,
+2,34,0,32,0,0,0,35,0,53,4,182,0,0,0,3,0,66,4,98,0,0,255,255,0,31,253,56,6,
+57,5,86,2,34,0,71,0,0,0,3,0,66,5,98,255,107,255,255,0,78,253,205,4,197,5,
+119,2,34,0,87,0,0,0,3,0,66,4,88,0,0,255,255,0,76,253,205,5,7,5,86,2,34,0,
+19,0,0,0,35,0,53,4,238,0,0,0,3,0,66,4,154,0,0,255,255,0,76,253,205,5,177,
+5,78,2,34,0,20,0,0,0,35,0,53,4,156,0,0,0,3,0,66,5,68,0,0,255,255,0,76,253,
+205,5,170,5,86,2,34,0,21,0,0,0,35,0,53,4,154,0,0,0,3,0,66,5,61,0,0,255,255,
+0,76,253,205,5,156,5,86,2,34,0,22,0,0,0,35,0,53,4,184,0,0,0,3,0,66,5,47,0,
+0,255,255,0,76,253,205,5,137,5,86,2,34,0,23,0,0,0,35,0,53,4,193,0,0,0,3,0,
+66,4,109,0,0,255,255,0,76,253,205,4,207,5,86,2,34,0,24,0,0,0,35,0,53,4,182,
+0,0,0,3,0,66,4,98,0,0,255,255,0,76,253,205,4,222,5,86,2,34,0,25,0,0,0,35,
+0,53,4,197,0,0,0,3,0,66,4,113,0,0,255,255,0,76,253,205,4,254,5,86,2,34,0,
+26,0,0,0,35,0,53,4,168,0,0,0,3,0,66,4,94,0,0,255,255,0,76,253,205,4,248,5,
+78,2,34,0,27,0,0,0,35,0,53,4,152,0,0,0,3,0,66,4,68,0,0,255,255,0,84,253,205,
+4,252,5,86,2,34,0,28,0,0,0,35,0,53,4,227,0,0,0,3,0,66,4,143,0,0,255,255,0,
+76,253,205,4,172,5,86,2,34,0,29,0,0,0,35,0,53,4,135,0,0,0,3,0,66,4,51,0,0,
+255,255,0,84,253,205,5,102,5,86,2,34,0,30,0,0,0,35,0,53,5,39,0,0,0,3,0,66,
+4,211,0,0,255,255,0,82,253,205,5,150,5,86,2,34,0,33,0,0,0,35,0,53,4,184,0,
+0,0,3,0,66,5,41,0,0,255,255,0,76,253,205,4,217,5,86,2,34,0,34,0,0,0,35,0,
+53,4,178,0,0,0,3,0,66,4,94,0,0,255,255,0,61,253,205,5,117,5,86,2,34,0,35,
+0,0,0,35,0,53,4,141,0,0,0,3,0,66,5,8,0,0,255,255,0,76,253,205,4,199,5,86,
+2,34,0,36,0,0,0,35,0,53,4,174,0,0,0,3,0,66,4,90,0,0,255,255,0,72,253,205,
+5,19,5,86,2,34,0,37,0,0,0,35,0,53,4,115,0,0,0,3,0,66,4,166,0,0,255,255,0,
+76,253,205,4,209,5,86,2,34,0,38,0,0,0,35,0,53,4,184,0,0,0,3,0,66,4,100,0,
+0,255,255,0,76,253,205,5,156,5,86,2,34,0,39,0,0,0,35,0,53,4,225,0,0,0,3,0,
+66,5,47,0,0,255,255,0,76,253,205,6,43,5,86,2,34,0,40,0,0,0,35,0,53,4,225,
+0,0,0,3,0,66,5,47,0,0,255,255,0,76,253,205,4,215,5,86,2,34,0,41,0,0,0,35,
+0,53,4,190,0,0,0,3,0,66,4,106,0,0,255,255,0,76,253,205,5,104,5,86,2,34,0,
+42,0,0,0,35,0,53,4,229,0,0,0,3,0,66,4,145,0,0,255,255,0,76,253,205,5,156,
+5,86,2,34,0,43,0,0,0,35,0,53,4,242,0,0,0,3,0,66,5,47,0,0,255,255,0,31,253,
+205,5,228,5,86,2,34,0,44,0,0,0,35,0,53,4,236,0,0,0,3,0,66,5,119,0,0,255,255,
+0,76,253,205,5,61,5,86,2,34,0,45,0,0,0,35,0,53,4,152,0,0,0,3,0,66,4,68,0,
+0,255,255,0,76,253,205,5,158,5,86,2,34,0,46,0,0,0,35,0,53,4,205,0,0,0,3,0,
+66,4,121,0,0,255,255,0,76,253,205,4,254,5,86,2,34,0,47,0,0,0,35,0,53,4,213,
+0,0,0,3,0,66,4,129,0,0,255,255,0,76,253,205,4,215,5,86,2,34,0,48,0,0,0,35,
+0,53,4,190,0,0,0,3,0,66,4,106,0,0,255,255,0,61,253,205,5,177,5,86,2,34,0,
+49,0,0,0,35,0,53,4,150,0,0,0,3,0,66,5,68,0,0,255,255,0,76,253,205,5,181,5,
+86,2,34,0,50,0,0,0,35,0,53,4,182,0,0,0,3,0,66,5,72,0,0,255,255,0,76,253,205,
+5,146,5,86,2,34,0,51,0,0,0,35,0,53,4,160,0,0,0,3,0,66,5,37,0,0,255,255,0,
+76,253,145,4,183,5,86,2,34,0,52,0,0,0,35,0,53,4,156,255,218,0,3,0,66,4,74,
+255,196,255,255,0,31,253,56,6,57,5,86,2,34,0,71,0,0,0,35,0,53,4,227,0,0,0,
+3,0,66,5,98,255,107,255,255,0,78,253,205,4,197,5,119,2,34,0,87,0,0,0,35,0,
+53,4,147,0,0,0,3,0,66,4,88,0,0,255,255,0,31,253,205,5,252,5,86,2,34,0,167,
+0,0,0,3,0,66,5,143,0,0,0,2,0,168,255,236,1,156,5,182,0,3,0,14,0,0,1,35,3,
+51,3,50,22,21,20,6,35,34,38,53,52,1,94,117,40,198,100,56,65,65,56,59,64,1,
+156,4,26,251,54,65,62,62,67,65,64,127,0,2,0,156,4,37,2,221,6,51,0,3,0,7,0,
+0,1,3,35,3,33,3,35,3,1,102,41,120,41,2,65,41,121,41,6,51,253,242,2,14,253,
+242,2,14,0,2,0,70,0,0,4,244,5,66,0,27,0,31,0,0,1,21,33,3,35,19,33,3,35,19,
+33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,33,3,33,33,19,33,4,172,254,
+210,71,133,71,254,216,70,133,70,254,250,1,29,63,254,237,1,42,69,133,69,1,
+42,70,133,70,1,7,254,225,63,254,82,1,41,63,254,215,1,252,125,254,129,1,127,
+254,129,1,127,125,1,82,125,1,119,254,137,1,119,254,137,125,254,174,1,82,0,
+0,5,0,100,255,236,6,66,5,86,0,11,0,21,0,25,0,37,0,47,0,0,1,34,38,53,52,54,
+51,50,22,21,20,6,39,50,17,16,35,34,6,21,20,22,1,1,35,1,19,34,38,53,52,54,
+51,50,22,21,20,6,39,50,17,16,35,34,6,21,20,22,1,143,140,159,154,145,145,163,
+158,150,170,170,82,79,78,3,251,252,205,149,3,51,108,140,159,154,145,144,164,
+159,149,170,170,82,79,79,2,53,212,190,196,203,209,190,195,207,129,1,17,1,
+16,135,137,137,136,2,140,250,190,5,66,250,170,211,190,196,203,210,189,195,
+206,129,1,16,1,14,135,135,137,135,0,1,0,156,4,35,1,102,6,51,0,3,0,0,1,3,35,
+3,1,102,41,120,41,6,51,253,240,2,16,0,0,1,0,133,254,66,2,102,6,156,0,13,0,
+0,1,51,6,2,17,16,18,23,35,38,2,17,16,18,1,205,153,169,166,164,169,151,154,
+174,171,6,156,230,253,237,254,199,254,202,253,243,229,200,2,61,1,38,1,31,
+2,65,0,1,0,111,254,66,2,80,6,156,0,13,0,0,1,35,54,18,17,16,2,39,51,22,18,
+17,16,2,1,8,153,169,166,164,169,151,157,171,170,254,66,229,2,19,1,57,1,54,
+2,13,230,206,253,198,254,221,254,225,253,193,0,1,0,63,2,221,3,186,6,51,0,
+14,0,0,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,2,80,33,1,109,30,254,158,223,
+151,168,154,155,221,254,159,29,1,107,35,6,51,254,144,98,162,35,254,215,90,
+1,80,254,176,90,1,41,35,162,98,1,112,0,0,1,0,102,0,182,4,41,4,150,0,11,0,
+0,1,21,33,17,35,17,33,53,33,17,51,17,4,41,254,100,139,254,100,1,156,139,2,
+233,137,254,86,1,170,137,1,173,254,83,0,1,0,106,254,248,1,154,0,238,0,6,0,
+0,37,23,6,3,35,18,55,1,139,15,53,121,130,86,25,238,23,206,254,239,1,66,180,
+0,0,1,0,82,2,100,2,66,2,252,0,3,0,0,19,53,33,21,82,1,240,2,100,152,152,0,
+0,1,0,133,255,236,1,119,0,236,0,11,0,0,55,50,22,21,20,6,35,34,38,53,52,54,
+252,58,65,65,58,56,63,62,236,65,62,63,66,66,63,63,64,0,0,1,0,74,254,66,3,
+27,6,156,0,3,0,0,1,1,35,1,3,27,253,194,147,2,61,6,156,247,166,8,90,0,0,2,
+0,139,255,236,4,8,5,86,0,11,0,23,0,0,5,34,2,17,16,18,51,50,18,17,16,2,39,
+50,18,17,16,2,35,34,2,17,16,18,2,72,222,223,218,227,221,227,222,226,158,141,
+141,158,155,140,141,20,1,102,1,78,1,97,1,85,254,159,254,171,254,160,254,172,
+133,1,8,1,39,1,39,1,10,254,252,254,211,254,214,254,251,0,0,1,0,201,0,0,3,
+203,5,66,0,14,0,0,37,33,17,52,55,6,7,7,39,1,51,17,33,21,33,1,6,1,25,8,49,
+72,143,86,1,110,125,1,23,253,59,129,3,57,150,80,53,58,117,107,1,27,251,63,
+129,0,0,1,0,137,0,0,4,2,5,86,0,28,0,0,51,53,1,62,4,53,52,38,35,34,6,7,39,
+54,51,50,22,21,20,6,6,7,1,21,33,21,137,1,111,108,93,65,37,16,134,120,88,154,
+94,79,187,224,187,219,65,130,151,254,223,2,178,129,1,107,106,103,94,83,80,
+43,111,121,57,72,104,158,197,168,91,163,170,149,254,225,8,133,0,1,0,131,255,
+236,3,250,5,86,0,39,0,0,1,21,22,22,21,20,4,35,34,38,39,53,22,51,32,17,52,
+38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,2,184,158,
+164,254,245,249,117,176,78,176,201,1,106,196,199,137,139,168,184,139,123,
+94,165,95,74,112,198,110,199,219,144,2,197,9,20,162,135,192,211,35,38,144,
+84,1,12,125,123,131,141,123,98,111,51,64,109,77,62,181,155,127,168,0,2,0,
+86,0,0,4,63,5,74,0,10,0,18,0,0,1,17,35,17,33,53,1,51,17,51,21,1,52,55,35,
+6,7,1,33,3,113,146,253,119,2,121,162,206,254,160,10,8,38,50,254,109,1,233,
+1,63,254,193,1,63,123,3,144,252,121,132,2,60,113,186,85,73,253,187,0,1,0,
+166,255,236,3,250,5,66,0,28,0,0,55,53,22,22,51,50,54,53,52,38,35,34,7,39,
+19,33,21,33,3,54,51,50,22,22,21,20,4,35,34,166,66,189,101,167,179,176,176,
+88,147,82,49,2,164,253,225,35,105,106,138,209,114,254,243,235,225,53,144,
+39,45,152,147,143,135,26,51,2,119,134,254,99,22,92,179,122,208,240,0,2,0,
+147,255,236,4,8,5,86,0,21,0,34,0,0,1,21,38,35,34,2,3,51,54,51,50,22,21,20,
+6,35,34,2,17,16,33,50,19,52,38,35,34,6,6,21,20,22,51,50,54,3,160,71,97,223,
+229,11,12,106,220,182,215,232,196,208,249,2,103,91,30,143,132,86,143,80,168,
+135,132,149,5,70,140,23,254,247,254,228,158,218,190,209,245,1,57,1,26,3,23,
+252,88,134,149,73,117,62,141,207,164,0,0,1,0,129,0,0,4,8,5,66,0,6,0,0,1,33,
+53,33,21,1,35,3,104,253,25,3,135,253,207,168,4,184,138,123,251,57,0,3,0,139,
+255,236,4,6,5,86,0,22,0,34,0,48,0,0,1,22,22,21,20,6,35,34,38,53,52,37,38,
+38,53,52,54,51,50,22,21,20,6,5,54,54,53,52,38,35,34,6,21,20,22,23,6,6,21,
+20,22,51,50,54,54,53,52,38,39,2,215,161,142,239,201,215,236,1,27,126,114,
+222,180,184,219,123,254,240,126,122,139,119,116,136,117,108,140,128,155,144,
+94,134,69,145,150,2,203,79,176,112,168,200,190,172,231,127,73,169,102,147,
+175,174,150,99,159,12,50,130,84,93,104,104,93,83,124,190,57,143,97,107,124,
+58,107,70,87,138,56,0,0,2,0,139,255,236,4,0,5,86,0,21,0,36,0,0,23,53,22,51,
+50,18,19,35,6,35,34,38,53,52,54,51,50,18,17,16,33,34,3,20,22,51,50,54,54,
+53,52,38,38,35,34,6,6,238,70,98,229,229,8,10,106,226,181,210,235,195,206,
+249,253,152,105,14,139,131,93,145,75,77,139,89,83,125,70,2,139,24,1,11,1,
+23,153,213,190,210,247,254,198,254,230,252,234,3,167,136,146,75,115,60,91,
+165,94,70,143,0,0,2,0,172,255,236,1,160,4,106,0,10,0,22,0,0,1,50,22,21,20,
+6,35,34,38,53,52,19,50,22,21,20,6,35,34,38,53,52,54,1,37,57,66,67,56,54,67,
+121,57,66,66,57,56,65,63,4,106,63,66,62,67,62,67,129,252,130,65,62,62,67,
+64,65,63,64,0,2,0,106,254,215,1,158,4,106,0,9,0,16,0,0,1,50,21,20,6,35,34,
+38,53,52,19,23,6,3,35,18,55,1,35,123,65,58,55,64,225,15,58,116,132,88,27,
+4,106,129,63,66,66,63,129,252,99,23,219,254,252,1,71,175,0,1,0,102,0,174,
+4,43,4,156,0,6,0,0,1,1,21,1,53,1,21,1,39,3,4,252,59,3,197,2,164,254,170,160,
+1,197,100,1,197,158,0,2,0,115,1,150,4,29,3,182,0,3,0,7,0,0,19,33,21,33,17,
+33,21,33,115,3,170,252,86,3,170,252,86,3,182,137,254,242,137,0,0,1,0,102,
+0,174,4,43,4,156,0,6,0,0,1,1,53,1,21,1,53,3,106,252,252,3,197,252,59,2,168,
+1,84,160,254,59,100,254,59,158,0,2,0,43,255,236,3,86,5,203,0,29,0,40,0,0,
+1,53,52,54,55,62,2,53,52,38,35,34,6,7,39,54,51,50,22,21,20,14,2,7,6,6,21,
+21,7,50,22,21,20,6,35,34,38,53,52,1,51,77,105,89,88,39,134,125,80,159,107,
+57,188,213,192,218,31,57,74,84,95,69,61,55,66,64,57,59,62,1,156,55,118,143,
+87,72,89,92,62,102,111,37,49,125,101,191,168,65,99,83,73,71,79,111,97,34,
+176,62,65,62,67,65,64,127,0,1,0,205,254,66,2,152,6,156,0,7,0,0,1,33,17,33,
+21,33,17,33,2,152,254,53,1,203,254,200,1,56,254,66,8,90,125,248,159,0,0,1,
+0,74,254,66,3,27,6,156,0,3,0,0,19,1,35,1,221,2,62,148,253,195,6,156,247,166,
+8,90,0,1,0,131,254,63,2,80,6,156,0,7,0,0,19,33,17,33,53,33,17,33,131,1,57,
+254,199,1,205,254,51,254,193,7,94,125,247,163,0,1,0,82,2,47,4,66,5,203,0,
+6,0,0,19,35,1,51,1,35,1,242,160,1,203,100,1,193,162,254,176,2,47,3,156,252,
+100,2,223,0,0,1,255,252,254,188,3,78,255,72,0,3,0,0,5,21,33,53,3,78,252,174,
+184,140,140,0,0,1,0,90,254,66,2,236,6,156,0,28,0,0,19,54,54,53,17,52,54,51,
+21,6,21,17,20,7,21,22,21,17,20,22,23,21,38,38,53,17,52,38,35,90,131,125,213,
+189,254,199,199,127,127,195,207,123,133,2,180,1,92,98,1,231,154,168,136,6,
+186,254,29,212,38,13,37,212,254,22,96,93,1,135,1,167,157,1,227,99,94,0,0,
+1,1,233,254,66,2,125,6,156,0,3,0,0,1,51,17,35,1,233,148,148,6,156,247,166,
+0,1,0,131,254,66,3,20,6,156,0,28,0,0,1,6,6,21,17,20,6,35,53,54,53,17,52,55,
+53,38,53,17,52,38,39,53,22,22,21,17,20,22,51,3,20,134,122,212,189,254,199,
+199,123,131,200,201,124,132,2,41,2,92,97,254,25,154,167,135,6,186,1,228,211,
+38,13,36,214,1,233,94,94,2,136,3,167,156,254,29,99,94,0,1,0,102,2,35,4,43,
+3,39,0,23,0,0,19,53,54,51,50,22,23,22,22,51,50,54,55,21,6,35,34,38,39,38,
+38,35,34,6,102,100,146,67,117,86,69,95,49,55,125,56,103,143,71,123,76,69,
+98,48,52,128,2,35,151,109,29,37,30,25,64,57,150,110,32,33,30,26,66,0,255,
+255,0,82,2,100,2,66,2,252,2,2,1,119,0,0,0,1,0,82,2,106,3,174,2,246,0,3,0,
+0,19,53,33,21,82,3,92,2,106,140,140,0,0,1,0,82,2,106,7,174,2,246,0,3,0,0,
+19,53,33,21,82,7,92,2,106,140,140,0,0,1,0,123,4,61,1,170,6,51,0,6,0,0,19,
+54,55,51,2,7,35,123,61,113,129,76,37,178,4,84,229,250,254,232,222,0,0,1,0,
+121,4,61,1,168,6,51,0,6,0,0,1,6,3,35,18,55,51,1,168,57,117,129,78,34,177,
+6,29,217,254,249,1,38,208,0,0,2,0,123,4,61,3,35,6,51,0,6,0,13,0,0,1,54,55,
+51,2,7,35,37,54,19,51,2,7,35,1,242,59,117,129,79,34,180,254,125,54,120,127,
+79,34,176,4,84,224,255,254,221,211,23,216,1,7,254,221,211,0,2,0,121,4,61,
+3,33,6,51,0,6,0,13,0,0,1,6,3,35,18,55,51,5,6,3,35,18,55,51,1,166,55,119,127,
+74,36,177,1,137,55,119,131,85,29,176,6,29,211,254,243,1,23,223,22,211,254,
+243,1,61,185,0,0,3,0,154,255,236,5,186,0,236,0,11,0,21,0,33,0,0,37,50,22,
+21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,53,52,33,50,22,21,20,6,35,
+34,38,53,52,54,1,16,57,66,64,59,56,62,62,2,81,58,63,63,58,119,2,141,57,66,
+64,59,56,62,62,236,63,64,62,67,66,63,62,65,64,63,63,66,129,127,63,64,62,67,
+66,63,62,65,0,1,0,135,0,221,4,8,4,94,0,11,0,0,1,23,1,1,7,1,1,39,1,1,55,1,
+3,170,94,254,160,1,94,94,254,158,254,166,99,1,92,254,162,98,1,95,4,94,96,
+254,160,254,159,96,1,94,254,162,96,1,99,1,92,98,254,158,0,3,0,102,0,203,4,
+43,4,125,0,11,0,15,0,27,0,0,1,50,22,21,20,6,35,34,38,53,52,54,1,33,21,33,
+5,50,22,21,20,6,35,34,38,53,52,54,2,72,55,57,61,51,53,62,58,254,87,3,197,
+252,59,1,226,55,57,61,51,53,62,58,4,125,63,60,60,65,64,61,60,63,254,108,137,
+157,63,60,60,65,64,61,60,63,0,1,0,102,2,96,4,43,2,233,0,3,0,0,19,33,21,33,
+102,3,197,252,59,2,233,137,0,1,0,141,0,0,4,31,5,66,0,27,0,0,1,2,5,1,35,1,
+55,51,50,54,54,55,33,53,33,46,2,35,35,53,33,21,33,22,23,33,21,2,212,30,254,
+147,1,214,197,254,51,23,98,114,123,75,8,254,71,1,184,9,68,110,103,150,3,146,
+254,81,81,17,1,77,3,125,254,204,36,253,219,2,43,133,41,94,70,133,64,83,39,
+134,134,66,120,133,0,1,1,211,0,0,2,96,5,66,0,3,0,0,1,51,17,35,1,211,141,141,
+5,66,250,190,0,2,1,211,0,0,3,233,5,66,0,3,0,7,0,0,1,51,17,35,1,51,17,35,1,
+211,141,141,1,135,143,143,5,66,250,190,5,66,250,190,0,1,255,203,254,172,0,
+53,6,78,0,3,0,0,3,51,17,35,53,106,106,6,78,248,94,0,0,1,254,213,254,174,1,
+43,6,78,0,14,0,0,1,7,39,17,35,17,7,39,55,39,55,23,55,23,7,1,43,76,170,106,
+170,76,225,225,76,223,223,76,225,4,80,74,168,250,0,6,0,168,74,219,217,74,
+221,221,76,215,0,8,0,106,0,221,3,170,4,29,0,8,0,18,0,26,0,34,0,44,0,56,0,
+64,0,73,0,0,1,20,35,34,38,53,52,51,50,5,20,35,34,53,52,54,51,50,22,5,20,35,
+34,53,52,51,50,19,20,35,34,53,52,51,50,5,20,6,35,34,38,53,52,51,50,19,20,
+6,35,34,38,53,52,54,51,50,22,5,20,35,34,53,52,51,50,5,20,35,34,53,52,54,51,
+50,2,70,62,30,27,57,62,254,245,59,57,27,30,31,28,2,19,60,59,59,60,92,59,60,
+60,59,253,53,27,30,31,29,60,57,92,28,31,30,27,27,30,31,28,2,19,60,59,59,60,
+254,248,62,57,27,30,62,3,227,59,28,31,58,160,59,59,31,28,28,31,59,59,59,254,
+199,59,59,57,57,31,28,28,31,57,254,199,31,28,28,31,31,28,28,31,59,59,59,161,
+60,60,31,28,0,255,255,251,216,253,205,255,222,0,10,0,34,0,129,204,0,0,3,0,
+53,254,142,0,0,255,255,251,216,253,25,255,202,0,8,0,34,0,130,155,0,0,3,0,
+53,254,142,0,0,255,255,251,216,253,25,255,185,0,12,0,34,0,131,138,0,0,3,0,
+53,254,142,0,0,255,255,251,216,253,25,255,179,0,12,0,34,0,132,132,0,0,3,0,
+53,254,142,0,0,255,255,251,216,253,25,0,40,0,12,0,35,0,133,255,118,0,0,0,
+3,0,53,254,142,0,0,255,255,251,216,253,25,255,187,0,12,0,35,0,134,255,85,
+0,0,0,3,0,53,254,142,0,0,255,255,251,216,253,25,255,199,0,12,0,35,0,135,255,
+62,0,0,0,3,0,53,254,142,0,0,255,255,251,216,253,193,255,220,0,20,0,34,0,136,
+202,0,0,3,0,53,254,142,0,0,255,255,251,216,253,25,255,210,0,8,0,35,0,137,
+255,114,0,0,0,3,0,53,254,142,0,0,255,255,251,216,253,25,255,175,0,12,0,35,
+0,138,255,97,0,0,0,3,0,53,254,142,0,0,255,255,251,216,253,117,255,161,0,12,
+0,35,0,139,255,24,0,0,0,3,0,53,254,142,0,0,255,255,251,216,253,25,255,210,
+0,12,0,35,0,140,255,91,0,0,0,3,0,53,254,142,0,0,255,255,252,110,253,37,0,
+93,0,12,0,35,0,141,255,79,0,0,0,3,0,53,255,36,0,0,255,255,251,216,253,25,
+255,152,0,12,0,35,0,142,255,105,0,0,0,3,0,53,254,142,0,0,255,255,251,106,
+253,194,255,112,255,179,0,35,0,143,255,124,255,245,0,3,0,53,255,60,0,106,
+255,255,251,124,253,244,0,155,255,190,0,35,0,144,0,143,0,0,0,3,0,53,254,50,
+0,0,255,255,251,216,253,37,255,196,0,12,0,35,0,145,255,77,0,0,0,3,0,53,254,
+142,0,0,255,255,251,216,253,25,255,56,0,12,0,35,0,146,255,9,0,0,0,3,0,53,
+254,142,0,0,255,255,251,216,253,193,255,54,255,193,0,34,0,147,179,0,0,3,0,
+53,254,142,0,0,255,255,251,216,253,25,255,179,0,12,0,34,0,148,132,0,0,3,0,
+53,254,142,0,0,255,255,251,216,253,25,0,167,0,12,0,34,0,149,132,0,0,3,0,53,
+254,142,0,0,255,255,251,216,253,205,255,81,255,184,0,34,0,150,206,0,0,3,0,
+53,254,142,0,0,255,255,251,216,253,25,0,44,0,12,0,34,0,151,159,0,0,3,0,53,
+254,142,0,0,255,255,251,216,253,193,255,120,255,225,0,34,0,152,245,0,0,3,
+0,53,254,142,0,0,255,255,251,192,253,232,255,1,255,152,0,35,0,153,255,126,
+255,95,0,2,0,53,159,82,255,255,251,216,253,193,0,169,0,10,0,34,0,154,202,
+0,0,3,0,53,254,142,0,0,255,255,251,216,253,193,255,220,0,10,0,34,0,155,202,
+0,0,3,0,53,254,142,0,0,255,255,251,216,253,25,255,212,0,12,0,34,0,156,165,
+0,0,3,0,53,254,142,0,0,255,255,251,216,253,25,255,193,0,12,0,34,0,157,146,
+0,0,3,0,53,254,142,0,0,255,255,251,216,253,37,255,173,0,12,0,35,0,158,255,
+126,0,0,0,3,0,53,254,142,0,0,255,255,251,216,253,25,255,183,0,12,0,35,0,159,
+255,85,0,0,0,3,0,53,254,142,0,0,255,255,251,216,253,25,255,193,0,12,0,34,
+0,160,146,0,0,3,0,53,254,142,0,0,255,255,251,192,253,26,0,7,255,185,0,35,
+1,14,255,48,255,79,0,3,0,53,254,118,0,115,255,255,252,48,253,26,0,71,255,
+150,0,35,0,59,254,212,255,79,0,3,0,53,254,230,0,80,255,255,252,48,253,26,
+255,109,255,150,0,35,0,60,254,191,255,79,0,3,0,53,254,230,0,80,255,255,252,
+52,253,74,255,148,0,109,0,35,0,61,254,216,0,0,0,3,0,53,254,234,0,0,255,255,
+252,1,253,25,255,162,0,12,0,35,0,74,254,230,0,0,0,3,0,53,254,183,0,0,255,
+255,252,1,252,113,255,162,0,12,0,35,0,75,254,230,0,0,0,3,0,53,254,183,0,0,
+0,4,0,76,254,197,4,254,5,86,0,67,0,78,0,90,0,101,0,0,1,17,52,38,35,34,21,
+17,35,53,6,6,35,34,38,53,52,55,55,53,6,35,34,38,39,38,53,52,18,36,51,50,4,
+18,21,20,7,39,54,53,52,38,38,35,34,6,6,21,20,23,54,51,50,22,23,54,54,51,50,
+22,21,17,54,51,50,22,21,17,1,54,51,50,23,17,52,35,34,6,21,39,34,6,21,20,22,
+51,50,54,53,52,38,1,34,6,21,20,51,50,54,53,52,38,4,111,40,44,88,129,18,61,
+34,102,119,28,2,41,77,100,128,7,101,148,1,17,177,178,1,19,151,98,121,78,116,
+210,135,147,212,104,16,71,126,58,91,25,28,89,53,99,114,39,39,96,107,253,170,
+34,33,64,51,88,45,49,244,55,62,60,57,55,62,61,1,1,50,56,106,51,56,56,254,
+197,1,67,67,66,129,254,185,149,24,27,125,115,66,56,1,143,51,129,115,131,194,
+153,1,2,148,143,254,248,168,180,146,59,113,149,129,207,111,122,197,109,74,
+58,101,47,49,46,50,121,116,254,211,22,127,111,254,177,2,51,10,44,1,44,141,
+65,78,143,76,67,77,79,78,72,73,76,254,2,64,56,129,65,59,61,64,0,0,3,0,76,
+254,184,4,254,5,86,0,74,0,86,0,97,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,
+54,51,50,22,23,54,54,51,50,22,21,17,51,50,22,21,20,6,35,34,36,39,55,22,4,
+51,50,55,38,38,53,52,55,17,52,35,34,6,21,17,35,53,6,35,34,38,53,53,52,55,
+38,53,52,18,36,51,50,4,18,21,20,7,37,34,6,21,20,22,51,50,54,53,52,38,1,54,
+53,52,38,35,34,6,21,20,22,4,35,78,116,210,135,147,212,104,28,71,114,58,91,
+25,28,89,53,97,116,6,110,122,226,200,173,254,205,122,92,102,1,6,135,35,33,
+45,45,86,88,46,48,136,43,75,106,130,1,101,148,1,17,177,178,1,19,151,98,253,
+10,55,62,60,57,55,62,61,2,3,101,53,48,52,54,55,2,12,113,149,129,207,111,122,
+197,109,93,79,86,47,49,46,50,121,117,254,201,117,94,135,152,132,128,86,107,
+118,2,28,89,53,107,58,1,73,141,66,77,254,100,188,51,147,128,12,6,6,131,195,
+153,1,2,148,143,254,248,168,180,146,135,76,67,77,79,78,72,73,76,252,248,40,
+93,43,53,57,43,44,69,0,3,0,76,254,184,4,254,5,86,0,68,0,80,0,92,0,0,1,54,
+53,52,38,38,35,34,6,6,21,20,23,54,51,50,22,23,54,54,51,50,22,21,17,51,50,
+22,21,17,35,17,52,35,34,21,17,35,17,52,35,34,6,21,20,23,7,38,53,52,55,53,
+6,35,34,38,39,38,53,52,18,36,51,50,4,18,21,20,7,5,50,23,54,55,17,52,35,34,
+6,21,21,3,34,6,21,20,22,51,50,54,53,52,38,4,35,78,116,210,135,147,212,104,
+16,71,126,58,91,25,28,89,53,99,114,8,94,107,129,84,88,129,78,52,54,45,121,
+53,81,41,77,100,128,7,101,148,1,17,177,178,1,19,151,98,254,0,105,56,5,14,
+88,45,49,244,55,62,60,57,55,62,61,2,12,113,149,129,207,111,122,197,109,74,
+58,101,47,49,46,50,121,116,254,233,123,115,254,177,1,67,133,129,254,185,1,
+84,116,91,87,138,124,29,141,146,163,80,87,51,129,115,131,194,153,1,2,148,
+143,254,248,168,180,146,207,81,7,14,1,60,141,65,78,254,1,141,76,67,77,79,
+78,72,73,76,0,3,0,76,254,184,5,100,5,86,0,44,0,67,0,79,0,0,37,22,22,21,17,
+35,17,52,35,34,21,17,35,17,52,38,35,34,6,21,20,23,7,38,53,52,55,6,35,34,38,
+38,53,52,55,38,53,52,54,54,51,32,23,39,51,1,54,51,50,23,54,55,17,38,38,35,
+34,6,21,20,23,54,51,50,22,22,21,20,1,34,6,21,20,22,51,50,54,53,52,38,4,213,
+63,80,129,84,88,129,39,39,50,56,45,121,53,45,57,72,96,157,91,8,141,133,243,
+158,1,33,203,2,137,254,101,15,15,104,58,34,48,88,251,151,183,214,67,96,177,
+94,157,91,254,168,92,117,120,91,92,117,119,251,16,113,102,254,177,1,67,133,
+129,254,185,1,84,61,55,91,87,138,124,29,141,146,111,76,23,82,156,104,49,34,
+134,205,139,222,118,222,202,251,189,3,81,43,21,2,197,139,144,195,151,127,
+84,125,83,156,103,119,1,80,120,93,97,118,118,93,96,121,0,2,0,76,254,184,4,
+254,5,86,0,68,0,90,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,55,23,6,6,21,
+20,51,50,54,55,38,38,53,52,54,51,50,23,17,22,23,17,35,17,39,34,6,21,20,23,
+21,20,6,35,34,38,53,52,55,38,38,53,53,38,53,52,18,36,51,50,4,18,21,20,7,5,
+20,6,7,6,21,20,51,50,54,55,38,53,52,54,55,17,35,34,21,20,23,4,35,78,116,210,
+135,147,212,104,27,62,118,84,94,86,147,58,70,7,49,53,180,168,67,72,51,21,
+129,14,105,78,94,136,117,123,138,70,94,105,112,148,1,17,177,178,1,19,151,
+98,254,71,101,94,98,136,51,62,8,91,124,120,16,203,102,2,12,113,149,129,207,
+111,122,197,109,91,74,112,82,105,60,129,91,183,50,47,30,92,54,111,124,12,
+253,223,4,4,253,244,1,160,1,46,44,71,21,12,108,128,145,126,122,85,24,155,
+120,20,148,190,153,1,2,148,143,254,248,168,180,146,51,110,135,21,94,109,158,
+42,31,50,106,84,105,11,1,179,112,83,26,0,0,4,0,82,254,184,5,174,5,86,0,49,
+0,75,0,85,0,97,0,0,5,38,39,6,35,34,2,17,52,54,55,38,53,52,54,51,50,22,23,
+39,51,17,22,23,39,51,17,35,53,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,
+35,34,38,53,53,52,1,54,51,50,23,7,38,35,34,6,7,54,51,50,22,23,54,55,17,38,
+38,35,34,6,21,20,1,18,33,50,54,53,52,38,35,34,1,34,6,21,20,22,51,50,54,53,
+52,38,3,107,87,19,87,164,197,239,140,132,12,182,156,121,193,86,1,138,63,52,
+1,123,123,102,146,88,121,45,28,84,48,89,118,110,97,90,115,254,122,44,25,137,
+107,56,88,102,154,169,8,138,131,133,202,21,88,146,77,198,106,107,112,255,
+0,32,1,1,98,103,127,113,128,2,222,42,52,52,42,46,49,53,108,67,105,84,1,18,
+1,4,171,240,54,49,49,124,165,86,91,157,252,85,23,49,81,254,172,107,128,106,
+74,84,50,32,37,105,94,90,105,104,93,12,6,4,101,4,47,121,37,173,164,38,128,
+121,88,2,2,59,114,121,89,81,35,253,163,254,200,87,76,88,97,254,14,52,40,41,
+51,50,42,41,51,0,0,4,0,82,254,184,5,98,5,86,0,28,0,58,0,68,0,80,0,0,37,6,
+35,34,2,17,52,54,55,38,53,52,54,51,50,22,23,39,51,17,22,22,21,20,6,35,34,
+38,53,3,54,51,50,23,7,38,35,34,6,7,54,51,50,22,22,21,54,51,51,50,23,17,38,
+38,35,34,6,21,20,3,18,33,50,54,53,52,38,35,34,5,34,6,21,20,22,51,50,54,53,
+52,38,2,180,73,101,197,239,131,123,14,181,156,121,194,86,1,137,91,91,186,
+158,155,187,228,37,52,137,107,56,88,102,154,169,8,138,131,100,168,93,86,98,
+13,6,6,77,198,106,110,109,236,32,1,1,98,103,127,113,128,2,177,97,112,113,
+96,99,112,112,14,34,1,18,1,4,165,236,57,53,52,123,166,86,92,158,251,239,40,
+162,97,150,184,181,149,3,239,7,47,121,37,173,164,38,73,136,94,53,1,2,151,
+114,121,91,79,31,253,159,254,200,87,76,88,97,248,111,96,95,112,110,97,96,
+111,0,3,0,82,254,197,5,100,5,86,0,67,0,77,0,90,0,0,5,22,22,51,32,55,6,35,
+34,38,53,52,54,55,17,38,38,35,34,6,21,20,23,54,51,50,23,7,38,35,34,6,7,54,
+51,50,22,22,21,20,6,35,34,2,17,52,54,55,38,53,52,54,51,50,22,23,39,51,17,
+22,22,21,20,4,33,34,38,39,3,18,33,50,54,53,52,38,35,34,1,54,53,52,38,35,34,
+6,21,20,22,51,50,1,137,79,194,100,1,62,102,30,28,104,123,95,79,77,198,106,
+107,112,5,35,38,137,107,56,88,102,154,169,8,138,131,100,168,93,170,162,197,
+239,138,131,13,181,157,120,194,86,1,137,79,89,254,202,254,204,100,231,91,
+117,32,1,1,98,103,127,113,128,3,129,5,58,52,45,58,58,55,56,106,42,42,99,5,
+111,96,80,117,22,2,156,114,121,89,81,36,16,5,47,121,37,173,164,38,73,136,
+94,142,161,1,18,1,4,169,240,55,48,51,123,166,86,91,157,252,5,23,134,94,193,
+198,51,45,2,130,254,200,87,76,88,97,254,84,23,26,65,74,57,45,51,60,0,0,3,
+0,82,254,184,5,59,5,86,0,33,0,85,0,94,0,0,1,22,22,21,20,6,7,22,22,21,20,6,
+35,34,36,39,35,34,38,38,53,52,54,55,38,53,52,54,51,50,22,23,39,51,1,54,55,
+17,38,38,35,34,6,21,20,23,54,51,50,23,7,38,35,32,3,54,51,50,22,22,21,20,6,
+7,22,22,51,50,54,53,52,38,35,34,7,39,54,55,54,54,53,52,38,35,34,7,37,22,51,
+50,54,53,52,35,34,4,172,62,67,54,60,62,66,179,159,211,254,252,17,5,127,196,
+103,129,122,14,182,156,120,195,88,1,137,254,205,83,87,78,199,106,107,112,
+5,55,40,132,110,56,88,100,254,199,22,134,125,109,163,85,99,91,9,188,154,98,
+111,61,55,51,44,53,15,75,91,71,49,45,61,76,253,30,35,242,98,98,237,128,1,
+200,21,98,58,66,87,33,24,95,60,112,130,238,201,110,209,148,143,204,51,44,
+57,124,165,86,94,160,252,73,61,10,2,17,116,122,89,81,31,23,7,49,119,37,254,
+239,39,63,121,86,92,132,28,151,181,65,60,44,48,20,104,8,21,25,67,47,37,43,
+51,192,245,68,65,149,0,1,0,76,254,66,4,195,5,86,0,97,0,0,1,6,35,34,38,53,
+52,54,51,50,22,22,21,20,6,7,22,21,20,6,7,6,6,21,20,51,50,55,17,51,17,35,55,
+6,35,34,38,53,52,54,54,55,62,2,53,52,35,34,6,21,20,23,7,38,53,52,55,38,53,
+52,55,38,53,52,54,54,51,50,4,22,21,20,7,39,54,53,52,38,35,34,6,21,20,23,54,
+55,23,6,6,21,20,22,51,50,54,53,52,3,47,20,27,43,57,57,47,52,88,53,78,74,49,
+93,122,98,66,146,173,126,121,121,2,129,170,133,136,51,95,84,66,57,28,102,
+58,59,17,115,23,35,192,2,172,131,252,168,194,1,11,131,60,129,47,235,207,200,
+222,82,48,99,84,82,67,113,108,112,121,2,83,5,51,39,42,56,63,126,89,88,134,
+37,47,75,82,93,48,39,53,44,90,141,1,230,253,37,102,114,110,100,55,87,62,32,
+24,30,38,27,78,50,41,41,30,29,58,59,57,42,64,232,19,18,128,222,127,211,123,
+147,247,153,147,137,47,104,117,195,235,185,153,132,77,81,71,105,54,104,63,
+98,103,101,84,59,0,2,0,76,254,184,4,199,5,86,0,68,0,79,0,0,23,22,4,51,50,
+55,38,38,53,52,55,17,35,34,6,7,50,22,21,20,6,35,34,38,53,52,55,38,53,52,54,
+36,51,50,4,22,21,20,6,7,39,54,53,52,38,35,34,6,6,21,20,23,54,54,51,50,23,
+17,54,51,50,22,21,20,6,35,34,36,39,5,54,53,52,38,35,34,6,21,20,22,213,100,
+1,15,135,33,34,44,46,62,15,167,221,15,46,56,59,49,63,66,42,171,145,1,3,167,
+173,1,5,142,67,58,123,106,234,202,132,196,104,104,77,225,126,77,71,15,16,
+109,122,229,207,184,254,230,120,3,24,103,52,48,50,57,51,37,81,89,3,28,88,
+53,89,56,1,222,194,158,50,45,46,50,95,67,113,96,160,247,153,253,137,141,255,
+159,104,200,75,66,136,169,193,237,107,193,116,176,113,92,97,12,253,231,2,
+118,97,133,150,96,99,42,41,91,42,54,55,45,43,68,0,1,0,76,254,197,4,199,5,
+86,0,74,0,0,1,54,53,52,38,35,34,6,6,21,20,23,54,54,51,50,23,17,54,51,50,23,
+17,35,34,36,39,55,22,4,51,51,17,6,6,7,22,21,20,6,35,34,38,53,52,54,55,17,
+35,34,6,7,50,22,21,20,6,35,34,38,53,52,55,38,53,52,54,36,51,50,4,22,21,20,
+7,3,233,80,234,202,132,196,104,59,74,218,126,75,69,54,58,69,52,188,218,254,
+142,166,72,178,1,29,208,66,102,143,27,88,58,43,59,64,88,84,10,162,210,15,
+47,55,58,50,61,68,34,124,145,1,3,167,173,1,5,142,97,2,23,115,153,193,237,
+107,193,116,133,95,89,96,12,254,166,12,10,253,35,113,116,106,119,91,1,243,
+3,88,74,10,83,41,49,77,56,81,140,49,1,25,183,149,50,44,46,50,92,66,99,86,
+147,210,153,253,137,141,255,159,187,151,0,1,0,76,254,184,4,199,5,86,0,69,
+0,0,1,17,35,34,6,7,22,21,20,6,35,34,38,53,52,54,55,17,35,34,6,7,50,22,21,
+20,6,35,34,38,53,52,55,38,53,52,54,36,51,50,4,22,21,20,6,7,39,54,53,52,38,
+35,34,6,6,21,20,23,54,54,51,50,23,17,50,55,51,50,23,17,3,145,8,120,166,28,
+89,57,43,58,65,161,140,15,167,221,15,46,56,58,50,60,69,48,177,145,1,3,167,
+173,1,5,142,67,58,123,106,234,202,132,196,104,112,79,219,122,77,71,3,3,6,
+63,79,254,197,1,125,110,99,10,85,42,48,76,64,122,191,40,1,148,194,158,50,
+44,46,50,91,70,122,100,161,252,153,253,137,141,255,159,104,200,75,66,136,
+169,193,237,107,193,116,182,116,88,91,12,254,9,1,10,254,23,0,3,0,76,254,184,
+5,35,5,86,0,34,0,57,0,69,0,0,5,22,4,51,50,55,38,38,39,6,35,34,38,39,38,38,
+53,52,54,54,51,32,23,39,51,17,22,22,21,20,6,35,34,36,39,1,54,55,17,38,38,
+35,34,6,6,21,20,22,23,54,55,23,6,21,20,22,51,50,5,54,53,52,38,35,34,6,21,
+20,51,50,1,117,100,1,15,135,100,65,83,100,5,57,68,191,230,7,110,117,141,254,
+162,1,13,164,1,137,55,58,234,198,187,254,230,121,2,114,58,88,70,222,134,128,
+193,105,53,60,43,114,97,142,155,132,111,1,70,26,52,49,52,54,141,17,37,81,
+89,20,8,95,79,15,210,186,79,228,140,149,252,142,193,173,251,130,27,103,70,
+146,178,96,99,1,37,54,6,2,249,121,131,108,190,114,91,136,64,116,87,86,97,
+155,131,153,211,42,52,52,58,57,43,106,0,1,0,76,254,184,4,178,5,86,0,74,0,
+0,1,17,38,38,35,34,6,21,20,22,23,54,55,23,6,6,7,22,21,20,6,35,34,38,53,52,
+55,38,53,52,54,51,50,23,39,17,38,38,35,34,6,6,21,20,23,54,37,23,6,6,7,22,
+22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,54,51,50,22,23,39,51,17,4,41,
+52,115,73,90,117,26,35,93,141,39,96,128,18,46,41,37,45,47,29,117,183,144,
+139,102,1,76,239,138,115,183,101,109,162,1,3,45,199,248,19,46,54,57,52,62,
+67,62,88,82,138,243,149,148,221,91,1,137,254,197,1,254,60,56,108,72,50,67,
+34,89,33,110,21,97,63,15,52,34,38,58,51,60,55,92,143,126,171,85,73,2,52,122,
+131,96,169,96,155,100,188,59,129,48,233,153,3,52,41,46,50,94,71,116,117,75,
+182,119,129,225,129,95,101,176,249,131,0,0,3,0,76,254,197,5,184,5,86,0,68,
+0,78,0,89,0,0,1,17,52,38,35,34,21,17,35,53,6,6,35,34,38,53,52,54,55,17,52,
+35,34,21,20,22,23,7,38,39,38,53,52,18,36,51,32,0,17,20,6,7,19,7,3,54,53,52,
+0,35,34,6,21,20,23,54,54,51,50,23,54,51,50,22,21,17,22,21,17,1,22,23,54,55,
+17,52,35,34,21,3,34,6,21,20,51,50,54,53,52,38,3,231,40,44,88,129,18,60,34,
+103,118,91,79,84,117,28,25,129,54,5,123,148,1,28,192,1,63,1,77,49,46,207,
+123,233,102,254,250,254,226,255,24,30,106,67,109,60,67,104,101,114,133,254,
+54,54,36,42,58,92,98,70,51,55,106,51,56,56,254,197,1,67,69,64,129,254,185,
+149,24,27,125,115,87,125,17,1,31,116,200,65,149,63,22,142,154,148,211,159,
+1,0,140,254,184,254,213,96,212,97,254,239,86,1,78,192,230,244,1,2,237,189,
+89,71,63,64,88,88,121,116,254,223,46,182,254,177,2,46,22,51,58,19,1,9,143,
+137,254,139,65,55,129,65,59,61,64,0,0,2,0,76,254,184,5,184,5,86,0,74,0,84,
+0,0,19,54,54,51,50,23,54,51,50,22,21,17,22,21,21,51,21,33,17,52,35,34,21,
+17,35,17,52,38,35,34,6,21,20,23,7,38,53,52,54,55,17,52,35,34,21,20,22,23,
+7,38,39,38,53,52,18,36,51,32,0,17,20,6,7,19,7,3,54,53,52,0,35,34,6,21,20,
+1,22,23,54,55,17,52,35,34,21,237,30,106,67,109,60,67,104,101,114,92,205,254,
+178,84,88,129,39,38,51,56,45,121,53,100,91,84,117,28,25,129,54,5,123,148,
+1,28,192,1,63,1,77,49,46,207,123,233,102,254,250,254,226,255,1,201,32,23,
+52,83,92,98,2,135,63,64,88,88,121,116,254,204,58,151,213,122,1,67,133,129,
+254,185,1,84,61,55,91,87,138,124,29,147,140,126,158,13,1,27,116,200,65,149,
+63,22,142,154,148,211,159,1,0,140,254,184,254,213,96,212,97,254,239,86,1,
+78,192,230,244,1,2,237,189,89,254,25,20,34,66,13,1,0,143,137,0,3,0,76,254,
+197,4,254,5,86,0,72,0,82,0,93,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,
+51,50,23,54,51,50,22,21,17,54,51,50,22,21,17,35,17,52,38,35,34,21,17,35,53,
+6,6,35,34,38,53,52,55,17,52,35,34,6,21,20,22,23,7,38,38,53,53,38,53,52,18,
+36,51,50,4,18,21,20,7,5,54,51,50,23,17,52,35,34,21,19,34,6,21,20,51,50,54,
+53,52,38,4,35,78,116,210,135,147,212,104,20,59,136,109,59,67,105,101,114,
+40,44,93,110,129,40,44,88,129,18,61,34,102,119,16,84,61,55,29,24,131,26,32,
+110,148,1,17,177,178,1,19,151,98,253,245,39,43,60,49,92,99,84,50,56,106,52,
+55,56,2,12,113,149,129,207,111,122,197,109,80,69,118,88,88,121,116,254,208,
+25,122,116,254,177,1,67,67,66,129,254,185,149,24,27,125,115,52,41,1,167,116,
+111,116,78,171,62,25,81,188,79,30,135,202,153,1,2,148,143,254,248,168,180,
+146,222,15,39,1,37,143,137,254,139,64,56,129,67,57,61,64,0,0,2,0,76,254,184,
+4,254,5,86,0,72,0,82,0,0,1,54,53,52,38,38,35,34,6,6,21,20,23,54,54,51,50,
+23,54,51,50,22,21,17,22,21,17,35,17,52,35,34,21,17,35,17,52,38,35,34,6,21,
+20,23,7,38,53,52,54,55,17,52,35,34,21,20,22,23,7,38,39,38,53,52,18,36,51,
+50,4,18,21,20,7,5,22,23,54,55,53,52,35,34,21,4,35,78,116,210,135,147,212,
+104,26,27,108,72,109,60,67,104,101,114,78,129,84,88,129,39,39,51,55,45,121,
+53,110,95,84,117,28,25,129,51,8,129,148,1,17,177,178,1,19,151,98,254,8,25,
+16,59,90,92,98,2,12,113,149,129,207,111,122,197,109,93,75,65,72,88,88,121,
+116,254,194,60,139,254,177,1,67,133,129,254,185,1,84,61,55,91,87,138,124,
+29,141,146,133,158,7,1,26,116,200,65,149,63,22,137,155,142,217,153,1,2,148,
+143,254,248,168,180,146,245,20,23,73,7,255,143,137,0,0,5,0,61,254,184,5,111,
+5,86,0,35,0,67,0,79,0,91,0,103,0,0,5,6,6,35,34,38,53,52,55,38,38,53,53,38,
+53,52,54,55,53,52,54,51,50,22,23,39,51,17,22,22,21,20,6,35,34,38,3,22,23,
+54,54,55,17,38,38,35,34,6,21,22,23,7,38,35,34,6,21,20,23,54,54,51,50,22,22,
+21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,53,52,38,35,34,
+6,7,38,38,35,34,6,21,20,22,51,50,54,3,103,77,127,75,109,131,81,88,99,185,
+169,149,181,157,120,194,86,1,137,66,72,128,112,76,131,196,56,66,65,116,65,
+77,198,106,107,112,139,113,98,89,124,120,138,79,42,164,106,96,162,84,96,248,
+92,117,120,91,91,118,119,1,9,55,91,52,57,64,65,60,50,84,207,52,94,56,55,62,
+60,57,52,94,181,81,66,125,107,113,58,35,158,117,6,127,195,136,189,23,16,123,
+166,86,91,157,251,42,23,105,78,107,123,68,1,84,28,68,71,64,5,3,106,114,121,
+89,81,18,109,94,96,127,98,109,68,89,96,87,160,95,105,156,1,222,120,93,97,
+118,118,93,96,121,253,72,59,48,54,55,51,57,45,63,57,51,58,48,53,58,49,0,3,
+0,61,254,184,5,125,5,86,0,45,0,75,0,87,0,0,37,6,35,34,38,53,53,38,53,52,54,
+55,53,52,54,51,50,22,23,39,51,17,22,22,21,17,35,17,52,35,34,21,17,35,17,52,
+35,34,6,21,20,23,7,38,53,52,55,22,23,54,55,17,38,38,35,34,6,21,21,22,23,7,
+38,35,34,6,21,20,23,54,54,51,50,22,21,20,1,34,6,21,20,22,51,50,54,53,52,38,
+2,158,38,42,155,189,185,172,154,182,156,120,194,86,1,138,67,76,129,84,88,
+129,78,48,58,45,121,53,247,84,49,34,48,77,198,106,107,112,133,111,98,89,124,
+120,138,81,43,162,105,148,194,254,168,94,115,120,91,91,118,119,55,8,178,154,
+12,128,194,138,190,21,15,124,165,86,91,157,251,185,17,119,95,254,177,1,67,
+133,129,254,185,1,84,116,84,94,138,124,29,141,146,52,245,9,70,43,21,2,245,
+114,121,90,80,1,19,107,94,96,127,98,110,69,86,95,190,152,60,1,21,121,92,97,
+118,118,93,96,121,0,0,5,0,76,254,184,5,184,5,86,0,45,0,54,0,66,0,78,0,90,
+0,0,5,38,39,6,35,34,38,39,38,17,52,54,36,51,32,23,39,51,17,22,23,39,51,17,
+35,53,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,1,1,54,51,
+17,2,33,34,7,23,38,39,6,6,21,20,22,23,54,54,55,19,53,52,54,55,3,6,6,21,20,
+22,51,5,34,6,21,20,22,51,50,54,53,52,38,3,117,53,30,30,37,195,228,8,228,145,
+1,3,165,1,23,167,1,137,59,56,1,123,123,103,144,88,121,44,28,85,48,88,118,
+109,97,59,93,53,254,213,1,172,31,45,155,254,222,110,85,23,65,66,61,68,54,
+59,30,135,92,181,67,62,235,107,113,156,139,1,101,43,52,52,43,45,49,53,108,
+41,52,5,206,190,162,1,29,152,252,139,213,193,252,85,20,52,81,254,172,107,
+128,106,74,83,51,32,37,105,94,90,105,46,89,62,4,119,253,176,7,2,17,1,21,37,
+252,88,96,55,159,93,91,140,59,82,139,42,253,85,22,71,126,41,1,64,47,151,98,
+132,152,150,52,40,41,51,50,42,41,51,0,5,0,76,254,184,5,129,5,86,0,22,0,34,
+0,45,0,57,0,69,0,0,5,38,38,39,38,17,52,54,36,51,32,23,39,51,17,22,22,21,20,
+6,35,34,38,3,1,22,23,51,50,23,17,2,33,34,7,3,54,54,55,39,38,39,6,6,21,20,
+1,54,55,38,39,3,6,6,21,20,22,51,37,34,6,21,20,22,51,50,54,53,52,38,2,211,
+192,219,8,228,145,1,3,165,1,23,167,1,137,87,95,186,158,146,188,145,1,177,
+26,27,9,5,4,155,254,222,110,85,124,30,135,92,110,65,66,61,68,2,13,48,150,
+33,43,202,107,113,156,139,1,76,97,112,113,96,99,112,112,19,4,206,185,162,
+1,29,152,252,139,213,193,251,239,39,158,102,150,184,166,4,150,253,168,36,
+40,1,2,109,1,21,37,253,103,82,139,42,150,88,96,55,159,93,175,253,233,154,
+51,39,61,1,19,47,151,98,132,152,100,111,96,95,112,110,97,96,111,0,0,5,0,76,
+254,184,5,90,5,86,0,32,0,40,0,51,0,60,0,86,0,0,1,22,22,21,20,6,7,22,22,21,
+20,6,35,34,38,38,53,52,55,38,38,39,38,17,52,54,54,51,50,22,23,39,51,5,1,22,
+23,17,38,33,34,3,54,55,39,38,39,6,6,21,20,22,1,1,6,6,21,20,22,51,50,7,21,
+20,22,51,50,54,53,52,38,35,34,7,39,54,55,54,54,53,52,38,39,6,6,35,34,4,203,
+60,69,54,60,62,66,179,159,152,220,117,2,100,119,8,242,131,247,162,153,230,
+92,1,137,253,27,1,235,47,66,156,254,205,78,214,59,184,78,60,77,75,75,59,2,
+197,254,190,101,105,147,131,144,199,188,164,98,111,61,56,50,44,53,11,79,91,
+71,47,43,100,195,111,27,1,200,21,98,58,66,87,33,24,95,60,111,131,124,223,
+133,36,18,38,159,107,132,1,7,127,211,123,88,95,165,130,253,144,60,87,2,36,
+238,253,187,162,76,99,76,104,46,141,87,80,117,254,198,1,148,41,124,88,108,
+122,129,22,155,202,65,60,44,48,20,104,7,22,25,67,47,35,43,2,95,77,0,3,0,76,
+254,184,5,164,5,86,0,57,0,75,0,87,0,0,5,38,53,52,55,37,39,55,38,17,52,54,
+54,51,50,22,23,39,51,17,6,21,20,22,51,50,55,53,51,17,35,17,6,35,34,38,53,
+52,55,14,2,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,52,1,5,54,54,51,17,
+38,38,35,34,6,6,21,20,22,23,37,23,1,34,6,21,20,22,51,50,54,53,52,38,3,53,
+106,3,254,7,31,121,227,132,244,158,127,214,105,1,137,35,48,34,53,31,121,121,
+37,49,91,106,6,62,97,51,37,59,92,92,115,110,97,59,93,53,254,72,1,134,47,148,
+91,93,214,132,124,182,97,89,96,1,3,97,1,14,42,52,52,42,45,49,53,96,91,138,
+22,22,118,84,111,130,1,1,135,227,127,82,99,161,252,55,49,54,39,47,22,206,
+253,37,1,155,12,99,89,20,21,2,52,82,46,78,46,59,108,91,90,105,46,89,62,25,
+1,241,94,62,65,2,68,119,110,93,169,101,106,138,49,238,94,253,8,52,40,41,51,
+50,42,41,51,0,3,0,76,254,184,5,25,5,86,0,33,0,50,0,62,0,0,37,22,22,51,50,
+55,38,38,53,52,55,37,39,55,38,17,52,54,54,51,32,23,39,51,17,22,22,21,20,6,
+35,34,36,39,19,5,54,55,17,38,38,35,34,6,6,21,20,22,23,1,23,1,54,54,53,52,
+38,35,34,6,21,20,22,1,123,95,253,150,28,30,44,45,17,253,118,31,121,227,143,
+252,158,1,11,160,1,137,55,58,218,194,211,254,211,107,101,2,87,38,43,73,214,
+133,126,191,105,89,93,1,6,97,1,63,52,53,53,48,49,57,50,49,125,131,3,28,88,
+53,47,38,169,84,118,138,1,19,145,248,139,185,165,251,80,26,100,65,133,150,
+155,153,1,78,162,15,2,3,54,120,122,107,189,110,115,149,51,1,0,94,252,176,
+18,68,45,43,53,55,45,42,67,0,0,2,0,76,254,197,4,244,5,86,0,40,0,57,0,0,1,
+34,36,39,55,22,4,51,51,17,6,6,7,22,21,20,6,35,34,38,53,52,55,37,39,55,38,
+17,52,54,54,51,50,22,23,39,51,17,22,23,17,1,5,54,55,17,38,38,35,34,6,6,21,
+20,22,23,37,23,4,55,217,254,143,167,71,182,1,29,205,66,102,143,27,87,57,43,
+59,64,11,253,243,31,121,227,132,244,158,127,214,105,1,137,41,35,252,135,1,
+169,93,158,93,214,132,124,182,97,89,96,1,3,97,254,197,112,117,106,121,89,
+1,243,3,88,74,10,83,42,48,77,56,41,36,124,84,111,130,1,1,135,227,127,82,99,
+161,252,105,3,6,253,35,2,194,102,101,30,2,72,119,110,93,169,101,106,138,49,
+238,94,0,3,0,76,254,184,4,182,5,86,0,25,0,45,0,63,0,0,1,55,6,35,34,38,39,
+38,53,52,55,37,39,55,38,17,52,54,54,51,50,22,23,39,51,17,1,23,54,51,50,23,
+39,17,38,38,35,34,6,6,21,20,22,23,37,23,1,17,38,38,35,34,6,21,20,23,54,55,
+23,6,21,20,51,50,4,45,2,78,121,108,138,8,133,16,254,224,31,121,227,134,246,
+160,130,218,106,1,137,252,197,199,96,143,145,108,1,97,219,132,127,185,96,
+89,96,1,3,97,1,59,58,120,74,92,119,40,31,54,84,78,146,118,254,197,58,71,113,
+100,97,149,54,42,68,84,111,130,1,1,136,227,126,85,99,164,249,131,2,194,48,
+85,93,81,2,73,122,110,94,168,101,106,138,49,238,94,252,195,1,36,68,59,107,
+73,80,48,53,42,71,58,61,119,0,4,0,76,254,184,5,170,5,86,0,36,0,56,0,74,0,
+85,0,0,1,55,6,35,34,38,39,38,53,52,55,37,39,55,38,17,52,54,54,51,50,22,23,
+39,51,17,54,51,50,22,21,20,6,35,34,39,17,1,23,54,51,50,23,39,17,38,38,35,
+34,6,6,21,20,22,23,37,23,1,17,38,38,35,34,6,21,20,23,54,55,23,6,21,20,51,
+50,1,34,6,21,20,22,51,50,53,52,38,4,45,2,78,121,108,138,8,133,16,254,224,
+31,121,227,134,246,160,130,218,106,1,137,37,47,69,91,88,74,47,35,252,197,
+199,96,143,145,108,1,97,219,132,127,185,96,89,96,1,3,97,1,59,58,120,74,92,
+119,40,31,54,84,78,146,118,1,11,28,38,37,29,67,35,254,197,58,71,113,100,97,
+149,54,42,68,84,111,130,1,1,136,227,126,85,99,164,252,70,24,94,78,77,91,25,
+254,96,2,194,48,85,93,81,2,73,122,110,94,168,101,106,138,49,238,94,252,195,
+1,36,68,59,107,73,80,48,53,42,71,58,61,119,2,10,35,30,31,35,66,30,35,0,255,
+255,253,23,252,136,0,18,254,197,0,3,0,129,0,0,254,187,255,255,253,86,252,
+46,0,47,255,29,0,3,0,130,0,0,255,21,255,255,253,102,252,46,0,47,255,33,0,
+3,0,131,0,0,255,21,255,255,253,111,252,46,0,47,255,33,0,3,0,132,0,0,255,21,
+255,255,253,125,252,46,0,178,255,33,0,3,0,133,0,0,255,21,255,255,253,158,
+252,46,0,102,255,33,0,3,0,134,0,0,255,21,255,255,253,178,252,46,0,137,255,
+33,0,3,0,135,0,0,255,21,255,255,253,41,252,124,0,18,254,207,0,3,0,136,0,0,
+254,187,255,255,253,129,252,46,0,96,255,29,0,3,0,137,0,0,255,21,255,255,253,
+145,252,46,0,78,255,33,0,3,0,138,0,0,255,21,255,255,253,219,252,46,0,137,
+254,197,0,3,0,139,0,0,254,185,255,255,253,152,252,46,0,119,255,33,0,3,0,140,
+0,0,255,21,255,255,254,59,252,46,1,14,255,21,0,3,0,141,0,0,255,9,255,255,
+253,111,252,46,0,47,255,33,0,3,0,142,0,0,255,21,255,255,251,238,252,177,255,
+244,254,162,0,3,0,143,0,0,254,228,255,255,251,254,252,216,0,12,254,162,0,
+3,0,144,0,0,254,228,255,255,253,166,252,58,0,119,255,33,0,3,0,145,0,0,255,
+21,255,255,253,182,252,46,0,47,255,33,0,3,0,146,0,0,255,21,255,255,253,53,
+252,165,255,131,254,165,0,3,0,147,0,0,254,228,255,255,253,111,252,46,0,47,
+255,33,0,3,0,148,0,0,255,21,255,255,253,111,252,46,1,35,255,33,0,3,0,149,
+0,0,255,21,255,255,253,39,252,177,255,131,254,156,0,3,0,150,0,0,254,228,255,
+255,253,84,252,46,0,141,255,33,0,3,0,151,0,0,255,21,255,255,252,227,252,165,
+255,131,254,197,0,3,0,152,0,0,254,228,255,255,252,66,253,89,255,131,254,165,
+0,3,0,153,0,0,254,208,255,255,253,43,252,124,0,223,254,197,0,3,0,154,0,0,
+254,187,255,255,253,43,252,124,0,18,254,197,0,3,0,155,0,0,254,187,255,255,
+253,78,252,46,0,47,255,33,0,3,0,156,0,0,255,21,255,255,253,96,252,46,0,47,
+255,33,0,3,0,157,0,0,255,21,255,255,253,117,252,58,0,47,255,33,0,3,0,158,
+0,0,255,21,255,255,253,154,252,46,0,98,255,33,0,3,0,159,0,0,255,21,255,255,
+253,6,252,46,0,47,255,33,0,3,0,160,0,0,255,21,0,2,253,23,252,57,0,18,254,
+78,0,26,0,37,0,0,3,17,52,38,35,34,21,17,35,53,6,6,35,34,38,53,52,54,51,50,
+23,54,51,50,22,21,17,1,34,6,21,20,51,50,54,53,52,38,111,41,43,88,129,17,62,
+33,103,118,123,104,107,61,63,103,92,110,253,240,51,55,106,50,57,55,252,57,
+1,27,69,64,129,254,225,129,23,28,120,110,97,128,88,88,122,116,254,217,1,164,
+60,50,119,60,54,56,59,0,0,1,253,41,252,45,0,18,254,88,0,31,0,0,3,20,6,35,
+34,38,38,53,52,55,23,6,21,20,51,50,55,38,53,52,54,51,50,23,17,35,17,35,34,
+21,20,23,213,138,116,84,117,59,176,80,127,135,90,29,88,155,142,101,52,129,
+28,168,94,253,6,99,118,63,113,76,175,128,94,95,110,141,55,49,96,89,102,10,
+254,28,1,121,80,61,19,0,255,255,251,238,252,46,255,244,254,31,0,3,0,143,0,
+0,254,97,255,255,251,254,252,89,0,12,254,35,0,3,0,144,0,0,254,101,255,255,
+253,53,252,47,255,131,254,47,0,3,0,147,0,0,254,110,255,255,253,39,252,59,
+255,131,254,38,0,3,0,150,0,0,254,110,255,255,252,227,252,47,255,131,254,79,
+0,3,0,152,0,0,254,110,0,1,252,147,252,205,255,131,254,59,0,5,0,0,1,53,51,
+17,33,53,254,254,133,253,16,253,78,237,254,146,129,0,0,1,253,43,252,45,0,
+223,254,78,0,31,0,0,3,17,52,35,34,21,17,35,17,52,35,34,6,21,20,23,7,38,53,
+52,54,51,50,23,54,51,50,22,21,21,51,21,111,84,88,129,77,51,56,45,121,53,121,
+98,104,58,65,97,91,109,205,252,57,1,27,133,129,254,225,1,43,117,83,79,124,
+115,27,131,135,130,149,80,80,123,115,172,123,0,0,1,253,43,252,45,0,18,254,
+78,0,29,0,0,1,54,51,50,22,21,17,35,17,52,35,34,21,17,35,17,52,35,34,6,21,
+20,23,7,38,53,52,54,51,50,254,168,65,97,91,109,129,84,88,129,77,51,56,45,
+121,53,121,98,104,253,254,80,123,115,254,217,1,27,133,129,254,225,1,43,117,
+83,79,124,115,27,131,135,130,149,0,2,253,76,252,57,0,18,253,240,0,25,0,36,
+0,0,3,53,52,35,34,21,21,35,53,6,6,35,34,38,53,52,54,51,50,23,54,51,50,22,
+21,21,1,34,6,21,20,51,50,54,53,52,38,104,76,80,125,16,55,31,98,107,116,95,
+100,55,62,94,88,100,254,21,45,51,96,46,50,50,252,57,213,121,117,217,88,21,
+26,108,93,85,112,80,80,111,102,226,1,80,49,43,100,50,46,48,48,0,255,255,0,
+0,252,46,2,217,255,29,0,3,0,130,2,170,255,21,255,255,0,0,252,46,2,201,255,
+33,0,3,0,131,2,154,255,21,255,255,0,0,252,46,2,192,255,33,0,3,0,132,2,145,
+255,21,255,255,0,0,252,46,3,53,255,33,0,3,0,133,2,131,255,21,255,255,0,0,
+252,46,2,200,255,33,0,3,0,134,2,98,255,21,255,255,0,0,252,46,2,215,255,33,
+0,3,0,135,2,78,255,21,0,1,253,90,252,45,0,18,254,31,0,30,0,0,3,20,6,35,34,
+38,53,52,55,23,6,21,20,51,50,55,38,53,52,54,51,50,23,17,35,17,35,34,21,20,
+23,199,126,111,114,128,160,80,115,121,84,24,79,147,129,89,56,124,23,154,84,
+252,236,87,104,120,105,157,116,84,86,99,127,48,43,84,80,90,11,254,88,1,74,
+72,51,18,255,255,0,0,252,46,2,223,255,29,0,3,0,137,2,127,255,21,255,255,0,
+0,252,46,2,189,255,33,0,3,0,138,2,111,255,21,255,255,0,0,252,46,2,174,254,
+197,0,3,0,139,2,37,254,185,255,255,0,0,252,46,2,223,255,33,0,3,0,140,2,104,
+255,21,255,255,0,0,252,46,2,211,255,21,0,3,0,141,1,197,255,9,255,255,0,0,
+252,46,2,192,255,33,0,3,0,142,2,145,255,21,0,2,252,70,252,45,255,244,253,
+207,0,18,0,28,0,0,1,22,22,51,51,38,53,52,54,51,50,22,22,21,20,6,35,32,3,5,
+54,53,52,38,35,34,6,21,20,252,170,89,230,129,19,55,120,93,74,99,44,202,173,
+254,143,198,2,191,116,47,43,48,49,253,166,129,135,51,78,78,98,51,83,48,112,
+124,1,53,183,25,83,33,40,45,39,64,0,3,252,84,252,45,0,12,253,211,0,23,0,35,
+0,46,0,0,1,6,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,
+38,39,38,38,35,34,6,21,20,22,51,50,54,55,22,22,51,50,53,52,38,35,34,6,254,
+52,75,115,67,101,122,116,97,70,121,68,66,118,69,106,121,118,101,68,119,138,
+48,83,48,51,55,53,49,47,82,192,45,81,47,110,54,56,45,76,252,179,77,57,115,
+98,94,115,60,75,74,61,114,97,99,112,61,154,51,41,51,43,47,51,42,49,48,43,
+96,45,51,42,0,255,255,0,0,252,58,2,209,255,33,0,3,0,145,2,90,255,21,255,255,
+0,0,252,46,2,121,255,33,0,3,0,146,2,74,255,21,0,1,253,109,252,45,255,131,
+253,205,0,19,0,0,3,17,35,34,6,7,22,21,20,6,35,34,38,53,52,54,51,50,23,17,
+252,2,101,147,27,72,51,39,55,57,228,177,67,62,252,57,1,41,75,69,10,73,38,
+44,69,46,129,172,8,254,116,0,255,255,0,0,252,46,2,192,255,33,0,3,0,148,2,
+145,255,21,255,255,0,0,252,46,3,180,255,33,0,3,0,149,2,145,255,21,0,1,253,
+92,252,57,255,131,253,209,0,19,0,0,3,53,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,55,53,51,17,252,81,103,115,125,10,129,12,58,67,102,70,127,252,57,141,
+57,113,108,46,57,10,44,40,60,57,75,132,254,108,255,255,0,0,252,46,3,57,255,
+33,0,3,0,151,2,172,255,21,0,2,253,12,252,45,255,131,253,236,0,25,0,34,0,0,
+3,17,38,35,34,7,22,21,20,6,35,34,38,53,52,55,38,39,55,22,23,54,51,50,23,17,
+1,6,21,20,22,51,50,53,52,252,29,22,72,53,80,101,92,90,102,94,55,62,35,111,
+80,92,137,88,88,254,97,78,43,34,78,252,57,1,40,3,9,57,83,78,84,89,71,84,67,
+19,8,109,24,45,38,15,254,123,1,1,43,62,29,33,64,60,0,1,252,147,252,82,255,
+131,253,158,0,5,0,0,1,53,51,17,33,53,254,254,133,253,16,252,211,203,254,180,
+129,0,0,1,253,92,252,45,0,203,253,240,0,32,0,0,3,53,52,35,34,21,21,35,53,
+52,35,34,6,21,20,23,7,38,53,52,54,51,50,23,54,51,50,22,22,21,21,51,21,106,
+76,78,125,70,44,52,41,117,49,111,92,100,53,61,91,52,78,56,185,252,57,213,
+119,115,217,228,104,63,66,105,87,23,112,107,108,124,75,75,41,94,80,113,111,
+0,0,1,253,92,252,45,0,18,253,240,0,30,0,0,1,54,51,50,22,22,21,21,35,53,52,
+35,34,21,21,35,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,254,192,61,91,52,
+78,56,124,76,78,125,70,44,52,41,117,49,111,92,100,253,165,75,41,94,80,224,
+213,119,115,217,228,104,63,66,105,87,23,112,107,108,124,0,255,255,0,0,252,
+46,2,225,255,33,0,3,0,156,2,178,255,21,255,255,0,0,252,46,2,207,255,33,0,
+3,0,157,2,160,255,21,255,255,0,0,252,58,2,186,255,33,0,3,0,158,2,139,255,
+21,255,255,0,0,252,46,2,200,255,33,0,3,0,159,2,102,255,21,255,255,0,0,252,
+46,3,41,255,33,0,3,0,160,2,250,255,21,255,255,0,6,252,45,3,110,253,176,0,
+3,1,29,2,233,0,0,255,255,0,0,252,45,3,6,253,193,0,3,1,30,1,213,0,0,255,255,
+0,0,252,45,2,78,254,16,0,3,1,31,1,115,0,0,255,255,255,215,252,45,2,41,255,
+49,0,3,1,21,1,109,0,0,255,255,0,0,252,45,1,96,253,193,0,3,1,33,1,53,0,0,255,
+255,0,0,252,45,2,180,254,215,0,3,1,23,1,248,0,0,255,255,0,0,252,45,2,180,
+254,229,0,3,1,24,1,248,0,0,255,255,0,0,252,57,2,198,253,240,0,3,2,18,2,180,
+0,0,255,255,0,0,252,45,2,184,254,31,0,3,2,25,2,166,0,0,255,255,0,0,252,45,
+3,72,253,207,0,2,2,151,0,0,255,255,0,0,252,45,3,82,253,211,0,2,2,152,0,0,
+255,255,0,0,252,45,2,22,253,205,0,3,2,36,2,147,0,0,255,255,0,0,252,57,2,39,
+253,209,0,3,2,39,2,164,0,0,255,255,0,0,252,45,2,119,253,236,0,3,2,41,2,244,
+0,0,255,255,0,0,252,82,2,199,253,158,0,2,2,156,0,0,255,255,0,0,252,45,3,111,
+253,240,0,3,2,43,2,164,0,0,255,255,0,0,252,45,2,182,253,240,0,3,2,44,2,164,
+0,0,255,255,252,66,254,137,255,131,255,213,2,2,0,153,0,0,0,1,252,127,254,
+137,255,131,255,213,0,5,0,0,5,53,51,17,33,53,254,254,133,252,252,246,203,
+254,180,129,0,1,252,188,254,137,255,131,255,213,0,5,0,0,5,53,51,17,33,53,
+254,254,133,253,57,246,203,254,180,129,255,255,0,76,253,171,4,184,5,86,2,
+34,0,52,0,0,0,3,0,58,3,225,255,224,255,255,0,76,253,171,4,193,5,86,2,34,0,
+52,0,0,0,3,0,59,3,78,255,224,255,255,0,76,253,171,4,170,5,86,2,34,0,52,0,
+0,0,3,0,60,3,20,255,224,255,255,0,76,253,205,4,170,5,86,2,34,2,100,0,0,0,
+3,0,129,3,180,0,0,255,255,0,76,253,193,4,170,5,86,2,34,2,100,0,0,0,3,0,136,
+3,170,0,0,255,255,0,76,253,193,4,170,5,86,2,34,2,100,0,0,0,3,0,147,3,223,
+0,0,255,255,0,76,253,205,4,170,5,86,2,34,2,100,0,0,0,3,0,150,3,223,0,0,255,
+255,0,76,253,193,4,170,5,86,2,34,2,100,0,0,0,3,0,152,4,18,0,0,255,255,0,76,
+254,83,4,170,5,86,2,34,0,52,0,0,0,3,2,68,4,37,255,202,255,255,0,76,253,193,
+4,170,5,86,2,34,2,100,0,0,0,3,0,154,3,180,0,0,255,255,0,76,253,193,4,170,
+5,86,2,34,2,100,0,0,0,3,0,155,3,180,0,0,255,255,0,31,253,203,6,57,5,86,2,
+34,0,71,0,0,0,3,1,14,4,92,0,0,255,255,0,31,253,203,6,57,5,86,2,34,0,71,0,
+0,0,3,0,59,3,248,0,0,255,255,0,31,253,203,6,57,5,86,2,34,0,71,0,0,0,3,0,60,
+3,207,0,0,255,255,0,31,253,205,6,57,5,86,2,34,0,71,0,0,0,3,0,129,4,74,0,0,
+255,255,0,31,253,193,6,57,5,86,2,34,0,71,0,0,0,3,0,136,4,16,0,0,255,255,0,
+31,253,193,6,57,5,86,2,34,0,71,0,0,0,3,0,147,4,145,0,0,255,255,0,31,253,205,
+6,57,5,86,2,34,0,71,0,0,0,3,0,150,4,145,0,0,255,255,0,31,253,193,6,57,5,86,
+2,34,0,71,0,0,0,3,0,152,4,145,0,0,255,255,0,31,254,17,6,57,5,86,2,34,0,71,
+0,0,0,3,0,153,5,49,255,136,255,255,0,31,253,193,6,57,5,86,2,34,0,71,0,0,0,
+3,0,154,4,74,0,0,255,255,0,31,253,193,6,57,5,86,2,34,0,71,0,0,0,3,0,155,4,
+74,0,0,255,255,253,29,252,45,0,133,253,176,2,2,1,29,0,0,255,255,254,43,252,
+45,1,49,253,193,2,2,1,30,0,0,255,255,254,141,252,45,0,219,254,16,2,2,1,31,
+0,0,255,255,254,203,252,45,0,43,253,193,2,2,1,33,0,0,255,255,252,147,252,
+82,255,131,253,158,2,2,2,42,0,0,0,1,252,106,253,205,255,131,0,51,0,21,0,0,
+1,53,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,53,51,17,33,53,254,254,89,
+120,127,135,12,133,12,65,74,119,80,133,252,231,254,78,179,69,130,126,60,59,
+10,55,45,76,68,95,155,253,158,129,255,255,0,82,253,229,5,100,5,86,2,34,1,
+210,0,0,0,3,2,42,5,57,1,147,255,255,0,76,253,126,4,254,5,86,2,34,0,194,0,
+0,0,3,2,68,4,104,254,245,0,1,0,76,255,199,4,170,5,86,0,53,0,0,37,53,6,35,
+34,39,7,5,7,37,39,55,38,39,38,38,53,52,54,54,51,32,0,21,20,6,7,39,54,53,52,
+38,35,34,6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,53,51,17,2,221,78,
+106,61,57,110,2,211,28,252,196,36,178,38,14,102,100,136,248,156,1,11,1,55,
+59,56,125,99,232,203,132,186,87,71,34,104,84,54,51,90,72,53,81,36,135,238,
+128,65,22,117,145,118,163,91,198,46,60,64,189,137,131,218,126,254,204,247,
+98,192,77,64,127,168,195,235,104,161,89,146,70,107,74,107,31,77,56,68,79,
+43,47,254,253,236,0,0,3,252,106,252,45,0,133,254,223,0,5,0,32,0,42,0,0,3,
+53,51,17,33,53,1,54,55,55,6,7,22,22,51,50,55,23,6,35,34,38,39,6,35,34,38,
+53,52,54,51,50,22,23,38,38,35,34,6,21,20,51,50,254,129,252,231,2,134,21,5,
+125,14,46,33,71,44,53,29,84,66,96,61,90,63,105,170,103,118,118,89,75,116,
+14,54,84,53,46,48,108,104,254,78,145,254,238,129,254,237,52,59,6,108,84,26,
+36,41,80,78,41,53,110,107,86,84,100,52,143,46,42,43,36,84,0,255,255,0,0,252,
+46,2,217,255,29,0,3,0,130,2,170,255,21,255,255,0,0,252,46,2,201,255,33,0,
+3,0,131,2,154,255,21,255,255,0,0,252,46,2,192,255,33,0,3,0,132,2,145,255,
+21,255,255,0,0,252,46,3,53,255,33,0,3,0,133,2,131,255,21,255,255,0,0,252,
+46,2,200,255,33,0,3,0,134,2,98,255,21,255,255,0,0,252,46,2,215,255,33,0,3,
+0,135,2,78,255,21,255,255,0,0,252,46,2,223,255,29,0,3,0,137,2,127,255,21,
+255,255,0,0,252,46,2,189,255,33,0,3,0,138,2,111,255,21,255,255,0,0,252,46,
+2,174,254,197,0,3,0,139,2,37,254,185,255,255,0,0,252,46,2,223,255,33,0,3,
+0,140,2,104,255,21,255,255,0,0,252,46,2,211,255,21,0,3,0,141,1,197,255,9,
+255,255,0,0,252,46,2,192,255,33,0,3,0,142,2,145,255,21,255,255,0,0,252,58,
+2,209,255,33,0,3,0,145,2,90,255,21,255,255,0,0,252,46,2,121,255,33,0,3,0,
+146,2,74,255,21,255,255,0,0,252,46,2,192,255,33,0,3,0,148,2,145,255,21,255,
+255,0,0,252,46,3,180,255,33,0,3,0,149,2,145,255,21,255,255,0,0,252,46,3,57,
+255,33,0,3,0,151,2,172,255,21,255,255,0,0,252,46,2,225,255,33,0,3,0,156,2,
+178,255,21,255,255,0,0,252,46,2,207,255,33,0,3,0,157,2,160,255,21,255,255,
+0,0,252,58,2,186,255,33,0,3,0,158,2,139,255,21,255,255,0,0,252,46,2,200,255,
+33,0,3,0,159,2,102,255,21,255,255,0,0,252,46,3,41,255,33,0,3,0,160,2,250,
+255,21,255,255,0,0,252,46,2,217,255,29,0,3,0,130,2,170,255,21,255,255,0,0,
+252,46,2,201,255,33,0,3,0,131,2,154,255,21,255,255,0,0,252,46,2,192,255,33,
+0,3,0,132,2,145,255,21,255,255,0,0,252,46,3,53,255,33,0,3,0,133,2,131,255,
+21,255,255,0,0,252,46,2,200,255,33,0,3,0,134,2,98,255,21,255,255,0,0,252,
+46,2,215,255,33,0,3,0,135,2,78,255,21,255,255,0,0,252,46,2,223,255,29,0,3,
+0,137,2,127,255,21,255,255,0,0,252,46,2,189,255,33,0,3,0,138,2,111,255,21,
+255,255,0,0,252,46,2,174,254,197,0,3,0,139,2,37,254,185,255,255,0,0,252,46,
+2,223,255,33,0,3,0,140,2,104,255,21,255,255,0,0,252,46,2,211,255,21,0,3,0,
+141,1,197,255,9,255,255,0,0,252,46,2,192,255,33,0,3,0,142,2,145,255,21,255,
+255,0,0,252,58,2,209,255,33,0,3,0,145,2,90,255,21,255,255,0,0,252,46,2,121,
+255,33,0,3,0,146,2,74,255,21,255,255,0,0,252,46,2,192,255,33,0,3,0,148,2,
+145,255,21,255,255,0,0,252,46,3,180,255,33,0,3,0,149,2,145,255,21,255,255,
+0,0,252,46,3,57,255,33,0,3,0,151,2,172,255,21,255,255,0,0,252,46,2,225,255,
+33,0,3,0,156,2,178,255,21,255,255,0,0,252,46,2,207,255,33,0,3,0,157,2,160,
+255,21,255,255,0,0,252,58,2,186,255,33,0,3,0,158,2,139,255,21,255,255,0,0,
+252,46,2,200,255,33,0,3,0,159,2,102,255,21,255,255,0,0,252,46,3,41,255,33,
+0,3,0,160,2,250,255,21,255,255,0,6,252,45,3,110,253,176,0,3,1,29,2,233,0,
+0,255,255,0,0,252,45,3,6,253,193,0,3,1,30,1,213,0,0,255,255,0,0,252,45,2,
+78,254,16,0,3,1,31,1,115,0,0,255,255,0,0,252,57,2,198,253,240,0,3,2,18,2,
+180,0,0,255,255,0,0,252,45,2,184,254,31,0,3,2,25,2,166,0,0,0,2,0,0,252,45,
+3,72,253,207,0,17,0,28,0,0,19,22,22,23,38,53,52,54,51,50,22,22,21,20,6,35,
+32,3,5,54,53,52,38,35,34,6,21,20,22,100,71,187,106,54,120,93,74,99,44,181,
+153,254,184,178,2,95,110,47,43,48,49,38,253,166,120,137,6,49,79,78,98,51,
+83,48,112,124,1,53,186,23,88,33,40,45,39,31,52,0,0,3,0,0,252,45,3,82,253,
+211,0,24,0,36,0,48,0,0,1,6,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,
+22,21,20,6,35,34,38,55,22,22,51,50,54,53,52,38,35,34,6,7,38,38,35,34,6,21,
+20,22,51,50,54,1,172,62,106,59,91,110,103,87,61,106,63,53,106,66,68,94,43,
+106,91,63,104,2,39,68,40,43,49,46,46,39,64,170,42,68,39,43,47,44,42,39,66,
+252,175,70,60,114,99,94,115,57,74,66,65,58,95,58,99,112,60,145,48,42,46,50,
+45,51,43,49,52,40,51,43,48,50,39,0,255,255,0,0,252,45,2,22,253,205,0,3,2,
+36,2,147,0,0,255,255,0,0,252,57,2,39,253,209,0,3,2,39,2,164,0,0,255,255,0,
+0,252,45,2,119,253,236,0,3,2,41,2,244,0,0,0,1,0,0,252,82,2,199,253,158,0,
+5,0,0,1,53,51,17,33,53,2,66,133,253,57,252,211,203,254,180,129,0,255,255,
+0,0,252,45,3,111,253,240,0,3,2,43,2,164,0,0,255,255,0,0,252,45,2,182,253,
+240,0,3,2,44,2,164,0,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,
+1,4,9,0,1,0,30,0,94,0,3,0,1,4,9,0,2,0,14,0,124,0,3,0,1,4,9,0,3,0,68,0,138,
+0,3,0,1,4,9,0,4,0,30,0,94,0,3,0,1,4,9,0,5,0,30,0,206,0,3,0,1,4,9,0,6,0,26,
+0,236,0,3,0,1,4,9,0,7,0,68,1,6,0,3,0,1,4,9,0,8,0,42,1,74,0,3,0,1,4,9,0,9,
+0,40,1,116,0,3,0,1,4,9,0,10,0,96,1,156,0,3,0,1,4,9,0,11,0,62,1,252,0,3,0,
+1,4,9,0,12,0,60,2,58,0,3,0,1,4,9,0,13,2,150,2,118,0,3,0,1,4,9,0,14,0,52,5,
+12,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,
+49,0,53,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,
+0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,
+101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,
+0,83,0,97,0,110,0,115,0,32,0,79,0,114,0,105,0,121,0,97,0,82,0,101,0,103,0,
+117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,79,0,114,0,105,0,121,0,97,0,86,0,101,
+0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,49,0,32,0,117,0,104,0,
+78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,79,0,114,0,105,0,121,0,97,0,
+78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,
+0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,
+0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,
+32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,
+115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,
+0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,
+0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,
+0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,
+0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,
+0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,
+65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,
+0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,
+0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,
+0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,
+0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,
+115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,
+0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,
+0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,
+101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,
+0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,
+0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,
+0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,
+0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,
+0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,
+0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,
+0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,
+0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,159,0,0,1,2,0,2,
+0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,
+18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,
+1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,
+1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,
+1,63,1,64,2,127,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,
+76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,
+1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,
+1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,
+117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,
+1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,
+142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,
+1,155,1,156,1,157,2,135,2,195,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,
+165,1,166,1,167,2,134,1,168,1,169,1,170,1,171,2,136,1,172,1,173,1,174,1,175,
+1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,
+188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,
+1,201,1,202,1,203,1,204,2,138,1,205,1,206,2,137,1,207,1,208,1,209,1,210,1,
+211,1,212,1,213,1,214,1,215,2,139,2,133,1,216,1,217,1,218,2,132,1,219,1,220,
+2,140,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,
+232,1,233,1,234,1,235,2,130,2,128,1,236,2,129,1,237,1,238,1,239,1,240,1,241,
+1,242,1,243,1,244,1,245,2,131,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,
+253,2,156,3,60,3,61,3,62,2,155,2,154,2,153,2,152,2,151,2,150,2,149,2,148,
+2,147,2,146,2,145,2,144,2,143,2,142,2,225,2,141,2,227,2,226,1,254,1,255,2,
+0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,
+2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,
+2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,
+2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,
+2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,
+2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,
+2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,
+2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,
+118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,157,2,158,2,159,2,160,
+2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,
+173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,
+2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,196,2,197,2,198,2,
+199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,
+2,212,2,213,2,214,2,224,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,
+223,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,
+2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,2,251,2,
+252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,
+12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,
+3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,3,41,
+3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,98,3,49,3,100,3,99,3,50,3,51,3,52,3,
+53,3,54,3,55,3,56,3,57,3,58,3,59,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,
+3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,
+3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,101,3,102,3,
+103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,3,111,3,112,3,113,3,114,3,115,
+3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,127,3,
+128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,138,3,139,3,140,
+3,141,3,142,3,143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,3,151,3,152,3,
+153,3,154,3,155,3,156,3,157,4,78,85,76,76,15,99,97,110,100,114,97,98,105,
+110,100,117,111,114,121,97,12,97,110,117,115,118,97,114,97,111,114,121,97,
+11,118,105,115,97,114,103,97,111,114,121,97,5,97,111,114,121,97,6,97,97,111,
+114,121,97,5,105,111,114,121,97,6,105,105,111,114,121,97,5,117,111,114,121,
+97,6,117,117,111,114,121,97,12,114,118,111,99,97,108,105,99,111,114,121,97,
+12,108,118,111,99,97,108,105,99,111,114,121,97,5,101,111,114,121,97,6,97,
+105,111,114,121,97,5,111,111,114,121,97,6,97,117,111,114,121,97,6,107,97,
+111,114,121,97,7,107,104,97,111,114,121,97,6,103,97,111,114,121,97,7,103,
+104,97,111,114,121,97,7,110,103,97,111,114,121,97,6,99,97,111,114,121,97,
+7,99,104,97,111,114,121,97,6,106,97,111,114,121,97,7,106,104,97,111,114,121,
+97,7,110,121,97,111,114,121,97,7,116,116,97,111,114,121,97,8,116,116,104,
+97,111,114,121,97,7,100,100,97,111,114,121,97,8,100,100,104,97,111,114,121,
+97,7,110,110,97,111,114,121,97,6,116,97,111,114,121,97,7,116,104,97,111,114,
+121,97,6,100,97,111,114,121,97,7,100,104,97,111,114,121,97,6,110,97,111,114,
+121,97,6,112,97,111,114,121,97,7,112,104,97,111,114,121,97,6,98,97,111,114,
+121,97,7,98,104,97,111,114,121,97,6,109,97,111,114,121,97,6,121,97,111,114,
+121,97,6,114,97,111,114,121,97,6,108,97,111,114,121,97,7,108,108,97,111,114,
+121,97,6,118,97,111,114,121,97,7,115,104,97,111,114,121,97,7,115,115,97,111,
+114,121,97,6,115,97,111,114,121,97,6,104,97,111,114,121,97,9,110,117,107,
+116,97,111,114,121,97,12,97,118,97,103,114,97,104,97,111,114,121,97,15,97,
+97,118,111,119,101,108,115,105,103,110,111,114,121,97,14,105,118,111,119,
+101,108,115,105,103,110,111,114,121,97,15,105,105,118,111,119,101,108,115,
+105,103,110,111,114,121,97,14,117,118,111,119,101,108,115,105,103,110,111,
+114,121,97,15,117,117,118,111,119,101,108,115,105,103,110,111,114,121,97,
+21,114,118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,110,111,114,
+121,97,22,114,114,118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,
+110,111,114,121,97,14,101,118,111,119,101,108,115,105,103,110,111,114,121,
+97,15,97,105,118,111,119,101,108,115,105,103,110,111,114,121,97,14,111,118,
+111,119,101,108,115,105,103,110,111,114,121,97,15,97,117,118,111,119,101,
+108,115,105,103,110,111,114,121,97,16,97,105,108,101,110,103,116,104,109,
+97,114,107,111,114,121,97,16,97,117,108,101,110,103,116,104,109,97,114,107,
+111,114,121,97,7,114,114,97,111,114,121,97,7,114,104,97,111,114,121,97,7,
+121,121,97,111,114,121,97,13,114,114,118,111,99,97,108,105,99,111,114,121,
+97,13,108,108,118,111,99,97,108,105,99,111,114,121,97,21,108,118,111,99,97,
+108,105,99,118,111,119,101,108,115,105,103,110,111,114,121,97,22,108,108,
+118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,110,111,114,121,
+97,8,122,101,114,111,111,114,121,97,7,111,110,101,111,114,121,97,7,116,119,
+111,111,114,121,97,9,116,104,114,101,101,111,114,121,97,8,102,111,117,114,
+111,114,121,97,8,102,105,118,101,111,114,121,97,7,115,105,120,111,114,121,
+97,9,115,101,118,101,110,111,114,121,97,9,101,105,103,104,116,111,114,121,
+97,8,110,105,110,101,111,114,121,97,10,105,115,115,104,97,114,111,114,121,
+97,6,119,97,111,114,121,97,7,117,110,105,48,66,55,50,7,117,110,105,48,66,
+55,51,7,117,110,105,48,66,55,52,7,117,110,105,48,66,55,53,7,117,110,105,48,
+66,55,54,7,117,110,105,48,66,55,55,11,107,97,110,117,107,116,97,111,114,121,
+97,12,107,104,97,110,117,107,116,97,111,114,121,97,11,103,97,110,117,107,
+116,97,111,114,121,97,12,103,104,97,110,117,107,116,97,111,114,121,97,12,
+110,103,97,110,117,107,116,97,111,114,121,97,11,99,97,110,117,107,116,97,
+111,114,121,97,12,99,104,97,110,117,107,116,97,111,114,121,97,11,106,97,110,
+117,107,116,97,111,114,121,97,12,106,104,97,110,117,107,116,97,111,114,121,
+97,12,110,121,97,110,117,107,116,97,111,114,121,97,12,116,116,97,110,117,
+107,116,97,111,114,121,97,13,116,116,104,97,110,117,107,116,97,111,114,121,
+97,12,110,110,97,110,117,107,116,97,111,114,121,97,11,116,97,110,117,107,
+116,97,111,114,121,97,12,116,104,97,110,117,107,116,97,111,114,121,97,11,
+100,97,110,117,107,116,97,111,114,121,97,12,100,104,97,110,117,107,116,97,
+111,114,121,97,11,110,97,110,117,107,116,97,111,114,121,97,11,112,97,110,
+117,107,116,97,111,114,121,97,12,112,104,97,110,117,107,116,97,111,114,121,
+97,11,98,97,110,117,107,116,97,111,114,121,97,12,98,104,97,110,117,107,116,
+97,111,114,121,97,11,109,97,110,117,107,116,97,111,114,121,97,11,121,97,110,
+117,107,116,97,111,114,121,97,11,114,97,110,117,107,116,97,111,114,121,97,
+11,108,97,110,117,107,116,97,111,114,121,97,12,108,108,97,110,117,107,116,
+97,111,114,121,97,11,118,97,110,117,107,116,97,111,114,121,97,12,115,104,
+97,110,117,107,116,97,111,114,121,97,12,115,115,97,110,117,107,116,97,111,
+114,121,97,11,115,97,110,117,107,116,97,111,114,121,97,11,104,97,110,117,
+107,116,97,111,114,121,97,12,121,121,97,110,117,107,116,97,111,114,121,97,
+11,119,97,110,117,107,116,97,111,114,121,97,8,114,101,112,104,111,114,121,
+97,15,107,97,115,117,98,115,99,114,105,112,116,111,114,121,97,16,107,104,
+97,115,117,98,115,99,114,105,112,116,111,114,121,97,15,103,97,115,117,98,
+115,99,114,105,112,116,111,114,121,97,16,103,104,97,115,117,98,115,99,114,
+105,112,116,111,114,121,97,16,110,103,97,115,117,98,115,99,114,105,112,116,
+111,114,121,97,15,99,97,115,117,98,115,99,114,105,112,116,111,114,121,97,
+16,99,104,97,115,117,98,115,99,114,105,112,116,111,114,121,97,15,106,97,115,
+117,98,115,99,114,105,112,116,111,114,121,97,16,106,104,97,115,117,98,115,
+99,114,105,112,116,111,114,121,97,16,116,116,97,115,117,98,115,99,114,105,
+112,116,111,114,121,97,17,116,116,104,97,115,117,98,115,99,114,105,112,116,
+111,114,121,97,16,100,100,97,115,117,98,115,99,114,105,112,116,111,114,121,
+97,17,100,100,104,97,115,117,98,115,99,114,105,112,116,111,114,121,97,16,
+110,110,97,115,117,98,115,99,114,105,112,116,111,114,121,97,15,116,97,115,
+117,98,115,99,114,105,112,116,111,114,121,97,16,116,104,97,115,117,98,115,
+99,114,105,112,116,111,114,121,97,15,100,97,115,117,98,115,99,114,105,112,
+116,111,114,121,97,16,100,104,97,115,117,98,115,99,114,105,112,116,111,114,
+121,97,15,110,97,115,117,98,115,99,114,105,112,116,111,114,121,97,15,112,
+97,115,117,98,115,99,114,105,112,116,111,114,121,97,16,112,104,97,115,117,
+98,115,99,114,105,112,116,111,114,121,97,15,98,97,115,117,98,115,99,114,105,
+112,116,111,114,121,97,16,98,104,97,115,117,98,115,99,114,105,112,116,111,
+114,121,97,15,109,97,115,117,98,115,99,114,105,112,116,111,114,121,97,15,
+114,97,115,117,98,115,99,114,105,112,116,111,114,121,97,15,108,97,115,117,
+98,115,99,114,105,112,116,111,114,121,97,16,108,108,97,115,117,98,115,99,
+114,105,112,116,111,114,121,97,16,115,104,97,115,117,98,115,99,114,105,112,
+116,111,114,121,97,16,115,115,97,115,117,98,115,99,114,105,112,116,111,114,
+121,97,15,115,97,115,117,98,115,99,114,105,112,116,111,114,121,97,15,104,
+97,115,117,98,115,99,114,105,112,116,111,114,121,97,10,121,97,112,111,115,
+116,111,114,121,97,8,107,97,107,97,111,114,121,97,9,107,97,116,116,97,111,
+114,121,97,8,107,97,116,97,111,114,121,97,9,107,97,108,108,97,111,114,121,
+97,9,107,97,115,115,97,111,114,121,97,12,107,97,115,115,97,110,110,97,111,
+114,121,97,8,107,97,115,97,111,114,121,97,8,103,97,100,97,111,114,121,97,
+9,103,97,100,104,97,111,114,121,97,9,110,103,97,107,97,111,114,121,97,10,
+110,103,97,107,104,97,111,114,121,97,9,110,103,97,103,97,111,114,121,97,10,
+110,103,97,103,104,97,111,114,121,97,8,99,97,99,97,111,114,121,97,9,99,97,
+99,104,97,111,114,121,97,8,106,97,106,97,111,114,121,97,9,106,97,110,121,
+97,111,114,121,97,9,110,121,97,99,97,111,114,121,97,10,110,121,97,99,104,
+97,111,114,121,97,9,110,121,97,106,97,111,114,121,97,10,110,121,97,106,104,
+97,111,114,121,97,10,116,116,97,116,116,97,111,114,121,97,9,100,100,97,103,
+97,111,114,121,97,10,100,100,97,100,100,97,111,114,121,97,10,110,110,97,116,
+116,97,111,114,121,97,11,110,110,97,116,116,104,97,111,114,121,97,10,110,
+110,97,100,100,97,111,114,121,97,11,110,110,97,100,100,104,97,111,114,121,
+97,10,110,110,97,110,110,97,111,114,121,97,8,116,97,107,97,111,114,121,97,
+8,116,97,116,97,111,114,121,97,9,116,97,116,104,97,111,114,121,97,8,116,97,
+110,97,111,114,121,97,8,116,97,112,97,111,114,121,97,8,116,97,109,97,111,
+114,121,97,8,116,97,115,97,111,114,121,97,8,100,97,103,97,111,114,121,97,
+8,100,97,100,97,111,114,121,97,9,100,97,100,104,97,111,114,121,97,9,100,97,
+98,104,97,111,114,121,97,13,100,104,97,121,97,112,111,115,116,111,114,121,
+97,8,110,97,116,97,111,114,121,97,10,110,97,116,97,114,97,111,114,121,97,
+9,110,97,116,104,97,111,114,121,97,8,110,97,100,97,111,114,121,97,9,110,97,
+100,104,97,111,114,121,97,8,112,97,116,97,111,114,121,97,8,112,97,112,97,
+111,114,121,97,8,112,97,115,97,111,114,121,97,8,98,97,100,97,111,114,121,
+97,9,98,97,100,104,97,111,114,121,97,8,98,97,98,97,111,114,121,97,8,109,97,
+112,97,111,114,121,97,9,109,97,112,104,97,111,114,121,97,9,109,97,98,104,
+97,111,114,121,97,8,109,97,109,97,111,114,121,97,8,108,97,107,97,111,114,
+121,97,9,108,108,97,107,97,111,114,121,97,9,108,108,97,112,97,111,114,121,
+97,10,108,108,97,112,104,97,111,114,121,97,9,115,104,97,99,97,111,114,121,
+97,10,115,104,97,99,104,97,111,114,121,97,9,115,115,97,107,97,111,114,121,
+97,10,115,115,97,116,116,97,111,114,121,97,11,115,115,97,116,116,104,97,111,
+114,121,97,10,115,115,97,110,110,97,111,114,121,97,9,115,115,97,112,97,111,
+114,121,97,10,115,115,97,112,104,97,111,114,121,97,8,115,97,107,97,111,114,
+121,97,9,115,97,107,104,97,111,114,121,97,8,115,97,116,97,111,114,121,97,
+10,115,97,116,97,114,97,111,114,121,97,9,115,97,116,104,97,111,114,121,97,
+8,115,97,112,97,111,114,121,97,9,115,97,112,104,97,111,114,121,97,19,114,
+101,112,104,99,97,110,100,114,97,98,105,110,100,117,111,114,121,97,17,97,
+105,99,97,110,100,114,97,98,105,110,100,117,111,114,121,97,17,97,117,99,97,
+110,100,114,97,98,105,110,100,117,111,114,121,97,25,105,118,111,119,101,108,
+115,105,103,110,99,97,110,100,114,97,98,105,110,100,117,111,114,121,97,18,
+105,118,111,119,101,108,115,105,103,110,114,101,112,104,111,114,121,97,29,
+105,118,111,119,101,108,115,105,103,110,114,101,112,104,99,97,110,100,114,
+97,98,105,110,100,117,111,114,121,97,27,97,105,108,101,110,103,116,104,109,
+97,114,107,99,97,110,100,114,97,98,105,110,100,117,111,114,121,97,20,97,105,
+108,101,110,103,116,104,109,97,114,107,114,101,112,104,111,114,121,97,31,
+97,105,108,101,110,103,116,104,109,97,114,107,114,101,112,104,99,97,110,100,
+114,97,98,105,110,100,117,111,114,121,97,27,97,117,108,101,110,103,116,104,
+109,97,114,107,99,97,110,100,114,97,98,105,110,100,117,111,114,121,97,20,
+97,117,108,101,110,103,116,104,109,97,114,107,114,101,112,104,111,114,121,
+97,31,97,117,108,101,110,103,116,104,109,97,114,107,114,101,112,104,99,97,
+110,100,114,97,98,105,110,100,117,111,114,121,97,18,105,118,111,119,101,108,
+115,105,103,110,119,105,100,101,111,114,121,97,29,105,118,111,119,101,108,
+115,105,103,110,99,97,110,100,114,97,98,105,110,100,117,119,105,100,101,111,
+114,121,97,22,105,118,111,119,101,108,115,105,103,110,114,101,112,104,119,
+105,100,101,111,114,121,97,29,105,118,111,119,101,108,114,101,112,104,99,
+97,110,100,114,97,98,105,110,100,117,119,105,100,101,111,114,121,97,20,105,
+118,111,119,101,108,115,105,103,110,110,97,114,114,111,119,111,114,121,97,
+31,105,118,111,119,101,108,115,105,103,110,99,97,110,100,114,97,98,105,110,
+100,117,110,97,114,114,111,119,111,114,121,97,24,105,118,111,119,101,108,
+115,105,103,110,114,101,112,104,110,97,114,114,111,119,111,114,121,97,31,
+105,118,111,119,101,108,114,101,112,104,99,97,110,100,114,97,98,105,110,100,
+117,110,97,114,114,111,119,111,114,121,97,10,107,97,104,97,108,102,111,114,
+121,97,11,107,104,97,104,97,108,102,111,114,121,97,10,103,97,104,97,108,102,
+111,114,121,97,11,103,104,97,104,97,108,102,111,114,121,97,11,110,103,97,
+104,97,108,102,111,114,121,97,10,99,97,104,97,108,102,111,114,121,97,11,99,
+104,97,104,97,108,102,111,114,121,97,10,106,97,104,97,108,102,111,114,121,
+97,11,106,104,97,104,97,108,102,111,114,121,97,11,110,121,97,104,97,108,102,
+111,114,121,97,11,116,116,97,104,97,108,102,111,114,121,97,12,116,116,104,
+97,104,97,108,102,111,114,121,97,11,100,100,97,104,97,108,102,111,114,121,
+97,12,100,100,104,97,104,97,108,102,111,114,121,97,11,110,110,97,104,97,108,
+102,111,114,121,97,10,116,97,104,97,108,102,111,114,121,97,11,116,104,97,
+104,97,108,102,111,114,121,97,10,100,97,104,97,108,102,111,114,121,97,11,
+100,104,97,104,97,108,102,111,114,121,97,10,110,97,104,97,108,102,111,114,
+121,97,10,112,97,104,97,108,102,111,114,121,97,11,112,104,97,104,97,108,102,
+111,114,121,97,10,98,97,104,97,108,102,111,114,121,97,11,98,104,97,104,97,
+108,102,111,114,121,97,10,109,97,104,97,108,102,111,114,121,97,10,121,97,
+104,97,108,102,111,114,121,97,10,114,97,104,97,108,102,111,114,121,97,10,
+108,97,104,97,108,102,111,114,121,97,11,108,108,97,104,97,108,102,111,114,
+121,97,10,118,97,104,97,108,102,111,114,121,97,11,115,104,97,104,97,108,102,
+111,114,121,97,11,115,115,97,104,97,108,102,111,114,121,97,10,115,97,104,
+97,108,102,111,114,121,97,10,104,97,104,97,108,102,111,114,121,97,11,114,
+114,97,104,97,108,102,111,114,121,97,11,114,104,97,104,97,108,102,111,114,
+121,97,11,121,121,97,104,97,108,102,111,114,121,97,10,119,97,104,97,108,102,
+111,114,121,97,15,107,97,110,117,107,116,97,104,97,108,102,111,114,121,97,
+16,107,104,97,110,117,107,116,97,104,97,108,102,111,114,121,97,15,103,97,
+110,117,107,116,97,104,97,108,102,111,114,121,97,16,103,104,97,110,117,107,
+116,97,104,97,108,102,111,114,121,97,16,110,103,97,110,117,107,116,97,104,
+97,108,102,111,114,121,97,15,99,97,110,117,107,116,97,104,97,108,102,111,
+114,121,97,16,99,104,97,110,117,107,116,97,104,97,108,102,111,114,121,97,
+15,106,97,110,117,107,116,97,104,97,108,102,111,114,121,97,16,106,104,97,
+110,117,107,116,97,104,97,108,102,111,114,121,97,16,110,121,97,110,117,107,
+116,97,104,97,108,102,111,114,121,97,16,116,116,97,110,117,107,116,97,104,
+97,108,102,111,114,121,97,17,116,116,104,97,110,117,107,116,97,104,97,108,
+102,111,114,121,97,16,110,110,97,110,117,107,116,97,104,97,108,102,111,114,
+121,97,15,116,97,110,117,107,116,97,104,97,108,102,111,114,121,97,16,116,
+104,97,110,117,107,116,97,104,97,108,102,111,114,121,97,15,100,97,110,117,
+107,116,97,104,97,108,102,111,114,121,97,16,100,104,97,110,117,107,116,97,
+104,97,108,102,111,114,121,97,15,110,97,110,117,107,116,97,104,97,108,102,
+111,114,121,97,15,112,97,110,117,107,116,97,104,97,108,102,111,114,121,97,
+16,112,104,97,110,117,107,116,97,104,97,108,102,111,114,121,97,15,98,97,110,
+117,107,116,97,104,97,108,102,111,114,121,97,16,98,104,97,110,117,107,116,
+97,104,97,108,102,111,114,121,97,15,109,97,110,117,107,116,97,104,97,108,
+102,111,114,121,97,15,121,97,110,117,107,116,97,104,97,108,102,111,114,121,
+97,15,114,97,110,117,107,116,97,104,97,108,102,111,114,121,97,15,108,97,110,
+117,107,116,97,104,97,108,102,111,114,121,97,16,108,108,97,110,117,107,116,
+97,104,97,108,102,111,114,121,97,15,118,97,110,117,107,116,97,104,97,108,
+102,111,114,121,97,16,115,104,97,110,117,107,116,97,104,97,108,102,111,114,
+121,97,16,115,115,97,110,117,107,116,97,104,97,108,102,111,114,121,97,15,
+115,97,110,117,107,116,97,104,97,108,102,111,114,121,97,15,104,97,110,117,
+107,116,97,104,97,108,102,111,114,121,97,16,121,121,97,110,117,107,116,97,
+104,97,108,102,111,114,121,97,15,119,97,110,117,107,116,97,104,97,108,102,
+111,114,121,97,13,107,97,115,115,97,104,97,108,102,111,114,121,97,11,101,
+120,99,108,97,109,46,111,114,121,97,13,113,117,111,116,101,100,98,108,46,
+111,114,121,97,15,110,117,109,98,101,114,115,105,103,110,46,111,114,121,97,
+12,112,101,114,99,101,110,116,46,111,114,121,97,16,113,117,111,116,101,115,
+105,110,103,108,101,46,111,114,121,97,14,112,97,114,101,110,108,101,102,116,
+46,111,114,121,97,15,112,97,114,101,110,114,105,103,104,116,46,111,114,121,
+97,13,97,115,116,101,114,105,115,107,46,111,114,121,97,9,112,108,117,115,
+46,111,114,121,97,10,99,111,109,109,97,46,111,114,121,97,11,104,121,112,104,
+101,110,46,111,114,121,97,11,112,101,114,105,111,100,46,111,114,121,97,10,
+115,108,97,115,104,46,111,114,121,97,9,122,101,114,111,46,111,114,121,97,
+8,111,110,101,46,111,114,121,97,8,116,119,111,46,111,114,121,97,10,116,104,
+114,101,101,46,111,114,121,97,9,102,111,117,114,46,111,114,121,97,9,102,105,
+118,101,46,111,114,121,97,8,115,105,120,46,111,114,121,97,10,115,101,118,
+101,110,46,111,114,121,97,10,101,105,103,104,116,46,111,114,121,97,9,110,
+105,110,101,46,111,114,121,97,10,99,111,108,111,110,46,111,114,121,97,14,
+115,101,109,105,99,111,108,111,110,46,111,114,121,97,9,108,101,115,115,46,
+111,114,121,97,10,101,113,117,97,108,46,111,114,121,97,12,103,114,101,97,
+116,101,114,46,111,114,121,97,13,113,117,101,115,116,105,111,110,46,111,114,
+121,97,16,98,114,97,99,107,101,116,108,101,102,116,46,111,114,121,97,14,98,
+97,99,107,115,108,97,115,104,46,111,114,121,97,17,98,114,97,99,107,101,116,
+114,105,103,104,116,46,111,114,121,97,16,97,115,99,105,105,99,105,114,99,
+117,109,46,111,114,121,97,15,117,110,100,101,114,115,99,111,114,101,46,111,
+114,121,97,14,98,114,97,99,101,108,101,102,116,46,111,114,121,97,8,98,97,
+114,46,111,114,121,97,15,98,114,97,99,101,114,105,103,104,116,46,111,114,
+121,97,15,97,115,99,105,105,116,105,108,100,101,46,111,114,121,97,14,115,
+102,116,104,121,112,104,101,110,46,111,114,121,97,11,101,110,100,97,115,104,
+46,111,114,121,97,11,101,109,100,97,115,104,46,111,114,121,97,14,113,117,
+111,116,101,108,101,102,116,46,111,114,121,97,15,113,117,111,116,101,114,
+105,103,104,116,46,111,114,121,97,17,113,117,111,116,101,100,98,108,108,101,
+102,116,46,111,114,121,97,18,113,117,111,116,101,100,98,108,114,105,103,104,
+116,46,111,114,121,97,13,101,108,108,105,112,115,105,115,46,111,114,121,97,
+13,109,117,108,116,105,112,108,121,46,111,114,121,97,11,100,105,118,105,100,
+101,46,111,114,121,97,10,109,105,110,117,115,46,111,114,121,97,12,117,110,
+105,50,48,66,57,46,111,114,121,97,10,100,97,110,100,97,46,111,114,121,97,
+13,100,98,108,100,97,110,100,97,46,111,114,121,97,7,117,110,105,50,48,48,
+66,7,117,110,105,50,48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,50,53,
+67,67,10,118,105,114,97,109,97,111,114,121,97,6,111,109,111,114,121,97,10,
+97,117,114,101,112,104,111,114,121,97,10,97,105,114,101,112,104,111,114,121,
+97,17,105,118,111,119,101,108,115,105,103,110,108,111,119,111,114,121,97,
+10,108,108,97,108,108,97,111,114,121,97,8,108,97,108,97,111,114,121,97,9,
+103,97,108,108,97,111,114,121,97,18,107,97,115,115,97,115,117,98,115,99,114,
+105,112,116,111,114,121,97,12,110,103,97,107,97,115,115,97,111,114,121,97,
+9,112,97,108,108,97,111,114,121,97,8,110,97,110,97,111,114,121,97,8,108,97,
+103,97,111,114,121,97,10,115,104,97,108,108,97,111,114,121,97,14,118,105,
+114,97,109,97,100,101,101,112,111,114,121,97,25,114,118,111,99,97,108,105,
+99,118,111,119,101,108,115,105,103,110,100,101,101,112,111,114,121,97,19,
+117,117,118,111,119,101,108,115,105,103,110,100,101,101,112,111,114,121,97,
+18,117,118,111,119,101,108,115,105,103,110,100,101,101,112,111,114,121,97,
+15,118,105,114,97,109,97,108,111,119,101,114,111,114,121,97,26,114,118,111,
+99,97,108,105,99,118,111,119,101,108,115,105,103,110,108,111,119,101,114,
+111,114,121,97,20,117,117,118,111,119,101,108,115,105,103,110,108,111,119,
+101,114,111,114,121,97,19,117,118,111,119,101,108,115,105,103,110,108,111,
+119,101,114,111,114,121,97,25,108,108,118,111,99,97,108,105,99,118,111,119,
+101,108,115,105,103,110,108,111,119,111,114,121,97,24,108,118,111,99,97,108,
+105,99,118,111,119,101,108,115,105,103,110,108,111,119,111,114,121,97,13,
+118,105,114,97,109,97,108,111,119,111,114,121,97,25,114,114,118,111,99,97,
+108,105,99,118,111,119,101,108,115,105,103,110,108,111,119,111,114,121,97,
+24,114,118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,110,108,111,
+119,111,114,121,97,18,117,117,118,111,119,101,108,115,105,103,110,108,111,
+119,111,114,121,97,17,117,118,111,119,101,108,115,105,103,110,108,111,119,
+111,114,121,97,17,117,118,111,119,101,108,115,105,103,110,97,108,116,111,
+114,121,97,20,110,117,107,116,97,107,97,115,117,98,115,99,114,105,112,116,
+111,114,121,97,21,110,117,107,116,97,107,104,97,115,117,98,115,99,114,105,
+112,116,111,114,121,97,20,110,117,107,116,97,103,97,115,117,98,115,99,114,
+105,112,116,111,114,121,97,21,110,117,107,116,97,103,104,97,115,117,98,115,
+99,114,105,112,116,111,114,121,97,21,110,117,107,116,97,110,103,97,115,117,
+98,115,99,114,105,112,116,111,114,121,97,20,110,117,107,116,97,99,97,115,
+117,98,115,99,114,105,112,116,111,114,121,97,21,110,117,107,116,97,99,104,
+97,115,117,98,115,99,114,105,112,116,111,114,121,97,20,110,117,107,116,97,
+106,97,115,117,98,115,99,114,105,112,116,111,114,121,97,21,110,117,107,116,
+97,106,104,97,115,117,98,115,99,114,105,112,116,111,114,121,97,21,110,117,
+107,116,97,116,116,97,115,117,98,115,99,114,105,112,116,111,114,121,97,22,
+110,117,107,116,97,116,116,104,97,115,117,98,115,99,114,105,112,116,111,114,
+121,97,21,110,117,107,116,97,100,100,97,115,117,98,115,99,114,105,112,116,
+111,114,121,97,22,110,117,107,116,97,100,100,104,97,115,117,98,115,99,114,
+105,112,116,111,114,121,97,21,110,117,107,116,97,110,110,97,115,117,98,115,
+99,114,105,112,116,111,114,121,97,20,110,117,107,116,97,116,97,115,117,98,
+115,99,114,105,112,116,111,114,121,97,21,110,117,107,116,97,116,104,97,115,
+117,98,115,99,114,105,112,116,111,114,121,97,20,110,117,107,116,97,100,97,
+115,117,98,115,99,114,105,112,116,111,114,121,97,21,110,117,107,116,97,100,
+104,97,115,117,98,115,99,114,105,112,116,111,114,121,97,20,110,117,107,116,
+97,110,97,115,117,98,115,99,114,105,112,116,111,114,121,97,20,110,117,107,
+116,97,112,97,115,117,98,115,99,114,105,112,116,111,114,121,97,21,110,117,
+107,116,97,112,104,97,115,117,98,115,99,114,105,112,116,111,114,121,97,20,
+110,117,107,116,97,98,97,115,117,98,115,99,114,105,112,116,111,114,121,97,
+21,110,117,107,116,97,98,104,97,115,117,98,115,99,114,105,112,116,111,114,
+121,97,20,110,117,107,116,97,109,97,115,117,98,115,99,114,105,112,116,111,
+114,121,97,20,110,117,107,116,97,114,97,115,117,98,115,99,114,105,112,116,
+111,114,121,97,20,110,117,107,116,97,108,97,115,117,98,115,99,114,105,112,
+116,111,114,121,97,21,110,117,107,116,97,108,108,97,115,117,98,115,99,114,
+105,112,116,111,114,121,97,21,110,117,107,116,97,115,104,97,115,117,98,115,
+99,114,105,112,116,111,114,121,97,21,110,117,107,116,97,115,115,97,115,117,
+98,115,99,114,105,112,116,111,114,121,97,20,110,117,107,116,97,115,97,115,
+117,98,115,99,114,105,112,116,111,114,121,97,20,110,117,107,116,97,104,97,
+115,117,98,115,99,114,105,112,116,111,114,121,97,23,110,117,107,116,97,107,
+97,115,115,97,115,117,98,115,99,114,105,112,116,111,114,121,97,19,110,117,
+107,116,97,117,118,111,119,101,108,115,105,103,110,111,114,121,97,20,110,
+117,107,116,97,117,117,118,111,119,101,108,115,105,103,110,111,114,121,97,
+26,110,117,107,116,97,114,118,111,99,97,108,105,99,118,111,119,101,108,115,
+105,103,110,111,114,121,97,27,110,117,107,116,97,114,114,118,111,99,97,108,
+105,99,118,111,119,101,108,115,105,103,110,111,114,121,97,26,110,117,107,
+116,97,108,118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,110,111,
+114,121,97,27,110,117,107,116,97,108,108,118,111,99,97,108,105,99,118,111,
+119,101,108,115,105,103,110,111,114,121,97,17,116,97,114,97,115,117,98,115,
+99,114,105,112,116,111,114,121,97,10,107,97,107,97,85,73,111,114,121,97,10,
+107,97,116,97,85,73,111,114,121,97,11,107,97,108,108,97,85,73,111,114,121,
+97,11,103,97,108,108,97,85,73,111,114,121,97,10,106,97,106,97,85,73,111,114,
+121,97,12,110,110,97,116,116,97,85,73,111,114,121,97,13,110,110,97,116,116,
+104,97,85,73,111,114,121,97,12,110,110,97,100,100,97,85,73,111,114,121,97,
+12,110,110,97,110,110,97,85,73,111,114,121,97,11,116,97,116,104,97,85,73,
+111,114,121,97,10,110,97,116,97,85,73,111,114,121,97,12,110,97,116,97,114,
+97,85,73,111,114,121,97,10,110,97,110,97,85,73,111,114,121,97,10,112,97,116,
+97,85,73,111,114,121,97,10,109,97,109,97,85,73,111,114,121,97,10,108,97,107,
+97,85,73,111,114,121,97,10,108,97,108,97,85,73,111,114,121,97,11,108,108,
+97,107,97,85,73,111,114,121,97,12,108,108,97,108,108,97,85,73,111,114,121,
+97,12,115,104,97,108,108,97,85,73,111,114,121,97,12,115,115,97,116,116,97,
+85,73,111,114,121,97,13,115,115,97,116,116,104,97,85,73,111,114,121,97,12,
+115,115,97,110,110,97,85,73,111,114,121,97,11,115,97,107,104,97,85,73,111,
+114,121,97,10,115,97,116,97,85,73,111,114,121,97,12,115,97,116,97,114,97,
+85,73,111,114,121,97,10,115,97,112,97,85,73,111,114,121,97,11,115,97,112,
+104,97,85,73,111,114,121,97,12,115,104,97,99,104,97,85,73,111,114,121,97,
+26,114,114,118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,110,108,
+101,102,116,111,114,121,97,26,108,108,118,111,99,97,108,105,99,118,111,119,
+101,108,115,105,103,110,108,101,102,116,111,114,121,97,25,108,118,111,99,
+97,108,105,99,118,111,119,101,108,115,105,103,110,108,101,102,116,111,114,
+121,97,18,107,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,
+97,19,107,104,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,
+97,18,103,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,
+19,103,104,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,
+19,110,103,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,
+18,99,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,19,
+99,104,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,18,
+106,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,19,106,
+104,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,19,116,
+116,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,20,116,
+116,104,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,19,
+100,100,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,20,
+100,100,104,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,
+97,19,110,110,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,
+97,18,116,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,
+19,116,104,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,
+18,100,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,19,
+100,104,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,18,
+110,97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,18,112,
+97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,19,112,104,
+97,115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,18,98,97,
+115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,19,98,104,97,
+115,117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,18,109,97,115,
+117,98,115,99,114,105,112,116,108,111,119,111,114,121,97,18,114,97,115,117,
+98,115,99,114,105,112,116,108,111,119,111,114,121,97,18,108,97,115,117,98,
+115,99,114,105,112,116,108,111,119,111,114,121,97,19,108,108,97,115,117,98,
+115,99,114,105,112,116,108,111,119,111,114,121,97,19,115,104,97,115,117,98,
+115,99,114,105,112,116,108,111,119,111,114,121,97,19,115,115,97,115,117,98,
+115,99,114,105,112,116,108,111,119,111,114,121,97,18,115,97,115,117,98,115,
+99,114,105,112,116,108,111,119,111,114,121,97,18,104,97,115,117,98,115,99,
+114,105,112,116,108,111,119,111,114,121,97,21,107,97,115,115,97,115,117,98,
+115,99,114,105,112,116,108,111,119,111,114,121,97,20,107,97,115,117,98,115,
+99,114,105,112,116,108,111,119,101,114,111,114,121,97,20,106,97,115,117,98,
+115,99,114,105,112,116,108,111,119,101,114,111,114,121,97,20,116,97,115,117,
+98,115,99,114,105,112,116,108,111,119,101,114,111,114,121,97,21,116,104,97,
+115,117,98,115,99,114,105,112,116,108,111,119,101,114,111,114,121,97,20,110,
+97,115,117,98,115,99,114,105,112,116,108,111,119,101,114,111,114,121,97,20,
+98,97,115,117,98,115,99,114,105,112,116,108,111,119,101,114,111,114,121,97,
+20,109,97,115,117,98,115,99,114,105,112,116,108,111,119,101,114,111,114,121,
+97,20,114,97,115,117,98,115,99,114,105,112,116,108,111,119,101,114,111,114,
+121,97,20,108,97,115,117,98,115,99,114,105,112,116,108,111,119,101,114,111,
+114,121,97,21,108,108,97,115,117,98,115,99,114,105,112,116,108,111,119,101,
+114,111,114,121,97,19,107,97,115,117,98,115,99,114,105,112,116,100,101,101,
+112,111,114,121,97,20,107,104,97,115,117,98,115,99,114,105,112,116,108,101,
+102,116,111,114,121,97,19,103,97,115,117,98,115,99,114,105,112,116,108,101,
+102,116,111,114,121,97,20,103,104,97,115,117,98,115,99,114,105,112,116,108,
+101,102,116,111,114,121,97,20,110,103,97,115,117,98,115,99,114,105,112,116,
+108,101,102,116,111,114,121,97,19,99,97,115,117,98,115,99,114,105,112,116,
+108,101,102,116,111,114,121,97,20,99,104,97,115,117,98,115,99,114,105,112,
+116,108,101,102,116,111,114,121,97,19,106,97,115,117,98,115,99,114,105,112,
+116,100,101,101,112,111,114,121,97,20,106,104,97,115,117,98,115,99,114,105,
+112,116,108,101,102,116,111,114,121,97,20,116,116,97,115,117,98,115,99,114,
+105,112,116,108,101,102,116,111,114,121,97,21,116,116,104,97,115,117,98,115,
+99,114,105,112,116,108,101,102,116,111,114,121,97,20,100,100,97,115,117,98,
+115,99,114,105,112,116,108,101,102,116,111,114,121,97,21,100,100,104,97,115,
+117,98,115,99,114,105,112,116,108,101,102,116,111,114,121,97,20,110,110,97,
+115,117,98,115,99,114,105,112,116,108,101,102,116,111,114,121,97,19,116,97,
+115,117,98,115,99,114,105,112,116,100,101,101,112,111,114,121,97,20,116,104,
+97,115,117,98,115,99,114,105,112,116,100,101,101,112,111,114,121,97,19,100,
+97,115,117,98,115,99,114,105,112,116,108,101,102,116,111,114,121,97,20,100,
+104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,111,114,121,97,19,
+110,97,115,117,98,115,99,114,105,112,116,100,101,101,112,111,114,121,97,19,
+112,97,115,117,98,115,99,114,105,112,116,108,101,102,116,111,114,121,97,20,
+112,104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,111,114,121,
+97,19,98,97,115,117,98,115,99,114,105,112,116,100,101,101,112,111,114,121,
+97,20,98,104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,111,114,
+121,97,19,109,97,115,117,98,115,99,114,105,112,116,100,101,101,112,111,114,
+121,97,19,114,97,115,117,98,115,99,114,105,112,116,100,101,101,112,111,114,
+121,97,19,108,97,115,117,98,115,99,114,105,112,116,100,101,101,112,111,114,
+121,97,20,108,108,97,115,117,98,115,99,114,105,112,116,100,101,101,112,111,
+114,121,97,20,115,104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,
+111,114,121,97,20,115,115,97,115,117,98,115,99,114,105,112,116,108,101,102,
+116,111,114,121,97,19,115,97,115,117,98,115,99,114,105,112,116,108,101,102,
+116,111,114,121,97,19,104,97,115,117,98,115,99,114,105,112,116,108,101,102,
+116,111,114,121,97,22,107,97,115,115,97,115,117,98,115,99,114,105,112,116,
+108,101,102,116,111,114,121,97,18,117,118,111,119,101,108,115,105,103,110,
+108,101,102,116,111,114,121,97,19,117,117,118,111,119,101,108,115,105,103,
+110,108,101,102,116,111,114,121,97,25,114,118,111,99,97,108,105,99,118,111,
+119,101,108,115,105,103,110,108,101,102,116,111,114,121,97,14,118,105,114,
+97,109,97,108,101,102,116,111,114,121,97,19,107,97,115,117,98,115,99,114,
+105,112,116,108,101,102,116,111,114,121,97,19,106,97,115,117,98,115,99,114,
+105,112,116,108,101,102,116,111,114,121,97,19,116,97,115,117,98,115,99,114,
+105,112,116,108,101,102,116,111,114,121,97,20,116,104,97,115,117,98,115,99,
+114,105,112,116,108,101,102,116,111,114,121,97,19,110,97,115,117,98,115,99,
+114,105,112,116,108,101,102,116,111,114,121,97,19,98,97,115,117,98,115,99,
+114,105,112,116,108,101,102,116,111,114,121,97,19,109,97,115,117,98,115,99,
+114,105,112,116,108,101,102,116,111,114,121,97,19,114,97,115,117,98,115,99,
+114,105,112,116,108,101,102,116,111,114,121,97,19,108,97,115,117,98,115,99,
+114,105,112,116,108,101,102,116,111,114,121,97,20,108,108,97,115,117,98,115,
+99,114,105,112,116,108,101,102,116,111,114,121,97,18,117,117,118,111,119,
+101,108,115,105,103,110,97,108,116,111,114,121,97,24,114,118,111,99,97,108,
+105,99,118,111,119,101,108,115,105,103,110,97,108,116,111,114,121,97,25,114,
+114,118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,110,97,108,116,
+111,114,121,97,18,114,97,115,117,98,115,99,114,105,112,116,97,108,116,111,
+114,121,97,20,114,97,115,117,98,115,99,114,105,112,116,115,104,111,114,116,
+111,114,121,97,22,114,97,115,117,98,115,99,114,105,112,116,115,104,111,114,
+116,101,114,111,114,121,97,6,104,117,111,114,121,97,7,104,117,117,111,114,
+121,97,13,104,114,118,111,99,97,108,105,99,111,114,121,97,8,104,97,107,97,
+111,114,121,97,8,104,97,106,97,111,114,121,97,8,104,97,110,97,111,114,121,
+97,8,104,97,98,97,111,114,121,97,8,104,97,109,97,111,114,121,97,8,104,97,
+114,97,111,114,121,97,8,104,97,108,97,111,114,121,97,9,104,97,108,108,97,
+111,114,121,97,7,121,121,117,111,114,121,97,8,121,121,117,117,111,114,121,
+97,14,121,121,114,118,111,99,97,108,105,99,111,114,121,97,9,121,121,97,107,
+97,111,114,121,97,9,121,121,97,106,97,111,114,121,97,9,121,121,97,110,97,
+111,114,121,97,9,121,121,97,98,97,111,114,121,97,9,121,121,97,109,97,111,
+114,121,97,9,121,121,97,114,97,111,114,121,97,9,121,121,97,108,97,111,114,
+121,97,10,121,121,97,108,108,97,111,114,121,97,18,117,118,111,119,101,108,
+115,105,103,110,109,97,114,107,111,114,121,97,19,117,117,118,111,119,101,
+108,115,105,103,110,109,97,114,107,111,114,121,97,25,114,118,111,99,97,108,
+105,99,118,111,119,101,108,115,105,103,110,109,97,114,107,111,114,121,97,
+14,118,105,114,97,109,97,109,97,114,107,111,114,121,97,19,114,97,115,117,
+98,115,99,114,105,112,116,109,97,114,107,111,114,121,97,17,98,97,114,97,115,
+117,98,115,99,114,105,112,116,111,114,121,97,12,110,110,97,100,100,97,114,
+97,111,114,121,97,10,116,97,107,97,114,97,111,114,121,97,12,104,97,115,113,
+117,105,115,104,111,114,121,97,23,114,117,118,111,119,101,108,115,117,98,
+115,99,114,105,112,116,108,111,119,111,114,121,97,27,114,114,118,111,99,97,
+108,105,99,118,111,119,101,108,115,105,103,110,115,112,97,99,101,111,114,
+121,97,27,108,108,118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,
+110,115,112,97,99,101,111,114,121,97,26,108,118,111,99,97,108,105,99,118,
+111,119,101,108,115,105,103,110,115,112,97,99,101,111,114,121,97,21,107,104,
+97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,20,
+103,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,
+21,103,104,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,
+121,97,21,110,103,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,
+111,114,121,97,20,99,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,
+111,114,121,97,21,99,104,97,115,117,98,115,99,114,105,112,116,115,112,97,
+99,101,111,114,121,97,21,106,104,97,115,117,98,115,99,114,105,112,116,115,
+112,97,99,101,111,114,121,97,21,116,116,97,115,117,98,115,99,114,105,112,
+116,115,112,97,99,101,111,114,121,97,22,116,116,104,97,115,117,98,115,99,
+114,105,112,116,115,112,97,99,101,111,114,121,97,21,100,100,97,115,117,98,
+115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,22,100,100,104,97,
+115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,21,110,
+110,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,
+20,100,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,
+97,21,100,104,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,
+114,121,97,20,112,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,
+111,114,121,97,21,112,104,97,115,117,98,115,99,114,105,112,116,115,112,97,
+99,101,111,114,121,97,21,98,104,97,115,117,98,115,99,114,105,112,116,115,
+112,97,99,101,111,114,121,97,21,115,104,97,115,117,98,115,99,114,105,112,
+116,115,112,97,99,101,111,114,121,97,21,115,115,97,115,117,98,115,99,114,
+105,112,116,115,112,97,99,101,111,114,121,97,20,115,97,115,117,98,115,99,
+114,105,112,116,115,112,97,99,101,111,114,121,97,20,104,97,115,117,98,115,
+99,114,105,112,116,115,112,97,99,101,111,114,121,97,23,107,97,115,115,97,
+115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,24,107,
+104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,109,97,114,107,111,
+114,121,97,23,103,97,115,117,98,115,99,114,105,112,116,108,101,102,116,109,
+97,114,107,111,114,121,97,24,103,104,97,115,117,98,115,99,114,105,112,116,
+108,101,102,116,109,97,114,107,111,114,121,97,24,110,103,97,115,117,98,115,
+99,114,105,112,116,108,101,102,116,109,97,114,107,111,114,121,97,23,99,97,
+115,117,98,115,99,114,105,112,116,108,101,102,116,109,97,114,107,111,114,
+121,97,24,99,104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,109,
+97,114,107,111,114,121,97,24,106,104,97,115,117,98,115,99,114,105,112,116,
+108,101,102,116,109,97,114,107,111,114,121,97,24,116,116,97,115,117,98,115,
+99,114,105,112,116,108,101,102,116,109,97,114,107,111,114,121,97,25,116,116,
+104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,109,97,114,107,111,
+114,121,97,24,100,100,97,115,117,98,115,99,114,105,112,116,108,101,102,116,
+109,97,114,107,111,114,121,97,25,100,100,104,97,115,117,98,115,99,114,105,
+112,116,108,101,102,116,109,97,114,107,111,114,121,97,24,110,110,97,115,117,
+98,115,99,114,105,112,116,108,101,102,116,109,97,114,107,111,114,121,97,23,
+100,97,115,117,98,115,99,114,105,112,116,108,101,102,116,109,97,114,107,111,
+114,121,97,24,100,104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,
+109,97,114,107,111,114,121,97,23,112,97,115,117,98,115,99,114,105,112,116,
+108,101,102,116,109,97,114,107,111,114,121,97,24,112,104,97,115,117,98,115,
+99,114,105,112,116,108,101,102,116,109,97,114,107,111,114,121,97,24,98,104,
+97,115,117,98,115,99,114,105,112,116,108,101,102,116,109,97,114,107,111,114,
+121,97,24,115,104,97,115,117,98,115,99,114,105,112,116,108,101,102,116,109,
+97,114,107,111,114,121,97,24,115,115,97,115,117,98,115,99,114,105,112,116,
+108,101,102,116,109,97,114,107,111,114,121,97,23,115,97,115,117,98,115,99,
+114,105,112,116,108,101,102,116,109,97,114,107,111,114,121,97,23,104,97,115,
+117,98,115,99,114,105,112,116,108,101,102,116,109,97,114,107,111,114,121,
+97,26,107,97,115,115,97,115,117,98,115,99,114,105,112,116,108,101,102,116,
+109,97,114,107,111,114,121,97,19,117,118,111,119,101,108,115,105,103,110,
+115,112,97,99,101,111,114,121,97,20,117,117,118,111,119,101,108,115,105,103,
+110,115,112,97,99,101,111,114,121,97,26,114,118,111,99,97,108,105,99,118,
+111,119,101,108,115,105,103,110,115,112,97,99,101,111,114,121,97,20,107,97,
+115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,20,106,
+97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,20,
+116,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,121,97,
+21,116,104,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,114,
+121,97,20,110,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,
+114,121,97,20,98,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,111,
+114,121,97,20,109,97,115,117,98,115,99,114,105,112,116,115,112,97,99,101,
+111,114,121,97,20,114,97,115,117,98,115,99,114,105,112,116,115,112,97,99,
+101,111,114,121,97,20,108,97,115,117,98,115,99,114,105,112,116,115,112,97,
+99,101,111,114,121,97,21,108,108,97,115,117,98,115,99,114,105,112,116,115,
+112,97,99,101,111,114,121,97,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,
+12,0,0,0,0,0,202,0,2,0,31,0,4,0,4,0,3,0,5,0,52,0,1,0,53,0,53,0,3,0,54,0,55,
+0,1,0,56,0,56,0,3,0,57,0,57,0,1,0,58,0,61,0,3,0,62,0,62,0,1,0,66,0,67,0,3,
+0,68,0,73,0,1,0,74,0,75,0,3,0,87,0,87,0,1,0,94,0,127,0,2,0,128,0,161,0,3,
+0,162,0,245,0,2,0,246,0,246,0,3,0,247,0,251,0,2,0,252,1,1,0,3,1,2,1,4,0,2,
+1,5,1,35,0,3,1,36,1,108,0,2,1,161,1,161,0,3,1,164,1,164,0,1,1,165,1,202,0,
+3,1,203,1,231,0,2,1,232,2,69,0,3,2,70,2,91,0,2,2,92,2,97,0,3,2,98,2,99,0,
+2,2,100,2,100,0,1,2,101,2,158,0,3,0,2,0,17,0,4,0,4,0,2,0,53,0,53,0,3,0,56,
+0,56,0,1,0,58,0,61,0,3,0,66,0,66,0,3,0,74,0,75,0,3,0,128,0,128,0,2,0,129,
+0,161,0,3,0,246,0,246,0,2,0,252,0,254,0,1,1,5,1,5,0,3,1,6,1,13,0,1,1,14,1,
+35,0,3,1,165,1,202,0,3,1,232,2,69,0,3,2,92,2,97,0,3,2,101,2,158,0,3,0,1,0,
+0,0,10,0,58,0,138,0,2,111,114,121,50,0,14,111,114,121,97,0,18,0,8,0,0,0,18,
+0,0,0,0,255,255,0,4,0,0,0,1,0,2,0,4,0,0,255,255,0,3,0,0,0,1,0,3,0,5,97,98,
+118,109,0,32,98,108,119,109,0,40,100,105,115,116,0,56,100,105,115,116,0,64,
+107,101,114,110,0,74,0,0,0,2,0,8,0,9,0,0,0,6,0,2,0,3,0,4,0,5,0,6,0,7,0,0,
+0,2,0,0,0,10,0,0,0,3,0,0,0,1,0,10,0,0,0,1,0,1,0,12,0,26,3,104,5,142,15,166,
+20,236,23,38,25,148,34,10,44,92,51,148,54,126,55,106,0,2,0,8,0,1,0,8,0,1,
+0,118,0,4,0,0,0,54,0,230,0,236,0,242,0,248,0,254,2,32,2,38,2,44,2,50,2,56,
+2,62,2,68,2,74,2,80,2,86,2,92,2,98,2,104,2,110,2,116,2,122,2,128,2,134,2,
+140,2,146,2,152,2,158,2,164,2,170,2,176,2,182,2,188,2,194,2,200,2,206,2,212,
+2,218,2,224,2,230,2,236,2,242,2,248,2,254,3,4,3,10,3,16,3,22,3,28,3,34,3,
+40,3,46,3,52,3,58,3,64,0,1,0,54,0,30,0,42,0,45,0,46,0,62,0,71,0,105,0,115,
+0,118,0,119,0,126,0,168,0,170,0,182,0,184,0,185,0,189,0,190,0,195,0,204,0,
+223,0,224,0,225,0,230,0,233,0,234,0,235,0,238,0,239,0,240,0,242,0,245,1,72,
+1,106,1,208,1,209,1,218,1,219,1,224,1,225,1,227,1,229,1,231,2,81,2,82,2,83,
+2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,0,1,0,57,255,215,0,1,0,57,255,236,
+0,1,0,57,255,236,0,1,0,57,255,236,0,72,0,25,0,12,0,28,0,20,0,30,0,20,0,33,
+0,25,0,35,0,47,0,37,0,47,0,44,0,47,0,71,0,47,0,100,0,12,0,103,0,20,0,105,
+0,20,0,106,0,25,0,108,0,47,0,110,0,47,0,117,0,47,0,126,0,47,0,164,255,236,
+0,167,0,47,0,168,0,47,0,169,255,236,0,170,255,236,0,181,0,43,0,182,0,43,0,
+183,0,43,0,184,0,43,0,185,0,43,0,187,255,236,0,188,255,236,0,189,0,25,0,190,
+0,25,0,191,0,25,0,192,0,25,0,193,0,25,0,196,255,254,0,201,255,246,0,209,0,
+47,0,210,0,47,0,213,255,236,0,215,255,236,0,217,255,236,0,237,255,236,0,238,
+255,236,0,242,255,250,0,243,255,248,0,245,255,248,1,61,0,47,1,72,0,47,1,97,
+0,47,1,106,0,47,1,108,0,47,1,208,0,25,1,209,0,25,1,210,0,25,1,211,0,10,1,
+212,255,236,1,226,255,236,1,227,255,248,1,229,255,248,1,230,255,248,1,231,
+255,248,2,81,0,47,2,82,0,47,2,83,0,47,2,84,0,47,2,85,0,41,2,86,0,47,2,87,
+0,47,2,88,0,47,2,89,0,47,2,90,0,47,2,91,0,47,2,98,0,25,0,1,0,57,255,145,0,
+1,0,57,255,215,0,1,0,57,255,236,0,1,0,57,255,236,0,1,0,57,255,236,0,1,0,57,
+255,145,0,1,0,57,255,123,0,1,0,57,255,178,0,1,0,57,255,215,0,1,0,57,255,166,
+0,1,0,57,0,41,0,1,0,57,255,145,0,1,0,57,255,244,0,1,0,57,255,236,0,1,0,57,
+255,236,0,1,0,57,255,236,0,1,0,57,255,236,0,1,0,57,255,236,0,1,0,57,255,182,
+0,1,0,57,255,135,0,1,0,57,255,143,0,1,0,57,255,244,0,1,0,57,255,168,0,1,0,
+57,255,135,0,1,0,57,255,129,0,1,0,57,255,246,0,1,0,57,255,168,0,1,0,57,255,
+145,0,1,0,57,255,145,0,1,0,57,255,129,0,1,0,57,255,244,0,1,0,57,255,236,0,
+1,0,57,255,236,0,1,0,57,255,129,0,1,0,57,255,242,0,1,0,57,255,113,0,1,0,57,
+255,246,0,1,0,57,255,158,0,1,0,57,255,145,0,1,0,57,255,145,0,1,0,57,255,145,
+0,1,0,57,255,145,0,1,0,57,255,145,0,1,0,57,255,145,0,1,0,57,255,145,0,1,0,
+57,255,145,0,1,0,57,255,145,0,1,0,57,255,145,0,1,0,57,255,145,0,2,0,8,0,1,
+0,8,0,2,0,112,0,4,0,0,0,222,1,210,0,16,0,3,0,0,0,0,0,0,0,0,255,186,255,195,
+0,0,0,51,0,51,0,0,0,41,0,41,0,0,0,57,0,57,0,0,0,20,0,20,0,0,0,61,0,61,0,0,
+0,82,0,82,0,0,0,55,0,55,0,0,0,29,0,29,0,0,0,88,0,88,0,0,0,72,0,72,0,0,0,31,
+0,31,0,0,0,86,0,86,0,0,0,78,0,78,0,0,0,68,0,68,0,1,0,53,0,23,0,71,0,98,0,
+126,0,168,0,170,0,185,0,189,0,190,0,191,0,192,0,193,0,214,0,221,0,223,0,224,
+0,230,0,233,0,234,0,235,0,236,0,238,0,239,0,240,0,245,1,72,1,106,1,206,1,
+208,1,209,1,210,1,211,1,216,1,218,1,219,1,223,1,224,1,225,1,226,1,227,1,231,
+2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,98,0,2,0,40,0,23,
+0,23,0,1,0,71,0,71,0,2,0,98,0,98,0,1,0,126,0,126,0,2,0,168,0,168,0,3,0,170,
+0,170,0,4,0,185,0,185,0,5,0,189,0,190,0,6,0,191,0,191,0,2,0,192,0,192,0,8,
+0,193,0,193,0,9,0,214,0,214,0,10,0,221,0,221,0,3,0,223,0,223,0,3,0,224,0,
+224,0,11,0,230,0,230,0,11,0,233,0,233,0,13,0,234,0,235,0,6,0,236,0,236,0,
+9,0,238,0,238,0,14,0,239,0,239,0,13,0,240,0,240,0,8,0,245,0,245,0,14,1,72,
+1,72,0,2,1,106,1,106,0,2,1,206,1,206,0,3,1,208,1,208,0,3,1,209,1,209,0,6,
+1,210,1,210,0,7,1,211,1,211,0,6,1,216,1,216,0,5,1,218,1,218,0,3,1,219,1,219,
+0,12,1,223,1,223,0,2,1,224,1,224,0,3,1,225,1,226,0,6,1,227,1,227,0,3,1,231,
+1,231,0,15,2,81,2,91,0,2,2,98,2,98,0,7,0,2,0,12,0,44,0,44,0,1,0,71,0,71,0,
+1,0,117,0,117,0,1,0,126,0,126,0,1,0,167,0,168,0,1,0,209,0,210,0,2,1,61,1,
+61,0,1,1,72,1,72,0,1,1,97,1,97,0,1,1,106,1,106,0,1,1,108,1,108,0,1,2,81,2,
+91,0,1,0,4,0,0,0,1,0,8,0,1,0,12,0,118,0,1,0,182,4,230,0,2,0,17,0,58,0,61,
+0,0,0,66,0,66,0,4,0,74,0,75,0,5,0,129,0,142,0,7,0,145,0,161,0,21,1,14,1,31,
+0,38,1,33,1,33,0,56,1,232,1,245,0,57,1,248,2,9,0,71,2,12,2,18,0,89,2,25,2,
+25,0,96,2,36,2,36,0,97,2,39,2,39,0,98,2,41,2,44,0,99,2,68,2,69,0,103,2,97,
+2,97,0,105,2,101,2,101,0,106,0,2,0,10,0,19,0,52,0,0,0,71,0,71,0,34,0,87,0,
+87,0,35,0,163,0,167,0,36,0,169,0,245,0,41,1,203,1,231,0,118,2,73,2,80,0,147,
+2,84,2,91,0,155,2,98,2,98,0,163,2,100,2,100,0,164,0,107,0,0,1,174,0,0,1,180,
+0,0,1,186,0,0,1,192,0,0,1,198,0,0,1,204,0,0,1,210,0,0,1,216,0,0,1,222,0,0,
+1,228,0,0,1,234,0,0,1,240,0,0,1,246,0,0,1,252,0,0,2,2,0,0,2,8,0,0,2,14,0,
+0,2,20,0,0,2,26,0,0,2,32,0,0,2,38,0,0,2,44,0,0,2,50,0,0,2,56,0,0,2,62,0,0,
+2,68,0,0,2,74,0,0,2,80,0,0,2,86,0,0,2,92,0,0,2,98,0,0,2,104,0,0,2,110,0,0,
+2,116,0,0,2,122,0,0,2,128,0,0,2,134,0,0,2,140,0,0,2,146,0,0,2,152,0,0,2,158,
+0,0,2,164,0,0,2,170,0,0,2,176,0,0,2,182,0,0,2,188,0,0,2,194,0,0,2,200,0,0,
+2,206,0,0,2,212,0,0,2,218,0,0,2,224,0,0,2,230,0,0,2,236,0,0,2,242,0,0,2,248,
+0,0,2,254,0,0,3,4,0,0,3,10,0,0,3,16,0,0,3,22,0,0,3,28,0,0,3,34,0,0,3,40,0,
+0,3,46,0,0,3,52,0,0,3,58,0,0,3,64,0,0,3,70,0,0,3,76,0,0,3,82,0,0,3,88,0,0,
+3,94,0,0,3,100,0,0,3,106,0,0,3,112,0,0,3,118,0,0,3,124,0,0,3,130,0,0,3,136,
+0,0,3,142,0,0,3,148,0,0,3,154,0,0,3,160,0,0,3,166,0,0,3,172,0,0,3,178,0,0,
+3,184,0,0,3,190,0,0,3,196,0,0,3,202,0,0,3,208,0,0,3,214,0,0,3,220,0,0,3,226,
+0,0,3,232,0,0,3,238,0,0,3,244,0,0,3,250,0,0,4,0,0,0,4,6,0,0,4,12,0,0,4,18,
+0,0,4,24,0,0,4,30,0,0,4,36,0,0,4,42,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,
+131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,
+1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,
+0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,
+131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,
+1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,
+0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,
+131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,
+1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,0,85,0,
+0,0,1,0,85,0,0,0,1,0,115,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,
+0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,
+131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,
+1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,
+0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,
+131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,
+1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,
+0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,
+131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,
+1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,
+0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,
+131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,
+1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,
+0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,131,0,0,0,1,255,
+131,0,0,0,1,255,131,0,0,0,165,1,76,1,82,1,88,1,94,1,100,1,106,1,112,1,118,
+1,124,1,130,1,136,1,142,1,148,1,154,1,160,1,166,1,172,1,178,1,184,1,190,1,
+196,1,202,1,208,1,214,1,220,1,226,1,232,1,238,1,244,1,250,2,0,2,6,2,12,2,
+18,2,24,2,30,2,36,2,42,2,48,2,54,2,60,2,66,2,72,2,78,2,84,2,90,2,96,2,102,
+2,108,2,114,2,120,2,126,2,132,2,138,2,144,2,150,2,156,2,162,2,168,2,174,2,
+180,2,186,2,192,2,198,2,204,2,210,2,216,2,222,2,228,2,234,2,240,2,246,2,252,
+3,2,3,8,3,14,3,20,3,26,3,32,3,38,3,44,3,50,3,56,3,62,3,68,3,74,3,80,3,86,
+3,92,3,98,3,104,3,110,3,116,3,122,3,128,3,134,3,140,3,146,3,152,3,158,3,164,
+3,170,3,176,3,182,3,188,3,194,3,200,3,206,3,212,3,218,3,224,3,230,3,236,3,
+242,3,248,3,254,4,4,4,10,4,16,4,22,4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,
+4,76,4,82,4,88,4,94,4,100,4,106,4,112,4,118,4,124,4,130,4,136,4,142,4,148,
+4,154,4,160,4,166,4,172,4,178,4,184,4,190,4,196,4,202,4,208,4,214,4,220,4,
+226,4,232,4,238,4,244,4,250,5,0,5,6,5,12,5,18,5,24,5,30,5,36,0,1,3,236,0,
+0,0,1,4,199,0,0,0,1,4,193,0,0,0,1,4,178,0,0,0,1,3,142,0,0,0,1,3,132,0,0,0,
+1,3,227,0,0,0,1,3,223,0,0,0,1,3,93,0,0,0,1,3,227,0,0,0,1,3,132,0,0,0,1,4,
+61,0,0,0,1,3,142,0,0,0,1,3,142,0,0,0,1,4,172,0,0,0,1,3,171,0,0,0,1,4,135,
+0,0,0,1,3,125,0,0,0,1,4,41,0,0,0,1,3,125,0,0,0,1,4,178,0,0,0,1,4,178,0,0,
+0,1,3,127,0,0,0,1,3,167,0,0,0,1,4,178,0,0,0,1,4,250,0,0,0,1,3,113,0,0,0,1,
+3,233,0,0,0,1,3,248,0,0,0,1,3,127,0,0,0,1,4,199,0,0,0,1,4,203,0,0,0,1,4,168,
+0,0,0,1,3,70,0,80,0,1,4,221,0,0,0,1,3,217,0,0,0,1,5,2,0,0,0,1,4,86,0,0,0,
+1,3,236,0,0,0,1,4,178,0,0,0,1,5,18,0,0,0,1,3,240,0,0,0,1,4,244,0,0,0,1,4,
+193,0,0,0,1,4,193,0,0,0,1,4,195,0,0,0,1,4,223,0,0,0,1,4,217,0,0,0,1,4,178,
+0,0,0,1,4,90,0,0,0,1,3,189,0,0,0,1,3,226,0,140,0,1,4,39,0,0,0,1,4,98,0,0,
+0,1,4,102,0,0,0,1,3,231,0,0,0,1,5,211,0,0,0,1,4,98,0,0,0,1,3,229,0,0,0,1,
+4,86,0,0,0,1,3,182,0,0,0,1,4,188,0,0,0,1,4,172,0,0,0,1,4,172,0,0,0,1,4,172,
+0,0,0,1,4,172,0,0,0,1,3,60,0,30,0,1,3,171,0,0,0,1,4,25,0,0,0,1,3,123,0,0,
+0,1,3,254,0,30,0,1,4,178,0,0,0,1,3,194,0,30,0,1,4,113,0,0,0,1,3,229,0,0,0,
+1,3,229,0,0,0,1,3,246,0,0,0,1,4,61,0,0,0,1,3,125,0,0,0,1,3,181,0,0,0,1,3,
+125,0,0,0,1,3,199,0,0,0,1,3,199,0,0,0,1,3,217,0,0,0,1,4,178,0,0,0,1,4,178,
+0,0,0,1,4,203,0,0,0,1,4,178,0,0,0,1,3,213,0,0,0,1,4,45,0,0,0,1,3,240,0,0,
+0,1,4,219,0,0,0,1,4,219,0,0,0,1,4,178,0,0,0,1,4,178,0,0,0,1,4,186,0,0,0,1,
+4,145,0,0,0,1,4,59,0,0,0,1,5,2,0,0,0,1,3,233,0,0,0,1,3,233,0,0,0,1,4,74,0,
+0,0,1,5,56,0,0,0,1,4,199,0,0,0,1,4,238,0,0,0,1,4,203,0,0,0,1,5,16,0,0,0,1,
+4,203,0,0,0,1,4,203,0,0,0,1,4,203,0,0,0,1,4,203,0,0,0,1,4,168,0,0,0,1,5,2,
+0,0,0,1,4,168,0,0,0,1,4,168,0,0,0,1,4,168,0,0,0,1,4,168,0,0,0,1,4,168,0,0,
+0,1,4,240,0,0,0,1,3,236,0,0,0,1,4,168,0,0,0,1,4,214,0,0,0,1,4,39,0,0,0,1,
+4,193,0,0,0,1,4,172,0,0,0,1,4,188,0,0,0,1,4,172,0,0,0,1,4,25,0,0,0,1,3,125,
+0,0,0,1,3,185,0,0,0,1,4,23,0,0,0,1,4,178,0,0,0,1,4,178,0,0,0,1,4,104,0,0,
+0,1,4,59,0,0,0,1,4,246,0,0,0,1,4,55,0,0,0,1,4,229,0,0,0,1,4,238,0,0,0,1,5,
+16,0,0,0,1,4,203,0,0,0,1,4,203,0,0,0,1,5,12,0,0,0,1,4,168,0,0,0,1,4,168,0,
+0,0,1,4,182,0,0,0,1,4,182,0,0,0,1,3,198,0,0,0,1,3,198,0,0,0,1,3,98,0,0,0,
+1,3,98,0,0,0,1,3,149,0,0,0,1,3,98,0,0,0,1,3,198,0,0,0,1,3,198,0,0,0,1,4,92,
+0,0,0,1,4,34,0,0,0,1,4,20,0,0,0,1,4,20,0,0,0,1,4,20,0,0,0,1,4,55,0,0,0,1,
+4,92,0,0,0,1,4,92,0,0,0,1,4,188,0,0,0,1,2,238,0,0,0,4,0,0,0,1,0,8,0,1,0,12,
+0,36,0,1,1,6,1,108,0,1,0,10,0,143,0,144,1,246,1,247,2,10,2,11,2,32,2,33,2,
+67,2,96,0,2,0,37,0,19,0,19,0,0,0,23,0,32,0,1,0,34,0,34,0,11,0,36,0,36,0,12,
+0,38,0,38,0,13,0,40,0,42,0,14,0,45,0,48,0,17,0,52,0,52,0,21,0,71,0,71,0,22,
+0,87,0,87,0,23,0,163,0,166,0,24,0,168,0,170,0,28,0,172,0,181,0,31,0,183,0,
+183,0,41,0,185,0,190,0,42,0,194,0,197,0,48,0,201,0,204,0,52,0,206,0,211,0,
+56,0,214,0,214,0,62,0,216,0,218,0,63,0,220,0,221,0,66,0,223,0,230,0,68,0,
+232,0,235,0,76,0,238,0,240,0,80,0,242,0,242,0,83,0,245,0,245,0,84,1,203,1,
+205,0,85,1,207,1,209,0,88,1,212,1,215,0,91,1,218,1,221,0,95,1,223,1,225,0,
+99,1,227,1,227,0,102,1,229,1,229,0,103,1,231,1,231,0,104,2,73,2,80,0,105,
+2,84,2,91,0,113,2,100,2,100,0,121,0,10,0,0,0,42,0,0,0,48,0,0,0,54,0,0,0,60,
+0,0,0,66,0,0,0,72,0,0,0,78,0,0,0,84,0,0,0,90,0,0,0,96,0,1,253,251,0,0,0,1,
+254,5,0,0,0,1,253,251,0,0,0,1,254,5,0,0,0,1,253,251,0,0,0,1,254,5,0,0,0,1,
+253,251,0,0,0,1,254,5,0,0,0,1,253,227,0,0,0,1,254,11,0,0,0,122,0,246,0,252,
+1,2,1,8,1,14,1,20,1,26,1,32,1,38,1,44,1,50,1,56,1,62,1,68,1,74,1,80,1,86,
+1,92,1,98,1,104,1,110,1,116,1,122,1,128,1,134,1,140,1,146,1,152,1,158,1,164,
+1,170,1,176,1,182,1,188,1,194,1,200,1,206,1,212,1,218,1,224,1,230,1,236,1,
+242,1,248,1,254,2,4,2,10,2,16,2,22,2,28,2,34,2,40,2,46,2,52,2,58,2,64,2,70,
+2,76,2,82,2,88,2,94,2,100,2,106,2,112,2,118,2,124,2,130,2,136,2,142,2,148,
+2,154,2,160,2,166,2,172,2,178,2,184,2,190,2,196,2,202,2,208,2,214,2,220,2,
+226,2,232,2,238,2,244,2,250,3,0,3,6,3,12,3,18,3,24,3,30,3,36,3,42,3,48,3,
+54,3,60,3,66,3,72,3,78,3,84,3,90,3,96,3,102,3,108,3,114,3,120,3,126,3,132,
+3,138,3,144,3,150,3,156,3,162,3,168,3,174,3,180,3,186,3,192,3,198,3,204,0,
+1,2,165,0,0,0,1,2,146,0,0,0,1,2,138,0,0,0,1,2,146,0,0,0,1,2,165,0,0,0,1,2,
+133,0,0,0,1,2,154,0,0,0,1,2,141,0,0,0,1,2,221,0,0,0,1,2,146,0,0,0,1,2,171,
+0,0,0,1,2,146,0,0,0,1,2,137,0,0,0,1,2,137,0,0,0,1,3,52,0,0,0,1,2,138,0,0,
+0,1,2,173,0,0,0,1,2,142,0,0,0,1,2,176,0,0,0,1,2,165,0,0,0,1,2,138,0,0,0,1,
+2,123,0,180,0,1,3,15,0,200,0,1,2,75,0,0,0,1,2,165,0,0,0,1,2,165,0,0,0,1,2,
+165,0,0,0,1,2,165,0,0,0,1,3,148,0,0,0,1,2,165,0,0,0,1,3,67,0,0,0,1,3,67,0,
+0,0,1,2,197,0,0,0,1,3,97,0,0,0,1,3,91,0,0,0,1,3,52,0,0,0,1,2,146,0,0,0,1,
+2,152,0,0,0,1,2,119,0,131,0,1,2,165,0,0,0,1,2,104,0,0,0,1,2,113,0,0,0,1,3,
+2,0,0,0,1,2,147,0,0,0,1,2,146,0,0,0,1,2,146,0,0,0,1,3,62,0,0,0,1,3,46,0,0,
+0,1,2,165,0,0,0,1,2,157,0,0,0,1,2,146,0,0,0,1,2,137,0,0,0,1,2,137,0,0,0,1,
+2,165,0,0,0,1,2,165,0,0,0,1,2,202,0,0,0,1,2,137,0,0,0,1,2,137,0,0,0,1,2,137,
+0,0,0,1,2,211,0,0,0,1,2,211,0,0,0,1,2,137,0,0,0,1,3,77,0,0,0,1,2,156,0,0,
+0,1,2,138,0,0,0,1,2,165,0,0,0,1,3,93,0,0,0,1,3,52,0,0,0,1,2,176,0,0,0,1,2,
+176,0,0,0,1,2,176,0,0,0,1,2,165,0,0,0,1,2,165,0,0,0,1,2,165,0,0,0,1,2,165,
+0,0,0,1,3,126,0,0,0,1,3,112,0,0,0,1,3,77,0,0,0,1,3,77,0,0,0,1,3,77,0,0,0,
+1,3,77,0,0,0,1,3,42,0,0,0,1,3,42,0,0,0,1,3,42,0,0,0,1,3,42,0,0,0,1,2,165,
+0,0,0,1,2,164,0,0,0,1,2,165,0,0,0,1,2,165,0,0,0,1,3,67,0,0,0,1,3,46,0,0,0,
+1,2,146,0,0,0,1,2,137,0,0,0,1,2,137,0,0,0,1,2,137,0,0,0,1,2,176,0,0,0,1,2,
+176,0,0,0,1,2,165,0,0,0,1,2,165,0,0,0,1,3,112,0,0,0,1,3,77,0,0,0,1,3,77,0,
+0,0,1,3,42,0,0,0,1,3,42,0,0,0,1,3,56,0,0,0,1,2,113,0,0,0,1,2,113,0,0,0,1,
+2,113,0,0,0,1,2,113,0,0,0,1,2,113,0,0,0,1,2,113,0,0,0,1,2,113,0,0,0,1,2,113,
+0,0,0,1,3,15,0,0,0,1,3,15,0,0,0,1,3,15,0,0,0,1,3,15,0,0,0,1,3,15,0,0,0,1,
+3,15,0,0,0,1,3,15,0,0,0,1,3,15,0,0,0,1,2,123,0,0,0,4,0,0,0,1,0,8,0,1,0,12,
+0,34,0,1,0,92,1,88,0,2,0,3,1,32,1,32,0,0,1,34,1,35,0,1,2,124,2,145,0,3,0,
+1,0,27,0,164,0,169,0,177,0,187,0,188,0,217,0,224,0,227,0,228,0,238,1,212,
+2,73,2,74,2,75,2,76,2,77,2,78,2,80,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,
+2,99,0,25,0,0,0,102,0,0,0,108,0,0,0,114,0,0,0,120,0,0,0,126,0,0,0,132,0,0,
+0,138,0,0,0,144,0,0,0,150,0,0,0,156,0,0,0,162,0,0,0,168,0,0,0,174,0,0,0,180,
+0,0,0,186,0,0,0,192,0,0,0,198,0,0,0,204,0,0,0,210,0,0,0,216,0,0,0,222,0,0,
+0,228,0,0,0,234,0,0,0,240,0,0,0,246,0,1,255,206,255,156,0,1,0,0,255,156,0,
+1,0,0,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,
+0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,
+156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,226,
+255,156,0,1,255,226,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,
+236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,246,255,156,0,
+1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,0,20,255,156,
+0,27,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,122,0,128,
+0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,188,0,194,0,200,0,
+206,0,212,0,1,4,42,255,156,0,1,3,165,255,156,0,1,4,15,255,156,0,1,4,11,255,
+156,0,1,3,44,255,156,0,1,4,55,255,156,0,1,4,70,255,156,0,1,3,158,255,156,
+0,1,3,158,255,156,0,1,4,128,255,156,0,1,3,206,255,156,0,1,3,171,255,156,0,
+1,3,170,255,156,0,1,3,80,255,156,0,1,3,80,255,156,0,1,3,131,255,156,0,1,3,
+166,255,156,0,1,3,180,255,156,0,1,4,74,255,156,0,1,4,14,255,156,0,1,4,2,255,
+156,0,1,4,2,255,156,0,1,4,2,255,156,0,1,4,162,255,156,0,1,5,3,255,156,0,1,
+4,74,255,156,0,1,4,19,255,156,0,6,0,0,0,1,0,8,0,1,0,12,0,22,0,1,0,50,0,92,
+0,2,0,1,2,92,2,95,0,0,0,2,0,4,0,129,0,152,0,0,0,154,0,161,0,24,1,165,1,196,
+0,32,2,97,2,97,0,64,0,4,0,0,0,18,0,0,0,24,0,0,0,30,0,0,0,36,0,1,255,131,254,
+212,0,1,255,131,254,212,0,1,255,131,254,212,0,1,255,131,254,212,0,65,0,132,
+0,138,0,144,0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,204,0,
+210,0,216,0,222,0,228,0,234,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,26,1,32,
+1,38,1,44,1,50,1,56,1,62,1,68,1,74,1,80,1,86,1,92,1,98,1,104,1,110,1,116,
+1,122,1,128,1,134,1,140,1,146,1,152,1,158,1,164,1,170,1,176,1,182,1,188,1,
+194,1,200,1,206,1,212,1,218,1,224,1,230,1,236,1,242,1,248,1,254,2,4,0,1,0,
+18,254,212,0,1,0,47,254,212,0,1,0,47,254,212,0,1,0,47,254,212,0,1,255,103,
+254,212,0,1,255,118,254,212,0,1,255,233,254,212,0,1,0,18,254,212,0,1,255,
+77,254,212,0,1,255,110,254,212,0,1,255,233,254,212,0,1,255,130,254,212,0,
+1,255,83,254,212,0,1,0,47,254,212,0,1,255,43,254,212,0,1,255,93,254,242,0,
+1,255,164,254,212,0,1,0,47,254,212,0,1,255,131,254,212,0,1,0,47,254,212,0,
+1,0,47,254,212,0,1,255,131,254,212,0,1,255,73,254,212,0,1,255,131,254,212,
+0,1,0,18,254,212,0,1,0,18,254,212,0,1,0,47,254,212,0,1,0,47,254,212,0,1,0,
+47,254,212,0,1,255,145,254,212,0,1,0,47,254,212,0,1,0,47,254,212,0,1,255,
+221,254,212,0,1,255,201,254,212,0,1,255,184,254,212,0,1,255,178,254,212,0,
+1,254,219,254,212,0,1,254,202,254,212,0,1,255,38,254,212,0,1,255,219,254,
+212,0,1,254,190,254,212,0,1,254,206,254,212,0,1,255,0,254,212,0,1,254,220,
+254,212,0,1,254,142,254,212,0,1,255,151,254,212,0,1,254,166,254,212,0,1,255,
+236,254,242,0,1,254,238,254,212,0,1,255,55,254,212,0,1,255,53,254,212,0,1,
+255,178,254,212,0,1,255,178,254,212,0,1,255,80,254,212,0,1,254,231,254,212,
+0,1,255,119,254,212,0,1,254,112,254,212,0,1,255,219,254,212,0,1,255,219,254,
+212,0,1,255,211,254,212,0,1,255,192,254,212,0,1,255,172,254,212,0,1,254,229,
+254,212,0,1,255,193,254,212,0,1,255,131,254,212,0,6,0,0,0,1,0,8,0,1,0,12,
+0,76,0,1,0,116,1,252,0,2,0,10,1,32,1,32,0,0,1,34,1,35,0,1,2,19,2,24,0,3,2,
+26,2,31,0,9,2,34,2,35,0,15,2,37,2,38,0,17,2,40,2,40,0,19,2,45,2,52,0,20,2,
+54,2,54,0,28,2,57,2,66,0,29,0,2,0,6,0,129,0,161,0,0,1,165,1,196,0,33,1,232,
+2,49,0,65,2,57,2,69,0,139,2,102,2,145,0,152,2,149,2,158,0,196,0,39,0,0,0,
+158,0,0,0,164,0,0,0,170,0,0,0,176,0,0,0,182,0,0,0,188,0,0,0,194,0,0,0,200,
+0,0,0,206,0,0,0,212,0,0,0,218,0,0,0,224,0,0,0,230,0,0,0,236,0,0,0,242,0,0,
+0,248,0,0,0,254,0,0,1,4,0,0,1,10,0,0,1,16,0,0,1,22,0,0,1,28,0,0,1,34,0,0,
+1,40,0,0,1,46,0,0,1,52,0,0,1,58,0,0,1,64,0,0,1,70,0,0,1,76,0,0,1,82,0,0,1,
+88,0,0,1,94,0,0,1,100,0,0,1,106,0,0,1,112,0,0,1,118,0,0,1,124,0,0,1,130,0,
+1,255,206,255,156,0,1,0,0,255,156,0,1,0,0,255,156,0,1,255,236,255,156,0,1,
+255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,
+0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,
+156,0,1,255,236,255,156,0,1,255,226,255,156,0,1,255,226,255,156,0,1,255,236,
+255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,255,
+236,255,156,0,1,255,246,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,
+1,255,236,255,156,0,1,0,20,255,156,0,1,0,20,255,156,0,1,0,20,255,156,0,1,
+0,20,255,156,0,1,0,0,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,1,
+0,40,255,156,0,1,255,236,255,156,0,1,0,0,255,156,0,1,255,236,255,156,0,1,
+0,0,255,156,0,1,0,0,255,156,0,1,255,236,255,156,0,1,255,236,255,156,0,206,
+1,158,1,164,1,170,1,176,1,182,1,188,1,194,1,200,1,206,1,212,1,218,1,224,1,
+230,1,236,1,242,1,248,1,254,2,4,2,10,2,16,2,22,2,28,2,34,2,40,2,46,2,52,2,
+58,2,64,2,70,2,76,2,82,2,88,2,94,2,100,2,106,2,112,2,118,2,124,2,130,2,136,
+2,142,2,148,2,154,2,160,2,166,2,172,2,178,2,184,2,190,2,196,2,202,2,208,2,
+214,2,220,2,226,2,232,2,238,2,244,2,250,3,0,3,6,3,12,3,18,3,24,3,30,3,36,
+3,42,3,48,3,54,3,60,3,66,3,72,3,78,3,84,3,90,3,96,3,102,3,108,3,114,3,120,
+3,126,3,132,3,138,3,144,3,150,3,156,3,162,3,168,3,174,3,180,3,186,3,192,3,
+198,3,204,3,210,3,216,3,222,3,228,3,234,3,240,3,246,3,252,4,2,4,8,4,14,4,
+20,4,26,4,32,4,38,4,44,4,50,4,56,4,62,4,68,4,74,4,80,4,86,4,92,4,98,4,104,
+4,110,4,116,4,122,4,128,4,134,4,140,4,146,4,152,4,158,4,164,4,170,4,176,4,
+182,4,188,4,194,4,200,4,206,4,212,4,218,4,224,4,230,4,236,4,242,4,248,4,254,
+5,4,5,10,5,16,5,22,5,28,5,34,5,40,5,46,5,52,5,58,5,64,5,70,5,76,5,82,5,88,
+5,94,5,100,5,106,5,112,5,118,5,124,5,130,5,136,5,142,5,148,5,154,5,160,5,
+166,5,172,5,178,5,184,5,190,5,196,5,202,5,208,5,214,5,220,5,226,5,232,5,238,
+5,244,5,250,6,0,6,6,6,12,6,18,6,24,6,30,6,36,6,42,6,48,6,54,6,60,6,66,6,72,
+6,78,6,84,6,90,6,96,6,102,6,108,0,1,0,0,255,156,0,1,0,47,255,156,0,1,0,47,
+255,156,0,1,0,47,255,156,0,1,255,241,255,156,0,1,0,11,255,156,0,1,0,75,255,
+156,0,1,0,0,255,156,0,1,0,20,255,156,0,1,255,186,255,156,0,1,0,107,255,156,
+0,1,0,28,255,156,0,1,0,220,255,156,0,1,0,47,255,156,0,1,255,194,255,156,0,
+1,255,229,255,156,0,1,0,28,255,156,0,1,0,47,255,156,0,1,255,113,255,156,0,
+1,0,47,255,156,0,1,0,47,255,156,0,1,255,113,255,156,0,1,0,106,255,156,0,1,
+255,113,255,156,0,1,255,96,255,156,0,1,0,185,255,156,0,1,0,0,255,156,0,1,
+0,47,255,156,0,1,0,47,255,156,0,1,0,47,255,156,0,1,0,38,255,156,0,1,0,47,
+255,156,0,1,0,47,255,156,0,1,255,203,255,156,0,1,255,201,255,156,0,1,255,
+184,255,156,0,1,255,178,255,156,0,1,255,102,255,156,0,1,255,95,255,156,0,
+1,255,136,255,156,0,1,255,201,255,156,0,1,255,133,255,156,0,1,255,26,255,
+156,0,1,255,130,255,156,0,1,255,118,255,156,0,1,0,42,255,156,0,1,255,151,
+255,156,0,1,255,81,255,156,0,1,0,116,255,156,0,1,255,104,255,156,0,1,255,
+55,255,156,0,1,255,35,255,156,0,1,255,178,255,156,0,1,255,178,255,156,0,1,
+255,62,255,156,0,1,0,8,255,156,0,1,255,101,255,156,0,1,255,5,255,156,0,1,
+0,130,255,156,0,1,255,201,255,156,0,1,255,211,255,156,0,1,255,192,255,156,
+0,1,255,172,255,156,0,1,255,135,255,156,0,1,255,193,255,156,0,1,0,58,255,
+156,0,1,0,107,255,156,0,1,0,107,255,156,0,1,0,107,255,156,0,1,0,178,255,156,
+0,1,0,122,255,156,0,1,0,157,255,156,0,1,0,68,255,156,0,1,0,106,255,156,0,
+1,0,98,255,156,0,1,0,157,255,156,0,1,0,139,255,156,0,1,0,220,255,156,0,1,
+0,107,255,156,0,1,0,8,255,156,0,1,0,32,255,156,0,1,0,139,255,156,0,1,0,107,
+255,156,0,1,255,181,255,156,0,1,0,107,255,156,0,1,1,35,255,156,0,1,255,181,
+255,156,0,1,0,112,255,156,0,1,255,181,255,156,0,1,255,171,255,156,0,1,0,243,
+255,156,0,1,0,58,255,156,0,1,0,107,255,156,0,1,0,107,255,156,0,1,0,107,255,
+156,0,1,0,118,255,156,0,1,0,107,255,156,0,1,0,58,255,156,0,1,0,58,255,156,
+0,1,0,8,255,156,0,1,0,32,255,156,0,1,255,171,255,156,0,1,255,171,255,156,
+0,1,255,171,255,156,0,1,255,161,255,156,0,1,0,243,255,156,0,1,0,58,255,156,
+0,1,0,48,255,156,0,1,3,21,255,156,0,1,3,5,255,156,0,1,2,252,255,156,0,1,3,
+53,255,156,0,1,2,220,255,156,0,1,2,235,255,156,0,1,0,58,255,156,0,1,2,233,
+255,156,0,1,2,209,255,156,0,1,2,194,255,156,0,1,2,243,255,156,0,1,2,161,255,
+156,0,1,2,252,255,156,0,1,0,8,255,156,0,1,0,32,255,156,0,1,2,229,255,156,
+0,1,2,181,255,156,0,1,255,171,255,156,0,1,2,252,255,156,0,1,3,180,255,156,
+0,1,255,171,255,156,0,1,3,28,255,156,0,1,255,171,255,156,0,1,255,161,255,
+156,0,1,0,223,255,156,0,1,0,48,255,156,0,1,3,29,255,156,0,1,3,11,255,156,
+0,1,2,246,255,156,0,1,2,220,255,156,0,1,3,101,255,156,0,1,2,228,255,156,0,
+1,2,224,255,156,0,1,3,92,255,156,0,1,3,102,255,156,0,1,2,62,255,156,0,1,2,
+79,255,156,0,1,2,159,255,156,0,1,2,229,255,156,0,1,3,131,255,156,0,1,2,212,
+255,156,0,1,255,96,255,156,0,1,255,96,255,156,0,1,255,96,255,156,0,1,3,21,
+255,156,0,1,3,5,255,156,0,1,2,252,255,156,0,1,3,53,255,156,0,1,2,220,255,
+156,0,1,2,235,255,156,0,1,2,233,255,156,0,1,2,209,255,156,0,1,2,194,255,156,
+0,1,2,243,255,156,0,1,2,161,255,156,0,1,2,252,255,156,0,1,2,229,255,156,0,
+1,2,181,255,156,0,1,2,252,255,156,0,1,3,180,255,156,0,1,3,28,255,156,0,1,
+3,29,255,156,0,1,3,11,255,156,0,1,2,246,255,156,0,1,2,220,255,156,0,1,3,101,
+255,156,0,1,3,21,255,156,0,1,3,5,255,156,0,1,2,252,255,156,0,1,3,53,255,156,
+0,1,2,220,255,156,0,1,2,235,255,156,0,1,2,233,255,156,0,1,2,209,255,156,0,
+1,2,194,255,156,0,1,2,243,255,156,0,1,2,161,255,156,0,1,2,252,255,156,0,1,
+2,229,255,156,0,1,2,181,255,156,0,1,2,252,255,156,0,1,3,180,255,156,0,1,3,
+28,255,156,0,1,3,29,255,156,0,1,3,11,255,156,0,1,2,246,255,156,0,1,2,220,
+255,156,0,1,3,101,255,156,0,1,2,228,255,156,0,1,2,224,255,156,0,1,3,92,255,
+156,0,1,3,102,255,156,0,1,2,62,255,156,0,1,2,79,255,156,0,1,2,159,255,156,
+0,1,2,229,255,156,0,1,3,131,255,156,0,1,2,212,255,156,0,3,3,0,0,1,0,8,0,1,
+3,158,0,230,0,0,4,38,0,0,4,44,0,0,4,50,0,0,4,56,0,0,4,62,0,0,4,68,0,0,4,74,
+0,0,4,80,0,0,4,86,0,0,4,92,0,0,4,98,0,0,4,104,0,0,4,110,0,0,4,116,0,0,4,122,
+0,0,4,128,0,0,4,134,0,0,4,140,0,0,4,146,0,0,4,152,0,0,4,158,0,0,4,164,0,0,
+4,170,0,0,4,176,0,0,4,182,0,0,4,188,0,0,4,194,0,0,4,200,0,0,4,206,0,0,4,212,
+0,0,4,218,0,0,4,224,0,0,4,230,0,0,4,236,0,0,4,242,0,0,4,248,0,0,4,254,0,0,
+5,4,0,0,5,10,0,0,5,16,0,0,5,22,0,0,5,28,0,0,5,34,0,0,5,40,0,0,5,46,0,0,5,
+52,0,0,5,58,0,0,5,64,0,0,5,70,0,0,5,76,0,0,5,82,0,0,5,88,0,0,5,94,0,0,5,100,
+0,0,5,106,0,0,5,112,0,0,5,118,0,0,5,124,0,0,5,130,0,0,5,136,0,0,5,142,0,0,
+5,148,0,0,5,154,0,0,5,160,0,0,5,166,0,0,5,172,0,0,5,178,0,0,5,184,0,0,5,190,
+0,0,5,196,0,0,5,202,0,0,5,208,0,0,5,214,0,0,5,220,0,0,5,226,0,0,5,232,0,0,
+5,238,0,0,5,244,0,0,5,250,0,0,6,0,0,0,6,6,0,0,6,12,0,0,6,18,0,0,6,24,0,0,
+6,30,0,0,6,36,0,0,6,42,0,0,6,48,0,0,6,54,0,0,6,60,0,0,6,66,0,0,6,72,0,0,6,
+78,0,0,6,84,0,0,6,90,0,0,6,96,0,0,6,102,0,0,6,108,0,0,6,114,0,0,6,120,0,0,
+6,126,0,0,6,132,0,0,6,138,0,0,6,144,0,0,6,150,0,0,6,156,0,0,6,162,0,0,6,168,
+0,0,6,174,0,0,6,180,0,0,6,186,0,0,6,192,0,0,6,198,0,0,6,204,0,0,6,210,0,0,
+6,216,0,0,6,222,0,0,6,228,0,0,6,234,0,0,6,240,0,0,6,246,0,0,6,252,0,0,7,2,
+0,0,7,8,0,0,7,14,0,0,7,20,0,0,7,26,0,0,7,32,0,0,7,38,0,0,7,44,0,0,7,50,0,
+0,7,56,0,0,7,62,0,0,7,68,0,0,7,74,0,0,7,80,0,0,7,86,0,0,7,92,0,0,7,98,0,0,
+7,104,0,0,7,110,0,0,7,116,0,0,7,122,0,0,7,128,0,0,7,134,0,0,7,140,0,0,7,146,
+0,0,7,152,0,0,7,158,0,0,7,164,0,0,7,170,0,0,7,176,0,0,7,182,0,0,7,188,7,194,
+0,0,7,200,0,0,7,206,0,0,0,0,7,212,0,0,7,218,0,0,7,224,0,0,7,230,0,0,7,236,
+0,0,7,242,0,0,7,248,0,0,7,254,0,0,8,4,0,0,8,10,0,0,8,16,0,0,8,22,0,0,8,28,
+0,0,8,34,0,0,8,40,0,0,8,46,8,52,8,58,8,64,8,70,8,76,8,82,8,88,8,94,8,100,
+8,106,8,112,8,118,8,124,8,130,8,136,8,142,8,148,8,154,8,160,8,166,8,172,8,
+178,8,184,8,190,8,196,8,202,8,208,8,214,8,220,8,226,8,232,8,238,8,244,8,250,
+9,0,9,6,9,12,9,18,9,24,9,30,9,36,9,42,9,48,9,54,0,0,9,60,0,0,9,66,0,0,9,72,
+0,0,9,78,0,0,9,84,0,0,9,90,0,0,9,96,0,0,9,102,0,0,9,108,0,0,9,114,0,0,9,120,
+0,0,9,126,0,0,9,132,0,0,9,138,0,0,9,144,0,0,9,150,0,0,9,156,0,0,9,162,0,0,
+9,168,0,0,9,174,0,0,9,180,0,0,9,186,9,192,0,0,9,198,0,0,9,204,0,0,9,210,9,
+216,9,222,9,228,9,234,9,240,9,246,9,252,10,2,10,8,10,14,10,20,10,26,10,32,
+10,38,10,44,10,50,10,56,10,62,10,68,0,2,0,22,0,129,0,161,0,0,0,164,0,164,
+0,33,0,168,0,168,0,34,0,170,0,171,0,35,0,183,0,183,0,37,0,187,0,187,0,38,
+0,192,0,192,0,39,0,201,0,201,0,40,0,213,0,213,0,41,0,215,0,215,0,42,0,217,
+0,217,0,43,0,230,0,230,0,44,0,237,0,238,0,45,1,165,1,196,0,47,1,212,1,212,
+0,79,1,232,2,49,0,80,2,53,2,53,0,154,2,55,2,69,0,155,2,79,2,79,0,170,2,90,
+2,90,0,171,2,99,2,99,0,172,2,102,2,158,0,173,0,1,0,0,255,156,0,1,0,47,255,
+156,0,1,0,47,255,156,0,1,0,47,255,156,0,1,255,241,255,156,0,1,0,11,255,156,
+0,1,0,75,255,156,0,1,0,0,255,156,0,1,0,20,255,156,0,1,255,186,255,156,0,1,
+0,107,255,156,0,1,0,28,255,156,0,1,0,220,255,156,0,1,0,47,255,156,0,1,255,
+194,255,156,0,1,255,229,255,156,0,1,0,28,255,156,0,1,0,47,255,156,0,1,255,
+113,255,156,0,1,0,47,255,156,0,1,0,47,255,156,0,1,255,113,255,156,0,1,0,106,
+255,156,0,1,255,113,255,156,0,1,255,96,255,156,0,1,0,185,255,156,0,1,0,0,
+255,156,0,1,0,47,255,156,0,1,0,47,255,156,0,1,0,47,255,156,0,1,0,38,255,156,
+0,1,0,47,255,156,0,1,0,47,255,156,0,1,4,42,255,156,0,1,6,22,255,156,0,1,4,
+223,255,156,0,1,4,203,255,156,0,1,3,249,255,156,0,1,4,11,255,156,0,1,5,219,
+255,156,0,1,4,38,255,156,0,1,4,103,255,156,0,1,4,103,255,156,0,1,4,55,255,
+156,0,1,5,28,255,156,0,1,4,128,255,156,0,1,4,128,255,156,0,1,255,203,255,
+156,0,1,255,201,255,156,0,1,255,184,255,156,0,1,255,178,255,156,0,1,255,102,
+255,156,0,1,255,95,255,156,0,1,255,136,255,156,0,1,255,201,255,156,0,1,255,
+133,255,156,0,1,255,26,255,156,0,1,255,130,255,156,0,1,255,118,255,156,0,
+1,0,42,255,156,0,1,255,151,255,156,0,1,255,81,255,156,0,1,0,116,255,156,0,
+1,255,104,255,156,0,1,255,55,255,156,0,1,255,35,255,156,0,1,255,178,255,156,
+0,1,255,178,255,156,0,1,255,62,255,156,0,1,0,8,255,156,0,1,255,101,255,156,
+0,1,255,5,255,156,0,1,0,130,255,156,0,1,255,201,255,156,0,1,255,211,255,156,
+0,1,255,192,255,156,0,1,255,172,255,156,0,1,255,135,255,156,0,1,255,193,255,
+156,0,1,3,206,255,156,0,1,0,58,255,156,0,1,0,107,255,156,0,1,0,107,255,156,
+0,1,0,107,255,156,0,1,0,178,255,156,0,1,0,122,255,156,0,1,0,157,255,156,0,
+1,0,68,255,156,0,1,0,106,255,156,0,1,0,98,255,156,0,1,0,157,255,156,0,1,0,
+139,255,156,0,1,0,220,255,156,0,1,0,107,255,156,0,1,0,8,255,156,0,1,0,32,
+255,156,0,1,0,139,255,156,0,1,0,107,255,156,0,1,255,181,255,156,0,1,0,107,
+255,156,0,1,1,35,255,156,0,1,255,181,255,156,0,1,0,112,255,156,0,1,255,181,
+255,156,0,1,255,171,255,156,0,1,0,243,255,156,0,1,0,58,255,156,0,1,0,107,
+255,156,0,1,0,107,255,156,0,1,0,107,255,156,0,1,0,118,255,156,0,1,0,107,255,
+156,0,1,0,58,255,156,0,1,0,58,255,156,0,1,0,8,255,156,0,1,0,32,255,156,0,
+1,255,171,255,156,0,1,255,171,255,156,0,1,255,171,255,156,0,1,255,161,255,
+156,0,1,0,243,255,156,0,1,0,58,255,156,0,1,0,48,255,156,0,1,3,21,255,156,
+0,1,3,5,255,156,0,1,2,252,255,156,0,1,3,53,255,156,0,1,2,220,255,156,0,1,
+2,235,255,156,0,1,0,58,255,156,0,1,2,233,255,156,0,1,2,209,255,156,0,1,2,
+194,255,156,0,1,2,243,255,156,0,1,2,161,255,156,0,1,2,252,255,156,0,1,0,8,
+255,156,0,1,0,32,255,156,0,1,2,229,255,156,0,1,2,181,255,156,0,1,255,171,
+255,156,0,1,2,252,255,156,0,1,3,180,255,156,0,1,255,171,255,156,0,1,3,28,
+255,156,0,1,255,171,255,156,0,1,255,161,255,156,0,1,0,223,255,156,0,1,0,48,
+255,156,0,1,3,29,255,156,0,1,3,11,255,156,0,1,2,246,255,156,0,1,2,220,255,
+156,0,1,3,101,255,156,0,1,255,206,255,156,0,1,0,0,255,156,0,1,0,0,255,156,
+0,1,2,228,255,156,0,1,2,224,255,156,0,1,3,92,255,156,0,1,3,102,255,156,0,
+1,2,62,255,156,0,1,2,79,255,156,0,1,2,159,255,156,0,1,2,229,255,156,0,1,3,
+131,255,156,0,1,2,212,255,156,0,1,255,96,255,156,0,1,255,96,255,156,0,1,255,
+96,255,156,0,1,4,109,255,156,0,1,5,3,255,156,0,1,4,19,255,156,0,1,255,236,
+255,156,0,1,3,21,255,156,0,1,255,236,255,156,0,1,3,5,255,156,0,1,255,236,
+255,156,0,1,2,252,255,156,0,1,255,236,255,156,0,1,3,53,255,156,0,1,255,236,
+255,156,0,1,2,220,255,156,0,1,255,236,255,156,0,1,2,235,255,156,0,1,255,236,
+255,156,0,1,2,233,255,156,0,1,255,236,255,156,0,1,2,209,255,156,0,1,255,236,
+255,156,0,1,2,194,255,156,0,1,255,236,255,156,0,1,2,243,255,156,0,1,255,226,
+255,156,0,1,2,161,255,156,0,1,255,226,255,156,0,1,2,252,255,156,0,1,255,236,
+255,156,0,1,2,229,255,156,0,1,255,236,255,156,0,1,2,181,255,156,0,1,255,236,
+255,156,0,1,2,252,255,156,0,1,255,236,255,156,0,1,3,180,255,156,0,1,255,236,
+255,156,0,1,3,28,255,156,0,1,255,246,255,156,0,1,3,29,255,156,0,1,255,236,
+255,156,0,1,3,11,255,156,0,1,255,236,255,156,0,1,2,246,255,156,0,1,255,236,
+255,156,0,1,2,220,255,156,0,1,0,20,255,156,0,1,3,101,255,156,0,1,3,21,255,
+156,0,1,3,5,255,156,0,1,2,252,255,156,0,1,3,53,255,156,0,1,2,220,255,156,
+0,1,2,235,255,156,0,1,2,233,255,156,0,1,2,209,255,156,0,1,2,194,255,156,0,
+1,2,243,255,156,0,1,2,161,255,156,0,1,2,252,255,156,0,1,2,229,255,156,0,1,
+2,181,255,156,0,1,2,252,255,156,0,1,3,180,255,156,0,1,3,28,255,156,0,1,3,
+29,255,156,0,1,3,11,255,156,0,1,2,246,255,156,0,1,2,220,255,156,0,1,3,101,
+255,156,0,1,0,20,255,156,0,1,0,20,255,156,0,1,0,20,255,156,0,1,255,236,255,
+156,0,1,2,228,255,156,0,1,255,236,255,156,0,1,2,224,255,156,0,1,0,40,255,
+156,0,1,3,92,255,156,0,1,255,236,255,156,0,1,3,102,255,156,0,1,0,0,255,156,
+0,1,2,62,255,156,0,1,255,236,255,156,0,1,2,79,255,156,0,1,0,0,255,156,0,1,
+2,159,255,156,0,1,0,0,255,156,0,1,2,229,255,156,0,1,255,236,255,156,0,1,3,
+131,255,156,0,1,255,236,255,156,0,1,2,212,255,156,0,4,0,0,0,1,0,8,0,1,0,12,
+0,34,0,1,0,92,0,214,0,2,0,3,0,56,0,56,0,0,0,252,0,254,0,1,1,6,1,13,0,4,0,
+2,0,9,0,19,0,52,0,0,0,69,0,71,0,34,0,87,0,87,0,37,0,94,0,127,0,38,0,163,0,
+245,0,72,1,203,1,231,0,155,2,73,2,80,0,184,2,84,2,91,0,192,2,98,2,100,0,200,
+0,12,0,0,0,50,0,0,0,56,0,0,0,62,0,0,0,68,0,0,0,74,0,0,0,80,0,0,0,86,0,0,0,
+92,0,0,0,98,0,0,0,104,0,0,0,110,0,0,0,116,0,1,253,106,5,66,0,1,253,106,5,
+66,0,1,253,106,5,66,0,1,253,106,5,66,0,1,253,24,5,66,0,1,253,24,5,66,0,1,
+253,24,5,66,0,1,253,24,5,66,0,1,253,157,5,66,0,1,253,157,5,66,0,1,253,157,
+5,66,0,1,253,157,5,66,0,203,1,152,1,158,1,164,1,170,1,176,1,182,1,188,1,194,
+1,200,1,206,1,212,1,218,1,224,1,230,1,236,1,242,1,248,1,254,2,4,2,10,2,16,
+2,22,2,28,2,34,2,40,2,46,2,52,2,58,2,64,2,70,2,76,2,82,2,88,2,94,2,100,2,
+106,2,112,2,118,2,124,2,130,2,136,2,142,2,148,2,154,2,160,2,166,2,172,2,178,
+2,184,2,190,2,196,2,202,2,208,2,214,2,220,2,226,2,232,2,238,2,244,2,250,3,
+0,3,6,3,12,3,18,3,24,3,30,3,36,3,42,3,48,3,54,3,60,3,66,3,72,3,78,3,84,3,
+90,3,96,3,102,3,108,3,114,3,120,3,126,3,132,3,138,3,144,3,150,3,156,3,162,
+3,168,3,174,3,180,3,186,3,192,3,198,3,204,3,210,3,216,3,222,3,228,3,234,3,
+240,3,246,3,252,4,2,4,8,4,14,4,20,4,26,4,32,4,38,4,44,4,50,4,56,4,62,4,68,
+4,74,4,80,4,86,4,92,4,98,4,104,4,110,4,116,4,122,4,128,4,134,4,140,4,146,
+4,152,4,158,4,164,4,170,4,176,4,182,4,188,4,194,4,200,4,206,4,212,4,218,4,
+224,4,230,4,236,4,242,4,248,4,254,5,4,5,10,5,16,5,22,5,28,5,34,5,40,5,46,
+5,52,5,58,5,64,5,70,5,76,5,82,5,88,5,94,5,100,5,106,5,112,5,118,5,124,5,130,
+5,136,5,142,5,148,5,154,5,160,5,166,5,172,5,178,5,184,5,190,5,196,5,202,5,
+208,5,214,5,220,5,226,5,232,5,238,5,244,5,250,6,0,6,6,6,12,6,18,6,24,6,30,
+6,36,6,42,6,48,6,54,6,60,6,66,6,72,6,78,6,84,0,1,2,165,5,66,0,1,2,162,5,66,
+0,1,2,158,5,66,0,1,2,151,5,66,0,1,2,195,5,66,0,1,2,138,5,66,0,1,2,146,5,66,
+0,1,2,165,5,66,0,1,2,144,5,66,0,1,2,154,5,66,0,1,2,141,5,66,0,1,2,221,5,66,
+0,1,2,146,5,66,0,1,2,146,5,66,0,1,2,148,5,66,0,1,2,146,5,66,0,1,2,130,5,66,
+0,1,2,137,5,66,0,1,2,83,5,66,0,1,2,137,5,66,0,1,2,151,5,66,0,1,2,233,5,66,
+0,1,2,138,5,66,0,1,2,179,5,66,0,1,2,151,5,66,0,1,2,223,5,66,0,1,2,157,5,66,
+0,1,2,206,5,66,0,1,2,165,5,66,0,1,2,138,5,66,0,1,2,162,5,66,0,1,2,164,5,66,
+0,1,2,146,5,66,0,1,2,123,5,66,0,1,2,146,5,66,0,1,2,146,5,66,0,1,2,223,5,66,
+0,1,2,75,5,66,0,1,2,165,5,66,0,1,2,162,5,66,0,1,2,158,5,66,0,1,2,151,5,66,
+0,1,2,195,5,66,0,1,2,138,5,66,0,1,2,146,5,66,0,1,2,165,5,66,0,1,2,144,5,66,
+0,1,2,154,5,66,0,1,2,141,5,66,0,1,2,221,5,66,0,1,2,148,5,66,0,1,2,146,5,66,
+0,1,2,130,5,66,0,1,2,137,5,66,0,1,2,83,5,66,0,1,2,137,5,66,0,1,2,151,5,66,
+0,1,2,233,5,66,0,1,2,138,5,66,0,1,2,179,5,66,0,1,2,151,5,66,0,1,2,223,5,66,
+0,1,2,157,5,66,0,1,2,188,5,66,0,1,2,165,5,66,0,1,2,138,5,66,0,1,2,162,5,66,
+0,1,2,164,5,66,0,1,2,146,5,66,0,1,2,123,5,66,0,1,2,223,5,66,0,1,2,75,5,66,
+0,1,2,165,5,66,0,1,2,165,5,66,0,1,2,165,5,66,0,1,2,165,5,66,0,1,2,235,5,66,
+0,1,2,235,5,66,0,1,2,165,5,66,0,1,2,159,5,66,0,1,2,159,5,66,0,1,2,159,5,66,
+0,1,2,207,5,66,0,1,3,0,5,66,0,1,2,253,5,66,0,1,2,233,5,66,0,1,2,195,5,66,
+0,1,2,152,5,66,0,1,2,146,5,66,0,1,2,165,5,66,0,1,2,104,5,66,0,1,2,98,5,66,
+0,1,2,71,5,66,0,1,2,235,5,66,0,1,2,216,5,66,0,1,2,147,5,66,0,1,2,135,5,66,
+0,1,2,135,5,66,0,1,2,156,5,66,0,1,2,148,5,66,0,1,2,148,5,66,0,1,2,148,5,66,
+0,1,2,148,5,66,0,1,2,165,5,66,0,1,2,186,5,66,0,1,2,146,5,66,0,1,2,137,5,66,
+0,1,2,151,5,66,0,1,2,151,5,66,0,1,2,146,5,66,0,1,2,135,5,66,0,1,2,165,5,66,
+0,1,2,165,5,66,0,1,2,232,5,66,0,1,2,93,5,66,0,1,2,137,5,66,0,1,2,137,5,66,
+0,1,2,137,5,66,0,1,2,173,5,66,0,1,2,173,5,66,0,1,2,137,5,66,0,1,2,151,5,66,
+0,1,2,151,5,66,0,1,2,164,5,66,0,1,2,151,5,66,0,1,2,156,5,66,0,1,2,138,5,66,
+0,1,2,165,5,66,0,1,2,172,5,66,0,1,2,254,5,66,0,1,2,151,5,66,0,1,2,151,5,66,
+0,1,2,209,5,66,0,1,2,209,5,66,0,1,2,206,5,66,0,1,2,167,5,66,0,1,2,165,5,66,
+0,1,2,165,5,66,0,1,2,165,5,66,0,1,2,188,5,66,0,1,2,162,5,66,0,1,2,181,5,66,
+0,1,2,164,5,66,0,1,2,164,5,66,0,1,2,164,5,66,0,1,2,164,5,66,0,1,2,164,5,66,
+0,1,2,164,5,66,0,1,2,146,5,66,0,1,2,146,5,66,0,1,2,146,5,66,0,1,2,146,5,66,
+0,1,2,146,5,66,0,1,2,146,5,66,0,1,2,146,5,66,0,1,2,165,5,66,0,1,2,165,5,66,
+0,1,2,165,5,66,0,1,2,169,5,66,0,1,2,165,5,66,0,1,2,159,5,66,0,1,2,148,5,66,
+0,1,2,156,5,66,0,1,2,148,5,66,0,1,2,135,5,66,0,1,2,137,5,66,0,1,2,137,5,66,
+0,1,2,137,5,66,0,1,2,151,5,66,0,1,2,151,5,66,0,1,2,209,5,66,0,1,2,209,5,66,
+0,1,2,165,5,66,0,1,2,165,5,66,0,1,2,177,5,66,0,1,2,181,5,66,0,1,2,164,5,66,
+0,1,2,164,5,66,0,1,2,164,5,66,0,1,2,146,5,66,0,1,2,146,5,66,0,1,2,146,5,66,
+0,1,2,153,5,66,0,1,2,153,5,66,0,1,2,123,5,66,0,1,2,123,5,66,0,1,2,123,5,66,
+0,1,2,123,5,66,0,1,2,123,5,66,0,1,2,123,5,66,0,1,2,123,5,66,0,1,2,123,5,66,
+0,1,2,223,5,66,0,1,2,223,5,66,0,1,2,223,5,66,0,1,2,223,5,66,0,1,2,223,5,66,
+0,1,2,223,5,66,0,1,2,223,5,66,0,1,2,223,5,66,0,1,2,156,5,66,0,1,2,165,5,66,
+0,1,2,123,5,66,0,4,0,0,0,1,0,8,0,1,0,12,0,30,0,1,0,160,0,232,0,1,0,7,0,4,
+0,67,0,128,0,246,0,255,1,0,1,1,0,1,0,63,0,40,0,71,0,113,0,126,0,164,0,168,
+0,169,0,170,0,171,0,174,0,175,0,176,0,177,0,183,0,184,0,185,0,187,0,188,0,
+189,0,190,0,192,0,201,0,213,0,215,0,217,0,220,0,221,0,224,0,227,0,228,0,230,
+0,233,0,234,0,235,0,237,0,238,0,239,0,240,0,242,0,245,1,57,1,72,1,93,1,106,
+1,208,1,209,1,212,1,224,1,225,1,227,1,229,1,231,2,81,2,82,2,83,2,84,2,85,
+2,86,2,87,2,88,2,89,2,90,2,91,0,7,0,0,0,30,0,0,0,36,0,0,0,42,0,0,0,48,0,0,
+0,54,0,0,0,60,0,0,0,66,0,1,254,250,5,66,0,1,254,250,5,66,0,1,254,250,5,66,
+0,1,254,250,5,66,0,1,254,250,5,66,0,1,254,250,5,66,0,1,254,250,5,66,0,63,
+0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,188,0,194,0,
+200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,254,1,4,1,10,1,16,1,
+22,1,28,1,34,1,40,1,46,1,52,1,58,1,64,1,70,1,76,1,82,1,88,1,94,1,100,1,106,
+1,112,1,118,1,124,1,130,1,136,1,142,1,148,1,154,1,160,1,166,1,172,1,178,1,
+184,1,190,1,196,1,202,1,208,1,214,1,220,1,226,1,232,1,238,1,244,0,1,4,41,
+5,66,0,1,4,113,5,66,0,1,4,41,5,66,0,1,4,113,5,66,0,1,4,68,5,66,0,1,4,137,
+5,66,0,1,4,68,5,66,0,1,4,55,5,66,0,1,4,55,5,66,0,1,4,86,5,66,0,1,4,80,5,66,
+0,1,4,41,5,66,0,1,4,168,5,66,0,1,3,137,5,66,0,1,4,217,5,66,0,1,4,47,5,66,
+0,1,4,8,5,66,0,1,4,8,5,66,0,1,4,51,5,66,0,1,4,35,5,66,0,1,4,35,5,66,0,1,4,
+8,5,66,0,1,4,41,5,66,0,1,4,41,5,66,0,1,4,14,5,66,0,1,4,82,5,66,0,1,4,41,5,
+66,0,1,4,156,5,66,0,1,4,68,5,66,0,1,4,68,5,66,0,1,4,115,5,66,0,1,4,66,5,66,
+0,1,4,66,5,66,0,1,4,66,5,66,0,1,4,66,5,66,0,1,4,66,5,66,0,1,4,31,5,66,0,1,
+4,31,5,66,0,1,4,31,5,66,0,1,4,31,5,66,0,1,4,41,5,66,0,1,4,113,5,66,0,1,4,
+41,5,66,0,1,4,113,5,66,0,1,4,55,5,66,0,1,4,35,5,66,0,1,4,8,5,66,0,1,4,66,
+5,66,0,1,4,66,5,66,0,1,4,31,5,66,0,1,4,31,5,66,0,1,4,45,5,66,0,1,4,113,5,
+66,0,1,4,113,5,66,0,1,4,113,5,66,0,1,4,113,5,66,0,1,4,113,5,66,0,1,4,113,
+5,66,0,1,4,113,5,66,0,1,4,113,5,66,0,1,4,113,5,66,0,1,4,113,5,66,0,1,4,113,
+5,66,0,8,3,0,0,1,0,8,0,2,0,16,0,92,0,100,0,176,0,2,0,0,0,210,0,2,0,12,0,130,
+0,135,0,0,0,137,0,142,0,6,0,145,0,146,0,12,0,148,0,149,0,14,0,151,0,151,0,
+16,0,156,0,160,0,17,1,166,1,171,0,22,1,173,1,178,0,28,1,181,1,182,0,34,1,
+184,1,185,0,36,1,187,1,187,0,38,1,192,1,196,0,39,0,1,0,1,0,1,0,1,0,2,0,12,
+0,130,0,135,0,1,0,137,0,142,0,1,0,145,0,146,0,1,0,148,0,149,0,1,0,151,0,151,
+0,1,0,156,0,160,0,1,1,166,1,171,0,1,1,173,1,178,0,1,1,181,1,182,0,1,1,184,
+1,185,0,1,1,187,1,187,0,1,1,192,1,196,0,1,0,2,0,5,1,29,1,35,0,1,2,18,2,49,
+0,1,2,53,2,53,0,1,2,55,2,56,0,1,2,92,2,96,0,1,0,1,0,4,0,0,0,1,0,1,0,1,0,1,
+0,0,0,11,0,1,0,0,0,1,0,8,0,2,0,96,0,2,0,44,0,104,0,104,0,104,0,104,0,104,
+0,104,0,104,0,104,0,75,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,
+104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,
+0,75,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,104,0,
+104,0,104,0,2,0,12,0,130,0,135,0,0,0,137,0,142,0,6,0,145,0,146,0,12,0,148,
+0,149,0,14,0,151,0,151,0,16,0,156,0,160,0,17,1,166,1,171,0,22,1,173,1,178,
+0,28,1,181,1,182,0,34,1,184,1,185,0,36,1,187,1,187,0,38,1,192,1,196,0,39,
+0,1,0,0,0,10,0,82,1,22,0,2,111,114,121,50,0,14,111,114,121,97,0,18,0,8,0,
+0,0,30,0,0,0,0,255,255,0,10,0,6,0,12,0,1,0,9,0,4,0,7,0,0,0,3,0,11,0,5,0,0,
+255,255,0,9,0,6,0,12,0,2,0,10,0,8,0,0,0,3,0,11,0,5,0,13,97,98,118,115,0,80,
+98,108,119,102,0,88,98,108,119,102,0,94,98,108,119,115,0,100,99,106,99,116,
+0,120,104,97,108,110,0,126,110,117,107,116,0,132,112,114,101,115,0,138,112,
+114,101,115,0,150,112,115,116,102,0,170,112,115,116,102,0,176,112,115,116,
+115,0,182,114,112,104,102,0,190,0,0,0,2,0,30,0,34,0,0,0,1,0,3,0,0,0,1,0,2,
+0,0,0,8,0,35,0,37,0,38,0,45,0,46,0,50,0,53,0,55,0,0,0,1,0,6,0,0,0,1,0,64,
+0,0,0,1,0,0,0,0,0,4,0,20,0,21,0,23,0,27,0,0,0,8,0,7,0,8,0,9,0,10,0,20,0,21,
+0,23,0,27,0,0,0,1,0,4,0,0,0,1,0,5,0,0,0,2,0,58,0,59,0,0,0,1,0,1,0,65,0,132,
+2,88,2,120,4,46,5,90,5,130,5,176,5,210,6,212,7,76,7,116,7,156,7,176,7,196,
+7,216,7,236,8,0,8,20,8,40,8,60,8,110,10,178,11,84,11,148,13,66,14,244,16,
+206,17,0,17,164,17,210,17,230,18,176,18,196,18,216,18,236,19,178,20,120,21,
+182,21,222,24,90,24,210,25,74,25,194,26,58,26,100,28,110,29,180,30,136,30,
+156,30,176,30,214,32,146,32,244,33,86,34,62,34,118,35,204,35,228,35,252,36,
+80,36,188,36,218,36,238,37,2,37,22,0,4,3,0,0,1,0,8,0,1,1,182,0,36,0,78,0,
+88,0,98,0,108,0,118,0,128,0,138,0,148,0,158,0,168,0,178,0,188,0,198,0,208,
+0,218,0,228,0,238,0,248,1,2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,1,92,
+1,102,1,112,1,122,1,132,1,142,1,152,1,162,1,172,0,1,0,4,0,94,0,2,0,53,0,1,
+0,4,0,95,0,2,0,53,0,1,0,4,0,96,0,2,0,53,0,1,0,4,0,97,0,2,0,53,0,1,0,4,0,98,
+0,2,0,53,0,1,0,4,0,99,0,2,0,53,0,1,0,4,0,100,0,2,0,53,0,1,0,4,0,101,0,2,0,
+53,0,1,0,4,0,102,0,2,0,53,0,1,0,4,0,103,0,2,0,53,0,1,0,4,0,104,0,2,0,53,0,
+1,0,4,0,105,0,2,0,53,0,1,0,4,0,69,0,2,0,53,0,1,0,4,0,70,0,2,0,53,0,1,0,4,
+0,106,0,2,0,53,0,1,0,4,0,107,0,2,0,53,0,1,0,4,0,108,0,2,0,53,0,1,0,4,0,109,
+0,2,0,53,0,1,0,4,0,110,0,2,0,53,0,1,0,4,0,111,0,2,0,53,0,1,0,4,0,112,0,2,
+0,53,0,1,0,4,0,113,0,2,0,53,0,1,0,4,0,114,0,2,0,53,0,1,0,4,0,115,0,2,0,53,
+0,1,0,4,0,116,0,2,0,53,0,1,0,4,0,117,0,2,0,53,0,1,0,4,0,118,0,2,0,53,0,1,
+0,4,0,119,0,2,0,53,0,1,0,4,0,120,0,2,0,53,0,1,0,4,0,121,0,2,0,53,0,1,0,4,
+0,122,0,2,0,53,0,1,0,4,0,123,0,2,0,53,0,1,0,4,0,124,0,2,0,53,0,1,0,4,0,125,
+0,2,0,53,0,1,0,4,0,126,0,2,0,53,0,1,0,4,0,127,0,2,0,53,0,2,0,3,0,19,0,52,
+0,0,0,71,0,71,0,34,0,87,0,87,0,35,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,
+4,0,128,0,2,0,66,0,1,0,1,0,45,0,4,0,0,0,1,0,8,0,1,1,146,0,33,0,72,0,82,0,
+92,0,102,0,112,0,122,0,132,0,142,0,152,0,162,0,172,0,182,0,192,0,202,0,212,
+0,222,0,232,0,242,0,252,1,6,1,16,1,26,1,36,1,46,1,56,1,66,1,76,1,86,1,96,
+1,106,1,116,1,126,1,136,0,1,0,4,0,129,0,2,0,66,0,1,0,4,0,130,0,2,0,66,0,1,
+0,4,0,131,0,2,0,66,0,1,0,4,0,132,0,2,0,66,0,1,0,4,0,133,0,2,0,66,0,1,0,4,
+0,134,0,2,0,66,0,1,0,4,0,135,0,2,0,66,0,1,0,4,0,136,0,2,0,66,0,1,0,4,0,137,
+0,2,0,66,0,1,0,4,0,138,0,2,0,66,0,1,0,4,0,139,0,2,0,66,0,1,0,4,0,140,0,2,
+0,66,0,1,0,4,0,141,0,2,0,66,0,1,0,4,0,142,0,2,0,66,0,1,0,4,0,143,0,2,0,66,
+0,1,0,4,0,144,0,2,0,66,0,1,0,4,0,145,0,2,0,66,0,1,0,4,0,146,0,2,0,66,0,1,
+0,4,0,147,0,2,0,66,0,1,0,4,0,148,0,2,0,66,0,1,0,4,0,149,0,2,0,66,0,1,0,4,
+0,150,0,2,0,66,0,1,0,4,0,151,0,2,0,66,0,1,0,4,0,152,0,2,0,66,0,1,0,4,0,153,
+0,2,0,66,0,1,0,4,0,154,0,2,0,66,0,1,0,4,0,155,0,2,0,66,0,1,0,4,0,150,0,2,
+0,66,0,1,0,4,0,156,0,2,0,66,0,1,0,4,0,157,0,2,0,66,0,1,0,4,0,158,0,2,0,66,
+0,1,0,4,0,159,0,2,0,66,0,1,0,4,0,150,0,2,0,66,0,2,0,4,0,19,0,27,0,0,0,29,
+0,43,0,9,0,45,0,52,0,24,0,87,0,87,0,32,0,4,0,0,0,1,0,8,0,1,1,30,0,1,0,8,0,
+34,0,70,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,
+0,152,0,158,0,164,0,170,0,176,0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,
+224,0,230,0,236,0,242,0,248,0,254,1,4,1,10,1,16,0,160,0,4,0,19,0,66,0,50,
+0,129,0,2,0,19,0,130,0,2,0,20,0,131,0,2,0,21,0,132,0,2,0,22,0,133,0,2,0,23,
+0,134,0,2,0,24,0,135,0,2,0,25,0,136,0,2,0,26,0,137,0,2,0,27,0,138,0,2,0,29,
+0,139,0,2,0,30,0,140,0,2,0,31,0,141,0,2,0,32,0,142,0,2,0,33,0,143,0,2,0,34,
+0,144,0,2,0,35,0,145,0,2,0,36,0,146,0,2,0,37,0,147,0,2,0,38,0,148,0,2,0,39,
+0,149,0,2,0,40,0,150,0,2,0,41,0,151,0,2,0,42,0,152,0,2,0,43,0,153,0,2,0,45,
+0,154,0,2,0,46,0,155,0,2,0,47,0,150,0,2,0,48,0,156,0,2,0,49,0,157,0,2,0,50,
+0,158,0,2,0,51,0,159,0,2,0,52,0,150,0,2,0,87,0,1,0,1,0,66,0,4,0,0,0,1,0,8,
+0,1,0,26,0,1,0,8,0,2,0,6,0,12,0,162,0,2,0,44,0,162,0,2,0,71,0,1,0,1,0,66,
+0,4,0,0,0,1,0,8,0,1,0,30,0,2,0,10,0,20,0,1,0,4,0,162,0,2,0,66,0,1,0,4,0,162,
+0,2,0,66,0,1,0,2,0,44,0,71,0,4,0,0,0,1,0,8,0,1,0,20,0,1,0,8,0,1,0,4,0,181,
+0,3,0,66,0,28,0,1,0,1,0,26,0,4,0,0,0,1,0,8,0,1,0,240,0,3,0,12,0,24,0,230,
+0,1,0,4,0,181,0,3,0,66,0,28,0,25,0,52,0,62,0,68,0,74,0,80,0,86,0,92,0,98,
+0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,
+176,0,182,0,188,0,194,0,200,0,160,0,4,0,19,0,66,0,50,0,129,0,2,0,19,0,130,
+0,2,0,20,0,131,0,2,0,21,0,132,0,2,0,22,0,133,0,2,0,23,0,134,0,2,0,24,0,135,
+0,2,0,25,0,136,0,2,0,26,0,137,0,2,0,27,0,138,0,2,0,29,0,139,0,2,0,30,0,140,
+0,2,0,31,0,141,0,2,0,32,0,142,0,2,0,33,0,144,0,2,0,35,0,145,0,2,0,36,0,146,
+0,2,0,37,0,148,0,2,0,39,0,149,0,2,0,40,0,156,0,2,0,49,0,157,0,2,0,50,0,158,
+0,2,0,51,0,159,0,2,0,52,0,162,0,2,0,71,0,1,0,4,0,160,0,2,0,157,0,1,0,3,0,
+26,0,66,0,129,0,5,0,0,0,1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,0,162,0,6,0,14,0,28,
+0,42,0,56,0,70,0,84,0,2,0,2,0,58,0,0,0,11,0,1,0,19,0,2,0,2,0,59,0,0,0,12,
+0,1,0,19,0,2,0,2,0,60,0,0,0,13,0,1,0,19,0,2,0,2,0,66,0,0,0,14,0,1,0,19,0,
+2,0,2,0,56,0,0,0,17,0,1,0,19,0,2,0,2,0,67,0,0,0,18,0,1,0,19,0,5,0,0,0,1,0,
+8,0,1,0,8,0,1,0,14,0,1,0,1,0,162,0,1,0,4,0,2,0,2,0,4,0,0,0,16,0,1,0,19,0,
+5,0,0,0,1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,0,162,0,1,0,4,0,2,0,2,0,128,0,0,0,
+15,0,1,0,19,0,1,0,0,0,1,0,8,0,1,0,6,255,152,0,1,0,1,0,162,0,1,0,0,0,1,0,8,
+0,1,0,6,255,153,0,1,0,1,0,162,0,1,0,0,0,1,0,8,0,1,0,6,255,154,0,1,0,1,0,162,
+0,1,0,0,0,1,0,8,0,1,0,6,255,160,0,1,0,1,0,162,0,1,0,0,0,1,0,8,0,1,0,6,255,
+222,0,1,0,1,0,162,0,1,0,0,0,1,0,8,0,1,0,6,255,98,0,1,0,1,0,162,0,1,0,0,0,
+1,0,8,0,1,0,6,255,150,0,1,0,1,0,162,0,1,0,0,0,1,0,8,0,1,0,6,255,161,0,1,0,
+1,0,162,0,1,0,0,0,1,0,8,0,2,0,22,0,8,0,162,0,162,0,162,0,162,0,162,0,162,
+0,162,0,162,0,1,0,8,0,4,0,56,0,58,0,59,0,60,0,66,0,67,0,128,0,4,3,0,0,1,0,
+8,0,1,2,24,0,16,0,38,0,48,0,82,0,100,0,134,0,144,0,162,0,230,1,0,1,10,1,28,
+1,46,1,80,1,90,1,100,1,190,0,1,0,4,0,167,0,2,0,157,0,4,0,10,0,16,0,22,0,28,
+0,173,0,2,0,129,0,174,0,2,0,130,0,175,0,2,0,131,0,176,0,2,0,132,0,2,0,6,0,
+12,0,178,0,2,0,134,0,179,0,2,0,135,0,4,0,10,0,16,0,22,0,28,0,182,0,2,0,134,
+0,183,0,2,0,135,0,184,0,2,0,136,0,185,0,2,0,137,0,1,0,4,0,186,0,2,0,138,0,
+2,0,6,0,12,0,191,0,2,0,140,0,193,0,2,0,142,0,8,0,18,0,26,0,32,0,38,0,44,0,
+50,0,56,0,62,2,99,0,3,0,129,0,153,0,194,0,2,0,129,0,195,0,2,0,143,0,196,0,
+2,0,144,0,197,0,2,0,147,0,198,0,2,0,148,0,199,0,2,0,152,0,200,0,2,0,158,0,
+3,0,8,0,14,0,20,0,202,0,2,0,145,0,203,0,2,0,146,0,204,0,2,0,151,0,1,0,4,0,
+205,0,2,0,162,0,2,0,6,0,12,0,209,0,2,0,145,0,210,0,2,0,146,0,2,0,6,0,12,0,
+216,0,2,0,145,0,218,0,2,0,150,0,4,0,10,0,16,0,22,0,28,0,219,0,2,0,148,0,220,
+0,2,0,149,0,221,0,2,0,151,0,222,0,2,0,152,0,1,0,4,0,231,0,2,0,135,0,1,0,4,
+0,236,0,2,0,142,0,11,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,
+84,2,70,0,2,0,58,2,71,0,2,0,59,2,72,0,2,0,60,2,73,0,2,0,129,2,74,0,2,0,136,
+2,75,0,2,0,147,2,76,0,2,0,150,2,77,0,2,0,152,2,78,0,2,0,153,2,79,0,2,0,154,
+2,80,0,2,0,155,0,11,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,84,
+2,81,0,2,0,58,2,82,0,2,0,59,2,83,0,2,0,60,2,84,0,2,0,129,2,85,0,2,0,136,2,
+86,0,2,0,147,2,87,0,2,0,150,2,88,0,2,0,152,2,89,0,2,0,153,2,90,0,2,0,154,
+2,91,0,2,0,155,0,1,0,16,0,19,0,23,0,24,0,28,0,29,0,33,0,34,0,36,0,37,0,38,
+0,41,0,43,0,49,0,50,0,52,0,71,0,5,3,0,0,1,0,8,0,2,0,18,0,26,0,5,0,0,0,90,
+0,0,0,0,0,0,0,1,0,2,0,38,0,51,0,2,0,10,0,38,0,38,0,1,0,51,0,51,0,1,0,58,0,
+61,0,4,0,66,0,66,0,4,0,74,0,75,0,4,0,129,0,142,0,4,0,143,0,143,0,2,0,144,
+0,152,0,4,0,153,0,153,0,3,0,154,0,159,0,4,0,4,0,10,0,24,0,38,0,52,0,4,0,1,
+0,2,0,3,0,2,0,0,0,22,0,4,0,1,0,2,0,3,0,3,0,0,0,22,0,4,0,1,0,2,0,3,0,4,0,0,
+0,22,0,3,0,1,0,2,0,3,0,1,0,22,0,4,3,0,0,1,0,8,0,1,0,46,0,3,0,12,0,24,0,36,
+0,1,0,4,0,207,0,3,0,143,0,153,0,1,0,4,0,242,0,3,0,143,0,153,0,1,0,4,0,161,
+0,2,0,153,0,1,0,3,0,38,0,51,0,143,0,6,3,0,0,1,0,8,0,2,0,20,0,72,0,80,0,246,
+0,4,0,0,1,90,1,148,0,0,0,1,0,24,0,19,0,21,0,23,0,26,0,31,0,33,0,36,0,38,0,
+39,0,41,0,46,0,47,0,49,0,50,0,51,0,167,0,191,0,193,0,196,0,207,0,222,0,231,
+0,236,0,242,0,1,0,1,0,1,0,1,0,2,0,27,0,19,0,19,0,1,0,21,0,21,0,1,0,23,0,23,
+0,1,0,26,0,26,0,1,0,31,0,31,0,1,0,33,0,33,0,1,0,36,0,36,0,1,0,38,0,39,0,1,
+0,41,0,41,0,1,0,46,0,47,0,1,0,49,0,51,0,1,0,129,0,131,0,3,0,134,0,134,0,3,
+0,136,0,136,0,3,0,138,0,149,0,3,0,154,0,155,0,3,0,158,0,158,0,3,0,160,0,160,
+0,3,0,167,0,167,0,1,0,191,0,191,0,2,0,193,0,193,0,2,0,196,0,196,0,2,0,207,
+0,207,0,2,0,222,0,222,0,2,0,231,0,231,0,2,0,236,0,236,0,2,0,242,0,242,0,2,
+0,2,0,16,0,58,0,60,0,1,0,61,0,61,0,2,0,66,0,66,0,1,0,74,0,75,0,2,0,129,0,
+129,0,1,0,130,0,135,0,2,0,136,0,136,0,1,0,137,0,142,0,2,0,143,0,144,0,1,0,
+145,0,146,0,2,0,147,0,147,0,1,0,148,0,149,0,2,0,150,0,150,0,1,0,151,0,151,
+0,2,0,152,0,155,0,1,0,156,0,160,0,2,0,3,0,8,0,26,0,42,0,0,0,2,0,3,0,2,0,1,
+0,1,0,1,0,0,0,25,0,0,0,2,0,3,0,1,0,1,0,1,0,0,0,24,0,0,0,2,0,3,0,1,0,2,0,1,
+0,0,0,25,0,1,0,4,0,0,0,1,0,1,0,2,0,1,0,0,0,26,0,4,3,0,0,1,0,8,0,1,1,134,0,
+16,0,38,0,80,0,106,0,116,0,126,0,144,0,170,0,180,0,198,0,224,0,234,1,4,1,
+38,1,56,1,90,1,124,0,5,0,12,0,18,0,24,0,30,0,36,0,163,0,2,0,129,0,164,0,2,
+0,138,0,165,0,2,0,143,0,166,0,2,0,155,0,169,0,2,0,158,0,3,0,8,0,14,0,20,0,
+170,0,2,0,145,0,171,0,2,0,146,0,172,0,2,0,155,0,1,0,4,0,177,0,2,0,160,0,1,
+0,4,0,180,0,2,0,136,0,2,0,6,0,12,0,187,0,2,0,131,0,188,0,2,0,140,0,3,0,8,
+0,14,0,20,0,189,0,2,0,138,0,190,0,2,0,139,0,192,0,2,0,141,0,1,0,4,0,201,0,
+2,0,131,0,2,0,6,0,12,0,206,0,2,0,143,0,211,0,2,0,147,0,3,0,8,0,14,0,20,0,
+212,0,2,0,143,0,213,0,2,0,148,0,215,0,2,0,158,0,1,0,4,0,217,0,2,0,146,0,3,
+0,8,0,14,0,20,0,223,0,2,0,129,0,224,0,2,0,131,0,225,0,2,0,154,0,4,0,10,0,
+16,0,22,0,28,0,226,0,2,0,129,0,227,0,2,0,148,0,228,0,2,0,149,0,229,0,2,0,
+155,0,2,0,6,0,12,0,230,0,2,0,134,0,232,0,2,0,155,0,4,0,10,0,16,0,22,0,28,
+0,234,0,2,0,138,0,235,0,2,0,139,0,237,0,2,0,148,0,238,0,2,0,149,0,4,0,10,
+0,16,0,22,0,28,0,240,0,2,0,130,0,241,0,2,0,143,0,244,0,2,0,148,0,245,0,2,
+0,149,0,1,0,4,0,168,0,2,0,142,0,1,0,16,0,19,0,21,0,23,0,26,0,31,0,33,0,36,
+0,38,0,39,0,41,0,46,0,47,0,49,0,50,0,51,0,167,0,4,3,0,0,1,0,8,0,1,1,174,0,
+16,0,38,0,80,0,106,0,116,0,126,0,144,0,170,0,180,0,206,0,240,0,250,1,20,1,
+54,1,72,1,114,1,164,0,5,0,12,0,18,0,24,0,30,0,36,1,203,0,2,0,129,0,164,0,
+2,0,138,1,204,0,2,0,143,1,205,0,2,0,155,0,169,0,2,0,158,0,3,0,8,0,14,0,20,
+0,170,0,2,0,145,0,171,0,2,0,146,1,206,0,2,0,155,0,1,0,4,0,177,0,2,0,160,0,
+1,0,4,1,207,0,2,0,136,0,2,0,6,0,12,0,187,0,2,0,131,0,188,0,2,0,140,0,3,0,
+8,0,14,0,20,1,208,0,2,0,138,1,209,0,2,0,139,0,192,0,2,0,141,0,1,0,4,0,201,
+0,2,0,131,0,3,0,8,0,14,0,20,1,213,0,2,0,143,0,208,0,2,0,144,1,215,0,2,0,147,
+0,4,0,10,0,16,0,22,0,28,1,216,0,2,0,143,0,213,0,2,0,148,0,214,0,2,0,155,0,
+215,0,2,0,158,0,1,0,4,0,217,0,2,0,146,0,3,0,8,0,14,0,20,1,218,0,2,0,129,0,
+224,0,2,0,131,1,219,0,2,0,154,0,4,0,10,0,16,0,22,0,28,1,220,0,2,0,129,0,227,
+0,2,0,148,0,228,0,2,0,149,1,221,0,2,0,155,0,2,0,6,0,12,0,230,0,2,0,134,1,
+223,0,2,0,155,0,5,0,12,0,18,0,24,0,30,0,36,0,233,0,2,0,129,1,224,0,2,0,138,
+1,225,0,2,0,139,0,237,0,2,0,148,0,238,0,2,0,149,0,6,0,14,0,20,0,26,0,32,0,
+38,0,44,0,239,0,2,0,129,1,227,0,2,0,130,1,228,0,2,0,143,0,243,0,2,0,144,1,
+230,0,2,0,148,1,231,0,2,0,149,0,1,0,4,0,168,0,2,0,142,0,1,0,16,0,19,0,21,
+0,23,0,26,0,31,0,33,0,36,0,38,0,39,0,41,0,46,0,47,0,49,0,50,0,51,0,167,0,
+1,3,0,0,1,0,8,0,2,0,22,0,8,1,210,1,211,1,212,1,214,1,217,1,222,1,226,1,229,
+0,1,0,8,0,191,0,193,0,196,0,207,0,222,0,231,0,236,0,242,0,6,3,0,0,1,0,8,0,
+2,0,20,0,30,0,38,0,66,0,4,0,0,0,118,0,138,0,0,0,1,0,3,0,52,0,150,0,191,0,
+1,0,1,0,1,0,1,0,2,0,4,0,52,0,52,0,2,0,150,0,150,0,1,0,153,0,153,0,3,0,191,
+0,191,0,1,0,2,0,8,0,58,0,60,0,1,0,66,0,66,0,1,0,130,0,135,0,2,0,137,0,142,
+0,2,0,145,0,146,0,2,0,148,0,149,0,2,0,151,0,151,0,2,0,156,0,160,0,2,0,1,0,
+4,0,0,0,2,0,3,0,1,0,1,0,1,0,0,0,28,0,1,0,4,0,0,0,1,0,1,0,2,0,1,0,0,0,29,0,
+4,3,0,0,1,0,8,0,1,0,30,0,2,0,10,0,20,0,1,0,4,2,97,0,2,0,153,0,1,0,4,2,98,
+0,2,0,153,0,1,0,2,0,150,0,191,0,1,0,0,0,1,0,8,0,1,0,6,2,48,0,1,0,1,0,52,0,
+6,0,0,0,1,0,8,0,2,0,16,0,22,0,128,0,136,0,2,0,0,0,144,0,1,0,1,0,56,0,2,0,
+17,0,20,0,20,0,1,0,35,0,35,0,1,0,37,0,37,0,1,0,40,0,40,0,2,0,42,0,42,0,2,
+0,46,0,46,0,2,0,87,0,87,0,3,0,113,0,113,0,2,0,119,0,119,0,2,0,127,0,127,0,
+3,0,173,0,176,0,2,0,184,0,184,0,2,0,204,0,204,0,2,0,205,0,205,0,3,0,220,0,
+220,0,2,0,223,0,225,0,2,1,218,1,219,0,2,0,1,0,56,0,1,0,1,0,1,0,1,0,1,0,1,
+0,3,0,8,0,22,0,36,0,1,0,1,0,1,0,0,0,1,0,0,0,31,0,1,0,2,0,1,0,0,0,1,0,0,0,
+32,0,1,0,3,0,1,0,0,0,1,0,0,0,33,0,1,0,0,0,1,0,8,0,1,0,6,0,205,0,1,0,1,0,56,
+0,1,0,0,0,1,0,8,0,1,0,6,0,206,0,1,0,1,0,56,0,1,0,0,0,1,0,8,0,1,0,6,0,210,
+0,1,0,1,0,56,0,4,0,0,0,1,0,8,0,1,0,172,0,7,0,20,0,30,0,48,0,60,0,78,0,116,
+0,126,0,1,0,4,0,246,0,2,0,128,0,2,0,6,0,12,0,247,0,2,0,4,0,248,0,2,0,128,
+0,1,0,4,0,249,0,3,1,163,0,4,0,2,0,6,0,12,0,250,0,2,0,4,0,251,0,2,0,128,0,
+4,0,10,0,18,0,24,0,32,1,1,0,3,0,4,0,128,0,255,0,2,0,4,1,1,0,3,0,128,0,4,1,
+0,0,2,0,128,0,1,0,4,1,2,0,2,0,4,0,5,0,12,0,18,0,26,0,32,0,40,0,246,0,2,0,
+4,1,1,0,3,0,67,0,4,1,0,0,2,0,67,1,4,0,3,0,68,0,4,1,3,0,2,0,68,0,1,0,7,0,4,
+0,16,0,17,0,18,0,67,0,68,0,128,0,6,3,0,0,1,0,8,0,2,0,20,0,48,0,58,0,86,0,
+4,0,0,0,120,0,138,0,172,0,2,0,4,0,69,0,70,0,0,0,94,0,127,0,2,0,129,0,149,
+0,36,0,151,0,160,0,57,0,2,0,1,0,94,0,127,0,1,0,2,0,4,0,69,0,70,0,2,0,94,0,
+127,0,3,0,129,0,149,0,1,0,151,0,160,0,1,0,2,0,5,0,58,0,61,0,1,0,74,0,75,0,
+1,0,129,0,149,0,1,0,150,0,150,0,2,0,151,0,160,0,1,0,1,0,4,0,1,0,1,0,1,0,0,
+0,1,0,0,0,44,0,2,0,6,0,20,0,0,0,1,0,1,0,1,0,1,0,0,0,36,0,0,0,1,0,1,0,2,0,
+1,0,0,0,36,0,1,0,4,0,0,0,1,0,1,0,2,0,1,0,0,0,36,0,2,0,0,0,1,0,8,0,1,1,38,
+0,36,0,78,0,84,0,90,0,96,0,102,0,108,0,114,0,120,0,126,0,132,0,138,0,144,
+0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,204,0,210,0,216,0,
+222,0,228,0,234,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,26,1,32,0,2,0,31,0,
+53,0,2,0,32,0,53,0,2,0,19,0,53,0,2,0,20,0,53,0,2,0,21,0,53,0,2,0,22,0,53,
+0,2,0,23,0,53,0,2,0,24,0,53,0,2,0,25,0,53,0,2,0,26,0,53,0,2,0,27,0,53,0,2,
+0,28,0,53,0,2,0,29,0,53,0,2,0,30,0,53,0,2,0,33,0,53,0,2,0,34,0,53,0,2,0,35,
+0,53,0,2,0,36,0,53,0,2,0,37,0,53,0,2,0,38,0,53,0,2,0,39,0,53,0,2,0,40,0,53,
+0,2,0,41,0,53,0,2,0,42,0,53,0,2,0,43,0,53,0,2,0,44,0,53,0,2,0,45,0,53,0,2,
+0,46,0,53,0,2,0,47,0,53,0,2,0,48,0,53,0,2,0,49,0,53,0,2,0,50,0,53,0,2,0,51,
+0,53,0,2,0,52,0,53,0,2,0,71,0,53,0,2,0,87,0,53,0,2,0,2,0,69,0,70,0,0,0,94,
+0,127,0,2,0,4,3,0,0,1,0,8,0,1,0,26,0,1,0,8,0,2,0,6,0,12,1,179,0,2,0,143,1,
+189,0,2,0,153,0,1,0,1,0,53,0,6,3,0,0,1,0,8,0,2,0,20,0,54,1,150,1,196,0,4,
+0,0,1,206,2,32,2,98,0,2,0,5,0,58,0,61,0,0,0,66,0,66,0,4,0,74,0,75,0,5,0,129,
+0,160,0,7,1,5,1,5,0,39,0,2,0,58,0,23,0,24,0,5,0,27,0,32,0,5,0,34,0,34,0,5,
+0,42,0,42,0,5,0,45,0,45,0,5,0,52,0,52,0,1,0,69,0,70,0,2,0,71,0,71,0,1,0,94,
+0,127,0,2,0,129,0,152,0,3,0,153,0,153,0,2,0,154,0,160,0,3,0,163,0,166,0,2,
+0,168,0,168,0,3,0,169,0,170,0,2,0,171,0,171,0,3,0,172,0,172,0,2,0,177,0,177,
+0,2,0,178,0,178,0,5,0,179,0,179,0,1,0,180,0,180,0,2,0,183,0,183,0,2,0,187,
+0,192,0,2,0,193,0,193,0,3,0,194,0,194,0,1,0,195,0,195,0,5,0,196,0,196,0,3,
+0,197,0,200,0,1,0,201,0,201,0,2,0,206,0,207,0,2,0,208,0,208,0,1,0,211,0,213,
+0,2,0,214,0,214,0,1,0,215,0,215,0,2,0,217,0,217,0,3,0,222,0,230,0,2,0,231,
+0,231,0,3,0,232,0,232,0,2,0,233,0,233,0,1,0,234,0,235,0,2,0,236,0,236,0,3,
+0,237,0,238,0,2,0,239,0,239,0,1,0,240,0,242,0,2,0,243,0,243,0,1,0,244,0,245,
+0,2,1,179,1,179,0,3,1,189,1,189,0,3,1,203,1,211,0,1,1,212,1,212,0,2,1,213,
+1,231,0,1,1,232,2,49,0,4,2,57,2,66,0,4,2,67,2,67,0,2,2,73,2,80,0,3,2,84,2,
+91,0,3,2,97,2,98,0,3,2,99,2,99,0,4,0,2,0,7,0,58,0,61,0,1,0,66,0,66,0,2,0,
+74,0,75,0,2,0,129,0,152,0,2,0,153,0,153,0,1,0,154,0,160,0,2,1,5,1,5,0,3,0,
+2,0,1,0,129,0,160,0,1,0,5,0,12,0,26,0,40,0,54,0,68,0,1,0,1,0,1,0,0,0,1,0,
+0,0,39,0,1,0,2,0,1,0,0,0,1,0,0,0,40,0,1,0,3,0,1,0,0,0,1,0,0,0,41,0,1,0,4,
+0,1,0,0,0,1,0,0,0,42,0,1,0,5,0,1,0,0,0,1,0,0,0,43,0,4,0,10,0,24,0,38,0,52,
+0,1,0,1,0,1,0,0,0,1,0,0,0,39,0,1,0,2,0,1,0,0,0,1,0,0,0,40,0,1,0,3,0,1,0,0,
+0,1,0,0,0,41,0,1,0,4,0,1,0,0,0,1,0,0,0,42,0,1,0,4,0,0,0,1,0,1,0,1,0,1,0,0,
+0,43,0,1,0,0,0,1,0,8,0,2,0,84,0,39,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,232,
+1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,
+245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,
+2,2,3,2,4,2,5,2,6,2,7,0,2,0,4,0,58,0,61,0,0,0,66,0,66,0,4,0,74,0,75,0,5,0,
+129,0,160,0,7,0,1,0,0,0,1,0,8,0,2,0,84,0,39,1,25,1,26,1,27,1,32,1,28,1,34,
+1,35,2,8,2,19,2,20,2,21,2,22,2,23,2,24,2,9,2,26,2,27,2,28,2,29,2,30,2,31,
+2,10,2,11,2,34,2,35,2,12,2,37,2,38,2,13,2,40,2,14,2,15,2,16,2,17,2,45,2,46,
+2,47,2,48,2,49,0,2,0,4,0,58,0,61,0,0,0,66,0,66,0,4,0,74,0,75,0,5,0,129,0,
+160,0,7,0,1,0,0,0,1,0,8,0,2,0,84,0,39,1,29,1,30,1,31,1,32,1,33,1,34,1,35,
+2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,
+2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,
+2,48,2,49,0,2,0,4,0,58,0,61,0,0,0,66,0,66,0,4,0,74,0,75,0,5,0,129,0,160,0,
+7,0,1,0,0,0,1,0,8,0,2,0,84,0,39,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,
+19,2,20,2,21,2,22,2,23,2,24,2,58,2,26,2,27,2,28,2,29,2,30,2,31,2,59,2,60,
+2,34,2,35,2,61,2,37,2,38,2,62,2,40,2,63,2,64,2,65,2,66,2,45,2,46,2,47,2,48,
+2,49,0,2,0,4,0,58,0,61,0,0,0,66,0,66,0,4,0,74,0,75,0,5,0,129,0,160,0,7,0,
+1,0,0,0,1,0,8,0,2,0,18,0,6,1,14,1,15,1,16,1,17,2,67,0,56,0,1,0,6,0,58,0,59,
+0,60,0,61,0,153,1,5,0,2,0,0,0,1,0,8,0,1,1,158,0,51,0,108,0,114,0,120,0,126,
+0,132,0,138,0,144,0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,
+204,0,210,0,216,0,222,0,228,0,234,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,26,
+1,32,1,38,1,44,1,50,1,56,1,62,1,68,1,74,1,80,1,86,1,92,1,98,1,104,1,110,1,
+116,1,122,1,128,1,134,1,140,1,146,1,152,0,2,0,66,0,19,0,2,0,66,0,20,0,2,0,
+66,0,21,0,2,0,66,0,22,0,2,0,66,0,23,0,2,0,66,0,24,0,2,0,66,0,25,0,2,0,66,
+0,26,0,2,0,66,0,27,0,2,0,66,0,29,0,2,0,66,0,30,0,2,0,66,0,31,0,2,0,66,0,32,
+0,2,0,66,0,33,0,2,0,66,0,34,0,2,0,66,0,35,0,2,0,66,0,36,0,2,0,66,0,37,0,2,
+0,66,0,38,0,2,0,66,0,39,0,2,0,66,0,40,0,2,0,66,0,42,0,2,0,66,0,43,0,2,0,66,
+0,45,0,2,0,66,0,46,0,2,0,66,0,47,0,2,0,66,0,49,0,2,0,66,0,50,0,2,0,66,0,51,
+0,2,0,66,0,52,0,2,0,66,0,167,0,2,1,36,0,29,0,2,1,108,0,33,0,2,1,36,0,51,0,
+2,1,38,0,36,0,2,1,38,0,37,0,2,1,40,0,167,0,2,1,45,0,25,0,2,1,48,0,21,0,2,
+1,48,0,31,0,2,1,51,0,35,0,2,1,53,0,21,0,2,1,56,0,39,0,2,1,56,0,51,0,2,1,58,
+0,37,0,2,1,63,0,21,0,2,1,64,0,39,0,2,1,64,0,40,0,2,1,66,0,24,0,2,1,67,0,39,
+0,2,1,67,0,40,0,2,0,16,0,129,0,149,0,0,0,151,0,160,0,21,0,164,0,164,0,31,
+0,168,0,171,0,32,0,177,0,177,0,36,0,183,0,183,0,37,0,187,0,188,0,38,0,196,
+0,196,0,40,0,201,0,201,0,41,0,213,0,213,0,42,0,215,0,215,0,43,0,217,0,217,
+0,44,0,224,0,224,0,45,0,227,0,228,0,46,0,230,0,230,0,48,0,237,0,238,0,49,
+0,4,3,0,0,1,0,8,0,1,1,54,0,2,0,10,1,44,0,36,0,74,0,80,0,86,0,92,0,98,0,104,
+0,110,0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,
+182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,254,
+1,4,1,10,1,16,1,22,1,28,1,197,0,2,0,58,1,198,0,2,0,59,1,199,0,2,0,60,1,200,
+0,2,0,61,1,201,0,2,0,74,1,202,0,2,0,75,1,165,0,2,0,129,1,166,0,2,0,130,1,
+167,0,2,0,131,1,168,0,2,0,132,1,169,0,2,0,133,1,170,0,2,0,134,1,171,0,2,0,
+135,1,172,0,2,0,136,1,173,0,2,0,137,1,174,0,2,0,138,1,175,0,2,0,139,1,176,
+0,2,0,140,1,177,0,2,0,141,1,178,0,2,0,142,1,180,0,2,0,144,1,181,0,2,0,145,
+1,182,0,2,0,146,1,183,0,2,0,147,1,184,0,2,0,148,1,185,0,2,0,149,1,186,0,2,
+0,150,1,187,0,2,0,151,1,188,0,2,0,152,1,190,0,2,0,154,1,191,0,2,0,155,1,192,
+0,2,0,156,1,193,0,2,0,157,1,194,0,2,0,158,1,195,0,2,0,159,1,196,0,2,0,160,
+0,1,0,4,2,101,0,2,2,50,0,1,0,2,0,53,2,0,0,6,3,0,0,1,0,8,0,2,0,18,0,34,0,116,
+0,144,0,3,0,0,0,152,0,186,0,1,0,6,0,153,1,29,1,30,1,31,1,33,2,42,0,2,0,13,
+0,19,0,19,0,1,0,26,0,26,0,1,0,36,0,36,0,2,0,38,0,38,0,2,0,41,0,41,0,2,0,46,
+0,47,0,1,0,48,0,48,0,2,0,87,0,87,0,2,0,129,0,152,0,3,0,154,0,160,0,3,0,209,
+0,210,0,2,1,165,1,196,0,3,2,97,2,97,0,3,0,2,0,4,0,153,0,153,0,1,1,29,1,31,
+0,2,1,33,1,33,0,2,2,42,2,42,0,2,0,1,0,1,0,1,0,1,0,2,0,6,0,20,0,1,0,1,0,1,
+0,0,0,1,0,0,0,47,0,1,0,2,0,1,0,0,0,1,0,0,0,48,0,1,0,4,0,1,0,3,0,1,0,0,0,1,
+0,0,0,49,0,1,0,0,0,1,0,8,0,1,0,6,1,171,0,1,0,1,0,153,0,1,0,0,0,1,0,8,0,1,
+0,6,1,172,0,1,0,1,0,153,0,1,0,0,0,1,0,8,0,2,0,16,0,5,2,92,2,93,2,94,2,95,
+2,96,0,1,0,5,1,29,1,30,1,31,1,33,2,42,0,6,3,0,0,1,0,8,0,2,0,16,0,56,1,80,
+1,120,0,2,0,0,1,128,0,2,0,6,2,19,2,24,0,0,2,26,2,31,0,6,2,34,2,35,0,12,2,
+37,2,38,0,14,2,40,2,40,0,16,2,45,2,49,0,17,0,2,0,46,0,20,0,22,0,4,0,33,0,
+33,0,4,0,35,0,35,0,4,0,37,0,37,0,4,0,39,0,39,0,4,0,43,0,44,0,4,0,49,0,51,
+0,4,0,129,0,161,0,3,0,164,0,164,0,1,0,167,0,167,0,4,0,168,0,168,0,1,0,169,
+0,169,0,2,0,170,0,171,0,1,0,177,0,177,0,2,0,183,0,183,0,1,0,184,0,184,0,4,
+0,187,0,187,0,1,0,188,0,188,0,2,0,192,0,192,0,1,0,201,0,201,0,1,0,205,0,205,
+0,4,0,213,0,213,0,1,0,215,0,215,0,1,0,217,0,217,0,1,0,219,0,219,0,4,0,224,
+0,224,0,2,0,227,0,228,0,2,0,230,0,230,0,1,0,237,0,238,0,1,1,165,1,196,0,1,
+1,212,1,212,0,1,2,19,2,24,0,1,2,26,2,31,0,1,2,34,2,35,0,1,2,37,2,38,0,1,2,
+40,2,40,0,1,2,45,2,49,0,1,2,57,2,66,0,1,2,73,2,78,0,2,2,79,2,79,0,1,2,80,
+2,80,0,2,2,84,2,89,0,2,2,90,2,90,0,1,2,91,2,91,0,2,2,99,2,99,0,1,2,102,2,
+145,0,1,0,2,0,6,2,19,2,24,0,1,2,26,2,31,0,1,2,34,2,35,0,1,2,37,2,38,0,1,2,
+40,2,40,0,1,2,45,2,49,0,1,0,1,0,1,0,1,0,1,0,3,0,8,0,22,0,36,0,1,0,1,0,1,0,
+0,0,1,0,0,0,51,0,1,0,2,0,1,0,0,0,1,0,0,0,52,0,2,0,3,0,4,0,1,0,0,0,1,0,0,0,
+51,0,1,0,0,0,1,0,8,0,2,0,50,0,22,2,102,2,103,2,104,2,105,2,106,2,107,2,108,
+2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,
+121,2,122,2,123,0,2,0,6,2,19,2,24,0,0,2,26,2,31,0,6,2,34,2,35,0,12,2,37,2,
+38,0,14,2,40,2,40,0,16,2,45,2,49,0,17,0,1,0,0,0,1,0,8,0,2,0,50,0,22,2,124,
+2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,
+137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,0,2,0,6,2,19,2,24,0,0,
+2,26,2,31,0,6,2,34,2,35,0,12,2,37,2,38,0,14,2,40,2,40,0,16,2,45,2,49,0,17,
+0,6,3,0,0,1,0,8,0,2,0,16,0,32,0,162,0,178,0,2,0,0,0,186,0,2,0,2,2,50,2,52,
+0,0,2,57,2,66,0,3,0,2,0,21,0,20,0,22,0,3,0,33,0,33,0,3,0,35,0,35,0,3,0,37,
+0,37,0,3,0,39,0,39,0,3,0,43,0,44,0,3,0,49,0,51,0,3,0,129,0,161,0,2,0,167,
+0,167,0,3,0,184,0,184,0,3,0,205,0,205,0,3,0,219,0,219,0,3,2,19,2,24,0,1,2,
+26,2,31,0,1,2,34,2,35,0,1,2,37,2,38,0,1,2,40,2,40,0,1,2,45,2,49,0,1,2,57,
+2,66,0,1,2,102,2,145,0,1,2,149,2,158,0,1,0,2,0,2,2,50,2,52,0,1,2,57,2,66,
+0,1,0,1,0,1,0,1,0,1,0,2,0,6,0,20,0,1,0,1,0,1,0,0,0,1,0,0,0,54,0,3,0,0,0,2,
+0,3,0,1,0,0,0,1,0,0,0,54,0,1,0,0,0,1,0,8,0,2,0,32,0,13,2,146,2,147,2,148,
+2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,0,2,0,2,2,50,
+2,52,0,0,2,57,2,66,0,3,0,6,3,0,0,1,0,8,0,2,0,16,0,26,1,2,1,18,0,2,0,0,1,26,
+0,1,0,3,1,32,1,34,1,35,0,2,0,38,0,20,0,22,0,3,0,33,0,33,0,3,0,35,0,35,0,3,
+0,37,0,37,0,3,0,39,0,39,0,3,0,43,0,44,0,3,0,49,0,51,0,3,0,94,0,127,0,4,0,
+129,0,129,0,2,0,130,0,135,0,1,0,136,0,136,0,2,0,137,0,146,0,1,0,147,0,147,
+0,2,0,148,0,149,0,1,0,150,0,150,0,2,0,151,0,151,0,1,0,152,0,153,0,2,0,154,
+0,154,0,1,0,155,0,155,0,2,0,156,0,160,0,1,0,167,0,167,0,3,0,168,0,168,0,1,
+0,170,0,171,0,1,0,183,0,183,0,1,0,184,0,184,0,3,0,192,0,192,0,1,0,201,0,201,
+0,1,0,205,0,205,0,3,0,213,0,213,0,1,0,215,0,215,0,1,0,219,0,219,0,3,0,230,
+0,230,0,1,0,237,0,237,0,1,1,165,1,178,0,1,1,180,1,188,0,1,1,190,1,196,0,1,
+2,80,2,80,0,1,2,102,2,145,0,1,0,2,0,2,1,32,1,32,0,1,1,34,1,35,0,1,0,1,0,1,
+0,1,0,1,0,3,0,8,0,22,0,38,0,1,0,1,0,1,0,0,0,1,0,0,0,56,0,2,0,2,0,3,0,1,0,
+0,0,1,0,0,0,56,0,1,0,4,0,1,0,0,0,1,0,0,0,57,0,1,0,0,0,1,0,8,0,1,0,6,1,21,
+0,1,0,3,1,32,1,34,1,35,0,1,0,0,0,1,0,8,0,1,0,6,255,245,0,1,0,3,1,32,1,34,
+1,35,0,5,2,0,0,1,0,8,0,1,0,12,0,3,0,22,0,40,0,58,0,1,0,3,0,4,0,128,0,246,
+0,1,0,4,0,2,0,2,0,68,0,0,0,60,0,1,0,61,0,1,0,4,0,2,0,2,0,68,0,0,0,60,0,1,
+0,62,0,1,0,4,0,2,0,2,0,68,0,0,0,60,0,1,0,63,0,4,0,0,0,1,0,8,0,1,0,90,0,3,
+0,12,0,38,0,64,0,3,0,8,0,14,0,20,0,252,0,2,0,4,0,253,0,2,0,128,0,254,0,2,
+0,246,0,3,0,8,0,14,0,20,1,7,0,2,0,4,1,8,0,2,0,128,1,9,0,2,0,246,0,3,0,8,0,
+14,0,20,1,11,0,2,0,4,1,12,0,2,0,128,1,13,0,2,0,246,0,1,0,3,0,56,1,6,1,10,
+0,1,0,0,0,1,0,8,0,2,0,12,0,3,1,161,1,161,1,161,0,1,0,3,0,4,0,128,0,246,0,
+1,0,0,0,1,0,8,0,1,0,6,0,190,0,1,0,1,0,68,0,1,0,0,0,1,0,8,0,1,0,6,0,191,0,
+1,0,1,0,68,0,1,0,0,0,1,0,8,0,1,0,6,0,192,0,1,0,1,0,68,0,4,0,0,0,1,0,8,0,1,
+3,114,0,73,0,152,0,162,0,172,0,182,0,192,0,202,0,212,0,222,0,232,0,242,0,
+252,1,6,1,16,1,26,1,36,1,46,1,56,1,66,1,76,1,86,1,96,1,106,1,116,1,126,1,
+136,1,146,1,156,1,166,1,176,1,186,1,196,1,206,1,216,1,226,1,236,1,246,2,0,
+2,10,2,20,2,30,2,40,2,50,2,60,2,70,2,80,2,90,2,100,2,110,2,120,2,130,2,140,
+2,150,2,160,2,170,2,180,2,190,2,200,2,210,2,220,2,230,2,240,2,250,3,4,3,14,
+3,24,3,34,3,44,3,54,3,64,3,74,3,84,3,94,3,104,0,1,0,4,1,36,0,2,0,66,0,1,0,
+4,1,37,0,2,0,66,0,1,0,4,1,38,0,2,0,66,0,1,0,4,1,39,0,2,0,66,0,1,0,4,1,40,
+0,2,0,66,0,1,0,4,1,41,0,2,0,66,0,1,0,4,1,42,0,2,0,66,0,1,0,4,1,43,0,2,0,66,
+0,1,0,4,1,44,0,2,0,66,0,1,0,4,1,45,0,2,0,66,0,1,0,4,1,46,0,2,0,66,0,1,0,4,
+1,47,0,2,0,66,0,1,0,4,1,48,0,2,0,66,0,1,0,4,1,49,0,2,0,66,0,1,0,4,1,50,0,
+2,0,66,0,1,0,4,1,51,0,2,0,66,0,1,0,4,1,52,0,2,0,66,0,1,0,4,1,53,0,2,0,66,
+0,1,0,4,1,54,0,2,0,66,0,1,0,4,1,55,0,2,0,66,0,1,0,4,1,56,0,2,0,66,0,1,0,4,
+1,57,0,2,0,66,0,1,0,4,1,58,0,2,0,66,0,1,0,4,1,59,0,2,0,66,0,1,0,4,1,60,0,
+2,0,66,0,1,0,4,1,61,0,2,0,66,0,1,0,4,1,62,0,2,0,66,0,1,0,4,1,63,0,2,0,66,
+0,1,0,4,1,64,0,2,0,66,0,1,0,4,1,65,0,2,0,66,0,1,0,4,1,66,0,2,0,66,0,1,0,4,
+1,67,0,2,0,66,0,1,0,4,1,68,0,2,0,66,0,1,0,4,1,69,0,2,0,66,0,1,0,4,1,70,0,
+2,1,28,0,1,0,4,1,71,0,2,1,28,0,1,0,4,1,72,0,2,0,66,0,1,0,4,1,73,0,2,0,66,
+0,1,0,4,1,74,0,2,1,28,0,1,0,4,1,75,0,2,1,28,0,1,0,4,1,76,0,2,1,28,0,1,0,4,
+1,77,0,2,1,28,0,1,0,4,1,78,0,2,1,28,0,1,0,4,1,79,0,2,1,28,0,1,0,4,1,80,0,
+2,1,28,0,1,0,4,1,81,0,2,1,28,0,1,0,4,1,82,0,2,1,28,0,1,0,4,1,83,0,2,1,28,
+0,1,0,4,1,84,0,2,1,28,0,1,0,4,1,85,0,2,1,28,0,1,0,4,1,86,0,2,1,28,0,1,0,4,
+1,87,0,2,1,28,0,1,0,4,1,88,0,2,1,28,0,1,0,4,1,89,0,2,1,28,0,1,0,4,1,90,0,
+2,1,28,0,1,0,4,1,91,0,2,1,28,0,1,0,4,1,92,0,2,1,28,0,1,0,4,1,93,0,2,1,28,
+0,1,0,4,1,94,0,2,1,28,0,1,0,4,1,95,0,2,1,28,0,1,0,4,1,96,0,2,1,28,0,1,0,4,
+1,97,0,2,1,28,0,1,0,4,1,98,0,2,1,28,0,1,0,4,1,99,0,2,1,28,0,1,0,4,1,100,0,
+2,1,28,0,1,0,4,1,101,0,2,1,28,0,1,0,4,1,102,0,2,1,28,0,1,0,4,1,103,0,2,1,
+28,0,1,0,4,1,104,0,2,1,28,0,1,0,4,1,105,0,2,1,28,0,1,0,4,1,106,0,2,1,28,0,
+1,0,4,1,107,0,2,1,28,0,1,0,4,1,108,0,2,0,66,0,2,0,5,0,19,0,52,0,0,0,69,0,
+71,0,34,0,87,0,87,0,37,0,94,0,127,0,38,0,167,0,167,0,72,};
+#endif
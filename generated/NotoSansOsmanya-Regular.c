@@ -0,0 +1,321 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansOsmanya_Regular_ttf_size = 7472;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansOsmanya_Regular_ttf");
+asm(".type fz_font_NotoSansOsmanya_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansOsmanya_Regular_ttf, 7472");
+asm(".balign 64");
+asm("fz_font_NotoSansOsmanya_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansOsmanya-Regular.ttf\"");
+#else
+const int fz_font_NotoSansOsmanya_Regular_ttf_size = 7472;
+const char fz_font_NotoSansOsmanya_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,126,231,109,24,0,0,1,56,0,0,0,96,
+99,109,97,112,0,221,18,128,0,0,2,72,0,0,0,184,103,97,115,112,0,22,0,35,0,
+0,29,32,0,0,0,16,103,108,121,102,29,21,221,227,0,0,3,92,0,0,19,154,104,101,
+97,100,5,94,7,190,0,0,0,188,0,0,0,54,104,104,101,97,16,39,5,239,0,0,0,244,
+0,0,0,36,104,109,116,120,201,251,11,46,0,0,1,152,0,0,0,176,108,111,99,97,
+106,96,101,176,0,0,3,0,0,0,0,90,109,97,120,112,0,48,0,84,0,0,1,24,0,0,0,32,
+110,97,109,101,141,42,185,93,0,0,22,248,0,0,6,6,112,111,115,116,255,105,0,
+102,0,0,29,0,0,0,0,32,0,1,0,0,0,1,7,174,87,12,145,107,95,15,60,245,0,11,8,
+0,0,0,0,0,204,125,233,110,0,0,0,0,210,40,203,254,255,236,255,206,7,172,5,
+216,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,7,252,255,236,0,30,
+7,172,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,1,0,0,0,44,0,83,0,3,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,178,1,144,0,5,0,0,5,154,5,51,0,
+0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,4,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,0,4,0,0,102,0,0,0,0,4,20,0,0,2,
+88,0,0,5,17,0,80,5,148,0,100,5,151,0,40,2,105,0,140,6,58,0,100,5,159,0,100,
+5,244,0,110,3,169,0,0,4,131,0,60,4,111,0,100,4,252,0,30,4,8,0,0,5,134,0,100,
+4,197,0,60,6,57,0,0,3,175,0,40,5,231,0,100,4,23,0,40,4,95,0,70,6,243,0,80,
+4,163,0,100,4,125,0,100,4,15,0,0,3,70,0,80,4,9,0,80,6,89,0,0,4,5,0,0,4,73,
+0,100,5,171,0,80,7,252,255,236,5,7,0,100,3,136,0,0,4,204,0,120,4,255,0,80,
+4,142,0,120,3,178,0,120,3,160,0,100,4,26,0,20,4,7,0,110,4,211,0,120,0,0,0,
+2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,0,12,0,8,0,2,0,4,0,0,0,
+13,0,32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,0,160,254,255,255,255,0,1,
+255,245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,100,
+0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,0,0,0,32,
+0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,254,255,0,0,254,255,0,0,
+0,1,0,1,4,128,0,1,4,157,0,0,0,4,0,1,4,160,0,1,4,169,0,0,0,34,0,0,0,20,0,20,
+0,20,0,20,0,79,0,169,0,243,1,0,1,59,1,132,1,182,1,217,2,26,2,92,2,160,2,231,
+3,70,3,132,3,254,4,55,4,124,4,172,4,235,5,61,5,128,5,201,6,4,6,43,6,94,6,
+169,6,221,7,12,7,73,7,165,7,213,8,9,8,72,8,138,8,213,9,34,9,82,9,123,9,164,
+9,205,0,0,0,2,0,102,0,0,3,154,5,182,0,3,0,7,0,0,51,17,33,17,37,33,17,33,102,
+3,52,253,47,2,110,253,146,5,182,250,74,98,4,242,0,2,0,80,255,236,4,133,5,
+210,0,22,0,34,0,0,1,22,18,21,20,2,4,35,34,36,53,52,18,55,38,39,55,22,23,54,
+55,23,6,5,6,2,21,20,22,51,50,54,53,52,38,3,69,161,159,145,254,243,177,228,
+254,254,224,245,91,120,97,151,119,124,185,67,135,254,248,215,193,159,149,
+184,197,136,4,174,145,254,205,179,174,254,244,145,228,200,208,1,130,196,68,
+77,147,92,90,81,101,147,74,177,161,254,182,179,136,146,222,205,152,248,0,
+2,0,100,255,233,5,118,5,182,0,46,0,55,0,0,1,3,54,55,7,7,6,2,4,35,34,38,53,
+52,36,37,55,6,35,34,39,6,35,34,38,53,55,19,51,3,7,20,22,51,50,55,19,51,3,
+7,20,22,51,50,54,55,19,1,50,54,55,4,4,21,20,22,5,8,77,79,108,24,181,28,182,
+254,213,185,190,192,1,214,1,177,14,74,88,150,81,102,149,140,150,3,33,184,
+30,8,66,61,157,17,37,184,31,4,65,67,80,75,9,39,253,166,199,253,43,254,180,
+254,148,98,5,182,253,16,7,3,155,10,177,254,251,140,133,144,154,225,57,123,
+36,96,96,149,143,68,1,69,254,214,90,66,71,168,1,101,254,202,67,76,72,87,81,
+1,101,250,211,205,192,46,147,89,65,50,0,2,0,40,255,231,5,71,5,182,0,37,0,
+49,0,0,1,22,21,20,6,35,32,17,52,54,19,35,22,21,20,6,35,34,38,53,52,54,54,
+51,33,19,51,3,6,21,20,22,51,50,54,53,52,39,1,52,38,35,34,6,21,20,22,51,50,
+54,5,51,20,195,180,254,209,1,71,150,20,185,133,112,145,88,147,82,1,148,32,
+184,98,16,60,59,90,99,15,253,70,67,50,57,87,69,48,56,88,2,108,80,103,220,
+242,1,65,14,24,2,160,48,53,135,181,148,107,79,149,88,1,46,252,83,151,48,101,
+86,145,141,78,78,1,56,48,67,86,57,52,64,84,0,0,1,0,140,0,0,1,221,5,182,0,
+3,0,0,51,19,51,3,140,153,184,153,5,182,250,74,0,1,0,100,255,231,5,234,5,182,
+0,35,0,0,1,22,21,20,6,35,32,17,52,54,19,35,1,35,3,35,6,7,3,35,19,51,19,19,
+51,3,6,21,20,22,51,50,54,53,52,39,5,214,20,195,180,254,209,9,103,8,255,0,
+100,177,8,3,19,93,184,153,225,179,254,230,99,16,60,59,90,99,15,2,108,93,90,
+220,242,1,65,16,110,3,50,254,132,1,126,165,190,252,137,5,182,254,134,1,122,
+252,83,151,48,101,86,145,141,62,94,0,0,1,0,100,255,231,5,79,5,204,0,50,0,
+0,1,38,35,34,6,7,7,54,51,50,22,21,20,7,6,21,20,22,51,50,54,53,52,39,55,22,
+21,20,6,35,34,38,53,52,55,54,53,52,38,35,34,7,3,35,19,54,54,51,50,22,23,3,
+150,116,145,116,137,15,11,96,120,155,146,13,13,64,57,95,94,15,175,20,191,
+184,157,148,15,15,70,87,124,69,74,185,105,24,238,210,103,173,93,4,184,116,
+165,162,99,52,155,176,65,120,121,67,54,57,116,138,110,78,43,112,91,214,228,
+137,133,64,110,110,70,106,85,80,253,58,3,238,233,245,69,88,0,2,0,110,255,
+234,5,114,5,205,0,12,0,24,0,0,1,16,0,33,32,0,17,16,18,36,51,32,0,3,52,38,
+35,34,0,17,20,18,51,50,0,5,114,254,131,254,172,254,243,254,218,173,1,70,225,
+1,9,1,39,194,198,185,240,254,239,201,185,242,1,12,3,70,254,107,254,57,1,85,
+1,47,1,5,1,136,210,254,165,254,209,235,255,254,149,254,181,237,255,0,1,115,
+0,1,0,0,0,0,3,69,5,204,0,20,0,0,17,54,51,50,23,22,51,50,55,51,3,35,19,6,35,
+34,39,38,35,34,7,84,112,69,98,97,80,70,105,122,153,184,137,74,43,81,99,99,
+45,78,56,5,162,42,21,22,21,250,74,5,15,14,22,21,21,0,0,2,0,60,255,234,4,11,
+5,204,0,28,0,42,0,0,19,54,54,51,50,22,21,20,7,22,22,21,20,0,35,34,38,53,52,
+54,55,54,54,53,52,38,35,34,7,1,14,2,21,20,22,51,50,54,54,53,52,38,60,81,146,
+81,144,164,78,214,223,254,231,229,187,223,89,94,104,79,78,65,114,101,1,118,
+86,65,36,134,111,84,130,72,173,5,121,46,37,146,124,129,135,51,239,178,223,
+254,231,199,158,114,228,131,146,166,78,59,67,60,254,53,118,126,132,76,98,
+117,89,153,90,126,177,0,0,2,0,100,255,234,4,51,5,204,0,29,0,43,0,0,37,6,6,
+35,34,38,53,52,55,38,38,53,52,0,51,50,22,22,21,20,6,7,6,6,21,20,22,51,50,
+55,1,62,2,53,52,38,35,34,6,6,21,20,22,4,51,81,146,81,144,164,78,208,229,1,
+25,229,122,186,102,90,93,105,78,78,65,114,101,254,137,82,68,38,134,111,84,
+131,71,175,61,46,37,146,124,131,129,48,238,183,226,1,25,91,164,105,114,228,
+129,147,167,75,59,67,60,1,200,109,131,136,76,99,119,91,155,89,127,176,0,1,
+0,30,255,234,4,212,5,204,0,45,0,0,19,54,51,50,23,22,51,50,55,51,3,6,21,22,
+51,50,54,53,52,39,55,22,51,50,55,7,6,35,22,21,20,6,6,35,32,17,52,55,19,6,
+35,34,39,38,35,7,30,32,59,47,89,88,40,95,52,131,113,6,3,115,95,87,38,11,110,
+101,102,106,20,82,119,14,89,163,110,254,204,6,97,36,40,48,96,96,24,67,5,196,
+8,20,21,19,251,233,58,52,167,173,168,118,61,152,10,10,162,8,57,130,137,220,
+118,1,65,50,57,3,116,10,22,22,3,0,0,2,0,0,255,234,3,184,5,182,0,36,0,44,0,
+0,1,54,51,7,34,7,6,4,35,34,38,53,52,54,36,55,54,55,6,35,34,38,53,55,19,51,
+3,7,20,22,51,50,54,55,19,51,3,3,6,6,21,20,22,51,50,3,41,63,80,24,53,100,68,
+254,248,175,128,140,145,1,25,189,13,16,74,88,136,156,3,37,184,31,4,65,67,
+80,75,9,39,184,76,241,189,208,48,41,223,2,107,5,155,7,235,249,118,115,95,
+155,109,28,80,135,36,136,138,54,1,101,254,202,67,76,72,87,81,1,101,253,22,
+254,233,32,115,76,30,46,0,2,0,100,255,234,5,54,5,204,0,53,0,66,0,0,51,19,
+62,2,55,38,38,53,52,54,54,51,50,22,21,20,6,7,23,22,22,21,20,7,6,21,20,22,
+51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,53,52,39,39,6,6,7,3,19,
+62,2,53,52,38,35,34,6,21,20,22,100,49,10,33,67,118,90,74,71,133,89,142,160,
+73,94,52,90,82,9,10,60,59,90,99,15,175,20,200,180,138,160,17,88,76,101,66,
+9,48,223,56,39,20,68,48,46,64,60,1,236,105,110,86,103,92,153,82,71,121,69,
+136,115,87,154,95,40,70,143,94,33,74,75,43,101,86,145,141,82,71,43,80,100,
+219,243,160,161,54,103,57,117,78,68,93,116,84,254,29,3,241,51,56,63,39,51,
+55,61,42,60,101,0,0,1,0,60,255,234,4,117,5,182,0,40,0,0,1,22,21,20,6,35,34,
+38,53,52,55,19,6,35,34,38,53,55,19,51,3,7,20,22,51,50,54,55,19,51,3,6,21,
+20,22,51,50,54,53,52,39,4,97,20,195,180,143,160,11,40,70,92,136,156,3,37,
+184,31,4,65,67,80,75,9,39,184,99,16,60,59,90,99,15,2,108,93,90,221,238,168,
+153,36,94,1,124,32,136,138,54,1,101,254,202,67,76,72,87,81,1,101,252,83,151,
+45,101,86,143,140,81,75,0,3,0,0,255,234,5,233,5,204,0,62,0,72,0,82,0,0,1,
+22,21,20,6,35,34,38,53,52,54,19,6,7,3,2,33,34,38,53,52,54,54,55,19,53,52,
+38,35,34,6,7,39,54,51,50,22,21,7,3,54,55,55,54,54,51,50,22,21,20,6,7,6,6,
+21,20,22,51,50,54,53,52,39,5,6,6,21,20,22,51,50,54,55,1,54,54,53,52,38,35,
+34,6,7,5,213,20,195,180,142,161,8,38,38,187,26,38,254,183,118,145,102,186,
+194,34,77,88,37,81,29,100,99,184,160,158,2,30,142,88,17,21,164,158,99,120,
+184,220,26,27,60,59,90,99,15,252,171,157,123,61,45,59,87,11,2,136,105,96,
+36,32,59,57,11,2,108,112,71,221,238,160,161,27,88,1,77,19,82,254,235,254,
+121,155,125,98,161,138,88,1,106,28,101,90,29,28,133,84,162,169,38,254,221,
+60,51,160,202,187,113,88,118,206,112,233,239,50,101,86,143,140,26,130,18,
+79,133,75,66,68,123,113,2,146,60,107,54,28,43,121,113,0,0,1,0,40,0,0,3,95,
+5,182,0,34,0,0,33,19,52,38,35,34,6,7,3,35,19,18,33,50,23,55,6,35,34,38,53,
+55,19,51,3,7,20,22,51,50,54,55,19,51,3,2,13,36,79,82,71,62,9,34,184,34,32,
+1,31,112,82,22,74,88,136,156,3,37,184,31,4,65,67,80,75,9,39,184,154,1,97,
+59,70,87,81,254,198,1,80,1,50,42,213,36,136,138,54,1,101,254,202,67,76,72,
+87,81,1,101,250,74,0,1,0,100,255,234,5,151,5,204,0,45,0,0,1,22,21,20,6,35,
+34,38,53,52,55,19,54,53,52,38,35,34,6,6,2,3,35,19,62,3,51,50,22,22,21,20,
+7,2,2,21,20,22,51,50,54,53,52,39,5,131,20,195,180,143,160,17,51,8,92,99,81,
+101,57,36,80,183,99,19,61,107,165,115,127,154,72,13,31,32,60,59,90,99,15,
+2,108,80,100,220,242,159,162,53,144,1,196,61,76,130,110,73,145,254,175,252,
+254,3,178,180,187,114,57,71,145,130,79,117,254,237,254,230,60,101,86,145,
+141,82,71,0,0,1,0,40,255,234,3,159,5,182,0,29,0,0,19,19,51,3,54,54,51,50,
+22,21,16,2,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,7,104,89,184,
+52,31,105,48,195,223,244,225,184,203,31,181,18,113,104,132,145,123,113,54,
+114,25,16,2,108,3,74,254,24,19,24,249,220,254,238,254,216,164,172,11,96,91,
+217,186,152,164,45,34,158,0,1,0,70,255,234,4,15,5,204,0,42,0,0,1,7,2,33,34,
+38,38,53,52,62,6,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,6,7,6,6,21,20,
+22,51,50,54,55,55,4,15,13,57,254,15,128,179,95,52,85,109,113,109,85,52,77,
+84,177,26,188,29,193,175,166,183,80,154,179,100,92,123,120,140,178,19,10,
+2,128,125,253,231,96,174,112,75,113,90,74,74,80,101,128,85,64,80,182,31,163,
+148,162,139,113,188,154,115,64,114,62,113,122,215,189,98,0,1,0,80,255,234,
+6,163,5,182,0,56,0,0,33,19,6,35,34,38,53,55,19,51,3,7,20,22,51,50,54,55,19,
+51,3,54,51,50,22,21,20,7,6,21,20,22,51,50,54,53,52,39,55,22,21,20,6,35,34,
+38,53,52,55,54,53,52,38,35,34,7,3,1,194,84,74,88,136,156,3,37,184,31,4,65,
+67,80,75,9,39,184,59,92,113,155,146,13,13,64,57,96,93,15,175,20,192,183,157,
+148,15,15,70,87,114,68,76,3,45,36,136,138,54,1,101,254,202,67,76,72,87,81,
+1,101,253,210,46,155,176,64,120,120,66,54,57,115,136,110,78,43,80,123,214,
+225,137,133,64,109,108,70,106,85,68,253,46,0,0,1,0,100,255,234,4,83,5,182,
+0,43,0,0,1,22,18,21,20,6,35,34,39,6,21,20,22,51,50,54,54,55,51,2,0,35,34,
+38,38,53,52,54,55,38,39,39,51,23,30,2,51,50,54,53,52,2,39,3,154,31,43,146,
+138,162,108,151,140,124,90,152,104,11,195,46,254,238,255,130,196,106,128,
+114,81,21,23,185,18,14,78,111,65,59,62,39,32,5,182,81,254,231,121,139,156,
+95,123,208,149,161,98,201,113,254,224,254,228,120,206,121,147,248,84,144,
+204,210,172,128,212,106,67,62,111,1,22,100,0,2,0,100,255,234,4,45,5,204,0,
+36,0,47,0,0,5,34,38,53,52,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,23,7,
+39,6,6,21,20,22,51,50,54,55,55,51,7,2,0,1,54,54,53,52,38,35,34,6,21,20,2,
+0,196,216,121,131,87,82,168,139,132,156,71,95,52,46,128,100,104,87,122,134,
+136,170,23,8,185,10,29,254,236,254,239,65,47,61,48,49,68,22,229,208,129,232,
+122,90,156,79,119,142,134,117,86,153,96,45,32,131,88,96,165,89,152,138,221,
+202,79,98,254,232,254,228,4,10,62,98,58,46,48,59,44,95,0,1,0,0,255,234,3,
+171,5,204,0,40,0,0,1,38,35,34,6,6,21,20,22,22,23,30,2,21,20,6,35,32,39,55,
+22,22,51,50,54,53,46,7,53,52,54,51,50,23,3,37,114,128,49,85,51,51,88,142,
+115,108,57,246,219,254,224,186,126,85,170,91,132,141,4,52,80,100,103,99,76,
+47,202,169,216,131,4,195,105,43,79,58,58,97,89,102,83,117,128,76,196,220,
+215,127,97,85,120,120,59,94,80,72,73,80,97,119,76,165,191,125,0,1,0,80,255,
+234,2,246,5,182,0,23,0,0,1,22,21,20,6,35,34,38,53,52,55,19,51,3,6,21,20,22,
+51,50,54,53,52,39,2,226,20,195,180,139,164,6,116,184,100,16,57,62,90,99,15,
+2,108,112,71,221,238,171,147,43,48,4,51,252,83,151,48,96,88,143,140,70,86,
+0,0,2,0,80,255,210,3,145,5,204,0,19,0,30,0,0,1,20,2,2,6,7,39,54,54,55,6,35,
+34,38,53,52,18,51,50,22,7,52,38,35,34,17,20,22,51,50,54,3,145,98,171,240,
+149,29,152,221,60,84,102,180,213,232,206,182,213,194,110,101,234,104,105,
+118,118,4,29,196,254,113,254,216,183,25,153,39,245,205,37,233,199,230,1,7,
+228,204,131,140,254,179,139,132,171,0,0,1,0,0,255,234,6,9,5,204,0,52,0,0,
+1,22,21,20,6,35,34,38,53,52,55,54,53,52,38,35,34,7,3,35,19,53,52,38,35,34,
+6,7,39,54,51,50,22,21,7,7,54,51,50,22,21,20,7,6,21,20,22,51,50,54,53,52,39,
+5,245,20,192,183,157,148,15,15,70,87,114,67,76,184,115,77,88,37,81,29,100,
+99,184,160,158,2,23,92,112,155,146,13,13,64,57,96,93,15,2,108,112,91,214,
+225,137,133,64,109,108,70,106,85,67,253,45,4,82,27,101,90,29,28,133,84,162,
+169,38,211,46,155,176,64,120,120,66,54,57,115,136,58,130,0,0,1,0,0,0,0,3,
+151,5,204,0,30,0,0,1,54,51,50,22,21,20,6,3,35,19,38,35,34,6,7,3,35,19,18,
+33,50,23,19,55,52,38,35,34,6,7,1,62,99,184,160,158,11,109,184,52,49,136,111,
+142,14,31,184,30,46,1,141,127,87,34,9,74,91,37,81,29,5,120,84,162,169,19,
+113,252,3,1,238,96,167,140,254,229,1,36,1,202,58,1,65,131,97,83,29,28,0,0,
+1,0,100,0,0,3,219,5,204,0,28,0,0,1,3,35,19,6,35,34,38,53,16,18,51,50,22,23,
+7,38,38,35,34,6,21,20,22,51,50,54,55,55,3,155,89,184,51,82,101,195,223,244,
+225,184,203,31,181,18,113,104,132,145,123,113,52,113,27,17,3,79,252,177,1,
+227,38,249,220,1,18,1,40,164,172,11,95,92,217,186,152,164,44,34,164,0,1,0,
+80,255,234,5,91,5,182,0,39,0,0,1,3,6,21,20,22,51,50,54,53,52,39,55,22,21,
+20,6,35,34,39,6,35,34,38,53,52,54,19,51,3,6,21,20,22,51,50,54,54,55,19,3,
+231,99,14,54,62,90,99,15,175,20,195,180,159,78,107,219,170,183,13,99,185,
+99,8,87,96,82,105,60,17,99,5,182,252,78,123,73,97,85,143,140,62,94,43,112,
+71,221,238,107,107,174,172,47,153,3,170,252,76,76,61,133,106,75,148,155,3,
+178,0,0,1,255,236,255,234,7,172,5,204,0,64,0,0,1,22,21,20,6,35,32,17,52,55,
+54,53,52,38,35,34,7,3,35,19,55,52,38,35,34,6,7,3,35,18,53,52,38,35,34,6,7,
+39,54,51,50,22,21,20,3,54,51,50,23,54,51,50,22,21,20,7,6,21,20,51,50,54,53,
+52,39,7,152,20,195,180,254,203,15,14,63,62,157,17,62,184,56,4,65,67,80,75,
+9,64,184,112,78,87,37,81,29,100,99,184,163,155,27,74,93,150,81,102,149,144,
+156,15,16,123,90,99,15,2,108,93,90,221,238,1,52,52,110,109,56,65,72,168,253,
+186,2,23,67,76,72,87,81,253,186,4,97,13,102,88,29,28,133,84,163,167,24,255,
+0,36,96,96,152,140,33,122,123,40,162,143,140,70,86,0,0,2,0,100,255,234,4,
+133,5,204,0,11,0,24,0,0,1,16,0,33,34,2,17,16,0,33,50,18,3,16,38,35,34,2,17,
+20,22,51,50,54,18,4,133,254,200,254,222,222,233,1,55,1,18,231,241,194,141,
+142,179,207,143,140,113,178,95,3,70,254,95,254,69,1,87,1,70,1,132,1,193,254,
+183,254,166,1,12,247,254,133,254,198,243,250,167,1,47,0,0,1,0,0,255,234,2,
+252,5,204,0,34,0,0,55,22,51,50,54,54,53,52,38,39,38,38,53,52,54,54,51,50,
+23,21,38,35,34,6,21,20,22,23,22,22,21,16,33,34,39,2,83,133,118,144,67,69,
+77,75,71,98,179,113,46,73,44,58,91,122,66,80,75,71,253,244,120,97,160,22,
+59,113,103,73,150,99,96,165,83,123,185,97,5,159,4,116,92,75,152,107,101,171,
+87,254,67,19,0,1,0,120,255,234,4,124,5,204,0,40,0,0,1,7,2,0,35,34,38,38,53,
+52,54,55,38,53,52,54,54,51,50,23,7,38,35,34,6,21,20,23,54,55,23,6,6,21,20,
+22,51,50,54,55,55,4,124,10,28,254,232,249,130,196,109,67,57,150,104,189,132,
+241,119,150,70,145,104,122,94,80,93,48,131,158,145,131,138,181,21,7,2,128,
+98,254,237,254,223,115,200,122,105,192,69,133,201,115,171,83,177,111,128,
+110,92,113,94,57,34,152,44,234,146,138,154,228,203,71,0,1,0,80,255,234,4,
+225,5,216,0,43,0,0,1,35,3,54,51,50,22,21,20,7,7,20,22,51,50,55,23,6,35,34,
+38,53,55,54,53,52,38,35,34,7,3,35,19,38,39,55,22,22,51,51,50,55,7,6,2,48,
+89,41,82,102,170,185,25,3,69,70,75,53,41,86,119,138,150,4,23,113,98,97,63,
+78,185,137,121,85,23,56,203,111,85,222,141,22,154,5,22,254,123,37,172,159,
+46,225,57,81,72,38,161,37,153,148,64,217,39,92,99,48,253,26,5,29,7,18,162,
+14,20,32,169,23,0,2,0,120,255,234,4,22,5,182,0,34,0,48,0,0,1,7,21,20,22,23,
+54,54,55,55,51,7,6,2,7,30,2,21,20,6,6,35,34,38,53,52,54,54,55,38,38,53,52,
+55,1,14,2,21,20,22,51,50,54,54,53,52,38,1,187,16,80,89,116,123,13,14,184,
+12,14,150,162,115,84,46,117,209,131,175,201,66,126,149,120,98,16,1,57,121,
+90,47,109,92,67,111,66,75,5,182,154,23,92,173,97,102,194,111,132,118,139,
+254,255,139,115,116,117,65,127,189,102,173,155,87,150,145,121,126,221,119,
+30,157,253,4,99,103,104,59,91,104,61,113,83,62,132,0,0,2,0,120,255,234,3,
+98,5,205,0,42,0,53,0,0,1,22,21,20,6,35,34,38,53,52,54,55,54,53,52,39,38,53,
+52,54,51,50,22,21,20,6,6,7,22,21,20,7,6,6,21,20,22,51,50,54,53,52,39,1,50,
+54,53,52,38,35,34,6,21,20,3,78,20,197,187,185,177,26,31,57,29,30,167,140,
+130,142,87,152,108,13,55,34,21,81,97,95,103,15,254,221,105,85,55,39,49,62,
+2,108,112,71,227,232,152,166,54,103,72,133,167,81,128,128,61,119,143,133,
+119,86,143,72,3,61,41,150,145,91,94,47,83,79,143,140,59,97,1,255,72,70,52,
+43,59,45,37,0,0,1,0,100,255,206,3,40,5,182,0,28,0,0,23,39,62,2,55,19,6,35,
+34,38,53,55,19,51,3,7,20,22,51,50,54,55,19,51,3,14,2,205,29,129,135,73,15,
+30,74,92,136,156,3,37,184,31,4,65,67,80,75,9,39,184,96,19,116,211,50,160,
+23,88,162,142,1,34,38,136,138,54,1,101,254,202,67,76,72,87,81,1,101,252,75,
+188,222,132,0,1,0,20,255,234,3,152,5,204,0,23,0,0,19,54,51,50,0,17,20,2,6,
+35,34,39,55,22,51,50,54,18,53,16,2,35,34,7,225,86,111,239,1,3,134,249,174,
+229,114,103,82,177,104,154,86,165,158,76,68,5,186,18,254,133,254,189,252,
+254,141,181,118,128,86,148,1,31,204,1,5,1,30,9,0,1,0,110,255,234,3,203,5,
+204,0,23,0,0,37,6,35,34,2,17,52,18,0,51,50,23,7,38,35,34,6,2,21,20,22,51,
+50,55,3,131,138,223,213,215,176,1,35,178,135,81,64,42,128,119,195,119,126,
+120,174,101,92,114,1,5,1,15,247,1,213,1,2,18,151,9,211,254,107,199,183,188,
+89,0,0,1,0,120,255,234,4,91,5,182,0,23,0,0,1,3,14,2,35,34,38,53,52,55,19,
+51,3,6,21,20,22,51,50,54,54,55,19,4,91,99,22,114,208,163,201,188,9,99,185,
+99,7,110,120,94,118,66,18,99,5,182,252,78,207,220,111,183,208,70,81,3,174,
+252,76,56,64,138,119,73,146,160,3,178,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,
+0,94,0,0,0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,128,0,3,0,1,4,9,
+0,3,0,72,0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,0,30,0,214,0,3,0,
+1,4,9,0,6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,9,0,8,0,42,1,86,
+0,3,0,1,4,9,0,9,0,40,1,128,0,3,0,1,4,9,0,10,0,96,1,168,0,3,0,1,4,9,0,11,0,
+62,2,8,0,3,0,1,4,9,0,12,0,60,2,70,0,3,0,1,4,9,0,13,2,150,2,130,0,3,0,1,4,
+9,0,14,0,52,5,24,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,
+0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,79,0,115,0,109,0,97,0,110,0,121,0,97,
+0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,
+78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,79,0,115,0,109,0,97,
+0,110,0,121,0,97,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,
+0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,
+79,0,115,0,109,0,97,0,110,0,121,0,97,0,78,0,111,0,116,0,111,0,32,0,105,0,
+115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,
+32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,
+99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,
+97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,
+0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,
+0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,
+0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,
+0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,
+0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,
+0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,
+0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,
+0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,
+0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,
+0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,
+99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,
+0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,
+0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,
+0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,
+0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,
+0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,
+0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,
+0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,
+102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,
+0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,
+0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,
+32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,
+111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,
+0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,
+0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,
+0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,15,};
+#endif
@@ -0,0 +1,1470 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansPhagsPa_Regular_ttf_size = 35204;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansPhagsPa_Regular_ttf");
+asm(".type fz_font_NotoSansPhagsPa_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansPhagsPa_Regular_ttf, 35204");
+asm(".balign 64");
+asm("fz_font_NotoSansPhagsPa_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansPhagsPa-Regular.ttf\"");
+#else
+const int fz_font_NotoSansPhagsPa_Regular_ttf_size = 35204;
+const char fz_font_NotoSansPhagsPa_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,190,2,17,0,0,125,100,0,0,0,42,71,
+80,79,83,165,248,189,5,0,0,125,144,0,0,0,48,71,83,85,66,54,163,141,170,0,
+0,125,192,0,0,11,194,79,83,47,50,117,84,102,148,0,0,1,104,0,0,0,96,99,109,
+97,112,194,130,129,72,0,0,7,192,0,0,0,188,103,97,115,112,0,7,0,7,0,0,125,
+88,0,0,0,12,103,108,121,102,215,251,53,133,0,0,11,124,0,0,86,96,104,101,97,
+100,6,253,101,28,0,0,0,236,0,0,0,54,104,104,101,97,16,186,7,41,0,0,1,36,0,
+0,0,36,104,109,116,120,181,44,123,242,0,0,1,200,0,0,5,248,108,111,99,97,150,
+139,128,71,0,0,8,124,0,0,2,254,109,97,120,112,1,152,0,198,0,0,1,72,0,0,0,
+32,110,97,109,101,141,174,184,176,0,0,97,220,0,0,6,10,112,111,115,116,166,
+195,145,21,0,0,103,232,0,0,21,112,0,1,0,0,0,1,7,174,90,237,170,160,95,15,
+60,245,0,11,8,0,0,0,0,0,205,139,71,103,0,0,0,0,210,40,203,254,254,81,254,
+247,9,217,6,20,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,9,176,254,
+81,254,82,9,217,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,126,0,1,0,0,1,126,0,122,
+0,19,0,74,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,5,63,1,144,0,5,0,0,
+5,154,5,51,0,0,1,31,5,154,5,51,0,0,3,209,0,50,2,7,0,0,2,11,5,2,4,5,4,2,2,
+4,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,
+168,0,0,8,141,2,88,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,3,4,205,0,193,0,0,0,
+0,2,20,0,0,2,20,0,0,2,39,0,147,3,121,0,25,3,18,2,20,5,27,2,20,4,168,0,147,
+0,0,255,220,0,0,255,37,3,170,2,20,4,37,2,20,5,27,0,143,5,178,0,143,5,178,
+0,143,5,250,0,143,5,250,0,143,5,178,0,143,5,250,0,143,4,242,0,143,5,150,0,
+143,5,209,0,143,4,47,0,143,5,94,0,143,6,4,0,143,6,4,0,143,6,4,0,143,5,94,
+0,143,5,150,0,143,5,27,0,143,6,25,0,143,6,41,0,143,5,164,0,143,6,35,0,143,
+6,0,0,143,4,188,0,143,4,47,0,143,5,248,0,143,6,0,0,143,4,211,0,143,5,195,
+0,143,4,227,0,143,5,94,0,143,6,188,0,143,5,215,0,143,3,180,0,143,5,16,0,143,
+5,242,0,143,7,250,0,143,5,16,0,143,4,6,0,143,4,143,0,82,3,160,0,123,5,150,
+0,143,5,209,0,143,4,47,0,143,5,94,0,143,4,188,0,143,6,0,0,143,5,215,0,143,
+9,74,0,143,3,111,0,143,3,43,0,143,4,129,0,82,5,176,0,92,5,2,0,102,2,27,0,
+184,3,145,0,184,6,225,0,102,4,68,0,2,5,90,0,143,4,203,0,2,6,23,0,143,5,135,
+0,2,4,84,0,2,5,156,0,143,5,33,0,143,5,12,0,2,5,139,0,143,4,252,0,2,4,231,
+0,143,4,145,0,2,6,23,0,143,4,74,0,0,3,145,0,0,6,139,0,143,5,106,0,2,4,45,
+0,2,6,143,0,143,4,20,0,0,3,92,0,0,3,152,0,0,2,178,0,0,4,109,0,143,7,143,0,
+143,6,10,0,143,5,123,0,2,4,119,255,236,4,4,255,236,5,211,0,143,5,68,0,2,4,
+139,0,2,5,51,0,2,5,109,0,143,6,23,0,143,5,135,0,2,4,207,0,2,4,221,0,2,5,231,
+0,143,4,129,0,2,5,88,0,2,6,78,0,143,5,190,0,2,5,6,0,2,4,207,0,2,6,8,0,143,
+3,133,0,0,5,176,0,143,3,227,0,0,5,246,0,143,5,102,0,2,5,190,0,143,5,47,0,
+2,5,176,0,143,5,33,0,2,6,70,0,143,6,37,0,143,4,88,0,2,4,244,0,143,4,100,0,
+2,4,127,255,236,6,78,0,143,5,231,0,143,5,190,0,2,5,88,0,2,5,20,0,2,5,176,
+0,143,5,33,0,2,6,78,0,143,5,190,0,2,5,6,0,2,5,231,0,143,5,88,0,2,5,252,0,
+2,5,150,0,2,6,139,0,143,6,37,0,143,5,252,0,2,5,150,0,2,5,106,0,2,6,98,0,143,
+5,252,0,143,5,211,0,2,5,109,0,2,5,66,0,2,4,193,0,143,4,90,0,143,4,49,0,2,
+3,203,0,2,3,160,0,2,6,141,0,143,6,39,0,143,5,254,0,2,5,152,0,2,5,106,0,2,
+6,35,0,143,5,223,0,143,5,147,0,2,5,80,0,2,5,35,0,2,6,150,0,143,6,47,0,143,
+6,6,0,2,5,160,0,2,5,117,0,2,6,150,0,143,6,47,0,143,6,6,0,2,5,160,0,2,5,117,
+0,2,6,170,0,143,6,68,0,143,6,27,0,2,5,180,0,2,5,137,0,2,6,139,0,143,6,37,
+0,143,5,252,0,2,5,150,0,2,5,147,0,2,6,152,0,143,6,49,0,143,6,8,0,2,5,162,
+0,2,5,113,0,2,4,193,0,143,4,90,0,143,4,49,0,2,3,203,0,2,3,160,0,2,4,152,0,
+143,4,49,0,143,4,8,0,2,3,162,0,2,3,119,0,2,6,152,0,143,6,45,0,143,6,8,0,2,
+5,158,0,2,5,113,0,2,5,223,0,143,5,182,0,2,5,80,0,2,5,35,0,2,6,70,0,143,5,
+223,0,143,5,182,0,2,5,80,0,2,5,35,0,2,6,152,0,143,6,37,0,143,6,8,0,2,5,150,
+0,2,5,104,0,2,6,211,0,143,6,109,0,143,6,68,0,2,5,221,0,2,5,154,0,2,4,186,
+0,82,4,53,255,250,4,125,0,82,8,111,0,143,8,8,0,143,7,223,0,2,7,121,0,2,7,
+106,0,2,5,231,0,143,4,242,0,2,5,129,0,143,5,68,0,2,4,242,0,2,4,129,0,2,6,
+78,0,143,5,190,0,143,5,190,0,2,5,47,0,2,5,6,0,2,6,98,0,143,5,252,0,143,5,
+211,0,2,5,109,0,2,5,66,0,2,4,119,255,236,4,127,255,236,4,4,255,236,6,98,0,
+143,5,211,0,2,5,109,0,2,5,98,0,2,5,252,0,143,4,20,0,0,3,133,0,0,3,92,0,0,
+4,193,0,143,4,90,0,143,4,49,0,2,3,203,0,2,3,160,0,2,6,23,0,143,5,176,0,143,
+5,135,0,2,5,33,0,2,4,207,0,2,5,123,0,2,5,102,0,2,5,51,0,2,4,74,0,0,3,227,
+0,0,3,145,0,0,5,2,0,143,5,246,0,143,4,115,0,2,5,102,0,2,5,72,0,2,3,213,0,
+143,3,111,0,143,3,70,0,2,2,223,0,2,2,223,0,2,2,176,0,143,5,113,0,2,5,113,
+0,2,6,152,0,143,6,49,0,143,6,8,0,2,5,162,0,2,1,133,0,0,4,94,0,123,3,248,0,
+123,3,168,255,199,3,66,255,199,2,233,255,199,3,168,255,199,3,66,255,199,2,
+233,255,199,9,176,0,143,9,33,0,2,9,74,0,143,8,186,0,2,8,186,0,2,6,150,0,143,
+6,6,0,2,6,47,0,143,5,160,0,2,5,117,0,2,5,90,0,143,4,244,0,143,4,203,0,2,4,
+100,0,2,4,203,0,0,4,100,0,0,4,45,0,2,4,45,0,0,5,170,0,143,4,246,0,143,5,27,
+0,2,4,102,0,2,4,98,0,2,5,211,0,143,5,109,0,143,5,68,0,2,4,221,0,2,4,139,0,
+2,4,96,255,250,4,35,255,250,4,74,0,0,3,227,0,0,3,145,0,0,6,0,0,143,6,152,
+0,143,5,158,0,2,6,8,0,2,5,195,0,143,6,10,0,143,5,246,0,143,5,94,0,143,6,23,
+0,143,6,188,0,143,7,143,0,143,5,215,0,143,6,143,0,143,3,160,0,123,4,94,0,
+123,5,129,0,143,4,176,2,88,4,176,0,130,3,49,0,102,4,203,0,102,6,119,0,80,
+4,176,2,18,4,176,0,130,5,110,1,174,5,110,0,100,4,176,2,88,4,176,0,110,4,226,
+1,244,4,226,0,100,4,176,1,244,4,176,0,100,4,226,1,244,4,226,0,100,4,176,2,
+38,4,176,0,150,4,176,1,244,4,176,0,140,0,0,0,0,0,0,255,220,0,0,254,81,4,228,
+0,80,6,115,0,110,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,176,0,0,0,36,0,32,0,4,0,4,
+0,0,0,13,0,33,0,63,0,160,24,3,24,5,32,15,32,38,37,204,48,2,48,17,48,21,48,
+27,168,119,254,0,254,255,255,255,0,0,0,0,0,13,0,32,0,63,0,160,24,1,24,5,32,
+11,32,37,37,204,48,1,48,7,48,20,48,22,168,64,254,0,254,255,255,255,0,1,255,
+245,255,227,255,198,255,99,0,0,232,3,0,0,225,65,219,176,208,10,209,97,209,
+80,209,93,87,205,2,69,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,28,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,125,0,6,0,7,1,121,0,9,0,10,1,122,1,123,0,
+0,0,21,0,21,0,21,0,21,0,51,0,104,0,127,0,164,0,233,0,246,1,19,1,36,1,75,1,
+112,1,158,1,203,1,240,2,22,2,73,2,110,2,138,2,185,2,238,3,19,3,74,3,113,3,
+154,3,211,4,15,4,81,4,133,4,174,4,237,5,48,5,85,5,123,5,167,5,202,5,243,6,
+25,6,76,6,131,6,193,6,248,7,65,7,100,7,136,7,181,7,237,8,70,8,115,8,146,8,
+185,8,228,9,19,9,72,9,111,9,166,9,220,10,3,10,56,10,168,10,194,10,213,10,
+254,11,61,11,163,11,176,11,188,12,118,12,127,12,174,12,183,12,245,12,254,
+13,7,13,71,13,139,13,148,13,199,13,208,14,5,14,14,14,70,14,122,14,173,14,
+213,14,222,14,231,15,10,15,40,15,70,15,110,15,140,15,186,15,198,16,2,16,11,
+16,74,16,137,16,174,16,183,16,192,16,201,16,246,17,47,17,56,17,65,17,74,17,
+121,17,130,17,139,17,191,17,200,17,209,17,218,18,4,18,40,18,95,18,147,18,
+207,18,216,19,7,19,16,19,82,19,91,19,139,19,151,19,160,19,210,19,219,20,30,
+20,97,20,109,20,118,20,131,20,140,20,205,20,214,21,24,21,33,21,42,21,56,21,
+71,21,80,21,93,21,133,21,145,21,154,21,167,21,176,21,231,21,243,21,252,22,
+9,22,18,22,58,22,70,22,79,22,92,22,101,22,141,22,153,22,162,22,175,22,184,
+22,237,22,249,23,2,23,15,23,24,23,66,23,78,23,87,23,100,23,109,23,153,23,
+165,23,174,23,187,23,196,23,240,23,252,24,5,24,18,24,27,24,66,24,78,24,87,
+24,100,24,109,24,150,24,162,24,171,24,184,24,193,24,231,24,243,24,252,25,
+9,25,18,25,52,25,64,25,73,25,86,25,95,25,130,25,142,25,151,25,164,25,173,
+25,185,25,194,25,207,25,216,26,3,26,15,26,24,26,37,26,46,26,89,26,101,26,
+110,26,123,26,132,26,198,26,210,26,219,26,232,26,241,27,26,27,34,27,46,27,
+137,27,149,27,158,27,171,27,180,27,225,27,234,28,24,28,33,28,42,28,51,28,
+103,28,150,28,159,28,168,28,177,28,233,28,245,28,254,29,11,29,20,29,83,29,
+149,29,212,30,15,30,24,30,37,30,46,30,58,30,88,30,124,30,154,30,196,30,208,
+30,217,30,230,30,239,31,39,31,104,31,113,31,122,31,131,31,140,31,149,31,158,
+31,210,32,6,32,57,32,105,32,113,32,122,32,131,32,140,32,167,32,198,32,207,
+32,216,32,225,32,233,32,242,32,251,33,32,33,44,33,53,33,66,33,79,33,124,33,
+138,33,147,33,162,33,171,33,180,33,195,33,204,34,62,34,71,34,83,34,96,34,
+105,34,164,34,173,34,185,34,198,34,207,35,7,35,67,35,76,35,85,35,138,35,194,
+35,203,35,253,36,25,36,53,36,62,36,71,36,80,36,131,36,188,36,197,36,206,36,
+215,36,223,36,235,37,35,37,91,37,146,37,154,37,195,37,208,37,217,38,14,38,
+73,38,133,38,187,38,243,39,59,39,71,39,106,39,141,39,183,39,227,40,19,40,
+41,40,62,40,99,40,152,40,205,40,224,40,243,41,19,41,50,41,66,41,81,41,107,
+41,132,41,153,41,174,41,210,41,246,42,18,42,47,42,72,42,97,42,97,42,121,42,
+144,42,235,43,48,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,
+33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,2,
+0,147,255,227,1,145,5,182,0,3,0,15,0,0,1,35,3,51,2,22,21,20,6,35,34,38,53,
+52,54,51,1,78,117,51,219,58,74,75,52,53,74,73,54,1,156,4,26,251,66,63,74,
+73,67,67,73,74,63,0,0,2,0,25,255,227,3,68,5,203,0,24,0,35,0,0,1,53,52,62,
+2,53,52,38,35,34,6,7,39,54,51,50,22,21,20,14,2,21,21,6,22,21,20,6,35,34,38,
+53,52,51,1,31,82,223,72,127,121,104,155,69,63,190,213,197,211,90,230,86,11,
+73,74,51,56,71,127,1,156,55,124,148,188,116,77,99,106,53,33,143,101,193,166,
+102,165,186,120,105,34,164,63,74,74,66,66,74,137,0,0,1,2,20,1,233,3,18,2,
+254,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,2,200,74,75,54,53,72,71,54,
+2,254,62,75,73,67,66,74,75,62,0,0,2,2,20,1,233,5,27,2,254,0,11,0,22,0,0,0,
+22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,51,2,200,74,
+75,54,53,72,71,54,2,63,75,76,53,54,71,125,2,254,62,75,73,67,66,74,75,62,62,
+75,73,67,66,74,137,0,0,4,0,147,0,80,4,20,4,152,0,11,0,22,0,34,0,46,0,0,0,
+22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,51,0,22,21,20,
+6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,71,74,75,54,53,
+72,71,54,2,186,74,75,54,53,71,124,254,245,75,76,53,53,72,71,54,54,75,76,53,
+53,72,71,54,2,254,62,75,73,67,66,74,75,62,62,75,73,67,66,74,137,254,102,62,
+75,73,66,66,73,75,62,3,52,63,75,72,67,66,73,75,63,0,1,255,220,0,0,0,36,5,
+204,0,3,0,0,19,17,35,17,36,72,5,204,250,52,5,204,0,1,255,37,0,0,0,219,5,204,
+0,14,0,0,51,35,17,7,39,55,39,55,23,55,23,7,23,7,39,36,72,134,49,171,171,49,
+170,170,49,171,171,49,134,4,161,136,49,169,168,49,171,171,49,168,169,49,136,
+0,0,1,2,20,1,172,3,170,3,80,0,5,0,0,1,6,7,39,54,55,3,170,204,113,89,141,140,
+2,195,147,132,80,200,140,0,2,2,20,1,109,4,37,3,125,0,11,0,23,0,0,0,22,21,
+20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,3,139,154,155,
+109,110,155,155,110,67,94,94,67,68,92,92,68,3,125,155,109,112,152,151,113,
+110,154,254,86,92,68,67,94,94,67,68,92,0,0,1,0,143,255,141,4,139,5,92,0,20,
+0,0,37,33,17,35,17,33,21,33,17,33,21,33,17,33,32,5,21,38,39,17,35,2,121,254,
+174,152,3,252,252,156,3,100,252,156,1,22,1,75,1,3,174,205,151,168,254,229,
+5,207,155,254,143,156,254,144,107,168,82,25,254,241,0,2,0,143,255,141,5,76,
+5,92,0,17,0,24,0,0,37,22,23,33,17,51,17,33,17,33,2,21,20,19,33,17,33,17,1,
+17,33,38,53,52,55,5,39,14,23,251,67,152,1,10,2,180,61,61,253,76,254,246,1,
+162,1,100,29,29,41,76,80,5,207,254,60,1,196,254,235,253,254,254,235,1,197,
+253,45,4,152,253,18,166,209,209,166,0,0,2,0,143,255,141,5,76,5,92,0,17,0,
+24,0,0,5,17,33,17,35,17,33,6,7,33,17,33,17,33,2,21,20,19,37,33,38,53,52,55,
+33,2,49,254,246,152,4,189,23,14,252,0,1,10,2,180,61,61,253,228,1,100,29,29,
+254,156,115,1,197,254,59,5,207,80,75,253,45,1,196,254,235,253,254,254,235,
+156,166,209,209,166,0,1,0,143,255,141,5,147,5,92,0,19,0,0,5,17,33,17,35,17,
+33,17,33,38,17,52,18,55,51,6,2,21,16,19,2,131,254,164,152,2,140,1,102,41,
+72,78,165,93,70,79,115,5,52,250,204,5,207,250,205,219,1,25,252,1,143,180,
+212,254,144,251,254,146,254,222,0,2,0,143,255,141,5,147,5,92,0,11,0,18,0,
+0,5,17,33,17,35,17,33,6,2,21,16,19,3,33,17,33,38,17,16,2,131,254,164,152,
+5,4,93,70,79,141,254,105,1,102,41,115,5,52,250,204,5,207,212,254,144,251,
+254,146,254,222,5,52,251,104,219,1,25,1,137,0,0,3,0,143,255,141,5,76,5,92,
+0,15,0,20,0,25,0,0,23,17,51,17,33,17,33,6,2,21,16,19,33,17,33,17,1,33,18,
+55,33,1,38,17,33,17,143,152,1,10,3,27,96,68,80,253,57,254,246,1,162,1,75,
+18,68,254,95,1,114,43,254,185,115,5,207,253,103,2,153,219,254,145,245,254,
+150,254,218,2,154,253,102,3,54,1,34,220,251,104,240,1,14,254,2,0,0,1,0,143,
+255,141,5,147,5,92,0,19,0,0,19,51,17,33,17,51,17,33,38,17,52,18,55,51,6,2,
+21,16,19,33,143,152,1,92,152,1,102,41,72,78,165,93,70,79,251,80,5,92,250,
+205,5,51,250,205,219,1,25,252,1,143,180,212,254,144,251,254,146,254,222,0,
+0,1,0,143,255,141,4,98,5,92,0,13,0,0,1,33,17,33,21,33,17,33,21,33,17,33,21,
+33,2,102,254,193,3,59,252,45,3,211,254,156,1,100,254,4,4,193,251,104,156,
+5,207,155,254,2,156,0,0,1,0,143,255,141,5,59,5,92,0,29,0,0,19,51,17,33,38,
+38,53,52,54,51,50,23,55,51,6,7,38,35,34,6,21,20,23,33,21,33,17,33,21,33,143,
+152,1,12,47,41,209,166,146,112,59,172,86,94,144,165,92,123,104,2,35,252,33,
+3,223,251,137,5,92,253,41,64,139,98,169,218,73,112,154,182,133,113,110,178,
+123,156,254,64,156,0,0,3,0,143,255,141,5,106,5,92,0,14,0,22,0,27,0,0,5,34,
+36,39,21,36,39,21,35,17,33,6,2,21,16,37,22,23,38,17,16,19,33,1,22,23,17,33,
+5,23,154,254,232,95,254,182,149,152,4,219,93,70,254,63,121,213,37,90,254,
+125,254,33,117,211,254,184,115,99,94,172,70,161,252,5,207,212,254,144,251,
+254,150,95,161,47,204,1,15,1,137,1,27,252,147,172,64,4,89,0,0,1,0,143,255,
+141,3,201,5,92,0,20,0,0,5,34,36,39,21,35,17,51,17,22,23,38,17,52,18,55,51,
+6,2,21,16,3,117,180,254,201,99,152,152,143,252,37,72,78,166,96,68,115,123,
+109,232,5,207,251,223,198,51,215,1,4,252,1,143,180,219,254,145,245,254,150,
+0,2,0,143,255,129,4,207,5,92,0,21,0,32,0,0,1,4,7,4,17,20,6,35,34,38,53,52,
+0,37,53,6,35,33,17,35,17,33,1,6,21,20,22,51,50,54,53,52,38,4,207,254,242,
+150,1,164,199,184,178,209,1,29,1,2,69,126,253,254,152,4,64,254,4,102,120,
+107,113,110,162,4,193,189,192,164,254,139,194,232,236,204,243,1,219,183,9,
+6,250,204,5,207,253,101,187,205,135,141,139,127,125,211,0,1,0,143,255,141,
+5,158,5,92,0,20,0,0,5,17,33,17,35,17,33,17,33,38,17,16,19,33,53,33,6,2,21,
+16,19,2,131,254,164,152,2,140,1,112,41,90,251,211,5,15,96,68,80,115,3,58,
+252,198,3,213,252,199,229,1,15,1,137,1,27,155,219,254,145,245,254,150,254,
+218,0,2,0,143,255,141,5,158,5,92,0,11,0,20,0,0,5,17,33,17,35,17,33,6,2,21,
+16,19,37,33,38,17,16,19,33,17,33,2,131,254,164,152,5,15,96,68,80,253,209,
+1,112,41,90,252,107,1,244,115,2,154,253,102,5,207,219,254,145,245,254,150,
+254,218,156,229,1,15,1,137,1,27,254,2,0,2,0,143,255,92,5,158,5,92,0,20,0,
+37,0,0,1,6,2,21,20,22,21,20,6,35,34,38,53,55,52,38,35,35,17,35,17,5,33,17,
+51,50,22,21,7,20,22,51,50,53,52,38,53,16,5,158,90,70,33,164,172,172,164,8,
+123,123,106,152,4,45,252,107,106,199,199,8,93,91,184,33,5,92,202,254,166,
+222,98,205,86,178,199,201,168,131,102,113,253,102,5,207,155,254,2,195,176,
+131,100,105,213,86,205,98,1,87,0,2,0,143,255,129,4,207,5,92,0,29,0,39,0,0,
+5,35,17,51,50,23,54,55,53,6,35,33,53,33,21,6,7,22,18,21,20,6,35,34,38,53,
+52,55,38,35,5,6,21,20,22,51,50,54,53,16,1,39,152,168,216,178,126,173,69,126,
+253,102,4,64,245,132,174,203,197,166,170,196,121,135,193,1,219,108,108,98,
+103,100,115,4,35,49,188,131,9,6,155,155,191,184,80,254,227,198,193,213,223,
+197,227,236,32,79,203,213,125,131,129,117,1,41,0,2,0,143,255,141,5,27,5,92,
+0,33,0,40,0,0,1,21,33,21,22,18,21,16,0,33,53,32,0,53,52,38,35,34,6,21,20,
+51,50,55,23,6,35,34,38,39,35,17,35,17,1,54,54,55,53,33,17,5,6,254,184,156,
+193,254,118,254,164,1,20,1,50,151,130,121,122,170,51,30,56,55,82,121,168,
+29,180,152,1,66,13,183,146,254,0,5,92,155,177,30,254,251,196,254,208,254,
+148,156,1,10,246,149,183,131,95,180,25,154,35,121,115,253,102,5,207,253,103,
+137,185,15,173,254,2,0,0,1,0,143,255,141,4,160,5,92,0,34,0,0,1,33,6,21,20,
+23,51,50,22,21,20,4,33,35,53,51,50,54,53,52,35,35,38,53,52,54,55,53,6,35,
+33,17,35,17,33,4,139,254,236,209,27,83,204,192,254,239,254,242,139,139,201,
+182,236,190,76,82,88,45,53,254,213,152,3,252,4,193,190,206,71,43,202,169,
+211,240,156,164,131,215,115,149,117,188,94,7,4,250,204,5,207,0,0,2,0,143,
+255,141,5,178,5,92,0,14,0,21,0,0,5,35,17,33,17,35,17,33,17,35,17,33,6,2,21,
+5,33,17,33,18,55,33,5,14,151,254,164,152,254,164,152,5,35,95,69,252,25,1,
+92,1,246,14,74,252,86,115,2,154,253,102,1,11,254,245,5,207,212,254,147,242,
+246,1,144,1,26,228,0,2,0,143,255,141,5,195,5,92,0,25,0,35,0,0,19,51,17,33,
+17,51,17,54,36,51,2,17,16,19,34,36,39,17,35,17,33,17,33,22,23,33,1,6,4,7,
+22,4,23,38,53,52,143,152,1,2,152,129,1,128,179,70,70,181,254,123,122,152,
+254,254,4,119,14,23,250,204,4,35,139,254,250,96,96,1,6,139,26,5,92,254,27,
+1,229,254,154,161,197,254,246,254,215,254,215,254,246,202,154,254,156,1,229,
+253,78,76,80,5,13,41,195,133,135,195,41,173,198,200,0,2,0,143,255,141,5,20,
+5,92,0,31,0,43,0,0,1,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,35,17,
+33,21,33,17,33,50,22,23,54,54,51,51,21,5,6,6,21,20,22,51,50,54,53,52,38,4,
+254,171,99,106,121,197,170,170,196,119,108,103,167,164,3,237,251,123,1,74,
+119,190,86,86,191,119,36,254,80,104,102,108,98,99,108,102,4,193,39,103,254,
+242,154,192,217,217,192,154,1,14,103,39,251,104,156,5,207,41,49,49,41,155,
+127,91,225,123,123,122,122,123,123,225,0,0,1,0,143,255,141,5,147,5,92,0,18,
+0,0,5,2,17,16,19,33,17,35,17,33,17,35,17,33,6,2,21,16,19,4,166,78,90,254,
+105,152,254,164,152,5,4,93,70,79,115,1,34,1,110,1,137,1,27,250,204,5,52,250,
+204,5,207,212,254,144,251,254,146,254,222,0,0,1,0,143,255,141,5,154,5,92,
+0,20,0,0,1,6,21,20,23,33,17,33,17,33,22,23,33,17,33,17,33,38,53,16,55,5,55,
+61,61,253,76,254,164,4,78,14,23,250,245,2,140,1,100,29,60,5,92,255,236,235,
+255,3,58,251,104,76,80,5,207,252,199,147,187,1,16,219,0,1,0,143,255,141,4,
+147,5,92,0,26,0,0,23,53,33,50,54,53,52,38,35,33,53,33,50,23,18,55,33,53,33,
+0,3,22,22,21,20,6,35,143,1,187,135,158,157,136,254,69,1,187,34,27,66,155,
+253,43,4,4,254,203,65,112,129,250,202,115,156,131,123,122,134,156,5,1,10,
+249,155,254,136,254,182,48,192,131,186,224,0,1,0,143,255,141,3,201,5,92,0,
+17,0,0,5,2,17,33,17,35,17,51,17,33,18,19,51,6,2,21,16,19,2,219,78,254,154,
+152,152,1,106,22,124,166,96,68,80,115,1,34,1,120,253,102,5,207,253,103,1,
+129,1,24,219,254,145,245,254,150,254,218,0,1,0,143,255,141,5,145,5,92,0,22,
+0,0,19,33,17,33,38,53,52,55,33,53,33,2,21,16,19,33,17,33,17,33,22,23,33,143,
+2,140,1,100,29,29,252,16,4,168,61,61,253,76,254,164,4,70,14,22,250,254,3,
+166,254,57,162,205,209,162,155,254,240,254,255,0,254,246,1,198,253,31,76,
+80,0,1,0,143,255,141,5,154,5,92,0,20,0,0,1,17,33,17,33,6,21,20,23,35,38,17,
+52,55,33,17,33,17,33,6,7,1,39,1,92,2,180,61,61,153,60,29,254,156,253,116,
+5,11,23,14,4,193,251,104,3,57,253,236,237,255,219,1,17,185,149,252,198,5,
+207,80,75,0,0,1,0,143,255,141,4,68,5,92,0,26,0,0,1,4,3,38,39,17,35,17,51,
+17,54,0,55,53,6,35,33,53,33,21,0,1,22,23,54,0,55,4,68,254,233,250,145,123,
+152,152,113,1,48,138,67,128,254,0,3,181,254,28,254,199,126,120,114,1,42,139,
+2,27,249,254,189,104,115,254,211,4,9,254,247,141,1,58,106,9,6,155,155,254,
+124,254,78,131,88,143,1,44,118,0,0,1,0,143,255,141,5,154,5,92,0,33,0,0,1,
+6,6,7,38,35,34,6,21,20,22,23,2,7,38,39,17,35,17,51,17,22,23,54,55,38,38,53,
+52,54,51,50,23,55,5,154,64,101,69,151,158,115,141,144,200,161,103,219,201,
+152,152,167,189,65,54,135,160,234,182,149,113,109,5,92,114,192,132,151,124,
+117,104,169,88,254,223,219,107,147,254,168,5,207,252,70,137,101,139,93,71,
+207,154,178,227,84,207,0,0,1,0,143,255,141,4,100,5,92,0,40,0,0,19,51,21,54,
+36,55,53,6,35,33,53,33,21,0,1,22,23,54,54,51,50,22,21,20,6,35,33,53,33,50,
+54,53,52,38,35,34,7,38,39,21,35,143,152,113,1,43,131,68,127,254,12,3,197,
+254,53,254,172,128,46,47,150,92,155,197,231,193,253,211,2,45,129,136,96,97,
+168,88,141,80,152,3,195,160,106,227,78,9,6,155,155,254,247,254,172,118,35,
+71,78,202,152,171,198,156,113,100,82,108,194,105,71,156,0,1,0,143,255,129,
+4,207,5,92,0,33,0,0,1,4,0,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,
+35,34,38,53,52,0,37,53,6,35,33,17,35,17,33,4,207,254,202,254,212,120,107,
+113,110,81,101,82,129,131,199,184,178,209,1,29,1,2,69,126,253,254,152,4,64,
+4,193,216,254,73,249,135,141,139,127,91,144,46,131,62,213,141,194,232,236,
+204,243,1,219,183,9,6,250,204,5,207,0,0,1,0,143,255,141,6,106,5,106,0,45,
+0,0,1,17,51,39,53,16,0,51,32,0,17,16,0,33,53,32,0,17,52,2,35,34,2,21,20,22,
+51,50,54,53,52,38,39,55,22,21,20,6,35,34,38,39,35,17,35,17,1,39,199,2,1,50,
+249,1,9,1,74,254,65,254,108,1,76,1,104,234,202,183,213,125,98,87,106,45,41,
+129,117,196,157,122,183,45,229,152,5,92,253,103,30,31,1,17,1,89,254,118,254,
+206,254,129,254,94,156,1,82,1,51,240,1,41,255,0,199,162,151,104,94,58,116,
+41,101,121,195,155,207,135,125,253,102,5,207,0,0,1,0,143,255,141,5,72,5,92,
+0,17,0,0,1,0,3,35,17,33,17,35,17,33,21,33,17,20,7,51,18,19,5,55,254,226,156,
+250,254,164,152,4,185,253,211,7,9,120,228,3,23,254,130,253,244,5,52,250,204,
+5,207,155,252,83,154,71,1,141,1,87,0,1,0,143,255,141,3,98,5,92,0,16,0,0,1,
+17,54,18,55,51,2,1,0,19,35,38,2,39,17,35,17,1,39,139,193,71,168,175,254,165,
+1,92,174,168,71,193,139,152,5,92,253,178,136,1,30,168,254,71,254,210,254,
+208,254,72,166,1,31,135,253,180,5,207,0,2,0,143,255,141,4,160,5,92,0,11,0,
+22,0,0,1,0,3,34,36,39,17,33,21,33,17,33,1,22,22,23,54,18,55,53,6,35,33,4,
+160,254,245,90,165,254,251,106,3,121,251,239,4,17,252,135,98,195,129,33,147,
+104,90,120,254,16,4,193,254,211,254,85,48,59,253,213,156,5,207,253,164,66,
+51,4,144,1,45,120,9,4,0,3,0,143,255,141,5,139,5,92,0,17,0,24,0,29,0,0,19,
+33,6,2,21,20,23,38,38,39,21,36,39,17,33,22,23,33,1,22,23,53,16,19,33,1,22,
+23,17,33,143,4,252,93,66,14,172,250,78,254,185,152,4,12,15,22,251,55,2,119,
+124,210,86,254,92,254,33,117,211,254,184,5,92,207,254,146,238,122,103,2,102,
+70,154,65,165,253,223,76,80,3,47,146,42,49,1,125,1,19,254,86,173,63,2,150,
+0,2,0,143,255,141,7,188,5,92,0,42,0,54,0,0,5,38,2,2,38,38,35,34,6,21,20,22,
+23,2,7,38,39,17,35,17,51,17,22,23,54,55,38,38,53,52,54,51,50,23,54,36,51,
+51,2,2,17,20,23,39,38,53,16,18,55,34,4,7,22,18,19,5,195,93,153,102,102,108,
+88,84,110,144,200,161,103,219,201,152,152,167,189,65,54,135,160,204,150,132,
+96,129,1,57,244,237,146,128,18,161,9,91,94,212,254,243,97,91,163,139,115,
+151,1,126,1,119,197,75,115,106,104,169,88,254,223,219,107,147,254,168,5,207,
+252,70,137,101,139,93,71,207,154,165,220,70,108,105,254,227,253,199,254,166,
+175,112,170,61,56,1,49,1,250,234,85,85,140,253,187,254,241,0,0,2,0,143,255,
+141,4,160,5,92,0,11,0,22,0,0,5,33,17,33,21,33,17,54,36,51,18,1,1,6,6,7,17,
+33,50,23,53,38,2,4,160,251,239,4,17,252,135,106,1,5,165,91,1,10,254,45,129,
+195,98,1,240,120,90,104,147,115,5,207,155,253,213,57,49,254,83,254,214,2,
+57,6,51,66,254,66,4,8,119,1,47,0,0,1,0,143,255,141,3,160,5,92,0,15,0,0,19,
+51,17,33,38,17,52,18,55,51,6,2,21,16,19,33,143,152,1,104,43,72,78,166,96,
+68,80,253,67,5,92,250,205,220,1,24,252,1,143,180,219,254,145,245,254,150,
+254,218,0,2,0,82,255,141,4,82,5,92,0,7,0,15,0,0,5,2,2,3,33,2,2,3,1,18,18,
+19,51,18,18,19,1,221,182,204,9,4,0,167,198,34,254,47,26,158,137,8,27,120,
+134,115,1,55,3,17,1,135,254,226,253,38,254,41,5,52,254,182,253,196,254,236,
+1,65,2,18,1,71,0,1,0,123,255,141,3,37,5,92,0,20,0,0,1,18,17,16,3,54,18,17,
+16,3,51,18,17,16,0,33,35,18,17,16,3,1,23,55,39,185,173,75,151,76,254,230,
+254,212,96,55,59,5,92,254,182,254,107,254,191,254,237,15,1,95,1,76,1,75,1,
+46,254,214,254,171,254,81,254,95,1,82,1,158,1,137,1,86,0,1,0,143,255,141,
+5,59,5,92,0,29,0,0,23,17,33,21,33,17,33,21,33,6,21,20,22,51,50,55,22,23,35,
+39,6,35,34,38,53,52,54,55,33,17,143,4,119,252,33,3,223,253,221,104,123,92,
+163,146,94,86,172,61,106,150,163,212,41,47,254,244,115,5,207,155,254,63,156,
+123,178,110,113,133,182,154,113,74,216,171,99,139,63,253,41,0,0,3,0,143,255,
+141,5,106,5,92,0,14,0,22,0,27,0,0,1,2,17,20,18,23,33,17,51,21,54,37,21,54,
+36,7,6,7,17,33,2,17,16,37,6,7,17,33,5,23,80,69,94,251,37,152,150,1,73,92,
+1,25,39,212,122,1,131,90,254,64,206,122,1,72,5,92,254,218,254,151,250,254,
+145,215,5,207,252,163,69,172,92,100,182,45,164,252,84,1,25,1,139,1,11,167,
+59,177,252,150,0,1,0,143,255,141,3,201,5,92,0,20,0,0,1,2,17,20,18,23,35,38,
+2,53,16,55,6,7,17,35,17,51,21,54,36,3,117,80,66,98,166,78,72,37,252,143,152,
+152,99,1,52,5,92,254,218,254,151,245,254,150,225,181,1,143,252,1,1,216,53,
+197,251,225,5,207,233,108,125,0,0,2,0,143,255,141,4,207,5,104,0,21,0,32,0,
+0,5,33,17,51,17,33,50,23,53,36,0,53,52,54,51,50,22,21,16,5,22,5,1,54,54,53,
+52,38,35,34,6,21,20,4,207,251,192,152,2,2,126,69,254,254,254,227,209,178,
+180,203,254,92,150,1,14,254,4,186,162,110,113,107,120,115,5,207,250,205,6,
+8,183,1,219,243,205,235,229,197,254,138,164,191,188,2,0,65,211,125,127,140,
+142,135,209,0,0,1,0,143,255,141,4,147,5,92,0,35,0,0,19,22,51,51,18,55,33,
+53,33,6,2,7,22,22,21,20,6,35,35,34,7,53,54,54,51,51,50,54,53,52,38,35,35,
+34,38,39,143,164,191,149,72,149,253,43,4,4,144,187,41,110,129,207,180,153,
+192,163,70,186,99,153,108,120,120,108,153,99,186,70,3,61,122,1,22,232,155,
+176,254,176,176,35,170,123,150,198,123,168,53,58,99,93,94,101,57,54,0,1,0,
+143,255,141,5,154,5,92,0,20,0,0,1,17,37,17,33,6,21,20,23,35,38,17,52,55,33,
+17,1,17,33,6,7,1,39,1,92,2,180,61,61,153,60,29,254,156,253,116,5,11,23,14,
+4,193,251,200,182,2,35,253,236,237,255,219,1,17,185,149,254,26,254,172,5,
+207,80,75,0,1,0,143,255,141,5,154,5,92,0,31,0,0,1,38,0,35,34,6,21,20,22,23,
+2,7,38,39,17,35,17,51,17,22,23,54,55,38,38,53,52,54,51,50,4,23,5,154,64,254,
+201,168,115,141,144,200,161,103,219,201,152,152,167,189,65,54,135,160,234,
+182,162,1,24,101,2,217,63,1,37,124,117,104,169,88,254,223,219,107,147,254,
+168,5,207,252,70,137,101,139,93,71,207,154,178,227,196,103,0,2,0,143,255,
+141,9,12,5,92,0,57,0,69,0,0,1,38,38,35,34,6,21,20,22,5,2,7,36,37,17,35,17,
+51,17,22,4,23,54,55,38,2,53,52,54,51,50,23,54,54,51,50,22,23,54,36,51,51,
+2,2,17,20,23,35,38,2,2,38,35,34,6,21,20,23,1,38,53,16,18,55,6,6,7,22,18,19,
+3,225,40,107,96,68,96,235,1,25,161,103,254,242,254,239,152,152,88,1,34,101,
+52,65,234,231,179,145,164,83,29,129,94,66,108,45,119,1,21,219,233,146,128,
+18,235,118,164,89,94,111,59,76,27,2,245,8,90,95,170,252,105,54,126,164,3,
+47,144,126,86,81,147,238,111,254,223,219,124,191,254,168,5,207,252,70,67,
+185,47,110,119,103,1,24,187,140,191,112,86,88,43,54,80,78,254,227,253,199,
+254,166,175,112,169,1,165,1,203,213,90,66,90,86,253,8,54,63,1,49,1,250,234,
+3,55,76,115,253,145,254,222,0,0,1,0,143,255,141,3,8,5,92,0,10,0,0,1,2,2,17,
+35,16,18,19,33,53,33,3,8,252,229,152,206,233,254,73,2,121,4,193,254,200,253,
+113,254,147,1,123,2,129,1,56,155,0,0,1,0,143,255,141,2,217,5,92,0,7,0,0,1,
+33,21,33,17,35,17,51,1,39,1,178,254,78,152,152,2,195,156,253,102,5,207,0,
+0,2,0,82,255,141,3,242,5,92,0,10,0,21,0,0,5,35,54,18,53,16,1,51,0,17,16,1,
+55,54,51,50,21,20,35,34,39,39,2,201,195,156,172,254,184,195,1,41,252,96,199,
+85,64,168,168,67,82,199,115,142,1,108,238,1,191,1,40,254,215,254,66,254,70,
+1,253,72,29,168,168,28,72,0,0,2,0,92,255,141,5,12,5,92,0,24,0,36,0,0,5,0,
+18,53,52,38,35,34,6,21,20,22,23,7,36,17,52,54,51,50,18,21,20,2,1,37,54,18,
+53,16,39,51,22,22,21,16,1,1,10,1,37,242,152,137,119,141,110,99,82,254,225,
+227,195,202,245,221,254,235,1,39,207,168,150,172,62,75,254,150,115,1,89,1,
+175,191,166,190,143,129,111,143,47,141,137,1,43,198,244,254,231,233,197,254,
+61,254,187,99,243,1,135,220,1,12,176,78,229,137,254,60,254,110,0,2,0,102,
+255,121,4,94,5,113,0,48,0,71,0,0,19,38,38,53,52,54,51,50,22,21,20,7,22,22,
+21,20,2,7,35,54,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,51,23,54,53,
+52,38,35,34,6,21,20,22,23,1,54,54,53,52,38,39,54,54,53,52,39,51,22,21,20,
+6,7,22,21,20,6,7,207,53,52,189,149,152,194,133,66,67,141,151,197,200,130,
+97,90,82,96,60,67,82,205,189,149,66,121,98,89,82,96,33,31,1,145,109,122,73,
+76,76,73,149,172,137,77,60,137,121,98,3,74,51,111,71,142,176,189,155,179,
+137,47,154,94,139,254,245,167,230,222,105,104,107,84,76,55,76,33,139,90,213,
+154,170,4,96,143,93,104,84,74,41,59,29,252,14,109,235,148,100,150,59,62,143,
+96,183,112,119,176,98,144,59,119,190,154,235,103,0,0,1,0,184,255,141,1,98,
+5,92,0,3,0,0,19,51,17,35,184,170,170,5,92,250,49,0,255,255,0,184,255,141,
+2,217,5,92,16,34,0,67,0,0,16,3,0,67,1,119,0,0,0,19,0,102,0,0,6,123,6,20,0,
+28,0,39,0,49,0,55,0,61,0,67,0,73,0,77,0,81,0,85,0,89,0,93,0,97,0,101,0,105,
+0,109,0,113,0,117,0,121,0,0,0,39,53,22,51,50,53,52,38,38,53,52,54,51,50,23,
+7,38,35,34,6,21,20,22,22,21,20,6,35,1,51,19,22,23,54,54,19,51,3,35,1,35,17,
+52,55,6,7,39,55,51,1,53,51,21,51,21,33,53,51,53,51,21,1,21,35,53,51,21,5,
+53,35,53,51,21,1,53,51,21,3,53,51,21,1,51,21,35,1,53,51,21,1,51,21,35,17,
+51,21,35,1,51,21,35,1,51,21,35,1,51,21,35,1,53,51,21,3,53,51,21,1,53,51,21,
+4,25,58,83,81,123,187,92,107,86,91,71,29,71,64,47,49,165,111,116,103,252,
+192,91,106,44,15,8,20,138,90,210,91,1,158,88,4,20,121,47,198,74,252,182,93,
+153,4,41,154,92,250,72,93,246,4,195,154,246,251,51,246,246,246,253,194,93,
+93,2,144,246,2,51,92,92,92,92,250,71,93,93,5,185,92,92,250,71,93,93,3,215,
+246,246,246,253,195,246,3,49,35,88,43,74,62,54,81,75,68,73,41,77,39,33,29,
+63,49,69,83,77,85,2,33,254,248,104,56,25,56,1,87,253,242,253,127,1,51,67,
+58,21,98,59,154,253,47,246,154,92,92,154,246,5,184,153,245,92,153,153,92,
+245,250,225,92,92,5,184,92,92,253,205,246,253,113,92,92,2,61,245,3,133,246,
+254,102,245,2,61,246,2,62,246,1,225,92,92,250,72,92,92,5,184,92,92,255,255,
+0,2,255,141,3,183,5,92,16,3,0,40,255,115,0,0,0,1,0,143,255,141,5,131,5,92,
+0,29,0,0,23,53,33,50,54,53,52,38,35,33,53,33,50,23,18,55,33,53,33,21,33,6,
+2,7,22,22,21,20,6,35,143,1,187,135,158,157,136,254,69,1,187,34,27,66,155,
+253,43,4,244,254,154,119,113,24,112,129,250,202,115,156,131,123,122,134,156,
+5,1,10,249,155,155,168,254,247,118,48,192,131,186,224,255,255,0,2,255,141,
+4,246,5,92,16,3,0,71,255,115,0,0,0,2,0,143,255,129,6,63,5,92,0,30,0,40,0,
+0,5,35,17,51,50,23,54,55,53,6,35,33,53,33,21,33,6,7,22,18,21,20,6,35,34,38,
+53,52,55,38,35,5,6,21,20,22,51,50,54,53,16,1,39,152,168,216,178,126,173,69,
+126,253,102,5,176,254,144,245,132,174,203,197,166,170,196,121,135,193,1,219,
+108,108,98,103,100,115,4,35,49,188,131,9,6,155,155,191,184,80,254,227,198,
+193,213,223,197,227,236,32,79,203,213,125,131,129,117,1,41,0,255,255,0,2,
+255,129,5,178,5,92,16,3,0,73,255,115,0,0,255,255,0,2,255,141,3,215,5,92,16,
+3,0,42,255,115,0,0,0,1,0,143,255,141,5,197,5,92,0,41,0,0,19,51,21,54,36,55,
+53,6,35,33,53,33,21,33,0,1,22,23,54,54,51,50,22,21,20,6,35,33,53,33,50,54,
+53,52,38,35,34,7,38,39,21,35,143,152,113,1,43,131,68,127,254,12,5,54,254,
+143,254,53,254,172,128,46,47,150,92,155,197,231,193,253,211,2,45,129,136,
+96,97,168,88,141,80,152,3,195,160,106,227,78,9,6,155,155,254,247,254,172,
+118,35,71,78,202,152,171,198,156,113,100,82,108,194,105,71,156,0,0,1,0,143,
+255,141,5,74,5,92,0,43,0,0,1,22,22,21,20,6,35,33,53,33,50,54,53,52,38,35,
+34,7,38,39,21,35,17,51,21,54,36,55,53,6,35,33,53,33,21,0,1,22,23,54,33,33,
+21,33,3,145,99,112,231,193,253,211,2,45,129,136,96,97,168,88,141,80,152,152,
+113,1,43,131,68,127,254,12,3,197,254,53,254,172,103,73,175,1,161,1,21,254,
+71,2,31,21,162,106,171,198,156,113,100,82,108,194,105,71,156,2,181,160,106,
+227,78,9,6,155,155,254,247,254,172,103,50,248,156,0,255,255,0,2,255,141,5,
+56,5,92,16,3,0,76,255,115,0,0,0,1,0,143,255,141,5,180,5,92,0,27,0,0,19,51,
+17,54,0,55,53,6,35,33,53,33,21,33,0,1,22,23,54,0,55,21,4,3,38,39,17,35,143,
+152,113,1,48,138,67,128,254,0,5,37,254,144,254,28,254,199,126,120,114,1,42,
+139,254,233,250,145,123,152,3,150,254,247,141,1,58,106,9,6,155,155,254,124,
+254,78,131,88,143,1,44,118,198,249,254,189,104,115,254,211,255,255,0,2,255,
+141,5,39,5,92,16,3,0,79,255,115,0,0,0,1,0,143,255,141,5,16,5,92,0,30,0,0,
+5,38,39,17,35,17,51,17,54,0,55,53,6,35,33,53,33,21,0,1,22,23,18,36,51,51,
+21,35,34,6,6,2,51,145,123,152,152,113,1,48,138,67,128,254,0,3,181,254,28,
+254,199,96,137,180,1,89,202,41,41,137,198,210,33,104,115,254,211,4,9,254,
+247,141,1,58,106,9,6,155,155,254,124,254,78,100,109,1,23,242,156,103,243,
+0,255,255,0,2,255,141,4,189,5,92,16,3,0,77,255,115,0,0,0,1,0,143,255,129,
+6,63,5,92,0,34,0,0,1,33,4,0,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,
+6,35,34,38,53,52,0,37,53,6,35,33,17,35,17,33,6,63,254,144,254,202,254,212,
+120,107,113,110,81,101,82,129,131,199,184,178,209,1,29,1,2,69,126,253,254,
+152,5,176,4,193,216,254,73,249,135,141,139,127,91,144,46,131,62,213,141,194,
+232,236,204,243,1,219,183,9,6,250,204,5,207,0,1,0,0,255,129,4,115,5,92,0,
+32,0,0,17,33,21,33,4,0,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,
+34,38,53,52,0,37,53,6,35,33,4,115,254,143,254,202,254,212,121,106,113,110,
+81,101,82,129,131,199,184,178,209,1,29,1,2,68,127,254,164,5,92,155,216,254,
+73,249,135,141,139,127,91,144,46,131,62,213,141,194,232,236,204,243,1,219,
+183,9,6,0,1,0,0,255,129,3,2,5,92,0,31,0,0,17,33,21,4,0,21,20,22,51,50,54,
+53,52,38,39,55,22,22,21,20,6,35,34,38,53,52,0,37,53,6,35,33,3,2,254,202,254,
+212,121,106,113,110,81,101,82,129,131,199,184,178,209,1,29,1,2,68,127,254,
+164,5,92,155,216,254,73,249,135,141,139,127,91,144,46,131,62,213,141,194,
+232,236,204,243,1,219,183,9,6,0,0,1,0,143,255,141,6,180,5,92,0,21,0,0,5,17,
+33,17,35,17,33,17,33,38,17,52,18,55,33,21,33,6,2,21,16,19,2,131,254,164,152,
+2,140,1,102,41,72,78,1,198,254,160,55,45,79,115,5,52,250,204,5,207,250,205,
+219,1,25,252,1,143,180,155,154,254,210,220,254,146,254,222,255,255,0,2,255,
+141,5,6,5,92,16,3,0,16,255,115,0,0,255,255,0,2,255,141,4,6,5,92,16,3,0,36,
+255,115,0,0,0,1,0,143,255,141,6,184,5,92,0,17,0,0,1,0,3,35,17,33,17,35,17,
+33,21,33,17,20,7,51,18,19,5,55,254,226,156,250,254,164,152,6,41,252,99,7,
+9,120,228,3,23,254,130,253,244,5,52,250,204,5,207,155,252,83,154,71,1,141,
+1,87,0,1,0,0,255,141,4,61,5,92,0,13,0,0,1,0,3,35,17,33,21,33,17,20,7,51,18,
+19,2,180,254,226,156,250,4,61,252,91,7,9,120,228,3,23,254,130,253,244,5,207,
+155,252,83,154,71,1,141,1,87,0,0,1,0,0,255,141,2,205,5,92,0,13,0,0,1,0,3,
+35,17,33,21,33,17,20,7,51,18,19,2,180,254,226,156,250,2,205,253,203,7,9,120,
+228,3,23,254,130,253,244,5,207,155,252,83,154,71,1,141,1,87,0,0,1,0,0,255,
+141,3,193,5,92,0,20,0,0,17,54,18,55,51,2,1,21,54,51,33,21,33,39,21,0,19,35,
+38,2,39,156,215,73,164,135,254,246,78,114,2,50,253,206,192,1,8,137,164,73,
+215,156,2,195,153,1,66,190,254,133,254,230,9,5,156,4,8,254,229,254,133,191,
+1,65,154,0,0,1,0,0,255,141,2,96,5,92,0,12,0,0,17,54,18,55,51,2,1,0,19,35,
+38,2,39,156,215,73,164,158,254,187,1,69,158,164,73,215,156,2,195,153,1,66,
+190,254,72,254,209,254,206,254,74,191,1,65,154,0,0,1,0,143,255,141,4,150,
+5,92,0,24,0,0,1,17,54,18,55,51,2,1,21,54,51,33,21,33,39,21,0,19,35,38,2,39,
+17,35,17,1,39,123,174,65,164,135,254,246,78,114,2,50,253,206,192,1,8,137,
+164,65,174,123,152,5,92,253,187,135,1,24,166,254,133,254,230,9,5,156,4,8,
+254,229,254,133,166,1,23,135,253,188,5,207,255,255,0,143,255,141,7,184,5,
+106,16,34,0,44,0,0,16,3,1,42,6,10,253,104,0,1,0,143,255,141,6,51,5,92,0,38,
+0,0,1,35,34,6,6,7,38,35,34,6,21,20,22,23,2,7,38,39,17,35,17,51,17,22,23,54,
+55,38,38,53,52,54,51,50,23,54,54,51,51,6,51,61,68,112,82,64,151,158,115,141,
+144,200,161,103,219,201,152,152,167,189,65,54,135,160,234,182,149,113,51,
+185,137,61,4,193,49,104,130,151,124,117,104,169,88,254,223,219,107,147,254,
+168,5,207,252,70,137,101,139,93,71,207,154,178,227,84,90,117,255,255,0,2,
+255,141,5,166,5,92,16,3,0,96,255,115,0,0,0,2,255,236,255,141,4,160,5,92,0,
+35,0,39,0,0,1,22,21,20,6,35,34,38,53,52,54,51,50,0,21,16,0,33,53,32,0,53,
+52,38,35,34,6,21,20,22,51,50,54,53,52,39,1,33,21,33,2,72,10,166,131,141,176,
+254,210,225,1,21,254,93,254,149,1,43,1,67,185,157,139,166,88,70,68,69,6,254,
+84,4,160,251,96,2,158,37,45,133,170,182,172,202,249,254,221,226,254,192,254,
+144,156,1,21,255,161,192,155,132,94,96,77,62,28,23,2,221,155,0,0,2,255,236,
+255,141,3,178,5,92,0,35,0,39,0,0,1,22,21,20,6,35,34,38,53,52,54,51,50,0,21,
+16,0,33,53,32,0,53,52,38,35,34,6,21,20,22,51,50,54,53,52,39,1,33,21,33,2,
+72,10,166,131,141,176,254,210,225,1,21,254,93,254,149,1,43,1,67,185,157,139,
+166,88,70,68,69,6,254,84,3,158,252,98,2,158,37,45,133,170,182,172,202,249,
+254,221,226,254,192,254,144,156,1,21,255,161,192,155,132,94,96,77,62,28,23,
+2,221,155,0,0,1,0,143,255,141,5,252,5,92,0,20,0,0,37,33,17,35,17,33,21,33,
+17,33,21,33,17,33,32,5,21,38,39,17,35,2,121,254,174,152,5,109,251,43,3,100,
+252,156,1,22,1,75,1,3,174,205,151,168,254,229,5,207,155,254,143,156,254,144,
+107,168,82,25,254,241,255,255,0,2,255,141,5,111,5,92,16,3,0,100,255,115,0,
+0,255,255,0,2,255,141,3,254,5,92,16,3,0,13,255,115,0,0,255,255,0,2,255,141,
+5,13,5,92,16,3,0,41,255,115,0,0,0,1,0,143,255,141,5,150,5,92,0,28,0,0,37,
+33,21,35,17,33,21,33,17,51,50,4,51,51,21,35,34,36,35,35,17,33,32,5,21,38,
+39,21,35,2,121,254,174,152,3,252,252,156,104,222,2,80,176,41,41,181,253,161,
+202,104,1,22,1,75,1,3,174,205,151,127,242,5,207,155,254,122,120,156,121,254,
+123,107,168,82,25,230,0,2,0,143,255,129,6,63,5,92,0,22,0,33,0,0,1,33,4,7,
+4,17,20,6,35,34,38,53,52,0,37,53,6,35,33,17,35,17,33,1,6,21,20,22,51,50,54,
+53,52,38,6,63,254,144,254,242,150,1,164,199,184,178,209,1,29,1,2,69,126,253,
+254,152,5,176,252,148,102,120,107,113,110,162,4,193,189,192,164,254,139,194,
+232,236,204,243,1,219,183,9,6,250,204,5,207,253,101,187,205,135,141,139,127,
+125,211,0,255,255,0,2,255,129,5,178,5,92,16,3,0,105,255,115,0,0,255,255,0,
+2,255,129,4,66,5,92,16,3,0,24,255,115,0,0,255,255,0,2,255,141,5,9,5,92,16,
+3,0,104,255,115,0,0,0,2,0,143,255,141,6,16,5,92,0,12,0,23,0,0,1,33,0,3,34,
+36,39,17,33,21,33,17,33,1,22,22,23,54,18,55,53,6,35,33,6,16,254,144,254,245,
+90,165,254,251,106,3,121,251,239,5,129,251,23,98,195,129,33,147,104,90,120,
+254,16,4,193,254,211,254,85,48,59,253,213,156,5,207,253,164,66,51,4,144,1,
+45,120,9,4,0,255,255,0,2,255,141,4,19,5,92,16,3,0,47,255,115,0,0,255,255,
+0,2,255,141,5,131,5,92,16,3,0,109,255,115,0,0,0,1,0,143,255,141,6,119,5,92,
+0,34,0,0,19,51,17,33,38,38,53,52,54,51,50,23,54,54,51,51,21,35,34,6,7,38,
+35,34,6,21,20,23,33,21,33,17,33,21,33,143,152,1,12,47,41,209,166,157,111,
+47,135,121,234,207,109,127,53,144,165,92,123,104,2,35,252,33,3,223,251,137,
+5,92,253,41,64,139,98,169,218,80,60,59,155,84,97,133,113,110,178,123,156,
+254,64,156,255,255,0,2,255,141,5,234,5,92,16,3,0,112,255,115,0,0,255,255,
+0,2,255,141,4,174,5,92,16,3,0,21,255,115,0,0,255,255,0,2,255,129,4,66,5,92,
+16,3,0,28,255,115,0,0,0,1,0,143,255,141,6,49,5,92,0,23,0,0,1,35,34,6,2,3,
+35,17,33,17,35,17,33,21,33,17,20,7,51,54,18,36,51,51,6,49,41,200,215,159,
+77,250,254,164,152,4,185,253,211,7,9,71,195,1,16,209,41,2,39,116,254,236,
+254,238,5,52,250,204,5,207,155,252,83,154,71,241,1,29,130,0,0,1,0,0,255,141,
+3,174,5,92,0,19,0,0,1,35,34,6,2,3,35,17,33,21,33,17,20,7,51,54,18,36,51,51,
+3,174,41,200,215,159,77,250,2,197,253,211,7,9,71,195,1,16,209,41,2,39,116,
+254,236,254,238,5,207,155,252,83,154,71,241,1,29,130,0,1,0,143,255,129,5,
+217,5,92,0,34,0,0,1,21,33,22,21,20,6,35,34,38,53,52,0,37,53,6,35,33,17,35,
+17,33,21,4,0,21,20,22,51,50,54,53,52,39,55,5,217,254,168,78,199,184,178,209,
+1,29,1,2,69,126,253,254,152,4,64,254,202,254,212,120,107,113,110,174,70,2,
+195,156,105,147,194,232,236,204,243,1,219,183,9,6,250,204,5,207,155,216,254,
+73,249,135,141,139,127,185,87,132,0,1,0,0,255,129,4,12,5,92,0,32,0,0,1,21,
+33,22,21,20,6,35,34,38,53,52,0,37,53,6,35,33,53,33,21,4,0,21,20,22,51,50,
+54,53,52,39,55,4,12,254,168,78,199,184,178,209,1,29,1,2,68,127,254,164,3,
+2,254,202,254,212,121,106,113,110,174,70,2,195,156,105,147,194,232,236,204,
+243,1,219,183,9,6,155,155,216,254,73,249,135,141,139,127,185,87,132,0,1,0,
+143,255,141,6,31,5,92,0,37,0,0,1,35,34,38,2,38,35,34,6,21,20,22,23,2,7,38,
+39,17,35,17,51,17,22,23,54,55,38,38,53,52,54,51,50,22,18,22,51,51,6,31,41,
+134,158,110,122,123,111,133,144,200,161,103,219,201,152,152,167,189,65,54,
+135,160,223,181,152,202,124,93,76,41,2,39,153,1,10,115,124,117,104,169,88,
+254,223,219,107,147,254,168,5,207,252,70,137,101,139,93,71,207,154,176,229,
+152,254,222,100,0,255,255,0,2,255,141,5,146,5,92,16,3,0,120,255,115,0,0,0,
+1,0,143,255,141,5,231,5,102,0,29,0,0,19,51,17,33,38,38,53,52,54,51,50,23,
+55,51,6,7,38,35,34,6,21,20,23,33,21,33,17,33,21,33,143,152,1,2,41,37,210,
+165,145,107,39,172,86,68,145,164,92,123,94,3,14,251,64,3,223,251,137,5,92,
+253,103,59,137,92,170,217,82,72,151,136,134,113,111,170,118,156,254,2,156,
+0,255,255,0,2,255,141,5,90,5,102,16,3,0,122,255,115,0,0,0,2,0,143,255,129,
+5,217,5,92,0,30,0,41,0,0,1,4,7,22,4,51,51,21,35,34,39,7,22,21,20,6,35,34,
+38,53,52,0,37,53,6,35,33,17,35,17,33,1,6,21,20,22,51,50,54,53,52,38,4,207,
+254,237,147,173,1,29,148,82,82,163,113,2,94,199,184,178,209,1,29,1,2,69,126,
+253,254,152,4,64,254,4,102,120,107,113,110,162,4,193,193,188,74,55,156,33,
+6,123,156,194,232,236,204,243,1,219,183,9,6,250,204,5,207,253,101,187,205,
+135,141,139,127,125,211,0,255,255,0,2,255,129,5,76,5,92,16,3,0,124,255,115,
+0,0,0,2,0,143,255,141,6,111,5,92,0,19,0,26,0,0,37,22,23,33,17,51,17,33,17,
+33,21,33,6,21,20,19,33,17,33,17,1,17,33,38,53,52,55,5,39,14,23,251,67,152,
+1,10,4,62,254,88,31,61,253,76,254,246,1,162,1,100,29,29,41,76,80,5,207,254,
+60,1,196,155,185,190,254,254,235,1,197,253,45,4,152,253,18,166,209,209,166,
+0,255,255,0,143,255,141,6,78,5,92,16,34,0,16,0,0,16,3,1,42,4,160,253,104,
+255,255,0,2,255,141,4,131,5,92,16,3,0,81,255,115,0,0,0,1,0,143,255,141,5,
+29,5,92,0,31,0,0,1,18,55,33,53,33,6,2,7,33,21,35,34,39,21,22,22,21,20,6,35,
+33,53,33,50,54,53,52,38,35,33,53,2,135,72,149,253,43,4,4,135,193,38,1,248,
+193,110,78,53,57,250,202,254,69,1,187,135,158,157,136,254,69,2,195,1,22,232,
+155,164,254,172,161,156,4,8,43,131,78,186,224,156,131,123,122,134,156,255,
+255,0,2,255,141,4,144,5,92,16,3,0,129,255,115,0,0,0,2,255,236,255,141,4,168,
+5,92,0,38,0,42,0,0,1,22,21,20,6,35,34,38,53,52,54,51,50,4,23,33,21,35,2,0,
+33,53,32,0,53,52,38,35,34,6,21,20,22,51,50,54,53,52,39,1,33,21,33,2,72,10,
+166,131,141,176,254,210,188,1,2,42,1,4,248,8,254,92,254,160,1,43,1,67,185,
+157,139,166,88,70,68,69,6,254,84,3,158,252,98,2,158,37,45,133,170,182,172,
+202,249,203,180,156,254,199,254,159,156,1,21,255,161,192,155,132,94,96,77,
+62,28,23,2,221,155,0,0,2,0,143,255,141,6,119,5,92,0,31,0,43,0,0,1,34,7,22,
+18,21,20,6,35,34,38,53,52,18,55,38,35,35,17,33,21,33,17,33,50,22,23,54,54,
+51,33,21,5,6,6,21,20,22,51,50,54,53,52,38,4,254,171,99,106,121,197,170,170,
+196,119,108,103,167,164,3,237,251,123,1,74,119,190,86,86,191,119,1,135,252,
+237,104,102,108,98,99,108,102,4,193,39,103,254,242,154,192,217,217,192,154,
+1,14,103,39,251,104,156,5,207,41,49,49,41,155,127,91,225,123,123,122,122,
+123,123,225,255,255,0,143,255,141,6,16,5,92,16,34,0,33,0,0,16,3,1,42,4,98,
+253,104,255,255,0,2,255,141,5,234,5,92,16,3,0,132,255,115,0,0,255,255,0,2,
+255,141,5,129,5,92,16,35,0,33,255,115,0,0,16,3,1,42,3,211,253,104,255,255,
+0,2,255,141,4,135,5,92,16,3,0,33,255,115,0,0,0,2,0,143,255,129,5,217,5,92,
+0,33,0,43,0,0,5,35,17,51,50,23,54,55,53,6,35,33,53,33,21,6,7,22,23,33,21,
+33,22,21,20,6,35,34,38,53,52,55,38,35,5,6,21,20,22,51,50,54,53,16,1,39,152,
+168,216,178,126,173,69,126,253,102,4,64,245,132,113,88,1,186,254,184,62,197,
+166,170,196,121,135,193,1,219,108,108,98,103,100,115,4,35,49,188,131,9,6,
+155,155,191,184,54,81,156,126,146,193,213,223,197,227,236,32,79,203,213,125,
+131,129,117,1,41,255,255,0,2,255,129,5,76,5,92,16,3,0,137,255,115,0,0,0,2,
+0,143,255,141,6,119,5,92,0,33,0,40,0,0,1,21,33,21,22,18,21,16,0,33,53,32,
+0,53,52,38,35,34,6,21,20,51,50,55,23,6,35,34,38,39,35,17,35,17,1,54,54,55,
+53,33,17,6,119,253,71,156,193,254,118,254,164,1,20,1,50,151,130,121,122,170,
+51,30,56,55,82,121,168,29,180,152,1,66,13,183,146,254,0,5,92,155,177,30,254,
+251,196,254,208,254,148,156,1,10,246,149,183,131,95,180,25,154,35,121,115,
+253,102,5,207,253,103,137,185,15,173,254,2,0,255,255,0,2,255,141,5,234,5,
+92,16,3,0,139,255,115,0,0,255,255,0,2,255,141,4,142,5,92,16,3,0,29,255,115,
+0,0,255,255,0,143,255,141,6,16,5,92,16,34,0,29,0,0,16,67,1,42,4,184,253,104,
+51,51,64,0,255,255,0,2,255,141,5,129,5,92,16,35,0,29,255,115,0,0,16,67,1,
+42,4,41,253,104,51,51,64,0,255,255,0,2,255,141,6,39,5,92,16,3,0,86,255,115,
+0,0,255,255,0,2,255,141,5,190,5,92,16,35,0,16,255,115,0,0,16,3,1,42,4,16,
+253,104,0,1,0,143,255,141,6,180,5,92,0,21,0,0,19,51,17,33,17,51,17,33,38,
+17,52,18,55,33,21,33,6,2,21,16,19,33,143,152,1,92,152,1,102,41,72,78,1,198,
+254,160,55,45,79,251,80,5,92,250,205,5,51,250,205,219,1,25,252,1,143,180,
+155,154,254,210,220,254,146,254,222,0,255,255,0,143,255,141,6,78,5,92,16,
+34,0,19,0,0,16,3,1,42,4,160,253,104,255,255,0,2,255,141,6,39,5,92,16,3,0,
+146,255,115,0,0,255,255,0,2,255,141,5,190,5,92,16,35,0,19,255,115,0,0,16,
+3,1,42,4,16,253,104,255,255,0,2,255,141,5,6,5,92,16,3,0,19,255,115,0,0,0,
+3,0,143,255,141,6,139,5,92,0,16,0,24,0,29,0,0,5,34,36,39,21,36,39,21,35,17,
+33,21,33,6,2,21,16,37,22,23,38,17,16,19,33,1,22,23,17,33,5,23,154,254,232,
+95,254,182,149,152,5,252,254,160,55,45,254,63,121,213,37,90,254,125,254,33,
+117,211,254,184,115,99,94,172,70,161,252,5,207,155,154,254,210,220,254,150,
+95,161,47,204,1,15,1,137,1,27,252,147,172,64,4,89,255,255,0,143,255,141,6,
+37,5,92,16,34,0,22,0,0,16,3,1,42,4,119,253,104,255,255,0,2,255,141,5,254,
+5,92,16,3,0,151,255,115,0,0,255,255,0,2,255,141,5,149,5,92,16,35,0,22,255,
+115,0,0,16,3,1,42,3,231,253,104,255,255,0,2,255,141,4,221,5,92,16,3,0,22,
+255,115,0,0,0,1,0,143,255,141,4,233,5,92,0,22,0,0,5,34,36,39,21,35,17,51,
+17,22,23,38,17,52,18,55,33,21,33,6,2,21,16,3,117,180,254,201,99,152,152,143,
+252,37,72,78,1,198,254,160,54,46,115,123,109,232,5,207,251,223,198,51,215,
+1,4,252,1,143,180,155,158,254,216,222,254,150,255,255,0,143,255,141,4,131,
+5,92,16,34,0,23,0,0,16,3,1,42,2,213,253,104,255,255,0,2,255,141,4,92,5,92,
+16,3,0,156,255,115,0,0,255,255,0,2,255,141,3,244,5,92,16,35,0,23,255,115,
+0,0,16,3,1,42,2,70,253,104,255,255,0,2,255,141,3,60,5,92,16,3,0,23,255,115,
+0,0,0,2,0,143,255,141,6,182,5,92,0,13,0,20,0,0,5,17,33,17,35,17,33,21,33,
+6,2,21,16,19,3,33,17,33,38,17,16,2,131,254,164,152,6,39,254,158,55,45,79,
+141,254,105,1,102,41,115,5,52,250,204,5,207,155,154,254,210,220,254,146,254,
+222,5,52,251,104,219,1,25,1,137,255,255,0,143,255,141,6,80,5,92,16,34,0,17,
+0,0,16,3,1,42,4,162,253,104,255,255,0,2,255,141,6,41,5,92,16,3,0,161,255,
+115,0,0,255,255,0,2,255,141,5,192,5,92,16,35,0,17,255,115,0,0,16,3,1,42,4,
+18,253,104,255,255,0,2,255,141,5,6,5,92,16,3,0,17,255,115,0,0,0,3,0,143,255,
+141,6,76,5,92,0,17,0,22,0,27,0,0,23,17,51,17,33,17,33,21,33,6,2,21,16,19,
+33,17,33,17,1,33,18,55,33,1,38,17,33,17,143,152,1,10,4,27,254,192,54,46,80,
+253,57,254,246,1,162,1,75,18,68,254,95,1,114,43,254,185,115,5,207,253,103,
+2,153,155,158,254,216,222,254,150,254,218,2,154,253,102,3,54,1,34,220,251,
+104,240,1,14,254,2,255,255,0,143,255,141,6,8,5,92,16,34,0,18,0,0,16,3,1,42,
+4,90,253,104,255,255,0,2,255,141,5,191,5,92,16,3,0,166,255,115,0,0,255,255,
+0,2,255,141,5,121,5,92,16,35,0,18,255,115,0,0,16,3,1,42,3,203,253,104,255,
+255,0,2,255,141,4,191,5,92,16,3,0,18,255,115,0,0,0,1,0,143,255,141,6,190,
+5,92,0,22,0,0,5,17,33,17,35,17,33,17,33,38,17,16,19,33,53,33,21,33,6,2,21,
+16,19,2,131,254,164,152,2,140,1,112,41,90,251,211,6,47,254,160,54,46,80,115,
+3,58,252,198,3,213,252,199,229,1,15,1,137,1,27,155,155,158,254,216,222,254,
+150,254,218,0,255,255,0,143,255,141,6,88,5,92,16,34,0,25,0,0,16,3,1,42,4,
+170,253,104,255,255,0,2,255,141,6,49,5,92,16,3,0,171,255,115,0,0,255,255,
+0,2,255,141,5,201,5,92,16,35,0,25,255,115,0,0,16,3,1,42,4,27,253,104,255,
+255,0,2,255,141,5,17,5,92,16,3,0,25,255,115,0,0,0,2,0,143,255,141,6,190,5,
+92,0,13,0,22,0,0,5,17,33,17,35,17,33,21,33,6,2,21,16,19,37,33,38,17,16,19,
+33,17,33,2,131,254,164,152,6,47,254,160,54,46,80,253,209,1,112,41,90,252,
+107,1,244,115,2,154,253,102,5,207,155,158,254,216,222,254,150,254,218,156,
+229,1,15,1,137,1,27,254,2,0,255,255,0,143,255,141,6,88,5,92,16,34,0,26,0,
+0,16,3,1,42,4,170,253,104,255,255,0,2,255,141,6,49,5,92,16,3,0,176,255,115,
+0,0,255,255,0,2,255,141,5,201,5,92,16,35,0,26,255,115,0,0,16,3,1,42,4,27,
+253,104,255,255,0,2,255,141,5,17,5,92,16,3,0,26,255,115,0,0,0,2,0,143,255,
+141,6,211,5,92,0,16,0,23,0,0,5,35,17,33,17,35,17,33,17,35,17,33,21,33,6,2,
+21,5,33,17,33,18,55,33,5,14,151,254,164,152,254,164,152,6,68,254,160,55,46,
+252,25,1,92,1,246,14,74,252,86,115,2,154,253,102,1,11,254,245,5,207,155,151,
+254,203,204,246,1,144,1,26,228,0,255,255,0,143,255,141,6,108,5,92,16,34,0,
+31,0,0,16,3,1,42,4,190,253,104,255,255,0,2,255,141,6,70,5,92,16,3,0,181,255,
+115,0,0,255,255,0,2,255,141,5,221,5,92,16,35,0,31,255,115,0,0,16,3,1,42,4,
+47,253,104,255,255,0,2,255,141,5,37,5,92,16,3,0,31,255,115,0,0,0,1,0,143,
+255,141,6,180,5,92,0,20,0,0,5,2,17,16,19,33,17,35,17,33,17,35,17,33,21,33,
+6,2,21,16,19,4,166,78,90,254,105,152,254,164,152,6,37,254,160,55,45,79,115,
+1,34,1,110,1,137,1,27,250,204,5,52,250,204,5,207,155,154,254,210,220,254,
+146,254,222,255,255,0,143,255,141,6,78,5,92,16,34,0,34,0,0,16,3,1,42,4,160,
+253,104,255,255,0,2,255,141,6,39,5,92,16,3,0,186,255,115,0,0,255,255,0,2,
+255,141,5,190,5,92,16,35,0,34,255,115,0,0,16,3,1,42,4,16,253,104,255,255,
+0,2,255,141,5,6,5,92,16,3,0,34,255,115,0,0,0,1,0,143,255,141,6,193,5,92,0,
+22,0,0,1,21,33,6,21,20,23,33,17,33,17,33,22,23,33,17,33,17,33,38,53,16,55,
+6,193,254,86,29,61,253,76,254,164,4,78,14,23,250,245,2,140,1,100,29,60,5,
+92,155,162,174,235,255,3,58,251,104,76,80,5,207,252,199,147,187,1,16,219,
+0,255,255,0,143,255,141,6,90,5,92,16,34,0,35,0,0,16,3,1,42,4,172,253,104,
+255,255,0,2,255,141,6,52,5,92,16,3,0,191,255,115,0,0,255,255,0,2,255,141,
+5,203,5,92,16,35,0,35,255,115,0,0,16,3,1,42,4,29,253,104,255,255,0,2,255,
+141,5,13,5,92,16,3,0,35,255,115,0,0,0,1,0,143,255,141,4,233,5,92,0,19,0,0,
+5,2,17,33,17,35,17,51,17,33,18,19,33,21,33,6,2,21,16,19,2,219,78,254,154,
+152,152,1,106,22,124,1,198,254,160,54,46,80,115,1,34,1,120,253,102,5,207,
+253,103,1,129,1,24,155,158,254,216,222,254,150,254,218,255,255,0,143,255,
+141,4,131,5,92,16,34,0,37,0,0,16,3,1,42,2,213,253,104,255,255,0,2,255,141,
+4,92,5,92,16,3,0,196,255,115,0,0,255,255,0,2,255,141,3,244,5,92,16,35,0,37,
+255,115,0,0,16,3,1,42,2,70,253,104,255,255,0,2,255,141,3,60,5,92,16,3,0,37,
+255,115,0,0,0,1,0,143,255,141,4,193,5,92,0,17,0,0,19,51,17,33,38,17,52,18,
+55,33,21,33,6,2,21,16,19,33,143,152,1,104,43,72,78,1,199,254,159,54,46,80,
+253,67,5,92,250,205,220,1,24,252,1,143,180,155,158,254,216,222,254,150,254,
+218,255,255,0,143,255,141,4,90,5,92,16,34,0,51,0,0,16,3,1,42,2,172,253,104,
+255,255,0,2,255,141,4,52,5,92,16,3,0,201,255,115,0,0,255,255,0,2,255,141,
+3,203,5,92,16,35,0,51,255,115,0,0,16,3,1,42,2,29,253,104,255,255,0,2,255,
+141,3,19,5,92,16,3,0,51,255,115,0,0,0,1,0,143,255,141,6,193,5,92,0,19,0,0,
+37,33,17,33,6,21,20,23,35,38,17,52,55,33,17,33,17,33,21,33,1,39,1,92,2,180,
+61,61,153,60,29,254,156,253,116,6,50,250,102,41,3,57,253,236,237,255,219,
+1,17,185,149,252,198,5,207,155,255,255,0,143,255,141,6,86,5,92,16,34,0,39,
+0,0,16,3,1,42,4,168,253,104,255,255,0,2,255,141,6,52,5,92,16,3,0,206,255,
+115,0,0,255,255,0,2,255,141,5,199,5,92,16,35,0,39,255,115,0,0,16,3,1,42,4,
+25,253,104,255,255,0,2,255,141,5,13,5,92,16,3,0,39,255,115,0,0,255,255,0,
+143,255,141,6,8,5,92,16,34,0,14,0,0,16,3,1,42,4,90,253,104,255,255,0,2,255,
+141,5,226,5,92,16,3,0,126,255,115,0,0,255,255,0,2,255,141,5,121,5,92,16,35,
+0,14,255,115,0,0,16,3,1,42,3,203,253,104,255,255,0,2,255,141,4,191,5,92,16,
+3,0,14,255,115,0,0,0,2,0,143,255,141,6,111,5,92,0,16,0,23,0,0,5,17,33,17,
+35,17,33,21,33,17,33,17,33,2,21,20,19,37,33,38,53,52,55,33,2,49,254,246,152,
+5,224,250,184,1,10,2,180,61,61,253,228,1,100,29,29,254,156,115,1,197,254,
+59,5,207,155,253,45,1,196,254,235,253,254,254,235,156,166,209,209,166,255,
+255,0,143,255,141,6,8,5,92,16,34,0,15,0,0,16,3,1,42,4,90,253,104,255,255,
+0,2,255,141,5,226,5,92,16,3,0,215,255,115,0,0,255,255,0,2,255,141,5,121,5,
+92,16,35,0,15,255,115,0,0,16,3,1,42,3,203,253,104,255,255,0,2,255,141,4,191,
+5,92,16,3,0,15,255,115,0,0,0,1,0,143,255,141,6,193,5,92,0,24,0,0,19,33,17,
+33,38,53,52,55,33,53,33,21,33,6,21,16,19,33,17,33,17,33,22,23,33,143,2,140,
+1,100,29,29,252,16,6,50,254,88,31,61,253,76,254,164,4,70,14,22,250,254,3,
+166,254,57,162,205,209,162,155,155,183,188,255,0,254,246,1,198,253,31,76,
+80,255,255,0,143,255,141,6,78,5,92,16,34,0,38,0,0,16,3,1,42,4,160,253,104,
+255,255,0,2,255,141,6,52,5,92,16,3,0,220,255,115,0,0,255,255,0,2,255,141,
+5,190,5,92,16,35,0,38,255,115,0,0,16,3,1,42,4,16,253,104,255,255,0,2,255,
+141,5,4,5,92,16,3,0,38,255,115,0,0,0,2,0,143,255,141,6,252,5,92,0,28,0,38,
+0,0,19,51,17,33,17,51,17,54,36,51,33,21,33,6,21,16,19,34,36,39,17,35,17,33,
+17,33,22,23,33,1,6,4,7,22,4,23,38,53,52,143,152,1,2,152,129,1,128,179,1,135,
+254,86,35,70,181,254,123,122,152,254,254,4,119,14,23,250,204,4,35,139,254,
+250,96,96,1,6,139,26,5,92,254,27,1,229,254,154,161,197,155,205,203,254,215,
+254,246,202,154,254,156,1,229,253,78,76,80,5,13,41,195,133,135,195,41,173,
+198,200,255,255,0,143,255,141,6,149,5,92,16,34,0,32,0,0,16,3,1,42,4,231,253,
+104,255,255,0,2,255,141,6,111,5,92,16,3,0,225,255,115,0,0,255,255,0,2,255,
+141,6,6,5,92,16,35,0,32,255,115,0,0,16,3,1,42,4,88,253,104,255,255,0,2,255,
+141,5,54,5,92,16,3,0,32,255,115,0,0,0,2,0,82,255,141,4,227,5,92,0,9,0,17,
+0,0,5,2,2,3,33,21,35,2,2,3,1,18,18,19,51,18,18,19,1,221,182,204,9,4,145,229,
+150,141,24,254,47,26,158,137,8,27,120,134,115,1,55,3,17,1,135,155,254,200,
+253,94,254,166,5,52,254,182,253,196,254,236,1,65,2,18,1,71,255,255,255,250,
+255,141,3,250,5,92,16,2,0,52,168,0,255,255,0,82,255,141,4,166,5,92,16,34,
+0,52,0,0,16,3,1,42,2,248,253,104,0,2,0,143,255,141,8,152,5,92,0,44,0,56,0,
+0,5,38,2,2,38,38,35,34,6,21,20,22,23,2,7,38,39,17,35,17,51,17,22,23,54,55,
+38,38,53,52,54,51,50,23,54,36,51,33,21,33,6,2,17,20,23,39,38,53,16,18,55,
+34,4,7,22,18,19,5,195,93,153,102,102,108,88,84,110,144,200,161,103,219,201,
+152,152,167,189,65,54,135,160,204,150,132,96,129,1,57,244,1,201,254,219,105,
+96,18,161,9,91,94,212,254,243,97,91,163,139,115,151,1,126,1,119,197,75,115,
+106,104,169,88,254,223,219,107,147,254,168,5,207,252,70,137,101,139,93,71,
+207,154,165,220,70,108,105,155,242,254,4,254,217,175,112,170,61,56,1,49,1,
+250,234,85,85,140,253,187,254,241,255,255,0,143,255,141,8,49,5,92,16,34,0,
+49,0,0,16,3,1,42,6,131,253,104,255,255,0,2,255,141,8,11,5,92,16,3,0,233,255,
+115,0,0,255,255,0,2,255,141,7,162,5,92,16,35,0,49,255,115,0,0,16,3,1,42,5,
+244,253,104,255,255,0,2,255,141,7,47,5,92,16,3,0,49,255,115,0,0,0,2,0,143,
+255,141,6,16,5,92,0,11,0,22,0,0,5,33,17,33,21,33,17,54,36,51,18,1,1,6,6,7,
+17,33,50,23,53,38,2,4,160,251,239,5,129,251,23,106,1,5,165,91,1,10,254,45,
+129,195,98,1,240,120,90,104,147,115,5,207,155,253,213,57,49,254,83,254,214,
+2,57,6,51,66,254,66,4,8,119,1,47,0,255,255,0,2,255,141,5,29,5,92,16,3,1,99,
+255,115,0,0,0,2,0,143,255,141,5,170,5,92,0,13,0,24,0,0,5,33,17,33,21,33,17,
+54,33,33,21,33,18,23,1,6,6,7,17,33,50,23,53,38,2,4,160,251,239,4,17,252,135,
+199,1,77,2,111,253,188,101,213,254,45,129,195,98,1,240,120,90,104,147,115,
+5,207,155,253,151,107,156,254,217,215,1,252,6,51,66,254,127,4,8,105,1,14,
+255,255,0,2,255,141,5,131,5,92,16,3,0,238,255,115,0,0,255,255,0,2,255,141,
+5,29,5,92,16,3,0,240,255,115,0,0,255,255,0,2,255,141,4,19,5,92,16,3,0,50,
+255,115,0,0,0,1,0,143,255,141,6,119,5,92,0,34,0,0,23,17,33,21,33,17,33,21,
+33,6,21,20,22,51,50,55,22,22,51,51,21,35,34,38,39,6,35,34,38,53,52,54,55,
+33,17,143,4,119,252,33,3,223,253,221,104,123,92,163,146,53,127,109,207,234,
+121,135,47,111,157,163,212,41,47,254,244,115,5,207,155,254,63,156,123,178,
+110,113,133,96,84,156,60,59,80,216,171,99,139,63,253,41,0,1,0,143,255,131,
+5,231,5,92,0,29,0,0,23,17,33,21,33,17,33,21,33,6,21,20,22,51,50,55,22,23,
+35,39,6,35,34,38,53,52,54,55,33,17,143,4,119,252,33,4,192,252,242,94,123,
+92,165,144,68,86,172,39,107,145,165,210,37,41,254,254,115,5,207,155,254,2,
+156,119,170,110,113,133,136,151,72,82,218,169,92,138,59,253,102,0,255,255,
+0,2,255,141,5,234,5,92,16,3,0,244,255,115,0,0,255,255,0,2,255,131,5,90,5,
+92,16,3,0,245,255,115,0,0,255,255,0,2,255,141,4,174,5,92,16,3,0,54,255,115,
+0,0,0,3,0,143,255,141,6,139,5,92,0,16,0,24,0,29,0,0,1,2,17,20,18,23,33,21,
+33,17,51,21,54,37,21,54,36,7,6,7,17,33,2,17,16,37,6,7,17,33,5,23,80,45,55,
+1,96,250,4,152,150,1,73,92,1,25,39,212,122,1,131,90,254,64,206,122,1,72,5,
+92,254,218,254,151,219,254,209,154,156,5,207,252,163,69,172,92,100,182,45,
+164,252,84,1,25,1,139,1,11,167,59,177,252,150,0,255,255,0,143,255,141,6,37,
+5,92,16,34,0,55,0,0,16,3,1,42,4,119,253,104,255,255,0,2,255,141,5,254,5,92,
+16,3,0,249,255,115,0,0,255,255,0,2,255,141,5,149,5,92,16,35,0,55,255,115,
+0,0,16,3,1,42,3,231,253,104,255,255,0,2,255,141,4,221,5,92,16,3,0,55,255,
+115,0,0,0,2,255,236,255,141,4,160,5,92,0,35,0,39,0,0,1,54,53,52,38,35,34,
+6,21,20,22,51,50,54,53,52,0,33,53,32,0,17,20,0,35,34,38,53,52,54,51,50,22,
+21,20,7,1,33,21,33,1,172,6,69,68,70,88,166,139,158,184,254,191,254,211,1,
+109,1,161,254,232,222,210,254,176,141,131,166,10,253,184,4,160,251,96,2,106,
+21,31,61,78,96,95,131,155,191,161,253,1,24,155,254,145,254,191,227,254,223,
+248,202,173,182,169,134,45,37,253,221,156,0,0,2,255,236,255,141,4,168,5,92,
+0,38,0,42,0,0,1,54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,0,33,53,32,0,
+19,51,21,33,6,6,35,34,38,53,52,54,51,50,22,21,20,7,1,33,21,33,1,172,6,69,
+68,70,88,166,139,158,184,254,191,254,211,1,96,1,163,9,248,254,252,41,255,
+192,210,254,176,141,131,166,10,253,184,3,158,252,98,2,106,21,31,61,78,96,
+95,131,155,191,161,253,1,24,155,254,159,254,200,156,177,206,248,202,173,182,
+169,134,45,37,253,221,156,0,2,255,236,255,141,3,178,5,92,0,35,0,39,0,0,1,
+54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,0,33,53,32,0,17,20,0,35,34,38,
+53,52,54,51,50,22,21,20,7,1,33,21,33,1,172,6,69,68,70,88,166,139,158,184,
+254,191,254,211,1,109,1,161,254,232,222,210,254,176,141,131,166,10,253,184,
+3,158,252,98,2,106,21,31,61,78,96,95,131,155,191,161,253,1,24,155,254,145,
+254,191,227,254,223,248,202,173,182,169,134,45,37,253,221,156,0,0,3,0,143,
+255,141,6,139,5,92,0,19,0,26,0,31,0,0,19,33,21,33,6,2,21,20,23,38,38,39,21,
+36,39,17,33,22,23,33,1,22,23,53,16,19,33,1,22,23,17,33,143,5,252,254,193,
+53,43,14,172,250,78,254,185,152,4,12,15,22,251,55,2,119,124,210,86,254,92,
+254,33,117,211,254,184,5,92,155,146,254,205,203,122,103,2,102,70,154,65,165,
+253,223,76,80,3,47,146,42,49,1,125,1,19,254,86,173,63,2,150,0,255,255,0,2,
+255,141,5,254,5,92,16,3,1,1,255,115,0,0,255,255,0,2,255,141,5,149,5,92,16,
+35,0,48,255,115,0,0,16,3,1,42,3,231,253,104,255,255,0,2,255,141,4,254,5,92,
+16,3,0,48,255,115,0,0,255,255,0,143,255,141,6,37,5,92,16,34,0,48,0,0,16,3,
+1,42,4,119,253,104,0,1,0,0,255,141,4,61,5,92,0,13,0,0,1,2,3,35,22,21,17,33,
+21,33,17,51,18,1,1,246,226,122,9,7,3,165,251,195,250,155,1,31,1,211,1,82,
+1,145,71,154,252,84,156,5,207,253,246,254,129,0,0,1,0,0,255,141,3,174,5,92,
+0,19,0,0,1,35,34,36,2,39,35,22,21,17,33,21,33,17,51,18,18,22,51,51,3,174,
+41,209,254,241,196,71,9,7,2,45,253,59,250,77,159,215,200,41,2,39,129,1,29,
+241,71,154,252,84,156,5,207,254,240,254,235,116,0,1,0,0,255,141,2,205,5,92,
+0,13,0,0,1,2,3,35,22,21,17,33,21,33,17,51,18,1,1,246,226,122,9,7,2,53,253,
+51,250,155,1,31,1,211,1,82,1,145,71,154,252,84,156,5,207,253,246,254,129,
+0,0,1,0,143,255,141,4,233,5,92,0,22,0,0,1,2,17,20,18,23,33,21,33,38,2,53,
+16,55,6,7,17,35,17,51,21,54,36,3,117,80,45,55,1,96,254,58,78,72,37,252,143,
+152,152,99,1,52,5,92,254,218,254,151,219,254,218,163,156,181,1,143,252,1,
+1,216,53,197,251,225,5,207,233,108,125,0,255,255,0,143,255,141,4,131,5,92,
+16,34,0,56,0,0,16,3,1,42,2,213,253,104,255,255,0,2,255,141,4,92,5,92,16,3,
+1,9,255,115,0,0,255,255,0,2,255,141,3,244,5,92,16,35,0,56,255,115,0,0,16,
+3,1,42,2,70,253,104,255,255,0,2,255,141,3,60,5,92,16,3,0,56,255,115,0,0,0,
+2,0,143,255,141,6,63,5,104,0,22,0,33,0,0,37,21,33,17,51,17,33,50,23,53,36,
+0,53,52,54,51,50,22,21,16,5,22,5,1,54,54,53,52,38,35,34,6,21,20,6,63,250,
+80,152,2,2,126,69,254,254,254,227,209,178,180,203,254,92,150,1,14,254,4,186,
+162,110,113,107,120,41,156,5,207,250,205,6,8,183,1,219,243,205,235,229,197,
+254,138,164,191,188,2,0,65,211,125,127,140,142,135,209,0,0,2,0,143,255,141,
+5,217,5,104,0,30,0,41,0,0,1,34,4,7,22,5,21,33,17,51,17,33,50,23,53,36,0,53,
+52,54,51,50,22,21,20,7,23,54,51,51,21,37,54,54,53,52,38,35,34,6,21,20,5,135,
+157,254,230,167,147,1,19,251,192,152,2,2,126,69,254,254,254,227,209,178,180,
+203,94,2,119,157,82,252,250,186,162,110,113,107,120,2,39,60,71,188,191,156,
+5,207,250,205,6,8,183,1,219,243,205,235,229,197,155,123,6,33,156,2,65,211,
+125,127,140,142,135,209,255,255,0,2,255,141,5,178,5,104,16,3,1,14,255,115,
+0,0,255,255,0,2,255,141,5,76,5,104,16,3,1,15,255,115,0,0,255,255,0,2,255,
+141,4,66,5,104,16,3,0,57,255,115,0,0,255,255,0,2,255,141,5,166,5,92,16,3,
+1,89,255,115,0,0,255,255,0,2,255,141,5,146,5,92,16,3,1,90,255,115,0,0,255,
+255,0,2,255,141,5,13,5,92,16,3,1,88,255,115,0,0,0,1,0,0,255,141,4,115,5,104,
+0,32,0,0,53,33,50,23,53,36,0,53,52,54,51,50,22,21,20,6,7,39,54,54,53,52,38,
+35,34,6,21,20,0,5,33,21,33,1,92,127,68,254,254,254,227,209,178,180,203,131,
+129,82,101,81,110,113,106,121,1,42,1,56,1,113,251,141,41,6,8,183,1,219,243,
+205,235,229,197,141,213,61,131,46,143,91,127,140,142,135,250,254,77,218,156,
+0,0,1,0,0,255,141,4,12,5,104,0,32,0,0,1,39,54,53,52,38,35,34,6,21,20,0,5,
+21,33,53,33,50,23,53,36,0,53,52,54,51,50,22,21,20,7,33,21,1,250,70,174,110,
+113,106,121,1,42,1,56,252,254,1,92,127,68,254,254,254,227,209,178,180,203,
+78,1,88,2,39,131,87,185,127,140,142,135,250,254,77,218,156,156,6,8,183,1,
+219,243,205,235,229,197,149,102,156,0,1,0,0,255,141,3,2,5,104,0,31,0,0,5,
+33,53,33,50,23,53,36,0,53,52,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,
+6,21,20,0,5,3,2,252,254,1,92,127,68,254,254,254,227,209,178,180,203,131,129,
+82,101,81,110,113,106,121,1,42,1,56,115,156,6,8,183,1,219,243,205,235,229,
+197,141,213,61,131,46,143,91,127,140,142,135,250,254,77,218,0,1,0,143,255,
+141,5,43,5,92,0,27,0,0,1,33,34,6,21,20,22,23,2,7,38,39,17,35,17,51,17,22,
+23,54,55,38,38,53,52,0,33,33,5,43,254,223,205,194,158,186,161,103,219,201,
+152,152,167,189,40,79,134,161,1,45,1,2,1,33,4,193,175,157,122,192,88,254,
+223,219,107,147,254,168,5,207,252,70,137,101,86,146,80,225,168,222,1,9,255,
+255,0,143,255,141,6,31,5,92,18,2,0,120,0,0,255,255,0,2,255,141,4,158,5,92,
+16,3,1,25,255,115,0,0,255,255,0,2,255,141,5,146,5,92,16,3,0,120,255,115,0,
+0,255,255,0,2,255,141,5,13,5,92,16,3,0,60,255,115,0,0,0,1,0,143,255,141,3,
+254,5,92,0,11,0,0,1,2,2,17,35,16,18,19,33,53,33,21,3,8,252,229,152,206,233,
+254,73,3,111,4,193,254,200,253,113,254,147,1,123,2,129,1,56,155,155,0,0,1,
+0,143,255,141,3,152,5,92,0,14,0,0,1,6,3,33,21,33,2,17,35,16,18,19,33,53,33,
+3,8,201,114,1,203,253,247,104,152,206,233,254,73,2,121,4,193,246,254,248,
+156,254,198,254,160,1,123,2,129,1,56,155,255,255,0,2,255,141,3,113,5,92,16,
+3,1,30,255,115,0,0,255,255,0,2,255,141,3,11,5,92,16,3,1,31,255,115,0,0,255,
+255,0,2,255,141,2,123,5,92,16,3,0,62,255,115,0,0,255,255,0,143,255,141,2,
+217,5,92,16,2,0,63,0,0,255,255,0,2,255,141,5,13,5,92,16,3,0,39,255,115,0,
+0,255,255,0,2,255,141,5,13,5,92,16,3,0,59,255,115,0,0,0,1,0,143,255,141,6,
+193,5,92,0,19,0,0,37,37,17,33,6,21,20,23,35,38,17,52,55,33,17,1,17,33,21,
+33,1,39,1,92,2,180,61,61,153,60,29,254,156,253,116,6,50,250,102,137,182,2,
+35,253,236,237,255,219,1,17,185,149,254,26,254,172,5,207,155,0,255,255,0,
+143,255,141,6,90,5,92,16,34,0,59,0,0,16,3,1,42,4,172,253,104,255,255,0,2,
+255,141,6,52,5,92,16,3,1,38,255,115,0,0,255,255,0,2,255,141,5,203,5,92,16,
+35,0,59,255,115,0,0,16,3,1,42,4,29,253,104,0,1,0,0,4,193,1,174,5,92,0,3,0,
+0,17,33,21,33,1,174,254,82,5,92,155,0,0,1,0,123,255,141,4,135,5,92,0,22,0,
+0,1,18,17,16,3,54,18,17,16,3,33,21,33,22,21,16,0,33,35,18,17,16,3,1,23,55,
+39,185,173,75,2,69,254,115,43,254,230,254,212,96,55,59,5,92,254,182,254,107,
+254,191,254,237,15,1,95,1,76,1,75,1,46,155,238,246,254,81,254,95,1,82,1,158,
+1,137,1,86,255,255,0,123,255,141,4,33,5,92,16,34,0,53,0,0,16,67,1,42,2,201,
+253,104,51,51,64,0,255,255,255,199,255,141,3,211,5,92,16,3,1,43,255,76,0,
+0,255,255,255,199,255,141,3,106,5,92,16,35,0,53,255,76,0,0,16,67,1,42,2,18,
+253,104,51,51,64,0,255,255,255,199,255,141,2,113,5,92,16,3,0,53,255,76,0,
+0,255,255,255,199,255,141,3,211,5,92,16,3,1,98,255,76,0,0,255,255,255,199,
+255,141,3,106,5,92,16,35,1,97,255,76,0,0,16,67,1,42,2,18,253,104,51,51,64,
+0,255,255,255,199,255,141,2,113,5,92,16,3,1,97,255,76,0,0,0,2,0,143,255,141,
+9,217,5,92,0,59,0,71,0,0,1,38,38,35,34,6,21,20,22,5,2,7,36,37,17,35,17,51,
+17,22,4,23,54,55,38,2,53,52,54,51,50,23,54,54,51,50,22,23,54,36,51,33,21,
+33,6,2,17,20,23,35,38,2,2,38,35,34,6,21,20,23,1,38,53,16,18,55,6,6,7,22,18,
+19,3,225,40,107,96,68,96,235,1,25,161,103,254,242,254,239,152,152,88,1,34,
+101,52,65,234,231,179,145,164,83,29,129,94,66,108,45,119,1,21,219,1,182,254,
+234,105,96,18,235,118,164,89,94,111,59,76,27,2,245,8,90,95,170,252,105,54,
+126,164,3,47,144,126,86,81,147,238,111,254,223,219,124,191,254,168,5,207,
+252,70,67,185,47,110,119,103,1,24,187,140,191,112,86,88,43,54,80,78,155,242,
+254,4,254,217,175,112,169,1,165,1,203,213,90,66,90,86,253,8,54,63,1,49,1,
+250,234,3,55,76,115,253,145,254,222,255,255,0,2,255,141,9,76,5,92,16,3,1,
+51,255,115,0,0,255,255,0,143,255,141,9,115,5,92,18,34,0,61,0,0,16,3,1,42,
+7,197,253,104,255,255,0,2,255,141,8,227,5,92,16,35,0,61,255,115,0,0,16,3,
+1,42,7,53,253,104,255,255,0,2,255,141,8,127,5,92,16,3,0,61,255,115,0,0,0,
+2,0,143,255,92,6,190,5,92,0,22,0,39,0,0,1,6,2,21,20,22,21,20,6,35,34,38,53,
+55,52,38,35,35,17,35,17,33,21,33,33,17,51,50,22,21,7,20,22,51,50,53,52,38,
+53,16,5,94,45,51,33,164,172,172,164,8,123,123,106,152,6,47,253,254,252,107,
+106,199,199,8,93,91,184,33,4,193,127,254,219,195,98,205,86,178,199,201,168,
+131,102,113,253,102,5,207,155,254,2,195,176,131,100,105,213,86,205,98,1,87,
+255,255,0,2,255,92,6,49,5,92,16,3,1,56,255,115,0,0,255,255,0,143,255,92,6,
+88,5,92,16,34,0,27,0,0,16,3,1,42,4,170,253,104,255,255,0,2,255,92,5,201,5,
+92,16,35,0,27,255,115,0,0,16,3,1,42,4,27,253,104,255,255,0,2,255,92,5,17,
+5,92,16,3,0,27,255,115,0,0,0,1,0,143,255,141,5,131,5,92,0,37,0,0,19,22,51,
+51,18,55,33,53,33,21,33,6,6,7,22,22,21,20,6,35,35,34,7,53,54,54,51,51,50,
+54,53,52,38,35,35,34,38,39,143,164,191,149,72,149,253,43,4,244,254,154,115,
+113,26,110,129,207,180,153,192,163,70,186,99,153,108,120,120,108,153,99,186,
+70,3,61,122,1,22,232,155,155,162,254,117,35,170,123,150,198,123,168,53,58,
+99,93,94,101,57,54,0,1,0,143,255,141,5,29,5,92,0,40,0,0,1,34,39,21,22,21,
+20,6,35,35,34,7,53,54,54,51,51,50,54,53,52,38,35,35,34,38,39,53,22,51,51,
+18,55,33,53,33,6,2,7,33,21,4,119,115,70,80,207,180,153,192,163,70,186,99,
+153,108,120,120,108,153,99,186,70,164,191,149,72,149,253,43,4,4,135,193,38,
+1,248,2,39,4,8,76,115,150,198,123,168,53,58,99,93,94,101,57,54,167,122,1,
+22,232,155,164,254,172,161,156,255,255,0,2,255,141,4,246,5,92,16,3,1,61,255,
+115,0,0,255,255,0,2,255,141,4,144,5,92,16,3,1,62,255,115,0,0,0,1,0,0,255,
+141,4,244,5,92,0,33,0,0,1,18,55,33,53,33,21,33,6,2,7,22,22,21,20,6,35,35,
+34,6,7,53,54,54,51,51,50,54,53,52,38,35,33,53,1,248,71,150,253,43,4,244,254,
+153,112,113,29,111,129,208,179,154,98,182,74,70,186,98,154,108,119,120,107,
+254,4,2,195,1,22,232,155,155,162,255,0,115,35,170,123,151,197,67,56,168,53,
+58,99,93,94,101,156,0,0,1,0,0,255,141,4,141,5,92,0,35,0,0,1,34,39,21,22,21,
+20,6,35,35,34,6,7,53,54,54,51,51,50,54,53,52,38,35,33,53,33,18,55,33,53,33,
+0,3,33,21,3,231,114,70,80,208,179,154,98,182,74,70,186,98,154,108,119,120,
+107,254,4,1,248,71,150,253,43,4,4,254,221,75,1,247,2,39,4,8,76,115,151,197,
+67,56,168,53,58,99,93,94,101,156,1,22,232,155,254,160,254,199,156,0,255,255,
+0,2,255,141,4,6,5,92,16,3,0,58,255,115,0,0,0,1,0,0,255,141,4,4,5,92,0,31,
+0,0,1,18,55,33,53,33,6,2,7,22,22,21,20,6,35,35,34,6,7,53,54,54,51,51,50,54,
+53,52,38,35,33,53,1,248,71,150,253,43,4,4,143,186,44,111,129,208,179,154,
+98,182,74,70,186,98,154,108,119,120,107,254,4,2,195,1,22,232,155,175,254,
+180,181,35,170,123,151,197,67,56,168,53,58,99,93,94,101,156,0,1,0,143,255,
+141,5,211,5,92,0,13,0,0,1,33,17,33,21,33,17,33,21,33,17,33,21,33,2,102,254,
+193,3,59,252,45,5,68,253,43,1,100,254,4,4,193,251,104,156,5,207,155,254,2,
+156,0,0,1,0,143,255,141,5,31,5,92,0,13,0,0,1,33,17,33,21,33,17,33,21,33,17,
+33,21,33,2,102,254,193,3,59,252,45,3,211,254,156,2,33,253,71,4,193,251,104,
+156,5,207,155,254,2,156,0,255,255,0,2,255,141,5,70,5,92,16,3,1,69,255,115,
+0,0,255,255,0,2,255,141,4,146,5,92,16,3,1,70,255,115,0,0,255,255,0,2,255,
+141,3,213,5,92,16,3,0,20,255,115,0,0,0,1,0,143,255,141,5,252,5,92,0,34,0,
+0,1,6,21,20,23,51,50,22,21,20,4,33,35,53,51,50,54,53,52,35,35,38,53,52,54,
+55,53,6,35,33,17,35,17,33,21,3,119,209,27,83,204,192,254,239,254,242,139,
+139,201,182,236,190,76,82,88,45,53,254,213,152,5,109,4,193,190,206,71,43,
+202,169,211,240,156,164,131,215,115,149,117,188,94,7,4,250,204,5,207,155,
+0,1,0,143,255,141,5,150,5,92,0,39,0,0,5,35,53,51,50,54,53,52,35,35,38,53,
+52,54,55,53,6,35,33,17,35,17,33,21,33,6,21,20,23,33,21,35,34,39,21,22,22,
+21,20,4,2,129,139,139,201,182,236,190,76,82,88,45,53,254,213,152,3,252,254,
+236,209,27,2,213,183,95,56,41,47,254,239,115,156,164,131,215,115,149,117,
+188,94,7,4,250,204,5,207,155,190,206,71,43,156,4,6,31,117,65,211,240,255,
+255,0,2,255,141,5,111,5,92,16,3,1,74,255,115,0,0,255,255,0,2,255,141,5,9,
+5,92,16,3,1,75,255,115,0,0,255,255,0,2,255,141,4,19,5,92,16,3,0,30,255,115,
+0,0,255,255,255,250,255,141,4,139,5,92,16,2,0,230,168,0,255,255,255,250,255,
+141,4,76,5,92,16,34,0,52,168,0,16,3,1,42,2,158,253,104,0,1,0,0,255,129,4,
+115,5,92,0,36,0,0,17,51,18,37,53,6,35,33,53,33,21,33,4,0,21,20,22,51,50,54,
+53,52,38,39,55,22,22,21,20,6,35,34,38,53,52,55,35,94,141,1,52,68,127,254,
+164,4,115,254,143,254,202,254,212,121,106,113,110,81,101,82,129,131,199,184,
+178,209,35,35,2,195,1,28,223,9,6,155,155,216,254,73,249,135,141,139,127,91,
+144,46,131,62,213,141,194,232,236,204,117,121,0,1,0,0,255,129,4,12,5,92,0,
+36,0,0,17,51,18,37,53,6,35,33,53,33,21,4,0,21,20,22,51,50,54,53,52,39,55,
+33,21,33,22,21,20,6,35,34,38,53,52,55,35,94,141,1,52,68,127,254,164,3,2,254,
+202,254,212,121,106,113,110,174,70,2,18,254,168,78,199,184,178,209,35,35,
+2,195,1,28,223,9,6,155,155,216,254,73,249,135,141,139,127,185,87,132,156,
+105,147,194,232,236,204,117,121,0,0,1,0,0,255,129,3,2,5,92,0,35,0,0,17,51,
+18,37,53,6,35,33,53,33,21,4,0,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,
+6,35,34,38,53,52,55,35,94,141,1,52,68,127,254,164,3,2,254,202,254,212,121,
+106,113,110,81,101,82,129,131,199,184,178,209,35,35,2,195,1,28,223,9,6,155,
+155,216,254,73,249,135,141,139,127,91,144,46,131,62,213,141,194,232,236,204,
+117,121,0,255,255,0,143,255,141,5,154,5,92,18,2,0,39,0,0,0,1,0,143,255,141,
+6,193,5,92,0,22,0,0,1,17,33,17,33,6,21,20,23,33,21,33,38,17,52,55,33,17,33,
+17,33,6,7,1,39,1,92,2,180,61,29,1,170,253,221,60,29,254,156,253,116,5,11,
+23,14,4,193,251,104,3,57,253,236,168,168,156,219,1,17,185,149,252,198,5,207,
+80,75,0,255,255,0,2,255,141,5,199,5,92,16,35,0,39,255,115,0,0,16,3,1,42,4,
+25,253,104,255,255,0,2,255,141,6,52,5,92,16,3,1,85,255,115,0,0,0,1,0,143,
+255,141,5,154,5,92,0,32,0,0,5,39,6,35,34,38,53,52,54,55,38,39,6,7,17,35,17,
+51,17,54,55,22,19,6,6,21,20,22,51,50,55,22,23,4,238,109,116,146,182,234,160,
+135,57,62,160,196,152,152,201,219,103,161,204,140,141,115,158,151,116,118,
+115,205,82,227,179,153,205,74,97,132,82,153,252,69,5,207,254,168,146,108,
+219,254,223,90,168,102,117,125,152,225,214,0,0,1,0,143,255,141,6,51,5,92,
+0,38,0,0,5,35,34,38,39,6,35,34,38,53,52,54,55,38,39,6,7,17,35,17,51,17,54,
+55,22,19,6,6,21,20,22,51,50,55,30,2,51,51,6,51,61,137,185,51,113,149,182,
+234,160,135,57,62,160,196,152,152,201,219,103,161,204,140,141,115,158,151,
+63,83,110,70,61,115,117,90,84,227,179,153,205,74,97,132,82,153,252,69,5,207,
+254,168,146,108,219,254,223,90,168,102,117,125,152,130,104,49,0,1,0,143,255,
+141,6,31,5,92,0,38,0,0,1,35,34,14,3,35,34,38,53,52,54,55,38,39,6,7,17,35,
+17,51,17,54,55,22,19,6,6,21,20,22,51,50,54,18,54,51,51,6,31,41,82,94,88,118,
+161,104,177,227,160,135,57,62,160,196,152,152,201,219,103,161,204,140,133,
+111,121,123,111,158,134,41,2,39,115,212,144,72,228,178,153,205,74,97,132,
+82,153,252,69,5,207,254,168,146,108,219,254,223,90,168,102,117,125,114,1,
+12,153,0,0,1,0,143,255,141,4,207,5,104,0,33,0,0,5,33,17,51,17,33,50,23,53,
+36,0,53,52,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,0,5,4,207,
+251,192,152,2,2,126,69,254,254,254,227,209,178,180,203,131,129,82,101,81,
+110,113,107,120,1,42,1,56,115,5,207,250,205,6,8,183,1,219,243,205,235,229,
+197,141,213,61,131,46,143,91,127,140,142,135,250,254,77,218,0,1,0,143,255,
+141,6,63,5,104,0,34,0,0,5,33,17,51,17,33,50,23,53,36,0,53,52,54,51,50,22,
+21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,0,5,33,6,63,250,80,152,2,2,126,
+69,254,254,254,227,209,178,180,203,131,129,82,101,81,110,113,107,120,1,42,
+1,56,1,112,115,5,207,250,205,6,8,183,1,219,243,205,235,229,197,141,213,61,
+131,46,143,91,127,140,142,135,250,254,77,218,0,0,1,0,143,255,127,6,106,5,
+92,0,45,0,0,23,17,51,17,51,54,54,51,50,22,21,20,7,39,54,54,53,52,38,35,34,
+6,21,20,18,51,50,18,53,16,0,33,53,32,0,17,16,0,33,34,0,17,53,55,35,17,143,
+152,229,45,183,122,155,198,117,129,41,45,106,87,98,125,212,184,199,237,254,
+148,254,184,1,150,1,189,254,179,254,250,249,254,206,2,199,115,5,207,253,103,
+124,136,208,155,196,119,100,41,117,57,94,105,152,162,198,255,0,1,39,241,1,
+53,1,81,155,254,93,254,130,254,204,254,120,1,89,1,17,33,29,253,102,0,255,
+255,0,143,255,127,7,184,5,92,16,34,1,93,0,0,16,3,1,42,6,10,253,104,0,1,0,
+143,255,141,5,72,5,92,0,17,0,0,1,2,3,35,22,21,17,33,21,33,17,51,17,33,17,
+51,18,1,4,121,226,122,9,7,2,45,251,71,152,1,92,250,155,1,31,1,211,1,82,1,
+145,71,154,252,84,156,5,207,250,205,5,51,253,246,254,129,0,1,0,143,255,141,
+6,184,5,92,0,17,0,0,1,2,3,35,22,21,17,33,21,33,17,51,17,33,17,51,18,1,4,121,
+226,122,9,7,3,157,249,215,152,1,92,250,155,1,31,1,211,1,82,1,145,71,154,252,
+84,156,5,207,250,205,5,51,253,246,254,129,0,1,0,123,255,141,3,37,5,92,0,20,
+0,0,23,18,17,16,3,51,32,0,17,16,3,35,18,17,16,2,39,18,17,16,3,123,59,55,96,
+1,44,1,26,76,151,75,164,194,39,55,115,1,86,1,138,1,157,1,82,254,95,254,81,
+254,173,254,212,1,48,1,73,1,67,1,102,18,254,237,254,191,254,106,254,182,0,
+1,0,123,255,141,4,135,5,92,0,22,0,0,23,18,17,16,3,51,32,0,17,20,7,33,21,33,
+18,17,16,2,39,18,17,16,3,123,59,55,96,1,44,1,26,43,1,141,253,187,75,164,194,
+39,55,115,1,86,1,138,1,157,1,82,254,95,254,81,248,235,156,1,48,1,73,1,67,
+1,102,18,254,237,254,191,254,106,254,182,0,2,0,143,255,141,5,170,5,92,0,14,
+0,25,0,0,1,6,3,33,21,33,34,36,39,17,33,21,33,17,33,1,22,22,23,54,18,55,53,
+6,35,33,4,160,211,103,2,68,253,145,165,254,251,106,3,121,251,239,4,17,252,
+135,98,195,129,33,147,104,90,120,254,16,4,193,215,254,217,156,47,59,253,152,
+156,5,207,253,225,65,51,4,129,1,12,106,9,4,0,1,2,88,255,56,4,46,5,178,0,7,
+0,0,5,37,17,37,23,5,17,5,3,245,254,99,1,157,57,254,194,1,62,200,205,4,224,
+205,135,154,251,200,154,0,0,1,0,130,255,56,2,88,5,178,0,7,0,0,23,37,17,37,
+55,5,17,5,130,1,62,254,194,57,1,157,254,99,65,154,4,56,154,135,205,251,32,
+205,0,2,0,102,0,29,2,203,0,250,0,11,0,23,0,0,54,22,21,20,6,35,34,38,53,52,
+54,51,32,22,21,20,6,35,34,38,53,52,54,51,250,55,53,49,42,59,58,43,1,196,60,
+61,42,42,58,53,47,250,54,55,54,58,53,59,59,50,50,59,59,53,52,60,54,55,0,3,
+0,102,0,29,4,100,0,250,0,11,0,23,0,35,0,0,54,22,21,20,6,35,34,38,53,52,54,
+51,32,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,
+250,55,53,49,42,59,58,43,1,196,60,61,42,42,58,53,47,1,201,55,53,49,42,58,
+53,47,250,54,55,54,58,53,59,59,50,50,59,59,53,52,60,54,55,54,55,54,58,52,
+60,54,55,0,0,2,0,80,255,202,6,39,5,161,0,15,0,27,0,0,0,4,18,21,20,2,4,35,
+34,36,2,53,52,18,36,51,18,0,53,52,0,35,34,0,21,20,0,51,4,1,1,93,201,202,254,
+166,201,202,254,169,201,200,1,91,199,249,1,102,254,155,249,250,254,157,1,
+100,249,5,161,201,254,163,199,199,254,165,200,201,1,87,202,201,1,90,202,250,
+183,1,99,250,249,1,101,254,154,248,249,254,156,0,0,1,2,18,254,247,4,46,5,
+178,0,5,0,0,1,1,35,1,1,51,2,180,1,122,165,254,137,1,88,165,2,117,252,130,
+3,126,3,61,0,1,0,130,254,247,2,158,5,178,0,5,0,0,19,51,1,1,35,1,161,165,1,
+88,254,137,165,1,122,5,178,252,195,252,130,3,126,0,0,2,1,174,254,247,5,10,
+5,178,0,5,0,11,0,0,1,1,35,1,1,51,1,1,35,1,1,51,3,144,1,122,165,254,137,1,
+88,165,253,101,1,122,165,254,137,1,88,165,2,117,252,130,3,126,3,61,252,195,
+252,130,3,126,3,61,0,2,0,100,254,247,3,192,5,178,0,5,0,11,0,0,19,51,1,1,35,
+1,3,51,1,1,35,1,131,165,1,88,254,137,165,1,122,27,165,1,88,254,137,165,1,
+122,5,178,252,195,252,130,3,126,3,61,252,195,252,130,3,126,0,1,2,88,255,56,
+4,66,5,178,0,5,0,0,1,21,33,17,35,17,4,66,254,174,152,5,178,144,250,22,6,122,
+0,1,0,110,255,56,2,88,5,178,0,5,0,0,23,53,33,17,51,17,110,1,82,152,200,144,
+5,234,249,134,0,2,1,244,255,56,4,126,5,178,0,5,0,11,0,0,1,17,33,17,33,17,
+23,17,51,17,33,53,4,126,254,227,254,147,125,115,1,29,5,178,254,172,250,218,
+6,122,115,250,108,5,38,110,0,2,0,100,255,56,2,238,5,178,0,5,0,11,0,0,23,17,
+33,17,33,17,39,17,35,17,33,21,100,1,29,1,109,125,115,254,227,200,1,84,5,38,
+249,134,115,5,148,250,218,110,0,1,1,244,255,57,4,76,5,178,0,7,0,0,1,6,2,21,
+16,1,33,17,4,76,189,209,1,127,253,183,5,178,145,254,92,238,254,32,254,138,
+6,121,0,1,0,100,255,57,2,188,5,178,0,7,0,0,1,17,33,0,17,52,2,39,2,188,253,
+183,1,127,209,189,5,178,249,135,1,118,1,224,238,1,164,145,0,2,1,244,255,57,
+4,126,5,178,0,8,0,17,0,0,1,6,2,21,20,18,23,33,17,23,17,33,38,2,53,52,18,55,
+4,126,127,162,144,122,253,141,120,1,28,76,92,102,86,5,178,135,254,38,242,
+237,254,75,132,6,121,115,250,109,115,1,126,191,200,1,151,132,0,2,0,100,255,
+57,2,238,5,178,0,8,0,17,0,0,1,17,33,54,18,53,52,2,39,23,22,18,21,20,2,7,33,
+17,2,238,253,141,122,144,162,127,226,86,102,92,76,1,28,5,178,249,135,132,
+1,181,237,242,1,218,135,115,132,254,105,200,191,254,130,115,5,147,0,2,2,38,
+255,56,4,26,5,178,0,7,0,11,0,0,5,7,37,17,37,23,7,17,39,23,17,7,4,26,64,254,
+76,1,180,64,138,242,122,122,100,100,245,4,144,245,100,79,250,236,132,63,4,
+138,63,0,0,2,0,150,255,56,2,138,5,178,0,7,0,11,0,0,5,17,39,55,5,17,5,39,1,
+39,17,55,1,32,138,64,1,180,254,76,64,1,124,122,122,21,5,20,79,100,245,251,
+112,245,100,4,223,63,251,118,63,0,0,2,1,244,255,56,4,36,5,178,0,7,0,11,0,
+0,1,21,35,17,51,21,33,17,19,51,17,35,4,36,195,195,253,208,125,115,115,5,178,
+130,250,138,130,6,122,250,8,5,118,0,0,2,0,140,255,56,2,188,5,178,0,7,0,11,
+0,0,1,17,33,53,51,17,35,53,5,35,17,51,2,188,253,208,195,195,1,179,115,115,
+5,178,249,134,130,5,118,130,130,250,138,0,0,1,255,220,0,0,1,174,5,204,0,10,
+0,0,1,7,39,55,33,17,35,17,33,39,55,1,174,217,49,137,254,246,71,1,81,137,49,
+4,245,214,49,130,251,46,5,25,130,49,0,1,254,81,0,0,0,35,5,204,0,10,0,0,51,
+35,17,33,23,7,39,55,23,7,33,35,71,254,246,137,49,217,217,49,137,1,81,4,210,
+130,49,214,215,49,130,0,0,8,0,80,255,248,4,148,4,62,0,5,0,11,0,17,0,23,0,
+29,0,35,0,41,0,47,0,0,1,38,39,55,22,23,1,38,39,53,22,23,19,6,7,39,54,55,1,
+6,7,39,54,55,1,6,7,35,54,55,1,6,7,53,54,55,37,38,39,51,22,23,1,38,39,55,22,
+23,4,71,22,70,54,98,17,254,246,99,117,141,129,212,14,95,57,71,15,253,231,
+119,95,55,124,145,254,203,71,16,77,15,94,3,1,123,147,119,94,253,59,95,19,
+79,20,73,1,47,142,129,57,92,122,2,92,124,95,57,127,149,1,60,71,15,80,14,95,
+254,7,143,129,58,99,115,2,22,19,73,58,95,19,254,246,99,117,149,125,252,251,
+94,19,79,20,72,40,124,145,119,95,254,250,15,94,55,69,15,0,4,0,110,2,77,6,
+5,3,42,0,11,0,23,0,35,0,47,0,0,0,22,21,20,6,35,34,38,53,52,54,51,32,22,21,
+20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,
+6,35,34,38,53,52,54,51,1,2,55,53,49,42,59,58,43,1,196,60,61,42,42,58,53,47,
+1,201,55,53,49,42,58,53,47,1,200,55,53,49,42,58,53,47,3,42,54,55,54,58,53,
+59,59,50,50,59,59,53,52,60,54,55,54,55,54,58,52,60,54,55,54,55,54,58,52,60,
+54,55,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,
+3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,
+0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,30,0,248,0,3,0,1,4,9,0,
+7,0,68,1,22,0,3,0,1,4,9,0,8,0,42,1,90,0,3,0,1,4,9,0,9,0,40,1,132,0,3,0,1,
+4,9,0,10,0,96,1,172,0,3,0,1,4,9,0,11,0,62,2,12,0,3,0,1,4,9,0,12,0,60,2,74,
+0,3,0,1,4,9,0,13,2,150,2,134,0,3,0,1,4,9,0,14,0,52,5,28,0,67,0,111,0,112,
+0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,
+111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,
+0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,
+0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,
+0,32,0,80,0,104,0,97,0,103,0,115,0,32,0,80,0,97,0,82,0,101,0,103,0,117,0,
+108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,
+109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,
+32,0,83,0,97,0,110,0,115,0,32,0,80,0,104,0,97,0,103,0,115,0,32,0,80,0,97,
+0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,32,0,
+117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,80,0,104,0,97,0,
+103,0,115,0,80,0,97,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,
+0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,
+0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,
+0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,
+0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,
+0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,
+0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,
+0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,
+0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,
+0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,
+0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,
+0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,
+101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,
+115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,
+46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,
+0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,
+0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,
+83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,
+0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,
+0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,
+0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,
+101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,
+0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,
+0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,
+0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,
+0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,
+0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,
+0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,
+117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,181,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,126,0,0,1,2,0,2,0,3,0,4,0,34,1,3,1,4,1,5,1,6,1,7,1,8,1,9,
+1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,
+1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,
+1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,
+1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,
+1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,
+1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,
+1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,
+112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,
+1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,
+137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,
+1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,
+162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,
+1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,
+187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,
+1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,
+212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,
+1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,
+237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,
+1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,
+9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,
+24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,
+2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,
+2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,
+2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,
+2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,
+2,99,0,171,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,
+110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,4,110,
+117,108,108,7,117,110,105,49,56,48,50,7,117,110,105,49,56,48,51,7,117,110,
+105,49,56,48,53,4,90,87,78,74,3,90,87,74,7,117,110,105,51,48,48,49,7,117,
+110,105,51,48,48,50,7,117,110,105,65,56,52,48,7,117,110,105,65,56,52,49,7,
+117,110,105,65,56,52,50,7,117,110,105,65,56,52,51,7,117,110,105,65,56,52,
+52,7,117,110,105,65,56,52,53,7,117,110,105,65,56,52,54,7,117,110,105,65,56,
+52,55,7,117,110,105,65,56,52,56,7,117,110,105,65,56,52,57,7,117,110,105,65,
+56,52,65,7,117,110,105,65,56,52,66,7,117,110,105,65,56,52,67,7,117,110,105,
+65,56,52,68,7,117,110,105,65,56,52,69,7,117,110,105,65,56,52,70,7,117,110,
+105,65,56,53,48,7,117,110,105,65,56,53,49,7,117,110,105,65,56,53,50,7,117,
+110,105,65,56,53,51,7,117,110,105,65,56,53,52,7,117,110,105,65,56,53,53,7,
+117,110,105,65,56,53,54,7,117,110,105,65,56,53,55,7,117,110,105,65,56,53,
+56,7,117,110,105,65,56,53,57,7,117,110,105,65,56,53,65,7,117,110,105,65,56,
+53,66,7,117,110,105,65,56,53,67,7,117,110,105,65,56,53,68,7,117,110,105,65,
+56,53,69,7,117,110,105,65,56,53,70,7,117,110,105,65,56,54,48,7,117,110,105,
+65,56,54,49,7,117,110,105,65,56,54,50,7,117,110,105,65,56,54,51,7,117,110,
+105,65,56,54,52,7,117,110,105,65,56,54,53,7,117,110,105,65,56,54,54,7,117,
+110,105,65,56,54,55,7,117,110,105,65,56,54,56,7,117,110,105,65,56,54,57,7,
+117,110,105,65,56,54,65,7,117,110,105,65,56,54,66,7,117,110,105,65,56,54,
+67,7,117,110,105,65,56,54,68,7,117,110,105,65,56,54,69,7,117,110,105,65,56,
+54,70,7,117,110,105,65,56,55,48,7,117,110,105,65,56,55,49,7,117,110,105,65,
+56,55,50,7,117,110,105,65,56,55,51,7,117,110,105,65,56,55,52,7,117,110,105,
+65,56,55,53,7,117,110,105,65,56,55,54,7,117,110,105,65,56,55,55,7,117,110,
+105,70,69,48,48,11,117,110,105,65,56,53,66,46,102,105,110,11,117,110,105,
+65,56,53,55,46,105,110,105,11,117,110,105,65,56,53,55,46,109,101,100,11,117,
+110,105,65,56,52,70,46,105,110,105,11,117,110,105,65,56,52,70,46,109,101,
+100,11,117,110,105,65,56,53,68,46,102,105,110,11,117,110,105,65,56,53,68,
+46,105,110,105,15,117,110,105,65,56,53,68,46,105,110,105,46,99,110,116,11,
+117,110,105,65,56,53,68,46,109,101,100,11,117,110,105,65,56,53,66,46,105,
+110,105,11,117,110,105,65,56,53,66,46,109,101,100,15,117,110,105,65,56,53,
+66,46,105,110,105,46,99,110,116,15,117,110,105,65,56,53,68,46,109,101,100,
+46,99,110,116,11,117,110,105,65,56,53,69,46,105,110,105,11,117,110,105,65,
+56,53,69,46,109,101,100,11,117,110,105,65,56,53,69,46,102,105,110,11,117,
+110,105,65,56,52,51,46,105,110,105,11,117,110,105,65,56,52,51,46,102,105,
+110,11,117,110,105,65,56,53,55,46,102,105,110,11,117,110,105,65,56,54,48,
+46,105,110,105,11,117,110,105,65,56,54,48,46,109,101,100,11,117,110,105,65,
+56,54,48,46,102,105,110,11,117,110,105,65,56,54,49,46,109,101,100,11,117,
+110,105,65,56,54,49,46,102,105,110,11,117,110,105,65,56,54,49,46,105,110,
+105,11,117,110,105,65,56,53,70,46,105,110,105,11,117,110,105,65,56,53,67,
+46,105,110,105,11,117,110,105,65,56,53,67,46,109,101,100,11,117,110,105,65,
+56,53,70,46,109,101,100,11,117,110,105,65,56,53,70,46,102,105,110,11,117,
+110,105,65,56,52,48,46,105,110,105,11,117,110,105,65,56,52,48,46,109,101,
+100,11,117,110,105,65,56,52,48,46,102,105,110,11,117,110,105,65,56,53,67,
+46,102,105,110,15,117,110,105,65,56,52,48,46,105,110,105,46,99,110,116,11,
+117,110,105,65,56,52,66,46,105,110,105,11,117,110,105,65,56,52,66,46,109,
+101,100,11,117,110,105,65,56,52,66,46,102,105,110,15,117,110,105,65,56,52,
+48,46,109,101,100,46,99,110,116,11,117,110,105,65,56,54,50,46,105,110,105,
+11,117,110,105,65,56,54,50,46,102,105,110,11,117,110,105,65,56,54,50,46,109,
+101,100,11,117,110,105,65,56,52,56,46,105,110,105,11,117,110,105,65,56,52,
+56,46,109,101,100,11,117,110,105,65,56,52,56,46,102,105,110,11,117,110,105,
+65,56,52,70,46,102,105,110,15,117,110,105,65,56,54,48,46,105,110,105,46,99,
+110,116,15,117,110,105,65,56,54,48,46,109,101,100,46,99,110,116,15,117,110,
+105,65,56,53,69,46,105,110,105,46,99,110,116,15,117,110,105,65,56,53,69,46,
+109,101,100,46,99,110,116,15,117,110,105,65,56,53,67,46,105,110,105,46,99,
+110,116,15,117,110,105,65,56,53,67,46,109,101,100,46,99,110,116,15,117,110,
+105,65,56,52,56,46,105,110,105,46,99,110,116,15,117,110,105,65,56,52,56,46,
+109,101,100,46,99,110,116,15,117,110,105,65,56,52,66,46,105,110,105,46,99,
+110,116,15,117,110,105,65,56,52,66,46,109,101,100,46,99,110,116,11,117,110,
+105,65,56,52,49,46,105,110,105,15,117,110,105,65,56,52,51,46,105,110,105,
+46,99,110,116,15,117,110,105,65,56,53,66,46,109,101,100,46,99,110,116,15,
+117,110,105,65,56,53,55,46,105,110,105,46,99,110,116,15,117,110,105,65,56,
+53,55,46,109,101,100,46,99,110,116,15,117,110,105,65,56,53,70,46,109,101,
+100,46,99,110,116,11,117,110,105,65,56,53,52,46,105,110,105,15,117,110,105,
+65,56,53,52,46,105,110,105,46,99,110,116,11,117,110,105,65,56,53,52,46,109,
+101,100,15,117,110,105,65,56,53,52,46,109,101,100,46,99,110,116,11,117,110,
+105,65,56,53,52,46,102,105,110,15,117,110,105,65,56,52,70,46,105,110,105,
+46,99,110,116,15,117,110,105,65,56,52,70,46,109,101,100,46,99,110,116,11,
+117,110,105,65,56,53,48,46,105,110,105,11,117,110,105,65,56,53,48,46,109,
+101,100,11,117,110,105,65,56,53,48,46,102,105,110,15,117,110,105,65,56,53,
+48,46,105,110,105,46,99,110,116,15,117,110,105,65,56,53,48,46,109,101,100,
+46,99,110,116,11,117,110,105,65,56,52,51,46,109,101,100,15,117,110,105,65,
+56,52,51,46,109,101,100,46,99,110,116,11,117,110,105,65,56,52,54,46,105,110,
+105,15,117,110,105,65,56,52,54,46,105,110,105,46,99,110,116,11,117,110,105,
+65,56,52,54,46,109,101,100,15,117,110,105,65,56,52,54,46,109,101,100,46,99,
+110,116,11,117,110,105,65,56,52,54,46,102,105,110,11,117,110,105,65,56,52,
+57,46,105,110,105,15,117,110,105,65,56,52,57,46,105,110,105,46,99,110,116,
+11,117,110,105,65,56,52,57,46,109,101,100,15,117,110,105,65,56,52,57,46,109,
+101,100,46,99,110,116,11,117,110,105,65,56,52,57,46,102,105,110,11,117,110,
+105,65,56,52,65,46,105,110,105,15,117,110,105,65,56,52,65,46,105,110,105,
+46,99,110,116,11,117,110,105,65,56,52,65,46,109,101,100,15,117,110,105,65,
+56,52,65,46,109,101,100,46,99,110,116,11,117,110,105,65,56,52,65,46,102,105,
+110,11,117,110,105,65,56,52,52,46,105,110,105,15,117,110,105,65,56,52,52,
+46,105,110,105,46,99,110,116,11,117,110,105,65,56,52,52,46,109,101,100,15,
+117,110,105,65,56,52,52,46,109,101,100,46,99,110,116,11,117,110,105,65,56,
+52,52,46,102,105,110,11,117,110,105,65,56,52,53,46,105,110,105,15,117,110,
+105,65,56,52,53,46,105,110,105,46,99,110,116,11,117,110,105,65,56,52,53,46,
+109,101,100,15,117,110,105,65,56,52,53,46,109,101,100,46,99,110,116,11,117,
+110,105,65,56,52,53,46,102,105,110,11,117,110,105,65,56,52,67,46,105,110,
+105,15,117,110,105,65,56,52,67,46,105,110,105,46,99,110,116,11,117,110,105,
+65,56,52,67,46,109,101,100,15,117,110,105,65,56,52,67,46,109,101,100,46,99,
+110,116,11,117,110,105,65,56,52,67,46,102,105,110,11,117,110,105,65,56,52,
+68,46,105,110,105,15,117,110,105,65,56,52,68,46,105,110,105,46,99,110,116,
+11,117,110,105,65,56,52,68,46,109,101,100,15,117,110,105,65,56,52,68,46,109,
+101,100,46,99,110,116,11,117,110,105,65,56,52,68,46,102,105,110,11,117,110,
+105,65,56,53,50,46,105,110,105,15,117,110,105,65,56,53,50,46,105,110,105,
+46,99,110,116,11,117,110,105,65,56,53,50,46,109,101,100,15,117,110,105,65,
+56,53,50,46,109,101,100,46,99,110,116,11,117,110,105,65,56,53,50,46,102,105,
+110,11,117,110,105,65,56,53,53,46,105,110,105,15,117,110,105,65,56,53,53,
+46,105,110,105,46,99,110,116,11,117,110,105,65,56,53,53,46,109,101,100,15,
+117,110,105,65,56,53,53,46,109,101,100,46,99,110,116,11,117,110,105,65,56,
+53,53,46,102,105,110,11,117,110,105,65,56,53,54,46,105,110,105,15,117,110,
+105,65,56,53,54,46,105,110,105,46,99,110,116,11,117,110,105,65,56,53,54,46,
+109,101,100,15,117,110,105,65,56,53,54,46,109,101,100,46,99,110,116,11,117,
+110,105,65,56,53,54,46,102,105,110,11,117,110,105,65,56,53,56,46,105,110,
+105,15,117,110,105,65,56,53,56,46,105,110,105,46,99,110,116,11,117,110,105,
+65,56,53,56,46,109,101,100,15,117,110,105,65,56,53,56,46,109,101,100,46,99,
+110,116,11,117,110,105,65,56,53,56,46,102,105,110,11,117,110,105,65,56,54,
+54,46,105,110,105,15,117,110,105,65,56,54,54,46,105,110,105,46,99,110,116,
+11,117,110,105,65,56,54,54,46,109,101,100,15,117,110,105,65,56,54,54,46,109,
+101,100,46,99,110,116,11,117,110,105,65,56,54,54,46,102,105,110,11,117,110,
+105,65,56,53,65,46,105,110,105,15,117,110,105,65,56,53,65,46,105,110,105,
+46,99,110,116,11,117,110,105,65,56,53,65,46,109,101,100,15,117,110,105,65,
+56,53,65,46,109,101,100,46,99,110,116,11,117,110,105,65,56,53,65,46,102,105,
+110,15,117,110,105,65,56,52,49,46,105,110,105,46,99,110,116,11,117,110,105,
+65,56,52,49,46,109,101,100,15,117,110,105,65,56,52,49,46,109,101,100,46,99,
+110,116,11,117,110,105,65,56,52,49,46,102,105,110,11,117,110,105,65,56,52,
+50,46,105,110,105,15,117,110,105,65,56,52,50,46,105,110,105,46,99,110,116,
+11,117,110,105,65,56,52,50,46,109,101,100,15,117,110,105,65,56,52,50,46,109,
+101,100,46,99,110,116,11,117,110,105,65,56,52,50,46,102,105,110,11,117,110,
+105,65,56,53,57,46,105,110,105,15,117,110,105,65,56,53,57,46,105,110,105,
+46,99,110,116,11,117,110,105,65,56,53,57,46,109,101,100,15,117,110,105,65,
+56,53,57,46,109,101,100,46,99,110,116,11,117,110,105,65,56,53,57,46,102,105,
+110,11,117,110,105,65,56,53,51,46,105,110,105,15,117,110,105,65,56,53,51,
+46,105,110,105,46,99,110,116,11,117,110,105,65,56,53,51,46,109,101,100,15,
+117,110,105,65,56,53,51,46,109,101,100,46,99,110,116,11,117,110,105,65,56,
+53,51,46,102,105,110,11,117,110,105,65,56,54,55,46,105,110,105,11,117,110,
+105,65,56,54,55,46,102,105,110,15,117,110,105,65,56,54,55,46,105,110,105,
+46,99,110,116,11,117,110,105,65,56,54,52,46,105,110,105,15,117,110,105,65,
+56,54,52,46,105,110,105,46,99,110,116,11,117,110,105,65,56,54,52,46,109,101,
+100,15,117,110,105,65,56,54,52,46,109,101,100,46,99,110,116,11,117,110,105,
+65,56,54,52,46,102,105,110,11,117,110,105,65,56,54,53,46,105,110,105,15,117,
+110,105,65,56,54,50,46,109,101,100,46,99,110,116,15,117,110,105,65,56,54,
+53,46,105,110,105,46,99,110,116,11,117,110,105,65,56,54,53,46,109,101,100,
+15,117,110,105,65,56,54,53,46,109,101,100,46,99,110,116,11,117,110,105,65,
+56,54,53,46,102,105,110,11,117,110,105,65,56,54,57,46,105,110,105,15,117,
+110,105,65,56,54,57,46,105,110,105,46,99,110,116,11,117,110,105,65,56,54,
+57,46,109,101,100,15,117,110,105,65,56,54,57,46,109,101,100,46,99,110,116,
+11,117,110,105,65,56,54,57,46,102,105,110,11,117,110,105,65,56,54,65,46,105,
+110,105,15,117,110,105,65,56,54,65,46,105,110,105,46,99,110,116,11,117,110,
+105,65,56,54,65,46,109,101,100,15,117,110,105,65,56,54,65,46,109,101,100,
+46,99,110,116,11,117,110,105,65,56,54,65,46,102,105,110,15,117,110,105,65,
+56,53,70,46,109,105,114,46,109,101,100,19,117,110,105,65,56,53,70,46,109,
+105,114,46,109,101,100,46,99,110,116,15,117,110,105,65,56,53,70,46,109,105,
+114,46,102,105,110,11,117,110,105,65,56,54,51,46,105,110,105,11,117,110,105,
+65,56,54,51,46,109,101,100,15,117,110,105,65,56,54,51,46,109,101,100,46,99,
+110,116,11,117,110,105,65,56,54,51,46,102,105,110,15,117,110,105,65,56,54,
+51,46,105,110,105,46,99,110,116,15,117,110,105,65,56,54,48,46,109,105,114,
+46,109,101,100,19,117,110,105,65,56,54,48,46,109,105,114,46,109,101,100,46,
+99,110,116,15,117,110,105,65,56,54,48,46,109,105,114,46,102,105,110,11,117,
+110,105,65,56,54,66,46,105,110,105,15,117,110,105,65,56,54,66,46,105,110,
+105,46,99,110,116,11,117,110,105,65,56,54,66,46,109,101,100,15,117,110,105,
+65,56,54,66,46,109,101,100,46,99,110,116,11,117,110,105,65,56,54,66,46,102,
+105,110,11,117,110,105,65,56,54,67,46,105,110,105,15,117,110,105,65,56,54,
+67,46,105,110,105,46,99,110,116,11,117,110,105,65,56,54,67,46,109,101,100,
+15,117,110,105,65,56,54,67,46,109,101,100,46,99,110,116,11,117,110,105,65,
+56,54,67,46,102,105,110,15,117,110,105,65,56,53,67,46,109,105,114,46,109,
+101,100,19,117,110,105,65,56,53,67,46,109,105,114,46,109,101,100,46,99,110,
+116,15,117,110,105,65,56,53,67,46,109,105,114,46,102,105,110,15,117,110,105,
+65,56,53,69,46,109,105,114,46,109,101,100,19,117,110,105,65,56,53,69,46,109,
+105,114,46,109,101,100,46,99,110,116,15,117,110,105,65,56,53,69,46,109,105,
+114,46,102,105,110,11,117,110,105,65,56,54,70,46,105,110,105,15,117,110,105,
+65,56,54,70,46,105,110,105,46,99,110,116,11,117,110,105,65,56,54,70,46,109,
+101,100,15,117,110,105,65,56,54,70,46,109,101,100,46,99,110,116,11,117,110,
+105,65,56,54,70,46,102,105,110,11,117,110,105,65,56,55,49,46,105,110,105,
+15,117,110,105,65,56,55,49,46,105,110,105,46,99,110,116,11,117,110,105,65,
+56,55,49,46,109,101,100,15,117,110,105,65,56,55,49,46,109,101,100,46,99,110,
+116,11,117,110,105,65,56,55,49,46,102,105,110,11,117,110,105,65,56,55,50,
+46,105,110,105,15,117,110,105,65,56,53,54,46,109,105,114,46,102,105,110,11,
+117,110,105,65,56,54,69,46,102,105,110,11,117,110,105,65,56,54,69,46,105,
+110,105,15,117,110,105,65,56,54,69,46,105,110,105,46,99,110,116,11,117,110,
+105,65,56,54,69,46,109,101,100,15,117,110,105,65,56,54,69,46,109,101,100,
+46,99,110,116,4,115,116,101,109,11,117,110,105,65,56,54,56,46,105,110,105,
+15,117,110,105,65,56,54,56,46,105,110,105,46,99,110,116,11,117,110,105,65,
+56,54,56,46,109,101,100,15,117,110,105,65,56,54,56,46,109,101,100,46,99,110,
+116,11,117,110,105,65,56,54,56,46,102,105,110,15,117,110,105,65,56,54,56,
+46,109,105,114,46,109,101,100,19,117,110,105,65,56,54,56,46,109,105,114,46,
+109,101,100,46,99,110,116,15,117,110,105,65,56,54,56,46,109,105,114,46,102,
+105,110,11,117,110,105,65,56,55,48,46,105,110,105,11,117,110,105,65,56,55,
+48,46,109,101,100,15,117,110,105,65,56,55,48,46,105,110,105,46,99,110,116,
+15,117,110,105,65,56,55,48,46,109,101,100,46,99,110,116,11,117,110,105,65,
+56,55,48,46,102,105,110,11,117,110,105,65,56,52,69,46,105,110,105,11,117,
+110,105,65,56,52,69,46,109,101,100,15,117,110,105,65,56,52,69,46,105,110,
+105,46,99,110,116,15,117,110,105,65,56,52,69,46,109,101,100,46,99,110,116,
+11,117,110,105,65,56,52,69,46,102,105,110,11,117,110,105,65,56,54,68,46,105,
+110,105,15,117,110,105,65,56,54,68,46,105,110,105,46,99,110,116,11,117,110,
+105,65,56,54,68,46,109,101,100,15,117,110,105,65,56,54,68,46,109,101,100,
+46,99,110,116,15,117,110,105,65,56,54,68,46,115,116,114,46,109,101,100,19,
+117,110,105,65,56,54,68,46,115,116,114,46,109,101,100,46,99,110,116,11,117,
+110,105,65,56,54,68,46,102,105,110,15,117,110,105,65,56,54,68,46,115,116,
+114,46,102,105,110,11,117,110,105,65,56,52,55,46,105,110,105,15,117,110,105,
+65,56,52,55,46,105,110,105,46,99,110,116,11,117,110,105,65,56,52,55,46,109,
+101,100,15,117,110,105,65,56,52,55,46,109,101,100,46,99,110,116,11,117,110,
+105,65,56,52,55,46,102,105,110,11,117,110,105,65,56,53,49,46,105,110,105,
+15,117,110,105,65,56,53,49,46,105,110,105,46,99,110,116,11,117,110,105,65,
+56,53,49,46,109,101,100,15,117,110,105,65,56,53,49,46,109,101,100,46,99,110,
+116,11,117,110,105,65,56,53,49,46,102,105,110,11,117,110,105,65,56,54,55,
+46,109,101,100,15,117,110,105,65,56,54,55,46,109,101,100,46,99,110,116,15,
+117,110,105,65,56,53,69,46,115,116,114,46,109,101,100,19,117,110,105,65,56,
+53,69,46,115,116,114,46,109,101,100,46,99,110,116,15,117,110,105,65,56,53,
+69,46,115,116,114,46,102,105,110,11,117,110,105,65,56,53,54,46,109,105,114,
+15,117,110,105,65,56,53,54,46,109,105,114,46,105,110,105,19,117,110,105,65,
+56,53,54,46,109,105,114,46,109,101,100,46,99,110,116,15,117,110,105,65,56,
+53,54,46,109,105,114,46,109,101,100,11,117,110,105,65,56,53,67,46,109,105,
+114,15,117,110,105,65,56,53,67,46,109,105,114,46,105,110,105,19,117,110,105,
+65,56,53,67,46,109,105,114,46,105,110,105,46,99,110,116,11,117,110,105,65,
+56,53,69,46,109,105,114,15,117,110,105,65,56,53,69,46,109,105,114,46,105,
+110,105,11,117,110,105,65,56,53,70,46,109,105,114,15,117,110,105,65,56,53,
+70,46,109,105,114,46,105,110,105,11,117,110,105,65,56,54,48,46,109,105,114,
+15,117,110,105,65,56,54,48,46,109,105,114,46,105,110,105,11,117,110,105,65,
+56,54,56,46,109,105,114,15,117,110,105,65,56,54,56,46,109,105,114,46,105,
+110,105,15,117,110,105,65,56,54,50,46,105,110,105,46,99,110,116,7,117,110,
+105,51,48,49,52,7,117,110,105,51,48,49,53,14,116,119,111,100,111,116,101,
+110,108,101,97,100,101,114,7,117,110,105,51,48,48,55,7,117,110,105,51,48,
+48,56,7,117,110,105,51,48,48,57,7,117,110,105,51,48,48,65,7,117,110,105,51,
+48,48,66,7,117,110,105,51,48,48,67,7,117,110,105,51,48,48,68,7,117,110,105,
+51,48,48,69,7,117,110,105,51,48,48,70,7,117,110,105,51,48,49,48,7,117,110,
+105,51,48,49,49,7,117,110,105,51,48,49,54,7,117,110,105,51,48,49,55,7,117,
+110,105,51,48,49,56,7,117,110,105,51,48,49,57,7,117,110,105,51,48,49,65,7,
+117,110,105,51,48,49,66,7,117,110,105,50,48,48,66,7,117,110,105,50,48,48,
+69,7,117,110,105,50,48,48,70,7,117,110,105,50,53,67,67,7,117,110,105,49,56,
+48,49,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,34,0,0,0,2,0,3,0,0,0,
+68,0,1,0,69,0,69,0,3,0,70,1,125,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,44,
+0,46,0,2,68,70,76,84,0,14,112,104,97,103,0,24,0,4,0,0,0,0,255,255,0,0,0,4,
+0,0,0,0,255,255,0,0,0,0,0,0,0,1,0,0,0,10,0,64,0,214,0,2,68,70,76,84,0,14,
+112,104,97,103,0,34,0,4,0,0,0,0,255,255,0,5,0,0,0,2,0,6,0,8,0,4,0,4,0,0,0,
+0,255,255,0,5,0,1,0,3,0,7,0,9,0,5,0,10,99,97,108,116,0,62,99,97,108,116,0,
+78,99,99,109,112,0,94,99,99,109,112,0,104,102,105,110,97,0,114,102,105,110,
+97,0,120,105,110,105,116,0,126,105,110,105,116,0,132,109,101,100,105,0,138,
+109,101,100,105,0,144,0,0,0,6,0,6,0,7,0,8,0,9,0,10,0,11,0,0,0,6,0,6,0,7,0,
+8,0,9,0,10,0,11,0,0,0,3,0,0,0,1,0,2,0,0,0,3,0,0,0,1,0,2,0,0,0,1,0,5,0,0,0,
+1,0,5,0,0,0,1,0,3,0,0,0,1,0,3,0,0,0,1,0,4,0,0,0,1,0,4,0,19,0,40,0,48,0,56,
+0,64,0,72,0,80,0,88,0,96,0,106,0,114,0,122,0,130,0,138,0,146,0,154,0,162,
+0,170,0,178,0,186,0,6,0,0,0,1,0,154,0,4,0,0,0,1,0,202,0,4,0,0,0,1,1,44,0,
+1,0,0,0,1,1,154,0,1,0,0,0,1,2,56,0,1,0,0,0,1,2,212,0,6,0,0,0,1,3,112,0,6,
+0,0,0,2,4,166,4,186,0,6,0,0,0,1,4,238,0,6,0,0,0,1,5,22,0,6,0,0,0,1,6,76,0,
+6,0,0,0,1,6,134,0,1,0,0,0,1,6,174,0,1,0,0,0,1,6,212,0,1,0,0,0,1,8,86,0,1,
+0,0,0,1,8,96,0,1,0,0,0,1,8,106,0,1,0,0,0,1,9,238,0,1,0,0,0,1,10,32,0,3,0,
+1,0,18,0,1,0,28,0,0,0,1,0,0,0,12,0,2,0,1,0,54,0,57,0,0,0,2,0,4,0,35,0,35,
+0,0,0,41,0,41,0,1,0,43,0,45,0,2,0,53,0,53,0,5,0,1,0,78,0,6,0,18,0,28,0,38,
+0,48,0,58,0,68,0,1,0,4,1,84,0,2,0,69,0,1,0,4,1,88,0,2,0,69,0,1,0,4,1,91,0,
+2,0,69,0,1,0,4,1,93,0,2,0,69,0,1,0,4,1,95,0,2,0,69,0,1,0,4,1,97,0,2,0,69,
+0,2,0,4,0,35,0,35,0,0,0,41,0,41,0,1,0,43,0,45,0,2,0,53,0,53,0,5,0,1,0,78,
+0,6,0,18,0,28,0,38,0,48,0,58,0,68,0,1,0,4,0,35,0,2,0,69,0,1,0,4,0,41,0,2,
+0,69,0,1,0,4,0,43,0,2,0,69,0,1,0,4,0,44,0,2,0,69,0,1,0,4,0,45,0,2,0,69,0,
+1,0,4,0,53,0,2,0,69,0,2,0,6,1,84,1,84,0,0,1,88,1,88,0,1,1,91,1,91,0,2,1,93,
+1,93,0,3,1,95,1,95,0,4,1,97,1,97,0,5,0,2,0,120,0,57,0,100,0,126,0,215,0,86,
+0,161,0,166,0,146,1,69,0,112,0,151,0,156,0,105,0,171,0,176,1,56,0,73,0,139,
+1,74,0,181,0,225,0,132,0,186,0,191,0,71,0,196,0,220,0,206,0,79,0,96,0,76,
+0,83,0,95,0,89,0,94,0,109,1,1,0,233,0,238,0,201,0,230,1,43,0,244,0,249,1,
+9,1,14,1,61,1,38,1,25,1,51,1,30,1,35,1,85,1,89,1,92,1,94,1,96,1,98,0,2,0,
+7,0,13,0,63,0,0,1,84,1,84,0,51,1,88,1,88,0,52,1,91,1,91,0,53,1,93,1,93,0,
+54,1,95,1,95,0,55,1,97,1,97,0,56,0,2,0,118,0,56,0,101,0,212,0,217,0,144,0,
+163,0,168,0,148,1,71,0,113,0,153,0,158,0,106,0,173,0,178,1,57,0,74,0,140,
+1,76,0,183,0,227,0,134,0,188,0,193,0,72,0,198,0,222,0,208,0,80,0,97,0,78,
+0,84,0,98,0,90,0,92,0,111,1,2,0,235,0,241,0,203,1,79,1,45,0,246,0,251,1,11,
+1,16,1,63,1,40,1,27,1,52,1,32,1,87,1,19,1,22,0,254,1,6,1,48,0,2,0,7,0,13,
+0,62,0,0,1,84,1,84,0,50,1,88,1,88,0,51,1,91,1,91,0,52,1,93,1,93,0,53,1,95,
+1,95,0,54,1,97,1,97,0,55,0,2,0,118,0,56,0,102,0,214,0,219,0,87,0,165,0,170,
+0,150,1,73,0,114,0,155,0,160,0,107,0,175,0,180,1,60,0,115,0,141,1,78,0,185,
+0,229,0,136,0,190,0,195,0,88,0,200,0,224,0,210,0,70,0,103,0,75,0,85,0,99,
+0,91,0,93,0,110,1,4,0,237,0,243,0,205,0,231,1,47,0,248,0,253,1,13,1,18,1,
+67,1,37,1,29,1,55,1,34,1,36,1,21,1,24,1,0,1,8,1,50,0,2,0,7,0,13,0,62,0,0,
+1,84,1,84,0,50,1,88,1,88,0,51,1,91,1,91,0,52,1,93,1,93,0,53,1,95,1,95,0,54,
+1,97,1,97,0,55,0,3,0,0,0,1,0,18,0,1,1,54,0,1,0,0,0,13,0,2,0,48,0,71,0,71,
+0,0,0,73,0,73,0,1,0,76,0,76,0,2,0,79,0,79,0,3,0,83,0,83,0,4,0,86,0,86,0,5,
+0,89,0,89,0,6,0,96,0,96,0,7,0,100,0,100,0,8,0,105,0,105,0,9,0,109,0,109,0,
+10,0,112,0,112,0,11,0,126,0,126,0,12,0,132,0,132,0,13,0,139,0,139,0,14,0,
+146,0,146,0,15,0,151,0,151,0,16,0,156,0,156,0,17,0,161,0,161,0,18,0,166,0,
+166,0,19,0,171,0,171,0,20,0,176,0,176,0,21,0,181,0,181,0,22,0,186,0,186,0,
+23,0,191,0,191,0,24,0,196,0,196,0,25,0,201,0,201,0,26,0,206,0,206,0,27,0,
+215,0,215,0,28,0,220,0,220,0,29,0,225,0,225,0,30,0,230,0,230,0,31,0,233,0,
+233,0,32,0,238,0,238,0,33,0,244,0,244,0,34,0,249,0,249,0,35,1,1,1,1,0,36,
+1,9,1,9,0,37,1,14,1,14,0,38,1,25,1,25,0,39,1,30,1,30,0,40,1,38,1,38,0,41,
+1,43,1,43,0,42,1,51,1,51,0,43,1,56,1,56,0,44,1,61,1,61,0,45,1,69,1,69,0,46,
+1,74,1,74,0,47,0,1,0,2,0,92,0,93,0,3,0,1,0,40,0,1,0,62,0,1,0,70,0,1,0,0,0,
+14,0,3,0,1,0,20,0,1,0,42,0,1,0,56,0,1,0,0,0,14,0,2,0,3,0,92,0,92,0,0,0,94,
+0,95,0,1,1,35,1,35,0,3,0,1,0,2,0,84,1,63,0,1,0,1,0,92,0,1,0,1,0,93,0,3,0,
+1,0,18,0,1,0,40,0,0,0,1,0,0,0,15,0,2,0,3,0,92,0,92,0,0,0,94,0,95,0,1,1,35,
+1,35,0,3,0,1,0,2,0,84,1,63,0,3,0,0,0,1,0,18,0,1,1,54,0,1,0,0,0,16,0,2,0,48,
+0,72,0,72,0,0,0,74,0,74,0,1,0,78,0,78,0,2,0,80,0,80,0,3,0,84,0,84,0,4,0,90,
+0,90,0,5,0,97,0,98,0,6,0,101,0,101,0,8,0,106,0,106,0,9,0,111,0,111,0,10,0,
+113,0,113,0,11,0,134,0,134,0,12,0,140,0,140,0,13,0,144,0,144,0,14,0,148,0,
+148,0,15,0,153,0,153,0,16,0,158,0,158,0,17,0,163,0,163,0,18,0,168,0,168,0,
+19,0,173,0,173,0,20,0,178,0,178,0,21,0,183,0,183,0,22,0,188,0,188,0,23,0,
+193,0,193,0,24,0,198,0,198,0,25,0,203,0,203,0,26,0,208,0,208,0,27,0,212,0,
+212,0,28,0,217,0,217,0,29,0,222,0,222,0,30,0,227,0,227,0,31,0,235,0,235,0,
+32,0,241,0,241,0,33,0,246,0,246,0,34,0,251,0,251,0,35,1,2,1,2,0,36,1,11,1,
+11,0,37,1,16,1,16,0,38,1,27,1,27,0,39,1,32,1,32,0,40,1,40,1,40,0,41,1,45,
+1,45,0,42,1,52,1,52,0,43,1,57,1,57,0,44,1,63,1,63,0,45,1,71,1,71,0,46,1,76,
+1,76,0,47,1,79,1,79,0,48,0,1,0,2,0,92,0,93,0,3,0,0,0,1,0,18,0,1,0,58,0,1,
+0,0,0,17,0,2,0,6,0,254,0,254,0,0,1,6,1,6,0,1,1,19,1,19,0,2,1,22,1,22,0,3,
+1,48,1,48,0,4,1,87,1,87,0,5,0,1,0,2,0,92,0,93,0,3,0,1,0,18,0,1,0,40,0,0,0,
+1,0,0,0,18,0,2,0,3,0,92,0,92,0,0,0,94,0,95,0,1,1,35,1,35,0,3,0,1,0,2,0,85,
+1,67,0,2,0,18,0,6,1,84,1,88,1,91,1,93,1,95,1,97,0,2,0,4,0,35,0,35,0,0,0,41,
+0,41,0,1,0,43,0,45,0,2,0,53,0,53,0,5,0,2,0,102,0,48,0,129,0,137,0,77,0,81,
+0,118,0,127,0,116,0,120,0,104,0,124,1,99,0,122,0,211,0,133,0,142,0,147,0,
+152,0,157,0,162,0,167,0,172,0,177,0,182,0,187,0,192,0,197,0,202,0,207,0,216,
+0,221,0,226,0,232,0,234,0,240,0,245,0,250,1,5,1,10,1,15,1,26,1,31,1,39,1,
+44,1,53,1,58,1,62,1,70,1,75,0,2,0,48,0,71,0,71,0,0,0,73,0,73,0,1,0,76,0,76,
+0,2,0,79,0,79,0,3,0,83,0,83,0,4,0,86,0,86,0,5,0,89,0,89,0,6,0,96,0,96,0,7,
+0,100,0,100,0,8,0,105,0,105,0,9,0,109,0,109,0,10,0,112,0,112,0,11,0,126,0,
+126,0,12,0,132,0,132,0,13,0,139,0,139,0,14,0,146,0,146,0,15,0,151,0,151,0,
+16,0,156,0,156,0,17,0,161,0,161,0,18,0,166,0,166,0,19,0,171,0,171,0,20,0,
+176,0,176,0,21,0,181,0,181,0,22,0,186,0,186,0,23,0,191,0,191,0,24,0,196,0,
+196,0,25,0,201,0,201,0,26,0,206,0,206,0,27,0,215,0,215,0,28,0,220,0,220,0,
+29,0,225,0,225,0,30,0,230,0,230,0,31,0,233,0,233,0,32,0,238,0,238,0,33,0,
+244,0,244,0,34,0,249,0,249,0,35,1,1,1,1,0,36,1,9,1,9,0,37,1,14,1,14,0,38,
+1,25,1,25,0,39,1,30,1,30,0,40,1,38,1,38,0,41,1,43,1,43,0,42,1,51,1,51,0,43,
+1,56,1,56,0,44,1,61,1,61,0,45,1,69,1,69,0,46,1,74,1,74,0,47,0,2,0,10,0,2,
+1,82,1,66,0,1,0,2,0,84,1,63,0,2,0,10,0,2,1,81,1,65,0,1,0,2,0,84,1,63,0,2,
+0,104,0,49,0,130,0,138,0,82,0,128,0,119,0,117,0,121,0,131,0,108,0,125,0,239,
+0,123,0,135,0,143,0,145,0,149,0,154,0,159,0,164,0,169,0,174,0,179,0,184,0,
+189,0,194,0,199,0,204,0,209,0,213,0,218,0,223,0,228,0,236,0,242,0,247,0,252,
+1,3,1,12,1,17,1,28,1,33,1,41,1,46,1,54,1,59,1,64,1,72,1,77,1,80,0,2,0,48,
+0,72,0,72,0,0,0,74,0,74,0,1,0,78,0,78,0,2,0,80,0,80,0,3,0,84,0,84,0,4,0,90,
+0,90,0,5,0,97,0,98,0,6,0,101,0,101,0,8,0,106,0,106,0,9,0,111,0,111,0,10,0,
+113,0,113,0,11,0,134,0,134,0,12,0,140,0,140,0,13,0,144,0,144,0,14,0,148,0,
+148,0,15,0,153,0,153,0,16,0,158,0,158,0,17,0,163,0,163,0,18,0,168,0,168,0,
+19,0,173,0,173,0,20,0,178,0,178,0,21,0,183,0,183,0,22,0,188,0,188,0,23,0,
+193,0,193,0,24,0,198,0,198,0,25,0,203,0,203,0,26,0,208,0,208,0,27,0,212,0,
+212,0,28,0,217,0,217,0,29,0,222,0,222,0,30,0,227,0,227,0,31,0,235,0,235,0,
+32,0,241,0,241,0,33,0,246,0,246,0,34,0,251,0,251,0,35,1,2,1,2,0,36,1,11,1,
+11,0,37,1,16,1,16,0,38,1,27,1,27,0,39,1,32,1,32,0,40,1,40,1,40,0,41,1,45,
+1,45,0,42,1,52,1,52,0,43,1,57,1,57,0,44,1,63,1,63,0,45,1,71,1,71,0,46,1,76,
+1,76,0,47,1,79,1,79,0,48,0,2,0,18,0,6,0,255,1,7,1,20,1,23,1,49,1,86,0,2,0,
+6,0,254,0,254,0,0,1,6,1,6,0,1,1,19,1,19,0,2,1,22,1,22,0,3,1,48,1,48,0,4,1,
+87,1,87,0,5,0,2,0,10,0,2,1,83,1,68,0,1,0,2,0,85,1,67,0,0,};
+#endif
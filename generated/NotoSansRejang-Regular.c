@@ -0,0 +1,285 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansRejang_Regular_ttf_size = 6876;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansRejang_Regular_ttf");
+asm(".type fz_font_NotoSansRejang_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansRejang_Regular_ttf, 6876");
+asm(".balign 64");
+asm("fz_font_NotoSansRejang_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansRejang-Regular.ttf\"");
+#else
+const int fz_font_NotoSansRejang_Regular_ttf_size = 6876;
+const char fz_font_NotoSansRejang_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,218,0,186,0,0,23,72,0,0,0,54,71,
+80,79,83,147,183,168,202,0,0,23,128,0,0,3,60,71,83,85,66,68,116,76,117,0,
+0,26,188,0,0,0,30,79,83,47,50,123,3,106,84,0,0,1,104,0,0,0,96,99,109,97,112,
+170,48,169,16,0,0,2,108,0,0,0,92,103,97,115,112,0,7,0,7,0,0,23,60,0,0,0,12,
+103,108,121,102,228,193,237,237,0,0,3,28,0,0,12,122,104,101,97,100,5,52,43,
+79,0,0,0,236,0,0,0,54,104,104,101,97,15,117,0,208,0,0,1,36,0,0,0,36,104,109,
+116,120,131,6,8,41,0,0,1,200,0,0,0,164,108,111,99,97,60,142,63,249,0,0,2,
+200,0,0,0,84,109,97,120,112,0,44,0,93,0,0,1,72,0,0,0,32,110,97,109,101,140,
+81,184,114,0,0,15,152,0,0,6,0,112,111,115,116,11,255,199,194,0,0,21,152,0,
+0,1,161,0,1,0,0,0,1,12,205,200,206,200,173,95,15,60,245,0,11,8,0,0,0,0,0,
+204,193,225,131,0,0,0,0,210,109,241,210,255,100,254,96,7,129,7,207,0,0,0,
+9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,7,66,255,100,251,188,7,129,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,1,0,0,0,41,0,92,0,2,0,0,0,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,131,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,
+154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,0,
+0,0,0,32,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,0,
+0,0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,1,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,
+0,3,209,255,215,3,170,255,213,6,164,255,213,3,209,255,213,3,209,255,215,7,
+2,255,215,3,170,0,49,2,172,255,215,4,111,0,49,3,209,255,213,5,55,255,215,
+5,248,255,211,5,53,255,209,5,53,255,215,5,172,255,211,5,100,0,231,4,109,255,
+209,4,156,0,49,4,160,255,215,4,221,255,211,7,66,255,215,6,6,255,211,4,80,
+255,211,1,76,0,47,0,0,255,182,0,0,0,68,0,0,1,96,0,0,0,47,0,0,255,174,0,0,
+255,100,0,0,0,162,0,0,2,66,0,0,1,152,0,0,1,117,1,55,0,43,0,0,2,4,5,88,0,55,
+0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,80,0,0,0,16,0,16,0,3,0,0,0,0,0,13,0,32,0,160,
+169,83,169,95,254,255,255,255,0,0,0,0,0,13,0,32,0,160,169,48,169,95,254,255,
+255,255,0,1,255,245,255,227,255,99,86,212,86,201,1,2,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,59,0,87,0,142,0,186,0,232,1,28,
+1,55,1,69,1,136,1,185,1,244,2,52,2,106,2,181,2,220,3,19,3,59,3,96,3,130,3,
+183,3,249,4,83,4,136,4,158,4,180,4,193,4,218,4,247,5,8,5,27,5,46,5,61,5,84,
+5,109,5,146,5,184,6,61,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,
+33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,
+255,215,0,0,3,127,5,223,0,20,0,0,51,35,1,51,1,35,39,38,39,35,6,6,7,19,35,
+39,38,39,35,6,7,131,172,2,119,20,1,29,166,59,54,12,8,10,26,64,217,160,74,
+29,26,8,37,27,5,223,253,99,159,135,54,38,81,162,253,252,176,77,95,123,69,
+0,0,1,255,213,0,0,3,127,5,223,0,11,0,0,1,39,38,39,35,6,7,1,35,1,51,1,2,217,
+59,48,18,8,26,38,254,109,172,2,121,20,1,29,3,66,159,121,68,100,89,252,31,
+5,223,253,99,0,0,1,255,213,255,215,6,215,5,223,0,27,0,0,37,1,3,38,39,35,6,
+7,1,35,1,51,19,19,51,1,19,22,23,51,54,55,1,51,1,35,3,3,1,211,1,49,102,48,
+18,8,26,38,254,109,172,2,121,20,244,225,162,254,209,104,41,25,8,17,45,1,145,
+172,253,137,20,246,225,2,2,215,1,8,121,68,100,89,252,33,5,221,253,191,2,26,
+253,37,254,246,102,82,75,109,3,229,250,31,2,61,253,238,0,2,255,213,0,0,3,
+129,5,223,0,12,0,21,0,0,1,39,38,39,35,6,7,3,35,1,51,22,19,1,35,6,6,7,19,55,
+39,38,2,106,126,35,33,8,37,27,223,172,2,121,20,32,255,254,219,8,10,26,64,
+122,113,61,54,1,61,236,61,119,123,69,253,227,5,223,78,253,172,1,97,38,81,
+162,254,219,221,164,135,0,0,1,255,215,0,0,3,127,5,223,0,24,0,0,1,38,38,39,
+35,6,7,3,35,1,51,1,35,39,38,39,35,6,6,7,23,55,19,35,39,2,68,110,45,13,9,26,
+37,209,172,2,119,20,1,29,166,59,48,18,8,11,31,71,97,65,250,164,82,1,82,219,
+100,48,101,92,254,0,5,223,253,99,159,121,68,43,92,175,229,135,254,60,159,
+0,0,1,255,215,255,215,6,29,5,223,0,28,0,0,33,3,39,39,35,6,7,1,35,3,38,53,
+35,6,7,1,35,1,51,19,22,21,51,54,54,55,1,51,19,5,121,86,5,3,9,19,44,253,227,
+20,109,10,8,16,27,254,139,172,2,135,21,131,12,8,14,41,19,2,6,29,166,3,139,
+85,106,66,82,252,33,3,129,75,116,85,65,252,127,5,223,252,49,86,104,45,90,
+45,3,217,250,33,0,1,0,49,255,215,3,221,5,184,0,11,0,0,19,23,22,23,51,54,55,
+1,51,1,35,1,213,61,33,33,8,25,39,1,149,172,253,133,20,254,227,2,119,158,82,
+108,92,98,3,223,250,31,2,160,0,1,255,215,0,0,2,219,5,184,0,3,0,0,1,51,1,35,
+2,59,160,253,156,160,5,184,250,72,0,1,0,49,255,215,4,86,5,184,0,37,0,0,1,
+1,35,3,38,39,35,6,7,3,35,1,51,22,22,23,51,54,54,19,1,51,19,22,23,51,54,55,
+19,51,1,22,22,23,51,54,54,55,4,86,254,229,20,133,18,33,9,26,27,209,20,254,
+229,164,77,36,14,8,6,38,143,254,229,170,149,12,29,9,21,26,147,172,254,223,
+51,47,15,8,8,27,92,3,47,253,98,1,58,40,124,109,63,254,20,2,160,199,105,44,
+26,113,1,106,2,168,254,135,24,123,96,64,1,108,253,86,128,130,57,31,81,236,
+0,2,255,213,255,229,3,129,5,223,0,18,0,25,0,0,5,39,38,39,35,6,6,7,35,1,51,
+1,35,39,38,39,35,7,19,1,35,3,23,55,39,38,1,182,106,45,23,8,10,25,92,172,2,
+123,20,1,29,156,69,35,27,8,88,197,254,243,8,98,108,105,60,25,27,185,79,99,
+35,77,224,5,223,253,99,159,77,106,236,254,45,1,35,254,252,252,221,143,66,
+0,0,2,255,215,0,0,5,14,5,223,0,21,0,30,0,0,1,19,19,51,1,35,38,38,39,35,6,
+7,1,39,38,39,35,6,7,3,35,1,19,35,6,6,7,19,19,39,38,2,98,193,186,21,1,28,164,
+48,53,25,9,28,35,254,182,137,38,30,8,41,22,195,172,2,119,14,8,12,33,82,121,
+131,51,48,5,223,254,60,1,196,253,99,120,133,95,106,83,253,25,242,65,115,137,
+56,254,33,5,223,254,191,45,97,200,254,221,1,59,129,121,0,0,1,255,211,0,0,
+6,41,5,223,0,35,0,0,1,51,54,55,19,51,1,35,3,38,39,35,6,7,3,35,3,38,39,35,
+6,7,1,35,1,51,19,22,23,51,54,55,19,51,19,22,4,209,8,35,31,106,164,254,182,
+20,131,39,27,8,22,39,138,20,133,48,18,8,26,38,254,107,172,2,123,20,152,33,
+14,8,12,35,154,20,129,31,3,231,113,78,1,18,252,236,1,61,96,93,97,92,254,195,
+1,61,121,68,100,89,252,31,5,223,254,148,92,48,51,89,1,108,254,199,78,0,0,
+1,255,209,0,0,5,55,5,223,0,28,0,0,1,39,38,39,35,6,7,1,35,1,39,38,39,35,6,
+7,1,35,1,51,19,22,23,51,54,55,19,51,1,4,145,63,37,25,8,28,35,254,104,172,
+1,94,73,38,28,8,26,38,254,105,172,2,125,20,158,33,14,8,24,23,162,19,1,28,
+3,66,159,92,97,106,83,252,31,3,55,170,82,107,100,89,252,31,5,223,254,137,
+79,68,92,55,1,119,253,99,0,2,255,215,255,215,5,55,5,223,0,28,0,42,0,0,5,3,
+38,39,35,7,7,3,35,1,51,19,22,23,51,54,55,19,51,1,35,38,38,39,35,6,6,7,1,3,
+22,22,23,51,54,55,19,39,38,39,35,6,7,2,10,160,24,23,8,23,24,129,172,2,119,
+20,158,33,14,8,24,23,162,21,1,26,166,87,34,4,8,6,14,43,254,82,156,91,31,13,
+10,13,43,155,73,46,20,8,26,38,41,1,107,51,88,73,71,254,195,5,223,254,137,
+79,68,92,55,1,119,253,99,233,93,22,23,47,119,251,246,2,164,207,89,56,58,96,
+1,130,170,98,91,100,89,0,0,1,255,211,255,215,5,223,5,223,0,19,0,0,5,35,3,
+38,39,35,6,7,1,35,1,51,19,22,23,51,54,55,1,51,3,98,20,232,11,17,8,20,30,254,
+111,172,2,133,21,241,19,12,8,21,39,1,116,170,41,3,191,39,151,85,65,252,66,
+5,223,252,66,74,117,85,93,3,164,0,0,1,0,231,255,215,5,147,5,182,0,31,0,0,
+1,51,19,22,23,51,54,54,55,1,51,1,35,3,38,39,35,6,7,3,35,3,51,19,30,3,21,51,
+54,54,2,195,20,82,6,12,9,9,31,11,1,112,172,253,136,21,84,18,6,9,25,34,172,
+29,166,164,80,1,4,3,2,9,9,38,3,182,254,115,30,132,44,79,29,3,151,250,33,1,
+133,94,97,101,80,254,113,5,223,252,170,15,43,50,55,27,30,100,0,1,255,209,
+0,0,4,156,5,223,0,20,0,0,33,35,1,39,38,39,35,6,7,1,35,1,51,19,22,23,51,54,
+55,19,51,2,53,172,1,94,73,38,28,8,26,38,254,105,172,2,125,26,152,33,14,8,
+24,23,142,168,3,55,170,82,107,100,89,252,31,5,223,254,137,79,68,92,55,1,78,
+0,0,1,0,49,255,215,4,113,5,223,0,18,0,0,5,35,1,51,23,22,23,51,54,55,1,51,
+1,35,2,39,35,6,7,1,98,20,254,227,164,61,33,33,8,25,39,1,166,20,1,27,164,110,
+17,8,26,38,41,2,160,158,82,108,92,98,4,6,253,99,1,25,67,100,89,0,0,1,255,
+215,255,215,4,209,5,184,0,15,0,0,1,51,1,22,22,23,51,54,55,1,51,1,35,3,3,35,
+2,59,160,254,203,73,79,14,8,27,36,1,148,170,253,135,20,242,219,160,5,184,
+253,33,191,205,50,99,91,3,223,250,31,2,57,253,240,0,0,2,255,211,0,0,5,18,
+5,223,0,14,0,26,0,0,1,35,6,7,1,35,1,51,1,35,1,46,3,19,3,38,39,35,6,7,3,35,
+1,51,1,2,111,9,15,37,254,77,172,2,143,21,2,155,176,254,84,6,18,20,20,163,
+111,27,32,9,22,25,123,159,1,69,21,1,69,4,158,68,86,251,252,5,223,250,33,3,
+225,15,42,50,55,251,125,1,31,71,111,92,66,254,201,2,254,253,2,0,0,1,255,215,
+255,215,7,129,5,223,0,35,0,0,1,19,19,51,1,23,22,21,51,54,55,1,51,1,35,3,1,
+35,3,38,53,35,6,7,1,35,1,51,19,22,21,51,54,55,19,3,4,23,57,246,149,254,143,
+31,13,8,32,41,1,248,162,252,207,21,71,254,194,20,109,10,8,16,27,254,139,172,
+2,135,21,125,12,8,28,46,141,82,5,182,254,47,1,209,253,82,248,93,97,104,76,
+3,176,250,33,2,84,253,172,3,129,75,116,85,65,252,127,5,223,252,39,86,104,
+90,90,1,12,2,174,0,0,2,255,211,255,215,6,57,5,223,0,38,0,52,0,0,1,51,54,55,
+19,51,6,3,7,35,38,38,39,35,6,6,7,1,35,3,38,39,35,7,7,3,35,1,51,19,22,23,51,
+54,55,19,51,19,22,1,23,22,23,51,54,55,19,39,38,39,35,6,7,4,223,8,19,37,121,
+161,79,124,61,160,87,34,4,8,6,14,43,254,88,21,166,24,23,8,23,24,133,172,2,
+123,20,158,33,14,8,24,23,162,19,131,42,252,187,82,31,22,10,13,43,155,73,46,
+20,8,26,38,3,231,76,92,1,41,195,254,222,145,233,93,22,23,47,119,251,246,1,
+107,51,88,73,71,254,195,5,223,254,137,79,68,92,55,1,119,254,199,104,254,61,
+193,71,88,58,96,1,130,170,98,91,100,89,0,0,1,255,211,0,0,4,131,5,223,0,28,
+0,0,1,6,6,7,19,35,38,38,39,35,6,7,3,35,1,51,19,22,23,51,54,55,19,51,1,35,
+3,38,39,2,84,7,27,66,217,160,48,57,24,8,37,27,225,172,2,123,20,131,38,26,
+8,29,26,125,162,254,178,24,127,52,14,4,158,31,83,167,253,252,115,134,99,123,
+69,253,227,5,223,254,199,96,95,108,60,1,39,252,238,1,61,129,60,0,0,1,0,47,
+1,12,1,29,1,238,0,11,0,0,19,52,54,51,50,22,21,20,6,35,34,38,47,68,51,49,70,
+70,49,51,68,1,125,59,54,55,58,57,56,56,0,1,255,182,254,143,0,164,255,113,
+0,11,0,0,3,52,54,51,50,22,21,20,6,35,34,38,74,68,51,57,62,69,50,51,68,255,
+0,59,54,61,52,57,56,56,0,1,0,68,2,150,0,227,4,61,0,3,0,0,19,51,17,35,68,159,
+159,4,61,254,89,0,0,1,1,96,6,57,3,135,7,158,0,10,0,0,1,39,38,39,6,6,7,35,
+19,51,19,2,248,43,40,26,11,24,120,144,219,170,162,6,57,95,92,90,23,45,209,
+1,101,254,155,0,0,2,0,47,254,143,1,90,4,61,0,11,0,15,0,0,19,52,54,51,50,22,
+21,20,6,35,34,38,3,51,17,35,108,68,51,57,62,69,50,51,68,61,160,160,254,254,
+62,53,61,54,57,54,54,5,120,254,89,0,0,1,255,174,254,96,1,2,255,164,0,7,0,
+0,23,20,22,51,21,34,38,53,76,83,99,169,171,92,105,90,129,158,166,0,0,2,255,
+100,254,96,1,45,255,166,0,3,0,7,0,0,7,51,17,35,1,51,17,35,156,152,152,1,50,
+151,151,90,254,186,1,70,254,186,0,2,0,162,254,96,2,106,255,166,0,3,0,7,0,
+0,23,51,17,35,1,51,17,35,162,151,151,1,49,151,151,90,254,186,1,70,254,186,
+0,1,2,66,6,16,3,160,7,195,0,3,0,0,1,23,3,39,3,20,140,211,139,7,195,60,254,
+137,60,0,0,2,1,152,6,16,4,68,7,195,0,3,0,7,0,0,1,23,3,39,1,23,3,39,2,106,
+140,211,139,2,32,140,211,140,7,195,60,254,137,60,1,119,60,254,137,60,0,1,
+1,117,6,57,3,156,7,158,0,10,0,0,1,23,22,23,54,54,55,51,3,35,3,2,4,43,40,26,
+11,24,120,144,219,170,162,7,158,95,92,90,23,45,209,254,155,1,101,0,0,2,0,
+43,0,20,1,12,3,113,0,11,0,23,0,0,55,52,54,51,50,22,21,20,6,35,34,38,17,52,
+54,51,50,22,21,20,6,35,34,38,43,65,48,46,66,66,46,48,65,65,48,46,66,66,46,
+48,65,125,56,50,51,55,54,51,51,2,193,56,49,50,55,53,53,52,0,2,2,4,6,43,3,
+199,7,207,0,11,0,23,0,0,1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,
+21,20,22,51,50,54,3,199,126,100,100,125,123,102,98,128,99,67,60,58,69,65,
+62,59,68,6,252,95,114,113,96,96,115,116,95,57,64,64,57,53,66,66,0,2,0,55,
+0,84,5,76,5,102,0,79,0,91,0,0,1,34,7,22,23,22,22,23,35,52,38,39,6,7,22,21,
+20,7,39,54,53,52,39,6,7,6,6,7,53,50,54,55,38,39,6,35,34,39,55,22,51,50,55,
+38,39,38,38,39,51,20,22,23,54,55,38,53,52,55,23,6,21,20,23,54,55,54,54,55,
+21,34,6,7,22,23,54,51,50,23,7,38,5,20,22,51,50,54,53,52,38,35,34,6,4,96,59,
+45,38,17,120,139,5,112,85,69,17,51,52,105,82,70,25,77,78,24,176,136,80,112,
+21,93,57,79,97,132,120,82,73,85,45,55,41,10,123,137,6,112,87,71,11,53,56,
+107,82,70,29,64,87,30,179,129,83,108,26,83,71,88,90,128,120,80,76,253,43,
+132,100,98,133,132,101,98,132,3,195,27,60,96,25,178,131,84,108,21,80,75,92,
+78,131,119,82,76,77,52,49,42,5,116,145,8,113,84,72,21,46,53,102,82,67,22,
+72,84,30,175,133,85,108,22,77,72,90,86,131,121,82,77,78,60,47,42,14,124,136,
+6,111,90,69,13,53,55,102,84,70,230,113,141,141,113,113,139,143,0,0,0,0,0,
+0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,1,4,9,
+0,2,0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,0,4,0,32,0,94,0,3,0,
+1,4,9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,1,4,9,0,7,0,68,1,12,
+0,3,0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,0,3,0,1,4,9,0,10,0,96,
+1,162,0,3,0,1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,60,2,64,0,3,0,1,4,9,0,
+13,2,150,2,124,0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,0,112,0,121,0,114,0,
+105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,82,0,101,0,
+106,0,97,0,110,0,103,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,
+32,0,82,0,101,0,106,0,97,0,110,0,103,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,
+0,97,0,110,0,115,0,82,0,101,0,106,0,97,0,110,0,103,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,1,2,0,2,0,3,1,3,1,
+4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,
+20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,4,110,117,108,108,7,117,110,105,65,57,51,48,7,117,
+110,105,65,57,51,49,7,117,110,105,65,57,51,50,7,117,110,105,65,57,51,51,7,
+117,110,105,65,57,51,52,7,117,110,105,65,57,51,53,7,117,110,105,65,57,51,
+54,7,117,110,105,65,57,51,55,7,117,110,105,65,57,51,56,7,117,110,105,65,57,
+51,57,7,117,110,105,65,57,51,65,7,117,110,105,65,57,51,66,7,117,110,105,65,
+57,51,67,7,117,110,105,65,57,51,68,7,117,110,105,65,57,51,69,7,117,110,105,
+65,57,51,70,7,117,110,105,65,57,52,48,7,117,110,105,65,57,52,49,7,117,110,
+105,65,57,52,50,7,117,110,105,65,57,52,51,7,117,110,105,65,57,52,52,7,117,
+110,105,65,57,52,53,7,117,110,105,65,57,52,54,7,117,110,105,65,57,52,55,7,
+117,110,105,65,57,52,56,7,117,110,105,65,57,52,57,7,117,110,105,65,57,52,
+65,7,117,110,105,65,57,52,66,7,117,110,105,65,57,52,67,7,117,110,105,65,57,
+52,68,7,117,110,105,65,57,52,69,7,117,110,105,65,57,52,70,7,117,110,105,65,
+57,53,48,7,117,110,105,65,57,53,49,7,117,110,105,65,57,53,50,7,117,110,105,
+65,57,53,51,7,117,110,105,65,57,53,70,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,
+1,0,0,0,12,0,0,0,46,0,0,0,2,0,5,0,0,0,26,0,1,0,27,0,37,0,3,0,38,0,38,0,1,
+0,39,0,39,0,3,0,40,0,40,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,30,0,48,0,
+1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,109,97,114,107,0,8,0,0,
+0,3,0,0,0,1,0,2,0,3,0,8,1,86,2,94,0,4,0,0,0,1,0,8,0,1,0,12,2,104,0,3,0,30,
+0,96,0,1,0,7,0,27,0,29,0,30,0,31,0,35,0,36,0,37,0,7,0,2,0,30,0,2,0,36,0,0,
+0,60,0,2,0,42,0,1,0,48,0,1,0,54,0,0,0,60,0,1,0,200,1,4,0,1,0,240,2,128,0,
+1,0,210,2,128,0,1,3,132,7,8,0,1,4,36,7,8,0,1,2,128,6,24,0,23,0,206,0,218,
+0,224,0,206,0,218,0,224,0,140,0,218,0,224,0,206,0,218,0,224,0,206,0,218,0,
+224,0,170,0,218,0,224,0,182,0,188,0,146,0,206,0,218,0,224,2,102,0,152,0,158,
+0,206,0,218,0,224,2,150,0,218,0,224,0,164,0,218,0,224,2,150,0,218,0,224,2,
+150,0,218,0,224,0,170,0,218,0,224,2,138,0,176,0,224,2,144,0,218,0,224,0,182,
+0,188,0,194,0,200,0,218,0,224,0,206,0,218,0,224,2,78,0,218,0,224,0,212,0,
+218,0,224,2,144,0,218,0,224,0,1,6,24,6,24,0,1,0,220,2,188,0,1,1,44,6,24,0,
+1,0,140,2,188,0,1,5,100,6,24,0,1,5,20,6,24,0,1,4,176,6,24,0,1,3,32,6,24,0,
+1,2,248,6,24,0,1,0,160,2,188,0,1,4,16,6,24,0,1,2,88,6,24,0,1,5,80,6,24,0,
+1,2,8,6,24,0,1,0,120,2,188,0,4,0,0,0,1,0,8,0,1,0,12,1,26,0,2,0,24,0,60,0,
+1,0,4,0,28,0,32,0,33,0,34,0,4,0,0,0,18,0,0,0,24,0,0,0,30,0,1,0,30,0,1,255,
+156,0,50,0,1,255,176,0,50,0,1,0,0,0,50,0,23,0,184,0,118,0,184,0,118,0,184,
+0,94,0,184,0,106,0,184,0,106,0,184,0,100,0,154,0,118,0,184,0,106,0,112,0,
+118,0,184,0,118,0,184,0,124,0,184,0,130,0,184,0,136,0,184,0,136,0,184,0,136,
+0,142,0,148,0,184,0,160,0,154,0,160,0,184,0,160,0,184,0,166,0,184,0,172,0,
+184,0,178,0,184,0,190,0,1,4,76,0,0,0,1,3,232,0,0,0,1,1,44,0,0,0,1,0,140,0,
+0,0,1,1,144,0,0,0,1,2,228,0,0,0,1,3,192,0,0,0,1,3,32,0,0,0,1,1,84,0,0,0,1,
+2,208,0,0,0,1,0,240,0,0,0,1,2,48,0,0,0,1,2,168,0,0,0,1,4,36,0,0,0,1,3,172,
+0,0,0,1,0,0,0,0,0,1,1,184,0,0,0,4,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,28,0,40,
+0,1,0,1,0,39,0,2,0,1,0,4,0,26,0,0,0,1,0,0,0,6,0,1,2,223,6,24,0,23,0,102,0,
+102,0,48,0,102,0,102,0,114,0,54,0,60,0,66,0,72,0,102,0,78,0,90,0,90,0,84,
+0,90,0,96,0,114,0,120,0,102,0,108,0,114,0,120,0,1,6,144,6,24,0,1,3,112,6,
+24,0,1,2,108,6,24,0,1,3,132,6,24,0,1,2,188,6,24,0,1,4,136,6,24,0,1,5,120,
+6,24,0,1,3,72,6,24,0,1,3,92,6,24,0,1,3,12,6,24,0,1,4,236,6,24,0,1,3,212,6,
+24,0,1,3,122,6,24,0,1,0,0,0,10,0,28,0,28,0,1,68,70,76,84,0,8,0,4,0,0,0,0,
+255,255,0,0,0,0,0,0,};
+#endif
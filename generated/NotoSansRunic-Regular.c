@@ -0,0 +1,357 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansRunic_Regular_ttf_size = 8528;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansRunic_Regular_ttf");
+asm(".type fz_font_NotoSansRunic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansRunic_Regular_ttf, 8528");
+asm(".balign 64");
+asm("fz_font_NotoSansRunic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansRunic-Regular.ttf\"");
+#else
+const int fz_font_NotoSansRunic_Regular_ttf_size = 8528;
+const char fz_font_NotoSansRunic_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,251,3,105,225,0,0,1,56,0,0,0,96,99,
+109,97,112,232,186,46,142,0,0,2,236,0,0,0,84,103,97,115,112,0,7,0,7,0,0,33,
+68,0,0,0,12,103,108,121,102,25,24,227,237,0,0,3,236,0,0,23,60,104,101,97,
+100,2,85,65,16,0,0,0,188,0,0,0,54,104,104,101,97,14,151,4,29,0,0,0,244,0,
+0,0,36,104,109,116,120,96,46,44,62,0,0,1,152,0,0,1,84,108,111,99,97,232,40,
+238,82,0,0,3,64,0,0,0,172,109,97,120,112,0,92,0,75,0,0,1,24,0,0,0,32,110,
+97,109,101,139,108,184,13,0,0,27,40,0,0,5,250,112,111,115,116,255,105,0,102,
+0,0,33,36,0,0,0,32,0,1,0,0,0,1,5,31,123,144,130,31,95,15,60,245,0,11,8,0,
+0,0,0,0,203,6,37,40,0,0,0,0,210,40,203,254,0,0,0,0,6,8,5,205,0,0,0,9,0,2,
+0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,6,31,0,0,0,0,6,8,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,85,0,1,0,0,0,85,0,74,0,6,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,4,4,49,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,5,51,0,0,3,209,
+0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,71,79,
+79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,0,0,0,1,0,0,0,0,4,74,
+5,182,0,0,0,32,0,0,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,0,5,115,0,199,5,166,
+0,199,5,121,0,199,4,203,0,199,5,121,0,199,5,121,0,199,4,51,0,199,4,51,0,199,
+3,43,0,199,4,182,0,199,4,182,0,199,4,115,0,199,4,10,0,82,3,43,0,199,3,55,
+0,82,4,35,0,82,4,39,0,82,4,2,0,199,2,172,0,199,3,143,0,199,4,141,0,199,4,
+141,0,199,4,182,0,137,4,176,0,8,5,39,0,82,3,131,0,199,5,217,0,199,5,217,0,
+199,4,27,0,82,2,158,0,137,4,16,0,82,3,43,0,199,4,16,0,82,2,72,0,197,2,158,
+0,137,4,25,0,199,3,229,0,102,4,39,0,82,3,55,0,82,4,16,0,82,3,172,0,199,4,
+219,0,0,3,12,0,78,5,57,0,199,2,72,0,199,2,158,0,137,4,39,0,92,4,27,0,82,3,
+57,0,82,3,100,0,82,4,18,0,199,3,55,0,199,4,102,0,199,4,35,0,199,5,227,0,199,
+6,8,0,199,5,76,0,31,2,209,0,162,3,45,0,199,3,111,0,164,4,63,0,199,4,180,0,
+72,5,217,0,199,4,168,0,78,5,16,0,20,4,27,0,82,5,16,0,20,4,219,0,0,5,125,0,
+82,5,217,0,199,5,76,0,31,2,72,0,199,4,39,0,82,3,131,0,72,6,31,0,20,2,238,
+0,193,2,55,0,154,3,180,0,119,4,27,0,82,5,76,0,31,4,209,0,102,0,0,0,1,0,3,
+0,1,0,0,0,12,0,4,0,72,0,0,0,14,0,8,0,2,0,6,0,0,0,13,0,32,0,160,22,240,254,
+255,255,255,0,0,0,0,0,13,0,32,0,160,22,160,254,255,255,255,0,1,255,245,255,
+227,255,99,233,100,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,
+0,21,0,71,0,142,0,173,0,205,0,255,1,48,1,92,1,155,1,180,1,213,1,242,2,13,
+2,53,2,79,2,105,2,145,2,179,2,207,2,227,2,247,3,24,3,79,3,129,3,159,3,219,
+3,246,4,15,4,48,4,100,4,132,4,159,4,179,4,224,4,237,5,13,5,45,5,82,5,109,
+5,128,5,152,5,182,5,209,5,244,6,10,6,23,6,55,6,79,6,103,6,121,6,158,6,194,
+6,221,7,68,7,95,7,122,7,163,7,207,7,239,8,1,8,39,8,71,8,119,8,162,8,201,8,
+232,9,28,9,59,9,87,9,155,9,218,10,6,10,19,10,54,10,81,10,124,10,156,10,214,
+10,244,11,14,11,89,11,158,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,
+55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,
+1,0,199,0,0,5,84,5,182,0,35,0,0,1,21,50,62,4,53,53,51,21,20,14,4,35,17,35,
+17,51,17,50,62,2,53,53,51,21,20,14,2,1,127,108,201,175,143,103,56,195,68,
+125,176,218,254,140,184,184,76,124,87,47,194,85,145,192,3,133,227,48,92,133,
+171,206,118,20,22,145,251,206,161,110,57,254,2,5,182,254,115,62,105,136,74,
+20,22,112,197,146,84,0,2,0,199,0,0,5,135,5,205,0,31,0,47,0,0,1,21,50,36,54,
+18,53,53,51,21,20,2,4,4,35,17,35,17,51,17,50,62,2,53,53,51,21,20,14,2,3,52,
+54,51,50,30,2,21,20,14,2,35,34,38,1,127,180,1,51,224,127,194,151,254,239,
+254,133,229,184,184,95,144,97,49,195,87,155,213,59,61,45,21,37,29,17,17,29,
+37,21,45,61,3,133,227,107,199,1,29,177,20,22,218,254,167,240,127,254,2,5,
+182,254,115,62,105,136,74,20,22,112,197,146,84,1,213,60,55,13,29,43,30,29,
+44,28,14,56,0,0,1,0,199,0,0,4,199,5,182,0,18,0,0,1,52,46,2,35,17,35,17,51,
+50,30,4,21,17,35,4,8,103,177,236,133,184,194,101,202,184,159,117,67,191,2,
+211,144,207,132,62,251,12,5,182,36,75,116,162,210,130,253,35,0,2,0,199,0,
+0,4,203,5,182,0,11,0,15,0,0,1,22,23,22,22,21,17,35,17,51,1,35,1,51,17,35,
+1,115,3,3,2,4,184,227,3,33,215,254,47,162,162,4,193,45,43,37,79,28,252,39,
+5,182,250,74,1,121,254,135,0,2,0,199,0,0,4,199,5,182,0,13,0,32,0,0,1,52,54,
+51,50,22,21,20,14,2,35,34,38,37,52,46,2,35,17,35,17,51,50,30,4,21,17,35,2,
+78,61,45,42,63,17,29,38,21,45,61,1,186,103,177,236,133,184,194,101,202,184,
+159,117,67,191,2,180,60,55,55,60,29,43,28,14,55,90,144,207,132,62,251,12,
+5,182,36,75,116,162,210,130,253,35,0,0,1,0,199,0,0,4,199,5,182,0,32,0,0,1,
+52,46,2,35,17,50,30,2,21,17,35,17,52,46,2,35,17,35,17,51,50,30,4,21,17,35,
+4,18,106,181,239,133,85,153,115,67,180,37,65,87,51,184,194,101,202,184,159,
+117,67,181,2,211,144,207,132,62,254,98,47,107,171,123,254,106,1,117,94,128,
+78,34,253,61,5,182,36,75,116,162,210,130,253,35,0,0,2,0,199,0,0,3,205,5,182,
+0,16,0,27,0,0,19,51,21,30,3,21,20,14,4,7,21,35,1,52,46,2,39,17,62,3,199,174,
+146,224,152,78,47,83,113,133,148,76,174,2,67,50,100,152,103,99,151,103,52,
+5,182,180,18,78,128,183,123,107,163,122,84,56,32,8,180,2,233,91,131,88,51,
+12,252,242,16,48,89,144,0,3,0,199,0,0,3,205,5,182,0,16,0,27,0,41,0,0,19,51,
+21,30,3,21,20,14,4,7,21,35,1,52,46,2,39,17,62,3,37,52,54,51,50,22,21,20,14,
+2,35,34,38,199,174,146,224,152,78,47,83,113,133,148,76,174,2,67,50,100,152,
+103,99,151,103,52,254,193,61,45,42,63,17,29,38,21,45,61,5,182,180,18,78,128,
+183,123,107,163,122,84,56,32,8,180,2,233,91,131,88,51,12,252,242,16,48,89,
+144,102,60,55,55,60,29,43,28,14,55,0,0,1,0,199,0,0,2,215,5,182,0,10,0,0,19,
+51,5,7,37,21,5,7,37,17,35,199,184,1,88,72,254,240,1,88,72,254,240,184,5,182,
+202,123,157,161,203,123,158,252,59,0,0,1,0,199,0,0,4,98,5,182,0,14,0,0,1,
+5,37,21,5,37,21,5,37,17,35,17,51,5,37,4,98,254,174,254,111,1,143,1,84,254,
+174,254,111,184,184,1,143,1,84,5,14,237,237,161,238,238,168,236,234,252,61,
+5,182,237,237,0,0,1,0,199,0,0,4,98,5,182,0,12,0,0,1,5,37,21,5,21,37,17,35,
+17,51,5,37,4,98,254,174,254,111,1,143,254,113,184,184,1,143,1,84,5,14,237,
+237,161,238,170,238,252,61,5,182,237,237,0,0,1,0,199,0,0,4,31,5,182,0,10,
+0,0,19,51,1,7,1,21,1,7,1,17,35,199,184,2,160,72,253,168,2,160,72,253,168,
+184,5,182,254,117,123,1,94,161,254,116,123,1,95,252,59,0,0,1,0,82,0,0,3,182,
+5,182,0,19,0,0,19,5,17,51,17,5,7,37,21,5,7,37,17,35,17,37,55,5,53,37,156,
+1,16,180,1,86,71,254,241,1,86,71,254,241,180,254,166,74,1,16,254,166,4,205,
+162,1,139,254,11,203,123,158,162,203,123,158,254,49,2,55,203,129,162,160,
+203,0,0,1,0,199,0,0,2,215,5,182,0,11,0,0,19,51,17,5,7,37,21,5,7,37,17,35,
+199,184,1,88,72,254,240,1,88,72,254,240,184,5,182,254,8,202,123,158,162,203,
+123,158,254,51,0,1,0,82,0,0,2,111,5,182,0,11,0,0,33,35,17,5,39,37,53,5,39,
+37,17,51,2,111,185,254,230,74,1,100,254,230,74,1,100,185,1,225,151,123,190,
+168,152,123,191,1,233,0,0,1,0,82,0,0,3,207,5,182,0,19,0,0,1,37,23,5,21,37,
+23,5,17,35,17,5,39,37,53,5,39,37,17,51,2,106,1,39,62,254,155,1,39,62,254,
+155,180,254,230,74,1,100,254,230,74,1,100,180,4,41,158,127,195,166,158,127,
+195,253,197,1,225,151,123,190,168,152,123,191,1,233,0,1,0,82,0,0,3,211,5,
+182,0,15,0,0,1,37,23,5,17,35,17,5,39,37,53,5,39,37,17,51,2,106,1,44,61,254,
+151,180,254,230,74,1,100,254,230,74,1,100,180,4,41,160,127,197,252,123,1,
+225,151,123,190,168,152,123,191,1,233,0,0,1,0,199,0,0,3,186,5,182,0,11,0,
+0,33,35,17,51,1,21,3,1,35,1,19,37,1,127,184,184,1,215,168,1,12,196,254,246,
+206,254,197,5,182,254,246,201,254,224,253,61,2,205,1,102,178,0,0,1,0,199,
+1,125,1,227,4,127,0,7,0,0,1,21,1,53,1,21,7,21,1,225,254,230,1,28,149,2,102,
+233,1,49,188,1,21,225,144,12,0,1,0,199,0,0,3,143,5,182,0,7,0,0,19,51,17,1,
+35,1,17,35,199,184,2,16,221,254,205,184,5,182,253,60,253,14,1,227,254,29,
+0,1,0,199,0,0,4,111,5,182,0,21,0,0,33,35,17,51,17,50,62,4,53,53,51,21,20,
+14,4,35,1,127,184,184,85,149,125,98,68,36,191,56,100,139,167,190,100,5,182,
+253,33,53,94,130,155,173,91,39,37,119,219,190,156,111,61,0,0,2,0,199,0,0,
+4,111,5,182,0,15,0,37,0,0,1,52,54,51,50,30,2,21,20,14,2,35,34,38,3,35,17,
+51,17,50,62,4,53,53,51,21,20,14,4,35,2,25,62,44,21,38,29,17,17,29,38,21,45,
+61,154,184,184,85,149,125,98,68,36,191,56,100,139,167,190,100,4,197,59,55,
+13,28,43,30,29,44,28,14,56,251,118,5,182,253,33,53,94,130,155,173,91,39,37,
+119,219,190,156,111,61,0,0,1,0,137,0,0,4,152,5,182,0,32,0,0,19,38,38,53,52,
+54,55,17,51,17,22,22,23,62,3,53,53,51,21,20,14,4,7,6,6,7,17,35,240,47,56,
+58,45,184,32,52,12,107,172,121,65,191,47,85,119,144,166,89,12,53,37,184,1,
+188,23,99,81,85,98,22,2,98,253,158,16,56,45,22,128,186,229,123,39,37,109,
+201,179,152,115,77,14,53,67,16,254,70,0,1,0,8,0,0,4,168,5,182,0,11,0,0,33,
+35,1,1,35,1,1,51,1,1,51,1,4,168,209,254,125,254,119,195,1,230,254,57,205,
+1,102,1,105,194,254,60,2,123,253,133,2,250,2,188,253,195,2,61,253,72,0,3,
+0,82,0,0,4,213,5,182,0,17,0,22,0,27,0,0,1,3,19,21,3,19,35,1,1,35,19,3,53,
+19,3,51,1,1,19,53,3,7,19,1,3,21,23,19,4,182,196,221,205,211,180,254,108,254,
+119,178,211,205,221,196,188,1,102,1,103,55,151,160,178,253,219,145,129,176,
+5,182,254,209,254,92,24,254,129,254,180,2,123,253,133,1,76,1,127,24,1,164,
+1,47,253,195,2,61,253,29,8,1,31,252,254,217,2,29,254,231,8,240,1,23,0,2,0,
+199,0,0,3,59,5,182,0,6,0,9,0,0,1,1,17,35,17,51,9,3,3,59,254,68,184,184,1,
+188,254,68,1,37,254,219,3,125,254,86,254,45,5,182,254,115,254,135,1,37,1,
+20,0,1,0,199,0,0,5,16,5,182,0,11,0,0,1,17,35,17,51,17,1,17,51,17,35,17,1,
+127,184,184,2,217,184,184,3,84,252,172,5,182,254,94,254,80,3,82,250,74,1,
+172,0,2,0,199,0,0,5,16,5,182,0,11,0,15,0,0,1,17,51,17,35,53,1,17,35,17,51,
+21,17,1,53,1,4,88,184,184,253,39,184,184,2,217,253,39,3,37,2,145,250,74,240,
+1,168,253,104,5,182,225,254,121,254,80,217,1,168,0,0,1,0,82,0,0,3,199,5,182,
+0,27,0,0,1,5,7,37,22,23,22,22,21,17,35,17,52,54,55,54,55,5,39,37,37,55,5,
+17,51,17,37,23,2,152,1,47,82,254,225,2,3,2,3,170,4,2,3,4,254,225,82,1,47,
+254,209,82,1,18,170,1,21,82,2,205,203,131,192,46,48,41,96,43,254,211,1,45,
+43,96,41,48,46,192,131,203,205,133,185,2,80,253,174,187,133,0,0,1,0,137,0,
+0,2,20,5,182,0,17,0,0,19,38,38,53,52,54,55,17,51,17,22,22,21,20,6,7,17,35,
+240,47,56,58,45,184,47,61,60,48,184,2,43,23,98,82,85,98,22,1,243,254,13,22,
+99,84,84,99,22,253,215,0,0,1,0,82,0,0,3,188,5,182,0,11,0,0,19,5,17,51,17,
+5,7,37,17,35,17,37,156,1,16,184,1,88,71,254,239,184,254,166,4,20,161,2,67,
+253,80,203,122,157,253,162,2,201,202,0,0,1,0,199,0,0,2,215,5,182,0,7,0,0,
+19,51,17,5,7,37,17,35,199,184,1,88,72,254,240,184,5,182,253,80,203,122,157,
+253,162,0,0,1,0,82,0,0,3,188,5,182,0,26,0,0,19,23,54,54,55,17,51,17,22,22,
+21,20,6,7,23,7,39,6,7,17,35,17,38,38,53,53,39,156,215,12,28,17,184,48,61,
+2,2,239,71,230,19,24,184,46,56,244,4,20,126,15,22,8,1,243,254,13,22,98,85,
+13,21,11,142,122,133,21,8,253,215,2,43,23,98,82,16,141,0,1,0,197,0,0,1,129,
+5,182,0,3,0,0,19,51,17,35,197,188,188,5,182,250,74,0,0,1,0,137,0,0,2,20,5,
+182,0,17,0,0,19,38,38,53,52,54,55,17,51,17,22,22,21,20,6,7,17,35,240,47,56,
+58,45,184,47,61,60,48,184,2,43,23,98,82,85,98,22,1,243,254,13,22,99,84,84,
+99,22,253,215,0,0,2,0,199,1,242,3,74,5,205,0,7,0,15,0,0,1,7,39,53,1,21,7,
+21,23,55,23,21,1,53,55,53,1,238,142,153,1,28,143,207,141,154,254,227,143,
+3,143,106,215,188,1,21,205,143,13,53,107,215,189,254,236,204,144,12,0,3,0,
+102,0,0,3,127,5,182,0,11,0,14,0,17,0,0,1,17,35,17,1,53,37,17,51,17,5,21,37,
+23,17,51,17,55,2,80,189,254,211,1,50,184,1,47,253,109,172,184,170,1,127,254,
+129,1,131,1,19,165,246,1,133,254,123,246,172,90,155,1,37,254,219,155,0,1,
+0,82,0,0,3,211,5,182,0,11,0,0,1,37,23,5,17,35,17,5,39,37,17,51,2,111,1,39,
+61,254,156,185,254,230,74,1,100,185,3,117,157,127,194,253,47,2,117,152,123,
+191,2,159,0,1,0,82,0,0,2,111,5,182,0,7,0,0,33,35,17,5,39,37,17,51,2,111,185,
+254,230,74,1,100,185,2,117,152,123,191,2,159,0,1,0,82,0,0,3,188,5,182,0,9,
+0,0,1,51,5,7,37,17,35,37,55,5,1,172,184,1,88,71,254,239,184,254,166,74,1,
+16,5,182,202,123,157,250,242,203,129,162,0,1,0,199,0,0,3,150,5,182,0,13,0,
+0,33,35,17,51,5,37,21,5,37,17,37,5,21,37,1,127,184,184,1,0,1,23,254,235,254,
+254,1,2,1,21,254,233,5,182,237,237,194,238,227,251,222,233,237,195,238,0,
+0,1,0,0,0,0,4,217,5,182,0,11,0,0,33,35,17,1,51,1,17,51,17,1,51,1,2,201,185,
+253,240,221,1,51,185,1,51,221,253,240,2,197,2,241,254,29,1,227,254,29,1,227,
+253,15,0,1,0,78,0,0,2,195,5,182,0,15,0,0,1,21,1,21,1,21,1,35,1,53,1,53,1,
+53,1,51,1,68,1,106,254,150,1,86,250,254,174,1,102,254,154,1,123,250,4,70,
+9,254,183,11,254,144,8,254,143,1,113,8,1,112,9,1,75,9,1,112,0,1,0,199,0,0,
+4,113,5,182,0,9,0,0,1,35,17,51,17,1,51,17,35,17,1,127,184,184,2,57,185,185,
+1,188,3,250,252,215,1,176,251,195,3,100,0,1,0,199,3,174,1,127,5,182,0,3,0,
+0,19,51,17,35,199,184,184,5,182,253,248,0,0,1,0,137,2,25,2,20,5,182,0,18,
+0,0,19,51,17,22,22,21,20,14,2,35,34,46,2,53,52,54,55,240,184,47,61,31,54,
+72,41,42,72,53,30,58,45,5,182,254,13,22,99,84,59,83,54,25,25,54,83,59,85,
+98,22,0,0,1,0,92,2,43,3,211,5,182,0,9,0,0,1,51,17,37,23,5,35,37,55,5,1,182,
+185,1,39,61,254,156,185,254,166,74,1,16,5,182,253,25,158,127,195,203,129,
+162,0,1,0,82,0,0,3,199,5,182,0,9,0,0,1,51,5,7,37,17,35,17,5,39,1,182,185,
+1,88,72,254,240,185,254,230,74,5,182,202,123,157,250,242,5,20,151,123,0,0,
+1,0,82,0,0,2,113,5,182,0,6,0,0,33,35,17,5,39,37,51,2,113,191,254,234,74,1,
+100,187,5,16,151,127,190,0,0,1,0,82,0,0,2,219,5,182,0,20,0,0,19,39,37,51,
+17,22,22,21,20,6,7,17,35,17,38,38,53,52,54,55,17,156,74,1,100,185,47,61,60,
+48,185,46,56,58,44,4,125,123,190,254,13,22,99,84,84,99,22,253,215,2,43,23,
+98,82,84,99,22,1,81,0,0,3,0,199,0,0,3,182,5,182,0,2,0,11,0,14,0,0,1,37,37,
+3,17,51,1,21,5,5,21,1,53,37,37,1,127,1,139,254,117,184,184,2,55,254,166,1,
+90,253,201,1,139,254,117,3,23,251,236,251,2,5,182,254,176,172,215,207,172,
+254,152,197,252,235,0,1,0,199,0,0,2,227,5,182,0,11,0,0,1,37,23,5,21,37,23,
+5,17,35,17,51,1,127,1,39,61,254,156,1,39,61,254,156,184,184,4,43,158,127,
+195,166,158,127,195,253,195,5,182,0,0,5,0,199,0,0,3,248,5,182,0,23,0,36,0,
+49,0,61,0,73,0,0,19,33,50,30,2,21,20,14,2,7,21,30,3,21,20,14,2,35,33,19,51,
+50,62,2,53,52,46,2,35,35,17,17,51,50,62,2,53,52,46,2,35,19,52,54,51,50,22,
+21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,199,1,57,111,181,129,
+71,48,85,116,67,69,120,88,51,71,132,188,117,254,203,184,88,97,132,79,34,34,
+81,133,98,84,90,97,132,81,36,36,83,134,97,37,44,34,32,43,43,32,34,44,44,34,
+32,43,43,32,34,44,5,182,44,89,136,91,81,115,78,46,12,10,12,50,83,119,80,100,
+155,106,55,3,72,36,65,89,53,51,82,58,31,253,153,253,234,41,72,98,57,54,97,
+73,42,1,133,45,39,39,45,43,41,41,253,156,45,39,39,45,43,41,41,0,1,0,199,0,
+0,4,25,5,182,0,10,0,0,1,17,1,51,1,1,35,1,17,35,17,1,127,1,184,209,254,43,
+1,230,220,254,66,184,5,182,253,60,2,196,253,58,253,16,2,229,253,27,5,182,
+0,1,0,199,0,0,5,27,5,182,0,11,0,0,1,37,17,35,17,51,1,1,51,17,35,17,2,231,
+254,152,184,184,1,104,1,123,185,185,3,238,251,251,23,5,182,254,254,1,2,250,
+74,4,236,0,0,3,0,199,0,0,5,84,5,182,0,11,0,14,0,17,0,0,1,1,51,17,35,17,1,
+1,17,35,17,51,17,9,3,17,3,12,1,150,178,178,254,108,254,107,178,178,1,35,254,
+221,2,6,1,35,4,61,1,121,250,74,1,246,1,119,254,135,254,12,5,182,253,17,1,
+16,1,10,254,244,254,242,2,28,0,1,0,31,0,0,5,45,5,182,0,27,0,0,1,46,3,39,51,
+30,3,23,17,51,17,62,3,55,51,14,3,7,17,35,2,68,90,176,148,111,24,194,16,53,
+83,120,83,196,83,119,83,53,16,195,24,111,148,176,90,196,3,133,9,63,130,207,
+152,81,136,103,67,12,1,143,254,113,12,67,103,136,81,152,207,130,63,9,252,
+123,0,1,0,162,0,0,2,45,5,205,0,18,0,0,1,38,38,53,52,62,2,51,50,30,2,21,20,
+6,7,17,35,1,8,48,54,30,53,72,41,42,72,54,31,60,48,185,4,39,22,97,84,59,83,
+53,24,24,53,83,59,84,97,22,251,217,0,1,0,199,0,0,2,217,5,182,0,6,0,0,19,51,
+5,7,37,17,35,199,186,1,88,72,254,244,190,5,182,202,127,157,250,246,0,1,0,
+164,0,0,3,27,5,182,0,20,0,0,1,22,22,21,20,6,7,17,35,17,38,38,53,52,54,55,
+17,51,5,7,37,1,195,47,61,60,48,185,46,56,58,44,185,1,88,72,254,240,3,195,
+22,99,84,84,99,22,253,215,2,43,23,98,82,84,99,22,1,243,202,123,157,0,0,2,
+0,199,1,172,3,119,4,86,0,7,0,15,0,0,1,51,23,21,3,35,3,53,1,55,53,39,35,7,
+21,23,1,184,205,242,242,205,241,1,118,179,179,61,178,178,4,86,236,188,254,
+254,1,2,188,254,220,188,12,174,174,12,188,0,0,2,0,72,0,0,4,106,5,182,0,15,
+0,19,0,0,19,51,5,37,51,9,3,35,1,1,35,9,2,3,1,1,37,88,229,1,27,1,29,229,254,
+117,1,155,254,101,1,137,229,254,229,254,231,229,1,137,254,101,1,155,168,1,
+29,1,31,254,225,5,182,245,245,254,164,254,156,254,127,254,139,1,6,254,250,
+1,117,1,129,1,100,254,156,254,239,1,17,252,0,3,0,199,0,0,5,16,5,182,0,9,0,
+14,0,19,0,0,1,1,35,17,51,1,1,51,17,35,3,51,17,35,1,1,35,17,51,1,2,238,254,
+131,170,170,1,125,1,131,159,159,9,9,9,254,222,254,51,8,8,1,29,2,82,253,174,
+5,182,253,172,2,84,250,74,1,8,3,164,254,47,1,197,252,116,1,199,0,0,2,0,78,
+0,0,4,90,5,182,0,10,0,14,0,0,1,51,9,2,35,1,1,35,1,1,55,9,2,1,240,192,1,170,
+254,113,1,143,223,254,217,254,217,223,1,143,254,113,211,1,51,1,51,254,201,
+5,182,253,250,254,39,254,41,1,102,254,154,1,215,1,217,4,254,150,1,106,1,123,
+0,1,0,20,0,0,4,250,5,182,0,13,0,0,33,17,5,37,53,5,37,51,5,37,21,5,37,17,2,
+43,254,254,254,235,1,23,1,0,184,1,0,1,23,254,235,254,254,4,254,238,238,184,
+237,237,237,237,194,238,227,251,23,0,0,1,0,82,0,0,3,199,5,182,0,27,0,0,1,
+5,7,37,22,23,22,22,21,17,35,17,52,54,55,54,55,5,39,37,37,55,5,17,51,17,37,
+23,2,152,1,47,82,254,225,2,3,2,3,170,4,2,3,4,254,225,82,1,47,254,209,82,1,
+18,170,1,21,82,2,205,203,131,192,46,48,41,96,43,254,211,1,45,43,96,41,48,
+46,192,131,203,205,133,185,2,80,253,174,187,133,0,0,1,0,20,0,0,4,250,5,182,
+0,13,0,0,33,37,5,53,37,5,17,51,5,37,21,5,37,17,2,43,255,0,254,233,1,21,1,
+2,184,1,0,1,23,254,235,254,254,238,238,195,237,233,4,239,237,237,194,238,
+227,251,23,0,0,1,0,0,0,0,4,217,5,182,0,11,0,0,1,1,35,1,17,35,17,1,35,1,17,
+51,2,201,2,16,221,254,205,185,254,205,221,2,16,185,2,242,253,14,1,227,254,
+29,1,227,254,29,2,242,2,196,0,3,0,82,0,0,5,43,5,182,0,23,0,28,0,33,0,0,1,
+19,21,3,19,35,1,17,35,17,1,35,19,3,53,19,3,51,1,17,51,17,1,51,1,19,19,53,
+3,5,3,21,19,19,4,59,228,209,221,195,254,160,153,254,159,188,215,209,227,202,
+198,1,56,153,1,58,198,254,27,211,139,162,253,178,155,139,207,4,145,254,82,
+24,254,125,254,184,2,33,253,223,2,45,253,211,1,72,1,131,24,1,174,1,37,254,
+37,1,219,254,33,1,223,253,72,254,207,1,6,8,1,53,4,254,207,8,254,250,1,45,
+0,6,0,199,0,0,5,16,5,182,0,9,0,15,0,18,0,21,0,24,0,27,0,0,1,1,35,17,51,1,
+1,51,17,35,1,1,21,1,1,53,53,17,5,1,17,5,37,17,37,1,17,37,2,238,254,131,170,
+170,1,125,1,131,159,159,254,125,254,131,1,125,1,131,254,243,1,13,254,243,
+254,13,1,6,254,250,1,6,1,8,254,248,5,182,254,246,1,10,250,74,4,6,254,248,
+70,254,246,1,10,70,162,1,116,186,252,72,1,117,187,180,254,152,180,3,178,254,
+152,180,0,1,0,31,0,0,5,45,5,182,0,27,0,0,1,51,17,30,3,23,35,46,3,39,17,35,
+17,14,3,7,35,62,3,55,2,68,196,90,176,148,111,24,195,16,53,83,119,83,196,83,
+120,83,53,16,194,24,111,148,176,90,5,182,252,123,8,63,131,207,152,81,136,
+104,67,11,254,113,1,143,11,67,104,136,81,152,207,131,63,8,0,1,0,199,0,0,1,
+127,2,43,0,3,0,0,19,51,17,35,199,184,184,2,43,253,213,0,0,1,0,82,0,0,3,211,
+5,182,0,15,0,0,1,51,5,7,37,17,37,23,5,35,37,55,5,17,5,39,1,182,185,1,98,72,
+254,230,1,39,61,254,156,185,254,166,74,1,16,254,230,74,5,182,190,125,143,
+251,154,158,127,195,203,129,162,4,106,151,123,0,0,2,0,72,0,0,2,188,5,182,
+0,6,0,9,0,0,19,1,51,17,35,17,9,3,72,1,188,184,184,254,68,1,188,254,219,1,
+37,4,41,1,141,250,74,1,211,1,170,1,108,254,236,254,219,0,0,1,0,20,0,0,6,8,
+5,182,0,25,0,0,19,33,53,51,21,33,21,33,17,1,51,17,33,21,33,21,35,53,33,53,
+33,17,1,35,17,33,20,1,37,185,1,32,254,224,2,57,184,1,37,254,219,184,254,223,
+1,33,253,199,185,254,219,5,29,153,153,162,254,18,1,176,253,9,162,164,164,
+162,2,34,254,89,2,186,0,1,0,193,2,33,2,45,3,182,0,19,0,0,19,52,62,2,51,50,
+30,2,21,20,14,2,35,34,46,2,193,28,49,66,39,38,67,49,28,28,49,67,38,39,66,
+49,28,2,236,55,77,48,22,22,48,77,55,54,77,49,23,23,49,77,0,2,0,154,1,100,
+1,152,4,119,0,19,0,39,0,0,19,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,17,
+52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,154,19,34,46,26,26,47,35,21,21,35,
+47,26,26,46,34,19,19,34,46,26,26,47,35,21,21,35,47,26,26,46,34,19,1,240,37,
+53,32,15,15,32,53,37,37,53,34,16,16,34,53,2,33,38,53,33,15,15,33,53,38,37,
+53,34,16,16,34,53,0,0,1,0,119,1,154,3,78,4,104,0,11,0,0,1,3,37,17,37,19,33,
+19,5,17,5,3,2,119,96,1,55,254,201,96,254,219,86,254,207,1,49,86,4,104,254,
+197,80,254,252,74,254,215,1,41,74,1,4,80,1,59,0,1,0,82,0,0,3,199,5,182,0,
+10,0,0,1,5,39,37,17,51,5,7,37,17,35,1,182,254,230,74,1,100,185,1,88,72,254,
+240,185,2,117,152,123,191,2,159,202,123,157,250,242,0,0,1,0,31,0,0,5,45,5,
+182,0,51,0,0,1,30,3,23,35,46,3,39,17,35,17,14,3,7,35,62,3,55,17,46,3,39,51,
+30,3,23,17,51,17,62,3,55,51,14,3,7,3,8,90,176,148,111,24,195,16,53,83,119,
+83,196,83,120,83,53,16,194,24,111,148,176,90,90,176,148,111,24,194,16,53,
+83,120,83,196,83,119,83,53,16,195,24,111,148,176,90,2,49,8,63,131,207,152,
+81,136,104,67,11,254,113,1,143,11,67,104,136,81,152,207,131,63,8,1,84,9,63,
+130,207,152,81,136,103,67,12,1,143,254,113,12,67,103,136,81,152,207,130,63,
+9,0,3,0,102,0,0,4,106,5,182,0,8,0,34,0,43,0,0,1,20,30,2,23,17,6,6,1,35,17,
+46,3,53,52,62,2,55,17,51,17,30,3,21,20,14,2,7,19,52,38,39,17,62,3,1,37,32,
+60,85,54,109,122,1,160,189,92,153,111,62,62,111,155,94,185,93,155,111,62,
+63,113,154,91,231,122,109,54,85,60,32,2,219,74,109,75,44,7,2,98,15,144,252,
+151,1,16,3,68,120,165,101,101,165,118,67,4,1,22,254,234,4,67,118,165,101,
+101,165,120,68,3,1,203,142,144,15,253,158,7,44,75,109,0,0,0,15,0,186,0,3,
+0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,30,0,94,0,3,0,1,4,9,0,2,0,14,0,124,
+0,3,0,1,4,9,0,3,0,68,0,138,0,3,0,1,4,9,0,4,0,30,0,94,0,3,0,1,4,9,0,5,0,30,
+0,206,0,3,0,1,4,9,0,6,0,26,0,236,0,3,0,1,4,9,0,7,0,68,1,6,0,3,0,1,4,9,0,8,
+0,42,1,74,0,3,0,1,4,9,0,9,0,40,1,116,0,3,0,1,4,9,0,10,0,96,1,156,0,3,0,1,
+4,9,0,11,0,62,1,252,0,3,0,1,4,9,0,12,0,60,2,58,0,3,0,1,4,9,0,13,2,150,2,118,
+0,3,0,1,4,9,0,14,0,52,5,12,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,82,0,117,0,110,0,105,
+0,99,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,
+0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,82,0,117,0,
+110,0,105,0,99,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,
+48,0,50,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,82,
+0,117,0,110,0,105,0,99,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,
+0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,
+0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,
+111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,
+0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,
+0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,
+0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,
+0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,
+0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,
+112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,
+110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,};
+#endif
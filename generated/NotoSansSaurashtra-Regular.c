@@ -0,0 +1,836 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansSaurashtra_Regular_ttf_size = 19684;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansSaurashtra_Regular_ttf");
+asm(".type fz_font_NotoSansSaurashtra_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansSaurashtra_Regular_ttf, 19684");
+asm(".balign 64");
+asm("fz_font_NotoSansSaurashtra_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansSaurashtra-Regular.ttf\"");
+#else
+const int fz_font_NotoSansSaurashtra_Regular_ttf_size = 19684;
+const char fz_font_NotoSansSaurashtra_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,1,70,1,110,0,0,73,64,0,0,0,54,71,
+80,79,83,249,141,0,177,0,0,73,120,0,0,2,206,71,83,85,66,171,178,190,135,0,
+0,76,72,0,0,0,156,79,83,47,50,124,93,107,192,0,0,1,104,0,0,0,96,99,109,97,
+112,207,209,201,24,0,0,3,60,0,0,0,108,103,97,115,112,0,7,0,7,0,0,73,52,0,
+0,0,12,103,108,121,102,157,29,209,33,0,0,4,100,0,0,58,220,104,101,97,100,
+6,47,177,146,0,0,0,236,0,0,0,54,104,104,101,97,15,253,8,72,0,0,1,36,0,0,0,
+36,104,109,116,120,215,22,19,195,0,0,1,200,0,0,1,116,108,111,99,97,158,51,
+172,21,0,0,3,168,0,0,0,188,109,97,120,112,0,110,0,157,0,0,1,72,0,0,0,32,110,
+97,109,101,143,225,187,70,0,0,63,64,0,0,6,24,112,111,115,116,250,248,180,
+152,0,0,69,88,0,0,3,217,0,1,0,0,0,1,10,61,27,23,227,111,95,15,60,245,0,11,
+8,0,0,0,0,0,205,53,107,128,0,0,0,0,210,109,241,211,252,160,253,244,10,205,
+7,16,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,11,29,252,160,255,
+37,10,205,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,0,1,0,0,0,93,0,156,0,16,0,
+0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,90,1,144,0,5,0,0,5,154,5,
+51,0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,
+0,0,0,0,0,0,0,0,0,0,8,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,
+8,141,2,88,0,0,0,1,0,0,0,0,4,241,7,16,0,0,0,32,0,7,4,205,0,193,0,0,0,0,2,
+74,0,0,2,74,0,0,3,4,0,131,3,23,0,131,5,117,0,158,5,125,0,96,5,164,0,86,5,
+168,0,90,5,186,0,63,6,233,0,104,6,164,0,72,5,106,0,61,6,158,0,84,6,164,0,
+84,5,121,0,82,6,186,0,113,5,225,0,39,5,23,0,84,6,117,0,111,6,158,0,84,4,246,
+0,43,6,162,0,72,5,223,0,123,6,92,0,84,5,113,0,96,5,117,0,55,5,186,0,104,6,
+215,0,113,7,55,0,94,6,141,0,111,4,219,0,92,5,80,0,92,5,70,0,70,5,131,0,133,
+6,70,0,104,4,168,0,129,4,244,0,68,4,201,0,106,5,174,0,82,5,141,0,86,4,180,
+0,57,5,180,0,55,5,29,0,88,6,211,0,90,6,88,0,98,5,98,0,115,5,94,0,45,6,102,
+0,100,5,25,0,61,6,39,0,72,6,98,0,78,5,209,0,96,5,2,0,84,6,199,0,102,2,252,
+0,86,4,35,0,55,0,0,253,80,3,55,254,250,4,119,255,244,4,98,0,8,4,190,0,72,
+4,184,0,72,7,33,0,88,7,43,0,90,3,150,0,51,4,137,0,61,3,152,0,51,4,14,0,59,
+5,96,0,59,6,72,0,86,0,0,252,160,1,238,0,158,3,147,0,158,4,137,0,94,3,92,0,
+59,3,150,0,57,3,242,0,76,4,23,0,76,4,186,0,94,3,199,0,68,4,178,0,72,4,182,
+0,72,4,14,0,78,4,193,0,98,0,0,255,220,0,0,255,37,7,84,0,100,7,189,0,0,9,32,
+0,78,11,29,0,0,6,194,0,100,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,96,0,0,0,20,0,16,
+0,3,0,4,0,0,0,13,0,32,0,160,32,13,37,204,168,196,168,217,254,255,255,255,
+0,0,0,0,0,13,0,32,0,160,32,12,37,204,168,128,168,206,254,255,255,255,0,1,
+255,245,255,227,255,99,224,74,218,137,87,132,87,123,1,2,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,56,0,119,0,208,1,46,1,
+137,1,234,2,80,2,180,3,30,3,133,3,216,4,79,4,177,5,24,5,143,5,221,6,48,6,
+179,6,252,7,139,7,209,8,61,8,147,8,234,9,58,9,146,10,22,10,127,10,184,10,
+227,11,36,11,111,11,197,11,238,12,90,12,173,12,247,13,80,13,145,13,252,14,
+93,14,175,15,20,15,97,15,194,16,5,16,95,16,195,17,44,17,143,17,233,18,62,
+18,94,18,150,18,186,18,232,19,59,19,151,19,238,20,103,20,190,21,51,21,103,
+21,177,21,250,22,67,22,144,23,7,23,23,23,36,23,55,23,96,23,157,23,217,24,
+29,24,112,24,177,24,238,25,53,25,122,25,188,26,99,26,112,26,141,27,19,27,
+185,28,63,29,31,29,110,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,
+33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,2,
+0,131,2,233,2,131,4,244,0,11,0,21,0,0,19,52,54,51,50,22,21,20,6,35,34,38,
+55,20,51,50,53,52,38,35,34,6,131,135,121,118,138,140,116,118,138,139,115,
+117,55,62,60,55,3,240,120,140,138,122,121,142,141,120,129,129,66,58,58,0,
+0,4,0,131,0,92,2,131,4,244,0,11,0,21,0,33,0,43,0,0,19,52,54,51,50,22,21,20,
+6,35,34,38,55,20,51,50,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,
+55,20,51,50,53,52,38,35,34,6,131,135,121,118,138,140,116,117,139,139,115,
+117,55,62,60,55,139,135,121,118,138,140,116,118,138,139,115,117,55,62,60,
+55,1,98,120,140,138,122,122,140,139,121,129,129,66,59,59,2,78,120,140,138,
+122,121,142,141,120,129,129,66,58,58,0,1,0,158,255,238,5,14,5,100,0,64,0,
+0,1,50,54,53,52,35,34,21,21,35,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,23,54,54,51,50,22,21,20,6,35,35,34,6,6,21,20,22,22,51,50,54,54,53,
+52,39,55,22,21,16,33,32,36,53,52,54,54,51,3,35,181,173,166,186,141,82,90,
+81,94,52,39,129,53,64,168,139,199,63,26,144,94,145,154,222,236,127,171,156,
+67,87,158,157,126,149,87,22,153,31,253,242,254,214,254,253,101,206,244,2,
+197,138,152,224,195,166,166,99,98,91,77,51,138,51,80,71,180,77,144,171,163,
+74,89,196,189,209,206,38,87,88,82,95,45,43,89,73,63,42,49,82,84,254,156,196,
+199,127,143,62,0,0,1,0,96,255,238,5,117,5,102,0,69,0,0,1,50,54,53,52,35,34,
+21,21,35,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,23,54,54,51,
+50,22,21,20,6,35,35,34,6,6,21,20,22,22,51,50,54,55,23,7,20,51,51,23,7,35,
+34,39,6,6,35,32,38,53,52,54,54,51,2,252,169,163,166,187,141,82,90,80,94,54,
+36,129,49,68,170,138,199,63,26,143,93,148,153,215,221,121,179,174,79,87,158,
+156,175,196,22,146,4,182,16,19,21,22,178,82,59,215,177,254,219,254,112,218,
+250,2,197,139,151,226,195,168,168,99,98,91,77,53,142,47,80,67,183,80,145,
+170,163,74,87,188,197,209,206,40,90,83,82,95,45,139,130,19,61,168,162,2,164,
+91,93,193,202,126,143,63,0,1,0,86,255,236,5,63,5,98,0,66,0,0,19,52,54,51,
+50,22,21,7,35,53,52,35,34,6,21,20,22,51,21,34,6,21,20,22,51,50,36,53,52,38,
+39,39,46,3,53,52,54,51,50,22,23,7,52,35,34,6,21,20,23,30,2,21,20,6,4,35,32,
+36,53,52,54,55,38,38,139,161,130,146,138,1,152,123,66,77,190,191,233,203,
+217,231,223,1,7,54,62,71,34,63,49,30,139,131,121,136,5,155,107,57,61,92,51,
+154,63,156,254,215,180,254,230,254,190,170,164,133,148,4,59,135,160,143,117,
+26,7,120,73,65,122,134,145,123,129,141,142,166,154,57,110,72,84,42,78,80,
+85,49,124,132,137,125,24,125,59,52,82,97,55,188,154,84,141,210,115,228,212,
+156,171,13,26,169,0,2,0,90,255,236,5,74,5,102,0,58,0,69,0,0,1,20,7,30,2,21,
+20,6,4,35,32,36,53,52,54,55,38,38,53,52,54,51,50,22,21,21,35,53,52,35,34,
+6,21,20,33,21,34,6,21,20,22,51,50,54,54,53,52,38,38,39,38,38,53,52,54,51,
+50,22,5,20,23,54,54,53,52,38,35,34,6,5,74,203,84,65,31,158,254,215,182,254,
+230,254,190,175,163,137,152,169,130,133,150,154,121,65,82,1,123,236,198,233,
+215,137,229,116,29,54,96,100,88,150,120,122,155,254,125,100,81,50,66,49,54,
+62,4,92,152,151,96,105,105,61,142,209,115,228,212,151,178,11,27,171,123,134,
+167,146,131,13,8,121,75,65,252,151,123,127,136,147,83,144,93,49,83,82,105,
+108,168,89,108,125,148,120,84,108,66,82,48,48,59,59,0,2,0,63,255,238,5,127,
+5,106,0,43,0,67,0,0,1,54,53,52,38,35,34,7,22,21,20,6,7,55,50,22,21,20,6,4,
+35,34,36,2,53,52,0,37,38,35,34,7,39,54,54,51,50,23,55,50,22,21,20,7,37,52,
+39,4,0,21,20,22,22,51,50,54,54,53,52,38,38,35,34,6,7,39,54,54,4,147,89,78,
+90,46,42,10,65,60,47,170,194,142,254,232,176,181,254,205,151,1,127,1,72,83,
+89,143,150,49,65,168,74,232,149,135,156,168,180,254,155,8,254,205,254,172,
+115,221,141,119,227,115,61,111,111,40,119,47,43,135,114,3,184,26,56,45,45,
+6,42,46,83,120,32,2,190,167,140,203,115,150,1,0,169,255,1,89,60,30,61,147,
+23,30,139,6,123,120,155,58,235,46,26,48,254,227,214,126,185,101,78,134,83,
+86,101,45,23,16,149,37,124,0,0,2,0,104,255,236,6,127,5,106,0,42,0,65,0,0,
+1,32,0,17,17,35,17,52,38,35,7,22,21,20,6,7,55,50,22,21,20,6,4,35,34,36,38,
+53,16,0,37,38,35,34,7,39,54,54,51,50,22,23,54,7,52,39,6,4,6,21,20,22,51,50,
+54,54,53,52,38,35,34,6,7,39,54,54,4,66,1,37,1,24,166,181,214,86,10,64,57,
+55,175,190,141,254,226,167,182,254,215,148,1,104,1,58,70,83,138,157,47,63,
+167,71,117,176,73,90,161,13,168,254,223,147,244,225,120,212,113,129,144,44,
+131,42,51,125,119,4,254,254,211,254,197,253,106,2,150,249,219,4,42,48,77,
+124,34,3,199,177,132,198,118,138,238,164,1,6,1,118,71,22,61,143,25,30,54,
+60,6,240,31,37,24,173,243,144,178,199,79,136,89,117,116,28,15,152,33,117,
+0,1,0,72,255,238,6,35,5,98,0,74,0,0,1,22,21,2,2,4,33,32,36,53,52,54,54,51,
+51,50,54,53,52,38,35,34,6,7,14,2,35,34,38,53,52,54,51,50,22,21,7,35,55,52,
+38,35,34,6,21,20,51,50,54,55,54,54,51,50,22,21,20,6,6,35,35,34,6,21,20,22,
+51,32,36,18,17,52,38,3,6,12,23,1,188,254,119,254,195,254,230,254,220,83,171,
+172,232,209,182,53,56,41,85,60,128,117,128,82,157,168,153,121,115,135,2,148,
+1,39,62,60,63,176,79,147,166,76,129,67,115,120,105,215,194,231,168,135,201,
+221,1,4,1,74,157,2,20,5,82,228,153,254,152,254,82,209,199,190,112,133,60,
+160,198,103,80,76,78,161,102,52,175,160,131,156,127,113,43,21,51,62,71,69,
+204,118,202,93,88,177,167,177,214,98,81,93,118,110,183,1,107,1,46,29,58,1,
+28,0,0,1,0,61,255,233,5,131,5,98,0,76,0,0,19,52,54,54,51,51,50,54,53,52,38,
+35,34,6,7,14,2,35,34,38,53,52,54,51,50,22,21,7,35,53,52,38,35,34,6,21,20,
+51,50,54,55,54,54,51,50,22,21,20,6,6,35,35,34,6,21,20,22,51,50,54,55,23,7,
+20,51,55,23,7,34,38,39,6,6,35,34,38,88,83,171,172,231,212,180,53,56,41,85,
+60,128,117,128,82,159,167,153,122,115,135,2,148,39,61,60,63,176,79,147,166,
+78,127,67,115,120,105,215,194,231,168,135,158,182,183,230,60,129,1,182,28,
+20,45,117,136,30,89,250,164,247,245,1,115,112,133,60,163,195,103,80,76,78,
+161,102,52,175,160,131,156,127,113,43,16,55,63,71,69,204,118,202,95,86,177,
+167,177,214,98,81,93,122,106,133,125,30,19,197,1,162,1,92,105,111,102,195,
+0,0,1,0,84,255,238,6,66,5,98,0,52,0,0,1,33,7,35,34,6,21,20,22,51,50,18,17,
+52,38,35,34,6,6,7,35,2,38,35,32,17,16,18,23,21,38,0,17,16,18,51,32,19,55,
+18,33,50,18,17,16,33,34,38,38,53,52,55,35,2,139,2,45,20,88,93,71,86,82,169,
+179,122,132,101,116,57,2,158,3,122,131,254,244,181,187,255,254,243,207,201,
+1,27,63,6,85,1,23,186,208,254,32,92,157,76,53,219,2,2,141,55,56,56,61,1,62,
+1,45,220,230,112,224,163,1,0,243,254,62,254,202,254,222,4,170,4,1,144,1,112,
+1,41,1,63,254,234,2,1,20,254,196,254,214,252,242,69,119,80,72,51,0,1,0,84,
+253,254,6,66,5,98,0,79,0,0,5,39,52,54,55,38,38,53,52,55,35,55,33,7,35,34,
+6,21,20,22,51,50,18,17,52,38,35,34,6,6,7,35,2,38,35,32,17,16,18,23,21,38,
+0,17,16,18,51,32,19,55,18,33,50,18,17,16,2,7,22,22,21,20,6,35,32,3,55,22,
+22,51,50,54,53,52,38,35,34,6,21,23,3,156,3,60,80,125,139,53,219,20,2,45,20,
+88,93,71,93,75,169,179,122,132,101,116,57,2,158,3,122,131,254,244,181,187,
+255,254,243,207,201,1,27,63,6,85,1,23,186,208,195,184,91,99,180,164,254,225,
+245,104,103,218,101,89,101,50,44,41,50,1,229,36,53,103,23,17,138,109,72,51,
+141,141,55,56,58,73,1,74,1,47,220,230,112,224,163,1,0,243,254,62,254,202,
+254,222,4,170,4,1,144,1,112,1,41,1,63,254,234,2,1,20,254,196,254,214,254,
+178,254,115,39,19,128,93,129,139,1,18,101,118,120,78,72,51,55,51,40,17,0,
+2,0,82,255,236,5,31,5,106,0,55,0,66,0,0,1,52,39,34,38,38,53,53,55,21,20,22,
+22,51,38,38,53,52,54,51,50,22,22,21,20,6,7,22,21,20,6,35,34,36,2,53,52,18,
+36,51,50,4,23,7,38,38,35,34,0,17,20,22,22,51,50,54,19,20,22,23,54,54,53,52,
+35,34,6,3,129,10,162,164,74,166,34,74,91,22,35,141,119,70,118,68,133,138,
+15,216,184,176,254,253,138,156,1,36,197,155,1,29,111,107,92,223,115,243,254,
+245,100,187,129,119,131,53,26,23,73,85,98,51,58,1,27,37,42,76,164,125,215,
+12,209,95,104,48,62,125,60,106,116,64,114,76,112,175,45,78,29,137,157,175,
+1,61,206,223,1,63,166,129,122,99,100,99,254,217,254,252,159,247,135,77,1,
+253,40,98,71,28,107,62,110,51,0,2,0,113,255,233,6,37,5,115,0,10,0,70,0,0,
+1,20,22,23,54,54,53,52,35,34,6,5,52,2,35,34,4,2,21,20,22,51,50,54,53,53,39,
+34,46,2,53,53,55,21,20,22,22,51,38,38,53,52,54,51,50,22,22,21,20,6,7,22,21,
+20,6,6,35,34,38,2,53,52,18,36,51,32,0,17,17,35,3,162,26,23,72,86,99,51,57,
+1,221,242,231,202,254,206,164,194,169,106,141,2,127,142,86,44,162,35,77,91,
+22,38,139,121,68,118,68,151,129,6,99,182,110,160,230,122,204,1,129,236,1,
+42,1,81,166,2,213,40,98,71,28,107,62,110,52,36,246,1,2,162,254,207,207,192,
+236,101,84,19,21,42,85,141,97,215,12,209,95,105,47,62,125,60,104,116,62,112,
+78,115,179,38,38,32,102,152,80,152,1,19,174,232,1,115,214,254,166,254,198,
+253,33,0,0,2,0,39,255,233,5,154,5,113,0,71,0,80,0,0,1,7,34,39,6,35,34,38,
+53,17,55,21,20,22,51,50,55,38,53,17,55,21,20,22,22,51,55,38,53,52,54,54,51,
+50,22,22,21,20,6,7,22,21,20,6,6,35,34,36,2,53,52,18,36,51,50,4,23,7,38,36,
+35,32,0,17,16,0,51,50,54,54,55,52,19,20,23,54,54,53,52,35,34,4,14,94,96,60,
+99,81,132,122,160,47,70,29,36,28,159,20,43,48,55,45,64,110,68,68,113,63,129,
+123,12,123,241,134,187,254,210,168,174,1,57,201,173,1,47,110,101,79,254,255,
+135,254,252,254,221,1,8,240,94,171,88,2,53,39,72,67,86,92,1,106,4,31,31,151,
+157,1,0,12,209,133,100,6,68,120,1,0,12,249,82,89,42,4,133,116,71,99,52,63,
+115,76,124,169,39,53,45,88,138,80,178,1,68,207,217,1,63,171,119,113,106,86,
+100,254,223,254,250,254,241,254,222,44,80,50,22,1,144,89,120,28,107,62,112,
+0,0,1,0,84,255,231,4,168,5,123,0,51,0,0,1,54,54,53,52,35,34,7,39,54,54,51,
+50,22,21,20,6,7,21,50,22,21,20,6,35,34,36,2,53,52,18,36,51,32,23,7,38,38,
+35,34,0,17,16,18,51,50,54,53,52,38,38,35,2,119,197,141,170,153,15,162,8,181,
+141,147,174,107,116,142,141,248,219,192,254,229,154,158,1,35,192,1,17,194,
+88,82,176,113,227,254,242,243,228,154,157,56,140,189,2,119,2,80,90,133,135,
+16,123,141,144,122,123,119,14,8,120,116,161,179,166,1,65,222,225,1,68,170,
+150,129,64,59,254,218,254,247,254,245,254,230,100,93,67,62,24,0,0,1,0,111,
+255,238,5,236,5,113,0,55,0,0,1,54,54,53,52,35,34,7,39,54,54,51,50,22,21,20,
+6,7,21,50,22,21,20,6,35,34,36,2,53,52,18,36,51,32,0,17,17,35,17,52,38,35,
+34,4,2,21,20,18,51,50,54,53,52,38,38,39,2,154,188,135,170,150,18,162,10,180,
+140,146,176,107,106,146,128,255,222,175,254,229,156,196,1,109,221,1,50,1,
+61,166,235,230,177,254,220,154,252,209,148,167,55,134,181,2,121,2,76,92,133,
+135,16,124,140,144,122,121,122,13,8,118,124,153,174,158,1,35,194,224,1,89,
+199,254,191,254,204,253,4,2,252,236,239,164,254,234,176,214,254,250,91,81,
+71,66,28,1,0,2,0,84,255,231,6,84,5,123,0,79,0,90,0,0,1,54,54,53,52,35,34,
+7,39,54,54,51,50,22,21,20,6,7,7,50,23,54,55,38,38,53,52,54,51,50,22,21,20,
+6,7,22,21,20,6,7,39,54,54,53,52,39,6,7,22,21,20,6,35,34,36,2,53,52,18,36,
+51,32,23,7,38,38,35,34,0,17,16,18,51,50,54,53,52,38,38,35,1,20,22,23,54,53,
+52,38,35,34,6,2,119,197,141,170,153,15,162,8,181,141,147,174,106,115,2,123,
+65,150,84,54,42,110,90,85,112,68,53,109,104,97,86,85,56,73,123,95,9,248,219,
+192,254,229,154,158,1,35,192,1,17,194,88,82,176,113,227,254,242,243,228,154,
+157,56,140,189,2,213,34,29,68,37,29,29,36,2,119,2,80,90,133,135,16,123,141,
+144,122,125,119,14,6,43,5,40,71,101,45,86,98,100,84,81,119,48,147,105,82,
+145,47,133,48,70,42,57,98,46,15,36,32,161,179,166,1,65,222,225,1,68,170,150,
+129,64,59,254,218,254,247,254,245,254,230,100,93,67,62,24,1,23,40,65,38,75,
+68,30,31,35,0,2,0,43,255,240,4,143,5,96,0,37,0,49,0,0,33,17,6,35,34,38,53,
+52,54,51,50,22,21,55,54,54,51,50,30,3,21,20,2,7,39,54,18,53,16,38,35,34,6,
+6,7,17,3,50,55,53,52,38,35,34,6,21,20,22,1,133,40,44,125,137,134,124,105,
+126,107,93,137,53,62,85,55,30,13,43,20,143,18,41,51,56,33,69,97,171,238,38,
+46,40,56,54,49,55,3,98,14,140,130,120,134,133,113,85,76,75,43,81,121,161,
+204,185,254,22,97,28,83,1,216,189,1,9,179,30,70,144,252,68,3,231,23,53,79,
+75,60,39,66,65,0,3,0,72,255,236,6,63,5,109,0,80,0,90,0,101,0,0,37,54,54,53,
+52,38,38,39,6,35,35,39,14,4,35,34,38,53,52,55,54,55,54,54,53,52,39,39,55,
+23,22,22,21,20,2,7,14,2,21,20,51,50,54,54,18,55,38,38,53,52,54,51,50,22,21,
+7,23,51,50,55,38,53,52,54,51,50,22,21,20,6,7,23,22,21,20,6,7,1,20,22,23,54,
+53,52,35,34,6,5,20,23,54,54,53,52,38,35,34,6,4,182,94,89,20,42,90,51,94,44,
+42,38,109,144,179,186,80,88,102,12,51,31,96,74,39,233,96,219,57,48,79,100,
+17,23,23,53,71,180,160,121,31,145,160,129,96,124,118,4,36,34,54,28,29,123,
+114,95,120,121,100,56,110,167,138,253,240,87,87,4,98,30,50,2,63,23,69,72,
+36,34,46,48,156,26,117,78,45,97,125,212,8,2,182,250,202,154,82,83,78,28,38,
+156,77,239,253,69,57,27,183,121,177,45,89,56,100,254,219,240,41,79,68,12,
+44,118,198,1,5,146,29,145,115,98,121,161,142,92,2,4,78,72,115,124,117,98,
+98,133,37,127,250,156,134,206,28,4,147,52,83,23,32,36,166,44,65,53,59,23,
+74,46,32,42,56,0,0,1,0,123,255,225,5,115,5,109,0,44,0,0,1,6,2,21,20,18,51,
+50,54,54,53,17,52,54,54,51,50,18,17,20,2,7,39,54,18,53,52,2,35,34,14,2,21,
+17,20,6,6,35,34,2,17,52,18,55,1,250,127,103,115,109,71,76,41,71,145,134,168,
+189,111,102,148,93,116,111,104,62,66,41,19,65,141,134,182,195,132,134,5,8,
+147,254,210,175,253,254,244,74,156,131,1,117,181,218,100,254,156,254,192,
+211,254,136,144,97,125,1,102,151,247,1,14,43,85,127,85,254,129,184,223,105,
+1,94,1,76,213,1,113,143,0,2,0,84,255,233,6,27,5,100,0,62,0,73,0,0,1,52,39,
+2,0,33,34,36,53,16,37,36,17,52,54,51,50,22,21,21,7,35,52,38,35,34,6,21,20,
+22,51,21,34,6,6,21,20,22,51,50,0,19,46,3,53,52,54,51,50,22,21,20,7,22,22,
+21,20,7,39,54,54,1,20,22,22,23,54,53,52,35,34,6,5,131,137,66,254,174,254,
+232,233,254,239,1,57,254,232,171,130,128,146,2,149,62,63,72,74,192,193,166,
+169,84,188,176,220,1,12,63,69,130,100,61,159,119,144,153,49,146,100,189,123,
+70,90,254,51,41,84,109,28,137,52,73,1,111,140,91,254,198,254,205,234,205,
+1,58,26,49,1,24,134,157,135,115,16,18,74,57,74,66,125,137,139,53,114,99,130,
+145,1,10,1,29,42,82,96,117,77,123,151,169,156,107,198,121,170,111,194,150,
+121,53,130,3,22,50,79,72,61,105,114,166,69,0,0,2,0,96,255,238,4,254,5,96,
+0,46,0,56,0,0,37,54,18,53,16,2,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,
+34,39,6,21,20,22,51,7,34,38,38,53,52,55,38,53,52,54,36,51,32,0,17,16,2,7,
+1,34,7,22,51,50,54,53,52,38,3,47,151,158,220,249,182,219,25,63,129,78,109,
+114,121,106,124,138,39,182,188,8,145,245,120,86,80,127,1,5,167,1,52,1,57,
+238,215,254,226,95,88,85,94,37,57,46,145,19,1,11,226,1,35,1,15,138,120,55,
+52,50,50,117,108,100,109,86,71,76,151,163,163,117,205,140,145,132,124,124,
+122,180,105,254,146,254,155,254,200,254,160,7,3,61,84,63,32,41,35,39,0,0,
+1,0,55,255,215,5,29,5,104,0,58,0,0,1,7,6,6,21,20,22,51,50,0,17,52,2,39,53,
+50,18,17,20,2,4,35,34,36,38,53,52,54,55,35,55,33,54,54,53,52,38,35,34,6,21,
+20,23,7,38,38,53,52,54,51,50,22,22,21,20,6,7,51,7,1,233,87,87,82,207,222,
+224,1,19,131,153,204,228,162,254,212,202,158,254,243,136,86,102,215,39,1,
+99,90,77,72,69,57,76,37,117,37,47,171,145,75,130,75,55,66,246,39,2,227,71,
+67,127,71,141,143,1,59,1,2,247,1,7,17,159,254,147,254,187,226,254,181,172,
+115,195,134,94,158,84,133,69,115,56,59,64,62,45,44,44,102,37,104,45,124,136,
+68,124,80,70,114,56,133,0,1,0,104,255,233,5,100,5,100,0,56,0,0,1,34,38,53,
+52,54,51,50,22,18,21,20,2,4,35,34,36,38,53,52,54,55,38,38,53,52,54,51,51,
+23,21,39,35,34,6,21,20,33,21,6,6,21,20,22,51,50,54,18,53,52,38,35,34,6,21,
+20,51,4,6,130,150,138,126,111,164,91,178,254,203,205,174,254,247,145,160,
+148,135,142,198,193,34,34,33,31,124,115,1,125,232,180,215,211,163,241,137,
+108,99,58,59,127,3,100,129,115,127,139,143,254,219,194,221,254,149,187,109,
+207,143,145,172,15,23,153,123,153,160,2,159,2,79,81,211,168,2,118,130,142,
+147,144,1,31,184,232,231,52,47,98,0,2,0,113,255,236,6,96,5,100,0,44,0,55,
+0,0,37,54,18,17,52,38,35,34,2,3,35,2,33,34,6,21,20,23,54,51,50,22,21,20,6,
+6,35,34,2,17,16,18,51,50,22,23,55,18,33,50,18,17,16,0,5,1,22,22,51,50,54,
+53,52,35,34,6,4,49,196,218,112,124,139,128,3,172,7,254,255,146,137,10,126,
+153,145,148,71,143,91,206,220,210,209,150,180,29,6,86,1,18,181,194,254,215,
+254,250,253,6,15,127,79,79,83,143,66,129,170,8,1,60,1,14,228,227,254,248,
+254,255,2,9,228,231,148,77,102,157,148,107,158,87,1,154,1,122,1,44,1,56,145,
+135,2,1,22,254,191,254,217,254,157,254,103,8,1,123,101,131,98,89,163,65,0,
+3,0,94,255,231,6,211,5,100,0,70,0,82,0,92,0,0,5,34,38,2,53,52,18,54,51,50,
+23,54,54,51,50,22,18,21,20,2,6,35,53,62,4,53,16,2,35,34,7,22,21,20,6,6,7,
+30,2,21,20,6,35,34,38,53,52,54,54,55,46,2,53,52,55,38,35,34,6,6,21,20,30,
+2,23,1,52,39,6,21,20,22,22,23,62,2,3,52,38,39,6,21,20,22,51,50,2,37,117,222,
+116,125,255,185,144,123,66,153,57,165,255,125,114,218,117,66,77,68,51,29,
+194,197,77,46,164,42,78,93,72,53,29,135,125,125,136,28,54,62,95,73,39,172,
+46,60,130,190,92,38,68,110,83,2,14,157,160,28,53,74,81,53,28,65,51,44,88,
+46,47,90,20,159,1,60,217,221,1,60,169,67,32,37,177,254,195,212,218,254,196,
+160,174,9,39,70,118,170,114,1,10,1,21,23,142,214,71,116,104,84,59,66,75,42,
+115,131,130,116,45,75,67,53,91,102,114,70,237,117,22,131,240,171,127,183,
+125,76,7,2,178,179,118,115,186,58,89,75,67,71,73,89,253,203,37,83,32,67,85,
+47,55,0,0,3,0,111,255,238,6,106,5,121,0,46,0,56,0,68,0,0,5,34,38,38,53,52,
+54,55,38,38,53,52,54,54,51,50,22,21,20,7,33,46,2,35,34,6,2,21,16,19,7,2,17,
+52,18,36,51,50,4,18,23,51,7,35,2,0,3,6,6,21,20,22,51,50,54,55,1,20,22,51,
+51,54,53,52,38,35,34,6,3,164,93,152,85,42,71,108,130,73,126,78,132,146,31,
+1,58,1,130,235,152,169,240,118,138,150,147,155,1,63,214,194,1,55,160,2,176,
+20,166,31,254,232,244,82,53,90,76,148,203,26,253,90,64,59,84,45,60,63,58,
+71,18,74,135,96,50,106,100,10,147,121,84,120,65,151,128,61,58,176,248,131,
+158,254,220,205,254,248,254,247,69,1,24,1,62,250,1,105,198,178,254,197,216,
+149,254,248,254,215,2,49,88,107,51,74,80,215,185,1,20,60,67,59,62,56,71,66,
+0,1,0,92,255,233,4,113,5,84,0,35,0,0,1,33,4,0,21,20,6,6,35,34,38,38,53,52,
+54,51,50,22,23,35,52,35,34,6,21,20,22,51,50,54,53,16,0,37,55,33,4,68,254,
+18,1,16,1,11,131,239,155,148,239,133,203,188,149,183,2,180,150,119,112,193,
+163,171,200,254,101,254,87,33,3,182,4,188,106,254,167,245,164,244,131,126,
+234,155,212,230,162,137,143,141,145,166,185,206,173,1,18,1,95,82,137,0,0,
+2,0,92,255,238,4,238,5,96,0,11,0,19,0,0,19,16,0,33,32,0,17,16,0,33,32,0,19,
+16,33,32,17,16,33,32,92,1,43,1,29,1,31,1,43,254,216,254,222,254,223,254,217,
+154,1,174,1,176,254,80,254,82,2,158,1,90,1,104,254,149,254,169,254,174,254,
+162,1,92,1,84,253,250,2,6,2,35,0,1,0,70,255,233,4,240,5,84,0,42,0,0,1,6,6,
+7,54,51,50,22,21,20,6,4,35,34,36,2,53,52,54,54,51,21,34,6,21,20,22,51,50,
+54,54,53,52,38,35,34,7,39,18,55,33,55,33,4,240,157,199,85,75,65,142,155,149,
+254,245,162,182,254,227,145,96,195,128,132,134,238,217,120,196,112,92,96,
+190,93,133,216,251,252,176,26,4,58,4,231,85,167,114,29,212,192,162,244,131,
+152,1,9,179,148,213,117,160,165,153,204,228,93,172,110,132,128,174,92,1,81,
+183,150,0,2,0,133,255,238,5,12,5,106,0,38,0,48,0,0,19,1,7,39,39,34,6,21,20,
+22,51,50,54,54,53,52,39,35,34,38,53,52,54,51,50,22,22,18,21,16,0,33,34,36,
+38,53,16,55,39,37,38,38,35,34,6,21,20,22,51,209,2,41,35,227,28,84,105,221,
+190,137,203,115,4,70,202,230,147,117,65,137,112,71,254,192,254,234,167,254,
+251,133,205,164,3,182,23,121,77,52,58,143,121,4,70,254,129,164,158,3,123,
+102,164,176,130,254,184,64,46,166,148,113,138,69,158,254,254,190,254,157,
+254,138,128,224,149,1,3,75,115,33,125,143,60,43,80,85,0,1,0,104,255,238,5,
+223,5,121,0,56,0,0,1,55,51,38,53,52,54,51,50,22,21,16,0,35,34,38,2,53,52,
+18,36,51,50,4,18,17,20,2,7,39,54,17,52,2,36,35,34,6,6,21,20,22,22,51,50,54,
+53,16,35,34,6,21,20,22,23,51,7,1,117,22,199,37,159,132,170,176,254,232,250,
+168,253,139,160,1,64,198,214,1,85,166,66,55,149,115,127,254,250,175,158,247,
+123,100,185,118,187,196,190,68,77,39,32,131,24,2,23,147,61,74,119,143,253,
+248,254,229,254,199,167,1,63,222,211,1,61,183,212,254,136,255,0,137,254,201,
+119,61,223,1,27,215,1,51,168,142,247,168,170,248,129,228,207,1,100,64,63,
+45,69,11,147,0,0,1,0,129,255,251,4,35,5,100,0,22,0,0,5,7,34,38,2,53,16,0,
+51,50,22,21,17,35,17,16,33,34,2,17,16,18,51,2,190,27,170,251,125,1,4,248,
+202,220,160,254,252,176,178,206,199,4,1,170,1,56,217,1,79,1,95,238,222,252,
+104,3,139,1,56,254,248,254,253,254,251,254,245,0,0,2,0,68,255,246,4,207,5,
+115,0,63,0,75,0,0,19,38,53,52,54,51,50,22,21,20,6,7,7,6,21,20,23,23,1,54,
+53,52,38,35,35,53,33,50,22,21,20,6,7,1,22,22,21,20,6,35,34,38,53,52,54,55,
+39,38,38,53,52,54,55,55,54,54,53,52,35,34,6,21,20,23,1,6,6,21,20,22,51,50,
+54,53,52,38,147,36,141,106,122,132,57,66,208,29,39,244,1,229,55,45,57,223,
+1,8,103,114,44,50,254,67,122,101,154,114,124,167,46,34,217,74,77,44,35,224,
+42,56,94,50,55,19,1,49,35,43,71,52,55,70,61,3,248,63,82,102,132,123,111,67,
+102,62,203,29,24,36,11,78,1,250,57,49,34,34,151,101,95,57,95,55,254,35,39,
+123,92,114,142,144,114,60,94,42,68,23,78,63,43,60,32,205,37,64,38,90,49,43,
+32,34,253,76,38,65,40,49,60,65,46,50,58,0,0,1,0,106,255,238,4,203,5,94,0,
+57,0,0,1,38,38,53,52,54,54,51,50,22,21,20,6,6,7,14,2,21,20,22,51,50,54,54,
+55,23,6,21,20,51,23,7,34,39,6,6,35,34,38,38,53,52,54,54,55,54,54,53,52,38,
+35,34,6,21,20,22,23,1,121,118,116,97,190,100,178,199,60,135,149,164,95,46,
+135,119,119,148,85,13,133,11,207,21,30,203,79,56,200,141,122,195,95,71,147,
+213,125,98,123,105,97,134,60,59,3,10,28,149,112,87,136,84,184,166,87,125,
+106,73,80,69,78,54,99,110,81,162,118,27,70,53,190,162,1,169,88,100,93,162,
+111,86,127,107,98,58,118,92,91,102,95,69,63,67,15,0,0,1,0,82,255,236,5,76,
+5,98,0,51,0,0,1,34,6,6,21,20,22,51,50,0,17,52,38,35,35,53,51,50,22,18,21,
+20,2,4,35,34,36,38,53,52,54,55,38,38,53,52,54,51,50,22,21,7,35,53,52,35,34,
+6,21,20,22,51,2,147,173,168,82,232,214,248,1,16,163,150,6,14,140,209,110,
+162,254,209,203,176,254,235,153,160,161,136,144,170,135,146,138,1,152,123,
+70,85,187,191,2,168,45,101,85,148,158,1,66,1,39,209,245,160,155,254,230,185,
+241,254,164,183,111,208,141,154,155,11,27,171,127,129,164,143,117,26,7,120,
+76,62,123,133,0,3,0,86,255,242,5,117,5,100,0,36,0,48,0,59,0,0,33,17,39,38,
+35,34,2,17,54,51,50,22,21,20,6,35,34,2,17,16,18,54,51,50,22,23,54,51,50,22,
+21,20,6,35,34,39,17,1,34,6,7,22,22,51,50,54,53,52,38,1,22,51,50,54,53,52,
+35,34,6,21,3,111,101,148,106,145,143,99,85,134,155,158,129,164,172,94,191,
+147,74,181,114,38,226,117,129,127,117,65,60,253,158,33,101,40,16,96,66,60,
+75,68,2,27,63,50,52,58,100,65,58,3,223,92,131,254,204,254,169,35,167,150,
+135,160,1,46,1,19,1,19,1,93,183,100,109,219,138,128,132,136,33,252,145,1,
+193,22,19,142,133,80,68,89,77,2,77,45,68,55,117,76,100,0,0,1,0,57,255,242,
+4,82,5,100,0,43,0,0,19,54,51,50,22,21,20,3,3,6,21,20,22,51,50,54,18,53,52,
+38,35,35,53,51,50,22,21,20,2,0,35,34,38,53,52,55,19,18,53,52,38,35,34,7,57,
+75,83,105,126,83,91,22,85,77,132,250,162,79,93,217,217,167,155,195,254,187,
+176,137,187,56,72,81,58,40,40,46,5,66,30,138,116,102,254,218,254,164,81,37,
+52,56,249,1,157,202,106,101,157,182,174,245,254,19,254,212,135,108,65,199,
+1,7,1,26,84,52,43,19,0,2,0,55,255,238,5,117,5,109,0,60,0,72,0,0,1,22,22,51,
+50,54,55,39,38,38,35,34,2,17,20,22,22,51,50,54,53,52,39,55,22,17,20,6,6,35,
+34,36,2,53,52,18,54,51,50,22,23,23,54,54,51,50,22,21,20,6,6,35,34,39,7,6,
+6,35,34,38,39,1,34,6,7,22,22,51,50,54,53,52,38,2,47,20,36,26,36,70,72,4,91,
+124,70,155,178,106,204,142,170,211,127,70,203,137,238,156,178,254,247,147,
+113,211,145,77,121,73,102,66,124,70,112,128,62,111,71,110,121,59,53,105,66,
+63,95,41,2,201,41,68,40,45,66,34,41,55,48,3,180,34,27,64,108,6,91,67,254,
+220,254,255,159,238,130,178,140,151,48,141,81,254,253,137,226,120,165,1,67,
+206,212,1,69,176,56,68,91,92,82,133,111,63,112,65,101,86,77,69,61,74,1,72,
+52,61,37,34,54,38,45,47,0,1,0,88,255,238,4,188,5,100,0,68,0,0,1,6,6,7,6,7,
+6,6,35,34,38,53,52,55,23,6,21,20,51,50,55,38,38,53,52,54,51,50,22,23,54,54,
+51,22,22,21,20,6,35,35,34,6,6,21,20,22,22,51,32,53,52,39,55,22,21,16,33,32,
+36,53,52,54,54,51,51,50,54,53,52,3,180,31,57,90,28,42,11,150,138,144,169,
+98,113,59,153,123,25,69,85,84,70,63,67,17,106,117,39,131,131,209,229,127,
+170,156,67,87,158,156,1,107,23,154,31,253,241,254,214,254,253,102,206,243,
+94,177,161,4,195,1,21,54,19,20,131,146,166,142,144,93,98,68,71,158,98,5,74,
+73,71,78,54,54,65,47,2,187,196,216,199,37,88,88,82,95,45,205,66,39,49,82,
+84,254,156,196,199,127,143,62,134,156,220,0,0,1,0,90,255,238,6,125,5,109,
+0,55,0,0,37,62,3,53,52,38,38,35,34,6,21,21,35,53,52,38,35,34,6,21,17,20,6,
+35,34,2,17,52,18,55,23,6,2,21,20,22,51,50,17,17,16,18,51,50,23,55,54,54,51,
+32,17,16,2,7,4,252,62,87,57,31,37,74,65,78,65,147,73,75,91,73,147,158,175,
+165,128,126,135,128,105,87,97,154,140,150,206,36,6,18,112,108,1,45,189,196,
+164,8,74,124,207,187,158,198,94,152,194,170,170,178,168,182,250,254,183,243,
+228,1,53,1,59,240,1,145,142,97,148,254,189,217,243,218,1,56,1,133,1,14,1,
+10,206,2,99,103,253,154,254,112,254,148,12,0,0,1,0,98,255,238,5,227,5,100,
+0,74,0,0,1,34,6,21,21,54,54,51,50,22,23,22,22,51,50,53,17,51,17,16,33,34,
+38,39,38,38,35,34,6,7,35,17,52,62,2,51,51,50,54,53,52,35,34,21,21,35,53,52,
+38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,23,54,54,51,50,22,21,20,6,35,
+2,139,184,164,42,122,72,66,137,96,91,143,71,215,149,254,154,78,152,89,89,
+144,71,89,118,6,168,57,111,181,147,123,167,159,166,189,141,82,90,79,89,51,
+33,129,49,62,163,138,198,65,26,144,94,148,153,208,222,2,53,148,151,57,51,
+62,41,46,46,42,228,3,221,252,22,254,132,45,47,47,45,91,75,1,12,109,159,102,
+54,143,164,222,193,166,166,99,98,90,78,56,141,43,80,65,178,85,145,170,163,
+74,89,188,197,223,207,0,0,1,0,115,255,242,4,246,5,100,0,52,0,0,1,38,38,53,
+52,54,51,50,22,21,20,3,3,6,21,20,22,51,50,18,18,53,52,38,35,35,53,51,50,22,
+21,20,2,0,35,34,38,53,52,55,19,54,54,53,52,38,35,34,6,21,20,22,23,1,84,110,
+115,148,124,112,132,84,91,22,85,77,128,247,149,79,93,196,196,167,155,194,
+254,198,168,137,187,56,73,52,32,56,56,44,61,51,56,3,94,13,140,109,121,135,
+139,119,98,254,214,254,164,81,37,52,56,1,11,1,149,192,106,101,157,182,174,
+248,254,23,254,211,135,108,65,199,1,6,182,138,41,50,57,52,47,44,57,11,0,2,
+0,45,255,236,5,39,5,84,0,57,0,68,0,0,19,33,50,22,21,20,2,7,23,22,51,50,54,
+53,52,38,39,38,38,53,52,51,51,21,35,34,6,21,20,22,23,22,22,21,20,6,35,34,
+38,39,39,6,6,35,34,38,53,52,54,51,50,23,54,18,53,52,35,33,19,50,54,55,38,
+35,34,6,21,20,22,158,1,69,102,111,105,48,89,160,105,103,126,66,73,77,62,244,
+227,207,63,54,60,82,71,70,180,176,60,147,102,103,30,122,96,96,121,121,106,
+59,77,43,94,82,254,166,145,42,55,18,63,46,40,42,42,5,84,106,99,60,253,191,
+213,58,108,119,92,74,188,139,146,169,63,231,156,44,50,52,149,151,132,197,
+79,177,191,60,67,65,102,96,124,95,100,121,35,194,1,244,39,90,251,195,57,70,
+24,44,31,34,42,0,0,1,0,100,0,0,5,244,5,98,0,40,0,0,37,54,18,17,52,38,35,34,
+6,6,7,35,2,38,35,34,6,21,16,18,23,21,38,38,2,53,16,33,50,22,23,55,54,54,51,
+50,18,17,16,0,5,3,225,187,196,107,124,91,105,56,2,162,3,110,120,132,116,208,
+195,169,249,133,1,123,127,167,32,6,44,162,134,184,189,254,238,254,255,166,
+8,1,51,1,27,229,221,106,228,182,1,13,247,227,225,254,230,254,202,4,166,3,
+183,1,89,231,2,104,143,135,2,144,132,254,193,254,217,254,153,254,115,8,0,
+2,0,61,255,238,4,207,5,104,0,46,0,59,0,0,1,54,51,50,22,21,20,6,7,1,30,2,21,
+20,6,35,34,38,53,52,54,55,55,1,38,53,52,54,51,33,21,33,34,6,21,20,23,1,1,
+54,53,52,38,35,34,7,3,52,38,39,39,6,6,21,20,22,51,50,54,2,227,104,124,124,
+140,56,67,254,168,98,62,34,161,135,136,166,81,104,12,254,121,105,118,100,
+1,12,255,0,35,37,47,1,137,1,91,73,56,52,75,69,20,37,45,63,79,69,81,67,65,
+80,5,23,81,139,117,66,104,61,254,186,98,81,83,45,127,155,153,127,70,137,96,
+13,1,127,103,103,88,109,156,32,23,45,47,254,125,1,71,67,54,50,57,51,252,120,
+35,63,43,60,68,87,48,60,71,74,0,2,0,72,255,225,5,199,5,109,0,59,0,68,0,0,
+1,54,53,52,38,35,34,2,21,20,18,23,7,38,2,53,16,0,51,50,22,22,21,20,7,7,21,
+20,22,22,51,50,18,53,52,46,2,39,55,22,18,21,16,2,35,34,38,53,55,6,35,34,38,
+53,52,54,51,50,22,7,50,55,38,35,34,6,21,20,3,59,29,135,121,181,196,132,96,
+138,107,134,1,22,238,123,187,103,112,2,40,88,77,110,123,54,75,83,28,117,143,
+134,200,177,179,175,4,53,74,115,129,121,98,74,116,172,52,55,31,92,35,35,3,
+59,64,74,118,136,254,254,238,149,254,130,129,94,151,1,167,180,1,46,1,99,99,
+190,135,183,120,47,43,184,156,78,1,9,254,132,203,152,104,33,101,154,254,153,
+212,254,187,254,157,232,235,102,21,123,107,93,116,79,208,31,106,40,23,74,
+0,3,0,78,255,233,6,35,5,102,0,10,0,58,0,69,0,0,1,20,22,23,54,53,52,38,35,
+34,6,1,2,0,35,34,36,2,53,16,18,51,50,22,21,20,6,35,34,39,21,20,18,22,51,50,
+18,19,38,38,53,52,54,51,50,22,21,20,7,22,22,21,20,7,39,54,53,52,38,1,34,6,
+7,22,51,50,54,53,52,38,3,213,108,109,25,60,65,48,69,1,55,66,254,205,235,189,
+254,240,145,169,171,130,146,148,124,125,82,112,210,147,188,244,53,194,146,
+143,115,135,152,43,135,105,176,125,149,64,252,89,82,88,12,73,101,68,73,72,
+4,74,76,129,62,94,130,87,79,68,253,209,254,206,254,201,176,1,88,244,1,58,
+1,71,173,148,142,171,55,62,192,254,242,138,1,25,1,10,118,193,107,125,149,
+170,155,134,176,103,172,122,188,162,119,130,120,78,107,2,159,128,130,58,85,
+69,80,82,0,2,0,96,255,240,5,137,5,100,0,61,0,71,0,0,51,17,52,54,51,50,23,
+23,54,54,51,50,22,22,21,20,6,35,34,39,6,21,20,18,51,50,54,54,53,52,39,38,
+53,52,54,51,21,35,34,6,21,20,30,2,21,20,6,6,35,34,38,2,53,52,55,38,38,35,
+34,21,17,1,34,7,22,51,50,54,53,52,38,96,119,129,85,107,60,54,126,62,70,98,
+51,116,105,104,101,60,186,171,86,144,83,49,49,147,127,16,64,57,32,38,32,115,
+206,133,150,227,123,100,62,76,34,114,2,82,76,66,70,65,48,41,46,4,35,168,153,
+112,64,68,74,58,98,60,111,120,94,146,192,240,254,244,89,165,113,91,192,192,
+88,136,151,160,64,67,75,143,140,138,69,160,238,126,160,1,49,206,247,196,68,
+53,160,251,221,4,170,86,55,46,27,31,37,0,0,2,0,84,255,233,4,172,5,84,0,49,
+0,60,0,0,1,6,6,7,54,51,50,22,21,20,6,6,35,34,38,39,6,21,20,22,22,51,50,54,
+54,55,52,38,39,55,22,21,20,6,6,35,34,36,38,53,52,54,55,53,52,55,33,55,33,
+7,1,34,7,22,22,51,50,54,53,52,38,2,215,74,109,18,67,71,125,151,59,106,73,
+104,156,34,152,107,194,121,101,173,103,2,29,18,127,59,130,246,148,154,254,
+254,147,137,135,78,254,133,33,4,28,34,254,36,62,67,18,94,56,42,48,69,4,190,
+4,96,78,21,121,102,60,105,61,118,105,123,192,116,172,89,88,163,108,40,112,
+36,51,108,137,144,231,140,134,244,161,142,238,79,18,125,96,150,150,254,222,
+25,62,73,42,34,38,46,0,1,0,102,255,244,6,106,5,100,0,59,0,0,1,52,38,35,34,
+6,21,21,35,53,52,38,35,34,6,21,20,30,2,23,21,38,2,17,16,33,50,22,23,55,54,
+54,51,50,23,55,54,54,51,50,18,17,16,2,7,53,62,3,53,52,38,35,34,6,21,21,35,
+4,4,76,84,80,71,148,66,77,95,81,32,56,88,61,196,189,1,45,107,120,15,6,18,
+110,98,187,34,6,16,114,97,157,154,187,198,62,88,57,31,81,95,78,65,148,3,137,
+146,153,149,150,207,170,200,146,221,229,190,205,124,74,7,176,12,1,108,1,144,
+2,102,102,94,2,95,101,196,2,92,100,254,207,254,203,254,112,254,148,12,176,
+8,75,127,202,188,230,220,148,198,170,0,1,0,86,0,0,2,164,5,84,0,18,0,0,33,
+17,6,35,34,38,53,17,55,17,20,51,50,54,54,53,17,55,17,2,14,66,81,140,153,152,
+153,32,65,38,150,1,201,33,171,153,2,83,21,253,158,187,31,54,38,2,141,21,250,
+172,0,1,0,55,255,231,3,242,5,84,0,35,0,0,1,0,2,6,21,20,22,51,50,55,23,6,35,
+34,38,53,52,54,18,19,33,34,21,21,35,53,52,38,35,53,50,22,23,54,51,33,3,242,
+254,249,176,79,48,38,39,34,56,72,57,108,132,85,181,240,254,231,180,152,86,
+90,93,127,24,52,212,1,139,4,188,254,77,254,197,189,52,42,40,21,158,27,131,
+107,56,205,1,76,1,152,174,225,168,114,107,160,71,66,137,0,0,1,253,80,5,162,
+255,154,7,4,0,21,0,0,1,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,7,39,54,
+53,52,38,254,117,76,72,15,136,24,160,133,136,157,25,135,14,72,6,111,55,44,
+31,28,47,58,56,112,128,131,109,53,61,47,26,33,44,55,0,0,1,254,250,255,238,
+2,240,7,16,0,31,0,0,3,38,53,52,54,51,50,22,21,17,20,22,51,50,54,53,51,20,
+6,35,34,38,53,17,52,38,35,34,6,21,20,23,244,18,182,143,173,157,54,53,51,49,
+152,139,113,126,132,79,97,73,102,9,5,158,43,53,117,157,218,214,251,207,89,
+71,54,41,114,142,152,169,4,90,131,109,68,51,29,22,0,3,255,244,255,238,4,49,
+5,96,0,30,0,42,0,54,0,0,19,22,23,54,51,50,22,21,20,6,35,34,38,53,53,6,7,22,
+18,21,20,6,35,34,38,53,52,18,55,38,39,1,16,39,6,2,21,20,22,51,50,54,54,1,
+34,7,6,21,20,51,50,54,53,52,38,25,229,166,200,214,114,125,120,105,109,121,
+58,58,96,100,150,138,143,150,123,98,139,211,2,53,133,70,88,77,71,39,65,39,
+1,33,39,49,6,92,44,50,49,5,96,67,183,250,128,115,111,135,132,126,4,47,78,
+143,254,159,188,169,189,188,172,135,1,118,159,169,54,252,141,1,51,238,127,
+254,215,119,100,109,49,93,3,188,14,38,32,119,56,41,51,55,0,3,0,8,255,238,
+4,66,6,53,0,35,0,47,0,59,0,0,19,22,23,54,55,54,55,23,6,7,55,50,22,21,20,6,
+35,34,38,53,6,7,22,18,21,20,6,35,34,38,53,52,18,55,38,39,1,16,39,6,2,21,20,
+22,51,50,54,54,1,34,7,6,21,20,51,50,54,53,52,38,45,225,166,114,105,37,107,
+102,63,33,53,114,118,121,101,113,124,53,60,100,103,152,139,143,152,120,99,
+138,208,2,53,137,72,81,76,71,39,65,39,1,25,44,46,4,100,42,52,45,5,96,65,185,
+137,54,132,140,67,80,76,4,123,114,108,132,135,121,45,80,149,254,160,183,169,
+189,189,171,136,1,115,161,160,55,252,149,1,55,234,133,254,219,117,99,110,
+49,93,3,188,16,21,39,127,52,45,43,63,0,0,2,0,72,255,238,4,104,5,96,0,52,0,
+61,0,0,1,34,38,53,52,36,51,50,22,22,21,20,6,35,34,38,53,52,55,35,34,6,21,
+20,22,51,51,50,22,22,21,20,4,33,32,36,53,52,55,23,6,6,21,20,22,51,50,54,53,
+52,38,38,35,19,52,39,6,21,20,22,51,50,2,63,215,229,1,0,217,142,200,107,122,
+106,106,135,53,29,156,173,151,145,111,189,166,87,254,237,254,251,254,254,
+254,250,37,149,9,18,180,179,177,204,46,108,131,221,112,64,48,42,86,2,59,208,
+192,187,218,78,142,93,117,135,132,110,98,70,131,121,126,134,63,143,126,194,
+201,192,186,70,96,49,17,61,28,108,118,116,106,84,85,35,1,240,91,38,64,71,
+41,49,0,3,0,72,254,164,4,106,5,100,0,52,0,76,0,85,0,0,1,34,38,53,52,36,51,
+50,22,22,21,20,6,35,34,38,53,52,55,35,34,6,21,20,22,51,51,50,22,22,21,20,
+4,33,32,36,53,52,55,23,6,6,21,20,22,51,50,54,53,52,38,38,35,1,22,22,51,50,
+54,55,54,54,51,50,22,23,7,38,38,35,34,14,2,35,34,39,1,52,39,6,21,20,22,51,
+50,2,63,216,232,1,4,217,142,201,106,122,106,106,135,53,29,156,173,151,145,
+111,189,166,87,254,237,254,251,254,254,254,250,37,149,9,18,180,179,177,204,
+46,108,131,254,55,60,120,72,55,97,59,59,81,47,67,123,61,126,28,69,51,45,78,
+82,95,64,207,152,3,6,112,64,48,42,86,2,59,209,191,188,221,81,144,92,117,135,
+132,110,98,70,131,121,126,134,63,143,126,194,201,192,186,70,96,49,17,61,28,
+108,118,116,106,84,85,35,253,119,60,57,26,32,31,26,76,90,76,42,44,35,42,35,
+168,4,223,91,38,64,71,41,49,0,2,0,88,255,240,6,188,5,100,0,47,0,57,0,0,5,
+35,34,2,17,16,18,51,50,22,23,54,51,50,18,17,16,2,35,34,38,38,53,52,54,51,
+50,22,23,54,53,16,33,34,6,21,17,35,17,52,38,35,34,2,17,16,18,51,1,38,35,34,
+6,21,20,51,50,54,2,68,6,242,244,237,214,121,188,51,120,236,227,242,160,173,
+89,136,66,146,126,51,75,69,4,254,192,130,152,154,140,116,156,159,158,165,
+3,221,94,76,61,76,133,88,81,4,1,97,1,89,1,75,1,99,106,96,202,254,135,254,
+154,254,167,254,196,83,153,102,145,164,19,30,45,45,2,37,170,152,252,125,3,
+143,144,164,254,247,254,254,254,245,254,251,1,18,45,87,81,176,154,0,0,3,0,
+90,254,154,6,190,5,100,0,22,0,70,0,80,0,0,5,22,22,51,50,62,2,51,50,22,23,
+7,38,38,35,34,14,2,35,34,39,55,35,34,2,17,16,18,51,50,22,23,54,51,50,18,17,
+16,2,35,34,38,38,53,52,54,51,50,22,23,54,53,16,33,34,6,21,17,35,17,52,38,
+35,34,2,17,16,18,51,1,38,35,34,6,21,20,51,50,54,1,217,80,132,73,80,124,112,
+111,68,69,118,59,133,28,63,50,45,102,114,129,73,216,173,209,6,242,244,237,
+214,122,189,49,120,236,227,242,160,173,89,136,66,146,126,51,75,69,4,254,192,
+130,152,154,140,116,156,159,158,165,3,222,94,76,62,76,133,88,82,72,80,59,
+38,45,38,67,87,75,41,45,39,47,39,192,162,1,97,1,89,1,75,1,99,108,94,202,254,
+135,254,154,254,167,254,196,83,153,102,145,164,19,30,45,45,2,37,170,152,252,
+125,3,143,144,164,254,247,254,254,254,245,254,251,1,18,45,87,81,176,154,0,
+2,0,51,255,236,3,92,5,102,0,18,0,31,0,0,37,36,19,6,35,34,38,53,52,54,54,51,
+50,18,17,20,2,6,7,19,50,54,55,53,52,38,35,34,6,21,20,22,1,0,1,113,71,112,
+138,177,218,91,173,117,208,220,135,246,155,122,75,113,81,130,145,112,123,
+127,135,148,1,108,57,222,173,112,182,103,254,234,254,248,204,254,158,250,
+52,2,249,32,48,10,203,197,130,116,114,130,0,1,0,61,255,233,4,61,5,84,0,50,
+0,0,1,7,4,2,21,20,22,22,51,50,54,54,53,52,38,35,7,53,51,50,22,22,21,20,6,
+6,35,34,38,38,53,52,62,2,55,33,34,6,21,20,23,23,7,39,38,53,52,54,51,33,4,
+61,198,254,187,245,76,132,81,82,131,78,114,111,25,15,119,180,88,108,213,122,
+117,213,108,68,133,219,231,253,234,24,32,17,84,117,92,60,112,91,3,2,4,188,
+126,202,254,213,171,86,119,64,58,112,84,105,118,1,151,90,171,118,119,185,
+112,120,192,125,105,188,177,181,147,23,22,21,26,121,84,132,85,77,74,81,0,
+3,0,51,255,246,3,86,5,102,0,25,0,37,0,47,0,0,1,54,55,6,35,34,38,53,52,54,
+54,51,32,17,20,2,6,35,34,38,53,52,54,51,50,22,3,50,54,55,38,38,35,34,6,21,
+20,22,19,50,55,38,35,34,6,21,20,22,2,129,63,11,129,140,177,218,91,173,117,
+1,166,117,207,122,120,141,128,106,75,116,126,82,119,70,11,133,133,112,125,
+127,78,81,74,93,77,51,47,60,1,96,140,165,67,222,173,112,182,103,253,129,214,
+254,167,194,138,105,111,135,58,1,64,38,44,215,193,130,116,112,132,253,166,
+90,97,54,39,44,50,0,0,1,0,59,255,233,3,203,5,84,0,47,0,0,1,38,38,53,52,54,
+51,33,50,22,22,21,20,6,4,7,22,22,23,22,22,51,55,23,7,34,38,38,39,46,2,35,
+53,54,36,55,54,53,52,38,35,33,34,21,20,22,23,1,197,177,217,126,126,1,166,
+66,110,62,179,254,241,152,51,94,69,59,120,69,43,15,51,75,113,94,77,79,89,
+106,70,228,1,78,94,38,53,43,254,94,104,128,157,3,23,52,199,119,98,105,60,
+111,77,113,246,165,23,15,108,118,101,98,4,151,5,52,96,128,131,93,51,148,3,
+161,145,60,71,45,51,65,67,104,50,0,0,1,0,59,255,238,4,246,5,84,0,52,0,0,1,
+38,38,53,52,54,51,33,50,22,22,21,20,6,4,7,22,22,23,22,51,50,55,17,51,17,6,
+6,35,34,46,6,39,53,54,36,55,54,53,52,38,35,33,34,21,20,22,23,1,193,179,211,
+126,126,1,166,66,110,62,179,254,241,152,48,92,79,128,154,145,105,150,100,
+178,115,71,114,94,79,74,73,82,96,59,228,1,78,94,38,53,43,254,94,104,133,152,
+3,27,52,197,117,98,105,60,111,77,113,246,165,23,16,102,119,193,80,4,121,251,
+43,76,69,46,75,97,101,98,77,50,2,148,3,161,145,60,71,45,51,65,66,106,49,0,
+3,0,86,255,238,6,31,5,96,0,61,0,73,0,82,0,0,37,6,6,35,34,38,53,17,5,17,20,
+6,35,34,38,38,53,52,54,55,37,17,52,35,35,34,6,21,20,22,23,7,46,2,53,52,54,
+51,51,50,17,17,37,53,52,54,51,50,22,21,20,6,7,7,17,20,22,51,50,54,55,5,50,
+54,55,17,7,6,6,21,20,22,22,1,55,54,53,52,38,35,34,21,6,31,52,113,81,124,153,
+254,238,87,93,65,205,144,76,104,1,13,109,205,34,39,136,103,61,82,167,81,116,
+109,205,254,1,18,135,132,107,136,102,121,141,74,57,34,63,40,252,144,24,21,
+2,203,51,39,89,128,2,129,80,133,51,45,117,94,58,54,157,131,1,224,107,254,
+102,143,108,165,217,76,63,81,41,104,1,86,148,32,28,55,120,42,139,35,134,135,
+64,90,103,254,209,254,237,109,180,160,141,143,105,95,125,48,55,253,244,60,
+78,31,41,72,36,40,1,111,78,19,42,39,40,120,105,3,41,31,52,87,42,57,136,0,
+0,1,252,160,253,244,254,113,255,141,0,3,0,0,5,1,7,1,252,244,1,125,109,254,
+156,115,254,242,139,1,47,0,0,1,0,158,255,215,1,51,5,125,0,3,0,0,23,17,51,
+17,158,149,41,5,166,250,90,0,0,2,0,158,255,215,2,184,5,125,0,3,0,7,0,0,23,
+17,51,17,51,17,51,17,158,149,240,149,41,5,166,250,90,5,166,250,90,0,0,2,0,
+94,255,238,4,35,5,96,0,11,0,21,0,0,19,16,18,51,50,18,17,16,2,35,34,2,19,16,
+22,51,50,54,17,16,33,32,94,253,228,231,253,250,234,228,253,154,163,164,166,
+164,254,182,254,185,2,158,1,82,1,112,254,142,254,176,254,177,254,159,1,108,
+1,68,254,243,249,249,1,13,2,35,0,2,0,59,255,229,2,246,5,102,0,27,0,40,0,0,
+1,6,35,34,38,53,52,54,51,50,22,22,21,20,7,6,6,21,20,22,23,7,38,53,52,54,55,
+54,39,50,55,54,53,52,38,35,34,6,21,20,22,1,238,41,41,163,190,196,161,102,
+153,87,140,106,80,61,42,58,207,81,63,36,44,111,58,37,103,99,96,103,101,2,
+143,6,195,168,166,204,91,178,130,166,231,175,147,39,38,57,9,148,55,177,66,
+159,98,52,215,24,96,78,112,116,106,103,109,108,0,1,0,57,0,18,3,68,5,102,0,
+39,0,0,1,22,23,30,2,51,55,23,7,34,46,4,39,55,22,51,50,54,53,52,38,35,34,6,
+7,39,54,54,51,50,22,22,21,20,6,35,1,94,52,65,62,74,88,59,59,14,67,96,131,
+95,72,73,87,63,49,93,80,153,170,125,108,86,111,90,107,87,189,111,116,177,
+99,227,190,2,43,47,107,103,78,42,4,159,5,62,100,124,123,110,36,144,24,150,
+130,112,132,43,74,129,82,71,108,189,108,193,233,0,0,1,0,76,255,240,3,164,
+5,106,0,47,0,0,19,54,51,50,22,21,20,6,7,22,22,21,20,6,6,35,34,38,38,53,52,
+54,54,55,21,6,6,21,20,22,51,50,54,54,53,52,38,35,7,53,50,54,53,52,38,35,34,
+7,209,141,170,158,178,98,86,127,133,113,198,119,127,201,98,64,115,81,53,64,
+139,138,80,132,76,159,157,34,127,146,89,92,118,105,4,252,110,180,164,94,146,
+32,29,189,153,126,186,103,93,164,111,72,124,72,3,154,2,71,50,97,106,63,118,
+82,138,151,1,140,114,94,87,94,82,0,0,2,0,76,255,238,3,174,5,100,0,41,0,55,
+0,0,5,34,38,38,53,52,54,55,38,38,53,52,54,55,23,6,6,21,20,22,23,62,2,53,52,
+38,39,55,22,22,21,20,6,6,7,22,22,21,20,6,6,3,6,6,21,20,22,22,51,50,54,54,
+53,52,38,1,254,121,211,102,146,136,159,123,88,84,98,57,62,130,151,121,104,
+58,62,57,98,83,89,59,112,114,140,145,103,214,117,158,137,70,140,85,86,140,
+69,136,18,108,181,118,128,201,60,75,153,98,85,142,49,108,35,78,63,73,124,
+57,50,69,83,52,63,78,35,108,49,142,85,69,112,92,53,62,199,128,118,180,109,
+2,223,69,159,90,79,117,62,67,118,84,92,150,0,1,0,94,255,237,4,88,5,100,0,
+42,0,0,1,1,54,51,50,22,21,20,6,35,39,53,62,2,53,52,38,35,34,6,7,1,39,19,7,
+35,34,38,53,52,54,51,51,21,34,17,20,22,51,50,55,1,3,184,255,0,62,37,151,166,
+176,162,22,82,83,48,92,78,42,90,47,254,232,121,219,18,19,142,161,189,173,
+7,225,84,75,48,65,1,63,5,33,253,227,19,208,198,194,210,1,163,2,50,101,87,
+127,137,28,17,253,178,70,1,205,2,215,192,203,223,164,254,250,123,143,21,2,
+163,0,1,0,68,255,238,3,98,5,92,0,41,0,0,1,54,54,53,52,35,34,6,21,20,33,21,
+35,34,6,21,16,33,50,55,23,6,6,35,34,38,38,53,16,55,38,38,53,52,54,51,50,22,
+21,20,6,7,2,133,34,26,222,134,134,1,66,9,154,153,1,12,160,103,114,62,192,
+120,127,188,103,248,121,133,218,187,186,197,56,48,3,227,29,45,31,123,89,81,
+201,131,150,141,254,221,152,101,99,109,102,198,144,1,39,59,20,142,113,149,
+168,139,141,53,114,38,0,2,0,72,255,236,4,100,5,102,0,33,0,45,0,0,37,50,54,
+18,55,6,35,34,38,38,53,52,54,51,50,22,21,20,2,2,35,34,2,2,53,52,55,23,6,6,
+21,20,18,18,1,50,55,54,53,52,38,35,34,6,21,20,2,84,49,122,126,43,40,42,85,
+125,69,154,131,122,142,171,246,111,113,243,168,61,154,28,34,124,175,1,80,
+55,56,10,64,61,72,65,150,147,1,19,161,10,81,147,87,155,183,189,165,191,253,
+253,254,176,1,62,1,234,197,245,152,49,58,192,98,162,254,104,254,247,2,206,
+33,70,63,92,95,89,90,174,0,2,0,72,255,236,4,100,5,102,0,32,0,43,0,0,1,34,
+2,7,54,51,50,22,22,21,20,6,35,34,38,53,52,18,18,51,50,18,18,21,20,7,39,54,
+54,53,52,2,2,1,34,7,6,21,20,51,50,54,53,52,2,88,81,201,58,40,42,85,125,69,
+154,131,122,142,171,246,111,113,243,168,61,154,28,34,124,175,254,176,49,62,
+10,125,72,65,4,188,254,155,228,12,81,147,87,155,183,189,165,191,2,3,1,80,
+254,194,254,22,197,244,153,49,58,193,97,162,1,153,1,8,253,50,33,58,75,187,
+89,89,175,0,0,1,0,78,255,238,3,176,5,106,0,43,0,0,1,7,22,22,21,20,6,6,35,
+34,38,38,53,52,54,55,54,54,53,52,39,55,22,22,21,20,6,7,6,6,21,20,22,51,50,
+54,54,53,52,38,39,7,53,37,3,176,170,74,76,105,198,109,118,205,111,56,64,67,
+52,116,102,72,84,57,62,63,56,161,130,72,121,73,98,68,213,2,33,2,233,77,42,
+144,91,115,183,111,106,191,129,87,169,107,112,141,70,99,83,110,52,149,91,
+79,160,103,106,161,77,121,142,60,110,76,85,116,4,96,155,246,0,16,0,98,0,86,
+4,94,4,82,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,
+0,111,0,119,0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,
+35,34,53,52,51,50,23,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,
+34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,
+52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,
+50,1,20,35,34,53,52,51,50,37,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,
+39,20,35,34,53,52,51,50,3,215,51,55,55,51,147,52,57,57,52,247,55,53,55,53,
+35,51,55,55,51,254,56,54,53,53,54,173,55,53,53,55,2,82,55,53,53,55,253,27,
+55,54,54,55,2,129,51,55,55,51,147,52,57,57,52,253,174,52,57,55,54,35,53,56,
+56,53,1,199,54,53,53,54,254,92,54,55,55,54,247,55,53,53,55,147,55,54,54,55,
+3,150,54,54,55,43,53,53,55,254,211,55,55,53,227,53,53,53,1,148,56,56,53,90,
+53,53,55,253,119,53,53,55,1,185,54,51,58,253,67,53,53,56,154,51,51,55,2,29,
+55,55,53,227,53,53,53,254,4,55,55,54,227,53,53,55,254,213,55,51,55,43,53,
+53,56,0,0,1,255,220,0,183,0,36,6,131,0,3,0,0,19,17,35,17,36,72,6,131,250,
+52,5,204,0,1,255,37,0,183,0,219,6,131,0,14,0,0,55,35,17,7,39,55,39,55,23,
+55,23,7,23,7,39,36,72,134,49,171,171,49,170,170,49,171,171,49,134,183,4,161,
+136,49,169,168,49,171,171,49,168,169,49,136,0,2,0,100,255,238,6,240,5,96,
+0,82,0,94,0,0,1,14,2,4,33,32,36,38,53,52,54,54,51,33,50,54,53,52,35,34,6,
+21,17,35,17,52,38,35,34,6,21,17,35,17,52,35,34,6,7,54,51,50,22,21,20,6,35,
+34,38,53,52,54,51,50,22,23,54,54,51,50,22,23,54,54,51,50,22,21,16,0,33,33,
+34,6,21,20,4,33,32,36,54,55,1,22,22,51,50,54,53,52,38,35,34,6,6,230,35,125,
+185,254,229,254,248,254,225,254,203,150,99,211,172,2,121,198,181,156,90,72,
+141,80,89,88,81,141,211,90,105,11,40,54,96,114,123,106,114,128,208,170,98,
+145,30,25,124,95,93,123,26,32,120,100,137,150,254,249,254,235,253,172,207,
+153,1,20,1,68,1,49,1,8,147,36,250,156,3,48,39,38,46,38,37,29,42,1,128,113,
+153,92,44,57,123,105,105,116,58,224,229,222,98,99,254,148,1,108,105,92,92,
+105,254,148,1,108,197,72,52,19,121,101,121,138,199,169,163,210,86,77,72,91,
+90,73,82,81,191,163,254,204,254,213,63,71,74,64,54,128,119,1,252,81,81,52,
+54,37,47,13,0,4,0,0,254,187,7,93,5,109,0,8,0,46,0,57,0,116,0,0,1,50,55,38,
+35,34,6,21,20,5,30,3,21,21,7,23,22,22,51,50,54,55,23,6,6,35,34,38,39,39,6,
+6,35,34,38,53,52,54,51,50,23,46,2,39,19,50,54,55,38,35,34,6,21,20,22,37,38,
+2,53,16,0,51,50,22,21,20,7,6,21,20,22,22,51,50,18,17,52,46,2,39,55,22,18,
+21,16,2,35,34,38,53,55,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,34,
+2,21,20,18,23,4,0,52,55,31,92,35,35,253,78,28,85,80,58,1,89,82,135,71,89,
+108,36,130,52,188,121,60,146,103,103,30,121,97,93,124,124,103,58,78,3,60,
+91,42,50,42,55,18,63,46,40,42,42,2,104,142,179,1,24,236,193,220,111,3,38,
+87,80,111,122,54,75,83,28,117,143,134,199,178,180,174,4,53,74,115,129,121,
+98,75,115,37,29,136,120,180,197,145,131,2,172,31,106,40,23,74,43,14,93,150,
+200,121,29,30,58,53,55,84,85,47,145,134,62,65,65,103,95,122,97,102,119,35,
+90,183,141,25,253,67,57,70,24,44,31,34,42,151,124,1,163,211,1,46,1,99,228,
+196,185,118,30,60,170,172,76,1,7,1,0,132,203,152,104,33,101,154,254,153,212,
+254,189,254,155,231,236,102,21,122,108,93,116,78,66,66,72,118,136,254,255,
+239,183,254,176,120,0,5,0,78,254,162,8,228,5,102,0,10,0,54,0,65,0,77,0,90,
+0,0,1,20,22,23,54,53,52,38,35,34,6,1,2,33,32,0,17,16,18,51,50,22,21,20,6,
+35,34,39,21,16,18,51,32,19,38,38,53,52,54,51,50,22,21,20,7,22,22,21,20,7,
+39,54,53,52,38,1,34,6,7,22,51,50,54,53,52,38,1,20,22,51,50,54,53,52,38,35,
+34,6,7,52,54,51,50,22,21,20,6,6,35,34,38,3,213,108,109,25,59,66,51,66,1,55,
+133,254,31,254,230,254,194,169,171,128,148,149,123,125,82,246,223,1,119,110,
+186,154,144,114,136,151,43,139,101,176,125,149,64,252,89,82,88,12,73,101,
+69,72,72,4,246,103,89,89,103,104,88,91,101,141,195,138,139,194,87,156,90,
+137,196,4,74,76,128,63,93,131,88,78,72,253,213,253,151,1,144,1,108,1,58,1,
+71,172,149,143,170,55,62,254,227,254,197,2,35,114,189,115,124,150,169,156,
+138,172,108,167,122,188,162,119,131,119,78,107,2,159,127,131,58,85,69,81,
+81,251,69,93,105,106,92,85,100,100,95,148,206,200,147,95,165,99,203,0,0,7,
+0,0,254,70,10,205,5,102,0,43,0,75,0,111,0,122,0,133,0,144,0,155,0,0,1,2,33,
+32,0,17,16,18,51,50,22,21,20,6,35,34,39,21,16,18,51,32,19,38,38,53,52,54,
+51,50,22,21,20,7,22,22,21,20,7,39,54,53,52,38,1,22,22,21,20,6,35,34,38,53,
+52,54,55,35,55,51,54,54,53,16,2,39,53,22,22,18,21,20,6,7,33,7,5,6,35,34,38,
+39,39,6,6,35,34,38,53,52,54,51,50,23,46,2,39,55,30,3,21,21,7,23,22,22,51,
+50,55,1,22,51,50,54,53,52,38,35,34,6,1,54,53,52,38,35,34,6,21,20,22,1,20,
+22,51,50,54,53,52,38,39,6,5,50,54,55,38,35,34,6,21,20,22,6,186,133,254,31,
+254,230,254,194,169,171,128,148,149,123,125,82,246,223,1,119,110,186,154,
+144,114,136,151,43,139,101,176,125,149,64,2,216,43,58,132,110,120,136,57,
+44,206,39,244,20,25,196,176,161,235,128,24,20,1,62,39,249,251,108,200,61,
+145,103,103,30,121,97,93,124,124,103,58,78,3,60,91,42,81,28,85,80,58,1,89,
+82,135,71,120,63,254,122,73,101,69,72,72,61,82,88,3,180,25,59,66,51,66,108,
+2,243,51,40,40,51,49,42,91,247,247,42,55,18,63,46,40,42,42,2,82,253,151,1,
+144,1,108,1,58,1,71,172,149,143,170,55,62,254,227,254,197,2,35,114,189,115,
+124,150,169,156,138,172,108,167,122,188,162,119,131,119,78,107,253,216,29,
+110,56,113,134,133,114,55,110,30,133,67,200,82,1,68,1,138,31,149,21,224,254,
+119,244,81,203,81,133,150,169,62,65,65,103,95,122,97,102,119,35,90,183,141,
+25,122,14,93,150,200,121,29,30,58,53,55,81,4,22,58,85,69,81,81,127,254,247,
+93,131,88,78,72,51,76,128,251,191,47,51,51,47,51,93,35,74,92,57,70,24,44,
+31,34,42,0,0,3,0,100,254,144,6,61,5,100,0,19,0,37,0,48,0,0,5,32,0,17,16,0,
+51,50,22,21,17,35,17,16,33,32,17,16,18,51,1,6,2,21,21,54,51,50,22,21,20,6,
+35,34,2,17,16,55,19,50,54,53,52,38,35,34,7,22,22,4,216,254,231,254,220,1,
+4,248,201,221,160,254,252,254,158,205,200,252,247,103,111,82,125,124,148,
+147,129,171,169,237,105,61,72,72,69,101,73,12,88,4,1,100,1,86,1,79,1,95,238,
+222,252,104,3,139,1,56,253,245,254,249,254,247,2,121,70,254,247,193,62,55,
+174,139,149,172,1,71,1,58,1,194,194,251,154,81,81,69,85,58,131,127,0,0,0,
+15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,40,0,94,0,3,0,1,4,9,0,
+2,0,14,0,134,0,3,0,1,4,9,0,3,0,78,0,148,0,3,0,1,4,9,0,4,0,40,0,94,0,3,0,1,
+4,9,0,5,0,30,0,226,0,3,0,1,4,9,0,6,0,36,1,0,0,3,0,1,4,9,0,7,0,68,1,36,0,3,
+0,1,4,9,0,8,0,42,1,104,0,3,0,1,4,9,0,9,0,40,1,146,0,3,0,1,4,9,0,10,0,96,1,
+186,0,3,0,1,4,9,0,11,0,62,2,26,0,3,0,1,4,9,0,12,0,60,2,88,0,3,0,1,4,9,0,13,
+2,150,2,148,0,3,0,1,4,9,0,14,0,52,5,42,0,67,0,111,0,112,0,121,0,114,0,105,
+0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,97,0,117,
+0,114,0,97,0,115,0,104,0,116,0,114,0,97,0,82,0,101,0,103,0,117,0,108,0,97,
+0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,
+0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,
+97,0,110,0,115,0,32,0,83,0,97,0,117,0,114,0,97,0,115,0,104,0,116,0,114,0,
+97,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,
+0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,83,0,97,0,117,
+0,114,0,97,0,115,0,104,0,116,0,114,0,97,0,78,0,111,0,116,0,111,0,32,0,105,
+0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,
+0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,
+0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,
+0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,
+110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,
+0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,
+0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,
+0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,
+0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,
+0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,
+0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,
+105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,
+0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,
+0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,
+0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,
+0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,
+0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,
+0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,
+0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,
+105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,
+44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,
+0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,
+0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,
+103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,
+0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,
+0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,181,0,50,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,
+10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,
+1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,
+1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,
+1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,
+1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,
+1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,7,46,110,111,116,100,101,
+102,4,110,117,108,108,16,110,111,110,109,97,114,107,105,110,103,114,101,116,
+117,114,110,5,115,112,97,99,101,7,117,110,105,65,56,56,48,7,117,110,105,65,
+56,56,49,7,117,110,105,65,56,56,50,7,117,110,105,65,56,56,51,7,117,110,105,
+65,56,56,52,7,117,110,105,65,56,56,53,7,117,110,105,65,56,56,54,7,117,110,
+105,65,56,56,55,7,117,110,105,65,56,56,56,7,117,110,105,65,56,56,57,7,117,
+110,105,65,56,56,65,7,117,110,105,65,56,56,66,7,117,110,105,65,56,56,67,7,
+117,110,105,65,56,56,68,7,117,110,105,65,56,56,69,7,117,110,105,65,56,56,
+70,7,117,110,105,65,56,57,48,7,117,110,105,65,56,57,49,7,117,110,105,65,56,
+57,50,7,117,110,105,65,56,57,51,7,117,110,105,65,56,57,52,7,117,110,105,65,
+56,57,53,7,117,110,105,65,56,57,54,7,117,110,105,65,56,57,55,7,117,110,105,
+65,56,57,56,7,117,110,105,65,56,57,57,7,117,110,105,65,56,57,65,7,117,110,
+105,65,56,57,66,7,117,110,105,65,56,57,67,7,117,110,105,65,56,57,68,7,117,
+110,105,65,56,57,69,7,117,110,105,65,56,57,70,7,117,110,105,65,56,65,48,7,
+117,110,105,65,56,65,49,7,117,110,105,65,56,65,50,7,117,110,105,65,56,65,
+51,7,117,110,105,65,56,65,52,7,117,110,105,65,56,65,53,7,117,110,105,65,56,
+65,54,7,117,110,105,65,56,65,55,7,117,110,105,65,56,65,56,7,117,110,105,65,
+56,65,57,7,117,110,105,65,56,65,65,7,117,110,105,65,56,65,66,7,117,110,105,
+65,56,65,67,7,117,110,105,65,56,65,68,7,117,110,105,65,56,65,69,7,117,110,
+105,65,56,65,70,7,117,110,105,65,56,66,48,7,117,110,105,65,56,66,49,7,117,
+110,105,65,56,66,50,7,117,110,105,65,56,66,51,7,117,110,105,65,56,66,52,7,
+117,110,105,65,56,66,53,7,117,110,105,65,56,66,54,7,117,110,105,65,56,66,
+55,7,117,110,105,65,56,66,56,7,117,110,105,65,56,66,57,7,117,110,105,65,56,
+66,65,7,117,110,105,65,56,66,66,7,117,110,105,65,56,66,67,7,117,110,105,65,
+56,66,68,7,117,110,105,65,56,66,69,7,117,110,105,65,56,66,70,7,117,110,105,
+65,56,67,48,7,117,110,105,65,56,67,49,7,117,110,105,65,56,67,50,7,117,110,
+105,65,56,67,51,7,117,110,105,65,56,67,52,7,117,110,105,65,56,67,69,7,117,
+110,105,65,56,67,70,7,117,110,105,65,56,68,48,7,117,110,105,65,56,68,49,7,
+117,110,105,65,56,68,50,7,117,110,105,65,56,68,51,7,117,110,105,65,56,68,
+52,7,117,110,105,65,56,68,53,7,117,110,105,65,56,68,54,7,117,110,105,65,56,
+68,55,7,117,110,105,65,56,68,56,7,117,110,105,65,56,68,57,7,117,110,105,50,
+53,67,67,4,122,119,110,106,3,122,119,106,11,117,110,105,65,56,57,50,65,56,
+66,48,11,117,110,105,65,56,65,70,65,56,65,67,11,117,110,105,65,56,66,48,65,
+56,57,68,15,117,110,105,65,56,66,48,65,56,57,67,65,56,65,67,11,117,110,105,
+65,56,65,49,65,56,65,66,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,
+0,0,46,0,0,0,2,0,5,0,0,0,57,0,1,0,58,0,58,0,3,0,59,0,71,0,1,0,72,0,72,0,3,
+0,73,0,92,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,32,0,60,0,1,68,70,76,84,
+0,8,0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,100,105,115,116,0,14,109,97,114,107,
+0,20,0,0,0,1,0,2,0,0,0,2,0,0,0,1,0,4,0,10,1,38,2,68,2,114,0,4,0,0,0,1,0,8,
+0,1,2,90,0,12,0,1,0,28,0,40,0,2,0,2,0,22,0,55,0,0,0,88,0,92,0,34,0,1,0,0,
+0,6,0,1,253,28,0,0,0,39,0,194,0,146,0,80,0,110,0,86,0,194,0,194,0,176,0,92,
+0,164,0,98,0,104,0,104,0,194,0,110,0,116,0,152,0,194,0,122,0,128,0,134,0,
+194,0,194,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,188,0,194,0,200,
+0,206,0,212,0,218,0,224,0,230,0,1,4,20,0,0,0,1,3,68,0,0,0,1,5,24,0,0,0,1,
+3,55,0,0,0,1,3,94,0,0,0,1,4,215,0,0,0,1,3,120,0,0,0,1,3,237,0,0,0,1,3,107,
+0,0,0,1,2,246,0,0,0,1,5,11,0,0,0,1,4,176,0,0,0,1,3,42,0,0,0,1,4,7,0,0,0,1,
+3,250,0,0,0,1,3,3,0,0,0,1,4,85,0,0,0,1,4,241,0,0,0,1,3,211,0,0,0,1,3,172,
+0,0,0,1,4,228,0,0,0,1,5,202,0,0,0,1,5,241,0,0,0,1,4,237,0,0,0,1,6,141,0,0,
+0,1,5,170,0,0,0,4,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,34,0,46,0,1,0,1,0,58,0,
+2,0,2,0,22,0,56,0,0,0,88,0,92,0,35,0,1,0,0,0,6,0,1,254,112,5,150,0,40,0,190,
+0,82,0,190,0,178,0,190,0,106,0,190,0,88,0,94,0,100,0,106,0,190,0,190,0,136,
+0,112,0,136,0,118,0,124,0,130,0,160,0,136,0,214,0,190,0,142,0,148,0,190,0,
+154,0,160,0,166,0,172,0,178,0,184,0,190,0,196,0,202,0,208,0,208,0,214,0,220,
+0,226,0,1,5,98,5,150,0,1,4,250,5,150,0,1,5,124,5,150,0,1,4,211,5,150,0,1,
+3,207,5,150,0,1,4,237,5,150,0,1,3,246,5,150,0,1,3,38,5,150,0,1,4,55,5,150,
+0,1,3,155,5,150,0,1,5,72,5,150,0,1,5,150,5,150,0,1,4,159,5,150,0,1,4,133,
+5,150,0,1,3,233,5,150,0,1,4,185,5,150,0,1,4,68,5,150,0,1,5,20,5,150,0,1,4,
+16,5,150,0,1,5,33,5,150,0,1,2,73,5,150,0,1,5,215,5,150,0,1,4,94,5,150,0,1,
+7,236,5,150,0,1,5,176,5,150,0,8,0,0,0,1,0,8,0,3,0,1,0,20,0,2,0,58,0,32,0,
+0,0,1,0,0,0,3,0,1,0,4,0,41,0,46,0,48,0,49,0,1,0,1,0,72,0,2,0,0,0,1,0,8,0,
+1,0,12,0,0,0,1,0,1,0,18,0,1,0,1,0,56,0,1,0,72,254,152,0,0,0,1,0,0,0,10,0,
+30,0,44,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,
+0,8,0,0,0,1,0,0,0,1,0,4,0,4,0,0,0,1,0,8,0,1,0,88,0,4,0,14,0,28,0,42,0,56,
+0,1,0,4,0,88,0,4,0,72,0,87,0,52,0,1,0,4,0,92,0,4,0,72,0,87,0,47,0,1,0,4,0,
+89,0,4,0,72,0,87,0,48,0,2,0,6,0,16,0,90,0,4,0,72,0,87,0,33,0,91,0,7,0,72,
+0,87,0,32,0,72,0,87,0,48,0,1,0,4,0,22,0,37,0,51,0,52,};
+#endif
@@ -0,0 +1,258 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansShavian_Regular_ttf_size = 6020;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansShavian_Regular_ttf");
+asm(".type fz_font_NotoSansShavian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansShavian_Regular_ttf, 6020");
+asm(".balign 64");
+asm("fz_font_NotoSansShavian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansShavian-Regular.ttf\"");
+#else
+const int fz_font_NotoSansShavian_Regular_ttf_size = 6020;
+const char fz_font_NotoSansShavian_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,124,231,108,17,0,0,1,56,0,0,0,96,
+99,109,97,112,0,219,8,186,0,0,2,104,0,0,0,172,103,97,115,112,0,22,0,35,0,
+0,23,116,0,0,0,16,103,108,121,102,119,175,55,137,0,0,3,128,0,0,13,202,104,
+101,97,100,3,58,6,147,0,0,0,188,0,0,0,54,104,104,101,97,14,3,3,216,0,0,0,
+244,0,0,0,36,104,109,116,120,187,43,16,191,0,0,1,152,0,0,0,208,108,111,99,
+97,82,231,79,108,0,0,3,20,0,0,0,106,109,97,120,112,0,55,0,44,0,0,1,24,0,0,
+0,32,110,97,109,101,141,13,185,79,0,0,17,76,0,0,6,6,112,111,115,116,255,105,
+0,102,0,0,23,84,0,0,0,32,0,1,0,0,0,1,7,174,251,44,50,103,95,15,60,245,0,11,
+8,0,0,0,0,0,204,125,233,159,0,0,0,0,210,40,203,254,0,0,254,10,5,116,6,64,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,5,231,0,0,0,20,5,116,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,1,0,0,0,52,0,43,0,2,0,0,0,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,3,171,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,
+154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,0,0,0,0,
+0,0,0,0,2,0,71,79,79,71,0,64,0,0,255,255,8,141,253,168,0,0,8,141,2,88,0,0,
+0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,0,4,0,0,102,0,0,0,0,4,20,0,0,2,20,0,0,2,
+223,0,20,3,12,0,20,3,193,0,100,2,223,0,20,4,91,0,100,3,50,0,100,3,139,0,100,
+3,215,0,30,2,180,0,20,3,55,0,30,2,223,0,180,3,12,0,180,3,193,0,160,2,223,
+0,180,4,91,0,130,3,50,0,100,3,139,0,30,3,215,0,30,2,180,0,20,3,55,0,30,3,
+105,0,115,3,134,0,80,2,32,0,180,2,253,0,150,2,253,0,80,2,253,0,150,2,253,
+0,80,4,26,0,20,2,184,0,20,4,12,0,60,3,105,0,100,3,134,0,80,3,61,0,120,3,107,
+0,130,3,107,0,100,3,108,0,50,4,184,0,130,4,26,0,20,2,184,0,80,4,12,0,80,5,
+81,0,100,5,92,0,100,5,221,0,100,5,221,0,100,5,161,0,80,5,231,0,150,3,154,
+0,150,4,203,0,0,0,0,0,2,0,3,0,1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,0,
+12,0,8,0,2,0,4,0,0,0,13,0,32,0,160,254,255,255,255,0,0,0,0,0,13,0,32,0,160,
+254,255,255,255,0,1,255,245,255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,12,0,0,0,0,0,88,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,
+0,13,0,0,0,2,0,0,0,32,0,0,0,32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,254,
+255,0,0,254,255,0,0,0,1,0,1,4,80,0,1,4,127,0,0,0,4,0,0,0,20,0,20,0,20,0,20,
+0,42,0,64,0,105,0,127,0,174,0,226,1,8,1,57,1,72,1,124,1,147,1,170,1,211,1,
+234,2,24,2,75,2,113,2,162,2,177,2,230,3,15,3,44,3,58,3,80,3,102,3,125,3,147,
+3,169,3,212,4,4,4,45,4,73,4,96,4,124,4,150,4,174,4,225,4,247,5,34,5,82,5,
+139,5,198,6,7,6,72,6,123,6,173,6,202,6,229,0,0,0,2,0,102,0,0,3,154,5,182,
+0,3,0,7,0,0,51,17,33,17,37,33,17,33,102,3,52,253,47,2,110,253,146,5,182,250,
+74,98,4,242,0,1,0,20,0,0,2,43,6,44,0,9,0,0,19,32,0,17,17,35,17,52,38,35,20,
+1,7,1,16,184,181,170,6,44,254,197,254,204,252,67,3,189,220,233,0,1,0,20,0,
+0,2,88,6,44,0,10,0,0,33,35,17,6,6,7,53,54,54,55,51,2,88,184,50,230,116,113,
+240,63,164,5,25,59,130,33,170,32,184,111,0,1,0,100,255,236,3,33,6,44,0,24,
+0,0,1,17,35,38,35,34,14,2,21,20,22,23,21,32,0,17,52,54,54,51,51,50,23,17,
+3,33,94,60,79,32,94,87,61,252,234,254,190,254,154,119,201,108,26,24,39,6,
+44,253,33,40,30,79,138,107,178,196,7,170,1,36,1,4,148,237,136,11,2,26,0,1,
+0,20,0,0,2,43,6,44,0,9,0,0,55,50,54,53,17,51,17,16,0,33,20,170,181,184,254,
+241,254,248,170,233,220,3,189,252,67,254,204,254,197,0,0,1,0,100,255,236,
+3,217,6,64,0,26,0,0,1,6,6,21,20,22,51,50,54,53,16,2,39,55,22,0,17,16,0,35,
+34,38,53,52,54,54,55,2,152,163,215,112,107,133,154,220,217,99,248,1,27,254,
+252,219,187,219,118,222,156,3,105,59,242,134,139,149,216,182,1,43,1,207,149,
+141,147,253,211,254,183,254,243,254,194,250,206,115,232,192,60,0,0,1,0,100,
+255,236,2,206,6,64,0,34,0,0,55,22,51,50,54,53,52,38,39,38,38,53,52,54,51,
+50,22,23,7,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,39,167,58,91,111,105,
+104,112,113,103,162,135,73,102,58,40,74,106,68,56,93,123,105,111,224,194,
+83,74,172,22,147,146,105,216,133,135,200,97,126,145,17,23,156,26,59,42,74,
+162,145,124,251,130,219,244,19,0,0,1,0,100,255,236,3,109,6,64,0,21,0,0,37,
+6,35,34,38,38,53,16,18,55,23,6,2,17,20,30,2,51,50,54,55,3,109,157,193,158,
+179,90,230,192,139,179,196,38,71,98,60,80,181,63,28,48,92,195,159,1,31,2,
+135,240,88,247,253,201,254,242,100,112,54,12,30,23,0,1,0,30,255,236,3,185,
+6,64,0,29,0,0,37,6,35,34,38,38,53,16,19,6,35,39,53,23,50,55,54,55,23,6,2,
+17,20,30,2,51,50,54,55,3,185,157,193,158,179,90,126,94,103,75,68,195,120,
+86,99,139,179,196,38,71,98,60,80,181,63,28,48,92,195,159,1,48,1,83,23,3,170,
+3,100,161,123,88,247,253,201,254,242,100,112,54,12,30,23,0,0,1,0,20,255,236,
+2,160,6,64,0,3,0,0,37,7,1,55,2,160,171,254,31,171,33,53,6,31,53,0,0,2,0,30,
+255,236,3,25,6,64,0,19,0,29,0,0,55,54,55,2,17,52,18,51,50,18,21,16,3,22,23,
+7,38,39,6,7,1,52,38,35,34,6,21,16,23,54,30,166,111,185,150,139,139,151,185,
+114,163,89,166,127,125,167,1,140,55,49,49,54,103,104,121,125,158,1,60,1,111,
+253,1,4,254,245,246,254,145,254,196,161,122,141,112,160,158,114,4,81,171,
+173,172,172,254,241,227,230,0,1,0,180,254,30,2,203,4,74,0,9,0,0,1,32,0,17,
+17,51,17,20,22,51,2,203,254,249,254,240,184,181,170,254,30,1,59,1,52,3,189,
+252,67,220,233,0,0,1,0,180,254,30,2,248,4,74,0,10,0,0,19,51,17,54,54,55,21,
+6,6,7,35,180,184,47,227,122,122,235,59,164,4,74,250,231,55,132,35,170,37,
+184,106,0,0,1,0,160,254,30,3,93,4,94,0,24,0,0,19,17,51,22,51,50,62,2,53,52,
+38,39,53,32,0,17,20,6,6,35,35,34,39,17,160,94,60,79,32,94,87,61,252,234,1,
+66,1,102,112,206,110,25,25,39,254,30,2,223,40,30,79,138,107,178,196,7,170,
+254,220,254,252,143,234,144,11,253,230,0,0,1,0,180,254,30,2,203,4,74,0,9,
+0,0,1,34,6,21,17,35,17,16,0,33,2,203,170,181,184,1,16,1,7,3,160,233,220,252,
+67,3,189,1,52,1,59,0,0,1,0,130,254,10,3,247,4,94,0,26,0,0,37,54,54,53,52,
+38,35,34,6,21,16,18,23,7,38,0,17,16,18,51,50,22,21,20,6,6,7,1,195,163,215,
+112,107,133,154,219,218,99,248,254,229,253,216,201,215,118,222,156,225,59,
+242,134,140,148,216,182,254,213,254,48,148,141,147,2,45,1,73,1,18,1,57,238,
+218,118,231,190,60,0,0,1,0,100,254,10,2,206,4,94,0,33,0,0,19,54,51,50,22,
+21,20,6,7,6,6,21,20,22,51,50,55,23,6,6,35,34,38,53,52,54,55,54,54,53,16,35,
+34,7,143,74,83,194,224,111,105,123,93,56,68,106,74,40,59,106,68,135,162,104,
+112,113,103,216,91,58,4,75,19,244,219,130,252,123,145,162,74,42,59,26,156,
+24,16,145,126,96,203,133,135,215,104,1,37,22,0,1,0,30,254,10,3,39,4,94,0,
+21,0,0,19,54,51,50,22,22,21,16,2,7,39,54,18,17,52,46,2,35,34,6,7,30,157,193,
+158,179,90,230,192,139,182,193,38,71,98,60,80,181,63,4,46,48,92,195,159,254,
+225,253,121,240,88,253,2,51,1,12,100,112,54,12,30,23,0,1,0,30,254,10,3,185,
+4,94,0,29,0,0,19,54,51,50,22,22,21,16,3,54,51,23,21,39,34,7,6,7,39,54,18,
+17,52,46,2,35,34,6,7,30,157,193,158,179,90,127,95,103,75,68,196,120,79,105,
+139,182,193,38,71,98,60,80,181,63,4,46,48,92,195,159,254,210,254,171,23,3,
+170,3,100,151,133,88,253,2,51,1,12,100,112,54,12,30,23,0,0,1,0,20,254,10,
+2,160,4,94,0,3,0,0,1,23,1,39,1,245,171,254,31,171,4,94,53,249,225,53,0,2,
+0,30,254,10,3,25,4,94,0,19,0,29,0,0,19,22,23,54,55,23,6,7,18,17,20,2,35,34,
+2,53,16,19,38,39,1,16,39,6,17,20,22,51,50,54,119,167,125,127,166,89,163,114,
+185,151,139,140,149,185,111,166,1,229,104,103,54,49,49,55,4,94,114,158,160,
+112,141,122,161,254,196,254,145,246,254,245,1,5,252,1,111,1,60,158,125,252,
+60,1,12,230,227,254,241,171,173,172,0,1,0,115,255,236,3,5,4,94,0,23,0,0,1,
+39,39,34,6,21,20,22,51,55,55,21,6,35,34,36,2,53,52,18,36,51,50,23,3,5,33,
+56,175,208,209,174,56,33,60,31,171,254,255,139,139,1,2,170,31,60,3,174,3,
+3,217,183,181,217,3,3,170,6,134,1,0,176,178,1,3,135,6,0,0,1,0,80,255,236,
+3,54,4,94,0,13,0,0,1,34,6,7,2,2,35,53,50,54,55,18,18,51,3,54,104,156,22,33,
+238,189,105,153,26,36,236,186,3,180,221,180,254,237,254,220,170,223,189,1,
+6,1,38,0,0,1,0,180,0,0,1,108,4,74,0,3,0,0,1,17,35,17,1,108,184,4,74,251,182,
+4,74,0,0,1,0,150,255,236,2,173,4,74,0,9,0,0,5,32,0,17,17,51,17,20,22,51,2,
+173,254,249,254,240,184,181,170,20,1,59,1,52,1,239,254,17,220,233,0,1,0,80,
+255,236,2,103,4,74,0,9,0,0,55,50,54,53,17,51,17,16,0,33,80,170,181,184,254,
+241,254,248,150,233,220,1,239,254,17,254,204,254,197,0,0,1,0,150,0,0,2,173,
+4,94,0,9,0,0,1,34,6,21,17,35,17,16,0,33,2,173,170,181,184,1,16,1,7,3,180,
+233,220,254,17,1,239,1,52,1,59,0,0,1,0,80,0,0,2,103,4,94,0,9,0,0,19,32,0,
+17,17,35,17,52,38,35,80,1,7,1,16,184,181,170,4,94,254,197,254,204,254,17,
+1,239,220,233,0,1,0,20,0,0,4,6,4,94,0,6,0,0,1,1,35,1,55,1,1,4,6,254,90,167,
+254,91,176,1,73,1,73,4,29,251,227,4,29,65,252,180,3,76,0,1,0,20,255,236,2,
+104,4,74,0,26,0,0,1,22,22,21,21,20,22,22,51,21,34,38,38,53,53,52,38,38,35,
+35,53,54,18,55,51,6,2,1,43,82,84,28,65,58,122,145,68,29,64,58,110,146,223,
+30,184,19,163,2,68,22,126,121,38,56,43,24,170,63,114,116,38,57,46,26,170,
+46,1,21,165,167,254,237,0,1,0,60,255,236,3,188,4,94,0,30,0,0,1,38,35,34,6,
+21,20,22,51,50,55,21,6,4,33,34,39,55,22,51,50,54,55,38,38,53,52,54,51,50,
+23,3,187,120,98,117,134,130,109,33,62,15,254,186,254,255,87,75,24,72,59,130,
+209,48,136,166,243,192,121,100,3,160,20,124,108,101,125,5,50,213,252,14,168,
+12,98,87,35,206,140,181,221,19,0,1,0,100,255,236,2,246,4,94,0,24,0,0,19,54,
+51,50,4,18,21,20,6,4,35,34,39,53,23,23,50,54,54,53,52,38,35,7,7,100,60,31,
+171,1,0,140,138,254,255,172,31,60,33,56,111,175,97,208,175,56,33,4,88,6,135,
+254,253,178,176,255,135,6,170,3,3,95,181,122,183,217,3,3,0,1,0,80,255,236,
+3,54,4,94,0,13,0,0,19,50,18,19,22,22,51,21,34,2,3,38,38,35,80,186,236,36,
+25,153,106,189,237,34,22,155,105,4,94,254,218,254,250,188,224,170,1,36,1,
+19,179,222,0,1,0,120,0,0,2,197,4,74,0,9,0,0,33,17,3,39,17,51,17,19,23,17,
+2,13,243,162,184,241,164,2,109,254,255,120,2,102,254,36,1,0,120,253,10,0,
+0,1,0,130,255,236,3,7,4,74,0,13,0,0,5,34,36,2,17,53,33,21,33,21,20,18,22,
+23,2,253,197,254,230,156,2,133,254,51,106,202,143,20,207,1,171,1,33,195,164,
+31,242,254,175,167,4,0,0,1,0,100,255,236,2,233,4,74,0,12,0,0,55,54,18,17,
+53,33,53,33,21,16,2,4,35,110,220,231,254,51,2,133,155,254,230,198,153,7,1,
+122,1,109,31,164,195,254,224,254,85,208,0,1,0,50,0,0,3,58,4,74,0,10,0,0,19,
+33,21,6,2,17,35,52,18,55,33,50,3,8,202,236,184,211,175,253,228,4,74,159,127,
+253,254,254,214,248,2,6,168,0,0,2,0,130,255,236,4,54,4,94,0,15,0,30,0,0,1,
+20,2,6,35,34,38,2,53,52,18,54,51,50,22,18,7,52,38,38,35,34,6,21,20,22,22,
+51,50,54,54,4,54,119,215,142,140,214,118,114,217,145,145,214,113,186,72,129,
+78,135,162,74,130,84,83,131,74,2,34,172,254,254,136,136,1,1,173,167,1,5,144,
+145,254,251,164,118,183,99,220,180,120,182,96,97,182,0,0,1,0,20,255,236,4,
+6,4,74,0,6,0,0,5,1,1,39,1,51,1,3,86,254,183,254,183,176,1,165,167,1,166,20,
+3,76,252,180,65,4,29,251,227,0,0,1,0,80,0,0,2,164,4,94,0,26,0,0,1,38,38,53,
+53,52,38,38,35,53,50,22,22,21,21,20,22,22,51,51,21,6,2,7,35,54,18,1,141,82,
+84,28,63,60,122,145,68,29,66,56,110,146,224,29,184,16,164,2,6,22,126,121,
+38,56,43,24,170,63,114,116,38,57,47,25,170,45,254,233,164,159,1,26,0,1,0,
+80,255,236,3,208,4,94,0,30,0,0,19,54,51,50,22,21,20,6,7,22,22,51,50,55,23,
+6,35,32,36,39,53,22,51,50,54,53,52,38,35,34,7,80,100,121,193,242,165,138,
+48,209,131,59,72,24,75,87,255,0,254,185,15,62,33,109,130,133,118,98,120,4,
+75,19,222,180,138,207,36,87,98,12,168,14,252,213,50,5,125,101,107,125,20,
+0,0,1,0,100,255,236,4,222,4,94,0,36,0,0,37,54,54,53,52,38,35,34,6,21,20,22,
+51,50,55,21,6,4,35,53,50,54,55,38,38,53,52,54,54,51,32,0,17,20,6,6,7,2,214,
+166,168,188,203,168,187,130,109,33,62,16,254,218,238,126,156,43,137,160,134,
+245,157,1,21,1,49,133,239,148,147,21,206,174,199,201,147,135,101,125,5,41,
+197,227,170,67,70,38,205,136,128,208,116,254,212,254,240,166,255,142,3,0,
+0,1,0,100,255,236,4,233,4,94,0,39,0,0,19,54,51,50,22,21,20,6,7,22,22,51,50,
+54,53,52,38,39,53,22,0,21,20,2,6,35,34,38,38,53,53,22,51,50,54,53,52,35,34,
+7,100,39,77,192,223,155,139,34,186,146,181,187,179,155,237,1,27,133,252,172,
+179,255,135,63,32,112,107,231,74,40,4,91,3,196,166,137,179,22,134,134,207,
+193,177,211,10,170,11,254,206,249,171,254,252,141,137,246,162,50,5,89,97,
+192,4,0,0,1,0,100,255,236,5,106,4,94,0,42,0,0,37,54,54,53,52,38,35,34,6,21,
+20,22,23,23,7,38,39,6,6,21,20,22,23,21,34,38,38,53,52,54,55,39,52,54,54,51,
+50,0,21,20,2,6,7,3,98,159,175,176,153,152,166,40,32,23,110,71,35,66,80,95,
+88,100,171,98,145,124,2,123,231,150,235,1,24,128,239,153,147,21,216,184,177,
+203,136,126,54,92,31,24,118,52,47,8,84,72,64,79,8,171,82,148,92,132,169,25,
+54,127,199,110,254,213,253,168,254,252,149,9,0,1,0,100,255,236,5,106,4,94,
+0,41,0,0,1,22,0,21,20,0,35,34,38,38,53,55,38,38,53,52,54,54,51,21,6,6,21,
+20,22,23,54,55,23,7,6,6,21,20,22,51,50,54,53,52,38,39,3,98,237,1,27,254,231,
+234,152,230,122,2,124,145,98,170,101,88,95,80,66,38,68,110,23,33,39,165,153,
+153,176,175,159,4,94,15,254,196,255,253,254,213,111,198,127,53,24,172,131,
+93,147,82,171,8,79,64,72,84,8,49,50,118,23,32,92,54,125,137,203,177,183,218,
+20,0,0,1,0,80,255,236,5,46,4,94,0,29,0,0,37,22,51,50,54,54,53,52,38,35,34,
+6,2,3,35,54,18,18,54,54,51,50,0,17,20,2,4,35,34,39,2,130,53,49,114,181,101,
+162,135,158,237,154,30,184,22,86,136,166,212,130,236,1,2,154,254,251,164,
+76,78,167,17,118,204,117,164,195,201,254,99,254,178,251,1,89,1,10,166,90,
+254,240,254,255,167,254,224,154,22,0,0,1,0,150,255,236,5,116,4,94,0,29,0,
+0,1,17,18,33,50,18,21,20,2,4,35,34,39,55,22,51,50,54,54,53,52,38,35,34,6,
+2,2,21,35,17,1,78,187,1,125,242,252,154,254,251,164,76,78,49,53,49,115,181,
+100,161,151,129,205,145,85,184,4,74,254,143,1,133,254,236,253,167,254,224,
+154,22,165,17,113,200,116,179,190,141,254,251,254,130,164,4,74,0,0,1,0,150,
+0,0,3,114,4,94,0,14,0,0,1,14,2,2,7,21,35,17,51,17,62,2,55,3,114,106,184,146,
+103,9,184,184,45,181,211,111,3,178,20,136,212,254,227,111,182,4,74,254,98,
+113,210,110,1,0,0,1,0,0,255,236,4,163,6,64,0,9,0,0,5,3,1,35,1,55,1,1,51,1,
+4,0,228,254,224,181,254,185,172,1,9,1,19,167,1,52,20,3,76,252,200,6,27,37,
+250,249,3,17,251,217,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,
+4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,128,0,3,0,1,4,9,0,3,0,72,0,142,0,
+3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,0,30,0,214,0,3,0,1,4,9,0,6,0,30,0,
+244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,9,0,8,0,42,1,86,0,3,0,1,4,9,0,9,0,
+40,1,128,0,3,0,1,4,9,0,10,0,96,1,168,0,3,0,1,4,9,0,11,0,62,2,8,0,3,0,1,4,
+9,0,12,0,60,2,70,0,3,0,1,4,9,0,13,2,150,2,130,0,3,0,1,4,9,0,14,0,52,5,24,
+0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,
+0,49,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,
+0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,
+0,97,0,110,0,115,0,32,0,83,0,104,0,97,0,118,0,105,0,97,0,110,0,82,0,101,0,
+103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,104,0,97,0,118,0,105,0,97,
+0,110,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,51,0,
+32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,83,0,104,0,
+97,0,118,0,105,0,97,0,110,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,
+97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,
+102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,
+0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,
+0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,
+0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,
+0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,
+0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,
+112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,
+110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,15,};
+#endif
@@ -0,0 +1,7169 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansSinhala_Regular_ttf_size = 171372;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansSinhala_Regular_ttf");
+asm(".type fz_font_NotoSansSinhala_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansSinhala_Regular_ttf, 171372");
+asm(".balign 64");
+asm("fz_font_NotoSansSinhala_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansSinhala-Regular.ttf\"");
+#else
+const int fz_font_NotoSansSinhala_Regular_ttf_size = 171372;
+const char fz_font_NotoSansSinhala_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,21,143,21,115,0,2,99,12,0,0,0,248,
+71,80,79,83,182,6,155,166,0,2,100,4,0,0,27,82,71,83,85,66,132,58,126,18,0,
+2,127,88,0,0,30,18,79,83,47,50,123,27,109,134,0,0,1,104,0,0,0,96,99,109,97,
+112,241,206,239,249,0,0,11,96,0,0,1,42,103,97,115,112,0,7,0,7,0,2,99,0,0,
+0,0,12,103,108,121,102,109,175,211,7,0,0,22,40,0,2,35,109,104,101,97,100,
+6,24,208,254,0,0,0,236,0,0,0,54,104,104,101,97,14,36,12,112,0,0,1,36,0,0,
+0,36,104,109,116,120,178,245,85,63,0,0,1,200,0,0,9,152,108,111,99,97,2,163,
+11,145,0,0,12,140,0,0,9,156,109,97,120,112,2,124,1,178,0,0,1,72,0,0,0,32,
+110,97,109,101,141,4,185,61,0,2,57,152,0,0,6,6,112,111,115,116,145,168,24,
+57,0,2,63,160,0,0,35,95,0,1,0,0,0,1,7,174,61,91,121,182,95,15,60,245,0,11,
+8,0,0,0,0,0,207,60,178,181,0,0,0,0,210,40,203,255,248,79,253,213,13,69,7,
+200,0,0,0,9,0,2,0,1,0,0,0,0,0,1,0,0,8,141,253,168,0,0,13,172,248,79,254,181,
+13,69,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,102,0,1,0,0,2,102,0,211,0,10,0,221,
+0,8,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,7,55,1,144,0,5,0,0,5,153,5,51,
+0,0,0,194,5,153,5,51,0,0,2,190,0,102,2,88,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,
+0,0,0,0,0,0,0,2,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,
+8,141,2,88,0,0,0,1,0,0,0,0,4,230,4,230,0,0,0,32,0,5,4,205,0,193,0,0,0,0,4,
+0,0,0,4,0,0,0,3,194,0,69,2,139,0,62,5,170,0,74,8,75,0,74,8,35,0,74,8,46,0,
+74,6,26,0,70,5,157,0,74,5,196,0,68,9,212,0,68,10,21,0,74,13,172,0,74,8,119,
+0,74,12,162,0,74,6,132,0,62,6,132,0,62,11,146,0,71,7,4,0,83,7,4,0,83,11,62,
+0,83,8,14,0,44,7,7,0,74,7,66,0,78,6,151,0,62,7,32,0,52,8,134,0,77,6,132,0,
+62,6,103,0,74,6,82,0,74,11,121,0,44,10,98,0,74,9,92,0,77,7,101,0,74,6,85,
+0,74,6,208,0,74,6,233,0,62,6,233,0,62,9,168,0,10,8,1,0,74,7,150,0,44,6,106,
+0,74,4,157,0,74,6,208,0,74,7,181,0,58,5,120,0,74,6,82,0,74,6,127,0,74,6,239,
+0,74,7,186,0,62,6,205,0,79,7,19,0,83,6,126,0,74,5,157,0,74,6,208,0,74,6,127,
+0,74,7,86,0,78,6,82,0,74,6,151,0,62,7,161,0,74,6,24,0,68,6,192,0,78,0,0,253,
+239,2,190,0,18,2,121,0,32,2,132,0,32,0,0,251,67,0,0,251,67,0,0,250,210,0,
+0,250,220,3,151,0,58,5,24,0,71,7,125,0,71,10,51,0,71,9,21,0,71,9,21,0,71,
+10,225,0,71,4,58,0,54,7,46,0,58,4,58,0,54,10,26,0,44,6,126,0,74,11,35,0,44,
+11,34,0,44,10,91,0,78,7,140,0,74,8,14,0,78,10,139,0,44,10,160,0,44,8,14,0,
+78,7,140,0,74,10,170,0,58,8,216,0,58,11,21,0,58,10,191,0,58,0,0,252,47,5,
+10,0,15,0,0,251,23,2,190,0,18,2,121,0,32,2,132,0,32,0,0,248,242,0,0,249,128,
+0,0,249,75,0,0,249,235,0,0,249,153,0,0,249,75,0,0,249,238,0,0,250,6,0,0,250,
+27,0,0,249,201,10,98,0,74,9,92,0,77,0,0,250,27,0,0,250,24,0,0,249,173,0,0,
+249,153,0,0,249,153,0,0,248,79,0,0,249,153,0,0,249,60,0,0,250,3,4,157,0,74,
+0,0,249,173,0,0,249,30,5,120,0,74,0,0,250,27,0,0,249,238,0,0,249,153,0,0,
+248,229,0,0,249,160,0,0,249,104,0,0,249,240,6,208,0,74,0,0,249,238,0,0,249,
+55,0,0,250,27,0,0,249,235,0,0,248,249,7,140,0,74,0,0,249,197,0,0,249,237,
+0,0,250,27,0,0,249,201,0,0,249,238,0,0,249,173,0,0,250,3,0,0,249,238,0,0,
+249,173,0,0,249,238,0,0,250,3,8,216,0,58,0,0,249,201,0,0,249,238,8,14,0,44,
+7,7,0,74,7,66,0,78,6,151,0,62,7,32,0,52,8,134,0,77,6,132,0,62,6,103,0,74,
+6,82,0,74,11,121,0,44,10,98,0,74,9,92,0,77,7,101,0,74,6,85,0,74,6,208,0,74,
+6,233,0,62,6,233,0,62,9,168,0,10,8,1,0,74,7,150,0,44,6,106,0,74,4,157,0,74,
+6,208,0,74,7,181,0,58,5,120,0,74,6,82,0,74,6,127,0,74,6,239,0,74,7,186,0,
+62,6,205,0,79,7,19,0,83,6,126,0,74,5,157,0,74,6,208,0,74,6,127,0,74,7,86,
+0,78,6,82,0,74,6,151,0,62,7,161,0,74,6,24,0,68,6,192,0,78,11,35,0,44,11,34,
+0,44,10,91,0,78,7,140,0,74,8,14,0,78,10,139,0,44,10,160,0,44,8,14,0,78,7,
+140,0,74,10,170,0,58,8,216,0,58,11,21,0,58,10,191,0,58,5,10,0,15,10,98,0,
+74,9,92,0,77,4,157,0,74,5,120,0,74,6,208,0,74,8,216,0,58,7,140,0,74,8,14,
+0,44,7,7,0,74,7,66,0,78,6,151,0,62,7,32,0,52,8,134,0,77,6,132,0,62,6,103,
+0,74,6,82,0,74,11,121,0,44,10,98,0,74,10,98,0,74,9,92,0,77,9,92,0,77,7,101,
+0,74,6,85,0,74,6,208,0,74,6,233,0,62,6,233,0,62,9,168,0,10,8,1,0,74,7,150,
+0,44,6,106,0,74,4,157,0,74,4,157,0,74,6,208,0,74,7,181,0,58,5,120,0,74,5,
+120,0,74,6,82,0,74,6,127,0,74,6,239,0,74,7,186,0,62,6,205,0,79,7,19,0,83,
+6,126,0,74,5,157,0,74,6,208,0,74,6,208,0,74,6,127,0,74,7,86,0,78,6,82,0,74,
+6,151,0,62,7,161,0,74,6,24,0,68,7,140,0,74,6,192,0,78,11,35,0,44,11,34,0,
+44,10,91,0,78,7,140,0,74,8,14,0,78,10,139,0,44,10,160,0,44,8,14,0,78,7,140,
+0,74,10,170,0,58,8,216,0,58,8,216,0,58,11,21,0,58,10,191,0,58,5,10,0,15,8,
+14,0,44,7,7,0,74,7,66,0,78,6,151,0,62,7,32,0,52,8,134,0,77,6,132,0,62,6,103,
+0,74,6,82,0,74,11,121,0,44,10,98,0,74,10,98,0,74,9,92,0,77,9,92,0,77,7,101,
+0,74,6,85,0,74,6,208,0,74,6,233,0,62,6,233,0,62,9,168,0,10,8,1,0,74,7,150,
+0,44,6,106,0,74,4,157,0,74,4,157,0,74,6,208,0,74,7,181,0,58,5,120,0,74,5,
+120,0,74,6,82,0,74,6,127,0,74,6,239,0,74,7,186,0,62,6,205,0,79,7,19,0,83,
+6,126,0,74,5,157,0,74,6,208,0,74,6,208,0,74,6,127,0,74,7,86,0,78,6,82,0,74,
+6,151,0,62,7,161,0,74,6,24,0,68,7,140,0,74,6,192,0,78,11,35,0,44,11,34,0,
+44,10,91,0,78,7,140,0,74,8,14,0,78,10,139,0,44,10,160,0,44,8,14,0,78,7,140,
+0,74,10,170,0,58,8,216,0,58,8,216,0,58,11,21,0,58,10,191,0,58,5,10,0,15,8,
+14,0,44,7,7,0,74,7,66,0,78,6,151,0,62,7,32,0,52,8,134,0,77,6,132,0,62,6,103,
+0,74,6,82,0,74,11,121,0,44,10,98,0,74,9,92,0,77,7,101,0,74,6,85,0,74,6,208,
+0,74,6,233,0,62,6,233,0,62,9,168,0,10,8,1,0,74,7,150,0,44,6,106,0,74,4,157,
+0,74,6,208,0,74,7,181,0,58,5,120,0,74,6,82,0,74,6,127,0,74,6,239,0,74,7,186,
+0,62,6,205,0,79,7,19,0,83,6,126,0,74,6,208,0,74,6,127,0,74,7,86,0,78,6,82,
+0,74,6,151,0,62,7,161,0,74,6,24,0,68,6,192,0,78,11,35,0,44,11,34,0,44,10,
+91,0,78,7,140,0,74,8,14,0,78,10,139,0,44,10,160,0,44,8,14,0,78,7,140,0,74,
+10,170,0,58,8,216,0,58,11,21,0,58,10,191,0,58,5,10,0,15,8,14,0,44,7,7,0,74,
+7,66,0,78,6,151,0,62,7,32,0,52,8,134,0,77,6,132,0,62,6,103,0,74,6,82,0,74,
+11,121,0,44,10,98,0,74,9,92,0,77,7,101,0,74,6,85,0,74,6,208,0,74,6,233,0,
+62,6,233,0,62,9,168,0,10,8,1,0,74,7,150,0,44,6,106,0,74,4,157,0,72,6,208,
+0,74,7,181,0,58,5,120,0,74,6,82,0,74,6,127,0,74,6,239,0,74,7,186,0,62,6,205,
+0,79,7,19,0,83,6,126,0,74,6,198,0,74,6,127,0,74,7,86,0,78,6,82,0,74,6,151,
+0,62,7,161,0,74,7,140,0,74,6,192,0,78,11,35,0,44,11,34,0,44,10,91,0,78,7,
+140,0,74,8,14,0,78,10,139,0,44,10,160,0,44,8,14,0,78,7,140,0,74,10,170,0,
+58,8,216,0,58,11,21,0,58,10,191,0,58,5,10,0,15,8,14,0,44,7,7,0,74,7,66,0,
+78,6,151,0,62,7,32,0,52,8,134,0,77,6,132,0,62,6,103,0,74,6,82,0,74,11,121,
+0,44,10,98,0,74,9,92,0,77,7,101,0,74,6,85,0,74,6,208,0,74,6,233,0,62,6,233,
+0,62,9,168,0,10,8,1,0,74,7,150,0,44,6,106,0,74,4,157,0,72,6,208,0,74,7,181,
+0,58,5,120,0,74,6,82,0,74,6,127,0,74,6,239,0,74,7,186,0,62,6,205,0,79,7,19,
+0,83,6,126,0,74,6,198,0,74,6,127,0,74,7,86,0,78,6,82,0,74,6,151,0,62,7,161,
+0,74,6,192,0,78,11,35,0,44,11,34,0,44,10,91,0,78,7,140,0,74,8,14,0,78,10,
+139,0,44,10,160,0,44,8,14,0,78,7,140,0,74,10,170,0,58,8,216,0,58,11,21,0,
+58,10,191,0,58,5,10,0,15,10,123,0,74,9,118,0,77,4,182,0,74,5,144,0,74,8,240,
+0,58,4,182,0,74,6,71,0,74,5,251,0,74,6,21,0,74,6,112,0,74,7,215,0,74,8,100,
+0,74,2,36,255,206,2,26,255,143,8,14,0,44,7,7,0,74,7,66,0,78,6,151,0,62,7,
+32,0,52,8,134,0,77,6,132,0,62,6,103,0,74,6,82,0,74,11,121,0,44,10,98,0,74,
+9,92,0,77,7,101,0,74,6,85,0,74,6,208,0,74,6,233,0,62,6,233,0,62,9,168,0,10,
+8,1,0,74,7,150,0,44,6,106,0,74,4,157,0,74,6,208,0,74,7,181,0,58,5,120,0,74,
+6,82,0,74,6,127,0,74,6,239,0,74,7,186,0,62,6,205,0,79,7,19,0,83,6,126,0,74,
+5,157,0,74,6,208,0,74,6,127,0,74,7,86,0,78,6,82,0,74,6,151,0,62,7,161,0,74,
+6,24,0,68,6,192,0,78,2,79,0,173,3,80,0,133,5,43,0,51,6,166,0,100,1,217,0,
+133,2,132,0,112,2,132,0,61,4,104,0,98,4,147,0,102,2,37,0,104,2,147,0,82,2,
+37,0,153,3,101,0,74,4,147,0,100,4,147,0,189,4,147,0,98,4,147,0,92,4,147,0,
+43,4,147,0,129,4,147,0,113,4,147,0,90,4,147,0,100,4,147,0,102,2,76,0,173,
+2,76,0,104,4,147,0,102,4,147,0,115,4,147,0,102,3,161,0,42,2,202,0,164,3,101,
+0,74,2,202,0,91,4,147,0,78,3,141,255,252,3,30,0,51,4,104,1,233,3,30,0,91,
+4,147,0,102,2,147,0,82,4,0,0,82,8,0,0,82,1,233,0,90,1,233,0,90,3,98,0,90,
+3,98,0,90,6,84,0,153,4,147,0,131,4,147,0,102,4,147,0,102,2,76,0,219,3,212,
+0,219,0,0,0,0,0,0,254,181,0,0,255,197,4,250,0,117,0,0,0,1,0,3,0,1,0,0,0,12,
+0,4,1,30,0,0,0,64,0,64,0,5,0,0,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,160,0,
+173,0,215,0,247,9,101,13,131,13,150,13,177,13,187,13,189,13,198,13,202,13,
+212,13,214,13,223,13,244,32,13,32,20,32,25,32,29,32,38,34,18,37,204,254,255,
+255,255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,173,0,215,0,247,9,
+100,13,130,13,133,13,154,13,179,13,189,13,192,13,202,13,207,13,214,13,216,
+13,242,32,11,32,19,32,24,32,28,32,38,34,18,37,204,254,255,255,255,0,1,255,
+245,0,0,2,13,2,12,1,241,1,214,255,99,1,168,1,134,1,103,248,252,242,130,242,
+129,242,126,242,125,242,124,242,122,242,119,242,115,242,114,242,113,242,95,
+0,0,226,67,226,64,226,62,226,54,224,77,220,153,3,99,0,1,0,0,0,0,0,60,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,47,2,48,2,49,2,98,2,100,2,99,
+0,0,0,0,0,0,0,0,0,41,0,0,0,41,0,0,0,41,0,0,0,41,0,0,0,133,0,0,1,24,0,0,1,
+248,0,0,2,16,0,0,2,40,0,0,2,64,0,0,3,33,0,0,4,53,0,0,4,208,0,0,4,232,0,0,
+5,0,0,0,5,32,0,0,6,24,0,0,6,48,0,0,7,19,0,0,8,73,0,0,8,97,0,0,9,114,0,0,10,
+205,0,0,10,229,0,0,11,224,0,0,12,189,0,0,13,115,0,0,14,125,0,0,15,118,0,0,
+16,80,0,0,17,8,0,0,18,13,0,0,19,7,0,0,20,106,0,0,21,255,0,0,23,66,0,0,24,
+95,0,0,24,233,0,0,25,184,0,0,26,134,0,0,27,132,0,0,28,225,0,0,29,224,0,0,
+30,189,0,0,31,112,0,0,32,15,0,0,32,182,0,0,33,154,0,0,34,102,0,0,35,24,0,
+0,35,231,0,0,36,215,0,0,37,185,0,0,38,180,0,0,39,243,0,0,40,163,0,0,41,48,
+0,0,41,213,0,0,42,131,0,0,43,104,0,0,44,127,0,0,45,97,0,0,46,52,0,0,47,19,
+0,0,47,178,0,0,48,16,0,0,48,94,0,0,48,175,0,0,49,39,0,0,49,125,0,0,49,239,
+0,0,50,51,0,0,50,168,0,0,51,39,0,0,51,206,0,0,51,238,0,0,52,6,0,0,52,38,0,
+0,52,70,0,0,52,102,0,0,52,255,0,0,53,23,0,0,53,206,0,0,54,206,0,0,55,163,
+0,0,57,19,0,0,58,232,0,0,60,13,0,0,60,243,0,0,61,225,0,0,63,42,0,0,64,117,
+0,0,65,56,0,0,66,14,0,0,67,90,0,0,68,175,0,0,69,240,0,0,71,70,0,0,71,210,
+0,0,72,164,0,0,72,245,0,0,73,151,0,0,73,227,0,0,74,90,0,0,74,193,0,0,75,39,
+0,0,75,137,0,0,75,231,0,0,76,66,0,0,76,82,0,0,76,171,0,0,77,5,0,0,77,91,0,
+0,77,182,0,0,79,95,0,0,80,181,0,0,80,197,0,0,81,27,0,0,81,120,0,0,81,136,
+0,0,81,152,0,0,81,255,0,0,82,15,0,0,82,115,0,0,82,204,0,0,83,135,0,0,83,229,
+0,0,84,73,0,0,85,42,0,0,85,58,0,0,85,74,0,0,85,175,0,0,86,17,0,0,86,107,0,
+0,86,203,0,0,87,41,0,0,88,24,0,0,88,40,0,0,88,141,0,0,88,157,0,0,88,173,0,
+0,89,15,0,0,90,78,0,0,90,169,0,0,91,4,0,0,91,20,0,0,91,36,0,0,91,52,0,0,91,
+68,0,0,91,84,0,0,91,100,0,0,91,116,0,0,91,132,0,0,91,148,0,0,93,3,0,0,93,
+19,0,0,93,35,0,0,93,59,0,0,94,91,0,0,95,97,0,0,96,194,0,0,98,0,0,0,99,44,
+0,0,100,38,0,0,101,123,0,0,102,197,0,0,104,102,0,0,106,77,0,0,107,228,0,0,
+109,84,0,0,110,29,0,0,111,67,0,0,112,84,0,0,113,170,0,0,115,93,0,0,116,155,
+0,0,116,179,0,0,117,185,0,0,118,171,0,0,119,145,0,0,119,169,0,0,120,199,0,
+0,121,203,0,0,122,238,0,0,124,28,0,0,125,80,0,0,126,147,0,0,128,21,0,0,129,
+28,0,0,129,52,0,0,130,44,0,0,131,23,0,0,132,77,0,0,133,178,0,0,134,233,0,
+0,136,14,0,0,137,64,0,0,138,47,0,0,139,222,0,0,142,3,0,0,143,104,0,0,144,
+144,0,0,145,216,0,0,147,113,0,0,148,248,0,0,150,4,0,0,151,29,0,0,152,190,
+0,0,154,102,0,0,155,235,0,0,157,126,0,0,158,165,0,0,160,160,0,0,162,73,0,
+0,163,87,0,0,164,138,0,0,165,202,0,0,167,139,0,0,169,24,0,0,170,94,0,0,171,
+129,0,0,172,124,0,0,173,202,0,0,175,10,0,0,176,41,0,0,177,36,0,0,178,107,
+0,0,179,168,0,0,181,81,0,0,183,40,0,0,185,19,0,0,186,159,0,0,188,62,0,0,189,
+159,0,0,190,108,0,0,191,133,0,0,192,154,0,0,193,224,0,0,195,126,0,0,196,193,
+0,0,197,235,0,0,198,225,0,0,199,199,0,0,200,201,0,0,201,181,0,0,202,227,0,
+0,203,243,0,0,205,24,0,0,206,14,0,0,207,37,0,0,208,85,0,0,209,124,0,0,210,
+188,0,0,212,66,0,0,213,59,0,0,214,13,0,0,214,249,0,0,216,43,0,0,217,25,0,
+0,218,66,0,0,219,157,0,0,220,195,0,0,221,219,0,0,223,2,0,0,224,139,0,0,225,
+113,0,0,227,31,0,0,229,56,0,0,230,161,0,0,231,202,0,0,232,250,0,0,234,141,
+0,0,236,23,0,0,237,33,0,0,238,61,0,0,239,211,0,0,241,106,0,0,243,27,0,0,244,
+161,0,0,246,53,0,0,247,74,0,0,248,177,0,0,249,239,0,0,251,3,0,0,252,110,0,
+0,253,208,0,0,255,10,0,1,0,33,0,1,1,141,0,1,2,244,0,1,4,187,0,1,6,176,0,1,
+8,185,0,1,10,99,0,1,12,31,0,1,13,166,0,1,14,144,0,1,15,190,0,1,16,241,0,1,
+18,78,0,1,20,17,0,1,21,117,0,1,22,189,0,1,23,205,0,1,24,213,0,1,25,249,0,
+1,27,3,0,1,28,78,0,1,29,128,0,1,30,199,0,1,31,221,0,1,33,17,0,1,34,96,0,1,
+35,164,0,1,36,254,0,1,38,160,0,1,39,191,0,1,40,185,0,1,41,196,0,1,43,23,0,
+1,44,30,0,1,45,95,0,1,46,217,0,1,48,28,0,1,49,87,0,1,50,155,0,1,52,58,0,1,
+53,52,0,1,55,1,0,1,57,56,0,1,58,189,0,1,59,253,0,1,61,73,0,1,62,246,0,1,64,
+158,0,1,65,201,0,1,66,255,0,1,68,183,0,1,70,109,0,1,72,61,0,1,73,224,0,1,
+75,145,0,1,76,194,0,1,76,218,0,1,78,66,0,1,78,90,0,1,78,114,0,1,79,245,0,
+1,80,13,0,1,81,81,0,1,82,197,0,1,84,43,0,1,86,28,0,1,86,52,0,1,86,76,0,1,
+87,209,0,1,88,235,0,1,90,42,0,1,91,131,0,1,92,236,0,1,94,186,0,1,96,65,0,
+1,96,89,0,1,97,116,0,1,97,140,0,1,98,186,0,1,98,210,0,1,98,234,0,1,99,2,0,
+1,100,63,0,1,101,182,0,1,101,206,0,1,103,85,0,1,105,29,0,1,105,53,0,1,105,
+77,0,1,106,131,0,1,106,155,0,1,106,179,0,1,106,203,0,1,106,227,0,1,106,251,
+0,1,107,19,0,1,109,9,0,1,109,33,0,1,110,208,0,1,112,66,0,1,113,157,0,1,115,
+72,0,1,117,32,0,1,118,108,0,1,119,205,0,1,121,135,0,1,121,159,0,1,123,109,
+0,1,125,79,0,1,125,103,0,1,126,150,0,1,127,170,0,1,128,146,0,1,129,203,0,
+1,130,249,0,1,132,6,0,1,132,240,0,1,134,39,0,1,135,82,0,1,136,233,0,1,138,
+128,0,1,139,199,0,1,141,21,0,1,141,210,0,1,142,211,0,1,143,213,0,1,145,9,
+0,1,146,154,0,1,147,204,0,1,148,220,0,1,149,193,0,1,150,101,0,1,151,68,0,
+1,152,86,0,1,153,37,0,1,154,7,0,1,155,10,0,1,156,43,0,1,157,64,0,1,158,109,
+0,1,159,221,0,1,160,193,0,1,161,142,0,1,162,109,0,1,163,141,0,1,164,212,0,
+1,165,234,0,1,166,238,0,1,167,234,0,1,168,185,0,1,170,92,0,1,172,98,0,1,173,
+187,0,1,174,211,0,1,175,247,0,1,177,115,0,1,178,241,0,1,179,233,0,1,180,241,
+0,1,182,113,0,1,183,201,0,1,185,62,0,1,186,199,0,1,187,205,0,1,189,13,0,1,
+190,83,0,1,191,77,0,1,192,182,0,1,194,21,0,1,195,55,0,1,196,79,0,1,197,179,
+0,1,199,13,0,1,200,213,0,1,202,156,0,1,204,19,0,1,205,144,0,1,206,126,0,1,
+207,177,0,1,208,228,0,1,210,73,0,1,212,9,0,1,213,108,0,1,214,138,0,1,215,
+157,0,1,216,113,0,1,217,129,0,1,218,192,0,1,219,194,0,1,220,211,0,1,222,7,
+0,1,223,89,0,1,224,128,0,1,225,221,0,1,227,124,0,1,228,146,0,1,229,145,0,
+1,230,161,0,1,231,204,0,1,233,66,0,1,234,135,0,1,235,186,0,1,236,184,0,1,
+238,137,0,1,240,190,0,1,242,72,0,1,243,142,0,1,244,227,0,1,246,141,0,1,248,
+58,0,1,249,99,0,1,250,156,0,1,252,74,0,1,253,213,0,1,255,126,0,2,1,53,0,2,
+2,107,0,2,4,14,0,2,5,93,0,2,6,17,0,2,6,235,0,2,8,73,0,2,9,38,0,2,10,108,0,
+2,11,108,0,2,12,152,0,2,14,24,0,2,15,134,0,2,17,68,0,2,17,161,0,2,18,38,0,
+2,18,54,0,2,18,70,0,2,18,86,0,2,18,102,0,2,18,118,0,2,18,134,0,2,18,150,0,
+2,18,166,0,2,18,182,0,2,18,198,0,2,18,214,0,2,18,230,0,2,18,246,0,2,19,6,
+0,2,19,22,0,2,19,38,0,2,19,54,0,2,19,70,0,2,19,86,0,2,19,102,0,2,19,118,0,
+2,19,134,0,2,19,150,0,2,19,166,0,2,19,182,0,2,19,198,0,2,19,214,0,2,19,230,
+0,2,19,246,0,2,20,6,0,2,20,22,0,2,20,38,0,2,20,54,0,2,20,70,0,2,20,86,0,2,
+20,102,0,2,20,118,0,2,20,134,0,2,20,150,0,2,20,166,0,2,20,182,0,2,20,241,
+0,2,21,39,0,2,21,158,0,2,22,58,0,2,22,97,0,2,22,171,0,2,22,248,0,2,23,73,
+0,2,23,127,0,2,23,164,0,2,23,196,0,2,23,240,0,2,24,30,0,2,24,123,0,2,24,169,
+0,2,25,6,0,2,25,133,0,2,25,205,0,2,26,44,0,2,26,167,0,2,26,204,0,2,27,93,
+0,2,27,215,0,2,28,42,0,2,28,115,0,2,28,163,0,2,28,209,0,2,29,1,0,2,29,127,
+0,2,29,182,0,2,29,228,0,2,30,27,0,2,30,80,0,2,30,107,0,2,30,210,0,2,30,253,
+0,2,31,105,0,2,31,189,0,2,31,205,0,2,31,237,0,2,32,13,0,2,32,61,0,2,32,109,
+0,2,32,182,0,2,32,253,0,2,33,100,0,2,33,172,0,2,34,14,0,2,34,46,0,2,34,71,
+0,2,34,110,0,2,34,110,0,2,34,169,0,2,34,195,0,2,35,109,0,2,0,193,0,0,4,10,
+5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,
+135,5,182,250,74,104,4,230,0,3,0,69,0,134,3,125,4,230,0,14,0,26,0,27,0,0,
+1,50,22,22,21,20,6,35,34,38,38,53,52,54,54,19,50,54,53,52,38,35,34,6,21,20,
+22,19,1,230,121,187,99,227,187,122,185,103,107,191,112,123,141,141,123,120,
+140,138,153,3,187,108,188,114,181,230,106,187,118,115,191,104,253,89,151,
+127,116,143,143,120,124,150,3,210,0,5,0,62,0,0,2,77,4,230,0,11,0,23,0,35,
+0,47,0,48,0,0,1,34,38,53,52,54,51,50,22,21,20,6,3,34,6,21,20,22,51,50,54,
+53,52,38,3,34,38,53,52,54,51,50,22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,
+38,19,1,71,123,142,144,118,120,145,143,120,62,72,69,61,64,73,71,61,123,142,
+145,117,120,145,144,119,61,73,69,61,62,75,72,13,2,103,135,112,111,142,135,
+112,115,138,1,120,69,62,52,70,70,59,55,69,252,33,136,112,110,142,135,111,
+116,138,1,120,67,64,51,70,68,61,54,69,3,110,0,3,0,74,254,98,5,139,4,231,0,
+51,0,65,0,77,0,0,5,6,35,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,
+53,52,54,51,50,23,54,55,23,6,21,20,22,23,22,22,21,20,6,35,34,39,17,54,55,
+23,6,7,17,35,19,22,51,50,54,53,52,38,39,38,39,6,6,21,3,17,35,34,14,2,21,20,
+22,51,50,3,165,111,117,254,215,254,178,96,182,235,183,163,5,104,88,81,81,
+2,146,5,158,143,213,80,54,97,112,12,28,39,46,36,131,129,46,35,69,77,53,81,
+118,145,145,26,47,66,54,24,34,48,8,35,44,145,146,188,186,127,57,254,238,134,
+8,14,1,6,237,122,177,116,40,89,98,61,51,18,12,18,30,32,110,123,174,93,82,
+90,16,26,24,57,60,69,97,46,102,105,9,254,101,20,42,136,39,31,254,81,4,96,
+8,44,44,33,61,53,72,41,43,111,95,253,107,2,149,34,84,127,84,159,185,255,255,
+0,74,254,98,7,248,4,231,0,38,0,6,0,0,0,3,0,66,5,141,0,0,255,255,0,74,254,
+98,8,59,4,231,0,34,0,6,0,0,0,3,0,67,5,170,0,0,255,255,0,74,254,98,8,59,4,
+231,0,34,0,6,0,0,0,3,0,68,5,170,0,0,0,2,0,70,254,67,5,208,4,230,0,67,0,78,
+0,0,5,6,21,20,22,51,50,54,53,52,39,6,35,55,32,36,53,52,0,33,34,4,6,21,20,
+22,51,50,55,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,
+51,32,0,17,20,2,7,22,21,20,6,35,34,38,38,53,52,55,1,38,38,35,34,6,21,20,22,
+51,50,2,19,4,123,122,129,136,17,86,118,2,1,1,1,7,254,223,254,244,170,254,
+255,135,183,176,240,55,79,92,113,126,143,130,130,165,254,213,142,223,129,
+174,1,71,209,1,84,1,112,167,158,23,210,205,127,176,89,8,1,243,9,81,65,59,
+63,65,49,93,11,29,42,122,100,108,100,59,56,19,140,246,227,229,1,16,110,209,
+147,176,185,180,45,124,107,101,129,168,157,194,215,111,229,164,182,1,15,148,
+254,173,254,214,203,254,228,68,79,79,168,181,85,163,109,37,52,2,81,74,80,
+51,47,45,54,0,10,0,74,255,234,5,175,6,177,0,12,0,24,0,43,0,57,0,69,0,81,0,
+82,0,83,0,84,0,85,0,0,1,34,38,38,53,52,54,51,50,22,21,20,6,3,34,6,21,20,22,
+51,50,54,53,52,38,37,6,6,7,4,0,17,16,0,33,32,0,17,52,18,37,54,54,55,1,6,6,
+21,20,22,51,50,36,53,52,36,35,34,37,34,38,53,52,54,51,50,22,21,20,6,3,34,
+6,21,20,22,51,50,54,53,52,38,5,19,3,19,2,66,63,88,44,108,85,88,105,104,88,
+40,46,44,40,38,49,45,2,54,105,185,103,1,14,1,47,254,159,254,201,254,215,254,
+184,249,1,13,117,204,147,253,234,148,154,248,231,245,1,10,254,245,233,93,
+2,131,91,104,108,85,87,106,104,88,40,46,43,40,39,49,45,254,185,25,27,205,
+5,2,48,82,52,81,104,100,81,84,102,1,10,47,39,33,45,43,40,35,46,21,145,198,
+67,9,254,201,254,253,254,230,254,192,1,55,1,23,222,1,41,98,67,201,195,253,
+137,69,212,164,212,236,242,210,215,246,51,100,82,81,104,99,82,84,102,1,9,
+46,39,33,45,44,39,34,46,99,1,203,253,236,1,67,0,2,0,68,254,79,5,169,4,230,
+0,48,0,49,0,0,1,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,35,32,
+4,6,21,20,0,33,50,36,53,52,39,55,22,21,20,14,4,35,32,0,17,52,18,36,33,1,4,
+176,6,110,98,81,81,2,147,4,157,144,182,188,231,254,167,254,151,187,1,39,1,
+13,233,1,24,3,148,5,19,57,106,156,204,117,254,160,254,142,186,1,148,1,127,
+254,251,3,164,95,92,53,59,18,12,18,29,33,111,122,190,184,83,108,252,209,243,
+254,240,205,187,38,14,8,25,26,72,106,122,112,86,49,1,99,1,55,223,1,47,173,
+252,70,255,255,0,68,254,79,9,128,4,230,0,34,0,12,0,0,0,3,0,80,5,154,0,0,255,
+255,0,74,255,234,9,174,4,230,0,34,0,84,0,0,0,3,0,73,6,126,0,0,255,255,0,74,
+255,234,13,69,4,230,0,34,0,84,0,0,0,35,0,73,6,126,0,0,0,3,0,73,10,21,0,0,
+0,1,0,74,255,234,8,46,4,230,0,86,0,0,37,54,53,16,39,22,21,20,7,39,54,53,52,
+35,34,6,7,51,32,4,21,16,0,33,32,0,17,52,36,33,51,38,38,35,34,21,20,23,7,38,
+53,52,55,6,17,20,23,7,38,38,53,52,18,36,51,51,50,22,22,21,21,35,34,6,21,20,
+4,33,50,36,54,53,52,38,35,35,53,52,54,51,51,50,4,18,21,16,7,7,38,114,196,
+6,10,144,9,157,86,99,4,31,1,6,1,7,254,136,254,151,254,152,254,138,1,9,1,5,
+31,5,99,85,158,10,145,10,5,194,113,134,63,66,148,1,22,179,25,112,152,82,175,
+197,180,1,43,1,30,201,1,8,121,178,197,177,179,167,25,181,1,22,147,129,243,
+162,233,1,44,124,23,25,61,39,23,38,23,121,99,88,209,209,254,252,254,236,1,
+20,1,4,207,211,90,97,121,22,39,23,38,62,30,18,123,254,211,234,161,73,104,
+245,127,187,1,19,146,85,164,125,83,138,149,182,204,100,171,114,149,139,83,
+181,193,148,254,236,185,255,0,219,255,255,0,74,255,234,12,78,4,230,0,34,0,
+16,0,0,0,3,0,80,8,104,0,0,0,3,0,62,255,234,6,59,6,177,0,64,0,74,0,75,0,0,
+1,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,
+34,14,2,21,20,22,51,50,36,54,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,
+0,17,20,2,4,33,34,36,38,53,52,54,1,38,39,22,23,22,22,51,50,54,1,1,38,79,103,
+50,2,187,5,100,85,79,78,1,147,3,155,139,168,179,136,172,160,129,60,255,235,
+172,1,11,176,87,87,43,120,71,119,123,16,40,7,51,1,100,1,117,201,254,125,254,
+238,202,254,225,144,96,4,58,109,176,21,5,4,52,55,47,71,254,18,3,37,8,135,
+89,98,59,55,13,7,7,7,23,22,114,124,192,182,83,26,84,126,85,166,186,100,192,
+1,4,151,207,157,57,63,144,144,111,93,23,3,124,114,254,49,254,194,255,254,
+128,201,126,220,140,112,175,2,38,127,87,52,108,87,62,44,1,67,0,4,0,62,255,
+234,6,132,7,200,0,86,0,97,0,107,0,108,0,0,1,6,35,35,53,33,38,38,35,34,6,21,
+21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,36,54,18,
+53,52,39,6,6,35,34,38,53,52,38,39,39,55,22,23,38,53,53,52,38,39,55,22,23,
+54,51,50,22,21,20,6,35,34,39,21,22,18,21,20,2,4,33,34,36,38,53,52,54,1,22,
+51,50,53,52,38,35,34,6,7,3,38,39,22,23,22,22,51,50,54,1,1,38,79,103,50,2,
+187,5,100,85,79,78,1,147,3,155,139,168,179,136,172,160,129,60,255,235,172,
+1,11,176,87,87,43,120,71,119,123,16,40,7,51,216,163,3,46,57,53,104,29,48,
+112,85,98,113,106,46,22,107,107,201,254,125,254,238,202,254,225,144,96,4,
+161,27,31,111,40,35,49,44,1,103,109,176,21,5,4,52,55,47,71,254,18,3,37,8,
+135,89,98,59,55,13,7,7,7,23,22,114,124,192,182,83,26,84,126,85,166,186,100,
+192,1,4,151,207,157,57,63,144,144,111,93,23,3,124,68,122,60,60,28,98,77,22,
+124,30,67,97,100,89,96,107,4,204,121,254,221,170,255,254,128,201,126,220,
+140,112,175,3,201,5,86,35,42,57,58,254,50,127,87,52,108,87,62,44,1,67,255,
+255,0,71,255,234,11,73,6,177,0,34,0,74,0,0,0,3,0,18,5,14,0,0,0,3,0,83,255,
+234,6,177,6,177,0,82,0,93,0,94,0,0,1,6,35,34,38,53,52,54,51,50,22,21,20,6,
+35,34,38,38,53,52,55,54,53,52,38,35,34,6,6,21,20,22,51,50,54,55,51,22,22,
+51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,4,18,17,16,2,35,34,38,39,6,6,35,
+34,2,17,52,18,54,51,50,22,21,20,7,6,21,20,51,50,19,38,38,35,34,6,21,20,22,
+51,50,3,4,105,77,103,110,126,142,127,130,165,219,187,134,170,72,10,9,29,30,
+53,106,63,147,155,122,127,10,137,9,135,130,176,177,254,140,254,148,178,254,
+211,152,67,163,1,86,204,1,20,1,137,211,255,251,107,168,72,77,158,115,194,
+233,99,184,121,85,88,10,11,231,218,45,10,80,64,62,60,61,52,93,195,3,5,47,
+122,103,100,128,173,160,172,205,87,140,86,43,65,65,18,39,32,128,223,135,222,
+212,128,140,142,126,1,36,1,36,1,170,1,179,77,87,134,91,83,218,254,64,254,
+178,254,145,254,144,83,97,106,74,1,47,1,19,171,1,35,161,91,70,37,70,71,51,
+186,1,36,72,81,51,46,48,51,1,146,0,4,0,83,255,234,6,177,7,200,0,107,0,118,
+0,119,0,120,0,0,1,54,53,52,36,33,34,14,3,21,20,23,54,51,32,4,18,17,16,2,35,
+34,38,39,6,6,35,34,2,17,52,18,54,51,50,22,21,20,7,6,21,20,51,50,55,6,35,34,
+38,53,52,54,51,50,22,21,20,6,35,34,38,38,53,52,55,54,53,52,38,35,34,6,6,21,
+20,22,51,50,54,55,51,22,22,51,50,18,17,16,0,33,34,4,7,39,54,55,38,53,52,36,
+33,32,4,21,20,7,1,38,38,35,34,6,21,20,22,51,50,3,1,5,120,30,254,229,254,236,
+118,177,115,64,29,6,213,213,1,40,1,151,210,252,243,113,173,72,77,158,115,
+194,233,99,183,122,85,88,10,11,231,218,41,77,103,110,126,142,127,130,165,
+219,187,134,170,72,10,9,29,30,53,106,63,147,155,122,127,10,137,9,137,133,
+172,176,254,131,254,144,177,254,207,167,41,78,38,14,1,67,1,68,1,95,1,102,
+42,254,110,10,80,64,62,60,61,52,93,195,2,51,5,149,63,83,126,115,24,43,57,
+66,49,31,35,42,197,254,113,254,214,254,175,254,168,82,98,106,74,1,48,1,23,
+171,1,32,159,91,70,37,70,71,51,186,170,47,122,103,100,128,173,160,172,205,
+87,140,86,43,65,65,18,39,32,128,223,135,222,212,128,140,143,125,1,12,1,11,
+1,111,1,128,45,55,135,25,9,51,52,188,189,188,194,92,98,254,20,72,81,51,46,
+48,51,1,146,2,226,255,255,0,83,255,234,10,234,6,177,0,34,0,21,0,0,0,3,0,80,
+7,4,0,0,0,2,0,44,255,234,7,196,4,230,0,60,0,86,0,0,1,20,2,6,35,34,39,55,22,
+51,50,54,53,16,0,35,34,4,7,54,51,32,0,21,20,6,35,34,39,6,6,35,34,38,39,7,
+39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,32,0,5,
+6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,7,
+196,117,216,138,45,45,8,29,36,160,175,254,228,254,194,254,196,136,101,136,
+1,14,1,46,189,160,196,99,50,136,101,149,179,1,26,130,1,12,186,40,113,59,70,
+10,12,143,27,147,128,94,136,35,156,1,66,224,1,66,1,100,250,45,89,134,63,4,
+102,104,104,105,137,113,102,102,110,232,219,133,156,2,61,174,254,251,143,
+6,138,3,232,203,1,1,1,25,110,116,36,254,237,251,186,229,180,94,86,187,176,
+46,73,1,127,169,157,66,71,30,45,39,29,82,78,121,135,101,97,125,114,254,149,
+164,101,187,23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,0,3,0,
+74,255,234,6,180,6,177,0,60,0,70,0,71,0,0,5,34,39,6,7,39,54,18,53,52,38,35,
+34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,0,21,20,
+7,51,22,22,51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,0,17,16,2,37,22,51,50,
+54,53,52,38,35,34,1,5,4,197,51,58,70,109,135,118,194,179,136,206,113,21,136,
+165,120,143,154,143,129,201,108,151,1,20,181,250,1,13,87,40,5,60,71,124,147,
+254,132,254,138,183,254,199,146,68,198,1,69,192,1,186,1,206,226,251,95,73,
+131,77,75,67,59,121,1,28,22,170,85,85,96,147,1,7,146,168,198,119,223,148,
+109,71,153,137,105,124,135,136,243,146,189,1,32,157,254,243,226,185,175,79,
+80,1,37,1,35,1,173,1,177,81,84,135,98,76,254,0,254,23,254,148,254,142,230,
+92,57,60,48,61,3,144,0,1,0,78,255,234,6,244,4,230,0,59,0,0,1,16,0,33,34,39,
+55,22,51,50,54,53,52,2,35,34,6,7,54,51,50,22,21,20,6,6,35,32,0,17,52,18,36,
+51,50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,22,
+18,6,244,254,201,254,246,57,54,8,44,41,216,226,202,174,158,203,53,40,54,112,
+129,123,238,161,254,241,254,211,145,1,21,185,55,47,8,41,47,230,229,217,201,
+173,199,97,31,44,28,146,49,1,52,225,162,235,125,2,121,254,212,254,174,6,138,
+3,255,242,215,1,5,203,193,19,145,131,136,218,124,1,75,1,41,195,1,37,160,6,
+138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,65,1,71,148,254,228,
+0,1,0,62,255,234,6,77,4,230,0,101,0,0,1,20,7,39,54,53,52,35,34,6,7,51,32,
+0,21,20,6,35,34,39,39,54,53,52,38,35,34,6,21,20,23,7,6,35,34,38,53,16,55,
+6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,
+14,3,21,20,22,51,50,55,38,53,52,54,51,51,50,22,21,20,7,22,51,50,54,53,52,
+38,38,35,35,53,52,54,51,50,22,5,250,14,144,9,157,86,99,4,17,1,16,1,33,221,
+197,148,112,15,90,80,78,84,77,90,15,112,143,193,230,229,71,144,40,2,104,5,
+100,85,81,76,1,147,3,155,139,167,179,55,120,140,130,89,50,146,140,70,33,80,
+157,139,15,139,157,82,35,71,142,143,112,229,185,48,179,167,136,159,3,247,
+44,57,23,38,23,121,99,88,254,255,250,212,235,39,135,23,75,51,54,57,48,75,
+23,135,39,233,205,1,11,121,7,135,89,98,61,53,14,8,5,7,12,33,114,124,191,183,
+83,18,58,86,134,84,147,155,6,59,96,101,118,119,104,91,59,7,155,156,141,158,
+72,83,181,193,121,0,3,0,52,255,234,6,205,6,177,0,73,0,84,0,85,0,0,1,16,2,
+35,34,38,39,6,6,35,34,38,53,52,54,55,55,62,2,53,52,38,35,35,22,22,21,20,6,
+35,34,38,53,52,54,51,50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,53,53,51,21,
+20,22,51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,0,5,6,6,21,20,22,51,50,54,
+53,52,1,6,205,252,248,103,161,68,67,166,113,189,221,203,238,71,82,75,38,174,
+177,6,21,22,143,108,114,129,242,230,242,243,79,155,122,189,161,136,129,139,
+135,138,128,131,173,174,254,146,254,153,172,254,209,146,67,160,1,85,196,1,
+168,1,191,250,162,88,82,53,51,54,52,1,31,2,200,254,147,254,143,86,94,99,81,
+211,185,166,203,70,21,24,31,49,42,72,67,33,80,35,111,118,122,101,135,154,
+139,137,83,98,72,31,48,151,121,122,128,141,160,14,14,152,149,1,35,1,36,1,
+172,1,178,78,86,134,90,84,254,2,94,13,72,48,48,54,55,49,79,254,133,0,1,0,
+77,255,234,8,56,4,230,0,72,0,0,1,16,0,33,34,39,55,22,51,50,54,53,52,2,35,
+34,6,7,54,51,50,22,21,20,0,35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,
+7,38,53,16,0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,
+51,50,0,8,56,254,201,254,246,56,56,9,27,57,217,225,201,174,158,203,54,45,
+49,113,129,254,224,244,182,254,127,1,2,230,62,108,147,223,122,55,51,135,121,
+1,93,1,37,91,183,79,54,140,208,115,214,204,178,195,98,31,44,28,146,51,1,52,
+224,246,1,20,2,121,254,212,254,174,6,138,3,255,242,215,1,5,203,193,19,145,
+131,214,254,248,145,1,5,176,225,1,39,30,13,125,224,152,107,201,76,68,219,
+241,1,35,1,77,48,46,143,5,112,208,144,206,218,179,154,140,14,22,45,1,68,1,
+68,254,178,0,1,0,62,255,234,6,59,6,177,0,61,0,0,1,16,2,4,33,34,36,38,53,52,
+54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,
+35,34,14,2,21,20,22,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,18,6,59,
+199,254,126,254,241,207,254,222,142,99,94,70,111,50,2,229,6,100,85,79,78,
+1,146,3,155,139,167,179,177,172,160,129,60,255,235,221,1,57,168,169,254,199,
+194,168,254,228,148,67,1,51,1,105,247,1,124,202,3,88,254,247,254,110,211,
+127,219,140,116,173,51,7,135,89,98,59,55,13,7,7,7,23,22,114,124,193,181,83,
+26,84,126,85,166,186,171,1,80,225,230,1,63,164,77,88,135,174,204,254,126,
+0,5,0,74,255,234,6,69,6,177,0,63,0,76,0,85,0,86,0,87,0,0,1,23,4,7,54,51,50,
+22,22,21,20,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,21,20,
+23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,32,36,53,52,39,6,6,35,
+34,38,38,53,52,0,3,50,22,23,52,55,53,52,38,35,34,6,7,21,22,22,51,50,55,38,
+38,35,3,5,5,245,60,254,194,170,53,57,88,123,62,11,48,48,254,125,254,141,245,
+254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,199,177,1,
+48,1,24,1,38,1,57,13,45,137,91,78,128,83,1,110,169,89,150,61,1,85,82,79,101,
+12,4,69,92,125,44,46,147,101,253,3,71,6,123,129,115,191,30,81,150,103,74,
+57,52,137,86,254,251,254,237,129,239,168,208,210,90,97,121,23,38,23,48,54,
+114,124,193,181,83,142,149,178,204,206,187,65,42,71,70,68,171,138,254,1,168,
+253,162,26,26,9,8,18,107,107,105,92,135,75,104,118,30,31,3,148,198,0,5,0,
+74,255,234,6,18,6,177,0,64,0,77,0,82,0,83,0,84,0,0,1,23,6,6,7,54,51,50,22,
+21,20,6,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,
+38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,38,35,35,53,
+52,54,55,54,54,3,7,20,30,2,51,50,53,52,38,35,34,7,38,39,6,7,3,5,5,213,61,
+148,190,42,26,18,119,146,56,55,86,86,254,136,254,151,245,254,184,160,1,9,
+1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,199,177,1,48,1,24,194,1,8,
+129,178,198,177,90,90,35,246,157,1,8,23,45,32,81,71,65,34,115,26,10,28,3,
+216,3,11,6,123,129,51,140,89,4,119,101,69,90,20,52,171,118,254,252,254,236,
+129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,142,149,178,
+204,96,172,113,151,141,83,124,169,45,136,234,254,43,26,52,48,40,23,89,46,
+58,191,39,66,46,59,3,13,198,0,4,0,44,255,234,11,38,6,177,0,80,0,94,0,120,
+0,121,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,34,39,6,6,35,34,38,39,
+7,39,0,55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,36,51,32,5,7,14,
+2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,36,
+51,32,0,1,54,51,50,22,23,54,54,55,38,38,35,34,4,1,6,7,51,6,21,20,22,51,50,
+54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,37,11,38,246,242,99,156,67,
+71,153,114,108,162,46,40,139,94,193,108,50,136,101,149,179,1,26,130,1,12,
+186,40,113,59,70,22,143,27,147,128,95,134,35,146,1,53,220,1,92,1,21,53,123,
+180,93,136,127,125,130,137,124,126,168,168,254,157,254,164,174,254,228,145,
+67,158,1,76,189,1,156,1,181,247,101,99,138,170,245,64,46,181,135,116,210,
+129,186,254,211,254,222,89,134,63,4,102,104,104,105,137,113,102,102,110,232,
+219,133,156,5,49,2,200,254,148,254,142,84,96,102,78,98,93,94,97,180,94,86,
+187,176,46,73,1,127,169,157,66,71,45,69,29,82,78,121,135,102,95,119,119,249,
+151,6,104,178,116,157,169,145,156,14,14,152,149,1,35,1,36,1,172,1,178,75,
+89,134,91,83,254,4,254,190,36,122,119,122,146,25,76,67,112,254,237,101,187,
+23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,109,0,3,0,74,253,213,
+10,129,4,230,0,93,0,120,0,146,0,0,5,34,38,39,6,6,35,34,39,6,6,35,34,38,39,
+7,39,0,55,38,38,35,34,6,21,20,23,7,38,38,53,53,52,55,6,21,20,22,23,7,38,38,
+53,52,0,55,54,51,50,22,23,54,36,51,50,22,23,54,54,51,50,22,21,21,33,34,14,
+2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,35,6,1,
+54,51,50,22,23,54,36,33,51,38,38,35,34,6,21,20,23,7,38,53,52,55,38,35,34,
+4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,
+6,8,154,182,252,70,37,146,104,193,107,52,135,100,150,179,1,26,130,1,1,197,
+20,76,56,59,70,21,143,9,15,1,142,69,83,132,88,82,1,15,233,15,26,105,142,36,
+154,1,69,225,124,192,95,40,108,79,171,182,254,197,178,176,122,54,240,226,
+205,177,43,90,105,132,195,81,64,33,88,122,149,166,86,25,11,251,12,101,135,
+175,240,65,53,1,17,1,33,174,5,102,89,83,80,3,147,4,2,157,171,212,254,192,
+254,217,100,122,62,4,102,104,104,105,137,114,102,102,110,232,220,133,156,
+22,106,106,105,107,180,95,85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,
+26,104,41,9,5,5,122,245,118,199,117,78,130,252,138,240,1,68,17,4,99,98,124,
+114,35,37,38,34,193,181,83,34,85,126,84,159,185,88,137,47,25,108,139,171,
+31,131,40,162,145,123,104,1,3,137,36,117,116,114,132,88,99,63,49,11,19,18,
+29,21,33,12,60,109,254,234,113,175,23,33,137,122,146,155,14,22,135,158,133,
+134,187,201,27,0,2,0,77,253,213,9,124,4,230,0,89,0,115,0,0,5,34,36,39,6,6,
+35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,7,
+14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,33,50,23,54,51,50,22,21,21,
+33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,
+55,35,6,3,35,34,4,7,54,51,50,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,
+52,7,149,190,254,247,66,60,232,164,182,254,127,1,2,230,62,108,147,223,122,
+55,51,135,121,1,93,1,37,91,183,79,54,140,208,115,214,204,178,195,98,31,44,
+28,146,49,1,103,1,21,97,85,50,67,171,182,254,197,177,177,122,54,240,226,205,
+177,43,90,105,132,195,81,64,33,88,122,149,166,86,25,11,246,17,198,254,239,
+59,44,50,85,58,33,150,232,204,174,5,102,89,83,80,3,147,4,22,121,118,119,120,
+145,1,5,176,225,1,39,30,13,125,224,152,107,201,76,68,219,241,1,35,1,77,48,
+46,143,5,112,208,144,206,218,179,154,140,14,22,45,1,64,1,72,12,12,193,181,
+83,34,84,127,84,159,185,88,137,47,25,108,139,171,31,131,40,161,146,123,104,
+1,4,120,208,200,18,55,79,116,60,88,99,63,49,18,12,18,29,21,73,0,5,0,74,255,
+234,7,36,6,177,0,75,0,88,0,93,0,94,0,95,0,0,1,23,6,6,7,54,51,50,22,21,20,
+6,7,22,22,21,16,0,33,32,0,17,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,
+55,6,17,20,23,7,38,38,53,52,18,36,51,51,50,22,22,21,21,35,34,6,21,20,4,33,
+32,36,53,52,38,35,35,53,52,54,55,54,54,3,7,20,30,2,51,50,53,52,38,35,34,7,
+38,39,6,7,3,5,6,232,60,147,190,43,26,18,120,146,56,55,86,86,254,136,254,151,
+254,152,254,138,1,9,1,5,31,5,99,85,158,10,145,10,5,194,113,134,63,66,148,
+1,22,179,25,112,152,82,175,199,178,1,48,1,25,1,26,1,48,178,197,177,89,90,
+36,247,158,1,7,24,45,32,81,72,64,34,116,27,8,29,3,190,2,237,6,123,129,51,
+140,89,4,119,101,69,90,20,52,171,118,254,252,254,236,1,20,1,4,207,211,90,
+97,121,22,39,23,38,62,30,18,123,254,211,234,161,73,104,245,127,187,1,19,146,
+85,164,125,83,141,150,178,204,202,179,151,141,83,124,168,45,138,234,254,42,
+26,52,48,40,23,89,45,59,191,46,58,44,60,3,13,198,0,2,0,74,255,234,6,13,6,
+177,0,38,0,39,0,0,1,16,2,4,33,34,36,38,53,52,0,33,50,23,7,38,35,34,6,21,20,
+22,51,50,36,18,53,52,2,36,35,32,5,39,36,33,50,4,18,37,6,13,197,254,139,254,
+252,214,254,222,141,1,60,1,16,121,97,13,92,111,210,230,250,244,216,1,49,156,
+162,254,209,188,254,203,254,239,67,1,59,1,87,235,1,110,197,251,240,3,88,254,
+243,254,111,208,127,228,154,247,1,5,14,141,14,188,179,176,187,178,1,82,216,
+228,1,63,166,165,135,174,204,254,128,129,0,4,0,74,255,234,6,130,6,177,0,55,
+0,65,0,66,0,67,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,
+38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,16,39,6,6,35,
+34,38,53,52,38,39,39,55,4,0,1,38,39,22,23,22,22,51,50,54,5,19,6,130,251,236,
+112,167,69,74,158,116,188,221,143,1,14,183,111,115,14,87,117,217,237,141,
+132,132,133,138,136,137,116,149,73,168,41,135,79,119,123,18,37,5,53,1,164,
+1,151,254,102,116,180,22,5,4,52,55,51,75,253,145,153,2,128,254,184,254,178,
+83,97,103,77,255,230,153,245,134,14,139,13,213,192,157,169,147,154,14,14,
+157,144,115,229,175,1,99,226,72,81,144,144,113,90,23,2,126,138,253,230,1,
+28,112,84,49,113,87,62,53,5,1,63,0,1,0,62,255,234,6,150,6,177,0,71,0,0,1,
+16,2,35,34,38,39,6,6,35,34,38,53,16,55,6,35,35,53,33,38,38,35,34,6,21,21,
+20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,
+21,20,22,51,50,18,17,16,0,33,34,4,7,39,36,33,32,4,18,6,150,254,247,103,159,
+67,76,161,112,190,229,229,71,144,40,2,136,5,100,85,79,78,1,147,3,155,140,
+165,181,55,157,166,153,86,146,129,136,138,137,128,131,173,175,254,144,254,
+145,168,254,217,163,67,1,61,1,126,1,32,1,139,201,2,200,254,147,254,143,85,
+95,104,76,236,204,1,9,121,7,135,89,98,59,55,14,8,5,7,23,22,114,124,190,183,
+84,25,86,157,111,139,155,146,155,14,14,153,148,1,37,1,34,1,175,1,175,74,91,
+135,174,229,254,66,0,3,0,62,255,234,6,155,6,177,0,77,0,87,0,88,0,0,1,16,2,
+35,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,
+23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,
+20,22,51,50,54,54,53,52,2,39,6,6,35,34,38,53,52,38,39,39,55,4,0,1,38,39,22,
+23,22,22,51,50,54,1,6,155,251,236,113,168,67,76,161,112,189,230,117,114,66,
+151,40,2,136,5,100,85,79,78,1,147,3,155,140,165,181,60,151,166,154,86,146,
+129,136,138,137,135,139,117,150,71,84,84,40,134,80,117,126,18,37,5,53,1,159,
+1,156,254,103,119,177,22,5,4,52,55,54,74,254,44,2,128,254,184,254,178,84,
+96,104,76,237,203,130,198,59,8,135,89,98,59,55,14,8,5,7,23,22,114,124,190,
+183,84,24,87,157,111,139,155,146,155,14,14,156,145,119,231,169,178,1,34,112,
+71,81,141,147,115,88,23,2,126,136,253,233,1,22,115,81,49,112,87,62,56,1,55,
+0,6,0,10,255,234,9,85,6,177,0,64,0,73,0,101,0,113,0,114,0,115,0,0,1,16,2,
+35,34,38,39,55,22,22,51,50,54,54,53,52,38,35,34,6,21,21,35,53,52,38,35,34,
+7,22,21,20,2,4,35,34,36,39,7,39,1,38,53,52,54,36,51,50,23,54,1,23,1,22,23,
+54,51,50,22,23,54,54,51,50,18,5,54,1,38,35,34,6,21,20,3,22,22,51,50,54,54,
+53,52,38,39,0,1,22,23,38,53,52,54,51,50,22,21,20,6,35,32,39,5,51,50,54,53,
+52,38,35,34,6,21,20,1,1,9,85,191,190,122,185,56,141,41,103,76,89,99,40,103,
+103,90,93,136,70,70,65,42,51,168,254,195,207,200,254,211,141,58,111,1,26,
+58,144,1,5,169,100,88,221,1,47,99,254,46,147,91,72,96,67,105,39,39,137,97,
+172,174,248,56,176,1,32,24,25,189,243,102,119,251,162,166,250,137,168,161,
+254,212,254,253,68,111,28,132,114,117,135,183,151,255,0,155,1,165,7,73,99,
+55,54,50,55,3,87,249,199,2,34,254,228,254,228,138,136,57,102,88,98,190,157,
+220,213,132,158,13,12,132,105,48,124,157,198,254,225,151,130,146,64,99,1,
+28,106,129,126,206,114,14,204,1,13,113,254,105,57,116,63,60,60,87,88,254,
+215,166,171,1,13,2,174,136,84,254,147,122,112,114,222,152,176,245,52,254,
+242,254,255,62,25,60,64,98,120,127,109,117,139,142,9,59,61,50,57,53,50,73,
+4,44,251,37,0,1,0,74,255,234,7,174,6,177,0,89,0,0,1,16,2,35,34,38,39,6,6,
+35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,55,
+6,6,21,20,23,7,38,2,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,14,2,21,
+20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,36,33,50,4,
+22,18,7,174,254,247,103,159,67,76,161,112,190,229,113,110,70,139,19,2,146,
+5,100,85,79,78,1,147,3,13,152,162,113,134,60,69,150,1,32,190,53,25,20,20,
+167,179,91,151,166,154,86,146,129,139,135,137,128,131,173,175,254,144,254,
+145,168,254,217,163,67,1,61,1,126,208,1,69,231,120,2,200,254,147,254,143,
+85,95,104,76,236,204,129,196,61,7,135,89,98,59,55,14,8,5,7,23,22,51,35,42,
+239,183,235,161,72,95,1,1,123,185,1,20,148,2,2,192,181,84,24,87,157,111,139,
+155,149,152,14,14,153,148,1,37,1,34,1,175,1,175,74,91,135,174,121,247,254,
+132,0,2,0,44,255,234,7,76,4,230,0,57,0,74,0,0,1,20,2,6,35,34,39,55,22,51,
+50,54,54,53,52,0,35,34,4,7,54,51,50,22,21,20,4,33,34,36,53,53,7,39,0,55,38,
+35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,4,18,5,6,7,23,6,21,
+20,22,51,50,54,53,52,38,35,34,6,7,76,127,231,147,63,33,8,44,27,120,164,84,
+254,233,244,141,254,234,124,83,113,229,254,254,224,254,231,240,254,242,74,
+130,1,5,190,39,111,59,70,10,12,143,27,147,128,184,77,149,1,36,156,208,1,46,
+157,250,152,88,71,70,12,194,186,208,206,191,178,90,150,2,75,183,254,244,141,
+6,138,3,107,208,147,243,1,12,111,107,28,234,217,239,251,215,203,25,126,73,
+1,121,184,148,66,71,30,45,39,29,82,78,121,135,187,119,109,162,254,208,69,
+102,98,5,44,56,143,147,177,164,154,160,27,0,4,0,74,255,234,6,32,6,177,0,41,
+0,50,0,51,0,52,0,0,1,16,2,4,33,32,0,53,52,0,33,50,23,7,38,35,34,6,21,20,22,
+51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,22,0,18,1,38,39,22,23,
+22,22,51,50,37,19,6,32,198,254,137,254,251,254,192,254,172,1,72,1,27,126,
+100,12,98,116,220,241,255,247,221,1,53,158,86,44,122,69,119,123,16,40,7,51,
+243,1,73,157,254,195,106,179,21,5,4,52,55,94,253,172,153,3,71,254,250,254,
+118,205,1,11,242,246,1,6,14,141,14,188,179,178,185,175,1,75,208,200,154,59,
+62,144,144,111,93,23,3,124,77,254,245,254,174,1,15,124,89,52,108,87,62,48,
+1,63,0,1,0,74,253,213,4,189,4,230,0,56,0,0,5,32,0,53,52,62,2,51,51,38,38,
+35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,
+23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,6,2,193,254,215,254,178,96,
+182,235,183,204,5,102,89,81,81,2,147,4,158,143,170,182,254,179,188,186,127,
+57,254,238,216,186,43,86,106,135,195,82,63,34,90,120,151,165,87,36,22,1,6,
+237,122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,192,182,83,34,84,127,
+84,159,185,88,137,44,25,110,140,171,31,131,40,162,145,125,103,2,0,2,0,74,
+255,234,6,125,6,177,0,52,0,53,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,
+36,51,50,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,
+16,0,33,34,4,7,39,54,36,51,32,4,18,37,6,125,252,248,103,161,68,75,157,114,
+188,221,143,1,14,183,111,115,14,87,117,217,237,141,132,132,133,138,128,131,
+173,174,254,146,254,153,172,254,209,146,67,160,1,85,196,1,16,1,133,210,251,
+128,2,200,254,147,254,143,86,94,105,75,255,230,153,245,134,14,139,13,213,
+192,157,169,147,154,14,14,152,149,1,35,1,36,1,172,1,178,78,86,134,90,84,215,
+254,64,204,0,2,0,58,255,234,7,107,4,230,0,62,0,76,0,0,19,22,23,23,50,62,2,
+55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,4,18,21,
+20,2,6,35,34,39,55,22,51,50,54,53,52,0,35,34,6,7,54,51,50,22,21,20,0,33,32,
+0,3,37,6,6,7,22,22,51,50,54,53,52,38,35,34,204,5,9,20,72,94,93,77,29,17,83,
+70,62,67,10,12,143,27,147,128,96,130,35,99,1,12,158,207,1,54,165,135,228,
+141,64,33,8,44,27,178,190,254,225,246,133,215,83,49,46,228,254,254,211,254,
+225,254,211,254,149,48,2,164,57,223,191,65,247,200,208,225,194,175,69,2,127,
+32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,100,100,118,
+123,159,254,210,201,192,254,240,133,6,138,3,238,215,242,1,22,99,98,7,234,
+217,227,254,249,1,66,1,59,160,173,167,5,156,150,184,166,149,156,0,1,0,74,
+253,213,5,151,4,230,0,73,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,
+23,7,38,53,52,55,34,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,
+21,33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,
+52,55,35,6,3,175,254,228,254,192,77,154,214,214,195,5,104,88,82,80,2,146,
+5,26,233,254,105,137,56,62,150,1,32,190,110,63,43,68,169,183,254,197,179,
+177,119,54,240,226,205,177,42,85,108,133,194,82,64,33,90,120,150,165,86,25,
+12,22,1,6,237,109,172,118,56,89,98,62,50,18,12,18,30,20,71,44,255,231,221,
+180,67,102,247,126,185,1,20,148,11,11,190,184,83,34,85,126,84,159,185,88,
+137,45,26,109,139,171,31,131,40,162,145,123,104,1,0,1,0,74,255,234,6,8,4,
+230,0,62,0,0,1,20,7,39,54,53,52,35,34,6,7,51,32,17,16,0,33,34,36,38,53,52,
+36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,
+4,33,50,36,54,53,52,38,35,35,53,52,54,51,50,22,5,203,13,145,9,157,86,99,4,
+31,2,13,254,136,254,151,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,
+140,167,179,176,200,176,1,43,1,29,201,1,8,122,178,198,177,179,168,138,156,
+3,247,48,53,23,38,23,121,99,88,254,94,254,252,254,236,129,239,168,208,210,
+90,97,121,23,38,23,48,54,114,124,193,181,83,140,147,183,203,99,172,114,149,
+139,83,181,193,124,0,3,0,74,255,234,6,54,6,177,0,55,0,65,0,66,0,0,1,20,2,
+4,33,32,0,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,
+35,34,6,6,21,20,4,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,0,
+37,38,39,22,23,22,22,51,50,54,1,6,54,200,254,127,254,243,254,203,254,159,
+1,39,1,7,123,5,99,85,157,5,145,9,155,139,168,179,225,171,187,94,1,16,240,
+222,1,57,165,87,43,120,71,116,126,16,40,7,51,1,100,1,117,254,195,109,176,
+21,5,4,52,55,47,71,254,53,3,50,253,254,128,203,1,31,248,191,228,90,97,121,
+19,24,24,50,35,114,124,192,182,83,64,125,97,180,207,166,1,67,214,207,157,
+57,63,141,147,111,93,23,3,124,114,254,49,165,127,87,52,108,87,62,44,1,67,
+0,3,0,74,255,234,6,161,6,177,0,69,0,79,0,80,0,0,1,20,2,6,35,34,38,38,53,52,
+54,55,54,54,53,52,38,35,34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,
+52,18,36,51,50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,18,53,52,2,36,35,34,4,
+7,39,36,33,32,4,18,1,22,51,50,54,53,52,38,35,34,1,6,161,132,245,160,97,127,
+54,27,38,34,24,172,154,136,206,113,21,136,165,120,143,154,143,129,201,108,
+148,1,25,185,219,250,17,26,32,31,22,71,65,101,172,104,174,254,182,227,183,
+254,196,147,68,1,78,1,129,1,18,1,140,211,250,144,73,131,80,72,68,58,123,1,
+30,3,13,241,254,145,195,77,117,67,53,98,90,80,102,52,134,148,119,223,148,
+109,71,153,137,105,124,135,136,243,146,186,1,33,159,222,180,52,95,76,76,74,
+76,37,64,66,152,1,45,205,245,1,105,186,82,83,135,174,220,254,89,252,162,92,
+59,57,49,61,3,144,0,1,0,62,255,234,7,108,4,230,0,79,0,0,1,16,0,33,34,39,55,
+22,51,50,54,53,52,2,35,34,6,7,54,51,50,22,21,20,6,4,35,32,0,53,52,54,55,6,
+35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,
+14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,0,7,108,254,201,254,
+246,56,56,9,27,57,217,225,200,175,156,204,55,40,54,113,128,137,254,242,193,
+254,241,254,191,84,82,72,99,32,2,81,5,99,85,81,76,1,147,3,155,139,166,181,
+106,152,147,98,50,235,209,216,234,98,32,43,28,146,51,1,52,224,246,1,20,2,
+121,254,212,254,174,6,138,3,255,242,217,1,3,199,196,18,145,133,137,219,120,
+1,15,224,105,169,56,6,135,90,97,61,53,14,8,5,7,12,33,114,124,190,184,83,35,
+77,110,81,171,199,180,164,129,13,23,45,1,68,1,68,254,178,0,3,0,79,255,234,
+6,132,6,177,0,71,0,82,0,83,0,0,1,16,2,4,33,34,36,2,53,52,18,51,50,22,22,21,
+20,7,6,21,20,51,50,55,6,35,34,38,53,52,54,51,50,30,2,21,20,6,35,34,38,53,
+52,55,54,53,52,35,34,6,6,21,16,0,33,32,0,17,52,2,36,35,34,4,7,39,36,33,32,
+4,18,5,38,38,35,34,6,21,20,22,51,50,3,6,132,196,254,131,254,240,227,254,179,
+180,204,164,65,81,29,10,11,231,218,41,77,103,110,126,142,127,57,103,86,49,
+219,187,183,193,10,9,59,54,86,50,1,55,1,30,1,82,1,96,171,254,187,211,176,
+254,223,171,65,1,70,1,119,1,2,1,137,210,253,195,11,81,62,62,60,61,53,92,157,
+3,66,254,244,254,124,200,163,1,61,215,235,1,15,53,72,35,37,70,71,52,186,170,
+47,121,104,100,128,36,80,130,87,172,205,166,147,43,64,63,21,71,85,163,109,
+254,242,254,219,1,114,1,88,236,1,71,168,73,97,135,179,205,254,117,218,74,
+79,51,46,47,52,1,146,0,3,0,83,255,234,6,191,6,177,0,101,0,112,0,113,0,0,1,
+20,2,4,35,34,39,39,54,53,52,38,35,34,6,21,20,23,7,6,35,34,0,17,52,18,54,51,
+50,22,21,20,7,6,21,20,51,50,55,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,
+38,38,53,52,55,54,53,52,35,34,6,6,21,20,18,51,51,22,51,50,55,38,53,52,54,
+51,51,50,22,21,20,7,51,50,18,17,16,0,33,34,4,7,39,36,33,32,4,18,5,38,38,35,
+34,6,21,20,22,51,50,3,6,191,135,255,0,177,140,73,14,89,80,78,79,81,89,14,
+77,87,244,254,225,98,178,108,86,91,10,11,231,218,41,77,103,110,126,142,127,
+131,164,219,187,134,169,73,10,9,60,50,97,58,199,175,10,1,2,3,4,69,150,142,
+27,138,151,69,58,201,218,254,142,254,177,189,254,209,178,65,1,77,1,141,1,
+12,1,136,203,253,158,11,81,62,58,64,61,53,92,179,2,237,234,254,159,183,23,
+135,23,75,52,53,54,51,75,23,135,24,1,82,1,41,173,1,0,137,91,69,37,70,71,52,
+186,170,47,121,104,100,128,174,159,172,205,86,140,87,43,64,63,21,71,105,195,
+124,236,254,244,1,1,57,89,97,104,104,97,88,58,1,81,1,46,1,146,1,156,73,99,
+135,181,222,254,81,165,74,79,48,49,47,52,1,146,0,1,0,74,255,234,6,52,4,230,
+0,64,0,0,1,20,7,39,54,53,52,35,34,6,7,51,32,4,21,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,
+22,51,50,54,53,52,38,38,35,35,53,52,54,51,50,22,5,218,14,144,9,157,86,99,
+4,23,1,29,1,21,223,186,112,167,69,75,158,115,188,221,140,1,5,174,61,37,11,
+28,51,203,230,141,132,132,133,138,136,138,129,135,105,223,198,55,179,167,
+136,159,3,247,44,57,23,38,23,121,99,88,245,242,220,247,83,97,104,76,255,230,
+152,246,134,6,139,5,217,188,157,169,147,154,14,14,158,143,162,160,145,145,
+61,84,181,192,121,0,6,0,74,255,234,5,121,6,177,0,16,0,30,0,31,0,32,0,33,0,
+34,0,0,1,4,5,4,0,21,16,0,33,32,0,17,52,18,37,36,37,1,6,6,21,20,22,51,50,36,
+53,52,36,35,34,37,19,7,3,5,107,254,244,254,205,1,5,1,34,254,160,254,202,254,
+214,254,183,246,1,42,1,121,1,38,253,5,148,154,248,231,245,1,10,254,245,233,
+93,2,243,25,2,25,5,253,226,149,16,254,204,254,254,230,254,192,1,53,1,24,223,
+1,37,117,209,239,253,137,69,212,164,212,236,242,210,215,246,217,1,203,209,
+254,189,0,1,0,74,254,94,6,140,4,230,0,50,0,0,1,20,6,35,34,38,53,52,55,33,
+53,33,21,33,6,21,20,51,50,54,53,52,36,33,32,0,17,16,0,33,32,0,53,52,39,55,
+22,21,20,2,4,35,32,0,17,16,18,36,33,32,4,6,121,230,207,176,179,11,254,202,
+2,252,254,213,16,203,139,146,254,255,254,255,254,146,254,117,1,102,1,68,1,
+29,1,76,5,147,7,190,254,160,221,254,102,254,83,220,1,158,1,20,1,77,1,84,3,
+8,173,203,142,139,35,36,137,137,30,38,143,122,111,173,167,254,128,254,166,
+254,200,254,170,1,17,250,33,46,8,38,50,206,254,209,161,1,165,1,129,1,7,1,
+138,209,249,0,1,0,74,255,234,6,54,6,177,0,56,0,0,1,16,2,4,33,34,36,38,53,
+52,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,6,
+6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,22,18,6,54,199,254,
+126,254,241,205,254,213,156,132,250,214,127,5,100,85,157,6,145,9,155,139,
+166,180,254,246,175,185,92,1,15,239,221,1,57,168,168,254,198,194,164,254,
+222,146,67,1,56,1,100,167,1,36,236,134,3,88,254,247,254,110,211,131,241,163,
+125,190,104,89,98,121,19,24,24,50,35,114,124,191,183,83,65,125,96,181,206,
+171,1,80,225,229,1,63,165,79,86,135,174,97,207,254,178,0,2,0,78,255,234,7,
+8,4,230,0,64,0,77,0,0,1,20,0,7,39,54,53,52,39,38,53,52,54,51,50,23,53,52,
+38,35,34,6,7,54,51,50,22,21,20,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,
+2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,22,18,1,54,55,38,35,34,
+6,21,20,23,22,21,20,7,8,254,226,255,51,46,16,17,139,112,98,76,211,170,170,
+201,57,47,47,112,129,123,238,161,254,241,254,211,145,1,21,185,55,47,8,41,
+47,230,229,217,201,173,199,97,31,44,28,146,52,1,50,249,159,232,126,254,89,
+208,45,65,80,58,61,8,8,2,141,249,254,163,75,126,14,59,41,84,85,45,122,130,
+48,19,208,244,202,194,19,145,131,136,218,124,1,75,1,41,195,1,37,160,6,138,
+3,254,253,254,254,222,250,182,153,138,14,22,45,1,64,1,72,143,254,237,253,
+109,114,207,53,68,64,27,57,56,46,27,0,3,0,74,255,234,6,8,4,230,0,74,0,86,
+0,100,0,0,1,20,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,21,
+20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,39,6,
+7,22,21,20,6,35,34,38,38,53,52,54,54,51,51,50,54,55,38,35,35,53,52,54,51,
+50,22,5,50,22,23,54,53,52,38,35,34,6,7,19,6,35,35,34,6,21,20,22,51,50,54,
+53,52,5,200,44,54,54,254,136,254,151,245,254,184,160,1,9,1,4,31,5,99,85,157,
+9,144,14,155,140,167,179,176,200,176,1,43,1,29,201,1,8,122,53,79,108,27,190,
+192,132,171,79,75,148,132,94,140,167,57,79,133,177,176,162,149,151,254,51,
+90,149,60,16,83,74,86,99,4,34,69,102,102,114,78,123,125,119,119,3,212,95,
+79,52,146,94,254,252,254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,
+114,124,193,181,83,140,147,183,203,99,172,114,116,66,72,35,49,60,115,109,
+55,98,68,78,82,39,50,46,30,83,181,193,143,179,25,25,37,44,76,80,99,88,254,
+134,10,38,42,48,38,41,60,44,0,1,0,62,255,234,6,77,4,230,0,86,0,0,1,20,7,39,
+54,53,52,35,34,6,7,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,
+55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,
+34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,38,35,35,53,
+52,54,51,50,22,5,250,14,144,9,157,86,99,4,17,181,253,127,223,186,113,168,
+67,76,161,112,189,230,117,113,56,160,40,2,104,5,100,85,81,76,1,147,3,155,
+139,167,179,39,147,162,152,84,145,130,136,138,137,135,140,129,135,114,229,
+183,48,179,167,136,159,3,247,44,57,23,38,23,121,99,88,110,218,159,220,247,
+84,96,104,76,237,203,130,197,59,7,135,89,98,61,53,14,8,5,7,12,33,114,124,
+191,183,83,26,87,156,110,140,154,146,155,14,14,156,145,163,159,144,147,60,
+83,181,193,121,0,1,0,74,255,234,7,83,4,230,0,73,0,0,1,16,0,33,34,39,55,22,
+51,50,54,54,53,52,2,35,34,6,7,54,51,50,22,21,20,6,4,35,34,36,38,53,52,36,
+33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,22,
+51,50,54,53,52,35,34,6,7,39,18,0,51,50,0,7,83,254,201,254,246,57,54,8,44,
+40,150,198,94,199,176,157,203,54,44,49,114,128,141,254,243,190,179,254,244,
+146,1,9,1,1,34,5,99,85,157,9,144,14,155,140,167,179,176,197,179,239,205,212,
+237,98,32,43,28,145,49,1,52,225,247,1,19,2,121,254,212,254,174,6,138,3,121,
+222,154,215,1,5,201,193,17,146,132,136,221,119,126,242,169,205,212,90,97,
+121,23,38,23,48,54,114,124,193,181,83,139,152,177,205,182,162,129,13,23,45,
+1,65,1,71,254,178,0,3,0,68,254,79,5,253,4,230,0,53,0,69,0,70,0,0,1,21,33,
+32,4,7,22,22,51,50,54,55,23,2,33,34,36,39,6,17,20,0,33,32,36,53,52,39,55,
+22,21,20,0,33,34,36,2,53,52,18,55,55,38,53,52,54,51,50,23,54,54,51,50,22,
+5,54,36,51,51,38,38,35,34,7,35,38,38,35,34,6,1,5,182,254,239,254,242,254,
+184,108,28,211,179,200,197,14,147,43,254,11,232,254,234,47,136,1,56,1,24,
+1,19,1,38,3,148,5,254,126,254,179,237,254,176,173,126,125,17,2,183,154,136,
+79,41,124,73,158,180,252,36,108,1,56,204,220,5,104,89,144,21,137,3,76,65,
+96,103,1,169,3,112,83,49,55,173,173,140,145,8,254,90,203,204,123,254,254,
+241,254,238,206,186,24,29,8,31,41,249,254,234,162,1,49,199,170,1,0,94,12,
+38,39,187,225,106,49,57,197,220,47,48,91,96,136,64,72,145,252,28,0,1,0,78,
+255,234,6,114,4,230,0,52,0,0,1,16,0,33,35,34,39,55,22,51,50,54,17,52,38,35,
+34,6,6,21,21,35,53,52,38,38,35,34,6,21,16,22,51,50,55,23,6,35,32,0,17,16,
+18,51,50,22,23,54,54,51,50,22,18,6,114,254,244,254,255,28,38,33,9,18,53,203,
+192,164,147,88,115,54,137,62,113,82,147,164,192,203,13,57,8,59,39,254,254,
+254,245,246,211,107,162,60,59,164,114,130,204,115,2,117,254,194,254,179,5,
+139,3,241,1,14,227,254,78,137,116,70,71,122,137,71,251,230,254,242,241,5,
+139,7,1,76,1,64,1,40,1,72,94,102,103,93,141,254,229,0,2,253,239,4,50,0,0,
+7,200,0,18,0,29,0,0,1,22,23,54,51,50,22,21,20,6,35,34,39,17,35,17,52,38,39,
+23,22,51,50,53,52,38,35,34,6,7,254,36,104,29,50,110,85,98,113,106,45,23,139,
+46,57,242,29,29,111,40,35,47,44,3,7,200,30,67,97,100,89,96,107,4,253,238,
+2,85,98,77,22,148,5,86,35,42,52,63,0,2,0,18,255,234,2,107,4,230,0,21,0,22,
+0,0,55,22,51,50,54,53,52,38,35,34,7,39,54,51,50,18,17,16,2,35,34,39,19,49,
+50,67,157,141,141,157,66,54,28,86,82,207,226,226,206,81,87,200,137,18,218,
+220,219,220,19,134,26,254,221,254,224,254,224,254,220,25,4,227,0,1,0,32,254,
+175,2,145,3,55,0,24,0,0,19,33,23,14,2,21,20,22,51,50,54,55,23,6,35,34,38,
+53,52,18,55,6,35,33,32,2,9,50,172,157,54,98,107,51,75,59,47,122,125,169,174,
+184,181,49,70,254,231,3,55,136,183,226,167,91,110,107,16,26,131,51,181,180,
+158,1,72,178,3,0,2,0,32,254,175,2,145,3,55,0,35,0,36,0,0,1,6,7,7,39,54,55,
+6,35,33,53,33,23,6,7,54,55,55,23,6,6,21,20,22,51,50,54,55,23,6,35,34,38,53,
+52,54,37,1,132,41,145,69,50,140,164,30,30,254,217,2,4,46,92,246,75,122,95,
+45,196,177,111,94,51,75,59,47,122,125,161,182,160,1,120,1,130,5,7,3,122,97,
+97,2,138,128,71,144,7,5,4,125,105,170,111,87,95,16,26,131,51,171,151,115,
+201,53,0,3,251,67,4,230,255,189,7,200,0,21,0,22,0,23,0,0,3,54,53,52,38,35,
+34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,1,3,234,20,212,213,213,214,20,
+139,28,1,36,1,26,1,26,1,34,28,253,218,140,5,19,52,68,115,116,117,116,65,53,
+24,72,75,176,196,195,174,81,69,2,205,253,30,0,4,251,67,4,187,255,198,7,200,
+0,23,0,32,0,33,0,34,0,0,1,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,
+6,35,34,38,53,52,55,6,21,20,22,51,50,53,52,1,3,254,37,72,92,213,214,20,139,
+28,1,36,1,26,1,26,1,43,125,125,127,129,225,89,64,56,107,254,68,140,6,103,
+11,117,116,65,53,24,72,75,176,196,190,161,111,121,117,113,103,63,66,98,53,
+59,105,119,1,181,253,30,0,2,250,210,253,233,255,202,0,147,0,17,0,18,0,0,5,
+6,21,20,22,22,51,33,17,51,17,33,34,38,53,52,54,55,37,251,182,79,59,117,135,
+2,152,148,252,152,219,181,57,69,3,39,159,57,65,42,55,17,2,30,253,86,131,117,
+62,109,61,33,0,2,250,220,253,233,255,212,0,147,0,36,0,37,0,0,5,6,6,21,20,
+22,51,50,54,55,54,54,51,50,22,23,38,53,17,51,17,35,38,38,35,34,6,7,6,6,35,
+34,38,53,52,54,55,37,251,192,41,38,66,63,48,97,107,109,103,56,82,152,94,2,
+148,106,116,147,90,45,95,95,133,117,53,120,155,54,72,3,29,159,31,58,37,53,
+57,31,50,51,33,62,63,44,44,1,158,253,86,87,76,28,43,62,30,128,118,66,105,
+63,33,0,3,0,58,255,234,3,48,4,230,0,26,0,39,0,40,0,0,1,38,38,35,34,7,39,54,
+51,50,30,2,21,17,35,39,6,6,35,34,38,53,52,62,2,19,23,17,35,34,6,6,21,20,51,
+50,54,55,3,2,151,8,148,136,132,121,43,155,139,113,167,118,49,131,83,55,110,
+74,139,166,66,138,209,163,31,69,166,158,64,178,56,69,40,118,2,179,166,139,
+44,134,51,60,129,188,166,253,174,49,39,32,179,156,95,140,100,43,253,252,19,
+1,143,59,104,78,195,24,32,4,55,0,3,0,71,255,234,4,213,4,230,0,43,0,55,0,56,
+0,0,1,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,4,33,34,36,2,53,52,18,36,
+51,50,22,23,7,38,38,35,34,4,21,20,22,51,50,54,53,52,38,39,35,34,6,21,20,22,
+51,50,54,53,52,3,3,155,20,123,118,119,135,176,146,218,249,254,236,254,249,
+202,254,230,143,164,1,44,194,155,236,110,53,111,201,141,232,254,240,239,228,
+200,203,84,231,18,79,84,53,51,54,52,71,2,128,50,59,110,113,130,111,111,132,
+211,170,206,227,142,1,7,170,172,1,12,145,43,45,139,47,39,232,216,195,230,
+141,137,90,119,49,60,55,48,54,56,48,63,2,132,255,255,0,71,255,234,7,125,7,
+200,0,34,0,74,0,0,0,35,0,65,7,125,0,0,0,7,2,58,4,209,1,209,255,255,0,71,255,
+234,9,240,4,230,0,34,0,74,0,0,0,3,0,74,5,27,0,0,255,255,0,71,255,234,8,194,
+4,230,0,34,0,74,0,0,0,35,0,66,6,87,0,0,0,7,2,58,4,209,1,209,255,255,0,71,
+255,234,9,21,7,200,0,34,0,74,0,0,0,35,0,101,6,87,0,0,0,7,2,58,4,209,1,209,
+255,255,0,71,255,234,10,141,4,230,0,34,0,74,0,0,0,35,0,80,6,167,0,0,0,7,2,
+58,4,209,1,209,0,2,0,54,255,234,3,230,4,230,0,51,0,52,0,0,37,22,22,51,50,
+54,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,38,53,52,55,23,6,21,20,22,51,
+50,54,53,52,38,35,34,7,39,54,54,51,50,22,22,21,16,2,35,34,39,19,1,118,39,
+75,58,117,124,56,122,108,67,42,80,90,154,140,103,146,77,73,137,65,92,88,71,
+84,38,30,19,21,92,56,144,95,113,168,88,219,212,134,89,234,147,14,14,104,201,
+148,209,223,41,4,98,83,113,137,78,152,100,144,135,41,123,116,96,101,65,58,
+38,44,8,88,101,91,130,253,182,254,216,254,214,34,4,218,255,255,0,58,255,234,
+6,199,4,230,0,34,0,73,0,0,0,3,0,73,3,151,0,0,0,3,0,54,255,234,3,230,4,230,
+0,52,0,62,0,63,0,0,1,54,54,51,50,22,22,21,16,2,35,34,38,53,52,54,51,50,22,
+23,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,38,53,52,55,23,6,21,20,22,51,
+50,54,53,52,38,35,34,7,1,38,35,34,6,21,20,22,51,50,3,1,78,56,144,95,113,168,
+88,235,241,157,176,137,126,86,164,96,45,122,108,67,42,80,90,155,141,103,146,
+75,73,137,65,92,88,71,84,38,30,18,22,1,38,142,125,58,60,97,88,131,73,3,177,
+101,91,130,253,182,254,215,254,215,129,115,104,124,78,93,109,184,209,223,
+41,4,98,83,112,138,79,152,99,144,135,41,123,116,96,101,65,58,38,44,8,253,
+82,144,49,43,53,55,4,115,0,1,0,44,255,246,9,230,3,158,0,81,0,0,37,38,39,39,
+6,6,35,34,38,39,55,22,22,51,50,54,54,55,23,22,23,54,19,23,22,23,54,18,55,
+23,22,19,54,55,23,6,7,54,55,23,6,7,54,55,23,22,22,51,50,53,52,39,55,22,21,
+20,6,35,34,38,39,6,7,39,54,55,6,7,39,19,6,7,39,3,2,7,39,39,38,39,6,3,2,135,
+1,24,11,66,159,99,94,120,29,140,9,54,40,47,83,98,56,91,23,19,48,143,95,9,
+46,48,141,45,98,2,20,159,100,93,34,14,139,88,83,40,30,67,80,82,3,61,66,89,
+6,139,10,122,97,109,141,14,109,54,96,33,16,127,62,92,33,121,99,77,28,132,
+61,97,34,15,17,70,108,137,13,107,53,156,154,99,106,41,49,57,58,175,173,10,
+130,63,129,1,81,22,100,213,110,1,14,72,23,96,254,230,237,106,26,250,167,144,
+81,30,148,192,78,70,30,153,121,92,28,24,23,44,46,99,112,144,123,107,66,32,
+220,72,125,72,35,1,125,166,170,21,1,103,254,237,176,28,156,70,67,146,254,
+233,0,1,0,74,255,234,6,52,4,230,0,80,0,0,1,38,38,35,34,21,20,23,7,38,53,52,
+54,51,50,22,21,21,35,34,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,
+53,52,38,38,35,35,53,52,54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,51,50,22,
+22,21,20,6,35,34,38,39,6,6,35,34,38,38,53,52,36,33,2,141,5,100,85,157,9,144,
+14,155,139,168,179,48,182,229,115,135,129,139,135,138,136,138,129,135,115,
+229,182,48,179,168,138,156,14,144,9,157,86,99,4,18,180,253,127,223,186,112,
+167,69,76,163,109,120,185,104,1,32,1,16,3,164,90,97,121,23,38,23,48,54,114,
+124,192,182,83,59,147,145,160,162,141,160,14,14,158,143,162,160,145,147,59,
+83,181,193,124,115,53,48,23,38,23,121,99,88,110,218,159,220,247,83,97,103,
+77,108,212,147,242,245,0,3,0,44,255,234,10,218,6,177,0,76,0,102,0,128,0,0,
+1,16,2,4,33,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,6,21,
+20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,21,21,35,34,
+6,6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,54,36,51,50,4,18,5,54,51,
+50,22,23,54,36,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,
+51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,10,218,
+195,254,139,254,251,196,254,241,75,35,149,106,193,108,50,136,101,149,179,
+1,26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,94,135,35,153,1,68,227,
+172,144,74,111,167,179,248,177,186,89,1,5,230,217,1,47,155,163,254,210,186,
+158,254,238,146,68,142,1,77,173,240,1,113,194,247,177,101,136,173,238,65,
+57,1,2,188,145,5,99,85,157,5,144,10,10,102,101,213,254,192,254,218,89,134,
+63,4,102,104,104,105,137,113,102,102,110,232,219,133,156,3,88,254,243,254,
+110,207,111,111,110,112,180,94,86,187,176,46,73,1,112,184,157,66,71,30,45,
+39,29,82,78,121,135,102,96,123,116,40,40,193,181,83,69,126,91,180,207,179,
+1,81,216,228,1,65,164,76,89,135,85,89,205,254,126,239,36,113,112,117,121,
+90,97,121,19,24,24,42,43,45,31,22,109,254,234,101,187,23,33,139,120,146,155,
+14,22,135,158,133,134,188,200,27,0,5,0,44,255,234,10,216,4,230,0,93,0,119,
+0,131,0,157,0,171,0,0,1,20,7,22,22,21,16,0,33,34,36,39,6,6,35,34,39,6,6,35,
+34,38,39,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,
+51,50,23,54,51,50,22,21,21,35,34,6,21,20,4,33,32,36,53,52,39,6,7,22,21,20,
+6,35,34,38,53,52,54,54,51,51,50,54,55,38,35,35,53,52,54,51,50,22,5,54,51,
+50,22,23,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,4,5,50,22,
+23,54,53,52,38,35,34,6,7,5,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,
+50,54,53,52,38,35,34,6,5,6,35,35,34,6,21,20,22,51,50,54,53,52,10,151,44,54,
+55,254,135,254,151,229,254,198,86,36,149,107,193,108,50,136,101,149,179,1,
+26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,94,135,35,153,1,68,227,119,
+100,57,74,167,179,176,200,176,1,43,1,29,1,30,1,45,53,77,110,28,191,192,189,
+193,80,147,128,95,140,167,56,78,133,177,176,162,146,153,247,244,101,136,170,
+235,64,47,236,190,32,5,100,85,157,10,145,13,17,30,30,213,254,192,5,180,90,
+149,59,17,82,75,85,100,5,249,70,89,134,63,4,102,104,104,105,137,113,102,102,
+110,232,219,133,156,6,145,69,102,102,112,79,122,125,120,118,3,212,93,81,53,
+146,93,254,251,254,237,114,114,114,114,180,94,86,187,176,46,73,1,112,184,
+157,66,71,30,45,39,29,82,78,121,135,102,96,123,116,18,18,193,181,83,140,147,
+183,203,202,183,116,66,70,36,52,58,115,109,113,108,80,82,37,49,47,30,83,181,
+193,141,230,36,112,112,118,119,89,98,121,30,31,23,53,49,54,42,2,109,73,25,
+25,42,39,73,83,98,89,205,101,187,23,33,139,120,146,155,14,22,135,158,133,
+134,188,200,27,198,10,37,43,48,38,41,60,44,0,3,0,78,255,234,10,8,6,177,0,
+82,0,95,0,96,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,32,0,17,52,18,
+36,51,50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,
+22,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,
+34,4,7,39,54,36,51,32,4,18,1,54,51,50,23,54,36,55,38,38,35,34,6,5,10,8,246,
+242,99,154,68,71,155,113,119,172,44,57,221,157,254,241,254,211,145,1,21,185,
+55,47,8,41,47,230,229,217,201,173,199,97,31,44,28,146,47,1,55,241,133,248,
+143,100,36,36,218,237,136,127,125,130,137,124,126,168,168,254,157,254,164,
+174,254,228,145,67,158,1,76,189,1,9,1,124,204,249,59,44,52,93,52,58,1,16,
+198,83,156,91,173,215,3,137,2,200,254,148,254,142,83,97,102,78,113,106,108,
+111,1,75,1,41,195,1,37,160,6,138,3,254,253,254,254,222,250,182,153,138,14,
+22,45,1,66,1,70,113,139,150,3,213,192,157,169,145,156,14,14,152,149,1,35,
+1,36,1,172,1,178,75,89,134,91,83,216,254,64,254,175,20,57,154,159,2,66,58,
+203,53,0,1,0,74,255,234,7,68,6,177,0,78,0,0,1,16,2,4,33,34,36,38,53,52,54,
+55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,
+38,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,14,3,21,20,22,51,50,36,18,
+53,52,2,36,35,34,4,7,39,36,33,50,4,18,7,68,199,254,126,254,241,209,254,222,
+141,96,98,72,110,29,2,208,5,100,85,81,76,1,146,3,18,178,188,113,134,63,66,
+151,1,33,188,33,44,46,40,166,181,177,131,156,111,77,46,255,235,221,1,57,168,
+169,254,199,194,168,254,228,148,68,1,53,1,104,245,1,124,204,3,88,254,247,
+254,110,211,127,219,140,112,175,54,8,135,89,98,61,53,13,7,7,7,23,22,56,43,
+32,250,195,234,161,73,104,245,127,186,1,20,146,7,7,190,184,83,16,48,72,106,
+79,166,186,171,1,80,225,230,1,63,164,77,88,135,174,202,254,126,0,4,0,78,255,
+234,7,192,6,177,0,65,0,75,0,76,0,77,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,
+52,54,55,38,35,34,0,21,20,23,7,38,53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,
+53,53,51,21,20,22,51,50,54,54,53,16,39,6,6,35,34,38,53,52,38,39,39,55,4,0,
+1,38,39,22,23,22,22,51,50,54,5,19,7,192,251,236,112,167,69,74,158,116,188,
+221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,168,144,41,187,211,141,132,
+134,132,137,136,137,116,149,73,168,41,135,79,119,123,18,37,5,53,1,164,1,151,
+254,102,116,180,22,5,4,52,55,51,75,253,57,253,2,128,254,184,254,178,83,97,
+103,77,255,230,182,244,44,3,254,253,232,186,155,49,191,207,1,26,1,67,64,138,
+4,218,184,156,170,149,152,14,14,157,144,115,229,175,1,99,226,72,81,144,144,
+113,90,23,2,126,138,253,230,1,28,112,84,49,113,87,62,53,5,1,63,0,5,0,44,255,
+234,10,65,6,177,0,67,0,77,0,89,0,106,0,107,0,0,1,16,2,4,33,34,36,39,6,6,35,
+34,36,53,53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,
+36,51,50,4,23,7,6,6,21,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,
+39,55,4,0,37,38,39,22,23,22,22,51,50,54,1,54,54,55,38,35,32,7,54,51,50,22,
+5,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,1,10,65,188,254,149,254,255,
+213,254,230,70,58,247,189,240,254,242,74,130,1,5,190,39,111,59,70,10,12,143,
+27,147,128,92,130,39,149,1,36,156,169,1,48,112,56,202,201,246,237,211,1,40,
+154,86,42,122,71,119,123,19,35,9,51,1,98,1,119,254,196,109,178,22,5,4,52,
+55,48,71,251,238,44,178,135,178,225,254,223,255,88,109,141,196,253,71,88,
+71,70,12,194,186,208,206,191,178,90,150,4,242,3,71,254,250,254,119,206,121,
+122,122,121,215,203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,135,
+94,93,119,109,136,124,143,17,182,165,177,186,172,1,75,211,201,154,57,65,144,
+144,124,82,21,3,124,113,254,53,162,126,87,49,112,87,62,45,253,241,100,124,
+23,143,223,28,98,102,102,98,5,44,56,143,147,177,164,154,160,27,3,53,0,3,0,
+44,255,234,10,87,6,177,0,71,0,96,0,113,0,0,1,16,2,4,33,34,36,39,6,6,35,34,
+36,53,53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,
+50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,
+7,39,54,36,51,50,4,18,5,38,53,52,55,38,35,32,5,54,51,50,22,23,54,54,51,51,
+38,38,35,34,21,20,23,5,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,10,87,
+195,254,139,254,251,209,254,232,70,57,250,194,240,254,242,74,130,1,5,190,
+39,111,59,70,10,12,143,27,147,128,184,77,149,1,36,156,160,130,76,114,166,
+180,248,177,186,89,1,5,230,217,1,47,155,163,254,210,186,158,254,238,146,68,
+142,1,77,173,239,1,113,195,251,29,10,9,95,109,254,223,255,0,88,110,146,201,
+54,60,246,185,145,5,99,85,157,5,251,224,88,71,70,12,194,186,208,206,191,178,
+90,150,3,88,254,243,254,110,207,124,125,125,124,215,203,25,126,73,1,121,184,
+148,66,71,30,45,39,29,82,78,121,135,187,119,109,43,43,191,183,83,69,126,91,
+180,207,179,1,81,216,228,1,65,164,76,89,135,85,89,205,254,127,192,42,43,40,
+33,25,223,28,99,98,105,105,90,97,121,19,24,236,102,98,5,44,56,143,147,177,
+164,154,160,27,0,2,0,78,255,234,7,187,6,177,0,61,0,62,0,0,1,16,2,35,34,38,
+39,6,6,35,34,38,53,52,54,55,38,35,34,0,21,20,23,7,38,53,16,0,33,50,23,7,6,
+6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,36,
+51,32,0,37,7,187,252,248,103,161,68,75,157,114,188,221,185,173,24,26,216,
+255,0,80,143,87,1,67,1,12,168,144,41,187,211,141,132,134,132,137,130,129,
+173,174,254,146,254,153,172,254,209,146,67,160,1,86,196,1,168,1,190,251,132,
+2,200,254,147,254,143,86,94,105,75,255,230,182,244,44,3,254,253,232,186,155,
+49,191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,14,14,156,145,1,35,
+1,36,1,172,1,178,78,86,134,90,84,254,1,52,0,1,0,74,255,234,7,68,6,177,0,70,
+0,0,1,16,2,4,33,32,0,53,52,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,
+6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,33,34,6,6,21,
+20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,18,7,68,198,254,126,254,
+239,254,204,254,160,132,250,214,127,5,100,85,157,6,145,9,21,177,191,113,134,
+63,66,151,1,33,188,39,41,39,44,166,181,254,245,175,185,92,1,15,239,222,1,
+59,166,169,254,198,194,162,254,223,149,67,1,58,1,98,245,1,125,204,3,88,254,
+247,254,111,212,1,30,249,125,190,104,89,98,121,19,24,24,50,35,54,45,32,249,
+196,234,161,73,104,245,127,186,1,20,146,8,8,191,183,83,65,125,96,181,206,
+174,1,81,221,229,1,64,164,78,87,135,174,202,254,126,0,5,0,58,255,234,10,96,
+6,177,0,69,0,79,0,90,0,104,0,105,0,0,1,16,2,4,33,34,36,39,6,4,35,32,0,3,55,
+22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,
+51,32,1,7,4,17,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,
+4,0,37,38,39,22,23,22,22,51,50,54,1,54,51,50,22,23,54,37,38,35,32,3,6,6,7,
+22,22,51,50,54,53,52,38,35,34,1,10,96,188,254,149,254,255,214,254,228,69,
+59,255,0,196,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,
+10,12,143,27,147,128,192,69,99,1,11,156,1,81,1,10,56,254,109,246,237,211,
+1,40,154,86,42,122,71,119,123,19,35,9,51,1,98,1,119,254,196,109,178,22,5,
+4,52,55,48,71,250,7,49,46,142,197,56,89,1,10,177,233,254,246,216,55,223,193,
+65,247,200,208,225,194,175,67,4,68,3,71,254,250,254,119,206,123,123,123,123,
+1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,
+200,118,123,254,252,143,33,254,181,177,186,172,1,75,211,201,154,57,65,144,
+144,124,82,21,3,124,113,254,53,162,126,87,49,112,87,62,45,254,173,7,95,94,
+194,47,143,254,173,171,169,5,156,150,184,166,149,156,3,26,0,3,0,58,253,213,
+8,247,4,230,0,79,0,107,0,121,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,
+62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,
+55,54,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,
+55,23,6,35,34,38,53,52,55,35,6,1,54,51,50,22,23,62,2,51,51,38,38,35,34,6,
+21,20,23,7,38,53,53,38,38,35,34,6,7,6,6,7,22,22,51,50,54,53,52,38,35,34,7,
+16,195,254,245,64,59,255,0,197,254,211,254,149,48,146,5,9,20,72,94,93,77,
+29,17,83,70,62,67,10,12,143,27,147,128,96,130,35,99,1,11,156,215,174,10,37,
+112,88,171,182,254,197,178,176,122,54,240,226,205,177,42,89,105,132,194,82,
+64,33,88,122,150,165,86,25,11,251,241,49,46,149,202,54,42,153,221,185,175,
+5,102,89,83,80,3,147,4,78,165,103,127,211,132,55,223,193,65,247,200,208,225,
+194,175,67,22,126,122,124,124,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,
+67,30,45,39,29,82,78,121,135,100,100,118,123,93,11,41,41,193,181,83,34,85,
+126,84,159,185,88,137,47,25,108,139,171,31,131,40,162,145,123,104,1,3,166,
+7,104,104,73,99,49,88,99,62,50,18,12,18,29,21,20,44,41,101,238,171,169,5,
+156,150,184,166,149,156,0,3,0,58,255,234,10,194,6,177,0,81,0,93,0,107,0,0,
+1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,32,0,3,55,22,23,23,50,62,2,55,38,
+38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,4,23,7,6,6,21,20,
+22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,0,
+1,54,51,50,22,23,54,54,55,38,35,32,3,6,6,7,22,22,51,50,54,53,52,38,35,34,
+10,194,246,242,99,156,67,72,154,112,121,171,44,63,250,187,254,211,254,149,
+48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,192,69,99,
+1,11,156,168,1,46,133,61,189,209,136,127,124,131,137,124,126,168,168,254,
+157,254,164,174,254,228,145,67,158,1,76,189,1,156,1,181,248,75,49,46,146,
+201,55,48,174,126,177,233,254,246,216,55,223,193,65,247,200,208,225,194,175,
+67,2,200,254,148,254,142,84,96,104,76,116,108,112,112,1,66,1,59,24,32,36,
+1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,200,118,123,130,130,
+140,11,218,175,157,169,143,158,14,14,152,149,1,35,1,36,1,172,1,178,75,89,
+134,91,83,254,4,254,219,7,101,101,104,127,23,143,254,173,171,169,5,156,150,
+184,166,149,156,0,3,0,58,255,234,10,118,6,177,0,77,0,102,0,116,0,0,1,16,2,
+4,33,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,
+23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,
+20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,54,36,51,50,4,18,5,54,51,50,22,23,
+54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,3,6,6,7,22,22,51,
+50,54,53,52,38,35,34,10,118,195,254,139,254,251,213,254,231,69,58,254,254,
+200,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,
+27,147,128,96,130,35,99,1,11,156,158,138,75,127,166,180,247,176,185,92,1,
+5,230,217,1,47,155,163,254,210,186,158,254,238,146,68,143,1,76,173,240,1,
+113,194,248,151,49,46,145,200,55,60,251,180,146,5,100,85,157,5,144,9,8,97,
+125,253,217,55,223,193,65,247,200,208,225,194,175,67,3,88,254,243,254,110,
+207,128,129,129,128,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,
+39,29,82,78,121,135,100,100,118,123,51,51,191,183,83,66,124,96,180,207,179,
+1,81,216,228,1,65,164,76,89,135,85,89,205,254,126,210,7,100,99,104,108,89,
+98,121,19,24,24,50,35,41,26,31,254,173,171,169,5,156,150,184,166,149,156,
+0,3,252,47,4,112,255,248,7,200,0,35,0,47,0,48,0,0,3,54,54,53,52,38,35,34,
+6,6,21,20,22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,
+20,7,37,51,50,54,53,52,38,35,34,6,21,20,19,203,31,25,186,176,115,152,69,79,
+76,21,114,95,100,121,156,138,187,215,251,220,244,254,68,254,28,5,73,69,43,
+42,45,42,84,4,194,53,95,57,114,144,61,98,60,82,94,19,46,51,92,99,108,94,101,
+116,181,145,158,192,210,181,120,120,73,53,42,40,45,46,41,51,2,184,0,1,0,15,
+255,234,4,183,4,230,0,74,0,0,1,20,7,39,54,53,52,38,35,34,6,7,22,18,21,20,
+6,35,34,38,39,38,39,6,7,39,62,2,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,21,20,6,6,7,6,7,22,23,30,2,51,50,54,53,52,38,39,53,52,54,51,
+50,22,4,172,13,145,10,61,63,65,81,8,208,229,239,214,112,203,138,47,44,26,
+16,146,2,42,73,80,79,70,39,66,60,57,60,8,144,13,146,118,127,151,45,85,97,
+31,26,37,117,82,86,100,57,148,157,221,212,166,147,127,132,3,247,48,53,23,
+31,30,63,58,93,94,30,254,255,202,225,240,66,88,30,15,62,126,30,65,139,142,
+130,129,134,134,61,82,84,63,54,32,33,23,42,60,111,127,156,137,79,169,158,
+151,49,48,12,64,46,38,23,159,155,171,188,4,31,224,198,123,0,2,251,23,253,
+213,255,134,0,225,0,21,0,22,0,0,5,22,22,51,50,54,54,53,52,39,55,22,21,20,
+4,33,32,36,53,53,52,55,1,251,173,5,193,200,145,194,98,14,122,42,254,214,254,
+219,254,243,254,237,1,2,25,99,134,119,62,138,130,53,51,143,151,109,244,218,
+196,188,11,4,6,254,49,0,3,0,18,255,234,2,190,7,200,0,41,0,52,0,53,0,0,55,
+22,51,50,54,53,52,38,35,34,7,39,54,51,50,23,17,52,38,39,55,22,23,54,51,50,
+22,21,20,6,35,34,39,17,22,18,21,16,2,35,34,39,1,22,51,50,53,52,38,35,34,6,
+7,1,49,50,67,157,141,141,157,66,54,28,86,82,51,39,46,57,53,104,29,48,112,
+85,98,113,106,46,22,102,102,226,206,81,87,1,140,27,31,111,40,35,49,44,1,254,
+255,137,18,218,220,219,220,19,134,26,8,2,30,98,77,22,124,30,67,97,101,88,
+96,107,4,253,239,67,254,253,191,254,224,254,220,25,6,181,5,86,35,42,57,58,
+254,3,0,1,0,32,253,213,2,145,1,169,0,22,0,0,19,33,23,6,6,21,20,22,51,50,55,
+23,6,35,34,38,53,52,18,55,6,35,33,32,2,9,50,187,196,95,110,94,91,47,122,125,
+173,170,173,174,44,57,254,231,1,169,136,141,241,134,94,94,42,131,51,163,157,
+136,1,6,126,2,0,2,0,32,253,213,2,145,1,169,0,35,0,36,0,0,5,6,7,7,39,54,55,
+6,35,33,53,33,23,6,7,54,55,55,23,6,6,21,20,22,51,50,54,55,23,6,35,34,38,53,
+52,54,37,1,94,25,123,70,49,140,164,30,30,254,217,2,4,46,110,229,76,122,95,
+45,185,188,94,89,74,89,44,47,122,125,157,186,142,1,158,5,4,10,5,119,97,97,
+2,138,128,84,131,7,5,4,125,44,117,92,65,70,21,19,129,51,136,123,98,148,6,
+0,2,248,242,253,213,255,60,0,160,0,30,0,31,0,0,5,20,30,2,51,50,36,54,54,53,
+52,39,55,22,21,20,14,2,4,35,34,36,46,2,53,53,52,55,1,249,136,66,140,251,191,
+193,1,3,148,65,14,127,34,49,100,192,254,214,175,190,254,229,180,97,46,1,3,
+118,84,87,101,65,35,47,89,124,90,38,47,97,85,103,105,143,110,89,42,41,74,
+93,115,77,22,9,9,254,34,0,2,249,128,253,213,255,118,1,25,0,30,0,31,0,0,5,
+21,20,30,2,51,50,62,3,53,52,38,39,55,22,21,20,6,6,4,33,34,36,38,53,53,52,
+55,1,250,22,60,131,234,174,157,224,134,78,37,13,12,105,67,57,153,254,196,
+255,0,246,254,185,171,1,2,232,69,10,78,99,68,38,32,58,79,105,94,32,93,33,
+117,141,145,119,170,134,79,80,173,152,20,9,10,254,20,0,2,249,75,253,213,255,
+112,0,238,0,28,0,29,0,0,5,21,20,30,2,51,50,36,54,54,53,52,39,55,22,21,20,
+14,2,4,35,32,36,53,53,52,55,1,249,225,60,131,240,179,194,1,3,147,66,32,116,
+63,49,100,193,254,218,177,254,134,254,130,1,3,29,22,8,91,116,81,44,45,84,
+124,97,66,78,106,128,136,100,139,110,89,43,213,237,23,12,10,253,225,0,2,249,
+235,253,213,255,151,0,193,0,27,0,28,0,0,5,21,20,30,2,51,50,62,2,53,52,39,
+55,22,21,20,6,6,4,35,32,36,53,53,52,55,1,250,129,57,123,214,159,169,229,138,
+66,15,119,43,98,198,254,234,176,254,163,254,159,1,2,125,55,8,88,106,68,37,
+42,81,124,103,44,51,110,107,104,147,182,111,49,198,219,25,5,11,254,6,0,2,
+249,153,253,213,255,106,0,214,0,26,0,27,0,0,5,21,20,30,2,51,50,62,2,53,52,
+39,55,22,21,20,6,4,35,32,36,53,53,52,55,1,250,47,57,122,224,168,171,236,141,
+73,15,110,52,184,254,171,244,254,156,254,148,1,2,207,63,6,86,102,68,37,41,
+75,124,110,44,51,131,113,130,189,202,87,194,216,21,9,10,254,14,255,255,249,
+75,253,213,255,112,0,238,2,2,0,106,0,0,0,2,249,238,253,213,255,115,1,126,
+0,24,0,25,0,0,37,21,20,30,2,51,50,62,2,53,52,39,55,22,21,16,0,33,32,36,53,
+52,55,1,250,132,55,117,204,153,168,230,127,59,26,113,63,254,143,254,147,254,
+171,254,174,2,2,121,6,11,103,123,79,42,64,110,147,105,87,65,156,161,155,254,
+222,254,239,221,244,26,20,253,199,0,2,250,6,253,213,255,147,1,45,0,25,0,26,
+0,0,37,21,20,30,2,51,50,54,54,53,52,39,55,22,21,20,6,6,4,35,32,36,53,52,55,
+1,250,156,58,123,213,160,180,251,136,14,122,42,95,187,254,243,172,254,164,
+254,162,2,2,97,6,11,104,123,79,41,73,166,157,50,64,143,138,120,159,201,124,
+56,221,244,26,20,253,199,0,2,250,27,253,213,255,147,1,45,0,23,0,24,0,0,37,
+21,20,30,2,51,32,36,53,52,39,55,22,21,20,6,4,35,32,36,53,52,55,1,250,177,
+56,120,210,158,1,18,1,26,14,122,42,163,254,198,235,254,167,254,169,2,2,76,
+6,11,103,122,80,42,181,215,50,64,143,138,120,202,230,108,223,242,26,20,253,
+199,0,2,249,201,253,213,255,106,0,214,0,26,0,27,0,0,5,21,20,30,2,51,50,62,
+2,53,52,39,55,22,21,20,6,4,35,32,36,53,53,52,55,1,250,95,51,118,216,163,180,
+241,124,51,15,110,52,168,254,182,246,254,165,254,162,1,2,159,63,6,80,102,
+72,39,53,91,119,87,44,51,131,116,116,182,209,98,197,213,21,9,10,254,14,0,
+3,0,74,254,42,10,83,4,230,0,100,0,127,0,153,0,0,5,34,38,39,6,6,35,34,39,6,
+6,35,34,38,39,7,39,0,55,38,38,35,34,6,21,20,23,7,38,38,53,53,52,55,6,21,20,
+22,23,7,38,38,53,52,0,55,54,51,50,22,23,54,36,51,50,22,23,54,54,51,50,22,
+21,21,33,34,14,2,21,20,22,51,50,55,23,7,22,21,20,4,33,32,36,53,53,52,55,23,
+21,20,22,51,50,54,53,52,39,52,39,6,1,54,51,50,22,23,54,36,33,51,38,38,35,
+34,6,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,
+51,21,20,22,51,50,54,53,52,38,35,34,6,8,154,182,252,70,37,146,104,193,107,
+52,135,100,150,179,1,26,130,1,1,197,20,76,56,59,70,21,143,9,15,1,142,69,83,
+132,88,82,1,15,233,15,26,105,142,36,154,1,69,225,124,192,95,40,108,79,171,
+182,254,197,178,176,122,54,240,226,205,177,43,34,9,254,250,254,253,255,0,
+254,250,1,149,181,187,188,183,2,1,112,250,129,101,135,175,240,65,53,1,17,
+1,33,174,5,102,89,83,80,3,147,4,2,157,171,212,254,192,254,217,100,122,62,
+4,102,104,104,105,137,114,102,102,110,232,220,133,156,22,106,106,105,107,
+180,95,85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,26,104,41,9,5,5,122,
+245,118,199,117,78,130,252,138,240,1,68,17,4,99,98,124,114,35,37,38,34,193,
+181,83,34,85,126,84,159,185,88,137,17,43,70,196,219,206,191,17,11,9,7,7,150,
+125,131,159,19,14,7,5,32,3,137,36,117,116,114,132,88,99,63,49,11,19,18,29,
+21,33,12,60,109,254,234,113,175,23,33,137,122,146,155,14,22,135,158,133,134,
+187,201,27,0,2,0,77,254,42,9,78,4,230,0,95,0,121,0,0,5,34,36,39,6,6,35,34,
+38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,7,14,2,
+21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,33,50,23,54,51,50,22,21,21,33,34,
+14,2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,
+51,50,54,53,52,39,6,1,35,34,4,7,54,51,50,23,62,2,51,51,38,38,35,34,6,21,20,
+23,7,38,53,52,7,149,190,254,247,66,60,232,164,182,254,127,1,2,230,62,108,
+147,223,122,55,51,135,121,1,93,1,37,91,183,79,54,140,208,115,214,204,178,
+195,98,31,44,28,146,49,1,103,1,21,97,85,50,67,171,182,254,197,177,177,122,
+54,240,226,205,177,43,27,8,9,254,250,254,253,255,0,254,250,1,149,181,187,
+188,183,3,112,254,128,17,198,254,239,59,44,50,85,58,33,150,232,204,174,5,
+102,89,83,80,3,147,4,22,121,118,119,120,145,1,5,176,225,1,39,30,13,125,224,
+152,107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,206,218,179,154,
+140,14,22,45,1,64,1,72,12,12,193,181,83,34,84,127,84,159,185,88,137,14,3,
+51,62,196,219,206,191,17,11,9,7,7,150,125,131,159,23,21,31,4,120,208,200,
+18,55,79,116,60,88,99,63,49,18,12,18,29,21,73,255,255,250,27,253,213,255,
+147,1,45,2,2,0,112,0,0,0,2,250,24,253,213,255,115,1,126,0,22,0,23,0,0,5,21,
+20,22,22,51,32,36,53,52,39,55,22,21,16,0,33,32,36,53,53,52,55,1,250,174,118,
+226,165,1,25,1,25,26,113,63,254,156,254,156,254,183,254,182,1,2,80,6,10,138,
+139,59,204,215,96,63,156,161,155,254,231,254,230,227,227,26,9,10,253,211,
+0,2,249,173,253,213,255,106,0,214,0,27,0,28,0,0,5,21,20,30,2,51,50,62,2,53,
+52,39,55,22,21,20,6,4,35,34,36,38,53,53,52,55,1,250,67,56,121,220,164,164,
+229,143,75,15,110,52,177,254,176,246,228,254,194,164,1,2,187,63,6,85,102,
+69,37,39,75,125,111,44,51,131,116,116,193,205,91,83,180,147,21,9,10,254,14,
+255,255,249,153,253,213,255,106,0,214,2,2,0,108,0,0,255,255,249,153,253,213,
+255,106,0,214,2,2,0,108,0,0,0,2,248,79,253,213,255,48,0,132,0,29,0,30,0,0,
+5,20,22,22,4,51,50,36,54,54,53,52,39,55,22,21,20,6,6,4,35,34,36,46,2,53,53,
+52,55,1,248,229,70,156,1,28,213,214,1,30,165,76,14,127,34,106,224,254,176,
+224,180,254,195,216,109,49,1,4,25,97,79,100,69,37,42,79,118,90,42,46,97,85,
+103,147,171,106,47,33,78,97,118,82,12,8,9,254,47,255,255,249,153,253,213,
+255,106,0,214,2,6,0,108,0,0,0,2,249,60,253,213,255,112,0,213,0,29,0,30,0,
+0,5,21,20,30,2,51,50,36,54,54,53,52,39,55,22,21,20,14,2,4,35,34,36,38,53,
+53,52,55,1,249,210,62,135,241,180,194,1,3,149,71,21,117,51,50,101,193,254,
+216,180,252,254,171,175,1,3,44,9,11,94,121,82,45,42,81,123,104,52,63,110,
+115,127,100,139,109,88,42,92,199,169,25,11,10,253,214,0,2,250,3,253,213,255,
+115,1,126,0,24,0,25,0,0,5,21,20,30,2,51,50,54,54,53,52,39,55,22,21,16,0,33,
+32,36,53,53,52,55,1,250,153,53,112,203,151,186,254,133,26,113,63,254,148,
+254,153,254,177,254,178,1,2,101,4,14,94,116,79,45,87,186,153,87,65,156,161,
+146,254,220,254,232,224,234,26,5,10,253,211,0,1,0,74,254,42,4,142,4,230,0,
+66,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,
+22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,53,53,52,
+55,23,21,20,22,51,50,54,54,53,52,39,52,39,6,2,193,254,215,254,178,96,182,
+235,183,204,5,102,89,81,81,2,147,4,158,143,170,182,254,179,188,186,127,57,
+254,238,216,186,43,23,11,9,254,250,254,253,255,0,254,250,1,149,181,187,123,
+163,85,3,1,125,22,1,6,237,122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,
+192,182,83,34,84,127,84,159,185,88,137,12,5,43,70,196,219,206,191,17,11,9,
+7,7,150,125,55,124,111,11,24,6,6,34,0,2,249,173,253,213,255,106,0,214,0,27,
+0,28,0,0,5,21,20,30,2,51,50,62,2,53,52,39,55,22,21,20,6,6,4,35,32,36,53,53,
+52,55,1,250,67,53,119,222,167,181,242,130,58,15,110,52,68,159,254,211,231,
+254,161,254,153,1,2,187,63,6,81,103,70,39,48,84,122,96,44,51,131,116,116,
+117,167,129,76,195,215,21,9,10,254,14,0,2,249,30,253,213,255,112,0,213,0,
+29,0,30,0,0,5,21,20,30,2,51,50,36,54,54,53,52,39,55,22,21,20,14,2,4,35,34,
+36,38,53,53,52,55,1,249,180,69,142,241,180,202,1,12,149,70,21,117,51,49,101,
+196,254,209,187,253,254,166,183,1,3,74,9,11,103,121,77,41,44,81,123,102,52,
+63,110,116,126,102,138,108,87,43,90,198,172,25,11,10,253,214,0,1,0,74,254,
+42,5,104,4,230,0,80,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,
+38,53,52,55,34,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,
+33,34,14,2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,53,53,52,55,23,21,
+20,22,51,50,54,54,53,52,39,6,3,175,254,228,254,192,77,154,214,214,195,5,104,
+88,82,80,2,146,5,26,233,254,105,137,56,62,150,1,32,190,110,63,43,68,169,183,
+254,197,179,177,119,54,240,226,205,177,42,26,7,9,254,250,254,253,255,0,254,
+250,1,149,181,187,123,163,85,4,112,22,1,6,237,109,172,118,56,89,98,62,50,
+18,12,18,30,20,71,44,255,231,221,180,67,102,247,126,185,1,20,148,11,11,190,
+184,83,34,85,126,84,159,185,88,137,14,3,43,70,196,219,206,191,17,11,9,7,7,
+150,125,55,124,111,9,37,33,255,255,250,27,253,213,255,147,1,45,2,2,0,112,
+0,0,255,255,249,238,253,213,255,115,1,126,2,2,0,110,0,0,0,2,249,153,253,213,
+255,118,1,25,0,30,0,31,0,0,5,21,20,30,2,51,50,62,3,53,52,38,39,55,22,21,20,
+14,2,4,35,32,36,53,53,52,55,1,250,47,64,127,228,168,148,217,134,81,37,13,
+12,105,67,42,90,175,254,233,183,254,148,254,144,1,2,207,69,10,82,99,65,37,
+32,58,84,114,95,27,83,33,117,142,115,117,155,119,94,46,191,214,20,9,10,254,
+20,0,2,248,229,253,213,255,69,0,238,0,28,0,29,0,0,5,21,20,30,2,51,50,36,54,
+53,52,39,55,22,21,20,14,2,4,35,32,36,38,53,53,52,55,1,249,123,63,139,250,
+186,227,1,53,161,32,116,63,46,100,199,254,201,187,254,252,254,161,178,1,3,
+131,32,8,89,112,78,43,61,145,144,66,78,106,130,120,105,143,112,92,43,90,190,
+158,24,10,10,253,238,0,2,249,160,253,213,255,115,1,126,0,24,0,25,0,0,37,21,
+20,30,2,51,50,36,54,53,52,39,55,22,21,16,0,33,34,36,38,53,52,55,1,250,54,
+64,126,216,160,198,1,22,149,26,113,63,254,122,254,127,238,254,195,161,2,2,
+199,6,11,112,122,74,39,81,183,167,60,87,156,163,142,254,210,254,240,95,200,
+170,26,20,253,199,0,2,249,104,253,213,255,115,1,57,0,28,0,29,0,0,5,21,20,
+30,2,51,50,62,2,53,52,39,55,22,21,20,6,6,4,35,34,36,38,53,53,52,55,1,249,
+254,66,135,226,166,176,244,153,81,16,115,51,73,173,254,191,237,241,254,183,
+173,1,3,0,10,12,105,121,75,39,46,86,142,124,66,56,155,146,132,133,187,141,
+81,91,199,170,27,8,10,253,215,0,2,249,240,253,213,255,151,0,185,0,27,0,28,
+0,0,5,21,20,30,2,51,50,62,2,53,52,39,55,22,21,20,6,6,4,35,32,36,53,53,52,
+55,1,250,134,51,126,236,158,163,223,131,62,15,119,43,79,162,254,231,206,254,
+155,254,150,1,2,120,55,8,84,103,76,36,44,80,119,93,49,52,110,106,119,126,
+164,113,64,194,223,25,5,11,254,6,0,1,0,74,253,213,6,137,4,230,0,80,0,0,1,
+20,6,35,34,38,53,52,55,33,53,33,21,33,6,21,20,51,50,54,53,52,36,33,32,0,17,
+16,0,33,32,36,53,53,55,23,22,21,20,7,22,21,20,6,4,35,34,36,46,2,53,53,52,
+55,23,21,20,30,2,51,32,36,53,53,52,39,6,4,35,32,36,2,53,52,18,36,33,32,4,
+6,121,230,207,176,179,11,254,202,2,252,254,213,16,203,139,146,254,255,254,
+255,254,144,254,119,1,100,1,70,1,44,1,56,147,3,1,56,22,171,254,182,241,179,
+254,243,172,98,45,1,149,72,141,228,168,1,50,1,38,1,101,254,213,179,254,233,
+254,134,182,219,1,159,1,20,1,77,1,84,3,8,173,203,142,139,35,36,137,137,30,
+38,143,122,111,173,167,254,192,254,223,254,251,254,228,181,180,14,10,22,8,
+9,119,95,68,90,184,209,96,42,78,102,130,86,24,9,10,7,10,105,115,66,33,167,
+183,10,5,4,73,74,175,1,56,208,225,1,84,182,249,255,255,249,238,253,213,255,
+115,1,126,2,2,0,110,0,0,0,2,249,55,253,213,255,94,1,25,0,30,0,31,0,0,5,21,
+20,30,2,51,50,62,3,53,52,39,55,22,21,20,14,2,4,35,32,36,38,53,53,52,55,1,
+249,205,57,135,253,178,165,234,140,78,38,37,116,68,48,106,177,254,229,193,
+255,0,254,175,175,1,3,49,22,8,94,114,82,42,32,57,78,105,93,81,91,106,146,
+138,114,152,113,80,45,90,193,167,26,9,10,253,225,255,255,250,27,253,213,255,
+147,1,45,2,2,0,112,0,0,255,255,249,235,253,213,255,151,0,193,2,2,0,107,0,
+0,0,2,248,249,253,213,255,69,0,238,0,28,0,29,0,0,5,21,20,30,2,51,50,36,54,
+54,53,52,39,55,22,21,20,14,2,4,35,32,36,53,53,52,55,1,249,143,60,134,248,
+186,200,1,10,151,70,32,116,63,71,144,215,255,0,147,254,127,254,118,1,3,111,
+32,8,87,111,79,45,44,83,122,101,66,78,106,130,126,121,161,111,68,28,206,232,
+24,10,10,253,238,0,3,0,74,254,15,7,67,6,177,0,97,0,107,0,108,0,0,1,38,53,
+52,55,6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,6,
+6,21,20,4,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,0,17,16,7,
+22,21,16,0,33,32,36,53,52,55,23,21,20,30,2,51,50,62,2,53,52,39,6,4,35,34,
+36,38,53,52,36,33,51,38,38,35,34,21,20,23,1,38,39,22,23,22,22,51,50,54,1,
+2,26,9,16,156,165,113,134,63,66,151,1,33,188,25,33,40,23,166,181,225,171,
+187,94,1,16,240,222,1,57,165,87,43,120,71,119,123,16,40,7,51,1,100,1,117,
+117,49,254,143,254,147,254,171,254,174,2,148,55,117,204,153,168,230,127,59,
+15,112,254,201,198,206,254,213,157,1,39,1,7,123,5,99,85,157,5,3,91,107,179,
+22,5,4,52,55,50,70,254,62,3,163,50,35,46,42,42,242,182,234,161,73,104,245,
+127,186,1,20,146,4,4,190,184,83,64,125,97,180,207,166,1,67,214,207,157,57,
+63,144,144,111,93,23,3,124,114,254,49,254,194,254,235,198,140,137,254,222,
+254,239,221,244,26,20,8,11,103,123,79,42,64,110,147,105,65,55,108,108,131,
+241,163,191,228,90,97,121,19,24,1,91,125,89,49,112,87,62,47,1,64,0,2,249,
+197,253,213,255,125,0,213,0,26,0,27,0,0,5,21,20,22,22,51,50,62,2,53,52,39,
+55,22,21,20,6,4,35,34,36,38,53,53,52,55,1,250,91,126,244,189,177,236,135,
+60,21,117,51,180,254,178,242,228,254,198,166,1,2,163,22,12,135,135,58,45,
+85,124,96,52,63,110,117,114,192,206,91,88,195,164,23,11,10,253,229,0,2,249,
+237,253,213,255,115,1,126,0,25,0,26,0,0,5,21,20,30,3,51,50,62,2,53,52,39,
+55,22,21,16,0,33,32,36,53,52,55,1,250,132,31,64,116,189,129,168,230,127,59,
+26,113,63,254,144,254,146,254,172,254,172,2,2,122,57,9,70,80,62,47,27,64,
+110,147,105,87,65,156,161,150,254,223,254,233,196,211,20,20,254,7,255,255,
+250,27,253,213,255,147,1,45,2,2,0,112,0,0,255,255,249,201,253,213,255,106,
+0,214,2,2,0,113,0,0,255,255,249,238,253,213,255,115,1,126,2,2,0,110,0,0,255,
+255,249,173,253,213,255,106,0,214,2,2,0,118,0,0,255,255,250,3,253,213,255,
+115,1,126,2,2,0,124,0,0,255,255,249,238,253,213,255,115,1,126,2,2,0,110,0,
+0,255,255,249,173,253,213,255,106,0,214,2,2,0,126,0,0,255,255,249,238,253,
+213,255,115,1,126,2,2,0,110,0,0,255,255,250,3,253,213,255,115,1,126,2,2,0,
+124,0,0,0,3,0,58,254,42,8,200,4,230,0,88,0,116,0,130,0,0,5,34,36,39,6,4,35,
+32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,
+50,22,23,54,36,51,50,23,55,54,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,
+55,23,6,7,22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,50,54,54,53,52,39,
+52,39,6,1,54,51,50,22,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,53,38,
+38,35,34,6,7,6,6,7,22,22,51,50,54,53,52,38,35,34,7,16,195,254,245,64,59,255,
+0,197,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,
+27,147,128,96,130,35,99,1,11,156,215,174,10,37,112,88,171,182,254,197,178,
+176,122,54,240,226,205,177,42,26,7,9,254,250,254,253,255,0,254,250,1,149,
+181,187,123,163,85,2,1,106,251,96,49,46,149,202,54,42,153,221,185,175,5,102,
+89,83,80,3,147,4,78,165,103,127,211,132,55,223,193,65,247,200,208,225,194,
+175,67,22,126,122,124,124,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,
+30,45,39,29,82,78,121,135,100,100,118,123,93,11,41,41,193,181,83,34,85,126,
+84,159,185,88,137,14,3,43,70,196,219,206,191,17,11,9,7,7,150,125,55,124,111,
+19,14,7,5,32,3,166,7,104,104,73,99,49,88,99,62,50,18,12,18,29,21,20,44,41,
+101,238,171,169,5,156,150,184,166,149,156,255,255,249,201,253,213,255,106,
+0,214,2,2,0,113,0,0,255,255,249,238,253,213,255,115,1,126,2,2,0,110,0,0,255,
+255,0,44,255,234,8,14,7,200,2,34,0,24,0,0,0,3,0,65,8,14,0,0,0,4,0,74,255,
+234,6,180,7,200,0,82,0,92,0,93,0,94,0,0,5,34,39,6,7,39,54,18,53,52,38,35,
+34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,0,21,20,
+7,51,22,22,51,50,18,17,16,0,33,34,4,7,39,54,55,38,53,52,36,33,32,4,21,20,
+7,39,54,53,52,36,33,34,4,21,20,23,54,51,32,0,17,16,2,37,22,51,50,54,53,52,
+38,35,34,1,1,5,4,197,51,41,87,109,135,118,194,179,136,206,113,21,136,165,
+120,143,154,143,129,201,108,151,1,20,181,250,1,13,87,40,5,60,71,124,147,254,
+128,254,123,169,254,228,161,41,79,37,12,1,69,1,69,1,94,1,94,42,135,30,254,
+233,254,236,245,255,0,5,192,191,1,224,1,208,230,251,99,73,131,77,75,67,59,
+121,1,139,1,66,22,170,63,107,96,147,1,7,146,168,198,119,223,148,109,71,153,
+137,105,124,135,136,243,146,189,1,32,157,254,243,226,185,175,79,80,1,26,1,
+23,1,114,1,100,43,52,135,25,9,45,53,188,189,191,191,92,98,42,63,83,125,116,
+111,128,28,33,37,254,82,254,67,254,168,254,156,230,92,57,60,48,61,3,144,2,
+226,0,2,0,78,255,234,7,66,7,200,0,78,0,89,0,0,1,16,0,33,34,39,55,22,51,50,
+54,53,52,2,35,34,6,7,54,51,50,22,21,20,6,6,35,32,0,17,52,18,36,51,50,23,7,
+38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,23,17,52,38,39,
+55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,18,3,22,51,50,53,52,38,35,34,
+6,7,6,244,254,201,254,246,57,54,8,44,41,216,226,202,174,158,203,53,40,54,
+112,129,123,238,161,254,241,254,211,145,1,21,185,55,47,8,41,47,230,229,217,
+201,173,199,97,31,44,28,146,49,1,52,225,96,78,46,57,53,104,29,48,112,85,98,
+113,106,46,22,102,107,209,27,31,111,40,35,49,44,1,2,121,254,212,254,174,6,
+138,3,255,242,215,1,5,203,193,19,145,131,136,218,124,1,75,1,41,195,1,37,160,
+6,138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,65,1,71,26,1,187,98,
+77,22,124,30,67,97,100,89,96,107,4,254,64,79,254,242,3,145,5,86,35,42,57,
+58,0,2,0,62,255,234,6,151,7,200,0,122,0,134,0,0,1,20,7,39,54,53,52,35,34,
+6,7,51,32,0,21,20,6,35,34,39,39,54,53,52,38,35,34,6,21,20,23,7,6,35,34,38,
+53,16,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,
+21,35,34,14,3,21,20,22,51,50,55,38,53,52,54,51,51,50,22,21,20,7,22,51,50,
+54,53,52,38,38,35,35,53,52,54,51,51,50,23,17,52,38,39,55,22,23,54,51,50,22,
+21,20,6,35,34,39,17,22,22,3,22,51,50,53,52,38,35,34,6,6,21,5,250,14,144,9,
+157,86,99,4,17,1,16,1,33,221,197,148,112,15,90,80,78,84,77,90,15,112,143,
+193,230,229,71,144,40,2,104,5,100,85,81,76,1,147,3,155,139,167,179,55,120,
+140,130,89,50,146,140,70,33,80,157,139,15,139,157,82,35,71,142,143,112,229,
+185,48,179,167,13,6,7,46,57,53,104,29,48,112,85,98,113,106,46,22,65,65,130,
+27,31,111,40,35,32,38,24,3,247,44,57,23,38,23,121,99,88,254,255,250,212,235,
+39,135,23,75,51,54,57,48,75,23,135,39,233,205,1,11,121,7,135,89,98,61,53,
+14,8,5,7,12,33,114,124,191,183,83,18,58,86,134,84,147,155,6,59,96,101,118,
+119,104,91,59,7,155,156,141,158,72,83,181,193,1,1,162,98,77,22,124,30,67,
+97,101,88,96,107,4,254,131,30,104,2,119,5,86,35,42,22,48,62,0,4,0,52,255,
+234,6,205,7,200,0,96,0,107,0,108,0,109,0,0,1,16,2,35,34,38,39,6,6,35,34,38,
+53,52,54,55,55,62,2,53,52,38,35,35,22,22,21,20,6,35,34,38,53,52,54,51,50,
+22,21,20,6,6,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,
+34,4,7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,36,33,34,6,6,21,20,
+23,54,51,32,0,5,6,6,21,20,22,51,50,54,53,52,1,1,6,205,249,241,109,165,67,
+67,167,113,189,221,203,238,71,82,75,38,174,177,6,21,22,143,108,114,129,242,
+230,242,243,79,155,122,189,161,136,129,139,135,138,132,134,170,170,254,146,
+254,127,165,254,234,156,41,35,69,12,1,62,1,63,1,90,1,91,42,135,30,254,240,
+254,241,150,220,123,5,203,188,1,209,1,190,250,162,88,82,53,51,54,52,4,0,253,
+31,2,147,254,173,254,170,85,95,98,82,211,185,166,203,70,21,24,31,49,42,72,
+67,33,80,35,111,118,122,101,135,154,139,137,83,98,72,31,48,151,121,122,128,
+141,160,14,14,155,146,1,11,1,12,1,133,1,106,41,51,135,12,19,45,53,188,189,
+191,191,92,98,42,63,83,124,117,43,102,94,29,33,38,254,73,5,13,72,48,48,54,
+55,49,79,3,167,250,222,0,2,0,77,255,234,8,134,7,200,0,92,0,103,0,0,1,16,0,
+33,34,39,55,22,51,50,54,53,52,2,35,34,6,7,54,51,50,22,21,20,0,35,34,38,2,
+53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,7,14,2,21,20,
+22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,23,17,52,38,39,55,22,23,54,51,50,
+22,21,20,6,35,34,39,17,22,18,3,22,51,50,53,52,38,35,34,6,7,8,56,254,201,254,
+246,56,56,9,27,57,217,225,201,174,158,203,54,45,49,113,129,254,224,244,182,
+254,127,1,2,230,62,108,147,223,122,55,51,135,121,1,93,1,37,91,183,79,54,140,
+208,115,214,204,178,195,98,31,44,28,146,51,1,52,224,96,78,46,57,53,104,29,
+48,112,85,98,113,106,46,22,102,107,209,27,31,111,40,35,49,44,1,2,121,254,
+212,254,174,6,138,3,255,242,215,1,5,203,193,19,145,131,214,254,248,145,1,
+5,176,225,1,39,30,13,125,224,152,107,201,76,68,219,241,1,35,1,77,48,46,143,
+5,112,208,144,206,218,179,154,140,14,22,45,1,68,1,68,26,1,187,98,77,22,124,
+30,67,97,101,88,96,107,4,254,64,79,254,242,3,145,5,86,35,42,57,58,0,2,0,62,
+255,234,6,59,7,200,0,83,0,84,0,0,1,20,2,4,33,34,36,38,53,52,54,55,6,35,35,
+53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,
+20,22,51,50,36,18,53,16,0,33,34,4,7,39,55,38,53,52,36,33,32,4,21,20,7,39,
+54,53,52,36,33,34,6,6,21,20,23,54,51,32,4,18,3,6,59,198,254,128,254,238,207,
+254,222,142,99,94,70,111,50,2,229,6,100,85,79,78,1,146,3,155,139,167,179,
+177,172,160,129,60,255,235,229,1,59,158,254,138,254,186,169,254,242,151,41,
+98,12,1,54,1,51,1,80,1,84,42,135,30,254,249,254,249,149,211,113,5,193,201,
+1,5,1,133,203,164,3,0,246,254,153,185,127,219,140,116,173,51,7,135,89,98,
+59,55,13,7,7,7,23,22,114,124,193,181,83,26,84,126,85,166,186,153,1,38,197,
+1,57,1,73,42,50,135,30,45,54,184,193,192,190,92,98,42,63,83,120,121,47,103,
+89,29,32,37,185,254,160,3,208,0,6,0,74,255,234,6,69,7,200,0,84,0,95,0,108,
+0,117,0,118,0,119,0,0,1,23,4,7,54,51,50,22,22,21,20,7,22,22,21,16,0,33,34,
+36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,
+34,6,21,20,4,33,32,36,53,52,39,6,6,35,34,38,38,53,52,55,17,52,38,39,55,22,
+23,54,51,50,22,21,20,6,35,34,39,21,20,7,54,39,22,51,50,53,52,38,35,34,6,21,
+19,50,22,23,52,55,53,52,38,35,34,6,7,21,22,22,51,50,55,38,38,35,3,5,5,245,
+60,254,194,170,53,57,88,123,62,11,48,48,254,125,254,141,245,254,184,160,1,
+9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,199,177,1,48,1,24,1,38,
+1,57,13,45,137,91,78,128,83,26,46,57,53,104,29,48,112,85,98,113,106,46,22,
+7,187,180,27,31,111,40,35,47,47,32,89,150,61,1,85,82,79,101,12,4,69,92,125,
+44,46,147,101,253,3,71,6,123,129,115,191,30,81,150,103,74,57,52,137,86,254,
+251,254,237,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,
+83,142,149,178,204,206,187,65,42,71,70,68,171,138,95,89,2,115,98,77,22,124,
+30,67,97,100,89,96,107,4,146,94,67,234,189,5,86,35,42,55,77,252,210,26,26,
+9,8,18,107,107,105,92,135,75,104,118,30,31,3,148,198,0,6,0,74,255,234,6,18,
+7,200,0,84,0,95,0,108,0,113,0,114,0,115,0,0,1,23,6,6,7,54,51,50,22,21,20,
+6,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,
+52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,38,35,35,53,52,55,
+17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,21,20,7,55,54,54,37,22,
+51,50,53,52,38,35,34,6,21,19,7,20,30,2,51,50,53,52,38,35,34,7,38,39,6,7,3,
+5,5,213,61,148,190,42,26,18,119,146,56,55,86,86,254,136,254,151,245,254,184,
+160,1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,199,177,1,48,1,24,
+194,1,8,129,178,198,177,24,46,57,53,104,29,48,112,85,98,113,106,46,22,4,21,
+35,246,254,214,27,31,111,40,35,47,47,141,1,8,23,45,32,81,71,65,34,115,26,
+10,28,3,216,3,11,6,123,129,51,140,89,4,119,101,69,90,20,52,171,118,254,252,
+254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,142,
+149,178,204,96,172,113,151,141,83,90,69,2,120,98,77,22,124,30,67,97,100,89,
+96,107,4,225,99,73,11,136,234,132,5,86,35,42,55,77,253,141,26,52,48,40,23,
+89,46,58,191,39,66,46,59,3,13,198,0,5,0,44,255,234,11,38,7,200,0,101,0,115,
+0,141,0,142,0,143,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,34,39,6,6,
+35,34,38,39,7,39,0,55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,36,
+51,32,5,7,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,
+4,7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,33,34,6,21,20,23,54,
+51,32,0,1,54,54,55,38,38,35,34,4,7,54,51,50,22,5,6,7,51,6,21,20,22,51,50,
+54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,1,1,11,38,241,229,109,163,
+67,71,155,113,108,162,46,40,139,94,193,108,50,136,101,149,179,1,26,130,1,
+12,186,40,113,59,70,22,143,27,147,128,95,134,35,146,1,53,220,1,92,1,21,53,
+123,180,93,136,127,125,130,138,130,134,157,164,254,158,254,138,158,254,244,
+155,41,22,83,12,1,55,1,50,1,77,1,84,42,135,30,253,245,233,240,5,188,185,1,
+197,1,178,250,49,46,181,135,116,210,129,186,254,211,136,99,138,170,245,252,
+218,89,134,63,4,102,104,104,105,137,113,102,102,110,232,219,133,156,6,223,
+254,75,2,147,254,175,254,168,82,98,102,78,98,93,94,97,180,94,86,187,176,46,
+73,1,127,169,157,66,71,45,69,29,82,78,121,135,102,95,119,119,249,151,6,104,
+178,116,157,169,145,156,14,14,156,145,1,9,1,14,1,132,1,107,41,51,135,8,23,
+45,53,182,195,193,189,92,98,42,63,83,241,115,124,28,33,37,254,73,254,76,122,
+146,25,76,67,112,119,36,122,70,101,187,23,33,139,120,146,155,14,22,135,158,
+133,134,188,200,27,4,216,251,149,0,4,0,74,253,213,10,148,7,200,0,113,0,124,
+0,151,0,177,0,0,5,34,38,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,38,35,
+34,6,21,20,23,7,38,38,53,53,52,55,6,21,20,22,23,7,38,38,53,52,0,55,54,51,
+50,22,23,54,36,51,50,22,23,54,54,51,50,23,17,52,38,39,55,22,23,54,51,50,22,
+21,20,6,35,34,39,17,22,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,
+20,51,50,55,23,6,35,34,38,53,52,55,35,6,19,22,51,50,53,52,38,35,34,6,21,1,
+54,51,50,22,23,54,36,33,51,38,38,35,34,6,21,20,23,7,38,53,52,55,38,35,34,
+4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,
+6,8,154,182,252,70,37,146,104,193,107,52,135,100,150,179,1,26,130,1,1,197,
+20,76,56,59,70,21,143,9,15,1,142,69,83,132,88,82,1,15,233,15,26,105,142,36,
+154,1,69,225,124,192,95,40,108,79,18,20,46,57,53,104,29,48,112,85,98,113,
+106,46,22,88,88,254,197,178,176,122,54,240,226,205,177,43,90,105,132,195,
+81,64,33,88,122,149,166,86,25,11,207,27,31,111,40,35,47,47,250,61,101,135,
+175,240,65,53,1,17,1,33,174,5,102,89,83,80,3,147,4,2,157,171,212,254,192,
+254,217,100,122,62,4,102,104,104,105,137,114,102,102,110,232,220,133,156,
+22,106,106,105,107,180,95,85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,
+26,104,41,9,5,5,122,245,118,199,117,78,130,252,138,240,1,68,17,4,99,98,124,
+114,35,37,38,34,2,1,163,98,77,22,124,30,67,97,101,88,96,107,4,254,127,42,
+170,127,83,34,85,126,84,159,185,88,137,47,25,108,139,171,31,131,40,162,145,
+123,104,1,6,206,5,86,35,42,55,77,252,161,36,117,116,114,132,88,99,63,49,11,
+19,18,29,21,33,12,60,109,254,234,113,175,23,33,137,122,146,155,14,22,135,
+158,133,134,187,201,27,0,3,0,77,253,213,9,142,7,200,0,109,0,120,0,146,0,0,
+5,34,36,39,6,6,35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,16,
+0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,33,50,23,54,
+51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,21,21,
+33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,
+55,35,6,19,22,51,50,53,52,38,35,34,6,7,1,35,34,4,7,54,51,50,23,62,2,51,51,
+38,38,35,34,6,21,20,23,7,38,53,52,7,149,190,254,247,66,60,232,164,182,254,
+127,1,2,230,62,108,147,223,122,55,51,135,121,1,93,1,37,91,183,79,54,140,208,
+115,214,204,178,195,98,31,44,28,146,49,1,103,1,21,97,85,50,67,19,18,46,57,
+53,104,29,48,112,85,98,113,106,46,22,88,89,254,197,177,177,122,54,240,226,
+205,177,43,90,105,132,195,81,64,33,88,122,149,166,86,25,11,206,27,31,111,
+40,35,49,44,1,254,60,17,198,254,239,59,44,50,85,58,33,150,232,204,174,5,102,
+89,83,80,3,147,4,22,121,118,119,120,145,1,5,176,225,1,39,30,13,125,224,152,
+107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,206,218,179,154,140,
+14,22,45,1,64,1,72,12,12,2,1,163,98,77,22,124,30,67,97,101,88,96,107,4,254,
+127,41,170,128,83,34,84,127,84,159,185,88,137,47,25,108,139,171,31,131,40,
+161,146,123,104,1,6,206,5,86,35,42,57,58,253,127,208,200,18,55,79,116,60,
+88,99,63,49,18,12,18,29,21,73,0,6,0,74,255,234,7,53,7,200,0,95,0,107,0,120,
+0,125,0,126,0,127,0,0,1,23,6,6,7,54,51,50,22,21,20,6,7,22,22,21,16,0,33,32,
+0,17,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,55,6,17,20,23,7,38,38,53,
+52,18,36,51,51,50,22,22,21,21,35,34,6,21,20,4,33,32,36,53,52,38,35,35,53,
+52,55,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,21,20,7,55,54,54,
+37,22,51,50,53,52,38,35,34,6,6,21,19,7,20,30,2,51,50,53,52,38,35,34,7,38,
+39,6,7,3,5,6,232,60,147,190,43,26,18,120,146,56,55,86,86,254,136,254,151,
+254,152,254,138,1,9,1,5,31,5,99,85,158,10,145,10,5,194,113,134,63,66,148,
+1,22,179,25,112,152,82,175,199,178,1,48,1,25,1,26,1,48,178,197,177,24,46,
+57,53,104,29,48,112,85,98,113,106,46,22,4,20,36,247,254,213,27,31,111,40,
+35,32,38,24,141,1,7,24,45,32,81,72,64,34,116,27,8,29,3,190,3,11,6,123,129,
+51,140,89,4,119,101,69,90,20,52,171,118,254,252,254,236,1,20,1,4,207,211,
+90,97,121,22,39,23,38,62,30,18,123,254,211,234,161,73,104,245,127,187,1,19,
+146,85,164,125,83,141,150,178,204,202,179,151,141,83,90,69,2,120,98,77,22,
+124,30,67,97,100,89,96,107,4,225,99,73,10,138,234,131,5,86,35,42,22,48,62,
+253,141,26,52,48,40,23,89,45,59,191,46,58,44,60,3,13,198,0,3,0,74,255,234,
+6,13,7,200,0,59,0,60,0,61,0,0,1,16,0,33,34,36,38,53,52,0,33,50,23,7,38,35,
+34,6,21,20,22,51,50,36,18,53,16,0,33,34,4,7,39,55,38,53,52,36,33,32,4,21,
+20,7,39,54,53,52,33,34,6,6,21,20,23,54,51,32,4,18,37,1,6,13,254,85,254,109,
+214,254,222,141,1,60,1,16,121,97,13,92,111,210,230,250,244,217,1,47,157,254,
+162,254,179,157,254,250,147,41,98,12,1,46,1,40,1,71,1,72,42,135,30,254,7,
+145,202,107,5,184,186,1,14,1,120,190,252,4,2,10,3,0,254,141,254,93,127,228,
+154,247,1,5,14,141,14,188,179,176,187,149,1,39,200,1,60,1,70,43,49,135,30,
+45,54,182,195,196,186,92,98,42,63,83,241,48,105,86,28,33,37,181,254,161,233,
+2,226,0,5,0,74,255,234,6,178,7,200,0,78,0,89,0,99,0,100,0,101,0,0,1,16,2,
+35,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,50,
+54,53,53,51,21,20,22,51,50,54,54,53,16,39,6,6,35,34,38,53,52,38,39,34,39,
+55,4,23,38,53,53,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,21,22,18,
+3,22,51,50,53,52,38,35,34,6,7,3,38,39,22,23,22,22,51,50,54,1,3,6,130,251,
+236,112,167,69,74,158,116,188,221,143,1,14,183,111,115,14,87,117,217,237,
+141,132,132,133,138,136,137,116,149,73,168,41,135,79,119,123,18,37,2,3,53,
+1,17,178,2,46,57,53,104,29,48,112,85,98,113,106,46,22,119,120,239,27,31,111,
+40,35,49,44,1,171,116,180,22,5,4,52,55,51,75,254,52,100,2,128,254,184,254,
+178,83,97,103,77,255,230,153,245,134,14,139,13,213,192,157,169,147,154,14,
+14,157,144,115,229,175,1,99,226,72,81,144,144,113,90,23,2,126,90,142,35,87,
+68,98,77,22,124,30,67,97,101,88,96,107,4,254,140,254,157,3,97,5,86,35,42,
+57,58,254,70,112,84,49,113,87,62,53,1,58,254,193,0,2,0,62,255,234,6,150,7,
+200,0,94,0,95,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,16,55,6,35,35,53,33,
+38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,
+51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,55,38,53,52,36,
+33,32,4,21,20,7,39,54,53,52,36,33,34,6,6,21,20,23,54,51,32,0,3,6,150,250,
+241,108,164,67,76,161,112,190,229,229,71,144,40,2,136,5,100,85,79,78,1,147,
+3,155,140,165,181,55,157,166,153,86,146,129,136,138,137,133,136,169,169,254,
+146,254,127,165,254,235,156,41,35,69,12,1,66,1,59,1,90,1,91,42,135,30,254,
+240,254,241,156,220,117,5,202,188,1,209,1,190,255,2,147,254,173,254,170,84,
+96,104,76,236,204,1,9,121,7,135,89,98,59,55,14,8,5,7,23,22,114,124,190,183,
+84,25,86,157,111,139,155,146,155,14,14,155,146,1,11,1,12,1,133,1,106,41,51,
+135,12,19,45,53,187,190,191,191,92,98,42,63,83,124,117,47,103,89,29,33,38,
+254,73,3,110,0,4,0,62,255,234,6,203,7,200,0,100,0,112,0,122,0,123,0,0,1,16,
+2,35,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,
+20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,
+21,20,22,51,50,54,54,53,52,2,39,6,6,35,34,38,53,52,38,39,34,39,55,4,23,38,
+53,53,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,21,22,18,3,22,51,50,
+53,52,38,35,34,6,6,21,3,38,39,22,23,22,22,51,50,54,1,6,155,251,236,113,168,
+67,76,161,112,189,230,117,114,66,151,40,2,136,5,100,85,79,78,1,147,3,155,
+140,165,181,60,151,166,154,86,146,129,136,138,137,135,139,117,150,71,84,84,
+40,134,80,117,126,18,37,2,3,53,1,17,178,2,46,57,53,104,29,48,112,85,98,113,
+106,46,22,119,120,239,27,31,111,40,35,32,38,24,170,119,177,22,5,4,52,55,54,
+74,254,44,2,128,254,184,254,178,84,96,104,76,237,203,130,198,59,8,135,89,
+98,59,55,14,8,5,7,23,22,114,124,190,183,84,24,87,157,111,139,155,146,155,
+14,14,156,145,119,231,169,178,1,34,112,71,81,141,147,115,88,23,2,126,90,142,
+35,87,68,98,77,22,124,30,67,97,101,88,96,107,4,254,140,254,157,3,97,5,86,
+35,42,22,48,62,254,86,115,81,49,112,87,62,56,1,55,0,8,0,10,255,234,9,168,
+7,200,0,83,0,94,0,103,0,131,0,143,0,144,0,145,0,146,0,0,1,16,2,35,34,38,39,
+55,22,22,51,50,54,54,53,52,38,35,34,6,21,21,35,53,52,38,35,34,7,22,21,20,
+2,4,35,34,36,39,7,39,1,38,53,52,54,36,51,50,23,54,1,23,1,22,23,54,51,50,22,
+23,54,54,51,51,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,18,
+3,22,51,50,53,52,38,35,34,6,21,1,54,1,38,35,34,6,21,20,3,22,22,51,50,54,54,
+53,52,38,39,0,1,22,23,38,53,52,54,51,50,22,21,20,6,35,32,39,5,51,50,54,53,
+52,38,35,34,6,21,20,9,2,9,85,191,190,122,185,56,141,41,103,76,89,99,40,103,
+103,90,93,136,70,70,65,42,51,168,254,195,207,200,254,211,141,58,111,1,26,
+58,144,1,5,169,100,88,221,1,47,99,254,46,147,91,72,96,67,105,39,39,137,97,
+3,46,57,53,104,29,48,112,85,98,113,106,46,22,102,102,204,27,31,111,40,35,
+47,47,249,4,176,1,32,24,25,189,243,102,119,251,162,166,250,137,168,161,254,
+212,254,253,68,111,28,132,114,117,135,183,151,255,0,155,1,165,7,73,99,55,
+54,50,55,3,87,249,199,8,181,2,34,254,228,254,228,138,136,57,102,88,98,190,
+157,220,213,132,158,13,12,132,105,48,124,157,198,254,225,151,130,146,64,99,
+1,28,106,129,126,206,114,14,204,1,13,113,254,105,57,116,63,60,60,87,88,1,
+209,98,77,22,124,30,67,97,101,88,96,107,4,254,81,54,254,232,3,113,5,86,35,
+42,55,77,252,21,171,1,13,2,174,136,84,254,147,122,112,114,222,152,176,245,
+52,254,242,254,255,62,25,60,64,98,120,127,109,117,139,142,9,59,61,50,57,53,
+50,73,4,44,251,37,6,126,0,2,0,74,255,234,7,174,7,200,0,110,0,111,0,0,1,16,
+2,35,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,
+20,23,7,38,53,52,55,6,6,21,20,23,7,38,2,53,52,18,36,51,50,23,54,51,50,22,
+21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,
+34,4,7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,36,33,34,6,21,20,
+23,54,51,32,0,1,7,174,249,240,109,165,67,78,160,111,192,227,113,110,70,139,
+19,2,146,5,100,85,79,78,1,147,3,13,152,162,113,134,60,69,150,1,32,190,53,
+25,18,21,168,179,91,151,166,154,86,145,129,139,136,137,133,136,169,169,254,
+146,254,127,165,254,235,156,41,35,69,12,1,66,1,59,1,90,1,91,42,135,30,254,
+240,254,241,242,251,5,202,188,1,209,1,190,253,233,2,147,254,174,254,169,84,
+96,105,75,237,203,129,196,61,7,135,89,98,59,55,14,8,5,7,23,22,51,35,42,239,
+183,235,161,72,95,1,1,123,185,1,20,148,2,2,192,181,84,24,87,157,111,139,155,
+149,152,14,14,155,146,1,11,1,12,1,133,1,106,41,51,135,12,19,45,53,187,190,
+191,191,92,98,42,63,83,124,117,112,127,29,33,38,254,73,3,110,255,255,0,44,
+255,234,7,150,7,200,2,34,0,43,0,0,0,3,0,65,7,150,0,0,0,5,0,74,255,234,6,106,
+7,200,0,62,0,74,0,83,0,84,0,85,0,0,1,16,2,4,33,32,0,53,52,0,33,50,23,7,38,
+35,34,6,21,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,22,23,
+38,53,53,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,21,22,18,3,22,51,
+50,53,52,38,35,34,6,6,21,3,38,39,22,23,22,22,51,50,1,3,6,32,198,254,137,254,
+251,254,192,254,172,1,72,1,27,126,100,12,98,116,220,241,255,247,221,1,53,
+158,86,44,122,69,119,123,16,40,7,51,223,157,3,46,57,53,104,29,48,112,85,98,
+113,106,46,22,106,107,213,27,31,111,40,35,33,40,21,104,106,179,21,5,4,52,
+55,94,254,99,115,3,71,254,250,254,118,205,1,11,242,246,1,6,14,141,14,188,
+179,178,185,175,1,75,208,200,154,59,62,144,144,111,93,23,3,124,72,118,60,
+60,28,98,77,22,124,30,67,97,101,88,96,107,4,204,117,254,226,2,211,5,86,35,
+42,24,54,54,254,68,124,89,52,108,87,62,1,111,254,193,0,2,0,74,253,213,4,207,
+7,200,0,76,0,87,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,
+21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,
+53,52,55,6,19,22,51,50,53,52,38,35,34,6,7,2,193,254,215,254,178,96,182,235,
+183,204,5,102,89,81,81,2,147,4,158,143,19,18,46,57,53,104,29,48,112,85,98,
+113,106,46,22,88,88,254,179,188,186,127,57,254,238,216,186,43,86,106,135,
+195,82,63,34,90,120,151,165,87,36,206,27,31,111,40,35,49,44,1,22,1,6,237,
+122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,2,1,163,98,77,22,124,30,
+67,97,101,88,96,107,4,254,127,42,170,127,83,34,84,127,84,159,185,88,137,44,
+25,110,140,171,31,131,40,162,145,125,103,2,6,206,5,86,35,42,57,58,0,3,0,74,
+255,234,6,125,7,200,0,73,0,74,0,75,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,
+52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,
+18,17,16,0,33,34,4,7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,36,
+33,34,6,21,20,23,54,51,32,0,3,1,6,125,247,235,114,169,67,75,157,114,188,221,
+143,1,14,183,111,115,14,87,117,217,237,141,132,132,133,138,136,137,165,168,
+254,146,254,127,165,254,235,156,41,35,69,12,1,66,1,59,1,90,1,91,42,135,30,
+254,237,254,244,242,251,5,202,188,1,209,1,190,230,253,91,2,147,254,174,254,
+169,85,95,105,75,255,230,153,245,134,14,139,13,213,192,157,169,147,154,14,
+14,157,144,1,11,1,12,1,133,1,106,41,51,135,12,19,45,53,187,190,191,191,92,
+98,42,63,83,125,116,112,127,29,33,38,254,73,3,110,253,30,255,255,0,58,255,
+234,7,183,7,200,2,34,0,47,0,0,0,3,0,65,7,183,0,0,0,2,0,74,253,213,5,170,7,
+200,0,93,0,104,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,
+52,55,34,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,23,17,52,38,39,
+55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,21,21,33,34,14,2,21,20,22,
+51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,35,6,19,22,51,50,
+53,52,38,35,34,6,21,3,175,254,228,254,192,77,154,214,214,195,5,104,88,82,
+80,2,146,5,26,233,254,105,137,56,62,150,1,32,190,110,63,43,68,18,20,46,57,
+53,104,29,48,112,85,98,113,106,46,22,87,88,254,197,179,177,119,54,240,226,
+205,177,42,85,108,133,194,82,64,33,90,120,150,165,86,25,12,208,27,31,111,
+40,35,47,47,22,1,6,237,109,172,118,56,89,98,62,50,18,12,18,30,20,71,44,255,
+231,221,180,67,102,247,126,185,1,20,148,11,11,2,1,163,98,77,22,124,30,67,
+97,100,89,96,107,4,254,127,43,170,126,83,34,85,126,84,159,185,88,137,45,26,
+109,139,171,31,131,40,162,145,123,104,1,6,206,5,86,35,42,55,77,0,2,0,74,255,
+234,6,82,7,200,0,81,0,93,0,0,1,20,7,39,54,53,52,35,34,6,7,51,32,17,16,0,33,
+34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,
+35,34,6,21,20,4,33,50,36,54,53,52,38,35,35,53,52,54,51,51,17,52,38,39,55,
+22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,3,22,51,50,53,52,38,35,34,6,6,
+21,5,203,13,145,9,157,86,99,4,31,2,13,254,136,254,151,245,254,184,160,1,9,
+1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,200,176,1,43,1,29,201,1,8,
+122,178,198,177,179,168,3,46,57,53,104,29,48,112,85,98,113,106,46,22,76,76,
+152,27,31,111,40,35,32,38,24,3,247,48,53,23,38,23,121,99,88,254,94,254,252,
+254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,140,
+147,183,203,99,172,114,149,139,83,181,193,1,161,98,77,22,124,30,67,97,101,
+88,96,107,4,254,140,28,108,2,112,5,86,35,42,22,48,62,0,4,0,74,255,234,6,127,
+7,200,0,77,0,88,0,98,0,99,0,0,1,20,2,4,33,32,0,53,52,36,33,51,38,38,35,34,
+21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,
+39,6,6,35,34,38,53,52,38,39,39,55,22,23,38,53,53,52,38,39,55,22,23,54,51,
+50,22,21,20,6,35,34,39,21,22,18,3,22,51,50,53,52,38,35,34,6,7,3,38,39,22,
+23,22,22,51,50,54,1,6,54,200,254,127,254,243,254,203,254,159,1,39,1,7,123,
+5,99,85,157,5,145,9,155,139,168,179,225,171,187,94,1,16,240,222,1,57,165,
+87,43,120,71,116,126,16,40,7,51,216,163,3,46,57,53,104,29,48,112,85,98,113,
+106,46,22,107,107,214,27,31,111,40,35,49,44,1,103,109,176,21,5,4,52,55,47,
+71,254,53,3,50,253,254,128,203,1,31,248,191,228,90,97,121,19,24,24,50,35,
+114,124,192,182,83,64,125,97,180,207,166,1,67,214,207,157,57,63,141,147,111,
+93,23,3,124,68,122,60,60,28,98,77,22,124,30,67,97,101,88,96,107,4,204,121,
+254,221,2,220,5,86,35,42,57,58,254,50,127,87,52,108,87,62,44,1,67,0,4,0,74,
+255,234,6,161,7,200,0,89,0,99,0,100,0,101,0,0,1,20,2,6,35,34,38,38,53,52,
+54,55,54,54,53,52,38,35,34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,
+52,18,36,51,50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,18,53,16,0,33,32,5,39,
+54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,36,33,34,6,21,20,23,54,51,32,
+0,1,22,51,50,54,53,52,38,35,34,1,1,6,161,134,243,160,97,127,54,27,38,34,24,
+172,154,136,206,113,21,136,165,120,143,154,143,129,201,108,148,1,25,185,219,
+250,17,26,32,31,22,72,64,104,173,100,254,130,254,130,254,182,254,229,41,10,
+110,12,1,67,1,59,1,93,1,93,42,135,30,254,235,254,241,240,254,5,192,184,1,
+212,1,213,250,144,73,131,80,72,68,58,123,1,30,1,81,2,197,209,254,174,184,
+77,117,67,53,98,90,80,102,52,134,148,119,223,148,109,71,153,137,105,124,135,
+136,243,146,186,1,33,159,222,180,52,95,76,76,74,76,37,66,64,153,1,20,156,
+1,97,1,97,97,135,4,31,45,54,189,188,191,191,92,98,42,63,83,125,116,110,129,
+29,33,38,254,93,252,98,92,59,57,49,61,3,144,2,226,0,2,0,62,255,234,7,186,
+7,200,0,99,0,110,0,0,1,16,0,33,34,39,55,22,51,50,54,53,52,2,35,34,6,7,54,
+51,50,22,21,20,6,4,35,32,0,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,
+20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,52,35,
+34,6,7,39,18,0,51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,
+17,22,18,3,22,51,50,53,52,38,35,34,6,7,7,108,254,201,254,246,56,56,9,27,57,
+217,225,200,175,156,204,55,40,54,113,128,137,254,242,193,254,241,254,191,
+84,82,72,99,32,2,81,5,99,85,81,76,1,147,3,155,139,166,181,106,152,147,98,
+50,235,209,216,234,98,32,43,28,146,51,1,52,224,96,78,46,57,53,104,29,48,112,
+85,98,113,106,46,22,102,107,209,27,31,111,40,35,49,44,1,2,121,254,212,254,
+174,6,138,3,255,242,217,1,3,199,196,18,145,133,137,219,120,1,15,224,105,169,
+56,6,135,90,97,61,53,14,8,5,7,12,33,114,124,190,184,83,35,77,110,81,171,199,
+180,164,129,13,23,45,1,68,1,68,26,1,187,98,77,22,124,30,67,97,100,89,96,107,
+4,254,64,79,254,242,3,145,5,86,35,42,57,58,0,4,0,79,255,234,6,132,7,200,0,
+97,0,108,0,109,0,110,0,0,1,20,2,4,33,34,36,2,53,52,18,51,50,22,22,21,20,7,
+6,21,20,51,50,55,6,35,34,38,53,52,54,51,50,30,2,21,20,6,35,34,38,53,52,55,
+54,53,52,35,34,6,21,16,0,33,50,36,54,54,53,52,2,36,35,34,4,7,39,55,54,55,
+38,53,52,36,33,32,4,21,20,7,39,54,53,52,36,33,34,6,6,21,20,23,54,51,32,4,
+18,5,38,38,35,34,6,21,20,22,51,50,3,19,6,132,202,254,130,254,247,227,254,
+179,180,204,164,65,81,29,10,11,231,218,41,77,103,110,126,142,127,57,103,86,
+49,219,187,183,193,10,9,59,83,107,1,55,1,30,178,1,13,166,77,173,254,177,219,
+178,254,230,164,40,52,26,26,15,1,65,1,59,1,89,1,89,42,135,30,254,239,254,
+245,150,219,123,6,199,226,1,8,1,145,213,253,195,11,81,62,62,60,61,53,92,157,
+127,3,4,239,254,148,191,163,1,61,215,235,1,15,53,72,35,37,70,71,52,186,170,
+47,121,104,100,128,36,80,130,87,172,205,166,147,43,64,63,21,71,195,162,254,
+242,254,219,104,183,230,132,205,1,29,147,48,55,137,15,8,7,48,60,187,190,191,
+191,92,98,42,63,83,125,116,43,102,94,32,36,44,180,254,161,127,74,79,51,46,
+47,52,1,146,2,226,0,4,0,83,255,234,6,191,7,200,0,124,0,135,0,136,0,137,0,
+0,1,16,0,33,34,39,39,54,53,52,38,35,34,6,21,20,23,7,6,35,34,0,17,52,18,54,
+51,50,22,21,20,7,6,21,20,51,50,55,6,35,34,38,53,52,54,51,50,22,21,20,6,35,
+34,38,38,53,52,55,54,53,52,35,34,6,6,21,20,18,51,51,22,51,50,55,38,53,52,
+54,51,51,50,22,21,20,7,51,50,18,17,16,0,33,34,4,7,39,55,38,53,52,36,33,32,
+4,21,20,7,39,54,53,52,36,33,34,14,3,21,20,23,54,51,32,0,5,38,38,35,34,6,21,
+20,22,51,50,3,19,6,191,254,219,254,237,140,73,14,89,80,78,79,81,89,14,77,
+87,244,254,225,98,178,108,86,91,10,11,231,218,41,77,103,110,126,142,127,131,
+164,219,187,134,169,73,10,9,60,50,97,58,199,175,10,1,2,3,4,69,150,142,27,
+138,151,69,58,204,215,254,140,254,145,183,254,201,164,37,111,16,1,67,1,68,
+1,95,1,102,42,135,30,254,230,254,235,118,177,115,64,29,7,205,247,1,162,1,
+212,253,158,11,81,62,58,64,61,53,92,179,127,2,198,254,169,254,124,23,135,
+23,75,52,53,54,51,75,23,135,24,1,82,1,41,173,1,0,137,91,69,37,70,71,52,186,
+170,47,121,104,100,128,174,159,172,205,86,140,87,43,64,63,21,71,105,195,124,
+236,254,244,1,1,57,89,97,104,104,97,88,58,1,55,1,31,1,90,1,94,50,58,136,33,
+51,60,188,189,188,194,92,98,42,63,83,126,115,24,43,57,66,49,38,33,47,254,
+81,227,74,79,48,49,47,52,1,146,2,226,0,2,0,74,255,234,6,126,7,200,0,85,0,
+97,0,0,1,20,7,39,54,53,52,35,34,6,7,51,32,4,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,
+51,50,54,53,52,38,38,35,35,53,52,54,51,51,22,51,17,52,38,39,55,22,23,54,51,
+50,22,21,20,6,35,34,39,17,22,22,3,22,51,50,53,52,38,35,34,6,6,21,5,218,14,
+144,9,157,86,99,4,23,1,29,1,21,223,186,112,167,69,75,158,115,188,221,140,
+1,5,174,61,37,11,28,51,203,230,141,132,132,133,138,136,138,129,135,105,223,
+198,55,179,167,17,8,8,46,57,53,104,29,48,112,85,98,113,106,46,22,61,62,123,
+27,31,111,40,35,32,38,24,3,247,44,57,23,38,23,121,99,88,245,242,220,247,83,
+97,104,76,255,230,152,246,134,6,139,5,217,188,157,169,147,154,14,14,158,143,
+162,160,145,145,61,84,181,192,1,1,162,98,77,22,124,30,67,97,100,89,96,107,
+4,254,128,30,103,2,121,5,86,35,42,22,48,62,255,255,0,74,255,234,5,121,7,200,
+2,34,0,56,0,0,0,3,0,65,3,129,0,0,0,2,0,74,254,94,6,208,7,200,0,70,0,82,0,
+0,1,20,6,35,34,38,53,52,55,33,53,33,21,33,6,21,20,51,50,54,53,52,36,33,32,
+0,17,16,0,33,32,0,53,52,39,55,22,21,20,2,4,35,32,0,17,16,18,36,33,50,23,17,
+52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,3,22,51,50,53,52,
+38,35,34,6,6,21,6,121,230,207,176,179,11,254,202,2,252,254,213,16,203,139,
+146,254,255,254,255,254,146,254,117,1,102,1,68,1,29,1,76,5,147,7,190,254,
+160,221,254,102,254,83,220,1,158,1,20,190,144,46,57,53,104,29,48,112,85,98,
+113,106,46,22,99,101,200,27,31,111,40,35,32,38,24,3,8,173,203,142,139,35,
+36,137,137,30,38,143,122,111,173,167,254,128,254,166,254,200,254,170,1,17,
+250,33,46,8,38,50,206,254,209,161,1,165,1,129,1,7,1,138,209,44,1,205,98,77,
+22,124,30,67,97,101,88,96,107,4,254,57,61,190,3,54,5,86,35,42,22,48,62,0,
+2,0,74,255,234,6,54,7,200,0,76,0,77,0,0,1,20,2,4,33,34,36,38,53,52,54,54,
+51,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,6,6,21,20,4,
+51,50,36,18,53,16,0,33,34,4,7,39,55,38,53,52,36,33,32,4,21,20,7,39,54,53,
+52,36,33,34,6,21,20,23,54,51,32,4,18,1,6,54,193,254,129,254,232,205,254,213,
+156,132,250,214,127,5,100,85,157,6,145,9,155,139,166,180,254,246,175,185,
+92,1,15,239,229,1,59,158,254,138,254,186,169,254,242,151,41,98,12,1,54,1,
+51,1,80,1,84,42,135,30,254,249,254,249,231,242,5,193,201,1,5,1,133,203,253,
+229,3,0,240,254,153,191,131,241,163,125,190,104,89,98,121,19,24,24,50,35,
+114,124,191,183,83,65,125,96,181,206,153,1,38,197,1,57,1,73,42,50,135,30,
+45,54,184,193,192,190,92,98,42,63,83,120,121,112,127,29,32,37,185,254,160,
+3,208,0,3,0,78,255,234,7,86,7,200,0,83,0,95,0,108,0,0,1,20,0,7,39,54,53,52,
+39,38,53,52,54,51,50,23,53,52,38,35,34,6,7,54,51,50,22,21,20,6,6,35,32,0,
+17,52,18,36,51,50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,
+0,51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,18,3,22,
+51,50,53,52,38,35,34,6,6,21,3,54,55,38,35,34,6,21,20,23,22,21,20,7,8,254,
+226,255,51,46,16,17,139,112,98,76,211,170,170,201,57,47,47,112,129,123,238,
+161,254,241,254,211,145,1,21,185,55,47,8,41,47,230,229,217,201,173,199,97,
+31,44,28,146,52,1,50,249,89,80,46,57,53,104,29,48,112,85,98,113,106,46,22,
+101,108,209,27,31,111,40,35,32,38,24,214,208,45,65,80,58,61,8,8,2,141,249,
+254,163,75,126,14,59,41,84,85,45,122,130,48,19,208,244,202,194,19,145,131,
+136,218,124,1,75,1,41,195,1,37,160,6,138,3,254,253,254,254,222,250,182,153,
+138,14,22,45,1,64,1,72,24,1,185,98,77,22,124,30,67,97,100,89,96,107,4,254,
+67,77,254,252,3,130,5,86,35,42,22,48,62,249,223,114,207,53,68,64,27,57,56,
+46,27,0,4,0,74,255,234,6,82,7,200,0,93,0,104,0,115,0,129,0,0,1,20,7,22,22,
+21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,
+50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,39,6,7,22,21,20,6,35,34,38,
+38,53,52,54,54,51,51,50,54,55,38,35,35,53,52,54,51,51,17,52,38,39,55,22,23,
+54,51,50,22,21,20,6,35,34,39,17,22,22,3,22,51,50,53,52,38,35,34,6,7,1,50,
+23,54,53,52,38,35,34,6,7,19,6,35,35,34,6,21,20,22,51,50,54,53,52,5,200,44,
+54,54,254,136,254,151,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,
+140,167,179,176,200,176,1,43,1,29,201,1,8,122,53,79,108,27,190,192,132,171,
+79,75,148,132,94,140,167,57,79,133,177,176,162,12,46,57,53,104,29,48,112,
+85,98,113,106,46,22,74,75,149,27,31,111,40,35,49,44,1,254,200,180,119,16,
+83,74,86,99,4,34,69,102,102,114,78,123,125,119,119,3,212,95,79,52,146,94,
+254,252,254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,
+181,83,140,147,183,203,99,172,114,116,66,72,35,49,60,115,109,55,98,68,78,
+82,39,50,46,30,83,181,193,1,161,98,77,22,124,30,67,97,101,88,96,107,4,254,
+136,31,124,2,135,5,86,35,42,57,58,252,193,50,37,44,76,80,99,88,254,134,10,
+38,42,48,38,41,60,44,0,2,0,62,255,234,6,151,7,200,0,107,0,118,0,0,1,20,7,
+39,54,53,52,35,34,6,7,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,
+35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,38,35,35,
+53,52,54,51,51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,
+22,22,3,22,51,50,53,52,38,35,34,6,7,5,250,14,144,9,157,86,99,4,17,181,253,
+127,223,186,113,168,67,76,161,112,189,230,117,113,56,160,40,2,104,5,100,85,
+81,76,1,147,3,155,139,167,179,39,147,162,152,84,145,130,136,138,137,135,140,
+129,135,114,229,183,48,179,167,13,6,7,46,57,53,104,29,48,112,85,98,113,106,
+46,22,65,65,130,27,31,111,40,35,49,44,1,3,247,44,57,23,38,23,121,99,88,110,
+218,159,220,247,84,96,104,76,237,203,130,197,59,7,135,89,98,61,53,14,8,5,
+7,12,33,114,124,191,183,83,26,87,156,110,140,154,146,155,14,14,156,145,163,
+159,144,147,60,83,181,193,1,1,162,98,77,22,124,30,67,97,101,88,96,107,4,254,
+131,30,104,2,119,5,86,35,42,57,58,0,2,0,74,255,234,7,161,7,200,0,93,0,104,
+0,0,1,16,0,33,34,39,55,22,51,50,54,54,53,52,2,35,34,6,7,54,51,50,22,21,20,
+6,4,35,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,
+21,21,35,34,6,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,23,17,52,38,
+39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,18,3,22,51,50,53,52,38,35,
+34,6,7,7,83,254,201,254,246,57,54,8,44,40,150,198,94,199,176,157,203,54,44,
+49,114,128,141,254,243,190,179,254,244,146,1,9,1,1,34,5,99,85,157,9,144,14,
+155,140,167,179,176,197,179,239,205,212,237,98,32,43,28,145,49,1,52,225,96,
+78,46,57,53,104,29,48,112,85,98,113,106,46,22,102,107,209,27,31,111,40,35,
+49,44,1,2,121,254,212,254,174,6,138,3,121,222,154,215,1,5,201,193,17,146,
+132,136,221,119,126,242,169,205,212,90,97,121,23,38,23,48,54,114,124,193,
+181,83,139,152,177,205,182,162,129,13,23,45,1,65,1,71,26,1,187,98,77,22,124,
+30,67,97,101,88,96,107,4,254,64,79,254,242,3,145,5,86,35,42,57,58,0,4,0,68,
+254,79,6,24,7,200,0,72,0,84,0,100,0,101,0,0,1,21,33,32,4,7,22,22,51,50,54,
+55,23,2,33,34,36,39,6,17,20,0,33,32,36,53,52,39,55,22,21,20,0,33,34,36,2,
+53,52,18,55,55,38,53,52,54,51,50,23,54,54,51,51,17,52,38,39,55,22,23,54,51,
+50,22,21,20,6,35,34,39,17,22,22,3,22,51,50,53,52,38,35,34,6,6,21,1,54,36,
+51,51,38,38,35,34,7,35,38,38,35,34,6,1,5,182,254,239,254,242,254,184,108,
+28,211,179,200,197,14,147,43,254,11,232,254,234,47,136,1,56,1,24,1,19,1,38,
+3,148,5,254,126,254,179,237,254,176,173,126,125,17,2,183,154,136,79,41,124,
+73,10,46,57,53,104,29,48,112,85,98,113,106,46,22,93,96,189,27,31,111,40,35,
+32,38,24,252,225,108,1,56,204,220,5,104,89,144,21,137,3,76,65,96,103,1,169,
+3,112,83,49,55,173,173,140,145,8,254,90,203,204,123,254,254,241,254,238,206,
+186,24,29,8,31,41,249,254,234,162,1,49,199,170,1,0,94,12,38,39,187,225,106,
+49,57,1,161,98,77,22,124,30,67,97,100,89,96,107,4,254,134,40,178,2,200,5,
+86,35,42,22,48,62,252,115,47,48,91,96,136,64,72,145,252,28,0,2,0,78,255,234,
+6,192,7,200,0,71,0,82,0,0,1,16,0,33,35,34,39,55,22,51,50,54,17,52,38,35,34,
+6,6,21,21,35,53,52,38,38,35,34,6,21,16,22,51,50,55,23,6,35,32,0,17,16,18,
+51,50,22,23,54,54,51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,
+39,17,22,18,3,22,51,50,53,52,38,35,34,6,7,6,114,254,244,254,255,28,38,33,
+9,18,53,203,192,164,147,88,115,54,137,62,113,82,147,164,192,203,13,57,8,59,
+39,254,254,254,245,246,211,107,162,60,59,164,114,53,48,46,57,53,104,29,48,
+112,85,98,113,106,46,22,104,105,209,27,31,111,40,35,49,44,1,2,117,254,194,
+254,179,5,139,3,241,1,14,227,254,78,137,116,70,71,122,137,71,251,230,254,
+242,241,5,139,7,1,76,1,64,1,40,1,72,94,102,103,93,12,1,173,98,77,22,124,30,
+67,97,101,88,96,107,4,254,86,77,254,229,3,134,5,86,35,42,57,58,0,4,0,44,255,
+234,10,218,7,200,0,97,0,123,0,149,0,150,0,0,1,16,0,33,34,36,39,6,6,35,34,
+39,6,6,35,34,38,39,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,
+23,54,36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,16,0,
+33,34,4,7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,38,35,34,6,6,21,
+20,23,54,51,50,4,18,1,54,36,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,
+34,4,7,54,51,50,22,5,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,
+53,52,38,35,34,6,1,10,218,254,86,254,108,198,254,242,73,35,148,107,193,108,
+50,136,101,149,179,1,26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,94,
+135,35,153,1,68,227,172,144,74,111,167,179,248,177,186,89,1,5,230,217,1,46,
+156,254,152,254,197,156,254,250,151,41,47,51,11,1,43,1,40,1,67,1,73,42,135,
+30,251,251,149,201,101,5,190,183,252,1,121,198,250,122,57,1,2,188,145,5,99,
+85,157,5,144,10,10,102,101,213,254,192,140,101,136,173,238,252,222,89,134,
+63,4,102,104,104,105,137,113,102,102,110,232,219,133,156,4,255,3,0,254,141,
+254,93,111,111,108,114,180,94,86,187,176,46,73,1,112,184,157,66,71,30,45,
+39,29,82,78,121,135,102,96,123,116,40,40,193,181,83,69,126,91,180,207,150,
+1,36,202,1,57,1,73,41,47,135,15,14,41,55,179,198,198,184,92,98,42,63,83,120,
+121,51,104,84,27,32,35,183,254,159,254,189,117,121,90,97,121,19,24,24,42,
+43,45,31,22,109,122,36,113,79,101,187,23,33,139,120,146,155,14,22,135,158,
+133,134,188,200,27,4,216,0,6,0,44,255,234,11,34,7,200,0,112,0,123,0,149,0,
+161,0,187,0,201,0,0,1,20,7,22,22,21,16,0,33,34,36,39,6,6,35,34,39,6,6,35,
+34,38,39,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,
+51,50,23,54,51,50,22,21,21,35,34,6,21,20,4,33,32,36,53,52,39,6,7,22,21,20,
+6,35,34,38,53,52,54,54,51,51,50,54,55,38,35,35,53,52,54,51,51,17,52,38,39,
+55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,3,22,51,50,53,52,38,35,34,
+6,21,1,54,51,50,22,23,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,
+34,4,5,50,22,23,54,53,52,38,35,34,6,7,5,6,7,51,6,21,20,22,51,50,54,53,53,
+51,21,20,22,51,50,54,53,52,38,35,34,6,5,6,35,35,34,6,21,20,22,51,50,54,53,
+52,10,151,44,54,55,254,135,254,151,229,254,198,86,36,149,107,193,108,50,136,
+101,149,179,1,26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,94,135,35,
+153,1,68,227,119,100,57,74,167,179,176,200,176,1,43,1,29,1,30,1,45,53,77,
+110,28,191,192,189,193,80,147,128,95,140,167,56,78,133,177,176,162,12,46,
+57,53,104,29,48,112,85,98,113,106,46,22,74,74,148,27,31,111,40,35,47,47,248,
+136,101,136,170,235,64,47,236,190,32,5,100,85,157,10,145,13,17,30,30,213,
+254,192,5,180,90,149,59,17,82,75,85,100,5,249,70,89,134,63,4,102,104,104,
+105,137,113,102,102,110,232,219,133,156,6,145,69,102,102,112,79,122,125,120,
+118,3,212,93,81,53,146,93,254,251,254,237,114,114,114,114,180,94,86,187,176,
+46,73,1,112,184,157,66,71,30,45,39,29,82,78,121,135,102,96,123,116,18,18,
+193,181,83,140,147,183,203,202,183,116,66,70,36,52,58,115,109,113,108,80,
+82,37,49,47,30,83,181,193,1,161,98,77,22,124,30,67,97,100,89,96,107,4,254,
+136,31,124,2,135,5,86,35,42,55,77,252,161,36,112,112,118,119,89,98,121,30,
+31,23,53,49,54,42,2,109,73,25,25,42,39,73,83,98,89,205,101,187,23,33,139,
+120,146,155,14,22,135,158,133,134,188,200,27,198,10,37,43,48,38,41,60,44,
+0,4,0,78,255,234,10,8,7,200,0,103,0,116,0,117,0,118,0,0,1,16,2,35,34,38,39,
+6,6,35,34,38,39,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,2,17,20,22,51,
+50,54,53,52,35,34,6,7,39,18,0,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,
+53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,55,38,53,52,36,33,32,4,
+21,20,7,39,54,53,52,36,33,34,6,21,20,23,54,51,32,0,1,54,51,50,23,54,36,55,
+38,38,35,34,6,1,1,10,8,241,229,109,163,67,71,155,113,119,172,44,57,221,157,
+254,241,254,211,145,1,21,185,55,47,8,41,47,230,229,217,201,173,199,97,31,
+44,28,146,47,1,55,241,133,248,143,100,36,36,218,237,136,127,125,130,137,131,
+134,157,164,254,158,254,138,158,254,243,155,41,22,83,12,1,56,1,49,1,78,1,
+83,42,135,30,254,250,254,251,233,240,5,188,186,1,197,1,178,249,59,44,52,93,
+52,58,1,16,198,83,156,91,173,215,4,111,254,255,2,147,254,175,254,168,82,98,
+102,78,113,106,108,111,1,75,1,41,195,1,37,160,6,138,3,254,253,254,254,222,
+250,182,153,138,14,22,45,1,66,1,70,113,139,150,3,213,192,157,169,145,156,
+14,14,157,144,1,9,1,14,1,132,1,107,40,52,135,8,23,45,53,184,193,194,188,92,
+98,42,63,83,120,121,114,125,28,33,37,254,73,254,110,20,57,154,159,2,66,58,
+203,4,57,251,146,0,2,0,74,255,234,7,67,7,200,0,99,0,100,0,0,1,20,2,4,33,34,
+36,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,55,6,
+6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,14,3,21,20,
+22,51,32,0,17,16,0,33,34,4,7,39,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,
+36,33,34,6,6,21,20,23,54,51,32,4,18,1,7,67,198,254,129,254,238,209,254,222,
+141,96,98,72,110,29,2,208,5,100,85,81,76,1,146,3,18,178,188,113,134,63,66,
+151,1,33,188,33,44,46,40,166,181,177,131,156,111,77,46,255,235,1,89,1,100,
+254,138,254,186,169,254,242,151,41,98,12,1,54,1,51,1,80,1,84,42,135,30,254,
+249,254,249,148,210,115,5,193,201,1,5,1,133,203,253,160,3,0,246,254,153,185,
+127,219,140,112,175,54,8,135,89,98,61,53,13,7,7,7,23,22,56,43,32,250,195,
+234,161,73,104,245,127,186,1,20,146,7,7,190,184,83,16,48,72,106,79,166,186,
+1,85,1,47,1,57,1,73,42,50,135,30,45,54,184,193,192,190,92,98,42,63,83,120,
+121,46,104,89,29,32,37,185,254,160,3,208,0,5,0,78,255,234,7,240,7,200,0,88,
+0,100,0,110,0,111,0,112,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,38,
+35,34,0,21,20,23,7,38,53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,
+20,22,51,50,54,54,53,16,39,6,6,35,34,38,53,52,38,39,34,39,55,4,23,38,53,53,
+52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,21,22,18,3,22,51,50,53,52,
+38,35,34,6,6,21,3,38,39,22,23,22,22,51,50,54,1,1,7,192,251,236,112,167,69,
+74,158,116,188,221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,168,144,41,
+187,211,141,132,134,132,137,136,137,116,149,73,168,41,135,79,119,123,18,37,
+2,3,53,1,17,178,2,46,57,53,104,29,48,112,85,98,113,106,46,22,119,120,239,
+27,31,111,40,35,32,38,24,171,116,180,22,5,4,52,55,51,75,254,44,254,102,2,
+128,254,184,254,178,83,97,103,77,255,230,182,244,44,3,254,253,232,186,155,
+49,191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,14,14,157,144,115,229,
+175,1,99,226,72,81,144,144,113,90,23,2,126,90,142,35,87,68,98,77,22,124,30,
+67,97,101,88,96,107,4,254,140,254,157,3,97,5,86,35,42,22,48,62,254,87,112,
+84,49,113,87,62,53,1,58,254,193,0,6,0,44,255,234,10,139,7,200,0,88,0,99,0,
+109,0,121,0,138,0,139,0,0,1,16,2,4,33,34,36,39,6,6,35,34,36,53,53,7,39,0,
+55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,4,23,7,6,6,21,
+20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,22,23,38,53,53,
+52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,21,22,18,3,22,51,50,53,52,
+38,35,34,6,21,3,38,39,22,23,22,22,51,50,54,1,54,54,55,38,35,32,7,54,51,50,
+22,5,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,1,10,65,188,254,149,254,
+255,213,254,230,70,58,247,189,240,254,242,74,130,1,5,190,39,111,59,70,10,
+12,143,27,147,128,184,77,149,1,36,156,169,1,48,112,56,202,201,246,237,211,
+1,40,154,86,42,122,71,119,123,19,35,9,51,223,157,3,46,57,53,104,29,48,112,
+85,98,113,106,46,22,106,107,213,27,31,111,40,35,47,47,103,109,178,22,5,4,
+52,55,48,71,251,238,44,178,135,178,225,254,223,255,88,109,141,196,253,71,
+88,71,70,12,194,186,208,206,191,178,90,150,4,222,3,71,254,250,254,119,206,
+121,122,122,121,215,203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,
+135,187,119,109,136,124,143,17,182,165,177,186,172,1,75,211,201,154,57,65,
+144,144,124,82,21,3,124,72,118,59,61,28,98,77,22,124,30,67,97,101,88,96,107,
+4,204,117,254,226,2,211,5,86,35,42,55,77,254,69,126,87,49,112,87,62,45,253,
+241,100,124,23,143,223,28,98,102,102,98,5,44,56,143,147,177,164,154,160,27,
+3,53,0,4,0,44,255,234,10,87,7,200,0,90,0,115,0,132,0,133,0,0,1,16,0,33,34,
+36,39,6,6,35,34,36,53,53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,
+50,23,54,36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,51,32,0,17,16,0,
+33,34,4,7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,38,35,34,6,21,
+20,23,54,51,50,4,18,1,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,
+32,5,54,51,50,22,5,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,1,10,87,254,
+86,254,108,209,254,233,70,57,250,194,240,254,242,74,130,1,5,190,39,111,59,
+70,10,12,143,27,147,128,184,77,149,1,36,156,160,130,76,114,166,180,248,177,
+186,89,1,5,230,1,75,1,88,254,152,254,197,156,254,250,151,41,47,51,11,1,43,
+1,40,1,67,1,73,42,135,30,251,251,222,229,5,190,183,252,1,121,198,250,134,
+60,246,185,145,5,99,85,157,5,144,10,9,95,109,254,223,255,0,88,110,146,201,
+253,61,88,71,70,12,194,186,208,206,191,178,90,150,4,159,3,0,254,141,254,93,
+124,125,125,124,215,203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,
+135,187,119,109,43,43,191,183,83,69,126,91,180,207,1,84,1,48,1,57,1,73,41,
+47,135,15,14,41,55,179,198,198,184,92,98,42,63,83,120,121,114,125,27,32,35,
+183,254,159,254,217,105,105,90,97,121,19,24,24,42,43,40,33,25,223,28,99,101,
+102,98,5,44,56,143,147,177,164,154,160,27,4,216,0,3,0,78,255,234,7,187,7,
+200,0,85,0,86,0,87,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,38,35,
+34,0,21,20,23,7,38,53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,
+22,51,50,18,17,16,0,33,34,4,7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,
+53,52,36,33,34,6,6,21,20,23,54,51,32,4,18,1,1,7,187,247,235,114,169,67,75,
+157,114,188,221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,168,144,41,187,
+211,141,132,134,132,137,136,137,165,168,254,146,254,127,165,254,235,156,41,
+35,69,12,1,66,1,59,1,90,1,91,42,135,30,254,237,254,244,157,219,117,5,202,
+188,1,50,1,146,203,253,80,254,30,2,147,254,174,254,169,85,95,105,75,255,230,
+182,244,44,3,254,253,232,186,155,49,191,207,1,26,1,67,64,138,4,218,184,156,
+170,149,152,14,14,157,144,1,11,1,12,1,133,1,106,41,51,135,12,19,45,53,187,
+190,191,191,92,98,42,63,83,125,116,47,104,88,29,33,38,189,254,116,4,0,253,
+30,0,2,0,74,255,234,7,67,7,200,0,92,0,93,0,0,1,20,2,4,33,32,0,53,52,54,54,
+51,51,38,38,35,34,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,38,53,52,18,36,
+51,50,23,54,51,50,22,21,21,33,34,6,6,21,20,4,51,50,36,18,53,16,0,33,34,4,
+7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,36,33,34,6,21,20,23,54,
+51,32,4,18,1,7,67,193,254,129,254,232,254,204,254,160,128,251,217,127,5,100,
+85,157,6,145,9,20,177,190,113,134,63,66,151,1,33,188,40,41,38,44,166,181,
+254,245,175,185,92,1,16,239,228,1,58,159,254,138,254,186,169,254,242,151,
+41,48,51,12,1,54,1,51,1,80,1,84,42,135,30,254,249,254,249,231,242,5,193,200,
+1,5,1,133,203,253,160,3,0,240,254,153,191,1,30,249,124,188,107,89,98,121,
+19,24,24,50,35,57,42,32,250,195,234,161,73,104,245,127,186,1,20,146,8,8,190,
+184,83,65,125,96,181,206,152,1,36,200,1,57,1,73,42,50,135,17,13,46,53,184,
+193,192,190,92,98,42,63,83,120,121,112,127,29,32,37,185,254,160,3,208,0,6,
+0,58,255,234,10,170,7,200,0,91,0,102,0,112,0,124,0,138,0,139,0,0,1,16,2,4,
+33,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,
+7,38,53,52,54,51,50,23,54,36,51,32,1,7,4,17,20,22,51,50,36,18,53,52,39,6,
+6,35,34,38,53,52,38,39,39,55,22,23,38,53,53,52,38,39,55,22,23,54,51,50,22,
+21,20,6,35,34,39,21,22,18,3,22,51,50,53,52,38,35,34,6,21,3,38,39,22,23,22,
+22,51,50,54,1,54,51,50,22,23,54,54,55,38,35,32,3,6,6,7,22,22,51,50,54,53,
+52,38,35,34,1,10,96,188,254,149,254,255,214,254,228,69,59,255,0,196,254,211,
+254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,
+192,69,99,1,11,156,1,81,1,10,56,254,109,246,237,211,1,40,154,86,42,122,71,
+119,123,19,35,9,51,223,157,3,46,57,53,104,29,48,112,85,98,113,106,46,22,106,
+107,213,27,31,111,40,35,47,47,103,109,178,22,5,4,52,55,48,71,250,7,49,46,
+142,197,56,44,178,133,177,233,254,246,216,55,223,193,65,247,200,208,225,194,
+175,67,4,58,3,71,254,250,254,119,206,123,123,123,123,1,66,1,59,24,32,36,1,
+17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,200,118,123,254,252,
+143,33,254,181,177,186,172,1,75,211,201,154,57,65,144,144,124,82,21,3,124,
+72,118,59,61,28,98,77,22,124,30,67,97,101,88,96,107,4,204,117,254,226,2,211,
+5,86,35,42,55,77,254,69,126,87,49,112,87,62,45,254,173,7,95,94,97,120,24,
+143,254,173,171,169,5,156,150,184,166,149,156,3,26,0,4,0,58,253,213,9,10,
+7,200,0,99,0,110,0,138,0,152,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,
+62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,
+55,54,54,51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,
+22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,
+38,53,52,55,35,6,19,22,51,50,53,52,38,35,34,6,7,1,54,51,50,22,23,62,2,51,
+51,38,38,35,34,6,21,20,23,7,38,53,53,38,38,35,34,6,7,6,6,7,22,22,51,50,54,
+53,52,38,35,34,7,16,195,254,245,64,59,255,0,197,254,211,254,149,48,146,5,
+9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,96,130,35,99,1,11,
+156,215,174,10,37,112,88,18,20,46,57,53,104,29,48,112,85,98,113,106,46,22,
+88,88,254,197,178,176,122,54,240,226,205,177,42,89,105,132,194,82,64,33,88,
+122,150,165,86,25,11,207,27,31,111,40,35,49,44,1,251,34,49,46,149,202,54,
+42,153,221,185,175,5,102,89,83,80,3,147,4,78,165,103,127,211,132,55,223,193,
+65,247,200,208,225,194,175,67,22,126,122,124,124,1,66,1,59,24,32,36,1,17,
+55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,100,100,118,123,93,11,41,
+41,2,1,163,98,77,22,124,30,67,97,101,88,96,107,4,254,127,42,170,127,83,34,
+85,126,84,159,185,88,137,47,25,108,139,171,31,131,40,162,145,123,104,1,6,
+206,5,86,35,42,57,58,252,173,7,104,104,73,99,49,88,99,62,50,18,12,18,29,21,
+20,44,41,101,238,171,169,5,156,150,184,166,149,156,0,4,0,58,255,234,10,194,
+7,200,0,104,0,116,0,130,0,131,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,
+35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,
+51,50,23,54,36,51,50,4,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,
+18,17,16,0,33,34,4,7,39,54,55,38,53,52,36,33,32,4,21,20,7,39,54,53,52,36,
+33,34,6,6,21,20,23,54,51,32,0,5,54,51,50,22,23,54,54,55,38,35,32,3,6,6,7,
+22,22,51,50,54,53,52,38,35,34,1,10,194,241,229,109,164,67,72,154,112,121,
+171,44,63,250,187,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,
+67,10,12,143,27,147,128,192,69,99,1,11,156,168,1,46,133,61,189,209,136,127,
+124,131,137,131,134,158,163,254,158,254,138,158,254,244,155,41,22,83,12,1,
+55,1,50,1,78,1,83,42,135,30,254,250,254,251,148,209,116,5,188,185,1,197,1,
+178,248,75,49,46,146,201,55,48,174,126,177,233,254,246,216,55,223,193,65,
+247,200,208,225,194,175,67,4,35,2,147,254,175,254,168,83,97,104,76,116,108,
+112,112,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,
+121,135,200,118,123,130,130,140,11,218,175,157,169,143,158,14,14,157,144,
+1,11,1,12,1,132,1,107,41,51,135,8,23,45,53,182,195,194,188,92,98,42,63,83,
+120,121,47,104,88,28,33,37,254,73,202,7,101,101,104,127,23,143,254,173,171,
+169,5,156,150,184,166,149,156,4,189,0,4,0,58,255,234,10,118,7,200,0,97,0,
+122,0,136,0,137,0,0,1,16,0,33,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,
+55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,
+51,50,22,21,21,35,34,6,6,21,20,4,51,32,0,17,16,0,33,34,4,7,39,54,55,38,53,
+52,36,33,50,4,22,21,20,7,39,54,53,52,38,35,34,6,21,20,23,54,51,50,4,18,5,
+54,51,50,22,23,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,3,
+6,6,7,22,22,51,50,54,53,52,38,35,34,1,10,118,254,86,254,108,212,254,231,69,
+58,254,254,200,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,
+10,12,143,27,147,128,96,130,35,99,1,11,156,158,138,75,127,166,180,248,177,
+186,89,1,5,230,1,75,1,88,254,152,254,197,156,254,250,151,41,47,51,11,1,43,
+1,40,217,1,35,144,42,135,30,251,251,222,229,5,190,183,252,1,121,198,248,151,
+49,46,145,200,55,60,251,180,146,5,100,85,157,5,144,10,8,97,124,253,217,55,
+223,193,65,247,200,208,225,194,175,67,4,35,3,0,254,141,254,93,128,129,129,
+128,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,
+135,100,100,118,123,51,51,191,183,83,69,126,91,180,207,1,84,1,48,1,57,1,73,
+41,47,135,15,14,41,55,179,198,90,172,120,92,98,42,63,83,120,121,114,125,27,
+32,35,183,254,159,105,7,100,99,104,108,90,97,121,19,24,24,54,31,41,26,31,
+254,173,171,169,5,156,150,184,166,149,156,4,189,0,3,0,15,255,234,5,34,7,200,
+0,92,0,103,0,104,0,0,1,20,7,39,54,53,52,38,35,34,6,7,22,18,21,20,6,35,34,
+38,39,38,39,6,7,39,62,2,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,22,21,20,6,6,7,6,7,22,23,30,2,51,50,54,53,52,38,39,53,52,54,55,17,52,38,
+39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,3,22,51,50,53,52,38,35,
+34,6,7,3,4,172,13,145,10,61,63,65,81,8,208,229,239,214,112,203,138,47,44,
+26,16,146,2,42,73,80,79,70,39,66,60,57,60,8,144,13,146,118,127,151,45,85,
+97,31,26,37,117,82,86,100,57,148,157,221,212,138,126,46,57,53,104,29,48,112,
+85,98,113,106,46,22,84,85,169,27,31,111,40,35,49,44,1,90,3,247,48,53,23,31,
+30,63,58,93,94,30,254,255,202,225,240,66,88,30,15,62,126,30,65,139,142,130,
+129,134,134,61,82,84,63,54,32,33,23,42,60,111,127,156,137,79,169,158,151,
+49,48,12,64,46,38,23,159,155,171,188,4,31,206,198,15,1,164,98,77,22,124,30,
+67,97,101,88,96,107,4,254,152,20,115,2,99,5,86,35,42,57,58,254,3,0,4,0,74,
+254,42,10,148,7,200,0,120,0,131,0,158,0,184,0,0,5,34,38,39,6,6,35,34,39,6,
+6,35,34,38,39,7,39,0,55,38,38,35,34,6,21,20,23,7,38,38,53,53,52,55,6,21,20,
+22,23,7,38,38,53,52,0,55,54,51,50,22,23,54,36,51,50,22,23,54,54,51,50,23,
+17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,21,21,33,34,14,
+2,21,20,22,51,50,55,23,7,22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,50,
+54,53,52,39,52,39,6,19,22,51,50,53,52,38,35,34,6,21,1,54,51,50,22,23,54,36,
+33,51,38,38,35,34,6,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,22,
+51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,8,154,182,252,70,37,
+146,104,193,107,52,135,100,150,179,1,26,130,1,1,197,20,76,56,59,70,21,143,
+9,15,1,142,69,83,132,88,82,1,15,233,15,26,105,142,36,154,1,69,225,124,192,
+95,40,108,79,18,20,46,57,53,104,29,48,112,85,98,113,106,46,22,88,88,254,197,
+178,176,122,54,240,226,205,177,43,34,9,254,250,254,253,255,0,254,250,1,149,
+181,187,188,183,2,1,112,68,27,31,111,40,35,47,47,250,61,101,135,175,240,65,
+53,1,17,1,33,174,5,102,89,83,80,3,147,4,2,157,171,212,254,192,254,217,100,
+122,62,4,102,104,104,105,137,114,102,102,110,232,220,133,156,22,106,106,105,
+107,180,95,85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,26,104,41,9,5,
+5,122,245,118,199,117,78,130,252,138,240,1,68,17,4,99,98,124,114,35,37,38,
+34,2,1,163,98,77,22,124,30,67,97,101,88,96,107,4,254,127,42,170,127,83,34,
+85,126,84,159,185,88,137,17,43,70,196,219,206,191,17,11,9,7,7,150,125,131,
+159,19,14,7,5,32,6,206,5,86,35,42,55,77,252,161,36,117,116,114,132,88,99,
+63,49,11,19,18,29,21,33,12,60,109,254,234,113,175,23,33,137,122,146,155,14,
+22,135,158,133,134,187,201,27,0,3,0,77,254,42,9,142,7,200,0,115,0,126,0,152,
+0,0,5,34,36,39,6,6,35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,
+16,0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,33,50,23,
+54,51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,21,
+21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,53,53,52,55,23,
+21,20,22,51,50,54,53,52,39,6,19,22,51,50,53,52,38,35,34,6,7,1,35,34,4,7,54,
+51,50,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,7,149,190,254,247,66,
+60,232,164,182,254,127,1,2,230,62,108,147,223,122,55,51,135,121,1,93,1,37,
+91,183,79,54,140,208,115,214,204,178,195,98,31,44,28,146,49,1,103,1,21,97,
+85,50,67,19,18,46,57,53,104,29,48,112,85,98,113,106,46,22,88,89,254,197,177,
+177,122,54,240,226,205,177,43,27,8,9,254,250,254,253,255,0,254,250,1,149,
+181,187,188,183,3,112,68,27,31,111,40,35,49,44,1,254,60,17,198,254,239,59,
+44,50,85,58,33,150,232,204,174,5,102,89,83,80,3,147,4,22,121,118,119,120,
+145,1,5,176,225,1,39,30,13,125,224,152,107,201,76,68,219,241,1,35,1,77,48,
+46,143,5,112,208,144,206,218,179,154,140,14,22,45,1,64,1,72,12,12,2,1,163,
+98,77,22,124,30,67,97,101,88,96,107,4,254,127,41,170,128,83,34,84,127,84,
+159,185,88,137,14,3,51,62,196,219,206,191,17,11,9,7,7,150,125,131,159,23,
+21,31,6,206,5,86,35,42,57,58,253,127,208,200,18,55,79,116,60,88,99,63,49,
+18,12,18,29,21,73,0,2,0,74,254,42,4,207,7,200,0,86,0,97,0,0,5,32,0,53,52,
+62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,23,17,52,38,39,55,22,
+23,54,51,50,22,21,20,6,35,34,39,17,22,22,21,21,33,34,14,2,21,20,22,51,50,
+55,23,6,7,22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,50,54,54,53,52,39,
+52,39,6,19,22,51,50,53,52,38,35,34,6,7,2,193,254,215,254,178,96,182,235,183,
+204,5,102,89,81,81,2,147,4,158,143,19,18,46,57,53,104,29,48,112,85,98,113,
+106,46,22,88,88,254,179,188,186,127,57,254,238,216,186,43,23,11,9,254,250,
+254,253,255,0,254,250,1,149,181,187,123,163,85,3,1,125,82,27,31,111,40,35,
+49,44,1,22,1,6,237,122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,2,1,
+163,98,77,22,124,30,67,97,101,88,96,107,4,254,127,42,170,127,83,34,84,127,
+84,159,185,88,137,12,5,43,70,196,219,206,191,17,11,9,7,7,150,125,55,124,111,
+11,24,6,6,34,6,206,5,86,35,42,57,58,0,2,0,74,254,42,5,170,7,200,0,100,0,111,
+0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,55,34,6,21,
+20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,23,17,52,38,39,55,22,23,54,51,
+50,22,21,20,6,35,34,39,17,22,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,
+22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,50,54,54,53,52,39,6,19,22,
+51,50,53,52,38,35,34,6,21,3,175,254,228,254,192,77,154,214,214,195,5,104,
+88,82,80,2,146,5,26,233,254,105,137,56,62,150,1,32,190,110,63,43,68,18,20,
+46,57,53,104,29,48,112,85,98,113,106,46,22,87,88,254,197,179,177,119,54,240,
+226,205,177,42,26,7,9,254,250,254,253,255,0,254,250,1,149,181,187,123,163,
+85,4,112,69,27,31,111,40,35,47,47,22,1,6,237,109,172,118,56,89,98,62,50,18,
+12,18,30,20,71,44,255,231,221,180,67,102,247,126,185,1,20,148,11,11,2,1,163,
+98,77,22,124,30,67,97,100,89,96,107,4,254,127,43,170,126,83,34,85,126,84,
+159,185,88,137,14,3,43,70,196,219,206,191,17,11,9,7,7,150,125,55,124,111,
+9,37,33,6,206,5,86,35,42,55,77,0,2,0,74,253,213,6,208,7,200,0,100,0,111,0,
+0,1,20,6,35,34,38,53,52,55,33,53,33,21,33,6,21,20,51,50,54,53,52,36,33,32,
+0,17,16,0,33,32,36,53,53,55,23,22,21,20,7,22,21,20,6,4,35,34,36,46,2,53,53,
+52,55,23,21,20,30,2,51,32,36,53,53,52,39,6,4,35,32,36,2,53,52,18,36,33,50,
+23,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,3,22,51,50,
+53,52,38,35,34,6,7,6,121,230,207,176,179,11,254,202,2,252,254,213,16,203,
+139,146,254,255,254,255,254,144,254,119,1,100,1,70,1,44,1,56,147,3,1,56,22,
+171,254,182,241,179,254,243,172,98,45,1,149,72,141,228,168,1,50,1,38,1,101,
+254,213,179,254,233,254,134,182,219,1,159,1,20,190,144,46,57,53,104,29,48,
+112,85,98,113,106,46,22,99,101,200,27,31,111,40,35,49,44,1,3,8,173,203,142,
+139,35,36,137,137,30,38,143,122,111,173,167,254,192,254,223,254,251,254,228,
+181,180,14,10,22,8,9,119,95,68,90,184,209,96,42,78,102,130,86,24,9,10,7,10,
+105,115,66,33,167,183,10,5,4,73,74,175,1,56,208,225,1,84,182,44,1,205,98,
+77,22,124,30,67,97,101,88,96,107,4,254,57,61,190,3,54,5,86,35,42,57,58,0,
+4,0,58,254,42,9,10,7,200,0,108,0,119,0,147,0,161,0,0,5,34,36,39,6,4,35,32,
+0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,
+22,23,54,36,51,50,23,55,54,54,51,50,23,17,52,38,39,55,22,23,54,51,50,22,21,
+20,6,35,34,39,17,22,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,21,20,
+4,33,32,36,53,53,52,55,23,21,20,22,51,50,54,54,53,52,39,52,39,6,19,22,51,
+50,53,52,38,35,34,6,21,1,54,51,50,22,23,62,2,51,51,38,38,35,34,6,21,20,23,
+7,38,53,53,38,38,35,34,6,7,6,6,7,22,22,51,50,54,53,52,38,35,34,7,16,195,254,
+245,64,59,255,0,197,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,
+62,67,10,12,143,27,147,128,96,130,35,99,1,11,156,215,174,10,37,112,88,18,
+20,46,57,53,104,29,48,112,85,98,113,106,46,22,88,88,254,197,178,176,122,54,
+240,226,205,177,42,26,7,9,254,250,254,253,255,0,254,250,1,149,181,187,123,
+163,85,2,1,106,62,27,31,111,40,35,47,47,251,34,49,46,149,202,54,42,153,221,
+185,175,5,102,89,83,80,3,147,4,78,165,103,127,211,132,55,223,193,65,247,200,
+208,225,194,175,67,22,126,122,124,124,1,66,1,59,24,32,36,1,17,55,105,77,133,
+120,70,67,30,45,39,29,82,78,121,135,100,100,118,123,93,11,41,41,2,1,163,98,
+77,22,124,30,67,97,101,88,96,107,4,254,127,42,170,127,83,34,85,126,84,159,
+185,88,137,14,3,43,70,196,219,206,191,17,11,9,7,7,150,125,55,124,111,19,14,
+7,5,32,6,206,5,86,35,42,55,77,252,190,7,104,104,73,99,49,88,99,62,50,18,12,
+18,29,21,20,44,41,101,238,171,169,5,156,150,184,166,149,156,0,4,0,74,254,
+15,7,140,7,200,0,118,0,129,0,139,0,140,0,0,55,38,38,53,52,18,36,51,50,23,
+54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,39,6,6,35,34,38,53,
+52,38,39,39,55,22,23,38,53,53,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,
+39,21,22,17,16,7,22,21,16,0,33,32,36,53,52,55,23,21,20,30,2,51,50,62,2,53,
+52,39,6,4,35,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,55,6,
+6,21,20,23,1,22,51,50,53,52,38,35,34,6,7,3,38,39,22,23,22,22,51,50,54,1,203,
+63,66,151,1,33,188,25,33,40,23,166,181,225,171,187,94,1,16,240,222,1,57,165,
+87,43,120,71,119,123,16,40,7,51,216,163,3,46,57,53,104,29,48,112,85,98,113,
+106,46,22,214,117,49,254,143,254,147,254,171,254,174,2,148,55,117,204,153,
+168,230,127,59,15,112,254,201,198,206,254,213,157,1,39,1,7,123,5,99,85,157,
+5,145,9,16,156,165,113,5,28,27,31,111,40,35,49,44,1,103,107,179,22,5,4,52,
+55,50,70,254,62,170,104,245,127,186,1,20,146,4,4,190,184,83,64,125,97,180,
+207,166,1,67,214,207,157,57,63,144,144,111,93,23,3,124,68,122,60,60,28,98,
+77,22,124,30,67,97,101,88,96,107,4,204,241,254,171,254,235,198,140,137,254,
+222,254,239,221,244,26,20,8,11,103,123,79,42,64,110,147,105,65,55,108,108,
+131,241,163,191,228,90,97,121,19,24,24,50,35,46,42,42,242,182,234,161,5,197,
+5,86,35,42,57,58,254,51,125,89,49,112,87,62,47,1,64,0,4,0,44,255,234,7,196,
+7,200,0,60,0,86,0,110,0,111,0,0,1,20,2,6,35,34,39,55,22,51,50,54,53,16,0,
+35,34,4,7,54,51,32,0,21,20,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,
+6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,32,0,5,6,7,51,6,21,20,22,
+51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,1,54,54,53,52,38,35,
+34,6,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,1,7,196,117,216,138,45,45,8,
+29,36,160,175,254,228,254,194,254,196,136,101,136,1,14,1,46,189,160,196,99,
+50,136,101,149,179,1,26,130,1,12,186,40,113,59,70,10,12,143,27,147,128,94,
+136,35,156,1,66,224,1,66,1,100,250,45,89,134,63,4,102,104,104,105,137,113,
+102,102,110,232,219,133,156,3,255,23,17,221,219,142,196,104,84,131,100,1,
+44,1,33,1,35,1,40,57,253,238,2,61,174,254,251,143,6,138,3,232,203,1,1,1,25,
+110,116,36,254,237,251,186,229,180,94,86,187,176,46,73,1,127,169,157,66,71,
+30,45,39,29,82,78,121,135,101,97,125,114,254,149,164,101,187,23,33,139,120,
+146,155,14,22,135,158,133,134,188,200,27,1,245,50,71,45,118,113,50,107,85,
+90,106,63,130,140,176,199,193,176,105,112,3,16,0,5,0,74,255,234,6,180,7,200,
+0,83,0,93,0,94,0,95,0,96,0,0,5,34,39,6,7,39,54,18,53,52,38,35,34,6,6,21,20,
+23,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,0,21,20,7,51,22,22,51,
+50,18,17,52,2,36,33,35,34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,38,
+38,35,32,6,21,20,22,51,51,32,4,18,17,16,2,37,22,51,50,54,53,52,38,35,34,1,
+1,19,4,254,191,51,41,87,109,135,118,194,179,136,206,113,21,136,165,120,143,
+154,143,129,201,108,151,1,20,181,250,1,13,87,40,5,60,71,124,147,150,254,205,
+254,215,209,158,143,85,1,74,1,69,1,98,1,109,16,25,136,30,133,250,178,254,
+243,249,78,145,246,1,58,1,123,194,229,251,98,73,131,77,75,67,59,121,2,129,
+254,167,85,22,170,63,107,96,147,1,7,146,168,198,119,223,148,109,71,153,137,
+105,124,135,136,243,146,189,1,32,157,254,243,226,185,175,79,80,1,25,1,22,
+228,1,57,165,48,111,87,162,163,181,201,50,84,56,42,66,80,92,103,46,86,94,
+55,51,188,254,138,254,224,254,166,254,156,230,92,57,60,48,61,6,114,253,30,
+1,43,0,3,0,78,255,234,6,244,7,200,0,59,0,81,0,82,0,0,1,16,0,33,34,39,55,22,
+51,50,54,53,52,2,35,34,6,7,54,51,50,22,21,20,6,6,35,32,0,17,52,18,36,51,50,
+23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,22,18,1,54,
+53,52,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,1,6,244,254,201,254,
+246,57,54,8,44,41,216,226,202,174,158,203,53,40,54,112,129,123,238,161,254,
+241,254,211,145,1,21,185,55,47,8,41,47,230,229,217,201,173,199,97,31,44,28,
+146,49,1,52,225,162,235,125,254,79,23,213,212,214,213,25,138,34,1,36,1,26,
+1,26,1,34,31,253,237,2,121,254,212,254,174,6,138,3,255,242,215,1,5,203,193,
+19,145,131,136,218,124,1,75,1,41,195,1,37,160,6,138,3,254,253,254,254,222,
+250,182,153,138,14,22,45,1,65,1,71,148,254,228,1,213,60,68,115,116,117,116,
+69,65,27,85,81,176,196,195,174,84,76,2,215,0,3,0,62,255,234,6,77,7,200,0,
+101,0,123,0,124,0,0,1,20,7,39,54,53,52,35,34,6,7,51,32,0,21,20,6,35,34,39,
+39,54,53,52,38,35,34,6,21,20,23,7,6,35,34,38,53,16,55,6,35,35,53,33,38,38,
+35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,3,21,20,22,51,50,
+55,38,53,52,54,51,51,50,22,21,20,7,22,51,50,54,53,52,38,38,35,35,53,52,54,
+51,50,22,37,54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,1,
+5,250,14,144,9,157,86,99,4,17,1,16,1,33,221,197,148,112,15,90,80,78,84,77,
+90,15,112,143,193,230,229,71,144,40,2,104,5,100,85,81,76,1,147,3,155,139,
+167,179,55,120,140,130,89,50,146,140,70,33,80,157,139,15,139,157,82,35,71,
+142,143,112,229,185,48,179,167,136,159,254,244,20,213,212,214,213,20,139,
+28,1,36,1,26,1,26,1,34,28,254,66,3,247,44,57,23,38,23,121,99,88,254,255,250,
+212,235,39,135,23,75,51,54,57,48,75,23,135,39,233,205,1,11,121,7,135,89,98,
+61,53,14,8,5,7,12,33,114,124,191,183,83,18,58,86,134,84,147,155,6,59,96,101,
+118,119,104,91,59,7,155,156,141,158,72,83,181,193,121,166,52,68,115,116,117,
+116,65,53,24,72,75,176,196,195,174,81,69,2,205,0,5,0,52,255,234,6,206,7,200,
+0,96,0,107,0,108,0,109,0,110,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,
+55,55,62,2,53,52,38,35,35,22,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,
+6,6,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,38,36,35,35,
+34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,32,6,21,20,22,51,51,
+32,4,18,37,6,6,21,20,22,51,50,54,53,52,1,1,3,6,206,247,235,114,169,67,67,
+167,113,189,221,203,238,71,82,75,38,174,177,6,21,22,143,108,114,129,242,230,
+242,243,79,155,122,189,161,136,129,139,135,138,135,139,166,167,85,180,254,
+237,214,181,158,143,85,1,67,1,65,1,93,1,102,16,25,136,30,254,234,254,240,
+254,250,244,78,145,218,1,63,1,126,186,250,161,88,82,53,51,54,52,2,136,254,
+252,101,2,150,254,174,254,166,85,95,98,82,211,185,166,203,70,21,24,31,49,
+42,72,67,33,80,35,111,118,122,101,135,154,139,137,83,98,72,31,48,151,121,
+122,128,141,160,14,14,156,145,1,11,1,12,189,1,20,181,83,48,111,87,161,164,
+185,197,50,84,56,42,66,80,130,111,86,94,55,51,194,254,131,154,13,72,48,48,
+54,55,49,79,3,167,254,73,252,149,0,3,0,77,255,234,8,56,7,200,0,72,0,94,0,
+95,0,0,1,16,0,33,34,39,55,22,51,50,54,53,52,2,35,34,6,7,54,51,50,22,21,20,
+0,35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,
+7,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,0,1,54,53,52,38,35,
+34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,1,8,56,254,201,254,246,56,56,
+9,27,57,217,225,201,174,158,203,54,45,49,113,129,254,224,244,182,254,127,
+1,2,230,62,108,147,223,122,55,51,135,121,1,93,1,37,91,183,79,54,140,208,115,
+214,204,178,195,98,31,44,28,146,51,1,52,224,246,1,20,254,79,23,213,212,214,
+213,19,144,22,1,36,1,26,1,26,1,34,31,254,7,2,121,254,212,254,174,6,138,3,
+255,242,215,1,5,203,193,19,145,131,214,254,248,145,1,5,176,225,1,39,30,13,
+125,224,152,107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,206,218,
+179,154,140,14,22,45,1,68,1,68,254,178,1,115,60,68,115,116,117,116,61,54,
+11,60,71,176,196,195,174,84,76,2,215,0,3,0,62,255,234,6,59,7,200,0,82,0,83,
+0,84,0,0,1,16,0,33,34,36,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,
+20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,32,0,17,52,38,38,
+36,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,
+22,51,51,50,4,22,18,1,1,6,59,254,74,254,94,207,254,222,142,99,94,70,111,50,
+2,229,6,100,85,79,78,1,146,3,155,139,167,179,177,172,160,129,60,255,235,1,
+90,1,100,85,181,254,255,231,128,158,143,85,1,60,1,56,1,88,1,88,16,25,136,
+30,254,239,254,245,246,235,76,145,153,242,1,58,231,113,253,228,254,252,3,
+1,254,140,254,93,127,219,140,116,173,51,7,135,89,98,59,55,13,7,7,7,23,22,
+114,124,193,181,83,26,84,126,85,166,186,1,84,1,46,152,231,165,74,48,112,89,
+158,164,191,191,50,84,56,42,66,80,126,115,87,93,54,52,88,199,254,221,4,16,
+254,73,0,7,0,74,255,234,6,69,7,200,0,63,0,76,0,85,0,106,0,107,0,108,0,109,
+0,0,1,23,4,7,54,51,50,22,22,21,20,7,22,22,21,16,0,33,34,36,38,53,52,36,33,
+51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,32,
+36,53,52,39,6,6,35,34,38,38,53,52,0,3,50,22,23,52,55,53,52,38,35,34,6,7,21,
+22,22,51,50,55,38,38,35,3,36,53,52,54,36,51,50,22,23,7,38,38,35,34,6,6,21,
+20,22,23,19,19,5,5,245,60,254,194,170,53,57,88,123,62,11,48,48,254,125,254,
+141,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,199,
+177,1,48,1,24,1,38,1,57,13,45,137,91,78,128,83,1,110,169,89,150,61,1,85,82,
+79,101,12,4,69,92,125,44,46,147,101,155,254,238,163,1,13,146,135,153,17,136,
+11,89,78,104,196,122,87,88,143,111,1,183,6,123,129,115,191,30,81,150,103,
+74,57,52,137,86,254,251,254,237,129,239,168,208,210,90,97,121,23,38,23,48,
+54,114,124,193,181,83,142,149,178,204,206,187,65,42,71,70,68,171,138,254,
+1,168,253,162,26,26,9,8,18,107,107,105,92,135,75,104,118,30,31,1,108,59,240,
+117,227,137,129,128,52,87,80,100,163,79,77,74,11,2,185,254,233,198,0,7,0,
+74,255,234,6,18,7,200,0,64,0,77,0,82,0,104,0,105,0,106,0,107,0,0,1,23,6,6,
+7,54,51,50,22,21,20,6,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,
+34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,
+38,35,35,53,52,54,55,54,54,3,7,20,30,2,51,50,53,52,38,35,34,7,38,39,6,7,39,
+38,38,53,52,54,36,51,50,22,23,7,38,38,35,34,6,6,21,20,22,23,19,19,5,5,213,
+61,148,190,42,26,18,119,146,56,55,86,86,254,136,254,151,245,254,184,160,1,
+9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,199,177,1,48,1,24,194,1,
+8,129,178,198,177,90,90,35,246,157,1,8,23,45,32,81,71,65,34,115,26,10,28,
+3,84,165,161,163,1,13,146,135,153,17,136,11,89,78,104,196,122,112,101,123,
+111,1,123,6,123,129,51,140,89,4,119,101,69,90,20,52,171,118,254,252,254,236,
+129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,142,149,178,
+204,96,172,113,151,141,83,124,169,45,136,234,254,43,26,52,48,40,23,89,46,
+58,191,39,66,46,59,222,25,149,132,117,227,137,129,128,52,87,80,100,163,79,
+87,71,8,2,189,254,233,198,0,6,0,44,255,234,11,38,7,200,0,103,0,117,0,143,
+0,144,0,145,0,146,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,34,39,6,6,
+35,34,38,39,7,39,0,55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,36,
+51,32,5,7,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,38,36,
+35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,22,
+51,51,32,4,18,5,54,51,50,22,23,54,54,55,38,38,35,34,4,1,6,7,51,6,21,20,22,
+51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,1,19,1,11,38,241,229,
+109,163,67,71,155,113,108,162,46,40,139,94,193,108,50,136,101,149,179,1,26,
+130,1,12,186,40,113,59,70,22,143,27,147,128,95,134,35,146,1,53,220,1,92,1,
+21,53,123,180,93,136,127,125,130,137,130,134,159,163,85,180,254,237,214,141,
+157,142,87,1,57,1,44,1,93,1,93,16,25,136,30,254,237,254,242,236,235,78,145,
+178,1,63,1,126,186,247,101,99,138,170,245,64,46,181,135,116,210,129,186,254,
+211,254,222,89,134,63,4,102,104,104,105,137,113,102,102,110,232,219,133,156,
+6,59,164,254,75,2,150,254,176,254,164,82,98,102,78,98,93,94,97,180,94,86,
+187,176,46,73,1,127,169,157,66,71,45,69,29,82,78,121,135,102,95,119,119,249,
+151,6,104,178,116,157,169,145,156,14,14,156,145,1,15,1,8,189,1,20,181,83,
+47,112,87,156,169,191,191,50,84,56,42,66,80,127,114,90,90,55,51,194,254,131,
+72,36,122,119,122,146,25,76,67,112,254,237,101,187,23,33,139,120,146,155,
+14,22,135,158,133,134,188,200,27,3,33,1,183,251,149,0,5,0,74,253,213,10,129,
+7,200,0,93,0,120,0,146,0,168,0,169,0,0,5,34,38,39,6,6,35,34,39,6,6,35,34,
+38,39,7,39,0,55,38,38,35,34,6,21,20,23,7,38,38,53,53,52,55,6,21,20,22,23,
+7,38,38,53,52,0,55,54,51,50,22,23,54,36,51,50,22,23,54,54,51,50,22,21,21,
+33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,
+55,35,6,1,54,51,50,22,23,54,36,33,51,38,38,35,34,6,21,20,23,7,38,53,52,55,
+38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,
+38,35,34,6,1,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,4,21,20,7,1,
+8,154,182,252,70,37,146,104,193,107,52,135,100,150,179,1,26,130,1,1,197,20,
+76,56,59,70,21,143,9,15,1,142,69,83,132,88,82,1,15,233,15,26,105,142,36,154,
+1,69,225,124,192,95,40,108,79,171,182,254,197,178,176,122,54,240,226,205,
+177,43,90,105,132,195,81,64,33,88,122,149,166,86,25,11,251,12,101,135,175,
+240,65,53,1,17,1,33,174,5,102,89,83,80,3,147,4,2,157,171,212,254,192,254,
+217,100,122,62,4,102,104,104,105,137,114,102,102,110,232,220,133,156,6,20,
+34,185,177,170,172,27,138,36,253,237,245,1,7,46,254,60,22,106,106,105,107,
+180,95,85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,26,104,41,9,5,5,122,
+245,118,199,117,78,130,252,138,240,1,68,17,4,99,98,124,114,35,37,38,34,193,
+181,83,34,85,126,84,159,185,88,137,47,25,108,139,171,31,131,40,162,145,123,
+104,1,3,137,36,117,116,114,132,88,99,63,49,11,19,18,29,21,33,12,60,109,254,
+234,113,175,23,33,137,122,146,155,14,22,135,158,133,134,187,201,27,1,249,
+82,79,109,123,114,98,60,63,34,86,76,160,191,203,167,94,117,3,11,0,5,0,74,
+254,42,10,83,7,200,0,100,0,127,0,153,0,175,0,176,0,0,5,34,38,39,6,6,35,34,
+39,6,6,35,34,38,39,7,39,0,55,38,38,35,34,6,21,20,23,7,38,38,53,53,52,55,6,
+21,20,22,23,7,38,38,53,52,0,55,54,51,50,22,23,54,36,51,50,22,23,54,54,51,
+50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,7,22,21,20,4,33,32,36,53,53,52,
+55,23,21,20,22,51,50,54,53,52,39,52,39,6,1,54,51,50,22,23,54,36,33,51,38,
+38,35,34,6,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,
+53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,1,54,53,52,38,35,34,6,21,20,23,
+7,38,53,52,54,51,50,4,21,20,7,1,8,154,182,252,70,37,146,104,193,107,52,135,
+100,150,179,1,26,130,1,1,197,20,76,56,59,70,21,143,9,15,1,142,69,83,132,88,
+82,1,15,233,15,26,105,142,36,154,1,69,225,124,192,95,40,108,79,171,182,254,
+197,178,176,122,54,240,226,205,177,43,34,9,254,250,254,253,255,0,254,250,
+1,149,181,187,188,183,2,1,112,250,129,101,135,175,240,65,53,1,17,1,33,174,
+5,102,89,83,80,3,147,4,2,157,171,212,254,192,254,217,100,122,62,4,102,104,
+104,105,137,114,102,102,110,232,220,133,156,6,20,34,185,177,170,172,27,138,
+36,253,237,245,1,7,46,254,60,22,106,106,105,107,180,95,85,187,176,46,73,1,
+112,184,78,79,66,71,46,68,29,26,104,41,9,5,5,122,245,118,199,117,78,130,252,
+138,240,1,68,17,4,99,98,124,114,35,37,38,34,193,181,83,34,85,126,84,159,185,
+88,137,17,43,70,196,219,206,191,17,11,9,7,7,150,125,131,159,19,14,7,5,32,
+3,137,36,117,116,114,132,88,99,63,49,11,19,18,29,21,33,12,60,109,254,234,
+113,175,23,33,137,122,146,155,14,22,135,158,133,134,187,201,27,1,249,82,79,
+109,123,114,98,60,63,34,86,76,160,191,203,167,94,117,3,11,0,4,0,77,253,213,
+9,124,7,200,0,89,0,115,0,140,0,141,0,0,5,34,36,39,6,6,35,34,38,2,53,52,0,
+55,38,35,34,6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,7,14,2,21,20,22,51,50,
+54,53,52,35,34,6,7,39,18,0,33,50,23,54,51,50,22,21,21,33,34,14,2,21,20,22,
+51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,35,6,3,35,34,4,7,
+54,51,50,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,37,54,53,52,38,35,
+34,6,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,7,1,7,149,190,254,247,
+66,60,232,164,182,254,127,1,2,230,62,108,147,223,122,55,51,135,121,1,93,1,
+37,91,183,79,54,140,208,115,214,204,178,195,98,31,44,28,146,49,1,103,1,21,
+97,85,50,67,171,182,254,197,177,177,122,54,240,226,205,177,43,90,105,132,
+195,81,64,33,88,122,149,166,86,25,11,246,17,198,254,239,59,44,50,85,58,33,
+150,232,204,174,5,102,89,83,80,3,147,4,1,221,34,185,177,115,154,73,44,140,
+23,28,253,237,164,227,117,46,254,22,22,121,118,119,120,145,1,5,176,225,1,
+39,30,13,125,224,152,107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,
+144,206,218,179,154,140,14,22,45,1,64,1,72,12,12,193,181,83,34,84,127,84,
+159,185,88,137,47,25,108,139,171,31,131,40,161,146,123,104,1,4,120,208,200,
+18,55,79,116,60,88,99,63,49,18,12,18,29,21,73,175,82,79,109,123,53,97,62,
+75,78,32,45,91,54,160,191,92,169,109,94,117,3,11,0,4,0,77,254,42,9,78,7,200,
+0,95,0,121,0,146,0,147,0,0,5,34,36,39,6,6,35,34,38,2,53,52,0,55,38,35,34,
+6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,
+34,6,7,39,18,0,33,50,23,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,
+6,7,22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,50,54,53,52,39,6,1,35,
+34,4,7,54,51,50,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,37,54,53,
+52,38,35,34,6,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,7,1,7,149,190,
+254,247,66,60,232,164,182,254,127,1,2,230,62,108,147,223,122,55,51,135,121,
+1,93,1,37,91,183,79,54,140,208,115,214,204,178,195,98,31,44,28,146,49,1,103,
+1,21,97,85,50,67,171,182,254,197,177,177,122,54,240,226,205,177,43,27,8,9,
+254,250,254,253,255,0,254,250,1,149,181,187,188,183,3,112,254,128,17,198,
+254,239,59,44,50,85,58,33,150,232,204,174,5,102,89,83,80,3,147,4,1,221,34,
+185,177,115,154,73,44,140,23,28,253,237,164,227,117,46,254,122,22,121,118,
+119,120,145,1,5,176,225,1,39,30,13,125,224,152,107,201,76,68,219,241,1,35,
+1,77,48,46,143,5,112,208,144,206,218,179,154,140,14,22,45,1,64,1,72,12,12,
+193,181,83,34,84,127,84,159,185,88,137,14,3,51,62,196,219,206,191,17,11,9,
+7,7,150,125,131,159,23,21,31,4,120,208,200,18,55,79,116,60,88,99,63,49,18,
+12,18,29,21,73,175,82,79,109,123,53,97,62,75,78,32,45,91,54,160,191,92,169,
+109,94,117,3,11,0,7,0,74,255,234,7,36,7,200,0,75,0,88,0,93,0,115,0,116,0,
+117,0,118,0,0,1,23,6,6,7,54,51,50,22,21,20,6,7,22,22,21,16,0,33,32,0,17,52,
+36,33,51,38,38,35,34,21,20,23,7,38,53,52,55,6,17,20,23,7,38,38,53,52,18,36,
+51,51,50,22,22,21,21,35,34,6,21,20,4,33,32,36,53,52,38,35,35,53,52,54,55,
+54,54,3,7,20,30,2,51,50,53,52,38,35,34,7,38,39,6,7,39,38,38,53,52,54,36,51,
+50,22,23,7,38,38,35,34,6,6,21,20,22,23,19,19,1,6,232,60,147,190,43,26,18,
+120,146,56,55,86,86,254,136,254,151,254,152,254,138,1,9,1,5,31,5,99,85,158,
+10,145,10,5,194,113,134,63,66,148,1,22,179,25,112,152,82,175,199,178,1,48,
+1,25,1,26,1,48,178,197,177,89,90,36,247,158,1,7,24,45,32,81,72,64,34,116,
+27,8,29,3,86,165,161,163,1,13,146,135,153,17,136,11,89,78,104,196,122,112,
+101,162,19,1,174,6,123,129,51,140,89,4,119,101,69,90,20,52,171,118,254,252,
+254,236,1,20,1,4,207,211,90,97,121,22,39,23,38,62,30,18,123,254,211,234,161,
+73,104,245,127,187,1,19,146,85,164,125,83,141,150,178,204,202,179,151,141,
+83,124,168,45,138,234,254,42,26,52,48,40,23,89,45,59,191,46,58,44,60,222,
+25,149,132,117,227,137,129,128,52,87,80,100,163,79,87,71,8,1,166,1,23,254,
+35,0,4,0,74,255,234,6,13,7,200,0,60,0,61,0,62,0,63,0,0,1,16,0,33,34,36,38,
+53,52,0,33,50,23,7,38,35,34,6,21,20,22,51,50,36,18,53,52,38,38,36,35,35,34,
+38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,22,51,51,32,
+4,18,1,19,3,6,13,254,85,254,109,214,254,222,141,1,60,1,16,121,97,13,92,111,
+210,230,250,244,219,1,48,154,81,178,254,255,216,109,158,143,85,1,51,1,45,
+1,77,1,82,16,25,136,30,254,249,254,252,231,230,78,143,137,1,66,1,114,183,
+253,86,64,227,3,1,254,139,254,94,127,228,154,247,1,5,14,141,14,188,179,176,
+187,151,1,37,198,157,228,165,72,48,112,89,155,167,194,188,50,84,56,42,66,
+80,123,118,90,90,55,51,181,254,171,2,33,1,183,253,30,0,6,0,74,255,234,6,130,
+7,200,0,55,0,65,0,89,0,90,0,91,0,92,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,
+52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,
+54,54,53,16,39,6,6,35,34,38,53,52,38,39,39,55,4,0,1,38,39,22,23,22,22,51,
+50,54,55,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,20,7,
+37,1,1,6,130,251,236,112,167,69,74,158,116,188,221,143,1,14,183,111,115,14,
+87,117,217,237,141,132,132,133,138,136,137,116,149,73,168,41,135,79,119,123,
+18,37,5,53,1,164,1,151,254,102,116,180,22,5,4,52,55,51,75,169,23,234,231,
+231,232,161,155,21,221,221,1,60,1,41,1,45,1,52,35,253,24,254,29,2,118,2,128,
+254,184,254,178,83,97,103,77,255,230,153,245,134,14,139,13,213,192,157,169,
+147,154,14,14,157,144,115,229,175,1,99,226,72,81,144,144,113,90,23,2,126,
+138,253,230,1,28,112,84,49,113,87,62,53,174,62,72,129,119,110,120,90,88,10,
+143,21,165,150,174,195,198,181,94,91,178,254,193,2,226,0,3,0,62,255,234,6,
+150,7,200,0,94,0,95,0,96,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,16,55,6,35,
+35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,
+2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,38,36,35,35,34,38,
+38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,32,6,21,20,22,51,51,32,4,
+18,1,1,6,150,249,242,107,163,69,76,161,112,190,229,229,71,144,40,2,136,5,
+100,85,79,78,1,147,3,155,140,165,181,56,152,168,155,86,146,129,136,138,137,
+135,139,165,168,85,180,254,237,214,181,158,143,85,1,67,1,65,1,93,1,102,16,
+25,136,30,254,234,254,240,254,250,244,78,145,218,1,63,1,126,186,252,113,2,
+144,2,150,254,174,254,166,83,97,104,76,236,204,1,9,121,7,135,89,98,59,55,
+14,8,5,7,23,22,114,124,190,183,84,24,87,157,111,139,155,146,155,14,14,156,
+145,1,11,1,12,189,1,20,181,83,48,111,87,161,164,185,197,50,84,56,42,66,80,
+130,111,86,94,55,51,194,254,131,2,86,1,183,0,5,0,62,255,234,6,155,7,200,0,
+77,0,87,0,111,0,112,0,113,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,
+6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,
+14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,52,2,39,6,6,35,34,
+38,53,52,38,39,39,55,4,0,1,38,39,22,23,22,22,51,50,54,55,54,53,52,38,35,34,
+6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,20,7,37,1,6,155,251,236,113,168,
+67,76,161,112,189,230,117,114,66,151,40,2,136,5,100,85,79,78,1,147,3,155,
+140,165,181,60,151,166,154,86,146,129,136,138,137,135,139,117,150,71,84,84,
+40,134,80,117,126,18,37,5,53,1,159,1,156,254,103,119,177,22,5,4,52,55,54,
+74,166,23,233,232,231,232,161,155,21,222,220,1,60,1,41,1,46,1,51,35,252,255,
+2,135,2,128,254,184,254,178,84,96,104,76,237,203,130,198,59,8,135,89,98,59,
+55,14,8,5,7,23,22,114,124,190,183,84,24,87,157,111,139,155,146,155,14,14,
+156,145,119,231,169,178,1,34,112,71,81,141,147,115,88,23,2,126,136,253,233,
+1,22,115,81,49,112,87,62,56,171,62,72,128,120,110,120,90,88,10,138,21,163,
+147,174,195,200,179,94,91,178,1,163,0,8,0,10,255,234,9,85,7,200,0,64,0,73,
+0,101,0,113,0,134,0,135,0,136,0,137,0,0,1,16,2,35,34,38,39,55,22,22,51,50,
+54,54,53,52,38,35,34,6,21,21,35,53,52,38,35,34,7,22,21,20,2,4,35,34,36,39,
+7,39,1,38,53,52,54,36,51,50,23,54,1,23,1,22,23,54,51,50,22,23,54,54,51,50,
+18,5,54,1,38,35,34,6,21,20,3,22,22,51,50,54,54,53,52,38,39,0,1,22,23,38,53,
+52,54,51,50,22,21,20,6,35,32,39,5,51,50,54,53,52,38,35,34,6,21,20,3,38,53,
+52,54,36,51,50,22,23,7,38,38,35,34,6,6,21,20,22,23,19,1,1,9,85,191,190,122,
+185,56,141,41,103,76,89,99,40,103,103,90,93,136,70,70,65,42,51,168,254,195,
+207,200,254,211,141,58,111,1,26,58,144,1,5,169,100,88,221,1,47,99,254,46,
+147,91,72,96,67,105,39,39,137,97,172,174,248,56,176,1,32,24,25,189,243,102,
+119,251,162,166,250,137,168,161,254,212,254,253,68,111,28,132,114,117,135,
+183,151,255,0,155,1,165,7,73,99,55,54,50,55,110,183,167,1,28,162,153,173,
+20,131,21,101,102,115,212,130,57,55,254,2,123,249,189,2,34,254,228,254,228,
+138,136,57,102,88,98,190,157,220,213,132,158,13,12,132,105,48,124,157,198,
+254,225,151,130,146,64,99,1,28,106,129,126,206,114,14,204,1,13,113,254,105,
+57,116,63,60,60,87,88,254,215,166,171,1,13,2,174,136,84,254,147,122,112,114,
+222,152,176,245,52,254,242,254,255,62,25,60,64,98,120,127,109,117,139,142,
+9,59,61,50,57,53,50,73,2,230,78,188,97,200,125,135,134,59,96,88,84,142,69,
+49,65,23,2,121,254,93,251,37,0,3,0,74,255,234,7,174,7,200,0,111,0,112,0,113,
+0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,34,
+6,21,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,2,53,52,18,36,51,50,23,54,51,
+50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,
+2,38,36,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,32,6,
+21,20,22,51,51,32,4,18,1,19,7,174,247,235,112,167,69,76,161,112,190,229,113,
+110,70,139,19,2,146,5,100,85,79,78,1,147,3,13,152,162,113,134,60,69,150,1,
+32,190,53,25,20,20,167,179,91,151,166,154,86,146,129,139,135,137,135,139,
+166,167,85,180,254,237,214,181,158,143,85,1,67,1,65,1,93,1,102,16,25,136,
+30,254,234,254,240,254,250,244,78,145,218,1,63,1,126,186,253,77,56,2,150,
+254,174,254,166,83,97,104,76,236,204,129,196,61,7,135,89,98,59,55,14,8,5,
+7,23,22,51,35,42,239,183,235,161,72,95,1,1,123,185,1,20,148,2,2,192,181,84,
+24,87,157,111,139,155,149,152,14,14,156,145,1,11,1,12,189,1,20,181,83,48,
+111,87,161,164,185,197,50,84,56,42,66,80,130,111,86,94,55,51,194,254,131,
+2,86,1,183,0,4,0,44,255,234,7,76,7,200,0,57,0,74,0,99,0,100,0,0,1,20,2,6,
+35,34,39,55,22,51,50,54,54,53,52,0,35,34,4,7,54,51,50,22,21,20,4,33,34,36,
+53,53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,
+4,18,5,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,1,54,53,52,38,35,34,6,
+21,20,22,23,7,38,53,52,36,33,50,4,22,21,20,6,7,1,7,76,127,231,147,63,33,8,
+44,27,120,164,84,254,233,244,141,254,234,124,83,113,229,254,254,224,254,231,
+240,254,242,74,130,1,5,190,39,111,59,70,10,12,143,27,147,128,184,77,149,1,
+36,156,208,1,46,157,250,152,88,71,70,12,194,186,208,206,191,178,90,150,3,
+173,46,212,212,214,213,46,43,129,107,1,38,1,24,183,1,0,132,35,26,253,182,
+2,75,183,254,244,141,6,138,3,107,208,147,243,1,12,111,107,28,234,217,239,
+251,215,203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,135,187,119,
+109,162,254,208,69,102,98,5,44,56,143,147,177,164,154,160,27,1,236,79,95,
+116,116,121,121,43,106,53,66,134,145,175,200,85,168,116,61,125,43,3,28,0,
+5,0,74,255,234,6,32,7,200,0,41,0,50,0,74,0,75,0,76,0,0,1,16,2,4,33,32,0,53,
+52,0,33,50,23,7,38,35,34,6,21,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,
+52,38,39,39,55,22,0,18,1,38,39,22,23,22,22,51,50,55,54,53,52,38,35,34,6,21,
+20,22,23,7,38,38,53,52,36,33,32,4,21,20,7,1,3,6,32,198,254,137,254,251,254,
+192,254,172,1,72,1,27,126,100,12,98,116,220,241,255,247,221,1,53,158,86,44,
+122,69,119,123,16,40,7,51,243,1,73,157,254,195,106,179,21,5,4,52,55,94,164,
+23,223,224,221,223,161,155,21,221,221,1,50,1,29,1,37,1,45,35,254,47,247,3,
+71,254,250,254,118,205,1,11,242,246,1,6,14,141,14,188,179,178,185,175,1,75,
+208,200,154,59,62,144,144,111,93,23,3,124,77,254,245,254,174,1,15,124,89,
+52,108,87,62,227,62,72,127,121,111,119,90,88,10,143,21,165,150,173,196,201,
+178,94,91,2,85,254,93,0,3,0,74,253,213,4,189,7,200,0,56,0,80,0,81,0,0,5,32,
+0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,33,
+34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,
+6,19,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,4,21,20,7,1,2,
+193,254,215,254,178,96,182,235,183,204,5,102,89,81,81,2,147,4,158,143,170,
+182,254,179,188,186,127,57,254,238,216,186,43,86,106,135,195,82,63,34,90,
+120,151,165,87,36,207,34,185,177,170,172,102,122,69,150,152,253,237,245,1,
+7,46,253,219,22,1,6,237,122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,
+192,182,83,34,84,127,84,159,185,88,137,44,25,110,140,171,31,131,40,162,145,
+125,103,2,4,255,82,79,109,123,114,98,75,95,43,119,46,172,119,160,191,203,
+167,94,117,3,11,0,3,0,74,254,42,4,142,7,200,0,66,0,90,0,91,0,0,5,32,0,53,
+52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,14,
+2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,
+50,54,54,53,52,39,52,39,6,19,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,4,21,20,7,1,2,193,254,215,254,178,96,182,235,183,204,5,102,89,81,
+81,2,147,4,158,143,170,182,254,179,188,186,127,57,254,238,216,186,43,23,11,
+9,254,250,254,253,255,0,254,250,1,149,181,187,123,163,85,3,1,125,83,34,185,
+177,170,172,102,122,69,150,152,253,237,245,1,7,46,253,219,22,1,6,237,122,
+177,116,40,88,99,61,51,18,12,18,29,33,111,122,192,182,83,34,84,127,84,159,
+185,88,137,12,5,43,70,196,219,206,191,17,11,9,7,7,150,125,55,124,111,11,24,
+6,6,34,4,255,82,79,109,123,114,98,75,95,43,119,46,172,119,160,191,203,167,
+94,117,3,11,0,4,0,74,255,234,6,125,7,200,0,74,0,75,0,76,0,77,0,0,1,16,2,35,
+34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,50,54,
+53,53,51,21,20,22,51,50,18,17,52,2,38,36,35,35,34,38,38,53,52,36,33,32,4,
+21,20,6,7,39,54,53,52,36,33,32,6,21,20,22,51,51,32,4,18,9,2,6,125,247,235,
+114,169,67,75,157,114,188,221,143,1,14,183,111,115,14,87,117,217,237,141,
+132,132,133,138,136,137,166,167,85,180,254,237,214,181,158,143,85,1,67,1,
+65,1,93,1,102,16,25,136,30,254,234,254,240,254,250,244,78,145,218,1,63,1,
+126,186,253,112,1,70,254,1,2,150,254,174,254,166,85,95,105,75,255,230,153,
+245,134,14,139,13,213,192,157,169,147,154,14,14,157,144,1,11,1,12,189,1,20,
+181,83,48,111,87,161,164,185,197,50,84,56,42,66,80,130,111,86,94,55,51,194,
+254,131,2,86,1,183,253,30,0,4,0,58,255,234,7,107,7,200,0,62,0,76,0,100,0,
+101,0,0,19,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,
+50,22,23,54,36,51,50,4,18,21,20,2,6,35,34,39,55,22,51,50,54,53,52,0,35,34,
+6,7,54,51,50,22,21,20,0,33,32,0,3,37,6,6,7,22,22,51,50,54,53,52,38,35,34,
+1,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,36,33,32,4,21,20,6,7,3,204,5,
+9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,96,130,35,99,1,12,
+158,207,1,54,165,135,228,141,64,33,8,44,27,178,190,254,225,246,133,215,83,
+49,46,228,254,254,211,254,225,254,211,254,149,48,2,164,57,223,191,65,247,
+200,208,225,194,175,69,2,253,48,207,207,209,208,41,54,124,118,1,33,1,19,1,
+20,1,29,36,27,236,2,127,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,
+78,121,135,100,100,118,123,159,254,210,201,192,254,240,133,6,138,3,238,215,
+242,1,22,99,98,7,234,217,227,254,249,1,66,1,59,160,173,167,5,156,150,184,
+166,149,156,1,205,84,94,116,116,121,121,50,91,64,74,150,140,175,200,195,174,
+59,129,45,3,32,0,3,0,74,253,213,5,151,7,200,0,73,0,96,0,97,0,0,5,32,0,53,
+52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,55,34,6,21,20,23,7,38,38,
+53,52,18,36,51,50,23,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,
+7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,35,6,19,54,53,52,38,35,34,6,6,21,
+20,23,7,38,53,52,54,51,50,4,21,20,7,1,3,175,254,228,254,192,77,154,214,214,
+195,5,104,88,82,80,2,146,5,26,233,254,105,137,56,62,150,1,32,190,110,63,43,
+68,169,183,254,197,179,177,119,54,240,226,205,177,42,85,108,133,194,82,64,
+33,90,120,150,165,86,25,12,209,34,185,177,116,153,73,44,140,51,253,237,245,
+1,7,46,254,44,22,1,6,237,109,172,118,56,89,98,62,50,18,12,18,30,20,71,44,
+255,231,221,180,67,102,247,126,185,1,20,148,11,11,190,184,83,34,85,126,84,
+159,185,88,137,45,26,109,139,171,31,131,40,162,145,123,104,1,4,255,82,79,
+109,123,54,96,62,79,76,32,99,93,160,191,203,167,94,117,3,11,0,3,0,74,254,
+42,5,104,7,200,0,80,0,103,0,104,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,
+21,20,23,7,38,53,52,55,34,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,
+22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,53,53,52,
+55,23,21,20,22,51,50,54,54,53,52,39,6,19,54,53,52,38,35,34,6,6,21,20,23,7,
+38,53,52,54,51,50,4,21,20,7,1,3,175,254,228,254,192,77,154,214,214,195,5,
+104,88,82,80,2,146,5,26,233,254,105,137,56,62,150,1,32,190,110,63,43,68,169,
+183,254,197,179,177,119,54,240,226,205,177,42,26,7,9,254,250,254,253,255,
+0,254,250,1,149,181,187,123,163,85,4,112,70,34,185,177,116,153,73,44,140,
+51,253,237,245,1,7,46,254,44,22,1,6,237,109,172,118,56,89,98,62,50,18,12,
+18,30,20,71,44,255,231,221,180,67,102,247,126,185,1,20,148,11,11,190,184,
+83,34,85,126,84,159,185,88,137,14,3,43,70,196,219,206,191,17,11,9,7,7,150,
+125,55,124,111,9,37,33,4,255,82,79,109,123,54,96,62,79,76,32,99,93,160,191,
+203,167,94,117,3,11,0,3,0,74,255,234,6,8,7,200,0,62,0,84,0,85,0,0,1,20,7,
+39,54,53,52,35,34,6,7,51,32,17,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,
+21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,38,
+35,35,53,52,54,51,50,22,37,54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,33,
+32,4,21,20,7,1,5,203,13,145,9,157,86,99,4,31,2,13,254,136,254,151,245,254,
+184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,200,176,1,43,
+1,29,201,1,8,122,178,198,177,179,168,138,156,254,244,20,213,212,214,213,20,
+139,28,1,36,1,26,1,26,1,34,28,253,245,3,247,48,53,23,38,23,121,99,88,254,
+94,254,252,254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,
+181,83,140,147,183,203,99,172,114,149,139,83,181,193,124,169,52,68,115,116,
+117,116,65,53,24,72,75,176,196,195,174,81,69,2,205,0,5,0,74,255,234,6,54,
+7,200,0,55,0,65,0,89,0,90,0,91,0,0,1,20,2,4,33,32,0,53,52,36,33,51,38,38,
+35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,
+53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,0,37,38,39,22,23,22,22,51,50,54,
+55,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,20,7,1,3,6,
+54,200,254,127,254,243,254,203,254,159,1,39,1,7,123,5,99,85,157,5,145,9,155,
+139,168,179,225,171,187,94,1,16,240,222,1,57,165,87,43,120,71,116,126,16,
+40,7,51,1,100,1,117,254,195,109,176,21,5,4,52,55,47,71,140,23,223,224,221,
+223,161,155,21,222,220,1,50,1,29,1,37,1,45,35,253,81,47,3,50,253,254,128,
+203,1,31,248,191,228,90,97,121,19,24,24,50,35,114,124,192,182,83,64,125,97,
+180,207,166,1,67,214,207,157,57,63,141,147,111,93,23,3,124,114,254,49,165,
+127,87,52,108,87,62,44,183,62,72,127,121,111,119,90,88,10,138,21,163,147,
+173,196,201,178,94,91,2,85,254,93,0,5,0,74,255,234,6,161,7,200,0,89,0,99,
+0,100,0,101,0,102,0,0,1,20,2,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,
+6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,21,20,6,
+6,7,6,6,21,20,22,51,50,54,18,53,52,2,36,33,35,34,38,38,53,52,36,33,32,4,21,
+20,6,7,39,54,53,52,36,33,32,6,21,20,22,51,51,32,4,18,1,22,51,50,54,53,52,
+38,35,34,9,2,6,161,132,244,161,134,144,27,38,34,24,172,154,136,206,113,21,
+136,165,120,143,154,143,129,201,108,148,1,25,185,219,250,17,26,32,31,22,72,
+64,93,174,110,161,254,212,254,216,190,158,143,85,1,69,1,65,1,97,1,105,16,
+25,136,30,254,231,254,237,254,249,246,78,145,227,1,26,1,132,220,250,144,73,
+131,80,72,68,58,123,1,97,1,70,254,1,2,188,209,254,180,181,140,121,53,98,90,
+80,102,52,134,148,119,223,148,109,71,153,137,105,124,135,136,243,146,186,
+1,33,159,222,180,52,95,76,76,74,76,37,66,64,131,1,10,179,230,1,53,154,48,
+111,87,162,163,184,198,50,84,56,42,66,80,129,112,86,94,55,51,164,254,145,
+252,233,92,59,57,49,61,4,187,1,183,253,30,0,3,0,62,255,234,7,108,7,200,0,
+79,0,101,0,102,0,0,1,16,0,33,34,39,55,22,51,50,54,53,52,2,35,34,6,7,54,51,
+50,22,21,20,6,4,35,32,0,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,
+23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,52,35,34,
+6,7,39,18,0,51,50,0,1,54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,
+21,20,7,1,7,108,254,201,254,246,56,56,9,27,57,217,225,200,175,156,204,55,
+40,54,113,128,137,254,242,193,254,241,254,191,84,82,72,99,32,2,81,5,99,85,
+81,76,1,147,3,155,139,166,181,106,152,147,98,50,235,209,216,234,98,32,43,
+28,146,51,1,52,224,246,1,20,254,2,19,213,212,214,213,18,143,22,1,36,1,26,
+1,26,1,34,25,253,68,2,121,254,212,254,174,6,138,3,255,242,217,1,3,199,196,
+18,145,133,137,219,120,1,15,224,105,169,56,6,135,90,97,61,53,14,8,5,7,12,
+33,114,124,190,184,83,35,77,110,81,171,199,180,164,129,13,23,45,1,68,1,68,
+254,178,1,127,56,60,115,116,117,116,59,54,14,63,69,176,196,195,174,78,65,
+2,198,0,5,0,79,255,234,6,132,7,200,0,96,0,107,0,108,0,109,0,110,0,0,1,20,
+2,4,33,34,36,2,53,52,18,51,50,22,22,21,20,7,6,21,20,51,50,55,6,35,34,38,53,
+52,54,51,50,30,2,21,20,6,35,34,38,53,52,55,54,53,52,35,34,6,21,16,0,33,50,
+36,54,54,53,52,46,2,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,
+36,33,32,6,21,20,22,51,51,50,4,30,2,5,38,38,35,34,6,21,20,22,51,50,9,2,6,
+132,201,254,130,254,246,227,254,179,180,204,164,65,81,29,10,11,231,218,41,
+77,103,110,126,142,127,57,103,86,49,219,187,183,193,10,9,59,83,107,1,55,1,
+30,181,1,12,165,76,86,181,254,233,194,158,143,85,1,68,1,68,1,95,1,103,16,
+25,136,30,254,227,254,235,254,253,242,76,145,219,216,1,29,206,127,66,253,
+195,11,81,62,62,60,61,53,92,254,252,1,70,254,1,2,254,237,254,152,191,163,
+1,61,215,235,1,15,53,72,35,37,70,71,52,186,170,47,121,104,100,128,36,80,130,
+87,172,205,166,147,43,64,63,21,71,195,162,254,242,254,219,103,182,230,130,
+139,229,175,76,48,112,89,161,161,186,196,50,84,56,42,66,80,129,112,86,94,
+54,52,67,142,183,237,6,74,79,51,46,47,52,2,189,1,183,253,30,0,5,0,83,255,
+234,6,191,7,200,0,124,0,135,0,136,0,137,0,138,0,0,1,16,0,33,34,39,39,54,53,
+52,38,35,34,6,21,20,23,7,6,35,34,0,17,52,18,54,51,50,22,21,20,7,6,21,20,51,
+50,55,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,38,53,52,55,54,53,52,
+35,34,6,6,21,20,18,51,51,22,51,50,55,38,53,52,54,51,51,50,22,21,20,7,51,50,
+18,17,52,2,36,33,35,34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,38,38,
+35,32,6,21,20,22,51,51,50,4,22,18,5,38,38,35,34,6,21,20,22,51,50,9,2,6,191,
+254,219,254,237,140,73,14,89,80,78,79,81,89,14,77,87,244,254,225,98,178,108,
+86,91,10,11,231,218,41,77,103,110,126,142,127,131,164,219,187,134,169,73,
+10,9,60,50,97,58,199,175,10,1,2,3,4,69,150,142,27,138,151,69,58,204,215,163,
+254,198,254,205,192,148,145,93,1,73,1,73,1,101,1,108,16,25,136,30,135,252,
+177,254,242,250,78,145,232,242,1,69,233,112,253,158,11,81,62,58,64,61,53,
+92,254,230,1,70,254,1,2,198,254,169,254,124,23,135,23,75,52,53,54,51,75,23,
+135,24,1,82,1,41,173,1,0,137,91,69,37,70,71,52,186,170,47,121,104,100,128,
+174,159,172,205,86,140,87,43,64,63,21,71,105,195,124,236,254,244,1,1,57,89,
+97,104,104,97,88,58,1,55,1,31,239,1,33,146,42,114,91,162,162,182,200,50,84,
+56,42,66,80,94,103,44,86,94,55,51,97,213,254,204,17,74,79,48,49,47,52,2,189,
+1,183,253,30,0,3,0,74,255,234,6,52,7,200,0,64,0,88,0,89,0,0,1,20,7,39,54,
+53,52,35,34,6,7,51,32,4,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,36,51,50,
+23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,38,
+35,35,53,52,54,51,50,22,39,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,
+36,33,32,4,21,20,7,1,5,218,14,144,9,157,86,99,4,23,1,29,1,21,223,186,112,
+167,69,75,158,115,188,221,140,1,5,174,61,37,11,28,51,203,230,141,132,132,
+133,138,136,138,129,135,105,223,198,55,179,167,136,159,252,20,213,212,205,
+206,111,139,67,165,165,1,29,1,17,1,26,1,34,28,253,214,3,247,44,57,23,38,23,
+121,99,88,245,242,220,247,83,97,104,76,255,230,152,246,134,6,139,5,217,188,
+157,169,147,154,14,14,158,143,162,160,145,145,61,84,181,192,121,166,52,68,
+115,116,118,111,74,99,48,123,52,176,124,168,197,195,174,81,69,2,205,0,8,0,
+74,255,234,5,121,7,200,0,16,0,30,0,52,0,53,0,54,0,55,0,56,0,57,0,0,1,4,5,
+4,0,21,16,0,33,32,0,17,52,18,37,36,37,1,6,6,21,20,22,51,50,36,53,52,36,35,
+34,39,38,38,53,52,54,36,51,50,22,23,7,38,38,35,34,6,6,21,20,22,23,1,1,19,
+7,3,5,107,254,244,254,205,1,5,1,34,254,160,254,202,254,214,254,183,246,1,
+42,1,121,1,38,253,5,148,154,248,231,245,1,10,254,245,233,93,138,115,119,170,
+1,33,159,153,173,20,131,21,101,102,118,215,129,84,77,1,18,2,33,25,2,25,5,
+253,226,149,16,254,204,254,254,230,254,192,1,53,1,24,223,1,37,117,209,239,
+253,137,69,212,164,212,236,242,210,215,246,130,44,137,106,111,207,126,135,
+134,59,96,88,87,143,71,68,75,25,2,195,253,30,1,203,209,254,189,0,3,0,74,254,
+94,6,140,7,200,0,50,0,73,0,74,0,0,1,20,6,35,34,38,53,52,55,33,53,33,21,33,
+6,21,20,51,50,54,53,52,36,33,32,0,17,16,0,33,32,0,53,52,39,55,22,21,20,2,
+4,35,32,0,17,16,18,36,33,32,4,1,54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,
+33,50,4,22,21,20,7,1,6,121,230,207,176,179,11,254,202,2,252,254,213,16,203,
+139,146,254,255,254,255,254,146,254,117,1,102,1,68,1,29,1,76,5,147,7,190,
+254,160,221,254,102,254,83,220,1,158,1,20,1,77,1,84,254,154,35,213,212,213,
+213,72,130,89,1,38,1,23,184,1,0,132,47,253,165,3,8,173,203,142,139,35,36,
+137,137,30,38,143,122,111,173,167,254,128,254,166,254,200,254,170,1,17,250,
+33,46,8,38,50,206,254,209,161,1,165,1,129,1,7,1,138,209,249,1,3,74,80,116,
+116,121,121,82,98,63,123,131,175,200,86,167,116,103,99,3,1,0,3,0,74,253,213,
+6,137,7,200,0,80,0,101,0,102,0,0,1,20,6,35,34,38,53,52,55,33,53,33,21,33,
+6,21,20,51,50,54,53,52,36,33,32,0,17,16,0,33,32,36,53,53,55,23,22,21,20,7,
+22,21,20,6,4,35,34,36,46,2,53,53,52,55,23,21,20,30,2,51,32,36,53,53,52,39,
+6,4,35,32,36,2,53,52,18,36,33,32,4,1,54,53,52,33,32,21,20,23,7,38,53,52,36,
+33,50,4,22,21,20,7,1,6,121,230,207,176,179,11,254,202,2,252,254,213,16,203,
+139,146,254,255,254,255,254,144,254,119,1,100,1,70,1,44,1,56,147,3,1,56,22,
+171,254,182,241,179,254,243,172,98,45,1,149,72,141,228,168,1,50,1,38,1,101,
+254,213,179,254,233,254,134,182,219,1,159,1,20,1,77,1,84,254,154,35,254,87,
+254,86,65,138,74,1,38,1,23,184,1,0,132,47,253,165,3,8,173,203,142,139,35,
+36,137,137,30,38,143,122,111,173,167,254,192,254,223,254,251,254,228,181,
+180,14,10,22,8,9,119,95,68,90,184,209,96,42,78,102,130,86,24,9,10,7,10,105,
+115,66,33,167,183,10,5,4,73,74,175,1,56,208,225,1,84,182,249,1,3,74,80,232,
+242,81,90,49,111,120,175,200,86,167,116,103,99,3,1,0,3,0,74,255,234,6,54,
+7,200,0,76,0,77,0,78,0,0,1,16,0,33,34,36,38,53,52,54,54,51,51,38,38,35,34,
+21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,6,6,21,20,4,51,32,0,17,52,38,
+38,36,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,
+20,22,51,51,50,4,22,18,1,1,6,54,254,74,254,94,205,254,213,156,132,250,214,
+127,5,100,85,157,6,145,9,155,139,166,180,254,246,175,185,92,1,15,239,1,90,
+1,100,85,181,254,255,231,128,158,143,85,1,60,1,56,1,88,1,88,16,25,136,30,
+254,239,254,245,246,235,76,145,153,242,1,58,231,113,252,199,1,70,3,1,254,
+140,254,93,131,241,163,125,190,104,89,98,121,19,24,24,50,35,114,124,191,183,
+83,65,125,96,181,206,1,84,1,46,152,231,165,74,48,112,89,158,164,191,191,50,
+84,56,42,66,80,126,115,87,93,54,52,88,199,254,221,2,89,1,183,0,4,0,78,255,
+234,7,8,7,200,0,64,0,77,0,99,0,100,0,0,1,20,0,7,39,54,53,52,39,38,53,52,54,
+51,50,23,53,52,38,35,34,6,7,54,51,50,22,21,20,6,6,35,32,0,17,52,18,36,51,
+50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,22,18,
+1,54,55,38,35,34,6,21,20,23,22,21,20,3,54,53,52,38,35,34,6,21,20,23,7,38,
+53,52,36,33,32,4,21,20,7,1,7,8,254,226,255,51,46,16,17,139,112,98,76,211,
+170,170,201,57,47,47,112,129,123,238,161,254,241,254,211,145,1,21,185,55,
+47,8,41,47,230,229,217,201,173,199,97,31,44,28,146,52,1,50,249,159,232,126,
+254,89,208,45,65,80,58,61,8,8,25,21,213,212,214,213,25,139,33,1,36,1,26,1,
+26,1,34,29,253,103,2,141,249,254,163,75,126,14,59,41,84,85,45,122,130,48,
+19,208,244,202,194,19,145,131,136,218,124,1,75,1,41,195,1,37,160,6,138,3,
+254,253,254,254,222,250,182,153,138,14,22,45,1,64,1,72,143,254,237,253,109,
+114,207,53,68,64,27,57,56,46,27,4,65,61,63,115,116,117,116,75,55,26,76,85,
+176,196,195,174,84,70,2,209,0,5,0,74,255,234,6,8,7,200,0,74,0,86,0,100,0,
+122,0,123,0,0,1,20,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,
+21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,39,
+6,7,22,21,20,6,35,34,38,38,53,52,54,54,51,51,50,54,55,38,35,35,53,52,54,51,
+50,22,5,50,22,23,54,53,52,38,35,34,6,7,19,6,35,35,34,6,21,20,22,51,50,54,
+53,52,19,54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,1,5,200,
+44,54,54,254,136,254,151,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,
+155,140,167,179,176,200,176,1,43,1,29,201,1,8,122,53,79,108,27,190,192,132,
+171,79,75,148,132,94,140,167,57,79,133,177,176,162,149,151,254,51,90,149,
+60,16,83,74,86,99,4,34,69,102,102,114,78,123,125,119,119,172,20,213,212,214,
+213,20,139,28,1,36,1,26,1,26,1,34,28,253,245,3,212,95,79,52,146,94,254,252,
+254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,140,
+147,183,203,99,172,114,116,66,72,35,49,60,115,109,55,98,68,78,82,39,50,46,
+30,83,181,193,143,179,25,25,37,44,76,80,99,88,254,134,10,38,42,48,38,41,60,
+44,3,8,52,68,115,116,117,116,65,53,24,72,75,176,196,195,174,81,69,2,205,0,
+3,0,62,255,234,6,77,7,200,0,86,0,108,0,109,0,0,1,20,7,39,54,53,52,35,34,6,
+7,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,
+38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,
+51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,38,35,35,53,52,54,51,50,22,37,
+54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,1,5,250,14,144,
+9,157,86,99,4,17,181,253,127,223,186,113,168,67,76,161,112,189,230,117,113,
+56,160,40,2,104,5,100,85,81,76,1,147,3,155,139,167,179,39,147,162,152,84,
+145,130,136,138,137,135,140,129,135,114,229,183,48,179,167,136,159,254,244,
+20,213,212,214,213,20,139,28,1,36,1,26,1,26,1,34,28,253,198,3,247,44,57,23,
+38,23,121,99,88,110,218,159,220,247,84,96,104,76,237,203,130,197,59,7,135,
+89,98,61,53,14,8,5,7,12,33,114,124,191,183,83,26,87,156,110,140,154,146,155,
+14,14,156,145,163,159,144,147,60,83,181,193,121,166,52,68,115,116,117,116,
+65,53,24,72,75,176,196,195,174,81,69,2,205,0,3,0,74,255,234,7,83,7,200,0,
+73,0,95,0,96,0,0,1,16,0,33,34,39,55,22,51,50,54,54,53,52,2,35,34,6,7,54,51,
+50,22,21,20,6,4,35,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,
+54,51,50,22,21,21,35,34,6,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,
+0,1,54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,1,7,83,254,
+201,254,246,57,54,8,44,40,150,198,94,199,176,157,203,54,44,49,114,128,141,
+254,243,190,179,254,244,146,1,9,1,1,34,5,99,85,157,9,144,14,155,140,167,179,
+176,197,179,239,205,212,237,98,32,43,28,145,49,1,52,225,247,1,19,254,2,19,
+213,212,214,213,18,143,22,1,36,1,26,1,26,1,34,25,253,93,2,121,254,212,254,
+174,6,138,3,121,222,154,215,1,5,201,193,17,146,132,136,221,119,126,242,169,
+205,212,90,97,121,23,38,23,48,54,114,124,193,181,83,139,152,177,205,182,162,
+129,13,23,45,1,65,1,71,254,178,1,127,56,60,115,116,117,116,59,54,14,63,69,
+176,196,195,174,78,65,2,198,0,5,0,68,254,79,5,253,7,200,0,53,0,69,0,93,0,
+94,0,95,0,0,1,21,33,32,4,7,22,22,51,50,54,55,23,2,33,34,36,39,6,17,20,0,33,
+32,36,53,52,39,55,22,21,20,0,33,34,36,2,53,52,18,55,55,38,53,52,54,51,50,
+23,54,54,51,50,22,5,54,36,51,51,38,38,35,34,7,35,38,38,35,34,6,1,54,53,52,
+38,35,34,6,21,20,23,7,38,38,53,52,36,33,50,22,22,21,20,7,1,3,5,182,254,239,
+254,242,254,184,108,28,211,179,200,197,14,147,43,254,11,232,254,234,47,136,
+1,56,1,24,1,19,1,38,3,148,5,254,126,254,179,237,254,176,173,126,125,17,2,
+183,154,136,79,41,124,73,158,180,252,36,108,1,56,204,220,5,104,89,144,21,
+137,3,76,65,96,103,3,25,32,198,194,196,198,32,135,19,25,1,22,1,7,174,243,
+122,44,253,196,30,3,112,83,49,55,173,173,140,145,8,254,90,203,204,123,254,
+254,241,254,238,206,186,24,29,8,31,41,249,254,234,162,1,49,199,170,1,0,94,
+12,38,39,187,225,106,49,57,197,220,47,48,91,96,136,64,72,145,1,42,70,77,111,
+120,121,112,77,68,38,42,107,43,167,201,90,169,109,97,95,2,246,248,34,0,5,
+0,74,254,15,7,67,7,200,0,97,0,122,0,132,0,133,0,134,0,0,1,38,53,52,55,6,6,
+21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,
+51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,0,17,16,7,22,21,16,
+0,33,32,36,53,52,55,23,21,20,30,2,51,50,62,2,53,52,39,6,4,35,34,36,38,53,
+52,36,33,51,38,38,35,34,21,20,23,1,54,53,52,38,35,34,6,21,20,22,23,7,38,38,
+53,52,36,33,50,4,22,21,20,7,7,38,39,22,23,22,22,51,50,54,1,19,2,26,9,16,156,
+165,113,134,63,66,151,1,33,188,25,33,40,23,166,181,225,171,187,94,1,16,240,
+222,1,57,165,87,43,120,71,119,123,16,40,7,51,1,100,1,117,117,49,254,143,254,
+147,254,171,254,174,2,148,55,117,204,153,168,230,127,59,15,112,254,201,198,
+206,254,213,157,1,39,1,7,123,5,99,85,157,5,3,201,23,223,224,221,223,161,155,
+21,222,220,1,50,1,29,194,1,11,133,35,245,107,179,22,5,4,52,55,50,70,253,85,
+233,3,163,50,35,46,42,42,242,182,234,161,73,104,245,127,186,1,20,146,4,4,
+190,184,83,64,125,97,180,207,166,1,67,214,207,157,57,63,144,144,111,93,23,
+3,124,114,254,49,254,194,254,235,198,140,137,254,222,254,239,221,244,26,20,
+8,11,103,123,79,42,64,110,147,105,65,55,108,108,131,241,163,191,228,90,97,
+121,19,24,1,222,62,72,127,121,111,119,90,88,10,138,21,163,147,173,196,91,
+172,116,94,91,93,125,89,49,112,87,62,47,2,227,254,93,0,3,0,78,255,234,6,114,
+7,200,0,52,0,75,0,76,0,0,1,16,0,33,35,34,39,55,22,51,50,54,17,52,38,35,34,
+6,6,21,21,35,53,52,38,38,35,34,6,21,16,22,51,50,55,23,6,35,32,0,17,16,18,
+51,50,22,23,54,54,51,50,22,18,1,54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,
+33,50,4,22,21,20,7,1,6,114,254,244,254,255,28,38,33,9,18,53,203,192,164,147,
+88,115,54,137,62,113,82,147,164,192,203,13,57,8,59,39,254,254,254,245,246,
+211,107,162,60,59,164,114,130,204,115,254,129,23,213,212,214,213,23,139,31,
+1,36,1,26,184,1,0,132,31,253,193,2,117,254,194,254,179,5,139,3,241,1,14,227,
+254,78,137,116,70,71,122,137,71,251,230,254,242,241,5,139,7,1,76,1,64,1,40,
+1,72,94,102,103,93,141,254,229,1,204,62,67,115,116,117,116,67,60,24,81,75,
+176,196,86,167,116,89,70,2,214,0,5,0,44,255,234,10,218,7,200,0,95,0,121,0,
+147,0,148,0,149,0,0,1,16,0,33,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,39,
+0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,
+50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,2,36,33,35,34,38,38,53,52,
+36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,22,51,51,32,4,18,5,54,51,
+50,22,23,54,36,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,
+51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,1,19,10,
+218,254,88,254,106,198,254,242,73,35,148,107,193,108,50,136,101,149,179,1,
+26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,94,135,35,153,1,68,227,172,
+144,74,111,167,179,248,177,186,89,1,5,230,221,1,47,151,173,254,223,254,242,
+104,158,143,85,1,52,1,44,1,74,1,80,16,25,136,30,254,252,254,254,235,226,76,
+145,132,1,66,1,114,183,247,177,101,136,173,238,65,57,1,2,188,145,5,99,85,
+157,5,144,10,10,102,101,213,254,192,254,218,89,134,63,4,102,104,104,105,137,
+113,102,102,110,232,219,133,156,5,213,126,3,1,254,140,254,93,111,111,108,
+114,180,94,86,187,176,46,73,1,112,184,157,66,71,30,45,39,29,82,78,121,135,
+102,96,123,116,40,40,193,181,83,69,126,91,180,207,153,1,37,196,233,1,14,119,
+48,112,89,155,167,195,187,50,84,56,42,66,80,123,118,89,91,54,52,181,254,171,
+125,36,113,112,117,121,90,97,121,19,24,24,42,43,45,31,22,109,254,234,101,
+187,23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,3,33,1,183,0,7,
+0,44,255,234,10,216,7,200,0,93,0,119,0,131,0,157,0,171,0,193,0,194,0,0,1,
+20,7,22,22,21,16,0,33,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,
+35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,
+21,21,35,34,6,21,20,4,33,32,36,53,52,39,6,7,22,21,20,6,35,34,38,53,52,54,
+54,51,51,50,54,55,38,35,35,53,52,54,51,50,22,5,54,51,50,22,23,54,54,51,51,
+38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,4,5,50,22,23,54,53,52,38,35,34,
+6,7,5,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,
+6,5,6,35,35,34,6,21,20,22,51,50,54,53,52,19,54,53,52,38,35,34,6,21,20,23,
+7,38,53,52,36,33,32,4,21,20,7,1,10,151,44,54,55,254,135,254,151,229,254,198,
+86,36,149,107,193,108,50,136,101,149,179,1,26,130,1,1,197,40,113,59,70,10,
+12,143,27,147,128,94,135,35,153,1,68,227,119,100,57,74,167,179,176,200,176,
+1,43,1,29,1,30,1,45,53,77,110,28,191,192,189,193,80,147,128,95,140,167,56,
+78,133,177,176,162,146,153,247,244,101,136,170,235,64,47,236,190,32,5,100,
+85,157,10,145,13,17,30,30,213,254,192,5,180,90,149,59,17,82,75,85,100,5,249,
+70,89,134,63,4,102,104,104,105,137,113,102,102,110,232,219,133,156,6,145,
+69,102,102,112,79,122,125,120,118,173,20,213,212,214,213,20,139,28,1,36,1,
+26,1,26,1,34,28,253,185,3,212,93,81,53,146,93,254,251,254,237,114,114,114,
+114,180,94,86,187,176,46,73,1,112,184,157,66,71,30,45,39,29,82,78,121,135,
+102,96,123,116,18,18,193,181,83,140,147,183,203,202,183,116,66,70,36,52,58,
+115,109,113,108,80,82,37,49,47,30,83,181,193,141,230,36,112,112,118,119,89,
+98,121,30,31,23,53,49,54,42,2,109,73,25,25,42,39,73,83,98,89,205,101,187,
+23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,198,10,37,43,48,38,
+41,60,44,3,8,52,68,115,116,117,116,65,53,24,72,75,176,196,195,174,81,69,2,
+205,0,5,0,78,255,234,10,8,7,200,0,105,0,118,0,119,0,120,0,121,0,0,1,16,2,
+35,34,38,39,6,6,35,34,38,39,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,2,
+17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,22,23,7,38,35,34,6,21,20,
+22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,52,2,38,36,35,35,34,38,38,53,
+52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,22,51,51,32,4,18,5,54,
+51,50,23,54,36,55,38,38,35,34,6,9,2,10,8,241,229,109,163,67,71,155,113,119,
+172,44,57,221,157,254,241,254,211,145,1,21,185,55,47,8,41,47,230,229,217,
+201,173,199,97,31,44,28,146,47,1,55,241,133,248,143,100,36,36,218,237,136,
+127,125,130,137,130,134,105,143,74,85,180,254,237,214,141,157,142,87,1,57,
+1,44,1,93,1,93,16,25,136,30,254,237,254,242,236,235,78,145,178,1,63,1,126,
+186,249,59,44,52,93,52,58,1,16,198,83,156,91,173,215,3,211,1,70,254,94,2,
+150,254,176,254,164,82,98,102,78,113,106,108,111,1,75,1,41,195,1,37,160,6,
+138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,66,1,70,113,139,150,
+3,213,192,157,169,145,156,14,14,156,145,119,238,178,189,1,20,181,83,47,112,
+87,156,169,191,191,50,84,56,42,66,80,127,114,90,90,55,51,194,254,131,243,
+20,57,154,159,2,66,58,203,2,130,1,183,251,146,0,3,0,74,255,234,7,67,7,200,
+0,101,0,102,0,103,0,0,1,16,0,33,34,36,38,53,52,54,55,6,35,35,53,33,38,38,
+35,34,6,21,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,38,53,52,18,36,51,50,
+23,54,51,50,22,21,21,35,34,14,3,21,20,22,51,50,36,18,53,52,46,3,35,35,34,
+38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,22,51,51,50,
+4,22,18,1,19,7,67,254,75,254,94,209,254,222,141,96,98,72,110,29,2,208,5,100,
+85,81,76,1,146,3,18,178,188,113,134,63,66,151,1,33,188,33,44,46,40,166,181,
+177,131,156,111,77,46,255,235,227,1,57,161,77,115,142,222,197,128,158,143,
+85,1,60,1,56,1,88,1,88,16,25,136,30,254,239,254,245,246,235,76,145,153,242,
+1,58,231,112,252,230,126,3,1,254,140,254,93,127,219,140,112,175,54,8,135,
+89,98,61,53,13,7,7,7,23,22,56,43,32,250,195,234,161,73,104,245,127,186,1,
+20,146,7,7,190,184,83,16,48,72,106,79,166,186,151,1,37,198,150,210,128,87,
+47,48,112,89,158,164,191,191,50,84,56,42,66,80,126,115,87,93,54,52,88,199,
+254,221,2,89,1,183,0,5,0,78,255,234,7,192,7,200,0,65,0,75,0,99,0,100,0,101,
+0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,38,35,34,0,21,20,23,7,38,
+53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,
+16,39,6,6,35,34,38,53,52,38,39,39,55,4,0,1,38,39,22,23,22,22,51,50,54,55,
+54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,20,7,37,3,7,192,
+251,236,112,167,69,74,158,116,188,221,185,173,24,26,216,255,0,80,143,87,1,
+67,1,12,168,144,41,187,211,141,132,134,132,137,136,137,116,149,73,168,41,
+135,79,119,123,18,37,5,53,1,164,1,151,254,102,116,180,22,5,4,52,55,51,75,
+169,23,234,231,231,232,161,155,21,221,221,1,60,1,41,1,44,1,53,35,253,6,253,
+2,128,254,184,254,178,83,97,103,77,255,230,182,244,44,3,254,253,232,186,155,
+49,191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,14,14,157,144,115,229,
+175,1,99,226,72,81,144,144,113,90,23,2,126,138,253,230,1,28,112,84,49,113,
+87,62,53,174,62,72,129,119,110,120,90,88,10,143,21,165,150,174,195,199,180,
+94,91,178,1,163,0,7,0,44,255,234,10,65,7,200,0,67,0,77,0,89,0,106,0,130,0,
+131,0,132,0,0,1,16,2,4,33,34,36,39,6,6,35,34,36,53,53,7,39,0,55,38,35,34,
+6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,4,23,7,6,6,21,20,22,51,
+50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,0,37,38,39,22,23,22,22,
+51,50,54,1,54,54,55,38,35,32,7,54,51,50,22,5,6,7,23,6,21,20,22,51,50,54,53,
+52,38,35,34,6,1,54,53,52,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,
+21,20,7,37,1,10,65,188,254,149,254,255,213,254,230,70,58,247,189,240,254,
+242,74,130,1,5,190,39,111,59,70,10,12,143,27,147,128,92,130,39,149,1,36,156,
+169,1,48,112,56,202,201,246,237,211,1,40,154,86,42,122,71,119,123,19,35,9,
+51,1,98,1,119,254,196,109,178,22,5,4,52,55,48,71,251,238,44,178,135,178,225,
+254,223,255,88,109,141,196,253,71,88,71,70,12,194,186,208,206,191,178,90,
+150,7,58,23,223,224,221,223,161,155,21,221,221,1,50,1,29,1,37,1,45,35,253,
+49,254,209,3,71,254,250,254,119,206,121,122,122,121,215,203,25,126,73,1,121,
+184,148,66,71,30,45,39,29,82,78,121,135,94,93,119,109,136,124,143,17,182,
+165,177,186,172,1,75,211,201,154,57,65,144,144,124,82,21,3,124,113,254,53,
+162,126,87,49,112,87,62,45,253,241,100,124,23,143,223,28,98,102,102,98,5,
+44,56,143,147,177,164,154,160,27,2,169,62,72,127,121,111,119,90,88,10,143,
+21,165,150,173,196,201,178,94,91,178,1,163,0,5,0,44,255,234,10,87,7,200,0,
+90,0,115,0,132,0,133,0,134,0,0,1,16,0,33,34,36,39,6,6,35,34,36,53,53,7,39,
+0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,23,54,51,50,
+22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,2,36,33,35,34,38,38,53,52,36,
+33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,22,51,51,32,4,18,1,54,54,51,
+51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,32,5,54,51,50,22,5,6,7,23,6,21,
+20,22,51,50,54,53,52,38,35,34,6,1,19,10,87,254,88,254,106,209,254,233,70,
+57,250,194,240,254,242,74,130,1,5,190,39,111,59,70,10,12,143,27,147,128,184,
+77,149,1,36,156,160,130,76,114,166,180,248,177,186,89,1,5,230,221,1,47,151,
+173,254,223,254,242,104,158,143,85,1,52,1,44,1,74,1,80,16,25,136,30,254,252,
+254,254,235,226,76,145,132,1,66,1,114,183,250,134,60,246,185,145,5,99,85,
+157,5,144,10,9,95,109,254,223,255,0,88,110,146,201,253,61,88,71,70,12,194,
+186,208,206,191,178,90,150,5,117,126,3,1,254,140,254,93,124,125,125,124,215,
+203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,135,187,119,109,43,
+43,191,183,83,69,126,91,180,207,153,1,37,196,233,1,14,119,48,112,89,155,167,
+195,187,50,84,56,42,66,80,123,118,89,91,54,52,181,254,171,254,226,105,105,
+90,97,121,19,24,24,42,43,40,33,25,223,28,99,101,102,98,5,44,56,143,147,177,
+164,154,160,27,3,33,1,183,0,4,0,78,255,234,7,188,7,200,0,84,0,85,0,86,0,87,
+0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,38,35,34,0,21,20,23,7,38,
+53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,
+2,38,36,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,32,6,
+21,20,22,51,51,32,4,18,1,19,3,7,188,247,235,112,169,71,75,156,114,188,221,
+185,173,24,26,216,255,0,80,143,87,1,67,1,12,168,144,41,187,211,141,132,134,
+132,137,135,139,166,167,85,180,254,237,214,181,158,143,85,1,67,1,65,1,93,
+1,102,16,25,136,30,254,234,254,240,254,250,244,78,145,218,1,63,1,126,186,
+252,9,126,226,2,150,254,174,254,166,83,97,105,75,255,230,182,244,44,3,254,
+253,232,186,155,49,191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,14,
+14,156,145,1,11,1,12,189,1,20,181,83,48,111,87,161,164,185,197,50,84,56,42,
+66,80,130,111,86,94,55,51,194,254,131,2,86,1,183,253,30,0,3,0,74,255,234,
+7,67,7,200,0,95,0,96,0,97,0,0,1,16,0,33,34,36,38,53,52,54,54,51,51,38,38,
+35,34,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,
+51,50,22,21,21,33,34,6,6,21,20,4,51,50,62,3,53,52,38,38,36,35,35,34,38,38,
+53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,22,51,51,50,4,22,
+18,1,3,7,67,254,75,254,94,205,254,212,156,132,250,214,127,5,100,85,157,6,
+145,9,21,177,191,113,134,63,66,151,1,33,188,39,41,39,44,166,181,254,245,175,
+185,92,1,15,239,145,224,159,113,61,88,181,255,0,228,128,158,143,85,1,60,1,
+56,1,88,1,88,16,25,136,30,254,239,254,245,246,235,76,145,153,242,1,58,231,
+112,252,230,74,3,1,254,140,254,93,131,242,162,125,190,104,89,98,121,19,24,
+24,50,35,54,45,32,249,196,234,161,73,104,245,127,186,1,20,146,8,8,191,183,
+83,65,125,96,181,206,59,103,154,200,126,157,231,162,72,48,112,89,158,164,
+191,191,50,84,56,42,66,80,126,115,87,93,54,52,88,199,254,221,2,89,1,183,0,
+7,0,58,255,234,10,96,7,200,0,69,0,79,0,90,0,104,0,105,0,129,0,130,0,0,1,16,
+2,4,33,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,
+22,23,7,38,53,52,54,51,50,23,54,36,51,32,1,7,4,17,20,22,51,50,36,18,53,52,
+39,6,6,35,34,38,53,52,38,39,39,55,4,0,37,38,39,22,23,22,22,51,50,54,1,54,
+51,50,22,23,54,37,38,35,32,3,6,6,7,22,22,51,50,54,53,52,38,35,34,1,5,54,53,
+52,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,20,7,1,10,96,188,254,
+149,254,255,214,254,228,69,59,255,0,196,254,211,254,149,48,146,5,9,20,72,
+94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,192,69,99,1,11,156,1,81,1,
+10,56,254,109,246,237,211,1,40,154,86,42,122,71,119,123,19,35,9,51,1,98,1,
+119,254,196,109,178,22,5,4,52,55,48,71,250,7,49,46,142,197,56,89,1,10,177,
+233,254,246,216,55,223,193,65,247,200,208,225,194,175,67,4,68,2,73,23,223,
+224,221,223,161,155,21,221,221,1,50,1,29,1,37,1,45,35,251,227,3,71,254,250,
+254,119,206,123,123,123,123,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,
+67,30,45,39,29,82,78,121,135,200,118,123,254,252,143,33,254,181,177,186,172,
+1,75,211,201,154,57,65,144,144,124,82,21,3,124,113,254,53,162,126,87,49,112,
+87,62,45,254,173,7,95,94,194,47,143,254,173,171,169,5,156,150,184,166,149,
+156,3,26,140,62,72,127,121,111,119,90,88,10,143,21,165,150,173,196,201,178,
+94,91,2,85,0,5,0,58,253,213,8,247,7,200,0,79,0,107,0,121,0,143,0,144,0,0,
+5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,
+7,38,53,52,54,51,50,22,23,54,36,51,50,23,55,54,54,51,50,22,21,21,33,34,14,
+2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,35,6,1,
+54,51,50,22,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,53,38,38,35,34,6,
+7,6,6,7,22,22,51,50,54,53,52,38,35,34,1,54,53,52,38,35,34,6,21,20,23,7,38,
+53,52,54,51,50,4,21,20,7,1,7,16,195,254,245,64,59,255,0,197,254,211,254,149,
+48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,96,130,35,
+99,1,11,156,215,174,10,37,112,88,171,182,254,197,178,176,122,54,240,226,205,
+177,42,89,105,132,194,82,64,33,88,122,150,165,86,25,11,251,241,49,46,149,
+202,54,42,153,221,185,175,5,102,89,83,80,3,147,4,78,165,103,127,211,132,55,
+223,193,65,247,200,208,225,194,175,67,4,232,34,185,177,170,172,27,138,36,
+253,237,245,1,7,46,253,236,22,126,122,124,124,1,66,1,59,24,32,36,1,17,55,
+105,77,133,120,70,67,30,45,39,29,82,78,121,135,100,100,118,123,93,11,41,41,
+193,181,83,34,85,126,84,159,185,88,137,47,25,108,139,171,31,131,40,162,145,
+123,104,1,3,166,7,104,104,73,99,49,88,99,62,50,18,12,18,29,21,20,44,41,101,
+238,171,169,5,156,150,184,166,149,156,1,222,82,79,109,123,114,98,60,63,34,
+86,76,160,191,203,167,94,117,3,11,0,5,0,58,254,42,8,200,7,200,0,88,0,116,
+0,130,0,152,0,153,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,
+38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,55,54,54,
+51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,53,
+53,52,55,23,21,20,22,51,50,54,54,53,52,39,52,39,6,1,54,51,50,22,23,62,2,51,
+51,38,38,35,34,6,21,20,23,7,38,53,53,38,38,35,34,6,7,6,6,7,22,22,51,50,54,
+53,52,38,35,34,1,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,4,21,20,
+7,1,7,16,195,254,245,64,59,255,0,197,254,211,254,149,48,146,5,9,20,72,94,
+93,77,29,17,83,70,62,67,10,12,143,27,147,128,96,130,35,99,1,11,156,215,174,
+10,37,112,88,171,182,254,197,178,176,122,54,240,226,205,177,42,26,7,9,254,
+250,254,253,255,0,254,250,1,149,181,187,123,163,85,2,1,106,251,96,49,46,149,
+202,54,42,153,221,185,175,5,102,89,83,80,3,147,4,78,165,103,127,211,132,55,
+223,193,65,247,200,208,225,194,175,67,4,232,34,185,177,170,172,27,138,36,
+253,237,245,1,7,46,253,236,22,126,122,124,124,1,66,1,59,24,32,36,1,17,55,
+105,77,133,120,70,67,30,45,39,29,82,78,121,135,100,100,118,123,93,11,41,41,
+193,181,83,34,85,126,84,159,185,88,137,14,3,43,70,196,219,206,191,17,11,9,
+7,7,150,125,55,124,111,19,14,7,5,32,3,166,7,104,104,73,99,49,88,99,62,50,
+18,12,18,29,21,20,44,41,101,238,171,169,5,156,150,184,166,149,156,1,222,82,
+79,109,123,114,98,60,63,34,86,76,160,191,203,167,94,117,3,11,0,5,0,58,255,
+234,10,194,7,200,0,104,0,116,0,130,0,131,0,132,0,0,1,16,2,35,34,38,39,6,6,
+35,34,38,39,6,6,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,
+7,38,53,52,54,51,50,23,54,36,51,50,4,23,7,6,6,21,20,22,51,50,54,53,53,51,
+21,20,22,51,50,18,17,52,2,38,36,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,
+39,54,53,52,36,33,34,6,21,20,22,51,51,32,4,18,5,54,51,50,22,23,54,54,55,38,
+35,32,3,6,6,7,22,22,51,50,54,53,52,38,35,34,1,3,10,194,241,229,109,164,67,
+72,154,112,121,171,44,63,250,187,254,211,254,149,48,146,5,9,20,72,94,93,77,
+29,17,83,70,62,67,10,12,143,27,147,128,192,69,99,1,11,156,168,1,46,133,61,
+189,209,136,127,124,131,137,130,134,159,163,85,180,254,237,214,141,157,142,
+87,1,57,1,44,1,93,1,93,16,25,136,30,254,237,254,242,236,235,78,145,178,1,
+63,1,126,186,248,75,49,46,146,201,55,48,174,126,177,233,254,246,216,55,223,
+193,65,247,200,208,225,194,175,67,5,93,74,2,150,254,176,254,164,83,97,104,
+76,116,108,112,112,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,
+39,29,82,78,121,135,200,118,123,130,130,140,11,218,175,157,169,143,158,14,
+14,156,145,1,15,1,8,189,1,20,181,83,47,112,87,156,169,191,191,50,84,56,42,
+66,80,127,114,90,90,55,51,194,254,131,43,7,101,101,104,127,23,143,254,173,
+171,169,5,156,150,184,166,149,156,3,6,1,183,0,5,0,58,255,234,10,118,7,200,
+0,96,0,121,0,135,0,136,0,137,0,0,1,16,0,33,34,36,39,6,4,35,32,0,3,55,22,23,
+23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,
+50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,2,36,33,35,34,
+38,38,53,52,36,33,32,4,21,20,6,7,39,54,53,52,36,33,34,6,21,20,22,51,51,32,
+4,18,5,54,51,50,22,23,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,
+34,3,6,6,7,22,22,51,50,54,53,52,38,35,34,1,3,10,118,254,88,254,106,212,254,
+231,69,58,254,254,200,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,
+70,62,67,10,12,143,27,147,128,96,130,35,99,1,11,156,158,138,75,127,166,180,
+248,177,186,89,1,5,230,221,1,47,151,173,254,223,254,242,104,158,143,85,1,
+52,1,44,1,73,1,81,16,25,136,30,254,252,254,254,235,226,76,145,132,1,66,1,
+114,183,248,151,49,46,145,200,55,60,251,180,145,5,99,85,157,5,144,10,8,97,
+124,253,217,55,223,193,65,247,200,208,225,194,175,67,5,13,74,3,1,254,140,
+254,93,128,129,129,128,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,
+45,39,29,82,78,121,135,100,100,118,123,51,51,191,183,83,69,126,91,180,207,
+153,1,37,196,233,1,14,119,48,112,89,155,167,193,189,50,84,56,42,66,80,123,
+118,89,91,54,52,181,254,171,96,7,100,99,104,108,90,97,121,19,24,24,42,43,
+41,26,31,254,173,171,169,5,156,150,184,166,149,156,3,6,1,183,0,3,0,15,255,
+234,4,183,7,200,0,74,0,97,0,98,0,0,1,20,7,39,54,53,52,38,35,34,6,7,22,18,
+21,20,6,35,34,38,39,38,39,6,7,39,62,2,55,62,2,53,52,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,21,20,6,6,7,6,7,22,23,30,2,51,50,54,53,52,38,39,53,52,
+54,51,50,22,39,54,53,52,38,35,34,6,21,20,23,7,38,53,52,36,51,50,22,22,21,
+20,7,1,4,172,13,145,10,61,63,65,81,8,208,229,239,214,112,203,138,47,44,26,
+16,146,2,42,73,80,79,70,39,66,60,57,60,8,144,13,146,118,127,151,45,85,97,
+31,26,37,117,82,86,100,57,148,157,221,212,166,147,127,132,216,20,182,179,
+179,183,19,140,26,1,4,249,162,228,118,28,254,24,3,247,48,53,23,31,30,63,58,
+93,94,30,254,255,202,225,240,66,88,30,15,62,126,30,65,139,142,130,129,134,
+134,61,82,84,63,54,32,33,23,42,60,111,127,156,137,79,169,158,151,49,48,12,
+64,46,38,23,159,155,171,188,4,31,224,198,123,165,60,61,115,118,118,115,68,
+46,24,64,79,172,200,88,171,113,76,76,2,210,0,5,0,44,255,234,7,196,7,200,0,
+86,0,95,0,121,0,122,0,123,0,0,1,20,2,6,35,34,39,55,22,51,50,54,53,16,0,35,
+34,4,7,54,51,32,0,21,20,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,6,21,
+20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,38,53,52,55,38,35,34,6,
+6,21,20,23,7,38,53,52,36,33,32,4,21,20,6,7,22,18,1,6,21,20,22,51,50,53,52,
+1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,
+1,1,7,196,117,216,138,45,45,8,29,36,160,175,254,228,254,194,254,196,136,101,
+136,1,14,1,46,189,160,196,99,50,136,101,149,179,1,26,130,1,12,186,40,113,
+59,70,10,12,143,27,147,128,94,136,35,156,1,66,224,29,54,87,87,92,106,142,
+196,104,84,131,100,1,44,1,33,1,47,1,58,105,101,189,193,254,54,88,64,56,107,
+251,108,89,134,63,4,102,104,104,105,137,113,102,102,110,232,219,133,156,2,
+147,1,75,2,61,174,254,251,143,6,138,3,232,203,1,1,1,25,110,116,36,254,237,
+251,186,229,180,94,86,187,176,46,73,1,127,169,157,66,71,30,45,39,29,82,78,
+121,135,101,97,125,114,4,61,130,101,95,13,50,107,85,90,106,63,130,140,176,
+199,186,165,105,124,10,72,254,182,3,36,68,95,53,59,105,120,252,195,101,187,
+23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,4,216,252,241,0,7,
+0,74,255,234,6,180,7,200,0,68,0,83,0,92,0,102,0,103,0,104,0,105,0,0,5,34,
+39,6,7,39,54,18,53,52,38,35,34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,
+38,53,52,18,36,51,50,0,21,20,7,51,22,22,51,50,18,17,52,2,36,33,35,34,38,38,
+53,52,36,33,32,4,21,20,6,7,22,18,21,16,2,1,50,23,38,53,52,55,38,35,32,6,21,
+20,22,51,37,6,21,20,22,51,50,53,52,1,22,51,50,54,53,52,38,35,34,9,2,4,254,
+191,51,41,87,109,135,118,194,179,136,206,113,21,136,165,120,143,154,143,129,
+201,108,151,1,20,181,250,1,13,87,40,5,60,71,124,147,150,254,205,254,215,209,
+158,143,85,1,74,1,69,1,114,1,118,92,90,143,144,229,253,110,166,125,15,95,
+125,197,254,243,249,78,145,2,235,89,64,56,107,251,117,73,131,77,75,67,59,
+121,1,95,1,70,254,30,22,170,63,107,96,147,1,7,146,168,198,119,223,148,109,
+71,153,137,105,124,135,136,243,146,189,1,32,157,254,243,226,185,175,79,80,
+1,25,1,22,228,1,57,165,48,111,87,162,163,193,179,90,112,15,98,254,172,252,
+254,166,254,156,6,16,29,35,49,110,96,25,86,94,55,51,222,68,95,54,60,105,111,
+250,53,92,57,60,48,61,4,187,1,183,253,30,0,4,0,78,255,234,6,244,7,200,0,80,
+0,89,0,90,0,91,0,0,1,16,0,33,34,39,55,22,51,50,54,53,52,2,35,34,6,7,54,51,
+50,22,21,20,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,2,17,20,22,51,50,
+54,53,52,35,34,6,7,39,18,18,55,38,53,52,55,38,35,34,6,21,20,23,7,38,53,52,
+36,33,32,4,21,20,7,22,18,1,6,21,20,22,51,50,53,52,3,1,6,244,254,201,254,246,
+57,54,8,44,41,216,226,202,174,158,203,53,40,54,112,129,123,238,161,254,241,
+254,211,145,1,21,185,55,47,8,41,47,230,229,217,201,173,199,97,31,44,28,146,
+41,250,199,126,87,88,94,214,213,25,138,34,1,36,1,26,1,37,1,52,149,184,199,
+253,252,88,64,56,107,107,254,171,2,121,254,212,254,174,6,138,3,255,242,215,
+1,5,203,193,19,145,131,136,218,124,1,75,1,41,195,1,37,160,6,138,3,254,253,
+254,254,222,250,182,153,138,14,22,45,1,21,1,72,35,47,148,101,96,12,117,116,
+69,65,27,85,81,176,196,188,163,164,41,44,254,192,2,220,68,95,53,59,105,118,
+254,169,3,13,0,4,0,62,255,234,6,77,7,200,0,123,0,132,0,133,0,134,0,0,1,20,
+7,39,54,53,52,35,34,6,7,51,32,0,21,20,6,35,34,39,39,54,53,52,38,35,34,6,21,
+20,23,7,6,35,34,38,53,16,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,
+53,52,54,51,50,22,21,21,35,34,14,3,21,20,22,51,50,55,38,53,52,54,51,51,50,
+22,21,20,7,22,51,50,54,53,52,38,38,35,35,53,52,54,55,38,53,52,55,38,35,34,
+6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,22,22,1,6,21,20,22,51,50,53,52,3,
+3,5,250,14,144,9,157,86,99,4,17,1,16,1,33,221,197,148,112,15,90,80,78,84,
+77,90,15,112,143,193,230,229,71,144,40,2,104,5,100,85,81,76,1,147,3,155,139,
+167,179,55,120,140,130,89,50,146,140,70,33,80,157,139,15,139,157,82,35,71,
+142,143,112,229,185,48,105,106,168,89,74,90,214,213,20,139,28,1,36,1,26,1,
+26,1,43,121,105,108,254,139,89,64,56,107,99,241,3,247,44,57,23,38,23,121,
+99,88,254,255,250,212,235,39,135,23,75,51,54,57,48,75,23,135,39,233,205,1,
+11,121,7,135,89,98,61,53,14,8,5,7,12,33,114,124,191,183,83,18,58,86,134,84,
+147,155,6,59,96,101,118,119,104,91,59,7,155,156,141,158,72,83,142,177,35,
+35,172,103,95,11,117,116,65,53,24,72,75,176,196,190,161,148,48,18,120,1,242,
+66,98,53,59,105,118,254,169,3,13,0,7,0,52,255,234,6,206,7,200,0,83,0,98,0,
+108,0,119,0,120,0,121,0,122,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,
+55,55,62,2,53,52,38,35,35,22,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,
+6,6,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,38,36,35,35,
+34,38,38,53,52,36,33,50,4,22,21,20,6,7,22,18,1,50,23,38,53,52,55,38,35,32,
+6,21,20,22,51,37,6,21,20,22,51,50,53,52,38,1,6,6,21,20,22,51,50,54,53,52,
+1,1,3,6,206,247,235,114,169,67,67,167,113,189,221,203,238,71,82,75,38,174,
+177,6,21,22,143,108,114,129,242,230,242,243,79,155,122,189,161,136,129,139,
+135,138,135,139,166,167,85,180,254,237,214,181,158,143,85,1,67,1,65,245,1,
+70,161,92,92,142,142,252,137,170,126,15,95,122,189,254,250,244,78,145,2,213,
+90,64,56,107,66,251,214,88,82,53,51,54,52,2,136,254,252,101,2,150,254,174,
+254,166,85,95,98,82,211,185,166,203,70,21,24,31,49,42,72,67,33,80,35,111,
+118,122,101,135,154,139,137,83,98,72,31,48,151,121,122,128,141,160,14,14,
+156,145,1,11,1,12,189,1,20,181,83,48,111,87,161,164,89,167,116,90,113,15,
+97,254,158,2,100,30,35,50,110,96,25,86,94,55,51,222,68,95,54,60,105,51,89,
+253,157,13,72,48,48,54,55,49,79,3,167,254,73,252,149,0,4,0,77,255,234,8,56,
+7,200,0,95,0,104,0,105,0,106,0,0,1,16,0,33,34,39,55,22,51,50,54,53,52,2,35,
+34,6,7,54,51,50,22,21,20,0,35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,
+7,38,53,16,0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,18,
+55,38,53,52,55,38,35,32,21,20,23,7,38,53,52,36,33,50,4,22,21,20,7,30,2,1,
+6,21,20,22,51,50,53,52,3,3,8,56,254,201,254,246,56,56,9,27,57,217,225,201,
+174,158,203,54,45,49,113,129,254,224,244,182,254,127,1,2,230,62,108,147,223,
+122,55,51,135,121,1,93,1,37,91,183,79,54,140,208,115,214,204,178,195,98,31,
+44,28,146,42,250,199,126,87,80,102,254,85,19,144,22,1,36,1,26,196,1,13,136,
+149,125,174,84,253,252,88,64,56,107,131,241,2,121,254,212,254,174,6,138,3,
+255,242,215,1,5,203,193,19,145,131,214,254,248,145,1,5,176,225,1,39,30,13,
+125,224,152,107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,206,218,
+179,154,140,14,22,45,1,23,1,70,35,47,148,101,96,12,233,61,54,11,60,71,176,
+196,85,159,107,164,41,30,171,251,3,53,69,95,53,59,105,119,254,168,3,13,0,
+5,0,62,255,234,6,59,7,200,0,68,0,83,0,92,0,93,0,94,0,0,1,16,0,33,34,36,38,
+53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,
+21,21,35,34,14,2,21,20,22,51,32,0,17,52,38,38,36,35,35,34,38,38,53,52,36,
+33,50,4,22,21,20,6,7,22,18,1,50,23,38,53,52,55,38,35,34,6,21,20,22,51,37,
+6,21,20,22,51,50,53,52,1,1,6,59,254,74,254,94,207,254,222,142,99,94,70,111,
+50,2,229,6,100,85,79,78,1,146,3,155,139,167,179,177,172,160,129,60,255,235,
+1,90,1,100,85,181,254,255,231,128,158,143,85,1,60,1,56,239,1,61,157,95,94,
+138,132,252,124,188,141,16,95,127,174,246,235,76,145,2,180,90,64,56,107,254,
+196,254,252,3,1,254,140,254,93,127,219,140,116,173,51,7,135,89,98,59,55,13,
+7,7,7,23,22,114,124,193,181,83,26,84,126,85,166,186,1,84,1,46,152,231,165,
+74,48,112,89,158,164,91,167,114,91,114,13,95,254,204,2,52,31,37,49,110,96,
+25,87,93,54,52,222,66,97,54,60,105,112,1,44,254,73,0,7,0,74,255,234,6,69,
+7,200,0,87,0,99,0,112,0,121,0,122,0,123,0,124,0,0,1,23,4,7,54,51,50,22,22,
+21,20,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,
+53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,32,36,53,52,39,6,6,35,34,38,38,
+53,52,18,55,38,38,53,52,55,6,6,21,20,22,23,7,36,53,52,54,36,51,50,22,21,20,
+7,37,6,21,20,22,51,50,54,53,52,38,35,3,50,22,23,52,55,53,52,38,35,34,6,7,
+21,22,22,51,50,55,38,38,35,1,5,1,5,245,60,254,194,170,53,57,88,123,62,11,
+48,48,254,125,254,141,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,
+140,167,179,176,199,177,1,48,1,24,1,38,1,57,13,45,137,91,78,128,83,173,164,
+93,91,27,124,159,87,88,48,254,238,165,1,16,153,142,158,9,254,200,32,61,53,
+55,49,89,81,138,89,150,61,1,85,82,79,101,12,4,69,92,125,44,46,147,101,253,
+215,4,115,254,52,6,123,129,115,191,30,81,150,103,74,57,52,137,86,254,251,
+254,237,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,142,
+149,178,204,206,187,65,42,71,70,68,171,138,176,1,52,119,11,108,83,62,55,43,
+191,91,77,74,11,134,59,240,120,227,134,135,118,29,26,177,65,60,53,61,54,52,
+63,70,252,146,26,26,9,8,18,107,107,105,92,135,75,104,118,30,31,3,148,198,
+1,221,0,7,0,74,255,234,6,18,7,200,0,89,0,102,0,115,0,120,0,121,0,122,0,123,
+0,0,1,23,6,6,7,54,51,50,22,21,20,6,7,22,22,21,16,0,33,34,36,38,53,52,36,33,
+51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,
+36,54,53,52,38,35,35,53,52,54,55,54,55,38,38,53,52,55,6,6,21,20,22,23,7,38,
+38,53,52,54,36,51,50,22,22,21,20,7,37,34,7,6,21,20,22,51,50,54,53,52,38,3,
+7,20,30,2,51,50,53,52,38,35,34,7,38,39,6,7,1,5,1,5,213,61,148,190,42,26,18,
+119,146,56,55,86,86,254,136,254,151,245,254,184,160,1,9,1,4,31,5,99,85,157,
+9,144,14,155,140,167,179,176,199,177,1,48,1,24,194,1,8,129,178,198,177,91,
+88,33,121,100,105,26,123,154,112,101,34,165,161,164,1,15,152,97,135,66,7,
+254,215,9,8,32,61,53,53,51,88,88,1,8,23,45,32,81,71,65,34,115,26,10,28,3,
+254,26,4,25,254,112,6,123,129,51,140,89,4,119,101,69,90,20,52,171,118,254,
+252,254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,
+83,142,149,178,204,96,172,113,151,141,83,123,172,42,133,111,6,107,91,61,55,
+44,189,91,87,71,8,137,25,149,132,121,226,134,64,114,75,31,20,173,1,65,59,
+53,61,52,54,62,71,253,77,26,52,48,40,23,89,46,58,191,39,66,46,59,3,13,198,
+1,221,0,8,0,44,255,234,11,38,7,200,0,90,0,105,0,114,0,128,0,154,0,155,0,156,
+0,157,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,34,39,6,6,35,34,38,39,
+7,39,0,55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,36,51,32,5,7,14,
+2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,38,36,35,35,34,38,
+38,53,52,36,33,50,4,22,21,20,6,7,22,18,1,38,53,52,55,38,35,34,6,21,20,22,
+51,51,50,37,6,21,20,22,51,50,53,52,1,54,51,50,22,23,54,54,55,38,38,35,34,
+4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,
+6,1,1,3,11,38,241,229,109,163,67,71,155,113,108,162,46,40,139,94,193,108,
+50,136,101,149,179,1,26,130,1,12,186,40,113,59,70,22,143,27,147,128,95,134,
+35,146,1,53,220,1,92,1,21,53,123,180,93,136,127,125,130,137,130,134,159,163,
+85,180,254,237,214,141,157,142,87,1,57,1,44,239,1,66,162,94,90,142,142,253,
+178,16,95,125,181,236,235,78,145,178,165,1,86,90,64,56,107,248,88,99,138,
+170,245,64,46,181,135,116,210,129,186,254,211,254,222,89,134,63,4,102,104,
+104,105,137,113,102,102,110,232,219,133,156,6,47,254,252,1,2,150,254,176,
+254,164,82,98,102,78,98,93,94,97,180,94,86,187,176,46,73,1,127,169,157,66,
+71,45,69,29,82,78,121,135,102,95,119,119,249,151,6,104,178,116,157,169,145,
+156,14,14,156,145,1,15,1,8,189,1,20,181,83,47,112,87,156,169,89,167,116,91,
+112,14,99,254,158,2,70,38,48,110,96,25,90,90,55,51,222,66,97,54,60,105,112,
+252,215,36,122,119,122,146,25,76,67,112,254,237,101,187,23,33,139,120,146,
+155,14,22,135,158,133,134,188,200,27,4,216,254,73,253,76,0,6,0,74,253,213,
+10,129,7,200,0,116,0,125,0,152,0,178,0,179,0,180,0,0,5,34,38,39,6,6,35,34,
+39,6,6,35,34,38,39,7,39,0,55,38,38,35,34,6,21,20,23,7,38,38,53,53,52,55,6,
+21,20,22,23,7,38,38,53,52,0,55,54,51,50,22,23,54,36,51,50,22,23,54,51,38,
+53,52,55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,22,21,20,6,7,22,22,21,
+21,33,34,14,2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,
+52,55,35,6,19,6,21,20,22,51,50,53,52,1,54,51,50,22,23,54,36,33,51,38,38,35,
+34,6,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,
+51,21,20,22,51,50,54,53,52,38,35,34,6,1,1,8,154,182,252,70,37,146,104,193,
+107,52,135,100,150,179,1,26,130,1,1,197,20,76,56,59,70,21,143,9,15,1,142,
+69,83,132,88,82,1,15,233,15,26,105,142,36,154,1,69,225,124,192,95,73,144,
+103,92,66,63,170,172,27,138,36,253,237,187,245,110,114,107,90,91,254,197,
+178,176,122,54,240,226,205,177,43,90,105,132,195,81,64,33,88,122,149,166,
+86,25,11,147,94,64,56,107,249,244,101,135,175,240,65,53,1,17,1,33,174,5,102,
+89,83,80,3,147,4,2,157,171,212,254,192,254,217,100,122,62,4,102,104,104,105,
+137,114,102,102,110,232,220,133,156,5,210,254,211,22,106,106,105,107,180,
+95,85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,26,104,41,9,5,5,122,245,
+118,199,117,78,130,252,138,240,1,68,17,4,99,98,124,114,35,37,72,53,134,104,
+98,7,114,98,60,63,34,86,76,160,191,98,158,95,101,117,4,42,170,129,83,34,85,
+126,84,159,185,88,137,47,25,108,139,171,31,131,40,162,145,123,104,1,6,97,
+69,99,53,59,105,125,253,90,36,117,116,114,132,88,99,63,49,11,19,18,29,21,
+33,12,60,109,254,234,113,175,23,33,137,122,146,155,14,22,135,158,133,134,
+187,201,27,1,203,3,13,0,6,0,74,254,42,10,83,7,200,0,123,0,132,0,159,0,185,
+0,186,0,187,0,0,5,34,38,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,38,35,
+34,6,21,20,23,7,38,38,53,53,52,55,6,21,20,22,23,7,38,38,53,52,0,55,54,51,
+50,22,23,54,36,51,50,22,23,54,51,38,53,52,55,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,22,21,20,6,7,22,22,21,21,33,34,14,2,21,20,22,51,50,55,23,7,
+22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,50,54,53,52,39,52,39,6,19,
+6,21,20,22,51,50,53,52,1,54,51,50,22,23,54,36,33,51,38,38,35,34,6,21,20,23,
+7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,
+50,54,53,52,38,35,34,6,1,1,8,154,182,252,70,37,146,104,193,107,52,135,100,
+150,179,1,26,130,1,1,197,20,76,56,59,70,21,143,9,15,1,142,69,83,132,88,82,
+1,15,233,15,26,105,142,36,154,1,69,225,124,192,95,73,144,103,92,66,63,170,
+172,27,138,36,253,237,187,245,110,114,107,90,91,254,197,178,176,122,54,240,
+226,205,177,43,34,9,254,250,254,253,255,0,254,250,1,149,181,187,188,183,2,
+1,112,8,94,64,56,107,249,244,101,135,175,240,65,53,1,17,1,33,174,5,102,89,
+83,80,3,147,4,2,157,171,212,254,192,254,217,100,122,62,4,102,104,104,105,
+137,114,102,102,110,232,220,133,156,5,210,254,211,22,106,106,105,107,180,
+95,85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,26,104,41,9,5,5,122,245,
+118,199,117,78,130,252,138,240,1,68,17,4,99,98,124,114,35,37,72,53,134,104,
+98,7,114,98,60,63,34,86,76,160,191,98,158,95,101,117,4,42,170,129,83,34,85,
+126,84,159,185,88,137,17,43,70,196,219,206,191,17,11,9,7,7,150,125,131,159,
+19,14,7,5,32,6,97,69,99,53,59,105,125,253,90,36,117,116,114,132,88,99,63,
+49,11,19,18,29,21,33,12,60,109,254,234,113,175,23,33,137,122,146,155,14,22,
+135,158,133,134,187,201,27,1,203,3,13,0,5,0,77,253,213,9,124,7,200,0,114,
+0,123,0,149,0,150,0,151,0,0,5,34,36,39,6,6,35,34,38,2,53,52,0,55,38,35,34,
+6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,
+34,6,7,39,18,0,33,50,23,54,55,38,53,52,55,38,35,34,6,6,21,20,23,7,38,53,52,
+54,51,50,22,22,21,20,6,7,22,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,
+6,21,20,51,50,55,23,6,35,34,38,53,52,55,35,6,19,6,21,20,22,51,50,53,52,1,
+35,34,4,7,54,51,50,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,37,1,7,
+149,190,254,247,66,60,232,164,182,254,127,1,2,230,62,108,147,223,122,55,51,
+135,121,1,93,1,37,91,183,79,54,140,208,115,214,204,178,195,98,31,44,28,146,
+49,1,103,1,21,97,85,36,70,103,92,66,63,115,154,73,44,140,51,253,237,186,247,
+109,113,107,90,91,254,197,177,177,122,54,240,226,205,177,43,90,105,132,195,
+81,64,33,88,122,149,166,86,25,11,146,94,64,56,107,253,243,17,198,254,239,
+59,44,50,85,58,33,150,232,204,174,5,102,89,83,80,3,147,4,1,117,254,211,22,
+121,118,119,120,145,1,5,176,225,1,39,30,13,125,224,152,107,201,76,68,219,
+241,1,35,1,77,48,46,143,5,112,208,144,206,218,179,154,140,14,22,45,1,64,1,
+72,12,10,2,53,134,104,98,7,53,97,62,75,78,32,99,91,160,191,98,158,95,100,
+118,4,42,170,129,83,34,84,127,84,159,185,88,137,47,25,108,139,171,31,131,
+40,161,146,123,104,1,6,97,69,99,53,59,105,125,254,73,208,200,18,55,79,116,
+60,88,99,63,49,18,12,18,29,21,73,129,3,13,0,5,0,77,254,42,9,78,7,200,0,120,
+0,129,0,155,0,156,0,157,0,0,5,34,36,39,6,6,35,34,38,2,53,52,0,55,38,35,34,
+6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,
+34,6,7,39,18,0,33,50,23,54,55,38,53,52,55,38,35,34,6,6,21,20,23,7,38,53,52,
+54,51,50,22,22,21,20,6,7,22,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,
+22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,50,54,53,52,39,6,19,6,21,20,
+22,51,50,53,52,1,35,34,4,7,54,51,50,23,62,2,51,51,38,38,35,34,6,21,20,23,
+7,38,53,52,37,1,7,149,190,254,247,66,60,232,164,182,254,127,1,2,230,62,108,
+147,223,122,55,51,135,121,1,93,1,37,91,183,79,54,140,208,115,214,204,178,
+195,98,31,44,28,146,49,1,103,1,21,97,85,36,70,103,92,66,63,115,154,73,44,
+140,51,253,237,186,247,109,113,107,90,91,254,197,177,177,122,54,240,226,205,
+177,43,27,8,9,254,250,254,253,255,0,254,250,1,149,181,187,188,183,3,112,8,
+94,64,56,107,253,243,17,198,254,239,59,44,50,85,58,33,150,232,204,174,5,102,
+89,83,80,3,147,4,1,117,254,241,22,121,118,119,120,145,1,5,176,225,1,39,30,
+13,125,224,152,107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,206,
+218,179,154,140,14,22,45,1,64,1,72,12,10,2,53,134,104,98,7,53,97,62,75,78,
+32,99,91,160,191,98,158,95,100,118,4,42,170,129,83,34,84,127,84,159,185,88,
+137,14,3,51,62,196,219,206,191,17,11,9,7,7,150,125,131,159,23,21,31,6,97,
+69,99,53,59,105,125,254,73,208,200,18,55,79,116,60,88,99,63,49,18,12,18,29,
+21,73,129,3,13,0,7,0,74,255,234,7,36,7,200,0,99,0,112,0,125,0,130,0,131,0,
+132,0,133,0,0,1,23,6,6,7,54,51,50,22,21,20,6,7,22,22,21,16,0,33,32,0,17,52,
+36,33,51,38,38,35,34,21,20,23,7,38,53,52,55,6,17,20,23,7,38,38,53,52,18,36,
+51,51,50,22,22,21,21,35,34,6,21,20,4,33,32,36,53,52,38,35,35,53,52,54,55,
+54,55,38,38,53,52,55,6,6,21,20,22,23,7,38,38,53,52,54,36,51,50,22,21,20,7,
+37,34,7,6,21,20,22,51,50,54,53,52,38,3,7,20,30,2,51,50,53,52,38,35,34,7,38,
+39,6,7,1,5,1,6,232,60,147,190,43,26,18,120,146,56,55,86,86,254,136,254,151,
+254,152,254,138,1,9,1,5,31,5,99,85,158,10,145,10,5,194,113,134,63,66,148,
+1,22,179,25,112,152,82,175,199,178,1,48,1,25,1,26,1,48,178,197,177,89,90,
+33,120,100,104,26,123,154,112,101,34,165,161,164,1,15,152,142,156,7,254,215,
+9,8,32,61,53,53,51,88,88,1,7,24,45,32,81,72,64,34,116,27,8,29,3,254,32,4,
+25,254,72,6,123,129,51,140,89,4,119,101,69,90,20,52,171,118,254,252,254,236,
+1,20,1,4,207,211,90,97,121,22,39,23,38,62,30,18,123,254,211,234,161,73,104,
+245,127,187,1,19,146,85,164,125,83,141,150,178,204,202,179,151,141,83,124,
+168,45,133,111,6,106,92,61,55,44,189,91,87,71,8,137,25,149,132,121,226,134,
+135,118,28,22,172,1,65,59,53,61,52,54,62,71,253,77,26,52,48,40,23,89,45,59,
+191,46,58,44,60,3,13,198,1,221,0,6,0,74,255,234,6,13,7,200,0,46,0,61,0,70,
+0,71,0,72,0,73,0,0,1,16,0,33,34,36,38,53,52,0,33,50,23,7,38,35,34,6,21,20,
+22,51,50,36,18,53,52,38,38,36,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,22,
+18,1,50,23,38,53,52,55,38,35,34,6,21,20,22,51,37,6,21,20,22,51,50,53,52,9,
+2,6,13,254,85,254,109,214,254,222,141,1,60,1,16,121,97,13,92,111,210,230,
+250,244,219,1,48,154,81,178,254,255,216,109,158,143,85,1,51,1,45,1,84,1,100,
+96,89,134,128,252,149,176,131,15,96,119,166,231,230,78,143,2,144,91,64,56,
+107,254,238,253,222,1,10,3,1,254,139,254,94,127,228,154,247,1,5,14,141,14,
+188,179,176,187,151,1,37,198,157,228,165,72,48,112,89,155,167,199,173,93,
+111,14,93,254,203,2,51,30,35,50,110,97,24,90,90,55,51,223,69,95,54,60,105,
+112,1,44,253,30,1,43,0,5,0,74,255,234,6,130,7,200,0,81,0,90,0,100,0,101,0,
+102,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,
+21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,16,39,6,6,35,34,38,53,
+52,38,39,39,55,22,23,54,55,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,50,
+4,22,21,20,6,7,22,18,1,6,21,20,22,51,50,53,52,3,38,39,22,23,22,22,51,50,54,
+1,1,6,130,251,236,112,167,69,74,158,116,188,221,143,1,14,183,111,115,14,87,
+117,217,237,141,132,132,133,138,136,137,116,149,73,168,41,135,79,119,123,
+18,37,5,53,117,105,4,81,79,116,231,232,161,155,21,221,221,1,59,1,42,201,1,
+17,139,101,91,142,149,254,129,86,63,58,106,168,116,180,22,5,4,52,55,51,75,
+254,52,2,155,2,128,254,184,254,178,83,97,103,77,255,230,153,245,134,14,139,
+13,213,192,157,169,147,154,14,14,157,144,115,229,175,1,99,226,72,81,144,144,
+113,90,23,2,126,40,56,99,89,10,110,120,90,88,10,143,21,165,150,173,196,83,
+156,108,89,113,12,128,254,120,3,128,66,91,53,56,102,112,254,111,112,84,49,
+113,87,62,53,1,58,1,163,0,5,0,62,255,234,6,150,7,200,0,80,0,95,0,105,0,106,
+0,107,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,16,55,6,35,35,53,33,38,38,35,
+34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,
+53,53,51,21,20,22,51,50,18,17,52,2,38,36,35,35,34,38,38,53,52,36,33,32,4,
+21,20,6,7,22,18,1,50,23,38,53,52,55,38,35,32,6,21,20,22,51,37,6,21,20,22,
+51,50,53,52,38,5,1,6,150,249,242,107,163,69,76,161,112,190,229,229,71,144,
+40,2,136,5,100,85,79,78,1,147,3,155,140,165,181,55,157,166,153,86,146,129,
+136,138,137,135,139,165,168,85,180,254,237,214,181,158,143,85,1,67,1,65,1,
+106,1,114,92,92,142,142,252,137,170,126,15,95,122,189,254,250,244,78,145,
+2,213,90,64,56,107,66,253,166,2,144,2,150,254,174,254,166,83,97,104,76,236,
+204,1,9,121,7,135,89,98,59,55,14,8,5,7,23,22,114,124,190,183,84,25,86,157,
+111,139,155,146,155,14,14,156,145,1,11,1,12,189,1,20,181,83,48,111,87,161,
+164,195,177,90,113,15,97,254,158,2,100,30,35,50,110,96,25,86,94,55,51,222,
+68,95,54,60,105,51,89,167,1,183,0,5,0,62,255,234,6,155,7,200,0,101,0,110,
+0,120,0,121,0,122,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,
+53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,
+20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,16,39,6,6,35,34,38,53,52,
+38,39,39,55,22,23,54,55,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,
+20,6,7,22,18,1,6,21,20,22,51,50,53,52,3,38,39,22,23,22,22,51,50,54,1,1,6,
+155,251,236,113,168,67,76,161,112,189,230,117,114,66,151,40,2,136,5,100,85,
+79,78,1,147,3,155,140,165,181,60,151,166,154,86,146,129,136,138,137,135,139,
+117,150,71,168,40,134,80,117,126,18,37,5,53,117,105,4,81,79,116,231,232,161,
+155,21,222,220,1,59,1,42,1,43,1,58,101,91,141,150,254,129,86,63,58,106,167,
+119,177,22,5,4,52,55,54,74,254,44,2,135,2,128,254,184,254,178,84,96,104,76,
+237,203,130,198,59,8,135,89,98,59,55,14,8,5,7,23,22,114,124,190,183,84,24,
+87,157,111,139,155,146,155,14,14,156,145,119,231,169,1,101,223,71,81,141,
+147,115,88,23,2,126,40,56,99,89,10,110,120,90,88,10,138,21,163,147,173,196,
+184,163,89,113,12,127,254,124,3,123,66,91,53,56,102,112,254,110,115,81,49,
+112,87,62,56,1,55,1,163,0,8,0,10,255,234,9,85,7,200,0,92,0,102,0,110,0,138,
+0,150,0,151,0,152,0,153,0,0,1,16,2,35,34,38,39,55,22,22,51,50,54,54,53,52,
+38,35,34,6,21,21,35,53,52,38,35,34,7,22,21,20,2,4,35,34,36,39,7,39,1,38,53,
+52,54,36,51,50,23,55,6,35,34,38,38,53,52,55,14,2,21,20,22,23,7,38,53,52,54,
+36,51,50,22,21,20,7,54,55,23,1,22,23,54,51,50,22,23,54,54,51,50,18,1,6,21,
+20,22,51,50,53,52,38,1,1,38,35,34,6,21,20,3,22,22,51,50,54,54,53,52,38,39,
+0,1,22,23,38,53,52,54,51,50,22,21,20,6,35,32,39,5,51,50,54,53,52,38,35,34,
+6,21,20,19,1,1,9,85,191,190,122,185,56,141,41,103,76,89,99,40,103,103,90,
+93,136,70,70,65,42,51,168,254,195,207,200,254,211,141,58,111,1,26,58,144,
+1,5,169,102,88,224,14,24,74,107,53,43,103,173,98,57,55,76,183,164,1,31,166,
+161,186,4,47,41,99,254,46,147,91,72,96,67,105,39,39,137,97,172,174,251,11,
+36,61,53,104,98,252,217,1,207,24,24,189,243,102,119,251,162,166,250,137,168,
+161,254,212,254,253,68,111,28,132,114,117,135,183,151,255,0,155,1,165,7,73,
+99,55,54,50,55,220,2,123,249,189,2,34,254,228,254,228,138,136,57,102,88,98,
+190,157,220,213,132,158,13,12,132,105,48,124,157,198,254,225,151,130,146,
+64,99,1,28,108,127,126,206,114,14,196,4,54,92,57,85,71,14,95,127,59,49,65,
+23,112,78,188,97,199,126,146,121,27,16,46,42,113,254,105,57,116,63,60,60,
+87,88,254,215,3,187,69,64,53,61,106,60,77,251,164,1,183,2,174,136,83,254,
+146,122,112,114,222,152,176,245,52,254,242,254,255,62,25,60,64,98,120,127,
+109,117,139,142,9,59,61,50,57,53,50,73,5,207,254,93,251,37,0,5,0,74,255,234,
+7,174,7,200,0,98,0,113,0,123,0,124,0,125,0,0,1,16,2,35,34,38,39,6,6,35,34,
+38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,55,6,6,
+21,20,23,7,38,2,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,14,2,21,20,22,
+51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,38,36,35,35,34,38,38,53,52,36,
+33,50,4,22,21,20,6,7,22,18,1,50,23,38,53,52,55,38,35,32,6,21,20,22,51,37,
+6,21,20,22,51,50,53,52,38,5,1,7,174,247,235,112,167,69,76,161,112,190,229,
+113,110,70,139,19,2,146,5,100,85,79,78,1,147,3,13,152,162,113,134,60,69,150,
+1,32,190,53,25,20,20,167,179,91,151,166,154,86,146,129,139,135,137,135,139,
+166,167,85,180,254,237,214,181,158,143,85,1,67,1,65,245,1,70,161,92,92,142,
+142,252,137,170,126,15,95,122,189,254,250,244,78,145,2,213,90,64,56,107,66,
+253,76,1,70,2,150,254,174,254,166,84,96,104,76,236,204,129,196,61,7,135,89,
+98,59,55,14,8,5,7,23,22,51,35,42,239,183,235,161,72,95,1,1,123,185,1,20,148,
+2,2,192,181,84,24,87,157,111,139,155,149,152,14,14,156,145,1,11,1,12,189,
+1,20,181,83,48,111,87,161,164,89,167,116,90,113,15,97,254,158,2,100,30,35,
+50,110,96,25,86,94,55,51,222,68,95,54,60,105,51,89,167,1,183,0,5,0,44,255,
+234,7,76,7,200,0,83,0,92,0,109,0,110,0,111,0,0,1,20,2,6,35,34,39,55,22,51,
+50,54,54,53,52,0,35,34,4,7,54,51,50,22,21,20,4,33,34,36,53,53,7,39,0,55,38,
+35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,23,38,53,52,55,38,
+35,34,6,21,20,22,23,7,38,53,52,36,33,50,4,22,21,20,6,35,22,18,1,6,21,20,22,
+51,50,53,52,1,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,1,1,7,76,127,231,
+147,63,33,8,44,27,120,164,84,254,233,244,141,254,234,124,83,113,229,254,254,
+224,254,231,240,254,242,74,130,1,5,190,39,111,59,70,10,12,143,27,147,128,
+184,77,149,1,36,156,61,57,93,87,80,102,214,213,46,43,129,107,1,38,1,24,194,
+1,13,138,123,114,180,193,254,94,88,64,56,107,251,175,88,71,70,12,194,186,
+208,206,191,178,90,150,3,70,254,211,2,75,183,254,244,141,6,138,3,107,208,
+147,243,1,12,111,107,28,234,217,239,251,215,203,25,126,73,1,121,184,148,66,
+71,30,45,39,29,82,78,121,135,187,119,109,8,62,133,101,96,12,121,121,43,106,
+53,66,134,142,177,201,85,159,107,115,125,72,254,192,3,28,69,95,53,59,105,
+119,252,188,102,98,5,44,56,143,147,177,164,154,160,27,1,203,3,13,0,5,0,74,
+255,234,6,32,7,200,0,65,0,75,0,84,0,85,0,86,0,0,1,16,2,4,33,32,0,53,52,0,
+33,50,23,7,38,35,34,6,21,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,
+39,39,55,22,23,54,55,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,20,
+6,7,22,18,1,6,21,20,22,51,50,53,52,38,3,38,39,22,23,22,22,51,50,1,1,6,32,
+198,254,137,254,251,254,192,254,172,1,72,1,27,126,100,12,98,116,220,241,255,
+247,221,1,53,158,86,44,122,69,119,123,16,40,7,51,100,97,7,79,63,121,220,224,
+161,155,21,221,221,1,49,1,30,1,39,1,53,100,90,105,111,254,203,87,63,58,106,
+68,80,106,179,21,5,4,52,55,94,254,69,1,95,3,71,254,250,254,118,205,1,11,242,
+246,1,6,14,141,14,188,179,178,185,175,1,75,208,200,154,59,62,144,144,111,
+93,23,3,124,32,57,95,87,9,110,120,90,88,10,143,21,165,150,173,196,183,164,
+88,114,12,108,254,226,3,4,66,93,53,56,102,53,86,254,65,124,89,52,108,87,62,
+1,111,1,163,0,4,0,74,253,213,4,189,7,200,0,82,0,91,0,92,0,93,0,0,5,32,0,53,
+52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,54,55,38,53,52,55,38,35,34,
+6,21,20,22,23,7,38,38,53,52,54,51,50,22,22,21,20,6,7,22,22,21,21,33,34,14,
+2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,6,19,6,
+21,20,22,51,50,53,52,1,19,2,193,254,215,254,178,96,182,235,183,204,5,102,
+89,81,81,2,147,4,152,138,103,92,66,63,170,172,102,122,69,150,152,253,237,
+186,247,109,113,107,90,90,254,179,188,186,127,57,254,238,216,186,43,86,106,
+135,195,82,63,34,90,120,151,165,87,36,146,94,64,56,107,254,100,251,22,1,6,
+237,122,177,116,40,88,99,61,51,18,12,18,29,33,108,123,2,53,134,104,98,7,114,
+98,75,95,43,119,46,172,119,160,191,98,158,95,100,118,4,42,171,128,83,34,84,
+127,84,159,185,88,137,44,25,110,140,171,31,131,40,162,145,125,103,2,6,97,
+69,99,53,59,105,125,1,175,252,243,0,4,0,74,254,42,4,142,7,200,0,92,0,101,
+0,102,0,103,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,
+54,55,38,53,52,55,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,22,21,
+20,6,7,22,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,
+53,53,52,55,23,21,20,22,51,50,54,54,53,52,39,52,39,6,19,6,21,20,22,51,50,
+53,52,1,19,2,193,254,215,254,178,96,182,235,183,204,5,102,89,81,81,2,147,
+4,152,138,103,92,66,63,170,172,102,122,69,150,152,253,237,186,247,109,113,
+107,90,90,254,179,188,186,127,57,254,238,216,186,43,23,11,9,254,250,254,253,
+255,0,254,250,1,149,181,187,123,163,85,3,1,125,22,94,64,56,107,254,100,251,
+22,1,6,237,122,177,116,40,88,99,61,51,18,12,18,29,33,108,123,2,53,134,104,
+98,7,114,98,75,95,43,119,46,172,119,160,191,98,158,95,100,118,4,42,171,128,
+83,34,84,127,84,159,185,88,137,12,5,43,70,196,219,206,191,17,11,9,7,7,150,
+125,55,124,111,11,24,6,6,34,6,97,69,99,53,59,105,125,1,175,252,243,0,6,0,
+74,255,234,6,125,7,200,0,60,0,75,0,85,0,86,0,87,0,88,0,0,1,16,2,35,34,38,
+39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,50,54,53,53,
+51,21,20,22,51,50,18,17,52,2,38,36,35,35,34,38,38,53,52,36,33,32,4,21,20,
+6,7,22,18,1,38,53,52,55,38,35,32,6,21,20,22,51,51,50,37,6,21,20,22,51,50,
+53,52,38,5,1,1,6,125,247,235,114,169,67,75,157,114,188,221,143,1,14,183,111,
+115,14,87,117,217,237,141,132,132,133,138,136,137,166,167,85,180,254,237,
+214,181,158,143,85,1,67,1,65,1,107,1,113,92,92,142,142,253,177,15,95,122,
+189,254,250,244,78,145,218,170,1,81,90,64,56,107,66,254,125,1,70,254,10,2,
+150,254,174,254,166,85,95,105,75,255,230,153,245,134,14,139,13,213,192,157,
+169,147,154,14,14,157,144,1,11,1,12,189,1,20,181,83,48,111,87,161,164,194,
+178,90,113,15,97,254,158,2,70,35,50,110,96,25,86,94,55,51,222,68,95,54,60,
+105,51,89,167,1,183,253,30,0,5,0,58,255,234,7,107,7,200,0,86,0,95,0,109,0,
+110,0,111,0,0,1,20,2,6,35,34,39,55,22,51,50,54,53,52,0,35,32,7,54,51,50,22,
+21,20,0,33,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,
+52,54,51,50,23,54,36,51,50,23,38,53,52,55,38,35,34,6,21,20,22,23,7,38,53,
+52,36,33,32,4,21,20,6,35,35,22,18,1,6,21,20,22,51,50,53,52,1,6,6,7,22,22,
+51,50,54,53,52,38,35,34,1,19,7,107,135,228,141,64,33,8,44,27,178,190,254,
+225,246,254,247,166,49,46,228,254,254,211,254,225,254,211,254,149,48,146,
+5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,192,69,99,1,12,
+158,70,63,96,88,77,96,209,208,41,54,124,118,1,33,1,19,1,32,1,47,124,115,6,
+185,199,254,92,89,64,56,107,252,141,57,223,191,65,247,200,208,225,194,175,
+69,1,179,251,2,80,192,254,240,133,6,138,3,238,215,242,1,22,197,7,234,217,
+227,254,249,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,
+78,121,135,200,118,123,9,60,136,102,96,11,121,121,50,91,64,74,148,142,175,
+200,188,163,114,126,72,254,193,3,27,66,98,53,59,105,119,252,244,173,167,5,
+156,150,184,166,149,156,4,189,252,243,0,4,0,74,253,213,5,151,7,200,0,98,0,
+107,0,108,0,109,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,
+52,55,34,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,55,38,53,52,55,38,35,
+34,6,6,21,20,23,7,38,53,52,54,51,50,22,22,21,20,6,7,22,22,21,21,33,34,14,
+2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,35,6,19,
+6,21,20,22,51,50,53,52,1,19,3,175,254,228,254,192,77,154,214,214,195,5,104,
+88,82,80,2,146,5,26,233,254,105,137,56,62,150,1,32,190,110,63,33,68,103,92,
+66,63,116,153,73,44,140,51,253,237,186,247,109,115,106,90,90,254,197,179,
+177,119,54,240,226,205,177,42,85,108,133,194,82,64,33,90,120,150,165,86,25,
+12,148,94,64,56,107,254,81,251,22,1,6,237,109,172,118,56,89,98,62,50,18,12,
+18,30,20,71,44,255,231,221,180,67,102,247,126,185,1,20,148,11,9,2,53,134,
+104,98,7,54,96,62,79,76,32,99,93,160,191,98,158,95,102,116,4,41,171,129,83,
+34,85,126,84,159,185,88,137,45,26,109,139,171,31,131,40,162,145,123,104,1,
+6,97,69,99,53,59,105,125,1,175,252,243,0,4,0,74,254,42,5,104,7,200,0,105,
+0,114,0,115,0,116,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,
+53,52,55,34,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,55,38,53,52,55,38,
+35,34,6,6,21,20,23,7,38,53,52,54,51,50,22,22,21,20,6,7,22,22,21,21,33,34,
+14,2,21,20,22,51,50,55,23,6,7,22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,
+51,50,54,54,53,52,39,6,19,6,21,20,22,51,50,53,52,1,19,3,175,254,228,254,192,
+77,154,214,214,195,5,104,88,82,80,2,146,5,26,233,254,105,137,56,62,150,1,
+32,190,110,63,33,68,103,92,66,63,116,153,73,44,140,51,253,237,186,247,109,
+115,106,90,90,254,197,179,177,119,54,240,226,205,177,42,26,7,9,254,250,254,
+253,255,0,254,250,1,149,181,187,123,163,85,4,112,9,94,64,56,107,254,81,251,
+22,1,6,237,109,172,118,56,89,98,62,50,18,12,18,30,20,71,44,255,231,221,180,
+67,102,247,126,185,1,20,148,11,9,2,53,134,104,98,7,54,96,62,79,76,32,99,93,
+160,191,98,158,95,102,116,4,41,171,129,83,34,85,126,84,159,185,88,137,14,
+3,43,70,196,219,206,191,17,11,9,7,7,150,125,55,124,111,9,37,33,6,97,69,99,
+53,59,105,125,1,175,252,243,0,4,0,74,255,234,6,8,7,200,0,85,0,94,0,95,0,96,
+0,0,1,20,7,39,54,53,52,35,34,6,7,51,32,17,16,0,33,34,36,38,53,52,36,33,51,
+38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,
+54,53,52,38,35,35,53,52,54,55,38,53,52,55,38,35,34,6,21,20,23,7,38,53,52,
+36,33,50,4,22,21,20,7,22,22,1,6,21,20,22,51,50,53,52,1,19,5,203,13,145,9,
+157,86,99,4,31,2,13,254,136,254,151,245,254,184,160,1,9,1,4,31,5,99,85,157,
+9,144,14,155,140,167,179,176,200,176,1,43,1,29,201,1,8,122,178,198,177,109,
+110,156,88,77,106,214,213,20,139,28,1,36,1,26,196,1,13,136,127,100,99,254,
+158,88,64,56,107,254,189,251,3,247,48,53,23,38,23,121,99,88,254,94,254,252,
+254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,140,
+147,183,203,99,172,114,149,139,83,145,178,33,38,167,103,94,12,117,116,65,
+53,24,72,75,176,196,85,160,106,151,47,20,120,1,246,69,95,53,59,105,119,1,
+181,252,243,0,5,0,74,255,234,6,54,7,200,0,80,0,90,0,100,0,101,0,102,0,0,1,
+20,2,4,33,32,0,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,
+21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,
+55,22,23,54,55,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,20,6,7,
+22,18,1,6,21,20,22,51,50,53,52,38,3,38,39,22,23,22,22,51,50,54,1,3,6,54,200,
+254,127,254,243,254,203,254,159,1,39,1,7,123,5,99,85,157,5,145,9,155,139,
+168,179,225,171,187,94,1,16,240,222,1,57,165,87,43,120,71,116,126,16,40,7,
+51,108,89,7,78,63,121,221,223,161,155,21,222,220,1,49,1,30,1,39,1,53,101,
+92,110,110,254,202,87,63,58,106,68,79,109,176,21,5,4,52,55,47,71,254,214,
+161,3,50,253,254,128,203,1,31,248,191,228,90,97,121,19,24,24,50,35,114,124,
+192,182,83,64,125,97,180,207,166,1,67,214,207,157,57,63,141,147,111,93,23,
+3,124,39,46,93,85,9,111,119,90,88,10,138,21,163,147,173,196,183,164,89,113,
+12,115,254,222,3,15,66,93,53,56,102,53,86,254,64,127,87,52,108,87,62,44,2,
+230,254,93,0,7,0,74,255,234,6,161,7,200,0,76,0,91,0,100,0,110,0,111,0,112,
+0,113,0,0,1,20,2,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,6,21,20,
+23,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,21,20,6,6,7,6,6,21,
+20,22,51,50,54,18,53,52,2,36,33,35,34,38,38,53,52,36,33,32,4,21,20,6,7,22,
+18,1,50,23,38,53,52,55,38,35,32,6,21,20,22,51,37,6,21,20,22,51,50,53,52,1,
+22,51,50,54,53,52,38,35,34,9,2,6,161,132,244,161,97,127,54,27,38,34,24,172,
+154,136,206,113,21,136,165,120,143,154,143,129,201,108,148,1,25,185,219,250,
+17,26,32,31,22,72,64,93,174,110,174,254,214,254,227,190,158,143,85,1,69,1,
+65,1,112,1,115,92,91,133,153,252,134,170,127,16,95,123,194,254,249,246,78,
+145,2,221,89,64,56,107,251,134,73,131,80,72,68,58,123,2,41,1,70,253,31,2,
+188,209,254,180,181,77,117,67,53,98,90,80,102,52,134,148,119,223,148,109,
+71,153,137,105,124,135,136,243,146,186,1,33,159,222,180,52,95,76,76,74,76,
+37,66,64,131,1,10,179,244,1,51,142,48,111,87,162,163,194,178,90,113,14,87,
+254,179,2,68,32,37,50,110,96,25,86,94,55,51,221,66,96,54,60,105,110,250,54,
+92,59,57,49,61,4,187,1,183,253,30,0,4,0,62,255,234,7,108,7,200,0,102,0,111,
+0,112,0,113,0,0,1,16,0,33,34,39,55,22,51,50,54,53,52,2,35,34,6,7,54,51,50,
+22,21,20,6,4,35,32,0,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,
+7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,52,35,34,6,7,
+39,18,18,55,38,38,53,52,55,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,
+7,22,18,1,6,21,20,22,51,50,53,52,3,19,7,108,254,201,254,246,56,56,9,27,57,
+217,225,200,175,156,204,55,40,54,113,128,137,254,242,193,254,241,254,191,
+84,82,72,99,32,2,81,5,99,85,81,76,1,147,3,155,139,166,181,106,152,147,98,
+50,235,209,216,234,98,32,43,28,146,40,224,179,77,82,88,78,105,214,213,18,
+143,22,1,36,1,26,1,38,1,51,120,209,226,253,171,88,64,56,107,151,75,2,121,
+254,212,254,174,6,138,3,255,242,217,1,3,199,196,18,145,133,137,219,120,1,
+15,224,105,169,56,6,135,90,97,61,53,14,8,5,7,12,33,114,124,190,184,83,35,
+77,110,81,171,199,180,164,129,13,23,45,1,4,1,65,49,17,104,84,103,94,12,117,
+116,59,54,14,63,69,176,196,187,164,147,48,30,254,185,2,204,69,95,53,59,105,
+119,1,181,252,243,0,7,0,79,255,234,6,132,7,200,0,80,0,95,0,104,0,115,0,116,
+0,117,0,118,0,0,1,20,2,4,33,34,36,2,53,52,18,51,50,22,22,21,20,7,6,21,20,
+51,50,55,6,35,34,38,53,52,54,51,50,30,2,21,20,6,35,34,38,53,52,55,54,53,52,
+35,34,6,21,16,0,33,50,36,54,54,53,52,46,2,35,35,34,38,38,53,52,36,33,32,4,
+21,20,6,7,22,18,1,50,23,38,53,52,55,38,35,32,6,21,20,22,51,37,6,21,20,22,
+51,50,53,52,1,38,38,35,34,6,21,20,22,51,50,9,2,6,132,201,254,130,254,246,
+227,254,179,180,204,164,65,81,29,10,11,231,218,41,77,103,110,126,142,127,
+57,103,86,49,219,187,183,193,10,9,59,83,107,1,55,1,30,181,1,12,165,76,86,
+181,254,233,194,158,143,85,1,68,1,68,1,109,1,114,87,83,141,134,252,124,173,
+129,13,94,135,187,254,253,242,76,145,2,221,89,64,56,107,254,187,11,81,62,
+62,60,61,53,92,254,41,1,155,1,70,2,254,237,254,152,191,163,1,61,215,235,1,
+15,53,72,35,37,70,71,52,186,170,47,121,104,100,128,36,80,130,87,172,205,166,
+147,43,64,63,21,71,195,162,254,242,254,219,103,182,230,130,139,229,175,76,
+48,112,89,161,161,193,179,87,111,17,99,254,196,2,61,25,36,44,110,95,26,86,
+94,54,52,221,66,96,54,60,105,111,252,228,74,79,51,46,47,52,1,146,1,43,1,183,
+0,7,0,83,255,234,6,191,7,200,0,109,0,124,0,133,0,144,0,145,0,146,0,147,0,
+0,1,16,0,33,34,39,39,54,53,52,38,35,34,6,21,20,23,7,6,35,34,0,17,52,18,54,
+51,50,22,21,20,7,6,21,20,51,50,55,6,35,34,38,53,52,54,51,50,22,21,20,6,35,
+34,38,38,53,52,55,54,53,52,35,34,6,6,21,20,18,51,51,22,51,50,55,38,53,52,
+54,51,51,50,22,21,20,7,51,50,18,17,52,2,36,33,35,34,38,38,53,52,36,33,50,
+4,22,21,20,6,7,22,18,1,50,23,38,53,52,55,38,35,32,6,21,20,22,51,37,6,21,20,
+22,51,50,53,52,1,38,38,35,34,6,21,20,22,51,50,3,1,1,6,191,254,219,254,237,
+140,73,14,89,80,78,79,81,89,14,77,87,244,254,225,98,178,108,86,91,10,11,231,
+218,41,77,103,110,126,142,127,131,164,219,187,134,169,73,10,9,60,50,97,58,
+199,175,10,1,2,3,4,69,150,142,27,138,151,69,58,204,215,163,254,198,254,205,
+192,148,145,93,1,73,1,73,250,1,75,165,91,88,139,151,252,112,183,127,15,94,
+135,189,254,242,250,78,145,2,240,89,64,56,107,254,156,11,81,62,58,64,61,53,
+92,82,1,70,253,31,2,198,254,169,254,124,23,135,23,75,52,53,54,51,75,23,135,
+24,1,82,1,41,173,1,0,137,91,69,37,70,71,52,186,170,47,121,104,100,128,174,
+159,172,205,86,140,87,43,64,63,21,71,105,195,124,236,254,244,1,1,57,89,97,
+104,104,97,88,58,1,55,1,31,239,1,33,146,42,114,91,162,162,87,165,120,90,111,
+16,92,254,182,2,70,29,35,49,110,95,26,86,94,55,51,221,66,96,54,60,105,111,
+252,228,74,79,48,49,47,52,2,189,1,183,253,30,0,5,0,74,255,234,6,52,7,200,
+0,89,0,98,0,99,0,100,0,101,0,0,1,20,7,39,54,53,52,35,34,6,7,51,32,4,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,
+50,54,53,53,51,21,20,22,51,50,54,53,52,38,38,35,35,53,52,54,55,38,53,52,55,
+38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,50,4,22,21,20,7,22,22,1,6,21,20,
+22,51,50,53,52,3,19,37,5,218,14,144,9,157,86,99,4,23,1,29,1,21,223,186,112,
+167,69,75,158,115,188,221,140,1,5,174,61,37,11,28,51,203,230,141,132,132,
+133,138,136,138,129,135,105,223,198,55,113,114,148,87,80,102,205,206,111,
+139,67,165,165,1,29,1,17,195,1,14,136,134,93,97,254,174,88,64,56,107,208,
+75,254,149,3,247,44,57,23,38,23,121,99,88,245,242,220,247,83,97,104,76,255,
+230,152,246,134,6,139,5,217,188,157,169,147,154,14,14,158,143,162,160,145,
+145,61,84,146,179,33,41,161,101,96,12,118,111,74,99,48,123,52,176,124,168,
+197,85,160,106,155,45,22,117,1,247,69,95,53,59,105,119,1,181,252,243,43,0,
+8,0,74,255,234,5,107,7,200,0,45,0,56,0,70,0,71,0,72,0,73,0,74,0,75,0,0,1,
+4,5,4,0,21,16,0,33,32,0,17,52,54,54,55,54,55,6,35,34,38,53,52,55,6,6,21,20,
+22,23,7,38,38,53,52,54,36,51,50,22,22,21,20,7,55,37,6,21,20,22,51,50,54,53,
+52,38,1,6,6,21,20,22,51,50,36,53,52,36,35,34,37,19,7,3,1,5,107,254,244,254,
+205,1,5,1,34,254,159,254,201,254,215,254,184,103,227,214,172,208,22,24,112,
+126,32,155,195,84,77,74,115,119,171,1,38,171,103,144,69,23,111,254,101,30,
+61,53,53,51,94,254,66,148,154,248,231,245,1,10,254,245,233,93,2,223,25,2,
+25,254,249,5,253,226,149,16,254,204,254,254,229,254,193,1,54,1,24,144,224,
+178,86,91,126,6,113,90,70,66,37,169,91,68,75,25,118,44,137,106,114,207,123,
+67,114,74,53,41,99,116,65,57,53,61,52,54,59,70,253,22,69,212,164,212,236,
+242,210,215,246,217,1,203,209,254,189,3,43,0,4,0,74,254,94,6,140,7,200,0,
+75,0,84,0,85,0,86,0,0,1,20,6,35,34,38,53,52,55,33,53,33,21,33,6,21,20,51,
+50,54,53,52,36,33,32,0,17,16,0,33,32,0,53,52,39,55,22,21,20,2,4,35,32,0,17,
+16,18,36,33,50,23,38,53,52,55,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,
+20,6,7,22,22,1,6,21,20,22,51,50,53,52,3,19,6,121,230,207,176,179,11,254,202,
+2,252,254,213,16,203,139,146,254,255,254,255,254,146,254,117,1,102,1,68,1,
+29,1,76,5,147,7,190,254,160,221,254,102,254,83,220,1,158,1,20,69,39,87,87,
+88,94,214,213,72,130,89,1,38,1,24,1,37,1,52,94,89,160,169,254,84,88,64,56,
+107,237,75,3,8,173,203,142,139,35,36,137,137,30,38,143,122,111,173,167,254,
+128,254,166,254,200,254,170,1,17,250,33,46,8,38,50,206,254,209,161,1,165,
+1,129,1,7,1,138,209,4,61,130,101,96,12,121,121,82,98,63,123,131,175,200,188,
+163,101,120,15,52,219,2,158,68,95,53,59,105,118,1,182,252,243,0,4,0,74,253,
+213,6,137,7,200,0,104,0,113,0,114,0,115,0,0,1,20,6,35,34,38,53,52,55,33,53,
+33,21,33,6,21,20,51,50,54,53,52,36,33,32,0,17,16,0,33,32,36,53,53,55,23,22,
+21,20,7,22,21,20,6,4,35,34,36,46,2,53,53,52,55,23,21,20,30,2,51,32,36,53,
+53,52,39,6,4,35,32,36,2,53,52,18,36,33,50,23,38,53,52,55,38,35,32,21,20,23,
+7,38,53,52,36,33,32,4,21,20,6,7,22,22,1,6,21,20,22,51,50,53,52,3,19,6,121,
+230,207,176,179,11,254,202,2,252,254,213,16,203,139,146,254,255,254,255,254,
+144,254,119,1,100,1,70,1,44,1,56,147,3,1,56,22,171,254,182,241,179,254,243,
+172,98,45,1,149,72,141,228,168,1,50,1,38,1,101,254,213,179,254,233,254,134,
+182,219,1,159,1,20,69,39,87,87,88,94,254,85,65,138,74,1,38,1,24,1,37,1,52,
+94,89,160,169,254,84,88,64,56,107,237,75,3,8,173,203,142,139,35,36,137,137,
+30,38,143,122,111,173,167,254,192,254,223,254,251,254,228,181,180,14,10,22,
+8,9,119,95,68,90,184,209,96,42,78,102,130,86,24,9,10,7,10,105,115,66,33,167,
+183,10,5,4,73,74,175,1,56,208,225,1,84,182,4,61,130,101,96,12,242,81,90,49,
+111,120,175,200,188,163,101,120,15,52,219,2,158,68,95,53,59,105,118,1,182,
+252,243,0,5,0,74,255,234,6,54,7,200,0,61,0,76,0,85,0,86,0,87,0,0,1,16,0,33,
+34,36,38,53,52,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,
+21,33,34,6,6,21,20,4,51,32,0,17,52,38,38,36,35,35,34,38,38,53,52,36,33,32,
+4,21,20,6,7,22,18,1,50,23,38,53,52,55,38,35,34,6,21,20,22,51,37,6,21,20,22,
+51,50,53,52,5,1,6,54,254,74,254,94,205,254,213,156,132,250,214,127,5,100,
+85,157,6,145,9,155,139,166,180,254,246,175,185,92,1,15,239,1,90,1,100,85,
+181,254,255,231,128,158,143,85,1,60,1,56,1,96,1,105,95,94,138,132,252,124,
+188,141,16,95,127,174,246,235,76,145,2,180,90,64,56,107,253,207,1,230,3,1,
+254,140,254,93,131,241,163,125,190,104,89,98,121,19,24,24,50,35,114,124,191,
+183,83,65,125,96,181,206,1,84,1,46,152,231,165,74,48,112,89,158,164,196,176,
+91,114,13,95,254,204,2,52,31,37,49,110,96,25,87,93,54,52,222,66,97,54,60,
+105,112,139,1,183,0,5,0,78,255,234,7,8,7,200,0,85,0,94,0,107,0,108,0,109,
+0,0,1,20,0,7,39,54,53,52,39,38,53,52,54,51,50,23,53,52,38,35,34,6,7,54,51,
+50,22,21,20,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,2,17,20,22,51,50,
+54,53,52,35,34,6,7,39,18,18,55,38,53,52,55,38,35,34,6,21,20,23,7,38,53,52,
+36,33,32,4,21,20,7,22,18,1,6,21,20,22,51,50,53,52,3,54,55,38,35,34,6,21,20,
+23,22,21,20,3,19,7,8,254,226,255,51,46,16,17,139,112,98,76,211,170,170,201,
+57,47,47,112,129,123,238,161,254,241,254,211,145,1,21,185,55,47,8,41,47,230,
+229,217,201,173,199,97,31,44,28,146,48,255,207,123,86,94,102,214,213,25,139,
+33,1,36,1,26,1,46,1,58,149,183,197,253,253,86,64,56,107,49,208,45,65,80,58,
+61,8,8,141,75,2,141,249,254,163,75,126,14,59,41,84,85,45,122,130,48,19,208,
+244,202,194,19,145,131,136,218,124,1,75,1,41,195,1,37,160,6,138,3,254,253,
+254,254,222,250,182,153,138,14,22,45,1,33,1,65,31,48,146,102,94,13,117,116,
+75,55,26,76,85,176,196,187,164,164,41,44,254,201,2,210,67,95,53,59,105,117,
+250,160,114,207,53,68,64,27,57,56,46,27,6,250,252,243,0,6,0,74,255,234,6,
+8,7,200,0,97,0,106,0,118,0,132,0,133,0,134,0,0,1,20,7,22,22,21,16,0,33,34,
+36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,
+34,6,21,20,4,33,50,36,54,53,52,39,6,7,22,21,20,6,35,34,38,38,53,52,54,54,
+51,51,50,54,55,38,35,35,53,52,54,55,38,53,52,55,38,35,34,6,21,20,23,7,38,
+53,52,36,33,50,4,22,21,20,7,22,22,1,6,21,20,22,51,50,53,52,3,50,22,23,54,
+53,52,38,35,34,6,7,19,6,35,35,34,6,21,20,22,51,50,54,53,52,19,19,5,200,44,
+54,54,254,136,254,151,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,
+140,167,179,176,200,176,1,43,1,29,201,1,8,122,53,79,108,27,190,192,132,171,
+79,75,148,132,94,140,167,57,79,133,177,112,105,154,88,77,106,214,213,20,139,
+28,1,36,1,26,196,1,13,136,131,100,100,254,161,88,64,56,107,249,90,149,60,
+16,83,74,86,99,4,34,69,102,102,114,78,123,125,119,119,58,75,3,212,95,79,52,
+146,94,254,252,254,236,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,
+193,181,83,140,147,183,203,99,172,114,116,66,72,35,49,60,115,109,55,98,68,
+78,82,39,50,46,30,83,145,180,32,40,164,103,94,12,117,116,65,53,24,72,75,176,
+196,85,160,106,154,45,24,132,2,7,69,95,53,59,105,119,253,145,25,25,37,44,
+76,80,99,88,254,134,10,38,42,48,38,41,60,44,5,189,252,243,0,4,0,62,255,234,
+6,77,7,200,0,108,0,117,0,118,0,119,0,0,1,20,7,39,54,53,52,35,34,6,7,51,50,
+22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,
+34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,
+53,53,51,21,20,22,51,50,54,53,52,38,38,35,35,53,52,54,55,38,53,52,55,38,35,
+34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,22,22,1,6,21,20,22,51,50,53,52,
+3,19,5,250,14,144,9,157,86,99,4,17,181,253,127,223,186,113,168,67,76,161,
+112,189,230,117,113,56,160,40,2,104,5,100,85,81,76,1,147,3,155,139,167,179,
+39,147,162,152,84,145,130,136,138,137,135,140,129,135,114,229,183,48,105,
+106,168,89,74,90,214,213,20,139,28,1,36,1,26,1,26,1,43,121,105,108,254,139,
+89,64,56,107,194,75,3,247,44,57,23,38,23,121,99,88,110,218,159,220,247,84,
+96,104,76,237,203,130,197,59,7,135,89,98,61,53,14,8,5,7,12,33,114,124,191,
+183,83,26,87,156,110,140,154,146,155,14,14,156,145,163,159,144,147,60,83,
+142,177,35,35,172,103,95,11,117,116,65,53,24,72,75,176,196,190,161,148,48,
+18,120,1,242,66,98,53,59,105,118,1,182,252,243,0,4,0,74,255,234,7,83,7,200,
+0,98,0,107,0,108,0,109,0,0,1,16,0,33,34,39,55,22,51,50,54,54,53,52,2,35,34,
+6,7,54,51,50,22,21,20,6,4,35,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,
+7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,22,51,50,54,53,52,35,34,6,7,39,
+18,18,55,38,38,53,52,55,38,35,34,6,21,20,23,7,38,53,52,36,33,50,4,22,21,20,
+7,22,22,18,1,6,21,20,22,51,50,53,52,1,19,7,83,254,201,254,246,57,54,8,44,
+40,150,198,94,199,176,157,203,54,44,49,114,128,141,254,243,190,179,254,244,
+146,1,9,1,1,34,5,99,85,157,9,144,14,155,140,167,179,176,197,179,239,205,212,
+237,98,32,43,28,145,40,224,178,77,82,88,78,105,214,213,20,139,28,1,36,1,26,
+196,1,14,135,120,141,197,97,253,171,88,64,56,107,254,196,245,2,121,254,212,
+254,174,6,138,3,121,222,154,215,1,5,201,193,17,146,132,136,221,119,126,242,
+169,205,212,90,97,121,23,38,23,48,54,114,124,193,181,83,139,152,177,205,182,
+162,129,13,23,45,1,7,1,62,49,17,104,84,103,94,12,117,116,65,53,24,72,75,176,
+196,86,159,106,147,48,20,166,254,248,3,41,69,95,53,59,105,119,1,181,252,243,
+0,6,0,68,254,79,5,253,7,200,0,76,0,85,0,101,0,102,0,103,0,104,0,0,1,21,33,
+32,4,7,22,22,51,50,54,55,23,2,33,34,36,39,6,17,20,0,33,32,36,53,52,39,55,
+22,21,20,0,33,34,36,2,53,52,18,55,55,38,53,52,54,51,50,23,54,55,38,53,52,
+55,38,35,34,6,21,20,23,7,38,38,53,52,36,33,32,4,21,20,6,7,22,22,3,6,21,20,
+22,51,50,53,52,1,54,36,51,51,38,38,35,34,7,35,38,38,35,34,6,1,19,1,5,182,
+254,239,254,242,254,184,108,28,211,179,200,197,14,147,43,254,11,232,254,234,
+47,136,1,56,1,24,1,19,1,38,3,148,5,254,126,254,179,237,254,176,173,126,125,
+17,2,183,154,136,79,80,128,108,89,74,92,196,199,32,135,19,25,1,23,1,7,1,21,
+1,40,104,108,90,102,251,89,64,56,107,252,149,108,1,56,204,220,5,104,89,144,
+21,137,3,76,65,96,103,2,114,75,254,236,3,112,83,49,55,173,173,140,145,8,254,
+90,203,204,123,254,254,241,254,238,206,186,24,29,8,31,41,249,254,234,162,
+1,49,199,170,1,0,94,12,38,39,187,225,106,93,12,49,139,103,95,11,120,113,77,
+68,38,42,107,43,167,201,191,160,98,112,6,39,174,2,81,68,96,53,59,105,116,
+253,53,47,48,91,96,136,64,72,145,3,250,252,243,251,47,0,5,0,74,254,15,7,67,
+7,200,0,122,0,132,0,142,0,143,0,144,0,0,55,38,38,53,52,18,36,51,50,23,54,
+51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,39,6,6,35,34,38,53,52,
+38,39,39,55,22,23,54,55,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,50,4,22,
+21,20,6,7,22,17,16,7,22,21,16,0,33,32,36,53,52,55,23,21,20,30,2,51,50,62,
+2,53,52,39,6,4,35,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,
+55,6,6,21,20,23,1,6,21,20,22,51,50,53,52,38,3,38,39,22,23,22,22,51,50,54,
+3,1,203,63,66,151,1,33,188,25,33,40,23,166,181,225,171,187,94,1,16,240,222,
+1,57,165,87,43,120,71,119,123,16,40,7,51,108,89,7,78,63,121,221,223,161,155,
+21,222,220,1,49,1,30,200,1,13,135,101,92,220,117,49,254,143,254,147,254,171,
+254,174,2,148,55,117,204,153,168,230,127,59,15,112,254,201,198,206,254,213,
+157,1,39,1,7,123,5,99,85,157,5,145,9,16,156,165,113,4,188,87,63,58,106,68,
+79,107,179,22,5,4,52,55,50,70,23,254,85,170,104,245,127,186,1,20,146,4,4,
+190,184,83,64,125,97,180,207,166,1,67,214,207,157,57,63,144,144,111,93,23,
+3,124,39,46,93,85,9,111,119,90,88,10,138,21,163,147,173,196,84,156,107,89,
+113,12,230,254,162,254,235,198,140,137,254,222,254,239,221,244,26,20,8,11,
+103,123,79,42,64,110,147,105,65,55,108,108,131,241,163,191,228,90,97,121,
+19,24,24,50,35,46,42,42,242,182,234,161,5,253,66,93,53,56,102,53,86,254,65,
+125,89,49,112,87,62,47,2,227,254,93,0,4,0,78,255,234,6,114,7,200,0,72,0,81,
+0,82,0,83,0,0,1,16,0,33,35,34,39,55,22,51,50,54,17,52,38,35,34,6,6,21,21,
+35,53,52,38,38,35,34,6,21,16,22,51,50,55,23,6,35,32,0,17,16,18,51,50,22,23,
+54,55,38,53,52,55,38,35,34,6,21,20,23,7,38,53,52,36,33,32,4,21,20,7,22,18,
+1,6,21,20,22,51,50,53,52,3,19,6,114,254,244,254,255,28,38,33,9,18,53,203,
+192,164,147,88,115,54,137,62,113,82,147,164,192,203,13,57,8,59,39,254,254,
+254,245,246,211,107,162,60,87,144,135,88,81,102,214,213,23,139,31,1,36,1,
+26,1,39,1,50,149,160,173,254,46,88,64,56,107,222,75,2,117,254,194,254,179,
+5,139,3,241,1,14,227,254,78,137,116,70,71,122,137,71,251,230,254,242,241,
+5,139,7,1,76,1,64,1,40,1,72,94,102,152,32,46,153,103,94,12,117,116,67,60,
+24,81,75,176,196,188,163,164,41,46,254,194,2,221,69,95,53,59,105,119,1,181,
+252,243,0,7,0,44,255,234,10,218,7,200,0,82,0,97,0,106,0,132,0,158,0,159,0,
+160,0,0,1,16,0,33,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,
+6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,21,21,
+35,34,6,6,21,20,4,51,50,36,18,53,52,2,36,33,35,34,38,38,53,52,36,33,50,4,
+22,21,20,6,7,22,18,1,50,23,38,53,52,55,38,35,34,6,21,20,22,51,37,6,21,20,
+22,51,50,53,52,1,54,51,50,22,23,54,36,51,51,38,38,35,34,21,20,23,7,38,53,
+52,55,38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,
+53,52,38,35,34,6,1,19,10,218,254,88,254,106,198,254,242,73,35,148,107,193,
+108,50,136,101,149,179,1,26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,
+94,135,35,153,1,68,227,172,144,74,111,167,179,248,177,186,89,1,5,230,221,
+1,47,151,173,254,223,254,242,104,158,143,85,1,52,1,44,226,1,51,158,92,92,
+131,130,252,149,176,132,16,96,132,148,235,226,76,145,2,139,91,64,56,107,248,
+141,101,136,173,238,65,57,1,2,188,145,5,99,85,157,5,144,10,10,102,101,213,
+254,192,254,218,89,134,63,4,102,104,104,105,137,113,102,102,110,232,219,133,
+156,5,3,86,3,1,254,140,254,93,111,111,108,114,180,94,86,187,176,46,73,1,112,
+184,157,66,71,30,45,39,29,82,78,121,135,102,96,123,116,40,40,193,181,83,69,
+126,91,180,207,153,1,37,196,233,1,14,119,48,112,89,155,167,90,168,114,90,
+113,15,90,254,203,2,48,31,38,48,110,97,24,89,91,54,52,223,69,95,54,60,105,
+113,252,214,36,113,112,117,121,90,97,121,19,24,24,42,43,45,31,22,109,254,
+234,101,187,23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,3,33,1,
+183,0,8,0,44,255,234,10,216,7,200,0,115,0,124,0,150,0,162,0,188,0,202,0,203,
+0,204,0,0,1,20,7,22,22,21,16,0,33,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,
+39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,
+51,50,22,21,21,35,34,6,21,20,4,33,32,36,53,52,39,6,7,22,21,20,6,35,34,38,
+53,52,54,54,51,51,50,54,55,38,35,35,53,52,54,55,38,53,52,55,38,35,34,6,21,
+20,23,7,38,53,52,36,33,32,4,21,20,7,22,22,1,6,21,20,22,51,50,53,52,1,54,51,
+50,22,23,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,4,5,50,22,
+23,54,53,52,38,35,34,6,7,5,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,
+50,54,53,52,38,35,34,6,5,6,35,35,34,6,21,20,22,51,50,54,53,52,19,19,10,151,
+44,54,55,254,135,254,151,229,254,198,86,36,149,107,193,108,50,136,101,149,
+179,1,26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,94,135,35,153,1,68,
+227,119,100,57,74,167,179,176,200,176,1,43,1,29,1,30,1,45,53,77,110,28,191,
+192,189,193,80,147,128,95,140,167,56,78,133,177,112,105,154,88,77,106,214,
+213,20,139,28,1,36,1,26,1,39,1,50,131,97,102,254,162,88,64,56,107,248,199,
+101,136,170,235,64,47,236,190,32,5,100,85,157,10,145,13,17,30,30,213,254,
+192,5,180,90,149,59,17,82,75,85,100,5,249,70,89,134,63,4,102,104,104,105,
+137,113,102,102,110,232,219,133,156,6,145,69,102,102,112,79,122,125,120,118,
+27,75,3,212,93,81,53,146,93,254,251,254,237,114,114,114,114,180,94,86,187,
+176,46,73,1,112,184,157,66,71,30,45,39,29,82,78,121,135,102,96,123,116,18,
+18,193,181,83,140,147,183,203,202,183,116,66,70,36,52,58,115,109,113,108,
+80,82,37,49,47,30,83,145,180,32,40,164,103,94,12,117,116,65,53,24,72,75,176,
+196,188,163,154,45,22,134,2,7,69,95,53,59,105,119,253,96,36,112,112,118,119,
+89,98,121,30,31,23,53,49,54,42,2,109,73,25,25,42,39,73,83,98,89,205,101,187,
+23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,198,10,37,43,48,38,
+41,60,44,5,189,252,243,0,7,0,78,255,234,10,8,7,200,0,92,0,106,0,115,0,128,
+0,129,0,130,0,131,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,32,0,17,52,
+18,36,51,50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,
+50,22,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,
+52,2,38,36,35,35,34,38,38,53,52,36,33,50,4,22,21,20,6,7,22,18,1,50,23,38,
+53,52,55,38,35,32,21,20,22,51,37,6,21,20,22,51,50,53,52,1,54,51,50,23,54,
+36,55,38,38,35,34,6,1,19,3,10,8,241,229,109,163,67,71,155,113,119,172,44,
+57,221,157,254,241,254,211,145,1,21,185,55,47,8,41,47,230,229,217,201,173,
+199,97,31,44,28,146,47,1,55,241,133,248,143,100,36,36,218,237,136,127,125,
+130,137,130,134,105,143,74,85,180,254,237,214,141,157,142,87,1,57,1,44,239,
+1,66,162,94,90,142,142,252,137,165,132,16,95,125,181,254,41,78,145,2,173,
+90,64,56,107,250,46,44,52,93,52,58,1,16,198,83,156,91,173,215,3,201,86,168,
+2,150,254,176,254,164,82,98,102,78,113,106,108,111,1,75,1,41,195,1,37,160,
+6,138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,66,1,70,113,139,150,
+3,213,192,157,169,145,156,14,14,156,145,119,238,178,189,1,20,181,83,47,112,
+87,156,169,89,167,116,91,112,14,99,254,158,2,101,31,38,48,110,96,25,180,55,
+51,222,66,97,54,60,105,112,252,44,20,57,154,159,2,66,58,203,2,130,1,183,251,
+146,0,5,0,74,255,234,7,67,7,200,0,85,0,100,0,109,0,110,0,111,0,0,1,16,0,33,
+34,36,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,55,
+6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,14,3,21,
+20,22,51,50,36,18,53,52,46,2,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,22,
+18,1,50,23,38,53,52,55,38,35,34,6,21,20,22,51,37,6,21,20,22,51,50,53,52,5,
+19,7,67,254,75,254,94,209,254,222,141,96,98,72,110,29,2,208,5,100,85,81,76,
+1,146,3,18,178,188,113,134,63,66,151,1,33,188,33,44,46,40,166,181,177,131,
+156,111,77,46,255,235,227,1,58,160,85,177,253,238,128,158,143,85,1,60,1,56,
+1,96,1,105,95,94,139,130,252,125,188,141,16,95,127,174,246,235,76,145,2,180,
+90,64,56,107,253,237,86,3,1,254,140,254,93,127,219,140,112,175,54,8,135,89,
+98,61,53,13,7,7,7,23,22,56,43,32,250,195,234,161,73,104,245,127,186,1,20,
+146,7,7,190,184,83,16,48,72,106,79,166,186,150,1,36,200,148,233,165,76,48,
+112,89,158,164,196,176,91,114,13,95,254,202,2,54,31,37,49,110,96,25,87,93,
+54,52,222,66,97,54,60,105,112,139,1,183,0,5,0,78,255,234,7,192,7,200,0,91,
+0,100,0,110,0,111,0,112,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,38,
+35,34,0,21,20,23,7,38,53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,
+20,22,51,50,54,54,53,16,39,6,6,35,34,38,53,52,38,39,34,39,55,22,23,54,55,
+38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,20,6,7,22,18,1,6,21,20,
+22,51,50,53,52,3,38,39,22,23,22,22,51,50,54,1,19,7,192,251,236,112,167,69,
+74,158,116,188,221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,168,144,41,
+187,211,141,132,134,132,137,136,137,116,149,73,168,41,135,79,119,123,18,37,
+2,3,53,117,105,4,81,79,116,231,232,161,155,21,221,221,1,59,1,42,1,43,1,58,
+101,91,142,149,254,129,86,63,58,106,168,116,180,22,5,4,52,55,51,75,254,64,
+97,2,128,254,184,254,178,83,97,103,77,255,230,182,244,44,3,254,253,232,186,
+155,49,191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,14,14,157,144,115,
+229,175,1,99,226,72,81,144,144,113,90,23,2,126,40,56,99,89,10,110,120,90,
+88,10,143,21,165,150,173,196,183,164,89,113,12,127,254,123,3,124,66,91,53,
+56,102,112,254,111,112,84,49,113,87,62,53,1,58,1,163,0,7,0,44,255,234,10,
+65,7,200,0,91,0,101,0,111,0,123,0,140,0,141,0,142,0,0,1,16,2,4,33,34,36,39,
+6,6,35,34,36,53,53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,
+23,54,36,51,50,4,23,7,4,17,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,
+38,39,39,55,22,23,54,55,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,32,4,21,
+20,6,7,22,18,1,6,21,20,22,51,50,53,52,38,3,38,39,22,23,22,22,51,50,54,1,54,
+54,55,38,35,32,7,54,51,50,22,5,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,
+6,1,19,10,65,188,254,149,254,255,213,254,230,70,58,247,189,240,254,242,74,
+130,1,5,190,39,111,59,70,10,12,143,27,147,128,92,130,39,149,1,36,156,169,
+1,48,112,56,254,109,246,237,211,1,40,154,86,42,122,71,119,123,19,35,9,51,
+105,92,7,79,63,121,221,223,161,155,21,221,221,1,49,1,30,1,40,1,52,100,90,
+105,111,254,203,87,63,58,106,68,79,109,178,22,5,4,52,55,48,71,251,238,44,
+178,135,178,225,254,223,255,88,109,141,196,253,71,88,71,70,12,194,186,208,
+206,191,178,90,150,4,242,57,3,71,254,250,254,119,206,121,122,122,121,215,
+203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,135,94,93,119,109,
+136,124,143,33,254,181,177,186,172,1,75,211,201,154,57,65,144,144,124,82,
+21,3,124,34,55,95,87,9,111,119,90,88,10,143,21,165,150,173,196,183,164,88,
+114,12,107,254,226,3,3,66,93,53,56,102,53,86,254,66,126,87,49,112,87,62,45,
+253,241,100,124,23,143,223,28,98,102,102,98,5,44,56,143,147,177,164,154,160,
+27,3,53,1,163,0,7,0,44,255,234,10,87,7,200,0,77,0,92,0,101,0,126,0,143,0,
+144,0,145,0,0,1,16,0,33,34,36,39,6,6,35,34,36,53,53,7,39,0,55,38,35,34,6,
+21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,23,54,51,50,22,21,21,35,34,
+6,6,21,20,4,51,50,36,18,53,52,2,36,33,35,34,38,38,53,52,36,33,50,4,22,21,
+20,6,7,22,18,1,50,23,38,53,52,55,38,35,34,6,21,20,22,51,37,6,21,20,22,51,
+50,53,52,1,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,32,5,54,51,
+50,22,5,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,1,19,10,87,254,88,254,
+106,209,254,233,70,57,250,194,240,254,242,74,130,1,5,190,39,111,59,70,10,
+12,143,27,147,128,184,77,149,1,36,156,160,130,76,114,166,180,248,177,186,
+89,1,5,230,221,1,47,151,173,254,223,254,242,104,158,143,85,1,52,1,44,226,
+1,51,158,92,92,131,130,252,149,176,132,16,96,132,148,235,226,76,145,2,139,
+91,64,56,107,251,98,60,246,185,145,5,99,85,157,5,144,10,9,95,109,254,223,
+255,0,88,110,146,201,253,61,88,71,70,12,194,186,208,206,191,178,90,150,4,
+189,104,3,1,254,140,254,93,124,125,125,124,215,203,25,126,73,1,121,184,148,
+66,71,30,45,39,29,82,78,121,135,187,119,109,43,43,191,183,83,69,126,91,180,
+207,153,1,37,196,233,1,14,119,48,112,89,155,167,90,168,114,90,113,15,90,254,
+203,2,48,31,38,48,110,97,24,89,91,54,52,223,69,95,54,60,105,113,252,53,105,
+105,90,97,121,19,24,24,42,43,40,33,25,223,28,99,101,102,98,5,44,56,143,147,
+177,164,154,160,27,4,216,254,73,0,6,0,78,255,234,7,187,7,200,0,71,0,86,0,
+96,0,97,0,98,0,99,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,38,35,34,
+0,21,20,23,7,38,53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,
+51,50,18,17,52,2,38,36,35,35,34,38,38,53,52,36,33,50,4,22,21,20,6,7,22,18,
+1,50,23,38,53,52,55,38,35,32,6,21,20,22,51,37,6,21,20,22,51,50,53,52,38,1,
+19,3,7,187,245,236,114,171,67,75,156,114,188,221,185,173,24,26,216,255,0,
+80,143,87,1,67,1,12,168,144,41,187,211,141,132,134,132,137,135,139,166,166,
+85,180,254,237,214,181,158,143,85,1,67,1,65,245,1,70,161,92,92,142,142,252,
+137,170,126,15,95,122,189,254,250,244,78,145,2,213,90,64,56,107,66,253,62,
+21,104,2,150,254,176,254,164,85,95,105,75,255,230,182,244,44,3,254,253,232,
+186,155,49,191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,14,14,156,145,
+1,11,1,12,189,1,20,181,83,48,111,87,161,164,89,167,116,90,113,15,97,254,158,
+2,100,30,35,50,110,96,25,86,94,55,51,222,68,95,54,60,105,51,89,1,16,254,73,
+254,213,0,5,0,74,255,234,7,67,7,200,0,80,0,95,0,104,0,105,0,106,0,0,1,16,
+0,33,34,36,38,53,52,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,6,6,21,
+20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,33,34,6,6,21,20,4,51,
+50,62,3,53,52,38,38,36,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,22,18,1,
+50,23,38,53,52,55,38,35,34,6,21,20,22,51,37,6,21,20,22,51,50,53,52,1,19,7,
+67,254,75,254,94,205,254,212,156,132,250,214,127,5,100,85,157,6,145,9,21,
+177,191,113,134,63,66,151,1,33,188,39,41,39,44,166,181,254,245,175,185,92,
+1,15,239,145,224,159,113,61,88,181,255,0,228,128,158,143,85,1,60,1,56,1,96,
+1,105,95,94,139,130,252,125,188,141,16,95,127,174,246,235,76,145,2,180,90,
+64,56,107,253,156,21,3,1,254,140,254,93,131,242,162,125,190,104,89,98,121,
+19,24,24,50,35,54,45,32,249,196,234,161,73,104,245,127,186,1,20,146,8,8,191,
+183,83,65,125,96,181,206,59,103,154,200,126,157,231,162,72,48,112,89,158,
+164,196,176,91,114,13,95,254,202,2,54,31,37,49,110,96,25,87,93,54,52,222,
+66,97,54,60,105,112,1,44,254,73,0,7,0,58,255,234,10,96,7,200,0,95,0,105,0,
+115,0,128,0,142,0,143,0,144,0,0,1,16,2,4,33,34,36,39,6,4,35,32,0,3,55,22,
+23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,
+32,1,7,4,17,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,22,
+23,54,55,38,35,34,6,21,20,22,23,7,38,38,53,52,36,33,50,4,22,21,20,6,7,22,
+18,1,6,21,20,22,51,50,53,52,38,3,38,39,22,23,22,22,51,50,54,1,54,51,50,22,
+23,54,54,55,38,38,35,32,3,6,6,7,22,22,51,50,54,53,52,38,35,34,1,19,10,96,
+188,254,149,254,255,214,254,228,69,59,255,0,196,254,211,254,149,48,146,5,
+9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,192,69,99,1,11,156,
+1,81,1,10,56,254,109,246,237,211,1,40,154,86,42,122,71,119,123,19,35,9,51,
+100,97,7,79,63,121,221,223,161,155,21,221,221,1,49,1,30,200,1,13,135,100,
+90,105,111,254,203,87,63,58,106,68,79,109,178,22,5,4,52,55,48,71,250,7,49,
+46,142,197,56,44,178,133,89,205,116,254,246,216,55,223,193,65,247,200,208,
+225,194,175,67,4,68,100,3,71,254,250,254,119,206,123,123,123,123,1,66,1,59,
+24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,200,118,123,
+254,252,143,33,254,181,177,186,172,1,75,211,201,154,57,65,144,144,124,82,
+21,3,124,32,57,95,87,9,111,119,90,88,10,143,21,165,150,173,196,84,156,107,
+88,114,12,108,254,226,3,4,66,93,53,56,102,53,86,254,66,126,87,49,112,87,62,
+45,254,173,7,95,94,97,120,24,71,72,254,173,171,169,5,156,150,184,166,149,
+156,3,26,1,163,0,6,0,58,253,213,8,247,7,200,0,102,0,111,0,139,0,153,0,154,
+0,155,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,
+20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,55,54,55,38,53,52,55,38,
+35,34,6,21,20,23,7,38,53,52,54,51,50,22,22,21,20,6,7,22,22,21,21,33,34,14,
+2,21,20,22,51,50,55,23,6,7,6,21,20,51,50,55,23,6,35,34,38,53,52,55,35,6,19,
+6,21,20,22,51,50,53,52,1,54,51,50,22,23,62,2,51,51,38,38,35,34,6,21,20,23,
+7,38,53,53,38,38,35,34,6,7,6,6,7,22,22,51,50,54,53,52,38,35,34,1,1,7,16,195,
+254,245,64,59,255,0,197,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,
+70,62,67,10,12,143,27,147,128,96,130,35,99,1,11,156,215,174,10,72,155,103,
+92,66,63,170,172,27,138,36,253,237,187,245,110,114,107,90,91,254,197,178,
+176,122,54,240,226,205,177,42,89,105,132,194,82,64,33,88,122,150,165,86,25,
+11,147,94,64,56,107,250,217,49,46,149,202,54,42,153,221,185,175,5,102,89,
+83,80,3,147,4,78,165,103,127,211,132,55,223,193,65,247,200,208,225,194,175,
+67,3,124,1,42,22,126,122,124,124,1,66,1,59,24,32,36,1,17,55,105,77,133,120,
+70,67,30,45,39,29,82,78,121,135,100,100,118,123,93,11,79,3,53,134,104,98,
+7,114,98,60,63,34,86,76,160,191,98,158,95,101,117,4,42,170,129,83,34,85,126,
+84,159,185,88,137,47,25,108,139,171,31,131,40,162,145,123,104,1,6,97,69,99,
+53,59,105,125,253,119,7,104,104,73,99,49,88,99,62,50,18,12,18,29,21,20,44,
+41,101,238,171,169,5,156,150,184,166,149,156,4,189,252,241,0,6,0,58,254,42,
+8,200,7,200,0,111,0,120,0,148,0,162,0,163,0,164,0,0,5,34,36,39,6,4,35,32,
+0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,
+22,23,54,36,51,50,23,55,54,55,38,53,52,55,38,35,34,6,21,20,23,7,38,53,52,
+54,51,50,22,22,21,20,6,7,22,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,
+22,21,20,4,33,32,36,53,53,52,55,23,21,20,22,51,50,54,54,53,52,39,52,39,6,
+19,6,21,20,22,51,50,53,52,1,54,51,50,22,23,62,2,51,51,38,38,35,34,6,21,20,
+23,7,38,53,53,38,38,35,34,6,7,6,6,7,22,22,51,50,54,53,52,38,35,34,1,1,7,16,
+195,254,245,64,59,255,0,197,254,211,254,149,48,146,5,9,20,72,94,93,77,29,
+17,83,70,62,67,10,12,143,27,147,128,96,130,35,99,1,11,156,215,174,10,72,155,
+103,92,66,63,170,172,27,138,36,253,237,187,245,110,114,107,90,91,254,197,
+178,176,122,54,240,226,205,177,42,26,7,9,254,250,254,253,255,0,254,250,1,
+149,181,187,123,163,85,2,1,106,2,94,64,56,107,250,217,49,46,149,202,54,42,
+153,221,185,175,5,102,89,83,80,3,147,4,78,165,103,127,211,132,55,223,193,
+65,247,200,208,225,194,175,67,3,124,1,42,22,126,122,124,124,1,66,1,59,24,
+32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,100,100,118,
+123,93,11,79,3,53,134,104,98,7,114,98,60,63,34,86,76,160,191,98,158,95,101,
+117,4,42,170,129,83,34,85,126,84,159,185,88,137,14,3,43,70,196,219,206,191,
+17,11,9,7,7,150,125,55,124,111,19,14,7,5,32,6,97,69,99,53,59,105,125,253,
+119,7,104,104,73,99,49,88,99,62,50,18,12,18,29,21,20,44,41,101,238,171,169,
+5,156,150,184,166,149,156,4,189,252,241,0,7,0,58,255,234,10,194,7,200,0,90,
+0,105,0,114,0,126,0,140,0,141,0,142,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,
+6,6,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,
+54,51,50,23,54,36,51,50,4,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,
+50,18,17,52,2,38,36,35,35,34,38,38,53,52,36,33,32,4,21,20,6,7,22,18,1,50,
+23,38,53,52,55,38,35,34,6,21,20,22,51,37,6,21,20,22,51,50,53,52,1,54,51,50,
+22,23,54,54,55,38,35,32,3,6,6,7,22,22,51,50,54,53,52,38,35,34,1,3,10,194,
+241,229,109,164,67,72,154,112,121,171,44,63,250,187,254,211,254,149,48,146,
+5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,192,69,99,1,11,
+156,168,1,46,133,61,189,209,136,127,124,131,137,130,134,159,163,85,180,254,
+237,214,141,157,142,87,1,57,1,44,1,101,1,110,94,90,142,142,252,137,165,132,
+16,95,125,181,236,235,78,145,2,173,90,64,56,107,249,62,49,46,146,201,55,48,
+174,126,177,233,254,246,216,55,223,193,65,247,200,208,225,194,175,67,5,112,
+179,2,150,254,176,254,164,83,97,104,76,116,108,112,112,1,66,1,59,24,32,36,
+1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,200,118,123,130,130,
+140,11,218,175,157,169,143,158,14,14,156,145,1,15,1,8,189,1,20,181,83,47,
+112,87,156,169,195,177,91,112,14,99,254,158,2,101,31,38,48,110,96,25,90,90,
+55,51,222,66,97,54,60,105,112,252,244,7,101,101,104,127,23,143,254,173,171,
+169,5,156,150,184,166,149,156,4,189,254,73,0,7,0,58,255,234,10,118,7,200,
+0,82,0,97,0,106,0,131,0,145,0,146,0,147,0,0,1,16,0,33,34,36,39,6,4,35,32,
+0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,
+22,23,54,36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,
+2,36,33,35,34,38,38,53,52,36,33,32,4,21,20,6,7,22,18,1,50,23,38,53,52,55,
+38,35,34,6,21,20,22,51,37,6,21,20,22,51,50,53,52,1,54,51,50,22,23,54,54,51,
+51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,3,6,6,7,22,22,51,50,54,53,
+52,38,35,34,1,19,10,118,254,88,254,106,212,254,231,69,58,254,254,200,254,
+211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,
+128,96,130,35,99,1,11,156,158,138,75,127,166,180,248,177,186,89,1,5,230,221,
+1,47,151,173,254,223,254,242,104,158,143,85,1,52,1,44,1,81,1,98,92,92,131,
+130,252,149,176,132,16,96,132,148,235,226,76,145,2,139,91,64,56,107,249,115,
+49,46,145,200,55,60,251,180,145,5,99,85,157,5,144,10,8,97,124,253,217,55,
+223,193,65,247,200,208,225,194,175,67,4,68,21,3,1,254,140,254,93,128,129,
+129,128,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,
+121,135,100,100,118,123,51,51,191,183,83,69,126,91,180,207,153,1,37,196,233,
+1,14,119,48,112,89,155,167,199,173,90,113,15,90,254,203,2,48,31,38,48,110,
+97,24,89,91,54,52,223,69,95,54,60,105,113,252,243,7,100,99,104,108,90,97,
+121,19,24,24,42,43,41,26,31,254,173,171,169,5,156,150,184,166,149,156,4,189,
+254,73,0,4,0,15,255,234,4,183,7,200,0,95,0,104,0,105,0,106,0,0,1,20,7,39,
+54,53,52,38,35,34,6,7,22,18,21,20,6,35,34,38,39,38,39,6,7,39,62,2,55,62,2,
+53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,6,7,6,7,22,23,30,
+2,51,50,54,53,52,38,39,53,52,54,55,38,53,52,55,38,35,34,6,21,20,23,7,38,53,
+52,36,51,32,4,21,20,7,22,1,6,21,20,22,51,50,53,52,1,1,4,172,13,145,10,61,
+63,65,81,8,208,229,239,214,112,203,138,47,44,26,16,146,2,42,73,80,79,70,39,
+66,60,57,60,8,144,13,146,118,127,151,45,85,97,31,26,37,117,82,86,100,57,148,
+157,221,212,105,101,150,92,59,68,183,185,19,140,26,1,4,250,1,5,1,19,134,154,
+254,225,93,64,56,107,254,33,1,142,3,247,48,53,23,31,30,63,58,93,94,30,254,
+255,202,225,240,66,88,30,15,62,126,30,65,139,142,130,129,134,134,61,82,84,
+63,54,32,33,23,42,60,111,127,156,137,79,169,158,151,49,48,12,64,46,38,23,
+159,155,171,188,4,31,182,192,32,41,162,105,96,8,120,113,68,46,24,64,79,171,
+201,188,163,160,43,45,1,160,69,99,53,59,105,123,1,177,252,241,255,255,0,44,
+255,234,7,196,7,200,2,34,0,24,0,0,0,3,0,98,6,131,0,0,0,7,0,74,255,234,6,180,
+7,200,0,79,0,88,0,100,0,108,0,118,0,119,0,120,0,0,5,34,39,6,7,39,54,18,53,
+52,38,35,34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,
+0,21,20,7,51,22,22,51,50,18,17,52,2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,
+38,39,6,7,39,54,55,54,54,51,50,22,23,22,18,17,16,2,1,54,51,50,23,38,38,35,
+32,19,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,53,52,1,22,51,50,54,
+53,52,38,35,34,1,1,5,4,197,51,58,70,109,135,118,194,179,136,206,113,21,136,
+165,120,143,154,143,129,201,108,151,1,20,181,250,1,13,87,40,5,60,71,124,147,
+127,126,7,22,121,23,8,69,63,8,160,128,156,205,34,111,106,68,151,124,22,249,
+197,224,254,11,193,194,226,252,45,153,148,199,165,34,177,128,255,0,205,5,
+70,72,43,42,43,44,113,73,68,22,126,20,254,182,73,131,77,75,67,59,121,3,117,
+252,123,22,170,85,85,96,147,1,7,146,168,198,119,223,148,109,71,153,137,105,
+124,135,136,243,146,189,1,32,157,254,243,226,185,175,79,80,1,37,1,35,249,
+1,101,107,35,63,34,58,80,33,16,24,29,99,118,119,112,39,61,135,75,37,149,166,
+201,179,120,254,75,254,195,254,148,254,142,6,166,33,61,89,94,254,68,51,44,
+40,45,45,42,54,134,7,17,102,34,43,54,38,250,205,92,57,60,48,61,6,114,253,
+30,255,255,0,78,255,234,6,244,7,200,2,34,0,26,0,0,0,3,0,98,5,185,0,0,255,
+255,0,62,255,234,6,77,7,200,2,34,0,27,0,0,0,3,0,98,5,72,0,0,0,7,0,52,255,
+234,6,205,7,200,0,92,0,101,0,113,0,121,0,132,0,133,0,134,0,0,1,16,2,35,34,
+38,39,6,6,35,34,38,53,52,54,55,55,62,2,53,52,38,35,35,22,22,21,20,6,35,34,
+38,53,52,54,51,50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,
+51,50,18,17,52,2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,
+54,54,51,50,22,23,22,18,1,38,38,35,34,7,54,51,50,3,51,50,54,53,52,38,35,34,
+6,21,20,39,6,7,22,23,38,53,52,1,6,6,21,20,22,51,50,54,53,52,1,1,6,205,252,
+248,103,161,68,67,166,113,189,221,203,238,71,82,75,38,174,177,6,21,22,143,
+108,114,129,242,230,242,243,79,155,122,189,161,136,129,139,135,138,128,131,
+173,174,108,108,5,17,121,21,8,55,73,6,160,128,156,207,32,99,112,67,137,132,
+22,247,198,232,254,4,171,171,254,20,31,179,133,250,73,120,167,211,226,5,73,
+69,43,42,43,44,112,76,67,22,127,20,254,175,88,82,53,51,54,52,3,124,253,163,
+2,200,254,147,254,143,86,94,99,81,211,185,166,203,70,21,24,31,49,42,72,67,
+33,80,35,111,118,122,101,135,154,139,137,83,98,72,31,48,151,121,122,128,141,
+160,14,14,152,149,1,35,1,36,234,1,88,109,27,45,34,53,71,32,23,21,24,99,118,
+121,112,36,65,134,75,40,146,166,215,186,123,254,86,2,113,93,101,149,27,254,
+190,53,42,40,45,45,42,54,136,7,17,105,33,43,54,36,254,84,13,72,48,48,54,55,
+49,79,3,167,250,222,255,255,0,77,255,234,8,56,7,200,2,34,0,29,0,0,0,3,0,98,
+6,117,0,0,0,5,0,62,255,234,6,59,7,200,0,81,0,90,0,102,0,110,0,111,0,0,1,16,
+2,4,33,34,36,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,
+53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,36,18,53,52,2,39,6,7,39,
+54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,22,21,21,22,
+18,1,38,38,35,34,7,54,51,50,3,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,
+38,53,52,1,6,59,199,254,126,254,241,207,254,222,142,99,94,70,111,50,2,229,
+6,100,85,79,78,1,146,3,155,139,167,179,177,172,160,129,60,255,235,221,1,57,
+168,82,82,7,8,121,18,9,63,61,4,160,128,157,206,32,80,120,67,119,138,22,249,
+197,156,220,114,141,141,254,86,27,185,137,253,72,134,137,228,225,5,73,69,
+43,42,43,44,111,76,68,20,129,20,2,169,3,88,254,247,254,110,211,127,219,140,
+116,173,51,7,135,89,98,59,55,13,7,7,7,23,22,114,124,193,181,83,26,84,126,
+85,166,186,171,1,80,225,161,1,0,94,25,20,34,45,59,42,22,22,12,99,118,121,
+111,31,70,135,68,44,149,166,99,188,117,23,115,254,170,2,30,102,109,152,30,
+254,190,53,42,40,45,45,42,54,138,7,17,107,33,43,54,39,1,196,0,8,0,74,255,
+234,6,59,7,200,0,47,0,92,0,104,0,116,0,124,0,125,0,126,0,127,0,0,1,23,4,7,
+54,51,50,22,22,21,20,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,
+34,21,20,23,7,38,53,52,54,55,38,53,52,54,51,50,22,23,54,19,6,35,34,38,38,
+53,52,18,55,38,38,35,34,6,21,20,22,23,38,53,52,54,51,50,22,22,21,20,6,7,22,
+21,21,35,34,6,21,20,4,33,32,36,53,52,1,51,50,54,53,52,38,35,34,6,21,20,1,
+50,23,52,55,53,52,38,35,34,6,7,21,22,22,51,50,55,38,35,1,23,1,5,245,60,254,
+194,170,53,57,88,123,62,11,48,48,254,125,254,141,245,254,184,160,1,9,1,4,
+31,5,99,85,157,9,144,14,117,113,80,251,220,202,247,32,122,43,90,183,78,128,
+83,136,131,5,182,167,160,176,81,73,20,114,95,63,100,58,151,125,71,176,199,
+177,1,48,1,24,1,38,1,57,253,55,5,70,72,43,42,43,44,1,104,179,121,1,85,82,
+79,101,12,4,69,92,125,44,91,203,1,81,239,254,216,6,123,129,115,191,30,81,
+150,103,74,57,52,137,86,254,251,254,237,129,239,168,208,210,90,97,121,23,
+38,23,48,54,99,120,15,84,128,158,192,159,145,88,252,52,141,68,171,138,154,
+1,24,118,128,141,120,99,84,93,18,43,54,92,99,46,92,64,96,118,3,97,159,83,
+142,149,178,204,206,187,65,2,160,50,45,40,45,45,42,54,254,151,52,9,8,18,107,
+107,105,92,135,75,104,118,61,3,148,198,1,221,0,8,0,74,255,234,6,18,7,200,
+0,46,0,90,0,102,0,115,0,120,0,121,0,122,0,123,0,0,1,23,4,7,54,51,50,22,21,
+20,7,22,22,21,16,0,33,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,
+52,54,55,38,53,52,54,51,50,22,23,54,1,52,55,54,55,38,38,35,34,6,21,20,22,
+23,38,53,52,54,51,50,22,21,20,6,35,35,22,21,21,35,34,6,21,20,4,33,50,36,54,
+53,52,38,35,35,3,51,50,54,53,52,38,35,34,6,21,20,5,7,20,30,2,51,50,53,52,
+38,35,34,7,38,39,6,7,1,23,1,5,213,61,254,216,84,26,18,119,146,111,86,86,254,
+136,254,151,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,133,124,78,251,
+220,191,243,41,96,253,254,180,28,85,10,181,162,160,176,81,73,20,114,95,100,
+121,160,128,18,72,176,199,177,1,48,1,24,194,1,8,129,178,198,177,111,5,70,
+72,43,42,43,44,1,184,1,8,23,45,32,81,71,65,34,115,26,10,28,3,1,128,179,253,
+222,6,123,129,102,178,4,119,101,138,41,52,171,118,254,252,254,236,129,239,
+168,208,210,90,97,121,23,38,23,48,54,105,122,9,85,125,158,192,144,136,79,
+253,37,248,90,108,99,123,133,119,100,84,93,18,43,54,92,99,108,94,99,118,95,
+161,83,142,149,178,204,96,172,113,151,141,1,201,50,45,40,45,45,42,54,174,
+26,52,48,40,23,89,46,58,191,39,66,46,59,3,13,198,1,221,0,8,0,44,255,234,11,
+38,7,200,0,101,0,110,0,122,0,130,0,144,0,170,0,171,0,172,0,0,1,16,2,35,34,
+38,39,6,6,35,34,38,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,6,21,
+20,23,7,38,53,52,54,51,50,22,23,54,36,51,32,5,7,14,2,21,20,22,51,50,54,53,
+53,51,21,20,22,51,50,18,17,52,2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,
+39,6,7,39,54,55,54,54,51,50,22,22,21,21,22,18,1,54,51,50,23,38,38,35,34,19,
+51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,53,52,1,54,51,50,22,23,54,
+54,55,38,38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,
+54,53,52,38,35,34,6,1,1,11,38,246,242,99,156,67,71,153,114,108,162,46,40,
+139,94,193,108,50,136,101,149,179,1,26,130,1,12,186,40,113,59,70,22,143,27,
+147,128,95,134,35,146,1,53,220,1,92,1,21,53,123,180,93,136,127,125,130,137,
+124,126,168,168,100,99,5,14,121,20,9,59,68,5,160,128,156,204,34,82,110,67,
+113,135,21,248,199,156,220,114,161,161,251,139,129,163,220,158,31,181,132,
+254,203,5,70,72,43,42,43,44,112,73,70,21,128,20,251,94,99,138,170,245,64,
+46,181,135,116,210,129,186,254,211,254,222,89,134,63,4,102,104,104,105,137,
+113,102,102,110,232,219,133,156,4,3,1,39,2,200,254,148,254,142,84,96,102,
+78,98,93,94,97,180,94,86,187,176,46,73,1,127,169,157,66,71,45,69,29,82,78,
+121,135,102,95,119,119,249,151,6,104,178,116,157,169,145,156,14,14,152,149,
+1,35,1,36,229,1,81,108,18,41,34,51,66,37,23,20,23,99,118,118,111,31,66,134,
+66,44,149,168,99,188,117,5,124,254,89,2,159,32,74,94,102,254,68,51,44,40,
+45,45,42,54,136,8,17,104,33,43,54,36,253,114,36,122,119,122,146,25,76,67,
+112,254,237,101,187,23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,
+4,216,251,149,255,255,0,74,253,213,10,129,7,200,2,34,0,34,0,0,0,3,0,98,10,
+98,0,0,255,255,0,77,253,213,9,124,7,200,2,34,0,35,0,0,0,3,0,98,9,92,0,0,0,
+8,0,74,255,234,7,36,7,200,0,55,0,99,0,111,0,124,0,129,0,130,0,131,0,132,0,
+0,1,23,4,7,54,51,50,22,21,20,7,22,22,21,16,0,33,32,0,17,52,36,33,51,38,38,
+35,34,21,20,23,7,38,53,52,55,6,17,20,23,7,38,38,53,16,0,37,38,53,52,54,51,
+50,22,23,54,1,52,55,54,55,38,38,35,34,6,21,20,22,23,38,53,52,54,51,50,22,
+22,21,20,6,35,35,22,21,21,35,34,6,21,20,4,33,32,36,53,52,38,35,35,3,51,50,
+54,53,52,38,35,34,6,21,20,5,7,20,30,2,51,50,53,52,38,35,34,7,38,39,6,7,1,
+23,3,6,232,60,254,218,86,26,18,120,146,111,86,86,254,136,254,151,254,152,
+254,138,1,9,1,5,31,5,99,85,158,10,145,10,5,194,113,134,63,66,1,58,1,21,77,
+251,220,191,243,41,96,253,255,179,28,85,9,181,163,160,176,81,73,20,114,95,
+63,100,58,160,128,17,71,175,199,178,1,48,1,25,1,26,1,48,178,197,177,112,5,
+73,69,43,42,44,43,1,185,1,7,24,45,32,81,72,64,34,116,27,8,29,3,1,154,149,
+216,6,123,129,102,178,4,119,101,138,41,52,171,118,254,252,254,236,1,20,1,
+4,207,211,90,97,121,22,39,23,38,62,30,18,123,254,211,234,161,73,104,245,127,
+1,19,1,69,7,84,125,158,192,144,136,80,253,36,248,89,108,99,124,133,120,99,
+84,93,18,43,54,92,99,46,92,64,99,118,97,159,83,141,150,178,204,202,179,151,
+141,1,201,53,42,40,45,46,41,54,174,26,52,48,40,23,89,45,59,191,46,58,44,60,
+3,13,198,1,221,0,6,0,74,255,234,6,13,7,200,0,59,0,69,0,81,0,89,0,90,0,91,
+0,0,1,16,2,4,33,34,36,38,53,52,0,33,50,23,7,38,35,34,6,21,20,22,51,50,36,
+18,53,52,38,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,
+54,51,50,22,22,21,21,22,18,1,54,51,50,22,23,38,38,35,32,19,51,50,54,53,52,
+38,35,34,6,21,20,39,6,7,22,23,38,53,52,3,3,6,13,197,254,139,254,252,214,254,
+222,141,1,60,1,16,121,97,13,92,111,210,230,250,244,216,1,49,156,79,79,7,8,
+121,20,7,51,73,4,160,128,154,202,36,74,94,67,112,109,17,249,203,156,220,114,
+137,139,251,182,143,149,105,200,80,28,185,135,254,251,210,5,70,72,43,42,43,
+44,112,73,69,23,125,20,79,207,3,88,254,243,254,111,208,127,228,154,247,1,
+5,14,141,14,188,179,176,187,178,1,82,216,163,255,93,25,20,34,52,54,37,29,
+24,14,99,118,115,105,32,57,135,61,38,154,174,99,188,117,22,112,254,165,2,
+80,40,44,43,102,107,254,68,50,45,40,45,45,42,54,136,9,20,101,32,43,54,36,
+1,199,253,30,0,7,0,74,255,234,6,130,7,200,0,65,0,84,0,96,0,106,0,107,0,108,
+0,109,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,
+6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,52,2,39,6,6,35,34,39,
+6,35,34,38,38,53,52,54,51,50,22,22,21,20,7,22,18,1,22,23,38,38,35,34,6,21,
+20,22,23,38,53,52,54,51,50,23,3,51,50,54,53,52,38,35,34,6,21,20,5,38,39,22,
+23,22,22,51,50,54,19,3,1,6,130,251,236,112,167,69,74,158,116,188,221,143,
+1,14,183,111,115,14,87,117,217,237,141,132,132,133,138,136,137,116,149,73,
+84,84,41,135,79,216,24,64,105,128,182,92,251,220,155,223,120,2,211,211,252,
+197,153,110,22,186,149,160,176,81,73,20,114,95,39,33,130,5,70,72,43,42,43,
+44,2,75,116,180,22,5,4,52,55,51,75,175,65,252,149,2,128,254,184,254,178,83,
+97,103,77,255,230,153,245,134,14,139,13,213,192,157,169,147,154,14,14,157,
+144,115,229,175,177,1,35,113,72,81,232,34,86,148,92,158,192,94,182,116,18,
+20,150,254,74,3,18,51,59,103,108,119,100,84,93,18,43,54,92,99,9,254,220,51,
+44,40,45,45,42,54,105,112,84,49,113,87,62,53,2,221,254,93,254,193,0,5,0,62,
+255,234,6,150,7,200,0,90,0,100,0,112,0,120,0,121,0,0,1,16,2,35,34,38,39,6,
+6,35,34,38,53,16,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,
+51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,
+52,2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,
+22,23,22,18,1,38,38,35,34,7,54,51,50,23,5,51,50,54,53,52,38,35,34,6,21,20,
+39,6,7,22,23,38,53,52,1,6,150,254,247,103,159,67,76,161,112,190,229,229,71,
+144,40,2,136,5,100,85,79,78,1,147,3,155,140,165,181,55,157,166,153,86,146,
+129,136,138,137,128,131,173,175,109,108,8,15,121,22,7,59,69,6,160,128,159,
+206,31,102,121,67,148,134,24,248,195,232,254,4,172,172,254,18,31,179,133,
+250,74,121,156,206,173,254,129,5,70,72,43,42,43,44,112,77,66,20,129,20,2,
+240,2,200,254,147,254,143,85,95,104,76,236,204,1,9,121,7,135,89,98,59,55,
+14,8,5,7,23,22,114,124,190,183,84,25,86,157,111,139,155,146,155,14,14,153,
+148,1,37,1,34,235,1,88,110,33,41,34,54,69,35,21,21,24,99,118,123,112,36,68,
+135,78,39,148,162,214,188,122,254,86,2,112,94,101,150,28,68,254,50,45,40,
+45,45,42,54,137,8,15,107,33,43,54,37,1,198,0,6,0,62,255,234,6,155,7,200,0,
+86,0,105,0,117,0,127,0,128,0,129,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,
+54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,
+35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,52,2,39,6,6,
+35,34,39,6,35,34,38,38,53,52,54,51,50,22,22,21,20,7,22,18,1,22,23,38,38,35,
+34,6,21,20,22,23,38,53,52,54,51,50,23,3,51,50,54,53,52,38,35,34,6,21,20,5,
+38,39,22,23,22,22,51,50,54,19,3,6,155,251,236,113,168,67,76,161,112,189,230,
+117,114,66,151,40,2,136,5,100,85,79,78,1,147,3,155,140,165,181,60,151,166,
+154,86,146,129,136,138,137,135,139,117,150,71,84,84,40,134,80,217,24,66,102,
+128,182,92,251,220,155,223,120,2,210,211,252,197,144,120,21,185,151,160,176,
+81,73,20,114,95,40,31,129,5,70,72,43,42,43,44,2,75,119,177,22,5,4,52,55,54,
+74,147,65,2,128,254,184,254,178,84,96,104,76,237,203,130,198,59,8,135,89,
+98,59,55,14,8,5,7,23,22,114,124,190,183,84,24,87,157,111,139,155,146,155,
+14,14,156,145,119,231,169,178,1,34,112,71,81,231,33,86,148,92,158,192,94,
+182,116,19,20,151,254,75,3,19,48,63,102,110,119,100,84,93,18,43,54,92,99,
+9,254,220,50,45,40,45,45,42,54,106,115,81,49,112,87,62,56,2,218,254,93,0,
+9,0,10,255,234,9,85,7,200,0,75,0,93,0,105,0,114,0,143,0,155,0,156,0,157,0,
+158,0,0,1,16,2,35,34,38,39,55,22,22,51,50,54,54,53,52,38,35,34,6,21,21,35,
+53,52,38,35,34,7,22,21,20,2,4,35,34,36,39,7,39,1,38,53,52,54,55,38,53,52,
+54,51,50,22,23,54,55,23,7,22,21,20,7,39,54,55,7,22,23,54,51,50,23,54,51,50,
+18,1,55,38,38,35,34,6,21,20,22,23,38,53,52,54,51,50,22,5,51,50,54,53,52,38,
+35,34,6,21,20,1,54,1,38,35,34,6,21,20,3,22,22,51,50,54,54,53,52,38,39,4,1,
+22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,39,5,51,50,54,53,52,38,35,34,
+6,21,20,19,1,1,9,85,191,190,122,185,56,141,41,103,76,89,99,40,103,103,90,
+93,136,70,70,65,42,51,168,254,195,207,200,254,211,141,58,111,1,26,58,188,
+170,107,251,220,165,230,56,26,87,99,167,2,68,127,37,13,157,149,90,72,96,134,
+77,79,194,172,174,251,67,122,36,177,132,160,176,81,73,20,114,95,86,116,254,
+252,5,70,72,43,42,43,44,254,32,176,1,32,24,25,189,243,103,119,252,162,166,
+250,137,171,162,254,240,254,226,66,116,28,132,114,117,135,183,151,126,211,
+75,1,166,7,73,99,55,54,50,55,234,2,109,249,199,2,34,254,228,254,228,138,136,
+57,102,88,98,190,157,220,213,132,158,13,12,132,105,48,124,157,198,254,225,
+151,130,146,64,99,1,28,108,127,144,226,48,90,146,158,192,101,100,25,77,113,
+144,18,17,120,120,37,64,55,144,58,115,63,120,175,254,215,2,45,113,85,85,120,
+99,84,93,18,43,54,92,99,82,219,50,45,40,45,45,42,54,253,150,171,1,13,2,174,
+136,84,254,148,124,111,114,222,152,177,246,51,236,254,223,64,26,60,64,98,
+120,127,109,117,139,73,70,10,59,61,50,57,53,50,73,5,207,254,93,251,37,0,5,
+0,74,255,234,7,174,7,200,0,107,0,117,0,129,0,137,0,138,0,0,1,16,2,35,34,38,
+39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,
+53,52,55,6,6,21,20,23,7,38,2,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,
+14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,39,6,7,39,54,55,
+38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,23,22,18,1,38,38,
+35,34,7,54,51,50,23,5,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,53,
+52,19,7,174,254,247,103,159,67,76,161,112,190,229,113,110,70,139,19,2,146,
+5,100,85,79,78,1,147,3,13,152,162,113,134,60,69,150,1,32,190,53,25,20,20,
+167,179,91,151,166,154,86,146,129,139,135,137,128,131,173,175,109,108,8,15,
+121,22,7,59,69,6,160,128,159,206,31,102,121,67,147,135,24,248,195,232,254,
+4,172,172,254,18,31,179,133,250,74,132,145,206,173,254,129,5,70,72,43,42,
+43,44,112,77,66,20,129,20,72,2,200,254,147,254,143,85,95,104,76,236,204,129,
+196,61,7,135,89,98,59,55,14,8,5,7,23,22,51,35,42,239,183,235,161,72,95,1,
+1,123,185,1,20,148,2,2,192,181,84,24,87,157,111,139,155,149,152,14,14,153,
+148,1,37,1,34,235,1,88,110,33,41,34,54,69,35,21,21,24,99,118,123,112,36,68,
+135,77,40,148,162,215,187,123,254,86,2,113,94,101,150,28,68,254,51,44,40,
+45,45,42,54,137,8,15,107,33,43,54,37,1,198,255,255,0,44,255,234,7,76,7,200,
+2,34,0,43,0,0,0,3,0,98,6,21,0,0,0,7,0,74,255,234,6,32,7,200,0,48,0,67,0,79,
+0,88,0,89,0,90,0,91,0,0,1,16,2,4,33,32,0,53,52,0,33,50,23,7,38,35,34,6,21,
+20,22,51,50,36,18,53,52,39,6,6,35,34,39,6,35,34,38,53,52,54,51,50,22,22,21,
+20,7,22,18,1,22,23,38,38,35,34,6,21,20,22,23,38,53,52,54,51,50,23,3,51,50,
+54,53,52,38,35,34,6,21,20,5,38,39,22,23,22,22,51,50,3,1,1,6,32,198,254,137,
+254,251,254,192,254,172,1,72,1,27,126,100,12,98,116,220,241,255,247,221,1,
+53,158,86,44,122,69,216,24,64,105,187,215,251,220,155,223,120,3,157,163,253,
+39,142,127,19,187,152,160,176,81,73,20,114,95,36,32,126,5,70,72,43,42,43,
+44,2,65,106,179,21,5,4,52,55,94,198,1,129,252,51,3,71,254,250,254,118,205,
+1,11,242,246,1,6,14,141,14,188,179,178,185,175,1,75,208,200,154,59,62,232,
+34,181,145,158,192,94,182,116,26,26,127,254,173,2,166,45,72,105,113,120,99,
+84,93,18,43,54,92,99,8,254,219,50,45,40,45,45,42,54,124,124,89,52,108,87,
+62,3,18,254,93,254,193,255,255,0,74,253,213,4,189,7,200,2,34,0,45,0,0,0,3,
+0,98,4,157,0,0,0,6,0,74,255,234,6,125,7,200,0,70,0,79,0,91,0,99,0,100,0,101,
+0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,
+20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,39,6,7,39,54,55,38,39,22,
+21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,23,22,18,1,38,38,35,34,7,
+54,51,50,3,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,53,52,1,1,6,125,
+252,248,103,161,68,75,157,114,188,221,143,1,14,183,111,115,14,87,117,217,
+237,141,132,132,133,138,128,131,173,174,108,108,5,17,121,21,8,55,73,6,160,
+128,157,207,32,90,120,67,121,148,22,247,198,232,254,4,171,171,254,20,32,180,
+131,250,74,125,163,211,226,5,73,69,43,42,44,43,112,90,53,20,129,20,1,119,
+254,22,2,200,254,147,254,143,86,94,105,75,255,230,153,245,134,14,139,13,213,
+192,157,169,147,154,14,14,152,149,1,35,1,36,234,1,88,109,27,45,34,53,71,32,
+23,21,24,99,118,121,112,31,70,134,67,48,146,166,214,187,123,254,86,2,114,
+93,100,150,28,254,190,53,42,40,45,46,41,54,136,9,14,106,33,43,54,36,1,199,
+253,30,255,255,0,58,255,234,7,107,7,200,2,34,0,47,0,0,0,3,0,98,6,36,0,0,255,
+255,0,74,253,213,5,151,7,200,2,34,0,48,0,0,0,3,0,98,5,120,0,0,255,255,0,74,
+255,234,6,8,7,200,2,34,0,49,0,0,0,3,0,98,5,35,0,0,0,6,0,74,255,234,6,54,7,
+200,0,63,0,83,0,95,0,105,0,106,0,107,0,0,1,20,2,4,33,32,0,53,52,36,33,51,
+38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,
+36,18,53,52,39,6,6,35,34,39,6,35,34,38,53,52,54,51,50,22,22,21,20,7,22,18,
+1,22,23,38,38,35,34,6,6,21,20,22,23,38,53,52,54,51,50,23,3,51,50,54,53,52,
+38,35,34,6,21,20,5,38,39,22,23,22,22,51,50,54,1,1,6,54,200,254,127,254,243,
+254,203,254,159,1,39,1,7,123,5,99,85,157,5,145,9,155,139,168,179,225,171,
+187,94,1,16,240,222,1,57,165,87,43,120,71,216,24,64,105,187,215,251,220,155,
+223,120,3,158,162,253,39,142,127,19,187,152,115,152,69,81,73,20,114,95,36,
+32,126,5,70,72,43,42,44,43,2,65,109,176,21,5,4,52,55,47,71,254,158,1,219,
+3,50,253,254,128,203,1,31,248,191,228,90,97,121,19,24,24,50,35,114,124,192,
+182,83,64,125,97,180,207,166,1,67,214,207,157,57,63,232,34,181,145,158,192,
+94,182,116,26,27,129,254,166,2,176,45,72,105,113,61,98,60,84,93,18,43,54,
+92,99,8,254,219,51,44,40,45,46,41,54,125,127,87,52,108,87,62,44,2,230,254,
+93,0,7,0,74,255,234,6,161,7,200,0,87,0,96,0,108,0,116,0,126,0,127,0,128,0,
+0,1,20,2,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,6,21,20,23,54,51,
+50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,21,20,6,6,7,6,6,21,20,22,51,
+50,54,18,53,52,2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,
+54,54,51,50,22,23,22,18,1,54,51,50,23,38,38,35,34,19,51,50,54,53,52,38,35,
+34,6,21,20,39,6,7,22,23,38,53,52,1,22,51,50,54,53,52,38,35,34,1,1,6,161,132,
+245,160,97,127,54,27,38,34,24,172,154,136,206,113,21,136,165,120,143,154,
+143,129,201,108,148,1,25,185,219,250,17,26,32,31,22,71,65,101,172,104,116,
+112,7,18,121,23,7,56,74,7,160,128,157,207,32,114,112,68,134,151,22,247,199,
+229,255,6,175,182,251,105,135,159,206,167,31,178,133,254,203,5,73,69,43,42,
+43,44,112,80,63,22,127,20,254,172,73,131,80,72,68,58,123,2,75,254,22,3,13,
+241,254,145,195,77,117,67,53,98,90,80,102,52,134,148,119,223,148,109,71,153,
+137,105,124,135,136,243,146,186,1,33,159,222,180,52,95,76,76,74,76,37,64,
+66,152,1,45,205,201,1,65,106,34,49,34,61,67,31,24,28,21,99,118,121,112,38,
+64,135,69,45,146,167,210,185,119,254,108,2,122,31,69,91,100,254,68,53,42,
+40,45,45,42,54,137,10,15,105,33,43,54,35,250,208,92,59,57,49,61,6,114,253,
+30,255,255,0,62,255,234,7,108,7,200,2,34,0,52,0,0,0,3,0,98,5,249,0,0,0,7,
+0,79,255,234,6,132,7,200,0,91,0,100,0,112,0,120,0,131,0,132,0,133,0,0,1,16,
+2,4,33,34,36,2,53,52,18,51,50,22,22,21,20,7,6,21,20,51,50,55,6,35,34,38,53,
+52,54,51,50,30,2,21,20,6,35,34,38,53,52,55,54,53,52,35,34,6,6,21,16,0,33,
+32,0,17,52,2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,
+54,51,50,22,22,21,21,22,18,1,38,38,35,34,7,54,51,50,3,51,50,54,53,52,38,35,
+34,6,21,20,39,6,7,22,23,38,53,52,1,38,38,35,34,6,21,20,22,51,50,3,1,6,132,
+196,254,131,254,240,227,254,179,180,204,164,65,81,29,10,11,231,218,41,77,
+103,110,126,142,127,57,103,86,49,219,187,183,193,10,9,59,54,86,50,1,55,1,
+30,1,82,1,96,98,97,11,11,121,20,9,62,65,5,160,128,160,206,31,97,130,65,146,
+139,25,247,195,156,220,114,155,165,254,44,31,183,131,253,72,148,133,218,225,
+5,73,69,43,42,43,44,113,73,69,22,127,20,1,186,11,81,62,62,60,61,53,92,66,
+254,62,3,66,254,244,254,124,200,163,1,61,215,235,1,15,53,72,35,37,70,71,52,
+186,170,47,121,104,100,128,36,80,130,87,172,205,166,147,43,64,63,21,71,85,
+163,109,254,242,254,219,1,114,1,88,181,1,21,96,41,29,34,52,67,36,21,20,22,
+99,118,121,111,33,73,135,78,42,148,164,99,188,117,3,111,254,149,2,39,97,102,
+152,30,254,190,53,42,40,45,45,42,54,135,8,15,105,33,43,54,33,253,129,74,79,
+51,46,47,52,4,116,253,30,0,7,0,83,255,234,6,191,7,200,0,120,0,129,0,141,0,
+149,0,160,0,161,0,162,0,0,1,20,2,4,35,34,39,39,54,53,52,38,35,34,6,21,20,
+23,7,6,35,34,0,17,52,18,54,51,50,22,21,20,7,6,21,20,51,50,55,6,35,34,38,53,
+52,54,51,50,22,21,20,6,35,34,38,38,53,52,55,54,53,52,35,34,6,6,21,20,18,51,
+51,22,51,50,55,38,53,52,54,51,51,50,22,21,20,7,51,50,18,17,52,2,39,6,7,39,
+54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,23,22,18,1,
+38,38,35,34,7,54,51,50,3,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,
+53,52,1,38,38,35,34,6,21,20,22,51,50,3,1,6,191,135,255,0,177,140,73,14,89,
+80,78,79,81,89,14,77,87,244,254,225,98,178,108,86,91,10,11,231,218,41,77,
+103,110,126,142,127,131,164,219,187,134,169,73,10,9,60,50,97,58,199,175,10,
+1,2,3,4,69,150,142,27,138,151,69,58,201,218,112,112,11,14,121,24,6,51,79,
+7,160,128,156,205,34,100,129,65,149,135,22,249,197,229,254,7,175,176,254,
+9,33,179,129,252,72,143,162,205,237,5,73,69,43,42,43,44,113,72,69,22,126,
+20,1,180,11,81,62,58,64,61,53,92,48,254,22,2,237,234,254,159,183,23,135,23,
+75,52,53,54,51,75,23,135,24,1,82,1,41,173,1,0,137,91,69,37,70,71,52,186,170,
+47,121,104,100,128,174,159,172,205,86,140,87,43,64,63,21,71,105,195,124,236,
+254,244,1,1,57,89,97,104,104,97,88,58,1,81,1,46,222,1,71,104,51,35,34,61,
+71,29,24,28,23,99,118,119,112,37,70,135,80,39,149,166,210,184,119,254,97,
+2,96,92,97,151,29,254,190,53,42,40,45,45,42,54,134,8,16,102,34,43,54,32,253,
+130,74,79,48,49,47,52,4,116,253,30,255,255,0,74,255,234,6,52,7,200,2,34,0,
+55,0,0,0,3,0,98,5,57,0,0,255,255,0,74,254,94,6,140,7,200,2,34,0,57,0,0,0,
+3,0,98,5,98,0,0,0,5,0,74,255,234,6,54,7,200,0,75,0,84,0,96,0,104,0,105,0,
+0,1,16,2,4,33,34,36,38,53,52,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,
+54,51,50,22,21,21,33,34,6,6,21,20,4,51,50,36,18,53,52,38,39,6,7,39,54,55,
+38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,22,21,21,22,18,1,
+54,51,50,23,38,38,35,34,19,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,
+53,52,1,6,54,199,254,126,254,241,205,254,213,156,132,250,214,127,5,100,85,
+157,6,145,9,155,139,166,180,254,246,175,185,92,1,15,239,221,1,57,168,82,82,
+7,8,121,18,9,44,79,3,160,128,157,206,32,80,120,67,131,126,22,249,197,156,
+220,114,142,140,251,180,134,137,228,175,27,185,137,253,202,5,73,69,43,42,
+43,44,111,76,68,20,129,20,1,60,3,88,254,247,254,110,211,131,241,163,125,190,
+104,89,98,121,19,24,24,50,35,114,124,191,183,83,65,125,96,181,206,171,1,80,
+225,163,255,93,25,20,34,44,59,31,33,15,18,99,118,121,111,31,70,135,72,40,
+149,166,99,188,117,24,114,254,166,2,93,30,89,102,109,254,68,53,42,40,45,45,
+42,54,138,7,17,107,33,43,54,39,1,196,255,255,0,78,255,234,7,8,7,200,2,34,
+0,59,0,0,0,3,0,98,5,185,0,0,255,255,0,74,255,234,6,8,7,200,2,34,0,60,0,0,
+0,3,0,98,5,35,0,0,255,255,0,62,255,234,6,77,7,200,2,34,0,61,0,0,0,3,0,98,
+5,72,0,0,255,255,0,74,255,234,7,83,7,200,2,34,0,62,0,0,0,3,0,98,5,184,0,0,
+255,255,0,68,254,79,5,253,7,200,2,34,0,63,0,0,0,3,0,98,5,111,0,0,255,255,
+0,78,255,234,6,114,7,200,2,34,0,64,0,0,0,3,0,98,5,90,0,0,0,7,0,44,255,234,
+10,218,7,200,0,94,0,103,0,115,0,123,0,149,0,175,0,176,0,0,1,16,2,4,33,34,
+36,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,6,21,20,22,23,7,38,
+53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,51,
+50,36,18,53,16,39,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,
+54,51,50,22,22,21,21,6,21,22,1,54,51,50,23,38,38,35,34,19,51,50,54,53,52,
+38,35,34,6,21,20,39,6,7,22,23,38,53,52,1,54,51,50,22,23,54,36,51,51,38,38,
+35,34,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,
+51,21,20,22,51,50,54,53,52,38,35,34,6,1,10,218,195,254,139,254,251,196,254,
+241,75,35,149,106,193,108,50,136,101,149,179,1,26,130,1,1,197,40,113,59,70,
+10,12,143,27,147,128,94,135,35,153,1,68,227,172,144,74,111,167,179,248,177,
+186,89,1,5,230,217,1,47,155,142,9,121,17,8,49,71,2,160,128,156,204,34,86,
+96,68,121,118,20,247,201,156,220,114,1,255,251,207,123,147,234,173,25,184,
+142,254,203,5,70,72,43,42,44,43,111,75,69,22,127,20,251,102,101,136,173,238,
+65,57,1,2,188,145,5,99,85,157,5,144,10,10,102,101,213,254,192,254,218,89,
+134,63,4,102,104,104,105,137,113,102,102,110,232,219,133,156,4,3,3,88,254,
+243,254,110,207,111,111,110,112,180,94,86,187,176,46,73,1,112,184,157,66,
+71,30,45,39,29,82,78,121,135,102,96,123,116,40,40,193,181,83,69,126,91,180,
+207,179,1,81,216,1,51,184,25,34,48,44,38,33,14,15,99,118,119,108,37,59,135,
+70,39,149,169,99,188,117,20,10,10,231,1,134,32,98,105,115,254,68,51,44,40,
+45,46,41,54,139,9,18,105,33,43,54,36,253,114,36,113,112,117,121,90,97,121,
+19,24,24,42,43,45,31,22,109,254,234,101,187,23,33,139,120,146,155,14,22,135,
+158,133,134,188,200,27,4,216,255,255,0,44,255,234,10,216,7,200,2,34,0,86,
+0,0,0,3,0,98,9,243,0,0,0,7,0,78,255,234,10,8,7,200,0,102,0,111,0,123,0,131,
+0,144,0,145,0,146,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,32,0,17,52,
+18,36,51,50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,
+50,22,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,
+2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,
+22,21,21,22,18,1,38,38,35,34,7,54,51,50,3,51,50,54,53,52,38,35,34,6,21,20,
+39,6,7,22,23,38,53,52,1,54,51,50,23,54,36,55,38,38,35,34,6,1,19,10,8,246,
+242,99,154,68,71,155,113,119,172,44,57,221,157,254,241,254,211,145,1,21,185,
+55,47,8,41,47,230,229,217,201,173,199,97,31,44,28,146,47,1,55,241,133,248,
+143,100,36,36,218,237,136,127,125,130,137,124,126,168,168,100,99,5,14,121,
+20,9,59,68,5,160,128,156,204,34,82,110,67,113,135,21,248,199,156,220,114,
+161,161,254,41,31,181,132,254,72,129,163,220,237,5,70,72,43,42,44,43,112,
+73,70,21,128,20,253,52,44,52,93,52,58,1,16,198,83,156,91,173,215,2,201,174,
+2,200,254,148,254,142,83,97,102,78,113,106,108,111,1,75,1,41,195,1,37,160,
+6,138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,66,1,70,113,139,150,
+3,213,192,157,169,145,156,14,14,152,149,1,35,1,36,229,1,81,108,18,41,34,51,
+66,37,23,20,23,99,118,118,111,31,66,134,66,44,149,168,99,188,117,5,124,254,
+89,2,117,94,102,154,32,254,190,51,44,40,45,46,41,54,136,8,17,104,33,43,54,
+36,252,199,20,57,154,159,2,66,58,203,4,57,251,146,0,5,0,74,255,234,7,68,7,
+200,0,98,0,107,0,119,0,127,0,128,0,0,1,16,2,4,33,34,36,38,53,52,54,55,6,35,
+35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,38,53,
+52,18,36,51,50,23,54,51,50,22,21,21,35,34,14,3,21,20,22,51,50,36,18,53,52,
+2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,
+22,21,21,22,18,1,38,38,35,34,7,54,51,50,3,51,50,54,53,52,38,35,34,6,21,20,
+39,6,7,22,23,38,53,52,1,7,68,199,254,126,254,241,209,254,222,141,96,98,72,
+110,29,2,208,5,100,85,81,76,1,147,3,18,175,190,113,134,63,66,151,1,33,188,
+33,44,46,40,166,181,177,131,156,111,77,46,255,235,221,1,57,168,82,82,7,8,
+121,18,9,63,61,4,160,128,157,206,32,80,120,67,124,133,22,249,197,156,220,
+114,141,141,254,86,27,185,137,253,72,134,137,228,225,5,70,72,43,42,44,43,
+111,76,68,20,129,20,2,54,3,88,254,247,254,110,211,127,219,140,112,175,54,
+8,135,89,98,61,53,13,7,7,7,23,22,56,43,32,248,197,234,161,73,104,245,127,
+186,1,20,146,7,7,190,184,83,16,48,72,106,79,166,186,171,1,80,225,161,1,0,
+94,25,20,34,45,59,42,22,22,12,99,118,121,111,31,70,135,70,42,149,166,99,188,
+117,23,115,254,170,2,30,102,109,152,30,254,190,51,44,40,45,46,41,54,138,7,
+17,107,33,43,54,39,1,196,0,7,0,78,255,234,7,192,7,200,0,73,0,93,0,105,0,115,
+0,116,0,117,0,118,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,38,35,34,
+0,21,20,23,7,38,53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,
+51,50,54,54,53,16,39,6,6,35,34,39,6,35,34,38,53,52,54,51,50,22,22,21,20,7,
+22,18,1,22,23,38,38,35,34,6,6,21,20,22,23,38,53,52,54,51,50,23,3,51,50,54,
+53,52,38,35,34,6,21,20,5,38,39,22,23,22,22,51,50,54,3,19,1,7,192,251,236,
+112,167,69,74,158,116,188,221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,
+168,144,41,187,211,141,132,134,132,137,136,137,116,149,73,168,41,135,79,216,
+24,64,105,187,215,251,220,155,223,120,2,211,211,252,197,153,110,22,186,149,
+115,152,69,81,73,20,114,95,39,33,130,5,70,72,43,42,44,43,2,75,116,180,22,
+5,4,52,55,51,75,63,235,251,247,2,128,254,184,254,178,83,97,103,77,255,230,
+182,244,44,3,254,253,232,186,155,49,191,207,1,26,1,67,64,138,4,218,184,156,
+170,149,152,14,14,157,144,115,229,175,1,99,226,72,81,232,34,181,145,158,192,
+94,182,116,18,20,150,254,74,3,18,51,59,103,108,61,98,60,84,93,18,43,54,92,
+99,9,254,220,51,44,40,45,46,41,54,105,112,84,49,113,87,62,53,2,221,254,93,
+254,193,0,8,0,44,255,234,10,65,7,200,0,73,0,92,0,104,0,114,0,124,0,141,0,
+142,0,143,0,0,1,16,2,4,33,34,36,39,6,6,35,34,36,53,53,7,39,0,55,38,35,34,
+6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,4,23,7,4,17,20,22,51,50,
+36,18,53,52,39,6,6,35,34,39,6,35,34,38,53,52,54,51,50,22,22,21,20,7,22,18,
+1,22,23,38,38,35,34,6,21,20,22,23,38,53,52,54,51,50,23,3,51,50,54,53,52,38,
+35,34,6,21,20,5,38,39,22,23,22,22,51,50,54,1,54,37,38,35,32,7,54,51,32,5,
+6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,1,19,10,65,188,254,149,254,255,
+213,254,230,70,58,247,189,240,254,242,74,130,1,5,190,39,111,59,70,10,12,143,
+27,147,128,184,77,149,1,36,156,168,1,50,111,56,254,109,246,237,211,1,40,154,
+86,42,122,71,216,24,64,105,187,215,251,220,155,223,120,3,157,163,253,39,152,
+118,19,187,153,160,176,81,73,20,114,95,36,32,126,5,70,72,43,42,43,44,2,66,
+109,178,22,5,4,52,55,48,71,251,238,88,1,13,178,225,254,223,255,88,109,1,26,
+253,126,88,71,70,12,194,186,208,206,191,178,90,150,6,175,235,3,71,254,250,
+254,119,206,121,122,122,121,215,203,25,126,73,1,121,184,148,66,71,30,45,39,
+29,82,78,121,135,187,119,109,135,125,143,33,254,181,177,186,172,1,75,211,
+201,154,57,65,232,34,181,145,158,192,94,182,116,26,26,127,254,173,2,166,49,
+68,105,113,120,99,84,93,18,43,54,92,99,8,254,219,51,44,40,45,45,42,54,123,
+126,87,49,112,87,62,45,253,241,201,46,143,223,28,200,102,98,5,44,56,143,147,
+177,164,154,160,27,4,216,254,93,0,7,0,44,255,234,10,87,7,200,0,91,0,100,0,
+112,0,120,0,145,0,162,0,163,0,0,1,16,2,4,33,34,36,39,6,6,35,34,36,53,53,7,
+39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,23,54,51,
+50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,2,39,6,7,39,54,55,38,39,22,
+21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,30,2,21,21,22,18,1,38,33,34,
+6,7,54,51,50,3,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,53,52,3,38,
+53,52,55,38,35,32,5,54,51,50,22,23,54,54,51,51,38,38,35,34,21,20,23,5,6,7,
+23,6,21,20,22,51,50,54,53,52,38,35,34,6,1,10,87,195,254,139,254,251,209,254,
+232,70,57,250,194,240,254,242,74,130,1,5,190,39,111,59,70,10,12,143,27,147,
+128,184,77,149,1,36,156,160,130,76,114,166,180,248,177,186,89,1,5,230,217,
+1,47,155,87,87,9,11,131,22,7,53,75,6,160,128,147,200,39,61,76,68,97,87,12,
+250,208,132,198,118,52,148,149,254,60,75,254,239,129,169,33,155,173,203,251,
+5,73,69,43,42,45,42,116,68,67,29,116,20,249,10,9,95,109,254,223,255,0,88,
+110,146,201,54,60,246,185,145,5,99,85,157,5,251,224,88,71,70,12,194,186,208,
+206,191,178,90,150,6,175,3,88,254,243,254,110,207,124,125,125,124,215,203,
+25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,135,187,119,109,43,43,
+191,183,83,69,126,91,180,207,179,1,81,216,169,1,8,96,38,27,36,54,69,33,26,
+22,26,99,118,107,99,28,47,135,56,33,157,181,70,120,141,73,5,113,254,156,2,
+45,190,85,81,44,254,190,53,42,40,45,46,41,54,128,12,20,93,29,43,54,28,253,
+170,42,43,40,33,25,223,28,99,98,105,105,90,97,121,19,24,236,102,98,5,44,56,
+143,147,177,164,154,160,27,4,216,0,6,0,78,255,234,7,187,7,200,0,80,0,89,0,
+101,0,109,0,110,0,111,0,0,1,16,2,35,34,38,39,6,6,35,34,38,53,52,54,55,38,
+35,34,0,21,20,23,7,38,53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,
+20,22,51,50,18,17,52,2,39,6,7,39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,
+54,55,54,54,51,50,22,23,22,18,1,38,38,35,34,7,54,51,50,3,51,50,54,53,52,38,
+35,34,6,21,20,39,6,7,22,23,38,53,52,3,1,7,187,252,248,103,161,68,75,157,114,
+188,221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,168,144,41,187,211,141,
+132,134,132,137,128,131,173,174,108,108,5,17,121,21,8,55,73,6,160,128,157,
+207,32,90,120,67,115,154,22,247,198,232,254,4,171,171,254,20,32,180,131,250,
+74,126,162,211,226,5,70,72,43,42,44,43,112,90,53,20,129,20,111,2,236,2,200,
+254,147,254,143,86,94,105,75,255,230,182,244,44,3,254,253,232,186,155,49,
+191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,14,14,152,149,1,35,1,36,
+234,1,88,109,27,45,34,53,71,32,23,21,24,99,118,121,112,31,70,134,66,49,146,
+166,214,187,123,254,86,2,114,93,100,150,28,254,190,50,45,40,45,46,41,54,136,
+9,14,106,33,43,54,36,254,229,2,226,0,5,0,74,255,234,7,68,7,200,0,90,0,99,
+0,111,0,119,0,120,0,0,1,16,2,4,33,32,0,53,52,54,54,51,51,38,38,35,34,21,20,
+23,7,38,53,52,55,6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,
+21,33,34,6,6,21,20,4,51,50,36,18,53,52,38,39,6,7,39,54,55,38,39,22,21,20,
+6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,22,21,21,22,18,1,54,51,50,23,38,
+38,35,34,19,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,53,52,1,7,68,
+198,254,126,254,239,254,204,254,160,132,250,214,127,5,100,85,157,6,145,9,
+20,177,190,113,134,63,66,151,1,33,188,46,37,44,36,166,181,254,245,175,185,
+92,1,15,239,225,1,58,164,82,82,7,8,121,18,9,44,79,3,160,128,157,206,32,80,
+120,67,130,127,22,249,197,156,220,114,142,140,251,180,134,137,228,175,27,
+185,137,253,202,5,70,72,43,42,44,43,111,76,68,20,129,20,2,184,3,88,254,247,
+254,111,212,1,30,249,125,190,104,89,98,121,22,21,24,50,35,55,44,32,250,195,
+234,161,73,104,245,127,186,1,20,146,7,7,191,183,83,65,125,96,181,206,176,
+1,81,219,163,255,93,25,20,34,44,59,31,33,15,18,99,118,121,111,31,70,135,72,
+40,149,166,99,188,117,24,114,254,166,2,93,30,89,102,109,254,68,51,44,40,45,
+46,41,54,138,7,17,107,33,43,54,39,1,196,0,8,0,58,255,234,10,96,7,200,0,77,
+0,96,0,108,0,118,0,130,0,144,0,145,0,146,0,0,1,16,2,4,33,34,36,39,6,4,35,
+32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,
+50,23,54,36,51,32,1,7,4,17,20,22,51,50,36,18,53,52,39,6,6,35,34,39,6,35,34,
+38,53,52,54,51,50,22,22,21,20,7,22,18,1,22,23,38,38,35,34,6,21,20,22,23,38,
+53,52,54,51,50,23,3,51,50,54,53,52,38,35,34,6,21,20,5,38,39,22,23,22,22,51,
+50,54,1,54,51,32,23,54,54,55,38,38,35,32,3,6,6,7,22,22,51,50,54,53,52,38,
+35,34,1,1,10,96,188,254,149,254,255,214,254,228,69,59,255,0,196,254,211,254,
+149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,192,
+69,99,1,11,156,1,81,1,10,56,254,109,246,237,211,1,40,154,86,42,122,71,216,
+24,64,105,187,215,251,220,155,223,120,3,157,163,253,39,152,118,19,187,153,
+160,176,81,73,20,114,95,36,32,126,5,73,69,43,42,43,44,2,66,109,178,22,5,4,
+52,55,48,71,250,7,49,46,1,28,111,44,178,133,89,205,116,254,246,216,55,223,
+193,65,247,200,208,225,194,175,67,3,39,3,187,3,71,254,250,254,119,206,123,
+123,123,123,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,
+78,121,135,200,118,123,254,252,143,33,254,181,177,186,172,1,75,211,201,154,
+57,65,232,34,181,145,158,192,94,182,116,26,26,127,254,173,2,166,49,68,105,
+113,120,99,84,93,18,43,54,92,99,8,254,219,53,42,40,45,45,42,54,123,126,87,
+49,112,87,62,45,254,173,7,189,97,120,24,71,72,254,173,171,169,5,156,150,184,
+166,149,156,4,189,254,93,255,255,0,58,253,213,8,247,7,200,2,34,0,95,0,0,0,
+3,0,98,8,216,0,0,0,7,0,58,255,234,10,194,7,200,0,102,0,111,0,123,0,131,0,
+143,0,157,0,158,0,0,1,16,2,35,34,38,39,6,6,35,34,38,39,6,6,35,32,0,3,55,22,
+23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,
+50,4,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,52,2,39,6,7,
+39,54,55,38,39,22,21,20,6,35,34,38,39,6,7,39,54,55,54,54,51,50,22,22,21,21,
+22,18,1,54,51,50,23,38,38,35,34,19,51,50,54,53,52,38,35,34,6,21,20,39,6,7,
+22,23,38,53,52,1,54,51,50,22,23,54,54,55,38,35,32,3,6,6,7,22,22,51,50,54,
+53,52,38,35,34,1,10,194,246,242,99,156,67,72,154,112,121,171,44,63,250,187,
+254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,
+147,128,192,69,99,1,11,156,168,1,46,133,61,189,209,136,127,124,131,137,124,
+126,168,168,100,99,5,14,121,20,9,59,68,5,160,128,156,204,34,82,110,67,113,
+135,21,248,199,156,220,114,161,161,251,139,129,163,220,158,31,181,132,254,
+203,5,70,72,43,42,45,42,112,73,70,21,128,20,252,68,49,46,146,201,55,48,174,
+126,177,233,254,246,216,55,223,193,65,247,200,208,225,194,175,67,3,39,2,200,
+254,148,254,142,84,96,104,76,116,108,112,112,1,66,1,59,24,32,36,1,17,55,105,
+77,133,120,70,67,30,45,39,29,82,78,121,135,200,118,123,130,130,140,11,218,
+175,157,169,143,158,14,14,152,149,1,35,1,36,229,1,81,108,18,41,34,51,66,37,
+23,20,23,99,118,118,111,31,66,134,66,44,149,168,99,188,117,5,124,254,89,2,
+159,32,74,94,102,254,68,51,44,40,45,46,41,54,136,8,17,104,33,43,54,36,253,
+143,7,101,101,104,127,23,143,254,173,171,169,5,156,150,184,166,149,156,4,
+189,0,7,0,58,255,234,10,118,7,200,0,97,0,106,0,118,0,126,0,151,0,165,0,166,
+0,0,1,16,2,4,33,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,
+6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,21,21,
+35,34,6,6,21,20,4,51,50,36,18,53,52,38,39,7,39,54,55,38,39,22,21,20,6,35,
+34,38,39,6,7,39,54,55,54,54,51,50,22,22,21,21,6,21,22,18,1,54,51,50,23,38,
+38,35,34,19,51,50,54,53,52,38,35,34,6,21,20,39,6,7,22,23,38,53,52,1,54,51,
+50,22,23,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,3,6,6,7,
+22,22,51,50,54,53,52,38,35,34,1,10,118,195,254,139,254,251,213,254,231,69,
+58,254,254,200,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,
+10,12,143,27,147,128,96,130,35,99,1,11,156,158,138,75,127,166,180,247,176,
+185,92,1,5,230,217,1,47,155,71,71,9,121,17,8,49,71,2,160,128,156,204,34,86,
+96,68,121,118,20,247,201,157,220,113,1,127,128,251,207,123,147,234,173,25,
+184,142,254,203,5,70,72,43,42,43,44,111,75,69,22,127,20,252,76,49,46,145,
+200,55,63,245,183,146,5,100,85,157,5,144,10,8,97,124,253,217,55,223,193,65,
+247,200,208,225,194,175,67,3,39,3,88,254,243,254,110,207,128,129,129,128,
+1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,
+100,100,118,123,51,51,191,183,83,66,124,96,180,207,179,1,81,216,153,246,92,
+25,34,48,44,38,33,14,15,99,118,119,108,37,59,135,70,39,149,169,100,187,117,
+20,10,10,116,254,179,2,96,32,98,105,115,254,68,50,45,40,45,45,42,54,139,9,
+18,105,33,43,54,36,253,143,7,100,99,106,106,89,98,121,19,24,24,42,43,41,26,
+31,254,173,171,169,5,156,150,184,166,149,156,4,189,255,255,0,15,255,234,4,
+183,7,200,2,34,0,99,0,0,0,3,0,98,4,120,0,0,0,2,0,44,254,51,7,238,4,230,0,
+81,0,107,0,0,1,16,0,35,34,4,7,54,51,32,0,21,20,6,35,34,39,6,6,35,34,38,39,
+7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,32,0,
+17,20,2,6,35,35,34,39,6,21,20,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,
+52,54,55,22,51,50,54,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,
+54,53,52,38,35,34,6,7,43,254,228,254,194,254,196,136,101,136,1,14,1,46,189,
+160,196,99,50,136,101,149,179,1,26,130,1,12,186,40,113,59,70,10,12,143,27,
+147,128,94,136,35,156,1,66,224,1,66,1,100,117,216,138,16,7,9,80,219,133,125,
+4,144,8,204,200,182,187,85,93,29,36,160,175,250,198,89,134,63,4,102,104,104,
+105,137,113,102,102,110,232,219,133,156,2,59,1,1,1,25,110,116,36,254,237,
+251,186,229,180,94,86,187,176,46,73,1,127,169,157,66,71,30,45,39,29,82,78,
+121,135,101,97,125,114,254,149,254,194,174,254,251,143,1,64,91,161,107,127,
+41,34,12,37,55,181,189,155,131,94,149,71,3,232,1,103,101,187,23,33,139,120,
+146,155,14,22,135,158,133,134,188,200,27,0,3,0,74,253,233,6,180,6,177,0,81,
+0,91,0,92,0,0,5,34,39,6,7,39,54,18,53,52,38,35,34,6,6,21,20,23,54,51,50,22,
+21,20,6,35,34,38,38,53,52,18,36,51,50,0,21,20,7,51,22,22,51,50,18,17,16,0,
+33,34,4,7,39,54,36,51,32,0,17,16,7,17,33,34,38,53,52,54,55,23,6,21,20,22,
+22,51,33,17,52,55,6,6,37,22,51,50,54,53,52,38,35,34,1,5,4,197,51,58,70,109,
+135,118,194,179,136,206,113,21,136,165,120,143,154,143,129,201,108,151,1,
+20,181,250,1,13,87,40,5,60,71,124,147,254,132,254,138,183,254,199,146,68,
+198,1,69,192,1,186,1,206,70,251,159,219,181,57,69,102,79,59,117,135,3,145,
+6,49,104,251,234,73,131,77,75,67,59,121,1,28,22,170,85,85,96,147,1,7,146,
+168,198,119,223,148,109,71,153,137,105,124,135,136,243,146,189,1,32,157,254,
+243,226,185,175,79,80,1,37,1,35,1,173,1,177,81,84,135,98,76,254,0,254,23,
+254,234,183,252,238,131,117,62,109,61,104,57,65,42,55,17,1,5,125,66,42,37,
+230,92,57,60,48,61,3,144,0,1,0,78,254,51,6,244,4,230,0,80,0,0,1,52,2,35,34,
+6,7,54,51,50,22,21,20,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,2,17,20,
+22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,22,18,21,16,0,33,35,34,39,6,21,
+20,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,55,22,51,50,54,6,91,
+202,174,158,203,53,40,54,112,129,123,238,161,254,241,254,211,145,1,21,185,
+55,47,8,41,47,230,229,217,201,173,199,97,31,44,28,146,49,1,52,225,162,235,
+125,254,201,254,246,27,13,12,81,219,133,125,4,144,8,204,200,182,187,85,93,
+44,41,216,226,2,121,215,1,5,203,193,19,145,131,136,218,124,1,75,1,41,195,
+1,37,160,6,138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,65,1,71,148,
+254,228,189,254,212,254,174,1,63,92,161,107,127,41,34,12,37,55,181,189,155,
+131,94,149,71,3,255,0,1,0,62,253,233,6,77,4,230,0,119,0,0,5,34,39,39,54,53,
+52,38,35,34,6,21,20,23,7,6,35,34,38,53,16,55,6,35,35,53,33,38,38,35,34,6,
+21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,3,21,20,22,51,50,55,38,
+53,52,54,51,51,50,22,21,20,7,22,51,50,54,53,52,38,38,35,35,53,52,54,51,50,
+22,21,20,7,39,54,53,52,35,34,6,7,51,32,0,21,20,7,17,33,34,38,53,52,54,55,
+23,6,21,20,22,22,51,33,17,6,4,171,148,112,15,90,80,78,84,77,90,15,112,143,
+193,230,229,71,144,40,2,104,5,100,85,81,76,1,147,3,155,139,167,179,55,120,
+140,130,89,50,146,140,70,33,80,157,139,15,139,157,82,35,71,142,143,112,229,
+185,48,179,167,136,159,14,144,9,157,86,99,4,17,1,16,1,33,79,252,20,219,181,
+57,69,102,79,59,117,135,3,28,88,22,39,135,23,75,51,54,57,48,75,23,135,39,
+233,205,1,11,121,7,135,89,98,61,53,14,8,5,7,12,33,114,124,191,183,83,18,58,
+86,134,84,147,155,6,59,96,101,118,119,104,91,59,7,155,156,141,158,72,83,181,
+193,121,118,44,57,23,38,23,121,99,88,254,255,250,180,112,253,100,131,117,
+62,109,61,104,57,65,42,55,17,1,159,42,0,3,0,52,253,233,6,205,6,177,0,93,0,
+104,0,105,0,0,5,34,38,39,6,6,35,34,38,53,52,54,55,55,62,2,53,52,38,35,35,
+22,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,
+53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,0,17,16,7,17,
+33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,1,6,6,21,20,22,51,
+50,54,53,52,1,4,217,103,161,68,67,166,113,189,221,203,238,71,82,75,38,174,
+177,6,21,22,143,108,114,129,242,230,242,243,79,155,122,189,161,136,129,139,
+135,138,128,131,173,174,254,146,254,153,172,254,209,146,67,160,1,85,196,1,
+168,1,191,70,251,194,219,181,57,69,102,79,59,117,135,3,110,5,109,251,228,
+88,82,53,51,54,52,1,31,22,86,94,99,81,211,185,166,203,70,21,24,31,49,42,72,
+67,33,80,35,111,118,122,101,135,154,139,137,83,98,72,31,48,151,121,122,128,
+141,160,14,14,152,149,1,35,1,36,1,172,1,178,78,86,134,90,84,254,2,254,21,
+254,242,174,252,221,131,117,62,109,61,104,57,65,42,55,17,1,69,88,59,99,4,
+107,13,72,48,48,54,55,49,79,254,133,0,1,0,77,254,51,8,56,4,230,0,93,0,0,1,
+52,2,35,34,6,7,54,51,50,22,21,20,0,35,34,38,2,53,52,0,55,38,35,34,6,6,21,
+20,22,23,7,38,53,16,0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,34,6,
+7,39,18,0,51,50,0,17,16,0,33,35,34,39,6,21,20,51,50,54,53,52,39,55,22,21,
+20,6,35,34,38,53,52,54,55,22,51,50,54,7,158,201,174,158,203,54,45,49,113,
+129,254,224,244,182,254,127,1,2,230,62,108,147,223,122,55,51,135,121,1,93,
+1,37,91,183,79,54,140,208,115,214,204,178,195,98,31,44,28,146,51,1,52,224,
+246,1,20,254,201,254,246,27,13,12,81,219,133,125,4,144,8,204,200,182,187,
+85,93,27,57,217,225,2,121,215,1,5,203,193,19,145,131,214,254,248,145,1,5,
+176,225,1,39,30,13,125,224,152,107,201,76,68,219,241,1,35,1,77,48,46,143,
+5,112,208,144,206,218,179,154,140,14,22,45,1,68,1,68,254,178,254,225,254,
+212,254,174,1,63,92,161,107,127,41,34,12,37,55,181,189,155,131,94,149,71,
+3,255,0,1,0,62,253,233,6,59,6,177,0,81,0,0,5,34,36,38,53,52,54,55,6,35,35,
+53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,
+20,22,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,18,17,20,7,17,33,34,
+38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,2,227,207,254,222,142,
+99,94,70,111,50,2,229,6,100,85,79,78,1,146,3,155,139,167,179,177,172,160,
+129,60,255,235,221,1,57,168,169,254,199,194,168,254,228,148,67,1,51,1,105,
+247,1,124,202,80,252,39,219,181,57,69,102,79,59,117,135,3,9,5,108,254,196,
+22,127,219,140,116,173,51,7,135,89,98,59,55,13,7,7,7,23,22,114,124,193,181,
+83,26,84,126,85,166,186,171,1,80,225,230,1,63,164,77,88,135,174,204,254,126,
+254,245,237,188,252,58,131,117,62,109,61,104,57,65,42,55,17,1,165,116,80,
+122,122,0,5,0,74,253,233,6,69,6,177,0,83,0,96,0,105,0,106,0,107,0,0,5,34,
+36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,
+34,6,21,20,4,33,32,36,53,52,39,6,6,35,34,38,38,53,52,0,37,23,4,7,54,51,50,
+22,22,21,20,7,22,22,21,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,
+17,52,55,6,3,50,22,23,52,55,53,52,38,35,34,6,7,21,22,22,51,50,55,38,38,35,
+3,5,3,39,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,
+176,199,177,1,48,1,24,1,38,1,57,13,45,137,91,78,128,83,1,110,1,63,60,254,
+194,170,53,57,88,123,62,11,48,48,79,252,63,219,181,57,69,102,79,59,117,135,
+2,241,5,192,114,89,150,61,1,85,82,79,101,12,4,69,92,125,44,46,147,101,253,
+3,71,22,129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,142,
+149,178,204,206,187,65,42,71,70,68,171,138,254,1,168,121,129,115,191,30,81,
+150,103,74,57,52,137,86,166,117,253,2,131,117,62,109,61,104,57,65,42,55,17,
+1,85,90,60,118,3,186,26,26,9,8,18,107,107,105,92,135,75,104,118,30,31,3,148,
+198,0,5,0,74,253,233,6,18,6,177,0,84,0,97,0,102,0,103,0,104,0,0,5,34,36,38,
+53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,
+21,20,4,33,50,36,54,53,52,38,35,35,53,52,54,55,54,54,55,23,6,6,7,54,51,50,
+22,21,20,6,7,22,22,21,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,
+17,52,55,6,19,7,20,30,2,51,50,53,52,38,35,34,7,38,39,6,7,3,5,3,39,245,254,
+184,160,1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,199,177,1,48,
+1,24,194,1,8,129,178,198,177,90,90,35,246,190,61,148,190,42,26,18,119,146,
+56,55,86,86,79,252,84,219,181,57,69,102,79,59,117,135,2,220,4,186,11,1,8,
+23,45,32,81,71,65,34,115,26,10,28,3,216,3,11,22,129,239,168,208,210,90,97,
+121,23,38,23,48,54,114,124,193,181,83,142,149,178,204,96,172,113,151,141,
+83,124,169,45,136,234,71,129,51,140,89,4,119,101,69,90,20,52,171,118,169,
+117,253,5,131,117,62,109,61,104,57,65,42,55,17,1,85,90,56,114,4,117,26,52,
+48,40,23,89,46,58,191,39,66,46,59,3,13,198,0,4,0,44,253,233,11,38,6,177,0,
+100,0,114,0,140,0,141,0,0,5,34,38,39,6,6,35,34,38,39,6,6,35,34,39,6,6,35,
+34,38,39,7,39,0,55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,36,51,
+32,5,7,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,
+7,39,54,36,51,32,0,17,16,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,
+17,52,55,6,1,54,51,50,22,23,54,54,55,38,38,35,34,4,1,6,7,51,6,21,20,22,51,
+50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,37,9,62,99,156,67,71,153,
+114,108,162,46,40,139,94,193,108,50,136,101,149,179,1,26,130,1,12,186,40,
+113,59,70,22,143,27,147,128,95,134,35,146,1,53,220,1,92,1,21,53,123,180,93,
+136,127,125,130,137,124,126,168,168,254,157,254,164,174,254,228,145,67,158,
+1,76,189,1,156,1,181,70,251,214,219,181,57,69,102,79,59,117,135,3,90,4,105,
+248,164,99,138,170,245,64,46,181,135,116,210,129,186,254,211,254,222,89,134,
+63,4,102,104,104,105,137,113,102,102,110,232,219,133,156,5,49,22,84,96,102,
+78,98,93,94,97,180,94,86,187,176,46,73,1,127,169,157,66,71,45,69,29,82,78,
+121,135,102,95,119,119,249,151,6,104,178,116,157,169,145,156,14,14,152,149,
+1,35,1,36,1,172,1,178,75,89,134,91,83,254,4,254,19,254,239,175,252,225,131,
+117,62,109,61,104,57,65,42,55,17,1,101,64,44,92,3,137,36,122,119,122,146,
+25,76,67,112,254,237,101,187,23,33,139,120,146,155,14,22,135,158,133,134,
+188,200,27,109,0,3,0,74,253,233,10,40,4,230,0,93,0,120,0,146,0,0,5,34,38,
+39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,38,35,34,6,21,20,23,7,38,38,
+53,53,52,55,6,21,20,22,23,7,38,38,53,52,0,55,54,51,50,22,23,54,36,51,50,22,
+23,54,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,33,34,38,53,52,
+54,55,23,6,21,20,22,22,51,33,17,6,1,54,36,33,51,38,38,35,34,6,21,20,23,7,
+38,53,52,55,38,35,34,4,7,54,51,50,22,5,6,7,51,6,21,20,22,51,50,54,53,53,51,
+21,20,22,51,50,54,53,52,38,35,34,6,8,154,182,252,70,37,146,104,193,107,52,
+135,100,150,179,1,26,130,1,1,197,20,76,56,59,70,21,143,9,15,1,142,69,83,132,
+88,82,1,15,233,15,26,105,142,36,154,1,69,225,124,192,95,40,108,79,171,182,
+254,197,178,176,122,54,240,226,165,154,63,253,117,219,181,57,69,102,79,59,
+117,135,1,187,111,253,89,53,1,17,1,33,174,5,102,89,83,80,3,147,4,2,157,171,
+212,254,192,140,101,135,175,240,252,218,100,122,62,4,102,104,104,105,137,
+114,102,102,110,232,220,133,156,22,106,106,105,107,180,95,85,187,176,46,73,
+1,112,184,78,79,66,71,46,68,29,26,104,41,9,5,5,122,245,118,199,117,78,130,
+252,138,240,1,68,17,4,99,98,124,114,35,37,38,34,193,181,83,34,85,126,84,159,
+185,60,47,253,96,131,117,62,109,61,104,57,65,42,55,17,1,147,30,2,196,114,
+132,88,99,63,49,18,12,18,29,21,33,12,60,109,122,36,117,75,113,175,23,33,137,
+122,146,155,14,22,135,158,133,134,187,201,27,0,2,0,77,253,233,9,34,4,230,
+0,89,0,115,0,0,5,34,36,39,6,6,35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,
+23,7,38,53,16,0,33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,
+0,33,50,23,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,33,34,38,
+53,52,54,55,23,6,21,20,22,22,51,33,17,6,1,62,2,51,51,38,38,35,34,6,21,20,
+23,7,38,53,52,55,35,34,4,7,54,51,50,7,149,190,254,247,66,60,232,164,182,254,
+127,1,2,230,62,108,147,223,122,55,51,135,121,1,93,1,37,91,183,79,54,140,208,
+115,214,204,178,195,98,31,44,28,146,49,1,103,1,21,97,85,50,67,171,182,254,
+197,177,177,122,54,240,226,164,154,63,253,117,219,181,57,69,102,79,59,117,
+135,1,187,111,253,86,33,150,232,204,174,5,102,89,83,80,3,147,4,24,17,198,
+254,239,59,44,50,85,22,121,118,119,120,145,1,5,176,225,1,39,30,13,125,224,
+152,107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,206,218,179,154,
+140,14,22,45,1,64,1,72,12,12,193,181,83,34,84,127,84,159,185,60,47,253,96,
+131,117,62,109,61,104,57,65,42,55,17,1,147,30,2,187,79,116,60,88,99,63,49,
+18,12,18,29,21,73,40,208,200,18,0,5,0,74,253,233,7,36,6,177,0,95,0,108,0,
+113,0,114,0,115,0,0,5,32,0,17,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,
+55,6,17,20,23,7,38,38,53,52,18,36,51,51,50,22,22,21,21,35,34,6,21,20,4,33,
+32,36,53,52,38,35,35,53,52,54,55,54,54,55,23,6,6,7,54,51,50,22,21,20,6,7,
+22,22,21,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,19,
+7,20,30,2,51,50,53,52,38,35,34,7,38,39,6,7,3,5,4,58,254,152,254,138,1,9,1,
+5,31,5,99,85,158,10,145,10,5,194,113,134,63,66,148,1,22,179,25,112,152,82,
+175,199,178,1,48,1,25,1,26,1,48,178,197,177,89,90,36,247,189,60,147,190,43,
+26,18,120,146,56,55,86,86,79,252,84,219,181,57,69,102,79,59,117,135,2,220,
+4,186,11,1,7,24,45,32,81,72,64,34,116,27,8,29,3,190,2,237,22,1,20,1,4,207,
+211,90,97,121,22,39,23,38,62,30,18,123,254,211,234,161,73,104,245,127,187,
+1,19,146,85,164,125,83,141,150,178,204,202,179,151,141,83,124,168,45,138,
+234,70,129,51,140,89,4,119,101,69,90,20,52,171,118,169,117,253,5,131,117,
+62,109,61,104,57,65,42,55,17,1,85,90,56,114,4,117,26,52,48,40,23,89,45,59,
+191,46,58,44,60,3,13,198,0,2,0,74,253,233,6,13,6,177,0,58,0,59,0,0,5,34,36,
+38,53,52,0,33,50,23,7,38,35,34,6,21,20,22,51,50,36,18,53,52,2,36,35,32,5,
+39,36,33,50,4,18,17,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,
+52,55,6,4,1,2,207,214,254,222,141,1,60,1,16,121,97,13,92,111,210,230,250,
+244,216,1,49,156,162,254,209,188,254,203,254,239,67,1,59,1,87,235,1,110,197,
+81,252,81,219,181,57,69,102,79,59,117,135,2,223,4,103,254,209,254,103,22,
+127,228,154,247,1,5,14,141,14,188,179,176,187,178,1,82,216,228,1,63,166,165,
+135,174,204,254,128,254,243,244,188,252,65,131,117,62,109,61,104,57,65,42,
+55,17,1,188,106,55,116,116,4,252,0,4,0,74,253,233,6,130,6,177,0,75,0,85,0,
+86,0,87,0,0,5,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,
+20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,16,39,6,6,35,34,38,53,52,
+38,39,39,55,4,0,17,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,
+52,55,6,3,38,39,22,23,22,22,51,50,54,1,17,4,155,112,167,69,74,158,116,188,
+221,143,1,14,183,111,115,14,87,117,217,237,141,132,132,133,138,136,137,116,
+149,73,168,41,135,79,119,123,18,37,5,53,1,164,1,151,75,251,214,219,181,57,
+69,102,79,59,117,135,3,90,4,105,86,116,180,22,5,4,52,55,51,75,254,52,22,83,
+97,103,77,255,230,153,245,134,14,139,13,213,192,157,169,147,154,14,14,157,
+144,115,229,175,1,99,226,72,81,144,144,113,90,23,2,126,138,253,230,254,115,
+251,159,253,3,131,117,62,109,61,104,57,65,42,55,17,1,101,59,39,82,5,63,112,
+84,49,113,87,62,53,1,58,254,193,0,1,0,62,253,233,6,150,6,177,0,91,0,0,5,34,
+38,39,6,6,35,34,38,53,16,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,
+53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,
+50,18,17,16,0,33,34,4,7,39,36,33,32,4,18,17,16,7,17,33,34,38,53,52,54,55,
+23,6,21,20,22,22,51,33,17,52,55,6,4,161,103,159,67,76,161,112,190,229,229,
+71,144,40,2,136,5,100,85,79,78,1,147,3,155,140,165,181,55,157,166,153,86,
+146,129,136,138,137,128,131,173,175,254,144,254,145,168,254,217,163,67,1,
+61,1,126,1,32,1,139,201,70,251,194,219,181,57,69,102,79,59,117,135,3,110,
+5,108,22,85,95,104,76,236,204,1,9,121,7,135,89,98,59,55,14,8,5,7,23,22,114,
+124,190,183,84,25,86,157,111,139,155,146,155,14,14,153,148,1,37,1,34,1,175,
+1,175,74,91,135,174,229,254,66,254,186,254,243,174,252,220,131,117,62,109,
+61,104,57,65,42,55,17,1,69,86,58,96,0,3,0,62,253,233,6,155,6,177,0,98,0,108,
+0,109,0,0,5,34,38,39,6,6,35,34,38,38,53,52,54,55,6,35,35,53,33,38,38,35,34,
+6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,
+53,51,21,20,22,51,50,18,17,52,2,39,6,6,35,34,38,53,52,38,39,34,39,55,4,0,
+17,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,3,38,39,
+22,23,22,22,51,50,54,1,4,180,113,168,67,76,161,112,120,189,110,117,114,66,
+151,40,2,136,5,100,85,81,76,1,147,3,155,140,165,181,60,151,166,154,86,146,
+129,136,138,137,135,139,172,166,84,84,40,134,80,117,126,18,37,2,3,53,1,164,
+1,151,75,251,193,219,181,57,69,102,79,59,117,135,3,111,4,102,88,119,177,22,
+5,4,52,55,54,74,254,64,22,84,96,104,76,101,200,139,130,198,59,8,135,89,98,
+61,53,14,8,5,7,23,22,114,124,190,183,84,24,87,157,111,139,155,146,155,14,
+14,156,145,1,3,1,4,178,1,34,112,71,81,141,147,115,88,23,2,126,138,253,230,
+254,115,252,159,253,4,131,117,62,109,61,104,57,65,42,55,17,1,69,80,50,82,
+5,62,115,81,49,112,87,62,56,1,55,0,6,0,10,253,233,9,85,6,177,0,84,0,93,0,
+121,0,133,0,134,0,135,0,0,5,34,38,39,55,22,22,51,50,54,54,53,52,38,35,34,
+6,21,21,35,53,52,38,35,34,7,22,21,20,2,4,35,34,36,39,7,39,1,38,53,52,54,36,
+51,50,23,54,1,23,1,22,23,54,51,50,22,23,54,54,51,50,18,17,20,7,17,33,34,38,
+53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,1,54,1,38,35,34,6,21,20,3,22,
+22,51,50,54,54,53,52,38,39,0,1,22,23,38,53,52,54,51,50,22,21,20,6,35,32,39,
+5,51,50,54,53,52,38,35,34,6,21,20,1,1,7,216,122,185,56,141,41,103,76,89,99,
+40,103,103,90,93,136,70,70,65,42,51,168,254,195,207,200,254,211,141,58,111,
+1,26,58,144,1,5,169,100,88,221,1,47,99,254,46,147,91,72,96,67,105,39,39,137,
+97,172,174,74,250,240,219,181,57,69,102,79,59,117,135,4,64,5,70,249,87,176,
+1,32,24,25,189,243,102,119,251,162,166,250,137,168,161,254,212,254,253,68,
+111,28,132,114,117,135,183,151,255,0,155,1,165,7,73,99,55,54,50,55,3,87,249,
+199,22,138,136,57,102,88,98,190,157,220,213,132,158,13,12,132,105,48,124,
+157,198,254,225,151,130,146,64,99,1,28,106,129,126,206,114,14,204,1,13,113,
+254,105,57,116,63,60,60,87,88,254,215,254,217,247,144,253,78,131,117,62,109,
+61,104,57,65,42,55,17,1,34,71,46,34,2,185,171,1,13,2,174,136,84,254,147,122,
+112,114,222,152,176,245,52,254,242,254,255,62,25,60,64,98,120,127,109,117,
+139,142,9,59,61,50,57,53,50,73,4,44,251,37,0,1,0,74,253,233,7,174,6,177,0,
+109,0,0,5,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,
+21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,2,53,52,18,36,51,50,23,54,51,50,
+22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,
+33,34,4,7,39,36,33,50,4,22,18,21,16,7,17,33,34,38,53,52,54,55,23,6,21,20,
+22,22,51,33,17,52,55,6,5,185,103,159,67,76,161,112,190,229,113,110,70,139,
+19,2,146,5,100,85,79,78,1,147,3,13,152,162,113,134,60,69,150,1,32,190,53,
+25,20,20,167,179,91,151,166,154,86,146,129,139,135,137,128,131,173,175,254,
+144,254,145,168,254,217,163,67,1,61,1,126,208,1,69,231,120,70,251,194,219,
+181,57,69,102,79,59,117,135,3,110,5,108,22,85,95,104,76,236,204,129,196,61,
+7,135,89,98,59,55,14,8,5,7,23,22,51,35,42,239,183,235,161,72,95,1,1,123,185,
+1,20,148,2,2,192,181,84,24,87,157,111,139,155,149,152,14,14,153,148,1,37,
+1,34,1,175,1,175,74,91,135,174,121,247,254,132,253,254,242,173,252,220,131,
+117,62,109,61,104,57,65,42,55,17,1,69,86,58,96,0,2,0,44,254,51,7,78,4,230,
+0,78,0,95,0,0,1,52,0,35,34,4,7,54,51,50,22,21,20,4,33,34,36,53,53,7,39,0,
+55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,4,18,21,20,2,
+6,35,35,34,39,6,21,20,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,55,
+22,51,50,54,54,1,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,6,178,254,233,
+244,141,254,234,124,83,113,229,254,254,224,254,231,240,254,242,74,130,1,5,
+190,39,111,59,70,10,12,143,27,147,128,184,77,149,1,36,156,208,1,46,157,127,
+231,147,20,9,9,80,219,133,125,4,144,8,204,200,182,187,85,93,44,27,120,164,
+84,251,50,88,71,70,12,194,186,208,206,191,178,90,150,2,86,243,1,12,111,107,
+28,234,217,239,251,215,203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,
+121,135,187,119,109,162,254,208,201,183,254,244,141,1,64,91,161,107,127,41,
+34,12,37,55,181,189,155,131,94,149,71,3,107,208,1,12,102,98,5,44,56,143,147,
+177,164,154,160,27,0,4,0,74,253,233,6,32,6,177,0,61,0,70,0,71,0,72,0,0,5,
+32,0,53,52,0,33,50,23,7,38,35,34,6,21,20,22,51,50,36,18,53,52,39,6,6,35,34,
+38,53,52,38,39,39,55,22,0,18,21,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,
+22,51,33,17,52,55,6,4,1,38,39,22,23,22,22,51,50,1,3,2,222,254,192,254,172,
+1,72,1,27,126,100,12,98,116,220,241,255,247,221,1,53,158,86,44,122,69,119,
+123,16,40,7,51,243,1,73,157,79,252,60,219,181,57,69,102,79,59,117,135,2,244,
+4,100,254,200,1,62,106,179,21,5,4,52,55,94,254,99,120,22,1,11,242,246,1,6,
+14,141,14,188,179,178,185,175,1,75,208,200,154,59,62,144,144,111,93,23,3,
+124,77,254,245,254,174,192,233,184,252,67,131,117,62,109,61,104,57,65,42,
+55,17,1,214,74,61,113,119,5,44,124,89,52,108,87,62,1,111,254,193,0,1,0,72,
+253,233,4,99,4,230,0,57,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,
+7,38,53,52,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,33,34,38,
+53,52,54,55,23,6,21,20,22,22,51,33,17,6,2,193,254,215,254,178,96,182,235,
+183,204,5,102,89,81,81,2,147,4,158,143,170,182,254,179,188,186,127,57,254,
+238,188,150,64,253,117,219,181,57,69,102,79,59,117,135,1,187,112,22,1,6,237,
+122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,192,182,83,34,84,127,84,
+159,185,61,47,253,95,131,117,62,109,61,104,57,65,42,55,17,1,149,32,0,2,0,
+74,253,233,6,125,6,177,0,73,0,74,0,0,5,34,38,39,6,6,35,34,38,53,52,54,36,
+51,50,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,
+0,33,34,4,7,39,54,36,51,32,4,18,17,16,7,17,33,34,38,53,52,54,55,23,6,21,20,
+22,22,51,33,17,52,55,6,6,1,4,137,103,161,68,75,157,114,188,221,143,1,14,183,
+111,115,14,87,117,217,237,141,132,132,133,138,128,131,173,174,254,146,254,
+153,172,254,209,146,67,160,1,85,196,1,16,1,133,210,70,251,214,219,181,57,
+69,102,79,59,117,135,3,90,5,51,149,253,29,22,86,94,105,75,255,230,153,245,
+134,14,139,13,213,192,157,169,147,154,14,14,152,149,1,35,1,36,1,172,1,178,
+78,86,134,90,84,215,254,64,254,174,254,242,174,252,221,131,117,62,109,61,
+104,57,65,42,55,17,1,101,53,59,46,50,4,252,0,2,0,58,253,233,7,107,4,230,0,
+79,0,93,0,0,5,34,39,55,22,51,50,54,53,52,0,35,32,7,54,51,50,22,21,20,0,33,
+32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,
+50,23,54,36,51,50,4,18,21,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,
+33,17,52,55,6,1,6,6,7,22,22,51,50,54,53,52,38,35,34,5,115,64,33,8,44,27,178,
+190,254,225,246,254,247,166,49,46,228,254,254,211,254,225,254,211,254,149,
+48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,192,69,99,
+1,12,158,207,1,54,165,79,251,27,219,181,57,69,102,79,59,117,135,4,21,6,112,
+252,192,57,223,191,65,247,200,208,225,194,175,69,5,6,138,3,238,215,242,1,
+22,197,7,234,217,227,254,249,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,
+67,30,45,39,29,82,78,121,135,200,118,123,159,254,210,201,203,147,252,247,
+131,117,62,109,61,104,57,65,42,55,17,1,92,69,63,90,3,12,173,167,5,156,150,
+184,166,149,156,0,1,0,74,253,233,5,62,4,230,0,73,0,0,5,32,0,53,52,62,2,51,
+51,38,38,35,34,6,21,20,23,7,38,53,52,55,34,6,21,20,23,7,38,38,53,52,18,36,
+51,50,23,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,33,34,38,53,
+52,54,55,23,6,21,20,22,22,51,33,17,6,3,175,254,228,254,192,77,154,214,214,
+195,5,104,88,82,80,2,146,5,26,233,254,105,137,56,62,150,1,32,190,110,63,43,
+68,169,183,254,197,179,177,119,54,240,226,165,154,63,253,99,219,181,57,69,
+102,79,59,117,135,1,205,113,22,1,6,237,109,172,118,56,89,98,62,50,18,12,18,
+30,20,71,44,255,231,221,180,67,102,247,126,185,1,20,148,11,11,190,184,83,
+34,85,126,84,159,185,60,47,253,96,131,117,62,109,61,104,57,65,42,55,17,1,
+146,29,0,1,0,74,253,233,6,8,4,230,0,82,0,0,5,34,36,38,53,52,36,33,51,38,38,
+35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,
+52,38,35,35,53,52,54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,51,32,17,20,7,
+17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,3,39,245,254,184,
+160,1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,200,176,1,43,1,29,
+201,1,8,122,178,198,177,179,168,138,156,13,145,9,157,86,99,4,31,2,13,79,252,
+84,219,181,57,69,102,79,59,117,135,2,220,4,186,22,129,239,168,208,210,90,
+97,121,23,38,23,48,54,114,124,193,181,83,140,147,183,203,99,172,114,149,139,
+83,181,193,124,115,48,53,23,38,23,121,99,88,254,94,169,117,253,5,131,117,
+62,109,61,104,57,65,42,55,17,1,85,90,56,114,0,3,0,74,253,233,6,54,6,177,0,
+75,0,85,0,86,0,0,5,32,0,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,
+51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,39,6,6,35,34,38,53,52,
+38,39,39,55,4,0,17,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,
+52,55,6,4,1,38,39,22,23,22,22,51,50,54,1,2,224,254,203,254,159,1,39,1,7,123,
+5,99,85,157,5,145,9,155,139,168,179,225,171,187,94,1,16,240,222,1,57,165,
+87,43,120,71,116,126,16,40,7,51,1,100,1,117,80,252,39,219,181,57,69,102,79,
+59,117,135,3,9,3,106,254,191,1,79,109,176,21,5,4,52,55,47,71,254,73,22,1,
+31,248,191,228,90,97,121,19,24,24,50,35,114,124,192,182,83,64,125,97,180,
+207,166,1,67,214,207,157,57,63,141,147,111,93,23,3,124,114,254,49,254,194,
+223,181,252,75,131,117,62,109,61,104,57,65,42,55,17,1,190,118,42,117,116,
+5,43,127,87,52,108,87,62,44,1,67,0,3,0,74,253,233,6,161,6,177,0,88,0,98,0,
+99,0,0,5,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,6,21,20,23,54,51,50,
+22,21,20,6,35,34,38,38,53,52,18,36,51,50,22,21,20,6,6,7,6,6,21,20,22,51,50,
+54,18,53,52,2,36,35,34,4,7,39,36,33,32,4,18,17,16,7,17,33,34,38,53,52,54,
+55,23,6,21,20,22,22,51,33,17,52,55,6,37,22,51,50,54,53,52,38,35,34,1,4,136,
+97,127,54,27,38,34,24,172,154,136,206,113,21,136,165,120,143,154,143,129,
+201,108,148,1,25,185,219,250,17,26,32,31,22,71,65,101,172,104,174,254,182,
+227,183,254,196,147,68,1,78,1,129,1,18,1,140,211,75,251,187,219,181,57,69,
+102,79,59,117,135,3,117,5,125,251,231,73,131,80,72,68,58,123,1,30,22,77,117,
+67,53,98,90,80,102,52,134,148,119,223,148,109,71,153,137,105,124,135,136,
+243,146,186,1,33,159,222,180,52,95,76,76,74,76,37,64,66,152,1,45,205,245,
+1,105,186,82,83,135,174,220,254,89,254,223,255,0,192,252,156,131,117,62,109,
+61,104,57,65,42,55,17,1,93,98,63,137,230,92,59,57,49,61,3,144,0,1,0,62,254,
+51,7,108,4,230,0,100,0,0,1,52,2,35,34,6,7,54,51,50,22,21,20,6,4,35,32,0,53,
+52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,
+21,35,34,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,0,17,16,0,33,
+35,34,39,6,21,20,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,55,22,
+51,50,54,6,210,200,175,156,204,55,40,54,113,128,137,254,242,193,254,241,254,
+191,84,82,72,99,32,2,81,5,99,85,81,76,1,147,3,155,139,166,181,106,152,147,
+98,50,235,209,216,234,98,32,43,28,146,51,1,52,224,246,1,20,254,201,254,246,
+27,13,12,81,219,133,125,4,144,8,204,200,182,187,85,93,27,57,217,225,2,121,
+217,1,3,199,196,18,145,133,137,219,120,1,15,224,105,169,56,6,135,90,97,61,
+53,14,8,5,7,12,33,114,124,190,184,83,35,77,110,81,171,199,180,164,129,13,
+23,45,1,68,1,68,254,178,254,225,254,212,254,174,1,63,92,161,107,127,41,34,
+12,37,55,181,189,155,131,94,149,71,3,255,0,3,0,79,253,233,6,132,6,177,0,91,
+0,102,0,103,0,0,5,34,36,2,53,52,18,51,50,22,22,21,20,7,6,21,20,51,50,55,6,
+35,34,38,53,52,54,51,50,30,2,21,20,6,35,34,38,53,52,55,54,53,52,35,34,6,6,
+21,16,0,33,32,0,17,52,2,36,35,34,4,7,39,36,33,32,4,18,17,20,7,17,33,34,38,
+53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,19,38,38,35,34,6,21,20,22,
+51,50,3,3,51,227,254,179,180,204,164,65,81,29,10,11,231,218,41,77,103,110,
+126,142,127,57,103,86,49,219,187,183,193,10,9,59,54,86,50,1,55,1,30,1,82,
+1,96,171,254,187,211,176,254,223,171,65,1,70,1,119,1,2,1,137,210,80,251,217,
+219,181,57,69,102,79,59,117,135,3,87,4,104,254,194,73,11,81,62,62,60,61,53,
+92,157,22,163,1,61,215,235,1,15,53,72,35,37,70,71,52,186,170,47,121,104,100,
+128,36,80,130,87,172,205,166,147,43,64,63,21,71,85,163,109,254,242,254,219,
+1,114,1,88,236,1,71,168,73,97,135,179,205,254,117,254,233,245,181,252,81,
+131,117,62,109,61,104,57,65,42,55,17,1,166,114,63,113,113,3,149,74,79,51,
+46,47,52,1,146,0,3,0,83,253,233,6,191,6,177,0,120,0,131,0,132,0,0,5,34,39,
+39,54,53,52,38,35,34,6,21,20,23,7,6,35,34,0,17,52,18,54,51,50,22,21,20,7,
+6,21,20,51,50,55,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,38,53,52,55,
+54,53,52,35,34,6,6,21,20,18,51,51,22,51,50,55,38,53,52,54,51,51,50,22,21,
+20,7,51,50,18,17,16,0,33,34,4,7,39,36,33,32,4,18,17,20,7,17,33,34,38,53,52,
+54,55,23,6,21,20,22,22,51,33,17,52,55,6,1,38,38,35,34,6,21,20,22,51,50,3,
+4,135,140,73,14,89,80,78,79,81,89,14,77,87,244,254,225,98,178,108,86,91,10,
+11,231,218,41,77,103,110,126,142,127,131,164,219,187,134,169,73,10,9,60,50,
+97,58,199,175,10,1,2,3,4,69,150,142,27,138,151,69,58,201,218,254,142,254,
+177,189,254,209,178,65,1,77,1,141,1,12,1,136,203,69,251,147,219,181,57,69,
+102,79,59,117,135,3,157,5,134,254,248,11,81,62,58,64,61,53,92,179,21,23,135,
+23,75,52,53,54,51,75,23,135,24,1,82,1,41,173,1,0,137,91,69,37,70,71,52,186,
+170,47,121,104,100,128,174,159,172,205,86,140,87,43,64,63,21,71,105,195,124,
+236,254,244,1,1,57,89,97,104,104,97,88,58,1,81,1,46,1,146,1,156,73,99,135,
+181,222,254,81,254,201,240,176,252,156,131,117,62,109,61,104,57,65,42,55,
+17,1,107,88,65,142,3,148,74,79,48,49,47,52,1,146,0,1,0,74,253,233,6,52,4,
+230,0,84,0,0,5,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,
+20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,38,35,35,53,52,54,51,50,
+22,21,20,7,39,54,53,52,35,34,6,7,51,32,4,21,20,7,17,33,34,38,53,52,54,55,
+23,6,21,20,22,22,51,33,17,52,55,6,4,155,112,167,69,75,158,115,188,221,140,
+1,5,174,61,37,11,28,51,203,230,141,132,132,133,138,136,138,129,135,105,223,
+198,55,179,167,136,159,14,144,9,157,86,99,4,23,1,29,1,21,79,252,40,219,181,
+57,69,102,79,59,117,135,3,8,4,88,22,83,97,104,76,255,230,152,246,134,6,139,
+5,217,188,157,169,147,154,14,14,158,143,162,160,145,145,61,84,181,192,121,
+118,44,57,23,38,23,121,99,88,245,242,183,119,253,90,131,117,62,109,61,104,
+57,65,42,55,17,1,47,69,41,40,0,2,0,74,253,233,6,121,4,230,0,66,0,67,0,0,5,
+34,36,2,53,52,18,36,33,32,4,21,20,6,35,34,38,53,52,55,33,53,33,21,33,6,21,
+20,51,50,54,53,52,36,33,34,4,2,21,20,0,33,50,36,55,23,17,33,34,38,53,52,54,
+55,23,6,21,20,22,22,51,33,53,52,55,6,4,37,3,46,231,254,177,174,213,1,150,
+1,15,1,86,1,95,230,207,176,179,11,254,202,2,252,254,213,16,203,139,146,254,
+247,254,248,240,254,176,170,1,53,1,20,236,1,32,115,139,251,214,219,181,57,
+69,102,79,59,117,135,3,90,7,136,254,216,254,177,148,163,1,43,201,221,1,79,
+183,246,232,173,203,142,139,35,36,137,137,30,38,143,122,111,175,165,147,254,
+242,181,245,254,241,109,101,63,253,86,131,117,62,109,61,104,57,65,42,55,17,
+239,101,77,94,76,126,0,1,0,74,253,233,6,54,6,177,0,76,0,0,5,34,36,38,53,52,
+54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,6,6,21,
+20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,22,18,21,20,7,17,33,34,
+38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,2,222,205,254,213,156,
+132,250,214,127,5,100,85,157,6,145,9,155,139,166,180,254,246,175,185,92,1,
+15,239,221,1,57,168,168,254,198,194,164,254,222,146,67,1,56,1,100,167,1,36,
+236,134,80,252,39,219,181,57,69,102,79,59,117,135,3,9,5,101,254,186,22,131,
+241,163,125,190,104,89,98,121,19,24,24,50,35,114,124,191,183,83,65,125,96,
+181,206,171,1,80,225,229,1,63,165,79,86,135,174,97,207,254,178,219,236,188,
+252,57,131,117,62,109,61,104,57,65,42,55,17,1,165,115,80,119,124,0,4,0,78,
+254,51,7,54,4,230,0,85,0,98,0,99,0,100,0,0,1,52,54,51,50,23,53,52,38,35,34,
+6,7,54,51,50,22,21,20,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,2,17,20,
+22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,22,18,21,20,0,7,6,21,20,51,50,54,
+54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,55,54,53,52,39,38,23,54,55,38,
+35,34,6,21,20,23,22,21,20,7,39,4,197,139,112,98,76,211,170,170,201,57,47,
+47,112,129,123,238,161,254,241,254,211,145,1,21,185,55,47,8,41,47,230,229,
+217,201,173,199,97,31,44,28,146,52,1,50,249,159,232,126,254,246,238,75,219,
+98,113,47,4,144,8,204,200,182,187,77,92,12,16,17,156,208,45,65,80,58,61,8,
+8,123,51,1,178,122,130,48,19,208,244,202,194,19,145,131,136,218,124,1,75,
+1,41,195,1,37,160,6,138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,
+64,1,72,143,254,237,183,240,254,170,79,63,88,161,55,100,79,41,34,12,37,55,
+181,189,155,131,90,145,72,17,30,41,84,85,212,114,207,53,68,64,27,57,56,46,
+27,226,126,0,3,0,74,253,233,6,8,4,230,0,94,0,106,0,120,0,0,5,34,36,38,53,
+52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,
+20,4,33,50,36,54,53,52,39,6,7,22,21,20,6,35,34,38,38,53,52,54,54,51,51,50,
+54,55,38,35,35,53,52,54,51,50,22,21,20,7,22,22,21,20,7,17,33,34,38,53,52,
+54,55,23,6,21,20,22,22,51,33,17,52,55,6,3,50,22,23,54,53,52,38,35,34,6,7,
+19,6,35,35,34,6,21,20,22,51,50,54,53,52,3,39,245,254,184,160,1,9,1,4,31,5,
+99,85,157,9,144,14,155,140,167,179,176,200,176,1,43,1,29,201,1,8,122,53,79,
+108,27,190,192,132,171,79,75,148,132,94,140,167,57,79,133,177,176,162,149,
+151,44,54,54,79,252,84,219,181,57,69,102,79,59,117,135,2,220,4,186,116,90,
+149,60,16,83,74,86,99,4,34,69,102,102,114,78,123,125,119,119,22,129,239,168,
+208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,140,147,183,203,99,172,
+114,116,66,72,35,49,60,115,109,55,98,68,78,82,39,50,46,30,83,181,193,143,
+131,95,79,52,146,94,169,117,253,5,131,117,62,109,61,104,57,65,42,55,17,1,
+85,90,56,114,3,186,25,25,37,44,76,80,99,88,254,134,10,38,42,48,38,41,60,44,
+0,1,0,62,253,233,6,77,4,230,0,106,0,0,5,34,38,39,6,6,35,34,38,53,52,54,55,
+6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,
+14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,38,35,35,53,52,
+54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,51,50,22,22,21,20,7,17,33,34,38,
+53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,180,113,168,67,76,161,112,
+189,230,117,113,56,160,40,2,104,5,100,85,81,76,1,147,3,155,139,167,179,39,
+147,162,152,84,145,130,136,138,137,135,140,129,135,114,229,183,48,179,167,
+136,159,14,144,9,157,86,99,4,17,181,253,127,79,252,20,219,181,57,69,102,79,
+59,117,135,3,28,5,87,22,84,96,104,76,237,203,130,197,59,7,135,89,98,61,53,
+14,8,5,7,12,33,114,124,191,183,83,26,87,156,110,140,154,146,155,14,14,156,
+145,163,159,144,147,60,83,181,193,121,118,44,57,23,38,23,121,99,88,110,218,
+159,183,119,253,90,131,117,62,109,61,104,57,65,42,55,17,1,18,109,30,40,0,
+1,0,74,253,233,7,83,4,230,0,93,0,0,5,34,39,55,22,51,50,54,54,53,52,2,35,34,
+6,7,54,51,50,22,21,20,6,4,35,34,36,38,53,52,36,33,51,38,38,35,34,21,20,23,
+7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,22,51,50,54,53,52,35,34,6,7,39,
+18,0,51,50,0,17,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,
+55,6,5,18,57,54,8,44,40,150,198,94,199,176,157,203,54,44,49,114,128,141,254,
+243,190,179,254,244,146,1,9,1,1,34,5,99,85,157,9,144,14,155,140,167,179,176,
+197,179,239,205,212,237,98,32,43,28,145,49,1,52,225,247,1,19,75,251,5,219,
+181,57,69,102,79,59,117,135,4,43,6,138,5,6,138,3,121,222,154,215,1,5,201,
+193,17,146,132,136,221,119,126,242,169,205,212,90,97,121,23,38,23,48,54,114,
+124,193,181,83,139,152,177,205,182,162,129,13,23,45,1,65,1,71,254,178,254,
+225,204,149,252,209,131,117,62,109,61,104,57,65,42,55,17,1,105,80,66,117,
+0,3,0,74,255,234,7,67,6,177,0,72,0,82,0,83,0,0,1,20,2,4,33,34,36,38,53,52,
+36,33,51,38,38,35,34,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,38,53,52,18,
+36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,39,6,6,
+35,34,38,53,52,38,39,39,55,4,0,37,38,39,22,23,22,22,51,50,54,1,7,67,200,254,
+127,254,243,206,254,213,157,1,39,1,7,123,5,99,85,157,5,145,9,16,156,165,113,
+134,63,66,151,1,33,188,25,33,40,23,166,181,225,171,187,94,1,16,240,222,1,
+57,165,87,43,120,71,119,123,16,40,7,51,1,100,1,117,254,195,107,179,22,5,4,
+52,55,50,70,254,72,3,50,253,254,128,203,131,241,163,191,228,90,97,121,19,
+24,24,50,35,46,42,42,242,182,234,161,73,104,245,127,186,1,20,146,4,4,190,
+184,83,64,125,97,180,207,166,1,67,214,207,157,57,63,144,144,111,93,23,3,124,
+114,254,49,166,125,89,49,112,87,62,47,1,64,0,1,0,78,253,233,6,114,4,230,0,
+72,0,0,5,35,34,39,55,22,51,50,54,17,52,38,35,34,6,6,21,21,35,53,52,38,38,
+35,34,6,21,16,22,51,50,55,23,6,35,32,0,17,16,18,51,50,22,23,54,54,51,50,22,
+18,21,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,101,
+28,38,33,9,18,53,203,192,164,147,88,115,54,137,62,113,82,147,164,192,203,
+13,57,8,59,39,254,254,254,245,246,211,107,162,60,59,164,114,130,204,115,75,
+251,230,219,181,57,69,102,79,59,117,135,3,74,5,116,22,5,139,3,241,1,14,227,
+254,78,137,116,70,71,122,137,71,251,230,254,242,241,5,139,7,1,76,1,64,1,40,
+1,72,94,102,103,93,141,254,229,201,234,157,252,251,131,117,62,109,61,104,
+57,65,42,55,17,1,47,100,62,92,0,3,0,44,253,233,10,218,6,177,0,96,0,122,0,
+148,0,0,5,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,6,21,20,
+22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,21,21,35,34,6,
+6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,54,36,51,50,4,18,17,20,7,17,
+33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,1,54,51,50,22,23,
+54,36,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,
+22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,7,157,196,254,241,
+75,35,149,106,193,108,50,136,101,149,179,1,26,130,1,1,197,40,113,59,70,10,
+12,143,27,147,128,94,135,35,153,1,68,227,172,144,74,111,167,179,248,177,186,
+89,1,5,230,217,1,47,155,163,254,210,186,158,254,238,146,68,142,1,77,173,240,
+1,113,194,80,252,39,219,181,57,69,102,79,59,117,135,3,9,4,102,254,203,250,
+44,101,136,173,238,65,57,1,2,188,145,5,99,85,157,5,144,10,10,102,101,213,
+254,192,254,218,89,134,63,4,102,104,104,105,137,113,102,102,110,232,219,133,
+156,22,111,111,110,112,180,94,86,187,176,46,73,1,112,184,157,66,71,30,45,
+39,29,82,78,121,135,102,96,123,116,40,40,193,181,83,69,126,91,180,207,179,
+1,81,216,228,1,65,164,76,89,135,85,89,205,254,126,254,246,241,191,252,65,
+131,117,62,109,61,104,57,65,42,55,17,1,165,88,96,116,116,3,137,36,113,112,
+117,121,90,97,121,19,24,24,42,43,45,31,22,109,254,234,101,187,23,33,139,120,
+146,155,14,22,135,158,133,134,188,200,27,0,5,0,44,253,233,10,216,4,230,0,
+113,0,139,0,151,0,177,0,191,0,0,5,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,
+39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,
+51,50,22,21,21,35,34,6,21,20,4,33,32,36,53,52,39,6,7,22,21,20,6,35,34,38,
+53,52,54,54,51,51,50,54,55,38,35,35,53,52,54,51,50,22,21,20,7,22,22,21,20,
+7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,1,54,51,50,22,
+23,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,4,5,50,22,23,54,
+53,52,38,35,34,6,7,5,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,
+53,52,38,35,34,6,5,6,35,35,34,6,21,20,22,51,50,54,53,52,7,246,229,254,198,
+86,36,149,107,193,108,50,136,101,149,179,1,26,130,1,1,197,40,113,59,70,10,
+12,143,27,147,128,94,135,35,153,1,68,227,119,100,57,74,167,179,176,200,176,
+1,43,1,29,1,30,1,45,53,77,110,28,191,192,189,193,80,147,128,95,140,167,56,
+78,133,177,176,162,146,153,44,54,55,79,252,84,219,181,57,69,102,79,59,117,
+135,2,220,4,186,249,76,101,136,170,235,64,47,236,190,32,5,100,85,157,10,145,
+13,17,30,30,213,254,192,5,180,90,149,59,17,82,75,85,100,5,249,70,89,134,63,
+4,102,104,104,105,137,113,102,102,110,232,219,133,156,6,145,69,102,102,112,
+79,122,125,120,118,22,114,114,114,114,180,94,86,187,176,46,73,1,112,184,157,
+66,71,30,45,39,29,82,78,121,135,102,96,123,116,18,18,193,181,83,140,147,183,
+203,202,183,116,66,70,36,52,58,115,109,113,108,80,82,37,49,47,30,83,181,193,
+141,133,93,81,53,146,93,169,117,253,5,131,117,62,109,61,104,57,65,42,55,17,
+1,85,103,44,115,3,137,36,112,112,118,119,89,98,121,30,31,23,53,49,54,42,2,
+109,73,25,25,42,39,73,83,98,89,205,101,187,23,33,139,120,146,155,14,22,135,
+158,133,134,188,200,27,198,10,37,43,48,38,41,60,44,0,3,0,78,253,233,10,8,
+6,177,0,102,0,115,0,116,0,0,5,34,38,39,6,6,35,34,38,39,6,6,35,32,0,17,52,
+18,36,51,50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,
+50,22,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,
+0,33,34,4,7,39,54,36,51,32,4,18,17,16,7,17,33,34,38,53,52,54,55,23,6,21,20,
+22,22,51,33,17,52,55,6,1,54,51,50,23,54,36,55,38,38,35,34,6,5,8,32,99,154,
+68,71,155,113,119,172,44,57,221,157,254,241,254,211,145,1,21,185,55,47,8,
+41,47,230,229,217,201,173,199,97,31,44,28,146,47,1,55,241,133,248,143,100,
+36,36,218,237,136,127,125,130,137,124,126,168,168,254,157,254,164,174,254,
+228,145,67,158,1,76,189,1,9,1,124,204,70,251,214,219,181,57,69,102,79,59,
+117,135,3,90,4,101,250,118,44,52,93,52,58,1,16,198,83,156,91,173,215,3,101,
+22,83,97,102,78,113,106,108,111,1,75,1,41,195,1,37,160,6,138,3,254,253,254,
+254,222,250,182,153,138,14,22,45,1,66,1,70,113,139,150,3,213,192,157,169,
+145,156,14,14,152,149,1,35,1,36,1,172,1,178,75,89,134,91,83,216,254,64,254,
+175,254,236,173,252,226,131,117,62,109,61,104,57,65,42,55,17,1,101,63,43,
+90,2,222,20,57,154,159,2,66,58,203,53,0,1,0,74,253,233,7,68,6,177,0,98,0,
+0,5,34,36,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,
+52,55,6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,35,34,14,
+3,21,20,22,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,18,17,20,7,17,33,
+34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,3,236,209,254,222,141,
+96,98,72,110,29,2,208,5,100,85,81,76,1,147,3,18,175,190,113,134,63,66,151,
+1,33,188,33,44,46,40,166,181,177,131,156,111,77,46,255,235,221,1,57,168,169,
+254,199,194,168,254,228,148,68,1,53,1,104,245,1,124,204,81,252,39,219,181,
+57,69,102,79,59,117,135,3,9,5,100,254,186,22,127,219,140,112,175,54,8,135,
+89,98,61,53,13,7,7,7,23,22,56,43,32,248,197,234,161,73,104,245,127,186,1,
+20,146,7,7,190,184,83,16,48,72,106,79,166,186,171,1,80,225,230,1,63,164,77,
+88,135,174,202,254,126,254,243,242,185,252,60,131,117,62,109,61,104,57,65,
+42,55,17,1,165,114,80,116,126,0,4,0,78,253,233,7,192,6,177,0,86,0,96,0,97,
+0,98,0,0,5,34,38,39,6,6,35,34,38,53,52,54,55,38,35,34,0,21,20,23,7,38,53,
+16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,54,53,16,
+39,6,6,35,34,38,53,52,38,39,34,39,55,4,0,17,20,7,17,33,34,38,53,52,54,55,
+23,6,21,20,22,22,51,33,17,52,55,6,3,38,39,22,23,22,22,51,50,54,1,1,5,217,
+112,167,69,74,158,116,188,221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,
+168,144,41,187,211,141,132,134,132,137,136,137,116,149,73,168,41,135,79,119,
+123,18,37,2,3,53,1,164,1,151,69,251,214,219,181,57,69,102,79,59,117,135,3,
+90,4,103,94,116,180,22,5,4,52,55,51,75,254,64,254,170,22,83,97,103,77,255,
+230,182,244,44,3,254,253,232,186,155,49,191,207,1,26,1,67,64,138,4,218,184,
+156,170,149,152,14,14,157,144,115,229,175,1,99,226,72,81,144,144,113,90,23,
+2,126,138,253,230,254,115,241,156,252,246,131,117,62,109,61,104,57,65,42,
+55,17,1,101,59,41,84,5,63,112,84,49,113,87,62,53,1,58,254,193,0,5,0,44,253,
+233,10,65,6,177,0,87,0,97,0,109,0,126,0,127,0,0,5,34,36,39,6,6,35,34,36,53,
+53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,
+4,23,7,6,6,21,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,
+0,17,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,1,38,
+39,22,23,22,22,51,50,54,1,54,54,55,38,35,32,7,54,51,50,22,5,6,7,23,6,21,20,
+22,51,50,54,53,52,38,35,34,6,1,7,25,213,254,230,70,58,247,189,240,254,242,
+74,130,1,5,190,39,111,59,70,10,12,143,27,147,128,92,130,39,149,1,36,156,169,
+1,48,112,56,202,201,246,237,211,1,40,154,86,42,122,71,119,123,19,35,9,51,
+1,98,1,119,79,252,60,219,181,57,69,102,79,59,117,135,2,244,3,94,254,210,1,
+48,109,178,22,5,4,52,55,48,71,251,238,44,178,135,178,225,254,223,255,88,109,
+141,196,253,71,88,71,70,12,194,186,208,206,191,178,90,150,4,242,22,121,122,
+122,121,215,203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,135,94,
+93,119,109,136,124,143,17,182,165,177,186,172,1,75,211,201,154,57,65,144,
+144,124,82,21,3,124,113,254,53,254,210,241,185,252,76,131,117,62,109,61,104,
+57,65,42,55,17,1,175,119,45,108,114,5,45,126,87,49,112,87,62,45,253,241,100,
+124,23,143,223,28,98,102,102,98,5,44,56,143,147,177,164,154,160,27,3,53,0,
+3,0,44,253,233,10,87,6,177,0,91,0,116,0,133,0,0,5,34,36,39,6,6,35,34,36,53,
+53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,23,
+54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,54,
+36,51,50,4,18,17,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,
+55,6,4,1,38,53,52,55,38,35,32,5,54,51,50,22,23,54,54,51,51,38,38,35,34,21,
+20,23,5,6,7,23,6,21,20,22,51,50,54,53,52,38,35,34,6,7,26,209,254,232,70,57,
+250,194,240,254,242,74,130,1,5,190,39,111,59,70,10,12,143,27,147,128,184,
+77,149,1,36,156,160,130,76,114,166,180,248,177,186,89,1,5,230,217,1,47,155,
+163,254,210,186,158,254,238,146,68,142,1,77,173,239,1,113,195,80,252,39,219,
+181,57,69,102,79,59,117,135,3,9,4,102,254,203,253,152,10,9,95,109,254,223,
+255,0,88,110,146,201,54,60,246,185,145,5,99,85,157,5,251,224,88,71,70,12,
+194,186,208,206,191,178,90,150,22,124,125,125,124,215,203,25,126,73,1,121,
+184,148,66,71,30,45,39,29,82,78,121,135,187,119,109,43,43,191,183,83,69,126,
+91,180,207,179,1,81,216,228,1,65,164,76,89,135,85,89,205,254,127,254,245,
+241,191,252,65,131,117,62,109,61,104,57,65,42,55,17,1,165,88,96,115,117,3,
+185,42,43,40,33,25,223,28,99,98,105,105,90,97,121,19,24,236,102,98,5,44,56,
+143,147,177,164,154,160,27,0,2,0,78,253,233,7,187,6,177,0,81,0,82,0,0,5,34,
+38,39,6,6,35,34,38,53,52,54,55,38,35,34,0,21,20,23,7,38,53,16,0,33,50,23,
+7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,
+36,51,32,0,17,16,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,
+6,1,5,199,103,161,68,75,157,114,188,221,185,173,24,26,216,255,0,80,143,87,
+1,67,1,12,168,144,41,187,211,141,132,134,132,137,130,129,173,174,254,146,
+254,153,172,254,209,146,67,160,1,86,196,1,168,1,190,70,251,214,219,181,57,
+69,102,79,59,117,135,3,90,5,106,252,195,22,86,94,105,75,255,230,182,244,44,
+3,254,253,232,186,155,49,191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,
+14,14,156,145,1,35,1,36,1,172,1,178,78,86,134,90,84,254,1,254,22,254,245,
+176,252,220,131,117,62,109,61,104,57,65,42,55,17,1,101,54,59,97,4,252,0,1,
+0,74,253,233,7,68,6,177,0,90,0,0,5,32,0,53,52,54,54,51,51,38,38,35,34,21,
+20,23,7,38,53,52,55,6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,
+21,21,33,34,6,6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,18,
+17,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,3,235,
+254,204,254,160,132,250,214,127,5,100,85,157,6,145,9,21,177,191,113,134,63,
+66,151,1,33,188,39,41,39,44,166,181,254,245,175,185,92,1,15,239,222,1,59,
+166,169,254,198,194,162,254,223,149,67,1,58,1,98,245,1,125,204,82,252,39,
+219,181,57,69,102,79,59,117,135,3,9,5,103,254,191,22,1,30,249,125,190,104,
+89,98,121,19,24,24,50,35,54,45,32,249,196,234,161,73,104,245,127,186,1,20,
+146,8,8,191,183,83,65,125,96,181,206,174,1,81,221,229,1,64,164,78,87,135,
+174,202,254,126,254,243,239,190,252,62,131,117,62,109,61,104,57,65,42,55,
+17,1,165,114,80,119,123,0,5,0,58,253,233,10,96,6,177,0,89,0,99,0,112,0,126,
+0,127,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,
+20,22,23,7,38,53,52,54,51,50,23,54,36,51,32,1,7,6,6,21,20,22,51,50,36,18,
+53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,0,17,20,7,17,33,34,38,53,52,54,
+55,23,6,21,20,22,22,51,33,17,52,55,6,19,38,39,22,23,22,22,51,50,54,1,54,51,
+50,22,23,54,54,55,38,38,35,32,3,6,6,7,22,22,51,50,54,53,52,38,35,34,1,7,56,
+214,254,228,69,59,255,0,196,254,211,254,149,48,146,5,9,20,72,94,93,77,29,
+17,83,70,62,67,10,12,143,27,147,128,192,69,99,1,11,156,1,81,1,10,56,202,201,
+246,237,211,1,40,154,86,42,122,71,119,123,19,35,9,51,1,98,1,119,79,252,60,
+219,181,57,69,102,79,59,117,135,2,244,3,203,111,109,178,22,5,4,52,55,48,71,
+250,7,49,46,142,197,56,44,178,133,89,205,116,254,246,216,55,223,193,65,247,
+200,208,225,194,175,67,4,68,22,123,123,123,123,1,66,1,59,24,32,36,1,17,55,
+105,77,133,120,70,67,30,45,39,29,82,78,121,135,200,118,123,254,252,143,17,
+182,165,177,186,172,1,75,211,201,154,57,65,144,144,124,82,21,3,124,113,254,
+53,254,210,237,187,252,74,131,117,62,109,61,104,57,65,42,55,17,1,175,122,
+44,224,5,45,126,87,49,112,87,62,45,254,173,7,95,94,97,120,24,71,72,254,173,
+171,169,5,156,150,184,166,149,156,3,26,0,3,0,58,253,233,8,158,4,230,0,79,
+0,107,0,121,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,
+34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,55,54,54,51,50,
+22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,33,34,38,53,52,54,55,23,6,21,
+20,22,22,51,33,17,6,1,54,51,50,22,23,62,2,51,51,38,38,35,34,6,21,20,23,7,
+38,53,53,38,38,35,34,6,7,6,6,7,22,22,51,50,54,53,52,38,35,34,7,16,195,254,
+245,64,59,255,0,197,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,
+62,67,10,12,143,27,147,128,96,130,35,99,1,11,156,215,174,10,37,112,88,171,
+182,254,197,178,176,122,54,240,226,165,154,63,253,117,219,181,57,69,102,79,
+59,117,135,1,187,111,251,114,49,46,149,203,53,44,153,220,185,174,5,102,89,
+81,82,3,147,4,78,165,103,127,211,132,55,223,193,65,247,200,208,225,194,175,
+67,22,126,122,124,124,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,
+45,39,29,82,78,121,135,100,100,118,123,93,11,41,41,193,181,83,34,85,126,84,
+159,185,60,47,253,96,131,117,62,109,61,104,57,65,42,55,17,1,147,30,3,166,
+7,104,104,75,98,48,88,99,61,51,11,19,18,29,21,20,44,41,101,238,171,169,5,
+156,150,184,166,149,156,0,3,0,58,253,233,10,194,6,177,0,101,0,113,0,127,0,
+0,5,34,38,39,6,6,35,34,38,39,6,6,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,
+34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,4,23,7,6,6,21,20,22,51,
+50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,0,17,16,
+7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,1,54,51,50,22,
+23,54,54,55,38,35,32,3,6,6,7,22,22,51,50,54,53,52,38,35,34,8,218,99,156,67,
+72,154,112,121,171,44,63,250,187,254,211,254,149,48,146,5,9,20,72,94,93,77,
+29,17,83,70,62,67,10,12,143,27,147,128,192,69,99,1,11,156,168,1,46,133,61,
+189,209,136,127,124,131,137,124,126,168,168,254,157,254,164,174,254,228,145,
+67,158,1,76,189,1,156,1,181,70,251,214,219,181,57,69,102,79,59,117,135,3,
+90,4,100,249,133,49,46,146,201,55,48,174,126,177,233,254,246,216,55,223,193,
+65,247,200,208,225,194,175,67,22,84,96,104,76,116,108,112,112,1,66,1,59,24,
+32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,200,118,123,
+130,130,140,11,218,175,157,169,143,158,14,14,152,149,1,35,1,36,1,172,1,178,
+75,89,134,91,83,254,4,254,19,254,239,175,252,225,131,117,62,109,61,104,57,
+65,42,55,17,1,101,64,44,92,3,166,7,101,101,104,127,23,143,254,173,171,169,
+5,156,150,184,166,149,156,0,3,0,58,253,233,10,118,6,177,0,97,0,122,0,136,
+0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,
+23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,
+20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,54,36,51,50,4,18,17,20,7,17,33,34,
+38,53,52,54,55,23,6,21,20,22,22,51,33,17,52,55,6,4,1,54,51,50,22,23,54,54,
+51,51,38,38,35,34,21,20,23,7,38,53,52,55,38,35,34,3,6,6,7,22,22,51,50,54,
+53,52,38,35,34,7,57,213,254,231,69,58,254,254,200,254,211,254,149,48,146,
+5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,96,130,35,99,1,
+11,156,158,138,75,127,166,180,247,176,185,92,1,5,230,217,1,47,155,163,254,
+210,186,158,254,238,146,68,143,1,76,173,240,1,113,194,80,252,39,219,181,57,
+69,102,79,59,117,135,3,9,4,102,254,203,251,18,49,46,145,200,55,60,251,180,
+146,5,100,85,157,5,144,9,8,97,125,253,217,55,223,193,65,247,200,208,225,194,
+175,67,22,128,129,129,128,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,
+30,45,39,29,82,78,121,135,100,100,118,123,51,51,191,183,83,66,124,96,180,
+207,179,1,81,216,228,1,65,164,76,89,135,85,89,205,254,126,254,246,241,191,
+252,65,131,117,62,109,61,104,57,65,42,55,17,1,165,88,96,115,117,3,166,7,100,
+99,104,108,89,98,121,19,24,24,50,35,41,26,31,254,173,171,169,5,156,150,184,
+166,149,156,0,1,0,15,253,233,4,183,4,230,0,94,0,0,5,34,38,39,38,39,6,7,39,
+62,2,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,6,7,
+6,7,22,23,30,2,51,50,54,53,52,38,39,53,52,54,51,50,22,21,20,7,39,54,53,52,
+38,35,34,6,7,22,18,21,20,7,17,33,34,38,53,52,54,55,23,6,21,20,22,22,51,33,
+17,52,55,6,2,242,112,203,138,47,44,26,16,146,2,42,73,80,79,70,39,66,60,57,
+60,8,144,13,146,118,127,151,45,85,97,31,26,37,117,82,86,100,57,148,157,221,
+212,166,147,127,132,13,145,10,61,63,65,81,8,208,229,66,253,56,219,181,57,
+69,102,79,59,117,135,1,248,7,104,22,66,88,30,15,62,126,30,65,139,142,130,
+129,134,134,61,82,84,63,54,32,33,23,42,60,111,127,156,137,79,169,158,151,
+49,48,12,64,46,38,23,159,155,171,188,4,31,224,198,123,116,48,53,23,31,30,
+63,58,93,94,30,254,255,202,165,112,253,67,131,117,62,109,61,104,57,65,42,
+55,17,1,31,89,52,55,0,3,0,44,253,242,8,4,4,230,0,84,0,110,0,111,0,0,1,16,
+0,35,34,4,7,54,51,32,0,21,20,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,
+6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,32,0,17,20,2,7,23,7,38,35,
+34,6,21,20,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,55,39,55,22,
+51,50,54,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,
+35,34,6,1,7,43,254,228,254,194,254,196,136,101,136,1,14,1,46,189,160,196,
+99,50,136,101,149,179,1,26,130,1,12,186,40,113,59,70,10,12,143,27,147,128,
+94,136,35,156,1,66,224,1,66,1,100,189,168,108,56,33,53,78,82,200,136,131,
+4,144,8,211,208,162,181,125,115,125,30,39,26,160,175,250,198,89,134,63,4,
+102,104,104,105,137,113,102,102,110,232,219,133,156,3,17,2,59,1,1,1,25,110,
+116,36,254,237,251,186,229,180,94,86,187,176,46,73,1,127,169,157,66,71,30,
+45,39,29,82,78,121,135,101,97,125,114,254,149,254,194,225,254,216,40,72,111,
+5,49,47,123,109,130,41,34,12,37,55,183,192,138,118,85,115,9,74,127,4,232,
+1,103,101,187,23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,253,
+11,0,3,0,74,253,233,6,180,6,177,0,101,0,111,0,112,0,0,5,34,39,6,7,39,54,18,
+53,52,38,35,34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,
+50,0,21,20,7,51,22,22,51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,0,17,16,7,
+17,35,38,38,35,34,6,7,6,6,35,34,38,38,53,52,54,55,23,6,21,20,22,51,50,54,
+55,62,2,51,50,22,23,38,53,53,52,55,6,6,37,22,51,50,54,53,52,38,35,34,1,5,
+4,197,51,58,70,109,135,118,194,179,136,206,113,21,136,165,120,143,154,143,
+129,201,108,151,1,20,181,250,1,13,87,40,5,60,71,124,147,254,132,254,138,183,
+254,199,146,68,198,1,69,192,1,186,1,206,70,113,157,192,105,58,126,90,151,
+160,89,78,132,70,58,68,102,79,75,71,58,117,111,114,92,106,61,107,203,111,
+2,5,49,104,251,235,73,131,77,75,67,59,121,1,28,22,170,85,85,96,147,1,7,146,
+168,198,119,223,148,109,71,153,137,105,124,135,136,243,146,189,1,32,157,254,
+243,226,185,175,79,80,1,37,1,35,1,173,1,177,81,84,135,98,76,254,0,254,23,
+254,234,183,252,238,98,65,29,35,58,41,59,111,76,66,109,59,104,60,66,54,56,
+30,43,44,30,18,67,65,31,76,121,126,64,42,36,230,92,57,60,48,61,3,144,0,2,
+0,78,253,242,6,244,4,230,0,84,0,85,0,0,1,52,2,35,34,6,7,54,51,50,22,21,20,
+6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,
+34,6,7,39,18,0,51,50,22,18,21,16,2,7,23,7,38,35,34,6,21,20,51,50,54,53,52,
+39,55,22,21,20,6,35,34,38,53,52,54,55,39,55,22,51,50,54,1,6,91,202,174,158,
+203,53,40,54,112,129,123,238,161,254,241,254,211,145,1,21,185,55,47,8,41,
+47,230,229,217,201,173,199,97,31,44,28,146,49,1,52,225,162,235,125,241,222,
+103,56,33,53,78,82,200,136,131,4,144,8,211,208,162,181,125,115,125,30,20,
+49,216,226,253,138,2,121,215,1,5,203,193,19,145,131,136,218,124,1,75,1,41,
+195,1,37,160,6,138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,65,1,
+71,148,254,228,189,254,249,254,187,36,69,111,5,49,47,123,109,130,41,34,12,
+37,55,183,192,138,118,85,115,9,74,127,4,255,254,116,0,1,0,62,253,233,6,77,
+4,230,0,138,0,0,5,34,39,39,54,53,52,38,35,34,6,21,20,23,7,6,35,34,38,53,16,
+55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,
+34,14,3,21,20,22,51,50,55,38,53,52,54,51,51,50,22,21,20,7,22,51,50,54,53,
+52,38,38,35,35,53,52,54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,51,32,0,21,
+20,7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,
+55,54,54,51,50,22,23,38,53,17,6,4,171,148,112,15,90,80,78,84,77,90,15,112,
+143,193,230,229,71,144,40,2,104,5,100,85,81,76,1,147,3,155,139,167,179,55,
+120,140,130,89,50,146,140,70,33,80,157,139,15,139,157,82,35,71,142,143,112,
+229,185,48,179,167,136,159,14,144,9,157,86,99,4,17,1,16,1,33,79,113,100,140,
+113,66,50,113,85,135,142,81,114,152,58,68,102,79,71,67,46,105,94,122,135,
+87,97,186,99,2,88,22,39,135,23,75,51,54,57,48,75,23,135,39,233,205,1,11,121,
+7,135,89,98,61,53,14,8,5,7,12,33,114,124,191,183,83,18,58,86,134,84,147,155,
+6,59,96,101,118,119,104,91,59,7,155,156,141,158,72,83,181,193,121,118,44,
+57,23,38,23,121,99,88,254,255,250,180,112,253,100,66,70,27,29,37,57,40,129,
+117,66,109,59,104,60,66,54,56,30,41,56,38,69,62,54,53,1,18,42,0,3,0,52,253,
+233,6,205,6,177,0,113,0,124,0,125,0,0,5,34,38,39,6,6,35,34,38,53,52,54,55,
+55,62,2,53,52,38,35,35,22,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,6,
+7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,
+36,51,32,0,17,16,7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,
+20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,55,6,1,6,6,21,20,22,51,50,
+54,53,52,1,4,217,103,161,68,67,166,113,189,221,203,238,71,82,75,38,174,177,
+6,21,22,143,108,114,129,242,230,242,243,79,155,122,189,161,136,129,139,135,
+138,128,131,173,174,254,146,254,153,172,254,209,146,67,160,1,85,196,1,168,
+1,191,70,113,107,147,120,69,49,112,105,144,158,86,119,157,58,68,102,79,74,
+70,56,110,107,107,95,102,60,106,197,107,2,5,108,251,227,88,82,53,51,54,52,
+1,31,22,86,94,99,81,211,185,166,203,70,21,24,31,49,42,72,67,33,80,35,111,
+118,122,101,135,154,139,137,83,98,72,31,48,151,121,122,128,141,160,14,14,
+152,149,1,35,1,36,1,172,1,178,78,86,134,90,84,254,2,254,21,254,242,174,252,
+221,67,70,26,23,41,58,41,128,118,66,109,59,104,60,66,54,56,29,43,43,32,18,
+68,64,54,53,185,89,58,99,4,107,13,72,48,48,54,55,49,79,254,133,0,2,0,77,253,
+242,8,56,4,230,0,98,0,99,0,0,1,52,2,35,34,6,7,54,51,50,22,21,20,0,35,34,38,
+2,53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,16,0,33,50,22,23,7,14,2,21,
+20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,0,17,16,2,7,23,7,38,35,34,6,
+21,20,51,50,54,54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,55,39,55,22,51,
+50,54,1,7,158,201,174,158,203,54,45,49,113,129,254,224,244,182,254,127,1,
+2,230,62,108,147,223,122,55,51,135,121,1,93,1,37,91,183,79,54,140,208,115,
+214,204,178,195,98,31,44,28,146,51,1,52,224,246,1,20,241,222,103,56,33,53,
+78,82,200,101,118,48,4,144,8,211,208,162,181,125,115,125,30,20,48,217,225,
+253,145,2,121,215,1,5,203,193,19,145,131,214,254,248,145,1,5,176,225,1,39,
+30,13,125,224,152,107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,
+206,218,179,154,140,14,22,45,1,68,1,68,254,178,254,225,254,249,254,187,36,
+69,111,5,49,47,123,57,103,79,41,34,12,37,55,183,192,138,118,85,115,9,74,127,
+4,255,254,116,0,1,0,62,253,233,6,59,6,177,0,99,0,0,5,34,36,38,53,52,54,55,
+6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,
+14,2,21,20,22,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,18,17,20,7,17,
+35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,54,
+54,51,50,22,23,38,53,17,52,55,6,4,2,227,207,254,222,142,99,94,70,111,50,2,
+229,6,100,85,79,78,1,146,3,155,139,167,179,177,172,160,129,60,255,235,221,
+1,57,168,169,254,199,194,168,254,228,148,67,1,51,1,105,247,1,124,202,80,114,
+126,176,106,47,107,90,138,142,76,113,150,58,68,102,79,69,67,39,97,106,121,
+133,85,92,181,100,2,5,108,254,196,22,127,219,140,116,173,51,7,135,89,98,59,
+55,13,7,7,7,23,22,114,124,193,181,83,26,84,126,85,166,186,171,1,80,225,230,
+1,63,164,77,88,135,174,204,254,126,254,245,237,188,252,58,85,78,27,39,61,
+36,129,117,66,109,59,104,60,66,53,57,23,48,56,38,67,64,32,78,1,21,124,72,
+122,122,0,5,0,74,253,233,6,69,6,177,0,101,0,114,0,123,0,124,0,125,0,0,5,34,
+36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,
+34,6,21,20,4,33,32,36,53,52,39,6,6,35,34,38,38,53,52,0,37,23,4,7,54,51,50,
+22,22,21,20,7,22,22,21,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,
+23,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,53,52,55,6,3,50,22,23,52,
+55,53,52,38,35,34,6,7,21,22,22,51,50,55,38,38,35,3,5,3,39,245,254,184,160,
+1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,199,177,1,48,1,24,1,38,
+1,57,13,45,137,91,78,128,83,1,110,1,63,60,254,194,170,53,57,88,123,62,11,
+48,48,79,115,124,171,100,42,100,97,129,143,80,110,150,58,68,102,79,70,63,
+47,107,85,118,131,83,92,174,96,2,5,192,114,89,150,61,1,85,82,79,101,12,4,
+69,92,125,44,46,147,101,253,3,71,22,129,239,168,208,210,90,97,121,23,38,23,
+48,54,114,124,193,181,83,142,149,178,204,206,187,65,42,71,70,68,171,138,254,
+1,168,121,129,115,191,30,81,150,103,74,57,52,137,86,166,117,253,2,87,76,23,
+42,57,41,128,117,66,110,59,104,60,67,53,56,31,40,56,38,66,65,34,79,195,89,
+60,118,3,186,26,26,9,8,18,107,107,105,92,135,75,104,118,30,31,3,148,198,0,
+5,0,74,253,233,6,18,6,177,0,103,0,116,0,121,0,122,0,123,0,0,5,34,36,38,53,
+52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,
+20,4,33,50,36,54,53,52,38,35,35,53,52,54,55,54,54,55,23,6,6,7,54,51,50,22,
+21,20,6,7,22,22,21,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,
+6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,55,6,19,7,20,30,2,51,
+50,53,52,38,35,34,7,38,39,6,7,3,5,3,39,245,254,184,160,1,9,1,4,31,5,99,85,
+157,9,144,14,155,140,167,179,176,199,177,1,48,1,24,194,1,8,129,178,198,177,
+90,90,35,246,190,61,148,190,42,26,18,119,146,56,55,86,86,79,116,104,176,104,
+48,101,85,142,136,71,110,147,58,68,102,79,68,63,39,96,101,89,90,91,56,90,
+169,94,3,4,186,11,1,8,23,45,32,81,71,65,34,115,26,10,28,3,216,3,11,22,129,
+239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,142,149,178,204,
+96,172,113,151,141,83,124,169,45,136,234,71,129,51,140,89,4,119,101,69,90,
+20,52,171,118,169,117,253,5,76,87,28,37,63,35,129,116,66,110,59,104,60,67,
+53,56,24,47,42,34,18,66,64,57,58,191,90,56,114,4,117,26,52,48,40,23,89,46,
+58,191,39,66,46,59,3,13,198,0,4,0,44,253,233,11,38,6,177,0,120,0,134,0,160,
+0,161,0,0,5,34,38,39,6,6,35,34,38,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,
+55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,36,51,32,5,7,14,2,21,
+20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,
+0,17,16,7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,
+50,54,55,62,2,51,50,22,23,38,53,53,52,55,6,1,54,51,50,22,23,54,54,55,38,38,
+35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,
+35,34,6,37,9,62,99,156,67,71,153,114,108,162,46,40,139,94,193,108,50,136,
+101,149,179,1,26,130,1,12,186,40,113,59,70,22,143,27,147,128,95,134,35,146,
+1,53,220,1,92,1,21,53,123,180,93,136,127,125,130,137,124,126,168,168,254,
+157,254,164,174,254,228,145,67,158,1,76,189,1,156,1,181,70,113,109,145,117,
+66,52,116,94,143,153,85,118,155,58,68,102,79,72,70,44,110,113,101,99,100,
+59,98,192,113,2,3,104,248,164,99,138,170,245,64,46,181,135,116,210,129,186,
+254,211,254,222,89,134,63,4,102,104,104,105,137,113,102,102,110,232,219,133,
+156,5,49,22,84,96,102,78,98,93,94,97,180,94,86,187,176,46,73,1,127,169,157,
+66,71,45,69,29,82,78,121,135,102,95,119,119,249,151,6,104,178,116,157,169,
+145,156,14,14,152,149,1,35,1,36,1,172,1,178,75,89,134,91,83,254,4,254,19,
+254,239,175,252,225,69,69,25,27,38,58,40,129,117,66,109,59,104,60,66,53,57,
+24,48,42,33,18,64,68,54,53,217,54,53,91,3,137,36,122,119,122,146,25,76,67,
+112,254,237,101,187,23,33,139,120,146,155,14,22,135,158,133,134,188,200,27,
+109,0,3,0,74,253,233,10,40,4,230,0,112,0,139,0,165,0,0,5,34,38,39,6,6,35,
+34,39,6,6,35,34,38,39,7,39,0,55,38,38,35,34,6,21,20,23,7,38,38,53,53,52,55,
+6,21,20,22,23,7,38,38,53,52,0,55,54,51,50,22,23,54,36,51,50,22,23,54,54,51,
+50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,35,38,38,35,34,6,7,6,6,35,
+34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,53,
+6,1,54,36,33,51,38,38,35,34,6,21,20,23,7,38,53,52,55,38,35,34,4,7,54,51,50,
+22,5,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,
+6,8,154,182,252,70,37,146,104,193,107,52,135,100,150,179,1,26,130,1,1,197,
+20,76,56,59,70,21,143,9,15,1,142,69,83,132,88,82,1,15,233,15,26,105,142,36,
+154,1,69,225,124,192,95,40,108,79,171,182,254,197,178,176,122,54,240,226,
+165,154,63,128,58,107,62,37,67,66,111,130,68,93,124,60,66,102,41,38,53,47,
+46,79,68,94,99,53,67,97,54,3,111,253,89,53,1,17,1,33,174,5,102,89,83,80,3,
+147,4,2,157,171,212,254,192,140,101,135,175,240,252,218,100,122,62,4,102,
+104,104,105,137,114,102,102,110,232,220,133,156,22,106,106,105,107,180,95,
+85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,26,104,41,9,5,5,122,245,118,
+199,117,78,130,252,138,240,1,68,17,4,99,98,124,114,35,37,38,34,193,181,83,
+34,85,126,84,159,185,60,47,253,96,81,82,23,36,60,44,131,109,68,115,57,104,
+31,63,39,49,54,31,40,55,39,49,57,65,64,215,30,2,196,114,132,88,99,63,49,11,
+19,18,29,21,33,12,60,109,122,36,117,75,113,175,23,33,137,122,146,155,14,22,
+135,158,133,134,187,201,27,0,2,0,77,253,233,9,34,4,230,0,108,0,134,0,0,5,
+34,36,39,6,6,35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,16,0,
+33,50,22,23,7,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,33,50,23,54,
+51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,35,38,38,35,34,6,7,6,6,
+35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,
+53,6,1,35,34,4,7,54,51,50,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,
+7,149,190,254,247,66,60,232,164,182,254,127,1,2,230,62,108,147,223,122,55,
+51,135,121,1,93,1,37,91,183,79,54,140,208,115,214,204,178,195,98,31,44,28,
+146,49,1,103,1,21,97,85,50,67,171,182,254,197,177,177,122,54,240,226,164,
+154,63,128,58,107,62,37,67,66,111,130,68,93,124,60,66,102,41,38,53,47,46,
+79,68,94,99,53,67,97,54,3,111,254,140,17,198,254,239,59,44,50,85,58,33,150,
+232,204,174,5,102,89,83,80,3,147,4,22,121,118,119,120,145,1,5,176,225,1,39,
+30,13,125,224,152,107,201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,
+206,218,179,154,140,14,22,45,1,64,1,72,12,12,193,181,83,34,84,127,84,159,
+185,60,47,253,96,81,82,23,36,60,44,131,109,68,115,57,104,31,63,39,49,54,31,
+40,55,39,49,57,65,64,215,30,4,120,208,200,18,55,79,116,60,88,99,63,49,18,
+12,18,29,21,73,0,5,0,74,253,233,7,36,6,177,0,114,0,127,0,132,0,133,0,134,
+0,0,5,32,0,17,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,55,6,17,20,23,7,
+38,38,53,52,18,36,51,51,50,22,22,21,21,35,34,6,21,20,4,33,32,36,53,52,38,
+35,35,53,52,54,55,54,54,55,23,6,6,7,54,51,50,22,21,20,6,7,22,22,21,20,7,17,
+35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,
+2,51,50,22,23,38,53,53,52,55,6,19,7,20,30,2,51,50,53,52,38,35,34,7,38,39,
+6,7,3,5,4,58,254,152,254,138,1,9,1,5,31,5,99,85,158,10,145,10,5,194,113,134,
+63,66,148,1,22,179,25,112,152,82,175,199,178,1,48,1,25,1,26,1,48,178,197,
+177,89,90,36,247,189,60,147,190,43,26,18,120,146,56,55,86,86,79,116,104,176,
+104,48,101,85,142,136,71,110,147,58,68,102,79,68,63,39,96,101,89,90,91,56,
+90,169,94,3,4,186,11,1,7,24,45,32,81,72,64,34,116,27,8,29,3,190,2,237,22,
+1,20,1,4,207,211,90,97,121,22,39,23,38,62,30,18,123,254,211,234,161,73,104,
+245,127,187,1,19,146,85,164,125,83,141,150,178,204,202,179,151,141,83,124,
+168,45,138,234,70,129,51,140,89,4,119,101,69,90,20,52,171,118,169,117,253,
+5,76,87,28,37,63,35,129,116,66,110,59,104,60,67,53,56,24,47,42,34,18,66,64,
+57,58,191,90,56,114,4,117,26,52,48,40,23,89,45,59,191,46,58,44,60,3,13,198,
+0,2,0,74,253,233,6,13,6,177,0,77,0,78,0,0,5,34,36,38,53,52,0,33,50,23,7,38,
+35,34,6,21,20,22,51,50,36,18,53,52,2,36,35,32,5,39,36,33,50,4,18,17,20,7,
+17,35,38,38,35,34,6,7,6,6,35,34,38,38,53,52,54,55,23,6,21,20,22,51,50,54,
+55,54,54,51,50,22,23,38,53,17,52,55,6,4,1,2,207,214,254,222,141,1,60,1,16,
+121,97,13,92,111,210,230,250,244,216,1,49,156,162,254,209,188,254,203,254,
+239,67,1,59,1,87,235,1,110,197,81,116,106,176,103,42,98,95,131,139,79,70,
+121,67,58,68,102,79,69,62,49,99,88,117,130,81,91,171,92,3,5,105,254,209,254,
+104,22,127,228,154,247,1,5,14,141,14,188,179,176,187,178,1,82,216,228,1,63,
+166,165,135,174,204,254,128,254,243,244,188,252,65,77,86,23,42,58,40,58,111,
+76,66,110,59,104,60,67,53,56,30,41,55,39,67,63,57,57,1,39,118,44,117,116,
+4,252,0,4,0,74,253,233,6,130,6,177,0,95,0,105,0,106,0,107,0,0,5,34,38,39,
+6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,
+21,20,22,51,50,54,54,53,16,39,6,6,35,34,38,53,52,38,39,39,55,4,0,17,20,7,
+17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,
+2,51,50,22,23,38,53,53,52,55,6,3,38,39,22,23,22,22,51,50,54,1,3,4,155,112,
+167,69,74,158,116,188,221,143,1,14,183,111,115,14,87,117,217,237,141,132,
+132,133,138,136,137,116,149,73,168,41,135,79,119,123,18,37,5,53,1,164,1,151,
+75,113,109,145,117,66,52,116,94,143,153,85,118,155,58,68,102,79,72,70,44,
+110,113,101,99,100,59,98,192,113,2,2,102,87,116,180,22,5,4,52,55,51,75,254,
+52,100,22,83,97,103,77,255,230,153,245,134,14,139,13,213,192,157,169,147,
+154,14,14,157,144,115,229,175,1,99,226,72,81,144,144,113,90,23,2,126,138,
+253,230,254,115,251,159,253,3,69,69,25,27,38,58,40,129,117,66,109,59,104,
+60,66,53,57,24,48,42,33,18,64,68,54,53,217,69,28,81,5,63,112,84,49,113,87,
+62,53,1,58,254,193,0,1,0,62,253,233,6,150,6,177,0,111,0,0,5,34,38,39,6,6,
+35,34,38,53,16,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,
+50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,
+0,33,34,4,7,39,36,33,32,4,18,17,16,7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,
+52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,55,6,4,161,
+103,159,67,76,161,112,190,229,229,71,144,40,2,136,5,100,85,79,78,1,147,3,
+155,140,165,181,55,157,166,153,86,146,129,136,138,137,128,131,173,175,254,
+144,254,145,168,254,217,163,67,1,61,1,126,1,32,1,139,201,70,113,107,147,120,
+69,49,112,105,144,158,86,119,157,58,68,102,79,74,70,56,110,107,107,95,102,
+60,106,197,107,2,5,107,22,85,95,104,76,236,204,1,9,121,7,135,89,98,59,55,
+14,8,5,7,23,22,114,124,190,183,84,25,86,157,111,139,155,146,155,14,14,153,
+148,1,37,1,34,1,175,1,175,74,91,135,174,229,254,66,254,186,254,243,174,252,
+220,67,70,26,23,41,58,41,128,118,66,109,59,104,60,66,54,56,29,43,43,32,18,
+68,64,54,53,185,73,72,97,0,3,0,62,253,233,6,155,6,177,0,118,0,128,0,129,0,
+0,5,34,38,39,6,6,35,34,38,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,
+20,23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,
+21,20,22,51,50,18,17,52,2,39,6,6,35,34,38,53,52,38,39,34,39,55,4,0,17,20,
+7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,
+62,2,51,50,22,23,38,53,53,52,55,6,3,38,39,22,23,22,22,51,50,54,1,4,180,113,
+168,67,76,161,112,120,189,110,117,114,66,151,40,2,136,5,100,85,81,76,1,147,
+3,155,140,165,181,60,151,166,154,86,146,129,136,138,137,135,139,172,166,84,
+84,40,134,80,117,126,18,37,2,3,53,1,164,1,151,75,113,107,147,120,69,49,112,
+105,144,158,86,119,157,58,68,102,79,74,70,56,110,107,107,95,102,60,106,197,
+107,2,4,101,89,119,177,22,5,4,52,55,54,74,254,64,22,84,96,104,76,101,200,
+139,130,198,59,8,135,89,98,61,53,14,8,5,7,23,22,114,124,190,183,84,24,87,
+157,111,139,155,146,155,14,14,156,145,1,3,1,4,178,1,34,112,71,81,141,147,
+115,88,23,2,126,138,253,230,254,115,251,158,253,2,67,70,26,23,41,58,41,128,
+118,66,109,59,104,60,66,54,56,29,43,43,32,18,68,64,54,53,185,82,49,83,5,62,
+115,81,49,112,87,62,56,1,55,0,6,0,10,253,233,9,85,6,177,0,103,0,112,0,140,
+0,152,0,153,0,154,0,0,5,34,38,39,55,22,22,51,50,54,54,53,52,38,35,34,6,21,
+21,35,53,52,38,35,34,7,22,21,20,2,4,35,34,36,39,7,39,1,38,53,52,54,36,51,
+50,23,54,1,23,1,22,23,54,51,50,22,23,54,54,51,50,18,17,20,7,17,35,38,38,35,
+34,6,7,14,2,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,54,54,51,50,22,
+23,38,53,53,52,55,6,1,54,1,38,35,34,6,21,20,3,22,22,51,50,54,54,53,52,38,
+39,0,1,22,23,38,53,52,54,51,50,22,21,20,6,35,32,39,5,51,50,54,53,52,38,35,
+34,6,21,20,1,1,7,216,122,185,56,141,41,103,76,89,99,40,103,103,90,93,136,
+70,70,65,42,51,168,254,195,207,200,254,211,141,58,111,1,26,58,144,1,5,169,
+100,88,221,1,47,99,254,46,147,91,72,96,67,105,39,39,137,97,172,174,74,113,
+173,213,120,75,147,90,134,127,137,66,131,170,58,68,102,79,82,77,77,135,134,
+154,166,96,125,236,119,2,5,70,249,87,176,1,32,24,25,189,243,102,119,251,162,
+166,250,137,168,161,254,212,254,253,68,111,28,132,114,117,135,183,151,255,
+0,155,1,165,7,73,99,55,54,50,55,3,87,249,199,22,138,136,57,102,88,98,190,
+157,220,213,132,158,13,12,132,105,48,124,157,198,254,225,151,130,146,64,99,
+1,28,106,129,126,206,114,14,204,1,13,113,254,105,57,116,63,60,60,87,88,254,
+215,254,217,247,144,253,78,98,65,29,31,45,36,22,128,118,66,109,59,104,60,
+66,53,57,30,45,53,37,70,65,32,76,152,71,46,34,2,185,171,1,13,2,174,136,84,
+254,147,122,112,114,222,152,176,245,52,254,242,254,255,62,25,60,64,98,120,
+127,109,117,139,142,9,59,61,50,57,53,50,73,4,44,251,37,0,1,0,74,253,233,7,
+174,6,177,0,129,0,0,5,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,
+38,35,34,6,21,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,2,53,52,18,36,51,50,
+23,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,20,22,51,50,
+18,17,16,0,33,34,4,7,39,36,33,50,4,22,18,21,16,7,17,35,46,2,35,34,6,7,6,6,
+35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,
+52,55,6,5,185,103,159,67,76,161,112,190,229,113,110,70,139,19,2,146,5,100,
+85,79,78,1,147,3,13,152,162,113,134,60,69,150,1,32,190,53,25,20,20,167,179,
+91,151,166,154,86,146,129,139,135,137,128,131,173,175,254,144,254,145,168,
+254,217,163,67,1,61,1,126,208,1,69,231,120,70,113,107,147,120,69,49,112,105,
+144,158,86,119,157,58,68,102,79,74,70,56,110,107,107,95,102,60,106,197,107,
+2,5,108,22,85,95,104,76,236,204,129,196,61,7,135,89,98,59,55,14,8,5,7,23,
+22,51,35,42,239,183,235,161,72,95,1,1,123,185,1,20,148,2,2,192,181,84,24,
+87,157,111,139,155,149,152,14,14,153,148,1,37,1,34,1,175,1,175,74,91,135,
+174,121,247,254,132,253,254,242,173,252,220,67,70,26,23,41,58,41,128,118,
+66,109,59,104,60,66,54,56,29,43,43,32,18,68,64,54,53,185,73,71,96,0,3,0,44,
+253,242,7,107,4,230,0,80,0,97,0,98,0,0,1,52,0,35,34,4,7,54,51,50,22,21,20,
+4,33,34,36,53,53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,
+54,36,51,50,4,18,21,20,2,7,23,7,38,35,34,6,21,20,51,50,54,53,52,39,55,22,
+21,20,6,35,34,38,53,52,54,55,39,55,22,51,50,54,1,6,7,23,6,21,20,22,51,50,
+54,53,52,38,35,34,6,1,6,178,254,233,244,141,254,234,124,83,113,229,254,254,
+224,254,231,240,254,242,74,130,1,5,190,39,111,59,70,10,12,143,27,147,128,
+184,77,149,1,36,156,208,1,46,157,203,185,106,56,33,53,78,82,200,136,131,4,
+144,8,211,208,162,181,125,115,125,30,39,25,179,189,251,50,88,71,70,12,194,
+186,208,206,191,178,90,150,2,87,2,86,243,1,12,111,107,28,234,217,239,251,
+215,203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,121,135,187,119,109,
+162,254,208,201,233,254,209,41,70,111,5,49,47,123,109,130,41,34,12,37,55,
+183,192,138,118,85,115,9,74,127,4,240,1,87,102,98,5,44,56,143,147,177,164,
+154,160,27,253,11,0,4,0,74,253,233,6,32,6,177,0,79,0,88,0,89,0,90,0,0,5,32,
+0,53,52,0,33,50,23,7,38,35,34,6,21,20,22,51,50,36,18,53,52,39,6,6,35,34,38,
+53,52,38,39,39,55,22,0,18,21,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,53,52,
+54,55,23,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,17,52,55,6,4,1,38,
+39,22,23,22,22,51,50,1,3,2,222,254,192,254,172,1,72,1,27,126,100,12,98,116,
+220,241,255,247,221,1,53,158,86,44,122,69,119,123,16,40,7,51,243,1,73,157,
+79,115,115,177,105,45,105,89,142,139,72,110,150,58,68,102,79,70,64,47,107,
+85,118,131,84,89,171,103,2,5,101,254,198,1,64,106,179,21,5,4,52,55,94,254,
+99,183,22,1,11,242,246,1,6,14,141,14,188,179,178,185,175,1,75,208,200,154,
+59,62,144,144,111,93,23,3,124,77,254,245,254,174,192,233,184,252,67,81,82,
+25,40,63,35,128,117,66,110,59,104,60,67,53,56,31,40,55,39,63,67,33,78,1,29,
+107,68,114,119,5,44,124,89,52,108,87,62,1,111,254,193,0,1,0,72,253,233,4,
+99,4,230,0,76,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,35,38,38,35,34,6,
+7,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,54,54,51,50,22,23,
+38,53,53,6,2,193,254,215,254,178,96,182,235,183,204,5,102,89,81,81,2,147,
+4,158,143,170,182,254,179,188,186,127,57,254,238,188,150,64,128,58,107,62,
+37,67,66,111,130,68,93,124,60,66,102,41,38,53,47,46,79,68,94,99,53,67,97,
+54,3,117,22,1,6,237,122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,192,
+182,83,34,84,127,84,159,185,61,47,253,95,81,82,23,36,60,44,131,109,68,115,
+57,104,31,63,39,49,54,31,40,55,39,49,57,65,64,213,28,0,2,0,74,253,233,6,125,
+6,177,0,93,0,94,0,0,5,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,
+34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,
+36,51,32,4,18,17,16,7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,
+21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,55,6,6,1,4,137,103,161,
+68,75,157,114,188,221,143,1,14,183,111,115,14,87,117,217,237,141,132,132,
+133,138,128,131,173,174,254,146,254,153,172,254,209,146,67,160,1,85,196,1,
+16,1,133,210,70,113,109,145,117,66,52,116,94,143,153,85,118,155,58,68,102,
+79,72,70,44,110,113,101,99,100,59,98,192,113,2,4,51,149,253,30,22,86,94,105,
+75,255,230,153,245,134,14,139,13,213,192,157,169,147,154,14,14,152,149,1,
+35,1,36,1,172,1,178,78,86,134,90,84,215,254,64,254,174,254,242,174,252,221,
+69,69,25,27,38,58,40,129,117,66,109,59,104,60,66,53,57,24,48,42,33,18,64,
+68,54,53,217,70,41,45,50,4,252,0,2,0,58,253,233,7,107,4,230,0,97,0,111,0,
+0,5,34,39,55,22,51,50,54,53,52,0,35,32,7,54,51,50,22,21,20,0,33,32,0,3,55,
+22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,
+51,50,4,18,21,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,
+20,22,51,50,54,55,54,54,51,50,22,23,38,53,53,52,55,6,1,6,6,7,22,22,51,50,
+54,53,52,38,35,34,5,115,64,33,8,44,27,178,190,254,225,246,254,247,166,49,
+46,228,254,254,211,254,225,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,
+83,70,62,67,10,12,143,27,147,128,192,69,99,1,12,158,207,1,54,165,79,113,140,
+221,132,64,139,100,169,183,96,129,167,58,68,102,79,80,76,69,135,127,151,163,
+91,122,227,117,2,6,112,252,192,57,223,191,65,247,200,208,225,194,175,69,5,
+6,138,3,238,215,242,1,22,197,7,234,217,227,254,249,1,66,1,59,24,32,36,1,17,
+55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,200,118,123,159,254,210,
+201,203,147,252,247,82,81,26,35,59,43,128,118,66,109,59,104,60,66,54,56,29,
+45,54,37,70,64,31,76,210,64,68,90,3,12,173,167,5,156,150,184,166,149,156,
+0,1,0,74,253,233,5,62,4,230,0,93,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,
+6,21,20,23,7,38,53,52,55,34,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,
+50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,35,38,38,35,34,6,7,6,6,35,
+34,38,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,
+53,6,3,175,254,228,254,192,77,154,214,214,195,5,104,88,82,80,2,146,5,26,233,
+254,105,137,56,62,150,1,32,190,110,63,43,68,169,183,254,197,179,177,119,54,
+240,226,165,154,63,128,62,111,63,37,68,69,109,133,70,55,100,64,60,66,102,
+41,38,54,48,46,77,72,97,100,54,69,101,57,3,113,22,1,6,237,109,172,118,56,
+89,98,62,50,18,12,18,30,20,71,44,255,231,221,180,67,102,247,126,185,1,20,
+148,11,11,190,184,83,34,85,126,84,159,185,60,47,253,96,84,79,23,36,59,45,
+52,109,79,68,115,57,104,31,63,39,48,55,29,42,56,38,50,61,66,66,216,29,0,1,
+0,74,253,233,6,8,4,230,0,101,0,0,5,34,36,38,53,52,36,33,51,38,38,35,34,21,
+20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,38,35,
+35,53,52,54,51,50,22,21,20,7,39,54,53,52,35,34,6,7,51,32,17,20,7,17,35,38,
+38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,
+22,23,38,53,53,52,55,6,3,39,245,254,184,160,1,9,1,4,31,5,99,85,157,9,144,
+14,155,140,167,179,176,200,176,1,43,1,29,201,1,8,122,178,198,177,179,168,
+138,156,13,145,9,157,86,99,4,31,2,13,79,116,104,176,104,48,101,85,142,136,
+71,110,147,58,68,102,79,68,63,39,96,101,89,90,91,56,90,169,94,3,4,186,22,
+129,239,168,208,210,90,97,121,23,38,23,48,54,114,124,193,181,83,140,147,183,
+203,99,172,114,149,139,83,181,193,124,115,48,53,23,38,23,121,99,88,254,94,
+169,117,253,5,76,87,28,37,63,35,129,116,66,110,59,104,60,67,53,56,24,47,42,
+34,18,66,64,57,58,191,90,56,114,0,3,0,74,253,233,6,54,6,177,0,94,0,104,0,
+105,0,0,5,32,0,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,
+21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,
+55,4,0,17,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,38,53,52,54,55,23,6,21,
+20,22,51,50,54,55,54,54,51,50,22,23,38,53,17,52,55,6,4,1,38,39,22,23,22,22,
+51,50,54,1,2,224,254,203,254,159,1,39,1,7,123,5,99,85,157,5,145,9,155,139,
+168,179,225,171,187,94,1,16,240,222,1,57,165,87,43,120,71,116,126,16,40,7,
+51,1,100,1,117,80,114,126,176,106,47,107,90,138,142,76,72,123,68,58,68,102,
+79,69,67,40,96,106,121,133,85,92,181,100,2,3,104,254,192,1,76,109,176,21,
+5,4,52,55,47,71,254,73,22,1,31,248,191,228,90,97,121,19,24,24,50,35,114,124,
+192,182,83,64,125,97,180,207,166,1,67,214,207,157,57,63,141,147,111,93,23,
+3,124,114,254,49,254,194,223,181,252,75,85,78,27,39,61,36,58,110,78,66,109,
+59,104,60,66,53,57,23,48,56,38,67,64,32,78,1,46,81,80,116,118,5,43,127,87,
+52,108,87,62,44,1,67,0,3,0,74,253,233,6,161,6,177,0,108,0,118,0,119,0,0,5,
+34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,6,21,20,23,54,51,50,22,21,20,
+6,35,34,38,38,53,52,18,36,51,50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,18,53,
+52,2,36,35,34,4,7,39,36,33,32,4,18,17,16,7,17,35,46,2,35,34,6,7,6,6,35,34,
+38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,55,
+6,37,22,51,50,54,53,52,38,35,34,1,4,136,97,127,54,27,38,34,24,172,154,136,
+206,113,21,136,165,120,143,154,143,129,201,108,148,1,25,185,219,250,17,26,
+32,31,22,71,65,101,172,104,174,254,182,227,183,254,196,147,68,1,78,1,129,
+1,18,1,140,211,75,113,113,151,116,67,51,116,101,152,154,86,119,158,58,68,
+102,79,75,70,59,115,103,106,97,103,61,107,201,105,2,6,126,251,231,73,131,
+80,72,68,58,123,1,30,22,77,117,67,53,98,90,80,102,52,134,148,119,223,148,
+109,71,153,137,105,124,135,136,243,146,186,1,33,159,222,180,52,95,76,76,74,
+76,37,64,66,152,1,45,205,245,1,105,186,82,83,135,174,220,254,89,254,223,255,
+0,192,252,156,71,68,24,25,39,59,40,128,118,66,109,59,104,60,66,54,56,30,42,
+43,32,18,69,63,54,53,209,83,79,138,230,92,59,57,49,61,3,144,0,2,0,62,253,
+242,7,108,4,230,0,104,0,105,0,0,1,52,2,35,34,6,7,54,51,50,22,21,20,6,4,35,
+32,0,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,38,53,52,54,51,
+50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,0,
+17,16,2,7,23,7,38,35,34,6,21,20,51,50,54,53,52,39,55,22,21,20,6,35,34,38,
+53,52,54,55,39,55,22,51,50,54,1,6,210,200,175,156,204,55,40,54,113,128,137,
+254,242,193,254,241,254,191,84,82,72,99,32,2,81,5,99,85,81,76,1,147,3,155,
+139,166,181,106,152,147,98,50,235,209,216,234,98,32,43,28,146,51,1,52,224,
+246,1,20,241,223,103,56,33,53,78,82,200,136,131,4,144,8,211,208,162,181,125,
+115,125,30,20,49,217,225,253,125,2,121,217,1,3,199,196,18,145,133,137,219,
+120,1,15,224,105,169,56,6,135,90,97,61,53,14,8,5,7,12,33,114,124,190,184,
+83,35,77,110,81,171,199,180,164,129,13,23,45,1,68,1,68,254,178,254,225,254,
+250,254,186,36,69,111,5,49,47,123,109,130,41,34,12,37,55,183,192,138,118,
+85,115,9,74,127,4,255,254,116,0,3,0,79,253,233,6,132,6,177,0,110,0,121,0,
+122,0,0,5,34,36,2,53,52,18,51,50,22,22,21,20,7,6,21,20,51,50,55,6,35,34,38,
+53,52,54,51,50,30,2,21,20,6,35,34,38,53,52,55,54,53,52,35,34,6,6,21,16,0,
+33,32,0,17,52,2,36,35,34,4,7,39,36,33,32,4,18,17,20,7,17,35,46,2,35,34,6,
+7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,
+53,17,52,55,6,4,19,38,38,35,34,6,21,20,22,51,50,3,3,51,227,254,179,180,204,
+164,65,81,29,10,11,231,218,41,77,103,110,126,142,127,57,103,86,49,219,187,
+183,193,10,9,59,54,86,50,1,55,1,30,1,82,1,96,171,254,187,211,176,254,223,
+171,65,1,70,1,119,1,2,1,137,210,80,113,112,146,114,65,53,118,90,143,151,85,
+118,155,58,68,102,79,72,70,46,115,105,130,139,89,98,191,113,2,4,103,254,193,
+73,11,81,62,62,60,61,53,92,157,22,163,1,61,215,235,1,15,53,72,35,37,70,71,
+52,186,170,47,121,104,100,128,36,80,130,87,172,205,166,147,43,64,63,21,71,
+85,163,109,254,242,254,219,1,114,1,88,236,1,71,168,73,97,135,179,205,254,
+117,254,233,245,181,252,81,71,68,24,28,37,58,40,129,117,66,109,59,104,60,
+66,53,57,27,45,55,38,64,68,54,53,1,26,125,52,112,114,3,149,74,79,51,46,47,
+52,1,146,0,3,0,83,253,233,6,191,6,177,0,139,0,150,0,151,0,0,5,34,39,39,54,
+53,52,38,35,34,6,21,20,23,7,6,35,34,0,17,52,18,54,51,50,22,21,20,7,6,21,20,
+51,50,55,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,38,53,52,55,54,53,
+52,35,34,6,6,21,20,18,51,51,22,51,50,55,38,53,52,54,51,51,50,22,21,20,7,51,
+50,18,17,16,0,33,34,4,7,39,36,33,32,4,18,17,20,7,17,35,38,38,35,34,6,7,6,
+6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,
+52,55,6,1,38,38,35,34,6,21,20,22,51,50,3,4,135,140,73,14,89,80,78,79,81,89,
+14,77,87,244,254,225,98,178,108,86,91,10,11,231,218,41,77,103,110,126,142,
+127,131,164,219,187,134,169,73,10,9,60,50,97,58,199,175,10,1,2,3,4,69,150,
+142,27,138,151,69,58,201,218,254,142,254,177,189,254,209,178,65,1,77,1,141,
+1,12,1,136,203,69,113,159,193,105,56,125,96,153,166,86,121,160,58,68,102,
+79,75,72,59,121,110,116,91,108,61,111,210,104,2,5,135,254,249,11,81,62,58,
+64,61,53,92,179,21,23,135,23,75,52,53,54,51,75,23,135,24,1,82,1,41,173,1,
+0,137,91,69,37,70,71,52,186,170,47,121,104,100,128,174,159,172,205,86,140,
+87,43,64,63,21,71,105,195,124,236,254,244,1,1,57,89,97,104,104,97,88,58,1,
+81,1,46,1,146,1,156,73,99,135,181,222,254,81,254,201,240,176,252,156,98,65,
+27,36,58,42,128,118,66,109,59,104,60,66,53,57,30,43,44,30,18,72,61,32,76,
+223,76,78,143,3,148,74,79,48,49,47,52,1,146,0,1,0,74,253,233,6,52,4,230,0,
+104,0,0,5,34,38,39,6,6,35,34,38,53,52,54,36,51,50,23,7,38,35,34,6,21,20,22,
+51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,38,35,35,53,52,54,51,50,22,21,
+20,7,39,54,53,52,35,34,6,7,51,32,4,21,20,7,17,35,38,38,35,34,6,7,6,6,35,34,
+38,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,
+55,6,4,155,112,167,69,75,158,115,188,221,140,1,5,174,61,37,11,28,51,203,230,
+141,132,132,133,138,136,138,129,135,105,223,198,55,179,167,136,159,14,144,
+9,157,86,99,4,23,1,29,1,21,79,114,128,176,104,46,108,90,142,139,74,72,123,
+68,58,68,102,79,69,67,39,97,106,92,92,96,58,93,182,98,2,4,86,22,83,97,104,
+76,255,230,152,246,134,6,139,5,217,188,157,169,147,154,14,14,158,143,162,
+160,145,145,61,84,181,192,121,118,44,57,23,38,23,121,99,88,245,242,183,119,
+253,90,87,76,27,39,63,34,58,110,78,66,109,59,104,60,66,53,57,23,48,42,34,
+18,68,63,32,78,159,67,43,40,0,2,0,74,253,233,6,121,4,230,0,86,0,87,0,0,5,
+34,36,2,53,52,18,36,33,32,4,21,20,6,35,34,38,53,52,55,33,53,33,21,33,6,21,
+20,51,50,54,53,52,36,33,34,4,2,21,20,0,33,50,36,55,23,17,35,46,2,35,34,6,
+7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,
+53,53,52,55,6,4,37,3,46,231,254,177,174,213,1,150,1,15,1,86,1,95,230,207,
+176,179,11,254,202,2,252,254,213,16,203,139,146,254,247,254,248,240,254,176,
+170,1,53,1,20,236,1,32,115,139,113,109,145,117,66,52,116,94,143,153,85,118,
+155,58,68,102,79,72,70,44,110,113,101,99,100,59,98,192,113,2,8,134,254,211,
+254,179,148,163,1,43,201,221,1,79,183,246,232,173,203,142,139,35,36,137,137,
+30,38,143,122,111,175,165,147,254,242,181,245,254,241,109,101,63,253,86,69,
+69,25,27,38,58,40,129,117,66,109,59,104,60,66,53,57,24,48,42,33,18,64,68,
+54,53,99,89,90,94,77,126,0,1,0,74,253,233,6,54,6,177,0,95,0,0,5,34,36,38,
+53,52,54,54,51,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,
+6,6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,22,18,21,20,7,
+17,35,38,38,35,34,6,7,6,6,35,34,38,38,53,52,54,55,23,6,21,20,22,51,50,54,
+55,54,54,51,50,22,23,38,53,17,52,55,6,4,2,222,205,254,213,156,132,250,214,
+127,5,100,85,157,6,145,9,155,139,166,180,254,246,175,185,92,1,15,239,221,
+1,57,168,168,254,198,194,164,254,222,146,67,1,56,1,100,167,1,36,236,134,80,
+114,126,176,106,47,107,90,138,142,76,72,123,68,58,68,102,79,69,67,39,97,106,
+121,133,85,92,181,100,2,5,101,254,186,22,131,241,163,125,190,104,89,98,121,
+19,24,24,50,35,114,124,191,183,83,65,125,96,181,206,171,1,80,225,229,1,63,
+165,79,86,135,174,97,207,254,178,219,236,188,252,57,85,78,27,39,61,36,58,
+110,78,66,109,59,104,60,66,53,57,23,48,56,38,67,64,32,78,1,21,123,72,119,
+124,0,3,0,78,253,242,7,8,4,230,0,91,0,104,0,105,0,0,1,52,54,51,50,23,53,52,
+38,35,34,6,7,54,51,50,22,21,20,6,6,35,32,0,17,52,18,36,51,50,23,7,38,35,34,
+2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,22,18,21,20,2,7,23,7,38,
+35,34,21,20,51,50,54,53,52,39,55,22,21,20,6,35,34,38,53,52,54,55,39,55,54,
+54,53,52,39,38,23,54,55,38,35,34,6,21,20,23,22,21,20,5,4,197,139,112,98,76,
+211,170,170,201,57,47,47,112,129,123,238,161,254,241,254,211,145,1,21,185,
+55,47,8,41,47,230,229,217,201,173,199,97,31,44,28,146,52,1,50,249,159,232,
+126,212,199,94,56,33,53,160,200,138,129,4,144,8,212,207,163,180,136,131,132,
+15,21,49,16,17,156,208,45,65,80,58,61,8,8,254,219,1,178,122,130,48,19,208,
+244,202,194,19,145,131,136,218,124,1,75,1,41,195,1,37,160,6,138,3,254,253,
+254,254,222,250,182,153,138,14,22,45,1,64,1,72,143,254,237,183,213,254,193,
+93,88,111,5,98,121,109,129,41,35,12,38,55,183,191,137,116,93,116,8,129,6,
+8,47,45,41,84,85,212,114,207,53,68,64,27,57,56,46,27,226,0,3,0,74,253,233,
+6,8,4,230,0,113,0,125,0,139,0,0,5,34,36,38,53,52,36,33,51,38,38,35,34,21,
+20,23,7,38,53,52,54,51,50,22,21,21,35,34,6,21,20,4,33,50,36,54,53,52,39,6,
+7,22,21,20,6,35,34,38,38,53,52,54,54,51,51,50,54,55,38,35,35,53,52,54,51,
+50,22,21,20,7,22,22,21,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,
+23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,55,6,3,50,22,23,54,
+53,52,38,35,34,6,7,19,6,35,35,34,6,21,20,22,51,50,54,53,52,3,39,245,254,184,
+160,1,9,1,4,31,5,99,85,157,9,144,14,155,140,167,179,176,200,176,1,43,1,29,
+201,1,8,122,53,79,108,27,190,192,132,171,79,75,148,132,94,140,167,57,79,133,
+177,176,162,149,151,44,54,54,79,116,104,176,104,48,101,85,142,136,71,110,
+147,58,68,102,79,68,63,39,96,101,89,90,91,56,90,169,94,3,4,186,116,90,149,
+60,16,83,74,86,99,4,34,69,102,102,114,78,123,125,119,119,22,129,239,168,208,
+210,90,97,121,23,38,23,48,54,114,124,193,181,83,140,147,183,203,99,172,114,
+116,66,72,35,49,60,115,109,55,98,68,78,82,39,50,46,30,83,181,193,143,131,
+95,79,52,146,94,169,117,253,5,76,87,28,37,63,35,129,116,66,110,59,104,60,
+67,53,56,24,47,42,34,18,66,64,57,58,191,90,56,114,3,186,25,25,37,44,76,80,
+99,88,254,134,10,38,42,48,38,41,60,44,0,1,0,62,253,233,6,77,4,230,0,125,0,
+0,5,34,38,39,6,6,35,34,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,
+23,7,38,53,52,54,51,50,22,21,21,35,34,14,2,21,20,22,51,50,54,53,53,51,21,
+20,22,51,50,54,53,52,38,38,35,35,53,52,54,51,50,22,21,20,7,39,54,53,52,35,
+34,6,7,51,50,22,22,21,20,7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,
+23,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,53,52,55,6,4,180,113,168,
+67,76,161,112,189,230,117,113,56,160,40,2,104,5,100,85,81,76,1,147,3,155,
+139,167,179,39,147,162,152,84,145,130,136,138,137,135,140,129,135,114,229,
+183,48,179,167,136,159,14,144,9,157,86,99,4,17,181,253,127,79,113,100,140,
+113,66,50,113,85,135,142,81,114,152,58,68,102,79,71,67,46,105,94,122,135,
+87,97,186,99,2,5,87,22,84,96,104,76,237,203,130,197,59,7,135,89,98,61,53,
+14,8,5,7,12,33,114,124,191,183,83,26,87,156,110,140,154,146,155,14,14,156,
+145,163,159,144,147,60,83,181,193,121,118,44,57,23,38,23,121,99,88,110,218,
+159,183,119,253,90,66,70,27,29,37,57,40,129,117,66,109,59,104,60,66,54,56,
+30,41,56,38,69,62,54,53,133,109,30,40,0,1,0,74,253,233,7,83,4,230,0,112,0,
+0,5,34,39,55,22,51,50,54,54,53,52,2,35,34,6,7,54,51,50,22,21,20,6,4,35,34,
+36,38,53,52,36,33,51,38,38,35,34,21,20,23,7,38,53,52,54,51,50,22,21,21,35,
+34,6,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,50,0,17,20,7,17,35,46,2,
+35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,54,54,51,50,
+22,23,38,53,53,52,55,6,5,18,57,54,8,44,40,150,198,94,199,176,157,203,54,44,
+49,114,128,141,254,243,190,179,254,244,146,1,9,1,1,34,5,99,85,157,9,144,14,
+155,140,167,179,176,197,179,239,205,212,237,98,32,43,28,145,49,1,52,225,247,
+1,19,75,113,122,166,134,78,69,144,94,171,189,97,130,168,58,68,102,79,80,77,
+72,140,127,154,162,95,124,233,116,2,6,139,5,6,138,3,121,222,154,215,1,5,201,
+193,17,146,132,136,221,119,126,242,169,205,212,90,97,121,23,38,23,48,54,114,
+124,193,181,83,139,152,177,205,182,162,129,13,23,45,1,65,1,71,254,178,254,
+225,204,149,252,209,71,67,25,28,32,59,44,128,118,66,109,59,104,60,66,54,56,
+31,44,53,37,71,63,31,76,223,95,52,118,0,1,0,78,253,233,6,114,4,230,0,91,0,
+0,5,35,34,39,55,22,51,50,54,17,52,38,35,34,6,6,21,21,35,53,52,38,38,35,34,
+6,21,16,22,51,50,55,23,6,35,32,0,17,16,18,51,50,22,23,54,54,51,50,22,18,21,
+20,7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,
+55,54,54,51,50,22,23,38,53,53,52,55,6,4,101,28,38,33,9,18,53,203,192,164,
+147,88,115,54,137,62,113,82,147,164,192,203,13,57,8,59,39,254,254,254,245,
+246,211,107,162,60,59,164,114,130,204,115,75,113,111,140,114,68,46,110,102,
+142,149,83,117,155,58,68,102,79,72,69,52,110,99,129,139,88,99,195,103,2,5,
+118,22,5,139,3,241,1,14,227,254,78,137,116,70,71,122,137,71,251,230,254,242,
+241,5,139,7,1,76,1,64,1,40,1,72,94,102,103,93,141,254,229,201,234,157,252,
+251,71,66,26,24,41,58,40,128,118,66,109,59,104,60,66,53,57,30,42,55,38,68,
+63,31,76,162,105,57,92,0,3,0,44,253,233,10,218,6,177,0,114,0,140,0,166,0,
+0,5,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,35,34,6,21,20,22,23,
+7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,21,21,35,34,6,6,21,20,
+4,51,50,36,18,53,52,2,36,35,34,4,7,39,54,36,51,50,4,18,17,20,7,17,35,38,38,
+35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,54,54,51,50,
+22,23,38,53,17,52,55,6,4,1,54,51,50,22,23,54,36,51,51,38,38,35,34,21,20,23,
+7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,22,51,50,54,53,53,51,21,20,22,51,
+50,54,53,52,38,35,34,6,7,157,196,254,241,75,35,149,106,193,108,50,136,101,
+149,179,1,26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,94,135,35,153,
+1,68,227,172,144,74,111,167,179,248,177,186,89,1,5,230,217,1,47,155,163,254,
+210,186,158,254,238,146,68,142,1,77,173,240,1,113,194,80,114,126,176,106,
+47,107,90,138,142,76,113,150,58,68,102,79,69,67,39,97,106,121,133,85,92,181,
+100,2,4,102,254,203,250,44,101,136,173,238,65,57,1,2,188,145,5,99,85,157,
+5,144,10,10,102,101,213,254,192,254,218,89,134,63,4,102,104,104,105,137,113,
+102,102,110,232,219,133,156,22,111,111,110,112,180,94,86,187,176,46,73,1,
+112,184,157,66,71,30,45,39,29,82,78,121,135,102,96,123,116,40,40,193,181,
+83,69,126,91,180,207,179,1,81,216,228,1,65,164,76,89,135,85,89,205,254,126,
+254,246,241,191,252,65,85,78,27,39,61,36,129,117,66,109,59,104,60,66,53,57,
+23,48,56,38,67,64,32,78,1,21,119,65,116,116,3,137,36,113,112,117,121,90,97,
+121,19,24,24,42,43,45,31,22,109,254,234,101,187,23,33,139,120,146,155,14,
+22,135,158,133,134,188,200,27,0,5,0,44,253,233,10,216,4,230,0,132,0,158,0,
+170,0,196,0,210,0,0,5,34,36,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,
+35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,
+21,21,35,34,6,21,20,4,33,32,36,53,52,39,6,7,22,21,20,6,35,34,38,53,52,54,
+54,51,51,50,54,55,38,35,35,53,52,54,51,50,22,21,20,7,22,22,21,20,7,17,35,
+38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,
+50,22,23,38,53,53,52,55,6,1,54,51,50,22,23,54,54,51,51,38,38,35,34,21,20,
+23,7,38,53,52,55,38,35,34,4,5,50,22,23,54,53,52,38,35,34,6,7,5,6,7,51,6,21,
+20,22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,5,6,35,35,34,6,
+21,20,22,51,50,54,53,52,7,246,229,254,198,86,36,149,107,193,108,50,136,101,
+149,179,1,26,130,1,1,197,40,113,59,70,10,12,143,27,147,128,94,135,35,153,
+1,68,227,119,100,57,74,167,179,176,200,176,1,43,1,29,1,30,1,45,53,77,110,
+28,191,192,189,193,80,147,128,95,140,167,56,78,133,177,176,162,146,153,44,
+54,55,79,116,104,176,104,48,101,85,142,136,71,110,147,58,68,102,79,68,63,
+39,96,101,89,90,91,56,90,169,94,3,4,186,249,76,101,136,170,235,64,47,236,
+190,32,5,100,85,157,10,145,13,17,30,30,213,254,192,5,180,90,149,59,17,82,
+75,85,100,5,249,70,89,134,63,4,102,104,104,105,137,113,102,102,110,232,219,
+133,156,6,145,69,102,102,112,79,122,125,120,118,22,114,114,114,114,180,94,
+86,187,176,46,73,1,112,184,157,66,71,30,45,39,29,82,78,121,135,102,96,123,
+116,18,18,193,181,83,140,147,183,203,202,183,116,66,70,36,52,58,115,109,113,
+108,80,82,37,49,47,30,83,181,193,141,133,93,81,53,146,93,169,117,253,5,76,
+87,28,37,63,35,129,116,66,110,59,104,60,67,53,56,24,47,42,34,18,66,64,57,
+58,191,103,44,115,3,137,36,112,112,118,119,89,98,121,30,31,23,53,49,54,42,
+2,109,73,25,25,42,39,73,83,98,89,205,101,187,23,33,139,120,146,155,14,22,
+135,158,133,134,188,200,27,198,10,37,43,48,38,41,60,44,0,3,0,78,253,233,10,
+8,6,177,0,122,0,135,0,136,0,0,5,34,38,39,6,6,35,34,38,39,6,6,35,32,0,17,52,
+18,36,51,50,23,7,38,35,34,2,17,20,22,51,50,54,53,52,35,34,6,7,39,18,0,51,
+50,22,23,7,38,35,34,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,
+0,33,34,4,7,39,54,36,51,32,4,18,17,16,7,17,35,46,2,35,34,6,7,6,6,35,34,38,
+53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,55,6,1,
+54,51,50,23,54,36,55,38,38,35,34,6,5,8,32,99,154,68,71,155,113,119,172,44,
+57,221,157,254,241,254,211,145,1,21,185,55,47,8,41,47,230,229,217,201,173,
+199,97,31,44,28,146,47,1,55,241,133,248,143,100,36,36,218,237,136,127,125,
+130,137,124,126,168,168,254,157,254,164,174,254,228,145,67,158,1,76,189,1,
+9,1,124,204,70,113,110,148,114,65,52,116,94,143,153,85,118,155,58,68,102,
+79,72,70,44,110,113,101,99,100,59,98,192,113,2,3,101,250,119,44,52,93,52,
+58,1,16,198,83,156,91,173,215,3,106,22,83,97,102,78,113,106,108,111,1,75,
+1,41,195,1,37,160,6,138,3,254,253,254,254,222,250,182,153,138,14,22,45,1,
+66,1,70,113,139,150,3,213,192,157,169,145,156,14,14,152,149,1,35,1,36,1,172,
+1,178,75,89,134,91,83,216,254,64,254,175,254,236,173,252,226,70,69,24,27,
+38,58,40,129,117,66,109,59,104,60,66,53,57,24,48,42,33,18,64,68,54,53,217,
+52,53,89,2,222,20,57,154,159,2,66,58,203,53,0,1,0,74,253,233,7,68,6,177,0,
+116,0,0,5,34,36,38,53,52,54,55,6,35,35,53,33,38,38,35,34,6,21,21,20,23,7,
+38,53,52,55,6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,21,35,
+34,14,3,21,20,22,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,50,4,18,17,20,
+7,17,35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,
+54,54,51,50,22,23,38,53,17,52,55,6,4,3,236,209,254,222,141,96,98,72,110,29,
+2,208,5,100,85,81,76,1,147,3,18,175,190,113,134,63,66,151,1,33,188,33,44,
+46,40,166,181,177,131,156,111,77,46,255,235,221,1,57,168,169,254,199,194,
+168,254,228,148,68,1,53,1,104,245,1,124,204,81,114,126,176,106,47,107,90,
+138,142,76,113,150,58,68,102,79,69,67,39,97,106,121,133,85,92,181,100,2,5,
+100,254,186,22,127,219,140,112,175,54,8,135,89,98,61,53,13,7,7,7,23,22,56,
+43,32,248,197,234,161,73,104,245,127,186,1,20,146,7,7,190,184,83,16,48,72,
+106,79,166,186,171,1,80,225,230,1,63,164,77,88,135,174,202,254,126,254,243,
+242,185,252,60,85,78,27,39,61,36,129,117,66,109,59,104,60,66,53,57,23,48,
+56,38,67,64,32,78,1,21,123,71,116,126,0,4,0,78,253,233,7,192,6,177,0,106,
+0,116,0,117,0,118,0,0,5,34,38,39,6,6,35,34,38,53,52,54,55,38,35,34,0,21,20,
+23,7,38,53,16,0,33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,
+54,54,53,16,39,6,6,35,34,38,53,52,38,39,34,39,55,4,0,17,20,7,17,35,46,2,35,
+34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,
+38,53,53,52,55,6,3,38,39,22,23,22,22,51,50,54,1,1,5,217,112,167,69,74,158,
+116,188,221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,168,144,41,187,211,
+141,132,134,132,137,136,137,116,149,73,168,41,135,79,119,123,18,37,2,3,53,
+1,164,1,151,69,113,109,145,117,66,52,116,94,143,153,85,118,155,58,68,102,
+79,72,70,44,110,113,101,99,100,59,98,192,113,2,3,103,93,116,180,22,5,4,52,
+55,51,75,254,64,254,82,22,83,97,103,77,255,230,182,244,44,3,254,253,232,186,
+155,49,191,207,1,26,1,67,64,138,4,218,184,156,170,149,152,14,14,157,144,115,
+229,175,1,99,226,72,81,144,144,113,90,23,2,126,138,253,230,254,115,241,156,
+252,246,69,69,25,27,38,58,40,129,117,66,109,59,104,60,66,53,57,24,48,42,33,
+18,64,68,54,53,217,74,25,83,5,63,112,84,49,113,87,62,53,1,58,254,193,0,5,
+0,44,253,233,10,65,6,177,0,105,0,115,0,127,0,144,0,145,0,0,5,34,36,39,6,6,
+35,34,36,53,53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,
+54,36,51,50,4,23,7,6,6,21,20,22,51,50,36,18,53,52,39,6,6,35,34,38,53,52,38,
+39,39,55,4,0,17,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,
+21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,17,52,55,6,4,1,38,39,22,23,22,
+22,51,50,54,1,54,54,55,38,35,32,7,54,51,50,22,5,6,7,23,6,21,20,22,51,50,54,
+53,52,38,35,34,6,1,7,25,213,254,230,70,58,247,189,240,254,242,74,130,1,5,
+190,39,111,59,70,10,12,143,27,147,128,92,130,39,149,1,36,156,169,1,48,112,
+56,202,201,246,237,211,1,40,154,86,42,122,71,119,123,19,35,9,51,1,98,1,119,
+79,115,115,177,105,45,105,89,142,139,72,110,150,58,68,102,79,70,64,47,107,
+85,118,131,84,89,171,103,2,4,93,254,208,1,48,109,178,22,5,4,52,55,48,71,251,
+238,44,178,135,178,225,254,223,255,88,109,141,196,253,71,88,71,70,12,194,
+186,208,206,191,178,90,150,4,252,22,121,122,122,121,215,203,25,126,73,1,121,
+184,148,66,71,30,45,39,29,82,78,121,135,94,93,119,109,136,124,143,17,182,
+165,177,186,172,1,75,211,201,154,57,65,144,144,124,82,21,3,124,113,254,53,
+254,210,241,185,252,76,81,82,25,40,63,35,128,117,66,110,59,104,60,67,53,56,
+31,40,55,39,63,67,33,78,1,29,104,61,108,115,5,45,126,87,49,112,87,62,45,253,
+241,100,124,23,143,223,28,98,102,102,98,5,44,56,143,147,177,164,154,160,27,
+3,53,0,3,0,44,253,233,10,87,6,177,0,110,0,134,0,151,0,0,5,34,36,39,6,6,35,
+34,36,53,53,7,39,0,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,
+51,50,23,54,51,50,22,21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,2,36,35,34,
+4,7,39,54,36,51,50,4,18,17,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,38,53,
+52,54,55,23,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,17,52,55,6,4,1,
+38,53,52,55,38,35,32,5,54,51,50,22,23,54,33,51,38,38,35,34,21,20,23,5,6,7,
+23,6,21,20,22,51,50,54,53,52,38,35,34,6,7,26,209,254,232,70,57,250,194,240,
+254,242,74,130,1,5,190,39,111,59,70,10,12,143,27,147,128,184,77,149,1,36,
+156,160,130,76,114,166,180,248,177,186,89,1,5,230,217,1,47,155,163,254,210,
+186,158,254,238,146,68,142,1,77,173,239,1,113,195,80,114,126,176,106,47,107,
+90,138,142,76,73,122,68,58,68,102,79,69,67,39,97,106,121,133,85,92,181,100,
+2,4,102,254,203,253,152,10,9,95,109,254,223,255,0,88,110,146,201,54,121,1,
+114,145,5,99,85,157,5,251,224,88,71,70,12,194,186,208,206,191,178,90,150,
+22,124,125,125,124,215,203,25,126,73,1,121,184,148,66,71,30,45,39,29,82,78,
+121,135,187,119,109,43,43,191,183,83,69,126,91,180,207,179,1,81,216,228,1,
+65,164,76,89,135,85,89,205,254,127,254,245,241,191,252,65,85,78,27,39,61,
+36,58,111,77,66,109,59,104,60,66,53,57,23,48,56,38,67,64,32,78,1,21,119,65,
+115,117,3,185,42,43,40,33,25,223,28,99,98,210,90,97,121,19,24,236,102,98,
+5,44,56,143,147,177,164,154,160,27,0,2,0,78,253,233,7,187,6,177,0,101,0,102,
+0,0,5,34,38,39,6,6,35,34,38,53,52,54,55,38,35,34,0,21,20,23,7,38,53,16,0,
+33,50,23,7,6,6,21,20,22,51,50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,
+4,7,39,54,36,51,32,0,17,16,7,17,35,46,2,35,34,6,7,6,6,35,34,38,53,52,54,55,
+23,6,21,20,22,51,50,54,55,62,2,51,50,22,23,38,53,53,52,55,6,1,5,199,103,161,
+68,75,157,114,188,221,185,173,24,26,216,255,0,80,143,87,1,67,1,12,168,144,
+41,187,211,141,132,134,132,137,130,129,173,174,254,146,254,153,172,254,209,
+146,67,160,1,86,196,1,168,1,190,70,113,110,148,114,65,52,116,94,143,153,85,
+118,155,58,68,102,79,72,70,44,110,113,101,99,100,59,98,192,113,2,4,107,252,
+197,22,86,94,105,75,255,230,182,244,44,3,254,253,232,186,155,49,191,207,1,
+26,1,67,64,138,4,218,184,156,170,149,152,14,14,156,145,1,35,1,36,1,172,1,
+178,78,86,134,90,84,254,1,254,22,254,245,176,252,220,70,69,24,27,38,58,40,
+129,117,66,109,59,104,60,66,53,57,24,48,42,33,18,64,68,54,53,217,69,43,96,
+4,252,0,1,0,74,253,233,7,68,6,177,0,109,0,0,5,32,0,53,52,54,54,51,51,38,38,
+35,34,21,20,23,7,38,53,52,55,6,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,
+51,50,22,21,21,33,34,6,6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,36,33,
+50,4,18,17,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,38,53,52,54,55,23,6,21,
+20,22,51,50,54,55,54,54,51,50,22,23,38,53,17,52,55,6,4,3,235,254,204,254,
+160,132,250,214,127,5,100,85,157,6,145,9,21,177,191,113,134,63,66,151,1,33,
+188,39,41,39,44,166,181,254,245,175,185,92,1,15,239,222,1,59,166,169,254,
+198,194,162,254,223,149,67,1,58,1,98,245,1,125,204,82,114,126,176,106,47,
+107,90,138,142,76,73,122,68,58,68,102,79,69,67,39,97,106,121,133,85,92,181,
+100,2,5,103,254,191,22,1,30,249,125,190,104,89,98,121,19,24,24,50,35,54,45,
+32,249,196,234,161,73,104,245,127,186,1,20,146,8,8,191,183,83,65,125,96,181,
+206,174,1,81,221,229,1,64,164,78,87,135,174,202,254,126,254,243,239,190,252,
+62,85,78,27,39,61,36,58,111,77,66,109,59,104,60,66,53,57,23,48,56,38,67,64,
+32,78,1,21,122,72,119,123,0,5,0,58,253,233,10,96,6,177,0,107,0,117,0,130,
+0,144,0,145,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,
+34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,32,1,7,6,6,21,20,22,51,50,
+36,18,53,52,39,6,6,35,34,38,53,52,38,39,39,55,4,0,17,20,7,17,35,38,38,35,
+34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,54,55,54,54,51,50,22,
+23,38,53,17,52,55,6,19,38,39,22,23,22,22,51,50,54,1,54,51,50,22,23,54,54,
+55,38,38,35,32,3,6,6,7,22,22,51,50,54,53,52,38,35,34,1,7,56,214,254,228,69,
+59,255,0,196,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,
+10,12,143,27,147,128,192,69,99,1,11,156,1,81,1,10,56,202,201,246,237,211,
+1,40,154,86,42,122,71,119,123,19,35,9,51,1,98,1,119,79,115,115,177,105,45,
+105,89,142,139,72,110,150,58,68,102,79,70,64,47,107,85,118,131,84,89,171,
+103,2,4,203,110,109,178,22,5,4,52,55,48,71,250,7,49,46,142,197,56,44,178,
+133,89,205,116,254,246,216,55,223,193,65,247,200,208,225,194,175,67,4,68,
+22,123,123,123,123,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,
+39,29,82,78,121,135,200,118,123,254,252,143,17,182,165,177,186,172,1,75,211,
+201,154,57,65,144,144,124,82,21,3,124,113,254,53,254,210,237,187,252,74,81,
+82,25,40,63,35,128,117,66,110,59,104,60,67,53,56,31,40,55,39,63,67,33,78,
+1,29,105,62,225,5,45,126,87,49,112,87,62,45,254,173,7,95,94,97,120,24,71,
+72,254,173,171,169,5,156,150,184,166,149,156,3,26,0,3,0,58,253,233,8,158,
+4,230,0,99,0,127,0,141,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,
+38,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,55,54,
+54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,17,35,38,38,35,34,6,7,6,
+6,35,34,38,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,
+53,53,6,1,54,51,50,22,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,53,38,
+38,35,34,6,7,6,6,7,22,22,51,50,54,53,52,38,35,34,7,16,195,254,245,64,59,255,
+0,197,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,
+27,147,128,96,130,35,99,1,11,156,215,174,10,37,112,88,171,182,254,197,178,
+176,122,54,240,226,165,154,63,128,58,107,62,37,67,66,111,130,68,55,97,65,
+60,66,102,41,38,53,47,46,79,68,94,99,53,67,97,54,3,111,251,114,49,46,149,
+202,54,42,153,221,185,175,5,102,89,83,80,3,147,4,78,165,103,127,211,132,55,
+223,193,65,247,200,208,225,194,175,67,22,126,122,124,124,1,66,1,59,24,32,
+36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,135,100,100,118,123,
+93,11,41,41,193,181,83,34,85,126,84,159,185,60,47,253,96,81,82,23,36,60,44,
+51,110,79,68,115,57,104,31,63,39,49,54,31,40,55,39,49,57,65,64,215,30,3,166,
+7,104,104,73,99,49,88,99,62,50,18,12,18,29,21,20,44,41,101,238,171,169,5,
+156,150,184,166,149,156,0,3,0,58,253,233,10,194,6,177,0,122,0,134,0,148,0,
+0,5,34,38,39,6,6,35,34,38,39,6,6,35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,
+34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,36,51,50,4,23,7,6,6,21,20,22,51,
+50,54,53,53,51,21,20,22,51,50,18,17,16,0,33,34,4,7,39,54,36,51,32,0,17,16,
+7,17,35,46,2,35,34,6,7,6,6,35,34,38,38,53,52,54,55,23,6,21,20,22,51,50,54,
+55,62,2,51,50,22,23,38,53,53,52,55,6,1,54,51,50,22,23,54,54,55,38,35,32,3,
+6,6,7,22,22,51,50,54,53,52,38,35,34,8,218,99,156,67,72,154,112,121,171,44,
+63,250,187,254,211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,
+12,143,27,147,128,192,69,99,1,11,156,168,1,46,133,61,189,209,136,127,124,
+131,137,124,126,168,168,254,157,254,164,174,254,228,145,67,158,1,76,189,1,
+156,1,181,70,113,109,145,117,66,52,116,94,143,153,85,82,126,65,58,68,102,
+79,72,70,44,110,113,101,99,100,59,98,192,113,2,3,100,249,134,49,46,146,201,
+55,48,174,126,177,233,254,246,216,55,223,193,65,247,200,208,225,194,175,67,
+22,84,96,104,76,116,108,112,112,1,66,1,59,24,32,36,1,17,55,105,77,133,120,
+70,67,30,45,39,29,82,78,121,135,200,118,123,130,130,140,11,218,175,157,169,
+143,158,14,14,152,149,1,35,1,36,1,172,1,178,75,89,134,91,83,254,4,254,19,
+254,239,175,252,225,69,69,25,27,38,58,40,63,108,75,66,109,59,104,60,66,53,
+57,24,48,42,33,18,64,68,54,53,217,54,53,91,3,166,7,101,101,104,127,23,143,
+254,173,171,169,5,156,150,184,166,149,156,0,3,0,58,253,233,10,118,6,177,0,
+115,0,140,0,154,0,0,5,34,36,39,6,4,35,32,0,3,55,22,23,23,50,62,2,55,38,38,
+35,34,6,21,20,22,23,7,38,53,52,54,51,50,22,23,54,36,51,50,23,54,51,50,22,
+21,21,35,34,6,6,21,20,4,51,50,36,18,53,52,2,36,35,34,4,7,39,54,36,51,50,4,
+18,17,20,7,17,35,38,38,35,34,6,7,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,
+50,54,55,54,54,51,50,22,23,38,53,17,52,55,6,4,1,38,53,52,55,38,35,34,7,54,
+51,50,22,23,54,54,51,51,38,38,35,34,21,20,23,5,6,6,7,22,22,51,50,54,53,52,
+38,35,34,7,57,213,254,231,69,58,254,254,200,254,211,254,149,48,146,5,9,20,
+72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,128,96,130,35,99,1,11,156,
+158,138,75,127,166,180,247,176,185,92,1,5,230,217,1,47,155,163,254,210,186,
+158,254,238,146,68,143,1,76,173,240,1,113,194,80,114,126,176,106,47,107,90,
+138,142,76,113,150,58,68,102,79,69,67,39,97,106,121,133,85,92,181,100,2,4,
+102,254,203,253,152,9,8,97,125,253,170,49,46,145,200,55,60,251,180,146,5,
+100,85,157,5,252,187,55,223,193,65,247,200,208,225,194,175,67,22,128,129,
+129,128,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,
+121,135,100,100,118,123,51,51,191,183,83,66,124,96,180,207,179,1,81,216,228,
+1,65,164,76,89,135,85,89,205,254,126,254,246,241,191,252,65,85,78,27,39,61,
+36,129,117,66,109,59,104,60,66,53,57,23,48,56,38,67,64,32,78,1,21,119,65,
+115,117,3,185,50,35,41,26,31,202,7,100,99,104,108,89,98,121,19,24,180,171,
+169,5,156,150,184,166,149,156,0,1,0,15,253,233,4,183,4,230,0,113,0,0,5,34,
+38,39,38,39,6,7,39,62,2,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,22,21,20,6,6,7,6,7,22,23,30,2,51,50,54,53,52,38,39,53,52,54,51,50,22,21,
+20,7,39,54,53,52,38,35,34,6,7,22,18,21,20,7,17,35,38,38,35,34,6,7,6,6,35,
+34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,54,54,51,50,22,23,38,53,53,
+52,55,6,2,242,112,203,138,47,44,26,16,146,2,42,73,80,79,70,39,66,60,57,60,
+8,144,13,146,118,127,151,45,85,97,31,26,37,117,82,86,100,57,148,157,221,212,
+166,147,127,132,13,145,10,61,63,65,81,8,208,229,66,123,74,98,66,37,79,78,
+129,129,67,98,134,60,66,102,45,34,61,51,48,92,69,101,111,65,63,97,59,2,7,
+104,22,66,88,30,15,62,126,30,65,139,142,130,129,134,134,61,82,84,63,54,32,
+33,23,42,60,111,127,156,137,79,169,158,151,49,48,12,64,46,38,23,159,155,171,
+188,4,31,224,198,123,116,48,53,23,31,30,63,58,93,94,30,254,255,202,165,112,
+253,67,93,70,21,40,65,37,130,112,68,113,57,104,34,63,34,52,53,33,38,55,39,
+49,56,57,56,114,89,52,55,0,3,0,74,253,213,10,156,4,230,0,98,0,125,0,151,0,
+0,5,34,38,39,6,6,35,34,39,6,6,35,34,38,39,7,39,0,55,38,38,35,34,6,21,20,23,
+7,38,38,53,53,52,55,6,21,20,22,23,7,38,38,53,52,0,55,54,51,50,22,23,54,36,
+51,50,22,23,54,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,22,
+21,20,6,35,34,39,55,22,51,50,54,54,53,52,38,35,34,7,39,1,54,51,50,22,23,54,
+36,33,51,38,38,35,34,6,21,20,23,7,38,53,52,55,38,35,34,4,1,6,7,51,6,21,20,
+22,51,50,54,53,53,51,21,20,22,51,50,54,53,52,38,35,34,6,8,171,206,251,64,
+37,146,104,193,107,52,135,100,150,179,1,26,130,1,1,197,20,76,56,59,70,21,
+143,9,15,1,142,69,83,132,88,82,1,15,233,15,26,105,142,36,154,1,69,225,124,
+192,95,40,108,79,171,182,254,197,178,176,122,54,240,226,205,177,43,52,29,
+77,77,162,162,100,90,34,67,78,73,78,39,87,94,84,59,10,250,245,101,135,175,
+240,65,53,1,17,1,33,174,5,102,89,83,80,3,147,4,2,157,171,212,254,192,254,
+217,100,122,62,4,102,104,104,105,137,114,102,102,110,232,220,133,156,22,113,
+99,105,107,180,95,85,187,176,46,73,1,112,184,78,79,66,71,46,68,29,26,104,
+41,9,5,5,122,245,118,199,117,78,130,252,138,240,1,68,17,4,99,98,124,114,35,
+37,38,34,193,181,83,34,85,126,84,159,185,88,137,27,10,32,135,104,161,161,
+30,134,24,37,80,65,88,85,19,58,3,136,36,117,116,114,132,88,99,63,49,11,19,
+18,29,21,33,12,60,109,254,234,113,175,23,33,137,122,146,155,14,22,135,158,
+133,134,187,201,27,0,2,0,77,253,213,9,151,4,230,0,93,0,119,0,0,5,34,36,39,
+6,6,35,34,38,2,53,52,0,55,38,35,34,6,6,21,20,22,23,7,38,53,16,0,33,50,22,
+23,7,14,2,21,20,22,51,50,54,53,52,35,34,6,7,39,18,0,33,50,23,54,51,50,22,
+21,21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,22,21,20,6,35,34,39,55,22,51,
+50,54,53,52,38,35,34,7,39,1,35,34,4,7,54,51,50,23,62,2,51,51,38,38,35,34,
+6,21,20,23,7,38,53,52,7,166,217,254,252,61,60,232,164,182,254,127,1,2,230,
+62,108,147,223,122,55,51,135,121,1,93,1,37,91,183,79,54,140,208,115,214,204,
+178,195,98,31,44,28,146,49,1,103,1,21,97,85,50,67,171,182,254,197,177,177,
+122,54,240,226,205,177,43,52,29,77,77,162,162,100,90,34,67,78,109,81,87,94,
+84,59,10,254,243,17,198,254,239,59,44,50,85,58,33,150,232,204,174,5,102,89,
+83,80,3,147,4,22,128,111,119,120,145,1,5,176,225,1,39,30,13,125,224,152,107,
+201,76,68,219,241,1,35,1,77,48,46,143,5,112,208,144,206,218,179,154,140,14,
+22,45,1,64,1,72,12,12,193,181,83,34,84,127,84,159,185,88,137,27,10,32,135,
+104,161,161,30,134,24,91,91,88,85,19,58,4,119,208,200,18,55,79,116,60,88,
+99,63,49,18,12,18,29,21,73,0,1,0,74,253,213,4,215,4,230,0,64,0,0,5,32,0,53,
+52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,14,
+2,21,20,22,51,50,55,23,6,7,22,22,21,20,6,35,34,39,55,22,51,50,54,54,53,52,
+38,35,34,7,39,35,6,2,193,254,215,254,178,96,182,235,183,204,5,102,89,81,81,
+2,147,4,158,143,170,182,254,179,188,186,127,57,254,238,216,186,43,45,38,78,
+78,162,162,100,90,34,67,78,73,78,39,87,94,84,59,10,28,13,22,1,6,237,122,177,
+116,40,88,99,61,51,18,12,18,29,33,111,122,192,182,83,34,84,127,84,159,185,
+88,137,23,13,32,135,105,161,161,30,134,24,37,80,65,88,85,19,58,1,0,1,0,74,
+253,213,5,177,4,230,0,78,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,
+23,7,38,53,52,55,34,6,21,20,23,7,38,38,53,52,18,36,51,50,23,54,51,50,22,21,
+21,33,34,14,2,21,20,22,51,50,55,23,6,7,22,22,21,20,6,35,34,39,55,22,51,50,
+54,54,53,52,38,35,34,7,39,3,192,254,204,254,199,77,154,214,214,195,5,104,
+88,82,80,2,146,5,26,233,254,105,137,56,62,150,1,32,190,110,63,43,68,169,183,
+254,197,179,177,119,54,240,226,205,177,42,52,29,77,77,162,162,100,90,34,67,
+78,73,78,39,87,94,84,59,10,22,1,11,232,109,172,118,56,89,98,62,50,18,12,18,
+30,20,71,44,255,231,221,180,67,102,247,126,185,1,20,148,11,11,190,184,83,
+34,85,126,84,159,185,88,137,27,10,32,135,104,161,161,30,134,24,37,80,65,88,
+85,19,58,0,3,0,58,253,213,9,17,4,230,0,83,0,110,0,124,0,0,5,34,36,39,6,4,
+35,32,0,3,55,22,23,23,50,62,2,55,38,38,35,34,6,21,20,22,23,7,38,53,52,54,
+51,50,22,23,54,36,51,50,23,55,54,54,51,50,22,21,21,33,34,14,2,21,20,22,51,
+50,55,23,6,7,22,22,21,20,6,35,34,39,55,22,51,50,54,53,52,38,35,34,7,39,1,
+54,51,50,22,23,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,53,38,38,35,34,3,
+6,6,7,22,22,51,50,54,53,52,38,35,34,7,33,222,254,251,60,59,255,0,197,254,
+211,254,149,48,146,5,9,20,72,94,93,77,29,17,83,70,62,67,10,12,143,27,147,
+128,96,130,35,99,1,11,156,215,174,10,37,112,88,171,182,254,197,178,176,122,
+54,240,226,205,177,42,37,44,77,77,162,162,100,90,34,67,78,109,81,87,94,84,
+59,10,251,219,49,46,149,202,54,42,153,221,185,175,5,102,89,83,80,3,147,4,
+78,165,103,253,217,55,223,193,65,247,200,208,225,194,175,67,22,133,115,124,
+124,1,66,1,59,24,32,36,1,17,55,105,77,133,120,70,67,30,45,39,29,82,78,121,
+135,100,100,118,123,93,11,41,41,193,181,83,34,85,126,84,159,185,88,137,21,
+16,32,135,104,161,161,30,134,24,91,91,88,85,19,58,3,165,7,104,104,73,99,49,
+88,99,62,50,18,12,18,29,21,20,44,41,254,173,171,169,5,156,150,184,166,149,
+156,0,2,0,74,253,213,4,202,4,230,0,67,0,79,0,0,5,32,0,53,52,62,2,51,51,38,
+38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,
+55,23,35,21,22,22,21,17,35,39,21,39,6,6,35,34,38,53,52,62,2,55,38,38,35,34,
+7,39,6,1,23,53,35,34,6,21,20,51,50,54,55,2,193,254,215,254,178,96,182,235,
+183,204,5,102,89,81,81,2,147,4,158,143,170,182,254,179,188,186,127,57,254,
+238,190,155,40,1,63,58,125,1,59,37,66,42,90,107,53,95,130,110,11,87,75,75,
+76,6,29,1,78,29,21,140,96,94,30,38,19,22,1,6,237,122,177,116,40,88,99,61,
+51,18,12,18,29,33,111,122,192,182,83,34,84,127,84,159,185,63,132,1,33,116,
+119,254,182,2,2,30,24,17,104,92,54,81,54,20,1,69,58,23,24,1,254,126,18,165,
+49,49,82,17,16,0,4,0,74,253,213,6,146,4,230,0,65,0,77,0,105,0,117,0,0,5,36,
+0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,33,
+34,14,2,21,20,22,51,50,55,23,6,7,22,22,21,17,35,39,21,39,6,6,35,34,38,53,
+52,62,2,55,38,38,35,34,7,1,23,53,35,34,6,21,20,51,50,54,55,1,38,38,35,34,
+7,39,54,51,50,22,22,21,17,35,39,21,39,6,6,35,34,38,53,52,62,2,19,23,53,35,
+34,6,21,20,51,50,54,55,2,137,254,234,254,215,96,182,235,183,204,5,102,89,
+81,81,2,147,4,158,143,170,182,254,179,188,186,127,57,254,238,190,155,40,32,
+36,43,37,125,1,59,37,66,42,90,107,53,95,130,110,11,87,75,75,76,1,43,29,21,
+140,96,94,30,38,19,2,124,11,87,75,75,76,27,105,89,103,129,64,125,1,59,37,
+66,42,90,107,53,95,130,85,29,21,140,96,94,30,38,19,20,14,1,4,223,122,177,
+116,40,88,99,61,51,18,12,18,29,33,111,122,192,182,83,34,84,127,84,159,185,
+63,132,16,12,36,109,96,254,182,2,2,30,24,17,104,92,54,81,54,20,1,69,58,23,
+254,149,18,165,49,49,82,17,16,1,3,69,58,23,113,26,65,118,125,254,182,2,2,
+30,24,17,104,92,54,81,54,20,254,254,18,165,49,49,82,17,16,0,2,0,74,253,213,
+6,75,7,200,0,81,0,92,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,23,7,22,23,17,52,
+38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,21,20,6,35,34,39,55,
+22,51,50,54,53,52,38,35,34,7,39,6,1,22,51,50,53,52,38,35,34,6,7,2,193,254,
+215,254,178,96,182,235,183,204,5,102,89,81,81,2,147,4,158,143,170,182,254,
+179,188,186,127,57,254,238,216,186,43,22,21,20,46,57,53,104,29,48,112,85,
+98,113,106,46,22,44,44,162,162,100,90,34,67,78,109,81,87,94,84,59,13,105,
+1,243,27,31,111,40,35,49,44,1,22,1,6,237,122,177,116,40,88,99,61,51,18,12,
+18,29,33,111,122,192,182,83,34,84,127,84,159,185,88,137,11,1,5,6,77,98,77,
+22,124,30,67,97,101,88,96,107,4,249,187,37,116,79,161,161,30,134,24,91,91,
+88,85,19,76,19,6,206,5,86,35,42,57,58,0,2,0,74,253,213,6,82,4,230,0,109,0,
+110,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,
+22,21,21,33,34,14,2,21,20,22,51,50,55,54,51,50,22,21,20,6,7,22,23,22,22,51,
+50,53,52,38,39,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,7,22,22,21,
+20,6,35,34,38,39,38,38,35,35,6,7,39,62,2,55,62,2,53,52,38,35,34,21,20,23,
+7,38,39,6,5,2,193,254,215,254,178,96,182,235,183,204,5,102,89,81,81,2,147,
+4,158,143,170,182,254,179,188,186,127,57,254,238,57,36,54,84,94,101,57,80,
+39,66,72,85,50,137,137,137,132,114,92,95,4,2,127,3,37,37,80,19,133,148,132,
+121,74,126,95,36,46,22,7,29,13,131,2,27,47,53,53,43,24,33,29,62,3,128,5,3,
+29,1,232,22,1,6,237,122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,192,
+182,83,34,84,127,84,159,185,4,46,103,98,58,131,105,5,35,39,24,115,78,80,3,
+26,139,157,89,82,9,47,9,13,17,16,35,40,101,15,142,112,117,127,34,50,19,12,
+46,69,29,33,73,76,74,75,69,70,29,33,38,72,16,21,14,17,42,2,151,0,4,0,74,253,
+213,6,192,6,177,0,126,0,137,0,138,0,139,0,0,5,32,0,53,52,62,2,51,51,38,38,
+35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,
+54,51,50,22,21,20,6,7,22,23,22,22,51,50,53,52,38,39,53,52,55,17,52,38,39,
+55,22,23,54,51,50,22,21,20,6,35,34,39,17,22,22,21,20,6,7,39,54,53,52,38,35,
+34,7,22,22,21,20,6,35,34,38,39,38,38,35,35,6,7,39,62,2,55,62,2,53,52,38,35,
+34,21,20,23,7,38,39,6,1,22,51,50,53,52,38,35,34,6,7,3,1,2,193,254,215,254,
+178,96,182,235,183,204,5,102,89,81,81,2,147,4,158,143,170,182,254,179,188,
+186,127,57,254,238,57,36,54,84,94,101,57,80,39,66,72,85,50,137,137,137,117,
+46,57,53,104,29,48,112,85,98,113,106,46,22,87,90,4,2,127,3,37,37,80,19,133,
+148,132,121,74,126,95,36,46,22,7,29,13,131,2,27,47,53,53,43,24,33,29,62,3,
+128,5,3,29,2,202,27,31,111,40,35,49,44,1,226,254,102,22,1,6,237,122,177,116,
+40,88,99,61,51,18,12,18,29,33,111,122,192,182,83,34,84,127,84,159,185,4,46,
+103,98,58,131,105,5,35,39,24,115,78,80,3,26,188,74,4,152,98,77,22,124,30,
+67,97,101,88,96,107,4,251,205,3,88,80,9,47,9,13,17,16,35,40,101,15,142,112,
+117,127,34,50,19,12,46,69,29,33,73,76,74,75,69,70,29,33,38,72,16,21,14,17,
+42,2,5,107,5,86,35,42,57,58,249,211,7,94,0,4,0,74,253,213,8,61,6,177,0,109,
+0,131,0,132,0,133,0,0,5,32,0,53,52,62,2,51,51,38,38,35,34,6,21,20,23,7,38,
+53,52,54,51,50,22,21,21,33,34,14,2,21,20,22,51,50,55,54,51,50,22,21,20,6,
+7,22,23,22,22,51,50,53,52,38,39,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,
+35,34,7,22,22,21,20,6,35,34,38,39,38,38,35,35,6,7,39,62,2,55,62,2,53,52,38,
+35,34,21,20,23,7,38,39,6,1,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,
+20,6,35,34,39,1,1,2,193,254,215,254,178,96,182,235,183,204,5,102,89,81,81,
+2,147,4,158,143,170,182,254,179,188,186,127,57,254,238,57,36,54,84,94,101,
+57,80,39,66,72,85,50,137,137,137,132,114,92,95,4,2,127,3,37,37,80,19,133,
+148,132,121,74,126,95,36,46,22,7,29,13,131,2,27,47,53,53,43,24,33,29,62,3,
+128,5,3,29,3,186,53,47,101,82,85,98,55,45,22,60,88,139,163,161,152,77,60,
+252,170,1,146,22,1,6,237,122,177,116,40,88,99,61,51,18,12,18,29,33,111,122,
+192,182,83,34,84,127,84,159,185,4,46,103,98,58,131,105,5,35,39,24,115,78,
+80,3,26,139,157,89,82,9,47,9,13,17,16,35,40,101,15,142,112,117,127,34,50,
+19,12,46,69,29,33,73,76,74,75,69,70,29,33,38,72,16,21,14,17,42,2,254,127,
+13,101,99,98,100,14,132,17,171,162,166,169,17,8,203,248,162,0,5,0,74,253,
+213,8,180,6,177,0,109,0,150,0,161,0,162,0,163,0,0,5,32,0,53,52,62,2,51,51,
+38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,21,33,34,14,2,21,20,22,51,
+50,55,54,51,50,22,21,20,6,7,22,23,22,22,51,50,53,52,38,39,53,52,54,51,50,
+22,21,20,6,7,39,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,39,38,38,35,35,
+6,7,39,62,2,55,62,2,53,52,38,35,34,21,20,23,7,38,39,6,1,22,51,50,54,53,52,
+38,35,34,7,39,54,51,51,17,52,38,39,55,22,23,54,51,50,22,21,20,6,35,34,39,
+17,22,22,21,20,6,35,34,39,1,22,51,50,53,52,38,35,34,6,21,1,1,2,193,254,215,
+254,178,96,182,235,183,204,5,102,89,81,81,2,147,4,158,143,170,182,254,179,
+188,186,127,57,254,238,57,36,54,84,94,101,57,80,39,66,72,85,50,137,137,137,
+132,114,92,95,4,2,127,3,37,37,80,19,133,148,132,121,74,126,95,36,46,22,7,
+29,13,131,2,27,47,53,53,43,24,33,29,62,3,128,5,3,29,3,186,53,47,101,82,82,
+101,55,45,22,60,77,6,46,57,53,104,29,48,112,85,98,113,106,46,22,84,84,161,
+152,77,60,1,26,27,31,111,40,35,47,47,251,144,1,160,22,1,6,237,122,177,116,
+40,88,99,61,51,18,12,18,29,33,111,122,192,182,83,34,84,127,84,159,185,4,46,
+103,98,58,131,105,5,35,39,24,115,78,80,3,26,139,157,89,82,9,47,9,13,17,16,
+35,40,101,15,142,112,117,127,34,50,19,12,46,69,29,33,73,76,74,75,69,70,29,
+33,38,72,16,21,14,17,42,2,254,127,13,101,99,98,100,14,132,17,4,179,98,77,
+22,124,30,67,97,101,88,96,107,4,251,118,35,153,119,166,169,17,7,111,5,86,
+35,42,55,77,1,66,248,162,0,3,255,206,255,234,2,75,6,177,0,23,0,24,0,25,0,
+0,3,33,23,2,2,21,20,22,51,50,54,55,23,6,35,34,38,53,52,18,19,6,35,33,23,19,
+50,1,235,50,197,166,106,121,51,75,59,47,123,115,187,187,178,179,49,67,254,
+246,126,25,6,7,136,254,210,254,63,236,152,150,16,26,131,51,221,221,235,1,
+238,1,3,3,151,1,203,0,4,255,143,255,234,2,65,6,177,0,35,0,36,0,37,0,38,0,
+0,1,6,7,7,39,54,55,6,35,35,53,33,23,6,5,54,55,55,23,6,2,21,20,22,51,50,54,
+55,23,6,35,34,38,53,52,18,27,2,1,32,101,106,141,53,180,187,39,94,171,1,206,
+50,121,254,230,110,151,95,45,182,160,106,121,51,75,59,47,122,125,174,191,
+175,236,25,99,4,28,10,2,3,135,123,112,2,138,135,89,164,10,5,3,125,190,254,
+207,143,145,147,16,26,131,51,211,200,169,1,96,1,88,1,203,253,87,255,255,0,
+44,255,234,7,196,4,230,2,2,0,24,0,0,255,255,0,74,255,234,6,180,6,177,2,2,
+0,25,0,0,255,255,0,78,255,234,6,244,4,230,2,2,0,26,0,0,255,255,0,62,255,234,
+6,77,4,230,2,2,0,27,0,0,255,255,0,52,255,234,6,205,6,177,2,2,0,28,0,0,255,
+255,0,77,255,234,8,56,4,230,2,2,0,29,0,0,255,255,0,62,255,234,6,59,6,177,
+2,2,0,30,0,0,255,255,0,74,255,234,6,69,6,177,2,2,0,31,0,0,255,255,0,74,255,
+234,6,18,6,177,2,2,0,32,0,0,255,255,0,44,255,234,11,38,6,177,2,2,0,33,0,0,
+255,255,0,74,253,213,10,129,4,230,2,2,0,34,0,0,255,255,0,77,253,213,9,124,
+4,230,2,2,0,35,0,0,255,255,0,74,255,234,7,36,6,177,2,2,0,36,0,0,255,255,0,
+74,255,234,6,13,6,177,2,2,0,37,0,0,255,255,0,74,255,234,6,130,6,177,2,2,0,
+38,0,0,255,255,0,62,255,234,6,150,6,177,2,2,0,39,0,0,255,255,0,62,255,234,
+6,155,6,177,2,2,0,40,0,0,255,255,0,10,255,234,9,85,6,177,2,2,0,41,0,0,255,
+255,0,74,255,234,7,174,6,177,2,2,0,42,0,0,255,255,0,44,255,234,7,76,4,230,
+2,2,0,43,0,0,255,255,0,74,255,234,6,32,6,177,2,2,0,44,0,0,255,255,0,74,253,
+213,4,189,4,230,2,2,0,45,0,0,255,255,0,74,255,234,6,125,6,177,2,2,0,46,0,
+0,255,255,0,58,255,234,7,107,4,230,2,2,0,47,0,0,255,255,0,74,253,213,5,151,
+4,230,2,2,0,48,0,0,255,255,0,74,255,234,6,8,4,230,2,2,0,49,0,0,255,255,0,
+74,255,234,6,54,6,177,2,2,0,50,0,0,255,255,0,74,255,234,6,161,6,177,2,2,0,
+51,0,0,255,255,0,62,255,234,7,108,4,230,2,2,0,52,0,0,255,255,0,79,255,234,
+6,132,6,177,2,2,0,53,0,0,255,255,0,83,255,234,6,191,6,177,2,2,0,54,0,0,255,
+255,0,74,255,234,6,52,4,230,2,2,0,55,0,0,255,255,0,74,255,234,5,121,6,177,
+2,2,0,56,0,0,255,255,0,74,254,94,6,140,4,230,2,2,0,57,0,0,255,255,0,74,255,
+234,6,54,6,177,2,2,0,58,0,0,255,255,0,78,255,234,7,8,4,230,2,2,0,59,0,0,255,
+255,0,74,255,234,6,8,4,230,2,2,0,60,0,0,255,255,0,62,255,234,6,77,4,230,2,
+2,0,61,0,0,255,255,0,74,255,234,7,83,4,230,2,2,0,62,0,0,255,255,0,68,254,
+79,5,253,4,230,2,2,0,63,0,0,255,255,0,78,255,234,6,114,4,230,2,2,0,64,0,0,
+0,2,0,173,255,235,1,159,5,182,0,3,0,15,0,0,1,35,3,51,3,50,22,21,20,6,35,34,
+38,53,52,54,1,98,117,45,207,105,54,67,65,56,57,64,63,1,156,4,26,251,62,64,
+67,64,70,69,65,65,66,0,4,0,133,4,85,2,202,6,177,0,3,0,7,0,8,0,9,0,0,1,3,35,
+3,33,3,35,3,39,17,1,84,41,125,41,2,69,40,125,41,75,6,101,253,240,2,16,253,
+240,2,16,76,254,53,0,2,0,51,0,0,4,246,5,182,0,27,0,31,0,0,1,3,33,21,33,3,
+35,19,33,3,35,19,33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,19,33,
+3,216,65,1,25,254,205,84,139,84,254,207,80,138,78,254,254,1,28,67,254,237,
+1,43,82,141,82,1,51,82,136,82,1,4,252,228,1,49,66,254,207,3,131,254,172,131,
+254,84,1,172,254,84,1,172,131,1,84,129,1,178,254,78,1,178,254,78,129,254,
+172,1,84,0,5,0,100,255,236,6,66,5,203,0,11,0,23,0,27,0,39,0,50,0,0,1,34,38,
+53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,1,35,1,19,
+34,38,53,52,54,51,50,22,21,20,6,39,50,54,53,16,35,34,6,21,20,22,1,143,146,
+153,151,148,148,160,157,151,82,82,82,82,81,74,74,3,249,252,213,157,3,43,116,
+144,155,149,150,147,161,156,152,83,81,164,81,74,74,2,53,245,216,226,231,235,
+222,227,234,129,166,166,165,165,166,164,165,167,3,0,250,74,5,182,250,54,241,
+219,228,229,238,219,226,234,129,163,168,1,72,164,164,166,165,0,3,0,133,4,
+86,1,84,6,177,0,3,0,4,0,5,0,0,1,3,35,3,55,17,1,84,41,125,41,100,6,102,253,
+240,2,16,75,254,53,0,4,0,112,253,213,2,71,6,177,0,12,0,13,0,14,0,15,0,0,1,
+51,6,2,17,16,1,35,38,2,17,16,18,19,17,17,1,162,165,153,153,1,48,163,145,161,
+162,159,6,101,225,253,237,254,221,253,188,254,59,193,2,33,1,37,1,34,2,44,
+1,23,254,53,248,239,0,4,0,61,253,213,2,20,6,177,0,13,0,14,0,15,0,16,0,0,19,
+35,54,18,17,16,1,51,22,18,18,21,16,2,3,17,19,226,165,154,152,254,208,163,
+99,137,70,162,47,110,254,69,227,2,18,1,34,2,68,1,197,131,254,175,254,138,
+189,254,222,253,212,7,161,254,53,248,239,0,3,0,98,2,232,4,2,6,177,0,14,0,
+15,0,16,0,0,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,39,17,2,144,40,1,126,28,
+254,147,236,171,169,153,177,233,254,150,28,1,122,42,229,6,101,254,131,108,
+184,29,254,198,93,1,91,254,165,93,1,58,29,184,108,1,125,76,254,53,0,2,0,102,
+0,227,4,41,5,182,0,11,0,12,0,0,1,33,21,33,17,35,17,33,53,33,17,51,37,2,145,
+1,152,254,104,147,254,104,1,152,147,254,74,3,27,146,254,90,1,166,146,1,168,
+243,0,1,0,104,254,248,1,157,0,238,0,6,0,0,37,23,6,3,35,18,55,1,144,13,52,
+124,133,74,36,238,23,199,254,232,1,21,225,0,2,0,82,2,59,2,66,4,230,0,3,0,
+4,0,0,19,53,33,21,1,82,1,240,254,167,2,59,152,152,2,171,0,1,0,153,255,235,
+1,139,0,244,0,11,0,0,37,50,22,21,20,6,35,34,38,53,52,54,1,16,55,68,66,57,
+54,65,62,244,63,68,64,70,67,67,65,66,0,4,0,74,253,213,3,27,6,177,0,3,0,4,
+0,5,0,6,0,0,1,1,35,1,39,17,17,3,27,253,207,160,2,50,203,6,101,247,224,8,32,
+76,254,53,248,239,0,2,0,100,255,236,4,47,5,205,0,12,0,24,0,0,5,34,2,17,16,
+18,51,50,22,18,21,16,2,39,50,18,17,16,2,35,34,2,17,16,18,2,72,238,246,238,
+246,162,219,106,242,245,166,151,152,165,165,150,149,20,1,128,1,113,1,128,
+1,112,179,254,176,237,254,130,254,141,141,1,37,1,63,1,62,1,36,254,225,254,
+189,254,189,254,223,0,1,0,189,0,0,2,210,5,182,0,10,0,0,33,35,17,52,55,6,7,
+7,39,1,51,2,210,164,8,34,57,192,94,1,140,137,4,2,165,87,36,47,157,117,1,51,
+0,1,0,98,0,0,4,41,5,203,0,28,0,0,33,33,53,1,62,3,53,52,38,35,34,6,7,39,54,
+51,50,22,22,21,20,6,6,7,1,21,33,4,41,252,57,1,133,110,117,82,37,142,124,99,
+167,99,87,204,244,135,200,108,70,137,168,254,207,2,227,140,1,138,111,128,
+128,124,65,118,133,63,76,109,172,94,178,121,97,176,185,168,254,208,8,0,1,
+0,92,255,236,4,31,5,203,0,43,0,0,1,21,30,2,21,20,4,33,34,38,39,53,22,22,51,
+50,54,53,52,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,54,33,50,22,22,
+21,20,6,2,195,113,159,76,254,223,254,240,128,190,84,93,217,100,188,188,209,
+209,145,147,121,170,84,146,125,105,177,104,80,198,1,3,148,205,100,154,3,2,
+8,14,90,147,95,207,229,38,41,159,45,51,148,148,133,133,141,73,129,85,108,
+121,55,68,113,152,93,164,106,138,181,0,2,0,43,0,0,4,106,5,190,0,10,0,18,0,
+0,1,35,17,35,17,33,53,1,51,17,51,33,17,52,55,35,6,7,1,4,106,219,163,253,63,
+2,176,180,219,254,130,11,9,47,46,254,72,1,88,254,168,1,88,137,3,221,252,44,
+1,218,117,207,106,64,253,140,0,1,0,129,255,236,4,31,5,182,0,29,0,0,55,53,
+22,22,51,50,54,53,52,38,35,34,7,39,19,33,21,33,3,54,51,50,22,22,21,20,0,33,
+34,38,129,75,214,98,175,191,187,186,115,140,90,55,2,221,253,181,39,118,111,
+151,227,122,254,221,255,0,117,198,60,160,45,52,168,156,151,152,30,57,2,173,
+148,254,67,23,101,194,133,227,254,255,41,0,2,0,113,255,236,4,51,5,203,0,24,
+0,38,0,0,1,21,38,35,34,2,3,51,54,51,50,22,21,20,2,35,34,38,2,53,16,0,33,50,
+22,3,52,38,35,34,6,6,21,20,22,22,51,50,54,3,195,78,102,242,247,13,12,113,
+238,198,233,250,215,142,224,131,1,78,1,79,45,105,23,152,142,97,154,81,82,
+149,94,142,159,5,184,147,24,254,220,254,206,172,237,207,227,254,248,141,1,
+36,212,1,173,1,173,10,252,18,146,161,82,126,64,98,180,102,178,0,1,0,90,0,
+0,4,47,5,182,0,6,0,0,33,1,33,53,33,21,1,1,23,2,102,252,221,3,213,253,162,
+5,30,152,132,250,206,0,3,0,100,255,236,4,45,5,203,0,23,0,35,0,48,0,0,1,22,
+22,21,20,4,35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,21,20,6,5,54,54,53,
+52,38,35,34,6,21,20,22,23,6,6,21,20,22,51,50,54,53,52,38,39,2,231,176,150,
+254,252,219,235,255,151,152,133,123,240,197,201,237,134,254,216,139,120,143,
+126,122,143,121,114,147,136,165,152,147,167,153,160,3,6,85,188,122,182,217,
+205,188,125,196,70,76,181,114,159,189,188,162,110,175,7,57,136,93,99,115,
+115,99,92,132,210,62,154,107,116,135,139,118,94,150,60,0,2,0,102,255,236,
+4,41,5,203,0,24,0,38,0,0,51,53,22,51,50,18,19,35,6,35,34,38,38,53,52,18,51,
+50,0,17,16,0,33,34,38,19,20,22,51,50,54,54,53,52,38,38,35,34,6,209,80,103,
+241,249,13,13,113,241,131,191,104,254,213,225,1,15,254,176,254,176,43,110,
+29,150,141,93,152,90,84,148,95,140,159,149,27,1,28,1,55,169,106,197,138,227,
+1,11,254,173,254,206,254,83,254,83,10,3,238,149,158,73,127,71,101,180,100,
+180,0,3,0,173,255,235,1,159,4,230,0,11,0,23,0,24,0,0,1,50,22,21,20,6,35,34,
+38,53,52,54,19,50,22,21,20,6,35,34,38,53,52,54,19,1,36,60,63,66,57,55,64,
+61,58,58,65,66,57,56,63,62,98,4,69,68,65,64,69,68,65,65,68,252,175,67,64,
+64,70,69,65,65,66,3,242,0,3,0,104,254,215,1,160,4,230,0,10,0,17,0,18,0,0,
+1,50,21,20,6,35,34,38,53,52,54,19,23,6,3,35,18,55,19,1,35,123,65,58,56,63,
+61,169,14,54,122,136,80,33,116,4,69,133,64,69,69,64,65,68,252,136,23,206,
+254,239,1,41,205,4,25,0,2,0,102,0,238,4,43,5,182,0,6,0,7,0,0,37,1,53,1,21,
+9,2,4,43,252,59,3,197,252,252,3,4,252,176,238,1,168,102,1,225,160,254,148,
+254,188,4,41,0,3,0,115,1,188,4,29,5,182,0,3,0,7,0,8,0,0,19,53,33,21,1,53,
+33,21,1,115,3,170,252,86,3,170,252,190,3,84,145,145,254,104,146,146,3,250,
+0,2,0,102,0,238,4,43,5,182,0,6,0,7,0,0,19,1,1,53,1,21,1,19,102,3,4,252,252,
+3,197,252,59,117,1,141,1,66,1,110,160,254,31,102,254,88,4,200,0,2,0,42,255,
+235,3,85,5,203,0,30,0,42,0,0,1,53,52,54,55,62,2,53,52,38,35,34,6,7,39,54,
+51,50,22,22,21,20,14,2,7,6,6,21,21,7,50,22,21,20,6,35,34,38,53,52,54,1,48,
+80,97,92,83,37,132,121,82,158,99,59,190,213,128,184,96,30,54,73,85,89,75,
+63,55,64,64,55,59,62,60,1,156,55,124,144,80,76,85,88,63,101,109,39,47,131,
+101,87,162,110,64,98,83,74,72,74,112,101,34,168,66,65,65,69,69,65,65,66,0,
+4,0,164,253,213,2,111,6,177,0,7,0,8,0,9,0,10,0,0,1,33,17,33,21,33,17,33,3,
+17,17,2,111,254,53,1,203,254,209,1,47,190,254,69,8,32,135,248,239,7,228,254,
+53,248,239,0,4,0,74,253,213,3,27,6,177,0,3,0,4,0,5,0,6,0,0,19,1,35,1,37,17,
+17,233,2,50,160,253,207,1,103,6,101,247,224,8,32,76,254,53,248,239,0,4,0,
+91,253,213,2,38,6,177,0,7,0,8,0,9,0,10,0,0,19,33,17,33,53,33,17,33,19,17,
+19,91,1,46,254,210,1,203,254,53,202,140,254,204,7,19,135,247,222,8,109,254,
+53,248,239,0,3,0,78,2,35,4,70,6,177,0,6,0,7,0,8,0,0,19,1,51,1,35,1,1,19,17,
+78,1,178,102,1,224,160,254,143,254,185,85,2,35,3,158,252,98,2,223,253,33,
+4,142,254,53,0,1,255,252,254,197,3,145,255,72,0,3,0,0,1,33,53,33,3,145,252,
+107,3,149,254,197,131,0,4,0,51,253,213,2,195,6,177,0,27,0,28,0,29,0,30,0,
+0,19,54,54,53,17,52,54,51,21,6,21,17,20,7,21,22,21,17,20,23,21,38,38,53,17,
+52,38,35,19,17,19,51,130,125,213,188,240,211,211,240,195,206,122,133,182,
+200,2,154,1,91,99,1,201,154,169,135,6,187,254,57,211,38,13,37,213,254,53,
+188,2,136,1,168,157,1,197,97,96,4,160,254,53,248,239,0,4,1,233,253,213,2,
+127,6,177,0,3,0,4,0,5,0,6,0,0,1,51,17,35,19,17,19,1,233,150,150,44,20,6,101,
+247,225,8,107,254,53,248,239,0,4,0,91,253,213,2,235,6,177,0,28,0,29,0,30,
+0,31,0,0,1,6,6,21,17,20,6,35,53,54,53,17,52,55,53,38,53,17,52,38,39,53,22,
+22,21,17,20,22,51,1,17,19,2,235,134,121,213,188,240,211,211,118,122,200,201,
+122,133,253,254,200,2,16,2,93,96,254,55,154,169,135,6,187,1,199,211,38,13,
+37,213,1,203,95,93,2,136,3,168,155,254,59,97,96,4,24,254,53,248,239,0,2,0,
+102,2,76,4,43,4,230,0,23,0,24,0,0,19,53,54,51,50,22,23,22,22,51,50,54,55,
+21,6,35,34,38,39,38,38,35,34,6,1,102,101,145,70,123,77,67,99,47,55,125,56,
+103,143,71,123,76,69,98,48,52,128,1,21,2,76,160,108,32,33,29,27,64,57,158,
+110,32,33,30,26,66,2,99,255,255,0,82,2,59,2,66,4,230,2,2,2,57,0,0,0,2,0,82,
+2,59,3,174,4,230,0,3,0,4,0,0,19,53,33,21,1,82,3,92,253,59,2,59,152,152,2,
+171,0,2,0,82,2,59,7,174,4,230,0,3,0,4,0,0,19,53,33,21,1,82,7,92,249,59,2,
+59,152,152,2,171,0,3,0,90,4,112,1,143,6,177,0,6,0,7,0,8,0,0,19,39,54,19,51,
+2,7,3,17,102,12,55,121,133,72,39,75,4,112,22,213,1,10,254,245,234,2,65,254,
+53,0,3,0,90,4,112,1,143,6,177,0,6,0,7,0,8,0,0,1,23,6,3,35,18,55,55,17,1,129,
+14,53,123,133,74,36,33,6,101,22,204,254,237,1,24,221,76,254,53,0,4,0,90,4,
+112,3,8,6,177,0,6,0,13,0,14,0,15,0,0,1,39,54,19,51,2,7,33,39,54,19,51,2,7,
+19,17,1,222,14,56,123,133,75,36,253,205,12,56,120,131,75,36,147,4,112,22,
+210,1,13,254,233,222,22,217,1,6,254,233,222,2,65,254,53,0,4,0,90,4,112,3,
+8,6,177,0,6,0,13,0,14,0,15,0,0,1,23,6,3,35,54,55,33,23,6,3,35,18,55,39,17,
+1,127,14,51,125,131,68,40,2,52,14,51,125,136,79,34,144,6,101,22,198,254,231,
+255,246,22,198,254,231,1,39,206,76,254,53,0,3,0,153,255,235,5,187,0,244,0,
+11,0,22,0,34,0,0,37,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,
+38,53,52,33,50,22,21,20,6,35,34,38,53,52,54,1,16,55,68,66,57,54,65,62,2,82,
+55,66,64,57,58,61,2,141,60,64,65,59,57,61,61,244,63,68,64,70,67,67,65,66,
+64,67,64,70,70,64,131,67,64,64,70,71,63,64,67,0,2,0,131,1,14,4,12,5,182,0,
+11,0,12,0,0,1,1,23,1,1,7,1,1,39,1,1,55,3,2,72,1,94,102,254,164,1,90,102,254,
+162,254,170,107,1,90,254,164,107,19,3,57,1,95,105,254,164,254,164,105,1,90,
+254,166,105,1,92,1,90,107,1,30,0,4,0,102,0,248,4,43,5,182,0,11,0,15,0,27,
+0,28,0,0,1,50,22,21,20,6,35,34,38,53,52,54,1,53,33,21,5,50,22,21,20,6,35,
+34,38,53,52,54,1,2,72,55,57,61,51,50,65,58,254,87,3,197,254,29,55,57,61,51,
+50,65,58,254,204,4,170,63,60,60,65,61,64,60,63,253,223,146,146,153,63,60,
+60,65,61,64,60,63,3,198,0,2,0,102,2,137,4,43,5,182,0,3,0,4,0,0,19,53,33,21,
+1,102,3,197,252,176,2,137,146,146,3,45,0,1,0,219,0,0,1,111,4,230,0,3,0,0,
+19,51,17,35,219,148,148,4,230,251,26,0,2,0,219,0,0,2,249,4,230,0,3,0,7,0,
+0,19,51,17,35,1,51,17,35,219,148,148,1,138,148,148,4,230,251,26,4,230,251,
+26,0,1,254,181,254,90,1,75,6,188,0,14,0,0,19,23,7,39,17,35,17,7,39,55,39,
+55,23,55,23,82,249,83,189,118,189,83,249,249,83,248,248,83,5,119,246,82,189,
+249,110,6,146,189,82,246,243,82,248,248,82,0,1,255,197,254,90,0,59,6,115,
+0,3,0,0,3,17,51,17,59,118,254,90,8,25,247,231,0,8,0,117,0,70,4,132,4,94,0,
+7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,0,1,34,53,52,51,50,21,20,5,34,53,52,
+51,50,21,20,33,34,53,52,51,50,21,20,19,34,53,52,51,50,21,20,33,34,53,52,51,
+50,21,20,19,34,53,52,51,50,21,20,33,34,53,52,51,50,21,20,5,34,53,52,51,50,
+21,20,2,126,75,75,73,254,107,75,75,74,2,76,74,74,75,40,75,75,73,252,60,75,
+75,73,41,75,75,74,2,76,74,74,75,254,107,75,75,73,3,201,75,74,74,75,128,74,
+76,76,74,74,76,76,74,254,191,73,76,76,73,73,76,76,73,254,189,75,75,75,75,
+75,75,75,75,127,73,76,76,73,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,
+0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,128,0,3,0,1,4,9,0,3,0,72,
+0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,0,30,0,214,0,3,0,1,4,9,0,
+6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,9,0,8,0,42,1,86,0,3,0,1,
+4,9,0,9,0,40,1,128,0,3,0,1,4,9,0,10,0,96,1,168,0,3,0,1,4,9,0,11,0,62,2,8,
+0,3,0,1,4,9,0,12,0,60,2,70,0,3,0,1,4,9,0,13,2,150,2,130,0,3,0,1,4,9,0,14,
+0,52,5,24,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,
+0,48,0,49,0,52,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,
+99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,
+0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,
+0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,105,0,110,0,104,0,97,0,108,0,97,0,
+82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,
+78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,105,0,110,0,104,
+0,97,0,108,0,97,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,
+48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,83,
+0,105,0,110,0,104,0,97,0,108,0,97,0,78,0,111,0,116,0,111,0,32,0,105,0,115,
+0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,
+111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,
+46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,
+103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,
+116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,
+101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,
+116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,
+0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,
+0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,
+0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,
+0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,
+0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,
+0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,
+0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,
+0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,
+99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,
+0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,
+0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,
+0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,
+0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,
+0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,
+0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,
+0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,
+102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,
+0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,
+0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,
+32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,
+111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,
+0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,
+0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,
+0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,102,0,0,1,2,1,3,0,3,1,4,1,5,1,6,1,7,1,8,
+1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,
+1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,
+1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,
+1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,
+1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,
+1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,
+1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,
+111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,
+1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,
+136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,
+1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,
+161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,
+1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,
+186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,
+1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,
+211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,
+1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,
+236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,
+1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,
+2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,
+2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,
+2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,
+2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,
+2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,
+2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,
+2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,
+2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,
+123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,
+2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,
+148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,
+2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,
+173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,
+2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,
+198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,
+2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,
+223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,
+2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,
+248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,
+3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,
+22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,
+3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,
+3,52,3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,
+3,67,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,
+3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,
+3,97,3,98,3,99,3,100,3,101,4,78,85,76,76,16,110,111,110,109,97,114,107,105,
+110,103,114,101,116,117,114,110,12,97,110,117,115,118,97,114,97,115,105,110,
+104,11,118,105,115,97,114,103,97,115,105,110,104,5,97,115,105,110,104,6,97,
+97,115,105,110,104,6,101,97,115,105,110,104,7,97,97,101,115,105,110,104,5,
+105,115,105,110,104,6,105,105,115,105,110,104,5,117,115,105,110,104,6,117,
+117,115,105,110,104,12,114,118,111,99,97,108,105,99,115,105,110,104,13,114,
+114,118,111,99,97,108,105,99,115,105,110,104,12,108,118,111,99,97,108,105,
+99,115,105,110,104,13,108,108,118,111,99,97,108,105,99,115,105,110,104,5,
+101,115,105,110,104,6,101,101,115,105,110,104,6,97,105,115,105,110,104,5,
+111,115,105,110,104,6,111,111,115,105,110,104,6,97,117,115,105,110,104,6,
+107,97,115,105,110,104,7,107,104,97,115,105,110,104,6,103,97,115,105,110,
+104,7,103,104,97,115,105,110,104,7,110,103,97,115,105,110,104,8,110,110,103,
+97,115,105,110,104,6,99,97,115,105,110,104,7,99,104,97,115,105,110,104,6,
+106,97,115,105,110,104,7,106,104,97,115,105,110,104,7,110,121,97,115,105,
+110,104,8,106,110,121,97,115,105,110,104,8,110,121,106,97,115,105,110,104,
+7,116,116,97,115,105,110,104,8,116,116,104,97,115,105,110,104,7,100,100,97,
+115,105,110,104,8,100,100,104,97,115,105,110,104,7,110,110,97,115,105,110,
+104,9,110,110,100,100,97,115,105,110,104,6,116,97,115,105,110,104,7,116,104,
+97,115,105,110,104,6,100,97,115,105,110,104,7,100,104,97,115,105,110,104,
+6,110,97,115,105,110,104,7,110,100,97,115,105,110,104,6,112,97,115,105,110,
+104,7,112,104,97,115,105,110,104,6,98,97,115,105,110,104,7,98,104,97,115,
+105,110,104,6,109,97,115,105,110,104,7,109,98,97,115,105,110,104,6,121,97,
+115,105,110,104,6,114,97,115,105,110,104,6,108,97,115,105,110,104,6,118,97,
+115,105,110,104,7,115,104,97,115,105,110,104,7,115,115,97,115,105,110,104,
+6,115,97,115,105,110,104,6,104,97,115,105,110,104,7,108,108,97,115,105,110,
+104,6,102,97,115,105,110,104,10,118,105,114,97,109,97,115,105,110,104,15,
+97,97,118,111,119,101,108,115,105,103,110,115,105,110,104,15,97,101,118,111,
+119,101,108,115,105,103,110,115,105,110,104,16,97,97,101,118,111,119,101,
+108,115,105,103,110,115,105,110,104,14,105,118,111,119,101,108,115,105,103,
+110,115,105,110,104,15,105,105,118,111,119,101,108,115,105,103,110,115,105,
+110,104,14,117,118,111,119,101,108,115,105,103,110,115,105,110,104,15,117,
+117,118,111,119,101,108,115,105,103,110,115,105,110,104,21,114,118,111,99,
+97,108,105,99,118,111,119,101,108,115,105,103,110,115,105,110,104,14,101,
+118,111,119,101,108,115,105,103,110,115,105,110,104,7,117,110,105,48,68,68,
+65,15,97,105,118,111,119,101,108,115,105,103,110,115,105,110,104,7,117,110,
+105,48,68,68,67,7,117,110,105,48,68,68,68,7,117,110,105,48,68,68,69,21,108,
+118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,110,115,105,110,
+104,22,114,114,118,111,99,97,108,105,99,118,111,119,101,108,115,105,103,110,
+115,105,110,104,22,108,108,118,111,99,97,108,105,99,118,111,119,101,108,115,
+105,103,110,115,105,110,104,14,107,117,110,100,100,97,108,105,121,97,115,
+105,110,104,16,114,118,111,99,97,108,105,99,98,97,115,101,115,105,110,104,
+8,107,97,118,97,115,105,110,104,9,107,97,115,115,97,115,105,110,104,9,103,
+97,100,104,97,115,105,110,104,9,110,121,97,99,97,115,105,110,104,11,116,116,
+97,116,116,104,97,115,105,110,104,9,116,97,116,104,97,115,105,110,104,8,116,
+97,118,97,115,105,110,104,9,100,97,100,104,97,115,105,110,104,8,100,97,118,
+97,115,105,110,104,9,110,97,116,104,97,115,105,110,104,8,110,97,100,97,115,
+105,110,104,9,110,97,100,104,97,115,105,110,104,8,110,97,118,97,115,105,110,
+104,8,114,101,112,104,115,105,110,104,10,121,97,112,111,115,116,115,105,110,
+104,9,114,97,107,97,114,115,105,110,104,18,111,111,118,111,119,101,108,115,
+105,103,110,97,108,116,115,105,110,104,18,97,101,118,111,119,101,108,115,
+105,103,110,108,111,119,115,105,110,104,19,97,97,101,118,111,119,101,108,
+115,105,103,110,108,111,119,115,105,110,104,8,107,97,114,97,115,105,110,104,
+9,107,104,97,114,97,115,105,110,104,8,103,97,114,97,115,105,110,104,9,103,
+104,97,114,97,115,105,110,104,9,110,103,97,114,97,115,105,110,104,10,110,
+110,103,97,114,97,115,105,110,104,8,99,97,114,97,115,105,110,104,9,99,104,
+97,114,97,115,105,110,104,8,106,97,114,97,115,105,110,104,9,106,104,97,114,
+97,115,105,110,104,9,110,121,97,114,97,115,105,110,104,10,106,110,121,97,
+114,97,115,105,110,104,10,110,121,106,97,114,97,115,105,110,104,9,116,116,
+97,114,97,115,105,110,104,10,116,116,104,97,114,97,115,105,110,104,9,100,
+100,97,114,97,115,105,110,104,10,100,100,104,97,114,97,115,105,110,104,9,
+110,110,97,114,97,115,105,110,104,11,110,110,100,100,97,114,97,115,105,110,
+104,8,116,97,114,97,115,105,110,104,9,116,104,97,114,97,115,105,110,104,8,
+100,97,114,97,115,105,110,104,9,100,104,97,114,97,115,105,110,104,8,110,97,
+114,97,115,105,110,104,9,110,100,97,114,97,115,105,110,104,8,112,97,114,97,
+115,105,110,104,9,112,104,97,114,97,115,105,110,104,8,98,97,114,97,115,105,
+110,104,9,98,104,97,114,97,115,105,110,104,8,109,97,114,97,115,105,110,104,
+9,109,98,97,114,97,115,105,110,104,8,121,97,114,97,115,105,110,104,8,108,
+97,114,97,115,105,110,104,8,118,97,114,97,115,105,110,104,9,115,104,97,114,
+97,115,105,110,104,9,115,115,97,114,97,115,105,110,104,8,115,97,114,97,115,
+105,110,104,8,104,97,114,97,115,105,110,104,9,108,108,97,114,97,115,105,110,
+104,8,102,97,114,97,115,105,110,104,10,107,97,118,97,114,97,115,105,110,104,
+11,107,97,115,115,97,114,97,115,105,110,104,11,103,97,100,104,97,114,97,115,
+105,110,104,11,110,121,97,99,97,114,97,115,105,110,104,13,116,116,97,116,
+116,104,97,114,97,115,105,110,104,11,116,97,116,104,97,114,97,115,105,110,
+104,10,116,97,118,97,114,97,115,105,110,104,11,100,97,100,104,97,114,97,115,
+105,110,104,10,100,97,118,97,114,97,115,105,110,104,11,110,97,116,104,97,
+114,97,115,105,110,104,10,110,97,100,97,114,97,115,105,110,104,11,110,97,
+100,104,97,114,97,115,105,110,104,10,110,97,118,97,114,97,115,105,110,104,
+12,107,97,104,97,108,97,110,116,115,105,110,104,13,107,104,97,104,97,108,
+97,110,116,115,105,110,104,12,103,97,104,97,108,97,110,116,115,105,110,104,
+13,103,104,97,104,97,108,97,110,116,115,105,110,104,13,110,103,97,104,97,
+108,97,110,116,115,105,110,104,14,110,110,103,97,104,97,108,97,110,116,115,
+105,110,104,12,99,97,104,97,108,97,110,116,115,105,110,104,13,99,104,97,104,
+97,108,97,110,116,115,105,110,104,12,106,97,104,97,108,97,110,116,115,105,
+110,104,13,106,104,97,104,97,108,97,110,116,115,105,110,104,13,110,121,97,
+104,97,108,97,110,116,115,105,110,104,14,106,110,121,97,104,97,108,97,110,
+116,115,105,110,104,14,110,121,106,97,104,97,108,97,110,116,115,105,110,104,
+13,116,116,97,104,97,108,97,110,116,115,105,110,104,14,116,116,104,97,104,
+97,108,97,110,116,115,105,110,104,13,100,100,97,104,97,108,97,110,116,115,
+105,110,104,14,100,100,104,97,104,97,108,97,110,116,115,105,110,104,13,110,
+110,97,104,97,108,97,110,116,115,105,110,104,15,110,110,100,100,97,104,97,
+108,97,110,116,115,105,110,104,12,116,97,104,97,108,97,110,116,115,105,110,
+104,13,116,104,97,104,97,108,97,110,116,115,105,110,104,12,100,97,104,97,
+108,97,110,116,115,105,110,104,13,100,104,97,104,97,108,97,110,116,115,105,
+110,104,12,110,97,104,97,108,97,110,116,115,105,110,104,13,110,100,97,104,
+97,108,97,110,116,115,105,110,104,12,112,97,104,97,108,97,110,116,115,105,
+110,104,13,112,104,97,104,97,108,97,110,116,115,105,110,104,12,98,97,104,
+97,108,97,110,116,115,105,110,104,13,98,104,97,104,97,108,97,110,116,115,
+105,110,104,12,109,97,104,97,108,97,110,116,115,105,110,104,13,109,98,97,
+104,97,108,97,110,116,115,105,110,104,12,121,97,104,97,108,97,110,116,115,
+105,110,104,12,114,97,104,97,108,97,110,116,115,105,110,104,12,108,97,104,
+97,108,97,110,116,115,105,110,104,12,118,97,104,97,108,97,110,116,115,105,
+110,104,13,115,104,97,104,97,108,97,110,116,115,105,110,104,13,115,115,97,
+104,97,108,97,110,116,115,105,110,104,12,115,97,104,97,108,97,110,116,115,
+105,110,104,12,104,97,104,97,108,97,110,116,115,105,110,104,13,108,108,97,
+104,97,108,97,110,116,115,105,110,104,12,102,97,104,97,108,97,110,116,115,
+105,110,104,14,107,97,118,97,104,97,108,97,110,116,115,105,110,104,15,107,
+97,115,115,97,104,97,108,97,110,116,115,105,110,104,15,103,97,100,104,97,
+104,97,108,97,110,116,115,105,110,104,15,110,121,97,99,97,104,97,108,97,110,
+116,115,105,110,104,17,116,116,97,116,116,104,97,104,97,108,97,110,116,115,
+105,110,104,15,116,97,116,104,97,104,97,108,97,110,116,115,105,110,104,14,
+116,97,118,97,104,97,108,97,110,116,115,105,110,104,15,100,97,100,104,97,
+104,97,108,97,110,116,115,105,110,104,14,100,97,118,97,104,97,108,97,110,
+116,115,105,110,104,15,110,97,116,104,97,104,97,108,97,110,116,115,105,110,
+104,14,110,97,100,97,104,97,108,97,110,116,115,105,110,104,15,110,97,100,
+104,97,104,97,108,97,110,116,115,105,110,104,14,110,97,118,97,104,97,108,
+97,110,116,115,105,110,104,16,121,97,112,111,115,116,104,97,108,97,110,116,
+115,105,110,104,15,110,121,97,114,97,104,97,108,97,110,116,115,105,110,104,
+16,106,110,121,97,114,97,104,97,108,97,110,116,115,105,110,104,14,100,97,
+114,97,104,97,108,97,110,116,115,105,110,104,15,110,100,97,114,97,104,97,
+108,97,110,116,115,105,110,104,14,108,97,114,97,104,97,108,97,110,116,115,
+105,110,104,16,110,97,100,97,114,97,104,97,108,97,110,116,115,105,110,104,
+16,108,108,97,104,97,108,97,110,116,97,108,116,115,105,110,104,11,107,105,
+118,111,119,101,108,115,105,110,104,12,107,104,105,118,111,119,101,108,115,
+105,110,104,11,103,105,118,111,119,101,108,115,105,110,104,12,103,104,105,
+118,111,119,101,108,115,105,110,104,12,110,103,105,118,111,119,101,108,115,
+105,110,104,13,110,110,103,105,118,111,119,101,108,115,105,110,104,11,99,
+105,118,111,119,101,108,115,105,110,104,12,99,104,105,118,111,119,101,108,
+115,105,110,104,11,106,105,118,111,119,101,108,115,105,110,104,12,106,104,
+105,118,111,119,101,108,115,105,110,104,12,110,121,105,118,111,119,101,108,
+115,105,110,104,14,110,121,97,114,105,118,111,119,101,108,115,105,110,104,
+13,106,110,121,105,118,111,119,101,108,115,105,110,104,15,106,110,121,97,
+114,105,118,111,119,101,108,115,105,110,104,13,110,121,106,105,118,111,119,
+101,108,115,105,110,104,12,116,116,105,118,111,119,101,108,115,105,110,104,
+13,116,116,104,105,118,111,119,101,108,115,105,110,104,12,100,100,105,118,
+111,119,101,108,115,105,110,104,13,100,100,104,105,118,111,119,101,108,115,
+105,110,104,12,110,110,105,118,111,119,101,108,115,105,110,104,14,110,110,
+100,100,105,118,111,119,101,108,115,105,110,104,11,116,105,118,111,119,101,
+108,115,105,110,104,12,116,104,105,118,111,119,101,108,115,105,110,104,11,
+100,105,118,111,119,101,108,115,105,110,104,13,100,97,114,105,118,111,119,
+101,108,115,105,110,104,12,100,104,105,118,111,119,101,108,115,105,110,104,
+11,110,105,118,111,119,101,108,115,105,110,104,12,110,100,105,118,111,119,
+101,108,115,105,110,104,14,110,100,97,114,105,118,111,119,101,108,115,105,
+110,104,11,112,105,118,111,119,101,108,115,105,110,104,12,112,104,105,118,
+111,119,101,108,115,105,110,104,11,98,105,118,111,119,101,108,115,105,110,
+104,12,98,104,105,118,111,119,101,108,115,105,110,104,11,109,105,118,111,
+119,101,108,115,105,110,104,12,109,98,105,118,111,119,101,108,115,105,110,
+104,11,121,105,118,111,119,101,108,115,105,110,104,11,114,105,118,111,119,
+101,108,115,105,110,104,11,108,105,118,111,119,101,108,115,105,110,104,13,
+108,97,114,105,118,111,119,101,108,115,105,110,104,11,118,105,118,111,119,
+101,108,115,105,110,104,12,115,104,105,118,111,119,101,108,115,105,110,104,
+12,115,115,105,118,111,119,101,108,115,105,110,104,11,115,105,118,111,119,
+101,108,115,105,110,104,11,104,105,118,111,119,101,108,115,105,110,104,12,
+108,108,105,118,111,119,101,108,115,105,110,104,14,108,108,97,114,105,118,
+111,119,101,108,115,105,110,104,11,102,105,118,111,119,101,108,115,105,110,
+104,13,107,97,118,105,118,111,119,101,108,115,105,110,104,14,107,97,115,115,
+105,118,111,119,101,108,115,105,110,104,14,103,97,100,104,105,118,111,119,
+101,108,115,105,110,104,14,110,121,97,99,105,118,111,119,101,108,115,105,
+110,104,16,116,116,97,116,116,104,105,118,111,119,101,108,115,105,110,104,
+14,116,97,116,104,105,118,111,119,101,108,115,105,110,104,13,116,97,118,105,
+118,111,119,101,108,115,105,110,104,14,100,97,100,104,105,118,111,119,101,
+108,115,105,110,104,13,100,97,118,105,118,111,119,101,108,115,105,110,104,
+14,110,97,116,104,105,118,111,119,101,108,115,105,110,104,13,110,97,100,105,
+118,111,119,101,108,115,105,110,104,15,110,97,100,97,114,105,118,111,119,
+101,108,115,105,110,104,14,110,97,100,104,105,118,111,119,101,108,115,105,
+110,104,13,110,97,118,105,118,111,119,101,108,115,105,110,104,16,121,97,112,
+111,115,116,105,118,111,119,101,108,115,105,110,104,12,107,105,105,118,111,
+119,101,108,115,105,110,104,13,107,104,105,105,118,111,119,101,108,115,105,
+110,104,12,103,105,105,118,111,119,101,108,115,105,110,104,13,103,104,105,
+105,118,111,119,101,108,115,105,110,104,13,110,103,105,105,118,111,119,101,
+108,115,105,110,104,14,110,110,103,105,105,118,111,119,101,108,115,105,110,
+104,12,99,105,105,118,111,119,101,108,115,105,110,104,13,99,104,105,105,118,
+111,119,101,108,115,105,110,104,12,106,105,105,118,111,119,101,108,115,105,
+110,104,13,106,104,105,105,118,111,119,101,108,115,105,110,104,13,110,121,
+105,105,118,111,119,101,108,115,105,110,104,15,110,121,97,114,105,105,118,
+111,119,101,108,115,105,110,104,14,106,110,121,105,105,118,111,119,101,108,
+115,105,110,104,16,106,110,121,97,114,105,105,118,111,119,101,108,115,105,
+110,104,14,110,121,106,105,105,118,111,119,101,108,115,105,110,104,13,116,
+116,105,105,118,111,119,101,108,115,105,110,104,14,116,116,104,105,105,118,
+111,119,101,108,115,105,110,104,13,100,100,105,105,118,111,119,101,108,115,
+105,110,104,14,100,100,104,105,105,118,111,119,101,108,115,105,110,104,13,
+110,110,105,105,118,111,119,101,108,115,105,110,104,15,110,110,100,100,105,
+105,118,111,119,101,108,115,105,110,104,12,116,105,105,118,111,119,101,108,
+115,105,110,104,13,116,104,105,105,118,111,119,101,108,115,105,110,104,12,
+100,105,105,118,111,119,101,108,115,105,110,104,14,100,97,114,105,105,118,
+111,119,101,108,115,105,110,104,13,100,104,105,105,118,111,119,101,108,115,
+105,110,104,12,110,105,105,118,111,119,101,108,115,105,110,104,13,110,100,
+105,105,118,111,119,101,108,115,105,110,104,15,110,100,97,114,105,105,118,
+111,119,101,108,115,105,110,104,12,112,105,105,118,111,119,101,108,115,105,
+110,104,13,112,104,105,105,118,111,119,101,108,115,105,110,104,12,98,105,
+105,118,111,119,101,108,115,105,110,104,13,98,104,105,105,118,111,119,101,
+108,115,105,110,104,12,109,105,105,118,111,119,101,108,115,105,110,104,13,
+109,98,105,105,118,111,119,101,108,115,105,110,104,12,121,105,105,118,111,
+119,101,108,115,105,110,104,12,114,105,105,118,111,119,101,108,115,105,110,
+104,12,108,105,105,118,111,119,101,108,115,105,110,104,14,108,97,114,105,
+105,118,111,119,101,108,115,105,110,104,12,118,105,105,118,111,119,101,108,
+115,105,110,104,13,115,104,105,105,118,111,119,101,108,115,105,110,104,13,
+115,115,105,105,118,111,119,101,108,115,105,110,104,12,115,105,105,118,111,
+119,101,108,115,105,110,104,12,104,105,105,118,111,119,101,108,115,105,110,
+104,13,108,108,105,105,118,111,119,101,108,115,105,110,104,15,108,108,97,
+114,105,105,118,111,119,101,108,115,105,110,104,12,102,105,105,118,111,119,
+101,108,115,105,110,104,14,107,97,118,105,105,118,111,119,101,108,115,105,
+110,104,15,107,97,115,115,105,105,118,111,119,101,108,115,105,110,104,15,
+103,97,100,104,105,105,118,111,119,101,108,115,105,110,104,15,110,121,97,
+99,105,105,118,111,119,101,108,115,105,110,104,17,116,116,97,116,116,104,
+105,105,118,111,119,101,108,115,105,110,104,15,116,97,116,104,105,105,118,
+111,119,101,108,115,105,110,104,14,116,97,118,105,105,118,111,119,101,108,
+115,105,110,104,15,100,97,100,104,105,105,118,111,119,101,108,115,105,110,
+104,14,100,97,118,105,105,118,111,119,101,108,115,105,110,104,15,110,97,116,
+104,105,105,118,111,119,101,108,115,105,110,104,14,110,97,100,105,105,118,
+111,119,101,108,115,105,110,104,16,110,97,100,97,114,105,105,118,111,119,
+101,108,115,105,110,104,15,110,97,100,104,105,105,118,111,119,101,108,115,
+105,110,104,14,110,97,118,105,105,118,111,119,101,108,115,105,110,104,17,
+121,97,112,111,115,116,105,105,118,111,119,101,108,115,105,110,104,10,107,
+97,114,101,112,104,115,105,110,104,11,107,104,97,114,101,112,104,115,105,
+110,104,10,103,97,114,101,112,104,115,105,110,104,11,103,104,97,114,101,112,
+104,115,105,110,104,11,110,103,97,114,101,112,104,115,105,110,104,12,110,
+110,103,97,114,101,112,104,115,105,110,104,10,99,97,114,101,112,104,115,105,
+110,104,11,99,104,97,114,101,112,104,115,105,110,104,10,106,97,114,101,112,
+104,115,105,110,104,11,106,104,97,114,101,112,104,115,105,110,104,11,110,
+121,97,114,101,112,104,115,105,110,104,12,106,110,121,97,114,101,112,104,
+115,105,110,104,12,110,121,106,97,114,101,112,104,115,105,110,104,11,116,
+116,97,114,101,112,104,115,105,110,104,12,116,116,104,97,114,101,112,104,
+115,105,110,104,11,100,100,97,114,101,112,104,115,105,110,104,12,100,100,
+104,97,114,101,112,104,115,105,110,104,11,110,110,97,114,101,112,104,115,
+105,110,104,13,110,110,100,100,97,114,101,112,104,115,105,110,104,10,116,
+97,114,101,112,104,115,105,110,104,11,116,104,97,114,101,112,104,115,105,
+110,104,10,100,97,114,101,112,104,115,105,110,104,11,100,104,97,114,101,112,
+104,115,105,110,104,10,110,97,114,101,112,104,115,105,110,104,11,110,100,
+97,114,101,112,104,115,105,110,104,10,112,97,114,101,112,104,115,105,110,
+104,11,112,104,97,114,101,112,104,115,105,110,104,10,98,97,114,101,112,104,
+115,105,110,104,11,98,104,97,114,101,112,104,115,105,110,104,10,109,97,114,
+101,112,104,115,105,110,104,11,109,98,97,114,101,112,104,115,105,110,104,
+10,121,97,114,101,112,104,115,105,110,104,10,108,97,114,101,112,104,115,105,
+110,104,10,118,97,114,101,112,104,115,105,110,104,11,115,104,97,114,101,112,
+104,115,105,110,104,11,115,115,97,114,101,112,104,115,105,110,104,10,115,
+97,114,101,112,104,115,105,110,104,10,104,97,114,101,112,104,115,105,110,
+104,11,108,108,97,114,101,112,104,115,105,110,104,10,102,97,114,101,112,104,
+115,105,110,104,12,107,97,118,97,114,101,112,104,115,105,110,104,13,107,97,
+115,115,97,114,101,112,104,115,105,110,104,13,103,97,100,104,97,114,101,112,
+104,115,105,110,104,13,110,121,97,99,97,114,101,112,104,115,105,110,104,15,
+116,116,97,116,116,104,97,114,101,112,104,115,105,110,104,13,116,97,116,104,
+97,114,101,112,104,115,105,110,104,12,116,97,118,97,114,101,112,104,115,105,
+110,104,13,100,97,100,104,97,114,101,112,104,115,105,110,104,12,100,97,118,
+97,114,101,112,104,115,105,110,104,13,110,97,116,104,97,114,101,112,104,115,
+105,110,104,12,110,97,100,97,114,101,112,104,115,105,110,104,13,110,97,100,
+104,97,114,101,112,104,115,105,110,104,12,110,97,118,97,114,101,112,104,115,
+105,110,104,14,121,97,112,111,115,116,114,101,112,104,115,105,110,104,11,
+107,117,118,111,119,101,108,115,105,110,104,12,107,104,117,118,111,119,101,
+108,115,105,110,104,11,103,117,118,111,119,101,108,115,105,110,104,12,103,
+104,117,118,111,119,101,108,115,105,110,104,12,110,103,117,118,111,119,101,
+108,115,105,110,104,13,110,110,103,117,118,111,119,101,108,115,105,110,104,
+11,99,117,118,111,119,101,108,115,105,110,104,12,99,104,117,118,111,119,101,
+108,115,105,110,104,11,106,117,118,111,119,101,108,115,105,110,104,12,106,
+104,117,118,111,119,101,108,115,105,110,104,12,110,121,117,118,111,119,101,
+108,115,105,110,104,13,106,110,121,117,118,111,119,101,108,115,105,110,104,
+13,110,121,106,117,118,111,119,101,108,115,105,110,104,12,116,116,117,118,
+111,119,101,108,115,105,110,104,13,116,116,104,117,118,111,119,101,108,115,
+105,110,104,12,100,100,117,118,111,119,101,108,115,105,110,104,13,100,100,
+104,117,118,111,119,101,108,115,105,110,104,12,110,110,117,118,111,119,101,
+108,115,105,110,104,14,110,110,100,100,117,118,111,119,101,108,115,105,110,
+104,11,116,117,118,111,119,101,108,115,105,110,104,12,116,104,117,118,111,
+119,101,108,115,105,110,104,11,100,117,118,111,119,101,108,115,105,110,104,
+12,100,104,117,118,111,119,101,108,115,105,110,104,11,110,117,118,111,119,
+101,108,115,105,110,104,12,110,100,117,118,111,119,101,108,115,105,110,104,
+11,112,117,118,111,119,101,108,115,105,110,104,12,112,104,117,118,111,119,
+101,108,115,105,110,104,11,98,117,118,111,119,101,108,115,105,110,104,12,
+98,104,117,118,111,119,101,108,115,105,110,104,11,109,117,118,111,119,101,
+108,115,105,110,104,12,109,98,117,118,111,119,101,108,115,105,110,104,11,
+121,117,118,111,119,101,108,115,105,110,104,11,108,117,118,111,119,101,108,
+115,105,110,104,11,118,117,118,111,119,101,108,115,105,110,104,12,115,104,
+117,118,111,119,101,108,115,105,110,104,12,115,115,117,118,111,119,101,108,
+115,105,110,104,11,115,117,118,111,119,101,108,115,105,110,104,11,104,117,
+118,111,119,101,108,115,105,110,104,12,108,108,117,118,111,119,101,108,115,
+105,110,104,11,102,117,118,111,119,101,108,115,105,110,104,13,107,97,118,
+117,118,111,119,101,108,115,105,110,104,14,107,97,115,115,117,118,111,119,
+101,108,115,105,110,104,14,103,97,100,104,117,118,111,119,101,108,115,105,
+110,104,14,110,121,97,99,117,118,111,119,101,108,115,105,110,104,16,116,116,
+97,116,116,104,117,118,111,119,101,108,115,105,110,104,14,116,97,116,104,
+117,118,111,119,101,108,115,105,110,104,13,116,97,118,117,118,111,119,101,
+108,115,105,110,104,14,100,97,100,104,117,118,111,119,101,108,115,105,110,
+104,13,100,97,118,117,118,111,119,101,108,115,105,110,104,14,110,97,116,104,
+117,118,111,119,101,108,115,105,110,104,13,110,97,100,117,118,111,119,101,
+108,115,105,110,104,14,110,97,100,104,117,118,111,119,101,108,115,105,110,
+104,13,110,97,118,117,118,111,119,101,108,115,105,110,104,16,121,97,112,111,
+115,116,117,118,111,119,101,108,115,105,110,104,12,107,117,117,118,111,119,
+101,108,115,105,110,104,13,107,104,117,117,118,111,119,101,108,115,105,110,
+104,12,103,117,117,118,111,119,101,108,115,105,110,104,13,103,104,117,117,
+118,111,119,101,108,115,105,110,104,13,110,103,117,117,118,111,119,101,108,
+115,105,110,104,14,110,110,103,117,117,118,111,119,101,108,115,105,110,104,
+12,99,117,117,118,111,119,101,108,115,105,110,104,13,99,104,117,117,118,111,
+119,101,108,115,105,110,104,12,106,117,117,118,111,119,101,108,115,105,110,
+104,13,106,104,117,117,118,111,119,101,108,115,105,110,104,13,110,121,117,
+117,118,111,119,101,108,115,105,110,104,14,106,110,121,117,117,118,111,119,
+101,108,115,105,110,104,14,110,121,106,117,117,118,111,119,101,108,115,105,
+110,104,13,116,116,117,117,118,111,119,101,108,115,105,110,104,14,116,116,
+104,117,117,118,111,119,101,108,115,105,110,104,13,100,100,117,117,118,111,
+119,101,108,115,105,110,104,14,100,100,104,117,117,118,111,119,101,108,115,
+105,110,104,13,110,110,117,117,118,111,119,101,108,115,105,110,104,15,110,
+110,100,100,117,117,118,111,119,101,108,115,105,110,104,12,116,117,117,118,
+111,119,101,108,115,105,110,104,13,116,104,117,117,118,111,119,101,108,115,
+105,110,104,12,100,117,117,118,111,119,101,108,115,105,110,104,13,100,104,
+117,117,118,111,119,101,108,115,105,110,104,12,110,117,117,118,111,119,101,
+108,115,105,110,104,13,110,100,117,117,118,111,119,101,108,115,105,110,104,
+12,112,117,117,118,111,119,101,108,115,105,110,104,13,112,104,117,117,118,
+111,119,101,108,115,105,110,104,12,98,117,117,118,111,119,101,108,115,105,
+110,104,13,98,104,117,117,118,111,119,101,108,115,105,110,104,12,109,117,
+117,118,111,119,101,108,115,105,110,104,13,109,98,117,117,118,111,119,101,
+108,115,105,110,104,12,121,117,117,118,111,119,101,108,115,105,110,104,12,
+108,117,117,118,111,119,101,108,115,105,110,104,12,118,117,117,118,111,119,
+101,108,115,105,110,104,13,115,104,117,117,118,111,119,101,108,115,105,110,
+104,13,115,115,117,117,118,111,119,101,108,115,105,110,104,12,115,117,117,
+118,111,119,101,108,115,105,110,104,12,104,117,117,118,111,119,101,108,115,
+105,110,104,12,102,117,117,118,111,119,101,108,115,105,110,104,14,107,97,
+118,117,117,118,111,119,101,108,115,105,110,104,15,107,97,115,115,117,117,
+118,111,119,101,108,115,105,110,104,15,103,97,100,104,117,117,118,111,119,
+101,108,115,105,110,104,15,110,121,97,99,117,117,118,111,119,101,108,115,
+105,110,104,17,116,116,97,116,116,104,117,117,118,111,119,101,108,115,105,
+110,104,15,116,97,116,104,117,117,118,111,119,101,108,115,105,110,104,14,
+116,97,118,117,117,118,111,119,101,108,115,105,110,104,15,100,97,100,104,
+117,117,118,111,119,101,108,115,105,110,104,14,100,97,118,117,117,118,111,
+119,101,108,115,105,110,104,15,110,97,116,104,117,117,118,111,119,101,108,
+115,105,110,104,14,110,97,100,117,117,118,111,119,101,108,115,105,110,104,
+15,110,97,100,104,117,117,118,111,119,101,108,115,105,110,104,14,110,97,118,
+117,117,118,111,119,101,108,115,105,110,104,17,121,97,112,111,115,116,117,
+117,118,111,119,101,108,115,105,110,104,13,110,121,97,97,118,111,119,101,
+108,115,105,110,104,14,106,110,121,97,97,118,111,119,101,108,115,105,110,
+104,12,100,97,97,118,111,119,101,108,115,105,110,104,13,110,100,97,97,118,
+111,119,101,108,115,105,110,104,14,110,97,100,97,97,118,111,119,101,108,115,
+105,110,104,19,100,97,114,118,111,99,97,108,105,99,118,111,119,101,108,115,
+105,110,104,20,100,97,114,114,118,111,99,97,108,105,99,118,111,119,101,108,
+115,105,110,104,16,100,111,111,118,111,119,101,108,115,105,103,110,115,105,
+110,104,8,100,97,121,97,115,105,110,104,14,100,97,121,97,104,97,108,97,110,
+116,115,105,110,104,14,100,97,121,97,97,118,111,119,101,108,115,105,110,104,
+14,100,97,121,111,111,118,111,119,101,108,115,105,110,104,12,114,97,101,118,
+111,119,101,108,115,105,110,104,13,114,97,97,101,118,111,119,101,108,115,
+105,110,104,11,107,97,116,111,117,99,104,115,105,110,104,12,107,104,97,116,
+111,117,99,104,115,105,110,104,11,103,97,116,111,117,99,104,115,105,110,104,
+12,103,104,97,116,111,117,99,104,115,105,110,104,12,110,103,97,116,111,117,
+99,104,115,105,110,104,13,110,110,103,97,116,111,117,99,104,115,105,110,104,
+11,99,97,116,111,117,99,104,115,105,110,104,12,99,104,97,116,111,117,99,104,
+115,105,110,104,11,106,97,116,111,117,99,104,115,105,110,104,12,106,104,97,
+116,111,117,99,104,115,105,110,104,12,110,121,97,116,111,117,99,104,115,105,
+110,104,13,106,110,121,97,116,111,117,99,104,115,105,110,104,13,110,121,106,
+97,116,111,117,99,104,115,105,110,104,12,116,116,97,116,111,117,99,104,115,
+105,110,104,13,116,116,104,97,116,111,117,99,104,115,105,110,104,12,100,100,
+97,116,111,117,99,104,115,105,110,104,13,100,100,104,97,116,111,117,99,104,
+115,105,110,104,12,110,110,97,116,111,117,99,104,115,105,110,104,14,110,110,
+100,100,97,116,111,117,99,104,115,105,110,104,11,116,97,116,111,117,99,104,
+115,105,110,104,12,116,104,97,116,111,117,99,104,115,105,110,104,11,100,97,
+116,111,117,99,104,115,105,110,104,12,100,104,97,116,111,117,99,104,115,105,
+110,104,11,110,97,116,111,117,99,104,115,105,110,104,12,110,100,97,116,111,
+117,99,104,115,105,110,104,11,112,97,116,111,117,99,104,115,105,110,104,12,
+112,104,97,116,111,117,99,104,115,105,110,104,11,98,97,116,111,117,99,104,
+115,105,110,104,12,98,104,97,116,111,117,99,104,115,105,110,104,11,109,97,
+116,111,117,99,104,115,105,110,104,12,109,98,97,116,111,117,99,104,115,105,
+110,104,11,121,97,116,111,117,99,104,115,105,110,104,11,114,97,116,111,117,
+99,104,115,105,110,104,11,108,97,116,111,117,99,104,115,105,110,104,11,118,
+97,116,111,117,99,104,115,105,110,104,12,115,104,97,116,111,117,99,104,115,
+105,110,104,12,115,115,97,116,111,117,99,104,115,105,110,104,11,115,97,116,
+111,117,99,104,115,105,110,104,11,104,97,116,111,117,99,104,115,105,110,104,
+12,108,108,97,116,111,117,99,104,115,105,110,104,11,102,97,116,111,117,99,
+104,115,105,110,104,11,101,120,99,108,97,109,46,115,105,110,104,13,113,117,
+111,116,101,100,98,108,46,115,105,110,104,15,110,117,109,98,101,114,115,105,
+103,110,46,115,105,110,104,12,112,101,114,99,101,110,116,46,115,105,110,104,
+16,113,117,111,116,101,115,105,110,103,108,101,46,115,105,110,104,14,112,
+97,114,101,110,108,101,102,116,46,115,105,110,104,15,112,97,114,101,110,114,
+105,103,104,116,46,115,105,110,104,13,97,115,116,101,114,105,115,107,46,115,
+105,110,104,9,112,108,117,115,46,115,105,110,104,10,99,111,109,109,97,46,
+115,105,110,104,11,104,121,112,104,101,110,46,115,105,110,104,11,112,101,
+114,105,111,100,46,115,105,110,104,10,115,108,97,115,104,46,115,105,110,104,
+9,122,101,114,111,46,115,105,110,104,8,111,110,101,46,115,105,110,104,8,116,
+119,111,46,115,105,110,104,10,116,104,114,101,101,46,115,105,110,104,9,102,
+111,117,114,46,115,105,110,104,9,102,105,118,101,46,115,105,110,104,8,115,
+105,120,46,115,105,110,104,10,115,101,118,101,110,46,115,105,110,104,10,101,
+105,103,104,116,46,115,105,110,104,9,110,105,110,101,46,115,105,110,104,10,
+99,111,108,111,110,46,115,105,110,104,14,115,101,109,105,99,111,108,111,110,
+46,115,105,110,104,9,108,101,115,115,46,115,105,110,104,10,101,113,117,97,
+108,46,115,105,110,104,12,103,114,101,97,116,101,114,46,115,105,110,104,13,
+113,117,101,115,116,105,111,110,46,115,105,110,104,16,98,114,97,99,107,101,
+116,108,101,102,116,46,115,105,110,104,14,98,97,99,107,115,108,97,115,104,
+46,115,105,110,104,17,98,114,97,99,107,101,116,114,105,103,104,116,46,115,
+105,110,104,16,97,115,99,105,105,99,105,114,99,117,109,46,115,105,110,104,
+15,117,110,100,101,114,115,99,111,114,101,46,115,105,110,104,14,98,114,97,
+99,101,108,101,102,116,46,115,105,110,104,8,98,97,114,46,115,105,110,104,
+15,98,114,97,99,101,114,105,103,104,116,46,115,105,110,104,15,97,115,99,105,
+105,116,105,108,100,101,46,115,105,110,104,14,115,102,116,104,121,112,104,
+101,110,46,115,105,110,104,11,101,110,100,97,115,104,46,115,105,110,104,11,
+101,109,100,97,115,104,46,115,105,110,104,14,113,117,111,116,101,108,101,
+102,116,46,115,105,110,104,15,113,117,111,116,101,114,105,103,104,116,46,
+115,105,110,104,17,113,117,111,116,101,100,98,108,108,101,102,116,46,115,
+105,110,104,18,113,117,111,116,101,100,98,108,114,105,103,104,116,46,115,
+105,110,104,13,101,108,108,105,112,115,105,115,46,115,105,110,104,13,109,
+117,108,116,105,112,108,121,46,115,105,110,104,11,100,105,118,105,100,101,
+46,115,105,110,104,10,109,105,110,117,115,46,115,105,110,104,10,100,97,110,
+100,97,46,115,105,110,104,13,100,98,108,100,97,110,100,97,46,115,105,110,
+104,7,117,110,105,50,48,48,66,7,117,110,105,50,48,48,68,7,117,110,105,50,
+48,48,67,7,117,110,105,50,53,67,67,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,
+0,12,0,0,0,0,0,172,0,2,0,26,0,4,0,64,0,1,0,65,0,65,0,3,0,66,0,68,0,1,0,69,
+0,72,0,3,0,73,0,84,0,1,0,85,0,97,0,2,0,98,0,98,0,3,0,99,0,99,0,2,0,100,0,
+100,0,3,0,101,0,103,0,1,0,104,0,113,0,3,0,114,0,115,0,2,0,116,0,124,0,3,0,
+125,0,125,0,2,0,126,0,127,0,3,0,128,0,128,0,2,0,129,0,135,0,3,0,136,0,136,
+0,2,0,137,0,141,0,3,0,142,0,142,0,2,0,143,0,153,0,3,0,154,0,154,0,2,0,155,
+0,156,0,3,0,157,2,3,0,2,2,4,2,46,0,1,2,99,2,101,0,1,0,2,0,12,0,65,0,65,0,
+1,0,69,0,70,0,1,0,71,0,72,0,2,0,98,0,98,0,1,0,100,0,100,0,2,0,104,0,113,0,
+2,0,116,0,124,0,2,0,126,0,127,0,2,0,129,0,135,0,2,0,137,0,141,0,2,0,143,0,
+153,0,2,0,155,0,156,0,2,0,1,0,0,0,10,0,32,0,60,0,1,115,105,110,104,0,8,0,
+4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,98,108,119,109,0,14,100,105,115,116,0,20,
+0,0,0,1,0,2,0,0,0,2,0,0,0,1,0,3,0,8,8,194,23,58,0,2,0,8,0,2,0,10,1,252,0,
+1,0,46,0,4,0,0,0,18,0,86,0,92,0,122,0,176,0,214,0,244,1,18,1,48,1,94,1,140,
+1,178,1,184,1,190,1,212,1,218,1,224,1,230,1,236,0,1,0,18,0,12,0,25,0,31,0,
+41,0,51,0,53,0,54,0,56,0,59,0,64,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,0,1,
+0,4,255,163,0,7,0,99,255,231,0,211,255,231,1,24,255,231,1,86,255,231,1,140,
+255,231,1,194,255,231,1,247,255,231,0,13,0,66,255,196,0,67,255,234,0,68,255,
+234,0,80,255,218,0,82,255,218,0,99,255,168,0,101,255,196,0,211,255,168,1,
+24,255,168,1,86,255,168,1,140,255,168,1,194,255,168,1,247,255,168,0,9,0,66,
+255,207,0,99,255,190,0,101,255,207,0,211,255,190,1,24,255,190,1,86,255,190,
+1,140,255,190,1,194,255,190,1,247,255,190,0,7,0,99,255,235,0,211,255,235,
+1,24,255,235,1,86,255,235,1,140,255,235,1,194,255,235,1,247,255,235,0,7,0,
+99,255,241,0,211,255,241,1,24,255,241,1,86,255,241,1,140,255,241,1,194,255,
+241,1,247,255,241,0,7,0,99,255,231,0,211,255,231,1,24,255,231,1,86,255,231,
+1,140,255,231,1,194,255,231,1,247,255,231,0,11,0,66,255,185,0,80,255,232,
+0,82,255,232,0,99,255,157,0,101,255,185,0,211,255,157,1,24,255,157,1,86,255,
+157,1,140,255,157,1,194,255,157,1,247,255,157,0,11,0,66,255,221,0,73,255,
+242,0,81,255,242,0,99,255,191,0,101,255,221,0,211,255,191,1,24,255,191,1,
+86,255,191,1,140,255,191,1,194,255,191,1,247,255,191,0,9,0,66,255,226,0,99,
+255,188,0,101,255,226,0,211,255,188,1,24,255,188,1,86,255,188,1,140,255,188,
+1,194,255,188,1,247,255,188,0,1,0,4,255,46,0,1,0,4,255,116,0,5,0,4,255,86,
+0,67,0,70,0,68,0,70,0,80,255,146,0,82,255,146,0,1,0,4,255,134,0,1,0,4,255,
+26,0,1,0,4,255,116,0,1,0,4,255,116,0,1,0,4,255,116,0,2,0,240,0,4,0,0,2,120,
+6,96,0,16,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,242,255,241,0,0,0,0,
+255,238,0,0,255,190,255,246,255,166,255,235,0,0,0,0,0,0,255,214,0,0,255,193,
+0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,16,255,185,0,0,255,207,0,0,255,187,255,
+229,255,241,0,0,0,0,255,236,0,0,255,209,0,0,0,0,0,0,0,0,0,0,255,232,255,235,
+0,0,0,0,255,246,0,0,255,210,0,0,255,199,255,210,255,236,0,0,0,0,0,27,0,0,
+0,0,0,0,0,18,255,236,0,0,255,202,0,0,255,164,255,244,0,0,0,0,0,0,255,229,
+0,0,0,0,0,0,255,233,255,244,0,0,255,246,0,0,255,215,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,160,0,0,0,0,0,0,255,231,0,0,0,10,255,237,0,0,255,244,0,
+0,255,231,0,0,0,10,255,237,0,1,0,194,0,18,0,19,0,20,0,24,0,26,0,27,0,28,0,
+29,0,30,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,42,0,43,0,44,0,45,
+0,46,0,47,0,48,0,49,0,50,0,52,0,55,0,57,0,58,0,60,0,61,0,62,0,63,0,85,0,86,
+0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,0,99,0,114,0,115,0,
+125,0,128,0,136,0,142,0,154,0,163,0,167,0,168,0,170,0,178,0,181,0,190,0,191,
+0,196,0,198,0,201,0,204,0,206,0,208,0,210,0,211,0,212,0,213,0,214,0,215,0,
+216,0,217,0,218,0,225,0,229,0,230,0,231,0,232,0,234,0,241,0,242,0,243,0,246,
+0,247,0,249,1,0,1,1,1,2,1,7,1,8,1,10,1,13,1,15,1,16,1,18,1,19,1,20,1,21,1,
+23,1,24,1,31,1,35,1,36,1,37,1,38,1,40,1,47,1,48,1,49,1,52,1,53,1,55,1,62,
+1,63,1,64,1,69,1,70,1,72,1,75,1,77,1,78,1,80,1,81,1,82,1,83,1,85,1,86,1,93,
+1,97,1,98,1,100,1,108,1,111,1,119,1,120,1,125,1,127,1,130,1,133,1,135,1,137,
+1,139,1,140,1,147,1,151,1,152,1,154,1,161,1,162,1,165,1,167,1,173,1,174,1,
+179,1,181,1,184,1,186,1,187,1,189,1,190,1,191,1,193,1,194,1,201,1,205,1,206,
+1,208,1,215,1,216,1,219,1,221,1,227,1,228,1,234,1,237,1,239,1,240,1,242,1,
+243,1,244,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,0,2,0,166,0,18,
+0,20,0,7,0,24,0,24,0,2,0,26,0,26,0,3,0,27,0,27,0,8,0,28,0,28,0,12,0,29,0,
+29,0,3,0,30,0,30,0,1,0,32,0,32,0,5,0,33,0,33,0,12,0,34,0,35,0,4,0,36,0,36,
+0,5,0,37,0,37,0,1,0,38,0,38,0,6,0,39,0,39,0,12,0,40,0,40,0,6,0,42,0,42,0,
+12,0,43,0,43,0,10,0,44,0,44,0,7,0,45,0,45,0,4,0,46,0,46,0,12,0,47,0,47,0,
+10,0,48,0,48,0,4,0,49,0,49,0,5,0,50,0,50,0,7,0,52,0,52,0,3,0,55,0,55,0,8,
+0,57,0,57,0,14,0,58,0,58,0,1,0,60,0,60,0,5,0,61,0,61,0,8,0,62,0,62,0,3,0,
+63,0,63,0,9,0,85,0,85,0,1,0,86,0,86,0,5,0,87,0,87,0,12,0,88,0,88,0,1,0,89,
+0,89,0,6,0,90,0,90,0,7,0,91,0,91,0,1,0,92,0,92,0,12,0,93,0,93,0,1,0,94,0,
+94,0,7,0,95,0,95,0,4,0,96,0,96,0,12,0,97,0,97,0,1,0,99,0,99,0,11,0,114,0,
+115,0,4,0,125,0,125,0,4,0,128,0,128,0,4,0,136,0,136,0,15,0,142,0,142,0,7,
+0,154,0,154,0,4,0,163,0,163,0,1,0,167,0,168,0,4,0,170,0,170,0,1,0,178,0,178,
+0,4,0,181,0,181,0,4,0,190,0,190,0,14,0,191,0,191,0,1,0,196,0,196,0,9,0,198,
+0,198,0,1,0,201,0,201,0,1,0,204,0,204,0,1,0,206,0,206,0,1,0,208,0,208,0,4,
+0,210,0,210,0,1,0,211,0,211,0,11,0,212,0,215,0,4,0,216,0,216,0,15,0,217,0,
+217,0,4,0,218,0,218,0,7,0,225,0,225,0,1,0,229,0,232,0,4,0,234,0,234,0,1,0,
+241,0,241,0,7,0,242,0,243,0,4,0,246,0,247,0,4,0,249,0,249,0,7,1,0,1,0,0,14,
+1,1,1,1,0,15,1,2,1,2,0,1,1,7,1,7,0,9,1,8,1,8,0,7,1,10,1,10,0,1,1,13,1,13,
+0,1,1,15,1,15,0,7,1,16,1,16,0,1,1,18,1,18,0,1,1,19,1,19,0,7,1,20,1,21,0,4,
+1,23,1,23,0,1,1,24,1,24,0,11,1,31,1,31,0,1,1,35,1,38,0,4,1,40,1,40,0,1,1,
+47,1,47,0,7,1,48,1,49,0,4,1,52,1,53,0,4,1,55,1,55,0,7,1,62,1,62,0,14,1,63,
+1,63,0,15,1,64,1,64,0,1,1,69,1,69,0,9,1,70,1,70,0,7,1,72,1,72,0,1,1,75,1,
+75,0,1,1,77,1,77,0,7,1,78,1,78,0,1,1,80,1,80,0,1,1,81,1,81,0,7,1,82,1,83,
+0,4,1,85,1,85,0,1,1,86,1,86,0,11,1,93,1,93,0,1,1,97,1,98,0,4,1,100,1,100,
+0,1,1,108,1,108,0,4,1,111,1,111,0,4,1,119,1,119,0,14,1,120,1,120,0,1,1,125,
+1,125,0,9,1,127,1,127,0,1,1,130,1,130,0,1,1,133,1,133,0,1,1,135,1,135,0,1,
+1,137,1,137,0,4,1,139,1,139,0,1,1,140,1,140,0,11,1,147,1,147,0,1,1,151,1,
+152,0,4,1,154,1,154,0,1,1,161,1,161,0,7,1,162,1,162,0,4,1,165,1,165,0,4,1,
+167,1,167,0,7,1,173,1,173,0,14,1,174,1,174,0,1,1,179,1,179,0,7,1,181,1,181,
+0,1,1,184,1,184,0,1,1,186,1,186,0,7,1,187,1,187,0,1,1,189,1,189,0,1,1,190,
+1,190,0,7,1,191,1,191,0,4,1,193,1,193,0,1,1,194,1,194,0,11,1,201,1,201,0,
+1,1,205,1,206,0,4,1,208,1,208,0,1,1,215,1,215,0,7,1,216,1,216,0,4,1,219,1,
+219,0,4,1,221,1,221,0,7,1,227,1,227,0,14,1,228,1,228,0,1,1,234,1,234,0,1,
+1,237,1,237,0,1,1,239,1,239,0,7,1,240,1,240,0,1,1,242,1,242,0,1,1,243,1,243,
+0,7,1,244,1,244,0,4,1,246,1,246,0,1,1,247,1,247,0,11,1,248,1,253,0,13,0,2,
+0,15,0,4,0,4,0,6,0,66,0,66,0,1,0,67,0,68,0,5,0,73,0,73,0,2,0,80,0,80,0,4,
+0,81,0,81,0,2,0,82,0,82,0,4,0,99,0,99,0,3,0,101,0,101,0,1,0,211,0,211,0,3,
+1,24,1,24,0,3,1,86,1,86,0,3,1,140,1,140,0,3,1,194,1,194,0,3,1,247,1,247,0,
+3,0,3,0,0,0,1,0,8,0,1,5,162,1,103,6,6,0,0,6,12,0,0,6,18,0,0,6,24,0,0,6,30,
+0,0,6,36,0,0,6,42,0,0,6,48,0,0,6,54,0,0,6,60,0,0,6,66,0,0,6,72,0,0,6,78,0,
+0,6,84,0,0,6,90,0,0,6,96,0,0,6,102,0,0,6,108,0,0,6,114,0,0,6,120,0,0,6,126,
+0,0,6,132,0,0,6,138,0,0,6,144,0,0,6,150,0,0,6,156,0,0,6,162,0,0,6,168,0,0,
+6,174,0,0,6,180,0,0,6,186,0,0,6,192,0,0,6,198,0,0,6,204,0,0,6,210,0,0,6,216,
+0,0,6,222,0,0,6,228,0,0,6,234,0,0,6,240,0,0,6,246,0,0,6,252,0,0,7,2,0,0,7,
+8,0,0,7,14,0,0,7,20,0,0,7,26,0,0,7,32,0,0,7,38,0,0,7,44,0,0,7,50,0,0,7,56,
+0,0,7,62,0,0,7,68,0,0,7,74,0,0,7,80,0,0,7,86,0,0,7,92,0,0,7,98,0,0,7,104,
+0,0,7,110,0,0,7,116,0,0,7,122,0,0,7,128,0,0,7,134,0,0,7,140,0,0,7,146,0,0,
+7,152,0,0,7,158,0,0,7,164,0,0,7,170,0,0,7,176,0,0,7,182,0,0,7,188,0,0,7,194,
+0,0,7,200,0,0,7,206,0,0,7,212,0,0,7,218,0,0,7,224,0,0,7,230,0,0,7,236,0,0,
+7,242,0,0,7,248,0,0,7,254,0,0,8,4,0,0,8,10,0,0,8,16,0,0,8,22,0,0,8,28,0,0,
+8,34,0,0,8,40,0,0,8,46,0,0,8,52,0,0,8,58,0,0,8,64,0,0,8,70,0,0,8,76,0,0,8,
+82,0,0,8,88,0,0,8,94,0,0,8,100,0,0,8,106,0,0,8,112,0,0,8,118,0,0,8,124,0,
+0,8,130,0,0,8,136,0,0,8,142,0,0,8,148,0,0,8,154,0,0,8,160,0,0,8,166,0,0,8,
+172,0,0,8,178,0,0,8,184,0,0,8,190,0,0,8,196,0,0,8,202,0,0,8,208,0,0,8,214,
+0,0,8,220,0,0,8,226,0,0,8,232,0,0,8,238,0,0,8,244,0,0,8,250,0,0,9,0,0,0,9,
+6,0,0,9,12,0,0,9,18,0,0,9,24,0,0,9,30,0,0,9,36,0,0,9,42,0,0,9,48,0,0,9,54,
+0,0,9,60,0,0,9,66,0,0,9,72,0,0,9,78,0,0,9,84,0,0,9,90,0,0,9,96,0,0,9,102,
+0,0,9,108,0,0,9,114,0,0,9,120,0,0,9,126,0,0,9,132,0,0,9,138,0,0,9,144,0,0,
+9,150,0,0,9,156,0,0,9,162,0,0,9,168,0,0,9,174,0,0,9,180,0,0,9,186,0,0,9,192,
+0,0,9,198,0,0,9,204,0,0,9,210,0,0,9,216,0,0,9,222,0,0,9,228,0,0,9,234,0,0,
+9,240,0,0,9,246,0,0,9,252,0,0,10,2,0,0,10,8,0,0,10,14,0,0,10,20,0,0,10,26,
+0,0,10,32,0,0,10,38,0,0,10,44,0,0,10,50,0,0,10,56,0,0,10,62,0,0,10,68,0,0,
+10,74,0,0,10,80,0,0,10,86,0,0,10,92,0,0,10,98,0,0,10,104,0,0,10,110,0,0,10,
+116,0,0,10,122,0,0,10,128,0,0,10,134,0,0,10,140,0,0,10,146,0,0,10,152,0,0,
+10,158,0,0,10,164,0,0,10,170,0,0,10,176,0,0,10,182,0,0,10,188,0,0,10,194,
+0,0,10,200,0,0,10,206,0,0,10,212,0,0,10,218,0,0,10,224,0,0,10,230,0,0,10,
+236,0,0,10,242,0,0,10,248,0,0,10,254,0,0,11,4,0,0,11,10,0,0,11,16,0,0,11,
+22,0,0,11,28,0,0,11,34,0,0,11,40,0,0,11,46,0,0,11,52,0,0,11,58,0,0,11,64,
+0,0,11,70,0,0,11,76,0,0,11,82,0,0,11,88,0,0,11,94,0,0,11,100,0,0,11,106,0,
+0,11,112,0,0,11,118,0,0,11,124,0,0,11,130,0,0,11,136,0,0,11,142,0,0,11,148,
+0,0,11,154,0,0,11,160,0,0,11,166,0,0,11,172,0,0,11,178,0,0,11,184,0,0,11,
+190,0,0,11,196,0,0,11,202,0,0,11,208,0,0,11,214,0,0,11,220,0,0,11,226,0,0,
+11,232,0,0,11,238,0,0,11,244,0,0,11,250,0,0,12,0,0,0,12,6,0,0,12,12,0,0,12,
+18,0,0,12,24,0,0,12,30,0,0,12,36,0,0,12,42,0,0,12,48,0,0,12,54,0,0,12,60,
+0,0,12,66,0,0,12,72,0,0,12,78,0,0,12,84,0,0,12,90,0,0,12,96,0,0,12,102,0,
+0,12,108,0,0,12,114,0,0,12,120,0,0,12,126,0,0,12,132,0,0,12,138,0,0,12,144,
+0,0,12,150,0,0,12,156,0,0,12,162,0,0,12,168,0,0,12,174,0,0,12,180,0,0,12,
+186,0,0,12,192,0,0,12,198,0,0,12,204,0,0,12,210,0,0,12,216,0,0,12,222,0,0,
+12,228,0,0,12,234,0,0,12,240,0,0,12,246,0,0,12,252,0,0,13,2,0,0,13,8,0,0,
+13,14,0,0,13,20,0,0,13,26,0,0,13,32,0,0,13,38,0,0,13,44,0,0,13,50,0,0,13,
+56,0,0,13,62,0,0,13,68,0,0,13,74,0,0,13,80,0,0,13,86,0,0,13,92,0,0,13,98,
+0,0,13,104,0,0,13,110,0,0,13,116,0,0,0,0,13,122,0,0,13,128,0,0,13,134,0,0,
+13,140,0,0,13,146,0,0,13,152,0,0,13,158,0,0,13,164,0,0,13,170,0,0,13,176,
+0,0,13,182,0,0,13,188,0,0,13,194,0,0,13,200,0,0,13,206,0,0,13,212,0,0,13,
+218,0,0,13,224,0,0,13,230,0,0,13,236,0,0,13,242,0,0,13,248,0,0,13,254,0,0,
+14,4,0,0,14,10,0,0,14,16,0,0,14,22,0,0,14,28,0,0,14,34,0,0,14,40,0,0,14,46,
+0,0,14,52,0,0,14,58,0,0,14,64,0,0,14,70,0,0,14,76,0,0,14,82,0,0,14,88,0,0,
+14,94,0,0,14,100,0,0,14,106,0,2,0,16,0,24,0,64,0,0,0,114,0,115,0,41,0,125,
+0,125,0,43,0,128,0,128,0,44,0,136,0,136,0,45,0,142,0,142,0,46,0,157,0,197,
+0,47,0,212,0,216,0,88,0,218,1,9,0,93,1,25,1,71,0,141,1,87,1,126,0,188,1,141,
+1,180,0,228,1,195,1,233,1,12,1,248,1,251,1,51,1,253,2,3,1,55,2,6,2,46,1,62,
+0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,92,0,0,0,1,0,112,0,0,0,1,0,
+97,0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,74,0,0,0,1,0,94,0,0,
+0,1,0,97,0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,
+92,0,0,0,1,0,120,0,0,0,1,0,94,0,0,0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,104,0,
+0,0,1,0,104,0,0,0,1,0,148,0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,
+1,0,104,0,0,0,1,0,92,0,0,0,1,0,107,0,0,0,1,0,113,0,0,0,1,0,104,0,0,0,1,0,
+104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,104,0,0,0,1,0,92,
+0,0,0,1,0,104,0,0,0,1,0,128,0,0,0,1,0,108,0,0,0,1,0,94,0,0,0,1,0,97,0,0,0,
+1,0,104,0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,94,0,0,0,1,0,74,0,0,0,1,0,104,
+0,0,0,1,0,108,0,0,0,1,0,92,0,0,0,1,0,112,0,0,0,1,0,97,0,0,0,1,0,92,0,0,0,
+1,0,104,0,0,0,1,0,104,0,0,0,1,0,74,0,0,0,1,0,94,0,0,0,1,0,97,0,0,0,1,0,94,
+0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,92,0,0,0,1,0,120,0,0,0,
+1,0,94,0,0,0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,148,
+0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,
+1,0,107,0,0,0,1,0,113,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,
+104,0,0,0,1,0,108,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,128,
+0,0,0,1,0,108,0,0,0,1,0,94,0,0,0,1,0,97,0,0,0,1,0,104,0,0,0,1,0,94,0,0,0,
+1,0,104,0,0,0,1,0,94,0,0,0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,92,
+0,0,0,1,0,112,0,0,0,1,0,97,0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,
+1,0,74,0,0,0,1,0,94,0,0,0,1,0,94,0,0,0,1,0,97,0,0,0,1,0,97,0,0,0,1,0,94,0,
+0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,92,0,0,0,1,0,120,0,0,0,1,
+0,94,0,0,0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,
+0,0,0,1,0,148,0,0,0,1,0,94,0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,
+1,0,104,0,0,0,1,0,92,0,0,0,1,0,107,0,0,0,1,0,113,0,0,0,1,0,104,0,0,0,1,0,
+104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,104,
+0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,128,0,0,0,1,0,94,0,0,0,1,0,108,0,0,0,
+1,0,74,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,92,0,0,0,1,0,112,0,0,0,1,0,97,
+0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,74,0,0,0,1,0,94,0,0,0,
+1,0,94,0,0,0,1,0,97,0,0,0,1,0,97,0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,
+0,0,0,1,0,92,0,0,0,1,0,92,0,0,0,1,0,120,0,0,0,1,0,94,0,0,0,1,0,74,0,0,0,1,
+0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,148,0,0,0,1,0,94,
+0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,
+1,0,107,0,0,0,1,0,113,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,
+104,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,104,
+0,0,0,1,0,128,0,0,0,1,0,94,0,0,0,1,0,108,0,0,0,1,0,74,0,0,0,1,0,104,0,0,0,
+1,0,108,0,0,0,1,0,92,0,0,0,1,0,112,0,0,0,1,0,97,0,0,0,1,0,92,0,0,0,1,0,104,
+0,0,0,1,0,104,0,0,0,1,0,74,0,0,0,1,0,94,0,0,0,1,0,97,0,0,0,1,0,94,0,0,0,1,
+0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,92,0,0,0,1,0,120,0,0,0,1,0,94,
+0,0,0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,148,0,0,
+0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,
+107,0,0,0,1,0,113,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,108,
+0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,128,0,0,0,1,0,108,0,0,
+0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,92,0,0,0,1,0,112,0,0,0,1,0,
+97,0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,74,0,0,0,1,0,94,0,0,
+0,1,0,97,0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,
+92,0,0,0,1,0,120,0,0,0,1,0,94,0,0,0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,104,0,
+0,0,1,0,104,0,0,0,1,0,148,0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,
+1,0,104,0,0,0,1,0,92,0,0,0,1,0,107,0,0,0,1,0,113,0,0,0,1,0,104,0,0,0,1,0,
+104,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,104,
+0,0,0,1,0,128,0,0,0,1,0,108,0,0,0,1,0,74,0,0,0,1,0,104,0,0,0,1,0,108,0,0,
+0,1,0,92,0,0,0,1,0,112,0,0,0,1,0,97,0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,
+104,0,0,0,1,0,74,0,0,0,1,0,94,0,0,0,1,0,97,0,0,0,1,0,94,0,0,0,1,0,104,0,0,
+0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,92,0,0,0,1,0,120,0,0,0,1,0,94,0,0,0,1,0,
+74,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,148,0,0,0,1,0,94,0,
+0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,92,0,0,0,1,0,107,0,0,0,
+1,0,113,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,
+104,0,0,0,1,0,92,0,0,0,1,0,104,0,0,0,1,0,108,0,0,0,1,0,94,0,0,0,1,0,97,0,
+0,0,1,0,104,0,0,0,1,0,94,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,
+1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,0,104,0,0,0,1,7,166,0,0,0,1,6,
+150,0,0,0,1,6,214,0,0,0,1,6,47,0,0,0,1,6,175,0,0,0,1,8,26,0,0,0,1,6,29,0,
+0,0,1,5,255,0,0,0,1,5,234,0,0,0,1,11,8,0,0,0,1,9,219,0,0,0,1,8,213,0,0,0,
+1,6,253,0,0,0,1,5,239,0,0,0,1,6,100,0,0,0,1,6,120,0,0,0,1,6,125,0,0,0,1,9,
+55,0,0,0,1,7,144,0,0,0,1,7,46,0,0,0,1,6,2,0,0,0,1,4,22,0,0,0,1,6,95,0,0,0,
+1,7,77,0,0,0,1,4,241,0,0,0,1,5,234,0,0,0,1,6,24,0,0,0,1,6,131,0,0,0,1,7,78,
+0,0,0,1,6,102,0,0,0,1,6,161,0,0,0,1,6,22,0,0,0,1,5,83,0,0,0,1,6,110,0,0,0,
+1,6,24,0,0,0,1,6,234,0,0,0,1,5,234,0,0,0,1,6,46,0,0,0,1,7,53,0,0,0,1,5,183,
+0,0,0,1,6,84,0,0,0,4,0,0,0,1,0,8,0,1,0,12,0,64,0,1,0,122,2,82,0,2,0,8,0,100,
+0,100,0,0,0,104,0,113,0,1,0,116,0,124,0,11,0,126,0,127,0,20,0,129,0,135,0,
+22,0,137,0,141,0,29,0,143,0,153,0,34,0,155,0,156,0,45,0,2,0,9,0,24,0,33,0,
+0,0,36,0,44,0,10,0,46,0,47,0,19,0,49,0,56,0,21,0,58,0,62,0,29,0,64,0,64,0,
+34,0,85,0,94,0,35,0,96,0,97,0,45,0,99,0,99,0,47,0,47,0,0,0,190,0,0,0,196,
+0,0,0,202,0,0,0,208,0,0,0,214,0,0,0,220,0,0,0,226,0,0,0,232,0,0,0,238,0,0,
+0,244,0,0,0,250,0,0,1,0,0,0,1,6,0,0,1,12,0,0,1,18,0,0,1,24,0,0,1,30,0,0,1,
+36,0,0,1,42,0,0,1,48,0,0,1,54,0,0,1,60,0,0,1,66,0,0,1,72,0,0,1,78,0,0,1,84,
+0,0,1,90,0,0,1,96,0,0,1,102,0,0,1,108,0,0,1,114,0,0,1,120,0,0,1,126,0,0,1,
+132,0,0,1,138,0,0,1,144,0,0,1,150,0,0,1,156,0,0,1,162,0,0,1,168,0,0,1,174,
+0,0,1,180,0,0,1,186,0,0,1,192,0,0,1,198,0,0,1,204,0,0,1,210,0,1,0,0,255,226,
+0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,
+226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,
+0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,
+0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,
+226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,
+0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,
+0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,
+226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,
+0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,
+0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,1,0,0,255,226,0,48,0,98,
+0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,
+176,0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,
+0,254,1,4,1,10,1,16,1,22,1,28,1,34,1,40,1,46,1,52,1,58,1,64,1,70,1,76,1,82,
+1,88,1,94,1,100,1,106,1,112,1,118,1,124,0,1,8,14,255,226,0,1,7,7,255,226,
+0,1,7,66,255,226,0,1,6,151,255,226,0,1,7,32,255,226,0,1,8,134,255,226,0,1,
+6,132,255,226,0,1,6,103,255,226,0,1,6,82,255,226,0,1,11,121,255,226,0,1,7,
+101,255,226,0,1,6,85,255,226,0,1,6,208,255,226,0,1,6,233,255,226,0,1,6,233,
+255,226,0,1,9,168,255,226,0,1,8,1,255,226,0,1,7,150,255,226,0,1,6,106,255,
+226,0,1,6,208,255,226,0,1,7,181,255,226,0,1,6,82,255,226,0,1,6,127,255,226,
+0,1,6,239,255,226,0,1,7,186,255,226,0,1,6,205,255,226,0,1,7,19,255,226,0,
+1,6,126,255,226,0,1,5,157,255,226,0,1,6,127,255,226,0,1,7,86,255,226,0,1,
+6,82,255,226,0,1,6,151,255,226,0,1,7,161,255,226,0,1,6,192,255,226,0,1,11,
+35,255,226,0,1,11,34,255,226,0,1,10,91,255,226,0,1,7,140,255,226,0,1,8,14,
+255,226,0,1,10,139,255,226,0,1,10,160,255,226,0,1,8,14,255,226,0,1,7,140,
+255,226,0,1,10,170,255,226,0,1,11,21,255,226,0,1,10,191,255,226,0,1,5,10,
+255,226,0,0,0,1,0,0,0,10,0,44,0,156,0,1,115,105,110,104,0,8,0,4,0,0,0,0,255,
+255,0,8,0,1,0,6,0,7,0,4,0,3,0,0,0,2,0,5,0,8,97,98,118,115,0,50,97,107,104,
+110,0,64,98,108,119,115,0,70,112,114,101,115,0,76,112,115,116,102,0,82,112,
+115,116,115,0,88,114,112,104,102,0,100,118,97,116,117,0,106,0,0,0,5,0,6,0,
+8,0,9,0,10,0,57,0,0,0,1,0,0,0,0,0,1,0,58,0,0,0,1,0,4,0,0,0,1,0,3,0,0,0,4,
+0,59,0,60,0,62,0,64,0,0,0,1,0,1,0,0,0,1,0,2,0,66,0,134,1,94,1,128,1,172,1,
+206,2,24,4,110,4,172,4,194,5,54,5,100,8,92,8,112,8,132,8,152,8,172,8,192,
+8,212,8,232,8,252,9,16,9,36,9,56,9,76,9,96,9,116,9,136,9,156,9,176,9,196,
+9,216,9,236,10,0,10,20,10,40,10,60,10,80,10,100,10,120,10,140,10,160,10,180,
+10,200,10,220,10,240,11,4,11,24,11,44,11,64,11,84,11,104,11,124,11,144,11,
+164,11,184,11,204,11,224,11,244,23,144,27,234,28,126,28,162,28,190,28,252,
+29,18,29,88,0,4,0,0,0,1,0,8,0,1,0,190,0,7,0,20,0,46,0,60,0,74,0,88,0,114,
+0,140,0,2,0,6,0,16,0,85,0,4,0,65,2,99,0,58,0,86,0,4,0,65,2,99,0,60,0,1,0,
+4,0,87,0,4,0,65,2,99,0,46,0,1,0,4,0,88,0,4,0,65,2,99,0,30,0,1,0,4,0,89,0,
+4,0,65,2,99,0,38,0,2,0,6,0,16,0,90,0,4,0,65,2,99,0,44,0,91,0,4,0,65,2,99,
+0,58,0,2,0,6,0,16,0,92,0,4,0,65,2,99,0,46,0,93,0,4,0,65,2,99,0,58,0,4,0,10,
+0,20,0,30,0,40,0,94,0,4,0,65,2,99,0,44,0,95,0,4,0,65,2,99,0,45,0,96,0,4,0,
+65,2,99,0,46,0,97,0,4,0,65,2,99,0,58,0,1,0,7,0,24,0,26,0,34,0,37,0,43,0,45,
+0,47,0,4,0,0,0,1,0,8,0,1,0,20,0,1,0,8,0,1,0,4,0,98,0,3,0,65,2,99,0,1,0,1,
+0,56,0,4,0,0,0,1,0,8,0,1,0,30,0,1,0,8,0,2,0,6,0,14,0,99,0,3,2,99,0,55,0,100,
+0,3,2,99,0,56,0,1,0,1,0,65,0,1,0,0,0,1,0,8,0,2,0,14,0,4,0,65,0,66,0,101,0,
+80,0,1,0,4,0,75,0,77,0,78,0,79,0,5,0,0,0,1,0,8,0,2,0,16,0,26,0,4,0,0,0,48,
+0,0,0,0,0,2,0,1,0,24,0,64,0,0,0,2,0,3,0,24,0,64,0,1,0,65,0,65,0,3,2,99,2,
+99,0,2,0,1,0,4,0,4,0,1,0,2,0,3,0,1,0,0,0,5,0,4,0,0,0,1,0,8,0,1,2,68,0,41,
+0,88,0,100,0,112,0,124,0,136,0,148,0,160,0,172,0,184,0,196,0,208,0,220,0,
+232,0,244,1,0,1,12,1,24,1,36,1,48,1,60,1,72,1,84,1,96,1,108,1,120,1,132,1,
+144,1,156,1,168,1,180,1,192,1,204,1,216,1,228,1,240,1,252,2,8,2,20,2,32,2,
+44,2,56,0,1,0,4,2,6,0,3,2,99,0,65,0,1,0,4,2,7,0,3,2,99,0,65,0,1,0,4,2,8,0,
+3,2,99,0,65,0,1,0,4,2,9,0,3,2,99,0,65,0,1,0,4,2,10,0,3,2,99,0,65,0,1,0,4,
+2,11,0,3,2,99,0,65,0,1,0,4,2,12,0,3,2,99,0,65,0,1,0,4,2,13,0,3,2,99,0,65,
+0,1,0,4,2,14,0,3,2,99,0,65,0,1,0,4,2,15,0,3,2,99,0,65,0,1,0,4,2,16,0,3,2,
+99,0,65,0,1,0,4,2,17,0,3,2,99,0,65,0,1,0,4,2,18,0,3,2,99,0,65,0,1,0,4,2,19,
+0,3,2,99,0,65,0,1,0,4,2,20,0,3,2,99,0,65,0,1,0,4,2,21,0,3,2,99,0,65,0,1,0,
+4,2,22,0,3,2,99,0,65,0,1,0,4,2,23,0,3,2,99,0,65,0,1,0,4,2,24,0,3,2,99,0,65,
+0,1,0,4,2,25,0,3,2,99,0,65,0,1,0,4,2,26,0,3,2,99,0,65,0,1,0,4,2,27,0,3,2,
+99,0,65,0,1,0,4,2,28,0,3,2,99,0,65,0,1,0,4,2,29,0,3,2,99,0,65,0,1,0,4,2,30,
+0,3,2,99,0,65,0,1,0,4,2,31,0,3,2,99,0,65,0,1,0,4,2,32,0,3,2,99,0,65,0,1,0,
+4,2,33,0,3,2,99,0,65,0,1,0,4,2,34,0,3,2,99,0,65,0,1,0,4,2,35,0,3,2,99,0,65,
+0,1,0,4,2,36,0,3,2,99,0,65,0,1,0,4,2,37,0,3,2,99,0,65,0,1,0,4,2,38,0,3,2,
+99,0,65,0,1,0,4,2,39,0,3,2,99,0,65,0,1,0,4,2,40,0,3,2,99,0,65,0,1,0,4,2,41,
+0,3,2,99,0,65,0,1,0,4,2,42,0,3,2,99,0,65,0,1,0,4,2,43,0,3,2,99,0,65,0,1,0,
+4,2,44,0,3,2,99,0,65,0,1,0,4,2,45,0,3,2,99,0,65,0,1,0,4,2,46,0,3,2,99,0,65,
+0,2,0,1,0,24,0,64,0,0,0,6,2,0,0,1,0,8,0,1,0,10,0,2,0,18,0,36,0,1,0,2,0,71,
+0,72,0,1,0,4,0,1,0,100,0,1,0,0,0,1,0,0,0,7,0,1,0,4,0,1,0,100,0,1,0,0,0,1,
+0,0,0,7,0,1,0,0,0,1,0,8,0,1,0,6,0,31,0,1,0,2,0,71,0,72,0,4,2,0,0,1,0,8,0,
+1,0,90,0,7,0,20,0,30,0,40,0,50,0,60,0,70,0,80,0,1,0,4,0,114,0,2,0,100,0,1,
+0,4,0,115,0,2,0,100,0,1,0,4,0,125,0,2,0,100,0,1,0,4,0,128,0,2,0,100,0,1,0,
+4,0,136,0,2,0,100,0,1,0,4,0,142,0,2,0,100,0,1,0,4,0,154,0,2,0,100,0,1,0,7,
+0,34,0,35,0,45,0,48,0,57,0,63,0,95,0,4,0,0,0,1,0,8,0,1,0,30,0,2,0,10,0,20,
+0,1,0,4,0,101,0,2,0,65,0,1,0,4,1,140,0,2,0,99,0,1,0,2,0,66,0,98,0,6,2,0,0,
+1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,0,100,0,46,0,94,0,108,0,122,0,136,0,150,0,
+164,0,178,0,192,0,206,0,220,0,234,0,248,1,6,1,20,1,34,1,48,1,62,1,76,1,90,
+1,104,1,118,1,132,1,146,1,160,1,174,1,188,1,202,1,216,1,230,1,244,2,2,2,16,
+2,30,2,44,2,58,2,72,2,86,2,100,2,114,2,128,2,142,2,156,2,170,2,184,2,198,
+2,212,0,1,0,24,0,1,0,0,0,1,0,0,0,11,0,1,0,25,0,1,0,0,0,1,0,0,0,12,0,1,0,26,
+0,1,0,0,0,1,0,0,0,13,0,1,0,27,0,1,0,0,0,1,0,0,0,14,0,1,0,28,0,1,0,0,0,1,0,
+0,0,15,0,1,0,29,0,1,0,0,0,1,0,0,0,16,0,1,0,30,0,1,0,0,0,1,0,0,0,17,0,1,0,
+31,0,1,0,0,0,1,0,0,0,18,0,1,0,32,0,1,0,0,0,1,0,0,0,19,0,1,0,33,0,1,0,0,0,
+1,0,0,0,20,0,1,0,36,0,1,0,0,0,1,0,0,0,21,0,1,0,37,0,1,0,0,0,1,0,0,0,22,0,
+1,0,38,0,1,0,0,0,1,0,0,0,23,0,1,0,39,0,1,0,0,0,1,0,0,0,24,0,1,0,40,0,1,0,
+0,0,1,0,0,0,25,0,1,0,41,0,1,0,0,0,1,0,0,0,26,0,1,0,42,0,1,0,0,0,1,0,0,0,27,
+0,1,0,43,0,1,0,0,0,1,0,0,0,28,0,1,0,44,0,1,0,0,0,1,0,0,0,29,0,1,0,46,0,1,
+0,0,0,1,0,0,0,30,0,1,0,47,0,1,0,0,0,1,0,0,0,31,0,1,0,49,0,1,0,0,0,1,0,0,0,
+32,0,1,0,50,0,1,0,0,0,1,0,0,0,33,0,1,0,51,0,1,0,0,0,1,0,0,0,34,0,1,0,52,0,
+1,0,0,0,1,0,0,0,35,0,1,0,53,0,1,0,0,0,1,0,0,0,36,0,1,0,54,0,1,0,0,0,1,0,0,
+0,37,0,1,0,55,0,1,0,0,0,1,0,0,0,38,0,1,0,58,0,1,0,0,0,1,0,0,0,39,0,1,0,59,
+0,1,0,0,0,1,0,0,0,40,0,1,0,60,0,1,0,0,0,1,0,0,0,41,0,1,0,61,0,1,0,0,0,1,0,
+0,0,42,0,1,0,62,0,1,0,0,0,1,0,0,0,43,0,1,0,64,0,1,0,0,0,1,0,0,0,44,0,1,0,
+85,0,1,0,0,0,1,0,0,0,45,0,1,0,86,0,1,0,0,0,1,0,0,0,46,0,1,0,87,0,1,0,0,0,
+1,0,0,0,47,0,1,0,88,0,1,0,0,0,1,0,0,0,48,0,1,0,89,0,1,0,0,0,1,0,0,0,49,0,
+1,0,90,0,1,0,0,0,1,0,0,0,50,0,1,0,91,0,1,0,0,0,1,0,0,0,51,0,1,0,92,0,1,0,
+0,0,1,0,0,0,52,0,1,0,93,0,1,0,0,0,1,0,0,0,53,0,1,0,94,0,1,0,0,0,1,0,0,0,54,
+0,1,0,96,0,1,0,0,0,1,0,0,0,55,0,1,0,97,0,1,0,0,0,1,0,0,0,56,0,1,0,0,0,1,0,
+8,0,1,0,6,0,4,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,5,0,1,0,1,0,100,0,1,
+0,0,0,1,0,8,0,1,0,6,0,6,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,7,0,1,0,1,
+0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,8,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,
+9,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,10,0,1,0,1,0,100,0,1,0,0,0,1,0,
+8,0,1,0,6,0,11,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,12,0,1,0,1,0,100,0,
+1,0,0,0,1,0,8,0,1,0,6,0,13,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,16,0,1,
+0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,17,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,
+0,6,0,18,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,19,0,1,0,1,0,100,0,1,0,0,
+0,1,0,8,0,1,0,6,0,20,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,21,0,1,0,1,0,
+100,0,1,0,0,0,1,0,8,0,1,0,6,0,22,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,
+23,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,24,0,1,0,1,0,100,0,1,0,0,0,1,0,
+8,0,1,0,6,0,26,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,27,0,1,0,1,0,100,0,
+1,0,0,0,1,0,8,0,1,0,6,0,29,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,30,0,1,
+0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,31,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,
+0,6,0,32,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,33,0,1,0,1,0,100,0,1,0,0,
+0,1,0,8,0,1,0,6,0,34,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,35,0,1,0,1,0,
+100,0,1,0,0,0,1,0,8,0,1,0,6,0,37,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,
+38,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,39,0,1,0,1,0,100,0,1,0,0,0,1,0,
+8,0,1,0,6,0,40,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,41,0,1,0,1,0,100,0,
+1,0,0,0,1,0,8,0,1,0,6,0,43,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,44,0,1,
+0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,45,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,
+0,6,0,46,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,47,0,1,0,1,0,100,0,1,0,0,
+0,1,0,8,0,1,0,6,0,48,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,49,0,1,0,1,0,
+100,0,1,0,0,0,1,0,8,0,1,0,6,0,50,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,
+51,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,52,0,1,0,1,0,100,0,1,0,0,0,1,0,
+8,0,1,0,6,0,53,0,1,0,1,0,100,0,1,0,0,0,1,0,8,0,1,0,6,0,55,0,1,0,1,0,100,0,
+1,0,0,0,1,0,8,0,1,0,6,0,56,0,1,0,1,0,100,0,4,1,0,0,1,0,8,0,1,11,90,0,62,0,
+130,0,202,0,246,1,48,1,92,1,136,1,180,1,224,2,12,2,56,2,100,2,158,2,202,2,
+246,3,48,3,92,3,136,3,180,3,224,4,12,4,84,4,128,4,200,4,244,5,88,5,132,5,
+176,5,220,6,8,6,52,6,96,6,140,6,184,6,220,7,8,7,52,7,96,7,140,7,184,7,228,
+8,16,8,60,8,104,8,148,8,192,8,236,9,24,9,68,9,112,9,156,9,200,9,244,10,32,
+10,76,10,120,10,164,10,190,10,216,10,242,11,12,11,38,11,64,0,7,0,16,0,22,
+0,28,0,34,0,46,0,58,0,64,0,157,0,2,0,65,0,219,0,2,0,69,1,25,0,2,0,70,1,127,
+0,5,0,98,0,65,2,99,0,58,1,128,0,5,0,98,0,65,2,99,0,60,1,87,0,2,0,98,0,157,
+0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,158,0,2,0,65,0,220,0,2,0,69,
+1,26,0,2,0,70,1,88,0,2,0,98,0,158,0,3,2,99,0,65,0,6,0,14,0,20,0,26,0,32,0,
+44,0,50,0,159,0,2,0,65,0,221,0,2,0,69,1,27,0,2,0,70,1,129,0,5,0,98,0,65,2,
+99,0,46,1,89,0,2,0,98,0,159,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,
+160,0,2,0,65,0,222,0,2,0,69,1,28,0,2,0,70,1,90,0,2,0,98,0,160,0,3,2,99,0,
+65,0,5,0,12,0,18,0,24,0,30,0,36,0,161,0,2,0,65,0,223,0,2,0,69,1,29,0,2,0,
+70,1,91,0,2,0,98,0,161,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,162,0,
+2,0,65,0,224,0,2,0,69,1,30,0,2,0,70,1,92,0,2,0,98,0,162,0,3,2,99,0,65,0,5,
+0,12,0,18,0,24,0,30,0,36,0,163,0,2,0,65,0,225,0,2,0,69,1,31,0,2,0,70,1,93,
+0,2,0,98,0,163,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,164,0,2,0,65,
+0,226,0,2,0,69,1,32,0,2,0,70,1,94,0,2,0,98,0,164,0,3,2,99,0,65,0,5,0,12,0,
+18,0,24,0,30,0,36,0,165,0,2,0,65,0,227,0,2,0,69,1,33,0,2,0,70,1,95,0,2,0,
+98,0,165,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,166,0,2,0,65,0,228,
+0,2,0,69,1,34,0,2,0,70,1,96,0,2,0,98,0,166,0,3,2,99,0,65,0,6,0,14,0,20,0,
+26,0,32,0,44,0,50,0,167,0,2,0,65,0,229,0,2,0,69,1,35,0,2,0,70,1,130,0,5,0,
+98,0,65,2,99,0,30,1,97,0,2,0,98,0,167,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,
+30,0,36,0,168,0,2,0,65,0,231,0,2,0,69,1,37,0,2,0,70,1,98,0,2,0,98,0,168,0,
+3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,169,0,2,0,65,0,233,0,2,0,69,1,
+39,0,2,0,70,1,99,0,2,0,98,0,169,0,3,2,99,0,65,0,6,0,14,0,20,0,26,0,32,0,44,
+0,50,0,170,0,2,0,65,0,234,0,2,0,69,1,40,0,2,0,70,1,131,0,5,0,98,0,65,2,99,
+0,38,1,100,0,2,0,98,0,170,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,171,
+0,2,0,65,0,235,0,2,0,69,1,41,0,2,0,70,1,101,0,2,0,98,0,171,0,3,2,99,0,65,
+0,5,0,12,0,18,0,24,0,30,0,36,0,172,0,2,0,65,0,236,0,2,0,69,1,42,0,2,0,70,
+1,102,0,2,0,98,0,172,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,173,0,2,
+0,65,0,237,0,2,0,69,1,43,0,2,0,70,1,103,0,2,0,98,0,173,0,3,2,99,0,65,0,5,
+0,12,0,18,0,24,0,30,0,36,0,174,0,2,0,65,0,238,0,2,0,69,1,44,0,2,0,70,1,104,
+0,2,0,98,0,174,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,175,0,2,0,65,
+0,239,0,2,0,69,1,45,0,2,0,70,1,105,0,2,0,98,0,175,0,3,2,99,0,65,0,7,0,16,
+0,22,0,28,0,34,0,46,0,58,0,64,0,176,0,2,0,65,0,240,0,2,0,69,1,46,0,2,0,70,
+1,132,0,5,0,98,0,65,2,99,0,44,1,133,0,5,0,98,0,65,2,99,0,58,1,106,0,2,0,98,
+0,176,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,177,0,2,0,65,0,241,0,2,
+0,69,1,47,0,2,0,70,1,107,0,2,0,98,0,177,0,3,2,99,0,65,0,7,0,16,0,22,0,28,
+0,34,0,46,0,58,0,64,0,178,0,2,0,65,0,242,0,2,0,69,1,48,0,2,0,70,1,134,0,5,
+0,98,0,65,2,99,0,46,1,135,0,5,0,98,0,65,2,99,0,58,1,108,0,2,0,98,0,178,0,
+3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,179,0,2,0,65,0,244,0,2,0,69,1,
+50,0,2,0,70,1,109,0,2,0,98,0,179,0,3,2,99,0,65,0,9,0,20,0,26,0,32,0,38,0,
+50,0,62,0,74,0,86,0,92,0,180,0,2,0,65,0,245,0,2,0,69,1,51,0,2,0,70,1,136,
+0,5,0,98,0,65,2,99,0,44,1,137,0,5,0,98,0,65,2,99,0,45,1,138,0,5,0,98,0,65,
+2,99,0,46,1,139,0,5,0,98,0,65,2,99,0,58,1,110,0,2,0,98,0,180,0,3,2,99,0,65,
+0,5,0,12,0,18,0,24,0,30,0,36,0,181,0,2,0,65,0,246,0,2,0,69,1,52,0,2,0,70,
+1,111,0,2,0,98,0,181,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,182,0,2,
+0,65,0,248,0,2,0,69,1,54,0,2,0,70,1,112,0,2,0,98,0,182,0,3,2,99,0,65,0,5,
+0,12,0,18,0,24,0,30,0,36,0,183,0,2,0,65,0,249,0,2,0,69,1,55,0,2,0,70,1,113,
+0,2,0,98,0,183,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,184,0,2,0,65,
+0,250,0,2,0,69,1,56,0,2,0,70,1,114,0,2,0,98,0,184,0,3,2,99,0,65,0,5,0,12,
+0,18,0,24,0,30,0,36,0,185,0,2,0,65,0,251,0,2,0,69,1,57,0,2,0,70,1,115,0,2,
+0,98,0,185,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,186,0,2,0,65,0,252,
+0,2,0,69,1,58,0,2,0,70,1,116,0,2,0,98,0,186,0,3,2,99,0,65,0,5,0,12,0,18,0,
+24,0,30,0,36,0,187,0,2,0,65,0,253,0,2,0,69,1,59,0,2,0,70,1,117,0,2,0,98,0,
+187,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,188,0,2,0,65,0,254,0,2,0,
+69,1,60,0,2,0,70,1,118,0,2,0,98,0,188,0,3,2,99,0,65,0,4,0,10,0,16,0,22,0,
+28,0,189,0,2,0,65,0,255,0,2,0,69,1,61,0,2,0,70,0,189,0,3,2,99,0,65,0,5,0,
+12,0,18,0,24,0,30,0,36,0,190,0,2,0,65,1,0,0,2,0,69,1,62,0,2,0,70,1,119,0,
+2,0,98,0,190,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,191,0,2,0,65,1,
+2,0,2,0,69,1,64,0,2,0,70,1,120,0,2,0,98,0,191,0,3,2,99,0,65,0,5,0,12,0,18,
+0,24,0,30,0,36,0,192,0,2,0,65,1,3,0,2,0,69,1,65,0,2,0,70,1,121,0,2,0,98,0,
+192,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,193,0,2,0,65,1,4,0,2,0,69,
+1,66,0,2,0,70,1,122,0,2,0,98,0,193,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,
+0,36,0,194,0,2,0,65,1,5,0,2,0,69,1,67,0,2,0,70,1,123,0,2,0,98,0,194,0,3,2,
+99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,195,0,2,0,65,1,6,0,2,0,69,1,68,0,2,
+0,70,1,124,0,2,0,98,0,195,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,196,
+0,2,0,65,1,7,0,2,0,69,1,69,0,2,0,70,1,125,0,2,0,98,0,196,0,3,2,99,0,65,0,
+5,0,12,0,18,0,24,0,30,0,36,0,197,0,2,0,65,1,9,0,2,0,69,1,71,0,2,0,70,1,126,
+0,2,0,98,0,197,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,198,0,2,0,65,
+1,10,0,2,0,69,1,72,0,2,0,70,1,127,0,2,0,98,0,198,0,3,2,99,0,65,0,5,0,12,0,
+18,0,24,0,30,0,36,0,199,0,2,0,65,1,11,0,2,0,69,1,73,0,2,0,70,1,128,0,2,0,
+98,0,199,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,200,0,2,0,65,1,12,0,
+2,0,69,1,74,0,2,0,70,1,129,0,2,0,98,0,200,0,3,2,99,0,65,0,5,0,12,0,18,0,24,
+0,30,0,36,0,201,0,2,0,65,1,13,0,2,0,69,1,75,0,2,0,70,1,130,0,2,0,98,0,201,
+0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,202,0,2,0,65,1,14,0,2,0,69,1,
+76,0,2,0,70,1,131,0,2,0,98,0,202,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,
+36,0,203,0,2,0,65,1,15,0,2,0,69,1,77,0,2,0,70,1,132,0,2,0,98,0,203,0,3,2,
+99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,204,0,2,0,65,1,16,0,2,0,69,1,78,0,
+2,0,70,1,133,0,2,0,98,0,204,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,
+205,0,2,0,65,1,17,0,2,0,69,1,79,0,2,0,70,1,134,0,2,0,98,0,205,0,3,2,99,0,
+65,0,5,0,12,0,18,0,24,0,30,0,36,0,206,0,2,0,65,1,18,0,2,0,69,1,80,0,2,0,70,
+1,135,0,2,0,98,0,206,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,207,0,2,
+0,65,1,19,0,2,0,69,1,81,0,2,0,70,1,136,0,2,0,98,0,207,0,3,2,99,0,65,0,5,0,
+12,0,18,0,24,0,30,0,36,0,208,0,2,0,65,1,20,0,2,0,69,1,82,0,2,0,70,1,137,0,
+2,0,98,0,208,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,209,0,2,0,65,1,
+22,0,2,0,69,1,84,0,2,0,70,1,138,0,2,0,98,0,209,0,3,2,99,0,65,0,5,0,12,0,18,
+0,24,0,30,0,36,0,210,0,2,0,65,1,23,0,2,0,69,1,85,0,2,0,70,1,139,0,2,0,98,
+0,210,0,3,2,99,0,65,0,5,0,12,0,18,0,24,0,30,0,36,0,211,0,2,0,65,1,24,0,2,
+0,69,1,86,0,2,0,70,1,140,0,2,0,98,0,211,0,3,2,99,0,65,0,3,0,8,0,14,0,20,0,
+212,0,2,0,65,0,230,0,2,0,69,1,36,0,2,0,70,0,3,0,8,0,14,0,20,0,213,0,2,0,65,
+0,232,0,2,0,69,1,38,0,2,0,70,0,3,0,8,0,14,0,20,0,214,0,2,0,65,0,243,0,2,0,
+69,1,49,0,2,0,70,0,3,0,8,0,14,0,20,0,215,0,2,0,65,0,247,0,2,0,69,1,53,0,2,
+0,70,0,3,0,8,0,14,0,20,0,216,0,2,0,65,1,1,0,2,0,69,1,63,0,2,0,70,0,3,0,8,
+0,14,0,20,0,218,0,2,0,65,1,8,0,2,0,69,1,70,0,2,0,70,0,3,0,8,0,14,0,20,0,217,
+0,2,0,65,1,21,0,2,0,69,1,83,0,2,0,70,0,2,0,9,0,24,0,64,0,0,0,85,0,97,0,41,
+0,99,0,99,0,54,0,114,0,115,0,55,0,125,0,125,0,57,0,128,0,128,0,58,0,136,0,
+136,0,59,0,142,0,142,0,60,0,154,0,154,0,61,0,4,2,0,0,1,0,8,0,1,4,54,0,54,
+0,114,0,132,0,150,0,168,0,186,0,204,0,222,0,240,1,2,1,20,1,38,1,56,1,74,1,
+92,1,110,1,128,1,146,1,164,1,182,1,200,1,218,1,236,1,254,2,16,2,34,2,52,2,
+70,2,88,2,106,2,124,2,142,2,160,2,178,2,196,2,214,2,232,2,250,3,12,3,30,3,
+40,3,58,3,76,3,94,3,112,3,130,3,148,3,166,3,184,3,202,3,220,3,238,4,0,4,18,
+4,36,0,2,0,6,0,12,1,141,0,2,0,71,1,195,0,2,0,72,0,2,0,6,0,12,1,142,0,2,0,
+71,1,196,0,2,0,72,0,2,0,6,0,12,1,143,0,2,0,71,1,197,0,2,0,72,0,2,0,6,0,12,
+1,144,0,2,0,71,1,198,0,2,0,72,0,2,0,6,0,12,1,145,0,2,0,71,1,199,0,2,0,72,
+0,2,0,6,0,12,1,146,0,2,0,71,1,200,0,2,0,72,0,2,0,6,0,12,1,147,0,2,0,71,1,
+201,0,2,0,72,0,2,0,6,0,12,1,148,0,2,0,71,1,202,0,2,0,72,0,2,0,6,0,12,1,149,
+0,2,0,71,1,203,0,2,0,72,0,2,0,6,0,12,1,150,0,2,0,71,1,204,0,2,0,72,0,2,0,
+6,0,12,1,151,0,2,0,71,1,205,0,2,0,72,0,2,0,6,0,12,1,152,0,2,0,71,1,206,0,
+2,0,72,0,2,0,6,0,12,1,153,0,2,0,71,1,207,0,2,0,72,0,2,0,6,0,12,1,154,0,2,
+0,71,1,208,0,2,0,72,0,2,0,6,0,12,1,155,0,2,0,71,1,209,0,2,0,72,0,2,0,6,0,
+12,1,156,0,2,0,71,1,210,0,2,0,72,0,2,0,6,0,12,1,157,0,2,0,71,1,211,0,2,0,
+72,0,2,0,6,0,12,1,158,0,2,0,71,1,212,0,2,0,72,0,2,0,6,0,12,1,159,0,2,0,71,
+1,213,0,2,0,72,0,2,0,6,0,12,1,160,0,2,0,71,1,214,0,2,0,72,0,2,0,6,0,12,1,
+161,0,2,0,71,1,215,0,2,0,72,0,2,0,6,0,12,1,162,0,2,0,71,1,216,0,2,0,72,0,
+2,0,6,0,12,1,163,0,2,0,71,1,217,0,2,0,72,0,2,0,6,0,12,1,164,0,2,0,71,1,218,
+0,2,0,72,0,2,0,6,0,12,1,165,0,2,0,71,1,219,0,2,0,72,0,2,0,6,0,12,1,166,0,
+2,0,71,1,220,0,2,0,72,0,2,0,6,0,12,1,167,0,2,0,71,1,221,0,2,0,72,0,2,0,6,
+0,12,1,168,0,2,0,71,1,222,0,2,0,72,0,2,0,6,0,12,1,169,0,2,0,71,1,223,0,2,
+0,72,0,2,0,6,0,12,1,170,0,2,0,71,1,224,0,2,0,72,0,2,0,6,0,12,1,171,0,2,0,
+71,1,225,0,2,0,72,0,2,0,6,0,12,1,172,0,2,0,71,1,226,0,2,0,72,0,2,0,6,0,12,
+1,173,0,2,0,71,1,227,0,2,0,72,0,2,0,6,0,12,1,174,0,2,0,71,1,228,0,2,0,72,
+0,2,0,6,0,12,1,175,0,2,0,71,1,229,0,2,0,72,0,2,0,6,0,12,1,176,0,2,0,71,1,
+230,0,2,0,72,0,2,0,6,0,12,1,177,0,2,0,71,1,231,0,2,0,72,0,2,0,6,0,12,1,178,
+0,2,0,71,1,232,0,2,0,72,0,1,0,4,1,179,0,2,0,71,0,2,0,6,0,12,1,180,0,2,0,71,
+1,233,0,2,0,72,0,2,0,6,0,12,1,181,0,2,0,71,1,234,0,2,0,72,0,2,0,6,0,12,1,
+182,0,2,0,71,1,235,0,2,0,72,0,2,0,6,0,12,1,183,0,2,0,71,1,236,0,2,0,72,0,
+2,0,6,0,12,1,184,0,2,0,71,1,237,0,2,0,72,0,2,0,6,0,12,1,185,0,2,0,71,1,238,
+0,2,0,72,0,2,0,6,0,12,1,186,0,2,0,71,1,239,0,2,0,72,0,2,0,6,0,12,1,187,0,
+2,0,71,1,240,0,2,0,72,0,2,0,6,0,12,1,188,0,2,0,71,1,241,0,2,0,72,0,2,0,6,
+0,12,1,189,0,2,0,71,1,242,0,2,0,72,0,2,0,6,0,12,1,190,0,2,0,71,1,243,0,2,
+0,72,0,2,0,6,0,12,1,191,0,2,0,71,1,244,0,2,0,72,0,2,0,6,0,12,1,192,0,2,0,
+71,1,245,0,2,0,72,0,2,0,6,0,12,1,193,0,2,0,71,1,246,0,2,0,72,0,2,0,6,0,12,
+1,194,0,2,0,71,1,247,0,2,0,72,0,2,0,4,0,24,0,55,0,0,0,57,0,64,0,32,0,85,0,
+97,0,40,0,99,0,99,0,53,0,4,0,0,0,1,0,8,0,1,0,126,0,5,0,16,0,26,0,36,0,106,
+0,116,0,1,0,4,1,248,0,2,0,66,0,1,0,4,1,249,0,2,0,66,0,8,0,18,0,24,0,30,0,
+36,0,44,0,52,0,58,0,64,1,250,0,2,0,66,1,253,0,2,0,73,1,254,0,2,0,81,2,2,0,
+3,0,99,0,66,2,3,0,3,0,99,0,101,2,0,0,2,0,99,1,255,0,2,0,101,2,1,0,2,0,211,
+0,1,0,4,1,251,0,2,0,66,0,1,0,4,1,252,0,2,0,66,0,1,0,5,0,34,0,35,0,45,0,48,
+0,95,0,5,0,0,0,1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,2,0,0,1,0,4,0,2,0,1,0,100,0,
+0,0,61,0,2,0,0,0,1,0,8,0,1,0,14,0,1,0,8,0,2,0,45,0,99,0,1,0,1,2,0,0,6,0,8,
+0,1,0,8,0,1,0,10,0,2,0,18,0,36,0,1,0,2,0,67,0,68,0,1,0,4,0,1,0,56,0,1,0,0,
+0,1,0,0,0,63,0,1,0,4,0,1,0,56,0,1,0,0,0,1,0,0,0,63,0,1,0,0,0,1,0,8,0,1,0,
+6,1,193,0,1,0,2,0,67,0,68,0,5,2,0,0,1,0,8,0,1,0,10,0,2,0,18,0,44,0,1,0,2,
+0,56,0,63,0,2,0,6,0,16,0,2,0,1,0,71,0,1,0,65,0,2,0,1,0,72,0,1,0,65,0,1,0,
+4,0,2,0,2,0,72,0,0,0,65,0,1,0,65,0,1,0,0,0,1,0,8,0,2,0,12,0,3,1,179,0,67,
+0,68,0,1,0,3,0,63,0,71,0,72,0,0,};
+#endif
@@ -0,0 +1,461 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansSundanese_Regular_ttf_size = 11144;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansSundanese_Regular_ttf");
+asm(".type fz_font_NotoSansSundanese_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansSundanese_Regular_ttf, 11144");
+asm(".balign 64");
+asm("fz_font_NotoSansSundanese_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansSundanese-Regular.ttf\"");
+#else
+const int fz_font_NotoSansSundanese_Regular_ttf_size = 11144;
+const char fz_font_NotoSansSundanese_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,1,207,1,180,0,0,38,252,0,0,0,84,71,
+80,79,83,146,228,111,47,0,0,39,80,0,0,3,204,71,83,85,66,169,46,187,26,0,0,
+43,28,0,0,0,108,79,83,47,50,117,231,103,11,0,0,1,104,0,0,0,96,99,109,97,112,
+29,152,27,152,0,0,3,4,0,0,0,92,103,97,115,112,0,7,0,7,0,0,38,240,0,0,0,12,
+103,108,121,102,251,200,114,51,0,0,4,0,0,0,25,176,104,101,97,100,7,76,174,
+224,0,0,0,236,0,0,0,54,104,104,101,97,17,5,9,90,0,0,1,36,0,0,0,36,104,109,
+116,120,149,137,217,214,0,0,1,200,0,0,1,60,108,111,99,97,222,9,229,43,0,0,
+3,96,0,0,0,160,109,97,120,112,0,95,0,119,0,0,1,72,0,0,0,32,110,97,109,101,
+142,222,186,158,0,0,29,176,0,0,6,18,112,111,115,116,201,48,63,220,0,0,35,
+196,0,0,3,41,0,1,0,0,0,1,12,205,5,65,12,71,95,15,60,245,0,11,8,0,0,0,0,0,
+205,74,102,112,0,0,0,0,210,109,241,212,250,158,253,14,13,215,7,195,0,0,0,
+9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,14,0,0,13,113,250,158,254,139,13,215,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,1,0,0,0,79,0,87,0,11,0,30,0,2,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,6,60,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,14,0,0,8,141,2,242,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,2,4,205,0,193,0,0,0,0,2,20,0,0,2,20,0,0,
+0,0,253,106,0,0,253,12,3,25,0,2,6,248,0,162,4,125,255,211,6,31,0,147,7,74,
+0,162,6,111,0,168,6,92,0,80,6,248,0,162,6,88,0,154,6,102,255,209,6,104,0,
+152,5,211,0,152,6,0,255,195,6,170,0,141,6,162,0,141,8,158,0,156,6,227,0,68,
+4,254,255,211,5,94,0,156,6,88,0,154,6,88,0,154,5,104,255,211,7,195,255,211,
+5,135,0,92,6,244,0,68,4,72,0,133,6,78,255,215,5,121,255,211,6,96,0,154,6,
+96,0,154,6,41,0,33,0,0,251,96,0,0,251,82,0,0,251,90,0,0,253,12,0,0,251,178,
+3,0,255,227,3,0,255,250,0,0,252,233,0,0,252,233,2,29,255,215,2,6,0,111,0,
+0,250,158,0,0,250,174,11,14,0,152,13,45,0,154,6,160,0,123,6,100,0,158,5,156,
+0,158,6,31,0,156,4,72,0,92,6,238,0,127,5,78,255,211,5,240,255,94,6,96,255,
+236,5,246,0,147,2,233,0,145,5,178,0,131,9,113,255,211,10,176,0,141,8,154,
+0,147,5,209,0,229,8,37,0,74,5,100,0,137,5,100,0,137,5,100,0,137,13,113,255,
+211,5,244,0,152,9,20,255,211,13,41,255,158,0,0,251,82,0,0,251,6,2,74,251,
+116,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,80,0,0,0,16,0,16,0,3,0,0,0,0,0,13,0,32,
+0,160,27,191,28,199,254,255,255,255,0,0,0,0,0,13,0,32,0,160,27,128,28,192,
+254,255,255,255,0,1,255,245,255,227,255,99,228,132,227,132,1,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,59,0,82,0,102,0,168,0,
+193,0,233,1,64,1,122,1,181,2,1,2,29,2,58,2,86,2,110,2,180,2,220,3,12,3,56,
+3,93,3,127,3,148,3,176,3,201,3,222,4,9,4,36,4,76,4,113,4,143,4,171,4,221,
+5,2,5,34,5,60,5,100,5,123,5,144,5,160,5,187,5,212,5,232,6,1,6,57,6,78,6,119,
+6,150,6,199,7,12,7,66,7,106,7,139,7,181,7,218,7,252,8,38,8,73,8,156,8,204,
+8,228,9,9,9,103,9,152,9,209,9,250,10,118,10,192,11,17,11,71,11,223,12,11,
+12,74,12,178,12,191,12,203,12,216,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,
+33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,
+4,230,0,0,2,253,106,6,12,255,33,7,195,0,11,0,23,0,0,1,52,54,51,50,22,21,20,
+6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,253,106,131,89,91,128,129,90,
+89,131,119,59,42,42,56,56,42,43,58,6,231,90,130,130,90,90,129,128,91,41,59,
+58,42,42,57,58,0,1,253,12,6,12,255,129,7,176,0,9,0,0,1,19,23,3,35,39,7,39,
+55,51,254,131,162,92,213,74,166,96,80,140,88,6,168,1,8,55,254,147,244,135,
+57,209,0,2,0,2,0,0,2,109,2,70,0,3,0,7,0,0,33,35,3,51,1,35,3,51,1,88,137,205,
+137,1,226,138,204,137,2,70,253,186,2,70,0,1,0,162,255,229,6,96,5,227,0,38,
+0,0,1,55,1,33,55,33,7,1,50,22,22,21,20,6,4,35,32,36,2,17,52,18,63,2,51,7,
+6,2,21,16,0,33,50,54,53,52,38,35,3,39,47,1,215,253,162,51,3,88,14,254,4,149,
+244,135,144,254,236,194,254,246,254,128,206,94,84,46,17,218,68,106,87,1,88,
+1,58,193,216,238,190,2,203,149,1,180,162,127,254,41,107,188,112,152,221,111,
+194,1,123,1,5,162,1,68,124,67,23,98,150,254,222,162,254,199,254,159,169,147,
+118,140,0,1,255,211,0,0,4,14,5,182,0,9,0,0,37,19,51,3,33,1,33,7,35,1,2,246,
+88,192,139,252,80,1,227,1,195,53,254,254,137,162,1,4,254,90,5,182,162,251,
+142,0,0,1,0,147,0,0,6,23,5,182,0,21,0,0,1,33,55,33,1,33,39,38,53,52,54,51,
+33,7,33,34,21,20,23,5,7,33,2,104,254,43,54,2,161,254,82,2,105,125,121,145,
+134,1,209,54,254,103,92,102,1,16,37,251,127,5,20,162,250,236,110,109,108,
+109,121,162,74,42,87,243,111,0,0,1,0,162,255,229,7,23,5,227,0,55,0,0,1,50,
+22,22,21,20,6,4,35,32,0,17,52,18,63,2,51,7,6,2,21,16,0,33,50,54,54,53,52,
+38,35,35,55,1,33,55,33,7,1,54,51,50,22,22,21,20,6,35,34,46,2,35,34,6,4,162,
+149,244,135,165,254,210,211,254,90,254,60,94,84,46,17,218,68,106,87,1,92,
+1,72,144,214,115,238,190,192,47,1,215,253,162,51,3,88,14,254,227,116,68,68,
+99,55,50,41,34,44,50,68,58,79,137,3,96,107,188,112,150,222,112,1,182,1,140,
+162,1,68,124,67,23,98,150,254,222,162,254,188,254,170,79,145,92,118,140,149,
+1,180,162,127,254,248,31,40,67,37,38,46,34,41,34,55,0,0,2,0,168,0,0,6,25,
+5,182,0,2,0,31,0,0,1,35,19,1,19,62,2,51,50,22,21,20,7,3,35,19,62,2,53,38,
+35,34,6,7,3,33,1,1,33,1,2,111,209,112,1,43,113,34,91,136,95,116,151,15,147,
+191,121,6,14,8,2,89,51,69,26,151,252,243,1,2,254,234,2,197,254,79,5,20,254,
+228,252,170,1,59,96,104,56,118,90,38,45,254,70,1,119,19,44,44,21,70,61,78,
+254,78,3,2,2,180,250,236,0,1,0,80,255,229,5,252,5,182,0,35,0,0,1,32,4,21,
+20,22,22,51,51,21,20,2,4,35,34,36,2,17,53,51,21,16,0,33,50,54,54,53,32,36,
+53,52,36,33,51,7,5,131,254,194,254,220,117,255,220,139,170,254,198,208,236,
+254,173,185,199,1,42,1,7,120,218,145,254,140,254,157,1,150,1,165,93,54,5,
+20,141,141,95,103,46,69,209,254,177,188,198,1,138,1,6,99,64,254,173,254,130,
+121,223,109,205,213,224,226,162,0,0,2,0,162,255,229,6,96,6,16,0,37,0,44,0,
+0,1,50,22,21,20,6,4,35,32,36,2,17,52,18,63,2,51,7,6,2,21,16,0,33,50,54,53,
+52,38,35,35,55,37,33,55,33,7,1,55,51,1,35,1,51,4,137,222,249,142,254,236,
+196,254,246,254,128,206,94,84,46,17,218,68,106,87,1,88,1,58,187,222,178,184,
+211,57,1,93,254,4,51,3,22,18,254,168,182,191,254,206,135,254,207,191,3,12,
+205,180,128,188,106,194,1,123,1,5,162,1,68,124,67,23,98,150,254,222,162,254,
+199,254,159,139,115,124,112,178,180,162,156,1,119,182,254,201,1,55,0,0,2,
+0,154,0,0,6,166,5,182,0,5,0,11,0,0,33,35,1,33,55,33,1,35,1,33,55,33,1,131,
+203,1,183,254,43,53,2,155,1,84,202,1,182,254,43,53,2,156,5,20,162,250,74,
+5,20,162,0,1,255,209,0,0,6,174,5,182,0,11,0,0,33,35,1,33,1,35,1,33,1,35,1,
+33,4,207,203,1,174,254,176,254,84,202,1,174,254,176,254,82,203,1,227,4,250,
+5,20,250,236,5,20,250,236,5,182,0,0,1,0,152,0,0,5,244,5,182,0,11,0,0,51,1,
+33,55,33,1,33,19,33,55,33,3,190,1,172,254,46,53,2,160,254,81,2,191,131,254,
+143,54,2,47,236,5,20,162,250,236,1,139,162,253,49,0,0,1,0,152,0,0,5,109,5,
+182,0,9,0,0,51,1,33,55,33,1,33,3,51,19,190,1,172,254,46,53,2,160,254,81,2,
+183,180,194,234,5,20,162,250,236,2,45,253,49,0,2,255,195,255,227,6,84,5,182,
+0,32,0,42,0,0,19,55,33,1,22,51,50,54,54,55,1,51,1,14,2,35,34,38,39,6,6,35,
+34,38,53,52,54,51,50,22,23,1,1,50,55,38,35,34,6,21,20,22,195,53,2,166,254,
+139,189,104,57,79,75,47,1,59,201,254,154,56,103,139,102,91,186,106,50,132,
+92,121,145,152,122,46,97,31,1,25,254,51,87,46,60,71,45,64,54,5,20,162,251,
+148,174,65,149,140,3,184,251,201,174,163,75,79,89,88,78,131,111,121,143,24,
+19,3,96,251,101,147,56,53,46,46,58,0,0,2,0,141,0,0,7,12,5,182,0,12,0,16,0,
+0,1,33,55,33,1,33,19,51,1,35,3,3,33,1,1,35,1,2,106,254,35,54,2,170,254,79,
+1,17,241,185,1,41,193,196,191,253,98,5,37,1,41,190,254,211,5,20,162,250,236,
+2,174,252,176,2,70,253,186,3,80,252,176,3,80,0,0,1,0,141,0,0,6,3,5,182,0,
+27,0,0,1,33,55,33,1,33,55,54,54,51,50,22,21,20,7,3,35,19,54,53,52,35,34,6,
+6,7,3,33,2,106,254,35,54,2,170,254,79,1,125,90,49,175,133,114,153,15,123,
+193,99,27,91,39,52,35,19,129,252,245,5,20,162,250,236,252,138,118,120,91,
+37,43,254,133,1,55,85,33,81,32,50,57,254,141,0,1,0,156,0,0,8,233,5,182,0,
+19,0,0,1,51,1,1,33,7,35,19,33,1,35,1,3,33,1,33,55,33,1,33,4,74,88,1,241,1,
+91,253,157,33,196,86,3,237,254,25,127,254,33,217,252,225,1,174,254,66,53,
+2,133,254,82,1,147,3,203,253,73,4,0,94,1,0,250,74,2,150,253,106,5,20,162,
+250,236,0,0,1,0,68,0,0,6,209,5,182,0,15,0,0,1,51,3,33,1,35,1,33,1,33,1,33,
+55,33,1,33,4,61,199,119,2,68,254,151,200,1,49,254,135,254,205,253,31,1,59,
+254,203,53,1,252,254,196,1,87,5,182,254,148,251,182,3,168,252,88,3,168,162,
+252,88,0,0,1,255,211,0,0,5,76,5,182,0,14,0,0,1,19,23,35,3,3,33,1,33,7,33,
+1,33,19,55,4,37,216,79,195,194,191,252,203,1,227,2,101,54,254,97,254,137,
+1,168,180,61,3,80,253,152,232,2,70,253,186,5,182,162,251,142,1,250,180,0,
+1,0,156,0,0,5,115,5,182,0,7,0,0,33,1,33,55,33,1,33,7,1,78,1,172,253,162,53,
+3,43,254,82,3,37,54,5,20,162,250,236,162,0,1,0,154,0,0,6,162,5,182,0,11,0,
+0,33,33,1,33,55,33,1,33,1,33,55,33,4,190,252,0,1,172,254,48,53,2,158,254,
+81,2,107,1,119,254,47,53,2,158,5,20,162,250,236,4,114,162,0,1,0,154,0,0,6,
+162,5,182,0,9,0,0,33,33,1,33,55,33,1,33,1,51,4,190,252,0,1,172,254,48,53,
+2,158,254,81,2,107,1,178,199,5,20,162,250,236,5,20,0,0,1,255,211,0,0,5,178,
+5,182,0,7,0,0,33,33,1,51,1,33,1,51,3,207,252,4,1,225,199,254,82,2,108,1,179,
+198,5,182,250,236,5,20,0,1,255,211,0,0,8,16,5,182,0,19,0,0,1,51,1,1,33,7,
+35,19,33,1,35,1,3,33,1,33,7,35,1,33,3,113,88,1,241,1,90,253,158,33,196,86,
+3,237,254,25,127,254,33,217,252,225,1,227,1,129,51,190,254,137,1,147,3,203,
+253,73,4,0,94,1,0,250,74,2,150,253,106,5,182,162,251,142,0,1,0,92,0,0,5,209,
+5,182,0,11,0,0,33,33,19,33,55,33,3,33,1,33,55,33,3,240,252,163,228,254,229,
+53,1,232,230,1,199,1,119,251,201,53,5,2,2,172,162,253,84,4,114,162,0,1,0,
+68,0,0,6,225,5,182,0,16,0,0,1,1,35,3,3,33,1,33,55,33,1,33,1,51,3,19,1,6,225,
+254,152,201,203,192,253,31,1,59,254,203,53,1,252,254,196,1,87,1,167,199,192,
+200,1,15,4,74,251,182,2,74,253,182,3,168,162,252,88,5,20,253,180,253,173,
+3,51,0,0,2,0,133,0,0,4,125,5,182,0,13,0,17,0,0,19,33,19,33,55,33,3,51,7,35,
+3,35,19,33,19,33,7,33,205,1,227,98,253,115,53,3,86,151,213,53,213,168,203,
+170,254,29,53,3,176,53,252,80,2,162,1,41,162,254,53,162,254,0,2,0,3,182,162,
+0,0,1,255,215,0,0,6,152,5,182,0,11,0,0,33,1,35,1,35,1,33,1,33,1,51,1,1,141,
+1,176,241,254,84,201,1,223,2,131,254,82,1,150,1,172,203,254,30,5,20,250,236,
+5,182,250,236,5,20,250,74,0,0,1,255,211,0,0,5,92,5,182,0,11,0,0,1,33,7,33,
+1,33,19,33,55,33,3,33,1,182,2,101,54,254,97,254,137,3,22,131,254,91,53,2,
+100,235,251,98,5,182,162,251,142,1,139,162,253,49,0,2,0,154,0,0,6,188,5,182,
+0,13,0,27,0,0,19,51,19,33,55,33,3,51,7,35,3,35,19,35,37,51,19,33,55,33,3,
+51,7,35,3,35,19,35,207,254,166,254,39,53,2,155,217,240,53,240,217,199,220,
+254,3,112,254,166,254,39,53,2,156,217,239,53,239,218,198,219,254,3,45,1,231,
+162,253,119,162,253,117,2,139,162,1,231,162,253,119,162,253,117,2,139,0,2,
+0,154,0,0,6,166,5,182,0,13,0,17,0,0,33,35,19,35,55,51,19,33,55,33,1,35,19,
+33,19,3,33,19,1,131,203,219,249,53,250,166,254,43,53,5,215,254,24,202,219,
+253,141,215,162,2,115,166,2,139,162,1,231,162,250,74,2,139,2,137,254,25,1,
+231,0,1,0,33,0,0,6,115,5,182,0,13,0,0,1,33,1,35,1,33,1,33,19,33,55,33,3,51,
+3,221,2,150,254,32,200,1,170,254,250,254,86,253,172,229,254,203,53,1,252,
+229,200,5,182,250,74,5,20,250,236,2,170,162,253,86,0,1,251,96,254,18,1,117,
+2,70,0,11,0,0,3,33,55,51,7,33,1,33,3,35,55,35,221,252,61,74,127,35,2,180,
+1,58,1,129,101,127,64,113,254,18,230,107,3,185,254,202,195,0,0,1,251,82,253,
+213,0,25,255,205,0,23,0,0,5,23,22,22,51,50,54,53,52,39,39,55,22,22,21,20,
+6,35,34,38,39,39,5,39,252,211,64,177,228,82,77,74,69,39,90,72,82,147,136,
+114,237,153,74,254,213,63,61,60,170,143,61,51,68,77,44,82,62,142,62,112,126,
+124,140,66,154,125,0,1,251,90,254,4,253,127,255,147,0,9,0,0,1,35,19,33,3,
+51,7,33,19,35,251,205,115,131,1,101,97,158,31,254,242,94,127,254,4,1,143,
+254,222,93,1,35,0,1,253,12,6,8,254,211,7,184,0,7,0,0,1,23,55,33,53,33,3,37,
+253,31,200,74,254,242,1,176,166,254,223,6,182,28,188,98,254,80,76,0,0,1,251,
+178,254,4,253,57,255,147,0,5,0,0,1,35,19,35,53,33,252,156,117,117,234,1,135,
+254,4,1,45,98,0,1,255,227,0,0,2,131,2,217,0,11,0,0,1,7,33,7,33,1,33,55,33,
+3,51,7,1,76,76,1,131,45,253,219,1,8,254,170,45,1,244,135,201,35,1,53,170,
+139,2,78,139,254,203,111,0,1,255,250,0,0,2,154,2,217,0,11,0,0,37,33,7,33,
+19,35,55,51,55,33,55,33,1,23,1,131,45,253,219,137,201,35,215,78,254,170,45,
+1,244,139,139,1,53,111,170,139,0,1,252,233,6,12,255,72,7,164,0,6,0,0,1,19,
+51,1,35,1,51,254,25,157,146,255,0,95,255,0,146,6,158,1,6,254,104,1,152,0,
+0,1,252,233,6,12,255,72,7,164,0,10,0,0,1,19,51,1,35,1,51,23,55,51,7,254,25,
+157,146,255,0,95,255,0,146,72,71,105,125,6,158,1,6,254,104,1,152,119,119,
+203,0,1,255,215,254,252,1,184,2,162,0,37,0,0,3,33,21,7,22,21,20,6,6,7,7,6,
+6,21,20,51,50,55,23,6,6,35,34,53,52,54,63,2,54,53,52,38,35,35,55,55,35,10,
+1,137,203,238,16,30,44,88,69,34,90,91,88,34,34,125,62,215,45,37,107,32,64,
+121,143,50,19,168,203,2,162,43,176,26,169,33,53,46,42,78,57,43,14,52,49,96,
+23,32,141,37,77,32,94,31,60,48,60,59,57,146,0,1,0,111,2,6,1,184,3,80,0,11,
+0,0,1,21,35,53,35,53,51,53,51,21,51,21,1,51,63,133,133,63,133,2,139,133,133,
+64,133,133,64,0,0,1,250,158,253,213,253,223,255,199,0,27,0,0,5,51,21,20,6,
+6,35,34,38,53,52,54,51,50,23,21,38,35,34,6,21,20,22,51,50,54,54,53,253,100,
+123,112,206,138,166,211,190,146,61,59,68,52,97,104,116,121,108,150,80,80,
+22,129,209,115,143,117,106,132,9,104,4,68,61,65,74,89,152,87,0,2,250,174,
+254,4,254,86,255,147,0,7,0,15,0,0,5,35,53,33,3,51,21,33,1,35,53,33,3,51,21,
+33,251,168,250,1,139,137,250,254,117,2,53,250,1,139,137,250,254,117,197,88,
+254,201,88,1,55,88,254,201,88,0,0,1,0,152,0,0,11,88,5,182,0,23,0,0,33,35,
+1,33,55,33,3,33,3,51,1,33,1,35,1,33,1,33,19,35,3,35,1,33,1,131,199,1,172,
+254,48,53,5,127,205,1,184,229,201,1,168,2,149,254,33,201,1,170,254,250,254,
+86,253,172,229,241,226,198,1,172,253,231,5,20,162,253,150,253,86,5,20,250,
+74,5,20,250,236,2,170,253,86,5,20,0,0,2,0,154,0,0,13,29,5,182,0,30,0,34,0,
+0,1,1,35,3,3,33,19,33,3,35,19,33,3,35,19,35,55,51,19,33,55,33,3,33,3,33,1,
+51,3,19,1,37,3,33,19,13,29,254,151,200,203,193,253,31,219,253,229,217,198,
+219,253,225,217,199,220,254,53,254,166,254,39,53,5,127,217,2,225,219,1,86,
+1,168,198,192,201,1,14,246,221,162,2,31,166,4,74,251,182,2,74,253,182,2,139,
+253,117,2,139,253,117,2,139,162,1,231,162,253,119,253,117,5,20,253,180,253,
+173,3,51,202,254,25,1,231,0,2,0,123,255,252,6,57,5,186,0,15,0,31,0,0,19,52,
+18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,22,22,51,50,54,18,53,52,38,38,
+35,34,6,6,123,193,1,88,198,200,1,86,193,200,254,172,195,196,254,170,197,188,
+147,255,145,145,254,148,148,253,146,146,255,146,2,219,193,1,86,200,200,254,
+170,193,197,254,168,194,197,1,87,195,146,254,147,147,1,0,144,144,254,149,
+149,254,0,1,0,158,0,0,5,238,5,182,0,19,0,0,1,35,7,35,19,33,3,33,1,35,7,35,
+19,33,19,35,39,33,1,33,4,248,180,48,188,96,2,54,234,251,182,1,174,231,41,
+186,94,4,6,98,192,45,254,186,254,135,2,193,2,45,125,1,31,253,49,5,20,124,
+1,30,254,226,124,251,142,0,0,1,0,158,0,0,5,61,5,182,0,15,0,0,1,35,7,35,19,
+33,3,33,7,33,3,33,19,51,3,33,2,106,233,41,186,94,2,113,246,1,98,53,254,158,
+132,2,86,105,192,157,252,30,5,20,124,1,30,253,25,162,254,117,1,65,254,29,
+0,1,0,156,0,0,6,23,5,182,0,23,0,0,1,35,7,35,19,33,1,33,39,38,53,52,54,51,
+33,7,33,34,21,20,23,5,7,33,2,104,233,41,186,94,2,112,254,82,2,105,125,121,
+145,134,1,209,54,254,103,92,102,1,16,37,251,127,5,20,124,1,30,250,236,110,
+109,108,109,121,162,74,42,87,243,111,0,1,0,92,0,0,4,111,5,182,0,19,0,0,1,
+51,55,51,7,33,3,35,19,35,7,35,55,33,19,33,7,35,19,33,2,225,183,28,187,82,
+254,143,207,196,204,178,28,187,82,1,111,172,254,170,41,187,95,2,215,3,14,
+90,251,253,147,2,109,91,252,2,6,124,1,30,0,1,0,127,0,0,6,158,5,182,0,15,0,
+0,51,1,35,7,35,19,33,1,33,1,33,19,35,39,35,1,127,1,172,145,41,187,92,2,21,
+254,84,4,39,254,84,2,20,92,186,41,145,1,172,5,20,124,1,30,250,236,5,20,254,
+226,124,250,236,0,0,1,255,211,0,0,5,45,5,182,0,23,0,0,1,33,19,35,39,35,1,
+33,39,38,53,52,54,51,33,7,33,34,21,20,23,5,7,33,1,180,1,197,84,187,38,164,
+254,135,2,108,125,120,145,133,1,209,53,254,102,92,102,1,17,37,251,127,5,182,
+254,254,96,251,142,110,109,108,109,121,162,74,42,87,243,111,0,1,255,94,0,
+0,6,158,5,182,0,15,0,0,39,51,1,33,1,51,1,33,7,35,1,33,1,35,1,33,109,160,1,
+170,2,103,254,82,241,1,172,1,107,54,159,254,84,253,123,1,176,213,254,84,254,
+151,162,5,20,250,236,5,20,162,250,236,5,20,250,236,0,2,255,236,255,227,7,
+12,5,182,0,9,0,53,0,0,55,50,55,38,35,34,6,21,20,22,1,33,7,35,19,33,1,30,3,
+51,50,54,55,55,1,33,19,35,39,35,1,14,3,35,34,38,39,39,6,6,35,34,38,53,52,
+54,51,50,22,23,248,87,46,60,71,45,64,54,2,10,254,225,41,186,92,2,162,254,
+137,9,41,54,63,32,60,58,33,57,1,60,1,131,100,186,55,101,254,209,35,59,78,
+110,84,66,126,46,35,50,132,92,121,145,152,122,43,102,35,121,147,56,52,47,
+46,58,4,155,124,1,30,251,142,12,56,57,43,70,106,178,3,184,254,205,145,252,
+107,105,155,102,50,71,56,41,88,78,131,111,121,143,24,21,0,1,0,147,0,0,5,238,
+5,182,0,27,0,0,1,33,19,35,39,35,1,33,39,38,53,52,54,51,33,7,33,34,21,20,23,
+5,7,33,1,35,7,35,1,74,2,239,84,186,39,164,254,135,2,109,125,121,145,134,1,
+209,54,254,103,92,102,1,16,37,251,127,1,172,108,39,190,5,182,254,254,96,251,
+142,110,109,108,109,121,162,74,42,87,243,111,5,20,124,0,1,0,145,0,0,3,63,
+5,182,0,9,0,0,19,33,55,33,55,33,1,35,1,33,238,1,43,36,254,211,54,1,249,254,
+27,201,1,82,254,213,4,164,112,162,250,74,4,2,0,2,0,131,0,0,6,0,5,182,0,11,
+0,15,0,0,1,33,1,33,55,33,1,33,1,33,55,33,1,33,7,33,4,137,252,105,1,63,254,
+150,53,2,55,254,191,2,2,1,10,254,152,53,2,53,250,184,3,152,53,252,104,1,74,
+3,202,162,252,54,3,40,162,250,236,162,0,3,255,211,253,147,8,242,5,182,0,10,
+0,23,0,54,0,0,1,20,22,51,50,54,55,38,35,34,6,3,1,35,3,3,33,1,33,7,33,1,33,
+19,1,34,38,39,6,6,35,34,38,53,52,54,54,51,50,23,1,33,55,33,1,22,51,50,54,
+18,53,39,51,2,2,4,180,61,48,42,65,10,44,69,48,65,143,1,39,195,194,191,252,
+203,1,227,2,101,54,254,97,254,137,1,168,241,3,215,75,168,45,34,132,78,126,
+155,70,125,80,100,84,1,242,254,41,53,2,158,253,174,121,77,72,113,70,1,181,
+19,224,254,147,48,56,69,56,88,59,4,139,252,176,2,70,253,186,5,182,162,251,
+142,2,174,250,74,77,50,64,70,142,112,69,121,71,70,5,196,162,249,11,121,159,
+1,49,160,37,254,117,254,72,0,0,1,0,141,0,0,10,250,5,182,0,23,0,0,33,55,33,
+1,33,3,51,7,33,1,33,1,33,1,33,1,33,55,51,19,33,1,33,7,1,31,53,1,172,1,121,
+253,209,191,230,54,254,82,1,39,3,201,254,78,1,190,1,174,3,195,254,221,254,
+64,53,248,180,253,211,254,137,1,201,54,162,4,114,253,193,162,3,131,250,236,
+5,20,252,144,161,2,45,251,142,162,0,3,0,147,0,0,8,78,5,182,0,15,0,21,0,27,
+0,0,37,33,7,33,55,33,1,33,55,33,1,33,1,33,55,33,1,33,55,33,3,35,1,33,55,33,
+3,35,6,160,1,166,54,248,136,53,1,39,1,118,253,62,53,3,144,254,81,3,23,1,119,
+253,76,53,3,129,249,137,254,188,52,1,237,243,170,4,161,254,189,51,1,238,244,
+170,162,162,162,4,114,162,250,236,4,114,162,253,248,154,253,32,2,70,154,253,
+32,0,0,4,0,229,0,0,6,29,5,182,0,3,0,9,0,13,0,17,0,0,1,33,7,33,1,35,1,33,55,
+33,1,33,7,33,23,33,7,33,1,27,2,247,53,253,8,3,80,203,1,183,251,196,54,5,2,
+250,254,2,114,53,253,141,54,1,237,53,254,18,4,33,162,252,129,5,20,162,252,
+213,162,243,162,0,0,4,0,74,255,25,7,211,6,162,0,15,0,27,0,39,0,83,0,0,1,20,
+22,22,51,50,54,54,53,52,38,38,35,34,6,6,23,52,54,51,50,22,21,20,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,37,54,0,55,53,39,51,23,55,51,7,21,22,0,
+23,51,55,21,7,23,21,39,35,6,0,7,21,23,35,39,7,35,55,53,38,0,39,35,7,53,55,
+39,53,23,2,106,114,197,111,109,194,113,113,195,108,110,198,114,222,119,81,
+82,119,118,83,82,118,108,53,39,38,55,55,38,39,53,254,35,30,1,5,180,174,125,
+147,148,125,174,178,1,3,30,176,221,186,186,221,176,30,254,253,178,174,125,
+148,147,125,174,181,254,251,29,176,221,186,186,221,2,221,109,194,115,113,
+195,110,110,195,113,115,194,109,82,119,119,82,80,121,121,80,39,53,51,41,40,
+52,53,62,178,1,2,30,177,221,187,187,221,177,30,254,255,179,174,125,148,147,
+125,174,180,254,250,29,176,221,186,186,221,176,30,1,6,179,174,125,147,148,
+125,174,0,0,5,0,137,0,166,4,248,5,20,0,15,0,21,0,27,0,33,0,39,0,0,19,52,18,
+36,51,50,4,18,21,20,2,4,35,34,36,2,1,34,7,23,55,38,1,52,39,7,23,54,37,20,
+23,55,39,6,1,50,55,39,7,22,137,153,1,8,151,151,1,7,153,152,254,248,151,153,
+254,249,152,2,56,134,112,243,246,112,1,30,80,245,243,82,252,189,80,241,243,
+78,1,162,133,108,244,241,107,2,221,153,1,7,151,151,254,249,153,152,254,248,
+151,152,1,7,2,58,82,244,246,80,254,94,132,112,246,244,111,135,139,105,242,
+244,105,253,213,78,244,242,80,0,0,4,0,137,0,166,4,248,5,20,0,15,0,33,0,41,
+0,49,0,0,19,52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,23,54,51,50,23,
+54,53,52,39,6,6,35,34,38,39,6,1,34,7,22,51,50,55,38,3,50,55,38,35,34,7,22,
+137,153,1,8,151,151,1,7,153,152,254,248,151,153,254,249,152,150,59,174,185,
+189,167,61,61,76,187,93,90,185,84,59,1,162,155,118,120,153,154,116,118,152,
+144,126,115,155,154,119,126,2,221,153,1,7,151,151,254,249,153,152,254,248,
+151,152,1,7,152,114,101,125,125,101,114,114,101,61,64,62,63,101,254,173,92,
+101,101,92,1,194,91,102,102,91,0,2,0,137,0,166,4,248,5,20,0,15,0,31,0,0,19,
+52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,22,22,51,50,54,54,53,52,38,
+38,35,34,6,6,137,153,1,8,151,151,1,7,153,152,254,248,151,153,254,249,152,
+150,112,194,112,111,193,113,113,192,112,111,194,113,2,221,153,1,7,151,151,
+254,249,153,152,254,248,151,152,1,7,152,111,194,113,112,194,112,111,195,112,
+112,194,0,0,11,255,211,253,147,13,215,5,182,0,12,0,16,0,27,0,58,0,62,0,66,
+0,70,0,74,0,78,0,82,0,86,0,0,1,1,35,3,3,33,1,33,7,33,1,33,19,1,33,7,33,1,
+20,22,51,50,54,55,38,35,34,6,1,1,22,51,50,54,54,55,22,23,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,54,51,50,23,1,33,55,1,33,7,33,23,33,7,33,23,33,7,33,
+1,33,7,33,7,33,7,33,7,33,7,33,7,33,7,33,4,37,1,39,195,194,191,252,203,1,227,
+2,101,54,254,97,254,137,1,168,241,1,17,3,137,53,252,119,2,172,60,48,43,64,
+10,44,69,48,64,4,22,253,174,121,78,34,49,39,31,90,50,56,146,91,76,169,44,
+34,132,78,125,155,70,125,79,99,86,1,241,254,41,53,252,140,3,225,53,252,30,
+175,2,235,53,253,20,176,1,234,53,254,22,6,60,1,233,53,254,22,78,1,234,53,
+254,22,82,1,234,53,254,22,82,1,234,54,254,23,3,80,252,176,2,70,253,186,5,
+182,162,251,142,2,174,2,102,162,249,127,48,56,69,56,88,59,6,241,249,11,121,
+25,43,61,47,35,116,105,78,49,64,70,140,114,69,122,70,70,5,196,162,254,107,
+162,244,162,243,162,5,98,162,243,162,244,162,243,162,0,5,0,152,0,0,6,61,5,
+182,0,5,0,9,0,13,0,17,0,21,0,0,33,35,1,33,55,33,51,33,7,33,7,33,7,33,7,33,
+7,33,7,33,7,33,1,131,203,1,183,254,41,53,2,157,234,1,233,53,254,23,78,1,233,
+53,254,23,82,1,233,53,254,22,81,1,233,53,254,22,5,20,162,162,243,162,244,
+162,243,162,0,5,255,211,0,0,9,113,5,182,0,14,0,18,0,22,0,26,0,30,0,0,1,19,
+23,35,3,3,33,1,33,7,33,1,33,19,55,1,33,7,33,23,33,7,33,23,33,7,33,23,33,7,
+33,4,37,216,79,195,194,191,252,203,1,227,2,99,52,254,97,254,137,1,168,180,
+61,1,17,4,248,54,251,9,176,3,225,53,252,30,175,2,235,53,253,20,176,1,234,
+53,254,22,3,80,253,152,232,2,70,253,186,5,182,162,251,142,1,250,180,2,102,
+162,243,162,244,162,243,162,0,9,255,158,0,0,13,135,5,182,0,19,0,23,0,27,0,
+31,0,35,0,39,0,43,0,47,0,51,0,0,1,51,1,1,33,7,35,19,33,1,35,1,3,33,1,33,7,
+35,1,33,37,33,7,33,19,33,7,33,19,33,7,33,19,33,7,33,1,33,7,33,19,33,7,33,
+19,33,7,33,19,33,7,33,6,6,88,1,242,1,90,253,158,33,197,86,3,238,254,24,127,
+254,33,217,252,225,1,228,1,129,51,191,254,137,1,148,250,219,1,233,53,254,
+23,184,1,233,53,254,23,188,1,234,54,254,23,184,1,234,54,254,23,8,229,1,234,
+53,254,22,184,1,234,53,254,22,189,1,233,53,254,22,185,1,233,53,254,22,3,203,
+253,73,4,0,94,1,0,250,74,2,150,253,106,5,182,162,251,142,84,162,2,55,162,
+2,56,162,2,55,162,251,226,162,2,55,162,2,56,162,2,55,162,0,255,255,251,82,
+253,14,0,25,255,147,2,35,0,38,0,0,255,57,0,3,0,41,2,18,0,0,255,255,251,6,
+254,4,254,225,255,147,2,34,0,39,172,0,0,3,0,41,1,168,0,0,255,255,251,116,
+253,75,1,137,1,127,0,35,0,37,0,20,255,57,0,3,0,41,1,79,0,0,0,0,0,15,0,186,
+0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,38,0,94,0,3,0,1,4,9,0,2,0,14,0,
+132,0,3,0,1,4,9,0,3,0,76,0,146,0,3,0,1,4,9,0,4,0,38,0,94,0,3,0,1,4,9,0,5,
+0,30,0,222,0,3,0,1,4,9,0,6,0,34,0,252,0,3,0,1,4,9,0,7,0,68,1,30,0,3,0,1,4,
+9,0,8,0,42,1,98,0,3,0,1,4,9,0,9,0,40,1,140,0,3,0,1,4,9,0,10,0,96,1,180,0,
+3,0,1,4,9,0,11,0,62,2,20,0,3,0,1,4,9,0,12,0,60,2,82,0,3,0,1,4,9,0,13,2,150,
+2,142,0,3,0,1,4,9,0,14,0,52,5,36,0,67,0,111,0,112,0,121,0,114,0,105,0,103,
+0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,
+101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,
+0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,
+0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,117,0,110,0,
+100,0,97,0,110,0,101,0,115,0,101,0,82,0,101,0,103,0,117,0,108,0,97,0,114,
+0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,
+0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,
+110,0,115,0,32,0,83,0,117,0,110,0,100,0,97,0,110,0,101,0,115,0,101,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,104,
+0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,83,0,117,0,110,0,100,0,97,
+0,110,0,101,0,115,0,101,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,
+0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,
+0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,
+111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,
+0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,
+0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,
+0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,
+0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,
+0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,
+112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,
+110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,79,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,
+1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,
+1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,
+1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,
+1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,
+1,72,1,73,1,74,1,75,1,76,1,77,4,110,117,108,108,7,117,110,105,49,66,56,48,
+7,117,110,105,49,66,56,49,7,117,110,105,49,66,56,50,7,117,110,105,49,66,56,
+51,7,117,110,105,49,66,56,52,7,117,110,105,49,66,56,53,7,117,110,105,49,66,
+56,54,7,117,110,105,49,66,56,55,7,117,110,105,49,66,56,56,7,117,110,105,49,
+66,56,57,7,117,110,105,49,66,56,65,7,117,110,105,49,66,56,66,7,117,110,105,
+49,66,56,67,7,117,110,105,49,66,56,68,7,117,110,105,49,66,56,69,7,117,110,
+105,49,66,56,70,7,117,110,105,49,66,57,48,7,117,110,105,49,66,57,49,7,117,
+110,105,49,66,57,50,7,117,110,105,49,66,57,51,7,117,110,105,49,66,57,52,7,
+117,110,105,49,66,57,53,7,117,110,105,49,66,57,54,7,117,110,105,49,66,57,
+55,7,117,110,105,49,66,57,56,7,117,110,105,49,66,57,57,7,117,110,105,49,66,
+57,65,7,117,110,105,49,66,57,66,7,117,110,105,49,66,57,67,7,117,110,105,49,
+66,57,68,7,117,110,105,49,66,57,69,7,117,110,105,49,66,57,70,7,117,110,105,
+49,66,65,48,7,117,110,105,49,66,65,49,7,117,110,105,49,66,65,50,7,117,110,
+105,49,66,65,51,7,117,110,105,49,66,65,52,7,117,110,105,49,66,65,53,7,117,
+110,105,49,66,65,54,7,117,110,105,49,66,65,55,7,117,110,105,49,66,65,56,7,
+117,110,105,49,66,65,57,7,117,110,105,49,66,65,65,7,117,110,105,49,66,65,
+66,7,117,110,105,49,66,65,67,7,117,110,105,49,66,65,68,7,117,110,105,49,66,
+65,69,7,117,110,105,49,66,65,70,7,117,110,105,49,66,66,48,7,117,110,105,49,
+66,66,49,7,117,110,105,49,66,66,50,7,117,110,105,49,66,66,51,7,117,110,105,
+49,66,66,52,7,117,110,105,49,66,66,53,7,117,110,105,49,66,66,54,7,117,110,
+105,49,66,66,55,7,117,110,105,49,66,66,56,7,117,110,105,49,66,66,57,7,117,
+110,105,49,66,66,65,7,117,110,105,49,66,66,66,7,117,110,105,49,66,66,67,7,
+117,110,105,49,66,66,68,7,117,110,105,49,66,66,69,7,117,110,105,49,66,66,
+70,7,117,110,105,49,67,67,48,7,117,110,105,49,67,67,49,7,117,110,105,49,67,
+67,50,7,117,110,105,49,67,67,51,7,117,110,105,49,67,67,52,7,117,110,105,49,
+67,67,53,7,117,110,105,49,67,67,54,7,117,110,105,49,67,67,55,11,117,110,105,
+49,66,65,50,49,66,65,53,11,117,110,105,49,66,65,51,49,66,65,53,11,117,110,
+105,49,66,65,49,49,66,65,53,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,
+0,0,0,76,0,0,0,2,0,10,0,0,0,3,0,1,0,4,0,5,0,3,0,6,0,36,0,1,0,37,0,41,0,3,
+0,42,0,43,0,1,0,44,0,45,0,3,0,46,0,46,0,1,0,47,0,49,0,3,0,50,0,75,0,1,0,76,
+0,78,0,3,0,4,0,0,0,1,0,0,0,1,0,0,0,10,0,34,0,74,0,1,68,70,76,84,0,8,0,4,0,
+0,0,0,255,255,0,3,0,0,0,1,0,2,0,3,100,105,115,116,0,20,109,97,114,107,0,26,
+109,107,109,107,0,34,0,0,0,1,0,0,0,0,0,2,0,1,0,2,0,0,0,1,0,3,0,4,0,10,0,244,
+1,232,3,50,0,2,0,8,0,1,0,8,0,1,1,4,0,1,0,1,0,28,0,74,0,162,0,162,0,66,0,74,
+0,82,0,82,0,90,0,98,0,106,0,114,0,162,0,162,0,114,0,122,0,130,0,138,0,146,
+0,162,0,154,0,162,0,170,0,178,0,186,0,194,0,202,0,210,0,218,0,1,0,42,2,248,
+250,76,0,1,0,42,2,248,250,36,0,1,0,42,2,248,249,112,0,1,0,42,2,248,247,124,
+0,1,0,42,2,248,249,52,0,1,0,42,2,248,251,20,0,1,0,42,2,248,250,176,0,1,0,
+42,2,248,248,88,0,1,0,42,2,248,250,136,0,1,0,42,2,248,249,12,0,1,0,42,2,248,
+251,200,0,1,0,42,2,248,250,156,0,1,0,42,2,248,249,192,0,1,0,42,2,248,249,
+172,0,1,0,42,2,248,249,232,0,1,0,42,2,248,245,16,0,1,0,42,2,248,242,244,0,
+1,0,42,2,248,250,96,0,1,0,42,2,248,246,140,0,1,0,42,2,248,245,96,0,4,0,0,
+0,1,0,8,0,1,0,12,0,26,0,1,0,48,0,94,0,1,0,5,0,4,0,5,0,40,0,44,0,45,0,2,0,
+3,0,14,0,36,0,0,0,50,0,51,0,23,0,63,0,65,0,25,0,5,0,0,0,22,0,0,0,28,0,0,0,
+34,0,0,0,40,0,0,0,40,0,1,254,72,6,4,0,1,254,52,6,4,0,1,253,238,6,4,0,1,254,
+32,6,4,0,28,0,100,0,88,0,70,0,70,0,70,0,70,0,70,0,58,0,64,0,100,0,100,0,100,
+0,70,0,100,0,76,0,82,0,88,0,94,0,106,0,100,0,100,0,106,0,106,0,112,0,118,
+0,124,0,130,0,136,0,1,4,236,6,64,0,1,4,26,6,64,0,1,3,52,6,64,0,1,4,176,6,
+64,0,1,3,132,6,64,0,1,4,56,6,64,0,1,2,228,6,64,0,1,3,192,6,64,0,1,3,252,6,
+64,0,1,6,164,6,64,0,1,7,8,6,64,0,1,3,152,6,64,0,1,5,30,6,64,0,1,6,84,6,64,
+0,4,0,0,0,1,0,8,0,1,0,12,0,34,0,1,0,56,0,142,0,1,0,9,0,37,0,38,0,39,0,41,
+0,48,0,49,0,76,0,77,0,78,0,2,0,3,0,7,0,36,0,0,0,50,0,51,0,30,0,63,0,65,0,
+32,0,9,0,0,0,38,0,0,0,44,0,0,0,50,0,0,0,56,0,0,0,62,0,0,0,62,0,0,0,68,0,0,
+0,74,0,0,0,80,0,1,252,164,0,0,0,1,253,248,0,0,0,1,251,230,0,0,0,1,252,24,
+0,0,0,1,252,44,0,0,0,1,254,12,0,0,0,1,253,188,0,0,0,1,253,68,0,0,0,35,0,120,
+0,72,0,78,0,120,0,84,0,90,0,120,0,96,0,144,0,144,0,144,0,102,0,108,0,126,
+0,108,0,114,0,138,0,114,0,144,0,144,0,132,0,120,0,168,0,126,0,132,0,144,0,
+138,0,144,0,144,0,144,0,150,0,156,0,162,0,168,0,174,0,1,2,108,0,0,0,1,3,232,
+0,0,0,1,4,36,0,0,0,1,3,212,0,0,0,1,3,32,0,0,0,1,2,148,0,0,0,1,5,20,0,0,0,
+1,3,112,0,0,0,1,4,76,0,0,0,1,3,162,0,0,0,1,1,244,0,0,0,1,2,188,0,0,0,1,2,
+248,0,0,0,1,8,42,0,0,0,1,10,130,0,0,0,1,2,238,0,0,0,1,2,88,0,0,0,1,6,184,
+0,0,0,6,0,0,0,1,0,8,0,1,0,12,0,20,0,1,0,30,0,52,0,1,0,2,0,4,0,5,0,1,0,3,0,
+40,0,44,0,45,0,2,0,0,0,10,0,0,0,16,0,1,254,62,5,250,0,1,254,32,5,250,0,3,
+0,8,0,14,0,14,0,1,255,226,5,250,0,1,0,80,5,250,0,1,0,0,0,10,0,30,0,44,0,1,
+68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,0,8,0,0,0,1,
+0,0,0,1,0,4,0,4,0,0,0,1,0,8,0,1,0,42,0,3,0,12,0,22,0,32,0,1,0,4,0,78,0,2,
+0,41,0,1,0,4,0,76,0,2,0,41,0,1,0,4,0,77,0,2,0,41,0,1,0,3,0,37,0,38,0,39,};
+#endif
@@ -0,0 +1,625 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansSylotiNagri_Regular_ttf_size = 14912;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansSylotiNagri_Regular_ttf");
+asm(".type fz_font_NotoSansSylotiNagri_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansSylotiNagri_Regular_ttf, 14912");
+asm(".balign 64");
+asm("fz_font_NotoSansSylotiNagri_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansSylotiNagri-Regular.ttf\"");
+#else
+const int fz_font_NotoSansSylotiNagri_Regular_ttf_size = 14912;
+const char fz_font_NotoSansSylotiNagri_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,1,32,1,42,0,0,51,244,0,0,0,78,71,
+80,79,83,200,11,200,168,0,0,52,68,0,0,4,244,71,83,85,66,174,173,188,194,0,
+0,57,56,0,0,1,8,79,83,47,50,122,87,107,185,0,0,1,104,0,0,0,96,99,109,97,112,
+173,207,149,138,0,0,3,12,0,0,0,132,103,97,115,112,0,7,0,7,0,0,51,232,0,0,
+0,12,103,108,121,102,91,84,126,246,0,0,4,60,0,0,41,102,104,101,97,100,6,52,
+49,106,0,0,0,236,0,0,0,54,104,104,101,97,15,144,7,171,0,0,1,36,0,0,0,36,104,
+109,116,120,110,29,239,255,0,0,1,200,0,0,1,66,108,111,99,97,122,114,132,161,
+0,0,3,144,0,0,0,172,109,97,120,112,0,102,0,139,0,0,1,72,0,0,0,32,110,97,109,
+101,145,7,187,219,0,0,45,164,0,0,6,34,112,111,115,116,255,184,0,50,0,0,51,
+200,0,0,0,32,0,1,0,0,0,1,10,61,82,156,235,240,95,15,60,245,0,11,8,0,0,0,0,
+0,205,166,234,230,0,0,0,0,210,109,241,212,252,100,253,168,10,156,7,205,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,10,145,252,100,255,37,10,
+156,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,1,0,0,0,85,0,138,0,16,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,87,1,144,0,5,0,0,5,154,5,51,0,0,
+1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,16,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,1,0,0,0,0,4,250,4,250,0,0,0,32,0,2,4,205,0,193,0,0,0,0,2,20,0,
+0,2,20,0,0,0,0,0,0,0,0,255,220,0,0,255,37,2,147,0,82,2,147,0,82,4,193,0,98,
+6,119,255,221,4,29,255,221,0,0,252,100,5,207,255,242,4,137,255,221,4,199,
+255,221,0,0,253,14,7,43,255,221,7,178,255,221,5,72,255,221,4,231,255,221,
+0,0,253,217,4,211,255,221,5,225,255,221,5,254,255,229,7,127,255,221,4,88,
+255,221,4,53,255,221,6,39,255,242,4,104,255,221,4,147,255,221,7,102,255,221,
+5,100,255,221,6,115,255,221,5,10,255,221,6,0,255,221,7,68,255,221,4,190,255,
+221,5,186,255,221,5,76,255,221,5,55,255,221,5,55,255,221,4,223,255,221,6,
+25,255,221,6,76,255,221,2,63,255,221,2,8,254,131,0,0,252,225,0,0,252,199,
+2,25,254,246,3,12,0,164,2,166,0,100,5,6,0,100,5,43,0,143,9,154,255,221,7,
+82,255,221,7,213,255,221,8,127,255,221,6,51,255,229,4,225,255,221,4,244,255,
+221,8,102,255,221,5,111,255,223,4,43,255,221,5,229,255,221,6,78,255,246,5,
+78,255,221,10,145,255,242,6,207,255,221,9,82,255,240,6,207,255,221,6,207,
+255,221,5,29,0,63,3,8,1,142,4,202,1,142,4,188,0,147,0,249,0,134,0,59,0,128,
+0,100,0,43,0,144,0,45,0,55,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,120,0,0,0,26,
+0,16,0,3,0,10,0,0,0,13,0,32,0,160,9,101,9,239,32,13,32,17,32,85,37,204,168,
+43,254,255,255,255,0,0,0,0,0,13,0,32,0,160,9,100,9,230,32,11,32,16,32,85,
+37,204,168,0,254,255,255,255,0,1,255,245,255,227,255,99,246,229,246,101,223,
+249,223,247,223,243,218,61,88,10,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,21,0,34,0,63,0,76,0,89,1,0,
+1,47,1,108,1,133,1,221,2,29,2,92,2,111,2,165,2,224,3,24,3,96,3,134,3,180,
+4,6,4,68,4,142,4,215,5,5,5,72,5,128,5,176,5,239,6,36,6,90,6,149,6,190,7,11,
+7,59,7,129,7,195,7,239,8,47,8,95,8,160,8,221,8,238,9,17,9,52,9,74,9,103,9,
+141,9,210,10,55,10,188,11,15,11,102,11,185,12,36,12,135,12,212,13,40,13,134,
+13,230,14,53,14,146,15,1,15,94,15,194,16,32,16,158,16,253,17,94,18,30,18,
+43,18,62,18,101,18,163,18,220,19,19,19,91,19,165,19,231,20,32,20,103,20,179,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,255,220,0,183,0,36,6,131,
+0,3,0,0,19,17,35,17,36,72,6,131,250,52,5,204,0,1,255,37,0,183,0,219,6,131,
+0,14,0,0,55,35,17,7,39,55,39,55,23,55,23,7,23,7,39,36,72,134,49,171,171,49,
+170,170,49,171,171,49,134,183,4,161,136,49,169,168,49,171,171,49,168,169,
+49,136,0,1,0,82,1,213,2,66,2,117,0,3,0,0,19,53,33,21,82,1,240,1,213,160,160,
+0,0,1,0,82,1,213,2,66,2,117,0,3,0,0,19,53,33,21,82,1,240,1,213,160,160,0,
+0,16,0,98,0,86,4,94,4,82,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,
+0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,34,
+53,52,51,50,19,20,35,34,53,52,51,50,23,20,35,34,53,52,51,50,1,20,35,34,53,
+52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,
+50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,
+20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,37,20,35,34,53,52,51,50,19,20,
+35,34,53,52,51,50,39,20,35,34,53,52,51,50,3,215,51,55,55,51,147,52,57,57,
+52,247,55,53,55,53,35,51,55,55,51,254,56,54,53,53,54,173,55,53,53,55,2,82,
+55,53,53,55,253,27,55,54,54,55,2,129,51,55,55,51,147,52,57,57,52,253,174,
+52,57,55,54,35,53,56,56,53,1,199,54,53,53,54,254,92,54,55,55,54,247,55,53,
+53,55,147,55,54,54,55,3,150,54,54,55,43,53,53,55,254,211,55,55,53,227,53,
+53,53,1,148,56,56,53,90,53,53,55,253,119,53,53,55,1,185,54,51,58,253,67,53,
+53,56,154,51,51,55,2,29,55,55,53,227,53,53,53,254,4,55,55,54,227,53,53,55,
+254,213,55,51,55,43,53,53,56,0,0,1,255,221,0,0,6,135,5,111,0,26,0,0,3,33,
+21,35,17,35,17,39,1,2,2,6,35,34,38,39,55,22,22,51,50,62,3,1,33,35,6,170,149,
+154,6,254,236,232,252,184,96,91,119,36,145,25,51,39,27,63,79,111,168,2,60,
+250,145,5,111,140,251,29,4,10,2,254,171,254,222,254,232,117,103,106,68,68,
+51,29,66,116,193,2,169,0,0,1,255,221,255,227,4,53,5,111,0,38,0,0,3,33,21,
+33,17,54,54,51,50,22,21,20,4,35,7,30,2,23,7,38,36,39,39,55,22,51,50,54,53,
+52,38,35,34,6,7,39,17,33,35,4,88,253,101,62,118,78,105,134,254,218,226,2,
+153,175,155,66,125,105,254,220,183,92,23,78,65,196,253,64,63,65,146,49,115,
+254,227,5,111,140,254,250,52,51,139,113,172,215,9,53,98,138,98,86,155,212,
+55,27,151,10,147,119,62,67,105,85,47,1,182,0,0,2,252,100,5,207,255,2,7,205,
+0,3,0,7,0,0,1,19,7,1,39,1,7,1,254,4,254,106,254,235,176,1,76,90,254,159,7,
+205,254,86,68,1,156,24,254,148,88,1,96,0,0,1,255,242,0,0,5,229,5,111,0,59,
+0,0,1,38,53,52,54,54,51,50,22,22,21,20,6,7,50,22,21,20,6,4,35,34,36,2,53,
+16,1,33,53,33,21,33,0,17,20,22,22,51,50,54,54,53,52,38,35,34,6,7,39,54,54,
+53,52,38,35,34,6,21,20,23,2,111,13,83,142,78,75,122,72,52,51,133,152,141,
+254,234,167,187,254,195,165,1,26,254,107,5,243,252,119,254,176,127,231,150,
+126,204,100,98,84,31,99,40,45,118,101,66,59,53,78,6,3,41,42,40,74,116,66,
+61,113,82,51,97,32,162,141,121,183,104,169,1,30,188,1,70,1,26,140,140,254,
+238,254,178,150,222,119,66,115,77,90,104,19,16,146,31,75,66,56,67,65,54,23,
+24,0,2,255,221,255,240,4,160,7,117,0,35,0,41,0,0,3,33,46,4,39,55,30,3,23,
+51,21,35,16,2,4,35,21,20,22,51,50,55,23,6,6,35,34,38,53,17,35,33,17,50,54,
+18,53,35,3,101,8,53,81,107,131,161,26,194,227,142,87,10,205,195,130,254,235,
+242,97,93,97,112,74,77,131,75,166,180,219,1,119,190,208,98,5,111,77,113,81,
+53,37,26,131,21,81,123,176,117,140,254,232,254,181,155,102,122,134,63,133,
+38,35,213,186,3,100,253,144,121,1,12,235,0,0,3,255,221,255,238,4,225,5,111,
+0,18,0,27,0,39,0,0,33,17,6,35,34,38,53,52,54,51,50,23,17,33,53,33,21,35,17,
+1,32,17,16,33,50,55,17,38,1,50,22,21,20,6,35,34,38,53,52,54,3,129,136,181,
+226,233,238,216,174,148,252,92,5,4,196,254,55,254,205,1,39,175,138,142,254,
+33,56,65,65,56,57,63,63,1,123,100,202,201,193,210,98,1,8,140,140,251,29,3,
+172,254,254,255,0,125,1,35,98,253,43,59,56,57,61,61,57,56,59,0,0,1,253,14,
+6,10,255,170,7,188,0,5,0,0,9,2,7,39,7,253,14,1,68,1,88,109,233,215,6,113,
+1,75,254,181,103,252,252,0,0,3,255,221,0,0,7,55,5,111,0,17,0,23,0,27,0,0,
+1,4,5,17,35,17,6,3,39,17,35,53,33,21,35,17,35,17,1,54,37,17,33,17,1,17,54,
+37,5,252,254,227,254,248,154,254,249,148,213,7,90,153,156,251,86,213,1,16,
+254,19,2,135,242,1,61,4,47,127,194,253,18,2,117,211,254,221,68,4,32,140,140,
+251,29,4,45,253,86,229,209,1,170,252,162,3,94,254,195,164,153,0,0,3,255,221,
+0,0,7,197,5,111,0,17,0,23,0,29,0,0,1,0,1,39,17,39,0,1,39,17,35,53,33,21,35,
+17,35,17,1,54,18,55,33,17,33,23,54,18,55,33,6,117,254,169,254,246,163,7,254,
+196,254,255,162,174,7,232,174,156,250,180,116,248,152,253,244,2,231,9,117,
+241,156,253,245,4,123,254,211,254,84,65,2,119,2,254,224,254,102,65,3,0,140,
+140,251,29,4,119,254,65,161,1,12,126,253,215,2,163,1,6,130,0,0,2,255,221,
+0,0,5,98,5,111,0,21,0,33,0,0,3,33,21,35,17,35,17,33,0,17,20,6,35,34,38,38,
+53,52,37,38,39,33,1,20,22,51,50,54,54,53,52,39,6,6,35,5,133,192,156,253,254,
+1,8,190,152,90,149,84,1,180,105,114,254,145,1,53,84,66,51,90,58,23,158,168,
+5,111,140,251,29,4,227,254,185,254,235,175,210,82,150,96,246,114,191,110,
+253,82,73,91,58,110,74,82,90,34,127,0,0,3,255,221,0,0,4,252,5,111,0,22,0,
+32,0,43,0,0,33,53,35,32,36,39,54,54,55,38,38,39,54,36,33,51,53,33,53,33,21,
+35,17,1,34,6,7,22,33,51,55,17,38,3,34,6,7,22,22,51,50,55,17,39,3,154,33,254,
+226,254,141,132,51,198,104,95,162,40,137,1,62,1,12,43,252,67,5,31,199,254,
+211,147,226,114,169,1,115,46,47,102,9,159,203,95,97,196,127,109,39,57,117,
+138,159,64,126,33,42,134,74,137,113,114,140,140,251,29,2,45,64,85,146,2,1,
+31,6,1,182,56,79,89,69,3,1,32,2,0,0,2,253,217,5,250,255,180,7,180,0,11,0,
+23,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,
+6,253,217,136,100,101,138,141,98,97,139,133,58,43,46,58,58,46,43,58,6,215,
+94,127,127,94,96,125,126,95,39,57,56,40,40,56,56,0,2,255,221,0,0,4,231,5,
+111,0,15,0,25,0,0,33,17,36,36,39,54,36,51,51,53,33,53,33,21,35,17,1,34,6,
+6,7,22,33,51,17,39,3,133,254,231,254,120,136,191,1,96,223,43,252,88,5,10,
+198,254,246,98,159,135,108,213,1,108,33,56,1,68,9,188,194,191,149,196,140,
+140,251,29,3,141,44,77,94,217,1,174,2,0,0,2,255,221,254,211,5,250,5,111,0,
+41,0,53,0,0,1,54,51,50,22,21,20,6,6,35,34,38,38,53,53,6,3,39,54,0,55,17,39,
+14,2,7,39,17,35,53,33,21,33,17,23,62,3,55,23,19,50,54,53,52,38,35,34,7,21,
+20,22,4,0,61,41,141,152,104,147,78,80,95,43,241,101,139,64,1,0,161,6,123,
+158,167,76,164,213,6,29,251,86,8,56,96,88,98,170,172,68,69,103,74,68,52,46,
+23,1,129,14,121,114,74,163,95,59,102,101,92,188,254,213,51,192,1,54,88,1,
+231,2,81,140,192,123,67,3,123,140,140,253,82,2,61,98,80,80,122,68,252,63,
+116,71,52,58,14,168,57,58,0,0,2,255,229,0,0,6,20,5,111,0,21,0,38,0,0,3,33,
+21,35,17,35,17,5,7,22,22,21,20,6,35,34,38,38,53,16,19,33,33,6,2,21,20,22,
+22,51,50,54,53,52,38,39,55,37,17,27,6,47,180,155,254,161,2,47,52,227,191,
+136,219,108,252,254,147,2,47,157,135,81,142,96,112,138,93,102,9,2,86,5,111,
+140,251,29,3,10,39,6,31,114,66,165,191,133,229,150,1,34,1,27,157,254,237,
+141,124,167,86,122,101,90,96,3,141,68,1,73,0,2,255,221,0,63,7,139,5,111,0,
+32,0,44,0,0,1,22,21,20,2,4,7,17,39,6,2,7,39,17,35,53,33,21,33,17,23,62,2,
+55,23,17,23,54,54,53,52,39,19,54,18,53,52,39,55,22,21,20,2,7,5,76,137,173,
+254,211,185,7,114,249,122,164,213,7,174,249,197,8,93,120,152,104,172,6,160,
+188,86,64,163,177,92,110,129,220,200,4,37,133,215,151,254,245,160,6,2,248,
+2,94,254,187,214,61,3,164,140,140,253,60,2,140,145,149,90,68,253,68,4,42,
+231,155,145,95,252,243,84,1,11,155,161,138,84,168,221,194,254,186,97,0,0,
+1,255,221,255,244,4,117,5,111,0,50,0,0,3,33,21,33,22,21,20,6,7,6,6,21,20,
+22,51,50,54,53,52,39,55,22,21,20,6,35,34,38,38,53,52,54,54,55,36,53,52,38,
+35,34,6,21,20,23,7,38,53,52,54,55,33,35,4,152,254,192,99,156,172,165,128,
+122,109,105,129,8,159,9,209,185,118,177,96,74,145,156,1,0,115,96,101,130,
+18,149,27,55,56,254,196,5,111,140,89,148,123,193,77,72,121,90,101,112,115,
+94,46,32,22,52,58,157,179,90,161,103,82,133,111,73,119,166,94,113,118,99,
+48,55,45,66,78,65,126,48,0,1,255,221,255,246,4,74,5,111,0,28,0,0,55,17,35,
+53,33,21,33,17,23,62,2,53,52,38,35,34,6,7,39,54,51,50,22,21,20,2,4,7,139,
+174,4,109,252,221,6,138,239,135,78,78,27,63,18,62,80,90,140,172,228,254,137,
+210,6,4,221,140,140,251,183,4,17,156,218,104,90,101,21,12,137,39,180,152,
+161,254,203,184,3,0,0,1,255,242,255,240,6,53,5,111,0,41,0,0,1,54,37,22,22,
+21,20,2,4,35,34,36,2,53,52,54,54,55,23,14,2,21,20,4,51,50,36,53,52,39,6,6,
+7,39,17,33,53,33,21,33,17,3,106,182,1,50,45,51,166,254,209,190,200,254,191,
+176,46,72,77,127,64,58,32,1,34,243,225,1,21,39,142,191,73,151,253,45,6,67,
+253,45,2,225,205,27,86,204,97,172,254,239,153,149,1,15,174,86,145,123,86,
+103,66,96,113,67,199,235,247,206,110,111,34,164,150,65,2,209,140,140,254,
+0,0,1,255,221,0,0,4,137,5,111,0,36,0,0,55,17,35,53,33,21,33,17,23,62,2,53,
+52,35,34,6,21,20,22,22,23,7,38,38,53,52,54,54,51,50,22,21,20,2,4,7,150,185,
+4,172,252,168,6,145,254,150,160,54,62,17,30,45,53,88,105,75,129,75,140,171,
+226,254,126,232,25,4,202,140,140,251,193,4,7,132,209,110,195,55,45,26,34,
+24,13,141,18,122,92,74,111,60,181,150,163,254,221,164,3,0,0,1,255,221,255,
+225,4,158,5,111,0,30,0,0,19,22,51,50,55,17,33,53,33,21,35,17,35,17,6,6,35,
+34,39,7,22,21,20,7,39,54,54,53,52,38,39,160,169,173,207,180,252,100,4,193,
+140,153,88,185,114,96,84,5,80,211,116,94,84,77,93,3,80,90,123,1,114,140,140,
+251,29,2,193,50,41,35,6,100,146,228,200,107,86,154,81,92,152,80,0,1,255,221,
+0,0,7,117,5,111,0,37,0,0,1,23,54,18,55,33,53,33,21,35,17,35,17,39,6,0,7,39,
+17,7,6,6,35,34,38,39,55,22,22,51,50,54,55,54,55,54,55,23,3,233,9,138,215,
+124,250,14,7,152,174,154,6,169,254,238,118,166,131,183,163,92,71,105,40,136,
+20,41,29,33,60,50,79,145,131,71,143,2,166,2,207,1,1,111,140,140,251,29,4,
+119,2,160,254,121,217,65,1,144,177,250,124,70,73,94,40,35,41,61,92,189,171,
+76,61,0,0,1,255,221,254,176,5,127,5,111,0,32,0,0,1,17,20,22,51,50,55,23,6,
+6,35,34,38,53,17,39,6,2,7,39,17,35,53,33,21,33,17,23,62,3,55,4,0,46,48,60,
+69,76,47,93,61,119,131,6,158,250,116,164,213,5,162,251,209,8,56,96,88,98,
+170,3,168,252,49,80,63,45,133,35,31,143,148,3,104,4,107,254,255,174,67,3,
+123,140,140,253,82,2,61,98,80,80,122,0,0,2,255,221,0,0,6,121,5,111,0,18,0,
+31,0,0,1,17,6,35,32,3,35,53,33,21,35,17,35,17,39,14,2,7,3,17,23,54,18,55,
+33,22,22,51,50,54,55,2,82,70,78,254,162,18,113,6,156,174,156,6,157,162,154,
+76,20,8,108,239,222,251,180,7,115,114,85,123,60,1,178,1,148,33,1,190,140,
+140,251,29,4,35,2,137,180,229,136,2,131,254,133,2,160,1,6,188,156,149,42,
+42,0,2,255,221,0,0,5,25,5,111,0,26,0,37,0,0,33,17,39,35,34,4,7,22,22,21,20,
+6,35,34,38,38,53,52,18,54,55,33,53,33,21,35,17,1,20,22,51,50,54,53,52,38,
+39,6,3,186,10,10,127,254,203,109,166,160,171,136,87,147,84,142,246,149,253,
+106,5,60,197,252,166,93,67,62,83,119,117,69,4,188,2,191,151,69,195,137,128,
+173,86,155,99,140,1,29,241,75,140,140,251,29,1,246,80,109,84,64,91,145,48,
+124,0,2,255,221,0,0,6,39,5,111,0,13,0,19,0,0,1,4,0,3,39,17,35,53,33,21,35,
+17,35,17,37,17,23,54,0,37,4,215,254,254,254,21,189,162,174,6,74,174,156,252,
+74,8,156,1,230,1,48,4,37,164,254,24,254,224,65,4,41,140,140,251,29,4,35,192,
+252,176,2,218,1,181,195,0,0,3,255,221,0,0,7,92,5,111,0,29,0,35,0,44,0,0,37,
+38,39,17,35,17,39,4,0,3,39,17,35,53,33,21,33,17,54,51,50,22,21,20,6,7,7,22,
+22,23,1,17,23,54,0,37,1,34,7,21,54,54,53,52,38,7,6,232,165,156,6,254,216,
+254,38,168,162,174,7,127,254,29,83,91,120,132,170,191,2,50,203,104,250,10,
+8,156,1,230,1,48,1,62,79,87,131,149,62,131,20,191,254,170,4,35,2,185,254,
+37,254,240,66,4,32,140,140,254,152,24,119,110,113,123,6,6,58,93,11,3,207,
+252,176,2,218,1,181,195,254,52,31,207,3,71,59,53,52,0,0,2,255,221,0,0,4,225,
+5,111,0,18,0,29,0,0,33,17,6,35,34,38,53,52,54,51,50,23,17,33,53,33,21,35,
+17,1,32,17,20,22,51,50,55,17,38,38,3,129,151,177,213,235,237,217,173,149,
+252,92,5,4,196,254,51,254,209,139,145,182,142,84,145,1,104,110,211,198,192,
+212,92,1,24,140,140,251,29,3,147,255,0,130,128,131,1,25,58,44,0,2,255,221,
+0,0,5,203,5,111,0,34,0,45,0,0,19,55,50,23,54,54,55,33,53,33,21,35,17,35,17,
+39,35,34,4,7,4,17,20,6,35,34,38,38,53,52,55,38,35,35,7,1,20,22,51,50,54,53,
+52,38,39,6,72,114,127,105,77,202,108,252,184,5,238,197,156,10,10,131,254,
+195,101,1,76,171,136,87,147,84,68,71,97,41,37,1,82,92,68,62,83,125,112,68,
+3,170,4,20,105,169,55,140,140,251,29,4,188,2,194,143,138,254,244,128,173,
+86,155,99,138,140,11,2,254,217,79,110,84,64,93,146,45,130,0,3,255,221,0,0,
+5,92,5,111,0,24,0,29,0,40,0,0,33,17,4,7,22,22,21,20,6,35,34,38,38,53,52,54,
+55,38,39,35,53,33,21,35,17,1,54,37,33,22,19,52,39,6,6,21,20,22,51,50,54,4,
+18,254,214,142,55,52,168,123,86,123,66,116,144,125,212,101,5,127,174,253,
+94,193,1,31,253,40,159,126,82,97,87,69,60,58,79,4,84,174,96,94,168,93,116,
+156,70,127,79,94,176,111,176,207,140,140,251,29,3,188,129,166,173,253,188,
+103,151,76,126,63,58,77,78,0,0,1,255,221,0,0,5,72,5,111,0,26,0,0,19,22,51,
+50,54,54,55,18,55,33,53,33,21,35,17,35,17,35,6,6,7,6,6,35,34,38,39,229,45,
+64,37,59,82,79,208,131,252,55,5,107,174,156,2,61,128,116,157,147,85,69,94,
+50,2,160,60,41,98,101,1,16,127,140,140,251,29,4,119,62,159,156,211,111,53,
+60,0,2,255,221,255,113,5,72,5,111,0,25,0,39,0,0,19,22,51,50,54,55,54,18,55,
+33,53,33,21,35,17,35,17,6,6,7,6,6,35,34,38,39,1,38,38,53,52,54,55,23,14,2,
+21,20,23,203,52,60,33,58,59,108,227,128,252,61,5,107,174,156,117,206,109,
+94,123,72,59,102,48,2,127,86,98,130,144,76,86,78,43,131,2,184,61,40,73,131,
+1,2,114,140,140,251,29,4,117,105,239,135,115,74,51,66,253,35,52,181,105,114,
+207,100,104,61,87,101,60,151,81,0,0,1,255,221,254,139,4,254,5,111,0,26,0,
+0,1,54,36,55,22,21,20,0,7,39,54,54,18,53,52,39,6,4,7,39,17,35,53,33,21,33,
+17,1,88,105,1,90,198,88,254,250,231,107,173,184,90,35,150,254,214,115,152,
+213,5,33,252,82,2,51,151,192,18,185,211,255,254,36,170,125,141,236,1,3,155,
+93,124,27,244,196,65,3,125,140,140,253,82,0,0,1,255,221,255,193,6,39,5,111,
+0,40,0,0,5,38,36,39,53,62,2,53,52,38,35,34,7,39,54,54,51,50,22,23,54,37,33,
+53,33,21,35,17,35,17,39,4,7,6,6,7,7,22,22,23,2,143,69,254,251,192,137,231,
+111,94,76,144,134,94,78,202,96,117,175,22,164,1,69,250,252,6,74,174,156,6,
+254,236,242,51,190,120,2,129,247,73,63,181,239,44,152,11,73,103,65,93,112,
+121,125,66,71,154,125,140,239,140,140,251,29,4,35,2,190,224,79,103,8,8,35,
+238,166,0,0,3,255,221,255,88,6,100,5,111,0,13,0,19,0,33,0,0,1,4,0,7,39,17,
+35,53,33,21,35,17,35,17,37,17,23,54,0,1,3,14,2,21,20,22,23,7,38,38,53,52,
+37,5,20,254,145,254,28,148,162,174,6,135,174,155,252,12,8,139,1,210,1,147,
+144,105,70,40,112,99,49,158,149,1,33,4,37,233,254,52,239,66,4,32,140,140,
+251,29,4,35,192,252,176,2,193,1,141,1,4,253,90,89,91,109,73,86,128,26,139,
+55,193,129,249,210,0,1,255,221,0,0,2,84,5,111,0,7,0,0,51,17,33,53,33,21,35,
+17,248,254,229,2,119,193,4,227,140,140,251,29,0,1,254,131,0,0,2,41,7,170,
+0,22,0,0,51,17,35,53,51,17,52,35,34,6,7,39,54,54,51,50,22,21,17,51,21,35,
+17,205,240,240,113,86,153,84,150,99,232,150,123,137,193,193,4,227,140,1,10,
+162,152,176,68,209,194,158,147,254,246,140,251,29,0,1,252,225,253,215,0,12,
+0,14,0,20,0,0,1,22,51,50,54,53,52,35,34,7,39,54,51,50,22,21,20,4,33,34,39,
+253,8,125,127,193,180,121,51,49,41,71,76,121,141,254,255,254,249,148,143,
+254,125,27,76,88,119,14,139,20,139,125,155,148,29,0,0,1,252,199,5,78,255,
+115,7,154,0,7,0,0,1,22,0,23,7,38,36,39,252,246,212,1,76,93,131,95,254,224,
+170,7,154,67,254,221,206,24,175,237,49,0,0,1,254,246,0,0,2,41,7,123,0,14,
+0,0,19,2,37,55,22,0,23,51,21,35,17,35,17,35,53,186,165,254,225,59,185,1,19,
+81,219,193,155,240,5,111,1,21,116,131,79,254,242,175,140,251,29,4,227,140,
+0,2,0,164,2,29,2,125,3,211,0,11,0,23,0,0,19,52,54,51,50,22,21,20,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,164,135,98,100,140,140,100,97,136,133,
+59,39,43,54,55,42,41,57,2,248,92,127,126,93,93,126,126,91,36,58,58,36,40,
+54,57,0,0,4,0,100,0,147,2,63,4,121,0,11,0,23,0,35,0,47,0,0,19,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,
+20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,100,138,98,100,139,138,101,
+100,136,136,60,38,42,54,54,42,41,57,136,137,99,100,139,142,97,97,139,136,
+60,38,42,54,54,42,39,59,1,111,92,127,127,92,92,128,129,89,38,57,57,38,40,
+54,56,2,9,92,129,128,93,93,126,128,89,39,54,55,38,42,54,55,0,6,0,100,0,209,
+4,152,4,121,0,11,0,23,0,35,0,47,0,59,0,71,0,0,19,52,54,51,50,22,21,20,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,1,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,100,137,99,100,139,142,97,97,139,136,60,38,42,
+54,54,42,39,59,1,208,137,99,101,139,142,98,97,139,136,60,38,42,54,54,42,39,
+59,254,71,137,97,99,140,139,100,99,135,135,60,37,41,55,54,42,39,58,3,156,
+92,129,128,93,93,126,128,89,39,54,55,38,42,54,55,39,92,129,128,93,93,126,
+128,89,39,54,55,38,42,54,55,253,233,95,124,123,96,95,124,126,91,36,56,56,
+36,40,56,59,0,8,0,143,0,172,4,170,4,135,0,11,0,23,0,35,0,47,0,59,0,71,0,83,
+0,95,0,0,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,
+1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,143,135,99,
+100,139,142,97,97,137,133,61,38,42,54,54,42,40,59,1,187,136,99,100,140,142,
+98,95,140,135,59,39,43,54,55,42,41,57,253,57,137,97,98,141,140,99,99,135,
+133,62,37,41,55,54,42,40,59,1,187,139,96,99,141,140,100,98,137,135,59,39,
+41,56,55,42,41,57,3,172,92,127,127,92,95,126,127,92,37,57,57,37,40,54,57,
+35,93,126,126,93,95,126,125,94,37,57,58,36,40,54,56,253,183,95,124,124,95,
+93,126,126,91,36,58,58,36,40,54,57,35,96,123,124,95,93,126,125,92,37,57,56,
+38,40,54,56,0,0,4,255,221,255,53,9,178,5,111,0,25,0,31,0,40,0,44,0,0,1,17,
+35,17,39,6,7,17,35,17,4,3,39,17,6,1,39,17,35,53,33,21,33,17,54,37,1,18,55,
+17,33,17,1,6,6,7,17,23,54,37,17,37,17,54,37,8,211,156,6,246,241,154,254,233,
+225,143,216,254,245,148,213,9,213,252,152,169,1,72,249,29,241,224,254,39,
+4,90,157,225,105,8,219,1,10,254,19,210,1,31,3,240,251,69,4,4,2,134,177,253,
+49,2,86,226,254,224,70,2,168,194,254,202,68,4,32,140,140,253,215,118,192,
+253,147,1,2,184,1,166,252,162,2,170,79,144,84,253,149,2,247,200,1,223,182,
+254,209,154,149,0,0,3,255,221,253,168,7,96,5,111,0,42,0,48,0,52,0,0,1,4,5,
+17,35,17,4,7,39,17,35,53,33,21,35,17,35,17,6,6,35,34,39,7,22,21,20,6,7,39,
+54,54,53,52,38,39,55,22,22,51,50,55,17,1,54,55,17,33,17,1,17,54,37,5,231,
+254,236,254,240,154,254,234,205,148,213,7,131,215,155,87,218,111,158,86,4,
+86,82,93,117,80,60,99,87,68,81,216,110,240,201,251,106,213,252,254,39,2,115,
+250,1,53,4,47,97,165,253,227,1,185,195,244,70,3,143,140,140,249,127,1,219,
+40,48,31,6,133,127,93,151,94,109,71,103,75,88,170,72,129,46,52,110,3,72,253,
+221,196,167,1,110,253,41,2,215,254,242,151,119,0,0,4,255,221,0,0,7,229,5,
+111,0,21,0,32,0,43,0,50,0,0,33,17,36,36,39,54,54,36,51,51,53,33,53,33,21,
+35,17,35,17,36,39,17,1,34,6,6,7,22,4,51,51,17,39,33,34,6,6,7,22,4,51,51,17,
+39,23,54,36,51,51,53,33,3,133,254,235,254,118,138,132,222,1,2,154,43,252,
+88,8,8,198,156,254,137,235,1,243,99,157,132,111,96,1,44,181,33,57,252,205,
+102,172,144,82,75,1,67,179,33,56,212,124,1,22,165,43,253,158,1,68,9,193,195,
+132,135,67,196,140,140,251,29,1,68,12,178,253,254,3,141,44,74,97,102,115,
+1,174,2,49,85,81,97,120,1,174,2,18,86,78,196,0,3,255,221,254,211,8,145,5,
+111,0,47,0,56,0,68,0,0,1,54,51,50,22,21,20,6,6,35,34,38,38,53,53,6,6,7,39,
+54,18,55,17,39,6,0,7,39,53,36,36,39,54,36,33,53,33,53,33,21,33,17,23,62,2,
+55,23,5,22,4,51,17,39,35,34,6,1,50,54,53,52,38,35,34,7,21,20,22,6,150,61,
+43,139,152,103,149,78,81,94,42,118,176,48,139,63,253,165,6,140,254,244,106,
+172,254,227,254,143,116,160,1,95,1,3,252,147,8,180,251,84,9,86,147,149,125,
+173,250,120,87,1,9,220,37,35,151,241,5,95,69,103,75,64,54,46,23,1,129,14,
+119,116,71,165,96,59,104,99,92,90,254,143,51,188,1,54,92,1,231,2,92,254,229,
+165,51,152,10,177,167,160,127,118,140,140,253,62,2,97,147,128,89,68,117,91,
+85,1,92,2,80,252,86,116,71,52,58,14,168,57,58,0,3,255,229,255,53,6,63,5,111,
+0,25,0,49,0,65,0,0,3,33,21,35,17,35,17,5,7,22,21,20,6,35,34,38,38,53,52,55,
+38,38,53,52,55,33,1,34,39,6,21,20,22,51,50,54,53,52,38,38,39,55,37,17,5,7,
+22,21,20,6,1,6,21,20,22,51,50,54,53,52,38,38,39,55,37,53,27,6,90,194,156,
+254,162,2,98,227,190,137,208,112,141,69,72,168,254,196,2,93,108,87,100,156,
+143,123,135,42,75,80,8,2,86,254,162,2,98,226,254,245,219,155,144,124,134,
+42,73,82,8,2,86,5,111,140,250,82,2,6,39,6,52,128,136,155,108,197,123,185,
+151,59,168,99,205,157,252,234,33,109,156,139,153,86,79,54,64,30,2,135,64,
+2,16,39,6,57,123,136,157,3,22,131,229,138,155,88,80,53,63,29,2,136,63,139,
+0,1,255,221,255,53,4,240,5,111,0,52,0,0,1,22,51,50,55,17,6,35,34,39,7,22,
+21,20,7,39,54,53,52,38,39,55,22,22,51,50,54,55,53,33,53,33,21,35,17,35,17,
+6,35,34,39,7,22,22,21,20,7,39,54,54,53,52,39,1,174,134,138,129,119,163,199,
+128,155,4,55,141,131,125,67,66,84,91,207,99,112,182,99,252,39,5,19,160,154,
+111,112,84,82,6,41,33,148,127,59,64,127,2,0,61,47,1,114,77,61,6,97,118,156,
+158,99,134,118,91,129,48,123,53,64,44,48,217,140,140,250,82,2,31,35,31,6,
+56,98,55,157,167,105,65,120,63,136,93,0,2,255,221,254,188,5,4,5,111,0,46,
+0,57,0,0,1,22,51,50,55,17,38,35,34,6,7,22,22,21,20,6,35,34,38,38,53,52,54,
+55,33,53,33,21,35,17,35,17,6,35,34,39,7,22,22,21,20,7,39,54,53,52,39,19,6,
+21,20,22,51,50,54,53,52,38,1,72,130,154,164,178,85,119,128,183,72,158,151,
+165,134,89,146,81,135,128,254,153,5,39,176,154,152,147,99,99,4,40,33,147,
+129,125,127,39,70,86,76,61,74,115,1,127,66,91,3,71,13,73,79,75,182,120,124,
+156,81,147,97,128,244,103,140,140,250,82,1,197,70,31,6,54,99,56,151,169,101,
+135,113,139,90,2,225,104,109,89,103,79,68,85,126,0,0,2,255,221,254,176,8,
+129,5,111,0,50,0,61,0,0,1,17,20,22,51,50,55,23,6,6,35,34,38,53,17,39,6,2,
+7,39,17,39,35,34,6,7,22,22,21,20,6,35,34,38,38,53,52,18,54,55,33,53,33,21,
+33,17,23,54,54,55,55,1,20,22,51,50,54,53,52,38,39,6,6,238,47,49,55,74,76,
+48,93,60,119,131,6,157,254,115,164,17,16,120,252,115,163,162,170,137,87,148,
+82,126,225,132,253,141,8,164,251,188,9,105,194,118,93,250,200,94,66,62,83,
+121,118,66,3,168,252,49,78,65,45,133,35,31,143,148,3,104,4,106,254,252,172,
+67,3,84,2,162,159,67,197,137,129,173,89,155,98,125,1,21,244,73,140,140,253,
+82,2,117,175,83,66,254,32,81,109,84,63,90,147,50,120,0,0,3,255,223,254,109,
+5,129,5,111,0,43,0,54,0,65,0,0,5,17,35,32,7,22,22,21,20,6,35,34,38,53,52,
+54,54,36,51,51,17,38,35,34,6,7,22,22,21,20,6,35,34,38,38,53,16,37,33,53,33,
+21,35,17,1,6,21,20,22,51,50,54,53,52,38,1,6,21,20,22,51,50,54,53,52,38,4,
+53,35,254,187,187,158,139,165,130,133,170,131,228,1,52,171,10,106,144,157,
+249,61,150,152,163,132,85,140,79,1,23,254,137,5,162,176,252,240,62,75,70,
+57,66,100,254,240,62,77,69,56,66,98,203,2,125,209,73,169,116,119,151,174,
+143,119,243,190,103,2,166,13,80,72,70,177,120,119,153,78,144,95,1,3,206,140,
+140,250,82,1,60,102,93,79,95,72,61,78,113,3,149,101,93,81,94,74,62,75,113,
+0,3,255,221,255,12,4,63,5,111,0,30,0,44,0,54,0,0,5,53,6,35,34,38,53,52,54,
+51,50,23,53,6,35,34,38,53,52,54,54,51,50,23,53,33,53,33,21,35,17,1,34,6,6,
+21,20,22,22,51,50,54,55,53,38,19,38,35,34,6,21,20,51,50,55,2,246,134,163,
+173,204,201,182,146,145,127,180,187,205,99,179,116,150,155,252,231,4,98,176,
+254,93,104,105,60,56,98,96,85,138,62,126,126,146,137,112,121,241,136,139,
+244,125,78,175,155,144,163,69,221,78,172,156,105,146,74,73,157,140,140,250,
+41,4,244,36,78,68,68,79,36,47,54,194,70,252,225,82,89,85,190,96,0,0,4,255,
+221,255,12,5,242,5,111,0,37,0,47,0,58,0,62,0,0,5,53,6,6,35,34,38,53,52,54,
+51,50,22,23,17,35,4,7,22,22,21,20,6,35,34,38,53,52,54,55,38,39,35,53,33,21,
+35,17,3,38,35,34,6,21,20,51,50,55,1,52,38,39,6,21,20,22,51,50,54,3,54,55,
+33,4,168,60,128,84,167,196,197,170,74,126,68,229,254,237,123,101,86,159,128,
+124,157,91,100,159,148,103,6,21,174,156,134,128,106,115,229,140,114,253,184,
+68,75,133,72,61,63,80,131,77,175,254,62,244,109,35,35,174,152,145,160,39,
+31,3,127,173,97,101,156,95,113,143,147,113,95,167,88,144,124,140,140,250,
+41,1,207,76,92,82,191,88,2,113,57,118,77,131,117,67,80,78,1,233,61,123,0,
+5,255,246,255,53,6,94,5,111,0,34,0,44,0,55,0,66,0,70,0,0,5,17,6,7,22,22,21,
+20,6,35,34,38,53,52,54,55,39,6,6,35,34,38,53,52,54,55,38,38,39,35,53,33,21,
+35,17,1,6,7,22,22,23,23,54,37,17,1,52,38,39,6,21,20,22,51,50,54,1,52,38,39,
+6,21,20,22,51,50,54,1,54,55,33,5,18,212,128,109,84,155,130,125,155,89,93,
+94,34,125,87,124,157,91,100,60,141,96,51,6,104,176,253,238,241,155,101,82,
+2,153,119,1,57,253,41,69,74,135,74,61,60,83,1,183,68,80,131,73,62,65,79,253,
+196,93,161,254,62,203,3,86,136,99,101,147,98,112,144,148,112,96,161,85,76,
+56,63,147,113,95,167,88,54,133,81,140,140,250,82,5,174,148,122,103,150,95,
+133,92,213,1,190,253,160,59,118,75,129,119,67,80,77,254,19,61,114,73,127,
+117,63,82,79,4,21,73,111,0,0,2,255,221,254,121,5,92,5,111,0,46,0,60,0,0,19,
+22,51,50,54,54,55,0,37,53,39,6,6,7,14,2,35,34,38,39,55,22,51,50,54,55,54,
+55,33,53,33,21,35,17,35,17,6,6,7,14,2,35,34,38,39,1,38,38,53,52,54,54,55,
+23,6,6,21,20,23,223,52,61,25,53,65,21,1,28,1,2,6,159,203,94,95,80,79,47,59,
+102,48,110,52,59,32,59,73,211,233,252,90,5,127,174,156,119,186,112,89,83,
+84,47,59,102,48,2,127,85,100,62,108,105,76,117,90,131,1,131,61,30,62,22,1,
+40,202,236,6,123,184,97,95,58,29,50,65,108,61,34,70,204,187,140,140,250,82,
+3,191,95,180,125,96,64,32,50,65,253,98,49,180,109,81,142,124,75,105,83,144,
+82,150,81,0,3,255,242,255,193,10,156,5,111,0,50,0,56,0,60,0,0,1,4,5,17,35,
+17,6,3,39,17,6,7,6,6,7,7,22,22,23,7,38,36,39,53,62,2,53,52,38,35,34,7,39,
+54,54,51,50,22,23,54,55,53,33,53,33,21,35,17,35,17,1,54,37,17,33,17,1,17,
+54,37,9,98,254,225,254,248,153,252,252,147,159,169,52,189,118,2,129,247,73,
+152,69,254,251,192,137,231,111,94,76,144,134,94,78,202,96,115,174,23,120,
+169,251,219,10,170,154,154,251,84,216,1,14,254,18,2,135,252,1,54,4,47,127,
+194,253,18,2,115,206,254,218,68,2,215,120,155,80,102,8,8,35,238,166,73,181,
+239,44,152,11,73,103,65,93,112,121,125,66,71,152,127,103,125,151,140,140,
+251,29,4,45,253,86,232,206,1,170,252,162,3,94,254,195,169,148,0,0,2,255,221,
+255,193,6,225,5,111,0,48,0,59,0,0,5,38,36,39,53,62,2,53,52,38,35,34,7,39,
+54,54,51,50,22,23,54,1,33,53,33,21,35,17,35,53,38,36,39,54,36,51,17,39,6,
+4,7,6,6,7,7,22,22,23,1,51,55,17,38,35,34,6,7,22,22,2,143,69,254,251,192,137,
+231,111,94,76,144,134,94,78,202,96,121,177,18,192,1,226,250,65,7,4,174,155,
+252,254,187,110,142,1,47,242,7,220,254,132,114,50,188,113,2,129,247,73,2,
+41,35,37,33,64,121,198,74,66,199,63,181,239,44,152,11,73,103,65,93,112,121,
+125,66,71,165,132,134,1,7,140,140,251,29,147,10,156,158,149,119,1,64,2,106,
+230,92,72,96,8,8,35,238,166,1,29,2,1,39,4,62,81,81,77,0,2,255,240,254,211,
+9,96,5,111,0,73,0,85,0,0,1,14,2,7,39,17,6,7,6,6,7,7,22,22,23,7,38,36,39,53,
+62,2,53,52,38,35,34,7,39,54,54,51,50,22,23,54,55,53,33,53,33,21,33,17,23,
+54,54,55,23,17,54,51,50,22,21,20,6,6,35,34,38,38,53,53,6,6,7,39,54,18,55,
+17,19,50,54,53,52,38,35,34,7,21,20,22,6,199,127,155,166,77,163,159,169,52,
+189,118,2,129,247,73,152,69,254,251,192,137,231,111,94,76,144,134,94,78,202,
+96,115,174,23,120,169,251,217,9,112,251,84,8,113,204,191,172,61,44,139,152,
+103,149,78,81,94,42,118,176,48,139,63,253,165,219,69,103,75,64,55,46,24,3,
+61,84,138,190,124,67,2,50,120,155,80,102,8,8,35,238,166,73,181,239,44,152,
+11,73,103,65,93,112,121,125,66,71,152,127,103,125,151,140,140,253,82,2,124,
+182,135,68,253,217,14,119,116,71,165,96,59,104,99,92,90,254,143,51,188,1,
+54,92,1,231,252,172,116,71,52,58,14,168,57,58,0,1,255,221,255,135,6,225,5,
+111,0,62,0,0,1,22,51,50,55,17,39,6,4,7,6,6,7,7,22,22,23,7,2,37,53,62,2,53,
+52,38,35,34,7,39,54,54,51,50,22,23,54,1,33,53,33,21,35,17,35,17,6,35,34,39,
+7,22,21,20,6,7,39,54,54,53,52,39,3,180,130,155,97,102,7,220,254,132,114,50,
+188,113,2,122,229,77,151,150,254,160,137,231,111,94,76,144,134,94,78,202,
+96,121,177,18,192,1,226,250,65,7,4,174,155,72,84,97,102,4,74,81,71,129,60,
+69,127,2,98,65,41,1,217,2,106,230,92,72,96,8,8,34,230,175,73,1,128,80,152,
+11,73,103,65,93,112,121,125,66,71,165,132,134,1,7,140,140,251,29,1,176,24,
+30,6,100,109,77,185,82,101,65,145,62,140,89,0,2,255,221,255,193,6,225,5,111,
+0,55,0,64,0,0,5,38,36,39,53,62,2,53,52,38,35,34,7,39,54,54,51,50,22,23,54,
+1,33,53,33,21,35,17,35,53,6,6,35,34,38,38,53,52,54,51,50,22,23,17,39,6,4,
+7,6,6,7,7,22,22,23,1,38,35,34,21,20,51,50,55,2,143,69,254,251,192,137,231,
+111,94,76,144,134,94,78,202,96,121,177,18,192,1,226,250,65,7,4,174,155,57,
+120,81,112,170,95,195,173,73,127,67,7,220,254,132,114,50,188,113,2,129,247,
+73,2,113,119,131,228,226,142,110,63,181,239,44,152,11,73,103,65,93,112,121,
+125,66,71,165,132,134,1,7,140,140,251,29,152,36,44,76,147,106,144,164,39,
+31,1,164,2,106,230,92,72,96,8,8,35,238,166,1,240,72,177,192,86,0,0,8,0,63,
+0,121,4,197,5,41,0,56,0,68,0,79,0,90,0,102,0,115,0,124,0,137,0,0,1,20,7,62,
+2,51,50,22,21,20,6,7,22,23,22,21,20,6,35,34,38,39,22,21,20,6,35,34,53,52,
+55,14,2,35,34,38,53,52,54,54,55,38,38,53,52,54,51,50,23,38,53,52,51,50,22,
+1,20,22,51,50,54,53,52,38,35,34,6,37,22,23,54,54,53,52,38,35,34,6,37,51,23,
+54,53,52,35,34,21,20,23,7,54,55,38,38,35,34,6,21,20,22,22,19,38,39,6,7,6,
+21,21,20,22,51,50,54,23,6,21,20,51,50,53,52,39,55,6,7,22,22,51,50,54,53,52,
+38,39,38,3,47,22,34,72,103,49,58,108,160,105,96,39,134,95,65,50,148,70,22,
+87,87,172,23,73,63,102,31,61,99,63,109,97,105,159,107,61,108,148,23,172,88,
+86,254,217,69,48,52,73,73,52,48,69,1,64,20,12,94,126,23,14,36,125,254,255,
+15,12,24,47,45,20,200,9,13,56,115,36,15,23,31,83,127,18,8,137,27,58,22,17,
+21,135,231,16,45,47,18,209,11,16,67,116,26,12,25,33,23,46,4,102,69,86,38,
+61,54,119,65,77,115,25,14,17,49,104,76,121,68,61,90,68,99,93,194,76,78,52,
+37,38,118,77,53,72,47,14,24,118,75,67,117,153,81,72,197,95,253,249,52,69,
+69,52,52,68,66,101,20,25,39,69,31,17,20,85,40,2,105,75,80,82,61,117,123,18,
+13,56,83,20,17,18,29,43,254,211,25,24,34,9,26,29,7,12,22,58,64,85,69,79,77,
+54,102,143,21,18,45,53,21,20,19,25,11,14,0,0,1,1,142,0,0,2,51,4,250,0,3,0,
+0,33,17,51,17,1,142,165,4,250,251,6,0,0,2,1,142,0,0,3,245,4,250,0,3,0,7,0,
+0,33,17,51,17,33,17,51,17,3,80,165,253,153,165,4,250,251,6,4,250,251,6,0,
+2,0,147,0,186,4,41,4,90,0,12,0,24,0,0,19,52,54,54,51,50,22,21,20,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,147,114,211,142,218,233,251,220,210,
+237,165,144,135,144,165,144,132,145,167,2,144,128,214,116,248,222,205,253,
+243,208,144,161,179,152,145,160,177,0,1,0,249,0,0,3,246,5,13,0,41,0,0,1,23,
+6,6,21,20,22,51,50,54,53,52,38,39,46,2,53,52,54,55,23,6,6,21,20,22,22,23,
+30,2,21,20,6,6,35,34,38,53,52,54,1,223,59,62,56,88,77,121,144,103,160,140,
+141,57,58,50,131,29,38,34,116,128,139,125,51,111,196,120,159,176,113,1,242,
+156,15,44,38,43,49,121,96,88,134,112,99,119,102,60,49,112,48,73,30,59,33,
+38,60,92,86,93,131,139,94,108,167,90,136,114,91,124,0,1,0,134,255,203,4,109,
+5,13,0,34,0,0,1,22,22,23,7,38,36,37,55,22,22,51,50,54,53,52,38,39,38,38,53,
+52,55,23,6,21,20,22,22,23,22,22,21,20,6,2,136,123,243,119,94,196,254,140,
+254,175,29,87,146,85,189,189,112,164,169,153,87,130,45,36,88,103,191,174,
+200,1,98,50,148,98,111,162,195,75,146,27,20,102,103,80,82,32,34,106,86,85,
+105,73,46,50,32,33,27,20,36,150,143,125,180,0,0,1,0,59,0,79,4,109,4,162,0,
+34,0,0,19,55,18,18,22,51,50,54,53,52,38,38,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,18,21,20,2,35,34,38,38,2,59,152,52,124,176,138,133,135,68,120,70,
+54,60,39,162,51,152,115,131,200,112,217,205,133,192,153,126,3,236,41,254,
+246,254,155,188,187,184,120,201,116,54,49,64,76,44,106,96,108,121,145,254,
+243,167,251,254,237,94,206,1,103,0,0,3,0,128,0,0,4,61,4,250,0,24,0,36,0,48,
+0,0,1,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,54,51,50,22,21,20,
+6,37,54,54,53,52,38,35,34,6,21,20,22,23,6,6,21,20,22,51,50,54,53,52,38,3,
+37,152,128,239,239,225,254,137,140,140,114,104,202,137,228,241,123,254,180,
+130,160,159,143,120,160,140,150,163,150,165,148,154,162,171,2,166,60,151,
+111,178,178,192,164,102,152,57,67,131,100,81,142,86,166,133,100,142,11,33,
+119,69,76,87,90,74,78,104,184,43,121,88,90,110,106,103,82,130,0,2,0,100,0,
+0,4,136,5,8,0,27,0,47,0,0,1,6,21,20,22,51,51,50,55,23,6,6,21,20,22,51,50,
+55,23,6,4,35,34,0,53,52,0,37,7,6,2,21,20,22,51,50,54,55,38,38,53,52,54,55,
+38,38,53,52,3,160,40,95,78,15,8,7,69,195,162,104,101,52,22,67,102,254,251,
+144,246,254,216,1,102,1,134,95,242,245,211,179,74,115,87,138,147,126,139,
+74,87,4,154,54,62,58,72,1,114,106,168,93,75,82,4,171,62,66,1,17,235,220,1,
+120,184,213,126,254,215,164,165,177,13,24,18,139,115,103,179,96,21,112,72,
+27,0,1,0,43,0,79,4,121,4,191,0,42,0,0,1,20,22,51,50,54,55,55,22,22,21,20,
+6,35,34,38,2,3,55,18,18,51,50,54,53,52,39,6,6,35,34,38,38,53,53,52,38,38,
+39,55,22,22,21,2,126,45,30,63,91,41,113,58,66,227,208,175,248,181,63,153,
+80,233,191,138,152,29,51,132,81,72,101,43,26,59,56,18,141,139,3,25,80,41,
+114,111,28,79,207,91,218,251,192,1,123,1,20,46,254,135,254,151,167,153,81,
+79,94,94,69,116,109,103,62,50,21,2,157,4,101,146,0,2,0,144,0,0,4,58,4,250,
+0,22,0,36,0,0,1,6,35,34,38,53,52,54,54,51,50,22,22,21,17,20,22,22,23,7,38,
+38,53,3,53,52,38,38,35,34,6,6,21,20,22,51,50,3,16,118,117,196,209,127,220,
+117,118,147,68,26,59,56,18,142,138,1,24,75,76,73,141,85,120,115,133,2,32,
+37,173,161,113,200,120,84,133,126,253,129,62,50,21,2,157,4,101,145,1,203,
+190,90,84,55,81,136,79,85,88,0,0,2,0,45,0,0,4,177,4,253,0,35,0,47,0,0,1,54,
+54,51,50,23,22,22,51,50,54,55,23,6,35,34,39,22,21,20,6,6,35,34,38,38,53,17,
+52,38,38,39,55,22,22,21,17,21,20,22,51,50,54,53,52,38,35,34,1,87,51,115,42,
+54,36,68,82,44,96,91,31,148,75,221,12,12,37,111,200,122,92,128,79,26,59,56,
+18,143,137,75,69,121,145,101,90,118,2,216,19,22,7,13,11,60,59,72,187,2,70,
+93,127,200,110,66,138,132,2,137,62,50,21,2,157,4,102,145,254,62,232,122,76,
+169,119,93,96,0,0,1,0,55,0,0,4,119,5,13,0,52,0,0,37,54,54,53,52,38,38,39,
+46,2,53,52,55,23,6,21,20,30,2,23,30,2,21,20,4,33,35,39,54,54,53,52,38,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,2,82,187,194,79,175,159,179,
+208,104,98,129,56,24,67,152,146,172,225,115,254,129,254,156,29,46,100,97,
+88,80,67,70,24,155,35,158,143,142,184,41,150,25,147,117,85,108,89,46,50,87,
+107,87,104,91,73,57,39,32,40,43,55,40,47,120,168,137,217,225,139,36,101,71,
+71,83,51,48,48,42,36,80,68,101,120,155,119,68,104,0,0,0,0,0,0,15,0,186,0,
+3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,44,0,94,0,3,0,1,4,9,0,2,0,14,0,138,
+0,3,0,1,4,9,0,3,0,82,0,152,0,3,0,1,4,9,0,4,0,44,0,94,0,3,0,1,4,9,0,5,0,30,
+0,234,0,3,0,1,4,9,0,6,0,38,1,8,0,3,0,1,4,9,0,7,0,68,1,46,0,3,0,1,4,9,0,8,
+0,42,1,114,0,3,0,1,4,9,0,9,0,40,1,156,0,3,0,1,4,9,0,10,0,96,1,196,0,3,0,1,
+4,9,0,11,0,62,2,36,0,3,0,1,4,9,0,12,0,60,2,98,0,3,0,1,4,9,0,13,2,150,2,158,
+0,3,0,1,4,9,0,14,0,52,5,52,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,121,0,108,0,111,
+0,116,0,105,0,32,0,78,0,97,0,103,0,114,0,105,0,82,0,101,0,103,0,117,0,108,
+0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,
+0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,
+83,0,97,0,110,0,115,0,32,0,83,0,121,0,108,0,111,0,116,0,105,0,32,0,78,0,97,
+0,103,0,114,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,
+0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,
+83,0,121,0,108,0,111,0,116,0,105,0,78,0,97,0,103,0,114,0,105,0,78,0,111,0,
+116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,
+109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,
+101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,
+101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,
+0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,
+110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,
+0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,
+0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,
+0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,
+0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,
+0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,
+0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+181,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,0,0,0,70,0,0,0,2,0,9,0,0,0,11,0,1,0,12,0,12,0,3,0,13,0,15,
+0,1,0,16,0,16,0,3,0,17,0,20,0,1,0,21,0,21,0,3,0,22,0,46,0,1,0,47,0,48,0,3,
+0,49,0,84,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,32,0,58,0,1,68,70,76,84,
+0,8,0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,109,97,114,107,0,14,109,107,109,107,
+0,20,0,0,0,1,0,0,0,0,0,1,0,1,0,2,0,6,4,124,0,4,0,0,0,1,0,8,0,1,0,12,0,26,
+0,3,0,66,0,118,0,1,0,5,0,12,0,16,0,21,0,47,0,48,0,2,0,6,0,10,0,11,0,0,0,13,
+0,15,0,2,0,17,0,20,0,5,0,22,0,46,0,9,0,49,0,49,0,34,0,54,0,71,0,35,0,5,0,
+0,0,22,0,1,0,28,0,0,0,34,0,2,0,40,0,0,0,46,0,1,254,172,5,205,0,1,254,92,5,
+205,0,1,254,197,5,205,0,1,255,26,0,0,0,1,255,56,5,205,0,53,1,64,1,70,1,76,
+1,82,1,88,1,94,1,100,2,168,1,106,1,112,1,118,1,124,1,130,2,0,1,136,1,142,
+3,20,1,148,1,154,1,160,1,166,3,206,3,164,2,108,2,60,2,132,1,172,2,60,2,132,
+2,66,1,178,1,184,1,190,3,38,2,150,1,196,1,202,2,18,1,208,1,214,1,220,1,226,
+3,20,3,122,1,250,1,232,3,140,1,238,2,60,1,244,1,250,2,60,2,0,2,6,2,12,2,18,
+2,24,3,212,2,114,2,30,2,36,3,140,2,42,3,80,2,132,2,48,2,144,2,150,2,156,2,
+144,2,54,2,156,2,60,3,50,2,66,2,72,2,78,2,84,3,212,2,132,2,90,2,96,2,102,
+2,108,3,206,2,114,2,120,2,126,2,132,2,138,2,144,2,150,2,156,2,162,2,168,2,
+174,2,180,2,186,2,192,2,198,2,204,2,222,2,210,2,216,2,222,3,194,2,228,2,234,
+2,240,2,246,2,252,3,2,3,8,3,14,3,20,3,26,3,32,3,38,3,140,3,44,3,80,3,50,3,
+56,3,62,3,68,3,74,3,80,3,86,3,92,3,98,3,104,3,110,3,116,3,122,3,128,3,134,
+3,140,3,146,3,152,3,236,3,158,3,206,3,164,3,170,3,176,3,182,3,188,3,194,3,
+236,3,200,3,206,3,212,3,218,3,224,3,236,3,242,3,230,3,236,3,242,0,1,5,160,
+5,205,0,1,3,12,5,205,0,1,5,172,0,0,0,1,2,200,5,205,0,1,1,228,5,205,0,1,3,
+24,0,0,0,1,4,7,5,205,0,1,3,46,0,0,0,1,1,93,5,205,0,1,1,30,5,205,0,1,2,49,
+0,0,0,1,3,219,5,205,0,1,3,211,0,0,0,1,6,103,5,205,0,1,6,84,0,0,0,1,6,202,
+5,205,0,1,3,200,5,205,0,1,6,194,0,0,0,1,3,236,0,0,0,1,3,178,5,205,0,1,2,214,
+5,205,0,1,4,76,255,116,0,1,5,32,0,0,0,1,5,172,5,205,0,1,3,203,0,165,0,1,2,
+247,5,205,0,1,2,16,5,205,0,1,2,30,0,0,0,1,3,35,5,205,0,1,3,38,0,0,0,1,2,27,
+5,205,0,1,0,223,0,0,0,1,2,60,5,205,0,1,3,192,0,0,0,1,6,125,5,205,0,1,3,123,
+5,205,0,1,6,128,0,0,0,1,4,112,254,212,0,1,5,128,5,205,0,1,5,142,0,0,0,1,4,
+13,0,0,0,1,3,46,5,205,0,1,3,222,5,205,0,1,3,225,0,0,0,1,4,197,5,205,0,1,2,
+148,5,205,0,1,4,189,0,0,0,1,4,101,0,0,0,1,4,65,5,205,0,1,2,126,5,205,0,1,
+4,90,0,0,0,1,2,115,5,205,0,1,4,68,0,0,0,1,4,43,5,205,0,1,2,93,5,205,0,1,2,
+162,255,26,0,1,5,51,5,205,0,1,2,203,5,205,0,1,5,54,0,0,0,1,5,117,5,205,0,
+1,2,236,5,205,0,1,5,109,0,0,0,1,1,74,5,205,0,1,1,64,5,205,0,1,1,74,0,0,0,
+1,2,108,6,149,0,1,0,100,7,158,0,1,2,38,5,205,0,1,1,75,6,194,0,1,1,30,0,0,
+0,1,4,76,5,205,0,1,8,142,255,56,0,1,6,70,5,205,0,1,3,112,5,205,0,1,6,60,254,
+212,0,1,6,224,5,205,0,1,3,211,5,205,0,1,6,203,0,0,0,1,3,145,5,205,0,1,3,156,
+5,205,0,1,6,247,255,116,0,1,5,40,5,205,0,1,5,63,255,56,0,1,2,49,5,205,0,1,
+4,0,255,56,0,1,4,54,5,205,0,1,2,104,5,205,0,1,4,11,255,56,0,1,4,10,5,205,
+0,1,3,233,5,205,0,1,7,90,254,232,0,1,4,142,5,205,0,1,2,181,5,205,0,1,4,132,
+255,56,0,1,3,68,5,205,0,1,1,239,5,205,0,1,3,69,255,56,0,1,4,241,5,205,0,1,
+3,13,5,205,0,1,4,253,255,56,0,1,5,84,5,205,0,1,5,96,255,56,0,1,2,159,5,205,
+0,1,4,99,255,56,0,1,9,182,5,205,0,1,5,161,5,205,0,1,9,183,0,0,0,1,6,4,5,205,
+0,1,5,250,0,0,0,1,4,87,5,205,0,1,4,98,5,205,0,1,7,189,255,116,0,1,5,227,5,
+205,0,1,5,238,5,205,0,1,3,57,5,205,0,1,5,239,0,0,0,6,0,0,0,1,0,8,0,1,0,12,
+0,12,0,1,0,20,0,36,0,1,0,2,0,21,0,48,0,2,0,0,0,10,0,0,0,10,0,1,254,192,5,
+205,0,2,0,6,0,12,0,1,253,48,5,205,0,1,0,100,5,205,0,1,0,0,0,10,0,30,0,44,
+0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,100,108,105,103,0,8,0,
+0,0,1,0,0,0,1,0,4,0,4,0,0,0,1,0,8,0,1,0,186,0,9,0,24,0,42,0,60,0,70,0,80,
+0,106,0,116,0,134,0,144,0,2,0,6,0,12,0,54,0,2,0,17,0,55,0,2,0,30,0,2,0,6,
+0,12,0,56,0,2,0,22,0,57,0,2,0,23,0,1,0,4,0,58,0,2,0,24,0,1,0,4,0,59,0,2,0,
+30,0,3,0,8,0,14,0,20,0,60,0,2,0,30,0,61,0,2,0,32,0,62,0,2,0,34,0,1,0,4,0,
+63,0,2,0,37,0,2,0,6,0,12,0,64,0,2,0,37,0,65,0,2,0,39,0,1,0,4,0,66,0,2,0,41,
+0,5,0,12,0,18,0,24,0,30,0,36,0,67,0,2,0,17,0,68,0,2,0,22,0,69,0,2,0,23,0,
+70,0,2,0,30,0,71,0,2,0,37,0,1,0,9,0,17,0,22,0,24,0,30,0,34,0,37,0,39,0,40,
+0,43,};
+#endif
@@ -0,0 +1,1879 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansSyriacEastern_Regular_ttf_size = 50164;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansSyriacEastern_Regular_ttf");
+asm(".type fz_font_NotoSansSyriacEastern_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansSyriacEastern_Regular_ttf, 50164");
+asm(".balign 64");
+asm("fz_font_NotoSansSyriacEastern_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansSyriacEastern-Regular.ttf\"");
+#else
+const int fz_font_NotoSansSyriacEastern_Regular_ttf_size = 50164;
+const char fz_font_NotoSansSyriacEastern_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,31,215,32,70,0,0,100,244,0,0,1,34,
+71,80,79,83,248,241,82,46,0,0,102,24,0,0,41,112,71,83,85,66,39,168,234,117,
+0,0,143,136,0,0,52,108,79,83,47,50,118,12,93,106,0,0,1,104,0,0,0,96,99,109,
+97,112,180,95,189,52,0,0,6,176,0,0,1,180,103,97,115,112,0,7,0,7,0,0,100,232,
+0,0,0,12,103,108,121,102,174,79,50,3,0,0,10,228,0,0,83,178,104,101,97,100,
+7,40,87,234,0,0,0,236,0,0,0,54,104,104,101,97,13,56,0,112,0,0,1,36,0,0,0,
+36,104,109,116,120,219,27,226,126,0,0,1,200,0,0,4,232,108,111,99,97,193,130,
+213,167,0,0,8,100,0,0,2,128,109,97,120,112,1,85,0,156,0,0,1,72,0,0,0,32,110,
+97,109,101,146,182,189,13,0,0,94,152,0,0,6,46,112,111,115,116,255,105,0,102,
+0,0,100,200,0,0,0,32,0,1,0,0,0,1,10,61,172,248,249,6,95,15,60,245,0,11,8,
+0,0,0,0,0,207,59,140,143,0,0,0,0,211,11,119,207,252,184,252,222,9,10,7,115,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,115,252,222,0,0,9,140,252,184,248,208,9,
+10,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,53,0,1,0,0,1,63,0,71,0,8,0,83,0,7,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,1,0,4,4,113,1,144,0,5,0,0,5,51,4,204,0,0,
+0,153,5,51,4,204,0,0,2,204,0,102,2,145,0,0,2,4,5,3,5,3,6,2,2,3,0,0,0,0,0,
+0,0,0,0,0,0,128,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,115,252,222,0,0,7,
+115,3,34,32,62,1,97,215,255,0,0,0,0,0,0,0,0,0,32,0,7,4,205,0,193,0,0,0,0,
+2,20,0,0,2,20,0,0,0,0,255,220,0,0,255,37,0,0,255,220,0,0,254,81,2,247,0,118,
+2,247,0,118,2,246,0,120,2,218,0,120,2,218,0,120,0,0,255,136,6,53,0,100,6,
+128,0,100,4,153,255,176,4,78,255,176,6,170,0,100,6,29,0,100,3,14,255,176,
+3,156,255,176,6,170,0,100,6,29,0,100,3,14,255,176,3,156,255,176,4,42,0,160,
+4,37,0,160,4,42,0,160,4,37,0,160,6,11,0,140,6,86,0,140,4,167,0,140,4,149,
+0,140,2,39,0,120,2,138,0,169,7,132,0,100,6,225,0,100,4,80,255,176,4,243,255,
+176,8,255,0,100,8,5,0,100,4,247,255,176,5,241,255,176,9,29,0,100,8,35,0,100,
+5,21,255,176,6,15,255,176,5,223,0,100,5,60,0,100,2,151,255,176,3,57,255,176,
+9,140,0,140,5,136,0,140,4,235,0,140,4,178,255,176,5,22,255,176,6,102,0,100,
+6,31,0,100,3,16,255,176,3,88,255,176,5,163,0,100,5,238,0,100,6,22,255,176,
+6,22,255,176,3,106,0,122,2,33,0,100,2,175,255,176,2,233,255,176,8,0,0,100,
+7,243,0,100,6,36,255,176,6,42,255,176,6,44,0,140,6,31,0,144,6,29,255,176,
+6,42,255,176,6,171,0,100,5,26,0,100,3,95,255,176,4,241,255,176,5,235,0,100,
+5,200,0,100,4,105,255,176,4,140,255,176,6,10,0,100,5,223,0,100,4,96,255,176,
+4,139,255,176,4,179,0,141,4,115,0,141,7,19,0,100,7,94,0,100,5,18,255,176,
+4,199,255,176,4,42,0,160,4,37,0,160,7,195,0,100,7,100,0,100,4,132,255,176,
+4,207,255,176,5,152,0,140,5,0,0,140,6,53,0,100,6,128,0,100,4,153,255,176,
+4,78,255,176,6,170,0,100,6,29,0,100,3,14,255,176,3,156,255,176,5,141,0,116,
+5,136,0,116,4,170,0,140,4,170,0,140,6,53,0,100,6,128,0,100,4,153,255,176,
+4,78,255,176,5,145,0,100,5,69,0,100,3,149,255,176,3,225,255,176,3,197,0,110,
+3,9,255,176,4,188,0,246,2,13,0,171,2,13,0,171,2,55,0,192,2,13,0,171,3,103,
+0,171,2,193,0,171,2,193,0,171,2,193,0,171,2,193,0,171,4,162,0,245,7,98,0,
+244,5,142,1,4,6,17,0,225,0,0,255,80,0,0,255,13,0,0,255,26,0,0,255,172,0,0,
+255,78,0,0,255,97,0,0,255,136,0,0,255,9,0,0,255,28,0,0,255,80,0,0,255,88,
+0,0,255,16,0,0,255,30,0,0,255,190,0,0,255,42,0,0,255,42,0,0,255,190,0,0,254,
+253,0,0,255,160,0,0,255,160,0,0,255,191,0,0,255,191,0,0,255,51,0,0,255,51,
+0,0,255,2,0,0,255,3,0,0,254,159,0,0,255,7,0,0,254,245,0,0,254,251,0,0,255,
+172,0,0,254,253,0,0,255,147,0,0,255,173,0,0,254,253,0,0,255,147,0,0,255,11,
+0,0,254,253,0,0,254,244,0,0,254,251,0,0,255,56,0,0,255,18,0,0,255,56,0,0,
+255,67,0,0,255,61,0,0,255,56,0,0,255,15,0,0,255,110,0,0,254,252,0,0,255,97,
+0,0,255,97,0,0,255,209,0,0,254,227,0,0,255,13,0,0,255,9,0,0,255,15,0,0,255,
+14,0,0,255,23,0,0,255,15,0,0,255,38,0,0,255,49,0,0,255,0,0,0,255,43,0,0,255,
+97,0,0,255,56,0,0,255,56,1,133,0,72,2,62,0,191,3,65,0,50,3,181,0,50,3,30,
+0,60,3,162,0,70,3,69,0,20,3,188,0,0,3,198,0,10,3,92,0,30,3,211,0,130,2,24,
+0,112,2,24,0,109,2,33,0,164,2,55,0,130,2,69,0,183,2,69,0,183,5,206,0,164,
+3,8,0,66,2,70,0,193,2,94,0,82,2,94,0,61,2,155,0,160,2,155,0,50,4,80,0,160,
+4,80,255,206,4,80,0,160,4,80,255,206,3,250,0,82,3,250,0,80,3,94,0,70,4,149,
+0,130,4,149,0,130,4,150,0,145,3,175,0,90,3,45,0,32,2,240,0,23,2,147,0,84,
+3,109,0,115,4,215,0,170,7,40,0,180,7,0,0,180,4,42,0,160,4,37,0,160,3,58,0,
+115,3,58,0,115,2,119,254,144,2,242,0,115,2,218,0,115,2,218,0,115,5,103,255,
+135,5,103,255,135,4,53,255,176,3,234,255,176,2,70,255,8,2,212,255,8,2,70,
+255,8,2,212,255,8,4,47,255,8,5,41,255,8,4,77,255,8,5,71,255,8,2,72,255,8,
+2,144,255,8,2,176,255,152,4,66,255,153,3,238,255,176,4,57,255,176,4,45,255,
+176,4,120,255,176,7,52,0,100,4,37,255,176,3,93,255,8,7,52,0,100,4,37,255,
+176,7,52,0,100,4,37,255,176,3,93,255,8,4,193,0,160,4,193,0,160,7,72,0,100,
+5,97,255,176,6,169,0,100,5,74,255,176,3,38,0,169,3,75,255,176,0,0,255,211,
+0,0,255,171,0,0,255,236,0,0,255,112,0,0,255,79,0,0,255,174,0,0,255,190,0,
+0,255,190,0,0,255,167,0,0,255,160,0,0,255,160,0,0,255,147,0,0,255,147,0,156,
+255,176,1,23,255,176,0,63,255,176,0,225,255,176,0,0,0,0,254,72,252,184,255,
+216,255,216,255,216,254,72,252,184,0,120,0,120,0,120,0,0,0,1,0,3,0,1,0,0,
+0,12,0,4,1,168,0,0,0,78,0,64,0,5,0,14,0,0,0,13,0,33,0,43,0,47,0,58,0,61,0,
+93,0,160,0,171,0,176,0,187,3,4,3,8,3,10,3,32,3,37,3,46,3,49,6,12,6,27,6,31,
+6,33,6,64,6,85,6,108,6,112,7,13,7,47,7,74,7,79,32,15,32,38,32,68,34,18,37,
+204,38,113,254,255,255,255,0,0,0,0,0,13,0,32,0,40,0,45,0,58,0,61,0,91,0,160,
+0,171,0,176,0,187,3,3,3,7,3,10,3,32,3,35,3,45,3,48,6,12,6,27,6,31,6,33,6,
+64,6,75,6,96,6,112,7,0,7,15,7,48,7,77,32,12,32,38,32,68,34,18,37,204,38,112,
+254,255,255,255,0,1,255,245,0,0,0,0,0,0,0,163,0,177,0,0,255,99,0,62,0,67,
+0,47,253,164,253,162,253,161,253,146,253,137,253,130,253,129,250,207,250,
+193,250,192,250,90,250,60,250,104,250,109,250,78,249,125,0,0,249,92,0,0,223,
+248,224,184,224,172,222,219,219,40,218,133,1,2,0,1,0,0,0,0,0,74,0,76,0,82,
+0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
+224,0,225,0,226,0,235,0,236,0,242,0,218,0,239,0,227,0,241,0,228,0,139,0,8,
+0,13,0,14,0,18,0,22,0,26,0,28,0,30,0,32,0,34,0,36,0,40,0,44,0,48,0,52,0,53,
+0,57,0,61,0,65,0,69,0,73,0,77,0,81,0,85,0,89,0,91,0,95,0,97,0,101,0,103,0,
+107,0,111,0,113,0,115,0,119,0,0,0,21,0,21,0,21,0,21,0,34,0,63,0,87,0,110,
+0,147,0,155,0,203,0,251,1,3,1,38,1,75,1,127,1,175,1,208,1,242,2,29,2,70,2,
+101,2,113,2,125,2,137,2,149,2,161,2,173,2,205,2,254,3,53,3,112,3,152,3,204,
+3,231,4,13,4,71,4,135,4,195,4,250,5,36,5,78,5,117,5,156,5,210,6,8,6,59,6,
+110,6,142,6,180,6,214,6,243,7,15,7,79,7,152,7,202,7,244,8,16,8,55,8,92,8,
+116,8,155,8,209,9,35,9,104,9,142,9,180,9,228,10,11,10,100,10,203,11,47,11,
+133,11,210,12,46,12,54,12,62,12,114,12,156,12,196,12,246,13,40,13,102,13,
+161,13,209,14,34,14,114,14,191,15,13,15,72,15,139,15,203,16,23,16,95,16,154,
+16,166,16,178,16,240,17,45,17,102,17,159,17,211,18,12,18,65,18,127,18,185,
+18,230,19,39,19,113,19,186,19,248,20,9,20,26,20,60,20,109,20,175,21,1,21,
+79,21,141,21,211,22,30,22,102,22,170,22,209,22,228,22,249,23,2,23,11,23,24,
+23,37,23,50,23,63,23,76,23,89,23,102,23,149,23,168,23,196,23,245,24,6,24,
+40,24,74,24,87,24,133,24,179,24,217,25,1,25,41,25,54,25,67,25,95,25,123,25,
+132,25,158,25,184,25,193,25,206,25,215,25,224,25,237,25,250,26,11,26,28,26,
+42,26,56,26,130,26,172,26,205,26,219,26,228,26,241,27,3,27,12,27,25,27,42,
+27,77,27,102,27,135,27,148,27,171,27,238,28,4,28,18,28,69,28,83,28,139,28,
+177,28,218,29,6,29,49,29,62,29,74,29,86,29,98,29,110,29,122,29,134,29,196,
+29,208,29,220,29,232,29,244,30,0,30,12,30,24,30,36,30,51,30,90,30,151,30,
+216,30,255,31,39,31,89,31,142,31,188,31,216,31,238,32,5,32,17,32,42,32,69,
+32,86,32,102,32,147,32,167,32,196,32,225,32,245,33,8,33,24,33,40,33,48,33,
+56,33,94,33,133,33,168,33,192,33,205,33,225,33,241,34,1,34,16,34,29,34,68,
+34,157,34,213,35,29,35,45,35,61,35,98,35,135,35,168,35,198,35,237,35,245,
+36,71,36,140,36,188,36,221,37,6,37,37,37,110,37,172,37,211,37,250,38,45,38,
+96,38,133,38,157,38,197,38,247,39,48,39,105,39,116,39,127,39,139,39,151,39,
+163,39,179,39,195,39,207,39,219,39,231,39,247,40,3,40,15,40,27,40,39,40,51,
+40,63,40,75,40,84,40,93,40,131,40,139,40,177,40,189,40,211,40,223,40,235,
+40,244,40,253,41,5,41,13,41,30,41,49,41,66,41,83,41,83,41,97,41,111,41,124,
+41,137,41,150,41,164,41,178,41,191,41,204,41,217,0,2,0,193,0,0,4,10,5,182,
+0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,
+182,250,74,104,4,230,0,0,1,255,220,0,0,0,36,5,182,0,3,0,0,19,17,35,17,36,
+72,5,182,250,74,5,182,0,1,255,37,0,0,0,219,5,204,0,14,0,0,51,35,17,7,39,55,
+39,55,23,55,23,7,23,7,39,36,72,134,49,171,171,49,170,170,49,171,171,49,134,
+4,161,136,49,169,168,49,171,171,49,168,169,49,136,0,0,1,255,220,0,0,1,174,
+5,204,0,10,0,0,1,7,39,55,33,17,35,17,33,39,55,1,174,217,49,137,254,246,71,
+1,81,137,49,4,245,214,49,130,251,46,5,25,130,49,0,1,254,81,0,0,0,35,5,204,
+0,10,0,0,51,35,17,33,23,7,39,55,23,7,33,35,71,254,246,137,49,217,217,49,137,
+1,81,4,210,130,49,214,215,49,130,0,0,1,0,118,0,0,2,127,4,207,0,21,0,0,51,
+55,54,18,53,52,38,39,39,55,22,22,21,20,2,7,21,50,55,55,51,21,118,4,126,149,
+25,21,149,71,136,135,125,104,10,25,104,185,123,153,1,122,171,54,113,25,68,
+146,12,170,204,176,254,145,142,8,2,1,155,0,255,255,0,118,0,0,2,127,4,207,
+18,6,0,8,0,0,0,1,0,120,255,118,2,126,4,207,0,29,0,0,19,55,22,22,21,20,2,7,
+7,6,6,7,21,54,51,51,21,33,7,35,39,39,53,51,54,18,53,52,38,39,201,71,136,135,
+83,78,18,9,19,7,79,80,150,254,165,3,21,119,28,50,116,110,26,20,4,61,146,12,
+177,207,150,254,221,143,32,17,30,12,8,3,155,138,137,13,143,190,1,63,161,65,
+104,23,0,1,0,120,255,118,2,218,4,207,0,29,0,0,19,55,22,22,21,20,2,7,7,6,6,
+7,21,54,51,51,21,33,7,35,39,39,53,51,54,18,53,52,38,39,201,71,136,135,83,
+78,18,9,19,7,79,80,242,254,73,3,21,119,28,50,116,110,26,20,4,61,146,12,177,
+207,150,254,221,143,32,17,30,12,8,3,155,138,137,13,143,190,1,63,161,65,104,
+23,255,255,0,120,255,118,2,218,4,207,18,6,0,11,0,0,0,1,255,136,3,222,0,105,
+5,240,0,20,0,0,3,54,54,53,52,38,39,39,55,22,22,21,20,6,7,21,54,51,51,21,35,
+118,61,57,9,10,65,34,62,59,45,59,43,37,58,225,4,19,75,158,65,22,48,13,26,
+70,5,82,84,65,145,78,7,3,67,0,0,1,0,100,0,0,5,169,3,130,0,20,0,0,37,17,33,
+34,38,39,53,22,22,51,33,17,7,33,34,38,39,55,22,22,51,5,19,254,214,119,210,
+45,37,210,117,1,202,80,252,146,159,200,32,92,54,156,135,155,2,55,18,12,146,
+9,17,253,6,110,86,74,123,77,51,0,0,1,0,100,0,0,6,128,3,130,0,33,0,0,37,38,
+53,17,33,34,38,39,53,22,22,51,33,17,20,22,22,51,51,21,35,34,38,39,35,7,33,
+34,38,39,55,22,22,51,5,46,27,254,214,119,210,45,37,210,117,1,202,29,51,65,
+70,83,73,113,36,4,35,252,195,159,200,32,92,54,156,135,155,70,110,1,131,18,
+12,146,9,17,253,244,77,80,36,155,43,51,94,86,74,123,77,51,0,1,255,176,0,0,
+4,153,3,130,0,32,0,0,49,34,38,53,52,54,51,33,38,53,17,33,34,38,39,53,22,22,
+51,33,17,20,22,22,51,51,21,35,34,38,39,35,7,33,47,47,33,3,71,27,254,214,119,
+210,45,37,210,117,1,202,29,51,65,70,83,73,113,36,4,35,41,36,36,42,70,110,
+1,131,18,12,146,9,17,253,244,77,80,36,155,43,51,94,0,1,255,176,0,0,3,194,
+3,130,0,19,0,0,49,34,38,53,52,54,51,33,17,33,34,38,39,53,22,22,51,33,17,7,
+33,47,47,33,3,44,254,214,119,210,45,37,210,117,1,202,80,41,36,36,42,2,55,
+18,12,146,9,17,253,6,110,0,0,1,0,100,254,20,7,64,5,140,0,16,0,0,1,3,33,34,
+38,39,55,22,22,51,33,1,55,1,51,21,35,6,123,161,252,17,159,200,32,92,52,161,
+142,3,34,253,153,144,3,115,95,197,254,200,1,56,86,74,123,74,54,4,171,70,249,
+84,204,0,0,1,0,100,254,20,7,1,5,140,0,24,0,0,33,19,51,21,35,53,3,35,7,33,
+34,38,39,55,22,22,51,33,1,55,1,22,22,51,21,6,12,150,95,197,209,4,37,252,169,
+159,200,32,92,52,161,142,3,35,253,153,144,2,77,35,38,24,254,224,204,180,1,
+150,94,86,74,123,74,54,4,170,71,251,135,67,53,155,0,1,255,176,254,20,3,242,
+5,140,0,23,0,0,33,19,51,21,35,53,3,35,7,33,34,38,53,52,54,51,33,1,55,1,22,
+22,51,21,2,253,150,95,197,209,4,37,253,205,33,47,47,33,2,55,253,153,144,2,
+77,35,38,24,254,224,204,180,1,150,94,41,36,36,42,4,171,70,251,135,67,53,155,
+0,0,1,255,176,254,20,4,50,5,140,0,15,0,0,1,3,33,34,38,53,52,54,51,33,1,55,
+1,51,21,35,3,109,161,253,52,33,47,47,33,2,55,253,153,144,3,115,95,197,254,
+200,1,56,41,36,36,42,4,171,70,249,84,204,255,255,0,100,254,20,7,64,5,140,
+18,38,0,18,0,0,16,7,1,40,3,165,1,29,255,255,0,100,254,20,7,1,5,140,18,38,
+0,19,0,0,16,7,1,40,3,165,1,29,255,255,255,176,254,20,3,242,5,140,18,38,0,
+20,0,0,16,7,1,40,0,112,1,29,255,255,255,176,254,20,4,50,5,140,18,38,0,21,
+0,0,16,7,1,40,0,112,1,29,255,255,0,160,254,146,3,158,3,113,16,39,1,40,2,19,
+254,112,16,6,0,28,0,0,255,255,0,160,254,146,4,37,3,113,16,39,1,40,2,19,254,
+112,16,6,0,29,0,0,0,1,0,160,0,0,3,158,3,113,0,18,0,0,51,53,33,16,2,35,34,
+6,7,53,54,54,51,50,18,17,21,20,7,160,2,102,179,181,51,114,65,46,129,74,252,
+241,3,155,1,46,1,17,24,29,141,27,36,254,160,254,131,72,40,36,0,1,0,160,0,
+0,4,37,3,113,0,30,0,0,1,38,38,35,34,6,7,53,54,54,51,50,22,23,23,22,22,51,
+51,21,35,34,39,35,7,33,53,33,38,38,39,3,0,31,171,159,50,128,44,36,144,73,
+195,233,37,43,10,44,28,33,33,123,60,4,36,253,123,2,144,8,10,5,1,135,176,164,
+28,23,136,28,37,203,204,227,53,39,155,94,94,155,20,44,26,0,0,2,0,140,255,
+194,5,127,3,120,0,19,0,33,0,0,1,50,36,55,17,35,17,5,22,22,21,16,2,35,34,2,
+53,52,54,51,23,34,6,21,20,22,51,50,54,54,53,52,38,39,3,185,151,1,18,29,140,
+254,211,5,7,214,217,184,223,175,143,12,75,105,140,133,96,124,55,6,7,3,104,
+9,7,252,74,3,24,8,29,73,26,254,180,254,248,1,2,206,166,244,149,142,104,159,
+167,84,173,189,32,67,26,0,0,2,0,140,255,194,6,86,3,120,0,23,0,37,0,0,33,21,
+35,17,5,22,22,21,16,2,35,34,2,53,52,54,51,33,50,36,55,17,51,21,1,34,6,21,
+20,22,51,50,54,54,53,52,38,39,5,127,140,254,211,5,7,214,217,184,223,175,143,
+1,239,151,1,18,29,215,251,128,75,105,140,133,96,124,55,6,7,62,3,24,8,29,73,
+26,254,180,254,248,1,2,206,166,244,9,7,253,35,155,2,211,142,104,159,167,84,
+173,189,32,67,26,0,2,0,140,255,245,4,27,3,165,0,11,0,23,0,0,0,18,21,20,6,
+35,34,38,53,52,18,51,18,54,53,52,38,35,34,6,21,20,22,51,3,42,241,237,219,
+218,237,254,210,144,152,161,144,142,162,145,159,3,165,254,232,224,207,233,
+233,207,219,1,29,252,231,145,148,159,190,192,157,140,153,0,0,2,0,140,255,
+245,4,149,3,156,0,21,0,33,0,0,33,34,38,39,35,6,6,35,34,38,53,52,18,51,50,
+18,21,20,7,22,22,51,4,54,53,52,38,35,34,6,21,20,22,51,4,149,83,124,28,8,57,
+167,115,215,236,252,207,204,239,21,7,95,50,254,87,145,162,140,139,162,143,
+158,56,57,60,64,230,206,218,1,25,254,236,223,85,70,52,63,17,151,140,157,188,
+189,156,140,151,0,0,1,0,120,255,97,1,155,3,1,0,14,0,0,37,38,38,53,52,54,51,
+50,22,21,20,6,7,7,39,1,21,84,73,80,73,73,65,10,9,13,113,53,64,208,147,154,
+143,131,151,128,245,110,163,29,0,1,0,169,255,97,2,138,3,1,0,23,0,0,37,38,
+38,53,52,54,51,50,22,21,20,6,7,22,22,51,51,21,35,34,38,39,7,39,1,70,84,73,
+80,73,73,65,4,4,35,79,39,45,45,26,92,45,14,113,53,64,208,147,154,143,131,
+151,91,152,72,9,8,155,9,11,179,29,0,1,0,100,255,238,7,2,1,229,0,33,0,0,33,
+34,38,39,55,22,22,51,33,19,51,23,22,22,23,23,22,23,19,51,1,7,1,35,3,6,6,35,
+34,38,39,39,35,3,1,235,159,200,32,92,54,156,135,1,27,14,124,137,18,47,24,
+45,21,13,12,124,1,139,115,254,232,4,11,12,34,17,57,97,151,58,4,11,86,74,123,
+77,51,1,74,150,20,48,23,44,20,10,1,59,254,104,95,1,62,254,212,3,2,72,170,
+66,254,209,0,1,0,100,255,251,6,225,1,229,0,39,0,0,37,6,6,35,34,38,39,39,35,
+3,33,34,38,39,55,22,22,51,33,19,51,23,22,23,23,22,22,23,19,51,23,22,22,51,
+21,34,38,39,39,35,5,105,13,34,17,60,101,144,58,4,11,254,60,159,200,32,92,
+54,156,135,1,27,15,123,138,18,24,47,23,42,13,13,123,238,42,60,22,60,96,52,
+154,4,1,4,2,81,162,65,254,209,86,74,123,77,51,1,74,150,20,24,47,24,39,10,
+1,58,251,45,34,155,56,62,184,0,0,1,255,176,255,251,4,80,1,229,0,38,0,0,49,
+34,38,53,52,54,51,51,19,51,23,22,23,23,22,22,23,19,51,23,22,22,51,21,34,38,
+39,39,35,3,6,6,35,34,38,39,39,35,3,33,47,47,33,163,14,124,138,18,24,47,23,
+42,13,11,125,238,42,60,22,60,96,52,154,4,10,13,34,17,60,101,144,58,4,11,41,
+36,36,42,1,74,150,20,24,47,24,39,10,1,58,251,45,34,155,56,62,184,254,211,
+4,2,81,162,65,254,209,0,0,1,255,176,255,238,4,113,1,229,0,32,0,0,33,33,34,
+38,53,52,54,51,51,19,51,23,22,22,23,23,22,23,19,51,1,7,1,35,3,6,6,35,34,38,
+39,39,35,1,30,254,226,33,47,47,33,163,14,124,137,18,47,24,45,21,13,12,124,
+1,139,115,254,232,4,11,12,34,17,57,97,151,58,4,41,36,36,41,1,75,150,20,48,
+23,44,20,10,1,59,254,104,95,1,62,254,212,3,2,72,170,65,0,0,2,0,100,253,184,
+8,115,5,140,0,16,0,19,0,0,1,35,1,33,34,38,39,55,22,22,51,33,1,55,1,33,21,
+1,19,33,6,255,61,254,211,252,86,159,200,32,92,52,161,142,3,34,253,153,144,
+2,137,2,124,254,154,247,254,67,253,184,2,72,86,74,123,74,54,4,171,70,251,
+15,161,254,133,1,129,0,0,2,0,100,253,184,8,115,5,140,0,16,0,19,0,0,1,35,1,
+33,34,38,39,55,22,22,51,33,1,55,1,33,21,1,19,33,6,255,61,254,211,252,86,159,
+200,32,92,52,161,142,3,34,253,153,144,2,137,2,124,254,154,247,254,67,253,
+184,2,72,86,74,123,74,54,4,171,70,251,15,161,254,133,1,129,0,0,2,255,176,
+253,184,5,101,5,140,0,15,0,18,0,0,1,35,1,33,34,38,53,52,54,51,33,1,55,1,33,
+21,1,19,33,3,241,61,254,211,253,121,33,47,47,33,2,55,253,153,144,2,137,2,
+124,254,154,247,254,67,253,184,2,72,41,36,36,42,4,171,70,251,15,161,254,133,
+1,129,0,2,255,176,253,184,5,101,5,140,0,15,0,18,0,0,1,35,1,33,34,38,53,52,
+54,51,33,1,55,1,33,21,1,19,33,3,241,61,254,211,253,121,33,47,47,33,2,55,253,
+153,144,2,137,2,124,254,154,247,254,67,253,184,2,72,41,36,36,42,4,171,70,
+251,15,161,254,133,1,129,0,3,0,100,253,154,8,145,5,140,0,16,0,23,0,27,0,0,
+1,35,1,33,34,38,39,55,22,22,51,33,1,55,1,33,21,1,54,18,55,33,20,18,19,51,
+21,35,7,14,61,254,196,252,86,159,200,32,92,52,161,142,3,34,253,153,144,2,
+137,2,154,254,111,50,194,51,253,254,147,4,159,159,253,154,2,102,86,74,123,
+74,54,4,171,70,251,15,161,254,53,41,1,35,133,124,254,233,1,64,163,0,0,3,0,
+100,253,154,8,145,5,140,0,16,0,23,0,27,0,0,1,35,1,33,34,38,39,55,22,22,51,
+33,1,55,1,33,21,1,54,18,55,33,20,18,19,51,21,35,7,14,61,254,196,252,86,159,
+200,32,92,52,161,142,3,34,253,153,144,2,137,2,154,254,111,50,194,51,253,254,
+147,4,159,159,253,154,2,102,86,74,123,74,54,4,171,70,251,15,161,254,53,41,
+1,35,133,124,254,233,1,64,163,0,0,3,255,176,253,154,5,131,5,140,0,15,0,22,
+0,26,0,0,1,35,1,33,34,38,53,52,54,51,33,1,55,1,33,21,1,54,18,55,33,20,18,
+19,51,21,35,4,0,61,254,196,253,121,33,47,47,33,2,55,253,153,144,2,137,2,154,
+254,111,50,194,51,253,254,147,4,159,159,253,154,2,102,41,36,36,42,4,171,70,
+251,15,161,254,53,41,1,35,133,124,254,233,1,64,163,0,3,255,176,253,154,5,
+131,5,140,0,15,0,22,0,26,0,0,1,35,1,33,34,38,53,52,54,51,33,1,55,1,33,21,
+1,54,18,55,33,20,18,19,51,21,35,4,0,61,254,196,253,121,33,47,47,33,2,55,253,
+153,144,2,137,2,154,254,111,50,194,51,253,254,147,4,159,159,253,154,2,102,
+41,36,36,42,4,171,70,251,15,161,254,53,41,1,35,133,124,254,233,1,64,163,0,
+1,0,100,255,238,5,93,1,211,0,15,0,0,33,33,34,38,39,55,22,22,51,33,19,51,1,
+7,1,35,3,195,254,40,159,200,32,92,54,156,135,1,49,11,105,1,159,115,254,224,
+4,86,74,123,77,51,1,56,254,115,88,1,32,0,0,1,0,100,0,0,5,60,1,211,0,21,0,
+0,33,34,38,39,55,22,22,51,33,19,51,5,22,22,51,21,34,38,39,39,35,3,1,235,159,
+200,32,92,54,156,135,1,49,11,105,1,1,42,61,22,62,97,47,164,4,3,86,74,123,
+77,51,1,56,245,40,27,155,56,49,165,254,242,0,1,255,176,0,0,2,151,1,211,0,
+20,0,0,49,34,38,53,52,54,51,51,19,51,5,22,22,51,21,34,38,39,39,35,3,33,47,
+47,33,164,11,105,1,2,42,61,22,62,97,47,165,4,2,41,36,36,42,1,56,245,40,27,
+155,56,49,165,254,242,0,1,255,176,255,238,2,183,1,211,0,14,0,0,19,51,1,7,
+1,35,3,33,34,38,53,52,54,51,51,175,105,1,159,115,254,224,4,3,254,227,33,47,
+47,33,164,1,211,254,115,88,1,32,254,242,41,36,36,42,255,255,0,140,254,171,
+9,10,6,19,16,38,0,31,0,0,16,39,1,40,3,46,254,137,16,39,0,51,6,83,0,0,16,39,
+1,40,2,126,4,21,16,39,1,40,3,43,5,66,16,7,1,40,3,216,4,21,0,1,0,140,253,74,
+4,252,3,143,0,40,0,0,33,38,2,39,55,33,21,33,6,6,21,20,31,2,22,23,23,22,22,
+23,51,54,54,51,50,22,21,20,2,7,39,54,18,53,52,38,35,34,6,7,1,252,101,219,
+48,95,2,113,253,241,11,12,5,7,21,14,20,92,20,45,19,8,54,183,122,167,189,239,
+233,102,223,193,106,97,94,146,62,164,1,150,116,225,150,20,34,14,8,12,19,43,
+30,39,178,41,84,33,143,154,184,172,183,254,89,235,89,254,1,87,145,102,114,
+166,187,0,0,1,0,140,253,32,5,74,3,44,0,46,0,0,1,6,6,15,2,6,35,7,35,6,6,21,
+20,18,0,22,51,55,50,54,55,23,6,6,35,34,2,0,3,55,51,50,36,55,53,51,17,20,22,
+51,51,21,35,34,38,53,3,121,10,59,43,92,98,48,42,69,89,11,12,245,1,122,206,
+128,31,9,16,5,20,31,67,15,164,252,254,1,174,95,200,151,1,18,29,140,36,55,
+139,162,101,107,2,59,3,5,2,4,3,2,1,17,34,13,27,254,157,254,54,240,2,4,2,130,
+12,9,1,16,2,120,1,47,230,9,7,95,253,203,56,36,155,102,116,0,0,1,255,176,0,
+0,4,178,3,128,0,33,0,0,49,34,38,53,52,54,51,33,39,38,38,35,34,6,7,35,54,54,
+51,50,22,23,23,22,22,51,51,21,35,34,38,39,35,7,33,47,47,33,3,215,86,116,196,
+119,88,103,15,141,13,195,150,180,248,116,38,82,32,9,20,20,56,78,32,4,37,41,
+36,36,42,176,238,172,59,57,128,143,224,241,80,173,23,155,45,49,94,0,0,1,255,
+176,0,0,4,138,3,128,0,26,0,0,49,34,38,53,52,54,51,33,39,38,38,35,34,6,7,35,
+54,54,51,50,22,23,23,22,22,23,7,33,47,47,33,3,215,86,116,196,119,88,103,15,
+141,13,195,150,171,242,122,101,16,26,7,73,41,36,36,42,176,238,172,59,57,128,
+143,202,244,210,35,58,18,129,0,1,0,100,0,0,6,2,5,140,0,12,0,0,37,1,55,1,7,
+33,34,38,39,55,22,22,51,5,69,253,153,144,2,148,95,252,72,159,200,32,92,52,
+161,142,155,4,171,70,251,1,141,86,74,123,74,54,0,1,0,100,0,0,6,31,5,140,0,
+21,0,0,37,1,55,1,22,22,51,21,35,34,38,39,35,7,33,34,38,39,55,22,22,51,5,70,
+253,152,144,2,79,5,59,34,15,55,78,31,4,36,252,167,159,200,32,92,52,161,142,
+155,4,171,70,251,135,9,111,155,51,42,93,86,74,123,74,54,0,1,255,176,0,0,3,
+16,5,140,0,20,0,0,33,34,38,39,35,7,33,34,38,53,52,54,51,33,1,55,1,22,22,51,
+21,3,1,56,76,31,4,37,253,203,33,47,47,33,2,56,253,152,144,2,79,14,51,32,50,
+43,93,41,36,36,42,4,171,70,251,135,27,93,155,0,0,1,255,176,0,0,2,244,5,140,
+0,11,0,0,49,34,38,53,52,54,51,33,1,55,1,7,33,47,47,33,2,55,253,153,144,2,
+148,95,41,36,36,42,4,171,70,251,1,141,0,2,0,100,254,187,5,23,3,130,0,14,0,
+18,0,0,1,1,35,34,36,39,53,22,4,51,33,17,7,33,3,19,33,17,33,1,15,1,50,16,133,
+254,220,36,33,1,41,124,2,237,80,253,49,98,145,2,90,254,83,254,227,3,239,20,
+10,146,8,18,253,6,110,254,187,1,224,2,55,0,0,2,0,100,254,187,5,238,3,130,
+0,24,0,30,0,0,1,1,35,34,36,39,53,22,4,51,33,17,20,22,51,51,21,35,34,38,39,
+35,7,33,3,1,38,53,17,33,3,1,15,1,50,16,133,254,220,36,33,1,41,124,2,237,44,
+68,103,126,75,97,27,4,35,253,118,98,2,248,13,254,83,173,254,227,3,239,20,
+10,146,8,18,253,172,72,49,155,48,45,93,254,187,1,224,46,62,1,203,253,201,
+0,0,2,255,176,255,245,6,22,3,215,0,45,0,57,0,0,49,34,38,53,52,54,51,33,38,
+53,52,55,39,38,38,39,55,22,22,23,23,54,54,51,50,18,21,20,7,22,22,51,51,21,
+35,34,38,39,35,6,6,35,34,39,35,7,36,54,53,52,38,35,34,6,21,20,22,51,33,47,
+47,33,2,127,56,3,186,127,174,45,100,37,121,123,191,52,200,129,187,224,21,
+11,67,53,30,30,72,107,33,6,53,155,103,203,107,4,36,1,235,131,148,124,123,
+152,135,140,41,36,36,42,91,133,30,29,140,97,148,45,115,37,110,94,146,120,
+132,254,248,205,80,66,41,37,155,47,47,51,54,105,94,136,126,122,140,176,182,
+134,122,126,0,2,255,176,255,245,5,138,3,215,0,34,0,46,0,0,49,34,38,53,52,
+54,51,33,38,53,52,55,39,38,38,39,55,22,22,23,23,54,54,51,50,18,21,20,6,35,
+34,38,39,35,7,36,54,53,52,38,35,34,6,21,20,22,51,33,47,47,33,2,127,56,3,186,
+127,174,45,100,37,121,123,191,52,200,129,187,224,219,200,103,155,53,4,37,
+1,237,131,148,124,123,152,135,140,41,36,36,42,91,133,30,29,140,97,148,45,
+115,37,110,94,146,120,132,254,248,205,184,206,54,52,95,136,126,122,140,176,
+182,134,122,126,0,0,1,0,122,252,244,5,181,1,40,0,19,0,0,1,47,4,1,7,39,55,
+22,23,23,22,22,23,23,22,22,23,5,92,104,128,140,141,131,254,147,66,175,159,
+39,62,139,83,175,83,179,100,252,68,252,244,87,106,115,115,106,1,35,74,142,
+188,29,49,110,67,142,68,147,82,215,62,0,0,1,0,100,252,222,2,46,1,2,0,21,0,
+0,1,22,22,51,21,34,38,39,35,6,21,7,20,18,23,7,38,2,53,52,54,55,1,11,52,128,
+98,99,141,47,8,4,1,132,181,104,175,179,24,19,1,2,52,51,155,47,37,22,18,28,
+176,254,178,225,83,170,1,153,220,57,153,51,0,1,255,176,0,0,2,175,3,109,0,
+32,0,0,49,34,38,53,52,54,51,33,38,2,39,35,34,38,39,53,22,22,51,51,21,20,18,
+22,51,51,21,35,34,38,39,35,7,33,47,47,33,1,170,40,54,8,15,38,85,31,38,78,
+38,158,44,78,88,10,10,68,104,40,4,35,41,36,36,42,85,1,34,192,3,3,149,3,2,
+57,183,254,207,172,155,42,53,95,0,1,255,176,0,0,2,93,3,109,0,24,0,0,49,34,
+38,53,52,54,51,33,38,2,39,35,34,38,39,53,22,22,51,51,21,20,18,23,7,33,47,
+47,33,1,170,3,88,11,15,38,85,31,38,78,38,158,77,61,50,41,36,36,42,11,1,61,
+239,3,3,149,3,2,112,151,254,141,128,110,0,3,0,100,255,251,7,115,3,207,0,35,
+0,47,0,59,0,0,37,31,2,55,38,38,53,52,54,51,50,22,23,23,54,54,51,50,22,21,
+20,4,35,34,38,39,7,33,34,38,39,55,22,22,51,37,22,22,51,50,54,53,52,38,35,
+34,2,7,54,54,53,52,38,35,34,6,21,20,22,2,94,42,147,47,6,126,121,220,151,159,
+191,4,8,44,119,87,135,188,254,242,251,91,176,82,84,254,50,159,200,32,92,54,
+156,135,2,98,58,124,78,162,185,102,86,131,242,180,53,117,104,91,101,133,127,
+155,1,5,3,6,72,209,146,158,238,148,128,3,53,54,185,145,234,244,33,30,58,86,
+74,123,77,51,26,19,19,168,150,85,103,254,109,19,66,223,128,88,98,138,107,
+123,181,0,0,3,0,100,255,251,7,243,3,207,0,46,0,58,0,70,0,0,37,31,2,55,38,
+38,53,52,54,51,50,22,23,23,54,54,51,50,22,21,20,6,7,22,22,51,21,34,38,39,
+35,6,6,35,34,38,39,7,33,34,38,39,55,22,22,51,37,22,22,51,50,54,53,52,38,35,
+34,2,7,54,54,53,52,38,35,34,6,21,20,22,2,94,42,147,47,6,126,121,220,151,159,
+191,4,8,44,119,87,135,188,33,30,27,97,67,98,146,37,9,68,182,109,91,176,82,
+84,254,50,159,200,32,92,54,156,135,2,98,58,124,78,162,185,102,86,131,242,
+180,53,117,104,91,101,133,127,155,1,5,3,6,72,209,146,158,238,148,128,3,53,
+54,185,145,82,132,53,25,26,155,51,44,52,48,33,30,58,86,74,123,77,51,26,19,
+19,168,150,85,103,254,109,19,66,223,128,88,98,138,107,123,181,0,0,3,255,176,
+255,251,6,36,3,207,0,45,0,57,0,69,0,0,55,31,2,55,38,38,53,52,54,51,50,22,
+23,23,54,54,51,50,22,21,20,6,7,22,22,51,21,34,38,39,35,6,6,35,34,38,39,7,
+33,34,38,53,52,54,51,37,22,22,51,50,54,53,52,38,35,34,2,7,54,54,53,52,38,
+35,34,6,21,20,22,143,42,147,47,6,126,121,220,151,159,191,4,8,44,119,87,135,
+188,33,30,27,97,67,98,146,37,9,68,182,109,91,176,82,84,254,22,33,47,47,33,
+2,172,58,124,78,162,185,102,86,131,242,180,53,117,104,91,101,133,127,155,
+1,5,3,6,72,209,146,158,238,148,128,3,53,54,185,145,82,132,53,25,26,155,51,
+44,52,48,33,30,58,41,36,36,42,26,19,19,168,150,85,103,254,109,19,66,223,128,
+88,98,138,107,123,181,0,0,3,255,176,255,251,5,164,3,207,0,34,0,46,0,58,0,
+0,4,38,39,7,33,34,38,53,52,54,51,51,31,2,55,38,38,53,52,54,51,50,22,23,23,
+54,54,51,50,22,21,20,4,33,39,22,22,51,50,54,53,52,38,35,34,2,7,54,54,53,52,
+38,35,34,6,21,20,22,3,64,176,82,84,254,22,33,47,47,33,143,42,147,47,6,126,
+121,220,151,159,191,4,8,44,119,87,135,188,254,247,255,0,239,58,124,78,162,
+185,102,86,131,242,180,53,117,104,91,101,133,127,5,33,30,58,41,36,36,42,1,
+5,3,6,72,209,146,158,238,148,128,3,53,54,185,145,229,249,186,19,19,168,150,
+85,103,254,109,19,66,223,128,88,98,138,107,123,181,0,3,0,140,254,234,5,160,
+3,207,0,24,0,37,0,50,0,0,37,38,2,53,52,54,51,50,22,21,23,54,54,51,50,22,21,
+20,4,35,34,38,39,3,39,1,22,22,51,50,54,53,52,38,35,34,6,7,7,55,54,54,53,52,
+38,35,34,6,21,20,22,1,246,173,189,223,152,156,186,8,60,123,63,135,194,254,
+242,251,73,143,69,165,116,1,98,60,113,60,162,185,108,86,89,138,76,218,89,
+31,31,104,88,103,135,141,78,76,1,3,169,158,235,157,130,3,66,56,190,144,234,
+244,19,18,254,202,58,1,140,17,16,168,150,85,107,140,162,130,184,63,107,59,
+89,107,138,104,121,190,0,3,0,144,254,234,6,31,3,207,0,35,0,48,0,61,0,0,37,
+6,6,35,34,38,39,3,39,19,38,2,53,52,54,51,50,22,21,23,54,54,51,50,22,21,20,
+6,7,22,22,51,21,34,38,39,37,55,54,54,53,52,38,35,34,6,21,20,22,5,22,22,51,
+50,54,53,52,38,35,34,6,7,5,2,68,182,109,73,143,69,165,116,149,173,189,223,
+152,156,186,8,60,123,63,135,194,33,30,26,97,63,95,144,37,253,53,89,31,31,
+104,88,103,135,141,1,17,60,113,60,162,185,108,86,89,138,76,95,52,48,19,18,
+254,202,58,1,42,76,1,3,169,158,235,157,130,3,66,56,190,144,82,132,53,25,26,
+155,51,44,126,184,63,107,59,89,107,138,104,121,190,101,17,16,168,150,85,107,
+140,162,255,255,255,176,255,251,6,36,3,207,16,6,0,71,0,0,255,255,255,176,
+255,251,5,164,3,207,18,6,0,72,0,0,0,1,0,100,255,246,6,71,4,31,0,30,0,0,33,
+34,38,39,55,22,22,51,33,38,38,39,1,55,1,22,22,51,50,54,55,51,23,6,6,35,34,
+38,39,35,7,1,235,159,200,32,92,52,161,142,2,28,17,45,17,254,18,133,1,253,
+84,77,47,55,81,26,5,76,32,137,80,74,103,44,4,39,86,74,123,74,54,20,55,25,
+2,198,90,253,38,124,56,67,56,100,89,89,54,50,94,0,0,1,0,100,0,0,5,26,4,31,
+0,23,0,0,33,34,38,39,55,22,22,51,33,38,38,39,1,55,1,22,22,51,21,34,38,39,
+35,7,1,235,159,200,32,92,52,161,142,2,28,17,44,17,254,17,133,1,253,68,60,
+22,42,83,44,4,39,86,74,123,74,54,20,55,25,2,198,90,253,38,99,71,155,46,48,
+94,0,1,255,176,0,0,3,95,4,31,0,22,0,0,37,38,38,39,1,55,1,22,22,51,21,34,38,
+39,35,7,33,34,38,53,52,54,51,2,132,17,44,17,254,17,133,1,253,68,60,22,42,
+83,44,4,39,253,117,33,47,47,33,155,20,55,25,2,198,90,253,38,99,71,155,46,
+48,94,41,36,36,42,0,1,255,176,255,246,4,141,4,31,0,29,0,0,37,38,38,39,1,55,
+1,22,22,51,50,54,55,51,23,6,6,35,34,38,39,35,7,33,34,38,53,52,54,51,2,133,
+17,45,17,254,18,133,1,253,84,77,47,55,81,26,5,76,32,137,80,74,103,44,4,39,
+253,116,33,47,47,33,155,20,55,25,2,198,90,253,38,124,56,67,56,100,89,89,54,
+50,94,41,36,36,42,0,0,2,0,100,0,0,5,115,4,182,0,19,0,27,0,0,1,55,1,7,33,34,
+38,39,55,22,22,51,33,39,33,34,38,53,52,36,19,33,3,6,6,21,20,22,3,192,148,
+1,31,67,252,187,159,200,32,92,54,156,135,2,178,67,254,186,175,198,1,0,135,
+1,13,122,188,188,114,4,134,48,251,209,135,86,74,123,77,51,253,176,151,162,
+219,253,205,1,202,25,133,101,103,96,0,2,0,100,0,0,5,200,4,182,0,29,0,37,0,
+0,37,39,33,34,38,53,52,36,55,55,19,22,22,51,51,21,35,34,38,39,35,7,33,34,
+38,39,55,22,22,51,1,33,3,6,6,21,20,22,4,204,69,254,187,175,198,1,0,243,148,
+249,11,29,46,37,36,78,88,24,4,40,253,49,159,200,32,92,54,156,135,1,59,1,13,
+122,188,188,114,155,253,176,151,162,219,42,48,252,98,40,85,155,55,42,97,86,
+74,123,77,51,1,142,1,202,25,133,101,103,96,0,0,2,255,176,0,0,4,105,4,182,
+0,28,0,36,0,0,37,39,33,34,38,53,52,36,55,55,19,22,22,51,51,21,35,34,38,39,
+35,7,33,34,38,53,52,54,51,1,33,3,6,6,21,20,22,3,109,69,254,187,175,198,1,
+9,235,147,249,11,29,46,37,36,78,88,24,4,40,252,165,33,47,47,33,1,245,1,13,
+122,188,188,114,155,253,176,151,166,219,38,48,252,98,40,85,155,55,42,97,41,
+36,36,42,1,142,1,202,25,133,101,103,96,0,2,255,176,0,0,4,20,4,182,0,18,0,
+26,0,0,1,55,1,7,33,34,38,53,52,54,51,33,39,33,34,38,53,52,36,19,33,3,6,6,
+21,20,22,2,97,148,1,31,67,252,47,33,47,47,33,3,108,67,254,186,175,198,1,0,
+135,1,13,122,188,188,114,4,134,48,251,209,135,41,36,36,42,253,176,151,162,
+219,253,205,1,202,25,133,101,103,96,0,0,3,0,100,0,0,5,126,5,94,0,47,0,51,
+0,55,0,0,37,50,22,23,55,38,38,53,52,36,51,50,22,21,20,6,35,34,38,53,52,55,
+51,20,22,51,50,54,53,52,38,35,34,6,21,20,4,33,51,7,33,34,38,39,55,22,22,51,
+19,51,21,35,37,51,21,35,2,76,33,71,35,3,106,114,1,4,198,169,230,151,141,117,
+135,1,121,73,57,71,77,144,111,131,176,1,114,1,73,46,45,252,154,159,200,32,
+92,54,156,135,160,167,167,1,122,167,167,155,2,2,7,65,215,139,193,247,184,
+138,144,164,132,115,13,7,64,68,87,74,83,101,156,127,216,224,144,86,74,123,
+77,51,4,195,175,175,175,0,0,3,0,100,0,0,5,223,5,94,0,47,0,51,0,55,0,0,37,
+50,22,23,55,38,38,53,52,36,51,50,22,21,20,6,35,34,38,53,52,55,51,20,22,51,
+50,54,53,52,38,35,34,6,21,20,4,33,51,21,33,34,38,39,55,22,22,51,19,51,21,
+35,37,51,21,35,2,76,33,71,35,3,106,114,1,4,198,169,230,151,141,117,135,1,
+121,73,57,71,77,144,111,131,176,1,88,1,59,183,252,12,159,200,32,92,54,156,
+135,160,167,167,1,122,167,167,155,2,2,7,65,215,139,193,247,184,138,144,164,
+132,115,13,7,63,69,87,74,83,101,156,127,211,218,155,86,74,123,77,51,4,195,
+175,175,175,0,3,255,176,0,0,4,96,5,94,0,46,0,50,0,54,0,0,37,38,38,53,52,36,
+51,50,22,21,20,6,35,34,38,53,52,55,51,20,22,51,50,54,53,52,38,35,34,6,21,
+20,4,33,51,21,33,34,38,53,52,54,51,51,50,22,23,3,51,21,35,37,51,21,35,1,91,
+106,114,1,4,198,169,230,151,141,117,135,1,121,73,57,71,77,144,111,131,176,
+1,88,1,59,183,251,160,33,47,47,33,205,33,71,35,32,167,167,1,122,167,167,158,
+65,215,139,193,247,184,138,144,164,132,115,13,7,63,69,87,74,83,101,156,127,
+211,218,155,41,36,36,42,2,2,4,199,175,175,175,0,3,255,176,0,0,3,255,5,94,
+0,46,0,50,0,54,0,0,55,50,22,23,55,38,38,53,52,36,51,50,22,21,20,6,35,34,38,
+53,52,55,51,20,22,51,50,54,53,52,38,35,34,6,21,20,4,33,51,7,33,34,38,53,52,
+54,51,1,51,21,35,37,51,21,35,205,33,71,35,3,106,114,1,4,198,169,230,151,141,
+117,135,1,121,73,57,71,77,144,111,131,176,1,114,1,73,46,45,252,46,33,47,47,
+33,1,56,167,167,1,122,167,167,155,2,2,7,65,215,139,193,247,184,138,144,164,
+132,115,13,7,64,68,87,74,83,101,156,127,216,224,144,41,36,36,42,4,195,175,
+175,175,0,1,0,141,252,244,4,81,1,141,0,35,0,0,1,38,0,53,52,54,55,55,22,22,
+51,50,54,55,51,19,7,39,35,6,35,34,38,39,7,23,20,0,5,7,33,53,51,50,22,23,2,
+180,227,254,218,14,22,130,17,148,103,91,130,33,124,122,130,68,6,79,229,103,
+159,31,8,7,1,74,1,55,29,252,254,233,66,163,87,253,114,90,1,184,250,71,128,
+69,3,90,152,113,128,254,159,42,219,220,125,104,1,40,252,254,73,157,120,140,
+11,11,0,1,0,141,252,244,4,115,1,141,0,41,0,0,1,50,22,23,55,38,0,53,52,54,
+55,55,22,22,51,50,54,55,51,23,22,22,51,21,34,38,39,39,6,6,35,34,38,39,7,23,
+20,0,5,7,33,53,1,118,66,163,87,2,227,254,218,14,22,130,17,148,103,91,119,
+33,120,48,25,58,40,82,106,38,25,40,142,113,103,159,31,8,7,1,74,1,55,29,252,
+254,253,128,11,11,8,90,1,184,250,71,128,69,3,90,152,113,128,117,60,64,155,
+78,84,48,111,99,125,104,1,40,252,254,73,157,120,140,0,2,0,100,0,0,6,135,3,
+130,0,26,0,39,0,0,37,38,53,17,22,22,51,51,50,54,55,17,7,33,34,38,39,35,7,
+33,34,38,39,55,22,22,51,1,34,38,39,17,20,22,51,33,17,6,6,35,3,48,13,38,182,
+94,240,94,182,38,80,253,218,74,97,28,4,36,254,201,159,200,32,92,54,156,135,
+2,78,37,92,45,41,70,1,201,45,92,37,155,46,62,2,123,9,17,17,9,252,236,110,
+49,45,94,86,74,123,77,51,2,55,5,4,254,57,70,51,2,64,5,4,0,0,2,0,100,0,0,7,
+94,3,130,0,36,0,51,0,0,37,38,53,17,22,22,51,51,50,54,55,17,20,22,51,51,21,
+35,34,38,39,35,7,33,34,38,39,35,7,33,34,38,39,55,22,22,51,33,38,53,17,6,6,
+35,35,34,38,39,17,20,22,51,3,48,13,38,182,94,240,94,182,38,44,68,103,126,
+75,97,27,4,35,254,31,74,97,28,4,36,254,201,159,200,32,92,54,156,135,3,229,
+13,45,92,37,220,37,92,45,41,70,155,46,62,2,123,9,17,17,9,253,146,72,49,155,
+49,45,94,49,45,94,86,74,123,77,51,46,62,1,212,5,4,5,4,254,57,70,51,0,2,255,
+176,0,0,5,18,3,130,0,35,0,50,0,0,49,34,38,53,52,54,51,51,38,53,17,22,22,51,
+51,50,54,55,17,20,22,51,51,21,35,34,38,39,35,7,33,34,38,39,35,7,37,38,53,
+17,6,6,35,35,34,38,39,17,20,22,51,33,47,47,33,228,13,38,182,94,240,94,182,
+38,44,68,103,126,75,97,27,4,35,254,31,74,96,28,4,37,2,220,13,45,92,37,220,
+37,92,45,41,70,41,36,36,42,46,62,2,123,9,17,17,9,253,146,72,49,155,49,45,
+94,49,45,94,155,46,62,1,212,5,4,4,5,254,57,70,51,0,2,255,176,0,0,4,59,3,130,
+0,25,0,38,0,0,49,34,38,53,52,54,51,51,38,53,17,22,22,51,51,50,54,55,17,7,
+33,34,38,39,35,7,1,34,38,39,17,20,22,51,33,17,6,6,35,33,47,47,33,228,13,38,
+182,94,240,94,182,38,80,253,218,74,96,28,4,37,1,69,37,92,45,41,70,1,201,45,
+92,37,41,36,36,42,46,62,2,123,9,17,17,9,252,236,110,49,45,94,2,210,4,5,254,
+57,70,51,2,64,5,4,255,255,0,160,0,0,3,158,4,220,16,39,1,40,1,254,4,11,16,
+6,0,28,0,0,255,255,0,160,0,0,4,37,4,220,16,39,1,40,1,254,4,11,16,6,0,29,0,
+0,0,1,0,100,0,0,7,95,3,133,0,38,0,0,1,22,22,51,50,54,55,23,6,6,7,17,20,22,
+22,51,33,21,33,34,38,39,35,7,33,34,38,39,55,22,22,51,33,38,53,17,38,38,39,
+3,132,42,210,162,162,210,42,29,43,214,111,29,51,65,1,97,254,146,73,112,36,
+4,36,252,255,159,200,32,92,54,156,135,2,217,27,111,214,43,3,133,18,36,36,
+18,146,23,33,2,254,163,77,80,36,155,43,51,94,86,74,123,77,51,70,110,1,106,
+2,33,23,0,0,1,0,100,0,0,7,100,3,133,0,38,0,0,37,38,53,17,38,38,39,55,22,22,
+51,50,54,55,23,6,6,7,17,20,22,22,51,33,21,33,34,38,39,35,7,33,34,38,39,55,
+22,22,51,4,242,27,111,214,43,29,42,210,162,162,210,42,29,43,214,111,29,51,
+65,1,102,254,141,73,112,36,4,36,252,255,159,200,32,92,54,156,135,155,70,110,
+1,106,2,33,23,146,18,36,36,18,146,23,33,2,254,163,77,80,36,155,43,51,94,86,
+74,123,77,51,0,1,255,176,0,0,4,132,3,133,0,37,0,0,49,34,38,53,52,54,51,33,
+38,53,17,38,38,39,55,22,22,51,50,54,55,23,6,6,7,17,20,22,22,51,33,21,33,34,
+38,39,35,7,33,47,47,33,2,18,27,111,214,43,29,42,210,162,162,210,42,29,43,
+214,111,29,51,65,1,102,254,141,73,112,36,4,36,41,36,36,42,70,110,1,106,2,
+33,23,146,18,36,36,18,146,23,33,2,254,163,77,80,36,155,43,51,94,0,1,255,176,
+0,0,4,107,3,133,0,37,0,0,49,34,38,53,52,54,51,33,38,53,17,38,38,39,55,22,
+22,51,50,54,55,23,6,6,7,17,20,22,22,51,33,21,33,34,38,39,35,7,33,47,47,33,
+2,18,27,111,214,43,29,42,210,162,162,210,42,29,43,214,111,29,51,65,1,77,254,
+166,73,112,36,4,35,41,36,36,42,70,110,1,106,2,33,23,146,18,36,36,18,146,23,
+33,2,254,163,77,80,36,155,43,51,94,0,1,0,140,255,237,5,52,4,88,0,30,0,0,5,
+1,6,2,21,23,20,22,23,54,54,51,50,22,23,7,38,38,35,34,6,35,34,38,53,52,18,
+55,55,1,7,4,190,253,96,100,150,2,5,4,59,133,54,140,164,27,165,20,75,65,65,
+162,47,65,76,235,97,118,2,230,113,19,3,162,216,254,92,86,24,7,13,3,40,48,
+116,115,4,38,40,73,84,79,146,2,86,199,6,252,6,113,0,1,0,140,255,251,5,0,4,
+88,0,35,0,0,37,22,22,51,21,34,38,39,1,6,2,21,23,20,22,23,54,54,51,50,22,23,
+7,38,38,35,34,6,35,34,38,53,52,18,55,55,4,221,9,15,11,51,85,31,253,196,105,
+145,2,5,4,60,134,53,140,164,27,165,20,75,65,65,162,47,65,76,235,97,118,181,
+12,14,155,54,45,3,43,234,254,111,86,24,7,13,3,41,47,116,115,4,38,40,73,84,
+79,146,2,86,199,6,0,1,0,100,0,0,5,169,5,15,0,30,0,0,1,1,23,7,7,6,7,7,21,50,
+54,55,55,33,17,7,33,34,38,39,55,22,22,51,33,17,35,39,34,38,39,2,152,1,136,
+121,158,38,20,20,78,11,56,32,99,1,132,80,252,146,159,200,32,92,54,156,135,
+2,250,242,92,88,130,33,3,80,1,191,93,171,40,21,20,75,8,3,1,1,253,6,110,86,
+74,123,77,51,2,55,1,7,7,0,0,1,0,100,0,0,6,128,5,17,0,39,0,0,37,38,53,17,33,
+53,1,23,7,7,6,7,7,21,50,54,55,55,33,17,20,22,22,51,51,21,35,34,38,39,35,7,
+33,34,38,39,55,22,22,51,5,46,27,253,133,1,137,120,160,38,20,20,78,11,56,32,
+98,1,135,29,51,65,70,83,73,112,36,4,36,252,195,159,200,32,92,54,156,135,155,
+70,110,1,131,126,1,193,95,171,40,21,20,75,8,3,1,1,253,244,77,80,36,155,43,
+51,94,86,74,123,77,51,0,1,255,176,0,0,4,153,5,17,0,38,0,0,49,34,38,53,52,
+54,51,33,38,53,17,33,53,1,23,7,7,6,7,7,21,50,54,55,55,33,17,20,22,22,51,51,
+21,35,34,38,39,35,7,33,47,47,33,3,71,27,253,133,1,137,120,160,38,20,20,78,
+11,56,32,98,1,135,29,51,65,70,83,73,112,36,4,36,41,36,36,42,70,110,1,131,
+126,1,193,95,171,40,21,20,75,8,3,1,1,253,244,77,80,36,155,43,51,94,0,1,255,
+176,0,0,3,194,5,17,0,25,0,0,19,1,23,7,7,6,7,7,21,50,54,55,55,33,17,7,33,34,
+38,53,52,54,51,33,17,33,177,1,137,120,160,38,20,20,78,11,56,32,98,1,135,80,
+252,142,33,47,47,33,3,44,253,133,3,80,1,193,95,171,40,21,20,75,8,3,1,1,253,
+6,110,41,36,36,42,2,55,0,0,1,0,100,254,20,7,64,5,140,0,39,0,0,1,3,33,34,38,
+39,55,22,22,51,33,1,55,19,22,22,51,50,54,53,52,38,39,39,55,23,22,22,21,20,
+6,35,34,38,39,7,1,51,21,35,6,123,161,252,17,159,200,32,92,52,161,142,3,34,
+253,153,144,167,22,62,52,48,61,18,19,67,129,65,25,30,110,103,14,36,16,7,2,
+100,95,197,254,200,1,56,86,74,123,74,54,4,171,70,254,187,41,48,49,45,26,64,
+35,127,68,126,49,95,45,98,123,5,7,4,251,100,204,0,0,1,0,100,254,20,7,1,5,
+140,0,47,0,0,37,1,55,19,22,22,51,50,54,53,52,38,39,39,55,23,22,22,21,20,6,
+35,34,38,39,7,1,22,22,51,21,35,19,51,21,35,53,3,35,7,33,34,38,39,55,22,22,
+51,5,70,253,153,144,166,22,62,52,48,61,18,19,67,129,65,25,30,110,103,14,36,
+16,7,1,63,35,38,24,17,150,95,197,209,4,37,252,169,159,200,32,92,52,161,142,
+155,4,170,71,254,187,41,48,49,45,26,64,35,127,68,126,49,95,45,98,123,5,7,
+4,253,151,67,53,155,254,224,204,180,1,150,94,86,74,123,74,54,0,1,255,176,
+254,20,3,242,5,140,0,46,0,0,1,3,35,7,33,34,38,53,52,54,51,33,1,55,19,22,22,
+51,50,54,53,52,38,39,39,55,23,22,22,21,20,6,35,34,38,39,7,1,22,22,51,21,35,
+19,51,21,35,3,45,209,4,37,253,205,33,47,47,33,2,55,253,153,144,167,22,62,
+52,48,61,18,19,67,129,65,25,30,110,103,14,36,16,7,1,62,35,38,24,17,150,95,
+197,254,200,1,150,94,41,36,36,42,4,171,70,254,187,41,48,49,45,26,64,35,127,
+68,126,49,95,45,98,123,5,7,4,253,151,67,53,155,254,224,204,0,0,1,255,176,
+254,20,4,50,5,140,0,38,0,0,1,3,33,34,38,53,52,54,51,33,1,55,19,22,22,51,50,
+54,53,52,38,39,39,55,23,22,22,21,20,6,35,34,38,39,7,1,51,21,35,3,109,161,
+253,52,33,47,47,33,2,55,253,153,144,167,22,62,52,48,61,18,19,67,129,65,25,
+30,110,103,14,36,16,7,2,100,95,197,254,200,1,56,41,36,36,42,4,171,70,254,
+187,41,48,49,45,26,64,35,127,68,126,49,95,45,98,123,5,7,4,251,100,204,255,
+255,0,116,254,185,5,1,3,113,16,39,1,40,0,198,255,232,16,39,1,40,1,128,254,
+151,16,7,0,28,1,99,0,0,255,255,0,116,254,185,5,136,3,113,16,39,0,29,1,99,
+0,0,16,39,1,40,1,128,254,151,16,7,1,40,0,198,255,232,0,1,0,140,253,28,4,30,
+1,247,0,14,0,0,1,38,2,3,51,18,18,23,18,18,55,51,2,0,7,1,243,100,222,37,147,
+55,146,96,144,165,20,141,27,254,240,135,253,28,219,2,246,1,10,254,225,253,
+245,245,1,5,2,49,233,254,165,253,59,187,0,1,0,140,253,28,4,170,1,247,0,26,
+0,0,1,38,2,3,51,18,18,23,18,18,55,51,6,6,7,22,22,51,23,21,34,38,39,35,6,2,
+7,1,243,100,222,37,147,55,146,96,144,165,20,141,6,23,16,18,78,44,45,84,98,
+29,6,56,205,96,253,28,219,2,246,1,10,254,225,253,245,245,1,5,2,49,233,87,
+152,72,18,18,1,155,34,32,212,254,51,133,0,1,0,100,0,0,5,169,5,59,0,42,0,0,
+37,17,33,34,38,39,53,22,23,23,22,22,51,50,54,53,52,38,39,39,55,23,22,22,21,
+20,6,7,23,54,54,51,51,17,7,33,34,38,39,55,22,22,51,5,19,254,215,137,202,35,
+24,32,62,30,52,14,92,69,67,73,137,45,153,123,110,36,35,3,35,71,33,221,80,
+252,146,159,200,32,92,54,156,135,155,2,55,15,9,146,4,3,5,3,2,68,63,62,63,
+24,45,139,51,42,124,87,51,87,22,7,2,2,253,6,110,86,74,123,77,51,0,1,0,100,
+0,0,6,128,5,59,0,55,0,0,37,38,53,17,33,34,38,39,53,22,23,23,22,22,51,50,54,
+53,52,38,39,39,55,23,22,22,21,20,6,7,23,54,54,51,51,17,20,22,22,51,51,21,
+35,34,38,39,35,7,33,34,38,39,55,22,22,51,5,46,27,254,215,137,202,35,24,32,
+62,30,52,14,92,69,67,73,137,45,153,123,110,36,35,3,35,71,33,221,29,51,65,
+70,83,73,112,36,4,36,252,195,159,200,32,92,54,156,135,155,70,110,1,131,15,
+9,146,4,3,5,3,2,68,63,62,63,24,45,139,51,42,124,87,51,87,22,7,2,2,253,244,
+77,80,36,155,43,51,94,86,74,123,77,51,0,0,1,255,176,0,0,4,153,5,59,0,54,0,
+0,49,34,38,53,52,54,51,33,38,53,17,33,34,38,39,53,22,23,23,22,22,51,50,54,
+53,52,38,39,39,55,23,22,22,21,20,6,7,23,54,54,51,51,17,20,22,22,51,51,21,
+35,34,38,39,35,7,33,47,47,33,3,71,27,254,214,137,202,35,24,32,62,30,52,14,
+92,69,67,73,137,45,153,123,110,36,35,3,35,71,33,222,29,51,65,70,83,73,112,
+36,4,36,41,36,36,42,70,110,1,131,15,9,146,4,3,5,3,2,68,63,62,63,24,45,139,
+51,42,124,87,51,87,22,7,2,2,253,244,77,80,36,155,43,51,94,0,0,1,255,176,0,
+0,3,194,5,59,0,41,0,0,49,34,38,53,52,54,51,33,17,33,34,38,39,53,22,23,23,
+22,22,51,50,54,53,52,38,39,39,55,23,22,22,21,20,6,7,23,54,54,51,51,17,7,33,
+47,47,33,3,44,254,214,137,202,35,24,32,62,30,52,14,92,69,67,73,137,45,153,
+123,110,36,35,3,35,71,33,222,80,41,36,36,42,2,55,15,9,146,4,3,5,3,2,68,63,
+62,63,24,45,139,51,42,124,87,51,87,22,7,2,2,253,6,110,0,2,0,100,255,250,5,
+45,4,1,0,32,0,44,0,0,33,34,38,39,55,22,22,51,33,50,54,55,1,55,19,51,54,54,
+51,50,22,21,20,6,7,7,19,7,39,35,6,6,35,18,6,21,20,22,51,50,54,53,52,38,35,
+1,235,159,200,32,92,52,161,142,1,95,72,80,12,254,42,126,169,7,25,87,58,89,
+109,105,79,4,251,128,53,6,26,121,115,143,54,57,42,44,56,57,43,86,74,123,74,
+54,24,25,2,223,86,254,248,51,51,106,87,86,107,4,5,254,125,87,83,37,40,3,4,
+55,50,50,55,55,50,50,55,0,0,2,0,100,0,0,5,69,4,1,0,37,0,49,0,0,33,34,38,39,
+55,22,22,51,33,50,54,55,1,55,19,51,54,54,51,50,22,21,20,6,7,7,23,22,22,51,
+21,34,38,39,35,6,6,35,18,6,21,20,22,51,50,54,53,52,38,35,1,235,159,200,32,
+92,52,161,142,1,95,73,79,12,254,42,126,169,7,25,87,58,89,109,105,79,4,140,
+32,66,37,65,96,38,4,27,130,113,143,54,57,42,44,56,57,43,86,74,123,74,54,25,
+25,2,222,86,254,248,51,51,106,87,86,107,4,5,216,51,46,155,45,44,48,41,3,4,
+55,50,50,55,55,50,50,55,0,2,255,176,0,0,3,149,4,1,0,36,0,48,0,0,49,34,38,
+53,52,54,51,33,50,54,55,1,55,19,51,54,54,51,50,22,21,20,6,7,7,23,22,22,51,
+21,34,38,39,35,6,6,35,18,6,21,20,22,51,50,54,53,52,38,35,33,47,47,33,1,210,
+75,77,12,254,42,126,169,7,25,87,58,89,109,105,79,4,140,32,66,37,65,96,38,
+4,27,130,113,143,54,57,42,44,56,57,43,41,36,36,42,26,24,2,222,86,254,248,
+51,51,106,87,86,107,4,5,216,51,46,155,45,44,48,41,3,4,55,50,50,55,55,50,50,
+55,0,0,2,255,176,255,250,3,125,4,1,0,31,0,43,0,0,37,35,6,6,35,33,34,38,53,
+52,54,51,33,50,54,55,1,55,19,51,54,54,51,50,22,21,20,6,7,7,19,7,2,6,21,20,
+22,51,50,54,53,52,38,35,2,200,6,26,121,115,254,68,33,47,47,33,1,210,72,80,
+12,254,42,126,169,7,25,87,58,89,109,105,79,4,251,128,178,54,57,42,44,56,57,
+43,77,37,40,41,36,36,42,24,25,2,223,86,254,248,51,51,106,87,86,107,4,5,254,
+125,87,3,10,55,50,50,55,55,50,50,55,0,0,1,0,110,0,15,3,53,2,240,0,24,0,0,
+37,21,33,53,51,53,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,22,51,
+3,53,253,57,194,64,61,218,156,47,118,54,46,84,73,110,132,75,111,100,155,140,
+129,6,42,126,74,159,201,15,24,122,23,118,101,69,116,55,0,0,1,255,176,0,0,
+3,9,0,155,0,8,0,0,33,33,34,38,53,52,54,51,33,3,9,252,247,33,47,47,33,3,9,
+41,36,36,42,0,255,255,0,246,255,252,3,196,2,225,16,39,1,43,2,91,2,9,16,39,
+1,43,2,91,255,225,16,39,1,43,3,104,0,245,16,7,1,43,1,79,0,245,255,255,0,171,
+2,36,1,96,2,225,16,7,1,43,1,4,2,9,255,255,0,171,255,47,1,96,255,236,16,7,
+1,43,1,4,255,20,255,255,0,192,1,187,1,117,3,212,16,39,1,43,1,25,2,252,16,
+7,1,43,1,25,1,160,255,255,0,171,254,160,1,96,0,185,16,39,1,43,1,4,255,225,
+16,7,1,43,1,4,254,133,255,255,0,171,2,170,2,186,3,103,16,39,1,43,1,4,2,143,
+16,7,1,43,2,94,2,143,255,255,0,171,255,252,2,20,2,19,16,39,1,43,1,4,1,59,
+16,7,1,43,1,184,255,225,255,255,0,171,255,252,2,20,2,19,16,39,1,43,1,184,
+1,59,16,7,1,43,1,4,255,225,255,255,0,171,1,188,2,20,3,212,16,39,1,43,1,4,
+2,252,16,7,1,43,1,184,1,161,255,255,0,171,254,161,2,20,0,185,16,39,1,43,1,
+4,255,225,16,7,1,43,1,184,254,134,0,3,0,245,0,0,3,173,4,150,0,23,0,27,0,31,
+0,0,1,50,54,53,53,51,21,20,22,51,51,50,54,53,53,51,21,20,22,51,51,21,33,53,
+1,51,21,35,17,51,21,35,1,51,45,44,90,47,46,28,46,47,90,44,45,62,253,72,1,
+3,181,181,181,181,3,228,38,41,99,99,41,38,38,41,99,99,41,38,125,125,254,166,
+189,254,240,189,0,2,0,244,3,57,6,110,5,45,0,3,0,7,0,0,19,33,21,33,5,51,21,
+35,244,5,122,250,134,2,99,181,181,5,45,125,186,189,0,1,1,4,2,128,4,138,6,
+7,0,12,0,0,1,55,1,55,1,55,51,22,22,21,34,38,39,3,99,128,253,33,74,2,223,70,
+10,7,6,76,143,76,2,151,71,2,226,71,253,33,132,77,146,77,6,7,0,5,0,225,0,142,
+5,48,5,5,0,11,0,15,0,19,0,23,0,27,0,0,1,33,53,33,17,51,17,33,21,33,17,35,
+19,51,21,35,37,51,21,35,1,51,21,35,37,51,21,35,2,212,254,13,1,243,105,1,243,
+254,13,105,224,167,167,254,1,167,167,1,255,167,167,254,1,167,167,2,149,105,
+2,7,253,249,105,253,249,3,148,175,175,175,254,172,175,175,175,0,0,1,255,80,
+255,71,0,199,6,129,0,7,0,0,7,17,35,53,33,21,35,17,26,150,1,119,150,185,6,
+244,70,70,249,12,0,2,255,13,4,67,0,229,5,254,0,6,0,15,0,0,19,23,1,39,55,19,
+5,7,54,55,53,39,7,23,54,55,180,49,254,89,49,60,4,1,47,108,19,19,163,7,5,8,
+16,5,254,53,254,122,53,54,1,53,24,102,17,15,5,9,165,1,10,15,0,2,255,26,254,
+87,0,242,0,18,0,6,0,15,0,0,3,39,1,23,7,3,37,55,6,7,21,23,55,39,6,7,181,49,
+1,167,49,60,4,254,209,108,19,19,163,7,5,8,16,254,87,53,1,134,53,54,254,203,
+24,102,17,15,5,9,165,1,10,15,255,255,255,172,255,21,0,86,5,84,16,39,1,41,
+0,22,4,84,16,7,1,41,255,238,255,9,0,2,255,78,4,63,0,160,6,6,0,14,0,27,0,0,
+18,22,21,20,6,7,7,39,55,38,38,53,52,54,51,3,54,54,53,52,38,35,34,6,21,20,
+22,23,93,67,85,132,79,42,90,18,17,80,73,52,53,52,31,26,37,39,13,11,6,6,73,
+54,61,120,92,55,58,66,40,70,40,77,104,254,227,41,70,39,28,33,62,45,29,55,
+20,0,0,2,255,97,254,73,0,179,0,16,0,14,0,27,0,0,2,38,53,52,54,55,55,23,7,
+22,22,21,20,6,35,19,6,6,21,20,22,51,50,54,53,52,38,39,92,67,85,133,78,42,
+90,18,17,81,72,52,53,52,31,26,36,40,13,11,254,73,73,54,61,120,93,54,58,66,
+40,70,40,78,103,1,29,41,70,39,28,33,60,47,29,55,20,0,0,2,255,136,4,93,0,125,
+6,36,0,11,0,23,0,0,18,22,21,20,6,35,34,38,53,52,54,51,38,22,21,20,6,35,34,
+38,53,52,54,51,100,25,99,39,23,24,98,40,38,25,99,39,23,24,98,40,5,51,28,19,
+38,129,27,20,39,128,241,28,19,38,129,27,20,39,128,0,0,1,255,9,4,82,0,228,
+5,168,0,23,0,0,3,54,54,51,50,22,21,20,6,7,39,54,54,53,52,38,39,7,39,55,39,
+34,6,7,247,49,122,83,95,126,8,5,73,3,6,31,31,77,71,77,15,56,85,39,4,220,110,
+94,111,131,26,53,21,17,16,46,14,65,74,18,204,23,203,1,75,86,0,1,255,28,254,
+173,0,247,0,3,0,23,0,0,23,6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,23,55,
+23,7,23,50,54,55,247,49,122,83,95,126,8,5,73,3,6,31,31,77,71,77,15,62,81,
+37,135,110,94,111,131,26,53,21,17,16,46,14,65,74,18,204,23,203,1,81,80,0,
+255,255,255,80,255,21,0,177,0,9,16,39,1,41,255,146,255,9,16,7,1,41,0,113,
+255,9,255,255,255,88,254,157,0,180,0,39,16,39,1,41,255,154,254,145,16,7,1,
+41,0,116,255,39,0,1,255,16,4,67,0,226,5,253,0,11,0,0,19,23,1,39,55,39,7,39,
+1,23,7,23,178,48,254,205,47,127,64,126,49,1,51,49,126,64,5,128,50,254,245,
+51,111,72,109,52,1,9,50,110,73,0,0,1,255,30,254,87,0,240,0,18,0,11,0,0,3,
+39,1,23,7,23,55,23,1,39,55,39,178,48,1,51,47,127,64,126,49,254,204,48,126,
+64,254,213,50,1,11,52,110,72,109,52,254,246,51,110,73,0,255,255,255,190,255,
+1,0,64,255,245,18,7,1,41,0,0,254,245,0,2,255,42,4,85,0,213,6,25,0,7,0,11,
+0,0,19,7,39,7,39,1,23,7,7,51,21,35,213,55,162,154,56,1,44,57,97,100,102,102,
+4,202,52,177,171,45,1,80,44,110,186,112,0,2,255,42,254,60,0,214,0,0,0,7,0,
+11,0,0,7,55,23,55,23,1,39,55,55,35,53,51,214,56,162,155,55,254,211,56,96,
+101,102,102,117,52,177,171,45,254,176,44,110,186,112,0,255,255,255,190,4,
+97,0,64,5,85,18,7,1,41,0,0,4,85,255,255,254,253,255,54,0,253,255,229,16,39,
+1,40,255,79,255,20,16,7,1,40,0,168,255,20,255,255,255,160,4,130,0,35,5,13,
+16,7,1,42,255,226,4,114,255,255,255,160,255,73,0,35,255,212,16,7,1,42,255,
+226,255,57,255,255,255,191,4,101,0,66,5,238,16,39,1,42,0,1,4,85,16,7,1,42,
+0,1,5,83,255,255,255,191,254,106,0,66,255,243,16,39,1,42,0,1,254,90,16,7,
+1,42,0,1,255,88,255,255,255,51,4,101,0,207,5,238,16,39,1,42,0,142,4,85,16,
+39,1,42,0,1,5,83,16,7,1,42,255,117,4,85,255,255,255,51,254,106,0,207,255,
+243,16,39,1,42,0,142,255,88,16,39,1,42,0,1,254,90,16,7,1,42,255,117,255,88,
+0,1,255,2,4,89,0,253,5,35,0,3,0,0,19,23,5,39,228,25,254,31,26,5,35,79,123,
+81,0,1,255,3,255,50,0,254,255,252,0,3,0,0,7,39,37,23,228,25,1,225,26,206,
+79,123,81,0,0,1,254,159,4,87,1,105,6,58,0,43,0,0,3,23,7,23,55,23,7,23,55,
+23,7,23,55,23,7,23,55,23,7,23,7,39,7,39,55,39,7,39,55,39,7,39,55,39,7,39,
+55,39,7,39,55,39,55,23,132,43,57,48,57,43,58,49,58,41,58,49,59,41,59,49,59,
+41,59,147,27,146,61,42,61,48,61,42,61,48,61,42,61,49,62,42,63,49,62,42,63,
+139,27,137,6,58,24,100,28,101,26,100,27,100,23,102,28,102,25,100,28,101,24,
+102,85,43,83,105,24,106,28,106,25,104,28,105,23,107,27,104,23,106,29,107,
+24,106,81,44,80,0,0,5,255,7,4,85,0,247,6,87,0,11,0,15,0,19,0,23,0,27,0,0,
+3,35,53,51,53,51,21,51,21,35,21,35,19,51,21,35,39,51,21,35,21,51,21,35,55,
+51,21,35,25,224,224,49,223,223,49,107,76,76,241,76,76,76,76,241,76,76,5,62,
+48,233,233,48,233,1,161,78,78,78,164,78,78,78,0,1,254,245,4,84,1,12,5,11,
+0,19,0,0,18,54,55,51,6,6,35,34,38,35,34,6,7,35,54,54,51,50,22,51,151,34,8,
+75,8,82,68,48,140,37,35,34,7,76,9,82,68,52,139,33,4,181,39,45,88,93,85,39,
+45,88,94,86,0,1,254,251,4,103,1,5,4,191,0,3,0,0,1,33,21,33,254,251,2,10,253,
+246,4,191,88,0,255,255,255,172,4,119,0,83,5,38,16,7,1,40,255,254,4,85,255,
+255,254,253,4,119,0,253,5,38,16,39,1,40,255,79,4,85,16,7,1,40,0,168,4,85,
+0,2,255,147,4,119,0,109,5,79,0,3,0,7,0,0,3,51,21,35,55,51,53,35,109,218,218,
+58,101,101,5,79,216,54,108,0,255,255,255,173,255,48,0,84,255,223,16,7,1,40,
+255,255,255,14,255,255,254,253,255,54,0,253,255,229,16,39,1,40,255,79,255,
+20,16,7,1,40,0,168,255,20,0,2,255,147,255,4,0,109,255,220,0,3,0,7,0,0,7,51,
+21,35,55,51,53,35,109,218,218,58,101,101,36,216,54,108,0,1,255,11,255,51,
+0,245,0,0,0,19,0,0,7,55,55,54,55,55,51,22,22,23,23,21,35,38,39,39,7,6,7,35,
+245,51,53,27,25,46,89,29,80,40,50,103,31,38,75,77,40,35,91,196,47,51,26,26,
+46,32,79,38,47,9,24,33,65,63,32,27,0,1,254,253,255,132,1,6,0,101,0,13,0,0,
+55,51,6,6,35,34,38,39,51,22,22,51,50,54,183,79,8,147,111,113,137,5,79,14,
+90,76,78,94,101,101,124,117,108,64,66,73,0,1,254,244,255,74,1,11,0,2,0,19,
+0,0,6,6,7,35,54,54,51,50,22,51,50,54,55,51,6,6,35,34,38,35,151,35,8,74,8,
+82,68,48,140,37,35,34,7,76,9,82,68,52,138,34,97,38,45,88,94,85,38,45,88,94,
+85,0,0,1,254,251,255,150,1,5,255,238,0,3,0,0,5,33,53,33,1,5,253,246,2,10,
+106,88,0,2,255,56,4,77,0,191,5,190,0,3,0,7,0,0,19,23,5,39,1,23,5,39,188,3,
+254,135,3,1,110,3,254,135,3,5,34,71,142,71,1,42,72,142,72,0,0,2,255,18,4,
+76,0,189,5,188,0,31,0,44,0,0,3,23,63,2,53,38,38,53,52,54,51,50,22,21,20,6,
+7,7,39,54,54,53,52,38,39,39,50,22,21,20,6,54,22,23,55,54,54,53,52,38,35,34,
+6,21,133,1,29,33,60,20,25,75,53,48,68,113,158,113,6,10,8,25,27,3,51,67,5,
+136,23,20,7,24,35,29,23,23,34,4,168,4,14,15,25,4,16,48,31,53,74,63,50,71,
+83,59,42,67,14,28,16,20,34,2,68,54,51,12,27,114,36,11,3,10,35,26,23,28,30,
+26,0,2,255,56,254,154,0,191,0,11,0,3,0,7,0,0,23,23,5,39,1,23,5,39,188,3,254,
+135,3,1,110,3,254,135,3,145,71,142,71,1,42,72,142,72,0,1,255,67,4,77,0,191,
+5,34,0,3,0,0,19,23,5,39,188,3,254,135,3,5,34,71,142,71,0,2,255,61,4,77,0,
+184,5,184,0,18,0,31,0,0,3,54,55,55,54,55,53,38,38,53,52,54,51,50,22,21,20,
+6,7,54,22,23,55,54,54,53,52,38,35,34,6,21,195,15,22,94,24,20,21,28,79,54,
+48,72,138,238,192,25,20,7,32,32,28,29,24,35,4,150,5,8,35,9,8,4,16,43,33,54,
+75,63,50,78,90,82,212,35,11,2,15,35,23,20,29,30,26,0,0,1,255,56,255,53,0,
+180,0,11,0,3,0,0,55,23,5,39,177,3,254,135,3,11,72,142,72,0,0,1,255,15,4,89,
+0,175,5,130,0,37,0,0,3,6,6,35,34,38,53,53,55,20,22,51,50,54,53,52,38,39,55,
+22,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,39,14,5,58,51,52,61,
+59,31,31,31,24,7,5,63,16,36,24,26,22,26,12,60,20,23,62,47,15,44,17,4,193,
+48,56,79,69,9,18,47,58,44,27,17,36,14,24,56,39,32,23,27,41,14,23,20,54,32,
+58,66,15,23,0,2,255,110,4,85,0,128,5,101,0,11,0,23,0,0,2,38,53,52,54,51,50,
+22,21,20,6,35,38,22,51,50,54,53,52,38,35,34,6,21,69,77,82,52,59,81,79,58,
+73,39,32,37,38,41,32,32,41,4,85,74,59,56,83,81,62,53,76,106,41,42,29,32,38,
+42,29,0,0,1,254,252,4,68,0,237,4,224,0,22,0,0,1,54,54,55,55,54,55,22,22,51,
+50,54,55,23,6,6,35,34,38,39,6,7,7,254,252,11,27,14,27,12,9,68,89,44,43,80,
+31,42,34,120,53,57,81,37,8,17,34,4,103,15,34,17,31,14,8,25,15,23,19,60,27,
+36,19,17,8,20,41,0,0,1,255,97,4,85,0,138,5,152,0,27,0,0,19,21,5,53,55,53,
+38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,55,50,55,138,254,215,
+65,23,18,92,64,20,56,23,23,19,34,16,38,46,40,35,15,7,5,4,196,76,35,75,7,4,
+15,50,20,67,85,10,12,66,7,4,39,35,28,45,1,1,0,0,1,255,97,254,189,0,138,0,
+0,0,27,0,0,23,21,5,53,55,53,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,
+20,22,51,55,50,55,138,254,215,65,23,18,92,64,20,56,23,23,19,34,16,38,46,40,
+35,15,7,5,212,76,35,75,7,4,15,50,20,67,85,10,12,66,7,4,39,35,28,45,1,1,0,
+1,255,209,4,85,0,47,5,198,0,3,0,0,19,17,35,17,47,94,5,198,254,143,1,113,255,
+255,254,227,4,89,0,175,6,222,18,38,0,185,0,0,16,7,0,180,255,209,1,34,255,
+255,255,13,4,77,0,191,6,237,18,38,0,179,0,0,16,7,0,185,255,254,1,107,255,
+255,255,9,4,89,0,175,6,216,18,38,0,185,0,0,16,7,0,179,255,209,1,26,255,255,
+255,15,4,89,0,175,6,60,18,38,0,185,0,0,16,7,0,182,255,209,1,26,255,255,255,
+14,4,89,0,175,6,218,18,38,0,185,0,0,16,7,0,183,255,209,1,34,255,255,255,23,
+4,77,0,191,6,82,18,38,0,182,0,0,16,7,0,185,0,8,0,208,0,2,255,15,4,89,0,175,
+6,219,0,36,0,40,0,0,3,6,6,35,34,38,53,53,55,20,22,51,50,54,53,52,38,39,55,
+22,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,3,17,35,17,15,6,55,48,
+54,63,59,31,31,31,24,7,5,63,16,36,24,26,22,26,12,60,20,23,62,47,25,43,4,84,
+4,198,51,58,84,64,9,18,47,58,44,27,17,36,14,24,56,39,32,23,27,41,14,23,20,
+54,32,58,66,21,2,42,254,201,1,55,0,255,255,255,38,4,85,0,173,7,35,18,38,0,
+188,0,0,16,7,0,179,255,238,1,101,255,255,255,49,4,85,0,173,6,145,18,38,0,
+188,0,0,16,7,0,182,255,238,1,111,255,255,255,0,4,85,0,171,7,33,18,38,0,188,
+0,0,16,7,0,180,255,238,1,101,255,255,255,43,4,85,0,166,7,29,18,38,0,188,0,
+0,16,7,0,183,255,238,1,101,255,255,255,97,4,85,0,138,7,3,18,38,0,188,0,0,
+16,7,0,186,0,1,1,158,255,255,255,56,253,185,0,180,0,0,18,38,0,189,0,0,16,
+7,0,184,0,0,254,132,255,255,255,56,253,40,0,191,0,0,18,38,0,189,0,0,16,7,
+0,181,0,0,254,142,0,1,0,72,1,112,1,60,2,100,0,3,0,0,19,51,21,35,72,244,244,
+2,100,244,0,1,0,191,0,0,1,128,4,176,0,3,0,0,1,19,35,3,1,78,50,143,50,4,176,
+251,80,4,176,0,0,1,0,50,0,0,3,35,4,176,0,22,0,0,33,35,3,38,2,39,51,23,22,
+22,51,50,54,55,51,6,6,35,34,38,39,35,23,1,134,146,101,23,50,20,148,15,28,
+102,57,115,120,30,138,32,198,155,44,89,38,7,32,2,129,145,1,47,111,92,33,36,
+77,84,148,156,17,25,186,0,0,1,0,50,0,0,3,151,4,176,0,38,0,0,1,51,20,6,7,22,
+22,51,50,54,55,51,20,6,35,34,38,39,6,6,35,34,38,39,7,23,19,35,3,38,2,39,51,
+23,22,22,51,50,54,1,193,132,13,8,15,52,29,67,61,3,132,140,113,59,80,30,30,
+79,42,23,48,21,8,20,124,146,101,23,50,20,148,23,17,60,31,60,55,4,176,49,79,
+25,20,19,97,95,154,173,32,27,35,25,12,18,1,113,252,236,2,129,145,1,47,111,
+139,26,29,96,0,1,0,60,255,251,2,246,4,204,0,41,0,0,1,6,6,21,20,22,23,23,22,
+22,21,20,6,7,7,6,6,21,20,22,51,50,54,55,21,6,6,35,34,38,53,52,54,55,55,39,
+38,38,53,52,36,37,2,62,184,191,106,102,56,73,47,21,56,143,69,58,132,121,63,
+138,68,66,131,81,204,180,117,156,50,137,116,106,1,0,1,2,4,69,50,106,59,36,
+53,25,14,19,49,41,19,51,50,125,61,77,35,40,42,19,16,142,17,22,105,101,87,
+166,122,39,36,32,106,75,125,185,54,0,0,2,0,70,0,80,3,92,4,60,0,11,0,23,0,
+0,18,18,51,50,18,21,20,6,35,34,38,53,36,38,35,34,6,21,20,22,51,50,54,53,70,
+226,178,181,205,210,189,180,211,2,128,128,108,116,138,124,117,126,123,2,254,
+1,62,254,217,232,231,246,236,219,188,209,213,185,144,160,159,163,0,1,0,20,
+0,0,2,225,4,189,0,21,0,0,1,34,38,39,55,22,22,51,23,33,21,20,18,23,23,22,23,
+23,35,38,2,39,1,141,91,193,93,17,54,164,70,72,1,17,15,10,14,7,8,13,147,20,
+40,2,4,32,8,11,138,5,7,1,96,89,254,185,131,205,100,90,162,229,2,124,191,0,
+0,1,0,0,0,0,3,188,4,176,0,26,0,0,1,3,6,7,7,6,7,7,35,3,39,38,2,39,51,22,23,
+19,19,23,51,54,55,55,54,54,55,3,188,142,41,42,83,41,35,61,122,110,68,53,99,
+59,169,21,24,103,101,42,5,44,41,81,44,81,41,4,176,254,134,109,115,224,109,
+96,169,1,99,213,162,1,43,171,65,77,254,183,254,182,142,124,119,236,129,226,
+109,0,0,1,0,10,0,0,3,198,4,176,0,30,0,0,51,55,19,54,55,55,54,55,51,22,23,
+23,22,22,23,23,22,23,35,3,39,39,38,39,35,6,7,7,6,6,7,10,61,154,41,38,72,34,
+24,122,23,30,64,35,75,37,75,37,34,169,156,55,51,25,20,5,42,39,77,42,77,39,
+172,1,174,115,109,206,96,72,71,90,193,106,221,106,215,106,92,1,215,170,160,
+77,65,125,118,235,130,226,109,0,0,2,0,30,0,0,3,4,4,203,0,14,0,27,0,0,33,3,
+6,6,35,34,38,53,52,54,51,50,22,23,19,3,39,38,38,35,34,6,21,20,22,51,50,54,
+2,112,49,47,114,51,158,175,201,135,149,168,17,72,209,6,9,81,100,76,119,99,
+106,51,86,2,73,25,27,162,140,149,243,196,209,252,202,2,208,96,136,132,134,
+101,79,90,19,0,0,3,0,130,0,0,3,131,4,176,0,3,0,7,0,11,0,0,1,1,35,1,5,51,21,
+35,1,51,21,35,3,131,253,150,151,2,108,253,178,202,202,1,240,202,202,4,176,
+251,80,4,176,20,197,252,238,197,0,1,0,112,254,248,1,133,0,238,0,9,0,0,37,
+23,6,2,7,35,54,63,2,1,118,15,30,90,32,125,13,16,31,55,238,23,106,254,228,
+89,52,67,136,247,0,1,0,109,2,186,1,130,4,176,0,9,0,0,1,23,6,2,7,35,54,63,
+2,1,115,15,30,90,32,125,13,16,31,55,4,176,23,106,254,228,89,52,67,136,247,
+0,0,1,0,164,255,242,1,126,0,223,0,3,0,0,55,51,21,35,164,218,218,223,237,0,
+0,1,0,130,0,0,1,151,1,246,0,11,0,0,51,39,54,18,55,51,6,7,7,6,6,7,145,15,30,
+90,32,125,13,15,32,15,29,11,23,106,1,28,89,52,67,136,63,132,52,0,0,2,0,183,
+255,242,1,233,4,115,0,8,0,12,0,0,19,39,54,54,55,51,6,6,7,3,51,21,35,217,15,
+31,75,56,125,32,52,21,201,218,218,2,125,23,118,236,125,121,247,134,254,98,
+237,0,0,2,0,183,255,242,1,145,3,98,0,3,0,7,0,0,55,51,21,35,17,51,21,35,183,
+218,218,218,218,223,237,3,112,237,255,255,0,164,255,242,5,43,0,223,16,38,
+0,218,0,0,16,39,0,218,1,214,0,0,16,7,0,218,3,173,0,0,0,2,0,66,255,252,2,236,
+4,240,0,24,0,28,0,0,1,53,52,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,
+20,30,2,21,21,7,51,21,35,1,147,229,108,203,159,82,156,82,60,60,125,68,98,
+115,70,168,77,171,197,197,1,147,33,106,163,139,100,140,180,41,42,124,29,33,
+94,74,57,97,125,132,83,54,190,217,0,0,2,0,193,255,252,1,134,4,220,0,3,0,7,
+0,0,1,35,3,51,3,51,21,35,1,89,105,45,195,197,197,197,1,147,3,73,251,249,217,
+0,0,1,0,82,254,138,2,33,5,132,0,13,0,0,1,51,6,2,21,20,18,23,35,38,2,17,16,
+18,1,127,162,145,144,147,140,160,148,153,154,5,132,194,254,52,245,237,254,
+51,189,171,1,195,1,7,1,10,1,204,0,1,0,61,254,138,2,12,5,132,0,13,0,0,19,35,
+54,18,53,52,2,39,51,22,18,17,16,2,223,160,139,148,144,145,162,149,152,154,
+254,138,188,1,204,239,245,1,204,194,178,254,48,254,253,254,247,254,61,0,0,
+1,0,160,254,188,2,105,5,140,0,7,0,0,1,33,17,33,21,33,17,33,2,105,254,55,1,
+201,254,213,1,43,254,188,6,208,136,250,65,0,0,1,0,50,254,188,1,251,5,140,
+0,7,0,0,23,33,17,33,53,33,17,33,50,1,43,254,213,1,201,254,55,187,5,191,136,
+249,48,0,0,1,0,160,3,84,4,130,7,115,0,5,0,0,1,21,33,17,35,17,4,130,252,134,
+104,7,115,104,252,73,4,31,0,1,255,206,3,84,3,176,7,115,0,5,0,0,1,17,35,17,
+33,53,3,176,104,252,134,7,115,251,225,3,183,104,255,255,0,160,3,84,4,130,
+7,115,18,6,0,229,0,0,255,255,255,206,3,84,3,176,7,115,18,6,0,230,0,0,0,2,
+0,82,255,253,3,170,3,70,0,6,0,13,0,0,19,1,23,1,1,7,1,37,1,23,1,1,7,1,82,1,
+86,119,254,223,1,33,119,254,170,1,139,1,88,117,254,225,1,31,117,254,168,1,
+175,1,151,69,254,162,254,161,71,1,151,27,1,151,69,254,162,254,161,71,1,151,
+0,2,0,80,255,253,3,168,3,70,0,6,0,13,0,0,1,1,39,1,1,55,1,5,1,39,1,1,55,1,
+3,168,254,168,117,1,31,254,225,117,1,88,254,117,254,168,117,1,31,254,225,
+117,1,88,1,148,254,105,71,1,95,1,94,69,254,105,27,254,105,71,1,95,1,94,69,
+254,105,0,0,1,0,70,2,73,3,24,5,0,0,14,0,0,1,3,37,23,5,23,7,3,3,39,55,37,55,
+5,3,1,247,24,1,37,20,254,238,174,131,133,122,134,169,254,241,22,1,32,24,5,
+0,254,225,72,138,28,242,72,1,7,254,249,72,242,28,138,72,1,31,0,0,1,0,130,
+0,152,4,19,4,70,0,11,0,0,1,33,21,33,17,35,17,33,53,33,17,51,2,140,1,135,254,
+121,132,254,122,1,134,132,2,176,132,254,108,1,148,132,1,150,0,1,0,130,2,44,
+4,19,2,176,0,3,0,0,19,53,33,21,130,3,145,2,44,132,132,0,0,2,0,145,1,107,4,
+5,3,113,0,3,0,7,0,0,19,53,33,21,1,53,33,21,145,3,116,252,140,3,116,2,239,
+130,130,254,124,130,130,0,0,1,0,90,255,4,3,85,5,140,0,3,0,0,1,1,35,1,3,85,
+253,147,142,2,110,5,140,249,120,6,136,0,0,1,0,32,255,149,2,249,4,236,0,3,
+0,0,1,1,35,1,2,249,253,184,145,2,73,4,236,250,169,5,87,0,0,1,0,23,0,0,2,221,
+5,182,0,3,0,0,19,1,35,1,186,2,35,166,253,224,5,182,250,74,5,182,0,1,0,84,
+1,217,2,63,2,113,0,3,0,0,19,53,33,21,84,1,235,1,217,152,152,0,0,2,0,115,2,
+155,2,163,4,203,0,11,0,23,0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,
+52,38,35,34,6,21,20,22,51,2,0,163,165,115,120,160,165,115,75,101,101,75,75,
+101,101,75,4,203,157,123,115,165,159,121,115,165,254,56,101,75,77,99,99,77,
+75,101,0,0,8,0,170,0,104,4,45,3,237,0,5,0,11,0,17,0,23,0,29,0,35,0,41,0,47,
+0,0,1,38,39,55,22,23,3,38,39,53,22,23,19,6,7,39,54,55,1,6,7,39,54,55,7,6,
+7,35,54,55,1,6,7,53,54,55,37,38,39,51,22,23,23,38,39,55,22,23,3,238,20,56,
+45,81,13,219,83,95,117,106,174,12,78,47,59,12,254,70,98,78,45,101,120,254,
+59,13,63,12,78,2,121,101,122,96,80,253,184,77,17,65,16,60,250,116,107,47,
+77,99,2,96,103,77,47,105,122,1,4,59,12,66,12,78,254,96,116,107,47,84,92,1,
+184,17,58,47,77,17,219,83,95,123,102,253,133,77,17,65,16,60,33,101,120,96,
+80,215,12,78,45,57,12,0,0,1,0,180,254,191,6,116,6,15,0,31,0,0,1,33,17,39,
+55,23,55,23,7,17,33,55,23,7,23,7,39,33,17,23,7,39,7,39,55,17,33,7,39,55,39,
+55,1,148,1,181,183,80,181,182,73,183,1,181,136,88,109,109,88,136,254,75,183,
+80,181,182,73,183,254,75,136,88,108,108,88,3,104,1,198,137,88,109,109,88,
+136,254,57,174,71,181,182,64,174,252,206,137,88,109,109,88,136,3,51,174,71,
+181,182,64,0,1,0,180,254,191,6,76,6,15,0,47,0,0,1,35,38,38,53,52,54,55,51,
+23,33,17,39,53,54,54,51,50,22,23,21,7,17,33,55,51,22,22,21,20,6,7,35,39,33,
+17,23,21,6,6,35,34,38,39,53,55,17,33,1,36,48,24,40,38,26,48,56,1,217,160,
+30,143,66,65,133,33,160,1,216,57,48,26,38,40,24,48,56,254,39,160,34,140,65,
+66,135,30,160,254,40,2,50,30,143,66,65,133,33,160,1,254,57,48,24,40,38,26,
+48,56,254,1,160,34,140,65,66,135,30,160,252,150,57,48,26,38,40,24,48,56,3,
+107,255,255,0,160,0,0,3,158,4,220,18,38,0,28,0,0,16,39,1,40,2,160,4,11,16,
+7,1,40,1,38,4,11,255,255,0,160,0,0,4,37,4,220,18,38,0,29,0,0,16,39,1,40,1,
+38,4,11,16,7,1,40,2,160,4,11,0,1,0,115,255,128,3,58,4,207,0,19,0,0,33,33,
+7,7,39,18,18,53,52,38,39,39,55,22,22,21,20,2,7,33,3,58,254,3,40,42,120,171,
+151,20,21,154,66,140,141,101,83,1,165,64,64,70,1,16,1,147,208,65,103,24,68,
+146,12,186,198,181,254,174,161,0,0,1,0,115,255,128,3,58,4,207,0,19,0,0,33,
+33,7,7,39,18,18,53,52,38,39,39,55,22,22,21,20,2,7,33,3,58,254,3,40,42,120,
+171,151,20,21,154,66,140,141,101,83,1,165,64,64,70,1,16,1,147,208,65,103,
+24,68,146,12,186,198,181,254,174,161,0,0,1,254,144,255,113,2,119,2,239,0,
+15,0,0,23,35,1,55,1,19,3,55,1,22,22,51,21,34,38,39,63,104,254,185,62,1,69,
+240,211,117,1,17,75,88,30,82,121,92,143,1,189,163,254,66,1,77,1,56,87,254,
+117,110,91,155,108,131,0,1,0,115,255,128,2,77,4,207,0,14,0,0,19,55,22,22,
+21,20,2,3,39,18,18,53,52,38,39,242,66,140,141,172,182,120,171,151,20,21,4,
+61,146,12,186,198,223,254,42,254,242,70,1,16,1,147,208,65,103,24,0,1,0,115,
+255,118,2,218,4,207,0,22,0,0,19,55,22,22,21,20,2,7,33,21,33,7,35,39,39,53,
+51,54,18,53,52,38,39,196,71,136,135,105,105,1,146,254,68,3,21,119,28,50,116,
+110,26,20,4,61,146,12,177,207,159,254,167,176,155,138,137,13,143,190,1,63,
+161,65,104,23,255,255,0,115,255,118,2,218,4,207,18,6,0,253,0,0,0,2,255,135,
+255,245,5,103,3,215,0,45,0,57,0,0,49,34,38,53,52,54,51,33,38,53,52,55,39,
+38,38,39,55,22,22,23,23,54,54,51,50,18,21,20,7,22,22,51,51,21,35,34,38,39,
+35,6,6,35,34,39,35,7,36,54,53,52,38,35,34,6,21,20,22,51,33,47,47,33,1,208,
+56,3,186,127,174,45,100,37,121,123,191,52,200,129,187,224,21,11,67,53,30,
+30,72,107,33,6,53,155,103,203,107,4,36,1,235,131,148,124,123,152,135,140,
+41,36,36,42,91,133,30,29,140,97,148,45,115,37,110,94,146,120,132,254,248,
+205,80,66,41,37,155,47,47,51,54,105,94,136,126,122,140,176,182,134,122,126,
+0,2,255,135,255,245,4,219,3,215,0,34,0,46,0,0,49,34,38,53,52,54,51,33,38,
+53,52,55,39,38,38,39,55,22,22,23,23,54,54,51,50,18,21,20,6,35,34,38,39,35,
+7,36,54,53,52,38,35,34,6,21,20,22,51,33,47,47,33,1,208,56,3,186,127,174,45,
+100,37,121,123,191,52,200,129,187,224,219,200,103,155,53,4,37,1,237,131,148,
+124,123,152,135,140,41,36,36,42,91,133,30,29,140,97,148,45,115,37,110,94,
+146,120,132,254,248,205,184,206,54,52,95,136,126,122,140,176,182,134,122,
+126,0,0,1,255,176,0,0,4,53,3,130,0,32,0,0,49,34,38,53,52,54,51,33,38,53,17,
+33,34,38,39,53,22,22,51,33,17,20,22,22,51,51,21,35,34,38,39,35,7,33,47,47,
+33,2,227,27,254,214,119,210,45,37,210,117,1,202,29,51,65,70,83,73,113,36,
+4,35,41,36,36,42,70,110,1,131,18,12,146,9,17,253,244,77,80,36,155,43,51,94,
+0,1,255,176,0,0,3,94,3,130,0,19,0,0,49,34,38,53,52,54,51,33,17,33,34,38,39,
+53,22,22,51,33,17,7,33,47,47,33,2,200,254,214,119,210,45,37,210,117,1,202,
+80,41,36,36,42,2,55,18,12,146,9,17,253,6,110,0,0,1,255,8,254,20,3,42,5,140,
+0,23,0,0,33,19,51,21,35,53,3,35,7,33,34,38,53,52,54,51,33,1,55,1,22,22,51,
+21,2,53,150,95,197,209,4,37,254,149,33,47,47,33,1,111,253,153,144,2,77,35,
+38,24,254,224,204,180,1,150,94,41,36,36,42,4,171,70,251,135,67,53,155,0,0,
+1,255,8,254,20,3,106,5,140,0,15,0,0,1,3,33,34,38,53,52,54,51,33,1,55,1,51,
+21,35,2,165,161,253,252,33,47,47,33,1,111,253,153,144,3,115,95,197,254,200,
+1,56,41,36,36,42,4,171,70,249,84,204,0,1,255,8,254,20,3,42,5,140,0,46,0,0,
+1,3,35,7,33,34,38,53,52,54,51,33,1,55,19,22,22,51,50,54,53,52,38,39,39,55,
+23,22,22,21,20,6,35,34,38,39,7,1,22,22,51,21,35,19,51,21,35,2,101,209,4,37,
+254,149,33,47,47,33,1,111,253,153,144,167,22,62,52,48,61,18,19,67,129,65,
+25,30,110,103,14,36,16,7,1,62,35,38,24,17,150,95,197,254,200,1,150,94,41,
+36,36,42,4,171,70,254,187,41,48,49,45,26,64,35,127,68,126,49,95,45,98,123,
+5,7,4,253,151,67,53,155,254,224,204,0,0,1,255,8,254,20,3,106,5,140,0,38,0,
+0,1,3,33,34,38,53,52,54,51,33,1,55,19,22,22,51,50,54,53,52,38,39,39,55,23,
+22,22,21,20,6,35,34,38,39,7,1,51,21,35,2,165,161,253,252,33,47,47,33,1,111,
+253,153,144,167,22,62,52,48,61,18,19,67,129,65,25,30,110,103,14,36,16,7,2,
+100,95,197,254,200,1,56,41,36,36,42,4,171,70,254,187,41,48,49,45,26,64,35,
+127,68,126,49,95,45,98,123,5,7,4,251,100,204,0,2,255,8,253,184,4,157,5,140,
+0,15,0,18,0,0,1,35,1,33,34,38,53,52,54,51,33,1,55,1,33,21,1,19,33,3,41,61,
+254,211,254,65,33,47,47,33,1,111,253,153,144,2,137,2,124,254,154,247,254,
+67,253,184,2,72,41,36,36,42,4,171,70,251,15,161,254,133,1,129,0,2,255,8,253,
+184,4,157,5,140,0,15,0,18,0,0,1,35,1,33,34,38,53,52,54,51,33,1,55,1,33,21,
+1,19,33,3,41,61,254,211,254,65,33,47,47,33,1,111,253,153,144,2,137,2,124,
+254,154,247,254,67,253,184,2,72,41,36,36,42,4,171,70,251,15,161,254,133,1,
+129,0,3,255,8,253,154,4,187,5,140,0,15,0,22,0,26,0,0,1,35,1,33,34,38,53,52,
+54,51,33,1,55,1,33,21,1,54,18,55,33,20,18,19,51,21,35,3,56,61,254,196,254,
+65,33,47,47,33,1,111,253,153,144,2,137,2,154,254,111,50,194,51,253,254,147,
+4,159,159,253,154,2,102,41,36,36,42,4,171,70,251,15,161,254,53,41,1,35,133,
+124,254,233,1,64,163,0,3,255,8,253,154,4,187,5,140,0,15,0,22,0,26,0,0,1,35,
+1,33,34,38,53,52,54,51,33,1,55,1,33,21,1,54,18,55,33,20,18,19,51,21,35,3,
+56,61,254,196,254,65,33,47,47,33,1,111,253,153,144,2,137,2,154,254,111,50,
+194,51,253,254,147,4,159,159,253,154,2,102,41,36,36,42,4,171,70,251,15,161,
+254,53,41,1,35,133,124,254,233,1,64,163,0,1,255,8,0,0,2,72,5,140,0,20,0,0,
+33,34,38,39,35,7,33,34,38,53,52,54,51,33,1,55,1,22,22,51,21,2,57,56,76,31,
+4,37,254,147,33,47,47,33,1,112,253,152,144,2,79,14,51,32,50,43,93,41,36,36,
+42,4,171,70,251,135,27,93,155,0,0,1,255,8,0,0,2,44,5,140,0,11,0,0,49,34,38,
+53,52,54,51,33,1,55,1,7,33,47,47,33,1,111,253,153,144,2,148,95,41,36,36,42,
+4,171,70,251,1,141,0,1,255,152,0,0,2,176,4,31,0,22,0,0,37,38,38,39,1,55,1,
+22,22,51,21,34,38,39,35,7,33,34,38,53,52,54,51,1,213,17,44,17,254,17,133,
+1,253,68,60,22,42,83,44,4,39,254,36,33,47,47,33,155,20,55,25,2,198,90,253,
+38,99,71,155,46,48,94,41,36,36,42,0,1,255,153,255,246,3,222,4,31,0,29,0,0,
+37,38,38,39,1,55,1,22,22,51,50,54,55,51,23,6,6,35,34,38,39,35,7,33,34,38,
+53,52,54,51,1,214,17,45,17,254,18,133,1,253,84,77,47,55,81,26,5,76,32,137,
+80,74,103,44,4,39,254,35,33,47,47,33,155,20,55,25,2,198,90,253,38,124,56,
+67,56,100,89,89,54,50,94,41,36,36,42,0,0,1,255,176,0,0,3,238,3,133,0,37,0,
+0,49,34,38,53,52,54,51,33,38,53,17,38,38,39,55,22,22,51,50,54,55,23,6,6,7,
+17,20,22,22,51,33,21,33,34,38,39,35,7,33,47,47,33,1,124,27,111,214,43,29,
+42,210,162,162,210,42,29,43,214,111,29,51,65,1,102,254,141,73,112,36,4,36,
+41,36,36,42,70,110,1,106,2,33,23,146,18,36,36,18,146,23,33,2,254,163,77,80,
+36,155,43,51,94,0,1,255,176,0,0,3,213,3,133,0,37,0,0,49,34,38,53,52,54,51,
+33,38,53,17,38,38,39,55,22,22,51,50,54,55,23,6,6,7,17,20,22,22,51,33,21,33,
+34,38,39,35,7,33,47,47,33,1,124,27,111,214,43,29,42,210,162,162,210,42,29,
+43,214,111,29,51,65,1,77,254,166,73,112,36,4,36,41,36,36,42,70,110,1,106,
+2,33,23,146,18,36,36,18,146,23,33,2,254,163,77,80,36,155,43,51,94,255,255,
+255,176,0,0,4,45,3,133,16,38,1,15,63,0,16,6,1,50,0,0,255,255,255,176,0,0,
+4,20,3,133,16,38,1,16,63,0,16,6,1,50,0,0,255,255,0,100,254,20,7,52,5,140,
+16,38,0,19,0,0,16,7,1,49,6,29,0,0,255,255,255,176,254,20,4,37,5,140,16,38,
+0,20,0,0,16,7,1,49,3,14,0,0,255,255,255,8,254,20,3,93,5,140,16,38,1,3,0,0,
+16,7,1,49,2,70,0,0,255,255,0,100,254,20,7,52,5,140,16,39,1,40,3,165,1,29,
+16,38,0,19,0,0,16,7,1,49,6,29,0,0,255,255,255,176,254,20,4,37,5,140,16,39,
+1,40,0,112,1,29,16,38,0,20,0,0,16,7,1,49,3,14,0,0,255,255,0,100,254,20,7,
+52,5,140,16,39,1,49,6,29,0,0,16,6,0,108,0,0,255,255,255,176,254,20,4,37,5,
+140,16,38,0,109,0,0,16,7,1,49,3,14,0,0,255,255,255,8,254,20,3,93,5,140,16,
+38,1,5,0,0,16,7,1,49,2,70,0,0,255,255,0,160,254,146,4,193,3,113,16,39,1,40,
+2,19,254,112,16,38,0,29,0,0,16,7,1,48,4,37,0,0,255,255,0,160,0,0,4,193,3,
+113,16,38,0,29,0,0,16,7,1,48,4,37,0,0,255,255,0,100,0,0,7,72,3,130,16,38,
+0,15,0,0,16,7,1,51,6,103,0,0,255,255,255,176,0,0,5,97,3,130,16,38,0,16,0,
+0,16,7,1,51,4,128,0,0,255,255,0,100,0,0,6,169,4,182,16,38,0,82,0,0,16,7,1,
+51,5,200,0,0,255,255,255,176,0,0,5,74,4,182,16,38,0,83,0,0,16,7,1,51,4,105,
+0,0,255,255,0,169,255,97,3,38,3,1,16,38,0,35,0,0,16,7,1,48,2,138,0,0,255,
+255,255,176,0,0,3,75,3,109,16,38,0,67,0,0,16,7,1,48,2,175,0,0,255,255,255,
+211,4,97,0,85,5,85,16,7,1,41,0,21,4,85,255,255,255,171,255,21,0,45,0,9,16,
+7,1,41,255,237,255,9,0,2,255,236,4,85,1,35,5,207,0,11,0,23,0,0,18,22,21,20,
+6,35,34,38,53,52,54,51,22,22,21,20,6,35,34,38,53,52,54,51,171,24,126,40,24,
+25,127,40,120,24,126,40,24,25,127,40,5,207,28,17,38,102,30,17,38,100,193,
+28,17,38,102,30,17,38,100,0,255,255,255,112,4,85,0,167,5,207,16,6,1,37,132,
+0,0,2,255,79,4,84,0,145,5,207,0,11,0,23,0,0,18,22,21,20,6,35,34,38,53,52,
+54,51,22,22,21,20,6,35,34,38,53,52,54,51,2,22,114,39,23,25,117,39,144,22,
+113,41,23,24,115,41,5,207,30,17,36,118,30,17,39,115,179,29,17,36,118,31,16,
+38,115,0,0,1,255,174,0,34,0,85,0,209,0,3,0,0,39,51,21,35,82,167,167,209,175,
+0,0,1,255,190,0,12,0,64,1,0,0,11,0,0,18,22,21,20,6,35,34,38,53,52,54,51,43,
+21,47,35,26,22,37,46,1,0,44,29,74,97,44,31,43,126,0,1,255,190,0,16,0,65,0,
+155,0,3,0,0,39,51,21,35,66,131,131,155,139,0,0,1,255,167,0,27,0,92,0,216,
+0,3,0,0,39,51,21,35,89,181,181,216,189,0,255,255,255,160,4,130,0,35,5,13,
+16,7,1,42,255,226,4,114,255,255,255,160,255,73,0,35,255,212,16,7,1,42,255,
+226,255,57,255,255,255,147,4,119,0,109,5,79,18,6,0,171,0,0,255,255,255,147,
+255,4,0,109,255,220,18,6,0,174,0,0,0,1,255,176,0,0,0,156,0,155,0,8,0,0,51,
+35,34,38,53,52,54,51,51,156,156,33,47,47,33,156,41,36,36,42,0,1,255,176,0,
+0,1,23,0,155,0,8,0,0,33,33,34,38,53,52,54,51,33,1,23,254,233,33,47,47,33,
+1,23,41,36,36,42,0,0,1,255,176,0,0,0,63,0,155,0,8,0,0,51,35,34,38,53,52,54,
+51,51,63,63,33,47,47,33,63,41,36,36,42,0,1,255,176,0,0,0,225,0,155,0,8,0,
+0,51,35,34,38,53,52,54,51,51,225,225,33,47,47,33,225,41,36,36,42,0,1,254,
+72,6,134,0,40,6,204,0,3,0,0,1,33,21,33,254,72,1,224,254,32,6,204,70,0,0,1,
+252,184,6,134,0,40,6,204,0,3,0,0,1,33,21,33,252,184,3,112,252,144,6,204,70,
+0,0,1,255,216,6,134,1,184,6,204,0,3,0,0,3,33,21,33,40,1,224,254,32,6,204,
+70,0,1,255,216,6,134,4,216,6,204,0,3,0,0,3,33,21,33,40,5,0,251,0,6,204,70,
+0,1,255,216,6,134,7,48,6,204,0,3,0,0,3,33,21,33,40,7,88,248,168,6,204,70,
+0,1,254,72,6,134,255,116,6,204,0,3,0,0,1,33,21,33,254,72,1,44,254,212,6,204,
+70,0,0,1,252,184,6,134,255,116,6,204,0,3,0,0,1,33,21,33,252,184,2,188,253,
+68,6,204,70,0,0,1,0,120,6,134,1,184,6,204,0,3,0,0,19,33,21,33,120,1,64,254,
+192,6,204,70,0,1,0,120,6,134,4,216,6,204,0,3,0,0,19,33,21,33,120,4,96,251,
+160,6,204,70,0,1,0,120,6,134,7,48,6,204,0,3,0,0,19,33,21,33,120,6,184,249,
+72,6,204,70,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,
+48,0,94,0,3,0,1,4,9,0,2,0,14,0,142,0,3,0,1,4,9,0,3,0,86,0,156,0,3,0,1,4,9,
+0,4,0,48,0,94,0,3,0,1,4,9,0,5,0,30,0,242,0,3,0,1,4,9,0,6,0,42,1,16,0,3,0,
+1,4,9,0,7,0,68,1,58,0,3,0,1,4,9,0,8,0,42,1,126,0,3,0,1,4,9,0,9,0,40,1,168,
+0,3,0,1,4,9,0,10,0,96,1,208,0,3,0,1,4,9,0,11,0,62,2,48,0,3,0,1,4,9,0,12,0,
+60,2,110,0,3,0,1,4,9,0,13,2,150,2,170,0,3,0,1,4,9,0,14,0,52,5,64,0,67,0,111,
+0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,52,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,
+0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,
+0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,
+0,115,0,32,0,83,0,121,0,114,0,105,0,97,0,99,0,32,0,69,0,97,0,115,0,116,0,
+101,0,114,0,110,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,
+0,121,0,114,0,105,0,97,0,99,0,32,0,69,0,97,0,115,0,116,0,101,0,114,0,110,
+0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,52,0,32,0,
+117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,83,0,121,0,114,0,
+105,0,97,0,99,0,69,0,97,0,115,0,116,0,101,0,114,0,110,0,78,0,111,0,116,0,
+111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,
+97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,
+0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,
+104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,
+0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,
+0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,
+0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,
+0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,0,0,0,0,0,64,0,2,0,8,0,8,0,12,0,1,0,13,0,13,0,3,0,14,0,51,
+0,1,0,53,0,124,0,1,0,140,0,204,0,3,0,247,1,34,0,1,1,35,1,39,0,3,1,44,1,47,
+0,3,0,2,0,37,0,13,0,13,0,1,0,139,0,139,0,4,0,140,0,140,0,1,0,141,0,141,0,
+2,0,143,0,143,0,1,0,144,0,144,0,2,0,145,0,146,0,1,0,147,0,149,0,2,0,150,0,
+150,0,1,0,151,0,152,0,2,0,153,0,153,0,1,0,154,0,154,0,2,0,155,0,157,0,1,0,
+158,0,158,0,2,0,159,0,159,0,1,0,160,0,160,0,2,0,161,0,161,0,1,0,162,0,162,
+0,2,0,163,0,163,0,1,0,164,0,164,0,2,0,165,0,171,0,1,0,172,0,178,0,2,0,179,
+0,180,0,1,0,181,0,181,0,2,0,182,0,183,0,1,0,184,0,184,0,2,0,185,0,188,0,1,
+0,189,0,189,0,2,0,190,0,202,0,1,1,35,1,35,0,1,1,36,1,36,0,2,1,37,1,37,0,1,
+1,39,1,39,0,1,1,44,1,44,0,3,1,45,1,45,0,5,1,46,1,46,0,3,1,47,1,47,0,5,0,0,
+0,1,0,0,0,10,0,56,0,164,0,2,68,70,76,84,0,14,115,121,114,99,0,30,0,4,0,0,
+0,0,255,255,0,3,0,0,0,2,0,4,0,4,0,0,0,0,255,255,0,3,0,1,0,3,0,5,0,6,107,101,
+114,110,0,38,107,101,114,110,0,38,109,97,114,107,0,88,109,97,114,107,0,88,
+109,107,109,107,0,100,109,107,109,107,0,100,0,0,0,23,0,6,0,7,0,8,0,9,0,10,
+0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,
+0,26,0,27,0,28,0,0,0,4,0,0,0,1,0,2,0,3,0,0,0,2,0,4,0,5,0,51,0,104,5,148,9,
+218,11,24,12,104,13,158,14,106,18,134,22,76,23,94,26,96,27,112,27,184,27,
+230,28,2,28,72,28,122,28,236,29,52,29,198,30,88,30,176,31,142,32,150,32,176,
+33,136,33,176,34,198,35,110,35,238,36,102,36,118,36,136,36,152,36,180,37,
+62,37,182,37,200,37,246,38,16,38,42,38,116,39,20,39,70,39,86,39,102,39,118,
+39,134,39,156,39,184,40,114,0,4,0,1,0,1,0,8,0,1,0,12,5,112,0,1,0,104,1,50,
+0,1,0,44,0,13,0,140,0,143,0,145,0,146,0,150,0,153,0,155,0,157,0,159,0,161,
+0,163,0,165,0,166,0,167,0,168,0,169,0,170,0,171,0,179,0,180,0,182,0,183,0,
+185,0,186,0,187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,
+0,199,0,200,0,201,0,202,1,35,1,37,1,38,1,39,0,44,0,0,0,184,0,0,0,184,0,0,
+0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,178,0,0,0,184,
+0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,
+0,184,0,0,0,178,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,
+0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,
+0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,0,0,0,184,
+0,0,0,184,0,0,0,190,0,0,0,190,0,0,0,196,0,1,0,0,4,86,0,1,0,0,4,85,0,1,254,
+111,6,87,0,1,254,42,6,11,0,159,1,64,1,70,1,82,1,76,1,82,1,88,3,206,3,212,
+1,94,1,100,3,164,3,170,2,198,1,100,3,164,3,170,2,198,3,200,3,194,1,106,3,
+200,1,112,1,118,1,124,1,130,1,136,3,230,1,142,1,148,1,154,1,160,3,164,1,166,
+1,172,1,178,3,164,1,166,1,172,1,178,1,184,1,184,1,190,1,196,1,202,1,208,1,
+214,1,220,3,164,3,164,3,170,3,170,1,226,1,232,1,238,1,244,1,250,2,0,3,236,
+2,6,2,12,2,12,2,18,2,18,2,24,2,30,2,36,2,36,2,42,2,48,2,54,2,60,2,66,3,218,
+3,224,3,224,2,72,2,78,2,84,2,90,2,96,2,102,2,108,2,108,2,114,2,120,2,126,
+2,132,2,138,2,138,2,144,2,150,2,156,2,162,2,168,2,174,2,180,2,186,2,192,3,
+176,3,182,2,198,2,204,2,210,2,216,2,222,2,228,2,234,2,240,2,240,2,246,2,252,
+3,2,3,8,3,14,3,20,3,26,3,26,3,32,3,32,3,38,3,44,3,50,3,56,3,62,3,68,3,74,
+3,80,3,86,3,116,3,92,3,98,3,104,3,116,3,110,3,116,3,116,3,188,3,122,3,128,
+3,134,3,140,3,146,3,152,3,164,3,170,3,158,3,164,3,170,3,176,3,182,3,188,3,
+194,3,200,3,206,3,212,3,218,3,224,3,230,3,236,0,1,1,123,5,135,0,1,1,123,5,
+133,0,1,1,127,5,133,0,1,1,127,5,135,0,1,4,1,4,48,0,1,2,26,4,48,0,1,2,254,
+6,46,0,1,1,252,4,53,0,1,3,62,4,48,0,1,3,55,4,48,0,1,2,86,4,113,0,1,2,86,4,
+101,0,1,1,7,3,226,0,1,4,95,3,120,0,1,4,97,3,120,0,1,1,206,3,119,0,1,1,211,
+3,116,0,1,2,251,6,47,0,1,255,238,6,43,0,1,255,237,6,47,0,1,3,167,3,120,0,
+1,1,3,3,120,0,1,1,2,3,120,0,1,2,42,4,85,0,1,2,40,3,141,0,1,2,3,4,76,0,1,2,
+2,4,76,0,1,3,111,4,48,0,1,3,111,4,51,0,1,3,243,4,55,0,1,3,240,4,52,0,1,1,
+100,2,105,0,1,0,248,2,150,0,1,1,73,4,48,0,1,5,88,4,79,0,1,3,137,4,79,0,1,
+3,115,4,109,0,1,3,114,4,111,0,1,3,136,4,79,0,1,2,85,4,219,0,1,2,86,4,219,
+0,1,0,156,4,219,0,1,0,156,4,211,0,1,2,242,5,62,0,1,3,207,6,1,0,1,3,208,6,
+1,0,1,2,77,6,2,0,1,2,78,6,2,0,1,2,81,3,42,0,1,2,85,3,42,0,1,4,223,4,51,0,
+1,2,147,4,48,0,1,2,145,4,48,0,1,2,1,5,125,0,1,2,2,5,126,0,1,5,44,4,48,0,1,
+2,78,4,51,0,1,2,78,4,48,0,1,2,42,5,32,0,1,2,43,5,32,0,1,3,145,5,140,0,1,3,
+148,5,140,0,1,1,173,5,140,0,1,1,175,5,136,0,1,2,250,6,47,0,1,255,236,6,47,
+0,1,3,87,4,53,0,1,3,90,4,48,0,1,2,99,2,187,0,1,2,98,2,182,0,1,4,60,5,162,
+0,1,4,56,5,162,0,1,2,80,5,162,0,1,2,152,4,169,0,1,2,152,4,171,0,1,1,160,4,
+176,0,1,1,160,4,173,0,1,2,8,3,187,0,1,1,131,2,109,0,1,2,1,5,128,0,1,1,117,
+5,133,0,1,1,41,3,176,0,1,1,114,5,133,0,1,1,122,5,133,0,1,1,122,5,135,0,1,
+3,68,4,55,0,1,3,65,4,52,0,1,1,180,4,48,0,1,1,182,4,48,0,1,255,165,6,47,0,
+1,255,161,6,47,0,1,255,164,6,47,0,1,255,165,6,43,0,1,255,164,6,43,0,1,255,
+162,6,47,0,1,255,236,4,218,0,1,255,236,4,217,0,1,1,184,4,51,0,1,1,184,4,48,
+0,1,1,247,4,51,0,1,1,247,4,48,0,1,255,38,6,47,0,1,2,253,6,47,0,1,255,238,
+6,47,0,1,2,252,6,45,0,1,255,243,6,47,0,1,255,163,6,47,0,1,2,2,4,53,0,1,1,
+254,4,53,0,1,3,255,4,48,0,1,2,24,4,48,0,1,2,244,5,62,0,1,1,147,5,62,0,1,1,
+58,3,226,0,1,1,72,4,48,0,4,0,1,0,1,0,8,0,1,0,12,0,68,0,1,0,96,0,208,0,1,0,
+26,0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,0,156,0,158,0,160,0,162,
+0,164,0,172,0,173,0,174,0,175,0,176,0,177,0,178,0,181,0,184,0,189,0,203,0,
+204,1,36,0,2,0,4,0,8,0,12,0,0,0,14,0,51,0,5,0,53,0,124,0,43,0,247,1,34,0,
+115,0,26,0,0,5,110,0,0,5,110,0,0,5,110,0,0,5,110,0,0,5,110,0,0,5,110,0,0,
+5,110,0,0,5,110,0,0,5,110,0,0,0,106,0,0,5,110,0,0,5,110,0,0,5,110,0,0,5,110,
+0,0,5,110,0,0,0,106,0,0,5,110,0,0,5,110,0,0,5,110,0,0,5,110,0,0,5,110,0,0,
+5,110,0,0,5,110,0,0,5,110,0,0,5,110,0,0,5,110,0,1,0,0,0,1,0,159,1,64,1,64,
+1,70,1,76,1,82,1,88,3,74,3,80,1,94,1,100,3,32,3,38,3,38,1,100,3,32,3,38,3,
+38,1,106,3,62,3,68,3,68,1,112,1,118,1,124,1,130,1,136,3,98,1,142,1,148,2,
+90,2,90,3,44,3,44,1,154,1,154,3,44,3,44,1,154,1,154,1,160,1,160,1,166,1,172,
+1,178,1,184,1,190,1,196,1,202,1,208,3,50,3,50,1,214,1,220,1,226,1,232,1,238,
+1,244,3,104,1,250,2,0,2,0,2,6,2,6,2,12,2,18,2,24,2,24,3,86,2,30,2,36,3,80,
+3,86,3,86,3,92,2,42,2,48,2,48,2,54,2,60,2,66,2,66,2,72,2,72,2,78,2,78,2,84,
+2,90,2,96,2,96,2,102,2,102,2,108,2,114,2,120,2,156,2,126,2,126,3,44,3,44,
+3,50,3,50,2,132,2,138,2,144,2,144,2,150,2,156,2,162,2,168,2,174,2,174,2,180,
+2,186,2,192,2,198,3,68,3,68,2,204,2,204,2,210,2,216,2,222,2,228,2,234,2,234,
+2,240,2,240,2,246,2,252,3,56,3,56,2,252,2,252,2,252,2,252,2,252,2,252,3,2,
+3,8,3,14,3,14,3,20,3,20,3,32,3,38,3,26,3,32,3,38,3,44,3,50,3,56,3,62,3,68,
+3,74,3,80,3,86,3,92,3,98,3,104,0,1,1,118,255,56,0,1,1,121,254,223,0,1,1,96,
+254,224,0,1,1,96,254,223,0,1,2,255,255,54,0,1,1,148,255,56,0,1,3,19,255,56,
+0,1,2,20,253,242,0,1,3,48,255,56,0,1,3,50,255,56,0,1,2,80,255,56,0,1,2,79,
+255,56,0,1,1,21,254,158,0,1,4,163,255,56,0,1,4,164,255,56,0,1,1,103,255,56,
+0,1,3,240,255,56,0,1,1,75,255,56,0,1,1,74,255,57,0,1,1,199,252,229,0,1,2,
+9,253,84,0,1,1,221,255,56,0,1,1,248,255,56,0,1,3,44,255,56,0,1,3,42,255,56,
+0,1,3,123,255,54,0,1,3,124,255,54,0,1,2,215,255,56,0,1,2,216,255,56,0,1,1,
+110,254,136,0,1,1,54,252,115,0,1,1,99,255,57,0,1,4,186,255,56,0,1,2,235,255,
+56,0,1,3,136,255,52,0,1,3,136,255,56,0,1,2,234,255,56,0,1,2,162,255,56,0,
+1,1,150,255,56,0,1,1,168,255,56,0,1,3,93,255,56,0,1,2,60,255,56,0,1,2,62,
+255,56,0,1,2,24,252,116,0,1,3,221,255,54,0,1,2,135,255,56,0,1,2,15,255,56,
+0,1,2,16,255,56,0,1,3,194,255,56,0,1,2,61,255,56,0,1,2,30,255,87,0,1,2,27,
+255,87,0,1,3,35,255,56,0,1,2,10,255,56,0,1,3,128,255,56,0,1,3,125,255,56,
+0,1,2,45,252,115,0,1,3,35,255,60,0,1,3,35,255,55,0,1,2,9,255,56,0,1,2,11,
+255,56,0,1,2,151,255,57,0,1,1,152,255,56,0,1,1,156,255,56,0,1,1,231,255,56,
+0,1,1,124,255,56,0,1,1,137,254,224,0,1,1,71,254,223,0,1,1,133,254,223,0,1,
+1,65,254,198,0,1,1,64,254,200,0,1,3,58,255,56,0,1,1,72,255,56,0,1,0,149,255,
+56,0,1,0,150,255,56,0,1,1,50,255,56,0,1,1,74,255,56,0,1,1,167,255,56,0,1,
+1,230,255,56,0,1,0,152,255,56,0,1,2,250,255,56,0,1,1,95,255,56,0,1,3,118,
+255,56,0,1,1,90,255,56,0,1,0,146,255,56,0,1,2,17,253,242,0,1,2,18,255,56,
+0,1,2,255,255,56,0,1,1,149,255,56,0,1,2,237,255,56,0,1,1,168,255,57,0,1,1,
+87,254,157,0,1,1,99,255,56,0,4,0,1,0,1,0,8,0,1,13,116,0,12,0,1,0,70,0,86,
+0,2,0,9,0,14,0,23,0,0,0,26,0,29,0,10,0,53,0,56,0,14,0,81,0,84,0,18,0,101,
+0,102,0,22,0,251,0,251,0,24,1,1,1,4,0,25,1,19,1,22,0,29,1,27,1,32,0,33,0,
+2,0,0,0,10,0,0,0,10,0,1,0,0,4,87,0,39,0,200,0,200,0,206,0,206,0,86,0,182,
+0,170,0,80,0,86,0,182,0,92,0,188,0,98,0,194,0,104,0,110,0,116,0,122,0,128,
+0,212,0,218,0,134,0,140,0,146,0,152,0,158,0,158,0,176,0,164,0,182,0,170,0,
+176,0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,1,2,224,2,153,0,1,5,241,2,
+150,0,1,3,232,3,58,0,1,3,230,3,60,0,1,4,92,3,173,0,1,4,50,3,189,0,1,4,18,
+3,70,0,1,4,18,3,71,0,1,5,81,4,191,0,1,3,242,4,190,0,1,4,51,3,95,0,1,4,53,
+3,96,0,1,1,245,2,146,0,1,3,181,3,242,0,1,2,24,2,153,0,1,2,225,2,153,0,1,2,
+25,2,153,0,1,5,240,2,153,0,1,3,230,3,59,0,1,3,231,3,60,0,1,5,246,3,242,0,
+1,4,15,3,242,0,1,5,83,4,190,0,1,3,244,4,191,0,4,0,1,0,1,0,8,0,1,17,196,0,
+12,0,1,0,64,0,80,0,2,0,8,0,14,0,29,0,0,0,53,0,56,0,16,0,81,0,84,0,20,0,101,
+0,102,0,24,0,251,0,251,0,26,1,1,1,4,0,27,1,19,1,23,0,31,1,27,1,32,0,36,0,
+2,0,0,0,10,0,0,0,10,0,1,0,0,0,0,0,42,0,86,0,224,0,230,0,92,0,98,0,206,0,212,
+0,104,0,98,0,206,0,212,0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,0,
+152,0,236,0,236,0,242,0,158,0,164,0,170,0,176,0,182,0,188,0,200,0,194,0,206,
+0,212,0,200,0,206,0,212,0,218,0,218,0,224,0,230,0,236,0,242,0,1,5,178,255,
+91,0,1,3,204,255,90,0,1,5,62,255,70,0,1,2,48,255,70,0,1,3,205,255,91,0,1,
+3,130,255,100,0,1,3,205,255,89,0,1,3,131,255,89,0,1,4,77,253,90,0,1,4,225,
+255,117,0,1,3,252,255,91,0,1,4,45,255,71,0,1,3,202,255,90,0,1,4,149,255,94,
+0,1,4,96,255,94,0,1,1,216,255,95,0,1,3,104,255,70,0,1,3,104,255,90,0,1,1,
+104,255,70,0,1,1,40,255,70,0,1,4,255,255,70,0,1,1,240,255,70,0,1,3,128,255,
+99,0,1,5,196,255,68,0,1,3,204,255,70,0,1,5,41,255,90,0,1,3,203,255,74,0,6,
+0,1,0,1,0,8,0,1,0,12,0,90,0,1,0,100,1,12,0,1,0,37,0,13,0,140,0,143,0,145,
+0,146,0,150,0,153,0,155,0,159,0,161,0,163,0,165,0,166,0,179,0,180,0,182,0,
+183,0,185,0,186,0,187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,
+0,198,0,199,0,200,0,201,0,202,1,35,1,37,1,39,0,2,0,1,0,167,0,170,0,0,0,37,
+0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,
+0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,
+0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,
+0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,
+0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,150,0,0,0,156,0,0,0,162,0,1,
+0,0,4,91,0,1,254,111,6,117,0,1,254,42,6,41,0,4,0,10,0,16,0,22,0,28,0,1,0,
+5,5,150,0,1,0,5,5,107,0,1,0,8,5,170,0,1,0,5,5,195,0,6,0,1,0,1,0,8,0,1,0,12,
+0,50,0,1,0,68,0,144,0,1,0,17,0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,
+154,0,160,0,162,0,164,0,181,0,184,0,189,0,203,0,204,1,36,0,1,0,7,0,156,0,
+172,0,173,0,175,0,176,0,177,0,178,0,17,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,
+0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,
+0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,1,0,0,255,250,0,7,0,22,0,16,
+0,22,0,28,0,34,0,40,0,46,0,1,0,0,254,164,0,1,255,248,254,145,0,1,255,250,
+254,168,0,1,255,249,254,250,0,1,255,250,254,189,0,1,0,0,254,233,0,2,0,0,0,
+1,0,8,0,1,0,58,0,4,0,0,0,24,0,74,0,148,0,162,0,232,1,38,1,84,1,154,1,232,
+2,26,2,104,2,182,2,212,2,242,3,8,3,34,3,56,3,86,3,86,3,116,3,130,3,160,3,
+194,3,224,3,250,0,2,0,2,0,205,0,219,0,0,0,235,0,243,0,15,0,18,0,205,0,110,
+0,207,255,166,0,208,255,196,0,210,0,90,0,212,255,186,0,214,0,20,0,215,0,130,
+0,216,0,80,0,217,255,136,0,218,0,40,0,219,0,130,0,236,0,80,0,237,0,80,0,238,
+0,70,0,239,255,196,0,240,255,196,0,241,0,70,0,242,0,130,0,3,0,206,255,216,
+0,217,255,226,0,239,255,186,0,17,0,205,0,30,0,207,0,90,0,208,0,80,0,209,0,
+50,0,210,0,50,0,211,0,50,0,212,0,100,0,213,0,40,0,214,0,40,0,215,0,80,0,218,
+255,216,0,236,0,40,0,237,0,40,0,238,0,70,0,239,0,40,0,240,0,100,0,242,0,70,
+0,15,0,205,0,30,0,207,0,90,0,208,0,120,0,210,0,30,0,212,0,130,0,213,0,40,
+0,214,0,40,0,215,0,60,0,218,255,216,0,236,0,40,0,237,0,40,0,238,0,70,0,239,
+0,40,0,240,0,100,0,242,0,70,0,11,0,209,0,40,0,210,0,60,0,211,0,40,0,212,0,
+50,0,213,0,70,0,217,255,216,0,219,0,40,0,238,0,70,0,239,255,196,0,241,0,70,
+0,242,0,50,0,17,0,205,0,70,0,207,255,166,0,208,255,176,0,210,0,60,0,211,0,
+30,0,212,255,246,0,213,0,30,0,214,0,30,0,217,255,146,0,219,0,80,0,236,0,60,
+0,237,0,60,0,238,0,70,0,239,255,96,0,240,255,166,0,241,0,30,0,242,0,110,0,
+19,0,205,255,146,0,207,0,130,0,208,0,120,0,209,255,216,0,210,255,226,0,211,
+0,50,0,212,0,150,0,213,255,176,0,215,0,110,0,216,255,146,0,217,0,50,0,218,
+255,46,0,219,255,176,0,236,255,176,0,237,255,176,0,239,0,50,0,240,0,120,0,
+241,255,136,0,242,255,186,0,12,0,207,0,130,0,208,0,120,0,210,0,20,0,211,0,
+60,0,212,0,170,0,215,0,110,0,216,255,136,0,217,0,50,0,218,255,126,0,238,0,
+30,0,239,0,40,0,240,0,140,0,19,0,207,255,136,0,208,255,126,0,209,0,110,0,
+210,0,30,0,211,0,80,0,212,255,206,0,213,0,170,0,214,0,50,0,215,0,90,0,216,
+0,70,0,217,255,46,0,218,0,40,0,219,0,80,0,236,255,226,0,237,255,226,0,238,
+0,30,0,239,255,106,0,240,255,206,0,241,0,170,0,19,0,205,0,30,0,207,0,40,0,
+208,0,90,0,209,255,206,0,210,0,90,0,211,0,40,0,212,0,80,0,213,255,226,0,214,
+0,40,0,215,0,60,0,216,255,106,0,218,255,36,0,236,0,50,0,237,0,50,0,238,0,
+100,0,239,255,216,0,240,0,40,0,241,255,226,0,242,0,90,0,7,0,205,0,90,0,206,
+255,186,0,207,0,30,0,208,0,60,0,209,0,90,0,212,0,50,0,213,0,110,0,7,0,206,
+255,216,0,207,255,126,0,208,255,126,0,209,0,70,0,212,255,56,0,213,0,70,0,
+214,0,40,0,5,0,206,255,176,0,208,0,40,0,209,255,206,0,212,0,70,0,213,255,
+196,0,6,0,207,255,126,0,208,255,126,0,209,0,40,0,212,255,46,0,213,0,80,0,
+214,0,60,0,5,0,207,255,86,0,208,255,86,0,209,0,50,0,212,255,126,0,213,0,80,
+0,7,0,207,0,90,0,208,0,90,0,209,255,236,0,210,0,70,0,211,0,60,0,212,0,120,
+0,213,255,206,0,7,0,205,0,80,0,206,255,236,0,207,255,136,0,208,255,146,0,
+210,0,60,0,212,255,236,0,213,255,226,0,3,0,205,0,80,0,210,0,70,0,211,0,30,
+0,7,0,206,255,176,0,207,254,252,0,208,255,6,0,210,255,126,0,211,255,236,0,
+212,255,106,0,213,0,60,0,8,0,207,255,86,0,208,255,86,0,209,0,100,0,210,255,
+216,0,211,0,40,0,212,255,196,0,213,0,130,0,214,0,90,0,7,0,205,255,156,0,206,
+255,216,0,208,0,80,0,209,255,186,0,210,255,166,0,212,0,50,0,213,255,176,0,
+6,0,205,0,120,0,207,255,156,0,208,255,156,0,210,0,110,0,211,0,70,0,214,0,
+80,0,6,0,206,255,196,0,207,0,30,0,208,0,30,0,209,255,166,0,212,0,80,0,213,
+255,146,0,2,0,9,0,2,0,10,0,60,0,1,12,26,0,5,0,0,0,1,0,12,0,6,0,40,0,100,0,
+100,0,43,0,100,0,100,0,44,0,100,0,100,0,47,0,100,0,100,1,8,0,100,0,100,1,
+10,0,100,0,100,0,2,2,64,0,5,0,0,2,134,2,222,0,10,0,14,0,0,0,0,0,75,0,75,0,
+0,0,0,2,158,2,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,206,255,206,0,0,0,0,
+0,220,0,220,0,150,0,150,255,206,255,206,0,30,0,30,0,0,0,0,255,206,255,206,
+255,206,255,206,255,131,255,131,255,191,255,191,0,0,0,0,255,206,255,206,255,
+206,255,206,255,156,255,156,255,206,255,206,255,206,255,206,255,206,255,206,
+0,0,0,0,0,0,0,0,0,0,0,0,255,206,255,206,255,231,255,231,255,126,255,126,255,
+206,255,206,0,0,0,0,255,206,255,206,0,0,0,0,255,156,255,156,255,181,255,181,
+255,231,255,231,255,231,255,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+100,0,100,0,0,0,0,255,206,255,206,0,25,0,25,0,75,0,75,0,0,0,0,0,50,0,50,0,
+100,0,100,0,100,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,105,
+0,0,0,0,255,206,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,75,0,75,0,
+75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,50,255,181,255,181,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,206,255,206,0,50,0,50,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,75,0,75,0,75,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+144,1,144,255,181,255,181,0,0,0,0,0,0,0,0,0,0,0,0,255,206,255,206,255,231,
+255,231,0,75,0,75,0,75,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,
+0,125,0,0,0,0,255,206,255,206,255,206,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,75,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,0,100,0,100,0,100,0,0,0,0,0,0,0,
+0,0,1,0,33,0,8,0,9,0,10,0,11,0,12,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,
+0,34,0,35,0,89,0,90,0,95,0,96,0,101,0,102,0,111,0,112,0,113,0,114,0,123,0,
+247,0,248,0,253,0,254,1,27,1,28,1,33,0,2,0,14,0,8,0,12,0,3,0,26,0,29,0,4,
+0,30,0,31,0,1,0,32,0,33,0,2,0,34,0,35,0,5,0,95,0,96,0,4,0,101,0,102,0,6,0,
+111,0,112,0,8,0,113,0,114,0,7,0,123,0,123,0,9,0,247,0,248,0,4,0,253,0,254,
+0,3,1,27,1,28,0,4,1,33,1,33,0,5,0,2,0,28,0,8,0,10,0,9,0,18,0,18,0,10,0,21,
+0,22,0,10,0,25,0,25,0,10,0,32,0,32,0,5,0,34,0,34,0,7,0,36,0,36,0,8,0,39,0,
+39,0,8,0,40,0,40,0,4,0,43,0,44,0,4,0,47,0,47,0,4,0,48,0,48,0,8,0,51,0,51,
+0,8,0,56,0,56,0,2,0,57,0,57,0,11,0,60,0,60,0,11,0,65,0,65,0,3,0,89,0,89,0,
+13,0,101,0,101,0,6,0,107,0,107,0,10,0,110,0,110,0,10,0,113,0,113,0,12,0,123,
+0,123,0,1,1,4,1,4,0,10,1,6,1,6,0,10,1,8,1,8,0,4,1,10,1,10,0,4,1,12,1,12,0,
+11,0,8,0,1,0,11,0,28,0,50,0,72,0,94,0,116,0,138,0,160,0,182,0,204,0,226,0,
+246,0,3,0,1,5,2,0,1,13,162,0,2,14,236,0,238,0,1,0,0,0,29,0,3,0,2,14,214,4,
+236,0,1,13,140,0,1,0,216,0,1,0,0,0,29,0,3,0,2,0,194,4,214,0,1,13,118,0,1,
+14,192,0,1,0,0,0,29,0,3,0,3,14,170,0,172,4,192,0,1,13,96,0,0,0,1,0,0,0,29,
+0,3,0,1,4,170,0,1,13,74,0,2,0,150,14,148,0,1,0,0,0,29,0,3,0,3,0,128,14,126,
+4,148,0,1,13,52,0,0,0,1,0,0,0,29,0,3,0,1,4,126,0,1,13,30,0,2,13,30,0,106,
+0,1,0,0,0,29,0,3,0,2,0,84,4,104,0,1,13,8,0,1,13,8,0,1,0,0,0,29,0,3,0,1,4,
+82,0,1,12,242,0,2,0,62,12,242,0,1,0,0,0,29,0,3,0,1,4,60,0,1,12,220,0,1,0,
+40,0,1,0,0,0,29,0,3,0,2,0,20,4,40,0,1,12,200,0,0,0,1,0,0,0,29,0,1,0,2,1,44,
+1,46,0,8,0,1,0,26,0,58,0,82,0,106,0,130,0,154,0,178,0,202,0,226,0,250,1,18,
+1,40,1,62,1,84,1,106,1,128,1,150,1,172,1,194,1,216,1,238,2,4,2,24,2,44,2,
+66,2,88,2,168,0,3,0,2,12,114,2,130,0,1,13,188,0,2,5,76,2,164,0,1,0,0,0,29,
+0,3,0,1,2,106,0,1,13,164,0,3,12,90,5,52,2,140,0,1,0,0,0,29,0,3,0,3,12,66,
+5,28,2,82,0,1,13,140,0,1,2,116,0,1,0,0,0,29,0,3,0,2,5,4,2,58,0,1,13,116,0,
+2,12,42,2,92,0,1,0,0,0,29,0,3,0,3,4,236,12,18,2,34,0,1,13,92,0,1,2,68,0,1,
+0,0,0,29,0,3,0,1,2,10,0,1,13,68,0,3,4,212,11,250,2,44,0,1,0,0,0,29,0,3,0,
+1,1,242,0,1,13,44,0,3,13,44,4,188,2,20,0,1,0,0,0,29,0,3,0,2,4,164,1,218,0,
+1,13,20,0,2,13,20,1,252,0,1,0,0,0,29,0,3,0,1,1,194,0,1,12,252,0,3,4,140,12,
+252,1,228,0,1,0,0,0,29,0,3,0,1,1,170,0,1,12,228,0,2,4,116,1,204,0,1,0,0,0,
+29,0,3,0,2,4,94,1,148,0,1,12,206,0,1,1,182,0,1,0,0,0,29,0,3,0,2,11,110,1,
+126,0,1,12,184,0,1,4,72,0,1,0,0,0,30,0,3,0,1,1,104,0,1,12,162,0,2,11,88,4,
+50,0,1,0,0,0,30,0,3,0,3,11,66,4,28,1,82,0,1,12,140,0,0,0,1,0,0,0,30,0,3,0,
+2,4,6,1,60,0,1,12,118,0,1,11,44,0,1,0,0,0,30,0,3,0,3,3,240,11,22,1,38,0,1,
+12,96,0,0,0,1,0,0,0,30,0,3,0,1,1,16,0,1,12,74,0,2,3,218,11,0,0,1,0,0,0,30,
+0,3,0,1,0,250,0,1,12,52,0,2,12,52,3,196,0,1,0,0,0,30,0,3,0,2,3,174,0,228,
+0,1,12,30,0,1,12,30,0,1,0,0,0,30,0,3,0,1,0,206,0,1,12,8,0,2,3,152,12,8,0,
+1,0,0,0,30,0,3,0,1,0,184,0,1,11,242,0,1,3,130,0,1,0,0,0,30,0,3,0,2,3,110,
+0,164,0,1,11,222,0,0,0,1,0,0,0,30,0,3,0,2,10,128,0,66,0,1,11,202,0,1,0,178,
+0,1,0,0,0,31,0,3,0,1,0,44,0,1,11,180,0,2,10,106,0,156,0,1,0,0,0,31,0,3,0,
+1,0,22,0,1,11,158,0,2,11,158,0,134,0,1,0,0,0,31,0,1,0,27,0,20,0,21,0,24,0,
+25,0,42,0,43,0,46,0,47,0,59,0,60,0,109,0,110,1,3,1,4,1,5,1,6,1,7,1,8,1,9,
+1,10,1,11,1,12,1,20,1,21,1,23,1,25,1,26,0,3,0,1,0,20,0,1,11,78,0,1,0,54,0,
+1,0,0,0,31,0,1,0,15,0,20,0,21,0,24,0,25,0,109,0,110,1,3,1,4,1,5,1,6,1,20,
+1,21,1,23,1,25,1,26,0,1,0,16,0,19,0,20,0,23,0,24,0,108,0,109,1,3,1,5,1,19,
+1,20,1,21,1,22,1,23,1,24,1,25,1,26,0,8,0,1,0,11,0,28,0,50,0,72,0,94,0,116,
+0,138,0,160,0,182,0,204,0,226,0,246,0,3,0,2,9,142,0,238,0,1,10,216,0,1,2,
+104,0,1,0,0,0,32,0,3,0,1,0,216,0,1,10,194,0,2,9,120,2,82,0,1,0,0,0,32,0,3,
+0,3,9,98,2,60,0,194,0,1,10,172,0,0,0,1,0,0,0,32,0,3,0,2,2,38,0,172,0,1,10,
+150,0,1,9,76,0,1,0,0,0,32,0,3,0,3,2,16,9,54,0,150,0,1,10,128,0,0,0,1,0,0,
+0,32,0,3,0,1,0,128,0,1,10,106,0,2,1,250,9,32,0,1,0,0,0,32,0,3,0,1,0,106,0,
+1,10,84,0,2,10,84,1,228,0,1,0,0,0,32,0,3,0,2,1,206,0,84,0,1,10,62,0,1,10,
+62,0,1,0,0,0,32,0,3,0,1,0,62,0,1,10,40,0,2,1,184,10,40,0,1,0,0,0,32,0,3,0,
+1,0,40,0,1,10,18,0,1,1,162,0,1,0,0,0,32,0,3,0,2,1,142,0,20,0,1,9,254,0,0,
+0,1,0,0,0,32,0,1,0,1,0,251,0,8,1,1,0,1,0,8,0,3,0,1,0,22,0,1,9,114,0,2,0,56,
+8,146,0,1,0,0,0,33,0,1,0,15,0,20,0,21,0,24,0,25,0,42,0,43,0,46,0,47,0,59,
+0,60,0,109,0,110,1,20,1,23,1,25,0,1,0,2,0,11,0,12,0,8,1,1,0,1,0,8,0,3,0,1,
+0,22,0,1,9,42,0,2,0,30,8,74,0,1,0,0,0,34,0,1,0,2,0,59,0,60,0,1,0,2,0,249,
+0,250,0,8,2,1,0,1,0,8,0,3,0,1,10,194,0,1,9,102,0,1,0,70,0,1,0,0,0,35,0,8,
+2,1,0,2,0,10,0,30,0,3,0,0,0,1,9,132,0,2,9,72,0,40,0,1,0,0,0,35,0,3,0,0,0,
+1,9,130,0,2,9,52,0,20,0,1,0,0,0,35,0,1,0,8,0,18,0,21,0,22,0,25,0,107,0,110,
+1,4,1,6,0,8,3,1,0,2,0,10,0,30,0,3,0,0,0,1,10,94,0,2,0,114,0,146,0,1,0,0,0,
+36,0,3,0,0,0,1,10,74,0,2,0,120,0,126,0,1,0,0,0,36,0,8,5,1,0,4,0,14,0,34,0,
+54,0,80,0,3,0,0,0,1,9,84,0,2,0,60,0,92,0,1,0,0,0,37,0,3,0,0,0,1,9,64,0,2,
+0,66,0,72,0,1,0,0,0,37,0,3,0,0,0,1,10,0,0,2,0,20,0,52,0,1,0,0,0,37,0,1,0,
+1,0,26,0,3,0,0,0,1,9,230,0,2,0,20,0,26,0,1,0,0,0,37,0,1,0,1,0,28,0,1,0,2,
+1,45,1,47,0,8,2,1,0,3,0,12,0,32,0,52,0,3,0,1,8,170,0,1,9,78,0,1,7,228,0,1,
+0,0,0,38,0,3,0,1,0,118,0,1,9,58,0,1,7,208,0,1,0,0,0,39,0,3,0,1,9,144,0,1,
+9,38,0,1,7,188,0,1,0,0,0,40,0,8,2,1,0,6,0,18,0,38,0,58,0,86,0,106,0,126,0,
+3,0,1,8,74,0,1,9,74,0,1,7,150,0,1,0,0,0,40,0,3,0,1,8,72,0,1,9,54,0,1,7,130,
+0,1,0,0,0,39,0,3,0,1,0,20,0,1,9,34,0,1,7,110,0,1,0,0,0,38,0,1,0,2,0,30,0,
+31,0,3,0,1,0,158,0,1,9,6,0,1,7,82,0,1,0,0,0,40,0,3,0,1,9,18,0,1,8,242,0,1,
+7,62,0,1,0,0,0,41,0,3,0,1,9,18,0,1,8,222,0,1,7,42,0,1,0,0,0,40,0,8,2,1,0,
+6,0,18,0,38,0,58,0,78,0,106,0,126,0,3,0,0,0,1,7,184,0,2,8,110,7,4,0,1,0,0,
+0,41,0,3,0,0,0,1,8,234,0,2,8,90,6,240,0,1,0,0,0,41,0,3,0,0,0,1,0,140,0,2,
+8,70,6,220,0,1,0,0,0,41,0,3,0,0,0,1,0,20,0,2,8,50,6,200,0,1,0,0,0,41,0,1,
+0,2,0,32,0,33,0,3,0,0,0,1,8,148,0,2,8,22,6,172,0,1,0,0,0,41,0,3,0,0,0,1,0,
+102,0,2,8,2,6,152,0,1,0,0,0,41,0,8,2,1,0,3,0,12,0,32,0,62,0,3,0,0,0,1,8,114,
+0,2,8,44,6,120,0,1,0,0,0,40,0,3,0,0,0,1,0,20,0,2,8,24,6,100,0,1,0,0,0,41,
+0,1,0,3,0,26,0,27,1,27,0,3,0,0,0,1,0,20,0,2,7,250,6,70,0,1,0,0,0,41,0,1,0,
+1,0,123,0,8,1,1,0,6,0,18,0,40,0,62,0,84,0,106,0,128,0,3,0,0,0,1,1,152,0,3,
+5,72,1,152,0,132,0,1,0,0,0,34,0,3,0,0,0,1,1,54,0,3,5,50,1,130,0,110,0,1,0,
+0,0,34,0,3,0,0,0,1,1,60,0,3,5,28,1,108,0,88,0,1,0,0,0,34,0,3,0,0,0,1,1,86,
+0,3,0,66,1,86,5,6,0,1,0,0,0,34,0,3,0,0,0,1,0,244,0,3,0,44,1,64,4,240,0,1,
+0,0,0,34,0,3,0,0,0,1,0,250,0,3,0,22,1,42,4,218,0,1,0,0,0,34,0,1,0,34,0,140,
+0,143,0,146,0,150,0,153,0,161,0,163,0,165,0,166,0,167,0,168,0,170,0,179,0,
+180,0,182,0,183,0,185,0,186,0,187,0,188,0,191,0,192,0,193,0,194,0,195,0,196,
+0,197,0,198,0,199,0,200,0,201,0,202,1,37,1,39,0,8,2,1,0,6,0,18,0,40,0,62,
+0,84,0,106,0,134,0,3,0,0,0,1,0,186,0,3,5,180,0,186,0,144,0,1,0,0,0,41,0,3,
+0,0,0,1,0,88,0,3,5,158,0,164,0,122,0,1,0,0,0,41,0,3,0,0,0,1,0,94,0,3,5,136,
+0,142,0,100,0,1,0,0,0,41,0,3,0,0,0,1,0,120,0,3,0,78,0,120,0,126,0,1,0,0,0,
+41,0,3,0,0,0,1,0,22,0,3,0,56,0,98,0,104,0,1,0,0,0,41,0,1,0,1,0,35,0,3,0,0,
+0,1,0,22,0,3,0,28,0,70,0,76,0,1,0,0,0,41,0,1,0,1,1,33,0,1,0,19,0,141,0,144,
+0,147,0,148,0,149,0,151,0,154,0,162,0,164,0,173,0,175,0,176,0,177,0,178,0,
+181,0,184,0,189,0,203,0,204,0,1,0,1,0,34,0,1,0,25,0,141,0,144,0,147,0,148,
+0,149,0,151,0,152,0,154,0,158,0,160,0,162,0,164,0,172,0,173,0,174,0,175,0,
+176,0,177,0,178,0,181,0,184,0,189,0,203,0,204,1,36,0,8,1,1,0,1,0,8,0,3,0,
+1,0,56,0,1,6,138,0,0,0,1,0,0,0,42,0,8,2,1,0,7,0,20,0,54,0,86,0,114,0,140,
+0,166,0,192,0,3,0,1,0,18,0,1,6,210,0,0,0,1,0,0,0,41,0,1,0,6,0,69,0,70,0,71,
+0,72,0,75,0,76,0,3,0,1,0,18,0,1,6,176,0,0,0,1,0,0,0,43,0,1,0,5,0,16,0,17,
+1,1,1,2,1,30,0,3,0,1,0,18,0,1,6,144,0,0,0,1,0,0,0,44,0,1,0,3,0,14,0,15,1,
+29,0,3,0,1,0,18,0,1,6,116,0,0,0,1,0,0,0,45,0,1,0,2,0,63,0,64,0,3,0,1,0,18,
+0,1,6,90,0,0,0,1,0,0,0,46,0,1,0,2,0,91,0,92,0,3,0,1,0,18,0,1,6,64,0,0,0,1,
+0,0,0,47,0,1,0,2,0,97,0,98,0,3,0,1,0,18,0,1,6,38,0,0,0,1,0,0,0,48,0,1,0,1,
+0,77,0,8,2,1,0,1,0,8,0,3,0,1,0,18,0,1,0,26,0,0,0,1,0,0,0,48,0,1,0,2,0,26,
+0,27,0,1,0,1,0,158,0,8,0,9,0,11,0,28,0,70,0,88,0,106,0,124,0,142,0,160,0,
+178,0,196,0,220,0,246,0,3,0,0,0,1,0,18,0,1,0,34,0,1,0,0,0,49,0,1,0,6,0,89,
+0,90,0,95,0,96,0,101,0,102,0,1,0,2,0,126,0,130,0,3,0,0,0,1,5,234,0,1,1,212,
+0,1,0,0,0,49,0,3,0,0,0,1,6,56,0,1,0,150,0,1,0,0,0,49,0,3,0,0,0,1,5,182,0,
+1,0,132,0,1,0,0,0,49,0,3,0,0,0,1,5,164,0,1,0,146,0,1,0,0,0,50,0,3,0,0,0,1,
+6,94,0,1,0,96,0,1,0,0,0,50,0,3,0,0,0,1,6,76,0,1,0,110,0,1,0,0,0,49,0,3,0,
+0,0,1,0,36,0,1,0,60,0,1,0,0,0,50,0,3,0,0,0,1,0,18,0,1,0,74,0,1,0,0,0,50,0,
+1,0,1,0,61,0,3,0,0,0,1,0,44,0,1,0,18,0,1,0,0,0,50,0,1,0,2,0,127,0,134,0,3,
+0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,50,0,1,0,1,0,62,0,1,0,2,0,129,0,131,0,8,0,
+9,0,6,0,18,0,42,0,66,0,90,0,114,0,138,0,3,0,0,0,1,0,18,0,1,0,144,0,1,0,0,
+0,50,0,1,0,1,0,90,0,3,0,0,0,1,0,18,0,1,0,120,0,1,0,0,0,50,0,1,0,1,0,89,0,
+3,0,0,0,1,0,18,0,1,0,96,0,1,0,0,0,50,0,1,0,1,0,112,0,3,0,0,0,1,0,18,0,1,0,
+72,0,1,0,0,0,50,0,1,0,1,0,111,0,3,0,0,0,1,0,18,0,1,0,48,0,1,0,0,0,50,0,1,
+0,1,0,114,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,50,0,1,0,1,0,113,0,1,0,1,0,
+130,0,8,1,1,0,5,0,16,0,36,0,54,0,74,0,104,0,3,0,0,0,1,1,78,0,2,0,140,0,76,
+0,1,0,0,0,42,0,3,0,0,0,1,1,58,0,1,0,56,0,1,0,0,0,34,0,3,0,0,0,1,1,56,0,2,
+0,102,0,38,0,1,0,0,0,42,0,3,0,0,0,1,1,36,0,1,0,18,0,1,0,0,0,34,0,1,0,4,0,
+126,0,128,0,130,0,133,0,3,0,0,0,1,1,6,0,1,0,18,0,1,0,0,0,33,0,1,0,1,0,134,
+0,1,0,1,0,2,0,10,0,20,0,1,1,92,0,3,0,238,254,68,0,1,0,8,0,2,0,150,0,1,0,44,
+0,13,0,140,0,143,0,145,0,146,0,150,0,153,0,155,0,156,0,157,0,159,0,161,0,
+163,0,165,0,166,0,167,0,168,0,169,0,170,0,171,0,179,0,180,0,182,0,183,0,185,
+0,186,0,187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,
+199,0,200,0,201,0,202,1,35,1,37,1,39,0,1,0,1,0,1,0,8,0,1,0,230,0,2,254,68,
+0,1,0,1,0,1,0,8,0,1,0,214,0,3,0,88,255,150,0,1,0,1,0,1,0,8,0,1,0,196,0,2,
+254,237,0,1,1,1,0,2,0,10,0,20,0,1,0,58,0,5,255,156,255,156,0,1,0,62,0,1,1,
+124,0,1,1,1,0,4,0,14,0,30,0,46,1,242,0,1,0,10,0,5,255,156,255,156,0,1,0,1,
+0,66,0,1,0,10,0,5,255,181,255,181,0,1,0,1,0,65,0,1,0,8,0,1,1,114,0,1,0,40,
+0,13,0,140,0,143,0,145,0,146,0,150,0,153,0,155,0,156,0,159,0,161,0,163,0,
+165,0,166,0,167,0,168,0,169,0,170,0,179,0,180,0,182,0,183,0,185,0,186,0,187,
+0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,0,
+201,0,202,1,35,0,1,2,1,0,3,0,12,0,72,0,90,0,1,0,10,0,3,0,75,254,182,0,1,0,
+23,0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,0,158,0,160,0,162,0,164,
+0,172,0,173,0,174,0,175,0,176,0,177,0,178,0,181,0,184,0,189,1,36,0,1,0,10,
+0,5,0,150,0,150,0,1,0,2,0,8,0,9,0,1,0,10,0,5,0,200,0,200,0,1,0,8,0,10,0,11,
+0,12,0,249,0,250,0,252,0,253,0,254,0,1,3,1,0,1,0,8,0,1,0,242,0,5,0,170,0,
+170,0,1,5,1,0,2,0,10,0,36,0,1,0,10,0,5,0,100,0,100,0,2,0,2,0,8,0,12,0,0,0,
+253,0,254,0,5,0,1,0,196,0,5,0,130,0,130,0,1,2,1,0,2,0,10,0,18,0,1,0,70,0,
+2,253,148,0,1,0,136,0,4,0,200,0,1,2,1,0,2,0,10,0,18,0,1,0,118,0,2,253,148,
+0,1,0,36,0,4,0,200,0,1,2,1,0,3,0,12,0,20,0,64,0,1,0,90,0,2,253,60,0,1,0,8,
+0,2,253,213,0,1,0,16,0,148,0,149,0,152,0,160,0,162,0,164,0,172,0,173,0,175,
+0,176,0,177,0,178,0,181,0,184,0,189,1,36,0,1,0,108,0,5,1,44,1,44,0,1,2,1,
+0,7,0,20,0,42,0,50,0,70,0,88,0,116,0,136,0,1,0,8,0,2,253,213,0,1,0,5,0,141,
+0,144,0,147,0,151,0,154,0,1,0,248,0,1,0,75,0,1,0,10,0,5,0,100,0,100,0,1,0,
+3,0,34,0,35,1,33,0,1,0,10,0,5,0,225,0,225,0,1,0,2,0,101,0,102,0,1,0,10,0,
+5,0,250,0,250,0,1,0,7,0,28,0,29,0,95,0,96,0,247,0,248,1,28,0,1,0,10,0,5,1,
+44,1,44,0,1,0,3,0,32,0,33,0,123,0,1,0,10,0,5,1,69,1,69,0,1,0,5,0,8,0,9,0,
+26,0,27,1,27,0,1,1,1,0,2,0,10,0,26,0,2,0,10,0,1,0,1,255,181,0,1,0,1,1,35,
+0,2,0,16,0,5,0,2,0,10,0,10,0,100,0,100,0,1,0,2,0,65,0,66,0,1,2,1,0,1,0,8,
+0,1,0,72,0,1,0,130,0,1,2,1,0,1,0,8,0,1,0,56,0,1,1,0,0,1,2,1,0,1,0,8,0,1,0,
+40,0,1,1,22,0,1,2,1,0,1,0,8,0,1,0,24,0,1,1,4,0,1,2,1,0,1,0,8,0,1,0,8,0,1,
+1,107,0,1,0,1,1,36,0,1,2,1,0,1,0,8,0,2,0,12,0,1,0,2,0,31,255,182,0,1,0,2,
+0,158,1,36,0,1,0,9,0,4,0,14,0,30,0,126,0,158,0,1,0,10,0,5,255,56,255,56,0,
+1,0,1,0,53,0,1,0,10,0,5,255,156,255,156,0,1,0,41,0,14,0,15,0,18,0,19,0,22,
+0,23,0,36,0,37,0,40,0,41,0,44,0,45,0,48,0,49,0,57,0,58,0,69,0,70,0,77,0,78,
+0,81,0,82,0,85,0,86,0,91,0,92,0,97,0,98,0,103,0,104,0,107,0,108,0,115,0,116,
+0,119,0,120,1,19,1,22,1,24,1,29,1,31,0,1,0,10,0,5,255,181,255,181,0,1,0,9,
+0,30,0,31,0,32,0,33,0,34,0,35,0,73,0,74,1,33,0,1,0,10,0,5,255,186,255,186,
+0,1,0,7,0,54,0,89,0,90,0,95,0,96,0,101,0,102,0,1,0,9,0,4,0,14,0,32,0,48,0,
+72,0,1,0,10,0,5,255,56,255,56,0,1,0,2,0,111,0,112,0,1,0,10,0,5,255,131,255,
+131,0,1,0,1,0,54,0,1,0,10,0,5,255,156,255,156,0,1,0,5,0,53,0,61,0,62,0,89,
+0,90,0,1,0,10,0,5,255,186,255,186,0,1,0,2,0,113,0,114,0,1,0,0,0,10,0,100,
+1,164,0,2,68,70,76,84,0,14,115,121,114,99,0,52,0,4,0,0,0,0,255,255,0,14,0,
+0,0,2,0,4,0,6,0,8,0,10,0,12,0,14,0,16,0,18,0,20,0,22,0,24,0,26,0,4,0,0,0,
+0,255,255,0,14,0,1,0,3,0,5,0,7,0,9,0,11,0,13,0,15,0,17,0,19,0,21,0,23,0,25,
+0,27,0,28,97,97,108,116,0,170,97,97,108,116,0,170,99,97,108,116,0,178,99,
+97,108,116,0,178,99,99,109,112,0,246,99,99,109,112,0,246,102,105,110,50,0,
+254,102,105,110,50,0,254,102,105,110,51,1,4,102,105,110,51,1,4,102,105,110,
+97,1,10,102,105,110,97,1,10,105,110,105,116,1,16,105,110,105,116,1,16,109,
+101,100,50,1,22,109,101,100,50,1,22,109,101,100,105,1,28,109,101,100,105,
+1,28,114,108,105,103,1,34,114,108,105,103,1,34,115,97,108,116,1,40,115,97,
+108,116,1,40,115,115,48,49,1,46,115,115,48,49,1,46,115,115,48,50,1,52,115,
+115,48,50,1,52,115,115,48,51,1,58,115,115,48,51,1,58,0,0,0,2,0,0,0,1,0,0,
+0,32,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,
+0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,
+0,42,0,43,0,44,0,0,0,2,0,2,0,3,0,0,0,1,0,8,0,0,0,1,0,9,0,0,0,1,0,7,0,0,0,
+1,0,4,0,0,0,1,0,6,0,0,0,1,0,5,0,0,0,1,0,10,0,0,0,1,0,48,0,0,0,1,0,45,0,0,
+0,1,0,46,0,0,0,1,0,47,0,59,0,120,1,114,3,46,3,74,5,194,5,208,6,14,6,28,6,
+178,6,192,6,212,7,2,13,80,19,158,20,112,21,218,22,16,22,48,22,80,22,138,24,
+2,24,88,25,118,28,12,29,118,29,180,30,252,31,54,33,200,34,56,34,184,35,38,
+36,150,37,160,40,116,40,222,41,132,41,230,42,174,43,10,43,230,46,72,46,98,
+46,162,46,194,47,34,47,56,47,82,47,104,47,146,48,188,48,202,48,222,49,12,
+49,166,49,180,49,202,50,12,50,94,0,1,0,0,0,1,0,8,0,2,0,122,0,58,0,252,1,29,
+1,2,1,19,1,4,1,22,1,23,0,27,1,27,0,29,1,28,0,31,0,33,0,35,1,33,1,7,1,8,1,
+9,1,10,1,11,1,12,0,255,1,0,1,34,0,74,1,13,1,14,1,31,1,32,0,90,0,96,0,102,
+0,251,1,24,1,6,0,112,0,114,1,52,1,46,1,47,0,231,0,232,0,63,0,64,0,17,0,21,
+0,110,0,42,0,43,0,46,0,47,0,59,0,60,0,79,0,80,1,55,1,56,1,57,0,1,0,58,0,10,
+0,15,0,17,0,19,0,21,0,23,0,24,0,26,0,27,0,28,0,29,0,30,0,32,0,34,0,35,0,42,
+0,43,0,46,0,47,0,59,0,60,0,63,0,64,0,67,0,70,0,79,0,80,0,82,0,83,0,89,0,95,
+0,101,0,102,0,108,0,110,0,111,0,113,0,139,0,171,0,174,0,225,0,226,0,255,1,
+0,1,2,1,4,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,60,1,61,1,62,0,3,0,0,
+0,1,0,8,0,1,1,100,0,38,0,82,0,92,0,98,0,104,0,112,0,118,0,126,0,132,0,140,
+0,148,0,156,0,164,0,172,0,180,0,188,0,196,0,204,0,214,0,222,0,230,0,238,0,
+246,0,254,1,6,1,12,1,18,1,26,1,34,1,40,1,48,1,56,1,64,1,70,1,76,1,80,1,86,
+1,92,1,96,0,4,0,12,0,11,0,10,0,9,0,2,0,249,0,253,0,2,0,250,0,254,0,3,0,17,
+0,16,0,15,0,2,1,1,1,30,0,3,0,21,0,20,0,19,0,2,1,3,1,20,0,3,0,25,0,24,0,23,
+0,3,0,39,0,38,0,37,0,3,0,43,0,42,0,41,0,3,0,47,0,46,0,45,0,3,0,51,0,50,0,
+49,0,3,0,56,0,55,0,54,0,3,0,60,0,59,0,58,0,3,0,64,0,63,0,62,0,3,0,68,0,67,
+0,66,0,4,0,72,0,71,0,70,0,73,0,3,0,76,0,75,0,74,0,3,0,80,0,79,0,78,0,3,0,
+84,0,83,0,82,0,3,0,88,0,87,0,86,0,3,0,94,0,93,0,92,0,3,0,100,0,99,0,98,0,
+2,1,15,1,17,0,2,1,16,1,18,0,3,0,106,0,105,0,104,0,3,0,110,0,109,0,108,0,2,
+1,5,1,25,0,3,0,118,0,117,0,116,0,3,0,122,0,121,0,120,0,3,1,37,1,38,1,39,0,
+2,1,44,0,171,0,2,1,45,0,174,0,1,0,16,0,2,0,20,1,21,0,2,0,109,1,26,0,1,0,99,
+0,1,0,100,0,1,0,38,0,8,0,11,0,12,0,14,0,16,0,18,0,20,0,22,0,36,0,40,0,44,
+0,48,0,53,0,57,0,61,0,65,0,69,0,73,0,77,0,81,0,85,0,91,0,97,0,99,0,100,0,
+103,0,107,0,109,0,115,0,119,0,145,0,157,0,158,1,1,1,3,1,5,1,17,1,18,0,2,0,
+0,0,1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,0,142,0,2,1,35,1,36,0,6,0,1,0,28,0,62,
+0,80,0,98,0,116,0,134,0,152,0,170,0,188,0,206,0,224,0,242,1,4,1,22,1,40,1,
+58,1,76,1,94,1,112,1,130,1,148,1,166,1,196,1,220,1,244,2,12,2,36,2,66,2,90,
+0,3,0,0,0,2,1,176,1,122,0,0,0,1,0,0,0,49,0,3,0,0,0,2,1,134,1,104,0,0,0,1,
+0,0,0,49,0,3,0,0,0,2,1,242,1,86,0,0,0,1,0,0,0,49,0,3,0,0,0,2,1,254,1,68,0,
+0,0,1,0,0,0,49,0,3,0,0,0,2,1,152,1,50,0,0,0,1,0,0,0,49,0,3,0,0,0,2,1,110,
+1,32,0,0,0,1,0,0,0,49,0,3,0,0,0,2,1,20,1,14,0,0,0,1,0,0,0,49,0,3,0,0,0,2,
+1,26,1,122,0,0,0,1,0,0,0,49,0,3,0,0,0,2,1,32,1,104,0,0,0,1,0,0,0,49,0,3,0,
+0,0,2,1,38,1,86,0,0,0,1,0,0,0,49,0,3,0,0,0,2,1,44,1,68,0,0,0,1,0,0,0,49,0,
+3,0,0,0,2,1,56,1,50,0,0,0,1,0,0,0,49,0,3,0,0,0,2,1,62,1,86,0,0,0,1,0,0,0,
+49,0,3,0,0,0,2,1,74,1,68,0,0,0,1,0,0,0,49,0,3,0,0,0,2,0,126,0,180,0,0,0,1,
+0,0,0,49,0,3,0,0,0,2,0,108,0,138,0,0,0,1,0,0,0,49,0,3,0,0,0,2,0,90,0,246,
+0,0,0,1,0,0,0,49,0,3,0,0,0,2,0,72,1,2,0,0,0,1,0,0,0,49,0,3,0,0,0,2,0,54,0,
+156,0,0,0,1,0,0,0,49,0,3,0,0,0,2,0,36,0,114,0,0,0,1,0,0,0,49,0,3,0,0,0,2,
+0,18,0,24,0,0,0,1,0,0,0,49,0,1,0,1,0,185,0,1,0,1,0,190,0,3,0,0,0,2,0,114,
+0,18,0,0,0,1,0,0,0,49,0,1,0,1,0,179,0,3,0,0,0,2,0,90,0,18,0,0,0,1,0,0,0,49,
+0,1,0,1,0,182,0,3,0,0,0,2,0,66,0,18,0,0,0,1,0,0,0,49,0,1,0,1,0,180,0,3,0,
+0,0,2,0,42,0,18,0,0,0,1,0,0,0,49,0,1,0,1,0,183,0,3,0,0,0,2,0,18,0,24,0,0,
+0,1,0,0,0,49,0,1,0,1,0,188,0,1,0,1,0,186,0,3,0,0,0,2,0,42,0,18,0,0,0,1,0,
+0,0,49,0,1,0,1,0,184,0,3,0,0,0,2,0,18,0,24,0,0,0,1,0,0,0,49,0,1,0,1,0,189,
+0,1,0,1,0,181,0,1,0,9,0,1,0,8,0,1,0,20,0,3,0,1,0,9,0,1,0,8,0,1,0,6,0,2,0,
+1,0,22,0,14,0,18,0,22,0,36,0,40,0,44,0,48,0,53,0,57,0,61,0,65,0,69,0,73,0,
+77,0,81,0,85,0,91,0,97,0,103,0,107,0,115,0,119,0,1,0,9,0,1,0,8,0,1,0,184,
+0,4,0,1,0,9,0,1,0,8,0,2,0,72,0,33,0,11,0,15,0,19,0,23,0,27,0,29,0,31,0,33,
+0,35,0,37,0,41,0,45,0,49,0,54,0,58,0,62,0,66,0,70,0,74,0,78,0,82,0,86,0,90,
+0,92,0,96,0,98,0,102,0,104,0,108,0,112,0,114,0,116,0,120,0,1,0,33,0,8,0,14,
+0,18,0,22,0,26,0,28,0,30,0,32,0,34,0,36,0,40,0,44,0,48,0,53,0,57,0,61,0,65,
+0,69,0,73,0,77,0,81,0,85,0,89,0,91,0,95,0,97,0,101,0,103,0,107,0,111,0,113,
+0,115,0,119,0,1,0,9,0,1,0,8,0,1,0,20,0,2,0,1,0,9,0,1,0,8,0,1,0,6,0,1,0,1,
+0,1,0,8,0,4,0,1,0,1,0,8,0,1,0,30,0,2,0,10,0,20,0,1,0,4,0,247,0,2,0,170,0,
+1,0,4,0,248,0,2,0,170,0,1,0,2,0,95,0,96,0,2,0,9,0,1,0,8,0,1,39,130,0,160,
+1,70,1,78,1,86,1,94,1,102,1,110,1,118,1,126,1,134,1,142,1,150,1,158,1,166,
+1,174,1,182,1,190,1,198,1,206,1,214,1,222,1,230,1,238,1,246,1,254,2,6,2,14,
+2,22,2,30,2,38,2,46,2,54,2,62,2,70,2,78,2,86,2,94,2,102,2,110,2,118,2,126,
+2,134,2,142,2,150,2,158,2,166,2,174,2,182,2,190,2,198,2,206,2,214,2,222,2,
+230,2,238,2,246,2,254,3,6,3,14,3,22,3,30,3,38,3,46,3,54,3,62,3,70,3,78,3,
+86,3,94,3,102,3,110,3,118,3,126,3,134,3,142,3,150,3,158,3,166,3,174,3,182,
+3,190,3,198,3,206,3,214,3,222,3,230,3,238,3,246,3,254,4,6,4,14,4,22,4,30,
+4,38,4,46,4,54,4,62,4,70,4,78,4,86,4,94,4,102,4,110,4,118,4,126,4,134,4,142,
+4,150,4,158,4,166,4,174,4,182,4,190,4,198,4,206,4,214,4,222,4,230,4,238,4,
+246,4,254,5,6,5,14,5,22,5,30,5,38,5,46,5,54,5,62,5,70,5,78,5,86,5,94,5,102,
+5,110,5,118,5,126,5,134,5,142,5,150,5,158,5,166,5,174,5,182,5,190,5,198,5,
+206,5,214,5,222,5,230,5,238,5,246,5,254,6,6,6,14,6,22,6,30,6,38,6,46,6,54,
+6,62,0,3,1,58,0,8,1,60,0,3,1,58,0,9,1,60,0,3,1,58,0,10,1,60,0,3,1,58,0,11,
+1,60,0,3,1,58,0,12,1,60,0,3,1,59,0,14,1,61,0,3,1,59,0,15,1,61,0,3,1,59,0,
+16,1,60,0,3,1,59,0,17,1,60,0,3,1,59,0,18,1,61,0,3,1,59,0,19,1,61,0,3,1,58,
+0,20,1,60,0,3,1,59,0,21,1,60,0,3,1,59,0,22,1,61,0,3,1,59,0,23,1,61,0,3,1,
+58,0,24,1,60,0,3,1,59,0,25,1,60,0,3,1,59,0,26,1,60,0,3,1,59,0,27,1,60,0,3,
+1,59,0,28,1,60,0,3,1,59,0,29,1,60,0,3,1,59,0,30,1,61,0,3,1,59,0,31,1,61,0,
+3,1,59,0,32,1,60,0,3,1,59,0,33,1,60,0,3,1,58,0,34,1,60,0,3,1,58,0,35,1,60,
+0,3,1,59,0,36,1,61,0,3,1,59,0,37,1,61,0,3,1,59,0,38,1,60,0,3,1,59,0,39,1,
+61,0,3,1,59,0,40,1,62,0,3,1,59,0,41,1,62,0,3,1,59,0,42,1,61,0,3,1,59,0,43,
+1,61,0,3,1,59,0,44,1,62,0,3,1,59,0,45,1,62,0,3,1,59,0,46,1,61,0,3,1,59,0,
+47,1,61,0,3,1,59,0,48,1,61,0,3,1,59,0,49,1,61,0,3,1,58,0,50,1,60,0,3,1,59,
+0,51,1,60,0,3,1,59,0,52,1,62,0,3,1,59,0,53,1,61,0,3,1,59,0,54,1,61,0,3,1,
+59,0,55,1,61,0,3,1,59,0,56,1,61,0,3,1,59,0,57,1,61,0,3,1,59,0,58,1,61,0,3,
+1,58,0,59,1,60,0,3,1,59,0,60,1,60,0,3,1,59,0,61,1,61,0,3,1,59,0,62,1,61,0,
+3,1,59,0,63,1,61,0,3,1,59,0,64,1,61,0,3,1,59,0,65,1,60,0,3,1,58,0,66,1,60,
+0,3,1,58,0,67,1,60,0,3,1,58,0,68,1,60,0,3,1,59,0,69,1,62,0,3,1,59,0,70,1,
+62,0,3,1,59,0,71,1,61,0,3,1,59,0,72,1,61,0,3,1,59,0,73,1,61,0,3,1,59,0,74,
+1,61,0,3,1,59,0,75,1,61,0,3,1,59,0,76,1,61,0,3,1,59,0,77,1,61,0,3,1,59,0,
+78,1,61,0,3,1,59,0,79,1,60,0,3,1,59,0,80,1,61,0,3,1,59,0,81,1,61,0,3,1,59,
+0,82,1,61,0,3,1,59,0,83,1,60,0,3,1,59,0,84,1,60,0,3,1,59,0,85,1,61,0,3,1,
+59,0,86,1,61,0,3,1,59,0,87,1,60,0,3,1,59,0,88,1,60,0,3,1,59,0,89,1,61,0,3,
+1,59,0,90,1,60,0,3,1,59,0,91,1,61,0,3,1,59,0,92,1,61,0,3,1,59,0,93,1,61,0,
+3,1,59,0,94,1,61,0,3,1,59,0,95,1,60,0,3,1,59,0,96,1,60,0,3,1,59,0,97,1,61,
+0,3,1,59,0,98,1,61,0,3,1,59,0,99,1,60,0,3,1,59,0,100,1,61,0,3,1,59,0,101,
+1,61,0,3,1,59,0,102,1,61,0,3,1,59,0,103,1,61,0,3,1,59,0,104,1,61,0,3,1,59,
+0,105,1,60,0,3,1,59,0,106,1,60,0,3,1,59,0,107,1,61,0,3,1,59,0,108,1,61,0,
+3,1,58,0,109,1,60,0,3,1,59,0,110,1,60,0,3,1,59,0,111,1,61,0,3,1,59,0,112,
+1,61,0,3,1,59,0,113,1,60,0,3,1,59,0,114,1,60,0,3,1,59,0,115,1,61,0,3,1,59,
+0,116,1,61,0,3,1,59,0,117,1,60,0,3,1,59,0,118,1,60,0,3,1,59,0,119,1,61,0,
+3,1,59,0,120,1,61,0,3,1,59,0,121,1,60,0,3,1,59,0,122,1,60,0,3,1,59,0,123,
+1,60,0,3,1,58,0,124,1,60,0,3,1,59,0,247,1,60,0,3,1,59,0,248,1,60,0,3,1,59,
+0,249,1,60,0,3,1,59,0,250,1,60,0,3,1,58,0,251,1,60,0,3,1,58,0,252,1,60,0,
+3,1,58,0,253,1,60,0,3,1,58,0,254,1,60,0,3,1,59,0,255,1,61,0,3,1,59,1,0,1,
+61,0,3,1,59,1,1,1,60,0,3,1,59,1,2,1,60,0,3,1,58,1,3,1,60,0,3,1,58,1,4,1,60,
+0,3,1,58,1,5,1,60,0,3,1,58,1,6,1,60,0,3,1,59,1,7,1,60,0,3,1,59,1,8,1,61,0,
+3,1,59,1,9,1,60,0,3,1,59,1,10,1,61,0,3,1,58,1,11,1,60,0,3,1,58,1,12,1,60,
+0,3,1,58,1,13,1,60,0,3,1,59,1,14,1,60,0,3,1,59,1,15,1,60,0,3,1,59,1,16,1,
+60,0,3,1,59,1,17,1,60,0,3,1,59,1,18,1,60,0,3,1,59,1,19,1,61,0,3,1,59,1,20,
+1,60,0,3,1,59,1,21,1,60,0,3,1,59,1,22,1,61,0,3,1,59,1,23,1,60,0,3,1,59,1,
+24,1,61,0,3,1,59,1,25,1,60,0,3,1,59,1,26,1,60,0,3,1,59,1,27,1,61,0,3,1,59,
+1,28,1,61,0,3,1,59,1,29,1,61,0,3,1,59,1,30,1,61,0,3,1,59,1,31,1,61,0,3,1,
+59,1,32,1,61,0,3,1,58,1,33,1,60,0,3,1,59,1,34,1,60,0,2,0,9,0,1,0,8,0,1,33,
+52,0,160,1,70,1,78,1,86,1,94,1,102,1,110,1,118,1,126,1,134,1,142,1,150,1,
+158,1,166,1,174,1,182,1,190,1,198,1,206,1,214,1,222,1,230,1,238,1,246,1,254,
+2,6,2,14,2,22,2,30,2,38,2,46,2,54,2,62,2,70,2,78,2,86,2,94,2,102,2,110,2,
+118,2,126,2,134,2,142,2,150,2,158,2,166,2,174,2,182,2,190,2,198,2,206,2,214,
+2,222,2,230,2,238,2,246,2,254,3,6,3,14,3,22,3,30,3,38,3,46,3,54,3,62,3,70,
+3,78,3,86,3,94,3,102,3,110,3,118,3,126,3,134,3,142,3,150,3,158,3,166,3,174,
+3,182,3,190,3,198,3,206,3,214,3,222,3,230,3,238,3,246,3,254,4,6,4,14,4,22,
+4,30,4,38,4,46,4,54,4,62,4,70,4,78,4,86,4,94,4,102,4,110,4,118,4,126,4,134,
+4,142,4,150,4,158,4,166,4,174,4,182,4,190,4,198,4,206,4,214,4,222,4,230,4,
+238,4,246,4,254,5,6,5,14,5,22,5,30,5,38,5,46,5,54,5,62,5,70,5,78,5,86,5,94,
+5,102,5,110,5,118,5,126,5,134,5,142,5,150,5,158,5,166,5,174,5,182,5,190,5,
+198,5,206,5,214,5,222,5,230,5,238,5,246,5,254,6,6,6,14,6,22,6,30,6,38,6,46,
+6,54,6,62,0,3,1,53,0,8,1,60,0,3,1,53,0,9,1,60,0,3,1,53,0,10,1,60,0,3,1,53,
+0,11,1,60,0,3,1,53,0,12,1,60,0,3,1,54,0,14,1,61,0,3,1,54,0,15,1,61,0,3,1,
+54,0,16,1,60,0,3,1,54,0,17,1,60,0,3,1,54,0,18,1,61,0,3,1,54,0,19,1,61,0,3,
+1,53,0,20,1,60,0,3,1,54,0,21,1,60,0,3,1,54,0,22,1,61,0,3,1,54,0,23,1,61,0,
+3,1,53,0,24,1,60,0,3,1,54,0,25,1,60,0,3,1,54,0,26,1,60,0,3,1,54,0,27,1,60,
+0,3,1,54,0,28,1,60,0,3,1,54,0,29,1,60,0,3,1,54,0,30,1,61,0,3,1,54,0,31,1,
+61,0,3,1,54,0,32,1,60,0,3,1,54,0,33,1,60,0,3,1,53,0,34,1,60,0,3,1,53,0,35,
+1,60,0,3,1,54,0,36,1,61,0,3,1,54,0,37,1,61,0,3,1,54,0,38,1,60,0,3,1,54,0,
+39,1,61,0,3,1,54,0,40,1,62,0,3,1,54,0,41,1,62,0,3,1,54,0,42,1,61,0,3,1,54,
+0,43,1,61,0,3,1,54,0,44,1,62,0,3,1,54,0,45,1,62,0,3,1,54,0,46,1,61,0,3,1,
+54,0,47,1,61,0,3,1,54,0,48,1,61,0,3,1,54,0,49,1,61,0,3,1,53,0,50,1,60,0,3,
+1,54,0,51,1,60,0,3,1,54,0,52,1,62,0,3,1,54,0,53,1,61,0,3,1,54,0,54,1,61,0,
+3,1,54,0,55,1,61,0,3,1,54,0,56,1,61,0,3,1,54,0,57,1,61,0,3,1,54,0,58,1,61,
+0,3,1,53,0,59,1,60,0,3,1,54,0,60,1,60,0,3,1,54,0,61,1,61,0,3,1,54,0,62,1,
+61,0,3,1,54,0,63,1,61,0,3,1,54,0,64,1,61,0,3,1,54,0,65,1,60,0,3,1,53,0,66,
+1,60,0,3,1,53,0,67,1,60,0,3,1,53,0,68,1,60,0,3,1,54,0,69,1,62,0,3,1,54,0,
+70,1,62,0,3,1,54,0,71,1,61,0,3,1,54,0,72,1,61,0,3,1,54,0,73,1,61,0,3,1,54,
+0,74,1,61,0,3,1,54,0,75,1,61,0,3,1,54,0,76,1,61,0,3,1,54,0,77,1,61,0,3,1,
+54,0,78,1,61,0,3,1,54,0,79,1,60,0,3,1,54,0,80,1,61,0,3,1,54,0,81,1,61,0,3,
+1,54,0,82,1,61,0,3,1,54,0,83,1,60,0,3,1,54,0,84,1,60,0,3,1,54,0,85,1,61,0,
+3,1,54,0,86,1,61,0,3,1,54,0,87,1,60,0,3,1,54,0,88,1,60,0,3,1,54,0,89,1,61,
+0,3,1,54,0,90,1,60,0,3,1,54,0,91,1,61,0,3,1,54,0,92,1,61,0,3,1,54,0,93,1,
+61,0,3,1,54,0,94,1,61,0,3,1,54,0,95,1,60,0,3,1,54,0,96,1,60,0,3,1,54,0,97,
+1,61,0,3,1,54,0,98,1,61,0,3,1,54,0,99,1,60,0,3,1,54,0,100,1,61,0,3,1,54,0,
+101,1,61,0,3,1,54,0,102,1,61,0,3,1,54,0,103,1,61,0,3,1,54,0,104,1,61,0,3,
+1,54,0,105,1,60,0,3,1,54,0,106,1,60,0,3,1,54,0,107,1,61,0,3,1,54,0,108,1,
+61,0,3,1,53,0,109,1,60,0,3,1,54,0,110,1,60,0,3,1,54,0,111,1,61,0,3,1,54,0,
+112,1,61,0,3,1,54,0,113,1,60,0,3,1,54,0,114,1,60,0,3,1,54,0,115,1,61,0,3,
+1,54,0,116,1,61,0,3,1,54,0,117,1,60,0,3,1,54,0,118,1,60,0,3,1,54,0,119,1,
+61,0,3,1,54,0,120,1,61,0,3,1,54,0,121,1,60,0,3,1,54,0,122,1,60,0,3,1,54,0,
+123,1,60,0,3,1,53,0,124,1,60,0,3,1,54,0,247,1,60,0,3,1,54,0,248,1,60,0,3,
+1,54,0,249,1,60,0,3,1,54,0,250,1,60,0,3,1,53,0,251,1,60,0,3,1,53,0,252,1,
+60,0,3,1,53,0,253,1,60,0,3,1,53,0,254,1,60,0,3,1,54,0,255,1,61,0,3,1,54,1,
+0,1,61,0,3,1,54,1,1,1,60,0,3,1,54,1,2,1,60,0,3,1,53,1,3,1,60,0,3,1,53,1,4,
+1,60,0,3,1,53,1,5,1,60,0,3,1,53,1,6,1,60,0,3,1,54,1,7,1,60,0,3,1,54,1,8,1,
+61,0,3,1,54,1,9,1,60,0,3,1,54,1,10,1,61,0,3,1,53,1,11,1,60,0,3,1,53,1,12,
+1,60,0,3,1,53,1,13,1,60,0,3,1,54,1,14,1,60,0,3,1,54,1,15,1,60,0,3,1,54,1,
+16,1,60,0,3,1,54,1,17,1,60,0,3,1,54,1,18,1,60,0,3,1,54,1,19,1,61,0,3,1,54,
+1,20,1,60,0,3,1,54,1,21,1,60,0,3,1,54,1,22,1,61,0,3,1,54,1,23,1,60,0,3,1,
+54,1,24,1,61,0,3,1,54,1,25,1,60,0,3,1,54,1,26,1,60,0,3,1,54,1,27,1,61,0,3,
+1,54,1,28,1,61,0,3,1,54,1,29,1,61,0,3,1,54,1,30,1,61,0,3,1,54,1,31,1,61,0,
+3,1,54,1,32,1,61,0,3,1,53,1,33,1,60,0,3,1,54,1,34,1,60,0,6,1,1,0,6,0,18,0,
+38,0,96,0,116,0,156,0,176,0,3,0,2,26,4,0,38,0,1,29,40,0,0,0,1,0,0,0,50,0,
+3,0,1,0,18,0,1,29,20,0,0,0,1,0,0,0,50,0,2,0,6,0,18,0,25,0,0,0,40,0,47,0,8,
+0,57,0,60,0,16,0,107,0,110,0,20,1,19,1,20,0,24,1,22,1,25,0,26,0,3,0,2,25,
+182,0,38,0,1,28,218,0,0,0,1,0,0,0,51,0,3,0,1,0,18,0,1,28,198,0,0,0,1,0,0,
+0,51,0,2,0,3,1,3,1,12,0,0,1,21,1,21,0,10,1,26,1,26,0,11,0,3,0,2,25,122,0,
+38,0,1,28,158,0,0,0,1,0,0,0,52,0,3,0,1,0,18,0,1,28,138,0,0,0,1,0,0,0,52,0,
+1,0,6,0,77,0,78,0,79,0,80,1,13,1,14,0,6,0,1,0,11,0,28,0,50,0,72,0,94,0,116,
+0,138,0,160,0,182,0,204,0,226,0,246,0,3,0,3,0,246,0,246,24,112,0,1,0,238,
+0,0,0,1,0,0,0,52,0,3,0,3,20,254,0,224,24,90,0,1,0,216,0,0,0,1,0,0,0,52,0,
+3,0,3,0,202,20,232,24,68,0,1,0,194,0,0,0,1,0,0,0,52,0,3,0,2,0,180,24,46,0,
+1,0,172,0,1,0,180,0,1,0,0,0,52,0,3,0,2,0,158,24,24,0,1,0,150,0,1,20,188,0,
+1,0,0,0,52,0,3,0,2,20,166,24,2,0,1,0,128,0,1,0,136,0,1,0,0,0,52,0,3,0,1,23,
+236,0,1,0,106,0,2,0,114,0,114,0,1,0,0,0,52,0,3,0,1,23,214,0,1,0,84,0,2,0,
+92,20,122,0,1,0,0,0,52,0,3,0,1,23,192,0,1,0,62,0,2,20,100,0,70,0,1,0,0,0,
+52,0,3,0,2,0,48,23,170,0,1,0,40,0,0,0,1,0,0,0,52,0,3,0,1,23,150,0,1,0,20,
+0,1,0,28,0,1,0,0,0,52,0,1,0,2,0,157,0,171,0,1,0,42,0,13,0,140,0,143,0,145,
+0,146,0,150,0,153,0,155,0,156,0,159,0,161,0,163,0,165,0,166,0,167,0,168,0,
+169,0,170,0,179,0,180,0,182,0,183,0,185,0,186,0,187,0,188,0,190,0,191,0,192,
+0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,0,201,0,202,1,35,1,37,1,39,
+0,6,0,9,0,2,0,10,0,28,0,3,0,1,0,36,0,1,8,22,0,0,0,1,0,0,0,52,0,3,0,1,0,18,
+0,1,8,46,0,0,0,1,0,0,0,52,0,1,0,2,0,59,0,60,0,6,0,9,0,1,0,8,0,3,0,1,8,138,
+0,1,0,18,0,0,0,1,0,0,0,52,0,1,0,1,0,10,0,6,0,9,0,1,0,8,0,3,0,0,0,1,8,106,
+0,1,0,18,0,1,0,0,0,52,0,1,0,1,0,252,0,6,0,9,0,2,0,10,0,28,0,3,0,1,0,36,0,
+1,7,160,0,0,0,1,0,0,0,53,0,3,0,1,0,18,0,1,7,184,0,0,0,1,0,0,0,53,0,1,0,4,
+0,38,0,39,0,50,0,51,0,6,0,9,0,18,0,42,0,60,0,78,0,96,0,114,0,132,0,150,0,
+168,0,186,0,204,0,222,0,240,1,2,1,20,1,38,1,56,1,74,1,92,0,3,0,0,0,1,12,166,
+0,1,1,68,0,1,0,0,0,53,0,3,0,0,0,1,18,84,0,1,1,50,0,1,0,0,0,53,0,3,0,0,0,1,
+12,172,0,1,1,32,0,1,0,0,0,53,0,3,0,0,0,1,20,136,0,1,1,14,0,1,0,0,0,53,0,3,
+0,0,0,1,12,178,0,1,0,252,0,1,0,0,0,53,0,3,0,0,0,1,19,246,0,1,0,234,0,1,0,
+0,0,53,0,3,0,0,0,1,12,184,0,1,0,216,0,1,0,0,0,53,0,3,0,0,0,1,12,190,0,1,0,
+198,0,1,0,0,0,53,0,3,0,0,0,1,12,196,0,1,0,180,0,1,0,0,0,53,0,3,0,0,0,1,12,
+202,0,1,0,162,0,1,0,0,0,53,0,3,0,0,0,1,12,208,0,1,0,144,0,1,0,0,0,53,0,3,
+0,0,0,1,12,214,0,1,0,126,0,1,0,0,0,53,0,3,0,0,0,1,11,76,0,1,0,108,0,1,0,0,
+0,53,0,3,0,0,0,1,11,82,0,1,0,90,0,1,0,0,0,53,0,3,0,0,0,1,12,184,0,1,0,72,
+0,1,0,0,0,53,0,3,0,0,0,1,12,190,0,1,0,54,0,1,0,0,0,53,0,3,0,0,0,1,11,52,0,
+1,0,36,0,1,0,0,0,53,0,3,0,0,0,1,11,58,0,1,0,18,0,1,0,0,0,53,0,1,0,3,0,37,
+0,38,0,49,0,6,0,9,0,4,0,14,0,32,0,50,0,68,0,3,0,0,0,1,11,74,0,1,5,94,0,1,
+0,0,0,53,0,3,0,0,0,1,16,248,0,1,5,76,0,1,0,0,0,53,0,3,0,0,0,1,10,212,0,1,
+5,58,0,1,0,0,0,53,0,3,0,0,0,1,10,218,0,1,5,40,0,1,0,0,0,53,0,6,0,9,0,14,0,
+34,0,52,0,70,0,88,0,106,0,124,0,142,0,160,0,178,0,196,0,214,0,232,0,250,1,
+12,0,3,0,0,0,1,11,10,0,1,4,244,0,1,0,0,0,53,0,3,0,0,0,1,18,230,0,1,4,226,
+0,1,0,0,0,53,0,3,0,0,0,1,11,16,0,1,4,208,0,1,0,0,0,53,0,3,0,0,0,1,18,84,0,
+1,4,190,0,1,0,0,0,53,0,3,0,0,0,1,11,22,0,1,4,172,0,1,0,0,0,53,0,3,0,0,0,1,
+11,28,0,1,4,154,0,1,0,0,0,53,0,3,0,0,0,1,11,34,0,1,4,136,0,1,0,0,0,53,0,3,
+0,0,0,1,11,40,0,1,4,118,0,1,0,0,0,53,0,3,0,0,0,1,11,46,0,1,4,100,0,1,0,0,
+0,53,0,3,0,0,0,1,11,52,0,1,4,82,0,1,0,0,0,53,0,3,0,0,0,1,9,170,0,1,4,64,0,
+1,0,0,0,53,0,3,0,0,0,1,9,176,0,1,4,46,0,1,0,0,0,53,0,3,0,0,0,1,11,22,0,1,
+4,28,0,1,0,0,0,53,0,3,0,0,0,1,11,28,0,1,4,10,0,1,0,0,0,53,0,6,1,1,0,28,0,
+62,0,84,0,106,0,128,0,150,0,172,0,194,0,216,0,238,1,4,1,26,1,48,1,70,1,92,
+1,114,1,134,1,154,1,174,1,194,1,214,1,234,1,254,2,18,2,38,2,58,2,84,2,110,
+2,130,0,3,0,0,0,1,2,140,0,3,20,0,3,186,20,0,0,1,0,0,0,53,0,3,0,0,0,1,17,194,
+0,3,19,234,3,164,19,234,0,1,0,0,0,53,0,3,0,0,0,1,2,146,0,3,19,212,3,142,19,
+212,0,1,0,0,0,53,0,3,0,0,0,1,11,26,0,3,19,190,3,120,19,190,0,1,0,0,0,53,0,
+3,0,0,0,1,2,152,0,3,19,168,3,98,19,168,0,1,0,0,0,53,0,3,0,0,0,1,2,158,0,3,
+19,146,3,76,19,146,0,1,0,0,0,53,0,3,0,0,0,1,2,164,0,3,19,124,3,54,19,124,
+0,1,0,0,0,53,0,3,0,0,0,1,2,170,0,3,19,102,3,32,19,102,0,1,0,0,0,53,0,3,0,
+0,0,1,2,176,0,3,19,80,3,10,19,80,0,1,0,0,0,53,0,3,0,0,0,1,2,182,0,3,19,58,
+2,244,19,58,0,1,0,0,0,53,0,3,0,0,0,1,1,52,0,3,19,36,2,222,19,36,0,1,0,0,0,
+53,0,3,0,0,0,1,1,56,0,3,19,14,2,200,19,14,0,1,0,0,0,53,0,3,0,0,0,1,2,144,
+0,3,18,248,2,178,18,248,0,1,0,0,0,53,0,3,0,0,0,1,2,150,0,3,18,226,2,156,18,
+226,0,1,0,0,0,53,0,3,0,0,0,1,1,88,0,2,2,134,18,204,0,1,0,0,0,53,0,3,0,0,0,
+1,16,144,0,2,2,114,18,184,0,1,0,0,0,53,0,3,0,0,0,1,1,98,0,2,2,94,18,164,0,
+1,0,0,0,53,0,3,0,0,0,1,9,236,0,2,2,74,18,144,0,1,0,0,0,53,0,3,0,0,0,1,1,108,
+0,2,2,54,18,124,0,1,0,0,0,53,0,3,0,0,0,1,1,116,0,2,2,34,18,104,0,1,0,0,0,
+53,0,3,0,0,0,1,1,124,0,2,2,14,18,84,0,1,0,0,0,53,0,3,0,0,0,1,1,132,0,2,1,
+250,18,64,0,1,0,0,0,53,0,3,0,0,0,1,1,140,0,2,1,230,18,44,0,1,0,0,0,53,0,3,
+0,0,0,1,1,148,0,2,1,210,18,24,0,1,0,0,0,53,0,3,0,0,0,1,0,20,0,2,1,190,18,
+4,0,1,0,0,0,53,0,1,0,1,1,0,0,3,0,0,0,1,0,20,0,2,1,164,17,234,0,1,0,0,0,53,
+0,1,0,1,0,255,0,3,0,0,0,1,1,104,0,2,1,138,17,208,0,1,0,0,0,53,0,3,0,0,0,1,
+1,112,0,2,1,118,17,188,0,1,0,0,0,53,0,6,2,1,0,12,0,30,0,58,0,80,0,108,0,130,
+0,158,0,186,0,214,0,242,1,14,1,42,1,70,0,3,0,0,0,1,0,22,0,3,13,118,1,68,13,
+118,0,1,0,0,0,53,0,1,0,1,1,4,0,3,0,0,0,1,15,70,0,3,13,90,1,40,13,90,0,1,0,
+0,0,53,0,3,0,0,0,1,0,22,0,3,13,68,1,18,13,68,0,1,0,0,0,53,0,1,0,1,1,6,0,3,
+0,0,0,1,8,152,0,3,13,40,0,246,13,40,0,1,0,0,0,53,0,3,0,0,0,1,0,22,0,3,13,
+18,0,224,13,18,0,1,0,0,0,53,0,1,0,1,1,8,0,3,0,0,0,1,0,22,0,3,12,246,0,196,
+12,246,0,1,0,0,0,53,0,1,0,1,1,7,0,3,0,0,0,1,0,22,0,3,12,218,0,168,12,218,
+0,1,0,0,0,53,0,1,0,1,1,10,0,3,0,0,0,1,0,22,0,3,12,190,0,140,12,190,0,1,0,
+0,0,53,0,1,0,1,1,9,0,3,0,0,0,1,0,22,0,3,12,162,0,112,12,162,0,1,0,0,0,53,
+0,1,0,1,1,12,0,3,0,0,0,1,0,22,0,3,12,134,0,84,12,134,0,1,0,0,0,53,0,1,0,1,
+1,11,0,3,0,0,0,1,0,22,0,3,12,106,0,56,12,106,0,1,0,0,0,53,0,1,0,1,1,14,0,
+3,0,0,0,1,0,22,0,3,12,78,0,28,12,78,0,1,0,0,0,53,0,1,0,1,1,13,0,1,0,2,0,49,
+0,50,0,6,0,9,0,2,0,10,0,28,0,3,0,0,0,1,5,88,0,1,0,36,0,1,0,0,0,53,0,3,0,0,
+0,1,5,94,0,1,0,18,0,1,0,0,0,53,0,1,0,6,0,41,0,42,0,45,0,46,0,78,0,79,0,6,
+0,9,0,14,0,34,0,52,0,76,0,94,0,118,0,136,0,160,0,178,0,202,0,220,0,244,1,
+6,1,30,1,48,0,3,0,0,0,1,5,50,0,1,0,36,0,1,0,0,0,54,0,3,0,0,0,1,5,56,0,1,0,
+18,0,1,0,0,0,54,0,1,0,1,0,11,0,3,0,0,0,1,5,8,0,1,0,36,0,1,0,0,0,54,0,3,0,
+0,0,1,5,14,0,1,0,18,0,1,0,0,0,54,0,1,0,1,0,12,0,3,0,0,0,1,4,222,0,1,0,36,
+0,1,0,0,0,55,0,3,0,0,0,1,4,228,0,1,0,18,0,1,0,0,0,55,0,1,0,1,0,78,0,3,0,0,
+0,1,4,180,0,1,0,36,0,1,0,0,0,56,0,3,0,0,0,1,4,186,0,1,0,18,0,1,0,0,0,56,0,
+1,0,1,0,90,0,3,0,0,0,1,4,138,0,1,0,36,0,1,0,0,0,56,0,3,0,0,0,1,4,144,0,1,
+0,18,0,1,0,0,0,56,0,1,0,1,0,102,0,3,0,0,0,1,4,96,0,1,0,36,0,1,0,0,0,56,0,
+3,0,0,0,1,4,102,0,1,0,18,0,1,0,0,0,56,0,1,0,1,0,114,0,3,0,0,0,1,4,54,0,1,
+0,36,0,1,0,0,0,56,0,3,0,0,0,1,4,60,0,1,0,18,0,1,0,0,0,56,0,1,0,1,0,55,0,6,
+0,9,0,2,0,10,0,28,0,3,0,0,0,1,4,2,0,1,0,36,0,1,0,0,0,56,0,3,0,0,0,1,4,8,0,
+1,0,18,0,1,0,0,0,56,0,1,0,4,0,70,0,71,0,74,0,75,0,6,1,1,0,32,0,70,0,88,0,
+106,0,124,0,142,0,160,0,178,0,196,0,214,0,230,0,246,1,6,1,22,1,38,1,54,1,
+70,1,86,1,106,1,126,1,146,1,166,1,186,1,206,1,226,1,246,2,8,2,26,2,44,2,62,
+2,80,2,104,2,122,0,3,0,0,0,1,3,222,0,3,14,56,2,28,14,56,0,0,0,3,0,0,0,1,9,
+140,0,3,14,38,2,10,14,38,0,0,0,3,0,0,0,1,3,56,0,3,14,20,1,248,14,20,0,0,0,
+3,0,0,0,1,3,62,0,3,14,2,1,230,14,2,0,0,0,3,0,0,0,1,4,164,0,3,13,240,1,212,
+13,240,0,0,0,3,0,0,0,1,4,170,0,3,13,222,1,194,13,222,0,0,0,3,0,0,0,1,3,32,
+0,3,13,204,1,176,13,204,0,0,0,3,0,0,0,1,3,38,0,3,13,186,1,158,13,186,0,0,
+0,3,0,0,0,1,3,78,0,2,1,140,13,168,0,0,0,3,0,0,0,1,8,254,0,2,1,124,13,152,
+0,0,0,3,0,0,0,1,2,172,0,2,1,108,13,136,0,0,0,3,0,0,0,1,2,180,0,2,1,92,13,
+120,0,0,0,3,0,0,0,1,4,28,0,2,1,76,13,104,0,0,0,3,0,0,0,1,4,36,0,2,1,60,13,
+88,0,0,0,3,0,0,0,1,2,156,0,2,1,44,13,72,0,0,0,3,0,0,0,1,2,164,0,2,1,28,13,
+56,0,0,0,3,0,0,0,1,2,206,0,2,13,40,1,12,0,1,0,0,0,56,0,3,0,0,0,1,8,122,0,
+2,13,20,0,248,0,1,0,0,0,56,0,3,0,0,0,1,2,36,0,2,13,0,0,228,0,1,0,0,0,56,0,
+3,0,0,0,1,2,40,0,2,12,236,0,208,0,1,0,0,0,56,0,3,0,0,0,1,3,140,0,2,12,216,
+0,188,0,1,0,0,0,56,0,3,0,0,0,1,3,144,0,2,12,196,0,168,0,1,0,0,0,56,0,3,0,
+0,0,1,2,4,0,2,12,176,0,148,0,1,0,0,0,56,0,3,0,0,0,1,2,8,0,2,12,156,0,128,
+0,1,0,0,0,56,0,3,0,0,0,1,2,46,0,1,0,108,0,1,0,0,0,56,0,3,0,0,0,1,7,220,0,
+1,0,90,0,1,0,0,0,56,0,3,0,0,0,1,1,136,0,1,0,72,0,1,0,0,0,56,0,3,0,0,0,1,1,
+142,0,1,0,54,0,1,0,0,0,56,0,3,0,0,0,1,2,244,0,1,0,36,0,1,0,0,0,56,0,3,0,0,
+0,1,2,250,0,1,0,18,0,1,0,0,0,56,0,1,0,1,0,66,0,3,0,0,0,1,1,106,0,1,0,36,0,
+1,0,0,0,56,0,3,0,0,0,1,1,112,0,1,0,18,0,1,0,0,0,56,0,1,0,1,0,49,0,6,0,9,0,
+4,0,14,0,32,0,50,0,68,0,3,0,0,0,1,1,132,0,1,0,72,0,1,0,0,0,56,0,3,0,0,0,1,
+7,50,0,1,0,54,0,1,0,0,0,56,0,3,0,0,0,1,1,14,0,1,0,36,0,1,0,0,0,56,0,3,0,0,
+0,1,1,20,0,1,0,18,0,1,0,0,0,56,0,1,0,11,0,19,0,20,0,23,0,24,0,55,0,58,0,59,
+0,78,0,79,0,108,0,109,0,6,3,1,0,4,0,14,0,40,0,66,0,92,0,3,0,0,0,1,0,20,0,
+2,0,104,9,152,0,1,0,0,0,56,0,1,0,1,1,2,0,3,0,0,0,1,0,20,0,2,0,78,9,126,0,
+1,0,0,0,56,0,1,0,1,1,1,0,3,0,0,0,1,0,20,0,2,0,52,9,100,0,1,0,0,0,56,0,1,0,
+1,1,18,0,3,0,0,0,1,0,20,0,2,0,26,9,74,0,1,0,0,0,56,0,1,0,1,1,17,0,1,0,3,0,
+19,0,20,0,55,0,6,0,9,0,4,0,14,0,38,0,62,0,86,0,3,0,0,0,1,0,18,0,1,1,192,0,
+1,0,0,0,56,0,1,0,1,0,64,0,3,0,0,0,1,0,18,0,1,1,168,0,1,0,0,0,56,0,1,0,1,0,
+63,0,3,0,0,0,1,0,18,0,1,1,144,0,1,0,0,0,57,0,1,0,1,0,100,0,3,0,0,0,1,0,18,
+0,1,1,120,0,1,0,0,0,57,0,1,0,1,0,99,0,6,2,1,0,14,0,34,0,58,0,76,0,100,0,118,
+0,142,0,160,0,184,0,208,0,232,1,0,1,24,1,48,1,72,0,3,0,0,0,1,0,18,0,1,1,62,
+0,1,0,0,0,57,0,1,0,1,0,17,0,3,0,0,0,1,5,186,0,1,1,38,0,1,0,0,0,57,0,3,0,0,
+0,1,0,18,0,1,1,20,0,1,0,0,0,57,0,1,0,1,0,21,0,3,0,0,0,1,7,232,0,1,0,252,0,
+1,0,0,0,57,0,3,0,0,0,1,0,18,0,1,0,234,0,1,0,0,0,57,0,1,0,1,0,110,0,3,0,0,
+0,1,7,80,0,1,0,210,0,1,0,0,0,57,0,3,0,0,0,1,0,18,0,1,0,192,0,1,0,0,0,57,0,
+1,0,1,0,43,0,3,0,0,0,1,0,18,0,1,0,168,0,1,0,0,0,57,0,1,0,1,0,42,0,3,0,0,0,
+1,0,18,0,1,0,144,0,1,0,0,0,57,0,1,0,1,0,47,0,3,0,0,0,1,0,18,0,1,0,120,0,1,
+0,0,0,57,0,1,0,1,0,46,0,3,0,0,0,1,0,18,0,1,0,96,0,1,0,0,0,57,0,1,0,1,0,60,
+0,3,0,0,0,1,0,18,0,1,0,72,0,1,0,0,0,57,0,1,0,1,0,59,0,3,0,0,0,1,0,18,0,1,
+0,48,0,1,0,0,0,57,0,1,0,1,0,80,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,57,0,1,
+0,1,0,79,0,1,0,6,0,41,0,42,0,44,0,45,1,7,1,9,0,6,2,1,0,8,0,22,0,42,0,62,0,
+82,0,102,0,128,0,148,0,174,0,3,0,2,4,244,0,172,0,1,6,198,0,0,0,1,0,0,0,58,
+0,3,0,2,4,224,0,152,0,1,6,204,0,0,0,1,0,0,0,58,0,3,0,2,4,204,0,132,0,1,7,
+4,0,0,0,1,0,0,0,58,0,3,0,2,4,184,0,112,0,1,6,28,0,0,0,1,0,0,0,58,0,3,0,2,
+4,164,0,92,0,1,0,20,0,0,0,1,0,0,0,58,0,1,0,1,1,5,0,3,0,2,4,138,0,66,0,1,5,
+180,0,0,0,1,0,0,0,58,0,3,0,2,4,118,0,46,0,1,0,20,0,0,0,1,0,0,0,58,0,1,0,1,
+0,24,0,3,0,2,4,92,0,20,0,1,0,86,0,0,0,1,0,0,0,58,0,1,0,31,0,16,0,17,0,38,
+0,39,0,50,0,51,0,55,0,56,0,67,0,68,0,79,0,80,0,83,0,84,0,87,0,88,0,99,0,100,
+0,105,0,106,0,117,0,118,0,121,0,122,1,1,1,2,1,15,1,16,1,17,1,18,1,34,0,1,
+0,1,0,23,0,6,0,1,0,24,0,54,0,82,0,108,0,132,0,158,0,182,0,204,0,232,1,2,1,
+26,1,52,1,76,1,98,1,126,1,152,1,176,1,202,1,226,1,248,2,20,2,46,2,70,2,96,
+2,172,0,3,0,3,7,222,2,66,2,140,0,1,8,100,0,3,2,66,2,66,6,8,0,1,0,0,0,58,0,
+3,0,3,7,194,2,38,2,112,0,1,8,72,0,2,2,38,5,236,0,1,0,0,0,58,0,3,0,3,7,168,
+2,12,2,86,0,1,8,46,0,1,5,210,0,1,0,0,0,58,0,3,0,2,7,144,2,62,0,1,8,22,0,3,
+1,244,1,244,5,186,0,1,0,0,0,58,0,3,0,2,7,118,2,36,0,1,7,252,0,2,1,218,5,160,
+0,1,0,0,0,58,0,3,0,2,7,94,2,12,0,1,7,228,0,1,5,136,0,1,0,0,0,58,0,3,0,3,7,
+72,1,172,1,246,0,1,2,108,0,3,1,172,1,172,5,114,0,1,0,0,0,58,0,3,0,3,7,44,
+1,144,1,218,0,1,2,80,0,2,1,144,5,86,0,1,0,0,0,58,0,3,0,3,7,18,1,118,1,192,
+0,1,2,54,0,1,5,60,0,1,0,0,0,58,0,3,0,2,6,250,1,168,0,1,2,30,0,3,1,94,1,94,
+5,36,0,1,0,0,0,58,0,3,0,2,6,224,1,142,0,1,2,4,0,2,1,68,5,10,0,1,0,0,0,58,
+0,3,0,2,6,200,1,118,0,1,1,236,0,1,4,242,0,1,0,0,0,58,0,3,0,3,6,178,1,22,1,
+96,0,1,1,254,0,3,1,22,1,22,4,220,0,1,0,0,0,58,0,3,0,3,6,150,0,250,1,68,0,
+1,1,226,0,2,0,250,4,192,0,1,0,0,0,58,0,3,0,3,6,124,0,224,1,42,0,1,1,200,0,
+1,4,166,0,1,0,0,0,58,0,3,0,2,6,100,1,18,0,1,1,176,0,3,0,200,0,200,4,142,0,
+1,0,0,0,58,0,3,0,2,6,74,0,248,0,1,1,150,0,2,0,174,4,116,0,1,0,0,0,58,0,3,
+0,2,6,50,0,224,0,1,1,126,0,1,4,92,0,1,0,0,0,58,0,3,0,3,6,28,0,128,0,202,0,
+1,1,130,0,3,0,128,0,128,4,70,0,1,0,0,0,58,0,3,0,3,6,0,0,100,0,174,0,1,1,102,
+0,2,0,100,4,42,0,1,0,0,0,58,0,3,0,3,5,230,0,74,0,148,0,1,1,76,0,1,4,16,0,
+1,0,0,0,58,0,3,0,2,5,206,0,124,0,1,1,52,0,3,0,50,0,50,3,248,0,1,0,0,0,58,
+0,3,0,2,5,180,0,98,0,1,1,26,0,2,0,24,3,222,0,1,0,0,0,58,0,2,0,8,0,13,0,13,
+0,0,0,140,0,141,0,1,0,143,0,156,0,3,0,159,0,170,0,17,0,172,0,173,0,29,0,175,
+0,204,0,31,1,35,1,37,0,61,1,39,1,39,0,64,0,3,0,2,5,104,0,22,0,1,0,206,0,1,
+3,146,0,1,0,0,0,58,0,1,0,7,0,50,0,51,0,67,0,68,0,121,0,122,1,34,0,6,3,1,0,
+2,0,10,0,30,0,3,0,1,0,40,0,1,5,188,0,1,3,96,0,1,0,0,0,58,0,3,0,1,0,20,0,1,
+0,70,0,1,3,76,0,1,0,0,0,58,0,1,0,23,0,20,0,21,0,24,0,25,0,42,0,43,0,46,0,
+47,0,59,0,60,0,63,0,64,0,79,0,80,0,83,0,84,0,99,0,100,0,109,0,110,1,20,1,
+23,1,25,0,1,0,1,0,29,0,6,3,1,0,4,0,14,0,40,0,66,0,92,0,3,0,1,0,98,0,1,0,20,
+0,1,2,242,0,1,0,0,0,58,0,1,0,1,0,15,0,3,0,1,0,72,0,1,0,20,0,1,2,216,0,1,0,
+0,0,58,0,1,0,1,0,16,0,3,0,1,0,46,0,1,0,20,0,1,2,190,0,1,0,0,0,58,0,1,0,1,
+0,82,0,3,0,1,0,20,0,1,0,68,0,1,2,164,0,1,0,0,0,58,0,1,0,22,0,20,0,21,0,25,
+0,42,0,43,0,46,0,47,0,49,0,50,0,51,0,59,0,60,0,67,0,68,0,79,0,80,0,109,0,
+110,1,20,1,23,1,25,1,34,0,1,0,1,0,83,0,6,2,1,0,1,0,8,0,3,0,2,0,20,1,86,0,
+1,0,70,0,0,0,1,0,0,0,58,0,1,0,23,0,141,0,144,0,147,0,148,0,149,0,151,0,152,
+0,154,0,158,0,160,0,162,0,164,0,172,0,173,0,174,0,175,0,176,0,177,0,178,0,
+181,0,184,0,189,1,36,0,1,0,8,0,19,0,20,0,23,0,24,0,108,0,109,1,3,1,5,0,6,
+1,1,0,6,0,18,0,42,0,64,0,90,0,114,0,136,0,3,0,3,3,188,3,188,0,138,0,1,0,66,
+0,1,3,188,0,1,0,0,0,58,0,3,0,2,3,164,0,114,0,1,0,42,0,1,3,164,0,1,0,0,0,58,
+0,3,0,1,0,92,0,1,0,20,0,1,3,142,0,1,0,0,0,58,0,1,0,1,0,35,0,3,0,3,3,116,3,
+116,0,66,0,1,0,104,0,1,3,116,0,1,0,0,0,58,0,3,0,2,3,92,0,42,0,1,0,80,0,1,
+3,92,0,1,0,0,0,58,0,3,0,1,0,20,0,1,0,58,0,1,3,70,0,1,0,0,0,58,0,1,0,17,0,
+20,0,21,0,24,0,25,0,42,0,43,0,46,0,47,0,59,0,60,0,79,0,80,0,109,0,110,1,20,
+1,23,1,25,0,1,0,1,0,67,0,6,0,9,0,2,0,10,0,34,0,3,0,1,0,42,0,1,0,18,0,0,0,
+1,0,0,0,58,0,1,0,1,0,108,0,3,0,1,0,18,0,1,0,52,0,0,0,1,0,0,0,58,0,1,0,15,
+0,20,0,21,0,24,0,25,0,42,0,43,0,46,0,47,0,59,0,60,0,109,0,110,1,20,1,23,1,
+25,0,1,0,1,0,109,0,6,3,1,0,6,0,18,0,40,0,62,0,84,0,110,0,136,0,3,0,2,0,194,
+0,138,0,1,0,86,0,1,0,194,0,1,0,0,0,58,0,3,0,2,0,172,0,116,0,1,0,90,0,1,0,
+172,0,1,0,0,0,58,0,3,0,2,0,150,0,94,0,1,0,144,0,1,0,150,0,1,0,0,0,58,0,3,
+0,1,0,72,0,1,0,20,0,1,0,128,0,1,0,0,0,58,0,1,0,1,0,20,0,3,0,1,0,46,0,1,0,
+20,0,1,0,102,0,1,0,0,0,58,0,1,0,1,1,3,0,3,0,1,0,20,0,1,0,70,0,1,0,76,0,1,
+0,0,0,58,0,1,0,23,0,16,0,17,0,55,0,56,0,63,0,64,0,67,0,68,0,79,0,80,0,83,
+0,84,0,87,0,88,0,93,0,94,0,99,0,100,0,105,0,106,0,117,0,118,1,34,0,1,0,1,
+0,19,0,1,0,2,1,44,1,46,0,6,0,1,0,17,0,40,0,62,0,84,0,106,0,128,0,150,0,172,
+0,194,0,216,0,238,1,2,1,126,1,146,1,166,1,186,2,42,2,66,0,3,0,3,1,40,1,166,
+0,238,0,1,2,50,0,0,0,1,0,0,0,58,0,3,0,3,1,144,1,18,0,216,0,1,2,28,0,0,0,1,
+0,0,0,58,0,3,0,3,0,252,0,252,0,194,0,1,2,6,0,0,0,1,0,0,0,58,0,3,0,2,1,100,
+0,172,0,1,1,240,0,1,0,230,0,1,0,0,0,58,0,3,0,2,0,208,0,150,0,1,1,218,0,1,
+1,78,0,1,0,0,0,58,0,3,0,2,0,186,0,128,0,1,1,196,0,1,0,186,0,1,0,0,0,58,0,
+3,0,1,0,106,0,1,1,174,0,2,1,34,0,164,0,1,0,0,0,58,0,3,0,1,0,84,0,1,1,152,
+0,2,0,142,1,12,0,1,0,0,0,58,0,3,0,1,0,62,0,1,1,130,0,2,0,120,0,120,0,1,0,
+0,0,58,0,3,0,2,0,98,0,40,0,1,1,108,0,0,0,1,0,0,0,58,0,3,0,1,0,20,0,1,1,88,
+0,1,0,78,0,1,0,0,0,58,0,2,0,9,0,14,0,21,0,0,0,26,0,29,0,8,0,53,0,56,0,12,
+0,81,0,84,0,16,0,101,0,102,0,20,0,251,0,251,0,22,1,1,1,4,0,23,1,19,1,21,0,
+27,1,27,1,32,0,30,0,1,0,21,0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,
+0,160,0,162,0,164,0,172,0,173,0,175,0,176,0,177,0,178,0,181,0,184,0,189,1,
+36,0,3,0,2,0,80,0,190,0,1,0,220,0,0,0,1,0,0,0,58,0,3,0,2,0,60,0,194,0,1,0,
+200,0,0,0,1,0,0,0,58,0,3,0,1,0,150,0,1,0,180,0,1,0,40,0,1,0,0,0,58,0,3,0,
+1,0,154,0,1,0,160,0,1,0,20,0,1,0,0,0,58,0,1,0,44,0,13,0,140,0,143,0,145,0,
+146,0,150,0,153,0,155,0,156,0,157,0,159,0,161,0,163,0,165,0,166,0,167,0,168,
+0,169,0,170,0,171,0,179,0,180,0,182,0,183,0,185,0,186,0,187,0,188,0,190,0,
+191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,0,201,0,202,1,35,
+1,37,1,39,0,3,0,1,0,18,0,1,0,48,0,0,0,1,0,0,0,58,0,1,0,1,0,26,0,3,0,1,0,18,
+0,1,0,24,0,0,0,1,0,0,0,58,0,1,0,1,0,27,0,1,0,2,0,158,0,174,0,6,4,1,0,1,0,
+8,0,3,0,1,0,108,0,1,0,60,0,0,0,1,0,0,0,11,0,6,4,1,0,1,0,8,0,3,0,1,0,18,0,
+1,0,34,0,0,0,1,0,0,0,12,0,1,0,6,1,55,1,56,1,57,1,60,1,61,1,62,0,2,0,3,0,8,
+0,12,0,0,0,14,0,124,0,5,0,247,1,34,0,116,0,6,4,1,0,1,0,8,0,3,0,0,0,1,0,18,
+0,1,0,108,0,1,0,0,0,58,0,1,0,1,0,139,0,6,4,1,0,3,0,12,0,36,0,60,0,3,0,0,0,
+1,0,18,0,1,0,72,0,1,0,0,0,58,0,1,0,1,1,60,0,3,0,0,0,1,0,18,0,1,0,48,0,1,0,
+0,0,58,0,1,0,1,1,61,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,58,0,1,0,1,1,62,0,
+1,0,4,1,53,1,54,1,58,1,59,0,1,0,0,0,1,0,8,0,1,0,6,0,4,0,1,0,2,0,69,0,70,0,
+1,0,0,0,1,0,8,0,2,0,10,0,2,0,171,0,174,0,1,0,2,0,157,0,158,0,1,0,0,0,1,0,
+8,0,1,0,6,0,6,0,1,0,2,0,225,0,226,0,1,0,0,0,1,0,8,0,2,0,18,0,6,0,73,0,74,
+0,171,0,174,0,231,0,232,0,1,0,6,0,69,0,70,0,157,0,158,0,225,0,226,0,4,0,1,
+0,1,0,8,0,1,1,18,0,11,0,28,0,46,0,64,0,82,0,100,0,118,0,136,0,194,0,204,0,
+246,1,8,0,2,0,6,0,12,0,193,0,2,0,185,0,198,0,2,0,188,0,2,0,6,0,12,0,191,0,
+2,0,185,0,200,0,2,0,188,0,2,0,6,0,12,0,192,0,2,0,185,0,204,0,2,0,189,0,2,
+0,6,0,12,0,194,0,2,0,185,0,199,0,2,0,188,0,2,0,6,0,12,0,195,0,2,0,185,0,201,
+0,2,0,188,0,2,0,6,0,12,0,196,0,2,0,185,0,203,0,2,0,189,0,7,0,16,0,22,0,28,
+0,34,0,40,0,46,0,52,0,193,0,2,0,179,0,191,0,2,0,180,0,192,0,2,0,181,0,194,
+0,2,0,182,0,195,0,2,0,183,0,196,0,2,0,184,0,197,0,2,0,190,0,1,0,4,0,202,0,
+2,0,188,0,5,0,12,0,18,0,24,0,30,0,36,0,198,0,2,0,179,0,200,0,2,0,180,0,199,
+0,2,0,182,0,201,0,2,0,183,0,202,0,2,0,186,0,2,0,6,0,12,0,204,0,2,0,181,0,
+203,0,2,0,184,0,1,0,4,0,197,0,2,0,185,0,2,0,2,0,179,0,186,0,0,0,188,0,190,
+0,8,0,1,1,1,0,1,0,8,0,1,0,20,0,148,0,1,1,1,0,1,0,8,0,1,0,6,0,149,0,1,0,1,
+0,145,0,1,1,1,0,1,0,8,0,2,0,20,0,7,0,252,0,249,0,250,0,251,1,39,1,44,1,46,
+0,1,0,7,0,10,0,11,0,12,0,102,0,145,0,157,0,171,0,1,0,9,0,1,0,8,0,2,0,74,0,
+34,0,253,0,254,1,1,1,2,1,3,1,4,1,7,1,8,1,9,1,10,1,11,1,12,0,255,1,0,1,13,
+1,14,1,15,1,16,1,5,1,6,0,63,0,64,0,20,0,21,0,109,0,110,0,42,0,43,0,46,0,47,
+0,59,0,60,0,79,0,80,0,1,0,34,0,11,0,12,0,16,0,17,0,20,0,21,0,42,0,43,0,46,
+0,47,0,59,0,60,0,63,0,64,0,79,0,80,0,99,0,100,0,109,0,110,0,255,1,0,1,3,1,
+4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,0,1,0,9,0,1,0,8,0,1,0,20,0,
+174,0,1,0,9,0,1,0,8,0,1,0,6,0,172,0,1,0,2,0,99,0,100,0,1,0,9,0,1,0,8,0,2,
+0,30,0,12,1,1,1,2,0,255,1,0,1,13,1,14,1,17,1,18,0,16,0,17,0,99,0,100,0,1,
+0,12,0,16,0,17,0,63,0,64,0,79,0,80,0,99,0,100,1,1,1,2,1,17,1,18,0,1,0,9,0,
+1,0,8,0,2,0,38,0,16,1,1,1,2,1,3,1,4,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,
+1,15,1,16,1,5,1,6,0,1,0,16,0,16,0,17,0,20,0,21,0,42,0,43,0,46,0,47,0,59,0,
+60,0,79,0,80,0,99,0,100,0,109,0,110,0,1,2,1,0,1,0,8,0,2,0,50,0,22,1,29,1,
+30,1,19,1,20,1,22,1,23,1,27,1,28,1,33,1,34,1,31,1,32,1,24,1,25,1,52,1,45,
+1,47,1,21,1,26,1,55,1,56,1,57,0,1,0,22,0,15,0,16,0,19,0,20,0,23,0,24,0,27,
+0,29,0,35,0,67,0,82,0,83,0,108,0,109,0,139,0,158,0,174,1,3,1,5,1,60,1,61,
+1,62,};
+#endif
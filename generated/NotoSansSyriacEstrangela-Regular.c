@@ -0,0 +1,1757 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansSyriacEstrangela_Regular_ttf_size = 46396;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansSyriacEstrangela_Regular_ttf");
+asm(".type fz_font_NotoSansSyriacEstrangela_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansSyriacEstrangela_Regular_ttf, 46396");
+asm(".balign 64");
+asm("fz_font_NotoSansSyriacEstrangela_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansSyriacEstrangela-Regular.ttf\"");
+#else
+const int fz_font_NotoSansSyriacEstrangela_Regular_ttf_size = 46396;
+const char fz_font_NotoSansSyriacEstrangela_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,26,103,26,103,0,0,100,200,0,0,1,16,
+71,80,79,83,126,91,127,25,0,0,101,216,0,0,43,234,71,83,85,66,169,216,242,
+119,0,0,145,196,0,0,35,118,79,83,47,50,118,116,93,162,0,0,1,104,0,0,0,96,
+99,109,97,112,180,95,189,52,0,0,6,124,0,0,1,180,103,97,115,112,0,7,0,7,0,
+0,100,188,0,0,0,12,103,108,121,102,97,190,144,167,0,0,10,152,0,0,83,196,104,
+101,97,100,8,204,44,103,0,0,0,236,0,0,0,54,104,104,101,97,14,221,0,136,0,
+0,1,36,0,0,0,36,104,109,116,120,71,221,231,108,0,0,1,200,0,0,4,180,108,111,
+99,97,239,243,218,123,0,0,8,48,0,0,2,102,109,97,120,112,1,71,0,201,0,0,1,
+72,0,0,0,32,110,97,109,101,148,207,191,92,0,0,94,92,0,0,6,64,112,111,115,
+116,255,105,0,102,0,0,100,156,0,0,0,32,0,1,0,0,0,1,10,61,255,232,41,188,95,
+15,60,245,0,11,8,0,0,0,0,0,207,58,97,116,0,0,0,0,211,11,119,207,252,184,252,
+118,10,175,7,115,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,115,252,118,0,0,10,175,
+252,184,248,58,10,175,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,40,0,1,0,0,1,50,0,
+69,0,8,0,130,0,6,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,1,0,4,5,17,1,144,0,5,0,
+0,5,51,4,204,0,0,0,153,5,51,4,204,0,0,2,204,0,102,2,145,0,0,2,4,5,3,5,3,6,
+2,2,3,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,115,
+252,118,0,0,7,115,3,138,32,62,1,97,215,255,0,0,0,0,0,0,0,0,0,32,0,7,4,205,
+0,193,0,0,0,0,2,20,0,0,2,20,0,0,0,0,255,220,0,0,255,37,0,0,255,220,0,0,254,
+81,7,112,0,149,7,112,0,149,7,112,0,149,6,245,0,149,6,245,0,149,0,0,255,8,
+7,171,0,100,7,190,0,100,5,235,255,176,5,216,255,176,8,186,0,100,7,143,0,100,
+4,146,255,176,5,190,255,176,8,186,0,100,7,143,0,100,4,146,255,176,5,190,255,
+176,4,80,0,90,4,64,0,90,4,80,0,90,4,64,0,90,7,112,0,140,7,137,0,140,4,226,
+0,140,4,201,0,140,2,52,0,140,2,55,0,140,5,156,0,100,5,209,0,100,4,83,255,
+176,4,28,255,176,7,253,0,100,7,97,0,100,4,228,255,176,5,128,255,176,7,253,
+0,100,7,97,0,100,4,228,255,176,5,128,255,176,1,242,0,120,2,15,0,120,2,122,
+255,176,2,57,255,176,9,194,0,140,7,29,0,140,7,22,0,140,5,37,255,176,5,98,
+255,176,5,63,0,100,5,55,0,99,2,180,255,176,2,187,255,176,7,20,0,120,7,39,
+0,120,7,44,255,176,7,10,255,176,5,108,0,120,2,58,0,126,2,95,255,176,2,84,
+255,176,7,23,0,140,7,32,0,140,7,42,255,176,7,32,255,176,7,23,0,140,7,32,0,
+140,7,42,255,176,7,32,255,176,7,159,0,100,5,242,0,100,3,255,255,176,5,172,
+255,176,6,191,0,100,6,197,0,100,4,245,255,176,4,237,255,176,6,116,0,120,6,
+17,0,120,4,166,255,176,4,189,255,176,5,3,254,112,4,115,254,112,6,173,0,100,
+6,194,0,100,5,103,255,176,5,82,255,176,4,80,0,90,4,64,0,90,7,144,0,100,6,
+2,0,100,4,91,255,176,5,233,255,176,5,241,0,133,5,216,0,133,7,171,0,100,7,
+190,0,100,5,235,255,176,5,216,255,176,8,186,0,100,7,143,0,100,4,146,255,176,
+5,190,255,176,4,80,0,90,4,64,0,90,4,170,0,140,4,170,0,140,6,191,0,100,6,197,
+0,100,4,195,255,176,4,187,255,176,5,63,0,100,5,85,0,99,2,205,255,176,2,182,
+255,176,3,178,0,91,3,9,255,176,4,188,0,234,2,13,0,159,2,13,0,159,2,55,0,180,
+2,13,0,159,3,103,0,159,2,193,0,159,2,193,0,159,2,193,0,159,2,193,0,159,4,
+162,0,245,7,98,0,244,5,142,1,4,6,17,0,225,0,0,255,80,0,0,255,13,0,0,255,26,
+0,0,255,162,0,0,255,78,0,0,255,97,0,0,255,136,0,0,255,9,0,0,255,28,0,0,255,
+49,0,0,255,49,0,0,255,16,0,0,255,30,0,0,255,180,0,0,255,42,0,0,255,42,0,0,
+255,180,0,0,252,210,0,0,255,124,0,0,255,179,0,0,255,180,0,0,255,180,0,0,255,
+40,0,0,255,40,0,0,255,25,0,0,255,24,0,0,254,159,0,0,255,7,0,0,254,245,0,0,
+254,251,0,0,255,153,0,0,254,234,0,0,255,124,0,0,255,154,0,0,254,234,0,0,255,
+124,0,0,255,11,0,0,254,253,0,0,254,244,0,0,254,251,0,0,255,56,0,0,255,18,
+0,0,255,56,0,0,255,67,0,0,255,61,0,0,255,56,0,0,255,15,0,0,255,110,0,0,254,
+252,0,0,255,97,0,0,255,97,0,0,255,209,0,0,254,227,0,0,255,13,0,0,255,9,0,
+0,255,15,0,0,255,14,0,0,255,23,0,0,255,15,0,0,255,38,0,0,255,49,0,0,255,0,
+0,0,255,43,0,0,255,97,0,0,255,56,0,0,255,56,1,133,0,60,2,62,0,191,3,65,0,
+50,3,181,0,50,3,30,0,60,3,162,0,70,3,69,0,20,3,188,0,0,3,198,0,10,3,92,0,
+30,3,211,0,130,2,24,0,112,2,24,0,109,2,33,0,152,2,55,0,130,2,69,0,170,2,69,
+0,170,5,206,0,152,3,8,0,66,2,70,0,183,2,94,0,82,2,94,0,61,2,155,0,160,2,155,
+0,50,4,80,0,160,4,80,255,206,4,80,0,160,4,80,255,206,3,250,0,82,3,250,0,80,
+3,94,0,70,4,149,0,130,4,149,0,130,4,150,0,145,3,175,0,90,3,45,0,32,2,240,
+0,23,2,147,0,84,3,109,0,115,4,215,0,170,7,40,0,180,7,0,0,180,4,80,0,90,4,
+64,0,90,9,181,0,100,6,184,255,176,9,181,0,100,6,184,255,176,9,181,0,100,6,
+184,255,176,10,175,0,100,7,178,255,176,10,175,0,100,7,178,255,176,10,175,
+0,100,7,178,255,176,8,132,0,149,7,229,0,149,8,132,0,149,7,229,0,149,6,56,
+255,176,6,212,255,176,6,56,255,176,6,212,255,176,4,211,255,176,5,255,255,
+176,4,211,255,176,5,255,255,176,4,211,255,176,5,255,255,176,3,18,255,176,
+3,25,255,176,2,239,255,176,2,250,255,176,2,189,255,176,2,254,255,176,3,62,
+255,189,3,40,255,190,2,184,0,130,0,0,255,201,0,0,255,161,0,0,255,155,0,0,
+255,180,0,0,255,179,0,0,1,167,2,38,255,176,3,32,255,176,0,66,255,176,1,9,
+255,176,0,156,255,176,0,0,0,0,254,72,252,184,255,216,255,216,255,216,254,
+72,252,184,0,120,0,120,0,120,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,168,0,0,0,78,
+0,64,0,5,0,14,0,0,0,13,0,33,0,43,0,47,0,58,0,61,0,93,0,160,0,171,0,176,0,
+187,3,4,3,8,3,10,3,32,3,37,3,46,3,49,6,12,6,27,6,31,6,33,6,64,6,85,6,108,
+6,112,7,13,7,47,7,74,7,79,32,15,32,38,32,68,34,18,37,204,38,113,254,255,255,
+255,0,0,0,0,0,13,0,32,0,40,0,45,0,58,0,61,0,91,0,160,0,171,0,176,0,187,3,
+3,3,7,3,10,3,32,3,35,3,45,3,48,6,12,6,27,6,31,6,33,6,64,6,75,6,96,6,112,7,
+0,7,15,7,48,7,77,32,12,32,38,32,68,34,18,37,204,38,112,254,255,255,255,0,
+1,255,245,0,0,0,0,0,0,0,163,0,177,0,0,255,99,0,62,0,67,0,47,253,164,253,162,
+253,161,253,146,253,137,253,130,253,129,250,207,250,193,250,192,250,90,250,
+60,250,104,250,109,250,78,249,125,0,0,249,92,0,0,223,248,224,184,224,172,
+222,219,219,40,218,133,1,2,0,1,0,0,0,0,0,74,0,76,0,82,0,0,0,0,0,82,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,46,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,224,0,225,0,226,0,235,
+0,236,0,242,0,218,0,239,0,227,0,241,0,228,0,139,0,8,0,13,0,14,0,18,0,22,0,
+26,0,28,0,30,0,32,0,34,0,36,0,40,0,44,0,48,0,52,0,53,0,57,0,61,0,65,0,69,
+0,73,0,77,0,81,0,85,0,89,0,91,0,95,0,97,0,101,0,103,0,107,0,111,0,113,0,115,
+0,119,0,0,0,21,0,21,0,21,0,21,0,34,0,63,0,87,0,110,0,168,0,176,0,184,0,245,
+0,253,1,47,1,104,1,176,1,244,2,42,2,96,2,155,2,211,3,6,3,18,3,30,3,42,3,54,
+3,66,3,78,3,102,3,140,3,206,4,32,4,78,4,137,4,163,4,200,5,9,5,86,5,163,5,
+228,6,33,6,94,6,153,6,212,6,224,6,236,6,248,7,4,7,35,7,75,7,124,7,161,7,189,
+7,249,8,58,8,104,8,152,8,198,9,9,9,74,9,115,9,198,10,39,10,132,10,211,10,
+251,11,33,11,84,11,119,11,186,12,10,12,102,12,182,12,190,12,198,12,206,12,
+214,13,0,13,38,13,72,13,112,13,178,13,252,14,67,14,131,14,227,15,67,15,161,
+15,255,16,76,16,164,16,235,17,64,17,147,17,217,17,229,17,241,18,67,18,141,
+18,212,19,35,19,108,19,189,20,6,20,93,20,178,20,248,21,75,21,164,21,250,22,
+74,22,90,22,106,22,140,22,189,23,16,23,103,23,188,24,12,24,89,24,174,25,0,
+25,76,25,115,25,134,25,155,25,164,25,173,25,186,25,199,25,212,25,225,25,238,
+25,251,26,8,26,76,26,105,26,133,26,220,26,237,27,7,27,33,27,46,27,92,27,142,
+27,180,27,220,28,4,28,17,28,30,28,58,28,86,28,95,28,131,28,167,28,176,28,
+185,28,194,28,203,28,216,28,229,28,246,29,7,29,22,29,36,29,110,29,192,29,
+225,29,239,29,248,30,5,30,43,30,52,30,65,30,102,30,137,30,162,30,195,30,208,
+30,231,31,40,31,62,31,76,31,126,31,140,31,195,31,233,32,18,32,61,32,100,32,
+113,32,125,32,137,32,149,32,161,32,173,32,185,32,247,33,3,33,15,33,27,33,
+39,33,51,33,63,33,75,33,97,33,112,33,149,33,209,34,18,34,57,34,97,34,147,
+34,200,34,246,35,38,35,60,35,83,35,105,35,130,35,167,35,202,35,218,36,16,
+36,44,36,73,36,102,36,122,36,141,36,157,36,173,36,181,36,189,36,227,37,10,
+37,45,37,69,37,82,37,102,37,118,37,134,37,149,37,162,37,201,38,34,38,90,38,
+162,38,178,38,194,38,206,38,218,38,234,38,250,39,6,39,18,39,30,39,42,39,58,
+39,74,39,86,39,98,39,114,39,126,39,142,39,154,39,166,39,178,39,194,39,210,
+39,221,39,232,39,247,40,6,40,17,40,28,40,39,40,50,40,62,40,74,40,86,40,98,
+40,109,40,120,40,151,40,160,40,169,40,191,40,213,40,235,41,1,41,20,41,39,
+41,56,41,75,41,92,41,92,41,106,41,120,41,133,41,146,41,159,41,173,41,187,
+41,200,41,213,41,226,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,
+55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,
+1,255,220,0,0,0,36,5,182,0,3,0,0,19,17,35,17,36,72,5,182,250,74,5,182,0,1,
+255,37,0,0,0,219,5,204,0,14,0,0,51,35,17,7,39,55,39,55,23,55,23,7,23,7,39,
+36,72,134,49,171,171,49,170,170,49,171,171,49,134,4,161,136,49,169,168,49,
+171,171,49,168,169,49,136,0,0,1,255,220,0,0,1,174,5,204,0,10,0,0,1,7,39,55,
+33,17,35,17,33,39,55,1,174,217,49,137,254,246,71,1,81,137,49,4,245,214,49,
+130,251,46,5,25,130,49,0,1,254,81,0,0,0,35,5,204,0,10,0,0,51,35,17,33,23,
+7,39,55,23,7,33,35,71,254,246,137,49,217,217,49,137,1,81,4,210,130,49,214,
+215,49,130,0,0,1,0,149,255,240,7,97,4,195,0,30,0,0,1,22,0,22,23,7,38,0,33,
+35,22,18,23,35,38,2,53,52,54,55,22,22,51,23,32,0,55,23,6,0,5,3,31,130,1,78,
+224,111,70,199,253,92,254,178,15,26,73,23,151,36,90,28,32,66,203,80,77,1,
+18,2,149,210,109,161,253,121,254,230,2,106,49,254,232,137,33,135,34,2,90,
+94,254,146,160,235,1,149,28,45,49,10,10,12,1,1,17,197,99,185,254,217,12,0,
+255,255,0,149,255,240,7,97,4,195,18,6,0,8,0,0,255,255,0,149,255,240,7,97,
+4,195,18,6,0,8,0,0,0,1,0,149,0,0,7,97,4,195,0,34,0,0,33,35,34,36,0,36,35,
+35,22,18,23,35,38,2,53,52,54,55,22,22,51,23,32,0,55,23,6,0,5,21,22,0,4,51,
+51,6,245,91,186,254,205,254,133,254,207,193,15,29,71,21,151,36,90,28,32,66,
+203,80,77,1,18,2,149,210,109,161,253,122,254,225,121,1,91,1,21,174,67,129,
+1,82,153,110,254,148,146,235,1,149,29,45,48,10,10,12,1,1,17,197,99,186,254,
+216,11,9,46,254,225,130,255,255,0,149,0,0,7,97,4,195,18,6,0,11,0,0,0,1,255,
+8,4,87,1,15,6,10,0,30,0,0,19,46,2,35,22,22,23,35,39,39,38,38,53,52,54,55,
+22,22,51,50,54,55,23,6,6,7,21,22,22,23,177,83,131,72,57,10,25,5,83,6,7,7,
+19,21,17,34,64,14,85,163,66,55,45,146,97,38,131,60,4,87,30,121,69,35,133,
+44,51,47,39,84,16,22,26,5,6,3,79,67,51,59,80,16,5,20,111,20,0,1,0,100,0,0,
+7,29,3,110,0,38,0,0,33,34,38,39,55,22,22,51,33,50,54,53,52,38,38,35,34,6,
+35,34,38,39,53,22,22,51,50,54,51,50,22,23,23,22,22,21,20,6,35,1,235,159,200,
+32,92,54,156,135,3,188,98,82,49,105,105,107,219,107,132,149,33,34,143,127,
+119,235,119,160,170,27,7,5,8,172,198,86,74,123,77,51,89,115,98,195,70,10,
+11,9,146,8,8,10,154,155,45,43,85,31,193,166,0,1,0,100,0,0,7,190,3,110,0,49,
+0,0,33,34,38,39,55,22,22,51,33,50,54,53,52,38,38,35,34,6,35,34,38,39,53,22,
+22,51,50,54,51,50,22,23,23,22,22,21,20,6,7,22,22,51,21,34,38,39,35,6,6,35,
+1,235,159,200,32,92,54,156,135,3,188,98,82,49,105,105,107,219,107,132,149,
+33,34,143,127,119,235,119,160,170,27,7,5,8,8,10,9,76,94,91,115,44,10,41,130,
+100,86,74,123,77,51,89,115,98,195,70,10,11,9,146,8,8,10,154,155,45,43,85,
+31,42,73,32,28,29,155,32,54,43,43,0,0,1,255,176,0,0,5,235,3,110,0,48,0,0,
+49,34,38,53,52,54,51,33,50,54,53,52,38,38,35,34,6,35,34,38,39,53,22,22,51,
+50,54,51,50,22,23,23,22,22,21,20,6,7,22,22,51,21,34,38,39,35,6,6,35,33,47,
+47,33,4,2,98,82,49,105,105,107,219,107,132,149,33,34,143,127,119,235,119,
+160,170,27,7,5,8,8,10,9,76,94,91,115,44,10,41,130,100,41,36,36,42,89,115,
+98,195,70,10,11,9,146,8,8,10,154,155,45,43,85,31,42,73,32,28,29,155,32,54,
+43,43,0,1,255,176,0,0,5,74,3,110,0,37,0,0,49,34,38,53,52,54,51,33,50,54,53,
+52,38,38,35,34,6,35,34,38,39,53,22,22,51,50,54,51,50,22,23,23,22,22,21,20,
+6,35,33,47,47,33,4,2,98,82,49,105,105,107,219,107,132,149,33,34,143,127,119,
+235,119,160,170,27,7,5,8,172,198,41,36,36,42,89,115,98,195,70,10,11,9,146,
+8,8,10,154,155,45,43,85,31,193,166,0,0,1,0,100,252,255,10,152,4,74,0,26,0,
+0,5,38,0,1,55,8,2,23,7,39,44,3,35,34,4,7,39,54,36,51,32,4,4,23,7,169,215,
+253,178,254,231,143,1,3,2,76,2,103,232,94,116,254,188,254,98,254,30,254,56,
+226,134,254,248,73,29,86,1,30,98,1,41,1,180,1,158,239,199,154,2,156,1,136,
+83,254,156,253,84,253,214,152,121,82,228,217,166,76,16,9,144,16,20,76,136,
+148,0,1,0,100,252,255,10,152,4,74,0,30,0,0,5,38,0,1,55,18,0,23,51,21,22,0,
+23,7,39,44,3,35,34,4,7,39,54,36,51,32,4,4,23,7,169,215,253,178,254,231,143,
+195,1,136,186,144,158,1,177,186,94,116,254,188,254,98,254,30,254,56,226,134,
+254,248,73,29,86,1,30,98,1,41,1,180,1,158,239,199,154,2,156,1,136,83,254,
+243,254,35,197,149,158,254,138,122,121,82,228,217,166,76,16,9,144,16,20,76,
+136,148,0,1,255,176,252,255,7,156,4,74,0,29,0,0,5,38,0,1,55,18,0,23,51,21,
+22,0,23,7,39,39,38,44,2,35,34,38,53,52,54,51,32,4,5,4,77,234,254,12,254,255,
+143,199,1,141,178,143,175,1,167,180,94,73,245,201,254,176,254,150,254,106,
+231,33,47,47,33,1,56,1,228,1,44,118,200,2,62,1,103,83,254,237,254,33,189,
+147,175,254,149,118,121,51,173,142,193,136,74,41,36,36,42,117,163,0,0,1,255,
+176,252,255,7,156,4,74,0,25,0,0,5,38,0,1,55,8,2,23,7,39,39,38,44,2,35,34,
+38,53,52,54,51,32,4,5,4,77,234,254,12,254,255,143,1,17,2,72,2,96,230,94,73,
+245,201,254,176,254,150,254,106,231,33,47,47,33,1,56,1,228,1,44,118,200,2,
+62,1,103,83,254,137,253,94,253,222,151,121,51,173,142,193,136,74,41,36,36,
+42,117,163,0,255,255,0,100,252,255,10,152,4,74,18,38,0,18,0,0,16,7,1,30,3,
+169,1,40,255,255,0,100,252,255,10,152,4,74,18,38,0,19,0,0,16,7,1,30,3,169,
+1,40,255,255,255,176,252,255,7,156,4,74,18,38,0,20,0,0,16,7,1,30,0,171,1,
+40,255,255,255,176,252,255,7,156,4,74,18,38,0,21,0,0,16,7,1,30,0,171,1,40,
+255,255,0,90,255,220,3,196,3,104,16,39,1,30,1,166,0,208,16,6,0,28,0,0,255,
+255,0,90,255,220,4,64,3,104,16,39,1,30,1,166,0,208,16,6,0,29,0,0,0,1,0,90,
+255,220,3,196,3,104,0,10,0,0,19,33,50,22,18,23,35,38,2,39,33,90,2,73,137,
+55,77,20,148,18,76,24,253,160,3,104,205,254,11,202,169,2,3,74,0,1,0,90,255,
+220,4,64,3,104,0,21,0,0,19,33,50,22,19,23,22,22,51,51,21,35,34,38,39,35,23,
+35,38,2,39,33,90,2,73,131,61,44,22,6,68,56,25,8,37,62,19,8,8,146,18,76,24,
+253,160,3,104,190,254,210,152,38,35,155,18,19,73,169,2,3,74,0,0,1,0,140,255,
+240,6,228,3,127,0,44,0,0,37,19,38,38,35,34,6,21,20,22,23,7,38,38,53,52,36,
+51,50,22,51,50,54,51,50,22,21,20,6,35,39,34,39,55,51,50,54,53,52,38,35,34,
+6,7,3,2,215,211,46,128,81,204,189,115,135,67,172,161,1,12,231,101,211,69,
+95,152,62,216,219,204,193,20,15,15,5,21,136,134,135,161,66,113,43,223,10,
+2,202,10,13,155,149,117,154,55,133,65,232,180,201,233,23,20,244,248,204,196,
+1,3,151,101,150,178,158,12,7,253,32,0,0,1,0,140,255,240,7,137,3,127,0,57,
+0,0,33,34,38,39,35,6,6,35,39,34,39,55,51,50,54,53,52,38,35,34,6,7,3,39,19,
+38,38,35,34,6,21,20,22,23,7,38,38,53,52,36,51,50,22,51,50,54,51,50,22,21,
+20,6,7,22,22,51,51,21,7,119,86,118,48,10,45,136,101,20,15,15,5,21,136,134,
+135,161,66,113,43,223,145,211,46,128,81,204,189,115,135,67,172,161,1,12,231,
+101,211,69,95,152,62,216,219,13,18,11,82,85,18,33,56,39,50,1,3,151,101,150,
+178,158,12,7,253,32,23,2,202,10,13,155,149,117,154,55,133,65,232,180,201,
+233,23,20,244,248,45,99,48,27,26,155,0,1,0,140,255,237,4,92,3,124,0,27,0,
+0,5,39,38,2,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,0,51,50,
+18,19,3,200,19,29,81,117,114,137,181,161,148,50,77,43,42,51,114,66,205,235,
+1,18,188,237,197,80,18,117,181,1,81,125,201,138,133,138,7,12,133,22,15,223,
+196,193,1,43,254,170,253,200,0,1,0,140,255,237,4,201,3,124,0,38,0,0,5,39,
+38,2,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,0,51,50,22,23,
+23,30,2,51,21,34,38,39,35,23,3,200,19,29,81,117,114,137,181,161,148,50,77,
+43,42,51,114,66,205,235,1,18,188,174,195,56,25,21,9,87,56,42,52,21,8,9,18,
+117,181,1,81,125,201,138,133,138,7,12,133,22,15,223,196,193,1,43,180,241,
+113,94,69,40,155,24,24,66,0,1,0,140,255,180,1,173,3,104,0,10,0,0,1,23,19,
+22,18,23,35,38,2,39,39,1,32,23,52,18,39,9,148,17,68,35,21,3,104,126,254,191,
+115,254,223,97,156,1,198,201,119,0,0,1,0,140,255,170,2,55,3,104,0,20,0,0,
+1,23,23,18,22,51,51,21,35,34,38,39,35,22,22,23,35,38,2,39,39,1,32,23,26,46,
+17,122,45,28,37,62,19,9,5,6,2,143,18,76,27,21,3,104,130,158,254,234,151,155,
+18,19,32,62,29,170,1,239,156,119,0,1,0,100,0,0,5,16,2,200,0,44,0,0,55,55,
+22,22,51,50,54,55,38,38,53,52,54,51,50,22,22,21,22,22,51,50,54,55,38,38,53,
+52,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,100,92,40,131,91,82,114,
+16,33,41,49,36,44,38,39,29,111,69,67,81,13,32,48,48,31,46,40,43,162,132,79,
+142,40,35,143,114,121,197,182,88,57,58,50,47,82,214,75,48,38,104,242,77,63,
+68,43,45,99,231,62,42,35,96,205,104,141,166,72,56,55,73,105,0,1,0,100,0,0,
+5,209,2,200,0,53,0,0,55,55,22,22,51,50,54,55,38,38,53,52,54,51,50,22,22,21,
+22,22,51,50,54,55,38,38,53,52,54,51,50,22,22,21,20,7,22,22,51,21,34,38,39,
+6,6,35,34,38,39,6,6,35,34,38,100,92,40,131,91,78,116,17,32,43,49,36,44,38,
+39,29,111,69,57,88,15,32,47,48,31,46,40,43,1,18,109,69,87,125,39,39,122,77,
+81,140,39,35,143,113,121,197,182,88,57,58,49,46,79,224,70,48,38,104,242,77,
+63,68,36,47,82,241,74,42,35,96,205,110,11,6,56,73,155,64,48,54,58,72,55,55,
+72,105,0,1,255,176,0,0,4,83,2,200,0,54,0,0,37,38,38,53,52,54,51,50,22,22,
+21,22,22,51,50,54,55,38,38,53,52,54,51,50,22,22,21,20,7,22,22,51,21,34,38,
+39,6,6,35,34,38,39,6,6,35,35,34,38,53,52,54,51,51,50,54,1,27,33,42,49,36,
+44,38,39,29,111,69,57,88,15,32,47,48,31,46,40,43,1,18,109,69,87,125,39,39,
+122,77,79,141,39,49,160,115,35,33,47,47,33,52,85,128,251,82,220,70,48,38,
+104,242,77,63,68,36,47,82,241,74,42,35,96,205,110,11,6,56,73,155,64,48,54,
+58,70,55,63,62,41,36,36,42,49,0,1,255,176,0,0,3,144,2,200,0,45,0,0,37,38,
+38,53,52,54,51,50,22,22,21,22,22,51,50,54,55,38,38,53,52,54,51,50,22,22,21,
+20,6,35,34,38,39,6,6,35,35,34,38,53,52,54,51,51,50,54,1,27,33,42,49,36,44,
+38,39,29,111,69,67,81,13,32,48,48,31,46,40,43,162,132,79,141,39,49,160,115,
+35,33,47,47,33,52,85,128,251,82,220,70,48,38,104,242,77,63,68,43,45,99,231,
+62,42,35,96,205,104,141,166,70,55,63,62,41,36,36,42,49,0,2,0,100,253,45,7,
+153,5,195,0,24,0,33,0,0,33,34,38,39,55,22,22,51,33,1,55,1,33,50,22,21,20,
+2,2,6,35,34,38,39,3,1,54,18,55,33,19,22,22,23,1,216,150,180,42,107,49,140,
+152,1,247,254,20,146,2,1,2,100,53,62,110,191,90,56,68,95,44,193,1,168,62,
+195,16,253,238,173,16,46,14,80,94,94,70,43,4,241,55,250,216,46,44,94,254,
+192,254,204,66,124,112,1,231,253,196,62,1,147,107,254,74,41,88,5,0,2,0,100,
+253,45,7,153,5,195,0,24,0,33,0,0,33,34,38,39,55,22,22,51,33,1,55,1,33,50,
+22,21,20,2,2,6,35,34,38,39,3,1,54,18,55,33,19,22,22,23,1,216,150,180,42,107,
+49,140,152,1,247,254,20,146,2,1,2,159,38,18,110,191,90,56,68,95,44,193,1,
+168,62,195,16,253,238,173,16,46,14,80,94,94,70,43,4,241,55,250,216,35,55,
+94,254,192,254,204,66,124,112,1,231,253,196,62,1,147,107,254,74,41,88,5,0,
+2,255,176,253,45,5,28,5,195,0,23,0,32,0,0,19,1,33,50,22,21,20,2,2,6,35,34,
+38,39,3,33,34,38,53,52,54,51,33,1,1,54,18,55,33,19,22,22,23,68,2,1,2,159,
+38,18,110,191,90,56,68,95,44,193,254,51,33,47,47,33,1,158,254,20,3,195,62,
+195,16,253,238,173,16,46,14,5,195,250,216,34,56,94,254,192,254,204,66,124,
+112,1,231,41,36,36,42,4,241,248,56,62,1,147,107,254,74,41,88,5,0,2,255,176,
+253,45,5,28,5,195,0,23,0,32,0,0,19,1,33,50,22,21,20,2,2,6,35,34,38,39,3,33,
+34,38,53,52,54,51,33,1,1,54,18,55,33,19,22,22,23,68,2,1,2,100,53,62,110,191,
+90,56,68,95,44,193,254,51,33,47,47,33,1,158,254,20,3,195,62,195,16,253,238,
+173,16,46,14,5,195,250,216,46,44,94,254,192,254,204,66,124,112,1,231,41,36,
+36,42,4,241,248,56,62,1,147,107,254,74,41,88,5,255,255,0,100,253,45,7,153,
+5,195,16,39,1,33,4,4,0,67,16,6,0,40,0,0,255,255,0,100,253,45,7,153,5,195,
+18,38,0,41,0,0,16,7,1,33,4,4,0,67,255,255,255,176,253,45,5,28,5,195,16,39,
+1,33,1,135,0,67,16,6,0,42,0,0,255,255,255,176,253,45,5,28,5,195,18,38,0,43,
+0,0,16,7,1,33,1,135,0,67,0,1,0,120,254,225,1,142,1,187,0,18,0,0,18,38,53,
+52,54,54,52,38,38,53,52,54,51,50,22,21,20,6,35,174,46,82,57,62,85,51,31,66,
+130,134,60,254,225,43,32,38,100,110,49,132,112,37,32,45,247,128,127,228,0,
+1,0,120,254,225,2,15,1,187,0,25,0,0,5,6,6,35,34,38,53,52,54,54,52,38,38,53,
+52,54,51,50,22,23,22,22,51,21,35,34,1,136,18,118,52,30,46,82,57,62,85,51,
+31,54,112,21,37,73,28,63,36,2,107,178,43,32,38,100,110,49,132,112,37,32,45,
+176,107,3,2,155,0,1,255,176,0,0,2,122,2,52,0,32,0,0,37,7,22,22,51,21,34,38,
+39,6,6,35,35,34,38,53,52,54,51,51,50,54,55,38,38,53,52,54,51,50,22,22,21,
+1,171,2,11,99,99,112,133,34,41,149,105,60,33,47,47,33,60,95,112,20,23,32,
+53,34,45,40,23,225,20,24,26,155,42,40,37,45,41,36,36,42,23,22,54,172,61,36,
+41,85,159,75,0,1,255,176,0,0,1,173,2,52,0,23,0,0,37,38,38,53,52,54,51,50,
+22,22,21,20,6,35,35,34,38,53,52,54,51,51,50,54,1,32,23,39,50,37,44,41,31,
+170,199,60,33,47,47,33,60,119,102,203,52,170,54,43,42,83,131,67,141,142,41,
+36,36,42,23,0,255,255,0,140,254,81,9,54,6,115,16,38,0,31,0,0,16,39,0,51,7,
+137,0,0,16,39,1,30,3,117,4,105,16,39,1,30,4,163,4,105,16,39,1,30,4,12,5,134,
+16,7,1,30,3,159,254,75,0,1,0,140,253,22,7,153,3,34,0,34,0,0,36,54,18,54,51,
+50,22,18,18,19,7,10,2,38,35,34,6,2,6,6,35,34,0,53,52,54,55,23,6,6,21,20,18,
+51,2,204,80,38,147,131,115,163,169,228,158,139,171,228,167,85,48,68,70,34,
+69,139,115,211,254,251,23,24,133,13,17,177,139,113,147,1,73,180,167,254,200,
+253,225,254,60,41,1,220,2,10,1,41,65,106,254,232,172,98,1,98,255,54,139,42,
+52,27,99,50,197,254,248,0,0,1,0,140,253,22,7,153,3,34,0,39,0,0,36,54,18,54,
+51,50,22,18,23,51,21,35,22,18,23,7,10,2,38,35,34,6,2,6,6,35,34,0,53,52,54,
+55,23,6,6,21,20,18,51,2,204,80,38,147,131,110,152,151,89,200,134,58,132,75,
+139,171,228,167,85,48,68,70,34,69,139,115,211,254,251,23,24,133,13,17,177,
+139,113,147,1,73,180,147,254,248,203,155,141,254,164,216,41,1,220,2,10,1,
+41,65,106,254,232,172,98,1,98,255,54,139,42,52,27,99,50,197,254,248,0,1,255,
+176,0,0,5,37,3,109,0,28,0,0,53,33,39,39,38,38,35,34,6,7,39,54,54,51,50,22,
+23,23,22,22,23,51,21,33,34,38,53,52,54,4,50,59,61,150,223,125,45,112,54,92,
+79,160,85,156,243,155,51,51,96,22,66,250,219,33,47,47,155,91,90,221,165,46,
+51,96,86,70,161,220,73,76,149,43,155,41,36,36,42,0,0,1,255,176,0,0,4,234,
+3,109,0,30,0,0,19,54,54,51,50,22,23,23,30,2,21,20,6,35,33,34,38,53,52,54,
+51,33,39,39,38,38,35,34,6,7,153,79,160,85,156,243,155,47,50,104,26,47,46,
+251,115,33,47,47,33,4,50,59,61,150,223,125,45,112,54,2,209,86,70,161,220,
+68,73,164,46,28,56,61,41,36,36,42,91,90,221,165,46,51,0,1,0,100,0,0,4,188,
+6,6,0,24,0,0,1,22,0,18,22,21,20,6,35,33,34,38,39,55,22,22,51,33,38,2,3,39,
+38,38,39,2,216,40,1,42,128,18,50,49,253,127,150,180,42,107,49,140,152,2,1,
+29,193,101,69,20,53,15,6,6,90,252,210,254,117,79,43,53,68,80,94,94,70,43,
+103,2,37,1,15,183,53,136,34,0,0,1,0,99,0,0,5,55,6,6,0,40,0,0,1,22,22,51,21,
+34,38,39,35,6,6,35,33,34,38,39,55,22,22,51,33,50,54,55,38,39,3,39,39,3,38,
+39,55,22,22,23,19,23,23,22,23,4,148,30,85,48,72,112,36,8,38,154,112,254,180,
+150,180,42,107,49,140,152,1,22,78,119,19,23,31,138,74,71,110,20,9,147,11,
+44,16,127,72,71,34,31,1,63,84,80,155,55,51,47,59,80,94,94,70,43,45,45,63,
+83,1,110,194,183,1,24,50,20,58,26,110,42,254,179,192,191,94,84,0,1,255,176,
+0,0,2,180,6,6,0,40,0,0,1,22,22,51,21,34,38,39,35,6,6,35,35,34,38,53,52,54,
+51,51,50,54,55,38,39,39,38,2,39,3,38,39,55,22,22,23,19,23,23,22,23,2,17,30,
+85,48,72,112,36,8,38,154,112,160,33,47,47,33,182,78,119,19,23,31,65,23,156,
+39,110,20,9,147,11,44,16,127,72,71,34,31,1,63,84,80,155,55,51,47,59,41,36,
+36,42,45,45,63,83,175,62,1,148,102,1,24,50,20,58,26,110,42,254,179,192,191,
+94,84,0,1,255,176,0,0,2,56,6,6,0,23,0,0,49,34,38,53,52,54,51,33,38,2,3,39,
+38,38,39,55,22,0,18,22,21,20,6,35,33,47,47,33,1,161,29,193,101,69,20,53,15,
+147,40,1,42,128,18,50,49,41,36,36,42,103,2,37,1,15,183,53,136,34,58,90,252,
+210,254,117,79,43,53,68,0,2,0,120,254,133,6,136,3,205,0,35,0,52,0,0,33,35,
+34,38,39,7,6,2,7,39,54,18,55,55,54,54,55,55,38,36,39,55,22,4,51,50,54,55,
+55,54,51,50,22,17,20,6,1,6,6,21,20,22,22,51,51,50,54,53,52,38,35,34,6,5,20,
+62,120,176,27,7,31,186,139,90,180,160,23,6,3,4,3,6,203,254,71,83,54,156,1,
+111,182,47,118,57,105,48,26,201,191,181,254,11,6,9,46,118,113,90,95,85,101,
+131,63,146,111,88,1,148,254,215,132,91,194,1,75,207,63,33,68,33,61,3,91,46,
+131,59,64,7,5,8,4,216,254,227,200,173,2,190,31,109,30,155,125,97,98,119,200,
+152,16,0,0,2,0,120,254,133,7,39,3,205,0,46,0,63,0,0,33,34,38,39,7,6,2,7,39,
+54,18,55,55,54,54,55,55,38,36,39,55,22,4,51,50,54,55,55,54,51,50,22,17,20,
+6,7,22,22,51,21,34,38,39,35,6,6,35,1,6,6,21,20,22,22,51,51,50,54,53,52,38,
+35,34,6,4,214,120,176,27,7,31,186,139,90,180,160,23,6,3,4,3,6,203,254,71,
+83,54,156,1,111,182,47,118,57,105,48,26,201,191,9,11,9,76,94,91,115,44,10,
+42,132,97,254,202,6,9,46,118,113,90,95,85,101,131,63,146,111,88,1,148,254,
+215,132,91,194,1,75,207,63,33,68,33,61,3,91,46,131,59,64,7,5,8,4,216,254,
+227,46,81,34,28,29,155,32,54,45,41,2,190,31,109,30,155,125,97,98,119,200,
+152,16,0,1,255,176,255,228,7,44,3,194,0,64,0,0,49,34,38,53,52,54,51,33,50,
+54,54,55,7,6,35,34,36,39,55,22,4,51,50,54,55,55,54,51,50,22,17,20,6,7,20,
+22,51,21,34,38,39,35,6,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,
+2,2,4,35,33,47,47,33,1,113,155,212,141,51,85,47,38,215,254,181,82,60,155,
+1,13,183,75,134,58,110,51,45,196,202,7,5,81,99,95,112,39,8,44,128,91,85,185,
+67,66,75,141,60,98,96,130,108,62,98,43,56,181,254,229,204,41,36,36,42,99,
+216,227,4,2,79,61,131,75,46,11,7,12,5,231,254,232,31,66,38,37,38,155,37,41,
+51,55,71,51,115,43,50,120,106,246,138,10,8,254,223,254,227,134,0,1,255,176,
+255,228,6,132,3,194,0,53,0,0,49,34,38,53,52,54,51,33,50,54,54,55,7,6,35,34,
+36,39,55,22,4,51,50,54,55,55,54,51,50,22,17,20,6,35,34,38,39,55,22,22,51,
+50,54,53,52,38,35,34,6,7,2,2,4,35,33,47,47,33,1,113,155,212,141,51,85,47,
+38,215,254,181,82,60,155,1,13,183,75,134,58,110,51,45,196,202,183,166,85,
+185,67,66,75,141,60,98,96,130,108,60,98,45,56,183,254,228,201,41,36,36,42,
+99,216,227,4,2,79,61,131,75,46,11,7,12,5,231,254,232,190,203,71,51,115,43,
+50,120,106,246,138,11,8,254,222,254,226,131,0,1,0,120,253,178,8,208,0,226,
+0,19,0,0,54,54,51,50,22,23,23,22,4,23,5,4,4,5,7,36,0,36,38,53,120,50,32,26,
+122,71,65,65,1,29,58,1,10,1,80,1,192,1,56,40,254,1,250,247,255,0,40,177,49,
+47,34,31,31,113,18,89,113,126,81,133,120,1,154,106,60,28,0,1,0,126,252,175,
+3,11,0,200,0,20,0,0,54,23,23,22,22,51,21,34,38,39,7,22,0,23,7,2,0,53,52,54,
+51,240,19,28,92,126,65,76,168,48,6,53,1,61,137,120,222,254,201,57,46,200,
+4,6,22,13,155,33,19,6,145,254,21,173,86,1,22,2,1,130,60,68,0,1,255,176,0,
+0,2,95,3,104,0,32,0,0,1,22,23,23,30,2,51,21,34,38,39,35,6,6,35,35,34,38,53,
+52,54,51,51,50,54,55,38,39,39,38,38,39,1,77,14,12,24,28,49,94,53,72,118,32,
+9,45,150,121,60,33,47,47,33,62,102,126,22,11,7,13,26,45,25,3,104,78,64,123,
+150,205,97,155,58,48,46,60,41,36,36,42,45,45,35,32,53,115,224,146,0,1,255,
+176,0,0,1,200,3,104,0,19,0,0,1,22,18,21,20,6,33,34,38,53,52,54,51,51,50,54,
+55,52,2,39,1,80,52,68,128,254,214,63,47,47,33,60,70,156,27,79,48,3,104,209,
+254,133,83,93,108,41,36,36,42,11,9,61,1,168,187,0,0,3,0,140,0,0,6,139,3,133,
+0,20,0,31,0,44,0,0,1,54,54,51,50,22,21,20,6,6,35,33,34,38,53,52,54,51,50,
+22,23,3,39,38,38,35,34,6,21,20,22,51,37,20,23,51,50,54,53,52,38,35,34,6,21,
+3,173,50,194,128,155,207,113,234,232,254,44,241,247,227,170,139,209,48,76,
+10,10,161,137,111,138,174,158,1,119,4,175,201,148,123,105,122,179,2,103,127,
+136,252,201,164,182,79,225,228,200,248,147,139,254,52,192,192,212,161,136,
+146,153,130,50,80,121,146,139,167,205,160,0,3,0,140,0,0,7,32,3,133,0,30,0,
+41,0,54,0,0,1,54,54,51,50,22,21,20,6,7,22,22,51,21,34,38,39,35,6,6,35,33,
+34,38,53,52,54,51,50,22,23,3,39,38,38,35,34,6,21,20,22,51,37,20,23,51,50,
+54,53,52,38,35,34,6,21,3,173,50,194,128,155,207,23,23,21,101,73,111,137,43,
+11,74,214,138,254,44,241,247,227,170,139,209,48,76,10,10,161,137,111,138,
+174,158,1,119,4,175,201,148,123,105,122,179,2,103,127,136,252,201,75,115,
+45,17,18,155,37,40,47,30,225,228,200,248,147,139,254,52,192,192,212,161,136,
+146,153,130,50,80,121,146,139,167,205,160,0,3,255,176,0,0,7,42,3,133,0,40,
+0,51,0,64,0,0,1,54,54,51,50,22,21,20,6,7,22,22,51,21,34,38,39,35,6,6,35,33,
+34,38,53,52,54,51,51,50,23,53,38,38,53,52,54,51,50,22,23,3,39,38,38,35,34,
+6,21,20,22,51,37,20,23,51,50,54,53,52,38,35,34,6,21,3,182,50,194,128,155,
+207,23,23,22,101,73,111,138,43,11,74,215,137,251,175,33,47,47,33,213,32,32,
+66,62,228,169,139,209,48,76,10,10,161,137,110,139,163,136,1,152,4,175,201,
+148,123,105,122,179,2,103,127,136,252,201,75,115,45,17,18,155,37,40,47,30,
+41,36,36,42,3,7,53,171,110,179,229,147,139,254,52,192,192,212,140,117,160,
+179,130,50,80,121,146,139,167,205,160,0,3,255,176,0,0,6,148,3,133,0,30,0,
+41,0,54,0,0,1,54,54,51,50,22,21,20,6,6,33,33,34,38,53,52,54,51,51,50,23,53,
+38,38,53,52,54,51,50,22,23,3,39,38,38,35,34,6,21,20,22,51,37,20,23,51,50,
+54,53,52,38,35,34,6,21,3,182,50,194,128,155,207,97,224,254,254,251,175,33,
+47,47,33,213,32,32,66,62,228,169,139,209,48,76,10,10,161,137,110,139,163,
+136,1,152,4,175,201,148,123,105,122,179,2,103,127,136,252,201,150,180,95,
+41,36,36,42,3,7,53,171,110,179,229,147,139,254,52,192,192,212,140,117,160,
+179,130,50,80,121,146,139,167,205,160,0,255,255,0,140,0,0,6,139,3,133,18,
+6,0,69,0,0,255,255,0,140,0,0,7,32,3,133,18,6,0,70,0,0,255,255,255,176,0,0,
+7,42,3,133,18,6,0,71,0,0,255,255,255,176,0,0,6,148,3,133,18,6,0,72,0,0,0,
+1,0,100,0,0,7,59,3,107,0,23,0,0,33,34,38,39,55,22,22,51,33,31,2,53,38,0,39,
+55,22,0,4,22,51,51,21,1,216,150,180,42,107,49,140,152,1,163,79,116,81,170,
+254,194,127,131,75,1,21,1,20,218,172,74,80,94,94,70,43,1,3,3,11,112,1,69,
+188,91,112,254,196,217,75,155,0,1,0,100,0,0,5,242,3,107,0,20,0,0,33,34,38,
+39,55,22,22,51,33,31,2,53,38,0,39,55,22,0,51,21,1,216,150,180,42,107,49,140,
+152,1,143,79,116,81,128,254,124,83,131,143,2,2,110,80,94,94,70,43,1,3,3,11,
+83,1,164,122,91,202,253,250,155,0,0,1,255,176,0,0,3,255,3,107,0,19,0,0,49,
+34,38,53,52,54,51,33,31,2,53,38,0,39,55,22,0,51,21,33,47,47,33,1,192,79,116,
+81,123,254,119,83,131,143,2,2,110,41,36,36,42,1,3,3,11,78,1,168,123,91,202,
+253,250,155,0,1,255,176,0,0,5,72,3,107,0,22,0,0,37,31,2,53,38,0,39,55,22,
+0,4,22,51,51,21,33,34,38,53,52,54,51,1,212,79,116,81,170,254,194,127,131,
+75,1,21,1,20,218,172,74,250,184,33,47,47,33,155,1,3,3,11,112,1,69,188,91,
+112,254,196,217,75,155,41,36,36,42,0,2,0,100,0,0,6,71,4,107,0,30,0,43,0,0,
+33,34,38,39,55,22,22,51,33,38,38,39,6,6,35,34,38,53,52,54,51,50,22,23,23,
+22,18,21,20,6,35,3,39,46,2,35,34,6,21,20,22,51,50,1,216,150,180,42,107,49,
+140,152,3,149,4,52,34,84,169,77,220,197,229,145,163,175,79,44,46,98,80,70,
+131,33,54,75,83,82,84,137,135,137,160,80,94,94,70,43,39,173,96,28,22,152,
+157,167,242,174,193,110,119,254,209,60,83,89,2,83,84,133,112,52,149,91,97,
+77,0,2,0,100,0,0,6,197,4,107,0,36,0,48,0,0,37,21,34,38,39,35,6,6,35,33,34,
+38,39,55,22,22,51,33,50,54,55,38,39,39,6,6,35,34,38,53,52,54,51,50,22,18,
+22,1,46,2,35,34,6,21,20,22,51,50,6,197,63,102,37,8,40,156,116,253,29,150,
+180,42,107,49,140,152,2,173,76,126,22,18,21,44,85,169,77,220,197,229,145,
+180,188,197,92,254,179,54,82,95,96,84,137,135,137,160,155,155,47,55,45,57,
+80,94,94,70,43,42,44,47,57,118,28,22,152,157,167,242,218,253,218,208,1,184,
+142,162,77,149,91,97,77,0,0,2,255,176,0,0,4,245,4,107,0,35,0,47,0,0,37,21,
+34,38,39,35,6,6,35,33,34,38,53,52,54,51,33,50,54,55,38,39,39,6,6,35,34,38,
+53,52,54,51,50,22,18,22,1,46,2,35,34,6,21,20,22,51,50,4,245,63,102,37,8,40,
+156,116,253,21,33,47,47,33,3,1,76,126,22,18,21,44,85,169,77,220,197,229,145,
+180,188,197,92,254,179,54,82,95,96,84,137,135,137,160,155,155,47,55,45,57,
+41,36,36,42,42,44,47,57,118,28,22,152,157,167,242,218,253,218,208,1,184,142,
+162,77,149,91,97,77,0,2,255,176,0,0,4,117,4,107,0,30,0,43,0,0,49,34,38,53,
+52,54,51,33,38,38,39,6,6,35,34,38,53,52,54,51,50,22,23,23,35,22,18,21,20,
+6,35,3,39,46,2,35,34,6,21,20,22,51,50,33,47,47,33,3,231,4,52,34,84,169,77,
+220,197,229,145,163,175,79,44,1,47,98,80,70,131,33,54,75,83,82,84,137,135,
+137,160,41,36,36,42,39,173,96,28,22,152,157,167,242,174,193,110,119,254,209,
+60,83,89,2,83,84,133,112,52,149,91,97,77,0,0,3,0,120,0,0,6,16,5,78,0,44,0,
+56,0,68,0,0,33,33,34,38,39,55,22,22,51,51,50,23,53,38,38,53,52,54,51,50,22,
+21,20,6,35,34,38,53,55,22,22,51,50,54,53,52,38,35,34,6,21,20,4,33,51,0,22,
+21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,6,16,251,
+239,159,200,32,92,54,156,135,146,32,32,106,121,251,189,176,237,145,134,120,
+143,122,8,75,52,69,72,147,116,123,171,1,102,1,105,141,253,48,55,56,50,44,
+57,53,48,1,173,55,56,50,44,57,53,48,86,74,123,77,51,3,8,50,226,144,187,250,
+196,147,137,150,139,114,14,69,63,83,66,90,106,156,123,212,221,4,179,59,57,
+56,59,53,62,57,59,59,57,56,59,53,62,57,59,0,0,3,0,120,0,0,6,17,5,78,0,44,
+0,56,0,68,0,0,33,33,34,38,39,55,22,22,51,51,50,23,53,38,38,53,52,54,51,50,
+22,21,20,6,35,34,38,53,55,22,22,51,50,54,53,52,38,35,34,6,21,20,4,33,51,0,
+22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,6,17,251,
+238,159,200,32,92,54,156,135,146,32,32,106,121,251,189,176,237,145,134,120,
+143,122,8,75,52,69,72,147,116,123,171,1,102,1,105,142,253,47,55,56,50,44,
+57,53,48,1,173,55,56,50,44,57,53,48,86,74,123,77,51,3,8,50,226,144,187,250,
+196,147,137,150,139,114,14,69,63,83,66,90,106,156,123,212,221,4,179,59,57,
+56,59,53,62,57,59,59,57,56,59,53,62,57,59,0,0,3,255,176,0,0,4,166,5,78,0,
+43,0,55,0,67,0,0,33,33,34,38,53,52,54,51,33,50,23,53,38,38,53,52,54,51,50,
+22,21,20,6,35,34,38,53,55,22,22,51,50,54,53,52,38,35,34,6,21,20,4,33,51,0,
+22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,4,166,
+251,90,33,47,47,33,1,85,32,32,106,121,251,189,176,237,145,134,120,143,122,
+8,75,52,69,72,147,116,123,171,1,102,1,105,141,253,48,55,56,50,44,57,53,48,
+1,173,55,56,50,44,57,53,48,41,36,36,42,3,8,50,226,144,187,250,196,147,137,
+150,139,114,14,69,63,83,66,90,106,156,123,212,221,4,179,59,57,56,59,53,62,
+57,59,59,57,56,59,53,62,57,59,0,0,3,255,176,0,0,4,166,5,78,0,43,0,55,0,67,
+0,0,33,33,34,38,53,52,54,51,33,50,23,53,38,38,53,52,54,51,50,22,21,20,6,35,
+34,38,53,55,22,22,51,50,54,53,52,38,35,34,6,21,20,4,33,51,0,22,21,20,6,35,
+34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,4,166,251,90,33,47,47,
+33,1,85,32,32,106,121,251,189,176,237,145,134,120,143,122,8,75,52,69,72,147,
+116,123,171,1,102,1,105,141,253,48,55,56,50,44,57,53,48,1,173,55,56,50,44,
+57,53,48,41,36,36,42,3,8,50,226,144,187,250,196,147,137,150,139,114,14,69,
+63,83,66,90,106,156,123,212,221,4,179,59,57,56,59,53,62,57,59,59,57,56,59,
+53,62,57,59,0,0,1,254,112,252,244,4,79,0,245,0,50,0,0,37,39,38,35,34,6,21,
+20,22,4,22,21,20,6,4,33,39,34,38,39,39,38,38,39,55,22,4,51,32,54,54,53,52,
+36,36,38,53,52,54,51,50,22,51,50,55,51,6,6,35,34,38,2,99,78,36,33,45,62,133,
+1,149,184,151,254,218,254,253,78,56,127,63,149,70,151,81,13,207,1,90,172,
+1,54,217,64,254,185,254,255,138,156,107,86,189,83,111,24,140,5,154,121,65,
+106,46,32,14,52,44,59,88,118,131,106,127,103,44,1,3,3,5,3,8,6,142,7,8,28,
+49,42,59,102,90,142,109,104,144,90,79,111,123,30,0,1,254,112,252,244,4,115,
+0,245,0,59,0,0,36,6,21,20,22,4,22,21,20,6,4,33,39,34,38,39,39,38,38,39,55,
+22,4,51,32,54,54,53,52,38,47,2,38,38,53,52,54,51,50,22,51,50,54,55,51,22,
+22,51,21,34,38,39,35,6,6,35,34,38,35,1,138,62,141,1,162,188,151,254,218,254,
+253,78,56,127,63,149,70,151,81,13,207,1,90,172,1,54,217,64,102,101,117,145,
+125,157,156,107,89,200,62,56,70,17,115,5,49,31,48,87,31,8,33,99,60,68,220,
+46,92,52,44,57,85,122,131,107,127,103,44,1,3,3,5,3,8,6,142,7,8,28,49,42,35,
+59,31,35,48,41,141,112,104,144,90,37,42,36,43,155,27,41,41,27,92,0,0,2,0,
+100,255,177,6,33,3,104,0,31,0,47,0,0,1,50,22,22,18,21,20,6,35,35,34,38,39,
+6,6,35,34,38,39,55,22,22,51,50,54,55,38,38,53,52,54,51,23,34,6,21,20,22,22,
+51,51,50,54,53,52,38,38,35,4,172,124,137,81,31,180,190,244,70,108,41,50,161,
+113,106,175,31,92,48,112,75,76,96,33,47,43,125,112,43,72,59,56,117,135,242,
+96,85,29,77,113,3,104,51,129,254,225,57,180,168,31,29,68,71,105,77,88,68,
+58,59,48,62,200,189,111,138,150,67,81,150,183,86,92,89,86,224,76,0,0,2,0,
+100,255,177,6,194,3,104,0,42,0,58,0,0,1,50,22,22,18,21,20,7,22,22,51,21,34,
+38,39,35,6,6,35,35,34,38,39,35,6,6,35,34,38,39,55,22,22,51,50,54,55,38,38,
+53,52,54,51,23,34,6,21,20,22,22,51,51,50,54,53,52,38,38,35,4,172,124,137,
+81,31,18,10,78,91,91,115,44,11,51,124,95,244,71,110,32,8,55,161,106,106,175,
+31,92,48,112,75,75,102,33,54,41,125,112,43,72,59,56,117,135,242,96,85,29,
+77,113,3,104,51,129,254,225,57,79,58,29,27,155,32,54,51,35,31,31,75,66,105,
+77,88,68,58,55,45,69,209,180,111,138,150,67,81,150,183,86,92,89,86,224,76,
+0,0,2,255,176,0,0,5,103,3,104,0,42,0,58,0,0,1,50,22,18,21,20,7,22,22,51,21,
+34,38,39,35,6,6,35,35,34,38,39,35,6,6,35,35,34,38,53,52,54,51,51,50,54,55,
+38,38,53,52,54,51,23,34,6,21,20,22,22,51,51,50,54,53,52,38,38,35,3,81,155,
+155,63,18,10,78,91,91,115,44,11,48,123,99,244,92,120,44,9,27,133,112,71,33,
+47,47,33,93,81,77,9,38,27,125,112,43,72,59,56,117,135,242,96,85,29,77,113,
+3,104,97,254,239,154,77,60,29,27,155,32,54,48,38,48,51,51,48,41,36,36,42,
+28,28,70,198,144,111,138,150,67,81,150,183,86,92,89,86,224,76,0,0,2,255,176,
+0,0,4,198,3,104,0,32,0,48,0,0,1,50,22,18,21,20,6,35,35,34,38,39,35,6,6,35,
+35,34,38,53,52,54,51,51,50,54,55,38,38,53,52,54,51,23,34,6,21,20,22,22,51,
+51,50,54,53,52,38,38,35,3,81,155,155,63,180,190,244,92,120,44,9,27,133,112,
+71,33,47,47,33,93,81,77,9,38,27,125,112,43,72,59,56,117,135,242,96,85,29,
+77,113,3,104,97,254,239,154,181,167,48,51,51,48,41,36,36,42,28,28,70,198,
+144,111,138,150,67,81,150,183,86,92,89,86,224,76,0,255,255,0,90,255,220,3,
+196,4,224,16,39,1,30,1,197,3,243,16,6,0,28,0,0,255,255,0,90,255,220,4,64,
+4,224,16,39,1,30,1,197,3,243,16,6,0,29,0,0,0,1,0,100,0,0,7,44,3,109,0,58,
+0,0,37,6,6,35,35,34,38,39,55,22,22,51,51,50,54,53,52,46,3,53,52,54,51,50,
+23,23,22,22,51,50,54,55,55,54,51,50,22,21,20,14,2,21,20,22,51,50,54,55,23,
+6,6,35,35,34,38,39,3,219,40,182,126,167,150,180,42,107,49,140,152,123,116,
+127,28,90,129,127,45,36,23,33,84,48,115,58,58,117,46,85,32,23,36,42,139,148,
+84,158,166,168,141,49,104,39,194,159,89,122,186,52,177,84,93,80,94,94,70,
+43,139,125,65,126,83,22,15,64,37,38,6,18,10,14,22,10,18,6,40,37,66,11,35,
+118,97,156,162,44,65,90,87,87,86,91,0,1,0,100,0,0,6,2,3,109,0,53,0,0,33,34,
+38,39,55,22,22,51,51,50,54,53,52,46,3,53,52,54,51,50,23,23,22,22,51,50,54,
+55,55,54,51,50,22,21,20,14,2,21,20,22,51,51,21,35,34,38,39,35,6,6,35,1,216,
+150,180,42,107,49,140,152,123,116,127,28,90,129,127,45,36,23,33,84,48,115,
+58,58,117,46,85,32,23,36,42,139,148,84,158,153,177,183,122,186,52,8,40,182,
+126,80,94,94,70,43,139,125,65,126,83,22,15,64,37,38,6,18,10,14,22,10,18,6,
+40,37,66,11,35,118,97,156,162,155,86,91,84,93,0,1,255,176,0,0,4,91,3,109,
+0,52,0,0,49,34,38,53,52,54,51,51,50,54,53,52,46,3,53,52,54,51,50,23,23,22,
+22,51,50,54,55,55,54,51,50,22,21,20,14,2,21,20,22,51,51,21,35,34,38,39,35,
+6,6,35,33,47,47,33,248,116,127,28,90,129,127,45,36,23,33,84,48,115,58,58,
+117,46,85,32,23,36,42,139,148,84,158,153,177,183,122,186,52,8,40,182,126,
+41,36,36,42,139,125,65,126,83,22,15,64,37,38,6,18,10,14,22,10,18,6,40,37,
+66,11,35,118,97,156,162,155,86,91,84,93,0,0,1,255,176,0,0,5,133,3,109,0,57,
+0,0,33,34,38,39,35,6,6,35,35,34,38,53,52,54,51,51,50,54,53,52,46,3,53,52,
+54,51,50,23,23,22,22,51,50,54,55,55,54,51,50,22,21,20,14,2,21,20,22,51,50,
+54,55,23,6,6,35,3,164,122,186,52,8,40,182,126,216,33,47,47,33,248,116,127,
+28,90,129,127,45,36,23,33,84,48,115,58,58,117,46,85,32,23,36,42,139,148,84,
+158,166,168,141,49,104,39,194,159,86,91,84,93,41,36,36,42,139,125,65,126,
+83,22,15,64,37,38,6,18,10,14,22,10,18,6,40,37,66,11,35,118,97,156,162,44,
+65,90,87,87,0,2,0,133,255,197,5,130,5,180,0,31,0,44,0,0,1,34,6,7,23,23,22,
+22,21,20,6,35,34,36,53,52,54,54,55,1,55,1,54,54,51,50,22,18,19,35,38,2,5,
+6,6,21,20,22,51,50,54,53,52,38,39,4,14,22,154,96,82,13,11,14,152,151,160,
+254,222,84,162,199,254,226,144,1,24,115,155,39,108,89,125,63,151,55,142,254,
+78,173,173,171,141,84,56,20,18,2,163,53,41,217,38,33,75,26,123,128,126,154,
+77,128,119,105,2,243,55,253,23,53,45,148,254,97,254,252,228,1,186,142,86,
+137,60,71,78,50,48,26,82,47,0,2,0,133,255,197,5,216,5,180,0,38,0,51,0,0,1,
+34,6,7,23,23,22,22,21,20,6,35,34,36,53,52,54,54,55,1,55,1,54,54,51,50,22,
+18,22,51,21,34,38,39,35,23,35,38,2,5,6,6,21,20,22,51,50,54,53,52,38,39,4,
+14,22,154,96,82,13,11,14,152,151,160,254,222,84,162,199,254,226,144,1,24,
+115,155,39,121,89,95,41,125,30,50,18,7,10,142,55,142,254,78,173,173,171,141,
+84,56,20,18,2,163,53,41,217,38,33,75,26,123,128,126,154,77,128,119,105,2,
+243,55,253,23,53,45,193,254,192,145,155,20,17,47,228,1,186,142,86,137,60,
+71,78,50,48,26,82,47,0,1,0,100,0,0,7,29,5,14,0,48,0,0,1,50,22,51,50,54,51,
+50,22,23,23,22,22,21,20,6,35,33,34,38,39,55,22,22,51,33,50,54,53,52,38,38,
+35,34,6,35,34,38,39,39,1,23,7,6,15,4,3,86,28,58,31,119,235,119,160,170,27,
+7,5,8,172,198,252,64,159,200,32,92,54,156,135,3,188,98,82,49,105,105,107,
+219,107,73,182,22,48,1,159,109,102,12,18,38,43,83,30,3,96,2,10,154,155,45,
+43,85,31,193,166,86,74,123,77,51,89,115,98,195,70,10,11,5,102,1,208,91,110,
+13,18,39,43,80,28,0,0,1,0,100,0,0,7,190,5,14,0,59,0,0,0,22,23,23,22,22,21,
+20,6,7,22,22,51,21,34,38,39,35,6,6,35,33,34,38,39,55,22,22,51,33,50,54,53,
+52,38,38,35,34,6,35,34,38,39,39,1,23,7,6,15,4,21,50,22,51,50,54,51,6,68,170,
+27,7,5,8,8,10,9,76,94,91,115,44,10,41,130,100,252,64,159,200,32,92,54,156,
+135,3,188,98,82,49,105,105,107,219,107,73,182,22,48,1,159,109,102,12,18,38,
+43,83,30,28,58,31,119,235,119,3,104,154,155,45,43,85,31,42,73,32,28,29,155,
+32,54,43,43,86,74,123,77,51,89,115,98,195,70,10,11,5,102,1,208,91,110,13,
+18,39,43,80,28,8,2,10,0,1,255,176,0,0,5,235,5,14,0,58,0,0,0,22,23,23,22,22,
+21,20,6,7,22,22,51,21,34,38,39,35,6,6,35,33,34,38,53,52,54,51,33,50,54,53,
+52,38,38,35,34,6,35,34,38,39,39,1,23,7,6,15,4,21,50,22,51,50,54,51,4,113,
+170,27,7,5,8,8,10,9,76,94,91,115,44,10,41,130,100,252,40,33,47,47,33,4,2,
+98,82,49,105,105,107,219,107,73,182,22,48,1,159,109,102,12,18,38,43,83,30,
+28,58,31,119,235,119,3,104,154,155,45,43,85,31,42,73,32,28,29,155,32,54,43,
+43,41,36,36,42,89,115,98,195,70,10,11,5,102,1,208,91,110,13,18,39,43,80,28,
+8,2,10,0,0,1,255,176,0,0,5,74,5,14,0,47,0,0,0,22,23,23,22,22,21,20,6,35,33,
+34,38,53,52,54,51,33,50,54,53,52,38,38,35,34,6,35,34,38,39,39,1,23,7,6,15,
+4,21,50,22,51,50,54,51,4,113,170,27,7,5,8,172,198,252,40,33,47,47,33,4,2,
+98,82,49,105,105,107,219,107,73,182,22,48,1,159,109,102,12,18,38,43,83,30,
+28,58,31,119,235,119,3,104,154,155,45,43,85,31,193,166,41,36,36,42,89,115,
+98,195,70,10,11,5,102,1,208,91,110,13,18,39,43,80,28,8,2,10,0,1,0,100,252,
+255,10,152,5,112,0,48,0,0,5,38,0,1,55,23,22,22,51,50,54,53,52,38,39,39,55,
+23,22,22,21,20,6,35,34,38,39,7,0,0,5,7,39,44,3,35,34,4,7,39,54,36,51,32,4,
+4,23,7,169,215,253,178,254,231,143,69,28,86,48,57,68,46,41,74,132,63,82,37,
+124,95,20,39,14,2,1,155,3,4,1,40,94,116,254,188,254,98,254,30,254,56,226,
+134,254,248,73,29,86,1,30,98,1,41,1,180,1,158,239,199,154,2,156,1,136,83,
+95,39,39,60,51,35,80,58,107,76,94,124,97,41,103,127,7,6,7,253,239,253,31,
+194,121,82,228,217,166,76,16,9,144,16,20,76,136,148,0,1,0,100,252,255,10,
+152,5,112,0,53,0,0,5,38,0,1,55,23,22,22,51,50,54,53,52,38,39,39,55,23,22,
+22,21,20,6,35,34,38,39,7,22,0,23,51,21,22,0,23,7,39,44,3,35,34,4,7,39,54,
+36,51,32,4,4,23,7,169,215,253,178,254,231,143,69,28,86,48,57,68,46,41,74,
+132,63,82,37,124,95,20,39,14,2,123,1,24,155,144,158,1,177,186,94,116,254,
+188,254,98,254,30,254,56,226,134,254,248,73,29,86,1,30,98,1,41,1,180,1,158,
+239,199,154,2,156,1,136,83,95,39,39,60,51,35,80,58,107,76,94,124,97,41,103,
+127,7,6,7,158,254,178,165,149,158,254,138,122,121,82,228,217,166,76,16,9,
+144,16,20,76,136,148,0,1,255,176,252,255,7,156,5,112,0,52,0,0,5,38,0,1,55,
+23,22,22,51,50,54,53,52,38,39,39,55,23,22,22,21,20,6,35,34,38,39,7,22,0,23,
+51,21,22,0,23,7,39,39,38,44,2,35,34,38,53,52,54,51,32,4,5,4,77,234,254,12,
+254,255,143,69,30,85,47,57,68,46,41,74,132,63,82,37,124,95,20,39,14,2,123,
+1,25,155,143,204,1,146,172,94,73,245,201,254,176,254,150,254,106,231,33,47,
+47,33,1,56,1,228,1,44,118,200,2,62,1,103,83,95,41,37,60,51,35,80,58,107,76,
+94,124,97,41,103,127,7,6,7,158,254,178,165,148,200,254,170,113,121,51,173,
+142,193,136,74,41,36,36,42,117,163,0,0,1,255,176,252,255,7,156,5,112,0,47,
+0,0,5,38,0,1,55,23,22,22,51,50,54,53,52,38,39,39,55,23,22,22,21,20,6,35,34,
+38,39,7,0,0,5,7,39,39,38,44,2,35,34,38,53,52,54,51,32,4,5,4,77,234,254,12,
+254,255,143,69,30,85,47,57,68,46,41,74,132,63,82,37,124,95,20,39,14,2,1,154,
+3,9,1,37,94,73,245,201,254,176,254,150,254,106,231,33,47,47,33,1,56,1,228,
+1,44,118,200,2,62,1,103,83,95,41,37,60,51,35,80,58,107,76,94,124,97,41,103,
+127,7,6,7,253,240,253,28,192,121,51,173,142,193,136,74,41,36,36,42,117,163,
+0,255,255,0,90,254,195,3,196,3,104,16,39,1,30,0,241,255,224,16,39,1,30,1,
+192,254,189,16,6,0,28,0,0,255,255,0,90,254,195,4,64,3,104,16,39,1,30,0,241,
+255,224,16,39,1,30,1,192,254,189,16,6,0,29,0,0,0,1,0,140,253,28,4,30,1,247,
+0,14,0,0,1,38,2,3,51,18,18,23,18,18,55,51,2,0,7,1,243,100,222,37,147,55,146,
+96,144,165,20,141,27,254,240,135,253,28,219,2,246,1,10,254,225,253,245,245,
+1,5,2,49,233,254,165,253,59,187,0,1,0,140,253,28,4,170,1,247,0,26,0,0,1,38,
+2,3,51,18,18,23,18,18,55,51,6,6,7,22,22,51,23,21,34,38,39,35,6,2,7,1,243,
+100,222,37,147,55,146,96,144,165,20,141,6,23,16,18,78,44,45,84,98,29,6,56,
+205,96,253,28,219,2,246,1,10,254,225,253,245,245,1,5,2,49,233,87,152,72,18,
+18,1,155,34,32,212,254,51,133,0,1,0,100,0,0,6,71,5,235,0,53,0,0,1,22,22,51,
+50,54,53,52,38,39,39,55,23,22,22,21,20,6,35,34,38,39,7,22,22,23,23,22,18,
+21,20,6,35,33,34,38,39,55,22,22,51,33,38,2,39,39,46,2,39,55,22,22,23,4,157,
+30,61,15,57,62,46,41,74,132,63,73,42,114,98,7,23,11,2,29,48,22,45,60,103,
+80,70,252,39,150,180,42,107,49,140,152,3,149,8,103,65,50,43,74,72,88,35,42,
+53,31,4,60,11,17,52,51,35,80,58,107,76,94,110,105,46,100,123,2,3,8,32,88,
+50,103,140,254,219,56,83,89,80,94,94,70,43,57,1,24,153,114,94,88,39,21,138,
+7,15,11,0,1,0,100,0,0,6,197,5,235,0,57,0,0,33,34,38,39,55,22,22,51,33,50,
+54,55,2,38,38,39,55,22,22,23,23,22,22,51,50,54,53,52,38,39,39,55,23,22,22,
+21,20,6,35,34,38,39,7,22,18,23,23,22,22,51,21,34,38,39,35,6,6,35,1,216,150,
+180,42,107,49,140,152,2,173,76,126,22,205,115,76,89,35,42,53,31,58,30,61,
+15,57,62,46,41,74,132,63,73,42,114,98,7,23,11,2,54,138,48,40,29,66,48,63,
+102,37,8,40,156,116,80,94,94,70,43,42,44,2,34,152,40,22,138,7,15,11,22,11,
+17,52,51,35,80,58,107,76,94,110,105,46,100,123,2,3,8,60,254,181,126,108,83,
+71,155,47,55,45,57,0,1,255,176,0,0,4,195,5,235,0,56,0,0,37,2,38,38,39,55,
+22,22,23,23,22,22,51,50,54,53,52,38,39,39,55,23,22,22,21,20,6,35,34,38,39,
+7,22,18,23,23,22,22,51,21,34,38,39,35,6,6,35,33,34,38,53,52,54,51,33,50,54,
+3,175,205,115,76,89,35,42,53,31,58,30,61,15,57,62,46,41,74,132,63,73,42,114,
+98,7,23,11,2,54,138,48,40,29,66,48,63,102,37,8,40,156,116,253,71,33,47,47,
+33,2,207,76,126,241,2,34,152,40,22,138,7,15,11,22,11,17,52,51,35,80,58,107,
+76,94,110,105,46,100,123,2,3,8,60,254,181,126,108,83,71,155,47,55,45,57,41,
+36,36,42,42,0,1,255,176,0,0,4,67,5,235,0,52,0,0,33,33,34,38,53,52,54,51,33,
+38,2,39,39,46,2,39,55,22,22,23,23,22,22,51,50,54,53,52,38,39,39,55,23,22,
+22,21,20,6,35,34,38,39,7,22,22,23,23,22,18,21,20,6,3,173,252,83,33,47,47,
+33,3,181,8,103,65,50,43,74,72,88,35,42,53,31,58,30,61,15,57,62,46,41,74,132,
+63,73,42,114,98,7,23,11,2,29,48,22,45,60,103,80,41,36,36,42,57,1,24,153,114,
+94,88,39,21,138,7,15,11,22,11,17,52,51,35,80,58,107,76,94,110,105,46,100,
+123,2,3,8,32,88,50,103,140,254,219,56,83,89,0,2,0,100,0,0,5,44,4,176,0,39,
+0,51,0,0,33,34,38,39,55,22,22,51,33,38,2,47,2,38,39,55,23,22,22,23,51,54,
+54,51,50,22,21,20,6,35,34,39,7,22,22,21,20,6,35,2,6,21,20,22,51,50,54,53,
+52,38,35,1,216,150,180,42,107,49,140,152,2,1,6,142,76,55,45,19,9,147,54,18,
+38,17,9,24,73,41,89,105,103,78,18,19,7,69,42,50,47,32,54,57,42,44,56,57,43,
+80,94,94,70,43,52,1,156,198,144,113,48,20,58,139,48,102,48,32,30,106,87,86,
+109,6,3,197,157,61,58,67,3,66,55,50,50,55,55,50,50,55,0,2,0,99,0,0,5,85,4,
+176,0,45,0,57,0,0,1,22,22,51,51,21,35,34,38,39,35,6,6,35,33,34,38,39,55,22,
+22,51,33,50,54,55,38,2,39,55,23,22,23,51,54,54,51,50,22,21,20,6,35,34,39,
+7,2,6,21,20,22,51,50,54,53,52,38,35,4,153,30,80,52,26,30,81,104,35,8,38,154,
+112,254,180,150,180,42,107,49,140,152,1,22,76,120,19,52,238,42,147,87,20,
+21,8,24,73,41,89,105,103,78,18,19,7,18,54,57,42,44,56,57,43,1,63,85,79,155,
+56,46,45,57,80,94,94,70,43,45,43,171,2,120,96,58,228,52,57,32,30,106,87,86,
+109,6,3,1,38,55,50,50,55,55,50,50,55,0,2,255,176,0,0,2,205,4,176,0,44,0,56,
+0,0,1,22,22,51,51,21,35,34,38,39,35,6,6,35,35,34,38,53,52,54,51,51,50,54,
+55,38,2,39,55,23,22,23,51,54,54,51,50,22,21,20,6,35,34,39,7,2,6,21,20,22,
+51,50,54,53,52,38,35,2,17,30,80,52,26,30,81,104,35,8,38,154,112,155,33,47,
+47,33,177,76,120,19,52,238,42,147,87,20,21,8,24,73,41,89,105,103,78,18,19,
+7,18,54,57,42,44,56,57,43,1,63,85,79,155,56,46,45,57,41,36,36,42,45,43,171,
+2,120,96,58,228,52,57,32,30,106,87,86,109,6,3,1,38,55,50,50,55,55,50,50,55,
+0,0,2,255,176,0,0,2,163,4,176,0,38,0,50,0,0,19,23,22,22,23,51,54,54,51,50,
+22,21,20,6,35,34,39,7,22,22,21,20,6,35,33,34,38,53,52,54,51,33,38,2,47,2,
+38,39,0,6,21,20,22,51,50,54,53,52,38,35,207,54,18,38,17,9,24,73,41,89,105,
+103,78,18,19,7,69,42,50,47,254,48,33,47,47,33,1,156,6,142,76,55,45,19,9,1,
+116,54,57,42,44,56,57,43,4,176,139,48,102,48,32,30,106,87,86,109,6,3,197,
+157,61,58,67,41,36,36,42,52,1,156,198,144,113,48,20,254,204,55,50,50,55,55,
+50,50,55,0,0,1,0,91,0,15,3,34,2,240,0,24,0,0,37,21,33,53,51,53,38,38,53,52,
+54,51,50,22,23,7,38,35,34,6,21,20,22,22,51,3,34,253,57,194,64,61,218,156,
+47,118,54,46,84,73,110,132,75,111,100,155,140,129,6,42,126,74,159,201,15,
+24,122,23,118,101,69,116,55,0,0,1,255,176,0,0,3,9,0,155,0,8,0,0,33,33,34,
+38,53,52,54,51,33,3,9,252,247,33,47,47,33,3,9,41,36,36,42,0,255,255,0,234,
+255,231,3,210,2,246,16,39,1,30,2,91,2,9,16,39,1,30,2,91,255,225,16,39,1,30,
+3,104,0,245,16,7,1,30,1,79,0,245,255,255,0,159,2,15,1,110,2,246,16,7,1,30,
+1,4,2,9,255,255,0,159,255,26,1,110,0,1,16,7,1,30,1,4,255,20,255,255,0,180,
+1,166,1,131,3,233,16,39,1,30,1,25,2,252,16,7,1,30,1,25,1,160,255,255,0,159,
+254,139,1,110,0,206,16,39,1,30,1,4,255,225,16,7,1,30,1,4,254,133,255,255,
+0,159,2,149,2,200,3,124,16,39,1,30,1,4,2,143,16,7,1,30,2,94,2,143,255,255,
+0,159,255,231,2,34,2,40,16,39,1,30,1,4,1,59,16,7,1,30,1,184,255,225,255,255,
+0,159,255,231,2,34,2,40,16,39,1,30,1,184,1,59,16,7,1,30,1,4,255,225,255,255,
+0,159,1,167,2,34,3,233,16,39,1,30,1,4,2,252,16,7,1,30,1,184,1,161,255,255,
+0,159,254,140,2,34,0,206,16,39,1,30,1,4,255,225,16,7,1,30,1,184,254,134,0,
+3,0,245,255,233,3,173,4,150,0,23,0,35,0,47,0,0,1,50,54,53,53,51,21,20,22,
+51,51,50,54,53,53,51,21,20,22,51,51,21,33,53,0,22,21,20,6,35,34,38,53,52,
+54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,51,45,44,90,47,46,28,46,47,90,
+44,45,62,253,72,1,141,58,64,42,46,61,61,46,48,58,64,42,46,61,61,46,3,228,
+38,41,99,99,41,38,38,41,99,99,41,38,125,125,254,189,61,55,60,57,57,60,61,
+55,254,49,61,55,60,57,57,60,61,55,0,0,2,0,244,3,35,6,110,5,45,0,3,0,15,0,
+0,19,33,21,33,4,22,21,20,6,35,34,38,53,52,54,51,244,5,122,250,134,2,238,58,
+64,42,46,61,61,46,5,45,125,164,61,55,60,57,57,60,61,55,0,1,1,4,2,128,4,138,
+6,7,0,12,0,0,1,55,1,55,1,55,51,22,22,21,34,38,39,3,99,128,253,33,74,2,223,
+70,10,7,6,76,143,76,2,151,71,2,226,71,253,33,132,77,146,77,6,7,0,5,0,225,
+0,142,5,48,5,5,0,11,0,23,0,35,0,47,0,59,0,0,1,33,53,33,17,51,17,33,21,33,
+17,35,2,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,
+18,22,21,20,6,35,34,38,53,52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,2,212,
+254,13,1,243,105,1,243,254,13,105,165,51,51,34,37,49,49,37,2,26,51,51,34,
+37,49,49,37,34,51,51,34,37,49,49,37,254,42,51,51,34,37,49,49,37,2,149,105,
+2,7,253,249,105,253,249,3,153,44,49,48,46,46,48,49,44,44,49,48,46,46,48,49,
+44,254,0,44,49,48,46,46,48,49,44,44,49,48,46,46,48,49,44,0,1,255,80,255,71,
+0,199,6,129,0,7,0,0,7,17,35,53,33,21,35,17,26,150,1,119,150,185,6,244,70,
+70,249,12,0,2,255,13,4,67,0,229,5,254,0,6,0,9,0,0,19,23,1,39,55,19,5,7,7,
+55,180,49,254,89,49,60,4,1,47,233,6,168,5,254,53,254,122,53,54,1,53,24,56,
+164,154,0,0,2,255,26,254,87,0,243,0,18,0,6,0,9,0,0,3,39,1,23,7,3,37,55,55,
+7,180,50,1,167,50,60,4,254,209,233,6,168,254,87,53,1,134,53,54,254,203,24,
+56,165,155,0,255,255,255,162,255,5,0,97,5,80,16,39,1,31,0,22,4,84,16,7,1,
+31,255,238,254,245,0,2,255,78,4,63,0,160,6,6,0,15,0,27,0,0,18,22,21,20,6,
+7,39,54,54,55,38,38,53,52,54,51,22,38,35,34,6,21,20,22,23,54,54,53,93,67,
+111,185,42,27,47,18,18,19,80,73,53,31,26,37,39,16,11,48,58,6,6,73,54,68,132,
+128,58,20,31,14,40,71,40,77,104,107,33,62,45,29,53,20,38,73,37,0,0,2,255,
+97,254,73,0,180,0,18,0,15,0,30,0,0,2,38,53,52,54,55,23,6,6,7,22,22,21,20,
+6,35,39,6,6,21,20,22,51,50,54,53,52,38,39,6,7,91,68,118,178,43,27,47,18,18,
+18,81,72,6,26,20,30,26,38,39,16,11,18,14,254,73,74,54,71,135,123,59,18,33,
+14,40,72,39,79,103,230,26,48,20,28,32,61,45,29,53,21,14,13,0,0,2,255,136,
+4,93,0,125,6,41,0,11,0,23,0,0,18,22,21,20,6,35,34,38,53,52,54,51,38,22,21,
+20,6,35,34,38,53,52,54,51,100,25,99,39,23,24,98,40,38,25,99,39,23,24,98,40,
+5,51,28,19,38,129,27,20,39,128,246,28,19,38,129,27,20,38,129,0,0,1,255,9,
+4,82,0,228,5,168,0,23,0,0,3,54,54,51,50,22,21,20,6,7,39,54,54,53,52,38,39,
+7,39,55,39,34,6,7,247,49,122,83,95,126,8,5,73,3,6,31,31,77,71,77,15,56,85,
+39,4,220,110,94,111,131,26,53,21,17,16,46,14,65,74,18,204,23,203,1,75,86,
+0,1,255,28,254,173,0,247,0,3,0,23,0,0,23,6,6,35,34,38,53,52,54,55,23,6,6,
+21,20,22,23,55,23,7,23,50,54,55,247,49,122,83,95,126,8,5,73,3,6,31,31,77,
+71,77,15,62,81,37,135,110,94,111,131,26,53,21,17,16,46,14,65,74,18,204,23,
+203,1,81,80,0,255,255,255,49,255,5,0,209,255,241,16,39,1,31,255,125,254,245,
+16,7,1,31,0,134,254,245,255,255,255,49,254,132,0,209,255,241,16,39,1,31,255,
+125,254,116,16,7,1,31,0,134,254,245,0,1,255,16,4,67,0,226,5,253,0,11,0,0,
+19,23,1,39,55,39,7,39,1,23,7,23,178,48,254,205,47,127,64,126,49,1,51,49,126,
+64,5,128,50,254,245,51,111,72,109,52,1,9,50,110,73,0,0,1,255,30,254,87,0,
+240,0,18,0,11,0,0,3,39,1,23,7,23,55,23,1,39,55,39,178,48,1,51,47,127,64,126,
+49,254,204,48,126,64,254,213,50,1,11,52,110,72,109,52,254,246,51,110,73,0,
+255,255,255,180,255,5,0,75,255,241,18,7,1,31,0,0,254,245,0,2,255,42,4,85,
+0,213,6,25,0,7,0,19,0,0,19,7,39,7,39,1,23,7,6,22,21,20,6,35,34,38,53,52,54,
+51,213,55,162,154,56,1,44,57,97,23,36,36,25,27,35,35,27,4,202,52,177,171,
+45,1,80,44,110,161,32,35,36,34,34,36,35,32,0,2,255,42,254,60,0,214,0,0,0,
+7,0,19,0,0,7,55,23,55,23,1,39,55,54,38,53,52,54,51,50,22,21,20,6,35,214,56,
+162,155,55,254,211,56,96,25,38,38,24,27,35,35,27,117,52,177,171,45,254,176,
+44,110,161,32,35,35,35,35,35,35,32,0,255,255,255,180,4,101,0,75,5,81,18,7,
+1,31,0,0,4,85,255,255,252,210,2,176,253,161,3,151,16,7,1,30,253,55,2,170,
+255,255,255,124,4,104,0,21,5,17,16,7,1,32,255,201,4,104,255,255,255,179,255,
+45,0,76,255,214,18,7,1,32,0,0,255,45,255,255,255,180,4,85,0,77,5,252,16,39,
+1,32,0,1,4,85,16,7,1,32,0,1,5,83,255,255,255,180,254,90,0,77,0,1,16,39,1,
+32,0,1,254,90,16,7,1,32,0,1,255,88,255,255,255,40,4,85,0,218,5,252,16,39,
+1,32,0,142,4,85,16,39,1,32,0,1,5,83,16,7,1,32,255,117,4,85,255,255,255,40,
+254,90,0,218,0,1,16,39,1,32,0,142,255,88,16,39,1,32,0,1,254,90,16,7,1,32,
+255,117,255,88,0,1,255,25,4,49,0,208,5,172,0,3,0,0,19,23,1,39,151,57,254,
+131,58,5,172,61,254,194,61,0,0,1,255,24,254,167,0,208,0,36,0,3,0,0,7,55,1,
+7,232,59,1,125,58,27,63,254,194,63,0,1,254,159,4,87,1,105,6,58,0,43,0,0,3,
+23,7,23,55,23,7,23,55,23,7,23,55,23,7,23,55,23,7,23,7,39,7,39,55,39,7,39,
+55,39,7,39,55,39,7,39,55,39,7,39,55,39,55,23,132,43,57,48,57,43,58,49,58,
+41,58,49,59,41,59,49,59,41,59,147,27,146,61,42,61,48,61,42,61,48,61,42,61,
+49,62,42,63,49,62,42,63,139,27,137,6,58,24,100,28,101,26,100,27,100,23,102,
+28,102,25,100,28,101,24,102,85,43,83,105,24,106,28,106,25,104,28,105,23,107,
+27,104,23,106,29,107,24,106,81,44,80,0,0,5,255,7,4,85,0,247,6,87,0,11,0,23,
+0,35,0,47,0,59,0,0,3,35,53,51,53,51,21,51,21,35,21,35,2,22,21,20,6,35,34,
+38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,22,22,21,20,6,35,34,38,
+53,52,54,51,34,22,21,20,6,35,34,38,53,52,54,51,25,224,224,49,223,223,49,73,
+23,23,16,17,21,21,17,242,23,23,14,17,23,23,17,14,23,23,14,17,23,23,17,212,
+23,23,16,17,21,21,17,5,62,48,233,233,48,233,1,158,19,23,21,20,20,21,23,19,
+19,23,21,20,20,21,23,19,231,19,22,21,21,21,21,22,19,19,22,21,21,21,21,22,
+19,0,0,1,254,245,4,84,1,12,5,11,0,19,0,0,18,54,55,51,6,6,35,34,38,35,34,6,
+7,35,54,54,51,50,22,51,151,34,8,75,8,82,68,48,140,37,35,34,7,76,9,82,68,52,
+139,33,4,181,39,45,88,93,85,39,45,88,94,86,0,1,254,251,4,103,1,5,4,196,0,
+3,0,0,1,33,21,33,254,251,2,10,253,246,4,196,93,0,255,255,255,153,4,91,0,104,
+5,66,16,7,1,30,255,254,4,85,255,255,254,234,4,91,1,18,5,66,16,39,1,30,255,
+79,4,85,16,7,1,30,0,168,4,85,0,2,255,124,4,97,0,132,5,103,0,11,0,23,0,0,2,
+38,53,52,54,51,50,22,21,20,6,35,54,54,53,52,38,35,34,6,21,20,22,51,58,74,
+74,58,57,75,77,55,29,37,38,28,29,38,38,29,4,97,69,60,58,75,66,62,60,74,61,
+37,33,33,37,37,33,33,37,0,255,255,255,154,255,20,0,105,255,251,16,7,1,30,
+255,255,255,14,255,255,254,234,255,26,1,18,0,1,16,39,1,30,255,79,255,20,16,
+7,1,30,0,168,255,20,0,2,255,124,254,238,0,132,255,244,0,11,0,23,0,0,22,22,
+21,20,6,35,34,38,53,52,54,51,6,6,21,20,22,51,50,54,53,52,38,35,58,74,74,58,
+57,75,77,55,29,37,38,28,29,38,38,29,12,69,60,58,75,66,62,60,74,61,37,33,33,
+37,37,33,33,37,0,1,255,11,255,51,0,245,0,0,0,19,0,0,7,55,55,54,55,55,51,22,
+22,23,23,21,35,38,39,39,7,6,7,35,245,51,53,27,25,46,89,29,80,40,50,103,31,
+38,75,77,40,35,91,196,47,51,26,26,46,32,79,38,47,9,24,33,65,63,32,27,0,1,
+254,253,255,132,1,6,0,101,0,13,0,0,55,51,6,6,35,34,38,39,51,22,22,51,50,54,
+183,79,8,147,111,113,137,5,79,14,90,76,78,94,101,101,124,117,108,64,66,73,
+0,1,254,244,255,74,1,11,0,2,0,19,0,0,6,6,7,35,54,54,51,50,22,51,50,54,55,
+51,6,6,35,34,38,35,151,35,8,74,8,82,68,48,140,37,35,34,7,76,9,82,68,52,138,
+34,97,38,45,88,94,85,38,45,88,94,85,0,0,1,254,251,255,150,1,5,255,238,0,3,
+0,0,5,33,53,33,1,5,253,246,2,10,106,88,0,2,255,56,4,77,0,191,5,190,0,3,0,
+7,0,0,19,23,5,39,1,23,5,39,188,3,254,135,3,1,110,3,254,135,3,5,34,71,142,
+71,1,42,72,142,72,0,0,2,255,18,4,76,0,189,5,188,0,29,0,42,0,0,3,55,54,55,
+38,38,53,52,54,51,50,22,21,20,6,7,7,39,54,54,53,52,38,39,39,50,22,21,20,6,
+54,22,23,55,54,54,53,52,38,35,34,6,21,132,64,32,26,20,25,75,53,48,68,113,
+158,113,6,10,8,25,27,3,51,67,4,135,23,20,7,24,35,29,23,23,34,4,167,27,13,
+12,16,51,31,53,74,63,50,71,83,59,42,67,14,28,16,20,34,2,68,54,51,12,28,115,
+36,11,3,10,35,26,23,28,30,26,0,2,255,56,254,154,0,191,0,11,0,3,0,7,0,0,23,
+23,5,39,1,23,5,39,188,3,254,135,3,1,110,3,254,135,3,145,71,142,71,1,42,72,
+142,72,0,1,255,67,4,77,0,191,5,34,0,3,0,0,19,23,5,39,188,3,254,135,3,5,34,
+71,142,71,0,2,255,61,4,77,0,184,5,184,0,17,0,30,0,0,3,54,55,55,54,55,38,38,
+53,52,54,51,50,22,21,20,6,7,54,22,23,55,54,54,53,52,38,35,34,6,21,195,15,
+22,93,24,21,20,29,79,54,48,72,138,238,192,25,20,7,32,32,28,29,24,35,4,150,
+5,8,35,9,9,16,45,34,54,75,63,50,78,90,82,212,35,11,2,15,35,23,20,29,30,26,
+0,0,1,255,56,255,53,0,180,0,11,0,3,0,0,55,23,5,39,177,3,254,135,3,11,72,142,
+72,0,0,1,255,15,4,89,0,175,5,130,0,36,0,0,3,6,6,35,34,38,53,53,55,20,22,51,
+50,54,53,52,38,39,55,22,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,
+15,6,55,48,54,63,59,31,31,31,24,7,5,63,16,36,24,26,22,26,12,60,20,23,62,47,
+25,43,4,198,51,58,84,64,9,18,47,58,44,27,17,36,14,24,56,39,32,23,27,41,14,
+23,20,54,32,58,66,21,0,0,2,255,110,4,85,0,128,5,101,0,11,0,23,0,0,2,38,53,
+52,54,51,50,22,21,20,6,35,38,22,51,50,54,53,52,38,35,34,6,21,69,77,82,52,
+59,81,79,58,73,39,32,37,38,41,32,32,41,4,85,74,59,56,83,81,62,53,76,106,41,
+42,29,32,38,42,29,0,0,1,254,252,4,68,0,237,4,224,0,22,0,0,1,54,54,55,55,54,
+55,22,22,51,50,54,55,23,6,6,35,34,38,39,6,7,7,254,252,11,27,14,27,12,9,68,
+89,44,43,80,31,42,34,120,53,57,81,37,8,17,34,4,103,15,34,17,31,14,8,25,15,
+23,19,60,27,36,19,17,8,20,41,0,0,1,255,97,4,85,0,138,5,152,0,26,0,0,19,21,
+5,53,55,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,55,50,55,138,
+254,215,62,22,16,92,64,20,56,23,23,19,34,16,38,46,40,35,15,7,5,4,196,76,35,
+75,7,20,49,20,67,85,10,12,66,7,4,39,35,28,45,1,1,0,0,1,255,97,254,190,0,138,
+0,0,0,24,0,0,23,21,5,53,55,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,
+22,51,50,55,138,254,215,62,22,16,93,63,20,56,23,23,36,33,38,46,43,32,5,5,
+212,76,34,74,7,20,50,20,67,84,9,11,68,13,41,35,31,42,1,0,1,255,209,4,85,0,
+47,5,198,0,3,0,0,19,17,35,17,47,94,5,198,254,143,1,113,255,255,254,227,4,
+89,0,175,6,222,18,38,0,185,0,0,16,7,0,180,255,209,1,34,255,255,255,13,4,77,
+0,191,6,237,18,38,0,179,0,0,16,7,0,185,255,254,1,107,255,255,255,9,4,89,0,
+175,6,216,18,38,0,185,0,0,16,7,0,179,255,209,1,26,255,255,255,15,4,89,0,175,
+6,60,18,38,0,185,0,0,16,7,0,182,255,209,1,26,255,255,255,14,4,89,0,175,6,
+218,18,38,0,185,0,0,16,7,0,183,255,209,1,34,255,255,255,23,4,77,0,191,6,82,
+18,38,0,182,0,0,16,7,0,185,0,8,0,208,0,2,255,15,4,89,0,175,6,219,0,36,0,40,
+0,0,3,6,6,35,34,38,53,53,55,20,22,51,50,54,53,52,38,39,55,22,22,51,50,54,
+53,52,38,39,55,22,22,21,20,6,35,34,38,3,17,35,17,15,6,55,48,54,63,59,31,31,
+31,24,7,5,63,16,36,24,26,22,26,12,60,20,23,62,47,25,43,4,84,4,198,51,58,84,
+64,9,18,47,58,44,27,17,36,14,24,56,39,32,23,27,41,14,23,20,54,32,58,66,21,
+2,42,254,201,1,55,0,255,255,255,38,4,85,0,173,7,35,18,38,0,188,0,0,16,7,0,
+179,255,238,1,101,255,255,255,49,4,85,0,173,6,145,18,38,0,188,0,0,16,7,0,
+182,255,238,1,111,255,255,255,0,4,85,0,171,7,33,18,38,0,188,0,0,16,7,0,180,
+255,238,1,101,255,255,255,43,4,85,0,166,7,29,18,38,0,188,0,0,16,7,0,183,255,
+238,1,101,255,255,255,97,4,85,0,138,7,3,18,38,0,188,0,0,16,7,0,186,0,1,1,
+158,255,255,255,56,253,185,0,180,0,0,18,38,0,189,0,0,16,7,0,184,0,0,254,132,
+255,255,255,56,253,40,0,191,0,0,18,38,0,189,0,0,16,7,0,181,0,0,254,142,0,
+1,0,60,1,103,1,73,2,111,0,11,0,0,18,38,53,52,54,51,50,22,21,20,6,35,143,83,
+85,48,50,86,79,51,1,103,75,59,53,77,76,54,58,76,0,1,0,191,0,0,1,128,4,176,
+0,3,0,0,1,19,35,3,1,78,50,143,50,4,176,251,80,4,176,0,0,1,0,50,0,0,3,35,4,
+176,0,21,0,0,33,35,3,38,2,39,51,23,22,22,51,50,54,55,51,6,6,35,34,38,39,35,
+1,134,146,101,23,50,20,148,15,28,102,57,115,120,30,138,32,198,155,44,92,38,
+1,2,129,145,1,47,111,92,33,36,77,84,148,156,17,25,0,1,0,50,0,0,3,151,4,176,
+0,37,0,0,1,51,20,6,7,22,22,51,50,54,55,51,20,6,35,34,38,39,6,6,35,34,38,39,
+7,19,35,3,38,2,39,51,23,22,22,51,50,54,1,193,132,13,8,15,52,29,67,61,3,132,
+140,113,59,80,30,30,79,42,23,51,21,2,141,146,101,23,50,20,148,23,17,60,31,
+60,55,4,176,49,79,25,20,19,97,95,154,173,32,27,35,25,10,16,1,252,127,2,129,
+145,1,47,111,139,26,29,96,0,0,1,0,60,255,251,2,246,4,204,0,41,0,0,1,6,6,21,
+20,22,23,23,22,22,21,20,6,7,7,6,6,21,20,22,51,50,54,55,21,6,6,35,34,38,53,
+52,54,55,55,39,38,38,53,52,36,37,2,62,184,191,106,102,56,73,47,21,56,143,
+69,58,132,121,63,138,68,66,131,81,204,180,117,156,50,137,116,106,1,0,1,2,
+4,69,50,106,59,36,53,25,14,19,49,41,19,51,50,125,61,77,35,40,42,19,16,142,
+17,22,105,101,87,166,122,39,36,32,106,75,125,185,54,0,0,2,0,70,0,80,3,92,
+4,60,0,11,0,23,0,0,18,18,51,50,18,21,20,6,35,34,38,53,36,38,35,34,6,21,20,
+22,51,50,54,53,70,226,178,181,205,210,189,180,211,2,128,128,108,116,138,124,
+117,126,123,2,254,1,62,254,217,232,231,246,236,219,188,209,213,185,144,160,
+159,163,0,1,0,20,0,0,2,225,4,189,0,21,0,0,1,34,38,39,55,22,22,51,23,33,21,
+20,18,23,23,22,23,23,35,38,2,39,1,141,91,193,93,17,54,164,70,72,1,17,15,10,
+14,7,8,13,147,20,40,2,4,32,8,11,138,5,7,1,96,89,254,185,131,205,100,90,162,
+229,2,124,191,0,0,1,0,0,0,0,3,188,4,176,0,26,0,0,1,3,6,7,7,6,7,7,35,3,39,
+38,2,39,51,22,23,19,19,23,51,54,55,55,54,54,55,3,188,142,41,42,83,41,35,61,
+122,110,68,53,99,59,169,21,24,103,101,42,5,44,41,81,44,81,41,4,176,254,134,
+109,115,224,109,96,169,1,99,213,162,1,43,171,65,77,254,183,254,182,142,124,
+119,236,129,226,109,0,0,1,0,10,0,0,3,198,4,176,0,30,0,0,51,55,19,54,55,55,
+54,55,51,22,23,23,22,22,23,23,22,23,35,3,39,39,38,39,35,6,7,7,6,6,7,10,61,
+154,41,38,72,34,24,122,23,30,64,35,75,37,75,37,34,169,156,55,51,25,20,5,42,
+39,77,42,77,39,172,1,174,115,109,206,96,72,71,90,193,106,221,106,215,106,
+92,1,215,170,160,77,65,125,118,235,130,226,109,0,0,2,0,30,0,0,3,4,4,203,0,
+14,0,27,0,0,33,3,6,6,35,34,38,53,52,54,51,50,22,23,19,3,39,38,38,35,34,6,
+21,20,22,51,50,54,2,112,49,47,114,51,158,175,201,135,149,168,17,72,209,6,
+9,81,100,76,119,99,106,51,86,2,73,25,27,162,140,149,243,196,209,252,202,2,
+208,96,136,132,134,101,79,90,19,0,0,3,0,130,255,236,3,131,4,176,0,3,0,15,
+0,27,0,0,1,1,35,1,4,38,53,52,54,51,50,22,21,20,6,35,0,38,53,52,54,51,50,22,
+21,20,6,35,3,131,253,150,151,2,108,253,234,77,77,43,46,77,69,48,1,191,77,
+77,43,46,77,69,48,4,176,251,80,4,176,238,67,54,48,69,70,47,51,70,252,42,67,
+54,48,69,70,47,51,70,0,1,0,112,254,248,1,133,0,238,0,9,0,0,37,23,6,2,7,35,
+54,63,2,1,118,15,30,90,32,125,13,16,31,55,238,23,106,254,228,89,52,67,136,
+247,0,1,0,109,2,186,1,130,4,176,0,9,0,0,1,23,6,2,7,35,54,63,2,1,115,15,30,
+90,32,125,13,16,31,55,4,176,23,106,254,228,89,52,67,136,247,0,0,1,0,152,255,
+227,1,137,0,242,0,11,0,0,36,22,21,20,6,35,34,38,53,52,54,51,1,72,65,66,57,
+51,67,61,57,242,69,67,66,69,63,72,67,69,0,1,0,130,0,0,1,151,1,246,0,11,0,
+0,51,39,54,18,55,51,6,7,7,6,6,7,145,15,30,90,32,125,13,15,32,15,29,11,23,
+106,1,28,89,52,67,136,63,132,52,0,0,2,0,170,255,227,1,233,4,115,0,8,0,20,
+0,0,19,39,54,54,55,51,6,6,7,2,22,21,20,6,35,34,38,53,52,54,51,217,15,31,75,
+56,125,32,52,21,38,65,66,57,51,67,61,57,2,125,23,118,236,125,121,247,134,
+254,117,69,67,66,69,63,72,67,69,0,0,2,0,170,255,227,1,155,3,116,0,11,0,21,
+0,0,36,22,21,20,6,35,34,38,53,52,54,51,18,21,20,6,35,34,38,53,52,51,1,90,
+65,66,57,51,67,61,57,123,66,57,51,67,118,242,69,67,66,69,63,72,67,69,2,130,
+135,66,69,63,72,135,255,255,0,152,255,227,5,54,0,242,16,38,0,218,0,0,16,39,
+0,218,1,214,0,0,16,7,0,218,3,173,0,0,0,2,0,66,255,240,2,236,4,240,0,24,0,
+35,0,0,1,53,52,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,30,2,21,21,
+2,38,53,52,54,51,50,21,20,6,35,1,147,229,108,203,159,82,156,82,60,60,125,
+68,98,115,70,168,77,123,58,57,52,108,60,48,1,147,33,106,163,139,100,140,180,
+41,42,124,29,33,94,74,57,97,125,132,83,54,254,93,64,58,60,63,123,65,57,0,
+0,2,0,183,255,240,1,144,4,220,0,3,0,14,0,0,1,35,3,51,2,22,21,20,6,35,34,38,
+53,52,51,1,89,105,45,195,47,57,58,51,48,60,108,1,147,3,73,252,9,63,60,58,
+64,57,65,123,0,1,0,82,254,138,2,33,5,132,0,13,0,0,1,51,6,2,21,20,18,23,35,
+38,2,17,16,18,1,127,162,145,144,147,140,160,148,153,154,5,132,194,254,52,
+245,237,254,51,189,171,1,195,1,7,1,10,1,204,0,1,0,61,254,138,2,12,5,132,0,
+13,0,0,19,35,54,18,53,52,2,39,51,22,18,17,16,2,223,160,139,148,144,145,162,
+149,152,154,254,138,188,1,204,239,245,1,204,194,178,254,48,254,253,254,247,
+254,61,0,0,1,0,160,254,188,2,105,5,140,0,7,0,0,1,33,17,33,21,33,17,33,2,105,
+254,55,1,201,254,213,1,43,254,188,6,208,136,250,65,0,0,1,0,50,254,188,1,251,
+5,140,0,7,0,0,23,33,17,33,53,33,17,33,50,1,43,254,213,1,201,254,55,187,5,
+191,136,249,48,0,0,1,0,160,3,84,4,130,7,115,0,5,0,0,1,21,33,17,35,17,4,130,
+252,134,104,7,115,104,252,73,4,31,0,1,255,206,3,84,3,176,7,115,0,5,0,0,1,
+17,35,17,33,53,3,176,104,252,134,7,115,251,225,3,183,104,255,255,0,160,3,
+84,4,130,7,115,18,6,0,229,0,0,255,255,255,206,3,84,3,176,7,115,18,6,0,230,
+0,0,0,2,0,82,255,253,3,170,3,70,0,6,0,13,0,0,19,1,23,1,1,7,1,37,1,23,1,1,
+7,1,82,1,86,119,254,223,1,33,119,254,170,1,139,1,88,117,254,225,1,31,117,
+254,168,1,175,1,151,69,254,162,254,161,71,1,151,27,1,151,69,254,162,254,161,
+71,1,151,0,2,0,80,255,253,3,168,3,70,0,6,0,13,0,0,1,1,39,1,1,55,1,5,1,39,
+1,1,55,1,3,168,254,168,117,1,31,254,225,117,1,88,254,117,254,168,117,1,31,
+254,225,117,1,88,1,148,254,105,71,1,95,1,94,69,254,105,27,254,105,71,1,95,
+1,94,69,254,105,0,0,1,0,70,2,73,3,24,5,0,0,14,0,0,1,3,37,23,5,23,7,3,3,39,
+55,37,55,5,3,1,247,24,1,37,20,254,238,174,131,133,122,134,169,254,241,22,
+1,32,24,5,0,254,225,72,138,28,242,72,1,7,254,249,72,242,28,138,72,1,31,0,
+0,1,0,130,0,152,4,19,4,70,0,11,0,0,1,33,21,33,17,35,17,33,53,33,17,51,2,140,
+1,135,254,121,132,254,122,1,134,132,2,176,132,254,108,1,148,132,1,150,0,1,
+0,130,2,44,4,19,2,176,0,3,0,0,19,53,33,21,130,3,145,2,44,132,132,0,0,2,0,
+145,1,107,4,5,3,113,0,3,0,7,0,0,19,53,33,21,1,53,33,21,145,3,116,252,140,
+3,116,2,239,130,130,254,124,130,130,0,0,1,0,90,255,4,3,85,5,140,0,3,0,0,1,
+1,35,1,3,85,253,147,142,2,110,5,140,249,120,6,136,0,0,1,0,32,255,149,2,249,
+4,236,0,3,0,0,1,1,35,1,2,249,253,184,145,2,73,4,236,250,169,5,87,0,0,1,0,
+23,0,0,2,221,5,182,0,3,0,0,19,1,35,1,186,2,35,166,253,224,5,182,250,74,5,
+182,0,1,0,84,1,217,2,63,2,113,0,3,0,0,19,53,33,21,84,1,235,1,217,152,152,
+0,0,2,0,115,2,155,2,163,4,203,0,11,0,23,0,0,0,22,21,20,6,35,34,38,53,52,54,
+51,18,54,53,52,38,35,34,6,21,20,22,51,2,0,163,165,115,120,160,165,115,75,
+101,101,75,75,101,101,75,4,203,157,123,115,165,159,121,115,165,254,56,101,
+75,77,99,99,77,75,101,0,0,8,0,170,0,104,4,45,3,237,0,5,0,11,0,17,0,23,0,29,
+0,35,0,41,0,47,0,0,1,38,39,55,22,23,3,38,39,53,22,23,19,6,7,39,54,55,1,6,
+7,39,54,55,7,6,7,35,54,55,1,6,7,53,54,55,37,38,39,51,22,23,23,38,39,55,22,
+23,3,238,20,56,45,81,13,219,83,95,117,106,174,12,78,47,59,12,254,70,98,78,
+45,101,120,254,59,13,63,12,78,2,121,101,122,96,80,253,184,77,17,65,16,60,
+250,116,107,47,77,99,2,96,103,77,47,105,122,1,4,59,12,66,12,78,254,96,116,
+107,47,84,92,1,184,17,58,47,77,17,219,83,95,123,102,253,133,77,17,65,16,60,
+33,101,120,96,80,215,12,78,45,57,12,0,0,1,0,180,254,191,6,116,6,15,0,31,0,
+0,1,33,17,39,55,23,55,23,7,17,33,55,23,7,23,7,39,33,17,23,7,39,7,39,55,17,
+33,7,39,55,39,55,1,148,1,181,183,80,181,182,73,183,1,181,136,88,109,109,88,
+136,254,75,183,80,181,182,73,183,254,75,136,88,108,108,88,3,104,1,198,137,
+88,109,109,88,136,254,57,174,71,181,182,64,174,252,206,137,88,109,109,88,
+136,3,51,174,71,181,182,64,0,1,0,180,254,191,6,76,6,15,0,47,0,0,1,35,38,38,
+53,52,54,55,51,23,33,17,39,53,54,54,51,50,22,23,21,7,17,33,55,51,22,22,21,
+20,6,7,35,39,33,17,23,21,6,6,35,34,38,39,53,55,17,33,1,36,48,24,40,38,26,
+48,56,1,217,160,30,143,66,65,133,33,160,1,216,57,48,26,38,40,24,48,56,254,
+39,160,34,140,65,66,135,30,160,254,40,2,50,30,143,66,65,133,33,160,1,254,
+57,48,24,40,38,26,48,56,254,1,160,34,140,65,66,135,30,160,252,150,57,48,26,
+38,40,24,48,56,3,107,255,255,0,90,255,220,3,196,4,224,18,38,0,28,0,0,16,39,
+1,30,0,235,3,243,16,7,1,30,2,69,3,243,255,255,0,90,255,220,4,64,4,224,18,
+38,0,29,0,0,16,39,1,30,2,69,3,243,16,7,1,30,0,235,3,243,255,255,0,100,252,
+255,10,152,4,74,16,38,0,19,0,0,16,7,1,34,7,143,0,0,255,255,255,176,252,255,
+7,156,4,74,16,38,0,20,0,0,16,7,1,34,4,146,0,0,255,255,0,100,252,255,10,152,
+4,74,16,38,0,19,0,0,16,39,1,33,1,170,2,183,16,7,1,34,7,143,0,0,255,255,255,
+176,252,255,7,156,4,74,16,39,1,33,254,174,2,183,16,38,0,20,0,0,16,7,1,34,
+4,146,0,0,255,255,0,100,252,255,10,152,5,112,16,38,0,108,0,0,16,7,1,34,7,
+143,0,0,255,255,255,176,252,255,7,156,5,112,16,38,0,109,0,0,16,7,1,34,4,146,
+0,0,255,255,0,100,252,255,10,175,4,74,16,38,0,19,0,0,16,7,1,35,7,143,0,0,
+255,255,255,176,252,255,7,178,4,74,16,38,0,20,0,0,16,7,1,35,4,146,0,0,255,
+255,0,100,252,255,10,175,4,74,16,38,0,19,0,0,16,39,1,33,1,170,2,183,16,7,
+1,35,7,143,0,0,255,255,255,176,252,255,7,178,4,74,16,39,1,33,254,174,2,183,
+16,38,0,20,0,0,16,7,1,35,4,146,0,0,255,255,0,100,252,255,10,175,5,112,16,
+38,0,108,0,0,16,7,1,35,7,143,0,0,255,255,255,176,252,255,7,178,5,112,16,38,
+0,109,0,0,16,7,1,35,4,146,0,0,255,255,0,149,0,0,8,132,4,195,16,38,0,11,0,
+0,16,39,1,37,6,201,0,0,16,7,1,37,7,123,0,0,255,255,0,149,0,0,7,229,4,195,
+16,38,0,11,0,0,16,7,1,37,6,220,0,0,255,255,0,149,0,0,8,132,4,195,16,38,0,
+11,0,0,16,39,1,37,6,201,0,0,16,7,1,37,7,123,0,0,255,255,0,149,0,0,7,229,4,
+195,16,38,0,11,0,0,16,7,1,37,6,220,0,0,255,255,255,176,253,45,6,112,5,195,
+16,39,0,42,1,84,0,0,16,6,1,34,0,0,255,255,255,176,253,45,6,112,5,195,16,39,
+0,43,1,84,0,0,16,6,1,34,0,0,255,255,255,176,253,45,6,112,5,195,16,39,0,42,
+1,84,0,0,16,38,1,34,0,0,16,7,1,33,2,219,0,67,255,255,255,176,253,45,6,112,
+5,195,16,39,1,33,2,219,0,67,16,39,0,43,1,84,0,0,16,6,1,34,0,0,255,255,255,
+176,252,255,7,221,4,74,16,38,0,20,65,0,16,6,1,36,0,0,255,255,255,176,252,
+255,7,221,4,74,16,38,0,21,65,0,16,6,1,36,0,0,255,255,255,176,252,255,7,221,
+4,74,16,39,1,33,254,239,2,183,16,38,0,20,65,0,16,6,1,36,0,0,255,255,255,176,
+252,255,7,221,4,74,16,39,1,33,254,239,2,183,16,38,0,21,65,0,16,6,1,36,0,0,
+255,255,255,176,252,255,7,221,5,112,16,38,0,109,65,0,16,6,1,36,0,0,255,255,
+255,176,252,255,7,221,5,112,16,38,0,110,65,0,16,6,1,36,0,0,255,255,255,176,
+0,0,3,18,6,6,16,38,0,59,94,0,16,6,1,38,0,0,255,255,255,176,0,0,2,150,6,6,
+16,38,0,60,94,0,16,6,1,38,0,0,255,255,255,176,0,0,2,99,3,104,16,39,0,68,0,
+155,0,0,16,6,1,38,0,0,255,255,255,176,0,0,2,250,3,104,16,39,0,67,0,155,0,
+0,16,6,1,38,0,0,255,255,255,176,0,0,2,49,2,52,16,39,0,51,0,132,0,0,16,6,1,
+38,0,0,255,255,255,176,0,0,2,254,2,52,16,39,0,50,0,132,0,0,16,6,1,38,0,0,
+255,255,255,189,0,0,3,62,4,176,16,38,0,121,113,0,16,6,1,38,13,0,255,255,255,
+190,0,0,3,21,4,176,16,38,0,122,114,0,16,6,1,38,14,0,0,1,0,130,252,118,3,12,
+0,155,0,15,0,0,37,51,21,35,34,6,7,22,0,23,7,38,0,53,52,36,2,45,139,107,96,
+187,23,27,1,58,156,120,201,254,183,1,11,155,155,18,9,106,254,22,197,86,238,
+2,15,130,114,52,255,255,255,201,4,101,0,96,5,81,16,7,1,31,0,21,4,85,255,255,
+255,161,255,6,0,56,255,242,16,7,1,31,255,237,254,246,0,1,255,155,0,6,0,106,
+0,237,0,11,0,0,54,22,21,20,6,35,34,38,53,52,54,51,51,55,56,50,44,57,53,48,
+237,59,57,56,59,53,62,57,59,0,0,1,255,180,0,16,0,75,0,252,0,11,0,0,54,22,
+21,20,6,35,34,38,53,52,54,51,54,21,64,40,26,21,64,40,252,33,24,38,141,33,
+24,42,137,0,0,1,255,179,0,0,0,76,0,169,0,11,0,0,54,22,21,20,6,35,34,38,53,
+52,54,51,30,46,46,30,33,44,44,33,169,40,44,44,41,41,44,44,40,0,0,1,1,167,
+254,139,2,88,255,76,0,11,0,0,4,22,21,20,6,35,34,38,53,52,54,51,2,35,53,53,
+35,38,51,51,38,180,46,50,51,46,46,51,51,45,0,1,255,176,0,0,2,38,0,155,0,8,
+0,0,33,33,34,38,53,52,54,51,33,2,38,253,218,33,47,47,33,2,38,41,36,36,42,
+0,0,1,255,176,0,0,3,32,0,155,0,8,0,0,33,33,34,38,53,52,54,51,33,3,32,252,
+224,33,47,47,33,3,32,41,36,36,42,0,0,1,255,176,0,0,0,66,0,155,0,8,0,0,51,
+35,34,38,53,52,54,51,51,66,66,33,47,47,33,66,41,36,36,42,0,1,255,176,0,0,
+1,9,0,155,0,8,0,0,33,33,34,38,53,52,54,51,33,1,9,254,247,33,47,47,33,1,9,
+41,36,36,42,0,0,1,255,176,0,0,0,156,0,155,0,8,0,0,51,35,34,38,53,52,54,51,
+51,156,156,33,47,47,33,156,41,36,36,42,0,1,254,72,6,134,0,40,6,204,0,3,0,
+0,1,33,21,33,254,72,1,224,254,32,6,204,70,0,0,1,252,184,6,134,0,40,6,204,
+0,3,0,0,1,33,21,33,252,184,3,112,252,144,6,204,70,0,0,1,255,216,6,134,1,184,
+6,204,0,3,0,0,3,33,21,33,40,1,224,254,32,6,204,70,0,1,255,216,6,134,4,216,
+6,204,0,3,0,0,3,33,21,33,40,5,0,251,0,6,204,70,0,1,255,216,6,134,7,198,6,
+204,0,3,0,0,3,33,21,33,40,7,238,248,18,6,204,70,0,1,254,72,6,134,255,116,
+6,204,0,3,0,0,1,33,21,33,254,72,1,44,254,212,6,204,70,0,0,1,252,184,6,134,
+255,116,6,204,0,3,0,0,1,33,21,33,252,184,2,188,253,68,6,204,70,0,0,1,0,120,
+6,134,1,184,6,204,0,3,0,0,19,33,21,33,120,1,64,254,192,6,204,70,0,1,0,120,
+6,134,4,216,6,204,0,3,0,0,19,33,21,33,120,4,96,251,160,6,204,70,0,1,0,120,
+6,134,7,198,6,204,0,3,0,0,19,33,21,33,120,7,78,248,178,6,204,70,0,0,0,15,
+0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,54,0,94,0,3,0,1,4,9,0,2,
+0,14,0,148,0,3,0,1,4,9,0,3,0,92,0,162,0,3,0,1,4,9,0,4,0,54,0,94,0,3,0,1,4,
+9,0,5,0,30,0,254,0,3,0,1,4,9,0,6,0,48,1,28,0,3,0,1,4,9,0,7,0,68,1,76,0,3,
+0,1,4,9,0,8,0,42,1,144,0,3,0,1,4,9,0,9,0,40,1,186,0,3,0,1,4,9,0,10,0,96,1,
+226,0,3,0,1,4,9,0,11,0,62,2,66,0,3,0,1,4,9,0,12,0,60,2,128,0,3,0,1,4,9,0,
+13,2,150,2,188,0,3,0,1,4,9,0,14,0,52,5,82,0,67,0,111,0,112,0,121,0,114,0,
+105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,52,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,121,0,
+114,0,105,0,97,0,99,0,32,0,69,0,115,0,116,0,114,0,97,0,110,0,103,0,101,0,
+108,0,97,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,
+116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,
+45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,121,
+0,114,0,105,0,97,0,99,0,32,0,69,0,115,0,116,0,114,0,97,0,110,0,103,0,101,
+0,108,0,97,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,
+52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,83,0,121,
+0,114,0,105,0,97,0,99,0,69,0,115,0,116,0,114,0,97,0,110,0,103,0,101,0,108,
+0,97,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,
+97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,
+111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,
+116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,
+0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,
+0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,
+110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,
+47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,
+111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,
+0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,
+0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,
+0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,
+102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,
+0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,
+0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,
+83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,
+0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,
+0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,
+0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,
+0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,
+0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,
+116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,
+108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,
+109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,58,0,2,0,7,0,8,0,
+12,0,1,0,13,0,13,0,3,0,14,0,51,0,1,0,53,0,124,0,1,0,140,0,204,0,3,0,247,1,
+27,0,1,1,28,1,29,0,3,0,2,0,35,0,13,0,13,0,1,0,139,0,139,0,4,0,140,0,140,0,
+1,0,141,0,141,0,3,0,143,0,143,0,1,0,144,0,144,0,3,0,145,0,146,0,1,0,147,0,
+149,0,3,0,150,0,150,0,1,0,151,0,152,0,3,0,153,0,153,0,1,0,154,0,154,0,3,0,
+155,0,156,0,1,0,157,0,157,0,2,0,158,0,158,0,5,0,159,0,159,0,1,0,160,0,160,
+0,3,0,161,0,161,0,1,0,162,0,162,0,3,0,163,0,163,0,1,0,164,0,164,0,3,0,165,
+0,170,0,1,0,171,0,171,0,2,0,172,0,173,0,3,0,174,0,174,0,5,0,175,0,178,0,3,
+0,179,0,180,0,1,0,181,0,181,0,3,0,182,0,183,0,1,0,184,0,184,0,3,0,185,0,188,
+0,1,0,189,0,189,0,3,0,190,0,202,0,1,1,28,1,28,0,1,1,29,1,29,0,3,0,1,0,0,0,
+10,0,56,0,172,0,2,68,70,76,84,0,14,115,121,114,99,0,30,0,4,0,0,0,0,255,255,
+0,3,0,0,0,2,0,4,0,4,0,0,0,0,255,255,0,3,0,1,0,3,0,5,0,6,107,101,114,110,0,
+38,107,101,114,110,0,38,109,97,114,107,0,96,109,97,114,107,0,96,109,107,109,
+107,0,108,109,107,109,107,0,108,0,0,0,27,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,
+13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,
+0,28,0,29,0,30,0,31,0,32,0,0,0,4,0,0,0,1,0,2,0,3,0,0,0,2,0,4,0,5,0,53,0,108,
+5,12,9,182,10,142,11,146,12,188,13,132,17,160,18,58,18,184,19,54,19,176,20,
+12,20,114,20,220,21,0,21,116,21,168,21,220,22,162,23,56,25,78,26,218,27,124,
+27,240,28,80,28,122,28,224,29,166,30,54,30,126,30,160,38,24,38,210,38,252,
+39,38,39,92,39,146,39,224,40,100,40,146,40,186,41,38,41,180,41,208,42,0,42,
+28,42,44,42,62,42,78,42,206,42,244,43,36,0,4,0,1,0,1,0,8,0,1,37,254,4,222,
+0,1,0,12,0,174,0,40,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,
+0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,
+0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,
+9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,
+92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,0,0,9,92,
+0,0,9,92,0,152,1,56,1,50,1,50,1,56,1,62,1,68,1,74,1,80,1,86,1,92,3,78,1,98,
+3,96,1,92,3,90,3,96,1,98,1,116,1,104,1,110,1,116,1,122,1,128,1,134,1,134,
+1,140,1,146,1,152,1,158,1,164,1,170,1,176,1,188,1,194,1,194,1,182,1,188,1,
+194,1,194,1,200,1,200,1,206,1,212,1,218,1,218,1,224,1,230,1,236,1,236,1,242,
+1,248,1,254,2,4,2,10,2,16,2,22,2,28,2,34,2,40,2,46,2,52,2,64,2,58,2,64,2,
+70,2,76,2,82,2,88,2,94,2,100,2,106,2,112,2,118,2,124,2,130,2,136,2,142,2,
+148,2,148,2,154,2,160,2,166,2,172,2,178,2,184,3,72,3,72,2,190,2,196,2,202,
+2,208,2,214,2,220,2,226,2,232,2,238,2,238,3,102,3,102,3,108,2,244,2,250,3,
+0,3,6,3,12,3,18,3,18,3,24,3,30,3,36,3,42,3,48,3,54,3,60,3,66,3,72,3,72,3,
+78,3,84,3,90,3,96,3,102,3,108,3,78,3,84,3,90,3,96,3,102,3,108,3,114,3,120,
+3,126,3,132,3,138,3,144,3,150,3,156,3,168,3,162,3,168,3,168,3,174,3,180,3,
+186,3,192,3,198,3,204,3,210,3,216,3,222,3,222,3,228,0,1,3,41,3,238,0,1,3,
+34,3,240,0,1,3,44,3,240,0,1,4,143,4,39,0,1,4,144,4,39,0,1,2,188,4,38,0,1,
+2,187,4,39,0,1,5,37,4,176,0,1,2,42,4,176,0,1,1,133,4,78,0,1,1,133,4,79,0,
+1,1,134,4,79,0,1,3,183,4,82,0,1,3,185,4,82,0,1,2,58,4,76,0,1,0,181,4,76,0,
+1,0,180,4,76,0,1,3,116,3,171,0,1,3,121,3,170,0,1,1,240,3,170,0,1,1,240,3,
+172,0,1,4,51,6,6,0,1,4,48,6,1,0,1,4,51,6,1,0,1,1,182,6,1,0,1,0,174,2,195,
+0,1,1,25,3,92,0,1,0,255,3,65,0,1,2,153,3,155,0,1,2,3,4,44,0,1,2,3,4,45,0,
+1,2,58,6,128,0,1,255,182,6,128,0,1,255,199,6,128,0,1,3,220,4,76,0,1,3,221,
+4,76,0,1,3,220,4,51,0,1,3,224,4,51,0,1,1,148,2,105,0,1,0,226,2,74,0,1,0,238,
+4,76,0,1,0,239,4,76,0,1,3,170,3,240,0,1,3,168,3,239,0,1,3,169,3,238,0,1,3,
+170,3,238,0,1,3,166,3,238,0,1,3,169,3,237,0,1,3,169,3,240,0,1,3,178,3,232,
+0,1,3,177,3,232,0,1,1,194,3,232,0,1,1,198,3,232,0,1,3,179,5,19,0,1,3,177,
+5,19,0,1,1,228,5,19,0,1,1,223,5,19,0,1,3,214,5,178,0,1,3,210,5,179,0,1,2,
+104,5,179,0,1,2,155,2,46,0,1,2,153,2,47,0,1,4,15,4,48,0,1,4,14,4,47,0,1,2,
+179,4,48,0,1,2,179,4,49,0,1,3,209,4,76,0,1,3,212,4,76,0,1,2,42,4,76,0,1,2,
+50,4,76,0,1,3,46,5,202,0,1,3,46,5,203,0,1,3,157,5,165,0,1,3,157,5,166,0,1,
+1,202,5,166,0,1,1,73,5,255,0,1,1,154,4,76,0,1,1,149,4,76,0,1,2,96,2,160,0,
+1,2,99,2,160,0,1,3,115,5,123,0,1,1,118,5,126,0,1,1,108,5,126,0,1,2,173,5,
+90,0,1,2,170,5,90,0,1,0,88,5,90,0,1,0,87,5,90,0,1,1,245,3,187,0,1,1,131,2,
+109,0,1,1,148,5,67,0,1,5,39,4,176,0,1,2,57,4,176,0,1,5,42,4,176,0,1,2,44,
+4,176,0,1,4,70,5,255,0,1,1,79,5,255,0,1,3,36,3,239,0,1,3,35,3,242,0,1,3,37,
+3,239,0,1,3,40,3,239,0,1,3,12,6,1,0,1,3,14,6,1,0,1,3,9,6,1,0,1,3,9,5,255,
+0,1,2,109,4,176,0,1,2,107,4,176,0,1,1,144,5,255,0,1,1,138,5,255,0,1,0,20,
+6,128,0,1,0,35,6,128,0,1,1,138,4,76,0,1,1,137,4,76,0,1,1,132,3,90,0,1,1,152,
+3,120,0,1,0,201,5,90,0,1,0,227,2,74,0,4,0,1,0,1,0,8,0,1,0,12,0,62,0,1,0,90,
+0,184,0,1,0,23,0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,0,160,0,162,
+0,164,0,172,0,173,0,175,0,176,0,177,0,178,0,181,0,184,0,189,0,203,0,204,1,
+29,0,2,0,4,0,8,0,12,0,0,0,14,0,51,0,5,0,53,0,124,0,43,0,247,1,27,0,115,0,
+23,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,
+0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,
+5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,0,0,5,114,
+0,0,5,114,0,152,3,108,3,108,3,108,3,108,1,50,1,56,1,56,1,62,1,68,1,74,2,226,
+1,80,1,86,1,92,1,98,3,90,1,104,2,166,2,166,2,166,2,166,1,110,1,116,1,122,
+1,122,1,128,1,134,1,140,1,146,1,152,1,158,1,176,1,176,1,182,1,164,1,170,1,
+176,1,182,1,182,1,188,1,194,1,200,1,206,1,212,1,218,1,224,1,224,1,230,1,236,
+1,242,1,248,1,254,2,4,2,10,2,10,2,16,2,22,2,28,2,34,2,64,2,40,2,46,2,64,2,
+52,2,58,2,64,2,64,2,70,2,70,2,76,2,82,2,88,2,94,2,100,2,106,2,112,2,118,2,
+124,2,130,2,136,2,142,2,148,2,154,2,160,2,160,2,166,2,166,2,172,2,178,2,184,
+2,184,2,190,2,196,2,202,2,208,2,214,2,220,2,226,3,96,3,102,2,232,2,238,2,
+244,2,250,2,250,3,0,3,6,3,12,3,18,3,24,3,24,3,30,3,36,3,42,3,48,3,54,3,60,
+3,66,3,78,3,96,3,90,3,96,3,102,3,72,3,78,3,84,3,90,3,96,3,102,3,108,3,114,
+3,120,3,126,3,132,3,138,3,144,3,150,3,174,3,156,3,162,3,168,3,174,3,174,3,
+180,3,186,3,192,3,198,3,204,3,210,3,216,3,222,3,228,0,1,3,112,255,156,0,1,
+4,49,255,57,0,1,2,94,255,55,0,1,2,94,255,56,0,1,4,210,254,218,0,1,1,252,254,
+189,0,1,1,252,254,191,0,1,4,215,254,212,0,1,4,205,254,212,0,1,1,233,254,191,
+0,1,3,203,255,58,0,1,3,203,255,57,0,1,2,135,255,56,0,1,1,55,254,229,0,1,1,
+53,254,231,0,1,3,217,255,55,0,1,3,216,255,54,0,1,2,106,255,56,0,1,2,109,255,
+56,0,1,2,7,252,166,0,1,4,129,252,167,0,1,4,132,252,167,0,1,2,7,252,167,0,
+1,0,246,254,49,0,1,0,244,254,50,0,1,1,56,255,56,0,1,1,20,255,57,0,1,2,178,
+255,17,0,1,2,179,255,17,0,1,2,72,255,56,0,1,2,140,255,56,0,1,2,139,255,55,
+0,1,1,140,255,56,0,1,1,90,255,56,0,1,4,219,255,56,0,1,4,218,255,56,0,1,3,
+185,255,57,0,1,1,137,254,205,0,1,0,252,252,224,0,1,1,50,255,57,0,1,1,14,255,
+57,0,1,3,157,255,54,0,1,3,167,255,54,0,1,3,162,255,57,0,1,3,160,255,57,0,
+1,3,169,255,56,0,1,3,158,255,56,0,1,2,45,255,56,0,1,2,46,255,56,0,1,3,86,
+255,59,0,1,3,84,255,59,0,1,2,31,255,57,0,1,2,30,255,56,0,1,3,131,255,56,0,
+1,3,133,255,56,0,1,2,124,255,59,0,1,2,122,255,62,0,1,2,88,252,115,0,1,2,90,
+252,117,0,1,4,67,255,56,0,1,4,69,255,54,0,1,2,234,255,56,0,1,1,160,255,106,
+0,1,3,203,255,56,0,1,3,201,255,56,0,1,2,36,255,56,0,1,2,252,255,5,0,1,2,252,
+255,8,0,1,3,205,255,56,0,1,3,205,255,55,0,1,2,141,255,56,0,1,2,145,255,56,
+0,1,4,212,254,212,0,1,1,251,254,187,0,1,1,166,254,83,0,1,1,164,254,81,0,1,
+2,45,252,115,0,1,3,75,255,60,0,1,3,73,255,55,0,1,2,105,255,56,0,1,2,108,255,
+56,0,1,2,151,255,57,0,1,1,135,255,56,0,1,1,45,255,56,0,1,1,212,255,56,0,1,
+1,124,255,56,0,1,1,160,255,108,0,1,1,158,255,108,0,1,4,214,254,212,0,1,4,
+211,254,216,0,1,2,11,254,189,0,1,4,212,254,218,0,1,1,251,254,191,0,1,4,211,
+254,212,0,1,1,252,254,190,0,1,3,111,255,156,0,1,3,111,255,155,0,1,3,114,255,
+156,0,1,3,113,255,156,0,1,5,2,252,117,0,1,5,4,252,117,0,1,5,1,252,117,0,1,
+5,2,252,114,0,1,4,141,253,180,0,1,4,140,253,181,0,1,4,141,253,181,0,1,4,142,
+253,181,0,1,1,234,255,56,0,1,1,184,255,56,0,1,1,169,255,57,0,1,1,205,255,
+57,0,1,1,152,255,57,0,1,1,188,255,56,0,1,1,248,255,56,0,1,1,159,255,56,0,
+1,0,208,252,211,0,4,0,1,0,1,0,8,0,1,0,12,0,228,0,1,0,20,0,36,0,1,0,2,0,157,
+0,171,0,2,0,0,0,10,0,0,0,10,0,1,0,0,4,85,0,28,0,58,0,64,0,70,0,76,0,82,0,
+154,0,88,0,88,0,94,0,94,0,94,0,94,0,100,0,106,0,112,0,118,0,124,0,130,0,136,
+0,142,0,148,0,148,0,154,0,160,0,154,0,160,0,166,0,166,0,1,6,144,3,253,0,1,
+6,143,3,254,0,1,4,188,3,254,0,1,4,188,3,255,0,1,6,215,2,19,0,1,3,222,2,6,
+0,1,3,134,3,254,0,1,5,116,3,110,0,1,5,114,3,113,0,1,4,23,3,63,0,1,4,23,3,
+66,0,1,5,154,4,118,0,1,5,151,4,118,0,1,3,205,4,118,0,1,3,202,4,118,0,1,4,
+188,3,194,0,1,6,217,2,16,0,1,3,237,2,6,0,1,4,31,2,7,0,4,0,1,0,1,0,8,0,1,17,
+214,0,12,0,1,0,64,0,80,0,2,0,8,0,14,0,21,0,0,0,26,0,29,0,8,0,53,0,56,0,12,
+0,81,0,84,0,16,0,101,0,102,0,20,0,249,0,250,0,22,0,255,1,0,0,24,1,13,1,14,
+0,26,0,2,0,0,0,10,0,0,0,10,0,1,0,0,0,0,0,28,0,58,0,64,0,70,0,70,0,76,0,154,
+0,82,0,88,0,94,0,94,0,94,0,94,0,100,0,106,0,112,0,118,0,124,0,130,0,136,0,
+142,0,148,0,148,0,154,0,160,0,154,0,160,0,166,0,166,0,1,6,128,255,91,0,1,
+6,129,255,87,0,1,4,174,255,90,0,1,7,11,254,37,0,1,4,17,254,40,0,1,4,17,254,
+37,0,1,3,140,255,39,0,1,5,85,254,192,0,1,5,85,254,185,0,1,4,94,255,66,0,1,
+4,94,255,67,0,1,5,229,255,64,0,1,5,227,255,91,0,1,4,19,255,87,0,1,4,22,255,
+63,0,1,5,48,255,39,0,1,7,13,254,36,0,1,4,32,254,40,0,1,6,156,252,163,0,6,
+0,1,0,1,0,8,0,1,0,12,0,86,0,1,0,100,0,248,0,1,0,35,0,13,0,140,0,143,0,145,
+0,146,0,150,0,153,0,155,0,159,0,161,0,163,0,165,0,166,0,179,0,180,0,182,0,
+183,0,185,0,186,0,187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,
+0,198,0,199,0,200,0,201,0,202,1,28,0,1,0,5,0,156,0,167,0,168,0,169,0,170,
+0,35,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,
+0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,
+0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,
+0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,
+0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,1,0,0,4,91,0,5,
+0,12,0,18,0,24,0,30,0,36,0,1,0,0,4,96,0,1,0,5,5,150,0,1,0,5,5,107,0,1,0,8,
+5,170,0,1,0,5,5,195,0,6,0,1,0,1,0,8,0,1,0,12,0,50,0,1,0,66,0,142,0,1,0,17,
+0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,0,160,0,162,0,164,0,181,0,
+184,0,189,0,203,0,204,1,29,0,1,0,6,0,172,0,173,0,175,0,176,0,177,0,178,0,
+17,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,
+0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,
+0,0,70,0,1,0,0,255,250,0,6,0,14,0,20,0,26,0,32,0,38,0,44,0,1,0,0,254,162,
+0,1,255,248,254,145,0,1,255,250,254,167,0,1,255,249,254,250,0,1,255,251,254,
+189,0,1,0,0,254,232,0,2,0,0,0,1,0,8,0,1,0,58,0,4,0,0,0,24,0,74,0,148,0,162,
+0,232,1,38,1,84,1,154,1,232,2,26,2,104,2,182,2,212,2,242,3,8,3,34,3,56,3,
+86,3,86,3,116,3,130,3,160,3,194,3,224,3,250,0,2,0,2,0,205,0,219,0,0,0,235,
+0,243,0,15,0,18,0,205,0,110,0,207,255,166,0,208,255,196,0,210,0,90,0,212,
+255,186,0,214,0,20,0,215,0,130,0,216,0,80,0,217,255,136,0,218,0,40,0,219,
+0,130,0,236,0,80,0,237,0,80,0,238,0,70,0,239,255,196,0,240,255,196,0,241,
+0,70,0,242,0,130,0,3,0,206,255,216,0,217,255,226,0,239,255,186,0,17,0,205,
+0,30,0,207,0,90,0,208,0,80,0,209,0,50,0,210,0,50,0,211,0,50,0,212,0,100,0,
+213,0,40,0,214,0,40,0,215,0,80,0,218,255,216,0,236,0,40,0,237,0,40,0,238,
+0,70,0,239,0,40,0,240,0,100,0,242,0,70,0,15,0,205,0,30,0,207,0,90,0,208,0,
+120,0,210,0,30,0,212,0,130,0,213,0,40,0,214,0,40,0,215,0,60,0,218,255,216,
+0,236,0,40,0,237,0,40,0,238,0,70,0,239,0,40,0,240,0,100,0,242,0,70,0,11,0,
+209,0,40,0,210,0,60,0,211,0,40,0,212,0,50,0,213,0,70,0,217,255,216,0,219,
+0,40,0,238,0,70,0,239,255,196,0,241,0,70,0,242,0,50,0,17,0,205,0,70,0,207,
+255,166,0,208,255,176,0,210,0,60,0,211,0,30,0,212,255,246,0,213,0,30,0,214,
+0,30,0,217,255,146,0,219,0,80,0,236,0,60,0,237,0,60,0,238,0,70,0,239,255,
+96,0,240,255,166,0,241,0,30,0,242,0,110,0,19,0,205,255,146,0,207,0,130,0,
+208,0,120,0,209,255,216,0,210,255,226,0,211,0,50,0,212,0,150,0,213,255,176,
+0,215,0,110,0,216,255,146,0,217,0,50,0,218,255,46,0,219,255,176,0,236,255,
+176,0,237,255,176,0,239,0,50,0,240,0,120,0,241,255,136,0,242,255,186,0,12,
+0,207,0,130,0,208,0,120,0,210,0,20,0,211,0,60,0,212,0,170,0,215,0,110,0,216,
+255,136,0,217,0,50,0,218,255,126,0,238,0,30,0,239,0,40,0,240,0,140,0,19,0,
+207,255,136,0,208,255,126,0,209,0,110,0,210,0,30,0,211,0,80,0,212,255,206,
+0,213,0,170,0,214,0,50,0,215,0,90,0,216,0,70,0,217,255,46,0,218,0,40,0,219,
+0,80,0,236,255,226,0,237,255,226,0,238,0,30,0,239,255,106,0,240,255,206,0,
+241,0,170,0,19,0,205,0,30,0,207,0,40,0,208,0,90,0,209,255,206,0,210,0,90,
+0,211,0,40,0,212,0,80,0,213,255,226,0,214,0,40,0,215,0,60,0,216,255,106,0,
+218,255,36,0,236,0,50,0,237,0,50,0,238,0,100,0,239,255,216,0,240,0,40,0,241,
+255,226,0,242,0,90,0,7,0,205,0,90,0,206,255,186,0,207,0,30,0,208,0,60,0,209,
+0,90,0,212,0,50,0,213,0,110,0,7,0,206,255,216,0,207,255,126,0,208,255,126,
+0,209,0,70,0,212,255,56,0,213,0,70,0,214,0,40,0,5,0,206,255,176,0,208,0,40,
+0,209,255,206,0,212,0,70,0,213,255,196,0,6,0,207,255,126,0,208,255,126,0,
+209,0,40,0,212,255,46,0,213,0,80,0,214,0,60,0,5,0,207,255,86,0,208,255,86,
+0,209,0,50,0,212,255,126,0,213,0,80,0,7,0,207,0,90,0,208,0,90,0,209,255,236,
+0,210,0,70,0,211,0,60,0,212,0,120,0,213,255,206,0,7,0,205,0,80,0,206,255,
+236,0,207,255,136,0,208,255,146,0,210,0,60,0,212,255,236,0,213,255,226,0,
+3,0,205,0,80,0,210,0,70,0,211,0,30,0,7,0,206,255,176,0,207,254,252,0,208,
+255,6,0,210,255,126,0,211,255,236,0,212,255,106,0,213,0,60,0,8,0,207,255,
+86,0,208,255,86,0,209,0,100,0,210,255,216,0,211,0,40,0,212,255,196,0,213,
+0,130,0,214,0,90,0,7,0,205,255,156,0,206,255,216,0,208,0,80,0,209,255,186,
+0,210,255,166,0,212,0,50,0,213,255,176,0,6,0,205,0,120,0,207,255,156,0,208,
+255,156,0,210,0,110,0,211,0,70,0,214,0,80,0,6,0,206,255,196,0,207,0,30,0,
+208,0,30,0,209,255,166,0,212,0,80,0,213,255,146,0,8,0,9,0,7,0,20,0,38,0,56,
+0,82,0,100,0,118,0,136,0,3,0,0,0,1,23,74,0,1,3,150,0,1,0,0,0,33,0,3,0,0,0,
+1,23,56,0,1,1,146,0,1,0,0,0,34,0,3,0,0,0,1,23,38,0,1,0,18,0,1,0,0,0,35,0,
+1,0,2,0,62,0,63,0,3,0,0,0,1,23,12,0,1,1,222,0,1,0,0,0,36,0,3,0,0,0,1,22,250,
+0,1,3,106,0,1,0,0,0,37,0,3,0,0,0,1,22,232,0,1,20,86,0,1,0,0,0,36,0,3,0,0,
+0,1,22,214,0,1,2,66,0,1,0,0,0,38,0,8,0,9,0,6,0,18,0,36,0,54,0,72,0,90,0,108,
+0,3,0,0,0,1,22,196,0,1,2,254,0,1,0,0,0,38,0,3,0,0,0,1,22,178,0,1,0,250,0,
+1,0,0,0,37,0,3,0,0,0,1,22,160,0,1,1,96,0,1,0,0,0,36,0,3,0,0,0,1,22,142,0,
+1,2,236,0,1,0,0,0,35,0,3,0,0,0,1,22,124,0,1,19,216,0,1,0,0,0,34,0,3,0,0,0,
+1,22,106,0,1,1,196,0,1,0,0,0,33,0,8,0,9,0,6,0,18,0,36,0,54,0,72,0,90,0,108,
+0,3,0,0,0,1,22,160,0,1,2,128,0,1,0,0,0,38,0,3,0,0,0,1,22,142,0,1,0,124,0,
+1,0,0,0,37,0,3,0,0,0,1,22,124,0,1,0,226,0,1,0,0,0,36,0,3,0,0,0,1,22,106,0,
+1,2,110,0,1,0,0,0,35,0,3,0,0,0,1,22,88,0,1,19,90,0,1,0,0,0,36,0,3,0,0,0,1,
+22,70,0,1,1,70,0,1,0,0,0,34,0,8,0,9,0,5,0,16,0,50,0,68,0,86,0,104,0,3,0,0,
+0,1,20,142,0,1,0,18,0,1,0,0,0,38,0,1,0,6,0,41,0,42,0,45,0,46,1,9,1,11,0,3,
+0,0,0,1,20,108,0,1,0,104,0,1,0,0,0,37,0,3,0,0,0,1,20,90,0,1,1,244,0,1,0,0,
+0,36,0,3,0,0,0,1,20,72,0,1,18,224,0,1,0,0,0,38,0,3,0,0,0,1,20,54,0,1,0,204,
+0,1,0,0,0,35,0,8,0,9,0,4,0,14,0,38,0,56,0,74,0,3,0,0,0,1,20,118,0,1,0,18,
+0,1,0,0,0,38,0,1,0,1,0,55,0,3,0,0,0,1,20,94,0,1,1,152,0,1,0,0,0,37,0,3,0,
+0,0,1,20,76,0,1,18,132,0,1,0,0,0,38,0,3,0,0,0,1,20,58,0,1,0,112,0,1,0,0,0,
+37,0,8,0,9,0,4,0,14,0,32,0,58,0,76,0,3,0,0,0,1,20,152,0,1,0,80,0,1,0,0,0,
+38,0,3,0,0,0,1,0,18,0,1,0,62,0,1,0,0,0,38,0,1,0,2,0,50,0,51,0,3,0,0,0,1,20,
+22,0,1,0,36,0,1,0,0,0,38,0,3,0,0,0,1,19,176,0,1,0,18,0,1,0,0,0,38,0,1,0,2,
+0,78,0,79,0,8,0,9,0,5,0,16,0,34,0,52,0,70,0,88,0,3,0,0,0,1,20,232,0,1,0,118,
+0,1,0,0,0,33,0,3,0,0,0,1,20,106,0,1,0,100,0,1,0,0,0,39,0,3,0,0,0,1,19,142,
+0,1,0,82,0,1,0,0,0,39,0,3,0,0,0,1,19,250,0,1,0,64,0,1,0,0,0,39,0,3,0,0,0,
+1,20,70,0,1,0,46,0,1,0,0,0,39,0,8,1,1,0,1,0,8,0,3,0,0,0,1,19,206,0,2,17,142,
+0,20,0,1,0,0,0,40,0,1,0,2,1,6,1,8,0,8,3,1,0,4,0,14,0,34,0,54,0,90,0,3,0,0,
+0,1,20,92,0,2,21,86,0,60,0,1,0,0,0,41,0,3,0,0,0,1,19,220,0,2,21,66,0,40,0,
+1,0,0,0,41,0,3,0,0,0,1,19,218,0,2,21,46,0,20,0,1,0,0,0,41,0,1,0,6,0,19,0,
+20,0,23,0,24,1,13,1,15,0,3,0,0,0,1,20,16,0,2,21,10,0,20,0,1,0,0,0,42,0,1,
+0,1,0,54,0,8,1,1,0,2,0,10,0,32,0,3,0,0,0,1,21,98,0,3,16,244,9,28,16,244,0,
+1,0,0,0,40,0,3,0,0,0,1,21,76,0,2,16,190,9,6,0,1,0,0,0,40,0,8,1,1,0,2,0,10,
+0,32,0,3,0,0,0,1,21,46,0,3,16,192,16,160,16,192,0,1,0,0,0,40,0,3,0,0,0,1,
+21,24,0,2,16,138,16,170,0,1,0,0,0,40,0,8,3,1,0,7,0,20,0,40,0,76,0,96,0,116,
+0,136,0,156,0,3,0,0,0,1,20,240,0,2,20,116,0,156,0,1,0,0,0,42,0,3,0,0,0,1,
+20,220,0,2,20,96,0,20,0,1,0,0,0,41,0,1,0,6,0,40,0,43,0,44,0,47,1,10,1,12,
+0,3,0,0,0,1,20,126,0,2,20,60,0,100,0,1,0,0,0,42,0,3,0,0,0,1,19,18,0,2,20,
+40,0,80,0,1,0,0,0,42,0,3,0,0,0,1,20,184,0,2,20,20,0,60,0,1,0,0,0,42,0,3,0,
+0,0,1,19,24,0,2,20,0,0,40,0,1,0,0,0,42,0,3,0,0,0,1,19,22,0,2,19,236,0,20,
+0,1,0,0,0,42,0,1,0,9,0,18,0,21,0,22,0,25,0,107,0,110,1,14,1,16,1,18,0,8,3,
+1,0,6,0,18,0,42,0,66,0,88,0,110,0,130,0,3,0,4,15,158,19,176,19,176,20,130,
+0,1,19,176,0,0,0,1,0,0,0,42,0,3,0,4,18,194,19,152,19,152,20,106,0,1,19,152,
+0,0,0,1,0,0,0,41,0,3,0,3,15,110,19,128,20,82,0,1,19,128,0,0,0,1,0,0,0,42,
+0,3,0,3,18,148,19,106,20,60,0,1,19,106,0,0,0,1,0,0,0,41,0,3,0,2,15,66,20,
+38,0,1,19,84,0,0,0,1,0,0,0,42,0,3,0,2,18,106,20,18,0,1,19,64,0,0,0,1,0,0,
+0,41,0,8,3,1,0,21,0,48,0,72,0,96,0,120,0,144,0,168,0,192,0,216,0,238,1,4,
+1,26,1,48,1,70,1,92,1,114,1,134,1,160,1,186,1,212,1,232,2,2,0,3,0,4,6,236,
+18,252,18,252,19,206,0,1,18,122,0,0,0,1,0,0,0,43,0,3,0,4,1,82,18,228,18,228,
+19,182,0,1,18,98,0,0,0,1,0,0,0,44,0,3,0,4,1,84,18,204,18,204,19,158,0,1,18,
+74,0,0,0,1,0,0,0,44,0,3,0,4,1,86,18,180,18,180,19,134,0,1,18,50,0,0,0,1,0,
+0,0,44,0,3,0,4,6,210,18,156,18,156,19,110,0,1,18,26,0,0,0,1,0,0,0,44,0,3,
+0,4,1,84,18,132,18,132,19,86,0,1,18,2,0,0,0,1,0,0,0,44,0,3,0,4,17,150,18,
+108,18,108,19,62,0,1,17,234,0,0,0,1,0,0,0,44,0,3,0,3,6,68,18,84,19,38,0,1,
+17,210,0,0,0,1,0,0,0,43,0,3,0,3,0,172,18,62,19,16,0,1,17,188,0,0,0,1,0,0,
+0,44,0,3,0,3,0,176,18,40,18,250,0,1,17,166,0,0,0,1,0,0,0,44,0,3,0,3,0,180,
+18,18,18,228,0,1,17,144,0,0,0,1,0,0,0,44,0,3,0,3,6,50,17,252,18,206,0,1,17,
+122,0,0,0,1,0,0,0,44,0,3,0,3,0,182,17,230,18,184,0,1,17,100,0,0,0,1,0,0,0,
+44,0,3,0,3,16,250,17,208,18,162,0,1,17,78,0,0,0,1,0,0,0,44,0,3,0,2,5,170,
+18,140,0,1,17,56,0,0,0,1,0,0,0,43,0,3,0,2,0,20,18,120,0,1,17,36,0,0,0,1,0,
+0,0,44,0,1,0,1,0,60,0,3,0,2,0,20,18,94,0,1,17,10,0,0,0,1,0,0,0,44,0,1,0,1,
+0,68,0,3,0,2,0,20,18,68,0,1,16,240,0,0,0,1,0,0,0,44,0,1,0,1,1,21,0,3,0,2,
+5,142,18,42,0,1,16,214,0,0,0,1,0,0,0,44,0,3,0,2,0,20,18,22,0,1,16,194,0,0,
+0,1,0,0,0,44,0,1,0,1,0,122,0,3,0,2,16,84,17,252,0,1,16,168,0,0,0,1,0,0,0,
+44,0,8,3,1,0,15,0,36,0,60,0,84,0,108,0,132,0,156,0,178,0,200,0,222,0,244,
+1,10,1,36,1,62,1,88,1,114,0,3,0,0,0,1,17,196,0,4,16,242,16,242,0,250,16,242,
+0,1,0,0,0,44,0,3,0,0,0,1,17,172,0,4,16,218,16,218,0,252,16,218,0,1,0,0,0,
+43,0,3,0,0,0,1,17,148,0,4,16,194,16,194,0,254,16,194,0,1,0,0,0,42,0,3,0,0,
+0,1,17,124,0,4,16,170,16,170,1,0,16,170,0,1,0,0,0,42,0,3,0,0,0,1,17,100,0,
+4,16,146,16,146,1,2,16,146,0,1,0,0,0,42,0,3,0,0,0,1,17,76,0,3,16,122,0,130,
+16,122,0,1,0,0,0,44,0,3,0,0,0,1,17,54,0,3,16,100,0,134,16,100,0,1,0,0,0,43,
+0,3,0,0,0,1,17,32,0,3,16,78,0,138,16,78,0,1,0,0,0,42,0,3,0,0,0,1,17,10,0,
+3,16,56,0,142,16,56,0,1,0,0,0,42,0,3,0,0,0,1,16,244,0,3,16,34,0,146,16,34,
+0,1,0,0,0,42,0,3,0,0,0,1,16,222,0,2,0,20,16,12,0,1,0,0,0,44,0,1,0,1,0,32,
+0,3,0,0,0,1,16,196,0,2,0,20,15,242,0,1,0,0,0,43,0,1,0,1,0,57,0,3,0,0,0,1,
+16,170,0,2,0,20,15,216,0,1,0,0,0,42,0,1,0,1,0,61,0,3,0,0,0,1,16,144,0,2,0,
+20,15,190,0,1,0,0,0,42,0,1,0,1,0,91,0,3,0,0,0,1,16,118,0,2,0,20,15,164,0,
+1,0,0,0,42,0,1,0,1,0,94,0,8,3,1,0,6,0,18,0,42,0,66,0,88,0,110,0,136,0,3,0,
+0,0,1,16,74,0,4,15,120,15,120,0,112,14,246,0,1,0,0,0,41,0,3,0,0,0,1,16,50,
+0,4,15,96,15,96,0,114,14,222,0,1,0,0,0,45,0,3,0,0,0,1,16,26,0,3,15,72,0,64,
+14,198,0,1,0,0,0,41,0,3,0,0,0,1,16,4,0,3,15,50,0,68,14,176,0,1,0,0,0,45,0,
+3,0,0,0,1,15,238,0,2,0,20,14,154,0,1,0,0,0,41,0,1,0,1,0,39,0,3,0,0,0,1,15,
+212,0,2,0,20,14,128,0,1,0,0,0,45,0,1,0,1,0,118,0,8,3,1,0,5,0,16,0,36,0,56,
+0,76,0,96,0,3,0,1,15,84,0,1,14,216,0,1,0,232,0,1,0,0,0,45,0,3,0,1,13,220,
+0,1,14,196,0,1,0,212,0,1,0,0,0,46,0,3,0,1,15,84,0,1,14,176,0,1,0,192,0,1,
+0,0,0,47,0,3,0,1,13,134,0,1,14,156,0,1,0,172,0,1,0,0,0,48,0,3,0,1,13,178,
+0,1,14,136,0,1,0,152,0,1,0,0,0,49,0,8,3,1,0,3,0,12,0,48,0,76,0,3,0,0,0,1,
+0,20,0,2,14,104,0,120,0,1,0,0,0,49,0,2,0,2,0,8,0,12,0,0,1,5,1,8,0,5,0,3,0,
+0,0,1,0,20,0,2,14,68,0,84,0,1,0,0,0,49,0,1,0,2,0,30,0,31,0,3,0,0,0,1,14,106,
+0,2,14,40,0,56,0,1,0,0,0,49,0,8,5,1,0,1,0,8,0,3,0,0,0,1,14,136,0,2,0,20,0,
+28,0,1,0,0,0,50,0,1,0,2,0,158,0,174,0,1,0,1,0,65,0,8,1,1,0,4,0,14,0,36,0,
+58,0,80,0,3,0,0,0,1,1,204,0,3,9,234,1,204,0,190,0,1,0,0,0,40,0,3,0,0,0,1,
+1,208,0,3,9,212,1,182,0,168,0,1,0,0,0,40,0,3,0,0,0,1,1,160,0,3,0,146,1,160,
+9,190,0,1,0,0,0,40,0,3,0,0,0,1,1,164,0,3,0,124,1,138,9,168,0,1,0,0,0,40,0,
+8,1,1,0,4,0,14,0,36,0,58,0,80,0,3,0,0,0,1,1,102,0,3,9,132,0,156,0,88,0,1,
+0,0,0,40,0,3,0,0,0,1,1,106,0,3,9,110,0,134,0,66,0,1,0,0,0,40,0,3,0,0,0,1,
+1,58,0,3,0,44,0,112,9,88,0,1,0,0,0,40,0,3,0,0,0,1,1,62,0,3,0,22,0,90,9,66,
+0,1,0,0,0,40,0,1,0,32,0,140,0,143,0,146,0,150,0,153,0,161,0,163,0,165,0,166,
+0,167,0,168,0,170,0,179,0,180,0,182,0,183,0,185,0,186,0,187,0,188,0,191,0,
+192,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,0,201,0,202,0,1,0,12,
+0,50,0,51,0,67,0,68,0,121,0,122,1,21,1,22,1,23,1,24,1,25,1,26,0,8,3,1,0,4,
+0,14,0,36,0,58,0,80,0,3,0,0,0,1,0,160,0,3,12,176,0,160,0,88,0,1,0,0,0,49,
+0,3,0,0,0,1,0,164,0,3,12,154,0,138,0,66,0,1,0,0,0,49,0,3,0,0,0,1,0,116,0,
+3,0,44,0,116,12,132,0,1,0,0,0,49,0,3,0,0,0,1,0,120,0,3,0,22,0,94,12,110,0,
+1,0,0,0,49,0,1,0,19,0,141,0,144,0,147,0,148,0,149,0,151,0,154,0,162,0,164,
+0,173,0,175,0,176,0,177,0,178,0,181,0,184,0,189,0,203,0,204,0,8,1,1,0,2,0,
+10,0,36,0,3,0,0,0,1,0,20,0,2,8,50,0,52,0,1,0,0,0,51,0,1,0,1,0,34,0,3,0,0,
+0,1,0,20,0,2,8,24,0,26,0,1,0,0,0,51,0,1,0,1,0,35,0,1,0,3,0,8,0,9,0,10,0,8,
+0,1,0,1,0,8,0,3,0,0,0,1,12,176,0,2,0,20,7,178,0,1,0,0,0,52,0,1,0,1,0,51,0,
+2,0,9,0,2,0,10,0,52,0,1,0,16,0,5,0,0,0,3,0,26,0,34,0,34,0,1,0,3,0,48,0,65,
+0,66,0,1,0,227,0,200,0,200,0,1,0,227,0,125,0,125,0,2,5,88,0,5,0,0,5,158,5,
+252,0,13,0,26,0,0,0,0,255,136,255,136,0,160,0,160,0,75,0,75,0,60,0,60,0,50,
+0,50,0,50,0,50,255,156,255,156,0,80,0,80,0,30,0,30,0,170,0,170,1,214,1,214,
+0,50,0,50,1,44,1,44,0,210,0,210,0,85,0,85,0,80,0,80,0,80,0,80,0,85,0,85,0,
+220,0,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,141,
+255,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,206,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,181,255,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,36,255,36,255,136,255,136,255,106,255,106,255,206,255,206,0,
+50,0,50,255,26,255,26,0,0,0,0,0,0,0,0,0,0,0,0,255,81,255,81,255,181,255,181,
+254,237,254,237,0,0,0,0,255,206,255,206,255,191,255,191,0,0,0,0,0,0,0,0,254,
+37,254,37,0,170,0,170,255,86,255,86,0,35,0,35,0,55,0,55,0,220,0,220,255,106,
+255,106,0,0,0,0,255,81,255,81,0,50,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,
+156,255,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,255,156,255,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,255,146,255,146,0,0,0,0,255,81,255,81,0,50,0,50,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,181,255,181,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,186,255,186,0,70,0,70,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,100,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,
+0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,255,216,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,104,1,104,0,0,0,0,0,0,0,0,0,0,0,0,255,186,255,186,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,131,255,131,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,238,2,238,0,0,0,0,0,0,0,0,0,0,0,0,255,186,255,186,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,44,1,44,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,55,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,3,52,3,52,0,0,0,0,0,0,0,0,0,125,0,125,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,75,0,155,0,155,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,120,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,0,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,
+0,80,0,120,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,0,100,0,0,
+0,0,0,100,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,75,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,31,255,31,0,2,0,11,0,8,0,12,0,0,0,26,0,35,0,5,0,61,0,62,0,15,0,65,0,
+66,0,17,0,89,0,90,0,19,0,95,0,96,0,21,0,101,0,102,0,23,0,111,0,114,0,25,0,
+123,0,123,0,29,0,247,0,248,0,30,1,5,1,8,0,32,0,2,0,15,0,8,0,12,0,1,0,26,0,
+29,0,2,0,30,0,31,0,4,0,32,0,33,0,3,0,34,0,35,0,6,0,61,0,62,0,12,0,65,0,65,
+0,11,0,66,0,66,0,10,0,95,0,96,0,2,0,101,0,102,0,5,0,111,0,112,0,8,0,113,0,
+114,0,7,0,123,0,123,0,9,0,247,0,248,0,2,1,5,1,8,0,1,0,2,0,54,0,8,0,10,0,1,
+0,18,0,18,0,19,0,21,0,22,0,19,0,25,0,25,0,19,0,26,0,26,0,9,0,28,0,28,0,9,
+0,32,0,32,0,15,0,34,0,34,0,18,0,36,0,36,0,17,0,39,0,39,0,17,0,40,0,40,0,13,
+0,43,0,44,0,13,0,47,0,47,0,13,0,48,0,48,0,16,0,53,0,53,0,4,0,56,0,56,0,3,
+0,57,0,57,0,5,0,60,0,60,0,5,0,61,0,61,0,23,0,64,0,64,0,23,0,65,0,65,0,7,0,
+68,0,68,0,6,0,77,0,77,0,2,0,80,0,80,0,2,0,81,0,81,0,8,0,84,0,84,0,8,0,85,
+0,85,0,10,0,88,0,88,0,10,0,89,0,89,0,11,0,91,0,91,0,22,0,94,0,94,0,22,0,95,
+0,95,0,9,0,97,0,97,0,21,0,100,0,100,0,21,0,101,0,101,0,12,0,107,0,107,0,19,
+0,110,0,110,0,19,0,111,0,111,0,9,0,113,0,113,0,14,0,119,0,119,0,20,0,122,
+0,122,0,20,0,127,0,127,0,25,0,129,0,129,0,25,0,131,0,131,0,25,0,134,0,134,
+0,25,0,220,0,220,0,24,0,247,0,247,0,9,1,10,1,10,0,13,1,12,1,12,0,13,1,14,
+1,14,0,19,1,16,1,16,0,19,1,18,1,18,0,19,1,20,1,20,0,5,1,21,1,21,0,6,0,8,1,
+1,0,3,0,12,0,38,0,64,0,3,0,0,0,1,0,20,0,2,0,78,0,162,0,1,0,0,0,51,0,1,0,1,
+0,66,0,3,0,0,0,1,0,20,0,2,0,52,0,136,0,1,0,0,0,51,0,1,0,1,0,48,0,3,0,0,0,
+1,0,20,0,2,0,26,0,110,0,1,0,0,0,51,0,1,0,1,0,49,0,1,0,40,0,13,0,140,0,143,
+0,145,0,146,0,150,0,153,0,155,0,156,0,159,0,161,0,163,0,165,0,166,0,167,0,
+168,0,169,0,170,0,179,0,180,0,182,0,183,0,185,0,186,0,187,0,188,0,190,0,191,
+0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,0,201,0,202,1,28,0,
+1,0,4,0,126,0,128,0,130,0,133,0,1,0,9,0,3,0,12,0,22,0,32,0,1,2,50,0,5,255,
+86,255,86,0,1,2,130,0,5,255,106,255,106,0,1,2,12,0,5,255,116,255,116,0,1,
+0,9,0,3,0,12,0,22,0,32,0,1,1,246,0,5,254,62,254,62,0,1,2,88,0,5,255,56,255,
+56,0,1,1,244,0,5,255,136,255,136,0,1,0,9,0,4,0,14,0,24,0,34,0,44,0,1,1,220,
+0,5,255,46,255,46,0,1,2,44,0,5,255,96,255,96,0,1,0,140,0,5,255,186,255,186,
+0,1,1,172,0,5,255,206,255,206,0,1,0,9,0,4,0,14,0,24,0,34,0,44,0,1,0,106,0,
+5,255,56,255,56,0,1,1,156,0,5,255,126,255,126,0,1,1,128,0,5,255,156,255,156,
+0,1,1,226,0,5,255,181,255,181,0,1,0,9,0,5,0,16,0,26,0,36,0,46,0,56,0,1,1,
+92,0,5,255,6,255,6,0,1,1,100,0,5,255,56,255,56,0,1,0,126,0,5,255,106,255,
+106,0,1,1,170,0,5,255,126,255,126,0,1,0,10,0,5,255,196,255,196,0,1,0,4,0,
+55,0,56,0,117,0,118,0,1,0,9,0,7,0,20,0,142,0,30,0,48,0,74,0,92,0,114,0,1,
+1,10,0,5,255,66,255,66,0,1,0,10,0,5,255,126,255,126,0,1,0,2,0,59,0,60,0,1,
+0,10,0,5,255,156,255,156,0,1,0,6,0,55,0,56,0,83,0,84,0,117,0,118,0,1,0,10,
+0,5,255,181,255,181,0,1,0,2,0,99,0,100,0,1,0,10,0,5,255,196,255,196,0,1,0,
+4,0,50,0,51,0,67,0,68,0,1,0,10,0,5,255,226,255,226,0,1,0,2,0,38,0,39,0,1,
+0,9,0,2,0,10,0,20,0,1,0,162,0,5,255,106,255,106,0,1,0,10,0,5,255,136,255,
+136,0,1,0,6,0,63,0,64,0,67,0,68,0,99,0,100,0,1,1,1,0,3,2,0,0,12,0,22,0,1,
+2,66,0,5,0,65,0,65,0,1,0,10,0,5,0,120,0,120,0,1,0,2,0,67,0,68,0,1,3,1,0,5,
+0,16,0,24,0,58,0,76,0,98,0,1,1,154,0,2,255,254,0,1,0,10,0,5,0,100,0,100,0,
+1,0,10,0,26,0,27,0,28,0,29,0,83,0,84,0,95,0,96,0,247,0,248,0,1,0,10,0,5,0,
+140,0,140,0,1,0,2,0,63,0,64,0,1,0,10,0,5,0,150,0,150,0,1,0,4,0,16,0,17,0,
+105,0,106,0,1,2,26,0,5,0,250,0,250,0,1,3,1,0,8,0,22,0,30,0,48,0,58,0,76,0,
+94,0,110,0,132,0,1,1,40,0,2,254,57,0,1,0,10,0,5,0,75,0,75,0,1,0,2,0,101,0,
+102,0,1,1,224,0,5,0,125,0,125,0,1,0,10,0,5,0,160,0,160,0,1,0,2,0,83,0,84,
+0,1,0,10,0,5,0,250,0,250,0,1,0,2,0,32,0,33,0,1,0,10,0,5,1,119,1,119,0,1,0,
+1,0,123,0,1,0,10,0,5,1,144,1,144,0,1,0,4,0,34,0,35,0,111,0,112,0,1,1,54,0,
+5,3,82,3,82,0,1,3,1,0,2,0,10,0,18,0,1,0,36,0,2,253,128,0,1,1,112,0,5,0,50,
+0,50,0,1,3,1,0,2,0,10,0,38,0,1,0,8,0,2,253,48,0,1,0,8,0,141,0,144,0,147,0,
+151,0,154,0,160,0,162,0,164,0,1,1,64,0,5,0,160,0,160,0,1,3,1,0,2,0,10,0,18,
+0,1,0,90,0,2,253,233,0,1,1,36,0,5,0,175,0,175,0,1,3,1,0,1,0,8,0,1,0,64,0,
+2,253,193,0,1,3,1,0,1,0,8,0,1,0,48,0,3,0,50,254,12,0,1,3,1,0,1,0,8,0,1,0,
+30,0,2,254,12,0,1,3,1,0,4,0,14,0,68,0,78,0,96,0,1,0,8,0,2,253,218,0,1,0,21,
+0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,0,160,0,162,0,164,0,172,0,
+173,0,175,0,176,0,177,0,178,0,181,0,184,0,189,1,29,0,1,0,118,0,5,0,50,0,50,
+0,1,0,10,0,5,0,100,0,100,0,1,0,2,0,111,0,112,0,1,0,10,0,5,1,144,1,144,0,2,
+0,3,0,8,0,12,0,0,0,30,0,31,0,5,1,5,1,8,0,7,0,1,5,1,0,1,0,8,0,1,0,10,0,5,1,
+194,1,194,0,1,0,8,0,26,0,27,0,28,0,29,0,95,0,96,0,247,0,248,0,1,1,1,0,2,0,
+10,0,28,0,1,0,10,0,5,0,180,0,180,0,1,0,2,0,34,0,35,0,1,0,10,0,5,0,225,0,225,
+0,1,0,3,0,48,0,49,0,66,0,1,0,1,0,1,0,8,0,1,0,10,0,5,0,200,0,200,0,1,0,2,0,
+89,0,90,0,0,0,1,0,0,0,10,0,100,1,136,0,2,68,70,76,84,0,14,115,121,114,99,
+0,52,0,4,0,0,0,0,255,255,0,14,0,0,0,2,0,4,0,6,0,8,0,10,0,12,0,14,0,16,0,18,
+0,20,0,22,0,24,0,26,0,4,0,0,0,0,255,255,0,14,0,1,0,3,0,5,0,7,0,9,0,11,0,13,
+0,15,0,17,0,19,0,21,0,23,0,25,0,27,0,28,97,97,108,116,0,170,97,97,108,116,
+0,170,99,97,108,116,0,178,99,97,108,116,0,178,99,99,109,112,0,218,99,99,109,
+112,0,218,102,105,110,50,0,226,102,105,110,50,0,226,102,105,110,51,0,232,
+102,105,110,51,0,232,102,105,110,97,0,238,102,105,110,97,0,238,105,110,105,
+116,0,244,105,110,105,116,0,244,109,101,100,50,0,250,109,101,100,50,0,250,
+109,101,100,105,1,0,109,101,100,105,1,0,114,108,105,103,1,6,114,108,105,103,
+1,6,115,97,108,116,1,12,115,97,108,116,1,12,115,115,48,49,1,18,115,115,48,
+49,1,18,115,115,48,50,1,24,115,115,48,50,1,24,115,115,48,51,1,30,115,115,
+48,51,1,30,0,0,0,2,0,0,0,1,0,0,0,18,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,
+20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,0,0,2,0,2,0,3,0,0,
+0,1,0,8,0,0,0,1,0,9,0,0,0,1,0,7,0,0,0,1,0,4,0,0,0,1,0,6,0,0,0,1,0,5,0,0,0,
+1,0,10,0,0,0,1,0,34,0,0,0,1,0,31,0,0,0,1,0,32,0,0,0,1,0,33,0,40,0,82,0,240,
+2,112,2,140,5,4,5,18,5,80,5,94,5,244,6,2,6,22,6,68,11,252,18,4,18,62,18,108,
+19,146,19,206,20,120,20,238,21,54,23,78,23,162,24,232,26,38,26,74,26,168,
+30,86,30,112,30,176,30,208,31,48,31,70,31,96,31,118,31,160,32,202,33,20,33,
+46,33,148,0,1,0,0,0,1,0,8,0,2,0,76,0,35,1,14,1,16,0,27,0,29,0,31,0,33,0,35,
+1,9,1,10,1,11,1,12,1,24,1,23,1,19,1,20,1,27,1,22,1,21,0,74,0,90,0,96,0,102,
+1,18,0,112,0,114,1,25,1,26,1,39,0,171,0,174,0,231,0,232,1,42,1,43,1,44,0,
+1,0,35,0,21,0,25,0,26,0,28,0,30,0,32,0,34,0,42,0,43,0,46,0,47,0,50,0,51,0,
+59,0,60,0,66,0,67,0,68,0,70,0,89,0,95,0,101,0,110,0,111,0,113,0,121,0,122,
+0,139,0,157,0,158,0,225,0,226,1,47,1,48,1,49,0,3,0,0,0,1,0,8,0,1,1,54,0,31,
+0,68,0,78,0,84,0,90,0,98,0,106,0,112,0,120,0,128,0,134,0,142,0,150,0,158,
+0,166,0,174,0,182,0,190,0,198,0,206,0,216,0,224,0,232,0,240,0,248,1,0,1,8,
+1,16,1,24,1,30,1,38,1,46,0,4,0,12,0,11,0,10,0,9,0,2,1,6,1,5,0,2,1,8,1,7,0,
+3,0,17,0,16,0,15,0,3,0,21,0,20,0,19,0,2,0,249,0,255,0,3,1,13,0,250,1,0,0,
+3,0,25,0,24,0,23,0,2,0,251,1,1,0,3,1,15,0,252,1,2,0,3,0,39,0,38,0,37,0,3,
+0,43,0,42,0,41,0,3,0,47,0,46,0,45,0,3,0,51,0,50,0,49,0,3,0,56,0,55,0,54,0,
+3,0,60,0,59,0,58,0,3,0,64,0,63,0,62,0,3,0,68,0,67,0,66,0,4,0,72,0,71,0,70,
+0,73,0,3,0,76,0,75,0,74,0,3,0,80,0,79,0,78,0,3,0,84,0,83,0,82,0,3,0,88,0,
+87,0,86,0,3,0,94,0,93,0,92,0,3,0,100,0,99,0,98,0,3,0,106,0,105,0,104,0,3,
+0,110,0,109,0,108,0,2,0,253,1,3,0,3,1,17,0,254,1,4,0,3,0,118,0,117,0,116,
+0,3,0,122,0,121,0,120,0,1,0,31,0,8,0,11,0,12,0,14,0,18,0,19,0,20,0,22,0,23,
+0,24,0,36,0,40,0,44,0,48,0,53,0,57,0,61,0,65,0,69,0,73,0,77,0,81,0,85,0,91,
+0,97,0,103,0,107,0,108,0,109,0,115,0,119,0,2,0,0,0,1,0,8,0,1,0,8,0,1,0,14,
+0,1,0,1,0,142,0,2,1,28,1,29,0,6,0,1,0,28,0,62,0,80,0,98,0,116,0,134,0,152,
+0,170,0,188,0,206,0,224,0,242,1,4,1,22,1,40,1,58,1,76,1,94,1,112,1,130,1,
+148,1,166,1,196,1,220,1,244,2,12,2,36,2,66,2,90,0,3,0,0,0,2,1,176,1,122,0,
+0,0,1,0,0,0,35,0,3,0,0,0,2,1,134,1,104,0,0,0,1,0,0,0,35,0,3,0,0,0,2,1,242,
+1,86,0,0,0,1,0,0,0,35,0,3,0,0,0,2,1,254,1,68,0,0,0,1,0,0,0,35,0,3,0,0,0,2,
+1,152,1,50,0,0,0,1,0,0,0,35,0,3,0,0,0,2,1,110,1,32,0,0,0,1,0,0,0,35,0,3,0,
+0,0,2,1,20,1,14,0,0,0,1,0,0,0,35,0,3,0,0,0,2,1,26,1,122,0,0,0,1,0,0,0,35,
+0,3,0,0,0,2,1,32,1,104,0,0,0,1,0,0,0,35,0,3,0,0,0,2,1,38,1,86,0,0,0,1,0,0,
+0,35,0,3,0,0,0,2,1,44,1,68,0,0,0,1,0,0,0,35,0,3,0,0,0,2,1,56,1,50,0,0,0,1,
+0,0,0,35,0,3,0,0,0,2,1,62,1,86,0,0,0,1,0,0,0,35,0,3,0,0,0,2,1,74,1,68,0,0,
+0,1,0,0,0,35,0,3,0,0,0,2,0,126,0,180,0,0,0,1,0,0,0,35,0,3,0,0,0,2,0,108,0,
+138,0,0,0,1,0,0,0,35,0,3,0,0,0,2,0,90,0,246,0,0,0,1,0,0,0,35,0,3,0,0,0,2,
+0,72,1,2,0,0,0,1,0,0,0,35,0,3,0,0,0,2,0,54,0,156,0,0,0,1,0,0,0,35,0,3,0,0,
+0,2,0,36,0,114,0,0,0,1,0,0,0,35,0,3,0,0,0,2,0,18,0,24,0,0,0,1,0,0,0,35,0,
+1,0,1,0,185,0,1,0,1,0,190,0,3,0,0,0,2,0,114,0,18,0,0,0,1,0,0,0,35,0,1,0,1,
+0,179,0,3,0,0,0,2,0,90,0,18,0,0,0,1,0,0,0,35,0,1,0,1,0,182,0,3,0,0,0,2,0,
+66,0,18,0,0,0,1,0,0,0,35,0,1,0,1,0,180,0,3,0,0,0,2,0,42,0,18,0,0,0,1,0,0,
+0,35,0,1,0,1,0,183,0,3,0,0,0,2,0,18,0,24,0,0,0,1,0,0,0,35,0,1,0,1,0,188,0,
+1,0,1,0,186,0,3,0,0,0,2,0,42,0,18,0,0,0,1,0,0,0,35,0,1,0,1,0,184,0,3,0,0,
+0,2,0,18,0,24,0,0,0,1,0,0,0,35,0,1,0,1,0,189,0,1,0,1,0,181,0,1,0,9,0,1,0,
+8,0,1,0,20,0,3,0,1,0,9,0,1,0,8,0,1,0,6,0,2,0,1,0,22,0,14,0,18,0,22,0,36,0,
+40,0,44,0,48,0,53,0,57,0,61,0,65,0,69,0,73,0,77,0,81,0,85,0,91,0,97,0,103,
+0,107,0,115,0,119,0,1,0,9,0,1,0,8,0,1,0,184,0,4,0,1,0,9,0,1,0,8,0,2,0,72,
+0,33,0,11,0,15,0,19,0,23,0,27,0,29,0,31,0,33,0,35,0,37,0,41,0,45,0,49,0,54,
+0,58,0,62,0,66,0,70,0,74,0,78,0,82,0,86,0,90,0,92,0,96,0,98,0,102,0,104,0,
+108,0,112,0,114,0,116,0,120,0,1,0,33,0,8,0,14,0,18,0,22,0,26,0,28,0,30,0,
+32,0,34,0,36,0,40,0,44,0,48,0,53,0,57,0,61,0,65,0,69,0,73,0,77,0,81,0,85,
+0,89,0,91,0,95,0,97,0,101,0,103,0,107,0,111,0,113,0,115,0,119,0,1,0,9,0,1,
+0,8,0,1,0,20,0,2,0,1,0,9,0,1,0,8,0,1,0,6,0,1,0,1,0,1,0,8,0,4,0,1,0,1,0,8,
+0,1,0,30,0,2,0,10,0,20,0,1,0,4,0,247,0,2,0,170,0,1,0,4,0,248,0,2,0,170,0,
+1,0,2,0,95,0,96,0,2,0,9,0,1,0,8,0,1,1,20,0,135,1,120,1,128,1,136,1,144,1,
+152,1,160,1,168,1,176,1,184,1,192,1,200,1,208,1,216,1,224,1,232,1,240,1,248,
+2,0,2,8,2,16,2,24,2,32,2,40,2,48,2,56,2,64,2,72,2,80,2,88,2,96,2,104,2,112,
+2,120,2,128,2,136,2,144,2,152,2,160,2,168,2,176,2,184,2,192,2,200,2,208,2,
+216,2,224,2,232,2,240,2,248,3,0,3,8,3,16,3,24,3,32,3,40,3,48,3,56,3,64,3,
+72,3,80,3,88,3,96,3,104,3,112,3,120,3,128,3,136,3,144,3,152,3,160,3,168,3,
+176,3,184,3,192,3,200,3,208,3,216,3,224,3,232,3,240,3,248,4,0,4,8,4,16,4,
+24,4,32,4,40,4,48,4,56,4,64,4,72,4,80,4,88,4,96,4,104,4,112,4,120,4,128,4,
+136,4,144,4,152,4,160,4,168,4,176,4,184,4,192,4,200,4,208,4,216,4,224,4,232,
+4,240,4,248,5,0,5,8,5,16,5,24,5,32,5,40,5,48,5,56,5,64,5,72,5,80,5,88,5,96,
+5,104,5,112,5,120,5,128,5,136,5,144,5,152,5,160,5,168,0,2,0,16,0,8,0,12,0,
+0,0,14,0,17,0,5,0,19,0,21,0,9,0,23,0,39,0,12,0,42,0,43,0,29,0,46,0,51,0,31,
+0,53,0,106,0,37,0,108,0,124,0,91,0,247,0,248,0,108,0,250,0,250,0,110,0,252,
+0,252,0,111,0,254,0,254,0,112,1,0,1,0,0,113,1,2,1,2,0,114,1,4,1,4,0,115,1,
+9,1,27,0,116,0,3,1,46,0,8,1,48,0,3,1,46,0,9,1,48,0,3,1,46,0,10,1,48,0,3,1,
+46,0,11,1,48,0,3,1,46,0,12,1,48,0,3,1,46,0,14,1,48,0,3,1,46,0,15,1,48,0,3,
+1,46,0,16,1,48,0,3,1,46,0,17,1,48,0,3,1,46,0,19,1,48,0,3,1,46,0,20,1,47,0,
+3,1,46,0,21,1,48,0,3,1,46,0,23,1,48,0,3,1,46,0,24,1,47,0,3,1,46,0,25,1,48,
+0,3,1,46,0,26,1,47,0,3,1,46,0,27,1,47,0,3,1,46,0,28,1,47,0,3,1,46,0,29,1,
+47,0,3,1,46,0,30,1,48,0,3,1,46,0,31,1,48,0,3,1,46,0,32,1,48,0,3,1,46,0,33,
+1,48,0,3,1,45,0,34,1,47,0,3,1,45,0,35,1,47,0,3,1,46,0,36,1,48,0,3,1,46,0,
+37,1,48,0,3,1,46,0,38,1,47,0,3,1,46,0,39,1,47,0,3,1,46,0,42,1,48,0,3,1,46,
+0,43,1,48,0,3,1,46,0,46,1,48,0,3,1,46,0,47,1,48,0,3,1,45,0,48,1,47,0,3,1,
+45,0,49,1,47,0,3,1,45,0,50,1,47,0,3,1,45,0,51,1,47,0,3,1,46,0,53,1,48,0,3,
+1,46,0,54,1,48,0,3,1,46,0,55,1,48,0,3,1,46,0,56,1,48,0,3,1,46,0,57,1,48,0,
+3,1,46,0,58,1,48,0,3,1,45,0,59,1,47,0,3,1,45,0,60,1,47,0,3,1,46,0,61,1,48,
+0,3,1,46,0,62,1,48,0,3,1,46,0,63,1,48,0,3,1,46,0,64,1,48,0,3,1,46,0,65,1,
+48,0,3,1,45,0,66,1,47,0,3,1,45,0,67,1,47,0,3,1,45,0,68,1,47,0,3,1,46,0,69,
+1,48,0,3,1,46,0,70,1,48,0,3,1,46,0,71,1,48,0,3,1,46,0,72,1,48,0,3,1,46,0,
+73,1,48,0,3,1,46,0,74,1,48,0,3,1,46,0,75,1,48,0,3,1,46,0,76,1,48,0,3,1,46,
+0,77,1,48,0,3,1,46,0,78,1,48,0,3,1,46,0,79,1,47,0,3,1,46,0,80,1,48,0,3,1,
+46,0,81,1,48,0,3,1,46,0,82,1,48,0,3,1,46,0,83,1,48,0,3,1,46,0,84,1,48,0,3,
+1,46,0,85,1,48,0,3,1,46,0,86,1,48,0,3,1,46,0,87,1,47,0,3,1,46,0,88,1,48,0,
+3,1,46,0,89,1,43,0,3,1,46,0,90,1,43,0,3,1,46,0,91,1,48,0,3,1,46,0,92,1,48,
+0,3,1,46,0,93,1,48,0,3,1,46,0,94,1,48,0,3,1,46,0,95,1,47,0,3,1,46,0,96,1,
+47,0,3,1,46,0,97,1,48,0,3,1,46,0,98,1,48,0,3,1,46,0,99,1,47,0,3,1,46,0,100,
+1,48,0,3,1,46,0,101,1,48,0,3,1,46,0,102,1,48,0,3,1,46,0,103,1,48,0,3,1,46,
+0,104,1,48,0,3,1,46,0,105,1,48,0,3,1,46,0,106,1,48,0,3,1,46,0,108,1,48,0,
+3,1,46,0,109,1,47,0,3,1,46,0,110,1,48,0,3,1,46,0,111,1,47,0,3,1,46,0,112,
+1,47,0,3,1,46,0,113,1,47,0,3,1,46,0,114,1,47,0,3,1,46,0,115,1,48,0,3,1,46,
+0,116,1,48,0,3,1,46,0,117,1,48,0,3,1,46,0,118,1,48,0,3,1,46,0,119,1,48,0,
+3,1,46,0,120,1,48,0,3,1,45,0,121,1,47,0,3,1,45,0,122,1,47,0,3,1,46,0,123,
+1,47,0,3,1,45,0,124,1,47,0,3,1,46,0,247,1,47,0,3,1,46,0,248,1,47,0,3,1,46,
+0,250,1,48,0,3,1,46,0,252,1,48,0,3,1,46,0,254,1,48,0,3,1,46,1,0,1,48,0,3,
+1,46,1,2,1,48,0,3,1,46,1,4,1,48,0,3,1,46,1,9,1,48,0,3,1,46,1,10,1,48,0,3,
+1,46,1,11,1,48,0,3,1,46,1,12,1,48,0,3,1,46,1,13,1,48,0,3,1,46,1,14,1,48,0,
+3,1,46,1,15,1,48,0,3,1,46,1,16,1,48,0,3,1,46,1,17,1,48,0,3,1,46,1,18,1,48,
+0,3,1,45,1,19,1,47,0,3,1,45,1,20,1,47,0,3,1,45,1,21,1,47,0,3,1,45,1,22,1,
+47,0,3,1,45,1,23,1,47,0,3,1,45,1,24,1,47,0,3,1,46,1,25,1,47,0,3,1,45,1,26,
+1,47,0,3,1,45,1,27,1,47,0,2,0,9,0,1,0,8,0,1,18,150,0,153,1,56,1,64,1,72,1,
+80,1,88,1,96,1,104,1,112,1,120,1,128,1,136,1,144,1,152,1,160,1,168,1,176,
+1,184,1,192,1,200,1,208,1,216,1,224,1,232,1,240,1,248,2,0,2,8,2,16,2,24,2,
+32,2,40,2,48,2,56,2,64,2,72,2,80,2,88,2,96,2,104,2,112,2,120,2,128,2,136,
+2,144,2,152,2,160,2,168,2,176,2,184,2,192,2,200,2,208,2,216,2,224,2,232,2,
+240,2,248,3,0,3,8,3,16,3,24,3,32,3,40,3,48,3,56,3,64,3,72,3,80,3,88,3,96,
+3,104,3,112,3,120,3,128,3,136,3,144,3,152,3,160,3,168,3,176,3,184,3,192,3,
+200,3,208,3,216,3,224,3,232,3,240,3,248,4,0,4,8,4,16,4,24,4,32,4,40,4,48,
+4,56,4,64,4,72,4,80,4,88,4,96,4,104,4,112,4,120,4,128,4,136,4,144,4,152,4,
+160,4,168,4,176,4,184,4,192,4,200,4,208,4,216,4,224,4,232,4,240,4,248,5,0,
+5,8,5,16,5,24,5,32,5,40,5,48,5,56,5,64,5,72,5,80,5,88,5,96,5,104,5,112,5,
+120,5,128,5,136,5,144,5,152,5,160,5,168,5,176,5,184,5,192,5,200,5,208,5,216,
+5,224,5,232,5,240,5,248,0,3,1,41,0,8,1,48,0,3,1,41,0,9,1,48,0,3,1,41,0,10,
+1,48,0,3,1,41,0,11,1,48,0,3,1,41,0,12,1,48,0,3,1,41,0,14,1,48,0,3,1,41,0,
+15,1,48,0,3,1,41,0,16,1,48,0,3,1,41,0,17,1,48,0,3,1,41,0,18,1,49,0,3,1,41,
+0,19,1,48,0,3,1,41,0,20,1,47,0,3,1,41,0,21,1,48,0,3,1,41,0,22,1,49,0,3,1,
+41,0,23,1,48,0,3,1,41,0,24,1,47,0,3,1,41,0,25,1,48,0,3,1,41,0,26,1,47,0,3,
+1,41,0,27,1,47,0,3,1,41,0,28,1,47,0,3,1,41,0,29,1,47,0,3,1,41,0,30,1,48,0,
+3,1,41,0,31,1,48,0,3,1,41,0,32,1,48,0,3,1,41,0,33,1,48,0,3,1,40,0,34,1,47,
+0,3,1,40,0,35,1,47,0,3,1,41,0,36,1,48,0,3,1,41,0,37,1,48,0,3,1,41,0,38,1,
+47,0,3,1,41,0,39,1,47,0,3,1,41,0,40,1,49,0,3,1,41,0,41,1,49,0,3,1,41,0,42,
+1,48,0,3,1,41,0,43,1,48,0,3,1,41,0,44,1,49,0,3,1,41,0,45,1,49,0,3,1,41,0,
+46,1,48,0,3,1,41,0,47,1,48,0,3,1,40,0,48,1,47,0,3,1,40,0,49,1,47,0,3,1,40,
+0,50,1,47,0,3,1,40,0,51,1,47,0,3,1,41,0,52,1,49,0,3,1,41,0,53,1,48,0,3,1,
+41,0,54,1,48,0,3,1,41,0,55,1,48,0,3,1,41,0,56,1,48,0,3,1,41,0,57,1,48,0,3,
+1,41,0,58,1,48,0,3,1,40,0,59,1,47,0,3,1,40,0,60,1,47,0,3,1,41,0,61,1,48,0,
+3,1,41,0,62,1,48,0,3,1,41,0,63,1,48,0,3,1,41,0,64,1,48,0,3,1,41,0,65,1,48,
+0,3,1,40,0,66,1,47,0,3,1,40,0,67,1,47,0,3,1,40,0,68,1,47,0,3,1,41,0,69,1,
+48,0,3,1,41,0,70,1,48,0,3,1,41,0,71,1,48,0,3,1,41,0,72,1,48,0,3,1,41,0,73,
+1,48,0,3,1,41,0,74,1,48,0,3,1,41,0,75,1,48,0,3,1,41,0,76,1,48,0,3,1,41,0,
+77,1,48,0,3,1,41,0,78,1,48,0,3,1,41,0,79,1,47,0,3,1,41,0,80,1,48,0,3,1,41,
+0,81,1,48,0,3,1,41,0,82,1,48,0,3,1,41,0,83,1,48,0,3,1,41,0,84,1,48,0,3,1,
+41,0,85,1,48,0,3,1,41,0,86,1,48,0,3,1,41,0,87,1,47,0,3,1,41,0,88,1,48,0,3,
+1,41,0,89,1,43,0,3,1,41,0,90,1,43,0,3,1,41,0,91,1,48,0,3,1,41,0,92,1,48,0,
+3,1,41,0,93,1,48,0,3,1,41,0,94,1,48,0,3,1,41,0,95,1,47,0,3,1,41,0,96,1,47,
+0,3,1,41,0,97,1,48,0,3,1,41,0,98,1,48,0,3,1,41,0,99,1,47,0,3,1,41,0,100,1,
+48,0,3,1,41,0,101,1,48,0,3,1,41,0,102,1,48,0,3,1,41,0,103,1,48,0,3,1,41,0,
+104,1,48,0,3,1,41,0,105,1,48,0,3,1,41,0,106,1,48,0,3,1,41,0,107,1,49,0,3,
+1,41,0,108,1,48,0,3,1,41,0,109,1,47,0,3,1,41,0,110,1,48,0,3,1,41,0,111,1,
+47,0,3,1,41,0,112,1,47,0,3,1,41,0,113,1,47,0,3,1,41,0,114,1,47,0,3,1,41,0,
+115,1,48,0,3,1,41,0,116,1,48,0,3,1,41,0,117,1,48,0,3,1,41,0,118,1,48,0,3,
+1,41,0,119,1,48,0,3,1,41,0,120,1,48,0,3,1,40,0,121,1,47,0,3,1,40,0,122,1,
+47,0,3,1,41,0,123,1,47,0,3,1,40,0,124,1,47,0,3,1,41,0,247,1,47,0,3,1,41,0,
+248,1,47,0,3,1,41,0,249,1,49,0,3,1,41,0,250,1,48,0,3,1,41,0,251,1,49,0,3,
+1,41,0,252,1,48,0,3,1,41,0,253,1,49,0,3,1,41,0,254,1,48,0,3,1,41,0,255,1,
+49,0,3,1,41,1,0,1,48,0,3,1,41,1,1,1,49,0,3,1,41,1,2,1,48,0,3,1,41,1,3,1,49,
+0,3,1,41,1,4,1,48,0,3,1,41,1,5,1,49,0,3,1,41,1,6,1,49,0,3,1,41,1,7,1,49,0,
+3,1,41,1,8,1,49,0,3,1,41,1,9,1,48,0,3,1,41,1,10,1,48,0,3,1,41,1,11,1,48,0,
+3,1,41,1,12,1,48,0,3,1,41,1,13,1,48,0,3,1,41,1,14,1,48,0,3,1,41,1,15,1,48,
+0,3,1,41,1,16,1,48,0,3,1,41,1,17,1,48,0,3,1,41,1,18,1,48,0,3,1,40,1,19,1,
+47,0,3,1,40,1,20,1,47,0,3,1,40,1,21,1,47,0,3,1,40,1,22,1,47,0,3,1,40,1,23,
+1,47,0,3,1,40,1,24,1,47,0,3,1,41,1,25,1,47,0,3,1,40,1,26,1,47,0,3,1,40,1,
+27,1,47,0,6,0,9,0,1,0,8,0,3,0,0,0,1,0,18,0,1,0,34,0,1,0,0,0,36,0,1,0,6,0,
+20,0,21,0,24,0,25,0,109,0,110,0,1,0,6,0,19,0,20,0,23,0,24,0,108,0,109,0,6,
+0,9,0,1,0,8,0,3,0,1,0,18,0,1,0,28,0,0,0,1,0,0,0,36,0,1,0,3,1,13,1,15,1,17,
+0,1,0,3,0,20,0,24,0,109,0,6,0,9,0,12,0,30,0,48,0,72,0,90,0,114,0,132,0,156,
+0,174,0,198,0,216,0,240,1,8,0,3,0,0,0,1,0,36,0,1,0,228,0,1,0,0,0,36,0,3,0,
+0,0,1,0,18,0,1,0,240,0,1,0,0,0,36,0,1,0,1,0,60,0,3,0,0,0,1,0,36,0,1,0,186,
+0,1,0,0,0,36,0,3,0,0,0,1,0,18,0,1,0,198,0,1,0,0,0,36,0,1,0,1,0,59,0,3,0,0,
+0,1,0,36,0,1,0,144,0,1,0,0,0,36,0,3,0,0,0,1,0,18,0,1,0,156,0,1,0,0,0,36,0,
+1,0,1,0,43,0,3,0,0,0,1,0,36,0,1,0,102,0,1,0,0,0,36,0,3,0,0,0,1,0,18,0,1,0,
+114,0,1,0,0,0,36,0,1,0,1,0,42,0,3,0,0,0,1,0,36,0,1,0,60,0,1,0,0,0,36,0,3,
+0,0,0,1,0,18,0,1,0,72,0,1,0,0,0,36,0,1,0,1,0,47,0,3,0,0,0,1,0,42,0,1,0,18,
+0,1,0,0,0,36,0,1,0,1,0,117,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,36,0,1,0,1,
+0,46,0,1,0,1,0,116,0,6,0,9,0,1,0,8,0,3,0,0,0,1,0,18,0,1,0,30,0,1,0,0,0,36,
+0,1,0,4,0,42,0,43,0,46,0,47,0,1,0,9,0,19,0,20,0,23,0,24,0,108,0,109,1,13,
+1,15,1,17,0,6,0,9,0,4,0,14,0,32,0,114,0,132,0,3,0,1,0,36,0,1,0,210,0,0,0,
+1,0,0,0,36,0,3,0,1,0,18,0,1,0,250,0,0,0,1,0,0,0,36,0,1,0,30,0,16,0,17,0,20,
+0,21,0,24,0,25,0,63,0,64,0,67,0,68,0,83,0,84,0,99,0,100,0,105,0,106,0,109,
+0,110,0,250,0,252,0,254,1,0,1,2,1,4,1,13,1,14,1,15,1,16,1,17,1,18,0,3,0,1,
+0,36,0,1,0,110,0,0,0,1,0,0,0,37,0,3,0,1,0,18,0,1,0,150,0,0,0,1,0,0,0,37,0,
+1,0,8,0,42,0,43,0,46,0,47,0,59,0,60,0,121,0,122,0,6,1,1,0,4,0,14,0,34,0,60,
+0,86,0,3,0,2,9,18,0,66,0,1,0,40,0,0,0,1,0,0,0,38,0,3,0,2,8,254,0,72,0,1,0,
+20,0,0,0,1,0,0,0,38,0,1,0,1,0,11,0,3,0,2,8,228,0,20,0,1,0,52,0,0,0,1,0,0,
+0,38,0,1,0,1,0,51,0,3,0,2,8,202,0,20,0,1,0,26,0,0,0,1,0,0,0,38,0,1,0,1,0,
+50,0,1,0,1,0,12,0,6,0,9,0,1,0,8,0,3,0,1,0,18,0,1,0,58,0,0,0,1,0,0,0,38,0,
+1,0,18,0,20,0,21,0,24,0,25,0,109,0,110,0,250,0,252,0,254,1,0,1,2,1,4,1,13,
+1,14,1,15,1,16,1,17,1,18,0,1,0,1,0,66,0,6,0,1,0,18,0,42,0,70,0,96,0,120,0,
+146,0,170,0,192,0,216,0,238,1,2,1,30,1,56,1,80,1,106,1,130,1,152,1,176,1,
+244,0,3,0,0,0,1,1,222,0,6,1,156,1,156,2,12,1,156,1,156,2,60,0,1,0,0,0,38,
+0,3,0,0,0,1,1,194,0,5,1,128,1,128,1,240,1,128,2,32,0,1,0,0,0,38,0,3,0,0,0,
+1,1,168,0,4,1,102,1,102,1,214,2,6,0,1,0,0,0,38,0,3,0,0,0,1,1,144,0,5,1,78,
+1,190,1,78,1,78,1,238,0,1,0,0,0,38,0,3,0,0,0,1,1,118,0,4,1,52,1,164,1,52,
+1,212,0,1,0,0,0,38,0,3,0,0,0,1,1,94,0,3,1,28,1,140,1,188,0,1,0,0,0,38,0,3,
+0,0,0,1,1,72,0,4,1,118,1,6,1,6,1,166,0,1,0,0,0,38,0,3,0,0,0,1,1,48,0,3,1,
+94,0,238,1,142,0,1,0,0,0,38,0,3,0,0,0,1,1,26,0,2,1,72,1,120,0,1,0,0,0,38,
+0,3,0,0,0,1,1,6,0,6,0,196,0,196,1,94,0,196,0,196,1,100,0,1,0,0,0,38,0,3,0,
+0,0,1,0,234,0,5,0,168,0,168,1,66,0,168,1,72,0,1,0,0,0,38,0,3,0,0,0,1,0,208,
+0,4,0,142,0,142,1,40,1,46,0,1,0,0,0,38,0,3,0,0,0,1,0,184,0,5,0,118,1,16,0,
+118,0,118,1,22,0,1,0,0,0,38,0,3,0,0,0,1,0,158,0,4,0,92,0,246,0,92,0,252,0,
+1,0,0,0,38,0,3,0,0,0,1,0,134,0,3,0,68,0,222,0,228,0,1,0,0,0,38,0,3,0,0,0,
+1,0,112,0,4,0,200,0,46,0,46,0,206,0,1,0,0,0,38,0,3,0,0,0,1,0,88,0,3,0,176,
+0,22,0,182,0,1,0,0,0,38,0,2,0,7,0,13,0,13,0,0,0,140,0,141,0,1,0,143,0,156,
+0,3,0,159,0,170,0,17,0,172,0,173,0,29,0,175,0,204,0,31,1,28,1,29,0,61,0,3,
+0,0,0,1,0,20,0,2,0,108,0,114,0,1,0,0,0,38,0,1,0,6,0,50,0,51,0,67,0,68,0,121,
+0,122,0,6,2,1,0,2,0,10,0,36,0,3,0,0,0,1,0,46,0,2,0,20,0,68,0,1,0,0,0,38,0,
+1,0,1,0,27,0,3,0,0,0,1,0,20,0,2,0,36,0,42,0,1,0,0,0,38,0,1,0,6,0,42,0,43,
+0,46,0,47,0,59,0,60,0,1,0,1,0,29,0,1,0,1,0,171,0,6,3,1,0,12,0,30,0,52,0,74,
+0,96,0,118,0,140,0,162,0,182,0,202,0,222,0,242,1,6,0,3,0,3,6,86,6,86,0,252,
+0,1,1,222,0,0,0,1,0,0,0,38,0,3,0,3,6,64,6,64,0,230,0,1,1,226,0,0,0,1,0,0,
+0,38,0,3,0,3,6,42,6,42,0,208,0,1,1,230,0,0,0,1,0,0,0,38,0,3,0,3,6,20,6,20,
+0,186,0,1,1,234,0,0,0,1,0,0,0,38,0,3,0,3,5,254,5,254,0,164,0,1,1,238,0,0,
+0,1,0,0,0,38,0,3,0,3,5,232,5,232,0,142,0,1,1,242,0,0,0,1,0,0,0,38,0,3,0,2,
+5,210,0,120,0,1,1,90,0,0,0,1,0,0,0,38,0,3,0,2,5,190,0,100,0,1,1,96,0,0,0,
+1,0,0,0,38,0,3,0,2,5,170,0,80,0,1,1,102,0,0,0,1,0,0,0,38,0,3,0,2,5,150,0,
+60,0,1,1,108,0,0,0,1,0,0,0,38,0,3,0,2,5,130,0,40,0,1,1,114,0,0,0,1,0,0,0,
+38,0,3,0,2,5,110,0,20,0,1,1,120,0,0,0,1,0,0,0,38,0,1,0,20,0,16,0,17,0,38,
+0,39,0,55,0,56,0,79,0,80,0,83,0,84,0,87,0,88,0,93,0,94,0,99,0,100,0,105,0,
+106,0,117,0,118,0,6,3,1,0,12,0,30,0,52,0,74,0,96,0,118,0,140,0,162,0,188,
+0,214,0,240,1,10,1,36,0,3,0,3,5,16,5,16,4,252,0,1,0,152,0,0,0,1,0,0,0,39,
+0,3,0,3,4,250,4,250,4,230,0,1,0,156,0,0,0,1,0,0,0,39,0,3,0,3,4,228,4,228,
+4,208,0,1,0,160,0,0,0,1,0,0,0,39,0,3,0,3,4,206,4,206,4,186,0,1,0,164,0,0,
+0,1,0,0,0,39,0,3,0,3,4,184,4,184,4,164,0,1,0,168,0,0,0,1,0,0,0,39,0,3,0,3,
+4,162,4,162,4,142,0,1,0,172,0,0,0,1,0,0,0,39,0,3,0,2,4,140,4,120,0,1,0,20,
+0,0,0,1,0,0,0,39,0,1,0,1,0,19,0,3,0,2,4,114,4,94,0,1,0,20,0,0,0,1,0,0,0,39,
+0,1,0,1,0,20,0,3,0,2,4,88,4,68,0,1,0,20,0,0,0,1,0,0,0,39,0,1,0,1,0,23,0,3,
+0,2,4,62,4,42,0,1,0,20,0,0,0,1,0,0,0,39,0,1,0,1,0,24,0,3,0,2,4,36,4,16,0,
+1,0,20,0,0,0,1,0,0,0,39,0,1,0,1,0,108,0,3,0,2,4,10,3,246,0,1,0,20,0,0,0,1,
+0,0,0,39,0,1,0,1,0,109,0,6,3,1,0,1,0,8,0,3,0,0,0,1,3,212,0,3,3,232,0,22,3,
+232,0,1,0,0,0,39,0,1,0,1,0,35,0,6,3,1,0,2,0,10,0,54,0,3,0,0,0,1,3,174,0,3,
+3,194,0,22,3,194,0,1,0,0,0,39,0,1,0,9,0,35,0,41,0,42,0,45,0,46,0,54,0,66,
+1,9,1,11,0,3,0,0,0,1,3,130,0,2,3,150,0,20,0,1,0,0,0,39,0,1,0,8,0,41,0,42,
+0,45,0,46,0,54,0,66,1,9,1,11,0,6,0,1,0,27,0,60,0,88,0,116,0,142,0,170,0,198,
+0,224,0,252,1,24,1,50,1,78,1,106,1,132,1,160,1,188,1,214,1,242,2,14,2,40,
+2,66,2,92,2,116,2,142,2,168,2,192,2,216,3,68,0,3,0,0,0,1,3,30,0,6,2,180,3,
+50,3,96,2,180,3,50,3,106,0,1,0,0,0,39,0,3,0,0,0,1,3,2,0,6,3,22,2,152,3,68,
+2,152,3,22,3,78,0,1,0,0,0,39,0,3,0,0,0,1,2,230,0,5,2,250,3,40,2,124,2,250,
+3,50,0,1,0,0,0,39,0,3,0,0,0,1,2,204,0,6,2,98,2,224,3,14,2,98,2,98,3,24,0,
+1,0,0,0,39,0,3,0,0,0,1,2,176,0,6,2,196,2,70,2,242,2,70,2,70,2,252,0,1,0,0,
+0,39,0,3,0,0,0,1,2,148,0,5,2,168,2,214,2,42,2,42,2,224,0,1,0,0,0,39,0,3,0,
+0,0,1,2,122,0,6,2,16,2,142,2,188,2,142,2,16,2,198,0,1,0,0,0,39,0,3,0,0,0,
+1,2,94,0,6,2,114,1,244,2,160,2,114,1,244,2,170,0,1,0,0,0,39,0,3,0,0,0,1,2,
+66,0,5,2,86,2,132,2,86,1,216,2,142,0,1,0,0,0,39,0,3,0,0,0,1,2,40,0,6,1,190,
+2,60,2,106,1,190,2,116,2,60,0,1,0,0,0,39,0,3,0,0,0,1,2,12,0,6,2,32,1,162,
+2,78,1,162,2,88,2,32,0,1,0,0,0,39,0,3,0,0,0,1,1,240,0,5,2,4,2,50,1,134,2,
+60,2,4,0,1,0,0,0,39,0,3,0,0,0,1,1,214,0,6,1,108,1,234,2,24,1,108,2,34,1,108,
+0,1,0,0,0,39,0,3,0,0,0,1,1,186,0,6,1,206,1,80,1,252,1,80,2,6,1,80,0,1,0,0,
+0,39,0,3,0,0,0,1,1,158,0,5,1,178,1,224,1,52,1,234,1,52,0,1,0,0,0,39,0,3,0,
+0,0,1,1,132,0,6,1,26,1,152,1,198,1,152,1,208,1,26,0,1,0,0,0,39,0,3,0,0,0,
+1,1,104,0,6,1,124,0,254,1,170,1,124,1,180,0,254,0,1,0,0,0,39,0,3,0,0,0,1,
+1,76,0,5,1,96,1,142,1,96,1,152,0,226,0,1,0,0,0,39,0,3,0,0,0,1,1,50,0,5,0,
+200,1,70,1,116,0,200,1,126,0,1,0,0,0,39,0,3,0,0,0,1,1,24,0,5,1,44,0,174,1,
+90,0,174,1,100,0,1,0,0,0,39,0,3,0,0,0,1,0,254,0,4,1,18,1,64,0,148,1,74,0,
+1,0,0,0,39,0,3,0,0,0,1,0,230,0,5,0,124,0,250,1,40,0,250,1,50,0,1,0,0,0,39,
+0,3,0,0,0,1,0,204,0,5,0,224,0,98,1,14,0,224,1,24,0,1,0,0,0,39,0,3,0,0,0,1,
+0,178,0,4,0,198,0,244,0,198,0,254,0,1,0,0,0,39,0,3,0,0,0,1,0,154,0,4,0,48,
+0,174,0,220,0,230,0,1,0,0,0,39,0,3,0,0,0,1,0,130,0,4,0,150,0,24,0,196,0,206,
+0,1,0,0,0,39,0,1,0,40,0,13,0,140,0,143,0,145,0,146,0,150,0,153,0,155,0,156,
+0,159,0,161,0,163,0,165,0,166,0,167,0,168,0,169,0,170,0,179,0,180,0,182,0,
+183,0,185,0,186,0,187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,
+0,198,0,199,0,200,0,201,0,202,1,28,0,3,0,0,0,1,0,22,0,3,0,42,0,88,0,98,0,
+1,0,0,0,39,0,1,0,8,0,50,0,51,0,59,0,60,0,67,0,68,0,121,0,122,0,1,0,21,0,141,
+0,144,0,147,0,148,0,149,0,151,0,152,0,154,0,160,0,162,0,164,0,172,0,173,0,
+175,0,176,0,177,0,178,0,181,0,184,0,189,1,29,0,1,0,3,0,27,0,29,0,102,0,1,
+0,2,0,158,0,174,0,6,4,1,0,1,0,8,0,3,0,1,0,108,0,1,0,60,0,0,0,1,0,0,0,11,0,
+6,4,1,0,1,0,8,0,3,0,1,0,18,0,1,0,34,0,0,0,1,0,0,0,12,0,1,0,6,1,42,1,43,1,
+44,1,47,1,48,1,49,0,2,0,3,0,8,0,12,0,0,0,14,0,124,0,5,0,247,1,27,0,116,0,
+6,4,1,0,1,0,8,0,3,0,0,0,1,0,18,0,1,0,108,0,1,0,0,0,39,0,1,0,1,0,139,0,6,4,
+1,0,3,0,12,0,36,0,60,0,3,0,0,0,1,0,18,0,1,0,72,0,1,0,0,0,39,0,1,0,1,1,47,
+0,3,0,0,0,1,0,18,0,1,0,48,0,1,0,0,0,39,0,1,0,1,1,48,0,3,0,0,0,1,0,18,0,1,
+0,24,0,1,0,0,0,39,0,1,0,1,1,49,0,1,0,4,1,40,1,41,1,45,1,46,0,1,0,0,0,1,0,
+8,0,1,0,6,0,4,0,1,0,2,0,69,0,70,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,171,0,174,
+0,1,0,2,0,157,0,158,0,1,0,0,0,1,0,8,0,1,0,6,0,6,0,1,0,2,0,225,0,226,0,1,0,
+0,0,1,0,8,0,2,0,18,0,6,0,73,0,74,0,171,0,174,0,231,0,232,0,1,0,6,0,69,0,70,
+0,157,0,158,0,225,0,226,0,4,0,1,0,1,0,8,0,1,1,18,0,11,0,28,0,46,0,64,0,82,
+0,100,0,118,0,136,0,194,0,204,0,246,1,8,0,2,0,6,0,12,0,193,0,2,0,185,0,198,
+0,2,0,188,0,2,0,6,0,12,0,191,0,2,0,185,0,200,0,2,0,188,0,2,0,6,0,12,0,192,
+0,2,0,185,0,204,0,2,0,189,0,2,0,6,0,12,0,194,0,2,0,185,0,199,0,2,0,188,0,
+2,0,6,0,12,0,195,0,2,0,185,0,201,0,2,0,188,0,2,0,6,0,12,0,196,0,2,0,185,0,
+203,0,2,0,189,0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,0,193,0,2,0,179,0,191,
+0,2,0,180,0,192,0,2,0,181,0,194,0,2,0,182,0,195,0,2,0,183,0,196,0,2,0,184,
+0,197,0,2,0,190,0,1,0,4,0,202,0,2,0,188,0,5,0,12,0,18,0,24,0,30,0,36,0,198,
+0,2,0,179,0,200,0,2,0,180,0,199,0,2,0,182,0,201,0,2,0,183,0,202,0,2,0,186,
+0,2,0,6,0,12,0,204,0,2,0,181,0,203,0,2,0,184,0,1,0,4,0,197,0,2,0,185,0,2,
+0,2,0,179,0,186,0,0,0,188,0,190,0,8,0,1,0,9,0,1,0,8,0,2,0,34,0,14,1,6,1,8,
+1,13,1,14,1,15,1,16,1,9,1,10,1,11,1,12,1,19,1,20,1,17,1,18,0,1,0,14,0,11,
+0,12,0,20,0,21,0,24,0,25,0,42,0,43,0,46,0,47,0,59,0,60,0,109,0,110,0,1,0,
+9,0,1,0,8,0,2,0,10,0,2,1,5,1,7,0,1,0,2,0,11,0,12,0,1,1,1,0,1,0,8,0,2,0,48,
+0,21,1,6,1,8,0,249,0,250,0,251,0,252,1,9,1,10,1,11,1,12,1,24,1,23,1,19,1,
+20,1,27,1,22,1,21,0,253,0,254,1,25,1,26,0,1,0,21,0,11,0,12,0,19,0,20,0,23,
+0,24,0,42,0,43,0,46,0,47,0,50,0,51,0,59,0,60,0,66,0,67,0,68,0,108,0,109,0,
+121,0,122,0,1,3,1,0,1,0,8,0,2,0,42,0,18,0,255,1,0,1,1,1,2,1,24,1,23,1,19,
+1,20,1,22,1,21,1,3,1,4,1,25,1,26,1,39,1,42,1,43,1,44,0,1,0,18,0,19,0,20,0,
+23,0,24,0,50,0,51,0,59,0,60,0,67,0,68,0,108,0,109,0,121,0,122,0,139,1,47,
+1,48,1,49,0,0,};
+#endif
@@ -0,0 +1,1960 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansSyriacWestern_Regular_ttf_size = 52380;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansSyriacWestern_Regular_ttf");
+asm(".type fz_font_NotoSansSyriacWestern_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansSyriacWestern_Regular_ttf, 52380");
+asm(".balign 64");
+asm("fz_font_NotoSansSyriacWestern_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansSyriacWestern-Regular.ttf\"");
+#else
+const int fz_font_NotoSansSyriacWestern_Regular_ttf_size = 52380;
+const char fz_font_NotoSansSyriacWestern_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,26,131,26,125,0,0,102,76,0,0,1,16,
+71,80,79,83,224,160,144,201,0,0,103,92,0,0,46,240,71,83,85,66,252,213,225,
+103,0,0,150,76,0,0,54,78,79,83,47,50,118,28,93,55,0,0,1,104,0,0,0,96,99,109,
+97,112,180,95,189,52,0,0,6,152,0,0,1,180,103,97,115,112,0,7,0,7,0,0,102,64,
+0,0,0,12,103,108,121,102,53,187,5,127,0,0,10,192,0,0,85,46,104,101,97,100,
+6,206,207,0,0,0,0,236,0,0,0,54,104,104,101,97,12,228,255,132,0,0,1,36,0,0,
+0,36,104,109,116,120,187,65,228,182,0,0,1,200,0,0,4,206,108,111,99,97,26,
+68,47,64,0,0,8,76,0,0,2,116,109,97,120,112,1,79,0,203,0,0,1,72,0,0,0,32,110,
+97,109,101,146,194,189,67,0,0,95,240,0,0,6,46,112,111,115,116,255,105,0,102,
+0,0,102,32,0,0,0,32,0,1,0,0,0,1,10,61,190,111,56,114,95,15,60,245,0,11,8,
+0,0,0,0,0,207,53,3,181,0,0,0,0,211,11,119,207,252,184,252,206,8,183,7,115,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,115,252,206,0,0,8,183,252,184,248,208,8,
+183,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,46,0,1,0,0,1,57,0,73,0,8,0,128,0,7,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,1,0,4,4,79,1,144,0,5,0,0,5,51,4,204,0,0,
+0,153,5,51,4,204,0,0,2,204,0,102,2,145,0,0,2,4,5,3,5,3,6,2,2,3,0,0,0,0,0,
+0,0,0,0,0,0,128,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,115,252,206,0,0,7,
+115,3,50,32,62,1,97,215,255,0,0,0,0,0,0,0,0,0,32,0,6,4,205,0,193,0,0,0,0,
+2,20,0,0,2,20,0,0,0,0,255,220,0,0,255,37,0,0,255,220,0,0,254,81,2,108,0,150,
+2,38,0,129,2,38,0,129,2,38,0,129,2,38,0,129,0,0,255,185,7,33,0,120,7,23,0,
+120,4,208,255,176,4,218,255,176,6,201,0,120,5,45,0,120,5,13,255,176,6,169,
+255,176,6,201,0,120,5,45,0,120,5,13,255,176,6,169,255,176,2,235,0,140,2,176,
+0,140,2,235,0,140,2,176,0,140,5,218,0,120,6,12,0,120,4,83,0,120,4,108,0,120,
+2,28,0,129,2,38,0,129,6,112,0,120,6,130,0,120,4,125,255,176,4,110,255,176,
+4,54,0,100,5,219,0,100,4,217,255,176,3,130,255,176,4,54,0,100,5,219,0,100,
+4,217,255,176,3,130,255,176,4,120,0,120,4,197,0,120,2,216,255,176,2,141,255,
+176,8,153,0,120,4,129,0,120,4,162,0,120,4,127,255,176,4,138,255,176,5,253,
+254,116,5,145,254,116,4,28,255,23,4,136,255,23,5,58,0,100,5,67,0,100,6,6,
+255,176,5,255,255,176,2,12,0,151,1,207,0,140,2,166,255,176,2,177,255,176,
+8,153,0,120,8,183,0,120,6,157,255,176,6,127,255,176,6,97,0,120,6,127,0,120,
+6,157,255,176,6,127,255,176,6,0,0,0,5,70,0,0,3,135,255,176,4,66,255,176,6,
+179,0,120,6,207,0,120,4,218,255,176,4,190,255,176,7,30,0,120,6,206,0,120,
+4,236,255,176,5,60,255,176,2,16,254,112,2,8,254,112,6,197,0,120,6,197,0,120,
+4,151,255,176,4,151,255,176,2,235,0,140,2,176,0,140,6,101,0,120,5,128,0,120,
+3,189,255,176,4,162,255,176,3,44,0,140,4,173,0,140,7,33,0,120,7,23,0,120,
+4,208,255,176,4,218,255,176,6,201,0,120,5,45,0,120,5,13,255,176,6,169,255,
+176,2,255,255,155,2,196,255,153,4,170,0,140,4,170,0,140,6,179,0,120,6,207,
+0,120,4,218,255,176,4,190,255,176,5,145,0,120,5,69,0,120,3,149,255,176,3,
+225,255,176,3,178,0,91,3,9,255,176,4,188,0,234,2,13,0,159,2,13,0,159,2,55,
+0,180,2,13,0,159,3,103,0,159,2,193,0,159,2,193,0,159,2,193,0,159,2,193,0,
+159,4,162,0,245,7,98,0,244,5,142,1,4,6,17,0,225,0,0,255,80,0,0,255,13,0,0,
+255,26,0,0,255,162,0,0,255,78,0,0,255,97,0,0,255,136,0,0,255,10,0,0,255,28,
+0,0,255,49,0,0,255,49,0,0,255,16,0,0,255,30,0,0,255,180,0,0,255,42,0,0,255,
+42,0,0,255,180,0,0,254,129,0,0,255,124,0,0,255,179,0,0,255,180,0,0,255,180,
+0,0,255,40,0,0,255,40,0,0,255,25,0,0,255,24,0,0,254,159,0,0,255,7,0,0,254,
+245,0,0,254,251,0,0,255,153,0,0,254,234,0,0,255,124,0,0,255,154,0,0,254,234,
+0,0,255,124,0,0,255,11,0,0,254,253,0,0,254,244,0,0,254,251,0,0,255,56,0,0,
+255,18,0,0,255,56,0,0,255,67,0,0,255,61,0,0,255,56,0,0,255,15,0,0,255,110,
+0,0,254,252,0,0,255,97,0,0,255,97,0,0,255,209,0,0,254,227,0,0,255,13,0,0,
+255,9,0,0,255,15,0,0,255,14,0,0,255,23,0,0,255,15,0,0,255,38,0,0,255,49,0,
+0,255,0,0,0,255,43,0,0,255,97,0,0,255,56,0,0,255,56,1,133,0,60,2,62,0,191,
+3,65,0,50,3,181,0,50,3,30,0,60,3,162,0,70,3,69,0,20,3,188,0,0,3,198,0,10,
+3,92,0,30,3,211,0,130,2,24,0,112,2,24,0,109,2,33,0,152,2,55,0,130,2,69,0,
+170,2,69,0,170,5,206,0,152,3,8,0,66,2,70,0,183,2,94,0,82,2,94,0,61,2,155,
+0,160,2,155,0,50,4,80,0,160,4,80,255,206,4,80,0,160,4,80,255,206,3,250,0,
+82,3,250,0,80,3,94,0,70,4,149,0,130,4,149,0,130,4,150,0,145,3,175,0,90,3,
+45,0,32,2,240,0,23,2,147,0,84,3,109,0,115,4,215,0,170,7,40,0,180,7,0,0,180,
+2,235,0,106,2,176,0,56,1,249,0,129,1,249,0,129,2,143,0,154,2,143,0,154,1,
+249,255,176,2,3,255,176,1,239,255,176,2,3,255,176,5,120,255,176,5,230,255,
+176,7,48,255,176,5,220,255,176,7,48,255,176,5,220,255,176,3,24,0,140,3,123,
+0,140,3,24,0,140,3,123,0,140,2,245,0,140,3,123,0,140,3,44,255,155,3,143,255,
+153,3,118,0,106,4,51,0,56,2,56,254,154,2,48,254,152,5,245,0,120,5,213,255,
+176,5,245,0,120,5,213,255,176,5,245,0,120,5,213,255,176,6,139,0,120,6,107,
+255,176,6,139,0,120,6,107,255,176,6,139,0,120,6,107,255,176,2,126,0,140,1,
+66,0,139,2,39,255,176,2,27,255,176,3,84,254,79,3,192,254,79,0,0,255,201,0,
+0,255,161,0,0,255,155,0,0,255,180,0,0,255,179,0,0,1,178,0,200,255,176,1,94,
+255,176,0,0,0,0,254,72,252,184,255,216,255,216,255,216,254,72,252,184,0,120,
+0,120,0,120,254,118,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,168,0,0,0,78,0,64,
+0,5,0,14,0,0,0,13,0,33,0,43,0,47,0,58,0,61,0,93,0,160,0,171,0,176,0,187,3,
+4,3,8,3,10,3,32,3,37,3,46,3,49,6,12,6,27,6,31,6,33,6,64,6,85,6,108,6,112,
+7,13,7,47,7,74,7,79,32,15,32,38,32,68,34,18,37,204,38,113,254,255,255,255,
+0,0,0,0,0,13,0,32,0,40,0,45,0,58,0,61,0,91,0,160,0,171,0,176,0,187,3,3,3,
+7,3,10,3,32,3,35,3,45,3,48,6,12,6,27,6,31,6,33,6,64,6,75,6,96,6,112,7,0,7,
+15,7,48,7,77,32,12,32,38,32,68,34,18,37,204,38,112,254,255,255,255,0,1,255,
+245,0,0,0,0,0,0,0,163,0,177,0,0,255,99,0,62,0,67,0,47,253,164,253,162,253,
+161,253,146,253,137,253,130,253,129,250,207,250,193,250,192,250,90,250,60,
+250,104,250,109,250,78,249,125,0,0,249,92,0,0,223,248,224,184,224,172,222,
+219,219,40,218,133,1,2,0,1,0,0,0,0,0,74,0,76,0,82,0,0,0,0,0,82,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,
+0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,224,0,225,0,226,0,235,0,236,
+0,242,0,218,0,239,0,227,0,241,0,228,0,139,0,8,0,13,0,14,0,18,0,22,0,26,0,
+28,0,30,0,32,0,34,0,36,0,40,0,44,0,48,0,52,0,53,0,57,0,61,0,65,0,69,0,73,
+0,77,0,81,0,85,0,89,0,91,0,95,0,97,0,101,0,103,0,107,0,111,0,113,0,115,0,
+119,0,0,0,21,0,21,0,21,0,21,0,34,0,63,0,87,0,110,0,150,0,172,0,194,0,228,
+1,6,1,40,1,91,1,149,1,199,1,241,2,45,2,125,2,204,3,7,3,19,3,31,3,43,3,55,
+3,67,3,79,3,110,3,150,3,220,4,47,4,85,4,131,4,153,4,187,4,254,5,67,5,129,
+5,189,6,10,6,108,6,197,7,12,7,23,7,35,7,46,7,57,7,96,7,150,7,192,7,228,8,
+0,8,47,8,91,8,140,8,181,8,230,9,24,9,66,9,102,9,169,9,244,10,65,10,136,10,
+161,10,188,10,241,11,28,11,112,11,204,12,32,12,109,12,185,13,13,13,21,13,
+29,13,81,13,131,13,174,13,217,14,35,14,120,14,196,15,3,15,78,15,153,15,218,
+16,27,16,79,16,142,16,202,17,11,17,67,17,119,17,131,17,143,17,208,18,9,18,
+58,18,115,18,163,18,233,19,43,19,116,19,181,19,238,20,75,20,182,21,32,21,
+124,21,140,21,156,21,190,21,239,22,56,22,135,22,205,23,13,23,89,23,169,23,
+242,24,54,24,93,24,112,24,133,24,142,24,151,24,164,24,177,24,190,24,203,24,
+216,24,229,24,242,25,54,25,83,25,111,25,198,25,215,25,241,26,11,26,24,26,
+70,26,120,26,158,26,198,26,238,26,251,27,8,27,36,27,64,27,73,27,109,27,145,
+27,154,27,163,27,172,27,181,27,194,27,207,27,224,27,241,28,0,28,14,28,88,
+28,170,28,203,28,217,28,226,28,239,29,21,29,30,29,43,29,80,29,115,29,140,
+29,173,29,186,29,209,30,18,30,40,30,54,30,104,30,118,30,173,30,211,30,252,
+31,39,31,78,31,91,31,103,31,115,31,127,31,139,31,151,31,163,31,225,31,237,
+31,249,32,5,32,17,32,29,32,41,32,53,32,75,32,90,32,127,32,187,32,252,33,35,
+33,75,33,125,33,178,33,224,34,16,34,38,34,61,34,83,34,108,34,145,34,180,34,
+196,34,250,35,22,35,51,35,80,35,100,35,119,35,135,35,151,35,159,35,167,35,
+205,35,244,36,23,36,47,36,60,36,80,36,96,36,112,36,127,36,140,36,179,37,12,
+37,68,37,140,37,156,37,172,37,210,37,218,38,2,38,10,38,36,38,73,38,99,38,
+136,38,148,38,160,38,176,38,192,38,212,38,232,38,244,39,0,39,31,39,76,39,
+88,39,100,39,116,39,132,39,148,39,226,39,234,39,242,39,254,40,10,40,26,40,
+42,40,54,40,66,40,78,40,90,40,106,40,122,40,134,40,146,40,174,40,201,40,253,
+41,39,41,81,41,117,41,126,41,135,41,157,41,179,41,201,41,223,41,240,42,3,
+42,3,42,17,42,31,42,44,42,57,42,70,42,84,42,98,42,111,42,124,42,137,42,151,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,
+183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,1,255,220,0,0,0,36,5,182,
+0,3,0,0,19,17,35,17,36,72,5,182,250,74,5,182,0,1,255,37,0,0,0,219,5,204,0,
+14,0,0,51,35,17,7,39,55,39,55,23,55,23,7,23,7,39,36,72,134,49,171,171,49,
+170,170,49,171,171,49,134,4,161,136,49,169,168,49,171,171,49,168,169,49,136,
+0,0,1,255,220,0,0,1,174,5,204,0,10,0,0,1,7,39,55,33,17,35,17,33,39,55,1,174,
+217,49,137,254,246,71,1,81,137,49,4,245,214,49,130,251,46,5,25,130,49,0,1,
+254,81,0,0,0,35,5,204,0,10,0,0,51,35,17,33,23,7,39,55,23,7,33,35,71,254,246,
+137,49,217,217,49,137,1,81,4,210,130,49,214,215,49,130,0,0,1,0,150,255,72,
+1,224,5,113,0,23,0,0,1,22,22,21,20,14,2,21,20,22,23,7,35,38,38,53,52,18,53,
+52,38,39,55,1,36,96,92,48,80,48,31,32,104,28,39,46,183,52,96,98,5,113,80,
+172,122,96,194,205,181,110,106,151,84,76,71,199,124,205,1,187,139,71,112,
+96,116,0,0,1,0,129,255,63,1,94,5,100,0,9,0,0,1,17,20,6,7,39,54,54,53,17,1,
+94,45,54,122,31,40,5,100,251,191,171,245,68,61,54,212,155,4,67,0,1,0,129,
+255,63,1,94,5,100,0,9,0,0,1,17,20,6,7,39,54,54,53,17,1,94,45,54,122,31,40,
+5,100,251,191,171,245,68,61,54,212,155,4,67,0,1,0,129,255,63,2,38,5,100,0,
+18,0,0,1,17,7,20,22,51,21,34,38,39,35,6,6,7,39,54,54,53,17,1,94,1,90,111,
+78,101,28,6,11,42,33,122,31,40,5,100,251,191,63,36,37,155,30,32,85,128,42,
+61,54,212,155,4,67,0,0,1,0,129,255,63,2,38,5,100,0,18,0,0,1,17,7,20,22,51,
+21,34,38,39,35,6,6,7,39,54,54,53,17,1,94,1,90,111,78,101,28,6,11,42,33,122,
+31,40,5,100,251,191,63,36,37,155,30,32,85,128,42,61,54,212,155,4,67,0,0,1,
+255,185,4,97,0,69,6,139,0,19,0,0,3,22,22,21,20,6,7,7,20,22,23,7,38,53,52,
+54,53,52,38,39,5,42,32,61,1,1,7,13,66,31,65,26,27,6,139,35,67,41,59,157,41,
+25,20,41,38,30,58,66,70,160,47,27,53,23,0,1,0,120,0,0,6,149,3,79,0,32,0,0,
+33,34,38,53,55,52,54,55,55,21,20,22,51,33,50,54,53,52,36,35,34,6,7,39,54,
+54,51,32,0,21,20,6,35,2,48,206,234,2,2,1,136,163,153,3,45,67,77,254,164,222,
+47,139,42,34,44,175,64,1,27,1,161,164,162,201,179,30,10,19,4,8,15,134,147,
+62,58,165,255,21,13,131,21,34,254,177,244,131,137,0,0,1,0,120,0,0,7,23,3,
+79,0,37,0,0,19,52,54,55,55,21,20,22,51,33,50,54,53,52,36,35,34,6,7,39,54,
+54,51,32,0,21,20,6,7,23,54,55,51,21,33,34,38,53,122,2,1,136,163,153,3,45,
+67,77,254,164,222,47,139,42,34,44,175,64,1,21,1,168,20,22,3,36,37,95,251,
+25,206,234,1,154,10,19,4,8,15,134,147,62,58,165,255,21,13,131,21,34,254,179,
+216,37,76,26,7,2,1,155,201,179,0,1,255,176,0,0,4,208,3,79,0,31,0,0,53,33,
+50,54,53,52,36,35,34,6,7,39,54,54,51,32,0,21,20,6,7,23,54,55,51,21,33,34,
+38,53,52,54,3,39,67,77,254,164,222,47,139,42,34,44,175,64,1,23,1,166,19,23,
+3,36,37,95,251,48,33,47,47,155,62,58,165,255,21,13,131,21,34,254,178,215,
+35,77,27,7,2,1,155,41,36,36,42,0,0,1,255,176,0,0,4,78,3,79,0,26,0,0,49,34,
+38,53,52,54,51,33,50,54,53,52,36,35,34,6,7,39,54,54,51,32,0,21,20,6,35,33,
+47,47,33,3,39,67,77,254,164,222,47,139,42,34,44,175,64,1,27,1,161,164,162,
+41,36,36,42,62,58,165,255,21,13,131,21,34,254,177,244,131,137,0,0,1,0,120,
+252,223,6,191,1,224,0,35,0,0,19,23,6,6,21,20,22,23,1,22,22,51,50,54,53,52,
+38,39,1,55,1,22,22,21,20,6,35,34,38,39,1,38,38,53,52,54,186,115,15,16,81,
+87,2,237,46,103,67,74,94,25,23,252,206,92,3,46,63,53,179,150,74,159,93,253,
+33,110,107,34,1,224,72,32,58,35,82,137,64,253,208,35,51,67,49,23,39,17,2,
+94,129,253,159,47,98,60,111,160,61,69,2,37,84,196,109,60,110,0,0,1,0,120,
+252,223,6,191,1,224,0,50,0,0,19,23,6,6,21,20,22,23,1,22,22,51,50,54,53,52,
+38,39,1,55,23,33,21,35,34,38,39,39,21,22,23,23,22,22,23,5,22,22,21,20,6,35,
+34,38,39,1,38,38,53,52,54,186,115,15,16,81,87,2,237,46,103,67,74,94,25,23,
+252,206,92,172,1,100,10,19,65,44,49,9,25,55,29,53,12,1,34,63,53,179,150,74,
+159,93,253,33,110,107,34,1,224,72,32,58,35,82,137,64,253,208,35,51,67,49,
+23,39,17,2,94,129,129,155,6,7,8,6,5,16,36,20,37,9,217,47,98,60,111,160,61,
+69,2,37,84,196,109,60,110,0,0,1,255,176,252,223,6,159,1,28,0,51,0,0,37,33,
+21,35,34,38,39,39,21,22,23,23,22,22,23,5,22,22,21,20,6,35,34,38,39,1,38,38,
+35,35,34,38,53,52,54,51,51,50,22,23,1,22,22,51,50,54,53,52,38,39,1,55,3,166,
+1,103,10,19,65,44,49,9,25,55,29,53,12,1,34,63,53,179,150,74,159,93,253,10,
+86,109,52,35,33,47,47,33,53,65,142,123,3,4,46,103,67,74,94,25,23,252,206,
+92,155,155,6,7,8,6,5,16,36,20,37,9,217,47,98,60,111,160,61,69,2,55,63,41,
+42,36,36,41,48,89,253,190,35,51,67,49,23,39,17,2,94,129,0,1,255,176,252,223,
+6,159,1,68,0,36,0,0,1,22,22,21,20,6,35,34,38,39,1,38,38,35,35,34,38,53,52,
+54,51,51,50,22,23,1,22,22,51,50,54,53,52,38,39,1,55,6,43,63,53,179,150,74,
+159,93,253,10,86,109,52,35,33,47,47,33,53,65,142,123,3,4,46,103,67,74,94,
+25,23,252,153,92,254,187,47,98,60,111,160,61,69,2,55,63,41,42,36,36,41,48,
+89,253,190,35,51,67,49,23,39,17,2,134,129,0,255,255,0,120,252,223,6,191,1,
+224,16,39,1,42,1,174,0,80,16,6,0,18,0,0,255,255,0,120,252,223,6,191,1,224,
+16,39,1,42,1,174,0,80,16,6,0,19,0,0,255,255,255,176,252,223,6,159,1,28,16,
+39,1,42,1,142,0,80,16,6,0,20,0,0,255,255,255,176,252,223,6,159,1,68,16,39,
+1,42,1,142,0,80,16,6,0,21,0,0,255,255,0,140,253,118,2,115,2,69,16,39,1,39,
+1,45,253,112,16,6,0,28,0,0,255,255,0,140,253,63,2,176,1,110,16,39,1,39,1,
+20,253,57,16,6,0,29,0,0,0,1,0,140,254,245,2,115,2,69,0,16,0,0,1,39,54,54,
+55,46,2,53,52,54,51,50,22,21,20,2,1,21,105,48,98,37,5,134,76,142,101,108,
+136,179,254,245,89,44,95,48,27,93,121,73,94,164,153,132,134,254,225,0,0,1,
+0,140,254,181,2,176,1,110,0,24,0,0,23,54,54,53,38,39,39,38,38,53,52,54,51,
+50,30,2,51,21,34,38,39,6,6,7,170,48,72,5,26,55,35,29,94,67,61,87,70,81,88,
+42,92,47,35,133,81,238,50,113,32,26,25,51,34,68,45,66,94,58,105,48,155,2,
+5,103,169,66,0,2,0,120,255,241,5,68,3,87,0,33,0,45,0,0,1,6,6,7,6,6,35,34,
+38,53,52,54,51,50,22,23,51,54,54,55,55,22,22,21,20,6,7,39,54,54,53,52,38,
+39,4,38,35,34,6,21,20,22,51,50,54,53,4,156,23,98,54,32,240,171,195,247,244,
+179,174,243,35,7,39,78,35,116,35,43,22,27,132,18,21,10,9,254,191,178,145,
+116,158,168,145,127,157,2,60,44,140,65,146,177,241,191,184,239,175,147,54,
+140,66,25,81,232,94,121,208,97,23,89,212,79,56,105,24,25,157,146,116,126,
+162,148,122,0,0,2,0,120,255,241,6,12,3,87,0,44,0,56,0,0,1,51,54,54,55,55,
+22,22,21,20,6,21,20,22,51,21,34,38,39,35,6,6,7,39,54,54,53,52,38,39,7,6,6,
+7,6,6,35,34,38,53,52,54,51,50,22,6,38,35,34,6,21,20,22,51,50,54,53,3,227,
+7,39,78,35,116,35,43,7,108,99,90,103,28,6,5,11,6,132,18,21,10,9,7,23,98,54,
+32,240,171,195,247,244,179,174,243,94,178,145,116,158,168,145,127,157,2,21,
+54,140,66,25,81,232,94,60,87,30,31,48,155,43,37,25,47,23,23,89,212,79,56,
+105,24,1,44,140,65,146,177,241,191,184,239,175,132,157,146,116,126,162,148,
+122,0,0,2,0,120,0,0,3,219,3,68,0,11,0,23,0,0,36,6,35,34,38,53,52,54,51,50,
+4,21,38,38,35,34,6,21,20,22,51,50,54,53,3,219,237,197,186,247,234,179,194,
+1,4,150,168,136,113,150,163,139,120,145,217,217,249,186,177,224,250,184,124,
+160,135,109,125,162,132,118,0,2,0,120,0,0,4,108,3,68,0,16,0,28,0,0,0,6,7,
+21,55,51,21,33,34,36,53,52,54,51,50,4,21,38,38,35,34,6,21,20,22,51,50,54,
+53,3,219,53,40,84,154,253,231,218,254,255,234,179,194,1,4,150,168,136,113,
+150,163,139,120,145,1,68,126,40,7,4,155,239,196,177,224,250,184,124,160,135,
+109,125,162,132,118,0,0,1,0,129,255,63,1,94,3,84,0,9,0,0,1,17,20,6,7,39,54,
+54,53,17,1,94,45,54,122,31,40,3,84,253,207,171,245,68,61,54,212,155,2,51,
+0,1,0,129,255,63,2,38,3,84,0,18,0,0,1,17,7,20,22,51,21,34,38,39,35,6,6,7,
+39,54,54,53,17,1,94,1,90,111,82,95,29,6,11,42,34,122,31,40,3,84,253,207,63,
+36,37,155,33,34,86,131,43,61,54,212,155,2,51,0,0,1,0,120,255,241,5,228,1,
+237,0,45,0,0,1,55,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,39,6,
+6,35,34,38,53,52,55,55,52,55,55,22,22,51,50,62,2,51,50,22,22,51,50,4,149,
+39,21,43,40,61,65,66,54,51,38,63,37,48,100,59,54,113,50,74,166,103,185,193,
+1,1,2,133,2,121,116,68,107,83,56,66,66,62,47,30,39,1,52,91,50,44,101,224,
+43,59,56,44,45,54,45,44,55,58,56,197,198,12,8,16,8,4,8,150,146,62,167,124,
+164,147,0,1,0,120,255,241,6,130,1,237,0,46,0,0,37,6,6,35,34,38,39,6,6,35,
+34,38,53,52,55,55,52,55,55,22,22,51,50,54,55,55,54,54,51,50,22,22,51,50,54,
+54,51,50,22,22,23,22,22,51,21,34,38,5,31,58,123,60,63,116,47,73,169,104,185,
+193,1,1,2,133,2,121,116,64,114,49,57,14,44,38,65,64,49,30,37,76,64,68,42,
+53,81,20,14,71,56,139,156,99,56,43,49,50,58,56,197,198,12,8,16,8,4,8,150,
+146,61,103,123,29,37,157,154,177,134,63,225,29,7,14,155,39,0,1,255,176,0,
+0,4,125,1,237,0,41,0,0,37,6,6,7,35,34,38,53,52,54,51,50,62,2,51,50,22,22,
+51,50,54,54,51,50,22,22,23,22,22,51,21,35,39,38,38,39,6,6,7,34,38,1,71,72,
+158,87,10,33,47,47,33,92,81,66,56,64,65,64,49,30,37,76,64,68,42,53,81,20,
+14,71,56,61,28,102,120,44,57,122,62,63,116,99,56,42,1,41,36,36,42,71,149,
+118,157,154,177,134,63,225,29,7,14,155,2,5,48,44,55,43,1,49,0,1,255,176,0,
+0,3,226,1,237,0,40,0,0,37,6,6,7,35,34,38,53,52,54,51,50,62,2,51,50,22,22,
+51,50,55,55,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,1,71,72,158,
+87,10,33,47,47,33,85,86,68,56,64,65,64,49,30,39,53,39,21,43,40,61,65,66,54,
+51,38,63,37,48,102,65,48,110,99,56,42,1,41,36,36,42,65,154,119,157,154,126,
+91,50,44,101,224,43,59,56,44,45,54,45,43,0,0,2,0,100,253,121,3,200,5,62,0,
+36,0,49,0,0,19,22,22,23,54,54,18,53,52,38,39,55,55,22,22,21,20,2,7,7,30,2,
+21,20,6,35,34,38,53,52,54,55,38,38,39,55,1,6,6,21,20,22,51,50,54,53,52,38,
+38,190,39,153,64,72,155,128,38,48,98,9,65,64,133,102,139,168,146,77,208,167,
+157,197,66,51,79,125,52,80,1,55,47,60,116,97,103,123,96,141,1,211,57,139,
+27,98,226,1,54,114,66,104,54,125,1,67,149,122,149,254,165,137,188,72,116,
+150,105,176,211,209,164,117,190,82,42,114,81,114,254,101,69,156,83,106,138,
+130,110,84,116,72,0,2,0,100,253,121,5,219,4,189,0,49,0,62,0,0,0,38,53,52,
+54,55,38,38,39,55,55,22,22,23,55,54,18,53,52,38,39,55,22,0,18,22,51,21,34,
+38,2,39,39,38,38,39,35,22,22,21,20,2,7,23,22,22,21,20,6,35,3,6,6,21,20,22,
+51,50,54,53,52,38,39,2,15,205,28,60,114,150,46,80,10,34,159,68,2,29,33,4,
+8,140,111,1,102,203,105,79,125,168,193,63,68,71,126,25,10,3,2,37,30,147,143,
+168,201,164,138,32,44,121,97,100,116,123,103,253,121,202,161,65,159,176,53,
+120,72,114,1,49,126,33,6,110,1,58,157,83,138,79,58,203,253,231,254,249,55,
+155,97,1,4,94,101,105,198,47,38,52,24,152,254,192,103,66,63,189,155,177,210,
+2,201,84,167,78,101,133,125,115,95,126,45,0,0,2,255,176,253,121,4,217,4,189,
+0,47,0,60,0,0,51,35,34,38,53,52,54,51,51,54,18,53,52,38,39,55,22,0,18,22,
+51,21,34,38,47,2,38,2,39,35,22,22,21,20,2,7,22,4,21,20,6,35,34,38,53,52,54,
+55,6,6,21,20,22,51,50,54,53,52,38,35,109,109,33,47,47,33,158,39,60,4,8,140,
+111,1,102,203,105,79,134,167,78,112,58,84,183,23,10,3,2,55,37,221,1,6,208,
+166,156,199,28,171,26,27,114,98,103,123,177,163,41,36,36,42,131,1,144,169,
+83,138,79,58,203,253,231,254,249,55,155,107,106,154,84,122,1,29,44,38,52,
+24,151,254,152,122,2,222,191,175,212,208,165,52,155,67,66,133,54,105,139,
+130,110,124,133,0,0,2,255,176,253,121,3,20,5,62,0,34,0,47,0,0,51,35,34,38,
+53,52,54,51,51,54,0,53,52,38,39,55,55,22,22,21,20,2,0,7,22,22,21,20,6,35,
+34,38,53,52,54,55,6,6,21,20,22,51,50,54,53,52,38,35,107,107,33,47,47,33,168,
+69,1,128,38,48,98,9,65,64,125,254,246,51,209,250,208,166,158,202,31,170,28,
+28,116,102,103,123,177,163,41,36,36,42,150,2,18,157,66,104,54,125,1,67,149,
+122,122,254,234,254,160,98,7,219,188,175,212,210,163,78,136,60,63,136,54,
+109,135,130,110,124,133,0,255,255,0,100,253,121,3,200,5,62,16,38,1,42,87,
+40,16,6,0,40,0,0,255,255,0,100,253,121,5,219,4,189,16,39,1,42,0,166,0,40,
+16,6,0,41,0,0,255,255,255,176,253,121,4,217,4,189,16,38,1,42,161,40,16,6,
+0,42,0,0,255,255,255,176,253,121,3,20,5,62,16,38,1,42,159,40,16,6,0,43,0,
+0,0,1,0,120,255,241,3,236,1,203,0,23,0,0,1,22,22,51,50,54,55,55,54,54,51,
+50,22,21,20,6,6,35,34,38,53,55,52,55,1,1,2,144,157,54,72,28,16,18,63,57,63,
+73,101,175,153,236,219,1,3,1,170,138,147,3,4,112,128,71,139,103,100,112,20,
+190,196,22,17,8,0,1,0,120,255,241,4,197,1,184,0,34,0,0,37,6,6,35,34,38,53,
+52,55,55,52,55,55,22,22,51,50,54,54,55,55,54,54,51,50,22,23,23,30,2,51,21,
+34,38,3,80,69,191,90,185,193,1,1,2,133,2,125,122,55,91,58,40,27,15,45,42,
+40,58,45,14,25,31,95,34,185,138,86,49,52,190,195,12,8,16,8,4,8,151,135,32,
+71,77,54,29,37,59,106,32,59,20,9,155,43,0,0,1,255,176,0,0,2,216,1,183,0,26,
+0,0,37,21,35,34,38,39,6,6,35,34,38,53,52,54,51,50,62,2,51,50,22,23,23,30,
+2,2,216,39,150,143,51,74,157,109,38,47,47,33,86,89,67,56,67,40,58,45,14,28,
+34,115,155,155,43,43,46,40,41,36,36,42,49,127,108,59,106,32,66,12,9,0,0,1,
+255,176,0,0,2,1,1,217,0,22,0,0,55,50,54,55,55,35,54,54,51,50,22,21,20,6,7,
+7,35,34,38,53,52,54,51,69,54,72,28,16,1,19,63,57,63,73,124,132,173,84,33,
+47,47,33,155,3,4,112,128,71,139,103,111,114,3,3,41,36,36,42,255,255,0,120,
+254,81,8,13,6,114,16,39,1,39,2,98,4,105,16,39,1,39,2,249,5,133,16,39,1,39,
+3,144,4,105,16,39,0,51,6,12,0,0,16,38,0,31,0,0,16,7,1,39,2,251,254,75,0,1,
+0,120,252,206,3,245,1,171,0,27,0,0,37,55,54,54,51,50,22,21,20,6,7,7,34,7,
+35,1,39,1,38,38,53,52,54,55,55,22,22,51,2,116,9,62,93,71,63,87,101,99,31,
+16,14,23,254,89,138,1,139,202,241,3,2,134,6,196,158,150,17,117,143,134,85,
+93,106,6,2,1,252,206,63,2,246,13,202,157,5,30,8,8,128,148,0,1,0,120,252,206,
+4,162,1,171,0,25,0,0,37,55,54,54,51,50,22,21,20,7,51,21,33,1,39,1,38,38,53,
+52,54,55,55,22,22,51,2,116,9,62,93,71,63,87,6,179,254,55,254,89,138,1,138,
+200,242,3,2,134,6,190,162,150,17,117,143,134,85,28,25,155,252,206,63,2,240,
+15,208,155,5,30,8,8,132,144,0,1,255,176,0,0,4,127,3,124,0,31,0,0,53,33,50,
+54,53,52,38,35,34,6,7,39,54,54,51,50,0,21,20,6,7,23,54,55,51,21,33,34,38,
+53,52,54,2,157,104,97,178,135,107,167,37,131,34,246,159,197,1,15,23,29,3,
+36,37,105,251,129,33,47,47,155,87,102,170,223,134,115,27,164,213,254,208,
+242,54,100,33,7,2,1,155,41,36,36,42,0,0,1,255,176,0,0,3,254,3,124,0,26,0,
+0,49,34,38,53,52,54,51,33,50,54,53,52,38,35,34,6,7,39,54,54,51,50,0,21,20,
+6,35,33,47,47,33,2,157,104,97,178,135,107,167,37,131,34,246,159,198,1,14,
+187,184,41,36,36,42,87,102,170,223,134,115,27,164,213,254,200,254,166,160,
+0,0,1,254,116,255,221,5,153,5,140,0,26,0,0,37,1,55,1,22,22,51,50,54,53,52,
+38,39,1,55,1,7,39,38,39,39,35,6,6,35,34,38,2,28,252,88,117,3,186,73,87,47,
+66,87,17,12,252,158,117,4,152,120,80,16,25,45,6,18,141,108,85,158,168,4,43,
+105,251,193,82,51,77,54,24,38,14,3,220,105,250,193,101,91,18,30,53,86,117,
+99,0,0,1,254,116,255,221,5,145,5,140,0,28,0,0,37,1,55,1,22,22,51,50,54,53,
+52,38,39,1,55,1,22,22,51,21,34,38,39,35,6,6,35,34,38,2,28,252,88,117,3,186,
+73,87,47,66,87,15,11,252,155,117,4,23,30,59,32,82,131,65,6,18,141,108,85,
+158,168,4,43,105,251,193,82,51,77,54,22,37,13,3,224,105,251,84,34,35,155,
+87,81,86,117,99,0,1,255,23,0,0,4,28,5,140,0,24,0,0,3,55,1,22,22,51,21,34,
+38,39,6,6,35,33,34,38,53,52,54,51,33,55,50,54,55,233,117,4,23,30,59,32,60,
+90,38,29,121,110,253,164,33,47,47,33,2,114,30,31,57,19,5,35,105,251,84,34,
+35,155,39,33,37,35,41,36,36,42,1,11,11,0,0,1,255,23,255,232,4,36,5,140,0,
+19,0,0,37,7,39,6,6,35,33,34,38,53,52,54,51,33,55,50,54,55,1,55,4,36,120,80,
+30,120,106,253,164,33,47,47,33,2,114,30,31,57,19,252,28,117,77,101,91,35,
+32,41,36,36,42,1,11,11,4,113,105,0,0,2,0,100,252,206,4,194,3,150,0,30,0,42,
+0,0,36,6,35,34,38,39,7,22,22,21,20,2,7,39,54,18,53,52,2,3,55,22,22,23,51,
+54,54,51,50,22,21,38,38,35,34,6,21,20,22,51,50,54,53,4,194,248,185,110,147,
+51,7,12,15,70,77,143,71,75,89,164,124,45,76,32,10,35,206,139,205,246,150,
+156,145,134,178,188,142,127,156,231,240,78,75,3,52,128,73,179,254,156,171,
+38,175,1,125,178,207,1,117,1,42,86,65,154,83,111,137,240,196,136,150,145,
+110,111,206,157,132,0,0,2,0,100,252,206,5,67,3,150,0,36,0,48,0,0,37,21,33,
+34,38,39,7,22,22,21,20,2,7,39,54,18,53,52,2,3,55,22,22,23,51,54,54,51,50,
+22,21,20,6,7,21,55,55,2,38,35,34,6,21,20,22,51,50,54,53,5,67,254,30,142,185,
+59,9,12,15,70,77,143,71,75,89,164,124,30,86,37,10,38,209,133,205,246,56,51,
+39,106,188,156,145,134,178,187,143,130,153,155,155,71,75,5,52,128,73,179,
+254,156,171,38,175,1,125,178,207,1,117,1,42,86,40,165,97,116,132,240,196,
+88,134,48,10,3,4,1,153,150,145,110,110,198,149,131,0,2,255,176,0,0,6,6,3,
+164,0,38,0,50,0,0,19,1,22,22,23,51,54,54,51,50,4,21,20,6,7,21,55,51,21,33,
+34,38,39,35,6,6,35,33,34,38,53,52,54,51,33,50,54,55,1,0,38,35,34,6,21,20,
+22,51,50,54,53,131,1,61,31,46,18,6,10,224,171,202,1,3,53,38,90,128,254,29,
+112,193,69,6,31,146,124,254,134,33,47,47,33,1,144,87,78,4,253,211,4,229,172,
+139,120,153,201,127,118,138,3,164,254,152,35,60,26,180,198,245,184,77,123,
+42,7,4,155,59,66,66,59,41,36,36,42,35,33,2,93,254,203,160,138,119,96,175,
+127,115,0,2,255,176,0,0,5,135,3,164,0,33,0,45,0,0,19,1,22,22,23,51,54,54,
+51,50,4,21,20,6,35,34,38,39,35,6,6,35,33,34,38,53,52,54,51,33,50,54,55,1,
+0,38,35,34,6,21,20,22,51,50,54,53,131,1,61,31,46,18,6,10,224,171,201,1,4,
+222,164,100,175,66,6,31,147,126,254,134,33,47,47,33,1,144,87,78,4,253,211,
+4,229,172,139,120,153,201,127,118,138,3,164,254,152,35,60,26,180,198,254,
+185,177,213,62,63,65,60,41,36,36,42,35,33,2,93,254,203,160,138,119,96,175,
+127,115,0,0,1,0,151,252,244,3,31,1,139,0,8,0,0,1,22,18,18,23,7,2,0,3,1,41,
+33,125,161,183,123,225,254,249,37,1,139,195,254,137,254,238,250,81,1,4,2,
+50,1,55,0,0,1,0,140,252,206,2,166,0,155,0,14,0,0,33,6,21,20,18,23,7,38,2,
+53,52,54,51,51,21,1,41,2,204,179,118,194,226,50,60,213,4,8,146,254,140,192,
+96,187,1,179,187,85,79,155,0,1,255,176,0,0,2,166,3,98,0,35,0,0,1,22,22,21,
+21,20,6,7,22,22,51,51,21,35,34,38,39,6,6,35,35,34,38,53,52,54,51,51,50,54,
+54,55,53,52,38,39,1,189,15,16,10,9,15,110,76,20,29,100,130,37,47,125,80,130,
+33,47,47,33,173,70,62,19,2,18,11,3,98,61,225,84,68,57,127,41,23,25,155,36,
+47,46,37,41,36,36,42,54,94,130,56,80,215,60,0,1,255,176,0,0,1,243,3,98,0,
+26,0,0,1,22,22,23,23,20,23,20,6,6,35,35,34,38,53,52,54,51,51,50,54,54,55,
+53,52,38,39,1,212,9,15,4,2,1,64,144,122,169,33,47,47,33,198,63,66,20,2,19,
+10,3,98,38,149,89,63,28,13,233,169,84,41,36,36,42,55,94,130,55,47,251,57,
+0,0,3,0,120,0,0,8,33,3,58,0,35,0,47,0,59,0,0,33,34,38,53,55,52,54,55,55,21,
+20,22,51,51,50,23,53,38,38,53,52,54,51,50,22,23,51,54,54,51,50,22,21,20,6,
+35,0,38,35,34,6,21,20,22,51,50,54,53,36,38,35,34,6,21,20,22,51,50,54,53,2,
+58,215,235,2,2,1,136,164,162,135,34,33,52,49,217,163,109,165,48,7,41,156,
+99,172,216,236,218,254,220,137,129,104,131,140,119,142,100,2,89,127,115,104,
+139,100,112,120,153,186,164,30,10,19,4,8,15,122,129,3,7,54,136,86,175,208,
+86,77,79,92,226,184,199,217,1,244,168,122,104,128,159,96,94,201,130,140,123,
+127,131,144,129,0,3,0,120,0,0,8,183,3,58,0,40,0,52,0,64,0,0,0,6,7,21,54,55,
+51,21,33,34,38,53,55,52,54,55,55,21,20,22,51,51,50,23,53,38,38,53,52,54,51,
+50,22,23,51,54,54,51,50,22,21,36,38,35,34,6,21,20,22,51,50,54,53,36,38,35,
+34,6,21,20,22,51,50,54,53,8,33,60,49,34,33,192,249,131,215,235,2,2,1,136,
+164,162,135,34,33,52,49,217,163,109,165,48,7,41,156,99,177,211,253,22,137,
+129,104,131,140,119,142,100,2,89,127,115,104,139,100,112,120,153,1,92,148,
+41,7,2,1,155,186,164,30,10,19,4,8,15,122,129,3,7,54,136,86,175,208,86,77,
+79,92,219,181,74,168,122,104,128,159,96,94,201,130,140,123,127,131,144,129,
+0,0,3,255,176,0,0,6,157,3,58,0,34,0,46,0,58,0,0,0,6,7,21,54,55,51,21,33,34,
+38,53,52,54,51,51,50,23,53,38,38,53,52,54,51,50,22,23,51,54,54,51,50,22,21,
+36,38,35,34,6,21,20,22,51,50,54,53,36,38,35,34,6,21,20,22,51,50,54,53,6,7,
+60,49,34,33,192,249,99,33,47,47,33,187,32,32,52,49,217,163,109,165,48,7,44,
+160,92,177,211,253,22,137,129,104,131,140,119,142,100,2,89,127,115,104,139,
+100,112,120,153,1,92,148,41,7,2,1,155,41,36,36,42,3,7,54,136,86,175,208,86,
+77,85,86,219,181,74,168,122,104,128,159,96,94,201,130,140,123,127,131,144,
+129,0,0,3,255,176,0,0,6,7,3,58,0,29,0,41,0,53,0,0,36,6,35,33,34,38,53,52,
+54,51,51,50,23,53,38,38,53,52,54,51,50,22,23,51,54,54,51,50,22,21,36,38,35,
+34,6,21,20,22,51,50,54,53,36,38,35,34,6,21,20,22,51,50,54,53,6,7,236,218,
+251,191,33,47,47,33,187,32,32,52,49,217,163,109,165,48,7,41,156,99,172,216,
+253,22,137,129,104,131,140,119,142,100,2,89,127,115,104,139,100,112,120,153,
+217,217,41,36,36,42,3,7,54,136,86,175,208,86,77,79,92,226,184,84,168,122,
+104,128,159,96,94,201,130,140,123,127,131,144,129,0,0,3,0,120,254,187,5,233,
+3,58,0,28,0,40,0,52,0,0,36,6,35,35,6,6,7,35,54,63,2,35,34,38,53,52,54,51,
+50,22,23,51,54,54,51,50,22,21,36,38,35,34,6,21,20,22,51,50,54,53,36,38,35,
+34,6,21,20,22,51,50,54,53,5,233,236,218,164,7,16,10,135,2,4,7,12,173,219,
+240,217,163,109,165,48,7,41,156,99,172,216,253,22,137,129,104,131,140,119,
+132,110,2,89,127,115,104,139,105,107,116,157,217,217,91,166,68,31,39,80,175,
+232,203,175,208,86,77,79,92,226,184,84,168,122,104,129,168,101,99,201,130,
+140,123,131,137,150,133,0,3,0,120,254,187,6,127,3,58,0,33,0,45,0,57,0,0,0,
+6,7,21,54,55,51,21,33,6,6,7,35,54,63,2,35,34,38,53,52,54,51,50,22,23,51,54,
+54,51,50,22,21,36,38,35,34,6,21,20,22,51,50,54,53,36,38,35,34,6,21,20,22,
+51,50,54,53,5,233,60,49,34,33,192,253,0,7,16,10,135,2,4,7,12,173,219,240,
+217,163,109,165,48,7,44,160,92,177,211,253,22,137,129,104,131,140,119,132,
+110,2,89,127,115,104,139,106,106,116,157,1,92,148,41,7,2,1,155,91,166,68,
+31,39,80,175,232,203,175,208,86,77,85,86,219,181,74,168,122,104,129,168,101,
+99,201,130,140,123,132,135,150,132,0,255,255,255,176,0,0,6,157,3,58,18,6,
+0,71,0,0,255,255,255,176,0,0,6,7,3,58,18,6,0,72,0,0,0,1,0,0,255,221,5,156,
+3,124,0,28,0,0,37,1,55,1,22,22,51,50,54,53,52,38,39,1,55,1,22,22,23,7,38,
+38,39,35,6,6,35,34,38,1,219,254,37,117,1,237,75,81,41,66,87,11,14,254,104,
+117,1,251,72,125,88,39,88,168,67,8,20,139,108,83,147,168,2,29,105,253,207,
+84,49,77,54,19,34,16,1,211,105,253,189,83,94,22,135,9,100,80,93,110,96,0,
+0,1,0,0,255,221,5,70,3,124,0,28,0,0,37,1,55,1,22,22,51,50,54,53,52,38,39,
+1,55,1,22,22,51,21,34,38,39,35,6,6,35,34,38,1,219,254,37,117,1,237,75,81,
+41,66,87,13,11,254,103,117,2,73,30,59,32,71,126,84,5,19,138,108,83,147,168,
+2,29,105,253,207,84,49,77,54,20,36,12,1,212,105,253,100,34,35,155,71,97,92,
+111,96,0,1,255,176,0,0,3,135,3,124,0,24,0,0,19,1,22,22,51,21,34,38,39,6,6,
+35,33,34,38,53,52,54,51,33,55,50,54,55,1,197,2,73,30,59,32,60,90,38,29,121,
+110,254,57,33,47,47,33,1,221,30,31,57,19,253,234,3,124,253,100,34,35,155,
+39,33,37,35,41,36,36,42,1,11,11,2,97,0,0,1,255,176,255,235,3,222,3,124,0,
+24,0,0,19,55,1,22,22,23,7,38,38,39,6,6,35,33,34,38,53,52,54,51,33,55,50,54,
+55,80,117,1,252,72,125,88,39,72,108,45,28,123,111,254,48,33,47,47,33,1,230,
+28,36,49,18,3,19,105,253,189,83,94,22,135,7,52,37,38,37,41,36,36,42,1,9,10,
+0,2,0,120,0,0,6,39,4,67,0,36,0,48,0,0,1,35,6,6,35,34,38,53,52,54,51,50,4,
+18,21,20,4,35,33,34,36,53,52,55,55,52,55,55,22,22,51,33,50,54,53,52,38,36,
+22,51,50,54,55,38,38,35,34,6,21,5,140,6,73,212,106,184,218,236,173,134,1,
+1,154,254,251,255,254,61,225,254,249,1,1,2,133,2,186,171,1,199,177,180,4,
+253,115,135,122,100,190,59,54,186,107,112,147,2,28,73,84,172,160,165,211,
+173,254,202,183,212,213,208,187,12,8,16,8,4,8,138,158,141,143,26,51,116,100,
+82,68,118,136,117,90,0,0,2,0,120,0,0,6,207,4,67,0,45,0,57,0,0,37,34,7,33,
+34,36,53,52,55,55,52,55,55,22,22,51,33,50,54,53,52,38,39,35,6,6,35,34,38,
+53,52,54,51,50,4,18,21,20,6,7,23,54,55,51,21,33,1,38,38,35,34,6,21,20,22,
+51,50,54,4,77,11,10,254,40,225,254,249,1,1,2,133,2,186,171,1,199,177,180,
+4,4,6,73,212,106,184,218,236,173,137,1,1,151,59,60,3,36,37,211,253,124,1,
+22,54,186,107,112,147,135,122,100,190,1,1,208,187,12,8,16,8,4,8,138,158,141,
+143,26,51,24,73,84,172,160,165,211,176,254,214,172,92,147,47,7,2,1,155,2,
+170,118,136,117,90,97,100,82,0,2,255,176,0,0,4,218,4,67,0,39,0,51,0,0,37,
+34,7,33,34,38,53,52,54,51,33,50,54,53,52,38,39,35,6,6,35,34,38,53,52,54,51,
+50,4,18,21,20,6,7,23,54,55,51,21,33,1,38,38,35,34,6,21,20,22,51,50,54,2,88,
+11,10,253,189,33,47,47,33,2,58,177,180,4,4,6,73,212,106,184,218,236,173,137,
+1,1,151,59,60,3,36,37,211,253,124,1,22,54,186,107,112,147,135,122,100,190,
+1,1,41,36,36,42,141,143,26,51,24,73,84,172,160,165,211,176,254,214,172,92,
+147,47,7,2,1,155,2,170,118,136,117,90,97,100,82,0,2,255,176,0,0,4,50,4,67,
+0,30,0,42,0,0,49,34,38,53,52,54,51,33,50,54,53,52,38,39,35,6,6,35,34,38,53,
+52,54,51,50,4,18,21,20,4,35,1,38,38,35,34,6,21,20,22,51,50,54,33,47,47,33,
+2,58,177,180,4,4,6,70,211,110,184,218,236,173,134,1,1,154,254,251,255,1,62,
+54,186,107,112,147,135,122,100,190,41,36,36,42,141,143,26,51,24,70,87,172,
+160,165,211,173,254,202,183,212,213,2,170,118,136,117,90,97,100,82,0,0,1,
+0,120,0,0,6,166,4,37,0,52,0,0,33,33,34,36,53,52,55,55,52,55,55,22,22,51,51,
+50,22,23,55,38,38,53,52,0,51,50,22,21,20,6,35,34,38,53,55,22,22,51,50,54,
+53,52,38,35,34,6,21,20,30,2,51,51,6,166,251,186,225,254,249,1,1,2,133,2,186,
+171,72,33,71,35,3,83,90,1,55,202,194,243,179,139,122,161,122,7,89,59,81,99,
+151,136,146,221,123,211,213,104,242,208,187,12,8,16,8,4,8,138,158,2,2,7,50,
+173,137,220,1,67,207,154,130,173,142,111,14,63,69,87,78,97,112,217,159,137,
+165,64,9,0,0,1,0,120,0,0,6,206,4,37,0,52,0,0,33,33,34,36,53,52,55,55,52,55,
+55,22,22,51,51,50,22,23,55,38,38,53,52,0,51,50,22,21,20,6,35,34,38,53,55,
+22,22,51,50,54,53,52,38,35,34,6,21,20,30,2,51,33,6,206,251,146,225,254,249,
+1,1,2,133,2,186,171,72,33,71,35,3,83,90,1,55,202,194,243,179,139,122,161,
+122,7,89,59,81,99,151,136,146,221,123,211,213,104,1,26,208,187,12,8,16,8,
+4,8,138,158,2,2,7,50,173,137,220,1,67,207,154,130,173,142,111,14,63,69,87,
+78,97,112,217,159,137,165,64,9,0,1,255,176,0,0,4,236,4,37,0,45,0,0,33,33,
+34,38,53,52,54,51,33,50,23,55,38,38,53,52,0,51,50,22,21,20,6,35,34,38,53,
+55,22,22,51,50,54,53,52,38,35,34,6,21,20,30,2,51,33,4,236,251,20,33,47,47,
+33,1,19,35,35,3,83,90,1,55,202,194,243,179,139,122,161,122,7,89,59,81,99,
+151,136,146,221,123,211,213,104,1,26,41,36,36,42,3,7,50,172,137,220,1,67,
+207,154,130,173,142,111,14,63,69,87,78,97,112,217,159,137,165,64,9,0,1,255,
+176,0,0,4,196,4,37,0,45,0,0,33,33,34,38,53,52,54,51,33,50,23,55,38,38,53,
+52,0,51,50,22,21,20,6,35,34,38,53,55,22,22,51,50,54,53,52,38,35,34,6,21,20,
+30,2,51,51,4,196,251,60,33,47,47,33,1,19,35,35,3,83,90,1,55,202,194,243,179,
+139,122,161,122,7,89,59,81,99,151,136,146,221,123,211,213,104,242,41,36,36,
+42,3,7,50,172,137,220,1,67,207,154,130,173,142,111,14,63,69,87,78,97,112,
+217,159,137,165,64,9,0,0,1,254,112,252,244,1,152,1,218,0,33,0,0,1,22,22,21,
+20,6,6,21,20,22,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,38,53,52,54,
+53,52,38,39,1,64,39,32,53,55,75,50,172,150,117,254,239,96,81,93,227,92,85,
+82,126,107,20,29,1,218,56,107,51,73,127,110,54,49,149,141,67,126,144,112,
+86,109,69,89,62,62,77,229,73,82,205,79,36,83,43,0,0,1,254,112,252,244,2,8,
+1,218,0,42,0,0,1,22,22,21,21,7,22,22,51,21,34,38,39,35,6,6,21,20,22,22,21,
+20,6,35,34,36,39,55,22,22,51,50,54,53,52,38,53,52,54,53,52,38,39,1,64,39,
+32,1,26,75,29,56,84,26,7,24,40,75,50,172,150,117,254,239,96,81,93,227,92,
+85,82,126,107,20,29,1,218,56,107,51,13,12,42,38,155,43,43,42,107,41,49,149,
+141,67,126,144,112,86,109,69,89,62,62,77,229,73,89,197,80,36,83,43,0,2,0,
+120,0,0,6,68,3,86,0,28,0,40,0,0,36,6,35,33,34,38,53,55,52,54,55,55,21,20,
+22,51,51,50,23,53,38,38,53,52,54,51,50,4,21,38,38,35,34,6,21,20,22,51,50,
+54,53,6,68,251,208,253,193,215,235,2,2,1,136,164,162,155,34,33,59,62,252,
+184,211,1,13,150,183,147,123,164,183,145,128,161,228,228,186,164,30,10,19,
+4,8,15,122,129,3,7,59,139,87,182,228,244,189,125,158,140,113,126,170,146,
+123,0,0,2,0,120,0,0,6,197,3,86,0,32,0,44,0,0,0,6,7,21,55,51,21,33,34,38,53,
+55,52,54,55,55,21,20,22,51,51,50,23,53,38,38,53,52,54,51,50,4,21,38,38,35,
+34,6,21,20,22,51,50,54,53,6,68,63,47,86,153,251,117,215,235,2,2,1,136,164,
+162,155,34,33,62,59,252,184,212,1,12,150,183,147,120,167,181,147,128,161,
+1,97,150,45,7,4,155,186,164,30,10,19,4,8,15,122,129,3,7,57,136,87,183,232,
+235,188,115,158,143,115,124,167,146,123,0,2,255,176,0,0,4,151,3,86,0,26,0,
+38,0,0,49,34,38,53,52,54,51,51,50,23,53,38,38,53,52,54,51,50,4,21,20,6,7,
+21,55,51,21,0,38,35,34,6,21,20,22,51,50,54,53,33,47,47,33,184,34,33,62,59,
+252,184,212,1,12,63,47,86,153,254,233,183,147,120,167,181,147,128,161,41,
+36,36,42,3,7,57,136,87,183,232,235,188,78,150,45,7,4,155,2,34,158,143,115,
+124,167,146,123,0,0,2,255,176,0,0,4,22,3,86,0,22,0,34,0,0,36,6,35,33,34,38,
+53,52,54,51,51,50,23,53,38,38,53,52,54,51,50,4,21,4,22,51,50,54,53,52,38,
+35,34,6,21,4,22,251,208,253,181,33,47,47,33,184,34,33,62,59,252,184,211,1,
+13,253,1,181,147,128,161,183,147,120,167,228,228,41,36,36,42,3,7,57,136,87,
+183,232,244,189,99,167,146,123,122,158,143,115,255,255,0,140,254,245,2,115,
+3,212,16,39,1,39,1,138,2,231,16,6,0,28,0,0,255,255,0,140,254,181,2,176,3,
+3,16,39,1,39,1,88,2,22,16,6,0,29,0,0,0,1,0,120,0,0,5,237,2,206,0,43,0,0,37,
+38,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,54,55,23,23,6,6,35,34,38,39,
+6,6,35,34,38,53,55,52,54,55,55,21,20,22,51,50,54,2,166,29,28,172,149,121,
+175,29,46,35,94,52,33,48,27,4,61,40,143,87,77,178,65,119,205,91,180,212,2,
+2,1,136,129,122,61,95,233,42,84,51,142,166,164,123,52,93,48,39,48,21,18,1,
+99,39,51,46,35,46,35,206,174,30,10,19,4,8,15,135,146,40,0,0,1,0,120,0,0,5,
+128,2,206,0,38,0,0,37,38,38,53,52,54,51,50,22,21,20,6,7,22,22,51,51,21,35,
+34,38,39,6,6,35,34,38,53,55,52,54,55,55,21,20,22,51,50,54,2,166,29,28,172,
+149,121,175,31,45,38,118,83,7,51,110,227,86,120,210,92,180,212,2,2,1,136,
+129,122,61,95,233,42,84,51,142,166,164,123,56,90,47,38,45,155,45,39,48,36,
+206,174,30,10,19,4,8,15,135,146,40,0,0,1,255,176,0,0,3,189,2,206,0,32,0,0,
+38,54,51,50,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,51,51,21,35,34,
+38,39,6,6,35,34,38,53,80,47,33,80,134,13,29,28,172,149,121,175,31,45,38,118,
+83,7,51,104,226,91,109,236,140,33,47,113,42,41,37,42,84,51,142,166,164,123,
+56,90,47,38,45,155,41,42,48,35,41,36,0,0,1,255,176,0,0,4,42,2,206,0,37,0,
+0,38,54,51,50,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,54,55,23,
+23,6,6,35,34,38,39,6,6,35,34,38,53,80,47,33,80,134,13,29,28,172,149,121,175,
+29,46,35,94,52,33,48,27,4,61,40,143,87,73,170,75,108,232,138,33,47,113,42,
+41,37,42,84,51,142,166,164,123,52,93,48,39,48,21,18,1,99,39,51,42,38,46,34,
+41,36,0,0,1,0,140,255,196,2,200,4,226,0,27,0,0,1,22,22,21,20,2,7,23,54,54,
+51,50,22,23,7,38,38,35,34,6,7,39,54,18,17,52,38,39,1,128,23,11,61,49,3,54,
+87,21,65,129,45,43,39,135,62,73,160,34,26,61,64,16,10,4,226,109,203,105,216,
+254,123,122,5,14,9,23,25,136,13,17,14,6,86,134,1,142,1,16,102,219,61,0,0,
+1,0,140,255,196,4,173,4,189,0,43,0,0,37,54,54,51,50,22,23,7,38,38,35,34,6,
+7,39,54,18,53,52,38,39,55,22,0,18,22,51,21,34,38,38,47,2,38,2,39,35,22,22,
+21,20,2,7,1,57,51,88,20,66,130,44,41,38,137,62,73,160,34,27,60,63,4,8,140,
+86,1,41,234,117,72,102,115,88,65,71,58,84,183,23,10,3,2,55,39,102,12,10,23,
+25,136,13,17,14,6,86,139,1,168,236,90,154,76,58,158,254,53,254,192,121,155,
+71,103,93,100,84,122,1,29,44,38,77,39,158,254,143,113,0,1,0,120,0,0,6,149,
+4,242,0,43,0,0,33,34,38,53,55,52,54,55,55,21,20,22,51,33,50,54,53,52,36,35,
+34,6,7,39,1,23,7,6,15,4,21,54,54,51,50,4,18,21,20,6,35,2,48,206,234,2,2,1,
+136,163,153,3,45,67,77,254,167,245,36,111,62,33,1,159,109,102,12,18,38,43,
+83,30,22,48,23,186,1,76,174,164,162,201,179,30,10,19,4,8,15,134,147,62,58,
+179,241,6,8,111,1,218,91,110,13,18,39,43,80,28,8,2,3,153,254,252,160,131,
+137,0,0,1,0,120,0,0,7,23,4,242,0,48,0,0,19,52,54,55,55,21,20,22,51,33,50,
+54,53,52,36,35,34,6,7,39,1,23,7,6,15,4,21,54,54,51,50,4,22,21,20,6,7,23,54,
+55,51,21,33,34,38,53,122,2,1,136,163,153,3,45,67,77,254,167,245,36,111,62,
+33,1,159,109,102,12,18,38,43,83,30,22,48,23,177,1,75,185,19,23,3,36,37,95,
+251,25,206,234,1,154,10,19,4,8,15,134,147,62,58,179,241,6,8,111,1,218,91,
+110,13,18,39,43,80,28,8,2,3,146,248,149,35,77,27,7,2,1,155,201,179,0,0,1,
+255,176,0,0,4,208,4,242,0,42,0,0,37,23,54,55,51,21,33,34,38,53,52,54,51,33,
+50,54,53,52,36,35,34,6,7,39,1,23,7,6,15,4,21,54,54,51,50,4,22,21,20,6,4,37,
+3,36,37,95,251,48,33,47,47,33,3,39,67,77,254,167,245,36,111,62,33,1,159,109,
+102,12,18,38,43,83,30,22,48,23,177,1,75,185,19,159,7,2,1,155,41,36,36,42,
+62,58,179,241,6,8,111,1,218,91,110,13,18,39,43,80,28,8,2,3,146,248,149,35,
+77,0,0,1,255,176,0,0,4,78,4,242,0,37,0,0,49,34,38,53,52,54,51,33,50,54,53,
+52,36,35,34,6,7,39,1,23,7,6,15,4,21,54,54,51,50,4,18,21,20,6,35,33,47,47,
+33,3,39,67,77,254,167,245,36,111,62,33,1,159,109,102,12,18,38,43,83,30,22,
+48,23,186,1,76,174,164,162,41,36,36,42,62,58,179,241,6,8,111,1,218,91,110,
+13,18,39,43,80,28,8,2,3,153,254,252,160,131,137,0,0,1,0,120,252,223,6,191,
+2,236,0,59,0,0,37,22,22,23,1,22,22,21,20,6,35,34,38,39,1,38,38,53,52,54,55,
+23,6,6,21,20,22,23,1,22,22,51,50,54,53,52,38,39,1,55,23,22,22,51,50,54,53,
+52,38,39,39,55,23,23,22,22,21,20,6,7,3,203,30,59,26,2,13,63,53,179,150,74,
+159,93,253,33,111,106,34,32,115,15,16,81,87,2,237,46,103,67,74,94,25,23,252,
+159,92,41,24,51,29,72,91,41,40,165,90,101,93,48,68,130,111,145,20,38,20,254,
+120,47,98,60,111,160,61,69,2,37,83,197,109,60,110,43,72,32,58,35,82,137,64,
+253,208,35,51,67,49,23,39,17,2,129,129,29,17,18,66,59,33,57,32,125,121,77,
+74,38,101,61,101,137,6,0,0,1,0,120,252,223,6,191,2,236,0,71,0,0,33,35,34,
+38,39,21,22,31,2,22,23,5,22,22,21,20,6,35,34,38,39,1,38,38,53,52,54,55,23,
+6,6,21,20,22,23,1,22,22,51,50,54,53,52,38,39,1,55,23,22,22,51,50,54,53,52,
+38,39,39,55,23,23,22,22,21,20,6,7,21,55,55,51,5,45,10,23,112,42,9,25,54,56,
+27,12,1,34,63,53,179,150,74,159,93,253,33,111,106,34,32,115,15,16,81,87,2,
+237,46,103,67,74,94,25,23,252,159,92,41,31,51,24,72,91,41,40,168,90,104,93,
+48,68,110,89,53,136,121,13,9,7,5,16,36,38,19,9,217,47,98,60,111,160,61,69,
+2,37,83,197,109,60,110,43,72,32,58,35,82,137,64,253,208,35,51,67,49,23,39,
+17,2,129,129,29,22,15,66,59,33,57,32,127,121,79,74,38,101,61,90,125,19,13,
+3,4,0,0,1,255,176,252,223,6,159,2,236,0,72,0,0,1,22,22,21,20,6,35,34,38,39,
+1,38,38,35,35,34,38,53,52,54,51,51,50,22,23,1,22,22,51,50,54,53,52,38,39,
+1,55,23,22,22,51,50,54,53,52,38,39,39,55,23,23,22,22,21,20,6,7,21,55,55,51,
+21,35,34,38,39,21,22,31,2,22,23,6,43,63,53,179,150,74,159,93,253,10,86,109,
+52,35,33,47,47,33,53,65,142,123,3,4,46,103,67,74,94,25,23,252,159,92,41,23,
+50,33,72,91,41,40,168,90,104,93,48,68,110,89,53,136,121,10,28,115,34,9,25,
+54,56,27,12,254,187,47,98,60,111,160,61,69,2,55,63,41,42,36,36,41,48,89,253,
+190,35,51,67,49,23,39,17,2,129,129,29,17,20,66,59,33,57,32,127,121,79,74,
+38,101,61,90,125,19,13,3,4,155,16,7,8,5,16,36,38,19,9,0,1,255,176,252,223,
+6,159,3,20,0,60,0,0,37,21,22,22,23,1,22,22,21,20,6,35,34,38,39,1,38,38,35,
+35,34,38,53,52,54,51,51,50,22,23,1,22,22,51,50,54,53,52,38,39,1,55,23,22,
+22,51,50,54,53,52,38,39,39,55,23,23,22,22,21,20,6,3,171,30,59,26,2,13,63,
+53,179,150,74,159,93,253,10,86,109,52,35,33,47,47,33,53,65,142,123,3,4,46,
+103,67,74,94,25,23,252,126,92,72,24,58,24,72,91,41,40,218,90,154,93,48,68,
+130,153,8,20,38,20,254,120,47,98,60,111,160,61,69,2,55,63,41,42,36,36,41,
+48,89,253,190,35,51,67,49,23,39,17,2,154,129,52,17,20,66,59,33,57,32,165,
+121,117,74,38,101,61,101,137,0,255,255,255,155,253,150,2,115,2,69,16,39,1,
+39,0,0,254,225,16,39,1,39,0,161,253,144,16,6,0,28,0,0,255,255,255,153,253,
+91,2,196,1,110,16,39,1,39,255,254,254,166,16,39,1,39,0,158,253,85,16,6,0,
+29,20,0,0,1,0,140,253,28,4,30,1,247,0,14,0,0,1,38,2,3,51,18,18,23,18,18,55,
+51,2,0,7,1,243,100,222,37,147,55,146,96,144,165,20,141,27,254,240,135,253,
+28,219,2,246,1,10,254,225,253,245,245,1,5,2,49,233,254,165,253,59,187,0,1,
+0,140,253,28,4,170,1,247,0,26,0,0,1,38,2,3,51,18,18,23,18,18,55,51,6,6,7,
+22,22,51,23,21,34,38,39,35,6,2,7,1,243,100,222,37,147,55,146,96,144,165,20,
+141,6,23,16,18,78,44,45,84,98,29,6,56,205,96,253,28,219,2,246,1,10,254,225,
+253,245,245,1,5,2,49,233,87,152,72,18,18,1,155,34,32,212,254,51,133,0,1,0,
+120,0,0,6,39,5,108,0,47,0,0,1,23,22,22,21,20,6,7,21,22,22,21,20,6,33,33,34,
+36,53,52,55,55,52,55,55,22,22,51,33,50,54,54,53,52,36,39,39,55,50,22,23,54,
+54,53,52,38,39,39,4,124,144,114,119,79,76,103,102,242,254,238,254,61,225,
+254,249,1,1,2,133,2,186,171,1,199,151,131,75,254,246,195,57,27,100,156,61,
+57,60,61,79,144,5,108,58,46,135,83,79,122,27,6,81,223,143,200,185,208,187,
+12,8,16,8,4,8,138,158,46,104,94,188,241,19,5,143,42,32,8,63,49,46,78,32,59,
+0,1,0,120,0,0,6,207,5,108,0,52,0,0,1,23,22,22,21,20,6,7,21,22,22,21,20,6,
+7,21,54,51,51,21,33,34,36,53,52,55,55,52,55,55,22,22,51,33,50,54,54,53,52,
+36,39,39,55,50,22,23,54,54,53,52,38,39,39,4,124,144,114,119,79,76,103,102,
+33,29,28,26,176,251,145,225,254,249,1,1,2,133,2,186,171,1,199,151,131,75,
+254,246,195,57,27,100,156,61,57,60,61,79,144,5,108,58,46,135,83,79,122,27,
+6,81,223,143,73,111,42,6,2,155,208,187,12,8,16,8,4,8,138,158,46,104,94,188,
+241,19,5,143,42,32,8,63,49,46,78,32,59,0,0,1,255,176,0,0,4,218,5,108,0,46,
+0,0,1,23,22,22,21,20,6,7,21,22,22,21,20,6,7,21,54,51,51,21,33,34,38,53,52,
+54,51,33,50,54,54,53,52,36,39,39,55,50,22,23,54,54,53,52,38,39,39,2,135,144,
+114,119,79,76,103,102,33,29,28,26,176,251,38,33,47,47,33,2,58,151,131,75,
+254,246,195,57,27,100,156,61,57,60,61,79,144,5,108,58,46,135,83,79,122,27,
+6,81,223,143,73,111,42,6,2,155,41,36,36,42,46,104,94,188,241,19,5,143,42,
+32,8,63,49,46,78,32,59,0,0,1,255,176,0,0,4,50,5,108,0,41,0,0,1,23,22,22,21,
+20,6,7,21,22,22,21,20,6,33,33,34,38,53,52,54,51,33,50,54,54,53,52,36,39,39,
+55,50,22,23,54,54,53,52,38,39,39,2,135,144,114,119,79,76,103,102,242,254,
+238,253,210,33,47,47,33,2,58,151,131,75,254,246,195,57,27,100,156,61,57,60,
+61,79,144,5,108,58,46,135,83,79,122,27,6,81,223,143,200,185,41,36,36,42,46,
+104,94,188,241,19,5,143,42,32,8,63,49,46,78,32,59,0,2,0,120,255,250,5,45,
+4,1,0,37,0,49,0,0,37,35,6,6,35,33,34,38,53,52,55,55,52,55,55,22,22,51,33,
+50,54,55,1,55,19,51,54,54,51,50,22,21,20,6,7,7,19,7,2,6,21,20,22,51,50,54,
+53,52,38,35,4,115,6,26,121,115,254,228,251,216,1,1,2,133,2,144,192,1,42,72,
+80,12,254,42,131,169,7,25,87,58,89,109,105,79,4,251,133,173,54,57,42,44,56,
+57,43,77,37,40,145,171,12,8,16,8,4,8,125,92,24,25,2,223,86,254,248,51,51,
+106,87,86,107,4,5,254,125,87,3,10,55,50,50,55,55,50,50,55,0,2,0,120,0,0,5,
+69,4,1,0,41,0,53,0,0,33,34,38,53,52,55,55,52,55,55,22,22,51,33,50,54,55,1,
+55,19,51,54,54,51,50,22,21,20,6,7,7,23,22,22,51,21,34,38,39,6,6,35,18,6,21,
+20,22,51,50,54,53,52,38,35,2,75,251,216,1,1,2,133,2,144,192,1,42,73,79,12,
+254,42,131,169,7,25,87,58,89,109,105,79,4,140,32,66,37,66,100,40,27,130,115,
+148,54,57,42,44,56,57,43,145,171,12,8,16,8,4,8,125,92,25,25,2,222,86,254,
+248,51,51,106,87,86,107,4,5,216,51,46,155,46,43,47,42,3,4,55,50,50,55,55,
+50,50,55,0,2,255,176,0,0,3,149,4,1,0,35,0,47,0,0,33,34,38,39,6,6,35,33,34,
+38,53,52,54,51,33,50,54,55,1,55,19,51,54,54,51,50,22,21,20,6,7,7,23,22,22,
+51,0,6,21,20,22,51,50,54,53,52,38,35,3,149,66,100,40,27,130,115,254,73,33,
+47,47,33,1,205,73,79,12,254,42,131,169,7,25,87,58,89,109,105,79,4,140,32,
+66,37,254,182,54,57,42,44,56,57,43,46,43,47,42,41,36,36,42,25,25,2,222,86,
+254,248,51,51,106,87,86,107,4,5,216,51,46,2,105,55,50,50,55,55,50,50,55,0,
+0,2,255,176,255,250,3,125,4,1,0,31,0,43,0,0,37,35,6,6,35,33,34,38,53,52,54,
+51,33,50,54,55,1,55,19,51,54,54,51,50,22,21,20,6,7,7,19,7,2,6,21,20,22,51,
+50,54,53,52,38,35,2,195,6,26,121,115,254,73,33,47,47,33,1,205,72,80,12,254,
+42,131,169,7,25,87,58,89,109,105,79,4,251,133,173,54,57,42,44,56,57,43,77,
+37,40,41,36,36,42,24,25,2,223,86,254,248,51,51,106,87,86,107,4,5,254,125,
+87,3,10,55,50,50,55,55,50,50,55,0,0,1,0,91,0,15,3,34,2,240,0,24,0,0,37,21,
+33,53,51,53,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,22,51,3,34,253,
+57,194,64,61,218,156,47,118,54,46,84,73,110,132,75,111,100,155,140,129,6,
+42,126,74,159,201,15,24,122,23,118,101,69,116,55,0,0,1,255,176,0,0,3,9,0,
+155,0,8,0,0,33,33,34,38,53,52,54,51,33,3,9,252,247,33,47,47,33,3,9,41,36,
+36,42,0,255,255,0,234,255,231,3,210,2,246,16,39,1,39,2,91,2,9,16,39,1,39,
+2,91,255,225,16,39,1,39,3,104,0,245,16,7,1,39,1,79,0,245,255,255,0,159,2,
+15,1,110,2,246,16,7,1,39,1,4,2,9,255,255,0,159,255,26,1,110,0,1,16,7,1,39,
+1,4,255,20,255,255,0,180,1,166,1,131,3,233,16,39,1,39,1,25,2,252,16,7,1,39,
+1,25,1,160,255,255,0,159,254,139,1,110,0,206,16,39,1,39,1,4,255,225,16,7,
+1,39,1,4,254,133,255,255,0,159,2,149,2,200,3,124,16,39,1,39,1,4,2,143,16,
+7,1,39,2,94,2,143,255,255,0,159,255,231,2,34,2,40,16,39,1,39,1,4,1,59,16,
+7,1,39,1,184,255,225,255,255,0,159,255,231,2,34,2,40,16,39,1,39,1,184,1,59,
+16,7,1,39,1,4,255,225,255,255,0,159,1,167,2,34,3,233,16,39,1,39,1,4,2,252,
+16,7,1,39,1,184,1,161,255,255,0,159,254,140,2,34,0,206,16,39,1,39,1,4,255,
+225,16,7,1,39,1,184,254,134,0,3,0,245,255,233,3,173,4,150,0,23,0,35,0,47,
+0,0,1,50,54,53,53,51,21,20,22,51,51,50,54,53,53,51,21,20,22,51,51,21,33,53,
+0,22,21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,51,
+45,44,90,47,46,28,46,47,90,44,45,62,253,72,1,141,58,64,42,46,61,61,46,48,
+58,64,42,46,61,61,46,3,228,38,41,99,99,41,38,38,41,99,99,41,38,125,125,254,
+189,61,55,60,57,57,60,61,55,254,49,61,55,60,57,57,60,61,55,0,0,2,0,244,3,
+35,6,110,5,45,0,3,0,15,0,0,19,33,21,33,4,22,21,20,6,35,34,38,53,52,54,51,
+244,5,122,250,134,2,238,58,64,42,46,61,61,46,5,45,125,164,61,55,60,57,57,
+60,61,55,0,1,1,4,2,128,4,138,6,7,0,12,0,0,1,55,1,55,1,55,51,22,22,21,34,38,
+39,3,99,128,253,33,74,2,223,70,10,7,6,76,143,76,2,151,71,2,226,71,253,33,
+132,77,146,77,6,7,0,5,0,225,0,142,5,48,5,5,0,11,0,23,0,35,0,47,0,59,0,0,1,
+33,53,33,17,51,17,33,21,33,17,35,2,22,21,20,6,35,34,38,53,52,54,51,32,22,
+21,20,6,35,34,38,53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,32,22,21,
+20,6,35,34,38,53,52,54,51,2,212,254,13,1,243,105,1,243,254,13,105,165,51,
+51,34,37,49,49,37,2,26,51,51,34,37,49,49,37,34,51,51,34,37,49,49,37,254,42,
+51,51,34,37,49,49,37,2,149,105,2,7,253,249,105,253,249,3,153,44,49,48,46,
+46,48,49,44,44,49,48,46,46,48,49,44,254,0,44,49,48,46,46,48,49,44,44,49,48,
+46,46,48,49,44,0,1,255,80,255,71,0,199,6,129,0,7,0,0,7,17,35,53,33,21,35,
+17,26,150,1,119,150,185,6,244,70,70,249,12,0,2,255,13,4,67,0,229,5,254,0,
+6,0,9,0,0,19,23,1,39,55,19,5,7,7,55,180,49,254,89,49,60,4,1,47,233,6,168,
+5,254,53,254,122,53,54,1,53,24,56,164,154,0,0,2,255,26,254,87,0,243,0,18,
+0,6,0,9,0,0,3,39,1,23,7,3,37,55,55,7,180,50,1,167,50,60,4,254,209,233,6,168,
+254,87,53,1,134,53,54,254,203,24,56,165,155,0,255,255,255,162,255,5,0,97,
+5,80,16,39,1,40,0,22,4,84,16,7,1,40,255,238,254,245,0,2,255,78,4,63,0,160,
+6,6,0,15,0,27,0,0,18,22,21,20,6,7,39,54,54,55,38,38,53,52,54,51,22,38,35,
+34,6,21,20,22,23,54,54,53,93,67,107,189,42,27,47,18,18,19,80,73,53,31,26,
+37,39,16,11,48,58,6,6,73,54,68,130,130,58,20,31,14,40,71,40,77,104,107,33,
+62,45,29,53,20,38,73,37,0,0,2,255,97,254,73,0,180,0,18,0,15,0,30,0,0,2,38,
+53,52,54,55,23,6,6,7,22,22,21,20,6,35,39,6,6,21,20,22,51,50,54,53,52,38,39,
+6,7,91,68,118,178,43,27,47,18,18,18,81,72,6,26,20,30,26,38,39,16,11,18,14,
+254,73,74,54,71,135,123,59,18,33,14,40,72,39,79,103,230,26,48,20,28,32,61,
+45,29,53,21,14,13,0,0,2,255,136,4,93,0,125,6,41,0,11,0,23,0,0,18,22,21,20,
+6,35,34,38,53,52,54,51,38,22,21,20,6,35,34,38,53,52,54,51,100,25,99,39,23,
+24,98,40,38,25,99,39,23,24,98,40,5,51,28,19,38,129,27,20,39,128,246,28,19,
+38,129,27,20,38,129,0,0,1,255,10,4,82,0,229,5,168,0,23,0,0,3,54,54,51,50,
+22,21,20,6,7,39,54,54,53,52,38,39,7,39,55,39,34,6,7,246,49,122,83,95,126,
+8,5,73,3,6,31,31,77,71,77,15,56,85,39,4,220,110,94,111,131,26,53,21,17,16,
+46,14,65,74,18,204,23,203,1,75,86,0,1,255,28,254,173,0,247,0,3,0,23,0,0,23,
+6,6,35,34,38,53,52,54,55,23,6,6,21,20,22,23,55,23,7,23,50,54,55,247,49,122,
+83,95,126,8,5,73,3,6,31,31,77,71,77,15,62,81,37,135,110,94,111,131,26,53,
+21,17,16,46,14,65,74,18,204,23,203,1,81,80,0,255,255,255,49,255,5,0,209,255,
+241,16,39,1,40,255,125,254,245,16,7,1,40,0,134,254,245,255,255,255,49,254,
+132,0,209,255,241,16,39,1,40,255,125,254,116,16,7,1,40,0,134,254,245,0,1,
+255,16,4,67,0,226,5,253,0,11,0,0,19,23,1,39,55,39,7,39,1,23,7,23,178,48,254,
+205,47,127,64,126,49,1,51,49,126,64,5,128,50,254,245,51,111,72,109,52,1,9,
+50,110,73,0,0,1,255,30,254,87,0,240,0,18,0,11,0,0,3,39,1,23,7,23,55,23,1,
+39,55,39,178,48,1,51,47,127,64,126,49,254,204,48,126,64,254,213,50,1,11,52,
+110,72,109,52,254,246,51,110,73,0,255,255,255,180,255,5,0,75,255,241,18,7,
+1,40,0,0,254,245,0,2,255,42,4,85,0,213,6,25,0,7,0,19,0,0,19,7,39,7,39,1,23,
+7,6,22,21,20,6,35,34,38,53,52,54,51,213,55,162,154,56,1,44,57,97,23,36,36,
+25,27,35,35,27,4,202,52,177,171,45,1,80,44,110,161,32,35,36,34,34,36,35,32,
+0,2,255,42,254,60,0,214,0,0,0,7,0,19,0,0,7,55,23,55,23,1,39,55,54,38,53,52,
+54,51,50,22,21,20,6,35,214,56,162,155,55,254,211,56,96,25,38,38,24,27,35,
+35,27,117,52,177,171,45,254,176,44,110,161,32,35,35,35,35,35,35,32,0,255,
+255,255,180,4,101,0,75,5,81,18,7,1,40,0,0,4,85,255,255,254,129,2,141,255,
+80,3,116,16,7,1,39,254,230,2,135,255,255,255,124,4,104,0,21,5,17,16,7,1,41,
+255,201,4,104,255,255,255,179,255,45,0,76,255,214,18,7,1,41,0,0,255,45,255,
+255,255,180,4,85,0,77,5,252,16,39,1,41,0,1,4,85,16,7,1,41,0,1,5,83,255,255,
+255,180,254,90,0,77,0,1,16,39,1,41,0,1,254,90,16,7,1,41,0,1,255,88,255,255,
+255,40,4,85,0,218,5,252,16,39,1,41,0,142,4,85,16,39,1,41,0,1,5,83,16,7,1,
+41,255,117,4,85,255,255,255,40,254,90,0,218,0,1,16,39,1,41,0,142,255,88,16,
+39,1,41,0,1,254,90,16,7,1,41,255,117,255,88,0,1,255,25,4,49,0,208,5,172,0,
+3,0,0,19,23,1,39,151,57,254,131,58,5,172,61,254,194,61,0,0,1,255,24,254,167,
+0,208,0,36,0,3,0,0,7,55,1,7,232,59,1,125,58,27,63,254,194,63,0,1,254,159,
+4,87,1,105,6,58,0,43,0,0,3,23,7,23,55,23,7,23,55,23,7,23,55,23,7,23,55,23,
+7,23,7,39,7,39,55,39,7,39,55,39,7,39,55,39,7,39,55,39,7,39,55,39,55,23,132,
+43,57,48,57,43,58,49,58,41,58,49,59,41,59,49,59,41,59,147,27,146,61,42,61,
+48,61,42,61,48,61,42,61,49,62,42,63,49,62,42,63,139,27,137,6,58,24,100,28,
+101,26,100,27,100,23,102,28,102,25,100,28,101,24,102,85,43,83,105,24,106,
+28,106,25,104,28,105,23,107,27,104,23,106,29,107,24,106,81,44,80,0,0,5,255,
+7,4,85,0,247,6,87,0,11,0,23,0,35,0,47,0,59,0,0,3,35,53,51,53,51,21,51,21,
+35,21,35,2,22,21,20,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,
+51,22,22,21,20,6,35,34,38,53,52,54,51,34,22,21,20,6,35,34,38,53,52,54,51,
+25,224,224,49,223,223,49,73,23,23,16,17,21,21,17,242,23,23,14,17,23,23,17,
+14,23,23,14,17,23,23,17,212,23,23,16,17,21,21,17,5,62,48,233,233,48,233,1,
+158,19,23,21,20,20,21,23,19,19,23,21,20,20,21,23,19,231,19,22,21,21,21,21,
+22,19,19,22,21,21,21,21,22,19,0,0,1,254,245,4,84,1,12,5,11,0,19,0,0,18,54,
+55,51,6,6,35,34,38,35,34,6,7,35,54,54,51,50,22,51,151,34,8,75,8,82,68,48,
+140,37,35,34,7,76,9,82,68,52,139,33,4,181,39,45,88,93,85,39,45,88,94,86,0,
+1,254,251,4,103,1,5,4,196,0,3,0,0,1,33,21,33,254,251,2,10,253,246,4,196,93,
+0,255,255,255,153,4,91,0,104,5,66,16,7,1,39,255,254,4,85,255,255,254,234,
+4,91,1,18,5,66,16,39,1,39,255,79,4,85,16,7,1,39,0,168,4,85,0,2,255,124,4,
+97,0,132,5,103,0,11,0,23,0,0,2,38,53,52,54,51,50,22,21,20,6,35,54,54,53,52,
+38,35,34,6,21,20,22,51,58,74,74,58,57,75,77,55,29,37,38,28,29,38,38,29,4,
+97,69,60,58,75,66,62,60,74,61,37,33,33,37,37,33,33,37,0,255,255,255,154,255,
+20,0,105,255,251,16,7,1,39,255,255,255,14,255,255,254,234,255,26,1,18,0,1,
+16,39,1,39,255,79,255,20,16,7,1,39,0,168,255,20,0,2,255,124,254,238,0,132,
+255,244,0,11,0,23,0,0,22,22,21,20,6,35,34,38,53,52,54,51,6,6,21,20,22,51,
+50,54,53,52,38,35,58,74,74,58,57,75,77,55,29,37,38,28,29,38,38,29,12,69,60,
+58,75,66,62,60,74,61,37,33,33,37,37,33,33,37,0,1,255,11,255,51,0,245,0,0,
+0,19,0,0,7,55,55,54,55,55,51,22,22,23,23,21,35,38,39,39,7,6,7,35,245,51,53,
+27,25,46,89,29,80,40,50,103,31,38,75,77,40,35,91,196,47,51,26,26,46,32,79,
+38,47,9,24,33,65,63,32,27,0,1,254,253,255,132,1,6,0,101,0,13,0,0,55,51,6,
+6,35,34,38,39,51,22,22,51,50,54,183,79,8,147,111,113,137,5,79,14,90,76,78,
+94,101,101,124,117,108,64,66,73,0,1,254,244,255,74,1,11,0,2,0,19,0,0,6,6,
+7,35,54,54,51,50,22,51,50,54,55,51,6,6,35,34,38,35,151,35,8,74,8,82,68,48,
+140,37,35,34,7,76,9,82,68,52,138,34,97,38,45,88,94,85,38,45,88,94,85,0,0,
+1,254,251,255,150,1,5,255,238,0,3,0,0,5,33,53,33,1,5,253,246,2,10,106,88,
+0,2,255,56,4,77,0,191,5,190,0,3,0,7,0,0,19,23,5,39,1,23,5,39,188,3,254,135,
+3,1,110,3,254,135,3,5,34,71,142,71,1,42,72,142,72,0,0,2,255,18,4,76,0,189,
+5,188,0,29,0,42,0,0,3,55,54,55,38,38,53,52,54,51,50,22,21,20,6,7,7,39,54,
+54,53,52,38,39,39,50,22,21,20,6,54,22,23,55,54,54,53,52,38,35,34,6,21,132,
+64,32,26,20,25,75,53,48,68,113,158,113,6,10,8,25,27,3,51,67,4,135,23,20,7,
+24,35,29,23,23,34,4,167,27,13,12,16,51,31,53,74,63,50,71,83,59,42,67,14,28,
+16,20,34,2,68,54,51,12,28,115,36,11,3,10,35,26,23,28,30,26,0,2,255,56,254,
+154,0,191,0,11,0,3,0,7,0,0,23,23,5,39,1,23,5,39,188,3,254,135,3,1,110,3,254,
+135,3,145,71,142,71,1,42,72,142,72,0,1,255,67,4,77,0,191,5,34,0,3,0,0,19,
+23,5,39,188,3,254,135,3,5,34,71,142,71,0,2,255,61,4,77,0,184,5,184,0,17,0,
+30,0,0,3,54,55,55,54,55,38,38,53,52,54,51,50,22,21,20,6,7,54,22,23,55,54,
+54,53,52,38,35,34,6,21,195,15,22,93,24,21,20,29,79,54,48,72,138,238,192,25,
+20,7,32,32,28,29,24,35,4,150,5,8,35,9,9,16,45,34,54,75,63,50,78,90,82,212,
+35,11,2,15,35,23,20,29,30,26,0,0,1,255,56,255,53,0,180,0,11,0,3,0,0,55,23,
+5,39,177,3,254,135,3,11,72,142,72,0,0,1,255,15,4,89,0,175,5,130,0,36,0,0,
+3,6,6,35,34,38,53,53,55,20,22,51,50,54,53,52,38,39,55,22,22,51,50,54,53,52,
+38,39,55,22,22,21,20,6,35,34,38,15,6,55,48,54,63,59,31,31,31,24,7,5,63,16,
+36,24,26,22,26,12,60,20,23,62,47,25,43,4,198,51,58,84,64,9,18,47,58,44,27,
+17,36,14,24,56,39,32,23,27,41,14,23,20,54,32,58,66,21,0,0,2,255,110,4,85,
+0,128,5,101,0,11,0,23,0,0,2,38,53,52,54,51,50,22,21,20,6,35,38,22,51,50,54,
+53,52,38,35,34,6,21,69,77,82,52,59,81,79,58,73,39,32,37,38,41,32,32,41,4,
+85,74,59,56,83,81,62,53,76,106,41,42,29,32,38,42,29,0,0,1,254,252,4,68,0,
+237,4,224,0,22,0,0,1,54,54,55,55,54,55,22,22,51,50,54,55,23,6,6,35,34,38,
+39,6,7,7,254,252,11,27,14,27,12,9,68,89,44,43,80,31,42,34,120,53,57,81,37,
+8,17,34,4,103,15,34,17,31,14,8,25,15,23,19,60,27,36,19,17,8,20,41,0,0,1,255,
+97,4,85,0,138,5,152,0,26,0,0,19,21,5,53,55,38,38,53,52,54,51,50,22,23,7,38,
+38,35,34,6,21,20,22,51,55,50,55,138,254,215,62,22,16,92,64,20,56,23,23,19,
+34,16,38,46,40,35,15,7,5,4,196,76,35,75,7,20,49,20,67,85,10,12,66,7,4,39,
+35,28,45,1,1,0,0,1,255,97,254,190,0,138,0,0,0,24,0,0,23,21,5,53,55,38,38,
+53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,55,138,254,215,62,22,16,
+93,63,20,56,23,23,36,33,38,46,43,32,5,5,212,76,34,74,7,20,50,20,67,84,9,11,
+68,13,41,35,31,42,1,0,1,255,209,4,85,0,47,5,198,0,3,0,0,19,17,35,17,47,94,
+5,198,254,143,1,113,255,255,254,227,4,89,0,175,6,222,18,38,0,185,0,0,16,7,
+0,180,255,209,1,34,255,255,255,13,4,77,0,191,6,237,18,38,0,179,0,0,16,7,0,
+185,255,254,1,107,255,255,255,9,4,89,0,175,6,216,18,38,0,185,0,0,16,7,0,179,
+255,209,1,26,255,255,255,15,4,89,0,175,6,60,18,38,0,185,0,0,16,7,0,182,255,
+209,1,26,255,255,255,14,4,89,0,175,6,214,18,38,0,185,0,0,16,7,0,183,255,209,
+1,30,255,255,255,23,4,77,0,191,6,82,18,38,0,182,0,0,16,7,0,185,0,8,0,208,
+0,2,255,15,4,89,0,175,6,219,0,36,0,40,0,0,3,6,6,35,34,38,53,53,55,20,22,51,
+50,54,53,52,38,39,55,22,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,
+3,17,35,17,15,6,55,48,54,63,59,31,31,31,24,7,5,63,16,36,24,26,22,26,12,60,
+20,23,62,47,25,43,4,84,4,198,51,58,84,64,9,18,47,58,44,27,17,36,14,24,56,
+39,32,23,27,41,14,23,20,54,32,58,66,21,2,42,254,201,1,55,0,255,255,255,38,
+4,85,0,173,7,35,18,38,0,188,0,0,16,7,0,179,255,238,1,101,255,255,255,49,4,
+85,0,173,6,145,18,38,0,188,0,0,16,7,0,182,255,238,1,111,255,255,255,0,4,85,
+0,171,7,33,18,38,0,188,0,0,16,7,0,180,255,238,1,101,255,255,255,43,4,85,0,
+166,7,29,18,38,0,188,0,0,16,7,0,183,255,238,1,101,255,255,255,97,4,85,0,138,
+7,3,18,38,0,188,0,0,16,7,0,186,0,1,1,158,255,255,255,56,253,185,0,180,0,0,
+18,38,0,189,0,0,16,7,0,184,0,0,254,132,255,255,255,56,253,40,0,191,0,0,18,
+38,0,189,0,0,16,7,0,181,0,0,254,142,0,1,0,60,1,103,1,73,2,111,0,11,0,0,18,
+38,53,52,54,51,50,22,21,20,6,35,143,83,85,48,50,86,79,51,1,103,75,59,53,77,
+76,54,58,76,0,1,0,191,0,0,1,128,4,176,0,3,0,0,1,19,35,3,1,78,50,143,50,4,
+176,251,80,4,176,0,0,1,0,50,0,0,3,35,4,176,0,21,0,0,33,35,3,38,2,39,51,23,
+22,22,51,50,54,55,51,6,6,35,34,38,39,35,1,134,146,101,23,50,20,148,15,28,
+102,57,115,120,30,138,32,198,155,44,92,38,1,2,129,145,1,47,111,92,33,36,77,
+84,148,156,17,25,0,1,0,50,0,0,3,151,4,176,0,37,0,0,1,51,20,6,7,22,22,51,50,
+54,55,51,20,6,35,34,38,39,6,6,35,34,38,39,7,19,35,3,38,2,39,51,23,22,22,51,
+50,54,1,193,132,13,8,15,52,29,67,61,3,132,140,113,59,80,30,30,79,42,23,51,
+21,2,141,146,101,23,50,20,148,23,17,60,31,60,55,4,176,49,79,25,20,19,97,95,
+154,173,32,27,35,25,10,16,1,252,127,2,129,145,1,47,111,139,26,29,96,0,0,1,
+0,60,255,251,2,246,4,204,0,41,0,0,1,6,6,21,20,22,23,23,22,22,21,20,6,7,7,
+6,6,21,20,22,51,50,54,55,21,6,6,35,34,38,53,52,54,55,55,39,38,38,53,52,36,
+37,2,62,184,191,106,102,56,73,47,21,56,143,69,58,132,121,63,138,68,66,131,
+81,204,180,117,156,50,137,116,106,1,0,1,2,4,69,50,106,59,36,53,25,14,19,49,
+41,19,51,50,125,61,77,35,40,42,19,16,142,17,22,105,101,87,166,122,39,36,32,
+106,75,125,185,54,0,0,2,0,70,0,80,3,92,4,60,0,11,0,23,0,0,18,18,51,50,18,
+21,20,6,35,34,38,53,36,38,35,34,6,21,20,22,51,50,54,53,70,226,178,181,205,
+210,189,180,211,2,128,128,108,116,138,124,117,126,123,2,254,1,62,254,217,
+232,231,246,236,219,188,209,213,185,144,160,159,163,0,1,0,20,0,0,2,225,4,
+189,0,21,0,0,1,34,38,39,55,22,22,51,23,33,21,20,18,23,23,22,23,23,35,38,2,
+39,1,141,91,193,93,17,54,164,70,72,1,17,15,10,14,7,8,13,147,20,40,2,4,32,
+8,11,138,5,7,1,96,89,254,185,131,205,100,90,162,229,2,124,191,0,0,1,0,0,0,
+0,3,188,4,176,0,26,0,0,1,3,6,7,7,6,7,7,35,3,39,38,2,39,51,22,23,19,19,23,
+51,54,55,55,54,54,55,3,188,142,41,42,83,41,35,61,122,110,68,53,99,59,169,
+21,24,103,101,42,5,44,41,81,44,81,41,4,176,254,134,109,115,224,109,96,169,
+1,99,213,162,1,43,171,65,77,254,183,254,182,142,124,119,236,129,226,109,0,
+0,1,0,10,0,0,3,198,4,176,0,30,0,0,51,55,19,54,55,55,54,55,51,22,23,23,22,
+22,23,23,22,23,35,3,39,39,38,39,35,6,7,7,6,6,7,10,61,154,41,38,72,34,24,122,
+23,30,64,35,75,37,75,37,34,169,156,55,51,25,20,5,42,39,77,42,77,39,172,1,
+174,115,109,206,96,72,71,90,193,106,221,106,215,106,92,1,215,170,160,77,65,
+125,118,235,130,226,109,0,0,2,0,30,0,0,3,4,4,203,0,14,0,27,0,0,33,3,6,6,35,
+34,38,53,52,54,51,50,22,23,19,3,39,38,38,35,34,6,21,20,22,51,50,54,2,112,
+49,47,114,51,158,175,201,135,149,168,17,72,209,6,9,81,100,76,119,99,106,51,
+86,2,73,25,27,162,140,149,243,196,209,252,202,2,208,96,136,132,134,101,79,
+90,19,0,0,3,0,130,255,236,3,131,4,176,0,3,0,15,0,27,0,0,1,1,35,1,4,38,53,
+52,54,51,50,22,21,20,6,35,0,38,53,52,54,51,50,22,21,20,6,35,3,131,253,150,
+151,2,108,253,234,77,77,43,46,77,69,48,1,191,77,77,43,46,77,69,48,4,176,251,
+80,4,176,238,67,54,48,69,70,47,51,70,252,42,67,54,48,69,70,47,51,70,0,1,0,
+112,254,248,1,133,0,238,0,9,0,0,37,23,6,2,7,35,54,63,2,1,118,15,30,90,32,
+125,13,16,31,55,238,23,106,254,228,89,52,67,136,247,0,1,0,109,2,186,1,130,
+4,176,0,9,0,0,1,23,6,2,7,35,54,63,2,1,115,15,30,90,32,125,13,16,31,55,4,176,
+23,106,254,228,89,52,67,136,247,0,0,1,0,152,255,227,1,137,0,242,0,11,0,0,
+36,22,21,20,6,35,34,38,53,52,54,51,1,72,65,66,57,51,67,61,57,242,69,67,66,
+69,63,72,67,69,0,1,0,130,0,0,1,151,1,246,0,11,0,0,51,39,54,18,55,51,6,7,7,
+6,6,7,145,15,30,90,32,125,13,15,32,15,29,11,23,106,1,28,89,52,67,136,63,132,
+52,0,0,2,0,170,255,227,1,233,4,115,0,8,0,20,0,0,19,39,54,54,55,51,6,6,7,2,
+22,21,20,6,35,34,38,53,52,54,51,217,15,31,75,56,125,32,52,21,38,65,66,57,
+51,67,61,57,2,125,23,118,236,125,121,247,134,254,117,69,67,66,69,63,72,67,
+69,0,0,2,0,170,255,227,1,155,3,116,0,11,0,21,0,0,36,22,21,20,6,35,34,38,53,
+52,54,51,18,21,20,6,35,34,38,53,52,51,1,90,65,66,57,51,67,61,57,123,66,57,
+51,67,118,242,69,67,66,69,63,72,67,69,2,130,135,66,69,63,72,135,255,255,0,
+152,255,227,5,54,0,242,16,38,0,218,0,0,16,39,0,218,1,214,0,0,16,7,0,218,3,
+173,0,0,0,2,0,66,255,240,2,236,4,240,0,24,0,35,0,0,1,53,52,38,38,53,52,54,
+51,50,22,23,7,38,38,35,34,6,21,20,30,2,21,21,2,38,53,52,54,51,50,21,20,6,
+35,1,147,229,108,203,159,82,156,82,60,60,125,68,98,115,70,168,77,123,58,57,
+52,108,60,48,1,147,33,106,163,139,100,140,180,41,42,124,29,33,94,74,57,97,
+125,132,83,54,254,93,64,58,60,63,123,65,57,0,0,2,0,183,255,240,1,144,4,220,
+0,3,0,14,0,0,1,35,3,51,2,22,21,20,6,35,34,38,53,52,51,1,89,105,45,195,47,
+57,58,51,48,60,108,1,147,3,73,252,9,63,60,58,64,57,65,123,0,1,0,82,254,138,
+2,33,5,132,0,13,0,0,1,51,6,2,21,20,18,23,35,38,2,17,16,18,1,127,162,145,144,
+147,140,160,148,153,154,5,132,194,254,52,245,237,254,51,189,171,1,195,1,7,
+1,10,1,204,0,1,0,61,254,138,2,12,5,132,0,13,0,0,19,35,54,18,53,52,2,39,51,
+22,18,17,16,2,223,160,139,148,144,145,162,149,152,154,254,138,188,1,204,239,
+245,1,204,194,178,254,48,254,253,254,247,254,61,0,0,1,0,160,254,188,2,105,
+5,140,0,7,0,0,1,33,17,33,21,33,17,33,2,105,254,55,1,201,254,213,1,43,254,
+188,6,208,136,250,65,0,0,1,0,50,254,188,1,251,5,140,0,7,0,0,23,33,17,33,53,
+33,17,33,50,1,43,254,213,1,201,254,55,187,5,191,136,249,48,0,0,1,0,160,3,
+84,4,130,7,115,0,5,0,0,1,21,33,17,35,17,4,130,252,134,104,7,115,104,252,73,
+4,31,0,1,255,206,3,84,3,176,7,115,0,5,0,0,1,17,35,17,33,53,3,176,104,252,
+134,7,115,251,225,3,183,104,255,255,0,160,3,84,4,130,7,115,18,6,0,229,0,0,
+255,255,255,206,3,84,3,176,7,115,18,6,0,230,0,0,0,2,0,82,255,253,3,170,3,
+70,0,6,0,13,0,0,19,1,23,1,1,7,1,37,1,23,1,1,7,1,82,1,86,119,254,223,1,33,
+119,254,170,1,139,1,88,117,254,225,1,31,117,254,168,1,175,1,151,69,254,162,
+254,161,71,1,151,27,1,151,69,254,162,254,161,71,1,151,0,2,0,80,255,253,3,
+168,3,70,0,6,0,13,0,0,1,1,39,1,1,55,1,5,1,39,1,1,55,1,3,168,254,168,117,1,
+31,254,225,117,1,88,254,117,254,168,117,1,31,254,225,117,1,88,1,148,254,105,
+71,1,95,1,94,69,254,105,27,254,105,71,1,95,1,94,69,254,105,0,0,1,0,70,2,73,
+3,24,5,0,0,14,0,0,1,3,37,23,5,23,7,3,3,39,55,37,55,5,3,1,247,24,1,37,20,254,
+238,174,131,133,122,134,169,254,241,22,1,32,24,5,0,254,225,72,138,28,242,
+72,1,7,254,249,72,242,28,138,72,1,31,0,0,1,0,130,0,152,4,19,4,70,0,11,0,0,
+1,33,21,33,17,35,17,33,53,33,17,51,2,140,1,135,254,121,132,254,122,1,134,
+132,2,176,132,254,108,1,148,132,1,150,0,1,0,130,2,44,4,19,2,176,0,3,0,0,19,
+53,33,21,130,3,145,2,44,132,132,0,0,2,0,145,1,107,4,5,3,113,0,3,0,7,0,0,19,
+53,33,21,1,53,33,21,145,3,116,252,140,3,116,2,239,130,130,254,124,130,130,
+0,0,1,0,90,255,4,3,85,5,140,0,3,0,0,1,1,35,1,3,85,253,147,142,2,110,5,140,
+249,120,6,136,0,0,1,0,32,255,149,2,249,4,236,0,3,0,0,1,1,35,1,2,249,253,184,
+145,2,73,4,236,250,169,5,87,0,0,1,0,23,0,0,2,221,5,182,0,3,0,0,19,1,35,1,
+186,2,35,166,253,224,5,182,250,74,5,182,0,1,0,84,1,217,2,63,2,113,0,3,0,0,
+19,53,33,21,84,1,235,1,217,152,152,0,0,2,0,115,2,155,2,163,4,203,0,11,0,23,
+0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,51,
+2,0,163,165,115,120,160,165,115,75,101,101,75,75,101,101,75,4,203,157,123,
+115,165,159,121,115,165,254,56,101,75,77,99,99,77,75,101,0,0,8,0,170,0,104,
+4,45,3,237,0,5,0,11,0,17,0,23,0,29,0,35,0,41,0,47,0,0,1,38,39,55,22,23,3,
+38,39,53,22,23,19,6,7,39,54,55,1,6,7,39,54,55,7,6,7,35,54,55,1,6,7,53,54,
+55,37,38,39,51,22,23,23,38,39,55,22,23,3,238,20,56,45,81,13,219,83,95,117,
+106,174,12,78,47,59,12,254,70,98,78,45,101,120,254,59,13,63,12,78,2,121,101,
+122,96,80,253,184,77,17,65,16,60,250,116,107,47,77,99,2,96,103,77,47,105,
+122,1,4,59,12,66,12,78,254,96,116,107,47,84,92,1,184,17,58,47,77,17,219,83,
+95,123,102,253,133,77,17,65,16,60,33,101,120,96,80,215,12,78,45,57,12,0,0,
+1,0,180,254,191,6,116,6,15,0,31,0,0,1,33,17,39,55,23,55,23,7,17,33,55,23,
+7,23,7,39,33,17,23,7,39,7,39,55,17,33,7,39,55,39,55,1,148,1,181,183,80,181,
+182,73,183,1,181,136,88,109,109,88,136,254,75,183,80,181,182,73,183,254,75,
+136,88,108,108,88,3,104,1,198,137,88,109,109,88,136,254,57,174,71,181,182,
+64,174,252,206,137,88,109,109,88,136,3,51,174,71,181,182,64,0,1,0,180,254,
+191,6,76,6,15,0,47,0,0,1,35,38,38,53,52,54,55,51,23,33,17,39,53,54,54,51,
+50,22,23,21,7,17,33,55,51,22,22,21,20,6,7,35,39,33,17,23,21,6,6,35,34,38,
+39,53,55,17,33,1,36,48,24,40,38,26,48,56,1,217,160,30,143,66,65,133,33,160,
+1,216,57,48,26,38,40,24,48,56,254,39,160,34,140,65,66,135,30,160,254,40,2,
+50,30,143,66,65,133,33,160,1,254,57,48,24,40,38,26,48,56,254,1,160,34,140,
+65,66,135,30,160,252,150,57,48,26,38,40,24,48,56,3,107,255,255,0,106,254,
+245,2,147,3,213,16,39,1,39,0,207,2,232,16,39,1,39,2,41,2,232,16,6,0,28,0,
+0,255,255,0,56,254,181,2,176,3,3,16,39,1,39,0,157,2,22,16,39,1,39,1,247,2,
+22,16,6,0,29,0,0,0,1,0,129,255,63,2,91,5,100,0,22,0,0,1,17,20,22,51,50,22,
+21,20,6,35,34,38,39,35,6,6,7,39,54,54,53,17,1,94,82,73,47,51,45,35,69,85,
+24,6,11,43,34,122,31,40,5,100,251,193,69,79,45,34,36,40,42,40,88,132,45,61,
+54,212,155,4,67,255,255,0,129,255,63,2,91,5,100,18,6,0,249,0,0,0,1,0,154,
+255,63,2,241,5,100,0,24,0,0,5,34,38,39,35,6,6,7,39,54,54,53,17,51,17,20,22,
+51,51,50,22,21,20,6,35,2,61,69,110,24,6,11,43,34,122,31,40,150,102,83,95,
+47,51,45,35,10,42,40,88,132,45,61,54,212,155,4,67,251,218,79,94,45,34,36,
+40,0,255,255,0,154,255,63,2,241,5,100,18,6,0,251,0,0,0,1,255,176,255,246,
+1,49,5,100,0,14,0,0,19,51,17,20,6,35,34,38,53,52,54,51,50,54,53,155,150,155,
+132,48,50,49,31,81,74,5,100,251,164,123,151,41,33,39,42,74,69,0,0,1,255,176,
+255,246,2,3,5,100,0,23,0,0,19,51,17,20,22,51,51,21,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,54,53,155,150,96,104,10,10,103,124,29,35,115,81,48,50,49,
+31,81,74,5,100,251,130,38,37,155,44,45,45,54,41,33,39,42,74,69,0,0,1,255,
+176,255,246,1,49,3,93,0,14,0,0,19,51,17,20,6,35,34,38,53,52,54,51,50,54,53,
+155,150,155,132,48,50,49,31,81,74,3,93,253,171,123,151,41,33,39,42,74,69,
+0,0,1,255,176,255,246,2,3,3,93,0,23,0,0,19,51,17,20,22,51,51,21,35,34,38,
+39,6,6,35,34,38,53,52,54,51,50,54,53,155,150,96,104,10,10,103,124,29,35,115,
+81,48,50,49,31,81,74,3,93,253,137,38,37,155,44,45,45,54,41,33,39,42,74,69,
+0,255,255,255,176,0,0,5,120,5,140,16,39,0,59,1,92,0,0,16,6,1,44,0,0,255,255,
+255,176,255,232,5,130,5,140,16,39,0,60,1,94,0,0,16,6,1,44,0,0,255,255,255,
+176,253,121,7,48,4,189,16,39,1,44,1,68,0,0,16,39,0,42,2,87,0,0,16,6,1,44,
+0,0,255,255,255,176,253,121,5,110,5,62,16,39,1,44,1,66,0,0,16,39,0,43,2,90,
+0,0,16,6,1,44,0,0,255,255,255,176,253,121,7,48,4,189,16,39,1,42,1,247,0,40,
+16,39,1,44,1,68,0,0,16,39,0,42,2,87,0,0,16,6,1,44,0,0,255,255,255,176,253,
+121,5,110,5,62,16,39,1,42,1,248,0,40,16,39,1,44,1,69,0,0,16,39,0,43,2,90,
+0,0,16,6,1,44,0,0,255,255,0,140,253,118,2,115,2,69,16,39,1,39,1,45,253,112,
+16,6,1,9,0,0,255,255,0,140,253,63,3,123,1,110,16,39,1,39,1,20,253,57,16,6,
+1,10,0,0,0,1,0,140,254,245,2,115,2,69,0,16,0,0,1,39,54,54,55,46,2,53,52,54,
+51,50,22,21,20,2,1,21,105,48,98,37,5,134,76,142,101,108,136,179,254,245,89,
+44,95,48,27,93,121,73,94,164,153,132,134,254,225,0,0,1,0,140,254,181,3,123,
+1,110,0,28,0,0,23,54,54,53,38,39,39,38,38,53,52,54,51,50,30,2,51,51,21,35,
+34,39,39,34,39,6,6,7,170,48,72,5,26,55,35,29,94,67,63,89,67,93,155,123,220,
+27,28,57,29,23,35,133,81,238,50,113,32,26,25,51,34,68,45,66,94,62,104,45,
+155,1,2,4,103,169,66,0,255,255,0,140,254,245,2,115,3,213,16,39,1,39,1,138,
+2,232,16,6,1,9,0,0,255,255,0,140,254,181,3,123,3,3,16,39,1,39,1,88,2,22,16,
+6,1,10,0,0,255,255,255,155,253,150,2,135,2,69,16,39,1,39,0,0,254,225,16,39,
+1,39,0,161,253,144,16,6,1,9,20,0,255,255,255,153,253,91,3,143,1,110,16,39,
+1,39,255,254,254,166,16,39,1,39,0,158,253,85,16,6,1,10,20,0,255,255,0,106,
+254,245,2,147,3,213,16,39,1,39,0,207,2,232,16,39,1,39,2,41,2,232,16,6,1,9,
+0,0,0,3,0,56,254,181,4,51,3,3,0,11,0,23,0,52,0,0,18,22,21,20,6,35,34,38,53,
+52,54,51,32,22,21,20,6,35,34,38,53,52,54,51,1,54,54,53,38,39,39,38,38,53,
+52,54,51,50,30,2,51,33,21,33,34,39,39,34,39,6,6,7,208,55,56,50,44,57,53,48,
+1,141,55,56,50,44,57,53,48,254,179,48,72,5,26,55,35,29,94,67,62,88,68,89,
+131,1,80,254,125,30,32,64,32,23,35,133,81,3,3,59,57,56,59,53,62,57,59,59,
+57,56,59,53,62,57,59,252,15,50,113,32,26,25,51,34,68,45,66,94,60,103,48,155,
+1,2,4,103,169,66,255,255,254,154,252,244,1,194,1,218,16,6,0,89,42,0,255,255,
+254,152,252,244,2,48,1,218,16,6,0,90,40,0,255,255,0,120,252,223,6,191,1,224,
+16,38,0,19,0,0,16,7,1,43,5,45,0,0,255,255,255,176,252,223,6,159,1,28,16,38,
+0,20,0,0,16,7,1,43,5,13,0,0,255,255,0,120,252,223,6,191,1,224,16,39,1,42,
+1,174,0,80,16,38,0,19,0,0,16,7,1,43,5,45,0,0,255,255,255,176,252,223,6,159,
+1,28,16,39,1,42,1,142,0,80,16,38,0,20,0,0,16,7,1,43,5,13,0,0,255,255,0,120,
+252,223,6,191,2,236,16,38,0,108,0,0,16,7,1,43,5,45,0,0,255,255,255,176,252,
+223,6,159,2,236,16,38,0,109,0,0,16,7,1,43,5,13,0,0,255,255,0,120,252,223,
+6,191,1,224,16,38,0,19,0,0,16,7,1,44,5,45,0,0,255,255,255,176,252,223,6,159,
+1,28,16,38,0,20,0,0,16,7,1,44,5,13,0,0,255,255,0,120,252,223,6,191,1,224,
+16,39,1,42,1,174,0,80,16,38,0,19,0,0,16,7,1,44,5,45,0,0,255,255,255,176,252,
+223,6,159,1,28,16,39,1,42,1,142,0,80,16,38,0,20,0,0,16,7,1,44,5,13,0,0,255,
+255,0,120,252,223,6,191,2,236,16,38,0,108,0,0,16,7,1,44,5,45,0,0,255,255,
+255,176,252,223,6,159,2,236,16,38,0,109,0,0,16,7,1,44,5,13,0,0,0,1,0,140,
+252,206,2,166,0,155,0,14,0,0,33,6,21,20,18,23,7,38,2,53,52,54,51,33,21,1,
+41,2,204,179,118,194,226,50,60,1,132,4,8,146,254,140,192,96,187,1,179,187,
+85,79,155,0,0,1,0,139,252,206,2,166,0,155,0,14,0,0,33,6,21,20,18,23,7,38,
+2,53,52,54,51,51,21,1,41,2,203,180,118,181,240,81,96,6,4,11,142,254,139,192,
+96,173,1,185,164,89,106,155,0,1,255,176,0,0,2,39,3,98,0,34,0,0,1,22,22,21,
+21,20,6,7,22,22,51,51,21,35,34,38,39,6,6,35,34,38,53,52,54,51,51,50,54,54,
+55,53,52,38,39,1,62,15,16,10,9,15,110,76,20,29,100,130,37,46,111,89,42,47,
+47,33,46,70,62,19,2,18,11,3,98,61,225,84,68,57,127,41,23,25,155,36,47,46,
+37,41,36,36,42,54,94,130,56,80,215,60,0,1,255,176,0,0,1,93,3,98,0,25,0,0,
+1,22,22,23,23,20,23,20,6,6,35,34,38,53,52,54,51,51,50,54,54,55,53,52,38,39,
+1,62,9,15,4,2,1,59,143,137,43,47,47,33,48,63,66,20,2,19,10,3,98,38,149,89,
+63,28,13,223,172,91,41,36,36,42,55,94,130,55,47,251,57,0,0,1,254,79,0,0,3,
+84,5,140,0,24,0,0,1,55,1,22,22,51,21,34,38,39,6,6,35,33,34,38,53,52,54,51,
+33,55,50,54,55,254,79,117,4,23,30,59,32,60,90,38,29,121,110,254,108,33,47,
+47,33,1,170,30,31,57,19,5,35,105,251,84,34,35,155,39,33,37,35,41,36,36,42,
+1,11,11,0,1,254,79,255,232,3,92,5,140,0,19,0,0,37,7,39,6,6,35,33,34,38,53,
+52,54,51,33,55,50,54,55,1,55,3,92,120,80,30,120,106,254,108,33,47,47,33,1,
+170,30,31,57,19,252,28,117,77,101,91,35,32,41,36,36,42,1,11,11,4,113,105,
+0,255,255,255,201,4,101,0,96,5,81,16,7,1,40,0,21,4,85,255,255,255,161,255,
+6,0,56,255,242,16,7,1,40,255,237,254,246,0,1,255,155,0,6,0,106,0,237,0,11,
+0,0,54,22,21,20,6,35,34,38,53,52,54,51,51,55,56,50,44,57,53,48,237,59,57,
+56,59,53,62,57,59,0,0,1,255,180,0,16,0,75,0,252,0,11,0,0,54,22,21,20,6,35,
+34,38,53,52,54,51,54,21,64,40,26,21,64,40,252,33,24,38,141,33,24,42,137,0,
+0,1,255,179,0,0,0,76,0,169,0,11,0,0,54,22,21,20,6,35,34,38,53,52,54,51,30,
+46,46,30,33,44,44,33,169,40,44,44,41,41,44,44,40,0,0,1,1,178,254,149,2,76,
+255,61,0,11,0,0,4,22,21,20,6,35,34,38,53,52,54,51,2,30,46,46,30,34,44,44,
+34,195,42,42,41,43,43,41,42,42,0,1,255,176,0,0,0,200,0,155,0,8,0,0,51,35,
+34,38,53,52,54,51,51,200,200,33,47,47,33,200,41,36,36,42,0,1,255,176,0,0,
+1,94,0,155,0,8,0,0,33,33,34,38,53,52,54,51,33,1,94,254,162,33,47,47,33,1,
+94,41,36,36,42,0,0,1,254,72,6,59,0,40,6,129,0,3,0,0,1,33,21,33,254,72,1,224,
+254,32,6,129,70,0,0,1,252,184,6,59,0,40,6,129,0,3,0,0,1,33,21,33,252,184,
+3,112,252,144,6,129,70,0,0,1,255,216,6,59,1,184,6,129,0,3,0,0,3,33,21,33,
+40,1,224,254,32,6,129,70,0,1,255,216,6,59,4,216,6,129,0,3,0,0,3,33,21,33,
+40,5,0,251,0,6,129,70,0,1,255,216,6,59,7,48,6,129,0,3,0,0,3,33,21,33,40,7,
+88,248,168,6,129,70,0,1,254,72,6,59,255,116,6,129,0,3,0,0,1,33,21,33,254,
+72,1,44,254,212,6,129,70,0,0,1,252,184,6,59,255,116,6,129,0,3,0,0,1,33,21,
+33,252,184,2,188,253,68,6,129,70,0,0,1,0,120,6,59,1,184,6,129,0,3,0,0,19,
+33,21,33,120,1,64,254,192,6,129,70,0,1,0,120,6,59,4,216,6,129,0,3,0,0,19,
+33,21,33,120,4,96,251,160,6,129,70,0,1,0,120,6,59,7,48,6,129,0,3,0,0,19,33,
+21,33,120,6,184,249,72,6,129,70,0,1,254,118,6,59,5,133,6,129,0,3,0,0,1,33,
+21,33,254,118,7,15,248,241,6,129,70,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,
+0,94,0,0,0,3,0,1,4,9,0,1,0,48,0,94,0,3,0,1,4,9,0,2,0,14,0,142,0,3,0,1,4,9,
+0,3,0,86,0,156,0,3,0,1,4,9,0,4,0,48,0,94,0,3,0,1,4,9,0,5,0,30,0,242,0,3,0,
+1,4,9,0,6,0,42,1,16,0,3,0,1,4,9,0,7,0,68,1,58,0,3,0,1,4,9,0,8,0,42,1,126,
+0,3,0,1,4,9,0,9,0,40,1,168,0,3,0,1,4,9,0,10,0,96,1,208,0,3,0,1,4,9,0,11,0,
+62,2,48,0,3,0,1,4,9,0,12,0,60,2,110,0,3,0,1,4,9,0,13,2,150,2,170,0,3,0,1,
+4,9,0,14,0,52,5,64,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,
+32,0,50,0,48,0,49,0,52,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,83,0,121,0,114,0,105,0,97,0,99,
+0,32,0,87,0,101,0,115,0,116,0,101,0,114,0,110,0,82,0,101,0,103,0,117,0,108,
+0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,
+0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,
+83,0,97,0,110,0,115,0,32,0,83,0,121,0,114,0,105,0,97,0,99,0,32,0,87,0,101,
+0,115,0,116,0,101,0,114,0,110,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,
+32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,
+0,110,0,115,0,83,0,121,0,114,0,105,0,97,0,99,0,87,0,101,0,115,0,116,0,101,
+0,114,0,110,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,
+0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,
+0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,
+97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,
+32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,
+0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,
+0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,
+0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,
+0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,
+110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,
+101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,
+0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,
+111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,
+0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,
+0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,
+73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,
+0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,
+0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,
+0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,
+120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,
+0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,
+0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,
+0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,
+0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,58,0,2,0,7,0,
+8,0,12,0,1,0,13,0,13,0,3,0,14,0,51,0,1,0,53,0,124,0,1,0,140,0,204,0,3,0,247,
+1,36,0,1,1,37,1,38,0,3,0,2,0,35,0,13,0,13,0,1,0,139,0,139,0,5,0,140,0,140,
+0,1,0,141,0,141,0,2,0,143,0,143,0,1,0,144,0,144,0,2,0,145,0,146,0,1,0,147,
+0,149,0,2,0,150,0,150,0,1,0,151,0,152,0,2,0,153,0,153,0,1,0,154,0,154,0,2,
+0,155,0,156,0,1,0,157,0,157,0,3,0,158,0,158,0,4,0,159,0,159,0,1,0,160,0,160,
+0,2,0,161,0,161,0,1,0,162,0,162,0,2,0,163,0,163,0,1,0,164,0,164,0,2,0,165,
+0,170,0,1,0,171,0,171,0,3,0,172,0,173,0,2,0,174,0,174,0,4,0,175,0,178,0,2,
+0,179,0,180,0,1,0,181,0,181,0,2,0,182,0,183,0,1,0,184,0,184,0,2,0,185,0,188,
+0,1,0,189,0,189,0,2,0,190,0,202,0,1,1,37,1,37,0,1,1,38,1,38,0,2,0,1,0,0,0,
+10,0,56,0,146,0,2,68,70,76,84,0,14,115,121,114,99,0,30,0,4,0,0,0,0,255,255,
+0,3,0,0,0,2,0,4,0,4,0,0,0,0,255,255,0,3,0,1,0,3,0,5,0,6,107,101,114,110,0,
+38,107,101,114,110,0,38,109,97,114,107,0,70,109,97,114,107,0,70,109,107,109,
+107,0,82,109,107,109,107,0,82,0,0,0,14,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,
+0,14,0,15,0,16,0,17,0,18,0,19,0,0,0,4,0,0,0,1,0,2,0,3,0,0,0,2,0,4,0,5,0,36,
+0,74,5,86,9,220,11,62,12,234,14,20,14,220,20,190,22,130,24,56,24,236,25,30,
+27,2,28,158,33,42,33,120,35,154,36,202,37,200,38,100,42,190,43,60,43,150,
+43,244,44,96,44,112,44,128,44,144,44,160,44,176,44,192,44,210,44,250,45,26,
+45,128,46,68,0,4,0,1,0,1,0,8,0,1,37,34,5,74,0,1,0,12,0,174,0,40,0,0,9,164,
+0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,
+9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,
+0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,
+9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,
+0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,9,164,0,0,
+9,164,0,0,9,164,0,161,1,68,1,74,1,74,3,138,1,80,1,86,1,92,1,98,1,104,1,110,
+4,14,4,20,1,116,4,14,4,26,4,32,1,116,1,122,1,134,1,128,1,134,1,140,1,146,
+1,152,1,158,1,164,1,164,1,170,1,176,1,182,1,188,1,194,1,200,1,206,1,212,1,
+218,1,224,1,230,1,236,1,242,1,248,1,254,2,4,2,10,2,16,2,22,2,28,2,34,2,40,
+4,74,2,46,2,52,2,58,2,64,2,64,2,70,4,56,2,76,2,82,2,88,2,94,2,100,2,106,2,
+112,2,118,2,124,2,130,2,136,2,142,2,148,2,154,2,160,2,160,2,166,2,172,2,178,
+2,184,2,190,2,196,2,202,2,208,2,214,2,220,2,226,2,232,2,238,2,244,2,250,2,
+250,3,0,3,6,3,12,3,18,3,24,3,30,3,36,3,42,3,48,4,38,4,44,4,44,3,54,3,60,3,
+66,3,72,3,78,3,84,3,90,3,90,3,96,3,102,3,108,3,108,3,114,3,120,3,126,3,132,
+3,138,3,138,3,144,3,150,3,156,3,156,3,162,3,162,3,168,3,174,3,180,3,186,3,
+192,3,198,3,204,3,216,3,210,3,216,3,222,3,228,3,234,3,240,3,246,3,252,4,2,
+4,8,4,14,4,20,4,26,4,32,4,38,4,44,4,14,4,20,4,26,4,32,4,38,4,44,4,50,4,56,
+4,62,4,68,4,74,4,80,0,1,1,32,5,226,0,1,1,25,5,226,0,1,1,24,5,225,0,1,3,246,
+4,27,0,1,3,247,4,25,0,1,1,207,4,27,0,1,1,205,4,29,0,1,3,31,2,218,0,1,2,255,
+2,219,0,1,1,129,3,23,0,1,1,130,3,23,0,1,1,65,2,134,0,1,2,215,4,14,0,1,2,218,
+4,12,0,1,2,58,4,14,0,1,2,58,4,12,0,1,1,19,4,76,0,1,4,79,2,238,0,1,4,82,2,
+238,0,1,2,77,2,238,0,1,2,77,2,237,0,1,2,99,5,134,0,1,2,63,5,82,0,1,1,58,5,
+79,0,1,1,174,5,133,0,1,2,101,5,131,0,1,2,62,5,80,0,1,1,62,5,80,0,1,1,176,
+5,130,0,1,2,139,2,187,0,1,2,139,2,186,0,1,1,101,2,180,0,1,1,122,2,187,0,1,
+2,100,3,104,0,1,2,24,3,5,0,1,2,15,4,76,0,1,2,17,4,76,0,1,1,3,5,223,0,1,1,
+3,5,228,0,1,1,47,5,167,0,1,2,208,4,40,0,1,2,208,4,39,0,1,3,21,4,15,0,1,0,
+226,2,236,0,1,1,103,4,76,0,1,1,113,4,76,0,1,5,114,3,208,0,1,5,116,3,209,0,
+1,3,89,3,209,0,1,3,85,3,209,0,1,3,59,3,207,0,1,3,59,3,209,0,1,3,83,3,209,
+0,1,3,85,3,208,0,1,2,131,4,52,0,1,2,137,4,51,0,1,1,194,4,27,0,1,1,198,4,27,
+0,1,4,2,5,17,0,1,2,13,5,17,0,1,2,10,5,18,0,1,4,131,4,250,0,1,4,129,4,250,
+0,1,2,165,4,248,0,1,2,162,4,247,0,1,1,8,2,237,0,1,1,5,2,236,0,1,4,137,4,32,
+0,1,4,133,4,31,0,1,2,87,4,31,0,1,2,85,4,31,0,1,1,138,4,108,0,1,1,92,3,153,
+0,1,3,170,3,158,0,1,1,232,3,158,0,1,1,229,3,157,0,1,1,62,5,123,0,1,1,68,5,
+75,0,1,3,82,5,74,0,1,3,85,5,73,0,1,1,14,5,73,0,1,1,11,5,74,0,1,1,212,3,54,
+0,1,1,129,3,24,0,1,1,65,2,135,0,1,2,96,2,187,0,1,2,99,2,187,0,1,2,226,5,86,
+0,1,2,227,5,85,0,1,1,31,5,113,0,1,2,153,4,173,0,1,2,149,4,173,0,1,1,156,4,
+173,0,1,1,245,3,187,0,1,1,131,2,109,0,1,1,140,4,108,0,1,1,91,3,153,0,1,1,
+24,5,226,0,1,0,229,5,225,0,1,0,230,5,226,0,1,0,232,5,226,0,1,0,232,4,176,
+0,1,2,137,5,165,0,1,2,141,5,164,0,1,3,151,5,80,0,1,4,9,5,124,0,1,3,152,5,
+80,0,1,4,5,5,134,0,1,1,129,3,191,0,1,1,130,3,166,0,1,1,90,3,80,0,1,1,134,
+5,24,0,1,1,39,4,90,0,1,1,128,3,209,0,1,1,110,3,148,0,1,1,91,4,172,0,1,1,65,
+3,217,0,1,1,48,2,237,0,1,1,45,2,236,0,1,3,32,2,220,0,1,2,252,2,220,0,1,3,
+32,2,219,0,1,3,1,2,220,0,1,1,209,3,55,0,1,1,181,3,54,0,1,1,11,2,37,0,1,1,
+11,2,36,0,1,0,232,4,76,0,1,0,219,4,76,0,1,1,45,5,167,0,1,0,103,5,167,0,4,
+0,1,0,1,0,8,0,1,0,12,0,62,0,1,0,90,0,184,0,1,0,23,0,141,0,144,0,147,0,148,
+0,149,0,151,0,152,0,154,0,160,0,162,0,164,0,172,0,173,0,175,0,176,0,177,0,
+178,0,181,0,184,0,189,0,203,0,204,1,38,0,2,0,4,0,8,0,12,0,0,0,14,0,51,0,5,
+0,53,0,124,0,43,0,247,1,36,0,115,0,23,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,
+222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,
+0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,
+5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,0,5,222,0,161,1,68,1,128,1,128,3,24,
+3,24,1,74,1,74,1,80,1,80,3,156,3,156,3,162,3,162,3,156,3,156,3,162,3,162,
+1,86,1,92,1,98,1,104,1,110,1,116,1,122,1,122,1,128,1,134,1,140,1,146,1,152,
+1,158,1,164,1,170,1,188,1,188,1,176,1,182,1,188,1,194,1,200,1,206,1,212,2,
+22,1,218,1,224,1,230,1,230,1,236,1,236,3,186,3,186,1,242,1,248,1,254,2,4,
+2,10,3,168,2,16,2,22,2,28,2,28,2,226,2,46,2,34,2,40,2,226,2,46,2,46,2,52,
+2,58,2,64,2,70,2,76,2,82,2,88,2,94,2,100,2,106,2,112,2,118,2,124,2,166,2,
+130,2,136,2,142,2,148,2,154,2,160,2,166,2,172,2,178,2,184,2,190,2,196,2,202,
+2,208,2,208,3,156,3,156,3,162,3,162,3,120,2,214,2,220,2,220,2,226,2,232,2,
+238,2,238,2,244,2,244,2,250,2,250,3,0,3,6,3,12,3,18,3,24,3,24,3,30,3,36,3,
+42,3,48,3,48,3,48,3,54,3,60,3,72,3,66,3,72,3,78,3,84,3,90,3,96,3,102,3,108,
+3,114,3,120,3,126,3,132,3,138,3,144,3,150,3,156,3,162,3,156,3,162,3,156,3,
+162,3,156,3,162,3,156,3,162,3,156,3,162,3,168,3,168,3,174,3,180,3,186,3,192,
+0,1,1,8,254,111,0,1,3,125,255,56,0,1,1,167,255,56,0,1,1,43,252,218,0,1,1,
+11,252,166,0,1,1,60,254,70,0,1,1,45,254,6,0,1,2,198,255,56,0,1,2,200,255,
+56,0,1,2,37,255,56,0,1,0,223,254,112,0,1,0,219,254,115,0,1,3,78,255,56,0,
+1,3,76,255,56,0,1,2,39,255,56,0,1,2,30,255,56,0,1,2,74,252,244,0,1,2,156,
+252,244,0,1,2,77,252,244,0,1,2,158,252,244,0,1,1,146,252,244,0,1,1,149,252,
+244,0,1,2,45,255,56,0,1,2,43,255,56,0,1,1,89,255,56,0,1,3,34,254,12,0,1,3,
+34,254,14,0,1,1,237,255,56,0,1,3,98,255,56,0,1,3,94,255,56,0,1,3,99,255,56,
+0,1,3,5,255,56,0,1,3,1,255,56,0,1,1,45,252,178,0,1,1,108,255,56,0,1,1,85,
+255,56,0,1,4,104,255,56,0,1,3,13,254,15,0,1,3,17,254,12,0,1,3,79,255,56,0,
+1,3,81,255,56,0,1,1,195,255,56,0,1,1,193,255,56,0,1,3,86,255,56,0,1,3,84,
+255,56,0,1,1,232,255,56,0,1,1,227,255,56,0,1,4,39,255,56,0,1,4,17,255,56,
+0,1,2,124,255,56,0,1,2,122,255,56,0,1,0,74,252,113,0,1,0,76,252,117,0,1,3,
+129,255,56,0,1,2,73,255,56,0,1,2,75,255,56,0,1,1,64,254,70,0,1,1,43,254,6,
+0,1,3,133,255,56,0,1,3,131,255,56,0,1,1,213,255,56,0,1,1,211,255,56,0,1,1,
+115,255,56,0,1,1,144,255,56,0,1,3,121,255,56,0,1,3,123,255,56,0,1,2,35,255,
+56,0,1,1,116,252,220,0,1,2,45,252,115,0,1,3,75,255,56,0,1,3,73,255,56,0,1,
+2,100,255,56,0,1,2,151,255,56,0,1,1,154,255,56,0,1,1,212,255,56,0,1,1,124,
+255,56,0,1,1,62,254,70,0,1,1,44,254,7,0,1,0,224,254,112,0,1,1,43,254,112,
+0,1,1,42,254,112,0,1,0,233,255,56,0,1,0,232,255,56,0,1,2,230,255,56,0,1,2,
+232,255,56,0,1,3,236,252,244,0,1,3,233,252,244,0,1,3,239,252,244,0,1,1,43,
+252,195,0,1,1,11,252,144,0,1,1,75,253,148,0,1,1,54,253,148,0,1,1,71,253,149,
+0,1,1,52,253,147,0,1,1,117,253,22,0,1,1,115,252,221,0,1,1,73,253,149,0,1,
+1,69,253,197,0,1,1,21,252,113,0,1,1,19,252,117,0,1,3,140,252,115,0,1,3,108,
+252,115,0,1,1,7,252,180,0,1,0,237,255,56,0,1,0,191,255,56,0,1,1,138,255,56,
+0,1,0,194,255,56,0,4,0,1,0,1,0,8,0,1,0,12,1,110,0,1,0,20,0,36,0,1,0,2,0,157,
+0,171,0,2,0,0,0,10,0,0,0,10,0,1,0,0,4,85,0,58,0,118,0,118,0,124,0,130,1,24,
+1,24,1,36,1,36,1,24,1,30,1,36,1,36,0,220,0,226,0,232,0,136,0,142,0,148,0,
+154,0,160,0,166,0,166,0,172,0,172,0,244,0,178,0,184,0,190,0,196,1,42,1,48,
+0,202,1,0,1,6,0,208,0,214,0,220,0,226,0,232,0,238,0,244,0,250,1,0,1,6,1,12,
+1,18,1,24,1,36,1,30,1,36,1,42,1,48,1,24,1,36,1,30,1,36,1,42,1,48,0,1,5,253,
+3,131,0,1,3,216,3,131,0,1,3,215,3,130,0,1,2,47,1,216,0,1,3,253,2,60,0,1,3,
+255,2,60,0,1,4,8,3,147,0,1,4,7,3,147,0,1,5,241,4,97,0,1,3,252,4,97,0,1,2,
+95,3,53,0,1,2,188,3,225,0,1,3,31,3,208,0,1,4,61,3,32,0,1,4,5,3,27,0,1,2,236,
+4,59,0,1,2,175,3,110,0,1,2,198,2,98,0,1,2,46,1,217,0,1,2,199,2,120,0,1,2,
+76,1,216,0,1,2,164,3,169,0,1,2,100,2,253,0,1,2,219,2,121,0,1,2,65,1,238,0,
+1,3,35,3,238,0,1,3,35,3,24,0,1,4,15,1,73,0,1,4,16,1,73,0,1,3,239,1,73,0,1,
+4,99,3,35,0,1,4,56,3,30,0,4,0,1,0,1,0,8,0,1,32,198,0,12,0,1,0,70,0,86,0,2,
+0,9,0,14,0,29,0,0,0,53,0,56,0,16,0,81,0,84,0,20,0,95,0,96,0,24,0,101,0,102,
+0,26,0,107,0,112,0,28,0,247,0,248,0,34,1,7,1,16,0,36,1,19,1,30,0,46,0,2,0,
+0,0,10,0,0,0,10,0,1,0,0,0,0,0,58,0,118,0,124,0,130,0,136,1,42,1,42,1,48,1,
+48,1,42,1,54,1,60,1,72,0,238,0,244,0,238,0,142,0,148,0,148,0,154,0,160,0,
+166,0,172,0,178,0,184,0,226,0,190,0,196,0,202,1,54,0,208,1,48,1,60,0,214,
+0,220,0,226,0,232,0,238,0,244,0,250,1,0,1,6,1,12,1,18,1,24,1,30,1,36,1,42,
+1,48,1,54,1,60,1,66,1,72,1,42,1,48,1,54,1,60,1,66,1,72,0,1,5,251,255,117,
+0,1,5,250,255,43,0,1,3,182,255,42,0,1,3,183,255,117,0,1,2,45,255,19,0,1,3,
+244,255,123,0,1,3,227,255,101,0,1,3,227,255,102,0,1,5,154,255,114,0,1,5,154,
+255,42,0,1,3,225,255,45,0,1,3,225,255,112,0,1,2,42,255,25,0,1,3,72,255,134,
+0,1,3,152,255,82,0,1,5,138,252,46,0,1,2,111,255,27,0,1,2,62,255,27,0,1,2,
+93,255,26,0,1,2,43,255,26,0,1,2,92,255,127,0,1,2,42,255,26,0,1,2,93,255,126,
+0,1,2,76,255,19,0,1,2,93,255,76,0,1,2,72,255,25,0,1,2,111,255,101,0,1,2,94,
+255,20,0,1,2,93,255,99,0,1,2,74,255,22,0,1,5,139,252,47,0,1,5,107,252,47,
+0,1,5,139,252,46,0,1,5,107,252,49,0,1,5,139,252,49,0,1,5,107,252,48,0,6,0,
+1,0,1,0,8,0,1,0,12,0,86,0,1,0,100,0,248,0,1,0,35,0,13,0,140,0,143,0,145,0,
+146,0,150,0,153,0,155,0,159,0,161,0,163,0,165,0,166,0,179,0,180,0,182,0,183,
+0,185,0,186,0,187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,
+198,0,199,0,200,0,201,0,202,1,37,0,1,0,5,0,156,0,167,0,168,0,169,0,170,0,
+35,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,
+0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,
+0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,
+0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,
+0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,0,0,142,0,1,0,0,4,91,0,5,
+0,12,0,18,0,24,0,30,0,36,0,1,0,5,4,91,0,1,0,5,5,120,0,1,0,5,5,77,0,1,0,8,
+5,170,0,1,0,5,5,165,0,6,0,1,0,1,0,8,0,1,0,12,0,50,0,1,0,66,0,142,0,1,0,17,
+0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,0,160,0,162,0,164,0,181,0,
+184,0,189,0,203,0,204,1,38,0,1,0,6,0,172,0,173,0,175,0,176,0,177,0,178,0,
+17,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,
+0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,0,0,70,0,
+0,0,70,0,1,0,0,255,250,0,6,0,14,0,20,0,26,0,32,0,38,0,44,0,1,0,0,254,162,
+0,1,255,248,254,175,0,1,255,250,254,197,0,1,255,249,255,24,0,1,255,251,254,
+218,0,1,0,0,255,6,0,2,0,0,0,1,0,8,0,1,0,54,0,5,0,0,0,22,0,70,0,144,0,200,
+1,60,1,188,2,18,2,122,2,196,3,68,3,184,3,246,4,34,4,66,4,110,4,154,4,186,
+4,186,4,230,5,24,5,86,5,136,5,174,0,2,0,2,0,205,0,219,0,0,0,236,0,242,0,15,
+0,12,0,205,0,110,0,110,0,207,0,30,0,30,0,208,0,30,0,30,0,210,0,70,0,70,0,
+211,255,146,255,146,0,214,0,30,0,30,0,215,0,90,0,90,0,236,0,80,0,80,0,237,
+0,80,0,80,0,238,0,80,0,80,0,241,255,156,255,156,0,242,0,120,0,120,0,9,0,206,
+255,216,255,216,0,215,255,186,255,186,0,216,255,216,255,216,0,217,255,176,
+255,176,0,236,255,236,255,236,0,237,255,236,255,236,0,239,255,176,255,176,
+0,241,255,216,255,216,0,243,255,196,255,196,0,19,0,205,255,166,255,166,0,
+207,0,90,0,90,0,208,0,90,0,90,0,210,255,166,255,166,0,211,0,130,0,130,0,212,
+0,130,0,130,0,213,255,136,255,136,0,214,0,40,0,40,0,215,0,30,0,30,0,216,255,
+126,255,126,0,218,255,126,255,126,0,219,255,86,255,86,0,235,0,90,0,90,0,236,
+255,136,255,136,0,237,255,136,255,136,0,239,254,252,254,252,0,240,255,86,
+255,86,0,242,255,156,255,156,0,243,0,30,0,30,0,21,0,205,255,196,255,196,0,
+207,0,80,0,80,0,208,0,120,0,120,0,210,255,176,255,176,0,211,0,120,0,120,0,
+212,0,120,0,120,0,213,255,126,255,126,0,214,0,90,0,90,0,215,0,60,0,60,0,216,
+255,126,255,126,0,217,0,40,0,40,0,218,255,126,255,126,0,219,255,86,255,86,
+0,235,0,90,0,90,0,236,255,146,255,146,0,237,255,146,255,146,0,239,255,6,255,
+6,0,240,255,86,255,86,0,241,0,80,0,80,0,242,255,156,255,156,0,243,0,30,0,
+30,0,14,0,207,0,50,0,50,0,209,0,40,0,40,0,211,255,216,255,216,0,213,0,110,
+0,110,0,214,255,206,255,206,0,215,0,90,0,90,0,216,0,70,0,70,0,217,255,206,
+255,206,0,218,0,40,0,40,0,219,0,50,0,50,0,235,255,236,255,236,0,240,0,100,
+0,100,0,241,255,186,255,186,0,243,255,166,255,166,0,17,0,205,0,90,0,90,0,
+207,0,50,0,50,0,208,0,30,0,30,0,209,0,60,0,60,0,210,0,60,0,60,0,211,255,226,
+255,226,0,212,0,20,0,20,0,213,0,30,0,30,0,214,0,90,0,90,0,235,0,70,0,70,0,
+236,0,60,0,60,0,237,0,60,0,60,0,238,0,70,0,70,0,239,255,126,255,126,0,240,
+255,216,255,216,0,241,255,166,255,166,0,242,0,110,0,110,0,12,0,207,0,50,0,
+50,0,209,0,40,0,40,0,210,0,30,0,30,0,211,0,50,0,50,0,212,0,60,0,60,0,213,
+0,80,0,80,0,214,0,40,0,40,0,235,0,60,0,60,0,238,0,30,0,30,0,239,255,236,255,
+236,0,240,0,40,0,40,0,242,0,70,0,70,0,21,0,205,255,186,255,186,0,207,0,100,
+0,100,0,208,0,130,0,130,0,209,0,50,0,50,0,210,255,246,255,246,0,211,0,150,
+0,150,0,212,0,170,0,170,0,213,255,206,255,206,0,214,0,80,0,80,0,215,0,50,
+0,50,0,216,255,56,255,56,0,217,0,70,0,70,0,218,255,46,255,46,0,219,255,126,
+255,126,0,235,0,120,0,120,0,236,255,236,255,236,0,237,255,236,255,236,0,239,
+255,106,255,106,0,240,255,196,255,196,0,241,0,50,0,50,0,243,0,80,0,80,0,19,
+0,207,0,40,0,40,0,208,0,40,0,40,0,209,0,70,0,70,0,210,0,30,0,30,0,211,255,
+176,255,176,0,213,0,170,0,170,0,214,255,226,255,226,0,215,0,110,0,110,0,216,
+0,70,0,70,0,217,255,196,255,196,0,218,0,80,0,80,0,219,0,80,0,80,0,235,255,
+206,255,206,0,236,255,226,255,226,0,237,255,226,255,226,0,239,0,60,0,60,0,
+240,0,130,0,130,0,241,255,176,255,176,0,243,255,146,255,146,0,10,0,205,0,
+20,0,20,0,207,0,40,0,40,0,208,0,40,0,40,0,210,0,30,0,30,0,213,0,50,0,50,0,
+214,0,40,0,40,0,216,0,40,0,40,0,218,0,60,0,60,0,240,0,90,0,90,0,242,0,80,
+0,80,0,7,0,205,0,130,0,130,0,207,0,80,0,80,0,208,0,60,0,60,0,211,0,110,0,
+110,0,212,0,110,0,110,0,213,0,90,0,90,0,214,0,60,0,60,0,5,0,205,0,80,0,80,
+0,211,255,146,255,146,0,212,255,136,255,136,0,213,0,70,0,70,0,214,255,106,
+255,106,0,7,0,205,255,136,255,136,0,206,255,226,255,226,0,209,255,216,255,
+216,0,210,255,146,255,146,0,211,0,50,0,50,0,212,0,50,0,50,0,213,255,46,255,
+46,0,7,0,205,0,40,0,40,0,207,255,216,255,216,0,208,255,216,255,216,0,211,
+255,46,255,46,0,212,255,126,255,126,0,213,0,40,0,40,0,214,255,36,255,36,0,
+5,0,205,0,130,0,130,0,209,0,40,0,40,0,210,0,80,0,80,0,211,255,176,255,176,
+0,213,0,80,0,80,0,7,0,205,0,80,0,80,0,207,0,40,0,40,0,208,0,40,0,40,0,210,
+0,60,0,60,0,211,255,176,255,176,0,213,255,226,255,226,0,214,0,50,0,50,0,8,
+0,205,0,70,0,70,0,207,0,70,0,70,0,208,0,70,0,70,0,209,0,70,0,70,0,210,0,70,
+0,70,0,212,0,30,0,30,0,213,0,30,0,30,0,214,0,100,0,100,0,10,0,205,255,196,
+255,196,0,206,255,186,255,186,0,207,0,40,0,40,0,208,0,40,0,40,0,209,255,196,
+255,196,0,210,255,96,255,96,0,211,0,50,0,50,0,212,0,40,0,40,0,213,255,106,
+255,106,0,214,255,216,255,216,0,8,0,205,255,196,255,196,0,207,0,100,0,100,
+0,208,0,100,0,100,0,210,255,166,255,166,0,211,0,120,0,120,0,212,0,140,0,140,
+0,213,255,206,255,206,0,214,0,40,0,40,0,6,0,205,0,70,0,70,0,209,0,70,0,70,
+0,210,0,30,0,30,0,211,255,136,255,136,0,213,0,170,0,170,0,214,255,226,255,
+226,0,7,0,205,0,130,0,130,0,207,0,70,0,70,0,208,0,70,0,70,0,209,0,50,0,50,
+0,210,0,110,0,110,0,211,255,186,255,186,0,214,0,90,0,90,0,8,0,9,0,20,0,46,
+0,64,0,82,0,100,0,124,0,142,0,166,0,184,0,202,0,220,0,238,1,0,1,18,1,36,1,
+54,1,72,1,90,1,114,1,138,1,156,0,3,0,0,0,1,1,210,0,1,1,134,0,1,0,0,0,20,0,
+3,0,0,0,1,1,216,0,1,1,116,0,1,0,0,0,20,0,3,0,0,0,1,14,34,0,1,1,98,0,1,0,0,
+0,20,0,3,0,0,0,1,0,18,0,1,1,80,0,1,0,0,0,20,0,1,0,1,0,38,0,3,0,0,0,1,11,104,
+0,1,1,56,0,1,0,0,0,20,0,3,0,0,0,1,0,18,0,1,1,38,0,1,0,0,0,20,0,1,0,1,0,50,
+0,3,0,0,0,1,2,250,0,1,1,14,0,1,0,0,0,20,0,3,0,0,0,1,3,2,0,1,0,252,0,1,0,0,
+0,20,0,3,0,0,0,1,1,138,0,1,0,234,0,1,0,0,0,20,0,3,0,0,0,1,1,144,0,1,0,216,
+0,1,0,0,0,20,0,3,0,0,0,1,1,246,0,1,0,198,0,1,0,0,0,20,0,3,0,0,0,1,1,252,0,
+1,0,180,0,1,0,0,0,20,0,3,0,0,0,1,2,194,0,1,0,162,0,1,0,0,0,20,0,3,0,0,0,1,
+2,202,0,1,0,144,0,1,0,0,0,20,0,3,0,0,0,1,2,38,0,1,0,126,0,1,0,0,0,20,0,3,
+0,0,0,1,2,44,0,1,0,108,0,1,0,0,0,20,0,3,0,0,0,1,0,18,0,1,0,90,0,1,0,0,0,20,
+0,1,0,1,0,106,0,3,0,0,0,1,0,18,0,1,0,66,0,1,0,0,0,20,0,1,0,1,0,105,0,3,0,
+0,0,1,13,56,0,1,0,42,0,1,0,0,0,20,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,20,
+0,1,0,1,0,121,0,1,0,6,0,19,0,20,0,23,0,24,0,108,0,109,0,8,0,9,0,18,0,42,0,
+66,0,90,0,108,0,126,0,150,0,174,0,198,0,222,0,246,1,14,1,38,1,62,1,80,1,98,
+1,116,1,134,1,158,0,3,0,0,0,1,0,18,0,1,2,58,0,1,0,0,0,21,0,1,0,1,0,17,0,3,
+0,0,0,1,0,18,0,1,2,34,0,1,0,0,0,21,0,1,0,1,0,16,0,3,0,0,0,1,1,130,0,1,2,10,
+0,1,0,0,0,21,0,3,0,0,0,1,1,138,0,1,1,248,0,1,0,0,0,21,0,3,0,0,0,1,0,18,0,
+1,1,230,0,1,0,0,0,21,0,1,0,1,0,64,0,3,0,0,0,1,0,18,0,1,1,206,0,1,0,0,0,21,
+0,1,0,1,0,63,0,3,0,0,0,1,0,18,0,1,1,182,0,1,0,0,0,21,0,1,0,1,0,72,0,3,0,0,
+0,1,0,18,0,1,1,158,0,1,0,0,0,21,0,1,0,1,0,71,0,3,0,0,0,1,0,18,0,1,1,134,0,
+1,0,0,0,21,0,1,0,1,0,76,0,3,0,0,0,1,0,18,0,1,1,110,0,1,0,0,0,21,0,1,0,1,0,
+75,0,3,0,0,0,1,0,18,0,1,1,86,0,1,0,0,0,21,0,1,0,1,0,80,0,3,0,0,0,1,0,18,0,
+1,1,62,0,1,0,0,0,21,0,1,0,1,0,79,0,3,0,0,0,1,0,210,0,1,1,38,0,1,0,0,0,21,
+0,3,0,0,0,1,0,218,0,1,1,20,0,1,0,0,0,21,0,3,0,0,0,1,0,226,0,1,1,2,0,1,0,0,
+0,21,0,3,0,0,0,1,0,234,0,1,0,240,0,1,0,0,0,21,0,3,0,0,0,1,0,18,0,1,0,222,
+0,1,0,0,0,21,0,1,0,1,0,118,0,3,0,0,0,1,0,18,0,1,0,198,0,1,0,0,0,21,0,1,0,
+1,0,117,0,8,2,1,0,6,0,18,0,44,0,70,0,96,0,122,0,148,0,3,0,0,0,1,0,20,0,2,
+21,80,0,156,0,1,0,0,0,22,0,1,0,1,0,56,0,3,0,0,0,1,0,20,0,2,21,54,0,130,0,
+1,0,0,0,22,0,1,0,1,0,55,0,3,0,0,0,1,0,20,0,2,21,28,0,104,0,1,0,0,0,22,0,1,
+0,1,0,84,0,3,0,0,0,1,0,20,0,2,21,2,0,78,0,1,0,0,0,22,0,1,0,1,0,83,0,3,0,0,
+0,1,0,20,0,2,20,232,0,52,0,1,0,0,0,22,0,1,0,1,0,88,0,3,0,0,0,1,0,20,0,2,20,
+206,0,26,0,1,0,0,0,22,0,1,0,1,0,87,0,1,0,1,0,66,0,8,4,1,0,1,0,8,0,3,0,2,10,
+114,0,20,0,1,19,24,0,0,0,1,0,0,0,23,0,2,0,3,0,8,0,12,0,0,0,34,0,35,0,5,0,
+249,0,252,0,7,0,8,4,1,0,20,0,46,0,68,0,90,0,112,0,134,0,156,0,178,0,200,0,
+222,0,244,1,10,1,30,1,56,1,82,1,108,1,128,1,148,1,168,1,188,1,208,0,3,0,0,
+0,1,10,26,0,3,18,192,10,26,18,192,0,1,0,0,0,23,0,3,0,0,0,1,0,238,0,3,18,170,
+10,4,18,170,0,1,0,0,0,23,0,3,0,0,0,1,0,242,0,3,18,148,9,238,18,148,0,1,0,
+0,0,23,0,3,0,0,0,1,0,246,0,3,18,126,9,216,18,126,0,1,0,0,0,23,0,3,0,0,0,1,
+6,52,0,3,18,104,9,194,18,104,0,1,0,0,0,23,0,3,0,0,0,1,2,160,0,3,18,82,9,172,
+18,82,0,1,0,0,0,23,0,3,0,0,0,1,6,60,0,3,18,60,9,150,18,60,0,1,0,0,0,23,0,
+3,0,0,0,1,2,162,0,3,18,38,9,128,18,38,0,1,0,0,0,23,0,3,0,0,0,1,18,78,0,3,
+18,16,9,106,18,16,0,1,0,0,0,23,0,3,0,0,0,1,18,72,0,3,17,250,9,84,17,250,0,
+1,0,0,0,23,0,3,0,0,0,1,9,62,0,2,9,62,17,228,0,1,0,0,0,23,0,3,0,0,0,1,0,20,
+0,2,9,42,17,208,0,1,0,0,0,23,0,1,0,1,0,102,0,3,0,0,0,1,0,20,0,2,9,16,17,182,
+0,1,0,0,0,23,0,1,0,1,0,26,0,3,0,0,0,1,0,20,0,2,8,246,17,156,0,1,0,0,0,23,
+0,1,0,1,0,27,0,3,0,0,0,1,5,78,0,2,8,220,17,130,0,1,0,0,0,23,0,3,0,0,0,1,1,
+188,0,2,8,200,17,110,0,1,0,0,0,23,0,3,0,0,0,1,5,90,0,2,8,180,17,90,0,1,0,
+0,0,23,0,3,0,0,0,1,1,194,0,2,8,160,17,70,0,1,0,0,0,23,0,3,0,0,0,1,17,112,
+0,2,8,140,17,50,0,1,0,0,0,23,0,3,0,0,0,1,17,108,0,2,8,120,17,30,0,1,0,0,0,
+23,0,8,2,1,0,16,0,38,0,60,0,82,0,104,0,126,0,148,0,170,0,192,0,214,0,234,
+1,8,1,28,1,48,1,68,1,94,1,114,0,3,0,0,0,1,19,6,0,3,18,114,18,114,1,102,0,
+1,0,0,0,22,0,3,0,0,0,1,0,194,0,3,18,92,18,92,1,80,0,1,0,0,0,22,0,3,0,0,0,
+1,16,228,0,3,18,70,18,70,1,58,0,1,0,0,0,22,0,3,0,0,0,1,18,6,0,3,18,48,18,
+48,1,36,0,1,0,0,0,22,0,3,0,0,0,1,4,88,0,3,18,26,18,26,1,14,0,1,0,0,0,22,0,
+3,0,0,0,1,0,196,0,3,18,4,18,4,0,248,0,1,0,0,0,22,0,3,0,0,0,1,4,96,0,3,17,
+238,17,238,0,226,0,1,0,0,0,22,0,3,0,0,0,1,0,198,0,3,17,216,17,216,0,204,0,
+1,0,0,0,22,0,3,0,0,0,1,18,86,0,2,17,194,0,182,0,1,0,0,0,22,0,3,0,0,0,1,0,
+20,0,2,17,174,0,162,0,1,0,0,0,22,0,2,0,1,0,30,0,33,0,0,0,3,0,0,0,1,16,46,
+0,2,17,144,0,132,0,1,0,0,0,22,0,3,0,0,0,1,17,82,0,2,17,124,0,112,0,1,0,0,
+0,22,0,3,0,0,0,1,3,166,0,2,17,104,0,92,0,1,0,0,0,22,0,3,0,0,0,1,0,20,0,2,
+17,84,0,72,0,1,0,0,0,22,0,1,0,1,0,29,0,3,0,0,0,1,3,172,0,2,17,58,0,46,0,1,
+0,0,0,22,0,3,0,0,0,1,0,20,0,2,17,38,0,26,0,1,0,0,0,22,0,1,0,1,0,96,0,1,0,
+6,0,18,0,21,0,22,0,25,0,107,0,110,0,8,2,1,0,45,0,96,0,120,0,144,0,168,0,192,
+0,216,0,240,1,8,1,32,1,56,1,80,1,104,1,128,1,152,1,176,1,200,1,222,1,244,
+2,10,2,32,2,54,2,76,2,98,2,120,2,142,2,164,2,186,2,208,2,230,2,252,3,18,3,
+38,3,64,3,90,3,116,3,142,3,162,3,188,3,214,3,240,4,10,4,36,4,62,4,88,4,114,
+0,3,0,4,17,48,16,156,16,156,16,228,0,1,16,156,0,0,0,1,0,0,0,22,0,3,0,4,2,
+194,16,132,16,132,16,204,0,1,16,132,0,0,0,1,0,0,0,24,0,3,0,4,2,196,16,108,
+16,108,16,180,0,1,16,108,0,0,0,1,0,0,0,25,0,3,0,4,2,198,16,84,16,84,16,156,
+0,1,16,84,0,0,0,1,0,0,0,24,0,3,0,4,2,200,16,60,16,60,16,132,0,1,16,60,0,0,
+0,1,0,0,0,25,0,3,0,4,14,212,16,36,16,36,16,108,0,1,16,36,0,0,0,1,0,0,0,26,
+0,3,0,4,2,198,16,12,16,12,16,84,0,1,16,12,0,0,0,1,0,0,0,26,0,3,0,4,2,200,
+15,244,15,244,16,60,0,1,15,244,0,0,0,1,0,0,0,27,0,3,0,4,2,202,15,220,15,220,
+16,36,0,1,15,220,0,0,0,1,0,0,0,28,0,3,0,4,2,204,15,196,15,196,16,12,0,1,15,
+196,0,0,0,1,0,0,0,29,0,3,0,4,2,206,15,172,15,172,15,244,0,1,15,172,0,0,0,
+1,0,0,0,30,0,3,0,4,2,208,15,148,15,148,15,220,0,1,15,148,0,0,0,1,0,0,0,31,
+0,3,0,4,2,210,15,124,15,124,15,196,0,1,15,124,0,0,0,1,0,0,0,29,0,3,0,4,2,
+212,15,100,15,100,15,172,0,1,15,100,0,0,0,1,0,0,0,29,0,3,0,4,2,214,15,76,
+15,76,15,148,0,1,15,76,0,0,0,1,0,0,0,29,0,3,0,3,15,200,15,52,15,124,0,1,15,
+52,0,0,0,1,0,0,0,22,0,3,0,3,1,92,15,30,15,102,0,1,15,30,0,0,0,1,0,0,0,24,
+0,3,0,3,1,96,15,8,15,80,0,1,15,8,0,0,0,1,0,0,0,25,0,3,0,3,1,100,14,242,15,
+58,0,1,14,242,0,0,0,1,0,0,0,24,0,3,0,3,1,104,14,220,15,36,0,1,14,220,0,0,
+0,1,0,0,0,25,0,3,0,3,13,118,14,198,15,14,0,1,14,198,0,0,0,1,0,0,0,26,0,3,
+0,3,1,106,14,176,14,248,0,1,14,176,0,0,0,1,0,0,0,26,0,3,0,3,1,110,14,154,
+14,226,0,1,14,154,0,0,0,1,0,0,0,27,0,3,0,3,1,114,14,132,14,204,0,1,14,132,
+0,0,0,1,0,0,0,28,0,3,0,3,1,118,14,110,14,182,0,1,14,110,0,0,0,1,0,0,0,29,
+0,3,0,3,1,122,14,88,14,160,0,1,14,88,0,0,0,1,0,0,0,30,0,3,0,3,1,126,14,66,
+14,138,0,1,14,66,0,0,0,1,0,0,0,31,0,3,0,3,1,130,14,44,14,116,0,1,14,44,0,
+0,0,1,0,0,0,29,0,3,0,3,1,134,14,22,14,94,0,1,14,22,0,0,0,1,0,0,0,29,0,3,0,
+3,1,138,14,0,14,72,0,1,14,0,0,0,0,1,0,0,0,29,0,3,0,2,14,126,14,50,0,1,13,
+234,0,0,0,1,0,0,0,22,0,3,0,2,0,20,14,30,0,1,13,214,0,0,0,1,0,0,0,24,0,1,0,
+1,0,28,0,3,0,2,0,20,14,4,0,1,13,188,0,0,0,1,0,0,0,25,0,1,0,1,1,9,0,3,0,2,
+0,20,13,234,0,1,13,162,0,0,0,1,0,0,0,24,0,1,0,1,0,95,0,3,0,2,0,20,13,208,
+0,1,13,136,0,0,0,1,0,0,0,25,0,1,0,1,1,11,0,3,0,2,12,30,13,182,0,1,13,110,
+0,0,0,1,0,0,0,26,0,3,0,2,0,20,13,162,0,1,13,90,0,0,0,1,0,0,0,26,0,1,0,1,1,
+13,0,3,0,2,0,20,13,136,0,1,13,64,0,0,0,1,0,0,0,27,0,1,0,1,0,247,0,3,0,2,0,
+20,13,110,0,1,13,38,0,0,0,1,0,0,0,28,0,1,0,1,1,15,0,3,0,2,0,20,13,84,0,1,
+13,12,0,0,0,1,0,0,0,29,0,1,0,1,0,51,0,3,0,2,0,20,13,58,0,1,12,242,0,0,0,1,
+0,0,0,30,0,1,0,1,0,53,0,3,0,2,0,20,13,32,0,1,12,216,0,0,0,1,0,0,0,31,0,1,
+0,1,0,61,0,3,0,2,0,20,13,6,0,1,12,190,0,0,0,1,0,0,0,29,0,1,0,1,0,253,0,3,
+0,2,0,20,12,236,0,1,12,164,0,0,0,1,0,0,0,29,0,1,0,1,0,68,0,3,0,2,0,20,12,
+210,0,1,12,138,0,0,0,1,0,0,0,29,0,1,0,1,0,255,0,8,2,1,0,3,0,12,0,36,0,58,
+0,3,0,4,3,142,12,100,12,100,12,172,0,1,12,100,0,0,0,1,0,0,0,32,0,3,0,3,3,
+118,12,76,12,148,0,1,12,76,0,0,0,1,0,0,0,33,0,3,0,2,3,96,12,126,0,1,12,54,
+0,0,0,1,0,0,0,34,0,8,2,1,0,21,0,48,0,72,0,96,0,120,0,144,0,168,0,192,0,216,
+0,238,1,4,1,26,1,48,1,70,1,92,1,114,1,140,1,166,1,192,1,218,1,244,2,14,0,
+3,0,0,0,1,12,58,0,4,11,242,11,242,1,86,11,242,0,1,0,0,0,34,0,3,0,0,0,1,12,
+34,0,4,11,218,11,218,1,88,11,218,0,1,0,0,0,34,0,3,0,0,0,1,12,10,0,4,11,194,
+11,194,1,90,11,194,0,1,0,0,0,33,0,3,0,0,0,1,11,242,0,4,11,170,11,170,1,92,
+11,170,0,1,0,0,0,33,0,3,0,0,0,1,11,218,0,4,11,146,11,146,1,94,11,146,0,1,
+0,0,0,34,0,3,0,0,0,1,11,194,0,4,11,122,11,122,1,96,11,122,0,1,0,0,0,32,0,
+3,0,0,0,1,11,170,0,4,11,98,11,98,11,154,11,98,0,1,0,0,0,31,0,3,0,0,0,1,11,
+146,0,3,11,74,0,174,11,74,0,1,0,0,0,34,0,3,0,0,0,1,11,124,0,3,11,52,0,178,
+11,52,0,1,0,0,0,34,0,3,0,0,0,1,11,102,0,3,11,30,0,182,11,30,0,1,0,0,0,33,
+0,3,0,0,0,1,11,80,0,3,11,8,0,186,11,8,0,1,0,0,0,33,0,3,0,0,0,1,11,58,0,3,
+10,242,0,190,10,242,0,1,0,0,0,34,0,3,0,0,0,1,11,36,0,3,10,220,0,194,10,220,
+0,1,0,0,0,32,0,3,0,0,0,1,11,14,0,3,10,198,10,254,10,198,0,1,0,0,0,31,0,3,
+0,0,0,1,10,248,0,2,0,20,10,176,0,1,0,0,0,34,0,1,0,1,0,32,0,3,0,0,0,1,10,222,
+0,2,0,20,10,150,0,1,0,0,0,34,0,1,0,1,0,94,0,3,0,0,0,1,10,196,0,2,0,20,10,
+124,0,1,0,0,0,33,0,1,0,1,0,39,0,3,0,0,0,1,10,170,0,2,0,20,10,98,0,1,0,0,0,
+33,0,1,0,1,0,48,0,3,0,0,0,1,10,144,0,2,0,20,10,72,0,1,0,0,0,34,0,1,0,1,0,
+101,0,3,0,0,0,1,10,118,0,2,0,20,10,46,0,1,0,0,0,32,0,1,0,1,0,122,0,3,0,0,
+0,1,10,92,0,2,10,76,10,20,0,1,0,0,0,31,0,8,2,1,0,12,0,30,0,50,0,70,0,90,0,
+110,0,130,0,150,0,170,0,190,0,226,0,246,1,10,0,3,0,0,0,1,10,118,0,2,2,124,
+1,12,0,1,0,0,0,34,0,3,0,0,0,1,9,164,0,2,2,104,0,248,0,1,0,0,0,34,0,3,0,0,
+0,1,0,140,0,2,2,84,0,228,0,1,0,0,0,34,0,3,0,0,0,1,10,32,0,2,2,64,0,208,0,
+1,0,0,0,34,0,3,0,0,0,1,9,202,0,2,2,44,0,188,0,1,0,0,0,34,0,3,0,0,0,1,10,58,
+0,2,2,24,0,168,0,1,0,0,0,33,0,3,0,0,0,1,9,254,0,2,0,136,0,148,0,1,0,0,0,32,
+0,3,0,0,0,1,9,44,0,2,0,116,0,128,0,1,0,0,0,33,0,3,0,0,0,1,0,20,0,2,0,96,0,
+108,0,1,0,0,0,33,0,1,0,6,0,28,0,95,0,247,1,9,1,11,1,15,0,3,0,0,0,1,9,152,
+0,2,0,60,0,72,0,1,0,0,0,33,0,3,0,0,0,1,9,66,0,2,0,40,0,52,0,1,0,0,0,33,0,
+3,0,0,0,1,9,178,0,2,0,20,0,32,0,1,0,0,0,31,0,1,0,4,0,152,0,160,0,172,1,38,
+0,1,0,1,0,65,0,8,1,1,0,4,0,14,0,36,0,58,0,80,0,3,0,0,0,1,1,134,0,3,0,156,
+1,134,0,88,0,1,0,0,0,35,0,3,0,0,0,1,1,64,0,3,0,134,1,112,0,66,0,1,0,0,0,35,
+0,3,0,0,0,1,1,90,0,3,0,44,1,90,0,112,0,1,0,0,0,35,0,3,0,0,0,1,1,20,0,3,0,
+22,1,68,0,90,0,1,0,0,0,35,0,1,0,32,0,140,0,143,0,146,0,150,0,153,0,161,0,
+163,0,165,0,166,0,167,0,168,0,170,0,179,0,180,0,182,0,183,0,185,0,186,0,187,
+0,188,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,0,201,0,
+202,0,1,0,40,0,13,0,140,0,143,0,145,0,146,0,150,0,153,0,155,0,156,0,159,0,
+161,0,163,0,165,0,166,0,167,0,168,0,169,0,170,0,179,0,180,0,182,0,183,0,185,
+0,186,0,187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,
+199,0,200,0,201,0,202,1,37,0,8,2,1,0,4,0,14,0,36,0,58,0,80,0,3,0,0,0,1,0,
+136,0,3,7,196,0,136,0,94,0,1,0,0,0,30,0,3,0,0,0,1,0,66,0,3,7,174,0,114,0,
+72,0,1,0,0,0,30,0,3,0,0,0,1,0,92,0,3,0,50,0,92,7,152,0,1,0,0,0,30,0,3,0,0,
+0,1,0,22,0,3,0,28,0,70,7,130,0,1,0,0,0,30,0,1,0,1,0,35,0,1,0,19,0,141,0,144,
+0,147,0,148,0,149,0,151,0,154,0,162,0,164,0,173,0,175,0,176,0,177,0,178,0,
+181,0,184,0,189,0,203,0,204,0,1,0,1,0,34,0,2,0,9,0,2,0,10,0,236,0,1,0,18,
+0,5,0,0,0,4,0,30,0,30,0,128,0,128,0,1,0,4,0,57,0,58,0,77,0,78,0,16,0,126,
+1,19,1,19,0,127,255,206,255,206,0,128,1,169,1,169,0,130,1,119,1,119,0,132,
+0,125,0,125,0,133,0,250,0,250,0,134,255,106,255,106,0,137,1,69,1,69,0,220,
+2,63,2,63,0,221,1,19,1,19,0,223,2,88,2,88,0,224,1,219,1,219,0,225,2,63,2,
+63,0,227,2,63,2,63,0,233,1,144,1,144,0,235,2,13,2,13,0,16,0,126,0,125,0,125,
+0,127,255,31,255,31,0,128,0,100,0,100,0,129,255,131,255,131,0,130,0,100,0,
+100,0,131,255,181,255,181,0,132,0,50,0,50,0,133,0,75,0,75,0,134,255,6,255,
+6,0,137,0,50,0,50,0,220,0,100,0,100,0,221,0,100,0,100,0,223,0,100,0,100,0,
+224,0,75,0,75,0,233,0,200,0,200,0,235,0,175,0,175,0,2,2,24,0,5,0,0,2,82,2,
+170,0,10,0,13,0,0,0,0,255,181,255,181,0,120,0,120,255,206,255,206,0,0,0,0,
+255,206,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,181,255,181,0,220,0,220,0,0,0,0,0,0,0,0,255,206,255,206,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,206,255,206,0,
+0,0,0,255,6,255,6,0,0,0,0,255,206,255,206,255,206,255,206,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,255,181,255,181,0,0,0,0,0,0,0,0,0,0,0,0,0,110,0,110,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,130,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,0,150,255,156,255,
+156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,150,0,150,255,186,255,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,255,181,255,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,54,1,54,0,170,0,170,0,0,0,0,0,210,0,210,0,75,0,
+75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,206,255,206,
+0,0,0,0,2,78,2,78,0,0,0,0,1,179,1,179,0,200,0,200,1,44,1,44,0,40,0,40,0,190,
+0,190,1,194,1,194,0,0,0,0,0,75,0,75,0,2,0,9,0,8,0,12,0,0,0,16,0,17,0,5,0,
+26,0,35,0,7,0,89,0,90,0,17,0,95,0,96,0,19,0,101,0,102,0,21,0,111,0,114,0,
+23,0,247,0,252,0,27,1,7,1,18,0,33,0,2,0,14,0,8,0,8,0,4,0,9,0,12,0,3,0,16,
+0,17,0,7,0,26,0,27,0,1,0,30,0,33,0,2,0,34,0,35,0,3,0,89,0,90,0,9,0,101,0,
+102,0,5,0,111,0,112,0,8,0,113,0,114,0,6,0,249,0,252,0,3,1,7,1,8,0,1,1,13,
+1,14,0,8,1,17,1,18,0,9,0,2,0,32,0,8,0,8,0,1,0,18,0,18,0,3,0,21,0,22,0,3,0,
+25,0,25,0,3,0,26,0,26,0,7,0,27,0,27,0,4,0,29,0,29,0,4,0,40,0,40,0,5,0,43,
+0,44,0,5,0,47,0,47,0,5,0,57,0,57,0,11,0,60,0,60,0,11,0,65,0,65,0,2,0,77,0,
+77,0,11,0,80,0,80,0,11,0,85,0,85,0,8,0,88,0,88,0,8,0,89,0,89,0,10,0,96,0,
+96,0,4,0,101,0,101,0,6,0,107,0,107,0,3,0,110,0,110,0,3,0,111,0,111,0,12,0,
+112,0,112,0,4,0,113,0,113,0,9,1,2,1,2,0,11,1,4,1,4,0,5,1,6,1,6,0,5,1,7,1,
+7,0,7,1,13,1,13,0,12,1,17,1,17,0,10,1,36,1,36,0,11,0,1,0,9,0,5,0,16,0,34,
+0,60,0,86,0,104,0,1,0,10,0,5,255,56,255,56,0,1,0,2,0,16,0,17,0,1,0,10,0,5,
+255,81,255,81,0,1,0,6,0,55,0,56,0,63,0,64,0,79,0,80,0,1,0,10,0,5,255,106,
+255,106,0,1,0,6,0,83,0,84,0,105,0,106,0,117,0,118,0,1,0,10,0,5,255,131,255,
+131,0,1,0,2,0,121,0,122,0,1,0,10,0,5,255,156,255,156,0,1,0,4,0,38,0,39,0,
+50,0,51,0,1,0,9,0,3,0,12,0,34,0,60,0,1,0,10,0,5,255,106,255,106,0,1,0,4,0,
+63,0,64,0,117,0,118,0,1,0,10,0,5,255,156,255,156,0,1,0,6,0,79,0,80,0,83,0,
+84,0,87,0,88,0,1,0,10,0,5,255,181,255,181,0,1,0,8,0,16,0,17,0,55,0,56,0,71,
+0,72,0,75,0,76,0,1,2,1,0,4,0,14,0,22,0,40,0,84,0,1,1,246,0,2,254,12,0,1,0,
+10,0,5,0,75,0,75,0,1,0,2,0,55,0,56,0,1,0,10,0,5,0,100,0,100,0,1,0,15,0,8,
+0,28,0,29,0,30,0,31,0,32,0,33,0,83,0,84,0,87,0,88,0,95,0,96,0,101,0,102,0,
+1,2,68,0,5,0,175,0,175,0,1,4,1,0,5,0,16,0,32,0,58,0,76,0,92,0,1,0,8,0,2,255,
+181,0,1,0,2,0,158,0,174,0,1,0,10,0,5,0,100,0,100,0,1,0,6,0,26,0,27,0,28,0,
+29,0,95,0,96,0,1,0,10,0,5,0,150,0,150,0,1,0,2,0,101,0,102,0,1,0,10,0,5,1,
+94,1,94,0,1,0,1,0,111,0,1,0,10,0,5,1,119,1,119,0,1,0,1,0,112,0,1,2,1,0,1,
+0,8,0,1,1,50,0,2,254,98,0,1,2,1,0,1,0,8,0,1,1,34,0,2,255,56,0,1,2,1,0,1,0,
+8,0,1,1,18,0,2,255,156,0,1,2,1,0,1,0,8,0,1,1,2,0,2,254,54,0,1,2,1,0,1,0,8,
+0,1,0,242,0,2,255,106,0,1,2,1,0,1,0,8,0,1,0,226,0,2,253,68,0,1,2,1,0,2,0,
+10,1,140,0,1,0,208,0,2,254,112,0,1,2,1,0,3,0,12,0,20,0,30,0,1,0,188,0,2,253,
+143,0,1,1,112,0,5,0,200,0,200,0,1,0,242,0,5,0,250,0,250,0,1,2,1,0,3,0,152,
+0,12,0,22,0,1,0,220,0,5,0,175,0,175,0,1,1,30,0,5,0,220,0,220,0,1,2,1,0,6,
+0,120,0,18,0,28,0,66,0,76,0,92,0,1,0,166,0,5,0,50,0,50,0,1,0,10,0,5,0,110,
+0,110,0,1,0,12,0,28,0,29,0,95,0,96,0,247,0,248,1,9,1,10,1,11,1,12,1,15,1,
+16,0,1,0,134,0,5,0,125,0,125,0,1,0,10,0,5,0,130,0,130,0,1,0,1,0,8,0,1,0,224,
+0,5,1,44,1,44,0,1,2,1,0,6,0,18,0,72,0,88,0,110,0,138,0,164,0,1,0,8,0,4,0,
+50,0,1,0,21,0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,0,160,0,162,0,
+164,0,172,0,173,0,175,0,176,0,177,0,178,0,181,0,184,0,189,1,38,0,1,0,10,0,
+5,0,70,0,70,0,1,0,1,0,123,0,1,0,10,0,5,0,100,0,100,0,1,0,4,0,89,0,90,1,17,
+1,18,0,1,0,10,0,5,0,220,0,220,0,1,0,7,0,8,0,28,0,95,0,247,1,9,1,11,1,15,0,
+1,0,10,0,5,1,4,1,4,0,1,0,6,0,29,0,96,0,248,1,10,1,12,1,16,0,1,0,10,0,5,1,
+24,1,24,0,2,0,3,0,9,0,12,0,0,0,34,0,35,0,4,0,249,0,252,0,6,0,1,1,1,0,1,0,
+8,0,1,0,10,0,5,0,50,0,50,0,1,0,2,0,34,0,35,0,1,0,0,0,10,0,100,1,170,0,2,68,
+70,76,84,0,14,115,121,114,99,0,52,0,4,0,0,0,0,255,255,0,14,0,0,0,2,0,4,0,
+6,0,8,0,10,0,12,0,14,0,16,0,18,0,20,0,22,0,24,0,26,0,4,0,0,0,0,255,255,0,
+14,0,1,0,3,0,5,0,7,0,9,0,11,0,13,0,15,0,17,0,19,0,21,0,23,0,25,0,27,0,28,
+97,97,108,116,0,170,97,97,108,116,0,170,99,97,108,116,0,178,99,97,108,116,
+0,178,99,99,109,112,0,252,99,99,109,112,0,252,102,105,110,50,1,4,102,105,
+110,50,1,4,102,105,110,51,1,10,102,105,110,51,1,10,102,105,110,97,1,16,102,
+105,110,97,1,16,105,110,105,116,1,22,105,110,105,116,1,22,109,101,100,50,
+1,28,109,101,100,50,1,28,109,101,100,105,1,34,109,101,100,105,1,34,114,108,
+105,103,1,40,114,108,105,103,1,40,115,97,108,116,1,46,115,97,108,116,1,46,
+115,115,48,49,1,52,115,115,48,49,1,52,115,115,48,50,1,58,115,115,48,50,1,
+58,115,115,48,51,1,64,115,115,48,51,1,64,0,0,0,2,0,0,0,1,0,0,0,35,0,13,0,
+14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,
+0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,
+0,44,0,45,0,46,0,47,0,0,0,2,0,2,0,3,0,0,0,1,0,8,0,0,0,1,0,9,0,0,0,1,0,7,0,
+0,0,1,0,4,0,0,0,1,0,6,0,0,0,1,0,5,0,0,0,1,0,10,0,0,0,1,0,51,0,0,0,1,0,48,
+0,0,0,1,0,49,0,0,0,1,0,50,0,59,0,120,0,254,2,240,3,12,5,132,5,146,5,208,5,
+222,6,116,6,130,6,150,6,196,13,28,19,144,20,30,20,166,21,8,21,34,21,88,21,
+182,21,240,22,154,23,114,23,152,24,4,24,82,24,220,25,14,25,108,25,210,26,
+16,26,174,27,106,28,8,31,118,31,232,32,38,32,90,35,118,36,36,36,110,45,44,
+46,94,47,196,48,188,48,214,49,22,49,54,49,150,49,172,49,198,49,220,50,6,51,
+48,51,118,51,172,51,222,52,56,52,98,0,1,0,0,0,1,0,8,0,2,0,64,0,29,0,249,0,
+250,1,8,1,10,0,31,0,33,0,35,1,3,1,4,1,5,1,6,0,74,1,18,1,12,0,102,1,14,0,114,
+1,45,0,171,0,174,0,231,0,232,1,15,1,16,0,251,0,252,1,48,1,49,1,50,0,1,0,29,
+0,11,0,12,0,27,0,29,0,30,0,32,0,34,0,42,0,43,0,46,0,47,0,70,0,90,0,96,0,101,
+0,112,0,113,0,139,0,157,0,158,0,225,0,226,0,247,0,248,0,249,0,250,1,53,1,
+54,1,55,0,3,0,0,0,1,0,8,0,1,1,144,0,43,0,92,0,102,0,110,0,118,0,124,0,130,
+0,138,0,144,0,150,0,156,0,162,0,170,0,178,0,186,0,194,0,202,0,210,0,218,0,
+226,0,234,0,242,0,248,0,254,1,4,1,14,1,22,1,30,1,38,1,46,1,52,1,60,1,66,1,
+74,1,82,1,90,1,98,1,106,1,112,1,120,1,128,1,132,1,136,1,140,0,4,0,12,0,11,
+0,10,0,9,0,3,0,17,0,16,0,15,0,3,0,21,0,20,0,19,0,2,1,19,1,25,0,2,1,20,1,26,
+0,3,0,25,0,24,0,23,0,2,1,21,1,27,0,2,1,22,1,28,0,2,0,27,1,7,0,2,0,29,1,9,
+0,3,0,39,0,38,0,37,0,3,0,43,0,42,0,41,0,3,0,47,0,46,0,45,0,3,0,51,0,50,0,
+49,0,3,0,56,0,55,0,54,0,3,0,60,0,59,0,58,0,3,1,1,0,254,1,35,0,3,1,2,0,253,
+1,36,0,3,0,64,0,63,0,62,0,3,0,68,0,67,0,66,0,2,1,32,1,31,0,2,1,0,1,33,0,2,
+0,255,1,34,0,4,0,72,0,71,0,70,0,73,0,3,0,76,0,75,0,74,0,3,0,80,0,79,0,78,
+0,3,0,84,0,83,0,82,0,3,0,88,0,87,0,86,0,2,0,90,1,17,0,3,0,94,0,93,0,92,0,
+2,0,96,1,11,0,3,0,100,0,99,0,98,0,3,0,106,0,105,0,104,0,3,0,110,0,109,0,108,
+0,3,1,23,1,21,1,29,0,3,1,24,1,22,1,30,0,2,0,112,1,13,0,3,0,118,0,117,0,116,
+0,3,0,122,0,121,0,120,0,1,0,67,0,1,0,68,0,1,0,59,0,1,0,60,0,1,0,43,0,8,0,
+14,0,18,0,19,0,20,0,22,0,23,0,24,0,26,0,28,0,36,0,40,0,44,0,48,0,53,0,57,
+0,59,0,60,0,61,0,65,0,66,0,67,0,68,0,69,0,73,0,77,0,81,0,85,0,89,0,91,0,95,
+0,97,0,103,0,107,0,108,0,109,0,111,0,115,0,119,1,33,1,34,1,35,1,36,0,2,0,
+0,0,1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,0,142,0,2,1,37,1,38,0,6,0,1,0,28,0,62,
+0,80,0,98,0,116,0,134,0,152,0,170,0,188,0,206,0,224,0,242,1,4,1,22,1,40,1,
+58,1,76,1,94,1,112,1,130,1,148,1,166,1,196,1,220,1,244,2,12,2,36,2,66,2,90,
+0,3,0,0,0,2,1,176,1,122,0,0,0,1,0,0,0,52,0,3,0,0,0,2,1,134,1,104,0,0,0,1,
+0,0,0,52,0,3,0,0,0,2,1,242,1,86,0,0,0,1,0,0,0,52,0,3,0,0,0,2,1,254,1,68,0,
+0,0,1,0,0,0,52,0,3,0,0,0,2,1,152,1,50,0,0,0,1,0,0,0,52,0,3,0,0,0,2,1,110,
+1,32,0,0,0,1,0,0,0,52,0,3,0,0,0,2,1,20,1,14,0,0,0,1,0,0,0,52,0,3,0,0,0,2,
+1,26,1,122,0,0,0,1,0,0,0,52,0,3,0,0,0,2,1,32,1,104,0,0,0,1,0,0,0,52,0,3,0,
+0,0,2,1,38,1,86,0,0,0,1,0,0,0,52,0,3,0,0,0,2,1,44,1,68,0,0,0,1,0,0,0,52,0,
+3,0,0,0,2,1,56,1,50,0,0,0,1,0,0,0,52,0,3,0,0,0,2,1,62,1,86,0,0,0,1,0,0,0,
+52,0,3,0,0,0,2,1,74,1,68,0,0,0,1,0,0,0,52,0,3,0,0,0,2,0,126,0,180,0,0,0,1,
+0,0,0,52,0,3,0,0,0,2,0,108,0,138,0,0,0,1,0,0,0,52,0,3,0,0,0,2,0,90,0,246,
+0,0,0,1,0,0,0,52,0,3,0,0,0,2,0,72,1,2,0,0,0,1,0,0,0,52,0,3,0,0,0,2,0,54,0,
+156,0,0,0,1,0,0,0,52,0,3,0,0,0,2,0,36,0,114,0,0,0,1,0,0,0,52,0,3,0,0,0,2,
+0,18,0,24,0,0,0,1,0,0,0,52,0,1,0,1,0,185,0,1,0,1,0,190,0,3,0,0,0,2,0,114,
+0,18,0,0,0,1,0,0,0,52,0,1,0,1,0,179,0,3,0,0,0,2,0,90,0,18,0,0,0,1,0,0,0,52,
+0,1,0,1,0,182,0,3,0,0,0,2,0,66,0,18,0,0,0,1,0,0,0,52,0,1,0,1,0,180,0,3,0,
+0,0,2,0,42,0,18,0,0,0,1,0,0,0,52,0,1,0,1,0,183,0,3,0,0,0,2,0,18,0,24,0,0,
+0,1,0,0,0,52,0,1,0,1,0,188,0,1,0,1,0,186,0,3,0,0,0,2,0,42,0,18,0,0,0,1,0,
+0,0,52,0,1,0,1,0,184,0,3,0,0,0,2,0,18,0,24,0,0,0,1,0,0,0,52,0,1,0,1,0,189,
+0,1,0,1,0,181,0,1,0,9,0,1,0,8,0,1,0,20,0,3,0,1,0,9,0,1,0,8,0,1,0,6,0,2,0,
+1,0,22,0,14,0,18,0,22,0,36,0,40,0,44,0,48,0,53,0,57,0,61,0,65,0,69,0,73,0,
+77,0,81,0,85,0,91,0,97,0,103,0,107,0,115,0,119,0,1,0,9,0,1,0,8,0,1,0,184,
+0,4,0,1,0,9,0,1,0,8,0,2,0,72,0,33,0,11,0,15,0,19,0,23,0,27,0,29,0,31,0,33,
+0,35,0,37,0,41,0,45,0,49,0,54,0,58,0,62,0,66,0,70,0,74,0,78,0,82,0,86,0,90,
+0,92,0,96,0,98,0,102,0,104,0,108,0,112,0,114,0,116,0,120,0,1,0,33,0,8,0,14,
+0,18,0,22,0,26,0,28,0,30,0,32,0,34,0,36,0,40,0,44,0,48,0,53,0,57,0,61,0,65,
+0,69,0,73,0,77,0,81,0,85,0,89,0,91,0,95,0,97,0,101,0,103,0,107,0,111,0,113,
+0,115,0,119,0,1,0,9,0,1,0,8,0,1,0,20,0,2,0,1,0,9,0,1,0,8,0,1,0,6,0,1,0,1,
+0,1,0,8,0,4,0,1,0,1,0,8,0,1,0,30,0,2,0,10,0,20,0,1,0,4,0,247,0,2,0,170,0,
+1,0,4,0,248,0,2,0,170,0,1,0,2,0,95,0,96,0,2,0,9,0,1,0,8,0,1,7,160,0,161,1,
+72,1,80,1,88,1,96,1,104,1,112,1,120,1,128,1,136,1,144,1,152,1,160,1,168,1,
+176,1,184,1,192,1,200,1,208,1,216,1,224,1,232,1,240,1,248,2,0,2,8,2,16,2,
+24,2,32,2,40,2,48,2,56,2,64,2,72,2,80,2,88,2,96,2,104,2,112,2,120,2,128,2,
+136,2,144,2,152,2,160,2,168,2,176,2,184,2,192,2,200,2,208,2,216,2,224,2,232,
+2,240,2,248,3,0,3,8,3,16,3,24,3,32,3,40,3,48,3,56,3,64,3,72,3,80,3,88,3,96,
+3,104,3,112,3,120,3,128,3,136,3,144,3,152,3,160,3,168,3,176,3,184,3,192,3,
+200,3,208,3,216,3,224,3,232,3,240,3,248,4,0,4,8,4,16,4,24,4,32,4,40,4,48,
+4,56,4,64,4,72,4,80,4,88,4,96,4,104,4,112,4,120,4,128,4,136,4,144,4,152,4,
+160,4,168,4,176,4,184,4,192,4,200,4,208,4,216,4,224,4,232,4,240,4,248,5,0,
+5,8,5,16,5,24,5,32,5,40,5,48,5,56,5,64,5,72,5,80,5,88,5,96,5,104,5,112,5,
+120,5,128,5,136,5,144,5,152,5,160,5,168,5,176,5,184,5,192,5,200,5,208,5,216,
+5,224,5,232,5,240,5,248,6,0,6,8,6,16,6,24,6,32,6,40,6,48,6,56,6,64,6,72,0,
+3,1,51,0,8,1,53,0,3,1,51,0,9,1,53,0,3,1,51,0,10,1,53,0,3,1,51,0,11,1,53,0,
+3,1,51,0,12,1,53,0,3,1,52,0,14,1,54,0,3,1,52,0,15,1,54,0,3,1,52,0,16,1,54,
+0,3,1,52,0,17,1,54,0,3,1,52,0,18,1,54,0,3,1,52,0,19,1,54,0,3,1,52,0,20,1,
+54,0,3,1,52,0,21,1,54,0,3,1,52,0,22,1,54,0,3,1,52,0,23,1,54,0,3,1,52,0,24,
+1,54,0,3,1,52,0,25,1,54,0,3,1,51,0,26,1,53,0,3,1,51,0,27,1,53,0,3,1,51,0,
+28,1,53,0,3,1,51,0,29,1,53,0,3,1,52,0,30,1,54,0,3,1,52,0,31,1,54,0,3,1,52,
+0,32,1,53,0,3,1,52,0,33,1,53,0,3,1,51,0,34,1,53,0,3,1,51,0,35,1,53,0,3,1,
+52,0,36,1,54,0,3,1,52,0,37,1,54,0,3,1,52,0,38,1,53,0,3,1,52,0,39,1,53,0,3,
+1,52,0,40,1,53,0,3,1,52,0,41,1,54,0,3,1,52,0,42,1,54,0,3,1,52,0,43,1,53,0,
+3,1,52,0,44,1,53,0,3,1,52,0,45,1,54,0,3,1,52,0,46,1,54,0,3,1,52,0,47,1,53,
+0,3,1,52,0,48,1,53,0,3,1,52,0,49,1,54,0,3,1,51,0,50,1,53,0,3,1,51,0,51,1,
+53,0,3,1,52,0,52,1,55,0,3,1,52,0,53,1,53,0,3,1,52,0,54,1,53,0,3,1,52,0,55,
+1,53,0,3,1,52,0,56,1,53,0,3,1,52,0,57,1,56,0,3,1,52,0,58,1,56,0,3,1,52,0,
+59,1,53,0,3,1,52,0,60,1,53,0,3,1,52,0,61,1,54,0,3,1,52,0,62,1,54,0,3,1,52,
+0,63,1,54,0,3,1,52,0,64,1,54,0,3,1,51,0,65,1,53,0,3,1,51,0,66,1,53,0,3,1,
+51,0,67,1,53,0,3,1,51,0,68,1,53,0,3,1,52,0,69,1,55,0,3,1,52,0,70,1,55,0,3,
+1,52,0,71,1,54,0,3,1,52,0,72,1,54,0,3,1,52,0,73,1,54,0,3,1,52,0,74,1,54,0,
+3,1,52,0,75,1,54,0,3,1,52,0,76,1,54,0,3,1,52,0,77,1,49,0,3,1,52,0,78,1,49,
+0,3,1,52,0,79,1,53,0,3,1,52,0,80,1,53,0,3,1,52,0,81,1,54,0,3,1,52,0,82,1,
+54,0,3,1,52,0,83,1,54,0,3,1,52,0,84,1,54,0,3,1,52,0,85,1,54,0,3,1,52,0,86,
+1,54,0,3,1,52,0,87,1,54,0,3,1,52,0,88,1,54,0,3,1,51,0,89,1,48,0,3,1,51,0,
+90,1,48,0,3,1,52,0,91,1,54,0,3,1,52,0,92,1,54,0,3,1,52,0,93,1,53,0,3,1,52,
+0,94,1,53,0,3,1,51,0,95,1,53,0,3,1,51,0,96,1,53,0,3,1,52,0,97,1,54,0,3,1,
+52,0,98,1,54,0,3,1,52,0,99,1,53,0,3,1,52,0,100,1,53,0,3,1,52,0,101,1,53,0,
+3,1,52,0,102,1,53,0,3,1,52,0,103,1,54,0,3,1,52,0,104,1,54,0,3,1,52,0,105,
+1,54,0,3,1,52,0,106,1,54,0,3,1,52,0,107,1,54,0,3,1,52,0,108,1,54,0,3,1,52,
+0,109,1,54,0,3,1,52,0,110,1,54,0,3,1,51,0,111,1,53,0,3,1,51,0,112,1,53,0,
+3,1,52,0,113,1,53,0,3,1,52,0,114,1,53,0,3,1,52,0,115,1,54,0,3,1,52,0,116,
+1,54,0,3,1,52,0,117,1,54,0,3,1,52,0,118,1,54,0,3,1,52,0,119,1,54,0,3,1,52,
+0,120,1,54,0,3,1,52,0,121,1,53,0,3,1,52,0,122,1,53,0,3,1,52,0,123,1,53,0,
+3,1,51,0,124,1,53,0,3,1,51,0,247,1,53,0,3,1,51,0,248,1,53,0,3,1,51,0,249,
+1,53,0,3,1,51,0,250,1,53,0,3,1,51,0,251,1,53,0,3,1,51,0,252,1,53,0,3,1,51,
+0,253,1,53,0,3,1,51,0,254,1,53,0,3,1,51,0,255,1,53,0,3,1,51,1,0,1,53,0,3,
+1,52,1,1,1,54,0,3,1,52,1,2,1,54,0,3,1,52,1,3,1,54,0,3,1,52,1,4,1,54,0,3,1,
+52,1,5,1,54,0,3,1,52,1,6,1,54,0,3,1,51,1,7,1,53,0,3,1,52,1,8,1,53,0,3,1,51,
+1,9,1,53,0,3,1,52,1,10,1,53,0,3,1,51,1,11,1,53,0,3,1,52,1,12,1,53,0,3,1,52,
+1,13,1,53,0,3,1,52,1,14,1,53,0,3,1,52,1,15,1,53,0,3,1,52,1,16,1,53,0,3,1,
+51,1,17,1,48,0,3,1,51,1,18,1,48,0,3,1,52,1,19,1,54,0,3,1,52,1,20,1,54,0,3,
+1,52,1,21,1,54,0,3,1,52,1,22,1,54,0,3,1,52,1,23,1,54,0,3,1,52,1,24,1,54,0,
+3,1,52,1,25,1,54,0,3,1,52,1,26,1,54,0,3,1,52,1,27,1,54,0,3,1,52,1,28,1,54,
+0,3,1,52,1,29,1,54,0,3,1,52,1,30,1,54,0,3,1,51,1,31,1,53,0,3,1,51,1,33,1,
+53,0,3,1,51,1,34,1,53,0,3,1,52,1,35,1,53,0,3,1,52,1,36,1,53,0,2,0,9,0,1,0,
+8,0,1,1,72,0,161,1,100,1,108,1,116,1,124,1,132,1,140,1,148,1,156,1,164,1,
+172,1,180,1,188,1,196,1,204,1,212,1,220,1,228,1,236,1,244,1,252,2,4,2,12,
+2,20,2,28,2,36,2,44,2,52,2,60,2,68,2,76,2,84,2,92,2,100,2,108,2,116,2,124,
+2,132,2,140,2,148,2,156,2,164,2,172,2,180,2,188,2,196,2,204,2,212,2,220,2,
+228,2,236,2,244,2,252,3,4,3,12,3,20,3,28,3,36,3,44,3,52,3,60,3,68,3,76,3,
+84,3,92,3,100,3,108,3,116,3,124,3,132,3,140,3,148,3,156,3,164,3,172,3,180,
+3,188,3,196,3,204,3,212,3,220,3,228,3,236,3,244,3,252,4,4,4,12,4,20,4,28,
+4,36,4,44,4,52,4,60,4,68,4,76,4,84,4,92,4,100,4,108,4,116,4,124,4,132,4,140,
+4,148,4,156,4,164,4,172,4,180,4,188,4,196,4,204,4,212,4,220,4,228,4,236,4,
+244,4,252,5,4,5,12,5,20,5,28,5,36,5,44,5,52,5,60,5,68,5,76,5,84,5,92,5,100,
+5,108,5,116,5,124,5,132,5,140,5,148,5,156,5,164,5,172,5,180,5,188,5,196,5,
+204,5,212,5,220,5,228,5,236,5,244,5,252,6,4,6,12,6,20,6,28,6,36,6,44,6,52,
+6,60,6,68,6,76,6,84,6,92,6,100,0,2,0,4,0,8,0,12,0,0,0,14,0,124,0,5,0,247,
+1,31,0,116,1,33,1,36,0,157,0,3,1,46,0,8,1,53,0,3,1,46,0,9,1,53,0,3,1,46,0,
+10,1,53,0,3,1,46,0,11,1,53,0,3,1,46,0,12,1,53,0,3,1,47,0,14,1,54,0,3,1,47,
+0,15,1,54,0,3,1,47,0,16,1,54,0,3,1,47,0,17,1,54,0,3,1,47,0,18,1,54,0,3,1,
+47,0,19,1,54,0,3,1,47,0,20,1,54,0,3,1,47,0,21,1,54,0,3,1,47,0,22,1,54,0,3,
+1,47,0,23,1,54,0,3,1,47,0,24,1,54,0,3,1,47,0,25,1,54,0,3,1,46,0,26,1,53,0,
+3,1,46,0,27,1,53,0,3,1,46,0,28,1,53,0,3,1,46,0,29,1,53,0,3,1,47,0,30,1,54,
+0,3,1,47,0,31,1,54,0,3,1,47,0,32,1,53,0,3,1,47,0,33,1,53,0,3,1,46,0,34,1,
+53,0,3,1,46,0,35,1,53,0,3,1,47,0,36,1,54,0,3,1,47,0,37,1,54,0,3,1,47,0,38,
+1,53,0,3,1,47,0,39,1,53,0,3,1,47,0,40,1,53,0,3,1,47,0,41,1,54,0,3,1,47,0,
+42,1,54,0,3,1,47,0,43,1,53,0,3,1,47,0,44,1,53,0,3,1,47,0,45,1,54,0,3,1,47,
+0,46,1,54,0,3,1,47,0,47,1,53,0,3,1,47,0,48,1,53,0,3,1,47,0,49,1,54,0,3,1,
+46,0,50,1,53,0,3,1,46,0,51,1,53,0,3,1,47,0,52,1,55,0,3,1,47,0,53,1,53,0,3,
+1,47,0,54,1,53,0,3,1,47,0,55,1,53,0,3,1,47,0,56,1,53,0,3,1,47,0,57,1,56,0,
+3,1,47,0,58,1,56,0,3,1,47,0,59,1,53,0,3,1,47,0,60,1,53,0,3,1,47,0,61,1,54,
+0,3,1,47,0,62,1,54,0,3,1,47,0,63,1,54,0,3,1,47,0,64,1,54,0,3,1,46,0,65,1,
+53,0,3,1,46,0,66,1,53,0,3,1,46,0,67,1,53,0,3,1,46,0,68,1,53,0,3,1,47,0,69,
+1,55,0,3,1,47,0,70,1,55,0,3,1,47,0,71,1,54,0,3,1,47,0,72,1,54,0,3,1,47,0,
+73,1,54,0,3,1,47,0,74,1,54,0,3,1,47,0,75,1,54,0,3,1,47,0,76,1,54,0,3,1,47,
+0,77,1,49,0,3,1,47,0,78,1,49,0,3,1,47,0,79,1,53,0,3,1,47,0,80,1,53,0,3,1,
+47,0,81,1,54,0,3,1,47,0,82,1,54,0,3,1,47,0,83,1,54,0,3,1,47,0,84,1,54,0,3,
+1,47,0,85,1,54,0,3,1,47,0,86,1,54,0,3,1,47,0,87,1,54,0,3,1,47,0,88,1,54,0,
+3,1,46,0,89,1,48,0,3,1,46,0,90,1,48,0,3,1,47,0,91,1,54,0,3,1,47,0,92,1,54,
+0,3,1,47,0,93,1,53,0,3,1,47,0,94,1,53,0,3,1,46,0,95,1,53,0,3,1,46,0,96,1,
+53,0,3,1,47,0,97,1,54,0,3,1,47,0,98,1,54,0,3,1,47,0,99,1,53,0,3,1,47,0,100,
+1,53,0,3,1,47,0,101,1,53,0,3,1,47,0,102,1,53,0,3,1,47,0,103,1,54,0,3,1,47,
+0,104,1,54,0,3,1,47,0,105,1,54,0,3,1,47,0,106,1,54,0,3,1,47,0,107,1,54,0,
+3,1,47,0,108,1,54,0,3,1,47,0,109,1,54,0,3,1,47,0,110,1,54,0,3,1,46,0,111,
+1,53,0,3,1,46,0,112,1,53,0,3,1,47,0,113,1,53,0,3,1,47,0,114,1,53,0,3,1,47,
+0,115,1,54,0,3,1,47,0,116,1,54,0,3,1,47,0,117,1,54,0,3,1,47,0,118,1,54,0,
+3,1,47,0,119,1,54,0,3,1,47,0,120,1,54,0,3,1,47,0,121,1,53,0,3,1,47,0,122,
+1,53,0,3,1,47,0,123,1,53,0,3,1,46,0,124,1,53,0,3,1,46,0,247,1,53,0,3,1,46,
+0,248,1,53,0,3,1,46,0,249,1,53,0,3,1,46,0,250,1,53,0,3,1,46,0,251,1,53,0,
+3,1,46,0,252,1,53,0,3,1,46,0,253,1,53,0,3,1,46,0,254,1,53,0,3,1,46,0,255,
+1,53,0,3,1,46,1,0,1,53,0,3,1,47,1,1,1,54,0,3,1,47,1,2,1,54,0,3,1,47,1,3,1,
+54,0,3,1,47,1,4,1,54,0,3,1,47,1,5,1,54,0,3,1,47,1,6,1,54,0,3,1,46,1,7,1,53,
+0,3,1,47,1,8,1,53,0,3,1,46,1,9,1,53,0,3,1,47,1,10,1,53,0,3,1,46,1,11,1,53,
+0,3,1,47,1,12,1,53,0,3,1,47,1,13,1,53,0,3,1,47,1,14,1,53,0,3,1,47,1,15,1,
+53,0,3,1,47,1,16,1,53,0,3,1,46,1,17,1,48,0,3,1,46,1,18,1,48,0,3,1,47,1,19,
+1,54,0,3,1,47,1,20,1,54,0,3,1,47,1,21,1,54,0,3,1,47,1,22,1,54,0,3,1,47,1,
+23,1,54,0,3,1,47,1,24,1,54,0,3,1,47,1,25,1,54,0,3,1,47,1,26,1,54,0,3,1,47,
+1,27,1,54,0,3,1,47,1,28,1,54,0,3,1,47,1,29,1,54,0,3,1,47,1,30,1,54,0,3,1,
+46,1,31,1,53,0,3,1,46,1,33,1,53,0,3,1,46,1,34,1,53,0,3,1,47,1,35,1,53,0,3,
+1,47,1,36,1,53,0,6,0,9,0,6,0,18,0,36,0,54,0,72,0,90,0,108,0,3,0,1,0,108,0,
+1,27,114,0,0,0,1,0,0,0,53,0,3,0,1,0,90,0,1,27,122,0,0,0,1,0,0,0,53,0,3,0,
+1,0,72,0,1,27,130,0,0,0,1,0,0,0,53,0,3,0,1,0,54,0,1,27,138,0,0,0,1,0,0,0,
+53,0,3,0,1,0,36,0,1,27,146,0,0,0,1,0,0,0,53,0,3,0,1,0,18,0,1,27,194,0,0,0,
+1,0,0,0,53,0,1,0,6,0,20,0,21,0,24,0,25,0,109,0,110,0,6,0,9,0,6,0,18,0,36,
+0,54,0,72,0,90,0,108,0,3,0,1,0,108,0,1,26,228,0,0,0,1,0,0,0,53,0,3,0,1,0,
+90,0,1,26,236,0,0,0,1,0,0,0,53,0,3,0,1,0,72,0,1,26,244,0,0,0,1,0,0,0,53,0,
+3,0,1,0,54,0,1,26,252,0,0,0,1,0,0,0,53,0,3,0,1,0,36,0,1,27,4,0,0,0,1,0,0,
+0,53,0,3,0,1,0,18,0,1,27,52,0,0,0,1,0,0,0,53,0,1,0,3,1,20,1,22,1,24,0,6,0,
+9,0,4,0,14,0,32,0,50,0,74,0,3,0,0,0,1,15,142,0,1,0,54,0,1,0,0,0,53,0,3,0,
+0,0,1,15,124,0,1,0,60,0,1,0,0,0,53,0,3,0,0,0,1,15,132,0,1,0,18,0,1,0,0,0,
+53,0,1,0,1,0,117,0,3,0,0,0,1,15,108,0,1,0,18,0,1,0,0,0,53,0,1,0,1,0,116,0,
+6,0,9,0,1,0,8,0,3,0,0,0,1,2,124,0,1,31,66,0,1,0,0,0,53,0,6,0,9,0,1,0,8,0,
+3,0,1,0,18,0,1,3,34,0,0,0,1,0,0,0,53,0,1,0,12,0,20,0,21,0,24,0,25,0,109,0,
+110,1,20,1,22,1,24,1,26,1,28,1,30,0,6,0,9,0,4,0,14,0,32,0,50,0,68,0,3,0,0,
+0,1,14,220,0,1,0,72,0,1,0,0,0,54,0,3,0,0,0,1,14,228,0,1,0,54,0,1,0,0,0,54,
+0,3,0,0,0,1,3,76,0,1,0,36,0,1,0,0,0,54,0,3,0,0,0,1,3,34,0,1,0,18,0,1,0,0,
+0,54,0,1,0,2,0,11,0,12,0,6,0,9,0,2,0,10,0,34,0,3,0,1,1,120,0,1,0,18,0,0,0,
+1,0,0,0,54,0,1,0,1,0,11,0,3,0,1,1,96,0,1,0,18,0,0,0,1,0,0,0,54,0,1,0,1,0,
+12,0,6,1,1,0,4,0,14,0,36,0,58,0,80,0,3,0,2,0,88,1,58,0,1,0,236,0,1,21,226,
+0,1,0,0,0,54,0,3,0,2,0,66,1,36,0,1,1,46,0,1,21,204,0,1,0,0,0,54,0,3,0,2,21,
+182,1,14,0,1,0,192,0,1,0,44,0,1,0,0,0,54,0,3,0,2,21,160,0,248,0,1,1,2,0,1,
+0,22,0,1,0,0,0,54,0,1,0,32,0,140,0,143,0,146,0,150,0,153,0,161,0,163,0,165,
+0,166,0,167,0,168,0,170,0,179,0,180,0,182,0,183,0,185,0,186,0,187,0,188,0,
+191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,0,201,0,202,0,6,
+2,1,0,4,0,14,0,36,0,58,0,86,0,3,0,2,0,160,0,144,0,1,0,66,0,1,0,94,0,1,0,0,
+0,54,0,3,0,2,0,138,0,122,0,1,0,132,0,1,0,72,0,1,0,0,0,54,0,3,0,2,0,50,0,100,
+0,1,0,22,0,1,0,116,0,1,0,0,0,54,0,1,0,1,0,249,0,3,0,2,0,22,0,72,0,1,0,82,
+0,1,0,88,0,1,0,0,0,54,0,1,0,23,0,141,0,144,0,147,0,148,0,149,0,151,0,152,
+0,154,0,160,0,162,0,164,0,172,0,173,0,175,0,176,0,177,0,178,0,181,0,184,0,
+189,0,203,0,204,1,38,0,2,0,1,0,253,1,0,0,0,0,1,0,1,0,250,0,1,0,19,0,141,0,
+144,0,147,0,148,0,149,0,151,0,154,0,162,0,164,0,173,0,175,0,176,0,177,0,178,
+0,181,0,184,0,189,0,203,0,204,0,6,0,9,0,1,0,8,0,3,0,1,0,18,0,1,0,210,0,0,
+0,1,0,0,0,54,0,1,0,4,0,42,0,43,0,46,0,47,0,6,1,1,0,2,0,10,0,32,0,3,0,2,20,
+62,0,42,0,1,0,170,0,1,20,62,0,1,0,0,0,54,0,3,0,1,0,20,0,1,0,148,0,1,20,40,
+0,1,0,0,0,54,0,1,0,26,0,16,0,17,0,50,0,51,0,55,0,56,0,59,0,60,0,63,0,64,0,
+71,0,72,0,75,0,76,0,79,0,80,0,83,0,84,0,87,0,88,0,93,0,94,0,99,0,100,0,105,
+0,106,0,6,2,1,0,2,0,10,0,32,0,3,0,2,24,128,0,42,0,1,0,62,0,1,24,128,0,1,0,
+0,0,54,0,3,0,1,0,20,0,1,0,40,0,1,24,106,0,1,0,0,0,54,0,1,0,8,0,50,0,51,0,
+59,0,60,0,67,0,68,0,121,0,122,0,1,0,1,0,66,0,6,0,9,0,6,0,18,0,36,0,54,0,72,
+0,90,0,114,0,3,0,0,0,1,0,90,0,1,1,226,0,1,0,0,0,55,0,3,0,0,0,1,0,96,0,1,1,
+208,0,1,0,0,0,55,0,3,0,0,0,1,0,54,0,1,4,34,0,1,0,0,0,55,0,3,0,0,0,1,0,60,
+0,1,4,16,0,1,0,0,0,55,0,3,0,0,0,1,0,18,0,1,27,166,0,1,0,0,0,55,0,1,0,1,0,
+67,0,3,0,0,0,1,0,18,0,1,27,142,0,1,0,0,0,55,0,1,0,1,0,68,0,6,3,1,0,2,0,10,
+0,30,0,3,0,0,0,1,1,10,0,2,3,196,20,62,0,1,0,0,0,55,0,3,0,0,0,1,1,16,0,2,3,
+176,20,42,0,1,0,0,0,55,0,6,4,1,0,4,0,14,0,34,0,54,0,74,0,3,0,0,0,1,0,212,
+0,2,3,142,2,176,0,1,0,0,0,55,0,3,0,0,0,1,0,218,0,2,3,122,2,156,0,1,0,0,0,
+55,0,3,0,0,0,1,0,172,0,2,6,158,2,136,0,1,0,0,0,55,0,3,0,0,0,1,0,178,0,2,6,
+138,2,116,0,1,0,0,0,55,0,6,2,1,0,4,0,14,0,36,0,58,0,80,0,3,0,0,0,1,0,118,
+0,3,23,20,6,54,23,20,0,1,0,0,0,55,0,3,0,0,0,1,0,122,0,3,22,254,6,32,22,254,
+0,1,0,0,0,55,0,3,0,0,0,1,0,74,0,3,22,232,6,60,22,232,0,1,0,0,0,55,0,3,0,0,
+0,1,0,78,0,3,22,210,6,38,22,210,0,1,0,0,0,55,0,6,2,1,0,2,0,10,0,36,0,3,0,
+0,0,1,0,20,0,2,22,178,26,118,0,1,0,0,0,55,0,1,0,1,1,33,0,3,0,0,0,1,0,20,0,
+2,22,152,26,92,0,1,0,0,0,55,0,1,0,1,1,34,0,6,0,9,0,6,0,18,0,36,0,86,0,104,
+0,122,0,140,0,3,0,0,0,1,10,58,0,1,0,36,0,1,0,0,0,55,0,3,0,0,0,1,10,14,0,1,
+0,18,0,1,0,0,0,55,0,1,0,14,0,37,0,38,0,41,0,42,0,45,0,46,0,49,0,50,0,54,0,
+58,0,59,0,78,0,79,0,102,0,3,0,0,0,1,9,246,0,1,2,68,0,1,0,0,0,55,0,3,0,0,0,
+1,9,202,0,1,2,50,0,1,0,0,0,55,0,3,0,0,0,1,9,210,0,1,25,200,0,1,0,0,0,55,0,
+3,0,0,0,1,9,166,0,1,25,182,0,1,0,0,0,55,0,6,3,1,0,8,0,22,0,42,0,62,0,82,0,
+102,0,122,0,148,0,168,0,3,0,0,0,1,5,66,0,2,1,230,18,96,0,1,0,0,0,55,0,3,0,
+0,0,1,5,72,0,2,1,210,18,76,0,1,0,0,0,55,0,3,0,0,0,1,5,26,0,2,4,246,18,56,
+0,1,0,0,0,55,0,3,0,0,0,1,5,32,0,2,4,226,18,36,0,1,0,0,0,55,0,3,0,0,0,1,4,
+242,0,2,0,40,18,16,0,1,0,0,0,55,0,3,0,0,0,1,4,248,0,2,0,20,17,252,0,1,0,0,
+0,55,0,1,0,1,0,102,0,3,0,0,0,1,4,196,0,2,20,58,17,226,0,1,0,0,0,55,0,3,0,
+0,0,1,4,202,0,2,20,38,17,206,0,1,0,0,0,55,0,6,4,1,0,6,0,18,0,38,0,58,0,78,
+0,106,0,126,0,3,0,0,0,1,4,138,0,2,1,46,0,80,0,1,0,0,0,55,0,3,0,0,0,1,4,144,
+0,2,1,26,0,60,0,1,0,0,0,55,0,3,0,0,0,1,4,98,0,2,4,62,0,40,0,1,0,0,0,55,0,
+3,0,0,0,1,4,104,0,2,4,42,0,20,0,1,0,0,0,55,0,1,0,2,0,158,0,174,0,3,0,0,0,
+1,4,50,0,2,0,40,0,46,0,1,0,0,0,55,0,3,0,0,0,1,4,56,0,2,0,20,0,26,0,1,0,0,
+0,55,0,1,0,1,0,101,0,1,0,1,0,174,0,6,1,1,0,36,0,78,0,100,0,122,0,142,0,174,
+0,196,0,218,0,238,1,2,1,24,1,46,1,66,1,86,1,108,1,130,1,150,1,176,1,198,1,
+220,1,240,2,10,2,34,2,58,2,80,2,102,2,124,2,146,2,166,2,186,2,208,2,230,2,
+250,3,20,3,42,3,64,3,84,0,3,0,0,0,1,3,176,0,3,15,138,0,84,15,138,0,1,0,0,
+0,55,0,3,0,0,0,1,3,180,0,3,15,116,0,62,15,116,0,1,0,0,0,55,0,3,0,0,0,1,3,
+132,0,2,0,40,15,94,0,1,0,0,0,55,0,3,0,0,0,1,3,138,0,2,0,20,15,74,0,1,0,0,
+0,55,0,1,0,4,0,27,0,29,0,112,0,248,0,3,0,0,0,1,3,80,0,3,15,42,23,156,15,42,
+0,1,0,0,0,55,0,3,0,0,0,1,3,84,0,3,15,20,23,134,15,20,0,1,0,0,0,55,0,3,0,0,
+0,1,3,36,0,2,23,112,14,254,0,1,0,0,0,55,0,3,0,0,0,1,3,42,0,2,23,92,14,234,
+0,1,0,0,0,55,0,3,0,0,0,1,2,252,0,3,14,214,2,166,14,214,0,1,0,0,0,55,0,3,0,
+0,0,1,3,0,0,3,14,192,2,144,14,192,0,1,0,0,0,55,0,3,0,0,0,1,2,208,0,2,2,122,
+14,170,0,1,0,0,0,55,0,3,0,0,0,1,2,214,0,2,2,102,14,150,0,1,0,0,0,55,0,3,0,
+0,0,1,2,168,0,3,14,130,0,84,14,130,0,1,0,0,0,55,0,3,0,0,0,1,2,172,0,3,14,
+108,0,62,14,108,0,1,0,0,0,55,0,3,0,0,0,1,2,124,0,2,0,40,14,86,0,1,0,0,0,55,
+0,3,0,0,0,1,2,130,0,2,0,20,14,66,0,1,0,0,0,55,0,1,0,1,0,38,0,3,0,0,0,1,2,
+78,0,3,14,40,0,84,14,40,0,1,0,0,0,55,0,3,0,0,0,1,2,82,0,3,14,18,0,62,14,18,
+0,1,0,0,0,55,0,3,0,0,0,1,2,34,0,2,0,40,13,252,0,1,0,0,0,55,0,3,0,0,0,1,2,
+40,0,2,0,20,13,232,0,1,0,0,0,55,0,1,0,1,0,37,0,3,0,0,0,1,1,244,0,4,13,206,
+1,208,13,206,13,206,0,1,0,0,0,55,0,3,0,0,0,1,1,246,0,4,13,182,1,184,13,182,
+13,182,0,1,0,0,0,55,0,3,0,0,0,1,1,196,0,3,1,160,13,158,13,158,0,1,0,0,0,55,
+0,3,0,0,0,1,1,200,0,3,1,138,13,136,13,136,0,1,0,0,0,55,0,3,0,0,0,1,1,152,
+0,3,13,114,1,116,13,114,0,1,0,0,0,55,0,3,0,0,0,1,1,156,0,3,13,92,1,94,13,
+92,0,1,0,0,0,55,0,3,0,0,0,1,1,108,0,2,1,72,13,70,0,1,0,0,0,55,0,3,0,0,0,1,
+1,114,0,2,1,52,13,50,0,1,0,0,0,55,0,3,0,0,0,1,1,68,0,3,13,30,0,84,13,30,0,
+1,0,0,0,55,0,3,0,0,0,1,1,72,0,3,13,8,0,62,13,8,0,1,0,0,0,55,0,3,0,0,0,1,1,
+24,0,2,0,40,12,242,0,1,0,0,0,55,0,3,0,0,0,1,1,30,0,2,0,20,12,222,0,1,0,0,
+0,55,0,1,0,1,0,79,0,3,0,0,0,1,0,234,0,3,12,196,0,84,12,196,0,1,0,0,0,55,0,
+3,0,0,0,1,0,238,0,3,12,174,0,62,12,174,0,1,0,0,0,55,0,3,0,0,0,1,0,190,0,2,
+0,40,12,152,0,1,0,0,0,55,0,3,0,0,0,1,0,196,0,2,0,20,12,132,0,1,0,0,0,55,0,
+1,0,1,0,78,0,6,2,1,0,4,0,14,0,36,0,64,0,86,0,3,0,0,0,1,0,130,0,3,17,10,0,
+44,17,10,0,1,0,0,0,55,0,3,0,0,0,1,0,134,0,3,16,244,0,22,16,244,0,1,0,0,0,
+55,0,1,0,1,0,50,0,3,0,0,0,1,0,80,0,3,16,216,0,44,16,216,0,1,0,0,0,55,0,3,
+0,0,0,1,0,84,0,3,16,194,0,22,16,194,0,1,0,0,0,55,0,1,0,1,0,54,0,6,2,1,0,2,
+0,10,0,36,0,3,0,0,0,1,0,20,0,2,16,156,20,96,0,1,0,0,0,55,0,1,0,1,1,35,0,3,
+0,0,0,1,0,20,0,2,16,130,20,70,0,1,0,0,0,55,0,1,0,1,1,36,0,6,0,9,0,2,0,10,
+0,28,0,3,0,0,0,1,4,18,0,1,0,36,0,1,0,0,0,56,0,3,0,0,0,1,4,26,0,1,0,18,0,1,
+0,0,0,56,0,1,0,1,0,254,0,6,0,1,0,24,0,54,0,80,0,106,0,132,0,158,0,184,0,210,
+0,234,1,2,1,26,1,50,1,74,1,98,1,122,1,146,1,168,1,236,2,2,2,24,2,46,2,156,
+2,178,2,200,2,220,0,3,0,0,0,1,3,178,0,5,1,136,1,136,2,186,2,92,2,14,0,1,0,
+0,0,56,0,3,0,0,0,1,3,178,0,5,1,110,1,110,2,160,2,66,1,244,0,1,0,0,0,56,0,
+3,0,0,0,1,3,126,0,5,1,84,1,84,2,134,1,218,2,40,0,1,0,0,0,56,0,3,0,0,0,1,3,
+126,0,5,1,58,1,58,2,108,1,192,2,14,0,1,0,0,0,56,0,3,0,0,0,1,3,74,0,5,1,32,
+1,32,2,82,15,150,2,116,0,1,0,0,0,56,0,3,0,0,0,1,3,74,0,5,1,6,1,6,2,56,15,
+124,2,90,0,1,0,0,0,56,0,3,0,0,0,1,3,22,0,4,0,236,0,236,2,30,2,64,0,1,0,0,
+0,56,0,3,0,0,0,1,3,24,0,4,0,212,0,212,2,6,2,40,0,1,0,0,0,56,0,3,0,0,0,1,2,
+230,0,4,0,188,1,238,1,144,1,66,0,1,0,0,0,56,0,3,0,0,0,1,2,232,0,4,0,164,1,
+214,1,120,1,42,0,1,0,0,0,56,0,3,0,0,0,1,2,182,0,4,0,140,1,190,1,18,1,96,0,
+1,0,0,0,56,0,3,0,0,0,1,2,184,0,4,0,116,1,166,0,250,1,72,0,1,0,0,0,56,0,3,
+0,0,0,1,2,134,0,4,0,92,1,142,14,210,1,176,0,1,0,0,0,56,0,3,0,0,0,1,2,136,
+0,4,0,68,1,118,14,186,1,152,0,1,0,0,0,56,0,3,0,0,0,1,2,86,0,3,0,44,1,94,1,
+128,0,1,0,0,0,56,0,3,0,0,0,1,2,90,0,3,0,22,1,72,1,106,0,1,0,0,0,56,0,2,0,
+7,0,13,0,13,0,0,0,140,0,141,0,1,0,143,0,156,0,3,0,159,0,170,0,17,0,172,0,
+173,0,29,0,175,0,204,0,31,1,37,1,38,0,61,0,3,0,0,0,1,1,252,0,3,1,4,0,166,
+0,88,0,1,0,0,0,56,0,3,0,0,0,1,2,0,0,3,0,238,0,144,0,66,0,1,0,0,0,56,0,3,0,
+0,0,1,1,208,0,3,0,216,0,44,0,122,0,1,0,0,0,56,0,3,0,0,0,1,1,212,0,3,0,194,
+0,22,0,100,0,1,0,0,0,56,0,1,0,37,0,13,0,140,0,143,0,145,0,146,0,150,0,153,
+0,155,0,156,0,159,0,161,0,163,0,165,0,166,0,169,0,179,0,180,0,182,0,183,0,
+185,0,186,0,187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,
+0,199,0,200,0,201,0,202,1,37,0,1,0,3,0,167,0,168,0,170,0,3,0,0,0,1,1,76,0,
+3,0,84,13,152,0,118,0,1,0,0,0,56,0,3,0,0,0,1,1,80,0,3,0,62,13,130,0,96,0,
+1,0,0,0,56,0,3,0,0,0,1,1,32,0,2,0,40,0,74,0,1,0,0,0,56,0,3,0,0,0,1,1,38,0,
+2,0,20,0,54,0,1,0,0,0,56,0,1,0,15,0,27,0,29,0,35,0,50,0,66,0,67,0,79,0,90,
+0,96,0,98,0,99,0,112,0,124,0,248,1,0,0,2,0,1,0,191,0,202,0,0,0,6,1,1,0,6,
+0,18,0,42,0,66,0,88,0,110,0,130,0,3,0,0,0,1,0,186,0,4,8,88,8,88,0,132,8,88,
+0,1,0,0,0,56,0,3,0,0,0,1,0,188,0,4,8,64,8,64,0,108,8,64,0,1,0,0,0,56,0,3,
+0,0,0,1,0,138,0,3,8,40,0,84,8,40,0,1,0,0,0,56,0,3,0,0,0,1,0,142,0,3,8,18,
+0,62,8,18,0,1,0,0,0,56,0,3,0,0,0,1,0,94,0,2,0,40,7,252,0,1,0,0,0,56,0,3,0,
+0,0,1,0,100,0,2,0,20,7,232,0,1,0,0,0,56,0,1,0,10,0,35,0,67,0,79,0,90,0,96,
+0,98,0,99,0,124,0,248,1,0,0,6,3,1,0,2,0,10,0,36,0,3,0,0,0,1,0,20,0,2,0,52,
+8,246,0,1,0,0,0,56,0,1,0,1,0,60,0,3,0,0,0,1,0,20,0,2,0,26,8,220,0,1,0,0,0,
+56,0,1,0,1,0,59,0,1,0,4,0,15,0,16,0,82,0,83,0,6,0,1,0,90,0,186,0,208,0,230,
+0,252,1,18,1,40,1,62,1,84,1,106,1,128,1,150,1,172,1,194,1,216,1,238,2,4,2,
+26,2,48,2,70,2,92,2,114,2,136,2,158,2,180,2,202,2,224,2,246,3,12,3,34,3,56,
+3,78,3,100,3,122,3,144,3,166,3,188,3,210,3,232,3,254,4,20,4,42,4,64,4,86,
+4,108,4,130,4,152,4,174,4,196,4,218,4,240,5,6,5,28,5,50,5,72,5,94,5,116,5,
+138,5,160,5,182,5,204,5,226,5,246,6,10,6,30,6,50,6,70,6,90,6,110,6,130,6,
+150,6,170,6,190,6,210,6,230,6,250,7,14,7,34,7,54,7,74,7,94,7,198,7,222,7,
+246,8,14,8,38,8,62,8,86,8,110,8,134,8,158,0,3,0,0,0,1,7,30,0,3,6,184,11,102,
+7,252,0,1,0,0,0,56,0,3,0,0,0,1,7,32,0,3,6,162,11,80,7,230,0,1,0,0,0,56,0,
+3,0,0,0,1,7,34,0,3,6,140,11,58,7,208,0,1,0,0,0,56,0,3,0,0,0,1,7,36,0,3,6,
+118,11,36,7,186,0,1,0,0,0,56,0,3,0,0,0,1,7,38,0,3,6,96,11,14,7,164,0,1,0,
+0,0,56,0,3,0,0,0,1,7,40,0,3,6,74,10,248,7,142,0,1,0,0,0,56,0,3,0,0,0,1,7,
+42,0,3,6,52,10,226,7,120,0,1,0,0,0,56,0,3,0,0,0,1,7,44,0,3,6,30,10,204,7,
+98,0,1,0,0,0,56,0,3,0,0,0,1,7,46,0,3,6,8,10,182,7,76,0,1,0,0,0,56,0,3,0,0,
+0,1,7,48,0,3,5,242,10,160,7,54,0,1,0,0,0,56,0,3,0,0,0,1,6,66,0,3,5,220,7,
+32,10,138,0,1,0,0,0,56,0,3,0,0,0,1,6,68,0,3,5,198,7,10,10,116,0,1,0,0,0,56,
+0,3,0,0,0,1,6,70,0,3,5,176,6,244,10,94,0,1,0,0,0,56,0,3,0,0,0,1,6,72,0,3,
+5,154,6,222,10,72,0,1,0,0,0,56,0,3,0,0,0,1,6,74,0,3,5,132,6,200,10,50,0,1,
+0,0,0,56,0,3,0,0,0,1,6,76,0,3,5,110,6,178,10,28,0,1,0,0,0,56,0,3,0,0,0,1,
+6,78,0,3,5,88,6,156,10,6,0,1,0,0,0,56,0,3,0,0,0,1,6,80,0,3,5,66,6,134,9,240,
+0,1,0,0,0,56,0,3,0,0,0,1,6,82,0,3,5,44,6,112,9,218,0,1,0,0,0,56,0,3,0,0,0,
+1,6,84,0,3,5,22,6,90,9,196,0,1,0,0,0,56,0,3,0,0,0,1,5,102,0,3,9,174,6,68,
+5,0,0,1,0,0,0,56,0,3,0,0,0,1,5,104,0,3,9,152,6,46,4,234,0,1,0,0,0,56,0,3,
+0,0,0,1,5,106,0,3,9,130,6,24,4,212,0,1,0,0,0,56,0,3,0,0,0,1,5,108,0,3,9,108,
+6,2,4,190,0,1,0,0,0,56,0,3,0,0,0,1,5,110,0,3,9,86,5,236,4,168,0,1,0,0,0,56,
+0,3,0,0,0,1,5,112,0,3,9,64,5,214,4,146,0,1,0,0,0,56,0,3,0,0,0,1,5,114,0,3,
+9,42,5,192,4,124,0,1,0,0,0,56,0,3,0,0,0,1,5,116,0,3,9,20,5,170,4,102,0,1,
+0,0,0,56,0,3,0,0,0,1,5,118,0,3,8,254,5,148,4,80,0,1,0,0,0,56,0,3,0,0,0,1,
+5,120,0,3,8,232,5,126,4,58,0,1,0,0,0,56,0,3,0,0,0,1,4,138,0,3,8,210,4,36,
+5,104,0,1,0,0,0,56,0,3,0,0,0,1,4,140,0,3,8,188,4,14,5,82,0,1,0,0,0,56,0,3,
+0,0,0,1,4,142,0,3,8,166,3,248,5,60,0,1,0,0,0,56,0,3,0,0,0,1,4,144,0,3,8,144,
+3,226,5,38,0,1,0,0,0,56,0,3,0,0,0,1,4,146,0,3,8,122,3,204,5,16,0,1,0,0,0,
+56,0,3,0,0,0,1,4,148,0,3,8,100,3,182,4,250,0,1,0,0,0,56,0,3,0,0,0,1,4,150,
+0,3,8,78,3,160,4,228,0,1,0,0,0,56,0,3,0,0,0,1,4,152,0,3,8,56,3,138,4,206,
+0,1,0,0,0,56,0,3,0,0,0,1,4,154,0,3,8,34,3,116,4,184,0,1,0,0,0,56,0,3,0,0,
+0,1,4,156,0,3,8,12,3,94,4,162,0,1,0,0,0,56,0,3,0,0,0,1,3,174,0,3,4,140,3,
+72,7,246,0,1,0,0,0,56,0,3,0,0,0,1,3,176,0,3,4,118,3,50,7,224,0,1,0,0,0,56,
+0,3,0,0,0,1,3,178,0,3,4,96,3,28,7,202,0,1,0,0,0,56,0,3,0,0,0,1,3,180,0,3,
+4,74,3,6,7,180,0,1,0,0,0,56,0,3,0,0,0,1,3,182,0,3,4,52,2,240,7,158,0,1,0,
+0,0,56,0,3,0,0,0,1,3,184,0,3,4,30,2,218,7,136,0,1,0,0,0,56,0,3,0,0,0,1,3,
+186,0,3,4,8,2,196,7,114,0,1,0,0,0,56,0,3,0,0,0,1,3,188,0,3,3,242,2,174,7,
+92,0,1,0,0,0,56,0,3,0,0,0,1,3,190,0,3,3,220,2,152,7,70,0,1,0,0,0,56,0,3,0,
+0,0,1,3,192,0,3,3,198,2,130,7,48,0,1,0,0,0,56,0,3,0,0,0,1,2,210,0,3,3,176,
+7,26,2,108,0,1,0,0,0,56,0,3,0,0,0,1,2,212,0,3,3,154,7,4,2,86,0,1,0,0,0,56,
+0,3,0,0,0,1,2,214,0,3,3,132,6,238,2,64,0,1,0,0,0,56,0,3,0,0,0,1,2,216,0,3,
+3,110,6,216,2,42,0,1,0,0,0,56,0,3,0,0,0,1,2,218,0,3,3,88,6,194,2,20,0,1,0,
+0,0,56,0,3,0,0,0,1,2,220,0,3,3,66,6,172,1,254,0,1,0,0,0,56,0,3,0,0,0,1,2,
+222,0,3,3,44,6,150,1,232,0,1,0,0,0,56,0,3,0,0,0,1,2,224,0,3,3,22,6,128,1,
+210,0,1,0,0,0,56,0,3,0,0,0,1,2,226,0,3,3,0,6,106,1,188,0,1,0,0,0,56,0,3,0,
+0,0,1,2,228,0,3,2,234,6,84,1,166,0,1,0,0,0,56,0,3,0,0,0,1,1,246,0,2,2,212,
+1,144,0,1,0,0,0,56,0,3,0,0,0,1,1,250,0,2,2,192,1,124,0,1,0,0,0,56,0,3,0,0,
+0,1,1,254,0,2,2,172,1,104,0,1,0,0,0,56,0,3,0,0,0,1,2,2,0,2,2,152,1,84,0,1,
+0,0,0,56,0,3,0,0,0,1,2,6,0,2,2,132,1,64,0,1,0,0,0,56,0,3,0,0,0,1,2,10,0,2,
+2,112,1,44,0,1,0,0,0,56,0,3,0,0,0,1,2,14,0,2,2,92,1,24,0,1,0,0,0,56,0,3,0,
+0,0,1,2,18,0,2,2,72,1,4,0,1,0,0,0,56,0,3,0,0,0,1,2,22,0,2,2,52,0,240,0,1,
+0,0,0,56,0,3,0,0,0,1,2,26,0,2,2,32,0,220,0,1,0,0,0,56,0,3,0,0,0,1,1,46,0,
+2,0,200,2,12,0,1,0,0,0,56,0,3,0,0,0,1,1,50,0,2,0,180,1,248,0,1,0,0,0,56,0,
+3,0,0,0,1,1,54,0,2,0,160,1,228,0,1,0,0,0,56,0,3,0,0,0,1,1,58,0,2,0,140,1,
+208,0,1,0,0,0,56,0,3,0,0,0,1,1,62,0,2,0,120,1,188,0,1,0,0,0,56,0,3,0,0,0,
+1,1,66,0,2,0,100,1,168,0,1,0,0,0,56,0,3,0,0,0,1,1,70,0,2,0,80,1,148,0,1,0,
+0,0,56,0,3,0,0,0,1,1,74,0,2,0,60,1,128,0,1,0,0,0,56,0,3,0,0,0,1,1,78,0,2,
+0,40,1,108,0,1,0,0,0,56,0,3,0,0,0,1,1,82,0,2,0,20,1,88,0,1,0,0,0,56,0,1,0,
+40,0,13,0,140,0,143,0,145,0,146,0,150,0,153,0,155,0,156,0,159,0,161,0,163,
+0,165,0,166,0,167,0,168,0,169,0,170,0,179,0,180,0,182,0,183,0,185,0,186,0,
+187,0,188,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,
+0,201,0,202,1,37,0,3,0,0,0,1,0,18,0,1,0,240,0,1,0,0,0,56,0,1,0,1,0,26,0,3,
+0,0,0,1,0,18,0,1,0,216,0,1,0,0,0,56,0,1,0,1,0,27,0,3,0,0,0,1,0,18,0,1,0,192,
+0,1,0,0,0,56,0,1,0,1,0,28,0,3,0,0,0,1,0,18,0,1,0,168,0,1,0,0,0,56,0,1,0,1,
+0,29,0,3,0,0,0,1,0,18,0,1,0,144,0,1,0,0,0,56,0,1,0,1,0,95,0,3,0,0,0,1,0,18,
+0,1,0,120,0,1,0,0,0,56,0,1,0,1,0,96,0,3,0,0,0,1,0,18,0,1,0,96,0,1,0,0,0,56,
+0,1,0,1,0,111,0,3,0,0,0,1,0,18,0,1,0,72,0,1,0,0,0,56,0,1,0,1,0,112,0,3,0,
+0,0,1,0,18,0,1,0,48,0,1,0,0,0,56,0,1,0,1,0,247,0,3,0,0,0,1,0,18,0,1,0,24,
+0,1,0,0,0,56,0,1,0,1,0,248,0,1,0,2,0,157,0,171,0,6,2,1,0,12,0,30,0,52,0,74,
+0,96,0,118,0,140,0,162,0,182,0,202,0,222,0,242,1,6,0,3,0,3,3,68,3,68,0,252,
+0,1,1,202,0,0,0,1,0,0,0,56,0,3,0,3,3,46,3,46,0,230,0,1,1,206,0,0,0,1,0,0,
+0,56,0,3,0,3,3,24,3,24,0,208,0,1,1,210,0,0,0,1,0,0,0,56,0,3,0,3,3,2,3,2,0,
+186,0,1,1,214,0,0,0,1,0,0,0,56,0,3,0,3,2,236,2,236,0,164,0,1,1,218,0,0,0,
+1,0,0,0,56,0,3,0,3,2,214,2,214,0,142,0,1,2,6,0,0,0,1,0,0,0,56,0,3,0,2,2,192,
+0,120,0,1,1,70,0,0,0,1,0,0,0,56,0,3,0,2,2,172,0,100,0,1,1,76,0,0,0,1,0,0,
+0,56,0,3,0,2,2,152,0,80,0,1,1,82,0,0,0,1,0,0,0,56,0,3,0,2,2,132,0,60,0,1,
+1,88,0,0,0,1,0,0,0,56,0,3,0,2,2,112,0,40,0,1,1,94,0,0,0,1,0,0,0,57,0,3,0,
+2,2,92,0,20,0,1,1,140,0,0,0,1,0,0,0,57,0,1,0,10,0,38,0,39,0,87,0,88,0,93,
+0,94,0,105,0,106,0,117,0,118,0,6,2,1,0,12,0,30,0,52,0,74,0,96,0,118,0,140,
+0,162,0,188,0,214,0,240,1,10,1,36,0,3,0,3,2,18,2,18,1,26,0,1,0,152,0,0,0,
+1,0,0,0,57,0,3,0,3,1,252,1,252,1,4,0,1,0,156,0,0,0,1,0,0,0,57,0,3,0,3,1,230,
+1,230,0,238,0,1,0,160,0,0,0,1,0,0,0,57,0,3,0,3,1,208,1,208,0,216,0,1,0,164,
+0,0,0,1,0,0,0,57,0,3,0,3,1,186,1,186,0,194,0,1,0,168,0,0,0,1,0,0,0,58,0,3,
+0,3,1,164,1,164,0,172,0,1,0,212,0,0,0,1,0,0,0,58,0,3,0,2,1,142,0,150,0,1,
+0,20,0,0,0,1,0,0,0,58,0,1,0,1,0,19,0,3,0,2,1,116,0,124,0,1,0,20,0,0,0,1,0,
+0,0,58,0,1,0,1,0,20,0,3,0,2,1,90,0,98,0,1,0,20,0,0,0,1,0,0,0,58,0,1,0,1,0,
+23,0,3,0,2,1,64,0,72,0,1,0,20,0,0,0,1,0,0,0,58,0,1,0,1,0,24,0,3,0,2,1,38,
+0,46,0,1,0,20,0,0,0,1,0,0,0,58,0,1,0,1,0,108,0,3,0,2,1,12,0,20,0,1,0,60,0,
+0,0,1,0,0,0,58,0,1,0,18,0,16,0,17,0,50,0,51,0,55,0,56,0,59,0,60,0,67,0,68,
+0,79,0,80,0,83,0,84,0,99,0,100,0,121,0,122,0,1,0,1,0,109,0,6,2,1,0,6,0,18,
+0,42,0,66,0,88,0,110,0,136,0,3,0,0,0,1,0,112,0,4,0,184,0,184,0,144,0,184,
+0,1,0,0,0,58,0,3,0,0,0,1,0,114,0,4,0,160,0,160,0,120,0,160,0,1,0,0,0,58,0,
+3,0,0,0,1,0,64,0,3,0,136,0,96,0,136,0,1,0,0,0,58,0,3,0,0,0,1,0,68,0,3,0,114,
+0,74,0,114,0,1,0,0,0,58,0,3,0,0,0,1,0,20,0,2,0,52,0,92,0,1,0,0,0,58,0,1,0,
+1,0,89,0,3,0,0,0,1,0,20,0,2,0,26,0,66,0,1,0,0,0,58,0,1,0,1,0,90,0,1,0,18,
+0,8,0,9,0,10,0,28,0,34,0,51,0,53,0,61,0,65,0,68,0,95,0,101,0,111,0,123,1,
+7,1,9,1,11,1,13,0,1,0,21,0,141,0,144,0,147,0,148,0,149,0,151,0,152,0,154,
+0,160,0,162,0,164,0,172,0,173,0,175,0,176,0,177,0,178,0,181,0,184,0,189,1,
+38,0,6,5,1,0,1,0,8,0,3,0,1,0,108,0,1,0,60,0,0,0,1,0,0,0,11,0,6,5,1,0,1,0,
+8,0,3,0,1,0,18,0,1,0,34,0,0,0,1,0,0,0,12,0,2,0,2,1,48,1,50,0,0,1,53,1,56,
+0,3,0,2,0,3,0,8,0,12,0,0,0,14,0,124,0,5,0,247,1,30,0,116,0,6,5,1,0,1,0,8,
+0,3,0,0,0,1,0,18,0,1,0,108,0,1,0,0,0,58,0,1,0,1,0,139,0,6,5,1,0,3,0,12,0,
+36,0,60,0,3,0,0,0,1,0,18,0,1,0,72,0,1,0,0,0,58,0,1,0,1,1,53,0,3,0,0,0,1,0,
+18,0,1,0,48,0,1,0,0,0,58,0,1,0,1,1,54,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,
+58,0,1,0,1,1,55,0,1,0,4,1,46,1,47,1,51,1,52,0,1,0,0,0,1,0,8,0,1,0,6,0,4,0,
+1,0,2,0,69,0,70,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,171,0,174,0,1,0,2,0,157,0,
+158,0,1,0,0,0,1,0,8,0,1,0,6,0,6,0,1,0,2,0,225,0,226,0,1,0,0,0,1,0,8,0,2,0,
+18,0,6,0,73,0,74,0,171,0,174,0,231,0,232,0,1,0,6,0,69,0,70,0,157,0,158,0,
+225,0,226,0,4,0,1,0,1,0,8,0,1,1,18,0,11,0,28,0,46,0,64,0,82,0,100,0,118,0,
+136,0,194,0,204,0,246,1,8,0,2,0,6,0,12,0,193,0,2,0,185,0,198,0,2,0,188,0,
+2,0,6,0,12,0,191,0,2,0,185,0,200,0,2,0,188,0,2,0,6,0,12,0,192,0,2,0,185,0,
+204,0,2,0,189,0,2,0,6,0,12,0,194,0,2,0,185,0,199,0,2,0,188,0,2,0,6,0,12,0,
+195,0,2,0,185,0,201,0,2,0,188,0,2,0,6,0,12,0,196,0,2,0,185,0,203,0,2,0,189,
+0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,0,193,0,2,0,179,0,191,0,2,0,180,0,
+192,0,2,0,181,0,194,0,2,0,182,0,195,0,2,0,183,0,196,0,2,0,184,0,197,0,2,0,
+190,0,1,0,4,0,202,0,2,0,188,0,5,0,12,0,18,0,24,0,30,0,36,0,198,0,2,0,179,
+0,200,0,2,0,180,0,199,0,2,0,182,0,201,0,2,0,183,0,202,0,2,0,186,0,2,0,6,0,
+12,0,204,0,2,0,181,0,203,0,2,0,184,0,1,0,4,0,197,0,2,0,185,0,2,0,2,0,179,
+0,186,0,0,0,188,0,190,0,8,0,1,0,9,0,1,0,8,0,2,0,32,0,13,1,19,1,20,1,21,1,
+22,1,3,1,4,1,5,1,6,1,1,1,2,1,32,1,23,1,24,0,1,0,13,0,19,0,20,0,23,0,24,0,
+42,0,43,0,46,0,47,0,59,0,60,0,66,0,108,0,109,0,1,0,9,0,1,0,8,0,2,0,24,0,9,
+0,249,0,250,0,254,0,253,1,31,1,0,0,255,0,251,0,252,0,1,0,9,0,11,0,12,0,59,
+0,60,0,66,0,67,0,68,0,249,0,250,0,1,0,9,0,1,0,8,0,2,0,22,0,8,1,35,1,36,1,
+33,1,34,0,67,0,68,0,59,0,60,0,1,0,8,0,59,0,60,0,67,0,68,1,33,1,34,1,35,1,
+36,0,1,0,9,0,1,0,8,0,2,0,42,0,18,1,19,1,20,1,21,1,22,1,7,1,8,1,9,1,10,1,1,
+1,2,1,11,1,12,1,21,1,22,1,13,1,14,1,15,1,16,0,1,0,18,0,19,0,20,0,23,0,24,
+0,26,0,27,0,28,0,29,0,59,0,60,0,95,0,96,0,108,0,109,0,111,0,112,0,247,0,248,
+0,1,2,1,0,1,0,8,0,2,0,18,0,6,1,25,1,26,1,27,1,28,1,23,1,24,0,1,0,6,0,19,0,
+20,0,23,0,24,0,108,0,109,0,1,2,1,0,1,0,8,0,2,0,30,0,12,1,25,1,26,1,27,1,28,
+1,17,1,18,1,29,1,30,1,45,1,48,1,49,1,50,0,1,0,12,0,19,0,20,0,23,0,24,0,89,
+0,90,0,108,0,109,0,139,1,53,1,54,1,55,0,0,};
+#endif
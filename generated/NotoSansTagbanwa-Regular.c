@@ -0,0 +1,239 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansTagbanwa_Regular_ttf_size = 5608;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansTagbanwa_Regular_ttf");
+asm(".type fz_font_NotoSansTagbanwa_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansTagbanwa_Regular_ttf, 5608");
+asm(".balign 64");
+asm("fz_font_NotoSansTagbanwa_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansTagbanwa-Regular.ttf\"");
+#else
+const int fz_font_NotoSansTagbanwa_Regular_ttf_size = 5608;
+const char fz_font_NotoSansTagbanwa_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,94,0,73,0,0,20,128,0,0,0,42,71,
+80,79,83,240,193,25,84,0,0,20,172,0,0,1,26,71,83,85,66,68,116,76,117,0,0,
+21,200,0,0,0,30,79,83,47,50,122,231,107,118,0,0,1,104,0,0,0,96,99,109,97,
+112,47,216,46,103,0,0,2,40,0,0,0,108,103,97,115,112,0,7,0,7,0,0,20,116,0,
+0,0,12,103,108,121,102,92,134,198,127,0,0,2,200,0,0,11,128,104,101,97,100,
+4,130,28,61,0,0,0,236,0,0,0,54,104,104,101,97,14,197,6,7,0,0,1,36,0,0,0,36,
+104,109,116,120,125,247,4,108,0,0,1,200,0,0,0,96,108,111,99,97,35,4,32,18,
+0,0,2,148,0,0,0,50,109,97,120,112,0,27,0,110,0,0,1,72,0,0,0,32,110,97,109,
+101,142,0,185,180,0,0,14,72,0,0,6,12,112,111,115,116,255,105,0,102,0,0,20,
+84,0,0,0,32,0,1,0,0,0,1,10,61,106,251,39,32,95,15,60,245,0,11,8,0,0,0,0,0,
+204,191,213,241,0,0,0,0,210,109,241,214,254,47,254,182,8,6,6,133,0,0,0,9,
+0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,8,109,254,47,255,217,8,6,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,1,0,0,0,24,0,109,0,2,0,0,0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,255,1,144,0,5,0,0,5,154,5,51,0,0,1,31,5,154,
+5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,0,0,16,0,
+0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,0,0,0,
+1,0,0,0,0,4,0,5,154,0,0,0,32,0,1,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,0,6,
+113,0,47,7,88,0,109,3,35,0,164,5,8,0,59,6,96,0,102,7,143,0,104,8,31,0,166,
+6,113,0,74,6,96,0,102,7,88,0,106,6,211,0,102,7,88,0,129,7,135,0,129,7,129,
+0,109,6,172,0,160,8,109,0,133,0,0,254,47,0,0,254,47,2,162,0,37,3,231,0,37,
+0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,96,0,0,0,20,0,16,0,3,0,4,0,0,0,13,0,32,0,160,
+23,54,23,108,23,112,23,115,254,255,255,255,0,0,0,0,0,13,0,32,0,160,23,53,
+23,96,23,110,23,114,254,255,255,255,0,1,255,245,255,227,255,99,232,225,232,
+164,232,163,232,162,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+21,0,21,0,21,0,21,0,108,0,194,1,30,1,73,1,186,1,238,2,109,2,189,2,219,3,41,
+3,96,3,179,4,5,4,141,4,208,5,97,5,126,5,154,5,169,5,192,0,0,0,2,0,193,0,0,
+4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,
+253,135,5,182,250,74,104,4,230,0,0,1,0,47,255,14,6,152,5,18,0,61,0,0,37,20,
+51,50,54,55,55,54,55,62,2,51,50,21,35,52,38,35,34,6,7,6,7,7,6,6,35,34,39,
+6,6,21,20,23,7,38,53,52,55,39,53,52,55,54,53,52,38,35,34,6,7,39,54,54,51,
+50,21,20,7,6,6,1,246,39,62,170,137,77,82,139,87,82,80,54,177,140,16,25,31,
+80,137,62,85,87,154,226,104,77,48,29,49,78,33,193,158,2,44,65,11,20,43,117,
+141,76,98,228,100,143,57,21,36,205,60,176,207,115,121,237,149,101,47,204,
+32,33,109,244,109,130,132,236,199,35,17,44,31,40,7,138,44,145,121,84,16,16,
+83,157,236,18,12,15,43,78,110,71,85,117,76,188,72,160,0,2,0,109,0,0,7,29,
+5,190,0,7,0,55,0,0,1,54,54,55,23,6,6,7,1,20,51,50,54,19,54,36,51,51,50,23,
+7,38,35,34,6,6,7,14,2,35,34,38,53,52,19,55,55,54,53,52,38,35,34,7,7,39,54,
+54,51,50,21,20,6,7,2,4,164,69,224,141,16,102,189,71,252,250,63,132,250,186,
+132,1,17,156,24,19,84,25,46,48,76,140,146,132,135,199,210,123,89,110,91,34,
+16,31,11,20,75,141,81,77,101,227,98,143,37,43,96,5,31,61,85,13,139,12,71,
+54,252,55,80,239,1,62,223,222,12,138,11,86,171,210,217,217,107,100,84,128,
+1,21,111,58,109,14,12,14,80,45,111,73,83,117,46,149,139,254,200,0,0,1,0,164,
+255,133,2,127,5,137,0,62,0,0,19,22,23,22,22,21,20,7,7,6,6,21,20,23,23,22,
+22,21,20,7,7,6,21,20,23,23,22,22,21,20,7,7,39,55,54,54,53,52,39,39,38,53,
+52,55,55,54,53,52,39,39,38,53,52,55,55,54,54,53,52,39,38,39,39,217,214,116,
+35,53,72,186,11,12,33,176,45,31,92,157,50,22,130,51,59,70,194,109,164,11,
+30,49,125,94,104,156,27,52,165,58,78,162,9,22,27,33,87,138,5,137,59,60,13,
+68,37,83,42,101,6,9,9,12,18,116,30,51,31,81,46,77,21,17,13,14,65,26,68,51,
+70,68,178,103,143,11,31,15,21,28,66,47,82,91,52,76,12,17,16,31,106,35,68,
+73,46,90,6,15,11,15,10,15,29,46,0,1,0,59,0,16,4,213,5,23,0,19,0,0,37,36,1,
+2,3,39,18,19,38,39,55,22,23,54,37,23,4,7,4,5,4,156,254,162,254,227,220,106,
+151,122,242,188,185,119,171,173,188,1,11,110,254,249,189,1,18,1,72,215,158,
+1,0,254,213,254,198,58,1,77,1,70,186,246,90,238,169,229,226,117,217,228,242,
+153,0,1,0,102,0,2,5,250,5,100,0,76,0,0,19,36,33,32,5,7,38,37,22,21,20,7,6,
+6,21,20,23,23,22,21,20,7,7,6,21,20,23,23,22,21,20,6,7,7,6,21,20,23,23,35,
+38,38,53,52,55,55,54,53,52,39,39,38,38,53,52,55,55,54,53,52,46,2,39,39,38,
+53,52,54,55,55,54,53,52,39,4,5,102,1,71,1,134,1,130,1,69,92,245,254,249,28,
+36,77,18,37,78,68,45,109,22,34,76,68,39,41,76,35,7,32,155,19,16,65,76,25,
+45,62,39,31,72,86,21,13,18,17,4,61,66,24,17,60,31,27,254,211,254,244,4,106,
+250,250,114,184,33,26,36,40,33,73,23,13,17,21,50,41,69,63,40,90,19,18,14,
+23,51,46,58,49,59,28,49,21,28,12,20,101,64,71,31,62,42,47,18,15,22,27,37,
+26,53,32,67,60,74,17,19,7,16,13,11,3,36,41,68,28,53,17,58,27,24,22,27,21,
+200,0,0,1,0,104,0,158,7,37,4,14,0,29,0,0,19,1,33,50,55,54,54,51,50,22,21,
+20,7,39,54,53,52,38,35,34,7,7,6,6,35,33,1,39,1,1,205,1,129,1,168,103,106,
+112,131,74,133,156,215,84,151,83,68,57,78,45,110,155,79,254,88,254,135,101,
+1,91,254,165,4,14,254,138,73,76,61,159,131,204,126,113,81,144,68,75,53,31,
+75,52,254,146,104,1,80,1,80,0,0,1,0,166,255,121,7,184,5,188,0,88,0,0,1,20,
+7,7,6,21,20,22,23,54,36,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,4,7,23,
+20,7,7,6,6,21,20,23,23,22,21,20,7,7,39,55,54,53,53,38,39,39,38,53,52,54,55,
+55,54,53,52,39,39,38,53,52,55,55,54,53,52,46,2,39,39,38,53,52,55,55,23,7,
+6,21,20,23,23,22,22,2,123,88,170,23,18,132,216,2,159,215,168,202,244,212,
+13,155,167,106,111,205,253,198,200,2,92,129,50,28,22,115,125,86,192,103,164,
+39,4,39,105,110,65,56,139,27,52,143,80,101,139,31,9,13,13,4,111,129,84,180,
+101,148,39,43,135,48,61,3,225,85,36,69,10,11,5,12,69,59,93,140,118,132,172,
+18,140,12,91,73,51,65,73,49,23,91,30,41,17,19,9,16,6,37,38,106,84,61,135,
+123,106,26,21,2,24,11,35,34,99,51,74,18,48,7,17,14,25,72,41,69,83,38,58,16,
+12,4,9,7,5,2,35,40,105,79,62,131,122,99,24,21,24,15,45,15,66,0,1,0,74,0,0,
+6,106,5,207,0,51,0,0,1,52,38,35,34,6,7,39,54,54,51,50,23,54,0,37,21,6,0,7,
+7,6,6,21,20,51,50,54,54,55,54,36,51,50,23,7,38,35,34,6,6,7,6,6,35,34,38,53,
+52,54,55,54,1,225,10,20,44,117,138,78,94,233,103,60,36,163,1,177,1,6,248,
+254,95,160,21,65,37,63,66,110,138,92,132,1,17,156,33,69,4,48,42,81,135,137,
+140,146,218,142,86,111,34,48,47,3,27,12,14,42,77,109,68,82,23,229,1,22,42,
+141,44,254,201,250,82,219,176,37,80,83,184,155,223,222,8,142,10,76,162,228,
+236,172,102,88,61,183,174,165,0,1,0,102,0,0,5,250,5,18,0,12,0,0,19,36,33,
+32,5,7,36,37,17,35,17,4,5,102,1,69,1,136,1,131,1,68,92,254,248,254,231,158,
+254,231,254,253,4,25,249,249,115,197,24,251,125,4,131,28,193,0,0,1,0,106,
+0,0,7,20,4,246,0,49,0,0,37,20,22,51,50,54,54,19,18,36,51,51,50,23,7,38,35,
+34,6,7,1,7,1,7,2,2,35,34,38,53,52,19,55,54,53,52,38,35,34,7,7,39,54,54,51,
+50,21,20,3,6,2,2,47,35,60,121,135,118,120,1,50,230,24,32,70,24,48,46,178,
+212,104,1,164,100,254,127,11,151,244,139,105,129,99,16,45,11,20,80,138,81,
+80,95,233,105,143,89,79,231,38,54,118,236,1,9,1,13,243,13,137,10,156,204,
+254,127,109,1,99,23,254,170,254,246,121,94,130,1,54,52,158,26,12,15,75,44,
+110,68,80,117,93,254,240,241,0,2,0,102,255,254,6,109,4,209,0,15,0,31,0,0,
+5,34,36,38,53,52,18,36,51,50,4,22,21,20,2,4,39,50,36,18,53,52,38,38,35,34,
+4,2,21,20,22,22,2,254,179,254,199,172,236,1,143,236,185,1,54,177,242,254,
+108,233,193,1,76,196,133,236,145,196,254,180,185,134,235,2,141,243,153,189,
+1,72,181,135,244,152,177,254,179,194,139,155,1,12,140,115,181,98,150,254,
+253,150,116,180,102,0,0,2,0,129,0,0,7,41,4,199,0,40,0,54,0,0,33,34,38,53,
+52,55,54,54,53,52,38,35,34,6,7,39,54,54,51,50,21,20,7,51,32,23,54,54,51,51,
+50,23,7,38,35,34,6,6,7,2,0,39,50,0,19,55,38,35,35,7,7,2,21,20,22,2,66,93,
+127,68,75,31,10,20,42,106,147,78,89,234,107,143,8,60,1,16,191,123,240,132,
+23,30,68,23,48,42,81,137,138,139,163,254,200,148,109,1,18,150,10,153,238,
+46,49,43,100,43,121,94,151,210,229,130,28,12,14,38,81,111,64,83,116,17,59,
+92,196,183,13,137,10,88,180,248,254,222,254,235,139,1,37,1,14,21,74,2,145,
+254,204,111,38,54,0,1,0,129,0,0,7,137,5,18,0,53,0,0,1,50,22,22,21,20,6,6,
+35,53,50,54,53,52,38,35,34,6,3,2,0,35,34,38,53,52,55,54,54,53,52,38,35,34,
+6,7,39,54,54,51,50,21,20,3,2,21,20,22,51,50,18,19,18,0,6,72,100,145,76,110,
+198,122,125,158,94,72,128,218,109,143,254,235,149,103,131,68,75,31,10,20,
+42,106,147,78,89,234,107,143,86,100,47,35,96,228,120,105,1,38,5,18,78,134,
+80,101,172,98,139,126,99,66,94,244,254,250,254,171,254,200,119,96,151,210,
+229,130,28,12,14,38,81,111,64,83,116,95,254,245,254,204,111,38,54,1,60,1,
+41,1,7,1,27,0,0,1,0,109,0,0,7,72,4,227,0,104,0,0,1,50,23,7,38,35,34,6,7,54,
+51,50,22,21,21,20,22,51,50,54,51,50,22,21,21,20,22,51,50,54,51,50,21,21,20,
+51,51,21,35,34,38,53,53,52,38,35,34,6,35,34,38,53,53,52,38,35,34,6,35,34,
+38,53,53,52,35,34,7,21,2,2,35,34,38,53,52,19,55,54,53,52,38,35,34,7,7,39,
+54,54,51,50,21,20,3,6,21,20,22,51,50,54,54,19,62,2,6,113,119,96,25,93,79,
+167,202,92,34,26,39,45,5,17,17,35,20,41,43,4,14,14,37,25,82,39,49,72,72,65,
+6,12,8,20,28,52,52,2,12,11,29,28,51,43,29,26,29,161,250,144,105,129,99,16,
+45,11,20,80,138,81,77,94,233,103,143,89,79,47,35,59,120,136,117,88,166,217,
+4,227,24,137,22,136,183,12,56,51,55,17,24,12,55,49,57,16,21,12,111,53,41,
+125,81,63,20,13,14,8,73,54,32,19,22,10,59,93,16,37,19,2,254,142,254,227,121,
+94,134,1,54,52,158,22,12,15,75,44,108,68,82,117,93,254,240,241,103,38,54,
+118,238,1,7,199,200,94,0,1,0,160,0,0,6,70,5,18,0,41,0,0,1,38,38,35,34,4,0,
+2,21,20,51,50,37,54,54,51,50,22,21,20,6,7,35,54,54,53,52,35,34,5,4,35,34,
+38,53,52,18,0,36,51,32,19,5,190,36,128,94,141,254,210,254,231,171,56,111,
+1,34,195,233,96,145,163,24,11,156,17,26,147,149,254,179,254,204,148,103,110,
+182,1,56,1,107,173,1,51,105,3,209,95,87,164,254,203,254,163,124,68,127,87,
+65,138,114,57,81,34,45,83,40,117,148,137,112,101,153,1,129,1,94,197,254,244,
+0,1,0,133,0,0,8,6,4,186,0,108,0,0,37,52,54,54,55,54,53,52,38,35,34,6,7,39,
+54,54,51,50,21,20,3,2,21,20,22,51,50,54,54,19,54,54,51,50,22,21,20,7,6,21,
+20,51,50,54,55,54,51,50,22,21,20,7,6,6,21,20,51,50,55,54,51,50,21,20,7,39,
+54,53,52,35,34,7,6,35,34,38,53,52,54,55,54,54,53,52,35,34,7,6,6,35,34,38,
+53,52,55,54,54,53,52,35,34,6,7,14,2,35,34,38,1,104,15,28,64,65,10,20,65,147,
+81,76,91,231,106,144,87,100,47,35,59,116,133,126,114,213,120,78,96,109,153,
+22,21,119,63,78,67,65,68,75,42,36,12,12,37,57,50,143,41,133,31,10,22,38,54,
+48,62,73,40,54,21,36,14,18,72,92,108,50,74,80,185,35,42,41,71,167,102,111,
+160,167,96,103,131,215,55,110,115,199,197,63,13,14,66,45,111,65,82,116,92,
+254,242,254,204,111,38,54,112,225,1,18,248,212,93,68,114,134,194,68,23,51,
+39,47,64,52,73,77,44,42,12,13,17,22,133,62,63,64,43,16,8,18,23,64,57,38,80,
+56,23,30,11,12,43,56,44,75,66,146,229,43,79,21,37,240,223,246,241,121,119,
+0,0,1,254,47,4,215,255,96,6,133,0,14,0,0,1,23,22,21,20,6,7,7,39,55,54,53,
+52,39,39,254,119,88,145,68,77,109,51,113,45,43,94,6,133,31,48,132,65,87,28,
+39,131,39,15,32,32,17,33,0,0,1,254,47,254,182,255,96,0,98,0,14,0,0,37,23,
+22,21,20,6,7,7,39,55,54,53,52,39,39,254,119,88,145,68,77,109,51,113,45,43,
+94,98,30,50,120,69,92,28,39,131,39,15,32,33,17,32,0,1,0,37,254,227,2,86,6,
+0,0,3,0,0,19,1,51,1,37,1,162,143,254,92,254,227,7,29,248,227,0,2,0,37,254,
+227,3,156,6,0,0,3,0,7,0,0,19,1,51,1,51,1,51,1,37,1,162,143,254,92,185,1,162,
+143,254,92,254,227,7,29,248,227,7,29,248,227,0,0,0,15,0,186,0,3,0,1,4,9,0,
+0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,
+9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,
+0,1,4,9,0,6,0,32,0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,1,92,
+0,3,0,1,4,9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,0,96,1,174,0,3,0,1,4,9,0,11,0,
+62,2,14,0,3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,4,9,0,13,2,150,2,136,0,3,0,1,4,
+9,0,14,0,52,5,30,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,
+0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,97,0,103,0,98,0,97,0,110,0,119,
+0,97,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,
+0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,97,0,103,
+0,98,0,97,0,110,0,119,0,97,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,
+0,115,0,84,0,97,0,103,0,98,0,97,0,110,0,119,0,97,0,78,0,111,0,116,0,111,0,
+32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,
+0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,0,0,255,102,
+0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,
+0,1,0,0,0,12,0,0,0,34,0,0,0,2,0,3,0,0,0,19,0,1,0,20,0,21,0,3,0,22,0,23,0,
+1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,30,0,44,0,1,68,70,76,84,0,8,0,4,0,0,
+0,0,255,255,0,1,0,0,0,1,109,97,114,107,0,8,0,0,0,1,0,0,0,1,0,4,0,4,0,0,0,
+1,0,8,0,1,0,12,0,20,0,2,0,30,0,52,0,1,0,2,0,20,0,21,0,2,0,1,0,7,0,19,0,0,
+0,2,0,0,0,10,0,1,0,16,0,1,254,182,4,206,0,1,254,77,0,100,0,13,0,54,0,60,0,
+66,0,72,0,78,0,144,0,84,0,144,0,90,0,132,0,96,0,102,0,108,0,132,0,114,0,120,
+0,126,0,132,0,162,0,138,0,162,0,144,0,150,0,156,0,162,0,168,0,1,2,88,5,20,
+0,1,3,132,0,0,0,1,3,132,5,220,0,1,4,36,0,0,0,1,3,212,3,132,0,1,4,196,3,232,
+0,1,4,46,6,24,0,1,3,132,5,180,0,1,4,16,0,0,0,1,3,242,4,156,0,1,3,212,5,120,
+0,1,4,176,0,0,0,1,4,56,4,156,0,1,4,116,0,0,0,1,4,136,0,0,0,1,5,0,0,0,0,1,
+4,76,5,120,0,1,4,76,0,0,0,1,3,212,4,156,0,1,6,4,0,0,0,0,0,1,0,0,0,10,0,28,
+0,28,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,0,0,0,0,0,};
+#endif
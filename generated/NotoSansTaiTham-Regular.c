@@ -0,0 +1,2103 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansTaiTham_Regular_ttf_size = 51040;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansTaiTham_Regular_ttf");
+asm(".type fz_font_NotoSansTaiTham_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansTaiTham_Regular_ttf, 51040");
+asm(".balign 64");
+asm("fz_font_NotoSansTaiTham_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansTaiTham-Regular.ttf\"");
+#else
+const int fz_font_NotoSansTaiTham_Regular_ttf_size = 51040;
+const char fz_font_NotoSansTaiTham_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,4,64,4,152,0,0,165,208,0,0,0,96,71,
+80,79,83,17,226,239,124,0,0,166,48,0,0,30,80,71,83,85,66,228,162,2,243,0,
+0,196,128,0,0,2,224,79,83,47,50,124,119,104,234,0,0,1,104,0,0,0,96,99,109,
+97,112,125,41,115,54,0,0,5,104,0,0,0,140,103,97,115,112,0,7,0,7,0,0,165,196,
+0,0,0,12,103,108,121,102,166,92,218,17,0,0,7,200,0,0,141,42,104,101,97,100,
+4,80,13,187,0,0,0,236,0,0,0,54,104,104,101,97,14,5,4,79,0,0,1,36,0,0,0,36,
+104,109,116,120,13,53,52,6,0,0,1,200,0,0,3,160,108,111,99,97,105,233,71,253,
+0,0,5,244,0,0,1,210,109,97,120,112,1,21,1,58,0,0,1,72,0,0,0,32,110,97,109,
+101,141,161,184,202,0,0,148,244,0,0,6,10,112,111,115,116,195,83,252,191,0,
+0,155,0,0,0,10,196,0,1,0,0,0,1,10,61,123,182,165,50,95,15,60,245,0,11,8,0,
+0,0,0,0,205,19,48,171,0,0,0,0,210,168,137,133,250,150,252,24,10,223,8,56,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,252,24,0,0,10,94,250,150,252,240,10,
+223,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,0,1,0,0,0,232,0,180,0,22,0,82,0,
+3,0,2,0,16,0,47,0,1,0,0,0,0,0,2,0,2,0,1,0,4,5,18,1,144,0,5,0,0,5,154,5,51,
+0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,252,24,0,0,8,141,
+3,232,0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,2,4,205,0,193,0,0,0,0,4,20,0,0,
+2,20,0,0,7,104,0,90,4,58,0,90,4,48,0,90,4,192,0,90,4,172,0,90,8,87,0,60,5,
+12,0,90,4,196,0,90,7,70,0,90,4,115,0,90,4,115,0,90,7,215,0,90,7,72,0,72,5,
+105,0,90,5,105,0,90,4,50,0,70,5,60,0,60,8,188,0,90,7,36,0,90,5,157,0,90,5,
+45,0,90,5,24,0,90,4,106,0,90,4,192,0,90,5,4,0,90,5,154,0,90,5,128,0,90,5,
+67,0,90,5,67,0,90,7,7,0,60,4,192,0,90,7,206,0,90,4,230,0,90,5,42,0,90,5,70,
+0,90,7,47,0,90,4,50,0,30,4,79,0,90,4,192,0,90,7,72,0,60,7,72,0,60,7,47,0,
+90,5,12,0,90,7,20,0,90,7,47,0,90,5,67,0,90,6,124,0,90,4,50,0,72,4,50,0,72,
+4,197,0,90,8,164,0,130,7,89,0,90,10,94,0,60,0,0,0,150,0,0,251,137,2,68,252,
+241,3,22,253,168,0,0,251,227,0,0,252,88,0,0,251,139,0,0,252,203,0,0,252,203,
+0,0,251,255,0,0,253,208,3,149,0,100,0,0,253,166,3,238,0,30,1,250,253,168,
+0,0,252,190,0,0,252,210,0,0,252,176,0,0,251,148,0,0,253,240,0,0,253,18,0,
+2,252,160,0,0,252,197,1,179,253,182,4,80,0,90,8,21,0,90,4,80,0,90,4,80,0,
+90,4,97,0,90,0,0,252,235,0,0,254,12,0,0,254,238,0,0,254,16,0,0,253,187,0,
+0,254,129,0,0,254,164,0,0,253,130,0,0,254,142,0,0,253,121,0,0,254,12,4,79,
+0,90,4,72,0,80,2,182,254,162,4,61,0,80,4,61,0,90,4,60,0,80,4,70,0,110,4,60,
+0,80,4,119,0,90,4,70,0,110,4,79,0,90,5,76,0,90,3,63,0,160,7,52,0,80,5,65,
+0,100,5,45,0,90,5,107,0,90,5,105,0,90,5,67,0,90,7,47,0,90,5,182,0,100,5,188,
+0,100,7,216,0,60,6,151,0,50,5,182,0,100,5,220,0,100,5,58,0,100,5,86,0,100,
+2,98,0,220,3,172,0,220,4,203,0,100,5,247,0,100,9,220,0,60,4,107,0,100,0,0,
+0,0,0,0,255,213,0,0,255,33,2,37,0,147,4,193,0,98,5,199,0,65,3,75,0,58,3,75,
+0,62,3,180,0,62,3,165,0,62,6,129,0,44,3,240,0,62,3,184,0,62,5,172,0,61,3,
+120,0,62,3,120,0,62,6,29,0,66,5,174,0,51,4,56,0,63,4,56,0,63,3,70,0,42,4,
+21,0,40,6,208,0,67,5,146,0,65,4,97,0,63,4,9,0,63,3,249,0,62,3,113,0,62,3,
+180,0,62,3,234,0,64,4,95,0,63,4,74,0,63,4,27,0,63,4,27,0,63,5,123,0,37,3,
+180,0,62,6,22,0,66,3,210,0,64,4,7,0,63,4,29,0,62,5,154,0,65,3,70,0,15,3,92,
+0,62,3,180,0,62,5,174,0,37,5,174,0,37,5,154,0,65,3,240,0,62,5,133,0,65,5,
+154,0,65,0,0,251,92,0,0,253,50,0,0,253,60,0,0,252,234,0,0,252,255,0,0,250,
+190,0,0,252,187,0,0,252,231,0,0,251,106,0,0,253,23,0,0,253,24,0,0,251,27,
+0,0,251,115,0,0,252,135,0,0,252,227,0,0,253,53,0,0,252,143,0,0,250,150,0,
+0,251,132,0,0,252,52,0,0,252,170,0,0,252,180,0,0,251,186,0,0,253,140,0,0,
+253,140,0,0,252,94,0,0,252,194,0,0,252,158,0,0,252,148,0,0,251,125,0,0,251,
+176,0,0,254,119,0,0,254,119,0,0,252,141,0,0,252,168,0,0,253,2,0,0,253,23,
+0,0,253,44,0,0,252,234,0,0,252,218,0,0,252,218,0,0,251,126,0,0,253,68,0,0,
+251,142,0,0,252,42,6,52,0,90,9,249,0,90,6,52,0,90,6,52,0,90,6,69,0,90,0,0,
+252,139,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,128,0,0,0,28,0,16,0,3,0,12,0,0,0,13,
+0,32,0,160,26,94,26,124,26,137,26,153,26,173,32,13,34,25,37,204,254,255,255,
+255,0,0,0,0,0,13,0,32,0,160,26,32,26,96,26,127,26,144,26,160,32,11,34,25,
+37,204,254,255,255,255,0,1,255,245,255,227,255,99,229,228,229,227,229,225,
+229,219,229,213,224,120,222,109,218,187,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,98,0,170,1,2,1,48,
+1,116,1,244,2,58,2,120,2,219,3,26,3,107,3,215,4,58,4,140,4,255,5,50,5,143,
+5,250,6,71,6,155,6,229,7,32,7,83,7,129,7,186,8,39,8,146,8,205,9,26,9,105,
+9,167,9,252,10,76,10,153,10,250,11,77,11,175,11,221,12,27,12,123,12,203,13,
+30,13,135,13,254,14,115,14,228,15,125,15,188,16,11,16,76,16,230,17,60,17,
+180,17,221,18,28,18,116,18,223,19,31,19,89,19,135,19,189,19,228,20,41,20,
+62,20,174,20,190,20,231,21,8,21,49,21,104,21,170,21,233,22,7,22,44,22,91,
+22,159,22,228,23,17,23,100,23,169,23,226,24,32,24,59,24,97,24,111,24,131,
+24,151,24,176,24,233,25,30,25,83,25,146,25,184,25,230,26,18,26,50,26,109,
+26,168,26,244,27,73,27,152,27,217,28,45,28,91,28,164,28,228,29,62,29,158,
+29,247,30,80,30,162,31,8,31,113,31,181,31,241,32,139,33,136,33,218,34,218,
+35,68,35,137,35,149,35,167,35,205,35,249,36,106,36,185,36,185,36,198,36,228,
+36,250,37,161,37,245,38,72,38,170,38,216,39,37,39,179,40,12,40,83,40,201,
+41,16,41,108,41,237,42,93,42,183,43,60,43,120,43,223,44,93,44,186,45,18,45,
+100,45,161,45,219,46,9,46,70,46,192,47,61,47,127,47,214,48,49,48,119,48,213,
+49,46,49,143,49,251,50,94,50,214,51,9,51,78,51,191,52,29,52,128,53,3,53,137,
+54,22,54,107,54,189,55,34,55,80,55,159,56,38,56,120,56,185,57,38,57,107,57,
+200,58,37,58,149,58,237,59,99,59,161,60,8,60,129,60,217,61,57,61,140,61,206,
+61,248,62,81,62,170,63,50,63,171,63,239,64,79,64,172,64,214,65,48,65,138,
+65,225,66,77,66,169,67,23,67,71,67,139,68,0,68,96,68,186,69,34,69,169,70,
+33,70,45,70,57,70,69,70,81,70,93,70,149,0,0,0,2,0,193,0,0,4,10,5,182,0,3,
+0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,
+250,74,104,4,230,0,0,1,0,90,255,236,7,14,4,94,0,51,0,0,37,22,51,50,54,53,
+52,38,35,34,6,7,22,21,20,2,7,39,54,54,53,16,33,32,17,20,22,23,7,38,2,53,52,
+18,54,51,50,23,62,2,51,50,22,22,21,20,2,6,35,34,39,4,158,72,78,136,160,155,
+140,111,137,10,11,167,156,58,94,109,254,192,254,192,109,94,58,157,166,126,
+229,143,242,149,29,120,142,70,137,213,116,116,210,140,133,106,158,40,240,
+205,197,220,170,143,62,67,181,254,229,84,134,40,215,181,1,164,254,92,181,
+215,40,134,84,1,30,178,168,1,11,145,208,58,99,51,131,246,166,184,254,242,
+141,61,0,2,0,90,255,206,3,224,4,94,0,34,0,46,0,0,5,38,39,6,35,34,38,38,53,
+52,54,54,51,50,23,23,54,53,52,38,35,34,6,7,39,54,54,51,50,0,21,20,7,22,23,
+1,34,6,21,20,22,51,50,54,55,38,38,3,67,7,21,138,183,113,164,90,85,155,101,
+200,130,8,16,170,169,78,141,41,125,60,216,127,229,1,14,81,58,20,254,8,100,
+98,101,107,82,127,37,46,131,50,94,71,135,65,119,71,81,134,76,112,7,76,98,
+192,207,76,65,72,95,112,254,224,239,179,156,116,160,1,152,77,62,60,71,73,
+64,67,66,0,0,2,0,90,255,206,3,224,6,204,0,47,0,59,0,0,5,38,39,6,35,34,38,
+38,53,52,54,54,51,50,23,23,54,53,52,38,35,34,6,7,39,16,33,50,23,7,38,38,35,
+34,14,2,7,54,51,50,22,22,21,20,7,22,23,1,34,6,21,20,22,51,50,54,55,38,38,
+3,67,7,21,138,183,113,164,90,85,155,101,200,130,8,16,170,169,75,116,17,177,
+1,239,228,139,133,35,147,78,76,103,72,37,4,104,141,140,219,121,81,58,20,254,
+8,100,98,101,107,82,127,37,46,131,50,94,71,135,65,119,71,81,134,76,112,7,
+76,98,192,207,75,63,16,3,114,176,103,64,77,51,110,184,208,69,130,242,155,
+179,156,116,160,1,152,77,62,60,71,73,64,67,66,0,1,0,90,255,246,4,102,4,94,
+0,27,0,0,5,38,2,53,52,18,54,51,50,22,18,21,20,2,7,39,54,54,53,52,38,35,34,
+6,21,20,22,23,1,157,157,166,133,238,147,144,239,135,167,156,58,94,109,175,
+165,166,174,109,94,10,84,1,30,178,164,1,11,149,152,254,244,160,181,254,229,
+84,134,40,215,181,202,218,219,201,181,215,40,0,0,1,0,90,255,246,4,82,6,204,
+0,42,0,0,5,38,2,17,53,16,18,36,51,50,23,7,38,38,35,34,2,3,54,51,50,22,18,
+21,20,2,7,39,54,54,53,52,38,35,34,6,6,21,21,20,22,22,23,1,167,169,164,140,
+1,5,174,228,139,133,35,147,78,171,173,19,137,175,151,238,129,171,152,58,94,
+109,175,165,88,150,82,42,92,77,10,81,1,75,1,14,176,1,13,1,149,218,176,103,
+64,77,254,240,254,184,116,140,254,254,172,184,254,218,80,139,40,211,180,202,
+218,70,120,69,81,158,181,130,42,0,0,1,0,60,255,236,7,253,4,94,0,93,0,0,1,
+54,54,51,50,22,22,21,20,2,6,35,34,39,6,6,35,34,39,6,6,35,34,38,53,52,54,55,
+54,54,53,52,35,34,6,21,20,22,51,51,55,7,7,35,34,38,53,52,54,51,50,22,22,21,
+20,6,7,6,6,21,20,22,22,51,50,19,51,22,22,51,50,54,53,52,38,39,55,22,18,21,
+20,7,22,22,51,50,54,53,52,38,35,34,6,7,4,235,60,171,103,126,208,118,123,226,
+144,251,148,37,134,72,163,59,33,104,84,143,185,68,77,74,70,138,37,43,31,22,
+5,7,10,15,14,71,105,132,99,95,138,74,72,68,75,66,45,72,37,126,26,131,13,73,
+66,77,89,104,114,81,155,160,28,39,195,95,151,165,160,137,57,95,29,3,193,88,
+69,135,247,173,178,254,247,140,155,67,88,136,70,66,184,144,64,116,71,70,127,
+71,161,33,28,21,40,1,129,2,107,73,87,115,72,128,77,74,138,69,75,111,56,66,
+87,47,1,16,138,134,221,196,161,223,75,124,82,254,215,204,134,101,74,108,239,
+208,196,219,54,45,0,1,0,90,255,236,4,178,4,94,0,46,0,0,37,6,6,35,34,38,53,
+52,54,55,38,38,53,52,36,51,50,4,18,21,20,2,7,39,54,54,53,52,2,35,34,6,6,21,
+20,22,23,21,6,6,21,20,22,51,50,54,55,2,255,44,190,77,166,200,106,98,92,112,
+1,23,211,188,1,27,151,53,43,139,32,25,231,208,100,143,74,149,133,134,148,
+113,93,54,141,37,49,30,39,176,151,74,135,43,33,130,77,141,178,153,254,230,
+184,140,254,222,89,63,120,189,143,228,1,1,49,85,50,76,100,13,97,13,106,85,
+91,97,29,25,0,2,0,90,255,236,4,106,4,94,0,19,0,39,0,0,1,20,2,6,35,34,36,53,
+52,54,55,38,38,53,52,36,51,50,4,22,5,6,6,21,20,22,51,50,54,54,53,52,38,35,
+34,6,21,20,22,23,4,106,133,247,165,236,254,253,106,98,92,112,1,7,207,177,
+1,2,135,253,188,134,148,155,152,116,169,92,204,183,137,160,149,133,2,48,165,
+254,247,150,171,156,74,135,43,33,130,77,144,175,139,255,214,13,106,85,97,
+91,105,206,131,199,221,96,88,76,100,13,0,2,0,90,255,236,6,236,4,94,0,55,0,
+67,0,0,1,54,54,51,50,22,22,21,20,2,6,35,32,39,6,35,34,38,38,53,52,54,54,51,
+50,23,54,53,52,38,35,34,6,7,39,54,54,51,50,0,21,20,7,22,22,51,50,54,53,52,
+38,38,35,34,6,7,1,34,6,21,20,22,51,50,54,55,38,38,3,210,60,171,103,127,212,
+121,126,229,146,254,251,166,145,213,113,164,90,85,155,101,203,135,16,170,
+169,78,141,41,125,60,216,127,229,1,14,66,52,188,104,151,173,77,137,91,57,
+95,29,253,145,100,98,101,107,82,127,37,46,132,3,193,88,69,136,248,171,176,
+254,247,142,176,176,65,119,71,81,134,76,119,77,97,192,207,76,65,72,95,112,
+254,224,239,165,140,73,95,240,207,130,187,98,54,45,254,19,77,62,60,71,73,
+64,65,68,0,0,1,0,90,255,236,4,25,4,94,0,41,0,0,37,54,54,53,52,37,53,54,54,
+53,52,38,38,35,34,6,21,20,22,23,7,46,2,53,52,18,54,51,50,22,22,21,20,6,7,
+22,22,21,20,6,7,2,143,101,115,254,230,132,150,66,123,81,172,161,109,94,58,
+107,142,74,123,230,163,119,207,117,112,92,106,98,207,146,114,11,108,83,167,
+27,97,13,100,76,50,84,50,211,236,149,229,41,134,48,168,218,124,169,1,8,147,
+83,145,91,77,130,33,45,131,66,135,194,8,0,0,1,0,90,255,236,4,25,6,204,0,52,
+0,0,37,54,54,53,52,37,53,54,54,53,52,38,38,35,34,6,21,20,22,23,7,38,2,39,
+17,16,18,36,51,50,23,7,38,38,35,34,2,3,54,51,50,22,22,21,20,6,7,22,22,21,
+20,6,7,2,143,101,115,254,230,132,150,66,123,81,172,161,109,94,58,146,170,
+7,140,1,5,174,228,139,133,35,147,78,172,171,20,128,202,119,207,117,112,92,
+106,98,207,146,114,11,108,83,167,27,97,13,100,76,50,84,50,211,236,149,229,
+41,134,65,1,24,190,1,77,1,13,1,149,218,176,103,64,77,254,237,254,191,112,
+83,145,91,77,130,33,45,131,66,135,194,8,0,0,2,0,90,255,236,7,125,6,81,0,53,
+0,73,0,0,1,20,7,55,22,22,51,50,54,53,52,38,39,39,38,38,53,52,54,55,23,6,21,
+20,22,23,23,22,18,21,20,2,6,35,34,38,39,6,35,34,36,53,52,54,55,38,38,53,52,
+36,51,50,4,22,5,6,6,21,20,22,51,50,54,54,53,52,38,35,34,6,21,20,22,23,4,106,
+48,7,33,199,100,150,168,136,163,117,229,183,26,20,151,27,116,175,91,223,231,
+124,227,144,139,221,73,149,255,236,254,253,106,98,92,112,1,7,207,177,1,2,
+135,253,188,134,148,155,152,116,169,92,204,183,137,160,149,133,2,48,125,132,
+5,74,116,240,207,185,200,30,21,35,165,149,39,172,56,61,108,124,87,88,19,12,
+36,254,229,236,178,254,248,141,89,83,172,171,156,74,135,43,33,130,77,144,
+175,139,255,214,13,106,85,97,91,105,206,131,199,221,96,88,76,100,13,0,0,1,
+0,72,253,178,6,238,4,94,0,69,0,0,1,6,6,35,34,2,17,53,23,21,22,22,51,50,54,
+53,52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,38,
+35,34,6,7,39,54,54,51,50,22,22,21,20,2,6,35,34,38,39,6,35,34,39,30,2,51,50,
+55,2,223,48,138,53,204,220,178,25,142,75,141,173,173,152,78,141,41,131,72,
+212,116,151,222,121,42,34,198,98,151,173,77,137,91,57,95,29,130,60,171,103,
+127,212,121,126,229,146,135,216,74,148,217,127,105,6,44,89,80,73,72,253,229,
+22,29,1,163,1,109,126,30,8,66,98,242,195,203,222,76,65,76,98,105,130,254,
+181,144,106,72,113,240,207,130,187,98,54,45,80,88,69,136,248,171,176,254,
+247,142,83,80,163,79,218,202,91,35,0,0,1,0,90,255,236,5,15,4,94,0,57,0,0,
+1,38,35,34,6,21,20,22,51,21,39,35,34,6,21,20,51,50,54,55,51,18,51,50,54,54,
+53,52,38,39,55,22,18,21,20,6,6,35,34,38,39,6,35,34,38,53,52,54,55,38,38,53,
+52,54,54,51,50,23,2,114,70,67,111,110,139,158,20,16,123,138,190,85,90,13,
+131,26,136,51,80,47,106,114,81,154,163,94,165,93,76,125,31,65,190,170,196,
+96,88,101,83,95,172,113,102,106,3,190,22,80,65,93,96,120,1,105,94,210,135,
+137,254,240,97,187,133,161,223,75,124,81,254,213,203,164,252,139,65,71,136,
+192,155,87,140,44,41,113,83,78,132,73,36,0,0,1,0,90,253,198,5,15,4,94,0,84,
+0,0,1,38,35,34,6,21,20,22,51,51,50,54,54,53,53,6,35,34,38,39,6,35,34,38,53,
+52,54,55,38,38,53,52,54,54,51,50,23,7,38,35,34,6,21,20,22,51,21,39,35,34,
+6,21,20,51,50,54,55,51,18,51,50,54,54,53,52,38,39,55,22,18,21,17,20,2,35,
+33,34,38,53,52,54,51,50,22,23,2,31,19,40,39,47,111,140,185,107,126,58,84,
+98,76,125,31,65,190,170,196,96,88,101,83,95,172,113,102,106,52,70,67,111,
+110,139,158,21,15,123,138,190,85,90,13,131,26,136,51,80,47,106,114,81,154,
+163,238,202,254,240,149,180,126,104,51,90,27,255,0,28,51,46,55,52,75,153,
+156,103,75,65,71,136,192,155,87,140,44,41,113,83,78,132,73,36,124,22,80,65,
+93,96,120,1,105,94,210,135,137,254,240,97,187,133,161,223,75,124,81,254,213,
+203,253,204,250,254,221,133,112,99,126,45,38,0,1,0,70,254,95,3,246,4,94,0,
+32,0,0,55,54,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,6,7,22,
+18,23,39,46,2,35,34,7,70,147,219,173,197,174,151,78,141,41,131,72,212,116,
+146,224,124,139,130,131,156,12,165,9,106,180,121,169,110,56,112,221,186,191,
+214,76,65,76,98,105,129,246,170,153,245,72,70,254,235,173,11,128,198,110,
+73,0,0,1,0,60,255,236,4,226,4,94,0,66,0,0,19,35,34,38,53,52,54,51,50,22,22,
+21,20,6,7,6,6,21,20,22,22,51,50,19,51,22,22,51,50,54,53,52,38,39,55,22,18,
+21,20,6,6,35,34,39,6,6,35,34,38,53,52,54,55,54,54,53,52,35,34,6,21,20,22,
+51,51,55,7,251,15,71,105,132,99,95,138,74,72,68,75,66,45,72,37,126,26,131,
+13,73,66,77,89,104,114,81,155,160,90,157,93,163,59,33,104,84,143,185,68,77,
+74,70,138,37,43,31,22,6,6,10,2,224,107,73,87,115,72,128,77,74,138,69,75,111,
+56,66,87,47,1,16,138,134,221,196,161,223,75,124,82,254,215,204,165,252,138,
+136,70,66,184,144,64,116,71,70,127,71,161,33,28,21,40,1,129,0,0,1,0,90,255,
+236,8,96,4,94,0,78,0,0,5,7,34,38,2,53,52,18,54,51,50,22,22,21,20,7,6,21,20,
+51,50,54,53,52,39,38,53,52,54,54,51,50,0,17,20,2,6,35,39,55,23,51,50,54,53,
+52,38,35,34,6,21,20,30,2,21,20,6,6,35,34,38,53,52,62,2,53,52,38,35,34,6,21,
+20,22,51,51,55,2,110,72,135,206,119,121,223,144,135,217,120,29,30,126,59,
+67,29,30,120,218,134,222,1,10,119,206,135,72,19,17,16,151,151,154,156,148,
+156,17,21,18,69,131,93,133,156,17,21,18,156,148,156,154,152,150,17,16,16,
+4,137,1,14,161,168,1,5,141,139,247,156,87,116,117,27,111,61,50,27,117,116,
+87,156,247,139,254,198,255,0,161,254,242,137,4,135,1,226,216,215,205,205,
+196,72,108,84,67,31,68,108,61,132,105,31,67,84,108,72,197,204,201,219,218,
+224,1,0,2,0,90,255,236,6,202,4,94,0,39,0,51,0,0,37,22,51,50,54,53,52,38,35,
+34,6,7,22,21,16,2,35,34,38,2,53,52,18,54,51,50,23,54,54,51,50,22,22,21,20,
+2,6,35,34,39,1,20,22,51,50,54,53,52,38,35,34,6,4,88,72,78,136,162,155,140,
+107,140,17,12,251,215,130,210,117,114,212,138,233,129,55,191,108,137,214,
+117,115,213,140,133,106,253,5,150,134,137,146,148,138,133,148,158,40,240,
+205,197,220,155,135,68,71,254,251,254,202,148,1,7,160,166,1,4,141,193,87,
+106,131,244,168,184,254,244,143,61,1,254,201,232,229,204,206,223,226,0,0,
+1,0,90,255,236,5,97,4,94,0,57,0,0,5,54,53,16,0,33,34,6,21,20,22,51,21,39,
+35,34,6,21,20,22,51,50,54,55,51,22,22,51,50,54,55,23,2,35,34,39,6,35,34,38,
+38,53,52,54,55,38,53,52,62,2,51,50,4,18,17,20,7,4,163,20,254,223,254,233,
+179,194,162,137,21,17,123,138,73,69,74,72,16,118,16,65,71,49,72,9,142,48,
+222,142,71,71,152,88,147,81,96,88,184,51,126,213,163,238,1,71,169,17,20,68,
+146,1,153,1,121,89,86,84,95,120,1,105,94,92,98,98,106,108,96,81,89,36,254,
+240,132,132,88,152,87,87,140,44,68,159,45,109,95,64,214,254,92,254,223,106,
+85,0,0,1,0,90,255,236,4,211,4,94,0,50,0,0,1,54,51,50,22,22,21,20,6,7,22,21,
+20,6,6,35,34,36,2,53,52,18,55,23,14,2,21,20,22,22,51,50,54,53,52,38,38,35,
+7,53,50,62,2,53,52,38,35,34,7,2,117,111,115,114,172,94,84,100,184,131,247,
+164,178,254,237,150,178,142,71,78,92,43,107,191,117,184,192,61,115,85,60,
+106,113,66,36,112,111,77,81,4,51,43,74,131,78,85,111,41,75,165,109,174,95,
+149,1,16,176,162,1,39,74,109,61,126,134,103,134,208,115,120,108,52,83,46,
+2,121,26,45,69,49,65,80,29,0,0,2,0,90,255,236,4,190,4,94,0,20,0,38,0,0,37,
+6,35,34,38,38,53,52,18,36,51,50,22,18,21,20,6,6,35,34,38,19,22,22,51,50,54,
+53,52,38,35,34,6,21,20,22,51,50,55,2,143,66,167,93,153,86,139,1,1,169,168,
+254,137,87,152,90,84,112,27,15,84,66,78,77,194,187,191,196,81,77,133,36,135,
+155,131,245,167,167,1,18,154,152,254,234,178,154,243,133,76,1,36,108,122,
+210,190,223,239,236,226,191,209,230,0,1,0,90,253,203,4,186,4,94,0,29,0,0,
+1,38,38,35,34,6,21,20,22,23,23,30,2,23,7,2,2,39,39,38,2,53,52,18,54,51,50,
+22,23,3,113,46,141,82,159,185,155,127,74,165,207,143,71,165,62,199,155,57,
+249,233,131,239,150,118,212,72,3,71,69,72,236,189,165,220,22,12,28,130,240,
+255,48,1,8,1,12,24,9,41,1,19,237,158,1,4,147,105,98,0,0,1,0,90,255,236,4,
+102,4,84,0,27,0,0,1,6,6,21,20,22,51,50,54,53,52,38,39,55,22,18,21,20,2,6,
+35,34,38,2,53,52,18,55,1,215,94,109,174,166,165,175,109,94,58,155,168,135,
+240,143,147,238,133,165,158,3,206,40,215,181,202,218,219,201,181,215,40,134,
+83,254,229,182,160,254,244,152,149,1,11,164,178,1,29,85,0,1,0,90,255,236,
+5,204,6,204,0,34,0,0,1,38,35,34,6,2,17,16,0,33,34,38,2,53,52,18,55,23,6,6,
+21,20,22,51,50,54,18,53,53,52,18,54,51,50,23,5,137,43,49,74,78,33,254,247,
+254,233,139,236,131,175,150,56,105,98,174,160,135,155,70,101,178,115,55,73,
+6,51,15,138,254,198,254,183,254,79,254,104,149,1,4,156,182,1,49,76,132,52,
+214,167,204,221,121,1,6,244,206,225,1,112,196,26,0,2,0,90,255,236,5,54,4,
+94,0,66,0,76,0,0,37,34,39,6,6,7,34,38,39,6,35,34,38,53,52,54,55,38,38,53,
+52,54,54,51,50,23,7,38,35,34,6,21,20,22,51,21,39,35,34,6,21,20,51,50,54,55,
+51,18,51,50,54,55,38,2,53,52,54,54,51,50,22,22,21,20,7,22,23,3,52,38,39,6,
+21,20,22,23,54,5,47,62,61,52,134,75,76,125,31,65,190,170,196,96,88,101,83,
+95,172,113,102,106,52,70,67,111,110,139,158,21,15,123,138,190,85,90,13,131,
+26,136,38,72,26,120,142,60,103,58,77,128,79,53,33,36,176,77,60,52,82,78,29,
+138,18,83,92,1,65,71,136,192,155,87,140,44,41,113,83,78,132,73,36,124,22,
+80,65,93,96,120,1,105,94,210,135,137,254,240,52,45,78,1,11,158,95,189,116,
+130,245,128,174,155,6,1,1,69,135,220,22,90,185,110,187,60,122,0,0,1,0,90,
+255,236,5,38,6,204,0,76,0,0,1,38,35,34,21,20,22,51,21,39,35,34,6,21,20,22,
+51,50,54,55,51,18,51,50,54,54,53,52,38,39,39,38,38,53,52,54,54,51,50,22,23,
+7,38,38,35,34,6,21,20,22,23,23,22,18,21,20,2,6,35,34,38,39,6,35,34,38,53,
+52,55,38,53,52,54,54,51,50,23,2,90,54,59,221,163,134,20,16,124,137,90,100,
+85,90,13,131,26,136,61,101,57,141,157,110,202,154,113,195,119,129,214,68,
+120,58,133,112,109,129,104,114,128,215,186,99,175,101,76,125,31,65,190,172,
+194,184,184,91,171,118,89,88,3,127,15,136,68,80,120,1,98,91,102,98,135,137,
+254,240,122,224,140,212,217,47,31,52,148,121,79,145,84,92,79,93,66,60,97,
+80,72,92,31,35,59,254,239,248,175,254,222,170,65,71,136,184,153,169,92,75,
+135,75,119,66,26,0,0,1,0,90,255,236,4,233,4,94,0,38,0,0,5,38,2,53,52,54,54,
+51,50,23,54,51,50,22,22,21,20,2,7,39,54,18,53,52,38,35,34,6,7,35,38,38,35,
+34,6,21,20,22,23,1,129,141,154,90,159,93,172,69,69,173,94,158,90,155,140,
+69,89,97,85,83,73,87,12,131,12,88,72,83,85,97,89,20,101,1,81,195,151,229,
+125,155,155,125,229,151,196,254,175,100,119,74,1,0,161,184,206,143,129,130,
+142,204,186,161,255,75,0,1,0,90,255,236,4,233,6,204,0,50,0,0,19,16,18,36,
+51,50,23,7,38,38,35,34,6,3,54,51,50,23,54,51,50,22,22,21,20,2,7,39,54,18,
+53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,23,7,38,2,53,90,140,1,5,174,
+228,139,133,35,147,78,164,169,25,68,83,172,69,69,173,94,158,90,155,140,69,
+89,97,85,83,73,87,12,131,12,88,72,83,85,97,89,69,141,154,3,80,1,13,1,149,
+218,176,103,64,77,247,254,228,47,155,155,125,229,151,196,254,175,100,119,
+74,1,0,161,184,206,143,129,130,142,204,186,161,255,75,119,101,1,81,195,0,
+1,0,60,255,236,6,173,4,94,0,54,0,0,19,54,54,51,50,22,23,55,54,54,51,50,22,
+22,21,20,2,6,35,34,39,55,22,51,50,54,53,52,38,35,34,6,7,22,21,20,2,6,35,34,
+38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,90,72,212,116,129,206,62,5,56,
+191,102,137,214,117,115,213,140,133,106,81,72,78,136,162,155,140,110,139,
+10,7,130,231,140,150,215,58,160,26,143,103,141,173,173,152,78,141,41,3,147,
+98,105,99,95,6,87,101,131,244,168,184,254,244,143,61,117,40,240,205,197,220,
+166,140,56,65,173,254,253,141,142,125,53,90,92,242,195,203,222,76,65,0,1,
+0,90,255,173,4,102,4,84,0,38,0,0,5,38,39,6,35,34,38,2,53,52,18,55,23,6,6,
+21,20,22,51,50,55,38,39,55,22,23,54,53,52,38,39,55,22,18,21,20,7,22,23,3,
+196,8,39,135,174,147,238,133,165,158,58,94,109,174,166,149,85,87,113,19,144,
+116,27,109,94,58,155,168,97,74,16,83,80,92,109,149,1,11,164,178,1,29,85,134,
+40,215,181,202,218,89,101,20,136,17,104,88,107,181,215,40,134,83,254,229,
+182,192,154,125,134,0,0,1,0,90,255,236,7,116,4,94,0,57,0,0,1,54,54,51,50,
+22,22,21,20,2,6,35,34,38,39,6,6,35,34,38,2,53,52,18,55,23,6,6,21,20,22,51,
+50,54,53,52,38,39,55,22,18,21,20,6,7,22,22,51,50,54,53,52,38,38,35,34,6,7,
+4,90,60,171,103,127,212,121,126,229,146,138,220,70,69,190,112,147,238,133,
+165,158,58,94,109,174,166,165,175,109,94,58,155,168,18,32,35,198,97,151,173,
+77,137,91,57,95,29,3,193,88,69,136,248,171,176,254,247,142,87,81,78,90,149,
+1,11,164,178,1,29,85,134,40,215,181,202,218,219,201,181,215,40,134,83,254,
+229,182,58,110,89,73,112,240,207,130,187,98,54,45,0,1,0,90,255,236,5,174,
+6,204,0,54,0,0,1,38,35,34,6,2,17,16,33,34,38,38,53,52,54,55,38,38,53,52,54,
+54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,51,21,39,34,6,21,20,22,51,50,18,
+17,53,52,18,54,51,50,23,5,107,43,49,74,78,33,253,179,128,193,110,97,87,101,
+83,95,172,113,84,168,56,68,40,127,54,111,112,65,135,121,60,123,138,130,126,
+212,198,101,178,115,55,73,6,51,15,140,254,198,254,185,252,183,79,164,104,
+89,143,39,41,113,83,78,132,73,47,38,114,29,32,80,65,64,85,40,121,2,100,91,
+103,115,1,57,1,58,206,225,1,112,196,26,0,1,0,90,255,236,4,208,4,94,0,51,0,
+0,1,52,2,35,34,6,21,20,22,23,22,22,21,20,6,6,35,34,38,53,52,55,23,6,21,20,
+22,51,50,54,53,52,38,38,39,46,2,53,52,54,54,51,32,0,17,20,2,7,39,54,54,4,
+30,247,236,110,140,80,107,230,174,107,187,113,181,234,54,138,24,133,111,102,
+130,57,102,136,149,93,54,116,207,131,1,38,1,85,49,44,142,33,24,1,208,251,
+1,9,60,53,28,51,39,83,172,117,105,186,106,215,172,95,76,83,44,48,111,134,
+137,110,58,87,67,52,56,57,72,49,67,120,68,254,175,254,213,133,254,251,108,
+63,132,191,0,1,0,90,253,182,4,216,4,94,0,67,0,0,1,38,39,6,35,33,34,38,53,
+52,54,51,50,22,23,7,38,35,34,6,21,20,22,51,51,50,55,55,38,39,55,22,23,23,
+54,53,17,52,38,35,34,6,7,35,38,38,35,34,6,7,39,62,2,51,50,23,54,51,50,22,
+22,21,17,20,7,22,23,4,13,12,16,91,118,254,180,149,180,126,104,51,90,27,109,
+19,40,39,47,111,140,245,93,57,3,86,95,19,145,114,6,35,86,83,73,87,12,131,
+12,88,72,77,86,5,168,6,90,146,90,172,69,69,173,93,155,87,112,35,22,253,182,
+35,33,52,133,112,99,126,45,38,73,28,51,46,55,52,27,2,86,18,136,17,110,5,80,
+167,2,126,187,203,143,129,130,142,179,171,25,139,210,114,155,155,126,227,
+152,253,126,240,147,60,66,0,0,1,0,90,255,236,6,213,4,94,0,56,0,0,37,6,6,35,
+34,38,2,53,52,54,54,51,50,22,22,23,19,22,22,51,50,54,54,53,52,38,35,34,7,
+39,54,54,51,50,22,18,21,20,6,6,35,34,38,38,39,3,38,38,35,34,6,21,20,22,51,
+50,55,3,42,48,149,98,112,197,116,102,185,115,80,137,120,86,200,78,99,54,66,
+102,57,133,117,122,68,102,48,149,98,112,197,116,103,184,115,80,137,120,86,
+200,78,99,54,105,120,133,117,122,68,124,65,79,155,1,17,163,161,250,136,83,
+146,159,254,141,145,96,95,186,130,211,240,97,91,65,79,155,254,239,163,160,
+251,136,83,146,159,1,115,146,95,221,190,211,240,97,0,1,0,30,253,182,3,227,
+4,94,0,69,0,0,1,38,39,6,35,35,34,38,53,52,54,51,50,22,23,7,38,35,34,6,21,
+20,22,51,51,50,55,38,39,55,22,23,54,53,52,38,35,34,6,7,39,54,51,50,54,53,
+52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,6,7,22,22,21,20,7,22,23,3,79,13,
+18,99,130,228,149,180,126,104,51,90,27,109,19,40,39,47,111,140,126,112,68,
+75,95,19,130,110,7,196,169,91,167,50,84,147,219,173,197,174,151,78,141,41,
+131,72,212,116,146,224,124,130,121,124,130,56,40,24,253,182,38,36,58,133,
+112,99,126,45,38,73,28,51,46,55,52,40,75,18,136,16,93,30,33,112,127,39,34,
+99,112,221,186,191,214,76,65,76,98,105,129,246,170,150,236,74,49,171,108,
+110,80,65,72,0,2,0,90,255,236,3,245,4,94,0,14,0,26,0,0,1,16,2,35,34,38,2,
+53,52,18,54,51,50,22,18,5,20,22,51,50,54,53,52,38,35,34,6,3,245,251,215,130,
+210,117,114,212,138,137,209,113,253,23,150,134,137,146,148,138,133,148,2,
+39,254,251,254,202,148,1,7,160,166,1,4,141,141,254,254,168,201,232,229,204,
+206,223,226,0,0,1,0,90,255,246,4,102,4,157,0,38,0,0,1,6,7,22,21,20,2,7,39,
+54,54,53,52,39,6,7,39,54,55,38,35,34,6,21,20,22,23,7,38,2,53,52,18,54,51,
+50,23,54,55,4,95,16,74,97,167,156,58,94,109,27,120,140,19,113,87,87,147,166,
+174,109,94,58,157,166,133,238,147,171,138,39,8,4,119,134,125,154,192,181,
+254,229,84,134,40,215,181,113,81,105,15,136,20,101,89,219,201,181,215,40,
+134,84,1,30,178,164,1,11,149,109,86,86,0,1,0,60,255,173,6,238,4,94,0,66,0,
+0,5,38,39,6,35,34,38,39,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,
+7,39,54,54,51,50,22,22,21,20,7,22,22,51,50,55,38,39,55,22,23,54,53,52,38,
+38,35,34,6,7,39,54,54,51,50,22,22,21,20,7,22,23,6,76,8,33,127,171,135,216,
+74,148,217,150,215,58,160,26,143,103,141,173,173,152,78,141,41,131,72,212,
+116,151,222,121,42,34,198,98,130,85,87,110,19,142,113,32,77,137,91,57,95,
+29,130,60,171,103,127,212,121,91,68,16,83,81,78,96,83,80,163,142,125,53,90,
+92,242,195,203,222,76,65,76,98,105,130,254,181,144,106,72,113,92,98,20,136,
+16,101,96,122,130,187,98,54,45,80,88,69,136,248,171,213,147,115,133,0,1,0,
+60,255,236,6,238,4,94,0,55,0,0,19,54,54,51,50,22,22,21,20,7,22,22,51,50,54,
+53,52,38,38,35,34,6,7,39,54,54,51,50,22,22,21,20,2,6,35,34,38,39,6,35,34,
+38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,90,72,212,116,151,222,121,42,34,
+198,98,151,173,77,137,91,57,95,29,130,60,171,103,127,212,121,126,229,146,
+135,216,74,148,217,150,215,58,160,26,143,103,141,173,173,152,78,141,41,3,
+147,98,105,130,254,181,144,106,72,113,240,207,130,187,98,54,45,80,88,69,136,
+248,171,176,254,247,142,83,80,163,142,125,53,90,92,242,195,203,222,76,65,
+0,1,0,90,255,236,6,213,4,94,0,56,0,0,1,38,35,34,6,21,20,22,51,50,54,55,19,
+62,2,51,50,22,22,21,20,2,6,35,34,38,39,55,22,51,50,54,53,52,38,38,35,34,6,
+7,3,14,2,35,34,38,38,53,52,18,54,51,50,22,23,2,196,68,122,117,133,121,104,
+54,99,78,200,84,121,137,81,115,184,103,116,196,113,98,149,48,102,68,122,117,
+133,57,101,67,54,98,79,200,84,121,137,81,116,185,101,116,196,113,98,149,48,
+3,115,97,242,209,190,221,96,145,1,115,156,148,84,136,250,161,162,254,238,
+155,79,65,91,97,242,209,129,187,95,95,146,254,141,156,148,84,137,251,159,
+162,1,18,155,79,65,0,0,1,0,90,253,198,4,178,4,94,0,74,0,0,37,6,6,35,34,39,
+21,20,22,22,51,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,21,20,6,35,33,
+34,2,53,17,52,54,55,38,38,53,52,36,51,50,4,18,21,20,2,7,39,54,54,53,52,2,
+35,34,6,6,21,20,22,23,21,6,6,21,20,22,51,50,54,55,2,255,44,190,77,107,89,
+57,126,108,185,139,112,47,39,40,19,109,26,90,52,104,126,181,148,254,240,202,
+238,106,98,92,112,1,23,211,188,1,27,151,53,43,139,32,25,231,208,100,143,74,
+149,133,134,148,113,93,54,141,37,49,30,39,41,69,154,154,76,52,55,45,52,28,
+73,38,45,125,100,112,133,1,34,251,1,80,74,135,43,33,130,77,141,178,153,254,
+230,184,140,254,222,89,63,120,189,143,228,1,1,49,85,50,76,100,13,97,13,106,
+85,91,97,29,25,0,3,0,90,255,206,6,186,4,94,0,33,0,69,0,81,0,0,5,38,39,6,35,
+34,38,39,6,6,35,34,38,53,52,54,55,38,38,53,52,36,51,50,23,54,51,50,0,21,20,
+7,22,23,1,34,6,21,20,22,23,21,6,6,21,20,22,51,50,54,55,55,62,2,51,50,23,23,
+54,53,52,38,35,34,7,38,38,39,38,1,34,6,21,20,22,51,50,54,55,38,38,6,29,7,
+21,138,183,116,169,45,78,208,110,184,216,106,98,92,112,1,7,207,224,141,129,
+169,229,1,14,81,58,20,251,126,137,160,149,133,134,148,127,128,83,173,65,5,
+7,87,151,96,200,130,8,16,170,169,163,118,9,17,70,102,1,233,100,98,101,107,
+82,127,37,46,131,50,94,71,135,70,64,62,72,173,154,74,135,43,33,130,77,144,
+175,95,95,254,224,239,179,156,116,160,3,232,96,88,76,100,13,97,13,106,85,
+98,90,73,61,4,77,123,70,112,7,76,98,192,207,150,9,16,58,67,253,176,77,62,
+60,71,73,64,67,66,0,1,0,90,253,198,6,213,4,94,0,84,0,0,1,38,35,34,6,21,20,
+22,51,51,50,54,54,53,53,6,35,34,38,39,55,22,51,50,54,53,52,38,38,35,34,6,
+7,3,14,2,35,34,38,38,53,52,18,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,
+54,55,19,62,2,51,50,22,22,21,7,17,20,2,35,33,34,38,53,52,54,51,50,22,23,3,
+228,19,40,39,47,111,140,185,107,126,58,116,138,98,149,48,102,68,122,117,133,
+57,101,67,54,98,79,200,84,121,137,81,116,185,101,116,196,113,98,149,48,102,
+68,122,117,133,121,104,54,99,78,200,84,121,137,81,115,184,103,1,238,202,254,
+240,149,180,126,104,51,90,27,255,0,28,51,46,55,52,75,153,156,144,116,79,65,
+91,97,242,209,129,187,95,95,146,254,141,156,148,84,137,251,159,162,1,18,155,
+79,65,91,97,242,209,190,221,96,145,1,115,156,148,84,136,250,161,45,253,213,
+250,254,221,133,112,99,126,45,38,0,2,0,90,253,168,4,233,4,94,0,41,0,80,0,
+0,1,55,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,22,21,20,6,6,7,39,54,
+54,53,52,33,34,6,21,20,22,51,50,54,53,52,35,7,3,38,2,53,52,54,54,51,50,23,
+54,51,50,22,22,21,20,2,7,39,54,18,53,52,38,35,34,6,7,35,38,38,35,34,6,21,
+20,22,23,1,239,17,16,95,119,132,103,135,156,105,200,149,138,202,113,61,112,
+79,39,63,78,254,210,161,144,73,76,35,53,78,13,127,141,154,90,159,93,172,69,
+69,173,94,158,90,155,140,69,89,97,85,83,73,87,12,131,12,88,72,83,85,97,89,
+254,218,2,83,65,70,90,125,105,80,126,74,62,131,87,52,97,70,11,105,6,72,51,
+148,73,75,49,61,20,17,42,1,1,122,101,1,81,195,151,229,125,155,155,125,229,
+151,196,254,175,100,119,74,1,0,161,184,206,143,129,130,142,204,186,161,255,
+75,0,3,0,90,253,168,6,184,6,204,0,28,0,70,0,109,0,0,1,38,35,34,21,20,22,23,
+30,2,21,17,7,17,52,38,38,39,39,38,38,53,52,54,54,51,50,23,1,55,51,50,22,21,
+20,6,35,34,38,53,52,54,54,51,50,22,22,21,20,6,6,7,39,54,54,53,52,33,34,6,
+21,20,22,51,50,54,53,52,35,7,3,38,2,53,52,54,54,51,50,23,54,51,50,22,22,21,
+20,2,7,39,54,18,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,23,6,61,94,162,
+198,62,70,115,111,59,170,45,78,89,78,67,68,112,179,97,219,148,251,55,17,16,
+95,119,132,103,135,156,105,200,149,138,202,113,61,112,79,39,63,78,254,210,
+161,144,73,76,35,53,78,13,127,141,154,90,159,93,172,69,69,173,94,158,90,155,
+140,69,89,97,85,83,73,87,12,131,12,88,72,83,85,97,89,5,221,101,166,44,73,
+39,67,116,161,106,252,214,20,3,44,85,125,91,53,46,40,109,75,67,146,91,148,
+248,162,2,83,65,70,90,125,105,80,126,74,62,131,87,52,97,70,11,105,6,72,51,
+148,73,75,49,61,20,17,42,1,1,122,101,1,81,195,151,229,125,155,155,125,229,
+151,196,254,175,100,119,74,1,0,161,184,206,143,129,130,142,204,186,161,255,
+75,0,1,0,72,253,178,3,216,4,94,0,41,0,0,1,6,6,35,34,2,17,53,23,21,22,22,51,
+50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,2,6,35,34,39,30,2,51,
+50,55,2,223,48,138,53,204,220,178,25,142,75,141,173,173,152,78,141,41,131,
+72,212,116,151,222,121,130,231,140,127,105,6,44,89,80,73,72,253,229,22,29,
+1,163,1,109,126,30,8,66,98,242,195,203,222,76,65,76,98,105,130,254,181,173,
+254,253,141,79,218,202,91,35,0,0,1,0,72,253,178,3,216,6,204,0,53,0,0,1,6,
+6,35,34,2,17,53,23,21,22,22,51,50,54,53,52,38,35,34,6,7,39,16,33,50,23,7,
+38,38,35,34,14,2,7,54,51,50,22,22,21,20,2,6,35,34,39,30,2,51,50,55,2,223,
+48,138,53,204,220,178,25,142,75,141,173,173,152,87,114,21,177,1,239,228,139,
+133,35,147,78,76,103,72,37,4,117,114,151,222,121,130,231,140,127,105,6,44,
+89,80,73,72,253,229,22,29,1,163,1,109,126,30,8,66,98,242,195,203,222,73,65,
+16,3,114,176,103,64,77,50,111,183,210,70,130,254,181,173,254,253,141,79,218,
+202,91,35,0,0,1,0,90,253,198,4,107,4,94,0,42,0,0,5,54,54,51,50,22,21,20,6,
+35,33,34,2,53,17,16,0,51,50,22,23,7,38,38,35,34,6,2,17,17,20,22,22,51,51,
+50,54,53,52,38,35,34,7,2,221,26,90,52,104,126,181,148,254,240,202,238,1,37,
+251,123,209,66,113,42,152,86,151,160,68,57,126,108,185,139,112,47,39,40,19,
+183,38,45,125,100,112,133,1,34,251,1,208,1,73,1,98,92,84,103,64,77,129,254,
+224,254,184,254,229,154,154,76,52,55,45,52,28,0,0,4,0,130,253,198,8,74,7,
+224,0,33,0,69,0,95,0,107,0,0,5,38,39,6,35,34,38,39,6,6,35,34,38,53,52,54,
+55,38,38,53,52,36,51,50,23,54,51,50,0,21,20,7,22,23,1,34,6,21,20,22,23,21,
+6,6,21,20,22,51,50,54,55,55,62,2,51,50,23,23,54,53,52,38,35,34,7,38,38,39,
+38,1,38,35,34,6,21,17,20,22,51,50,55,23,6,35,34,38,38,53,17,52,54,54,51,50,
+23,1,34,6,21,20,22,51,50,54,55,38,38,7,173,7,21,138,183,116,169,45,78,208,
+110,184,216,106,98,92,112,1,7,207,224,141,129,169,229,1,14,81,58,20,251,126,
+137,160,149,133,134,148,127,128,83,173,65,5,7,87,151,96,200,130,8,16,170,
+169,163,118,9,17,70,102,254,105,73,63,127,156,156,127,63,73,45,84,89,134,
+211,116,116,212,133,89,84,3,83,100,98,101,107,82,127,37,46,131,50,94,71,135,
+70,64,62,72,173,154,74,135,43,33,130,77,144,175,95,95,254,224,239,179,156,
+116,160,3,232,96,88,76,100,13,97,13,106,85,98,90,73,61,4,77,123,70,112,7,
+76,98,192,207,150,9,16,58,67,3,102,26,179,144,249,132,145,178,26,140,26,126,
+229,141,6,58,142,229,125,26,249,190,77,62,60,71,73,64,67,66,0,1,0,90,255,
+236,8,33,6,204,0,57,0,0,37,6,6,35,34,38,2,53,52,54,54,51,50,22,22,23,19,22,
+22,51,50,54,53,17,52,18,54,51,50,23,7,38,35,34,6,2,17,17,20,6,6,35,34,38,
+38,39,3,38,38,35,34,6,21,20,22,51,50,55,3,42,48,149,98,112,197,116,102,185,
+115,80,137,120,86,200,78,99,54,101,120,96,174,116,55,73,67,43,49,74,78,33,
+98,178,114,80,137,120,86,200,78,99,54,105,120,133,117,122,68,124,65,79,155,
+1,17,163,161,250,136,83,146,159,254,141,145,96,215,196,1,166,226,1,111,196,
+26,127,15,138,254,198,254,183,254,218,162,251,134,83,146,159,1,115,146,95,
+221,190,211,240,97,0,0,1,0,60,255,236,10,4,4,94,0,85,0,0,1,54,54,51,50,22,
+22,21,20,2,6,35,34,38,39,6,6,35,34,38,39,6,35,34,38,39,55,22,22,51,50,54,
+53,52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,38,
+35,34,6,7,39,54,54,51,50,22,22,21,20,7,7,22,22,51,50,54,53,52,38,38,35,34,
+6,7,6,234,60,171,103,127,212,121,126,229,146,135,216,73,56,196,114,135,216,
+74,148,217,150,215,58,160,26,143,103,141,173,173,152,78,141,41,131,72,212,
+116,151,222,121,42,34,198,98,151,173,77,137,91,57,95,29,130,60,171,103,127,
+212,121,41,1,35,198,97,151,173,77,137,91,57,95,29,3,193,88,69,136,248,171,
+176,254,247,142,84,78,72,90,83,80,163,142,125,53,90,92,242,195,203,222,76,
+65,76,98,105,130,254,181,144,106,72,113,240,207,130,187,98,54,45,80,88,69,
+136,248,171,146,110,4,73,112,240,207,130,187,98,54,45,0,0,1,0,150,253,198,
+3,16,7,224,0,25,0,0,1,38,35,34,6,21,17,20,22,51,50,55,23,6,35,34,38,38,53,
+17,52,54,54,51,50,23,2,227,73,63,127,156,156,127,63,73,45,84,89,134,211,116,
+116,212,133,89,84,7,58,26,179,144,249,132,145,178,26,140,26,126,229,141,6,
+58,142,229,125,26,0,1,251,137,253,168,255,156,255,166,0,41,0,0,1,38,38,53,
+52,54,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,30,2,21,20,6,6,35,34,38,
+38,39,38,38,35,34,6,21,20,22,23,252,103,104,118,66,117,73,96,149,61,67,96,
+60,47,61,59,52,37,72,98,54,64,117,75,71,111,90,85,39,82,51,49,59,61,48,253,
+168,23,140,100,64,115,68,96,95,107,84,60,68,54,75,10,115,14,75,105,56,69,
+120,71,44,81,136,61,60,69,59,50,77,12,0,0,1,252,241,253,168,1,209,4,216,0,
+59,0,0,1,38,39,6,6,35,34,38,39,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,
+54,51,50,22,23,22,22,51,50,55,38,39,55,22,23,54,53,17,52,38,35,34,7,39,54,
+51,50,22,22,21,17,20,6,7,22,23,1,61,13,19,63,127,76,103,162,61,74,90,54,49,
+59,61,48,37,104,118,66,117,73,93,144,62,65,107,66,133,63,77,98,19,123,106,
+11,156,127,63,73,45,84,89,134,211,116,39,32,53,23,253,182,40,37,49,42,98,
+93,112,79,69,59,50,77,12,115,23,140,100,64,115,68,92,93,100,85,63,80,18,136,
+15,85,50,76,3,146,145,178,26,140,26,126,229,141,252,176,79,147,55,89,68,0,
+2,253,168,4,176,3,92,7,88,0,64,0,75,0,0,1,39,34,6,7,6,6,35,34,39,6,35,34,
+38,39,38,38,35,34,6,21,20,22,51,54,55,23,14,3,35,34,38,53,52,54,54,51,50,
+22,23,22,22,51,55,38,53,52,54,51,50,22,21,20,7,23,50,54,55,54,54,51,50,23,
+5,54,53,52,38,35,34,6,21,20,22,3,77,48,47,86,59,56,103,60,100,84,85,90,50,
+105,60,69,79,36,45,55,34,16,42,83,48,36,38,30,35,32,75,105,57,102,68,62,105,
+54,58,79,42,45,98,111,87,84,122,63,71,53,94,51,53,93,53,43,34,253,101,57,
+43,32,31,42,51,6,18,5,41,48,46,43,33,49,44,45,51,38,59,42,47,76,76,34,109,
+18,42,36,24,140,97,61,110,63,43,46,49,40,3,81,111,83,109,112,81,89,85,4,43,
+46,47,42,4,131,50,85,31,42,42,31,39,75,0,0,1,251,227,4,216,255,156,7,88,0,
+44,0,0,1,54,51,50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,
+6,7,39,54,54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,35,34,7,252,226,33,
+34,104,126,142,104,87,140,79,118,211,145,158,211,110,65,123,84,26,67,87,180,
+154,159,172,88,73,48,55,86,15,12,6,75,11,100,82,85,114,79,133,75,109,163,
+80,90,159,103,65,123,86,14,131,2,91,69,104,115,114,105,70,93,32,25,67,4,0,
+0,1,252,88,4,206,255,156,7,88,0,38,0,0,1,54,54,53,52,38,35,34,6,7,35,38,38,
+35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,7,
+254,154,62,52,57,50,50,49,7,122,9,49,48,50,57,51,63,112,67,79,129,116,48,
+94,31,30,95,48,116,129,79,67,5,19,67,130,82,82,92,73,74,79,68,93,81,81,130,
+68,69,61,187,100,144,158,47,51,51,47,158,144,100,188,60,0,1,251,139,253,198,
+255,156,2,17,0,29,0,0,1,38,35,34,6,21,20,22,51,51,50,54,54,53,17,55,17,20,
+2,35,33,34,38,53,52,54,51,50,22,23,252,172,19,40,39,47,111,140,185,107,126,
+58,170,238,202,254,240,149,180,126,104,51,90,27,255,0,28,51,46,55,52,75,153,
+156,1,249,72,253,210,250,254,221,133,112,99,126,45,38,0,1,252,203,253,168,
+255,171,255,176,0,34,0,0,5,22,23,53,52,38,39,55,22,21,20,7,22,23,7,38,39,
+6,35,34,38,53,52,55,23,6,6,21,20,22,51,50,55,38,39,254,87,97,84,24,27,103,
+92,40,40,15,128,10,16,98,131,152,201,92,103,22,29,115,94,101,56,74,76,197,
+28,79,7,32,83,31,71,80,141,74,62,80,45,38,31,31,62,178,135,131,76,71,22,79,
+37,89,94,39,83,32,0,1,252,203,253,168,255,156,255,176,0,24,0,0,7,22,21,20,
+6,6,35,34,38,53,52,55,23,6,6,21,20,22,51,50,54,53,52,38,39,192,92,91,165,
+112,152,201,92,103,22,29,115,94,109,115,24,27,80,80,141,76,139,84,178,135,
+131,76,71,22,79,37,89,94,91,84,32,83,31,0,0,1,251,255,253,168,255,156,255,
+166,0,46,0,0,1,54,54,51,50,22,23,23,22,51,50,54,53,52,38,39,55,30,2,21,20,
+6,6,35,34,39,7,6,35,34,38,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,251,
+255,29,126,93,97,143,14,12,42,111,47,61,59,52,37,72,98,54,64,117,75,146,69,
+14,75,117,62,91,65,30,123,19,55,49,49,59,61,47,49,55,19,254,248,86,88,128,
+97,34,123,60,68,54,75,10,115,14,75,105,56,69,120,71,99,17,82,37,68,69,37,
+36,47,69,59,54,72,47,36,0,1,253,208,253,208,255,166,255,166,0,11,0,0,1,53,
+35,53,51,53,51,21,51,21,35,21,254,115,163,163,144,163,163,253,208,173,139,
+158,158,139,173,0,0,4,0,100,255,231,3,49,4,94,0,27,0,39,0,67,0,79,0,0,1,54,
+53,52,38,35,34,6,7,22,22,21,20,6,35,34,38,53,52,54,54,51,50,22,22,21,20,7,
+37,52,38,35,34,6,21,20,22,51,50,54,1,54,53,52,38,35,34,6,7,22,22,21,20,6,
+35,34,38,53,52,54,54,51,50,22,22,21,20,7,37,52,38,35,34,6,21,20,22,51,50,
+54,2,136,25,123,95,41,66,10,69,81,108,76,92,112,89,157,106,103,169,93,37,
+254,110,42,31,32,43,43,32,31,42,1,14,25,123,95,41,66,10,69,81,108,76,92,112,
+89,157,106,103,169,93,37,254,110,42,31,32,43,43,32,31,42,2,142,53,74,91,118,
+20,6,13,93,64,76,108,117,98,70,139,84,85,156,100,98,74,185,32,43,43,32,31,
+42,42,253,33,53,74,91,118,20,6,13,93,64,76,108,117,98,70,139,84,85,156,100,
+98,74,185,32,43,43,32,31,42,42,0,1,253,166,4,216,0,0,6,194,0,3,0,0,1,1,23,
+1,253,166,2,16,74,253,237,5,67,1,127,101,254,123,0,1,0,30,255,236,3,148,4,
+94,0,25,0,0,19,54,54,51,50,22,22,21,20,2,6,35,34,39,55,22,51,50,54,53,52,
+38,35,34,6,7,30,73,203,142,137,214,117,115,213,140,64,61,43,37,37,136,162,
+155,140,84,171,34,3,84,135,131,131,244,168,184,254,244,143,15,133,10,240,
+205,197,220,117,79,0,1,253,168,0,0,1,90,7,88,0,17,0,0,1,54,54,51,50,22,18,
+21,17,35,17,16,2,38,35,34,6,7,253,168,56,226,142,155,237,130,170,72,156,130,
+89,150,42,6,35,144,165,182,254,164,239,251,169,4,10,1,12,1,40,144,114,102,
+0,1,252,190,4,216,255,156,7,88,0,25,0,0,1,38,38,53,52,54,54,51,50,22,22,21,
+20,7,39,54,54,53,52,38,35,34,6,21,20,23,253,161,106,121,97,168,93,114,169,
+93,227,46,61,68,125,107,96,118,129,4,216,36,170,121,84,144,85,85,145,83,241,
+86,105,23,113,85,84,102,109,77,167,54,0,1,252,210,4,214,255,224,7,88,0,36,
+0,0,1,38,38,53,52,54,54,51,50,22,22,21,20,14,2,21,20,22,23,7,38,38,53,52,
+62,2,53,52,35,34,6,21,20,22,23,253,151,97,100,95,163,95,104,160,97,28,34,
+28,72,86,35,124,143,28,34,28,212,96,118,56,51,4,216,50,157,119,88,144,82,
+64,132,67,34,52,42,38,21,40,33,4,115,7,87,82,31,46,41,44,30,146,107,91,67,
+101,30,0,0,2,252,176,4,211,255,156,7,88,0,32,0,44,0,0,1,52,54,51,50,23,38,
+38,35,34,6,21,20,22,23,7,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,253,226,108,76,60,60,12,130,96,96,132,
+34,40,45,85,88,97,172,106,111,166,96,67,118,73,76,108,110,42,31,32,43,43,
+32,31,42,5,144,76,108,40,83,101,118,90,63,91,35,120,49,145,111,100,154,86,
+80,163,97,77,140,83,108,72,31,42,42,31,32,43,43,0,0,1,251,148,4,214,255,156,
+7,88,0,42,0,0,1,38,38,53,52,54,54,51,50,23,54,51,50,22,22,21,20,6,7,39,54,
+53,52,38,35,7,22,22,21,20,7,39,54,54,53,52,38,35,34,6,21,20,23,252,119,106,
+121,97,168,93,113,76,70,87,105,146,77,95,95,46,92,97,77,44,30,34,227,46,61,
+68,125,107,96,118,129,4,216,36,170,121,84,144,85,38,38,84,142,87,114,154,
+61,113,75,141,83,102,4,38,99,44,241,86,105,23,113,85,84,102,109,77,167,54,
+0,1,253,240,253,178,0,135,0,68,0,16,0,0,19,6,6,35,34,38,2,53,53,23,21,20,
+22,22,51,50,55,135,48,138,53,121,195,108,178,44,96,80,73,72,253,229,22,29,
+162,1,32,180,28,30,41,179,178,92,35,0,0,2,253,18,253,178,0,135,0,70,0,16,
+0,20,0,0,19,6,6,35,34,38,2,53,53,23,21,20,22,22,51,50,55,1,17,35,17,135,48,
+138,53,120,190,106,170,44,96,80,73,72,253,163,160,253,229,22,29,159,1,34,
+181,28,30,41,179,178,92,35,1,211,253,148,2,128,0,2,252,160,4,74,255,36,6,
+80,0,16,0,28,0,0,1,38,38,39,6,6,35,34,38,53,52,54,51,50,22,22,23,1,52,38,
+35,34,6,21,20,22,51,50,54,254,152,15,69,38,19,99,64,85,115,115,85,97,181,
+135,31,254,136,42,31,32,43,43,32,31,42,4,74,96,143,36,62,71,107,78,82,109,
+118,213,131,1,17,32,43,43,32,31,42,42,0,2,252,197,253,168,0,31,255,165,0,
+34,0,46,0,0,19,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,51,50,22,21,20,6,
+35,39,22,22,51,50,55,51,22,51,50,54,55,37,52,38,35,34,6,21,20,22,51,50,54,
+31,37,96,41,61,110,24,26,118,65,72,131,77,100,87,68,97,96,69,22,23,60,31,
+133,16,122,13,122,23,72,17,253,218,37,26,27,37,37,27,26,37,253,219,26,25,
+55,43,44,54,74,131,80,102,122,98,69,69,97,1,33,16,147,147,12,9,194,26,37,
+37,26,27,37,37,0,1,253,182,253,168,2,123,4,216,0,48,0,0,1,38,35,34,6,21,17,
+16,2,6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,23,7,38,35,34,21,20,51,21,
+34,6,21,20,51,50,62,2,53,17,52,18,51,50,23,2,91,32,34,120,133,111,229,182,
+184,164,65,42,23,111,84,51,65,29,30,49,69,77,162,73,89,229,113,136,75,32,
+232,199,48,42,4,70,6,169,154,253,83,254,248,254,223,139,85,91,61,49,24,44,
+29,62,85,11,5,103,9,47,45,88,27,23,62,41,91,167,200,2,205,226,1,14,8,0,1,
+0,90,255,236,3,246,4,94,0,27,0,0,1,38,38,35,34,6,21,20,22,51,50,54,55,23,
+6,6,35,34,38,2,53,52,54,54,51,50,22,23,3,85,46,139,75,152,173,172,142,104,
+143,25,160,58,215,150,140,231,130,121,222,151,117,211,72,3,71,68,73,222,203,
+195,242,93,89,53,125,142,141,1,3,173,180,255,130,105,98,0,0,2,0,90,255,236,
+7,187,4,94,0,27,0,55,0,0,1,38,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,
+38,2,53,52,54,54,51,50,22,23,5,38,38,35,34,6,21,20,22,51,50,54,55,23,6,6,
+35,34,38,2,53,52,54,54,51,50,22,23,7,26,46,139,75,152,173,172,142,104,143,
+25,160,58,215,150,140,231,130,121,222,151,117,211,72,251,184,46,139,75,152,
+173,172,142,104,143,25,160,58,215,150,140,231,130,121,222,151,117,211,72,
+3,71,68,73,222,203,195,242,93,89,53,125,142,141,1,3,173,180,255,130,105,98,
+76,68,73,222,203,195,242,93,89,53,125,142,141,1,3,173,180,255,130,105,98,
+0,0,1,0,90,255,236,3,246,6,204,0,45,0,0,1,38,38,35,34,6,21,20,22,51,50,54,
+55,23,6,6,35,34,38,2,53,52,18,55,38,38,53,52,54,54,51,50,22,23,7,38,35,34,
+6,21,20,22,23,22,22,23,3,85,46,139,75,152,173,172,142,104,143,25,160,58,215,
+150,140,231,130,137,132,127,127,108,193,125,133,217,71,120,122,191,112,125,
+187,171,94,182,68,3,71,68,73,222,203,195,242,93,89,53,125,142,141,1,3,173,
+192,1,10,61,61,178,111,83,148,87,90,81,93,126,104,83,94,157,50,11,96,92,0,
+1,0,90,255,236,3,246,6,181,0,34,0,0,1,22,4,18,23,7,38,38,35,34,6,21,20,22,
+51,50,54,55,23,6,6,35,34,38,2,53,52,54,54,51,50,23,38,36,39,1,58,175,1,48,
+181,14,135,46,139,75,152,173,172,142,104,143,25,160,58,215,150,140,231,130,
+121,222,151,112,108,65,254,239,194,6,181,52,241,254,187,182,78,68,73,222,
+203,195,242,93,89,53,125,142,141,1,3,173,180,255,130,52,175,247,61,0,0,1,
+0,90,255,236,4,7,6,204,0,38,0,0,1,38,38,35,34,6,21,20,22,51,50,54,55,23,6,
+6,35,34,38,2,53,52,54,54,51,50,23,2,2,35,34,6,7,39,54,51,50,0,19,3,85,46,
+139,75,152,173,172,142,104,143,25,160,58,215,150,140,231,130,121,222,151,
+135,124,23,174,163,78,147,35,133,139,228,245,1,47,26,3,71,68,73,222,203,195,
+242,93,89,53,125,142,141,1,3,173,180,255,130,73,1,38,1,7,77,64,103,176,254,
+91,254,127,0,0,1,252,235,4,216,255,156,6,189,0,12,0,0,1,20,22,23,7,38,39,
+6,7,39,54,54,53,254,138,141,133,42,223,79,78,225,42,133,141,6,189,131,180,
+45,129,70,188,188,70,129,45,179,132,0,0,2,254,12,4,219,255,156,6,89,0,11,
+0,23,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,254,12,114,81,86,119,121,84,81,114,111,51,36,38,53,51,40,36,51,5,154,
+78,113,110,81,80,111,113,77,36,49,49,36,36,51,51,0,1,254,238,4,216,255,126,
+6,124,0,3,0,0,1,17,51,17,254,238,144,4,216,1,164,254,92,0,0,1,254,16,4,206,
+0,200,6,194,0,6,0,0,1,17,51,21,1,23,1,254,16,146,1,220,74,253,107,4,216,1,
+164,212,1,26,101,254,113,0,0,1,253,187,4,211,0,100,6,159,0,5,0,0,19,3,3,39,
+1,1,3,244,243,97,1,84,1,85,4,211,1,1,254,255,99,1,105,254,152,0,0,1,254,129,
+4,216,0,100,6,204,0,14,0,0,19,20,6,6,35,34,38,53,51,20,51,50,53,17,51,100,
+56,108,80,111,128,150,92,97,144,5,194,67,107,60,105,91,68,94,1,22,0,1,254,
+164,4,216,0,108,7,88,0,39,0,0,19,6,6,35,34,38,38,53,53,51,21,22,51,50,54,
+53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,35,34,39,21,20,22,51,50,55,108,
+24,121,78,71,105,57,136,28,39,53,56,49,51,38,57,11,78,22,109,51,112,126,134,
+115,33,30,47,48,73,16,5,111,71,80,57,99,54,178,38,14,48,45,38,47,28,11,89,
+29,47,112,99,101,118,7,17,30,44,49,0,0,1,253,130,4,216,255,136,7,88,0,35,
+0,0,1,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,23,7,38,35,34,21,20,
+30,4,21,20,6,35,34,38,39,254,4,17,70,41,65,57,78,96,175,130,103,85,121,30,
+93,32,113,93,52,77,91,77,52,152,110,84,144,28,5,161,38,35,45,32,32,51,33,
+59,108,65,87,42,30,85,34,39,15,26,28,35,50,70,48,84,122,81,67,0,0,2,254,142,
+4,216,0,113,7,88,0,24,0,36,0,0,1,52,54,54,51,50,22,21,35,52,35,34,21,21,54,
+51,50,22,21,20,6,35,34,38,53,5,52,38,35,34,6,21,20,22,51,50,54,254,142,56,
+108,80,111,128,150,92,97,39,39,77,109,113,81,94,120,1,30,42,31,32,43,43,32,
+31,42,6,110,67,107,60,105,91,68,94,55,13,109,80,79,108,120,95,28,32,43,43,
+32,31,42,42,0,1,253,121,4,216,1,34,7,88,0,43,0,0,3,52,38,35,34,6,21,22,21,
+20,6,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,54,54,51,50,22,22,23,55,
+54,53,53,51,21,20,6,6,35,35,33,73,58,50,72,189,71,127,84,104,137,27,135,11,
+77,47,63,73,113,98,7,152,125,73,111,74,12,9,35,144,69,124,81,49,6,85,60,71,
+42,29,29,176,63,110,63,93,88,43,50,46,58,49,53,62,133,157,55,95,49,7,27,39,
+126,114,60,110,64,0,0,2,254,12,254,40,255,156,255,166,0,11,0,23,0,0,1,52,
+54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,254,12,114,
+81,86,119,121,84,81,114,111,51,36,38,53,51,40,36,51,254,231,78,113,110,81,
+80,111,113,77,36,49,49,36,36,51,51,0,2,0,90,255,236,3,245,4,94,0,14,0,26,
+0,0,1,16,2,35,34,38,2,53,52,18,54,51,50,22,18,5,20,22,51,50,54,53,52,38,35,
+34,6,3,245,251,215,130,210,117,114,212,138,137,209,113,253,23,150,134,137,
+146,148,138,133,148,2,39,254,251,254,202,148,1,7,160,166,1,4,141,141,254,
+254,168,201,232,229,204,206,223,226,0,0,1,0,80,255,236,3,238,4,94,0,27,0,
+0,19,54,54,51,50,22,22,21,20,2,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,
+34,6,7,118,72,212,116,150,219,119,127,229,139,135,220,76,132,34,177,97,140,
+168,169,150,78,141,41,3,147,98,105,130,254,181,173,254,253,141,131,127,75,
+76,119,240,197,205,220,76,65,0,1,254,162,253,198,2,22,4,94,0,15,0,0,1,17,
+16,2,33,34,39,55,22,22,51,50,54,18,17,17,2,22,248,254,243,228,139,133,35,
+147,78,121,139,61,4,94,252,143,254,96,254,121,176,103,64,77,134,1,21,1,61,
+3,35,0,0,1,0,80,253,198,3,227,4,94,0,37,0,0,1,6,35,34,0,3,55,22,22,51,50,
+54,53,52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,2,6,35,34,39,22,22,51,50,
+55,3,202,52,70,225,254,108,139,132,59,140,98,140,168,169,150,78,141,41,131,
+72,212,116,150,219,119,127,229,139,74,89,141,236,123,59,49,253,216,18,1,161,
+1,120,68,96,77,240,197,205,220,76,65,76,98,105,130,254,181,173,254,253,141,
+37,242,207,15,0,1,0,90,253,198,3,237,4,94,0,36,0,0,19,22,51,50,54,55,6,35,
+34,38,2,53,16,0,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,55,23,2,0,35,
+34,39,140,49,59,124,235,141,89,74,140,228,127,1,1,231,117,211,72,131,46,139,
+75,150,169,168,140,97,140,60,132,141,254,109,224,70,52,254,95,15,207,242,
+37,141,1,4,172,1,12,1,41,105,98,76,68,73,219,206,197,240,76,97,68,254,134,
+254,97,18,0,0,2,0,80,253,198,3,206,4,94,0,39,0,51,0,0,23,22,22,51,50,54,54,
+17,53,16,2,38,35,34,6,7,50,22,21,20,6,35,34,38,53,52,54,54,51,50,18,17,21,
+16,2,35,34,38,38,39,19,52,38,35,34,6,21,20,22,51,50,54,241,30,155,97,108,
+120,53,53,120,108,102,137,25,86,115,112,77,81,110,115,199,117,241,222,221,
+236,90,167,126,31,241,42,31,32,43,43,32,31,42,171,115,146,117,254,1,10,138,
+1,7,1,0,118,102,104,109,82,78,111,110,96,148,238,132,254,146,254,117,132,
+254,100,254,129,85,157,115,3,26,31,42,42,31,32,43,43,0,2,0,110,255,236,3,
+246,6,204,0,44,0,56,0,0,1,52,54,51,50,22,21,20,7,22,23,14,2,35,34,2,17,53,
+16,18,51,50,22,22,23,7,38,38,35,34,6,6,17,21,16,18,22,51,50,54,55,39,38,38,
+37,52,38,35,34,6,21,20,22,51,50,54,1,187,114,77,80,109,45,51,185,21,119,199,
+108,236,221,221,236,90,167,126,31,138,30,155,97,108,120,53,53,120,108,94,
+170,18,77,173,150,1,8,42,31,32,43,43,32,31,42,2,154,79,104,107,76,69,54,38,
+31,147,221,126,1,126,1,157,170,1,156,1,127,85,157,115,42,115,146,117,254,
+254,246,210,254,249,255,0,118,155,108,23,46,124,90,31,42,42,31,32,43,43,0,
+2,0,80,253,198,5,160,4,94,0,40,0,52,0,0,1,6,6,35,34,38,2,53,53,16,2,38,35,
+34,6,6,7,50,22,21,20,6,35,34,38,53,52,54,54,51,50,18,17,21,20,18,22,51,50,
+54,55,1,52,38,35,34,6,21,20,22,51,50,54,5,160,72,126,74,118,166,80,53,120,
+108,77,111,68,8,86,115,112,77,81,110,115,202,116,239,222,39,81,74,48,93,30,
+252,29,42,31,32,43,43,32,31,42,254,66,68,56,170,1,62,226,199,1,7,1,0,118,
+55,93,58,109,82,78,111,110,96,149,237,132,254,146,254,117,156,232,254,238,
+127,48,42,3,155,31,42,42,31,32,43,43,0,0,2,0,90,255,212,4,29,4,94,0,31,0,
+43,0,0,19,54,51,50,22,21,20,6,35,34,38,53,52,18,54,51,50,22,18,21,20,2,7,
+39,54,54,53,16,33,34,6,21,23,20,22,51,50,54,53,52,38,35,34,6,246,36,45,85,
+114,114,85,103,134,118,221,143,144,219,118,147,130,69,89,79,254,202,147,172,
+6,42,32,32,45,45,32,32,42,2,33,15,105,79,75,109,186,147,184,1,11,142,141,
+254,245,185,196,254,201,62,108,44,221,192,1,203,215,184,209,31,42,42,31,32,
+43,43,0,2,0,110,253,198,3,246,4,94,0,44,0,56,0,0,5,14,2,35,34,2,17,53,16,
+18,51,50,22,22,23,6,7,22,21,20,6,35,34,38,53,52,54,55,55,38,38,35,34,6,6,
+17,21,16,18,22,51,50,54,55,3,52,38,35,34,6,21,20,22,51,50,54,3,213,30,127,
+167,90,236,221,221,236,108,199,119,21,185,51,45,109,80,78,113,149,174,77,
+18,171,93,108,120,53,53,120,108,96,156,30,136,42,31,32,43,43,32,31,42,213,
+115,157,85,1,126,1,157,98,1,156,1,127,126,221,147,31,38,54,69,76,107,105,
+78,92,124,47,22,108,155,117,254,254,246,138,254,249,255,0,118,145,116,2,93,
+32,43,43,32,31,42,42,0,2,0,90,255,236,3,245,4,94,0,14,0,26,0,0,1,16,2,35,
+34,38,2,53,52,18,54,51,50,22,18,5,20,22,51,50,54,53,52,38,35,34,6,3,245,251,
+215,130,210,117,114,212,138,137,209,113,253,23,150,134,137,146,148,138,133,
+148,2,39,254,251,254,202,148,1,7,160,166,1,4,141,141,254,254,168,201,232,
+229,204,206,223,226,0,0,2,0,90,0,192,5,36,4,94,0,36,0,48,0,0,1,22,21,20,2,
+7,39,55,16,33,34,6,21,21,54,51,50,22,21,20,6,35,34,38,53,52,18,54,51,50,18,
+23,54,54,53,52,39,1,20,22,51,50,54,53,52,38,35,34,6,5,17,19,145,147,151,2,
+254,202,147,172,36,45,85,114,114,85,103,134,118,221,143,203,247,18,51,59,
+15,252,141,42,32,32,45,45,32,32,42,4,86,71,92,163,254,236,99,38,74,1,203,
+215,184,36,15,105,79,75,109,186,147,184,1,11,142,254,241,240,46,178,103,75,
+70,253,61,31,42,42,31,32,43,43,0,2,0,160,255,236,4,7,6,204,0,29,0,41,0,0,
+1,38,38,35,34,6,6,17,17,20,23,54,51,50,22,21,20,6,35,34,38,53,17,16,18,51,
+50,22,22,23,1,20,22,51,50,54,53,52,38,35,34,6,3,125,30,155,97,108,120,53,
+22,31,33,85,114,114,85,126,130,221,236,90,167,126,31,253,78,42,32,32,45,45,
+32,32,42,5,61,115,146,117,254,254,246,254,120,164,72,11,105,79,75,109,242,
+225,1,242,1,156,1,127,85,157,115,251,57,31,42,42,31,32,43,43,0,1,0,80,255,
+236,6,218,6,204,0,62,0,0,19,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,
+38,39,46,3,53,52,54,55,23,6,6,21,20,22,23,22,18,21,20,2,6,35,34,38,39,6,6,
+35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,118,72,212,116,150,219,119,
+40,36,180,96,141,157,129,159,169,157,94,49,37,23,154,14,30,139,183,223,220,
+122,218,135,118,205,70,72,195,108,135,220,76,132,34,177,97,140,168,169,150,
+78,141,41,3,147,98,105,130,254,181,143,106,73,113,242,205,189,197,29,33,71,
+96,131,89,73,206,61,61,57,155,93,114,121,21,27,254,227,243,175,254,246,142,
+96,83,89,90,131,127,75,76,119,240,197,205,220,76,65,0,1,0,100,253,198,4,221,
+4,94,0,65,0,0,1,54,51,50,22,22,21,20,6,7,22,21,20,6,6,35,34,38,39,18,18,51,
+50,54,55,23,14,2,35,32,0,17,17,23,39,52,18,55,23,14,2,21,20,22,22,51,50,54,
+53,52,38,38,35,35,53,62,2,53,52,38,35,34,7,2,159,93,101,114,172,94,84,100,
+184,131,247,164,123,223,87,7,183,191,105,200,27,138,28,131,207,98,254,243,
+254,224,2,2,178,142,71,78,92,43,107,191,117,184,192,61,115,85,25,107,114,
+65,112,111,61,64,4,63,31,74,131,78,85,111,41,75,165,109,174,95,93,90,254,
+202,254,227,154,107,42,105,157,95,1,151,1,132,1,50,3,49,162,1,39,74,109,61,
+126,134,103,134,208,115,120,108,52,83,46,119,2,40,81,66,65,80,18,0,0,1,0,
+90,255,236,4,211,6,204,0,61,0,0,1,20,6,6,7,14,2,21,20,22,22,51,50,54,53,52,
+38,38,35,7,53,50,54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,6,7,22,21,20,
+6,6,35,34,36,2,53,52,54,55,54,54,53,52,38,39,55,22,22,2,113,34,60,84,76,67,
+36,105,191,119,184,192,61,115,85,36,162,135,112,111,63,68,53,100,103,114,
+172,94,84,100,184,133,253,173,173,254,244,145,90,93,99,83,30,14,154,23,37,
+5,120,74,117,102,96,87,121,142,86,141,205,111,120,108,52,83,46,1,120,95,94,
+65,80,20,124,34,74,131,78,85,111,41,75,165,111,172,95,147,1,11,169,123,217,
+107,115,162,87,93,155,57,61,65,204,0,0,1,0,90,255,236,6,101,6,204,0,63,0,
+0,1,38,35,34,6,21,20,22,51,21,39,35,34,6,21,20,51,50,54,55,51,18,51,50,54,
+54,53,17,52,18,51,50,23,7,38,35,34,6,21,17,20,6,6,35,34,38,39,6,35,34,38,
+53,52,54,55,38,38,53,52,54,54,51,50,23,2,114,70,67,111,110,139,158,20,16,
+123,138,190,85,90,13,131,26,136,51,80,47,231,199,48,42,32,32,34,121,131,91,
+159,94,76,125,31,65,190,170,196,96,88,101,83,95,172,113,102,106,3,190,22,
+80,65,93,96,120,1,105,94,210,135,137,254,240,97,187,133,2,197,228,1,12,8,
+138,6,172,151,253,26,164,251,140,65,71,136,192,155,87,140,44,41,113,83,78,
+132,73,36,0,0,1,0,90,255,236,5,15,4,94,0,57,0,0,1,38,35,34,6,21,20,22,51,
+21,39,35,34,6,21,20,51,50,54,55,51,18,51,50,54,54,53,52,38,39,55,22,18,21,
+20,6,6,35,34,38,39,6,35,34,38,53,52,54,55,38,38,53,52,54,54,51,50,23,2,114,
+70,67,111,110,139,158,20,16,123,138,190,85,90,13,131,26,136,51,80,47,106,
+114,81,154,163,94,165,93,76,125,31,65,190,170,196,96,88,101,83,95,172,113,
+102,106,3,190,22,80,65,93,96,120,1,105,94,210,135,137,254,240,97,187,133,
+161,223,75,124,81,254,213,203,164,252,139,65,71,136,192,155,87,140,44,41,
+113,83,78,132,73,36,0,0,2,0,90,253,198,5,161,4,94,0,59,0,69,0,0,5,38,2,53,
+52,54,54,51,50,23,54,51,50,22,22,21,20,2,7,21,23,55,50,22,21,20,6,35,34,38,
+39,6,6,7,39,54,36,55,38,53,53,54,18,53,52,38,35,34,6,7,35,38,38,35,34,6,21,
+20,22,23,1,50,54,53,52,35,34,7,22,22,1,129,141,154,90,159,93,172,69,69,173,
+94,158,90,102,92,1,86,132,159,123,99,110,150,35,138,246,79,48,51,1,14,163,
+4,89,97,85,83,73,87,12,131,12,88,72,83,85,97,89,2,252,35,43,113,46,59,15,
+61,20,101,1,81,195,151,229,125,155,155,125,229,151,157,254,227,102,159,68,
+4,104,83,106,123,123,117,33,99,53,120,47,119,42,46,52,188,74,1,0,161,184,
+206,143,129,130,142,204,186,161,255,75,253,237,41,33,66,8,68,64,0,0,2,0,90,
+255,236,6,213,4,94,0,61,0,73,0,0,37,52,54,51,50,22,21,20,6,35,34,38,2,53,
+52,54,54,51,50,22,22,23,19,22,22,51,50,54,54,53,52,38,35,34,7,39,54,54,51,
+50,22,18,21,20,6,6,35,34,38,38,39,3,38,38,35,34,6,21,20,22,23,38,55,20,22,
+51,50,54,53,52,38,35,34,6,1,184,110,78,85,114,152,127,126,211,121,102,185,
+115,80,137,120,86,200,78,99,54,66,102,57,133,117,122,68,102,48,149,98,112,
+197,116,103,184,115,80,137,120,86,200,78,99,54,105,120,96,86,10,113,42,32,
+32,45,45,32,32,42,191,77,107,105,79,94,117,153,1,15,167,161,250,136,83,146,
+159,254,141,145,96,95,186,130,211,240,97,91,65,79,155,254,239,163,160,251,
+136,83,146,159,1,115,146,95,221,190,177,231,32,27,31,31,42,42,31,32,43,43,
+0,0,5,0,100,255,236,5,88,4,216,0,15,0,20,0,25,0,30,0,35,0,0,19,52,18,36,51,
+50,4,18,21,20,2,4,35,34,36,2,37,38,38,39,17,3,6,6,7,33,5,22,22,23,17,19,54,
+54,55,33,100,174,1,38,166,167,1,37,174,174,254,218,166,167,254,218,173,4,
+94,20,222,157,170,157,223,20,1,144,254,115,26,220,151,170,149,223,24,254,
+116,2,98,173,1,37,164,165,254,221,174,173,254,219,164,165,1,36,233,159,233,
+28,254,92,1,164,28,234,158,140,154,221,26,1,145,254,111,25,222,154,0,4,0,
+100,255,236,5,88,4,216,0,16,0,21,0,26,0,31,0,0,1,33,23,20,2,4,35,34,36,2,
+53,52,18,36,51,50,23,7,6,6,7,33,5,22,22,23,17,19,54,54,55,33,3,51,2,34,3,
+174,254,218,166,167,254,218,173,174,1,38,166,41,44,170,157,223,20,1,144,254,
+115,26,220,151,170,149,223,24,254,116,2,158,60,173,254,219,164,165,1,36,173,
+173,1,37,164,6,144,28,234,158,140,154,221,26,1,145,254,111,25,222,154,0,0,
+1,0,60,255,236,7,216,8,56,0,112,0,0,1,54,55,53,38,39,55,22,22,51,50,54,53,
+39,38,38,39,55,22,22,51,50,54,53,52,38,35,54,54,51,50,22,23,54,53,53,51,21,
+20,6,6,35,35,53,52,38,35,34,6,21,22,21,20,6,7,23,20,6,7,21,55,50,22,22,21,
+20,2,6,35,32,39,6,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,
+54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,38,35,34,6,7,3,212,55,91,152,
+42,135,11,77,47,63,73,5,112,127,23,135,11,77,47,63,73,113,98,7,152,125,97,
+143,30,44,144,69,124,81,49,73,58,50,72,189,81,63,5,117,95,44,127,212,121,
+126,229,146,254,236,148,72,193,101,150,215,58,160,26,143,103,141,173,173,
+152,78,141,41,131,72,212,116,151,222,121,42,38,195,97,151,173,77,137,91,57,
+95,29,3,193,84,38,124,30,144,43,50,46,58,49,29,2,101,78,43,50,46,58,49,53,
+62,133,157,104,94,27,45,126,114,60,110,64,89,60,71,42,29,29,176,66,116,27,
+55,83,130,17,90,2,136,248,171,176,254,247,142,164,83,81,142,125,53,90,92,
+242,195,203,222,76,65,76,98,105,130,254,181,137,113,74,111,240,207,130,187,
+98,54,45,0,0,22,0,50,255,102,6,101,5,134,0,11,0,23,0,35,0,47,0,59,0,71,0,
+83,0,95,0,107,0,119,0,123,0,127,0,131,0,135,0,139,0,143,0,147,0,151,0,155,
+0,159,0,163,0,167,0,0,1,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,
+21,20,6,35,34,38,37,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,
+6,35,34,38,37,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,
+34,38,1,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,
+19,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,21,20,6,35,34,38,3,39,
+55,23,55,39,55,23,1,39,55,23,37,55,23,7,39,55,23,7,23,55,23,7,1,7,39,55,23,
+7,39,55,39,7,39,55,5,23,7,39,7,23,7,39,1,23,7,39,2,251,42,32,32,45,45,32,
+32,42,113,110,78,85,114,114,85,78,110,2,201,42,32,32,45,45,32,32,42,113,110,
+78,85,114,114,85,78,110,251,193,42,32,32,45,45,32,32,42,113,110,78,85,114,
+114,85,78,110,2,201,42,32,32,45,45,32,32,42,113,110,78,85,114,114,85,78,110,
+113,42,32,32,45,45,32,32,42,113,110,78,85,114,114,85,78,110,51,172,62,172,
+41,172,62,172,254,241,172,62,172,1,222,172,62,172,165,172,62,172,147,172,
+62,172,253,228,172,62,172,165,172,62,172,147,172,62,172,2,90,172,62,172,41,
+172,62,172,1,15,172,62,172,2,114,31,42,42,31,32,43,43,28,77,107,105,79,75,
+109,107,73,31,42,42,31,32,43,43,28,77,107,105,79,75,109,107,73,31,42,42,31,
+32,43,43,28,77,107,105,79,75,109,107,2,161,31,42,42,31,32,43,43,28,77,107,
+105,79,75,109,107,251,153,31,42,42,31,32,43,43,28,77,107,105,79,75,109,107,
+3,95,167,65,167,41,167,65,167,254,235,167,65,167,106,167,65,167,171,167,65,
+167,147,167,65,167,254,187,167,65,167,171,167,65,167,147,167,65,167,106,167,
+65,167,41,167,65,167,1,21,167,65,167,0,1,0,100,0,0,5,82,4,216,0,57,0,0,1,
+22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,36,35,34,6,6,21,16,33,
+33,21,33,32,17,52,18,36,51,50,4,22,21,20,6,35,34,38,53,52,54,54,51,50,22,
+21,20,6,35,34,39,2,202,27,83,79,70,103,119,135,127,179,189,191,188,254,232,
+225,144,232,129,2,119,1,123,254,133,253,11,163,1,35,177,177,1,35,163,253,
+252,253,242,98,172,109,184,175,134,142,119,62,2,104,23,69,70,75,71,126,132,
+143,131,187,199,179,216,125,230,152,254,3,111,2,108,185,1,24,155,125,232,
+151,254,244,188,198,114,168,89,129,130,128,125,41,0,0,14,0,100,255,216,5,
+120,4,236,0,31,0,43,0,55,0,59,0,63,0,93,0,125,0,129,0,133,0,163,0,167,0,171,
+0,175,0,179,0,0,1,38,35,34,21,20,22,23,7,38,38,53,52,51,50,23,54,51,50,21,
+20,6,7,39,54,54,53,52,35,34,6,7,3,20,22,51,50,54,53,52,38,35,34,6,7,52,54,
+51,50,22,21,20,6,35,34,38,3,39,55,23,7,39,55,23,3,6,21,20,51,50,54,55,23,
+6,35,34,53,52,55,38,53,52,51,50,23,7,38,38,35,34,21,20,22,23,33,54,54,53,
+52,35,34,6,7,39,54,54,51,50,21,20,7,22,21,20,35,34,38,39,55,22,22,51,50,53,
+52,39,3,55,23,7,23,55,23,7,1,22,22,51,50,53,52,38,39,55,22,21,20,35,34,39,
+6,35,34,53,52,55,23,6,6,21,20,51,50,55,39,7,39,55,39,7,39,55,5,23,7,39,55,
+23,7,39,2,204,10,36,25,32,29,78,39,44,122,42,41,45,38,122,44,39,78,28,33,
+26,11,28,6,108,42,32,32,45,45,32,32,42,113,110,78,85,114,114,85,78,110,97,
+207,62,207,150,207,62,207,159,72,88,54,78,37,61,98,132,197,55,55,197,132,
+98,61,37,78,54,88,28,44,3,170,44,28,88,54,78,37,61,44,123,63,197,55,55,197,
+63,122,45,61,37,78,54,88,72,247,207,62,207,26,207,62,207,254,174,6,28,11,
+26,33,28,78,83,122,38,45,41,42,122,83,78,29,32,25,36,10,188,207,62,207,26,
+207,62,207,2,144,207,62,207,150,207,62,207,4,55,72,88,54,78,37,61,44,123,
+63,197,55,55,197,63,122,45,61,37,78,54,88,28,44,254,39,31,42,42,31,32,43,
+43,28,77,107,105,79,75,109,107,1,120,197,65,197,150,197,65,197,254,199,10,
+36,25,32,29,78,83,122,42,41,45,38,122,83,78,28,33,26,11,28,6,6,28,11,26,33,
+28,78,39,44,122,38,45,41,42,122,44,39,78,29,32,25,36,10,1,142,197,65,197,
+20,197,65,197,253,85,44,28,88,54,78,37,61,98,132,197,55,55,197,132,98,61,
+37,78,54,88,72,105,197,65,197,20,197,65,197,85,197,65,197,150,197,65,197,
+0,0,1,0,100,253,168,4,214,5,184,0,75,0,0,19,39,52,54,36,51,50,4,22,21,20,
+0,35,34,39,38,35,34,6,21,20,22,51,50,55,54,51,50,22,22,21,20,0,33,34,36,38,
+53,55,23,7,21,20,22,51,32,17,52,38,35,34,14,2,35,34,38,53,52,54,51,50,22,
+23,22,51,50,54,53,16,33,34,6,21,21,23,104,4,128,1,3,181,168,1,5,141,254,226,
+236,87,106,107,27,56,55,61,50,27,107,106,87,154,238,130,254,198,255,0,179,
+254,251,128,4,165,1,202,210,1,124,183,178,72,94,75,72,49,118,119,126,111,
+34,57,68,98,105,178,183,254,132,209,203,1,3,204,72,130,189,101,121,223,144,
+210,254,250,30,29,73,63,59,67,30,29,118,216,138,222,254,246,101,190,129,72,
+19,16,17,153,149,1,94,167,167,18,21,17,137,126,129,140,9,19,28,167,167,1,
+94,148,154,16,17,0,1,0,100,253,173,4,242,4,94,0,46,0,0,19,62,2,51,50,23,54,
+51,50,22,22,21,20,7,6,7,6,6,21,20,22,23,7,38,38,53,52,54,54,55,54,54,53,52,
+38,35,34,6,7,35,38,38,35,34,6,7,100,6,93,152,90,172,69,69,173,94,158,90,153,
+41,104,108,71,30,14,154,23,37,62,113,128,101,65,85,83,73,87,12,131,12,88,
+72,78,86,4,2,139,140,212,115,155,155,125,229,151,243,169,45,92,96,127,70,
+93,155,57,61,65,204,71,80,142,136,110,101,151,125,184,206,143,129,130,142,
+183,170,0,1,0,220,0,0,1,134,4,216,0,3,0,0,51,17,51,17,220,170,4,216,251,40,
+0,2,0,220,0,0,2,208,4,216,0,3,0,7,0,0,51,17,51,17,51,17,51,17,220,170,160,
+170,4,216,251,40,4,216,251,40,0,1,0,100,0,0,4,3,4,224,0,22,0,0,33,17,6,35,
+34,38,38,53,52,18,55,23,6,6,21,20,22,51,50,55,17,51,17,3,89,128,158,136,216,
+119,235,185,53,142,153,159,141,205,74,170,1,180,75,102,190,127,178,1,4,30,
+135,23,159,151,125,156,125,2,104,251,40,0,0,2,0,100,0,0,5,47,4,224,0,22,0,
+26,0,0,33,17,6,35,34,38,38,53,52,18,55,23,6,6,21,20,22,51,50,55,17,51,17,
+51,17,51,17,3,89,128,158,136,216,119,235,185,53,142,153,159,141,205,74,170,
+130,170,1,180,75,102,190,127,178,1,4,30,135,23,159,151,125,156,125,1,160,
+251,240,4,216,251,40,0,0,1,0,60,255,236,9,100,6,12,0,81,0,0,19,54,54,51,50,
+22,22,21,20,7,22,51,50,54,53,52,38,38,35,34,6,7,39,54,54,51,50,22,22,21,20,
+7,22,51,50,54,53,52,38,38,35,34,6,7,39,54,54,51,50,22,22,21,20,2,6,35,34,
+39,6,6,35,34,39,6,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,90,72,
+212,116,151,222,121,12,116,124,151,173,77,137,91,57,95,29,130,60,171,103,
+127,212,121,17,102,103,151,173,77,137,91,57,95,29,130,60,171,103,127,212,
+121,126,229,146,149,109,63,229,140,169,121,64,235,141,150,215,58,160,26,143,
+103,141,173,173,152,78,141,41,3,147,98,105,130,254,181,73,63,84,240,207,130,
+187,98,54,45,80,88,69,136,248,171,87,83,60,240,207,130,187,98,54,45,80,88,
+69,136,248,171,176,254,247,142,47,127,135,62,132,145,142,125,53,90,92,242,
+195,203,222,76,65,0,1,0,100,253,198,4,7,4,94,0,53,0,0,37,21,16,2,6,35,34,
+38,2,17,53,52,55,38,38,53,52,54,54,51,50,23,7,38,35,34,6,21,20,22,23,21,35,
+34,6,6,21,21,20,22,22,51,50,54,54,17,53,52,38,38,39,55,22,18,4,7,96,197,166,
+182,198,92,184,101,83,95,172,113,115,111,49,81,77,111,112,132,147,18,86,118,
+63,61,136,105,110,124,55,32,73,63,79,127,132,236,71,254,252,254,190,153,146,
+1,61,1,16,193,165,75,41,113,83,78,132,73,43,124,29,80,65,90,96,3,119,47,84,
+50,201,245,229,103,112,215,1,0,59,152,156,116,41,118,68,254,218,0,0,1,255,
+213,254,240,0,43,5,6,0,3,0,0,19,17,35,17,43,86,5,6,249,234,6,22,0,1,255,33,
+254,240,0,223,5,133,0,14,0,0,19,35,17,7,39,55,39,55,23,55,23,7,23,7,39,43,
+86,127,53,168,168,53,170,170,53,168,168,53,127,254,240,5,88,127,55,168,166,
+55,170,170,55,166,168,55,127,0,0,1,0,147,2,72,1,145,3,94,0,11,0,0,19,52,54,
+51,50,22,21,20,6,35,34,38,147,65,60,62,67,68,61,59,66,2,211,65,74,75,64,64,
+75,74,0,16,0,98,0,86,4,94,4,82,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,
+0,79,0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,
+34,53,52,51,50,19,20,35,34,53,52,51,50,23,20,35,34,53,52,51,50,1,20,35,34,
+53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,
+51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,
+7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,37,20,35,34,53,52,51,50,19,
+20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,3,215,51,55,55,51,147,52,57,
+57,52,247,55,53,55,53,35,51,55,55,51,254,56,54,53,53,54,173,55,53,53,55,2,
+82,55,53,53,55,253,27,55,54,54,55,2,129,51,55,55,51,147,52,57,57,52,253,174,
+52,57,55,54,35,53,56,56,53,1,199,54,53,53,54,254,92,54,55,55,54,247,55,53,
+53,55,147,55,54,54,55,3,150,54,54,55,43,53,53,55,254,211,55,55,53,227,53,
+53,53,1,148,56,56,53,90,53,53,55,253,119,53,53,55,1,185,54,51,58,253,67,53,
+53,56,154,51,51,55,2,29,55,55,53,227,53,53,53,254,4,55,55,54,227,53,53,55,
+254,213,55,51,55,43,53,53,56,0,0,1,0,65,0,225,5,117,4,92,0,59,0,0,1,22,22,
+51,50,62,2,53,52,38,35,34,6,7,22,21,20,6,7,39,54,54,53,16,35,34,17,20,22,
+23,7,38,38,53,52,62,2,51,50,22,23,62,3,51,50,30,2,21,20,14,2,35,34,39,3,137,
+31,59,29,50,79,56,29,112,101,81,97,8,9,135,129,54,73,86,232,233,86,73,54,
+134,130,60,105,143,84,93,144,59,19,61,73,79,37,84,138,99,54,54,97,135,81,
+102,97,1,132,18,16,47,85,121,74,146,160,122,104,45,54,143,222,69,125,31,160,
+135,1,52,254,204,135,160,31,125,71,230,144,98,163,117,65,70,78,31,54,40,23,
+58,111,160,103,108,170,119,62,55,0,2,0,58,0,200,3,5,4,92,0,44,0,56,0,0,37,
+38,38,39,6,35,34,46,2,53,52,62,2,51,50,23,54,53,52,38,35,34,14,2,7,39,62,
+3,51,50,30,2,21,20,6,7,22,22,23,1,34,6,21,20,22,51,50,54,55,38,38,2,118,3,
+8,5,103,136,67,107,76,41,39,72,100,61,147,102,9,124,124,28,55,50,44,16,115,
+24,70,84,95,50,90,145,102,55,29,31,22,28,8,254,115,71,68,71,76,57,89,28,33,
+95,200,35,60,24,94,31,56,75,44,49,86,62,36,81,52,60,141,151,16,29,41,26,68,
+39,64,45,25,60,109,152,92,70,126,60,45,108,67,1,53,52,42,42,46,47,45,42,48,
+0,0,2,0,62,0,200,3,5,6,54,0,55,0,67,0,0,37,38,38,39,6,35,34,46,2,53,52,62,
+2,51,50,23,54,53,52,38,35,34,6,7,39,16,33,50,23,7,46,3,35,34,14,2,7,54,54,
+51,50,30,2,21,20,6,7,22,22,23,1,34,6,21,20,22,51,50,54,55,38,38,2,118,3,8,
+5,103,136,67,107,76,41,39,72,100,61,147,102,9,123,125,52,83,14,155,1,132,
+179,118,122,14,43,52,58,27,59,79,48,22,3,41,88,54,82,136,98,54,29,31,22,28,
+8,254,115,71,68,71,76,57,89,28,33,95,200,35,60,24,94,31,56,75,44,49,86,62,
+36,81,52,60,141,151,57,49,14,2,183,148,95,25,42,31,17,37,90,150,112,23,20,
+62,109,152,90,70,126,60,45,108,67,1,53,52,42,42,46,47,45,42,48,0,0,1,0,62,
+0,228,3,107,4,92,0,29,0,0,37,38,38,53,52,62,2,51,50,30,2,21,20,6,7,39,54,
+54,53,52,38,35,34,6,21,20,22,23,1,70,133,131,63,110,149,85,83,147,111,65,
+135,129,54,73,86,126,121,121,127,86,73,228,71,230,143,96,163,118,67,68,120,
+167,99,143,222,69,125,31,160,135,148,160,160,148,135,160,31,0,0,1,0,62,0,
+228,3,92,6,54,0,53,0,0,37,38,2,53,53,52,18,54,54,51,50,23,7,46,3,35,34,14,
+2,7,54,54,51,50,30,2,21,20,14,2,7,39,54,54,53,52,38,35,34,14,2,21,21,20,30,
+2,23,1,78,138,134,63,117,167,103,178,119,123,14,43,52,58,27,60,91,64,39,9,
+51,115,63,89,148,106,59,36,68,98,62,54,74,85,130,123,49,83,61,34,16,38,63,
+47,229,66,1,4,209,134,158,1,0,180,98,149,94,25,42,31,17,45,100,160,115,36,
+38,64,118,165,100,70,131,114,93,33,130,31,156,134,152,156,31,51,67,37,61,
+79,120,92,67,25,0,1,0,44,0,225,6,44,4,96,0,106,0,0,1,54,54,51,50,30,2,21,
+20,14,2,35,34,39,6,6,35,34,38,39,6,6,35,34,46,2,53,52,54,55,54,54,53,52,35,
+34,6,21,20,22,51,55,7,7,34,46,2,53,52,62,2,51,50,30,2,21,20,6,7,6,6,21,20,
+30,2,51,50,55,51,22,22,51,50,54,53,52,38,39,55,22,22,21,20,7,30,3,51,50,62,
+2,53,52,38,35,34,6,7,3,184,53,136,83,77,130,95,54,59,103,142,83,189,114,32,
+100,55,61,83,25,26,80,63,56,96,70,40,61,54,52,54,94,23,26,17,12,21,9,33,29,
+53,40,23,29,51,68,39,57,91,63,34,55,54,55,50,19,30,38,19,86,20,121,9,51,45,
+54,61,81,90,74,126,130,21,15,54,65,72,33,54,85,59,30,115,99,41,70,23,3,214,
+75,59,62,115,165,103,103,165,116,62,111,49,62,42,48,48,42,39,69,96,58,49,
+99,52,49,97,49,112,19,16,12,24,1,121,2,25,41,54,29,36,61,44,25,34,60,82,47,
+60,107,55,56,81,40,33,52,36,19,207,106,101,162,144,120,167,58,115,66,234,
+160,102,75,27,47,35,20,45,85,122,77,145,159,43,36,0,1,0,62,0,221,3,166,4,
+92,0,64,0,0,1,14,3,35,34,46,2,53,52,62,2,55,38,38,53,52,62,2,51,50,30,2,21,
+20,14,2,7,39,62,3,53,52,46,2,35,34,14,2,21,20,22,23,21,6,6,21,20,22,51,50,
+62,2,55,2,93,18,63,71,71,28,66,107,77,42,21,37,51,30,64,75,61,107,143,83,
+109,177,125,67,12,22,29,16,127,14,18,11,4,44,83,120,77,54,86,58,31,112,103,
+103,112,79,66,19,50,51,47,15,1,29,12,22,16,10,37,67,97,60,26,53,50,44,18,
+29,98,57,58,94,67,36,71,128,178,107,53,115,109,98,36,57,51,81,79,85,55,84,
+133,92,49,20,35,47,26,53,70,11,95,9,75,60,64,68,7,12,17,11,0,2,0,62,0,225,
+3,110,4,92,0,25,0,48,0,0,1,20,14,2,35,34,38,53,52,62,2,55,38,38,53,52,62,
+2,51,50,30,2,5,6,6,21,20,22,51,50,62,2,53,52,46,2,35,34,6,21,20,22,23,3,110,
+60,111,158,98,186,203,21,37,51,30,64,75,57,101,139,82,103,162,113,59,254,
+70,103,112,118,115,61,99,69,37,39,73,106,66,100,115,113,102,2,167,98,166,
+122,68,136,125,26,53,50,44,18,29,98,57,60,95,66,34,65,116,161,144,9,75,60,
+71,61,48,86,120,71,73,115,79,41,66,62,53,70,11,0,0,2,0,61,0,225,5,90,4,92,
+0,73,0,85,0,0,1,54,54,51,50,30,2,21,20,14,2,35,34,38,39,6,6,35,34,46,2,53,
+52,62,2,51,50,22,23,54,53,52,38,35,34,14,2,7,39,62,3,51,50,30,2,21,20,7,30,
+3,51,50,62,2,53,52,46,2,35,34,6,7,1,34,6,21,20,22,51,50,54,55,38,38,2,225,
+53,136,82,78,133,97,54,59,105,144,85,100,161,65,56,134,82,67,108,76,41,39,
+72,100,61,76,122,51,9,123,124,28,55,51,44,16,115,25,70,84,94,50,90,145,102,
+55,49,19,56,66,72,37,55,87,60,32,32,58,82,49,40,70,24,254,34,71,68,71,75,
+57,89,28,34,94,3,214,75,59,62,116,165,102,102,164,117,63,62,67,67,62,31,56,
+75,44,49,86,62,36,37,43,52,59,141,151,16,29,41,26,68,39,64,45,25,60,109,152,
+92,125,107,25,43,31,18,47,85,122,75,72,113,78,41,43,36,254,140,52,42,42,46,
+47,45,42,48,0,0,1,0,62,0,221,3,48,4,92,0,49,0,0,1,54,54,53,52,39,53,54,54,
+53,52,46,2,35,34,6,21,20,30,2,23,7,46,3,53,52,62,2,51,50,30,2,21,20,6,7,22,
+22,21,20,14,2,7,1,233,78,90,215,101,114,27,51,71,45,125,117,22,40,59,37,53,
+65,99,66,34,55,104,151,95,75,128,93,53,74,64,66,72,45,78,105,60,1,93,8,77,
+58,118,20,95,11,70,53,26,46,35,21,155,173,54,100,83,61,16,124,29,91,116,134,
+73,99,166,120,67,40,69,93,53,57,97,29,36,100,49,53,94,72,46,4,0,1,0,62,0,
+221,3,48,6,54,0,64,0,0,1,54,54,53,52,39,53,54,54,53,52,46,2,35,34,6,21,20,
+30,2,23,7,38,38,39,53,52,18,54,54,51,50,23,7,46,3,35,34,14,2,7,54,54,51,50,
+30,2,21,20,6,7,22,22,21,20,14,2,7,1,233,78,90,215,101,114,27,51,71,45,125,
+117,22,40,59,37,53,121,137,6,63,117,167,103,179,117,122,14,43,52,58,27,60,
+91,64,39,9,48,119,71,75,128,93,53,74,64,66,72,45,78,105,60,1,93,8,77,58,118,
+20,95,11,70,53,26,46,35,21,155,173,54,100,83,61,16,124,54,220,150,253,158,
+1,0,180,98,149,94,25,42,31,17,45,100,159,113,35,36,40,69,93,53,57,97,29,36,
+100,49,53,94,72,46,4,0,2,0,66,0,225,5,201,5,219,0,70,0,93,0,0,1,20,7,30,3,
+51,50,62,2,53,52,38,39,38,38,39,46,3,53,52,62,2,55,23,6,21,20,30,2,23,23,
+22,22,21,20,14,2,35,34,38,39,6,35,34,38,53,52,62,2,55,38,38,53,52,62,2,51,
+50,30,2,5,6,6,21,20,22,51,50,62,2,53,52,46,2,35,34,6,21,20,22,23,3,114,33,
+16,54,66,73,34,55,85,59,31,103,115,22,44,23,86,122,78,37,7,10,14,8,136,23,
+18,47,82,64,71,181,174,59,103,142,84,105,168,58,114,193,187,202,21,36,51,
+30,64,74,57,101,139,82,103,162,112,60,254,70,103,112,117,115,62,98,69,37,
+39,73,105,66,100,115,112,103,2,167,90,97,27,50,38,23,47,85,122,75,134,147,
+23,4,9,3,14,47,68,91,58,12,55,64,65,22,54,92,92,31,45,32,21,7,9,29,228,190,
+103,164,115,62,65,61,126,136,125,26,53,50,44,18,29,98,57,60,95,66,34,65,116,
+161,144,9,75,60,71,61,48,86,120,71,73,115,79,41,66,62,53,70,11,0,0,1,0,51,
+255,88,5,92,4,92,0,82,0,0,5,46,3,53,53,23,21,30,3,51,50,62,2,53,52,38,35,
+34,6,7,39,54,54,51,50,30,2,21,20,6,7,30,3,51,50,62,2,53,52,46,2,35,34,6,7,
+39,54,54,51,50,30,2,21,20,14,2,35,34,38,39,6,6,35,34,38,39,20,30,2,23,1,70,
+67,102,70,36,150,10,39,51,56,26,51,84,60,33,125,111,57,106,32,121,60,171,
+91,89,144,101,55,16,15,12,52,66,74,35,55,87,61,32,32,58,82,49,41,70,23,120,
+53,137,82,77,133,97,55,59,105,144,85,101,165,59,58,137,82,45,98,40,16,30,
+40,24,168,2,60,134,215,157,110,25,15,24,42,31,19,47,86,117,71,150,162,60,
+52,72,81,88,58,112,165,108,52,98,39,26,47,36,21,47,85,122,75,72,113,78,41,
+43,36,74,75,59,62,115,163,102,102,166,117,64,60,59,61,58,26,32,79,116,78,
+43,6,0,0,1,0,63,0,225,3,237,4,96,0,64,0,0,1,38,38,35,34,6,21,20,22,51,21,
+39,34,6,21,20,51,50,54,55,51,22,51,50,62,2,53,52,38,39,55,22,22,21,20,14,
+2,35,34,38,39,6,6,35,34,46,2,53,52,54,55,38,38,53,52,62,2,51,50,22,23,1,234,
+29,56,27,78,78,106,121,39,89,99,133,60,63,10,121,19,93,27,46,33,19,82,90,
+74,131,126,47,78,101,54,57,93,28,28,93,72,68,107,76,40,64,61,72,53,43,80,
+111,68,40,86,48,3,200,9,10,54,45,65,67,115,1,74,66,148,101,106,207,41,78,
+114,73,120,167,58,115,69,239,166,94,155,111,61,42,48,50,40,40,72,102,62,65,
+105,35,32,87,63,48,84,61,35,16,16,0,0,1,0,63,255,62,3,237,4,96,0,100,0,0,
+37,38,35,34,6,21,20,30,2,51,51,50,62,2,53,53,6,6,35,34,38,39,6,6,35,34,46,
+2,53,52,54,55,38,38,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,51,21,
+39,34,6,21,20,51,50,54,55,51,22,51,50,62,2,53,52,38,39,55,22,22,21,17,20,
+14,2,35,35,34,46,2,53,52,62,2,51,50,22,23,1,162,17,25,26,29,19,42,69,50,141,
+58,80,49,22,29,62,35,57,93,28,28,93,72,68,107,76,40,64,61,72,53,43,80,111,
+68,40,86,48,49,29,56,27,78,78,106,121,39,89,99,133,60,63,10,121,19,93,27,
+46,33,19,82,90,74,125,132,49,91,128,79,207,59,97,69,38,27,49,69,43,41,77,
+26,40,26,33,29,18,26,17,8,29,67,107,78,53,23,21,42,48,50,40,40,72,102,62,
+65,105,35,32,87,63,48,84,61,35,16,16,116,9,10,54,45,65,67,115,1,74,66,148,
+101,106,207,41,78,114,73,120,167,58,115,66,234,160,254,82,98,157,110,59,28,
+51,74,45,40,68,49,27,43,36,0,1,0,42,255,178,3,22,4,92,0,40,0,0,19,54,51,50,
+62,2,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,20,6,7,30,3,23,39,46,3,35,
+34,7,42,123,172,63,101,70,37,33,61,88,55,56,106,32,121,60,171,91,87,143,102,
+57,100,94,47,76,56,34,4,149,5,47,79,108,67,124,91,1,41,95,42,78,110,68,69,
+111,76,41,60,52,72,81,88,58,109,159,101,115,186,58,29,84,105,123,67,9,74,
+122,88,48,60,0,0,1,0,40,0,225,3,202,4,96,0,75,0,0,19,35,34,46,2,53,52,62,
+2,51,50,30,2,21,20,6,7,6,6,21,20,30,2,51,50,55,51,22,22,51,50,54,53,52,38,
+39,55,22,22,21,20,14,2,35,34,38,39,6,6,35,34,46,2,53,52,54,55,54,54,53,52,
+35,34,6,21,20,22,51,55,7,197,11,30,53,40,23,29,51,69,39,57,91,63,34,56,54,
+55,49,19,30,37,19,86,20,121,10,51,45,54,60,81,90,74,131,125,44,74,98,54,62,
+82,25,27,79,63,56,96,70,40,60,55,51,54,93,23,26,17,11,22,9,3,33,25,41,54,
+29,36,61,44,25,34,60,82,47,60,107,55,56,81,40,33,52,36,19,207,106,101,161,
+145,120,167,58,115,69,238,165,95,155,112,61,42,48,48,42,39,69,96,58,49,100,
+51,50,96,49,112,19,16,12,24,1,119,0,0,1,0,67,0,225,6,119,4,92,0,95,0,0,37,
+7,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,7,6,6,21,20,51,50,54,53,52,39,
+46,3,53,52,62,2,51,50,30,2,21,20,14,2,35,39,55,23,50,54,53,52,38,35,34,6,
+21,20,22,23,22,22,21,20,14,2,35,34,46,2,53,52,54,55,54,54,53,52,38,35,34,
+6,21,20,22,51,55,1,242,69,78,133,97,54,58,104,143,85,79,134,98,54,7,11,12,
+5,5,5,84,40,45,11,5,12,10,7,57,100,136,78,87,141,100,55,56,97,133,76,68,17,
+36,110,108,111,113,108,111,18,9,6,9,32,60,87,56,53,86,61,33,9,6,10,18,113,
+106,114,111,110,109,35,230,5,63,117,168,105,100,162,114,62,65,114,156,90,
+20,55,60,58,22,20,27,2,73,40,33,7,50,24,60,60,54,20,90,152,110,62,65,118,
+164,100,102,165,115,62,5,125,1,165,160,158,150,150,143,65,92,35,23,40,22,
+41,71,51,29,28,51,71,42,22,40,23,35,92,65,144,149,147,161,161,164,1,0,2,0,
+65,0,225,5,65,4,92,0,50,0,66,0,0,1,22,22,51,50,62,2,53,52,38,35,34,6,7,22,
+22,21,20,14,2,35,34,46,2,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,14,
+2,35,34,39,1,20,30,2,51,50,62,2,53,52,38,35,34,6,3,83,32,58,29,50,80,56,30,
+113,100,78,100,12,5,4,52,98,138,86,79,130,93,51,53,97,134,81,89,136,51,45,
+145,82,81,135,97,54,53,97,136,83,104,95,253,215,27,52,76,50,49,76,52,27,107,
+100,97,105,1,132,18,16,47,85,121,74,145,161,111,97,25,55,27,104,165,116,62,
+72,123,166,94,97,160,115,64,67,71,64,74,59,111,157,99,108,172,120,65,55,1,
+136,73,118,82,45,43,82,118,75,152,163,165,0,1,0,63,0,222,4,44,4,92,0,63,0,
+0,37,54,54,53,52,46,2,35,34,6,21,20,22,51,21,35,34,6,21,20,22,51,50,54,55,
+51,22,22,51,50,54,55,23,6,35,34,39,6,6,35,34,46,2,53,52,54,55,38,38,53,52,
+62,2,51,50,22,22,18,21,20,7,3,127,9,10,54,107,157,103,131,141,122,106,41,
+88,99,49,47,52,50,13,110,12,45,48,33,49,6,132,39,179,106,57,30,87,60,53,90,
+66,37,64,61,65,60,41,101,171,131,136,209,142,74,15,222,35,88,55,153,222,144,
+68,61,60,59,66,115,72,67,65,68,74,81,82,73,63,70,34,228,88,47,41,44,72,94,
+51,64,107,35,28,86,60,37,87,75,51,98,185,254,247,167,84,73,0,1,0,63,0,225,
+3,191,4,92,0,58,0,0,1,54,51,50,30,2,21,20,6,7,22,22,21,20,14,2,35,34,46,2,
+53,52,62,2,55,23,14,3,21,20,30,2,51,50,54,53,52,38,35,7,53,50,54,55,54,54,
+53,52,38,35,34,7,1,215,97,90,68,111,79,43,57,66,64,59,63,114,159,96,104,171,
+122,67,38,69,95,57,66,49,64,38,15,47,83,111,64,135,139,96,91,57,83,89,24,
+23,25,78,80,59,68,4,54,38,35,62,83,48,63,86,32,32,92,64,66,109,77,42,70,124,
+171,102,62,125,112,92,29,102,37,73,79,88,52,72,121,86,48,85,77,54,72,2,116,
+18,16,17,48,33,45,54,25,0,0,2,0,62,0,225,3,175,4,92,0,23,0,41,0,0,37,34,39,
+6,35,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,3,22,22,51,50,54,53,52,38,35,
+34,6,21,20,22,51,50,55,2,168,122,53,56,125,57,96,70,39,63,114,159,96,104,
+167,116,62,43,72,95,171,11,59,45,54,53,141,138,141,142,55,53,92,27,225,102,
+102,61,113,160,98,96,167,124,72,69,128,179,111,90,148,107,59,1,48,83,92,153,
+140,165,175,172,168,141,152,175,0,0,1,0,62,255,63,3,175,4,92,0,37,0,0,1,38,
+38,35,34,14,2,21,20,30,2,23,23,30,3,23,7,38,38,39,39,46,3,53,52,62,2,51,50,
+22,23,2,161,37,104,60,58,93,64,35,31,55,75,44,57,98,139,104,79,39,150,47,
+150,112,44,100,143,92,43,62,110,150,87,94,169,60,3,107,56,56,46,83,114,69,
+60,100,78,51,10,9,17,63,117,183,137,43,201,206,20,6,16,71,110,150,96,93,158,
+116,66,88,81,0,0,1,0,62,0,225,3,107,4,89,0,29,0,0,1,6,6,21,20,22,51,50,54,
+53,52,38,39,55,22,22,21,20,14,2,35,34,46,2,53,52,54,55,1,124,73,86,127,121,
+121,126,86,73,54,132,132,63,108,145,82,89,152,111,63,135,129,3,221,31,161,
+135,149,159,160,148,135,161,31,124,72,225,149,90,161,121,70,66,120,167,101,
+139,226,69,0,1,0,64,0,225,4,132,6,54,0,42,0,0,1,38,35,34,14,2,21,20,14,2,
+35,34,46,2,53,52,62,2,55,23,6,6,21,20,22,51,50,62,2,53,53,52,62,2,51,50,23,
+4,69,41,36,38,50,29,12,52,107,163,111,80,142,106,62,36,68,99,63,50,81,76,
+126,117,76,101,60,25,48,84,115,66,40,75,5,167,15,55,133,226,171,170,246,160,
+76,68,118,156,89,73,137,119,96,32,123,40,159,125,151,161,51,111,178,126,157,
+141,226,160,86,26,0,2,0,63,0,225,4,12,4,92,0,76,0,88,0,0,1,34,38,39,6,6,35,
+34,38,39,6,6,35,34,46,2,53,52,54,55,38,38,53,52,62,2,51,50,22,23,7,38,38,
+35,34,6,21,20,22,51,21,39,34,6,21,20,51,50,54,55,51,22,51,50,54,55,46,3,53,
+52,62,2,51,50,30,2,21,20,7,22,51,39,52,46,2,39,6,21,20,22,23,54,4,4,28,50,
+21,41,105,57,57,94,27,28,94,72,68,107,76,40,64,61,72,53,43,80,111,68,40,86,
+48,49,29,56,26,79,78,106,121,39,88,100,133,60,63,10,121,19,94,24,46,18,44,
+72,52,28,31,50,65,35,42,81,65,40,37,21,29,159,13,23,33,19,32,52,50,18,1,90,
+5,6,63,69,42,48,50,40,40,72,102,62,65,105,35,32,87,63,48,84,61,35,16,16,116,
+9,10,54,45,65,67,115,1,74,66,148,101,106,207,31,27,31,85,100,112,59,63,115,
+87,52,57,103,146,89,127,114,3,235,46,89,74,53,11,63,132,76,131,45,85,0,0,
+1,0,63,0,225,3,254,6,54,0,93,0,0,1,38,35,34,21,20,22,51,21,35,34,6,21,20,
+22,51,50,54,55,51,22,22,51,50,62,2,53,52,46,2,39,39,46,3,53,52,62,2,51,50,
+22,23,7,46,3,35,34,6,21,20,22,23,23,30,3,21,20,14,2,35,34,38,39,6,6,35,34,
+46,2,53,52,54,55,38,38,53,52,62,2,51,50,23,1,216,53,40,157,124,103,39,89,
+99,62,71,60,63,10,121,10,57,49,33,55,41,23,27,54,82,55,84,82,108,64,26,52,
+88,119,67,107,174,60,111,23,47,54,64,40,78,92,74,83,98,87,120,74,33,49,82,
+107,59,57,93,27,29,93,72,68,108,75,40,64,62,62,64,41,78,112,71,68,81,3,151,
+15,92,47,54,115,68,64,72,68,101,106,108,99,54,96,131,77,76,116,85,56,18,25,
+21,49,62,78,50,46,87,68,41,74,69,86,27,38,24,12,67,57,51,64,22,27,24,77,114,
+153,99,101,175,131,75,42,48,50,40,38,71,99,60,63,99,37,29,81,51,46,76,56,
+31,23,0,0,1,0,63,0,219,3,207,4,92,0,45,0,0,37,46,3,53,52,62,2,51,50,23,54,
+54,51,50,30,2,21,20,14,2,7,39,54,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,
+20,22,23,1,46,59,90,60,30,44,75,98,55,127,57,29,94,66,56,98,72,41,32,61,90,
+57,64,70,76,59,57,51,61,9,122,8,61,51,58,58,76,69,220,43,112,132,146,77,87,
+143,101,55,104,55,49,58,104,147,88,75,144,129,111,41,111,58,193,121,135,150,
+107,100,100,107,149,136,121,192,59,0,0,1,0,63,0,219,3,207,6,54,0,61,0,0,19,
+52,18,54,54,51,50,23,7,46,3,35,34,14,2,7,54,51,50,23,54,54,51,50,30,2,21,
+20,14,2,7,39,54,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,23,7,46,3,
+53,63,63,117,167,103,179,117,122,14,43,52,58,27,58,88,63,40,10,45,56,127,
+57,29,94,66,56,98,72,41,32,61,90,57,64,70,76,59,57,51,61,9,122,8,61,51,58,
+58,76,69,65,57,89,61,32,3,130,158,1,0,180,98,149,94,25,42,31,17,41,89,141,
+101,26,104,55,49,58,104,147,88,75,144,129,111,41,111,58,193,121,135,150,107,
+100,100,107,149,136,121,192,59,111,42,110,130,143,75,0,1,0,37,0,225,5,42,
+4,92,0,65,0,0,19,54,54,51,50,22,23,62,3,51,50,30,2,21,20,14,2,35,34,39,55,
+22,22,51,50,62,2,53,52,38,35,34,14,2,7,22,21,20,14,2,35,34,38,39,55,22,22,
+51,50,62,2,53,52,38,35,34,6,7,59,60,171,91,97,153,49,24,63,73,78,38,82,135,
+96,53,53,96,136,83,102,97,75,31,58,29,50,80,55,30,112,101,38,64,48,31,5,6,
+62,108,143,81,119,172,48,148,20,103,75,51,84,60,33,125,112,56,106,32,3,179,
+81,88,75,72,31,54,40,22,59,111,157,99,108,172,120,65,55,108,18,16,46,86,121,
+74,146,160,34,59,81,47,45,59,99,162,114,62,117,106,47,69,72,47,86,117,71,
+150,162,60,52,0,0,1,0,62,0,174,3,107,4,89,0,45,0,0,37,38,38,39,6,6,35,34,
+46,2,53,52,54,55,23,6,6,21,20,22,51,50,55,38,39,55,22,22,23,54,54,53,52,38,
+39,55,22,22,21,20,6,7,22,22,23,2,218,3,16,12,53,117,68,86,147,106,60,135,
+129,54,73,86,127,121,102,60,61,89,19,57,101,43,8,7,86,73,54,128,136,34,37,
+28,31,8,174,32,65,30,41,35,71,123,165,95,139,226,69,124,31,161,135,149,159,
+56,67,15,127,7,43,35,29,65,34,135,161,31,124,69,222,143,75,129,60,48,102,
+56,0,1,0,66,0,225,5,195,4,92,0,67,0,0,1,54,54,51,50,30,2,21,20,14,2,35,34,
+38,39,6,6,35,34,46,2,53,52,54,55,23,6,6,21,20,22,51,50,54,53,52,38,39,55,
+22,22,21,20,14,2,7,30,3,51,50,62,2,53,52,46,2,35,34,6,7,3,73,53,137,81,78,
+133,97,55,60,105,144,85,103,167,56,56,147,88,86,146,106,60,134,129,54,73,
+85,126,121,121,126,85,73,54,128,136,3,8,15,12,14,52,65,74,35,55,87,60,32,
+32,58,82,49,40,70,23,3,214,75,59,62,116,165,102,102,164,117,63,63,59,58,64,
+71,123,165,95,139,226,69,124,31,161,135,149,159,160,148,135,161,31,124,69,
+222,143,23,41,44,53,34,26,47,36,21,47,85,122,75,72,113,78,41,43,36,0,1,0,
+64,0,225,4,109,6,54,0,65,0,0,1,38,35,34,14,2,21,20,14,2,35,34,46,2,53,52,
+54,55,38,53,52,62,2,51,50,30,2,23,7,46,3,35,34,6,21,30,3,51,21,39,34,6,21,
+20,22,51,50,54,53,53,52,62,2,51,50,23,4,46,41,35,39,51,28,11,59,119,179,119,
+72,120,85,48,65,59,124,43,80,111,68,32,68,66,60,24,65,17,43,46,46,20,78,80,
+2,25,57,92,69,57,89,99,93,91,156,145,48,83,114,66,41,75,5,167,15,57,136,225,
+167,167,246,161,78,40,73,101,62,65,107,33,64,118,48,84,61,35,10,19,27,16,
+108,12,18,14,7,53,45,35,50,32,16,116,2,70,64,73,81,232,234,157,141,226,160,
+86,26,0,0,1,0,63,0,221,3,189,4,92,0,70,0,0,1,52,38,35,34,14,2,21,20,30,2,
+23,30,3,21,20,14,2,35,34,46,2,53,52,55,23,6,21,20,22,51,50,62,2,53,52,46,
+2,39,38,38,39,38,38,53,52,62,2,51,50,30,2,21,20,6,7,39,62,3,3,29,182,174,
+39,66,47,27,13,32,51,39,93,122,71,29,51,87,117,66,71,121,87,49,48,125,22,
+94,81,37,60,44,24,25,53,83,57,56,76,18,40,42,54,95,131,77,114,183,129,70,
+40,38,127,14,17,10,4,2,94,186,195,10,19,27,18,9,16,19,22,14,33,66,72,81,48,
+63,112,84,49,45,81,113,68,77,69,75,40,34,80,95,26,47,65,39,33,51,43,41,22,
+20,34,11,26,58,43,42,73,56,32,68,128,185,116,103,205,90,57,54,87,77,72,0,
+1,0,62,255,47,3,195,4,92,0,77,0,0,5,38,39,6,6,35,35,34,46,2,53,52,62,2,51,
+50,22,23,7,38,35,34,6,21,20,30,2,51,51,50,54,55,38,39,55,22,22,23,54,53,17,
+52,38,35,34,6,7,35,38,38,35,34,6,7,39,62,3,51,50,23,54,51,50,30,2,21,17,20,
+7,22,22,23,3,22,12,9,34,79,40,253,59,97,69,38,27,49,69,42,42,78,25,103,16,
+26,25,28,18,42,69,50,187,29,46,21,59,72,18,60,102,45,20,59,58,51,61,8,122,
+9,61,51,53,59,4,152,4,43,71,93,54,128,56,56,130,56,97,72,41,84,13,22,9,209,
+31,20,17,19,28,51,74,45,40,68,49,27,43,36,69,26,33,29,18,26,17,8,6,8,53,13,
+126,8,45,41,60,109,1,230,137,148,107,100,100,107,136,133,23,85,138,98,54,
+103,103,57,105,146,89,254,23,183,112,23,52,29,0,1,0,65,0,225,5,73,4,92,0,
+71,0,0,1,6,6,35,34,46,2,53,52,62,2,51,50,30,2,23,19,30,3,51,50,54,53,52,46,
+2,35,34,7,39,54,54,51,50,30,2,21,20,14,2,35,34,46,2,39,3,46,3,35,34,14,2,
+21,20,30,2,51,50,55,2,129,42,120,78,68,122,92,54,49,85,116,68,49,87,81,77,
+40,152,28,45,38,35,19,71,88,24,46,66,42,87,56,95,42,124,81,69,120,89,51,49,
+86,116,67,51,86,79,76,41,152,29,46,38,35,18,37,59,42,22,25,46,66,42,87,56,
+1,93,56,68,71,125,172,102,94,156,110,61,40,78,112,72,254,230,52,68,41,17,
+156,146,78,122,86,45,79,85,58,65,76,130,172,95,93,154,110,61,38,75,113,76,
+1,26,52,69,41,16,42,78,111,70,78,123,86,45,80,0,0,1,0,15,255,47,3,9,4,92,
+0,86,0,0,5,38,38,39,6,6,35,35,34,46,2,53,52,62,2,51,50,22,23,7,38,35,34,6,
+21,20,30,2,51,51,50,54,55,38,38,39,55,22,23,54,53,52,46,2,35,34,6,7,39,54,
+51,50,62,2,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,20,6,7,22,22,21,20,
+7,22,23,2,132,5,11,7,38,83,48,174,59,96,70,38,27,50,69,42,42,77,26,103,17,
+25,25,29,19,42,68,50,97,37,58,23,25,61,37,15,106,81,1,37,69,99,62,69,125,
+42,78,123,172,63,101,69,37,32,61,88,55,56,106,32,122,61,171,91,86,143,103,
+57,98,81,88,93,41,28,21,209,14,27,14,21,19,28,51,74,45,40,68,49,27,43,36,
+69,26,33,29,18,26,17,8,9,11,23,30,7,127,14,61,14,12,40,63,44,23,31,29,94,
+95,42,78,110,68,69,111,76,41,60,52,72,81,88,58,109,159,101,110,180,59,40,
+130,82,84,62,48,63,0,0,2,0,62,0,225,3,21,4,92,0,19,0,33,0,0,1,20,14,2,35,
+34,46,2,53,52,62,2,51,50,30,2,5,20,30,2,51,50,54,53,52,38,35,34,6,3,21,53,
+97,139,86,78,130,93,51,54,98,136,82,81,132,93,51,253,200,27,52,76,50,98,105,
+106,100,97,105,2,160,104,165,116,62,72,123,166,94,99,161,114,62,66,117,164,
+97,73,118,82,45,168,150,152,163,165,0,1,0,62,0,228,3,107,4,143,0,44,0,0,1,
+6,7,22,22,21,20,6,7,39,54,54,53,52,38,39,6,7,39,54,54,55,38,38,35,34,6,21,
+20,22,23,7,38,38,53,52,62,2,51,50,23,54,54,55,3,104,15,53,37,34,135,129,54,
+73,86,8,7,87,114,19,46,73,31,31,79,52,121,127,86,73,54,133,131,63,110,149,
+85,125,105,11,17,2,4,109,111,96,60,130,74,143,222,69,125,31,160,135,35,67,
+26,73,11,126,8,38,35,29,28,160,148,135,160,31,125,71,230,143,96,163,118,67,
+76,29,64,34,0,1,0,37,0,174,5,92,4,92,0,79,0,0,37,38,39,6,35,34,38,39,6,6,
+35,34,38,39,55,22,22,51,50,62,2,53,52,38,35,34,6,7,39,54,54,51,50,30,2,21,
+20,6,7,30,3,51,50,55,38,39,55,22,22,23,54,54,53,52,46,2,35,34,6,7,39,54,54,
+51,50,30,2,21,20,6,7,22,22,23,4,202,6,20,95,127,100,165,59,58,137,82,120,
+172,48,148,20,103,75,51,84,60,33,125,111,57,106,32,121,60,171,91,89,144,101,
+55,16,15,12,52,66,74,34,91,58,62,87,19,59,98,42,10,8,32,58,82,49,41,70,23,
+120,52,138,82,76,132,98,56,32,35,24,32,6,174,68,49,66,60,59,61,58,117,106,
+47,69,72,47,86,117,71,150,162,60,52,72,81,88,58,112,165,108,52,98,39,26,47,
+36,21,58,65,15,127,7,40,35,32,73,41,72,113,78,41,43,36,74,75,59,61,113,161,
+100,81,135,59,43,100,54,0,0,1,0,37,0,225,5,92,4,92,0,67,0,0,19,54,54,51,50,
+30,2,21,20,6,7,30,3,51,50,62,2,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,
+20,14,2,35,34,38,39,6,6,35,34,38,39,55,22,22,51,50,62,2,53,52,38,35,34,6,
+7,59,60,171,91,89,144,101,55,16,15,12,52,66,74,34,55,88,61,32,32,58,82,49,
+41,70,23,120,52,138,82,77,133,97,55,59,105,145,85,100,165,59,58,137,82,120,
+172,48,148,20,103,75,51,84,60,33,125,111,57,106,32,3,179,81,88,58,112,165,
+108,52,98,39,26,47,36,21,47,85,122,75,72,113,78,41,43,36,74,75,59,62,115,
+163,102,102,166,117,64,60,59,61,58,117,106,47,69,72,47,86,117,71,150,162,
+60,52,0,0,1,0,65,0,225,5,73,4,92,0,71,0,0,1,38,35,34,14,2,21,20,30,2,51,50,
+62,2,55,19,62,3,51,50,30,2,21,20,14,2,35,34,38,39,55,22,51,50,62,2,53,52,
+38,35,34,14,2,7,3,14,3,35,34,46,2,53,52,62,2,51,50,22,23,2,34,58,85,42,66,
+46,25,22,41,59,38,19,35,37,45,30,152,41,77,81,89,51,68,114,83,47,56,94,121,
+64,78,122,41,95,55,88,42,66,46,24,87,72,19,34,37,45,30,152,41,79,81,88,51,
+69,115,82,46,56,94,121,65,78,120,42,3,140,79,46,86,123,76,69,112,79,42,15,
+39,70,54,1,26,76,113,75,38,64,114,157,94,102,169,123,68,67,57,85,80,47,86,
+123,76,143,158,14,39,70,55,254,230,74,113,76,39,65,114,157,93,101,170,123,
+68,67,55,0,0,1,0,62,255,62,3,166,4,92,0,98,0,0,1,14,3,35,34,38,39,21,20,30,
+2,51,51,50,54,53,52,38,35,34,7,39,54,54,51,50,30,2,21,20,14,2,35,35,34,46,
+2,53,17,52,62,2,55,38,38,53,52,62,2,51,50,30,2,21,20,14,2,7,39,62,3,53,52,
+46,2,35,34,14,2,21,20,22,23,21,6,6,21,20,22,51,50,62,2,55,2,93,18,63,71,71,
+28,38,68,32,20,49,81,60,141,99,80,29,24,26,16,103,24,77,44,42,69,48,27,38,
+69,97,58,208,79,128,91,49,21,37,51,30,64,75,61,107,143,83,109,177,125,67,
+12,22,29,16,127,14,18,11,4,44,83,120,77,54,86,58,31,112,103,103,112,79,66,
+19,50,51,47,15,1,29,12,22,16,10,11,13,33,77,106,68,30,34,35,29,33,26,69,36,
+43,27,49,68,40,45,73,52,28,59,110,157,98,1,0,26,53,50,44,18,29,98,57,58,94,
+67,36,71,128,178,107,53,115,109,98,36,57,51,81,79,85,55,84,133,92,49,20,35,
+47,26,53,70,11,95,9,75,60,64,68,7,12,17,11,0,0,3,0,65,0,200,5,52,4,92,0,46,
+0,83,0,95,0,0,37,38,38,39,6,35,34,38,39,6,6,35,34,46,2,53,52,62,2,55,38,38,
+53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,6,7,22,22,23,1,46,3,35,34,6,
+21,20,22,23,21,6,6,21,20,22,51,50,54,55,62,3,51,50,23,54,54,53,52,38,35,34,
+6,19,34,6,21,20,22,51,50,54,55,38,38,4,166,3,7,6,105,135,88,128,37,60,156,
+84,71,117,83,45,21,37,51,30,65,74,55,99,136,80,85,137,55,48,118,62,90,145,
+102,55,29,31,22,29,9,253,144,39,71,67,63,29,100,115,112,103,103,112,91,92,
+63,125,48,5,43,70,96,58,150,100,4,4,122,124,61,112,180,70,69,71,75,57,91,
+26,34,91,200,34,60,24,93,50,48,45,53,35,66,97,63,26,53,50,44,18,29,98,57,
+58,94,67,36,35,35,32,38,60,108,152,93,70,126,60,46,109,65,2,148,31,39,22,
+8,66,62,53,70,11,95,9,75,60,70,62,53,45,46,78,57,31,81,26,55,31,141,151,40,
+254,101,52,42,42,46,49,44,45,44,0,1,0,65,255,62,5,73,4,92,0,106,0,0,37,38,
+35,34,6,21,20,30,2,51,51,50,62,2,53,53,6,35,34,38,39,55,22,51,50,62,2,53,
+52,38,35,34,14,2,7,3,14,3,35,34,46,2,53,52,62,2,51,50,22,23,7,38,35,34,14,
+2,21,20,30,2,51,50,62,2,55,19,62,3,51,50,30,2,21,3,20,14,2,35,35,34,46,2,
+53,52,62,2,51,50,22,23,2,252,16,26,25,28,18,42,69,51,140,58,81,49,22,83,98,
+78,122,41,95,55,88,42,66,46,24,87,72,19,34,37,45,30,152,41,79,81,88,51,69,
+115,82,46,56,94,121,65,77,121,42,95,58,85,42,66,46,25,22,41,59,38,19,35,37,
+45,30,152,41,77,81,89,51,67,115,83,47,1,49,90,129,79,207,59,97,69,38,27,49,
+69,42,42,78,25,40,26,33,29,18,26,17,8,30,66,107,78,83,74,67,57,85,80,47,86,
+123,76,143,158,14,39,70,55,254,230,74,113,76,39,65,114,157,93,101,170,123,
+68,68,55,85,79,46,86,123,76,69,112,79,42,15,39,70,54,1,26,76,113,75,38,64,
+114,157,94,254,55,97,157,110,60,28,51,74,45,40,68,49,27,43,36,0,1,251,92,
+253,188,255,106,0,122,0,61,0,0,1,22,51,50,62,2,53,52,38,35,34,6,7,22,22,21,
+20,6,7,39,54,54,53,52,35,34,21,20,22,23,7,46,3,53,52,62,2,51,50,22,23,62,
+3,51,50,30,2,21,20,14,2,35,34,39,254,9,31,28,36,59,40,22,82,75,57,71,7,4,
+3,89,104,49,57,47,170,170,47,57,49,54,73,46,20,47,83,112,66,72,108,46,16,
+49,56,59,28,66,109,78,43,43,76,107,64,62,63,254,60,12,35,64,90,55,107,119,
+89,75,17,40,20,112,176,57,112,24,120,102,228,228,102,120,24,112,29,75,90,
+103,56,77,129,92,51,49,60,23,40,29,17,46,87,126,81,85,134,93,49,28,0,2,253,
+50,253,168,255,106,0,110,0,44,0,55,0,0,1,38,38,39,6,35,34,46,2,53,52,62,2,
+51,50,22,23,54,54,53,52,38,35,34,6,7,39,62,3,51,50,30,2,21,20,6,7,22,22,23,
+37,34,6,21,20,22,51,50,55,38,38,254,235,2,2,4,78,101,53,85,60,32,31,57,79,
+49,57,89,39,2,3,92,91,40,79,26,102,20,57,67,76,39,71,114,81,43,22,23,16,20,
+7,254,200,51,48,50,55,82,42,26,66,253,168,27,29,18,65,25,45,61,36,40,68,50,
+28,27,29,17,36,19,104,112,47,42,61,32,53,38,21,48,86,120,72,54,97,46,34,81,
+54,230,35,29,29,31,62,30,32,0,0,2,253,60,253,168,255,106,0,211,0,59,0,70,
+0,0,37,14,3,7,62,3,51,50,30,2,21,20,14,2,7,22,22,23,7,38,38,39,6,35,34,46,
+2,53,52,62,2,51,50,22,23,54,54,53,52,46,2,35,34,6,7,39,62,3,55,19,34,6,21,
+20,22,51,50,55,38,38,253,237,15,22,16,10,3,15,42,46,45,18,53,101,79,48,5,
+11,16,12,16,21,7,126,2,2,4,78,101,53,85,60,32,31,57,79,49,57,89,39,2,3,16,
+38,61,46,61,67,11,121,1,17,32,45,30,120,51,48,50,55,82,42,26,66,159,9,39,
+53,60,28,18,24,15,6,31,65,102,71,27,45,41,41,23,34,81,54,18,27,29,18,65,25,
+45,61,36,40,68,50,28,27,29,17,36,19,27,50,39,24,48,38,11,76,117,88,64,23,
+253,205,35,29,29,31,62,30,32,0,0,1,252,234,253,176,255,106,0,110,0,29,0,0,
+1,38,38,53,52,62,2,51,50,30,2,21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,22,
+23,253,192,107,107,50,87,117,67,65,116,87,51,109,103,50,57,67,92,89,90,93,
+67,57,253,176,58,183,112,75,128,93,53,53,95,131,78,112,176,57,112,24,120,
+102,109,119,119,109,102,120,24,0,1,252,255,253,168,255,106,0,110,0,56,0,0,
+5,38,38,35,34,6,7,62,3,51,50,30,2,21,20,14,2,7,39,62,3,53,52,46,2,35,34,14,
+2,21,20,30,2,23,7,46,3,53,52,62,2,51,50,22,23,254,210,29,70,29,87,96,18,15,
+44,49,51,23,78,112,74,35,18,42,69,51,48,28,36,19,7,16,40,69,53,46,62,37,16,
+6,19,35,28,56,56,69,37,12,53,90,118,65,54,123,51,48,21,22,82,68,17,24,16,
+8,40,68,92,51,31,68,68,65,27,115,12,35,40,41,18,23,47,39,25,27,39,42,15,20,
+45,46,44,19,98,27,82,89,84,30,111,152,94,41,30,33,0,1,250,190,253,177,255,
+106,0,115,0,100,0,0,1,22,22,51,50,54,53,52,38,39,55,22,22,21,20,7,30,3,51,
+50,54,53,52,38,35,34,6,7,39,54,54,51,50,30,2,21,20,14,2,35,34,39,6,6,35,34,
+38,39,6,6,35,34,46,2,53,52,54,55,54,53,52,35,34,21,20,22,23,7,46,3,53,52,
+62,2,51,50,30,2,21,20,6,7,6,6,21,20,30,2,51,50,55,252,119,7,35,29,38,43,64,
+71,65,102,106,16,12,40,48,52,24,80,87,85,72,20,39,17,94,39,92,53,61,103,75,
+42,46,81,111,66,145,88,26,77,42,45,64,20,21,61,48,45,77,55,32,48,43,79,65,
+29,6,5,26,22,39,29,17,24,41,55,32,46,73,50,27,44,42,42,36,13,21,26,13,57,
+16,254,175,72,67,120,107,90,128,45,101,54,185,125,81,55,19,33,25,14,130,115,
+107,118,18,16,80,38,32,49,91,129,81,81,130,91,49,81,35,46,28,32,32,28,31,
+55,77,46,40,78,41,76,68,79,19,6,12,2,109,3,21,33,42,22,30,50,36,21,28,48,
+66,38,48,85,43,43,58,29,24,37,26,13,139,0,0,1,252,187,253,172,255,106,0,110,
+0,58,0,0,1,14,3,35,34,46,2,53,52,54,55,38,38,53,52,62,2,51,50,30,2,21,20,
+14,2,7,39,62,3,53,52,38,35,34,6,21,20,22,23,21,6,6,21,20,22,51,50,62,2,55,
+254,111,16,51,57,57,22,52,86,61,34,55,44,48,51,49,84,114,65,85,139,98,53,
+10,18,24,13,112,12,14,9,3,125,115,81,88,87,79,80,86,57,47,13,39,40,37,13,
+253,228,10,19,14,8,29,55,77,48,40,77,29,23,74,44,47,76,53,29,56,100,141,84,
+41,89,87,78,30,50,41,65,61,64,42,127,140,52,38,38,49,9,87,7,54,42,46,48,6,
+10,16,9,0,0,2,252,231,253,177,255,106,0,110,0,23,0,44,0,0,7,20,14,2,35,34,
+38,53,52,54,55,38,38,53,52,62,2,51,50,30,2,5,6,6,21,20,22,51,50,62,2,53,52,
+38,35,34,6,21,20,22,23,150,47,88,124,77,147,160,55,44,48,51,45,80,110,65,
+81,127,88,47,254,172,78,87,86,85,45,73,51,28,111,99,74,84,87,78,234,77,131,
+95,54,109,100,40,77,29,23,74,44,48,77,52,28,51,92,126,120,7,54,42,51,43,36,
+64,89,53,109,119,46,44,38,49,9,0,0,2,251,106,253,177,255,106,0,110,0,68,0,
+79,0,0,37,54,54,51,50,30,2,21,20,14,2,35,34,39,6,6,35,34,46,2,53,52,62,2,
+51,50,22,23,54,54,53,52,38,35,34,6,7,39,62,3,51,50,30,2,21,20,7,30,3,51,50,
+62,2,53,52,38,35,34,7,1,34,6,21,20,22,51,50,55,38,38,253,178,34,76,43,62,
+105,77,43,47,83,113,67,152,99,44,101,63,53,86,61,33,32,57,80,48,57,90,39,
+2,2,90,91,41,80,26,101,20,57,67,76,39,71,114,80,43,37,15,42,48,53,26,40,64,
+44,24,90,73,25,27,254,95,51,49,51,54,82,42,25,66,65,25,20,49,91,130,80,80,
+130,92,49,96,50,46,25,45,61,36,40,68,50,28,25,29,17,35,18,104,112,47,42,61,
+32,53,38,21,48,86,120,72,95,82,17,30,23,13,35,64,90,56,107,118,16,254,182,
+35,29,29,31,62,29,33,0,1,253,23,253,172,255,106,0,110,0,47,0,0,1,54,54,53,
+52,39,53,54,54,53,52,38,35,34,6,21,20,30,2,23,7,46,3,53,52,62,2,51,50,30,
+2,21,20,6,7,22,22,21,20,14,2,7,254,107,63,54,165,78,87,75,66,92,86,10,24,
+39,29,47,53,73,46,21,43,83,118,75,60,101,74,41,52,46,47,51,32,58,81,49,254,
+32,5,55,42,85,14,87,9,49,38,37,53,115,128,41,75,62,47,12,110,24,73,91,105,
+57,78,131,94,53,32,56,74,43,43,73,24,29,76,37,42,76,58,37,3,0,0,1,253,24,
+253,168,255,106,0,110,0,66,0,0,5,38,35,34,14,2,7,62,3,51,50,30,2,21,20,6,
+7,22,22,21,20,14,2,7,39,54,54,53,52,38,39,53,54,54,53,52,46,2,35,34,14,2,
+21,20,22,23,7,46,3,53,52,62,2,51,50,22,23,254,227,57,86,30,56,46,33,6,11,
+37,49,59,34,43,91,76,49,42,37,38,41,33,55,72,39,39,51,55,56,58,54,60,29,42,
+47,18,58,72,40,14,35,51,62,54,66,35,11,53,90,118,65,57,107,51,42,37,18,37,
+57,39,9,22,19,12,13,33,58,46,30,53,17,20,55,26,30,54,41,26,3,101,4,39,29,
+22,22,6,65,8,26,24,17,22,12,5,27,40,46,18,48,88,31,105,32,86,87,80,27,111,
+152,94,41,27,36,0,0,2,251,27,253,177,255,106,0,110,0,45,0,66,0,0,37,22,22,
+21,20,14,2,35,34,39,6,35,34,38,53,52,54,55,38,38,53,52,62,2,51,50,30,2,21,
+20,6,7,30,3,51,50,54,53,52,38,39,1,6,6,21,20,22,51,50,62,2,53,52,38,35,34,
+6,21,20,22,23,254,76,147,139,46,82,111,66,163,93,89,146,148,159,56,42,45,
+53,45,79,110,65,81,128,88,47,13,12,13,42,49,51,24,81,87,93,94,254,37,79,86,
+86,84,46,73,51,27,111,99,73,84,87,78,110,23,180,149,81,129,90,49,93,93,109,
+100,38,79,29,23,75,43,48,77,52,28,51,92,126,75,36,72,36,18,36,27,17,133,112,
+104,111,15,254,234,7,54,42,51,43,36,64,89,53,109,119,46,44,38,49,9,0,1,251,
+115,253,168,255,106,0,110,0,82,0,0,37,54,54,51,50,30,2,21,20,14,2,35,34,38,
+39,6,6,35,34,38,39,30,3,51,33,21,33,34,46,2,39,23,30,3,51,50,54,53,52,46,
+2,35,34,6,7,39,54,54,51,50,30,2,21,20,6,7,30,3,51,50,62,2,53,52,46,2,35,34,
+6,7,253,165,38,93,47,61,101,73,40,53,86,112,58,75,123,45,44,95,63,32,43,26,
+16,50,68,86,52,2,9,253,215,108,146,93,46,7,130,7,26,33,38,19,75,77,26,41,
+49,23,32,74,29,92,52,128,57,52,97,74,44,10,10,10,40,51,56,25,35,62,47,28,
+21,37,50,30,17,52,20,55,30,25,38,69,94,55,75,109,71,33,43,41,46,38,11,15,
+28,31,15,3,115,40,87,136,97,22,17,22,13,5,89,74,43,58,35,15,27,26,76,45,47,
+36,65,89,54,38,55,20,18,27,18,9,15,39,67,51,33,52,37,20,14,12,0,1,252,135,
+253,177,255,106,0,110,0,62,0,0,1,22,22,51,50,54,53,52,38,39,55,22,22,21,20,
+14,2,35,34,38,39,6,6,35,34,46,2,53,52,54,55,38,38,53,52,62,2,51,50,22,23,
+7,38,38,35,34,6,21,20,22,51,21,6,6,21,20,51,50,54,55,254,60,9,37,30,38,50,
+59,64,65,100,96,37,62,81,43,42,71,23,23,72,54,54,85,60,32,44,43,51,36,34,
+63,89,54,31,70,42,44,25,44,20,57,56,82,93,95,80,95,38,45,9,254,151,65,50,
+118,109,86,124,45,102,57,184,127,74,122,87,48,30,32,35,27,32,58,81,49,48,
+81,27,26,67,48,39,68,49,28,15,13,104,8,8,36,32,46,47,102,1,53,47,106,49,65,
+0,1,252,227,253,168,255,106,0,115,0,87,0,0,37,38,38,35,34,6,21,20,22,23,21,
+34,6,21,20,22,51,50,54,55,51,22,22,51,50,54,55,53,52,38,39,55,22,22,21,21,
+20,14,2,35,35,34,46,2,53,52,55,23,6,21,20,22,51,51,50,62,2,55,6,35,34,38,
+39,6,6,35,34,46,2,53,52,54,55,38,38,53,52,62,2,51,50,22,23,254,6,18,37,8,
+37,50,60,54,51,63,32,42,28,53,12,78,11,37,27,16,34,13,23,24,88,42,40,31,69,
+108,77,152,47,77,56,30,24,97,3,41,53,182,33,45,29,16,3,26,32,41,51,23,25,
+83,45,41,68,49,27,30,38,37,31,31,54,73,43,20,73,29,10,2,5,22,34,24,26,8,65,
+33,37,23,27,35,38,38,35,14,17,91,78,101,20,76,40,134,88,128,81,121,82,41,
+16,35,53,37,47,35,56,6,11,17,18,11,24,39,28,9,29,32,33,28,24,44,58,35,26,
+62,20,17,46,30,33,52,36,19,4,4,0,1,253,53,253,168,255,106,0,110,0,41,0,0,
+1,54,54,51,50,62,2,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,20,14,2,7,
+22,22,23,7,46,3,35,34,7,253,64,48,107,59,47,75,52,28,20,39,57,37,57,84,26,
+107,51,138,85,72,109,73,37,24,39,53,28,37,66,23,98,18,51,59,65,33,77,66,254,
+87,32,31,21,45,71,50,28,60,50,31,47,42,63,68,74,48,80,103,55,44,75,62,46,
+14,17,56,38,72,27,45,33,19,36,0,1,252,143,253,177,255,106,0,115,0,75,0,0,
+1,30,3,51,50,54,53,52,38,39,55,22,22,21,20,14,2,35,34,38,39,6,6,35,34,46,
+2,53,52,54,55,54,53,52,35,34,21,20,22,23,7,46,3,53,52,62,2,51,50,30,2,21,
+20,6,7,6,6,21,20,30,2,51,50,62,2,55,254,71,3,13,18,24,14,38,43,64,71,65,102,
+106,20,49,84,64,45,64,20,21,61,48,45,77,55,32,48,43,79,65,29,6,5,26,22,39,
+29,17,24,41,55,32,46,73,50,27,44,42,42,36,13,21,26,13,14,24,18,13,4,254,144,
+35,42,23,8,120,107,90,128,45,101,54,185,125,53,120,102,67,28,32,32,28,31,
+55,77,46,40,78,41,76,68,79,19,6,12,2,109,3,21,33,42,22,30,50,36,21,28,48,
+66,38,48,85,43,43,58,29,24,37,26,13,8,24,42,34,0,1,250,150,253,168,255,106,
+0,109,0,92,0,0,1,6,35,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,21,20,22,51,
+50,62,2,53,52,46,2,53,52,62,2,51,50,30,2,21,20,14,2,35,34,38,39,55,54,54,
+53,52,38,35,34,6,21,20,30,2,21,20,14,2,35,34,46,2,53,52,62,2,53,52,38,35,
+34,6,21,20,22,51,251,218,18,19,62,105,77,43,46,82,113,67,63,101,71,38,11,
+12,11,43,29,13,26,20,13,11,13,11,40,73,103,62,68,112,79,43,44,76,105,60,15,
+15,9,14,94,78,81,83,78,68,10,13,10,30,54,74,45,43,74,54,31,10,13,10,67,78,
+85,81,78,94,253,173,5,52,95,135,83,79,127,90,48,51,90,122,71,21,57,58,51,
+15,26,23,7,13,18,11,9,44,59,66,32,71,120,87,48,51,92,129,79,81,132,94,51,
+3,2,110,1,131,119,118,110,111,106,36,54,47,46,29,34,57,42,23,23,41,57,35,
+29,46,47,53,37,107,110,108,120,120,131,0,0,2,251,132,253,177,255,106,0,110,
+0,50,0,62,0,0,1,22,22,51,50,62,2,53,52,38,35,34,6,7,22,22,21,20,14,2,35,34,
+46,2,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,14,2,35,34,39,1,20,22,
+51,50,54,53,52,38,35,34,6,253,244,23,38,18,36,58,41,22,82,73,54,74,10,3,4,
+42,77,109,68,62,103,73,40,42,76,105,64,68,106,39,35,110,63,64,107,76,43,42,
+76,107,66,68,73,254,83,78,72,72,77,78,74,70,77,254,57,11,10,35,64,90,55,107,
+119,84,68,18,43,20,82,130,91,49,56,98,130,74,76,126,91,50,48,52,49,51,47,
+87,124,77,85,135,95,51,35,1,61,109,128,125,112,112,121,122,0,1,252,52,253,
+174,255,106,0,110,0,69,0,0,1,30,3,51,50,54,55,23,6,35,34,38,39,6,6,35,34,
+46,2,53,52,54,55,38,38,53,52,62,2,51,50,30,2,21,20,6,7,7,54,54,53,52,46,2,
+35,34,14,2,21,20,22,23,21,34,6,21,20,51,50,62,2,55,253,175,4,14,19,25,16,
+22,33,5,117,32,144,42,60,23,25,66,45,43,72,53,29,44,43,48,39,38,87,141,102,
+106,169,117,62,5,7,129,8,10,49,89,126,77,48,81,59,33,82,72,78,76,66,17,27,
+20,14,5,254,121,27,34,18,6,50,54,30,189,29,32,33,28,35,58,75,41,48,81,28,
+23,65,46,29,70,61,41,77,144,207,130,32,65,30,19,32,73,40,116,167,108,52,13,
+24,35,21,38,40,2,104,51,48,94,6,19,33,27,0,1,252,170,253,177,255,106,0,110,
+0,59,0,0,5,62,3,53,52,38,35,34,6,7,39,54,54,51,50,30,2,21,20,6,7,22,21,20,
+14,2,35,34,46,2,53,52,62,2,55,23,6,6,21,20,30,2,51,50,54,53,52,46,2,35,34,
+7,254,62,27,58,48,31,57,57,20,50,30,41,42,75,35,54,88,63,34,39,46,85,49,89,
+125,76,82,135,96,52,19,42,65,46,59,56,37,35,62,82,48,100,103,15,33,51,36,
+13,16,167,1,6,20,36,30,32,36,8,11,104,17,14,29,49,67,39,48,65,26,48,96,53,
+86,62,33,55,97,135,80,48,98,89,73,24,90,49,122,79,54,90,64,36,61,56,17,32,
+26,15,1,0,0,2,252,180,253,177,255,106,0,110,0,24,0,45,0,0,1,34,39,6,6,35,
+34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,39,22,22,51,50,54,53,52,38,35,34,
+6,21,20,22,51,50,62,2,55,254,151,91,43,24,71,44,45,77,56,32,50,90,125,75,
+82,131,92,49,34,59,76,126,9,42,31,37,38,104,103,105,105,39,36,16,26,22,16,
+5,253,177,71,32,39,48,89,126,77,75,132,97,57,54,101,141,87,71,117,84,46,222,
+63,44,114,103,123,130,128,125,105,112,8,24,42,33,0,1,251,186,254,152,255,
+106,0,110,0,26,0,0,5,33,50,62,2,53,52,38,35,34,7,39,54,54,51,50,30,2,21,20,
+14,2,35,33,251,186,2,37,30,86,79,56,47,39,40,19,109,26,90,52,50,85,61,34,
+55,88,109,55,253,131,222,6,24,47,41,45,41,28,73,38,45,34,60,83,48,68,93,58,
+26,0,0,1,253,140,253,178,0,238,5,160,0,64,0,0,1,54,51,50,30,4,21,17,20,14,
+4,35,34,46,2,39,6,6,35,34,46,2,53,52,62,2,55,23,6,6,21,20,30,2,51,50,54,55,
+51,22,22,51,50,62,2,53,17,52,46,2,35,34,7,254,255,48,49,51,100,88,75,54,30,
+8,22,39,62,88,60,21,47,46,38,12,23,82,54,78,102,60,24,29,55,81,51,44,63,59,
+10,29,49,39,42,55,8,107,8,49,53,43,55,32,11,29,66,106,78,27,30,5,154,6,17,
+42,72,111,152,102,251,227,50,110,107,97,74,43,8,15,23,16,35,27,58,96,121,
+63,57,108,94,77,26,109,32,135,94,34,75,64,42,78,81,80,79,50,92,132,81,4,56,
+84,131,90,48,3,0,1,253,140,253,178,0,238,5,160,0,64,0,0,1,54,51,50,30,4,21,
+17,20,14,4,35,34,46,2,39,6,6,35,34,46,2,53,52,62,2,55,23,6,6,21,20,30,2,51,
+50,54,55,51,22,22,51,50,62,2,53,17,52,46,2,35,34,7,254,255,48,49,51,100,88,
+75,54,30,8,22,39,62,88,60,21,47,46,38,12,23,82,54,78,102,60,24,29,55,81,51,
+44,63,59,10,29,49,39,42,55,8,107,8,49,53,43,55,32,11,29,66,106,78,27,30,5,
+154,6,17,42,72,111,152,102,251,227,50,110,107,97,74,43,8,15,23,16,35,27,58,
+96,121,63,57,108,94,77,26,109,32,135,94,34,75,64,42,78,81,80,79,50,92,132,
+81,4,56,84,131,90,48,3,0,2,252,94,253,177,255,135,0,109,0,85,0,99,0,0,1,30,
+3,51,50,62,2,55,46,3,53,52,62,2,51,50,30,2,21,20,7,22,22,23,7,34,39,14,3,
+35,34,38,39,6,6,35,34,46,2,53,52,54,55,38,38,53,52,62,2,51,50,22,23,7,38,
+38,35,34,6,21,20,22,23,21,35,34,6,21,20,51,50,62,2,55,37,54,54,53,52,46,2,
+39,6,6,21,20,22,254,19,3,17,24,28,15,7,20,21,20,6,34,58,42,24,25,41,53,28,
+33,69,56,35,26,10,29,16,25,52,28,16,43,47,49,22,42,82,23,23,72,54,54,85,60,
+32,44,43,51,36,33,60,87,54,31,70,42,44,25,44,19,57,50,71,87,18,78,62,94,19,
+30,23,16,5,1,68,6,7,12,21,28,16,12,17,55,254,142,35,42,22,7,5,10,12,8,24,
+65,77,87,46,50,91,69,41,45,81,115,70,95,84,2,1,3,111,7,23,37,26,14,30,32,
+35,27,32,58,81,49,48,81,27,26,67,48,39,67,49,28,14,13,104,8,8,36,32,44,48,
+1,104,56,43,106,8,23,41,34,32,30,63,29,33,66,57,43,11,25,76,47,54,95,0,1,
+252,194,253,178,255,106,0,110,0,91,0,0,5,38,38,35,34,6,21,20,30,4,21,20,14,
+2,35,34,39,6,6,35,34,46,2,53,52,54,55,38,38,53,52,62,2,51,50,22,23,7,38,35,
+34,6,21,20,22,23,21,14,3,21,20,22,51,50,62,2,55,51,22,22,51,50,62,2,53,52,
+46,4,53,52,62,2,51,50,30,2,23,254,187,22,56,21,37,39,52,78,90,78,52,27,55,
+82,54,80,46,23,72,54,45,70,47,25,32,34,36,30,43,62,70,26,11,22,12,19,11,10,
+35,39,44,35,26,31,17,5,28,35,24,31,19,9,2,104,6,41,31,23,34,23,11,52,76,90,
+76,51,18,42,68,50,34,50,39,29,14,15,14,12,20,14,17,29,32,42,61,85,60,45,87,
+67,42,62,35,27,25,43,58,32,26,48,9,10,48,30,46,55,30,10,3,1,97,1,21,29,24,
+19,5,65,1,8,14,18,11,22,25,16,26,34,17,45,41,26,41,49,23,43,57,42,35,41,54,
+41,24,48,37,24,8,12,15,6,0,1,252,158,253,168,255,106,0,110,0,46,0,0,1,46,
+3,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,14,2,7,39,54,54,53,52,38,
+35,34,6,7,35,38,38,35,34,6,21,20,22,23,253,97,48,73,49,25,35,60,78,44,45,
+73,24,23,72,50,45,77,57,33,26,49,73,46,57,55,59,41,39,36,43,8,107,6,44,35,
+41,41,60,54,253,169,35,90,105,115,59,69,113,79,44,39,34,39,34,46,83,115,70,
+59,113,102,89,33,100,45,147,91,100,111,82,76,77,81,111,100,92,145,46,0,0,
+1,252,148,253,168,255,106,0,110,0,68,0,0,1,46,3,53,52,62,2,51,50,30,2,23,
+7,38,38,35,34,14,2,7,54,54,51,50,22,23,54,54,51,50,30,2,21,20,14,2,7,39,54,
+54,53,52,38,35,34,14,2,7,35,46,3,35,34,21,20,30,2,23,253,49,36,59,40,22,54,
+97,135,81,35,75,71,66,26,51,51,104,39,38,78,67,52,11,15,36,17,45,71,24,29,
+73,54,50,79,55,29,31,49,60,29,56,37,51,40,50,15,31,25,17,1,104,2,15,23,29,
+17,82,10,22,35,26,253,168,23,59,79,102,67,89,141,98,52,8,17,26,17,95,26,22,
+12,28,47,36,5,8,43,34,37,40,38,64,84,46,47,80,64,48,14,93,23,79,51,57,67,
+13,28,45,33,36,46,27,10,115,20,46,47,44,17,0,0,1,251,125,253,177,255,106,
+0,109,0,66,0,0,1,22,51,50,62,2,53,52,38,35,34,14,2,7,22,22,21,20,14,2,35,
+34,38,39,55,22,22,51,50,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,23,62,3,
+51,50,30,2,21,20,14,2,35,34,38,39,253,247,41,35,36,59,40,22,81,74,27,45,35,
+23,5,2,3,49,85,113,64,94,137,40,130,16,76,54,38,62,44,24,93,81,42,79,26,107,
+50,137,71,73,120,38,19,50,55,59,29,64,107,75,42,42,76,107,65,36,69,35,254,
+56,20,35,63,90,56,107,119,26,44,58,33,17,42,21,78,127,90,49,97,87,42,54,57,
+35,64,87,53,111,120,47,42,63,68,73,55,53,23,40,29,16,46,87,124,77,85,135,
+95,51,17,17,0,0,1,251,176,254,152,255,106,0,110,0,26,0,0,3,33,34,46,2,53,
+52,62,2,51,50,22,23,7,38,35,34,6,21,20,30,2,51,33,150,253,121,55,109,88,55,
+34,61,85,50,52,90,26,109,19,40,39,47,56,79,86,30,2,47,254,152,26,58,93,68,
+48,83,60,34,45,38,73,28,41,45,41,47,24,6,0,0,1,254,119,253,177,0,238,5,160,
+0,65,0,0,1,54,51,50,30,4,21,17,20,14,2,35,34,46,2,53,52,54,55,38,53,52,62,
+2,51,50,22,23,7,38,38,35,34,6,21,20,30,2,23,21,14,3,21,20,22,51,50,54,53,
+17,52,46,2,35,34,7,254,255,48,49,51,100,88,75,54,30,50,95,139,90,57,95,67,
+38,44,43,87,34,63,88,54,43,91,38,51,27,60,23,57,57,16,39,62,47,45,63,39,17,
+68,66,112,111,29,66,106,78,27,30,5,154,6,17,42,72,111,152,102,251,210,125,
+177,112,51,32,58,81,49,49,82,26,51,89,39,67,49,28,22,20,102,13,16,36,31,23,
+34,23,13,1,102,2,15,25,34,20,53,58,159,169,4,84,84,131,90,48,3,0,0,1,254,
+119,253,177,0,238,5,160,0,65,0,0,1,54,51,50,30,4,21,17,20,14,2,35,34,46,2,
+53,52,54,55,38,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,30,2,23,21,14,
+3,21,20,22,51,50,54,53,17,52,46,2,35,34,7,254,255,48,49,51,100,88,75,54,30,
+50,95,139,90,57,95,67,38,44,43,87,34,63,88,54,43,91,38,51,27,60,23,57,57,
+16,39,62,47,45,63,39,17,68,66,112,111,29,66,106,78,27,30,5,154,6,17,42,72,
+111,152,102,251,210,125,177,112,51,32,58,81,49,49,82,26,51,89,39,67,49,28,
+22,20,102,13,16,36,31,23,34,23,13,1,102,2,15,25,34,20,53,58,159,169,4,84,
+84,131,90,48,3,0,0,1,252,141,253,172,255,106,0,110,0,63,0,0,1,62,3,53,52,
+46,2,35,34,6,21,20,22,23,30,3,21,20,14,2,35,34,46,2,53,52,55,23,6,21,20,22,
+51,50,54,53,52,38,39,46,3,53,52,62,2,51,50,30,2,21,20,6,7,254,179,11,17,12,
+6,44,80,109,64,57,73,42,57,73,95,56,22,40,69,93,52,56,96,69,39,43,109,20,
+69,57,54,66,78,85,29,64,54,36,43,75,104,61,89,153,112,64,31,32,253,216,43,
+72,63,56,28,69,106,72,37,25,23,11,23,20,26,52,57,65,39,50,89,66,39,35,65,
+89,54,61,63,65,36,25,57,69,72,56,47,61,31,10,25,36,50,34,33,59,45,27,54,100,
+146,91,78,163,74,0,0,1,252,168,253,168,255,106,0,110,0,77,0,0,5,38,38,35,
+34,6,7,39,62,3,51,50,22,23,54,54,51,50,30,2,21,21,20,6,7,22,22,23,7,39,6,
+35,35,34,46,2,53,52,62,2,51,50,22,23,7,38,35,34,6,21,20,22,51,51,50,55,38,
+38,39,55,22,22,23,54,54,53,53,52,38,35,34,6,7,253,217,9,52,32,34,41,5,132,
+6,37,56,71,40,48,70,24,23,70,50,44,77,57,33,30,33,9,18,8,118,15,55,58,204,
+47,77,56,30,22,39,56,35,35,65,23,93,14,16,16,17,57,72,157,33,25,20,52,28,
+19,47,81,34,6,5,40,41,34,54,8,137,64,68,94,92,26,63,101,72,39,34,37,38,33,
+46,82,116,70,52,71,111,45,18,38,24,37,35,25,22,42,60,37,33,54,39,22,37,32,
+63,23,21,18,24,22,7,15,26,5,106,6,33,28,23,56,37,50,102,110,68,64,0,1,253,
+2,253,177,0,238,5,160,0,66,0,0,1,54,51,50,30,4,21,17,20,14,2,35,34,46,2,39,
+39,46,3,35,34,6,21,20,22,51,50,55,23,6,6,35,34,46,2,53,52,62,2,51,50,22,23,
+23,22,22,51,50,54,53,17,52,46,2,35,34,7,254,255,48,49,51,100,88,75,54,30,
+41,69,91,51,40,68,62,60,32,117,21,33,29,25,12,54,62,69,60,62,47,84,35,98,
+61,53,96,73,43,38,68,92,54,79,123,61,117,40,54,26,51,63,29,66,106,78,27,30,
+5,154,6,17,42,72,111,152,102,251,52,69,113,81,44,29,59,89,60,216,39,51,30,
+12,119,103,118,130,65,75,47,58,55,99,135,80,74,122,87,48,122,114,217,75,57,
+115,109,4,188,84,131,90,48,3,0,0,1,253,23,253,160,255,115,0,110,0,77,0,0,
+1,6,21,20,22,51,51,50,54,55,38,38,39,55,22,22,23,52,46,2,35,34,6,7,39,62,
+3,51,50,62,2,53,52,46,2,35,34,6,7,39,54,54,51,50,22,21,20,6,7,22,22,21,20,
+6,7,22,22,23,7,38,38,39,6,35,35,34,46,2,53,52,54,55,253,148,7,41,53,110,25,
+53,16,11,44,23,35,26,56,21,38,63,83,45,45,63,22,48,22,64,62,52,10,47,51,23,
+4,14,33,52,37,38,88,40,64,63,111,61,136,134,41,38,69,62,17,15,11,22,8,108,
+4,3,9,55,71,144,47,77,56,30,27,23,254,90,7,15,17,18,4,5,17,27,8,90,7,29,14,
+30,45,29,14,9,9,85,13,15,7,2,15,21,22,7,14,31,25,17,21,36,86,48,37,105,84,
+36,70,14,26,87,57,33,50,23,20,51,25,37,11,14,17,28,16,35,53,37,36,55,18,0,
+0,2,253,44,253,177,255,106,0,110,0,19,0,31,0,0,7,20,14,2,35,34,46,2,53,52,
+62,2,51,50,30,2,5,20,22,51,50,54,53,52,38,35,34,6,150,41,77,109,68,62,103,
+74,40,43,77,107,65,64,104,74,40,254,76,77,72,72,77,77,74,70,77,239,82,130,
+91,49,56,98,130,74,77,127,90,49,52,92,129,76,109,128,125,112,112,121,122,
+0,0,1,252,234,253,176,255,106,0,151,0,44,0,0,39,6,6,7,22,22,21,20,6,7,39,
+54,54,53,52,38,39,6,6,7,39,54,54,55,38,35,34,6,21,20,22,23,7,38,38,53,52,
+62,2,51,50,23,54,55,151,7,25,20,28,25,109,103,50,57,67,3,5,33,77,46,17,36,
+56,21,42,71,90,93,67,57,48,107,107,50,87,117,67,95,78,15,5,120,45,83,36,47,
+99,57,112,176,57,112,24,120,102,23,42,19,26,29,5,114,5,25,24,36,119,109,102,
+120,24,112,58,183,112,75,128,93,52,54,40,56,0,1,252,218,253,168,0,247,5,160,
+0,82,0,0,1,54,51,50,30,4,21,17,20,6,7,22,22,23,7,38,39,6,6,35,34,38,39,6,
+6,35,34,38,39,55,22,22,51,50,62,2,53,52,38,35,34,6,7,39,54,54,51,50,30,2,
+21,20,6,7,30,3,51,50,55,38,38,39,55,22,22,23,54,53,17,52,46,2,35,34,7,254,
+255,48,49,51,100,88,75,54,30,24,23,21,28,7,119,4,16,38,91,52,74,130,45,45,
+104,63,94,138,40,130,17,76,54,37,62,44,24,93,81,42,79,26,107,51,136,72,70,
+114,80,43,14,11,10,39,48,54,24,60,44,26,57,29,16,45,77,32,12,29,66,106,78,
+27,30,5,154,6,17,42,72,111,152,102,251,98,59,99,42,32,60,25,45,34,33,28,30,
+47,41,46,42,97,87,42,54,57,35,64,87,53,111,120,47,42,63,68,73,45,89,130,84,
+37,76,31,18,34,26,15,39,20,27,5,113,4,32,23,45,55,4,167,84,131,90,48,3,0,
+0,1,252,218,253,177,0,238,5,160,0,69,0,0,1,54,51,50,30,4,21,17,20,14,2,35,
+34,38,39,6,6,35,34,38,39,55,22,22,51,50,62,2,53,52,38,35,34,6,7,39,54,54,
+51,50,30,2,21,20,6,7,30,3,51,50,62,2,53,17,52,46,2,35,34,7,254,255,48,49,
+51,100,88,75,54,30,47,82,115,67,74,130,45,45,104,63,94,138,40,130,17,76,54,
+37,62,44,24,93,81,42,79,26,107,51,136,72,70,114,80,43,14,11,10,39,48,54,24,
+41,64,45,24,29,66,106,78,27,30,5,154,6,17,42,72,111,152,102,251,98,81,130,
+92,50,47,41,46,42,97,87,42,54,57,35,64,87,53,111,120,47,42,63,68,73,45,89,
+130,84,37,76,31,18,34,26,15,35,64,90,56,4,167,84,131,90,48,3,0,1,251,126,
+253,177,255,106,0,110,0,65,0,0,5,38,35,34,6,21,20,22,51,50,62,2,55,55,62,
+3,51,50,30,2,21,20,14,2,35,34,38,39,55,22,51,50,54,53,52,38,35,34,14,2,7,
+7,14,3,35,34,46,2,53,52,62,2,51,50,22,23,252,233,44,53,60,69,62,54,12,25,
+29,33,21,117,32,61,63,70,41,54,91,65,37,45,73,96,51,56,91,33,80,41,57,61,
+68,63,51,14,24,27,33,22,117,32,62,64,70,40,55,91,65,36,45,73,96,51,55,90,
+34,55,49,131,115,103,121,13,30,51,38,217,60,89,59,29,51,90,124,73,80,133,
+96,54,46,39,81,51,134,114,106,116,11,29,51,41,216,59,89,59,30,51,90,124,73,
+79,134,96,54,45,38,0,0,1,253,68,253,168,255,106,0,110,0,77,0,0,1,6,6,35,34,
+39,30,3,51,51,50,54,53,52,39,55,22,21,20,6,35,35,34,46,2,53,52,54,55,38,38,
+53,52,62,2,51,50,30,4,21,20,6,7,39,62,3,53,52,46,2,35,34,14,2,21,20,22,23,
+21,34,6,21,20,22,51,50,55,254,100,23,52,28,42,34,1,8,20,33,25,142,53,41,3,
+97,24,76,94,152,77,91,47,13,30,38,37,31,41,66,84,43,17,54,60,60,49,30,17,
+19,97,2,9,10,7,14,37,66,51,18,36,28,17,60,54,51,63,32,42,22,22,254,141,11,
+10,12,20,38,29,18,18,17,11,6,56,35,47,74,67,48,94,138,89,26,62,20,17,46,30,
+33,52,36,19,5,18,34,58,86,60,45,106,66,27,10,38,49,57,29,35,63,48,29,5,12,
+22,17,24,26,8,65,33,37,23,27,11,0,0,3,251,142,253,172,255,106,0,110,0,43,
+0,83,0,95,0,0,1,38,38,39,6,35,34,38,39,6,6,35,34,46,2,53,52,54,55,38,38,53,
+52,62,2,51,50,23,54,54,51,50,30,2,21,20,6,7,22,22,23,1,46,3,35,34,6,21,20,
+22,23,21,6,6,21,20,22,51,50,54,55,62,3,51,50,22,23,54,54,53,52,38,35,34,14,
+2,19,34,6,21,20,22,51,50,54,55,38,38,254,237,2,5,2,78,101,68,100,29,47,118,
+63,57,92,65,36,55,43,45,53,43,78,107,63,129,84,36,93,46,71,114,81,43,22,23,
+14,20,8,254,13,32,52,45,41,22,73,84,86,79,79,86,66,66,46,92,37,4,34,56,76,
+46,57,90,39,2,2,90,91,23,49,49,44,171,51,48,50,54,39,65,20,26,65,253,172,
+19,36,15,65,37,35,33,39,28,53,78,50,39,78,29,24,75,42,47,76,53,29,53,23,30,
+47,86,120,73,54,97,46,30,75,44,1,233,21,26,15,5,46,44,38,49,9,87,7,54,42,
+50,44,37,33,37,62,44,25,25,30,17,36,18,104,112,3,14,26,254,209,35,29,29,31,
+34,29,32,29,0,0,1,252,42,253,168,255,106,0,110,0,89,0,0,1,6,21,20,30,2,51,
+51,50,62,2,53,53,6,6,35,34,38,39,55,22,51,50,54,53,52,38,35,34,14,2,7,7,6,
+6,35,34,46,2,53,52,62,2,51,50,22,23,7,38,35,34,14,2,21,20,22,51,50,62,2,55,
+55,54,54,51,50,30,2,21,21,20,14,2,35,35,34,38,53,52,54,55,253,213,9,7,21,
+35,29,70,34,49,32,15,23,52,27,39,66,26,54,26,36,48,53,36,40,11,20,23,27,17,
+91,51,115,63,50,75,50,25,33,56,73,40,46,73,26,54,32,38,23,33,20,9,44,43,10,
+20,22,27,16,78,51,108,65,42,76,58,34,36,62,85,49,137,74,78,10,18,254,81,8,
+14,8,12,8,4,5,21,44,40,32,16,17,26,23,74,22,78,79,60,57,2,14,31,28,150,82,
+68,35,63,85,51,55,93,67,37,26,20,92,27,12,31,52,39,72,59,6,18,33,27,127,83,
+81,35,62,86,51,243,53,86,60,33,61,51,26,53,21,255,255,0,90,253,198,7,26,7,
+224,0,34,0,81,0,0,0,3,0,57,4,10,0,0,255,255,0,90,253,198,10,223,7,224,0,35,
+0,57,7,207,0,0,0,2,0,82,0,0,255,255,0,90,253,198,7,26,7,224,0,35,0,57,4,10,
+0,0,0,2,0,83,0,0,255,255,0,90,253,198,7,26,7,224,0,35,0,57,4,10,0,0,0,2,0,
+84,0,0,255,255,0,90,253,198,7,26,7,224,0,35,0,57,4,10,0,0,0,2,0,85,0,0,0,
+1,252,139,252,24,255,206,254,254,0,38,0,0,1,38,35,34,6,21,20,30,2,51,51,50,
+62,2,53,17,55,17,20,14,2,35,35,34,46,2,53,52,62,2,51,50,22,23,253,115,15,
+32,32,37,21,47,77,56,148,65,89,56,24,136,50,92,131,80,218,59,97,70,38,26,
+48,68,43,40,73,21,253,20,22,41,36,23,32,21,10,32,72,118,86,1,9,58,254,204,
+101,161,112,60,28,51,73,45,39,66,48,27,36,31,0,0,0,0,0,15,0,186,0,3,0,1,4,
+9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,
+1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,
+0,3,0,1,4,9,0,6,0,30,0,248,0,3,0,1,4,9,0,7,0,68,1,22,0,3,0,1,4,9,0,8,0,42,
+1,90,0,3,0,1,4,9,0,9,0,40,1,132,0,3,0,1,4,9,0,10,0,96,1,172,0,3,0,1,4,9,0,
+11,0,62,2,12,0,3,0,1,4,9,0,12,0,60,2,74,0,3,0,1,4,9,0,13,2,150,2,134,0,3,
+0,1,4,9,0,14,0,52,5,28,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,97,0,105,0,32,0,84,0,104,
+0,97,0,109,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,97,
+0,105,0,32,0,84,0,104,0,97,0,109,0,86,0,101,0,114,0,115,0,105,0,111,0,110,
+0,32,0,49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,
+0,110,0,115,0,84,0,97,0,105,0,84,0,104,0,97,0,109,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,0,0,1,2,0,2,0,3,1,
+3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,
+19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,
+1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,
+1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,
+1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,
+1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,
+1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,
+107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,
+1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,
+132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,
+1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,
+157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,
+1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,
+182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,
+1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,
+207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,
+1,220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,4,110,117,
+108,108,7,117,110,105,49,65,50,48,7,117,110,105,49,65,50,49,7,117,110,105,
+49,65,50,50,7,117,110,105,49,65,50,51,7,117,110,105,49,65,50,52,7,117,110,
+105,49,65,50,53,7,117,110,105,49,65,50,54,7,117,110,105,49,65,50,55,7,117,
+110,105,49,65,50,56,7,117,110,105,49,65,50,57,7,117,110,105,49,65,50,65,7,
+117,110,105,49,65,50,66,7,117,110,105,49,65,50,67,7,117,110,105,49,65,50,
+68,7,117,110,105,49,65,50,69,7,117,110,105,49,65,50,70,7,117,110,105,49,65,
+51,48,7,117,110,105,49,65,51,49,7,117,110,105,49,65,51,50,7,117,110,105,49,
+65,51,51,7,117,110,105,49,65,51,52,7,117,110,105,49,65,51,53,7,117,110,105,
+49,65,51,54,7,117,110,105,49,65,51,55,7,117,110,105,49,65,51,56,7,117,110,
+105,49,65,51,57,7,117,110,105,49,65,51,65,7,117,110,105,49,65,51,66,7,117,
+110,105,49,65,51,67,7,117,110,105,49,65,51,68,7,117,110,105,49,65,51,69,7,
+117,110,105,49,65,51,70,7,117,110,105,49,65,52,48,7,117,110,105,49,65,52,
+49,7,117,110,105,49,65,52,50,7,117,110,105,49,65,52,51,7,117,110,105,49,65,
+52,52,7,117,110,105,49,65,52,53,7,117,110,105,49,65,52,54,7,117,110,105,49,
+65,52,55,7,117,110,105,49,65,52,56,7,117,110,105,49,65,52,57,7,117,110,105,
+49,65,52,65,7,117,110,105,49,65,52,66,7,117,110,105,49,65,52,67,7,117,110,
+105,49,65,52,68,7,117,110,105,49,65,52,69,7,117,110,105,49,65,52,70,7,117,
+110,105,49,65,53,48,7,117,110,105,49,65,53,49,7,117,110,105,49,65,53,50,7,
+117,110,105,49,65,53,51,7,117,110,105,49,65,53,52,7,117,110,105,49,65,53,
+53,7,117,110,105,49,65,53,54,7,117,110,105,49,65,53,55,7,117,110,105,49,65,
+53,56,7,117,110,105,49,65,53,57,7,117,110,105,49,65,53,65,7,117,110,105,49,
+65,53,66,7,117,110,105,49,65,53,67,7,117,110,105,49,65,53,68,7,117,110,105,
+49,65,53,69,7,117,110,105,49,65,54,48,7,117,110,105,49,65,54,49,7,117,110,
+105,49,65,54,50,7,117,110,105,49,65,54,51,7,117,110,105,49,65,54,52,7,117,
+110,105,49,65,54,53,7,117,110,105,49,65,54,54,7,117,110,105,49,65,54,55,7,
+117,110,105,49,65,54,56,7,117,110,105,49,65,54,57,7,117,110,105,49,65,54,
+65,7,117,110,105,49,65,54,66,7,117,110,105,49,65,54,67,7,117,110,105,49,65,
+54,68,7,117,110,105,49,65,54,69,7,117,110,105,49,65,54,70,7,117,110,105,49,
+65,55,48,7,117,110,105,49,65,55,49,7,117,110,105,49,65,55,50,7,117,110,105,
+49,65,55,51,7,117,110,105,49,65,55,52,7,117,110,105,49,65,55,53,7,117,110,
+105,49,65,55,54,7,117,110,105,49,65,55,55,7,117,110,105,49,65,55,56,7,117,
+110,105,49,65,55,57,7,117,110,105,49,65,55,65,7,117,110,105,49,65,55,66,7,
+117,110,105,49,65,55,67,7,117,110,105,49,65,55,70,7,117,110,105,49,65,56,
+48,7,117,110,105,49,65,56,49,7,117,110,105,49,65,56,50,7,117,110,105,49,65,
+56,51,7,117,110,105,49,65,56,52,7,117,110,105,49,65,56,53,7,117,110,105,49,
+65,56,54,7,117,110,105,49,65,56,55,7,117,110,105,49,65,56,56,7,117,110,105,
+49,65,56,57,7,117,110,105,49,65,57,48,7,117,110,105,49,65,57,49,7,117,110,
+105,49,65,57,50,7,117,110,105,49,65,57,51,7,117,110,105,49,65,57,52,7,117,
+110,105,49,65,57,53,7,117,110,105,49,65,57,54,7,117,110,105,49,65,57,55,7,
+117,110,105,49,65,57,56,7,117,110,105,49,65,57,57,7,117,110,105,49,65,65,
+48,7,117,110,105,49,65,65,49,7,117,110,105,49,65,65,50,7,117,110,105,49,65,
+65,51,7,117,110,105,49,65,65,52,7,117,110,105,49,65,65,53,7,117,110,105,49,
+65,65,54,7,117,110,105,49,65,65,55,7,117,110,105,49,65,65,56,7,117,110,105,
+49,65,65,57,7,117,110,105,49,65,65,65,7,117,110,105,49,65,65,66,7,117,110,
+105,49,65,65,67,7,117,110,105,49,65,65,68,7,117,110,105,50,48,48,66,7,117,
+110,105,50,48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,50,50,49,57,7,
+117,110,105,50,53,67,67,11,117,110,105,49,65,50,48,46,97,108,116,11,117,110,
+105,49,65,50,49,46,97,108,116,11,117,110,105,49,65,50,50,46,97,108,116,11,
+117,110,105,49,65,50,51,46,97,108,116,11,117,110,105,49,65,50,52,46,97,108,
+116,11,117,110,105,49,65,50,53,46,97,108,116,11,117,110,105,49,65,50,54,46,
+97,108,116,11,117,110,105,49,65,50,55,46,97,108,116,11,117,110,105,49,65,
+50,56,46,97,108,116,11,117,110,105,49,65,50,57,46,97,108,116,11,117,110,105,
+49,65,50,65,46,97,108,116,11,117,110,105,49,65,50,66,46,97,108,116,11,117,
+110,105,49,65,50,67,46,97,108,116,11,117,110,105,49,65,50,68,46,97,108,116,
+11,117,110,105,49,65,50,69,46,97,108,116,11,117,110,105,49,65,50,70,46,97,
+108,116,11,117,110,105,49,65,51,48,46,97,108,116,11,117,110,105,49,65,51,
+49,46,97,108,116,11,117,110,105,49,65,51,50,46,97,108,116,11,117,110,105,
+49,65,51,51,46,97,108,116,11,117,110,105,49,65,51,52,46,97,108,116,11,117,
+110,105,49,65,51,53,46,97,108,116,11,117,110,105,49,65,51,54,46,97,108,116,
+11,117,110,105,49,65,51,55,46,97,108,116,11,117,110,105,49,65,51,56,46,97,
+108,116,11,117,110,105,49,65,51,57,46,97,108,116,11,117,110,105,49,65,51,
+65,46,97,108,116,11,117,110,105,49,65,51,66,46,97,108,116,11,117,110,105,
+49,65,51,67,46,97,108,116,11,117,110,105,49,65,51,68,46,97,108,116,11,117,
+110,105,49,65,51,69,46,97,108,116,11,117,110,105,49,65,51,70,46,97,108,116,
+11,117,110,105,49,65,52,48,46,97,108,116,11,117,110,105,49,65,52,49,46,97,
+108,116,11,117,110,105,49,65,52,50,46,97,108,116,11,117,110,105,49,65,52,
+51,46,97,108,116,11,117,110,105,49,65,52,52,46,97,108,116,11,117,110,105,
+49,65,52,53,46,97,108,116,11,117,110,105,49,65,52,54,46,97,108,116,11,117,
+110,105,49,65,52,55,46,97,108,116,11,117,110,105,49,65,52,56,46,97,108,116,
+11,117,110,105,49,65,52,57,46,97,108,116,11,117,110,105,49,65,52,65,46,97,
+108,116,11,117,110,105,49,65,52,66,46,97,108,116,11,117,110,105,49,65,52,
+67,46,97,108,116,12,117,110,105,49,65,50,48,46,98,108,119,102,12,117,110,
+105,49,65,50,49,46,98,108,119,102,12,117,110,105,49,65,50,50,46,98,108,119,
+102,12,117,110,105,49,65,50,51,46,98,108,119,102,12,117,110,105,49,65,50,
+52,46,98,108,119,102,12,117,110,105,49,65,50,53,46,98,108,119,102,12,117,
+110,105,49,65,50,54,46,98,108,119,102,12,117,110,105,49,65,50,55,46,98,108,
+119,102,12,117,110,105,49,65,50,56,46,98,108,119,102,12,117,110,105,49,65,
+50,57,46,98,108,119,102,12,117,110,105,49,65,50,65,46,98,108,119,102,12,117,
+110,105,49,65,50,66,46,98,108,119,102,12,117,110,105,49,65,50,67,46,98,108,
+119,102,12,117,110,105,49,65,50,68,46,98,108,119,102,12,117,110,105,49,65,
+50,69,46,98,108,119,102,12,117,110,105,49,65,50,70,46,98,108,119,102,12,117,
+110,105,49,65,51,48,46,98,108,119,102,12,117,110,105,49,65,51,49,46,98,108,
+119,102,12,117,110,105,49,65,51,50,46,98,108,119,102,12,117,110,105,49,65,
+51,51,46,98,108,119,102,12,117,110,105,49,65,51,52,46,98,108,119,102,12,117,
+110,105,49,65,51,53,46,98,108,119,102,12,117,110,105,49,65,51,54,46,98,108,
+119,102,12,117,110,105,49,65,51,55,46,98,108,119,102,12,117,110,105,49,65,
+51,56,46,98,108,119,102,12,117,110,105,49,65,51,57,46,98,108,119,102,12,117,
+110,105,49,65,51,65,46,98,108,119,102,12,117,110,105,49,65,51,66,46,98,108,
+119,102,12,117,110,105,49,65,51,67,46,98,108,119,102,12,117,110,105,49,65,
+51,68,46,98,108,119,102,12,117,110,105,49,65,51,69,46,98,108,119,102,12,117,
+110,105,49,65,51,70,46,98,108,119,102,12,117,110,105,49,65,52,48,46,98,108,
+119,102,12,117,110,105,49,65,52,49,46,98,108,119,102,12,117,110,105,49,65,
+52,50,46,98,108,119,102,12,117,110,105,49,65,52,51,46,98,108,119,102,12,117,
+110,105,49,65,52,52,46,98,108,119,102,12,117,110,105,49,65,52,53,46,98,108,
+119,102,12,117,110,105,49,65,52,54,46,98,108,119,102,12,117,110,105,49,65,
+52,55,46,98,108,119,102,12,117,110,105,49,65,52,56,46,98,108,119,102,12,117,
+110,105,49,65,52,57,46,98,108,119,102,12,117,110,105,49,65,52,65,46,98,108,
+119,102,12,117,110,105,49,65,52,66,46,98,108,119,102,12,117,110,105,49,65,
+52,67,46,98,108,119,102,11,117,110,105,49,65,53,53,49,65,54,69,11,117,110,
+105,49,65,53,53,49,65,54,70,11,117,110,105,49,65,53,53,49,65,55,48,11,117,
+110,105,49,65,53,53,49,65,55,49,11,117,110,105,49,65,53,53,49,65,55,50,11,
+117,110,105,49,65,53,66,46,97,108,116,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,
+0,12,0,0,0,88,0,0,0,2,0,12,0,0,0,57,0,1,0,58,0,58,0,3,0,59,0,59,0,1,0,60,
+0,67,0,3,0,68,0,68,0,1,0,69,0,69,0,3,0,70,0,71,0,1,0,72,0,79,0,3,0,80,0,85,
+0,1,0,86,0,96,0,3,0,97,0,230,0,1,0,231,0,231,0,3,0,4,0,0,0,1,0,0,0,1,0,0,
+0,10,0,34,0,82,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,3,0,0,0,1,0,2,0,
+3,100,105,115,116,0,20,109,97,114,107,0,30,109,107,109,107,0,42,0,0,0,3,0,
+0,0,1,0,7,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,1,0,6,0,8,0,18,0,26,0,34,0,42,0,50,
+0,58,0,66,0,74,0,2,0,0,0,1,0,64,0,2,0,0,0,1,1,136,0,4,0,0,0,1,2,220,0,4,0,
+0,0,1,4,16,0,4,0,0,0,1,5,154,0,4,0,0,0,1,7,80,0,6,0,0,0,1,8,188,0,2,0,0,0,
+1,9,36,0,1,1,70,0,0,0,5,0,45,0,100,0,144,0,144,0,144,0,144,0,100,0,144,0,
+144,0,100,0,144,0,144,0,100,0,100,0,144,0,144,0,144,0,144,0,100,0,100,0,100,
+0,144,0,144,0,100,0,144,0,144,0,144,0,144,0,144,0,144,0,100,0,144,0,100,0,
+144,0,100,0,100,0,100,0,144,0,144,0,144,0,100,0,100,0,100,0,144,0,100,0,100,
+0,7,0,204,0,0,1,94,0,205,0,0,1,94,0,212,0,0,1,94,0,213,0,0,1,94,0,216,0,0,
+1,94,0,220,0,0,1,94,0,221,0,0,1,94,0,30,0,181,0,150,0,0,0,186,0,150,0,0,0,
+187,0,80,0,0,0,188,0,80,0,0,0,189,0,150,0,0,0,192,0,150,0,0,0,193,0,150,0,
+0,0,194,0,150,0,0,0,197,0,60,0,0,0,198,0,150,0,0,0,199,0,150,0,0,0,200,0,
+150,0,0,0,203,0,150,0,0,0,205,0,0,1,94,0,206,0,150,0,0,0,207,0,150,0,0,0,
+208,0,80,0,0,0,209,0,80,0,0,0,210,0,150,0,0,0,211,0,150,0,0,0,212,0,0,1,94,
+0,213,0,0,1,94,0,214,0,80,0,0,0,215,0,80,0,0,0,216,0,0,1,94,0,220,0,0,1,94,
+0,221,0,0,1,94,0,222,0,150,0,0,0,224,0,150,0,0,0,225,0,150,0,0,0,2,0,1,0,
+136,0,180,0,0,0,1,1,52,0,0,0,3,0,6,1,38,0,22,0,22,0,22,0,22,0,22,0,45,0,181,
+0,0,254,152,0,182,0,0,254,152,0,183,0,0,254,152,0,184,0,0,254,152,0,185,0,
+0,254,152,0,186,0,0,254,152,0,187,0,0,254,152,0,188,0,0,254,152,0,189,0,0,
+254,152,0,190,0,0,254,152,0,191,0,0,254,152,0,192,0,0,254,152,0,193,0,0,254,
+152,0,194,0,0,254,152,0,195,0,0,254,152,0,196,0,0,254,152,0,197,0,0,254,152,
+0,198,0,0,254,152,0,199,0,0,254,152,0,200,0,0,254,152,0,201,0,0,254,152,0,
+202,0,0,254,152,0,203,0,0,254,152,0,204,0,0,254,152,0,205,0,0,254,152,0,206,
+0,0,254,152,0,207,0,0,254,152,0,208,0,0,254,152,0,209,0,0,254,152,0,210,0,
+0,254,152,0,211,0,0,254,152,0,212,0,0,254,152,0,213,0,0,254,152,0,214,0,0,
+254,152,0,215,0,0,254,152,0,216,0,0,254,152,0,217,0,0,254,152,0,218,0,0,254,
+152,0,219,0,0,254,152,0,220,0,0,254,152,0,221,0,0,254,152,0,222,0,0,254,152,
+0,223,0,0,254,152,0,224,0,0,254,152,0,225,0,0,254,152,0,2,0,186,0,100,0,0,
+0,198,0,200,0,0,0,2,0,6,0,148,0,148,0,0,0,150,0,150,0,1,0,170,0,170,0,2,0,
+172,0,172,0,3,0,178,0,178,0,4,0,180,0,180,0,5,0,1,1,4,1,44,0,1,0,12,0,66,
+0,13,0,0,20,244,0,0,21,150,0,0,20,232,0,0,20,250,0,0,20,250,0,0,20,238,0,
+0,21,120,0,0,21,126,0,0,21,132,0,0,20,250,0,0,20,238,0,0,21,138,0,0,21,144,
+0,96,20,202,20,172,20,208,20,214,20,220,20,202,20,214,20,214,20,226,20,214,
+20,220,20,232,20,238,20,244,20,244,20,172,20,244,20,250,20,238,21,0,21,6,
+21,0,21,12,21,12,21,12,21,18,21,24,21,30,21,36,21,42,21,12,20,202,21,48,21,
+12,21,30,20,238,20,172,21,54,21,12,21,60,21,60,20,238,21,12,20,226,21,60,
+21,30,21,30,21,126,21,186,21,192,21,180,21,102,21,108,21,114,21,48,21,120,
+21,102,21,48,21,48,21,18,21,126,21,132,21,138,20,244,21,54,21,54,21,144,20,
+172,21,42,20,244,20,172,21,54,20,172,21,126,21,48,21,48,21,54,21,150,21,156,
+21,162,21,18,21,48,21,102,21,168,21,126,20,172,21,18,21,108,21,174,21,126,
+20,244,20,244,21,18,21,48,21,18,21,18,0,2,0,6,0,61,0,62,0,0,0,69,0,69,0,2,
+0,72,0,75,0,3,0,78,0,78,0,7,0,86,0,87,0,8,0,93,0,95,0,10,0,2,0,2,0,4,0,54,
+0,0,0,136,0,180,0,51,0,1,1,102,1,136,0,3,0,12,0,50,0,9,0,0,20,210,0,2,20,
+222,0,0,20,228,0,0,20,228,0,0,20,234,0,1,24,212,0,1,22,40,0,0,20,204,0,0,
+20,198,0,51,20,154,24,186,20,178,20,202,21,180,21,90,20,202,21,180,21,90,
+20,208,21,138,21,96,20,208,24,192,21,96,20,214,24,198,21,102,20,220,24,204,
+21,6,20,226,24,210,21,108,20,154,24,216,21,114,20,208,24,186,21,120,20,208,
+24,222,21,120,20,154,24,186,21,126,20,232,24,228,21,114,20,238,24,234,21,
+132,20,244,24,168,21,132,20,250,24,180,21,138,21,0,25,14,21,144,21,6,25,20,
+21,150,21,12,25,26,21,156,21,18,25,26,21,162,20,238,24,222,21,168,21,24,25,
+32,21,174,21,30,25,38,21,180,21,36,25,44,21,96,21,36,24,246,21,96,20,238,
+24,234,21,186,20,238,25,50,21,192,21,42,25,56,21,198,21,42,25,56,21,198,21,
+48,25,62,21,204,20,208,21,96,21,96,20,154,24,186,21,210,21,54,25,68,21,216,
+20,220,25,74,21,222,21,60,25,80,21,228,21,66,25,86,21,234,21,72,24,240,21,
+240,20,202,24,246,21,12,20,208,24,252,21,108,21,66,25,2,21,114,21,66,24,228,
+21,114,21,66,25,92,21,234,21,78,25,98,21,246,21,66,25,104,21,204,21,84,25,
+110,21,252,22,8,25,8,21,228,22,8,25,116,22,14,22,44,25,122,22,20,22,44,25,
+128,22,26,22,50,25,134,22,32,22,56,25,140,22,38,0,2,0,5,0,58,0,58,0,0,0,63,
+0,66,0,1,0,76,0,77,0,5,0,79,0,79,0,7,0,96,0,96,0,8,0,2,0,1,0,4,0,54,0,0,0,
+1,1,164,1,174,0,2,0,12,0,34,0,5,0,0,20,210,0,0,20,228,0,1,20,234,0,1,20,222,
+0,1,20,222,0,96,18,28,20,194,17,254,20,218,18,34,20,224,18,40,20,230,18,46,
+20,236,18,28,20,242,18,40,20,248,18,40,20,254,18,52,20,194,18,40,21,4,18,
+46,21,10,18,58,21,16,18,64,20,194,18,70,21,22,18,70,21,22,17,254,18,142,18,
+70,20,254,18,76,21,28,18,64,20,194,18,82,21,34,18,88,18,76,18,82,18,76,18,
+94,18,64,18,94,18,28,18,94,21,40,18,100,18,76,18,106,21,46,18,112,21,52,18,
+118,21,58,18,124,20,194,18,94,20,254,18,28,21,64,18,130,21,70,18,94,21,22,
+18,112,21,76,18,64,21,82,17,254,18,124,18,136,18,64,18,94,21,88,18,142,20,
+194,18,142,20,194,18,64,20,194,18,94,21,88,18,52,20,194,18,142,20,194,18,
+112,21,22,18,112,21,208,18,208,20,218,19,12,20,224,19,18,18,142,19,6,21,94,
+18,184,21,100,18,190,21,106,18,196,21,112,18,130,21,118,18,202,21,124,18,
+184,21,130,18,130,21,136,18,130,21,118,18,100,21,142,18,208,21,148,18,214,
+21,154,18,220,21,160,18,70,21,100,18,136,18,142,18,136,18,142,18,226,18,70,
+17,254,21,166,18,124,21,172,18,70,21,100,17,254,18,64,18,136,21,178,17,254,
+21,178,18,208,18,70,18,130,18,184,18,130,18,58,18,136,21,184,18,232,21,190,
+18,238,18,52,18,244,21,196,18,100,21,100,18,130,18,184,18,184,21,202,18,250,
+18,58,18,208,18,142,17,254,18,142,18,100,21,100,18,190,18,82,19,0,18,100,
+18,208,21,166,18,70,21,100,18,70,21,100,18,100,21,100,18,130,21,178,18,100,
+21,100,18,100,21,100,0,2,0,1,0,88,0,92,0,0,0,2,0,2,0,4,0,54,0,0,0,136,0,180,
+0,51,0,1,1,66,1,106,0,3,0,12,0,50,0,9,0,0,17,130,0,0,17,148,0,0,17,148,0,
+0,17,154,0,1,21,24,0,1,18,216,0,0,17,124,0,0,17,118,0,2,21,12,0,45,20,86,
+20,248,20,92,20,98,20,236,20,92,20,98,20,236,20,92,20,104,20,254,20,92,20,
+104,20,236,20,92,20,110,20,236,20,92,20,116,20,236,20,92,20,122,20,236,20,
+92,20,128,20,236,20,92,20,134,20,236,20,92,20,104,20,236,20,92,20,140,21,
+4,20,92,20,86,20,236,20,92,20,146,20,236,20,92,20,104,20,236,20,92,20,104,
+20,236,20,92,20,116,20,236,20,92,20,152,20,248,20,92,20,86,21,10,20,92,20,
+86,20,236,20,92,20,122,20,236,20,92,20,116,20,236,20,92,20,158,21,16,20,218,
+20,164,21,22,20,224,20,170,21,28,20,224,20,176,20,236,20,92,20,116,20,236,
+20,92,20,182,21,34,20,92,20,182,20,236,20,92,20,86,21,40,20,92,20,158,21,
+46,20,92,20,188,21,52,20,224,20,194,21,52,20,224,20,146,20,236,20,92,20,122,
+20,236,20,92,20,188,21,52,20,224,20,104,20,236,20,92,20,200,21,34,20,92,20,
+122,21,58,20,92,20,206,21,64,20,224,20,212,21,70,20,224,20,86,21,76,20,92,
+20,98,20,236,20,92,20,86,20,236,20,92,20,182,21,82,20,92,0,2,0,6,0,58,0,58,
+0,0,0,64,0,66,0,1,0,76,0,77,0,4,0,79,0,79,0,6,0,96,0,96,0,7,0,231,0,231,0,
+8,0,2,0,1,0,181,0,225,0,0,0,1,0,62,0,72,0,1,0,12,0,34,0,5,0,0,17,160,0,0,
+18,198,0,0,18,192,0,0,18,204,0,0,18,204,0,13,18,188,18,194,18,164,18,200,
+18,200,18,200,18,206,18,212,18,218,18,224,18,230,18,236,18,236,0,2,0,1,0,
+88,0,92,0,0,0,2,0,6,0,61,0,62,0,0,0,69,0,69,0,2,0,72,0,75,0,3,0,78,0,78,0,
+7,0,86,0,87,0,8,0,93,0,95,0,10,0,1,14,116,0,1,0,5,0,45,0,100,0,190,0,190,
+1,24,1,114,1,204,2,38,2,128,2,218,3,52,3,52,3,142,3,232,4,66,4,66,4,156,4,
+246,5,80,5,170,6,4,6,94,6,184,7,18,7,108,7,198,8,32,8,122,8,212,9,46,9,136,
+7,108,9,226,10,60,10,150,10,240,11,74,11,164,11,254,12,88,12,178,12,178,13,
+12,13,102,13,192,14,26,0,11,0,57,2,28,248,128,2,88,0,81,4,116,248,148,0,0,
+0,82,8,52,248,168,0,0,0,83,4,116,248,148,0,0,0,84,4,116,248,148,0,0,0,85,
+4,116,248,148,0,0,0,226,6,64,248,148,0,0,0,227,10,20,248,168,0,0,0,228,6,
+64,248,148,0,0,0,229,6,64,248,148,0,0,0,230,6,64,248,148,0,0,0,11,0,57,2,
+28,251,180,0,100,0,81,4,116,251,140,0,0,0,82,8,52,251,160,0,0,0,83,4,116,
+251,140,0,0,0,84,4,116,251,140,0,0,0,85,4,116,251,140,0,0,0,226,6,64,251,
+180,0,0,0,227,10,20,251,160,0,0,0,228,6,64,251,180,0,0,0,229,6,64,251,180,
+0,0,0,230,6,64,251,180,0,0,0,11,0,57,2,28,251,40,0,100,0,81,4,116,251,60,
+0,0,0,82,8,52,251,80,0,0,0,83,4,116,251,60,0,0,0,84,4,116,251,60,0,0,0,85,
+4,116,251,60,0,0,0,226,6,64,251,60,0,0,0,227,10,20,251,80,0,0,0,228,6,64,
+251,60,0,0,0,229,6,64,251,60,0,0,0,230,6,64,251,60,0,0,0,11,0,57,2,28,251,
+60,0,100,0,81,4,116,251,80,0,0,0,82,8,52,251,80,0,0,0,83,4,116,251,80,0,0,
+0,84,4,116,251,80,0,0,0,85,4,116,251,80,0,0,0,226,6,64,251,80,0,0,0,227,10,
+20,251,80,0,0,0,228,6,64,251,80,0,0,0,229,6,64,251,80,0,0,0,230,6,64,251,
+80,0,0,0,11,0,57,2,28,247,104,0,100,0,81,4,116,247,164,0,0,0,82,8,52,247,
+164,0,0,0,83,4,116,247,164,0,0,0,84,4,116,247,164,0,0,0,85,4,116,247,164,
+0,0,0,226,6,64,247,164,0,0,0,227,10,20,247,164,0,0,0,228,6,64,247,164,0,0,
+0,229,6,64,247,164,0,0,0,230,6,64,247,164,0,0,0,11,0,57,2,28,250,206,0,100,
+0,81,4,116,250,216,0,0,0,82,8,52,250,236,0,0,0,83,4,116,250,216,0,0,0,84,
+4,116,250,216,0,0,0,85,4,116,250,216,0,0,0,226,6,64,250,216,0,0,0,227,10,
+20,250,236,0,0,0,228,6,64,250,216,0,0,0,229,6,64,250,216,0,0,0,230,6,64,250,
+216,0,0,0,11,0,57,2,28,251,20,0,100,0,81,4,116,251,20,0,0,0,82,8,52,251,40,
+0,0,0,83,4,116,251,20,0,0,0,84,4,116,251,20,0,0,0,85,4,116,251,20,0,0,0,226,
+6,64,251,20,0,0,0,227,10,20,251,40,0,0,0,228,6,64,251,20,0,0,0,229,6,64,251,
+20,0,0,0,230,6,64,251,20,0,0,0,11,0,57,2,28,248,168,0,100,0,81,4,116,248,
+148,0,0,0,82,8,52,248,148,0,0,0,83,4,116,248,148,0,0,0,84,4,116,248,148,0,
+0,0,85,4,116,248,148,0,0,0,226,6,64,248,148,0,0,0,227,10,20,248,148,0,0,0,
+228,6,64,248,148,0,0,0,229,6,64,248,148,0,0,0,230,6,64,248,148,0,0,0,11,0,
+57,2,28,251,100,0,100,0,81,4,116,251,160,0,0,0,82,8,52,251,150,0,0,0,83,4,
+116,251,160,0,0,0,84,4,116,251,160,0,0,0,85,4,116,251,160,0,0,0,226,6,64,
+251,160,0,0,0,227,10,20,251,150,0,0,0,228,6,64,251,160,0,0,0,229,6,64,251,
+160,0,0,0,230,6,64,251,160,0,0,0,11,0,57,2,28,248,8,0,100,0,81,4,116,248,
+8,0,0,0,82,8,52,248,8,0,0,0,83,4,116,248,8,0,0,0,84,4,116,248,8,0,0,0,85,
+4,116,248,8,0,0,0,226,6,64,248,8,0,0,0,227,10,20,248,8,0,0,0,228,6,64,248,
+8,0,0,0,229,6,64,248,8,0,0,0,230,6,64,248,8,0,0,0,11,0,57,2,28,248,128,0,
+100,0,81,4,116,248,158,0,0,0,82,8,52,248,148,0,0,0,83,4,116,248,158,0,0,0,
+84,4,116,248,158,0,0,0,85,4,116,248,158,0,0,0,226,6,64,248,158,0,0,0,227,
+10,20,248,148,0,0,0,228,6,64,248,158,0,0,0,229,6,64,248,158,0,0,0,230,6,64,
+248,158,0,0,0,11,0,57,2,28,250,116,0,100,0,81,4,116,250,136,0,0,0,82,8,52,
+250,136,0,0,0,83,4,116,250,136,0,0,0,84,4,116,250,136,0,0,0,85,4,116,250,
+136,0,0,0,226,6,64,250,136,0,0,0,227,10,20,250,136,0,0,0,228,6,64,250,136,
+0,0,0,229,6,64,250,136,0,0,0,230,6,64,250,136,0,0,0,11,0,57,2,28,251,180,
+0,100,0,81,4,116,251,180,0,0,0,82,8,52,251,180,0,0,0,83,4,116,251,180,0,0,
+0,84,4,116,251,180,0,0,0,85,4,116,251,180,0,0,0,226,6,64,251,180,0,0,0,227,
+10,20,251,180,0,0,0,228,6,64,251,180,0,0,0,229,6,64,251,180,0,0,0,230,6,64,
+251,180,0,0,0,11,0,57,2,28,250,136,0,100,0,81,4,116,250,196,0,0,0,82,8,52,
+250,236,0,0,0,83,4,116,250,196,0,0,0,84,4,116,250,196,0,0,0,85,4,116,250,
+196,0,0,0,226,6,64,250,196,0,0,0,227,10,20,250,236,0,0,0,228,6,64,250,196,
+0,0,0,229,6,64,250,196,0,0,0,230,6,64,250,196,0,0,0,11,0,57,2,28,247,44,0,
+100,0,81,4,116,247,94,0,0,0,82,8,52,247,74,0,0,0,83,4,116,247,94,0,0,0,84,
+4,116,247,94,0,0,0,85,4,116,247,94,0,0,0,226,6,64,247,94,0,0,0,227,10,20,
+247,74,0,0,0,228,6,64,247,94,0,0,0,229,6,64,247,94,0,0,0,230,6,64,247,94,
+0,0,0,11,0,57,2,28,248,208,0,100,0,81,4,116,248,228,0,0,0,82,8,52,248,238,
+0,0,0,83,4,116,248,228,0,0,0,84,4,116,248,228,0,0,0,85,4,116,248,228,0,0,
+0,226,6,64,248,228,0,0,0,227,10,20,248,238,0,0,0,228,6,64,248,228,0,0,0,229,
+6,64,248,228,0,0,0,230,6,64,248,228,0,0,0,11,0,57,2,28,250,76,0,100,0,81,
+4,116,250,76,0,0,0,82,8,52,250,106,0,0,0,83,4,116,250,76,0,0,0,84,4,116,250,
+76,0,0,0,85,4,116,250,76,0,0,0,226,6,64,250,76,0,0,0,227,10,20,250,106,0,
+0,0,228,6,64,250,76,0,0,0,229,6,64,250,76,0,0,0,230,6,64,250,76,0,0,0,11,
+0,57,2,28,250,176,0,100,0,81,4,116,250,216,0,0,0,82,8,52,250,236,0,0,0,83,
+4,116,250,216,0,0,0,84,4,116,250,216,0,0,0,85,4,116,250,216,0,0,0,226,6,64,
+250,216,0,0,0,227,10,20,250,236,0,0,0,228,6,64,250,216,0,0,0,229,6,64,250,
+216,0,0,0,230,6,64,250,216,0,0,0,11,0,57,2,28,250,196,0,100,0,81,4,116,250,
+236,0,0,0,82,8,52,250,236,0,0,0,83,4,116,250,236,0,0,0,84,4,116,250,236,0,
+0,0,85,4,116,250,236,0,0,0,226,6,64,250,236,0,0,0,227,10,20,250,236,0,0,0,
+228,6,64,250,236,0,0,0,229,6,64,250,236,0,0,0,230,6,64,250,236,0,0,0,11,0,
+57,2,28,251,120,0,100,0,81,4,116,251,170,0,0,0,82,8,52,251,170,0,0,0,83,4,
+116,251,170,0,0,0,84,4,116,251,170,0,0,0,85,4,116,251,170,0,0,0,226,6,64,
+251,170,0,0,0,227,10,20,251,170,0,0,0,228,6,64,251,170,0,0,0,229,6,64,251,
+170,0,0,0,230,6,64,251,170,0,0,0,11,0,57,2,28,251,40,0,100,0,81,4,116,251,
+80,0,0,0,82,8,52,251,80,0,0,0,83,4,116,251,80,0,0,0,84,4,116,251,80,0,0,0,
+85,4,116,251,80,0,0,0,226,6,64,251,80,0,0,0,227,10,20,251,80,0,0,0,228,6,
+64,251,80,0,0,0,229,6,64,251,80,0,0,0,230,6,64,251,80,0,0,0,11,0,57,2,28,
+250,226,0,100,0,81,4,116,251,20,0,0,0,82,8,52,251,40,0,0,0,83,4,116,251,20,
+0,0,0,84,4,116,251,20,0,0,0,85,4,116,251,20,0,0,0,226,6,64,251,20,0,0,0,227,
+10,20,251,40,0,0,0,228,6,64,251,20,0,0,0,229,6,64,251,20,0,0,0,230,6,64,251,
+20,0,0,0,11,0,57,2,28,250,76,0,100,0,81,4,116,250,76,0,0,0,82,8,52,250,76,
+0,0,0,83,4,116,250,76,0,0,0,84,4,116,250,76,0,0,0,85,4,116,250,76,0,0,0,226,
+6,64,250,76,0,0,0,227,10,20,250,76,0,0,0,228,6,64,250,76,0,0,0,229,6,64,250,
+76,0,0,0,230,6,64,250,76,0,0,0,11,0,57,2,28,250,96,0,100,0,81,4,116,250,96,
+0,0,0,82,8,52,250,116,0,0,0,83,4,116,250,96,0,0,0,84,4,116,250,96,0,0,0,85,
+4,116,250,96,0,0,0,226,6,64,250,96,0,0,0,227,10,20,250,116,0,0,0,228,6,64,
+250,96,0,0,0,229,6,64,250,96,0,0,0,230,6,64,250,96,0,0,0,11,0,57,2,28,250,
+156,0,100,0,81,4,116,250,216,0,0,0,82,8,52,250,216,0,0,0,83,4,116,250,216,
+0,0,0,84,4,116,250,216,0,0,0,85,4,116,250,216,0,0,0,226,6,64,250,216,0,0,
+0,227,10,20,250,216,0,0,0,228,6,64,250,216,0,0,0,229,6,64,250,216,0,0,0,230,
+6,64,250,216,0,0,0,11,0,57,2,28,250,156,0,100,0,81,4,116,250,216,0,0,0,82,
+8,52,250,236,0,0,0,83,4,116,250,216,0,0,0,84,4,116,250,216,0,0,0,85,4,116,
+250,216,0,0,0,226,6,64,250,216,0,0,0,227,10,20,250,236,0,0,0,228,6,64,250,
+216,0,0,0,229,6,64,250,216,0,0,0,230,6,64,250,216,0,0,0,11,0,57,2,28,248,
+208,0,100,0,81,4,116,248,188,0,0,0,82,8,52,248,198,0,0,0,83,4,116,248,188,
+0,0,0,84,4,116,248,188,0,0,0,85,4,116,248,188,0,0,0,226,6,64,248,188,0,0,
+0,227,10,20,248,198,0,0,0,228,6,64,248,188,0,0,0,229,6,64,248,188,0,0,0,230,
+6,64,248,188,0,0,0,11,0,57,2,28,248,28,0,100,0,81,4,116,248,48,0,0,0,82,8,
+52,248,68,0,0,0,83,4,116,248,48,0,0,0,84,4,116,248,48,0,0,0,85,4,116,248,
+48,0,0,0,226,6,64,248,48,0,0,0,227,10,20,248,68,0,0,0,228,6,64,248,48,0,0,
+0,229,6,64,248,48,0,0,0,230,6,64,248,48,0,0,0,11,0,57,2,28,251,0,0,100,0,
+81,4,116,251,30,0,0,0,82,8,52,251,20,0,0,0,83,4,116,251,30,0,0,0,84,4,116,
+251,30,0,0,0,85,4,116,251,30,0,0,0,226,6,64,251,30,0,0,0,227,10,20,251,20,
+0,0,0,228,6,64,251,30,0,0,0,229,6,64,251,30,0,0,0,230,6,64,251,30,0,0,0,11,
+0,57,2,28,250,196,0,100,0,81,4,116,250,216,0,0,0,82,8,52,250,216,0,0,0,83,
+4,116,250,216,0,0,0,84,4,116,250,216,0,0,0,85,4,116,250,216,0,0,0,226,6,64,
+250,216,0,0,0,227,10,20,250,216,0,0,0,228,6,64,250,216,0,0,0,229,6,64,250,
+216,0,0,0,230,6,64,250,216,0,0,0,11,0,57,2,28,250,156,0,100,0,81,4,116,250,
+196,0,0,0,82,8,52,250,196,0,0,0,83,4,116,250,196,0,0,0,84,4,116,250,196,0,
+0,0,85,4,116,250,196,0,0,0,226,6,64,250,196,0,0,0,227,10,20,250,196,0,0,0,
+228,6,64,250,196,0,0,0,229,6,64,250,196,0,0,0,230,6,64,250,196,0,0,0,11,0,
+57,2,28,248,168,0,100,0,81,4,116,248,228,0,0,0,82,8,52,248,228,0,0,0,83,4,
+116,248,228,0,0,0,84,4,116,248,228,0,0,0,85,4,116,248,228,0,0,0,226,6,64,
+248,228,0,0,0,227,10,20,248,228,0,0,0,228,6,64,248,228,0,0,0,229,6,64,248,
+228,0,0,0,230,6,64,248,228,0,0,0,11,0,57,2,28,251,140,0,100,0,81,4,116,251,
+160,0,0,0,82,8,52,251,150,0,0,0,83,4,116,251,160,0,0,0,84,4,116,251,160,0,
+0,0,85,4,116,251,160,0,0,0,226,6,64,251,160,0,0,0,227,10,20,251,150,0,0,0,
+228,6,64,251,160,0,0,0,229,6,64,251,160,0,0,0,230,6,64,251,160,0,0,0,11,0,
+57,2,28,251,140,0,100,0,81,4,116,251,200,0,0,0,82,8,52,251,200,0,0,0,83,4,
+116,251,200,0,0,0,84,4,116,251,200,0,0,0,85,4,116,251,200,0,0,0,226,6,64,
+251,200,0,0,0,227,10,20,251,200,0,0,0,228,6,64,251,200,0,0,0,229,6,64,251,
+200,0,0,0,230,6,64,251,200,0,0,0,11,0,57,2,28,251,30,0,100,0,81,4,116,251,
+80,0,0,0,82,8,52,251,90,0,0,0,83,4,116,251,80,0,0,0,84,4,116,251,80,0,0,0,
+85,4,116,251,80,0,0,0,226,6,64,251,80,0,0,0,227,10,20,251,90,0,0,0,228,6,
+64,251,80,0,0,0,229,6,64,251,80,0,0,0,230,6,64,251,80,0,0,0,11,0,57,2,28,
+248,148,0,100,0,81,4,116,248,138,0,0,0,82,8,52,248,138,0,0,0,83,4,116,248,
+138,0,0,0,84,4,116,248,138,0,0,0,85,4,116,248,138,0,0,0,226,6,64,248,138,
+0,0,0,227,10,20,248,138,0,0,0,228,6,64,248,138,0,0,0,229,6,64,248,138,0,0,
+0,230,6,64,248,138,0,0,0,11,0,57,2,28,248,168,0,100,0,81,4,116,248,228,0,
+0,0,82,8,52,248,218,0,0,0,83,4,116,248,228,0,0,0,84,4,116,248,228,0,0,0,85,
+4,116,248,228,0,0,0,226,6,64,248,228,0,0,0,227,10,20,248,218,0,0,0,228,6,
+64,248,228,0,0,0,229,6,64,248,228,0,0,0,230,6,64,248,228,0,0,0,11,0,57,2,
+28,250,176,0,100,0,81,4,116,250,236,0,0,0,82,8,52,251,0,0,0,0,83,4,116,250,
+236,0,0,0,84,4,116,250,236,0,0,0,85,4,116,250,236,0,0,0,226,6,64,250,236,
+0,0,0,227,10,20,251,0,0,0,0,228,6,64,250,236,0,0,0,229,6,64,250,236,0,0,0,
+230,6,64,250,236,0,0,0,11,0,57,2,28,248,188,0,100,0,81,4,116,248,198,0,0,
+0,82,8,52,248,218,0,0,0,83,4,116,248,198,0,0,0,84,4,116,248,198,0,0,0,85,
+4,116,248,198,0,0,0,226,6,64,248,198,0,0,0,227,10,20,248,218,0,0,0,228,6,
+64,248,198,0,0,0,229,6,64,248,198,0,0,0,230,6,64,248,198,0,0,0,11,0,57,2,
+28,248,168,0,100,0,81,4,116,248,218,0,0,0,82,8,52,248,228,0,0,0,83,4,116,
+248,218,0,0,0,84,4,116,248,218,0,0,0,85,4,116,248,218,0,0,0,226,6,64,248,
+228,0,0,0,227,10,20,248,228,0,0,0,228,6,64,248,228,0,0,0,229,6,64,248,228,
+0,0,0,230,6,64,248,228,0,0,0,2,0,1,0,4,0,48,0,0,0,1,1,244,4,176,0,1,254,12,
+4,176,0,1,253,128,4,176,0,1,253,158,4,176,0,1,253,228,4,176,0,1,3,212,4,176,
+0,1,1,244,7,8,0,1,2,68,4,176,0,1,2,68,7,8,0,1,3,132,4,176,0,1,3,212,6,64,
+0,1,3,112,4,176,0,1,2,188,4,176,0,1,4,76,4,176,0,1,2,128,4,176,0,1,2,208,
+4,176,0,1,2,88,4,176,0,1,2,168,4,176,0,1,2,88,7,8,0,1,2,148,4,176,0,1,2,148,
+7,8,0,1,3,72,4,176,0,1,1,204,4,176,0,1,2,28,4,176,0,1,3,92,4,176,0,1,252,
+164,4,176,0,1,253,88,4,36,0,1,254,72,4,176,0,1,254,132,4,176,0,1,253,168,
+4,176,0,1,253,248,4,176,0,1,2,228,4,176,0,1,1,144,4,176,0,1,1,144,6,64,0,
+1,1,204,6,64,0,1,1,224,4,176,0,1,1,224,6,64,0,1,2,188,6,64,0,1,1,124,4,176,
+0,1,2,28,6,64,0,1,2,8,4,176,0,1,2,8,6,64,0,1,1,104,4,176,0,1,1,164,4,176,
+0,1,5,20,4,176,0,1,1,224,7,8,0,1,2,98,4,176,0,1,3,212,0,0,0,1,254,212,0,0,
+0,1,254,112,0,0,0,1,253,168,0,0,0,1,6,179,0,0,0,1,255,66,0,0,0,1,254,32,0,
+0,0,1,253,208,0,0,0,1,2,48,0,0,0,1,2,88,0,0,0,1,4,76,0,0,0,1,2,188,0,0,0,
+1,2,98,0,0,0,1,5,12,0,0,0,1,2,208,0,0,0,1,2,238,254,12,0,1,1,178,0,0,0,1,
+2,168,0,0,0,1,4,86,0,0,0,1,3,152,0,0,0,1,2,238,0,0,0,1,2,158,0,0,0,1,1,191,
+0,0,0,1,2,108,0,0,0,1,2,148,0,0,0,1,3,92,0,0,0,1,2,18,0,0,0,1,2,148,253,208,
+0,1,3,132,0,0,0,1,1,224,253,208,0,1,2,128,253,208,0,1,3,132,253,208,0,1,3,
+122,0,0,0,1,4,16,0,0,0,1,7,168,0,0,0,1,4,6,0,0,0,1,6,144,0,0,0,1,3,172,0,
+0,0,1,7,38,0,0,0,1,4,176,0,0,0,1,3,90,0,0,0,1,4,156,0,0,0,1,8,12,0,0,0,1,
+6,114,0,0,0,1,4,246,0,0,0,1,4,106,0,0,0,1,4,96,0,0,0,1,3,142,0,0,0,1,4,226,
+0,0,0,1,4,216,0,0,0,1,4,136,0,0,0,1,6,84,0,0,0,1,7,28,0,0,0,1,3,232,0,0,0,
+1,4,116,0,0,0,1,4,136,253,208,0,1,6,124,0,0,0,1,3,152,253,208,0,1,4,76,253,
+208,0,1,6,128,0,0,0,1,0,0,0,0,0,1,2,168,253,208,0,1,5,200,254,52,0,1,2,199,
+253,183,0,1,2,212,254,31,0,1,4,3,253,248,0,1,8,2,0,0,0,1,2,68,0,0,0,1,2,138,
+253,208,0,1,5,0,0,0,0,1,255,56,4,176,0,1,6,64,4,176,0,1,255,106,4,176,0,1,
+254,112,4,176,0,1,255,16,4,176,0,1,3,32,4,176,0,1,3,32,7,8,0,1,3,122,4,176,
+0,1,3,122,7,8,0,1,7,88,4,176,0,1,3,252,4,176,0,1,4,6,4,176,0,1,3,162,4,176,
+0,1,3,162,7,8,0,1,6,214,4,176,0,1,4,56,4,176,0,1,7,238,4,176,0,1,4,236,4,
+176,0,1,4,216,7,8,0,1,4,76,7,8,0,1,4,96,4,176,0,1,4,26,7,8,0,1,6,244,4,176,
+0,1,4,251,7,8,0,1,4,121,4,176,0,1,6,129,4,176,0,1,4,16,4,176,0,1,7,128,4,
+176,0,1,4,216,4,176,0,1,2,130,4,176,0,1,2,78,6,64,0,1,3,17,4,176,0,1,2,208,
+6,64,0,1,5,181,4,176,0,1,3,69,4,176,0,1,5,10,4,176,0,1,2,218,4,176,0,1,2,
+98,6,64,0,1,5,60,4,176,0,1,3,12,4,176,0,1,5,250,4,176,0,1,3,52,4,176,0,1,
+3,152,4,176,0,1,3,112,6,64,0,1,3,132,6,64,0,1,5,80,4,176,0,1,3,87,5,225,0,
+1,254,172,7,8,0,1,255,26,4,196,0,1,255,56,4,196,0,1,255,116,4,196,0,1,253,
+178,7,148,0,1,253,248,7,148,0,1,254,52,7,148,0,1,253,158,7,148,0,1,253,228,
+6,164,0,1,254,72,7,8,0,1,254,212,6,164,0,1,254,142,7,148,0,1,255,116,7,148,
+0,1,253,157,253,188,0,1,255,106,253,228,0,1,254,109,253,188,0,1,254,70,253,
+188,0,1,253,79,253,188,0,1,254,31,253,188,0,1,254,44,253,188,0,1,253,118,
+253,188,0,1,254,83,253,188,0,1,253,92,253,188,0,1,254,5,253,188,0,1,253,1,
+253,188,0,1,253,157,254,92,0,1,254,57,253,188,0,1,255,61,253,188,0,1,253,
+248,253,188,0,1,254,18,253,188,0,1,254,252,253,188,0,1,255,178,253,188,0,
+1,254,96,253,188,0,1,254,226,253,188,0,1,254,187,253,188,0,1,255,106,254,
+152,0,1,0,224,253,228,0,1,255,206,254,12,0,1,254,252,253,248,0,1,254,72,0,
+26,0,1,254,152,253,248,0,1,254,232,253,248,0,1,254,192,253,248,0,1,254,162,
+253,248,0,1,254,92,254,174,0,1,255,230,253,248,0,1,0,52,253,248,0,1,254,213,
+253,248,0,1,254,109,253,248,0,1,254,96,254,174,0,1,0,0,253,248,0,1,254,226,
+253,248,0,1,255,204,253,248,0,1,255,217,253,248,0,1,254,122,253,248,0,1,254,
+148,253,248,0,1,3,103,253,235,0,1,254,72,0,0,0,1,3,152,254,239,0,1,5,150,
+0,0,0,1,3,64,0,0,0,1,6,37,0,0,0,1,4,46,0,0,0,1,2,216,0,0,0,1,5,46,0,0,0,1,
+2,229,0,0,0,1,5,7,0,0,0,1,3,207,0,0,0,1,3,142,254,18,0,1,2,138,0,0,0,1,3,
+103,0,0,0,1,6,154,0,0,0,1,3,181,254,5,0,1,3,168,0,0,0,1,6,193,0,0,0,1,5,20,
+0,0,0,1,3,155,0,0,0,1,4,68,254,161,0,1,2,99,0,0,0,1,3,181,0,0,0,1,3,220,0,
+0,0,1,4,237,0,0,0,1,2,60,0,0,0,1,4,81,0,0,0,1,4,81,254,5,0,1,5,85,0,0,0,1,
+5,59,0,0,0,1,3,77,254,18,0,1,6,102,0,0,0,1,5,111,253,235,0,1,3,181,253,235,
+0,1,2,8,253,235,0,1,1,225,254,5,0,1,3,12,254,18,0,1,8,19,255,217,0,1,0,0,
+0,10,0,30,0,50,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,
+109,112,0,8,0,0,0,4,0,0,0,1,0,2,0,3,0,6,0,14,0,22,0,30,0,38,0,46,0,54,0,4,
+0,0,0,1,0,48,0,6,0,0,0,1,1,160,0,4,0,0,0,1,1,190,0,6,0,0,0,1,1,238,0,1,0,
+0,0,1,2,8,0,1,0,0,0,1,2,106,0,1,1,114,0,1,0,8,0,45,0,92,0,98,0,104,0,110,
+0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,
+188,0,194,0,200,0,206,0,212,0,218,0,224,0,230,0,236,0,242,0,248,0,254,1,4,
+1,10,1,16,1,22,1,28,1,34,1,40,1,46,1,52,1,58,1,64,1,70,1,76,1,82,1,88,1,94,
+1,100,0,181,0,2,0,4,0,182,0,2,0,5,0,183,0,2,0,6,0,184,0,2,0,7,0,185,0,2,0,
+8,0,186,0,2,0,9,0,187,0,2,0,10,0,188,0,2,0,11,0,189,0,2,0,12,0,190,0,2,0,
+13,0,191,0,2,0,14,0,192,0,2,0,15,0,193,0,2,0,16,0,194,0,2,0,17,0,195,0,2,
+0,18,0,196,0,2,0,19,0,197,0,2,0,20,0,198,0,2,0,21,0,199,0,2,0,22,0,200,0,
+2,0,23,0,201,0,2,0,24,0,202,0,2,0,25,0,203,0,2,0,26,0,204,0,2,0,27,0,205,
+0,2,0,28,0,206,0,2,0,29,0,207,0,2,0,30,0,208,0,2,0,31,0,209,0,2,0,32,0,210,
+0,2,0,33,0,211,0,2,0,34,0,212,0,2,0,35,0,213,0,2,0,36,0,214,0,2,0,37,0,215,
+0,2,0,38,0,216,0,2,0,39,0,217,0,2,0,40,0,218,0,2,0,41,0,219,0,2,0,42,0,220,
+0,2,0,43,0,221,0,2,0,44,0,222,0,2,0,45,0,223,0,2,0,46,0,224,0,2,0,47,0,225,
+0,2,0,48,0,1,0,1,0,67,0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,4,0,2,0,1,0,4,0,
+48,0,0,0,2,0,1,0,181,0,225,0,0,0,1,0,50,0,1,0,8,0,5,0,12,0,18,0,24,0,30,0,
+36,0,226,0,2,0,81,0,227,0,2,0,82,0,228,0,2,0,83,0,229,0,2,0,84,0,230,0,2,
+0,85,0,1,0,1,0,57,0,3,0,1,0,24,0,1,0,18,0,0,0,1,0,0,0,5,0,1,0,1,0,63,0,2,
+0,1,0,181,0,225,0,0,0,2,0,96,0,45,0,136,0,137,0,138,0,139,0,140,0,141,0,142,
+0,143,0,144,0,145,0,146,0,147,0,148,0,149,0,150,0,151,0,152,0,153,0,154,0,
+155,0,156,0,157,0,158,0,159,0,160,0,161,0,162,0,163,0,164,0,165,0,166,0,167,
+0,168,0,169,0,170,0,171,0,172,0,173,0,174,0,175,0,176,0,177,0,178,0,179,0,
+180,0,2,0,1,0,4,0,48,0,0,0,2,0,8,0,1,0,231,0,1,0,1,0,63,};
+#endif
@@ -0,0 +1,666 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansTaiViet_Regular_ttf_size = 15864;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansTaiViet_Regular_ttf");
+asm(".type fz_font_NotoSansTaiViet_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansTaiViet_Regular_ttf, 15864");
+asm(".balign 64");
+asm("fz_font_NotoSansTaiViet_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansTaiViet-Regular.ttf\"");
+#else
+const int fz_font_NotoSansTaiViet_Regular_ttf_size = 15864;
+const char fz_font_NotoSansTaiViet_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,2,204,2,194,0,0,58,44,0,0,0,90,71,
+80,79,83,150,140,185,220,0,0,58,136,0,0,3,78,71,83,85,66,68,116,76,117,0,
+0,61,216,0,0,0,30,79,83,47,50,122,231,107,81,0,0,1,104,0,0,0,96,99,109,97,
+112,46,173,22,24,0,0,3,12,0,0,0,116,103,97,115,112,0,7,0,7,0,0,58,32,0,0,
+0,12,103,108,121,102,15,52,4,205,0,0,4,36,0,0,47,206,104,101,97,100,6,187,
+202,111,0,0,0,236,0,0,0,54,104,104,101,97,16,116,8,204,0,0,1,36,0,0,0,36,
+104,109,116,120,146,116,240,17,0,0,1,200,0,0,1,68,108,111,99,97,228,146,240,
+236,0,0,3,128,0,0,0,164,109,97,120,112,0,96,1,0,0,0,1,72,0,0,0,32,110,97,
+109,101,141,179,184,225,0,0,51,244,0,0,6,10,112,111,115,116,255,105,0,102,
+0,0,58,0,0,0,0,32,0,1,0,0,0,1,7,174,3,167,171,42,95,15,60,245,0,11,8,0,0,
+0,0,0,205,74,133,210,0,0,0,0,210,109,241,216,250,236,253,168,12,248,8,113,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,13,92,250,236,253,118,12,
+248,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,1,0,0,0,81,0,255,0,14,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,234,1,144,0,5,0,0,5,154,5,51,0,
+0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,
+2,88,0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,1,4,205,0,193,0,0,0,0,2,20,0,0,
+2,20,0,0,5,43,0,120,5,185,0,100,8,41,0,100,8,147,0,100,7,228,0,100,3,212,
+255,206,4,116,0,30,5,70,0,120,9,162,0,120,4,156,0,120,5,145,0,120,5,67,0,
+100,5,100,0,120,5,100,0,120,4,231,0,120,7,228,0,100,8,204,0,120,6,86,0,100,
+4,201,0,100,7,56,0,120,6,105,0,100,6,20,0,120,5,28,0,100,5,72,0,120,9,26,
+0,120,5,127,0,120,4,114,0,80,9,113,0,100,4,254,0,80,7,95,0,100,5,171,255,
+233,7,95,0,100,5,100,255,233,7,198,0,100,9,47,0,120,6,45,0,50,4,254,255,203,
+4,114,255,203,5,169,0,50,6,195,0,50,6,104,0,120,5,79,0,50,9,224,0,120,4,228,
+0,80,6,107,0,120,6,70,0,100,4,241,0,100,6,203,0,100,0,0,251,96,2,133,0,200,
+0,0,251,187,0,0,251,94,0,0,253,43,6,107,0,160,3,224,0,100,0,0,251,62,0,0,
+251,38,4,79,0,160,3,185,0,120,4,40,0,0,4,59,0,50,6,6,0,120,0,0,251,89,0,0,
+253,44,4,184,0,100,0,0,250,236,3,87,255,136,7,111,255,201,7,111,0,220,5,189,
+0,120,13,92,0,100,6,143,0,200,0,0,0,0,0,0,255,202,0,0,254,213,4,20,0,106,
+2,156,0,235,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,104,0,0,0,22,0,16,0,3,0,6,0,0,
+0,13,0,32,0,160,32,13,37,204,167,140,170,194,170,223,254,255,255,255,0,0,
+0,0,0,13,0,32,0,160,32,11,37,204,167,140,170,128,170,219,254,255,255,255,
+0,1,255,245,255,227,255,99,224,65,218,131,88,196,85,132,85,108,1,2,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,78,0,
+139,0,238,1,103,1,208,2,12,2,66,2,135,3,44,3,99,3,186,4,3,4,106,4,205,5,3,
+5,112,5,235,6,44,6,93,6,213,7,19,7,88,7,157,7,230,8,109,8,197,8,245,9,98,
+9,152,9,236,10,113,11,17,11,134,11,249,12,121,12,199,13,20,13,94,13,171,14,
+25,14,112,14,170,15,44,15,92,15,166,15,241,16,62,16,161,16,202,16,232,17,
+9,17,66,17,100,17,160,17,218,17,240,18,20,18,53,18,106,18,183,18,241,19,91,
+19,132,19,153,19,221,20,5,20,58,20,161,20,235,21,74,22,202,23,79,23,79,23,
+92,23,122,23,216,23,231,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,
+55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,0,0,
+1,0,120,255,246,4,179,4,94,0,36,0,0,19,22,22,23,62,2,51,50,22,21,20,6,21,
+20,23,7,38,53,52,54,53,16,35,34,6,2,7,6,7,7,54,18,53,52,38,39,186,116,119,
+14,53,165,182,84,126,129,13,42,177,45,13,99,69,178,170,57,22,41,192,42,53,
+69,72,4,94,66,227,167,124,214,122,210,209,101,214,100,145,89,60,97,166,89,
+212,133,1,35,178,254,194,188,125,119,55,109,1,90,160,193,184,41,0,2,0,100,
+255,248,5,165,4,113,0,28,0,35,0,0,23,18,33,50,23,54,55,23,6,7,22,21,20,6,
+21,20,23,7,38,53,52,54,53,53,39,6,0,7,21,1,34,2,3,18,37,38,100,147,2,43,193,
+75,179,168,28,136,205,16,13,42,177,45,13,1,215,254,163,89,1,244,168,236,61,
+245,1,101,31,5,4,99,150,106,63,82,53,135,78,90,101,214,100,146,89,57,97,164,
+89,212,133,31,30,163,254,139,162,1,3,161,254,187,254,191,1,45,241,104,0,1,
+0,100,254,132,7,197,5,105,0,67,0,0,5,22,22,51,50,54,53,52,38,35,34,7,6,35,
+34,38,53,52,62,2,53,52,38,35,34,14,4,7,7,18,18,0,51,50,22,22,21,20,7,6,6,
+21,20,22,51,50,55,55,18,18,55,23,6,2,2,7,22,22,21,20,6,35,34,39,5,160,38,
+109,50,107,95,123,109,127,150,149,134,116,119,30,36,30,69,49,90,134,99,70,
+50,35,16,196,42,204,1,47,183,81,115,60,48,33,15,36,52,109,155,86,35,248,203,
+48,92,154,103,11,183,202,177,157,138,122,210,29,31,77,72,66,81,23,23,113,
+103,58,153,172,185,90,54,70,79,136,183,206,220,105,54,1,86,1,252,1,17,66,
+113,69,104,252,173,112,37,34,38,26,11,1,159,2,106,195,63,92,254,167,254,33,
+240,2,146,122,128,148,106,0,0,1,0,100,253,168,8,67,4,94,0,76,0,0,1,54,51,
+50,22,21,20,2,0,7,39,36,0,53,52,38,35,34,6,6,7,39,54,54,53,52,38,35,34,6,
+6,7,2,7,6,6,35,34,38,2,2,39,6,2,7,6,6,35,34,46,2,2,2,39,55,22,18,23,54,18,
+18,51,50,23,22,18,23,18,18,54,54,51,50,22,21,20,7,41,31,31,97,123,226,254,
+61,223,47,1,91,1,164,61,47,41,65,61,63,73,81,117,71,61,61,88,71,46,95,67,
+10,47,44,46,54,95,77,11,37,122,62,18,55,44,49,50,61,71,65,42,2,163,16,137,
+37,52,138,142,39,71,18,19,123,38,98,100,104,133,88,134,152,2,70,6,133,110,
+148,254,171,254,157,101,77,175,1,205,199,73,63,18,36,55,99,62,211,91,84,92,
+67,144,163,254,172,219,32,33,62,1,66,1,115,104,45,254,103,253,74,78,54,151,
+251,1,48,1,17,68,37,182,253,102,66,226,1,157,1,19,99,105,253,196,124,1,140,
+1,22,151,75,151,147,127,0,2,0,100,255,216,7,178,5,105,0,61,0,70,0,0,1,6,2,
+17,20,23,54,51,50,22,21,20,6,6,35,34,39,14,2,35,34,38,53,52,62,2,53,52,38,
+35,34,6,6,2,3,7,18,18,0,51,50,22,21,20,14,2,21,20,22,51,50,54,54,55,38,53,
+16,0,55,3,34,7,22,51,50,53,52,38,7,129,180,184,6,95,82,111,119,67,113,67,
+184,91,116,107,111,67,116,119,30,36,30,69,49,96,150,112,87,49,196,37,211,
+1,47,181,118,138,30,36,30,36,52,35,69,80,134,21,1,11,229,145,67,70,41,97,
+91,50,5,42,192,254,32,254,240,58,48,25,90,81,41,79,46,143,60,39,24,113,103,
+58,150,168,181,90,55,80,97,185,254,203,254,174,54,1,75,2,7,1,17,142,117,76,
+183,183,166,59,34,38,12,25,56,73,85,1,3,2,38,205,251,82,22,95,54,31,32,0,
+0,1,255,206,253,168,3,132,4,94,0,37,0,0,1,54,51,50,22,22,21,16,0,5,39,36,
+0,53,52,38,35,34,6,7,39,54,54,53,52,35,34,6,7,35,54,54,51,50,22,21,20,6,2,
+106,31,31,57,103,60,254,76,254,45,47,1,141,1,117,85,68,50,100,34,73,109,112,
+151,94,98,17,101,4,182,136,155,164,49,2,70,6,67,120,78,254,240,254,60,199,
+77,167,1,135,254,74,94,34,24,99,63,170,101,146,89,93,140,182,142,132,71,137,
+0,1,0,30,253,168,4,16,4,94,0,31,0,0,1,6,35,34,38,53,52,54,54,51,50,0,17,20,
+2,0,5,39,36,0,17,52,38,35,34,6,21,20,22,51,50,55,2,3,34,43,141,197,106,193,
+122,241,1,22,239,254,72,254,228,47,1,156,1,162,174,158,111,137,85,79,26,16,
+1,171,7,185,138,103,174,98,254,205,254,236,230,254,76,254,154,111,77,174,
+2,28,1,93,210,228,122,111,105,110,4,0,0,2,0,120,253,188,5,50,4,114,0,29,0,
+38,0,0,37,7,38,38,53,52,18,54,51,50,23,54,55,23,6,7,22,21,20,2,0,7,39,36,
+0,17,52,39,0,3,3,20,23,0,37,38,35,34,6,1,120,180,35,41,128,245,167,210,140,
+132,149,39,128,131,91,177,254,171,244,47,1,68,1,49,42,254,166,217,77,22,1,
+8,1,44,92,153,161,180,68,53,96,255,115,195,1,41,165,162,96,66,69,74,104,152,
+197,246,254,80,254,175,107,77,159,1,244,1,115,145,107,254,198,254,115,1,203,
+171,121,1,136,253,118,251,0,3,0,120,255,216,9,112,5,105,0,99,0,110,0,119,
+0,0,1,22,23,54,54,51,50,22,21,20,6,35,34,39,6,21,16,23,54,51,50,22,21,20,
+6,35,34,39,7,6,35,34,38,53,52,62,2,53,52,38,35,34,6,7,23,16,2,35,34,38,53,
+52,55,54,53,52,39,55,22,21,20,6,21,20,22,51,50,18,17,52,39,55,23,54,54,51,
+50,22,22,21,20,7,6,21,20,22,51,50,54,55,55,39,51,38,17,52,55,38,39,37,34,
+7,23,51,50,54,54,53,52,38,3,34,7,22,51,50,54,53,52,6,23,149,129,72,199,115,
+90,103,227,156,51,51,38,19,98,80,111,119,133,103,169,95,101,189,150,116,119,
+21,24,21,69,49,51,131,47,3,242,204,131,141,7,6,42,177,45,13,65,64,116,113,
+21,183,10,69,165,59,71,107,61,33,33,36,52,31,102,112,108,1,2,54,77,158,105,
+2,143,138,76,36,34,71,103,54,39,135,70,73,45,85,37,54,4,183,56,22,124,132,
+79,68,98,138,6,147,201,254,237,112,24,90,81,66,100,154,46,88,113,103,58,153,
+172,185,90,54,70,41,30,108,254,139,254,66,222,197,70,143,143,69,145,89,58,
+97,164,89,222,133,156,135,1,15,1,87,160,142,62,101,54,67,69,114,65,125,231,
+231,91,34,38,30,42,38,4,153,1,25,181,184,38,66,138,161,2,30,50,29,28,26,251,
+192,23,94,32,22,63,0,0,1,0,120,255,236,4,36,5,105,0,34,0,0,1,54,54,51,50,
+22,22,21,20,6,6,35,34,38,38,53,52,0,37,23,6,6,2,21,20,22,51,50,54,53,52,38,
+35,34,7,1,195,24,145,95,100,156,89,119,214,130,145,217,115,1,18,1,26,55,189,
+170,72,151,148,131,150,96,84,114,34,2,156,80,106,104,186,105,137,220,122,
+129,238,149,214,1,181,238,51,181,240,255,0,161,184,192,182,158,135,149,121,
+0,0,2,0,120,255,236,6,89,8,112,0,45,0,55,0,0,1,22,17,20,22,22,51,50,54,55,
+55,38,38,53,16,18,0,55,23,6,0,2,17,20,23,54,51,50,22,21,20,6,35,34,39,14,
+3,35,34,38,53,52,2,39,1,34,7,22,22,51,50,54,53,52,1,31,110,17,38,43,32,98,
+118,103,23,27,190,1,92,243,48,189,254,222,170,18,57,50,118,134,113,85,148,
+108,53,106,108,112,58,128,117,49,48,3,220,33,40,19,52,37,22,38,4,92,233,253,
+186,72,76,33,34,53,43,68,187,93,1,57,2,83,1,222,176,73,140,254,51,253,156,
+254,236,226,78,11,94,78,65,88,164,24,57,49,34,144,156,237,1,172,113,252,161,
+7,50,48,22,25,58,0,0,1,0,100,253,168,6,131,4,94,0,44,0,0,1,14,2,21,16,0,5,
+7,36,0,17,52,18,55,46,2,35,34,6,2,21,20,22,51,50,55,23,6,6,35,34,38,53,52,
+18,36,51,50,22,22,23,54,55,4,227,99,116,53,1,100,1,72,47,254,107,254,100,
+82,85,42,80,108,73,91,179,117,71,73,86,82,66,39,148,81,139,151,178,1,15,142,
+74,118,99,85,56,65,4,13,125,223,219,164,254,251,254,78,134,77,155,1,200,1,
+31,112,1,12,138,66,62,34,185,254,213,134,123,102,106,40,78,98,175,158,169,
+1,114,221,32,54,75,70,65,0,0,2,0,120,255,236,5,220,8,112,0,59,0,69,0,0,1,
+7,6,2,21,20,23,54,51,50,22,21,20,6,35,34,39,14,3,35,34,38,53,52,2,39,55,22,
+17,20,22,22,51,50,54,55,55,38,38,53,52,55,38,38,53,52,18,36,37,23,4,17,20,
+22,51,50,54,55,19,34,7,22,22,51,50,54,53,52,4,34,2,36,44,18,57,50,118,134,
+113,85,148,108,53,106,108,112,58,128,117,49,48,167,110,17,38,43,32,98,118,
+103,23,27,52,121,140,214,1,164,1,0,23,253,38,92,86,15,22,52,71,33,40,19,52,
+37,22,38,4,66,2,60,254,235,153,226,78,11,94,78,65,88,164,24,57,49,34,144,
+156,237,1,172,113,58,233,253,186,72,76,33,34,53,43,68,187,93,233,221,26,195,
+137,184,1,52,221,37,61,193,254,28,114,127,3,13,252,22,7,50,48,22,25,58,0,
+1,0,120,254,131,5,220,8,112,0,66,0,0,1,23,6,2,21,16,23,55,50,22,22,21,20,
+6,35,34,38,39,55,22,51,50,54,53,52,38,35,34,7,6,35,34,38,53,52,2,39,55,22,
+17,20,22,22,51,50,55,55,38,38,53,52,55,38,38,53,52,18,36,37,23,4,17,20,22,
+51,50,54,4,13,19,36,44,33,41,115,162,86,172,149,73,147,53,45,88,121,82,108,
+124,102,128,157,157,133,128,117,49,48,167,110,17,40,46,106,158,91,26,33,52,
+121,140,214,1,164,1,0,23,253,38,92,86,15,22,4,173,109,60,254,235,153,254,
+182,102,2,69,124,79,128,149,58,49,64,61,78,64,75,80,23,23,144,156,237,1,172,
+113,58,233,253,186,72,76,33,25,13,62,238,140,207,247,26,195,137,184,1,52,
+221,37,61,193,254,28,114,127,3,0,0,1,0,120,255,236,4,151,4,94,0,30,0,0,55,
+18,1,38,38,39,55,22,22,23,54,37,23,6,3,23,22,22,51,51,55,7,6,35,34,46,2,39,
+2,7,120,137,1,5,75,169,103,63,122,192,90,231,1,12,38,235,242,57,101,157,98,
+15,14,16,22,16,75,125,104,103,91,199,75,29,1,72,1,26,151,154,20,154,17,168,
+174,217,142,79,125,254,230,133,237,172,1,106,5,51,94,163,204,254,243,233,
+0,2,0,100,255,216,9,101,8,112,0,61,0,71,0,0,1,6,0,2,17,20,23,54,51,50,22,
+21,20,6,35,34,38,39,7,6,35,34,38,53,52,62,2,53,52,38,35,34,6,6,2,3,7,18,18,
+0,51,50,22,21,20,14,2,21,20,22,51,50,55,55,38,53,16,18,0,37,1,34,7,22,51,
+50,54,53,52,38,9,101,248,254,122,207,19,86,77,104,124,136,96,78,142,51,91,
+172,157,116,119,30,36,30,69,49,96,150,112,87,49,196,37,211,1,47,181,118,138,
+30,36,30,36,52,99,152,86,37,235,1,185,1,45,253,141,58,62,43,78,44,47,50,8,
+39,165,253,254,253,174,254,221,151,97,22,90,75,74,98,72,80,45,87,113,103,
+58,150,168,181,90,55,80,97,185,254,203,254,174,54,1,75,2,7,1,17,142,117,76,
+183,183,166,59,34,38,64,36,111,155,1,57,2,114,2,26,197,248,75,17,100,37,17,
+31,32,0,1,0,120,253,168,8,84,4,94,0,83,0,0,1,23,54,54,51,50,22,22,21,20,7,
+6,21,20,51,50,18,19,62,2,51,50,22,22,21,20,2,0,5,39,36,0,18,53,52,38,38,39,
+2,2,6,35,34,38,53,52,62,2,53,52,38,35,34,6,7,23,16,2,35,34,38,53,52,55,54,
+53,52,39,55,22,21,20,6,21,20,22,51,50,18,17,52,39,3,81,10,69,165,59,71,107,
+61,45,46,38,105,180,86,15,38,55,31,78,131,75,255,254,61,254,235,47,1,7,1,
+125,206,33,56,37,40,151,200,121,85,109,28,35,28,69,49,51,131,47,3,242,204,
+131,141,7,6,42,177,45,13,65,64,116,113,21,4,74,101,54,67,69,114,65,113,247,
+247,79,52,1,128,1,172,76,63,35,122,220,141,240,254,23,254,114,108,77,111,
+1,93,1,199,239,78,156,78,3,254,226,254,69,225,112,84,58,155,176,187,90,54,
+70,41,30,108,254,139,254,66,222,197,70,143,143,69,145,89,58,97,164,89,222,
+133,156,135,1,15,1,87,160,142,0,0,1,0,100,253,168,5,222,4,94,0,37,0,0,1,54,
+53,52,35,34,2,3,7,18,18,0,51,50,23,54,54,51,50,22,21,20,0,0,5,39,54,0,18,
+53,52,38,35,34,6,7,6,7,2,220,66,98,135,196,73,196,35,187,1,12,152,164,48,
+62,144,72,130,140,254,234,254,62,254,250,47,255,1,125,221,51,62,68,133,36,
+4,60,1,135,225,168,194,254,81,254,14,54,1,53,2,9,1,37,191,93,98,189,196,252,
+253,215,254,86,102,77,108,1,120,2,3,253,131,118,140,97,138,212,0,1,0,100,
+255,226,4,81,4,94,0,31,0,0,5,38,53,52,54,53,52,38,35,34,6,2,21,20,22,23,7,
+38,38,53,52,18,36,51,50,22,21,20,6,21,20,23,3,160,45,13,83,86,115,208,124,
+80,94,57,139,158,186,1,44,157,164,169,13,42,8,97,164,89,212,133,160,131,156,
+254,250,142,126,182,52,88,47,231,161,161,1,81,211,214,205,101,214,100,146,
+89,0,2,0,120,253,168,7,216,4,94,0,76,0,86,0,0,1,46,4,53,52,62,2,53,52,38,
+35,34,6,6,21,20,23,54,51,50,22,21,20,6,35,34,38,39,14,3,35,34,38,53,52,55,
+54,53,52,39,55,22,21,20,6,21,20,22,51,50,54,55,55,38,53,52,18,36,51,50,22,
+21,20,6,3,6,21,20,22,22,23,1,34,7,22,22,51,50,54,53,52,7,169,180,155,116,
+78,42,24,29,24,72,89,110,178,102,15,46,46,120,142,113,85,75,145,47,56,92,
+89,95,59,136,144,7,6,42,177,45,13,66,67,32,88,101,86,33,162,1,20,148,163,
+162,15,42,20,79,177,182,252,56,31,42,19,52,37,22,38,253,168,89,101,111,134,
+168,106,79,158,161,163,86,127,95,137,246,147,93,58,8,95,77,65,88,89,77,24,
+57,51,34,219,200,70,143,143,69,145,89,58,97,164,89,222,133,152,139,35,57,
+44,97,101,159,1,52,197,170,180,56,146,254,226,137,80,142,193,157,94,2,206,
+7,50,48,22,25,58,0,0,1,0,100,255,248,5,241,4,94,0,39,0,0,1,54,53,52,35,34,
+2,3,7,18,18,0,51,50,23,54,54,51,50,22,21,20,6,21,20,23,7,38,53,52,54,53,52,
+38,35,34,6,7,6,7,2,220,66,98,135,196,73,196,35,187,1,12,152,164,48,62,144,
+72,131,129,13,42,177,45,13,44,59,68,133,36,4,60,1,135,225,168,194,254,81,
+254,14,54,1,53,2,9,1,37,191,93,98,188,198,126,222,100,145,89,58,97,164,119,
+236,121,137,112,140,97,138,212,0,1,0,120,255,236,5,156,4,92,0,47,0,0,5,38,
+53,52,54,53,52,38,35,34,6,3,7,2,35,34,38,53,52,55,54,53,52,39,55,22,21,20,
+6,21,20,22,51,50,54,55,18,54,51,50,22,21,20,7,6,21,20,23,4,235,45,13,63,66,
+70,117,77,38,122,253,131,141,7,6,42,177,45,13,65,64,69,121,65,74,200,148,
+131,141,6,7,42,20,97,164,89,222,133,150,141,199,254,246,129,254,110,222,197,
+70,143,143,69,145,89,58,97,164,89,222,133,156,135,207,255,1,32,246,222,197,
+70,143,143,69,145,89,0,1,0,100,253,168,5,188,4,94,0,46,0,0,1,46,4,53,52,62,
+2,53,52,38,35,34,6,2,21,20,22,51,50,55,23,6,6,35,34,38,53,52,18,36,51,50,
+22,21,20,6,3,6,21,20,22,22,23,5,141,180,155,116,78,42,24,29,24,101,110,102,
+204,130,71,73,86,82,66,39,148,81,139,151,196,1,44,155,174,182,15,42,20,79,
+177,182,253,168,89,101,111,134,168,106,79,158,161,163,86,113,109,191,254,
+213,128,123,102,106,40,78,98,175,158,165,1,114,225,179,171,56,146,254,226,
+137,80,142,193,157,94,0,0,1,0,120,253,168,4,208,4,94,0,44,0,0,1,20,6,21,20,
+22,51,50,18,19,62,2,51,50,22,22,21,20,2,0,5,39,36,0,18,53,52,38,38,39,2,2,
+6,35,34,38,53,52,54,53,52,39,55,22,1,86,13,57,52,105,180,86,15,38,55,31,78,
+131,75,255,254,61,254,235,47,1,7,1,125,206,33,56,37,40,151,200,121,127,138,
+13,42,177,45,3,89,89,212,133,136,155,1,128,1,172,76,63,35,122,220,141,240,
+254,23,254,114,108,77,111,1,93,1,199,239,78,156,78,3,254,226,254,69,225,214,
+205,101,214,100,145,89,58,97,0,0,2,0,120,255,216,8,232,5,105,0,86,0,95,0,
+0,1,23,54,54,51,50,22,22,21,20,7,6,6,21,20,22,51,50,54,54,55,38,53,16,0,55,
+23,6,2,17,20,23,54,51,50,22,21,20,6,6,35,34,39,6,6,35,34,38,53,52,62,2,53,
+52,38,35,34,6,7,23,16,2,35,34,38,53,52,55,54,53,52,39,55,22,21,20,6,21,20,
+22,51,50,18,17,52,39,1,34,7,22,51,50,53,52,38,3,81,10,74,164,65,71,107,61,
+49,31,19,36,52,37,74,81,126,21,1,11,229,48,180,184,6,95,82,111,119,67,113,
+67,184,91,138,172,91,116,119,31,37,31,69,49,55,141,42,2,242,204,131,141,7,
+6,42,177,45,13,65,64,116,113,21,5,92,67,70,41,97,91,50,4,74,108,58,70,69,
+114,65,119,247,151,123,38,34,38,14,25,54,73,85,1,3,2,38,205,63,192,254,32,
+254,240,58,48,25,90,81,41,79,46,143,74,49,113,103,63,162,176,178,79,54,70,
+48,29,102,254,139,254,66,222,197,70,143,143,69,145,89,58,97,164,89,222,133,
+156,135,1,15,1,87,160,142,252,175,22,95,54,31,32,0,2,0,120,255,216,5,77,5,
+105,0,50,0,59,0,0,37,6,6,35,34,38,53,52,55,54,53,52,38,38,39,55,22,18,21,
+20,7,6,21,20,22,51,50,54,54,55,38,53,16,0,55,23,6,2,17,20,23,54,51,50,22,
+21,20,6,6,35,34,55,34,7,22,51,50,53,52,38,3,67,92,223,73,108,127,14,13,32,
+52,35,167,60,72,13,14,32,45,38,78,81,119,21,1,11,229,48,180,184,6,95,82,111,
+119,67,113,67,184,189,67,70,41,97,91,50,103,49,74,123,112,48,97,96,46,88,
+243,172,53,58,106,254,179,178,72,104,105,21,43,34,16,25,52,73,85,1,3,2,38,
+205,63,192,254,32,254,240,58,48,25,90,81,41,79,46,227,22,95,54,31,32,0,1,
+0,80,255,236,4,114,5,105,0,25,0,0,5,34,38,39,38,2,2,39,55,22,18,18,23,62,
+4,55,23,6,0,3,14,2,1,214,35,48,21,38,117,119,12,163,12,87,103,25,62,74,94,
+123,161,106,48,166,254,246,93,23,34,50,20,19,36,62,1,100,1,245,127,37,109,
+254,123,254,162,45,240,225,212,202,193,88,63,162,253,198,254,115,97,81,35,
+0,0,1,0,100,255,236,9,113,5,105,0,65,0,0,5,34,38,38,2,2,39,6,3,7,6,6,35,34,
+38,2,2,39,6,2,7,6,6,35,34,46,2,2,2,39,55,22,18,23,54,18,18,51,50,23,22,18,
+23,54,18,18,51,50,23,23,18,23,62,4,55,23,6,0,3,14,2,6,213,55,64,72,78,56,
+7,50,138,67,10,47,44,46,54,95,77,11,37,122,62,18,55,44,49,50,61,71,65,42,
+2,163,16,137,37,52,138,142,39,71,18,19,123,38,38,146,148,38,71,18,16,86,95,
+62,74,94,123,161,106,48,166,254,246,93,23,34,50,20,67,166,1,3,1,15,96,71,
+254,20,231,32,33,62,1,66,1,115,104,45,254,103,253,74,78,54,151,251,1,48,1,
+17,68,37,182,253,102,66,226,1,157,1,19,99,105,253,196,124,186,1,174,1,28,
+99,90,253,251,187,240,225,212,202,193,88,63,162,253,198,254,115,97,81,35,
+0,0,1,0,80,255,236,7,136,8,112,0,25,0,0,5,34,38,39,38,2,2,39,55,22,18,18,
+23,18,0,0,1,23,6,0,0,2,3,14,2,1,214,35,48,21,38,117,119,12,163,12,87,103,
+25,107,1,102,2,30,1,147,48,248,254,109,254,219,218,103,48,49,59,20,19,36,
+62,1,100,1,245,127,37,109,254,123,254,162,45,1,150,2,151,2,68,1,30,73,187,
+254,109,254,104,254,63,254,178,153,122,51,0,1,0,100,255,236,9,233,8,112,0,
+45,0,0,5,34,38,2,2,39,6,2,7,6,6,35,34,46,2,2,2,39,55,22,18,23,54,18,18,51,
+50,23,22,18,23,55,54,55,18,0,1,23,0,0,3,2,7,6,6,4,37,46,54,95,77,11,37,122,
+62,18,55,44,49,50,61,71,65,42,2,163,16,137,37,52,138,142,39,71,18,21,115,
+36,24,38,61,168,2,87,2,2,48,254,59,253,183,148,137,33,14,63,20,62,1,66,1,
+115,104,45,254,103,253,74,78,54,151,251,1,48,1,17,68,37,182,253,102,66,226,
+1,157,1,19,99,116,253,231,117,82,135,157,1,186,2,217,1,110,73,254,170,253,
+17,254,63,254,94,76,33,38,0,0,3,255,233,255,236,6,200,8,112,0,56,0,78,0,88,
+0,0,1,39,6,21,20,23,54,51,50,22,21,20,6,35,34,39,14,3,35,34,38,53,52,2,39,
+7,39,1,54,51,50,30,2,23,54,55,38,38,53,52,54,36,55,23,4,4,6,21,20,22,23,6,
+7,23,1,52,19,39,38,35,34,7,7,55,22,17,20,22,22,51,50,54,55,55,38,38,1,34,
+7,22,22,51,50,54,53,52,4,81,82,47,18,57,50,118,134,113,85,148,108,53,106,
+108,112,58,128,117,41,37,114,48,2,12,103,46,14,29,43,40,191,36,46,69,75,187,
+1,121,247,20,254,250,254,241,118,74,53,102,55,112,254,141,121,140,84,57,56,
+109,193,9,110,17,38,43,32,98,118,103,23,27,1,56,33,40,19,52,37,22,38,3,139,
+86,186,209,226,78,11,94,78,65,88,164,24,57,49,34,144,156,216,1,141,114,87,
+65,1,196,91,12,32,41,237,66,72,37,122,101,127,219,168,42,67,72,129,154,114,
+76,112,16,158,164,138,254,150,249,1,2,148,90,83,147,3,233,253,186,72,76,33,
+34,53,43,68,187,254,202,7,50,48,22,25,58,0,1,0,100,254,132,9,233,8,113,0,
+115,0,0,1,6,0,2,2,6,6,7,14,3,7,30,3,21,20,14,2,35,34,46,2,39,55,22,22,51,
+50,62,2,53,52,46,2,35,34,7,6,6,35,34,38,39,46,5,39,14,7,7,6,6,35,34,38,39,
+46,5,39,55,30,7,23,62,5,51,50,22,23,30,5,23,62,3,55,54,8,2,55,9,233,192,254,
+207,240,182,135,97,35,19,38,38,34,14,76,120,84,45,35,79,127,93,40,74,66,57,
+23,45,38,109,50,33,71,59,39,32,56,74,43,30,28,16,30,13,27,47,13,19,40,40,
+38,31,23,5,14,34,36,37,35,32,25,16,3,15,50,41,27,46,21,28,57,54,47,36,23,
+1,163,4,16,21,27,29,29,28,26,10,29,67,70,70,63,53,19,41,40,8,7,24,30,33,33,
+32,13,13,22,27,35,26,97,1,5,1,66,1,126,219,8,40,145,254,230,254,240,254,252,
+246,231,106,57,117,111,99,39,1,37,63,87,50,51,95,74,45,18,30,38,20,64,29,
+31,10,30,56,46,30,47,31,16,3,7,5,26,27,40,123,147,159,153,135,49,17,78,106,
+126,128,121,98,66,8,47,64,19,36,48,165,200,217,200,167,49,37,43,116,133,143,
+141,131,108,80,19,127,234,203,166,119,65,54,45,39,121,143,154,144,126,43,
+43,78,85,101,67,255,1,171,1,115,1,72,156,0,0,3,255,233,255,236,6,89,8,112,
+0,43,0,65,0,75,0,0,1,39,6,21,20,23,54,51,50,22,21,20,6,35,34,39,14,3,35,34,
+38,53,52,2,39,7,39,1,54,51,50,22,22,23,18,0,55,23,6,0,3,23,37,22,17,20,22,
+22,51,50,54,55,55,38,38,53,16,19,39,38,35,34,7,7,1,34,7,22,22,51,50,54,53,
+52,4,81,87,42,18,57,50,118,134,113,85,148,108,53,106,108,112,58,128,117,41,
+37,114,48,2,12,103,46,22,48,48,145,93,1,83,232,48,201,254,214,83,124,252,
+144,110,17,38,43,32,98,118,103,23,27,77,96,84,57,56,109,193,3,62,33,40,19,
+52,37,22,38,3,139,91,216,184,226,78,11,94,78,65,88,164,24,57,49,34,144,156,
+216,1,141,114,87,65,1,196,91,30,45,180,1,11,1,197,167,73,149,254,18,254,180,
+152,156,233,253,186,72,76,33,34,53,43,68,187,93,1,29,1,12,102,90,83,147,252,
+106,7,50,48,22,25,58,0,2,0,100,255,236,9,71,8,112,0,62,0,72,0,0,37,7,6,6,
+35,34,38,38,2,39,6,2,7,6,6,35,34,46,2,2,2,39,55,22,18,23,54,18,18,51,50,23,
+22,18,23,18,51,50,54,55,38,53,16,18,0,37,23,6,0,2,17,20,23,54,51,50,22,21,
+20,6,35,34,55,34,7,22,51,50,54,53,52,38,5,174,93,76,110,63,62,100,74,86,12,
+37,122,62,18,55,44,49,50,61,71,65,42,2,163,16,137,37,52,138,142,39,71,18,
+10,86,38,57,89,51,100,54,48,233,1,185,1,47,48,249,254,122,206,20,82,80,104,
+124,136,96,158,150,66,52,43,76,44,47,50,108,50,43,35,114,235,1,144,110,45,
+254,103,253,74,78,54,151,251,1,48,1,17,68,37,182,253,102,66,226,1,157,1,19,
+99,60,254,103,167,254,251,50,38,121,175,1,54,2,102,2,19,199,73,166,254,10,
+253,186,254,218,159,95,28,90,75,74,98,227,22,95,37,17,31,32,0,2,0,120,255,
+216,9,47,5,105,0,78,0,87,0,0,1,23,54,54,51,50,18,17,20,6,7,23,22,51,50,54,
+55,26,2,55,23,6,2,2,3,6,6,35,34,38,39,39,6,35,34,38,53,52,54,51,50,23,54,
+54,53,52,38,35,34,6,7,23,16,2,35,34,38,53,52,55,54,53,52,39,55,22,21,20,6,
+21,20,22,51,50,18,17,52,39,1,38,35,34,6,21,20,51,50,3,81,10,68,163,62,170,
+191,18,17,59,95,60,57,74,11,26,115,191,137,48,107,139,80,21,14,150,136,49,
+101,62,71,94,176,109,132,123,107,91,85,11,6,122,118,51,131,47,3,242,204,131,
+141,7,6,42,177,45,13,65,64,116,113,21,2,106,80,52,42,50,91,89,4,74,100,53,
+67,254,204,254,238,62,186,85,31,52,113,110,1,12,1,103,1,38,121,63,98,254,
+253,254,190,254,231,196,186,33,35,39,127,92,66,85,94,26,53,101,106,222,225,
+41,30,108,254,139,254,66,222,197,70,143,143,69,145,89,58,97,164,89,222,133,
+156,135,1,15,1,87,160,142,252,143,32,32,31,54,0,2,0,50,255,216,6,45,5,105,
+0,40,0,49,0,0,1,18,17,20,7,22,51,50,54,54,55,62,4,55,23,6,2,2,3,2,33,34,39,
+6,6,35,34,38,53,52,54,51,50,23,54,53,16,3,3,50,55,38,35,34,6,21,20,2,45,91,
+30,161,92,67,64,44,9,29,55,73,105,131,85,48,112,142,78,18,21,254,185,124,
+198,43,137,91,110,130,123,107,94,85,9,84,93,89,44,80,52,42,50,4,92,254,214,
+254,203,171,135,83,36,78,73,228,233,195,183,163,76,63,102,254,246,254,170,
+254,217,254,175,107,58,69,90,68,85,94,26,86,104,1,30,1,55,252,36,85,32,32,
+31,54,0,2,255,203,255,236,7,136,8,112,0,30,0,41,0,0,1,4,0,3,23,7,39,2,3,14,
+2,35,34,38,39,38,2,39,7,39,1,54,51,50,22,22,23,54,0,37,1,22,18,23,18,19,39,
+38,35,34,7,7,136,254,211,254,59,163,126,62,115,165,129,31,61,63,41,35,48,
+21,65,176,34,96,48,2,12,103,46,25,66,59,148,173,1,205,1,72,249,156,22,163,
+41,135,252,110,84,57,56,109,8,39,228,254,33,254,246,154,53,121,254,218,254,
+93,100,174,61,19,36,110,2,125,211,73,65,1,196,91,46,68,185,250,1,191,234,
+251,230,184,253,139,72,2,2,1,141,117,90,83,0,2,255,203,255,236,4,114,5,248,
+0,28,0,41,0,0,1,6,7,23,7,39,2,3,6,6,35,34,38,39,38,2,39,7,39,1,54,51,50,30,
+2,23,54,55,1,22,18,23,18,18,54,55,39,38,35,34,7,4,114,75,74,148,62,141,196,
+132,27,58,51,35,48,21,65,176,34,96,48,2,12,103,46,14,29,43,41,176,85,82,252,
+178,22,163,41,69,96,128,91,107,84,57,56,109,5,42,73,107,182,53,148,254,184,
+253,206,114,71,19,36,110,2,125,211,73,65,1,196,91,12,32,42,219,94,68,254,
+237,184,253,139,72,1,19,1,9,255,119,114,90,83,0,0,2,0,50,255,238,5,49,4,114,
+0,43,0,52,0,0,5,38,53,52,54,53,52,38,38,35,34,6,7,22,21,16,3,39,18,17,52,
+39,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,21,20,23,1,38,35,
+34,21,20,22,51,50,4,128,45,13,38,87,83,59,164,71,30,91,173,84,9,84,95,111,
+119,130,110,91,137,43,84,204,72,185,194,13,42,252,119,44,89,91,50,42,52,8,
+97,164,89,212,133,122,117,52,47,36,135,171,254,203,254,214,58,1,55,1,30,100,
+90,26,96,83,68,90,69,58,45,62,212,207,101,214,100,146,89,3,126,85,54,31,32,
+0,3,0,50,255,63,6,145,4,114,0,58,0,67,0,76,0,0,5,54,55,38,53,55,54,53,52,
+38,38,35,34,6,7,22,21,16,3,39,18,17,52,39,6,35,34,38,53,52,54,51,50,22,23,
+54,54,51,50,22,21,20,6,21,20,23,54,51,50,22,21,20,6,6,35,34,39,6,7,1,38,35,
+34,21,20,22,51,50,1,34,7,22,51,50,53,52,38,3,108,107,157,32,2,10,38,87,83,
+59,164,71,30,91,173,84,9,84,95,111,119,130,110,91,137,43,84,204,72,185,194,
+12,7,78,78,111,119,67,113,67,159,84,113,112,253,226,44,89,91,50,42,52,4,71,
+56,60,39,78,91,50,146,185,127,87,118,73,180,63,122,117,52,47,36,135,171,254,
+203,254,214,58,1,55,1,30,100,90,26,96,83,68,90,69,58,45,62,212,207,78,156,
+79,70,54,35,90,81,41,79,46,112,97,168,4,112,85,54,31,32,253,44,27,90,54,31,
+32,0,1,0,120,253,168,7,8,4,94,0,60,0,0,1,23,54,54,51,50,22,21,20,6,3,6,21,
+20,22,22,23,7,46,4,53,52,62,2,53,52,38,35,34,7,23,16,2,35,34,38,53,52,55,
+54,53,52,39,55,22,21,20,6,21,20,22,51,50,18,17,52,39,3,81,9,69,155,70,140,
+147,15,42,20,79,177,182,47,180,155,116,78,42,24,29,24,72,89,128,105,2,242,
+204,131,141,7,6,42,177,45,13,65,64,116,113,21,4,74,92,51,61,179,171,56,146,
+254,226,137,80,142,193,157,94,77,89,101,111,134,168,106,79,158,161,163,86,
+127,95,90,89,254,139,254,66,222,197,70,143,143,69,145,89,58,97,164,89,222,
+133,156,135,1,15,1,87,160,142,0,0,1,0,50,255,236,4,235,4,94,0,34,0,0,5,54,
+55,35,34,46,2,39,38,38,35,34,6,7,39,54,54,51,50,22,22,23,22,22,51,50,55,18,
+37,23,6,2,2,7,2,51,45,78,6,53,74,52,32,31,17,65,51,39,118,53,45,70,178,66,
+75,103,56,21,12,39,34,21,28,165,1,47,38,133,188,122,44,20,225,194,42,76,109,
+169,91,92,31,29,62,59,79,77,144,175,100,83,5,1,71,247,69,139,254,210,254,
+177,238,0,0,1,0,120,255,236,9,104,4,94,0,93,0,0,37,50,54,53,52,38,35,34,6,
+3,7,6,6,35,34,38,53,52,62,2,53,52,38,35,34,6,7,23,16,2,35,34,38,53,52,55,
+54,53,52,39,55,22,21,20,6,21,20,22,51,50,18,17,52,39,55,23,54,54,51,50,22,
+22,21,20,7,6,21,20,22,51,50,62,4,55,18,54,51,50,22,18,21,20,2,6,35,34,38,
+39,55,22,7,251,81,104,84,84,54,98,80,37,58,214,139,120,124,23,29,23,69,49,
+51,131,47,3,242,204,131,141,7,6,42,177,45,13,65,64,116,113,21,183,10,68,163,
+62,71,107,61,37,38,45,52,34,60,50,43,35,28,12,74,200,148,94,138,79,84,152,
+95,82,147,39,66,82,90,247,195,238,206,175,254,231,128,191,221,142,133,58,
+135,150,166,90,54,70,41,30,108,254,139,254,66,222,197,70,143,143,69,145,89,
+58,97,164,89,222,133,156,135,1,15,1,87,160,142,62,100,53,67,69,114,65,113,
+213,214,79,66,65,44,74,96,103,102,43,1,32,246,130,254,249,179,152,254,251,
+151,98,78,40,106,0,0,1,0,80,255,236,4,108,4,94,0,29,0,0,1,22,22,51,50,54,
+54,53,52,38,35,34,6,6,7,39,62,2,51,50,22,21,20,2,4,35,34,38,39,1,126,5,104,
+106,102,163,90,133,128,100,193,177,65,76,57,204,238,127,206,220,160,254,254,
+152,162,181,11,1,63,99,100,147,252,149,147,163,76,155,101,40,113,212,107,
+235,211,174,254,180,186,156,151,0,0,1,0,120,255,236,5,243,4,94,0,51,0,0,1,
+23,54,54,51,50,22,21,20,6,21,20,23,7,38,53,52,54,53,52,38,35,34,7,23,21,16,
+2,35,34,38,53,52,55,54,53,52,39,55,22,21,20,6,21,20,22,51,50,18,17,52,39,
+3,101,10,81,179,75,132,148,13,42,177,45,13,73,82,149,124,1,242,204,136,156,
+7,6,42,177,45,13,78,71,116,113,21,4,74,109,60,69,224,195,101,214,100,145,
+89,58,97,164,89,212,133,167,124,104,38,37,254,139,254,66,230,189,70,143,143,
+69,145,89,58,97,164,89,222,133,135,156,1,15,1,87,160,142,0,1,0,100,255,236,
+5,206,4,92,0,49,0,0,1,20,6,21,20,22,51,50,54,55,18,54,51,50,22,18,21,20,2,
+6,35,34,38,39,55,22,51,50,18,53,52,38,35,34,6,3,7,2,35,34,38,53,52,55,54,
+53,52,39,55,22,1,66,13,65,64,69,121,65,74,200,148,110,166,95,86,159,101,82,
+147,39,66,82,86,85,115,124,104,70,117,77,38,122,253,131,141,7,6,42,177,45,
+3,87,89,222,133,156,135,207,255,1,32,246,143,254,244,161,155,254,251,148,
+98,78,40,106,1,4,182,200,244,199,254,246,129,254,110,222,197,70,143,143,69,
+145,89,58,97,0,0,2,0,100,255,236,4,221,4,94,0,40,0,51,0,0,19,6,21,20,22,51,
+50,54,54,53,53,39,6,35,34,38,53,52,54,54,51,50,22,23,54,55,23,6,7,22,21,20,
+2,4,35,34,38,38,53,52,55,37,50,55,38,35,34,6,6,21,20,22,241,21,170,141,134,
+196,104,1,245,142,128,153,113,195,115,148,201,46,49,53,29,43,65,8,162,254,
+222,177,122,191,103,36,1,220,127,210,52,193,71,116,71,80,1,241,53,56,122,
+146,141,252,155,15,13,92,115,92,77,145,85,125,126,22,29,86,27,32,52,49,188,
+254,191,183,104,184,114,91,81,160,81,183,44,79,41,41,59,0,0,2,0,100,253,168,
+6,83,4,94,0,55,0,66,0,0,19,6,21,20,22,51,50,54,54,53,53,39,6,35,34,38,53,
+52,54,54,51,50,22,23,54,54,51,50,22,21,20,2,0,5,39,36,0,18,53,52,35,34,7,
+7,22,21,20,2,4,35,34,38,38,53,52,55,37,50,55,38,35,34,6,6,21,20,22,241,21,
+170,141,134,196,104,1,245,142,128,153,113,195,115,148,201,46,124,99,41,121,
+120,255,254,61,254,235,47,1,7,1,125,206,117,51,89,45,8,162,254,222,177,122,
+191,103,36,1,220,127,210,52,193,71,116,71,80,1,241,53,56,122,146,141,252,
+155,14,14,92,115,92,77,145,85,125,126,58,28,163,155,240,254,23,254,114,108,
+77,111,1,93,1,199,239,212,47,23,52,49,188,254,191,183,104,184,114,91,81,160,
+81,183,44,79,41,41,59,0,1,251,96,5,20,254,216,7,21,0,24,0,0,1,6,7,14,2,35,
+34,38,53,52,54,55,23,6,6,21,20,22,51,50,62,2,55,254,216,74,183,117,129,125,
+68,87,105,124,83,29,62,44,49,31,66,131,150,181,117,6,193,54,153,98,82,42,
+89,76,69,130,26,45,41,71,47,34,42,67,112,145,79,0,0,1,0,200,255,246,1,189,
+4,92,0,16,0,0,5,38,17,52,55,54,53,52,39,55,22,21,20,6,21,20,23,1,19,46,7,
+6,42,177,45,13,36,10,112,1,41,70,143,143,69,145,89,58,97,164,89,222,133,249,
+132,0,0,1,251,187,5,20,255,16,6,251,0,16,0,0,1,62,2,55,23,30,2,23,7,38,38,
+39,6,6,7,251,187,89,135,103,60,155,19,70,125,97,12,147,226,48,97,211,90,5,
+91,48,120,134,114,24,107,118,88,29,65,19,127,95,111,158,28,0,0,2,251,94,5,
+20,254,188,7,159,0,24,0,34,0,0,1,6,6,7,6,6,7,39,54,54,55,6,35,34,38,53,52,
+54,51,50,22,23,54,54,55,5,50,55,38,38,35,34,21,20,22,254,188,107,202,109,
+26,160,102,49,81,101,21,55,35,102,118,127,96,93,123,13,91,184,96,253,177,
+53,40,5,53,48,89,56,7,44,59,102,30,101,190,54,50,59,142,68,5,92,79,71,95,
+106,85,27,85,48,196,7,49,61,54,28,35,0,0,1,253,43,253,168,255,106,255,176,
+0,19,0,0,1,62,2,53,52,35,34,6,7,39,54,51,50,22,21,20,6,6,7,253,43,116,199,
+120,73,30,89,26,32,127,102,81,80,145,253,164,253,236,15,97,131,52,57,35,23,
+43,115,72,56,80,167,122,23,0,0,2,0,160,255,246,6,7,4,240,0,16,0,33,0,0,1,
+6,2,21,20,23,7,38,38,39,55,22,23,53,52,0,55,5,6,2,21,20,23,7,38,38,39,55,
+22,23,53,52,0,55,3,175,178,186,30,162,51,152,84,24,115,100,1,9,224,2,143,
+178,186,30,162,51,152,84,24,115,100,1,9,224,4,179,197,254,52,238,127,124,
+67,103,133,10,104,12,59,5,235,2,16,227,61,197,254,52,238,127,124,67,103,133,
+10,104,12,59,5,235,2,16,227,0,0,2,0,100,255,216,5,97,8,112,0,25,0,32,0,0,
+19,22,23,53,16,18,0,37,23,6,0,2,17,21,23,22,22,21,20,6,35,34,38,39,38,39,
+1,52,39,22,51,50,54,117,122,113,235,1,185,1,45,48,248,254,122,207,2,197,203,
+129,95,142,186,23,116,143,2,182,250,35,124,44,47,1,239,8,18,17,1,57,2,114,
+2,26,197,73,165,253,254,253,174,254,221,47,45,53,153,93,75,97,209,192,23,
+15,254,237,113,79,246,37,0,1,251,62,5,20,254,208,7,55,0,7,0,0,1,6,0,7,39,
+54,36,37,254,208,203,253,222,92,73,132,1,238,1,1,6,231,90,254,209,74,116,
+98,241,92,0,1,251,38,5,20,254,200,7,11,0,17,0,0,1,39,4,7,39,54,37,38,39,55,
+22,23,54,55,23,6,7,23,253,131,92,254,227,182,46,106,1,77,64,51,59,58,81,211,
+149,48,126,203,100,5,76,136,143,49,130,24,141,84,54,44,55,91,93,79,78,81,
+107,127,0,1,0,160,255,246,3,175,4,240,0,16,0,0,1,6,2,21,20,23,7,38,38,39,
+55,22,23,53,52,0,55,3,175,178,186,30,162,51,152,84,24,115,100,1,9,224,4,179,
+197,254,52,238,127,124,67,103,133,10,104,12,59,5,235,2,16,227,0,1,0,120,255,
+248,3,235,6,124,0,33,0,0,1,22,21,20,6,21,20,23,7,38,53,52,54,53,52,39,7,34,
+38,53,52,54,36,55,23,4,4,6,21,20,22,51,50,54,2,209,29,13,42,177,45,13,6,108,
+146,190,205,1,147,252,23,254,243,254,211,133,94,79,42,148,3,159,145,163,72,
+163,100,145,89,58,97,164,119,198,79,70,48,4,174,139,134,236,177,37,61,71,
+141,170,121,87,106,13,0,2,0,0,255,236,4,140,8,112,0,33,0,48,0,0,5,38,2,53,
+52,19,18,55,6,35,34,38,38,53,52,54,54,51,50,22,23,54,55,23,6,7,6,2,2,6,21,
+20,22,23,1,50,55,55,53,52,38,35,34,6,6,21,20,22,22,3,25,122,123,37,44,9,102,
+67,139,209,121,105,180,112,200,222,4,157,155,29,147,197,6,40,43,33,69,86,
+254,128,79,94,1,142,119,68,105,59,79,144,20,140,1,83,214,156,1,8,1,60,121,
+22,77,158,93,82,153,89,254,220,54,82,86,89,66,141,254,232,254,244,255,117,
+141,243,98,6,44,19,20,19,157,187,50,85,46,63,106,52,0,1,0,50,255,246,4,59,
+8,112,0,36,0,0,1,30,2,21,20,6,21,20,23,7,38,53,52,54,53,52,38,39,6,35,34,
+38,53,52,0,36,37,23,6,4,2,21,20,22,51,50,3,43,24,57,36,13,42,177,45,13,26,
+21,105,115,192,239,1,2,1,235,1,5,23,255,254,123,209,138,123,155,4,129,21,
+154,193,86,101,214,100,145,89,60,97,166,89,212,133,101,159,29,20,221,183,
+180,1,73,253,38,61,67,228,254,228,148,133,143,0,2,0,120,255,216,5,77,5,105,
+0,61,0,70,0,0,1,22,23,54,55,23,6,7,22,23,7,38,39,2,17,20,23,54,51,50,22,21,
+20,6,6,35,34,39,6,6,35,34,38,53,52,55,54,53,52,38,38,39,55,22,18,21,20,7,
+6,21,20,22,51,50,54,54,55,38,53,16,19,39,1,34,7,22,51,50,53,52,38,2,253,151,
+89,116,139,48,116,90,156,79,42,85,152,114,6,95,82,111,119,67,113,67,184,91,
+92,223,73,108,127,14,13,32,52,35,167,60,72,13,14,32,45,38,78,81,119,21,181,
+249,1,163,67,70,41,97,91,50,4,204,81,54,168,124,63,121,168,100,63,64,58,78,
+254,250,254,210,58,48,25,90,81,41,79,46,143,49,74,123,112,48,97,96,46,88,
+243,172,53,58,106,254,179,178,72,104,105,21,43,34,16,25,52,73,85,1,54,1,60,
+116,252,98,22,95,54,31,32,0,0,3,251,89,5,20,255,136,8,49,0,5,0,11,0,17,0,
+0,3,6,5,39,54,37,1,6,5,39,54,37,37,6,5,39,54,37,120,225,254,253,13,130,1,
+84,253,221,225,254,253,13,130,1,84,1,58,225,254,253,13,130,1,84,7,184,51,
+17,75,15,99,253,39,51,17,75,15,99,183,51,17,75,15,99,0,1,253,44,5,20,254,
+192,8,16,0,7,0,0,1,54,18,55,23,6,2,7,253,44,32,156,68,148,78,169,68,5,53,
+153,1,205,117,73,127,254,145,197,0,2,0,100,255,236,4,64,4,94,0,33,0,44,0,
+0,37,6,6,35,34,38,53,52,55,38,39,55,22,23,54,54,51,50,22,21,20,6,6,35,34,
+39,6,21,20,22,51,50,54,55,1,50,54,53,52,38,35,34,6,7,22,4,64,85,242,136,204,
+234,42,57,72,58,63,45,79,250,148,142,157,92,174,121,127,141,21,152,140,110,
+187,55,254,137,103,124,78,74,93,152,50,123,215,111,124,237,203,130,128,31,
+49,86,45,26,167,178,140,120,90,142,81,56,92,85,147,157,92,77,1,100,111,88,
+63,71,148,134,51,0,0,1,250,236,5,20,254,186,7,126,0,22,0,0,1,6,0,7,39,55,
+54,53,52,38,35,34,7,39,54,51,50,22,21,20,7,54,37,254,186,199,254,33,107,79,
+63,104,56,53,63,20,85,62,110,121,134,11,253,1,15,6,229,95,254,225,83,101,
+44,90,154,57,62,31,83,58,128,109,47,40,143,102,0,2,255,136,253,168,3,87,4,
+94,0,19,0,28,0,0,1,38,39,6,2,0,7,39,0,17,38,38,53,52,54,51,50,22,23,23,1,
+20,22,23,38,38,35,34,6,3,77,49,80,9,198,254,159,228,48,2,145,230,239,129,
+95,172,228,21,142,253,121,172,149,18,124,88,44,47,2,74,3,10,199,254,74,254,
+104,154,73,1,236,2,153,51,163,102,75,97,225,189,20,1,14,67,109,37,123,144,
+37,0,0,3,255,201,255,236,8,35,6,185,0,41,0,53,0,62,0,0,39,54,55,18,0,51,50,
+22,21,7,54,55,18,18,55,23,6,6,2,7,54,51,7,6,7,2,2,35,34,38,53,52,55,4,7,6,
+7,7,54,55,6,7,37,50,62,2,55,6,7,6,21,20,22,1,32,3,54,55,54,53,52,38,55,170,
+185,91,1,74,204,113,113,4,198,201,31,240,218,48,113,135,79,27,139,144,3,152,
+138,31,231,196,145,177,11,254,248,232,20,18,196,9,24,102,158,5,25,52,79,54,
+39,15,218,185,15,98,254,165,254,244,111,231,241,8,52,234,120,99,1,56,1,97,
+155,149,73,34,16,1,22,1,201,195,63,108,223,254,233,246,6,87,4,12,254,155,
+254,144,214,173,84,114,79,119,127,191,54,134,125,63,115,44,58,109,188,211,
+28,44,137,98,116,143,3,90,254,78,100,57,109,43,68,57,0,1,0,220,255,236,8,
+35,6,185,0,45,0,0,5,34,38,53,52,55,54,53,52,38,35,34,6,2,3,7,18,18,0,51,50,
+22,21,20,7,6,21,20,22,51,50,62,2,55,18,18,55,23,14,2,2,3,2,2,4,237,145,177,
+16,16,52,49,124,183,115,32,196,15,195,1,55,184,113,113,16,16,98,81,54,79,
+54,38,16,18,241,237,48,88,120,76,55,27,33,230,20,214,173,77,170,169,70,68,
+57,188,254,122,254,161,54,1,64,2,8,1,27,155,149,38,152,152,93,116,143,60,
+112,190,225,1,44,1,244,214,63,84,170,188,254,251,254,239,254,166,254,156,
+0,3,0,120,255,236,5,69,8,112,0,40,0,50,0,59,0,0,23,18,19,38,53,52,0,37,23,
+6,0,2,21,20,23,54,51,50,22,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,55,38,
+38,39,6,2,3,1,34,7,22,22,23,54,53,52,38,1,52,39,6,21,20,22,51,50,120,56,182,
+215,1,197,1,147,48,230,254,188,170,129,177,223,82,127,67,15,42,161,117,136,
+106,112,119,22,225,142,70,41,65,39,1,238,166,109,85,200,100,28,84,1,90,165,
+19,52,35,97,5,1,226,1,46,201,253,225,1,230,216,73,123,254,227,254,211,141,
+177,148,206,70,119,70,45,115,210,98,135,69,88,119,126,110,86,139,117,86,50,
+101,254,234,254,246,3,161,149,74,123,57,173,95,49,86,252,211,91,103,114,55,
+47,53,0,14,0,100,253,168,12,248,8,42,0,27,0,63,0,114,0,126,0,143,0,151,0,
+179,0,190,0,200,0,210,0,221,0,232,0,243,0,254,0,0,1,6,7,23,7,39,6,3,6,6,35,
+34,38,39,38,2,39,7,39,1,54,54,51,50,23,23,54,55,3,6,4,35,34,38,39,6,6,35,
+34,39,6,6,35,32,39,55,22,22,51,50,54,55,22,22,51,50,54,55,22,22,51,50,36,
+55,1,22,21,20,6,21,20,22,51,50,62,2,55,54,54,51,50,22,22,21,20,2,35,34,38,
+39,55,22,22,51,50,54,53,52,38,35,34,6,7,7,2,35,34,38,53,52,54,53,52,39,37,
+22,18,23,18,19,39,38,38,35,34,7,5,6,2,21,20,23,7,38,38,39,55,22,23,53,52,
+18,55,1,4,4,7,39,54,36,55,1,54,36,36,51,50,22,23,62,3,51,50,4,23,7,2,33,32,
+1,46,2,35,34,4,7,1,6,35,34,39,55,22,22,51,50,55,1,38,35,34,7,39,54,51,50,
+23,1,38,35,34,7,39,54,51,50,23,37,38,35,34,7,39,54,54,51,51,23,1,38,35,34,
+7,39,54,54,51,51,23,1,6,35,34,39,55,22,22,51,50,55,5,6,35,34,39,55,22,22,
+51,50,55,12,204,192,154,101,50,92,134,101,56,57,44,29,37,17,50,140,30,77,
+38,1,163,30,69,20,46,80,113,167,204,221,122,254,165,165,197,251,87,56,215,
+110,254,171,87,203,84,254,172,217,141,84,238,115,126,189,101,112,199,94,124,
+177,114,63,250,151,158,1,30,116,248,173,36,11,50,53,28,50,44,44,38,61,160,
+117,89,135,73,154,123,66,119,29,52,43,61,31,68,92,100,83,58,99,54,30,100,
+200,104,114,11,34,5,115,17,133,31,109,201,88,26,58,29,43,89,249,145,144,147,
+24,129,40,124,66,19,94,78,206,185,4,205,254,243,253,229,73,53,148,2,25,236,
+248,253,96,1,134,1,105,143,185,249,101,64,139,179,234,158,252,1,185,124,182,
+250,254,112,253,190,254,251,81,123,155,102,243,253,244,149,2,4,61,49,168,
+120,87,50,111,52,43,34,2,24,88,82,101,66,50,105,166,83,77,253,121,88,82,101,
+66,50,105,166,83,77,5,198,47,48,147,85,65,72,191,98,23,23,2,42,47,48,147,
+85,65,72,191,98,23,23,251,162,61,49,168,120,87,50,111,52,43,34,3,153,61,49,
+168,120,87,50,111,52,43,34,5,83,218,254,123,42,96,236,254,178,184,84,15,29,
+83,1,244,184,59,52,1,106,28,44,100,139,244,210,249,39,128,156,67,71,59,79,
+138,64,74,201,182,108,135,128,146,142,132,111,163,127,147,127,121,4,81,81,
+128,71,178,106,119,114,40,72,115,143,233,194,119,209,130,195,255,0,80,61,
+32,50,35,207,147,159,196,175,197,103,254,190,176,159,81,179,80,119,68,41,
+146,254,1,50,1,155,1,62,93,26,46,66,46,161,254,148,191,104,96,54,81,108,8,
+83,10,47,4,181,1,165,190,1,4,56,154,40,116,65,118,22,1,9,91,217,114,93,95,
+44,89,71,45,190,158,234,1,188,254,68,163,141,77,230,156,248,247,28,103,127,
+57,61,14,6,210,55,81,89,123,31,254,118,55,81,89,123,31,127,10,105,79,87,92,
+2,254,240,10,105,79,87,92,2,248,111,28,103,127,57,61,14,98,28,103,127,57,
+61,14,0,4,0,200,255,236,5,199,8,112,0,61,0,72,0,80,0,89,0,0,1,50,23,55,6,
+35,34,38,38,53,52,54,36,55,23,6,4,6,21,20,22,51,50,55,23,6,7,4,21,20,6,6,
+7,22,23,54,51,50,22,21,20,6,35,34,39,6,6,35,34,38,53,52,54,54,55,54,55,38,
+35,34,7,55,1,38,53,53,6,6,21,20,51,50,54,1,52,38,39,6,7,54,54,3,34,7,22,51,
+50,53,52,38,2,58,158,131,44,41,53,114,173,94,214,1,137,240,23,242,254,209,
+142,105,101,103,61,56,26,21,1,233,101,212,213,5,18,76,82,113,137,131,102,
+217,95,156,141,66,116,160,123,228,226,11,35,157,180,124,52,20,1,212,26,227,
+165,103,81,153,2,70,175,153,14,4,201,145,177,50,65,51,99,77,56,4,94,7,132,
+12,90,157,95,135,241,176,35,61,64,150,180,120,105,111,39,80,97,129,45,167,
+72,111,85,42,160,94,8,91,79,78,106,205,38,23,110,89,85,126,93,46,139,157,
+9,3,141,252,209,102,138,4,45,96,66,74,23,2,67,32,46,14,124,126,39,72,253,
+173,7,127,75,21,38,0,0,1,255,202,254,173,0,54,6,77,0,3,0,0,3,17,51,17,54,
+108,254,173,7,160,248,96,0,1,254,213,254,174,1,43,6,77,0,14,0,0,19,23,7,39,
+17,35,17,7,39,55,39,55,23,55,23,74,225,75,170,108,170,75,225,225,75,224,224,
+75,5,43,220,73,169,249,255,6,1,169,73,220,217,73,220,220,74,0,0,8,0,106,0,
+222,3,170,4,29,0,10,0,18,0,26,0,34,0,42,0,50,0,58,0,68,0,0,1,20,6,35,34,53,
+52,54,51,50,22,5,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,
+53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,5,20,35,34,53,
+52,51,50,5,20,6,35,34,53,52,51,50,22,2,69,29,31,58,28,30,31,29,254,247,59,
+59,59,59,2,18,59,59,59,59,92,60,59,59,60,253,54,59,59,59,59,92,59,59,59,59,
+2,18,59,59,59,59,254,247,29,31,58,58,31,29,3,227,30,29,59,30,28,28,132,59,
+59,59,59,59,59,59,254,198,59,59,59,59,59,59,59,254,198,59,59,59,59,59,59,
+59,161,30,29,59,59,29,0,1,0,235,3,197,1,206,5,213,0,3,0,0,1,3,35,3,1,206,
+51,125,51,5,213,253,240,2,16,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,
+0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,
+74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,
+0,6,0,30,0,248,0,3,0,1,4,9,0,7,0,68,1,22,0,3,0,1,4,9,0,8,0,42,1,90,0,3,0,
+1,4,9,0,9,0,40,1,132,0,3,0,1,4,9,0,10,0,96,1,172,0,3,0,1,4,9,0,11,0,62,2,
+12,0,3,0,1,4,9,0,12,0,60,2,74,0,3,0,1,4,9,0,13,2,150,2,134,0,3,0,1,4,9,0,
+14,0,52,5,28,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,
+50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,
+0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,
+32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,97,0,105,0,32,0,86,0,105,0,101,
+0,116,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,
+0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,97,0,105,
+0,32,0,86,0,105,0,101,0,116,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,
+0,115,0,84,0,97,0,105,0,86,0,105,0,101,0,116,0,78,0,111,0,116,0,111,0,32,
+0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,
+0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,0,0,0,82,0,0,0,2,0,11,0,0,0,51,0,1,0,52,0,52,0,3,0,53,0,
+53,0,1,0,54,0,56,0,3,0,57,0,58,0,1,0,59,0,60,0,3,0,61,0,65,0,1,0,66,0,67,
+0,3,0,68,0,68,0,1,0,69,0,69,0,3,0,70,0,80,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,
+0,10,0,30,0,46,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,109,97,
+114,107,0,8,0,0,0,2,0,0,0,1,0,2,0,6,1,188,0,4,0,0,0,1,0,8,0,1,0,12,0,32,0,
+1,0,60,0,124,0,1,0,8,0,52,0,54,0,55,0,59,0,60,0,66,0,67,0,69,0,2,0,4,0,4,
+0,51,0,0,0,53,0,53,0,48,0,57,0,58,0,49,0,61,0,65,0,51,0,8,0,0,0,34,0,0,0,
+40,0,0,0,40,0,0,0,40,0,0,0,40,0,0,0,46,0,0,0,52,0,0,0,58,0,1,253,68,4,246,
+0,1,253,88,4,246,0,1,253,128,4,246,0,1,254,12,4,246,0,1,252,244,4,246,0,56,
+0,138,0,114,0,120,0,216,0,120,0,126,0,126,0,138,0,150,0,132,0,144,0,138,0,
+144,0,144,0,234,0,174,0,192,0,150,0,156,0,162,0,168,0,174,0,252,0,180,0,186,
+0,252,0,198,0,192,0,198,0,216,0,210,0,216,0,210,0,216,0,204,0,216,0,210,0,
+210,0,240,0,240,0,216,0,222,0,228,0,234,0,240,0,246,0,252,0,252,1,2,1,8,1,
+14,1,20,1,26,1,32,1,38,1,44,0,1,2,178,4,246,0,1,3,12,4,246,0,1,1,244,4,246,
+0,1,2,148,5,60,0,1,2,148,4,246,0,1,2,28,4,246,0,1,3,212,4,246,0,1,2,208,4,
+246,0,1,3,232,4,246,0,1,3,172,4,246,0,1,3,72,4,246,0,1,3,32,4,246,0,1,4,56,
+4,246,0,1,4,116,4,246,0,1,2,88,4,246,0,1,4,76,4,246,0,1,2,88,6,24,0,1,3,92,
+4,246,0,1,3,22,4,246,0,1,5,40,4,246,0,1,2,188,4,246,0,1,3,112,4,246,0,1,3,
+52,4,246,0,1,2,228,4,246,0,1,1,44,4,246,0,1,4,116,5,20,0,1,1,144,4,246,0,
+1,2,68,4,246,0,1,2,8,6,44,0,1,1,84,8,132,0,1,1,187,7,208,0,1,2,113,4,246,
+0,4,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,28,0,40,0,1,0,1,0,56,0,2,0,1,0,4,0,51,
+0,0,0,1,0,0,0,6,0,1,254,187,0,0,0,48,0,218,0,98,0,104,0,110,0,116,0,122,0,
+128,0,134,0,140,0,146,0,218,0,164,0,152,0,158,0,164,0,170,0,176,0,182,0,218,
+0,188,1,4,1,28,1,40,0,194,0,200,0,218,0,248,0,206,0,212,1,34,0,218,0,218,
+0,224,0,230,0,236,0,242,0,248,0,254,1,28,1,4,1,10,1,16,1,22,1,46,1,28,1,34,
+1,40,1,46,0,1,2,138,0,0,0,1,4,92,0,0,0,1,3,192,0,0,0,1,4,196,0,0,0,1,1,249,
+254,72,0,1,2,45,254,72,0,1,3,62,254,72,0,1,6,61,0,0,0,1,2,136,0,0,0,1,2,227,
+0,0,0,1,2,45,255,230,0,1,2,110,0,0,0,1,5,5,0,0,0,1,3,231,0,0,0,1,3,212,254,
+72,0,1,3,244,0,0,0,1,2,175,254,72,0,1,6,74,0,0,0,1,4,66,0,0,0,1,1,197,0,0,
+0,1,2,188,0,0,0,1,2,214,0,0,0,1,5,70,0,0,0,1,6,22,0,0,0,1,3,49,0,0,0,1,1,
+236,0,0,0,1,1,223,0,0,0,1,3,75,0,0,0,1,3,114,0,0,0,1,2,149,0,0,0,1,6,165,
+0,0,0,1,3,140,0,0,0,1,3,10,0,0,0,1,2,45,0,0,0,1,2,58,0,0,0,0,0,1,0,0,0,10,
+0,28,0,28,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,0,0,0,0,0,};
+#endif
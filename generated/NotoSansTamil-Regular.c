@@ -0,0 +1,1626 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansTamil_Regular_ttf_size = 38180;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansTamil_Regular_ttf");
+asm(".type fz_font_NotoSansTamil_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansTamil_Regular_ttf, 38180");
+asm(".balign 64");
+asm("fz_font_NotoSansTamil_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansTamil-Regular.ttf\"");
+#else
+const int fz_font_NotoSansTamil_Regular_ttf_size = 38180;
+const char fz_font_NotoSansTamil_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,4,75,4,48,0,0,139,104,0,0,0,76,71,
+80,79,83,227,108,208,255,0,0,139,180,0,0,2,62,71,83,85,66,34,222,71,235,0,
+0,141,244,0,0,7,48,79,83,47,50,118,152,106,247,0,0,1,104,0,0,0,96,99,109,
+97,112,255,63,74,216,0,0,5,36,0,0,1,114,103,97,115,112,0,7,0,7,0,0,139,92,
+0,0,0,12,103,108,121,102,128,65,186,235,0,0,8,72,0,0,111,160,104,101,97,100,
+10,15,208,43,0,0,0,236,0,0,0,54,104,104,101,97,21,8,14,98,0,0,1,36,0,0,0,
+36,104,109,116,120,236,8,64,71,0,0,1,200,0,0,3,92,108,111,99,97,209,253,237,
+62,0,0,6,152,0,0,1,176,109,97,120,112,0,239,1,17,0,0,1,72,0,0,0,32,110,97,
+109,101,139,78,184,18,0,0,119,232,0,0,5,250,112,111,115,116,198,99,132,9,
+0,0,125,228,0,0,13,120,0,1,0,0,0,1,17,236,7,91,204,122,95,15,60,245,0,11,
+8,0,0,0,0,0,202,184,169,17,0,0,0,0,210,40,204,4,252,142,253,110,17,129,6,
+190,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,6,246,253,10,0,0,17,201,252,142,254,183,
+17,129,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,0,1,0,0,0,215,0,142,0,10,0,129,
+0,10,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,7,64,1,144,0,5,0,0,5,154,5,51,
+0,0,0,230,5,154,5,51,0,0,2,92,0,102,2,129,0,0,2,11,5,6,3,8,4,2,2,4,0,16,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,6,246,253,10,0,0,6,
+246,2,246,0,0,0,1,0,0,0,0,4,110,4,110,0,0,0,32,0,4,4,205,0,193,0,0,0,0,2,
+20,0,0,2,20,0,0,2,209,0,114,7,43,0,92,8,247,0,60,10,130,0,60,9,2,0,100,5,
+167,0,180,8,137,0,117,12,82,0,117,6,104,0,117,6,104,0,117,8,46,0,129,7,226,
+0,107,7,226,0,107,16,104,0,107,6,153,0,100,8,91,0,180,5,201,0,100,8,46,0,
+129,9,176,0,139,5,139,0,180,13,49,0,117,6,153,0,97,6,80,0,97,9,224,0,117,
+6,57,0,180,6,226,0,180,7,180,0,180,5,31,0,180,7,0,0,97,8,27,0,117,8,144,0,
+117,6,226,0,129,8,91,0,117,9,104,0,180,10,199,0,117,10,71,0,117,12,252,0,
+97,5,31,0,180,2,25,253,150,0,0,252,150,4,17,254,64,6,214,254,64,7,54,0,117,
+5,211,0,119,9,80,0,117,13,168,0,117,12,24,0,119,17,51,0,117,0,0,253,61,9,
+74,0,147,8,144,0,117,5,52,0,120,6,153,0,100,8,137,0,128,7,226,0,180,7,135,
+0,100,8,105,0,139,8,13,0,100,6,104,0,117,8,247,0,60,9,61,0,100,7,0,0,180,
+7,24,0,180,7,185,0,97,7,226,0,117,10,37,0,180,17,201,0,139,6,247,0,80,11,
+45,0,117,15,189,0,117,8,105,0,139,9,183,0,97,14,211,0,100,6,153,0,100,8,91,
+0,180,5,201,0,100,8,46,0,129,9,176,0,139,5,139,0,180,13,49,0,117,6,153,0,
+97,6,80,0,97,9,224,0,117,6,57,0,180,6,226,0,180,7,180,0,180,5,31,0,180,6,
+252,0,94,8,27,0,117,8,144,0,117,6,226,0,129,8,91,0,117,9,104,0,180,10,149,
+0,117,10,71,0,117,12,252,0,97,14,140,0,100,8,127,0,139,10,167,0,100,8,91,
+0,180,8,91,0,180,9,182,0,170,6,240,0,100,9,143,0,139,9,207,0,78,12,183,0,
+78,6,96,0,180,6,96,0,180,8,30,0,146,7,56,0,146,14,186,0,78,17,163,0,78,8,
+186,0,78,11,163,0,78,8,119,0,80,11,96,0,80,11,105,0,78,14,82,0,78,6,57,0,
+180,6,57,0,180,7,148,0,178,9,18,0,139,9,223,0,139,7,180,0,180,7,180,0,180,
+9,15,0,178,8,105,0,139,9,55,0,139,9,25,0,80,12,2,0,80,10,43,0,117,8,27,0,
+117,10,20,0,78,12,253,0,78,11,222,0,139,12,211,0,139,9,18,0,139,9,223,0,139,
+8,91,0,117,8,91,0,117,9,181,0,117,12,87,0,117,10,71,0,117,12,28,0,180,2,25,
+252,235,2,25,252,142,2,25,253,99,3,243,253,20,6,184,253,20,2,39,0,148,3,105,
+0,143,5,43,0,51,6,166,0,101,2,1,0,143,2,104,0,82,2,104,0,61,4,104,0,82,4,
+147,0,104,2,0,0,63,2,147,0,82,2,37,0,147,3,36,0,40,4,147,0,103,4,147,0,184,
+4,147,0,100,4,147,0,93,4,147,0,44,4,147,0,130,4,147,0,111,4,147,0,91,4,147,
+0,102,4,147,0,99,2,37,0,94,2,37,0,63,4,147,0,103,4,147,0,116,4,147,0,103,
+3,144,0,77,2,139,0,164,3,36,0,41,2,149,0,81,4,147,0,81,3,142,255,252,2,244,
+0,62,4,104,1,134,2,244,0,82,4,147,0,103,2,147,0,82,4,0,0,82,8,0,0,82,1,202,
+0,73,1,202,0,73,3,75,0,73,3,75,0,73,6,111,0,147,4,147,0,133,4,147,0,104,4,
+147,0,103,4,147,0,147,0,0,255,196,0,0,254,183,4,126,0,117,2,205,1,104,4,143,
+1,104,0,0,0,0,2,128,0,30,2,162,0,30,2,226,0,30,2,128,0,30,2,162,0,30,2,226,
+0,30,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,102,0,0,0,82,0,64,0,5,0,18,0,0,0,13,0,
+35,0,37,0,63,0,95,0,126,0,160,0,173,0,179,0,215,0,247,9,101,11,131,11,138,
+11,144,11,149,11,154,11,156,11,159,11,164,11,170,11,185,11,194,11,200,11,
+205,11,208,11,215,11,250,32,13,32,20,32,25,32,29,32,38,32,116,32,132,32,185,
+34,18,37,204,254,255,255,255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,
+0,173,0,178,0,215,0,247,9,100,11,130,11,133,11,142,11,146,11,153,11,156,11,
+158,11,163,11,168,11,174,11,190,11,198,11,202,11,208,11,215,11,230,32,11,
+32,19,32,24,32,28,32,38,32,116,32,130,32,185,34,18,37,204,254,255,255,255,
+0,1,255,245,0,0,0,119,0,118,0,91,0,64,255,99,0,18,0,31,255,240,255,209,247,
+106,244,130,244,129,244,126,244,125,244,122,244,121,244,120,244,117,244,114,
+244,111,244,107,244,104,244,103,244,101,244,95,244,81,0,0,224,173,224,170,
+224,168,224,160,224,95,224,82,224,17,222,183,219,1,1,209,0,1,0,0,0,0,0,78,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,3,0,153,0,154,0,155,0,208,0,203,0,204,0,0,0,0,0,21,0,21,0,21,0,21,
+0,60,0,162,1,6,1,151,2,61,2,115,2,194,3,78,3,136,3,207,4,87,4,218,5,106,6,
+44,6,122,6,172,6,231,7,119,7,230,7,246,8,137,8,232,9,48,9,151,9,171,9,219,
+10,3,10,34,10,120,10,208,11,22,11,123,11,194,12,5,12,133,12,241,13,130,13,
+151,13,191,13,246,14,37,14,129,14,207,15,41,15,154,15,170,15,186,15,202,15,
+230,16,161,16,169,16,215,16,223,17,34,17,81,17,143,17,234,18,45,18,53,18,
+140,18,249,19,58,19,100,19,205,20,20,20,140,21,72,21,146,22,12,22,194,23,
+68,23,203,24,114,24,126,24,138,24,150,24,162,24,174,24,186,24,198,24,210,
+24,222,24,234,24,246,25,2,25,14,25,26,25,38,25,50,25,62,25,74,25,86,25,98,
+25,110,25,122,25,134,25,146,25,248,26,103,26,201,27,1,27,100,27,163,28,21,
+28,140,29,11,29,70,29,135,29,221,30,72,31,16,31,224,32,75,32,189,33,20,33,
+115,34,10,34,169,34,235,35,4,35,74,35,161,36,13,36,101,36,146,36,235,37,54,
+37,151,37,254,38,109,38,229,39,106,39,237,40,120,40,241,41,126,41,227,42,
+96,42,215,43,36,43,158,44,44,44,199,45,93,45,137,45,180,45,222,46,13,46,105,
+46,135,46,163,46,223,47,48,47,69,47,121,47,172,47,214,47,244,48,15,48,33,
+48,65,48,92,48,138,48,161,48,206,49,9,49,45,49,92,49,153,49,172,49,246,50,
+50,50,110,50,166,50,193,50,219,50,246,51,74,51,104,51,131,51,161,51,182,51,
+202,52,18,52,43,52,116,52,171,52,179,52,198,52,217,52,248,53,23,53,72,53,
+121,53,202,53,242,54,35,54,54,54,109,54,122,54,152,54,244,55,7,55,33,55,33,
+55,82,55,142,55,181,55,190,55,199,55,208,0,2,0,193,0,0,4,10,5,182,0,3,0,7,
+0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,
+74,104,4,230,0,0,2,0,114,4,209,2,95,6,190,0,11,0,23,0,0,1,50,22,21,20,6,35,
+34,38,53,52,54,19,50,54,53,52,38,35,34,6,21,20,22,1,104,108,139,138,109,109,
+137,138,108,55,70,70,55,54,70,69,6,190,139,108,108,138,137,109,109,138,254,
+138,71,56,56,72,71,57,56,71,0,0,6,0,92,255,234,6,207,6,190,0,11,0,23,0,35,
+0,47,0,59,0,71,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,
+52,38,35,34,6,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,
+6,2,48,198,160,158,198,196,156,164,198,163,109,87,85,107,110,83,86,109,253,
+137,198,160,158,198,196,156,164,198,163,109,87,85,107,111,82,86,109,3,6,198,
+160,158,198,196,156,164,198,163,108,88,85,107,111,82,87,108,5,72,168,206,
+206,168,169,208,205,169,107,125,124,112,108,123,125,251,175,169,206,207,168,
+168,208,204,169,106,125,125,110,108,123,125,107,169,206,208,167,168,208,204,
+169,106,125,125,110,108,123,124,0,0,4,0,60,253,110,8,68,4,136,0,40,0,52,0,
+64,0,65,0,0,1,35,17,33,6,4,33,35,32,36,53,52,54,54,51,33,54,53,52,38,39,22,
+21,20,6,35,34,38,53,52,54,51,50,4,18,21,20,7,33,17,51,5,39,38,6,21,20,22,
+51,50,54,53,52,1,33,34,6,6,21,20,22,51,51,50,36,3,8,68,179,254,186,99,254,
+29,254,180,27,254,226,254,188,62,141,157,4,32,20,139,126,51,176,151,153,187,
+228,188,189,1,36,161,15,1,23,179,251,217,21,115,140,95,80,79,91,1,36,252,
+59,99,70,42,223,208,31,255,1,109,9,254,197,2,15,220,246,204,172,67,108,63,
+75,80,161,245,55,83,82,148,170,170,150,163,184,168,254,210,174,82,74,3,6,
+117,1,5,109,100,82,100,99,89,117,253,43,14,43,41,105,114,162,253,53,0,0,3,
+0,60,253,110,10,121,4,136,0,78,0,90,0,102,0,0,5,35,17,33,6,4,33,35,32,36,
+53,52,54,54,51,33,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,4,18,
+21,20,7,33,17,51,17,54,51,50,22,22,21,20,6,4,35,35,32,36,53,52,54,51,50,23,
+7,38,35,34,6,21,20,22,51,51,32,36,53,52,38,35,34,7,1,39,38,6,21,20,22,51,
+50,54,53,52,1,33,34,6,6,21,20,22,51,51,50,36,8,68,179,254,186,99,254,29,254,
+180,27,254,226,254,188,62,141,157,4,32,20,139,126,51,176,151,153,187,228,
+188,190,1,37,159,15,1,23,179,100,128,92,159,86,190,254,158,237,12,254,245,
+254,218,150,129,102,117,29,107,71,64,70,209,204,14,1,17,1,69,103,89,115,86,
+251,217,21,115,140,95,80,79,91,1,36,252,59,99,70,42,223,208,31,255,1,109,
+254,1,210,220,246,204,172,67,108,63,75,80,161,245,55,83,82,148,170,170,150,
+163,184,170,254,211,173,82,74,3,6,252,33,63,83,154,102,156,239,130,179,164,
+100,131,42,134,35,50,47,87,101,207,175,90,102,61,3,246,1,5,109,100,82,100,
+99,89,117,253,43,14,43,41,105,114,162,0,5,0,100,253,110,8,78,6,190,0,65,0,
+77,0,87,0,98,0,109,0,0,1,22,21,20,6,35,34,38,53,52,54,51,32,0,17,20,7,22,
+22,21,20,6,35,34,39,6,35,34,38,53,52,54,55,38,2,53,16,18,36,33,32,4,18,17,
+17,35,17,16,2,36,33,34,4,2,21,20,18,23,54,33,50,23,54,53,52,2,37,35,34,6,
+21,20,22,51,50,54,53,52,3,54,54,55,38,35,32,7,22,22,5,22,51,50,54,53,52,38,
+39,6,6,1,6,21,20,22,51,50,54,55,38,38,4,174,61,178,155,144,190,247,212,1,
+25,1,56,55,134,141,229,206,225,222,222,235,197,228,107,107,86,74,249,1,199,
+1,48,1,63,1,164,225,177,158,254,170,254,225,240,254,130,209,61,67,227,1,38,
+249,199,37,142,254,218,15,120,140,96,80,78,91,121,134,211,61,167,232,254,
+239,187,87,226,1,49,123,146,135,137,75,75,69,196,252,146,112,135,135,77,120,
+72,126,214,3,231,89,108,137,165,178,138,161,183,254,173,254,211,173,182,81,
+227,132,181,202,102,102,204,179,120,200,81,175,1,54,166,1,8,1,187,242,224,
+254,37,254,127,253,126,2,45,1,108,1,175,220,198,254,141,250,136,254,252,147,
+99,69,130,143,184,1,1,64,107,94,81,97,99,86,112,250,218,83,250,147,63,88,
+145,228,164,45,124,120,79,146,58,152,241,1,106,104,145,123,124,18,26,82,226,
+0,0,3,0,180,0,0,5,115,4,110,0,9,0,21,0,33,0,0,19,33,21,33,17,35,17,33,17,
+35,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,180,
+4,191,254,106,178,254,58,177,2,21,74,55,56,74,74,56,56,73,2,121,74,56,57,
+73,74,56,56,74,4,110,148,252,38,3,218,252,38,2,57,57,74,74,57,55,74,73,56,
+56,75,75,56,55,74,74,0,0,2,0,117,0,0,8,103,4,136,0,42,0,54,0,0,37,21,33,34,
+38,53,52,54,55,55,62,2,53,52,38,39,22,21,20,6,35,34,38,53,52,36,51,32,4,21,
+20,6,6,7,7,14,2,21,20,22,51,19,35,34,6,21,20,22,51,50,54,53,52,8,103,249,
+33,129,135,159,175,148,150,194,103,179,164,71,179,155,144,190,1,7,230,1,42,
+1,68,113,246,241,164,75,70,22,32,39,182,15,120,140,96,80,78,92,148,148,98,
+95,98,97,17,15,15,66,115,99,121,161,15,99,111,138,164,178,138,164,180,240,
+205,133,176,105,24,16,7,18,22,19,25,22,3,102,107,94,80,98,98,87,110,0,0,4,
+0,117,0,0,11,244,4,138,0,42,0,54,0,89,0,100,0,0,37,21,33,34,38,53,52,54,55,
+55,62,2,53,52,38,39,22,21,20,6,35,34,38,53,52,36,51,32,4,21,20,6,6,7,7,14,
+2,21,20,22,51,19,35,34,6,21,20,22,51,50,54,53,52,37,53,33,21,35,17,35,17,
+33,17,35,17,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,
+22,1,22,22,51,50,54,53,52,38,35,34,11,244,245,148,129,135,159,175,148,150,
+194,103,179,164,71,179,155,144,190,1,7,230,1,42,1,68,113,246,241,164,75,70,
+22,32,39,182,15,120,140,96,80,78,92,6,71,3,60,241,168,254,235,168,68,134,
+84,134,182,24,93,102,120,148,155,131,149,184,122,233,149,90,143,253,184,11,
+90,79,59,73,81,67,87,148,148,98,95,98,97,17,15,15,66,115,99,121,161,15,99,
+111,138,164,178,138,164,180,240,205,133,176,105,24,16,7,18,22,19,25,22,3,
+102,107,94,80,98,98,87,110,126,74,140,253,69,2,187,253,69,2,74,78,59,146,
+131,74,145,118,130,152,207,189,151,224,121,46,253,248,98,97,74,63,65,78,0,
+0,2,0,117,255,232,6,70,4,110,0,25,0,36,0,0,1,21,33,17,35,17,35,34,6,6,7,54,
+51,50,22,21,20,6,35,34,2,53,52,18,36,33,1,22,22,51,50,54,53,52,38,35,34,6,
+70,254,165,178,181,197,231,159,24,116,129,152,179,186,161,181,220,168,1,66,
+1,47,253,138,6,126,110,79,96,105,87,115,4,110,148,252,38,3,218,73,187,130,
+76,180,155,167,194,1,10,247,198,1,30,161,253,67,154,164,106,97,98,112,0,4,
+0,117,253,110,6,70,4,110,0,27,0,38,0,39,0,40,0,0,1,21,33,17,1,39,1,17,35,
+34,6,6,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,33,1,22,22,51,50,54,53,52,
+38,35,34,1,1,6,70,254,165,254,55,117,1,140,181,198,231,156,25,116,128,152,
+179,186,161,181,220,168,1,66,1,47,253,138,6,126,110,79,96,105,87,115,3,153,
+254,58,4,110,148,252,38,254,77,110,1,119,3,168,73,186,131,76,180,155,167,
+194,1,10,247,198,1,30,161,253,67,154,164,106,97,98,112,251,94,2,146,0,0,2,
+0,129,253,110,7,173,4,138,0,86,0,97,0,0,37,32,6,21,20,22,51,50,54,54,53,53,
+51,21,20,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,32,39,6,6,35,34,36,38,
+53,52,54,36,33,51,32,36,54,53,52,38,35,34,6,6,21,21,35,53,52,38,35,34,7,22,
+22,21,20,6,35,34,38,53,52,54,36,51,32,23,54,33,50,18,21,20,6,4,33,1,6,21,
+20,22,51,50,54,53,52,38,3,106,254,200,252,207,179,144,149,62,178,147,157,
+121,133,31,21,174,33,23,238,192,254,219,104,59,229,157,169,255,0,139,143,
+1,57,1,32,193,1,51,1,31,124,163,135,95,113,49,178,177,183,87,59,130,153,192,
+154,165,188,141,1,1,150,1,74,121,106,1,2,220,253,158,254,157,254,169,253,
+35,85,96,92,81,100,154,129,144,175,153,165,87,141,131,127,74,220,192,151,
+142,55,154,39,60,91,144,80,201,235,229,112,117,117,210,127,157,212,112,80,
+174,154,153,175,83,143,133,234,180,215,203,13,24,165,116,147,177,182,149,
+131,206,118,228,228,254,251,215,185,244,128,3,20,80,135,89,98,94,77,99,129,
+0,0,2,0,107,253,110,7,119,4,138,0,81,0,92,0,0,1,6,6,21,20,22,22,51,51,21,
+33,6,7,6,4,35,34,38,53,52,54,55,23,6,6,21,20,51,50,54,54,55,54,55,38,38,53,
+52,54,54,51,50,23,6,21,20,51,50,54,53,52,38,36,35,32,4,7,54,51,50,22,21,20,
+6,35,34,38,53,52,18,36,33,32,0,17,20,6,35,34,38,53,52,37,20,22,51,50,54,53,
+52,38,35,34,5,1,76,84,107,203,175,189,254,153,27,29,95,254,254,190,185,226,
+62,60,152,53,43,248,79,139,111,33,31,27,152,165,106,189,116,47,51,66,169,
+80,89,173,254,191,211,254,237,254,137,75,101,99,144,166,180,157,158,214,200,
+1,145,1,64,1,155,1,216,175,168,149,169,252,43,120,101,72,86,95,81,105,2,60,
+43,152,92,119,164,77,147,34,57,186,159,190,171,85,175,76,73,78,120,62,215,
+60,128,59,57,33,64,232,157,111,207,121,12,142,113,176,121,104,155,231,122,
+149,139,63,170,145,159,179,227,191,175,1,15,166,254,146,254,241,184,209,147,
+136,92,41,132,145,96,85,87,101,0,0,3,0,107,253,110,7,119,4,138,0,80,0,91,
+0,102,0,0,1,6,6,21,20,22,22,51,51,21,33,6,7,6,4,35,35,34,38,53,52,54,51,50,
+22,21,20,7,54,54,55,54,55,38,38,53,52,54,54,51,50,23,6,21,20,51,50,54,53,
+52,38,36,35,32,4,7,54,51,50,22,21,20,6,35,34,38,53,52,18,36,33,32,0,17,20,
+6,35,34,38,53,52,37,20,22,51,50,54,53,52,38,35,34,1,54,53,52,38,35,34,6,21,
+20,22,5,1,76,84,107,203,175,189,254,153,27,29,95,254,254,190,42,218,255,183,
+144,155,177,72,104,140,61,32,26,150,167,106,189,116,47,51,66,169,80,89,173,
+254,191,211,254,237,254,137,75,101,99,144,166,180,157,158,214,200,1,145,1,
+64,1,155,1,216,175,168,149,169,252,43,120,101,72,86,95,81,105,1,109,80,87,
+81,69,87,123,2,60,43,152,92,119,164,77,147,34,57,186,159,183,163,132,165,
+166,122,113,90,18,121,105,58,31,63,233,158,111,207,121,12,142,113,176,121,
+104,155,231,122,149,139,63,170,145,159,179,227,191,175,1,15,166,254,146,254,
+241,184,209,147,136,92,41,132,145,96,85,87,101,251,126,81,104,82,91,84,78,
+90,100,0,4,0,107,253,110,16,70,4,138,0,81,0,92,0,127,0,138,0,0,1,6,6,21,20,
+22,22,51,51,21,33,6,7,6,4,35,34,38,53,52,54,55,23,6,6,21,20,51,50,54,54,55,
+54,55,38,38,53,52,54,54,51,50,23,6,21,20,51,50,54,53,52,38,36,35,32,4,7,54,
+51,50,22,21,20,6,35,34,38,53,52,18,36,33,32,0,17,20,6,35,34,38,53,52,37,20,
+22,51,50,54,53,52,38,35,34,1,53,33,21,33,17,35,17,33,17,35,17,38,38,35,34,
+6,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,50,22,1,22,22,51,50,54,53,
+52,38,35,34,5,1,76,84,107,203,175,189,254,153,27,29,95,254,254,190,185,226,
+62,60,152,53,43,248,79,139,111,33,31,27,152,165,106,189,116,47,51,66,169,
+80,89,173,254,191,211,254,237,254,137,75,101,99,144,166,180,157,158,214,200,
+1,145,1,64,1,155,1,216,175,168,149,169,252,43,120,101,72,86,95,81,105,10,
+205,4,10,254,164,177,254,155,177,75,179,117,172,238,31,118,129,152,179,186,
+161,181,220,158,1,34,181,112,180,253,10,9,124,109,79,96,105,87,115,2,60,43,
+152,92,119,164,77,147,34,57,186,159,190,171,85,175,76,73,78,120,62,215,60,
+128,59,57,33,64,232,157,111,207,121,12,142,113,176,121,104,155,231,122,149,
+139,63,170,145,159,179,227,191,175,1,15,166,254,146,254,241,184,209,147,136,
+92,41,132,145,96,85,87,101,1,134,104,148,252,38,3,218,252,38,3,69,90,83,224,
+191,77,180,155,167,194,1,17,253,201,1,43,160,61,253,101,157,162,106,97,98,
+112,0,3,0,100,255,233,6,54,4,110,0,35,0,41,0,52,0,0,1,33,21,33,17,51,32,22,
+21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,35,21,20,6,6,35,34,38,53,52,
+54,55,37,51,17,33,17,54,5,35,34,6,21,20,22,51,50,54,53,1,71,4,47,254,129,
+56,1,15,248,186,172,45,112,45,38,72,68,104,101,158,193,47,121,205,154,191,
+244,113,114,1,96,162,254,159,84,1,13,176,205,183,146,127,158,133,4,110,148,
+254,198,188,173,156,170,16,14,135,21,92,99,104,105,67,207,195,83,185,156,
+109,151,43,51,1,58,254,186,12,143,99,116,89,100,152,159,0,0,1,0,180,0,0,7,
+167,4,110,0,32,0,0,19,33,21,33,17,54,51,50,22,21,20,7,33,17,51,17,33,53,33,
+54,54,53,52,38,35,34,7,21,35,17,33,17,35,180,4,34,254,155,121,140,153,184,
+96,1,142,178,251,25,1,227,60,55,101,89,115,116,177,254,165,177,4,110,148,
+254,182,86,170,139,169,116,3,218,251,146,148,60,123,72,92,98,89,210,2,180,
+252,38,0,3,0,100,255,233,5,118,4,110,0,19,0,25,0,36,0,0,1,33,21,33,17,33,
+21,33,21,20,6,6,35,34,38,38,53,52,54,55,37,51,17,33,17,54,5,35,34,6,21,20,
+22,51,50,54,53,1,71,4,47,254,129,1,127,254,129,121,205,154,123,203,109,113,
+114,1,96,162,254,159,84,1,13,176,205,183,146,127,158,133,4,110,148,254,198,
+143,67,207,195,83,86,155,100,109,151,43,51,1,58,254,186,12,143,99,116,89,
+100,152,159,0,0,3,0,129,253,110,7,173,4,138,0,82,0,93,0,103,0,0,5,6,7,6,6,
+35,34,38,53,52,54,36,33,51,32,36,54,53,52,38,35,34,6,6,21,21,35,53,52,38,
+35,34,7,22,22,21,20,6,35,34,38,53,52,54,36,51,32,23,54,33,50,18,21,20,6,4,
+33,35,32,6,21,20,22,51,50,54,54,55,62,2,51,50,22,22,21,20,6,35,34,38,53,52,
+1,6,21,20,22,51,50,54,53,52,38,1,6,21,20,22,51,50,54,53,52,5,64,100,119,132,
+241,144,225,254,143,1,57,1,32,193,1,51,1,31,124,163,135,95,113,49,178,177,
+183,87,59,130,153,192,154,165,188,141,1,1,150,1,74,121,106,1,2,220,253,158,
+254,157,254,169,235,254,200,252,164,125,77,118,106,79,100,148,183,129,110,
+187,102,183,144,155,177,252,121,85,96,92,81,100,151,3,250,79,87,81,69,87,
+184,46,146,161,121,252,202,157,212,112,80,174,154,153,175,83,143,133,234,
+180,215,203,13,24,165,116,147,177,182,149,131,206,118,228,228,254,251,215,
+185,244,128,144,175,154,164,40,76,88,110,117,62,83,154,104,134,168,166,122,
+102,4,161,80,135,89,98,94,77,100,128,251,208,83,103,82,91,84,78,184,0,2,0,
+139,253,110,9,76,4,110,0,60,0,71,0,0,1,23,2,17,21,16,0,33,51,32,0,17,52,38,
+35,34,7,17,35,17,35,34,6,6,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,33,33,
+21,33,17,54,51,50,18,21,16,0,4,33,35,32,36,2,17,53,52,18,1,22,22,51,50,54,
+53,52,38,35,34,1,151,152,243,1,237,1,208,28,1,169,1,217,115,109,93,104,177,
+182,194,231,161,23,114,129,152,179,186,160,181,221,164,1,66,1,52,2,184,254,
+164,102,127,170,203,255,0,254,21,254,190,67,254,154,254,18,253,142,2,6,6,
+125,111,79,96,105,87,115,4,110,89,254,146,254,166,26,254,133,254,84,1,92,
+1,69,161,171,73,254,80,3,218,71,187,131,75,180,155,167,194,1,11,246,193,1,
+30,166,148,254,108,71,254,254,226,254,250,254,141,194,234,1,185,1,33,43,182,
+1,157,254,2,153,166,106,97,98,112,0,1,0,180,0,0,5,105,4,110,0,5,0,0,33,33,
+17,51,17,33,5,105,251,75,177,4,4,4,110,252,38,0,0,4,0,117,255,232,13,15,4,
+138,0,67,0,79,0,91,0,102,0,0,1,22,18,21,20,6,35,34,38,53,52,18,55,38,38,35,
+34,4,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,23,54,51,50,23,54,54,
+51,33,21,33,17,35,17,35,34,6,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,
+5,6,6,21,20,22,51,50,54,53,52,38,37,6,6,21,20,22,51,50,54,53,52,38,1,22,22,
+51,50,54,53,52,38,35,34,5,171,118,120,173,159,163,176,97,98,85,207,106,211,
+254,232,36,118,128,152,179,186,161,181,220,178,1,70,214,1,19,221,194,248,
+244,190,101,241,172,2,110,254,164,178,143,133,154,60,105,106,173,159,163,
+176,111,104,138,167,189,2,99,76,83,83,77,80,84,85,252,77,67,74,83,77,80,84,
+95,251,140,9,126,107,79,96,105,87,113,3,161,109,254,238,158,198,214,213,192,
+160,1,10,107,48,48,220,195,77,180,155,167,194,1,17,253,197,1,45,162,140,140,
+135,59,48,148,252,38,3,218,30,31,107,254,236,154,198,214,213,192,162,1,27,
+102,82,173,79,238,132,136,137,137,120,136,242,80,78,231,133,136,137,137,120,
+136,239,254,199,157,162,106,97,98,112,0,0,3,0,97,253,110,6,54,4,110,0,46,
+0,52,0,63,0,0,1,33,21,33,17,4,4,21,20,6,6,4,35,35,34,14,2,21,20,23,7,38,53,
+52,54,54,51,51,32,36,54,53,52,38,39,21,20,6,6,35,34,38,53,52,54,55,37,51,
+17,33,17,54,5,35,34,6,21,20,22,51,50,54,53,1,71,4,47,254,129,1,35,1,28,88,
+194,254,237,247,229,80,94,73,36,7,171,13,89,168,147,222,1,21,1,16,141,193,
+205,121,205,154,191,244,113,114,1,96,162,254,159,84,1,13,176,205,183,146,
+127,158,133,4,110,148,254,197,8,237,229,119,186,149,63,20,49,83,66,70,42,
+8,94,66,103,145,78,72,174,141,146,157,9,65,207,195,83,185,156,109,151,43,
+51,1,58,254,186,12,143,99,116,89,100,152,159,0,0,2,0,97,253,110,5,237,4,110,
+0,45,0,46,0,0,1,7,38,53,52,54,54,51,51,32,36,54,53,52,38,35,34,7,17,35,17,
+33,17,35,17,33,21,33,17,54,54,51,50,22,21,20,6,6,4,35,35,34,6,6,21,20,1,1,
+25,171,13,89,167,148,146,1,43,1,11,127,116,106,115,112,178,254,156,177,4,
+44,254,155,75,116,64,163,208,83,188,254,231,255,154,116,112,54,1,5,253,118,
+8,94,66,103,145,78,83,185,181,152,164,88,254,7,3,218,252,38,4,110,148,254,
+190,47,31,250,213,159,216,154,70,47,90,81,70,2,73,0,0,3,0,117,255,232,9,190,
+4,138,0,46,0,58,0,69,0,0,1,34,6,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,
+34,4,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,23,54,54,51,33,21,33,
+17,35,17,5,6,6,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,53,52,38,35,34,
+7,19,112,184,55,111,118,173,159,163,176,99,100,161,241,211,254,232,36,118,
+128,152,179,186,161,181,220,178,1,70,214,1,15,236,102,252,174,2,112,254,164,
+178,253,133,69,73,83,77,80,84,93,251,138,9,126,107,79,96,105,87,113,3,218,
+35,33,103,254,240,155,198,214,213,192,158,1,14,111,90,220,195,77,180,155,
+167,194,1,17,253,197,1,45,162,141,60,53,148,252,38,3,218,155,82,229,132,136,
+137,137,120,135,238,254,201,157,162,106,97,98,112,0,1,0,180,0,0,5,133,4,110,
+0,7,0,0,1,17,33,17,51,17,33,17,5,133,251,47,177,3,111,4,110,251,146,4,110,
+252,38,3,218,0,0,2,0,180,0,0,6,97,4,138,0,17,0,30,0,0,51,17,51,17,33,17,52,
+54,54,51,50,18,17,20,14,2,35,39,51,50,54,54,53,52,38,35,34,6,6,21,180,177,
+1,206,80,164,124,215,231,56,128,197,203,53,96,133,155,73,140,129,71,91,26,
+4,110,252,38,2,67,165,179,91,254,185,254,214,133,202,139,63,148,70,166,162,
+220,248,84,128,117,0,0,1,0,180,255,233,7,0,4,110,0,23,0,0,1,17,20,22,22,51,
+50,55,17,51,17,33,17,51,17,33,53,6,35,34,38,38,53,17,1,101,24,78,70,114,81,
+178,2,200,178,251,212,99,134,101,134,76,4,110,253,95,147,115,74,113,3,128,
+252,38,3,218,251,146,71,94,93,171,154,2,227,0,0,2,0,180,253,110,4,253,4,110,
+0,11,0,12,0,0,1,21,33,17,1,39,1,17,33,17,35,17,1,4,253,254,165,254,55,117,
+1,140,254,117,177,1,175,4,110,148,252,38,254,77,110,1,119,3,168,252,38,4,
+110,249,0,0,0,2,0,97,253,110,6,117,4,138,0,54,0,55,0,0,1,34,6,6,21,20,23,
+7,38,53,52,54,54,51,51,32,36,18,53,52,2,35,34,6,6,21,17,35,17,52,38,35,34,
+6,6,21,17,35,17,52,54,54,51,50,23,54,54,51,50,18,17,16,2,4,33,1,2,44,116,
+112,54,7,171,13,89,167,148,252,1,61,1,28,117,159,154,86,115,55,178,83,86,
+85,84,29,177,79,156,111,211,84,46,181,123,230,252,167,254,151,254,185,254,
+249,254,192,47,90,81,70,42,8,94,66,103,145,78,139,1,32,250,250,1,2,75,143,
+141,253,114,2,176,173,152,86,171,130,253,142,2,191,169,190,100,196,93,103,
+254,168,254,194,254,235,254,152,183,1,41,0,0,3,0,117,255,232,7,154,4,204,
+0,45,0,56,0,57,0,0,1,55,22,18,21,16,2,35,34,2,53,52,38,38,35,34,6,7,54,51,
+50,22,21,20,6,35,34,2,53,52,18,36,51,50,22,22,21,20,22,22,51,50,54,53,52,
+2,1,22,22,51,50,54,53,52,38,35,34,1,5,231,160,141,134,220,216,217,207,78,
+157,124,174,237,30,116,132,152,179,186,161,181,220,157,1,28,177,194,236,99,
+58,111,90,122,123,129,250,177,9,126,107,79,96,105,87,115,3,122,4,96,108,178,
+254,153,191,254,252,254,248,1,13,250,197,217,101,220,196,78,180,155,167,194,
+1,17,253,201,1,43,160,153,245,230,163,163,80,178,179,179,1,62,253,220,157,
+162,106,97,98,112,2,94,0,2,0,117,255,232,8,110,4,138,0,34,0,45,0,0,1,53,33,
+21,33,17,35,17,33,17,35,17,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,
+52,18,36,51,50,22,1,22,22,51,50,54,53,52,38,35,34,4,100,4,10,254,164,177,
+254,155,177,75,179,117,172,238,31,118,129,152,179,186,161,181,220,158,1,34,
+181,112,180,253,10,9,124,109,79,96,105,87,115,4,6,104,148,252,38,3,218,252,
+38,3,69,90,83,224,191,77,180,155,167,194,1,17,253,201,1,43,160,61,253,101,
+157,162,106,97,98,112,0,0,2,0,129,253,110,6,97,4,138,0,57,0,70,0,0,1,6,7,
+14,2,35,35,34,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,51,51,50,54,55,
+55,38,39,33,17,51,17,33,17,52,54,54,51,50,18,17,20,14,2,35,35,30,2,51,33,
+21,1,51,50,54,54,53,52,38,35,34,6,6,21,4,123,5,12,49,120,198,161,51,117,208,
+97,175,146,75,68,15,51,50,84,88,133,127,51,137,174,55,12,168,7,253,129,177,
+1,206,80,164,124,215,231,57,129,201,169,83,1,57,109,91,1,6,253,250,96,133,
+155,73,140,129,71,91,26,254,172,6,27,94,119,72,65,129,83,116,141,11,137,7,
+57,56,68,69,92,111,23,75,214,4,110,252,38,2,67,165,179,91,254,185,254,214,
+136,204,136,61,75,84,33,148,1,232,70,166,162,220,248,84,128,117,0,0,2,0,117,
+255,232,7,167,4,138,0,34,0,45,0,0,37,33,17,51,17,33,39,54,17,52,38,35,34,
+6,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,0,17,20,6,37,22,22,51,50,
+54,53,52,38,35,34,4,212,2,32,179,252,119,7,107,223,193,180,242,30,116,132,
+152,179,186,161,181,220,154,1,34,185,1,27,1,51,47,252,15,9,126,107,79,96,
+105,87,115,148,3,218,251,146,130,161,1,3,214,246,220,196,78,180,155,167,194,
+1,17,253,200,1,41,163,254,195,254,240,112,202,175,157,162,106,97,98,112,0,
+0,2,0,180,255,232,8,180,4,110,0,31,0,42,0,0,1,17,20,22,22,51,50,54,54,53,
+17,33,17,16,6,35,34,38,38,53,17,33,17,20,6,6,35,34,38,38,53,17,5,33,17,20,
+22,22,51,50,54,54,53,1,101,45,114,105,108,114,41,5,64,231,210,137,200,103,
+254,226,99,200,142,137,200,103,7,79,253,241,45,114,105,108,114,41,4,110,253,
+135,143,152,81,88,152,136,2,121,253,112,254,243,233,103,208,189,1,254,253,
+255,183,206,108,104,207,182,2,153,148,254,27,143,152,81,88,152,136,0,0,6,
+0,117,253,110,10,39,4,138,0,51,0,62,0,73,0,80,0,81,0,82,0,0,1,17,33,3,39,
+19,33,39,54,17,52,38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,
+32,0,17,20,6,7,33,55,38,38,53,52,54,51,50,22,21,20,7,54,55,5,54,53,52,38,
+35,34,6,21,20,22,5,22,22,51,50,54,53,52,38,35,34,5,6,7,7,33,53,52,1,1,10,
+39,253,184,147,162,135,252,237,7,107,223,193,180,242,30,116,132,152,179,186,
+161,181,220,154,1,34,185,1,27,1,51,47,53,2,130,57,204,226,196,160,157,172,
+43,159,127,254,49,42,78,73,86,100,150,249,247,9,126,107,79,96,105,87,115,
+8,3,137,194,58,1,126,253,105,254,121,2,160,253,96,253,187,45,2,24,130,161,
+1,3,214,246,220,196,78,180,155,167,194,1,17,253,200,1,41,163,254,195,254,
+240,112,202,111,227,21,211,180,164,211,178,152,120,188,26,122,155,193,115,
+91,98,122,109,119,136,94,157,162,106,97,98,112,31,103,19,227,165,112,251,
+197,7,0,0,3,0,117,255,232,9,198,4,204,0,61,0,72,0,73,0,0,1,54,54,51,50,22,
+21,21,20,22,22,51,50,54,53,52,2,39,55,22,18,21,16,2,35,34,2,53,53,52,38,38,
+35,34,6,21,17,35,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,52,
+18,36,51,32,1,22,22,51,50,54,53,52,38,35,34,1,4,135,44,161,108,163,185,58,
+111,90,122,123,129,128,160,141,134,220,216,211,212,41,82,65,81,99,177,93,
+172,105,172,238,31,118,129,152,179,186,161,181,220,158,1,34,181,1,14,253,
+32,9,124,109,79,96,105,87,115,3,22,3,169,111,114,214,245,169,163,163,80,178,
+179,179,1,62,138,108,178,254,153,191,254,252,254,248,1,3,250,104,196,164,
+64,163,131,253,49,2,101,131,179,87,224,191,77,180,155,167,194,1,17,253,201,
+1,43,160,253,40,157,162,106,97,98,112,2,94,0,3,0,97,253,110,12,113,4,138,
+0,85,0,96,0,97,0,0,1,34,6,6,21,20,23,7,38,53,52,54,54,51,33,32,36,18,53,52,
+2,35,34,6,6,21,17,35,17,52,38,35,34,6,6,21,17,33,39,54,17,52,38,35,34,6,7,
+54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,0,17,20,6,7,33,17,52,54,54,
+51,50,23,54,54,51,50,18,17,16,2,4,33,1,22,22,51,50,54,53,52,38,35,34,1,2,
+44,117,111,54,7,171,13,88,168,148,6,247,1,62,1,28,117,157,154,89,116,53,178,
+83,86,85,84,29,252,189,7,107,223,193,181,240,30,118,129,152,179,186,161,181,
+220,154,1,34,185,1,27,1,51,47,53,1,220,79,156,111,211,84,46,181,123,230,252,
+167,254,151,254,185,247,254,9,126,107,79,96,105,87,113,3,220,254,192,47,90,
+81,70,42,8,80,80,104,144,78,138,1,32,251,252,1,0,78,144,137,253,114,2,176,
+173,152,86,171,130,253,142,130,161,1,3,214,246,220,195,77,180,155,167,194,
+1,17,253,200,1,41,163,254,195,254,240,112,202,111,2,43,169,190,100,196,93,
+103,254,168,254,194,254,235,254,152,183,2,242,157,162,106,97,98,112,2,94,
+0,0,1,0,180,0,0,4,253,4,110,0,9,0,0,19,33,21,33,17,35,17,33,17,35,180,4,73,
+254,165,178,254,117,177,4,110,148,252,38,3,218,252,38,0,2,253,150,0,0,1,101,
+6,190,0,22,0,23,0,0,1,38,38,53,52,54,51,50,22,18,21,17,35,17,52,38,38,35,
+34,6,21,20,23,55,253,209,28,31,252,204,167,244,108,177,68,159,119,129,146,
+70,51,4,30,53,134,62,199,224,163,254,231,254,251,252,3,197,237,242,128,145,
+123,137,113,80,0,3,252,150,4,59,0,17,6,190,0,21,0,33,0,34,0,0,1,38,53,52,
+36,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,23,1,6,21,20,22,51,50,54,
+53,52,38,35,19,252,189,39,1,24,249,171,191,145,123,120,143,29,113,118,53,
+1,66,38,67,61,58,66,106,98,11,4,59,84,109,201,249,138,118,118,134,121,105,
+71,63,30,155,110,111,76,1,244,57,67,62,66,65,53,65,69,254,50,0,3,254,64,255,
+232,3,193,4,110,0,14,0,27,0,28,0,0,1,50,22,22,21,20,6,35,34,38,53,52,55,33,
+53,5,6,21,20,22,51,50,54,53,52,38,38,35,19,1,248,183,186,88,199,148,192,201,
+8,253,91,3,85,9,107,103,83,97,84,129,131,71,4,110,101,157,101,146,184,220,
+187,75,59,148,148,54,73,132,133,101,81,75,101,34,252,14,0,3,254,64,255,232,
+6,97,6,190,0,43,0,57,0,58,0,0,1,50,22,22,21,20,6,35,34,38,53,53,52,55,33,
+53,33,54,0,51,50,4,18,21,16,2,4,35,34,36,39,55,22,33,32,0,17,52,2,38,35,34,
+6,7,7,21,20,22,51,50,54,53,52,38,38,35,35,6,1,2,42,183,186,88,199,148,191,
+202,3,253,46,2,233,60,1,85,242,211,1,58,168,196,254,139,251,171,254,189,133,
+94,249,1,11,1,60,1,86,125,235,162,174,238,46,28,109,101,83,97,84,129,131,
+43,3,1,242,4,110,101,157,101,146,184,237,205,22,40,37,148,239,1,8,193,254,
+153,231,254,231,254,118,203,104,98,141,195,1,120,1,97,183,1,34,157,180,169,
+226,40,140,134,101,81,75,101,34,37,3,9,0,2,0,117,255,237,6,130,6,190,0,37,
+0,50,0,0,37,38,53,52,54,51,50,22,21,20,6,35,34,36,2,53,16,18,36,51,50,4,18,
+17,17,35,17,52,2,38,38,35,34,4,2,21,20,18,5,22,51,50,54,53,52,38,35,34,6,
+21,20,2,55,41,191,168,155,193,219,183,207,254,185,180,234,1,151,229,232,1,
+39,152,177,49,124,192,134,174,254,184,189,139,1,61,36,50,110,120,104,86,90,
+105,197,83,97,157,186,195,164,181,199,203,1,112,232,1,22,1,173,235,162,254,
+174,254,193,252,117,3,5,254,1,27,182,80,192,254,147,248,194,254,216,146,7,
+124,113,93,118,115,101,134,0,3,0,119,255,237,5,139,6,190,0,35,0,47,0,59,0,
+0,37,38,53,52,54,51,50,22,21,20,6,35,34,36,2,17,16,18,36,51,50,22,21,20,6,
+35,34,38,53,52,55,6,0,17,16,18,1,6,21,20,22,51,50,54,53,52,38,35,3,50,54,
+53,52,38,35,34,6,21,20,23,3,16,62,178,149,152,189,249,201,237,254,133,205,
+220,1,143,247,196,238,189,152,151,176,76,248,254,234,252,1,185,83,91,79,80,
+96,142,117,30,118,142,95,81,79,91,69,146,104,127,153,186,191,164,179,201,
+213,1,139,1,7,1,10,1,140,212,189,170,156,181,175,149,111,100,58,254,138,254,
+237,254,234,254,139,5,97,93,129,88,99,106,86,102,115,250,76,126,111,94,117,
+114,102,138,94,0,0,4,0,117,255,232,8,197,4,138,0,52,0,62,0,73,0,74,0,0,1,
+22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,4,7,54,51,50,22,21,20,6,35,34,
+2,53,52,18,36,51,50,4,23,54,54,51,32,0,17,20,2,7,39,54,54,53,52,38,35,34,
+7,6,17,20,22,51,50,54,53,16,5,22,22,51,50,54,53,52,38,35,34,1,5,161,123,125,
+173,159,163,176,94,100,175,222,211,254,232,36,118,128,152,179,186,161,181,
+220,178,1,70,214,131,1,0,105,66,200,92,1,12,1,36,84,102,149,83,71,205,178,
+138,213,139,83,77,80,84,251,45,9,126,107,79,96,105,87,113,3,164,3,176,109,
+254,228,163,198,214,213,192,157,1,10,120,86,220,195,77,180,155,167,194,1,
+17,253,197,1,45,162,68,64,60,72,254,191,254,244,161,254,225,149,90,118,240,
+141,206,239,169,173,254,232,136,137,137,120,1,44,238,157,162,106,97,98,112,
+2,94,255,255,0,117,255,237,13,134,6,190,0,38,0,46,0,0,0,39,0,52,10,20,252,
+244,0,7,0,41,8,137,0,0,255,255,0,119,255,237,11,247,6,190,0,38,0,47,0,0,0,
+39,0,52,8,161,252,244,0,7,0,41,6,250,0,0,255,255,0,117,255,232,17,17,6,190,
+0,38,0,46,0,0,0,39,0,52,10,23,252,244,0,7,0,34,8,163,0,0,0,3,253,61,4,110,
+254,80,6,190,0,11,0,12,0,13,0,0,1,20,6,35,34,38,53,52,54,51,50,22,39,3,254,
+80,79,59,59,78,77,60,60,78,134,4,5,245,60,78,77,61,59,78,78,142,253,176,0,
+5,0,147,253,110,8,223,4,138,0,81,0,93,0,105,0,122,0,132,0,0,1,6,6,21,20,22,
+22,51,51,21,33,7,6,6,4,33,32,36,53,52,54,55,23,6,21,20,22,33,50,54,54,55,
+38,38,53,52,54,54,51,50,23,6,21,20,51,50,54,53,52,0,33,32,4,7,54,54,51,50,
+22,21,20,6,35,34,38,38,53,52,54,36,36,33,32,0,17,20,6,35,34,38,53,52,37,21,
+20,22,51,50,54,53,52,38,35,34,1,20,6,35,34,38,53,52,54,51,50,22,1,17,51,17,
+51,53,52,54,54,51,50,22,21,20,6,6,35,39,51,50,54,53,52,38,35,34,21,6,105,
+76,84,107,203,175,189,254,117,27,77,184,254,220,254,216,254,172,254,191,56,
+50,143,81,228,1,11,225,244,162,77,138,141,106,189,116,47,51,66,169,80,89,
+254,64,254,101,254,178,254,71,90,35,99,40,144,166,180,157,97,171,104,111,
+1,8,1,141,1,57,1,248,2,23,175,168,149,169,250,235,120,101,72,86,95,81,105,
+2,218,54,38,38,52,52,38,40,52,253,244,125,169,34,80,60,108,125,45,106,109,
+23,57,53,49,61,47,51,2,60,43,152,92,119,164,77,147,50,142,165,79,190,199,
+68,174,70,72,116,126,124,114,57,140,153,67,223,150,111,207,121,12,142,113,
+176,121,104,241,1,11,119,117,23,28,170,145,159,179,91,177,119,132,201,181,
+89,254,150,254,237,184,209,147,136,92,81,15,125,137,96,85,87,101,254,115,
+40,51,52,39,39,52,52,253,66,1,211,254,140,185,82,73,46,154,112,64,96,55,95,
+53,68,74,91,63,0,255,255,0,117,255,232,8,110,4,138,2,6,0,34,0,0,0,2,0,120,
+255,232,4,188,4,138,0,15,0,27,0,0,19,52,18,54,51,50,22,18,21,20,2,6,35,34,
+38,2,55,20,22,51,50,54,53,52,38,35,34,6,120,138,250,159,163,248,134,137,249,
+156,162,250,138,182,195,168,169,196,195,168,169,196,2,60,175,1,13,146,150,
+254,238,166,175,254,239,148,147,1,16,174,206,238,237,207,204,240,237,0,255,
+255,0,100,255,233,6,54,4,110,2,6,0,18,0,0,0,2,0,128,0,0,8,103,4,136,0,30,
+0,44,0,0,37,21,33,34,38,53,52,54,55,38,38,53,52,36,51,50,4,22,21,20,6,6,7,
+7,14,2,21,20,22,51,19,62,2,53,52,38,35,34,6,21,20,22,23,8,103,249,33,129,
+135,100,101,88,96,1,19,241,174,1,3,138,113,246,241,164,75,70,22,32,39,238,
+167,188,92,213,173,167,180,104,97,148,148,98,95,79,89,23,76,189,93,193,225,
+110,205,130,133,176,105,24,16,7,18,22,19,25,22,1,16,18,71,113,93,129,167,
+141,128,94,174,63,0,1,0,180,0,0,7,192,4,110,0,30,0,0,19,33,21,33,17,54,51,
+50,22,21,20,7,33,21,33,53,33,54,54,53,52,38,35,34,7,21,35,17,33,17,35,180,
+4,34,254,155,121,140,153,184,96,2,89,251,0,1,227,60,55,101,89,115,116,177,
+254,165,177,4,110,148,254,182,86,170,139,169,116,148,148,60,123,72,92,98,
+89,210,2,180,252,38,0,3,0,100,255,233,6,231,4,110,0,21,0,27,0,38,0,0,1,33,
+21,33,17,33,17,51,17,33,21,20,6,6,35,34,38,38,53,52,54,55,37,51,17,33,17,
+54,5,35,34,6,21,20,22,51,50,54,53,1,71,4,7,254,169,2,63,177,253,16,121,205,
+154,123,203,109,113,114,1,96,162,254,159,84,1,13,176,205,183,146,127,158,
+133,4,110,148,254,198,1,206,253,163,67,207,195,83,86,155,100,109,151,43,51,
+1,58,254,186,12,143,99,116,89,100,152,159,0,0,1,0,139,253,110,8,5,6,190,0,
+54,0,0,1,54,51,50,18,21,16,2,4,35,35,32,0,2,17,53,16,18,0,33,50,4,23,7,38,
+36,35,32,4,2,17,21,16,18,4,33,51,32,0,17,52,38,35,34,7,17,35,17,33,17,35,
+17,33,21,33,5,171,102,127,169,204,224,254,104,254,22,254,196,254,59,237,255,
+1,224,1,73,207,1,118,233,96,189,254,174,202,254,255,254,110,217,193,1,115,
+1,8,23,1,78,1,117,117,109,93,104,177,254,156,178,4,44,254,155,2,70,71,254,
+250,218,254,252,254,137,196,1,17,2,6,1,85,97,1,48,2,35,1,48,105,139,149,132,
+107,255,254,39,254,193,25,254,203,254,59,238,1,95,1,66,160,172,73,254,80,
+3,218,252,38,4,110,148,0,3,0,100,255,233,7,225,4,110,0,26,0,32,0,43,0,0,33,
+17,35,17,35,17,35,21,20,6,6,35,34,38,53,52,54,55,17,33,21,33,17,33,21,35,
+17,1,51,17,33,17,54,5,35,34,6,21,20,22,51,50,54,53,6,134,244,166,245,121,
+205,154,191,244,113,114,4,47,254,129,3,234,181,251,123,162,254,159,84,1,13,
+176,205,183,146,127,158,133,2,17,253,239,2,17,67,207,195,83,186,155,109,151,
+43,2,1,148,254,198,143,253,239,2,160,1,58,254,186,12,143,99,116,89,100,152,
+159,0,255,255,0,117,255,232,6,70,4,110,2,2,0,12,0,0,0,4,0,60,253,110,8,68,
+4,138,0,29,0,41,0,53,0,54,0,0,1,35,17,33,6,4,33,35,32,36,53,52,54,54,51,33,
+38,53,52,54,51,50,4,18,21,20,7,33,17,51,1,33,54,53,52,38,38,35,34,6,21,20,
+3,50,36,55,33,34,6,6,21,20,22,51,1,8,68,179,254,187,99,254,28,254,180,27,
+254,226,254,188,62,141,157,1,109,177,251,213,181,1,16,148,15,1,23,179,251,
+181,1,203,20,110,196,121,126,154,89,250,1,109,98,252,60,99,70,42,223,208,
+2,130,254,197,2,15,222,244,204,172,67,108,63,177,213,186,226,164,254,212,
+182,77,79,3,6,252,250,77,78,145,229,124,143,128,217,253,138,159,158,14,43,
+41,105,114,253,215,0,4,0,100,255,232,8,217,4,110,0,47,0,53,0,64,0,75,0,0,
+1,33,21,33,17,33,50,23,54,51,50,4,21,20,6,7,39,54,54,53,52,38,35,34,7,22,
+22,21,20,6,35,34,38,53,52,55,33,21,20,6,6,35,34,38,53,52,54,55,1,33,17,54,
+51,51,7,34,6,21,20,22,51,50,54,53,53,5,6,21,20,22,51,50,54,53,52,38,1,71,
+4,47,254,129,1,82,30,27,153,212,232,1,2,60,75,142,53,47,169,147,105,67,130,
+130,152,142,152,177,64,254,226,121,205,154,191,244,113,114,2,2,254,159,84,
+107,162,176,205,183,146,127,158,133,2,112,74,92,85,64,71,134,4,110,148,254,
+198,2,121,229,196,102,179,109,87,74,136,82,138,155,23,44,172,122,150,161,
+173,163,116,101,67,207,195,83,185,156,109,151,43,1,109,254,186,12,143,99,
+116,89,100,152,159,93,5,88,139,89,93,90,76,104,124,0,0,1,0,180,255,232,6,
+117,6,190,0,41,0,0,1,54,51,32,0,17,16,33,34,38,39,6,35,34,38,38,53,17,51,
+17,20,22,51,50,54,53,17,51,17,20,22,22,51,50,18,17,16,2,35,34,6,7,2,91,190,
+208,1,55,1,85,254,0,118,171,43,84,199,110,156,80,177,89,100,89,89,178,64,
+112,67,171,158,236,252,86,174,72,6,93,97,254,67,254,32,252,199,102,94,196,
+99,190,170,2,187,253,128,223,146,159,166,2,172,253,118,154,138,67,1,79,1,
+82,1,132,1,130,46,44,0,1,0,180,0,0,6,246,4,133,0,26,0,0,51,17,52,54,54,51,
+50,23,53,33,21,33,17,35,17,33,17,35,17,38,35,34,14,2,21,17,180,75,133,103,
+134,99,4,34,254,165,178,254,156,177,81,114,47,69,46,10,2,230,151,169,95,94,
+71,148,252,38,3,218,252,38,3,128,113,35,79,114,108,253,95,0,0,3,0,97,253,
+110,7,165,4,110,0,56,0,62,0,73,0,0,33,35,17,33,21,20,6,6,35,34,38,38,53,52,
+54,55,17,33,21,33,17,33,21,33,21,54,54,51,50,22,21,20,6,6,35,33,34,6,6,21,
+20,23,7,38,53,52,54,51,33,50,54,53,52,38,35,34,7,1,51,17,33,17,54,5,35,34,
+6,21,20,22,51,50,54,53,5,182,167,254,232,121,205,154,123,203,109,113,114,
+4,47,254,129,2,200,254,247,49,96,67,120,163,125,238,216,252,202,116,112,54,
+7,171,13,202,202,3,106,220,185,85,76,77,80,252,241,162,254,159,84,1,13,176,
+205,183,146,127,158,133,2,17,67,207,195,83,86,155,100,109,151,43,2,1,148,
+254,198,143,229,31,27,167,123,134,172,82,47,90,81,70,42,8,94,66,163,163,96,
+129,74,95,53,1,247,1,58,254,186,12,143,99,116,89,100,152,159,0,0,3,0,117,
+255,232,7,192,4,138,0,32,0,43,0,44,0,0,37,33,21,33,39,54,17,52,38,35,34,6,
+7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,0,17,20,6,37,22,22,51,50,
+54,53,52,38,35,34,1,4,212,2,236,252,94,7,107,223,193,180,242,30,116,132,152,
+179,186,161,181,220,154,1,34,185,1,27,1,51,47,252,15,9,126,107,79,96,105,
+87,115,5,110,148,148,130,161,1,3,214,246,220,196,78,180,155,167,194,1,17,
+253,200,1,41,163,254,195,254,240,112,202,175,157,162,106,97,98,112,2,94,0,
+3,0,180,0,0,10,3,6,190,0,59,0,71,0,84,0,0,1,6,6,21,21,22,18,21,20,14,2,35,
+33,17,51,17,33,17,52,54,54,51,50,23,54,54,55,54,54,51,50,22,21,20,7,33,21,
+33,53,54,54,53,52,38,35,34,6,7,51,50,22,22,21,20,6,35,34,38,53,55,7,6,22,
+22,51,50,54,53,52,38,35,1,51,50,54,54,53,52,38,35,34,6,6,21,5,201,58,65,133,
+142,56,128,197,203,252,155,177,1,206,80,164,124,20,18,15,136,121,38,229,146,
+193,221,57,1,40,254,49,39,31,137,118,100,145,32,51,108,119,57,125,102,118,
+147,131,1,1,10,61,60,49,56,76,99,253,93,96,133,155,73,140,129,71,91,26,5,
+44,21,100,69,5,57,254,209,232,133,202,139,63,4,110,252,38,2,67,165,179,91,
+2,114,139,26,136,151,193,162,136,101,118,78,69,117,68,118,140,82,72,52,90,
+74,104,121,162,142,25,14,20,104,71,50,47,60,52,251,88,70,166,162,220,248,
+84,128,117,0,0,2,0,139,253,110,17,72,6,190,0,110,0,121,0,0,1,55,22,18,21,
+16,2,35,34,2,53,16,2,36,36,33,32,0,17,21,16,0,33,51,32,0,17,52,38,35,34,7,
+17,35,17,33,17,33,39,54,17,52,38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,
+52,18,36,51,32,0,17,20,6,7,33,17,33,21,33,17,54,51,50,22,22,21,16,0,33,35,
+32,0,0,17,53,16,0,0,33,51,32,5,4,23,22,23,22,23,22,21,20,22,22,51,50,17,16,
+1,22,22,51,50,54,53,52,38,35,34,15,149,160,141,134,220,216,217,207,176,254,
+136,253,161,254,44,252,210,252,221,3,10,3,4,41,2,140,2,126,122,102,65,68,
+177,254,186,253,3,7,107,223,193,180,242,30,116,132,152,179,186,161,181,220,
+154,1,34,185,1,27,1,51,47,53,1,148,3,241,254,185,79,86,109,171,93,253,23,
+253,59,70,253,210,252,255,254,120,1,148,3,17,2,59,113,1,175,1,68,1,41,208,
+181,112,101,43,33,58,111,90,245,242,140,9,126,107,79,96,105,87,115,4,96,108,
+178,254,153,191,254,252,254,248,1,13,250,1,66,1,137,244,114,254,8,254,3,25,
+254,4,253,246,1,95,1,98,133,167,34,254,41,3,218,252,38,130,161,1,3,214,246,
+220,196,78,180,155,167,194,1,17,253,200,1,41,163,254,195,254,240,112,202,
+111,3,218,148,254,144,35,113,204,120,254,83,254,67,1,14,2,11,1,113,75,1,112,
+2,5,1,6,64,59,116,102,153,137,190,147,224,163,163,80,1,101,1,103,254,102,
+157,162,106,97,98,112,0,0,2,0,80,253,110,6,67,4,110,0,38,0,49,0,0,5,54,53,
+53,6,35,34,38,38,53,17,51,17,20,22,22,51,50,55,17,51,17,20,7,33,17,51,17,
+33,6,4,35,34,38,53,52,54,54,51,5,33,34,6,6,21,20,22,51,50,54,3,119,17,99,
+134,101,134,76,177,24,78,70,114,81,178,19,1,106,178,253,187,73,254,218,196,
+160,219,61,96,102,1,245,253,250,27,28,18,109,99,143,184,172,76,144,23,94,
+93,171,154,2,227,253,95,147,115,74,113,3,128,251,175,104,97,3,76,252,32,162,
+176,177,138,62,78,31,148,7,23,19,64,76,94,0,0,3,0,117,255,232,10,156,4,110,
+0,63,0,74,0,86,0,0,1,35,17,35,17,35,34,6,6,7,54,51,50,22,21,20,6,35,34,2,
+53,52,18,36,33,33,21,33,17,51,54,54,51,50,22,21,20,7,33,17,51,17,33,53,54,
+54,53,52,38,35,34,6,7,51,50,22,22,21,20,6,35,34,38,53,37,22,22,51,50,54,53,
+52,38,35,34,5,7,6,22,22,51,50,54,53,52,38,35,5,162,183,178,181,197,231,159,
+24,116,129,152,179,186,161,181,220,168,1,66,1,47,2,184,254,165,202,40,228,
+142,193,221,57,1,84,148,253,113,39,31,137,118,100,145,32,51,108,119,57,125,
+102,118,147,251,118,6,126,110,79,96,105,87,115,4,159,1,1,10,61,60,49,56,76,
+99,1,68,254,188,3,218,73,187,130,76,180,155,167,194,1,10,247,198,1,30,161,
+148,253,218,128,146,193,162,136,101,2,60,253,78,78,69,117,68,118,140,82,72,
+52,90,74,104,121,162,142,134,154,164,106,97,98,112,204,14,20,104,71,50,47,
+60,52,0,6,0,117,253,110,15,29,6,190,0,76,0,87,0,98,0,111,0,118,0,119,0,0,
+37,54,17,52,38,39,22,21,20,6,35,34,38,53,52,18,55,38,36,33,34,4,2,21,20,18,
+23,38,53,52,54,51,50,22,21,20,6,35,34,36,2,53,16,18,36,33,32,0,19,4,0,17,
+20,6,7,33,55,38,38,53,52,54,51,50,22,21,20,7,54,55,51,17,33,3,39,19,33,1,
+54,53,52,38,35,34,6,21,20,22,1,6,6,21,20,22,51,50,54,53,52,1,22,51,50,54,
+53,52,38,35,34,6,21,20,1,6,7,7,33,53,52,1,9,13,107,177,163,56,200,189,164,
+200,239,209,135,254,133,255,0,215,254,156,195,139,129,41,191,168,155,193,
+219,183,207,254,185,180,242,1,188,1,22,1,65,1,244,129,1,24,1,39,47,53,2,130,
+57,205,225,196,160,157,172,43,159,127,166,253,184,147,162,135,252,237,3,148,
+42,78,73,86,100,150,251,81,159,173,97,91,103,108,251,72,36,50,110,120,104,
+86,90,105,11,209,137,194,58,1,126,253,95,130,161,1,3,193,244,26,169,187,228,
+243,206,191,207,1,43,52,223,208,196,254,149,246,194,254,216,80,83,97,157,
+186,195,164,181,199,203,1,112,232,1,27,1,172,231,254,219,254,241,6,254,194,
+254,247,112,202,111,227,21,211,180,164,211,178,152,120,188,26,122,253,96,
+253,187,45,2,24,2,5,193,115,91,98,122,109,119,136,1,224,31,227,172,124,129,
+173,159,179,253,63,7,124,113,93,118,115,101,134,1,19,103,19,227,165,112,251,
+197,0,0,2,0,139,253,110,8,5,6,190,0,77,0,88,0,0,1,33,21,33,53,54,54,53,52,
+38,35,34,7,54,51,50,22,21,20,6,35,34,38,39,6,2,17,21,16,18,4,51,51,32,0,17,
+52,38,35,34,7,17,35,17,33,17,35,17,33,21,33,17,54,51,50,18,21,20,2,4,33,35,
+32,36,2,17,53,52,18,0,55,54,54,51,50,22,21,20,37,21,20,51,50,54,53,52,38,
+35,34,5,253,1,15,254,74,39,31,124,120,166,92,44,54,98,115,121,102,106,132,
+11,208,246,185,1,104,254,22,1,97,1,123,115,109,93,104,177,254,156,178,4,44,
+254,155,102,127,168,205,217,254,94,254,239,41,254,209,254,78,228,162,1,44,
+190,45,230,124,191,209,253,71,124,47,54,61,54,56,4,236,118,62,53,93,54,100,
+102,93,14,108,84,96,110,117,99,117,253,246,254,209,43,254,252,254,120,208,
+1,76,1,58,153,166,70,254,117,3,138,252,118,4,30,148,254,148,71,254,255,216,
+250,254,154,190,247,1,211,1,45,51,251,1,201,1,66,63,100,125,147,132,108,66,
+4,156,44,39,43,48,0,0,3,0,97,253,110,9,149,6,190,0,82,0,94,0,95,0,0,1,6,6,
+21,21,33,17,54,54,51,50,22,21,20,6,6,4,35,35,34,6,6,21,20,23,7,38,53,16,33,
+51,50,62,2,53,52,38,35,34,7,17,35,17,33,17,35,17,33,54,37,54,54,51,50,22,
+21,20,7,33,21,33,53,54,54,53,52,38,35,34,6,7,51,50,22,22,21,20,6,35,34,38,
+53,55,7,6,22,22,51,50,54,53,52,38,35,1,5,91,58,65,254,155,75,116,64,163,208,
+83,188,254,231,255,154,116,112,54,7,171,13,1,148,145,227,253,147,62,114,106,
+114,110,178,254,156,177,3,165,18,1,0,38,229,146,193,221,57,1,40,254,49,39,
+31,137,118,100,145,32,51,108,119,57,125,102,118,147,131,1,1,10,61,60,49,56,
+76,99,251,254,5,44,21,100,69,148,254,190,47,31,250,213,159,216,154,70,47,
+90,81,70,42,8,94,66,1,70,46,110,163,130,151,165,88,254,7,3,218,252,38,4,110,
+250,55,136,151,193,162,136,101,118,78,69,117,68,118,140,82,72,52,90,74,104,
+121,162,142,25,14,20,104,71,50,47,60,52,250,173,0,0,7,0,100,253,110,14,51,
+4,138,0,68,0,79,0,85,0,95,0,106,0,113,0,114,0,0,1,17,33,3,39,19,33,39,54,
+54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,55,33,21,20,6,6,35,34,38,
+53,52,54,55,17,33,21,33,17,33,54,54,51,50,4,21,20,6,7,33,55,38,38,53,52,54,
+51,50,22,21,20,7,54,55,5,54,53,52,38,35,34,6,21,20,22,37,54,51,51,17,33,1,
+6,21,20,22,51,50,54,53,52,37,35,34,6,21,20,22,51,50,54,53,37,6,7,7,33,53,
+52,1,14,51,253,184,147,162,135,253,12,8,46,49,192,170,183,103,192,209,162,
+159,146,177,16,254,194,121,205,154,191,244,113,114,4,47,254,129,1,115,70,
+253,154,249,1,17,47,42,2,106,57,205,225,196,160,157,172,43,159,127,254,49,
+42,78,73,86,100,150,246,187,84,107,162,254,159,3,241,26,97,89,67,74,252,67,
+176,205,183,146,127,158,133,10,76,137,194,58,1,126,253,109,2,160,253,96,253,
+187,45,2,24,130,63,168,88,164,186,133,15,187,157,162,169,208,194,85,66,67,
+207,195,83,185,156,109,151,43,2,1,148,254,198,130,144,255,212,86,174,71,227,
+21,211,180,164,211,178,152,120,188,26,122,155,193,115,91,98,122,109,119,136,
+132,12,1,58,254,57,83,102,112,119,91,75,239,9,99,116,89,100,152,159,61,103,
+19,227,165,112,251,197,255,255,0,100,255,233,6,54,6,190,2,38,0,18,0,0,0,7,
+0,52,5,175,0,0,255,255,0,180,0,0,7,167,6,190,2,38,0,19,0,0,0,7,0,52,6,103,
+0,0,255,255,0,100,255,233,5,118,6,190,2,38,0,20,0,0,0,7,0,52,5,175,0,0,255,
+255,0,129,253,110,7,173,6,190,2,38,0,21,0,0,0,7,0,52,6,61,0,0,255,255,0,139,
+253,110,9,76,6,190,2,38,0,22,0,0,0,7,0,52,7,18,0,0,255,255,0,180,0,0,5,105,
+6,190,2,38,0,23,0,0,0,7,0,52,4,255,0,0,255,255,0,117,255,232,13,15,6,190,
+2,38,0,24,0,0,0,7,0,52,8,210,0,0,255,255,0,97,253,110,6,54,6,190,2,38,0,25,
+0,0,0,7,0,52,5,180,0,0,255,255,0,97,253,110,5,237,6,190,2,38,0,26,0,0,0,7,
+0,52,5,98,0,0,255,255,0,117,255,232,9,190,6,190,2,38,0,27,0,0,0,7,0,52,7,
+42,0,0,255,255,0,180,0,0,5,133,6,190,2,38,0,28,0,0,0,7,0,52,5,86,0,0,255,
+255,0,180,0,0,6,97,6,190,2,38,0,29,0,0,0,7,0,52,5,171,0,0,255,255,0,180,255,
+233,7,0,6,190,2,38,0,30,0,0,0,7,0,52,6,19,0,0,255,255,0,180,253,110,4,253,
+6,190,2,38,0,31,0,0,0,7,0,52,4,201,0,0,255,255,0,94,253,110,6,114,6,190,0,
+38,0,32,253,0,0,7,0,52,5,184,0,0,255,255,0,117,255,232,7,154,6,190,2,38,0,
+33,0,0,0,7,0,52,6,71,0,0,255,255,0,117,255,232,8,110,6,190,2,38,0,34,0,0,
+0,7,0,52,6,130,0,0,255,255,0,129,253,110,6,97,6,190,2,38,0,35,0,0,0,7,0,52,
+5,171,0,0,255,255,0,117,255,232,7,167,6,190,2,38,0,36,0,0,0,7,0,52,6,103,
+0,0,255,255,0,180,255,232,8,180,6,190,2,38,0,37,0,0,0,7,0,52,6,238,0,0,255,
+255,0,117,253,110,10,39,6,190,0,38,0,38,0,0,0,7,0,52,7,132,0,0,255,255,0,
+117,255,232,9,198,6,190,2,38,0,39,0,0,0,7,0,52,7,93,0,0,255,255,0,97,253,
+110,12,113,6,190,2,38,0,40,0,0,0,7,0,52,8,184,0,0,255,255,0,100,253,110,14,
+51,6,190,0,38,0,76,0,0,0,7,0,52,9,127,0,0,0,3,0,139,253,110,8,28,4,110,0,
+46,0,52,0,63,0,0,1,33,21,33,17,4,0,21,20,2,4,33,35,32,36,2,17,53,52,18,55,
+23,0,17,21,20,18,4,51,51,32,0,17,52,38,39,21,20,6,6,35,34,38,53,52,54,55,
+37,51,17,33,17,54,5,35,34,6,21,20,22,51,50,54,53,3,45,4,48,254,128,1,27,1,
+36,218,254,93,254,232,59,254,206,254,79,222,136,149,150,254,254,189,1,107,
+254,24,1,104,1,133,202,192,121,205,154,191,244,113,114,1,96,162,254,159,84,
+1,13,176,208,180,147,127,157,133,4,110,148,254,195,21,254,196,250,235,254,
+181,174,232,1,173,1,8,43,198,1,148,222,89,254,150,254,136,39,231,254,160,
+185,1,46,1,25,186,228,26,61,207,195,83,186,155,109,151,43,51,1,58,254,186,
+12,143,101,114,89,100,152,159,0,0,4,0,100,255,232,10,133,4,110,0,49,0,55,
+0,65,0,76,0,0,1,33,21,33,17,33,54,54,51,50,4,21,20,6,7,33,21,33,39,54,54,
+53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,55,33,21,20,6,6,35,34,38,53,
+52,54,55,1,33,17,54,51,51,5,6,21,20,22,51,50,54,53,52,37,34,6,21,20,22,51,
+50,54,53,53,1,71,4,47,254,129,1,115,70,253,154,249,1,17,47,42,1,141,253,196,
+8,46,49,192,170,183,103,192,209,162,159,146,177,16,254,194,121,205,154,191,
+244,113,114,2,2,254,159,84,107,162,2,144,26,97,89,67,74,251,147,205,183,146,
+127,158,133,4,110,148,254,198,130,144,255,212,86,174,71,148,130,63,168,88,
+164,186,133,15,187,157,162,169,208,194,85,66,67,207,195,83,185,156,109,151,
+43,1,109,254,186,12,141,83,102,112,119,91,75,239,9,99,116,89,100,152,159,
+93,0,0,2,0,180,0,0,8,95,6,190,0,57,0,69,0,0,19,33,21,33,17,54,51,50,22,21,
+20,7,33,17,38,36,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,
+22,23,53,51,17,33,53,33,54,54,53,52,38,35,34,7,21,35,17,33,17,35,1,6,21,20,
+22,51,50,54,53,52,38,35,180,3,232,254,213,121,140,153,184,96,1,142,246,254,
+239,123,237,163,169,189,145,122,121,143,28,107,113,185,176,178,251,25,1,227,
+60,55,101,89,115,116,177,254,165,177,6,68,36,67,61,58,66,105,96,4,110,148,
+254,182,86,170,139,169,116,2,139,25,251,201,130,207,113,138,118,118,134,122,
+104,69,63,31,154,108,146,172,20,189,251,146,148,60,123,72,92,98,89,210,2,
+180,252,38,6,60,57,67,63,65,65,53,66,68,0,2,0,180,253,110,7,167,4,110,0,34,
+0,35,0,0,19,33,21,33,17,54,51,50,22,21,20,7,33,17,51,17,35,17,33,53,33,54,
+54,53,52,38,35,34,7,21,35,17,33,17,35,1,180,4,34,254,155,121,140,153,184,
+96,1,142,178,178,251,203,1,227,60,55,101,89,115,116,177,254,165,177,6,105,
+4,110,148,254,182,86,170,139,169,116,3,218,249,78,2,68,148,60,123,72,92,98,
+89,210,2,180,252,38,253,110,0,1,0,170,253,110,9,172,4,110,0,69,0,0,19,33,
+21,33,17,54,51,50,22,21,20,7,33,17,51,17,54,51,50,22,21,16,0,33,35,32,36,
+53,52,54,51,50,23,7,38,35,34,6,21,20,4,33,51,32,36,53,52,35,34,7,17,35,17,
+33,53,33,54,54,53,52,38,35,34,7,21,35,17,33,17,35,180,4,34,254,155,121,140,
+153,184,96,1,142,178,88,119,138,172,253,158,253,123,104,254,33,254,44,184,
+174,160,171,32,177,114,99,91,1,159,1,155,27,2,52,2,29,169,91,85,178,251,203,
+1,227,60,55,101,89,115,116,177,254,165,177,4,110,148,254,182,86,170,139,169,
+116,3,218,252,39,57,164,142,254,227,254,239,143,170,104,123,42,148,44,38,
+47,79,81,196,208,168,63,254,208,1,48,148,60,123,72,92,98,89,210,2,180,252,
+38,0,3,0,100,255,233,6,191,4,110,0,22,0,28,0,39,0,0,33,17,33,21,20,6,6,35,
+34,38,53,52,54,55,17,33,21,33,17,33,21,33,17,1,51,17,33,17,54,5,35,34,6,21,
+20,22,51,50,54,53,5,15,254,232,121,205,154,191,244,113,114,4,47,254,129,2,
+200,254,251,252,237,162,254,159,84,1,13,176,205,183,146,127,158,133,2,17,
+67,207,195,83,186,155,109,151,43,2,1,148,254,198,143,253,239,2,160,1,58,254,
+186,12,143,99,116,89,100,152,159,0,0,3,0,139,253,110,9,109,4,110,0,57,0,63,
+0,74,0,0,33,17,33,21,20,6,6,35,34,38,53,52,54,55,17,33,21,33,17,33,21,33,
+21,54,51,50,22,21,20,0,4,33,35,32,36,0,17,53,52,18,55,23,0,17,21,16,0,33,
+51,32,0,53,52,38,35,34,7,21,1,51,17,33,17,54,5,35,34,6,21,20,22,51,50,54,
+53,6,245,254,232,121,205,154,191,244,113,114,4,48,254,128,2,200,254,251,75,
+91,128,167,254,246,254,11,254,191,59,254,157,254,7,254,245,130,153,152,254,
+254,1,240,1,220,29,1,176,1,227,93,79,53,55,252,237,162,254,159,84,1,13,176,
+208,180,147,127,157,133,2,17,67,207,195,83,186,155,109,151,43,2,1,148,254,
+198,143,207,36,189,159,207,254,212,161,229,1,178,1,16,50,195,1,129,227,89,
+254,156,254,150,39,254,142,254,94,1,12,242,97,115,30,192,2,160,1,58,254,186,
+12,143,101,114,89,100,152,159,0,3,0,78,253,110,9,27,4,110,0,57,0,68,0,80,
+0,0,1,17,33,6,4,33,35,32,36,53,52,54,54,51,33,54,53,52,38,35,34,7,17,35,17,
+35,34,6,6,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,33,33,21,33,17,54,51,
+50,22,21,20,7,33,17,1,22,22,51,50,54,53,52,38,35,34,1,50,36,55,33,34,6,6,
+21,20,22,51,9,27,253,115,151,254,2,254,196,46,254,251,254,196,63,101,95,4,
+214,104,116,107,93,104,178,181,198,232,157,22,114,129,152,179,186,161,181,
+220,168,1,66,1,47,2,184,254,165,102,126,170,204,87,1,124,248,174,6,125,111,
+79,96,105,87,114,1,51,251,1,115,133,251,147,27,28,18,222,201,4,110,250,82,
+166,172,167,148,62,81,28,146,216,156,159,73,254,80,3,218,73,188,128,75,180,
+155,167,194,1,10,247,198,1,30,161,148,254,108,71,251,220,195,159,5,26,253,
+68,154,165,106,97,98,112,251,243,94,95,7,23,19,62,78,0,3,0,78,253,110,12,
+150,4,110,0,63,0,74,0,86,0,0,1,35,17,33,17,33,6,4,33,35,32,36,53,52,54,54,
+51,33,54,53,52,38,35,34,7,17,35,17,35,34,6,6,7,54,51,50,22,21,20,6,35,34,
+2,53,52,18,36,33,33,21,33,17,54,51,50,22,21,20,7,33,17,33,21,33,1,22,22,51,
+50,54,53,52,38,35,34,1,50,36,55,33,34,6,6,21,20,22,51,11,49,178,254,156,253,
+115,151,254,2,254,196,46,254,251,254,196,63,101,95,4,214,104,116,107,93,104,
+178,181,198,232,157,22,114,129,152,179,186,161,181,220,168,1,66,1,47,2,184,
+254,165,102,126,170,204,87,1,124,4,44,254,155,245,231,6,125,111,79,96,105,
+87,114,1,51,251,1,115,133,251,147,27,28,18,222,201,254,192,5,26,250,230,166,
+172,167,148,62,81,28,146,216,156,159,73,254,80,3,218,73,188,128,75,180,155,
+167,194,1,10,247,198,1,30,161,148,254,108,71,251,220,195,159,5,26,148,253,
+216,154,165,106,97,98,112,251,243,94,95,7,23,19,62,78,0,3,0,180,253,110,6,
+62,4,110,0,22,0,35,0,36,0,0,33,33,3,39,19,33,17,51,17,33,38,38,53,52,54,51,
+50,22,21,20,7,7,33,33,51,55,54,54,53,52,38,35,34,6,21,20,19,6,61,254,97,163,
+162,151,252,196,177,1,225,94,83,185,155,151,164,63,30,1,119,253,216,4,13,
+24,51,71,67,79,90,80,253,187,45,2,24,4,110,252,38,122,222,123,153,197,179,
+151,153,228,106,44,80,246,110,91,98,122,109,228,252,8,0,2,0,180,0,0,6,62,
+4,110,0,29,0,43,0,0,33,33,17,51,17,33,38,53,52,54,54,51,50,22,21,20,6,35,
+34,38,53,52,55,6,6,21,20,22,23,33,1,35,34,7,6,21,20,22,51,50,54,53,52,38,
+6,61,250,119,177,1,114,117,126,235,156,165,182,147,121,121,142,23,89,97,74,
+72,2,160,254,53,12,6,6,37,68,60,58,66,99,4,110,252,38,159,186,131,219,122,
+138,119,118,138,123,108,62,58,36,159,113,99,178,70,2,175,1,53,71,62,65,65,
+53,65,69,0,0,2,0,146,253,110,7,111,6,190,0,47,0,48,0,0,19,16,18,0,33,32,4,
+18,17,17,35,17,16,2,38,38,35,34,0,2,17,16,0,33,32,17,52,38,35,34,7,17,35,
+17,51,17,54,51,50,18,17,16,0,33,34,36,2,17,1,146,247,1,192,1,21,1,7,1,87,
+179,177,64,157,232,167,219,254,148,200,1,17,1,10,1,209,105,120,94,103,178,
+178,100,128,180,194,254,189,254,197,224,254,186,173,2,253,1,239,1,121,2,45,
+1,41,221,254,81,254,140,253,66,2,80,1,27,1,86,243,112,254,254,254,15,254,
+165,254,55,254,44,2,51,202,195,73,254,80,4,110,253,216,71,254,242,254,255,
+254,145,254,144,246,1,216,1,73,251,184,0,0,3,0,146,253,110,7,32,6,190,0,54,
+0,65,0,66,0,0,1,17,35,17,51,17,54,51,50,18,17,16,0,33,34,36,2,17,53,16,18,
+0,33,50,4,22,21,20,6,35,34,38,53,52,54,51,50,23,38,38,35,34,0,2,17,16,0,33,
+50,18,17,52,38,35,34,1,38,35,34,6,21,20,22,51,50,54,1,3,137,178,178,100,128,
+180,194,254,189,254,197,224,254,186,173,244,1,205,1,45,211,1,48,157,188,145,
+147,175,171,139,78,76,55,245,182,244,254,130,202,1,17,1,10,232,233,105,120,
+94,2,142,75,87,76,87,84,74,77,88,253,19,1,176,254,80,4,110,253,216,71,254,
+242,254,255,254,145,254,144,246,1,216,1,73,58,1,124,2,43,1,39,137,253,161,
+193,204,166,130,132,165,42,119,124,254,251,254,16,254,167,254,55,254,44,1,
+26,1,25,202,195,2,147,68,83,76,72,84,130,249,87,0,0,5,0,78,253,110,14,6,4,
+138,0,88,0,100,0,112,0,123,0,135,0,0,5,33,17,51,17,33,6,4,4,33,33,32,36,53,
+52,54,54,51,33,54,18,53,16,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,
+35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,38,35,34,4,7,54,51,50,22,21,
+20,6,35,34,2,53,52,18,36,51,32,23,54,51,50,23,54,51,32,0,17,20,2,1,6,6,21,
+20,22,51,50,54,53,52,38,37,6,6,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,
+53,52,38,35,34,1,32,36,55,33,34,6,6,21,20,4,33,11,90,1,250,178,252,222,175,
+254,135,253,236,254,112,254,145,254,61,254,104,74,120,120,8,249,112,112,200,
+178,127,108,119,119,173,159,163,176,104,100,121,173,189,137,118,120,173,159,
+163,176,97,98,85,207,106,211,254,232,36,118,128,152,179,186,161,181,220,178,
+1,70,214,1,19,221,194,248,213,196,154,196,1,18,1,32,94,252,211,74,73,83,77,
+80,84,89,252,81,67,74,83,77,80,84,95,251,140,9,126,107,79,96,105,87,113,3,
+54,2,12,2,68,204,247,102,28,27,18,1,179,1,166,172,5,26,250,82,138,138,62,
+145,171,61,80,29,121,1,58,193,1,15,1,27,67,116,254,234,161,198,214,213,192,
+155,1,28,113,77,81,109,254,238,158,198,214,213,192,160,1,10,107,48,48,220,
+195,77,180,155,167,194,1,17,253,197,1,45,162,140,140,127,127,254,153,254,
+171,186,254,195,3,118,91,229,137,136,137,137,120,134,236,88,78,231,133,136,
+137,137,120,136,239,254,199,157,162,106,97,98,112,251,243,85,104,7,23,20,
+79,60,0,0,5,0,78,253,110,17,129,4,138,0,94,0,106,0,118,0,129,0,141,0,0,5,
+33,17,33,21,33,17,35,17,33,17,33,6,4,4,33,33,32,36,53,52,54,54,51,33,54,18,
+53,16,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,7,22,18,21,20,
+6,35,34,38,53,52,18,55,38,38,35,34,4,7,54,51,50,22,21,20,6,35,34,2,53,52,
+18,36,51,32,23,54,51,50,23,54,51,32,0,17,20,2,1,6,6,21,20,22,51,50,54,53,
+52,38,37,6,6,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,53,52,38,35,34,1,
+32,36,55,33,34,6,6,21,20,4,33,11,90,1,250,4,45,254,154,177,254,156,252,222,
+175,254,135,253,236,254,112,254,145,254,61,254,104,74,120,120,8,249,112,112,
+200,178,127,108,119,119,173,159,163,176,104,100,121,173,189,137,118,120,173,
+159,163,176,97,98,85,207,106,211,254,232,36,118,128,152,179,186,161,181,220,
+178,1,70,214,1,19,221,194,248,213,196,154,196,1,18,1,32,94,252,211,74,73,
+83,77,80,84,89,252,81,67,74,83,77,80,84,95,251,140,9,126,107,79,96,105,87,
+113,3,54,2,12,2,68,204,247,102,28,27,18,1,179,1,166,172,5,26,148,250,230,
+5,26,250,230,138,138,62,145,171,61,80,29,121,1,58,193,1,15,1,27,67,116,254,
+234,161,198,214,213,192,155,1,28,113,77,81,109,254,238,158,198,214,213,192,
+160,1,10,107,48,48,220,195,77,180,155,167,194,1,17,253,197,1,45,162,140,140,
+127,127,254,153,254,171,186,254,195,3,118,91,229,137,136,137,137,120,134,
+236,88,78,231,133,136,137,137,120,136,239,254,199,157,162,106,97,98,112,251,
+243,85,104,7,23,20,79,60,0,4,0,78,253,110,8,6,4,110,0,42,0,48,0,59,0,70,0,
+0,1,17,33,6,4,33,35,34,36,53,52,54,54,51,33,54,53,52,38,39,21,20,6,6,35,34,
+38,53,52,54,55,17,33,21,33,17,4,0,17,20,7,33,17,5,33,17,54,51,51,21,35,34,
+6,21,20,22,51,50,54,53,1,33,34,6,21,20,22,51,51,50,36,8,6,253,171,121,254,
+86,254,230,29,238,254,229,61,96,101,3,243,61,201,192,121,205,154,191,244,
+113,114,4,47,254,129,1,21,1,42,60,1,91,251,244,254,159,94,97,162,176,205,
+183,146,127,158,133,1,152,252,95,41,32,183,169,22,215,1,52,4,110,250,82,166,
+172,166,149,64,77,30,122,163,191,212,11,65,207,195,83,185,156,110,151,42,
+2,1,148,254,197,5,254,221,254,255,158,132,5,26,148,254,186,12,143,99,116,
+89,100,152,159,253,12,22,27,63,77,92,0,0,4,0,78,253,110,11,129,4,110,0,48,
+0,54,0,65,0,76,0,0,1,35,17,33,17,33,6,4,33,35,34,36,53,52,54,54,51,33,54,
+53,52,38,39,21,20,6,6,35,34,38,53,52,54,55,17,33,21,33,17,4,0,17,20,7,33,
+17,33,21,41,2,17,54,51,51,21,35,34,6,21,20,22,51,50,54,53,1,33,34,6,21,20,
+22,51,51,50,36,10,28,178,254,156,253,171,121,254,86,254,230,29,238,254,229,
+61,96,101,3,243,61,201,192,121,205,154,191,244,113,114,4,47,254,129,1,21,
+1,42,60,1,91,4,44,254,155,249,45,254,159,94,97,162,176,205,183,146,127,158,
+133,1,152,252,95,41,32,183,169,22,215,1,52,254,192,5,26,250,230,166,172,166,
+149,64,77,30,122,163,191,212,11,65,207,195,83,185,156,110,151,42,2,1,148,
+254,197,5,254,221,254,255,158,132,5,26,148,254,186,12,143,99,116,89,100,152,
+159,253,12,22,27,63,77,92,0,0,3,0,80,253,110,7,195,4,110,0,42,0,54,0,55,0,
+0,1,17,33,6,4,33,35,34,36,53,52,54,54,51,33,54,53,52,38,35,34,7,17,35,17,
+33,17,35,17,33,21,33,17,54,54,51,50,18,21,20,7,33,17,1,33,34,6,6,21,20,22,
+51,51,50,36,1,7,195,253,137,117,254,117,254,250,37,207,254,254,61,96,102,
+3,134,94,115,105,114,110,178,254,156,177,4,44,254,155,75,116,64,165,206,85,
+1,121,253,115,252,190,27,28,18,170,152,20,190,1,18,253,248,4,110,250,82,166,
+172,168,147,62,78,31,177,251,168,169,88,254,7,3,218,252,38,4,110,148,254,
+190,47,31,254,255,223,242,192,5,26,250,82,7,23,19,63,77,92,1,138,0,3,0,80,
+253,110,11,62,4,110,0,48,0,60,0,61,0,0,1,35,17,33,17,33,6,4,33,35,34,36,53,
+52,54,54,51,33,54,53,52,38,35,34,7,17,35,17,33,17,35,17,33,21,33,17,54,54,
+51,50,18,21,20,7,33,17,33,21,33,1,33,34,6,6,21,20,22,51,51,50,36,1,9,217,
+178,254,156,253,137,117,254,117,254,250,37,207,254,254,61,96,102,3,134,94,
+115,105,114,110,178,254,156,177,4,44,254,155,75,116,64,165,206,85,1,121,4,
+45,254,155,250,171,252,190,27,28,18,170,152,20,190,1,18,253,248,254,192,5,
+26,250,230,166,172,168,147,62,78,31,177,251,168,169,88,254,7,3,218,252,38,
+4,110,148,254,190,47,31,254,255,223,242,192,5,26,148,250,230,7,23,19,63,77,
+92,1,138,0,4,0,78,253,110,10,181,4,138,0,65,0,77,0,88,0,99,0,0,1,33,6,4,33,
+35,32,36,53,52,54,54,51,33,54,17,16,2,35,34,7,22,18,21,20,6,35,34,38,53,52,
+18,55,38,38,35,34,4,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,23,54,
+51,32,0,17,16,3,33,17,51,1,6,6,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,
+53,52,38,35,34,1,32,37,33,34,6,6,21,20,4,33,10,181,252,222,182,253,197,254,
+152,57,254,177,254,156,68,111,115,5,188,224,200,178,136,103,121,121,173,159,
+163,176,98,99,85,207,108,211,254,232,36,118,128,152,179,186,161,181,220,178,
+1,70,214,1,21,213,158,198,1,19,1,33,188,1,250,178,250,128,68,74,83,77,80,
+84,92,251,137,9,126,107,79,96,105,87,113,1,196,2,11,1,50,250,191,30,31,20,
+1,11,1,6,254,192,166,172,163,152,62,79,30,242,1,130,1,15,1,27,70,115,254,
+236,161,198,214,213,192,156,1,15,114,44,44,220,195,77,180,155,167,194,1,17,
+253,197,1,45,162,131,131,254,154,254,170,254,140,254,250,5,26,254,222,86,
+242,128,136,137,137,120,148,240,254,186,157,162,106,97,98,112,251,243,189,
+7,23,19,65,75,0,4,0,78,253,110,14,48,4,138,0,71,0,83,0,94,0,105,0,0,1,33,
+6,4,33,35,32,36,53,52,54,54,51,33,54,17,16,2,35,34,7,22,18,21,20,6,35,34,
+38,53,52,18,55,38,38,35,34,4,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,
+32,23,54,51,32,0,17,16,3,33,17,33,21,33,17,35,17,33,5,6,6,21,20,22,51,50,
+54,53,52,38,1,22,22,51,50,54,53,52,38,35,34,1,32,37,33,34,6,6,21,20,4,33,
+10,181,252,222,182,253,197,254,152,57,254,177,254,156,68,111,115,5,188,224,
+200,178,136,103,121,121,173,159,163,176,98,99,85,207,108,211,254,232,36,118,
+128,152,179,186,161,181,220,178,1,70,214,1,21,213,158,198,1,19,1,33,188,1,
+250,4,45,254,154,177,254,156,250,128,68,74,83,77,80,84,92,251,137,9,126,107,
+79,96,105,87,113,1,196,2,11,1,50,250,191,30,31,20,1,11,1,6,254,192,166,172,
+163,152,62,79,30,242,1,130,1,15,1,27,70,115,254,236,161,198,214,213,192,156,
+1,15,114,44,44,220,195,77,180,155,167,194,1,17,253,197,1,45,162,131,131,254,
+154,254,170,254,140,254,250,5,26,148,250,230,5,26,142,86,242,128,136,137,
+137,120,148,240,254,186,157,162,106,97,98,112,251,243,189,7,23,19,65,75,0,
+2,0,180,0,0,6,62,6,190,0,32,0,44,0,0,1,6,6,21,20,22,23,53,51,17,33,17,51,
+17,33,17,38,36,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,
+51,50,54,53,52,38,35,4,71,108,113,185,177,177,251,47,177,3,111,247,254,239,
+123,237,163,170,189,145,123,120,143,172,37,67,61,58,66,105,96,6,40,30,155,
+108,145,173,20,189,251,146,4,110,252,38,2,139,26,251,200,130,207,113,138,
+118,118,134,121,105,69,83,59,65,62,66,65,53,66,68,0,2,0,180,253,110,5,133,
+4,110,0,9,0,10,0,0,1,17,33,17,51,17,33,17,51,17,7,4,212,251,224,177,3,111,
+177,102,253,188,2,68,4,110,252,38,3,218,249,78,78,0,0,1,0,178,253,110,7,138,
+4,110,0,46,0,0,1,35,17,33,17,51,17,33,17,51,17,54,51,50,22,21,20,6,4,33,35,
+32,36,53,52,54,51,50,23,7,38,35,34,6,21,20,4,33,51,32,36,53,52,38,35,34,7,
+5,133,178,251,225,177,3,110,178,90,117,136,174,231,254,77,254,225,80,254,
+152,254,153,178,171,126,161,32,154,105,87,83,1,39,1,40,19,1,121,1,163,86,
+79,97,84,254,208,1,48,4,110,252,38,3,218,252,39,57,167,148,172,248,129,157,
+156,102,125,42,148,44,38,47,80,80,209,187,84,92,63,0,3,0,139,253,110,8,145,
+4,138,0,39,0,52,0,53,0,0,33,2,0,33,32,0,17,53,52,18,55,23,6,2,21,21,16,0,
+33,50,36,55,33,17,51,17,33,17,52,54,54,51,50,18,17,20,14,2,35,39,51,50,54,
+54,53,52,38,35,34,6,6,21,1,6,15,24,254,149,254,213,254,162,254,136,145,138,
+152,125,133,1,24,1,12,232,1,1,24,253,131,178,1,205,80,164,124,215,231,54,
+127,202,172,81,95,133,155,73,140,129,69,88,30,253,122,254,234,254,211,1,168,
+1,147,55,205,1,170,200,89,166,254,129,197,34,254,170,254,168,211,210,4,110,
+252,38,2,67,165,179,91,254,185,254,214,131,201,140,65,148,70,166,162,220,
+248,77,121,131,250,193,0,4,0,139,253,110,9,95,4,138,0,43,0,54,0,67,0,68,0,
+0,33,2,0,33,32,0,17,16,18,51,50,22,21,20,6,35,34,39,6,21,16,0,33,32,36,55,
+33,17,51,17,33,17,52,54,54,51,50,18,17,20,14,2,35,1,22,51,50,54,53,52,38,
+35,34,6,1,51,50,54,54,53,52,38,35,34,6,6,21,1,6,222,16,254,152,254,188,254,
+73,254,32,207,191,142,167,173,140,117,99,7,1,136,1,89,1,1,1,3,21,253,130,
+177,1,206,80,164,124,215,231,57,129,201,169,250,35,79,87,82,88,74,65,71,98,
+5,112,96,133,155,73,140,129,71,91,26,252,173,254,229,254,216,2,37,1,249,1,
+59,1,113,163,133,139,164,69,71,93,254,92,254,46,202,219,4,110,252,38,2,67,
+165,179,91,254,185,254,214,136,204,136,61,3,13,76,85,79,71,80,120,253,16,
+70,166,162,220,248,84,128,117,250,193,0,2,0,180,255,233,7,184,6,190,0,48,
+0,60,0,0,1,17,20,22,22,51,50,55,17,51,17,33,17,38,36,53,52,54,54,51,50,22,
+21,20,6,35,34,38,53,52,55,6,6,21,20,22,23,53,51,17,33,53,6,35,34,38,38,53,
+17,1,6,21,20,22,51,50,54,53,52,38,35,1,101,23,79,70,114,81,178,2,200,246,
+254,239,123,237,163,169,189,145,122,121,143,28,107,113,185,176,178,251,212,
+99,134,107,139,65,5,158,37,67,61,58,66,105,96,4,110,253,95,137,124,75,113,
+3,128,252,38,2,139,25,251,201,130,207,113,138,118,118,134,122,104,69,63,31,
+154,108,146,172,20,189,251,146,71,94,105,181,157,2,202,1,206,59,65,62,66,
+65,53,66,68,0,0,2,0,180,253,110,7,0,4,110,0,25,0,26,0,0,1,35,17,33,53,6,35,
+34,38,38,53,17,51,17,20,22,22,51,50,55,17,51,17,33,17,51,3,7,0,178,252,134,
+99,134,107,139,65,177,23,79,70,114,81,178,2,200,178,181,253,188,2,68,71,94,
+105,181,157,2,202,253,95,137,124,75,113,3,128,252,38,3,218,249,0,0,0,1,0,
+178,253,110,9,5,4,110,0,61,0,0,37,54,51,50,22,21,16,0,33,35,32,36,53,52,54,
+51,50,23,7,38,35,34,6,21,20,4,33,51,32,36,53,52,38,35,34,7,17,35,17,33,53,
+6,35,34,38,38,53,17,51,17,20,22,22,51,50,55,17,51,17,33,17,51,7,0,90,117,
+137,173,253,183,253,209,109,254,69,254,77,184,174,160,171,33,176,114,98,93,
+1,117,1,113,42,1,239,1,249,87,76,98,84,178,252,134,99,134,107,139,65,177,
+23,79,70,114,81,178,2,200,178,149,57,162,144,254,240,254,226,154,159,105,
+122,42,148,44,38,47,76,84,207,205,76,84,63,254,208,1,48,71,94,105,181,157,
+2,202,253,95,137,124,75,113,3,128,252,38,3,218,0,1,0,139,253,110,8,5,4,110,
+0,45,0,0,1,54,51,50,18,21,20,2,4,33,35,32,36,2,17,53,16,1,23,6,2,21,21,20,
+18,4,51,51,32,0,17,52,38,35,34,7,17,35,17,33,17,35,17,33,21,33,5,171,102,
+127,170,203,225,254,90,254,241,41,254,207,254,84,222,1,27,152,131,127,186,
+1,99,250,22,1,99,1,133,117,108,93,104,177,254,156,178,4,44,254,155,2,70,71,
+254,244,233,254,254,147,191,231,1,173,1,14,49,1,130,1,171,89,182,254,155,
+187,42,237,254,157,185,1,91,1,70,161,171,73,254,80,3,218,252,38,4,110,148,
+0,0,2,0,139,253,110,8,211,4,135,0,50,0,61,0,0,1,17,35,17,33,17,35,17,33,21,
+33,17,54,51,50,18,21,16,2,4,33,35,32,0,2,17,16,18,51,50,22,21,20,6,35,34,
+39,6,21,16,18,4,33,51,32,0,17,52,38,35,34,1,22,51,50,54,53,52,38,35,34,6,
+6,121,178,254,156,177,4,44,254,155,102,126,170,204,234,254,60,254,205,53,
+254,167,254,31,248,207,191,142,167,173,140,117,99,7,216,1,158,1,31,31,1,146,
+1,162,114,110,93,250,117,79,87,82,88,74,65,71,98,1,176,254,80,3,218,252,38,
+4,110,148,254,108,71,254,244,233,254,252,254,149,187,1,14,2,2,1,93,1,59,1,
+113,163,133,139,164,69,71,93,254,210,254,76,227,1,76,1,69,170,178,1,20,76,
+85,79,71,80,120,0,0,3,0,80,253,110,8,101,4,138,0,54,0,66,0,67,0,0,1,33,6,
+4,35,35,34,36,53,52,54,54,51,33,54,18,53,52,2,35,34,6,6,21,17,35,17,52,38,
+35,34,6,6,21,17,35,17,52,54,54,51,50,23,54,54,51,50,18,17,20,2,7,33,17,51,
+1,33,34,6,6,21,20,22,51,51,50,36,1,8,101,253,38,135,254,111,255,40,226,254,
+230,61,96,102,3,195,82,86,159,154,86,115,54,178,83,86,85,84,29,177,79,156,
+111,211,84,46,181,123,230,252,73,72,1,208,177,252,74,252,147,27,28,18,190,
+171,23,183,1,19,253,212,254,192,168,170,169,146,62,78,31,127,1,93,201,250,
+1,2,77,142,140,253,114,2,176,173,152,86,171,130,253,142,2,191,169,190,100,
+196,93,103,254,168,254,194,204,254,177,133,5,26,250,82,7,23,19,63,77,93,1,
+137,0,0,3,0,80,253,110,11,224,4,138,0,60,0,72,0,73,0,0,1,33,6,4,35,35,34,
+36,53,52,54,54,51,33,54,18,53,52,2,35,34,6,6,21,17,35,17,52,38,35,34,6,6,
+21,17,35,17,52,54,54,51,50,23,54,54,51,50,18,17,20,2,7,33,17,33,21,33,17,
+35,17,33,1,33,34,6,6,21,20,22,51,51,50,36,1,8,101,253,38,135,254,111,255,
+40,226,254,230,61,96,102,3,195,82,86,159,154,86,115,54,178,83,86,85,84,29,
+177,79,156,111,211,84,46,181,123,230,252,73,72,1,208,4,44,254,155,177,254,
+155,252,74,252,147,27,28,18,190,171,23,183,1,19,253,212,254,192,168,170,169,
+146,62,78,31,127,1,93,201,250,1,2,77,142,140,253,114,2,176,173,152,86,171,
+130,253,142,2,191,169,190,100,196,93,103,254,168,254,194,204,254,177,133,
+5,26,148,250,230,5,26,250,230,7,23,19,63,77,93,1,137,0,3,0,117,255,232,9,
+119,6,190,0,68,0,79,0,80,0,0,33,35,17,16,2,38,35,34,6,21,20,22,23,38,39,55,
+18,17,16,2,35,34,2,53,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,52,
+18,36,51,50,22,22,21,20,22,22,51,50,17,52,39,38,0,53,52,54,36,51,50,4,18,
+21,1,22,22,51,50,54,53,52,38,35,34,3,9,119,177,101,235,174,176,194,140,132,
+38,51,170,227,220,216,217,207,78,157,124,174,237,30,116,132,152,179,186,161,
+181,220,157,1,28,177,194,236,99,58,111,90,245,56,248,254,237,140,1,0,157,
+226,1,64,135,247,161,9,126,107,79,96,105,87,115,110,3,156,1,1,1,3,132,150,
+136,129,169,34,61,63,86,254,199,254,161,254,252,254,248,1,13,250,197,217,
+101,220,196,78,180,155,167,194,1,17,253,201,1,43,160,153,245,230,163,163,
+80,1,101,165,150,28,1,3,205,135,196,103,174,254,215,255,253,202,157,162,106,
+97,98,112,2,94,0,0,4,0,117,255,232,8,33,6,190,0,68,0,80,0,91,0,92,0,0,1,6,
+6,21,20,22,23,38,39,55,18,17,16,2,35,34,2,53,52,38,38,35,34,6,7,54,51,50,
+22,21,20,6,35,34,2,53,52,18,36,51,50,22,22,21,20,22,22,51,50,17,52,39,38,
+36,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,54,53,
+52,38,35,1,22,22,51,50,54,53,52,38,35,34,3,6,43,108,113,144,139,42,50,170,
+227,220,216,217,207,78,157,124,174,237,30,116,132,152,179,186,161,181,220,
+157,1,28,177,194,236,99,58,111,90,245,55,244,254,243,123,237,163,169,189,
+145,122,120,143,172,37,67,61,58,66,105,96,250,79,9,126,107,79,96,105,87,115,
+110,6,40,30,155,108,128,170,36,69,60,86,254,199,254,161,254,252,254,248,1,
+13,250,197,217,101,220,196,78,180,155,167,194,1,17,253,201,1,43,160,153,245,
+230,163,163,80,1,101,161,153,27,250,200,130,207,113,137,119,118,134,121,105,
+69,83,59,65,62,66,65,53,66,68,251,118,157,162,106,97,98,112,2,94,0,0,3,0,
+78,253,110,9,96,4,204,0,66,0,77,0,88,0,0,1,17,33,6,4,33,35,34,36,53,52,54,
+54,51,33,54,55,38,2,53,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,
+52,18,36,51,50,22,22,21,20,22,22,51,50,54,53,52,2,39,55,22,18,21,20,2,7,6,
+7,33,17,1,22,22,51,50,54,53,52,38,35,34,1,33,34,6,6,21,20,22,51,51,32,9,96,
+252,75,124,254,91,254,229,41,224,254,232,63,101,95,3,232,45,21,162,155,78,
+157,124,174,236,30,118,129,152,179,186,161,181,220,154,1,27,181,194,236,99,
+58,111,90,122,123,129,128,160,141,134,179,178,19,32,2,172,248,106,9,126,107,
+79,96,105,87,113,3,80,252,104,27,28,18,186,167,26,1,150,4,110,250,82,166,
+172,169,146,62,81,28,78,79,31,1,9,214,197,217,101,222,193,77,180,155,167,
+194,1,17,253,204,1,41,159,154,244,230,163,163,80,178,179,179,1,62,138,108,
+178,254,153,191,235,254,252,24,81,72,5,26,253,68,157,162,106,97,98,112,252,
+176,7,23,19,63,77,0,3,0,78,253,110,12,219,4,204,0,72,0,83,0,94,0,0,1,35,17,
+33,17,33,6,4,33,35,34,36,53,52,54,54,51,33,54,55,38,2,53,52,38,38,35,34,6,
+7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,50,22,22,21,20,22,22,51,50,54,
+53,52,2,39,55,22,18,21,20,2,7,6,7,33,17,33,21,33,1,22,22,51,50,54,53,52,38,
+35,34,1,33,34,6,6,21,20,22,51,51,32,11,118,178,254,156,252,75,124,254,91,
+254,229,41,224,254,232,63,101,95,3,232,45,21,162,155,78,157,124,174,236,30,
+118,129,152,179,186,161,181,220,154,1,27,181,194,236,99,58,111,90,122,123,
+129,128,160,141,134,179,178,19,32,2,172,4,45,254,155,245,162,9,126,107,79,
+96,105,87,113,3,80,252,104,27,28,18,186,167,26,1,150,254,192,5,26,250,230,
+166,172,169,146,62,81,28,78,79,31,1,9,214,197,217,101,222,193,77,180,155,
+167,194,1,17,253,204,1,41,159,154,244,230,163,163,80,178,179,179,1,62,138,
+108,178,254,153,191,235,254,252,24,81,72,5,26,148,253,216,157,162,106,97,
+98,112,252,176,7,23,19,63,77,0,2,0,139,253,110,11,123,4,138,0,68,0,79,0,0,
+1,54,51,50,18,21,16,0,33,35,32,36,0,17,53,52,18,55,23,2,17,21,16,0,33,51,
+32,0,17,52,38,35,34,7,17,35,17,33,17,35,17,38,38,35,34,6,7,54,51,50,22,21,
+20,6,35,34,2,53,52,18,36,51,50,22,23,53,33,21,33,1,22,22,51,50,54,53,52,38,
+35,34,9,32,102,127,172,202,253,87,253,135,94,254,60,253,145,254,195,142,126,
+152,243,2,113,2,103,38,2,53,2,87,115,109,94,104,177,254,156,178,75,179,117,
+172,238,31,118,129,152,179,186,161,181,220,158,1,34,181,112,180,86,4,10,254,
+164,250,6,9,124,109,79,96,105,87,115,2,70,71,254,253,225,254,112,254,85,229,
+1,184,1,39,43,182,1,157,190,89,254,146,254,166,21,254,116,254,96,1,90,1,71,
+162,170,73,254,80,3,218,252,38,3,69,90,83,224,191,77,180,155,167,194,1,18,
+252,201,1,43,160,61,71,104,148,253,216,157,162,106,97,98,112,0,3,0,139,253,
+110,12,111,4,138,0,73,0,84,0,95,0,0,1,17,35,17,33,17,35,17,38,38,35,34,6,
+7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,50,22,23,53,33,21,33,17,54,51,
+50,18,21,16,0,33,35,32,0,17,52,18,54,51,50,22,21,20,6,35,34,39,6,21,16,0,
+33,51,32,0,17,52,38,35,34,1,22,51,50,54,53,52,38,35,34,6,1,22,22,51,50,54,
+53,52,38,35,34,10,21,177,254,155,177,75,179,117,172,238,31,118,129,152,179,
+186,161,181,220,156,1,34,182,112,181,86,4,10,254,164,102,126,169,205,253,
+74,253,96,132,252,252,252,250,95,180,123,142,167,173,140,115,102,6,2,192,
+2,186,70,2,107,2,89,116,108,93,246,216,78,89,82,88,74,65,69,99,2,168,8,125,
+109,79,96,105,88,113,1,176,254,80,3,218,252,38,3,69,90,83,224,191,77,180,
+155,167,194,1,17,253,199,1,43,162,61,71,104,148,254,108,71,254,250,224,254,
+107,254,92,2,69,2,80,180,1,45,163,163,133,139,164,70,51,74,253,252,254,23,
+1,73,1,87,161,172,1,20,76,85,79,71,80,120,254,46,156,163,107,96,97,113,0,
+0,2,0,139,253,110,8,145,4,138,0,54,0,67,0,0,1,17,33,17,51,17,33,17,52,54,
+54,51,50,18,17,20,14,2,35,35,21,54,51,50,22,21,20,4,33,35,32,36,2,17,53,52,
+18,55,23,0,17,21,16,0,33,51,50,36,53,52,35,34,7,21,19,51,50,54,54,53,52,38,
+35,34,6,6,21,5,99,253,129,178,1,205,80,164,124,215,231,54,127,202,172,84,
+88,97,115,136,254,183,254,207,129,254,162,254,24,250,136,147,152,254,254,
+1,221,1,212,77,215,1,9,118,68,78,3,95,133,155,73,140,129,69,88,30,254,171,
+1,85,4,110,252,38,2,67,165,179,91,254,185,254,214,131,201,140,65,129,35,116,
+96,171,181,219,1,163,1,31,43,198,1,148,222,89,254,150,254,136,39,254,142,
+254,114,91,82,90,36,68,1,233,70,166,162,220,248,77,121,131,0,3,0,139,253,
+110,9,95,4,138,0,60,0,71,0,84,0,0,1,17,33,17,51,17,33,17,52,54,54,51,50,18,
+17,20,14,2,35,35,21,54,51,50,22,21,20,4,33,35,32,0,0,17,16,18,51,50,22,21,
+20,6,35,34,39,6,21,16,0,4,33,51,50,36,53,52,35,34,7,21,1,22,51,50,54,53,52,
+38,35,34,6,1,51,50,54,54,53,52,38,35,34,6,6,21,6,49,253,129,177,1,206,80,
+164,124,215,231,57,129,201,169,84,90,96,114,137,254,176,254,200,146,254,118,
+253,199,254,212,206,192,142,167,173,140,116,99,8,1,9,2,5,1,110,78,219,1,13,
+118,65,82,250,119,78,88,82,88,74,65,70,99,5,112,96,133,155,73,140,129,71,
+91,26,254,171,1,85,4,110,252,38,2,67,165,179,91,254,185,254,214,136,204,136,
+61,130,36,115,97,171,181,1,12,1,254,1,82,1,71,1,118,163,133,139,164,69,70,
+109,254,222,254,84,232,91,82,90,36,68,4,97,75,85,79,71,80,120,253,16,70,166,
+162,220,248,84,128,117,0,0,3,0,117,255,232,8,95,6,190,0,59,0,71,0,82,0,0,
+37,33,17,38,36,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,
+23,53,51,17,33,39,54,17,52,38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,52,
+18,36,51,32,0,17,20,6,1,6,21,20,22,51,50,54,53,52,38,35,1,22,22,51,50,54,
+53,52,38,35,34,4,212,2,32,246,254,240,123,237,163,169,189,145,122,121,143,
+28,107,113,184,176,179,252,119,7,107,223,193,181,240,30,118,129,152,179,186,
+161,181,220,154,1,34,185,1,27,1,51,47,1,240,37,67,61,58,66,105,97,250,18,
+9,126,107,79,96,105,87,113,148,2,139,25,252,200,130,207,113,138,118,118,134,
+122,104,69,63,31,152,110,145,173,20,189,251,146,130,161,1,3,214,246,220,195,
+77,180,155,167,194,1,17,253,200,1,41,163,254,195,254,240,112,202,5,57,53,
+71,63,65,65,53,65,69,251,118,157,162,106,97,98,112,0,3,0,117,253,110,7,167,
+4,138,0,36,0,47,0,48,0,0,37,33,17,51,17,35,17,33,39,54,17,52,38,35,34,6,7,
+54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,0,17,20,6,37,22,22,51,50,54,
+53,52,38,35,34,1,4,212,2,32,179,179,253,42,7,107,223,193,180,242,30,116,132,
+152,179,186,161,181,220,154,1,34,185,1,27,1,51,47,252,15,9,126,107,79,96,
+105,87,115,5,132,148,3,218,249,78,2,68,130,161,1,3,214,246,220,196,78,180,
+155,167,194,1,17,253,200,1,41,163,254,195,254,240,112,202,175,157,162,106,
+97,98,112,251,94,0,0,2,0,117,253,110,9,172,4,138,0,72,0,83,0,0,1,35,17,33,
+39,54,17,52,38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,0,
+17,20,6,7,33,17,51,17,54,51,50,22,21,16,0,33,35,32,36,53,52,54,51,50,23,7,
+38,35,34,6,21,20,4,33,51,32,36,53,52,38,35,34,7,1,22,22,51,50,54,53,52,38,
+35,34,7,167,179,253,42,7,107,223,193,180,242,30,116,132,152,179,186,161,181,
+220,154,1,34,185,1,27,1,51,47,53,2,32,179,88,118,138,173,253,136,253,164,
+118,254,34,254,42,184,174,160,171,33,176,114,98,93,1,153,1,148,46,2,30,2,
+42,87,76,99,83,249,113,9,126,107,79,96,105,87,115,254,208,1,48,130,161,1,
+3,214,246,220,196,78,180,155,167,194,1,17,253,200,1,41,163,254,195,254,240,
+112,202,111,3,218,252,39,57,163,143,254,239,254,227,154,159,105,122,42,148,
+44,38,47,76,84,207,205,76,84,63,1,178,157,162,106,97,98,112,0,3,0,117,255,
+232,11,163,6,190,0,85,0,96,0,97,0,0,1,54,54,51,50,22,21,21,20,22,22,51,50,
+54,53,52,39,38,0,53,52,54,54,51,50,4,18,21,17,35,17,16,2,38,35,34,6,21,20,
+22,23,38,39,55,18,17,16,2,35,34,2,53,53,52,38,38,35,34,6,21,17,35,17,52,38,
+38,35,34,6,7,54,51,50,22,21,20,6,35,34,2,53,52,18,36,51,32,1,22,22,51,50,
+54,53,52,38,35,34,1,4,135,44,161,108,163,185,58,111,90,122,123,56,248,254,
+237,140,255,158,226,1,64,135,177,101,235,174,176,194,140,132,38,51,170,227,
+220,216,211,212,41,82,65,81,99,177,93,172,105,172,238,31,118,129,152,179,
+186,161,181,220,158,1,34,181,1,14,253,32,9,124,109,79,96,105,87,115,3,22,
+3,169,111,114,214,245,169,163,163,80,178,179,165,150,28,1,3,205,134,196,104,
+174,254,215,255,252,24,3,156,1,1,1,3,132,150,136,129,169,34,61,63,86,254,
+201,254,159,254,252,254,248,1,3,250,104,196,164,64,163,131,253,49,2,101,131,
+179,87,224,191,77,180,155,167,194,1,17,253,201,1,43,160,253,40,157,162,106,
+97,98,112,2,94,0,0,4,0,117,255,232,10,77,6,190,0,85,0,97,0,108,0,109,0,0,
+1,54,54,51,50,22,21,21,20,22,22,51,50,54,53,52,39,38,36,53,52,54,54,51,50,
+22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,23,38,39,55,18,17,16,2,35,34,2,
+53,53,52,38,38,35,34,6,21,17,35,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,
+35,34,2,53,52,18,36,51,32,1,6,21,20,22,51,50,54,53,52,38,35,1,22,22,51,50,
+54,53,52,38,35,34,1,4,135,44,161,108,163,185,58,111,90,122,123,55,244,254,
+243,124,237,162,169,189,145,122,120,143,28,108,113,144,139,42,50,170,227,
+220,216,211,212,41,82,65,81,99,177,93,172,105,172,238,31,118,129,152,179,
+186,161,181,220,158,1,34,181,1,14,4,239,37,67,61,58,66,105,96,248,35,9,124,
+109,79,96,105,87,115,3,22,3,169,111,114,214,245,169,163,163,80,178,179,161,
+153,27,250,200,130,208,112,137,119,118,134,121,105,69,63,30,155,108,128,170,
+36,69,60,86,254,199,254,161,254,252,254,248,1,3,250,104,196,164,64,163,131,
+253,49,2,101,131,179,87,224,191,77,180,155,167,194,1,17,253,201,1,43,160,
+1,178,59,65,62,66,65,53,66,68,251,118,157,162,106,97,98,112,2,94,0,2,0,180,
+253,110,12,5,6,190,0,93,0,105,0,0,1,54,54,51,50,22,21,16,0,4,33,35,32,36,
+38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,22,4,33,51,32,0,17,52,38,35,34,
+6,7,17,35,17,33,17,35,17,52,38,35,34,6,21,17,33,17,51,17,33,17,52,54,54,51,
+50,23,53,33,38,53,52,36,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,23,33,
+21,33,1,6,21,20,22,51,50,54,53,52,38,35,9,71,75,116,64,162,209,254,158,253,
+87,254,36,222,254,174,254,78,218,184,174,160,171,33,176,114,98,93,69,185,
+1,102,1,10,90,2,178,2,196,118,102,61,106,57,178,254,156,178,87,89,102,89,
+251,164,177,2,250,79,156,111,143,86,1,255,19,1,24,249,171,191,145,123,120,
+143,28,113,117,31,1,101,254,155,1,87,37,67,61,58,66,106,98,2,152,47,31,245,
+208,254,213,254,86,222,63,135,115,105,122,42,148,44,38,47,32,53,47,28,1,150,
+1,136,144,160,40,45,254,4,3,218,252,38,2,176,175,150,156,231,253,142,4,110,
+252,38,2,43,169,190,100,116,88,61,81,201,249,138,118,118,134,121,105,71,63,
+30,155,110,85,64,148,2,98,59,65,62,66,65,53,65,69,0,0,2,252,235,0,0,1,101,
+6,190,0,23,0,24,0,0,1,38,2,53,52,36,51,50,4,18,17,17,35,17,16,38,38,35,34,
+6,21,20,22,23,55,254,181,216,242,1,26,231,212,1,42,123,177,91,212,149,164,
+176,142,139,11,3,31,25,1,0,202,210,234,176,254,221,254,255,252,22,3,161,1,
+4,253,130,153,140,143,170,21,189,0,2,252,142,0,0,1,101,6,190,0,23,0,24,0,
+0,1,38,38,53,52,36,51,50,4,18,21,17,35,17,52,38,38,35,34,6,21,20,22,23,37,
+252,195,25,28,1,52,247,226,1,63,139,177,101,235,163,185,201,29,24,1,76,4,
+30,47,126,63,205,231,170,254,219,245,252,6,3,182,241,254,127,156,144,63,104,
+51,80,0,2,253,99,0,0,1,101,6,190,0,22,0,23,0,0,1,38,38,53,52,36,51,50,22,
+18,17,17,35,17,16,38,38,35,34,6,21,20,23,55,253,159,27,33,1,9,222,165,244,
+130,177,78,162,134,142,156,70,102,4,30,52,136,62,199,223,139,254,228,254,
+235,251,254,3,183,1,4,245,116,142,126,135,115,80,0,0,3,253,20,255,232,3,163,
+4,110,0,14,0,27,0,28,0,0,1,50,22,22,21,20,6,35,34,38,53,52,55,33,53,5,6,21,
+20,22,51,50,54,53,52,38,38,35,19,1,218,183,186,88,199,148,192,201,8,252,77,
+4,99,9,107,103,83,97,84,129,131,101,4,110,101,157,101,146,184,220,187,75,
+59,148,148,54,73,132,133,101,81,75,101,34,252,14,0,3,253,20,255,232,6,67,
+6,190,0,43,0,57,0,58,0,0,1,50,22,22,21,20,6,35,34,38,53,53,52,55,33,53,33,
+54,0,51,50,4,18,21,16,2,4,35,34,36,39,55,22,33,32,0,17,52,2,38,35,34,6,7,
+7,21,20,22,51,50,54,53,52,38,38,35,35,6,1,2,12,183,186,88,199,148,191,202,
+3,252,32,3,247,60,1,85,242,211,1,58,168,196,254,139,251,171,254,189,133,94,
+249,1,11,1,60,1,86,125,235,162,174,238,46,28,109,101,83,97,84,129,131,43,
+3,1,246,4,110,101,157,101,146,184,237,205,22,40,37,148,239,1,8,193,254,153,
+231,254,231,254,118,203,104,98,141,195,1,120,1,97,183,1,34,157,180,169,226,
+40,140,134,101,81,75,101,34,37,3,9,0,2,0,148,255,228,1,146,5,183,0,3,0,15,
+0,0,1,35,3,51,3,50,22,23,20,6,35,34,38,53,52,54,1,78,117,51,219,110,60,66,
+1,70,57,59,68,65,1,156,4,27,251,65,71,66,68,71,70,69,66,71,0,4,0,143,4,86,
+2,218,6,190,0,3,0,7,0,8,0,9,0,0,1,3,35,3,33,3,35,3,7,3,1,114,51,125,51,2,
+75,51,124,51,53,10,6,102,253,240,2,16,253,240,2,16,175,1,7,0,0,2,0,51,0,0,
+4,248,5,182,0,27,0,31,0,0,1,3,33,21,33,3,35,19,33,3,35,19,33,53,33,19,33,
+53,33,19,51,3,33,19,51,3,33,21,1,33,19,33,3,215,63,1,24,254,205,82,147,84,
+254,221,82,144,78,254,254,1,29,65,254,238,1,43,82,147,82,1,37,84,144,84,1,
+6,252,235,1,35,64,254,221,3,125,254,184,137,254,84,1,172,254,84,1,172,137,
+1,72,137,1,176,254,80,1,176,254,80,137,254,184,1,72,0,0,5,0,101,255,236,6,
+66,5,203,0,11,0,23,0,27,0,39,0,51,0,0,1,34,38,53,52,54,51,50,22,23,20,6,39,
+50,54,53,52,38,35,34,6,21,20,22,1,1,35,1,19,34,38,53,52,54,51,50,22,23,6,
+6,39,50,54,53,52,38,35,34,6,21,20,22,1,144,143,156,149,150,147,159,1,157,
+150,78,79,79,78,79,71,71,3,247,252,213,158,3,43,117,142,157,149,150,146,160,
+1,1,156,150,79,78,79,78,79,71,71,2,53,239,222,228,229,236,221,228,233,130,
+165,166,165,165,166,164,165,166,3,0,250,73,5,183,250,53,238,223,228,228,237,
+219,229,232,129,164,168,163,164,163,164,166,166,0,0,3,0,143,4,86,1,195,6,
+190,0,3,0,4,0,5,0,0,1,3,35,3,5,3,1,114,51,125,51,1,52,10,6,102,253,240,2,
+16,175,1,7,0,0,5,0,82,253,110,2,43,6,190,0,19,0,20,0,21,0,22,0,23,0,0,19,
+52,18,18,54,55,51,6,2,17,20,18,18,22,23,35,38,38,2,2,1,3,3,19,82,36,74,113,
+78,172,140,145,37,71,106,69,170,78,113,74,36,1,183,10,121,22,2,48,150,1,35,
+1,18,253,111,231,253,215,254,219,142,254,229,254,241,253,113,108,247,1,13,
+1,31,4,28,1,7,249,66,253,110,0,0,5,0,61,253,110,2,23,6,190,0,19,0,20,0,21,
+0,22,0,23,0,0,1,20,2,2,6,7,35,54,54,18,18,53,16,2,39,51,22,22,18,18,11,2,
+19,2,23,36,75,113,78,170,69,106,72,36,144,141,172,78,113,75,36,84,10,251,
+22,2,47,148,254,225,254,242,246,108,113,253,1,15,1,26,143,1,36,2,41,231,111,
+253,254,238,254,221,2,242,1,7,249,66,253,110,0,3,0,82,2,201,4,20,6,190,0,
+14,0,15,0,16,0,0,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,5,3,2,152,43,1,141,
+26,254,134,245,178,176,158,184,242,254,137,29,1,135,43,1,36,10,6,102,254,
+119,111,193,28,254,186,96,1,102,254,154,96,1,70,28,193,111,1,137,175,1,7,
+0,0,3,0,104,0,0,4,43,5,183,0,11,0,12,0,13,0,0,1,33,21,33,17,35,17,33,53,33,
+17,51,3,19,2,147,1,152,254,104,147,254,104,1,152,147,79,11,3,27,146,254,90,
+1,166,146,1,168,251,61,5,183,0,2,0,63,254,248,1,121,0,238,0,12,0,13,0,0,37,
+23,14,3,7,35,62,3,55,7,1,106,15,14,39,47,51,25,138,15,29,27,22,8,70,238,23,
+54,122,124,123,56,61,132,131,125,53,238,0,3,0,82,0,0,2,66,4,110,0,3,0,4,0,
+5,0,0,19,53,33,21,3,17,82,1,240,254,1,209,168,168,2,157,251,146,0,1,0,147,
+255,227,1,145,0,250,0,19,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,
+147,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,111,38,53,33,15,15,33,
+53,38,37,53,34,16,16,34,53,0,0,5,0,40,253,110,2,251,6,190,0,3,0,4,0,5,0,6,
+0,7,0,0,1,1,35,1,7,3,3,19,2,251,253,224,179,2,33,134,10,51,22,6,102,247,166,
+8,90,175,1,7,249,66,253,110,0,2,0,103,255,236,4,49,5,205,0,11,0,23,0,0,5,
+34,2,17,16,18,51,50,18,17,16,2,39,50,18,17,16,2,35,34,2,17,16,18,2,74,238,
+245,239,244,237,250,241,246,159,146,147,158,160,143,143,20,1,126,1,115,1,
+130,1,110,254,129,254,143,254,132,254,139,153,1,30,1,58,1,57,1,29,254,228,
+254,198,254,197,254,227,0,0,1,0,184,0,0,2,216,5,183,0,10,0,0,33,35,17,52,
+55,6,7,7,39,1,51,2,216,176,8,29,49,204,94,1,139,149,3,254,165,87,31,41,168,
+121,1,52,0,1,0,100,0,0,4,42,5,203,0,26,0,0,33,33,53,1,62,2,53,52,38,35,34,
+6,7,39,54,51,50,22,23,20,6,6,7,1,21,33,4,42,252,58,1,127,152,125,62,139,119,
+96,160,96,96,206,242,205,237,1,87,148,140,254,207,2,227,150,1,131,154,155,
+151,87,115,130,64,75,121,172,210,179,108,194,183,136,254,211,8,0,0,1,0,93,
+255,236,4,32,5,203,0,39,0,0,1,21,22,22,21,20,4,33,34,39,53,22,22,51,50,54,
+53,52,38,35,35,53,51,50,54,55,38,38,35,34,6,7,39,54,33,50,22,21,20,6,2,196,
+171,177,254,222,254,241,243,159,93,213,98,185,186,205,205,141,143,174,192,
+1,1,142,124,97,169,102,90,197,1,3,216,237,155,3,2,8,22,176,148,207,229,80,
+168,47,50,144,145,129,129,154,148,128,105,118,54,68,122,152,195,167,139,181,
+0,2,0,44,0,0,4,108,5,191,0,10,0,18,0,0,1,35,17,35,17,33,53,1,51,17,51,33,
+17,52,55,35,6,7,1,4,108,213,174,253,67,2,176,187,213,254,125,10,8,35,53,254,
+73,1,76,254,180,1,76,154,3,217,252,47,1,205,122,201,77,83,253,144,0,1,0,130,
+255,236,4,32,5,183,0,28,0,0,55,53,22,22,51,50,54,53,52,38,35,34,7,39,19,33,
+21,33,3,54,51,50,4,21,20,0,33,34,38,130,72,211,98,172,189,184,183,108,142,
+90,55,2,222,253,188,35,125,100,228,1,8,254,225,254,252,118,197,60,170,44,
+53,163,153,148,149,31,57,2,179,164,254,88,22,230,200,228,254,253,41,0,0,2,
+0,111,255,236,4,49,5,203,0,23,0,37,0,0,1,21,38,35,34,2,3,51,54,54,51,50,22,
+21,20,2,35,34,0,17,16,0,33,50,19,52,38,35,34,6,6,21,20,22,22,51,50,54,3,193,
+75,101,237,244,13,12,55,177,115,193,230,252,212,227,254,241,1,79,1,79,107,
+7,145,137,93,149,78,81,142,91,137,151,5,185,154,25,254,226,254,206,84,88,
+238,207,228,254,249,1,84,1,49,1,173,1,173,252,12,144,159,81,123,64,100,176,
+99,177,0,1,0,91,0,0,4,48,5,183,0,6,0,0,33,1,33,53,33,21,1,1,24,2,88,252,235,
+3,213,253,174,5,19,164,140,250,213,0,0,3,0,102,255,236,4,46,5,203,0,23,0,
+35,0,48,0,0,1,22,22,21,20,4,35,34,38,53,52,54,55,38,38,55,38,54,51,50,22,
+21,20,6,5,54,54,53,52,38,35,34,6,21,6,22,23,6,6,21,20,22,51,50,54,53,52,38,
+39,2,233,174,151,254,253,220,237,252,151,152,133,124,1,1,241,196,200,238,
+135,254,217,134,118,141,121,118,140,1,114,116,145,131,161,148,143,164,145,
+162,3,6,85,188,122,182,217,205,188,126,195,70,75,181,115,159,189,188,162,
+110,176,3,55,135,93,98,113,114,97,89,129,219,62,152,105,114,134,137,117,94,
+144,63,0,2,0,99,255,236,4,37,5,203,0,23,0,37,0,0,51,53,22,51,50,18,19,35,
+6,35,34,38,53,52,18,51,50,0,17,16,0,33,34,38,19,20,22,51,50,54,54,53,46,2,
+35,34,6,205,83,97,239,244,11,12,112,237,194,225,253,214,225,1,14,254,176,
+254,176,47,109,44,143,137,88,149,85,1,76,143,93,137,152,154,27,1,31,1,47,
+170,237,205,227,1,11,254,172,254,207,254,83,254,83,11,3,232,146,155,72,127,
+68,95,176,103,178,0,0,3,0,94,255,227,1,145,4,110,0,19,0,39,0,40,0,0,55,52,
+62,2,51,50,30,2,21,20,14,2,35,34,46,2,17,52,62,2,51,50,30,2,21,20,14,2,35,
+34,46,2,39,147,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,20,34,46,27,
+26,47,34,20,20,34,47,26,27,46,34,20,53,111,38,53,33,15,15,33,53,38,37,53,
+34,16,16,34,53,3,145,39,53,33,14,14,33,53,39,37,52,34,16,16,34,52,184,0,0,
+4,0,63,254,248,1,145,4,110,0,12,0,32,0,33,0,34,0,0,37,23,14,3,7,35,62,3,55,
+3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,39,17,1,106,15,14,39,47,51,25,
+138,15,29,27,22,8,17,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,53,238,
+23,54,122,124,123,56,61,132,131,125,53,2,237,39,53,33,14,14,33,53,39,37,52,
+34,16,16,34,52,184,251,146,0,0,3,0,103,0,0,4,44,5,183,0,6,0,7,0,8,0,0,37,
+1,53,1,21,9,2,19,4,44,252,59,3,197,252,252,3,4,254,24,11,238,1,168,102,1,
+225,160,254,148,254,188,254,115,5,183,0,4,0,116,0,0,4,30,5,183,0,3,0,7,0,
+8,0,9,0,0,19,53,33,21,1,53,33,21,1,19,116,3,170,252,86,3,170,254,38,11,3,
+84,145,145,254,104,146,146,254,68,5,183,0,3,0,103,0,0,4,44,5,183,0,6,0,7,
+0,8,0,0,19,1,1,53,1,21,1,5,19,103,3,4,252,252,3,197,252,59,1,221,11,1,141,
+1,66,1,110,160,254,31,102,254,88,238,5,183,0,2,0,77,255,227,3,77,5,203,0,
+39,0,59,0,0,1,53,52,62,2,55,62,3,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,
+21,20,14,2,7,14,3,21,21,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,65,15,
+39,66,50,48,68,43,21,30,57,85,56,83,150,70,63,81,188,97,93,149,104,56,27,
+54,80,54,52,66,38,14,187,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,
+1,158,37,57,92,80,77,42,41,67,69,79,53,48,79,57,31,52,34,145,42,59,51,96,
+139,87,67,105,90,84,47,45,67,63,66,44,18,254,209,38,53,33,15,15,33,53,38,
+37,53,34,16,16,34,53,0,5,0,164,253,110,2,57,6,190,0,7,0,8,0,9,0,10,0,11,0,
+0,1,33,17,33,21,35,17,51,11,2,19,2,57,254,107,1,149,223,223,118,10,51,22,
+254,12,8,90,139,248,189,7,31,1,7,249,66,253,110,0,5,0,41,253,110,2,251,6,
+190,0,3,0,4,0,5,0,6,0,7,0,0,19,1,35,1,5,3,3,19,219,2,32,178,253,224,1,154,
+10,51,22,6,102,247,166,8,90,175,1,7,249,66,253,110,0,5,0,81,253,110,1,231,
+6,190,0,7,0,8,0,9,0,10,0,11,0,0,19,51,17,35,53,33,17,33,19,3,3,19,81,223,
+223,1,150,254,106,170,10,51,22,254,152,7,67,139,247,166,7,171,1,7,249,66,
+253,110,0,1,0,81,2,37,4,65,5,193,0,6,0,0,19,1,51,1,35,1,1,81,1,203,102,1,
+191,161,254,175,254,163,2,37,3,156,252,100,2,223,253,33,0,3,255,252,253,110,
+3,145,0,0,0,3,0,4,0,5,0,0,1,33,53,33,37,19,3,145,252,107,3,149,253,130,2,
+254,197,131,184,253,110,0,0,5,0,62,253,110,2,163,6,190,0,41,0,42,0,43,0,44,
+0,45,0,0,1,20,6,7,21,22,22,21,17,20,30,2,23,21,46,3,53,17,52,46,2,35,53,50,
+54,53,17,52,62,2,55,21,14,3,21,39,3,3,19,1,245,119,115,115,119,24,45,65,40,
+77,131,95,54,33,65,96,62,125,131,54,95,131,77,40,65,45,24,250,10,51,22,3,
+114,131,151,25,12,25,152,130,254,101,60,75,44,16,1,149,1,40,87,133,95,1,149,
+63,88,55,24,155,105,125,1,150,95,133,87,40,1,150,1,16,44,75,60,171,1,7,249,
+66,253,110,0,5,1,134,253,110,2,127,6,190,0,3,0,4,0,5,0,6,0,7,0,0,1,51,17,
+35,11,2,19,1,233,150,150,38,10,51,22,6,103,247,165,7,171,1,7,249,66,253,110,
+0,0,5,0,82,253,110,2,183,6,190,0,41,0,42,0,43,0,44,0,45,0,0,1,52,54,55,53,
+38,38,53,17,52,46,2,39,53,30,3,21,17,20,30,2,51,21,34,6,21,17,20,14,2,7,53,
+62,3,53,19,3,19,19,1,0,119,115,115,119,24,45,65,40,77,131,95,54,33,65,96,
+62,125,131,54,95,131,77,40,65,45,24,195,10,49,22,1,0,131,151,25,12,25,152,
+130,1,155,60,75,44,16,1,149,1,40,87,133,95,254,107,63,88,55,24,155,105,125,
+254,106,95,133,87,40,1,150,1,16,44,75,60,6,81,1,7,249,66,253,110,0,0,1,0,
+103,2,76,4,44,3,88,0,36,0,0,1,46,3,35,34,14,2,7,53,54,51,50,30,2,23,30,3,
+51,50,62,2,55,21,6,6,35,34,46,2,2,40,37,60,51,45,22,29,61,61,58,25,100,146,
+29,57,63,74,47,37,60,51,44,21,30,63,61,57,25,50,121,75,29,57,64,74,2,141,
+16,22,13,5,19,33,44,25,160,108,5,15,25,20,16,22,13,5,19,32,44,26,158,54,56,
+5,15,25,0,255,255,0,82,0,0,2,66,4,110,2,6,0,163,0,0,0,3,0,82,0,0,3,174,4,
+110,0,3,0,4,0,5,0,0,19,53,33,21,1,17,82,3,92,253,150,1,209,168,168,2,157,
+251,146,0,0,3,0,82,0,0,7,174,4,110,0,3,0,4,0,5,0,0,19,53,33,21,1,17,82,7,
+92,249,150,1,209,168,168,2,157,251,146,0,0,3,0,73,4,113,1,130,6,190,0,12,
+0,13,0,14,0,0,19,39,62,3,55,51,14,3,7,3,3,87,14,14,39,46,52,25,137,15,29,
+26,22,8,155,10,4,113,22,54,122,124,123,56,61,132,131,124,53,1,70,1,7,0,0,
+3,0,73,4,113,1,155,6,190,0,12,0,13,0,14,0,0,1,23,14,3,7,35,62,3,55,23,3,1,
+116,14,14,39,47,51,25,137,14,29,27,22,8,238,10,6,102,22,55,121,125,122,56,
+60,132,132,124,53,175,1,7,0,0,4,0,73,4,113,3,3,6,190,0,12,0,25,0,26,0,27,
+0,0,1,39,62,3,55,51,14,3,7,33,39,62,3,55,51,14,3,7,19,3,1,216,14,14,39,46,
+52,25,137,15,29,26,22,8,253,184,14,14,39,46,52,25,137,15,29,26,22,8,165,10,
+4,113,22,54,122,124,123,56,61,132,131,124,53,22,54,122,124,123,56,61,132,
+131,124,53,1,70,1,7,0,4,0,73,4,113,3,3,6,190,0,12,0,25,0,26,0,27,0,0,1,23,
+14,3,7,35,62,3,55,33,23,14,3,7,35,62,3,55,7,3,1,116,14,14,39,47,51,25,137,
+14,29,27,22,8,2,72,14,14,39,47,51,25,137,14,29,27,22,8,107,10,6,102,22,55,
+121,125,122,56,60,132,132,124,53,22,55,121,125,122,56,60,132,132,124,53,175,
+1,7,0,0,3,0,147,255,227,5,219,0,250,0,19,0,39,0,57,0,0,55,52,62,2,51,50,30,
+2,21,20,14,2,35,34,46,2,37,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,37,52,
+62,2,51,50,30,2,21,20,14,2,35,34,38,147,20,34,46,27,26,47,34,20,20,34,47,
+26,27,46,34,20,2,37,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,2,37,
+19,35,46,27,26,47,34,20,20,34,47,26,54,73,111,38,53,33,15,15,33,53,38,37,
+53,34,16,16,34,53,37,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,37,38,53,
+33,15,15,33,53,38,37,53,34,16,66,0,3,0,133,0,0,4,14,5,183,0,11,0,12,0,13,
+0,0,1,1,23,1,1,7,1,1,39,1,1,55,1,19,2,74,1,94,102,254,164,1,90,102,254,162,
+254,170,107,1,90,254,164,107,1,84,11,3,57,1,95,105,254,164,254,164,105,1,
+90,254,166,105,1,92,1,90,107,251,104,5,183,0,0,5,0,104,0,0,4,44,5,183,0,10,
+0,14,0,25,0,26,0,27,0,0,1,50,22,21,6,6,35,34,38,53,52,1,53,33,21,5,50,22,
+21,20,6,35,34,38,53,52,19,19,2,73,54,59,1,61,51,53,62,254,146,3,196,254,29,
+54,59,61,52,55,60,110,11,4,170,62,61,61,64,65,60,123,253,223,146,146,153,
+62,61,60,65,65,60,123,254,16,5,183,0,3,0,103,0,0,4,44,5,183,0,3,0,4,0,5,0,
+0,19,53,33,21,1,19,103,3,197,254,24,11,2,137,146,146,253,119,5,183,0,1,0,
+147,0,0,4,27,5,182,0,34,0,0,1,14,3,7,1,35,1,55,51,50,62,3,55,33,53,33,46,
+3,35,35,53,33,21,33,22,22,23,33,21,2,220,3,52,94,134,87,1,187,228,254,82,
+21,74,54,79,59,53,49,10,254,113,1,142,9,36,55,89,78,131,3,136,254,102,34,
+45,10,1,65,3,188,75,127,99,66,14,253,193,2,55,158,10,20,41,86,74,148,52,77,
+53,28,148,148,36,105,69,148,0,1,255,196,254,12,0,60,6,6,0,3,0,0,3,17,51,17,
+60,120,254,12,7,250,248,6,0,1,254,183,254,12,1,73,6,77,0,14,0,0,19,23,7,39,
+17,35,17,7,39,55,39,55,23,55,23,82,247,82,187,120,187,82,247,247,82,247,247,
+82,5,13,241,81,186,249,135,6,121,186,81,241,239,81,243,243,81,0,0,10,0,117,
+0,0,4,8,4,110,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,64,0,65,0,0,1,20,35,
+34,53,52,51,50,5,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,
+53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,5,20,35,34,53,
+52,51,50,5,20,35,34,53,52,51,50,3,17,2,127,64,66,66,64,254,220,64,65,65,64,
+2,72,64,66,66,64,101,65,64,64,65,252,239,65,65,65,65,100,64,65,65,64,2,72,
+64,66,66,64,254,220,64,66,66,64,65,3,165,65,65,64,176,66,66,64,64,66,66,64,
+254,167,66,66,65,65,66,66,65,254,167,66,66,64,64,66,66,64,177,65,65,65,3,
+154,251,146,0,3,1,104,255,156,2,62,4,210,0,3,0,4,0,5,0,0,5,17,51,17,19,17,
+1,104,177,37,100,5,54,250,202,4,210,251,146,0,0,4,1,104,255,156,3,219,4,210,
+0,3,0,7,0,8,0,9,0,0,5,17,51,17,33,17,51,17,1,17,1,104,177,1,17,177,254,199,
+100,5,54,250,202,5,54,250,202,4,210,251,146,0,0,4,0,30,2,244,2,229,6,190,
+0,24,0,25,0,26,0,27,0,0,1,33,53,55,54,54,53,52,38,35,34,6,7,39,54,51,50,22,
+21,20,14,2,7,33,19,23,3,2,96,253,190,236,127,71,75,62,62,100,53,72,133,156,
+132,149,25,52,83,242,1,144,125,8,10,2,244,110,230,123,113,69,65,66,48,40,
+94,113,131,111,46,79,81,92,228,2,243,175,1,7,0,5,0,30,2,227,2,229,6,190,0,
+33,0,34,0,35,0,36,0,37,0,0,1,20,7,22,21,20,6,35,34,39,53,22,51,50,53,52,35,
+35,53,51,50,54,53,52,38,35,34,7,39,54,54,51,50,22,19,19,23,3,2,114,152,178,
+184,170,152,116,142,128,205,225,117,117,103,95,77,66,104,123,74,74,144,81,
+136,157,47,60,8,10,5,145,151,57,44,165,127,142,58,129,70,156,141,113,78,65,
+59,66,78,94,55,46,121,252,250,3,114,175,1,7,0,4,0,30,2,244,2,196,6,190,0,
+10,0,17,0,18,0,19,0,0,1,35,21,35,53,33,53,1,51,17,51,33,53,52,55,6,7,7,1,
+3,2,196,125,153,254,112,1,148,149,125,254,234,6,8,90,164,1,221,10,3,184,196,
+196,107,2,67,253,205,191,107,100,18,140,240,1,132,1,7,255,255,0,30,254,69,
+2,229,2,15,2,7,0,209,0,0,251,81,255,255,0,30,254,52,2,229,2,15,2,7,0,210,
+0,0,251,81,255,255,0,30,254,69,2,196,2,15,2,7,0,211,0,0,251,81,0,0,0,15,0,
+186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,30,0,94,0,3,0,1,4,9,0,2,0,
+14,0,124,0,3,0,1,4,9,0,3,0,68,0,138,0,3,0,1,4,9,0,4,0,30,0,94,0,3,0,1,4,9,
+0,5,0,30,0,206,0,3,0,1,4,9,0,6,0,26,0,236,0,3,0,1,4,9,0,7,0,68,1,6,0,3,0,
+1,4,9,0,8,0,42,1,74,0,3,0,1,4,9,0,9,0,40,1,116,0,3,0,1,4,9,0,10,0,96,1,156,
+0,3,0,1,4,9,0,11,0,62,1,252,0,3,0,1,4,9,0,12,0,60,2,58,0,3,0,1,4,9,0,13,2,
+150,2,118,0,3,0,1,4,9,0,14,0,52,5,12,0,67,0,111,0,112,0,121,0,114,0,105,0,
+103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,
+0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,
+0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,
+0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,97,0,109,0,
+105,0,108,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,97,
+0,109,0,105,0,108,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,
+0,48,0,55,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,
+84,0,97,0,109,0,105,0,108,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,
+97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,
+102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,
+0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,
+0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,
+0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,
+0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,
+0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,
+0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,
+0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,
+0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,
+112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,
+110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,215,0,0,0,1,0,2,0,3,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,
+1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,
+1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,
+1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,
+1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,
+1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,
+1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,
+1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,
+113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,
+1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,
+138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,156,1,155,
+1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,
+169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,
+1,182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,
+194,1,149,1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,
+1,150,1,151,1,152,1,153,1,154,1,206,1,207,1,208,1,209,1,210,1,211,1,212,13,
+97,110,117,115,118,97,114,97,116,97,109,105,108,12,118,105,115,97,114,103,
+97,116,97,109,105,108,6,97,116,97,109,105,108,7,97,97,116,97,109,105,108,
+6,105,116,97,109,105,108,7,105,105,116,97,109,105,108,6,117,116,97,109,105,
+108,7,117,117,116,97,109,105,108,6,101,116,97,109,105,108,7,101,101,116,97,
+109,105,108,7,97,105,116,97,109,105,108,6,111,116,97,109,105,108,7,111,111,
+116,97,109,105,108,7,97,117,116,97,109,105,108,7,107,97,116,97,109,105,108,
+8,110,103,97,116,97,109,105,108,7,99,97,116,97,109,105,108,7,106,97,116,97,
+109,105,108,8,110,121,97,116,97,109,105,108,8,116,116,97,116,97,109,105,108,
+8,110,110,97,116,97,109,105,108,7,116,97,116,97,109,105,108,7,110,97,116,
+97,109,105,108,9,110,110,110,97,116,97,109,105,108,7,112,97,116,97,109,105,
+108,7,109,97,116,97,109,105,108,7,121,97,116,97,109,105,108,7,114,97,116,
+97,109,105,108,8,114,114,97,116,97,109,105,108,7,108,97,116,97,109,105,108,
+8,108,108,97,116,97,109,105,108,9,108,108,108,97,116,97,109,105,108,7,118,
+97,116,97,109,105,108,8,115,104,97,116,97,109,105,108,8,115,115,97,116,97,
+109,105,108,7,115,97,116,97,109,105,108,7,104,97,116,97,109,105,108,16,97,
+97,118,111,119,101,108,115,105,103,110,116,97,109,105,108,15,105,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,16,105,105,118,111,119,101,
+108,115,105,103,110,116,97,109,105,108,15,117,118,111,119,101,108,115,105,
+103,110,116,97,109,105,108,16,117,117,118,111,119,101,108,115,105,103,110,
+116,97,109,105,108,15,101,118,111,119,101,108,115,105,103,110,116,97,109,
+105,108,16,101,101,118,111,119,101,108,115,105,103,110,116,97,109,105,108,
+16,97,105,118,111,119,101,108,115,105,103,110,116,97,109,105,108,15,111,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,16,111,111,118,111,119,
+101,108,115,105,103,110,116,97,109,105,108,16,97,117,118,111,119,101,108,
+115,105,103,110,116,97,109,105,108,11,118,105,114,97,109,97,116,97,109,105,
+108,12,111,104,109,115,105,103,110,116,97,109,105,108,17,97,117,108,101,110,
+103,116,104,109,97,114,107,116,97,109,105,108,9,122,101,114,111,116,97,109,
+105,108,8,111,110,101,116,97,109,105,108,8,116,119,111,116,97,109,105,108,
+10,116,104,114,101,101,116,97,109,105,108,9,102,111,117,114,116,97,109,105,
+108,9,102,105,118,101,116,97,109,105,108,8,115,105,120,116,97,109,105,108,
+10,115,101,118,101,110,116,97,109,105,108,10,101,105,103,104,116,116,97,109,
+105,108,9,110,105,110,101,116,97,109,105,108,8,116,101,110,116,97,109,105,
+108,12,104,117,110,100,114,101,100,116,97,109,105,108,13,116,104,111,117,
+115,97,110,100,116,97,109,105,108,12,100,97,121,115,105,103,110,116,97,109,
+105,108,14,109,111,110,116,104,115,105,103,110,116,97,109,105,108,13,121,
+101,97,114,115,105,103,110,116,97,109,105,108,14,100,101,98,105,116,115,105,
+103,110,116,97,109,105,108,15,99,114,101,100,105,116,115,105,103,110,116,
+97,109,105,108,16,97,115,97,98,111,118,101,115,105,103,110,116,97,109,105,
+108,14,114,117,112,101,101,115,105,103,110,116,97,109,105,108,12,110,117,
+109,115,105,103,110,116,97,109,105,108,9,116,99,104,97,116,97,109,105,108,
+14,107,97,112,114,101,104,97,108,102,116,97,109,105,108,15,110,103,97,112,
+114,101,104,97,108,102,116,97,109,105,108,14,99,97,112,114,101,104,97,108,
+102,116,97,109,105,108,14,106,97,112,114,101,104,97,108,102,116,97,109,105,
+108,15,110,121,97,112,114,101,104,97,108,102,116,97,109,105,108,15,116,116,
+97,112,114,101,104,97,108,102,116,97,109,105,108,15,110,110,97,112,114,101,
+104,97,108,102,116,97,109,105,108,14,116,97,112,114,101,104,97,108,102,116,
+97,109,105,108,14,110,97,112,114,101,104,97,108,102,116,97,109,105,108,16,
+110,110,110,97,112,114,101,104,97,108,102,116,97,109,105,108,14,112,97,112,
+114,101,104,97,108,102,116,97,109,105,108,14,109,97,112,114,101,104,97,108,
+102,116,97,109,105,108,14,121,97,112,114,101,104,97,108,102,116,97,109,105,
+108,14,114,97,112,114,101,104,97,108,102,116,97,109,105,108,15,114,114,97,
+112,114,101,104,97,108,102,116,97,109,105,108,14,108,97,112,114,101,104,97,
+108,102,116,97,109,105,108,15,108,108,97,112,114,101,104,97,108,102,116,97,
+109,105,108,16,108,108,108,97,112,114,101,104,97,108,102,116,97,109,105,108,
+14,118,97,112,114,101,104,97,108,102,116,97,109,105,108,15,115,104,97,112,
+114,101,104,97,108,102,116,97,109,105,108,15,115,115,97,112,114,101,104,97,
+108,102,116,97,109,105,108,14,115,97,112,114,101,104,97,108,102,116,97,109,
+105,108,14,104,97,112,114,101,104,97,108,102,116,97,109,105,108,16,116,99,
+104,97,112,114,101,104,97,108,102,116,97,109,105,108,17,107,97,117,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,18,107,97,117,117,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,19,110,103,97,105,105,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,18,110,103,97,117,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,19,110,103,97,117,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,17,99,97,117,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,18,99,97,117,117,118,111,119,
+101,108,115,105,103,110,116,97,109,105,108,18,110,121,97,117,118,111,119,
+101,108,115,105,103,110,116,97,109,105,108,19,110,121,97,117,117,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,18,116,116,97,105,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,19,116,116,97,105,105,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,18,116,116,97,117,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,19,116,116,97,117,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,18,110,110,97,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,19,110,110,97,117,
+117,118,111,119,101,108,115,105,103,110,116,97,109,105,108,17,116,97,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,18,116,97,117,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,17,110,97,117,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,18,110,97,117,117,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,19,110,110,110,97,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,20,110,110,110,97,
+117,117,118,111,119,101,108,115,105,103,110,116,97,109,105,108,18,112,97,
+105,105,118,111,119,101,108,115,105,103,110,116,97,109,105,108,17,112,97,
+117,118,111,119,101,108,115,105,103,110,116,97,109,105,108,18,112,97,117,
+117,118,111,119,101,108,115,105,103,110,116,97,109,105,108,17,109,97,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,18,109,97,117,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,18,121,97,105,105,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,17,121,97,117,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,18,121,97,117,117,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,17,114,97,117,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,18,114,97,117,117,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,18,114,114,97,117,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,19,114,114,97,117,117,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,17,108,97,105,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,18,108,97,105,105,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,17,108,97,117,118,111,119,
+101,108,115,105,103,110,116,97,109,105,108,18,108,97,117,117,118,111,119,
+101,108,115,105,103,110,116,97,109,105,108,18,108,108,97,117,118,111,119,
+101,108,115,105,103,110,116,97,109,105,108,19,108,108,97,117,117,118,111,
+119,101,108,115,105,103,110,116,97,109,105,108,19,108,108,108,97,117,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,20,108,108,108,97,117,
+117,118,111,119,101,108,115,105,103,110,116,97,109,105,108,18,118,97,105,
+105,118,111,119,101,108,115,105,103,110,116,97,109,105,108,17,118,97,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,18,118,97,117,117,
+118,111,119,101,108,115,105,103,110,116,97,109,105,108,17,115,97,105,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,18,115,97,105,105,118,
+111,119,101,108,115,105,103,110,116,97,109,105,108,9,115,104,114,105,116,
+97,109,105,108,16,105,118,111,119,101,108,115,105,103,110,51,116,97,109,105,
+108,16,105,118,111,119,101,108,115,105,103,110,50,116,97,109,105,108,16,105,
+118,111,119,101,108,115,105,103,110,49,116,97,109,105,108,15,115,102,116,
+104,121,112,104,101,110,46,116,97,109,105,108,13,117,110,105,50,48,48,67,
+46,116,97,109,105,108,13,117,110,105,50,48,48,68,46,116,97,109,105,108,13,
+117,110,105,50,53,67,67,46,116,97,109,105,108,10,100,97,110,100,97,116,97,
+109,105,108,13,100,98,108,100,97,110,100,97,116,97,109,105,108,19,117,117,
+118,111,119,101,108,115,105,103,110,97,108,116,116,97,109,105,108,18,117,
+118,111,119,101,108,115,105,103,110,97,108,116,116,97,109,105,108,12,101,
+120,99,108,97,109,46,116,97,109,105,108,14,113,117,111,116,101,100,98,108,
+46,116,97,109,105,108,16,110,117,109,98,101,114,115,105,103,110,46,116,97,
+109,105,108,13,112,101,114,99,101,110,116,46,116,97,109,105,108,17,113,117,
+111,116,101,115,105,110,103,108,101,46,116,97,109,105,108,15,112,97,114,101,
+110,108,101,102,116,46,116,97,109,105,108,16,112,97,114,101,110,114,105,103,
+104,116,46,116,97,109,105,108,14,97,115,116,101,114,105,115,107,46,116,97,
+109,105,108,10,112,108,117,115,46,116,97,109,105,108,11,99,111,109,109,97,
+46,116,97,109,105,108,12,104,121,112,104,101,110,46,116,97,109,105,108,12,
+112,101,114,105,111,100,46,116,97,109,105,108,11,115,108,97,115,104,46,116,
+97,109,105,108,10,122,101,114,111,46,116,97,109,105,108,9,111,110,101,46,
+116,97,109,105,108,9,116,119,111,46,116,97,109,105,108,11,116,104,114,101,
+101,46,116,97,109,105,108,10,102,111,117,114,46,116,97,109,105,108,10,102,
+105,118,101,46,116,97,109,105,108,9,115,105,120,46,116,97,109,105,108,11,
+115,101,118,101,110,46,116,97,109,105,108,11,101,105,103,104,116,46,116,97,
+109,105,108,10,110,105,110,101,46,116,97,109,105,108,11,99,111,108,111,110,
+46,116,97,109,105,108,15,115,101,109,105,99,111,108,111,110,46,116,97,109,
+105,108,10,108,101,115,115,46,116,97,109,105,108,11,101,113,117,97,108,46,
+116,97,109,105,108,13,103,114,101,97,116,101,114,46,116,97,109,105,108,14,
+113,117,101,115,116,105,111,110,46,116,97,109,105,108,17,98,114,97,99,107,
+101,116,108,101,102,116,46,116,97,109,105,108,15,98,97,99,107,115,108,97,
+115,104,46,116,97,109,105,108,18,98,114,97,99,107,101,116,114,105,103,104,
+116,46,116,97,109,105,108,17,97,115,99,105,105,99,105,114,99,117,109,46,116,
+97,109,105,108,16,117,110,100,101,114,115,99,111,114,101,46,116,97,109,105,
+108,15,98,114,97,99,101,108,101,102,116,46,116,97,109,105,108,9,98,97,114,
+46,116,97,109,105,108,16,98,114,97,99,101,114,105,103,104,116,46,116,97,109,
+105,108,16,97,115,99,105,105,116,105,108,100,101,46,116,97,109,105,108,12,
+101,110,100,97,115,104,46,116,97,109,105,108,12,101,109,100,97,115,104,46,
+116,97,109,105,108,15,113,117,111,116,101,108,101,102,116,46,116,97,109,105,
+108,16,113,117,111,116,101,114,105,103,104,116,46,116,97,109,105,108,18,113,
+117,111,116,101,100,98,108,108,101,102,116,46,116,97,109,105,108,19,113,117,
+111,116,101,100,98,108,114,105,103,104,116,46,116,97,109,105,108,14,101,108,
+108,105,112,115,105,115,46,116,97,109,105,108,14,109,117,108,116,105,112,
+108,121,46,116,97,109,105,108,12,100,105,118,105,100,101,46,116,97,109,105,
+108,11,109,105,110,117,115,46,116,97,109,105,108,13,117,110,105,50,48,66,
+57,46,116,97,109,105,108,7,117,110,105,70,69,70,70,7,117,110,105,48,48,66,
+50,7,117,110,105,48,48,66,51,7,117,110,105,50,48,55,52,7,117,110,105,50,48,
+56,50,7,117,110,105,50,48,56,51,7,117,110,105,50,48,56,52,0,0,0,2,0,8,0,2,
+255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,0,0,2,0,10,0,4,0,42,0,1,0,43,0,43,0,3,
+0,44,0,51,0,1,0,52,0,52,0,3,0,54,0,54,0,1,0,76,0,147,0,2,0,148,0,152,0,1,
+0,168,0,170,0,1,0,203,0,205,0,1,0,209,0,214,0,1,0,1,0,0,0,10,0,52,0,78,0,
+2,116,97,109,108,0,14,116,109,108,50,0,18,0,8,0,0,0,14,0,0,0,0,255,255,0,
+2,0,0,0,1,0,0,255,255,0,2,0,0,0,1,0,2,100,105,115,116,0,14,107,101,114,110,
+0,20,0,0,0,1,0,0,0,0,0,1,0,1,0,2,0,6,0,98,0,2,0,0,0,1,0,8,0,1,0,24,0,4,0,
+0,0,7,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,1,0,7,0,20,0,24,0,27,0,31,0,34,
+0,37,0,41,0,1,0,43,0,190,0,1,0,43,0,190,0,1,0,43,0,190,0,1,0,43,0,190,0,1,
+0,43,0,190,0,1,0,43,0,110,0,1,0,43,0,190,0,2,0,0,0,1,0,8,0,1,0,58,0,4,0,0,
+0,24,0,110,0,124,0,134,0,148,0,162,0,176,0,186,0,200,0,214,0,228,0,242,1,
+0,1,14,1,20,1,26,1,40,1,54,1,64,1,78,1,92,1,102,1,116,1,122,1,128,0,1,0,24,
+0,18,0,21,0,23,0,25,0,41,0,43,0,54,0,77,0,82,0,84,0,101,0,102,0,106,0,107,
+0,110,0,111,0,112,0,113,0,117,0,122,0,124,0,130,0,131,0,137,0,3,0,209,255,
+86,0,210,255,76,0,211,255,106,0,2,0,210,255,241,0,211,255,196,0,3,0,209,254,
+112,0,210,254,122,0,211,254,91,0,3,0,209,255,86,0,210,255,76,0,211,255,106,
+0,3,0,209,0,30,0,210,0,30,0,211,0,30,0,2,0,209,0,50,0,210,0,50,0,3,0,209,
+0,30,0,210,0,30,0,211,0,30,0,3,0,209,255,86,0,210,255,76,0,211,255,106,0,
+3,0,209,254,182,0,210,254,182,0,211,254,91,0,3,0,209,255,86,0,210,255,76,
+0,211,255,106,0,3,0,209,255,86,0,210,255,76,0,211,255,106,0,3,0,209,254,232,
+0,210,254,212,0,211,254,112,0,1,0,209,255,236,0,1,0,209,255,41,0,3,0,209,
+255,66,0,210,255,60,0,211,254,217,0,3,0,209,255,206,0,210,255,196,0,211,255,
+146,0,2,0,210,255,246,0,211,255,246,0,3,0,209,0,70,0,210,0,60,0,211,0,100,
+0,3,0,209,0,30,0,210,0,30,0,211,0,30,0,2,0,209,0,50,0,210,0,50,0,3,0,209,
+254,162,0,210,254,162,0,211,254,162,0,1,0,209,255,56,0,1,0,209,255,56,0,1,
+0,209,0,20,0,0,0,1,0,0,0,10,0,70,0,160,0,2,116,97,109,108,0,14,116,109,108,
+50,0,18,0,8,0,0,0,24,0,0,0,0,255,255,0,7,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,0,
+255,255,0,6,0,0,0,1,0,3,0,4,0,5,0,6,0,7,97,98,118,115,0,44,97,107,104,110,
+0,50,104,97,108,102,0,56,104,97,108,110,0,62,112,115,116,115,0,68,115,117,
+98,115,0,78,115,117,112,115,0,84,0,0,0,1,0,2,0,0,0,1,0,0,0,0,0,1,0,1,0,0,
+0,1,0,10,0,0,0,3,0,3,0,4,0,8,0,0,0,1,0,12,0,0,0,1,0,11,0,13,0,28,0,62,1,124,
+2,32,3,208,4,124,4,144,4,164,4,184,5,12,5,34,6,96,6,120,0,4,0,0,0,1,0,8,0,
+1,0,20,0,1,0,8,0,1,0,4,0,76,0,3,0,52,0,38,0,1,0,1,0,18,0,4,0,0,0,1,0,8,0,
+1,1,38,0,24,0,54,0,64,0,74,0,84,0,94,0,104,0,114,0,124,0,134,0,144,0,154,
+0,164,0,174,0,184,0,194,0,204,0,214,0,224,0,234,0,244,0,254,1,8,1,18,1,28,
+0,1,0,4,0,77,0,2,0,52,0,1,0,4,0,78,0,2,0,52,0,1,0,4,0,79,0,2,0,52,0,1,0,4,
+0,80,0,2,0,52,0,1,0,4,0,81,0,2,0,52,0,1,0,4,0,82,0,2,0,52,0,1,0,4,0,83,0,
+2,0,52,0,1,0,4,0,84,0,2,0,52,0,1,0,4,0,85,0,2,0,52,0,1,0,4,0,86,0,2,0,52,
+0,1,0,4,0,87,0,2,0,52,0,1,0,4,0,88,0,2,0,52,0,1,0,4,0,89,0,2,0,52,0,1,0,4,
+0,90,0,2,0,52,0,1,0,4,0,91,0,2,0,52,0,1,0,4,0,92,0,2,0,52,0,1,0,4,0,93,0,
+2,0,52,0,1,0,4,0,94,0,2,0,52,0,1,0,4,0,95,0,2,0,52,0,1,0,4,0,96,0,2,0,52,
+0,1,0,4,0,97,0,2,0,52,0,1,0,4,0,98,0,2,0,52,0,1,0,4,0,99,0,2,0,52,0,1,0,4,
+0,100,0,2,0,52,0,2,0,2,0,18,0,40,0,0,0,76,0,76,0,23,0,4,0,0,0,1,0,8,0,1,0,
+134,0,9,0,24,0,34,0,44,0,54,0,64,0,74,0,88,0,110,0,122,0,1,0,4,0,103,0,2,
+0,43,0,1,0,4,0,111,0,2,0,43,0,1,0,4,0,122,0,2,0,43,0,1,0,4,0,127,0,2,0,43,
+0,1,0,4,0,135,0,2,0,43,0,1,0,4,0,147,0,4,0,52,0,31,0,43,0,2,0,6,0,12,0,146,
+0,2,0,43,0,147,0,4,0,52,0,31,0,43,0,1,0,4,0,147,0,3,0,31,0,43,0,1,0,4,0,147,
+0,3,0,31,0,43,0,1,0,9,0,19,0,23,0,28,0,30,0,33,0,37,0,39,0,96,0,98,0,4,0,
+0,0,1,0,8,0,1,1,146,0,19,0,44,0,62,0,80,0,98,0,116,0,142,0,160,0,178,0,196,
+0,214,0,232,0,250,1,12,1,30,1,48,1,74,1,92,1,110,1,136,0,2,0,6,0,12,0,101,
+0,2,0,44,0,102,0,2,0,45,0,2,0,6,0,12,0,104,0,2,0,44,0,105,0,2,0,45,0,2,0,
+6,0,12,0,106,0,2,0,44,0,107,0,2,0,45,0,2,0,6,0,12,0,108,0,2,0,44,0,109,0,
+2,0,45,0,3,0,8,0,14,0,20,0,110,0,2,0,42,0,112,0,2,0,44,0,113,0,2,0,45,0,2,
+0,6,0,12,0,114,0,2,0,44,0,115,0,2,0,45,0,2,0,6,0,12,0,116,0,2,0,44,0,117,
+0,2,0,45,0,2,0,6,0,12,0,118,0,2,0,44,0,119,0,2,0,45,0,2,0,6,0,12,0,120,0,
+2,0,44,0,121,0,2,0,45,0,2,0,6,0,12,0,123,0,2,0,44,0,124,0,2,0,45,0,2,0,6,
+0,12,0,125,0,2,0,44,0,126,0,2,0,45,0,2,0,6,0,12,0,128,0,2,0,44,0,129,0,2,
+0,45,0,2,0,6,0,12,0,130,0,2,0,44,0,131,0,2,0,45,0,2,0,6,0,12,0,132,0,2,0,
+44,0,133,0,2,0,45,0,3,0,8,0,14,0,20,0,134,0,2,0,42,0,136,0,2,0,44,0,137,0,
+2,0,45,0,2,0,6,0,12,0,138,0,2,0,44,0,139,0,2,0,45,0,2,0,6,0,12,0,140,0,2,
+0,44,0,141,0,2,0,45,0,3,0,8,0,14,0,20,0,142,0,2,0,43,0,143,0,2,0,44,0,144,
+0,2,0,45,0,1,0,4,0,145,0,2,0,42,0,2,0,3,0,18,0,20,0,0,0,22,0,36,0,3,0,39,
+0,39,0,18,0,6,0,0,0,1,0,8,0,2,0,16,0,22,0,98,0,106,0,2,0,0,0,114,0,1,0,1,
+0,42,0,2,0,12,0,18,0,18,0,1,0,19,0,19,0,3,0,20,0,20,0,2,0,22,0,22,0,1,0,25,
+0,26,0,1,0,28,0,28,0,3,0,30,0,30,0,3,0,32,0,32,0,2,0,36,0,36,0,3,0,38,0,38,
+0,1,0,40,0,40,0,2,0,76,0,76,0,1,0,1,0,42,0,1,0,1,0,1,0,1,0,1,0,1,0,3,0,8,
+0,22,0,36,0,1,0,1,0,1,0,0,0,1,0,0,0,6,0,1,0,2,0,1,0,0,0,1,0,0,0,5,0,1,0,3,
+0,1,0,0,0,1,0,0,0,7,0,1,0,0,0,1,0,8,0,1,0,6,0,108,0,1,0,1,0,42,0,1,0,0,0,
+1,0,8,0,1,0,6,0,107,0,1,0,1,0,42,0,1,0,0,0,1,0,8,0,1,0,6,0,106,0,1,0,1,0,
+42,0,6,0,0,0,1,0,8,0,2,0,16,0,24,0,40,0,50,0,2,0,0,0,58,0,1,0,2,0,44,0,45,
+0,2,0,2,0,38,0,38,0,1,0,76,0,76,0,1,0,1,0,44,0,2,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,9,0,1,0,0,0,1,0,8,0,1,0,6,0,107,0,1,0,2,
+0,44,0,45,0,4,0,0,0,1,0,8,0,1,1,38,0,24,0,54,0,64,0,74,0,84,0,94,0,104,0,
+114,0,124,0,134,0,144,0,154,0,164,0,174,0,184,0,194,0,204,0,214,0,224,0,234,
+0,244,0,254,1,8,1,18,1,28,0,1,0,4,0,77,0,2,0,52,0,1,0,4,0,78,0,2,0,52,0,1,
+0,4,0,79,0,2,0,52,0,1,0,4,0,80,0,2,0,52,0,1,0,4,0,81,0,2,0,52,0,1,0,4,0,82,
+0,2,0,52,0,1,0,4,0,83,0,2,0,52,0,1,0,4,0,84,0,2,0,52,0,1,0,4,0,85,0,2,0,52,
+0,1,0,4,0,86,0,2,0,52,0,1,0,4,0,87,0,2,0,52,0,1,0,4,0,88,0,2,0,52,0,1,0,4,
+0,89,0,2,0,52,0,1,0,4,0,90,0,2,0,52,0,1,0,4,0,91,0,2,0,52,0,1,0,4,0,92,0,
+2,0,52,0,1,0,4,0,93,0,2,0,52,0,1,0,4,0,94,0,2,0,52,0,1,0,4,0,95,0,2,0,52,
+0,1,0,4,0,96,0,2,0,52,0,1,0,4,0,97,0,2,0,52,0,1,0,4,0,98,0,2,0,52,0,1,0,4,
+0,99,0,2,0,52,0,1,0,4,0,100,0,2,0,52,0,2,0,2,0,18,0,40,0,0,0,76,0,76,0,23,
+0,1,0,0,0,1,0,8,0,1,0,6,0,41,0,2,0,1,0,168,0,170,0,0,0,1,0,0,0,1,0,8,0,1,
+0,6,0,44,0,2,0,1,0,168,0,170,0,0,};
+#endif
@@ -0,0 +1,4613 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansTelugu_Regular_ttf_size = 114240;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansTelugu_Regular_ttf");
+asm(".type fz_font_NotoSansTelugu_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansTelugu_Regular_ttf, 114240");
+asm(".balign 64");
+asm("fz_font_NotoSansTelugu_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansTelugu-Regular.ttf\"");
+#else
+const int fz_font_NotoSansTelugu_Regular_ttf_size = 114240;
+const char fz_font_NotoSansTelugu_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,22,12,47,156,0,1,94,108,0,0,7,80,
+71,80,79,83,116,137,250,91,0,1,101,188,0,0,51,156,71,83,85,66,117,12,49,223,
+0,1,153,88,0,0,36,230,79,83,47,50,121,114,104,194,0,0,1,104,0,0,0,96,99,109,
+97,112,255,9,243,124,0,0,13,176,0,0,1,68,103,97,115,112,0,7,0,7,0,1,94,96,
+0,0,0,12,103,108,121,102,211,105,66,203,0,0,20,236,0,1,67,84,104,101,97,100,
+1,196,232,114,0,0,0,236,0,0,0,54,104,104,101,97,10,173,5,13,0,0,1,36,0,0,
+0,36,104,109,116,120,0,91,59,43,0,0,1,200,0,0,11,230,108,111,99,97,10,121,
+180,181,0,0,14,244,0,0,5,246,109,97,120,112,3,23,1,64,0,0,1,72,0,0,0,32,110,
+97,109,101,140,109,184,179,0,1,88,64,0,0,6,0,112,111,115,116,255,105,0,102,
+0,1,94,64,0,0,0,32,0,1,0,0,0,1,12,205,132,185,194,160,95,15,60,245,0,11,8,
+0,0,0,0,0,204,198,199,109,0,0,0,0,210,40,204,5,245,183,252,65,13,255,6,244,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,6,244,252,35,0,0,14,29,245,183,247,211,13,
+255,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,249,0,1,0,0,2,250,0,150,0,10,0,168,
+0,14,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,4,6,88,1,144,0,5,0,0,5,154,5,51,
+0,0,1,79,5,154,5,51,0,0,2,111,0,102,2,118,0,0,2,11,5,2,4,5,4,2,2,4,0,32,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,6,244,252,35,0,0,6,
+244,3,221,0,0,0,1,0,0,0,0,3,255,4,245,0,0,0,32,0,3,4,205,0,193,0,0,0,0,2,
+68,0,0,2,68,0,0,2,99,0,67,4,14,0,67,2,95,0,58,6,103,0,73,6,99,0,73,5,131,
+0,60,7,243,0,62,6,85,0,72,8,183,0,72,11,138,0,73,7,14,0,60,5,177,0,60,5,177,
+0,60,5,209,0,73,5,217,0,73,5,217,0,73,5,217,0,40,4,41,0,34,6,11,0,60,4,169,
+0,82,8,118,0,60,5,217,0,73,6,20,0,52,6,20,0,52,5,217,0,73,10,73,0,72,7,212,
+0,60,6,42,0,78,4,191,0,72,5,236,0,72,5,236,0,72,6,156,0,68,6,58,0,73,5,166,
+0,72,5,166,0,72,5,166,0,72,5,157,0,60,5,177,0,60,5,177,0,60,6,0,0,73,6,0,
+0,73,8,118,0,60,10,73,0,72,4,191,0,72,6,143,0,73,5,172,0,72,5,41,0,60,5,177,
+0,60,4,102,0,60,5,177,0,60,5,157,0,60,8,68,0,60,4,184,0,73,2,122,251,122,
+0,0,252,173,0,0,252,173,2,197,255,70,5,88,255,70,3,52,254,245,5,64,254,245,
+0,0,251,108,0,0,251,108,0,0,251,81,2,122,252,91,2,122,252,91,2,122,252,79,
+0,0,253,24,0,0,253,153,0,0,251,92,6,20,0,52,5,217,0,73,14,29,0,73,9,209,0,
+60,0,0,251,98,2,151,251,98,5,102,0,100,5,82,0,100,6,47,0,30,4,95,0,28,5,125,
+0,85,5,176,0,41,5,149,0,95,4,150,0,88,6,109,0,100,5,149,0,95,4,250,0,90,2,
+47,0,190,3,234,0,135,5,140,0,135,4,226,0,66,4,200,0,95,4,200,0,95,5,240,0,
+95,0,0,0,0,0,0,255,202,0,0,254,213,4,160,0,186,4,41,0,34,4,41,0,34,6,11,0,
+60,4,169,0,82,8,118,0,60,5,217,0,73,6,20,0,52,6,20,0,52,5,217,0,73,10,73,
+0,72,7,212,0,60,6,42,0,78,4,191,0,72,5,236,0,72,5,236,0,72,6,156,0,68,6,58,
+0,73,5,166,0,72,5,166,0,72,5,166,0,72,5,157,0,60,5,177,0,60,5,177,0,60,6,
+0,0,73,6,0,0,73,8,118,0,60,10,73,0,72,4,191,0,72,6,143,0,73,5,172,0,72,5,
+41,0,60,5,177,0,60,4,102,0,60,5,177,0,60,5,157,0,60,8,68,0,60,4,41,0,34,6,
+237,0,34,8,158,0,60,7,85,0,75,11,9,0,60,8,75,0,73,8,211,0,52,8,211,0,52,8,
+95,0,73,12,220,0,72,10,118,0,60,8,189,0,78,7,113,0,72,8,31,0,72,8,31,0,72,
+9,82,0,68,8,200,0,73,8,72,0,72,8,72,0,72,8,72,0,72,8,92,0,60,8,92,0,60,8,
+92,0,60,8,147,0,73,8,147,0,73,11,9,0,60,12,220,0,72,7,113,0,72,9,72,0,73,
+8,97,0,72,7,252,0,60,8,92,0,60,7,14,0,60,8,92,0,60,8,92,0,60,8,68,0,60,6,
+237,0,34,4,41,0,34,6,69,0,60,4,169,0,82,8,118,0,60,5,217,0,73,6,32,0,52,6,
+32,0,52,5,217,0,73,10,73,0,72,7,212,0,60,6,42,0,78,4,191,0,72,5,236,0,72,
+5,236,0,72,6,156,0,68,6,74,0,73,5,166,0,72,5,166,0,72,5,166,0,72,5,157,0,
+60,5,177,0,60,5,177,0,60,6,44,0,73,6,44,0,73,8,118,0,60,10,73,0,72,4,191,
+0,72,6,143,0,73,5,221,0,72,5,102,0,60,5,177,0,60,4,102,0,60,5,177,0,60,5,
+157,0,60,8,68,0,60,4,41,0,34,4,41,0,34,6,69,0,60,4,169,0,82,8,118,0,60,5,
+217,0,73,6,32,0,52,6,32,0,52,5,217,0,73,10,73,0,72,7,212,0,60,6,42,0,78,4,
+191,0,72,5,236,0,72,5,236,0,72,6,156,0,68,6,74,0,73,5,166,0,72,5,166,0,72,
+5,166,0,72,5,157,0,60,5,177,0,60,5,177,0,60,6,44,0,73,6,44,0,73,8,118,0,60,
+12,220,0,72,4,191,0,72,6,143,0,73,5,221,0,72,5,102,0,60,5,177,0,60,4,102,
+0,60,5,177,0,60,5,157,0,60,8,68,0,60,4,41,0,34,7,191,0,73,7,252,0,60,7,252,
+0,60,7,252,0,60,10,131,0,73,10,120,0,60,10,120,0,60,10,120,0,60,4,41,0,34,
+6,11,0,60,4,169,0,82,8,118,255,226,5,217,0,73,6,20,0,52,6,20,0,52,5,217,0,
+73,10,73,0,72,7,212,0,60,6,42,0,78,4,191,0,72,5,236,0,72,5,236,0,72,6,156,
+0,68,6,58,0,73,5,166,0,72,5,166,0,72,5,166,0,72,5,157,0,60,5,177,255,226,
+5,177,255,226,6,0,0,73,6,0,0,73,8,118,0,60,10,73,0,72,4,191,0,72,6,143,0,
+73,5,172,0,72,5,41,0,60,5,177,0,60,4,102,0,60,5,177,255,226,5,157,255,226,
+8,68,255,226,4,41,0,34,4,41,0,34,6,11,0,60,4,169,0,82,8,118,255,226,5,217,
+0,73,6,20,0,52,6,20,0,52,5,217,0,73,10,73,0,72,7,212,0,60,6,42,0,78,4,191,
+0,72,5,236,0,72,5,236,0,72,6,156,0,68,6,58,0,73,5,166,0,72,5,166,0,72,5,166,
+0,72,5,157,0,60,5,177,255,226,5,177,255,226,6,0,0,73,6,0,0,73,8,118,0,60,
+10,73,0,72,4,191,0,72,6,143,0,73,5,172,0,72,5,41,0,60,5,177,0,60,4,102,0,
+60,5,177,255,226,5,157,255,226,8,68,255,226,4,41,0,34,4,41,0,11,6,11,0,60,
+4,169,0,75,8,118,255,226,5,217,0,73,6,20,0,52,6,20,0,52,5,217,0,73,10,73,
+0,72,7,212,0,60,6,42,0,78,4,191,0,72,5,236,0,72,5,236,0,47,6,156,0,68,6,58,
+0,73,5,166,0,72,5,166,0,72,5,166,0,72,5,157,0,60,5,177,255,226,5,177,255,
+226,6,0,0,73,6,0,0,73,8,118,0,60,10,73,0,72,4,191,0,72,6,143,0,73,5,172,0,
+72,5,41,0,60,5,177,0,60,4,102,0,42,5,177,255,226,5,157,255,226,8,68,255,226,
+4,41,0,11,6,63,0,34,8,34,0,60,6,115,0,82,11,59,255,226,8,23,0,73,7,194,0,
+52,7,194,0,52,8,54,0,73,13,14,0,72,10,40,0,60,8,75,0,78,6,129,0,72,7,84,0,
+72,7,84,0,72,8,144,0,68,8,7,0,73,7,11,0,72,7,11,0,72,7,11,0,72,7,68,0,60,
+8,36,0,60,8,36,0,60,8,32,0,73,8,32,0,73,11,59,0,60,13,14,0,72,6,129,0,72,
+8,195,0,73,8,59,0,72,7,131,0,60,7,87,0,60,6,253,0,60,8,36,0,60,8,36,0,60,
+10,216,0,60,6,63,0,34,6,63,0,34,8,34,0,60,6,115,0,82,11,9,255,226,8,23,0,
+73,7,194,0,52,7,194,0,52,8,54,0,73,12,220,0,72,10,40,0,60,8,75,0,78,6,129,
+0,72,7,84,0,72,7,84,0,72,8,144,0,68,8,7,0,73,7,11,0,72,7,11,0,72,7,11,0,72,
+7,68,0,60,8,36,0,60,8,36,0,60,8,32,0,73,8,32,0,73,11,9,0,60,12,220,0,72,6,
+129,0,72,8,195,0,73,8,59,0,72,7,131,0,60,7,87,0,60,6,253,0,60,8,36,0,60,8,
+36,0,60,10,216,0,60,6,63,0,34,6,63,0,34,8,34,0,60,6,115,0,82,10,141,0,60,
+8,23,0,73,7,194,0,52,7,194,0,52,8,54,0,73,12,96,0,72,10,40,0,60,8,75,0,78,
+6,129,0,72,7,84,0,72,7,84,0,72,8,144,0,68,8,7,0,73,7,11,0,72,7,11,0,72,7,
+11,0,72,7,68,0,60,8,6,0,60,8,6,0,60,8,32,0,73,8,32,0,73,10,141,0,60,12,81,
+0,72,6,129,0,72,8,195,0,73,8,59,0,72,7,171,0,60,7,87,0,60,6,216,0,60,8,6,
+0,60,8,6,0,60,10,216,0,60,6,63,0,34,3,221,255,178,0,0,251,193,0,0,252,214,
+0,0,250,83,0,0,251,219,3,64,254,107,3,64,254,107,0,0,251,219,0,0,250,67,0,
+0,250,245,0,0,251,184,0,0,252,193,0,0,251,215,0,0,251,215,0,0,251,96,0,0,
+251,19,0,0,252,19,0,0,252,19,0,0,252,19,2,196,254,148,3,64,254,143,3,64,254,
+143,3,82,254,156,3,82,254,156,2,18,254,254,3,170,255,179,3,92,0,3,0,0,251,
+98,0,0,251,164,3,62,255,24,3,170,255,7,2,75,254,151,0,0,251,207,3,64,254,
+155,0,0,250,108,2,207,254,184,2,247,254,221,3,1,254,249,5,97,254,184,5,137,
+254,221,5,147,254,249,4,55,0,30,4,18,0,30,2,253,0,30,5,203,0,30,3,248,0,30,
+4,241,0,30,4,241,0,30,3,248,0,30,5,219,0,30,5,41,0,30,4,27,0,30,3,18,0,30,
+3,252,0,30,3,252,0,30,4,115,0,30,2,68,253,117,3,192,0,30,3,192,0,30,3,192,
+0,30,4,68,0,30,4,205,0,30,4,205,0,30,4,202,0,30,4,232,0,30,3,59,0,39,4,21,
+0,30,4,113,0,30,4,47,0,30,4,58,0,30,4,193,0,30,3,210,0,30,4,69,0,30,4,193,
+0,30,5,178,0,30,4,89,0,30,6,105,0,30,4,214,0,30,7,83,0,30,0,0,251,215,0,0,
+249,245,0,0,251,87,0,0,247,138,0,0,250,39,0,0,249,236,0,0,249,236,0,0,250,
+39,0,0,245,183,0,0,248,44,0,0,249,214,0,0,251,65,0,0,250,20,0,0,250,20,0,
+0,249,100,0,0,249,198,0,0,250,90,0,0,250,90,0,0,250,90,0,0,250,99,0,0,250,
+79,0,0,250,79,0,0,250,0,0,0,250,0,0,0,247,138,0,0,245,183,0,0,251,65,0,0,
+249,113,0,0,250,84,0,0,250,215,0,0,250,79,0,0,251,154,0,0,250,79,0,0,250,
+99,0,0,247,188,0,0,248,4,0,0,251,197,0,0,249,211,0,0,251,19,0,0,251,82,0,
+0,250,127,0,0,248,199,0,0,250,143,0,0,251,83,0,0,249,35,0,0,250,179,0,0,250,
+251,0,0,250,233,0,0,250,141,0,0,250,251,0,0,250,251,0,0,250,251,0,0,251,29,
+0,0,250,152,0,0,249,131,0,0,250,97,0,0,251,213,0,0,251,219,0,0,251,184,0,
+0,251,215,0,0,252,19,0,0,251,164,4,134,0,63,2,99,0,177,3,165,0,173,5,43,0,
+51,6,166,0,100,2,61,0,173,2,220,0,100,2,220,0,81,4,104,0,114,4,147,0,102,
+2,37,0,84,2,147,0,82,2,37,0,147,3,124,0,60,4,147,0,100,4,147,0,180,4,147,
+0,98,4,147,0,92,4,147,0,43,4,147,0,129,4,147,0,113,4,147,0,90,4,147,0,100,
+4,147,0,102,2,37,0,72,2,37,0,63,4,147,0,102,4,147,0,115,4,147,0,102,3,222,
+0,105,2,192,0,164,3,124,0,60,2,192,0,81,4,147,0,78,3,141,255,252,3,10,0,57,
+4,104,1,225,3,10,0,65,4,147,0,102,2,147,0,82,4,0,0,82,8,0,0,82,2,5,0,102,
+2,5,0,102,3,135,0,102,3,135,0,102,6,84,0,147,4,147,0,131,4,147,0,102,4,147,
+0,102,4,147,0,147,3,8,1,142,4,202,1,142,4,41,0,34,6,11,0,60,4,169,0,82,8,
+118,0,60,8,118,0,60,11,9,0,60,11,59,0,60,6,20,0,52,6,20,0,52,6,20,0,52,6,
+20,0,52,5,217,0,73,10,73,0,72,10,73,0,72,12,220,0,72,13,14,0,72,6,42,0,78,
+4,191,0,72,5,236,0,72,5,236,0,72,6,58,0,73,5,166,0,72,5,166,0,72,5,166,0,
+72,5,157,0,60,5,157,0,60,5,177,0,60,5,177,0,60,5,177,0,60,5,177,0,60,5,177,
+0,60,5,177,0,60,6,0,0,73,6,0,0,73,6,0,0,73,8,118,0,60,8,118,0,60,11,9,0,60,
+11,59,0,60,11,9,0,60,8,118,0,60,10,73,0,72,10,73,0,72,12,220,0,72,13,14,0,
+72,4,191,0,72,5,172,0,72,5,41,0,60,5,177,0,60,5,177,0,60,4,102,0,60,5,177,
+0,60,5,177,0,60,5,177,0,60,5,157,0,60,5,157,0,60,5,157,0,60,8,68,0,60,3,24,
+255,213,0,0,2,229,8,92,0,199,7,252,0,60,7,252,0,60,7,252,0,60,10,120,0,60,
+10,120,0,60,10,120,0,60,8,6,0,199,0,0,0,23,0,0,251,255,0,0,0,27,0,0,0,29,
+0,0,251,205,8,36,0,137,8,36,0,137,2,122,252,181,2,122,252,181,2,122,252,41,
+2,122,252,41,0,0,255,226,0,0,252,2,0,0,251,188,0,0,251,28,0,0,251,138,0,0,
+252,130,0,0,255,226,0,0,252,2,0,0,251,188,0,0,251,28,0,0,251,138,0,0,252,
+130,0,0,251,212,0,0,250,238,0,0,250,58,7,243,0,62,5,217,0,40,4,41,0,37,0,
+11,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,56,0,0,0,72,0,64,0,5,0,8,0,0,0,13,0,
+35,0,37,0,63,0,95,0,126,0,160,0,173,0,215,0,247,9,101,12,3,12,12,12,16,12,
+40,12,51,12,57,12,68,12,72,12,77,12,86,12,89,12,99,12,111,12,127,32,13,32,
+20,32,25,32,29,32,38,32,185,34,18,37,204,254,255,255,255,0,0,0,0,0,13,0,32,
+0,37,0,39,0,91,0,123,0,160,0,173,0,215,0,247,9,100,12,1,12,5,12,14,12,18,
+12,42,12,53,12,61,12,70,12,74,12,85,12,88,12,96,12,102,12,120,32,11,32,19,
+32,24,32,28,32,38,32,185,34,18,37,204,254,255,255,255,0,1,255,245,0,0,2,66,
+2,65,2,38,2,11,255,99,1,221,1,187,1,156,249,50,244,3,244,2,244,1,244,0,243,
+255,243,254,243,251,243,250,243,249,243,242,243,241,243,235,243,233,243,225,
+224,86,226,120,226,117,226,115,226,107,225,220,224,130,218,152,1,98,0,1,0,
+0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+2,100,2,101,2,102,0,0,0,21,0,21,0,21,0,21,0,51,0,97,0,167,0,249,1,90,1,184,
+1,199,2,46,2,210,3,99,3,196,4,16,4,117,4,210,5,45,5,162,5,173,5,185,6,53,
+6,65,6,77,6,183,6,195,6,207,7,68,7,80,7,191,8,32,8,44,8,56,8,68,8,177,8,189,
+8,201,8,213,8,225,8,237,8,249,9,5,9,103,9,115,9,127,9,139,9,151,10,0,10,74,
+10,86,10,98,10,110,10,122,10,134,10,146,10,211,10,254,11,51,11,125,11,159,
+11,228,12,45,12,151,12,188,12,246,13,1,13,78,13,176,13,241,14,41,14,78,14,
+125,14,255,15,11,15,188,16,59,16,143,17,3,17,51,17,98,17,164,17,223,18,36,
+18,110,18,171,18,242,19,38,19,98,19,162,19,174,19,209,20,9,20,28,20,84,20,
+184,20,243,20,243,21,0,21,30,21,130,21,145,21,157,22,61,22,73,22,85,22,97,
+22,207,23,69,23,229,23,241,23,253,24,131,24,143,24,155,24,167,24,179,25,65,
+25,77,25,89,25,101,25,213,25,225,25,237,26,116,27,3,27,143,28,28,28,40,28,
+52,28,165,29,52,29,166,30,38,30,50,30,62,30,74,30,89,30,194,31,93,31,178,
+31,190,31,201,32,46,32,155,33,45,33,57,33,69,33,198,34,38,34,155,35,24,35,
+170,36,48,36,168,37,11,37,117,37,220,37,231,37,242,38,116,38,253,39,9,39,
+21,39,103,39,242,40,93,40,225,41,74,41,192,41,203,41,214,42,119,42,130,42,
+142,43,38,43,113,43,125,43,137,43,237,44,88,44,230,45,109,45,121,45,133,45,
+222,45,234,45,246,46,2,46,139,46,250,47,84,47,182,48,29,48,41,48,53,48,184,
+49,66,49,198,50,43,50,117,50,129,50,236,51,113,51,216,52,77,52,89,52,101,
+52,113,52,128,52,140,53,59,53,158,53,170,53,182,54,48,54,178,55,87,55,252,
+56,8,56,20,56,140,56,152,56,164,56,176,57,80,57,213,58,70,58,190,59,60,59,
+72,59,84,59,236,60,140,61,39,61,177,62,26,62,38,62,167,63,67,63,193,64,77,
+64,89,64,101,64,113,64,128,65,16,65,28,65,40,65,52,65,228,65,240,65,252,66,
+8,66,20,66,32,66,44,66,55,66,67,66,79,66,91,66,103,66,115,66,127,66,139,66,
+151,66,163,66,175,66,187,66,199,66,211,66,223,66,235,66,247,67,2,67,13,67,
+25,67,37,67,49,67,61,67,73,67,85,67,97,67,109,67,121,67,133,67,144,67,155,
+67,166,67,181,67,193,67,205,67,217,67,228,67,240,67,252,68,8,68,20,68,32,
+68,44,68,56,68,68,68,80,68,92,68,104,68,116,68,128,68,140,68,152,68,164,68,
+175,68,186,68,198,68,210,68,222,68,234,68,246,69,2,69,14,69,26,69,38,69,50,
+69,61,69,72,69,83,69,98,69,114,69,130,69,146,69,161,69,177,69,193,69,209,
+69,225,69,241,70,1,70,17,70,33,70,49,70,65,70,81,70,97,70,113,70,129,70,145,
+70,161,70,176,70,191,70,207,70,223,70,239,70,255,71,15,71,31,71,47,71,63,
+71,79,71,95,71,110,71,125,71,140,71,158,71,170,72,100,72,112,72,123,72,135,
+73,13,73,154,74,78,74,90,74,102,75,6,75,18,75,30,75,42,75,54,75,217,75,229,
+75,241,75,253,76,132,76,143,76,154,77,59,77,228,77,240,77,252,78,8,78,20,
+78,161,79,71,79,209,80,108,80,119,80,130,80,146,80,161,80,173,81,123,81,135,
+81,146,81,158,82,57,82,219,83,163,83,175,83,187,84,112,84,124,84,136,84,148,
+84,160,85,88,85,100,85,112,85,124,86,25,86,36,86,47,86,229,87,163,87,175,
+87,187,87,199,87,211,88,118,89,50,89,208,90,128,90,139,90,150,90,166,90,181,
+90,193,90,205,90,217,90,233,90,245,91,1,91,13,91,25,91,41,91,53,91,65,91,
+77,91,89,91,101,91,113,91,125,91,137,91,149,91,161,91,173,91,184,91,195,91,
+207,91,219,91,235,91,251,92,7,92,19,92,31,92,43,92,55,92,67,92,78,92,89,92,
+105,92,120,92,187,93,44,93,84,93,182,94,17,94,79,94,148,95,1,95,96,95,201,
+96,25,96,82,96,160,96,249,97,93,97,142,97,223,98,24,98,88,98,175,98,249,99,
+74,99,174,100,24,100,116,100,226,101,32,101,128,101,190,102,33,102,136,102,
+218,103,54,103,117,103,217,103,252,104,40,104,81,104,151,104,221,105,41,105,
+50,105,59,105,68,105,77,105,86,105,95,105,104,105,113,105,122,105,131,105,
+140,105,149,105,158,105,167,105,176,105,219,105,228,105,237,105,246,105,255,
+106,8,106,17,106,26,106,35,106,44,106,53,106,62,106,71,106,80,106,89,106,
+98,106,107,106,116,106,125,106,134,106,143,106,152,106,161,106,204,106,248,
+107,35,107,81,107,125,107,169,107,177,107,185,107,231,108,21,108,66,108,109,
+108,153,108,161,108,206,108,251,109,39,109,47,109,55,109,99,109,143,109,151,
+109,195,109,203,109,211,109,219,109,227,110,16,110,60,110,103,110,111,110,
+154,110,199,110,207,110,253,111,41,111,90,111,139,111,185,112,17,112,105,
+112,193,113,95,113,173,114,50,114,198,115,59,115,173,116,51,116,168,117,7,
+117,107,117,201,118,71,118,206,119,22,119,180,120,33,120,114,120,192,120,
+249,121,56,121,114,121,144,121,172,121,231,122,54,122,75,122,115,122,155,
+122,196,122,226,122,250,123,13,123,35,123,59,123,103,123,129,123,178,123,
+238,124,22,124,68,124,129,124,148,124,224,125,27,125,71,125,112,125,139,125,
+165,125,191,125,252,126,24,126,48,126,76,126,103,126,120,126,172,126,194,
+126,248,127,36,127,44,127,63,127,82,127,106,127,131,127,167,127,204,128,1,
+128,40,128,88,128,107,128,157,128,182,128,213,129,23,129,147,129,198,130,
+50,130,158,131,44,131,178,131,245,132,59,132,134,132,212,133,79,133,188,134,
+41,134,187,135,66,135,164,135,228,136,57,136,150,136,248,137,78,137,144,137,
+217,138,32,138,104,138,173,139,4,139,92,139,169,140,8,140,104,140,202,141,
+52,141,158,142,2,142,99,142,236,143,108,143,247,144,92,144,199,145,44,145,
+179,146,50,146,99,146,175,147,21,147,91,147,165,147,254,148,94,148,202,149,
+55,149,127,149,215,150,47,150,152,150,196,150,245,151,33,151,142,152,3,152,
+122,153,10,153,162,154,63,154,129,154,194,155,3,155,68,155,133,155,198,156,
+18,156,115,156,192,157,34,157,111,157,209,157,246,158,27,158,64,158,101,158,
+139,158,176,158,234,159,36,159,94,159,152,159,211,160,13,160,60,160,107,160,
+154,160,229,161,38,161,117,161,170,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,
+0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,
+104,4,230,0,0,2,0,67,255,230,2,65,3,255,0,15,0,16,0,0,1,34,6,21,20,22,51,
+21,35,34,36,53,52,36,51,51,39,2,65,164,177,176,165,5,233,254,240,1,17,230,
+7,242,2,208,153,143,140,154,156,245,207,207,243,147,0,3,0,67,255,230,3,202,
+3,255,0,14,0,26,0,27,0,0,1,50,22,22,21,20,6,35,34,38,38,53,52,54,54,19,50,
+54,53,52,38,35,34,6,21,20,22,19,2,6,129,208,115,251,201,128,207,116,116,206,
+129,133,151,155,129,128,154,150,149,3,108,116,209,127,198,252,112,210,128,
+127,208,117,253,27,160,130,128,162,161,129,129,161,3,120,0,4,0,58,255,230,
+2,37,3,255,0,11,0,23,0,35,0,47,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,50,
+54,53,52,38,35,34,6,21,20,22,23,50,22,21,20,6,35,34,38,53,52,54,19,50,54,
+53,52,38,35,34,6,21,20,22,1,47,109,137,137,109,109,136,138,107,51,61,61,51,
+50,60,59,51,109,137,137,109,109,136,138,107,51,61,61,51,50,60,59,3,255,136,
+104,104,134,134,104,104,136,254,164,59,51,48,60,60,48,50,60,223,136,104,104,
+134,134,104,104,136,254,164,59,51,48,60,60,48,50,60,0,2,0,73,255,230,6,30,
+3,255,0,44,0,55,0,0,1,21,33,53,33,38,53,52,54,51,50,22,22,21,16,0,33,34,36,
+2,53,52,54,51,50,22,21,20,6,35,34,39,22,4,51,32,36,53,52,38,35,34,6,21,20,
+37,22,51,50,54,53,52,38,35,34,6,4,229,253,136,1,147,124,158,138,101,172,97,
+254,119,254,137,226,254,184,171,216,172,123,147,166,152,93,85,13,1,41,253,
+1,50,1,37,112,98,54,71,252,205,69,91,83,83,65,53,80,109,2,13,148,152,80,157,
+108,149,112,205,125,254,215,254,202,143,1,10,176,213,251,140,119,133,150,
+47,183,210,219,230,126,161,72,61,148,83,48,68,63,57,65,104,0,3,0,73,255,230,
+6,32,3,255,0,42,0,53,0,65,0,0,1,6,35,33,53,33,38,38,53,52,54,51,50,22,21,
+20,7,22,21,20,4,33,32,0,17,52,54,51,50,22,21,20,6,35,34,39,22,4,33,50,36,
+53,52,1,22,51,50,54,53,52,38,35,34,6,5,54,53,52,38,35,34,6,21,20,22,23,5,
+63,88,128,254,6,1,253,90,97,168,133,153,171,101,69,254,176,254,179,254,127,
+254,103,216,172,123,147,166,152,93,85,13,1,67,1,40,237,1,7,251,156,69,91,
+83,83,65,53,80,109,4,42,71,81,69,66,78,101,115,1,163,42,152,35,126,84,112,
+137,162,129,133,97,65,90,182,191,1,51,1,22,213,251,140,119,133,150,47,191,
+202,115,100,37,1,30,48,68,63,57,65,104,194,63,89,65,80,62,52,56,86,38,0,2,
+0,60,255,57,5,58,3,255,0,54,0,66,0,0,19,38,53,52,54,51,50,22,23,54,51,50,
+22,21,20,6,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,23,
+54,54,53,52,38,35,34,6,7,35,38,35,34,6,21,20,23,1,38,38,35,34,6,21,20,22,
+51,50,54,103,43,176,134,108,140,51,102,204,162,201,70,70,49,36,150,29,14,
+97,230,134,208,216,212,195,157,254,96,32,32,106,102,80,113,19,159,38,175,
+72,77,31,2,235,69,211,128,117,121,135,137,115,187,2,67,86,96,116,146,86,90,
+176,237,199,110,191,80,101,106,110,88,31,71,105,52,47,67,66,151,145,132,149,
+104,104,49,116,68,141,145,110,101,220,67,59,63,58,254,125,79,81,69,58,72,
+70,54,0,255,255,0,62,255,206,7,181,6,244,2,34,2,246,0,0,0,34,2,197,118,0,
+0,3,2,210,1,156,0,0,0,5,0,72,255,230,6,33,4,244,0,33,0,50,0,63,0,64,0,65,
+0,0,1,7,22,22,23,7,38,38,35,34,6,7,33,21,33,22,22,21,20,6,35,34,38,39,6,6,
+35,34,38,53,16,0,37,39,1,33,6,21,20,22,51,50,54,55,51,22,23,38,53,52,54,19,
+22,51,50,54,53,52,38,35,34,6,21,20,3,1,3,86,12,122,237,114,100,116,204,123,
+163,241,64,4,241,254,222,88,89,186,151,143,194,60,48,146,122,150,184,1,67,
+1,32,13,1,117,252,231,9,94,95,91,112,10,159,9,88,20,82,99,30,36,85,81,69,
+65,65,71,237,1,125,4,244,247,6,76,70,138,76,62,112,106,148,28,128,88,130,
+155,84,92,85,91,227,192,1,7,1,77,29,250,253,3,51,56,131,130,125,116,147,54,
+53,48,87,114,254,165,2,71,65,58,63,68,64,67,3,69,254,32,0,5,0,72,255,230,
+8,121,4,244,0,71,0,88,0,100,0,113,0,114,0,0,1,3,22,23,7,38,38,35,34,6,7,33,
+50,23,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,22,22,21,20,6,
+35,34,38,53,52,54,55,33,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,
+3,51,7,54,51,50,23,39,19,33,6,21,20,22,51,50,54,55,51,22,23,38,53,52,54,37,
+6,6,21,20,22,51,50,54,53,52,38,1,22,51,50,54,53,52,38,35,34,6,21,20,19,4,
+10,13,145,149,100,116,204,123,163,241,64,5,151,95,53,56,56,52,49,43,71,44,
+147,55,150,96,117,142,55,54,64,65,157,132,130,151,32,33,254,127,88,89,186,
+151,143,194,60,48,146,122,150,184,223,210,15,184,12,69,54,41,37,13,193,252,
+231,9,94,95,91,112,10,159,9,88,20,82,3,132,56,56,73,65,62,70,79,252,144,30,
+36,85,81,69,65,65,71,144,4,244,254,239,34,92,138,76,62,112,106,7,30,69,39,
+44,54,46,66,58,94,95,120,101,58,100,41,38,124,85,122,144,145,103,51,87,35,
+28,128,88,130,155,84,92,85,91,227,192,217,1,52,65,1,29,252,7,3,248,253,3,
+51,56,131,130,125,116,147,54,53,48,87,114,24,31,80,49,58,66,72,60,69,76,254,
+148,2,71,65,58,63,68,64,67,1,101,0,3,0,73,255,230,11,65,3,255,0,100,0,101,
+0,102,0,0,37,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,
+6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,
+22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,
+18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,39,6,6,35,34,
+1,1,5,128,49,158,109,119,148,57,62,153,133,158,178,140,164,112,70,78,77,88,
+86,21,153,36,179,163,155,167,120,152,126,87,88,83,117,137,11,159,9,123,96,
+109,109,175,184,76,211,242,5,80,158,91,105,110,175,184,76,211,242,5,80,158,
+91,105,110,175,184,76,211,242,206,192,208,159,50,171,121,209,253,64,254,119,
+152,89,89,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,
+84,113,143,149,116,105,137,56,47,86,59,63,70,121,120,114,127,129,130,152,
+234,85,158,92,254,184,198,43,38,98,91,133,126,152,234,85,158,92,254,184,198,
+42,39,98,91,133,126,152,234,85,158,92,254,184,198,206,225,179,90,89,3,127,
+254,80,0,3,0,60,255,103,6,197,3,255,0,62,0,63,0,64,0,0,1,35,38,38,35,34,6,
+21,20,22,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,7,6,6,21,20,
+22,51,50,54,54,53,52,38,39,55,4,17,20,2,4,35,34,38,53,52,54,55,54,54,53,52,
+38,35,34,6,3,1,2,196,159,7,102,80,63,69,23,25,155,61,164,125,98,132,50,55,
+148,103,142,154,56,98,96,46,109,106,123,187,103,126,123,109,1,54,150,254,
+239,165,181,199,74,103,78,46,74,64,94,117,222,3,21,2,109,122,128,67,59,42,
+72,43,49,114,108,116,146,81,94,91,84,150,116,67,138,112,108,104,50,84,86,
+113,214,131,136,215,69,137,184,254,137,177,254,229,157,174,151,80,158,113,
+85,93,44,56,68,132,253,31,3,101,0,0,5,0,60,255,230,5,104,6,244,0,30,0,42,
+0,43,0,44,0,45,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,
+16,0,37,55,4,0,17,20,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,54,19,3,3,
+2,146,71,136,92,141,158,164,125,92,149,123,91,116,83,105,106,254,120,254,
+185,79,1,108,1,190,206,185,98,157,182,72,80,51,60,73,80,68,66,91,85,179,17,
+145,97,74,169,137,130,166,89,159,120,73,137,138,1,4,1,225,144,164,159,253,
+199,254,186,203,228,79,219,95,56,79,67,66,84,75,6,42,253,11,1,19,0,6,0,60,
+255,230,5,104,6,244,0,17,0,48,0,60,0,61,0,62,0,63,0,0,1,38,38,53,52,54,51,
+50,23,7,38,35,34,6,21,20,22,23,19,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,16,0,37,55,4,0,17,20,6,35,34,38,39,38,38,35,34,6,21,20,22,51,
+50,54,19,3,3,1,100,66,57,154,123,79,63,61,32,39,54,65,54,60,143,71,136,92,
+141,158,164,125,92,149,123,91,116,83,105,106,254,120,254,185,79,1,108,1,190,
+206,185,98,157,182,72,80,51,60,73,80,68,66,91,125,179,17,4,25,105,172,81,
+132,162,24,145,12,75,61,72,136,82,252,51,97,74,169,137,130,166,89,159,120,
+73,137,138,1,4,1,225,144,164,159,253,199,254,186,203,228,79,219,95,56,79,
+67,66,84,75,6,42,253,11,1,19,0,2,0,73,255,230,5,136,3,255,0,53,0,65,0,0,19,
+38,53,52,54,51,50,22,23,54,54,51,50,22,22,21,20,2,35,34,38,39,6,6,35,34,38,
+53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,35,34,6,7,35,38,35,34,6,21,20,
+23,1,38,38,35,34,6,21,20,22,51,50,54,109,36,179,141,101,137,51,48,146,123,
+125,187,105,213,188,97,158,80,73,136,90,142,157,164,125,92,149,123,90,111,
+79,116,116,138,123,88,117,19,159,38,175,74,75,21,1,60,72,80,51,60,73,80,68,
+66,91,2,106,65,84,114,142,87,89,84,92,135,255,158,237,254,248,81,90,98,73,
+170,136,130,166,89,159,118,75,172,173,169,213,108,103,220,65,58,34,52,254,
+122,95,56,79,67,66,84,75,0,0,3,0,73,255,230,5,157,3,255,0,60,0,61,0,62,0,
+0,1,51,22,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,
+20,6,7,6,6,21,20,22,51,50,54,39,37,2,176,159,8,123,102,90,97,79,87,109,110,
+117,183,168,114,150,54,62,153,133,158,178,140,164,112,70,78,77,88,86,21,153,
+36,179,163,155,167,120,152,126,87,88,83,117,137,209,2,82,1,120,116,125,80,
+76,69,116,55,137,72,194,95,163,170,86,90,88,88,165,128,116,150,58,40,76,52,
+56,59,67,59,39,47,44,65,84,113,143,149,116,105,137,56,47,86,59,63,70,121,
+181,96,0,0,4,0,73,255,230,5,157,6,244,0,78,0,79,0,80,0,81,0,0,1,51,22,22,
+51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,
+54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,55,38,53,52,54,51,50,22,23,
+7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,39,37,1,
+2,176,159,8,123,102,90,97,79,87,109,110,117,183,168,114,150,54,62,153,133,
+158,178,140,164,112,70,78,77,88,86,21,153,36,77,69,38,161,128,113,149,40,
+156,37,106,61,77,37,21,22,155,167,120,152,126,87,88,83,117,137,209,2,82,253,
+186,1,120,116,125,80,76,69,116,55,137,72,194,95,163,170,86,90,88,88,165,128,
+116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,72,115,32,59,82,104,126,93,
+103,40,101,61,51,48,41,2,149,116,105,137,56,47,86,59,63,70,121,181,96,4,223,
+255,255,0,40,255,230,5,217,5,118,2,34,0,18,0,0,0,2,2,247,0,0,255,255,0,34,
+255,206,4,127,6,244,2,34,2,152,0,0,0,3,2,210,0,230,0,0,0,7,0,60,254,255,6,
+11,3,255,0,51,0,64,0,76,0,80,0,81,0,82,0,83,0,0,37,22,22,51,50,54,53,52,38,
+39,55,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,
+39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,1,38,35,34,6,21,20,22,51,
+50,54,53,52,19,38,38,35,34,6,21,20,22,51,50,54,19,19,51,19,39,33,1,3,22,70,
+128,77,119,120,175,184,76,212,241,224,190,96,167,102,72,168,96,145,154,150,
+128,76,153,95,34,73,3,150,124,120,159,176,143,148,211,111,254,116,38,44,72,
+83,67,61,68,73,75,73,108,57,58,62,78,68,65,106,78,15,154,15,21,3,6,253,82,
+224,47,42,134,125,152,234,85,158,92,254,184,198,200,231,59,70,65,64,127,106,
+98,122,55,62,80,109,183,100,21,21,114,137,146,119,116,153,135,243,135,158,
+2,9,11,71,57,60,66,67,63,59,253,140,51,40,42,35,35,43,32,254,96,1,34,254,
+222,207,3,151,0,255,255,0,82,255,206,4,190,6,244,2,34,2,154,0,0,0,3,2,210,
+1,37,0,0,255,255,0,60,254,255,8,118,6,244,2,34,2,155,0,0,0,3,2,210,0,156,
+0,0,0,4,0,73,255,206,5,217,3,255,0,68,0,69,0,70,0,71,0,0,1,3,33,21,33,6,7,
+6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,39,55,22,22,21,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,
+54,51,50,22,21,21,6,21,51,3,3,33,1,4,91,13,1,4,253,82,59,152,126,87,88,83,
+117,137,11,159,8,123,102,91,96,50,151,33,36,187,164,114,150,54,62,153,133,
+158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,155,167,1,203,14,177,
+2,237,251,251,3,255,254,221,148,68,56,47,86,59,63,70,121,120,116,125,80,76,
+77,85,63,51,128,61,142,160,86,90,88,88,165,128,116,150,58,40,76,52,56,59,
+67,59,39,47,44,65,84,113,143,149,116,13,7,6,1,35,251,207,1,231,0,255,255,
+0,52,255,206,6,20,6,244,2,34,2,159,0,0,0,3,2,210,2,33,0,0,255,255,0,52,254,
+255,6,20,6,244,2,34,2,161,0,0,0,3,2,210,2,33,0,0,0,3,0,73,255,206,5,157,3,
+255,0,80,0,81,0,82,0,0,1,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,
+55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,
+53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,39,6,6,7,6,6,21,20,22,51,50,
+54,55,51,22,22,51,50,54,53,52,39,1,1,5,88,33,36,187,164,114,150,54,62,153,
+133,158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,137,168,15,58,170,
+89,162,76,70,53,72,21,74,88,136,159,178,153,202,140,25,120,96,126,87,88,83,
+117,137,11,159,8,123,102,91,96,50,254,43,254,232,2,4,51,128,61,142,160,86,
+90,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,113,143,121,
+112,56,64,101,49,49,13,150,17,129,122,114,142,111,49,83,35,47,86,59,63,70,
+121,120,116,125,80,76,77,85,254,9,1,231,255,255,0,72,254,255,10,73,6,244,
+2,34,2,164,0,0,0,3,2,210,1,38,0,0,0,4,0,60,255,57,7,212,3,255,0,61,0,73,0,
+74,0,75,0,0,1,3,33,21,33,6,6,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,
+52,54,51,50,22,23,54,54,53,52,38,35,34,6,7,35,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,23,54,51,50,22,23,51,3,1,38,38,35,34,6,21,20,22,51,50,54,7,
+33,6,159,13,1,4,253,164,1,70,69,49,36,150,29,14,97,230,134,208,216,212,195,
+157,254,96,32,32,106,102,80,113,19,159,38,175,72,77,31,156,43,176,134,108,
+140,51,102,204,127,186,34,197,14,254,13,69,211,128,117,121,135,137,115,187,
+132,4,178,3,255,254,221,148,109,189,80,101,106,110,88,31,71,105,52,47,67,
+66,151,145,132,149,104,104,49,116,68,141,145,110,101,220,67,59,63,58,45,86,
+96,116,146,86,90,176,153,138,1,35,252,238,79,81,69,58,72,70,54,232,0,0,5,
+0,78,255,206,6,42,4,244,0,48,0,59,0,60,0,61,0,62,0,0,1,7,22,22,21,20,6,35,
+34,39,6,21,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,55,22,18,21,
+20,6,35,34,38,39,6,6,35,34,2,53,52,18,55,3,3,22,51,50,54,53,52,38,35,34,6,
+1,33,1,2,63,12,104,113,164,154,117,104,2,123,123,108,126,11,159,9,123,96,
+109,109,175,184,76,211,242,199,172,119,148,57,52,151,122,188,219,172,154,
+13,124,82,103,83,83,64,57,77,122,1,235,3,21,253,121,4,244,250,17,134,103,
+136,147,67,26,26,22,167,172,120,121,114,127,129,130,152,234,85,158,92,254,
+184,198,203,228,87,89,85,91,1,24,222,212,1,25,42,1,1,253,185,60,68,63,58,
+64,100,252,196,3,151,255,255,0,72,255,206,4,192,6,244,2,34,2,169,0,0,0,3,
+2,210,1,39,0,0,255,255,0,72,255,206,5,236,6,244,2,34,2,170,0,0,0,3,2,210,
+1,201,0,0,255,255,0,72,254,255,5,236,6,244,2,34,2,171,0,0,0,3,2,210,1,201,
+0,0,0,4,0,68,255,206,6,156,3,255,0,64,0,75,0,76,0,77,0,0,1,53,52,38,35,34,
+6,7,35,38,38,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,50,54,55,23,6,
+6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,23,54,51,50,22,22,21,20,2,
+35,34,38,53,52,54,51,50,19,38,35,34,6,21,20,22,51,50,54,5,33,5,170,152,123,
+94,124,16,159,28,163,127,97,109,126,124,110,144,119,108,87,79,73,117,59,137,
+90,185,122,158,176,90,88,80,82,205,173,132,188,76,112,211,129,200,109,216,
+200,143,163,162,146,144,76,90,123,67,80,74,71,81,107,253,216,3,78,1,196,37,
+168,205,114,97,106,113,76,69,71,78,153,76,78,65,77,73,79,103,110,92,150,126,
+89,128,32,34,125,85,127,153,86,98,184,133,250,157,245,254,248,150,130,129,
+153,254,253,115,74,59,66,72,78,249,0,255,255,0,73,255,206,6,58,6,244,2,34,
+2,172,0,0,0,3,2,210,2,127,0,0,255,255,0,72,254,255,5,166,6,244,2,34,2,173,
+0,0,0,3,2,210,1,158,0,0,255,255,0,72,255,206,5,166,6,244,2,34,2,174,0,0,0,
+3,2,210,1,157,0,0,255,255,0,72,254,255,5,166,6,244,2,34,2,175,0,0,0,3,2,210,
+1,158,0,0,255,255,0,60,255,206,5,157,6,244,2,34,2,176,0,0,0,3,2,210,0,236,
+0,0,255,255,0,60,255,206,5,104,6,244,2,34,2,178,0,0,0,3,2,210,0,156,0,0,255,
+255,0,60,254,255,5,104,6,244,2,34,2,181,0,0,0,3,2,210,0,156,0,0,0,5,0,73,
+255,206,6,0,3,255,0,60,0,61,0,62,0,63,0,64,0,0,1,51,22,22,51,50,54,53,52,
+38,39,55,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,
+35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,19,
+33,1,1,2,176,159,9,123,96,109,109,175,184,76,211,242,199,172,119,148,57,62,
+153,133,158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,155,167,120,
+152,126,87,88,83,117,137,91,3,0,251,212,1,157,1,120,114,127,129,130,152,234,
+85,158,92,254,184,198,203,228,87,89,88,88,165,128,116,150,58,40,76,52,56,
+59,67,59,39,47,44,65,84,113,143,149,116,105,137,56,47,86,59,63,70,121,254,
+206,1,231,1,176,255,255,0,73,254,255,6,90,6,244,2,34,2,185,0,0,0,3,2,210,
+2,193,0,0,255,255,0,60,255,206,8,118,6,244,2,34,2,187,0,0,0,3,2,210,0,241,
+0,0,255,255,0,72,255,206,10,73,6,244,2,34,2,193,0,0,0,3,2,210,4,29,0,0,255,
+255,0,72,255,206,4,191,6,244,2,34,2,197,0,0,0,3,2,210,1,38,0,0,0,5,0,73,255,
+206,6,143,3,255,0,30,0,41,0,69,0,70,0,71,0,0,1,33,38,38,53,52,54,51,50,18,
+21,20,2,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,22,21,20,37,22,51,50,54,
+53,52,38,35,34,6,1,53,6,35,34,39,21,20,22,51,50,54,55,51,22,51,50,54,53,52,
+38,35,34,6,21,20,23,21,1,33,2,158,1,121,58,49,153,136,169,208,243,198,117,
+148,58,48,147,129,136,202,107,216,172,123,147,254,28,68,88,83,83,65,53,75,
+107,1,69,73,108,94,85,143,136,103,123,24,159,44,197,127,147,110,100,53,72,
+191,254,58,3,72,2,64,41,98,65,103,140,254,236,225,251,254,215,81,95,85,91,
+133,247,157,237,1,19,140,119,117,23,45,68,63,57,65,107,254,165,93,36,47,19,
+170,204,101,110,211,208,175,161,192,65,58,142,34,148,254,38,0,0,5,0,72,255,
+206,5,172,3,255,0,29,0,40,0,41,0,42,0,43,0,0,19,22,4,51,50,36,53,52,38,39,
+55,22,18,21,20,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,39,22,51,50,54,53,
+52,38,35,34,6,1,33,1,233,9,1,5,220,229,1,1,139,135,82,178,185,254,174,254,
+199,254,205,254,162,217,171,123,148,166,153,93,78,71,90,83,84,65,54,78,111,
+1,209,2,214,253,167,2,16,182,211,193,174,123,186,55,157,78,254,247,168,252,
+254,226,1,57,1,7,217,1,0,141,118,133,150,193,49,68,63,56,66,105,252,201,3,
+151,255,255,0,60,255,206,5,161,6,244,2,34,2,199,0,0,0,3,2,210,2,8,0,0,255,
+255,0,60,255,206,5,104,6,244,2,34,2,200,0,0,0,3,2,210,0,241,0,0,255,255,0,
+60,255,206,4,222,6,244,2,34,2,202,0,0,0,3,2,210,1,69,0,0,255,255,0,60,254,
+255,6,39,6,244,2,34,2,203,0,0,0,3,2,210,0,156,0,0,255,255,0,60,255,206,5,
+157,6,244,2,34,2,206,0,0,0,3,2,210,0,156,0,0,255,255,0,60,255,206,8,68,6,
+244,2,34,2,209,0,0,0,3,2,210,0,156,0,0,0,3,0,73,255,230,4,154,3,255,0,39,
+0,40,0,41,0,0,37,21,33,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,
+23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,22,51,19,1,4,154,253,63,
+148,156,85,131,173,112,70,78,77,88,86,21,153,36,179,163,155,167,118,154,126,
+87,39,66,108,3,254,155,161,161,51,124,92,116,147,61,40,76,52,56,59,67,59,
+39,47,44,65,84,113,143,149,116,103,137,58,48,74,58,44,51,24,1,20,254,49,0,
+0,2,251,122,1,192,2,92,3,255,0,15,0,27,0,0,19,50,30,2,21,20,6,35,34,38,53,
+52,55,33,53,5,6,21,20,22,51,50,54,53,52,38,35,170,117,141,114,62,157,132,
+131,150,44,251,44,5,114,52,75,63,62,70,92,99,3,255,25,74,119,88,123,146,147,
+109,89,76,154,154,69,80,62,75,72,60,78,76,0,3,252,173,3,117,255,35,6,244,
+0,21,0,32,0,33,0,0,1,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,39,55,22,
+51,50,54,39,38,38,35,34,6,21,20,22,51,50,3,254,147,90,131,120,145,151,127,
+157,195,177,171,116,148,55,99,101,116,97,35,31,87,56,65,67,64,50,119,32,4,
+194,83,113,101,106,128,207,157,166,168,52,133,44,95,232,48,48,51,47,42,44,
+2,3,0,0,2,252,173,3,117,255,53,6,244,0,40,0,51,0,0,1,6,35,34,38,53,52,54,
+55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,21,20,23,54,51,50,22,21,20,6,35,
+34,39,55,22,51,50,54,39,38,38,35,34,6,21,20,51,50,54,254,146,85,140,130,130,
+36,35,14,157,132,113,149,40,156,35,111,68,75,1,42,36,166,182,180,168,121,
+143,55,99,101,113,99,39,31,88,57,60,65,122,48,85,4,179,76,94,95,44,74,30,
+41,45,106,124,89,100,40,96,59,52,7,4,3,7,179,156,147,162,52,133,44,88,215,
+38,38,41,37,81,38,0,0,1,255,70,255,230,2,124,3,255,0,19,0,0,39,55,22,22,51,
+50,54,53,52,38,39,55,22,18,21,20,6,35,34,38,186,82,85,171,99,105,110,175,
+184,76,211,242,206,192,124,211,226,132,114,109,133,126,152,234,85,158,92,
+254,184,198,206,225,126,0,0,2,255,70,255,230,5,58,3,255,0,34,0,46,0,0,1,50,
+30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,55,22,22,51,50,
+54,53,52,38,39,55,5,6,21,20,22,51,50,54,53,52,38,35,3,136,117,141,114,62,
+157,132,131,150,44,254,84,122,130,208,190,124,211,89,82,85,171,99,104,111,
+181,177,74,3,20,52,75,63,62,70,92,99,3,255,25,74,119,88,123,146,147,109,89,
+76,92,246,135,200,222,126,126,132,114,109,130,121,146,244,93,154,154,69,80,
+62,75,72,60,78,76,0,0,4,254,245,252,234,3,48,3,255,0,30,0,41,0,42,0,43,0,
+0,3,22,22,51,50,54,53,16,0,37,55,22,0,18,21,16,0,33,34,38,53,52,54,51,50,
+22,21,20,6,35,34,39,22,51,50,54,53,52,38,35,34,6,1,3,97,36,152,118,218,227,
+254,130,254,193,83,224,1,109,191,254,183,254,224,212,254,190,142,124,142,
+157,148,67,80,59,78,80,85,64,54,78,101,1,196,116,254,10,71,72,241,235,1,31,
+2,61,190,142,129,254,112,254,68,223,254,213,254,194,227,183,151,199,135,103,
+125,133,168,36,61,57,53,61,106,4,113,252,155,0,0,4,254,245,252,234,5,34,3,
+255,0,46,0,58,0,69,0,70,0,0,3,55,33,50,30,2,21,20,6,35,34,38,53,52,55,33,
+34,39,4,0,17,16,0,33,34,38,53,52,54,51,50,22,21,20,6,35,34,39,22,22,51,50,
+54,53,16,0,37,6,21,20,22,51,50,54,53,52,38,35,1,22,51,50,54,53,52,38,35,34,
+6,1,47,73,3,86,117,141,114,62,157,132,131,150,44,254,120,103,55,1,9,1,57,
+254,183,254,224,212,254,187,145,124,142,157,148,67,56,36,152,118,218,227,
+254,131,2,161,52,75,63,62,70,92,99,251,186,59,78,80,85,64,54,78,101,1,140,
+3,113,142,25,74,119,88,123,146,147,109,89,76,2,198,253,209,254,225,254,213,
+254,194,227,183,154,196,135,103,125,133,24,71,72,241,235,1,32,2,58,180,69,
+80,62,75,72,60,78,76,251,53,36,61,57,53,61,106,1,12,0,1,251,108,3,101,255,
+144,5,118,0,23,0,0,1,53,33,50,30,2,21,20,14,2,35,35,53,51,50,54,54,53,52,
+38,38,35,251,108,2,171,121,127,86,43,48,94,127,108,113,137,79,71,35,41,69,
+68,4,220,154,32,70,95,69,60,109,66,28,154,23,49,36,42,54,17,0,2,251,108,3,
+101,255,228,6,244,0,37,0,38,0,0,1,53,33,38,53,52,54,51,50,22,23,7,38,35,34,
+6,21,20,23,22,22,21,20,14,2,35,35,53,51,50,54,54,53,52,38,38,35,19,251,108,
+2,51,10,161,128,113,149,40,156,37,106,61,77,16,175,162,48,94,127,108,113,
+137,79,71,35,41,69,68,138,4,220,154,40,36,104,126,93,103,40,101,61,51,31,
+29,1,137,127,60,109,66,28,154,23,49,36,42,54,17,2,24,255,255,251,81,252,234,
+255,228,5,118,2,34,0,64,0,0,0,2,0,72,245,0,0,2,252,91,3,91,2,92,5,154,0,43,
+0,55,0,0,1,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,
+34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,1,6,21,20,22,51,
+50,54,53,52,38,35,253,230,64,153,178,173,131,42,104,130,44,44,146,116,174,
+117,140,114,62,159,130,132,149,43,98,178,29,159,15,105,71,33,73,80,81,84,
+61,3,7,53,75,63,62,70,92,99,3,101,156,136,119,154,78,79,84,73,25,75,118,88,
+123,146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,
+0,3,252,91,3,91,2,180,6,244,0,57,0,69,0,70,0,0,1,35,34,38,53,52,54,51,51,
+50,22,23,54,54,51,51,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,
+21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,1,6,
+21,20,22,51,50,54,53,52,38,35,3,253,230,64,153,178,173,131,42,104,130,44,
+44,146,116,114,10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,
+132,149,43,98,178,29,159,15,105,71,33,73,80,81,84,61,3,7,53,75,63,62,70,92,
+99,63,3,101,156,136,119,154,78,79,84,73,32,44,104,126,93,103,40,101,61,51,
+37,25,7,155,141,123,146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,
+75,72,60,78,76,1,244,0,2,252,79,3,55,2,92,5,118,0,33,0,45,0,0,1,53,33,50,
+30,2,21,20,6,35,34,38,53,52,55,33,22,21,20,6,6,35,35,53,51,50,54,54,53,52,
+38,38,35,33,6,21,20,22,51,50,54,53,52,38,35,252,79,4,91,117,141,114,62,157,
+132,131,150,44,254,219,21,59,149,148,214,217,79,71,35,41,69,68,3,8,52,75,
+63,62,70,92,99,4,220,154,25,74,119,88,123,146,147,109,89,76,50,64,66,120,
+75,154,23,49,36,42,54,17,69,80,62,75,72,60,78,76,0,2,253,24,3,101,0,244,6,
+244,0,35,0,36,0,0,1,34,6,6,21,20,22,22,51,33,21,33,34,6,21,20,22,22,51,51,
+21,35,34,38,53,52,54,55,38,53,52,54,54,51,33,21,37,254,134,88,69,39,34,69,
+92,1,25,254,223,103,68,35,57,63,76,87,146,168,49,50,115,95,154,145,2,82,253,
+219,6,27,17,40,37,37,44,20,154,52,44,31,45,19,154,125,111,57,86,37,75,123,
+84,106,44,154,217,0,0,3,253,153,3,183,255,232,6,244,0,17,0,18,0,19,0,0,1,
+38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,55,19,253,255,49,53,161,
+128,113,149,40,156,37,106,61,77,100,134,7,3,183,45,103,67,104,126,93,103,
+40,101,61,51,76,66,16,2,245,0,0,3,251,92,252,234,255,239,255,131,0,15,0,27,
+0,28,0,0,1,34,46,2,53,52,54,51,50,22,21,20,7,33,21,37,54,53,52,38,35,34,6,
+21,20,22,51,19,253,14,121,144,110,59,152,122,124,142,41,2,160,252,205,46,
+69,62,59,66,98,101,44,253,117,25,70,106,79,110,136,132,97,75,68,154,154,57,
+63,53,64,61,48,66,62,254,219,0,0,4,0,52,255,230,5,218,6,244,0,15,0,27,0,91,
+0,92,0,0,19,53,33,38,53,52,54,51,50,22,21,20,14,2,35,55,51,50,54,53,52,38,
+35,34,6,21,20,3,30,2,51,50,54,55,55,54,54,55,23,14,2,7,7,6,7,22,18,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,54,55,
+51,22,22,51,50,53,52,38,39,6,35,34,38,39,7,162,2,110,41,143,129,120,148,60,
+110,140,124,82,11,101,98,66,59,62,69,181,20,38,43,32,40,72,66,63,106,174,
+129,11,71,88,75,66,47,40,40,197,215,200,170,115,143,67,54,148,119,147,184,
+61,57,202,1,223,230,94,83,97,123,10,159,8,127,94,217,249,199,20,20,117,137,
+37,182,4,230,154,66,77,97,132,134,112,80,106,69,25,154,62,66,48,61,64,53,
+63,254,172,77,80,31,50,85,82,139,105,1,158,4,34,65,85,61,52,41,70,254,230,
+182,183,208,77,99,87,89,178,143,63,126,44,152,145,54,176,78,92,126,115,113,
+128,231,163,231,25,2,151,136,47,0,255,255,0,73,255,206,5,157,6,229,2,34,0,
+28,0,0,0,3,1,229,5,180,7,23,0,3,0,73,255,230,13,255,3,255,0,116,0,128,0,129,
+0,0,37,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,
+20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,
+51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,
+21,20,7,22,22,51,50,54,53,52,38,39,55,35,55,33,50,30,2,21,20,6,35,34,38,53,
+52,55,33,22,22,21,20,6,35,34,39,6,35,34,1,6,21,20,22,51,50,54,53,52,38,35,
+1,5,128,49,158,109,119,148,57,62,153,133,158,178,140,164,112,70,78,77,88,
+86,21,153,36,179,163,155,167,120,152,126,87,88,83,117,137,11,159,9,123,96,
+109,109,175,184,76,211,242,5,80,158,91,105,110,175,184,76,211,242,5,80,158,
+91,104,111,181,177,1,1,74,2,210,117,141,114,62,157,132,131,150,44,254,84,
+122,130,208,190,208,159,100,242,209,6,114,52,75,63,62,70,92,99,245,42,152,
+89,89,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,
+113,143,149,116,105,137,56,47,86,59,63,70,121,120,114,127,129,130,152,234,
+85,158,92,254,184,198,43,38,98,91,133,126,152,234,85,158,92,254,184,198,42,
+39,98,91,130,121,146,244,92,1,154,25,74,119,88,123,146,147,109,89,76,92,246,
+135,200,222,179,179,3,127,69,80,62,75,72,60,78,76,254,80,0,3,0,60,255,103,
+9,179,3,255,0,77,0,89,0,90,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,33,22,
+21,20,2,4,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,7,35,38,38,35,34,6,
+21,20,22,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,7,6,6,21,20,
+22,51,50,54,54,53,52,38,39,55,5,6,21,20,22,51,50,54,53,52,38,35,1,8,1,117,
+141,114,62,157,132,131,150,44,254,140,148,150,254,239,165,181,199,74,103,
+78,46,74,64,94,117,9,159,7,102,80,63,69,23,25,155,61,164,125,98,132,50,55,
+148,103,142,154,56,98,96,46,109,106,123,187,103,126,123,76,2,213,52,75,63,
+62,70,92,99,249,145,3,255,25,74,119,88,123,146,147,109,89,76,159,246,177,
+254,229,157,174,151,80,158,113,85,93,44,56,68,132,116,122,128,67,59,42,72,
+43,49,114,108,116,146,81,94,91,84,150,116,67,138,112,108,104,50,84,86,113,
+214,131,136,215,69,137,154,69,80,62,75,72,60,78,76,252,155,0,1,251,98,252,
+67,0,26,255,131,0,59,0,0,1,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,
+22,23,54,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,53,52,39,55,22,22,21,
+20,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,253,71,139,6,58,56,38,42,
+32,133,45,120,87,80,94,35,41,106,77,100,114,45,62,51,46,70,70,126,145,155,
+106,98,98,236,192,129,145,51,63,50,38,47,43,55,73,254,94,86,77,43,37,43,63,
+40,75,91,84,106,56,65,63,58,108,80,56,90,70,57,83,41,52,60,174,138,167,103,
+115,70,189,128,205,240,132,113,60,115,66,54,60,29,33,40,88,0,0,2,251,98,252,
+67,2,151,255,131,0,73,0,85,0,0,1,35,38,38,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,23,54,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,53,52,39,55,33,
+50,30,2,21,20,6,35,34,38,53,52,55,35,22,21,20,6,35,34,38,53,52,54,55,54,54,
+53,52,38,35,34,6,37,6,21,20,22,51,50,54,53,52,38,35,253,71,139,6,58,56,38,
+42,32,133,45,120,87,80,94,35,41,106,77,100,114,45,62,51,46,70,70,126,145,
+155,82,1,192,116,133,105,55,137,115,122,136,35,241,79,236,192,129,145,51,
+63,50,38,47,43,55,73,3,252,38,64,57,54,61,88,91,254,94,86,77,43,37,43,63,
+40,75,91,84,106,56,65,63,58,108,80,56,90,70,57,83,41,52,60,174,138,167,103,
+115,20,64,95,69,111,129,131,95,71,59,109,146,205,240,132,113,60,115,66,54,
+60,29,33,40,88,86,49,60,54,63,58,45,63,60,0,2,0,100,255,229,5,2,5,16,0,12,
+0,24,0,0,5,32,0,17,52,18,36,51,32,0,17,16,0,37,50,18,53,52,2,35,34,2,21,20,
+18,2,177,254,237,254,198,139,1,11,183,1,17,1,64,254,199,254,232,199,216,217,
+198,199,213,212,27,1,108,1,45,196,1,43,163,254,153,254,213,254,201,254,158,
+162,1,4,240,237,1,7,254,251,239,240,254,252,0,1,0,100,255,240,4,238,5,16,
+0,25,0,0,37,54,18,53,16,33,34,2,21,20,18,23,7,38,2,53,52,18,36,51,32,0,17,
+20,2,7,3,137,100,80,254,101,186,211,77,103,178,98,81,142,1,13,183,1,10,1,
+46,77,103,59,169,1,18,141,1,236,254,252,232,137,254,245,180,75,190,1,57,159,
+187,1,43,164,254,171,254,207,163,254,205,196,0,2,0,30,0,0,5,203,5,16,0,29,
+0,43,0,0,37,50,62,2,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,4,18,21,
+20,2,4,33,33,53,1,38,35,34,6,21,20,22,51,50,54,53,52,38,2,166,209,219,133,
+66,94,83,15,159,135,141,171,199,168,157,1,10,156,164,254,206,254,253,253,
+44,3,130,17,17,94,98,73,68,65,77,30,164,53,120,172,122,139,232,63,42,51,127,
+150,159,127,138,177,172,254,202,181,196,254,218,143,164,3,212,2,84,79,65,
+71,76,66,39,83,0,1,0,28,255,230,4,0,5,16,0,40,0,0,19,22,22,51,50,54,53,52,
+38,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,54,33,50,22,21,20,6,7,22,
+21,20,6,35,34,38,39,110,123,212,114,135,153,84,162,173,40,59,155,160,85,148,
+133,121,215,120,82,255,1,18,212,255,109,107,216,251,216,134,243,152,1,47,
+94,74,113,96,76,96,42,161,44,97,75,92,108,74,94,155,174,192,158,113,149,45,
+92,208,162,203,75,99,0,2,0,85,255,230,5,40,5,16,0,35,0,45,0,0,1,22,21,20,
+6,35,34,38,53,52,55,38,38,53,52,54,55,23,6,6,21,20,22,23,54,54,53,52,38,39,
+55,22,22,21,20,6,5,6,6,21,20,51,50,53,52,38,3,170,96,177,157,152,177,94,180,
+200,163,153,77,105,111,218,222,222,219,110,106,77,152,164,196,254,86,76,81,
+159,164,84,1,134,65,104,120,127,127,120,105,63,50,237,167,143,237,73,146,
+50,158,98,158,164,14,14,164,158,97,160,49,146,73,237,143,167,234,81,16,67,
+45,103,103,46,68,0,0,1,0,41,255,230,5,96,5,16,0,47,0,0,19,22,22,51,50,18,
+53,52,38,35,34,6,7,39,54,54,51,50,0,19,54,54,53,52,38,39,55,22,21,20,6,7,
+22,21,20,7,39,54,53,52,38,39,2,0,35,34,38,39,123,84,191,94,185,197,200,182,
+90,194,85,82,117,224,127,217,1,36,25,75,84,74,75,138,185,97,102,199,187,136,
+149,83,77,23,254,233,217,133,235,114,1,17,66,72,1,0,252,238,254,71,67,155,
+75,69,254,222,254,237,6,101,79,76,140,58,103,155,202,107,149,46,90,212,199,
+159,104,116,154,80,97,9,254,247,254,216,70,74,0,1,0,95,0,0,5,119,4,246,0,
+42,0,0,37,21,33,34,46,2,53,52,54,55,38,38,53,52,62,2,51,51,21,35,34,6,6,21,
+20,30,2,51,33,21,33,34,6,6,21,20,30,2,51,5,119,253,49,201,192,130,62,86,93,
+83,77,61,119,167,150,13,9,133,124,67,41,89,127,145,1,0,254,193,141,136,80,
+48,93,132,129,164,164,38,93,129,78,100,144,50,53,141,96,79,131,93,45,164,
+47,81,69,51,73,51,17,164,36,89,72,55,76,48,13,0,0,2,0,88,255,230,4,68,5,16,
+0,46,0,47,0,0,1,22,21,20,4,33,34,38,53,52,54,55,62,2,53,52,38,35,32,21,20,
+23,7,38,53,52,36,51,50,22,21,20,6,6,7,14,2,21,20,22,51,32,53,52,39,37,4,16,
+52,254,248,254,254,236,246,210,249,150,129,61,146,131,254,187,30,155,52,1,
+0,229,231,240,88,169,155,193,136,58,154,150,1,90,30,255,0,1,223,84,103,148,
+170,190,170,140,188,78,47,60,76,54,74,84,163,50,61,55,84,97,136,173,181,144,
+95,131,95,52,63,74,80,57,92,97,182,50,67,152,0,1,0,100,255,230,6,79,4,246,
+0,30,0,0,1,6,6,21,20,22,51,50,54,53,52,2,39,55,33,21,33,22,18,21,20,2,4,35,
+34,36,2,53,52,18,55,1,213,102,90,202,187,193,211,155,146,61,3,17,253,179,
+106,115,144,254,247,177,161,254,255,143,119,114,4,32,109,223,137,208,244,
+249,222,164,1,20,82,142,164,83,254,244,154,176,254,220,159,149,1,21,176,167,
+1,48,121,0,0,1,0,95,0,0,5,119,4,246,0,41,0,0,1,34,14,2,21,20,22,22,51,33,
+21,33,34,14,2,21,20,22,22,51,51,21,35,34,46,2,53,52,54,55,38,53,52,62,2,51,
+33,21,2,163,147,119,92,44,75,134,148,1,63,255,0,142,128,90,42,93,129,102,
+9,12,128,166,138,66,82,78,179,77,135,186,185,2,209,4,82,16,47,76,53,71,87,
+39,164,16,52,74,50,80,87,30,164,33,93,143,83,95,134,48,100,198,90,136,86,
+31,164,0,0,3,0,90,255,49,4,160,5,16,0,27,0,39,0,40,0,0,5,54,54,53,52,39,6,
+6,35,34,0,53,52,54,54,51,50,22,22,21,20,6,7,22,21,20,6,7,3,50,54,53,52,38,
+35,34,6,21,20,22,19,2,223,149,124,51,67,164,97,244,254,217,132,247,160,159,
+246,135,45,45,105,159,209,187,169,193,193,169,170,192,192,76,45,61,106,73,
+72,69,45,44,1,21,232,157,245,138,131,244,162,90,153,63,112,132,134,189,93,
+2,103,191,165,168,203,201,160,169,197,254,104,0,0,1,0,190,0,0,1,113,4,245,
+0,3,0,0,33,35,17,51,1,113,179,179,4,245,0,1,0,135,0,0,3,44,4,245,0,21,0,0,
+33,35,17,6,35,34,38,38,53,17,51,17,20,22,22,51,50,54,54,53,17,51,3,44,179,
+81,113,106,140,58,177,27,65,63,69,69,28,179,2,8,78,96,158,153,1,164,254,98,
+113,87,52,47,84,100,1,179,0,1,0,135,0,0,4,206,4,245,0,36,0,0,1,20,22,22,51,
+50,54,54,55,17,51,17,20,22,22,51,50,54,54,53,17,51,17,35,17,6,35,34,39,6,
+35,34,38,38,53,17,51,1,56,21,60,55,61,62,21,1,177,21,60,55,60,61,24,179,179,
+72,96,153,78,89,138,100,132,58,177,3,67,96,86,50,50,85,83,1,192,254,78,96,
+86,50,47,85,99,1,179,251,11,1,248,62,111,111,92,158,157,1,164,0,0,3,0,66,
+0,0,4,160,4,245,0,3,0,4,0,5,0,0,19,53,33,21,1,17,66,4,94,253,219,2,51,161,
+161,2,194,251,11,0,0,1,0,95,0,0,4,170,3,255,0,37,0,0,33,34,38,38,53,52,54,
+54,55,62,2,53,52,38,35,33,53,33,50,22,22,21,20,14,2,7,14,2,21,20,22,22,51,
+33,21,1,252,166,163,84,82,194,212,137,101,50,81,110,253,184,2,55,177,144,
+64,52,108,163,128,143,121,61,39,70,109,2,192,60,120,82,76,120,97,48,33,34,
+55,45,50,49,154,66,107,75,63,102,80,55,29,32,46,60,42,38,46,21,161,0,0,1,
+0,95,0,1,4,170,5,16,0,71,0,0,1,34,46,2,53,52,54,54,55,62,2,53,52,38,35,33,
+53,33,50,30,2,21,20,6,6,7,7,14,2,21,20,51,33,50,30,2,21,20,6,6,7,7,14,2,21,
+20,22,51,33,21,33,34,38,38,53,52,54,54,55,62,2,53,52,38,35,1,160,94,109,73,
+45,80,184,194,154,132,32,31,51,253,75,2,111,108,112,73,36,64,181,179,153,
+87,91,21,75,1,116,97,111,78,43,63,179,182,152,87,93,20,38,37,3,79,252,246,
+133,124,64,90,181,187,154,132,32,31,51,2,61,16,44,70,50,73,85,62,34,26,33,
+23,16,17,20,154,20,44,66,48,63,82,68,31,28,16,30,22,13,36,18,42,69,51,62,
+83,69,31,28,16,29,22,13,19,15,161,41,81,61,79,84,58,33,26,33,23,16,17,20,
+0,0,2,0,95,255,230,5,188,3,255,0,24,0,35,0,0,1,21,20,22,51,50,36,19,23,2,
+0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,38,35,34,6,
+1,6,221,198,236,1,32,92,171,108,254,128,254,207,254,239,254,209,230,182,123,
+150,170,155,108,66,73,91,83,84,63,54,75,113,2,19,19,175,202,253,1,48,61,254,
+168,254,199,1,36,1,4,228,1,13,141,119,132,153,198,51,68,63,56,63,105,0,0,
+1,255,202,254,173,0,54,6,77,0,3,0,0,3,17,51,17,54,108,254,173,7,160,248,96,
+0,1,254,213,254,174,1,43,6,77,0,14,0,0,19,23,7,39,17,35,17,7,39,55,39,55,
+23,55,23,74,225,75,170,108,170,75,225,225,75,224,224,75,5,43,220,73,169,249,
+255,6,1,169,73,220,217,73,220,220,74,0,0,10,0,186,255,230,3,230,3,255,0,10,
+0,18,0,26,0,34,0,42,0,50,0,58,0,68,0,69,0,70,0,0,1,20,6,35,34,53,52,54,51,
+50,22,7,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,19,20,35,34,53,52,51,
+50,5,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,5,20,35,34,53,52,51,50,
+7,20,6,35,34,53,52,51,50,22,1,19,2,139,29,31,58,28,30,31,29,255,59,59,59,
+59,1,254,59,59,59,59,92,60,59,59,60,253,74,59,59,59,59,92,59,59,59,59,1,254,
+59,59,59,59,255,29,31,58,58,31,29,254,248,4,2,223,30,29,59,30,28,28,132,59,
+59,59,59,59,59,59,254,208,59,59,59,59,59,59,59,254,208,59,59,59,59,59,59,
+59,161,30,29,59,59,29,3,184,251,231,0,255,255,0,34,252,234,4,155,6,244,2,
+34,2,152,0,0,0,34,2,248,0,0,0,3,2,210,0,230,0,0,255,255,0,34,255,206,4,132,
+6,244,2,34,2,152,0,0,0,3,0,70,3,144,0,0,0,6,0,60,254,255,6,137,6,244,0,82,
+0,95,0,107,0,111,0,112,0,113,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,54,
+53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,7,22,22,51,50,54,
+53,52,38,39,38,38,53,52,54,55,38,53,52,54,54,51,33,21,33,34,6,6,21,20,22,
+22,51,33,21,33,34,6,21,20,22,51,22,18,21,20,6,35,34,38,1,38,35,34,6,21,20,
+22,51,50,54,53,52,19,38,38,35,34,6,21,20,22,51,50,54,19,19,51,19,39,1,2,183,
+72,168,96,145,154,150,128,76,153,95,34,73,3,150,124,120,159,176,143,148,211,
+111,72,70,128,77,119,120,148,167,138,150,49,50,115,95,154,145,2,82,253,146,
+88,69,39,34,69,92,1,25,254,223,103,68,64,101,214,224,224,190,96,167,254,181,
+38,44,72,83,67,61,68,73,75,73,108,57,58,62,78,68,65,106,78,15,154,15,21,1,
+66,103,65,64,127,106,98,122,55,62,80,109,183,100,21,21,114,137,146,119,116,
+153,135,243,135,158,128,47,42,134,125,148,231,96,6,125,105,57,86,37,75,123,
+84,106,44,154,17,40,37,37,44,20,154,52,44,43,52,99,254,190,197,200,231,59,
+3,72,11,71,57,60,66,67,63,59,253,140,51,40,42,35,35,43,32,254,96,1,34,254,
+222,207,7,38,255,255,0,82,255,206,4,171,6,244,2,34,2,154,0,0,0,3,0,70,3,183,
+0,0,255,255,0,60,254,255,8,118,6,244,2,34,2,155,0,0,0,3,0,70,3,143,0,0,255,
+255,0,73,255,206,6,126,6,244,2,34,0,25,0,0,0,3,0,70,5,138,0,0,0,3,0,52,255,
+206,5,227,6,244,0,74,0,75,0,76,0,0,1,34,6,6,21,20,22,22,51,33,21,33,34,6,
+21,20,22,22,51,51,4,0,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,35,53,
+33,21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,35,34,38,53,52,
+54,55,38,53,52,54,54,51,33,21,1,1,3,117,88,69,39,34,69,92,1,25,254,223,103,
+68,35,57,63,87,1,2,1,22,202,168,115,143,67,54,148,119,147,184,61,57,202,1,
+223,230,94,83,97,123,10,159,8,127,94,108,109,234,196,34,146,168,49,50,115,
+95,154,145,2,82,253,39,1,61,6,27,17,40,37,37,44,20,154,52,44,31,45,19,69,
+254,183,228,199,224,77,99,87,89,178,143,63,126,44,152,145,54,176,78,92,126,
+115,113,128,129,130,181,253,41,125,111,57,86,37,75,123,84,106,44,154,249,
+179,7,38,0,4,0,52,254,255,5,227,6,244,0,74,0,78,0,79,0,80,0,0,1,34,6,6,21,
+20,22,22,51,33,21,33,34,6,21,20,22,22,51,51,4,0,21,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,
+52,38,39,35,34,38,53,52,54,55,38,53,52,54,54,51,33,21,1,19,51,19,39,1,3,117,
+88,69,39,34,69,92,1,25,254,223,103,68,35,57,63,87,1,2,1,22,202,168,115,143,
+67,54,148,119,147,184,61,57,202,1,223,230,94,83,97,123,10,159,8,127,94,108,
+109,234,196,34,146,168,49,50,115,95,154,145,2,82,252,213,15,154,15,102,1,
+61,6,27,17,40,37,37,44,20,154,52,44,31,45,19,69,254,183,228,199,224,77,99,
+87,89,178,143,63,126,44,152,145,54,176,78,92,126,115,113,128,129,130,181,
+253,41,125,111,57,86,37,75,123,84,106,44,154,248,228,1,34,254,222,207,7,38,
+0,0,4,0,73,255,206,6,126,6,244,0,112,0,113,0,114,0,115,0,0,1,34,38,53,52,
+54,55,38,53,52,54,54,51,33,21,33,34,6,6,21,20,22,22,51,33,21,33,34,6,21,20,
+22,22,51,51,50,30,2,21,20,6,35,34,39,6,7,6,6,21,20,22,51,50,54,55,51,22,22,
+51,50,54,53,52,39,55,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,
+54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,53,52,
+38,38,35,9,2,3,236,146,168,49,50,115,95,154,145,2,82,253,146,88,69,39,34,
+69,92,1,25,254,223,103,68,35,57,63,31,89,110,83,51,178,153,202,140,49,192,
+126,87,88,83,117,137,11,159,8,123,102,91,96,50,151,33,36,187,164,114,150,
+54,62,153,133,158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,137,168,
+15,58,170,89,162,32,65,68,254,211,254,232,2,115,3,101,125,111,57,86,37,75,
+123,84,106,44,154,17,40,37,37,44,20,154,52,44,31,45,19,22,60,95,74,114,142,
+111,97,70,47,86,59,63,70,121,120,116,125,80,76,77,85,63,51,128,61,142,160,
+86,90,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,113,143,
+121,112,56,64,101,32,43,23,252,105,1,231,5,63,255,255,0,72,254,255,10,73,
+6,244,2,34,2,164,0,0,0,3,0,70,3,173,0,0,255,255,0,60,255,57,8,154,6,244,2,
+34,0,30,0,0,0,3,0,70,7,166,0,0,0,4,0,78,255,206,6,168,6,244,0,78,0,89,0,90,
+0,91,0,0,1,3,22,22,21,20,6,35,34,39,6,21,21,20,22,51,50,54,55,51,22,22,51,
+50,54,53,16,37,38,38,53,52,54,55,38,53,52,54,54,51,33,21,33,34,6,6,21,20,
+22,22,51,33,21,33,34,6,21,20,22,51,22,18,21,20,6,35,34,38,39,6,6,35,34,2,
+53,52,18,55,3,3,22,51,50,54,53,52,38,35,34,6,1,1,2,63,12,104,113,164,154,
+117,104,2,123,123,108,126,11,159,9,123,96,109,109,254,177,130,138,49,50,115,
+95,154,145,2,82,253,146,88,69,39,34,69,92,1,25,254,223,103,68,63,101,214,
+225,199,172,119,148,57,52,151,122,188,219,172,154,13,124,82,103,83,83,64,
+57,77,122,1,235,1,50,5,8,254,242,17,134,103,136,147,67,26,26,22,167,172,120,
+121,114,127,129,130,1,57,164,10,127,97,57,86,37,75,123,84,106,44,154,17,40,
+37,37,44,20,154,52,44,42,53,99,254,190,197,203,228,87,89,85,91,1,24,222,212,
+1,25,42,1,21,253,165,60,68,63,58,64,100,252,196,7,38,0,255,255,0,72,255,206,
+4,191,6,244,2,34,2,169,0,0,0,3,0,70,3,173,0,0,255,255,0,72,255,206,5,236,
+6,244,2,34,2,170,0,0,0,3,0,70,4,102,0,0,255,255,0,72,254,255,5,236,6,244,
+2,34,2,171,0,0,0,3,0,70,4,102,0,0,255,255,0,68,255,206,7,79,6,244,2,34,0,
+35,0,0,0,3,0,70,6,91,0,0,0,5,0,73,255,206,6,88,6,244,0,73,0,83,0,95,0,96,
+0,97,0,0,1,34,6,6,21,20,22,22,51,33,21,33,34,6,21,20,22,22,51,51,50,30,2,
+21,16,0,33,32,0,53,52,54,51,50,22,21,20,6,35,34,39,22,4,51,50,36,55,6,35,
+34,38,53,52,54,55,38,39,35,34,38,38,53,52,54,55,38,53,52,54,54,51,33,21,1,
+22,51,50,53,52,38,35,34,6,5,38,38,35,34,6,21,20,22,51,50,54,1,1,3,234,88,
+69,39,34,69,92,1,25,254,223,103,68,35,57,63,21,29,199,191,104,254,147,254,
+163,254,162,254,128,210,164,127,147,173,151,94,69,43,1,35,228,249,1,34,33,
+89,127,121,149,138,119,9,24,94,136,146,78,49,50,115,95,154,145,2,82,250,136,
+66,82,186,64,57,82,113,4,93,28,94,57,60,76,71,64,65,96,253,225,1,42,6,27,
+17,40,37,37,44,20,154,52,44,31,45,19,45,123,197,129,254,242,254,227,1,21,
+235,179,229,138,114,127,148,34,129,137,161,154,83,137,114,101,138,5,3,4,54,
+105,77,57,86,37,75,123,84,106,44,154,252,12,41,131,53,55,104,10,54,60,63,
+57,55,64,66,253,142,7,38,255,255,0,72,254,255,5,166,6,244,2,34,2,173,0,0,
+0,3,0,70,4,50,0,0,255,255,0,72,255,206,5,166,6,244,2,34,2,174,0,0,0,3,0,70,
+4,50,0,0,255,255,0,72,254,255,5,166,6,244,2,34,2,175,0,0,0,3,0,70,4,50,0,
+0,0,4,0,60,255,206,5,84,6,244,0,72,0,73,0,74,0,75,0,0,1,35,34,38,53,52,54,
+55,38,53,52,54,54,51,33,21,33,34,6,6,21,20,22,22,51,33,21,33,34,6,21,20,22,
+22,51,51,4,0,21,20,6,35,34,38,39,38,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,22,22,23,22,22,51,50,54,53,52,38,9,2,3,0,98,146,168,49,50,115,95,
+154,145,2,82,253,146,88,69,39,34,69,92,1,25,254,223,103,68,35,57,63,134,1,
+1,1,36,209,189,126,184,132,73,69,46,47,61,45,52,166,52,47,157,120,70,102,
+82,80,110,120,77,103,113,213,254,249,1,121,253,173,3,101,125,111,57,86,37,
+75,123,84,106,44,154,17,40,37,37,44,20,154,52,44,31,45,19,64,254,178,228,
+199,224,119,179,98,59,76,60,67,125,72,56,84,152,83,126,168,44,78,106,146,
+77,133,127,175,237,252,167,7,38,249,12,255,255,0,60,255,206,5,104,6,244,2,
+34,2,178,0,0,0,3,0,70,3,143,0,0,255,255,0,60,254,255,5,104,6,244,2,34,2,181,
+0,0,0,3,0,70,3,143,0,0,0,4,0,73,255,206,6,126,6,244,0,91,0,92,0,93,0,94,0,
+0,1,34,6,6,21,20,22,22,51,33,21,33,34,6,21,20,22,51,22,18,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,
+38,38,53,52,54,55,38,53,52,54,54,51,33,21,9,2,4,16,88,69,39,34,69,92,1,25,
+254,223,103,68,63,101,214,225,199,172,119,148,57,62,153,133,158,178,140,164,
+112,70,78,77,88,86,21,153,36,179,163,155,167,120,152,126,87,88,83,117,137,
+11,159,9,123,96,109,109,166,166,131,140,49,50,115,95,154,145,2,82,252,130,
+254,212,2,115,6,27,17,40,37,37,44,20,154,52,44,42,53,99,254,190,197,203,228,
+87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,113,143,
+149,116,105,137,56,47,86,59,63,70,121,120,114,127,129,130,158,239,81,9,124,
+100,57,86,37,75,123,84,106,44,154,249,179,1,231,5,63,0,0,5,0,73,254,255,6,
+126,6,244,0,91,0,95,0,96,0,97,0,98,0,0,1,34,6,6,21,20,22,22,51,33,21,33,34,
+6,21,20,22,51,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,
+54,55,51,22,22,51,50,54,53,52,38,39,38,38,53,52,54,55,38,53,52,54,54,51,33,
+21,1,19,51,19,39,1,1,4,16,88,69,39,34,69,92,1,25,254,223,103,68,63,101,214,
+225,199,172,119,148,57,62,153,133,158,178,140,164,112,70,78,77,88,86,21,153,
+36,179,163,155,167,120,152,126,87,88,83,117,137,11,159,9,123,96,109,109,166,
+166,131,140,49,50,115,95,154,145,2,82,252,36,15,154,15,90,254,212,2,115,6,
+27,17,40,37,37,44,20,154,52,44,42,53,99,254,190,197,203,228,87,89,88,88,165,
+128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,113,143,149,116,105,137,
+56,47,86,59,63,70,121,120,114,127,129,130,158,239,81,9,124,100,57,86,37,75,
+123,84,106,44,154,248,228,1,34,254,222,207,1,231,5,63,0,0,4,0,60,255,206,
+8,45,6,244,0,84,0,96,0,97,0,98,0,0,1,22,22,51,50,54,53,52,38,39,55,22,18,
+21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,38,39,35,34,38,53,52,54,55,38,53,52,54,54,51,33,21,33,34,6,
+6,21,20,22,22,51,33,21,33,34,6,21,20,22,22,51,51,4,0,21,20,5,38,38,35,34,
+6,21,20,22,51,50,54,5,19,5,99,80,157,92,105,110,175,184,76,211,242,206,192,
+209,158,52,171,119,95,154,79,71,136,92,141,158,164,125,92,149,123,90,117,
+78,105,111,213,213,98,146,168,49,50,115,95,154,145,2,82,253,146,88,69,39,
+34,69,92,1,25,254,223,103,68,35,57,63,134,1,1,1,36,252,196,72,80,51,60,73,
+80,68,66,91,2,46,12,1,67,98,90,133,126,152,234,85,158,92,254,184,198,206,
+225,180,90,90,80,91,97,74,169,137,130,166,89,159,118,75,134,125,175,238,62,
+125,111,57,86,37,75,123,84,106,44,154,17,40,37,37,44,20,154,52,44,31,45,19,
+64,254,178,228,38,87,95,56,79,67,66,84,75,252,7,38,0,4,0,72,255,206,10,0,
+6,244,0,85,0,97,0,98,0,99,0,0,37,6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,
+50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,38,38,53,52,54,55,38,53,52,54,
+54,51,33,21,33,34,6,6,21,20,22,22,51,33,21,33,34,6,21,20,22,51,51,22,18,21,
+20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,37,50,54,53,52,38,
+35,34,6,21,20,22,5,3,7,3,50,171,121,228,168,70,232,148,244,254,221,136,244,
+155,157,246,132,18,81,164,97,105,110,170,170,137,150,49,50,115,95,154,145,
+2,82,253,146,88,69,39,34,69,92,1,25,254,223,103,68,63,92,33,214,225,5,80,
+158,91,105,110,175,184,76,211,242,206,192,208,250,188,172,195,195,172,171,
+195,193,3,115,221,153,90,89,214,104,110,1,24,229,158,249,133,133,246,158,
+77,69,104,101,133,126,156,239,82,5,124,105,57,86,37,75,123,84,106,44,154,
+17,40,37,37,44,20,154,52,44,41,54,99,254,190,197,42,39,98,91,133,126,152,
+234,85,158,92,254,184,198,206,225,161,192,164,168,203,200,161,168,198,185,
+7,38,0,255,255,0,72,255,206,4,191,6,244,2,34,2,197,0,0,0,3,0,70,3,173,0,0,
+255,255,0,73,255,206,6,246,6,244,2,34,0,48,0,0,0,3,0,70,6,2,0,0,0,4,0,72,
+255,206,6,131,6,244,0,62,0,73,0,74,0,75,0,0,1,34,6,6,21,20,22,22,51,33,21,
+33,34,6,21,20,22,51,51,22,22,21,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,
+34,39,22,4,51,50,54,53,52,38,39,35,34,38,53,52,54,55,38,53,52,54,54,51,33,
+21,1,22,51,50,54,53,52,38,35,34,6,1,1,4,21,88,69,39,34,69,92,1,25,254,223,
+103,68,63,92,79,142,139,254,179,254,194,254,205,254,162,217,171,123,148,166,
+153,93,86,9,1,5,220,234,252,101,92,7,146,168,49,50,115,95,154,145,2,82,250,
+110,71,90,83,84,65,54,78,111,1,209,1,113,6,27,17,40,37,37,44,20,154,52,44,
+41,54,104,252,154,255,0,254,229,1,57,1,7,217,1,0,141,118,133,150,47,182,211,
+195,188,105,186,60,125,111,57,86,37,75,123,84,106,44,154,252,135,49,68,63,
+56,66,105,252,201,7,38,0,6,0,60,255,206,5,210,6,244,0,71,0,84,0,95,0,96,0,
+97,0,98,0,0,1,34,6,6,21,20,22,22,51,33,21,33,34,6,21,20,22,22,51,51,22,22,
+21,20,6,7,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,7,22,
+23,22,23,54,54,53,52,38,39,35,34,38,53,52,54,55,38,53,52,54,54,51,33,21,1,
+54,54,53,52,38,35,34,6,21,20,22,22,5,6,21,20,22,51,50,54,53,52,38,3,1,1,3,
+100,88,69,39,34,69,92,1,25,254,223,103,68,35,57,63,83,163,168,172,169,73,
+167,149,139,168,84,190,200,172,142,145,161,135,22,64,64,44,172,177,95,95,
+66,146,168,49,50,115,95,154,145,2,82,251,144,78,86,75,72,68,80,22,58,1,115,
+148,81,73,72,77,80,89,1,179,254,106,6,27,17,40,37,37,44,20,154,52,44,31,45,
+19,45,185,130,130,169,33,61,77,107,112,110,105,92,57,28,163,128,104,144,139,
+105,122,78,3,4,5,9,13,114,95,73,101,33,125,111,57,86,37,75,123,84,106,44,
+154,251,216,22,76,50,52,60,64,49,37,49,45,204,28,84,42,45,45,42,43,58,254,
+162,7,38,250,42,0,0,4,0,60,255,206,5,104,6,244,0,64,0,76,0,77,0,78,0,0,1,
+34,6,6,21,20,22,22,51,33,21,33,34,6,21,20,22,22,51,51,4,0,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,34,38,
+53,52,54,55,38,53,52,54,54,51,33,21,1,38,38,35,34,6,21,20,22,51,50,54,23,
+1,2,214,88,69,39,34,69,92,1,25,254,223,103,68,35,57,63,134,1,1,1,36,209,189,
+95,154,79,71,136,92,141,158,164,125,92,149,123,90,117,78,105,111,213,213,
+98,146,168,49,50,115,95,154,145,2,82,252,232,72,80,51,60,73,80,68,66,91,203,
+1,111,6,27,17,40,37,37,44,20,154,52,44,31,45,19,64,254,178,228,197,226,80,
+91,97,74,169,137,130,166,89,159,118,75,134,125,175,238,62,125,111,57,86,37,
+75,123,84,106,44,154,250,245,95,56,79,67,66,84,75,252,7,38,0,4,0,60,255,206,
+5,30,6,244,0,75,0,87,0,88,0,89,0,0,1,34,6,6,21,20,22,22,51,33,21,33,34,6,
+21,20,22,22,51,51,22,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,
+35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,54,53,52,39,35,34,38,53,
+52,54,55,38,53,52,54,54,51,33,21,1,6,6,21,20,22,51,50,54,53,52,38,1,1,2,176,
+88,69,39,34,69,92,1,25,254,223,103,68,35,57,63,147,83,104,50,49,83,83,174,
+151,149,165,98,126,44,96,51,119,111,33,157,20,24,196,189,92,165,73,31,27,
+66,115,146,168,49,50,115,95,154,145,2,82,253,239,112,79,78,74,76,81,59,254,
+235,2,20,6,27,17,40,37,37,44,20,154,52,44,31,45,19,29,126,70,61,108,47,63,
+163,101,131,150,149,120,82,144,87,14,15,79,88,58,72,44,43,106,43,139,159,
+38,38,30,51,30,70,30,125,111,57,86,37,75,123,84,106,44,154,251,205,80,104,
+54,57,65,71,67,65,111,254,20,7,38,255,255,0,60,254,255,6,39,6,244,2,34,2,
+203,0,0,0,3,0,70,3,143,0,0,255,255,0,60,255,206,5,157,6,244,2,34,2,206,0,
+0,0,3,0,70,3,143,0,0,255,255,0,60,255,206,8,68,6,244,2,34,2,209,0,0,0,3,0,
+70,3,143,0,0,255,255,0,34,252,234,4,155,6,244,2,34,2,152,0,0,0,35,0,70,3,
+144,0,0,0,2,2,248,0,0,0,4,0,34,255,206,6,207,3,255,0,57,0,69,0,70,0,71,0,
+0,19,22,22,51,50,54,53,52,38,39,39,46,2,53,52,54,55,35,53,33,50,30,2,21,20,
+6,35,34,38,53,52,55,33,22,23,7,38,38,39,35,34,6,21,20,22,23,23,22,22,21,20,
+6,35,34,36,39,1,6,21,20,22,51,50,54,53,52,38,35,1,33,211,33,162,138,143,147,
+107,120,134,172,158,70,29,29,63,4,217,117,141,114,62,157,132,131,150,44,254,
+210,45,29,176,28,133,124,30,116,139,114,114,157,201,175,235,230,206,254,249,
+36,5,61,52,75,63,62,70,92,99,252,154,2,21,1,88,111,98,77,69,73,71,9,10,13,
+72,116,85,36,76,27,154,25,74,119,88,123,146,147,109,89,76,50,82,45,94,81,
+2,68,69,66,56,8,11,14,157,131,154,161,168,154,2,61,69,80,62,75,72,60,78,76,
+252,105,0,7,0,60,254,255,8,128,3,255,0,66,0,79,0,91,0,103,0,107,0,108,0,109,
+0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,
+50,22,22,21,20,7,22,22,51,50,54,53,16,37,35,53,5,38,35,34,6,21,20,22,51,50,
+54,53,52,37,6,21,20,22,51,50,54,53,52,38,35,1,38,38,35,34,6,21,20,22,51,50,
+54,19,19,51,19,39,33,6,206,117,141,114,62,157,132,131,150,44,254,101,116,
+119,224,190,96,167,102,72,168,96,145,154,150,128,76,153,95,34,73,3,150,124,
+120,159,176,143,148,211,111,72,70,128,77,119,120,254,171,127,254,142,38,44,
+72,83,67,61,68,73,5,30,52,75,63,62,70,92,99,251,18,73,108,57,58,62,78,68,
+65,106,78,15,154,15,21,3,6,3,255,25,74,119,88,123,146,147,109,89,76,88,238,
+138,200,231,59,70,65,64,127,106,98,122,55,62,80,109,183,100,21,21,114,137,
+146,119,116,153,135,243,135,158,128,47,42,134,125,1,40,179,154,150,11,71,
+57,60,66,67,63,59,50,69,80,62,75,72,60,78,76,253,90,51,40,42,35,35,43,32,
+254,96,1,34,254,222,207,0,0,5,0,75,255,206,7,55,3,255,0,40,0,52,0,53,0,54,
+0,55,0,0,37,54,54,53,52,38,35,34,6,21,20,22,23,7,38,17,52,54,55,35,53,33,
+50,30,2,21,20,6,35,34,38,53,52,55,33,22,21,20,6,7,1,6,21,20,22,51,50,54,53,
+52,38,35,1,33,37,3,13,99,61,178,172,157,182,75,85,171,159,75,72,154,5,58,
+117,141,114,62,157,132,131,150,44,254,172,130,70,90,2,16,52,75,63,62,70,92,
+99,252,114,2,85,253,165,59,140,193,107,180,190,196,172,118,210,114,75,248,
+1,13,109,191,68,154,25,74,119,88,123,146,147,109,89,76,129,217,143,252,144,
+3,117,69,80,62,75,72,60,78,76,252,105,50,255,255,0,60,254,255,10,235,6,244,
+2,34,2,157,0,0,0,3,2,210,0,156,0,0,255,255,0,73,255,206,8,45,6,244,0,34,0,
+25,0,0,0,2,2,211,0,0,0,4,0,52,255,206,8,181,3,255,0,56,0,68,0,69,0,70,0,0,
+1,21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,33,53,33,50,30,
+2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,55,35,53,37,6,21,20,22,51,50,54,53,52,38,35,1,33,2,19,230,94,83,97,
+123,10,159,8,127,94,108,109,241,196,254,64,5,87,117,141,114,62,157,132,131,
+150,44,254,45,113,134,202,168,115,143,67,54,148,119,147,184,61,57,202,7,17,
+52,75,63,62,70,92,99,251,170,3,10,2,168,145,54,176,78,92,126,115,113,128,
+129,130,177,251,47,154,25,74,119,88,123,146,147,109,89,76,73,249,150,199,
+224,77,99,87,89,178,143,63,126,44,152,189,69,80,62,75,72,60,78,76,252,105,
+0,5,0,52,254,255,8,181,3,255,0,56,0,68,0,72,0,73,0,74,0,0,1,21,6,21,20,22,
+51,50,54,55,51,22,22,51,50,54,53,52,38,39,33,53,33,50,30,2,21,20,6,35,34,
+38,53,52,55,33,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,35,53,37,
+6,21,20,22,51,50,54,53,52,38,35,1,19,51,19,39,33,2,19,230,94,83,97,123,10,
+159,8,127,94,108,109,241,196,254,64,5,87,117,141,114,62,157,132,131,150,44,
+254,45,113,134,202,168,115,143,67,54,148,119,147,184,61,57,202,7,17,52,75,
+63,62,70,92,99,251,88,15,154,15,102,3,10,2,168,145,54,176,78,92,126,115,113,
+128,129,130,177,251,47,154,25,74,119,88,123,146,147,109,89,76,73,249,150,
+199,224,77,99,87,89,178,143,63,126,44,152,189,69,80,62,75,72,60,78,76,251,
+154,1,34,254,222,207,0,0,5,0,73,255,206,8,65,3,255,0,89,0,101,0,102,0,103,
+0,104,0,0,1,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,
+38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,53,52,39,35,53,
+33,50,30,2,21,20,6,35,34,38,53,52,55,35,22,21,20,6,35,34,39,6,7,6,6,21,20,
+22,51,50,54,55,51,22,22,51,50,54,53,52,39,1,6,21,20,22,51,50,54,53,52,38,
+35,1,33,1,5,88,33,36,187,164,114,150,54,62,153,133,158,178,140,164,112,70,
+78,77,88,86,21,153,36,179,163,137,168,15,58,170,89,157,72,212,2,242,117,141,
+114,62,157,132,131,150,44,229,21,178,153,202,140,49,192,126,87,88,83,117,
+137,11,159,8,123,102,91,96,50,2,16,52,75,63,62,70,92,99,252,0,2,237,251,251,
+2,4,51,128,61,142,160,86,90,88,88,165,128,116,150,58,40,76,52,56,59,67,59,
+39,47,44,65,84,113,143,121,112,56,64,101,65,33,154,25,74,119,88,123,146,147,
+109,89,76,44,53,114,142,111,97,70,47,86,59,63,70,121,120,116,125,80,76,77,
+85,1,160,69,80,62,75,72,60,78,76,252,105,1,231,255,255,0,72,254,255,12,190,
+6,244,2,34,2,166,0,0,0,3,2,210,1,38,0,0,255,255,0,60,255,57,10,88,6,244,0,
+34,0,30,0,0,0,3,2,211,2,43,0,0,0,5,0,78,255,206,8,159,5,8,0,64,0,75,0,87,
+0,88,0,89,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,
+38,39,6,6,35,34,2,53,52,18,55,3,51,3,22,22,21,20,6,35,34,39,6,21,21,20,22,
+51,50,54,55,51,22,22,51,50,54,53,52,38,39,35,53,1,22,51,50,54,53,52,38,35,
+34,6,37,6,21,20,22,51,50,54,53,52,38,35,1,33,6,237,117,141,114,62,157,132,
+131,150,44,254,101,116,119,199,172,119,148,57,52,151,122,188,219,172,154,
+13,184,12,104,113,164,154,117,104,2,123,123,108,126,11,159,9,123,96,109,109,
+169,168,150,253,187,82,103,83,83,64,57,77,122,6,5,52,75,63,62,70,92,99,251,
+203,3,21,3,255,25,74,119,88,123,146,147,109,89,76,89,236,139,203,228,87,89,
+85,91,1,24,222,212,1,25,42,1,21,254,242,17,134,103,136,147,67,26,26,22,167,
+172,120,121,114,127,129,130,150,238,87,154,254,174,60,68,63,58,64,100,91,
+69,80,62,75,72,60,78,76,252,105,0,0,6,0,72,255,206,7,83,3,255,0,27,0,39,0,
+50,0,62,0,63,0,64,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,33,22,21,20,6,6,
+35,34,0,53,52,55,35,53,1,50,54,53,52,38,35,34,6,21,20,22,19,50,22,21,20,6,
+35,34,38,53,52,37,6,21,20,22,51,50,54,53,52,38,35,1,33,5,161,117,141,114,
+62,157,132,131,150,44,254,150,155,132,243,160,244,254,221,159,156,2,19,173,
+194,195,172,171,195,193,175,52,57,58,51,54,57,3,242,52,75,63,62,70,92,99,
+252,97,2,96,3,255,25,74,119,88,123,146,147,109,89,76,140,243,151,233,128,
+1,24,229,245,141,154,252,136,195,164,169,206,203,161,170,200,1,231,62,57,
+59,63,63,59,119,247,69,80,62,75,72,60,78,76,252,105,0,5,0,72,255,206,8,1,
+3,255,0,55,0,67,0,80,0,81,0,82,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,35,
+7,38,38,39,35,34,4,21,16,51,50,54,55,51,22,23,38,53,52,54,51,50,22,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,55,35,53,5,6,21,20,22,51,50,54,53,52,
+38,35,1,22,51,50,54,53,52,38,35,34,6,21,20,5,33,6,79,117,141,114,62,157,132,
+131,150,44,208,100,113,201,116,13,248,254,229,189,91,112,10,159,9,89,21,156,
+131,127,163,182,155,143,194,60,48,146,122,150,184,118,112,227,6,70,52,75,
+63,62,70,92,99,253,119,32,35,85,81,69,65,65,71,254,248,2,246,3,255,25,74,
+119,88,123,146,147,109,89,76,138,73,63,2,250,223,254,251,125,116,147,54,54,
+60,114,140,152,115,143,159,84,92,85,91,227,192,158,246,72,154,154,69,80,62,
+75,72,60,78,76,253,30,3,71,65,58,63,68,64,65,238,0,6,0,72,254,255,8,1,3,255,
+0,55,0,67,0,80,0,84,0,85,0,86,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,35,
+7,38,38,39,35,34,4,21,16,51,50,54,55,51,22,23,38,53,52,54,51,50,22,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,55,35,53,5,6,21,20,22,51,50,54,53,52,
+38,35,1,22,51,50,54,53,52,38,35,34,6,21,20,1,19,51,19,39,33,6,79,117,141,
+114,62,157,132,131,150,44,208,100,113,201,116,13,248,254,229,189,91,112,10,
+159,9,89,21,156,131,127,163,182,155,143,194,60,48,146,122,150,184,118,112,
+227,6,70,52,75,63,62,70,92,99,253,119,32,35,85,81,69,65,65,71,254,121,15,
+154,15,57,2,246,3,255,25,74,119,88,123,146,147,109,89,76,138,73,63,2,250,
+223,254,251,125,116,147,54,54,60,114,140,152,115,143,159,84,92,85,91,227,
+192,158,246,72,154,154,69,80,62,75,72,60,78,76,253,30,3,71,65,58,63,68,64,
+65,254,67,1,34,254,222,207,0,6,0,68,255,206,9,52,3,255,0,74,0,86,0,91,0,102,
+0,103,0,104,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,2,35,34,
+38,53,52,54,51,50,23,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,51,51,21,
+35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,55,38,38,53,52,55,35,
+53,5,6,21,20,22,51,50,54,53,52,38,35,5,54,55,35,22,1,38,35,34,6,21,20,22,
+51,50,54,5,33,7,130,117,141,114,62,157,132,131,150,44,254,171,62,68,216,200,
+143,163,162,146,144,101,152,123,94,124,16,159,28,163,127,97,109,126,124,110,
+144,119,108,87,79,73,117,59,137,90,185,122,158,176,90,88,79,83,54,63,7,121,
+52,75,63,62,70,92,99,251,123,17,26,96,32,2,76,90,123,67,80,74,71,81,107,253,
+216,3,78,3,255,25,74,119,88,123,146,147,109,89,76,58,203,125,245,254,248,
+150,130,129,153,84,37,172,208,118,100,106,113,76,69,71,78,153,76,78,65,77,
+73,79,103,110,92,150,126,89,128,32,34,122,80,77,57,154,154,69,80,62,75,72,
+60,78,76,59,29,30,32,253,208,115,74,59,66,72,78,249,0,0,7,0,73,255,206,8,
+170,4,74,0,52,0,62,0,74,0,86,0,87,0,88,0,89,0,0,1,50,30,2,21,20,6,35,34,38,
+53,52,55,33,22,22,21,20,0,33,32,0,53,52,54,51,50,22,21,20,6,35,34,39,22,4,
+51,50,36,55,6,35,34,38,53,52,54,55,38,39,33,53,3,22,51,50,53,52,38,35,34,
+6,5,38,38,35,34,6,21,20,22,51,50,54,1,6,21,20,22,51,50,54,53,52,38,35,1,33,
+1,6,248,117,141,114,62,157,132,131,150,44,254,41,153,147,254,143,254,167,
+254,162,254,128,210,164,127,147,173,151,94,69,43,1,35,228,249,1,34,33,89,
+127,121,149,108,101,72,121,254,63,225,66,82,186,64,57,82,113,4,93,28,94,57,
+60,76,71,64,65,96,1,254,52,75,63,62,70,92,99,251,200,3,29,251,35,4,74,25,
+74,119,88,123,146,147,109,89,76,73,215,158,243,254,231,1,21,235,179,229,138,
+114,127,148,34,129,137,161,154,83,137,114,94,133,25,42,32,154,253,221,41,
+131,53,55,104,10,54,60,63,57,55,64,66,1,112,69,80,62,75,72,60,78,76,252,30,
+4,50,0,7,0,72,254,255,8,42,3,255,0,34,0,53,0,64,0,76,0,80,0,81,0,82,0,0,1,
+35,53,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,6,
+6,35,34,38,53,52,54,1,51,22,22,51,50,54,53,52,38,35,35,34,6,21,20,22,51,50,
+19,50,22,21,20,6,35,34,38,53,52,37,6,21,20,22,51,50,54,53,52,38,35,1,19,51,
+19,39,33,1,24,205,6,45,117,141,114,62,157,132,131,150,44,254,119,98,104,181,
+159,109,144,58,48,146,122,152,182,106,1,209,159,18,113,82,97,92,241,218,31,
+221,252,92,97,164,131,52,57,58,51,54,57,4,84,52,75,63,62,70,92,99,251,162,
+15,154,15,92,2,211,3,101,154,25,74,119,88,123,146,147,109,89,76,73,235,151,
+206,230,82,94,85,91,234,202,147,238,254,63,101,110,138,139,211,246,242,210,
+143,139,2,20,62,57,59,63,63,59,119,202,69,80,62,75,72,60,78,76,251,154,1,
+34,254,222,207,0,5,0,72,255,206,8,42,3,255,0,34,0,53,0,65,0,66,0,67,0,0,1,
+35,53,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,6,
+6,35,34,38,53,52,54,1,51,22,22,51,50,54,53,52,38,35,35,34,6,21,20,22,51,50,
+1,6,21,20,22,51,50,54,53,52,38,35,1,33,1,24,205,6,45,117,141,114,62,157,132,
+131,150,44,254,119,98,104,181,159,109,144,58,48,146,122,152,182,106,1,209,
+159,18,113,82,97,92,241,218,31,221,252,92,97,164,4,104,52,75,63,62,70,92,
+99,251,254,2,211,3,101,154,25,74,119,88,123,146,147,109,89,76,73,235,151,
+206,230,82,94,85,91,234,202,147,238,254,63,101,110,138,139,211,246,242,210,
+143,139,2,222,69,80,62,75,72,60,78,76,252,105,0,0,6,0,72,254,255,8,42,3,255,
+0,34,0,53,0,65,0,69,0,70,0,71,0,0,1,35,53,33,50,30,2,21,20,6,35,34,38,53,
+52,55,33,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,1,51,22,22,51,50,
+54,53,52,38,35,35,34,6,21,20,22,51,50,1,6,21,20,22,51,50,54,53,52,38,35,1,
+19,51,19,39,33,1,24,205,6,45,117,141,114,62,157,132,131,150,44,254,119,98,
+104,181,159,109,144,58,48,146,122,152,182,106,1,209,159,18,113,82,97,92,241,
+218,31,221,252,92,97,164,4,104,52,75,63,62,70,92,99,251,162,15,154,15,92,
+2,211,3,101,154,25,74,119,88,123,146,147,109,89,76,73,235,151,206,230,82,
+94,85,91,234,202,147,238,254,63,101,110,138,139,211,246,242,210,143,139,2,
+222,69,80,62,75,72,60,78,76,251,154,1,34,254,222,207,0,5,0,60,255,206,8,62,
+3,255,0,54,0,66,0,67,0,68,0,69,0,0,1,33,53,33,50,30,2,21,20,6,35,34,38,53,
+52,55,33,22,22,21,20,6,35,34,38,39,38,38,35,34,6,21,20,22,23,7,38,38,53,52,
+54,51,50,22,22,23,22,22,51,50,54,53,52,38,37,6,21,20,22,51,50,54,53,52,38,
+35,1,33,37,3,0,253,199,5,197,117,141,114,62,157,132,131,150,44,254,50,111,
+131,209,189,126,184,132,73,69,46,47,61,45,52,166,52,47,157,120,70,102,82,
+80,110,120,77,103,113,221,3,1,52,75,63,62,70,92,99,251,229,2,207,252,87,3,
+101,154,25,74,119,88,123,146,147,109,89,76,74,253,145,199,224,119,179,98,
+59,76,60,67,125,72,56,84,152,83,126,168,44,78,106,146,77,133,127,168,246,
+60,69,80,62,75,72,60,78,76,252,105,50,255,255,0,60,255,206,8,62,6,244,0,34,
+2,179,0,0,0,2,2,212,0,0,255,255,0,60,254,255,8,62,6,244,0,34,2,182,0,0,0,
+2,2,212,0,0,0,5,0,73,255,206,8,117,3,255,0,76,0,88,0,89,0,90,0,91,0,0,1,50,
+30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,
+6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,35,53,5,6,21,20,
+22,51,50,54,53,52,38,35,1,33,1,6,195,117,141,114,62,157,132,131,150,44,254,
+101,116,119,199,172,119,148,57,62,153,133,158,178,140,164,112,70,78,77,88,
+86,21,153,36,179,163,155,167,120,152,126,87,88,83,117,137,11,159,9,123,96,
+109,109,172,172,143,3,223,52,75,63,62,70,92,99,251,224,3,0,251,212,3,255,
+25,74,119,88,123,146,147,109,89,76,89,236,139,203,228,87,89,88,88,165,128,
+116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,113,143,149,116,105,137,56,
+47,86,59,63,70,121,120,114,127,129,130,149,238,88,154,154,69,80,62,75,72,
+60,78,76,252,105,1,231,0,0,6,0,73,254,255,8,117,3,255,0,76,0,88,0,92,0,93,
+0,94,0,95,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,
+54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,
+39,35,53,5,6,21,20,22,51,50,54,53,52,38,35,1,19,51,19,39,33,1,6,195,117,141,
+114,62,157,132,131,150,44,254,101,116,119,199,172,119,148,57,62,153,133,158,
+178,140,164,112,70,78,77,88,86,21,153,36,179,163,155,167,120,152,126,87,88,
+83,117,137,11,159,9,123,96,109,109,172,172,143,3,223,52,75,63,62,70,92,99,
+251,130,15,154,15,90,3,0,251,212,3,255,25,74,119,88,123,146,147,109,89,76,
+89,236,139,203,228,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,
+47,44,65,84,113,143,149,116,105,137,56,47,86,59,63,70,121,120,114,127,129,
+130,149,238,88,154,154,69,80,62,75,72,60,78,76,251,154,1,34,254,222,207,1,
+231,255,255,0,60,255,206,10,235,6,244,2,34,2,189,0,0,0,3,2,210,0,241,0,0,
+255,255,0,72,255,206,12,190,6,244,2,34,2,195,0,0,0,3,2,210,4,29,0,0,0,5,0,
+72,255,206,7,83,3,255,0,27,0,39,0,51,0,52,0,53,0,0,1,50,30,2,21,20,6,35,34,
+38,53,52,55,33,22,21,20,6,6,35,34,0,53,52,55,35,53,1,50,54,53,52,38,35,34,
+6,21,20,22,1,6,21,20,22,51,50,54,53,52,38,35,1,33,5,161,117,141,114,62,157,
+132,131,150,44,254,150,155,132,243,160,244,254,221,159,156,2,19,173,194,195,
+172,171,195,193,4,50,52,75,63,62,70,92,99,252,97,2,96,3,255,25,74,119,88,
+123,146,147,109,89,76,140,243,151,233,128,1,24,229,245,141,154,252,136,195,
+164,169,206,203,161,170,200,2,222,69,80,62,75,72,60,78,76,252,105,0,6,0,73,
+255,206,9,42,3,255,0,45,0,56,0,84,0,96,0,97,0,98,0,0,1,33,38,38,53,52,55,
+35,53,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,21,20,2,35,34,38,39,6,6,
+35,34,38,38,53,52,18,51,50,22,21,20,37,22,51,50,54,53,52,38,35,34,6,1,53,
+6,35,34,39,21,20,22,51,50,54,55,51,22,51,50,54,53,52,38,35,34,6,21,20,23,
+21,1,6,21,20,22,51,50,54,53,52,38,35,1,33,2,158,1,121,58,49,22,187,4,113,
+117,141,114,62,157,132,131,150,44,254,193,105,243,198,117,148,58,48,147,129,
+136,202,107,216,172,123,147,254,28,68,88,83,83,65,53,75,107,1,69,73,108,94,
+85,143,136,103,123,24,159,44,197,127,147,110,100,53,72,191,2,173,52,75,63,
+62,70,92,99,251,114,3,72,2,64,41,98,65,49,40,154,25,74,119,88,123,146,147,
+109,89,76,128,219,251,254,215,81,95,85,91,133,247,157,237,1,19,140,119,117,
+23,45,68,63,57,65,107,254,165,93,36,47,19,170,204,101,110,211,208,175,161,
+192,65,58,142,34,148,1,189,69,80,62,75,72,60,78,76,252,105,0,5,0,72,255,206,
+8,67,3,255,0,45,0,56,0,68,0,69,0,70,0,0,1,50,30,2,21,20,6,35,34,38,53,52,
+55,33,22,22,21,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,39,22,4,51,50,
+36,53,52,38,39,35,53,1,22,51,50,54,53,52,38,35,34,6,37,6,21,20,22,51,50,54,
+53,52,38,35,1,33,6,145,117,141,114,62,157,132,131,150,44,254,159,71,73,254,
+179,254,194,254,205,254,162,217,171,123,148,166,153,93,86,9,1,5,220,230,1,
+0,122,112,163,253,197,71,90,83,84,65,54,78,111,5,206,52,75,63,62,70,92,99,
+251,232,2,214,3,255,25,74,119,88,123,146,147,109,89,76,71,183,102,255,0,254,
+229,1,57,1,7,217,1,0,141,118,133,150,47,182,211,195,179,115,191,54,154,254,
+163,49,68,63,56,66,105,96,69,80,62,75,72,60,78,76,252,105,0,7,0,60,255,206,
+7,222,3,255,0,51,0,63,0,76,0,87,0,88,0,89,0,90,0,0,1,50,30,2,21,20,6,35,34,
+38,53,52,55,33,22,21,20,6,7,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,
+50,22,21,20,7,22,23,22,23,54,54,53,52,39,33,53,5,6,21,20,22,51,50,54,53,52,
+38,35,1,54,54,53,52,38,35,34,6,21,20,22,22,5,6,21,20,22,51,50,54,53,52,38,
+3,33,1,6,44,117,141,114,62,157,132,131,150,44,254,196,85,172,169,73,167,149,
+139,168,84,190,200,172,142,145,161,135,22,64,64,44,172,177,175,254,205,4,
+16,52,75,63,62,70,92,99,250,217,78,86,75,72,68,80,22,58,1,115,148,81,73,72,
+77,80,89,2,149,253,136,3,255,25,74,119,88,123,146,147,109,89,76,74,132,130,
+169,33,61,77,107,112,110,105,92,57,28,163,128,104,144,139,105,122,78,3,4,
+5,9,13,114,95,139,68,154,154,69,80,62,75,72,60,78,76,254,142,22,76,50,52,
+60,64,49,37,49,45,204,28,84,42,45,45,42,43,58,254,162,1,80,0,5,0,60,255,206,
+8,62,3,255,0,46,0,58,0,70,0,71,0,72,0,0,37,6,6,35,34,38,53,52,54,51,50,22,
+23,22,22,51,50,54,53,52,38,39,33,53,33,50,30,2,21,20,6,35,34,38,53,52,55,
+33,22,22,21,20,6,35,34,38,1,6,21,20,22,51,50,54,53,52,38,35,1,38,38,35,34,
+6,21,20,22,51,50,54,23,33,2,146,71,136,92,141,158,164,125,92,149,123,90,117,
+78,105,111,222,204,253,179,5,197,117,141,114,62,157,132,131,150,44,254,70,
+111,131,209,189,95,154,3,237,52,75,63,62,70,92,99,251,67,72,80,51,60,73,80,
+68,66,91,203,2,217,145,97,74,169,137,130,166,89,159,118,75,134,125,170,246,
+59,154,25,74,119,88,123,146,147,109,89,76,74,253,145,197,226,80,3,47,69,80,
+62,75,72,60,78,76,253,171,95,56,79,67,66,84,75,252,0,5,0,60,255,206,6,240,
+3,255,0,55,0,67,0,79,0,80,0,81,0,0,1,54,54,53,52,39,33,53,33,50,30,2,21,20,
+6,35,34,38,53,52,55,33,22,21,20,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,
+35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,37,6,21,20,22,51,50,54,53,52,38,
+35,1,6,6,21,20,22,51,50,54,53,52,38,1,33,3,7,31,27,56,253,179,4,130,117,141,
+114,62,157,132,131,150,44,254,242,17,99,83,83,174,151,149,165,98,126,44,96,
+51,119,111,33,157,20,24,196,189,92,165,2,194,52,75,63,62,70,92,99,253,114,
+112,79,78,74,76,81,59,254,235,2,51,2,146,30,51,30,69,31,154,25,74,119,88,
+123,146,147,109,89,76,32,39,121,95,63,163,101,131,150,149,120,82,144,87,14,
+15,79,88,58,72,44,43,106,43,139,159,38,173,69,80,62,75,72,60,78,76,254,131,
+80,104,54,57,65,71,67,65,111,254,20,0,255,255,0,60,254,255,8,62,6,244,0,34,
+2,204,0,0,0,2,2,212,0,0,255,255,0,60,255,206,8,62,6,244,0,34,2,207,0,0,0,
+2,2,212,0,0,0,6,0,60,255,206,8,126,6,244,0,23,0,85,0,97,0,109,0,110,0,111,
+0,0,1,30,2,51,50,54,55,55,54,54,55,23,14,2,7,7,6,6,35,34,38,39,5,38,53,52,
+54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,33,22,
+22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,
+52,38,39,53,55,55,5,6,21,20,22,51,50,54,53,52,38,35,1,38,38,35,34,6,21,20,
+22,51,50,54,5,1,1,27,20,38,43,32,40,72,66,63,106,174,129,11,71,88,75,66,47,
+84,149,93,117,137,37,5,200,10,161,128,113,149,40,156,37,106,61,77,16,161,
+172,157,132,131,150,44,254,84,122,130,205,186,98,157,80,71,136,92,141,158,
+164,125,92,149,123,91,116,83,101,110,181,177,1,73,3,20,52,75,63,62,70,92,
+99,251,91,72,80,51,60,73,80,68,66,91,2,21,3,54,4,187,77,80,31,50,85,82,139,
+105,1,158,4,34,65,85,61,109,100,151,136,133,32,44,104,126,93,103,40,101,61,
+51,37,25,7,155,141,123,146,147,109,89,76,92,246,135,199,223,79,92,97,74,169,
+137,130,166,89,159,120,73,131,120,146,244,92,1,2,152,154,69,80,62,75,72,60,
+78,76,253,171,95,56,79,67,66,84,75,252,7,38,0,255,255,0,34,252,234,6,207,
+3,255,2,34,0,138,0,0,0,2,2,248,0,0,255,255,0,34,255,206,4,41,6,244,2,34,2,
+152,0,0,0,3,0,58,4,26,0,0,0,8,0,60,254,255,5,252,6,244,0,43,0,55,0,74,0,87,
+0,98,0,102,0,103,0,104,0,0,1,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,
+50,23,38,38,53,52,54,51,50,0,18,21,20,2,35,34,38,39,6,35,34,38,53,52,54,51,
+50,22,19,38,35,34,6,21,20,22,51,50,53,52,55,22,21,20,6,7,22,22,21,20,7,22,
+22,51,50,54,53,52,2,1,38,35,34,6,21,20,22,51,50,54,53,52,19,38,38,35,34,6,
+21,20,22,51,50,19,19,51,19,55,19,2,150,34,73,3,150,124,120,159,176,143,22,
+40,26,25,178,148,223,1,114,210,253,226,91,167,101,143,192,145,154,150,128,
+76,153,212,33,34,74,83,60,56,128,137,7,136,121,84,92,72,65,131,78,155,143,
+230,253,102,38,44,72,83,67,61,68,73,76,69,112,58,58,62,78,68,131,118,15,154,
+15,8,13,1,54,80,109,183,100,21,21,114,137,146,119,116,153,4,32,77,44,122,
+141,254,253,254,67,252,248,254,255,59,70,129,127,106,98,122,55,3,148,6,63,
+51,53,60,130,44,1,37,28,114,133,4,70,223,123,158,128,45,44,174,170,238,1,
+170,254,242,11,71,57,60,66,67,63,59,253,140,49,42,42,35,35,43,254,128,1,34,
+254,222,207,7,38,0,0,4,0,82,255,206,4,87,5,118,0,34,0,46,0,47,0,48,0,0,37,
+54,54,53,52,38,35,34,6,21,20,22,23,7,38,17,52,54,55,38,53,52,54,51,50,22,
+21,20,7,22,22,21,20,6,7,3,38,38,35,34,6,21,20,23,54,51,50,3,39,3,13,99,61,
+178,172,157,182,75,85,171,159,105,96,68,179,164,202,238,7,60,60,70,90,113,
+17,143,119,88,94,44,81,101,130,137,6,59,140,193,107,180,190,196,172,118,210,
+114,75,248,1,13,135,224,69,80,101,132,156,246,192,40,46,66,175,110,143,252,
+144,3,228,125,138,75,63,64,44,26,251,207,50,0,255,255,0,60,254,255,8,118,
+6,244,2,34,2,155,0,0,0,3,0,58,3,239,0,0,255,255,0,73,255,206,5,217,6,244,
+2,34,0,25,0,0,0,3,0,58,6,22,0,0,0,5,0,52,255,206,5,215,6,244,0,51,0,63,0,
+64,0,65,0,66,0,0,37,6,6,35,34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,
+54,55,51,22,22,51,50,54,53,52,0,39,22,21,20,6,35,34,38,53,52,54,51,50,0,18,
+17,20,6,35,34,38,3,38,35,34,6,21,20,22,51,50,53,52,19,19,1,3,20,54,148,119,
+147,184,61,57,202,1,223,230,94,83,97,123,10,159,8,127,94,123,106,254,253,
+205,7,147,128,125,142,180,156,213,1,134,230,194,188,115,143,154,33,33,73,
+84,59,57,128,62,31,253,145,150,87,89,178,143,63,126,44,152,145,54,176,78,
+92,126,115,113,128,167,162,230,1,190,101,37,27,115,136,143,103,124,139,254,
+248,254,63,255,0,243,249,77,4,214,5,63,52,53,59,130,49,250,240,7,38,253,11,
+0,0,6,0,52,254,255,5,215,6,244,0,51,0,63,0,67,0,68,0,69,0,70,0,0,37,6,6,35,
+34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,
+52,0,39,22,21,20,6,35,34,38,53,52,54,51,50,0,18,17,20,6,35,34,38,3,38,35,
+34,6,21,20,22,51,50,53,52,3,19,51,19,39,19,1,3,20,54,148,119,147,184,61,57,
+202,1,223,230,94,83,97,123,10,159,8,127,94,123,106,254,253,205,7,147,128,
+125,142,180,156,213,1,134,230,194,188,115,143,154,33,33,73,84,59,57,128,26,
+15,154,15,96,31,253,145,150,87,89,178,143,63,126,44,152,145,54,176,78,92,
+126,115,113,128,167,162,230,1,190,101,37,27,115,136,143,103,124,139,254,248,
+254,63,255,0,243,249,77,4,214,5,63,52,53,59,130,49,250,33,1,34,254,222,207,
+7,38,253,11,0,5,0,73,255,206,5,157,6,244,0,84,0,96,0,97,0,98,0,99,0,0,1,6,
+7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,39,55,22,22,21,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,53,52,39,6,35,34,38,53,52,54,51,50,22,
+22,21,20,6,35,34,1,38,38,35,34,6,21,20,22,51,50,54,1,19,1,2,194,49,192,126,
+87,88,83,117,137,11,159,8,123,102,91,96,50,151,33,36,187,164,114,150,54,62,
+153,133,158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,137,168,15,57,
+169,91,102,106,1,90,146,120,141,152,126,110,170,92,191,173,202,1,113,32,88,
+56,65,67,64,50,63,91,254,85,67,254,165,2,115,97,70,47,86,59,63,70,121,120,
+116,125,80,76,77,85,63,51,128,61,142,160,86,90,88,88,165,128,116,150,58,40,
+76,52,56,59,67,59,39,47,44,65,84,113,143,121,112,56,64,100,97,11,5,5,87,114,
+106,104,128,101,181,104,163,188,1,254,46,47,51,47,42,44,44,251,251,7,38,250,
+193,0,0,5,0,72,254,255,10,0,5,118,0,62,0,74,0,86,0,90,0,91,0,0,37,6,6,35,
+34,0,53,52,54,55,38,38,53,52,54,51,50,22,21,20,7,22,22,21,20,7,22,22,51,50,
+54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,
+6,35,34,39,6,6,35,34,1,38,38,35,34,6,21,20,23,54,51,50,3,50,54,53,52,38,35,
+34,6,21,20,22,1,19,51,19,37,4,33,70,232,148,244,254,221,114,106,29,35,179,
+164,202,238,8,69,70,18,81,164,97,105,110,175,184,76,211,242,5,80,158,91,105,
+110,175,184,76,211,242,206,192,208,159,50,171,121,228,254,138,15,145,119,
+88,94,42,84,91,134,135,173,194,195,172,171,195,193,5,2,15,154,15,253,185,
+188,104,110,1,24,229,144,234,72,34,95,48,132,156,246,192,51,42,74,191,116,
+77,69,104,101,133,126,152,234,85,158,92,254,184,198,42,39,98,91,133,126,152,
+234,85,158,92,254,184,198,206,225,179,90,89,3,232,129,140,75,63,64,43,25,
+252,136,195,164,169,206,203,161,170,200,254,120,1,34,254,222,207,0,255,255,
+0,60,255,57,7,212,6,244,2,34,0,30,0,0,0,3,0,58,8,90,0,0,255,255,0,78,255,
+206,6,42,6,244,2,34,2,168,0,0,0,3,0,58,6,132,0,0,0,5,0,72,255,206,4,118,5,
+118,0,23,0,35,0,47,0,58,0,59,0,0,1,38,38,53,52,54,51,50,22,21,20,7,22,22,
+21,20,6,6,35,34,0,53,52,54,37,38,38,35,34,6,21,20,23,54,51,50,3,50,54,53,
+52,38,35,34,6,21,20,22,19,50,22,21,20,6,35,34,38,53,52,19,1,36,29,35,179,
+164,202,238,8,69,70,132,243,160,244,254,221,114,2,153,15,145,119,88,94,42,
+84,91,134,135,173,194,195,172,171,195,193,175,52,57,58,51,54,57,110,3,165,
+34,95,48,132,156,246,192,51,42,74,191,116,151,233,128,1,24,229,144,234,113,
+129,140,75,63,64,43,25,252,136,195,164,169,206,203,161,170,200,1,231,62,57,
+59,63,63,59,119,253,96,255,255,0,72,255,206,5,236,6,244,2,34,2,170,0,0,0,
+3,0,58,5,41,0,0,255,255,0,72,254,255,5,236,6,244,2,34,2,171,0,0,0,3,0,58,
+5,41,0,0,255,255,0,68,255,206,6,156,6,244,2,34,0,35,0,0,0,3,0,58,6,215,0,
+0,0,7,0,73,255,206,6,1,6,244,0,54,0,66,0,76,0,88,0,89,0,90,0,91,0,0,19,22,
+4,51,50,36,55,6,35,34,38,53,52,54,51,50,23,38,38,39,22,21,20,6,35,34,38,53,
+52,54,51,50,4,18,21,20,7,22,21,16,0,33,32,0,53,52,54,51,50,22,21,20,6,35,
+34,1,38,35,34,6,21,20,22,51,50,53,52,1,22,51,50,53,52,38,35,34,6,5,38,38,
+35,34,6,21,20,22,51,50,54,1,1,19,234,43,1,35,228,249,1,34,33,89,127,122,148,
+159,140,74,77,8,199,165,16,147,128,125,142,187,169,214,1,71,170,8,44,254,
+139,254,155,254,162,254,128,210,164,127,147,173,151,94,1,249,27,27,79,89,
+59,57,128,253,162,66,82,186,64,57,82,113,4,93,28,94,57,60,76,71,64,65,96,
+253,233,1,34,8,1,145,129,137,161,154,83,141,121,122,143,36,125,192,37,48,
+47,115,136,144,103,122,140,142,254,248,179,35,44,80,106,254,245,254,228,1,
+21,235,179,229,138,114,127,148,3,97,2,62,53,53,59,130,48,253,134,41,131,53,
+55,104,10,54,60,63,57,55,64,66,253,142,7,38,253,11,0,6,0,72,254,255,5,93,
+5,118,0,28,0,40,0,59,0,70,0,74,0,75,0,0,1,38,53,52,54,51,50,22,22,21,20,7,
+22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,37,38,38,35,34,6,21,20,23,
+54,51,50,3,51,22,22,51,50,54,53,52,38,35,35,34,6,21,20,22,51,50,19,50,22,
+21,20,6,35,34,38,53,52,19,19,51,19,39,1,100,64,200,182,146,222,123,4,102,
+110,181,159,109,144,58,48,146,122,152,182,147,3,17,19,173,141,104,113,47,
+105,125,151,239,159,18,113,82,97,92,241,218,31,221,252,92,97,164,131,52,57,
+58,51,54,57,17,15,154,15,92,3,165,80,97,131,157,111,202,125,25,46,82,246,
+151,206,230,82,94,85,91,234,202,175,1,15,121,123,143,77,61,66,46,30,253,91,
+101,110,138,139,211,246,242,210,143,139,2,20,62,57,59,63,63,59,119,252,100,
+1,34,254,222,207,0,0,4,0,72,255,206,5,93,5,118,0,28,0,40,0,60,0,61,0,0,1,
+38,53,52,54,51,50,22,22,21,20,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,
+52,18,37,38,38,35,34,6,21,20,23,54,51,50,3,51,22,22,51,50,54,53,52,38,35,
+35,34,6,21,20,22,51,50,54,19,1,100,64,200,182,146,222,123,4,102,110,181,159,
+109,144,58,48,146,122,152,182,147,3,17,19,173,141,104,113,47,105,125,151,
+239,159,8,119,86,97,92,241,218,31,221,252,92,97,88,115,90,3,165,80,97,131,
+157,111,202,125,25,46,82,246,151,206,230,82,94,85,91,234,202,175,1,15,121,
+123,143,77,61,66,46,30,253,121,114,127,138,139,211,246,242,210,143,139,127,
+254,200,0,5,0,72,254,255,5,93,5,118,0,28,0,40,0,60,0,64,0,65,0,0,1,38,53,
+52,54,51,50,22,22,21,20,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,
+37,38,38,35,34,6,21,20,23,54,51,50,3,51,22,22,51,50,54,53,52,38,35,35,34,
+6,21,20,22,51,50,54,3,19,51,19,39,1,100,64,200,182,146,222,123,4,102,110,
+181,159,109,144,58,48,146,122,152,182,147,3,17,19,173,141,104,113,47,105,
+125,151,239,159,8,119,86,97,92,241,218,31,221,252,92,97,88,115,2,15,154,15,
+92,3,165,80,97,131,157,111,202,125,25,46,82,246,151,206,230,82,94,85,91,234,
+202,175,1,15,121,123,143,77,61,66,46,30,253,121,114,127,138,139,211,246,242,
+210,143,139,127,253,249,1,34,254,222,207,0,0,6,0,60,255,206,5,84,6,244,0,
+50,0,62,0,63,0,64,0,65,0,66,0,0,1,22,21,20,6,35,34,38,53,52,54,51,50,0,18,
+17,20,6,35,34,38,39,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,22,
+23,30,2,51,50,54,53,52,0,37,38,35,34,6,21,20,22,51,50,53,52,19,39,1,3,2,218,
+7,147,128,125,142,180,156,213,1,134,230,198,200,126,184,132,79,65,37,52,63,
+45,52,166,52,47,157,120,70,103,80,81,71,84,88,60,112,108,254,253,254,147,
+33,33,73,84,59,57,128,127,218,1,59,23,4,217,37,27,115,136,144,102,124,139,
+254,248,254,63,255,0,249,243,119,179,108,49,76,60,67,125,72,56,84,152,83,
+126,168,45,77,106,94,88,41,164,165,230,1,190,149,5,63,52,53,59,130,49,250,
+240,50,6,244,253,11,0,255,255,0,60,255,206,5,104,6,244,2,34,2,178,0,0,0,3,
+0,58,3,239,0,0,255,255,0,60,254,255,5,104,6,244,2,34,2,181,0,0,0,3,0,58,3,
+239,0,0,0,6,0,73,255,206,5,227,6,244,0,43,0,55,0,85,0,86,0,87,0,88,0,0,37,
+6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,23,38,38,53,52,54,51,50,0,18,21,20,2,35,34,38,3,38,35,34,6,21,20,22,51,
+50,53,52,3,22,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,
+52,2,39,22,21,20,6,3,1,1,3,0,62,153,133,158,178,140,164,112,70,78,77,88,86,
+21,153,36,179,163,22,20,25,24,178,149,203,1,102,211,213,191,126,151,42,38,
+29,74,83,60,56,128,128,30,31,120,152,126,87,88,83,117,137,11,159,9,123,96,
+134,128,219,175,5,144,14,254,190,1,91,150,88,88,165,128,116,150,58,40,76,
+52,56,59,67,59,39,47,44,65,84,113,143,2,32,76,43,124,139,255,0,254,74,237,
+249,254,231,85,4,204,7,63,51,53,60,130,44,254,197,35,84,49,105,137,56,47,
+86,59,63,70,121,120,114,127,178,188,207,1,166,99,26,26,118,133,252,48,1,231,
+5,63,0,0,7,0,73,254,255,5,227,6,244,0,43,0,55,0,85,0,89,0,90,0,91,0,92,0,
+0,37,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,
+54,51,50,23,38,38,53,52,54,51,50,0,18,21,20,2,35,34,38,3,38,35,34,6,21,20,
+22,51,50,53,52,3,22,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,
+54,53,52,2,39,22,21,20,6,3,19,51,19,39,1,1,3,0,62,153,133,158,178,140,164,
+112,70,78,77,88,86,21,153,36,179,163,22,20,25,24,178,149,203,1,102,211,213,
+191,126,151,42,38,29,74,83,60,56,128,128,30,31,120,152,126,87,88,83,117,137,
+11,159,9,123,96,134,128,219,175,5,144,130,15,154,15,68,254,190,1,91,150,88,
+88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,113,143,2,32,76,
+43,124,139,255,0,254,74,237,249,254,231,85,4,204,7,63,51,53,60,130,44,254,
+197,35,84,49,105,137,56,47,86,59,63,70,121,120,114,127,178,188,207,1,166,
+99,26,26,118,133,251,97,1,34,254,222,207,1,231,5,63,0,6,0,60,255,206,8,45,
+6,244,0,61,0,73,0,85,0,86,0,87,0,88,0,0,1,22,22,51,50,54,53,52,38,39,55,22,
+18,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,0,39,22,21,20,6,35,34,38,53,52,54,51,50,0,18,17,20,1,38,
+35,34,6,21,20,22,51,50,53,52,3,38,38,35,34,6,21,20,22,51,50,54,5,1,1,5,96,
+78,160,94,105,110,175,184,76,211,242,206,192,210,159,45,170,125,95,154,79,
+71,136,92,141,158,164,125,92,149,123,90,117,78,111,105,254,254,206,7,147,
+128,125,142,180,156,212,1,133,232,252,230,33,33,73,84,59,57,128,55,72,80,
+51,60,73,80,68,66,91,2,46,254,244,2,204,1,72,98,95,133,126,152,234,85,158,
+92,254,184,198,206,225,181,91,90,80,91,97,74,169,137,130,166,89,159,118,75,
+162,164,230,1,192,102,37,27,115,136,144,102,124,139,254,251,254,57,254,250,
+70,3,134,5,63,52,53,59,130,49,252,50,95,56,79,67,66,84,75,252,7,38,252,113,
+0,4,0,72,255,206,10,0,3,255,0,53,0,65,0,66,0,67,0,0,37,6,6,35,34,39,6,6,35,
+34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,
+21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,37,50,54,53,52,
+38,35,34,6,21,20,22,5,3,7,3,50,171,121,228,168,70,232,148,244,254,221,136,
+244,155,157,246,132,18,81,164,97,105,110,175,184,76,211,242,5,80,158,91,105,
+110,175,184,76,211,242,206,192,208,250,188,172,195,195,172,171,195,193,3,
+115,66,153,90,89,214,104,110,1,24,229,158,249,133,133,246,158,77,69,104,101,
+133,126,152,234,85,158,92,254,184,198,42,39,98,91,133,126,152,234,85,158,
+92,254,184,198,206,225,161,192,164,168,203,200,161,168,198,185,3,151,0,0,
+4,0,72,255,206,4,118,5,118,0,23,0,35,0,47,0,48,0,0,1,38,38,53,52,54,51,50,
+22,21,20,7,22,22,21,20,6,6,35,34,0,53,52,54,37,38,38,35,34,6,21,20,23,54,
+51,50,3,50,54,53,52,38,35,34,6,21,20,22,23,1,36,29,35,179,164,202,238,8,69,
+70,132,243,160,244,254,221,114,2,153,15,145,119,88,94,42,84,91,134,135,173,
+194,195,172,171,195,193,174,3,165,34,95,48,132,156,246,192,51,42,74,191,116,
+151,233,128,1,24,229,144,234,113,129,140,75,63,64,43,25,252,136,195,164,169,
+206,203,161,170,200,185,255,255,0,73,255,206,6,143,6,244,2,34,0,48,0,0,0,
+3,0,58,7,2,0,0,0,6,0,72,255,206,5,148,6,244,0,41,0,53,0,64,0,65,0,66,0,67,
+0,0,19,22,22,51,32,36,53,52,2,39,22,21,20,6,35,34,38,53,52,54,51,50,4,18,
+21,16,0,33,32,0,17,52,54,54,51,50,22,21,20,6,35,34,1,38,35,34,6,21,20,22,
+51,50,53,52,1,22,51,50,54,53,52,38,35,34,6,1,19,1,234,14,251,224,1,10,1,13,
+163,148,5,144,129,125,142,176,154,189,1,61,180,254,155,254,161,254,197,254,
+179,104,177,107,123,148,166,153,93,1,213,38,29,74,83,60,56,128,253,200,71,
+91,83,84,65,54,80,112,1,236,65,253,213,1,191,154,158,253,250,191,1,57,90,
+27,28,118,133,140,104,123,142,206,254,147,220,254,178,254,176,1,22,1,2,130,
+199,104,141,118,133,150,3,118,7,63,51,53,60,130,44,253,121,49,68,63,56,66,
+108,253,28,7,38,253,11,0,0,8,0,60,255,206,5,42,6,244,0,48,0,60,0,73,0,84,
+0,85,0,86,0,87,0,88,0,0,1,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,
+50,22,21,20,7,22,23,22,23,54,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,
+51,50,4,18,21,20,6,1,38,35,34,6,21,20,22,51,50,53,52,1,54,54,53,52,38,35,
+34,6,21,20,22,22,5,6,21,20,22,51,50,54,53,52,38,3,19,1,1,3,152,69,167,149,
+139,168,84,190,200,172,142,145,161,135,22,64,60,43,213,206,157,144,11,147,
+128,125,142,179,165,188,1,45,168,201,254,86,31,34,73,84,59,57,128,254,149,
+78,86,75,72,68,80,22,58,1,115,148,81,73,72,77,80,58,124,253,213,1,173,1,72,
+61,74,107,112,110,105,92,57,28,163,128,104,144,139,105,122,78,3,4,5,9,18,
+176,164,164,244,52,39,42,115,136,141,104,126,138,158,254,224,179,200,241,
+3,154,3,63,52,53,59,130,50,253,20,22,76,50,52,60,64,49,37,49,45,204,28,84,
+42,45,45,42,43,58,254,162,7,38,253,11,253,31,0,6,0,60,255,206,5,104,6,244,
+0,41,0,53,0,65,0,66,0,67,0,68,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,0,39,22,21,20,6,35,34,38,53,52,54,51,50,0,18,17,20,6,35,
+34,38,3,38,35,34,6,21,20,22,51,50,53,52,3,38,38,35,34,6,21,20,22,51,50,54,
+23,19,3,2,146,71,136,92,141,158,164,125,92,149,123,90,117,78,111,105,254,
+254,206,7,147,128,125,142,180,156,212,1,133,232,196,202,95,154,147,33,33,
+73,84,59,57,128,55,72,80,51,60,73,80,68,66,91,203,87,23,145,97,74,169,137,
+130,166,89,159,118,75,162,164,230,1,192,102,37,27,115,136,144,102,124,139,
+254,251,254,57,254,250,246,237,80,4,211,5,63,52,53,59,130,49,252,50,95,56,
+79,67,66,84,75,252,7,38,253,11,0,6,0,60,255,206,4,40,6,244,0,52,0,64,0,76,
+0,77,0,78,0,79,0,0,1,22,22,21,20,6,35,34,38,53,52,54,55,38,38,35,34,6,21,
+20,23,7,38,38,53,52,54,51,50,22,23,54,54,53,52,38,39,22,21,20,6,35,34,38,
+53,52,54,51,50,4,21,20,6,1,38,35,34,6,21,20,22,51,50,53,52,19,6,6,21,20,22,
+51,50,54,53,52,38,1,19,3,3,127,84,85,174,151,149,165,98,126,46,95,48,120,
+112,33,157,20,24,196,189,89,162,73,65,65,93,93,13,147,128,125,142,182,163,
+245,1,34,83,254,89,28,37,73,84,59,57,128,201,112,79,78,74,76,81,59,254,235,
+252,23,2,72,63,164,102,131,150,149,120,82,144,87,14,15,79,88,58,72,44,43,
+106,43,139,159,36,36,65,141,77,91,134,32,44,41,115,136,140,104,124,141,232,
+189,115,176,2,56,3,63,52,53,59,130,50,253,69,80,104,54,57,65,71,67,64,111,
+254,21,7,38,253,11,255,255,0,60,254,255,6,39,6,244,2,34,2,203,0,0,0,3,0,58,
+3,239,0,0,255,255,0,60,255,206,5,157,6,244,2,34,2,206,0,0,0,3,0,58,3,239,
+0,0,255,255,0,60,255,206,8,68,6,244,2,34,2,209,0,0,0,3,0,58,3,239,0,0,255,
+255,0,34,252,234,4,155,6,244,2,34,2,152,0,0,0,35,0,58,4,26,0,0,0,2,2,248,
+0,0,255,255,0,34,255,206,4,41,6,244,2,34,2,152,0,0,0,3,0,59,4,26,0,0,0,8,
+0,60,254,255,5,252,6,244,0,61,0,73,0,92,0,105,0,116,0,120,0,121,0,122,0,0,
+1,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,23,38,38,53,52,54,55,38,
+53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,51,50,0,18,21,20,2,35,34,38,
+39,6,35,34,38,53,52,54,51,50,22,19,38,35,34,6,21,20,22,51,50,53,52,55,22,
+21,20,6,7,22,22,21,20,7,22,22,51,50,54,53,52,2,1,38,35,34,6,21,20,22,51,50,
+54,53,52,19,38,38,35,34,6,21,20,22,51,50,19,19,51,19,55,19,2,150,34,73,3,
+150,124,120,159,176,143,22,40,26,25,57,58,34,161,128,113,149,40,156,37,106,
+61,77,21,33,37,223,1,114,210,253,226,91,167,101,143,192,145,154,150,128,76,
+153,212,33,34,74,83,60,56,128,137,7,136,121,84,92,72,65,131,78,155,143,230,
+253,102,38,44,72,83,67,61,68,73,76,69,112,58,58,62,78,68,131,118,15,154,15,
+8,113,1,54,80,109,183,100,21,21,114,137,146,119,116,153,4,32,77,44,69,105,
+37,56,77,104,126,93,103,40,101,61,51,37,32,5,254,253,254,67,252,248,254,255,
+59,70,129,127,106,98,122,55,3,148,6,63,51,53,60,130,44,1,37,28,114,133,4,
+70,223,123,158,128,45,44,174,170,238,1,170,254,242,11,71,57,60,66,67,63,59,
+253,140,49,42,42,35,35,43,254,128,1,34,254,222,207,7,38,0,0,5,0,82,255,206,
+4,87,6,244,0,51,0,63,0,64,0,65,0,66,0,0,37,54,54,53,52,38,35,34,6,21,20,22,
+23,7,38,17,52,54,55,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,
+20,23,51,50,22,21,20,7,22,22,21,20,6,7,3,38,38,35,34,6,21,20,23,54,51,50,
+3,39,19,3,13,99,61,178,172,157,182,75,85,171,159,105,96,68,89,86,31,161,128,
+113,149,40,156,37,106,61,77,33,12,202,238,7,60,60,70,90,113,17,143,119,88,
+94,44,81,101,130,137,6,25,59,140,193,107,180,190,196,172,118,210,114,75,248,
+1,13,135,224,69,80,101,90,137,33,58,71,104,126,93,103,40,101,61,51,45,39,
+246,192,40,46,66,175,110,143,252,144,3,228,125,138,75,63,64,44,26,251,207,
+50,6,244,255,255,0,60,254,255,8,118,6,244,2,34,2,155,0,0,0,3,0,59,3,239,0,
+0,255,255,0,73,255,206,5,217,6,244,2,34,0,25,0,0,0,3,0,59,6,22,0,0,0,5,0,
+52,255,206,5,215,6,244,0,69,0,81,0,82,0,83,0,84,0,0,37,6,6,35,34,38,53,52,
+54,55,35,53,33,21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,0,39,22,
+21,20,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,
+54,51,50,0,18,17,20,6,35,34,38,3,38,35,34,6,21,20,22,51,50,53,52,19,19,3,
+3,20,54,148,119,147,184,61,57,202,1,223,230,94,83,97,123,10,159,8,127,94,
+123,106,254,253,205,7,147,128,125,142,57,58,34,161,128,113,149,40,156,37,
+106,61,77,21,38,42,213,1,134,230,194,188,115,143,154,33,33,73,84,59,57,128,
+62,171,23,150,87,89,178,143,63,126,44,152,145,54,176,78,92,126,115,113,128,
+167,162,230,1,190,101,37,27,115,136,143,103,70,106,35,56,77,104,126,93,103,
+40,101,61,51,37,32,5,254,248,254,63,255,0,243,249,77,4,214,5,63,52,53,59,
+130,49,250,240,7,38,253,11,0,6,0,52,254,255,5,215,6,244,0,69,0,81,0,85,0,
+86,0,87,0,88,0,0,37,6,6,35,34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,
+54,55,51,22,22,51,50,54,53,52,0,39,22,21,20,6,35,34,38,53,52,54,55,38,53,
+52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,51,50,0,18,17,20,6,35,34,38,3,
+38,35,34,6,21,20,22,51,50,53,52,3,19,51,19,39,19,3,3,20,54,148,119,147,184,
+61,57,202,1,223,230,94,83,97,123,10,159,8,127,94,123,106,254,253,205,7,147,
+128,125,142,57,58,34,161,128,113,149,40,156,37,106,61,77,21,38,42,213,1,134,
+230,194,188,115,143,154,33,33,73,84,59,57,128,26,15,154,15,96,171,23,150,
+87,89,178,143,63,126,44,152,145,54,176,78,92,126,115,113,128,167,162,230,
+1,190,101,37,27,115,136,143,103,70,106,35,56,77,104,126,93,103,40,101,61,
+51,37,32,5,254,248,254,63,255,0,243,249,77,4,214,5,63,52,53,59,130,49,250,
+33,1,34,254,222,207,7,38,253,11,0,0,5,0,73,255,206,5,157,6,244,0,103,0,114,
+0,115,0,116,0,117,0,0,1,6,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,
+53,52,39,55,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,
+38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,53,53,52,39,
+6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,51,
+50,22,22,21,20,6,35,34,1,38,35,34,6,21,20,22,51,50,54,9,2,2,194,25,120,96,
+126,87,88,83,117,137,11,159,8,123,102,91,96,50,151,33,36,187,164,114,150,
+54,62,153,133,158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,137,168,
+15,57,169,91,102,106,1,90,146,120,141,68,15,15,161,128,113,149,40,156,37,
+106,61,77,9,42,35,110,170,92,191,173,202,1,113,63,113,65,67,64,50,63,91,254,
+85,254,232,1,91,2,115,49,83,35,47,86,59,63,70,121,120,116,125,80,76,77,85,
+63,51,128,61,142,160,86,90,88,88,165,128,116,150,58,40,76,52,56,59,67,59,
+39,47,44,65,84,113,143,121,112,56,64,100,97,11,5,5,87,114,106,97,64,26,63,
+37,104,126,93,103,40,101,61,51,26,19,7,101,181,104,163,188,1,254,93,51,47,
+42,44,44,251,251,1,231,5,63,0,0,6,0,72,254,255,10,0,6,244,0,83,0,95,0,107,
+0,111,0,112,0,113,0,0,37,6,6,35,34,0,53,52,54,55,38,38,53,52,54,55,38,53,
+52,54,51,50,22,23,7,38,35,34,6,21,20,23,55,54,30,4,21,20,7,22,22,21,20,7,
+22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,
+22,18,21,20,6,35,34,39,6,6,35,34,1,38,38,35,34,6,21,20,23,54,51,50,3,50,54,
+53,52,38,35,34,6,21,20,22,1,19,51,19,37,1,4,33,70,232,148,244,254,221,114,
+106,29,35,85,80,34,161,128,113,149,40,156,37,106,61,77,33,12,37,106,98,99,
+73,40,8,69,70,18,81,164,97,105,110,175,184,76,211,242,5,80,158,91,105,110,
+175,184,76,211,242,206,192,208,159,50,171,121,228,254,138,15,145,119,88,94,
+42,84,91,134,135,173,194,195,172,171,195,193,5,2,15,154,15,253,185,253,67,
+188,104,110,1,24,229,144,234,72,34,95,48,88,134,34,56,77,104,126,93,103,40,
+101,61,51,46,39,1,3,16,35,73,106,135,76,51,42,74,191,116,77,69,104,101,133,
+126,152,234,85,158,92,254,184,198,42,39,98,91,133,126,152,234,85,158,92,254,
+184,198,206,225,179,90,89,3,232,129,140,75,63,64,43,25,252,136,195,164,169,
+206,203,161,170,200,254,120,1,34,254,222,207,7,38,255,255,0,60,255,57,7,212,
+6,244,2,34,0,30,0,0,0,3,0,59,8,90,0,0,255,255,0,78,255,206,6,42,6,244,2,34,
+2,168,0,0,0,3,0,59,6,132,0,0,0,6,0,72,255,206,4,118,6,244,0,44,0,56,0,68,
+0,79,0,80,0,81,0,0,1,38,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,
+6,21,20,23,55,54,30,4,21,20,7,22,22,21,20,6,6,35,34,0,53,52,54,37,38,38,35,
+34,6,21,20,23,54,51,50,3,50,54,53,52,38,35,34,6,21,20,22,19,50,22,21,20,6,
+35,34,38,53,52,19,1,1,36,29,35,85,80,34,161,128,113,149,40,156,37,106,61,
+77,33,12,37,106,98,99,73,40,8,69,70,132,243,160,244,254,221,114,2,153,15,
+145,119,88,94,42,84,91,134,135,173,194,195,172,171,195,193,175,52,57,58,51,
+54,57,110,1,32,3,165,34,95,48,88,134,34,56,77,104,126,93,103,40,101,61,51,
+46,39,1,3,16,35,73,106,135,76,51,42,74,191,116,151,233,128,1,24,229,144,234,
+113,129,140,75,63,64,43,25,252,136,195,164,169,206,203,161,170,200,1,231,
+62,57,59,63,63,59,119,253,96,7,38,0,255,255,0,72,255,206,5,236,6,244,2,34,
+2,170,0,0,0,3,0,59,5,41,0,0,255,255,0,72,254,255,5,236,6,244,2,34,2,171,0,
+0,0,3,0,59,5,41,0,0,255,255,0,68,255,206,6,156,6,244,2,34,0,35,0,0,0,3,0,
+59,6,215,0,0,0,7,0,73,255,206,6,1,6,244,0,72,0,84,0,94,0,106,0,107,0,108,
+0,109,0,0,19,22,4,51,50,36,55,6,35,34,38,53,52,54,51,50,23,38,38,39,22,21,
+20,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,
+51,50,4,18,21,20,7,22,21,16,0,33,32,0,53,52,54,51,50,22,21,20,6,35,34,1,38,
+35,34,6,21,20,22,51,50,53,52,1,22,51,50,53,52,38,35,34,6,5,38,38,35,34,6,
+21,20,22,51,50,54,1,1,19,234,43,1,35,228,249,1,34,33,89,127,122,148,159,140,
+74,77,8,199,165,16,147,128,125,142,58,58,35,161,128,113,149,40,156,37,106,
+61,77,23,53,45,214,1,71,170,8,44,254,139,254,155,254,162,254,128,210,164,
+127,147,173,151,94,1,249,27,27,79,89,59,57,128,253,162,66,82,186,64,57,82,
+113,4,93,28,94,57,60,76,71,64,65,96,253,233,1,34,8,1,145,129,137,161,154,
+83,141,121,122,143,36,125,192,37,48,47,115,136,144,103,68,103,36,60,76,104,
+126,93,103,40,101,61,51,39,32,7,142,254,248,179,35,44,80,106,254,245,254,
+228,1,21,235,179,229,138,114,127,148,3,97,2,62,53,53,59,130,48,253,134,41,
+131,53,55,104,10,54,60,63,57,55,64,66,253,142,7,38,253,11,0,7,0,72,254,255,
+5,93,6,244,0,43,0,55,0,74,0,85,0,89,0,90,0,91,0,0,1,38,53,52,54,55,38,53,
+52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,7,22,22,21,20,6,35,34,
+38,39,6,6,35,34,38,53,52,18,37,38,38,35,34,6,21,20,23,54,51,50,3,51,22,22,
+51,50,54,53,52,38,35,35,34,6,21,20,22,51,50,19,50,22,21,20,6,35,34,38,53,
+52,19,19,51,19,39,19,1,100,64,123,119,25,161,128,113,149,40,156,37,106,61,
+77,33,222,247,4,102,110,181,159,109,144,58,48,146,122,152,182,147,3,17,19,
+173,141,104,113,47,105,125,151,239,159,18,113,82,97,92,241,218,31,221,252,
+92,97,164,131,52,57,58,51,54,57,17,15,154,15,92,172,3,165,80,97,100,145,28,
+52,64,104,126,93,103,40,101,61,51,46,39,9,248,180,25,46,82,246,151,206,230,
+82,94,85,91,234,202,175,1,15,121,123,143,77,61,66,46,30,253,91,101,110,138,
+139,211,246,242,210,143,139,2,20,62,57,59,63,63,59,119,252,100,1,34,254,222,
+207,7,38,0,5,0,72,255,206,5,93,6,244,0,43,0,55,0,75,0,76,0,77,0,0,1,38,53,
+52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,7,22,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,37,38,38,35,34,6,21,20,23,54,51,
+50,3,51,22,22,51,50,54,53,52,38,35,35,34,6,21,20,22,51,50,54,19,19,1,100,
+64,123,119,25,161,128,113,149,40,156,37,106,61,77,33,222,247,4,102,110,181,
+159,109,144,58,48,146,122,152,182,147,3,17,19,173,141,104,113,47,105,125,
+151,239,159,8,119,86,97,92,241,218,31,221,252,92,97,88,115,90,172,3,165,80,
+97,100,145,28,52,64,104,126,93,103,40,101,61,51,46,39,9,248,180,25,46,82,
+246,151,206,230,82,94,85,91,234,202,175,1,15,121,123,143,77,61,66,46,30,253,
+121,114,127,138,139,211,246,242,210,143,139,127,254,200,7,38,0,0,6,0,72,254,
+255,5,93,6,244,0,43,0,55,0,75,0,79,0,80,0,81,0,0,1,38,53,52,54,55,38,53,52,
+54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,7,22,22,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,18,37,38,38,35,34,6,21,20,23,54,51,50,3,51,22,22,51,
+50,54,53,52,38,35,35,34,6,21,20,22,51,50,54,3,19,51,19,39,19,1,100,64,123,
+119,25,161,128,113,149,40,156,37,106,61,77,33,222,247,4,102,110,181,159,109,
+144,58,48,146,122,152,182,147,3,17,19,173,141,104,113,47,105,125,151,239,
+159,8,119,86,97,92,241,218,31,221,252,92,97,88,115,2,15,154,15,92,172,3,165,
+80,97,100,145,28,52,64,104,126,93,103,40,101,61,51,46,39,9,248,180,25,46,
+82,246,151,206,230,82,94,85,91,234,202,175,1,15,121,123,143,77,61,66,46,30,
+253,121,114,127,138,139,211,246,242,210,143,139,127,253,249,1,34,254,222,
+207,7,38,0,6,0,60,255,206,5,84,6,244,0,68,0,80,0,81,0,82,0,83,0,84,0,0,1,
+22,21,20,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,
+23,54,51,50,0,18,17,20,6,35,34,38,39,38,38,35,34,6,21,20,22,23,7,38,38,53,
+52,54,51,50,22,22,23,30,2,51,50,54,53,52,0,37,38,35,34,6,21,20,22,51,50,53,
+52,19,19,3,1,2,218,7,147,128,125,142,57,58,34,161,128,113,149,40,156,37,106,
+61,77,21,38,42,213,1,134,230,198,200,126,184,132,79,65,37,52,63,45,52,166,
+52,47,157,120,70,103,80,81,71,84,88,60,112,108,254,253,254,147,33,33,73,84,
+59,57,128,127,177,103,254,220,4,217,37,27,115,136,144,102,70,106,35,56,77,
+104,126,93,103,40,101,61,51,37,32,5,254,248,254,63,255,0,249,243,119,179,
+108,49,76,60,67,125,72,56,84,152,83,126,168,45,77,106,94,88,41,164,165,230,
+1,190,149,5,63,52,53,59,130,49,250,240,7,38,253,11,252,1,255,255,0,60,255,
+206,5,104,6,244,2,34,2,178,0,0,0,3,0,59,3,239,0,0,255,255,0,60,254,255,5,
+104,6,244,2,34,2,181,0,0,0,3,0,59,3,239,0,0,0,6,0,73,255,206,5,227,6,244,
+0,61,0,73,0,102,0,103,0,104,0,105,0,0,37,6,6,35,34,38,53,52,54,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,23,38,38,53,52,54,55,38,53,52,
+54,51,50,22,23,7,38,35,34,6,21,20,23,54,51,50,0,18,21,20,2,35,34,38,3,38,
+35,34,6,21,20,22,51,50,53,52,3,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,
+22,51,50,54,53,52,2,39,22,21,20,6,3,1,1,3,0,62,153,133,158,178,140,164,112,
+70,78,77,88,86,21,153,36,179,163,22,20,25,24,57,57,33,161,128,113,149,40,
+156,37,106,61,77,21,33,38,203,1,102,211,213,191,126,151,42,38,29,74,83,60,
+56,128,128,61,120,152,126,87,88,83,117,137,11,159,9,123,96,134,128,219,175,
+5,144,14,254,190,1,171,150,88,88,165,128,116,150,58,40,76,52,56,59,67,59,
+39,47,44,65,84,113,143,2,32,76,43,70,105,36,58,75,104,126,93,103,40,101,61,
+51,40,29,5,255,0,254,74,237,249,254,231,85,4,204,7,63,51,53,60,130,44,254,
+197,69,99,105,137,56,47,86,59,63,70,121,120,114,127,178,188,207,1,166,99,
+26,26,118,133,252,48,1,231,5,63,0,7,0,73,254,255,5,227,6,244,0,61,0,73,0,
+102,0,106,0,107,0,108,0,109,0,0,37,6,6,35,34,38,53,52,54,55,54,54,53,52,38,
+35,34,6,21,20,23,7,38,53,52,54,51,50,23,38,38,53,52,54,55,38,53,52,54,51,
+50,22,23,7,38,35,34,6,21,20,23,54,51,50,0,18,21,20,2,35,34,38,3,38,35,34,
+6,21,20,22,51,50,53,52,3,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,
+50,54,53,52,2,39,22,21,20,6,3,19,51,19,39,1,1,3,0,62,153,133,158,178,140,
+164,112,70,78,77,88,86,21,153,36,179,163,22,20,25,24,57,57,33,161,128,113,
+149,40,156,37,106,61,77,21,33,38,203,1,102,211,213,191,126,151,42,38,29,74,
+83,60,56,128,128,61,120,152,126,87,88,83,117,137,11,159,9,123,96,134,128,
+219,175,5,144,130,15,154,15,68,254,190,1,171,150,88,88,165,128,116,150,58,
+40,76,52,56,59,67,59,39,47,44,65,84,113,143,2,32,76,43,70,105,36,58,75,104,
+126,93,103,40,101,61,51,40,29,5,255,0,254,74,237,249,254,231,85,4,204,7,63,
+51,53,60,130,44,254,197,69,99,105,137,56,47,86,59,63,70,121,120,114,127,178,
+188,207,1,166,99,26,26,118,133,251,97,1,34,254,222,207,1,231,5,63,0,0,6,0,
+60,255,206,8,45,6,244,0,79,0,91,0,103,0,104,0,105,0,106,0,0,1,22,22,51,50,
+54,53,52,38,39,55,22,18,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,52,0,39,22,21,20,6,35,34,38,53,52,54,
+55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,51,50,0,18,17,20,1,38,
+35,34,6,21,20,22,51,50,53,52,3,38,38,35,34,6,21,20,22,51,50,54,5,1,1,5,96,
+78,160,94,105,110,175,184,76,211,242,206,192,210,159,45,170,125,95,154,79,
+71,136,92,141,158,164,125,92,149,123,90,117,78,111,105,254,254,206,7,147,
+128,125,142,57,58,34,161,128,113,149,40,156,37,106,61,77,21,38,42,212,1,133,
+232,252,230,33,33,73,84,59,57,128,55,72,80,51,60,73,80,68,66,91,2,46,1,92,
+252,208,1,72,98,95,133,126,152,234,85,158,92,254,184,198,206,225,181,91,90,
+80,91,97,74,169,137,130,166,89,159,118,75,162,164,230,1,192,102,37,27,115,
+136,144,102,70,106,35,56,77,104,126,93,103,40,101,61,51,37,32,5,254,251,254,
+57,254,250,70,3,134,5,63,52,53,59,130,49,252,50,95,56,79,67,66,84,75,252,
+3,151,3,143,0,5,0,72,255,206,12,190,3,255,0,70,0,82,0,94,0,95,0,96,0,0,37,
+6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,
+52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,53,55,55,33,50,30,2,
+21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,1,6,21,20,22,51,50,54,53,
+52,38,35,1,50,54,53,52,38,35,34,6,21,20,22,5,33,7,3,50,171,121,228,168,70,
+232,148,244,254,221,136,244,155,157,246,132,18,81,164,97,105,110,175,184,
+76,211,242,5,80,158,91,104,111,181,177,1,73,2,210,117,141,114,62,157,132,
+131,150,44,254,84,122,130,208,190,208,3,172,52,75,63,62,70,92,99,246,245,
+172,195,195,172,171,195,193,3,115,5,37,153,90,89,214,104,110,1,24,229,158,
+249,133,133,246,158,77,69,104,101,133,126,152,234,85,158,92,254,184,198,42,
+39,98,91,130,121,146,244,92,1,2,152,25,74,119,88,123,146,147,109,89,76,92,
+246,135,200,222,3,127,69,80,62,75,72,60,78,76,253,34,192,164,168,203,200,
+161,168,198,185,0,0,5,0,72,255,206,4,118,6,244,0,44,0,56,0,68,0,69,0,70,0,
+0,1,38,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,55,54,
+30,4,21,20,7,22,22,21,20,6,6,35,34,0,53,52,54,37,38,38,35,34,6,21,20,23,54,
+51,50,3,50,54,53,52,38,35,34,6,21,20,22,23,1,1,36,29,35,85,80,34,161,128,
+113,149,40,156,37,106,61,77,33,12,37,106,98,99,73,40,8,69,70,132,243,160,
+244,254,221,114,2,153,15,145,119,88,94,42,84,91,134,135,173,194,195,172,171,
+195,193,174,1,32,3,165,34,95,48,88,134,34,56,77,104,126,93,103,40,101,61,
+51,46,39,1,3,16,35,73,106,135,76,51,42,74,191,116,151,233,128,1,24,229,144,
+234,113,129,140,75,63,64,43,25,252,136,195,164,169,206,203,161,170,200,185,
+7,38,0,255,255,0,73,255,206,6,143,6,244,2,34,0,48,0,0,0,3,0,59,7,3,0,0,0,
+6,0,72,255,206,5,148,6,244,0,59,0,71,0,82,0,83,0,84,0,85,0,0,19,22,22,51,
+32,36,53,52,2,39,22,21,20,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,
+7,38,35,34,6,21,20,23,54,51,50,4,18,21,16,0,33,32,0,17,52,54,54,51,50,22,
+21,20,6,35,34,1,38,35,34,6,21,20,22,51,50,53,52,1,22,51,50,54,53,52,38,35,
+34,6,1,3,3,234,14,251,224,1,10,1,13,163,148,5,144,129,125,142,57,58,34,161,
+128,113,149,40,156,37,106,61,77,21,36,38,189,1,61,180,254,155,254,161,254,
+197,254,179,104,177,107,123,148,166,153,93,1,213,38,29,74,83,60,56,128,253,
+200,71,91,83,84,65,54,80,112,1,236,135,255,1,191,154,158,253,250,191,1,57,
+90,27,28,118,133,140,104,71,107,35,58,75,104,126,93,103,40,101,61,51,37,32,
+5,206,254,147,220,254,178,254,176,1,22,1,2,130,199,104,141,118,133,150,3,
+118,7,63,51,53,60,130,44,253,121,49,68,63,56,66,108,253,28,7,38,253,11,0,
+8,0,60,255,206,5,42,6,244,0,66,0,78,0,91,0,102,0,103,0,104,0,105,0,106,0,
+0,1,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,7,22,23,22,
+23,54,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,
+23,7,38,35,34,6,21,20,23,54,51,50,4,18,21,20,6,1,38,35,34,6,21,20,22,51,50,
+53,52,1,54,54,53,52,38,35,34,6,21,20,22,22,5,6,21,20,22,51,50,54,53,52,38,
+3,19,1,1,3,152,69,167,149,139,168,84,190,200,172,142,145,161,135,22,64,60,
+43,213,206,157,144,11,147,128,125,142,57,58,34,161,128,113,149,40,156,37,
+106,61,77,22,41,46,188,1,45,168,201,254,86,31,34,73,84,59,57,128,254,149,
+78,86,75,72,68,80,22,58,1,115,148,81,73,72,77,80,58,124,253,213,1,173,1,72,
+61,74,107,112,110,105,92,57,28,163,128,104,144,139,105,122,78,3,4,5,9,18,
+176,164,164,244,52,39,42,115,136,141,104,72,106,34,56,77,104,126,93,103,40,
+101,61,51,39,31,6,158,254,224,179,200,241,3,154,3,63,52,53,59,130,50,253,
+20,22,76,50,52,60,64,49,37,49,45,204,28,84,42,45,45,42,43,58,254,162,7,38,
+253,11,253,31,0,6,0,60,255,206,5,104,6,244,0,59,0,71,0,83,0,84,0,85,0,86,
+0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,0,39,22,21,
+20,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,
+51,50,0,18,17,20,6,35,34,38,3,38,35,34,6,21,20,22,51,50,53,52,3,38,38,35,
+34,6,21,20,22,51,50,54,23,19,19,2,146,71,136,92,141,158,164,125,92,149,123,
+90,117,78,111,105,254,254,206,7,147,128,125,142,57,58,34,161,128,113,149,
+40,156,37,106,61,77,21,38,42,212,1,133,232,196,202,95,154,147,33,33,73,84,
+59,57,128,55,72,80,51,60,73,80,68,66,91,203,87,5,145,97,74,169,137,130,166,
+89,159,118,75,162,164,230,1,192,102,37,27,115,136,144,102,70,106,35,56,77,
+104,126,93,103,40,101,61,51,37,32,5,254,251,254,57,254,250,246,237,80,4,211,
+5,63,52,53,59,130,49,252,50,95,56,79,67,66,84,75,252,7,38,253,11,0,6,0,60,
+255,206,4,40,6,244,0,70,0,82,0,94,0,95,0,96,0,97,0,0,1,22,22,21,20,6,35,34,
+38,53,52,54,55,38,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,54,
+53,52,38,39,22,21,20,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,
+35,34,6,21,20,23,54,51,50,4,21,20,6,1,38,35,34,6,21,20,22,51,50,53,52,19,
+6,6,21,20,22,51,50,54,53,52,38,1,19,3,3,127,84,85,174,151,149,165,98,126,
+46,95,48,120,112,33,157,20,24,196,189,89,162,73,65,65,93,93,13,147,128,125,
+142,57,58,34,161,128,113,149,40,156,37,106,61,77,22,42,46,245,1,34,83,254,
+89,28,37,73,84,59,57,128,201,112,79,78,74,76,81,59,254,235,252,23,2,72,63,
+164,102,131,150,149,120,82,144,87,14,15,79,88,58,72,44,43,106,43,139,159,
+36,36,65,141,77,91,134,32,44,41,115,136,140,104,70,105,36,58,77,104,126,93,
+103,40,101,61,51,39,31,6,232,189,115,176,2,56,3,63,52,53,59,130,50,253,69,
+80,104,54,57,65,71,67,64,111,254,21,7,38,253,11,255,255,0,60,254,255,6,39,
+6,244,2,34,2,203,0,0,0,3,0,59,3,239,0,0,255,255,0,60,255,206,5,157,6,244,
+2,34,2,206,0,0,0,3,0,59,3,239,0,0,255,255,0,60,255,206,8,68,6,244,2,34,2,
+209,0,0,0,3,0,59,3,239,0,0,255,255,0,34,252,234,4,155,6,244,2,34,2,152,0,
+0,0,35,0,59,4,26,0,0,0,2,2,248,0,0,0,4,0,73,255,206,7,161,3,255,0,100,0,101,
+0,102,0,103,0,0,1,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,
+53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,53,52,38,
+35,34,7,39,54,51,50,22,21,20,7,22,22,51,50,53,52,35,34,7,39,54,51,50,22,21,
+20,6,35,34,39,6,35,34,39,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,
+52,39,1,33,1,5,88,33,36,187,164,114,150,54,62,153,133,158,178,140,164,112,
+70,78,77,88,86,21,153,36,179,163,137,168,15,58,170,89,162,76,70,53,72,21,
+74,88,136,159,2,51,132,66,162,146,53,72,21,74,88,136,159,178,153,181,131,
+91,171,202,140,49,192,126,87,88,83,117,137,11,159,8,123,102,91,96,50,254,
+43,2,237,251,251,2,4,51,128,61,142,160,86,90,88,88,165,128,116,150,58,40,
+76,52,56,59,67,59,39,47,44,65,84,113,143,121,112,56,64,101,49,49,13,150,17,
+129,122,16,17,31,38,101,98,13,150,17,129,122,114,142,89,89,111,97,70,47,86,
+59,63,70,121,120,116,125,80,76,77,85,254,9,1,231,0,255,255,0,60,252,234,7,
+179,6,244,2,34,2,213,0,0,0,3,2,210,0,156,0,0,255,255,0,60,252,234,7,179,6,
+244,2,34,2,214,0,0,0,3,2,210,0,156,0,0,255,255,0,60,252,234,7,179,6,244,2,
+34,2,215,0,0,0,3,2,210,0,241,0,0,0,5,0,73,255,206,10,101,3,255,0,113,0,125,
+0,126,0,127,0,128,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,35,22,21,20,6,35,
+34,39,6,6,35,34,39,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,39,
+55,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,
+6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,53,52,38,35,34,7,39,54,51,
+50,22,21,20,7,22,22,51,50,54,53,52,39,35,55,5,6,21,20,22,51,50,54,53,52,38,
+35,1,33,1,8,179,117,141,114,62,157,132,131,150,44,213,21,171,150,181,131,
+46,131,85,202,140,49,192,126,87,88,83,117,137,11,159,8,123,102,91,96,50,151,
+33,36,187,164,114,150,54,62,153,133,158,178,140,164,112,70,78,77,88,86,21,
+153,36,179,163,137,168,15,58,170,89,162,76,70,53,72,21,74,88,136,159,2,51,
+132,66,73,74,46,221,36,2,239,52,75,63,62,70,92,99,249,220,2,237,251,251,3,
+255,25,74,119,88,123,146,147,109,89,76,43,54,117,139,89,45,44,111,97,70,47,
+86,59,63,70,121,120,116,125,80,76,77,85,63,51,128,61,142,160,86,90,88,88,
+165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,113,143,121,112,56,
+64,101,49,49,13,150,17,129,122,16,17,31,38,52,49,60,38,154,154,69,80,62,75,
+72,60,78,76,252,105,1,231,255,255,0,60,252,234,10,90,6,244,2,34,2,216,0,0,
+0,3,2,210,0,156,0,0,255,255,0,60,252,234,10,90,6,244,2,34,2,217,0,0,0,3,2,
+210,0,156,0,0,255,255,0,60,252,234,10,90,6,244,2,34,2,218,0,0,0,3,2,210,0,
+241,0,0,255,255,0,34,255,206,4,41,5,118,2,34,2,152,0,0,0,3,2,232,4,75,0,0,
+255,255,0,60,254,255,6,11,5,118,2,34,2,153,0,0,0,3,2,234,5,237,0,0,255,255,
+0,82,255,206,4,169,5,118,2,34,2,154,0,0,0,3,2,232,4,139,0,0,255,255,255,226,
+254,255,8,118,5,118,2,34,2,155,0,0,0,2,2,231,0,0,255,255,0,73,255,206,5,217,
+5,118,2,34,0,25,0,0,0,3,2,234,5,174,0,0,255,255,0,52,255,206,6,20,5,118,2,
+34,2,160,0,0,0,3,2,235,5,75,0,0,255,255,0,52,254,255,6,20,5,118,2,34,2,162,
+0,0,0,3,2,235,5,75,0,0,255,255,0,73,255,206,5,217,5,118,2,34,2,163,0,0,0,
+3,0,64,5,228,0,0,255,255,0,72,254,255,10,73,5,118,2,34,2,164,0,0,0,3,2,232,
+4,150,0,0,255,255,0,60,255,57,7,212,5,118,2,34,0,30,0,0,0,3,2,234,7,211,0,
+0,255,255,0,78,255,206,6,42,5,118,2,34,2,168,0,0,0,3,2,236,6,14,0,0,255,255,
+0,72,255,206,4,191,5,118,2,34,2,169,0,0,0,3,2,232,4,150,0,0,255,255,0,72,
+255,206,5,236,5,118,2,34,2,170,0,0,0,3,0,64,5,120,0,0,255,255,0,72,254,255,
+5,236,5,118,2,34,2,171,0,0,0,3,0,64,5,120,0,0,255,255,0,68,255,206,6,156,
+5,118,2,34,0,35,0,0,0,3,2,234,6,85,0,0,255,255,0,73,255,206,6,58,5,118,2,
+34,2,172,0,0,0,3,2,234,5,219,0,0,255,255,0,72,254,255,5,166,5,118,2,34,2,
+173,0,0,0,3,0,64,5,85,0,0,255,255,0,72,255,206,5,166,5,118,2,34,2,174,0,0,
+0,3,0,64,5,85,0,0,255,255,0,72,254,255,5,166,5,118,2,34,2,175,0,0,0,3,0,64,
+5,85,0,0,255,255,0,60,255,206,5,157,5,118,2,34,2,177,0,0,0,3,2,235,4,251,
+0,0,255,255,255,226,255,206,5,104,5,118,2,34,2,178,0,0,0,2,2,231,0,0,255,
+255,255,226,254,255,5,104,5,118,2,34,2,181,0,0,0,2,2,231,0,0,255,255,0,73,
+255,206,6,0,5,118,2,34,2,184,0,0,0,3,2,234,5,205,0,0,255,255,0,73,254,255,
+6,0,5,118,2,34,2,186,0,0,0,3,2,234,5,205,0,0,255,255,0,60,255,206,8,45,5,
+118,2,34,2,188,0,0,0,3,2,235,5,5,0,0,255,255,0,72,255,206,10,73,5,118,2,34,
+2,193,0,0,0,3,2,234,7,52,0,0,255,255,0,72,255,206,4,191,5,118,2,34,2,197,
+0,0,0,3,2,232,4,150,0,0,255,255,0,73,255,206,6,143,5,118,2,34,0,48,0,0,0,
+3,2,234,6,95,0,0,255,255,0,72,255,206,5,172,5,118,2,34,2,198,0,0,0,3,2,234,
+5,175,0,0,255,255,0,60,255,206,5,41,5,118,2,34,2,199,0,0,0,3,0,64,5,52,0,
+0,255,255,0,60,255,206,5,177,5,118,2,34,2,201,0,0,0,3,2,235,5,5,0,0,255,255,
+0,60,255,206,4,102,5,118,2,34,2,202,0,0,0,3,2,233,4,152,0,0,255,255,255,226,
+254,255,6,39,5,118,2,34,2,203,0,0,0,2,2,231,0,0,255,255,255,226,255,206,5,
+157,5,118,2,34,2,206,0,0,0,2,2,231,0,0,255,255,255,226,255,206,8,68,5,118,
+2,34,2,209,0,0,0,2,2,231,0,0,255,255,0,34,252,234,4,155,5,118,2,34,2,152,
+0,0,0,35,2,232,4,75,0,0,0,2,2,248,0,0,255,255,0,34,255,206,4,47,6,244,2,34,
+2,152,0,0,0,3,2,238,4,75,0,0,255,255,0,60,254,255,6,11,6,244,2,34,2,153,0,
+0,0,3,2,240,5,237,0,0,255,255,0,82,255,206,4,169,6,244,2,34,2,154,0,0,0,3,
+2,238,4,139,0,0,255,255,255,226,254,255,8,118,6,244,2,34,2,155,0,0,0,2,2,
+237,0,0,255,255,0,73,255,206,5,217,6,244,2,34,0,25,0,0,0,3,2,240,5,174,0,
+0,255,255,0,52,255,206,6,20,6,244,2,34,2,160,0,0,0,3,2,241,5,75,0,0,255,255,
+0,52,254,255,6,20,6,244,2,34,2,162,0,0,0,3,2,241,5,75,0,0,255,255,0,73,255,
+206,5,217,6,244,2,34,2,163,0,0,0,3,0,65,5,228,0,0,255,255,0,72,254,255,10,
+73,6,244,2,34,2,164,0,0,0,3,2,238,4,150,0,0,255,255,0,60,255,57,7,216,6,244,
+2,34,0,30,0,0,0,3,2,240,7,211,0,0,255,255,0,78,255,206,6,42,6,244,2,34,2,
+168,0,0,0,3,2,242,6,14,0,0,255,255,0,72,255,206,4,191,6,244,2,34,2,169,0,
+0,0,3,2,238,4,150,0,0,255,255,0,72,255,206,5,236,6,244,2,34,2,170,0,0,0,3,
+0,65,5,120,0,0,255,255,0,72,254,255,5,236,6,244,2,34,2,171,0,0,0,3,0,65,5,
+120,0,0,255,255,0,68,255,206,6,156,6,244,2,34,0,35,0,0,0,3,2,240,6,85,0,0,
+255,255,0,73,255,206,6,58,6,244,2,34,2,172,0,0,0,3,2,240,5,219,0,0,255,255,
+0,72,254,255,5,166,6,244,2,34,2,173,0,0,0,3,0,65,5,85,0,0,255,255,0,72,255,
+206,5,166,6,244,2,34,2,174,0,0,0,3,0,65,5,85,0,0,255,255,0,72,254,255,5,166,
+6,244,2,34,2,175,0,0,0,3,0,65,5,85,0,0,255,255,0,60,255,206,5,157,6,244,2,
+34,2,177,0,0,0,3,2,241,4,251,0,0,255,255,255,226,255,206,5,104,6,244,2,34,
+2,178,0,0,0,2,2,237,0,0,255,255,255,226,254,255,5,104,6,244,2,34,2,181,0,
+0,0,2,2,237,0,0,255,255,0,73,255,206,6,0,6,244,2,34,2,184,0,0,0,3,2,240,5,
+205,0,0,255,255,0,73,254,255,6,0,6,244,2,34,2,186,0,0,0,3,2,240,5,205,0,0,
+255,255,0,60,255,206,8,45,6,244,2,34,2,188,0,0,0,3,2,241,5,5,0,0,255,255,
+0,72,255,206,10,73,6,244,2,34,2,193,0,0,0,3,2,240,7,52,0,0,255,255,0,72,255,
+206,4,191,6,244,2,34,2,197,0,0,0,3,2,238,4,150,0,0,255,255,0,73,255,206,6,
+143,6,244,2,34,0,48,0,0,0,3,2,240,6,95,0,0,255,255,0,72,255,206,5,180,6,244,
+2,34,2,198,0,0,0,3,2,240,5,175,0,0,255,255,0,60,255,206,5,41,6,244,2,34,2,
+199,0,0,0,3,0,65,5,52,0,0,255,255,0,60,255,206,5,177,6,244,2,34,2,201,0,0,
+0,3,2,241,5,5,0,0,255,255,0,60,255,206,4,124,6,244,2,34,2,202,0,0,0,3,2,239,
+4,152,0,0,255,255,255,226,254,255,6,39,6,244,2,34,2,203,0,0,0,2,2,237,0,0,
+255,255,255,226,255,206,5,157,6,244,2,34,2,206,0,0,0,2,2,237,0,0,255,255,
+255,226,255,206,8,68,6,244,2,34,2,209,0,0,0,2,2,237,0,0,255,255,0,34,252,
+234,4,155,6,244,2,34,2,152,0,0,0,35,2,238,4,75,0,0,0,2,2,248,0,0,255,255,
+0,11,252,234,4,41,5,118,2,34,2,152,0,0,0,35,2,232,4,75,0,0,0,3,2,243,4,55,
+0,0,255,255,0,60,252,234,6,11,5,118,2,34,2,153,0,0,0,35,2,234,5,237,0,0,0,
+3,2,245,6,4,0,0,255,255,0,75,252,234,4,169,5,118,2,34,2,154,0,0,0,35,2,232,
+4,139,0,0,0,3,2,243,4,119,0,0,255,255,255,226,252,164,8,118,5,118,2,34,2,
+155,0,0,0,34,2,231,0,0,0,3,2,245,6,4,255,186,255,255,0,73,252,234,5,217,5,
+118,2,34,0,25,0,0,0,35,2,234,5,174,0,0,0,3,0,72,5,70,0,0,255,255,0,52,252,
+234,6,20,5,118,2,34,2,160,0,0,0,35,2,235,5,75,0,0,0,3,2,244,5,155,0,0,255,
+255,0,52,252,234,6,20,5,118,2,34,2,162,0,0,0,35,2,244,5,155,0,0,0,3,2,235,
+5,75,0,0,255,255,0,73,252,234,5,217,5,118,2,34,2,163,0,0,0,35,0,64,5,228,
+0,0,0,3,0,72,5,70,0,0,255,255,0,72,252,234,10,73,5,118,2,34,2,164,0,0,0,35,
+2,232,4,150,0,0,0,3,2,245,6,97,0,0,255,255,0,60,252,234,7,212,5,118,2,34,
+0,30,0,0,0,35,2,234,7,211,0,0,0,3,2,245,6,173,0,0,255,255,0,78,252,234,6,
+42,5,118,2,34,2,168,0,0,0,35,2,236,6,14,0,0,0,3,2,244,5,166,0,0,255,255,0,
+72,252,234,4,191,5,118,2,34,2,169,0,0,0,35,2,232,4,150,0,0,0,3,2,243,4,130,
+0,0,255,255,0,72,252,234,5,236,5,118,2,34,2,170,0,0,0,35,0,64,5,120,0,0,0,
+3,2,244,5,135,0,0,255,255,0,47,252,234,5,236,5,118,2,34,2,171,0,0,0,35,0,
+64,5,120,0,0,0,3,2,245,5,245,0,0,255,255,0,68,252,234,6,156,5,118,2,34,0,
+35,0,0,0,35,2,234,6,85,0,0,0,3,2,244,5,223,0,0,255,255,0,73,252,234,6,58,
+5,118,2,34,2,172,0,0,0,35,2,234,5,219,0,0,0,3,2,244,5,174,0,0,255,255,0,72,
+252,234,5,166,5,118,2,34,2,173,0,0,0,35,0,64,5,85,0,0,0,3,2,244,5,99,0,0,
+255,255,0,72,252,234,5,166,5,118,2,34,2,174,0,0,0,35,0,64,5,85,0,0,0,3,0,
+72,5,44,0,0,255,255,0,72,252,234,5,166,5,118,2,34,2,175,0,0,0,35,0,64,5,85,
+0,0,0,3,2,244,5,100,0,0,255,255,0,60,252,234,5,157,5,118,2,34,2,177,0,0,0,
+35,2,235,4,251,0,0,0,3,0,72,5,40,0,0,255,255,255,226,252,234,5,104,5,118,
+2,34,2,178,0,0,0,35,0,72,5,50,0,0,0,2,2,231,0,0,255,255,255,226,252,234,5,
+104,5,118,2,34,2,181,0,0,0,35,2,244,5,50,0,0,0,2,2,231,0,0,255,255,0,73,252,
+234,6,0,5,118,2,34,2,184,0,0,0,35,2,234,5,205,0,0,0,3,2,244,5,145,0,0,255,
+255,0,73,252,234,6,0,5,118,2,34,2,186,0,0,0,35,2,234,5,205,0,0,0,3,2,244,
+5,145,0,0,255,255,0,60,252,234,8,45,5,118,2,34,2,188,0,0,0,35,2,235,5,5,0,
+0,0,3,2,245,6,44,0,0,255,255,0,72,252,234,10,73,5,118,2,34,2,193,0,0,0,35,
+2,234,7,52,0,0,0,3,2,245,6,227,0,0,255,255,0,72,252,234,4,191,5,118,2,34,
+2,197,0,0,0,35,2,232,4,150,0,0,0,3,2,243,4,130,0,0,255,255,0,73,252,234,6,
+143,5,118,2,34,0,48,0,0,0,35,2,234,6,95,0,0,0,3,2,244,5,216,0,0,255,255,0,
+72,252,234,5,172,5,118,2,34,2,198,0,0,0,35,2,234,5,175,0,0,0,3,0,72,5,48,
+0,0,255,255,0,60,252,234,5,41,5,118,2,34,2,199,0,0,0,35,0,64,5,52,0,0,0,3,
+0,72,4,238,0,0,255,255,0,60,252,234,5,177,5,118,2,34,2,201,0,0,0,35,2,235,
+5,5,0,0,0,3,0,72,5,50,0,0,255,255,0,42,252,234,4,102,5,118,2,34,2,202,0,0,
+0,35,2,243,4,86,0,0,0,3,2,233,4,152,0,0,255,255,255,226,252,234,6,39,5,118,
+2,34,2,203,0,0,0,35,0,72,5,50,0,0,0,2,2,231,0,0,255,255,255,226,252,234,5,
+157,5,118,2,34,2,206,0,0,0,35,0,72,5,40,0,0,0,2,2,231,0,0,255,255,255,226,
+252,234,8,68,5,118,2,34,2,209,0,0,0,35,2,245,7,3,0,0,0,2,2,231,0,0,255,255,
+0,11,252,66,4,155,5,118,2,34,2,152,0,0,0,35,2,232,4,75,0,0,0,34,2,249,0,0,
+0,2,2,248,0,0,255,255,0,34,255,206,6,103,5,154,0,34,2,152,0,0,0,3,0,67,4,
+11,0,0,0,7,0,60,254,255,8,74,5,154,0,92,0,104,0,117,0,129,0,133,0,134,0,135,
+0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,38,
+53,52,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,
+51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,
+35,35,34,6,21,20,22,51,51,22,18,21,20,6,35,34,38,1,6,21,20,22,51,50,54,53,
+52,38,35,1,38,35,34,6,21,20,22,51,50,54,53,52,19,38,38,35,34,6,21,20,22,51,
+50,54,19,19,51,19,39,33,2,183,72,168,96,145,154,150,128,76,153,95,34,73,3,
+150,124,120,159,176,143,148,211,111,72,70,128,77,119,120,148,167,146,168,
+173,131,17,104,130,44,44,146,116,109,117,140,114,62,159,130,132,149,43,33,
+178,29,159,15,105,71,8,73,80,81,84,27,214,224,224,190,96,167,3,190,53,75,
+63,62,70,92,99,250,221,38,44,72,83,67,61,68,73,75,73,108,57,58,62,78,68,65,
+106,78,15,154,15,21,3,6,103,65,64,127,106,98,122,55,62,80,109,183,100,21,
+21,114,137,146,119,116,153,135,243,135,158,128,47,42,134,125,148,231,96,5,
+154,133,119,154,78,79,84,73,25,75,118,88,123,146,149,107,84,81,191,90,101,
+67,58,68,64,99,254,190,197,200,231,59,4,223,70,79,62,75,72,60,78,76,254,105,
+11,71,57,60,66,67,63,59,253,140,51,40,42,35,35,43,32,254,96,1,34,254,222,
+207,0,255,255,0,82,255,206,6,155,5,154,0,34,2,154,0,0,0,3,0,67,4,63,0,0,255,
+255,255,226,254,255,10,242,5,118,2,34,2,158,0,0,0,2,2,231,0,0,255,255,0,73,
+255,206,8,63,5,154,0,34,0,25,0,0,0,3,2,227,5,227,0,0,0,4,0,52,255,206,7,234,
+5,154,0,82,0,94,0,95,0,96,0,0,1,4,0,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+54,55,35,53,33,21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,35,
+34,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,
+55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,1,6,21,20,22,51,50,54,53,52,38,
+35,1,33,3,179,1,2,1,22,202,168,115,143,67,54,148,119,147,184,61,57,202,1,
+223,230,94,83,97,123,10,159,8,127,94,108,109,234,196,3,153,178,173,131,17,
+104,130,44,44,146,116,139,117,140,114,62,159,130,132,149,43,63,178,29,159,
+15,105,71,8,73,80,81,84,3,8,53,75,63,62,70,92,99,252,117,3,10,3,255,69,254,
+183,228,199,224,77,99,87,89,178,143,63,126,44,152,145,54,176,78,92,126,115,
+113,128,129,130,181,253,41,156,136,119,154,78,79,84,73,25,75,118,88,123,146,
+149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,250,206,
+0,0,5,0,52,254,255,7,234,5,154,0,82,0,94,0,98,0,99,0,100,0,0,1,4,0,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,54,55,
+51,22,22,51,50,54,53,52,38,39,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,
+50,30,2,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,
+1,6,21,20,22,51,50,54,53,52,38,35,1,19,51,19,39,33,3,179,1,2,1,22,202,168,
+115,143,67,54,148,119,147,184,61,57,202,1,223,230,94,83,97,123,10,159,8,127,
+94,108,109,234,196,3,153,178,173,131,17,104,130,44,44,146,116,139,117,140,
+114,62,159,130,132,149,43,63,178,29,159,15,105,71,8,73,80,81,84,3,8,53,75,
+63,62,70,92,99,252,35,15,154,15,102,3,10,3,255,69,254,183,228,199,224,77,
+99,87,89,178,143,63,126,44,152,145,54,176,78,92,126,115,113,128,129,130,181,
+253,41,156,136,119,154,78,79,84,73,25,75,118,88,123,146,149,107,84,81,191,
+90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,249,255,1,34,254,222,207,0,
+5,0,73,255,206,8,94,5,154,0,117,0,129,0,130,0,131,0,132,0,0,1,50,22,21,20,
+6,35,34,39,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,39,55,22,
+22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,
+20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,53,52,38,35,35,34,38,53,52,54,
+51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,55,35,34,7,35,38,
+38,35,35,34,6,21,20,22,51,1,6,21,20,22,51,50,54,53,52,38,35,1,33,1,4,54,153,
+148,178,153,202,140,49,192,126,87,88,83,117,137,11,159,8,123,102,91,96,50,
+151,33,36,187,164,114,150,54,62,153,133,158,178,140,164,112,70,78,77,88,86,
+21,153,36,179,163,137,168,15,58,170,89,162,73,82,18,168,178,171,133,27,104,
+130,44,37,139,121,108,117,140,114,62,159,130,132,149,43,23,178,29,159,15,
+105,71,18,73,80,73,116,2,210,53,75,63,62,70,92,99,251,227,2,237,251,251,3,
+255,134,117,114,142,111,97,70,47,86,59,63,70,121,120,116,125,80,76,77,85,
+63,51,128,61,142,160,86,90,88,88,165,128,116,150,58,40,76,52,56,59,67,59,
+39,47,44,65,84,113,143,121,112,56,64,101,48,50,151,141,121,152,78,79,81,76,
+25,75,118,88,123,146,149,107,84,81,191,90,101,67,58,64,68,1,1,70,79,62,75,
+72,60,78,76,250,206,1,231,0,255,255,0,72,254,255,12,197,5,118,2,34,2,167,
+0,0,0,3,2,232,4,150,0,0,255,255,0,60,255,57,10,80,5,154,0,34,0,30,0,0,0,3,
+2,227,7,244,0,0,0,5,0,78,255,206,8,115,5,154,0,89,0,101,0,112,0,113,0,114,
+0,0,1,3,22,22,21,20,6,35,34,39,6,21,21,20,22,51,50,54,55,51,22,22,51,50,54,
+53,52,38,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,
+34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,22,18,21,20,6,35,
+34,38,39,6,6,35,34,2,53,52,18,55,3,5,6,21,20,22,51,50,54,53,52,38,35,1,22,
+51,50,54,53,52,38,35,34,6,1,33,2,63,12,104,113,164,154,117,104,2,123,123,
+108,126,11,159,9,123,96,109,109,168,167,134,150,173,131,17,104,130,44,44,
+146,116,109,117,140,114,62,159,130,132,149,43,33,178,29,159,15,105,71,8,73,
+80,81,84,16,214,225,199,172,119,148,57,52,151,122,188,219,172,154,13,5,125,
+53,75,63,62,70,92,99,249,237,82,103,83,83,64,57,77,122,1,235,3,21,5,8,254,
+242,17,134,103,136,147,67,26,26,22,167,172,120,121,114,127,129,130,156,239,
+82,12,153,125,119,154,78,79,84,73,25,75,118,88,123,146,149,107,84,81,191,
+90,101,67,58,68,64,99,254,190,197,203,228,87,89,85,91,1,24,222,212,1,25,42,
+1,21,8,70,79,62,75,72,60,78,76,253,173,60,68,63,58,64,100,252,196,0,255,255,
+0,72,255,206,6,169,5,154,0,34,2,169,0,0,0,3,0,67,4,77,0,0,255,255,0,72,255,
+206,7,124,5,154,0,34,2,170,0,0,0,3,2,229,5,32,0,0,255,255,0,72,254,255,7,
+124,5,154,0,34,2,171,0,0,0,3,2,229,5,32,0,0,255,255,0,68,255,206,8,184,5,
+154,0,34,0,35,0,0,0,3,2,227,6,92,0,0,0,6,0,73,255,206,8,47,5,154,0,80,0,92,
+0,102,0,114,0,115,0,116,0,0,19,22,4,51,50,36,55,6,35,34,38,53,52,54,55,38,
+39,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,
+53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,50,30,2,21,16,0,33,32,
+0,53,52,54,51,50,22,21,20,6,35,34,1,6,21,20,22,51,50,54,53,52,38,35,1,22,
+51,50,53,52,38,35,34,6,5,38,38,35,34,6,21,20,22,51,50,54,1,33,234,43,1,35,
+228,249,1,34,33,89,127,121,149,138,119,9,24,127,153,178,173,131,17,104,130,
+44,44,146,116,109,117,140,114,62,159,130,132,149,43,33,178,29,159,15,105,
+71,8,73,80,81,84,16,29,199,191,104,254,147,254,163,254,162,254,128,210,164,
+127,147,173,151,94,5,145,53,75,63,62,70,92,99,250,6,66,82,186,64,57,82,113,
+4,93,28,94,57,60,76,71,64,65,96,253,225,3,29,1,145,129,137,161,154,83,137,
+114,101,138,5,3,4,156,136,119,154,78,79,84,73,25,75,118,88,123,146,149,107,
+84,81,191,90,101,67,58,68,64,45,123,197,129,254,242,254,227,1,21,235,179,
+229,138,114,127,148,3,145,70,79,62,75,72,60,78,76,253,39,41,131,53,55,104,
+10,54,60,63,57,55,64,66,253,142,255,255,0,72,254,255,7,51,5,154,0,34,2,173,
+0,0,0,3,0,67,4,215,0,0,255,255,0,72,255,206,7,51,5,154,0,34,2,174,0,0,0,3,
+0,67,4,215,0,0,255,255,0,72,254,255,7,51,5,154,0,34,2,175,0,0,0,3,0,67,4,
+215,0,0,0,5,0,60,255,206,7,108,5,154,0,80,0,92,0,93,0,94,0,95,0,0,1,35,34,
+38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,55,
+35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,4,0,21,20,6,35,34,38,39,38,38,
+35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,
+38,1,6,21,20,22,51,50,54,53,52,38,35,1,33,37,3,0,44,153,178,173,131,37,104,
+130,44,44,146,116,149,117,140,114,62,159,130,132,149,43,73,178,29,159,15,
+105,71,28,73,80,81,84,88,1,1,1,36,209,189,126,184,132,73,69,46,47,61,45,52,
+166,52,47,157,120,70,102,82,80,110,120,77,103,113,213,2,40,53,75,63,62,70,
+92,99,252,183,2,207,252,87,3,101,156,136,119,154,78,79,84,73,25,75,118,88,
+123,146,149,107,84,81,191,90,101,67,58,68,64,64,254,178,228,199,224,119,179,
+98,59,76,60,67,125,72,56,84,152,83,126,168,44,78,106,146,77,133,127,175,237,
+1,217,70,79,62,75,72,60,78,76,250,206,50,255,255,0,60,255,206,8,6,6,244,2,
+34,2,225,0,0,0,2,2,180,0,0,255,255,0,60,254,255,8,6,6,244,2,34,2,225,0,0,
+0,2,2,183,0,0,0,5,0,73,255,206,8,72,5,154,0,101,0,113,0,114,0,115,0,116,0,
+0,1,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,
+22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,
+2,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,1,6,21,
+20,22,51,50,54,53,52,38,35,1,33,1,4,0,214,225,199,172,119,148,57,62,153,133,
+158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,155,167,120,152,126,
+87,88,83,117,137,11,159,9,123,96,109,109,165,165,137,153,173,131,17,104,130,
+44,44,146,116,109,117,140,114,62,159,130,132,149,43,33,178,29,159,15,105,
+71,8,73,80,81,84,2,234,53,75,63,62,70,92,99,252,13,3,0,251,212,3,255,99,254,
+190,197,203,228,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,
+44,65,84,113,143,149,116,105,137,56,47,86,59,63,70,121,120,114,127,129,130,
+158,238,81,11,153,126,119,154,78,79,84,73,25,75,118,88,123,146,149,107,84,
+81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,250,206,1,231,0,6,0,
+73,254,255,8,72,5,154,0,101,0,113,0,117,0,118,0,119,0,120,0,0,1,22,18,21,
+20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,
+7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,
+54,53,52,38,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,
+35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,1,6,21,20,22,51,
+50,54,53,52,38,35,1,19,51,19,39,33,1,4,0,214,225,199,172,119,148,57,62,153,
+133,158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,155,167,120,152,
+126,87,88,83,117,137,11,159,9,123,96,109,109,165,165,137,153,173,131,17,104,
+130,44,44,146,116,109,117,140,114,62,159,130,132,149,43,33,178,29,159,15,
+105,71,8,73,80,81,84,2,234,53,75,63,62,70,92,99,251,175,15,154,15,90,3,0,
+251,212,3,255,99,254,190,197,203,228,87,89,88,88,165,128,116,150,58,40,76,
+52,56,59,67,59,39,47,44,65,84,113,143,149,116,105,137,56,47,86,59,63,70,121,
+120,114,127,129,130,158,238,81,11,153,126,119,154,78,79,84,73,25,75,118,88,
+123,146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,
+249,255,1,34,254,222,207,1,231,0,255,255,0,60,255,206,10,242,5,118,2,34,2,
+190,0,0,0,3,2,235,5,5,0,0,255,255,0,72,255,206,12,197,5,118,2,34,2,196,0,
+0,0,3,2,234,7,52,0,0,255,255,0,72,255,206,6,169,5,154,0,34,2,197,0,0,0,3,
+0,67,4,77,0,0,255,255,0,73,255,206,8,235,5,154,0,34,0,48,0,0,0,3,2,227,6,
+143,0,0,0,5,0,72,255,206,8,99,5,154,0,73,0,85,0,96,0,97,0,98,0,0,1,55,51,
+22,22,21,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,39,22,4,51,50,54,53,
+52,38,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,
+38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,1,6,21,20,22,51,50,
+54,53,52,38,35,1,22,51,50,54,53,52,38,35,34,6,1,33,4,29,2,44,142,139,254,
+179,254,194,254,205,254,162,217,171,123,148,166,153,93,86,9,1,5,220,234,252,
+101,92,152,164,173,131,17,104,130,44,44,146,116,109,117,140,114,62,159,130,
+132,149,43,33,178,29,159,15,105,71,8,73,80,81,84,19,2,215,53,75,63,62,70,
+92,99,249,227,71,90,83,84,65,54,78,111,1,209,2,214,3,252,3,104,252,154,255,
+0,254,229,1,57,1,7,217,1,0,141,118,133,150,47,182,211,195,188,105,186,60,
+5,156,131,119,154,78,79,84,73,25,75,118,88,123,146,149,107,84,81,191,90,101,
+67,58,68,64,1,1,70,79,62,75,72,60,78,76,253,162,49,68,63,56,66,105,252,201,
+0,7,0,60,255,206,7,171,5,154,0,79,0,91,0,104,0,115,0,116,0,117,0,118,0,0,
+1,22,22,21,20,6,7,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,21,
+20,7,22,23,22,23,54,54,53,52,38,39,35,34,38,53,52,54,51,51,50,22,23,54,54,
+51,51,50,30,2,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,
+22,51,1,6,21,20,22,51,50,54,53,52,38,35,1,54,54,53,52,38,35,34,6,21,20,22,
+22,5,6,21,20,22,51,50,54,53,52,38,3,33,1,3,158,163,168,172,169,73,167,149,
+139,168,84,190,200,172,142,145,161,135,22,64,64,44,172,177,95,95,51,153,178,
+173,131,17,104,130,44,44,146,116,109,117,140,114,62,159,130,132,149,43,33,
+178,29,159,15,105,71,8,73,80,81,84,2,234,53,75,63,62,70,92,99,251,12,78,86,
+75,72,68,80,22,58,1,115,148,81,73,72,77,80,89,2,149,253,136,3,255,45,185,
+130,130,169,33,61,77,107,112,110,105,92,57,28,163,128,104,144,139,105,122,
+78,3,4,5,9,13,114,95,73,101,33,156,136,119,154,78,79,84,73,25,75,118,88,123,
+146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,252,
+243,22,76,50,52,60,64,49,37,49,45,204,28,84,42,45,45,42,43,58,254,162,1,80,
+0,5,0,60,255,206,7,127,5,154,0,72,0,84,0,96,0,97,0,98,0,0,1,4,0,21,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,
+34,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,
+55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,1,6,21,20,22,51,50,54,53,52,38,
+35,1,38,38,35,34,6,21,20,22,51,50,54,23,33,3,67,1,1,1,36,209,189,95,154,79,
+71,136,92,141,158,164,125,92,149,123,90,117,78,105,111,213,213,45,153,178,
+173,131,37,104,130,44,44,146,116,149,117,140,114,62,159,130,132,149,43,73,
+178,29,159,15,105,71,28,73,80,81,84,3,38,53,75,63,62,70,92,99,252,2,72,80,
+51,60,73,80,68,66,91,203,2,217,3,255,64,254,178,228,197,226,80,91,97,74,169,
+137,130,166,89,159,118,75,134,125,175,238,62,156,136,119,154,78,79,84,73,
+25,75,118,88,123,146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,
+72,60,78,76,252,16,95,56,79,67,66,84,75,252,0,0,5,0,60,255,206,7,37,5,154,
+0,85,0,97,0,109,0,110,0,111,0,0,1,22,22,21,20,6,7,22,22,21,20,6,35,34,38,
+53,52,55,54,54,55,38,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,
+54,53,52,39,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,
+35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,1,6,21,20,22,51,
+50,54,53,52,38,35,1,6,6,21,20,22,51,50,54,53,52,38,1,33,3,42,83,104,50,49,
+83,83,174,151,149,165,49,24,88,63,44,96,51,119,111,33,157,19,25,196,189,92,
+165,73,31,27,66,54,153,178,173,131,17,104,130,44,44,146,116,109,117,140,114,
+62,159,130,132,149,43,33,178,29,159,15,105,71,8,73,80,81,84,2,234,53,75,63,
+62,70,92,99,253,61,112,79,78,74,76,81,59,254,235,2,51,3,255,29,126,70,61,
+108,47,63,163,101,131,150,149,120,82,72,36,79,44,14,15,79,88,58,72,44,43,
+107,42,139,159,38,38,30,51,30,70,30,156,136,119,154,78,79,84,73,25,75,118,
+88,123,146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,
+76,252,232,80,104,54,57,65,71,67,65,111,254,20,0,255,255,0,60,254,255,8,6,
+6,244,2,34,2,225,0,0,0,2,2,205,0,0,255,255,0,60,255,206,8,6,6,244,2,34,2,
+225,0,0,0,2,2,208,0,0,255,255,0,60,255,206,11,0,6,244,0,34,2,209,0,0,0,35,
+2,210,0,156,0,0,0,3,2,227,8,164,0,0,255,255,0,34,252,234,6,103,5,154,0,34,
+2,152,0,0,0,35,0,67,4,11,0,0,0,2,2,248,0,0,255,255,0,34,255,206,6,191,6,244,
+0,34,2,152,0,0,0,3,0,68,4,11,0,0,0,8,0,60,254,255,8,162,6,244,0,106,0,118,
+0,131,0,142,0,146,0,147,0,148,0,149,0,0,1,22,18,21,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,
+22,22,21,20,7,22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,51,50,22,23,54,
+54,51,51,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,
+38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,1,6,21,20,22,51,50,54,
+53,52,38,35,1,38,35,34,6,21,20,22,51,50,54,53,52,19,38,38,35,34,6,21,20,22,
+51,50,19,19,51,19,39,33,19,4,12,214,224,224,190,96,167,102,72,168,96,145,
+154,150,128,76,153,95,34,73,3,150,124,120,159,176,143,148,211,111,72,70,128,
+77,119,120,148,167,146,168,173,131,17,104,130,44,44,146,116,49,10,161,128,
+113,149,40,156,37,106,61,77,16,161,172,159,130,132,149,43,33,178,29,159,15,
+105,71,8,73,80,81,84,2,234,53,75,63,62,70,92,99,250,221,38,44,72,83,67,61,
+68,73,75,73,108,57,58,62,78,68,130,119,15,154,15,21,3,6,168,3,255,99,254,
+190,197,200,231,59,70,65,64,127,106,98,122,55,62,80,109,183,100,21,21,114,
+137,146,119,116,153,135,243,135,158,128,47,42,134,125,148,231,96,5,154,133,
+119,154,78,79,84,73,32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,123,
+146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,254,
+105,11,71,57,60,66,67,63,59,253,140,51,40,42,35,35,43,254,128,1,34,254,222,
+207,7,38,255,255,0,82,255,206,6,243,6,244,0,34,2,154,0,0,0,3,0,68,4,63,0,
+0,255,255,255,226,254,255,10,235,5,118,2,34,2,157,0,0,0,2,2,231,0,0,255,255,
+0,73,255,206,8,151,6,244,0,34,0,25,0,0,0,3,2,228,5,227,0,0,0,5,0,52,255,206,
+8,66,6,244,0,96,0,108,0,109,0,110,0,111,0,0,1,4,0,21,20,6,35,34,38,39,6,6,
+35,34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,
+53,52,38,39,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,
+22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,
+38,35,35,34,6,21,20,22,51,1,6,21,20,22,51,50,54,53,52,38,35,1,33,19,3,179,
+1,2,1,22,202,168,115,143,67,54,148,119,147,184,61,57,202,1,223,230,94,83,
+97,123,10,159,8,127,94,108,109,234,196,3,153,178,173,131,17,104,130,44,44,
+146,116,79,10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,132,
+149,43,63,178,29,159,15,105,71,8,73,80,81,84,3,8,53,75,63,62,70,92,99,252,
+117,3,10,159,3,255,69,254,183,228,199,224,77,99,87,89,178,143,63,126,44,152,
+145,54,176,78,92,126,115,113,128,129,130,181,253,41,156,136,119,154,78,79,
+84,73,32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,123,146,149,107,84,
+81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,250,206,7,38,0,0,6,
+0,52,254,255,8,66,6,244,0,96,0,108,0,112,0,113,0,114,0,115,0,0,1,4,0,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,54,55,
+51,22,22,51,50,54,53,52,38,39,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,
+38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,
+55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,1,6,21,20,22,51,50,54,53,52,38,
+35,1,19,51,19,39,33,19,3,179,1,2,1,22,202,168,115,143,67,54,148,119,147,184,
+61,57,202,1,223,230,94,83,97,123,10,159,8,127,94,108,109,234,196,3,153,178,
+173,131,17,104,130,44,44,146,116,79,10,161,128,113,149,40,156,37,106,61,77,
+16,161,172,159,130,132,149,43,63,178,29,159,15,105,71,8,73,80,81,84,3,8,53,
+75,63,62,70,92,99,252,35,15,154,15,102,3,10,159,3,255,69,254,183,228,199,
+224,77,99,87,89,178,143,63,126,44,152,145,54,176,78,92,126,115,113,128,129,
+130,181,253,41,156,136,119,154,78,79,84,73,32,44,104,126,93,103,40,101,61,
+51,37,25,7,155,141,123,146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,
+62,75,72,60,78,76,249,255,1,34,254,222,207,7,38,0,6,0,73,255,206,8,182,6,
+244,0,131,0,143,0,144,0,145,0,146,0,147,0,0,1,22,22,21,20,6,35,34,38,39,6,
+6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,
+22,23,22,22,51,50,53,52,38,35,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,
+38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,
+55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,50,22,21,20,6,35,34,39,6,7,
+6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,39,1,6,21,20,22,51,50,54,
+53,52,38,35,1,33,19,1,5,88,33,36,187,164,114,150,54,62,153,133,158,178,140,
+164,112,70,78,77,88,86,21,153,36,179,163,137,168,15,58,170,89,162,73,82,18,
+168,178,171,133,27,104,130,44,37,139,121,48,10,161,128,113,149,40,156,37,
+106,61,77,16,161,172,159,130,132,149,43,23,178,29,159,15,105,71,18,73,80,
+73,116,25,153,148,178,153,202,140,49,192,126,87,88,83,117,137,11,159,8,123,
+102,91,96,50,2,46,53,75,63,62,70,92,99,251,227,2,237,218,251,33,2,4,51,128,
+61,142,160,86,90,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,
+84,113,143,121,112,56,64,101,48,50,151,141,121,152,78,79,81,76,32,44,104,
+126,93,103,40,101,61,51,37,25,7,155,141,123,146,149,107,84,81,191,90,101,
+67,58,64,68,134,117,114,142,111,97,70,47,86,59,63,70,121,120,116,125,80,76,
+77,85,3,59,70,79,62,75,72,60,78,76,250,206,7,38,250,193,255,255,0,72,254,
+255,12,190,5,118,2,34,2,166,0,0,0,3,2,232,4,150,0,0,255,255,0,60,255,57,10,
+168,6,244,0,34,0,30,0,0,0,3,2,228,7,244,0,0,0,6,0,78,255,206,8,203,6,244,
+0,103,0,115,0,126,0,127,0,128,0,129,0,0,1,3,22,22,21,20,6,35,34,39,6,21,21,
+20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,51,50,22,
+23,54,54,51,51,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,
+6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,22,18,21,20,
+6,35,34,38,39,6,6,35,34,2,53,52,18,55,3,5,6,21,20,22,51,50,54,53,52,38,35,
+1,22,51,50,54,53,52,38,35,34,6,1,33,19,2,63,12,104,113,164,154,117,104,2,
+123,123,108,126,11,159,9,123,96,109,109,168,167,134,150,173,131,17,104,130,
+44,44,146,116,49,10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,
+132,149,43,33,178,29,159,15,105,71,8,73,80,81,84,16,214,225,199,172,119,148,
+57,52,151,122,188,219,172,154,13,5,125,53,75,63,62,70,92,99,249,237,82,103,
+83,83,64,57,77,122,1,235,3,21,137,5,8,254,242,17,134,103,136,147,67,26,26,
+22,167,172,120,121,114,127,129,130,156,239,82,12,153,125,119,154,78,79,84,
+73,32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,123,146,149,107,84,81,
+191,90,101,67,58,68,64,99,254,190,197,203,228,87,89,85,91,1,24,222,212,1,
+25,42,1,21,8,70,79,62,75,72,60,78,76,253,173,60,68,63,58,64,100,252,196,7,
+38,0,255,255,0,72,255,206,7,1,6,244,0,34,2,169,0,0,0,3,0,68,4,77,0,0,255,
+255,0,72,255,206,7,212,6,244,0,34,2,170,0,0,0,3,2,230,5,32,0,0,255,255,0,
+72,254,255,7,212,6,244,0,34,2,171,0,0,0,3,2,230,5,32,0,0,255,255,0,68,255,
+206,9,16,6,244,0,34,0,35,0,0,0,3,2,228,6,92,0,0,0,7,0,73,255,206,8,135,6,
+244,0,94,0,106,0,116,0,128,0,129,0,130,0,131,0,0,19,22,4,51,50,36,55,6,35,
+34,38,53,52,54,55,38,39,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,
+52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,35,
+34,7,35,38,38,35,35,34,6,21,20,22,51,51,50,30,2,21,16,0,33,32,0,53,52,54,
+51,50,22,21,20,6,35,34,1,6,21,20,22,51,50,54,53,52,38,35,1,22,51,50,53,52,
+38,35,34,6,5,38,38,35,34,6,21,20,22,51,50,54,1,33,19,234,43,1,35,228,249,
+1,34,33,89,127,121,149,138,119,9,24,127,153,178,173,131,17,104,130,44,44,
+146,116,49,10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,132,
+149,43,33,178,29,159,15,105,71,8,73,80,81,84,16,29,199,191,104,254,147,254,
+163,254,162,254,128,210,164,127,147,173,151,94,5,145,53,75,63,62,70,92,99,
+250,6,66,82,186,64,57,82,113,4,93,28,94,57,60,76,71,64,65,96,253,225,3,29,
+121,1,145,129,137,161,154,83,137,114,101,138,5,3,4,156,136,119,154,78,79,
+84,73,32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,123,146,149,107,84,
+81,191,90,101,67,58,68,64,45,123,197,129,254,242,254,227,1,21,235,179,229,
+138,114,127,148,3,145,70,79,62,75,72,60,78,76,253,39,41,131,53,55,104,10,
+54,60,63,57,55,64,66,253,142,7,38,255,255,0,72,254,255,7,139,6,244,0,34,2,
+173,0,0,0,3,0,68,4,215,0,0,255,255,0,72,255,206,7,139,6,244,0,34,2,174,0,
+0,0,3,0,68,4,215,0,0,255,255,0,72,254,255,7,139,6,244,0,34,2,175,0,0,0,3,
+0,68,4,215,0,0,0,6,0,60,255,206,7,196,6,244,0,94,0,106,0,107,0,108,0,109,
+0,110,0,0,1,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,
+22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,
+38,35,35,34,6,21,20,22,51,51,4,0,21,20,6,35,34,38,39,38,38,35,34,6,21,20,
+22,23,7,38,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,38,1,6,21,20,22,
+51,50,54,53,52,38,35,1,33,1,1,3,0,44,153,178,173,131,37,104,130,44,44,146,
+116,89,10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,132,149,
+43,73,178,29,159,15,105,71,28,73,80,81,84,88,1,1,1,36,209,189,126,184,132,
+73,69,46,47,61,45,52,166,52,47,157,120,70,102,82,80,110,120,77,103,113,213,
+2,40,53,75,63,62,70,92,99,252,183,2,207,1,22,251,65,3,101,156,136,119,154,
+78,79,84,73,32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,123,146,149,
+107,84,81,191,90,101,67,58,68,64,64,254,178,228,199,224,119,179,98,59,76,
+60,67,125,72,56,84,152,83,126,168,44,78,106,146,77,133,127,175,237,1,217,
+70,79,62,75,72,60,78,76,250,206,7,38,249,12,255,255,0,60,255,206,8,94,6,244,
+2,34,2,226,0,0,0,2,2,180,0,0,255,255,0,60,254,255,8,94,6,244,2,34,2,226,0,
+0,0,2,2,183,0,0,0,6,0,73,255,206,8,160,6,244,0,115,0,127,0,128,0,129,0,130,
+0,131,0,0,1,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,22,
+23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,
+35,35,34,6,21,20,22,51,51,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,
+55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,
+20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,1,6,21,20,22,51,50,54,53,52,
+38,35,1,33,1,1,3,195,137,153,173,131,17,104,130,44,44,146,116,49,10,161,128,
+113,149,40,156,37,106,61,77,16,161,172,159,130,132,149,43,33,178,29,159,15,
+105,71,8,73,80,81,84,17,214,225,199,172,119,148,57,62,153,133,158,178,140,
+164,112,70,78,77,88,86,21,153,36,179,163,155,167,120,152,126,87,88,83,117,
+137,11,159,9,123,96,109,109,165,2,113,53,75,63,62,70,92,99,252,13,3,0,251,
+212,4,223,3,103,11,153,126,119,154,78,79,84,73,32,44,104,126,93,103,40,101,
+61,51,37,25,7,155,141,123,146,149,107,84,81,191,90,101,67,58,68,64,99,254,
+190,197,203,228,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,
+44,65,84,113,143,149,116,105,137,56,47,86,59,63,70,121,120,114,127,129,130,
+158,238,1,234,70,79,62,75,72,60,78,76,250,206,1,231,5,63,0,7,0,73,254,255,
+8,160,6,244,0,115,0,127,0,131,0,132,0,133,0,134,0,135,0,0,1,38,38,53,52,54,
+51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,
+22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,
+22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,
+21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,
+22,51,50,54,53,52,38,1,6,21,20,22,51,50,54,53,52,38,35,1,19,51,19,39,33,1,
+1,3,195,137,153,173,131,17,104,130,44,44,146,116,49,10,161,128,113,149,40,
+156,37,106,61,77,16,161,172,159,130,132,149,43,33,178,29,159,15,105,71,8,
+73,80,81,84,17,214,225,199,172,119,148,57,62,153,133,158,178,140,164,112,
+70,78,77,88,86,21,153,36,179,163,155,167,120,152,126,87,88,83,117,137,11,
+159,9,123,96,109,109,165,2,113,53,75,63,62,70,92,99,251,175,15,154,15,90,
+3,0,251,212,4,223,3,103,11,153,126,119,154,78,79,84,73,32,44,104,126,93,103,
+40,101,61,51,37,25,7,155,141,123,146,149,107,84,81,191,90,101,67,58,68,64,
+99,254,190,197,203,228,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,
+39,47,44,65,84,113,143,149,116,105,137,56,47,86,59,63,70,121,120,114,127,
+129,130,158,238,1,234,70,79,62,75,72,60,78,76,249,255,1,34,254,222,207,1,
+231,5,63,0,255,255,0,60,255,206,10,235,5,118,2,34,2,191,0,0,0,3,2,235,5,5,
+0,0,255,255,0,72,255,206,12,190,5,118,2,34,2,195,0,0,0,3,2,234,7,52,0,0,255,
+255,0,72,255,206,7,1,6,244,0,34,2,197,0,0,0,3,0,68,4,77,0,0,255,255,0,73,
+255,206,9,67,6,244,0,34,0,48,0,0,0,3,2,228,6,143,0,0,0,6,0,72,255,206,8,187,
+6,244,0,87,0,99,0,110,0,111,0,112,0,113,0,0,1,55,51,22,22,21,16,0,33,32,0,
+17,52,18,51,50,22,21,20,6,35,34,39,22,4,51,50,54,53,52,38,39,38,38,53,52,
+54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,
+23,22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,
+51,1,6,21,20,22,51,50,54,53,52,38,35,1,22,51,50,54,53,52,38,35,34,6,1,33,
+1,4,29,2,44,142,139,254,179,254,194,254,205,254,162,217,171,123,148,166,153,
+93,86,9,1,5,220,234,252,101,92,152,164,173,131,17,104,130,44,44,146,116,49,
+10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,132,149,43,33,178,
+29,159,15,105,71,8,73,80,81,84,19,2,215,53,75,63,62,70,92,99,249,227,71,90,
+83,84,65,54,78,111,1,209,2,214,1,7,3,252,3,104,252,154,255,0,254,229,1,57,
+1,7,217,1,0,141,118,133,150,47,182,211,195,188,105,186,60,5,156,131,119,154,
+78,79,84,73,32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,123,146,149,
+107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,253,162,49,68,
+63,56,66,105,252,201,7,38,0,0,8,0,60,255,206,8,3,6,244,0,93,0,105,0,118,0,
+129,0,130,0,131,0,132,0,133,0,0,1,22,22,21,20,6,7,22,21,20,6,35,34,38,53,
+52,55,38,38,53,52,54,51,50,22,21,20,7,22,23,22,23,54,54,53,52,38,39,35,34,
+38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,22,23,7,38,35,34,
+6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,
+20,22,51,1,6,21,20,22,51,50,54,53,52,38,35,1,54,54,53,52,38,35,34,6,21,20,
+22,22,5,6,21,20,22,51,50,54,53,52,38,3,33,1,1,3,158,163,168,172,169,73,167,
+149,139,168,84,190,200,172,142,145,161,135,22,64,64,44,172,177,95,95,51,153,
+178,173,131,17,104,130,44,44,146,116,49,10,161,128,113,149,40,156,37,106,
+61,77,16,161,172,159,130,132,149,43,33,178,29,159,15,105,71,8,73,80,81,84,
+2,234,53,75,63,62,70,92,99,251,12,78,86,75,72,68,80,22,58,1,115,148,81,73,
+72,77,80,89,2,149,1,138,251,254,3,255,45,185,130,130,169,33,61,77,107,112,
+110,105,92,57,28,163,128,104,144,139,105,122,78,3,4,5,9,13,114,95,73,101,
+33,156,136,119,154,78,79,84,73,32,44,104,126,93,103,40,101,61,51,37,25,7,
+155,141,123,146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,
+78,76,252,243,22,76,50,52,60,64,49,37,49,45,204,28,84,42,45,45,42,43,58,254,
+162,7,38,250,42,0,0,6,0,60,255,206,7,215,6,244,0,86,0,98,0,110,0,111,0,112,
+0,113,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,
+35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,22,23,7,38,
+35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,
+6,21,20,22,51,51,4,0,21,20,6,35,34,38,1,6,21,20,22,51,50,54,53,52,38,35,1,
+38,38,35,34,6,21,20,22,51,50,54,23,33,1,2,146,71,136,92,141,158,164,125,92,
+149,123,90,117,78,105,111,213,213,45,153,178,173,131,37,104,130,44,44,146,
+116,89,10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,132,149,
+43,73,178,29,159,15,105,71,28,73,80,81,84,89,1,1,1,36,209,189,95,154,3,47,
+53,75,63,62,70,92,99,252,2,72,80,51,60,73,80,68,66,91,203,2,217,1,2,145,97,
+74,169,137,130,166,89,159,118,75,134,125,175,238,62,156,136,119,154,78,79,
+84,73,32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,123,146,149,107,84,
+81,191,90,101,67,58,68,64,64,254,178,228,197,226,80,4,202,70,79,62,75,72,
+60,78,76,252,16,95,56,79,67,66,84,75,252,7,38,0,6,0,60,255,206,7,125,6,244,
+0,99,0,111,0,123,0,124,0,125,0,126,0,0,1,54,54,53,52,39,35,34,38,53,52,54,
+51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,
+22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,
+22,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,55,54,54,55,38,38,35,34,6,21,
+20,23,7,38,38,53,52,54,51,50,22,1,6,21,20,22,51,50,54,53,52,38,35,1,6,6,21,
+20,22,51,50,54,53,52,38,1,33,1,3,7,31,27,66,54,153,178,173,131,17,104,130,
+44,44,146,116,49,10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,
+132,149,43,33,178,29,159,15,105,71,8,73,80,81,84,94,83,104,50,49,83,83,174,
+151,149,165,49,24,88,63,44,96,51,119,111,33,157,19,25,196,189,92,165,2,248,
+53,75,63,62,70,92,99,253,61,112,79,78,74,76,81,59,254,235,2,51,2,77,2,146,
+30,51,30,70,30,156,136,119,154,78,79,84,73,32,44,104,126,93,103,40,101,61,
+51,37,25,7,155,141,123,146,149,107,84,81,191,90,101,67,58,68,64,29,126,70,
+61,108,47,63,163,101,131,150,149,120,82,72,36,79,44,14,15,79,88,58,72,44,
+43,107,42,139,159,38,2,72,70,79,62,75,72,60,78,76,252,232,80,104,54,57,65,
+71,67,65,111,254,20,7,38,0,255,255,0,60,254,255,8,94,6,244,2,34,2,226,0,0,
+0,2,2,205,0,0,255,255,0,60,255,206,8,94,6,244,2,34,2,226,0,0,0,2,2,208,0,
+0,255,255,0,60,255,206,11,88,6,244,0,34,2,209,0,0,0,35,2,210,0,156,0,0,0,
+3,2,228,8,164,0,0,255,255,0,34,252,234,6,191,6,244,0,34,2,152,0,0,0,35,0,
+68,4,11,0,0,0,2,2,248,0,0,255,255,0,34,255,206,6,103,5,118,0,34,2,152,0,0,
+0,3,0,69,4,11,0,0,255,255,0,60,254,255,8,74,5,118,0,34,2,153,0,0,0,3,2,220,
+2,38,0,0,255,255,0,82,255,206,6,155,5,118,0,34,2,154,0,0,0,3,0,69,4,63,0,
+0,255,255,0,60,254,255,10,181,6,244,0,34,2,156,0,0,0,35,2,210,0,156,0,0,0,
+3,2,220,4,145,0,0,255,255,0,73,255,206,8,63,5,118,0,34,0,25,0,0,0,3,2,220,
+2,27,0,0,255,255,0,52,255,206,7,234,5,118,0,34,2,160,0,0,0,3,2,221,5,142,
+0,0,255,255,0,52,254,255,7,234,5,118,0,34,2,162,0,0,0,3,2,221,5,142,0,0,255,
+255,0,73,255,206,8,94,5,118,0,34,2,163,0,0,0,3,2,220,2,58,0,0,255,255,0,72,
+254,255,12,136,6,244,0,34,2,165,0,0,0,35,2,210,1,38,0,0,0,3,2,220,6,100,0,
+0,255,255,0,60,255,57,10,80,5,118,0,35,2,220,4,44,0,0,0,2,0,30,0,0,255,255,
+0,78,255,206,8,115,5,118,0,34,2,168,0,0,0,3,2,220,2,79,0,0,255,255,0,72,255,
+206,6,169,5,118,0,34,2,169,0,0,0,3,0,69,4,77,0,0,255,255,0,72,255,206,7,124,
+5,118,0,34,2,170,0,0,0,3,2,221,5,32,0,0,255,255,0,72,254,255,7,124,5,118,
+0,34,2,171,0,0,0,3,2,221,5,32,0,0,255,255,0,68,255,206,8,184,5,118,0,34,0,
+35,0,0,0,3,2,220,2,148,0,0,255,255,0,73,255,206,8,47,5,118,0,34,2,172,0,0,
+0,3,2,220,2,11,0,0,255,255,0,72,254,255,7,51,5,118,0,34,2,173,0,0,0,3,2,221,
+4,215,0,0,255,255,0,72,255,206,7,51,5,118,0,34,2,174,0,0,0,3,2,221,4,215,
+0,0,255,255,0,72,254,255,7,51,5,118,0,34,2,175,0,0,0,3,2,221,4,215,0,0,255,
+255,0,60,255,206,7,108,5,118,0,34,2,177,0,0,0,3,2,224,5,16,0,0,255,255,0,
+60,255,206,7,232,6,244,0,34,2,180,0,0,0,2,2,219,0,0,255,255,0,60,254,255,
+7,232,6,244,2,34,2,219,0,0,0,2,2,183,0,0,255,255,0,73,255,206,8,72,5,118,
+0,34,2,184,0,0,0,3,2,220,2,36,0,0,255,255,0,73,254,255,8,72,5,118,0,34,2,
+186,0,0,0,3,2,220,2,36,0,0,255,255,0,60,255,206,10,181,6,244,0,34,2,192,0,
+0,0,35,2,210,0,241,0,0,0,3,2,222,5,0,0,0,255,255,0,72,255,206,12,121,6,244,
+0,34,2,194,0,0,0,35,2,210,4,29,0,0,0,3,2,223,7,28,0,0,255,255,0,72,255,206,
+6,169,5,118,0,34,2,197,0,0,0,3,0,69,4,77,0,0,255,255,0,73,255,206,8,235,5,
+118,0,34,0,48,0,0,0,3,2,220,2,199,0,0,255,255,0,72,255,206,8,99,5,118,0,34,
+2,198,0,0,0,3,2,220,2,63,0,0,255,255,0,60,255,206,7,211,5,118,0,34,2,199,
+0,0,0,3,2,220,1,175,0,0,255,255,0,60,255,206,7,127,5,118,0,34,2,201,0,0,0,
+3,2,224,5,35,0,0,255,255,0,60,255,206,7,0,5,118,0,35,2,221,4,164,0,0,0,2,
+2,202,0,0,255,255,0,60,254,255,7,232,6,244,2,34,2,219,0,0,0,2,2,205,0,0,255,
+255,0,60,255,206,7,232,6,244,2,34,2,219,0,0,0,2,2,208,0,0,255,255,0,60,255,
+206,11,0,6,244,0,35,2,220,4,220,0,0,0,34,2,209,0,0,0,3,2,210,0,156,0,0,255,
+255,0,34,252,234,6,103,5,118,0,34,2,152,0,0,0,35,0,69,4,11,0,0,0,2,2,248,
+0,0,0,2,255,178,253,78,3,203,3,255,0,43,0,44,0,0,33,22,22,21,20,6,35,34,38,
+53,52,54,54,55,62,2,53,52,38,39,55,22,22,21,20,6,7,14,2,21,20,22,51,50,54,
+53,52,38,39,53,33,21,1,2,94,58,65,217,186,194,210,32,54,59,63,50,31,95,93,
+108,114,131,49,97,61,54,31,126,116,117,124,93,84,2,69,254,72,60,166,76,182,
+206,216,182,69,136,125,107,117,109,119,57,123,154,70,129,90,219,158,75,181,
+178,114,118,121,56,123,134,127,112,90,173,58,134,150,3,101,0,0,6,251,193,
+252,67,255,181,255,206,0,48,0,60,0,71,0,75,0,76,0,77,0,0,1,22,51,50,53,52,
+38,39,55,22,22,21,20,6,35,34,38,39,6,35,34,38,53,52,54,51,50,22,23,54,53,
+52,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,1,39,38,6,21,20,22,51,
+50,54,53,52,19,38,38,35,34,6,21,20,22,51,50,19,55,51,23,3,23,253,218,77,86,
+167,120,129,70,151,173,160,137,66,115,78,101,137,106,112,104,90,56,109,70,
+21,53,4,104,88,86,113,130,106,108,153,77,254,193,15,52,63,40,37,36,41,63,
+49,62,38,35,39,46,43,78,90,11,129,10,25,77,253,146,36,144,86,127,49,127,58,
+207,126,127,147,32,46,78,85,68,64,77,31,38,45,61,117,58,14,24,70,81,95,78,
+76,99,88,154,83,93,1,55,1,3,37,36,31,35,36,36,35,254,124,29,18,19,18,17,23,
+254,233,196,196,3,139,207,0,2,252,214,252,234,255,181,255,206,0,22,0,23,0,
+0,1,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,3,254,187,
+105,114,112,101,118,106,138,113,201,171,164,199,49,65,253,253,37,133,125,
+105,111,115,100,132,127,59,156,172,145,192,183,149,85,155,93,2,228,0,0,5,
+250,83,252,67,0,0,255,206,0,48,0,59,0,63,0,64,0,65,0,0,1,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,22,21,
+21,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,37,38,38,35,34,6,21,20,
+22,51,50,19,55,51,23,19,23,253,221,35,121,86,66,109,61,53,98,64,101,112,120,
+91,57,112,83,73,81,48,66,70,121,128,70,152,172,103,114,71,74,121,128,70,152,
+172,147,137,150,253,98,42,58,30,41,47,52,48,76,51,11,129,10,215,231,253,93,
+57,58,48,61,64,45,116,90,92,114,62,89,79,50,73,69,86,129,49,127,58,207,126,
+22,120,73,69,86,129,49,127,58,208,125,131,143,197,48,40,43,38,38,46,254,225,
+196,196,3,139,207,0,3,251,219,252,234,255,181,255,206,0,61,0,62,0,63,0,0,
+5,7,51,21,33,6,7,6,6,21,20,51,50,54,55,51,22,22,51,50,54,53,52,39,55,22,21,
+20,6,35,34,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,21,20,23,7,38,
+53,52,54,51,50,22,23,51,39,39,3,254,214,8,177,254,35,39,120,77,59,101,80,
+85,11,140,8,77,62,60,59,29,129,43,135,116,147,81,47,120,82,115,125,106,114,
+61,47,48,48,110,13,129,24,133,118,103,123,8,136,8,120,173,125,155,118,52,
+42,26,41,29,70,66,71,66,71,45,39,47,41,42,71,75,94,106,118,59,59,106,86,71,
+100,38,20,37,30,27,34,66,29,20,30,39,60,71,91,82,73,155,75,254,55,0,2,254,
+107,253,78,3,58,3,255,0,37,0,38,0,0,19,6,6,35,34,38,53,52,55,35,53,33,21,
+6,6,21,20,22,51,50,55,51,22,51,50,54,53,16,0,37,55,4,0,17,20,6,35,34,1,208,
+59,125,89,118,151,84,155,1,152,90,92,70,60,145,37,150,23,148,100,110,254,
+135,254,188,83,1,96,1,172,193,175,159,1,23,253,216,73,65,138,114,98,72,142,
+135,21,86,61,53,62,170,170,176,174,1,48,2,69,190,142,206,253,108,254,148,
+233,250,6,23,0,3,254,107,252,190,3,58,3,255,0,37,0,41,0,42,0,0,19,6,6,35,
+34,38,53,52,55,35,53,33,21,6,6,21,20,22,51,50,55,51,22,51,50,54,53,16,0,37,
+55,4,0,17,20,6,35,34,7,55,51,23,1,208,59,125,89,118,151,84,155,1,152,90,92,
+70,60,145,37,150,23,148,100,110,254,135,254,188,83,1,96,1,172,193,175,159,
+176,11,140,10,1,38,253,216,73,65,138,114,98,72,142,135,21,86,61,53,62,170,
+170,176,174,1,48,2,69,190,142,206,253,108,254,148,233,250,144,194,194,6,167,
+0,0,3,251,219,252,234,255,181,255,206,0,75,0,76,0,77,0,0,3,22,21,20,6,35,
+34,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,21,20,23,7,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,35,34,7,39,54,51,50,22,21,20,6,35,34,39,
+6,7,6,6,21,20,51,50,54,55,51,22,22,51,50,54,53,52,39,1,3,118,43,135,116,147,
+81,47,120,82,115,125,106,114,61,47,48,48,110,13,129,24,133,118,96,121,14,
+40,117,60,57,55,91,46,48,15,53,72,99,109,124,113,135,108,34,134,77,59,101,
+80,85,11,140,8,77,62,60,59,29,254,191,173,254,68,71,75,94,106,118,59,59,106,
+86,71,100,38,20,37,30,27,34,66,29,20,30,39,60,71,91,71,67,36,41,22,27,47,
+8,116,11,85,80,80,89,74,61,46,26,41,29,70,66,71,66,71,45,39,47,41,1,180,254,
+55,0,0,4,250,67,252,67,0,0,255,206,0,47,0,59,0,63,0,64,0,0,1,6,6,35,34,38,
+53,52,54,51,50,22,21,20,7,22,51,50,54,53,52,39,55,22,22,21,20,7,22,51,50,
+54,53,52,39,55,22,22,21,20,6,35,34,39,6,6,35,34,37,50,54,53,52,38,35,34,6,
+21,20,22,1,55,51,23,1,252,115,44,122,79,142,173,176,139,141,174,13,77,89,
+65,65,209,70,131,149,5,69,80,65,65,209,70,131,149,133,124,116,96,33,101,69,
+130,254,159,84,91,90,85,83,90,90,2,187,11,129,10,254,166,253,88,55,55,182,
+141,149,193,191,149,58,44,91,73,69,167,97,127,58,208,125,37,33,72,73,69,168,
+96,127,58,208,125,131,143,86,43,43,132,103,94,94,110,107,91,96,107,254,213,
+196,196,3,139,0,3,250,245,252,123,0,0,255,206,0,62,0,73,0,74,0,0,7,7,51,21,
+33,21,20,6,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,23,
+54,54,53,52,38,35,34,6,7,35,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,
+54,51,50,22,23,51,39,1,38,38,35,34,21,20,22,51,50,54,19,139,8,147,254,135,
+48,49,32,28,124,21,8,66,157,90,148,149,150,135,108,176,69,18,17,69,65,52,
+69,12,140,22,108,47,46,14,131,26,123,99,74,101,39,74,144,84,126,29,117,8,
+254,161,44,129,85,156,88,91,72,118,1,125,155,118,3,68,119,51,62,70,74,56,
+21,47,62,30,27,38,38,100,94,86,98,63,64,26,61,35,78,82,55,48,109,39,33,28,
+32,26,57,61,76,90,54,61,115,81,74,155,254,20,43,42,65,39,34,27,2,81,0,4,251,
+184,252,234,255,181,255,206,0,41,0,52,0,53,0,54,0,0,1,21,20,22,51,50,55,51,
+22,22,51,50,53,52,38,39,55,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,38,35,34,6,37,23,252,64,80,79,
+143,16,139,7,77,60,139,121,128,70,153,171,142,124,78,108,45,41,111,81,133,
+158,180,130,93,106,120,111,70,55,51,61,58,58,44,39,49,77,1,83,86,254,53,10,
+92,97,137,68,69,143,85,129,49,127,60,207,124,128,146,53,62,58,57,178,141,
+156,190,97,79,90,102,141,28,37,33,32,35,57,250,207,0,0,4,252,193,252,234,
+255,181,255,206,0,11,0,23,0,35,0,36,0,0,5,50,22,21,20,6,35,34,38,53,52,54,
+19,50,54,53,52,38,35,34,6,21,20,22,19,50,22,21,20,6,35,34,38,53,52,54,19,
+254,59,169,209,207,171,172,206,208,169,109,125,125,109,108,124,124,108,40,
+45,44,41,38,46,46,39,125,184,146,149,186,185,148,147,185,253,235,109,90,90,
+112,110,88,92,111,1,34,47,42,42,46,46,42,42,47,1,62,0,3,251,215,252,234,255,
+181,255,206,0,40,0,52,0,53,0,0,1,6,6,35,34,38,53,52,36,51,50,22,23,7,38,38,
+35,34,6,21,20,22,51,50,55,51,22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,
+55,51,50,54,53,52,38,35,34,6,21,20,3,253,168,38,106,82,108,131,1,11,225,113,
+189,96,73,80,148,95,164,185,62,56,114,18,140,10,72,22,102,87,93,113,129,117,
+103,136,237,18,51,54,43,33,37,41,216,253,94,58,58,147,128,179,211,44,52,123,
+48,39,133,117,76,75,137,111,23,40,49,75,87,103,79,98,106,56,66,39,38,34,31,
+36,32,42,2,74,0,0,5,251,215,252,65,255,181,255,206,0,40,0,52,0,56,0,57,0,
+58,0,0,1,6,6,35,34,38,53,52,36,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,
+55,51,22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,55,51,50,54,53,52,38,35,
+34,6,21,20,1,55,51,23,3,1,253,168,38,106,82,108,131,1,11,225,113,189,96,73,
+80,148,95,164,185,62,56,114,18,140,10,72,22,102,87,93,113,129,117,103,136,
+237,18,51,54,43,33,37,41,254,192,11,129,10,46,255,0,253,94,58,58,147,128,
+179,211,44,52,123,48,39,133,117,76,75,137,111,23,40,49,75,87,103,79,98,106,
+56,66,39,38,34,31,36,32,42,254,191,196,196,3,139,252,115,0,0,3,251,96,252,
+234,255,181,255,206,0,60,0,71,0,72,0,0,3,38,38,35,34,6,7,35,38,38,35,34,6,
+21,20,22,51,51,21,35,34,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,
+53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,23,38,
+35,34,6,21,20,22,51,50,54,1,214,2,97,82,59,81,12,139,19,111,81,66,65,58,53,
+126,105,140,49,48,49,79,53,97,67,131,86,113,126,127,116,145,126,91,132,60,
+48,111,72,142,171,152,142,100,116,114,99,89,51,55,74,42,48,45,43,49,65,254,
+137,254,46,99,110,64,55,59,65,39,34,36,37,117,81,33,39,38,54,86,69,59,95,
+80,116,42,44,111,82,95,52,67,64,55,190,152,155,168,102,82,82,105,172,56,37,
+33,31,35,40,2,69,0,4,251,19,252,234,255,226,255,206,0,15,0,27,0,28,0,29,0,
+0,1,53,33,38,53,52,54,51,50,22,21,20,14,2,35,55,51,50,54,53,52,38,35,34,6,
+21,20,3,3,251,19,2,221,42,143,129,120,148,60,110,140,124,83,10,101,98,66,
+59,62,69,217,58,253,117,154,67,76,97,132,134,112,80,106,69,25,154,62,66,48,
+61,64,53,64,1,135,253,28,0,0,5,252,19,252,67,255,181,255,206,0,17,0,36,0,
+48,0,52,0,53,0,0,1,6,6,35,34,38,53,52,36,51,50,22,21,20,6,35,34,38,55,22,
+22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,55,50,22,21,20,6,35,34,
+38,53,52,54,3,55,51,23,3,253,228,45,100,82,111,127,1,1,208,212,253,124,115,
+92,100,36,16,60,52,56,66,171,149,155,165,65,57,50,61,17,70,43,47,47,43,42,
+47,47,32,11,129,10,76,253,94,62,54,156,126,173,210,213,172,129,151,58,176,
+55,47,78,67,118,138,134,116,73,78,49,53,213,44,40,40,43,44,39,40,44,253,154,
+196,196,3,139,0,0,3,252,19,252,234,255,181,255,206,0,17,0,35,0,36,0,0,1,6,
+6,35,34,38,53,52,36,51,50,22,21,20,6,35,34,38,55,22,22,51,50,54,53,52,38,
+35,34,6,21,20,22,51,50,55,19,253,228,45,100,82,111,127,1,1,208,212,253,124,
+115,92,100,36,11,57,60,56,66,171,149,155,165,65,57,107,21,70,253,94,62,54,
+156,126,173,210,213,172,129,151,58,211,66,71,78,67,118,138,134,116,73,78,
+137,1,215,0,0,4,252,19,252,67,255,181,255,206,0,17,0,35,0,39,0,40,0,0,1,6,
+6,35,34,38,53,52,36,51,50,22,21,20,6,35,34,38,55,22,22,51,50,54,53,52,38,
+35,34,6,21,20,22,51,50,55,3,55,51,23,3,253,228,45,100,82,111,127,1,1,208,
+212,253,124,115,92,100,36,11,57,60,56,66,171,149,155,165,65,57,107,21,4,11,
+129,10,76,253,94,62,54,156,126,173,210,213,172,129,151,58,211,66,71,78,67,
+118,138,134,116,73,78,137,254,76,196,196,3,139,0,0,4,254,148,253,77,3,138,
+3,255,0,37,0,50,0,51,0,52,0,0,1,54,54,53,16,0,37,55,4,0,17,20,6,7,22,22,51,
+50,54,55,23,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,19,46,2,35,34,
+6,21,20,22,51,50,54,1,1,1,149,44,45,254,245,254,248,83,1,41,1,57,72,71,53,
+75,34,39,59,35,98,56,108,68,72,114,75,83,200,117,171,206,177,151,111,182,
+53,90,107,93,57,73,93,116,107,86,145,254,172,1,20,254,170,72,178,107,1,24,
+1,172,158,142,177,253,245,254,209,142,236,93,50,44,32,41,105,60,54,62,74,
+68,68,173,145,130,167,106,254,244,94,95,39,83,68,83,89,48,5,86,252,155,0,
+0,4,254,143,253,78,3,58,3,255,0,30,0,42,0,43,0,44,0,0,19,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,16,0,37,55,4,0,17,20,6,35,34,38,39,38,
+38,35,34,6,21,20,22,51,50,54,3,1,151,62,118,80,121,139,145,107,80,131,101,
+91,98,59,106,115,254,135,254,188,83,1,96,1,172,202,183,97,127,158,47,69,52,
+46,61,61,53,49,77,113,1,20,253,217,82,57,141,114,104,140,67,118,107,61,178,
+172,1,48,2,69,190,142,206,253,108,254,148,229,254,65,185,59,50,60,49,53,60,
+53,5,89,252,155,0,0,5,254,143,252,190,3,58,3,255,0,30,0,42,0,46,0,47,0,48,
+0,0,19,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,16,0,37,55,4,0,
+17,20,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,54,19,55,51,23,1,1,151,62,
+118,80,121,139,145,107,80,131,101,91,98,59,106,115,254,135,254,188,83,1,96,
+1,172,202,183,97,127,158,47,69,52,46,61,61,53,49,77,48,11,140,10,254,190,
+1,20,253,217,82,57,141,114,104,140,67,118,107,61,178,172,1,48,2,69,190,142,
+206,253,108,254,148,229,254,65,185,59,50,60,49,53,60,53,254,178,194,194,6,
+167,252,155,0,5,254,156,252,234,3,68,3,255,0,58,0,59,0,60,0,61,0,62,0,0,19,
+6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,21,20,22,23,7,38,53,52,54,51,
+50,22,21,20,6,7,6,6,21,20,22,51,50,55,51,22,51,50,54,53,16,0,37,55,4,0,17,
+16,2,35,34,38,1,1,3,3,221,49,138,104,124,141,114,129,74,61,59,55,129,10,4,
+144,26,148,135,129,141,91,145,71,67,58,53,182,37,146,23,139,106,107,254,131,
+254,182,83,1,100,1,178,192,170,90,121,254,160,1,20,220,41,253,122,76,68,116,
+91,82,109,42,23,41,38,29,34,72,15,34,4,32,50,57,76,100,105,79,78,95,49,24,
+48,35,35,37,158,158,202,202,1,70,2,88,195,142,208,253,83,254,125,255,0,254,
+235,67,6,56,252,155,254,26,1,35,0,0,6,254,156,252,82,3,68,3,255,0,58,0,62,
+0,63,0,64,0,65,0,66,0,0,19,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,
+21,20,22,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,55,51,22,
+51,50,54,53,16,0,37,55,4,0,17,16,2,35,34,38,7,55,51,23,1,1,3,3,221,49,138,
+104,124,141,114,129,74,61,59,55,129,10,4,144,26,148,135,129,141,91,145,71,
+67,58,53,182,37,146,23,139,106,107,254,131,254,182,83,1,100,1,178,192,170,
+90,121,126,11,140,10,254,125,1,20,220,41,253,122,76,68,116,91,82,109,42,23,
+41,38,29,34,72,15,34,4,32,50,57,76,100,105,79,78,95,49,24,48,35,35,37,158,
+158,202,202,1,70,2,88,195,142,208,253,83,254,125,255,0,254,235,67,219,194,
+194,7,19,252,155,254,26,1,35,0,5,254,254,252,234,3,3,3,255,0,44,0,55,0,56,
+0,57,0,58,0,0,1,6,4,35,34,36,53,52,54,55,54,55,62,2,53,52,38,39,55,22,18,
+21,20,6,7,22,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,32,55,1,6,21,20,
+51,50,54,53,52,38,35,55,19,19,3,3,99,254,232,166,224,254,252,193,164,21,24,
+74,61,25,140,149,73,183,195,86,102,130,148,149,122,126,143,11,65,70,174,160,
+1,8,152,254,68,36,124,53,67,94,86,120,22,132,253,199,108,113,229,201,154,
+234,40,36,37,116,124,108,46,111,166,65,146,76,254,253,156,94,207,151,13,148,
+119,105,137,145,128,37,36,42,136,86,136,148,167,1,174,64,55,140,62,49,72,
+76,136,3,12,252,155,0,0,4,255,179,252,234,3,170,3,255,0,72,0,73,0,74,0,75,
+0,0,1,54,53,52,38,35,34,6,21,20,22,22,23,22,18,21,20,4,33,34,38,53,52,54,
+55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,6,
+6,21,20,22,51,50,54,53,52,38,38,39,38,38,53,52,54,51,50,22,21,20,7,3,19,3,
+2,115,56,122,110,105,123,61,127,138,216,173,254,200,254,232,191,211,110,113,
+96,62,63,60,61,64,12,140,11,15,147,135,131,146,93,140,93,58,139,119,196,220,
+72,161,157,181,140,215,179,182,208,81,244,2,255,2,6,65,86,95,113,108,88,53,
+112,121,106,165,254,236,177,219,242,143,114,92,114,44,38,52,44,41,44,43,37,
+28,27,32,25,64,22,86,110,131,93,78,113,59,38,53,38,53,64,163,156,95,148,166,
+123,140,215,121,152,188,195,157,130,106,254,77,1,97,252,242,0,4,0,3,252,65,
+3,13,3,255,0,21,0,32,0,33,0,34,0,0,1,6,6,35,34,38,53,52,54,51,50,22,18,21,
+16,0,1,39,0,0,17,52,39,38,38,35,34,6,21,20,22,51,50,3,7,2,85,70,132,76,132,
+157,176,138,133,197,107,254,182,254,175,111,1,66,1,35,63,38,109,70,64,82,
+80,68,111,35,80,2,60,46,41,148,126,115,149,161,254,214,181,254,150,253,144,
+254,234,125,1,7,2,41,1,64,97,238,84,84,69,55,66,68,250,184,232,0,0,4,251,
+98,252,234,255,181,255,206,0,28,0,39,0,66,0,67,0,0,1,51,38,53,52,54,51,50,
+22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,37,22,51,50,54,
+53,52,38,35,34,6,23,53,6,35,34,39,22,22,51,50,55,51,22,51,50,54,53,52,38,
+35,34,6,21,20,22,23,21,1,253,42,226,49,107,94,122,151,172,147,81,105,47,35,
+101,97,153,169,159,125,90,107,254,176,43,53,56,57,40,38,51,66,249,56,96,59,
+61,3,97,85,131,35,137,36,123,87,97,68,62,35,41,57,55,254,193,254,109,50,70,
+67,91,178,140,161,186,47,55,43,59,182,158,146,179,97,80,59,5,24,39,33,30,
+35,56,221,66,39,27,92,100,104,104,111,100,88,105,34,31,37,52,6,106,1,214,
+0,0,3,251,164,252,234,255,181,255,206,0,37,0,38,0,39,0,0,1,54,54,51,50,22,
+21,20,6,7,39,54,54,53,52,38,35,34,7,35,38,38,35,34,6,21,20,22,23,7,38,38,
+53,52,54,51,50,22,55,3,253,173,47,116,82,123,152,94,107,107,84,78,73,65,139,
+28,139,10,91,73,59,73,74,89,107,108,93,152,123,82,118,46,120,254,238,80,69,
+159,118,97,172,88,100,63,121,68,62,75,173,83,90,77,62,65,115,69,101,92,172,
+96,117,157,71,146,253,28,0,6,255,24,252,234,3,25,3,255,0,36,0,48,0,58,0,59,
+0,60,0,61,0,0,1,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,
+7,23,22,23,54,54,53,52,0,37,55,4,0,17,20,6,37,54,54,53,52,38,35,34,6,21,20,
+22,5,6,6,21,20,22,51,50,53,52,3,3,1,1,246,63,145,119,115,142,58,162,172,145,
+131,126,137,105,60,59,18,142,150,254,172,254,184,84,1,99,1,135,153,253,161,
+60,70,62,63,63,65,74,1,61,55,63,68,55,120,26,53,1,36,254,32,51,73,90,96,96,
+86,68,48,17,139,111,90,117,110,94,94,65,5,5,5,29,192,149,255,1,209,187,142,
+203,253,223,254,211,165,238,76,21,63,34,39,45,45,39,51,54,171,10,41,38,29,
+35,64,69,2,19,3,101,250,138,0,0,4,255,7,253,78,3,170,3,255,0,55,0,67,0,68,
+0,69,0,0,1,54,54,53,52,38,35,34,6,21,20,22,22,23,22,18,21,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,39,38,38,53,
+52,54,51,50,22,21,20,7,1,38,38,35,34,6,21,20,22,51,50,54,19,1,2,113,33,25,
+122,110,105,123,61,126,139,219,170,197,170,88,142,69,62,116,83,121,139,145,
+107,80,131,101,98,104,65,91,99,72,160,159,180,140,219,175,185,205,92,253,
+194,46,69,53,46,61,61,53,49,77,43,1,79,1,245,48,76,44,95,113,107,88,54,112,
+120,107,168,254,239,177,165,196,68,72,81,59,141,114,104,140,67,118,114,54,
+117,102,95,148,165,124,139,216,121,146,194,190,150,136,126,252,163,57,52,
+60,49,53,60,53,1,244,1,97,0,4,254,151,252,234,2,66,3,255,0,39,0,51,0,52,0,
+53,0,0,3,55,22,18,21,20,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,35,34,6,
+21,20,23,7,38,53,52,54,51,50,23,54,54,53,52,2,19,6,6,21,20,22,51,50,54,53,
+52,38,19,3,38,84,232,244,86,86,109,119,158,144,142,161,62,73,45,50,108,111,
+25,141,39,196,188,96,93,78,69,196,89,73,52,79,72,68,78,90,13,160,3,113,142,
+118,254,140,227,122,230,110,62,184,102,137,149,147,119,71,136,90,6,73,70,
+42,56,39,77,76,121,152,25,101,191,110,184,1,30,251,239,81,103,49,66,81,79,
+68,69,125,4,153,252,155,0,5,251,207,252,65,0,15,255,206,0,46,0,57,0,58,0,
+59,0,60,0,0,1,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,
+55,22,22,21,20,6,7,6,21,20,22,51,50,55,23,6,6,35,34,38,39,6,35,34,38,39,38,
+38,35,34,6,21,20,22,51,50,27,2,253,123,53,98,64,101,112,120,91,57,112,83,
+73,81,48,66,70,121,128,70,152,172,42,43,6,37,31,46,39,80,48,80,48,90,106,
+3,22,27,66,109,140,42,58,30,41,47,52,48,76,166,42,3,253,87,64,45,116,90,92,
+114,62,89,79,50,73,69,86,129,49,127,58,207,126,69,106,37,15,18,28,35,32,101,
+34,27,91,76,3,48,149,48,40,43,38,38,46,2,108,252,115,2,190,0,0,3,254,155,
+253,63,3,58,3,255,0,35,0,36,0,37,0,0,3,55,4,0,17,20,6,35,34,38,39,38,38,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,53,16,0,3,19,37,83,
+1,96,1,172,203,188,103,152,98,76,71,40,43,49,73,148,85,134,116,84,137,88,
+93,100,53,103,113,254,135,100,160,3,113,142,206,253,108,254,148,232,251,88,
+122,93,53,59,53,95,111,53,140,126,115,133,88,103,109,53,179,171,1,48,2,69,
+253,77,3,101,0,4,250,108,252,234,0,0,255,206,0,44,0,56,0,67,0,68,0,0,1,6,
+6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,33,50,30,2,
+21,20,6,35,34,38,53,52,55,35,22,21,20,6,35,34,38,1,6,21,20,22,51,50,54,53,
+52,38,35,1,38,38,35,34,6,21,20,22,51,50,1,252,24,53,98,64,101,112,120,91,
+57,112,83,73,81,48,66,70,121,128,70,1,240,102,103,70,35,113,94,95,106,32,
+253,147,148,134,66,109,2,175,33,45,38,36,43,58,63,252,189,42,58,30,41,47,
+52,48,76,1,101,253,87,64,45,116,90,92,114,62,89,79,50,73,69,86,129,49,127,
+25,57,75,55,85,102,96,69,56,50,99,164,129,145,48,1,233,36,44,34,44,40,33,
+44,41,254,172,48,40,43,38,38,46,2,108,0,0,1,254,184,255,230,2,134,3,255,0,
+19,0,0,1,55,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,36,254,184,
+164,73,198,137,117,115,175,184,76,211,242,210,196,189,254,232,1,228,68,222,
+195,134,125,152,234,85,158,92,254,184,198,207,224,251,0,4,254,221,255,230,
+2,174,3,255,0,19,0,20,0,21,0,22,0,0,1,55,22,22,51,50,54,53,52,38,39,55,22,
+18,21,20,6,35,34,36,19,19,55,254,221,167,60,206,142,117,115,175,184,76,211,
+242,210,196,189,254,230,224,25,7,1,227,69,202,215,134,125,152,234,85,158,
+92,254,184,198,207,224,248,3,33,253,193,135,0,0,3,254,249,255,230,2,184,3,
+255,0,19,0,20,0,21,0,0,1,51,22,18,51,50,54,53,52,38,39,55,22,18,21,20,6,35,
+34,0,37,39,254,249,177,23,198,153,121,117,175,184,76,211,242,210,196,230,
+254,216,1,18,16,2,108,224,254,251,134,125,152,234,85,158,92,254,184,198,207,
+224,1,99,255,148,0,2,254,184,255,230,5,67,3,255,0,34,0,46,0,0,1,50,30,2,21,
+20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,36,3,55,22,22,51,50,54,53,52,
+38,39,55,5,6,21,20,22,51,50,54,53,52,38,35,3,145,117,141,114,62,157,132,131,
+150,44,254,94,122,121,210,196,189,254,232,99,164,73,198,137,117,115,180,179,
+74,3,20,52,75,63,62,70,92,99,3,255,25,74,119,88,123,146,147,109,89,76,92,
+236,136,207,224,251,1,3,68,222,195,134,125,155,238,82,154,154,69,80,62,75,
+72,60,78,76,0,0,2,254,221,255,230,5,107,3,255,0,34,0,46,0,0,1,50,30,2,21,
+20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,36,3,55,22,22,51,50,54,53,52,
+38,39,55,5,6,21,20,22,51,50,54,53,52,38,35,3,185,117,141,114,62,157,132,131,
+150,44,254,94,122,121,210,196,189,254,230,100,167,60,206,142,117,115,180,
+179,74,3,20,52,75,63,62,70,92,99,3,255,25,74,119,88,123,146,147,109,89,76,
+92,236,136,207,224,248,1,5,69,202,215,134,125,155,238,82,154,154,69,80,62,
+75,72,60,78,76,0,0,4,254,249,255,230,5,117,3,255,0,34,0,46,0,47,0,48,0,0,
+1,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,0,3,51,22,18,51,
+50,54,53,52,38,39,55,5,6,21,20,22,51,50,54,53,52,38,35,1,39,3,195,117,141,
+114,62,157,132,131,150,44,254,94,122,121,210,196,230,254,216,27,177,23,198,
+153,121,117,180,179,74,3,20,52,75,63,62,70,92,99,252,6,16,3,255,25,74,119,
+88,123,146,147,109,89,76,92,236,136,207,224,1,99,1,35,224,254,251,134,125,
+155,238,82,154,154,69,80,62,75,72,60,78,76,254,227,148,255,255,0,30,252,201,
+4,55,3,122,0,3,1,214,0,108,255,123,255,255,0,30,252,67,4,18,255,206,0,3,1,
+215,4,93,0,0,255,255,0,30,252,101,2,253,255,73,0,3,1,216,3,72,255,123,255,
+255,0,30,252,67,5,203,255,206,0,3,1,217,5,203,0,0,255,255,0,30,252,101,3,
+248,255,73,0,3,1,218,4,67,255,123,255,255,0,30,252,201,4,237,3,122,0,3,1,
+219,1,179,255,123,255,255,0,30,252,66,4,237,3,131,0,3,1,220,1,179,255,132,
+255,255,0,30,252,101,3,248,255,73,0,3,1,221,4,67,255,123,255,255,0,30,252,
+67,5,219,255,206,0,3,1,222,5,219,0,0,255,255,0,30,252,67,5,41,255,150,0,3,
+1,223,5,41,255,200,255,255,0,30,252,101,4,27,255,73,0,3,1,224,4,102,255,123,
+255,255,0,30,252,101,3,18,255,73,0,3,1,225,3,93,255,123,255,255,0,30,252,
+101,3,252,255,73,0,3,1,226,4,71,255,123,255,255,0,30,252,65,3,252,255,206,
+0,3,1,227,4,71,0,0,255,255,0,30,252,101,4,115,255,73,0,3,1,228,4,190,255,
+123,0,2,253,117,252,65,2,68,254,79,0,15,0,27,0,0,1,53,33,38,53,52,54,51,50,
+22,21,20,14,2,35,55,51,50,54,53,52,38,35,34,6,21,20,253,117,2,220,41,143,
+129,120,148,60,110,140,124,82,11,101,98,66,59,62,69,252,65,154,66,77,97,132,
+134,112,80,106,69,25,154,62,66,48,61,64,53,63,0,255,255,0,30,252,67,3,192,
+255,206,0,3,1,230,4,11,0,0,255,255,0,30,252,101,3,192,255,73,0,3,1,231,4,
+11,255,123,255,255,0,30,252,67,3,192,255,206,0,3,1,232,4,11,0,0,255,255,0,
+30,252,200,5,20,3,122,0,3,1,233,1,138,255,123,255,255,0,30,252,201,4,201,
+3,122,0,3,1,234,1,143,255,123,255,255,0,30,252,68,4,201,3,133,0,3,1,235,1,
+143,255,134,255,255,0,30,252,101,4,198,3,122,0,3,1,236,1,130,255,123,255,
+255,0,30,252,67,4,198,3,240,0,3,1,237,1,130,255,241,255,255,0,39,252,101,
+4,44,3,122,0,3,1,238,1,41,255,123,255,255,0,30,252,101,4,21,3,122,0,3,1,239,
+0,107,255,123,255,255,0,30,252,101,4,113,255,73,0,3,1,241,4,188,255,123,255,
+255,0,30,252,101,4,47,255,73,0,3,1,242,4,122,255,123,255,255,0,30,252,101,
+4,31,3,122,0,3,1,243,1,6,255,123,255,255,0,30,252,201,4,193,3,122,0,3,1,244,
+1,23,255,123,255,255,0,30,252,101,3,201,3,122,0,3,1,245,1,135,255,123,255,
+255,0,30,252,65,4,94,255,206,0,3,1,246,4,79,0,0,255,255,0,30,252,186,4,189,
+3,122,0,3,1,247,1,131,255,123,255,255,0,30,252,101,5,178,255,73,0,3,1,248,
+5,178,255,123,255,255,0,30,252,101,4,89,3,122,0,3,0,62,1,41,255,123,255,255,
+0,30,252,101,6,75,3,122,0,3,0,63,1,41,255,123,255,255,0,30,252,67,4,214,255,
+131,0,3,0,77,4,188,0,0,255,255,0,30,252,67,7,83,255,131,0,3,0,78,4,188,0,
+0,0,6,251,215,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,22,51,
+50,54,55,23,6,4,35,34,36,39,37,1,19,37,5,252,118,51,182,141,141,181,52,148,
+74,254,248,184,185,254,251,76,4,30,253,241,19,253,211,2,39,89,164,165,163,
+166,63,215,212,213,213,103,253,28,2,153,125,243,0,6,249,245,252,234,0,0,0,
+0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,35,34,36,39,
+37,1,19,37,5,250,133,112,1,61,204,211,1,54,113,126,142,254,147,252,245,254,
+132,135,5,249,253,241,19,251,241,4,9,89,168,169,165,172,110,199,189,194,194,
+149,253,28,2,153,125,243,0,6,251,87,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,
+17,0,18,0,0,5,22,22,51,50,54,55,23,6,4,35,34,36,39,37,1,19,37,5,251,250,65,
+214,159,163,210,66,143,91,254,226,205,207,254,226,89,4,150,253,241,19,253,
+83,2,167,89,165,164,161,168,72,215,203,207,210,112,253,28,2,153,125,243,0,
+6,247,138,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,33,32,
+36,55,23,6,4,33,32,36,39,37,1,19,37,5,248,30,154,1,204,1,70,1,67,1,203,157,
+124,182,253,253,254,147,254,154,253,245,183,8,93,253,241,19,249,134,6,116,
+89,195,194,190,199,114,222,214,213,223,153,253,28,2,153,125,243,0,6,250,39,
+252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,
+4,35,34,36,39,37,1,19,37,5,250,182,109,1,49,195,202,1,41,111,126,142,254,
+159,240,238,254,144,130,5,200,253,241,19,252,35,3,215,89,166,166,162,170,
+109,200,184,192,192,148,253,28,2,153,125,243,0,6,249,236,252,234,0,0,0,0,
+0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,35,34,36,39,37,
+1,19,37,5,250,124,113,1,63,206,212,1,56,114,126,146,254,146,251,247,254,129,
+135,6,2,253,241,19,251,232,4,18,89,168,169,165,172,110,202,186,194,194,149,
+253,28,2,153,125,243,255,255,249,236,252,234,0,0,0,0,2,2,2,42,0,0,255,255,
+250,39,252,234,0,0,0,0,2,2,2,41,0,0,0,6,245,183,252,234,0,0,0,0,0,13,0,14,
+0,15,0,16,0,17,0,18,0,0,5,22,4,33,32,36,55,23,6,4,33,32,36,39,37,1,19,37,
+5,246,79,187,2,53,1,163,1,151,2,58,191,123,223,253,142,254,70,254,69,253,
+141,223,10,43,253,241,19,247,179,8,71,89,217,211,207,221,118,244,227,227,
+244,157,253,28,2,153,125,243,0,6,248,44,252,234,0,0,0,0,0,13,0,14,0,15,0,
+16,0,17,0,18,0,0,5,22,4,33,32,36,55,23,6,4,33,32,36,39,37,1,19,37,5,248,191,
+145,1,165,1,38,1,37,1,163,147,124,174,254,35,254,180,254,186,254,26,172,7,
+189,253,241,19,250,40,5,210,89,188,187,182,193,113,219,204,205,218,152,253,
+28,2,153,125,243,0,6,249,214,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,
+0,0,5,22,4,51,50,36,55,23,6,4,33,34,36,39,37,1,19,37,5,250,102,115,1,65,213,
+215,1,62,116,126,146,254,140,255,0,252,254,124,136,6,24,253,241,19,251,210,
+4,40,89,170,169,165,174,110,202,188,195,195,149,253,28,2,153,125,243,0,0,
+6,251,65,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,22,51,50,
+54,55,23,6,4,35,34,36,39,37,1,19,37,5,251,226,67,220,164,165,217,69,142,92,
+254,220,209,210,254,220,91,4,172,253,241,19,253,61,2,189,89,163,166,161,168,
+75,211,204,208,206,115,253,28,2,153,125,243,0,6,250,20,252,234,0,0,0,0,0,
+13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,35,34,36,39,37,
+1,19,37,5,250,163,110,1,54,199,205,1,46,112,125,142,254,154,243,241,254,139,
+131,5,218,253,241,19,252,16,3,234,89,167,167,163,171,109,200,186,193,193,
+148,253,28,2,153,125,243,255,255,250,20,252,234,0,0,0,0,2,2,2,49,0,0,0,6,
+249,100,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,
+55,23,6,4,33,32,36,39,37,1,19,37,5,249,245,122,1,97,230,239,1,88,123,125,
+154,254,111,254,237,254,241,254,96,144,6,136,253,241,19,251,96,4,154,89,174,
+175,171,178,111,208,191,200,199,150,253,28,2,153,125,243,0,6,249,198,252,
+234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,33,
+34,36,39,37,1,19,37,5,250,86,116,1,72,213,220,1,64,117,126,148,254,136,254,
+254,255,254,121,137,6,39,253,241,19,251,194,4,56,89,170,171,167,174,110,204,
+188,196,196,149,253,28,2,153,125,243,0,0,6,250,90,252,234,0,0,0,0,0,13,0,
+14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,35,34,36,39,37,1,19,
+37,5,250,234,103,1,32,192,193,1,29,105,127,135,254,173,235,230,254,157,126,
+5,149,253,241,19,252,86,3,164,89,163,166,161,168,107,197,186,191,191,147,
+253,28,2,153,125,243,255,255,250,90,252,234,0,0,0,0,2,2,2,53,0,0,255,255,
+250,90,252,234,0,0,0,0,2,2,2,53,0,0,0,6,250,99,252,234,0,0,0,0,0,13,0,14,
+0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,35,34,36,39,37,1,19,37,
+5,250,244,103,1,32,186,193,1,26,104,127,136,254,174,231,229,254,159,124,5,
+140,253,241,19,252,95,3,155,89,164,165,162,167,106,200,184,192,192,145,253,
+28,2,153,125,243,0,6,250,79,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,
+0,0,5,22,4,51,50,36,55,23,6,4,35,34,36,39,37,1,19,37,5,250,222,106,1,39,188,
+194,1,32,108,126,138,254,170,235,230,254,154,128,5,160,253,11,19,253,49,2,
+201,89,164,165,160,169,109,198,183,191,190,148,253,28,2,153,125,243,255,255,
+250,79,252,234,0,0,0,0,2,2,2,57,0,0,0,6,250,0,252,234,0,0,0,0,0,13,0,14,0,
+15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,35,34,36,39,37,1,19,37,5,
+250,144,112,1,58,202,209,1,52,112,125,142,254,149,248,244,254,135,134,5,238,
+253,11,19,252,226,3,24,89,168,168,165,171,110,201,186,194,193,149,253,28,
+2,153,125,243,255,255,250,0,252,234,0,0,0,0,2,2,2,59,0,0,255,255,247,138,
+252,234,0,0,0,0,2,2,2,40,0,0,255,255,245,183,252,234,0,0,0,0,2,2,2,45,0,0,
+255,255,251,65,252,234,0,0,0,0,2,2,2,48,0,0,0,6,249,113,252,234,0,0,0,0,0,
+13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,33,32,36,39,37,
+1,19,37,5,250,2,124,1,89,230,235,1,84,124,125,153,254,114,254,239,254,244,
+254,99,144,6,124,253,11,19,252,83,3,167,89,177,171,170,178,111,207,191,199,
+199,150,253,28,2,153,125,243,0,6,250,84,252,234,0,0,0,0,0,13,0,14,0,15,0,
+16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,6,4,35,34,36,39,37,1,19,37,5,250,227,
+105,1,38,188,192,1,32,107,126,139,254,172,233,228,254,151,125,5,155,253,11,
+19,253,54,2,196,89,164,165,160,169,108,200,182,192,190,147,253,28,2,153,125,
+243,0,6,250,215,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,22,
+51,50,54,55,23,6,4,35,34,36,39,37,1,19,37,5,251,112,84,253,175,177,248,87,
+135,114,254,198,219,217,254,188,106,5,23,253,11,19,253,185,2,65,89,165,164,
+159,170,90,206,194,200,199,130,253,28,2,153,125,243,255,255,250,79,252,234,
+0,0,0,0,2,2,2,57,0,0,0,6,251,154,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,
+0,18,0,0,5,22,22,51,50,54,55,23,6,4,35,34,36,39,37,1,19,37,5,252,66,55,194,
+151,154,190,56,148,77,254,241,200,200,254,245,81,4,82,253,11,19,254,124,1,
+126,89,165,164,163,166,63,214,213,210,216,103,253,28,2,153,125,243,0,6,250,
+79,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,18,0,0,5,22,4,51,50,36,55,23,
+6,4,35,34,36,39,1,1,19,37,1,250,222,106,1,39,188,194,1,32,108,126,138,254,
+170,235,230,254,154,128,5,160,253,11,19,253,49,2,201,248,164,165,160,169,
+109,198,183,191,190,1,51,253,28,2,153,125,254,110,255,255,250,99,252,234,
+0,0,0,0,2,2,2,56,0,0,0,6,247,188,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,
+0,18,0,0,5,22,4,33,32,36,55,23,6,4,33,32,36,39,37,1,19,37,5,248,80,153,1,
+191,1,59,1,59,1,189,154,124,181,254,9,254,159,254,163,254,0,179,8,44,253,
+11,19,250,158,5,92,89,193,191,186,198,114,222,209,211,220,153,253,28,2,153,
+125,243,0,5,248,4,252,234,0,0,0,0,0,13,0,14,0,15,0,16,0,17,0,0,1,22,4,33,
+32,36,55,23,6,4,33,32,36,39,1,5,37,1,248,142,148,1,176,1,44,1,44,1,172,151,
+125,179,254,26,254,174,254,176,254,17,174,7,238,253,30,250,230,5,20,254,237,
+178,176,171,183,114,207,194,198,203,1,83,75,125,254,83,0,4,251,197,252,234,
+255,226,255,206,0,15,0,27,0,28,0,29,0,0,1,53,33,38,53,52,54,51,50,22,21,20,
+14,2,35,55,51,50,54,53,52,38,35,34,6,21,20,3,3,251,197,2,43,42,143,129,120,
+148,60,110,140,124,83,10,101,98,66,59,62,69,128,201,253,117,154,67,76,97,
+132,134,112,80,106,69,25,154,62,66,48,61,64,53,64,1,135,253,28,0,0,4,249,
+211,252,234,255,226,255,206,0,15,0,27,0,28,0,29,0,0,1,53,33,38,53,52,54,51,
+50,22,21,20,14,2,35,55,51,50,54,53,52,38,35,34,6,21,20,1,19,249,211,4,29,
+42,143,129,120,148,60,110,140,124,83,10,101,98,66,59,62,69,254,135,48,253,
+117,154,67,76,97,132,134,112,80,106,69,25,154,62,66,48,61,64,53,64,1,135,
+253,28,0,3,251,19,252,234,255,226,255,206,0,15,0,27,0,28,0,0,1,53,33,38,53,
+52,54,51,50,22,21,20,14,2,35,55,51,50,54,53,52,38,35,34,6,21,20,3,251,19,
+2,221,42,143,129,120,148,60,110,140,124,83,10,101,98,66,59,62,69,217,252,
+234,154,67,76,97,132,134,112,80,106,69,25,154,62,66,48,61,64,53,64,2,18,0,
+0,5,251,82,252,65,0,119,0,0,0,32,0,44,0,56,0,57,0,58,0,0,1,34,38,38,53,52,
+54,51,50,23,53,33,38,53,52,54,51,50,22,21,20,14,2,35,33,22,22,21,20,7,33,
+21,3,51,50,54,53,52,38,35,34,6,21,20,1,54,53,52,38,35,34,6,21,20,22,51,1,
+37,253,4,161,167,106,151,123,28,22,1,237,40,143,129,120,148,59,112,142,121,
+254,126,22,21,40,2,89,139,14,102,97,66,59,62,69,253,204,43,69,62,58,67,97,
+102,1,62,1,83,252,65,48,121,98,105,129,3,66,63,69,91,124,128,106,75,103,66,
+23,27,62,35,72,60,154,2,52,56,58,44,54,58,49,55,254,52,50,55,49,58,54,43,
+59,56,2,243,50,0,0,5,250,127,252,65,0,119,0,0,0,32,0,44,0,56,0,57,0,58,0,
+0,1,34,38,38,53,52,54,51,50,23,53,33,38,53,52,54,51,50,22,21,20,14,2,35,33,
+22,22,21,20,7,33,21,3,51,50,54,53,52,38,35,34,6,21,20,1,54,53,52,38,35,34,
+6,21,20,22,51,1,37,252,49,161,167,106,151,123,28,22,2,192,40,143,129,120,
+148,59,112,142,121,253,171,22,21,40,3,44,139,14,102,97,66,59,62,69,252,249,
+43,69,62,58,67,97,102,1,167,1,189,252,65,48,121,98,105,129,3,66,63,69,91,
+124,128,106,75,103,66,23,27,62,35,72,60,154,2,52,56,58,44,54,58,49,55,254,
+52,50,55,49,58,54,43,59,56,2,243,50,0,0,7,248,199,252,65,255,75,0,0,0,15,
+0,27,0,42,0,54,0,55,0,56,0,57,0,0,1,53,33,38,53,52,54,51,50,22,21,20,14,2,
+35,55,51,50,54,53,52,38,35,34,6,21,20,1,34,38,38,53,52,54,51,50,22,21,20,
+7,33,21,37,54,53,52,38,35,34,6,21,20,22,51,1,33,37,250,201,2,142,40,143,129,
+120,148,59,112,142,121,79,14,102,97,66,59,62,69,252,188,161,167,106,151,123,
+124,142,40,3,114,251,253,43,69,62,58,67,97,102,3,170,254,67,3,47,253,219,
+154,63,69,91,124,128,106,75,103,66,23,154,56,58,44,54,58,49,55,253,154,48,
+121,98,105,129,124,91,72,60,154,154,50,55,49,58,54,43,59,56,2,243,50,0,7,
+250,143,252,65,0,86,0,0,0,71,0,83,0,95,0,107,0,108,0,109,0,110,0,0,1,34,38,
+38,53,52,54,51,50,22,23,54,54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,38,
+53,52,54,51,50,22,22,21,20,6,7,22,22,51,50,53,52,38,39,55,22,22,21,20,6,35,
+34,38,39,6,6,35,34,39,35,6,6,7,51,55,51,23,33,21,1,39,38,6,21,20,22,51,50,
+54,53,52,19,38,38,35,34,6,21,20,22,51,50,54,5,54,53,52,38,35,34,6,21,20,22,
+51,1,5,55,252,65,161,167,106,151,123,32,52,20,25,84,58,56,109,70,21,53,4,
+104,88,86,113,130,106,108,153,77,23,24,39,81,43,167,120,129,70,151,173,160,
+137,66,115,78,50,119,69,8,8,15,3,19,16,241,7,129,7,2,83,252,161,15,52,63,
+40,37,36,41,63,49,62,38,35,39,46,43,39,67,254,192,43,69,62,58,67,97,102,1,
+145,1,41,154,252,65,48,121,98,105,129,7,8,31,31,31,38,45,61,117,58,14,24,
+70,81,95,78,76,99,88,154,83,46,86,40,18,18,144,86,127,49,127,58,207,126,127,
+147,32,46,39,39,1,27,51,23,129,129,154,3,44,1,3,37,36,31,35,36,36,35,254,
+124,29,18,19,18,17,23,15,227,50,55,49,58,54,43,59,56,2,243,122,172,0,4,251,
+83,252,65,0,86,0,0,0,37,0,49,0,50,0,51,0,0,1,34,46,2,53,52,54,51,50,23,38,
+53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,23,7,6,7,33,21,37,
+54,53,52,38,35,34,6,21,20,22,51,1,37,253,5,112,146,117,59,149,125,70,51,8,
+201,171,164,199,49,65,136,105,114,112,101,118,106,98,4,30,3,9,252,102,37,
+69,58,60,69,96,103,1,58,1,86,252,65,22,69,106,77,109,131,20,42,45,145,192,
+183,149,85,155,93,59,133,125,105,111,115,100,132,127,42,64,52,154,154,51,
+57,54,63,56,47,62,60,2,243,50,0,6,249,35,252,65,0,86,0,0,0,65,0,76,0,88,0,
+89,0,90,0,91,0,0,1,6,6,35,34,38,39,6,6,7,20,6,7,51,55,51,23,33,21,33,34,38,
+38,53,52,54,51,51,50,23,54,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,
+22,21,21,22,51,50,54,53,52,38,39,55,22,22,21,20,6,35,34,37,38,38,35,34,6,
+21,20,22,51,50,5,54,53,52,38,35,34,6,21,20,22,51,1,5,55,253,223,35,122,87,
+66,109,61,53,91,48,20,20,164,9,129,9,4,8,250,127,161,167,106,151,123,16,7,
+7,4,119,88,57,112,83,73,81,48,67,69,119,130,70,152,172,103,114,72,73,119,
+130,70,153,171,147,137,148,253,96,42,58,30,41,47,52,48,76,255,0,43,69,62,
+58,67,97,102,2,69,1,160,219,253,205,56,57,48,61,62,44,2,34,65,31,166,166,
+154,48,121,98,105,129,1,88,107,62,89,79,50,68,64,79,119,46,127,56,198,119,
+11,119,68,64,79,119,46,127,56,199,118,126,136,197,48,40,43,38,38,46,249,50,
+55,49,58,54,43,59,56,2,243,123,173,0,5,250,179,252,65,0,86,0,0,0,89,0,101,
+0,102,0,103,0,104,0,0,1,34,38,38,53,52,54,51,50,23,54,54,55,54,54,53,52,38,
+35,34,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,35,34,7,39,
+54,51,50,22,21,20,6,35,34,39,6,7,6,6,21,20,51,50,54,55,51,22,22,51,50,54,
+53,52,39,55,22,21,20,6,35,34,39,6,6,35,34,39,6,6,7,33,21,37,54,53,52,38,35,
+34,6,21,20,22,51,1,3,1,252,101,161,167,106,151,123,36,38,14,107,92,61,47,
+48,48,110,13,129,24,133,118,96,121,14,40,117,60,57,55,91,46,48,15,53,72,99,
+109,124,113,135,108,34,134,77,59,101,80,85,11,140,8,77,62,60,59,29,129,43,
+135,116,147,81,47,120,82,22,21,3,19,16,3,175,251,192,43,69,62,58,67,97,102,
+1,139,120,2,29,252,65,48,121,98,105,129,7,49,80,31,20,37,30,27,34,66,29,20,
+30,39,60,71,91,71,67,36,41,22,27,47,8,116,11,85,80,80,89,74,61,46,26,41,29,
+70,66,71,66,71,45,39,47,41,42,71,75,94,106,118,59,59,2,27,51,23,154,154,50,
+55,49,58,54,43,59,56,2,243,254,139,1,167,0,0,6,250,251,252,65,0,86,0,0,0,
+54,0,64,0,76,0,77,0,78,0,79,0,0,1,34,38,38,53,52,54,55,38,38,53,52,54,51,
+50,22,21,20,6,35,34,39,21,20,22,51,50,55,51,22,22,51,50,53,52,38,39,55,22,
+22,21,20,6,35,34,38,39,6,6,7,20,6,7,33,21,1,22,51,50,53,52,38,35,34,6,3,54,
+53,52,38,35,34,6,21,20,22,51,1,23,37,252,173,161,167,106,132,116,7,7,180,
+130,93,106,120,111,70,72,80,79,144,15,139,6,76,62,139,119,130,70,154,170,
+142,124,78,108,45,39,109,70,20,20,3,103,252,42,52,58,116,44,39,47,76,54,43,
+69,62,58,67,97,102,1,98,126,1,8,252,65,48,121,98,97,128,9,21,43,23,149,181,
+93,76,86,98,34,9,85,90,122,59,63,132,79,119,46,127,58,197,118,122,140,53,
+62,56,57,2,33,65,31,154,2,193,27,62,28,32,48,253,170,50,55,49,58,54,43,59,
+56,2,243,123,173,0,0,5,250,233,252,65,0,86,0,0,0,51,0,63,0,75,0,76,0,77,0,
+0,1,34,38,38,53,52,54,55,38,53,52,36,51,50,22,23,7,38,38,35,34,6,21,20,22,
+51,50,55,51,22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,7,20,6,7,33,
+21,1,51,50,54,53,52,38,35,34,6,21,20,1,54,53,52,38,35,34,6,21,20,22,51,1,
+37,252,155,161,167,106,145,125,2,1,10,226,113,189,96,73,80,148,95,164,185,
+62,56,114,18,140,10,72,22,102,87,93,113,129,117,103,136,40,70,123,20,20,3,
+121,254,133,18,51,54,43,33,37,41,253,144,43,69,62,58,67,97,102,1,106,1,144,
+252,65,48,121,98,102,130,2,23,22,170,202,44,52,123,48,39,123,108,70,70,137,
+111,23,40,49,75,87,103,79,98,106,56,60,107,8,34,65,31,154,1,149,39,38,34,
+31,36,32,42,254,229,50,55,49,58,54,43,59,56,2,243,50,0,0,5,250,141,252,65,
+0,86,0,0,0,71,0,81,0,93,0,94,0,95,0,0,1,34,38,38,53,52,54,51,51,54,54,55,
+38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,23,
+38,38,35,34,6,7,35,38,38,35,34,21,20,22,51,51,21,35,34,21,20,22,51,50,54,
+55,23,6,6,7,20,6,7,33,21,3,38,35,34,6,21,20,22,51,50,5,54,53,52,38,35,34,
+6,21,20,22,51,1,37,252,63,161,167,106,151,123,26,13,59,46,116,146,125,91,
+132,60,48,111,72,143,170,152,142,99,117,115,98,89,69,3,95,83,59,81,12,139,
+20,110,81,131,58,53,126,105,140,50,47,49,79,53,97,68,130,76,20,20,3,213,239,
+54,74,42,48,41,47,97,252,170,43,69,62,58,67,97,102,1,154,1,188,252,65,48,
+121,98,105,129,36,50,14,42,106,78,91,52,67,64,55,182,145,147,161,99,80,80,
+102,47,90,99,61,53,57,62,66,32,33,117,73,31,34,38,54,86,69,58,1,33,65,31,
+154,1,217,55,35,30,25,36,248,50,55,49,58,54,43,59,56,2,243,50,0,0,6,250,251,
+252,65,0,86,0,0,0,34,0,53,0,65,0,77,0,78,0,79,0,0,1,34,38,38,53,52,54,51,
+51,38,53,52,36,51,50,22,21,20,6,35,34,38,39,6,6,7,20,6,7,51,55,51,23,33,21,
+1,22,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,55,50,22,21,20,6,35,
+34,38,53,52,54,1,54,53,52,38,35,34,6,21,20,22,51,1,37,252,173,161,167,106,
+151,123,17,4,1,2,207,212,253,124,115,92,100,34,46,96,70,20,20,180,9,129,8,
+2,33,253,219,15,58,55,56,66,170,150,154,166,65,57,50,61,17,70,43,47,47,43,
+42,47,46,254,158,43,69,62,58,67,97,102,1,105,1,127,252,65,48,121,98,105,129,
+34,17,165,201,204,164,123,144,58,58,64,50,2,33,65,31,158,158,154,1,251,48,
+44,72,62,109,128,123,108,67,73,44,48,203,41,38,37,41,41,37,37,42,253,212,
+50,55,49,58,54,43,59,56,2,243,50,0,0,5,250,251,252,65,0,86,0,0,0,30,0,48,
+0,60,0,61,0,62,0,0,1,34,38,38,53,52,54,51,51,38,53,52,36,51,50,22,21,20,6,
+35,34,38,39,6,6,7,20,6,7,33,21,1,22,22,51,50,54,53,52,38,35,34,6,21,20,22,
+51,50,55,1,54,53,52,38,35,34,6,21,20,22,51,1,37,252,173,161,167,106,151,123,
+17,4,1,2,207,212,253,124,115,92,100,34,46,96,70,20,20,3,103,253,219,11,57,
+60,56,66,170,150,154,166,65,57,107,21,254,185,43,69,62,58,67,97,102,1,105,
+1,127,252,65,48,121,98,105,129,34,17,165,201,204,164,123,144,58,58,64,50,
+2,33,65,31,154,2,35,63,69,72,62,110,127,123,108,67,73,132,254,119,50,55,49,
+58,54,43,59,56,2,243,50,0,0,5,250,251,252,65,0,86,0,0,0,34,0,52,0,64,0,65,
+0,66,0,0,1,34,38,38,53,52,54,51,51,38,53,52,36,51,50,22,21,20,6,35,34,38,
+39,6,6,7,20,6,7,51,55,51,23,33,21,1,22,22,51,50,54,53,52,38,35,34,6,21,20,
+22,51,50,55,1,54,53,52,38,35,34,6,21,20,22,51,1,37,252,173,161,167,106,151,
+123,17,4,1,2,207,212,253,124,115,92,100,34,46,96,70,20,20,180,9,129,8,2,33,
+253,219,11,57,60,56,66,170,150,154,166,65,57,107,21,254,185,43,69,62,58,67,
+97,102,1,105,1,127,252,65,48,121,98,105,129,34,17,165,201,204,164,123,144,
+58,58,64,50,2,33,65,31,158,158,154,2,35,63,69,72,62,110,127,123,108,67,73,
+132,254,119,50,55,49,58,54,43,59,56,2,243,50,0,0,3,251,29,252,65,0,90,255,
+206,0,51,0,63,0,64,0,0,1,54,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,
+7,35,38,38,35,34,6,21,20,22,23,7,22,21,20,7,33,21,33,34,38,38,53,52,54,51,
+51,38,53,52,54,51,50,22,1,54,53,52,38,35,34,6,21,20,22,51,1,254,3,44,107,
+75,113,140,94,107,107,86,76,64,55,121,24,139,9,80,62,52,62,75,88,33,3,40,
+3,73,252,117,161,167,106,151,123,1,13,140,113,75,108,254,169,43,69,62,58,
+67,97,102,1,85,254,238,82,67,146,108,89,157,81,100,56,104,58,53,65,173,85,
+88,68,52,56,100,59,31,18,19,72,60,154,48,121,98,105,129,42,40,107,144,70,
+253,158,50,55,49,58,54,43,59,56,2,243,0,0,6,250,152,252,65,0,86,0,0,0,58,
+0,69,0,81,0,82,0,83,0,84,0,0,1,34,38,38,53,52,54,51,51,50,23,54,54,51,50,
+22,23,22,22,51,50,54,53,52,38,39,55,22,22,21,20,6,7,7,20,22,51,50,55,23,6,
+6,35,34,38,39,6,35,34,38,39,6,6,7,20,6,7,33,21,1,38,38,35,34,6,21,20,22,51,
+50,5,54,53,52,38,35,34,6,21,20,22,51,1,23,37,252,74,161,167,106,151,123,18,
+8,8,4,119,88,57,112,83,73,81,48,67,69,119,130,70,152,172,25,25,1,39,29,46,
+39,80,48,80,48,75,102,16,42,53,66,109,61,50,90,56,20,20,3,202,252,211,42,
+58,30,41,47,52,48,76,254,252,43,69,62,58,67,97,102,1,144,88,1,99,252,65,48,
+121,98,105,129,1,88,107,62,89,79,50,68,64,79,119,46,127,56,198,119,51,83,
+33,7,41,31,32,101,34,27,65,60,11,48,61,60,45,3,34,65,31,154,1,224,48,40,43,
+38,38,46,249,50,55,49,58,54,43,59,56,2,243,123,173,0,0,6,249,131,252,65,0,
+86,0,0,0,56,0,68,0,79,0,91,0,92,0,93,0,0,1,34,38,38,53,52,54,51,50,23,54,
+54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,33,50,30,2,21,20,6,35,34,38,
+53,52,55,35,22,21,20,6,35,34,38,39,6,6,7,20,6,7,33,21,1,6,21,20,22,51,50,
+54,53,52,38,35,1,38,38,35,34,6,21,20,22,51,50,5,54,53,52,38,35,34,6,21,20,
+22,51,1,37,251,53,161,167,106,151,123,29,10,4,119,88,57,112,83,73,81,48,67,
+69,119,130,70,1,240,102,103,70,35,113,94,95,106,32,250,144,148,134,66,109,
+61,51,94,56,20,20,4,223,254,254,33,45,38,36,43,58,63,252,189,42,58,30,41,
+47,52,48,76,254,247,43,69,62,58,67,97,102,2,32,2,64,252,65,48,121,98,105,
+129,2,89,107,62,89,79,50,68,64,79,119,46,127,25,57,75,55,85,102,96,69,56,
+50,93,154,122,138,48,61,61,45,2,34,65,31,154,3,22,36,44,34,44,40,33,44,41,
+254,202,48,40,43,38,38,46,249,50,55,49,58,54,43,59,56,2,243,50,0,5,250,97,
+252,65,0,7,0,0,0,15,0,27,0,41,0,42,0,43,0,0,1,53,33,38,53,52,54,51,50,22,
+21,20,14,2,35,55,51,50,54,53,52,38,35,34,6,21,20,5,22,4,51,50,36,55,23,6,
+4,35,34,36,39,1,37,251,82,2,64,35,144,129,121,146,60,116,144,114,74,19,103,
+96,67,58,62,69,252,214,117,1,38,198,196,1,42,116,113,147,254,157,224,208,
+254,132,132,2,211,2,4,253,164,154,62,69,97,132,132,108,77,106,69,22,154,60,
+62,46,57,64,53,56,133,134,138,137,135,96,163,169,174,158,2,65,50,0,0,5,251,
+213,252,65,0,114,0,31,0,43,0,104,0,114,0,115,0,116,0,0,39,22,21,20,7,22,51,
+50,55,23,6,35,34,39,6,35,34,39,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,
+54,55,51,22,22,51,50,54,53,52,39,19,38,38,35,34,6,7,35,38,38,35,34,21,20,
+22,51,51,21,35,34,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,52,
+54,51,50,22,23,54,54,51,50,22,22,21,20,6,35,34,38,53,52,54,51,50,23,38,35,
+34,6,21,20,22,51,50,1,55,49,12,29,21,42,40,36,41,63,73,88,41,62,86,152,82,
+47,111,75,121,141,10,144,8,66,60,62,81,11,139,11,82,66,56,66,8,93,3,95,83,
+59,81,12,139,20,110,81,131,58,53,126,105,140,50,47,49,79,53,97,67,137,92,
+106,121,127,116,146,125,91,132,60,48,111,72,97,142,74,152,142,99,117,115,
+98,89,50,54,74,42,48,41,47,97,254,128,233,31,44,59,69,55,29,16,122,29,75,
+37,142,77,65,136,114,62,37,17,17,48,57,65,75,69,70,74,66,57,45,20,253,112,
+90,99,61,53,57,62,66,32,33,117,73,31,34,38,54,86,70,58,87,80,111,40,42,106,
+78,91,52,67,64,55,89,156,82,147,161,99,80,80,102,171,55,35,30,25,36,3,22,
+50,0,0,3,251,219,252,101,255,181,255,206,0,75,0,76,0,77,0,0,3,22,21,20,6,
+35,34,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,21,20,23,7,38,53,52,
+54,51,50,22,23,22,22,51,50,54,53,52,35,34,7,39,54,51,50,22,21,20,6,35,34,
+39,6,7,6,6,21,20,51,50,54,55,51,22,22,51,50,54,53,52,39,1,3,118,43,135,116,
+147,81,47,120,82,115,125,106,114,61,47,48,48,110,13,129,24,133,118,96,121,
+14,40,117,60,57,55,91,46,48,15,53,72,99,109,124,113,135,108,34,134,77,59,
+101,80,85,11,140,8,77,62,60,59,29,254,191,173,253,191,71,75,94,106,118,59,
+59,106,86,71,100,38,20,37,30,27,34,66,29,20,30,39,60,71,91,71,67,36,41,22,
+27,47,8,116,11,85,80,80,89,74,61,46,26,41,29,70,66,71,66,71,45,39,47,41,2,
+57,253,178,0,0,4,251,184,252,101,255,181,255,206,0,41,0,52,0,53,0,54,0,0,
+1,21,20,22,51,50,55,51,22,22,51,50,53,52,38,39,55,22,22,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,39,22,51,50,54,53,52,38,35,
+34,6,1,19,252,64,80,79,143,16,139,7,77,60,139,121,128,70,153,171,142,124,
+78,108,45,41,111,81,133,158,180,130,93,106,120,111,70,55,51,61,58,58,44,39,
+49,77,1,83,86,253,176,10,92,97,137,68,69,143,85,129,49,127,60,207,124,128,
+146,53,62,58,57,178,141,156,190,97,79,90,102,141,28,37,33,32,35,57,1,127,
+254,172,0,0,3,251,215,252,101,255,181,255,206,0,40,0,52,0,53,0,0,1,6,6,35,
+34,38,53,52,36,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,55,51,22,23,38,
+53,52,54,51,50,22,21,20,6,35,34,38,55,51,50,54,53,52,38,35,34,6,21,20,3,253,
+168,38,106,82,108,131,1,11,225,113,189,96,73,80,148,95,164,185,62,56,114,
+18,140,10,72,22,102,87,93,113,129,117,103,136,237,18,51,54,43,33,37,41,216,
+252,217,58,58,147,128,179,211,44,52,123,48,39,133,117,76,75,137,111,23,40,
+49,75,87,103,79,98,106,56,66,39,38,34,31,36,32,42,2,207,0,0,3,252,19,252,
+101,255,181,255,206,0,17,0,35,0,36,0,0,1,6,6,35,34,38,53,52,36,51,50,22,21,
+20,6,35,34,38,55,22,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,55,19,253,
+228,45,100,82,111,127,1,1,208,212,253,124,115,92,100,36,11,57,60,56,66,171,
+149,155,165,65,57,107,21,70,252,217,62,54,156,126,173,210,213,172,129,151,
+58,211,66,71,78,67,118,138,134,116,73,78,137,2,92,0,0,3,251,164,252,101,255,
+181,255,206,0,37,0,38,0,39,0,0,1,54,54,51,50,22,21,20,6,7,39,54,54,53,52,
+38,35,34,7,35,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,22,19,3,253,
+173,47,116,82,123,152,94,107,107,84,78,73,65,139,28,139,10,91,73,59,73,74,
+89,107,108,93,152,123,82,118,46,172,254,105,80,69,159,118,97,172,88,100,63,
+121,68,62,75,173,83,90,77,62,65,115,69,101,92,172,96,117,157,71,1,23,252,
+151,0,0,1,0,63,0,0,4,104,3,255,0,40,0,0,1,34,14,2,21,20,22,22,51,33,21,35,
+34,14,2,21,20,22,51,51,21,35,34,38,38,53,52,54,55,38,38,53,52,62,2,51,33,
+21,2,33,129,95,60,24,72,104,96,1,1,206,115,100,65,28,115,130,7,10,162,167,
+87,68,69,76,76,50,117,160,171,2,55,3,101,17,40,50,32,57,64,20,154,13,39,51,
+35,69,74,154,67,130,87,69,111,43,42,120,78,58,108,81,29,154,0,2,0,177,255,
+230,1,175,5,66,0,3,0,15,0,0,1,35,3,51,3,50,22,21,20,6,35,34,38,53,52,54,1,
+108,117,51,219,111,60,67,69,58,59,68,66,1,156,3,166,251,185,71,66,67,73,72,
+68,67,70,0,0,4,0,173,3,255,2,248,6,244,0,3,0,7,0,8,0,9,0,0,1,3,35,3,33,3,
+35,3,3,17,1,144,51,125,51,2,75,51,124,51,72,6,47,253,240,2,16,253,240,2,16,
+253,208,2,245,0,0,2,0,51,0,0,4,246,5,53,0,27,0,31,0,0,1,33,3,35,19,33,53,
+33,19,33,53,33,19,51,3,33,19,51,3,33,21,33,3,33,21,33,3,35,3,33,19,33,2,232,
+254,220,77,144,78,254,254,1,29,68,254,235,1,50,75,147,77,1,38,78,142,79,1,
+1,254,228,70,1,28,254,199,78,145,185,1,38,71,254,218,1,114,254,142,1,114,
+137,1,72,135,1,107,254,149,1,107,254,149,135,254,184,137,254,142,1,251,1,
+72,0,0,5,0,100,255,236,6,66,5,74,0,11,0,23,0,27,0,39,0,51,0,0,1,34,38,53,
+52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,1,35,1,19,34,
+38,53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,143,143,
+156,151,148,148,160,157,151,79,79,78,80,78,71,71,3,246,252,213,157,3,43,116,
+143,156,149,150,147,161,157,151,80,78,79,79,78,71,71,2,53,208,188,195,198,
+202,191,194,202,129,133,134,132,132,133,131,132,135,2,127,250,203,5,53,250,
+183,208,187,196,197,205,188,193,202,129,131,135,132,132,132,132,134,132,0,
+3,0,173,3,255,1,206,6,244,0,3,0,4,0,5,0,0,1,3,35,3,1,17,1,144,51,125,51,1,
+33,6,47,253,240,2,16,253,208,2,245,0,0,4,0,100,253,29,2,139,6,244,0,13,0,
+14,0,15,0,16,0,0,1,51,2,2,17,16,18,19,35,38,2,17,16,18,19,17,19,1,220,173,
+184,183,182,187,175,182,194,192,170,189,6,47,254,245,253,192,254,202,254,
+186,253,196,254,241,230,2,90,1,84,1,73,2,74,254,187,2,245,246,90,0,0,4,0,
+81,253,29,2,120,6,244,0,13,0,14,0,15,0,16,0,0,1,35,18,18,17,16,2,3,51,22,
+18,17,16,2,19,17,19,1,0,173,186,181,182,187,175,185,191,192,22,69,253,29,
+1,13,2,56,1,60,1,77,2,54,1,14,236,253,170,254,174,254,183,253,182,5,247,2,
+245,246,90,0,0,3,0,114,2,150,4,46,6,244,0,14,0,15,0,16,0,0,1,3,37,23,5,19,
+7,3,3,39,19,37,55,5,3,3,17,2,177,41,1,138,28,254,136,243,176,174,158,182,
+240,254,139,29,1,133,43,227,6,47,254,119,111,189,30,254,188,96,1,102,254,
+154,96,1,68,30,189,111,1,137,253,208,2,245,0,3,0,102,0,0,4,41,5,53,0,11,0,
+12,0,13,0,0,1,33,21,33,17,35,17,33,53,33,17,51,1,17,2,145,1,152,254,104,147,
+254,104,1,152,147,254,155,2,229,146,254,90,1,166,146,1,168,251,115,5,53,0,
+3,0,84,254,248,1,137,3,255,0,6,0,7,0,8,0,0,37,23,6,3,35,18,55,19,17,1,123,
+14,52,124,133,71,31,86,238,23,199,254,232,1,31,215,3,17,252,1,0,3,0,82,0,
+0,2,66,3,255,0,3,0,4,0,5,0,0,19,53,33,21,1,17,82,1,240,254,206,1,183,160,
+160,2,72,252,1,0,0,1,0,147,255,230,1,145,0,251,0,11,0,0,37,50,22,21,20,6,
+35,34,38,53,52,54,1,16,61,68,70,59,58,67,65,251,70,67,68,72,72,68,66,71,0,
+4,0,60,253,29,3,64,6,244,0,3,0,4,0,5,0,6,0,0,1,1,35,1,3,17,3,3,64,253,173,
+177,2,84,194,1,6,47,246,238,9,18,253,208,2,245,246,90,0,2,0,100,255,236,4,
+47,5,74,0,11,0,23,0,0,5,34,2,17,16,18,51,50,18,17,16,2,39,50,54,17,16,38,
+35,34,6,17,16,22,2,72,238,246,240,244,238,249,244,243,160,149,149,160,161,
+146,146,20,1,95,1,80,1,88,1,87,254,161,254,176,254,168,254,169,153,254,1,
+24,1,23,254,250,254,229,254,229,251,0,0,2,0,180,0,0,2,217,5,61,0,10,0,11,
+0,0,33,35,17,52,55,6,7,7,39,1,51,5,2,217,172,8,35,100,156,94,1,140,153,254,
+212,3,133,173,87,39,82,127,121,1,51,8,0,2,0,98,0,0,4,41,5,74,0,27,0,28,0,
+0,33,33,53,1,62,3,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,6,7,1,21,33,1,
+4,41,252,57,1,127,110,119,80,35,139,123,94,158,100,96,204,244,205,238,77,
+143,135,254,207,2,207,254,98,150,1,89,99,116,112,103,56,103,116,61,78,121,
+172,188,163,100,174,167,119,254,241,8,1,20,0,0,1,0,92,255,236,4,31,5,74,0,
+40,0,0,1,21,22,22,21,20,4,33,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,
+51,50,54,53,52,38,35,34,6,7,39,54,33,50,22,21,20,6,2,218,161,164,254,222,
+254,241,128,190,84,91,215,98,187,187,207,206,142,144,174,196,146,124,98,167,
+104,90,198,1,3,217,236,140,2,193,8,25,161,131,190,210,38,41,168,45,51,127,
+128,113,114,153,129,113,91,103,54,69,123,152,179,151,125,159,0,0,3,0,43,0,
+0,4,106,5,61,0,10,0,18,0,19,0,0,1,35,17,35,17,33,53,1,51,17,51,37,17,52,55,
+35,6,7,1,19,4,106,216,171,253,68,2,176,183,216,254,125,11,9,50,61,254,103,
+204,1,42,254,214,1,42,153,3,122,252,134,9,1,148,104,181,90,78,253,247,3,105,
+0,0,1,0,129,255,236,4,31,5,53,0,28,0,0,55,53,22,22,51,50,54,53,52,38,35,34,
+7,39,19,33,21,33,3,54,51,50,4,21,20,4,33,34,38,129,74,213,98,172,188,184,
+183,114,139,90,55,2,221,253,183,32,108,115,231,1,10,254,221,255,0,117,198,
+59,170,44,52,143,135,130,131,30,57,2,122,164,254,146,21,212,184,210,238,41,
+0,2,0,113,255,236,4,51,5,74,0,23,0,37,0,0,1,21,38,35,34,2,3,51,54,51,50,22,
+21,20,6,35,34,0,17,16,0,33,50,22,3,52,38,35,34,6,6,21,20,22,22,51,50,54,3,
+195,76,101,240,243,13,8,112,239,195,231,251,214,227,254,242,1,78,1,79,45,
+105,31,148,139,89,148,86,77,145,95,139,154,5,55,153,24,254,253,254,237,173,
+220,191,210,244,1,54,1,24,1,136,1,136,10,252,114,129,141,67,113,59,84,157,
+93,157,0,0,1,0,90,0,0,4,47,5,53,0,6,0,0,33,1,33,53,33,21,1,1,23,2,88,252,
+235,3,213,253,174,4,145,164,139,251,86,0,0,4,0,100,255,236,4,45,5,74,0,23,
+0,35,0,48,0,49,0,0,1,22,22,21,20,4,35,34,38,53,52,54,55,38,38,53,52,54,51,
+50,22,21,20,6,37,54,54,53,52,38,35,34,6,21,20,22,23,6,6,21,20,22,51,50,54,
+53,52,38,39,37,2,231,171,155,254,253,220,236,254,151,152,135,121,241,196,
+201,237,135,254,217,136,120,142,124,121,141,118,115,147,134,166,148,145,166,
+148,162,1,149,2,198,70,177,116,167,200,189,172,119,179,61,68,162,107,145,
+172,171,147,105,159,8,48,118,79,86,97,99,84,78,113,208,55,135,93,103,117,
+122,103,83,128,56,19,0,0,2,0,102,255,236,4,41,5,74,0,24,0,37,0,0,51,53,22,
+51,50,18,19,35,6,6,35,34,38,53,52,54,51,50,0,17,16,0,33,34,38,19,20,22,51,
+50,54,53,52,38,38,35,34,6,209,79,101,242,245,11,11,64,170,118,194,228,254,
+213,226,1,14,254,176,254,176,43,110,37,145,139,141,185,80,144,94,138,154,
+154,27,1,1,1,18,91,79,218,191,209,248,254,202,254,232,254,120,254,120,10,
+3,141,130,138,144,93,88,157,89,158,0,4,0,72,255,230,1,145,3,255,0,11,0,23,
+0,24,0,25,0,0,1,50,22,21,20,6,35,34,38,53,52,54,19,50,22,21,20,6,35,34,38,
+53,52,54,3,17,1,16,61,68,71,58,57,68,65,60,61,68,70,59,58,67,65,140,3,225,
+71,68,68,71,71,68,68,71,253,26,70,67,68,72,72,68,66,71,3,4,252,1,0,4,0,63,
+254,248,1,216,3,255,0,11,0,18,0,19,0,20,0,0,1,50,22,21,20,6,35,34,38,53,52,
+54,19,23,6,3,35,18,55,1,17,1,16,61,68,71,58,57,68,65,148,15,54,122,136,75,
+30,1,48,3,225,71,68,68,71,71,68,68,71,253,13,23,206,254,239,1,44,202,3,17,
+252,1,0,3,0,102,0,0,4,43,5,53,0,6,0,7,0,8,0,0,37,1,53,1,21,9,2,17,4,43,252,
+59,3,197,252,252,3,4,253,1,184,1,168,102,1,225,160,254,148,254,188,254,169,
+5,53,0,0,4,0,115,0,0,4,29,5,53,0,3,0,7,0,8,0,9,0,0,19,53,33,21,1,53,33,21,
+1,17,115,3,170,252,86,3,170,253,15,3,30,145,145,254,104,146,146,254,122,5,
+53,0,0,3,0,102,0,0,4,43,5,53,0,6,0,7,0,8,0,0,19,1,1,53,1,21,1,23,17,102,3,
+4,252,252,3,197,252,59,198,1,87,1,66,1,110,160,254,31,102,254,88,184,5,53,
+0,2,0,105,255,230,3,146,5,74,0,28,0,40,0,0,1,53,52,54,55,62,2,53,52,38,35,
+34,6,7,39,54,51,50,22,21,20,6,6,7,6,6,21,21,7,50,22,21,20,6,35,34,38,53,52,
+54,1,111,74,101,94,76,36,127,125,79,151,98,63,190,213,192,214,51,84,105,94,
+70,63,59,66,68,57,61,66,63,1,134,52,108,139,77,72,71,69,45,85,88,38,48,143,
+101,170,150,69,111,87,81,71,112,91,22,139,71,66,68,72,72,68,68,69,0,0,4,0,
+164,253,29,2,111,6,244,0,7,0,8,0,9,0,10,0,0,1,33,17,33,21,33,17,33,3,17,3,
+2,111,254,53,1,203,254,229,1,27,161,1,253,29,9,18,147,248,21,6,78,2,245,246,
+90,0,4,0,60,253,29,3,64,6,244,0,3,0,4,0,5,0,6,0,0,19,1,35,1,1,17,3,237,2,
+83,178,253,174,1,146,1,6,47,246,238,9,18,253,208,2,245,246,90,0,4,0,81,253,
+29,2,28,6,244,0,7,0,8,0,9,0,10,0,0,19,33,17,33,53,33,17,33,1,17,3,81,1,27,
+254,229,1,203,254,53,1,125,1,253,177,7,235,147,246,238,6,226,2,245,246,90,
+0,3,0,78,2,35,4,70,6,244,0,6,0,7,0,8,0,0,19,1,51,1,35,9,2,17,78,1,178,102,
+1,224,160,254,143,254,185,1,28,2,35,3,158,252,98,2,223,253,33,1,220,2,245,
+0,0,2,255,252,254,197,3,145,0,0,0,3,0,4,0,0,1,33,53,33,37,3,145,252,107,3,
+149,253,51,254,197,131,184,0,0,4,0,57,253,29,2,201,6,244,0,27,0,28,0,29,0,
+30,0,0,19,54,54,53,17,52,54,51,21,6,21,17,20,7,21,22,21,17,20,23,21,38,38,
+53,17,52,38,35,19,17,3,57,126,124,215,191,228,223,223,228,197,209,120,130,
+105,1,1,239,1,91,99,2,62,154,169,147,6,187,253,202,211,38,13,37,213,253,202,
+188,2,148,1,167,158,2,54,98,95,2,165,2,245,246,90,0,0,4,1,225,253,29,2,135,
+6,244,0,3,0,4,0,5,0,6,0,0,1,51,17,35,19,17,3,1,225,166,166,51,1,6,47,246,
+238,6,226,2,245,246,90,0,0,4,0,65,253,29,2,209,6,244,0,28,0,29,0,30,0,31,
+0,0,1,6,6,21,17,20,6,35,53,54,53,17,52,55,53,38,53,17,52,38,39,53,22,22,21,
+17,20,22,51,3,17,3,2,209,131,119,215,191,228,223,223,112,116,202,204,120,
+130,149,1,1,93,2,92,97,253,194,154,169,147,6,187,2,54,211,38,13,37,213,2,
+54,95,93,2,148,3,168,155,253,202,98,95,2,13,2,245,246,90,0,0,3,0,102,0,0,
+4,43,5,53,0,23,0,24,0,25,0,0,19,53,54,51,50,22,23,22,22,51,50,54,55,21,6,
+35,34,38,39,38,38,35,34,6,19,17,102,101,145,70,123,77,67,99,47,55,125,56,
+103,143,71,123,76,69,98,48,52,128,144,2,22,160,108,32,33,29,27,64,57,158,
+110,32,33,30,26,66,253,179,5,53,255,255,0,82,0,0,2,66,3,255,2,2,2,110,0,0,
+0,3,0,82,0,0,3,174,3,255,0,3,0,4,0,5,0,0,19,53,33,21,1,17,82,3,92,253,98,
+1,183,160,160,2,72,252,1,0,0,3,0,82,0,0,7,174,3,255,0,3,0,4,0,5,0,0,19,53,
+33,21,1,17,82,7,92,249,98,1,183,160,160,2,72,252,1,0,0,3,0,102,3,255,1,159,
+6,244,0,6,0,7,0,8,0,0,19,39,54,19,51,2,7,7,17,114,12,56,120,137,71,32,50,
+4,58,22,217,1,6,254,222,211,59,2,245,0,0,3,0,102,3,255,1,159,6,244,0,6,0,
+7,0,8,0,0,1,23,6,3,35,18,55,19,17,1,147,12,56,120,137,71,32,57,6,47,22,216,
+254,249,1,34,211,253,208,2,245,0,0,4,0,102,3,255,3,33,6,244,0,6,0,13,0,14,
+0,15,0,0,1,39,54,19,51,2,7,33,39,54,19,51,2,7,23,17,1,242,15,56,123,139,71,
+32,253,184,12,56,120,137,71,32,150,4,58,22,210,1,13,254,222,211,22,217,1,
+6,254,222,211,59,2,245,0,4,0,102,3,255,3,33,6,244,0,6,0,13,0,14,0,15,0,0,
+1,23,6,3,35,18,55,33,23,6,3,35,18,55,3,17,1,149,15,56,123,139,71,32,2,72,
+12,56,120,137,71,32,129,6,47,22,210,254,243,1,34,211,22,216,254,249,1,34,
+211,253,208,2,245,0,0,3,0,147,255,230,5,193,0,251,0,11,0,23,0,35,0,0,37,50,
+22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,33,50,22,
+21,20,6,35,34,38,53,52,54,1,16,61,68,70,59,58,67,65,2,85,61,66,68,59,60,65,
+63,2,84,63,67,69,61,58,66,64,251,70,67,68,72,72,68,66,71,71,66,67,73,73,67,
+66,71,71,66,67,73,73,67,66,71,0,3,0,131,0,0,4,12,5,53,0,11,0,12,0,13,0,0,
+1,23,1,1,7,1,1,39,1,1,55,1,1,17,3,166,102,254,164,1,90,102,254,162,254,170,
+107,1,90,254,164,107,1,90,254,228,4,98,105,254,164,254,164,105,1,90,254,166,
+105,1,92,1,90,107,254,161,252,253,5,53,0,5,0,102,0,0,4,43,5,53,0,10,0,14,
+0,25,0,26,0,27,0,0,1,50,22,21,20,6,35,34,38,53,52,1,53,33,21,5,50,22,21,20,
+6,35,34,38,53,52,3,17,2,72,55,57,61,51,53,62,254,145,3,197,254,29,55,57,61,
+51,53,62,169,4,116,63,60,60,65,64,61,123,253,223,146,146,153,63,60,60,65,
+64,61,123,254,70,5,53,0,3,0,102,0,0,4,43,5,53,0,3,0,4,0,5,0,0,19,53,33,21,
+1,17,102,3,197,253,1,2,83,146,146,253,173,5,53,0,0,1,0,147,0,0,4,27,5,53,
+0,29,0,0,1,6,6,7,1,35,1,55,51,50,54,54,55,33,53,33,46,2,35,35,53,33,21,33,
+22,22,23,33,21,2,220,8,194,168,1,187,228,254,82,21,78,107,116,71,10,254,109,
+1,146,13,68,103,83,135,3,136,254,102,34,45,10,1,65,3,91,141,182,25,254,1,
+1,247,158,36,93,69,148,66,82,30,148,148,32,89,57,148,0,5,1,142,253,78,2,51,
+6,244,0,3,0,4,0,5,0,6,0,7,0,0,1,17,51,17,3,17,19,17,1,142,165,101,16,254,
+227,6,82,249,174,5,28,2,245,248,143,253,203,0,0,6,1,142,253,78,3,245,6,244,
+0,3,0,7,0,8,0,9,0,10,0,11,0,0,1,17,51,17,33,17,51,17,19,17,19,17,3,80,165,
+253,153,165,99,16,254,227,6,82,249,174,6,82,249,174,5,28,2,245,248,143,253,
+203,0,3,0,34,255,206,4,41,3,255,0,39,0,40,0,41,0,0,19,22,22,51,50,54,53,52,
+38,39,39,46,2,53,52,54,51,50,22,23,7,38,38,35,32,21,20,22,23,23,22,22,21,
+20,6,35,34,36,39,1,33,211,33,162,138,143,147,107,120,134,172,158,70,230,211,
+220,205,50,176,29,139,131,254,241,114,114,157,201,175,235,230,206,254,249,
+36,1,242,2,21,1,88,111,98,77,69,73,71,9,10,13,72,116,85,135,158,135,151,45,
+97,80,137,66,56,8,11,14,157,131,154,161,168,154,254,166,0,7,0,60,254,255,
+6,11,3,255,0,51,0,64,0,76,0,80,0,81,0,82,0,83,0,0,37,22,22,51,50,54,53,52,
+38,39,55,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,
+52,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,1,38,35,34,6,21,20,22,
+51,50,54,53,52,19,38,38,35,34,6,21,20,22,51,50,54,19,19,51,19,39,33,1,3,22,
+70,128,77,119,120,175,185,72,214,244,224,190,96,167,102,72,168,96,145,154,
+150,128,76,153,95,34,73,3,150,124,120,159,176,143,148,211,111,254,116,38,
+44,72,83,67,61,68,73,75,73,108,57,58,62,78,68,65,106,78,15,154,15,21,3,6,
+253,82,224,47,42,134,125,154,236,85,144,93,254,185,188,200,231,59,70,65,64,
+127,106,98,122,55,62,80,109,183,100,21,21,114,137,146,119,116,153,135,243,
+135,158,2,9,11,71,57,60,66,67,63,59,253,140,51,40,42,35,35,43,32,254,96,1,
+34,254,222,207,3,151,0,0,4,0,82,255,206,4,169,3,255,0,25,0,26,0,27,0,28,0,
+0,37,54,54,53,52,38,35,34,6,21,20,22,23,7,38,17,52,54,54,51,50,0,21,20,6,
+7,5,33,37,3,13,99,61,178,172,157,182,75,85,171,159,128,237,156,239,1,13,70,
+90,254,157,2,85,253,165,59,140,193,107,180,190,196,172,118,210,114,75,248,
+1,13,149,243,130,254,245,233,143,252,144,34,50,0,0,6,0,60,254,255,8,118,3,
+255,0,50,0,62,0,66,0,67,0,68,0,69,0,0,37,6,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,
+54,53,52,38,39,55,22,18,21,20,6,35,34,1,38,38,35,34,6,21,20,22,51,50,54,19,
+19,51,19,37,33,1,5,47,50,167,117,98,157,80,71,136,92,141,158,164,125,92,149,
+123,91,116,83,102,109,175,184,76,212,241,5,78,160,91,105,110,175,184,76,211,
+242,206,192,210,252,95,72,80,51,60,73,80,68,66,91,48,15,154,15,1,230,3,155,
+250,106,154,90,90,79,92,97,74,169,137,130,166,89,159,120,73,134,125,152,234,
+85,158,92,254,184,198,42,39,97,92,133,126,152,234,85,158,92,254,184,198,206,
+225,1,42,95,56,79,67,66,84,75,254,53,1,34,254,222,207,3,151,0,6,0,60,254,
+255,8,118,3,255,0,50,0,62,0,66,0,67,0,68,0,69,0,0,37,6,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,
+22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,1,38,38,35,34,6,21,20,22,
+51,50,54,19,19,51,19,37,33,1,5,47,50,167,117,98,157,80,71,136,92,141,158,
+164,125,92,149,123,91,116,83,102,109,175,184,76,212,241,5,78,160,91,105,110,
+175,185,72,214,244,206,192,210,252,95,72,80,51,60,73,80,68,66,91,48,15,154,
+15,5,129,252,101,254,15,154,90,90,79,92,97,74,169,137,130,166,89,159,120,
+73,134,125,152,234,85,158,92,254,184,198,42,39,97,92,133,126,154,236,85,144,
+93,254,185,188,206,225,1,42,95,56,79,67,66,84,75,254,53,1,34,254,222,207,
+3,151,0,6,0,60,254,255,10,235,3,255,0,67,0,79,0,91,0,95,0,96,0,97,0,0,37,
+6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,
+39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,39,55,55,33,50,30,2,21,20,
+6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,1,6,21,20,22,51,50,54,53,52,38,
+35,1,38,38,35,34,6,21,20,22,51,50,54,19,19,51,19,37,33,5,47,50,167,117,98,
+157,80,71,136,92,141,158,164,125,92,149,123,91,116,83,102,109,175,184,76,
+212,241,5,78,160,91,104,111,181,177,1,1,74,2,210,117,141,114,62,157,132,131,
+150,44,254,84,122,130,208,190,210,3,174,52,75,63,62,70,92,99,248,150,72,80,
+51,60,73,80,68,66,91,48,15,154,15,5,129,252,101,154,90,90,79,92,97,74,169,
+137,130,166,89,159,120,73,134,125,152,234,85,158,92,254,184,198,42,39,97,
+92,130,121,146,244,92,1,1,153,25,74,119,88,123,146,147,109,89,76,92,246,135,
+200,222,3,127,69,80,62,75,72,60,78,76,253,171,95,56,79,67,66,84,75,254,53,
+1,34,254,222,207,0,6,0,60,254,255,10,242,3,255,0,70,0,82,0,86,0,87,0,88,0,
+89,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,
+22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,
+53,52,38,39,55,22,18,21,20,6,35,34,39,6,6,35,34,39,6,6,35,34,38,39,38,38,
+35,34,6,21,20,22,51,50,54,19,19,51,19,37,33,1,2,146,71,136,92,141,158,164,
+125,92,149,123,91,116,83,102,109,175,184,76,212,241,5,78,160,91,105,110,175,
+184,76,211,242,5,80,158,91,105,110,175,184,76,211,242,206,192,208,159,50,
+171,121,210,158,50,167,117,98,157,182,72,80,51,60,73,80,68,66,91,48,15,154,
+15,5,129,252,101,253,250,145,97,74,169,137,130,166,89,159,120,73,134,125,
+152,234,85,158,92,254,184,198,42,39,97,92,133,126,152,234,85,158,92,254,184,
+198,42,39,98,91,133,126,152,234,85,158,92,254,184,198,206,225,179,90,89,180,
+90,90,79,219,95,56,79,67,66,84,75,254,53,1,34,254,222,207,3,151,0,0,3,0,52,
+255,206,6,20,3,255,0,40,0,41,0,42,0,0,37,6,6,35,34,38,53,52,54,55,35,53,33,
+21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,0,39,55,4,0,21,20,6,35,
+34,38,7,33,3,20,54,148,119,147,184,61,57,202,1,223,230,94,83,97,123,10,159,
+8,127,94,108,109,254,236,210,62,1,25,1,57,202,168,115,143,77,3,10,150,87,
+89,178,143,63,126,44,152,145,54,176,78,92,126,115,113,128,129,130,194,1,9,
+16,154,46,254,174,242,199,224,77,101,0,0,4,0,52,255,206,6,20,3,255,0,40,0,
+41,0,42,0,43,0,0,37,6,6,35,34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,
+54,55,51,22,22,51,50,54,53,52,0,39,55,4,0,21,20,6,35,34,38,7,33,1,3,20,54,
+148,119,147,184,61,57,202,1,223,230,94,83,97,123,10,159,8,127,94,108,109,
+254,247,195,16,1,42,1,60,202,168,115,143,77,3,10,252,220,150,87,89,178,143,
+63,126,44,152,145,54,176,78,92,126,115,113,128,129,130,189,1,15,21,148,57,
+254,185,242,199,224,77,101,3,151,0,4,0,52,254,255,6,20,3,255,0,40,0,44,0,
+45,0,46,0,0,37,6,6,35,34,38,53,52,54,55,35,53,33,21,6,21,20,22,51,50,54,55,
+51,22,22,51,50,54,53,52,0,39,55,4,0,21,20,6,35,34,38,3,19,51,19,39,33,3,20,
+54,148,119,147,184,61,57,202,1,223,230,94,83,97,123,10,159,8,127,94,108,109,
+254,236,210,62,1,25,1,57,202,168,115,143,159,15,154,15,102,3,10,150,87,89,
+178,143,63,126,44,152,145,54,176,78,92,126,115,113,128,129,130,194,1,9,16,
+154,46,254,174,242,199,224,77,254,204,1,34,254,222,207,0,0,5,0,52,254,255,
+6,20,3,255,0,40,0,44,0,45,0,46,0,47,0,0,37,6,6,35,34,38,53,52,54,55,35,53,
+33,21,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,0,39,55,4,0,21,20,6,
+35,34,38,3,19,51,19,39,33,1,3,20,54,148,119,147,184,61,57,202,1,223,230,94,
+83,97,123,10,159,8,127,94,108,109,254,247,195,16,1,42,1,60,202,168,115,143,
+159,15,154,15,102,3,10,253,39,150,87,89,178,143,63,126,44,152,145,54,176,
+78,92,126,115,113,128,129,130,189,1,15,21,148,57,254,185,242,199,224,77,254,
+204,1,34,254,222,207,3,151,0,5,0,73,255,206,5,217,3,255,0,80,0,81,0,82,0,
+83,0,84,0,0,1,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,53,52,38,35,
+35,55,54,55,54,51,50,22,21,20,6,35,34,39,6,7,6,6,21,20,22,51,50,54,55,51,
+22,22,51,50,54,53,52,39,1,33,1,1,5,88,33,36,187,164,114,150,54,62,153,133,
+158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,137,168,15,58,170,89,
+157,71,98,83,17,13,8,30,59,141,154,178,153,202,140,49,192,126,87,88,83,117,
+137,11,159,8,123,102,91,96,50,254,43,2,237,251,251,2,104,2,4,51,128,61,142,
+160,86,90,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,113,
+143,121,112,56,64,101,44,54,119,3,3,11,118,115,114,142,111,97,70,47,86,59,
+63,70,121,120,116,125,80,76,77,85,254,9,1,231,2,74,0,5,0,72,254,255,10,73,
+3,255,0,53,0,65,0,69,0,70,0,71,0,0,37,6,6,35,34,0,53,52,54,54,51,50,22,22,
+21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,
+38,39,55,22,18,21,20,6,35,34,39,6,6,35,34,37,50,54,53,52,38,35,34,6,21,20,
+22,1,19,51,19,37,33,4,33,70,232,148,244,254,221,136,244,155,157,246,132,18,
+81,164,97,105,110,175,184,76,211,242,5,80,158,91,105,110,175,184,76,211,242,
+206,192,208,159,50,171,121,228,253,149,173,194,195,172,171,195,193,5,2,15,
+154,15,252,171,6,51,188,104,110,1,24,229,158,249,133,133,246,158,77,69,104,
+101,133,126,152,234,85,158,92,254,184,198,42,39,98,91,133,126,152,234,85,
+158,92,254,184,198,206,225,179,90,89,161,195,164,169,206,203,161,170,200,
+254,120,1,34,254,222,207,0,0,5,0,72,254,255,10,73,3,255,0,53,0,65,0,69,0,
+70,0,71,0,0,37,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,
+53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,
+35,34,39,6,6,35,34,37,50,54,53,52,38,35,34,6,21,20,22,1,19,51,19,37,33,4,
+33,70,232,148,244,254,221,136,244,155,157,246,132,18,81,164,97,105,110,175,
+184,76,211,242,5,80,158,91,105,110,175,185,72,214,244,206,192,208,159,50,
+171,121,228,253,149,173,194,195,172,171,195,193,5,2,15,154,15,2,222,249,205,
+188,104,110,1,24,229,158,249,133,133,246,158,77,69,104,101,133,126,152,234,
+85,158,92,254,184,198,42,39,98,91,133,126,154,236,85,144,93,254,185,188,206,
+225,179,90,89,161,195,164,169,206,203,161,170,200,254,120,1,34,254,222,207,
+0,0,6,0,72,254,255,12,190,3,255,0,70,0,82,0,94,0,98,0,99,0,100,0,0,37,6,6,
+35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,
+18,21,20,7,22,22,51,50,54,53,52,38,39,55,35,55,33,50,30,2,21,20,6,35,34,38,
+53,52,55,33,22,22,21,20,6,35,34,39,6,6,35,34,37,50,54,53,52,38,35,34,6,21,
+20,22,1,6,21,20,22,51,50,54,53,52,38,35,1,19,51,19,37,33,4,33,70,232,148,
+244,254,221,136,244,155,157,246,132,18,81,164,97,105,110,175,184,76,211,242,
+5,80,158,91,104,111,181,177,1,1,74,2,210,117,141,114,62,157,132,131,150,44,
+254,84,122,130,208,190,208,159,50,171,121,228,253,149,173,194,195,172,171,
+195,193,9,157,52,75,63,62,70,92,99,251,74,15,154,15,2,222,249,205,188,104,
+110,1,24,229,158,249,133,133,246,158,77,69,104,101,133,126,152,234,85,158,
+92,254,184,198,42,39,98,91,130,121,146,244,92,1,154,25,74,119,88,123,146,
+147,109,89,76,92,246,135,200,222,179,90,89,161,195,164,169,206,203,161,170,
+200,2,222,69,80,62,75,72,60,78,76,251,154,1,34,254,222,207,0,0,5,0,72,254,
+255,12,197,3,255,0,73,0,85,0,89,0,90,0,91,0,0,37,6,6,35,34,0,53,52,54,54,
+51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,
+50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,
+20,6,35,34,39,6,6,35,34,39,6,6,35,34,37,50,54,53,52,38,35,34,6,21,20,22,1,
+19,51,19,37,33,4,33,70,232,148,244,254,221,136,244,155,157,246,132,18,81,
+164,97,105,110,175,184,76,211,242,5,80,158,91,105,110,175,184,76,211,242,
+5,80,158,91,105,110,175,184,76,211,242,206,192,208,159,50,171,121,208,159,
+50,171,121,228,253,149,173,194,195,172,171,195,193,5,2,15,154,15,2,222,249,
+205,188,104,110,1,24,229,158,249,133,133,246,158,77,69,104,101,133,126,152,
+234,85,158,92,254,184,198,42,39,98,91,133,126,152,234,85,158,92,254,184,198,
+42,39,98,91,133,126,152,234,85,158,92,254,184,198,206,225,179,90,89,179,90,
+89,161,195,164,169,206,203,161,170,200,254,120,1,34,254,222,207,0,5,0,78,
+255,206,6,42,4,244,0,48,0,59,0,60,0,61,0,62,0,0,1,7,22,22,21,20,6,35,34,39,
+6,21,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,2,39,55,22,18,21,20,6,35,
+34,38,39,6,6,35,34,2,53,52,18,55,3,3,22,51,50,54,53,52,38,35,34,6,1,33,1,
+2,63,12,104,113,164,154,117,104,2,123,123,108,126,11,159,9,123,96,109,109,
+176,176,123,201,198,199,172,119,148,57,52,151,122,188,219,172,154,13,124,
+82,103,83,83,64,57,77,122,1,235,3,21,253,121,4,244,250,17,134,103,136,147,
+67,26,26,22,167,172,120,121,114,127,129,130,158,1,8,99,108,118,254,199,187,
+203,228,87,89,85,91,1,24,222,212,1,25,42,1,1,253,185,60,68,63,58,64,100,252,
+196,3,151,0,0,5,0,72,255,206,4,191,3,255,0,14,0,26,0,37,0,38,0,39,0,0,1,50,
+22,22,21,20,6,6,35,34,0,53,52,54,54,19,50,54,53,52,38,35,34,6,21,20,22,19,
+50,22,21,20,6,35,34,38,53,52,19,33,2,95,157,246,132,132,243,160,244,254,221,
+136,244,154,173,194,195,172,171,195,193,175,52,57,58,51,54,57,110,2,96,3,
+255,133,246,158,151,233,128,1,24,229,158,249,133,252,136,195,164,169,206,
+203,161,170,200,1,231,62,57,59,63,63,59,119,253,96,0,4,0,72,255,206,5,236,
+3,255,0,41,0,54,0,55,0,56,0,0,37,6,6,35,34,38,53,52,18,36,51,50,4,23,7,38,
+38,35,34,4,21,16,51,50,54,55,51,22,23,38,53,52,54,51,50,22,21,20,6,35,34,
+38,37,22,51,50,54,53,52,38,35,34,6,21,20,5,33,2,210,48,146,122,150,184,173,
+1,70,214,144,1,0,130,100,116,204,123,248,254,229,189,91,112,10,159,9,89,21,
+156,131,127,163,182,155,143,194,1,21,32,35,85,81,69,65,65,71,254,248,2,246,
+150,85,91,227,192,190,1,30,154,74,80,138,76,62,250,223,254,251,125,116,147,
+54,54,60,114,140,152,115,143,159,84,73,3,71,65,58,63,68,64,65,238,0,5,0,72,
+254,255,5,236,3,255,0,41,0,54,0,58,0,59,0,60,0,0,37,6,6,35,34,38,53,52,18,
+36,51,50,4,23,7,38,38,35,34,4,21,16,51,50,54,55,51,22,23,38,53,52,54,51,50,
+22,21,20,6,35,34,38,37,22,51,50,54,53,52,38,35,34,6,21,20,1,19,51,19,39,33,
+2,210,48,146,122,150,184,173,1,70,214,144,1,0,130,100,116,204,123,248,254,
+229,189,91,112,10,159,9,89,21,156,131,127,163,182,155,143,194,1,21,32,35,
+85,81,69,65,65,71,254,121,15,154,15,57,2,246,150,85,91,227,192,190,1,30,154,
+74,80,138,76,62,250,223,254,251,125,116,147,54,54,60,114,140,152,115,143,
+159,84,73,3,71,65,58,63,68,64,65,254,67,1,34,254,222,207,0,6,0,73,255,206,
+6,58,4,0,0,36,0,46,0,58,0,59,0,60,0,61,0,0,19,22,4,51,50,36,55,6,35,34,38,
+53,52,54,55,38,35,55,4,0,21,20,0,33,32,0,53,52,54,51,50,22,21,20,6,35,34,
+39,22,51,50,53,52,38,35,34,6,5,38,38,35,34,6,21,20,22,51,50,54,1,33,1,234,
+43,1,35,228,249,1,34,33,89,127,121,149,110,93,80,127,46,1,42,1,43,254,143,
+254,167,254,162,254,128,210,164,127,147,173,151,94,79,66,82,186,64,57,82,
+113,4,93,28,94,57,60,76,71,64,65,96,253,225,3,29,252,228,1,145,129,137,161,
+154,83,137,114,86,131,18,21,150,42,254,249,221,243,254,231,1,21,235,179,229,
+138,114,127,148,184,41,131,53,55,104,10,54,60,63,57,55,64,66,253,142,3,151,
+0,6,0,72,254,255,5,166,3,255,0,19,0,38,0,49,0,53,0,54,0,55,0,0,37,6,6,35,
+34,38,53,52,18,36,51,50,4,18,21,20,6,35,34,38,3,51,22,22,51,50,54,53,52,38,
+35,35,34,6,21,20,22,51,50,19,50,22,21,20,6,35,34,38,53,52,19,19,51,19,39,
+33,2,210,48,146,122,152,182,158,1,43,202,195,1,35,156,181,159,109,144,137,
+159,18,113,82,97,92,241,218,31,221,252,92,97,164,131,52,57,58,51,54,57,17,
+15,154,15,92,2,211,150,85,91,234,202,181,1,21,155,151,254,232,182,206,230,
+82,1,34,101,110,138,139,211,246,242,210,143,139,2,20,62,57,59,63,63,59,119,
+252,100,1,34,254,222,207,0,4,0,72,255,206,5,166,3,255,0,19,0,39,0,40,0,41,
+0,0,37,6,6,35,34,38,53,52,18,36,51,50,4,18,21,20,6,35,34,38,3,51,22,22,51,
+50,54,53,52,38,35,35,34,6,21,20,22,51,50,54,19,33,2,210,48,146,122,152,182,
+158,1,43,202,195,1,35,156,181,159,109,144,137,159,8,119,86,97,92,241,218,
+31,221,252,92,97,88,115,90,2,211,150,85,91,234,202,181,1,21,155,151,254,232,
+182,206,230,82,1,64,114,127,138,139,211,246,242,210,143,139,127,254,200,0,
+0,5,0,72,254,255,5,166,3,255,0,19,0,39,0,43,0,44,0,45,0,0,37,6,6,35,34,38,
+53,52,18,36,51,50,4,18,21,20,6,35,34,38,3,51,22,22,51,50,54,53,52,38,35,35,
+34,6,21,20,22,51,50,54,3,19,51,19,39,33,2,210,48,146,122,152,182,158,1,43,
+202,195,1,35,156,181,159,109,144,137,159,8,119,86,97,92,241,218,31,221,252,
+92,97,88,115,2,15,154,15,92,2,211,150,85,91,234,202,181,1,21,155,151,254,
+232,182,206,230,82,1,64,114,127,138,139,211,246,242,210,143,139,127,253,249,
+1,34,254,222,207,0,4,0,60,255,206,5,157,3,255,0,40,0,41,0,42,0,43,0,0,37,
+7,38,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,38,36,35,35,55,4,0,17,
+20,6,35,34,38,39,38,38,35,34,6,21,20,22,5,33,37,1,69,166,52,47,157,120,70,
+102,82,80,110,120,77,103,113,153,254,229,180,80,149,1,83,1,122,209,189,126,
+184,132,73,69,46,47,61,45,1,189,2,207,252,87,29,56,84,152,83,126,168,44,78,
+106,146,77,133,127,144,215,115,154,21,254,170,254,249,199,224,119,179,98,
+59,76,60,67,125,151,50,0,4,0,60,255,206,5,157,3,255,0,41,0,42,0,43,0,44,0,
+0,1,35,53,51,21,4,0,17,20,6,35,34,38,39,38,38,35,34,6,21,20,22,23,7,38,38,
+53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,38,3,33,37,2,193,167,149,1,76,
+1,89,209,189,126,184,132,73,69,46,47,61,45,52,166,52,47,157,120,70,102,82,
+80,110,120,77,103,113,255,221,2,207,252,87,3,101,154,27,37,254,206,255,0,
+199,224,119,179,98,59,76,60,67,125,72,56,84,152,83,126,168,44,78,106,146,
+77,133,127,191,247,252,141,50,0,0,4,0,60,255,206,5,104,3,255,0,30,0,42,0,
+43,0,44,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,
+39,55,22,18,21,20,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,54,23,19,2,146,
+71,136,92,141,158,164,125,92,149,123,91,116,83,102,109,175,184,76,212,241,
+206,185,98,157,182,72,80,51,60,73,80,68,66,91,203,3,145,97,74,169,137,130,
+166,89,159,120,73,134,125,152,234,85,158,92,254,184,198,203,228,79,219,95,
+56,79,67,66,84,75,252,3,151,0,7,0,60,255,206,5,177,6,244,0,35,0,47,0,48,0,
+49,0,50,0,51,0,52,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,
+53,16,39,39,38,37,55,22,4,23,23,22,17,20,6,35,34,38,39,38,38,35,34,6,21,20,
+22,51,50,54,23,33,1,3,3,2,146,71,136,92,141,158,164,125,92,149,123,91,116,
+83,105,106,196,17,214,254,220,79,186,1,66,109,23,170,206,185,98,157,182,72,
+80,51,60,73,80,68,66,91,203,2,217,252,177,179,17,145,97,74,169,137,130,166,
+89,159,120,73,137,138,1,4,241,49,220,115,164,79,249,146,53,238,254,223,203,
+228,79,219,95,56,79,67,66,84,75,252,7,38,253,11,1,19,0,7,0,60,255,206,5,177,
+6,244,0,35,0,47,0,48,0,49,0,50,0,51,0,52,0,0,37,6,6,35,34,38,53,52,54,51,
+50,22,23,22,22,51,50,54,53,16,3,39,38,37,55,22,4,23,23,18,17,20,6,35,34,38,
+39,38,38,35,34,6,21,20,22,51,50,54,23,33,1,3,3,2,146,71,136,92,141,158,164,
+125,92,149,123,91,116,83,105,106,244,17,170,254,224,79,174,1,53,110,25,192,
+206,185,98,157,182,72,80,51,60,73,80,68,66,91,203,2,217,252,177,179,17,145,
+97,74,169,137,130,166,89,159,120,73,137,138,1,41,1,7,46,164,115,164,73,223,
+128,67,254,248,254,213,203,228,79,219,95,56,79,67,66,84,75,252,7,38,253,11,
+1,19,0,5,0,60,254,255,5,104,3,255,0,30,0,42,0,46,0,47,0,48,0,0,37,6,6,35,
+34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,
+34,38,39,38,38,35,34,6,21,20,22,51,50,54,19,19,51,19,39,19,2,146,71,136,92,
+141,158,164,125,92,149,123,91,116,83,102,109,175,184,76,212,241,206,185,98,
+157,182,72,80,51,60,73,80,68,66,91,48,15,154,15,29,3,145,97,74,169,137,130,
+166,89,159,120,73,134,125,152,234,85,158,92,254,184,198,203,228,79,219,95,
+56,79,67,66,84,75,254,53,1,34,254,222,207,3,151,0,8,0,60,254,255,5,177,6,
+244,0,35,0,47,0,51,0,52,0,53,0,54,0,55,0,56,0,0,37,6,6,35,34,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,16,39,39,38,37,55,22,4,23,23,22,17,20,6,35,
+34,38,39,38,38,35,34,6,21,20,22,51,50,54,19,19,51,19,39,33,1,3,3,2,146,71,
+136,92,141,158,164,125,92,149,123,91,116,83,105,106,196,17,214,254,220,79,
+186,1,66,109,23,170,206,185,98,157,182,72,80,51,60,73,80,68,66,91,48,15,154,
+15,29,2,217,252,177,179,17,145,97,74,169,137,130,166,89,159,120,73,137,138,
+1,4,241,49,220,115,164,79,249,146,53,238,254,223,203,228,79,219,95,56,79,
+67,66,84,75,254,53,1,34,254,222,207,7,38,253,11,1,19,0,8,0,60,254,255,5,177,
+6,244,0,35,0,47,0,51,0,52,0,53,0,54,0,55,0,56,0,0,37,6,6,35,34,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,16,3,39,38,37,55,22,4,23,23,18,17,20,6,35,34,
+38,39,38,38,35,34,6,21,20,22,51,50,54,19,19,51,19,39,33,1,3,3,2,146,71,136,
+92,141,158,164,125,92,149,123,91,116,83,105,106,244,17,168,254,222,79,174,
+1,53,110,25,192,206,185,98,157,182,72,80,51,60,73,80,68,66,91,48,15,154,15,
+29,2,217,252,177,179,17,145,97,74,169,137,130,166,89,159,120,73,137,138,1,
+41,1,7,47,162,116,164,73,223,128,67,254,248,254,213,203,228,79,219,95,56,
+79,67,66,84,75,254,53,1,34,254,222,207,7,38,253,11,1,19,0,5,0,73,255,206,
+6,0,3,255,0,60,0,61,0,62,0,63,0,64,0,0,1,51,22,22,51,50,54,53,52,38,39,55,
+22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,
+21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,19,33,1,1,
+2,176,159,9,123,96,109,109,173,172,101,196,218,199,172,119,148,57,62,153,
+133,158,178,140,164,112,70,78,77,88,86,21,153,36,179,163,155,167,120,152,
+126,87,88,83,117,137,91,3,0,251,212,1,174,1,120,114,127,129,130,153,240,87,
+99,79,254,210,187,203,228,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,
+59,39,47,44,65,84,113,143,149,116,105,137,56,47,86,59,63,70,121,254,206,1,
+231,1,176,0,6,0,73,254,255,6,0,3,255,0,60,0,64,0,65,0,66,0,67,0,68,0,0,1,
+51,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,
+6,6,21,20,22,51,50,54,3,19,51,19,39,33,1,1,2,176,159,9,123,96,109,109,173,
+172,57,214,244,199,172,119,148,57,62,153,133,158,178,140,164,112,70,78,77,
+88,86,21,153,36,179,163,155,167,120,152,126,87,88,83,117,137,3,15,154,15,
+90,3,0,251,212,1,174,1,120,114,127,129,130,153,240,87,139,92,254,182,186,
+203,228,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,
+113,143,149,116,105,137,56,47,86,59,63,70,121,253,255,1,34,254,222,207,1,
+231,1,176,0,0,6,0,73,254,255,6,0,3,255,0,60,0,64,0,65,0,66,0,67,0,68,0,0,
+1,51,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,
+6,7,6,6,21,20,22,51,50,54,3,19,51,19,39,33,1,1,2,176,159,9,123,96,109,109,
+173,172,101,196,218,199,172,119,148,57,62,153,133,158,178,140,164,112,70,
+78,77,88,86,21,153,36,179,163,155,167,120,152,126,87,88,83,117,137,3,15,154,
+15,90,3,0,251,212,1,174,1,120,114,127,129,130,153,240,87,99,79,254,210,187,
+203,228,87,89,88,88,165,128,116,150,58,40,76,52,56,59,67,59,39,47,44,65,84,
+113,143,149,116,105,137,56,47,86,59,63,70,121,253,255,1,34,254,222,207,1,
+231,1,176,0,0,4,0,60,255,206,8,118,3,255,0,52,0,64,0,65,0,66,0,0,37,6,6,35,
+34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,36,35,35,55,4,0,17,20,
+7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,39,6,6,35,34,38,39,38,
+38,35,34,6,21,20,22,51,50,54,5,33,2,146,71,136,92,141,158,164,125,92,149,
+123,90,117,78,105,111,153,254,229,180,80,149,1,83,1,122,5,80,157,92,105,110,
+175,184,76,211,242,206,192,209,158,52,171,119,95,154,181,72,80,51,60,73,80,
+68,66,91,2,46,4,59,145,97,74,169,137,130,166,89,159,118,75,134,125,144,215,
+116,154,21,254,170,254,249,38,36,98,90,133,126,152,234,85,158,92,254,184,
+198,206,225,180,90,90,80,218,95,56,79,67,66,84,75,252,0,0,3,0,60,255,206,
+8,45,3,255,0,52,0,64,0,65,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,36,39,35,53,51,23,4,0,17,20,7,22,22,51,50,54,53,52,38,39,55,
+22,18,21,20,6,35,34,39,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,54,5,2,
+146,71,136,92,141,158,164,125,92,149,123,90,117,78,105,111,255,0,233,167,
+132,17,1,76,1,89,5,80,157,92,105,110,175,184,76,211,242,206,192,209,158,103,
+239,95,154,181,72,80,51,60,73,80,68,66,91,2,46,145,97,74,169,137,130,166,
+89,159,118,75,134,125,192,247,36,154,27,37,254,206,255,0,38,36,98,90,133,
+126,152,234,85,158,92,254,184,198,206,225,180,180,80,218,95,56,79,67,66,84,
+75,252,0,0,5,0,60,255,206,10,235,3,255,0,69,0,81,0,93,0,94,0,95,0,0,37,6,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,36,
+35,35,55,4,0,17,20,7,22,22,51,50,54,53,52,38,39,53,53,55,33,50,30,2,21,20,
+6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,1,6,21,20,22,51,50,54,53,52,38,
+35,1,38,38,35,34,6,21,20,22,51,50,54,5,33,5,48,52,171,119,95,154,79,71,136,
+92,141,158,164,125,92,149,123,90,117,78,105,111,153,254,229,180,80,149,1,
+83,1,122,5,80,157,92,104,111,181,177,74,2,210,117,141,114,62,157,132,131,
+150,44,254,84,122,130,208,190,209,3,173,52,75,63,62,70,92,99,248,150,72,80,
+51,60,73,80,68,66,91,2,46,4,59,154,90,90,80,91,97,74,169,137,130,166,89,159,
+118,75,134,125,144,215,116,154,21,254,170,254,249,38,36,98,90,130,121,146,
+244,92,1,1,153,25,74,119,88,123,146,147,109,89,76,92,246,135,200,222,3,127,
+69,80,62,75,72,60,78,76,253,171,95,56,79,67,66,84,75,252,0,4,0,60,255,206,
+10,242,3,255,0,73,0,85,0,86,0,87,0,0,37,6,6,35,34,39,6,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,36,39,35,53,51,7,4,0,17,
+20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,
+39,55,22,18,21,20,6,35,34,1,38,38,35,34,6,21,20,22,51,50,54,5,33,7,245,50,
+171,121,209,158,52,171,119,95,154,79,71,136,92,141,158,164,125,92,149,123,
+90,117,78,105,111,255,0,233,167,132,6,1,84,1,104,5,80,157,92,105,110,175,
+184,76,211,242,5,80,158,91,105,110,175,184,76,211,242,206,192,208,249,152,
+72,80,51,60,73,80,68,66,91,2,46,4,59,153,90,89,180,90,90,80,91,97,74,169,
+137,130,166,89,159,118,75,134,125,192,247,36,154,11,35,254,190,254,254,38,
+36,98,90,133,126,152,234,85,158,92,254,184,198,42,39,98,91,133,126,152,234,
+85,158,92,254,184,198,206,225,1,42,95,56,79,67,66,84,75,252,0,5,0,60,255,
+206,10,235,3,255,0,70,0,82,0,94,0,95,0,96,0,0,1,50,30,2,21,20,6,35,34,38,
+53,52,55,33,22,22,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,36,39,35,53,51,7,4,0,17,20,7,22,22,51,50,
+54,53,52,38,39,55,35,55,5,6,21,20,22,51,50,54,53,52,38,35,1,38,38,35,34,6,
+21,20,22,51,50,54,5,33,9,57,117,141,114,62,157,132,131,150,44,254,84,122,
+130,208,190,209,158,52,171,119,95,154,79,71,136,92,141,158,164,125,92,149,
+123,90,117,78,105,111,255,0,233,167,132,6,1,84,1,104,5,80,157,92,104,111,
+181,177,1,1,74,3,20,52,75,63,62,70,92,99,248,150,72,80,51,60,73,80,68,66,
+91,2,46,4,59,3,255,25,74,119,88,123,146,147,109,89,76,92,246,135,200,222,
+180,90,90,80,91,97,74,169,137,130,166,89,159,118,75,134,125,192,247,36,154,
+11,35,254,190,254,254,38,36,98,90,130,121,146,244,92,1,154,154,69,80,62,75,
+72,60,78,76,253,171,95,56,79,67,66,84,75,252,0,0,4,0,60,255,206,8,118,3,255,
+0,52,0,64,0,65,0,66,0,0,37,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,
+23,22,22,51,50,54,53,52,38,36,35,35,55,4,0,17,20,7,22,22,51,50,54,53,52,38,
+39,55,22,18,21,20,6,35,34,1,38,38,35,34,6,21,20,22,51,50,54,5,33,5,48,52,
+171,119,95,154,79,71,136,92,141,158,164,125,92,149,123,90,117,78,105,111,
+153,254,229,180,80,149,1,83,1,122,5,80,157,92,105,110,175,185,72,214,244,
+206,192,209,252,94,72,80,51,60,73,80,68,66,91,2,46,4,59,154,90,90,80,91,97,
+74,169,137,130,166,89,159,118,75,134,125,144,215,116,154,21,254,170,254,249,
+38,36,98,90,133,126,154,236,85,144,93,254,185,188,206,225,1,42,95,56,79,67,
+66,84,75,252,0,0,5,0,72,255,206,10,73,3,255,0,0,0,56,0,68,0,69,0,70,0,0,5,
+37,6,6,35,34,38,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,
+54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,
+6,35,34,38,37,50,54,53,52,38,35,34,6,21,20,22,5,1,10,73,252,186,50,171,121,
+114,198,84,70,232,148,244,254,221,136,244,155,157,246,132,18,81,164,97,105,
+110,175,185,69,216,245,5,80,158,91,105,110,175,184,76,211,242,206,192,104,
+184,251,12,172,195,195,172,171,195,193,3,115,2,153,50,203,90,89,107,107,104,
+110,1,24,229,158,249,133,133,246,158,77,69,104,101,133,126,154,236,85,138,
+94,254,191,187,42,39,98,91,133,126,152,234,85,158,92,254,184,198,206,225,
+89,72,192,164,168,203,200,161,168,198,185,3,151,0,4,0,72,255,206,10,73,3,
+255,0,53,0,65,0,66,0,67,0,0,1,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,
+22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,39,6,6,35,34,39,6,6,35,
+34,0,53,52,54,54,51,50,22,22,21,20,1,50,54,53,52,38,35,34,6,21,20,22,5,33,
+4,100,81,164,97,105,110,175,185,72,214,244,5,80,158,91,105,110,175,185,72,
+214,244,206,192,208,159,50,171,121,228,168,70,232,148,244,254,221,136,244,
+155,157,246,132,253,232,172,195,195,172,171,195,193,3,115,5,37,1,84,104,101,
+133,126,154,236,85,144,93,254,185,188,42,39,98,91,133,126,154,236,85,144,
+93,254,185,188,206,225,179,90,89,214,104,110,1,24,229,158,249,133,133,246,
+158,77,254,238,192,164,168,203,200,161,168,198,185,0,5,0,72,255,206,12,190,
+3,255,0,68,0,80,0,92,0,93,0,94,0,0,37,6,6,35,34,39,6,6,35,34,0,53,52,54,54,
+51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,
+50,54,53,52,38,39,55,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,
+6,35,34,1,6,21,20,22,51,50,54,53,52,38,35,1,50,54,53,52,38,35,34,6,21,20,
+22,5,33,7,3,50,171,121,228,168,70,232,148,244,254,221,136,244,155,157,246,
+132,18,81,164,97,105,110,175,185,72,214,244,5,80,158,91,104,111,182,177,75,
+2,210,117,141,114,62,157,132,131,150,44,254,84,122,130,208,190,208,3,172,
+52,75,63,62,70,92,99,246,245,172,195,195,172,171,195,193,3,115,5,37,153,90,
+89,214,104,110,1,24,229,158,249,133,133,246,158,77,69,104,101,133,126,154,
+236,85,144,93,254,185,188,42,39,98,91,130,121,146,245,92,154,25,74,119,88,
+123,146,147,109,89,76,92,246,135,200,222,3,127,69,80,62,75,72,60,78,76,253,
+34,192,164,168,203,200,161,168,198,185,0,4,0,72,255,206,12,197,3,255,0,73,
+0,85,0,86,0,87,0,0,37,6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,
+20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,
+39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,35,34,39,
+6,6,35,34,37,50,54,53,52,38,35,34,6,21,20,22,5,33,7,3,50,171,121,228,168,
+70,232,148,244,254,221,136,244,155,157,246,132,18,81,164,97,105,110,175,185,
+72,214,244,5,80,158,91,105,110,175,184,76,211,242,5,80,158,91,105,110,175,
+184,76,211,242,206,192,208,159,50,171,121,208,250,188,172,195,195,172,171,
+195,193,3,115,5,37,153,90,89,214,104,110,1,24,229,158,249,133,133,246,158,
+77,69,104,101,133,126,154,236,85,144,93,254,185,188,42,39,98,91,133,126,152,
+234,85,158,92,254,184,198,42,39,98,91,133,126,152,234,85,158,92,254,184,198,
+206,225,179,90,89,161,192,164,168,203,200,161,168,198,185,0,0,4,0,72,255,
+206,4,191,3,255,0,14,0,26,0,27,0,28,0,0,1,50,22,22,21,20,6,6,35,34,0,53,52,
+54,54,19,50,54,53,52,38,35,34,6,21,20,22,23,33,2,95,157,246,132,132,243,160,
+244,254,221,136,244,154,173,194,195,172,171,195,193,174,2,96,3,255,133,246,
+158,151,233,128,1,24,229,158,249,133,252,136,195,164,169,206,203,161,170,
+200,185,0,5,0,72,255,206,5,172,3,255,0,30,0,41,0,42,0,43,0,44,0,0,19,22,4,
+51,50,36,53,52,38,39,55,23,22,22,21,16,0,33,32,0,17,52,18,51,50,22,21,20,
+6,35,34,39,22,51,50,54,53,52,38,35,34,6,1,33,1,233,9,1,5,220,230,1,0,145,
+127,60,138,118,127,254,179,254,194,254,205,254,162,217,171,123,148,166,153,
+93,78,71,90,83,84,65,54,78,111,1,209,2,214,253,153,2,16,182,211,195,179,127,
+200,49,99,39,68,228,136,255,0,254,229,1,57,1,7,217,1,0,141,118,133,150,193,
+49,68,63,56,66,105,252,201,3,151,0,0,6,0,60,255,206,5,41,3,255,0,39,0,52,
+0,63,0,64,0,65,0,66,0,0,1,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,
+54,51,50,22,21,20,7,22,23,22,23,54,54,53,52,38,39,55,22,22,21,20,6,37,54,
+54,53,52,38,35,34,6,21,20,22,22,5,6,21,20,22,51,50,54,53,52,38,3,33,1,3,148,
+36,37,167,149,139,168,42,42,190,200,172,142,145,161,135,22,64,64,44,172,177,
+158,146,15,229,229,172,253,37,78,86,75,72,68,80,22,58,1,115,148,81,73,72,
+77,80,89,2,149,253,136,1,75,31,69,38,107,112,110,105,46,74,29,28,163,128,
+104,144,139,105,122,78,3,4,5,9,13,114,95,83,109,15,154,37,180,143,130,169,
+135,22,76,50,52,60,64,49,37,49,45,204,28,84,42,45,45,42,43,58,254,162,1,80,
+0,3,0,60,255,206,5,104,3,255,0,32,0,44,0,45,0,0,37,6,6,35,34,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,38,36,35,35,55,4,0,17,20,6,35,34,38,39,38,
+38,35,34,6,21,20,22,51,50,54,23,2,146,71,136,92,141,158,164,125,92,149,123,
+90,117,78,105,111,153,254,229,180,80,149,1,83,1,122,209,189,95,154,181,72,
+80,51,60,73,80,68,66,91,203,145,97,74,169,137,130,166,89,159,118,75,134,125,
+144,215,116,154,21,254,170,254,249,197,226,80,218,95,56,79,67,66,84,75,252,
+0,4,0,60,255,206,5,177,3,255,0,33,0,45,0,46,0,47,0,0,37,6,6,35,34,38,53,52,
+54,51,50,22,23,22,22,51,50,54,53,52,36,39,35,53,51,7,4,0,17,20,6,35,34,38,
+39,38,38,35,34,6,21,20,22,51,50,54,23,33,2,146,71,136,92,141,158,164,125,
+92,149,123,90,117,78,105,111,255,0,233,167,132,6,1,84,1,104,209,189,95,154,
+181,72,80,51,60,73,80,68,66,91,203,2,217,145,97,74,169,137,130,166,89,159,
+118,75,134,125,192,247,36,154,11,35,254,190,254,254,197,226,80,218,95,56,
+79,67,66,84,75,252,0,0,5,0,60,255,206,4,102,3,255,0,42,0,54,0,55,0,56,0,57,
+0,0,1,54,54,53,52,38,39,55,22,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,54,
+55,38,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,6,6,21,20,22,51,50,
+54,53,52,38,1,33,1,3,7,31,27,67,89,60,125,135,50,49,83,83,174,151,149,165,
+98,126,44,96,51,119,111,33,157,20,24,196,189,92,165,79,112,79,78,74,76,81,
+59,254,235,2,51,254,87,2,146,30,51,30,52,52,16,134,17,123,85,61,108,47,63,
+163,101,131,150,149,120,82,144,87,14,15,79,88,58,72,44,43,106,43,139,159,
+38,208,80,104,54,57,65,71,67,65,111,254,20,3,151,0,5,0,60,254,255,6,39,3,
+255,0,47,0,59,0,60,0,61,0,62,0,0,5,6,6,35,34,38,39,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,7,6,21,
+20,22,51,50,54,55,1,38,38,35,34,6,21,20,22,51,50,54,23,33,1,6,39,65,107,68,
+114,142,9,36,41,98,157,80,71,136,92,141,158,164,125,92,149,123,91,116,83,
+102,109,175,184,76,212,241,68,68,5,53,46,37,60,39,252,102,72,80,51,60,73,
+80,68,66,91,173,2,247,253,42,163,54,40,126,111,6,79,92,97,74,169,137,130,
+166,89,159,120,73,134,125,152,234,85,158,92,254,184,198,118,174,57,17,23,
+51,62,28,33,1,52,95,56,79,67,66,84,75,252,3,151,0,0,7,0,60,254,255,6,39,6,
+244,0,51,0,63,0,64,0,65,0,66,0,67,0,68,0,0,37,6,6,35,34,38,53,52,54,51,50,
+22,23,22,22,51,50,54,53,16,39,39,38,37,55,22,4,23,23,22,17,20,7,6,21,20,22,
+51,50,54,55,23,6,6,35,34,38,39,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,
+54,5,33,11,2,2,146,71,136,92,141,158,164,125,92,149,123,91,116,83,105,106,
+196,17,214,254,220,79,186,1,66,109,23,170,136,5,53,46,37,60,39,97,65,107,
+68,114,142,9,36,41,98,157,182,72,80,51,60,73,80,68,66,91,3,164,253,9,88,179,
+17,145,97,74,169,137,130,166,89,159,120,73,137,138,1,4,241,49,220,115,164,
+79,249,146,53,238,254,223,235,114,17,23,51,62,28,33,127,54,40,126,111,6,79,
+219,95,56,79,67,66,84,75,252,7,38,253,11,1,19,0,0,7,0,60,254,255,6,39,6,244,
+0,51,0,63,0,64,0,65,0,66,0,67,0,68,0,0,37,6,6,35,34,38,53,52,54,51,50,22,
+23,22,22,51,50,54,53,16,3,39,38,37,55,22,4,23,23,18,17,20,7,6,21,20,22,51,
+50,54,55,23,6,6,35,34,38,39,6,35,34,38,39,38,38,35,34,6,21,20,22,51,50,54,
+5,33,11,2,2,146,71,136,92,141,158,164,125,92,149,123,91,116,83,105,106,244,
+17,168,254,222,79,174,1,53,110,25,192,136,5,53,46,37,60,39,97,65,107,68,114,
+142,9,36,41,98,157,182,72,80,51,60,73,80,68,66,91,3,164,253,9,88,179,17,145,
+97,74,169,137,130,166,89,159,120,73,137,138,1,41,1,7,47,162,116,164,73,223,
+128,67,254,248,254,213,235,114,17,23,51,62,28,33,127,54,40,126,111,6,79,219,
+95,56,79,67,66,84,75,252,7,38,253,11,1,19,0,0,5,0,60,255,206,5,157,3,255,
+0,39,0,40,0,41,0,42,0,43,0,0,37,7,38,38,53,52,54,51,50,22,22,23,30,2,51,50,
+54,53,52,38,39,55,22,18,21,20,6,35,34,38,39,38,38,35,34,6,21,20,22,5,33,1,
+1,1,69,166,52,47,157,120,70,103,82,79,72,86,91,58,107,109,175,184,76,212,
+241,207,191,126,184,132,73,69,46,47,61,45,1,189,2,207,253,116,254,227,29,
+56,84,152,83,126,168,44,78,106,98,84,41,134,125,152,234,85,158,92,254,184,
+198,204,227,119,179,98,59,76,60,67,125,151,3,151,252,155,0,7,0,60,255,206,
+5,157,6,244,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,0,1,39,38,37,55,22,4,23,
+23,22,17,20,6,35,34,38,39,38,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,
+22,22,23,30,2,51,50,54,53,16,1,33,1,3,3,19,3,230,17,214,254,220,79,186,1,
+66,109,23,170,207,191,126,184,132,73,69,46,47,61,45,52,166,52,47,157,120,
+70,103,82,79,72,86,91,58,108,108,254,36,2,207,252,197,179,17,86,3,143,49,
+220,115,164,79,249,146,53,238,254,223,204,227,119,179,98,59,76,60,67,125,
+72,56,84,152,83,126,168,44,78,106,98,84,41,134,135,1,11,253,47,7,38,253,11,
+1,19,250,238,0,0,7,0,60,255,206,5,157,6,244,0,44,0,45,0,46,0,47,0,48,0,49,
+0,50,0,0,1,39,38,37,55,22,4,23,23,18,17,20,6,35,34,38,39,38,38,35,34,6,21,
+20,22,23,7,38,38,53,52,54,51,50,22,22,23,30,2,51,50,54,53,16,1,33,37,19,3,
+3,3,182,17,170,254,224,79,174,1,53,110,25,192,207,191,126,184,132,73,69,46,
+47,61,45,52,166,52,47,157,120,70,103,82,79,72,86,91,58,108,108,254,36,2,207,
+252,87,110,179,17,3,202,46,164,115,164,73,223,128,67,254,248,254,213,204,
+227,119,179,98,59,76,60,67,125,72,56,84,152,83,126,168,44,78,106,98,84,41,
+134,135,1,47,253,11,50,6,244,253,11,1,19,0,0,5,0,60,255,206,8,68,3,255,0,
+45,0,57,0,69,0,70,0,71,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,
+20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,
+39,55,5,6,21,20,22,51,50,54,53,52,38,35,1,38,38,35,34,6,21,20,22,51,50,54,
+5,33,6,116,117,141,114,62,157,132,131,150,44,254,84,122,130,205,186,98,157,
+80,71,136,92,141,158,164,125,92,149,123,91,116,83,101,110,181,177,74,3,20,
+52,75,63,62,70,92,99,251,91,72,80,51,60,73,80,68,66,91,2,21,4,34,3,255,25,
+74,119,88,123,146,147,109,89,76,92,246,135,199,223,79,92,97,74,169,137,130,
+166,89,159,120,73,131,120,146,245,92,154,154,69,80,62,75,72,60,78,76,253,
+171,95,56,79,67,66,84,75,252,0,0,2,255,213,3,101,3,153,6,244,0,23,0,24,0,
+0,19,30,2,51,50,54,55,55,54,54,55,23,14,2,7,7,6,6,35,34,38,39,1,127,20,38,
+43,32,40,72,66,63,106,174,129,11,71,88,75,66,47,84,149,93,117,137,37,1,192,
+4,187,77,80,31,50,85,82,139,105,1,158,4,34,65,85,61,109,100,151,136,2,112,
+0,4,2,229,2,11,8,45,6,244,0,15,0,27,0,28,0,29,0,0,1,50,30,2,21,20,6,35,34,
+38,53,52,55,33,53,5,6,21,20,22,51,50,54,53,52,38,35,37,17,6,123,117,141,114,
+62,157,132,131,150,44,252,198,3,216,52,75,63,62,70,92,99,253,15,4,74,25,74,
+119,88,123,146,147,109,89,76,154,154,69,80,62,75,72,60,78,76,79,2,245,0,2,
+0,199,1,192,8,62,3,255,0,15,0,27,0,0,1,50,30,2,21,20,6,35,34,38,53,52,55,
+33,53,5,6,21,20,22,51,50,54,53,52,38,35,6,140,117,141,114,62,157,132,131,
+150,44,250,151,6,7,52,75,63,62,70,92,99,3,255,25,74,119,88,123,146,147,109,
+89,76,154,154,69,80,62,75,72,60,78,76,0,0,6,0,60,252,234,7,179,3,255,0,53,
+0,65,0,66,0,67,0,68,0,69,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,
+50,54,53,52,38,39,55,22,18,21,20,6,7,22,22,51,50,54,53,52,2,39,55,22,0,21,
+16,0,33,34,46,4,39,39,38,39,38,38,35,34,6,21,20,22,51,50,54,23,19,3,3,2,146,
+71,136,92,141,158,164,125,92,149,123,91,116,83,102,109,175,184,76,212,241,
+171,156,78,169,102,183,212,207,199,76,240,1,4,254,220,255,0,57,104,96,93,
+96,100,56,102,27,136,72,80,51,60,73,80,68,66,91,153,85,23,29,145,97,74,169,
+137,130,166,89,159,120,73,134,125,152,234,85,158,92,254,184,198,182,218,20,
+62,60,208,190,203,1,56,89,158,108,254,114,249,254,245,254,213,14,26,42,59,
+80,55,104,25,165,95,56,79,67,66,84,75,252,253,28,2,153,3,226,0,0,7,0,60,252,
+234,7,179,3,255,0,53,0,65,0,69,0,70,0,71,0,72,0,73,0,0,37,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,7,22,22,51,
+50,54,53,52,2,39,55,22,0,21,16,0,33,34,46,4,39,39,38,39,38,38,35,34,6,21,
+20,22,51,50,54,19,19,51,19,39,19,3,3,2,146,71,136,92,141,158,164,125,92,149,
+123,91,116,83,102,109,175,184,76,212,241,171,156,78,169,102,183,212,207,199,
+76,240,1,4,254,220,255,0,57,104,96,93,96,100,56,102,27,136,72,80,51,60,73,
+80,68,66,91,48,15,154,15,79,155,23,29,145,97,74,169,137,130,166,89,159,120,
+73,134,125,152,234,85,158,92,254,184,198,182,218,20,62,60,208,190,203,1,56,
+89,158,108,254,114,249,254,245,254,213,14,26,42,59,80,55,104,25,165,95,56,
+79,67,66,84,75,254,53,1,34,254,222,207,253,28,2,153,3,226,0,0,5,0,60,252,
+234,7,179,3,255,0,60,0,72,0,73,0,74,0,75,0,0,37,6,6,35,34,38,53,52,54,51,
+50,22,23,22,22,51,50,54,53,52,38,36,35,35,55,4,0,17,20,6,7,22,22,51,50,54,
+53,52,2,39,55,22,0,21,16,0,33,34,39,38,39,38,39,38,39,38,39,38,39,39,38,39,
+38,38,35,34,6,21,20,22,51,50,54,23,19,3,2,146,71,136,92,141,158,164,125,92,
+149,123,90,117,78,105,111,153,254,229,180,80,149,1,83,1,122,169,157,78,168,
+102,183,212,207,199,76,240,1,4,254,220,255,0,58,53,53,49,48,47,48,48,50,49,
+53,57,96,30,128,72,80,51,60,73,80,68,66,91,153,85,23,145,97,74,169,137,130,
+166,89,159,118,75,134,125,144,215,116,154,21,254,170,254,249,175,217,20,61,
+61,208,190,203,1,56,89,158,108,254,114,249,254,245,254,213,7,7,14,14,21,22,
+30,31,41,42,57,99,28,157,95,56,79,67,66,84,75,252,253,28,2,153,0,0,7,0,60,
+252,234,10,90,3,255,0,68,0,80,0,92,0,93,0,94,0,95,0,96,0,0,37,6,6,35,34,38,
+53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,18,21,20,6,7,22,22,
+51,50,54,53,52,2,39,55,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,18,21,16,
+0,33,34,46,4,39,39,38,1,6,21,20,22,51,50,54,53,52,38,35,1,38,38,35,34,6,21,
+20,22,51,50,54,23,33,1,3,2,146,71,136,92,141,158,164,125,92,149,123,91,116,
+83,102,109,175,184,76,212,241,171,156,78,169,102,183,212,208,197,74,2,234,
+117,141,114,62,157,132,131,150,44,254,78,138,143,254,220,255,0,57,104,96,
+93,96,100,56,102,27,6,54,52,75,63,62,70,92,99,249,39,72,80,51,60,73,80,68,
+66,91,153,5,86,250,255,23,145,97,74,169,137,130,166,89,159,120,73,134,125,
+152,234,85,158,92,254,184,198,182,218,20,62,60,208,190,206,1,58,88,154,25,
+74,119,88,123,146,147,109,89,76,109,254,203,183,254,245,254,213,14,26,42,
+59,80,55,104,25,2,250,69,80,62,75,72,60,78,76,253,171,95,56,79,67,66,84,75,
+252,253,28,2,153,0,8,0,60,252,234,10,90,3,255,0,68,0,80,0,92,0,96,0,97,0,
+98,0,99,0,100,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,
+52,38,39,55,22,18,21,20,6,7,22,22,51,50,54,53,52,2,39,55,33,50,30,2,21,20,
+6,35,34,38,53,52,55,33,22,18,21,16,0,33,34,46,4,39,39,38,1,6,21,20,22,51,
+50,54,53,52,38,35,1,38,38,35,34,6,21,20,22,51,50,54,19,19,51,19,39,33,1,3,
+2,146,71,136,92,141,158,164,125,92,149,123,91,116,83,102,109,175,184,76,212,
+241,171,156,78,169,102,183,212,208,197,74,2,234,117,141,114,62,157,132,131,
+150,44,254,78,138,143,254,220,255,0,57,104,96,93,96,100,56,102,27,6,54,52,
+75,63,62,70,92,99,249,39,72,80,51,60,73,80,68,66,91,48,15,154,15,79,5,86,
+251,39,23,145,97,74,169,137,130,166,89,159,120,73,134,125,152,234,85,158,
+92,254,184,198,182,218,20,62,60,208,190,206,1,58,88,154,25,74,119,88,123,
+146,147,109,89,76,109,254,203,183,254,245,254,213,14,26,42,59,80,55,104,25,
+2,250,69,80,62,75,72,60,78,76,253,171,95,56,79,67,66,84,75,254,54,1,33,254,
+223,206,253,28,2,153,0,7,0,60,252,234,10,90,3,255,0,75,0,87,0,99,0,100,0,
+101,0,102,0,103,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,
+52,38,36,35,35,55,4,0,17,20,6,7,22,22,51,50,54,53,52,2,39,55,33,50,30,2,21,
+20,6,35,34,38,53,52,55,33,22,18,21,16,0,33,34,39,38,39,38,39,38,39,38,39,
+38,39,39,38,1,6,21,20,22,51,50,54,53,52,38,35,1,38,38,35,34,6,21,20,22,51,
+50,54,23,33,1,3,2,146,71,136,92,141,158,164,125,92,149,123,90,117,78,105,
+111,153,254,229,180,80,149,1,83,1,122,169,157,78,168,102,183,212,208,197,
+74,2,234,117,141,114,62,157,132,131,150,44,254,78,138,143,254,220,255,0,58,
+53,53,49,48,47,48,48,50,49,53,57,96,30,6,62,52,75,63,62,70,92,99,249,39,72,
+80,51,60,73,80,68,66,91,153,5,86,250,255,23,145,97,74,169,137,130,166,89,
+159,118,75,134,125,144,215,116,154,21,254,170,254,249,175,217,20,61,61,208,
+190,206,1,58,88,154,25,74,119,88,123,146,147,109,89,76,109,254,203,183,254,
+245,254,213,7,7,14,14,21,22,30,31,41,42,57,99,28,2,242,69,80,62,75,72,60,
+78,76,253,171,95,56,79,67,66,84,75,252,253,28,2,153,0,3,0,199,1,253,7,232,
+4,60,0,32,0,44,0,45,0,0,19,53,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,
+21,20,6,6,35,35,53,51,50,54,53,52,38,38,35,33,6,21,20,22,51,50,54,53,52,38,
+35,37,199,5,111,117,141,114,62,157,132,131,150,44,253,184,21,58,146,152,134,
+137,116,69,37,68,73,4,43,52,75,63,62,70,92,99,250,252,3,162,154,25,74,119,
+88,123,146,147,109,89,76,46,59,59,110,71,154,51,42,35,46,17,69,80,62,75,72,
+60,78,76,93,0,2,0,23,3,55,6,36,5,118,0,33,0,45,0,0,19,53,33,50,30,2,21,20,
+6,35,34,38,53,52,55,33,22,21,20,6,6,35,35,53,51,50,54,54,53,52,38,38,35,33,
+6,21,20,22,51,50,54,53,52,38,35,23,4,91,117,141,114,62,157,132,131,150,44,
+254,249,21,59,149,148,184,187,79,71,35,41,69,68,2,234,52,75,63,62,70,92,99,
+4,220,154,25,74,119,88,123,146,147,109,89,76,50,64,66,120,75,154,23,49,36,
+42,54,17,69,80,62,75,72,60,78,76,0,0,2,251,255,3,55,2,92,5,118,0,33,0,45,
+0,0,1,53,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,21,20,6,6,35,35,53,51,
+50,54,54,53,52,38,38,35,33,6,21,20,22,51,50,54,53,52,38,35,251,255,4,171,
+117,141,114,62,157,132,131,150,44,254,219,21,59,149,148,214,217,79,71,35,
+41,69,68,3,8,52,75,63,62,70,92,99,4,220,154,25,74,119,88,123,146,147,109,
+89,76,50,64,66,120,75,154,23,49,36,42,54,17,69,80,62,75,72,60,78,76,0,2,0,
+27,3,55,5,181,5,118,0,33,0,45,0,0,19,53,33,50,30,2,21,20,6,35,34,38,53,52,
+55,33,22,21,20,6,6,35,35,53,51,50,54,54,53,52,38,38,35,33,6,21,20,22,51,50,
+54,53,52,38,35,27,3,232,117,141,114,62,157,132,131,150,44,254,249,21,59,149,
+148,184,187,79,71,35,41,69,68,2,234,52,75,63,62,70,92,99,4,220,154,25,74,
+119,88,123,146,147,109,89,76,50,64,66,120,75,154,23,49,36,42,54,17,69,80,
+62,75,72,60,78,76,0,0,2,0,29,3,55,5,93,5,118,0,33,0,45,0,0,19,53,33,50,30,
+2,21,20,6,35,34,38,53,52,55,33,22,21,20,6,6,35,35,53,51,50,54,54,53,52,38,
+38,35,33,6,21,20,22,51,50,54,53,52,38,35,29,3,142,117,141,114,62,157,132,
+131,150,44,254,249,21,59,149,148,184,187,79,71,35,41,69,68,2,234,52,75,63,
+62,70,92,99,4,220,154,25,74,119,88,123,146,147,109,89,76,50,64,66,120,75,
+154,23,49,36,42,54,17,69,80,62,75,72,60,78,76,0,0,2,251,205,3,55,2,92,5,118,
+0,33,0,45,0,0,1,53,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,21,20,6,6,35,
+35,53,51,50,54,54,53,52,38,38,35,33,6,21,20,22,51,50,54,53,52,38,35,251,205,
+4,221,117,141,114,62,157,132,131,150,44,254,219,21,59,149,148,214,217,79,
+71,35,41,69,68,3,8,52,75,63,62,70,92,99,4,220,154,25,74,119,88,123,146,147,
+109,89,76,50,64,66,120,75,154,23,49,36,42,54,17,69,80,62,75,72,60,78,76,0,
+3,0,137,1,253,8,6,4,60,0,39,0,51,0,52,0,0,19,38,53,52,54,51,51,50,22,23,54,
+54,51,33,50,30,2,21,20,6,35,34,38,53,52,55,33,34,7,35,38,38,35,35,34,6,21,
+20,23,37,6,21,20,22,51,50,54,53,52,38,35,37,173,36,170,134,17,104,130,44,
+44,146,116,2,67,117,140,114,62,159,130,132,149,43,254,9,178,29,159,15,105,
+71,8,77,76,25,5,76,53,75,63,62,70,92,99,254,98,2,149,83,81,112,147,78,79,
+84,73,25,75,118,88,123,146,149,107,84,81,191,90,101,66,65,51,42,224,70,79,
+62,75,72,60,78,76,93,0,4,0,137,1,253,8,94,6,244,0,53,0,65,0,66,0,67,0,0,19,
+38,53,52,54,51,51,50,22,23,54,54,51,33,38,53,52,54,51,50,22,23,7,38,35,34,
+6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,33,34,7,35,38,38,35,35,34,6,21,
+20,23,37,6,21,20,22,51,50,54,53,52,38,35,37,17,173,36,170,134,17,104,130,
+44,44,146,116,2,7,10,161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,
+132,149,43,254,9,178,29,159,15,105,71,8,77,76,25,5,76,53,75,63,62,70,92,99,
+254,98,2,149,83,81,112,147,78,79,84,73,32,44,104,126,93,103,40,101,61,51,
+37,25,7,155,141,123,146,149,107,84,81,191,90,101,66,65,51,42,224,70,79,62,
+75,72,60,78,76,93,2,245,0,0,2,252,181,3,91,2,92,5,154,0,43,0,55,0,0,1,35,
+34,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,
+55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,1,6,21,20,22,51,50,54,53,52,
+38,35,254,35,35,153,178,173,131,17,104,130,44,44,146,116,109,117,140,114,
+62,159,130,132,149,43,33,178,29,159,15,105,71,8,73,80,81,84,33,2,201,53,75,
+63,62,70,92,99,3,101,156,136,119,154,78,79,84,73,25,75,118,88,123,146,149,
+107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,0,3,252,181,
+3,91,2,180,6,244,0,57,0,69,0,70,0,0,1,35,34,38,53,52,54,51,51,50,22,23,54,
+54,51,51,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,
+38,53,52,55,35,34,7,35,38,38,35,35,34,6,21,20,22,51,51,1,6,21,20,22,51,50,
+54,53,52,38,35,3,254,35,35,153,178,173,131,17,104,130,44,44,146,116,49,10,
+161,128,113,149,40,156,37,106,61,77,16,161,172,159,130,132,149,43,33,178,
+29,159,15,105,71,8,73,80,81,84,33,2,201,53,75,63,62,70,92,99,63,3,101,156,
+136,119,154,78,79,84,73,32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,
+123,146,149,107,84,81,191,90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,
+1,244,0,2,252,41,3,91,2,92,5,154,0,43,0,55,0,0,1,35,34,38,53,52,54,51,51,
+50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,55,35,34,7,35,38,38,35,
+35,34,6,21,20,22,51,51,1,6,21,20,22,51,50,54,53,52,38,35,253,200,84,153,178,
+173,131,62,104,130,44,44,146,116,204,117,140,114,62,159,130,132,149,43,128,
+178,29,159,15,105,71,53,73,80,81,84,81,3,37,53,75,63,62,70,92,99,3,101,156,
+136,119,154,78,79,84,73,25,75,118,88,123,146,149,107,84,81,191,90,101,67,
+58,68,64,1,1,70,79,62,75,72,60,78,76,0,3,252,41,3,91,2,180,6,244,0,57,0,69,
+0,70,0,0,1,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,
+22,23,7,38,35,34,6,21,20,23,22,22,21,20,6,35,34,38,53,52,55,35,34,7,35,38,
+38,35,35,34,6,21,20,22,51,51,1,6,21,20,22,51,50,54,53,52,38,35,3,253,200,
+84,153,178,173,131,62,104,130,44,44,146,116,144,10,161,128,113,149,40,156,
+37,106,61,77,16,161,172,159,130,132,149,43,128,178,29,159,15,105,71,53,73,
+80,81,84,81,3,37,53,75,63,62,70,92,99,63,3,101,156,136,119,154,78,79,84,73,
+32,44,104,126,93,103,40,101,61,51,37,25,7,155,141,123,146,149,107,84,81,191,
+90,101,67,58,68,64,1,1,70,79,62,75,72,60,78,76,1,244,0,1,255,226,3,101,3,
+37,5,118,0,23,0,0,3,53,33,50,30,2,21,20,14,2,35,35,53,51,50,54,54,53,52,38,
+38,35,30,1,202,121,127,86,43,48,94,127,108,113,137,79,71,35,41,69,68,4,220,
+154,32,70,95,69,60,109,66,28,154,23,49,36,42,54,17,0,0,1,252,2,3,101,255,
+144,5,118,0,23,0,0,1,53,33,50,30,2,21,20,14,2,35,35,53,51,50,54,54,53,52,
+38,38,35,252,2,2,21,121,127,86,43,48,94,127,108,133,157,79,71,35,41,69,68,
+4,220,154,32,70,95,69,60,109,66,28,154,23,49,36,42,54,17,0,1,251,188,3,101,
+255,144,5,118,0,23,0,0,1,53,33,50,30,2,21,20,14,2,35,35,53,51,50,54,54,53,
+52,38,38,35,251,188,2,91,121,127,86,43,48,94,127,108,133,157,79,71,35,41,
+69,68,4,220,154,32,70,95,69,60,109,66,28,154,23,49,36,42,54,17,0,1,251,28,
+3,101,255,177,5,118,0,23,0,0,1,53,33,50,30,2,21,20,14,2,35,35,53,51,50,54,
+54,53,52,38,38,35,251,28,3,28,121,127,86,43,48,94,127,108,206,230,79,71,35,
+41,69,68,4,220,154,32,70,95,69,60,109,66,28,154,23,49,36,42,54,17,0,1,251,
+138,3,101,0,28,5,118,0,23,0,0,1,53,33,50,30,2,21,20,14,2,35,35,53,33,50,54,
+54,53,52,38,38,35,251,138,3,25,121,127,86,43,48,94,127,108,253,1,21,79,71,
+35,41,69,68,4,220,154,32,70,95,69,60,109,66,28,154,23,49,36,42,54,17,0,0,
+1,252,130,3,101,255,197,5,118,0,23,0,0,1,53,33,50,30,2,21,20,14,2,35,35,53,
+51,50,54,54,53,52,38,38,35,252,130,1,202,121,127,86,43,48,94,127,108,206,
+230,79,71,35,41,69,68,4,220,154,32,70,95,69,60,109,66,28,154,23,49,36,42,
+54,17,0,2,255,226,3,101,3,121,6,244,0,37,0,38,0,0,3,53,33,38,53,52,54,51,
+50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,14,2,35,35,53,51,50,54,54,53,52,
+38,38,35,3,30,1,82,10,161,128,113,149,40,156,37,106,61,77,15,174,164,48,94,
+127,108,113,137,79,71,35,41,69,68,59,4,220,154,32,44,104,126,93,103,40,101,
+61,51,33,27,1,136,128,60,109,66,28,154,23,49,36,42,54,17,2,24,0,0,2,252,2,
+3,101,255,228,6,244,0,37,0,38,0,0,1,53,33,38,53,52,54,51,50,22,23,7,38,35,
+34,6,21,20,23,22,22,21,20,14,2,35,35,53,51,50,54,54,53,52,38,38,35,19,252,
+2,1,157,10,161,128,113,149,40,156,37,106,61,77,16,175,162,48,94,127,108,133,
+157,79,71,35,41,69,68,158,4,220,154,40,36,104,126,93,103,40,101,61,51,31,
+29,1,137,127,60,109,66,28,154,23,49,36,42,54,17,2,24,0,2,251,188,3,101,255,
+228,6,244,0,37,0,38,0,0,1,53,33,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,
+23,22,22,21,20,14,2,35,35,53,51,50,54,54,53,52,38,38,35,19,251,188,1,227,
+10,161,128,113,149,40,156,37,106,61,77,16,175,162,48,94,127,108,133,157,79,
+71,35,41,69,68,128,4,220,154,40,36,104,126,93,103,40,101,61,51,31,29,1,137,
+127,60,109,66,28,154,23,49,36,42,54,17,2,24,0,2,251,28,3,101,0,5,6,244,0,
+37,0,38,0,0,1,53,33,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,
+20,14,2,35,35,53,51,50,54,54,53,52,38,38,35,19,251,28,2,164,10,161,128,113,
+149,40,156,37,106,61,77,16,175,162,48,94,127,108,206,230,79,71,35,41,69,68,
+125,4,220,154,40,36,104,126,93,103,40,101,61,51,31,29,1,137,127,60,109,66,
+28,154,23,49,36,42,54,17,2,24,0,2,251,138,3,101,0,112,6,244,0,37,0,38,0,0,
+1,53,33,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,14,2,35,
+35,53,33,50,54,54,53,52,38,38,35,19,251,138,2,162,11,161,128,113,149,40,156,
+37,106,61,77,16,175,162,48,94,127,108,253,1,21,79,71,35,41,69,68,118,4,220,
+154,36,40,104,126,93,103,40,101,61,51,31,29,1,137,127,60,109,66,28,154,23,
+49,36,42,54,17,2,24,0,0,2,252,130,3,101,0,25,6,244,0,37,0,38,0,0,1,53,33,
+38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,22,22,21,20,14,2,35,35,53,51,
+50,54,54,53,52,38,38,35,19,252,130,1,83,11,161,128,113,149,40,156,37,106,
+61,77,16,175,162,48,94,127,108,206,230,79,71,35,41,69,68,105,4,220,154,36,
+40,104,126,93,103,40,101,61,51,31,29,1,137,127,60,109,66,28,154,23,49,36,
+42,54,17,2,24,0,3,251,212,252,234,255,229,255,131,0,15,0,27,0,28,0,0,1,34,
+46,2,53,52,54,51,50,22,21,20,7,33,21,37,54,53,52,38,35,34,6,21,20,22,51,1,
+253,134,121,144,110,59,152,122,124,142,41,2,30,253,79,46,69,62,59,66,98,101,
+1,68,253,117,25,70,106,79,110,136,132,97,75,68,154,154,57,63,53,64,61,48,
+66,62,254,219,0,3,250,238,252,234,255,239,255,131,0,15,0,27,0,28,0,0,1,34,
+46,2,53,52,54,51,50,22,21,20,7,33,21,37,54,53,52,38,35,34,6,21,20,22,51,1,
+252,160,121,144,110,59,152,122,124,142,41,3,14,252,95,46,69,62,59,66,98,101,
+2,42,253,117,25,70,106,79,110,136,132,97,75,68,154,154,57,63,53,64,61,48,
+66,62,254,219,0,3,250,58,252,234,255,199,255,131,0,15,0,27,0,28,0,0,1,34,
+46,2,53,52,54,51,50,22,21,20,7,33,21,37,54,53,52,38,35,34,6,21,20,22,51,1,
+251,236,121,144,110,59,152,122,124,142,41,3,154,251,211,46,69,62,59,66,98,
+101,2,222,253,117,25,70,106,79,110,136,132,97,75,68,154,154,57,63,53,64,61,
+48,66,62,254,219,0,4,0,62,255,230,7,181,3,255,0,34,0,46,0,47,0,48,0,0,1,50,
+23,54,54,53,52,38,35,34,6,7,39,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,
+38,53,52,54,55,33,53,5,6,6,21,20,22,51,50,54,53,52,38,1,17,6,3,95,53,56,56,
+52,49,43,71,44,147,110,191,117,142,55,54,64,65,157,132,130,151,32,33,250,
+130,6,67,56,56,73,65,62,70,79,251,143,2,112,7,30,69,39,44,54,46,66,58,189,
+120,101,58,100,41,38,124,85,122,144,145,103,51,87,35,148,150,31,80,49,58,
+66,72,60,69,76,2,44,251,231,0,2,0,40,3,55,5,217,5,118,0,33,0,45,0,0,19,53,
+33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,21,20,6,6,35,35,53,51,50,54,54,
+53,52,38,38,35,33,6,21,20,22,51,50,54,53,52,38,35,40,3,255,117,141,114,62,
+157,132,131,150,44,254,218,21,62,150,144,174,177,79,71,35,41,69,68,3,9,52,
+75,63,62,70,92,99,4,220,154,25,74,119,88,123,146,147,109,89,76,49,62,66,117,
+71,144,23,49,36,42,54,17,69,80,62,75,72,60,78,76,0,0,5,0,37,252,234,4,155,
+0,0,0,46,0,47,0,48,0,49,0,50,0,0,5,22,21,20,6,7,22,51,50,55,23,6,35,34,38,
+39,6,35,34,38,39,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,51,22,22,
+51,50,54,53,52,39,39,17,1,5,3,248,12,27,26,5,82,40,36,41,63,73,75,102,20,
+36,44,77,113,44,45,111,77,120,142,10,144,8,66,60,62,81,11,139,11,83,65,56,
+66,8,229,254,175,2,241,10,47,68,53,93,39,86,16,132,29,70,69,11,71,78,81,68,
+156,132,72,39,17,21,62,72,82,89,85,85,89,83,73,54,28,30,252,234,2,19,128,
+0,5,0,11,252,66,4,28,0,0,0,15,0,27,0,28,0,29,0,30,0,0,1,34,46,2,53,52,54,
+51,50,22,21,20,7,33,21,37,54,53,52,38,35,34,6,21,20,22,51,1,19,17,1,189,121,
+144,110,59,152,122,124,142,41,2,30,253,79,46,69,62,59,66,98,101,2,15,47,252,
+66,25,70,106,79,110,136,132,97,75,68,154,154,57,63,53,64,61,48,66,62,1,135,
+1,157,252,234,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,
+32,0,94,0,3,0,1,4,9,0,2,0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,
+0,4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,
+1,4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,
+0,3,0,1,4,9,0,10,0,96,1,162,0,3,0,1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,
+60,2,64,0,3,0,1,4,9,0,13,2,150,2,124,0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,
+0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,
+0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,
+0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,
+0,115,0,32,0,84,0,101,0,108,0,117,0,103,0,117,0,82,0,101,0,103,0,117,0,108,
+0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,
+0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,
+83,0,97,0,110,0,115,0,32,0,84,0,101,0,108,0,117,0,103,0,117,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,104,0,78,
+0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,84,0,101,0,108,0,117,0,103,0,117,
+0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,
+100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,
+110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,
+97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,
+0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,
+119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,
+0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,
+0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,
+0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,
+0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,
+0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,
+0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,
+0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,
+0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,
+0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,
+0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,
+0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,
+0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,
+76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,
+0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,
+0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,
+0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,
+0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,
+0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,
+0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,
+0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,
+0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,3,0,0,0,0,
+0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,
+255,255,0,3,0,1,0,0,0,12,0,88,0,0,6,248,0,2,0,12,0,3,0,56,0,1,0,57,0,69,0,
+3,0,70,0,70,0,1,0,71,0,72,0,3,0,73,0,76,0,1,0,77,0,78,0,3,0,98,0,101,0,1,
+0,102,1,213,0,2,1,214,1,239,0,3,1,240,1,240,0,2,1,241,2,98,0,3,2,99,2,99,
+0,1,3,116,1,184,5,204,5,156,5,126,5,132,5,138,5,144,5,150,4,168,5,252,5,54,
+5,168,5,174,5,180,5,192,5,186,5,192,5,198,5,204,5,210,5,144,4,184,4,188,5,
+228,5,234,5,234,3,216,5,246,5,252,5,144,6,8,4,164,5,180,5,168,5,204,5,252,
+6,60,4,100,4,156,6,64,4,196,4,76,3,222,3,226,4,216,6,52,4,104,6,156,4,208,
+4,172,6,144,3,234,4,176,6,60,4,180,4,140,4,184,4,188,6,132,3,234,4,68,3,230,
+4,200,4,216,6,52,3,234,6,108,3,238,4,212,6,60,4,216,5,252,3,242,3,248,5,30,
+5,138,5,138,3,254,4,4,5,48,5,54,4,46,4,10,5,156,4,16,4,22,4,226,5,156,5,240,
+5,252,5,132,5,216,4,40,4,28,5,90,4,34,5,90,4,40,5,12,5,138,4,46,4,52,4,58,
+6,8,5,150,4,64,6,60,4,124,4,188,6,64,4,196,6,124,6,72,4,68,4,72,6,52,4,212,
+4,172,4,208,4,172,6,144,6,100,4,76,4,192,6,120,4,80,4,184,4,188,4,96,4,104,
+4,96,4,136,4,84,4,216,6,120,4,88,4,136,6,108,4,212,6,60,4,216,6,60,4,92,6,
+124,6,64,4,196,6,128,4,96,6,140,4,100,6,52,4,212,4,108,4,208,4,172,6,144,
+4,112,4,104,6,144,4,108,4,168,4,184,4,188,4,124,4,112,4,116,5,84,4,196,4,
+216,4,120,4,124,4,128,4,132,4,212,6,60,4,216,6,20,4,136,4,216,4,140,4,144,
+5,90,5,12,4,150,6,60,4,168,4,156,6,64,4,196,4,160,4,164,4,168,4,216,6,52,
+4,212,6,156,4,208,4,172,6,144,4,172,4,176,6,60,4,180,6,136,4,184,4,188,4,
+192,6,120,6,120,4,196,4,200,4,216,6,136,6,124,4,204,4,208,4,212,6,60,4,216,
+6,60,4,168,4,156,6,64,4,196,4,160,4,164,4,168,4,216,6,52,4,212,6,156,4,208,
+4,172,6,144,4,172,4,176,6,60,4,180,6,136,4,184,4,188,4,192,6,120,6,120,4,
+196,4,200,4,216,6,136,6,124,4,204,4,208,4,212,6,60,4,216,5,204,4,220,5,126,
+4,226,5,138,5,84,5,48,5,96,4,232,5,54,5,120,5,174,5,180,5,192,5,186,4,238,
+5,198,5,204,5,210,5,90,6,20,4,244,4,250,5,0,5,6,5,6,5,246,5,252,5,12,6,38,
+5,12,6,26,5,18,5,222,5,252,5,204,5,24,5,126,5,30,5,138,5,36,5,120,5,42,5,
+48,5,54,5,60,5,174,5,180,5,192,5,186,5,66,5,198,5,204,5,210,5,72,6,38,5,162,
+5,78,5,114,5,84,5,90,5,246,5,252,5,102,5,96,5,102,5,108,5,114,5,120,5,252,
+5,204,5,156,5,126,5,132,5,138,5,144,5,150,5,156,5,252,5,162,5,168,5,174,5,
+180,5,192,5,186,5,192,5,198,5,204,5,210,6,2,5,216,5,222,5,228,5,234,5,234,
+5,240,5,246,5,252,6,2,6,8,6,14,6,20,6,26,6,32,6,38,6,144,6,44,6,124,6,48,
+6,144,6,124,6,52,6,148,6,152,6,148,6,84,6,56,6,80,6,148,6,152,6,60,6,64,6,
+156,6,68,6,72,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,
+6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,
+6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,76,6,80,6,80,6,80,6,84,6,84,6,88,
+6,92,6,96,6,100,6,104,6,108,6,144,6,112,6,116,6,120,6,120,6,124,6,128,6,132,
+6,136,6,140,6,144,6,148,6,148,6,152,6,156,0,2,0,16,0,21,0,55,0,0,0,102,0,
+136,0,35,0,138,0,172,0,70,0,174,0,208,0,105,0,210,0,244,0,140,0,246,1,32,
+0,175,1,34,1,68,0,218,1,106,1,140,0,253,1,142,1,176,1,32,1,178,1,212,1,67,
+1,215,1,218,1,102,1,221,1,232,1,106,1,241,1,242,1,118,1,246,1,246,1,120,1,
+248,1,248,1,121,2,37,2,98,1,122,0,2,0,0,0,69,0,1,0,79,0,1,0,113,0,1,0,98,
+0,1,0,96,0,1,0,88,0,2,0,108,0,109,0,2,0,53,0,54,0,2,0,73,0,74,0,2,0,102,0,
+103,0,2,0,63,0,64,0,2,0,85,0,86,0,2,0,103,0,104,0,2,0,89,0,90,0,2,0,94,0,
+95,0,2,0,52,0,53,0,2,0,88,0,89,0,2,0,71,0,72,0,2,0,80,0,81,0,1,0,110,0,1,
+0,97,0,1,0,91,0,1,0,75,0,1,0,63,0,1,0,48,0,1,0,85,0,1,0,121,0,1,0,86,0,1,
+0,112,0,1,0,90,0,1,0,80,0,1,0,107,0,1,0,104,0,1,0,83,0,1,0,103,0,1,0,84,0,
+1,0,95,0,1,0,66,0,1,0,73,0,2,0,126,0,127,0,2,0,100,0,101,0,1,0,26,0,1,0,41,
+0,1,0,45,0,1,0,81,0,1,0,59,0,1,0,54,0,1,0,44,0,1,0,43,0,1,0,47,0,1,0,61,0,
+1,0,69,0,1,0,27,0,1,0,46,0,1,0,55,0,1,0,60,0,1,0,70,0,2,0,134,0,135,0,2,0,
+87,0,88,0,2,0,90,0,91,0,2,0,115,0,116,0,2,0,105,0,106,0,2,0,114,0,115,0,2,
+0,118,0,119,0,2,0,86,0,87,0,2,0,97,0,98,0,2,0,117,0,118,0,2,0,147,0,148,0,
+2,0,96,0,97,0,2,0,109,0,110,0,2,0,144,0,145,0,2,0,99,0,100,0,2,0,74,0,75,
+0,2,0,127,0,128,0,2,0,129,0,130,0,2,0,107,0,108,0,2,0,128,0,129,0,2,0,95,
+0,96,0,2,0,93,0,94,0,2,0,130,0,131,0,2,0,111,0,112,0,2,0,124,0,125,0,2,0,
+132,0,133,0,2,0,113,0,114,0,2,0,26,0,27,0,2,0,67,0,68,0,2,0,69,0,70,0,2,0,
+41,0,42,0,2,0,45,0,46,0,2,0,81,0,82,0,2,0,120,0,121,0,2,0,60,0,61,0,2,0,38,
+0,39,0,2,0,55,0,56,0,2,0,76,0,77,0,2,0,59,0,60,0,2,0,54,0,55,0,2,0,40,0,41,
+0,2,0,44,0,45,0,2,0,48,0,49,0,2,0,98,0,99,0,2,0,61,0,62,0,2,0,65,0,66,0,2,
+0,66,0,67,0,2,0,27,0,28,0,2,0,70,0,71,0,2,0,42,0,43,0,2,0,64,0,65,0,2,0,46,
+0,47,0,2,0,101,0,102,0,2,0,110,0,111,0,2,0,91,0,92,0,2,0,116,0,117,0,1,0,
+23,0,1,0,62,0,1,0,74,0,1,0,72,0,1,0,40,0,1,0,67,0,1,0,58,0,1,0,68,0,1,0,14,
+0,1,0,28,0,1,0,57,0,1,0,56,0,1,0,108,0,1,0,50,0,1,0,89,0,1,0,102,0,1,0,77,
+0,1,0,94,0,1,0,78,0,1,0,65,0,1,0,64,0,1,0,82,0,1,0,92,0,1,0,42,0,1,0,115,
+0,1,0,76,0,1,0,53,0,1,0,36,0,1,0,38,0,2,0,14,0,60,0,63,0,2,0,77,0,78,0,1,
+1,214,1,214,0,2,1,215,1,218,0,1,1,219,1,220,0,2,1,221,1,232,0,1,1,233,1,239,
+0,2,1,241,1,242,0,1,1,243,1,245,0,2,1,246,1,246,0,1,1,247,1,247,0,2,1,248,
+1,248,0,1,1,249,2,36,0,2,2,37,2,98,0,1,0,1,0,0,0,10,0,54,0,124,0,2,116,101,
+108,50,0,14,116,101,108,117,0,18,0,8,0,0,0,16,0,0,0,0,255,255,0,3,0,0,0,2,
+0,3,0,0,255,255,0,2,0,0,0,1,0,4,98,108,119,109,0,26,100,105,115,116,0,34,
+100,105,115,116,0,50,107,101,114,110,0,64,0,0,0,2,0,29,0,30,0,0,0,6,0,0,0,
+1,0,2,0,3,0,7,0,8,0,0,0,5,0,1,0,2,0,3,0,7,0,8,0,0,0,1,0,0,0,31,0,64,6,202,
+12,98,18,238,19,202,20,36,20,126,20,216,21,64,23,96,23,118,23,140,23,162,
+23,184,23,206,23,228,23,250,24,16,24,38,24,60,24,82,24,104,24,126,24,148,
+24,180,24,212,24,244,25,20,25,76,25,132,42,40,0,2,2,0,0,1,0,8,0,2,1,96,0,
+4,0,0,1,238,2,250,0,8,0,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,206,0,0,0,0,0,0,0,0,0,0,255,193,0,0,0,22,0,0,255,193,255,183,0,0,
+0,0,0,0,0,14,255,183,0,0,255,193,0,14,0,0,0,0,255,216,255,236,255,206,0,0,
+255,202,0,0,255,226,255,116,255,216,0,0,0,0,255,216,0,0,255,216,0,0,0,0,255,
+206,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,22,0,0,255,193,255,
+183,0,0,0,0,0,0,0,35,255,183,0,0,0,0,0,14,0,0,0,100,255,56,255,192,255,176,
+255,123,255,98,255,205,255,185,255,188,255,126,255,176,255,106,255,146,255,
+186,255,196,0,40,255,166,255,176,0,0,0,0,0,2,0,23,0,21,0,21,0,0,0,44,0,44,
+0,1,0,50,0,50,0,2,0,52,0,52,0,3,0,55,0,55,0,4,0,61,0,61,0,5,0,63,0,63,0,6,
+0,75,0,76,0,7,0,136,0,136,0,9,0,138,0,173,0,10,0,208,0,208,0,46,0,235,0,235,
+0,47,0,244,0,244,0,48,0,246,0,246,0,49,0,250,0,253,0,50,1,32,1,32,0,54,1,
+68,1,68,0,55,1,104,1,104,0,56,1,106,1,108,0,57,1,110,1,113,0,60,1,115,1,129,
+0,64,1,132,1,214,0,79,1,252,1,254,0,162,0,2,0,44,0,21,0,21,0,3,0,44,0,44,
+0,2,0,50,0,50,0,1,0,52,0,52,0,1,0,55,0,55,0,4,0,61,0,61,0,4,0,63,0,63,0,4,
+0,75,0,76,0,4,0,136,0,136,0,4,0,138,0,171,0,4,0,172,0,172,0,6,0,173,0,173,
+0,4,0,208,0,208,0,4,0,235,0,235,0,4,0,244,0,244,0,4,0,246,0,246,0,4,0,250,
+0,253,0,4,1,32,1,32,0,4,1,68,1,68,0,4,1,104,1,104,0,4,1,106,1,108,0,7,1,110,
+1,113,0,7,1,115,1,125,0,7,1,126,1,127,0,4,1,128,1,129,0,7,1,132,1,137,0,7,
+1,138,1,139,0,4,1,140,1,144,0,7,1,145,1,145,0,4,1,146,1,149,0,7,1,150,1,150,
+0,4,1,151,1,161,0,7,1,162,1,163,0,4,1,164,1,165,0,7,1,166,1,167,0,4,1,168,
+1,173,0,7,1,174,1,175,0,4,1,176,1,197,0,7,1,198,1,199,0,4,1,200,1,209,0,7,
+1,210,1,211,0,4,1,212,1,213,0,7,1,214,1,214,0,5,1,252,1,254,0,4,0,2,0,150,
+0,7,0,8,0,8,0,11,0,12,0,5,0,21,0,21,0,20,0,24,0,24,0,19,0,26,0,27,0,2,0,29,
+0,29,0,4,0,31,0,31,0,3,0,32,0,32,0,4,0,33,0,34,0,5,0,36,0,36,0,6,0,37,0,39,
+0,5,0,40,0,40,0,7,0,41,0,42,0,19,0,45,0,45,0,7,0,46,0,46,0,18,0,47,0,47,0,
+4,0,48,0,49,0,8,0,50,0,50,0,9,0,51,0,51,0,7,0,52,0,52,0,10,0,53,0,55,0,19,
+0,102,0,102,0,20,0,105,0,105,0,19,0,107,0,108,0,2,0,112,0,112,0,3,0,114,0,
+115,0,5,0,117,0,117,0,6,0,118,0,120,0,5,0,121,0,121,0,12,0,122,0,123,0,19,
+0,126,0,126,0,12,0,127,0,127,0,18,0,129,0,130,0,8,0,131,0,131,0,9,0,132,0,
+132,0,12,0,133,0,133,0,10,0,134,0,136,0,19,0,138,0,138,0,20,0,141,0,141,0,
+19,0,143,0,144,0,2,0,146,0,146,0,4,0,148,0,148,0,3,0,153,0,153,0,6,0,157,
+0,159,0,11,0,162,0,162,0,7,0,165,0,166,0,8,0,167,0,167,0,9,0,168,0,168,0,
+11,0,170,0,171,0,11,0,172,0,172,0,19,0,174,0,174,0,20,0,177,0,177,0,19,0,
+179,0,179,0,13,0,184,0,184,0,3,0,186,0,187,0,5,0,189,0,189,0,6,0,190,0,192,
+0,14,0,193,0,193,0,7,0,194,0,195,0,19,0,198,0,198,0,7,0,199,0,199,0,18,0,
+201,0,202,0,8,0,203,0,203,0,9,0,204,0,204,0,7,0,206,0,208,0,19,0,210,0,210,
+0,20,0,213,0,213,0,19,0,215,0,215,0,13,0,220,0,220,0,3,0,222,0,223,0,5,0,
+225,0,225,0,6,0,226,0,228,0,14,0,229,0,229,0,7,0,230,0,231,0,19,0,234,0,234,
+0,7,0,235,0,235,0,18,0,237,0,238,0,8,0,239,0,239,0,9,0,240,0,240,0,7,0,242,
+0,244,0,19,0,247,0,248,0,19,0,249,0,249,0,7,0,251,0,252,0,19,0,253,0,253,
+0,7,0,254,0,254,0,20,1,1,1,1,0,1,1,3,1,4,0,15,1,8,1,8,0,3,1,18,1,19,0,1,1,
+23,1,23,0,18,1,25,1,25,0,8,1,30,1,32,0,1,1,34,1,34,0,20,1,37,1,37,0,1,1,39,
+1,40,0,15,1,44,1,44,0,3,1,54,1,55,0,1,1,59,1,59,0,18,1,61,1,61,0,8,1,66,1,
+68,0,1,1,70,1,70,0,20,1,73,1,73,0,1,1,75,1,76,0,15,1,80,1,80,0,3,1,90,1,91,
+0,1,1,97,1,97,0,8,1,102,1,104,0,1,1,106,1,106,0,16,1,109,1,109,0,1,1,111,
+1,112,0,2,1,116,1,116,0,3,1,118,1,119,0,5,1,121,1,121,0,6,1,122,1,124,0,5,
+1,125,1,125,0,12,1,131,1,131,0,18,1,133,1,134,0,8,1,135,1,135,0,9,1,136,1,
+136,0,12,1,137,1,137,0,10,1,140,1,140,0,19,1,141,1,142,0,16,1,145,1,145,0,
+1,1,147,1,148,0,2,1,152,1,152,0,3,1,154,1,155,0,5,1,157,1,157,0,6,1,158,1,
+160,0,5,1,161,1,161,0,12,1,167,1,167,0,18,1,169,1,170,0,8,1,171,1,171,0,9,
+1,172,1,172,0,12,1,173,1,173,0,10,1,176,1,176,0,19,1,177,1,177,0,16,1,178,
+1,178,0,20,1,181,1,181,0,19,1,183,1,184,0,2,1,186,1,186,0,4,1,188,1,188,0,
+3,1,193,1,193,0,6,1,197,1,197,0,17,1,198,1,199,0,11,1,203,1,203,0,18,1,205,
+1,206,0,8,1,207,1,207,0,9,1,208,1,208,0,17,1,210,1,211,0,11,1,212,1,212,0,
+19,0,2,2,0,0,1,0,8,0,1,0,156,0,4,0,0,0,73,1,50,1,68,1,86,1,104,1,122,1,128,
+1,178,1,224,1,230,1,236,1,242,1,248,1,254,2,4,2,10,2,16,2,26,2,76,2,90,2,
+96,2,106,2,112,2,162,2,172,2,178,2,208,2,238,3,12,3,26,3,32,3,38,3,44,3,50,
+3,64,3,70,3,76,3,86,3,92,3,98,3,108,3,114,3,120,3,130,3,136,3,142,3,148,3,
+158,3,184,3,210,3,224,3,234,4,0,4,58,4,64,4,70,4,124,4,174,4,184,4,194,4,
+208,4,218,4,228,4,238,4,248,5,14,5,36,5,54,5,72,5,102,5,116,5,126,5,132,5,
+138,0,1,0,73,0,25,0,28,0,30,0,35,0,50,0,52,0,53,0,54,0,62,0,101,0,106,0,178,
+0,181,0,183,0,188,0,203,0,205,0,206,0,207,0,224,0,239,0,241,0,242,0,243,0,
+247,0,248,0,249,1,5,1,7,1,12,1,30,1,31,1,41,1,43,1,48,1,65,1,66,1,67,1,72,
+1,75,1,80,1,82,1,85,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,96,1,98,1,99,1,101,
+1,103,1,214,1,219,1,220,1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,
+243,1,244,1,247,1,255,2,24,2,28,2,33,0,4,0,62,255,192,0,63,255,193,1,214,
+255,246,1,233,255,156,0,4,0,62,255,236,1,233,255,236,1,239,255,221,1,247,
+255,210,0,4,0,5,255,216,0,62,255,216,0,63,255,216,1,219,255,206,0,4,0,62,
+255,216,0,63,255,216,1,233,255,216,1,238,255,186,0,1,1,214,255,206,0,12,1,
+219,255,236,1,220,255,236,1,233,255,236,1,234,255,236,1,235,255,236,1,236,
+255,236,1,237,255,236,1,239,255,236,1,243,255,236,1,244,255,206,1,245,255,
+236,1,247,255,236,0,11,0,62,0,160,0,63,0,160,1,214,0,100,1,219,1,34,1,233,
+0,120,1,234,255,166,1,235,255,166,1,238,0,160,1,239,0,70,1,240,255,226,1,
+244,255,236,0,1,1,240,255,226,0,1,0,5,255,211,0,1,2,24,0,40,0,1,1,214,255,
+246,0,1,1,214,255,246,0,1,1,244,255,216,0,1,1,219,255,226,0,1,1,233,255,216,
+0,2,0,5,255,206,1,243,0,30,0,12,1,219,0,30,1,220,0,30,1,233,0,30,1,234,0,
+30,1,235,0,30,1,236,0,30,1,237,0,30,1,239,255,216,1,243,0,30,1,244,255,216,
+1,245,0,30,1,247,0,30,0,3,1,214,0,100,1,234,255,166,1,238,0,160,0,1,1,240,
+255,226,0,2,1,233,255,216,1,238,255,186,0,1,1,243,0,30,0,12,1,219,0,30,1,
+220,0,30,1,233,0,30,1,234,0,30,1,235,0,30,1,236,0,30,1,237,0,30,1,239,255,
+216,1,243,0,30,1,244,255,216,1,245,0,30,1,247,0,30,0,2,1,234,255,166,1,238,
+0,160,0,1,1,240,255,226,0,7,1,219,0,130,1,220,0,130,1,233,255,146,1,234,255,
+186,1,235,255,186,1,238,0,50,1,244,255,196,0,7,1,219,0,130,1,220,0,130,1,
+233,255,156,1,234,255,186,1,235,255,186,1,238,0,50,1,244,255,196,0,7,1,219,
+0,130,1,220,0,130,1,233,255,146,1,234,255,186,1,235,255,186,1,238,0,50,1,
+244,255,196,0,3,1,234,255,246,1,239,255,224,1,244,255,206,0,1,1,219,255,236,
+0,1,1,233,255,216,0,1,1,238,0,160,0,1,1,240,255,226,0,3,1,234,255,246,1,239,
+255,224,1,244,255,206,0,1,1,219,255,236,0,1,1,233,255,216,0,2,1,239,255,212,
+1,244,255,212,0,1,1,239,0,70,0,1,1,240,255,226,0,2,2,18,255,226,2,28,255,
+226,0,1,2,4,255,136,0,1,1,240,255,234,0,2,1,240,255,172,2,28,255,176,0,1,
+1,240,255,242,0,1,2,28,255,156,0,1,2,28,255,196,0,2,1,240,255,233,2,18,255,
+166,0,6,1,240,255,216,2,18,255,136,2,19,255,146,2,20,255,146,2,28,255,146,
+2,31,255,146,0,6,1,240,255,216,2,18,255,136,2,19,255,146,2,20,255,146,2,28,
+255,146,2,31,255,146,0,3,1,240,255,220,2,21,255,156,2,22,255,166,0,2,2,21,
+255,166,2,22,255,166,0,5,2,4,255,186,2,5,255,186,2,18,255,216,2,21,255,216,
+2,28,255,216,0,14,1,255,255,176,2,4,255,146,2,5,255,146,2,18,255,176,2,19,
+255,176,2,20,255,176,2,21,255,176,2,22,255,176,2,23,255,176,2,24,255,176,
+2,27,255,156,2,28,255,176,2,29,255,176,2,31,255,176,0,1,2,27,255,126,0,1,
+2,4,255,206,0,13,1,255,255,156,2,4,255,126,2,5,255,126,2,18,255,186,2,19,
+255,186,2,20,255,186,2,21,255,186,2,22,255,186,2,23,255,186,2,24,255,186,
+2,28,255,186,2,29,255,186,2,31,255,186,0,12,0,5,255,206,1,240,254,169,1,255,
+255,196,2,14,255,106,2,18,255,56,2,24,255,126,2,26,255,26,2,28,255,16,2,30,
+255,16,2,31,255,22,2,33,255,56,2,34,255,56,0,2,0,5,255,201,1,240,255,176,
+0,2,0,5,255,201,1,240,255,176,0,3,0,5,255,226,1,240,0,50,2,24,0,20,0,2,0,
+5,255,206,1,240,255,156,0,2,0,5,255,206,1,240,255,156,0,2,0,5,255,196,1,240,
+255,206,0,2,0,5,255,196,1,240,255,206,0,5,1,240,0,80,2,24,0,100,2,31,0,60,
+2,33,0,40,2,34,0,40,0,5,0,5,255,210,2,23,0,30,2,31,0,20,2,33,0,20,2,34,0,
+20,0,4,1,240,255,196,2,24,255,176,2,33,255,66,2,34,255,66,0,4,0,5,255,216,
+1,240,255,106,2,33,255,196,2,34,255,196,0,7,0,5,255,210,1,255,0,60,2,23,0,
+30,2,24,0,50,2,29,0,10,2,33,0,20,2,34,0,20,0,3,0,5,255,206,1,240,255,156,
+1,255,0,40,0,2,2,30,255,83,2,33,255,117,0,1,0,5,255,223,0,1,0,5,255,223,0,
+1,0,5,255,166,0,2,2,0,0,1,0,8,0,2,1,80,0,4,0,0,2,164,6,50,0,16,0,10,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,255,246,255,236,255,246,255,
+236,255,250,0,0,0,0,0,0,0,0,0,0,0,0,0,40,255,241,0,40,255,246,255,233,0,20,
+0,40,0,0,255,168,255,168,0,70,0,0,0,70,0,0,254,222,255,243,255,246,0,0,255,
+233,255,233,255,176,255,225,255,166,255,206,0,0,0,0,255,237,0,0,0,0,0,0,255,
+226,255,229,255,216,255,181,0,0,0,0,0,0,0,0,255,217,255,171,255,196,255,246,
+255,186,0,0,0,0,0,0,0,0,0,0,255,246,255,246,255,213,255,225,255,213,255,154,
+0,0,0,0,0,0,0,0,255,241,255,241,255,201,255,242,255,191,255,243,0,0,0,0,0,
+0,0,0,0,0,0,0,255,226,255,233,255,216,255,176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,255,246,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,255,225,0,0,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+255,232,0,0,0,0,0,0,0,0,255,233,255,233,255,226,255,225,255,220,255,206,0,
+0,0,0,255,237,0,0,255,222,255,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,56,0,
+21,0,24,0,0,0,26,0,27,0,4,0,29,0,29,0,6,0,31,0,34,0,7,0,36,0,47,0,11,0,49,
+0,49,0,23,0,51,0,51,0,24,0,54,0,55,0,25,0,60,0,61,0,27,0,102,0,105,0,29,0,
+107,0,108,0,33,0,110,0,110,0,35,0,112,0,115,0,36,0,117,0,128,0,40,0,130,0,
+130,0,52,0,132,0,132,0,53,0,135,0,136,0,54,0,138,0,177,0,56,0,179,0,180,0,
+96,0,182,0,182,0,98,0,184,0,187,0,99,0,189,0,200,0,103,0,202,0,202,0,115,
+0,204,0,204,0,116,0,207,0,208,0,117,0,210,0,213,0,119,0,215,0,216,0,123,0,
+218,0,218,0,125,0,220,0,223,0,126,0,225,0,236,0,130,0,238,0,238,0,142,0,240,
+0,240,0,143,0,243,0,244,0,144,0,246,0,246,0,146,0,250,1,1,0,147,1,3,1,4,0,
+155,1,6,1,6,0,157,1,8,1,11,0,158,1,13,1,24,0,162,1,26,1,26,0,174,1,28,1,28,
+0,175,1,31,1,32,0,176,1,34,1,37,0,178,1,39,1,40,0,182,1,42,1,42,0,184,1,44,
+1,47,0,185,1,49,1,60,0,189,1,62,1,62,0,201,1,64,1,64,0,202,1,67,1,68,0,203,
+1,73,1,73,0,205,1,78,1,78,0,206,1,94,1,95,0,207,1,104,1,104,0,209,1,106,1,
+213,0,210,1,249,1,254,1,62,0,2,0,151,0,21,0,21,0,15,0,22,0,22,0,4,0,23,0,
+23,0,1,0,24,0,24,0,4,0,26,0,27,0,4,0,29,0,29,0,4,0,31,0,31,0,4,0,32,0,32,
+0,5,0,33,0,34,0,6,0,36,0,36,0,7,0,37,0,39,0,8,0,40,0,46,0,4,0,47,0,47,0,5,
+0,49,0,49,0,9,0,51,0,51,0,4,0,54,0,54,0,4,0,55,0,55,0,2,0,60,0,60,0,4,0,61,
+0,61,0,2,0,102,0,102,0,15,0,103,0,103,0,4,0,104,0,104,0,1,0,105,0,105,0,4,
+0,107,0,108,0,4,0,110,0,110,0,4,0,112,0,112,0,4,0,113,0,113,0,5,0,114,0,115,
+0,6,0,117,0,117,0,7,0,118,0,120,0,8,0,121,0,127,0,4,0,128,0,128,0,5,0,130,
+0,130,0,9,0,132,0,132,0,4,0,135,0,135,0,4,0,136,0,136,0,2,0,138,0,173,0,2,
+0,174,0,174,0,15,0,175,0,175,0,11,0,176,0,176,0,1,0,177,0,177,0,4,0,179,0,
+180,0,10,0,182,0,182,0,4,0,184,0,184,0,14,0,185,0,185,0,5,0,186,0,187,0,6,
+0,189,0,189,0,12,0,190,0,192,0,8,0,193,0,193,0,10,0,194,0,195,0,4,0,196,0,
+197,0,11,0,198,0,199,0,4,0,200,0,200,0,5,0,202,0,202,0,13,0,204,0,204,0,10,
+0,207,0,207,0,4,0,208,0,208,0,2,0,210,0,210,0,15,0,211,0,211,0,11,0,212,0,
+212,0,1,0,213,0,213,0,4,0,215,0,216,0,10,0,218,0,218,0,4,0,220,0,220,0,14,
+0,221,0,221,0,5,0,222,0,223,0,6,0,225,0,225,0,12,0,226,0,228,0,8,0,229,0,
+229,0,10,0,230,0,231,0,4,0,232,0,233,0,11,0,234,0,234,0,4,0,235,0,235,0,2,
+0,236,0,236,0,5,0,238,0,238,0,13,0,240,0,240,0,10,0,243,0,243,0,4,0,244,0,
+244,0,2,0,246,0,246,0,2,0,250,0,253,0,2,0,254,0,254,0,15,0,255,0,255,0,14,
+1,0,1,0,0,1,1,1,1,1,0,4,1,3,1,4,0,14,1,6,1,6,0,4,1,8,1,8,0,14,1,9,1,9,0,5,
+1,10,1,11,0,6,1,13,1,13,0,7,1,14,1,16,0,8,1,17,1,17,0,14,1,18,1,19,0,4,1,
+20,1,21,0,14,1,22,1,23,0,4,1,24,1,24,0,5,1,26,1,26,0,9,1,28,1,28,0,14,1,31,
+1,31,0,4,1,32,1,32,0,2,1,34,1,34,0,15,1,35,1,35,0,14,1,36,1,36,0,1,1,37,1,
+37,0,4,1,39,1,40,0,14,1,42,1,42,0,4,1,44,1,44,0,14,1,45,1,45,0,5,1,46,1,47,
+0,6,1,49,1,49,0,7,1,50,1,52,0,8,1,53,1,53,0,14,1,54,1,55,0,4,1,56,1,57,0,
+14,1,58,1,59,0,4,1,60,1,60,0,5,1,62,1,62,0,9,1,64,1,64,0,14,1,67,1,67,0,4,
+1,68,1,68,0,2,1,73,1,73,0,4,1,78,1,78,0,4,1,94,1,95,0,4,1,104,1,104,0,2,1,
+106,1,108,0,3,1,109,1,109,0,4,1,110,1,113,0,3,1,114,1,114,0,4,1,115,1,125,
+0,3,1,126,1,127,0,2,1,128,1,129,0,3,1,130,1,131,0,4,1,132,1,137,0,3,1,138,
+1,139,0,2,1,140,1,144,0,3,1,145,1,145,0,2,1,146,1,149,0,3,1,150,1,150,0,2,
+1,151,1,161,0,3,1,162,1,163,0,2,1,164,1,165,0,3,1,166,1,167,0,2,1,168,1,173,
+0,3,1,174,1,175,0,2,1,176,1,197,0,3,1,198,1,199,0,2,1,200,1,209,0,3,1,210,
+1,211,0,2,1,212,1,213,0,3,1,249,1,251,0,4,1,252,1,254,0,2,0,2,0,13,0,4,0,
+5,0,7,0,6,0,6,0,8,0,62,0,63,0,3,1,214,1,214,0,4,1,219,1,220,0,5,1,233,1,237,
+0,5,1,238,1,238,0,6,1,239,1,239,0,1,1,240,1,240,0,9,1,243,1,243,0,5,1,244,
+1,244,0,2,1,245,1,245,0,5,1,247,1,247,0,5,0,8,2,0,0,1,0,8,0,2,0,16,0,50,0,
+108,0,142,0,2,0,0,0,152,0,2,0,5,2,0,2,3,0,0,2,6,2,17,0,4,2,25,2,26,0,16,2,
+30,2,30,0,18,2,32,2,32,0,19,0,2,0,9,0,60,0,61,0,1,0,138,0,173,0,1,0,235,0,
+235,0,1,0,250,0,253,0,1,1,106,1,108,0,1,1,110,1,113,0,1,1,115,1,129,0,1,1,
+132,1,213,0,1,1,249,1,254,0,1,0,2,0,5,2,0,2,3,0,1,2,6,2,17,0,1,2,25,2,26,
+0,1,2,30,2,30,0,1,2,32,2,32,0,1,0,1,0,4,0,2,0,1,0,1,0,3,0,8,0,28,0,46,0,1,
+0,1,0,1,0,1,0,1,0,2,0,0,0,6,0,0,0,5,0,1,0,1,0,1,0,0,0,2,0,0,0,4,0,0,0,5,0,
+0,0,1,0,1,0,1,0,1,0,0,0,4,0,1,0,0,0,1,0,8,0,2,0,48,0,4,0,20,253,227,254,114,
+253,88,253,245,253,245,253,88,253,131,253,227,254,104,253,243,253,243,253,
+178,254,222,254,17,254,17,254,17,253,184,253,217,254,9,253,88,0,2,0,5,2,0,
+2,3,0,0,2,6,2,17,0,4,2,25,2,26,0,16,2,30,2,30,0,18,2,32,2,32,0,19,0,1,0,0,
+0,1,0,8,0,2,0,48,0,1,0,20,253,227,254,114,253,88,253,245,253,245,253,88,253,
+131,253,227,254,104,253,243,253,243,253,178,254,222,254,17,254,17,254,17,
+253,184,253,217,254,9,253,88,0,2,0,5,2,0,2,3,0,0,2,6,2,17,0,4,2,25,2,26,0,
+16,2,30,2,30,0,18,2,32,2,32,0,19,0,1,0,0,0,1,0,8,0,2,0,48,0,4,0,20,251,238,
+253,3,250,196,252,8,252,8,250,196,250,215,251,229,252,238,251,160,251,160,
+251,141,253,188,252,64,252,64,252,64,251,143,251,209,251,187,250,196,0,2,
+0,5,2,0,2,3,0,0,2,6,2,17,0,4,2,25,2,26,0,16,2,30,2,30,0,18,2,32,2,32,0,19,
+0,8,0,0,0,1,0,8,0,2,0,16,0,28,0,44,0,66,0,2,0,0,0,74,0,1,0,4,0,62,0,63,2,
+19,2,23,0,2,0,2,2,24,2,24,0,1,2,37,2,72,0,1,0,2,0,3,0,62,0,63,0,1,2,19,2,
+19,0,1,2,23,2,23,0,1,0,1,0,1,0,1,0,1,0,1,0,4,0,1,0,1,0,1,0,0,0,2,0,0,0,27,
+0,0,0,28,0,8,0,0,0,1,0,8,0,1,0,20,0,7,0,38,0,62,0,86,0,242,1,32,1,188,1,212,
+0,1,0,7,2,9,2,14,2,24,2,26,2,28,2,30,2,33,0,1,0,4,0,2,2,70,1,67,0,1,0,0,0,
+2,0,0,0,27,0,0,0,28,0,1,0,4,0,2,2,70,0,243,0,1,0,0,0,2,0,0,0,27,0,0,0,28,
+0,7,0,16,0,36,0,56,0,76,0,96,0,116,0,136,0,2,1,229,0,36,0,1,0,0,0,2,0,0,0,
+25,0,0,0,26,0,2,1,230,0,47,0,1,0,0,0,2,0,0,0,23,0,0,0,24,0,2,1,232,0,47,0,
+1,0,0,0,2,0,0,0,23,0,0,0,24,0,2,1,222,0,47,0,1,0,0,0,2,0,0,0,21,0,0,0,22,
+0,2,1,217,0,47,0,1,0,0,0,2,0,0,0,21,0,0,0,22,0,2,1,221,0,47,0,1,0,0,0,2,0,
+0,0,17,0,0,0,18,0,2,1,232,0,38,0,1,0,0,0,2,0,0,0,9,0,0,0,10,0,2,0,6,0,26,
+0,2,2,71,0,208,0,1,0,0,0,2,0,0,0,27,0,0,0,28,0,2,2,54,0,227,0,1,0,0,0,2,0,
+0,0,27,0,0,0,28,0,7,0,16,0,36,0,56,0,76,0,96,0,116,0,136,0,2,1,229,0,36,0,
+1,0,0,0,2,0,0,0,25,0,0,0,26,0,2,1,229,0,189,0,1,0,0,0,2,0,0,0,25,0,0,0,26,
+0,2,1,231,0,47,0,1,0,0,0,2,0,0,0,23,0,0,0,24,0,2,1,232,0,47,0,1,0,0,0,2,0,
+0,0,23,0,0,0,24,0,2,1,226,1,26,0,1,0,0,0,2,0,0,0,15,0,0,0,16,0,2,1,226,1,
+26,0,1,0,0,0,2,0,0,0,11,0,0,0,12,0,2,1,221,0,28,0,1,0,0,0,2,0,0,0,11,0,0,
+0,12,0,1,0,4,0,2,2,39,0,176,0,1,0,0,0,2,0,0,0,27,0,0,0,28,0,3,0,8,0,28,0,
+48,0,2,1,229,0,36,0,1,0,0,0,2,0,0,0,25,0,0,0,26,0,2,1,231,0,47,0,1,0,0,0,
+2,0,0,0,23,0,0,0,24,0,2,2,73,0,47,0,1,0,0,0,2,0,0,0,19,0,0,0,20,0,1,0,0,0,
+1,0,8,0,1,0,8,0,4,255,153,0,1,0,1,2,24,0,1,0,0,0,1,0,8,0,1,0,8,0,1,255,153,
+0,1,0,1,2,24,0,1,0,0,0,1,0,8,0,1,0,8,0,4,255,76,0,1,0,1,2,28,0,1,0,0,0,1,
+0,8,0,1,0,8,0,1,255,76,0,1,0,1,2,28,0,1,0,0,0,1,0,8,0,1,0,8,0,4,255,66,0,
+1,0,1,2,28,0,1,0,0,0,1,0,8,0,1,0,8,0,1,255,66,0,1,0,1,2,28,0,1,0,0,0,1,0,
+8,0,1,0,8,0,4,255,81,0,1,0,1,2,28,0,1,0,0,0,1,0,8,0,1,0,8,0,1,255,81,0,1,
+0,1,2,28,0,1,0,0,0,1,0,8,0,1,0,8,0,4,255,203,0,1,0,1,2,24,0,1,0,0,0,1,0,8,
+0,1,0,8,0,1,255,203,0,1,0,1,2,24,0,1,0,0,0,1,0,8,0,1,0,8,0,4,255,237,0,1,
+0,1,2,33,0,1,0,0,0,1,0,8,0,1,0,8,0,1,255,237,0,1,0,1,2,33,0,1,0,0,0,1,0,8,
+0,1,0,8,0,4,0,150,0,1,0,1,2,24,0,1,0,0,0,1,0,8,0,1,0,8,0,1,0,150,0,1,0,1,
+2,24,0,1,0,0,0,1,0,8,0,2,0,14,0,4,0,3,255,166,255,181,255,181,0,1,0,3,2,24,
+2,28,2,33,0,1,0,0,0,1,0,8,0,2,0,14,0,1,0,3,255,166,255,181,255,181,0,1,0,
+3,2,24,2,28,2,33,0,1,0,0,0,1,0,8,0,2,0,14,0,4,0,3,255,146,255,126,255,126,
+0,1,0,3,2,24,2,28,2,33,0,1,0,0,0,1,0,8,0,2,0,14,0,1,0,3,255,146,255,126,255,
+126,0,1,0,3,2,24,2,28,2,33,0,1,0,0,0,1,0,8,0,2,0,26,0,4,0,9,0,125,0,125,255,
+116,255,56,255,136,255,176,255,211,255,116,255,96,0,1,0,9,0,62,0,63,2,9,2,
+14,2,19,2,23,2,24,2,26,2,30,0,1,0,0,0,1,0,8,0,2,0,26,0,1,0,9,0,125,0,125,
+255,116,255,56,255,136,255,176,255,211,255,116,255,96,0,1,0,9,0,62,0,63,2,
+9,2,14,2,19,2,23,2,24,2,26,2,30,0,4,0,0,0,1,0,8,0,1,0,12,0,52,0,1,0,116,2,
+158,0,2,0,6,1,215,1,218,0,0,1,221,1,232,0,4,1,241,1,242,0,16,1,246,1,246,
+0,18,1,248,1,248,0,19,2,73,2,98,0,20,0,2,0,10,0,21,0,55,0,0,0,102,0,136,0,
+35,0,138,0,172,0,70,0,174,0,208,0,105,0,210,0,244,0,140,0,246,1,32,0,175,
+1,34,1,68,0,218,1,106,1,140,0,253,1,142,1,176,1,32,1,178,1,212,1,67,0,46,
+0,0,0,186,0,0,0,194,0,0,0,202,0,0,0,210,0,0,0,218,0,0,0,226,0,0,0,234,0,0,
+0,242,0,0,0,250,0,0,1,2,0,0,1,10,0,0,1,18,0,0,1,26,0,0,1,34,0,0,1,42,0,0,
+1,50,0,0,1,58,0,0,1,66,0,0,1,74,0,0,1,82,0,0,1,90,0,0,1,98,0,0,1,106,0,0,
+1,114,0,0,1,122,0,0,1,130,0,0,1,138,0,0,1,146,0,0,1,154,0,0,1,162,0,0,1,170,
+0,0,1,178,0,0,1,186,0,0,1,194,0,0,1,202,0,0,1,210,0,0,1,218,0,0,1,226,0,0,
+1,234,0,0,1,242,0,0,1,250,0,0,2,2,0,0,2,10,0,0,2,18,0,0,2,26,0,0,2,34,0,2,
+253,192,255,206,0,76,0,2,254,70,255,206,0,23,0,2,253,38,255,206,0,64,0,2,
+253,200,255,206,0,62,0,2,253,200,255,206,0,76,0,2,253,33,255,206,0,64,0,2,
+253,84,255,206,0,74,0,2,253,183,255,206,0,53,0,2,254,59,255,206,0,36,0,2,
+253,198,255,206,0,53,0,2,253,198,255,206,0,57,0,2,253,144,255,206,0,72,0,
+2,253,123,255,206,0,28,0,2,253,228,255,206,0,53,0,2,253,228,255,206,0,36,
+0,2,253,228,255,206,0,40,0,2,253,140,255,206,0,67,0,2,253,173,255,206,0,38,
+0,2,253,168,255,206,0,58,0,2,253,4,255,206,0,68,0,2,253,212,255,206,0,28,
+0,2,252,219,255,206,0,28,0,2,253,123,255,206,0,28,0,2,253,229,255,206,0,57,
+0,2,253,123,255,206,0,57,0,2,252,9,255,206,0,56,0,2,253,117,255,206,0,108,
+0,2,253,226,255,206,0,50,0,2,252,189,255,206,0,89,0,2,253,147,255,206,0,102,
+0,2,253,178,255,206,0,77,0,2,253,168,255,206,0,76,0,2,253,124,255,206,0,94,
+0,2,253,185,255,206,0,78,0,2,253,185,255,206,0,61,0,2,253,185,255,206,0,65,
+0,2,253,199,255,206,0,64,0,2,253,125,255,206,0,82,0,2,252,248,255,206,0,92,
+0,2,253,52,255,206,0,42,0,2,253,235,255,206,0,115,0,2,253,200,255,206,0,76,
+0,2,253,183,255,206,0,53,0,2,253,198,255,206,0,53,0,2,253,228,255,206,0,36,
+0,2,253,173,255,206,0,38,1,102,2,206,2,214,2,222,2,230,2,238,2,246,2,254,
+3,6,3,14,3,22,3,30,3,38,3,46,3,54,3,62,3,70,3,78,3,86,3,94,3,102,3,110,3,
+118,3,126,3,134,3,142,3,150,3,158,3,166,3,174,3,182,3,190,3,198,3,206,3,214,
+3,222,3,230,3,238,3,246,3,254,4,6,4,14,4,22,4,30,4,38,4,46,4,54,4,62,4,70,
+4,78,4,86,4,94,4,102,4,110,4,118,4,126,4,134,4,142,4,150,4,158,4,166,4,174,
+4,182,4,190,4,198,4,206,4,214,4,222,4,230,4,238,4,246,4,254,5,6,5,14,5,22,
+5,30,5,38,5,46,5,54,5,62,5,70,5,78,5,86,5,94,5,102,5,110,5,118,5,126,5,134,
+5,142,5,150,5,158,5,166,5,174,5,182,5,190,5,198,5,206,5,214,5,222,5,230,5,
+238,5,246,5,254,6,6,6,14,6,22,6,30,6,38,6,46,6,54,6,62,6,70,6,78,6,86,6,94,
+6,102,6,110,6,118,6,126,6,134,6,142,6,150,6,158,6,166,6,174,6,182,6,190,6,
+198,6,206,6,214,6,222,6,230,6,238,6,246,6,254,7,6,7,14,7,22,7,30,7,38,7,46,
+7,54,7,62,7,70,7,78,7,86,7,94,7,102,7,110,7,118,7,126,7,134,7,142,7,150,7,
+158,7,166,7,174,7,182,7,190,7,198,7,206,7,214,7,222,7,230,7,238,7,246,7,254,
+8,6,8,14,8,22,8,30,8,38,8,46,8,54,8,62,8,70,8,78,8,86,8,94,8,102,8,110,8,
+118,8,126,8,134,8,142,8,150,8,158,8,166,8,174,8,182,8,190,8,198,8,206,8,214,
+8,222,8,230,8,238,8,246,8,254,9,6,9,14,9,22,9,30,9,38,9,46,9,54,9,62,9,70,
+9,78,9,86,9,94,9,102,9,110,9,118,9,126,9,134,9,142,9,150,9,158,9,166,9,174,
+9,182,9,190,9,198,9,206,9,214,9,222,9,230,9,238,9,246,9,254,10,6,10,14,10,
+22,10,30,10,38,10,46,10,54,10,62,10,70,10,78,10,86,10,94,10,102,10,110,10,
+118,10,126,10,134,10,142,10,150,10,158,10,166,10,174,10,182,10,190,10,198,
+10,206,10,214,10,222,10,230,10,238,10,246,10,254,11,6,11,14,11,22,11,30,11,
+38,11,46,11,54,11,62,11,70,11,78,11,86,11,94,11,102,11,110,11,118,11,126,
+11,134,11,142,11,150,11,158,11,166,11,174,11,182,11,190,11,198,11,206,11,
+214,11,222,11,230,11,238,11,246,11,254,12,6,12,14,12,22,12,30,12,38,12,46,
+12,54,12,62,12,70,12,78,12,86,12,94,12,102,12,110,12,118,12,126,12,134,12,
+142,12,150,12,158,12,166,12,174,12,182,12,190,12,198,12,206,12,214,12,222,
+12,230,12,238,12,246,12,254,13,6,13,14,13,22,13,30,13,38,13,46,13,54,13,62,
+13,70,13,78,13,86,13,94,13,102,13,110,13,118,13,126,13,134,13,142,13,150,
+13,158,13,166,13,174,13,182,13,190,13,198,13,206,13,214,13,222,13,230,13,
+238,13,246,0,2,2,20,255,206,0,40,0,2,3,5,255,206,0,81,0,2,2,84,255,206,0,
+26,0,2,4,219,255,206,0,67,0,2,2,236,255,206,0,69,0,2,3,10,255,206,0,41,0,
+2,3,10,255,206,0,45,0,2,2,236,255,206,0,81,0,2,4,22,255,206,0,70,0,2,3,34,
+255,206,0,74,0,2,3,21,255,206,0,60,0,2,2,95,255,206,0,38,0,2,2,246,255,206,
+0,55,0,2,2,246,255,206,0,59,0,2,3,78,255,206,0,76,0,2,3,29,255,206,0,59,0,
+2,2,211,255,206,0,54,0,2,2,211,255,206,0,40,0,2,2,211,255,206,0,44,0,2,2,
+206,255,206,0,41,0,2,2,216,255,206,0,43,0,2,2,216,255,206,0,47,0,2,3,0,255,
+206,0,61,0,2,3,0,255,206,0,65,0,2,4,59,255,206,0,65,0,2,5,36,255,206,0,69,
+0,2,2,95,255,206,0,27,0,2,3,71,255,206,0,70,0,2,2,214,255,206,0,41,0,2,2,
+148,255,206,0,64,0,2,2,216,255,206,0,45,0,2,2,51,255,206,0,55,0,2,2,186,255,
+206,0,60,0,2,2,206,255,206,0,40,0,2,4,34,255,206,0,70,0,2,2,20,255,206,0,
+40,0,2,3,5,255,206,0,112,0,2,2,84,255,206,0,26,0,2,4,219,255,206,0,67,0,2,
+2,236,255,206,0,69,0,2,3,10,255,206,0,75,0,2,3,10,255,206,0,79,0,2,2,236,
+255,206,0,113,0,2,4,22,255,206,0,70,0,2,3,34,255,206,0,74,0,2,3,21,255,206,
+0,90,0,2,2,95,255,206,0,38,0,2,2,246,255,206,0,55,0,2,2,246,255,206,0,59,
+0,2,3,78,255,206,0,76,0,2,3,29,255,206,0,96,0,2,2,211,255,206,0,54,0,2,2,
+211,255,206,0,40,0,2,2,211,255,206,0,44,0,2,2,206,255,206,0,73,0,2,2,216,
+255,206,0,43,0,2,2,216,255,206,0,47,0,2,3,0,255,206,0,92,0,2,3,0,255,206,
+0,96,0,2,4,59,255,206,0,97,0,2,5,36,255,206,0,98,0,2,2,95,255,206,0,27,0,
+2,3,71,255,206,0,70,0,2,2,214,255,206,0,74,0,2,2,148,255,206,0,96,0,2,2,216,
+255,206,0,77,0,2,2,51,255,206,0,88,0,2,2,186,255,206,0,60,0,2,2,206,255,206,
+0,40,0,2,4,34,255,206,0,70,0,2,2,20,255,206,0,70,0,2,3,5,255,206,0,108,0,
+2,2,84,255,206,0,53,0,2,4,219,255,206,0,97,0,2,2,236,255,206,0,69,0,2,3,10,
+255,206,0,69,0,2,3,10,255,206,0,73,0,2,2,236,255,206,0,102,0,2,4,22,255,206,
+0,100,0,2,3,34,255,206,0,74,0,2,3,21,255,206,0,88,0,2,2,95,255,206,0,63,0,
+2,2,246,255,206,0,81,0,2,2,246,255,206,0,85,0,2,3,78,255,206,0,103,0,2,3,
+29,255,206,0,87,0,2,2,211,255,206,0,81,0,2,2,211,255,206,0,66,0,2,2,211,255,
+206,0,70,0,2,2,206,255,206,0,67,0,2,2,216,255,206,0,48,0,2,2,216,255,206,
+0,52,0,2,3,0,255,206,0,89,0,2,3,0,255,206,0,93,0,2,4,59,255,206,0,94,0,2,
+5,36,255,206,0,93,0,2,2,95,255,206,0,52,0,2,3,71,255,206,0,97,0,2,2,214,255,
+206,0,69,0,2,2,148,255,206,0,88,0,2,2,216,255,206,0,71,0,2,2,51,255,206,0,
+80,0,2,2,186,255,206,0,65,0,2,2,206,255,206,0,45,0,2,4,34,255,206,0,110,0,
+2,2,20,255,206,0,40,0,2,3,34,255,206,0,103,0,2,2,84,255,206,0,47,0,2,4,219,
+255,206,0,67,0,2,2,236,255,206,0,69,0,2,3,16,255,206,0,64,0,2,3,16,255,206,
+0,68,0,2,2,236,255,206,0,97,0,2,5,36,255,206,0,91,0,2,3,34,255,206,0,74,0,
+2,3,21,255,206,0,60,0,2,2,95,255,206,0,59,0,2,2,246,255,206,0,55,0,2,2,246,
+255,206,0,59,0,2,3,78,255,206,0,76,0,2,3,37,255,206,0,89,0,2,2,211,255,206,
+0,75,0,2,2,211,255,206,0,61,0,2,2,211,255,206,0,65,0,2,2,206,255,206,0,63,
+0,2,2,216,255,206,0,43,0,2,2,216,255,206,0,47,0,2,3,22,255,206,0,86,0,2,3,
+22,255,206,0,90,0,2,4,59,255,206,0,86,0,2,5,36,255,206,0,66,0,2,2,95,255,
+206,0,48,0,2,3,71,255,206,0,70,0,2,2,238,255,206,0,65,0,2,2,179,255,206,0,
+85,0,2,2,216,255,206,0,66,0,2,2,51,255,206,0,77,0,2,2,186,255,206,0,60,0,
+2,2,206,255,206,0,40,0,2,4,34,255,206,0,70,0,2,2,20,255,206,0,40,0,2,3,34,
+255,206,0,121,0,2,2,84,255,206,0,64,0,2,4,219,255,206,0,67,0,2,2,236,255,
+206,0,69,0,2,3,16,255,206,0,82,0,2,3,16,255,206,0,86,0,2,2,236,255,206,0,
+115,0,2,5,36,255,206,0,112,0,2,3,34,255,206,0,74,0,2,3,21,255,206,0,60,0,
+2,2,95,255,206,0,80,0,2,2,246,255,206,0,55,0,2,2,246,255,206,0,59,0,2,3,78,
+255,206,0,76,0,2,3,37,255,206,0,107,0,2,2,211,255,206,0,90,0,2,2,211,255,
+206,0,76,0,2,2,211,255,206,0,80,0,2,2,206,255,206,0,81,0,2,2,216,255,206,
+0,43,0,2,2,216,255,206,0,47,0,2,3,22,255,206,0,103,0,2,3,22,255,206,0,107,
+0,2,4,59,255,206,0,104,0,2,5,36,255,206,0,95,0,2,2,95,255,206,0,69,0,2,3,
+71,255,206,0,70,0,2,2,238,255,206,0,83,0,2,2,179,255,206,0,103,0,2,2,216,
+255,206,0,84,0,2,2,51,255,206,0,95,0,2,2,186,255,206,0,60,0,2,2,206,255,206,
+0,40,0,2,4,34,255,206,0,70,0,2,2,236,255,206,0,101,0,2,2,166,255,206,0,66,
+0,2,2,166,255,206,0,70,0,2,2,166,255,206,0,73,0,2,2,236,255,206,0,126,0,2,
+2,166,255,206,0,93,0,2,2,166,255,206,0,97,0,2,2,166,255,206,0,100,0,2,2,20,
+255,206,0,40,0,2,3,5,255,206,0,81,0,2,2,84,255,206,0,26,0,2,4,219,255,206,
+0,67,0,2,2,236,255,206,0,69,0,2,3,10,255,206,0,41,0,2,3,10,255,206,0,45,0,
+2,2,236,255,206,0,81,0,2,4,22,255,206,0,70,0,2,3,34,255,206,0,74,0,2,3,21,
+255,206,0,60,0,2,2,95,255,206,0,38,0,2,2,246,255,206,0,55,0,2,2,246,255,206,
+0,59,0,2,3,78,255,206,0,76,0,2,3,29,255,206,0,59,0,2,2,211,255,206,0,54,0,
+2,2,211,255,206,0,40,0,2,2,211,255,206,0,44,0,2,2,206,255,206,0,42,0,2,2,
+216,255,206,0,43,0,2,2,216,255,206,0,47,0,2,3,0,255,206,0,61,0,2,3,0,255,
+206,0,65,0,2,4,59,255,206,0,65,0,2,5,36,255,206,0,69,0,2,2,95,255,206,0,27,
+0,2,3,71,255,206,0,70,0,2,2,214,255,206,0,42,0,2,2,148,255,206,0,64,0,2,2,
+216,255,206,0,46,0,2,2,51,255,206,0,55,0,2,2,186,255,206,0,60,0,2,2,206,255,
+206,0,40,0,2,4,34,255,206,0,70,0,2,2,20,255,206,0,40,0,2,3,5,255,206,0,81,
+0,2,2,84,255,206,0,26,0,2,4,219,255,206,0,67,0,2,2,236,255,206,0,69,0,2,3,
+10,255,206,0,41,0,2,3,10,255,206,0,45,0,2,2,236,255,206,0,81,0,2,4,22,255,
+206,0,70,0,2,3,34,255,206,0,74,0,2,3,21,255,206,0,60,0,2,2,95,255,206,0,38,
+0,2,2,246,255,206,0,55,0,2,2,246,255,206,0,59,0,2,3,78,255,206,0,76,0,2,3,
+29,255,206,0,59,0,2,2,211,255,206,0,54,0,2,2,211,255,206,0,40,0,2,2,211,255,
+206,0,44,0,2,2,206,255,206,0,42,0,2,2,216,255,206,0,43,0,2,2,216,255,206,
+0,47,0,2,3,0,255,206,0,61,0,2,3,0,255,206,0,65,0,2,4,59,255,206,0,65,0,2,
+5,36,255,206,0,69,0,2,2,95,255,206,0,27,0,2,3,71,255,206,0,70,0,2,2,214,255,
+206,0,42,0,2,2,148,255,206,0,64,0,2,2,216,255,206,0,46,0,2,2,51,255,206,0,
+55,0,2,2,186,255,206,0,60,0,2,2,206,255,206,0,40,0,2,4,34,255,206,0,70,0,
+2,2,20,255,206,0,40,0,2,3,5,255,206,0,134,0,2,2,84,255,206,0,26,0,2,4,219,
+255,206,0,88,0,2,2,236,255,206,0,69,0,2,3,10,255,206,0,95,0,2,3,10,255,206,
+0,99,0,2,2,236,255,206,0,130,0,2,4,22,255,206,0,91,0,2,3,34,255,206,0,74,
+0,2,3,21,255,206,0,113,0,2,2,95,255,206,0,38,0,2,2,246,255,206,0,55,0,2,2,
+246,255,206,0,59,0,2,3,78,255,206,0,76,0,2,3,29,255,206,0,115,0,2,2,211,255,
+206,0,54,0,2,2,211,255,206,0,40,0,2,2,211,255,206,0,44,0,2,2,206,255,206,
+0,93,0,2,2,216,255,206,0,101,0,2,2,216,255,206,0,105,0,2,3,0,255,206,0,114,
+0,2,3,0,255,206,0,118,0,2,4,59,255,206,0,86,0,2,5,36,255,206,0,86,0,2,2,95,
+255,206,0,27,0,2,3,71,255,206,0,70,0,2,2,214,255,206,0,97,0,2,2,148,255,206,
+0,116,0,2,2,216,255,206,0,97,0,2,2,51,255,206,0,110,0,2,2,186,255,206,0,118,
+0,2,2,206,255,206,0,98,0,2,4,34,255,206,0,70,0,2,2,20,255,206,0,40,0,2,3,
+5,255,206,0,147,0,2,2,84,255,206,0,26,0,2,4,219,255,206,0,97,0,2,2,236,255,
+206,0,69,0,2,3,10,255,206,0,109,0,2,3,10,255,206,0,113,0,2,2,236,255,206,
+0,144,0,2,4,22,255,206,0,100,0,2,3,34,255,206,0,74,0,2,3,21,255,206,0,127,
+0,2,2,95,255,206,0,38,0,2,2,246,255,206,0,55,0,2,2,246,255,206,0,59,0,2,3,
+78,255,206,0,76,0,2,3,29,255,206,0,129,0,2,2,211,255,206,0,54,0,2,2,211,255,
+206,0,40,0,2,2,211,255,206,0,44,0,2,2,206,255,206,0,107,0,2,2,216,255,206,
+0,116,0,2,2,216,255,206,0,120,0,2,3,0,255,206,0,128,0,2,3,0,255,206,0,132,
+0,2,4,59,255,206,0,95,0,2,5,36,255,206,0,93,0,2,2,95,255,206,0,27,0,2,3,71,
+255,206,0,70,0,2,2,214,255,206,0,111,0,2,2,148,255,206,0,130,0,2,2,216,255,
+206,0,111,0,2,2,51,255,206,0,124,0,2,2,186,255,206,0,133,0,2,2,206,255,206,
+0,113,0,2,4,34,255,206,0,70,0,2,2,20,255,206,0,40,0,2,3,5,255,206,0,81,0,
+2,2,84,255,206,0,26,0,2,4,219,255,206,0,68,0,2,2,236,255,206,0,69,0,2,3,10,
+255,206,0,41,0,2,3,10,255,206,0,45,0,2,2,236,255,206,0,81,0,2,4,22,255,206,
+0,71,0,2,3,34,255,206,0,120,0,2,3,21,255,206,0,60,0,2,2,95,255,206,0,38,0,
+2,2,246,255,206,0,55,0,2,2,246,255,206,0,59,0,2,3,78,255,206,0,76,0,2,3,29,
+255,206,0,59,0,2,2,211,255,206,0,54,0,2,2,211,255,206,0,40,0,2,2,211,255,
+206,0,44,0,2,2,206,255,206,0,42,0,2,2,216,255,206,0,48,0,2,2,216,255,206,
+0,98,0,2,3,0,255,206,0,61,0,2,3,0,255,206,0,65,0,2,4,59,255,206,0,65,0,2,
+5,36,255,206,0,66,0,2,2,95,255,206,0,27,0,2,3,71,255,206,0,70,0,2,2,214,255,
+206,0,42,0,2,2,148,255,206,0,64,0,2,2,216,255,206,0,46,0,2,2,51,255,206,0,
+101,0,2,2,186,255,206,0,111,0,2,2,206,255,206,0,91,0,2,4,34,255,206,0,116,
+0,4,0,0,0,1,0,8,0,1,0,12,0,22,0,1,0,92,2,14,0,2,0,1,2,37,2,72,0,0,0,2,0,11,
+0,21,0,27,0,0,0,29,0,40,0,7,0,43,0,50,0,19,0,52,0,55,0,27,0,138,0,171,0,31,
+0,235,0,235,0,65,0,246,0,246,0,66,0,250,0,253,0,67,1,106,1,140,0,71,1,142,
+1,176,0,106,1,178,1,212,0,141,0,36,0,0,0,146,0,0,0,154,0,0,0,162,0,0,0,170,
+0,0,0,178,0,0,0,186,0,0,0,194,0,0,0,202,0,0,0,210,0,0,0,218,0,0,0,226,0,0,
+0,234,0,0,0,242,0,0,0,250,0,0,1,2,0,0,1,10,0,0,1,18,0,0,1,26,0,0,1,34,0,0,
+1,42,0,0,1,50,0,0,1,58,0,0,1,66,0,0,1,74,0,0,1,82,0,0,1,90,0,0,1,98,0,0,1,
+106,0,0,1,114,0,0,1,122,0,0,1,130,0,0,1,138,0,0,1,146,0,0,1,154,0,0,1,162,
+0,0,1,170,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,
+0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,
+206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,
+2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,
+206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,
+2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,
+206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,
+2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,
+206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,
+2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,206,0,14,0,2,0,0,255,
+206,0,14,0,2,0,0,255,206,0,14,0,176,1,98,1,106,1,114,1,122,1,130,1,138,1,
+146,1,154,1,162,1,170,1,178,1,186,1,194,1,202,1,210,1,218,1,226,1,234,1,242,
+1,250,2,2,2,10,2,18,2,26,2,34,2,42,2,50,2,58,2,66,2,74,2,82,2,90,2,98,2,106,
+2,114,2,122,2,130,2,138,2,146,2,154,2,162,2,170,2,178,2,186,2,194,2,202,2,
+210,2,218,2,226,2,234,2,242,2,250,3,2,3,10,3,18,3,26,3,34,3,42,3,50,3,58,
+3,66,3,74,3,82,3,90,3,98,3,106,3,114,3,122,3,130,3,138,3,146,3,154,3,162,
+3,170,3,178,3,186,3,194,3,202,3,210,3,218,3,226,3,234,3,242,3,250,4,2,4,10,
+4,18,4,26,4,34,4,42,4,50,4,58,4,66,4,74,4,82,4,90,4,98,4,106,4,114,4,122,
+4,130,4,138,4,146,4,154,4,162,4,170,4,178,4,186,4,194,4,202,4,210,4,218,4,
+226,4,234,4,242,4,250,5,2,5,10,5,18,5,26,5,34,5,42,5,50,5,58,5,66,5,74,5,
+82,5,90,5,98,5,106,5,114,5,122,5,130,5,138,5,146,5,154,5,162,5,170,5,178,
+5,186,5,194,5,202,5,210,5,218,5,226,5,234,5,242,5,250,6,2,6,10,6,18,6,26,
+6,34,6,42,6,50,6,58,6,66,6,74,6,82,6,90,6,98,6,106,6,114,6,122,6,130,6,138,
+6,146,6,154,6,162,6,170,6,178,6,186,6,194,6,202,6,210,6,218,0,2,4,41,255,
+206,0,41,0,2,6,11,255,206,0,82,0,2,4,169,255,206,0,27,0,2,8,118,255,206,0,
+68,0,2,5,217,255,206,0,70,0,2,6,20,255,206,0,42,0,2,6,20,255,206,0,46,0,2,
+10,73,255,206,0,71,0,2,7,212,255,206,0,75,0,2,6,42,255,206,0,61,0,2,4,191,
+255,206,0,39,0,2,5,236,255,206,0,56,0,2,5,236,255,206,0,60,0,2,6,156,255,
+206,0,77,0,2,6,58,255,206,0,60,0,2,5,166,255,206,0,55,0,2,5,166,255,206,0,
+41,0,2,5,166,255,206,0,45,0,2,5,157,255,206,0,42,0,2,6,0,255,206,0,62,0,2,
+6,0,255,206,0,66,0,2,8,118,255,206,0,66,0,2,10,73,255,206,0,0,0,2,4,191,255,
+206,0,28,0,2,6,143,255,206,0,71,0,2,5,172,255,206,0,42,0,2,5,41,255,206,0,
+65,0,2,4,102,255,206,0,56,0,2,5,177,255,206,0,61,0,2,5,157,255,206,0,41,0,
+2,8,68,255,206,0,71,0,2,4,41,255,206,0,71,0,2,6,11,255,206,0,109,0,2,4,169,
+255,206,0,54,0,2,8,118,255,206,0,96,0,2,5,217,255,206,0,70,0,2,6,20,255,206,
+0,70,0,2,6,20,255,206,0,74,0,2,5,217,255,206,0,103,0,2,10,73,255,206,0,99,
+0,2,7,212,255,206,0,75,0,2,6,42,255,206,0,89,0,2,4,191,255,206,0,64,0,2,5,
+236,255,206,0,82,0,2,5,236,255,206,0,86,0,2,6,156,255,206,0,104,0,2,6,58,
+255,206,0,88,0,2,5,166,255,206,0,82,0,2,5,166,255,206,0,67,0,2,5,166,255,
+206,0,71,0,2,5,157,255,206,0,68,0,2,5,177,255,206,0,49,0,2,5,177,255,206,
+0,53,0,2,6,0,255,206,0,90,0,2,6,0,255,206,0,94,0,2,8,118,255,206,0,95,0,2,
+10,73,255,206,0,94,0,2,4,191,255,206,0,53,0,2,6,143,255,206,0,98,0,2,5,172,
+255,206,0,70,0,2,5,41,255,206,0,89,0,2,5,177,255,206,0,72,0,2,4,102,255,206,
+0,81,0,2,5,177,255,206,0,64,0,2,5,157,255,206,0,46,0,2,10,73,255,206,0,96,
+0,2,5,217,255,206,0,102,0,2,5,217,255,206,0,127,0,2,7,252,255,206,0,94,0,
+2,7,252,255,206,0,98,0,2,7,252,255,206,0,101,0,2,4,41,255,206,0,41,0,2,6,
+11,255,206,0,135,0,2,4,169,255,206,0,27,0,2,8,118,255,206,0,87,0,2,5,217,
+255,206,0,70,0,2,6,20,255,206,0,96,0,2,6,20,255,206,0,100,0,2,5,217,255,206,
+0,131,0,2,10,73,255,206,0,90,0,2,7,212,255,206,0,75,0,2,6,42,255,206,0,114,
+0,2,4,191,255,206,0,39,0,2,5,236,255,206,0,56,0,2,5,236,255,206,0,60,0,2,
+6,156,255,206,0,77,0,2,6,58,255,206,0,116,0,2,5,166,255,206,0,55,0,2,5,166,
+255,206,0,41,0,2,5,166,255,206,0,45,0,2,5,157,255,206,0,94,0,2,5,177,255,
+206,0,102,0,2,5,177,255,206,0,106,0,2,6,0,255,206,0,115,0,2,6,0,255,206,0,
+119,0,2,8,118,255,206,0,87,0,2,10,73,255,206,0,87,0,2,4,191,255,206,0,28,
+0,2,6,143,255,206,0,71,0,2,5,172,255,206,0,98,0,2,5,41,255,206,0,117,0,2,
+5,177,255,206,0,98,0,2,4,102,255,206,0,111,0,2,5,177,255,206,0,117,0,2,5,
+157,255,206,0,99,0,2,8,68,255,206,0,71,0,2,4,41,255,206,0,41,0,2,6,11,255,
+206,0,148,0,2,4,169,255,206,0,27,0,2,8,118,255,206,0,96,0,2,5,217,255,206,
+0,70,0,2,6,20,255,206,0,110,0,2,6,20,255,206,0,114,0,2,5,217,255,206,0,145,
+0,2,10,73,255,206,0,99,0,2,7,212,255,206,0,75,0,2,6,42,255,206,0,128,0,2,
+4,191,255,206,0,39,0,2,5,236,255,206,0,56,0,2,5,236,255,206,0,60,0,2,6,156,
+255,206,0,77,0,2,6,58,255,206,0,130,0,2,5,166,255,206,0,55,0,2,5,166,255,
+206,0,41,0,2,5,166,255,206,0,45,0,2,5,157,255,206,0,108,0,2,5,177,255,206,
+0,117,0,2,5,177,255,206,0,121,0,2,6,0,255,206,0,129,0,2,6,0,255,206,0,133,
+0,2,8,118,255,206,0,96,0,2,10,73,255,206,0,94,0,2,4,191,255,206,0,28,0,2,
+6,143,255,206,0,71,0,2,5,172,255,206,0,112,0,2,5,41,255,206,0,131,0,2,5,177,
+255,206,0,112,0,2,4,102,255,206,0,125,0,2,5,177,255,206,0,132,0,2,5,157,255,
+206,0,114,0,2,8,68,255,206,0,71,0,2,4,41,255,206,0,41,0,2,6,11,255,206,0,
+82,0,2,4,169,255,206,0,27,0,2,8,118,255,206,0,67,0,2,5,217,255,206,0,70,0,
+2,6,20,255,206,0,42,0,2,6,20,255,206,0,46,0,2,5,217,255,206,0,82,0,2,10,73,
+255,206,0,70,0,2,7,212,255,206,0,121,0,2,6,42,255,206,0,61,0,2,4,191,255,
+206,0,39,0,2,5,236,255,206,0,56,0,2,5,236,255,206,0,60,0,2,6,156,255,206,
+0,77,0,2,6,58,255,206,0,60,0,2,5,166,255,206,0,55,0,2,5,166,255,206,0,41,
+0,2,5,166,255,206,0,45,0,2,5,157,255,206,0,43,0,2,5,177,255,206,0,49,0,2,
+5,177,255,206,0,99,0,2,6,0,255,206,0,62,0,2,6,0,255,206,0,66,0,2,8,118,255,
+206,0,66,0,2,10,73,255,206,0,67,0,2,4,191,255,206,0,28,0,2,6,143,255,206,
+0,71,0,2,5,172,255,206,0,43,0,2,5,41,255,206,0,65,0,2,5,177,255,206,0,47,
+0,2,4,102,255,206,0,102,0,2,5,177,255,206,0,110,0,2,5,157,255,206,0,92,0,
+2,8,68,255,206,0,117,0,1,0,0,0,10,0,70,0,204,0,2,116,101,108,50,0,14,116,
+101,108,117,0,18,0,8,0,0,0,22,0,0,0,0,255,255,0,6,0,2,0,4,0,0,0,5,0,8,0,7,
+0,0,255,255,0,7,0,1,0,3,0,6,0,0,0,5,0,8,0,7,0,9,97,98,118,115,0,56,97,107,
+104,110,0,62,97,107,104,110,0,68,98,108,119,102,0,74,98,108,119,102,0,84,
+98,108,119,115,0,96,104,97,108,102,0,104,104,97,108,110,0,110,112,115,116,
+115,0,116,0,0,0,1,0,11,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,3,0,2,0,6,0,7,0,0,0,
+4,0,3,0,5,0,6,0,7,0,0,0,2,0,12,0,14,0,0,0,1,0,10,0,0,0,1,0,33,0,0,0,7,0,15,
+0,20,0,21,0,23,0,25,0,27,0,30,0,70,0,142,0,176,0,210,2,142,2,178,2,208,4,
+0,4,86,6,6,6,26,6,46,8,68,17,242,18,242,19,160,21,104,22,214,22,240,23,10,
+23,36,23,90,23,196,25,46,25,74,25,238,26,100,27,144,27,218,28,96,28,214,28,
+246,29,32,29,52,29,72,31,22,33,94,33,114,33,134,33,154,33,174,33,194,33,214,
+33,234,33,254,34,18,34,38,34,58,34,78,34,98,34,118,34,138,34,158,34,178,34,
+198,34,218,34,238,35,2,35,22,35,42,35,62,35,82,35,102,35,122,35,142,35,162,
+35,182,35,202,35,222,35,242,36,6,0,4,0,8,0,1,0,8,0,1,0,20,0,1,0,8,0,1,0,4,
+0,101,0,3,0,53,0,70,0,1,0,1,0,21,0,4,0,8,0,1,0,8,0,1,0,20,0,1,0,8,0,1,0,4,
+0,101,0,3,0,70,0,53,0,1,0,1,0,21,0,4,0,0,0,1,0,8,0,1,1,170,0,35,0,76,0,86,
+0,96,0,106,0,116,0,126,0,136,0,146,0,156,0,166,0,176,0,186,0,196,0,206,0,
+216,0,226,0,236,0,246,1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,1,80,1,90,1,
+100,1,110,1,120,1,130,1,140,1,150,1,160,0,1,0,4,1,214,0,2,0,70,0,1,0,4,1,
+215,0,2,0,70,0,1,0,4,1,216,0,2,0,70,0,1,0,4,1,217,0,2,0,70,0,1,0,4,1,218,
+0,2,0,70,0,1,0,4,1,219,0,2,0,70,0,1,0,4,1,220,0,2,0,70,0,1,0,4,1,221,0,2,
+0,70,0,1,0,4,1,222,0,2,0,70,0,1,0,4,1,223,0,2,0,70,0,1,0,4,1,224,0,2,0,70,
+0,1,0,4,1,225,0,2,0,70,0,1,0,4,1,226,0,2,0,70,0,1,0,4,1,227,0,2,0,70,0,1,
+0,4,1,228,0,2,0,70,0,1,0,4,1,229,0,2,0,70,0,1,0,4,1,230,0,2,0,70,0,1,0,4,
+1,231,0,2,0,70,0,1,0,4,1,232,0,2,0,70,0,1,0,4,1,233,0,2,0,70,0,1,0,4,1,234,
+0,2,0,70,0,1,0,4,1,235,0,2,0,70,0,1,0,4,1,236,0,2,0,70,0,1,0,4,1,237,0,2,
+0,70,0,1,0,4,1,238,0,2,0,70,0,1,0,4,1,239,0,2,0,70,0,1,0,4,1,240,0,2,0,70,
+0,1,0,4,1,241,0,2,0,70,0,1,0,4,1,242,0,2,0,70,0,1,0,4,1,243,0,2,0,70,0,1,
+0,4,1,244,0,2,0,70,0,1,0,4,1,245,0,2,0,70,0,1,0,4,1,246,0,2,0,70,0,1,0,4,
+1,247,0,2,0,70,0,1,0,4,1,248,0,2,0,70,0,2,0,1,0,21,0,55,0,0,0,5,0,0,0,1,0,
+8,0,1,0,8,0,1,0,14,0,1,0,1,0,70,0,1,0,4,0,2,0,1,0,101,0,1,0,4,0,2,0,0,0,1,
+0,8,0,1,0,16,0,1,0,8,0,3,0,21,0,70,0,53,0,1,0,1,0,101,0,4,0,0,0,1,0,8,0,1,
+1,34,0,1,0,8,0,35,0,72,0,78,0,84,0,90,0,96,0,102,0,108,0,114,0,120,0,126,
+0,132,0,138,0,144,0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,
+204,0,210,0,216,0,222,0,228,0,234,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,214,
+0,2,0,21,1,215,0,2,0,22,1,216,0,2,0,23,1,217,0,2,0,24,1,218,0,2,0,25,1,219,
+0,2,0,26,1,220,0,2,0,27,1,221,0,2,0,28,1,222,0,2,0,29,1,223,0,2,0,30,1,224,
+0,2,0,31,1,225,0,2,0,32,1,226,0,2,0,33,1,227,0,2,0,34,1,228,0,2,0,35,1,229,
+0,2,0,36,1,230,0,2,0,37,1,231,0,2,0,38,1,232,0,2,0,39,1,233,0,2,0,40,1,234,
+0,2,0,41,1,235,0,2,0,42,1,236,0,2,0,43,1,237,0,2,0,44,1,238,0,2,0,45,1,239,
+0,2,0,46,1,240,0,2,0,47,1,241,0,2,0,48,1,242,0,2,0,49,1,243,0,2,0,50,1,244,
+0,2,0,51,1,245,0,2,0,52,1,246,0,2,0,53,1,247,0,2,0,54,1,248,0,2,0,55,0,1,
+0,1,0,70,0,6,0,0,0,1,0,8,0,2,0,16,0,22,0,44,0,52,0,2,0,0,0,60,0,1,0,1,1,240,
+0,2,0,3,0,72,0,72,0,1,1,214,1,248,0,1,2,37,2,71,0,1,0,1,1,240,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,4,0,1,0,0,0,1,0,0,0,1,0,0,0,34,0,6,0,0,0,1,0,8,0,2,0,18,
+0,34,0,176,0,216,0,3,0,0,0,224,1,132,0,1,0,6,1,221,1,224,1,226,1,229,1,231,
+1,242,0,2,0,23,0,21,0,21,0,1,0,22,0,22,0,4,0,23,0,23,0,1,0,24,0,24,0,2,0,
+27,0,27,0,4,0,29,0,30,0,2,0,32,0,32,0,1,0,34,0,34,0,4,0,35,0,35,0,2,0,37,
+0,37,0,4,0,39,0,39,0,4,0,42,0,42,0,4,0,44,0,44,0,4,0,45,0,46,0,2,0,47,0,47,
+0,1,0,48,0,48,0,2,0,52,0,52,0,1,0,53,0,53,0,3,0,55,0,55,0,2,0,57,0,61,0,5,
+0,64,0,65,0,5,0,67,0,69,0,5,0,72,0,72,0,6,0,2,0,6,1,221,1,221,0,2,1,224,1,
+224,0,2,1,226,1,226,0,2,1,229,1,229,0,1,1,231,1,231,0,2,1,242,1,242,0,2,0,
+1,0,1,0,1,0,1,0,9,0,20,0,34,0,48,0,62,0,78,0,94,0,110,0,128,0,146,0,1,0,1,
+0,1,0,0,0,1,0,0,0,8,0,1,0,2,0,1,0,0,0,1,0,0,0,9,0,1,0,3,0,1,0,0,0,1,0,0,0,
+19,0,2,0,5,0,1,0,1,0,0,0,1,0,0,0,8,0,2,0,5,0,2,0,1,0,0,0,1,0,0,0,9,0,2,0,
+5,0,3,0,1,0,0,0,1,0,0,0,19,0,3,0,6,0,5,0,1,0,1,0,0,0,1,0,0,0,8,0,3,0,6,0,
+5,0,2,0,1,0,0,0,1,0,0,0,9,0,3,0,6,0,5,0,3,0,1,0,0,0,1,0,0,0,19,0,2,0,6,0,
+20,0,1,0,4,0,1,0,0,0,1,0,0,0,19,0,2,0,5,0,4,0,1,0,0,0,1,0,0,0,19,0,1,0,0,
+0,1,0,8,0,1,0,6,0,100,0,1,0,1,1,229,0,1,0,0,0,1,0,8,0,1,0,6,0,101,0,1,0,1,
+1,229,0,4,0,0,0,1,0,8,0,1,1,254,0,36,0,78,0,90,0,102,0,114,0,126,0,138,0,
+150,0,162,0,174,0,186,0,198,0,210,0,222,0,234,0,246,1,2,1,14,1,26,1,38,1,
+50,1,62,1,74,1,86,1,98,1,110,1,122,1,134,1,146,1,158,1,170,1,182,1,194,1,
+206,1,218,1,230,1,242,0,1,0,4,0,102,0,3,0,70,0,99,0,1,0,4,0,103,0,3,0,70,
+0,99,0,1,0,4,0,104,0,3,0,70,0,99,0,1,0,4,0,105,0,3,0,70,0,99,0,1,0,4,0,106,
+0,3,0,70,0,99,0,1,0,4,0,107,0,3,0,70,0,99,0,1,0,4,0,108,0,3,0,70,0,99,0,1,
+0,4,0,109,0,3,0,70,0,99,0,1,0,4,0,110,0,3,0,70,0,99,0,1,0,4,0,111,0,3,0,70,
+0,99,0,1,0,4,0,112,0,3,0,70,0,99,0,1,0,4,0,113,0,3,0,70,0,99,0,1,0,4,0,114,
+0,3,0,70,0,99,0,1,0,4,0,115,0,3,0,70,0,99,0,1,0,4,0,116,0,3,0,70,0,99,0,1,
+0,4,0,117,0,3,0,70,0,99,0,1,0,4,0,118,0,3,0,70,0,99,0,1,0,4,0,119,0,3,0,70,
+0,99,0,1,0,4,0,120,0,3,0,70,0,99,0,1,0,4,0,121,0,3,0,70,0,99,0,1,0,4,0,122,
+0,3,0,70,0,99,0,1,0,4,0,123,0,3,0,70,0,99,0,1,0,4,0,124,0,3,0,70,0,99,0,1,
+0,4,0,125,0,3,0,70,0,99,0,1,0,4,0,126,0,3,0,70,0,99,0,1,0,4,0,127,0,3,0,70,
+0,99,0,1,0,4,0,128,0,3,0,70,0,99,0,1,0,4,0,129,0,3,0,70,0,99,0,1,0,4,0,130,
+0,3,0,70,0,99,0,1,0,4,0,131,0,3,0,70,0,99,0,1,0,4,0,132,0,3,0,70,0,99,0,1,
+0,4,0,133,0,3,0,70,0,99,0,1,0,4,0,134,0,3,0,70,0,99,0,1,0,4,0,135,0,3,0,70,
+0,99,0,1,0,4,0,136,0,3,0,70,0,99,0,1,0,4,0,137,0,3,0,70,0,99,0,2,0,2,0,21,
+0,55,0,0,0,101,0,101,0,35,0,4,0,0,0,1,0,8,0,1,9,150,0,36,0,78,0,144,0,210,
+1,20,1,86,1,152,1,218,2,28,2,94,2,160,2,226,3,36,3,102,3,168,3,234,4,44,4,
+110,4,176,4,242,5,52,5,118,5,184,5,250,6,60,6,126,6,192,7,2,7,68,7,134,7,
+200,8,10,8,76,8,142,8,208,9,18,9,84,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,
+0,60,0,138,0,2,0,57,0,174,0,2,0,58,0,210,0,2,0,59,0,254,0,2,0,64,1,34,0,2,
+0,65,1,106,0,2,0,67,1,142,0,2,0,68,1,178,0,2,0,69,0,8,0,18,0,24,0,30,0,36,
+0,42,0,48,0,54,0,60,0,139,0,2,0,57,0,175,0,2,0,58,0,211,0,2,0,59,0,255,0,
+2,0,64,1,35,0,2,0,65,1,107,0,2,0,67,1,143,0,2,0,68,1,179,0,2,0,69,0,8,0,18,
+0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,140,0,2,0,57,0,176,0,2,0,58,0,212,0,
+2,0,59,1,0,0,2,0,64,1,36,0,2,0,65,1,108,0,2,0,67,1,144,0,2,0,68,1,180,0,2,
+0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,141,0,2,0,57,0,177,0,2,
+0,58,0,213,0,2,0,59,1,1,0,2,0,64,1,37,0,2,0,65,1,109,0,2,0,67,1,145,0,2,0,
+68,1,181,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,142,0,2,0,
+57,0,178,0,2,0,58,0,214,0,2,0,59,1,2,0,2,0,64,1,38,0,2,0,65,1,110,0,2,0,67,
+1,146,0,2,0,68,1,182,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,
+0,143,0,2,0,57,0,179,0,2,0,58,0,215,0,2,0,59,1,3,0,2,0,64,1,39,0,2,0,65,1,
+111,0,2,0,67,1,147,0,2,0,68,1,183,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,
+48,0,54,0,60,0,144,0,2,0,57,0,180,0,2,0,58,0,216,0,2,0,59,1,4,0,2,0,64,1,
+40,0,2,0,65,1,112,0,2,0,67,1,148,0,2,0,68,1,184,0,2,0,69,0,8,0,18,0,24,0,
+30,0,36,0,42,0,48,0,54,0,60,0,145,0,2,0,57,0,181,0,2,0,58,0,217,0,2,0,59,
+1,5,0,2,0,64,1,41,0,2,0,65,1,113,0,2,0,67,1,149,0,2,0,68,1,185,0,2,0,69,0,
+8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,146,0,2,0,57,0,182,0,2,0,58,0,
+218,0,2,0,59,1,6,0,2,0,64,1,42,0,2,0,65,1,114,0,2,0,67,1,150,0,2,0,68,1,186,
+0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,147,0,2,0,57,0,183,
+0,2,0,58,0,219,0,2,0,59,1,7,0,2,0,64,1,43,0,2,0,65,1,115,0,2,0,67,1,151,0,
+2,0,68,1,187,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,148,0,
+2,0,57,0,184,0,2,0,58,0,220,0,2,0,59,1,8,0,2,0,64,1,44,0,2,0,65,1,116,0,2,
+0,67,1,152,0,2,0,68,1,188,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,
+0,60,0,149,0,2,0,57,0,185,0,2,0,58,0,221,0,2,0,59,1,9,0,2,0,64,1,45,0,2,0,
+65,1,117,0,2,0,67,1,153,0,2,0,68,1,189,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,
+42,0,48,0,54,0,60,0,150,0,2,0,57,0,186,0,2,0,58,0,222,0,2,0,59,1,10,0,2,0,
+64,1,46,0,2,0,65,1,118,0,2,0,67,1,154,0,2,0,68,1,190,0,2,0,69,0,8,0,18,0,
+24,0,30,0,36,0,42,0,48,0,54,0,60,0,151,0,2,0,57,0,187,0,2,0,58,0,223,0,2,
+0,59,1,11,0,2,0,64,1,47,0,2,0,65,1,119,0,2,0,67,1,155,0,2,0,68,1,191,0,2,
+0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,152,0,2,0,57,0,188,0,2,
+0,58,0,224,0,2,0,59,1,12,0,2,0,64,1,48,0,2,0,65,1,120,0,2,0,67,1,156,0,2,
+0,68,1,192,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,153,0,2,
+0,57,0,189,0,2,0,58,0,225,0,2,0,59,1,13,0,2,0,64,1,49,0,2,0,65,1,121,0,2,
+0,67,1,157,0,2,0,68,1,193,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,
+0,60,0,154,0,2,0,57,0,190,0,2,0,58,0,226,0,2,0,59,1,14,0,2,0,64,1,50,0,2,
+0,65,1,122,0,2,0,67,1,158,0,2,0,68,1,194,0,2,0,69,0,8,0,18,0,24,0,30,0,36,
+0,42,0,48,0,54,0,60,0,155,0,2,0,57,0,191,0,2,0,58,0,227,0,2,0,59,1,15,0,2,
+0,64,1,51,0,2,0,65,1,123,0,2,0,67,1,159,0,2,0,68,1,195,0,2,0,69,0,8,0,18,
+0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,156,0,2,0,57,0,192,0,2,0,58,0,228,0,
+2,0,59,1,16,0,2,0,64,1,52,0,2,0,65,1,124,0,2,0,67,1,160,0,2,0,68,1,196,0,
+2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,157,0,2,0,57,0,193,0,
+2,0,58,0,229,0,2,0,59,1,17,0,2,0,64,1,53,0,2,0,65,1,125,0,2,0,67,1,161,0,
+2,0,68,1,197,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,158,0,
+2,0,57,0,194,0,2,0,58,0,230,0,2,0,59,1,18,0,2,0,64,1,54,0,2,0,65,1,126,0,
+2,0,67,1,162,0,2,0,68,1,198,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,
+54,0,60,0,159,0,2,0,57,0,195,0,2,0,58,0,231,0,2,0,59,1,19,0,2,0,64,1,55,0,
+2,0,65,1,127,0,2,0,67,1,163,0,2,0,68,1,199,0,2,0,69,0,8,0,18,0,24,0,30,0,
+36,0,42,0,48,0,54,0,60,0,160,0,2,0,57,0,196,0,2,0,58,0,232,0,2,0,59,1,20,
+0,2,0,64,1,56,0,2,0,65,1,128,0,2,0,67,1,164,0,2,0,68,1,200,0,2,0,69,0,8,0,
+18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,161,0,2,0,57,0,197,0,2,0,58,0,233,
+0,2,0,59,1,21,0,2,0,64,1,57,0,2,0,65,1,129,0,2,0,67,1,165,0,2,0,68,1,201,
+0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,162,0,2,0,57,0,198,
+0,2,0,58,0,234,0,2,0,59,1,22,0,2,0,64,1,58,0,2,0,65,1,130,0,2,0,67,1,166,
+0,2,0,68,1,202,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,163,
+0,2,0,57,0,199,0,2,0,58,0,235,0,2,0,59,1,23,0,2,0,64,1,59,0,2,0,65,1,131,
+0,2,0,67,1,167,0,2,0,68,1,203,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,
+0,54,0,60,0,164,0,2,0,57,0,200,0,2,0,58,0,236,0,2,0,59,1,24,0,2,0,64,1,60,
+0,2,0,65,1,132,0,2,0,67,1,168,0,2,0,68,1,204,0,2,0,69,0,8,0,18,0,24,0,30,
+0,36,0,42,0,48,0,54,0,60,0,165,0,2,0,57,0,201,0,2,0,58,0,237,0,2,0,59,1,25,
+0,2,0,64,1,61,0,2,0,65,1,133,0,2,0,67,1,169,0,2,0,68,1,205,0,2,0,69,0,8,0,
+18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,166,0,2,0,57,0,202,0,2,0,58,0,238,
+0,2,0,59,1,26,0,2,0,64,1,62,0,2,0,65,1,134,0,2,0,67,1,170,0,2,0,68,1,206,
+0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,167,0,2,0,57,0,203,
+0,2,0,58,0,239,0,2,0,59,1,27,0,2,0,64,1,63,0,2,0,65,1,135,0,2,0,67,1,171,
+0,2,0,68,1,207,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,168,
+0,2,0,57,0,204,0,2,0,58,0,240,0,2,0,59,1,28,0,2,0,64,1,64,0,2,0,65,1,136,
+0,2,0,67,1,172,0,2,0,68,1,208,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,
+0,54,0,60,0,169,0,2,0,57,0,205,0,2,0,58,0,241,0,2,0,59,1,29,0,2,0,64,1,65,
+0,2,0,65,1,137,0,2,0,67,1,173,0,2,0,68,1,209,0,2,0,69,0,8,0,18,0,24,0,30,
+0,36,0,42,0,48,0,54,0,60,0,170,0,2,0,57,0,206,0,2,0,58,0,242,0,2,0,59,1,30,
+0,2,0,64,1,66,0,2,0,65,1,138,0,2,0,67,1,174,0,2,0,68,1,210,0,2,0,69,0,8,0,
+18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,171,0,2,0,57,0,207,0,2,0,58,0,243,
+0,2,0,59,1,31,0,2,0,64,1,67,0,2,0,65,1,139,0,2,0,67,1,175,0,2,0,68,1,211,
+0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,172,0,2,0,57,0,208,
+0,2,0,58,0,244,0,2,0,59,1,32,0,2,0,64,1,68,0,2,0,65,1,140,0,2,0,67,1,176,
+0,2,0,68,1,212,0,2,0,69,0,8,0,18,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,173,
+0,2,0,57,0,209,0,2,0,58,0,245,0,2,0,59,1,33,0,2,0,64,1,69,0,2,0,65,1,141,
+0,2,0,67,1,177,0,2,0,68,1,213,0,2,0,69,0,2,0,2,0,21,0,55,0,0,0,101,0,101,
+0,35,0,6,0,0,0,1,0,8,0,2,0,22,0,30,0,100,0,182,0,5,0,0,0,190,0,228,0,0,0,
+0,0,1,0,2,0,72,1,229,0,2,0,11,0,101,0,101,0,1,0,137,0,137,0,1,0,173,0,173,
+0,1,0,209,0,209,0,1,0,245,0,245,0,1,1,33,1,33,0,1,1,69,1,69,0,1,1,105,1,105,
+0,1,1,141,1,141,0,1,1,177,1,177,0,1,1,213,1,213,0,1,0,2,0,13,0,72,0,72,0,
+1,1,215,1,217,0,3,1,221,1,221,0,3,1,224,1,224,0,3,1,226,1,226,0,3,1,228,1,
+228,0,3,1,229,1,229,0,2,1,230,1,232,0,3,1,240,1,240,0,4,1,242,1,242,0,3,1,
+246,1,246,0,3,1,248,1,248,0,3,2,73,2,75,0,3,0,1,0,1,0,1,0,1,0,2,0,6,0,22,
+0,1,0,0,0,2,0,2,0,0,0,1,0,0,0,13,0,1,0,0,0,2,0,3,0,0,0,1,0,0,0,13,0,1,0,4,
+0,1,0,0,0,2,0,4,0,0,0,1,0,0,0,13,0,4,0,0,0,1,0,8,0,1,0,158,0,2,0,10,0,148,
+0,17,0,36,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,96,0,102,0,108,0,
+114,0,120,0,126,0,132,2,79,0,2,1,215,2,80,0,2,1,216,2,81,0,2,1,217,2,82,0,
+2,1,221,2,83,0,2,1,224,2,84,0,2,1,226,2,85,0,2,1,228,2,77,0,2,1,229,2,86,
+0,2,1,230,2,87,0,2,1,231,2,88,0,2,1,232,2,89,0,2,1,242,2,90,0,2,1,246,2,91,
+0,2,1,248,2,76,0,2,2,73,2,78,0,2,2,74,2,77,0,2,2,75,0,1,0,4,2,92,0,2,1,240,
+0,1,0,2,0,72,1,229,0,4,0,0,0,1,0,8,0,1,1,182,0,36,0,78,0,88,0,98,0,108,0,
+118,0,128,0,138,0,148,0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,228,0,238,
+0,248,1,2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,1,92,1,102,1,112,1,122,
+1,132,1,142,1,152,1,162,1,172,0,1,0,4,1,70,0,2,0,72,0,1,0,4,1,71,0,2,0,72,
+0,1,0,4,1,72,0,2,0,72,0,1,0,4,1,73,0,2,0,72,0,1,0,4,1,74,0,2,0,72,0,1,0,4,
+1,75,0,2,0,72,0,1,0,4,1,76,0,2,0,72,0,1,0,4,1,77,0,2,0,72,0,1,0,4,1,78,0,
+2,0,72,0,1,0,4,1,79,0,2,0,72,0,1,0,4,1,80,0,2,0,72,0,1,0,4,1,81,0,2,0,72,
+0,1,0,4,1,82,0,2,0,72,0,1,0,4,1,83,0,2,0,72,0,1,0,4,1,84,0,2,0,72,0,1,0,4,
+1,85,0,2,0,72,0,1,0,4,1,86,0,2,0,72,0,1,0,4,1,87,0,2,0,72,0,1,0,4,1,88,0,
+2,0,72,0,1,0,4,1,89,0,2,0,72,0,1,0,4,1,90,0,2,0,72,0,1,0,4,1,91,0,2,0,72,
+0,1,0,4,1,92,0,2,0,72,0,1,0,4,1,93,0,2,0,72,0,1,0,4,1,94,0,2,0,72,0,1,0,4,
+1,95,0,2,0,72,0,1,0,4,1,96,0,2,0,72,0,1,0,4,1,97,0,2,0,72,0,1,0,4,1,98,0,
+2,0,72,0,1,0,4,1,99,0,2,0,72,0,1,0,4,1,100,0,2,0,72,0,1,0,4,1,101,0,2,0,72,
+0,1,0,4,1,102,0,2,0,72,0,1,0,4,1,103,0,2,0,72,0,1,0,4,1,104,0,2,0,72,0,1,
+0,4,1,105,0,2,0,72,0,2,0,1,0,254,1,33,0,0,0,6,0,0,0,1,0,8,0,1,0,18,0,6,0,
+34,0,84,0,134,0,244,1,26,1,64,0,1,0,6,0,60,0,61,1,229,2,57,2,58,2,67,0,3,
+0,8,0,22,0,36,0,1,0,50,0,1,0,0,0,1,0,0,0,16,0,1,0,55,0,1,0,0,0,1,0,0,0,17,
+0,1,0,30,0,1,0,0,0,1,0,0,0,18,0,3,0,8,0,22,0,36,0,1,0,50,0,1,0,0,0,1,0,0,
+0,16,0,1,0,55,0,1,0,0,0,1,0,0,0,17,0,1,0,30,0,1,0,0,0,1,0,0,0,18,0,6,0,14,
+0,30,0,46,0,62,0,78,0,94,0,2,0,60,0,41,0,1,0,0,0,1,0,0,0,19,0,2,0,60,0,42,
+0,1,0,0,0,1,0,0,0,19,0,2,0,60,0,51,0,1,0,0,0,1,0,0,0,19,0,2,0,61,0,41,0,1,
+0,0,0,1,0,0,0,19,0,2,0,61,0,42,0,1,0,0,0,1,0,0,0,19,0,2,0,61,0,51,0,1,0,0,
+0,1,0,0,0,19,0,2,0,6,0,22,0,2,0,60,0,41,0,1,0,0,0,1,0,0,0,19,0,2,0,61,0,41,
+0,1,0,0,0,1,0,0,0,19,0,2,0,6,0,22,0,2,0,60,0,42,0,1,0,0,0,1,0,0,0,19,0,2,
+0,61,0,42,0,1,0,0,0,1,0,0,0,19,0,2,0,6,0,22,0,2,0,60,0,51,0,1,0,0,0,1,0,0,
+0,19,0,2,0,61,0,51,0,1,0,0,0,1,0,0,0,19,0,1,0,0,0,1,0,8,0,2,0,10,0,2,1,249,
+1,252,0,1,0,2,0,60,0,61,0,1,0,0,0,1,0,8,0,2,0,10,0,2,1,250,1,253,0,1,0,2,
+0,60,0,61,0,1,0,0,0,1,0,8,0,2,0,10,0,2,1,251,1,254,0,1,0,2,0,60,0,61,0,1,
+0,0,0,1,0,8,0,2,0,24,0,9,2,94,2,95,2,96,2,75,2,97,2,98,2,72,2,72,2,72,0,1,
+0,9,1,221,1,224,1,226,1,229,1,231,1,242,2,57,2,58,2,67,0,4,0,0,0,1,0,8,0,
+1,0,86,0,4,0,14,0,32,0,50,0,68,0,2,0,6,0,12,0,246,0,2,0,60,0,250,0,2,0,61,
+0,2,0,6,0,12,0,247,0,2,0,60,0,251,0,2,0,61,0,2,0,6,0,12,0,248,0,2,0,60,0,
+252,0,2,0,61,0,2,0,6,0,12,0,249,0,2,0,60,0,253,0,2,0,61,0,1,0,4,0,28,0,41,
+0,42,0,51,0,6,0,0,0,1,0,8,0,2,0,20,0,54,0,178,1,4,0,4,0,0,1,12,1,46,1,64,
+0,2,0,5,0,62,0,63,0,0,0,77,0,78,0,2,1,214,1,239,0,4,1,241,1,248,0,30,2,92,
+2,92,0,38,0,2,0,20,0,101,0,101,0,1,0,137,0,137,0,1,0,173,0,173,0,1,0,209,
+0,209,0,1,0,245,0,245,0,1,1,33,1,33,0,1,1,69,1,72,0,1,1,73,1,73,0,2,1,74,
+1,77,0,1,1,78,1,78,0,2,1,79,1,93,0,1,1,94,1,95,0,2,1,96,1,105,0,1,1,141,1,
+141,0,1,1,177,1,177,0,1,1,213,1,228,0,1,1,230,1,248,0,1,1,255,2,32,0,1,2,
+76,2,92,0,1,2,94,2,98,0,1,0,2,0,13,0,62,0,63,0,2,0,77,0,78,0,2,1,214,1,214,
+0,2,1,215,1,218,0,1,1,219,1,220,0,2,1,221,1,232,0,1,1,233,1,239,0,2,1,241,
+1,242,0,1,1,243,1,245,0,2,1,246,1,246,0,1,1,247,1,247,0,2,1,248,1,248,0,1,
+2,92,2,92,0,3,0,1,0,1,0,1,0,1,0,2,0,6,0,20,0,1,0,1,0,1,0,0,0,1,0,0,0,24,0,
+1,0,2,0,1,0,0,0,1,0,0,0,24,0,1,0,4,0,1,0,1,0,1,0,0,0,1,0,0,0,24,0,2,0,6,0,
+20,0,1,0,1,0,1,0,0,0,1,0,0,0,22,0,1,0,2,0,1,0,0,0,1,0,0,0,22,0,2,0,0,0,1,
+0,8,0,1,0,14,0,1,0,8,0,2,2,14,1,240,0,1,0,1,2,92,0,6,0,0,0,1,0,8,0,2,0,18,
+0,46,0,68,0,96,0,3,0,0,0,104,0,138,0,2,0,4,0,62,0,63,0,0,0,77,0,78,0,2,1,
+214,1,239,0,4,1,241,1,248,0,30,0,2,0,3,1,229,1,229,0,2,2,37,2,72,0,1,2,73,
+2,75,0,2,0,2,0,4,0,62,0,63,0,2,0,77,0,78,0,1,1,214,1,239,0,1,1,241,1,248,
+0,1,0,1,0,1,0,1,0,1,0,2,0,6,0,20,0,1,0,1,0,1,0,0,0,1,0,0,0,24,0,1,0,2,0,1,
+0,0,0,1,0,0,0,24,0,1,0,4,0,1,0,2,0,1,0,0,0,1,0,0,0,24,0,1,0,0,0,1,0,8,0,2,
+0,82,0,38,2,33,2,34,2,35,2,36,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,
+9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,
+24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,0,2,0,4,0,62,0,63,0,0,0,77,0,78,
+0,2,1,214,1,239,0,4,1,241,1,248,0,30,0,6,0,0,0,1,0,8,0,2,0,16,0,48,0,214,
+0,248,0,2,0,0,1,0,0,1,0,14,1,255,2,4,2,5,2,18,2,19,2,20,2,21,2,22,2,23,2,
+24,2,27,2,28,2,29,2,31,0,2,0,27,0,60,0,61,0,1,0,138,0,172,0,1,0,173,0,173,
+0,3,0,208,0,208,0,1,0,235,0,235,0,1,0,244,0,244,0,1,0,246,0,246,0,1,0,250,
+0,253,0,1,1,32,1,32,0,1,1,68,1,68,0,1,1,104,1,104,0,1,1,106,1,108,0,1,1,110,
+1,113,0,1,1,115,1,129,0,1,1,132,1,140,0,1,1,141,1,141,0,3,1,142,1,144,0,1,
+1,146,1,176,0,1,1,177,1,177,0,3,1,178,1,212,0,1,1,213,1,213,0,3,1,214,1,214,
+0,2,1,219,1,220,0,2,1,233,1,239,0,2,1,243,1,245,0,2,1,247,1,247,0,2,1,249,
+1,254,0,1,0,2,0,5,1,255,1,255,0,1,2,4,2,5,0,1,2,18,2,24,0,1,2,27,2,29,0,1,
+2,31,2,31,0,1,0,1,0,1,0,1,0,1,0,2,0,6,0,22,0,2,0,0,0,1,0,1,0,0,0,1,0,0,0,
+26,0,1,0,3,0,1,0,0,0,1,0,0,0,26,0,1,0,0,0,1,0,8,0,2,0,34,0,14,1,214,1,219,
+1,220,1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,243,1,244,1,245,1,247,0,
+1,0,14,1,255,2,4,2,5,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,27,2,28,2,29,2,
+31,0,5,0,0,0,1,0,8,0,2,0,14,0,38,0,3,0,0,0,108,0,0,0,1,0,10,0,101,0,137,0,
+173,0,209,0,245,1,33,1,69,1,141,1,177,1,213,0,2,0,11,0,101,0,101,0,1,0,137,
+0,137,0,1,0,173,0,173,0,1,0,209,0,209,0,1,0,245,0,245,0,1,1,33,1,33,0,1,1,
+69,1,69,0,1,1,141,1,141,0,1,1,177,1,177,0,1,1,213,1,213,0,1,2,13,2,13,0,2,
+0,1,0,4,0,2,0,2,0,2,0,0,0,28,0,1,0,29,0,2,0,0,0,1,0,8,0,1,0,86,0,10,0,26,
+0,32,0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,2,0,21,1,246,0,2,0,102,1,246,
+0,2,0,138,1,246,0,2,0,174,1,246,0,2,0,210,1,246,0,2,0,254,1,246,0,2,1,34,
+1,246,0,2,1,106,1,246,0,2,1,142,1,246,0,2,1,178,1,246,0,1,0,10,0,101,0,137,
+0,173,0,209,0,245,1,33,1,69,1,141,1,177,1,213,0,4,0,0,0,1,0,8,0,1,0,18,0,
+1,0,8,0,1,0,4,2,93,0,2,2,13,0,1,0,1,1,246,0,5,0,0,0,1,0,8,0,1,0,8,0,1,0,14,
+0,1,0,1,0,101,0,1,0,4,0,3,0,2,0,60,1,228,0,2,0,32,0,0,0,31,0,1,0,0,0,1,0,
+8,0,1,0,6,255,176,0,1,0,1,0,101,0,1,0,0,0,1,0,8,0,1,0,6,0,121,0,1,0,1,1,228,
+0,4,0,12,0,1,0,8,0,1,1,182,0,36,0,78,0,88,0,98,0,108,0,118,0,128,0,138,0,
+148,0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,228,0,238,0,248,1,2,1,12,
+1,22,1,32,1,42,1,52,1,62,1,72,1,82,1,92,1,102,1,112,1,122,1,132,1,142,1,152,
+1,162,1,172,0,1,0,4,0,102,0,2,0,70,0,1,0,4,0,103,0,2,0,70,0,1,0,4,0,104,0,
+2,0,70,0,1,0,4,0,105,0,2,0,70,0,1,0,4,0,106,0,2,0,70,0,1,0,4,0,107,0,2,0,
+70,0,1,0,4,0,108,0,2,0,70,0,1,0,4,0,109,0,2,0,70,0,1,0,4,0,110,0,2,0,70,0,
+1,0,4,0,111,0,2,0,70,0,1,0,4,0,112,0,2,0,70,0,1,0,4,0,113,0,2,0,70,0,1,0,
+4,0,114,0,2,0,70,0,1,0,4,0,115,0,2,0,70,0,1,0,4,0,116,0,2,0,70,0,1,0,4,0,
+117,0,2,0,70,0,1,0,4,0,118,0,2,0,70,0,1,0,4,0,119,0,2,0,70,0,1,0,4,0,120,
+0,2,0,70,0,1,0,4,0,121,0,2,0,70,0,1,0,4,0,122,0,2,0,70,0,1,0,4,0,123,0,2,
+0,70,0,1,0,4,0,124,0,2,0,70,0,1,0,4,0,125,0,2,0,70,0,1,0,4,0,126,0,2,0,70,
+0,1,0,4,0,127,0,2,0,70,0,1,0,4,0,128,0,2,0,70,0,1,0,4,0,129,0,2,0,70,0,1,
+0,4,0,130,0,2,0,70,0,1,0,4,0,131,0,2,0,70,0,1,0,4,0,132,0,2,0,70,0,1,0,4,
+0,133,0,2,0,70,0,1,0,4,0,134,0,2,0,70,0,1,0,4,0,135,0,2,0,70,0,1,0,4,0,136,
+0,2,0,70,0,1,0,4,0,137,0,2,0,70,0,2,0,2,0,21,0,55,0,0,0,101,0,101,0,35,0,
+6,0,8,0,1,0,8,0,1,0,8,0,1,0,14,0,1,0,1,1,240,0,35,0,72,0,86,0,100,0,114,0,
+128,0,142,0,156,0,170,0,184,0,198,0,212,0,226,0,240,0,254,1,12,1,26,1,40,
+1,54,1,68,1,82,1,96,1,110,1,124,1,138,1,152,1,166,1,180,1,194,1,208,1,222,
+1,236,1,250,2,8,2,22,2,36,0,1,0,21,0,1,0,0,0,1,0,0,0,35,0,1,0,22,0,1,0,0,
+0,1,0,0,0,36,0,1,0,23,0,1,0,0,0,1,0,0,0,37,0,1,0,24,0,1,0,0,0,1,0,0,0,38,
+0,1,0,25,0,1,0,0,0,1,0,0,0,39,0,1,0,26,0,1,0,0,0,1,0,0,0,40,0,1,0,27,0,1,
+0,0,0,1,0,0,0,41,0,1,0,28,0,1,0,0,0,1,0,0,0,42,0,1,0,29,0,1,0,0,0,1,0,0,0,
+43,0,1,0,30,0,1,0,0,0,1,0,0,0,44,0,1,0,31,0,1,0,0,0,1,0,0,0,45,0,1,0,32,0,
+1,0,0,0,1,0,0,0,46,0,1,0,33,0,1,0,0,0,1,0,0,0,47,0,1,0,34,0,1,0,0,0,1,0,0,
+0,48,0,1,0,35,0,1,0,0,0,1,0,0,0,49,0,1,0,36,0,1,0,0,0,1,0,0,0,50,0,1,0,37,
+0,1,0,0,0,1,0,0,0,51,0,1,0,38,0,1,0,0,0,1,0,0,0,52,0,1,0,39,0,1,0,0,0,1,0,
+0,0,53,0,1,0,40,0,1,0,0,0,1,0,0,0,54,0,1,0,41,0,1,0,0,0,1,0,0,0,55,0,1,0,
+42,0,1,0,0,0,1,0,0,0,56,0,1,0,43,0,1,0,0,0,1,0,0,0,57,0,1,0,44,0,1,0,0,0,
+1,0,0,0,58,0,1,0,45,0,1,0,0,0,1,0,0,0,59,0,1,0,46,0,1,0,0,0,1,0,0,0,60,0,
+1,0,47,0,1,0,0,0,1,0,0,0,61,0,1,0,48,0,1,0,0,0,1,0,0,0,62,0,1,0,49,0,1,0,
+0,0,1,0,0,0,63,0,1,0,50,0,1,0,0,0,1,0,0,0,64,0,1,0,51,0,1,0,0,0,1,0,0,0,65,
+0,1,0,52,0,1,0,0,0,1,0,0,0,66,0,1,0,53,0,1,0,0,0,1,0,0,0,67,0,1,0,54,0,1,
+0,0,0,1,0,0,0,68,0,1,0,55,0,1,0,0,0,1,0,0,0,69,0,1,0,0,0,1,0,8,0,1,0,6,0,
+53,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,54,0,1,0,1,1,240,0,1,0,0,0,1,0,
+8,0,1,0,6,0,55,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,56,0,1,0,1,1,240,0,
+1,0,0,0,1,0,8,0,1,0,6,0,57,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,58,0,1,
+0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,59,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,
+0,6,0,60,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,61,0,1,0,1,1,240,0,1,0,0,
+0,1,0,8,0,1,0,6,0,62,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,63,0,1,0,1,1,
+240,0,1,0,0,0,1,0,8,0,1,0,6,0,64,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,
+65,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,66,0,1,0,1,1,240,0,1,0,0,0,1,0,
+8,0,1,0,6,0,67,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,68,0,1,0,1,1,240,0,
+1,0,0,0,1,0,8,0,1,0,6,0,69,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,70,0,1,
+0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,71,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,
+0,6,0,72,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,73,0,1,0,1,1,240,0,1,0,0,
+0,1,0,8,0,1,0,6,0,74,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,75,0,1,0,1,1,
+240,0,1,0,0,0,1,0,8,0,1,0,6,0,76,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,
+77,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,78,0,1,0,1,1,240,0,1,0,0,0,1,0,
+8,0,1,0,6,0,79,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,80,0,1,0,1,1,240,0,
+1,0,0,0,1,0,8,0,1,0,6,0,81,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,82,0,1,
+0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,83,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,
+0,6,0,84,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,85,0,1,0,1,1,240,0,1,0,0,
+0,1,0,8,0,1,0,6,0,86,0,1,0,1,1,240,0,1,0,0,0,1,0,8,0,1,0,6,0,87,0,1,0,1,1,
+240,0,0,};
+#endif
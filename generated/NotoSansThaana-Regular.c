@@ -0,0 +1,621 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansThaana_Regular_ttf_size = 15284;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansThaana_Regular_ttf");
+asm(".type fz_font_NotoSansThaana_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansThaana_Regular_ttf, 15284");
+asm(".balign 64");
+asm("fz_font_NotoSansThaana_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansThaana-Regular.ttf\"");
+#else
+const int fz_font_NotoSansThaana_Regular_ttf_size = 15284;
+const char fz_font_NotoSansThaana_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,170,0,202,0,0,56,180,0,0,0,42,71,
+80,79,83,151,161,130,41,0,0,56,224,0,0,2,138,71,83,85,66,232,89,206,99,0,
+0,59,108,0,0,0,70,79,83,47,50,120,237,114,54,0,0,1,104,0,0,0,96,99,109,97,
+112,124,128,90,102,0,0,3,60,0,0,0,226,103,97,115,112,0,7,0,7,0,0,56,168,0,
+0,0,12,103,108,121,102,70,237,123,186,0,0,4,224,0,0,42,86,104,101,97,100,
+245,47,147,109,0,0,0,236,0,0,0,54,104,104,101,97,22,7,6,237,0,0,1,36,0,0,
+0,36,104,109,116,120,80,185,9,189,0,0,1,200,0,0,1,114,108,111,99,97,165,165,
+174,189,0,0,4,32,0,0,0,192,109,97,120,112,0,119,3,39,0,0,1,72,0,0,0,32,110,
+97,109,101,140,65,184,98,0,0,47,56,0,0,6,0,112,111,115,116,163,248,116,242,
+0,0,53,56,0,0,3,109,0,1,0,0,0,1,5,31,137,173,126,9,95,15,60,245,0,11,8,0,
+0,0,0,0,182,74,116,22,0,0,0,0,210,78,208,22,254,81,252,177,15,38,8,115,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,251,193,0,0,15,138,254,81,251,71,15,38,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,1,0,0,0,95,2,208,0,16,0,85,0,5,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,4,103,1,144,0,5,0,0,5,154,5,51,0,0,0,
+0,5,154,5,51,0,0,0,0,0,100,1,243,10,6,2,11,5,2,4,5,4,2,2,4,0,0,0,0,0,0,0,
+0,0,0,1,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,251,193,0,0,8,141,4,
+63,0,0,0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,2,4,205,0,193,0,0,0,0,3,232,0,0,
+3,232,0,0,3,232,0,180,3,232,255,136,2,233,0,153,2,233,0,162,2,233,0,186,2,
+233,0,162,3,212,0,202,4,60,0,30,5,109,255,136,6,120,255,136,5,49,255,136,
+5,178,0,120,4,93,255,136,4,102,0,60,4,67,255,136,4,78,255,136,4,36,255,176,
+3,152,255,136,5,18,255,136,5,50,255,206,4,155,255,136,3,255,255,141,5,198,
+0,100,8,39,0,50,3,31,0,50,4,144,0,100,5,95,0,100,5,211,255,136,3,152,255,
+136,4,169,0,79,5,42,255,156,4,241,255,142,4,85,0,30,4,85,0,30,5,18,255,136,
+5,49,255,136,8,39,0,50,8,39,0,50,8,39,0,50,5,50,255,206,5,50,255,206,4,77,
+255,136,4,77,255,136,3,255,255,141,4,13,255,72,0,0,0,0,0,0,0,0,0,0,255,127,
+0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,3,200,0,60,
+2,188,0,115,2,188,1,29,4,126,0,115,4,126,1,29,4,0,0,29,7,115,0,25,2,138,1,
+6,2,138,0,221,2,138,0,31,2,138,0,61,2,233,0,133,2,233,0,162,3,55,0,172,2,
+132,0,156,2,136,0,157,3,78,0,157,3,210,0,157,3,92,0,139,3,14,0,96,3,144,0,
+52,3,125,0,19,3,125,0,17,3,119,0,87,7,115,0,50,15,138,0,100,3,54,0,70,1,199,
+0,85,1,73,0,25,0,0,255,220,255,37,255,220,254,81,0,0,0,0,0,0,0,0,0,1,0,3,
+0,1,0,0,0,12,0,4,0,214,0,0,0,44,0,32,0,4,0,12,0,0,0,13,0,33,0,41,0,44,0,46,
+0,59,0,160,6,12,6,28,6,31,6,105,6,108,7,177,32,15,32,25,32,29,37,204,253,
+242,253,253,254,255,255,255,0,0,0,0,0,13,0,32,0,40,0,44,0,46,0,58,0,160,6,
+12,6,27,6,31,6,96,6,106,7,128,32,11,32,24,32,28,37,204,253,242,253,253,254,
+255,255,255,0,1,255,245,0,0,255,220,255,218,255,217,0,0,255,99,249,252,0,
+0,249,235,249,234,249,236,248,139,0,0,224,37,224,35,218,117,2,80,2,88,1,2,
+0,1,0,0,0,0,0,40,0,0,0,0,0,0,0,36,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,28,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,3,0,73,0,72,0,71,0,9,0,93,0,94,0,89,0,90,0,91,0,92,
+0,0,0,0,0,21,0,21,0,21,0,21,0,65,0,110,0,144,0,166,0,199,0,251,1,59,1,94,
+1,145,1,224,2,33,2,97,2,150,2,194,2,237,3,35,3,79,3,153,3,225,4,40,4,100,
+4,160,4,251,5,52,5,118,5,198,6,32,6,99,6,111,6,203,7,33,7,45,7,57,7,69,7,
+81,7,93,7,105,7,117,7,129,7,141,7,153,7,165,7,177,7,189,7,201,7,229,8,23,
+8,51,8,101,8,142,8,214,9,2,9,84,9,158,9,214,9,252,10,61,10,94,10,128,10,188,
+10,248,11,253,12,220,12,243,13,9,13,62,13,99,13,148,13,187,13,240,14,12,14,
+41,14,85,14,155,14,217,15,9,15,55,15,96,15,136,15,189,16,97,20,93,20,157,
+20,184,20,210,20,223,20,252,21,20,21,43,21,43,21,43,0,2,0,193,0,0,4,10,5,
+182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,
+5,182,250,74,104,4,230,0,0,1,0,180,254,51,4,122,5,184,0,23,0,0,0,38,2,53,
+16,0,0,51,50,22,21,20,6,6,0,2,17,20,22,22,21,20,6,35,1,191,168,99,1,28,1,
+201,155,32,38,20,236,254,206,204,95,133,59,42,254,51,191,1,39,157,1,68,2,
+92,1,98,34,25,16,48,91,254,218,254,17,254,233,138,235,133,49,35,53,0,0,1,
+255,136,254,51,3,78,5,184,0,25,0,0,0,22,18,21,16,0,0,35,34,38,53,55,62,3,
+18,18,53,52,38,38,53,52,54,51,2,68,170,96,254,228,254,55,155,32,38,1,1,41,
+152,239,211,121,95,133,59,42,5,184,195,254,212,148,254,188,253,164,254,158,
+34,25,21,11,41,55,179,1,51,1,141,212,138,235,133,49,35,53,0,1,0,153,254,249,
+1,242,1,23,0,19,0,0,0,22,21,20,6,6,35,34,38,53,52,54,54,55,38,38,53,52,54,
+51,1,169,73,113,140,42,24,26,32,95,23,51,63,109,68,1,23,78,65,61,195,143,
+28,17,21,33,96,57,3,69,48,66,104,0,0,1,0,162,255,236,1,217,1,30,0,11,0,0,
+22,38,53,52,54,51,50,22,21,20,6,35,230,68,110,72,56,73,113,72,20,69,54,69,
+114,73,54,70,109,0,0,1,0,186,255,236,2,19,2,10,0,19,0,0,4,38,53,52,54,54,
+51,50,22,21,20,6,6,7,22,22,21,20,6,35,1,3,73,113,140,42,24,26,32,95,23,51,
+63,109,68,20,78,65,61,195,143,28,17,21,33,96,57,3,69,48,66,104,0,3,0,162,
+255,236,2,54,4,12,0,11,0,31,0,32,0,0,22,38,53,52,54,51,50,22,21,20,6,35,18,
+38,53,52,54,54,51,50,22,21,20,6,6,7,22,22,21,20,6,35,19,230,68,110,72,56,
+73,113,72,6,73,113,140,42,24,26,32,95,23,51,63,109,68,2,20,69,54,69,114,73,
+54,70,109,2,2,78,65,61,195,143,28,17,21,33,96,57,3,69,48,66,104,1,50,0,0,
+2,0,202,255,236,4,25,5,182,0,31,0,43,0,0,0,6,35,34,38,35,34,6,21,20,22,21,
+20,6,35,39,34,38,53,52,54,53,52,38,53,52,36,51,50,22,22,21,0,54,51,50,22,
+21,20,6,35,34,38,53,4,25,76,29,35,158,64,110,147,176,93,65,28,25,38,57,151,
+1,3,192,138,167,30,252,177,110,72,56,73,113,72,58,68,4,237,75,108,120,96,
+84,241,100,95,125,1,18,19,34,112,48,62,220,128,154,233,82,48,31,251,151,114,
+73,54,70,109,69,54,0,0,1,0,30,255,236,4,0,2,228,0,18,0,0,0,22,21,20,6,6,0,
+4,6,35,34,38,53,52,54,36,54,54,51,3,224,32,13,116,254,211,254,231,147,13,
+59,64,208,1,39,226,149,53,2,228,38,31,14,47,158,254,254,175,39,54,48,97,53,
+169,159,180,0,1,255,136,255,96,5,79,3,32,0,32,0,0,0,22,23,50,54,54,51,50,
+22,21,20,4,35,34,39,6,0,6,35,34,38,53,52,62,3,55,38,53,52,54,51,3,12,90,28,
+78,153,122,36,33,39,254,145,244,17,8,141,254,225,245,52,58,60,177,121,184,
+145,53,36,106,90,2,209,63,48,74,116,40,26,111,223,1,174,254,253,128,62,54,
+81,58,51,133,136,59,39,48,70,90,0,1,255,136,255,96,6,90,3,32,0,53,0,0,0,22,
+23,62,2,51,50,22,21,20,6,7,54,54,55,55,54,54,51,50,22,21,20,6,35,34,38,39,
+7,6,6,35,35,34,39,6,0,4,35,34,38,53,52,62,3,55,38,53,52,54,51,3,17,100,28,
+52,76,68,36,36,38,8,8,89,72,74,31,27,36,22,35,37,252,154,54,94,45,58,59,99,
+59,15,7,8,125,254,228,254,252,55,58,60,177,121,184,144,53,35,109,92,2,208,
+63,48,7,75,79,56,80,17,39,17,2,51,90,39,33,24,39,44,114,221,33,33,16,18,15,
+1,155,254,247,140,62,54,81,58,51,133,135,59,38,49,68,92,0,1,255,136,255,96,
+5,19,3,62,0,41,0,0,0,22,23,54,54,51,50,22,21,20,6,7,7,22,22,51,50,22,21,20,
+6,35,34,38,39,6,0,4,35,34,38,53,52,54,36,55,38,38,53,52,54,51,2,208,74,28,
+122,202,73,41,39,180,33,109,27,68,43,57,65,87,77,63,145,69,53,254,155,254,
+189,57,63,63,212,1,71,209,39,46,61,57,2,185,47,30,100,110,37,31,38,101,27,
+88,10,11,46,45,37,43,25,24,45,254,187,155,65,51,89,49,162,191,29,67,38,46,
+70,0,0,3,0,120,255,236,5,58,2,228,0,17,0,25,0,37,0,0,0,0,33,34,38,53,52,54,
+51,50,22,23,54,54,51,50,22,21,36,4,7,54,36,53,52,35,0,22,23,55,54,54,55,38,
+35,34,6,21,5,58,254,60,254,186,195,245,231,194,69,110,45,78,173,94,102,122,
+254,136,254,223,78,243,1,44,68,253,18,51,37,40,36,88,51,48,43,90,122,1,57,
+254,179,177,143,165,213,36,29,57,70,114,86,20,248,152,13,216,111,60,254,217,
+66,17,68,61,119,53,15,106,74,0,0,1,255,136,255,96,4,63,3,62,0,33,0,0,1,38,
+38,53,52,54,51,50,22,21,20,7,7,6,6,21,20,22,23,54,54,51,50,22,21,20,0,35,
+34,38,53,52,54,36,2,98,63,77,128,78,39,51,16,36,22,31,65,48,55,159,39,29,
+31,252,122,184,61,60,252,1,73,1,91,27,117,82,100,157,37,35,23,16,35,21,54,
+41,48,49,5,46,157,25,37,133,253,134,66,54,92,41,157,0,0,1,0,60,255,236,4,
+42,2,228,0,26,0,0,37,54,0,54,51,50,22,21,20,0,4,35,34,38,53,52,62,3,51,50,
+22,21,20,6,7,1,117,136,1,34,125,68,39,35,254,41,254,173,97,42,57,65,130,33,
+67,47,54,50,105,33,233,44,1,17,190,48,38,110,254,103,155,46,30,42,87,213,
+212,59,57,64,59,205,33,0,0,1,255,136,255,236,3,203,2,228,0,26,0,0,1,6,0,35,
+34,38,53,52,62,2,18,51,50,22,21,20,6,6,35,34,38,53,52,62,2,3,19,178,254,15,
+106,63,63,188,222,207,249,91,67,67,78,149,70,43,51,44,118,40,2,14,211,254,
+177,55,51,87,53,101,143,1,14,94,102,113,215,218,43,36,38,59,178,112,0,2,255,
+136,255,96,3,222,3,62,0,20,0,32,0,0,1,38,38,53,52,36,51,50,22,21,20,6,0,4,
+35,34,38,53,52,54,36,37,54,54,53,52,38,35,34,6,21,20,22,1,214,54,58,1,9,162,
+99,106,154,254,56,254,185,47,63,63,195,1,23,1,42,82,68,22,35,64,133,47,1,
+38,32,96,57,128,223,80,76,112,214,254,151,147,62,51,92,44,135,197,67,96,41,
+17,23,110,62,31,35,0,0,1,255,176,255,216,3,212,3,32,0,26,0,0,0,38,35,34,6,
+35,34,38,53,52,54,51,50,22,21,20,6,0,4,35,34,53,52,54,36,36,53,2,234,66,45,
+93,194,49,42,47,204,207,186,173,161,254,116,254,194,59,126,225,1,52,1,37,
+2,107,16,62,53,36,63,75,84,83,80,203,254,238,116,101,93,46,107,225,72,0,0,
+1,255,136,255,96,3,102,3,212,0,48,0,0,1,22,22,21,20,0,4,35,34,38,53,52,36,
+36,53,52,38,38,53,52,54,55,55,54,54,53,52,38,39,39,38,38,53,52,62,2,51,50,
+22,21,20,6,7,22,22,21,20,6,2,165,35,39,254,176,254,170,67,63,63,1,53,1,73,
+67,35,62,53,55,26,33,15,16,39,65,54,100,100,87,36,32,46,75,73,109,52,96,1,
+199,18,35,34,83,254,241,174,65,51,94,63,163,62,12,31,42,31,26,53,26,27,12,
+21,8,9,10,4,9,15,36,37,48,53,59,73,47,33,28,71,36,30,46,32,54,100,0,0,1,255,
+136,255,96,4,214,3,212,0,49,0,0,1,22,22,21,20,6,35,34,38,39,6,4,35,34,38,
+53,52,62,2,55,38,38,53,52,54,51,50,22,23,22,51,50,54,53,52,38,53,52,54,55,
+55,54,54,51,50,22,21,20,6,4,80,28,58,255,180,20,53,30,213,254,144,73,58,60,
+216,130,164,91,19,21,80,71,39,64,13,40,61,74,107,151,188,38,30,14,29,18,36,
+46,50,3,23,10,93,58,147,180,4,5,253,219,62,54,86,61,64,121,94,17,43,27,68,
+73,62,47,13,77,62,71,52,50,67,49,24,19,9,12,46,34,31,47,0,2,255,206,255,166,
+4,178,3,32,0,36,0,48,0,0,1,6,6,21,20,22,21,20,4,35,34,38,53,52,54,51,50,22,
+51,50,54,53,52,38,53,52,54,36,51,50,22,21,20,6,35,34,38,36,38,35,34,6,7,22,
+22,51,50,54,53,2,57,32,47,116,254,239,147,113,123,40,44,32,86,40,94,115,114,
+240,1,110,129,94,86,215,137,68,155,1,129,18,16,24,150,71,26,63,38,72,80,1,
+171,24,37,15,14,109,63,103,152,58,53,43,53,29,43,42,31,78,28,82,229,179,97,
+88,131,170,60,251,10,66,40,20,25,63,61,0,0,1,255,136,255,96,4,55,3,212,0,
+37,0,0,1,50,55,55,54,51,50,22,21,20,6,0,0,4,35,34,38,53,52,54,36,0,55,6,6,
+35,34,38,53,52,62,2,51,50,22,21,20,2,180,41,40,158,39,39,31,39,43,254,225,
+254,158,254,193,70,63,63,207,1,24,1,76,99,45,96,55,85,91,94,104,76,53,35,
+43,2,229,5,16,3,32,32,32,73,254,218,254,219,169,65,51,91,44,132,1,19,89,5,
+5,60,48,49,64,93,89,49,35,67,0,1,255,141,255,166,3,200,3,32,0,39,0,0,36,39,
+39,38,38,53,52,36,51,50,22,21,20,6,4,21,20,23,23,22,22,21,20,4,35,34,38,53,
+52,54,51,50,23,23,22,22,51,50,54,53,2,15,23,51,28,46,1,175,63,46,49,131,254,
+254,23,51,28,46,254,159,240,111,138,56,38,19,22,46,25,59,35,147,195,229,24,
+54,30,74,44,109,236,50,36,49,57,144,21,14,22,51,28,62,30,144,182,64,56,44,
+56,6,14,8,12,68,53,0,0,1,0,100,254,192,5,148,3,3,0,63,0,0,0,22,51,50,54,55,
+55,54,54,51,50,22,23,50,54,54,51,50,22,21,20,6,6,35,34,38,39,6,6,35,34,38,
+39,6,6,21,20,22,51,50,54,55,55,54,51,50,22,21,20,6,35,34,38,53,52,18,55,39,
+38,38,53,52,54,51,2,96,80,41,22,58,39,38,18,32,11,59,3,36,32,96,95,86,37,
+37,186,149,68,50,90,17,50,105,44,14,42,22,135,166,133,134,94,113,38,65,28,
+37,33,41,242,219,220,225,211,159,31,28,32,117,70,2,229,163,42,39,39,18,24,
+202,27,95,165,41,34,74,175,116,80,66,74,57,22,15,84,201,90,76,72,6,4,6,3,
+37,36,62,64,159,146,127,1,15,97,19,16,38,24,58,106,0,0,1,0,50,0,94,7,255,
+3,62,0,35,0,0,1,38,38,53,52,54,51,50,22,23,22,4,51,32,54,54,51,50,22,21,20,
+6,4,33,34,36,39,6,6,35,34,38,53,52,54,54,1,65,73,50,96,65,77,100,6,115,1,
+13,165,2,44,197,63,68,39,33,225,254,148,254,119,172,254,236,107,44,236,76,
+48,56,152,108,1,167,40,71,48,59,102,104,85,16,18,156,154,45,38,112,221,74,
+23,15,99,185,48,40,57,53,89,0,0,2,0,50,255,166,2,147,3,32,0,42,0,43,0,0,36,
+54,51,50,22,21,20,6,35,34,36,53,52,54,55,55,38,38,53,52,62,2,51,50,22,21,
+20,6,7,22,23,23,22,22,21,20,6,6,21,20,22,51,19,2,5,39,30,38,35,71,70,160,
+254,204,98,73,85,23,204,82,79,125,41,36,36,77,76,15,23,48,77,67,147,144,138,
+90,64,95,3,47,42,51,48,145,104,69,101,33,39,9,37,59,44,78,76,88,41,26,33,
+87,49,5,5,12,20,49,30,89,57,85,15,29,65,2,193,0,0,2,0,100,254,192,4,93,2,
+208,0,53,0,54,0,0,36,38,39,6,6,21,20,22,51,50,54,55,55,50,55,50,22,21,20,
+6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,23,23,54,54,51,50,22,21,20,6,
+7,22,23,23,22,22,21,20,6,35,3,3,4,130,61,154,137,136,128,42,68,28,56,27,29,
+33,41,178,159,209,232,150,179,42,54,42,38,54,24,28,156,215,43,29,47,205,135,
+15,16,31,40,44,43,51,20,174,41,35,102,144,45,48,51,3,2,4,1,36,36,56,62,142,
+111,117,211,115,54,55,41,71,31,29,38,96,105,42,36,54,113,81,7,4,10,12,48,
+32,35,52,2,34,0,3,0,100,254,192,5,35,3,12,0,40,0,49,0,61,0,0,1,54,54,51,50,
+22,21,20,4,35,34,39,6,6,21,20,22,51,50,54,51,50,22,21,20,6,35,34,38,53,52,
+54,55,38,38,53,52,54,51,50,22,3,54,54,53,52,38,35,34,6,5,54,55,55,38,38,35,
+34,6,21,20,22,3,13,77,159,84,105,109,254,146,240,105,79,142,93,125,149,206,
+172,11,33,41,249,215,225,238,109,127,67,57,185,152,54,132,3,154,239,30,39,
+53,130,254,155,32,35,73,22,53,38,68,73,54,2,140,63,65,103,89,153,219,12,70,
+95,50,89,64,34,34,36,70,74,149,139,89,147,82,38,103,60,101,158,51,254,198,
+6,120,63,13,32,86,134,26,37,76,21,26,57,37,33,46,0,0,1,255,136,255,96,5,81,
+3,32,0,43,0,0,1,6,6,7,2,4,4,35,34,38,53,52,62,2,55,38,38,53,52,54,51,50,22,
+23,54,54,55,55,54,51,50,22,21,20,6,6,35,34,38,53,52,54,54,4,140,74,139,80,
+244,254,242,254,229,68,63,63,204,249,231,104,48,54,97,82,60,90,28,76,112,
+38,73,32,33,40,34,95,147,71,43,51,68,133,2,27,31,46,8,254,250,213,139,65,
+51,93,45,108,162,109,19,66,43,71,99,62,48,6,47,23,44,19,61,104,120,243,218,
+43,36,47,78,193,255,255,255,136,254,204,3,102,3,212,2,38,0,21,0,0,0,7,0,68,
+0,195,254,204,0,2,0,79,254,192,4,39,3,91,0,63,0,64,0,0,1,22,51,50,54,53,52,
+38,39,39,38,38,53,52,54,55,55,54,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,
+39,6,6,21,20,22,51,50,54,55,54,53,50,22,21,20,6,35,34,38,53,52,54,55,38,53,
+52,54,51,50,22,3,2,21,43,58,75,106,27,23,27,36,38,188,38,30,14,29,18,36,46,
+50,84,28,58,254,181,82,61,99,69,122,152,103,150,46,90,33,41,246,218,225,238,
+98,113,24,80,71,39,64,114,1,124,13,78,61,32,41,10,12,16,30,32,67,49,24,19,
+9,12,46,34,31,47,31,10,93,58,146,181,11,53,84,43,88,65,9,8,16,1,34,36,69,
+75,149,139,85,141,76,33,45,68,73,62,1,147,0,3,255,156,254,192,5,139,4,44,
+0,45,0,56,0,57,0,0,1,6,6,21,20,22,21,20,6,4,35,34,38,53,52,54,54,53,52,38,
+53,52,62,2,36,36,54,51,50,22,21,20,7,7,6,6,7,22,22,21,20,6,35,34,38,55,22,
+22,51,50,54,53,52,38,35,34,19,1,174,10,62,106,122,254,251,55,63,63,212,139,
+91,46,120,189,1,75,1,127,70,40,41,39,92,74,82,210,94,78,97,204,116,103,147,
+123,13,57,61,50,76,46,48,74,22,1,34,9,52,18,13,96,54,66,159,143,55,51,89,
+56,76,39,21,91,32,32,76,125,154,229,234,28,37,31,51,52,42,47,125,58,15,126,
+89,117,155,82,197,45,64,60,49,33,47,1,242,0,255,255,255,142,255,166,4,196,
+5,35,0,38,0,23,192,0,0,7,0,69,2,80,3,82,255,255,0,30,255,236,4,0,2,228,0,
+38,0,11,0,0,0,7,0,68,2,15,0,0,255,255,0,30,255,236,4,0,4,45,0,38,0,11,0,0,
+0,7,0,67,1,227,255,238,255,255,255,136,255,96,4,214,4,173,2,38,0,22,0,0,0,
+7,0,67,2,78,0,110,255,255,255,136,255,96,5,19,4,63,2,38,0,14,0,0,0,7,0,67,
+2,168,0,0,255,255,0,50,0,94,7,255,4,141,2,38,0,27,0,0,0,7,0,69,3,65,2,188,
+255,255,0,50,0,0,7,255,3,62,2,38,0,27,0,0,0,7,0,68,3,5,0,0,255,255,0,50,0,
+94,7,255,3,121,2,38,0,27,0,0,0,7,0,67,3,44,255,58,255,255,255,206,255,133,
+4,178,3,32,2,38,0,23,0,0,0,7,0,68,1,251,255,133,255,255,255,206,255,166,4,
+178,4,63,2,38,0,23,0,0,0,7,0,67,2,124,0,0,255,255,255,136,255,48,3,203,2,
+228,0,38,0,18,0,0,0,7,0,68,0,73,255,48,255,255,255,136,255,236,3,203,4,63,
+0,38,0,18,0,0,0,7,0,67,1,236,0,0,255,255,255,141,255,166,3,200,4,43,2,38,
+0,25,0,0,0,7,0,70,1,95,3,92,255,255,255,72,255,96,3,158,4,63,0,38,0,19,192,
+0,0,7,0,67,1,102,0,0,0,1,0,0,3,112,2,210,5,50,0,14,0,0,0,22,21,20,6,4,35,
+34,38,53,52,54,36,54,51,2,177,33,163,254,148,103,40,52,208,1,21,108,58,5,
+50,35,26,60,127,202,37,35,72,51,154,101,0,2,0,0,3,112,3,15,6,31,0,13,0,30,
+0,0,0,22,21,20,0,35,34,38,53,52,62,2,51,37,62,2,51,50,22,21,20,0,35,34,38,
+53,52,54,55,2,239,32,254,41,104,39,48,152,249,141,50,253,241,91,150,118,46,
+38,31,254,42,105,40,45,99,7,5,30,36,28,81,254,227,38,32,57,60,128,115,34,
+41,91,91,35,29,80,254,227,36,33,51,47,3,0,0,1,255,127,253,158,2,81,255,96,
+0,14,0,0,4,22,21,20,6,4,35,34,38,53,52,54,36,54,51,2,48,33,163,254,148,103,
+40,52,208,1,21,108,58,160,35,26,60,127,202,37,35,72,51,154,101,0,0,2,0,0,
+252,177,3,15,255,96,0,13,0,30,0,0,0,22,21,20,0,35,34,38,53,52,62,2,51,37,
+62,2,51,50,22,21,20,0,35,34,38,53,52,54,55,2,239,32,254,41,104,39,48,152,
+249,141,50,253,241,91,150,118,46,38,31,254,42,105,40,45,99,7,254,95,36,28,
+81,254,227,38,32,57,60,128,115,34,41,91,91,35,29,80,254,227,36,33,51,47,3,
+0,0,2,0,4,3,112,2,97,5,157,0,23,0,24,0,0,1,38,38,35,34,6,35,34,38,53,52,54,
+51,50,22,21,20,4,35,34,53,52,54,54,19,1,173,15,90,30,29,49,26,56,53,102,95,
+131,200,254,108,91,110,147,228,130,4,186,11,16,2,33,43,46,46,80,58,133,252,
+79,67,48,84,1,23,0,0,3,0,4,3,112,4,185,5,157,0,23,0,47,0,48,0,0,1,38,38,35,
+34,6,35,34,38,53,52,54,51,50,22,21,20,4,35,34,53,52,54,54,37,38,38,35,34,
+6,35,34,38,53,52,54,51,50,22,21,20,4,35,34,53,52,54,54,1,1,173,15,90,30,29,
+49,26,56,53,102,95,131,200,254,108,91,110,147,228,2,138,15,90,30,29,49,26,
+56,53,102,95,131,200,254,108,91,110,147,228,254,122,4,186,11,16,2,33,43,46,
+46,80,58,133,252,79,67,48,84,52,11,16,2,33,43,46,46,80,58,133,252,79,67,48,
+84,1,23,0,1,0,0,3,112,2,8,5,157,0,28,0,0,19,22,22,51,50,54,51,50,22,21,20,
+6,35,34,38,53,52,54,54,51,50,22,21,20,6,7,7,6,6,200,28,69,41,21,57,22,39,
+40,113,101,128,175,124,228,87,35,46,22,13,115,74,84,4,74,22,20,10,33,55,48,
+50,126,76,63,126,166,33,37,22,33,9,69,44,66,0,2,0,0,3,112,4,86,5,157,0,28,
+0,57,0,0,19,22,22,51,50,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,
+21,20,6,7,7,6,6,5,22,22,51,50,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,
+50,22,21,20,6,7,7,6,6,200,28,69,41,21,57,22,39,40,113,101,128,175,124,228,
+87,35,46,22,13,115,74,84,2,66,28,69,41,21,57,22,39,40,113,101,128,175,124,
+228,87,35,46,22,13,115,74,84,4,74,22,20,10,33,55,48,50,126,76,63,126,166,
+33,37,22,33,9,69,44,66,26,22,20,10,33,55,48,50,126,76,63,126,166,33,37,22,
+33,9,69,44,66,0,1,0,4,3,112,3,132,5,157,0,51,0,0,1,22,22,51,50,54,51,50,22,
+21,20,6,35,34,38,39,6,6,35,34,53,52,54,54,55,38,38,35,34,6,35,34,38,53,52,
+54,51,50,22,23,54,54,51,50,22,21,20,6,7,7,6,6,2,68,28,69,41,21,57,22,39,40,
+113,101,93,149,36,104,140,47,110,147,228,50,15,90,30,29,49,26,56,53,102,95,
+93,166,39,69,126,48,35,46,22,13,115,74,84,4,74,22,20,10,33,55,48,50,69,57,
+66,60,79,67,48,84,52,11,16,2,33,43,46,46,44,34,54,58,33,37,22,33,9,69,44,
+66,0,1,0,0,3,112,3,135,6,207,0,38,0,0,18,38,53,52,18,36,51,50,22,21,20,6,
+35,34,38,53,52,54,54,53,52,38,35,34,6,6,21,20,22,51,50,54,51,50,22,21,20,
+6,35,156,156,211,1,71,131,111,123,198,47,33,50,58,86,24,26,95,225,165,55,
+51,91,147,25,29,33,185,148,3,112,131,114,139,1,34,189,89,77,146,191,49,34,
+45,52,75,38,18,25,143,211,65,56,54,69,31,28,66,111,0,0,2,0,0,3,112,2,130,
+5,202,0,11,0,23,0,0,18,38,53,52,54,51,50,22,21,20,6,35,18,38,35,34,6,21,20,
+22,51,50,54,53,140,140,248,163,116,115,236,152,209,46,31,94,112,43,44,78,
+118,3,112,134,109,137,222,105,102,163,232,1,136,50,108,82,51,39,116,81,0,
+2,0,60,254,152,3,140,3,32,0,31,0,43,0,0,0,22,21,20,6,4,21,20,22,51,50,54,
+54,51,50,22,21,20,6,35,34,38,53,52,36,55,38,38,53,52,54,51,6,6,21,20,22,23,
+54,54,53,52,38,35,2,224,172,237,254,81,112,111,84,111,88,33,34,40,237,164,
+174,218,1,156,15,128,119,230,143,69,115,119,118,28,24,56,57,3,32,130,105,
+129,221,227,74,61,48,47,60,39,36,74,123,141,123,130,244,9,26,116,89,117,165,
+165,70,50,44,46,3,28,61,45,30,49,0,1,0,115,4,19,1,204,6,49,0,19,0,0,18,38,
+53,52,54,54,51,50,22,21,20,6,6,7,22,22,21,20,6,35,188,73,113,140,42,24,26,
+32,95,23,51,63,109,68,4,19,78,65,61,195,143,28,17,21,33,96,57,3,69,48,66,
+104,0,1,1,29,4,19,2,118,6,49,0,19,0,0,0,22,21,20,6,6,35,34,38,53,52,54,54,
+55,38,38,53,52,54,51,2,45,73,113,140,42,24,26,32,95,23,51,63,109,68,6,49,
+78,65,61,195,143,28,17,21,33,96,57,3,69,48,66,104,0,0,2,0,115,4,19,3,142,
+6,49,0,19,0,39,0,0,18,38,53,52,54,54,51,50,22,21,20,6,6,7,22,22,21,20,6,35,
+32,38,53,52,54,54,51,50,22,21,20,6,6,7,22,22,21,20,6,35,188,73,113,140,42,
+24,26,32,95,23,51,63,109,68,1,135,73,113,140,42,24,26,32,95,23,51,63,109,
+68,4,19,78,65,61,195,143,28,17,21,33,96,57,3,69,48,66,104,78,65,61,195,143,
+28,17,21,33,96,57,3,69,48,66,104,0,0,2,1,29,4,19,4,56,6,49,0,19,0,39,0,0,
+0,22,21,20,6,6,35,34,38,53,52,54,54,55,38,38,53,52,54,51,32,22,21,20,6,6,
+35,34,38,53,52,54,54,55,38,38,53,52,54,51,2,45,73,113,140,42,24,26,32,95,
+23,51,63,109,68,1,253,73,113,140,42,24,26,32,95,23,51,63,109,68,6,49,78,65,
+61,195,143,28,17,21,33,96,57,3,69,48,66,104,78,65,61,195,143,28,17,21,33,
+96,57,3,69,48,66,104,0,16,0,29,0,0,3,249,3,224,0,11,0,23,0,35,0,47,0,59,0,
+71,0,83,0,95,0,107,0,119,0,131,0,143,0,155,0,167,0,179,0,191,0,0,0,54,51,
+50,22,21,20,6,35,34,38,53,6,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,
+21,20,6,35,34,38,53,4,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,
+6,35,34,38,53,4,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,
+34,38,53,22,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,
+38,53,4,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,
+4,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,4,54,
+51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,22,54,51,
+50,22,21,20,6,35,34,38,53,1,220,28,20,20,30,30,20,20,28,178,30,19,19,30,30,
+19,19,30,1,105,30,19,19,30,30,19,19,30,254,16,29,20,20,28,28,20,19,30,2,134,
+29,20,20,28,28,20,20,29,253,25,28,20,20,30,30,20,20,28,3,62,29,20,20,28,28,
+20,20,29,23,30,19,19,30,30,19,19,30,252,134,29,20,20,28,28,20,20,29,3,89,
+28,20,20,29,29,20,20,28,252,212,29,20,20,28,28,20,20,29,2,205,30,19,19,30,
+30,19,19,30,253,155,30,19,19,30,30,19,19,30,1,219,29,20,20,29,29,20,19,30,
+254,177,30,20,20,28,28,20,20,30,158,28,20,20,30,30,20,20,28,3,193,31,31,19,
+19,30,30,19,20,30,30,19,19,30,30,19,16,28,28,20,20,29,30,19,72,28,28,20,20,
+29,29,20,2,30,30,19,19,30,30,19,105,30,30,19,19,30,30,19,1,28,28,20,20,29,
+29,20,133,30,30,19,19,30,30,19,19,30,30,19,19,30,30,19,153,28,28,20,20,29,
+29,20,3,29,29,20,20,28,28,20,104,29,29,20,20,28,28,20,2,30,30,19,19,30,30,
+19,60,30,30,19,19,30,30,19,12,28,28,20,19,30,30,19,9,30,30,19,19,30,30,19,
+0,5,0,25,255,255,7,24,6,51,0,19,0,62,0,75,0,140,0,147,0,0,1,20,6,7,7,38,38,
+39,39,38,2,53,52,54,55,23,7,22,22,21,1,22,22,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,55,23,6,6,21,20,51,50,54,55,39,55,22,22,51,50,54,55,38,38,39,
+39,52,54,55,3,22,22,21,20,7,39,52,39,39,52,54,55,1,22,18,23,19,22,23,23,20,
+14,2,35,34,39,6,6,35,34,46,2,39,39,6,6,7,38,38,39,39,38,38,53,52,54,54,55,
+39,54,54,55,19,22,22,51,50,54,55,3,54,54,55,19,22,22,51,50,54,55,38,2,39,
+54,54,1,6,6,7,22,22,23,6,242,8,5,91,2,8,5,11,6,16,59,65,66,49,5,6,253,67,
+22,18,71,50,17,41,15,17,60,32,45,55,14,14,39,4,5,48,23,28,2,4,57,7,40,41,
+10,22,2,2,16,14,3,35,25,138,6,9,55,22,27,5,44,42,1,250,4,16,3,12,2,1,2,57,
+41,98,87,131,74,72,101,75,38,77,68,64,7,14,13,31,14,76,78,24,39,66,103,76,
+174,124,9,27,69,45,21,40,89,55,53,94,46,68,23,63,42,24,42,84,54,56,93,46,
+17,41,27,27,64,252,45,98,154,42,62,157,120,2,21,93,245,126,16,101,218,107,
+203,90,1,11,40,76,72,12,214,39,93,174,77,2,137,45,83,21,54,88,16,17,40,39,
+57,54,26,52,26,9,17,32,11,57,37,25,78,37,70,58,16,8,11,42,31,21,23,43,6,1,
+35,38,78,42,85,60,5,74,120,37,32,29,9,254,83,87,254,200,65,254,241,53,43,
+87,43,135,38,25,62,38,24,12,29,59,35,73,27,52,26,7,11,8,13,27,75,25,30,170,
+128,53,72,24,51,27,253,130,22,24,24,22,2,76,24,51,29,253,76,22,24,24,22,223,
+1,163,229,27,52,253,160,32,93,51,52,46,2,0,1,1,6,3,112,1,213,4,63,0,11,0,
+0,0,38,53,52,54,51,50,22,21,20,6,35,1,60,54,66,43,42,56,66,45,3,112,55,41,
+47,64,58,41,44,64,0,0,1,0,221,0,0,1,172,0,207,0,11,0,0,32,38,53,52,54,51,
+50,22,21,20,6,35,1,19,54,66,43,42,56,66,45,55,41,47,64,58,41,44,64,0,0,3,
+0,31,0,0,2,116,1,209,0,11,0,23,0,35,0,0,50,38,53,52,54,51,50,22,21,20,6,35,
+32,38,53,52,54,51,50,22,21,20,6,35,2,38,53,52,54,51,50,22,21,20,6,35,85,54,
+66,43,42,56,66,45,1,92,54,66,43,42,56,66,45,215,54,66,43,42,56,66,45,55,41,
+47,64,58,41,44,64,55,41,47,64,58,41,44,64,1,2,55,41,47,64,58,41,44,64,0,0,
+2,0,61,0,0,2,86,0,207,0,11,0,23,0,0,50,38,53,52,54,51,50,22,21,20,6,35,32,
+38,53,52,54,51,50,22,21,20,6,35,115,54,66,43,42,56,66,45,1,32,54,66,43,42,
+56,66,45,55,41,47,64,58,41,44,64,55,41,47,64,58,41,44,64,0,0,2,0,133,254,
+249,2,26,3,32,0,19,0,31,0,0,0,22,21,20,6,6,35,34,38,53,52,54,54,55,38,38,
+53,52,54,51,38,38,53,52,54,51,50,22,21,20,6,35,1,149,73,113,140,42,24,26,
+32,95,23,51,63,109,68,51,68,110,72,56,73,113,72,1,23,78,65,61,195,143,28,
+17,21,33,96,57,3,69,48,66,104,215,69,54,69,114,73,54,70,109,0,2,0,162,255,
+236,2,26,3,32,0,11,0,23,0,0,0,38,53,52,54,51,50,22,21,20,6,35,2,38,53,52,
+54,51,50,22,21,20,6,35,1,39,68,110,72,56,73,113,72,123,68,110,72,56,73,113,
+72,1,238,69,54,69,114,73,54,70,109,253,254,69,54,69,114,73,54,70,109,0,0,
+2,0,172,255,236,2,250,5,201,0,20,0,32,0,0,1,7,6,6,7,7,6,6,35,34,38,53,52,
+18,18,51,50,22,21,20,6,0,54,51,50,22,21,20,6,35,34,38,53,2,174,67,43,62,16,
+19,8,57,35,59,43,236,137,61,29,22,54,253,232,110,72,56,73,113,72,58,68,4,
+161,204,128,215,64,79,33,35,41,40,51,2,135,1,19,25,30,40,133,251,199,114,
+73,54,70,109,69,54,0,3,0,156,1,20,1,231,5,159,0,9,0,10,0,11,0,0,19,54,54,
+55,22,22,21,20,7,38,19,19,156,34,55,35,114,93,113,108,2,25,2,193,55,108,51,
+65,83,15,28,166,82,3,27,251,117,0,0,1,0,157,1,20,1,235,5,159,0,13,0,0,1,22,
+18,21,20,7,39,2,2,38,39,39,52,54,1,12,102,121,28,78,5,118,100,3,2,59,5,159,
+183,254,85,162,198,193,19,1,120,1,132,191,14,25,41,78,0,1,0,157,1,20,3,26,
+5,159,0,26,0,0,1,22,23,22,22,51,50,19,23,16,33,34,39,22,21,20,6,7,39,46,4,
+53,52,54,1,12,62,45,22,71,40,178,26,82,254,228,35,37,53,10,18,78,3,27,69,
+86,43,59,5,159,112,119,17,21,1,11,16,254,89,16,200,147,97,157,137,19,198,
+255,238,199,72,32,41,80,0,1,0,157,1,20,3,158,5,159,0,46,0,0,1,22,23,22,51,
+50,54,53,52,39,55,22,21,21,22,51,50,54,53,52,39,23,22,21,20,6,35,34,39,6,
+6,35,34,39,35,22,21,20,7,39,2,2,38,39,39,52,54,1,12,60,46,49,66,60,55,5,61,
+29,34,24,43,47,3,83,9,101,76,46,52,21,73,49,34,37,2,52,24,78,4,115,106,2,
+1,58,5,159,110,122,37,77,78,46,47,21,106,74,12,12,74,69,38,19,9,65,43,114,
+140,29,42,53,16,196,151,202,189,19,1,104,1,132,213,12,22,41,78,0,0,3,0,139,
+1,16,3,14,5,216,0,35,0,36,0,37,0,0,1,22,21,20,6,7,7,6,7,22,22,23,23,6,6,21,
+20,22,51,50,55,23,6,6,35,34,38,53,52,54,55,38,38,53,52,18,39,19,2,18,6,33,
+28,62,123,51,45,120,83,56,63,149,146,101,105,78,21,6,108,87,168,176,80,61,
+107,132,126,67,65,5,216,19,23,44,79,23,49,92,47,49,51,18,121,68,221,48,42,
+63,21,36,5,147,104,103,58,199,93,44,102,42,88,1,0,78,251,117,0,4,0,96,1,20,
+2,174,5,159,0,13,0,24,0,25,0,26,0,0,0,18,21,20,6,6,35,34,38,53,52,18,54,51,
+18,38,35,34,2,21,20,51,50,54,53,1,19,2,30,144,86,160,85,137,122,100,159,68,
+178,127,95,66,135,199,102,122,254,179,195,5,51,254,226,195,180,164,108,143,
+152,132,1,45,205,254,98,218,254,232,117,168,137,51,2,169,251,117,0,3,0,52,
+1,17,3,14,5,181,0,22,0,23,0,24,0,0,1,38,2,53,52,54,55,6,35,34,38,39,55,22,
+51,50,55,23,6,21,20,18,23,1,19,2,149,76,72,26,8,84,126,83,153,49,47,126,112,
+137,162,25,35,79,77,254,138,55,1,17,189,1,68,172,65,194,30,12,30,23,173,50,
+20,33,140,103,240,254,153,152,4,11,251,117,0,2,0,19,1,20,3,107,5,159,0,18,
+0,19,0,0,1,2,2,38,53,52,54,55,22,18,23,54,18,55,23,6,2,7,6,3,1,162,146,242,
+11,53,46,94,223,42,43,184,85,86,127,157,63,65,155,1,20,1,236,1,211,24,20,
+39,83,34,144,253,184,210,246,2,26,154,147,255,254,83,246,52,4,109,0,2,0,17,
+1,20,3,107,5,159,0,17,0,18,0,0,1,18,18,22,21,20,6,7,38,2,39,6,2,7,39,18,18,
+19,39,1,219,149,247,4,53,48,94,223,42,45,177,88,88,132,149,67,97,5,155,254,
+8,254,45,20,13,38,81,36,143,2,71,211,254,253,249,164,146,1,7,1,152,1,4,86,
+0,4,0,87,1,17,2,245,5,195,0,17,0,27,0,28,0,29,0,0,1,38,2,39,6,35,34,38,53,
+52,54,51,50,22,21,20,18,23,0,22,51,55,39,38,35,34,6,21,39,1,2,125,75,66,3,
+53,58,146,149,178,90,117,123,80,82,253,187,162,102,46,2,32,148,51,77,38,1,
+69,1,17,195,1,35,155,24,133,125,108,219,207,224,164,254,200,165,2,225,78,
+5,13,216,67,31,241,251,117,0,4,0,50,255,206,6,221,5,237,0,15,0,62,0,77,0,
+123,0,0,36,38,53,52,54,18,17,52,54,51,50,21,16,2,6,35,37,6,6,35,34,38,53,
+52,62,3,51,50,21,20,22,51,50,54,53,52,51,50,22,18,51,50,54,18,53,52,51,50,
+22,21,20,2,6,35,34,38,39,6,35,34,38,0,6,35,34,53,52,55,55,52,55,52,54,51,
+50,21,3,6,6,35,34,38,53,52,54,51,50,21,20,7,7,6,6,21,20,51,50,54,53,52,54,
+51,50,21,20,51,50,53,52,39,39,38,38,53,52,51,50,22,21,20,35,34,6,10,36,52,
+57,41,37,60,90,55,38,251,154,65,204,71,26,32,148,142,80,18,58,68,54,55,59,
+88,66,64,3,51,82,80,66,22,62,27,41,31,170,121,76,107,28,87,137,67,88,1,212,
+18,41,48,1,6,1,18,34,47,79,17,61,44,48,72,59,33,28,6,13,8,12,55,37,31,14,
+24,39,69,57,3,7,4,7,30,31,24,128,71,113,30,23,23,192,1,243,1,4,51,67,64,254,
+196,253,78,75,29,78,114,33,23,60,43,98,139,145,46,113,127,190,114,96,87,254,
+235,155,1,91,121,68,30,18,181,254,82,246,94,108,238,69,4,177,77,46,7,20,88,
+22,14,63,73,30,253,131,38,37,82,55,69,88,26,9,11,26,14,37,23,49,46,39,37,
+47,26,128,62,10,17,34,17,30,8,32,124,28,159,0,15,0,100,253,213,15,38,8,115,
+1,134,1,204,2,11,2,35,2,64,2,73,2,82,2,91,2,99,2,143,2,157,2,169,2,183,2,
+195,2,207,0,0,0,38,39,6,6,7,23,30,2,51,7,38,39,39,34,39,34,39,34,6,6,35,34,
+38,39,6,6,35,34,38,39,7,34,38,53,52,54,55,6,6,7,22,23,23,22,23,6,6,7,38,2,
+53,52,62,3,51,50,22,22,51,50,62,2,55,50,22,23,6,7,7,22,22,51,50,54,55,38,
+39,39,38,38,35,34,6,7,38,53,52,54,51,50,22,23,54,54,55,38,39,39,38,38,53,
+52,54,55,22,22,23,22,22,51,50,54,55,38,38,39,39,33,34,38,39,7,34,38,53,52,
+54,55,6,7,7,22,18,31,2,22,22,51,50,54,55,38,38,53,52,54,51,50,22,22,51,51,
+50,54,55,46,3,35,34,6,7,38,38,53,52,54,51,50,22,22,51,7,38,38,35,34,6,7,7,
+6,6,35,35,34,38,39,7,34,38,39,6,6,35,34,38,39,22,21,20,6,35,34,38,53,52,54,
+55,23,6,6,21,20,22,51,50,54,55,38,38,39,39,38,2,53,52,54,55,55,54,54,51,50,
+18,51,33,3,38,39,54,54,55,20,23,19,51,47,2,52,39,52,54,55,23,22,23,23,7,19,
+20,23,51,50,54,55,55,54,54,51,50,22,23,7,6,7,22,22,51,50,54,55,54,54,55,55,
+35,54,54,51,50,23,6,6,7,22,22,51,50,54,55,54,54,51,50,22,23,6,6,7,22,22,51,
+55,54,54,55,38,38,53,52,54,55,22,22,23,23,20,23,20,6,7,6,6,7,34,38,39,7,6,
+6,35,34,38,39,6,6,35,34,38,39,6,6,35,35,21,20,23,20,23,21,20,23,21,20,6,7,
+7,52,38,39,39,38,39,35,23,22,22,21,20,14,2,35,1,39,38,38,53,52,54,55,55,54,
+54,55,39,54,54,55,19,23,21,22,22,51,50,54,55,39,38,38,39,54,54,55,23,22,23,
+23,20,23,22,51,50,54,55,38,2,39,54,54,55,22,23,23,22,22,23,20,14,2,35,34,
+38,39,6,6,35,34,38,39,39,0,39,6,35,34,39,6,6,35,34,38,39,55,22,23,23,22,50,
+23,50,54,55,38,38,47,3,38,38,53,52,54,55,22,23,23,22,22,23,22,22,23,52,51,
+50,54,55,38,2,39,54,54,55,22,31,2,22,23,20,6,35,1,20,23,23,20,23,21,20,6,
+7,7,47,2,38,38,39,39,52,54,55,22,23,23,1,20,15,3,52,47,2,52,39,39,38,38,53,
+52,54,55,22,22,23,7,22,20,23,20,22,21,1,38,38,39,6,6,7,22,22,19,38,38,39,
+6,6,7,22,22,19,38,38,39,6,6,7,22,22,19,38,39,6,6,7,22,22,1,22,22,21,20,6,
+35,34,38,39,6,6,35,34,38,53,52,54,55,23,7,20,7,20,22,51,50,54,53,52,38,53,
+55,22,22,51,50,54,55,38,38,53,52,54,1,54,55,55,22,22,23,6,6,7,38,38,39,39,
+37,6,6,7,38,38,39,54,54,55,22,22,1,23,22,22,21,20,6,7,39,52,38,53,52,54,3,
+6,6,7,38,38,39,54,55,55,22,22,51,6,6,7,38,38,39,54,54,55,22,22,9,38,99,16,
+9,48,31,7,63,68,102,64,44,17,11,18,7,6,6,6,96,147,144,183,55,88,39,24,135,
+69,31,52,22,14,116,181,9,11,27,47,22,7,9,32,8,7,20,35,22,4,30,38,48,138,92,
+23,33,64,61,43,46,115,42,53,32,10,17,6,12,14,28,28,70,44,180,224,35,39,28,
+54,25,49,30,41,57,28,16,74,64,22,43,31,47,61,18,8,6,40,15,44,36,32,7,75,5,
+27,66,48,54,84,29,9,22,2,2,250,53,26,52,17,15,115,182,10,11,25,24,47,6,42,
+15,4,12,21,39,22,19,36,14,5,4,146,70,34,58,68,41,107,185,205,57,33,14,79,
+66,32,47,47,32,8,10,80,60,65,167,118,125,44,31,28,12,47,54,42,67,74,135,149,
+125,28,49,21,15,50,106,45,36,70,41,21,35,18,3,207,122,100,109,10,12,43,6,
+7,83,76,84,171,30,17,27,8,9,5,40,35,24,24,67,148,41,41,103,57,5,186,26,4,
+3,21,37,19,2,25,131,1,8,5,1,41,36,11,4,15,10,31,8,1,77,43,64,27,8,8,24,16,
+5,18,5,24,10,13,20,56,26,29,40,21,7,13,8,11,1,10,30,23,17,10,16,30,14,17,
+26,19,13,30,20,16,55,33,8,19,7,14,31,14,30,61,44,24,43,91,39,16,47,43,33,
+6,25,7,4,1,29,11,63,105,38,49,92,26,16,9,63,31,30,42,21,11,75,51,32,82,28,
+13,51,46,84,1,1,1,5,2,51,5,3,9,3,3,130,4,3,10,39,24,92,55,251,243,45,60,137,
+9,7,14,23,122,63,5,22,42,23,10,2,23,58,39,25,65,36,15,9,17,4,20,37,21,5,2,
+1,2,3,46,73,38,64,26,12,28,16,20,34,23,3,5,9,4,7,2,38,20,62,58,35,74,22,52,
+58,51,72,84,7,6,5,161,1,2,8,55,39,18,137,99,27,92,31,15,20,15,26,12,22,14,
+86,122,33,7,13,6,13,15,14,20,24,36,32,7,14,27,14,22,3,33,65,2,9,37,64,26,
+12,29,17,21,36,21,3,5,10,8,3,1,53,124,253,182,1,4,1,5,2,53,8,5,4,2,8,5,1,
+45,31,6,6,30,3,185,1,2,5,53,1,3,8,4,7,4,5,44,32,10,24,7,31,2,3,2,246,233,
+25,39,8,41,99,16,37,115,222,25,36,10,44,97,16,42,121,236,29,40,2,37,102,17,
+41,122,224,15,15,55,105,35,44,81,1,218,14,10,42,28,12,26,8,11,33,20,27,33,
+9,8,18,3,1,18,14,14,20,2,30,5,26,23,8,14,4,5,19,27,250,40,22,22,37,21,35,
+20,13,33,28,11,21,11,21,13,233,16,33,25,21,45,17,20,46,14,21,34,247,141,8,
+4,6,15,17,7,25,24,83,8,33,28,19,40,17,20,20,35,20,34,190,10,33,25,20,40,18,
+20,40,15,19,36,1,83,14,13,60,97,33,5,44,34,17,86,3,1,2,1,1,83,55,33,35,40,
+58,27,23,50,73,62,17,40,22,18,36,15,63,54,216,59,73,23,27,15,126,1,30,80,
+22,97,36,93,37,159,145,44,33,122,6,5,3,32,31,62,18,24,79,7,18,22,40,18,24,
+26,19,14,31,42,53,11,16,27,87,57,19,13,73,19,96,36,30,33,17,34,190,58,15,
+7,13,17,123,214,25,30,29,21,50,72,63,17,40,22,17,18,34,94,255,0,110,23,63,
+12,9,7,4,8,17,11,78,179,158,146,73,11,20,3,66,34,26,20,8,24,14,43,53,121,
+55,85,4,3,12,19,31,41,34,27,23,50,16,17,12,21,6,10,27,31,111,171,116,100,
+38,60,51,10,22,42,18,84,94,83,61,34,87,42,44,17,1,74,148,26,87,19,19,52,82,
+254,208,1,46,44,25,23,30,13,15,34,254,124,38,234,98,5,6,42,47,3,40,17,45,
+35,26,254,251,27,22,31,45,15,15,21,4,4,57,24,25,8,5,4,7,11,44,25,37,33,41,
+8,38,97,42,9,5,4,7,25,173,3,5,34,88,42,19,21,1,2,20,18,66,119,19,29,50,18,
+48,99,46,28,14,14,29,61,29,37,24,1,34,28,31,13,18,14,15,14,15,17,17,11,23,
+10,27,29,29,28,51,35,29,65,44,101,53,9,51,103,59,161,59,77,63,75,142,75,25,
+94,16,20,2,238,4,4,72,27,8,30,16,31,51,87,26,48,22,26,17,254,166,36,36,15,
+15,12,18,125,79,175,71,23,30,12,154,67,58,115,56,65,30,15,16,152,1,41,141,
+22,27,16,90,80,155,82,141,70,27,87,23,19,18,23,27,14,54,46,42,250,250,6,6,
+29,116,148,38,27,37,4,2,3,2,1,101,101,18,28,12,24,24,26,33,64,26,30,35,16,
+30,35,72,38,74,34,19,2,8,7,16,14,151,1,41,143,23,29,14,91,80,156,147,71,74,
+35,121,6,218,28,34,125,27,12,154,55,110,55,10,245,98,102,58,123,45,13,42,
+46,2,24,18,95,250,64,38,45,98,119,9,65,52,95,163,29,40,83,43,82,31,46,40,
+6,51,63,24,27,28,67,32,31,55,14,2,156,36,116,71,19,88,38,32,39,253,251,36,
+111,76,20,91,35,34,38,253,255,44,130,48,16,90,39,35,38,4,244,82,104,18,59,
+43,33,28,2,193,23,54,10,31,51,11,11,24,26,34,30,11,34,14,4,18,7,9,21,15,23,
+16,11,23,11,20,45,30,9,6,16,41,10,15,20,250,229,20,24,40,23,34,18,19,42,23,
+8,19,9,19,128,20,39,25,17,39,20,19,49,16,21,37,5,173,44,27,74,37,30,53,24,
+2,88,122,10,24,35,246,117,17,36,25,15,34,22,18,21,37,20,32,17,37,25,16,34,
+21,17,43,18,22,31,0,0,5,0,70,0,153,2,240,5,159,0,11,0,21,0,31,0,32,0,33,0,
+0,55,38,39,54,0,55,22,22,23,20,6,0,3,54,54,55,22,22,21,20,7,38,1,54,54,55,
+22,22,21,20,7,38,7,3,181,47,26,80,1,72,132,24,32,1,29,254,117,211,29,50,32,
+104,84,103,117,1,47,29,51,32,104,84,103,100,86,155,153,38,62,169,2,136,242,
+17,60,30,27,43,252,251,2,175,50,97,48,60,75,15,29,146,86,253,142,50,97,48,
+60,75,15,28,148,77,49,4,139,0,0,1,0,85,0,78,1,114,2,59,0,15,0,0,55,53,54,
+53,52,38,38,53,52,54,51,50,22,21,20,6,85,166,70,58,65,48,61,73,144,78,73,
+53,103,31,37,47,46,50,53,87,66,124,174,0,0,1,0,25,1,23,1,54,3,4,0,14,0,0,
+1,21,6,21,20,22,21,20,6,35,34,38,53,52,54,1,54,165,127,65,48,59,75,147,3,
+4,73,52,105,37,59,64,50,53,86,66,125,176,0,1,255,220,0,183,0,36,6,131,0,3,
+0,0,19,17,35,17,36,72,6,131,250,52,5,204,0,1,255,37,0,183,0,219,6,131,0,14,
+0,0,55,35,17,7,39,55,39,55,23,55,23,7,23,7,39,36,72,134,49,171,171,49,170,
+170,49,171,171,49,134,183,4,161,136,49,169,168,49,171,171,49,168,169,49,136,
+0,1,255,220,0,183,1,174,6,131,0,10,0,0,1,7,39,55,33,17,35,17,33,39,55,1,174,
+217,49,137,254,246,71,1,81,137,49,5,172,214,49,130,251,46,5,25,130,49,0,1,
+254,81,0,183,0,35,6,131,0,10,0,0,55,35,17,33,23,7,39,55,23,7,33,35,71,254,
+246,137,49,217,217,49,137,1,81,183,4,210,130,49,214,215,49,130,0,0,0,0,0,
+15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,1,4,9,0,
+2,0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,0,4,0,32,0,94,0,3,0,1,
+4,9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,1,4,9,0,7,0,68,1,12,0,
+3,0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,40,1,122,0,3,0,1,4,9,0,10,0,96,
+1,162,0,3,0,1,4,9,0,11,0,62,2,2,0,3,0,1,4,9,0,12,0,60,2,64,0,3,0,1,4,9,0,
+13,2,150,2,124,0,3,0,1,4,9,0,14,0,52,5,18,0,67,0,111,0,112,0,121,0,114,0,
+105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,52,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,104,0,
+97,0,97,0,110,0,97,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,
+0,104,0,97,0,97,0,110,0,97,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,
+0,115,0,84,0,104,0,97,0,97,0,110,0,97,0,78,0,111,0,116,0,111,0,32,0,105,0,
+115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,
+32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,
+99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,
+97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,
+0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,
+0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,
+0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,
+0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,
+0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,
+0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,
+0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,
+0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,
+0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,
+0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,
+99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,
+0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,
+0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,
+0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,
+0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,
+0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,
+0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,
+0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,
+0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,
+0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,
+102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,
+0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,
+0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,
+32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,
+111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,
+0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,
+0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,
+0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,254,172,0,100,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,0,0,1,81,0,2,0,3,0,11,0,12,0,15,0,17,1,2,
+1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,
+1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,
+1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,
+1,49,1,50,1,51,1,52,1,53,1,54,0,182,0,183,0,180,0,181,1,55,1,56,1,57,1,58,
+1,59,1,60,0,30,0,29,0,4,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,
+1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,82,7,117,110,105,48,54,
+48,67,7,117,110,105,48,54,49,66,7,117,110,105,48,54,49,70,7,117,110,105,48,
+55,56,48,7,117,110,105,48,55,56,49,7,117,110,105,48,55,56,50,7,117,110,105,
+48,55,56,51,7,117,110,105,48,55,56,52,7,117,110,105,48,55,56,53,7,117,110,
+105,48,55,56,54,7,117,110,105,48,55,56,55,7,117,110,105,48,55,56,56,7,117,
+110,105,48,55,56,57,7,117,110,105,48,55,56,65,7,117,110,105,48,55,56,66,7,
+117,110,105,48,55,56,67,7,117,110,105,48,55,56,68,7,117,110,105,48,55,56,
+69,7,117,110,105,48,55,56,70,7,117,110,105,48,55,57,48,7,117,110,105,48,55,
+57,49,7,117,110,105,48,55,57,50,7,117,110,105,48,55,57,51,7,117,110,105,48,
+55,57,52,7,117,110,105,48,55,57,53,7,117,110,105,48,55,57,54,7,117,110,105,
+48,55,57,55,7,117,110,105,48,55,57,56,7,117,110,105,48,55,57,57,7,117,110,
+105,48,55,57,65,7,117,110,105,48,55,57,66,7,117,110,105,48,55,57,67,7,117,
+110,105,48,55,57,68,7,117,110,105,48,55,57,69,7,117,110,105,48,55,57,70,7,
+117,110,105,48,55,65,48,7,117,110,105,48,55,65,49,7,117,110,105,48,55,65,
+50,7,117,110,105,48,55,65,51,7,117,110,105,48,55,65,52,7,117,110,105,48,55,
+65,53,7,117,110,105,48,55,65,54,7,117,110,105,48,55,65,55,7,117,110,105,48,
+55,65,56,7,117,110,105,48,55,65,57,7,117,110,105,48,55,65,65,7,117,110,105,
+48,55,65,66,7,117,110,105,48,55,65,67,7,117,110,105,48,55,65,68,7,117,110,
+105,48,55,65,69,7,117,110,105,48,55,65,70,7,117,110,105,48,55,66,48,7,117,
+110,105,48,55,66,49,7,117,110,105,50,53,67,67,7,117,110,105,70,68,70,50,8,
+68,111,116,65,98,111,118,101,8,68,111,116,66,101,108,111,119,9,84,104,114,
+101,101,68,111,116,115,7,84,119,111,68,111,116,115,7,117,110,105,48,54,54,
+48,7,117,110,105,48,54,54,49,7,117,110,105,48,54,54,50,7,117,110,105,48,54,
+54,51,7,117,110,105,48,54,54,52,7,117,110,105,48,54,54,53,7,117,110,105,48,
+54,54,54,7,117,110,105,48,54,54,55,7,117,110,105,48,54,54,56,7,117,110,105,
+48,54,54,57,11,117,110,105,70,68,70,50,46,97,108,116,7,117,110,105,70,68,
+70,68,7,117,110,105,48,54,54,65,7,117,110,105,48,54,54,66,7,117,110,105,48,
+54,54,67,7,117,110,105,50,48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,
+50,48,48,69,7,117,110,105,50,48,48,70,7,117,110,105,48,54,49,67,4,110,117,
+108,108,7,117,110,105,50,48,48,66,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,
+0,0,12,0,0,0,34,0,0,0,2,0,3,0,0,0,48,0,1,0,49,0,59,0,3,0,60,0,94,0,1,0,4,
+0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,30,0,46,0,1,116,104,97,97,0,8,0,4,0,0,0,0,
+255,255,0,1,0,0,0,1,109,97,114,107,0,8,0,0,0,2,0,0,0,1,0,2,0,6,0,14,0,4,0,
+0,0,1,0,16,0,4,0,0,0,1,0,170,0,1,0,130,0,146,0,1,0,12,0,50,0,9,0,0,1,20,0,
+0,1,26,0,0,1,32,0,0,1,38,0,0,1,44,0,0,1,38,0,0,1,50,0,0,1,56,0,0,1,62,0,39,
+1,30,1,36,1,42,1,48,1,54,1,60,1,66,1,72,1,78,1,72,1,72,1,84,1,90,1,96,1,102,
+1,60,1,108,1,114,1,72,1,36,1,54,1,120,1,126,1,72,1,132,1,30,1,138,1,144,1,
+150,1,156,1,108,1,54,1,90,1,162,1,120,1,168,1,174,1,180,1,72,0,2,0,2,0,49,
+0,50,0,0,0,53,0,59,0,2,0,2,0,2,0,11,0,48,0,0,0,60,0,60,0,38,0,1,0,102,0,110,
+0,1,0,12,0,22,0,2,0,0,1,62,0,0,1,68,0,39,1,64,1,64,1,64,1,64,1,70,1,76,1,
+64,1,82,1,88,1,94,1,100,1,76,1,94,1,64,1,64,1,106,1,64,1,94,1,112,1,112,1,
+100,1,118,1,112,1,70,1,70,1,64,1,64,1,124,1,124,1,64,1,64,1,64,1,130,1,82,
+1,136,1,88,1,64,1,88,1,106,0,1,0,2,0,51,0,52,0,2,0,2,0,11,0,48,0,0,0,60,0,
+60,0,38,0,1,1,84,3,132,0,1,1,184,3,132,0,1,1,4,3,132,0,1,2,88,3,132,0,1,1,
+64,3,132,0,1,1,204,3,132,0,1,1,104,3,132,0,1,1,24,3,132,0,1,2,188,4,36,0,
+1,2,238,4,36,0,1,3,112,4,36,0,1,2,138,4,36,0,1,3,62,4,36,0,1,2,168,4,36,0,
+1,2,208,4,36,0,1,2,28,4,36,0,1,2,18,4,36,0,1,2,128,4,36,0,1,2,88,4,36,0,1,
+1,184,4,36,0,1,2,48,4,36,0,1,4,96,4,36,0,1,1,104,4,36,0,1,1,244,4,36,0,1,
+2,68,4,36,0,1,1,194,4,206,0,1,2,108,4,106,0,1,2,188,4,236,0,1,2,88,4,106,
+0,1,4,76,4,216,0,1,2,38,4,106,0,1,2,28,4,106,0,1,1,244,4,106,0,1,1,184,4,
+106,0,1,0,220,255,156,0,1,1,44,255,156,0,1,1,204,255,136,0,1,2,48,255,136,
+0,1,1,244,255,136,0,1,1,144,255,136,0,1,1,84,255,136,0,1,1,164,255,136,0,
+1,1,184,255,136,0,1,2,48,254,172,0,1,1,244,254,172,0,1,0,240,254,172,0,1,
+2,88,255,136,0,1,1,144,255,36,0,1,1,164,255,16,0,0,0,1,0,0,0,10,0,30,0,44,
+0,1,116,104,97,97,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,115,97,108,116,0,8,
+0,0,0,1,0,0,0,1,0,4,0,1,0,0,0,1,0,8,0,2,0,8,0,1,0,84,0,1,0,1,0,66,0,0,};
+#endif
@@ -0,0 +1,915 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansThai_Regular_ttf_size = 22644;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansThai_Regular_ttf");
+asm(".type fz_font_NotoSansThai_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansThai_Regular_ttf, 22644");
+asm(".balign 64");
+asm("fz_font_NotoSansThai_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansThai-Regular.ttf\"");
+#else
+const int fz_font_NotoSansThai_Regular_ttf_size = 22644;
+const char fz_font_NotoSansThai_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,4,235,5,46,0,0,81,88,0,0,0,124,71,
+80,79,83,167,24,119,190,0,0,81,212,0,0,4,160,71,83,85,66,239,67,216,71,0,
+0,86,116,0,0,2,0,79,83,47,50,126,63,110,57,0,0,1,104,0,0,0,96,99,109,97,112,
+121,241,82,153,0,0,3,116,0,0,0,178,103,97,115,112,0,23,0,35,0,0,81,72,0,0,
+0,16,103,108,121,102,60,233,244,43,0,0,5,4,0,0,65,226,104,101,97,100,226,
+187,94,155,0,0,0,236,0,0,0,54,104,104,101,97,10,112,4,208,0,0,1,36,0,0,0,
+36,104,109,116,120,126,222,212,7,0,0,1,200,0,0,1,172,108,111,99,97,226,160,
+209,215,0,0,4,40,0,0,0,218,109,97,120,112,0,131,0,202,0,0,1,72,0,0,0,32,110,
+97,109,101,138,145,183,52,0,0,70,232,0,0,5,244,112,111,115,116,232,209,140,
+58,0,0,76,220,0,0,4,107,0,1,0,0,0,1,10,61,66,52,86,165,95,15,60,245,0,11,
+8,0,0,0,0,0,175,245,60,120,0,0,0,0,210,40,204,7,250,12,253,244,7,115,8,237,
+0,0,0,9,0,1,0,0,0,0,0,0,0,1,0,0,8,238,253,244,0,0,7,156,250,12,254,213,7,
+115,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,1,0,0,0,108,0,146,0,16,0,54,0,
+4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,4,229,1,144,0,5,0,0,5,154,5,51,
+0,0,1,30,5,154,5,51,0,0,3,208,0,102,1,242,0,0,2,11,5,2,4,5,4,2,2,4,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,238,253,244,0,0,
+8,238,2,12,0,0,0,1,0,0,0,0,6,63,8,237,0,0,0,32,0,2,5,42,0,166,0,0,0,0,0,199,
+0,0,2,20,0,0,4,240,0,133,5,72,0,57,5,72,0,57,5,39,0,113,5,39,0,113,5,92,0,
+57,3,201,0,49,4,164,0,94,5,43,0,86,5,72,0,57,5,72,0,57,7,20,0,133,7,0,0,133,
+7,0,0,133,5,35,0,45,5,35,0,45,4,117,0,85,4,117,0,107,6,97,0,57,7,56,0,113,
+7,156,0,133,5,39,0,113,5,39,0,113,5,39,0,133,5,137,0,45,4,150,0,123,5,1,0,
+45,5,25,0,45,5,25,0,45,5,63,0,184,5,63,0,184,5,153,0,45,5,153,0,45,5,35,0,
+45,4,201,0,75,5,21,0,163,4,10,0,75,5,39,0,133,5,4,0,110,5,35,0,45,3,226,0,
+0,5,39,0,113,5,127,0,45,5,5,0,110,5,40,0,45,5,99,0,45,4,185,0,115,4,171,0,
+125,4,83,0,37,3,233,0,77,0,0,253,119,3,226,0,0,3,226,254,51,0,0,251,230,0,
+0,251,230,0,0,251,230,0,0,251,230,0,0,254,69,0,0,253,21,0,0,254,137,4,104,
+0,145,2,116,0,184,4,142,0,184,3,142,0,24,3,153,0,34,3,229,0,35,3,226,0,0,
+3,246,0,57,0,0,252,163,0,0,254,178,0,0,253,34,0,0,252,136,0,0,254,64,0,0,
+252,191,0,0,254,51,0,0,254,17,5,38,0,75,5,80,0,131,5,80,0,132,5,80,0,159,
+5,80,0,127,5,80,0,128,5,80,0,128,5,80,0,109,5,80,0,83,5,80,0,108,5,80,0,122,
+5,189,0,37,7,83,0,76,0,0,254,170,0,0,253,67,0,0,252,156,0,0,254,56,0,0,252,
+214,0,0,0,0,4,193,0,102,0,0,0,0,0,0,255,202,0,0,254,213,1,102,0,25,1,223,
+0,25,0,0,252,19,251,255,250,12,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,166,0,0,0,36,
+0,32,0,4,0,4,0,0,0,13,0,32,0,160,2,188,2,215,3,3,3,49,14,13,14,16,14,58,14,
+71,14,76,14,91,32,13,37,204,254,255,255,255,0,0,0,0,0,13,0,32,0,160,2,188,
+2,215,3,3,3,49,14,1,14,14,14,17,14,63,14,72,14,77,32,11,37,204,254,255,255,
+255,0,1,255,245,255,227,255,99,253,171,253,145,253,102,253,57,242,3,242,4,
+242,5,242,1,242,21,242,1,0,0,218,151,1,101,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,98,0,101,0,102,0,0,0,0,0,
+20,0,20,0,20,0,20,0,86,0,190,1,45,1,139,1,236,2,119,2,196,3,30,3,140,4,13,
+4,149,5,32,5,190,6,44,6,194,7,105,8,50,8,148,9,11,9,163,10,51,10,150,11,3,
+11,99,11,168,11,226,12,61,12,121,12,181,12,240,13,43,13,101,13,159,13,253,
+14,86,14,172,14,241,15,81,15,171,16,7,16,70,16,192,17,47,17,165,18,20,18,
+123,18,211,19,72,19,127,19,227,20,26,20,59,20,70,20,113,20,162,20,240,21,
+37,21,77,21,122,21,154,21,239,22,27,22,39,22,108,22,225,23,39,23,73,23,154,
+23,250,24,7,24,76,24,174,24,195,25,2,25,40,25,103,25,186,25,244,26,97,26,
+208,27,68,27,166,28,44,28,156,29,17,29,139,30,3,30,64,30,184,30,197,31,8,
+31,106,31,127,31,190,31,190,32,101,32,101,32,114,32,144,32,163,32,176,32,
+215,32,228,32,241,0,0,0,2,0,166,0,0,4,132,5,118,0,3,0,7,0,0,51,17,33,17,37,
+33,17,33,166,3,222,252,182,2,182,253,74,5,118,250,138,148,4,78,0,1,0,133,
+0,0,4,76,4,123,0,46,0,0,51,17,52,62,2,55,46,3,35,62,3,51,50,30,2,21,17,35,
+17,52,46,2,35,34,14,2,7,30,3,23,21,14,3,21,17,166,24,53,84,60,25,73,75,65,
+16,4,59,117,178,123,140,187,112,47,168,34,75,121,88,81,112,72,38,6,40,76,
+65,50,15,57,83,52,25,1,137,53,84,63,43,13,21,30,20,9,92,154,111,61,67,120,
+166,98,253,72,2,172,76,121,85,45,35,57,72,36,6,28,36,41,18,57,12,36,55,78,
+53,254,121,0,0,2,0,57,0,0,4,164,4,123,0,64,0,76,0,0,37,51,17,52,62,2,55,52,
+46,2,35,34,14,2,21,54,54,51,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,51,50,
+30,2,21,14,3,21,17,51,50,54,53,17,51,17,20,14,2,35,33,19,52,38,35,34,6,21,
+20,22,51,50,54,1,81,163,22,45,68,47,20,53,91,72,67,100,66,33,19,63,37,32,
+59,45,26,28,48,67,39,57,84,54,27,43,94,148,104,104,152,100,48,51,70,43,18,
+108,125,119,168,44,87,129,86,254,7,18,44,35,33,43,43,33,35,44,135,1,135,59,
+93,78,65,31,26,62,54,36,32,55,75,43,23,31,20,42,64,44,42,63,43,22,40,72,100,
+60,68,122,92,54,47,80,108,62,40,72,75,84,53,254,121,119,135,2,225,252,252,
+79,131,93,51,2,197,34,40,40,34,35,42,42,0,0,2,0,57,0,0,4,164,4,117,0,68,0,
+80,0,0,37,51,17,52,62,2,55,52,46,2,39,7,39,14,3,21,54,54,51,50,30,2,21,20,
+14,2,35,34,46,2,53,52,62,2,55,23,55,30,3,21,14,3,21,17,51,50,54,53,17,51,
+17,20,14,2,35,33,19,52,38,35,34,6,21,20,22,51,50,54,1,81,163,11,38,72,61,
+7,21,41,35,144,145,37,43,23,6,19,63,37,32,59,45,26,28,48,67,39,57,84,54,27,
+27,59,92,64,135,135,79,108,66,28,59,72,39,12,108,125,119,168,44,87,129,86,
+254,7,18,44,35,33,43,43,33,35,44,135,1,135,41,83,80,77,34,21,50,47,38,8,127,
+129,9,43,54,55,21,23,31,20,42,64,44,42,63,43,22,42,72,98,56,57,109,91,65,
+12,123,123,10,57,81,100,54,40,77,78,78,40,254,121,119,135,2,225,252,252,79,
+131,93,51,2,197,34,40,40,34,35,42,42,0,0,2,0,113,0,0,4,131,4,123,0,57,0,69,
+0,0,1,14,3,7,21,21,35,53,52,46,4,53,52,62,2,51,50,30,2,21,17,35,17,52,46,
+2,35,34,14,2,21,20,30,2,23,62,3,51,50,22,21,20,6,35,34,38,55,52,38,35,34,
+6,21,20,22,51,50,54,1,254,10,47,49,38,1,168,12,19,22,19,12,72,136,195,123,
+140,196,124,56,168,43,87,131,87,84,133,93,50,10,17,20,9,24,58,75,95,62,97,
+106,104,99,45,75,215,53,44,41,54,54,41,44,53,1,180,10,58,93,129,81,24,41,
+119,81,125,102,84,82,85,51,94,154,110,60,67,120,166,98,253,72,2,172,76,121,
+85,45,39,72,103,64,46,88,89,92,51,83,144,106,60,101,90,91,99,34,156,45,49,
+49,45,42,51,51,0,0,2,0,113,0,0,4,131,4,119,0,58,0,70,0,0,1,14,3,7,21,35,53,
+52,46,4,53,52,62,2,55,23,55,30,3,21,17,35,17,52,46,2,39,7,39,14,3,21,20,22,
+23,62,3,51,50,22,21,20,6,35,34,38,55,52,38,35,34,6,21,20,22,51,50,54,1,254,
+10,47,48,38,2,168,12,19,22,19,12,35,81,134,98,176,176,103,132,77,30,168,15,
+39,68,52,176,178,50,69,42,19,38,19,24,58,75,95,61,97,106,104,99,45,75,215,
+53,44,41,54,54,41,44,53,1,180,10,57,91,125,80,73,119,81,125,102,84,82,85,
+51,83,129,100,74,28,146,146,29,77,106,141,94,253,72,2,172,71,96,68,47,21,
+143,143,20,46,60,77,51,95,177,90,83,142,104,60,101,90,91,99,34,156,45,49,
+49,45,42,51,51,0,3,0,57,255,238,4,164,4,117,0,11,0,21,0,101,0,0,1,52,38,35,
+34,6,21,20,22,51,50,54,19,20,22,51,50,54,53,53,6,6,5,20,14,2,35,34,38,53,
+52,62,2,55,53,52,62,2,55,52,46,2,39,7,39,14,3,21,54,54,51,50,30,2,21,20,14,
+2,35,34,46,2,53,52,62,2,55,23,55,30,3,21,14,3,21,21,22,22,23,17,51,17,35,
+46,3,39,1,99,44,35,33,43,43,33,35,44,4,41,32,38,30,74,67,1,53,22,49,80,59,
+108,108,28,62,98,70,11,38,72,61,7,21,41,35,144,145,37,43,23,6,19,63,37,32,
+59,45,26,28,48,67,39,57,84,54,27,27,59,92,64,135,135,79,108,66,28,59,72,39,
+12,102,185,65,168,168,31,80,92,99,50,2,197,34,40,40,34,35,42,42,254,10,43,
+43,47,45,113,11,61,8,57,86,57,29,100,90,42,74,58,40,8,132,41,83,80,77,34,
+21,50,47,38,8,127,129,9,43,54,55,21,23,31,20,42,64,44,42,63,43,22,42,72,98,
+56,57,109,91,65,12,123,123,10,57,81,100,54,40,77,78,78,40,138,14,97,80,3,
+161,251,154,50,92,75,52,10,0,2,0,49,255,236,3,37,4,113,0,42,0,54,0,0,1,34,
+38,53,52,54,51,50,22,21,17,20,6,35,34,46,2,39,46,3,35,53,50,30,4,23,30,3,
+51,50,54,53,17,6,6,39,20,22,51,50,54,53,52,38,35,34,6,2,76,90,101,106,97,
+99,106,131,146,76,98,68,50,27,26,36,33,37,28,51,76,56,42,35,33,19,25,40,39,
+40,25,51,56,5,32,95,53,44,41,54,54,41,44,53,2,244,99,91,90,101,101,90,253,
+74,136,136,38,84,134,96,95,105,51,11,143,11,29,49,76,106,71,94,111,59,18,
+55,68,2,12,2,2,190,42,51,51,42,44,50,50,0,0,2,0,94,255,236,4,0,4,123,0,50,
+0,62,0,0,5,34,46,2,39,39,6,6,35,34,38,53,52,54,51,50,30,2,23,23,22,22,51,
+50,54,53,17,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,17,20,14,2,1,20,22,51,
+50,54,53,52,38,35,34,6,2,250,68,91,66,51,27,53,17,56,20,99,103,105,97,47,
+67,52,43,23,96,26,53,40,42,54,40,79,118,78,93,189,87,78,91,218,138,113,179,
+125,66,27,62,100,253,151,53,44,42,53,53,42,44,53,20,23,57,95,72,140,7,12,
+100,91,89,101,26,55,87,61,254,68,55,54,69,1,217,63,106,77,43,66,58,124,61,
+78,59,109,153,95,254,33,68,102,68,34,2,47,43,50,50,43,44,50,50,0,0,3,0,86,
+255,238,5,2,4,123,0,11,0,69,0,79,0,0,19,20,22,51,50,54,53,52,38,35,34,6,5,
+30,3,21,20,6,35,34,46,2,53,53,14,3,7,35,17,6,6,35,34,38,53,52,54,51,50,22,
+21,17,62,3,55,17,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,19,52,38,39,21,
+20,22,51,50,54,194,53,44,41,54,54,41,44,53,3,62,70,98,62,28,108,108,58,81,
+49,22,50,103,95,84,30,168,5,32,13,89,101,106,97,99,106,32,83,95,101,51,40,
+79,118,78,93,189,87,78,91,218,138,113,179,125,66,141,67,74,30,38,32,41,2,
+61,42,51,51,42,44,50,50,223,8,40,58,74,42,90,100,29,57,86,57,68,10,52,75,
+92,50,1,130,2,2,100,91,90,100,100,90,254,136,40,64,48,32,7,1,75,63,106,77,
+43,66,58,124,61,78,59,109,153,95,253,209,47,61,11,113,45,47,43,0,2,0,57,0,
+0,5,124,4,183,0,83,0,95,0,0,37,51,17,52,62,2,55,52,46,2,35,34,14,2,21,54,
+54,51,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,21,14,3,21,17,51,
+50,54,53,17,52,38,39,53,62,3,55,55,51,7,14,3,7,22,22,21,17,20,14,2,35,33,
+19,52,38,35,34,6,21,20,22,51,50,54,1,81,163,22,45,68,47,20,53,91,72,67,100,
+66,33,19,63,37,32,59,45,26,28,48,67,39,57,84,54,27,43,94,148,104,104,152,
+100,48,51,70,43,18,108,124,120,49,46,29,51,53,60,38,60,188,61,41,64,61,67,
+43,60,61,44,87,129,86,254,7,18,44,35,33,43,43,33,35,44,135,1,135,58,94,78,
+65,31,25,62,54,37,32,55,75,43,23,31,21,42,64,43,42,63,43,22,40,72,100,60,
+68,122,92,54,47,80,109,61,40,72,75,85,52,254,121,119,135,1,25,66,74,18,46,
+10,33,56,82,59,93,90,60,89,64,42,13,19,92,60,254,188,79,131,93,51,2,197,34,
+40,40,34,35,42,42,0,0,2,0,57,0,0,5,124,4,183,0,87,0,99,0,0,1,22,22,21,17,
+20,14,2,35,33,53,51,17,52,62,2,55,52,46,2,39,7,39,14,3,21,54,54,51,50,30,
+2,21,20,14,2,35,34,46,2,53,52,62,2,55,23,55,30,3,21,14,3,21,17,51,50,54,53,
+17,52,38,39,53,62,3,55,55,51,7,14,3,5,52,38,35,34,6,21,20,22,51,50,54,4,43,
+60,61,44,87,129,86,254,7,163,11,38,72,61,7,21,42,34,144,145,37,43,23,6,19,
+63,37,32,59,45,26,28,48,67,39,57,84,54,27,27,59,91,65,135,135,79,108,66,28,
+59,72,39,12,108,124,120,49,46,29,51,53,60,38,60,188,61,41,64,61,67,253,13,
+44,35,33,43,43,33,35,44,3,81,19,92,60,254,188,79,131,93,51,135,1,135,41,83,
+80,76,35,21,50,47,38,8,127,129,9,43,54,55,21,23,31,21,42,64,43,42,63,43,22,
+42,72,98,56,57,109,91,65,12,123,123,10,57,81,100,54,40,77,78,78,40,254,121,
+119,135,1,25,66,74,18,46,10,33,56,82,59,93,90,60,89,64,42,153,34,40,40,34,
+35,42,42,0,0,3,0,133,255,238,6,92,4,123,0,11,0,21,0,102,0,0,37,52,38,35,34,
+6,21,20,22,51,50,54,37,20,22,51,50,54,53,53,6,6,1,30,3,23,21,14,3,21,21,54,
+54,51,50,22,21,20,6,35,34,38,53,53,52,62,2,55,46,3,35,62,3,51,50,30,2,21,
+17,22,22,23,17,51,17,35,46,3,39,21,20,6,35,34,38,53,52,62,2,55,17,52,46,2,
+35,34,14,2,1,210,53,44,42,53,53,42,44,53,1,77,41,32,38,40,74,77,254,18,40,
+76,65,50,15,57,83,52,25,5,27,13,93,101,105,97,99,106,24,53,84,60,25,73,75,
+65,16,4,67,126,183,118,134,186,116,51,102,175,65,168,168,31,77,88,96,50,103,
+117,108,108,31,66,101,70,37,78,120,82,80,115,79,45,172,42,50,50,42,44,51,
+51,44,43,43,47,45,113,11,61,2,80,6,28,36,41,18,57,12,36,55,78,53,33,2,2,99,
+91,90,100,100,90,221,53,84,63,43,13,21,30,20,9,92,154,111,61,67,120,166,98,
+254,204,14,97,80,3,161,251,154,50,92,75,52,10,68,114,115,100,90,42,74,58,
+40,8,1,34,76,121,85,45,35,57,72,0,0,4,0,133,254,36,6,115,4,123,0,11,0,81,
+0,106,0,118,0,0,37,52,38,35,34,6,21,20,22,51,50,54,5,17,52,46,2,35,34,14,
+2,7,30,3,23,21,14,3,21,21,54,54,51,50,22,21,20,6,35,34,38,53,53,52,62,2,55,
+46,3,35,62,3,51,50,30,2,21,17,51,50,54,53,17,51,17,20,14,2,35,3,34,46,2,53,
+52,54,51,50,22,21,20,6,7,62,3,55,51,14,3,39,20,22,51,50,54,53,52,38,35,34,
+6,1,210,53,44,42,53,53,42,44,53,1,228,38,78,120,83,79,115,78,45,9,40,76,65,
+50,15,57,83,52,25,5,27,13,93,101,105,97,99,106,24,53,84,60,25,73,75,65,16,
+4,67,126,183,118,134,186,116,51,98,125,119,168,44,87,129,86,113,62,97,66,
+34,101,86,88,97,29,15,50,80,64,52,22,145,39,88,114,146,253,47,39,36,48,48,
+36,39,47,172,42,50,50,42,44,51,51,128,2,172,76,121,85,45,35,57,72,36,6,28,
+36,41,18,57,12,36,55,78,53,33,2,2,99,91,90,100,100,90,221,53,84,63,43,13,
+21,30,20,9,92,154,111,61,67,120,166,98,253,207,119,135,2,225,252,252,79,131,
+93,51,254,36,30,53,74,44,80,92,89,72,42,51,13,9,42,63,85,52,79,131,95,52,
+200,38,45,45,38,39,45,45,0,0,2,0,133,255,238,6,92,4,123,0,11,0,81,0,0,37,
+52,38,35,34,6,21,20,22,51,50,54,5,17,52,46,2,35,34,14,2,7,30,3,23,21,14,3,
+21,21,54,54,51,50,22,21,20,6,35,34,38,53,53,52,62,2,55,46,3,35,62,3,51,50,
+30,2,21,17,51,50,54,53,17,51,17,20,14,2,35,1,210,53,44,42,53,53,42,44,53,
+1,228,38,78,120,83,79,115,78,45,9,40,76,65,50,15,57,83,52,25,5,27,13,93,101,
+105,97,99,106,24,53,84,60,25,73,75,65,16,4,67,126,183,118,134,186,116,51,
+98,125,119,168,44,87,129,86,172,42,50,50,42,44,51,51,128,2,172,76,121,85,
+45,35,57,72,36,6,28,36,41,18,57,12,36,55,78,53,33,2,2,99,91,90,100,100,90,
+221,53,84,63,43,13,21,30,20,9,92,154,111,61,67,120,166,98,253,207,119,135,
+2,225,252,252,79,131,93,51,0,0,3,0,45,253,248,4,127,4,123,0,83,0,95,0,109,
+0,0,1,30,3,23,21,14,3,21,21,20,6,35,34,38,53,52,54,51,50,22,23,53,52,62,2,
+55,46,3,35,62,3,51,50,30,2,21,17,35,38,38,39,6,6,35,34,46,2,53,52,54,51,50,
+22,23,54,54,55,51,6,7,22,22,23,17,52,46,2,35,34,14,2,3,20,22,51,50,54,53,
+52,38,35,34,6,1,34,6,21,20,22,51,50,62,2,55,38,38,1,105,48,96,83,64,18,58,
+82,52,25,106,99,97,106,102,93,12,28,5,24,52,84,60,31,90,92,81,21,4,60,117,
+175,118,134,186,116,51,158,43,120,63,46,125,63,45,70,50,26,98,93,45,93,35,
+8,7,2,121,7,28,52,90,32,38,78,120,83,79,108,69,38,217,53,44,41,54,54,41,44,
+53,1,123,32,47,47,32,16,36,37,36,16,42,72,3,43,6,28,36,41,18,57,12,36,55,
+78,53,219,90,100,100,90,91,99,2,2,35,53,84,63,43,13,21,30,20,9,92,154,111,
+61,67,120,166,98,251,64,54,111,44,76,80,26,47,65,38,82,100,30,18,26,55,37,
+99,78,34,74,34,4,18,76,121,85,45,35,57,72,253,93,44,51,51,44,42,50,50,254,
+90,35,44,41,39,11,27,45,33,21,22,0,3,0,45,253,248,4,127,4,123,0,97,0,109,
+0,121,0,0,1,30,3,23,21,14,3,21,21,20,6,35,34,38,53,52,54,51,50,22,23,53,52,
+62,2,55,46,3,35,62,3,51,50,30,2,21,17,35,38,38,39,6,6,7,38,38,39,6,6,35,34,
+46,2,53,52,54,51,50,22,23,54,55,51,6,6,7,22,22,23,54,54,55,30,3,23,17,52,
+46,2,35,34,14,2,3,20,22,51,50,54,53,52,38,35,34,6,19,34,6,21,20,22,51,50,
+54,55,38,38,1,105,48,96,83,64,18,58,82,52,25,106,99,97,106,102,93,12,28,5,
+24,52,84,60,31,90,92,81,21,4,60,117,175,118,134,186,116,51,158,41,101,48,
+25,86,57,26,58,32,54,122,73,36,65,48,29,98,93,52,109,48,70,12,126,7,64,52,
+21,40,17,32,59,22,28,59,57,51,20,38,78,120,83,79,108,69,38,217,53,44,41,54,
+54,41,44,53,128,32,47,47,32,36,89,36,37,84,3,43,6,28,36,41,18,57,12,36,55,
+78,53,219,90,100,100,90,91,99,2,2,35,53,84,63,43,13,21,30,20,9,92,154,111,
+61,67,120,166,98,251,64,51,97,40,48,81,28,38,69,29,62,70,23,45,66,42,81,101,
+43,33,122,167,97,183,78,20,41,19,26,93,59,19,46,49,48,21,4,17,76,121,85,45,
+35,57,72,253,93,44,51,51,44,42,50,50,254,72,35,44,41,39,49,55,26,29,0,5,0,
+85,253,248,3,253,4,103,0,11,0,70,0,122,0,133,0,145,0,0,19,20,22,51,50,54,
+53,52,38,35,34,6,5,52,38,35,33,52,62,2,51,33,21,33,34,14,2,21,33,50,30,2,
+21,21,20,14,2,35,34,46,2,39,39,6,6,35,34,38,53,52,54,51,50,30,2,23,23,22,
+22,51,50,62,2,53,3,6,6,7,22,22,23,54,54,55,22,22,23,53,6,35,34,38,53,52,54,
+51,50,22,21,17,35,38,38,39,6,6,7,38,38,39,6,6,35,34,46,2,53,52,54,51,50,22,
+23,54,55,5,20,22,51,50,54,53,52,38,35,34,5,34,6,21,20,22,51,50,54,55,38,38,
+241,53,44,42,53,53,42,44,53,2,77,126,135,254,50,38,89,147,110,2,18,253,223,
+43,74,52,30,1,70,107,150,94,44,27,62,100,73,68,88,63,50,31,7,17,56,20,99,
+103,105,97,52,71,51,38,20,53,21,53,43,19,34,25,14,240,11,30,20,19,35,14,19,
+48,18,47,103,48,8,14,58,56,59,69,63,72,127,34,89,49,24,73,34,24,46,26,41,
+110,67,36,65,48,29,98,93,45,89,36,16,7,1,94,24,23,20,25,25,20,47,253,224,
+32,47,47,32,32,75,28,30,73,1,155,43,50,50,43,44,50,50,5,119,125,128,167,99,
+39,133,21,41,63,42,41,93,149,107,185,68,102,68,34,23,56,94,70,16,7,12,100,
+91,89,101,32,60,85,52,142,56,61,13,28,48,34,254,168,50,95,44,20,44,20,12,
+52,25,19,48,31,94,4,59,54,54,61,61,56,254,181,30,58,19,28,59,20,34,71,30,
+58,74,23,45,66,42,81,101,34,26,52,59,79,21,24,24,21,23,24,118,35,44,41,39,
+48,57,26,28,0,0,2,0,107,255,236,3,253,4,103,0,11,0,70,0,0,19,20,22,51,50,
+54,53,52,38,35,34,6,5,52,38,35,33,52,62,2,51,33,21,33,34,14,2,21,33,50,30,
+2,21,21,20,14,2,35,34,46,2,39,39,6,6,35,34,38,53,52,54,51,50,30,2,23,23,22,
+22,51,50,62,2,53,241,53,44,42,53,53,42,44,53,2,77,126,135,254,50,38,89,147,
+110,2,18,253,223,43,74,52,30,1,70,107,150,94,44,27,62,100,73,68,88,63,50,
+31,7,17,56,20,99,103,105,97,52,71,51,38,20,53,21,53,43,19,34,25,14,1,155,
+43,50,50,43,44,50,50,5,119,125,128,167,99,39,133,21,41,63,42,41,93,149,107,
+185,68,102,68,34,23,56,94,70,16,7,12,100,91,89,101,32,60,85,52,142,56,61,
+13,28,48,34,0,0,2,0,57,0,0,5,189,4,123,0,11,0,85,0,0,1,52,38,35,34,6,21,20,
+22,51,50,54,1,35,17,52,62,2,55,52,46,2,39,7,39,14,3,21,54,54,51,50,30,2,21,
+20,14,2,35,34,46,2,53,52,62,2,55,23,55,30,3,21,14,3,21,17,1,62,3,51,50,22,
+21,17,35,17,52,38,35,34,6,7,1,99,44,35,33,43,43,33,35,44,1,140,251,11,38,
+72,61,7,21,41,35,144,145,37,43,23,6,19,63,37,32,59,45,26,28,48,67,39,57,84,
+54,27,27,59,92,64,135,135,79,108,66,28,59,72,39,12,1,113,30,56,60,69,43,85,
+89,168,19,17,17,43,35,2,197,34,40,40,34,35,42,42,253,94,2,14,41,83,80,77,
+34,21,50,47,38,8,127,129,9,43,54,55,21,23,31,20,42,64,44,42,63,43,22,42,72,
+98,56,57,109,91,65,12,123,123,10,57,81,100,54,40,77,78,78,40,254,136,3,6,
+65,86,51,21,118,121,252,116,3,158,45,40,58,72,0,3,0,113,255,238,6,128,4,119,
+0,11,0,21,0,111,0,0,1,52,38,35,34,6,21,20,22,51,50,54,19,20,22,51,50,54,53,
+53,6,6,5,35,46,3,39,21,20,6,35,34,38,53,52,62,2,55,19,52,46,2,39,7,39,14,
+3,21,20,30,2,23,62,5,55,38,38,53,52,54,51,50,22,21,20,14,2,7,14,3,7,35,53,
+52,46,4,53,52,62,2,55,23,55,30,3,21,17,22,22,23,17,51,2,218,53,44,41,54,54,
+41,44,53,105,41,32,38,40,74,77,3,61,178,31,74,84,93,50,103,117,108,108,31,
+66,101,70,1,15,39,68,52,176,178,50,69,42,19,21,29,27,6,15,47,52,54,45,31,
+3,85,92,106,97,100,105,26,47,65,39,37,89,82,67,16,175,12,19,22,19,12,35,81,
+134,98,176,176,103,133,76,29,102,175,65,168,2,77,45,49,49,45,42,51,51,254,
+137,43,43,47,45,113,11,61,219,50,95,78,56,10,78,114,115,100,90,42,74,58,40,
+8,1,34,71,96,68,47,21,143,143,20,46,60,77,51,69,126,136,155,97,15,40,44,47,
+45,41,17,7,99,84,90,101,109,103,54,88,76,69,35,33,72,67,56,18,119,81,125,
+102,84,82,85,51,83,129,100,74,28,146,146,29,77,106,141,94,254,214,14,107,
+80,3,161,0,3,0,133,255,238,7,115,4,123,0,11,0,96,0,106,0,0,37,52,38,35,34,
+6,21,20,22,51,50,54,1,17,30,3,21,20,6,35,34,46,2,53,53,14,3,7,35,17,52,46,
+2,35,34,14,2,7,30,3,23,21,14,3,21,21,54,54,51,50,22,21,20,6,35,34,38,53,53,
+52,62,2,55,46,3,35,62,3,51,50,30,2,21,17,62,3,55,17,1,52,38,39,21,20,22,51,
+50,54,1,210,53,44,42,53,53,42,44,53,4,159,70,98,62,28,108,108,58,81,49,22,
+50,103,95,84,30,169,38,78,120,83,79,115,78,45,9,40,76,65,50,15,57,83,52,25,
+5,27,13,93,101,105,97,99,106,24,53,84,60,25,73,75,65,16,4,67,126,183,118,
+134,186,115,52,32,84,94,102,51,1,53,67,74,30,38,32,41,172,42,50,50,42,44,
+51,51,3,230,253,36,8,40,58,74,42,90,100,29,57,86,57,68,10,52,75,92,50,2,172,
+76,121,85,45,35,57,72,36,6,28,36,41,18,57,12,36,55,78,53,33,2,2,99,91,90,
+100,100,90,221,53,84,63,43,13,21,30,20,9,92,154,111,61,67,120,166,98,254,
+13,40,64,48,32,7,2,226,252,70,47,61,11,113,45,47,43,0,0,2,0,113,0,0,4,131,
+4,123,0,11,0,72,0,0,1,52,38,35,34,6,21,20,22,51,50,54,7,38,38,53,52,54,51,
+50,22,21,20,14,2,7,14,3,7,35,53,52,46,4,53,52,62,2,51,50,30,2,21,17,35,17,
+52,46,2,35,34,14,2,21,20,30,2,23,62,3,2,218,53,44,41,54,54,41,44,53,121,85,
+92,106,97,100,105,26,47,65,39,37,89,82,67,16,175,12,19,22,19,12,72,136,195,
+123,140,196,124,56,168,43,87,131,87,84,133,93,50,21,29,27,6,23,79,78,62,2,
+57,45,49,49,45,42,51,51,148,7,99,84,90,101,109,103,54,88,76,69,35,33,66,59,
+50,18,119,81,125,102,84,82,85,51,94,154,110,60,67,120,166,98,253,72,2,172,
+76,121,85,45,39,72,103,64,69,126,136,155,97,23,58,62,61,0,0,2,0,113,0,0,4,
+131,4,119,0,11,0,78,0,0,1,52,38,35,34,6,21,20,22,51,50,54,37,52,62,2,55,23,
+55,30,3,21,17,35,17,52,46,2,39,7,39,14,3,21,20,30,2,23,62,5,55,38,38,53,52,
+54,51,50,22,21,20,14,2,7,14,3,7,35,53,52,46,4,2,218,53,44,41,54,54,41,44,
+53,253,151,35,81,134,98,176,176,103,132,77,30,168,15,39,68,52,176,178,50,
+69,42,19,21,29,27,6,15,47,52,54,45,31,3,85,92,106,97,100,105,26,47,65,39,
+37,89,82,67,16,175,12,19,22,19,12,2,77,45,49,49,45,42,51,51,182,83,129,100,
+74,28,146,146,29,77,106,141,94,253,72,2,172,71,96,68,47,21,143,143,20,46,
+60,77,51,69,126,136,155,97,15,40,44,47,45,41,17,7,99,84,90,101,109,103,54,
+88,76,69,35,33,72,67,56,18,119,81,125,102,84,82,85,0,0,2,0,133,255,238,4,
+131,4,123,0,11,0,69,0,0,37,52,38,35,34,6,21,20,22,51,50,54,1,62,3,51,50,30,
+2,21,17,35,17,52,46,2,35,34,14,2,7,30,3,23,21,14,3,21,21,54,54,51,50,22,21,
+20,6,35,34,38,53,53,52,62,2,55,46,3,1,210,53,44,42,53,53,42,44,53,254,179,
+4,70,130,189,123,140,193,120,53,168,40,83,127,88,84,120,83,47,10,40,76,65,
+50,15,57,83,52,25,5,32,12,90,100,105,97,99,106,24,53,84,60,25,73,75,65,172,
+42,50,50,42,44,51,51,2,89,92,154,111,61,67,120,166,98,253,72,2,172,76,121,
+85,45,35,57,72,36,6,28,36,41,18,57,12,36,55,78,53,33,2,2,99,91,90,100,100,
+90,221,53,84,63,43,13,21,30,20,9,0,0,2,0,45,0,0,4,229,4,123,0,33,0,45,0,0,
+33,17,6,6,35,34,38,53,52,54,51,50,22,21,17,1,62,3,51,50,22,21,17,35,17,52,
+38,35,34,6,7,1,1,20,22,51,50,54,53,52,38,35,34,6,1,28,5,31,13,89,101,106,
+97,99,105,1,113,30,56,60,69,43,85,89,168,19,17,17,44,34,254,93,254,130,52,
+45,41,54,54,41,45,52,2,248,2,2,99,91,90,101,101,90,252,228,3,6,65,86,51,21,
+118,121,252,116,3,157,45,40,57,72,252,143,3,178,42,51,51,42,44,50,50,0,0,
+1,0,123,0,0,4,13,4,103,0,39,0,0,1,52,38,35,33,52,62,2,51,33,21,33,34,14,2,
+21,33,50,30,2,21,21,20,14,2,35,33,17,51,17,33,50,62,2,53,3,95,126,135,254,
+33,38,89,147,110,2,18,253,223,43,74,52,30,1,87,107,150,94,44,44,87,130,86,
+253,248,168,1,31,62,92,60,30,1,154,119,125,129,180,113,51,133,28,52,77,50,
+41,93,149,107,43,79,131,93,51,1,193,254,207,22,53,90,68,0,3,0,45,255,238,
+4,216,4,113,0,11,0,53,0,63,0,0,19,20,22,51,50,54,53,52,38,35,34,6,37,17,30,
+3,21,20,6,35,34,46,2,53,53,14,3,7,35,17,6,6,35,34,38,53,52,54,51,50,22,21,
+17,62,3,55,17,1,52,38,39,21,20,22,51,50,54,153,52,45,41,54,54,41,45,52,3,
+61,70,98,62,28,108,108,58,81,49,22,50,103,95,84,30,168,5,31,13,89,101,106,
+97,99,105,32,83,95,101,51,1,53,67,74,30,38,32,41,3,178,42,51,51,42,44,50,
+50,136,253,36,8,40,58,74,42,90,100,29,57,86,57,68,10,52,75,92,50,2,248,2,
+2,99,91,90,101,101,90,253,19,40,64,48,32,7,2,226,252,70,47,61,11,113,45,47,
+43,0,0,2,0,45,0,0,4,117,4,113,0,28,0,40,0,0,55,51,17,6,6,35,34,38,53,52,54,
+51,50,22,21,17,33,50,54,53,17,51,17,20,14,2,35,33,19,20,22,51,50,54,53,52,
+38,35,34,6,111,173,5,31,13,89,101,106,97,99,105,1,22,125,118,168,44,87,130,
+86,253,85,42,52,45,41,54,54,41,45,52,135,2,113,2,2,99,91,90,101,101,90,252,
+213,118,136,2,225,252,252,79,131,93,51,3,178,42,51,51,42,44,50,50,0,0,2,0,
+45,0,0,4,117,6,154,0,28,0,40,0,0,55,51,17,6,6,35,34,38,53,52,54,51,50,22,
+21,17,33,50,54,53,17,51,17,20,14,2,35,33,19,20,22,51,50,54,53,52,38,35,34,
+6,111,173,5,31,13,89,101,106,97,99,105,1,22,125,118,168,44,87,130,86,253,
+85,42,52,45,41,54,54,41,45,52,135,2,113,2,2,99,91,90,101,101,90,252,213,118,
+136,5,21,250,200,79,131,93,51,3,178,42,51,51,42,44,50,50,0,0,2,0,184,0,0,
+4,135,4,113,0,23,0,35,0,0,19,52,54,51,50,22,21,20,6,35,34,38,39,17,1,51,1,
+17,51,17,35,1,1,35,1,52,38,35,34,6,21,20,22,51,50,54,184,106,99,97,106,101,
+90,12,32,5,1,15,98,1,14,168,162,254,187,254,187,163,1,44,53,44,41,54,54,41,
+44,53,3,178,90,101,101,90,91,99,2,2,253,227,1,129,254,127,3,139,251,154,1,
+208,254,48,3,178,44,50,50,44,42,51,51,0,0,2,0,184,0,0,4,135,6,154,0,23,0,
+35,0,0,19,52,54,51,50,22,21,20,6,35,34,38,39,17,1,51,1,17,51,17,35,1,1,35,
+1,52,38,35,34,6,21,20,22,51,50,54,184,106,99,97,106,101,90,12,32,5,1,15,98,
+1,14,168,162,254,187,254,187,163,1,44,53,44,41,54,54,41,44,53,3,178,90,101,
+101,90,91,99,2,2,253,227,1,129,254,127,5,191,249,102,1,208,254,48,3,178,44,
+50,50,44,42,51,51,0,0,2,0,45,0,0,4,225,4,113,0,23,0,35,0,0,33,17,6,6,35,34,
+38,53,52,54,51,50,22,21,17,1,51,1,17,51,17,35,9,2,20,22,51,50,54,53,52,38,
+35,34,6,1,28,5,31,13,89,101,106,97,99,105,1,6,105,1,6,168,200,254,230,254,
+229,254,181,52,45,41,54,54,41,45,52,2,248,2,2,99,91,90,101,101,90,253,77,
+3,93,252,163,3,103,251,154,3,159,252,97,3,178,42,51,51,42,44,50,50,0,2,0,
+45,0,0,4,225,6,154,0,23,0,35,0,0,33,17,6,6,35,34,38,53,52,54,51,50,22,21,
+17,1,51,1,17,51,17,35,9,2,20,22,51,50,54,53,52,38,35,34,6,1,28,5,31,13,89,
+101,106,97,99,105,1,6,105,1,6,168,200,254,230,254,229,254,181,52,45,41,54,
+54,41,45,52,2,248,2,2,99,91,90,101,101,90,253,77,3,93,252,163,5,155,249,102,
+3,159,252,97,3,178,42,51,51,42,44,50,50,0,2,0,45,255,238,4,127,4,123,0,11,
+0,69,0,0,55,20,22,51,50,54,53,52,38,35,34,6,19,30,3,23,21,14,3,21,21,20,6,
+35,34,38,53,52,54,51,50,22,23,53,52,62,2,55,46,3,35,62,3,51,50,30,2,21,17,
+35,17,52,46,2,35,34,14,2,153,53,44,41,54,54,41,44,53,208,48,96,83,64,18,58,
+82,52,25,106,99,97,106,102,93,12,28,5,24,52,84,60,31,90,92,81,21,4,60,117,
+175,118,134,186,116,51,168,38,78,120,83,79,108,69,38,172,44,51,51,44,42,50,
+50,2,85,6,28,36,41,18,57,12,36,55,78,53,219,90,100,100,90,91,99,2,2,35,53,
+84,63,43,13,21,30,20,9,92,154,111,61,67,120,166,98,253,72,2,172,76,121,85,
+45,35,57,72,0,3,0,75,255,238,4,17,4,113,0,11,0,51,0,61,0,0,19,20,22,51,50,
+54,53,52,38,35,34,6,37,17,35,46,3,39,21,20,6,35,34,38,53,52,62,2,55,17,6,
+6,35,34,38,53,52,54,51,50,22,21,17,30,3,23,17,1,20,22,51,50,54,53,53,6,6,
+212,52,45,41,54,54,41,45,52,3,61,168,30,84,95,103,50,103,117,108,108,31,66,
+101,70,5,31,13,89,101,106,97,99,105,51,101,95,83,32,253,87,41,32,38,40,74,
+77,3,178,42,51,51,42,44,50,50,136,251,154,50,92,75,52,10,68,114,115,100,90,
+42,74,58,40,8,1,110,2,2,99,91,90,101,101,90,253,210,7,32,48,64,40,3,161,252,
+70,43,43,47,45,113,11,61,0,0,2,0,163,0,0,4,114,4,113,0,49,0,61,0,0,37,33,
+50,54,53,17,51,17,20,14,2,35,33,17,52,62,2,55,46,3,53,53,52,54,51,50,22,21,
+20,6,35,34,38,39,21,20,30,2,23,21,14,3,21,19,52,38,35,34,6,21,20,22,51,50,
+54,1,75,1,140,125,118,168,44,87,130,86,253,140,33,55,70,37,37,70,55,33,106,
+99,97,106,101,90,12,32,5,37,59,73,36,36,73,59,37,132,53,44,41,54,54,41,44,
+53,135,118,136,2,225,252,252,79,131,93,51,1,55,47,73,53,34,7,7,37,57,77,47,
+196,90,101,101,90,91,99,2,2,21,43,59,37,20,4,101,4,22,40,59,41,2,125,44,50,
+50,44,42,51,51,0,0,2,0,75,255,238,3,221,4,103,0,11,0,48,0,0,37,20,22,51,50,
+54,53,52,38,35,34,6,55,52,38,35,33,52,62,2,51,33,21,33,34,14,2,21,51,50,30,
+2,21,17,20,6,35,34,38,53,52,54,51,50,22,23,2,49,53,44,41,54,54,41,44,53,132,
+126,135,254,155,38,89,147,110,2,18,253,223,43,74,52,30,221,107,150,94,44,
+106,98,97,107,101,89,13,32,5,172,44,51,51,44,42,50,50,236,119,125,128,167,
+99,39,133,21,41,63,42,41,93,149,107,254,247,90,100,100,90,91,100,2,2,0,0,
+2,0,133,253,248,4,131,4,123,0,11,0,69,0,0,37,52,38,35,34,6,21,20,22,51,50,
+54,1,62,3,51,50,30,2,21,17,35,17,52,46,2,35,34,14,2,7,30,3,23,21,14,3,21,
+21,54,54,51,50,22,21,20,6,35,34,38,53,53,52,62,2,55,46,3,1,210,53,44,42,53,
+53,42,44,53,254,179,4,70,130,189,123,140,193,120,53,168,40,83,127,88,84,120,
+83,47,10,40,76,65,50,15,57,83,52,25,5,32,12,90,100,105,97,99,106,24,53,84,
+60,25,73,75,65,172,42,50,50,42,44,51,51,2,89,92,154,111,61,67,120,166,98,
+251,64,4,180,76,121,85,45,35,57,72,36,6,28,36,41,18,57,12,36,55,78,53,33,
+2,2,99,91,90,100,100,90,221,53,84,63,43,13,21,30,20,9,0,0,2,0,110,255,238,
+4,96,4,123,0,11,0,65,0,0,37,52,38,35,34,6,21,20,22,51,50,54,5,35,46,3,35,
+34,14,2,21,21,54,54,51,50,22,21,20,6,35,34,38,53,53,52,62,2,51,50,30,2,23,
+17,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,1,187,53,44,42,53,53,42,44,53,
+2,165,160,37,101,119,134,71,41,69,49,28,5,32,12,90,100,105,97,99,106,37,78,
+121,84,92,156,124,91,26,51,92,130,78,126,200,87,78,92,240,158,127,194,132,
+67,172,42,50,50,42,44,51,51,128,111,195,145,84,18,36,54,36,33,2,2,99,91,90,
+100,100,90,221,61,102,75,42,70,112,142,72,1,132,87,129,86,42,66,58,123,64,
+75,64,121,175,111,0,2,0,45,253,248,4,127,4,123,0,11,0,67,0,0,55,20,22,51,
+50,54,53,52,38,35,34,6,19,30,3,23,21,14,3,21,21,20,6,35,34,38,53,52,54,51,
+50,22,23,53,52,62,2,55,46,3,35,62,3,51,50,30,2,21,17,35,17,52,38,35,34,14,
+2,153,53,44,41,54,54,41,44,53,218,48,92,79,62,18,58,82,52,25,106,99,97,106,
+102,93,12,28,5,18,45,77,60,31,84,85,74,21,4,60,116,175,118,135,186,115,52,
+168,153,167,79,104,66,34,172,44,51,51,44,42,50,50,2,85,6,28,36,41,18,57,12,
+36,55,78,53,219,90,100,100,90,91,99,2,2,35,53,84,63,43,13,21,30,20,9,92,154,
+111,61,67,120,166,98,251,64,4,180,152,165,32,54,68,0,0,2,0,0,255,238,3,62,
+4,123,0,11,0,42,0,0,37,20,22,51,50,54,53,52,38,35,34,6,7,52,54,51,50,22,23,
+17,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,17,20,6,35,34,38,2,18,53,44,41,
+54,54,41,44,53,108,101,89,13,32,5,30,61,93,63,86,171,78,80,85,204,125,100,
+155,106,55,106,99,97,106,172,44,51,51,44,42,50,50,42,91,100,2,2,1,104,63,
+106,78,43,62,56,117,62,77,58,108,154,96,253,209,90,100,100,0,0,3,0,113,0,
+0,5,104,4,183,0,51,0,75,0,87,0,0,1,22,22,21,17,35,17,52,38,39,6,7,22,21,20,
+6,35,34,38,39,14,3,7,21,21,35,53,52,46,4,53,52,62,2,51,50,22,23,54,54,55,
+51,14,3,7,38,38,35,34,14,2,21,20,30,2,23,62,3,51,50,22,23,54,54,3,52,38,35,
+34,6,21,20,22,51,50,54,4,101,14,16,168,5,5,75,99,49,104,99,45,75,19,10,47,
+49,38,1,168,12,19,22,19,12,72,136,195,123,153,204,61,25,73,41,188,29,68,70,
+66,213,41,149,109,84,133,93,50,10,17,20,9,24,58,75,95,62,12,22,11,78,121,
+149,53,44,41,54,54,41,44,53,3,109,37,96,48,253,72,2,172,25,46,22,36,36,51,
+85,91,99,34,23,11,57,93,129,81,24,41,119,81,125,102,84,82,85,51,94,154,110,
+60,79,70,23,98,88,63,107,84,60,17,65,70,39,72,103,64,47,87,89,92,51,83,144,
+106,60,2,2,32,58,254,235,45,49,49,45,42,51,51,0,0,3,0,45,0,0,5,112,4,113,
+0,54,0,66,0,78,0,0,1,34,46,2,53,52,54,51,50,22,21,20,6,7,54,55,17,51,17,54,
+55,51,6,6,7,21,20,14,2,35,33,53,51,17,6,6,35,34,38,53,52,54,51,50,22,21,17,
+33,50,54,53,53,6,1,20,22,51,50,54,53,52,38,35,34,6,1,20,22,51,50,54,53,52,
+38,35,34,6,3,5,66,94,60,28,101,86,88,97,29,15,60,60,168,63,31,157,40,127,
+84,44,87,130,86,253,85,173,5,31,13,89,101,106,97,99,105,1,22,125,118,94,253,
+42,52,45,41,54,54,41,45,52,1,225,43,35,33,43,43,33,35,43,1,139,30,53,74,44,
+80,92,89,72,42,51,13,13,31,2,69,254,66,78,105,108,175,63,163,79,131,93,51,
+135,2,113,2,2,99,91,90,101,101,90,252,213,118,136,39,33,2,39,42,51,51,42,
+44,50,50,254,117,34,41,41,34,35,41,41,0,0,3,0,110,255,238,4,200,4,183,0,60,
+0,72,0,84,0,0,33,35,46,3,35,34,14,2,21,21,54,54,51,50,22,21,20,6,35,34,38,
+53,53,52,62,2,51,50,22,23,54,54,55,38,38,35,34,6,7,39,54,54,51,50,22,23,54,
+53,53,51,21,20,6,7,22,22,21,5,30,3,23,17,52,38,39,6,6,1,52,38,35,34,6,21,
+20,22,51,50,54,4,96,160,37,101,119,134,71,41,69,49,28,5,32,12,90,100,105,
+97,99,106,37,78,121,84,20,39,19,129,183,60,42,161,109,126,200,87,78,92,240,
+158,147,212,65,32,168,55,71,11,11,254,69,50,84,70,53,18,2,2,54,135,254,196,
+53,44,42,53,53,42,44,53,111,195,145,84,18,36,54,36,33,2,2,99,91,90,100,100,
+90,221,61,102,75,42,4,3,45,86,48,83,81,66,58,123,64,75,84,80,71,98,55,43,
+93,160,71,37,82,45,60,28,76,89,97,49,1,132,17,32,16,31,56,254,41,42,50,50,
+42,44,51,51,0,3,0,45,0,0,4,123,4,113,0,11,0,65,0,79,0,0,19,20,22,51,50,54,
+53,52,38,35,34,6,1,35,17,52,38,39,14,3,7,35,17,6,6,35,34,38,53,52,54,51,50,
+22,21,17,62,3,55,46,3,53,52,62,2,51,50,30,2,21,20,6,7,30,3,21,3,52,38,35,
+34,6,21,20,30,2,23,54,54,153,52,45,41,54,54,41,45,52,3,225,168,25,17,72,143,
+128,106,35,168,5,31,13,89,101,106,97,99,105,31,93,109,117,54,23,43,33,20,
+29,53,75,46,45,76,55,31,57,47,33,41,22,7,129,41,36,38,38,14,24,31,16,26,42,
+3,178,42,51,51,42,44,50,50,252,34,1,245,72,96,14,62,141,167,196,117,2,248,
+2,2,99,91,90,101,101,90,253,130,62,127,117,104,39,17,41,49,56,32,45,69,47,
+24,23,46,68,45,57,86,38,30,61,67,74,42,1,196,39,43,44,36,18,33,28,23,9,18,
+52,0,3,0,45,0,0,6,21,5,160,0,45,0,57,0,69,0,0,33,17,6,6,35,34,38,53,52,54,
+51,50,22,21,17,1,51,1,17,38,38,53,52,54,51,50,22,21,20,6,7,62,3,55,51,14,
+3,7,17,35,9,2,20,22,51,50,54,53,52,38,35,34,6,1,20,22,51,50,54,53,52,38,35,
+34,6,1,28,5,31,13,89,101,106,97,99,105,1,6,105,1,6,100,105,101,86,88,97,29,
+15,41,66,51,37,11,147,15,52,75,101,65,200,254,230,254,229,254,181,52,45,41,
+54,54,41,45,52,3,64,43,35,33,43,43,33,35,43,2,248,2,2,99,91,90,101,101,90,
+253,77,3,93,252,163,3,47,13,107,78,80,92,89,72,42,51,13,17,43,60,79,52,67,
+114,88,62,14,251,201,3,159,252,97,3,178,42,51,51,42,44,50,50,1,21,34,41,41,
+34,35,41,41,0,0,2,0,115,0,0,4,21,4,123,0,11,0,62,0,0,1,52,38,35,34,6,21,20,
+22,51,50,54,5,20,14,2,35,33,34,46,2,53,17,52,54,51,50,22,21,20,6,35,34,38,
+39,21,20,22,51,33,50,54,53,17,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,1,
+208,53,44,42,53,53,42,44,53,2,69,27,62,100,73,254,155,73,100,62,27,106,99,
+97,105,100,90,12,32,5,44,42,1,117,42,44,40,79,118,78,93,189,87,78,91,218,
+138,113,179,125,66,2,46,44,50,50,44,42,51,51,244,68,102,68,34,34,68,102,68,
+1,30,90,100,100,90,91,99,2,2,114,69,54,54,69,1,205,63,106,77,43,66,58,124,
+61,78,59,109,153,95,0,0,3,0,125,0,0,4,106,4,183,0,57,0,71,0,83,0,0,1,20,14,
+2,35,33,34,46,2,53,53,52,54,51,50,22,21,20,6,35,34,38,39,21,20,22,51,33,50,
+54,53,17,52,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,55,51,6,6,7,22,22,
+21,37,34,14,2,21,20,30,2,51,50,55,38,1,52,38,35,34,6,21,20,22,51,50,54,4,
+2,27,62,100,73,254,155,73,100,62,27,106,99,97,105,100,90,12,32,5,44,42,1,
+117,42,44,1,1,61,152,95,214,209,198,215,122,190,64,35,13,168,20,61,47,11,
+13,254,24,67,91,56,25,25,59,96,72,165,100,73,254,214,53,44,42,53,53,42,44,
+53,1,16,68,102,68,34,34,68,102,68,193,90,100,100,90,91,99,2,2,21,69,54,54,
+69,2,6,8,13,7,33,37,98,103,104,108,48,52,69,91,79,142,59,30,69,40,247,16,
+27,35,20,21,32,22,12,77,108,253,198,44,50,50,44,42,51,51,0,0,2,0,37,0,0,3,
+155,4,102,0,23,0,35,0,0,33,17,6,6,35,34,46,2,53,52,54,51,50,22,21,20,6,7,
+54,54,55,51,17,1,20,22,51,50,54,53,52,38,35,34,6,2,243,82,226,142,66,100,
+67,35,101,86,88,97,29,15,143,203,44,168,252,247,43,35,33,43,43,33,35,43,3,
+82,94,105,32,56,76,44,80,92,89,72,42,61,13,30,191,151,251,154,3,90,34,41,
+41,34,35,41,41,0,0,4,0,77,0,101,3,176,4,46,0,22,0,34,0,57,0,69,0,0,1,34,46,
+2,53,52,54,51,50,22,21,20,6,7,54,54,55,51,14,3,37,20,22,51,50,54,53,52,38,
+35,34,6,19,34,46,2,53,52,54,51,50,22,21,20,6,7,54,54,55,51,14,3,37,20,22,
+51,50,54,53,52,38,35,34,6,1,89,66,100,67,35,101,86,88,97,29,15,143,193,44,
+159,31,109,152,193,254,239,43,35,33,43,43,33,35,43,159,66,100,67,35,101,86,
+88,97,29,15,143,193,44,159,31,109,152,193,254,239,43,35,33,43,43,33,35,43,
+2,83,32,56,76,44,80,92,89,72,42,61,13,30,191,151,104,174,126,71,207,34,41,
+41,34,35,41,41,253,32,32,56,76,44,80,92,89,72,42,61,13,30,191,151,104,174,
+126,71,207,34,41,41,34,35,41,41,0,0,2,253,119,4,199,0,32,6,60,0,24,0,36,0,
+0,1,34,46,2,53,52,54,51,50,22,21,20,6,7,62,3,55,51,14,3,39,20,22,51,50,54,
+53,52,38,35,34,6,254,122,62,97,66,34,101,86,88,97,29,15,40,67,51,37,11,147,
+18,67,103,141,243,43,35,33,43,43,33,35,43,4,199,30,53,74,44,80,92,89,72,42,
+51,13,17,43,60,79,52,80,132,94,51,200,34,41,41,34,35,41,41,0,0,1,0,0,0,0,
+3,62,4,123,0,19,0,0,33,35,17,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,3,62,
+168,30,61,93,63,86,174,78,77,85,204,125,100,155,106,55,2,217,63,103,74,40,
+68,56,123,62,77,58,108,154,96,0,255,255,254,51,0,0,3,62,6,38,2,34,0,55,0,
+0,0,2,0,78,0,0,0,2,251,230,4,182,255,72,6,86,0,14,0,25,0,0,3,46,3,35,62,3,
+51,50,30,2,37,34,6,7,50,4,23,46,3,184,111,208,209,217,121,16,68,100,129,78,
+86,153,124,90,254,56,94,120,29,161,1,48,128,21,69,91,109,4,182,23,36,25,13,
+72,118,83,46,50,102,157,209,61,66,45,30,46,74,53,29,0,0,2,251,230,4,182,255,
+72,6,156,0,18,0,29,0,0,3,46,3,35,62,3,51,50,22,23,53,51,17,22,22,1,34,6,7,
+50,4,23,46,3,184,111,208,209,217,121,16,68,100,129,78,97,167,66,110,11,17,
+254,41,94,120,29,161,1,48,128,21,69,91,109,4,182,23,36,25,13,72,118,83,46,
+62,65,197,254,144,27,59,1,28,61,66,45,30,46,74,53,29,0,0,3,251,230,4,182,
+255,170,6,141,0,28,0,39,0,51,0,0,3,46,3,35,62,3,51,50,22,23,54,54,51,50,30,
+2,21,20,14,2,7,22,22,1,34,6,7,50,4,23,46,3,5,20,22,51,50,54,53,52,38,35,34,
+6,184,111,208,209,217,121,16,68,100,129,78,68,124,54,17,86,57,34,61,46,26,
+22,37,52,30,14,21,254,42,94,120,29,161,1,48,128,21,69,91,109,1,20,44,31,29,
+43,43,29,31,44,4,182,23,36,25,13,72,118,83,46,30,32,51,66,26,46,61,35,31,
+56,45,29,5,31,68,1,22,61,66,45,30,46,74,53,29,13,30,42,42,30,31,44,44,0,0,
+2,251,230,4,182,255,72,6,156,0,22,0,33,0,0,3,46,3,35,62,3,51,50,23,53,51,
+21,22,23,53,51,17,22,22,1,34,6,7,50,4,23,46,3,184,111,208,209,217,121,16,
+68,100,129,78,62,61,110,56,45,110,10,15,254,40,94,120,29,161,1,48,128,21,
+69,91,109,4,182,23,36,25,13,72,118,83,46,14,84,125,30,47,202,254,133,25,53,
+1,31,61,66,45,30,46,74,53,29,0,2,254,69,253,248,255,76,255,154,0,13,0,24,
+0,0,1,53,6,35,34,38,53,52,54,51,50,22,21,17,3,20,22,51,50,54,53,52,38,35,
+34,254,205,8,14,58,56,59,69,63,72,188,24,23,20,25,25,20,47,253,248,194,4,
+59,54,54,61,61,56,254,211,1,47,21,24,24,21,23,24,0,0,2,253,21,253,244,255,
+76,255,154,0,17,0,28,0,0,1,53,6,35,34,38,53,52,54,51,50,22,21,21,51,17,51,
+17,1,20,22,51,50,54,53,52,38,35,34,253,157,8,14,58,56,59,69,63,72,177,127,
+254,20,24,23,20,25,25,20,47,253,244,198,4,59,54,54,61,61,56,174,1,20,254,
+105,1,51,21,24,24,21,23,24,0,0,1,254,137,254,185,255,91,255,139,0,19,0,0,
+5,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,254,137,16,29,38,22,22,38,28,17,
+17,28,38,22,22,38,29,16,222,22,38,28,17,17,28,38,22,22,38,29,16,16,29,38,
+0,5,0,145,255,88,4,21,6,63,0,29,0,40,0,44,0,48,0,55,0,0,1,21,30,3,21,20,14,
+2,7,21,30,3,21,20,14,2,7,21,35,53,33,17,33,53,1,52,46,2,39,17,62,3,5,51,17,
+35,53,51,17,35,5,52,38,39,17,54,54,2,116,95,141,93,47,39,74,109,69,69,121,
+90,52,56,106,156,99,140,254,169,1,87,1,115,24,54,88,65,64,88,55,24,253,230,
+167,167,167,167,1,247,95,101,108,88,6,63,143,9,50,88,129,88,62,108,82,55,
+9,10,12,45,79,120,86,94,151,108,64,6,169,168,5,182,137,251,113,48,84,64,45,
+9,253,246,9,47,70,92,223,2,21,152,1,210,227,95,105,18,254,62,18,117,0,2,0,
+184,255,238,2,79,4,101,0,14,0,26,0,0,1,17,54,54,51,50,22,21,20,6,35,34,38,
+53,17,1,52,38,35,34,6,21,20,22,51,50,54,1,96,5,31,13,89,101,106,97,99,105,
+1,43,52,45,41,54,54,41,45,52,4,101,253,2,2,2,99,91,90,101,101,90,3,184,252,
+72,42,50,50,42,44,51,51,0,255,255,0,184,255,238,4,105,4,101,0,34,0,65,0,0,
+0,3,0,65,2,26,0,0,0,2,0,24,255,238,3,136,7,251,0,11,0,48,0,0,37,52,38,35,
+34,6,21,20,22,51,50,54,1,52,38,35,35,52,62,2,51,33,21,33,34,14,2,21,51,50,
+30,2,21,17,54,54,51,50,22,21,20,6,35,34,38,53,2,218,52,45,41,54,54,41,45,
+52,254,213,126,135,146,41,93,150,110,1,230,254,11,43,77,56,33,10,107,150,
+94,44,5,31,13,89,101,106,97,99,105,173,42,50,50,42,44,51,51,4,213,119,125,
+128,167,99,39,133,21,41,63,42,41,93,149,107,252,30,2,2,99,91,90,101,101,90,
+0,3,0,34,255,238,3,116,8,17,0,11,0,73,0,85,0,0,1,52,38,35,34,6,21,20,22,51,
+50,54,1,20,6,35,34,38,53,17,52,62,2,55,52,46,2,35,34,14,2,21,54,54,51,50,
+30,2,21,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,21,14,3,21,17,54,54,51,50,
+22,7,52,38,35,34,6,21,20,22,51,50,54,1,76,44,35,33,43,43,33,35,44,2,40,106,
+97,99,105,19,41,65,47,17,49,88,72,67,100,66,33,19,63,37,32,59,45,26,28,48,
+67,39,57,84,54,27,43,94,148,104,104,152,100,48,51,70,43,18,5,31,13,89,101,
+108,52,45,41,54,54,41,45,52,6,91,34,40,40,34,35,42,42,250,117,90,101,101,
+90,4,247,59,93,78,65,31,26,62,54,36,32,55,75,43,23,31,20,42,64,44,42,63,43,
+22,40,72,100,60,68,122,92,54,47,80,108,62,40,72,75,84,53,251,195,2,2,99,91,
+42,50,50,42,44,51,51,0,0,2,0,35,255,238,3,192,8,17,0,35,0,47,0,0,19,55,62,
+3,51,50,22,21,17,54,54,51,50,22,21,20,6,35,34,38,53,17,52,38,35,34,14,2,7,
+3,35,3,51,1,52,38,35,34,6,21,20,22,51,50,54,243,61,30,55,58,67,43,76,88,5,
+31,13,89,101,106,97,99,105,15,17,8,17,21,26,17,177,123,97,155,2,150,52,45,
+41,54,54,41,45,52,6,153,130,65,93,60,28,111,128,250,69,2,2,99,91,90,101,101,
+90,6,124,55,43,7,24,44,37,254,154,2,92,248,156,42,50,50,42,44,51,51,0,1,0,
+0,253,248,3,62,4,123,0,19,0,0,1,35,17,52,46,2,35,34,6,7,39,54,54,51,50,30,
+2,21,3,62,168,30,61,93,63,86,174,78,77,85,204,125,100,155,106,55,253,248,
+4,225,63,103,74,40,68,56,123,62,77,58,108,154,96,0,0,2,0,57,253,248,3,82,
+4,117,0,11,0,56,0,0,1,52,38,35,34,6,21,20,22,51,50,54,37,52,46,2,39,7,39,
+14,3,21,54,54,51,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,55,23,55,30,3,21,
+17,35,1,99,44,35,33,43,43,33,35,44,1,71,7,21,41,35,144,145,37,43,23,6,19,
+63,37,32,59,45,26,28,48,67,39,57,84,54,27,27,59,92,64,135,135,79,108,66,28,
+168,2,197,34,40,40,34,35,42,42,157,21,53,51,41,8,127,129,9,43,54,55,21,23,
+31,20,42,64,44,42,63,43,22,42,72,98,56,57,109,91,65,12,123,123,10,60,85,103,
+54,250,187,0,2,252,163,4,197,255,144,6,159,0,57,0,69,0,0,3,34,38,53,52,54,
+51,50,21,20,14,2,35,34,46,2,39,6,6,7,46,3,53,52,54,51,33,50,62,2,55,21,6,
+6,35,33,34,14,2,21,20,23,54,54,55,30,3,51,50,54,39,20,22,51,50,54,53,52,38,
+35,34,6,230,49,47,46,48,109,19,39,61,41,44,75,63,51,20,23,54,26,50,82,58,
+32,129,109,1,18,37,71,63,51,15,32,102,61,254,197,33,45,27,12,73,25,51,24,
+39,74,69,63,29,26,31,30,21,18,16,21,21,16,18,21,5,62,57,36,35,54,123,32,65,
+51,32,33,44,42,9,34,66,28,6,35,58,81,52,105,103,4,9,13,8,99,20,13,19,30,40,
+21,96,23,19,72,40,10,48,50,37,16,97,17,20,20,17,18,21,21,0,1,254,178,4,197,
+255,56,6,47,0,3,0,0,1,51,17,35,254,178,134,134,6,47,254,150,0,2,253,34,4,
+197,255,169,6,125,0,36,0,48,0,0,1,20,6,7,62,3,53,51,20,14,2,35,35,53,62,3,
+53,6,6,35,34,46,2,53,52,54,51,50,30,2,39,20,22,51,50,54,53,52,38,35,34,6,
+254,71,57,51,105,131,73,25,128,27,93,181,154,111,19,43,37,24,14,45,28,24,
+42,32,19,75,57,42,61,39,19,212,31,21,21,30,30,21,21,31,5,223,62,93,31,1,38,
+83,130,92,111,166,109,54,98,13,33,36,36,16,18,22,15,30,46,32,61,64,25,43,
+58,3,22,29,29,22,22,30,30,0,0,2,252,136,4,197,255,169,6,125,0,58,0,70,0,0,
+1,20,6,7,62,3,53,51,20,14,2,35,62,3,53,52,46,2,39,7,39,14,3,21,54,54,51,50,
+30,2,21,20,6,35,34,46,2,53,52,62,2,55,23,55,30,3,5,52,38,35,34,6,21,20,22,
+51,50,54,254,171,21,7,37,58,39,20,128,33,90,158,125,13,19,13,6,5,15,26,20,
+105,107,27,31,17,4,14,46,27,24,42,32,19,75,57,42,60,40,19,20,42,67,47,99,
+98,41,64,45,24,254,177,30,23,21,29,29,21,23,30,5,165,42,71,15,10,45,81,122,
+86,111,166,109,54,25,55,54,50,19,15,40,39,30,5,92,94,6,30,36,38,16,18,22,
+15,31,46,31,61,64,32,55,73,41,41,78,64,47,9,90,90,9,42,58,69,137,22,26,26,
+22,24,28,28,0,1,254,64,4,197,255,170,6,47,0,11,0,0,1,53,51,53,51,21,51,21,
+35,21,35,53,254,64,131,100,131,131,100,5,72,100,131,131,100,131,131,0,0,2,
+252,191,4,199,255,238,6,208,0,29,0,41,0,0,1,20,6,35,34,38,53,52,62,2,55,62,
+3,55,51,14,3,7,14,3,7,22,22,5,20,22,51,50,54,53,52,38,35,34,6,254,51,97,88,
+86,101,31,70,116,84,111,139,79,32,6,147,9,35,68,107,82,47,65,42,25,7,15,29,
+254,241,47,39,36,48,48,36,39,47,5,104,72,89,92,80,44,66,48,30,7,10,25,36,
+50,33,54,80,54,33,8,4,7,6,5,3,13,51,30,39,45,45,39,38,45,45,0,0,2,254,51,
+4,206,255,163,6,38,0,11,0,23,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,254,51,95,88,89,96,96,89,88,95,98,48,39,36,49,
+49,36,39,48,5,122,81,91,91,81,81,91,91,81,38,46,46,38,39,46,46,0,1,254,17,
+4,198,255,170,6,162,0,44,0,0,3,34,14,2,21,20,22,51,50,54,55,21,6,6,35,34,
+38,53,52,54,51,46,3,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,22,51,194,
+42,69,50,28,49,50,44,79,24,22,79,48,100,109,87,77,13,32,27,19,33,54,70,36,
+35,80,28,34,15,55,38,44,45,64,59,5,144,3,11,23,20,26,29,17,10,93,8,16,73,
+65,50,62,4,17,26,35,23,34,46,29,12,16,14,85,8,16,29,19,32,17,0,3,0,75,255,
+236,4,219,4,124,0,19,0,39,0,59,0,0,19,52,62,2,51,50,30,2,21,20,14,2,35,34,
+46,2,55,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,23,52,62,2,51,50,30,2,21,
+20,14,2,35,34,46,2,75,92,159,212,121,121,212,159,92,92,159,212,121,121,212,
+159,92,144,69,120,160,91,91,160,120,69,69,120,160,91,91,160,120,69,238,32,
+54,74,42,42,74,55,32,32,55,74,42,42,74,54,32,2,52,121,212,159,92,92,159,212,
+121,121,212,159,92,92,159,212,121,91,160,120,69,69,120,160,91,91,160,120,
+69,69,120,160,91,42,74,55,32,32,55,74,42,42,74,54,32,32,54,74,0,2,0,131,255,
+236,4,204,3,162,0,19,0,39,0,0,37,50,62,2,53,52,46,2,35,34,14,2,21,20,30,2,
+23,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,2,166,83,141,103,58,58,103,141,
+83,81,140,103,58,58,103,140,81,124,202,143,78,78,144,202,123,125,203,144,
+78,78,144,203,113,45,88,128,83,83,127,86,45,45,86,127,83,83,128,88,45,133,
+65,123,176,111,113,176,122,64,64,122,176,113,111,176,123,65,0,0,2,0,132,255,
+238,4,204,3,162,0,11,0,80,0,0,1,20,22,51,50,54,53,52,38,35,34,6,5,20,14,2,
+7,39,62,3,53,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,53,6,6,35,34,46,2,53,
+52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,2,57,44,35,
+33,43,43,33,35,44,2,147,29,49,65,36,101,24,44,33,20,63,107,141,78,79,140,
+106,62,43,69,90,46,47,75,52,29,19,63,37,32,59,45,26,28,48,67,39,57,90,62,
+33,44,87,130,85,90,150,108,61,77,142,202,126,122,202,145,80,1,164,34,40,40,
+34,35,42,42,54,74,122,99,79,32,106,23,62,77,87,46,93,149,104,56,51,97,140,
+90,78,118,79,41,30,54,73,43,23,31,21,42,64,43,42,63,43,22,40,72,100,60,68,
+122,92,54,60,115,166,105,108,184,134,76,78,140,194,0,0,2,0,159,0,0,4,189,
+4,144,0,11,0,80,0,0,1,52,38,35,34,6,21,20,22,51,50,54,1,51,17,20,30,2,51,
+33,50,62,2,53,53,52,46,2,39,7,39,14,3,21,54,54,51,50,30,2,21,20,14,2,35,34,
+46,2,53,52,62,2,55,23,55,30,3,21,17,20,14,2,35,33,34,46,2,53,2,246,44,35,
+33,43,43,33,35,44,253,169,168,17,45,80,62,1,54,62,80,45,17,5,15,24,20,144,
+145,37,43,23,6,19,63,37,32,59,45,26,28,48,67,39,57,87,58,30,30,63,95,64,135,
+135,79,95,51,16,31,72,117,86,254,70,86,117,72,31,1,243,34,40,40,34,35,42,
+42,2,192,252,245,67,97,61,29,29,61,97,67,232,21,53,51,41,8,127,129,9,43,54,
+55,21,23,31,20,42,64,44,42,63,43,22,42,72,98,56,57,109,91,65,12,123,123,10,
+60,85,103,54,254,247,79,131,93,51,51,93,131,79,0,2,0,127,255,235,4,209,3,
+162,0,11,0,86,0,0,37,52,38,35,34,6,21,20,22,51,50,54,1,20,14,2,7,39,62,3,
+53,52,46,2,35,34,14,2,21,21,35,53,52,46,2,35,34,14,2,21,20,22,23,52,62,2,
+51,50,30,2,21,20,6,35,34,46,2,53,52,62,2,51,50,30,2,23,62,3,51,50,30,2,2,
+122,44,35,33,43,43,33,35,44,2,87,29,50,65,36,101,24,44,33,19,22,40,56,34,
+41,59,38,18,168,18,38,59,41,34,56,40,22,46,42,32,51,65,32,36,66,51,31,102,
+105,78,147,113,68,40,74,106,67,64,92,63,37,10,10,38,63,91,64,67,106,74,40,
+149,34,40,40,34,35,42,42,1,91,86,144,116,88,32,106,23,84,103,109,46,91,127,
+79,36,56,94,121,65,35,35,65,121,94,56,36,79,127,91,116,159,41,44,63,42,20,
+20,42,64,44,79,91,53,116,183,130,129,178,112,50,44,77,102,59,59,102,77,44,
+50,112,178,0,0,2,0,128,0,0,4,204,4,144,0,59,0,71,0,0,33,33,34,46,2,53,52,
+62,2,55,62,3,53,51,20,14,2,7,14,3,21,20,30,2,51,51,38,38,53,52,62,2,51,50,
+30,2,21,20,14,2,35,34,38,39,30,3,23,3,52,38,35,34,6,21,20,22,51,50,54,4,175,
+253,124,113,162,103,49,64,131,199,135,111,152,94,41,173,61,119,174,114,122,
+175,112,53,34,75,120,85,240,100,98,29,56,83,54,39,67,48,28,26,45,59,32,37,
+63,19,13,79,114,141,75,247,44,35,33,43,43,33,35,44,59,103,140,81,104,159,
+120,85,30,25,67,76,81,38,65,119,102,82,27,29,68,91,123,84,53,89,65,36,48,
+150,88,48,82,61,35,22,43,63,42,43,64,42,21,31,23,40,75,62,42,7,1,86,35,42,
+42,35,34,40,40,0,0,3,0,128,0,0,4,204,4,144,0,75,0,87,0,99,0,0,33,33,34,46,
+2,53,52,62,2,55,38,38,53,52,62,2,51,50,30,2,21,20,20,7,62,3,53,51,20,14,2,
+7,14,3,21,20,30,2,51,51,38,38,53,52,62,2,51,50,30,2,21,20,14,2,35,34,38,39,
+30,3,23,3,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,
+54,4,175,253,124,113,162,103,49,42,84,128,87,19,21,28,49,68,40,39,67,48,28,
+1,70,99,62,29,173,61,119,174,114,122,175,112,53,34,75,120,85,240,100,98,29,
+56,83,54,39,67,48,28,26,45,59,32,37,63,19,13,79,114,141,75,247,44,35,33,43,
+43,33,35,44,254,250,44,35,33,43,43,33,35,44,59,103,140,81,83,136,108,85,32,
+21,58,37,44,64,42,20,22,43,63,42,6,12,5,26,60,64,67,31,65,119,102,82,27,29,
+68,91,123,84,53,89,65,36,48,150,88,48,82,61,35,22,43,63,42,43,64,42,21,31,
+23,40,75,62,42,7,1,86,35,42,42,35,34,40,40,1,241,35,42,42,35,34,40,40,0,0,
+2,0,109,255,238,4,166,4,142,0,11,0,82,0,0,1,52,38,35,34,6,21,20,22,51,50,
+54,1,30,3,23,62,3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,
+21,20,14,2,35,34,38,39,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,7,46,5,39,
+2,121,44,35,33,43,43,33,35,44,254,180,13,28,26,21,5,19,61,80,95,53,104,178,
+131,75,64,119,167,102,98,157,109,59,33,62,90,57,39,67,48,28,26,45,59,32,37,
+63,19,42,74,99,58,67,110,78,43,61,100,127,67,57,104,88,70,25,10,32,38,43,
+42,40,16,1,164,35,42,42,35,34,40,40,3,12,30,96,102,93,28,11,29,26,17,66,123,
+175,108,108,166,113,59,50,90,127,77,60,98,69,37,22,43,63,42,43,64,42,21,31,
+23,43,73,54,30,44,81,118,73,90,131,85,42,22,35,42,21,30,84,97,102,95,82,28,
+0,0,2,0,83,255,235,4,249,4,144,0,11,0,87,0,0,37,52,38,35,34,6,21,20,22,51,
+50,54,3,52,46,2,35,34,14,2,21,20,30,2,23,54,54,51,50,30,2,21,20,6,35,34,46,
+2,53,52,62,2,51,50,30,2,23,62,3,51,50,30,2,21,17,50,54,53,17,51,17,20,14,
+2,35,35,17,52,46,2,35,34,14,2,21,2,1,44,35,33,43,43,33,35,44,67,8,22,36,29,
+34,42,23,8,3,8,11,7,23,86,53,36,66,51,31,100,97,78,126,88,47,26,57,92,67,
+56,73,44,22,6,6,27,50,77,56,67,87,52,21,71,72,161,29,69,115,86,166,8,21,35,
+28,33,42,25,10,149,34,40,40,34,35,42,42,1,171,53,93,71,41,36,79,127,91,60,
+81,53,32,11,46,44,20,42,64,44,79,91,53,116,183,130,129,178,112,50,34,60,82,
+47,47,82,60,34,50,112,178,129,254,186,119,135,3,11,252,210,79,131,93,51,1,
+210,91,127,79,36,41,71,93,53,0,2,0,108,255,242,4,235,4,144,0,78,0,90,0,0,
+1,30,3,51,50,54,55,6,6,35,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,35,34,
+46,4,39,14,3,7,34,46,2,53,52,62,2,55,62,3,53,51,20,14,2,7,14,3,21,20,30,2,
+23,62,3,37,52,38,35,34,6,21,20,22,51,50,54,2,54,67,119,108,101,48,49,67,9,
+19,63,37,32,59,45,26,28,48,67,39,54,84,57,29,35,64,90,54,38,71,65,59,53,48,
+21,6,18,20,22,9,132,183,113,50,64,131,199,135,111,152,94,41,173,61,119,174,
+114,122,175,112,53,36,62,83,47,12,20,15,10,2,39,44,35,33,43,43,33,35,44,1,
+107,15,75,79,60,78,71,23,31,21,42,64,43,42,63,43,22,37,65,88,51,81,126,86,
+45,24,38,46,42,34,7,26,56,53,45,15,63,109,144,81,104,159,120,85,30,25,67,
+76,81,38,65,119,102,82,27,29,68,91,123,84,53,87,62,36,2,19,52,60,64,66,34,
+40,40,34,35,42,42,0,2,0,122,255,235,5,8,4,144,0,73,0,85,0,0,1,62,3,53,51,
+20,14,2,7,46,3,39,6,6,7,22,22,23,1,35,3,46,3,35,34,14,2,21,20,22,23,52,62,
+2,51,50,30,2,21,20,6,35,34,46,2,53,52,62,2,51,50,22,23,62,3,55,30,3,1,52,
+38,35,34,6,21,20,22,51,50,54,3,232,25,42,31,17,173,44,79,110,65,11,41,48,
+49,19,14,34,18,20,33,17,1,23,188,192,37,66,65,68,38,40,63,43,22,36,42,32,
+51,65,32,36,66,51,31,108,121,70,135,105,64,50,87,119,69,75,112,44,16,35,32,
+27,7,35,64,53,41,254,143,44,35,33,43,43,33,35,44,3,38,27,66,87,111,71,98,
+165,135,106,40,18,51,52,46,12,20,39,16,32,69,34,253,175,1,178,84,135,95,51,
+36,79,127,91,116,159,41,44,63,42,20,20,42,64,44,79,91,53,116,183,130,129,
+178,112,50,53,45,12,30,35,38,20,15,41,45,43,253,94,34,40,40,34,35,42,42,0,
+0,3,0,37,0,0,5,5,4,102,0,23,0,27,0,39,0,0,33,17,6,6,35,34,46,2,53,52,54,51,
+50,22,21,20,6,7,54,54,55,51,17,51,17,51,17,1,20,22,51,50,54,53,52,38,35,34,
+6,2,243,82,226,142,66,100,67,35,101,86,88,97,29,15,143,203,44,168,194,168,
+251,141,43,35,33,43,43,33,35,43,3,82,94,105,32,56,76,44,80,92,89,72,42,61,
+13,30,191,151,251,154,4,102,251,154,3,90,34,41,41,34,35,41,41,0,0,2,0,76,
+255,242,7,7,3,131,0,74,0,86,0,0,1,21,7,7,35,3,3,35,3,14,5,35,34,46,2,53,52,
+62,2,51,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,51,50,22,23,52,46,2,35,34,
+14,2,21,20,30,2,51,50,62,2,55,51,19,19,51,19,55,5,20,22,51,50,54,53,52,38,
+35,34,6,7,7,238,113,16,124,148,18,141,16,44,59,76,97,119,73,111,166,109,55,
+47,94,140,93,71,112,77,41,27,54,84,57,39,67,48,28,26,45,59,32,37,63,19,20,
+42,67,47,61,90,57,28,35,73,113,77,87,135,110,88,40,23,158,141,21,129,95,251,
+192,44,35,33,43,43,33,35,44,2,3,57,47,220,1,11,254,165,1,92,52,111,106,93,
+70,41,69,121,167,98,94,167,124,73,47,85,117,71,61,104,75,42,22,43,63,42,44,
+64,42,20,31,23,35,66,51,30,51,88,119,68,69,117,85,48,71,149,230,160,254,116,
+1,70,254,233,183,97,35,42,42,35,34,40,40,0,0,1,254,170,6,240,255,48,8,90,
+0,3,0,0,1,51,17,35,254,170,134,134,8,90,254,150,0,2,253,67,6,239,255,179,
+8,167,0,36,0,47,0,0,1,20,14,2,7,62,3,53,51,20,14,2,35,35,53,62,3,53,6,6,35,
+34,38,53,52,54,51,50,30,2,39,20,22,51,50,54,53,52,38,35,34,254,95,22,32,35,
+13,98,116,62,18,148,29,91,172,143,111,19,37,30,18,20,45,28,41,48,57,68,42,
+61,38,18,205,23,20,18,23,23,18,43,8,7,29,56,49,38,12,1,38,83,130,92,111,166,
+109,54,98,13,35,39,41,19,16,17,61,52,53,62,26,44,58,13,19,22,22,19,20,23,
+0,2,252,156,6,239,255,179,8,167,0,58,0,70,0,0,1,20,6,7,62,3,53,51,20,14,2,
+35,62,3,53,52,46,2,39,7,39,14,3,21,54,54,51,50,30,2,21,20,6,35,34,46,2,53,
+52,62,2,55,23,55,30,3,5,52,38,35,34,6,21,20,22,51,50,54,254,161,21,7,37,58,
+39,20,148,39,98,164,125,13,19,13,6,5,15,26,20,90,92,27,31,17,4,14,46,27,24,
+42,32,19,75,57,42,60,40,19,20,42,67,47,84,83,44,65,44,21,254,207,30,23,21,
+29,29,21,23,30,7,207,42,71,15,10,45,81,122,86,111,166,109,54,25,55,54,50,
+19,20,42,37,28,5,75,77,6,30,38,39,16,18,22,15,31,46,31,61,64,32,55,73,41,
+41,78,64,47,9,70,70,10,42,58,69,136,22,26,26,22,24,28,28,0,1,254,56,6,239,
+255,162,8,89,0,11,0,0,1,53,51,53,51,21,51,21,35,21,35,53,254,56,131,100,131,
+131,100,7,114,100,131,131,100,131,131,0,0,2,252,214,6,228,0,5,8,237,0,29,
+0,41,0,0,1,20,6,35,34,38,53,52,62,2,55,62,3,55,51,14,3,7,14,3,7,22,22,5,20,
+22,51,50,54,53,52,38,35,34,6,254,74,97,88,86,101,31,70,116,84,111,139,79,
+32,6,147,9,35,68,107,82,47,65,42,25,7,15,29,254,241,47,39,36,48,48,36,39,
+47,7,133,72,89,92,80,44,66,48,30,7,10,25,36,50,33,54,80,54,33,8,4,7,6,5,3,
+13,51,30,39,45,45,39,38,45,45,0,0,16,0,102,0,90,4,91,4,78,0,7,0,15,0,23,0,
+31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,
+20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,23,20,
+35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,
+53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,
+51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,
+37,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,3,
+212,48,52,52,48,148,48,52,52,48,247,51,49,51,49,36,48,52,52,48,254,55,50,
+50,50,50,173,51,49,49,51,2,82,51,49,49,51,253,26,50,50,50,50,2,131,48,52,
+52,48,148,48,52,52,48,253,174,48,52,50,50,36,48,52,52,48,1,200,50,50,50,50,
+254,92,50,50,50,50,247,51,49,49,51,148,50,50,50,50,3,150,50,50,50,48,49,49,
+51,254,215,51,51,49,223,50,50,50,1,151,51,51,49,86,49,49,51,253,123,49,49,
+51,1,189,50,47,53,253,72,49,49,51,149,48,48,52,2,32,51,51,49,223,50,50,50,
+254,7,51,51,49,232,49,49,51,254,217,52,48,52,46,49,49,51,0,0,1,255,202,254,
+173,0,54,6,77,0,3,0,0,3,17,51,17,54,108,254,173,7,160,248,96,0,1,254,213,
+254,174,1,43,6,77,0,14,0,0,19,23,7,39,17,35,17,7,39,55,39,55,23,55,23,74,
+225,75,170,108,170,75,225,225,75,224,224,75,5,43,220,73,169,249,255,6,1,169,
+73,220,217,73,220,220,74,0,0,1,0,25,3,193,1,78,5,182,0,6,0,0,1,23,6,3,35,
+18,55,1,63,15,52,124,133,70,32,5,182,22,199,254,232,1,29,216,0,1,0,25,2,0,
+1,199,2,123,0,3,0,0,19,33,21,33,25,1,174,254,82,2,123,123,0,1,252,19,4,222,
+255,3,5,220,0,23,0,0,1,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,
+51,6,6,254,35,43,82,79,73,34,49,50,14,104,12,118,95,45,85,78,72,32,48,49,
+15,103,12,118,4,224,37,43,37,57,62,118,134,37,43,37,59,60,117,135,0,0,1,251,
+255,254,226,255,19,255,101,0,3,0,0,5,33,21,33,251,255,3,20,252,236,155,131,
+0,1,250,12,254,226,255,19,255,101,0,3,0,0,5,33,21,33,250,12,5,7,250,249,155,
+131,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,28,0,94,
+0,3,0,1,4,9,0,2,0,14,0,122,0,3,0,1,4,9,0,3,0,66,0,136,0,3,0,1,4,9,0,4,0,28,
+0,94,0,3,0,1,4,9,0,5,0,30,0,202,0,3,0,1,4,9,0,6,0,24,0,232,0,3,0,1,4,9,0,
+7,0,68,1,0,0,3,0,1,4,9,0,8,0,42,1,68,0,3,0,1,4,9,0,9,0,40,1,110,0,3,0,1,4,
+9,0,10,0,96,1,150,0,3,0,1,4,9,0,11,0,62,1,246,0,3,0,1,4,9,0,12,0,60,2,52,
+0,3,0,1,4,9,0,13,2,150,2,112,0,3,0,1,4,9,0,14,0,52,5,6,0,67,0,111,0,112,0,
+121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,49,0,32,0,71,0,111,
+0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,
+32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,
+118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,
+32,0,84,0,104,0,97,0,105,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,
+0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,
+32,0,84,0,104,0,97,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,
+49,0,46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,97,0,110,
+0,115,0,84,0,104,0,97,0,105,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,
+0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,
+0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,
+105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,
+97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,
+101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,
+98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,
+101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,
+0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,
+0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,
+0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,
+0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,
+79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,78,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,108,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,
+1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,
+1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,
+1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,
+1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,
+1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,
+1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,
+102,1,103,1,104,1,105,1,106,4,110,117,108,108,7,117,110,105,48,69,48,49,7,
+117,110,105,48,69,48,50,7,117,110,105,48,69,48,51,7,117,110,105,48,69,48,
+52,7,117,110,105,48,69,48,53,7,117,110,105,48,69,48,54,7,117,110,105,48,69,
+48,55,7,117,110,105,48,69,48,56,7,117,110,105,48,69,48,57,7,117,110,105,48,
+69,48,65,7,117,110,105,48,69,48,66,7,117,110,105,48,69,48,67,7,117,110,105,
+48,69,48,68,12,117,110,105,48,69,48,68,46,97,108,116,49,7,117,110,105,48,
+69,48,69,7,117,110,105,48,69,48,70,7,117,110,105,48,69,49,48,12,117,110,105,
+48,69,49,48,46,97,108,116,49,7,117,110,105,48,69,49,49,7,117,110,105,48,69,
+49,50,7,117,110,105,48,69,49,51,7,117,110,105,48,69,49,52,7,117,110,105,48,
+69,49,53,7,117,110,105,48,69,49,54,7,117,110,105,48,69,49,55,7,117,110,105,
+48,69,49,56,7,117,110,105,48,69,49,57,7,117,110,105,48,69,49,65,7,117,110,
+105,48,69,49,66,7,117,110,105,48,69,49,67,7,117,110,105,48,69,49,68,7,117,
+110,105,48,69,49,69,7,117,110,105,48,69,49,70,7,117,110,105,48,69,50,48,7,
+117,110,105,48,69,50,49,7,117,110,105,48,69,50,50,7,117,110,105,48,69,50,
+51,7,117,110,105,48,69,50,52,7,117,110,105,48,69,50,53,7,117,110,105,48,69,
+50,54,7,117,110,105,48,69,50,55,7,117,110,105,48,69,50,56,7,117,110,105,48,
+69,50,57,7,117,110,105,48,69,50,65,7,117,110,105,48,69,50,66,7,117,110,105,
+48,69,50,67,7,117,110,105,48,69,50,68,7,117,110,105,48,69,50,69,7,117,110,
+105,48,69,50,70,7,117,110,105,48,69,51,48,7,117,110,105,48,69,51,49,7,117,
+110,105,48,69,51,50,7,117,110,105,48,69,51,51,7,117,110,105,48,69,51,52,7,
+117,110,105,48,69,51,53,7,117,110,105,48,69,51,54,7,117,110,105,48,69,51,
+55,7,117,110,105,48,69,51,56,7,117,110,105,48,69,51,57,7,117,110,105,48,69,
+51,65,7,117,110,105,48,69,51,70,7,117,110,105,48,69,52,48,7,117,110,105,48,
+69,52,49,7,117,110,105,48,69,52,50,7,117,110,105,48,69,52,51,7,117,110,105,
+48,69,52,52,7,117,110,105,48,69,52,53,7,117,110,105,48,69,52,54,7,117,110,
+105,48,69,52,55,7,117,110,105,48,69,52,56,7,117,110,105,48,69,52,57,7,117,
+110,105,48,69,52,65,7,117,110,105,48,69,52,66,7,117,110,105,48,69,52,67,7,
+117,110,105,48,69,52,68,7,117,110,105,48,69,52,69,7,117,110,105,48,69,52,
+70,7,117,110,105,48,69,53,48,7,117,110,105,48,69,53,49,7,117,110,105,48,69,
+53,50,7,117,110,105,48,69,53,51,7,117,110,105,48,69,53,52,7,117,110,105,48,
+69,53,53,7,117,110,105,48,69,53,54,7,117,110,105,48,69,53,55,7,117,110,105,
+48,69,53,56,7,117,110,105,48,69,53,57,7,117,110,105,48,69,53,65,7,117,110,
+105,48,69,53,66,13,117,110,105,48,69,52,56,46,115,109,97,108,108,13,117,110,
+105,48,69,52,57,46,115,109,97,108,108,13,117,110,105,48,69,52,65,46,115,109,
+97,108,108,13,117,110,105,48,69,52,66,46,115,109,97,108,108,13,117,110,105,
+48,69,52,67,46,115,109,97,108,108,7,117,110,105,50,48,48,66,7,117,110,105,
+50,53,67,67,7,117,110,105,70,69,70,70,7,117,110,105,50,48,48,67,7,117,110,
+105,50,48,48,68,7,117,110,105,48,50,66,67,7,117,110,105,48,50,68,55,7,117,
+110,105,48,51,48,51,7,117,110,105,48,51,51,49,11,117,110,105,48,51,51,49,
+46,97,108,116,0,0,1,0,3,0,8,0,10,0,15,0,7,255,255,0,15,0,1,0,0,0,12,0,0,0,
+76,0,84,0,2,0,10,0,0,0,53,0,1,0,54,0,54,0,3,0,55,0,56,0,1,0,57,0,63,0,3,0,
+64,0,71,0,1,0,72,0,79,0,3,0,80,0,92,0,1,0,93,0,97,0,3,0,98,0,104,0,1,0,105,
+0,107,0,3,0,4,0,0,0,1,0,0,0,2,0,6,0,54,0,54,0,2,0,57,0,60,0,2,0,61,0,63,0,
+1,0,72,0,79,0,2,0,93,0,97,0,2,0,106,0,107,0,1,0,1,0,0,0,10,0,32,0,60,0,1,
+116,104,97,105,0,8,0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,109,97,114,107,0,14,
+109,107,109,107,0,20,0,0,0,1,0,0,0,0,0,2,0,1,0,2,0,3,0,8,0,16,0,24,0,4,0,
+0,0,1,0,24,0,6,2,6,0,1,1,138,0,6,1,0,0,1,2,72,0,1,1,60,1,88,0,2,0,12,0,90,
+0,19,0,0,3,186,0,0,2,202,0,0,2,202,0,0,2,202,0,0,2,202,0,1,3,186,0,1,3,186,
+0,1,3,186,0,0,2,208,0,0,3,192,0,0,3,198,0,0,3,198,0,0,3,186,0,0,3,204,0,0,
+3,210,0,0,2,214,0,0,4,44,0,1,4,50,0,1,4,50,0,56,2,142,2,142,2,148,2,148,2,
+148,2,148,2,154,2,154,2,154,2,154,2,148,2,148,2,160,2,160,2,166,2,166,2,166,
+2,166,2,172,2,148,2,172,2,148,2,178,2,178,2,178,3,138,2,178,2,178,2,184,3,
+144,2,184,3,144,2,190,3,150,2,190,2,190,2,196,2,196,2,202,2,202,2,208,2,208,
+2,154,2,154,2,154,2,154,2,154,2,154,2,214,2,214,2,220,2,220,2,226,2,226,2,
+232,2,232,3,60,2,232,2,238,2,238,3,66,2,238,2,244,2,244,3,72,2,244,2,184,
+2,184,2,250,2,250,3,0,3,0,3,6,3,6,2,154,3,156,3,12,3,12,2,184,3,144,3,18,
+3,18,3,24,2,154,2,232,2,232,3,30,3,12,3,36,3,36,3,42,3,162,3,48,3,48,3,54,
+3,168,3,78,3,78,3,18,3,18,3,84,3,174,3,90,3,180,3,96,3,186,3,96,3,192,3,102,
+3,90,2,142,2,142,0,2,0,4,0,54,0,54,0,0,0,57,0,63,0,1,0,72,0,79,0,8,0,105,
+0,107,0,16,0,2,0,5,0,4,0,51,0,0,0,53,0,53,0,48,0,55,0,55,0,49,0,65,0,69,0,
+50,0,99,0,99,0,55,0,1,0,130,0,164,0,1,0,12,0,90,0,19,0,0,1,14,0,0,1,8,0,0,
+1,14,0,0,1,14,0,0,1,14,0,0,1,20,0,0,2,166,0,0,2,172,0,0,2,166,0,0,2,166,0,
+0,2,166,0,0,1,14,0,0,1,26,0,0,1,32,0,0,2,154,0,0,1,92,0,0,1,32,0,0,2,160,
+0,0,1,32,0,19,0,210,0,210,0,210,0,210,0,210,0,210,0,210,0,210,0,210,0,210,
+0,222,0,210,0,216,0,228,0,234,0,234,0,240,0,234,0,210,0,2,0,5,0,54,0,54,0,
+0,0,57,0,60,0,1,0,72,0,79,0,5,0,93,0,97,0,13,0,105,0,105,0,18,0,2,0,5,0,54,
+0,54,0,0,0,57,0,60,0,1,0,72,0,79,0,5,0,93,0,97,0,13,0,105,0,105,0,18,0,1,
+0,46,0,62,0,1,0,12,0,34,0,5,0,0,0,90,0,0,0,90,0,0,0,90,0,0,0,90,0,0,0,90,
+0,5,0,104,0,104,0,110,0,68,0,68,0,2,0,2,0,61,0,63,0,0,0,106,0,107,0,3,0,2,
+0,2,0,61,0,63,0,0,0,106,0,107,0,3,0,1,255,226,254,12,0,1,0,0,254,12,0,1,0,
+100,254,12,0,1,0,100,254,42,0,1,0,0,0,0,0,1,0,0,0,20,0,1,0,0,0,50,0,1,0,0,
+1,244,0,1,0,0,2,38,0,1,0,0,1,194,0,1,0,0,253,248,0,1,0,0,254,192,0,1,255,
+72,0,0,0,1,255,106,0,0,0,1,255,156,0,0,0,1,4,76,0,0,0,1,4,164,0,0,0,1,4,131,
+0,0,0,1,3,37,0,0,0,1,4,0,0,0,0,1,4,164,0,60,0,1,6,92,0,0,0,1,4,127,0,0,0,
+1,3,230,0,0,0,1,5,189,0,0,0,1,6,128,0,0,0,1,6,113,0,0,0,1,4,229,0,0,0,1,4,
+13,0,0,0,1,3,214,0,0,0,1,4,117,0,0,0,1,4,135,0,0,0,1,4,225,0,0,0,1,4,17,0,
+0,0,1,4,114,0,0,0,1,3,93,0,0,0,1,4,96,0,0,0,1,3,62,0,0,0,1,4,131,0,60,0,1,
+4,96,0,60,0,1,4,122,0,0,0,1,4,55,1,47,0,1,4,21,0,0,0,1,4,2,0,60,0,1,3,105,
+0,0,0,1,3,123,0,0,0,1,3,213,0,0,0,1,3,152,0,0,0,1,1,94,0,0,0,1,3,112,0,0,
+0,1,3,12,3,152,0,1,2,208,3,152,0,1,255,56,0,0,0,1,255,69,0,0,0,1,254,171,
+0,0,0,1,253,226,0,0,0,1,255,85,0,0,0,1,6,92,254,112,0,1,4,127,253,248,0,1,
+3,230,253,248,0,1,4,131,253,248,0,1,4,226,0,0,0,1,4,2,0,0,0,1,1,244,0,0,0,
+1,4,26,0,0,0,1,3,12,0,0,0,1,3,52,0,0,0,1,255,136,0,0,0,1,255,6,0,0,0,1,0,
+0,253,218,0,1,255,136,253,218,0,1,254,247,0,0,0,1,255,91,0,0,0,1,0,0,0,10,
+0,30,0,56,0,1,116,104,97,105,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,
+112,0,8,0,0,0,7,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,12,0,26,0,34,0,42,0,50,0,58,
+0,66,0,74,0,82,0,90,0,98,0,106,0,114,0,6,1,0,0,1,0,96,0,2,0,0,0,1,0,128,0,
+1,0,0,0,1,0,140,0,6,0,0,0,1,0,158,0,6,0,0,0,1,0,206,0,6,0,0,0,1,0,228,0,6,
+0,0,0,1,1,4,0,1,1,0,0,1,1,36,0,1,0,0,0,1,1,42,0,1,0,0,0,1,1,60,0,1,0,0,0,
+1,1,66,0,1,0,0,0,1,1,72,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,7,0,1,0,1,0,16,
+0,2,0,2,0,61,0,63,0,0,0,106,0,107,0,3,0,1,0,14,0,1,0,8,0,2,0,78,0,55,0,1,
+0,1,0,56,0,2,0,16,0,5,0,73,0,74,0,75,0,76,0,77,0,2,0,1,0,93,0,97,0,0,0,3,
+0,1,0,28,0,1,0,18,0,0,0,1,0,0,0,8,0,2,0,1,0,73,0,77,0,0,0,2,0,4,0,54,0,54,
+0,0,0,57,0,60,0,1,0,72,0,79,0,5,0,93,0,97,0,13,0,3,0,1,0,24,0,1,0,18,0,0,
+0,1,0,0,0,9,0,1,0,1,0,106,0,1,0,1,0,17,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,
+0,10,0,1,0,1,0,20,0,2,0,2,0,61,0,63,0,0,0,106,0,107,0,3,0,3,0,1,0,24,0,1,
+0,18,0,0,0,1,0,0,0,11,0,1,0,1,0,106,0,2,0,2,0,15,0,15,0,0,0,23,0,24,0,1,0,
+2,0,8,0,1,0,17,0,1,0,1,0,16,0,2,0,16,0,5,0,93,0,94,0,95,0,96,0,97,0,2,0,1,
+0,73,0,77,0,0,0,2,0,8,0,1,0,107,0,1,0,1,0,106,0,2,0,8,0,1,0,21,0,1,0,1,0,
+20,0,2,0,8,0,1,0,107,0,1,0,1,0,106,};
+#endif
@@ -0,0 +1,603 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansTifinagh_Regular_ttf_size = 14668;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansTifinagh_Regular_ttf");
+asm(".type fz_font_NotoSansTifinagh_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansTifinagh_Regular_ttf, 14668");
+asm(".balign 64");
+asm("fz_font_NotoSansTifinagh_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansTifinagh-Regular.ttf\"");
+#else
+const int fz_font_NotoSansTifinagh_Regular_ttf_size = 14668;
+const char fz_font_NotoSansTifinagh_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,1,124,1,156,0,0,49,240,0,0,0,54,71,
+80,79,83,250,11,122,86,0,0,50,40,0,0,4,78,71,83,85,66,210,83,219,149,0,0,
+54,120,0,0,2,212,79,83,47,50,122,235,106,229,0,0,1,104,0,0,0,96,99,109,97,
+112,68,32,119,12,0,0,3,92,0,0,0,148,103,97,115,112,0,7,0,7,0,0,49,228,0,0,
+0,12,103,108,121,102,167,234,176,98,0,0,4,188,0,0,34,166,104,101,97,100,5,
+207,134,164,0,0,0,236,0,0,0,54,104,104,101,97,14,87,4,35,0,0,1,36,0,0,0,36,
+104,109,116,120,243,41,26,149,0,0,1,200,0,0,1,148,108,111,99,97,170,178,179,
+233,0,0,3,240,0,0,0,204,109,97,120,112,0,109,0,78,0,0,1,72,0,0,0,32,110,97,
+109,101,142,1,185,195,0,0,39,100,0,0,6,12,112,111,115,116,215,203,127,37,
+0,0,45,112,0,0,4,113,0,1,0,0,0,1,12,205,206,30,234,187,95,15,60,245,0,11,
+8,0,0,0,0,0,206,133,179,202,0,0,0,0,210,99,123,225,252,92,254,113,9,107,6,
+189,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,9,187,252,92,252,90,
+9,107,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,101,0,1,0,0,0,101,0,77,0,7,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,124,1,144,0,5,0,0,5,154,5,51,
+0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,4,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,
+141,2,88,0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,3,4,205,0,193,0,0,0,0,2,20,
+0,0,2,20,0,0,3,80,0,162,6,217,0,123,6,219,0,125,5,111,0,70,5,111,0,70,5,29,
+0,70,4,215,0,102,5,12,0,61,5,12,0,61,5,45,0,199,5,45,0,123,5,154,0,82,6,90,
+0,123,5,203,0,199,3,252,0,123,5,203,0,199,6,219,0,125,6,219,0,125,2,72,0,
+160,5,29,0,70,5,205,0,199,5,29,0,70,5,152,0,139,5,211,0,199,5,240,0,150,3,
+209,0,123,4,23,0,102,5,4,0,123,6,70,0,92,4,74,0,199,5,45,0,199,2,68,0,199,
+6,31,0,113,2,47,0,172,4,104,0,76,3,80,0,162,6,219,0,125,6,219,0,125,5,205,
+0,199,2,86,0,150,5,174,0,141,6,219,0,125,6,219,0,125,6,12,0,125,4,39,0,102,
+5,29,0,70,6,12,0,125,5,45,0,199,5,94,0,102,5,164,0,199,3,209,0,123,6,176,
+0,123,3,162,0,199,6,176,0,123,5,53,0,41,6,43,0,123,2,119,0,61,6,39,0,68,0,
+0,252,92,6,115,0,150,9,187,0,125,5,175,0,199,5,175,0,199,6,226,0,199,6,219,
+0,125,5,45,0,199,5,12,0,61,7,34,0,123,6,246,0,160,4,234,0,102,5,111,0,70,
+4,215,0,102,6,70,0,92,2,176,0,60,6,219,0,125,5,103,0,92,6,126,0,100,9,145,
+0,125,6,219,0,125,9,145,0,125,7,157,0,125,5,45,0,199,6,31,0,113,3,209,0,123,
+7,19,0,92,0,0,254,50,0,0,253,26,0,0,253,110,0,0,253,81,0,0,254,251,0,0,254,
+99,0,0,252,223,7,178,0,199,6,104,0,199,5,172,0,199,4,98,0,199,0,0,0,0,0,0,
+0,1,0,3,0,1,0,0,0,12,0,4,0,136,0,0,0,30,0,16,0,3,0,14,0,0,0,13,0,32,0,160,
+3,2,3,4,3,7,3,35,3,49,32,13,45,103,45,112,45,127,254,255,255,255,0,0,0,0,
+0,13,0,32,0,160,3,1,3,4,3,6,3,35,3,49,32,13,45,48,45,111,45,127,254,255,255,
+255,0,1,255,245,255,227,255,99,253,88,253,87,253,86,253,59,253,46,224,87,
+210,212,210,205,210,191,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,58,0,119,0,190,0,225,1,4,1,42,
+1,88,1,113,1,141,1,165,1,189,2,10,2,46,2,79,2,133,2,165,2,225,3,43,3,110,
+3,134,3,158,3,206,4,20,4,48,4,98,4,137,4,161,4,213,5,10,5,49,5,68,5,82,5,
+117,5,147,5,201,6,14,6,72,6,143,6,168,6,221,7,52,7,126,7,198,8,36,8,61,8,
+93,8,199,8,233,9,7,9,26,9,63,9,130,9,154,9,227,9,251,10,15,10,33,10,58,10,
+160,10,194,11,13,11,77,11,152,11,181,11,244,12,15,12,51,12,96,12,133,12,188,
+12,231,13,20,13,55,13,145,13,227,13,246,14,15,14,87,14,168,15,0,15,109,15,
+131,15,187,15,230,16,38,16,58,16,85,16,99,16,126,16,149,16,171,16,184,16,
+239,17,29,17,61,17,83,17,83,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,
+33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,104,4,230,
+0,0,2,0,162,255,236,2,174,1,246,0,11,0,23,0,0,55,52,54,51,50,22,21,20,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,6,162,154,108,108,154,153,109,108,
+154,143,73,48,47,70,70,47,49,72,240,111,151,151,111,111,149,148,112,50,69,
+70,49,48,70,69,0,3,0,123,255,236,6,92,5,205,0,15,0,24,0,33,0,0,19,52,18,36,
+51,50,4,18,21,20,2,4,35,34,36,2,1,50,54,54,55,33,30,2,19,34,6,6,7,33,46,2,
+123,201,1,92,202,203,1,93,202,198,254,164,208,206,254,164,197,2,242,141,246,
+161,19,251,145,20,161,247,140,140,247,159,20,4,109,20,162,247,2,219,202,1,
+94,202,203,254,163,202,199,254,166,206,205,1,92,254,118,133,237,142,144,237,
+131,4,162,134,234,144,142,237,133,0,0,5,0,125,255,236,6,94,5,205,0,15,0,20,
+0,25,0,30,0,35,0,0,19,52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,22,0,23,
+17,17,6,0,7,33,19,54,0,55,33,37,38,0,39,17,125,198,1,94,204,202,1,93,202,
+198,254,164,207,207,254,162,195,184,26,1,18,188,187,254,239,26,1,230,161,
+184,1,20,26,254,26,1,230,28,254,243,189,2,219,200,1,93,205,203,254,163,202,
+199,254,166,206,207,1,90,118,196,254,228,28,1,252,2,156,26,254,228,196,253,
+100,24,1,28,198,162,198,1,22,30,254,6,0,2,0,70,0,0,5,41,5,182,0,10,0,13,0,
+0,19,33,21,1,1,35,1,1,35,9,3,33,111,4,145,254,25,2,16,195,254,80,254,82,194,
+2,16,254,25,2,71,1,82,253,92,5,182,90,253,109,253,55,2,70,253,186,2,201,2,
+145,253,242,1,200,0,2,0,70,0,0,5,41,5,182,0,10,0,13,0,0,55,1,1,51,1,1,51,
+1,1,21,33,55,33,1,111,1,231,253,240,194,1,174,1,176,195,253,240,1,231,251,
+111,245,2,164,254,174,92,2,146,2,200,253,187,2,69,253,56,253,108,90,162,1,
+200,0,0,3,0,70,0,0,4,215,5,182,0,9,0,12,0,15,0,0,19,33,21,1,1,21,33,53,9,
+3,33,17,33,1,70,4,145,254,23,1,233,251,111,1,229,254,27,2,71,1,80,253,96,
+2,160,254,176,5,182,90,253,127,253,127,90,92,2,127,2,127,254,0,1,186,251,
+142,1,184,0,3,0,102,0,0,4,113,5,182,0,3,0,15,0,27,0,0,1,17,35,17,5,52,54,
+51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,2,199,183,254,
+86,65,60,61,68,68,61,59,66,3,13,66,59,61,68,68,61,59,66,5,182,250,74,5,182,
+137,66,71,71,66,64,75,74,65,69,68,71,66,64,75,72,0,0,1,0,61,0,0,4,207,5,182,
+0,10,0,0,51,35,1,51,1,35,1,38,39,6,6,233,172,1,248,162,1,248,172,254,194,
+67,27,10,26,5,182,250,74,3,156,191,108,42,84,0,0,1,0,61,0,0,4,207,5,182,0,
+11,0,0,37,54,54,1,51,1,35,1,51,1,22,22,2,135,16,48,1,92,172,254,8,162,254,
+8,172,1,60,31,49,242,63,148,3,241,250,74,5,182,252,111,91,144,0,1,0,199,0,
+0,4,178,5,182,0,11,0,0,19,33,21,33,17,33,21,33,17,33,21,33,199,3,235,252,
+203,3,53,252,203,3,53,252,21,5,182,162,254,25,162,254,23,162,0,1,0,123,0,
+0,4,102,5,182,0,11,0,0,33,33,53,33,17,33,53,33,17,33,53,33,4,102,252,21,3,
+53,252,203,3,53,252,203,3,235,162,1,233,162,1,231,162,0,0,5,0,82,255,236,
+5,72,5,205,0,11,0,23,0,35,0,47,0,51,0,0,1,52,54,51,50,22,21,20,6,35,34,38,
+55,20,22,51,50,54,53,52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,
+22,51,50,54,53,52,38,35,34,6,1,53,33,21,1,199,154,108,108,154,153,109,108,
+154,143,73,48,47,70,70,47,49,72,143,154,108,108,154,153,109,108,154,143,73,
+48,47,70,70,47,49,72,253,252,4,246,4,199,111,151,151,111,111,149,148,112,
+50,69,70,49,48,70,69,251,248,111,151,151,111,111,149,148,112,50,69,70,49,
+48,70,69,1,106,162,162,0,0,1,0,123,0,0,5,223,5,182,0,19,0,0,33,33,17,33,17,
+33,53,33,17,33,53,33,17,33,17,33,21,33,17,33,5,223,253,226,254,217,253,225,
+1,104,254,152,2,31,1,39,2,30,254,152,1,104,2,139,253,117,162,4,114,162,253,
+119,2,137,162,251,142,0,0,2,0,199,0,0,5,133,5,182,0,8,0,13,0,0,51,17,33,21,
+1,1,35,1,1,19,17,20,7,1,199,4,145,254,16,2,29,194,254,63,254,33,90,8,2,233,
+5,182,90,253,137,253,27,2,98,253,158,5,20,253,146,208,132,3,194,0,0,3,0,123,
+255,236,3,129,5,205,0,11,0,23,0,35,0,0,19,52,54,51,50,22,21,20,6,35,34,38,
+17,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,123,
+75,72,72,80,82,70,69,78,77,70,71,81,81,71,70,77,1,219,75,72,72,80,82,70,69,
+78,5,43,78,84,83,79,78,86,86,251,178,78,84,84,78,78,85,85,2,156,78,84,83,
+79,78,86,86,0,2,0,199,0,0,5,133,5,182,0,8,0,13,0,0,19,51,1,1,51,1,1,21,33,
+19,22,21,17,33,199,92,1,223,1,193,194,253,227,1,240,251,111,172,10,2,223,
+5,182,253,156,2,100,253,27,253,137,90,4,80,168,252,253,246,0,3,0,125,255,
+236,6,94,5,205,0,15,0,24,0,33,0,0,19,52,18,36,51,50,4,18,21,20,2,4,35,34,
+36,2,55,20,22,22,23,17,14,2,5,52,38,38,39,17,62,2,125,198,1,94,204,202,1,
+93,202,198,254,164,207,207,254,162,195,180,124,222,135,132,225,124,4,119,
+124,220,135,133,223,123,2,219,200,1,93,205,203,254,163,202,199,254,166,206,
+207,1,90,198,144,251,166,23,4,146,20,169,253,144,143,253,166,24,251,110,21,
+167,252,0,0,3,0,125,255,236,6,94,5,205,0,23,0,32,0,41,0,0,19,52,18,36,51,
+50,22,23,55,23,7,22,22,21,20,2,4,35,32,39,7,39,55,38,1,52,39,1,22,51,50,36,
+18,37,20,23,1,38,35,34,4,2,125,198,1,94,204,134,240,97,168,114,168,79,89,
+198,254,164,207,254,246,205,166,115,166,166,5,43,109,252,209,159,194,157,
+1,9,149,251,137,109,3,47,161,191,158,254,249,151,2,219,200,1,93,205,90,78,
+168,115,168,97,240,134,199,254,166,206,165,165,114,166,204,1,11,190,158,252,
+209,125,157,1,16,163,183,165,3,47,127,156,254,236,0,4,0,160,255,217,1,168,
+5,221,0,10,0,22,0,34,0,46,0,0,19,52,51,50,22,21,20,6,35,34,38,17,52,54,51,
+50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,
+22,21,20,6,35,34,38,160,129,64,71,73,62,60,69,65,64,65,70,72,63,61,68,66,
+63,65,70,74,61,59,70,68,61,63,72,72,63,61,68,2,12,142,73,69,68,77,76,254,
+161,69,75,76,68,68,75,74,5,43,68,75,77,66,67,77,74,254,164,68,75,76,67,68,
+75,74,0,1,0,70,0,0,4,215,5,182,0,7,0,0,9,2,35,1,1,35,1,4,215,254,25,1,231,
+195,254,121,254,123,194,3,206,5,182,253,37,253,37,2,72,253,184,5,182,0,0,
+1,0,199,0,0,5,6,5,182,0,11,0,0,33,17,33,17,35,17,33,17,51,17,33,17,4,80,253,
+45,182,1,196,183,1,196,2,139,253,117,3,45,2,137,253,119,252,211,0,1,0,70,
+0,0,4,215,5,182,0,24,0,0,1,22,22,23,51,38,53,17,51,17,20,7,51,54,55,19,51,
+1,1,35,1,1,35,1,1,1,8,113,142,65,4,15,162,12,4,105,30,182,195,254,25,1,231,
+195,254,121,254,123,194,1,231,254,25,5,182,170,213,116,165,58,1,20,254,242,
+79,150,182,45,1,16,253,37,253,37,2,72,253,184,2,219,2,219,0,4,0,139,0,127,
+5,12,5,53,0,11,0,23,0,35,0,47,0,0,19,52,54,51,50,22,21,20,6,35,34,38,17,52,
+54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,
+50,22,21,20,6,35,34,38,139,75,73,73,78,81,70,69,79,77,71,72,79,78,73,72,76,
+3,86,75,73,73,78,81,70,69,79,77,71,72,79,78,73,72,76,4,147,78,84,84,78,76,
+87,85,252,222,78,84,85,77,77,87,87,3,189,78,84,84,78,76,87,85,252,222,78,
+84,85,77,77,87,87,0,0,2,0,199,0,0,5,88,5,182,0,6,0,11,0,0,19,33,21,1,33,21,
+33,19,17,20,7,1,199,4,145,252,135,3,121,251,111,182,12,2,239,5,182,90,251,
+70,162,5,20,253,211,224,243,4,0,0,0,3,0,150,2,82,5,90,3,102,0,10,0,21,0,32,
+0,0,1,52,51,50,22,21,20,6,35,34,38,37,52,51,50,22,21,20,6,35,34,38,37,52,
+51,50,22,21,20,6,35,34,38,2,121,125,63,66,68,61,59,66,254,29,124,63,66,68,
+61,58,66,3,198,125,63,66,68,61,59,66,2,221,137,73,64,64,75,72,67,137,73,64,
+64,75,73,66,137,73,64,64,75,72,0,1,0,123,255,236,3,86,5,205,0,19,0,0,19,53,
+36,55,39,37,53,1,21,4,7,22,23,5,21,4,7,22,5,21,123,1,134,122,132,254,132,
+2,219,254,108,102,137,62,1,51,254,118,134,72,1,200,1,104,117,203,57,64,196,
+117,1,115,172,213,47,64,33,159,119,198,62,33,233,172,0,1,0,102,0,0,3,176,
+5,182,0,11,0,0,19,33,21,33,17,33,21,33,53,33,17,33,102,3,74,254,182,1,74,
+252,182,1,74,254,182,5,182,162,251,142,162,162,4,114,0,1,0,123,255,236,4,
+137,5,205,0,31,0,0,1,6,4,35,53,50,54,18,53,52,2,38,35,53,50,4,23,54,36,51,
+21,34,6,2,21,20,18,22,51,21,34,36,2,131,76,254,233,165,115,200,115,116,200,
+114,162,1,25,77,77,1,21,164,115,198,115,114,200,114,164,254,233,1,123,185,
+214,159,160,1,17,159,159,1,21,158,160,216,188,189,215,160,158,254,236,160,
+159,254,238,159,159,214,0,2,0,92,0,0,5,233,5,182,0,27,0,31,0,0,1,33,17,35,
+17,33,17,35,17,33,53,33,17,33,53,33,17,51,17,33,17,51,17,33,21,33,17,41,2,
+17,33,5,233,254,162,182,254,156,183,254,162,1,94,254,162,1,94,183,1,100,182,
+1,94,254,162,1,94,252,136,1,100,254,156,1,125,254,131,1,125,254,131,1,125,
+162,1,121,161,1,125,254,131,1,125,254,131,161,254,135,1,121,0,1,0,199,0,0,
+3,131,5,182,0,22,0,0,1,52,55,35,7,7,1,21,35,17,51,17,20,7,51,54,54,55,19,
+53,51,17,35,2,205,6,6,36,40,254,254,184,184,6,6,19,42,23,250,182,182,3,29,
+115,75,105,98,253,199,215,5,182,253,78,97,186,53,122,47,2,41,198,250,74,0,
+1,0,199,0,0,4,178,5,182,0,7,0,0,19,33,21,33,17,33,21,33,199,3,235,252,203,
+3,53,252,21,5,182,162,251,142,162,0,0,1,0,199,0,0,1,125,5,182,0,3,0,0,1,17,
+35,17,1,125,182,5,182,250,74,5,182,0,0,1,0,113,0,0,5,172,5,182,0,19,0,0,1,
+33,17,35,17,33,53,33,53,33,53,33,17,51,17,33,21,33,21,33,5,172,253,190,182,
+253,189,2,67,253,189,2,67,182,2,66,253,190,2,66,1,186,254,70,1,186,162,254,
+162,1,186,254,70,162,254,0,0,2,0,172,254,152,1,129,5,182,0,3,0,15,0,0,1,17,
+35,17,3,52,54,51,50,22,21,20,6,35,34,38,1,115,183,16,63,44,43,63,59,47,48,
+59,5,182,250,74,5,182,249,84,60,55,55,60,53,61,60,0,0,2,0,76,255,236,4,31,
+5,182,0,20,0,32,0,0,19,52,54,55,1,33,53,33,21,1,55,51,50,4,21,20,6,6,35,34,
+36,1,34,6,21,20,22,51,50,54,53,52,38,76,87,140,1,201,253,153,3,76,254,29,
+31,28,225,1,9,121,221,148,226,254,249,1,235,143,164,162,145,143,160,168,1,
+147,114,176,145,1,209,159,145,254,24,2,227,194,121,199,110,225,1,223,150,
+126,131,146,156,137,111,149,0,4,0,162,255,236,2,174,5,205,0,11,0,23,0,35,
+0,47,0,0,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,
+162,154,108,108,154,153,109,108,154,143,73,48,47,70,70,47,49,72,143,154,108,
+108,154,153,109,108,154,143,73,48,47,70,70,47,49,72,4,199,111,151,151,111,
+111,149,148,112,50,69,70,49,48,70,69,251,248,111,151,151,111,111,149,148,
+112,50,69,70,49,48,70,69,0,2,0,125,255,236,6,94,5,205,0,15,0,31,0,0,19,52,
+18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,18,4,51,50,36,18,53,52,2,36,35,
+34,4,2,125,198,1,94,204,202,1,93,202,198,254,164,207,207,254,162,195,180,
+152,1,10,154,153,1,10,152,154,254,249,154,154,254,248,154,2,219,200,1,93,
+205,203,254,163,202,199,254,166,206,207,1,90,198,158,254,237,159,159,1,19,
+158,159,1,20,159,158,254,235,0,0,2,0,125,255,197,6,94,5,205,0,20,0,39,0,0,
+1,20,2,7,23,7,39,6,6,35,34,36,2,53,52,18,36,51,50,4,18,5,1,54,53,52,2,36,
+35,34,4,2,21,20,18,4,51,50,55,1,6,94,93,91,182,115,186,82,242,124,208,254,
+163,197,203,1,93,202,202,1,92,201,253,70,1,133,127,155,254,250,152,154,254,
+246,154,152,1,12,154,177,150,254,123,2,219,134,255,0,103,183,114,188,68,81,
+206,1,91,198,203,1,93,202,202,254,162,179,254,118,157,214,159,1,22,157,159,
+254,235,158,160,254,239,159,109,1,135,0,0,1,0,199,0,0,5,6,5,182,0,11,0,0,
+1,17,33,17,35,17,33,17,51,17,33,17,5,6,254,60,183,254,60,182,2,211,5,182,
+252,172,253,158,2,98,3,84,253,78,2,178,0,3,0,150,0,41,1,193,5,147,0,11,0,
+23,0,35,0,0,19,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,
+35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,150,75,72,72,80,82,70,69,78,77,
+70,71,81,80,72,70,77,77,70,70,82,80,72,70,77,2,223,78,84,83,79,78,86,86,254,
+60,78,84,84,78,78,86,85,4,116,78,83,81,80,78,86,85,0,5,0,141,0,125,5,33,5,
+68,0,11,0,23,0,35,0,47,0,59,0,0,1,52,54,51,50,22,21,20,6,35,34,38,1,52,54,
+51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,
+22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,2,66,75,72,72,80,82,
+70,69,78,254,75,77,71,72,79,78,73,72,76,77,71,72,79,78,73,72,76,3,105,77,
+70,71,81,80,72,70,77,77,70,71,81,80,72,70,77,2,225,78,84,83,79,78,86,86,254,
+142,78,84,85,77,77,87,87,3,206,78,84,85,77,77,87,87,252,204,78,84,84,78,78,
+86,85,3,208,78,84,84,78,78,86,85,0,0,3,0,125,255,236,6,94,5,205,0,11,0,27,
+0,43,0,0,1,52,54,51,50,22,21,20,6,35,34,38,37,52,18,36,51,50,4,18,21,20,2,
+4,35,34,36,2,55,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,2,201,95,69,70,95,
+95,70,69,95,253,180,198,1,94,204,202,1,93,202,198,254,164,207,207,254,162,
+195,180,152,1,10,154,153,1,10,152,154,254,249,154,154,254,248,154,2,219,68,
+98,99,67,66,98,99,65,200,1,93,205,203,254,163,202,199,254,166,206,207,1,90,
+198,158,254,237,159,159,1,19,158,159,1,20,159,158,254,235,0,2,0,125,255,236,
+6,94,5,244,0,20,0,40,0,0,1,20,2,4,35,34,36,2,53,52,18,36,51,50,22,23,55,23,
+7,22,18,5,1,38,35,34,4,2,21,20,18,4,51,50,36,18,53,52,38,39,1,6,94,201,254,
+165,203,203,254,163,202,205,1,93,200,125,236,87,186,115,182,91,93,252,211,
+1,133,152,175,155,254,244,151,153,1,12,153,149,1,9,155,64,63,254,123,2,221,
+201,254,162,202,203,1,93,201,203,1,95,198,81,69,189,115,182,103,254,255,42,
+1,136,108,160,254,239,159,159,254,237,160,157,1,22,159,102,192,77,254,119,
+0,3,0,125,255,236,5,145,5,205,0,39,0,51,0,63,0,0,1,52,54,51,50,22,21,20,4,
+33,34,36,2,53,52,18,36,51,32,4,21,20,6,35,34,38,53,52,55,35,34,4,2,21,20,
+18,4,51,51,38,19,20,22,51,50,54,53,52,38,35,34,6,17,20,22,51,50,54,53,52,
+38,35,34,6,3,55,174,125,126,177,254,229,254,247,207,254,162,195,198,1,94,
+204,1,3,1,33,176,127,126,173,72,18,154,254,248,154,152,1,10,154,20,74,148,
+89,62,63,87,85,65,64,87,89,62,63,87,85,65,64,87,1,78,121,166,174,128,160,
+179,207,1,90,198,200,1,93,205,178,164,127,172,162,124,110,85,158,254,235,
+159,158,254,237,159,81,3,147,63,89,88,64,63,86,86,252,154,63,89,88,64,63,
+86,86,0,1,0,102,0,0,3,193,5,182,0,11,0,0,1,33,17,35,17,33,53,33,17,51,17,
+33,3,193,254,174,183,254,174,1,82,183,1,82,2,160,253,96,2,160,162,2,116,253,
+140,0,0,1,0,70,0,0,4,215,5,182,0,11,0,0,9,2,35,1,1,35,1,1,51,1,1,4,215,254,
+25,1,231,195,254,121,254,123,194,1,231,254,25,194,1,133,1,135,5,182,253,37,
+253,37,2,72,253,184,2,219,2,219,253,183,2,73,0,3,0,125,255,236,5,145,5,205,
+0,50,0,62,0,74,0,0,1,52,54,51,50,22,21,20,4,33,34,36,2,53,52,18,36,51,32,
+4,21,20,6,35,34,38,53,52,55,35,34,6,6,7,51,17,51,17,33,21,33,17,35,17,35,
+30,2,51,51,38,55,20,22,51,50,54,53,52,38,35,34,6,17,20,22,51,50,54,53,52,
+38,35,34,6,3,55,174,125,126,177,254,229,254,247,207,254,162,195,198,1,94,
+204,1,3,1,33,176,127,126,173,72,18,140,248,161,19,238,147,1,29,254,227,147,
+238,16,158,252,142,20,74,148,89,62,63,87,85,65,64,87,89,62,63,87,85,65,64,
+87,1,78,121,166,174,128,160,179,207,1,90,198,200,1,93,205,178,164,127,172,
+162,124,110,85,133,239,144,1,45,254,211,145,254,213,1,43,146,241,138,81,108,
+63,89,88,64,63,86,86,2,232,63,89,88,64,63,86,86,0,1,0,199,0,0,4,178,5,182,
+0,19,0,0,19,33,21,33,17,51,17,51,17,33,21,33,17,35,17,35,17,33,21,33,199,
+3,235,252,203,237,162,1,0,255,0,162,237,3,53,252,21,5,182,162,254,25,1,0,
+255,0,162,255,0,1,0,254,23,162,0,2,0,102,0,0,4,248,5,182,0,5,0,12,0,0,55,
+1,51,1,21,33,55,33,1,38,39,6,7,102,1,248,162,1,248,251,110,197,3,4,254,221,
+62,30,32,66,92,5,90,250,164,90,162,3,33,169,152,153,175,0,0,1,0,199,0,0,4,
+221,5,182,0,7,0,0,19,51,17,33,17,51,17,33,199,182,2,170,182,251,234,5,182,
+250,236,5,20,250,74,0,0,1,0,123,255,236,3,86,5,205,0,17,0,0,1,38,38,37,53,
+1,21,7,6,7,22,5,21,1,53,0,54,55,2,170,44,99,254,96,2,219,242,146,142,178,
+1,96,253,37,1,192,60,51,2,164,22,55,246,117,1,113,172,123,77,62,96,205,117,
+253,115,204,1,144,50,40,0,1,0,123,0,0,6,53,5,182,0,37,0,0,1,22,4,18,23,35,
+38,38,39,17,35,17,6,6,7,35,18,0,55,17,38,0,39,51,22,22,23,17,51,17,54,54,
+55,51,6,2,4,7,3,178,165,1,10,180,32,168,48,243,184,182,185,242,48,166,50,
+1,83,252,252,254,172,49,166,49,238,188,182,185,242,48,168,32,180,254,247,
+166,2,78,8,149,254,244,165,196,222,14,254,80,1,176,14,223,195,1,0,1,65,13,
+1,26,13,1,67,254,194,224,14,1,176,254,80,14,223,195,164,254,244,149,9,0,0,
+1,0,199,0,0,3,59,5,182,0,9,0,0,1,1,7,0,39,22,21,17,35,17,1,125,1,190,114,
+254,213,39,6,182,5,182,254,64,115,1,43,51,104,109,251,244,5,182,0,1,0,123,
+0,0,6,53,5,182,0,44,0,0,1,21,22,0,23,35,38,38,39,17,35,17,6,6,7,35,54,0,55,
+53,33,53,33,53,38,0,39,51,22,22,23,17,51,17,54,54,55,51,6,6,4,7,21,33,21,
+3,178,247,1,88,52,168,49,239,187,182,188,238,49,166,48,1,90,247,253,233,2,
+23,251,254,171,49,166,49,237,189,182,189,237,49,168,32,178,254,246,167,2,
+23,2,150,134,10,254,227,233,170,199,12,254,131,1,125,12,199,170,231,1,32,
+9,134,141,131,10,1,33,229,171,197,13,1,125,254,131,13,197,171,146,241,134,
+7,131,141,0,1,0,41,255,236,4,186,4,242,0,9,0,0,19,53,1,21,1,6,7,23,1,21,41,
+4,145,253,105,123,168,104,3,82,2,53,117,2,72,172,254,180,63,74,49,254,88,
+172,0,2,0,123,2,139,5,176,3,45,0,3,0,7,0,0,1,33,53,41,2,21,33,5,176,253,182,
+2,74,250,203,2,74,253,182,2,139,162,162,0,0,1,0,61,4,55,2,57,5,182,0,7,0,
+0,1,33,17,51,21,51,53,51,2,57,254,4,152,207,149,4,55,1,127,233,233,0,0,1,
+0,68,254,113,5,254,5,182,0,8,0,0,19,53,36,0,0,19,51,2,0,68,1,115,2,45,1,76,
+44,162,66,253,11,254,113,118,84,1,209,2,220,1,206,252,242,252,64,0,0,6,252,
+92,254,156,3,166,255,125,0,11,0,23,0,35,0,47,0,59,0,71,0,0,5,52,54,51,50,
+22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,
+21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,
+20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,252,92,59,44,49,55,56,48,
+44,59,1,76,59,43,50,55,63,42,43,59,1,76,59,43,43,62,62,43,43,59,1,75,60,43,
+49,55,56,48,43,60,1,76,59,44,43,61,61,43,44,59,1,76,59,43,50,55,63,42,43,
+59,244,61,52,58,55,53,59,52,60,61,52,59,54,60,52,52,60,61,52,52,61,60,52,
+52,60,61,52,58,55,53,59,52,60,61,52,52,61,60,52,52,60,61,52,59,54,60,52,52,
+0,1,0,150,0,170,5,221,4,236,0,19,0,0,1,17,33,53,51,21,33,17,51,17,35,17,33,
+21,35,53,33,17,35,17,1,78,1,144,183,1,144,184,184,254,112,183,254,112,184,
+4,236,254,36,218,218,1,220,251,190,1,196,202,202,254,60,4,66,0,0,3,0,125,
+255,236,9,107,5,205,0,26,0,35,0,44,0,0,1,33,17,35,17,35,6,2,4,35,34,36,2,
+53,52,18,36,51,50,4,18,23,51,53,51,21,33,5,20,18,22,23,17,14,2,5,52,38,38,
+39,17,62,2,9,107,254,134,183,224,18,208,254,180,191,202,254,168,206,199,1,
+92,205,182,1,73,213,24,225,183,1,122,247,198,127,222,132,131,223,127,4,119,
+122,220,137,136,221,122,2,146,254,240,1,16,185,254,200,181,199,1,91,205,195,
+1,96,207,173,254,208,188,248,248,89,141,255,0,167,20,4,146,20,168,255,143,
+140,251,170,25,251,110,22,169,255,0,4,0,199,0,0,5,52,5,182,0,7,0,23,0,30,
+0,37,0,0,19,33,21,33,17,33,21,33,1,20,22,22,51,50,54,54,53,52,38,38,35,34,
+6,6,23,52,54,55,17,38,38,37,20,6,7,17,22,22,199,4,109,252,73,3,183,251,147,
+1,22,114,198,111,104,189,112,111,187,107,115,195,113,146,105,85,86,104,2,
+25,106,84,82,108,5,182,162,251,142,162,2,204,115,190,108,113,192,108,104,
+196,115,110,192,113,86,144,26,254,1,26,139,90,85,144,28,2,3,25,149,0,0,4,
+0,199,0,0,5,52,5,182,0,15,0,28,0,36,0,48,0,0,1,20,22,22,51,50,54,54,53,52,
+38,38,35,34,6,6,23,52,54,51,50,22,22,21,20,6,35,34,38,1,33,21,33,17,33,21,
+33,1,52,54,51,50,22,21,20,6,35,34,38,1,221,114,198,111,104,189,112,111,187,
+107,115,195,113,146,160,115,69,121,72,157,105,112,163,254,88,4,109,252,73,
+3,183,251,147,2,65,71,47,45,68,67,46,47,71,2,204,115,190,108,113,192,108,
+104,196,115,110,192,113,111,158,75,126,68,108,160,151,3,95,162,251,142,162,
+2,204,50,66,70,46,47,68,64,0,1,0,199,0,0,6,126,6,124,0,15,0,0,1,35,53,33,
+17,33,21,33,17,33,53,51,21,33,21,33,5,28,172,253,13,3,53,252,21,3,169,172,
+1,98,254,158,4,66,210,251,142,162,5,182,198,198,162,0,0,3,0,125,254,212,6,
+94,5,205,0,17,0,27,0,36,0,0,37,17,35,17,52,18,36,51,50,4,18,21,20,2,4,35,
+34,36,3,21,20,22,22,23,17,14,2,5,52,38,38,39,17,62,2,1,51,182,199,1,92,205,
+196,1,93,208,203,254,163,201,167,254,211,102,131,223,125,125,219,130,4,112,
+122,220,137,136,221,122,239,253,229,4,7,195,1,96,207,200,254,164,206,199,
+254,162,202,139,2,137,84,125,236,158,18,4,146,18,160,237,171,140,251,170,
+25,251,110,22,169,255,0,1,0,199,0,0,4,178,6,124,0,13,0,0,19,33,53,51,17,33,
+17,33,21,33,17,33,21,33,199,3,63,172,252,203,3,53,252,203,3,53,252,21,5,182,
+198,254,152,254,25,162,254,23,162,0,0,2,0,61,0,0,4,207,6,124,0,3,0,15,0,0,
+1,17,35,17,19,54,54,1,51,1,35,1,51,1,22,22,2,219,172,88,16,48,1,92,172,254,
+8,162,254,8,172,1,60,31,49,6,124,253,198,2,58,250,118,63,148,3,241,250,74,
+5,182,252,111,91,144,0,0,1,0,123,0,0,6,167,5,182,0,27,0,0,1,35,17,35,17,33,
+53,33,17,33,53,33,17,51,17,51,17,51,17,33,21,33,17,33,21,33,17,35,3,231,172,
+161,253,225,1,104,254,152,2,31,161,172,162,2,30,254,152,1,104,253,226,162,
+1,131,1,8,253,117,162,4,114,162,253,119,1,0,255,0,2,137,162,251,142,162,2,
+139,0,1,0,160,0,0,6,86,5,182,0,19,0,0,1,17,33,17,33,17,35,17,33,17,35,17,
+33,17,33,17,51,17,33,17,6,86,253,127,2,129,182,251,182,182,2,127,253,129,
+182,4,74,5,182,253,226,254,135,253,225,1,125,254,131,2,31,1,121,2,30,254,
+132,1,124,0,0,3,0,102,0,0,4,132,5,182,0,10,0,21,0,33,0,0,1,17,20,7,54,54,
+55,23,1,35,17,5,52,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,
+34,38,2,199,7,36,214,88,114,254,66,182,1,99,125,61,68,68,61,60,65,252,243,
+65,60,61,68,68,61,60,65,5,182,251,244,122,91,45,219,86,115,254,64,5,182,137,
+137,71,66,64,75,72,67,66,71,71,66,64,75,73,0,3,0,70,0,0,5,41,6,124,0,3,0,
+14,0,17,0,0,1,17,35,17,9,2,51,1,1,51,1,1,21,33,55,33,1,3,13,172,254,14,1,
+242,253,229,194,1,174,1,176,195,253,240,1,231,251,111,245,2,164,254,174,6,
+124,253,248,2,8,249,224,2,146,2,200,253,187,2,69,253,56,253,108,90,162,1,
+200,0,0,3,0,102,0,0,4,113,5,182,0,3,0,15,0,26,0,0,1,17,35,17,5,52,54,51,50,
+22,21,20,6,35,34,38,1,52,51,50,22,21,20,6,35,34,38,2,199,183,254,86,65,60,
+61,68,68,61,60,65,3,13,125,61,68,68,61,60,65,5,182,250,74,5,182,137,66,71,
+71,66,64,75,73,251,160,137,71,66,64,75,72,0,0,1,0,92,0,0,5,233,5,182,0,19,
+0,0,1,33,17,35,17,33,53,33,17,51,17,33,17,51,17,33,21,33,17,35,3,213,254,
+156,183,254,162,1,94,183,1,100,182,1,94,254,162,182,3,152,252,104,3,152,161,
+1,125,254,131,1,125,254,131,161,252,104,0,7,0,60,254,212,2,116,6,189,0,3,
+0,13,0,23,0,33,0,43,0,53,0,63,0,0,19,17,51,17,7,52,51,50,22,21,20,6,35,34,
+37,52,51,50,22,21,20,6,35,34,23,52,51,50,22,21,20,6,35,34,19,52,51,50,22,
+21,20,6,35,34,3,52,51,50,22,21,20,6,35,34,7,52,51,50,22,21,20,6,35,34,253,
+182,15,103,43,62,55,50,103,254,152,103,43,62,55,50,103,180,103,43,62,55,50,
+103,180,103,50,55,62,43,103,180,103,50,55,62,43,103,180,103,50,55,62,43,103,
+1,1,3,144,252,112,204,112,52,60,53,60,113,112,52,60,53,60,127,112,52,60,53,
+60,6,136,113,60,53,60,52,1,96,113,60,53,60,52,128,113,60,53,60,52,0,0,4,0,
+125,255,236,6,94,5,205,0,3,0,15,0,31,0,47,0,0,1,17,35,17,1,52,54,51,50,22,
+21,20,6,35,34,38,37,52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,18,4,51,
+50,36,18,53,52,2,36,35,34,4,2,3,53,172,1,18,96,68,68,97,96,69,66,98,252,226,
+199,1,92,205,196,1,93,208,203,254,163,201,202,254,168,206,180,152,1,8,156,
+150,1,10,155,154,254,249,154,152,254,243,151,4,151,252,118,3,138,254,68,67,
+99,98,68,67,97,96,68,195,1,96,207,200,254,164,206,199,254,162,202,199,1,91,
+205,156,254,237,161,158,1,18,160,155,1,22,161,162,254,236,0,0,1,0,92,0,0,
+5,11,5,182,0,7,0,0,1,33,17,35,17,33,53,33,5,11,254,4,183,254,4,4,175,5,20,
+250,236,5,20,162,0,1,0,100,0,0,6,26,2,96,0,11,0,0,33,33,53,33,50,23,39,38,
+38,39,55,1,6,26,250,74,4,12,109,104,63,23,143,121,115,1,192,162,6,54,20,143,
+121,114,254,66,0,2,0,125,255,236,9,85,5,205,0,26,0,42,0,0,19,52,18,36,51,
+50,4,18,23,51,53,51,21,33,21,33,17,35,17,35,6,2,4,35,34,36,2,55,20,18,4,51,
+50,36,18,53,52,2,36,35,34,4,2,125,199,1,92,205,183,1,73,210,24,225,183,1,
+102,254,154,183,220,16,209,254,179,193,202,254,168,206,180,152,1,8,156,150,
+1,10,155,154,254,249,154,152,254,243,151,2,219,195,1,96,207,175,254,214,178,
+238,238,162,254,230,1,26,191,254,193,182,199,1,91,205,156,254,237,161,158,
+1,18,160,155,1,22,161,162,254,236,0,0,3,0,125,254,212,6,94,5,205,0,18,0,37,
+0,49,0,0,19,52,18,36,51,50,4,18,21,20,2,4,7,17,35,17,38,36,2,55,20,18,22,
+23,53,51,21,62,2,53,52,2,36,35,34,4,2,5,52,54,51,50,22,21,20,6,35,34,38,125,
+199,1,92,205,196,1,93,208,174,254,205,187,172,182,254,204,175,180,125,223,
+137,172,134,226,126,154,254,249,154,152,254,243,151,1,152,96,68,68,97,96,
+69,66,98,2,219,195,1,96,207,200,254,164,206,183,254,182,214,19,254,227,1,
+29,19,211,1,74,186,140,254,255,168,21,177,177,21,170,254,141,155,1,22,161,
+162,254,236,156,67,99,98,68,67,97,96,0,0,3,0,125,255,236,9,85,5,205,0,26,
+0,42,0,54,0,0,19,52,18,36,51,50,4,18,23,51,53,51,21,33,21,33,17,35,17,35,
+6,2,4,35,34,36,2,55,20,18,4,51,50,36,18,53,52,2,36,35,34,4,2,5,52,54,51,50,
+22,21,20,6,35,34,38,125,199,1,92,205,183,1,73,210,24,225,183,1,102,254,154,
+183,220,16,209,254,179,193,202,254,168,206,180,152,1,8,156,150,1,10,155,154,
+254,249,154,152,254,243,151,1,152,96,68,68,97,96,69,66,98,2,219,195,1,96,
+207,175,254,214,178,238,238,162,254,230,1,26,191,254,193,182,199,1,91,205,
+156,254,237,161,158,1,18,160,155,1,22,161,162,254,236,156,67,99,98,68,67,
+97,96,0,0,3,0,125,255,236,7,97,5,205,0,52,0,64,0,76,0,0,1,30,3,51,38,53,52,
+54,51,50,22,21,20,6,6,35,34,36,2,53,52,18,36,51,50,22,22,21,20,6,35,34,38,
+38,53,52,55,14,2,7,33,17,51,17,33,21,33,17,35,17,1,20,22,51,50,54,53,52,38,
+35,34,6,17,20,22,51,50,54,53,52,38,35,34,6,1,53,12,81,130,172,76,31,171,122,
+129,180,105,196,142,210,254,152,213,202,1,99,226,142,196,105,179,130,77,135,
+81,31,109,220,128,14,4,124,147,1,29,254,227,147,253,208,89,62,63,87,88,62,
+65,86,86,65,65,85,86,64,62,89,2,152,112,185,136,81,64,69,120,176,169,130,
+83,138,79,189,1,91,215,210,1,96,192,79,138,83,130,169,78,138,80,69,64,3,146,
+225,132,1,45,254,211,145,254,213,1,43,2,1,63,89,91,61,63,86,86,252,72,63,
+86,88,61,62,90,89,0,1,0,199,0,0,4,178,5,182,0,9,0,0,1,33,17,33,21,33,17,51,
+17,33,3,73,254,52,3,53,252,21,182,1,204,2,190,253,228,162,5,182,253,170,0,
+3,0,113,0,0,5,172,5,182,0,11,0,23,0,35,0,0,33,35,17,33,53,33,17,51,17,33,
+21,33,1,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,
+3,106,182,253,189,2,67,182,2,66,253,190,253,147,75,73,73,78,81,70,69,79,2,
+249,75,73,73,78,81,70,69,79,2,166,162,2,110,253,146,162,1,189,78,84,84,78,
+76,87,85,253,119,78,84,84,78,76,87,85,0,1,0,123,255,71,3,86,5,205,0,23,0,
+0,19,53,1,38,37,53,1,21,4,7,1,21,4,7,23,53,51,21,23,21,39,21,35,17,123,2,
+0,169,254,169,2,219,254,94,88,1,250,254,141,157,250,172,106,106,172,1,104,
+117,1,4,80,180,117,1,115,172,220,40,255,0,119,187,73,125,112,199,54,172,55,
+220,1,53,0,5,0,92,0,0,6,183,5,182,0,27,0,31,0,35,0,39,0,43,0,0,37,35,21,35,
+53,33,21,35,53,35,53,51,17,35,53,51,53,51,21,33,53,51,21,51,21,35,17,51,33,
+17,33,17,33,33,17,33,53,33,53,41,2,21,33,6,183,220,182,252,202,183,220,220,
+220,220,183,3,54,182,220,220,220,254,110,254,192,254,10,1,64,254,192,1,64,
+254,192,3,54,254,192,1,64,231,231,231,231,231,162,2,165,161,231,231,231,231,
+161,253,91,1,4,254,252,1,4,162,255,255,0,1,254,50,4,217,255,206,6,33,0,8,
+0,0,1,54,55,51,21,6,6,7,35,254,50,113,82,217,44,186,63,119,4,242,144,159,
+21,64,194,49,0,1,253,26,4,217,255,206,6,33,0,13,0,0,1,54,54,55,51,22,23,21,
+35,38,39,6,7,35,253,26,125,103,24,184,52,204,127,90,133,131,88,123,4,240,
+134,128,43,101,204,23,53,131,128,56,0,1,253,110,4,217,255,206,5,106,0,3,0,
+0,1,33,21,33,253,110,2,96,253,160,5,106,145,0,0,1,253,81,4,217,255,206,5,
+236,0,13,0,0,1,34,38,39,51,22,22,51,50,54,55,51,6,6,254,138,141,163,9,110,
+8,84,115,101,98,8,113,13,172,4,217,138,137,71,59,63,67,131,144,0,0,1,254,
+251,5,0,255,206,5,229,0,11,0,0,1,52,54,51,50,22,21,20,6,35,34,38,254,251,
+61,45,42,63,63,42,45,61,5,115,60,54,54,60,59,56,56,0,0,1,254,99,254,152,255,
+56,255,125,0,11,0,0,5,52,54,51,50,22,21,20,6,35,34,38,254,99,63,44,43,63,
+59,47,48,59,246,60,55,55,60,53,61,60,0,1,252,223,254,213,255,63,255,102,0,
+3,0,0,5,33,21,33,252,223,2,96,253,160,154,145,0,3,0,199,0,0,7,28,5,182,0,
+20,0,24,0,28,0,0,1,17,35,17,52,55,35,7,1,21,35,17,51,17,20,7,51,54,54,1,53,
+5,1,35,1,37,1,35,1,3,131,182,6,6,31,254,209,184,184,6,6,43,27,1,8,1,194,1,
+67,177,254,196,1,234,1,77,177,254,186,5,182,250,74,3,29,115,75,89,253,85,
+215,5,182,253,78,97,186,122,69,2,72,198,40,250,114,5,112,70,250,74,5,152,
+0,2,0,199,0,0,5,210,5,182,0,20,0,24,0,0,1,17,35,17,52,55,35,7,1,21,35,17,
+51,17,20,7,51,54,54,1,53,5,1,35,1,3,131,182,6,6,31,254,209,184,184,6,6,43,
+27,1,8,1,194,1,67,177,254,196,5,182,250,74,3,29,115,75,89,253,85,215,5,182,
+253,78,97,186,122,69,2,72,198,40,250,114,5,112,0,3,0,199,0,0,5,22,5,182,0,
+3,0,7,0,11,0,0,1,1,35,1,37,1,35,1,37,17,35,17,2,137,1,67,177,254,196,1,234,
+1,77,177,254,186,254,94,182,5,142,250,114,5,112,70,250,74,5,152,30,250,74,
+5,182,0,0,2,0,199,0,0,3,204,5,182,0,3,0,7,0,0,1,1,35,1,39,17,35,17,2,137,
+1,67,177,254,196,98,182,5,142,250,114,5,112,70,250,74,5,182,0,0,0,0,0,15,
+0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,
+0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,
+9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,32,0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,
+0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,0,96,1,
+174,0,3,0,1,4,9,0,11,0,62,2,14,0,3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,4,9,0,13,
+2,150,2,136,0,3,0,1,4,9,0,14,0,52,5,30,0,67,0,111,0,112,0,121,0,114,0,105,
+0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,84,0,105,0,
+102,0,105,0,110,0,97,0,103,0,104,0,82,0,101,0,103,0,117,0,108,0,97,0,114,
+0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,
+0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,
+110,0,115,0,32,0,84,0,105,0,102,0,105,0,110,0,97,0,103,0,104,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,53,0,32,0,117,0,104,0,78,
+0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,84,0,105,0,102,0,105,0,110,0,97,
+0,103,0,104,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,
+0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,
+0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,
+97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,
+32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,
+0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,
+0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,
+0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,
+0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,
+110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,
+101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,
+0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,
+111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,
+0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,
+0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,
+73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,
+0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,
+0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,
+0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,
+120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,
+0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,
+0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,
+0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,
+0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,101,0,0,1,99,0,2,0,3,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,
+12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,
+1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,
+1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,
+1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,
+1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,
+1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,7,117,110,105,
+50,68,51,48,7,117,110,105,50,68,51,49,7,117,110,105,50,68,51,50,7,117,110,
+105,50,68,51,51,7,117,110,105,50,68,51,52,7,117,110,105,50,68,51,53,7,117,
+110,105,50,68,51,54,7,117,110,105,50,68,51,55,7,117,110,105,50,68,51,56,7,
+117,110,105,50,68,51,57,7,117,110,105,50,68,51,65,7,117,110,105,50,68,51,
+66,7,117,110,105,50,68,51,67,7,117,110,105,50,68,51,68,7,117,110,105,50,68,
+51,69,7,117,110,105,50,68,51,70,7,117,110,105,50,68,52,48,7,117,110,105,50,
+68,52,49,7,117,110,105,50,68,52,50,7,117,110,105,50,68,52,51,7,117,110,105,
+50,68,52,52,7,117,110,105,50,68,52,53,7,117,110,105,50,68,52,54,7,117,110,
+105,50,68,52,55,7,117,110,105,50,68,52,56,7,117,110,105,50,68,52,57,7,117,
+110,105,50,68,52,65,7,117,110,105,50,68,52,66,7,117,110,105,50,68,52,67,7,
+117,110,105,50,68,52,68,7,117,110,105,50,68,52,69,7,117,110,105,50,68,52,
+70,7,117,110,105,50,68,53,48,7,117,110,105,50,68,53,49,7,117,110,105,50,68,
+53,50,7,117,110,105,50,68,53,51,7,117,110,105,50,68,53,52,7,117,110,105,50,
+68,53,53,7,117,110,105,50,68,53,54,7,117,110,105,50,68,53,55,7,117,110,105,
+50,68,53,56,7,117,110,105,50,68,53,57,7,117,110,105,50,68,53,65,7,117,110,
+105,50,68,53,66,7,117,110,105,50,68,53,67,7,117,110,105,50,68,53,68,7,117,
+110,105,50,68,53,69,7,117,110,105,50,68,53,70,7,117,110,105,50,68,54,48,7,
+117,110,105,50,68,54,49,7,117,110,105,50,68,54,50,7,117,110,105,50,68,54,
+51,7,117,110,105,50,68,54,52,7,117,110,105,50,68,54,53,7,117,110,105,50,68,
+54,54,7,117,110,105,50,68,54,55,7,117,110,105,50,68,54,70,7,117,110,105,50,
+68,55,48,7,117,110,105,50,68,55,70,11,117,110,105,50,68,52,68,50,68,53,67,
+11,117,110,105,50,68,52,48,50,68,53,67,11,117,110,105,50,68,52,69,50,68,52,
+48,11,117,110,105,50,68,52,69,50,68,53,57,11,117,110,105,50,68,52,69,50,68,
+53,67,11,117,110,105,50,68,52,70,50,68,52,48,11,117,110,105,50,68,52,70,50,
+68,51,57,11,117,110,105,50,68,52,70,50,68,51,56,11,117,110,105,50,68,51,67,
+50,68,53,67,11,117,110,105,50,68,52,70,50,68,51,67,11,117,110,105,50,68,52,
+70,50,68,51,54,11,117,110,105,50,68,52,70,50,68,51,52,11,117,110,105,50,68,
+52,70,50,68,53,55,11,117,110,105,50,68,52,70,50,68,52,67,11,117,110,105,50,
+68,52,70,50,68,51,69,11,117,110,105,50,68,52,70,50,68,53,57,11,117,110,105,
+50,68,52,70,50,68,53,67,11,117,110,105,50,68,52,70,50,68,54,52,11,117,110,
+105,50,68,53,52,50,68,53,67,11,117,110,105,50,68,53,57,50,68,52,70,11,117,
+110,105,50,68,53,57,50,68,53,67,11,117,110,105,50,68,53,66,50,68,53,67,11,
+117,110,105,50,68,53,67,50,68,53,57,11,117,110,105,50,68,53,51,50,68,53,67,
+11,117,110,105,50,68,54,50,50,68,53,67,11,117,110,105,50,68,52,67,50,68,53,
+67,7,117,110,105,48,51,48,49,7,117,110,105,48,51,48,50,7,117,110,105,48,51,
+48,52,7,117,110,105,48,51,48,54,7,117,110,105,48,51,48,55,7,117,110,105,48,
+51,50,51,7,117,110,105,48,51,51,49,11,117,110,105,50,68,52,68,50,68,52,68,
+11,117,110,105,50,68,52,68,50,68,52,70,11,117,110,105,50,68,52,70,50,68,52,
+68,11,117,110,105,50,68,52,70,50,68,52,70,7,117,110,105,50,48,48,68,4,110,
+117,108,108,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,46,0,0,0,
+2,0,5,0,0,0,61,0,1,0,62,0,62,0,3,0,63,0,86,0,1,0,87,0,95,0,3,0,96,0,100,0,
+1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,32,0,60,0,1,68,70,76,84,0,8,0,4,0,0,
+0,0,255,255,0,2,0,0,0,1,0,2,109,97,114,107,0,14,109,107,109,107,0,20,0,0,
+0,1,0,0,0,0,0,2,0,1,0,2,0,3,0,8,3,112,3,212,0,4,0,0,0,1,0,8,0,1,0,12,0,22,
+0,2,0,44,0,116,0,2,0,1,0,89,0,95,0,0,0,2,0,3,0,4,0,59,0,0,0,63,0,88,0,56,
+0,96,0,99,0,82,0,7,0,0,0,30,0,0,0,36,0,0,0,42,0,0,0,48,0,0,0,54,0,1,0,60,
+0,1,0,66,0,1,254,182,4,206,0,1,254,112,4,206,0,1,254,152,4,206,0,1,254,142,
+4,206,0,1,255,96,4,206,0,1,254,202,0,0,0,1,254,12,0,0,0,86,1,156,1,162,2,
+128,2,122,2,128,2,122,2,92,2,98,2,92,2,98,2,92,2,98,1,90,1,96,2,14,2,26,2,
+14,2,26,2,92,1,210,1,90,1,96,1,204,1,210,1,102,1,108,1,114,2,218,1,216,1,
+222,2,140,2,146,2,128,2,122,2,128,2,122,1,168,1,174,2,14,2,26,2,140,2,146,
+1,192,1,198,2,140,2,146,2,152,2,158,1,114,2,218,1,216,1,222,1,120,1,126,2,
+14,2,26,2,74,2,206,1,144,1,150,1,204,1,210,1,168,1,174,2,152,2,158,1,132,
+1,138,1,144,1,150,1,156,1,162,2,128,2,122,2,128,2,122,2,140,2,146,1,168,1,
+174,1,204,1,210,2,128,2,122,2,128,2,122,1,252,2,2,1,180,1,186,1,192,1,198,
+2,74,2,206,1,204,1,210,2,92,2,98,1,204,1,210,1,216,1,222,1,240,1,246,1,228,
+1,234,1,240,1,246,2,92,2,26,2,152,2,158,1,252,2,2,2,128,2,122,2,152,2,158,
+2,152,2,158,2,200,2,8,2,128,2,122,2,14,2,146,2,20,2,26,2,32,2,38,2,176,2,
+182,2,212,2,44,2,50,2,56,2,62,2,68,2,74,2,206,2,80,2,86,2,128,2,122,2,92,
+2,98,2,104,2,110,2,128,2,122,2,128,2,116,2,128,2,122,2,128,2,134,2,140,2,
+146,2,152,2,158,2,164,2,170,2,176,2,182,2,188,2,194,2,200,2,206,2,212,2,218,
+2,224,2,230,0,1,2,108,6,104,0,1,2,108,0,0,0,1,3,42,6,104,0,1,3,42,0,0,0,1,
+2,248,6,104,0,1,2,8,6,104,0,1,2,8,0,0,0,1,1,24,6,104,0,1,1,24,254,132,0,1,
+2,48,6,104,0,1,2,48,0,0,0,1,1,164,6,104,0,1,1,164,0,0,0,1,1,44,6,104,0,1,
+1,44,0,0,0,1,2,18,6,104,0,1,2,18,0,0,0,1,2,148,6,104,0,1,2,148,0,0,0,1,2,
+208,6,104,0,1,2,208,0,0,0,1,1,244,6,104,0,1,1,244,0,0,0,1,1,204,6,104,0,1,
+1,204,0,0,0,1,3,82,6,104,0,1,3,82,0,0,0,1,3,52,6,104,0,1,3,52,0,0,0,1,2,198,
+0,0,0,1,2,128,6,104,0,1,2,128,6,204,0,1,2,128,0,0,0,1,3,152,6,104,0,1,3,152,
+0,0,0,1,2,88,0,0,0,1,2,188,6,204,0,1,2,188,0,0,0,1,2,98,6,104,0,1,2,98,0,
+0,0,1,3,32,6,104,0,1,1,84,6,204,0,1,1,84,255,16,0,1,2,168,6,104,0,1,2,168,
+0,0,0,1,3,72,6,104,0,1,3,72,0,0,0,1,3,112,255,16,0,1,3,112,0,0,0,1,3,112,
+6,104,0,1,3,122,0,0,0,1,2,228,6,104,0,1,2,228,0,0,0,1,3,12,6,104,0,1,3,12,
+0,0,0,1,1,224,6,104,0,1,1,224,255,96,0,1,3,142,6,104,0,1,3,142,0,0,0,1,3,
+132,6,104,0,1,3,252,0,0,0,1,2,188,6,104,0,1,3,32,0,0,0,1,2,88,6,104,0,1,2,
+248,0,0,0,1,1,144,6,104,0,1,2,38,0,0,0,6,0,0,0,1,0,8,0,1,0,12,0,12,0,1,0,
+22,0,68,0,2,0,1,0,89,0,93,0,0,0,5,0,0,0,22,0,0,0,34,0,0,0,28,0,0,0,34,0,0,
+0,40,0,1,254,72,4,206,0,1,253,88,4,206,0,1,253,48,4,206,0,1,254,232,4,206,
+0,5,0,12,0,18,0,18,0,18,0,18,0,1,255,206,4,206,0,1,0,0,4,206,0,6,0,0,0,1,
+0,8,0,1,0,12,0,12,0,1,0,20,0,42,0,1,0,2,0,94,0,95,0,2,0,0,0,10,0,0,0,16,0,
+1,254,112,0,0,0,1,252,224,0,0,0,2,0,6,0,6,0,1,0,0,0,0,0,0,0,1,0,0,0,10,0,
+30,0,46,0,1,68,70,76,84,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,
+0,8,0,0,0,2,0,0,0,1,0,2,0,6,0,68,0,4,0,0,0,1,0,8,0,1,0,46,0,2,0,10,0,28,0,
+2,0,6,0,12,0,96,0,2,0,33,0,97,0,2,0,35,0,2,0,6,0,12,0,98,0,2,0,33,0,99,0,
+2,0,35,0,1,0,2,0,33,0,35,0,4,0,0,0,1,0,8,0,1,2,62,0,12,0,30,0,52,0,74,0,96,
+0,118,0,180,1,166,1,188,1,210,1,252,2,18,2,40,0,2,0,6,0,14,0,71,0,3,0,100,
+0,48,0,71,0,3,0,62,0,48,0,2,0,6,0,14,0,64,0,3,0,100,0,48,0,64,0,3,0,62,0,
+48,0,2,0,6,0,14,0,88,0,3,0,100,0,48,0,88,0,3,0,62,0,48,0,2,0,6,0,14,0,63,
+0,3,0,100,0,48,0,63,0,3,0,62,0,48,0,6,0,14,0,22,0,30,0,38,0,46,0,54,0,65,
+0,3,0,100,0,20,0,65,0,3,0,62,0,20,0,66,0,3,0,100,0,45,0,66,0,3,0,62,0,45,
+0,67,0,3,0,100,0,48,0,67,0,3,0,62,0,48,0,24,0,50,0,58,0,66,0,74,0,82,0,90,
+0,98,0,106,0,114,0,122,0,130,0,138,0,146,0,154,0,162,0,170,0,178,0,186,0,
+194,0,202,0,210,0,218,0,226,0,234,0,68,0,3,0,100,0,20,0,68,0,3,0,62,0,20,
+0,69,0,3,0,100,0,13,0,69,0,3,0,62,0,13,0,70,0,3,0,100,0,12,0,70,0,3,0,62,
+0,12,0,72,0,3,0,100,0,16,0,72,0,3,0,62,0,16,0,73,0,3,0,100,0,10,0,73,0,3,
+0,62,0,10,0,74,0,3,0,100,0,8,0,74,0,3,0,62,0,8,0,75,0,3,0,100,0,43,0,75,0,
+3,0,62,0,43,0,76,0,3,0,100,0,32,0,76,0,3,0,62,0,32,0,77,0,3,0,100,0,18,0,
+77,0,3,0,62,0,18,0,78,0,3,0,100,0,45,0,78,0,3,0,62,0,45,0,79,0,3,0,100,0,
+48,0,79,0,3,0,62,0,48,0,80,0,3,0,100,0,56,0,80,0,3,0,62,0,56,0,2,0,6,0,14,
+0,86,0,3,0,100,0,48,0,86,0,3,0,62,0,48,0,2,0,6,0,14,0,81,0,3,0,100,0,48,0,
+81,0,3,0,62,0,48,0,4,0,10,0,18,0,26,0,34,0,82,0,3,0,100,0,35,0,82,0,3,0,62,
+0,35,0,83,0,3,0,100,0,48,0,83,0,3,0,62,0,48,0,2,0,6,0,14,0,84,0,3,0,100,0,
+48,0,84,0,3,0,62,0,48,0,2,0,6,0,14,0,85,0,3,0,100,0,45,0,85,0,3,0,62,0,45,
+0,2,0,6,0,14,0,87,0,3,0,100,0,48,0,87,0,3,0,62,0,48,0,1,0,12,0,16,0,20,0,
+32,0,33,0,34,0,35,0,39,0,40,0,45,0,47,0,48,0,54,};
+#endif
@@ -0,0 +1,286 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansUgaritic_Regular_ttf_size = 6772;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansUgaritic_Regular_ttf");
+asm(".type fz_font_NotoSansUgaritic_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansUgaritic_Regular_ttf, 6772");
+asm(".balign 64");
+asm("fz_font_NotoSansUgaritic_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansUgaritic-Regular.ttf\"");
+#else
+const int fz_font_NotoSansUgaritic_Regular_ttf_size = 6772;
+const char fz_font_NotoSansUgaritic_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,121,126,108,139,0,0,1,56,0,0,0,96,
+99,109,97,112,1,13,188,106,0,0,2,36,0,0,1,216,103,97,115,112,0,7,0,7,0,0,
+26,104,0,0,0,12,103,108,121,102,198,191,102,243,0,0,4,68,0,0,15,248,104,101,
+97,100,9,185,230,46,0,0,0,188,0,0,0,54,104,104,101,97,16,240,8,227,0,0,0,
+244,0,0,0,36,104,109,116,120,248,148,27,33,0,0,1,152,0,0,0,140,108,111,99,
+97,64,239,68,240,0,0,3,252,0,0,0,72,109,97,120,112,0,43,0,98,0,0,1,24,0,0,
+0,32,110,97,109,101,142,8,185,227,0,0,20,60,0,0,6,12,112,111,115,116,255,
+105,0,102,0,0,26,72,0,0,0,32,0,1,0,0,0,1,5,31,247,252,147,149,95,15,60,245,
+0,11,8,0,0,0,0,0,205,117,205,33,0,0,0,0,210,40,204,10,0,193,252,244,10,59,
+5,242,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,5,242,252,244,0,0,11,8,0,193,0,195,
+10,59,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,1,0,0,0,35,0,97,0,7,0,0,0,0,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,7,79,1,144,0,5,0,0,5,154,5,51,0,0,
+1,31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,0,0,2,0,
+0,0,0,0,0,0,0,0,0,128,71,79,79,71,0,64,0,0,255,255,5,242,252,244,0,0,5,242,
+3,12,0,0,0,1,0,0,0,0,4,37,5,152,0,0,0,32,0,0,4,205,0,193,0,0,0,0,4,20,0,0,
+2,20,0,0,7,217,0,205,3,84,0,205,3,84,0,205,10,35,0,205,9,4,0,205,6,164,0,
+205,3,84,0,205,10,35,0,205,7,129,0,205,8,98,0,205,3,123,0,225,9,4,0,205,5,
+106,0,205,8,250,0,205,8,98,0,205,8,98,0,205,8,98,2,70,9,4,0,205,8,98,0,205,
+5,8,0,205,5,14,0,205,11,8,0,205,5,35,0,205,7,76,0,205,8,98,0,205,8,98,0,205,
+8,98,0,205,10,127,0,205,11,0,0,205,10,127,0,205,7,217,0,205,0,0,0,2,0,3,0,
+1,0,0,0,20,0,3,0,10,0,0,0,84,0,4,0,64,0,0,0,12,0,8,0,2,0,4,0,0,0,13,0,32,
+0,160,254,255,255,255,0,0,0,0,0,13,0,32,0,160,254,255,255,255,0,1,255,245,
+255,227,255,99,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,1,132,0,0,0,0,
+0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,13,0,0,0,13,0,0,0,2,0,0,0,32,0,0,0,
+32,0,0,0,3,0,0,0,160,0,0,0,160,0,0,0,3,0,0,254,255,0,0,254,255,0,0,0,1,0,
+1,3,128,0,1,3,128,0,0,0,34,0,1,3,129,0,1,3,131,0,0,0,4,0,1,3,132,0,1,3,132,
+0,0,0,11,0,1,3,133,0,1,3,133,0,0,0,13,0,1,3,134,0,1,3,134,0,0,0,31,0,1,3,
+135,0,1,3,135,0,0,0,14,0,1,3,136,0,1,3,136,0,0,0,8,0,1,3,137,0,1,3,138,0,
+0,0,15,0,1,3,139,0,1,3,139,0,0,0,33,0,1,3,140,0,1,3,140,0,0,0,17,0,1,3,141,
+0,1,3,141,0,0,0,12,0,1,3,142,0,1,3,142,0,0,0,29,0,1,3,143,0,1,3,143,0,0,0,
+27,0,1,3,144,0,1,3,144,0,0,0,7,0,1,3,145,0,1,3,145,0,0,0,25,0,1,3,146,0,1,
+3,146,0,0,0,24,0,1,3,147,0,1,3,147,0,0,0,23,0,1,3,148,0,1,3,150,0,0,0,19,
+0,1,3,151,0,1,3,151,0,0,0,32,0,1,3,152,0,1,3,152,0,0,0,26,0,1,3,153,0,1,3,
+153,0,0,0,30,0,1,3,154,0,1,3,154,0,0,0,18,0,1,3,155,0,1,3,155,0,0,0,22,0,
+1,3,156,0,1,3,156,0,0,0,28,0,1,3,157,0,1,3,157,0,0,0,9,0,1,3,159,0,1,3,159,
+0,0,0,10,0,0,0,21,0,21,0,21,0,21,0,95,0,124,0,178,0,235,1,72,1,236,2,4,2,
+111,2,182,2,253,3,37,3,112,3,215,4,31,4,59,4,109,4,160,4,210,5,43,5,77,5,
+139,5,218,6,19,6,71,6,147,6,189,6,237,7,58,7,151,7,211,7,252,0,2,0,193,0,
+0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,
+253,135,5,182,250,74,104,4,230,0,0,1,0,205,0,199,7,12,5,227,0,40,0,0,1,6,
+2,3,4,5,21,4,4,7,54,53,6,4,7,54,55,52,39,22,23,2,3,22,51,54,55,6,2,3,22,23,
+38,39,22,23,2,3,22,51,54,5,20,51,83,25,1,40,1,111,254,87,254,17,145,15,190,
+254,253,94,15,1,22,128,206,89,122,117,94,111,118,48,89,27,68,81,4,24,115,
+222,85,117,117,95,112,5,227,139,254,16,254,218,48,24,47,52,107,64,107,90,
+46,112,76,140,89,130,118,95,55,2,187,1,12,15,1,28,128,254,6,254,149,16,11,
+98,95,44,40,2,125,1,8,15,1,0,0,1,0,205,255,27,2,135,5,227,0,12,0,0,1,6,2,
+2,3,35,10,2,39,22,23,50,2,135,56,62,39,13,53,42,52,69,56,102,109,114,5,227,
+208,254,70,253,139,254,55,2,114,2,13,1,128,201,25,1,0,1,0,205,255,27,2,135,
+5,227,0,30,0,0,1,7,6,7,54,55,7,6,3,35,38,2,39,22,23,38,38,39,22,23,38,38,
+39,22,51,50,55,7,6,7,54,2,135,45,91,48,96,88,48,99,47,54,29,88,77,90,93,30,
+76,77,90,93,30,76,77,138,111,95,98,45,91,48,96,3,186,110,217,245,2,17,117,
+238,254,237,172,1,39,163,14,4,155,249,167,14,4,155,249,167,20,20,110,217,
+245,2,0,1,0,205,0,233,9,86,2,164,0,30,0,0,1,23,22,23,38,39,4,4,5,21,7,4,5,
+54,55,6,4,7,54,55,6,4,7,54,53,52,39,23,22,23,38,2,246,109,214,249,2,17,1,
+26,1,192,1,93,212,254,77,254,80,15,3,171,254,245,133,15,3,171,254,245,133,
+20,20,109,214,249,2,2,164,46,90,48,92,92,83,83,29,53,12,22,161,112,72,33,
+86,65,112,72,33,86,65,140,110,94,99,46,90,48,92,0,0,1,0,205,254,74,8,55,5,
+242,0,53,0,0,19,22,4,23,38,2,3,22,51,50,55,6,2,7,23,62,3,55,23,0,3,23,18,
+19,7,38,1,38,39,7,3,54,55,23,6,7,22,23,7,38,36,39,54,55,38,39,6,4,7,54,53,
+52,205,59,1,251,213,22,55,71,106,110,110,116,53,58,19,123,64,158,194,233,
+140,43,254,227,200,81,220,184,43,162,254,202,222,100,127,18,91,82,41,110,
+109,111,135,39,115,254,221,118,99,136,11,22,237,254,30,69,9,3,96,19,74,25,
+203,1,38,1,6,22,22,188,254,164,244,14,64,157,197,243,150,31,254,59,254,138,
+157,254,82,254,220,31,174,1,93,250,98,20,254,161,87,89,24,247,177,148,242,
+30,109,229,75,74,123,172,238,41,98,21,117,94,114,0,0,7,0,205,255,27,5,215,
+5,227,0,11,0,25,0,39,0,53,0,67,0,82,0,96,0,0,1,2,2,3,35,10,2,39,22,51,50,
+19,55,54,55,23,6,6,7,22,22,23,7,39,38,3,55,54,55,23,6,6,7,22,22,23,7,39,38,
+3,55,54,55,23,6,6,7,22,22,23,7,39,38,1,55,54,55,23,6,6,7,22,22,23,7,39,38,
+3,55,54,55,23,6,6,7,22,22,23,7,39,38,38,3,55,54,55,23,6,6,7,22,22,23,7,39,
+38,4,68,76,74,20,54,33,53,66,67,109,110,103,155,58,176,100,35,46,65,34,34,
+65,46,35,113,140,81,58,176,100,35,46,65,34,34,65,46,35,113,140,81,126,82,
+126,35,46,65,34,34,65,46,35,113,140,252,22,58,176,100,34,46,65,34,34,65,46,
+34,114,136,84,58,176,100,34,46,65,34,34,65,46,34,114,102,70,48,126,82,126,
+34,46,65,34,34,65,46,34,114,136,5,227,254,243,253,23,253,46,2,7,2,59,1,146,
+244,27,252,185,49,144,88,23,72,124,62,60,126,72,29,103,127,253,241,49,144,
+88,23,72,124,62,60,125,73,28,102,127,4,203,104,66,110,22,72,124,62,60,126,
+72,29,103,127,253,239,49,144,88,23,72,124,62,60,126,72,29,103,123,253,245,
+49,144,88,23,72,124,62,60,125,73,28,102,92,58,4,180,104,66,110,22,72,124,
+62,60,126,72,29,103,123,0,1,0,205,1,68,2,135,3,186,0,10,0,0,1,7,6,3,35,38,
+2,39,22,51,50,2,135,48,99,47,54,29,88,77,138,111,95,3,186,117,238,254,237,
+172,1,39,163,20,0,1,0,205,0,233,9,86,5,227,0,62,0,0,1,6,2,3,22,23,38,39,22,
+23,2,39,22,51,54,55,6,2,3,4,5,21,7,4,5,54,55,6,4,7,54,55,6,4,7,54,53,52,39,
+23,22,23,2,39,22,51,54,55,6,2,3,22,23,38,39,22,22,23,2,39,22,51,54,5,20,46,
+86,27,100,89,2,17,124,154,89,107,117,94,111,118,44,85,27,1,32,1,169,212,254,
+77,254,80,15,3,171,254,245,133,15,3,171,254,245,133,19,19,70,173,80,91,109,
+117,94,111,118,43,88,28,95,73,2,17,64,146,93,91,110,117,95,112,5,227,126,
+253,253,254,181,26,17,92,92,37,39,2,144,237,15,1,28,118,254,20,254,195,66,
+33,53,12,22,161,112,72,33,86,65,112,72,33,86,65,145,113,125,93,31,85,30,2,
+176,242,15,1,28,113,253,252,254,170,30,14,92,92,27,61,29,2,176,246,15,1,0,
+3,0,205,255,27,6,180,5,227,0,11,0,23,0,36,0,0,1,2,2,3,35,10,2,39,22,23,50,
+37,2,2,3,35,10,2,39,22,23,50,37,6,2,2,3,35,10,2,39,22,23,50,4,158,76,74,20,
+54,33,53,66,67,102,110,114,2,139,76,75,19,53,42,52,69,56,102,109,114,252,
+72,56,62,39,13,53,42,52,69,56,102,109,114,5,227,254,243,253,23,253,46,2,7,
+2,59,1,146,244,25,1,26,254,243,252,246,253,79,2,114,2,13,1,128,201,25,1,26,
+208,254,70,253,139,254,55,2,114,2,13,1,128,201,25,1,0,3,0,205,255,139,7,150,
+5,115,0,11,0,24,0,37,0,0,19,54,53,52,39,22,4,4,5,21,4,4,1,54,53,52,39,22,
+4,4,5,21,12,2,3,54,53,52,39,22,4,4,5,21,12,2,205,27,27,246,1,130,2,61,2,20,
+253,50,253,21,254,240,27,27,250,1,179,2,89,1,195,254,68,253,131,254,66,210,
+27,27,252,1,145,2,39,2,21,254,68,253,131,254,66,3,184,120,104,110,109,68,
+63,53,35,54,20,74,253,158,120,104,110,108,69,68,53,29,53,12,40,61,253,176,
+120,104,110,109,70,64,51,35,53,12,40,61,0,1,0,225,255,27,2,154,5,227,0,19,
+0,0,1,6,2,7,54,55,2,3,35,2,2,39,22,23,38,2,39,22,51,50,2,154,41,88,35,77,
+87,114,81,47,35,111,53,83,78,36,88,37,140,108,94,5,227,99,254,174,187,6,14,
+254,242,252,162,1,127,2,103,134,19,3,205,1,88,77,20,0,0,1,0,205,255,10,8,
+55,5,242,0,41,0,0,19,22,5,38,2,39,22,51,50,55,6,2,7,23,62,3,55,23,0,3,23,
+18,19,7,38,1,38,39,7,2,3,35,2,3,6,4,7,54,53,52,205,99,2,161,26,59,56,106,
+110,110,116,47,57,20,117,64,158,194,233,140,43,254,227,200,81,220,184,43,
+162,254,202,222,100,121,24,13,53,33,28,143,253,253,123,9,3,96,31,86,228,1,
+64,210,22,22,169,254,144,243,14,64,157,197,243,150,31,254,59,254,138,157,
+254,82,254,220,31,174,1,93,250,98,19,254,143,254,46,1,245,1,53,24,102,33,
+117,94,114,0,0,2,0,205,255,27,4,158,5,227,0,30,0,61,0,0,1,7,6,7,54,55,7,6,
+3,35,38,2,39,22,23,38,38,39,22,23,38,38,39,22,51,50,55,7,6,7,54,37,7,6,7,
+54,55,7,6,3,35,38,2,39,22,23,38,2,39,22,23,38,2,39,22,51,50,55,7,6,7,54,2,
+135,45,91,48,96,88,48,99,47,54,29,88,77,90,93,30,76,77,90,93,30,76,77,138,
+111,95,98,45,91,48,96,2,111,46,91,48,93,92,49,98,48,53,29,84,82,90,94,33,
+84,67,90,94,33,84,67,140,110,94,99,46,91,48,93,3,186,110,217,245,2,17,117,
+238,254,237,172,1,39,163,14,4,155,249,167,14,4,155,249,167,20,20,110,217,
+245,2,17,110,217,245,2,17,117,232,254,231,167,1,34,173,14,4,172,1,4,139,14,
+4,172,1,4,139,20,20,110,217,245,2,0,0,3,0,205,255,10,8,45,5,242,0,13,0,25,
+0,34,0,0,19,55,0,1,23,0,3,23,18,19,7,38,1,38,1,2,2,3,35,10,2,39,22,23,50,
+23,22,22,23,2,1,39,18,17,205,145,1,118,1,60,43,254,227,200,81,220,184,43,
+143,254,153,225,4,236,76,75,19,53,42,50,66,62,102,110,114,215,120,187,115,
+243,254,233,45,147,2,152,146,1,115,1,85,31,254,59,254,138,157,254,82,254,
+220,31,154,1,148,252,3,175,254,243,252,246,253,79,2,102,2,7,1,125,222,25,
+1,92,70,51,2,254,176,253,121,14,2,143,1,115,0,1,0,205,1,162,7,150,3,92,0,
+12,0,0,19,54,53,52,39,22,4,4,5,21,12,2,205,27,27,250,1,179,2,89,1,195,254,
+68,253,131,254,66,1,162,120,104,110,108,69,68,53,29,53,12,40,61,0,2,0,205,
+0,207,7,150,4,145,0,12,0,25,0,0,19,54,53,52,39,22,4,4,5,21,12,2,3,54,53,52,
+39,22,4,4,5,21,12,2,205,27,27,250,1,179,2,89,1,195,254,68,253,131,254,66,
+210,27,27,250,1,179,2,89,1,195,254,68,253,131,254,66,2,215,120,104,110,108,
+69,68,53,29,53,12,40,61,253,191,120,104,110,108,69,68,53,29,53,12,40,61,0,
+2,2,70,255,35,6,23,5,236,0,12,0,25,0,0,1,22,51,50,55,6,2,2,3,35,10,2,37,22,
+51,50,55,6,2,2,3,35,10,2,4,92,120,104,110,109,63,65,53,41,53,14,42,58,253,
+180,120,104,110,108,66,67,53,33,53,12,40,60,5,236,27,27,226,254,133,253,229,
+253,175,2,0,2,111,1,148,198,27,27,237,254,103,253,191,253,254,1,186,2,124,
+1,189,0,0,1,0,205,255,10,8,55,5,242,0,25,0,0,19,22,4,5,62,3,55,23,0,3,23,
+18,19,7,38,1,38,39,6,4,7,54,53,52,205,65,2,168,1,65,64,158,194,233,140,43,
+254,227,200,81,220,184,43,162,254,202,222,100,254,253,79,110,9,3,96,21,96,
+36,64,157,197,243,150,31,254,59,254,138,157,254,82,254,220,31,174,1,93,250,
+98,37,134,32,117,94,114,0,0,4,0,205,252,244,7,150,5,115,0,11,0,24,0,37,0,
+48,0,0,19,54,53,52,39,22,4,4,5,21,4,4,1,54,53,52,39,22,4,4,5,21,12,2,3,54,
+53,52,39,22,4,4,5,21,12,2,5,7,6,3,35,38,2,39,22,51,50,205,27,27,246,1,130,
+2,61,2,20,253,50,253,21,254,240,27,27,250,1,179,2,89,1,195,254,68,253,131,
+254,66,210,27,27,252,1,145,2,39,2,21,254,68,253,131,254,66,1,120,49,98,48,
+53,29,84,82,138,111,95,3,184,120,104,110,109,68,63,53,35,54,20,74,253,158,
+120,104,110,108,69,68,53,29,53,12,40,61,253,176,120,104,110,109,70,64,51,
+35,53,12,40,61,90,117,232,254,231,167,1,34,173,20,0,0,1,0,205,255,10,4,59,
+5,242,0,13,0,0,19,55,0,1,23,0,3,23,18,19,7,38,1,38,205,145,1,118,1,60,43,
+254,227,200,81,220,184,43,143,254,153,225,2,152,146,1,115,1,85,31,254,59,
+254,138,157,254,82,254,220,31,154,1,148,252,0,1,0,205,255,27,4,66,5,227,0,
+35,0,0,1,22,51,50,55,6,6,2,7,35,2,3,35,2,2,39,35,38,2,39,39,22,51,50,55,7,
+6,2,7,22,51,50,55,38,2,39,2,137,126,95,92,128,61,59,53,24,40,105,78,47,17,
+87,80,38,40,73,51,32,126,94,92,128,31,52,70,38,106,87,84,110,34,74,52,5,227,
+31,31,159,198,254,254,149,254,205,253,103,1,0,1,228,232,247,1,44,131,86,31,
+31,83,134,254,230,235,24,25,208,1,49,136,0,0,3,0,205,255,10,10,59,5,242,0,
+13,0,26,0,39,0,0,1,55,0,1,23,0,3,23,18,19,7,38,1,38,37,54,53,52,39,22,4,4,
+5,21,12,2,3,54,53,52,39,22,4,4,5,21,12,2,6,205,145,1,118,1,60,43,254,227,
+200,81,220,184,43,143,254,153,225,249,148,27,27,250,1,179,2,89,1,195,254,
+68,253,131,254,66,210,27,27,250,1,179,2,89,1,195,254,68,253,131,254,66,2,
+152,146,1,115,1,85,31,254,59,254,138,157,254,82,254,220,31,154,1,148,252,
+163,120,104,110,108,69,68,53,29,53,12,40,61,253,191,120,104,110,108,69,68,
+53,29,53,12,40,61,0,0,2,0,205,255,27,4,86,5,227,0,25,0,29,0,0,19,1,38,38,
+39,22,23,50,55,6,7,55,23,3,2,3,22,23,7,38,39,3,35,3,38,38,5,38,39,7,205,1,
+184,19,49,45,102,110,114,117,43,28,177,29,231,35,18,140,144,29,132,131,13,
+53,34,168,254,1,144,7,16,75,2,145,1,71,132,227,164,25,1,26,153,171,138,41,
+254,242,254,228,254,131,184,165,41,102,108,254,118,1,220,138,211,76,91,145,
+99,0,0,1,0,205,255,10,6,127,5,242,0,23,0,0,1,22,22,23,6,0,1,23,7,38,1,38,
+39,55,0,1,23,0,3,23,18,23,0,53,4,217,113,189,120,60,254,226,254,212,66,43,
+143,254,153,225,108,145,1,118,1,60,43,254,227,200,67,163,148,1,10,5,109,67,
+54,2,82,253,167,253,77,107,31,154,1,148,252,100,146,1,115,1,85,31,254,59,
+254,138,128,254,186,249,4,149,233,0,0,1,0,205,0,213,7,150,5,227,0,41,0,0,
+1,6,2,3,22,5,2,3,22,51,54,55,6,2,3,5,2,3,22,51,54,55,6,2,3,5,21,12,2,7,54,
+53,52,39,22,23,2,39,22,51,54,3,0,45,84,28,174,1,28,92,117,117,95,112,116,
+49,87,26,1,213,97,117,117,94,111,118,50,93,23,1,19,254,68,253,131,254,66,
+210,27,27,175,147,91,108,117,94,111,5,227,121,254,18,254,182,31,28,2,216,
+1,6,15,1,28,132,253,220,254,181,37,3,4,1,6,15,1,28,132,253,180,254,179,18,
+53,12,40,61,57,120,104,110,108,48,30,2,163,241,15,1,0,1,0,205,255,35,6,23,
+5,236,0,21,0,0,19,4,5,38,39,22,51,50,55,6,2,2,3,35,2,3,6,4,7,54,53,52,205,
+1,112,2,94,26,37,120,104,110,109,63,65,53,41,53,27,59,218,253,158,165,22,
+5,117,70,91,143,137,27,27,226,254,133,253,229,253,175,3,170,1,144,28,95,38,
+136,110,95,0,1,0,205,255,117,7,150,3,184,0,22,0,0,5,38,38,39,54,1,4,4,7,54,
+53,52,39,4,4,5,1,23,5,5,21,5,0,3,70,55,123,105,150,1,248,254,187,254,39,206,
+27,27,1,8,1,254,1,172,1,176,29,254,248,1,82,254,78,253,188,139,113,150,75,
+54,1,49,19,64,57,120,104,110,108,75,73,33,1,17,39,249,23,53,16,253,211,0,
+0,3,0,205,1,121,9,178,5,57,0,20,0,31,0,42,0,0,1,22,4,23,23,4,4,7,54,55,6,
+4,7,54,53,52,39,22,4,23,38,5,22,4,23,21,4,4,7,54,53,52,3,22,4,23,21,6,4,7,
+54,53,52,6,109,128,1,241,210,2,254,249,254,39,101,12,6,201,254,166,80,22,
+22,90,1,86,197,4,250,80,138,1,253,190,254,249,254,39,101,22,22,128,1,241,
+210,232,254,20,111,22,4,51,52,117,29,48,37,110,47,80,80,35,88,37,134,112,
+95,99,36,91,37,79,173,54,119,26,47,37,110,47,134,112,95,2,107,52,117,29,47,
+33,110,52,134,112,95,0,0,3,0,205,1,121,10,51,5,57,0,20,0,41,0,52,0,0,1,22,
+4,23,21,6,4,7,54,55,6,4,7,54,53,52,39,22,4,23,38,3,22,4,23,21,4,4,7,54,55,
+6,4,7,54,53,52,39,22,4,23,38,1,22,4,23,23,4,4,7,54,53,52,3,174,141,1,244,
+195,234,254,19,109,16,4,253,254,101,93,22,22,107,1,176,219,1,20,139,1,249,
+192,255,0,254,36,104,16,4,251,254,101,95,22,22,111,1,193,198,1,3,44,128,1,
+241,210,2,254,249,254,39,101,21,5,57,56,115,27,47,33,111,51,90,93,41,98,44,
+134,112,95,99,43,109,35,91,254,88,55,117,27,47,36,110,48,90,93,40,99,44,134,
+112,95,99,45,112,31,92,1,98,52,117,29,48,37,110,47,131,112,97,0,3,0,205,1,
+121,9,178,5,57,0,10,0,21,0,32,0,0,1,22,4,23,21,4,4,7,54,53,52,5,22,4,23,21,
+4,4,7,54,53,52,3,22,4,23,21,6,4,7,54,53,52,4,12,159,4,16,247,252,178,253,
+253,85,22,252,171,138,1,253,190,254,249,254,39,101,22,22,128,1,241,210,232,
+254,20,111,22,4,51,31,140,27,48,94,76,24,134,112,95,159,54,119,26,47,37,110,
+47,134,112,95,2,107,52,117,29,47,33,110,52,134,112,95,0,1,0,205,0,199,7,12,
+2,164,0,20,0,0,1,22,4,5,21,4,4,7,54,53,6,4,7,54,55,52,39,22,4,23,38,2,213,
+146,2,59,1,106,254,87,254,17,145,15,190,254,253,94,15,1,22,86,1,39,167,4,
+2,164,54,92,24,47,52,107,64,107,90,46,112,76,140,89,130,118,66,103,24,98,
+0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,36,0,94,0,3,0,1,
+4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,0,3,0,1,4,9,0,4,0,36,0,94,0,
+3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,32,0,248,0,3,0,1,4,9,0,7,0,68,
+1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,9,0,9,0,40,1,134,0,3,0,1,4,9,0,10,
+0,96,1,174,0,3,0,1,4,9,0,11,0,62,2,14,0,3,0,1,4,9,0,12,0,60,2,76,0,3,0,1,
+4,9,0,13,2,150,2,136,0,3,0,1,4,9,0,14,0,52,5,30,0,67,0,111,0,112,0,121,0,
+114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,
+0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,
+82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,
+0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,
+85,0,103,0,97,0,114,0,105,0,116,0,105,0,99,0,82,0,101,0,103,0,117,0,108,0,
+97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,
+97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,
+0,97,0,110,0,115,0,32,0,85,0,103,0,97,0,114,0,105,0,116,0,105,0,99,0,86,0,
+101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,
+0,78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,85,0,103,0,97,0,114,0,105,
+0,116,0,105,0,99,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,
+116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,
+97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,
+32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,
+0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,
+0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,
+0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,
+0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,
+110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,
+101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,
+0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,
+111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,
+0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,
+0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,
+73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,
+0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,
+0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,
+0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,
+120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,
+0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,
+0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,
+0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,
+0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,3,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,};
+#endif
@@ -0,0 +1,2616 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansVai_Regular_ttf_size = 64292;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansVai_Regular_ttf");
+asm(".type fz_font_NotoSansVai_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansVai_Regular_ttf, 64292");
+asm(".balign 64");
+asm("fz_font_NotoSansVai_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansVai-Regular.ttf\"");
+#else
+const int fz_font_NotoSansVai_Regular_ttf_size = 64292;
+const char fz_font_NotoSansVai_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,138,231,107,118,0,0,1,56,0,0,0,96,
+99,109,97,112,90,91,76,41,0,0,6,88,0,0,0,84,103,97,115,112,0,22,0,35,0,0,
+251,20,0,0,0,16,103,108,121,102,156,156,39,186,0,0,9,16,0,0,235,242,104,101,
+97,100,6,168,64,236,0,0,0,188,0,0,0,54,104,104,101,97,18,233,10,11,0,0,0,
+244,0,0,0,36,104,109,116,120,45,79,140,46,0,0,1,152,0,0,4,192,108,111,99,
+97,135,175,77,73,0,0,6,172,0,0,2,98,109,97,120,112,1,58,0,189,0,0,1,24,0,
+0,0,32,110,97,109,101,137,151,182,184,0,0,245,4,0,0,5,238,112,111,115,116,
+255,105,0,102,0,0,250,244,0,0,0,32,0,1,0,0,0,1,5,31,136,178,193,9,95,15,60,
+245,0,11,8,0,0,0,0,0,203,6,37,40,0,0,0,0,210,40,204,10,0,6,254,180,10,84,
+6,233,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,11,31,0,6,0,19,10,
+84,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,48,0,1,0,0,1,48,0,188,0,9,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,6,16,1,144,0,5,0,0,5,154,5,51,0,0,1,
+31,5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,0,0,16,0,0,0,0,
+0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,
+88,0,0,0,1,0,0,0,0,4,0,5,154,0,0,0,32,0,0,4,205,0,193,0,0,0,0,4,20,0,0,2,
+20,0,0,5,51,0,45,5,141,0,90,6,59,0,68,6,219,0,68,6,219,0,68,7,14,0,68,8,168,
+0,68,5,225,0,90,5,225,0,90,5,88,0,68,5,88,0,68,5,88,0,68,4,90,0,113,4,90,
+0,113,7,78,0,113,7,100,0,113,9,145,0,113,9,145,0,113,6,207,0,113,6,207,0,
+113,5,172,0,68,5,143,0,68,5,154,0,227,5,156,0,227,5,154,0,227,5,154,0,227,
+8,135,0,47,8,135,0,47,6,59,0,158,6,59,0,158,11,31,0,227,8,82,0,227,6,82,0,
+90,5,203,0,66,6,45,0,45,8,135,0,47,6,207,0,113,7,135,0,113,7,115,0,113,3,
+154,0,158,6,188,0,113,7,35,0,113,4,219,0,227,6,250,0,72,5,80,0,158,5,162,
+0,158,4,240,0,90,5,43,0,45,6,41,0,90,6,92,0,227,5,211,0,135,6,104,0,113,6,
+193,0,113,5,74,0,227,5,74,0,227,3,121,0,154,3,121,0,14,4,238,0,68,7,61,0,
+90,6,27,0,158,6,170,0,158,5,117,0,68,6,47,0,68,4,217,0,158,7,63,0,68,7,63,
+0,68,7,63,0,68,4,57,0,135,4,57,0,135,7,154,0,113,6,57,0,180,5,2,0,158,5,143,
+0,68,4,94,0,115,5,190,0,47,5,236,0,47,7,109,0,113,7,109,0,113,6,104,0,113,
+7,117,0,113,6,244,0,113,6,174,0,135,7,145,0,227,7,39,0,227,5,117,0,45,5,45,
+0,68,5,252,0,113,4,219,0,227,4,98,0,90,5,223,0,158,5,166,0,113,5,166,0,113,
+6,27,0,113,7,178,0,113,5,158,0,227,5,158,0,227,7,6,0,227,7,6,0,227,7,86,0,
+135,7,86,0,135,6,254,0,135,7,63,0,68,5,201,0,111,6,37,0,70,5,111,0,70,6,123,
+0,68,5,96,0,90,6,137,0,68,5,242,0,158,7,150,0,133,5,219,0,113,4,233,0,135,
+7,80,0,68,5,111,0,68,5,172,0,68,5,111,0,68,5,176,0,68,5,238,0,68,4,135,0,
+113,4,135,0,113,5,227,0,227,7,25,0,68,4,203,0,135,6,88,0,68,4,190,0,180,5,
+207,0,133,5,207,0,133,5,129,0,227,5,129,0,227,7,109,0,113,7,109,0,113,6,219,
+0,113,6,219,0,113,6,242,0,158,7,129,0,113,6,61,0,158,6,104,0,158,3,254,0,
+158,5,182,0,90,5,31,0,158,5,31,0,158,6,145,0,227,4,4,0,227,5,219,0,113,6,
+141,0,113,5,96,0,68,7,25,0,68,7,240,0,113,5,154,0,158,6,66,0,113,6,111,0,
+113,6,37,0,113,5,186,0,45,5,166,0,113,6,59,0,113,6,82,0,90,7,14,0,68,6,0,
+0,158,6,61,0,158,5,207,0,90,5,207,0,90,5,207,0,90,6,211,0,68,7,199,0,68,4,
+63,0,113,4,195,0,113,6,123,0,227,7,199,0,90,5,94,0,158,5,94,0,158,5,94,0,
+158,5,94,0,158,5,172,0,68,5,172,0,68,5,172,0,68,5,172,0,68,6,43,0,158,6,43,
+0,158,6,43,0,158,6,43,0,158,4,240,0,90,4,90,0,113,4,90,0,113,5,96,0,90,6,
+20,0,227,4,229,0,203,6,92,0,227,6,180,0,90,6,180,0,90,6,199,0,158,6,178,0,
+158,6,45,0,180,6,199,0,158,7,199,0,68,7,199,0,68,5,158,0,6,5,158,0,6,6,154,
+0,113,6,154,0,113,6,135,0,45,6,135,0,45,4,180,0,68,4,180,0,68,5,102,0,227,
+6,145,0,113,5,102,0,227,6,182,0,113,4,76,0,158,4,76,0,111,5,231,0,68,5,231,
+0,68,5,209,0,68,6,127,0,90,5,209,0,68,6,127,0,90,4,92,0,68,5,121,0,68,5,121,
+0,68,4,121,0,158,5,227,0,227,8,100,0,180,6,74,0,68,4,231,0,135,4,135,0,113,
+7,166,0,68,5,168,0,113,10,12,0,135,6,6,0,135,6,23,0,158,7,190,0,68,5,231,
+0,68,6,16,0,47,4,150,0,135,5,82,0,90,5,25,0,227,5,229,0,227,7,25,0,68,7,25,
+0,68,7,25,0,68,6,252,0,158,6,252,0,158,5,227,0,227,5,227,0,227,6,143,0,90,
+7,51,0,90,6,123,0,135,6,123,0,135,4,225,0,135,4,225,0,135,4,225,0,135,4,225,
+0,135,7,61,0,90,7,61,0,90,7,61,0,90,7,61,0,90,5,145,0,90,6,156,0,90,6,135,
+0,90,6,94,0,90,5,166,0,113,5,166,0,113,5,166,0,113,5,166,0,113,5,166,0,113,
+7,51,0,227,4,139,0,90,6,14,0,113,6,150,0,113,5,20,0,90,3,197,0,135,4,141,
+0,135,5,240,0,135,10,197,0,90,6,45,0,180,7,217,0,135,3,238,0,158,6,227,0,
+113,7,109,0,68,5,133,0,227,5,172,0,68,5,209,0,68,5,240,0,113,8,160,0,180,
+7,80,0,68,5,199,0,45,6,156,0,68,7,90,0,68,4,250,0,90,4,195,0,90,2,102,0,227,
+5,76,0,135,5,84,0,113,5,59,0,203,5,49,0,203,4,94,0,90,5,61,0,66,4,180,0,158,
+4,250,0,90,7,45,0,68,4,88,0,113,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,72,0,0,0,14,
+0,8,0,2,0,6,0,0,0,13,0,32,0,160,166,43,254,255,255,255,0,0,0,0,0,13,0,32,
+0,160,165,0,254,255,255,255,0,1,255,245,255,227,255,99,91,4,1,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,21,0,21,0,21,0,129,1,2,1,105,1,165,1,243,
+2,154,3,97,3,155,3,245,4,41,4,103,4,122,4,190,5,12,5,89,5,171,6,87,7,35,7,
+112,7,222,8,30,8,89,8,115,8,149,8,190,8,235,9,94,10,2,10,74,10,142,11,54,
+11,160,11,194,12,33,12,161,13,101,13,184,14,43,14,137,15,2,15,168,16,98,16,
+117,16,251,17,126,18,34,18,142,18,237,19,70,19,189,20,89,20,211,21,93,21,
+182,22,47,22,77,22,141,22,203,23,105,23,244,24,159,24,229,25,59,25,142,25,
+236,26,106,26,231,27,58,27,157,28,49,28,119,28,208,29,8,29,136,29,239,30,
+118,30,217,31,93,31,183,32,39,32,139,33,4,33,55,33,135,33,156,33,244,34,42,
+34,114,34,201,35,43,35,109,35,187,36,32,36,138,36,169,36,234,37,33,37,121,
+38,4,38,176,39,103,40,96,40,182,40,250,41,103,41,246,42,40,42,142,43,18,43,
+187,44,52,44,77,44,153,44,189,45,1,45,45,45,80,45,147,45,232,46,92,46,192,
+46,248,47,21,47,82,47,108,47,186,48,17,48,102,48,203,49,56,49,181,50,44,50,
+197,50,244,51,143,51,176,51,240,52,96,53,17,53,94,53,139,53,191,53,235,54,
+100,54,224,54,254,55,86,55,252,56,86,56,191,57,55,57,133,58,44,58,117,58,
+205,59,4,59,166,60,59,60,240,61,102,61,255,62,171,63,51,63,213,64,63,64,174,
+65,12,65,142,65,182,66,4,66,76,66,122,66,192,67,38,67,113,67,220,68,46,68,
+97,68,157,68,239,69,58,69,175,70,3,70,58,70,94,70,166,71,82,71,184,72,29,
+72,200,72,236,73,162,74,87,74,225,75,153,75,203,76,30,76,150,77,46,77,91,
+77,159,78,28,78,166,78,191,79,50,79,107,79,254,80,91,80,217,81,71,81,213,
+82,56,82,187,83,40,83,181,84,35,84,122,84,240,85,128,86,0,86,164,87,15,87,
+87,87,187,88,96,88,254,89,117,89,168,90,130,91,125,91,254,92,142,92,171,92,
+232,93,20,93,95,93,183,94,47,94,167,94,208,95,24,95,107,95,201,96,92,97,47,
+97,203,98,135,98,162,98,222,99,25,99,58,99,145,100,9,100,161,101,68,101,160,
+102,44,102,173,103,14,103,86,103,191,104,49,104,132,104,213,104,246,105,70,
+105,163,106,30,106,50,106,71,106,109,106,228,107,164,108,35,108,117,108,198,
+109,47,109,154,109,224,110,32,110,151,110,203,111,144,111,237,112,36,112,
+117,112,222,113,107,113,218,113,230,114,108,114,222,115,18,115,91,115,178,
+116,26,116,146,117,32,117,160,117,249,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,
+7,0,0,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,
+74,104,4,230,0,0,5,0,45,0,0,5,6,5,182,0,19,0,31,0,51,0,63,0,75,0,0,1,20,14,
+2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,37,20,
+14,2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,3,
+33,17,33,21,33,53,33,17,33,53,33,1,240,34,61,84,49,50,82,59,32,32,59,82,50,
+48,84,61,35,125,58,45,45,57,53,49,47,56,3,147,34,61,83,49,50,82,59,32,32,
+59,82,50,48,83,61,35,125,57,45,45,58,53,50,46,56,2,254,98,1,158,252,37,1,
+158,254,98,3,219,2,238,53,81,57,29,29,56,81,52,51,79,56,29,29,55,79,52,48,
+54,54,48,50,53,53,52,53,81,57,29,29,56,81,52,51,79,56,29,29,55,79,52,48,54,
+54,48,50,53,53,2,111,251,100,141,141,4,156,141,0,0,5,0,90,0,0,5,51,5,182,
+0,27,0,47,0,67,0,79,0,91,0,0,1,33,17,33,21,33,21,33,21,33,53,33,53,33,53,
+33,17,33,53,33,53,33,53,33,21,33,21,33,1,20,14,2,35,34,46,2,53,52,62,2,51,
+50,30,2,5,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,52,38,35,34,6,21,20,
+22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,4,180,254,99,1,157,254,99,
+1,157,252,37,1,158,254,98,1,158,254,98,1,158,254,98,3,219,254,99,1,157,253,
+105,34,61,84,49,50,82,59,32,32,59,82,50,48,84,61,35,3,22,34,61,83,49,50,82,
+59,32,32,59,82,50,48,83,61,35,252,109,58,45,45,57,53,49,47,56,3,22,57,45,
+45,58,53,50,46,56,4,51,253,80,141,105,141,141,105,141,2,176,142,104,141,141,
+104,254,45,53,81,57,29,29,56,81,52,51,79,56,29,29,55,79,50,53,81,57,29,29,
+56,81,52,51,79,56,29,29,55,79,52,48,54,54,48,50,53,53,50,48,54,54,48,50,53,
+53,0,1,0,68,255,78,5,248,5,205,0,71,0,0,5,55,38,38,53,52,18,55,38,38,39,35,
+14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,23,54,54,
+55,23,6,2,2,6,21,20,22,23,19,23,3,22,50,51,50,54,55,23,14,3,35,34,38,39,7,
+2,233,93,70,74,76,68,50,88,22,8,23,64,73,81,40,72,118,85,46,159,104,89,34,
+65,49,30,160,22,39,54,32,68,165,91,131,101,184,139,82,32,29,215,130,213,11,
+21,13,111,150,38,137,26,86,113,136,75,32,59,28,99,104,159,53,164,109,114,
+1,0,134,15,81,74,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,
+186,190,62,93,63,37,7,118,239,118,74,131,254,240,254,246,251,110,60,96,35,
+1,113,74,254,146,2,142,128,35,87,138,98,52,9,6,170,0,0,2,0,68,0,0,6,152,5,
+182,0,31,0,38,0,0,1,33,17,46,3,53,53,33,53,33,21,33,21,20,30,2,51,50,62,2,
+55,51,17,33,21,33,53,33,3,6,6,7,21,33,17,4,193,254,0,67,119,88,52,254,201,
+3,14,254,201,44,76,100,56,50,122,116,93,21,159,1,56,252,241,1,56,9,62,172,
+110,1,97,1,215,1,33,5,29,67,114,92,254,141,141,252,64,69,32,5,23,41,56,34,
+252,112,141,141,2,219,48,51,11,150,1,4,0,2,0,68,0,0,6,152,5,182,0,45,0,52,
+0,0,1,33,17,46,3,53,33,53,33,53,33,53,33,21,33,21,33,21,33,20,30,2,51,50,
+62,2,55,51,17,33,21,33,21,33,21,33,53,33,53,33,53,33,3,6,6,7,21,33,17,4,193,
+254,0,67,119,88,52,254,201,1,55,254,201,3,14,254,201,1,55,254,201,44,76,100,
+56,50,122,116,93,21,159,1,56,254,200,1,56,252,241,1,56,254,200,1,56,9,62,
+172,110,1,97,1,215,1,33,5,30,68,118,94,142,104,141,141,104,142,66,72,33,5,
+23,41,56,34,253,102,141,105,141,141,105,141,1,229,48,51,11,150,1,4,0,4,0,
+68,255,236,6,203,5,197,0,64,0,84,0,104,0,124,0,0,19,52,62,2,51,50,30,2,23,
+51,62,3,51,50,30,2,21,20,14,2,35,34,46,2,39,35,17,30,3,21,20,14,2,35,34,46,
+2,53,52,62,2,55,17,35,14,3,35,34,46,2,1,20,30,2,51,50,62,2,53,52,46,2,35,
+34,14,2,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,5,20,30,2,51,50,62,2,53,
+52,46,2,35,34,14,2,68,59,99,132,74,65,120,96,66,12,225,12,65,95,120,66,74,
+132,100,59,59,100,132,74,65,119,95,66,13,45,62,109,80,46,59,100,132,74,74,
+132,99,59,45,78,106,61,41,12,66,95,119,64,74,132,99,59,2,116,34,58,74,41,
+40,75,57,35,35,57,75,40,41,74,58,34,254,41,34,58,74,41,40,75,57,35,35,57,
+75,40,41,74,58,34,3,174,34,58,74,41,40,75,57,35,35,57,75,40,41,74,58,34,4,
+92,81,133,95,52,42,77,108,66,66,108,77,42,52,95,133,81,81,132,95,52,40,75,
+106,65,254,164,11,60,92,121,70,81,132,95,52,52,95,132,81,70,119,91,61,11,
+1,94,65,106,75,40,52,95,132,253,73,51,83,59,32,32,59,83,51,51,83,59,32,32,
+59,83,2,213,51,83,59,32,32,59,83,51,51,83,59,32,32,59,83,51,51,83,59,32,32,
+59,83,51,51,83,59,32,32,59,83,0,0,6,0,68,255,236,8,100,5,197,0,64,0,84,0,
+104,0,124,0,136,0,148,0,0,1,52,62,2,51,50,30,2,21,20,14,2,7,17,51,62,3,51,
+50,30,2,21,20,14,2,35,34,46,2,39,33,14,3,35,34,46,2,53,52,62,2,51,50,30,2,
+23,51,17,46,3,55,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,20,30,2,51,50,
+62,2,53,52,46,2,35,34,14,2,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,37,
+20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,2,231,59,
+100,132,74,74,132,100,59,46,81,108,62,249,13,67,95,119,65,73,133,99,59,59,
+99,133,73,66,120,96,65,12,253,134,12,66,96,120,65,74,132,99,59,59,99,132,
+74,64,119,95,66,12,246,62,106,78,45,158,34,57,75,41,40,74,58,35,35,58,74,
+40,41,75,57,34,2,164,34,57,75,41,40,74,58,35,35,58,74,40,41,75,57,34,250,
+184,34,58,74,41,40,75,57,35,35,57,75,40,41,74,58,34,2,234,56,47,49,53,57,
+45,45,58,1,221,56,46,50,53,58,45,45,57,4,92,81,133,95,52,52,95,133,81,71,
+121,91,60,11,254,164,65,106,75,40,52,95,132,81,81,132,95,52,41,76,108,67,
+67,108,76,41,52,95,132,81,81,132,95,52,40,75,106,65,1,92,12,61,92,118,71,
+51,83,59,32,32,59,83,51,51,83,59,32,32,59,83,252,197,51,83,59,32,32,59,83,
+51,51,83,59,32,32,59,83,51,51,83,59,32,32,59,83,51,51,83,59,32,32,59,83,250,
+50,52,52,50,48,54,54,48,50,52,52,50,48,54,54,0,0,1,0,90,0,0,5,180,5,203,0,
+39,0,0,1,14,3,21,20,30,2,51,50,62,4,55,51,17,33,21,33,53,33,17,35,14,3,35,
+34,46,2,53,52,54,55,1,113,32,46,29,14,26,53,82,56,59,119,112,99,78,50,7,160,
+1,55,252,242,1,55,8,49,113,132,153,88,59,126,104,67,101,83,5,113,30,57,58,
+62,35,45,83,64,39,57,92,118,120,113,42,250,215,141,141,4,15,90,148,105,57,
+43,90,139,97,102,170,62,0,0,3,0,90,0,0,5,180,5,203,0,11,0,23,0,63,0,0,1,20,
+6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,1,14,3,21,
+20,30,2,51,50,62,4,55,51,17,33,21,33,53,33,17,35,14,3,35,34,46,2,53,52,54,
+55,5,160,56,47,49,53,57,45,45,58,253,231,56,46,50,53,58,45,45,57,253,234,
+32,46,29,14,26,53,82,56,59,119,112,99,78,50,7,160,1,55,252,242,1,55,8,49,
+113,132,153,88,59,126,104,67,101,83,2,51,49,53,53,49,48,55,55,48,49,53,53,
+49,48,55,55,3,14,30,57,58,62,35,45,83,64,39,57,92,118,120,113,42,250,215,
+141,141,4,15,90,148,105,57,43,90,139,97,102,170,62,0,3,0,68,0,0,5,20,5,182,
+0,7,0,19,0,31,0,0,1,33,17,35,17,33,53,33,1,20,6,35,34,38,53,52,54,51,50,22,
+5,20,6,35,34,38,53,52,54,51,50,22,5,20,253,232,160,253,232,4,208,252,175,
+56,47,49,53,57,45,45,58,2,155,56,46,50,53,58,45,45,57,5,41,250,215,5,41,141,
+253,74,50,52,52,50,48,54,54,48,50,52,52,50,48,54,54,0,0,3,0,68,0,0,5,20,5,
+182,0,15,0,27,0,39,0,0,1,17,35,17,33,53,33,17,33,53,33,21,33,17,33,21,1,20,
+6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,2,252,160,
+254,119,1,137,253,232,4,208,253,232,1,137,253,62,56,47,49,53,57,45,45,58,
+2,155,56,46,50,53,58,45,45,57,1,106,254,150,1,106,142,3,49,141,141,252,207,
+142,1,150,50,52,52,50,48,54,54,48,50,52,52,50,48,54,54,0,1,0,68,0,0,5,20,
+5,182,0,7,0,0,1,33,17,35,17,33,53,33,5,20,253,232,160,253,232,4,208,5,41,
+250,215,5,41,141,0,2,0,113,0,0,3,233,5,199,0,26,0,46,0,0,1,20,14,2,7,17,33,
+21,33,53,33,17,46,3,53,52,62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,30,2,
+51,50,62,2,3,233,57,99,133,77,1,55,252,242,1,55,79,133,96,54,73,123,161,87,
+87,160,123,74,159,49,80,102,54,54,103,80,48,45,77,104,59,56,103,79,47,4,4,
+92,149,112,71,12,254,61,141,141,1,195,12,72,112,149,91,100,167,118,66,66,
+118,167,100,70,114,82,45,45,82,114,70,70,112,79,42,42,79,112,0,2,0,113,0,
+0,3,233,5,199,0,34,0,54,0,0,1,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,21,
+33,21,33,21,33,21,33,53,33,53,33,53,33,1,52,46,2,35,34,14,2,21,20,30,2,51,
+50,62,2,1,219,79,133,96,54,73,123,161,87,87,160,123,74,57,99,133,77,1,55,
+254,201,1,55,252,242,1,55,254,201,1,55,1,111,49,80,102,54,54,103,80,48,45,
+77,104,59,56,103,79,47,2,80,12,72,112,149,91,100,167,118,66,66,118,167,100,
+92,149,112,71,12,205,141,105,141,141,105,141,2,129,70,114,82,45,45,82,114,
+70,70,112,79,42,42,79,112,0,1,0,113,0,0,6,199,5,182,0,56,0,0,1,35,14,3,35,
+34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,
+30,2,51,50,62,2,53,53,51,17,33,21,33,17,33,21,33,4,152,9,16,48,54,56,24,31,
+72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,51,
+70,41,39,67,48,27,159,1,144,254,112,1,144,253,209,3,236,36,51,32,15,17,43,
+71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,186,190,72,
+102,63,29,38,78,118,81,141,253,49,139,254,49,141,0,0,1,0,113,0,0,6,199,5,
+182,0,60,0,0,1,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,
+51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,33,21,33,17,33,21,33,
+17,33,21,33,4,152,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,
+85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,1,144,254,112,
+1,144,254,112,1,144,253,209,3,236,36,51,32,15,17,43,71,54,53,70,44,18,44,
+104,171,128,145,145,158,153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,
+141,129,139,254,61,139,254,49,141,0,0,2,0,113,255,236,9,100,5,182,0,15,0,
+132,0,0,37,50,62,2,53,53,14,3,21,20,30,2,1,16,2,35,34,46,2,53,52,62,2,55,
+17,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,
+53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,62,3,53,51,20,30,2,51,50,62,2,
+53,51,20,30,2,51,50,54,55,23,14,3,35,34,46,2,39,35,14,3,35,34,46,2,39,35,
+14,3,7,4,6,34,55,37,20,89,99,49,11,16,28,37,1,70,158,147,39,85,72,46,36,89,
+150,113,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,
+104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,29,55,42,26,160,21,34,
+46,26,25,52,43,27,160,23,36,45,23,28,41,25,102,12,39,54,67,39,28,60,53,42,
+11,8,9,48,63,68,29,29,65,58,45,10,8,12,51,63,68,30,119,40,93,153,113,74,20,
+73,88,96,43,39,58,37,19,1,143,254,246,254,240,32,70,109,77,76,149,126,93,
+21,1,15,36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,
+29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,253,74,5,29,50,70,47,55,
+79,52,25,24,51,80,56,58,80,50,23,29,38,63,21,49,42,27,17,39,62,45,46,62,38,
+17,18,39,62,44,38,56,38,23,4,0,0,4,0,113,255,236,9,100,5,182,0,116,0,132,
+0,144,0,156,0,0,1,14,3,7,21,16,2,35,34,46,2,53,52,62,2,55,17,35,14,3,35,34,
+46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,
+2,51,50,62,2,53,53,51,17,62,3,53,51,20,30,2,51,50,62,2,53,51,20,30,2,51,50,
+54,55,23,14,3,35,34,46,2,39,35,14,3,35,34,46,2,39,1,50,62,2,53,53,14,3,21,
+20,30,2,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,
+22,6,23,12,51,63,68,30,158,147,39,85,72,46,36,89,150,113,9,16,48,54,56,24,
+31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,
+51,70,41,39,67,48,27,159,29,55,42,26,160,21,34,46,26,25,52,43,27,160,23,36,
+45,23,28,41,25,102,12,39,54,67,39,28,60,53,42,11,8,9,48,63,68,29,29,65,58,
+45,10,253,231,34,55,37,20,89,99,49,11,16,28,37,3,99,56,46,50,53,58,45,45,
+57,56,46,50,53,58,45,45,57,3,18,38,56,38,23,4,109,254,246,254,240,32,70,109,
+77,76,149,126,93,21,1,15,36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,
+145,145,158,153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,253,74,
+5,29,50,70,47,55,79,52,25,24,51,80,56,58,80,50,23,29,38,63,21,49,42,27,17,
+39,62,45,46,62,38,17,18,39,62,44,253,101,40,93,153,113,74,20,73,88,96,43,
+39,58,37,19,1,35,50,53,53,50,48,54,54,2,177,50,53,53,50,48,54,54,0,1,0,113,
+0,0,6,117,5,182,0,58,0,0,1,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,
+51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,51,53,51,
+17,35,53,35,17,35,4,152,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,
+72,118,85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,158,160,
+160,158,159,3,236,36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,
+145,158,153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,253,49,185,
+254,16,172,253,164,0,2,0,113,254,180,6,117,5,182,0,23,0,82,0,0,5,34,6,7,39,
+54,54,51,50,30,2,51,50,54,55,23,6,6,35,34,46,2,1,35,14,3,35,34,46,2,39,35,
+14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,
+2,53,53,51,17,51,53,51,17,35,53,35,17,35,2,205,48,75,31,94,38,121,97,45,98,
+93,84,32,48,75,31,94,38,121,97,43,96,93,86,1,169,9,16,48,54,56,24,31,72,69,
+58,16,8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,51,70,41,
+39,67,48,27,159,158,160,160,158,159,233,39,60,56,97,89,24,28,24,39,59,55,
+97,89,24,28,24,4,213,36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,
+145,158,153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,253,49,185,
+254,16,172,253,164,0,2,0,68,0,0,4,201,5,182,0,19,0,39,0,0,1,1,51,17,35,17,
+52,62,4,55,39,14,3,7,7,37,1,51,17,35,17,52,62,4,55,39,14,3,7,7,2,170,1,127,
+160,160,1,3,3,5,5,3,10,13,33,50,72,51,72,253,52,1,127,159,159,1,3,3,5,5,3,
+10,13,33,50,72,51,72,4,55,1,127,250,74,3,35,99,143,101,67,47,31,16,4,26,49,
+59,75,51,72,100,1,127,250,74,3,35,99,143,101,67,47,31,16,4,26,49,59,75,51,
+72,0,0,2,0,68,255,236,4,219,5,182,0,23,0,37,0,0,1,20,14,2,35,34,38,53,52,
+62,2,51,17,33,53,33,17,33,17,35,17,33,1,50,54,53,17,34,14,2,21,20,30,2,3,
+43,46,91,135,90,182,199,81,152,216,134,253,232,2,184,1,176,160,254,240,254,
+150,102,100,114,161,102,47,31,58,82,1,139,98,154,106,57,192,203,118,168,108,
+50,1,246,141,253,125,252,205,2,166,253,209,134,140,1,29,25,67,118,93,55,93,
+69,39,0,0,3,0,227,0,0,4,182,5,182,0,3,0,7,0,11,0,0,33,35,17,51,1,35,17,51,
+1,35,17,51,4,182,159,159,252,205,160,160,1,154,160,160,5,182,250,74,5,182,
+250,74,5,182,0,4,0,227,0,0,4,184,5,182,0,3,0,7,0,11,0,15,0,0,1,35,17,51,1,
+35,17,51,1,35,17,51,1,21,33,53,4,184,159,159,252,205,160,160,1,152,160,160,
+1,155,252,43,1,10,4,172,251,84,4,172,251,84,4,172,250,215,141,141,0,5,0,227,
+0,0,4,182,5,182,0,3,0,7,0,11,0,15,0,19,0,0,1,35,17,51,1,35,17,51,1,35,17,
+51,1,35,17,51,5,35,17,51,4,182,159,159,252,205,160,160,3,51,159,159,252,205,
+160,160,1,154,160,160,3,174,2,8,253,248,2,8,250,74,2,8,253,248,2,8,49,2,8,
+0,0,3,0,227,0,0,4,182,5,182,0,11,0,23,0,27,0,0,1,33,53,51,17,35,53,33,21,
+35,17,51,17,33,53,51,17,35,53,33,21,35,17,51,5,35,17,51,1,131,2,148,159,159,
+253,108,160,160,2,148,159,159,253,108,160,160,1,154,160,160,5,41,141,253,
+248,238,238,2,8,251,103,235,253,248,143,143,2,8,49,2,8,0,0,1,0,47,1,20,8,
+88,5,29,0,83,0,0,1,50,62,2,55,23,14,3,35,34,38,39,6,6,35,34,38,39,6,6,35,
+34,46,2,39,55,30,3,51,50,54,55,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,22,
+22,51,50,54,55,46,3,53,52,62,2,51,50,22,21,20,14,2,7,22,22,6,104,62,108,94,
+81,36,115,45,99,119,144,89,61,115,53,69,161,89,91,162,71,46,103,56,89,152,
+127,106,42,125,34,84,98,113,62,22,52,18,48,80,56,31,41,76,110,68,65,110,79,
+45,25,43,60,36,47,115,60,60,116,47,35,61,45,25,42,78,111,68,140,155,31,57,
+79,48,23,62,1,160,27,71,120,93,59,116,151,89,36,39,37,37,39,36,34,32,38,35,
+87,150,116,63,93,120,71,27,6,6,42,103,121,135,74,82,148,111,65,51,101,152,
+102,63,121,114,104,46,19,20,18,19,43,101,113,125,68,82,148,111,65,202,204,
+62,128,122,110,43,11,11,0,3,0,47,1,20,8,88,5,29,0,17,0,35,0,119,0,0,1,20,
+22,23,62,3,53,52,46,2,35,34,14,2,5,20,30,2,23,54,54,53,52,46,2,35,34,14,2,
+1,34,38,39,6,6,35,34,38,39,6,6,35,34,46,2,39,55,30,3,51,50,54,55,46,3,53,
+52,62,2,51,50,30,2,21,20,14,2,7,22,22,51,50,54,55,46,3,53,52,62,2,51,50,22,
+21,20,14,2,7,22,22,51,50,62,2,55,23,14,3,2,88,86,84,28,39,25,12,16,33,53,
+37,38,51,32,14,2,197,16,30,44,28,76,80,16,33,51,35,38,53,33,15,1,75,61,115,
+53,69,161,89,91,162,71,46,103,56,89,152,127,106,42,125,34,84,98,113,62,22,
+52,18,48,80,56,31,41,76,110,68,65,110,79,45,25,43,60,36,47,115,60,60,116,
+47,35,61,45,25,42,78,111,68,140,155,31,57,79,48,23,62,27,62,108,94,81,36,
+115,45,99,119,144,3,135,122,213,68,35,93,106,113,56,55,97,72,42,38,70,98,
+60,54,110,103,92,36,66,205,124,60,98,70,38,42,72,97,253,86,39,37,37,39,36,
+34,32,38,35,87,150,116,63,93,120,71,27,6,6,42,103,121,135,74,82,148,111,65,
+51,101,152,102,63,121,114,104,46,19,20,18,19,43,101,113,125,68,82,148,111,
+65,202,204,62,128,122,110,43,11,11,27,71,120,93,59,116,151,89,36,0,4,0,158,
+0,229,6,14,5,0,0,11,0,23,0,35,0,47,0,0,1,20,6,35,34,38,53,52,54,51,50,22,
+17,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,1,35,
+17,51,17,33,21,33,21,33,21,33,4,150,56,47,49,53,57,45,45,58,56,47,49,53,57,
+45,45,58,1,120,56,46,50,52,57,45,45,57,251,47,159,159,3,170,252,86,3,170,
+252,86,1,76,50,53,53,50,48,54,54,3,30,50,53,53,50,48,54,54,254,42,50,53,53,
+50,48,54,54,253,214,3,237,254,220,140,137,139,0,4,0,158,0,250,6,14,4,231,
+0,7,0,19,0,31,0,43,0,0,1,17,33,21,33,17,35,17,1,20,6,35,34,38,53,52,54,51,
+50,22,17,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,
+1,61,3,170,252,86,159,3,248,56,47,49,53,57,45,45,58,56,47,49,53,57,45,45,
+58,1,120,56,46,50,52,57,45,45,57,4,231,254,82,139,254,76,3,237,252,240,49,
+53,53,49,48,54,54,2,13,49,53,53,49,48,55,55,254,176,50,53,53,50,48,54,54,
+0,0,3,0,227,0,0,10,59,5,182,0,83,0,103,0,123,0,0,1,34,39,6,6,35,35,17,35,
+17,35,17,35,17,51,17,51,17,51,17,51,50,54,55,38,38,53,52,62,2,51,50,30,2,
+21,20,6,7,22,22,51,50,54,55,38,38,53,52,62,2,51,50,30,2,21,20,6,7,22,22,51,
+51,17,51,17,51,17,51,17,35,17,35,17,35,17,35,34,38,39,6,1,20,30,2,23,62,3,
+53,52,46,2,35,34,14,2,5,20,30,2,23,62,3,53,52,46,2,35,34,14,2,5,139,183,130,
+53,120,63,176,159,148,160,160,148,159,176,23,56,22,90,97,44,79,110,66,75,
+113,74,37,90,71,40,103,55,57,108,40,69,91,52,84,108,57,57,107,83,50,98,90,
+22,56,24,176,160,148,159,159,148,160,176,65,120,52,133,253,106,12,31,53,41,
+32,53,37,20,18,35,52,35,38,52,34,15,2,168,19,36,52,32,42,54,31,13,20,36,51,
+31,32,52,37,20,1,33,59,29,30,254,223,1,33,254,223,5,182,251,246,4,10,251,
+246,6,6,82,224,128,102,149,97,48,62,107,145,82,134,216,78,9,9,9,9,78,216,
+134,82,145,107,62,48,97,149,102,128,222,82,8,6,4,10,251,246,4,10,250,74,1,
+33,254,223,1,33,30,29,59,2,73,57,111,100,84,30,30,84,100,111,57,55,93,69,
+39,39,69,93,55,56,110,101,85,30,30,85,100,110,57,55,93,69,39,39,69,93,0,2,
+0,227,0,0,7,111,5,182,0,55,0,75,0,0,1,52,54,55,38,38,35,34,14,2,7,17,35,17,
+51,17,62,3,51,50,23,54,51,50,30,2,23,17,51,17,35,17,46,3,35,34,6,7,22,22,
+21,20,14,2,35,34,46,2,37,52,46,2,39,14,3,21,20,30,2,51,50,62,2,2,231,97,84,
+41,100,50,66,107,85,65,23,160,160,27,69,85,103,62,188,142,139,191,60,104,
+87,71,28,160,160,23,64,86,109,68,51,100,40,82,98,44,83,118,74,74,118,83,45,
+1,224,21,40,60,39,40,60,40,20,19,39,60,42,42,60,39,19,2,117,131,213,78,11,
+13,19,29,36,18,252,51,5,182,254,172,17,33,26,16,65,65,17,27,33,17,1,86,250,
+74,3,203,18,37,30,19,13,11,78,213,131,82,144,108,62,48,97,149,102,53,105,
+96,83,31,31,83,96,105,53,55,93,69,39,39,69,93,0,1,0,90,0,0,5,248,5,182,0,
+19,0,0,33,35,17,33,53,33,17,51,17,33,17,51,17,33,21,33,17,35,17,33,2,70,160,
+254,180,1,76,160,1,198,160,1,76,254,180,160,254,58,2,182,142,2,114,253,142,
+2,114,253,142,142,253,74,2,182,0,2,0,66,0,0,5,158,5,182,0,47,0,68,0,0,1,35,
+14,3,35,34,46,2,53,52,62,2,51,50,22,21,20,14,2,35,34,38,39,7,30,3,51,50,62,
+4,55,51,17,33,21,33,53,33,1,34,6,21,20,22,23,30,3,51,50,62,2,53,52,46,2,3,
+199,9,47,113,134,155,87,66,128,100,62,36,62,80,45,100,119,29,50,68,39,28,
+32,14,6,14,33,45,62,44,57,115,108,96,79,57,15,159,1,56,252,241,1,56,253,112,
+42,50,5,3,9,23,24,21,7,20,31,21,10,14,23,30,4,135,70,142,115,72,34,81,136,
+101,69,104,69,35,109,111,45,71,48,26,9,9,4,27,37,21,9,60,97,122,125,116,43,
+250,215,141,141,4,109,57,56,26,38,14,7,9,6,2,20,31,40,21,31,40,23,9,0,4,0,
+45,255,238,6,0,5,195,0,43,0,63,0,75,0,87,0,0,19,39,1,30,3,23,62,3,55,1,7,
+1,6,6,7,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,46,3,39,1,52,46,2,39,14,
+3,21,20,30,2,51,50,62,2,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,
+53,52,54,51,50,22,154,109,1,80,30,91,109,121,61,61,122,109,90,29,1,76,125,
+254,254,43,143,80,57,102,77,44,64,106,137,74,74,137,105,64,43,75,101,57,42,
+82,72,58,18,2,86,37,62,83,46,44,79,58,34,38,62,80,41,42,79,63,38,254,20,56,
+46,50,53,58,45,45,57,2,221,56,46,50,53,58,45,45,57,4,0,98,1,97,4,38,65,90,
+57,57,90,65,38,4,254,165,104,1,14,6,90,76,66,151,167,182,97,112,177,123,65,
+45,109,184,139,94,178,163,149,65,41,66,48,28,3,252,189,78,151,143,129,56,
+56,129,143,151,78,90,128,82,38,45,87,125,2,181,49,53,53,49,48,55,55,48,49,
+53,53,49,48,55,55,0,0,5,0,47,1,20,8,88,6,31,0,17,0,35,0,47,0,59,0,143,0,0,
+1,20,22,23,62,3,53,52,46,2,35,34,14,2,5,20,30,2,23,54,54,53,52,46,2,35,34,
+14,2,19,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,
+1,34,38,39,6,6,35,34,38,39,6,6,35,34,46,2,39,55,30,3,51,50,54,55,46,3,53,
+52,62,2,51,50,30,2,21,20,14,2,7,22,22,51,50,54,55,46,3,53,52,62,2,51,50,22,
+21,20,14,2,7,22,22,51,50,62,2,55,23,14,3,2,88,86,84,28,39,25,12,16,33,53,
+37,38,51,32,14,2,197,16,30,44,28,76,80,16,33,51,35,38,53,33,15,245,56,46,
+50,52,57,45,45,57,253,54,56,47,49,53,57,45,45,58,3,32,61,115,53,69,161,89,
+91,162,71,46,103,56,89,152,127,106,42,125,34,84,98,113,62,22,52,18,48,80,
+56,31,41,76,110,68,65,110,79,45,25,43,60,36,47,115,60,60,116,47,35,61,45,
+25,42,78,111,68,140,155,31,57,79,48,23,62,27,62,108,94,81,36,115,45,99,119,
+144,3,135,122,213,68,35,93,106,113,56,55,97,72,42,38,70,98,60,54,110,103,
+92,36,66,205,124,60,98,70,38,42,72,97,1,250,49,53,53,49,48,55,55,48,49,53,
+53,49,48,55,55,251,44,39,37,37,39,36,34,32,38,35,87,150,116,63,93,120,71,
+27,6,6,42,103,121,135,74,82,148,111,65,51,101,152,102,63,121,114,104,46,19,
+20,18,19,43,101,113,125,68,82,148,111,65,202,204,62,128,122,110,43,11,11,
+27,71,120,93,59,116,151,89,36,0,1,0,113,0,0,6,117,5,182,0,62,0,0,1,35,14,
+3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,
+21,20,30,2,51,50,62,2,53,53,51,17,51,53,51,17,35,53,35,17,33,21,33,53,33,
+4,152,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,104,
+89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,158,160,160,158,1,56,252,241,
+1,56,3,236,36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,
+153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,253,49,185,254,16,
+172,254,49,141,141,0,0,3,0,113,0,0,7,45,5,182,0,62,0,74,0,86,0,0,1,35,14,
+3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,
+21,20,30,2,51,50,62,2,53,53,51,17,33,53,51,17,35,53,33,17,33,21,33,53,33,
+37,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,4,152,
+9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,104,89,
+34,65,49,30,160,30,51,70,41,39,67,48,27,159,1,86,160,160,254,170,1,56,252,
+241,1,56,1,176,56,47,49,53,57,45,45,58,56,47,49,53,57,45,45,58,3,236,36,51,
+32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,
+186,190,72,102,63,29,38,78,118,81,141,253,49,185,254,16,172,254,49,141,141,
+238,50,53,53,50,48,54,54,2,34,50,53,53,50,48,54,54,0,1,0,113,0,0,7,25,5,182,
+0,70,0,0,1,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,
+50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,33,53,51,17,35,53,33,17,
+33,21,33,53,33,17,33,21,35,17,51,21,33,4,152,9,16,48,54,56,24,31,72,69,58,
+16,8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,
+67,48,27,159,1,66,160,160,254,190,1,56,252,241,1,56,254,182,160,160,1,74,
+3,236,36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,
+29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,252,183,184,254,16,172,
+254,172,141,141,1,84,172,1,240,184,0,0,2,0,158,255,236,2,252,5,205,0,67,0,
+87,0,0,37,50,54,55,23,6,6,35,34,46,2,53,52,54,55,38,38,53,52,62,2,51,50,22,
+23,54,54,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,20,6,7,22,22,21,20,14,
+2,35,34,38,39,6,6,21,20,30,2,3,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,
+205,59,79,15,140,16,153,124,62,110,82,49,59,51,51,59,49,82,110,62,18,39,17,
+34,35,23,39,52,29,59,79,16,139,15,154,124,61,111,82,49,60,51,51,60,49,82,
+111,61,19,36,19,34,36,23,39,53,115,23,39,53,29,29,52,39,23,23,39,52,29,29,
+53,39,23,119,88,72,21,134,144,43,79,110,67,74,111,34,40,120,75,67,110,79,
+43,5,5,22,89,53,35,59,42,24,89,71,20,134,145,43,79,110,67,76,109,34,41,119,
+74,68,110,78,43,3,5,21,90,52,36,59,42,23,2,102,36,59,42,23,23,42,59,36,35,
+59,42,24,24,42,59,0,2,0,113,255,236,6,121,5,182,0,112,0,125,0,0,5,1,55,23,
+1,53,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,54,53,51,
+30,3,51,50,62,2,53,53,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,
+2,51,50,54,53,51,30,3,51,50,62,2,53,51,17,54,54,51,50,30,2,21,20,14,2,35,
+34,46,2,39,5,23,1,34,6,7,21,20,22,51,50,54,53,52,38,3,109,254,208,109,106,
+1,123,8,16,48,54,56,24,31,72,69,59,17,8,23,62,69,71,31,70,123,91,52,159,32,
+52,65,34,81,99,158,1,30,52,70,41,39,66,48,27,8,16,48,54,56,24,31,72,69,59,
+17,8,23,62,69,71,31,70,123,91,52,159,32,52,65,34,81,99,158,1,30,52,70,41,
+39,66,48,27,160,23,51,29,48,83,61,35,34,61,83,49,45,86,70,49,9,254,218,108,
+1,189,16,52,35,53,50,46,56,57,20,1,104,90,127,1,59,201,36,51,31,15,17,42,
+71,54,52,71,43,18,39,88,142,104,69,92,55,22,115,123,61,89,59,29,36,63,88,
+51,164,36,51,32,14,17,42,71,54,52,71,43,18,39,87,142,104,69,91,55,22,114,
+123,61,89,59,28,36,63,87,51,253,2,10,13,32,59,82,50,53,91,67,39,22,48,74,
+52,243,129,2,4,11,22,39,72,61,53,49,48,55,0,0,2,0,113,255,236,6,246,5,182,
+0,129,0,142,0,0,5,1,55,23,1,53,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,
+51,20,30,2,51,50,54,53,51,30,3,51,50,62,2,53,53,35,14,3,35,34,46,2,39,35,
+14,3,35,34,46,2,53,51,20,30,2,51,50,54,53,51,30,3,51,50,62,2,53,51,17,54,
+54,51,50,30,2,21,20,6,7,21,20,22,51,50,54,53,51,20,14,2,35,34,46,2,53,53,
+46,3,39,5,23,1,34,6,7,21,20,22,51,50,54,53,52,38,3,109,254,208,109,106,1,
+123,8,16,48,54,56,24,31,72,69,59,17,8,23,62,69,71,31,70,123,91,52,159,32,
+52,65,34,81,99,158,1,30,52,70,41,39,66,48,27,8,16,48,54,56,24,31,72,69,59,
+17,8,23,62,69,71,31,70,123,91,52,159,32,52,65,34,81,99,158,1,30,52,70,41,
+39,66,48,27,160,23,51,29,48,83,61,35,92,72,45,37,35,47,125,34,57,76,42,42,
+76,57,34,34,61,50,36,9,254,215,108,1,189,16,52,35,53,50,46,56,57,20,1,104,
+90,127,1,59,201,36,51,31,15,17,42,71,54,52,71,43,18,39,88,142,104,69,92,55,
+22,115,123,61,89,59,29,36,63,88,51,164,36,51,32,14,17,42,71,54,52,71,43,18,
+39,87,142,104,69,91,55,22,114,123,61,89,59,28,36,63,87,51,253,2,10,13,32,
+59,82,50,88,115,19,61,50,52,55,49,52,82,56,29,29,56,82,52,57,6,27,42,59,38,
+245,129,2,4,11,22,39,72,61,53,49,48,55,0,0,1,0,227,255,236,4,61,5,203,0,5,
+0,0,23,17,1,1,21,1,227,3,82,253,148,2,116,20,5,223,254,123,254,170,9,254,
+144,0,0,3,0,72,0,0,6,178,5,211,0,73,0,84,0,95,0,0,1,30,3,23,62,3,51,50,30,
+2,21,20,14,2,7,30,3,23,35,46,3,39,46,3,39,35,6,6,7,14,3,7,35,62,3,55,46,3,
+53,52,62,2,51,50,30,2,23,62,3,55,55,51,37,34,6,7,62,3,53,52,38,5,20,30,2,
+23,38,38,35,34,6,3,193,10,56,75,87,40,4,33,63,96,68,39,79,63,40,56,91,117,
+61,4,39,64,85,49,184,45,76,57,35,4,45,93,87,78,29,8,65,176,93,3,34,57,80,
+49,176,49,85,63,39,3,57,115,93,58,40,63,79,39,67,96,63,32,4,40,89,78,60,12,
+4,118,2,25,45,53,6,38,68,51,29,45,250,217,32,51,66,35,6,51,45,43,39,4,231,
+67,85,49,19,1,111,170,116,60,26,58,95,69,84,120,79,45,10,121,249,237,213,
+85,81,214,238,248,114,1,22,45,68,48,97,85,2,114,244,237,216,84,79,212,240,
+254,122,12,46,80,117,81,69,95,58,26,59,117,172,113,1,22,53,88,66,22,70,150,
+158,7,27,45,68,48,62,51,113,42,64,45,30,9,155,148,60,0,0,3,0,158,255,236,
+4,246,5,205,0,19,0,39,0,97,0,0,1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,
+19,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,55,20,14,2,35,34,46,2,53,52,62,
+2,55,53,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,23,54,54,51,51,53,51,17,35,
+53,35,34,46,2,39,7,30,3,2,184,29,51,68,38,37,66,51,30,27,49,68,40,40,68,50,
+28,9,31,53,71,40,39,70,53,31,28,51,71,43,42,72,52,29,159,59,98,128,69,70,
+127,97,58,39,63,82,43,44,79,60,36,60,98,123,63,65,125,97,59,32,48,57,25,2,
+56,166,102,90,160,160,90,51,94,84,70,25,2,25,59,51,35,4,70,66,95,62,29,29,
+62,95,66,66,106,75,40,40,75,106,253,115,69,111,77,42,42,77,111,69,69,98,61,
+28,28,61,98,69,102,149,97,47,47,97,149,102,68,116,91,64,17,8,15,67,93,115,
+65,100,147,97,47,47,97,147,100,53,97,79,54,10,8,11,7,184,254,17,172,1,4,7,
+6,8,10,52,80,104,0,5,0,158,255,236,5,72,5,205,0,19,0,39,0,51,0,63,0,121,0,
+0,1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,19,52,46,2,35,34,14,2,21,20,
+30,2,51,50,62,2,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,
+54,51,50,22,5,20,14,2,35,34,46,2,53,52,62,2,55,53,46,3,53,52,62,2,51,50,30,
+2,21,20,14,2,7,23,54,54,51,51,53,51,17,35,53,35,34,46,2,39,7,30,3,2,184,29,
+51,68,38,37,66,51,30,27,49,68,40,40,68,50,28,9,31,53,71,40,39,70,53,31,28,
+51,71,43,42,72,52,29,1,161,56,46,50,52,57,45,45,57,56,46,50,52,57,45,45,57,
+254,254,59,98,128,69,70,127,97,58,39,63,82,43,44,79,60,36,60,98,123,63,65,
+125,97,59,32,48,57,25,2,56,166,102,172,160,160,172,51,94,84,70,25,2,25,59,
+51,35,4,70,66,95,62,29,29,62,95,66,66,106,75,40,40,75,106,253,115,69,111,
+77,42,42,77,111,69,69,98,61,28,28,61,98,2,249,50,52,52,50,48,54,54,253,69,
+50,53,53,50,48,54,54,89,102,149,97,47,47,97,149,102,68,116,91,64,17,8,15,
+67,93,115,65,100,147,97,47,47,97,147,100,53,97,79,54,10,8,11,7,184,254,17,
+172,1,4,7,6,8,10,52,80,104,0,0,5,0,90,0,227,4,150,5,72,0,19,0,31,0,45,0,60,
+0,72,0,0,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,50,54,55,39,6,35,34,
+39,7,22,22,1,20,23,55,38,53,52,54,55,53,14,3,5,20,6,7,23,54,53,52,46,2,39,
+21,22,22,7,52,38,35,34,6,21,20,22,51,50,54,4,150,78,143,199,121,129,202,139,
+73,81,144,199,119,117,199,144,81,253,227,97,153,51,164,57,80,82,55,168,48,
+154,254,232,18,148,6,83,72,71,116,82,46,2,98,3,5,143,19,45,81,113,68,68,85,
+125,57,45,45,58,53,50,46,56,3,18,129,207,145,78,78,145,207,129,127,208,149,
+82,82,149,208,253,222,74,69,94,37,37,96,68,73,1,163,82,67,86,27,34,84,106,
+17,215,12,70,109,144,85,18,32,15,82,66,81,84,142,109,71,12,215,18,104,83,
+48,55,55,48,49,53,53,0,5,0,45,0,0,4,254,5,182,0,15,0,27,0,39,0,51,0,63,0,
+0,1,17,35,17,33,53,33,17,33,53,33,21,33,17,33,21,1,20,6,35,34,38,53,52,54,
+51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,
+22,5,20,6,35,34,38,53,52,54,51,50,22,2,229,159,254,118,1,138,253,231,4,209,
+253,231,1,138,253,61,56,46,50,53,58,45,45,57,2,156,56,47,49,53,57,45,45,58,
+253,100,56,46,50,53,58,45,45,57,2,156,56,47,49,53,57,45,45,58,1,106,254,150,
+1,106,142,3,49,141,141,252,207,142,1,150,50,52,52,50,48,54,54,48,50,52,52,
+50,48,54,54,253,54,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,0,0,5,0,90,
+0,0,5,207,5,182,0,11,0,23,0,35,0,47,0,59,0,0,1,17,35,17,33,53,33,17,51,17,
+33,21,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,
+1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,3,100,
+159,253,149,2,107,159,2,107,252,112,55,47,49,53,57,45,45,57,2,119,56,46,50,
+53,58,45,45,57,253,137,55,47,49,53,57,45,45,57,2,119,56,46,50,53,58,45,45,
+57,2,182,253,74,2,182,142,2,114,253,142,142,1,121,49,53,53,49,48,55,55,48,
+49,53,53,49,48,55,55,253,108,50,53,53,50,48,54,54,48,50,53,53,50,48,54,54,
+0,1,0,227,255,246,5,168,5,182,0,92,0,0,1,20,30,2,51,50,62,2,53,53,51,21,20,
+30,2,51,50,62,2,53,53,51,21,20,14,2,35,34,46,2,39,35,6,6,35,34,46,2,53,17,
+51,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,14,
+2,35,34,46,2,39,35,6,6,35,34,38,39,35,1,131,22,45,68,47,39,68,52,30,160,30,
+51,69,38,46,69,45,22,160,46,85,119,72,59,90,68,49,18,8,42,138,105,72,119,
+85,46,160,26,48,67,41,39,68,52,30,160,30,51,69,38,51,69,43,19,160,46,85,119,
+72,59,90,68,49,18,8,42,126,97,55,94,25,8,1,164,81,112,70,32,23,57,96,74,207,
+207,74,96,57,23,32,70,112,81,162,160,130,167,97,38,21,39,57,36,69,84,38,97,
+167,130,4,16,162,81,112,70,31,23,56,96,74,207,207,74,96,56,23,31,70,112,81,
+162,159,130,168,97,38,21,40,57,36,69,85,43,50,0,1,0,135,255,236,5,76,5,205,
+0,122,0,0,19,51,21,20,30,2,51,50,62,2,53,52,62,2,51,50,22,23,7,38,38,35,34,
+6,21,20,30,2,51,50,62,2,53,53,51,21,20,14,2,35,34,46,2,39,35,14,3,35,34,38,
+39,35,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,
+14,2,35,34,46,2,39,35,6,6,35,34,38,39,55,22,22,51,50,54,53,35,14,3,35,34,
+46,2,53,135,160,26,48,67,41,39,68,52,30,42,80,113,72,38,59,17,26,11,39,38,
+77,71,31,52,68,38,51,69,43,19,160,46,85,119,72,59,90,68,49,18,9,21,51,65,
+79,48,56,93,25,8,22,45,68,47,39,68,52,30,159,30,52,68,39,46,69,45,22,160,
+46,85,119,72,27,61,55,45,12,9,2,163,142,38,60,17,27,11,39,38,77,71,9,12,45,
+55,61,27,72,119,85,46,4,178,39,81,112,70,32,23,57,96,74,93,138,91,45,11,8,
+125,5,10,111,127,74,97,57,22,32,70,112,81,39,37,130,167,97,38,21,40,57,36,
+35,56,41,22,43,49,159,81,112,70,32,23,57,96,74,63,63,74,96,57,23,32,70,112,
+81,18,16,130,167,97,38,15,29,40,24,186,178,10,8,125,5,9,109,126,24,40,29,
+15,38,97,167,130,0,3,0,113,255,233,6,37,5,205,0,63,0,75,0,87,0,0,1,14,3,35,
+34,46,2,53,52,18,55,38,38,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,
+2,53,53,51,21,20,30,2,23,54,54,55,23,6,2,2,6,21,20,30,2,51,50,54,55,19,20,
+6,35,34,38,53,52,54,51,50,22,3,20,6,35,34,38,53,52,54,51,50,22,6,37,26,86,
+113,136,75,92,147,103,56,76,68,50,88,22,8,23,64,73,81,40,72,118,85,46,159,
+104,89,34,65,49,30,160,22,39,54,32,68,165,91,131,101,184,139,82,33,62,88,
+55,111,150,38,14,56,46,50,53,58,45,45,57,211,56,46,50,53,58,45,45,57,1,96,
+87,138,98,52,56,105,150,93,114,1,0,134,15,81,74,53,70,44,18,44,104,171,128,
+145,145,158,153,29,64,103,74,186,190,62,93,63,37,7,118,239,118,74,131,254,
+240,254,246,251,110,61,97,69,37,142,128,1,137,49,53,53,49,48,55,55,254,55,
+50,53,53,50,48,54,54,0,0,4,0,113,255,233,6,125,5,205,0,63,0,75,0,87,0,99,
+0,0,1,14,3,35,34,46,2,53,52,18,55,38,38,39,35,14,3,35,34,46,2,53,53,51,21,
+20,22,51,50,62,2,53,53,51,21,20,30,2,23,54,54,55,23,6,2,2,6,21,20,30,2,51,
+50,54,55,19,20,6,35,34,38,53,52,54,51,50,22,19,20,6,35,34,38,53,52,54,51,
+50,22,1,20,6,35,34,38,53,52,54,51,50,22,6,37,26,86,113,136,75,92,147,103,
+56,76,68,50,88,22,8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,
+22,39,54,32,68,165,91,131,101,184,139,82,33,62,88,55,111,150,38,14,56,46,
+50,53,58,45,45,57,211,56,46,50,53,58,45,45,57,254,90,56,46,50,53,58,45,45,
+57,1,96,87,138,98,52,56,105,150,93,114,1,0,134,15,81,74,53,70,44,18,44,104,
+171,128,145,145,158,153,29,64,103,74,186,190,62,93,63,37,7,118,239,118,74,
+131,254,240,254,246,251,110,61,97,69,37,142,128,1,137,49,53,53,49,48,55,55,
+1,106,50,53,53,50,48,54,54,252,157,50,53,53,50,48,54,54,0,2,0,227,0,0,5,6,
+5,182,0,42,0,63,0,0,1,62,3,51,50,30,2,21,20,14,2,35,34,38,53,52,62,2,51,50,
+22,23,55,46,3,35,34,14,2,7,17,35,17,51,17,5,50,54,53,52,38,39,46,3,35,34,
+14,2,21,20,30,2,1,139,52,115,130,150,88,66,128,100,62,36,62,80,45,100,119,
+29,50,68,39,28,32,14,6,12,32,47,64,44,86,160,137,108,33,160,160,2,141,42,
+51,6,3,8,23,24,22,7,20,30,21,11,14,23,30,3,51,64,102,72,39,34,83,138,104,
+67,101,68,34,109,110,45,71,49,26,10,9,4,22,35,24,13,55,89,114,59,253,129,
+5,182,253,125,237,57,55,26,38,14,7,10,6,2,20,32,40,21,31,39,23,9,0,4,0,227,
+0,0,5,6,5,182,0,11,0,23,0,66,0,87,0,0,1,20,6,35,34,38,53,52,54,51,50,22,17,
+20,6,35,34,38,53,52,54,51,50,22,37,62,3,51,50,30,2,21,20,14,2,35,34,38,53,
+52,62,2,51,50,22,23,55,46,3,35,34,14,2,7,17,35,17,51,17,5,50,54,53,52,38,
+39,46,3,35,34,14,2,21,20,30,2,2,240,56,47,49,53,57,45,45,58,56,47,49,53,57,
+45,45,58,254,155,52,115,130,150,88,66,128,100,62,36,62,80,45,100,119,29,50,
+68,39,28,32,14,6,12,32,47,64,44,86,160,137,108,33,160,160,2,141,42,51,6,3,
+8,23,24,22,7,20,30,21,11,14,23,30,4,199,50,53,53,50,48,54,54,253,163,50,53,
+53,50,48,54,54,105,64,102,72,39,34,83,138,104,67,101,68,34,109,110,45,71,
+49,26,10,9,4,23,35,24,12,55,89,114,59,253,129,5,182,253,125,237,57,55,26,
+38,14,7,10,6,2,20,32,40,21,31,39,23,9,0,0,1,0,154,1,225,2,223,4,37,0,17,0,
+0,1,20,14,2,35,34,38,53,52,62,2,51,50,30,2,2,223,42,77,107,65,139,151,43,
+77,106,64,63,107,77,44,3,2,69,108,73,39,150,139,67,108,76,40,40,76,108,0,
+2,0,14,254,180,3,102,4,37,0,17,0,41,0,0,1,20,14,2,35,34,38,53,52,62,2,51,
+50,30,2,1,34,6,7,39,54,54,51,50,30,2,51,50,54,55,23,6,6,35,34,46,2,2,223,
+42,77,107,65,139,151,43,77,106,64,63,107,77,44,254,39,47,75,31,95,39,120,
+97,45,98,93,85,32,47,75,31,94,38,121,97,43,95,94,86,3,2,69,108,73,39,150,
+139,67,108,76,40,40,76,108,251,210,39,60,56,97,89,24,28,24,39,59,55,97,89,
+24,28,24,0,0,3,0,68,1,225,4,170,4,37,0,17,0,29,0,41,0,0,1,20,14,2,35,34,38,
+53,52,62,2,51,50,30,2,37,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,
+35,34,38,53,52,54,3,150,42,77,107,65,140,151,43,77,107,64,63,107,77,44,253,
+20,50,52,52,50,48,54,54,3,202,49,53,53,49,48,55,55,3,2,69,108,73,39,150,139,
+67,108,76,40,40,76,108,44,56,47,49,53,57,45,45,58,56,47,49,53,57,45,45,58,
+0,0,1,0,90,255,233,6,227,5,205,0,119,0,0,1,20,14,2,21,20,22,23,7,46,3,53,
+52,62,2,53,52,46,2,39,38,38,39,35,14,3,35,34,46,2,39,51,22,22,51,50,62,2,
+55,51,20,22,23,62,3,53,52,46,4,53,52,62,2,55,23,14,3,21,20,30,2,21,20,14,
+2,7,62,3,55,51,30,3,51,50,54,55,51,14,3,35,34,46,2,39,35,14,3,7,30,3,4,35,
+32,37,32,62,59,104,41,74,55,33,38,47,38,15,22,24,9,53,91,22,8,23,63,70,72,
+32,74,110,73,40,4,160,3,80,79,37,60,44,25,2,159,43,35,7,26,26,19,17,25,29,
+25,17,29,51,72,43,90,23,43,34,21,35,43,35,33,42,39,7,38,64,46,28,2,160,1,
+29,45,60,33,86,69,5,159,5,44,76,106,68,32,76,73,66,23,8,15,44,54,62,32,15,
+28,23,14,1,201,48,67,53,43,23,32,52,35,127,19,41,50,59,36,44,67,58,54,31,
+26,47,48,51,31,17,79,74,52,71,43,18,38,90,148,111,122,130,27,60,96,69,87,
+107,27,37,57,53,53,35,27,41,34,31,35,44,30,35,66,56,45,15,101,11,23,26,28,
+16,28,41,49,68,54,49,75,63,59,34,1,30,60,94,67,69,96,60,27,123,129,111,148,
+90,38,18,43,71,52,45,65,42,24,4,16,34,41,50,0,4,0,158,255,236,5,193,5,205,
+0,19,0,39,0,43,0,101,0,0,1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,19,52,
+46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,51,17,35,5,20,14,2,35,34,46,2,53,
+52,62,2,55,53,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,23,54,54,51,51,53,51,
+17,35,53,35,34,46,2,39,7,30,3,2,184,29,51,68,38,37,66,51,30,27,49,68,40,40,
+68,50,28,9,31,53,71,40,39,70,53,31,28,51,71,43,42,72,52,29,2,96,160,160,254,
+63,59,98,128,69,70,127,97,58,39,63,82,43,44,79,60,36,60,98,123,63,65,125,
+97,59,32,48,57,25,2,56,166,102,29,159,159,29,51,94,84,70,25,2,25,59,51,35,
+4,70,66,95,62,29,29,62,95,66,66,106,75,40,40,75,106,253,115,69,111,77,42,
+42,77,111,69,69,98,61,28,28,61,98,2,177,254,17,125,102,149,97,47,47,97,149,
+102,68,116,91,64,17,8,15,67,93,115,65,100,147,97,47,47,97,147,100,53,97,79,
+54,10,8,11,7,184,254,17,172,1,4,7,6,8,10,52,80,104,0,0,6,0,158,255,236,6,
+80,5,205,0,19,0,39,0,43,0,55,0,67,0,125,0,0,1,52,46,2,35,34,14,2,21,20,30,
+2,51,50,62,2,19,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,51,17,35,1,20,
+6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,5,20,14,2,
+35,34,46,2,53,52,62,2,55,53,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,23,54,
+54,51,51,53,51,17,35,53,35,34,46,2,39,7,30,3,2,184,29,51,68,38,37,66,51,30,
+27,49,68,40,40,68,50,28,9,31,53,71,40,39,70,53,31,28,51,71,43,42,72,52,29,
+2,239,160,160,254,178,56,46,50,52,57,45,45,57,56,46,50,52,57,45,45,57,254,
+254,59,98,128,69,70,127,97,58,39,63,82,43,44,79,60,36,60,98,123,63,65,125,
+97,59,32,48,57,25,2,56,166,102,172,160,160,172,51,94,84,70,25,2,25,59,51,
+35,4,70,66,95,62,29,29,62,95,66,66,106,75,40,40,75,106,253,115,69,111,77,
+42,42,77,111,69,69,98,61,28,28,61,98,2,177,254,17,2,55,50,52,52,50,48,54,
+54,253,69,50,53,53,50,48,54,54,89,102,149,97,47,47,97,149,102,68,116,91,64,
+17,8,15,67,93,115,65,100,147,97,47,47,97,147,100,53,97,79,54,10,8,11,7,184,
+254,17,172,1,4,7,6,8,10,52,80,104,0,0,3,0,68,255,236,5,4,5,203,0,9,0,29,0,
+41,0,0,5,9,3,23,9,4,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,38,35,34,
+6,21,20,22,51,50,54,4,193,252,165,2,82,253,183,3,82,65,253,186,2,37,253,193,
+2,98,253,2,34,61,83,49,50,82,59,32,32,59,82,50,48,83,61,35,125,57,45,45,58,
+53,50,46,56,20,1,139,1,119,1,88,1,133,127,254,235,254,185,254,163,254,215,
+2,130,53,81,57,29,29,56,81,51,51,80,56,29,29,55,79,53,48,55,55,48,49,53,53,
+0,4,0,68,255,236,5,236,5,203,0,9,0,29,0,41,0,53,0,0,5,9,3,23,9,4,20,14,2,
+35,34,46,2,53,52,62,2,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,37,20,
+6,35,34,38,53,52,54,51,50,22,4,193,252,165,2,82,253,183,3,82,65,253,186,2,
+37,253,193,2,98,253,2,34,61,83,49,50,82,59,32,32,59,82,50,48,83,61,35,125,
+57,45,45,58,53,50,46,56,4,99,56,47,49,53,57,45,45,58,20,1,139,1,119,1,88,
+1,133,127,254,235,254,185,254,163,254,215,2,130,53,81,57,29,29,56,81,51,51,
+80,56,29,29,55,79,53,48,55,55,48,49,53,53,49,49,53,53,49,48,55,55,0,2,0,158,
+255,236,4,150,5,182,0,35,0,55,0,0,1,21,33,6,6,7,33,21,33,6,6,7,23,54,54,51,
+50,30,2,21,20,14,2,35,34,46,2,53,52,18,18,54,55,3,20,30,2,51,50,62,2,53,52,
+46,2,35,34,14,2,4,150,253,135,17,31,14,2,19,253,174,35,46,11,6,45,128,79,
+65,118,89,53,66,112,149,84,64,121,95,58,52,87,114,62,156,10,41,82,72,44,82,
+64,38,22,48,77,56,42,69,57,45,5,182,141,25,52,27,142,97,229,141,2,48,67,45,
+91,135,90,89,141,98,52,43,94,149,105,213,1,85,1,12,199,70,252,23,53,122,103,
+68,35,64,90,56,41,81,64,40,21,34,46,0,0,1,0,68,2,31,6,252,3,244,0,69,0,0,
+1,34,46,2,39,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,39,55,30,3,51,50,62,
+2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,55,23,14,
+3,5,174,32,76,73,66,23,8,20,57,67,75,39,39,82,73,59,16,8,23,63,70,72,32,52,
+96,81,63,21,125,10,41,55,66,36,39,62,43,24,160,27,49,70,43,43,69,49,27,160,
+33,54,67,34,36,66,55,41,11,125,21,66,86,103,2,31,18,43,71,52,54,71,42,17,
+17,42,71,54,52,71,43,18,40,70,97,57,63,31,64,53,34,26,61,99,74,64,64,74,102,
+65,29,29,65,102,74,64,64,74,99,61,26,34,53,64,31,63,57,97,70,40,0,0,3,0,68,
+2,31,6,252,5,20,0,11,0,23,0,93,0,0,1,20,6,35,34,38,53,52,54,51,50,22,5,20,
+6,35,34,38,53,52,54,51,50,22,19,34,46,2,39,35,14,3,35,34,46,2,39,35,14,3,
+35,34,46,2,39,55,30,3,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,
+21,20,30,2,51,50,62,2,55,23,14,3,2,238,56,47,49,53,57,45,45,58,2,26,56,46,
+50,53,58,45,45,57,166,32,76,73,66,23,8,20,57,67,75,39,39,82,73,59,16,8,23,
+63,70,72,32,52,96,81,63,21,125,10,41,55,66,36,39,62,43,24,160,27,49,70,43,
+43,69,49,27,160,33,54,67,34,36,66,55,41,11,125,21,66,86,103,4,174,49,53,53,
+49,48,54,54,48,49,53,53,49,48,54,54,253,65,18,43,71,52,54,71,42,17,17,42,
+71,54,52,71,43,18,40,70,97,57,63,31,64,53,34,26,61,99,74,64,64,74,102,65,
+29,29,65,102,74,64,64,74,99,61,26,34,53,64,31,63,57,97,70,40,0,0,3,0,68,0,
+236,6,252,5,20,0,11,0,23,0,93,0,0,1,20,6,35,34,38,53,52,54,51,50,22,17,20,
+6,35,34,38,53,52,54,51,50,22,37,34,46,2,39,35,14,3,35,34,46,2,39,35,14,3,
+35,34,46,2,39,55,30,3,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,
+21,20,30,2,51,50,62,2,55,23,14,3,3,252,56,46,50,53,58,45,45,57,56,46,50,53,
+58,45,45,57,1,178,32,76,73,66,23,8,20,57,67,75,39,39,82,73,59,16,8,23,63,
+70,72,32,52,96,81,63,21,125,10,41,55,66,36,39,62,43,24,160,27,49,70,43,43,
+69,49,27,160,33,54,67,34,36,66,55,41,11,125,21,66,86,103,4,174,49,53,53,49,
+48,54,54,252,116,50,52,52,50,48,54,54,157,18,43,71,52,54,71,42,17,17,42,71,
+54,52,71,43,18,40,70,97,57,63,31,64,53,34,26,61,99,74,64,64,74,102,65,29,
+29,65,102,74,64,64,74,99,61,26,34,53,64,31,63,57,97,70,40,0,2,0,135,255,233,
+3,223,5,205,0,33,0,56,0,0,1,20,14,4,35,34,46,2,53,52,26,2,55,23,14,3,7,23,
+62,3,51,50,30,2,37,34,14,2,7,6,6,21,20,30,2,51,50,62,2,53,52,46,2,3,223,40,
+69,91,102,107,50,91,147,103,56,86,146,195,108,131,70,135,119,98,33,6,21,55,
+64,71,37,81,143,106,61,254,119,50,90,76,60,19,5,3,33,62,88,54,55,108,84,52,
+37,64,84,1,152,68,116,96,74,51,26,56,105,150,93,120,1,15,1,27,1,34,140,74,
+90,191,192,189,87,5,27,49,36,22,50,98,142,150,28,46,60,32,29,46,29,61,97,
+69,37,37,74,108,72,60,91,61,31,0,0,3,0,135,255,233,3,223,5,205,0,33,0,56,
+0,68,0,0,1,20,14,4,35,34,46,2,53,52,26,2,55,23,14,3,7,23,62,3,51,50,30,2,
+37,34,14,2,7,6,6,21,20,30,2,51,50,62,2,53,52,46,2,19,20,6,35,34,38,53,52,
+54,51,50,22,3,223,40,69,91,102,107,50,91,147,103,56,86,146,195,108,131,70,
+135,119,98,33,6,21,55,64,71,37,81,143,106,61,254,119,50,90,76,60,19,5,3,33,
+62,88,54,55,108,84,52,37,64,84,18,56,47,49,53,57,45,45,58,1,152,68,116,96,
+74,51,26,56,105,150,93,120,1,15,1,27,1,34,140,74,90,191,192,189,87,5,27,49,
+36,22,50,98,142,150,28,46,60,32,29,46,29,61,97,69,37,37,74,108,72,60,91,61,
+31,255,0,49,53,53,49,48,55,55,0,0,4,0,113,255,236,7,86,5,182,0,70,0,88,0,
+100,0,112,0,0,1,52,62,2,55,53,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,
+53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,33,53,
+51,17,35,53,33,21,16,2,35,34,46,2,23,50,62,2,53,53,14,5,21,20,30,2,1,20,6,
+35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,3,20,36,89,
+150,113,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,
+104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,1,127,160,160,254,129,
+158,147,39,85,72,46,242,34,55,37,20,59,83,55,31,16,4,16,28,37,2,107,56,46,
+50,53,58,45,45,57,56,46,50,53,58,45,45,57,1,12,76,162,141,106,21,230,36,51,
+32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,
+186,190,72,102,63,29,38,78,118,81,141,253,90,185,254,16,172,127,254,246,254,
+240,32,70,109,72,40,93,153,113,115,13,48,61,70,72,68,29,39,58,37,19,1,65,
+49,53,53,49,48,55,55,1,249,49,53,53,49,48,55,55,0,2,0,180,255,236,5,223,5,
+209,0,21,0,43,0,0,1,34,14,2,21,20,30,2,51,7,34,36,38,2,53,52,18,54,36,51,
+5,34,14,2,21,20,30,2,51,7,34,36,38,2,53,52,18,54,36,51,5,223,125,202,144,
+78,70,139,205,135,10,174,254,251,175,88,99,182,1,2,159,253,164,125,202,144,
+78,70,138,206,135,10,174,254,251,176,88,99,183,1,2,159,5,70,90,164,229,138,
+141,226,158,85,139,104,194,1,21,174,170,1,24,200,110,139,90,164,229,138,141,
+226,158,85,139,104,194,1,21,174,170,1,24,200,110,0,0,1,0,158,0,2,4,100,5,
+199,0,62,0,0,19,17,55,22,22,51,50,54,53,52,38,35,34,6,7,39,62,3,51,50,30,
+2,21,20,6,33,34,39,21,37,17,7,38,38,35,34,6,21,20,22,51,50,62,2,55,23,6,6,
+35,32,38,53,52,54,33,50,22,23,53,160,114,56,172,119,164,180,179,165,112,193,
+78,58,40,89,106,128,78,128,189,125,61,247,255,0,190,122,3,33,113,57,167,111,
+166,179,180,165,55,111,104,94,39,57,80,223,157,254,255,247,247,1,1,89,148,
+62,2,70,1,219,78,48,36,68,77,74,69,27,32,117,19,31,21,11,40,74,105,64,134,
+140,43,217,165,254,37,80,42,30,69,74,77,69,7,14,23,16,117,38,44,151,134,129,
+143,19,20,228,0,2,0,68,255,236,4,219,5,182,0,21,0,35,0,0,1,17,20,14,2,35,
+34,38,53,52,62,2,51,17,51,17,33,17,35,17,1,50,54,53,17,34,14,2,21,20,30,2,
+3,43,46,91,135,90,182,199,81,152,216,134,160,1,176,160,253,134,102,100,114,
+161,102,47,31,58,82,2,166,254,229,98,154,106,57,192,203,118,168,108,50,2,
+131,253,125,252,205,2,166,253,209,134,140,1,29,25,67,118,93,55,93,69,39,0,
+0,6,0,115,0,0,3,236,5,199,0,22,0,42,0,54,0,66,0,78,0,90,0,0,1,20,14,2,7,17,
+35,17,46,3,53,52,62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,30,2,51,50,62,
+2,1,20,6,35,34,38,53,52,54,51,50,22,37,20,6,35,34,38,53,52,54,51,50,22,5,
+20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,3,236,57,
+99,134,77,160,79,133,96,54,73,123,161,87,87,161,123,74,160,49,80,102,54,54,
+103,80,48,45,77,104,59,56,103,79,47,254,51,56,46,50,53,58,45,45,57,2,43,56,
+46,50,53,58,45,45,57,253,213,56,46,50,53,58,45,45,57,2,43,56,46,50,53,58,
+45,45,57,4,4,92,149,112,71,12,253,176,2,80,12,72,112,149,91,100,167,118,66,
+66,118,167,100,70,114,82,45,45,82,114,70,70,112,79,42,42,79,112,252,250,49,
+53,53,49,48,55,55,229,50,53,53,50,48,54,54,48,50,53,53,50,48,54,54,254,187,
+49,53,53,49,48,55,55,0,0,2,0,47,1,20,5,143,5,39,0,53,0,73,0,0,1,50,62,2,55,
+23,14,3,35,34,38,39,6,6,35,34,46,2,39,55,30,3,51,50,50,55,46,3,53,52,62,2,
+51,50,30,2,21,20,14,2,7,22,22,3,34,14,2,21,20,30,2,23,62,3,53,52,46,2,3,160,
+62,108,93,82,36,114,44,99,119,144,89,50,94,45,42,87,47,89,152,127,106,42,
+125,34,84,98,113,62,11,31,9,42,72,54,30,45,82,118,74,74,118,83,45,30,52,73,
+42,16,38,177,41,61,39,19,26,47,65,39,36,54,35,18,19,39,60,1,160,27,71,120,
+93,59,116,151,89,36,24,22,22,24,35,87,150,116,63,93,120,71,27,2,41,104,120,
+136,74,82,154,118,72,57,109,159,101,68,131,121,107,44,3,3,2,252,49,80,104,
+54,62,125,114,95,32,32,95,114,125,62,54,104,80,49,0,4,0,47,0,0,5,145,5,39,
+0,19,0,31,0,43,0,97,0,0,1,34,14,2,21,20,30,2,23,62,3,53,52,46,2,5,20,6,35,
+34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,37,34,38,39,6,
+6,35,34,46,2,39,55,30,3,51,50,50,55,46,3,53,52,62,2,51,50,30,2,21,20,14,2,
+7,22,22,51,50,62,2,55,23,14,3,2,223,41,61,39,19,26,47,65,39,36,54,35,18,19,
+39,60,2,136,56,46,50,52,57,45,45,57,56,46,50,52,57,45,45,57,254,15,50,94,
+45,42,87,47,89,152,127,106,42,125,34,84,98,113,62,11,31,9,42,72,54,30,45,
+82,118,74,74,118,83,45,30,52,73,42,16,38,16,62,108,93,82,36,114,44,99,119,
+144,4,156,49,80,104,54,62,125,114,95,32,32,95,114,125,62,54,104,80,49,158,
+50,52,52,50,48,54,54,252,56,49,53,53,49,48,55,55,126,24,22,22,24,35,87,150,
+116,63,93,120,71,27,2,41,104,120,136,74,82,154,118,72,57,109,159,101,68,131,
+121,107,44,3,3,27,71,120,93,59,116,151,89,36,0,0,1,0,113,0,0,6,252,5,182,
+0,77,0,0,33,35,17,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,
+21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,
+34,46,2,39,35,17,35,17,35,14,3,35,34,46,2,39,35,2,250,160,8,21,47,47,46,19,
+72,113,76,40,159,81,81,39,62,43,24,160,27,49,69,43,43,70,49,27,159,24,44,
+62,38,82,80,160,40,77,112,72,16,47,51,48,18,9,159,9,21,47,47,46,19,16,47,
+51,48,18,8,3,215,35,43,26,9,44,105,174,130,139,141,162,153,29,64,103,74,186,
+186,74,103,64,29,29,64,103,74,186,186,74,103,64,29,153,162,141,139,130,174,
+105,44,8,25,44,36,252,41,3,215,35,43,26,9,8,25,44,36,0,3,0,113,0,0,6,252,
+5,197,0,11,0,23,0,101,0,0,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,
+38,53,52,54,51,50,22,1,35,17,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,
+2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,
+20,14,2,35,34,46,2,39,35,17,35,17,35,14,3,35,34,46,2,39,35,4,25,56,47,49,
+53,57,45,45,58,56,47,49,53,57,45,45,58,254,225,160,8,21,47,47,46,19,72,113,
+76,40,159,81,81,39,62,43,24,160,27,49,69,43,43,70,49,27,159,24,44,62,38,82,
+80,160,40,77,112,72,16,47,51,48,18,9,159,9,21,47,47,46,19,16,47,51,48,18,
+8,5,94,49,53,53,49,48,55,55,251,190,50,53,53,50,48,54,54,254,132,3,10,35,
+43,25,9,44,105,173,130,139,141,162,153,29,64,103,74,186,186,74,103,64,29,
+29,64,103,74,186,186,74,103,64,29,153,162,141,139,130,173,105,44,8,24,44,
+36,252,246,3,10,35,43,25,9,8,24,44,36,0,1,0,113,255,233,6,37,5,205,0,63,0,
+0,1,14,3,35,34,46,2,53,52,18,55,38,38,39,35,14,3,35,34,46,2,53,53,51,21,20,
+22,51,50,62,2,53,53,51,21,20,30,2,23,54,54,55,23,6,2,2,6,21,20,30,2,51,50,
+54,55,6,37,26,86,113,136,75,92,147,103,56,76,68,50,88,22,8,23,64,73,81,40,
+72,118,85,46,159,104,89,34,65,49,30,160,22,39,54,32,68,165,91,131,101,184,
+139,82,33,62,88,55,111,150,38,1,96,87,138,98,52,56,105,150,93,114,1,0,134,
+15,81,74,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,186,190,
+62,93,63,37,7,118,239,118,74,131,254,240,254,246,251,110,61,97,69,37,142,
+128,0,0,1,0,113,0,0,7,27,5,182,0,86,0,0,1,35,14,3,35,34,46,2,39,35,14,3,35,
+34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,
+51,17,51,54,54,51,50,30,2,21,35,52,38,35,34,6,7,17,51,54,54,51,50,30,2,21,
+35,52,46,2,35,34,6,7,21,35,4,152,9,16,48,54,56,24,31,72,69,58,16,8,23,64,
+73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,
+159,11,29,77,45,72,119,85,46,160,99,83,45,75,22,11,29,77,45,72,119,85,46,
+160,26,48,67,41,45,75,22,159,3,236,36,51,32,15,17,43,71,54,53,70,44,18,44,
+104,171,128,145,145,158,153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,
+141,252,234,18,29,43,81,115,72,86,90,29,29,254,250,19,28,40,78,116,77,38,
+65,47,26,28,29,119,0,3,0,113,0,0,6,154,5,182,0,11,0,23,0,74,0,0,1,20,6,35,
+34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,19,35,14,3,35,34,
+46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,
+2,51,50,62,2,53,53,51,17,35,6,154,56,47,49,53,57,45,45,58,253,100,56,46,50,
+53,58,45,45,57,154,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,
+85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,159,2,92,49,
+53,53,49,48,55,55,48,49,53,53,49,48,55,55,1,96,36,51,32,15,17,43,71,54,53,
+70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,186,190,72,102,63,29,
+38,78,118,81,141,250,74,0,3,0,135,255,233,6,39,5,205,0,52,0,68,0,84,0,0,1,
+14,3,7,30,3,21,20,14,2,35,34,38,53,52,54,55,35,6,2,7,39,62,3,55,46,3,53,52,
+62,2,51,50,30,2,21,20,7,51,54,18,55,19,52,46,2,39,6,6,21,20,30,2,51,50,54,
+1,20,30,2,23,54,54,53,52,46,2,35,34,6,5,207,47,99,96,87,36,114,171,112,56,
+61,99,129,67,183,174,27,24,151,65,210,133,131,49,104,99,90,35,123,176,113,
+53,61,100,128,68,84,132,91,49,41,154,66,202,127,59,37,82,131,94,23,26,20,
+47,75,55,96,100,251,160,33,81,136,102,20,21,26,51,73,46,96,101,5,131,61,141,
+154,166,86,15,73,108,139,81,94,151,107,58,198,185,72,156,84,172,254,161,172,
+74,63,145,160,170,89,12,65,102,135,83,94,151,107,58,57,105,149,93,127,143,
+167,1,87,164,251,182,52,92,72,50,11,78,151,75,60,91,61,31,142,3,48,53,88,
+67,43,9,68,132,66,61,98,69,37,143,0,0,4,0,227,0,0,6,244,5,182,0,7,0,11,0,
+15,0,27,0,0,1,17,33,17,33,17,33,17,23,17,33,17,19,33,17,33,5,20,6,35,34,38,
+53,52,54,51,50,22,5,49,1,195,254,61,251,178,160,3,14,160,1,35,254,221,254,
+60,56,47,49,53,57,45,45,58,5,182,254,103,253,125,254,102,5,182,141,251,100,
+4,156,252,254,1,104,176,49,53,53,49,48,55,55,0,0,3,0,227,0,0,6,137,5,182,
+0,11,0,51,0,55,0,0,1,20,6,35,34,38,53,52,54,51,50,22,1,50,30,2,21,20,6,35,
+53,50,54,53,52,46,2,35,35,17,51,50,30,2,21,20,6,35,53,50,54,53,52,46,2,35,
+33,17,23,17,33,17,3,4,56,46,50,53,58,45,45,57,1,223,127,164,95,36,152,143,
+60,75,22,58,101,79,129,127,127,164,95,36,152,143,60,75,22,58,101,79,251,254,
+160,2,66,3,172,50,52,52,50,48,54,54,1,218,36,69,99,64,128,130,129,66,63,31,
+48,32,16,252,229,36,69,99,64,128,130,129,66,63,31,48,32,16,4,53,141,252,229,
+3,27,0,0,2,0,45,0,0,5,72,5,182,0,3,0,6,0,0,1,51,1,33,55,33,1,2,131,117,2,
+80,250,229,223,3,74,254,92,5,182,250,74,150,4,43,0,5,0,68,0,172,4,233,5,127,
+0,19,0,27,0,35,0,43,0,51,0,0,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,
+1,38,38,35,34,6,7,3,22,22,51,50,54,55,1,1,6,6,21,20,22,23,1,33,52,38,39,1,
+1,54,54,4,233,85,156,219,133,142,222,152,80,89,158,219,130,129,218,157,89,
+253,175,1,20,56,139,81,82,141,56,2,54,140,87,81,139,56,254,236,254,139,31,
+33,31,29,1,14,2,29,35,29,254,248,1,10,29,33,3,18,142,227,159,86,86,159,227,
+142,139,229,163,90,90,163,229,34,1,20,48,53,51,48,252,254,43,45,47,45,1,21,
+1,117,56,135,76,80,134,56,1,14,76,133,56,254,247,254,246,54,134,0,4,0,113,
+0,0,5,139,5,182,0,11,0,23,0,27,0,30,0,0,1,20,6,35,34,38,53,52,54,51,50,22,
+5,52,54,51,50,22,21,20,6,35,34,38,1,51,1,33,55,33,1,5,100,56,46,50,52,57,
+45,45,57,251,56,57,45,45,57,52,50,46,56,2,43,116,2,80,250,230,223,3,74,254,
+92,3,143,49,53,53,49,48,55,55,48,48,55,55,48,49,53,53,2,88,250,74,150,4,43,
+0,0,3,0,227,0,0,4,61,5,182,0,23,0,36,0,49,0,0,51,17,33,50,30,2,21,20,14,2,
+7,21,30,3,21,20,14,2,35,53,50,62,2,53,52,46,2,35,33,17,1,50,62,2,53,52,46,
+2,35,33,17,227,1,164,94,158,114,64,39,65,83,44,45,86,67,41,67,117,159,93,
+60,102,73,42,43,76,102,58,254,252,1,4,58,99,73,41,43,74,99,55,254,252,5,182,
+47,96,146,100,65,107,82,55,12,9,14,61,89,115,69,102,149,97,47,141,28,60,97,
+69,69,105,70,35,253,235,2,154,34,66,100,66,66,94,60,28,253,254,0,1,0,90,255,
+240,3,219,5,199,0,63,0,0,1,51,50,62,2,53,52,46,2,35,34,14,2,7,39,62,3,51,
+50,30,2,21,20,14,2,35,17,50,30,2,21,20,14,2,35,34,46,2,39,55,30,3,51,50,62,
+2,53,52,38,35,35,2,70,106,34,56,39,21,21,44,70,48,68,129,119,109,48,92,61,
+140,146,148,70,54,117,98,63,38,67,92,55,55,92,67,38,63,98,117,54,70,148,146,
+140,61,103,48,106,115,125,68,47,69,45,22,81,69,106,4,113,8,21,36,29,22,39,
+30,17,35,62,82,48,76,74,110,72,35,22,57,96,73,49,82,59,33,253,215,33,60,82,
+49,74,95,56,22,35,72,109,74,86,48,86,65,38,17,30,39,22,57,38,0,0,1,0,158,
+255,240,5,88,5,199,0,71,0,0,1,34,14,2,7,39,62,3,51,50,30,2,21,20,14,2,35,
+17,50,30,2,21,20,14,2,35,34,46,2,39,55,30,3,51,50,62,2,53,52,38,35,35,17,
+33,17,35,17,51,17,33,17,51,50,62,2,53,52,46,2,4,12,68,129,119,109,48,92,61,
+140,146,148,70,54,117,98,63,38,67,92,55,55,92,67,38,63,98,117,54,70,148,146,
+140,61,102,48,106,115,126,68,47,69,45,22,81,69,106,253,122,159,159,2,134,
+106,34,56,39,21,21,44,70,5,59,35,62,82,48,76,74,110,72,35,22,57,96,73,49,
+82,59,33,253,215,33,60,82,49,74,95,56,22,35,72,109,74,86,48,86,65,38,17,30,
+39,22,57,38,1,104,254,184,3,27,254,184,1,56,8,21,36,29,22,39,30,17,0,1,0,
+113,0,0,5,53,5,182,0,49,0,0,33,17,35,14,3,35,34,46,2,53,53,51,21,20,22,51,
+50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,
+17,2,131,8,21,53,56,52,19,72,118,85,46,159,101,82,38,69,51,30,160,30,51,69,
+38,82,101,159,46,85,118,72,16,54,58,55,18,8,3,215,35,43,26,9,44,105,174,130,
+139,141,161,154,29,64,103,74,186,186,74,103,64,29,154,161,141,139,130,174,
+105,44,8,25,44,36,252,41,0,1,0,113,0,0,5,53,5,182,0,57,0,0,1,35,14,3,35,34,
+46,2,53,53,51,21,20,22,51,50,62,2,53,53,33,53,33,21,33,21,20,30,2,51,50,54,
+53,53,51,21,20,14,2,35,34,46,2,39,35,17,33,21,33,53,33,2,131,8,21,53,56,52,
+19,72,118,85,46,159,101,82,38,69,51,30,254,242,2,188,254,242,30,51,69,38,
+82,101,159,46,85,118,72,16,54,58,55,18,8,1,55,252,242,1,55,3,215,35,43,26,
+9,44,105,174,130,139,141,161,154,29,64,103,74,45,141,141,45,74,103,64,29,
+154,161,141,139,130,174,105,44,8,25,44,36,252,182,141,141,0,0,3,0,113,0,0,
+5,55,5,182,0,50,0,62,0,74,0,0,1,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,
+53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,17,51,17,35,
+1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,4,152,
+9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,104,89,
+34,65,49,30,160,30,51,70,41,39,67,48,27,159,159,254,161,56,46,50,52,57,45,
+45,57,56,46,50,52,57,45,45,57,2,147,36,51,31,15,17,43,71,54,53,70,44,18,44,
+104,171,128,145,145,158,153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,
+1,229,250,74,5,23,50,53,53,50,48,54,54,252,74,49,53,53,49,48,55,55,0,0,4,
+0,113,0,0,6,207,5,182,0,3,0,15,0,27,0,78,0,0,33,35,17,51,5,20,6,35,34,38,
+53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,37,35,14,3,35,34,46,
+2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,
+51,50,62,2,53,17,51,17,35,6,207,160,160,252,106,56,46,50,52,57,45,45,57,56,
+46,50,52,57,45,45,57,1,95,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,
+72,118,85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,159,5,
+182,159,50,53,53,50,48,54,54,252,74,49,53,53,49,48,55,55,210,36,51,31,15,
+17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,186,190,
+72,102,63,29,38,78,118,81,1,229,250,74,0,0,2,0,227,0,0,5,68,5,182,0,11,0,
+15,0,0,1,33,21,33,17,33,21,33,17,35,17,51,1,35,17,51,3,29,2,39,253,217,2,
+39,253,217,160,160,254,102,160,160,3,248,139,254,241,139,254,45,5,182,250,
+74,5,182,0,3,0,227,254,180,5,68,5,182,0,11,0,15,0,39,0,0,1,33,21,33,17,33,
+21,33,17,35,17,51,1,35,17,51,1,34,6,7,39,54,54,51,50,30,2,51,50,54,55,23,
+6,6,35,34,46,2,3,29,2,39,253,217,2,39,253,217,160,160,254,102,160,160,1,70,
+48,75,31,94,38,121,97,45,98,93,84,32,48,75,31,94,38,121,97,43,96,93,86,3,
+248,139,254,241,139,254,45,5,182,250,74,5,182,249,97,39,60,56,97,89,24,28,
+24,39,59,55,97,89,24,28,24,0,0,3,0,227,0,0,6,172,5,182,0,24,0,28,0,32,0,0,
+19,33,50,62,2,53,52,46,2,35,53,50,30,2,21,20,14,2,35,17,33,1,17,33,17,1,17,
+33,17,227,4,37,72,100,61,27,23,55,91,68,109,151,95,42,48,102,159,111,251,
+219,2,99,1,34,254,62,254,221,4,12,23,39,54,32,31,55,40,23,129,39,72,103,64,
+64,106,77,42,252,129,3,127,253,14,2,242,253,14,2,242,253,14,0,0,5,0,227,0,
+0,6,172,5,182,0,24,0,28,0,32,0,44,0,56,0,0,19,33,50,62,2,53,52,46,2,35,53,
+50,30,2,21,20,14,2,35,17,33,1,17,33,17,1,17,33,17,1,20,6,35,34,38,53,52,54,
+51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,227,4,37,72,100,61,27,23,55,91,
+68,109,151,95,42,48,102,159,111,251,219,2,99,1,34,254,62,254,221,3,39,56,
+46,50,53,58,45,45,57,1,195,56,47,49,53,57,45,45,58,4,12,23,39,54,32,31,55,
+40,23,129,39,72,103,64,64,106,77,42,252,129,3,127,253,14,2,242,253,14,2,242,
+253,14,4,113,50,52,52,50,48,54,54,253,126,50,52,52,50,48,54,54,0,0,4,0,135,
+255,240,6,207,5,205,0,19,0,39,0,59,0,100,0,0,1,20,30,2,51,50,62,2,53,52,46,
+2,35,34,14,2,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,20,30,2,51,50,62,
+2,53,52,46,2,35,34,14,2,1,52,55,46,3,53,52,62,2,51,50,22,23,54,54,51,50,30,
+2,21,20,14,2,7,22,22,21,20,14,2,35,34,46,2,1,35,46,79,105,59,59,104,78,45,
+45,78,104,59,59,105,79,46,1,102,46,79,105,59,59,105,78,45,45,78,105,59,59,
+105,79,46,1,107,46,78,105,59,59,105,78,45,45,78,105,59,59,105,78,46,253,250,
+43,83,147,109,63,72,121,162,90,109,189,60,62,189,111,90,161,121,71,65,111,
+148,84,22,23,71,120,161,90,90,161,122,71,4,25,68,110,78,43,43,78,110,68,67,
+111,80,43,43,80,111,253,74,68,112,80,43,43,80,112,68,67,109,78,43,43,78,109,
+2,48,68,110,78,43,43,78,110,68,67,111,80,43,43,80,111,253,74,109,85,7,69,
+113,152,92,97,161,115,63,93,83,83,93,63,115,161,97,92,154,114,69,6,43,95,
+54,98,162,115,63,63,115,162,0,6,0,135,255,240,6,207,5,205,0,11,0,23,0,43,
+0,63,0,83,0,124,0,0,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,
+52,54,51,50,22,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,20,30,2,51,50,
+62,2,53,52,46,2,35,34,14,2,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,52,
+55,46,3,53,52,62,2,51,50,22,23,54,54,51,50,30,2,21,20,14,2,7,22,22,21,20,
+14,2,35,34,46,2,1,111,56,47,49,53,57,45,45,58,5,67,56,46,50,53,58,45,45,57,
+250,113,46,79,105,59,59,104,78,45,45,78,104,59,59,105,79,46,1,102,46,79,105,
+59,59,105,78,45,45,78,105,59,59,105,79,46,1,107,46,78,105,59,59,105,78,45,
+45,78,105,59,59,105,78,46,253,250,43,83,147,109,63,72,121,162,90,109,189,
+60,62,189,111,90,161,121,71,65,111,148,84,22,23,71,120,161,90,90,161,122,
+71,1,172,50,52,52,50,48,54,54,48,50,52,52,50,48,54,54,2,61,68,110,78,43,43,
+78,110,68,67,111,80,43,43,80,111,253,74,68,112,80,43,43,80,112,68,67,109,
+78,43,43,78,109,2,48,68,110,78,43,43,78,110,68,67,111,80,43,43,80,111,253,
+74,109,85,7,69,113,152,92,97,161,115,63,93,83,83,93,63,115,161,97,92,154,
+114,69,6,43,95,54,98,162,115,63,63,115,162,0,0,5,0,135,255,236,6,119,5,205,
+0,18,0,37,0,56,0,75,0,139,0,0,1,53,52,46,2,35,34,14,2,21,20,30,4,51,33,50,
+62,4,53,52,46,2,35,34,14,2,21,21,1,20,30,2,51,50,62,2,53,53,35,34,14,4,5,
+52,46,4,35,35,21,20,30,2,51,50,62,2,1,52,62,2,51,50,30,2,23,51,62,3,51,50,
+30,2,21,20,14,2,7,21,30,3,21,20,14,2,35,34,46,2,39,35,14,3,35,34,46,2,53,
+52,62,2,55,53,46,3,3,57,60,101,134,73,36,60,43,23,43,72,94,102,104,46,1,22,
+46,104,102,94,72,43,23,43,60,36,74,133,101,60,253,98,25,43,59,35,77,134,100,
+57,69,46,104,102,94,72,43,4,176,43,72,94,102,104,46,69,57,100,134,77,34,60,
+43,25,250,176,46,85,119,72,71,138,117,88,22,8,22,88,115,136,71,72,119,85,
+46,60,109,153,92,92,153,109,60,49,86,118,69,71,136,115,88,22,8,22,88,117,
+138,71,69,118,86,49,60,109,153,92,92,153,109,60,3,23,100,83,163,129,80,26,
+48,66,39,52,97,83,69,48,27,27,48,69,83,97,52,39,66,48,26,80,129,163,83,100,
+254,18,41,66,46,25,79,129,162,84,101,28,51,70,84,94,50,50,94,84,70,51,28,
+101,78,161,132,83,25,46,66,3,143,70,117,84,47,57,96,127,70,70,127,96,57,47,
+84,117,70,69,134,114,89,24,8,20,86,117,138,71,73,117,83,44,57,96,127,70,70,
+127,96,57,44,83,117,73,69,134,115,88,24,8,20,86,117,138,0,9,0,68,255,133,
+6,252,6,41,0,11,0,23,0,35,0,47,0,66,0,85,0,104,0,123,0,187,0,0,1,20,6,35,
+34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,
+53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,37,53,52,46,2,35,34,14,
+2,21,20,30,4,51,33,50,62,4,53,52,46,2,35,34,14,2,21,21,1,20,30,2,51,50,62,
+2,53,53,35,34,14,4,5,52,46,4,35,35,21,20,30,2,51,50,62,2,1,52,62,2,51,50,
+30,2,23,51,62,3,51,50,30,2,21,20,14,2,7,21,30,3,21,20,14,2,35,34,46,2,39,
+35,14,3,35,34,46,2,53,52,62,2,55,53,46,3,4,10,56,46,50,53,58,45,45,57,2,242,
+56,46,50,53,58,45,45,57,253,14,56,46,50,53,58,45,45,57,253,6,56,46,50,52,
+57,45,45,57,2,76,60,101,134,73,36,60,43,23,43,72,94,102,104,46,1,22,46,103,
+103,94,72,43,24,42,60,36,74,134,101,60,253,99,24,44,59,35,76,135,99,58,69,
+46,104,102,94,72,43,4,176,43,72,94,103,104,45,70,58,100,134,77,34,60,43,25,
+250,176,46,85,119,72,71,137,117,88,23,8,22,87,116,136,71,72,119,85,46,60,
+109,153,92,92,153,109,60,49,86,118,69,71,136,116,87,22,8,23,88,117,137,71,
+69,118,86,49,60,109,153,92,92,153,109,60,5,195,50,53,53,50,48,54,54,252,232,
+49,53,53,49,48,55,55,252,225,50,53,53,50,48,54,54,2,191,49,53,53,49,48,55,
+55,12,100,83,163,129,80,26,48,66,39,52,97,83,69,48,27,27,48,69,83,97,52,39,
+66,48,26,80,129,163,83,100,254,18,41,66,46,25,79,129,162,84,101,28,51,70,
+84,94,50,50,94,84,70,51,28,101,78,161,132,83,25,46,66,3,143,70,117,84,47,
+57,96,127,70,70,127,96,57,47,84,117,70,69,134,114,89,24,8,20,86,117,138,71,
+73,117,83,44,57,96,127,70,70,127,96,57,44,83,117,73,69,134,115,88,24,8,20,
+86,117,138,0,0,2,0,111,255,236,5,88,5,182,0,36,0,56,0,0,1,14,3,7,23,54,54,
+51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,5,39,37,54,54,55,5,39,1,3,20,
+30,2,51,50,62,2,53,52,46,2,35,34,14,2,3,244,46,75,58,39,10,7,45,128,78,66,
+118,89,53,66,112,150,84,64,121,95,58,19,18,254,21,51,2,67,22,54,29,253,131,
+49,3,55,156,10,41,82,72,44,82,63,38,21,48,77,56,42,69,57,45,5,55,67,151,177,
+208,124,2,48,67,45,91,135,90,89,141,98,52,43,94,149,105,128,225,99,186,133,
+219,79,132,57,239,131,1,57,252,23,53,122,103,68,35,64,90,56,41,81,64,40,21,
+34,46,0,0,1,0,70,0,0,5,223,5,182,0,43,0,0,1,33,1,35,1,46,5,39,7,30,5,21,17,
+35,17,52,62,4,55,39,14,5,7,1,35,1,33,53,33,5,27,254,174,2,22,180,254,238,
+18,40,41,38,33,22,5,8,2,4,3,4,2,1,160,1,2,3,4,4,3,8,5,22,31,37,41,41,20,254,
+233,163,2,34,254,175,4,4,5,41,250,215,2,172,43,108,119,121,112,96,34,2,21,
+85,112,129,126,116,42,253,84,2,172,42,116,127,130,111,86,19,2,33,93,108,118,
+118,113,48,253,82,5,41,141,0,0,3,0,70,0,0,5,33,5,205,0,59,0,68,0,77,0,0,33,
+35,3,46,5,39,7,30,5,21,17,35,17,52,62,4,55,39,14,5,7,3,35,1,33,53,52,62,2,
+51,50,22,23,51,54,54,51,50,30,2,21,21,33,19,34,14,2,21,33,52,38,33,34,6,21,
+51,52,46,2,5,33,172,185,17,41,42,39,32,22,3,8,2,4,3,4,2,1,160,1,2,3,4,4,3,
+9,3,21,30,38,42,43,19,187,163,1,198,254,195,39,72,102,63,82,112,17,8,20,112,
+75,66,106,73,40,254,186,39,21,44,34,22,1,0,72,254,25,60,69,254,18,33,46,1,
+203,43,108,118,122,112,96,34,2,21,85,112,129,126,116,42,254,53,1,203,40,115,
+127,130,113,86,20,2,34,92,109,118,118,112,48,254,51,4,72,59,93,126,78,33,
+68,53,57,64,34,78,126,92,59,1,14,23,40,52,30,63,82,82,63,31,54,38,22,0,0,
+1,0,68,255,233,6,55,5,205,0,107,0,0,1,14,3,35,34,46,2,53,52,54,55,6,34,35,
+34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,62,2,53,51,22,22,51,50,
+50,55,54,54,55,35,34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,62,2,
+53,51,30,3,51,50,54,55,54,54,55,23,6,2,2,6,21,20,30,2,51,50,54,55,6,55,25,
+86,113,137,75,92,146,104,55,30,29,6,12,6,31,59,54,46,17,8,23,49,54,59,31,
+70,109,75,40,159,21,38,52,31,31,51,37,20,158,2,80,71,14,27,12,31,73,40,15,
+30,60,53,46,17,9,22,49,54,59,31,70,109,76,40,160,22,39,52,29,29,51,37,22,
+157,1,27,42,55,29,19,40,19,43,94,49,131,101,183,139,82,33,62,88,54,112,150,
+37,1,96,87,138,98,52,56,105,150,93,71,155,81,2,17,42,71,54,52,71,43,18,39,
+88,142,104,69,92,55,22,28,59,89,62,122,116,2,66,132,69,17,42,71,54,52,71,
+43,18,39,87,142,104,69,91,55,22,28,58,89,62,61,89,59,28,1,3,65,128,63,74,
+131,254,240,254,246,251,110,61,97,69,37,142,128,0,1,0,90,0,0,4,125,5,203,
+0,33,0,0,1,14,3,21,20,30,2,51,50,62,2,55,51,17,35,17,35,14,3,35,34,46,2,53,
+52,54,55,1,113,32,46,29,14,45,76,101,56,73,153,131,93,13,160,160,8,37,110,
+132,144,71,78,144,109,66,101,83,5,113,30,57,58,62,35,64,88,55,24,36,60,77,
+42,251,145,3,186,36,64,48,28,39,87,142,103,102,170,62,0,2,0,68,255,236,6,
+70,5,197,0,54,0,74,0,0,19,52,62,2,51,50,30,2,21,20,14,2,7,23,33,62,3,51,50,
+30,2,21,20,14,2,35,34,46,2,39,33,53,62,3,53,52,46,2,35,34,14,2,21,1,20,30,
+2,51,50,62,2,53,52,46,2,35,34,14,2,131,46,84,120,74,71,126,93,54,64,122,176,
+111,2,2,43,13,66,95,119,65,74,132,100,59,59,100,132,74,66,120,96,65,11,252,
+209,141,214,145,73,31,51,67,37,47,67,42,20,2,243,34,58,74,41,40,75,57,35,
+35,57,75,40,41,74,58,34,4,72,81,139,102,59,38,87,141,103,86,195,188,164,55,
+6,65,106,75,40,52,95,132,81,81,132,95,52,41,76,108,67,142,60,167,188,196,
+87,66,88,53,22,39,66,89,51,253,12,51,83,59,32,32,59,83,51,51,83,59,32,32,
+59,83,0,6,0,158,0,0,5,84,5,182,0,43,0,47,0,58,0,69,0,80,0,91,0,0,33,34,46,
+2,53,52,62,2,55,53,46,3,53,52,62,2,51,33,50,30,2,21,20,14,2,7,21,30,3,21,
+20,14,2,35,37,51,17,35,1,52,46,2,39,17,62,3,37,20,30,2,23,17,14,3,19,20,30,
+2,23,17,14,3,5,52,46,2,39,17,62,3,2,82,93,160,117,66,41,67,86,45,44,83,64,
+40,64,114,158,94,1,74,94,158,114,64,40,65,83,44,45,87,67,41,67,117,159,93,
+254,239,211,211,2,37,28,50,69,41,42,69,50,27,252,137,27,50,70,42,42,69,50,
+28,9,26,48,66,40,39,66,48,27,3,102,27,48,66,39,40,66,48,26,47,97,149,102,
+69,115,89,61,14,9,12,55,82,107,65,100,146,96,47,47,96,146,100,65,107,82,55,
+12,9,14,61,89,115,69,102,149,97,47,141,4,156,252,98,55,89,67,44,12,254,0,
+8,37,60,84,56,56,84,60,37,8,2,0,12,44,67,89,2,111,52,84,65,43,12,1,238,10,
+39,58,80,51,51,80,58,39,10,254,18,12,43,65,84,0,2,0,133,255,246,7,14,5,182,
+0,103,0,127,0,0,37,14,3,35,34,46,2,39,35,14,3,35,34,46,2,39,51,22,22,51,50,
+62,2,53,17,35,14,3,35,34,46,2,39,51,22,22,51,50,62,2,55,51,30,3,51,50,62,
+2,55,51,30,3,51,50,54,55,51,14,3,35,34,46,2,39,35,17,20,30,2,51,50,54,55,
+51,14,3,35,34,46,2,39,1,34,46,2,39,35,17,20,30,2,51,50,62,2,53,17,35,14,3,
+4,205,18,55,69,77,39,39,82,73,59,16,8,23,63,70,72,32,74,110,73,40,4,160,3,
+80,79,37,61,45,25,9,12,45,52,52,19,74,110,73,40,4,160,3,80,79,37,60,44,25,
+2,159,1,27,50,69,42,40,68,49,29,2,160,1,29,45,60,33,86,69,5,159,5,44,76,106,
+68,19,52,52,45,12,8,28,46,61,33,86,69,5,159,5,44,76,106,68,32,76,73,66,23,
+254,246,19,52,52,45,12,9,27,50,70,42,40,69,51,28,8,12,45,52,52,174,54,71,
+42,17,17,42,71,54,52,71,43,18,38,90,148,111,122,130,28,60,96,68,3,37,29,40,
+26,12,38,90,148,111,122,130,28,60,96,68,69,96,60,27,27,60,96,69,69,96,60,
+27,123,129,111,148,90,38,12,26,40,29,252,219,69,96,60,27,123,129,111,148,
+90,38,18,43,71,52,3,133,12,26,40,29,252,219,69,96,60,27,27,60,96,69,3,37,
+29,40,26,12,0,0,3,0,113,0,0,5,106,5,211,0,63,0,74,0,85,0,0,33,46,3,39,6,6,
+35,34,38,39,14,3,7,35,62,3,55,46,3,53,52,62,2,51,50,30,2,23,22,22,51,50,54,
+55,62,3,51,50,30,2,21,20,14,2,7,30,3,23,1,20,30,2,23,38,38,35,34,6,37,34,
+6,7,62,3,53,52,38,4,135,43,74,57,36,5,46,102,57,51,91,42,5,36,57,77,48,176,
+48,84,64,39,4,77,107,68,30,33,56,72,39,69,92,56,25,2,38,92,52,59,101,43,1,
+25,56,93,69,39,72,56,33,33,69,108,74,4,39,64,85,49,251,189,14,35,57,43,3,
+40,45,28,33,3,166,45,42,3,42,58,35,16,32,78,207,230,241,112,8,6,5,5,111,237,
+228,207,81,78,210,237,252,122,26,76,94,109,60,69,88,51,19,63,123,182,119,
+7,4,6,7,117,180,124,64,19,51,88,69,59,107,92,75,26,121,249,237,213,85,4,236,
+31,63,59,52,19,158,158,40,40,158,158,18,51,58,65,32,52,40,0,0,1,0,135,0,0,
+4,98,5,182,0,11,0,0,1,33,17,33,21,33,53,33,17,33,53,33,4,98,254,99,1,157,
+252,37,1,158,254,98,3,219,5,41,251,100,141,141,4,156,141,0,0,2,0,68,0,0,6,
+223,5,182,0,47,0,51,0,0,1,17,33,17,33,17,35,6,6,35,34,46,2,39,35,14,3,35,
+34,46,2,53,51,20,30,2,51,50,62,2,53,51,30,3,51,50,62,2,55,1,17,33,17,4,88,
+2,135,252,217,8,25,92,51,24,53,51,45,17,8,23,49,54,59,31,70,109,75,40,159,
+22,39,52,29,29,51,37,22,158,1,26,41,52,27,29,49,37,22,2,2,135,254,25,5,182,
+253,230,252,100,4,172,57,49,17,42,71,54,52,71,43,18,39,87,142,104,69,91,55,
+22,28,58,89,62,61,89,59,28,26,56,90,65,250,215,2,131,253,125,0,1,0,68,0,0,
+5,20,5,182,0,21,0,0,1,17,33,53,51,17,35,53,33,17,33,21,33,53,33,17,33,21,
+35,17,51,21,3,51,1,66,159,159,254,190,1,55,252,242,1,55,254,80,159,159,4,
+254,253,192,185,254,16,172,254,90,141,141,3,230,172,1,239,184,0,3,0,68,0,
+0,5,82,5,182,0,21,0,33,0,45,0,0,1,17,33,53,51,17,35,53,33,17,33,21,33,53,
+33,17,33,21,35,17,51,21,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,
+53,52,54,51,50,22,3,51,1,127,160,160,254,129,1,55,252,242,1,55,254,80,159,
+159,3,117,56,46,50,53,58,45,45,57,56,46,50,53,58,45,45,57,4,254,253,192,185,
+254,16,172,254,90,141,141,3,230,172,1,239,184,252,104,49,53,53,49,48,55,55,
+1,249,49,53,53,49,48,55,55,0,1,0,68,0,0,4,195,5,182,0,29,0,0,1,17,51,53,51,
+17,35,53,35,17,33,21,33,53,33,17,35,21,35,17,51,21,51,17,33,21,35,17,51,21,
+3,51,240,160,160,240,1,55,252,242,1,55,247,160,160,247,254,80,159,159,4,254,
+253,192,185,254,16,172,254,90,141,141,1,166,172,1,240,185,1,181,172,1,239,
+184,0,1,0,68,0,0,5,4,5,182,0,21,0,0,1,53,51,17,35,53,35,17,51,21,33,53,51,
+17,33,17,35,53,33,21,35,17,4,100,160,160,239,250,253,108,250,254,104,249,
+2,147,250,3,16,185,254,16,172,254,8,141,141,1,248,2,164,141,141,253,231,0,
+0,3,0,68,0,0,5,147,5,182,0,21,0,33,0,45,0,0,1,51,17,35,53,33,17,51,21,33,
+53,51,17,33,17,35,53,33,21,35,17,33,3,20,6,35,34,38,53,52,54,51,50,22,17,
+20,6,35,34,38,53,52,54,51,50,22,4,244,159,159,254,129,250,253,108,250,254,
+104,249,2,147,250,3,23,90,56,47,49,53,57,45,45,58,56,47,49,53,57,45,45,58,
+3,201,254,16,172,254,8,141,141,1,248,2,164,141,141,253,231,254,168,49,53,
+53,49,48,55,55,1,249,49,53,53,49,48,55,55,0,1,0,113,255,236,4,23,5,205,0,
+61,0,0,1,38,38,35,34,14,2,21,20,30,2,23,30,3,21,20,14,2,35,34,38,39,21,35,
+17,51,17,22,22,51,50,62,2,53,52,46,2,39,46,3,53,52,62,2,51,50,22,23,53,51,
+17,35,3,92,49,126,81,68,112,80,43,41,86,130,89,97,149,102,52,73,137,193,120,
+80,122,50,159,159,51,129,80,82,130,92,49,40,89,139,99,94,141,95,47,68,124,
+171,104,81,122,49,160,160,4,252,25,40,37,64,84,48,55,81,67,59,33,36,76,97,
+127,86,98,152,106,55,32,23,55,1,239,254,223,26,41,39,69,93,55,54,80,68,63,
+36,34,80,103,132,85,87,138,96,52,30,23,55,254,16,0,3,0,113,255,236,4,23,5,
+205,0,61,0,73,0,85,0,0,1,38,38,35,34,14,2,21,20,30,2,23,30,3,21,20,14,2,35,
+34,38,39,21,35,17,51,17,22,22,51,50,62,2,53,52,46,2,39,46,3,53,52,62,2,51,
+50,22,23,53,51,17,35,39,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,
+53,52,54,51,50,22,3,92,49,126,81,68,112,80,43,41,86,130,89,97,149,102,52,
+73,137,193,120,80,122,50,159,159,51,129,80,82,130,92,49,40,89,139,99,94,141,
+95,47,68,124,171,104,81,122,49,160,160,151,56,47,49,53,57,45,45,58,56,47,
+49,53,57,45,45,58,4,252,25,40,31,60,87,55,55,83,69,61,33,36,74,95,125,86,
+98,152,106,55,32,23,55,1,239,254,223,26,41,34,65,95,62,54,82,70,65,36,34,
+78,101,130,85,87,138,96,52,30,23,55,254,16,107,50,53,53,50,48,54,54,253,3,
+50,53,53,50,48,54,54,0,2,0,227,255,242,5,47,5,199,0,61,0,73,0,0,37,62,3,51,
+50,30,2,21,20,14,2,35,53,50,62,2,53,52,38,35,34,14,2,7,35,17,62,3,51,50,30,
+2,21,20,14,2,35,53,50,62,2,53,52,38,35,34,14,2,7,17,1,52,54,51,50,22,21,20,
+6,35,34,38,1,139,64,148,156,158,74,54,117,98,63,38,67,92,55,12,35,33,23,96,
+87,94,177,157,132,48,160,82,188,198,202,98,54,117,98,63,38,67,92,55,12,35,
+33,23,96,87,94,177,157,132,48,1,29,57,45,45,58,53,50,46,56,190,60,102,73,
+42,22,56,96,74,49,85,63,36,129,8,21,36,29,45,63,58,91,113,55,4,35,93,154,
+111,62,26,60,99,73,49,82,60,33,129,8,22,36,29,45,63,58,91,113,55,252,202,
+2,84,48,55,55,48,49,53,53,0,0,1,0,68,1,240,6,213,3,254,0,37,0,0,1,20,14,2,
+35,34,38,39,33,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,33,54,54,51,50,30,
+2,6,213,41,74,100,59,106,139,20,253,162,10,48,70,88,50,61,99,71,39,39,71,
+99,61,49,87,69,49,12,2,96,20,139,104,58,100,74,42,2,250,63,99,68,36,102,94,
+47,73,50,26,36,68,98,62,61,98,67,36,26,48,70,44,89,99,36,67,96,0,2,0,135,
+0,0,4,68,5,178,0,5,0,9,0,0,1,51,1,1,35,9,4,2,45,117,1,162,254,90,117,254,
+94,1,234,1,45,254,190,254,211,5,178,253,39,253,39,2,217,253,221,2,17,2,55,
+253,242,0,0,4,0,68,0,0,6,20,5,178,0,11,0,23,0,29,0,33,0,0,1,20,6,35,34,38,
+53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,1,51,1,1,35,9,4,1,16,
+56,46,50,52,57,45,45,57,5,4,55,47,49,53,57,45,45,57,252,226,116,1,162,254,
+90,116,254,94,1,233,1,45,254,191,254,211,2,219,49,53,53,49,48,55,55,52,49,
+53,53,49,48,54,54,2,171,253,39,253,39,2,217,253,221,2,17,2,55,253,242,0,2,
+0,180,0,0,3,219,5,182,0,7,0,11,0,0,1,17,35,17,33,17,33,25,2,33,17,3,219,160,
+253,121,2,135,254,25,5,182,250,74,1,109,3,53,1,20,252,68,2,29,253,227,0,1,
+0,133,0,0,5,74,5,182,0,57,0,0,1,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,
+62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,
+33,21,33,17,35,17,33,53,33,2,152,9,21,53,55,52,19,72,119,85,46,160,101,81,
+39,68,52,30,159,30,52,68,39,81,101,160,46,85,119,72,16,53,59,55,18,8,1,56,
+254,200,159,254,200,1,56,3,215,35,43,26,9,44,105,174,130,139,141,161,154,
+29,64,103,74,186,186,74,103,64,29,154,161,141,139,130,174,105,44,8,25,44,
+36,254,100,141,254,82,1,174,141,0,0,1,0,133,0,0,5,74,5,182,0,65,0,0,1,33,
+53,33,17,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,
+2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,33,21,33,21,33,21,33,21,
+35,53,33,53,33,2,152,254,200,1,56,9,21,53,55,52,19,72,119,85,46,160,101,81,
+39,68,52,30,159,30,52,68,39,81,101,160,46,85,119,72,16,53,59,55,18,8,1,56,
+254,200,1,56,254,200,159,254,200,1,56,1,174,141,1,156,35,43,26,9,44,105,174,
+130,139,141,161,154,29,64,103,74,186,186,74,103,64,29,154,161,141,139,130,
+174,105,44,8,25,44,36,254,100,141,104,142,184,184,142,0,4,0,227,255,236,5,
+39,5,209,0,21,0,33,0,45,0,57,0,0,1,34,14,2,21,20,30,2,51,7,34,36,38,2,53,
+52,18,54,36,51,5,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,
+51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,5,39,125,202,144,78,70,138,206,
+135,10,174,254,251,176,88,99,183,1,2,159,252,147,56,46,50,53,58,45,45,57,
+56,46,50,53,58,45,45,57,56,46,50,53,58,45,45,57,5,70,90,164,229,138,141,226,
+158,85,139,104,194,1,21,174,170,1,24,200,110,129,50,53,53,50,48,54,54,250,
+228,49,53,53,49,48,55,55,2,65,50,52,52,50,48,54,54,0,5,0,227,255,236,5,39,
+5,209,0,21,0,33,0,45,0,57,0,69,0,0,1,34,14,2,21,20,30,2,51,7,34,36,38,2,53,
+52,18,54,36,51,5,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,
+51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,
+22,5,39,125,202,144,78,70,138,206,135,10,174,254,251,176,88,99,183,1,2,159,
+252,147,56,46,50,53,58,45,45,57,56,46,50,53,58,45,45,57,56,46,50,53,58,45,
+45,57,2,244,56,47,49,53,57,45,45,58,5,70,90,164,229,138,141,226,158,85,139,
+104,194,1,21,174,170,1,24,200,110,129,50,53,53,50,48,54,54,250,228,49,53,
+53,49,48,55,55,2,65,50,52,52,50,48,54,54,48,50,52,52,50,48,54,54,0,1,0,113,
+0,0,6,252,5,182,0,85,0,0,37,51,21,33,53,51,17,35,14,3,35,34,46,2,53,53,51,
+21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,
+50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,51,21,33,53,51,17,35,14,3,35,
+34,46,2,39,35,2,250,147,254,37,168,8,21,47,47,46,19,72,113,76,40,159,81,81,
+39,62,43,24,160,27,49,69,43,43,70,49,27,159,24,44,62,38,82,80,160,40,77,112,
+72,16,47,51,48,18,9,168,254,37,148,9,21,47,47,46,19,16,47,51,48,18,8,141,
+141,141,3,74,35,43,26,9,44,105,174,130,139,141,162,153,29,64,103,74,186,186,
+74,103,64,29,29,64,103,74,186,186,74,103,64,29,153,162,141,139,130,174,105,
+44,8,25,44,36,252,182,141,141,3,74,35,43,26,9,8,25,44,36,0,0,2,0,113,0,0,
+6,252,5,182,0,85,0,97,0,0,37,51,21,33,53,51,17,35,14,3,35,34,46,2,53,53,51,
+21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,
+50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,51,21,33,53,51,17,35,14,3,35,
+34,46,2,39,35,1,20,6,35,34,38,53,52,54,51,50,22,2,250,147,254,37,168,8,21,
+47,47,46,19,72,113,76,40,159,81,81,39,62,43,24,160,27,49,69,43,43,70,49,27,
+159,24,44,62,38,82,80,160,40,77,112,72,16,47,51,48,18,9,168,254,37,148,9,
+21,47,47,46,19,16,47,51,48,18,8,1,35,56,47,49,53,57,45,45,58,141,141,141,
+3,74,35,43,26,9,44,105,174,130,139,141,162,153,29,64,103,74,186,186,74,103,
+64,29,29,64,103,74,186,186,74,103,64,29,153,162,141,139,130,174,105,44,8,
+25,44,36,252,182,141,141,3,74,35,43,26,9,8,25,44,36,254,133,49,53,53,49,48,
+55,55,0,2,0,113,255,236,6,129,5,182,0,75,0,88,0,0,1,6,6,7,20,2,6,6,35,34,
+46,2,53,52,62,2,55,17,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,
+20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,62,3,55,17,35,
+37,14,3,21,20,22,51,50,62,2,5,225,48,85,37,34,70,107,73,39,80,63,40,44,87,
+130,86,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,
+104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,25,56,75,103,71,160,254,
+183,60,80,47,20,40,42,25,45,35,20,2,244,17,34,19,200,254,241,165,70,32,66,
+101,69,58,129,129,125,54,1,5,36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,
+128,145,145,158,153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,253,
+135,12,27,27,27,12,253,211,211,45,93,88,79,31,63,70,42,107,181,0,3,0,113,
+254,180,6,129,5,182,0,75,0,88,0,112,0,0,1,6,6,7,20,2,6,6,35,34,46,2,53,52,
+62,2,55,17,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,
+50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,62,3,55,17,35,37,14,3,
+21,20,22,51,50,62,2,1,34,6,7,39,54,54,51,50,30,2,51,50,54,55,23,6,6,35,34,
+46,2,5,225,48,85,37,34,70,107,73,39,80,63,40,44,87,130,86,9,16,48,54,56,24,
+31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,
+51,70,41,39,67,48,27,159,25,56,75,103,71,160,254,183,60,80,47,20,40,42,25,
+45,35,20,254,20,47,76,31,94,38,121,97,45,98,93,84,32,48,75,31,94,38,121,97,
+43,95,94,86,2,244,17,34,19,200,254,241,165,70,32,66,101,69,58,129,129,125,
+54,1,5,36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,
+29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,253,135,12,27,27,27,12,
+253,211,211,45,93,88,79,31,63,70,42,107,181,253,86,39,60,56,97,89,24,28,24,
+39,59,55,97,89,24,28,24,0,0,1,0,158,0,0,6,84,5,182,0,27,0,0,1,17,33,17,33,
+53,33,21,33,17,33,17,51,17,35,17,33,17,33,21,33,53,33,17,33,17,35,17,1,61,
+1,230,254,184,3,47,254,185,1,241,160,160,254,15,1,71,252,209,1,72,254,26,
+159,4,129,254,184,1,240,141,141,254,16,1,72,252,229,1,72,253,223,141,141,
+2,33,254,184,3,27,0,0,3,0,113,255,236,7,61,5,182,0,88,0,101,0,116,0,0,1,14,
+3,7,20,14,2,35,34,46,2,53,52,62,2,55,17,35,14,3,35,34,46,2,39,35,14,3,35,
+34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,
+51,17,54,54,51,32,21,20,14,2,35,34,46,2,53,52,54,55,1,50,62,2,53,14,3,21,
+20,22,1,34,34,7,6,6,21,20,22,51,50,54,53,52,38,5,145,9,17,21,25,18,29,67,
+109,79,39,80,63,40,44,87,130,86,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,
+81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,
+54,118,66,1,24,34,61,83,49,50,82,59,32,17,10,254,133,25,45,35,20,54,78,51,
+24,40,2,93,16,28,14,14,18,53,49,47,56,61,2,170,5,8,8,8,6,180,254,160,73,32,
+66,101,69,60,130,126,113,42,1,29,36,51,32,15,17,43,71,54,53,70,44,18,44,104,
+171,128,145,145,158,153,29,64,103,74,186,190,72,102,63,29,38,78,118,81,141,
+253,82,14,15,213,52,82,56,29,29,56,81,51,28,44,14,253,211,41,102,172,131,
+38,85,85,77,28,63,70,2,61,2,17,51,32,50,53,53,50,48,54,0,0,1,0,158,0,0,5,
+250,5,182,0,17,0,0,1,33,17,51,17,33,17,51,17,33,17,51,17,33,21,33,53,33,4,
+35,252,123,159,1,35,160,1,35,160,1,55,252,242,1,55,2,172,3,10,253,131,2,125,
+253,131,2,125,250,215,141,141,0,0,3,0,158,0,0,6,37,5,182,0,11,0,23,0,41,0,
+0,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,55,
+33,17,51,17,33,17,51,17,33,17,51,17,33,21,33,53,33,6,37,56,47,49,53,57,45,
+45,58,253,100,56,46,50,53,58,45,45,57,154,252,123,159,1,35,160,1,35,160,1,
+55,252,242,1,55,1,143,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,237,3,
+10,253,131,2,125,253,131,2,125,250,215,141,141,0,3,0,158,255,236,3,96,5,205,
+0,41,0,61,0,81,0,0,1,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,53,46,3,53,
+52,62,2,51,50,30,2,21,20,14,2,7,19,52,46,2,35,34,14,2,21,20,30,2,51,50,62,
+2,19,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,2,143,45,77,56,31,59,98,128,
+69,70,127,97,58,39,63,82,43,44,79,60,36,60,98,123,63,65,125,97,59,30,53,74,
+44,41,29,51,68,38,37,66,51,30,27,49,68,40,40,68,50,28,9,31,53,71,40,39,70,
+53,31,28,51,71,43,42,72,52,29,2,221,17,65,91,117,68,102,149,97,47,47,97,149,
+102,68,116,91,64,17,8,15,67,93,115,65,100,147,97,47,47,97,147,100,65,114,
+93,66,15,1,97,66,95,62,29,29,62,95,66,66,106,75,40,40,75,106,253,115,69,111,
+77,42,42,77,111,69,69,98,61,28,28,61,98,0,0,7,0,90,255,236,5,92,5,205,0,41,
+0,61,0,81,0,93,0,105,0,117,0,129,0,0,1,30,3,21,20,14,2,35,34,46,2,53,52,62,
+2,55,53,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,19,52,46,2,35,34,14,2,21,
+20,30,2,51,50,62,2,19,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,20,6,35,
+34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,
+53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,3,111,45,76,56,31,59,
+98,128,69,70,127,97,58,39,64,81,43,44,79,60,36,60,98,123,63,65,125,97,59,
+30,53,74,43,41,29,51,68,39,37,66,51,30,28,49,67,40,40,69,50,28,8,31,53,71,
+40,39,70,52,31,28,50,71,43,42,72,52,29,253,135,56,46,50,53,58,45,45,57,4,
+53,56,46,50,53,58,45,45,57,251,203,56,46,50,53,58,45,45,57,4,53,56,46,50,
+53,58,45,45,57,2,221,17,65,91,117,68,102,149,97,47,47,97,149,102,68,116,91,
+64,17,8,15,67,93,115,65,100,147,97,47,47,97,147,100,65,114,93,66,15,1,97,
+66,95,62,29,29,62,95,66,66,106,75,40,40,75,106,253,115,69,111,77,42,42,77,
+111,69,69,98,61,28,28,61,98,2,196,50,53,53,50,48,54,54,48,50,53,53,50,48,
+54,54,253,163,50,53,53,50,48,54,54,48,50,53,53,50,48,54,54,0,0,5,0,158,0,
+0,4,129,5,182,0,3,0,15,0,27,0,39,0,51,0,0,33,35,17,51,1,20,6,35,34,38,53,
+52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,
+51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,2,219,160,160,254,143,55,47,49,
+53,57,45,45,57,3,23,56,46,50,53,58,45,45,57,252,233,55,47,49,53,57,45,45,
+57,3,23,56,46,50,53,58,45,45,57,5,182,254,64,50,53,53,50,48,54,54,48,50,53,
+53,50,48,54,54,253,249,50,53,53,50,48,54,54,48,50,53,53,50,48,54,54,0,3,0,
+158,0,0,4,129,5,182,0,3,0,15,0,27,0,0,33,35,17,51,1,20,6,35,34,38,53,52,54,
+51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,2,219,160,160,254,143,55,47,49,
+53,57,45,45,57,3,23,56,46,50,53,58,45,45,57,5,182,253,115,50,52,52,50,48,
+54,54,48,50,52,52,50,48,54,54,0,0,4,0,227,0,0,5,244,5,182,0,3,0,15,0,27,0,
+31,0,0,33,35,17,51,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,
+54,51,50,22,1,35,17,51,4,100,159,159,254,164,56,46,50,53,58,45,45,57,2,236,
+56,47,49,53,57,45,45,58,251,143,160,160,5,182,253,115,50,52,52,50,48,54,54,
+48,50,52,52,50,48,54,54,252,167,5,182,0,0,3,0,227,0,0,3,102,5,182,0,3,0,15,
+0,27,0,0,33,35,17,51,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,
+52,54,51,50,22,1,131,160,160,1,227,56,46,50,52,57,45,45,57,56,46,50,52,57,
+45,45,57,5,182,254,64,50,53,53,50,48,54,54,253,249,50,53,53,50,48,54,54,0,
+4,0,113,0,0,5,106,5,211,0,46,0,63,0,74,0,85,0,0,51,62,3,55,46,3,53,52,62,
+2,51,50,30,2,23,22,22,51,50,54,55,62,3,51,50,30,2,21,20,14,2,7,30,3,23,39,
+46,3,39,6,6,35,34,38,39,14,3,7,3,20,30,2,23,38,38,35,34,6,37,34,6,7,62,3,
+53,52,38,156,48,84,64,39,4,77,107,68,30,33,56,72,39,69,92,56,25,2,38,92,52,
+59,101,43,1,25,56,93,69,39,72,56,33,33,69,108,74,4,39,64,85,49,249,30,52,
+39,25,4,46,102,57,51,91,42,5,25,39,54,33,147,14,35,57,43,3,40,45,28,33,3,
+166,45,42,3,42,58,35,16,32,78,210,237,252,122,26,76,94,109,60,69,88,51,19,
+63,123,182,119,7,4,6,7,117,180,124,64,19,51,88,69,59,107,92,75,26,121,249,
+237,213,85,141,78,180,189,190,90,8,6,5,5,90,189,186,179,79,4,95,31,63,59,
+52,19,158,158,40,40,158,158,18,51,58,65,32,52,40,0,4,0,113,0,0,6,51,5,211,
+0,50,0,63,0,74,0,85,0,0,55,62,3,55,46,3,53,52,62,2,51,50,30,2,23,22,22,51,
+50,54,55,62,3,51,50,30,2,21,20,14,2,7,22,18,23,51,53,51,17,35,53,37,38,2,
+39,6,6,35,34,38,39,6,2,7,3,20,30,2,23,38,38,35,34,6,37,34,6,7,62,3,53,52,
+38,242,32,54,41,24,2,77,107,68,30,33,56,72,39,69,92,56,25,2,38,92,52,59,101,
+43,1,25,56,93,69,39,72,56,33,33,69,108,74,5,55,46,219,160,160,254,121,38,
+48,6,46,102,57,51,91,42,6,50,40,207,14,35,57,43,3,40,45,28,33,3,166,45,42,
+3,42,58,35,16,32,172,78,178,187,192,92,26,76,94,109,60,69,88,51,19,63,123,
+182,119,7,4,6,7,117,180,124,64,19,51,88,69,59,107,92,75,26,149,254,207,140,
+185,254,16,172,139,133,1,32,136,8,6,5,5,134,254,226,133,3,181,31,63,59,52,
+19,158,158,40,40,158,158,18,51,58,65,32,52,40,0,1,0,68,0,0,4,172,5,182,0,
+15,0,0,1,33,17,35,17,33,17,35,17,33,53,33,17,33,53,33,2,252,1,176,160,254,
+240,160,254,223,1,33,253,232,2,184,4,0,252,0,3,115,253,90,2,166,141,1,41,
+141,0,3,0,68,1,20,6,213,4,219,0,37,0,49,0,61,0,0,1,20,14,2,35,34,38,39,33,
+14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,33,54,54,51,50,30,2,1,20,6,35,34,
+38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,6,213,41,74,100,59,
+106,139,20,253,162,10,48,70,88,50,61,99,71,39,39,71,99,61,49,87,69,49,12,
+2,96,20,139,104,58,100,74,42,253,27,56,47,49,53,57,45,45,58,56,47,49,53,57,
+45,45,58,2,250,63,99,68,36,102,94,47,73,50,26,36,68,98,62,61,98,67,36,26,
+48,70,44,89,99,36,67,96,254,68,50,53,53,50,48,54,54,2,202,50,53,53,50,48,
+54,54,0,4,0,113,255,236,7,172,5,182,0,87,0,101,0,113,0,125,0,0,1,34,6,7,21,
+16,2,35,34,46,2,53,52,62,2,55,17,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,
+53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,54,
+51,50,30,2,21,20,14,2,35,53,50,54,53,52,46,2,1,50,62,2,53,53,14,3,21,20,22,
+1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,6,6,
+59,103,45,138,146,39,80,63,40,44,88,129,86,9,16,48,54,56,24,31,72,69,58,16,
+8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,67,
+48,27,159,94,113,119,162,99,42,46,80,108,61,60,75,23,58,102,253,198,25,45,
+35,20,55,78,50,24,40,2,107,56,46,50,53,58,45,45,57,56,46,50,53,58,45,45,57,
+2,154,15,14,119,254,246,254,240,32,66,101,69,59,132,127,115,42,1,25,36,51,
+32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,
+186,190,72,102,63,29,38,78,118,81,141,253,86,25,33,66,100,67,64,96,65,33,
+129,66,63,31,48,32,16,253,221,40,93,153,113,47,35,84,84,79,31,63,70,1,65,
+49,53,53,49,48,55,55,2,14,50,53,53,50,48,54,54,0,0,5,0,158,0,0,4,252,5,182,
+0,11,0,23,0,35,0,47,0,59,0,0,1,33,17,33,21,33,53,33,17,33,53,33,1,20,6,35,
+34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,
+53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,4,188,254,99,1,157,252,
+37,1,158,254,98,3,219,252,174,55,47,49,53,57,45,45,57,3,146,56,46,50,53,58,
+45,45,57,252,110,55,47,49,53,57,45,45,57,3,146,56,46,50,53,58,45,45,57,5,
+41,251,100,141,141,4,156,141,254,64,50,53,53,50,48,54,54,48,50,53,53,50,48,
+54,54,253,249,50,53,53,50,48,54,54,48,50,53,53,50,48,54,54,0,0,3,0,113,0,
+0,5,254,5,182,0,53,0,65,0,77,0,0,1,17,35,14,3,35,34,46,2,53,53,51,21,20,22,
+51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,
+35,17,33,17,35,17,37,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,
+54,51,50,22,2,131,8,21,53,56,52,19,72,118,85,46,159,101,82,38,69,51,30,160,
+30,51,69,38,82,101,159,46,85,118,72,16,54,58,55,18,8,1,158,160,1,221,56,46,
+50,53,58,45,45,57,252,29,56,47,49,53,57,45,45,58,2,20,1,195,35,43,26,9,44,
+105,174,130,139,141,161,154,29,64,103,74,186,186,74,103,64,29,154,161,141,
+139,130,174,105,44,8,25,44,36,254,203,253,94,2,20,72,49,53,53,49,48,55,55,
+48,49,53,53,49,48,55,55,0,0,3,0,113,0,0,5,254,5,182,0,65,0,77,0,89,0,0,1,
+17,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,
+50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,33,17,33,21,33,21,33,21,33,
+53,33,53,33,53,33,53,37,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,
+52,54,51,50,22,2,131,8,21,53,56,52,19,72,118,85,46,159,101,82,38,69,51,30,
+160,30,51,69,38,82,101,159,46,85,118,72,16,54,58,55,18,8,1,158,1,55,254,201,
+1,55,252,241,1,56,254,200,1,56,1,221,56,46,50,53,58,45,45,57,252,29,56,47,
+49,53,57,45,45,58,2,20,1,195,35,43,26,9,44,105,174,130,139,141,161,154,29,
+64,103,74,186,186,74,103,64,29,154,161,141,139,130,174,105,44,8,25,44,36,
+254,203,254,225,141,105,141,141,105,141,145,72,49,53,53,49,48,55,55,48,49,
+53,53,49,48,55,55,0,0,1,0,113,0,0,5,248,5,182,0,57,0,0,1,35,14,3,35,34,46,
+2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,
+14,2,35,34,46,2,39,35,17,33,17,33,21,33,53,33,17,33,2,131,8,21,53,56,52,19,
+72,118,85,46,159,101,82,38,69,51,30,160,30,51,69,38,82,101,159,46,85,118,
+72,16,54,58,55,18,8,1,158,1,55,252,241,1,56,254,98,3,215,35,43,26,9,44,105,
+174,130,139,141,161,154,29,64,103,74,186,186,74,103,64,29,154,161,141,139,
+130,174,105,44,8,25,44,36,254,203,253,235,141,141,1,135,0,4,0,45,0,227,5,
+141,5,72,0,43,0,85,0,105,0,116,0,0,1,6,7,6,6,7,6,6,35,34,38,39,38,38,39,38,
+39,55,22,23,22,22,23,38,38,53,52,62,2,51,50,30,2,21,20,6,7,54,54,55,54,55,
+39,52,46,2,35,34,14,2,21,20,22,23,22,50,51,50,54,55,38,38,53,52,62,2,51,50,
+22,21,20,6,7,22,22,51,50,50,55,54,54,37,20,30,2,23,62,3,53,52,46,2,35,34,
+14,2,19,50,55,38,38,39,6,6,7,22,22,5,141,30,38,32,89,52,70,228,147,158,228,
+68,52,86,32,37,29,70,12,15,13,37,23,11,11,81,144,199,118,118,198,144,81,14,
+11,24,37,13,15,12,236,57,101,140,83,84,140,102,57,27,24,16,29,17,42,84,32,
+69,79,32,65,96,65,129,129,81,66,31,83,43,16,28,16,26,29,254,0,12,30,49,38,
+37,49,30,13,17,32,49,31,32,48,32,17,131,129,92,65,110,48,49,113,65,46,114,
+2,39,21,20,17,37,12,105,112,112,105,13,37,17,19,21,108,9,10,8,21,11,43,92,
+51,127,208,149,82,82,149,208,127,51,92,43,11,21,8,10,9,127,95,157,112,62,
+62,112,157,95,69,119,49,2,15,11,59,136,84,58,99,72,41,144,126,84,136,59,11,
+15,2,49,119,135,23,59,63,63,26,26,63,63,59,23,31,53,40,23,23,41,53,253,253,
+65,6,38,22,22,40,6,31,32,0,1,0,113,0,0,5,53,5,182,0,53,0,0,1,17,35,14,3,35,
+34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,
+21,20,14,2,35,34,46,2,39,35,17,33,17,35,17,2,131,8,21,53,56,52,19,72,118,
+85,46,159,101,82,38,69,51,30,160,30,51,69,38,82,101,159,46,85,118,72,16,54,
+58,55,18,8,1,158,160,2,20,1,195,35,43,26,9,44,105,174,130,139,141,161,154,
+29,64,103,74,186,186,74,103,64,29,154,161,141,139,130,174,105,44,8,25,44,
+36,254,203,253,94,2,20,0,0,1,0,113,0,0,5,248,5,182,0,65,0,0,1,17,35,14,3,
+35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,
+51,21,20,14,2,35,34,46,2,39,35,17,33,17,33,21,33,21,33,21,33,53,33,53,33,
+53,33,53,2,131,8,21,53,56,52,19,72,118,85,46,159,101,82,38,69,51,30,160,30,
+51,69,38,82,101,159,46,85,118,72,16,54,58,55,18,8,1,158,1,55,254,201,1,55,
+252,241,1,56,254,200,1,56,2,20,1,195,35,43,26,9,44,105,174,130,139,141,161,
+154,29,64,103,74,186,186,74,103,64,29,154,161,141,139,130,174,105,44,8,25,
+44,36,254,203,254,225,141,105,141,141,105,141,145,0,0,2,0,90,0,0,5,248,5,
+182,0,27,0,31,0,0,1,17,33,21,33,17,33,21,33,17,35,17,33,17,35,17,33,53,33,
+17,33,53,33,17,51,17,33,17,1,33,17,33,4,172,1,76,254,180,1,76,254,180,160,
+254,58,160,254,180,1,76,254,180,1,76,160,1,198,254,58,1,198,254,58,5,182,
+254,150,142,254,58,142,254,150,1,106,254,150,1,106,142,1,198,142,1,106,254,
+150,1,106,252,66,1,198,0,0,6,0,68,255,236,6,203,5,197,0,19,0,39,0,59,0,79,
+0,99,0,119,0,0,1,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,55,20,30,2,51,50,
+62,2,53,52,46,2,35,34,14,2,1,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,55,
+20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,52,62,2,51,50,30,2,21,20,14,2,
+35,34,46,2,55,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,3,242,59,99,132,74,
+74,132,100,59,59,100,132,74,74,132,99,59,157,34,58,74,41,40,75,57,35,35,57,
+75,40,41,74,58,34,253,140,59,99,132,74,74,132,100,59,59,100,132,74,74,132,
+99,59,157,34,58,74,41,40,75,57,35,35,57,75,40,41,74,58,34,253,140,59,99,132,
+74,74,132,100,59,59,100,132,74,74,132,99,59,157,34,58,74,41,40,75,57,35,35,
+57,75,40,41,74,58,34,4,92,81,133,95,52,52,95,133,81,81,132,95,52,52,95,132,
+81,51,83,59,32,32,59,83,51,51,83,59,32,32,59,83,252,197,81,132,95,52,52,95,
+132,81,81,132,95,52,52,95,132,81,51,83,59,32,32,59,83,51,51,83,59,32,32,59,
+83,2,213,81,133,95,52,52,95,133,81,81,132,95,52,52,95,132,81,51,83,59,32,
+32,59,83,51,51,83,59,32,32,59,83,0,3,0,158,255,236,5,186,5,205,0,19,0,39,
+0,111,0,0,1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,19,52,46,2,35,34,14,
+2,21,20,30,2,51,50,62,2,1,34,46,2,39,7,30,3,21,20,14,2,35,34,46,2,53,52,62,
+2,55,53,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,23,54,54,51,51,50,30,2,21,
+20,14,2,35,53,50,54,53,52,46,2,35,2,184,29,51,68,38,37,66,51,30,27,49,68,
+40,40,68,50,28,9,31,53,71,40,39,70,53,31,28,51,71,43,42,72,52,29,1,59,51,
+94,84,70,25,2,25,59,51,35,59,98,128,69,70,127,97,58,39,63,82,43,44,79,60,
+36,60,98,123,63,65,125,97,59,32,48,57,25,2,56,166,102,24,119,162,99,42,46,
+80,108,61,60,76,22,58,101,79,4,70,66,95,62,29,29,62,95,66,66,106,75,40,40,
+75,106,253,115,69,111,77,42,42,77,111,69,69,98,61,28,28,61,98,1,110,1,4,7,
+6,8,10,52,80,104,61,102,149,97,47,47,97,149,102,68,116,91,64,17,8,15,67,93,
+115,65,100,147,97,47,47,97,147,100,53,97,79,54,10,8,11,7,33,66,100,67,64,
+96,65,33,129,66,63,31,48,32,16,0,5,0,158,255,236,5,250,5,205,0,19,0,39,0,
+51,0,63,0,135,0,0,1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,19,52,46,2,35,
+34,14,2,21,20,30,2,51,50,62,2,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,
+34,38,53,52,54,51,50,22,5,20,14,2,35,34,46,2,53,52,62,2,55,53,46,3,53,52,
+62,2,51,50,30,2,21,20,14,2,7,23,54,54,51,51,50,30,2,21,20,14,2,35,53,50,54,
+53,52,46,2,35,35,34,46,2,39,7,30,3,2,184,29,51,68,38,37,66,51,30,27,49,68,
+40,40,68,50,28,9,31,53,71,40,39,70,53,31,28,51,71,43,42,72,52,29,1,161,56,
+46,50,52,57,45,45,57,56,46,50,52,57,45,45,57,254,254,59,98,128,69,70,127,
+97,58,39,63,82,43,44,79,60,36,60,98,123,63,65,125,97,59,32,48,57,25,2,56,
+166,102,88,119,161,99,43,46,80,108,61,60,75,22,58,101,79,90,51,94,84,70,25,
+2,25,59,51,35,4,70,66,95,62,29,29,62,95,66,66,106,75,40,40,75,106,253,115,
+69,111,77,42,42,77,111,69,69,98,61,28,28,61,98,2,249,50,52,52,50,48,54,54,
+253,69,50,53,53,50,48,54,54,89,102,149,97,47,47,97,149,102,68,116,91,64,17,
+8,15,67,93,115,65,100,147,97,47,47,97,147,100,53,97,79,54,10,8,11,7,33,66,
+100,67,64,96,65,33,129,66,63,31,48,32,16,1,4,7,6,8,10,52,80,104,0,0,2,0,90,
+0,0,5,115,5,203,0,69,0,88,0,0,1,34,46,4,53,52,62,2,51,50,22,21,20,14,2,35,
+34,38,39,7,22,22,51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,
+2,35,34,46,2,39,35,17,33,21,33,53,33,17,35,14,3,3,34,6,21,20,22,23,30,3,51,
+50,62,2,53,52,38,1,139,28,68,68,63,49,29,36,62,81,44,100,119,29,50,68,39,
+28,32,14,6,25,100,66,43,76,56,32,159,30,52,68,39,118,105,160,53,92,125,72,
+23,62,64,57,16,8,1,56,252,241,1,56,9,21,55,67,76,100,42,50,5,3,8,23,24,22,
+7,20,30,21,11,51,3,102,12,30,50,74,102,68,69,104,69,35,109,110,45,71,49,26,
+9,10,5,49,32,26,63,103,78,104,104,78,103,63,26,153,162,59,57,130,174,105,
+44,11,25,44,33,252,182,141,141,3,74,35,43,26,9,1,242,57,56,26,37,14,7,10,
+6,2,20,31,41,21,53,49,0,4,0,90,0,0,5,115,5,203,0,11,0,23,0,93,0,114,0,0,1,
+20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,3,34,46,
+4,53,52,62,2,51,50,22,21,20,14,2,35,34,38,39,7,22,22,51,50,62,2,53,53,51,
+21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,33,21,33,53,33,
+17,35,14,3,3,34,6,21,20,22,23,30,3,51,50,62,2,53,52,46,2,4,154,56,47,49,53,
+57,45,45,58,253,100,56,46,50,53,58,45,45,57,115,28,68,68,63,49,29,36,62,81,
+44,100,119,29,50,68,39,28,32,14,6,26,99,66,43,76,56,32,159,30,52,68,39,118,
+105,160,53,92,125,72,23,62,64,57,16,8,1,56,252,241,1,56,9,21,55,67,76,100,
+42,50,5,3,8,23,24,22,7,20,30,21,11,14,23,30,2,51,49,53,53,49,48,55,55,48,
+49,53,53,49,48,55,55,1,3,12,30,50,74,102,68,69,104,69,35,109,110,45,71,49,
+26,9,10,5,50,31,26,63,103,78,104,104,78,103,63,26,153,162,59,57,130,174,105,
+44,11,25,44,33,252,182,141,141,3,74,35,43,26,9,1,242,57,56,26,37,14,7,10,
+6,2,20,31,41,21,31,39,23,9,0,0,3,0,90,0,0,5,117,5,203,0,20,0,108,0,129,0,
+0,1,34,6,21,20,22,23,30,3,51,50,62,2,53,52,46,2,1,33,21,33,53,33,17,35,14,
+3,35,34,46,4,53,52,62,2,51,50,22,21,20,14,2,35,34,38,39,7,22,22,51,50,62,
+2,53,53,51,21,20,30,2,51,50,62,2,55,39,6,6,35,34,46,2,53,52,54,51,50,30,2,
+21,20,14,4,35,34,46,2,39,35,1,34,14,2,21,20,30,2,51,50,62,2,55,54,54,53,52,
+38,1,80,42,50,5,3,8,23,24,22,7,20,30,21,11,14,23,30,1,216,1,56,252,241,1,
+56,9,21,55,67,76,41,28,68,68,63,49,29,36,62,81,44,100,119,29,50,68,39,28,
+32,14,6,26,99,66,43,76,56,32,159,32,55,76,44,33,63,51,37,7,7,14,31,28,39,
+69,50,29,119,101,44,81,61,37,29,49,63,68,68,28,41,76,67,56,21,8,1,72,15,30,
+23,14,11,21,30,20,7,21,24,23,9,3,5,50,5,88,57,56,26,37,14,7,10,6,2,20,31,
+41,21,31,39,23,9,251,53,141,141,3,74,35,43,26,9,12,30,50,74,102,68,69,104,
+69,35,109,110,45,71,49,26,9,10,5,50,31,26,63,103,78,104,104,78,103,63,26,
+8,19,31,23,5,10,9,26,49,71,45,110,109,35,69,104,69,68,102,74,50,30,12,9,26,
+43,35,1,129,9,23,39,31,21,41,31,20,2,6,10,7,14,37,26,56,57,0,3,0,68,255,236,
+6,143,5,203,0,75,0,87,0,99,0,0,1,20,14,2,35,34,38,39,35,17,20,14,2,35,34,
+38,39,55,22,22,51,50,62,2,53,17,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,
+23,51,17,52,62,2,51,50,22,23,7,38,38,35,34,6,21,17,51,54,54,51,50,30,2,5,
+52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,6,143,
+41,73,101,59,105,139,20,187,42,80,113,72,38,60,17,27,11,39,38,39,56,36,17,
+191,10,48,70,88,50,61,99,71,39,39,71,99,61,49,87,69,49,12,191,42,80,113,72,
+38,60,17,27,11,39,38,77,71,189,20,139,103,58,101,73,42,251,64,71,54,54,69,
+69,54,54,71,4,43,71,54,54,69,69,54,54,71,2,250,63,99,68,36,102,94,254,166,
+93,138,90,45,10,8,125,5,9,26,57,90,64,1,90,47,73,50,26,36,68,98,62,61,98,
+67,36,26,48,70,44,1,26,93,138,91,45,11,8,125,5,10,111,127,254,230,89,99,36,
+67,96,61,63,70,72,63,65,72,73,66,63,70,72,63,65,72,73,0,0,3,0,68,255,236,
+7,131,5,203,0,95,0,107,0,119,0,0,1,20,14,2,35,34,38,39,35,17,20,14,2,35,34,
+38,39,55,22,22,51,50,62,2,53,17,35,17,20,14,2,35,34,38,39,55,22,22,51,50,
+62,2,53,17,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,33,17,52,62,2,51,50,
+22,23,7,38,38,35,34,6,21,17,51,54,54,51,50,30,2,5,52,38,35,34,6,21,20,22,
+51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,7,131,41,74,100,59,106,139,20,
+122,43,79,114,72,38,59,17,26,11,39,38,39,56,36,17,230,42,80,113,72,38,59,
+17,26,11,39,38,39,56,36,17,109,10,48,70,88,50,61,99,71,39,39,71,99,61,49,
+87,69,49,12,1,242,42,80,114,71,38,60,17,27,11,39,38,77,70,124,20,139,104,
+58,100,74,42,250,76,71,54,54,69,69,54,54,71,5,31,71,54,54,69,69,54,54,71,
+2,250,63,99,68,36,102,94,254,166,93,138,90,45,10,8,125,5,9,26,57,90,64,1,
+90,254,166,93,138,90,45,10,8,125,5,9,26,57,90,64,1,90,47,73,50,26,36,68,98,
+62,61,98,67,36,26,48,70,44,1,26,93,138,91,45,11,8,125,5,10,111,127,254,230,
+89,99,36,67,96,61,63,70,72,63,65,72,73,66,63,70,72,63,65,72,73,0,0,4,0,113,
+0,0,3,229,5,197,0,30,0,50,0,62,0,74,0,0,1,46,3,53,52,62,2,51,50,30,2,21,20,
+14,2,7,17,33,21,33,17,35,17,33,53,33,3,20,30,2,51,50,62,2,53,52,46,2,35,34,
+14,2,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,
+1,168,60,103,77,43,59,100,132,74,73,133,99,59,45,77,104,60,1,157,254,99,160,
+254,201,1,55,125,34,57,75,41,40,74,58,35,35,58,74,40,41,75,57,34,2,68,56,
+47,49,53,57,45,45,58,56,47,49,53,57,45,45,58,2,252,12,62,91,118,69,81,133,
+95,52,52,95,133,81,70,118,91,61,12,254,211,141,254,190,1,66,141,2,141,51,
+83,59,32,32,59,83,51,51,83,59,32,32,59,83,251,236,50,53,53,50,48,54,54,1,
+239,50,53,53,50,48,54,54,0,0,4,0,113,0,0,4,104,5,197,0,34,0,54,0,66,0,78,
+0,0,1,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,17,33,17,51,17,35,17,33,17,
+35,17,33,53,33,3,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,20,6,35,34,38,
+53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,1,168,60,103,77,43,59,
+100,132,74,73,133,99,59,45,77,104,60,1,129,159,159,254,127,160,254,201,1,
+55,125,34,57,75,41,40,74,58,35,35,58,74,40,41,75,57,34,2,68,56,47,49,53,57,
+45,45,58,56,47,49,53,57,45,45,58,2,252,12,62,91,118,69,81,133,95,52,52,95,
+133,81,70,118,91,61,12,254,211,1,8,253,104,1,3,254,190,1,66,141,2,141,51,
+83,59,32,32,59,83,51,51,83,59,32,32,59,83,251,236,50,53,53,50,48,54,54,1,
+239,50,53,53,50,48,54,54,0,1,0,227,0,0,5,152,5,182,0,67,0,0,51,17,51,17,20,
+14,2,7,23,62,3,55,55,17,51,21,20,14,2,7,23,62,3,55,55,51,17,35,17,52,62,4,
+55,39,14,3,7,7,17,35,53,52,62,4,55,39,14,5,7,7,227,160,3,5,8,4,10,13,29,55,
+90,75,111,159,3,5,8,4,10,13,30,54,91,74,111,160,160,1,3,3,5,5,3,10,13,29,
+55,90,75,111,159,1,3,3,5,5,3,10,9,18,25,36,52,73,49,111,5,182,252,221,132,
+160,96,51,23,4,25,53,85,131,103,151,2,209,82,132,160,96,51,23,5,25,54,85,
+131,103,151,250,74,3,35,88,128,93,63,44,31,16,4,26,53,85,131,103,153,253,
+49,82,88,128,93,63,44,31,16,4,17,34,43,55,77,103,68,152,0,3,0,90,0,0,7,109,
+5,182,0,11,0,23,0,93,0,0,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,
+53,52,54,51,50,22,1,17,51,17,20,14,2,7,23,62,3,55,55,17,51,21,20,14,2,7,23,
+62,3,55,55,51,17,35,17,52,62,4,55,39,14,5,7,7,17,35,53,52,62,4,55,39,14,5,
+7,7,1,39,56,46,50,53,58,45,45,57,6,70,56,47,49,53,57,45,45,58,250,28,160,
+3,5,8,5,11,13,29,55,90,75,110,160,3,5,8,4,10,13,29,55,90,75,111,159,159,1,
+3,3,5,5,3,10,9,18,25,36,52,73,49,111,160,1,3,4,5,5,3,10,9,18,25,36,52,73,
+49,111,2,219,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,252,245,5,182,252,
+221,132,160,96,51,23,4,25,53,85,131,103,151,2,209,82,132,160,96,51,23,5,25,
+54,85,131,103,151,250,74,3,35,88,128,93,63,44,31,16,4,17,34,43,55,77,103,
+69,153,253,49,82,88,128,93,63,44,31,16,4,17,34,43,55,77,103,68,152,0,1,0,
+158,1,20,5,4,4,211,0,25,0,0,1,50,30,2,21,20,14,2,35,53,50,54,53,52,46,2,35,
+33,17,35,17,51,17,3,94,119,162,99,42,46,80,108,61,60,75,22,58,101,79,253,
+221,159,159,3,57,33,66,100,67,64,96,65,33,129,66,63,31,48,32,16,254,102,3,
+191,254,102,0,2,0,158,255,129,5,4,4,211,0,25,0,53,0,0,1,50,30,2,21,20,14,
+2,35,53,50,54,53,52,46,2,35,33,17,35,17,51,17,19,34,14,2,7,39,54,54,51,50,
+30,2,51,50,62,2,55,23,6,6,35,34,46,2,3,94,119,162,99,42,46,80,108,61,60,75,
+22,58,101,79,253,221,159,159,150,24,43,38,34,15,94,38,121,97,45,98,93,84,
+32,24,43,38,34,15,94,38,121,97,43,95,94,86,3,57,33,66,100,67,64,96,65,33,
+129,66,63,31,48,32,16,254,102,3,191,254,102,252,170,8,22,38,30,55,97,90,24,
+28,24,8,22,38,30,55,97,89,23,29,23,0,3,0,158,1,20,5,4,4,211,0,25,0,37,0,49,
+0,0,1,50,30,2,21,20,14,2,35,53,50,54,53,52,46,2,35,33,17,35,17,51,17,37,20,
+6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,3,94,119,
+162,99,42,46,80,108,61,60,75,22,58,101,79,253,221,159,159,1,236,56,46,50,
+53,58,45,45,57,56,46,50,53,58,45,45,57,3,57,33,66,100,67,64,96,65,33,129,
+66,63,31,48,32,16,254,102,3,191,254,102,209,49,53,53,49,48,55,55,253,147,
+50,53,53,50,48,54,54,0,0,1,0,158,0,0,5,4,4,211,0,29,0,0,1,50,54,53,52,46,
+2,35,33,17,35,17,51,17,33,50,30,2,21,20,14,2,35,17,35,17,51,3,221,60,75,22,
+58,101,79,253,221,159,159,2,33,119,162,99,42,46,80,108,61,160,160,1,174,66,
+63,31,48,32,16,254,102,3,191,254,102,33,66,100,67,64,96,65,33,254,211,2,61,
+0,0,3,0,68,0,0,4,201,5,182,0,19,0,39,0,43,0,0,1,1,51,17,35,53,52,62,4,55,
+39,14,3,7,7,37,1,51,17,35,53,52,62,4,55,39,14,3,7,7,1,35,17,51,2,170,1,127,
+160,160,1,3,3,5,5,3,10,13,33,50,72,51,72,253,52,1,127,159,159,1,3,3,5,5,3,
+10,13,33,50,72,51,72,2,217,160,160,4,55,1,127,252,176,189,99,143,101,67,47,
+31,16,4,26,49,59,75,51,72,100,1,127,252,176,189,99,143,101,67,47,31,16,4,
+26,49,59,75,51,72,252,45,2,8,0,0,5,0,68,0,0,4,223,5,182,0,19,0,39,0,43,0,
+55,0,67,0,0,1,1,51,17,35,53,52,62,4,55,39,14,3,7,7,37,1,51,17,35,53,52,62,
+4,55,39,14,3,7,7,1,35,17,51,5,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,
+38,53,52,54,51,50,22,2,170,1,127,160,160,1,3,3,5,5,3,10,13,33,50,72,51,72,
+253,52,1,127,159,159,1,3,3,5,5,3,10,13,33,50,72,51,72,2,217,160,160,254,240,
+56,47,49,53,57,45,45,58,2,108,56,46,50,53,58,45,45,57,4,55,1,127,252,176,
+189,99,143,101,67,47,31,16,4,26,49,59,75,51,72,100,1,127,252,176,189,99,143,
+101,67,47,31,16,4,26,49,59,75,51,72,252,45,2,8,182,50,52,52,50,48,54,54,48,
+50,52,52,50,48,54,54,0,0,3,0,68,0,0,4,201,5,182,0,19,0,39,0,47,0,0,1,1,51,
+17,35,53,52,62,4,55,39,14,3,7,7,37,1,51,17,35,53,52,62,4,55,39,14,3,7,7,1,
+51,17,33,21,33,53,33,2,170,1,127,160,160,1,3,3,5,5,3,10,13,33,50,72,51,72,
+253,52,1,127,159,159,1,3,3,5,5,3,10,13,33,50,72,51,72,2,57,160,1,55,252,242,
+1,55,4,55,1,127,252,176,189,99,143,101,67,47,31,16,4,26,49,59,75,51,72,100,
+1,127,252,176,189,99,143,101,67,47,31,16,4,26,49,59,75,51,72,254,53,254,133,
+141,141,0,5,0,68,0,0,4,223,5,182,0,19,0,39,0,51,0,63,0,71,0,0,1,1,51,17,35,
+53,52,62,4,55,39,14,3,7,7,37,1,51,17,35,53,52,62,4,55,39,14,3,7,7,1,20,6,
+35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,37,51,17,33,
+21,33,53,33,2,170,1,127,160,160,1,3,3,5,5,3,10,13,33,50,72,51,72,253,52,1,
+127,159,159,1,3,3,5,5,3,10,13,33,50,72,51,72,1,201,56,47,49,53,57,45,45,58,
+2,108,56,46,50,53,58,45,45,57,254,4,160,1,55,252,242,1,55,4,55,1,127,252,
+176,189,99,143,101,67,47,31,16,4,26,49,59,75,51,72,100,1,127,252,176,189,
+99,143,101,67,47,31,16,4,26,49,59,75,51,72,253,127,50,52,52,50,48,54,54,48,
+50,52,52,50,48,54,54,134,254,133,141,141,0,3,0,158,1,20,5,209,4,211,0,33,
+0,45,0,57,0,0,1,50,30,2,21,20,14,2,35,53,50,54,53,52,46,2,35,35,17,35,17,
+33,17,35,17,51,17,33,17,51,17,37,20,6,35,34,38,53,52,54,51,50,22,17,20,6,
+35,34,38,53,52,54,51,50,22,4,43,119,161,99,43,46,80,108,61,60,75,22,58,101,
+79,178,160,254,98,159,159,1,158,160,254,246,56,47,49,53,57,45,45,58,56,47,
+49,53,57,45,45,58,3,57,33,66,100,67,64,96,65,33,129,66,63,31,48,32,16,254,
+102,1,154,254,102,3,191,254,102,1,154,254,102,209,49,53,53,49,48,55,55,253,
+147,50,53,53,50,48,54,54,0,1,0,158,1,20,5,209,4,211,0,33,0,0,1,50,30,2,21,
+20,14,2,35,53,50,54,53,52,46,2,35,35,17,35,17,33,17,35,17,51,17,33,17,51,
+17,4,43,119,161,99,43,46,80,108,61,60,75,22,58,101,79,178,160,254,98,159,
+159,1,158,160,3,57,33,66,100,67,64,96,65,33,129,66,63,31,48,32,16,254,102,
+1,154,254,102,3,191,254,102,1,154,254,102,0,0,1,0,158,1,20,5,209,4,211,0,
+41,0,0,1,17,51,17,51,50,30,2,21,20,14,2,35,53,50,54,53,52,46,2,35,35,17,35,
+17,35,17,35,17,35,17,35,17,51,17,51,17,51,17,3,0,160,139,119,161,99,43,46,
+80,108,61,60,75,22,58,101,79,141,160,145,160,146,159,159,146,160,3,57,1,154,
+254,102,33,66,100,67,64,96,65,33,129,66,63,31,48,32,16,254,102,1,154,254,
+102,1,154,254,102,3,191,254,102,1,154,254,102,0,0,3,0,158,1,20,5,209,4,211,
+0,33,0,45,0,57,0,0,1,50,30,2,21,20,14,2,35,53,50,54,53,52,46,2,35,33,17,35,
+17,35,17,35,17,51,17,51,17,51,17,37,20,6,35,34,38,53,52,54,51,50,22,17,20,
+6,35,34,38,53,52,54,51,50,22,4,43,119,161,99,43,46,80,108,61,60,75,22,58,
+101,79,254,107,160,187,159,159,187,160,1,55,56,47,49,53,57,45,45,58,56,47,
+49,53,57,45,45,58,3,57,33,66,100,67,64,96,65,33,129,66,63,31,48,32,16,254,
+102,1,154,254,102,3,191,254,102,1,154,254,102,209,49,53,53,49,48,55,55,253,
+147,50,53,53,50,48,54,54,0,0,3,0,90,0,227,4,150,5,72,0,19,0,31,0,51,0,0,1,
+20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,50,22,21,20,6,35,34,38,53,52,54,
+5,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,4,150,78,143,199,121,129,202,139,
+73,81,144,199,119,117,199,144,81,253,225,49,53,53,49,48,55,55,1,175,57,101,
+140,83,84,140,102,57,51,98,142,92,85,140,101,55,3,18,129,207,145,78,78,145,
+207,129,127,208,149,82,82,149,208,32,56,47,49,53,57,45,45,58,95,95,157,112,
+62,62,112,157,95,97,155,109,58,58,109,155,0,0,5,0,113,0,0,3,233,5,199,0,26,
+0,46,0,58,0,70,0,82,0,0,1,20,14,2,7,17,33,21,33,53,33,17,46,3,53,52,62,2,
+51,50,30,2,7,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,20,6,35,34,38,53,
+52,54,51,50,22,19,50,22,21,20,6,35,34,38,53,52,54,1,20,6,35,34,38,53,52,54,
+51,50,22,3,233,57,99,133,77,1,55,252,242,1,55,79,133,96,54,73,123,161,87,
+87,160,123,74,159,49,80,102,54,54,103,80,48,45,77,104,59,56,103,79,47,254,
+51,56,46,50,53,58,45,45,57,182,50,53,53,50,48,54,54,1,165,56,46,50,53,58,
+45,45,57,4,4,92,149,112,71,12,254,61,141,141,1,195,12,72,112,149,91,100,167,
+118,66,66,118,167,100,70,114,82,45,45,82,114,70,70,112,79,42,42,79,112,253,
+209,49,53,53,49,48,55,55,2,174,56,47,49,53,57,45,45,58,253,34,49,53,53,49,
+48,55,55,0,3,0,113,0,0,3,233,5,199,0,26,0,46,0,58,0,0,1,20,14,2,7,17,33,21,
+33,53,33,17,46,3,53,52,62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,30,2,51,
+50,62,2,37,50,22,21,20,6,35,34,38,53,52,54,3,233,58,99,134,75,1,55,252,242,
+1,55,78,132,97,55,73,123,161,87,87,160,123,74,159,49,80,102,54,54,103,80,
+48,45,77,104,59,56,103,79,47,254,233,50,53,53,50,48,54,54,4,4,91,149,112,
+72,12,254,61,141,141,1,195,13,72,111,149,91,100,167,118,66,66,118,167,100,
+70,114,82,45,45,82,114,70,70,112,79,42,42,79,112,175,56,47,49,53,57,45,45,
+58,0,1,0,90,0,0,4,125,5,203,0,36,0,0,1,46,3,53,52,54,55,23,14,3,21,20,30,
+2,51,50,62,2,55,51,17,35,17,35,14,3,7,17,35,1,78,52,89,66,37,101,83,95,32,
+46,29,14,45,76,101,56,73,153,131,93,13,160,160,8,37,109,129,142,70,160,3,
+31,15,56,85,117,77,102,170,62,90,30,57,58,62,35,64,88,55,24,36,60,77,42,251,
+145,3,186,36,63,48,28,1,252,246,0,0,4,0,227,0,0,5,49,5,182,0,3,0,7,0,11,0,
+15,0,0,33,33,17,33,1,33,17,33,1,33,17,33,17,33,17,33,5,49,251,178,4,78,252,
+82,1,76,254,180,3,14,254,222,1,34,254,222,1,34,5,182,250,215,4,156,253,113,
+253,243,4,156,253,254,0,3,0,203,255,240,4,27,5,182,0,25,0,37,0,49,0,0,1,17,
+20,14,2,35,34,46,2,53,17,51,17,20,30,2,51,50,62,2,53,17,3,20,6,35,34,38,53,
+52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,4,27,56,108,157,101,108,
+161,105,52,159,38,70,98,61,60,96,69,37,162,56,46,50,53,58,45,45,57,56,46,
+50,53,58,45,45,57,5,182,251,248,117,168,109,52,66,119,163,98,4,8,251,248,
+70,113,80,44,33,73,117,84,4,8,254,146,50,53,53,50,48,54,54,253,163,50,53,
+53,50,48,54,54,0,1,0,227,255,246,5,168,5,182,0,137,0,0,37,6,6,35,34,46,2,
+53,17,51,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,
+20,14,2,35,34,46,2,39,35,6,6,35,34,38,39,35,21,20,30,2,51,50,62,2,53,53,51,
+21,20,30,2,51,50,62,2,53,53,51,21,20,14,2,35,34,46,2,39,35,6,6,35,34,38,39,
+35,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,14,
+2,35,34,46,2,39,3,66,42,138,105,72,119,85,46,160,26,48,67,41,39,68,52,30,
+160,30,51,69,38,51,69,43,19,160,46,85,119,72,59,90,68,49,18,8,42,126,97,55,
+94,25,8,26,48,67,41,39,68,52,30,160,30,51,69,38,51,69,43,19,160,46,85,119,
+72,59,90,68,49,18,8,42,133,90,55,94,25,8,22,45,68,47,39,68,52,30,160,30,51,
+69,38,46,69,45,22,160,46,85,119,72,59,90,68,49,18,143,69,84,38,97,167,130,
+4,16,18,81,112,70,32,23,57,96,74,63,63,74,96,57,23,32,70,112,81,18,16,130,
+167,97,38,21,39,57,36,69,84,42,50,174,81,112,70,32,23,57,96,74,63,63,74,96,
+57,23,32,70,112,81,18,16,130,167,97,38,21,39,57,36,69,84,42,50,174,81,112,
+70,32,23,57,96,74,63,63,74,96,57,23,32,70,112,81,18,16,130,167,97,38,21,39,
+57,36,0,4,0,90,255,236,6,90,5,209,0,21,0,33,0,55,0,67,0,0,1,34,14,2,21,20,
+30,2,51,7,34,36,38,2,53,52,18,54,36,51,3,20,6,35,34,38,53,52,54,51,50,22,
+1,50,4,22,18,21,20,2,6,4,35,39,50,62,2,53,52,46,2,35,19,52,54,51,50,22,21,
+20,6,35,34,38,6,90,125,202,144,78,70,139,205,135,10,174,254,251,175,88,99,
+182,1,2,159,121,56,46,50,53,58,45,45,57,250,141,159,1,2,183,99,88,176,254,
+251,174,10,135,206,138,70,78,144,203,124,131,58,45,45,57,53,49,47,56,5,70,
+90,164,229,138,141,226,158,85,139,104,194,1,21,174,170,1,24,200,110,253,4,
+50,52,52,50,48,54,54,2,204,110,200,254,232,170,174,254,235,194,104,139,85,
+158,226,141,138,229,164,90,253,143,48,54,54,48,50,52,52,0,4,0,90,255,236,
+6,90,5,209,0,21,0,43,0,55,0,67,0,0,1,34,14,2,21,20,30,2,51,7,34,36,38,2,53,
+52,18,54,36,51,33,50,4,22,18,21,20,2,6,4,35,39,50,62,2,53,52,46,2,35,37,20,
+6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,6,90,125,
+202,144,78,70,139,205,135,10,174,254,251,175,88,99,182,1,2,159,250,20,159,
+1,2,183,99,88,176,254,251,174,10,135,206,138,70,78,144,203,124,3,103,56,47,
+49,53,57,45,45,58,56,47,49,53,57,45,45,58,5,70,90,164,229,138,141,226,158,
+85,139,104,194,1,21,174,170,1,24,200,110,110,200,254,232,170,174,254,235,
+194,104,139,85,158,226,141,138,229,164,90,10,50,53,53,50,48,54,54,250,228,
+49,53,53,49,48,55,55,0,0,1,0,158,0,0,6,154,5,182,0,135,0,0,1,35,14,3,35,34,
+46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,54,53,51,20,30,2,51,50,62,
+2,53,53,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,54,53,
+51,20,30,2,51,50,62,2,53,51,17,33,21,33,53,33,17,35,14,3,35,34,46,2,39,35,
+14,3,35,34,46,2,53,51,20,30,2,51,50,54,53,51,20,30,2,51,50,62,2,53,4,188,
+8,15,43,52,58,30,31,71,68,59,19,8,24,62,69,70,31,62,120,95,59,159,30,50,67,
+36,81,99,158,30,53,70,41,39,66,48,27,8,15,43,52,58,30,31,71,68,59,19,8,24,
+62,69,70,31,62,120,95,59,159,30,50,67,36,81,99,158,30,53,70,41,39,66,48,27,
+160,1,62,252,241,1,49,8,15,43,52,58,30,31,71,68,59,19,8,24,62,69,70,31,62,
+120,95,59,159,30,50,67,36,81,99,158,30,53,70,41,38,66,48,28,3,203,24,35,22,
+11,7,28,57,51,46,56,31,10,21,58,106,85,38,52,32,13,69,66,33,50,35,17,22,37,
+49,27,135,24,34,23,11,7,28,57,51,46,56,31,10,21,58,106,85,38,52,32,13,69,
+66,33,50,35,17,22,38,48,27,250,215,141,141,2,6,24,34,23,11,7,28,58,51,46,
+57,31,10,21,58,106,86,39,52,31,14,70,66,33,51,34,18,21,37,49,29,0,1,0,158,
+0,0,6,20,5,182,0,19,0,0,1,33,17,33,21,33,17,33,21,33,17,33,17,33,53,33,17,
+33,53,33,2,143,1,148,1,241,254,175,1,81,254,15,254,108,254,15,1,82,254,174,
+1,241,3,57,2,125,139,251,98,141,2,174,253,82,141,4,158,139,0,3,0,180,255,
+246,5,121,5,182,0,47,0,95,0,143,0,0,1,6,6,35,34,46,2,53,53,51,21,20,30,2,
+51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,14,2,35,34,46,2,
+39,3,6,6,35,34,46,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,30,2,51,
+50,62,2,53,53,51,21,20,14,2,35,34,46,2,39,3,6,6,35,34,46,2,53,53,51,21,20,
+30,2,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,14,2,35,34,
+46,2,39,3,18,42,137,105,72,119,85,46,160,26,48,67,41,39,68,52,30,159,30,52,
+68,39,40,67,48,27,160,46,85,119,72,59,90,68,49,18,9,42,137,105,72,119,85,
+46,160,26,48,67,41,39,68,52,30,159,30,52,68,39,40,67,48,27,160,46,85,119,
+72,59,90,68,49,18,9,42,137,105,72,119,85,46,160,26,48,67,41,39,68,52,30,159,
+30,52,68,39,40,67,48,27,160,46,85,119,72,59,90,68,49,18,4,143,69,84,38,97,
+167,130,16,18,81,112,70,32,23,57,96,74,63,63,74,96,57,23,32,70,112,81,18,
+16,130,167,97,38,21,39,57,36,252,0,69,84,38,97,167,130,16,18,81,112,70,32,
+23,57,96,74,63,63,74,96,57,23,32,70,112,81,18,16,130,167,97,38,21,39,57,36,
+2,0,69,84,38,97,167,130,16,18,81,112,70,32,23,57,96,74,63,63,74,96,57,23,
+32,70,112,81,18,16,130,167,97,38,21,39,57,36,0,1,0,158,0,0,6,154,5,182,0,
+143,0,0,1,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,54,
+53,51,20,30,2,51,50,62,2,53,53,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,
+51,20,30,2,51,50,54,53,51,20,30,2,51,50,62,2,53,51,17,33,21,33,21,33,21,33,
+53,33,53,33,53,33,17,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,
+2,51,50,54,53,51,20,30,2,51,50,62,2,53,4,188,8,15,43,52,58,30,31,71,68,59,
+19,8,24,62,69,70,31,62,120,95,59,159,30,50,67,36,81,99,158,30,53,70,41,39,
+66,48,27,8,15,43,52,58,30,31,71,68,59,19,8,24,62,69,70,31,62,120,95,59,159,
+30,50,67,36,81,99,158,30,53,70,41,39,66,48,27,160,1,62,254,196,1,60,252,241,
+1,49,254,207,1,49,8,15,43,52,58,30,31,71,68,59,19,8,24,62,69,70,31,62,120,
+95,59,159,30,50,67,36,81,99,158,30,53,70,41,38,66,48,28,3,203,24,35,22,11,
+7,28,57,51,46,56,31,10,21,58,106,85,38,52,32,13,69,66,33,50,35,17,22,37,49,
+27,135,24,34,23,11,7,28,57,51,46,56,31,10,21,58,106,85,38,52,32,13,69,66,
+33,50,35,17,22,38,48,27,251,205,141,105,141,141,105,141,1,16,24,34,23,11,
+7,28,58,51,46,57,31,10,21,58,106,86,39,52,31,14,70,66,33,51,34,18,21,37,49,
+29,0,3,0,68,255,236,7,131,3,254,0,77,0,89,0,101,0,0,1,20,14,2,35,34,38,39,
+35,17,20,14,2,35,34,38,39,55,22,22,51,50,62,2,53,17,35,17,20,14,2,35,34,38,
+39,55,22,22,51,50,62,2,53,17,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,
+33,54,54,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,
+20,22,51,50,54,7,131,41,74,100,59,106,139,20,122,43,79,114,72,38,59,17,26,
+11,39,38,39,56,36,17,230,42,80,113,72,38,59,17,26,11,39,38,39,56,36,17,109,
+10,48,70,88,50,61,99,71,39,39,71,99,61,49,87,69,49,12,3,14,20,139,104,58,
+100,74,42,149,71,54,54,69,69,54,54,71,250,225,71,54,54,69,69,54,54,71,2,250,
+63,99,68,36,102,94,254,166,93,138,90,45,10,8,125,5,9,26,57,90,64,1,90,254,
+166,93,138,90,45,10,8,125,5,9,26,57,90,64,1,90,47,73,50,26,36,68,98,62,61,
+98,67,36,26,48,70,44,89,99,36,67,96,61,63,70,72,63,65,72,73,66,63,70,72,63,
+65,72,73,0,3,0,68,255,236,7,131,5,203,0,113,0,125,0,137,0,0,1,51,17,52,62,
+2,51,50,22,23,7,38,38,35,34,6,21,17,51,54,54,51,50,30,2,21,20,14,2,35,34,
+38,39,35,17,20,14,2,35,34,38,39,55,22,22,51,50,62,2,53,17,35,17,20,14,2,35,
+34,38,39,55,22,22,51,50,62,2,53,17,35,14,3,35,34,46,2,53,52,62,2,51,50,30,
+2,23,51,17,52,62,2,51,50,22,23,7,38,38,35,34,6,21,1,52,38,35,34,6,21,20,22,
+51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,3,106,228,42,80,114,71,38,60,
+17,27,11,39,38,77,70,124,20,139,104,58,100,74,42,41,74,100,59,106,139,20,
+122,43,79,114,72,38,59,17,26,11,39,38,39,56,36,17,228,42,80,113,72,38,59,
+17,26,11,39,38,39,56,36,17,111,10,48,70,88,50,61,99,71,39,39,71,99,61,49,
+87,69,49,12,111,42,80,113,72,38,60,17,27,11,39,38,77,71,254,101,71,54,54,
+69,69,54,54,71,5,31,71,54,54,69,69,54,54,71,3,66,1,26,93,138,91,45,11,8,125,
+5,10,111,127,254,230,89,99,36,67,96,61,63,99,68,36,102,94,254,166,93,138,
+90,45,10,8,125,5,9,26,57,90,64,1,90,254,166,93,138,90,45,10,8,125,5,9,26,
+57,90,64,1,90,47,73,50,26,36,68,98,62,61,98,67,36,26,48,70,44,1,26,93,138,
+91,45,11,8,125,5,10,111,127,254,158,63,70,72,63,65,72,73,66,63,70,72,63,65,
+72,73,0,1,0,6,255,231,5,111,5,205,0,29,0,0,19,1,62,3,51,50,30,2,21,20,14,
+2,7,39,54,54,53,52,38,35,34,6,7,9,2,6,3,45,51,87,77,70,35,49,91,70,42,13,
+31,53,39,92,40,44,72,57,35,96,69,254,217,1,161,253,250,1,233,3,48,51,69,42,
+18,29,57,88,58,32,58,62,67,39,90,40,64,38,62,57,66,72,254,215,254,97,253,
+247,0,3,0,6,255,231,5,111,5,205,0,11,0,23,0,53,0,0,1,20,6,35,34,38,53,52,
+54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,1,1,62,3,51,50,30,2,21,20,14,
+2,7,39,54,54,53,52,38,35,34,6,7,9,2,1,59,56,46,50,52,57,45,45,57,2,217,55,
+47,49,53,57,45,45,57,251,242,3,45,51,87,77,70,35,49,91,70,42,13,31,53,39,
+92,40,44,72,57,35,96,69,254,217,1,161,253,250,3,184,49,53,53,49,48,55,55,
+48,49,53,53,49,48,55,55,254,1,3,48,51,69,42,18,29,57,88,58,32,58,62,67,39,
+90,40,64,38,62,57,66,72,254,215,254,97,253,247,0,1,0,113,0,0,6,109,5,182,
+0,92,0,0,1,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,54,
+53,51,30,3,51,50,62,2,53,53,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,51,
+20,30,2,51,50,54,53,51,30,3,51,50,62,2,53,51,17,33,21,33,53,33,4,143,8,16,
+48,54,56,24,31,72,69,59,17,8,23,62,69,71,31,70,123,91,52,159,32,52,65,34,
+81,99,158,1,30,52,70,41,39,66,48,27,8,16,48,54,56,24,31,72,69,59,17,8,23,
+62,69,71,31,70,123,91,52,159,32,52,65,34,81,99,158,1,30,52,70,41,39,66,48,
+27,160,1,62,252,241,1,49,3,51,36,51,31,15,17,42,71,54,52,71,43,18,39,88,142,
+104,69,92,55,22,115,123,61,89,59,29,36,63,88,51,164,36,51,32,14,17,42,71,
+54,52,71,43,18,39,87,142,104,69,91,55,22,114,123,61,89,59,28,36,63,87,51,
+250,215,141,141,0,0,3,0,113,0,0,6,109,5,182,0,11,0,23,0,116,0,0,1,52,54,51,
+50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,3,35,14,3,35,34,
+46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,54,53,51,30,3,51,50,62,2,53,
+53,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,54,53,51,
+30,3,51,50,62,2,53,51,17,33,21,33,53,33,3,96,56,47,49,53,57,45,45,58,2,41,
+56,47,49,53,57,45,45,58,250,8,16,48,54,56,24,31,72,69,59,17,8,23,62,69,71,
+31,70,123,91,52,159,32,52,65,34,81,99,158,1,30,52,70,41,39,66,48,27,8,16,
+48,54,56,24,31,72,69,59,17,8,23,62,69,71,31,70,123,91,52,159,32,52,65,34,
+81,99,158,1,30,52,70,41,39,66,48,27,160,1,62,252,241,1,49,1,186,50,53,53,
+50,48,54,54,48,50,53,53,50,48,54,54,1,169,36,51,31,15,17,42,71,54,52,71,43,
+18,39,88,142,104,69,92,55,22,115,123,61,89,59,29,36,63,88,51,164,36,51,32,
+14,17,42,71,54,52,71,43,18,39,87,142,104,69,91,55,22,114,123,61,89,59,28,
+36,63,87,51,250,215,141,141,0,0,2,0,45,255,223,6,90,5,182,0,17,0,20,0,0,1,
+1,55,23,1,39,55,33,23,7,1,55,23,1,35,53,33,21,1,33,1,3,211,1,164,119,108,
+254,141,108,115,252,172,114,108,254,141,109,114,1,156,135,2,65,253,64,3,49,
+254,100,5,41,252,63,142,90,254,67,90,136,136,90,1,189,90,140,3,191,141,141,
+252,37,3,174,0,5,0,45,255,223,6,90,5,182,0,17,0,20,0,24,0,28,0,32,0,0,1,33,
+23,7,1,55,23,19,35,53,33,21,35,1,55,23,1,39,37,33,1,1,23,1,39,33,7,1,55,1,
+53,33,21,4,0,254,137,62,109,254,141,109,92,248,135,2,65,141,1,6,90,109,254,
+141,108,254,75,2,103,254,196,2,181,108,254,141,108,253,145,108,254,141,109,
+1,135,2,65,1,18,73,90,1,188,90,110,2,49,141,141,253,209,108,90,254,68,90,
+215,2,170,253,172,90,254,67,90,90,1,189,90,3,51,141,141,0,0,4,0,68,255,236,
+4,113,5,205,0,47,0,67,0,78,0,89,0,0,19,62,3,51,50,30,2,23,51,21,35,14,3,7,
+21,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,53,46,3,39,35,53,1,52,46,2,35,
+34,14,2,21,20,30,2,51,50,62,2,1,34,14,2,7,33,46,3,3,50,62,2,55,33,30,3,201,
+12,75,109,134,71,72,135,109,74,12,133,133,10,45,61,72,38,45,87,67,41,66,114,
+151,85,87,151,112,64,42,68,85,43,38,72,60,44,9,135,3,22,43,71,92,50,49,92,
+70,43,40,69,92,53,52,93,70,41,255,0,40,77,64,48,11,1,224,10,48,64,78,40,42,
+79,64,47,10,254,30,9,45,64,79,4,119,83,127,87,45,45,87,127,83,139,52,87,68,
+46,10,8,15,57,86,111,69,102,155,105,53,53,105,155,102,69,111,84,57,15,8,11,
+47,68,87,52,139,253,20,69,105,70,35,35,70,105,69,69,104,69,34,34,69,104,3,
+252,27,51,76,49,49,76,51,27,253,229,24,50,73,50,50,73,50,24,0,5,0,68,255,
+236,4,113,5,205,0,53,0,64,0,75,0,86,0,97,0,0,19,62,3,51,50,30,2,23,51,21,
+35,14,3,7,21,30,3,23,51,21,35,14,3,35,34,46,2,39,35,53,51,62,3,55,53,46,3,
+39,35,53,1,50,62,2,55,33,30,3,19,34,14,2,7,33,46,3,3,34,14,2,7,33,46,3,3,
+50,62,2,55,33,30,3,201,12,75,109,134,71,72,135,109,74,12,133,133,10,45,61,
+72,38,39,76,63,46,10,125,123,12,73,110,139,78,79,140,108,72,10,125,127,10,
+46,63,74,38,38,72,60,44,9,135,2,22,45,82,66,47,10,254,14,9,46,65,82,46,42,
+80,67,48,11,1,240,10,48,66,81,43,40,77,64,48,11,1,224,10,48,64,78,40,42,79,
+64,47,10,254,30,9,45,64,79,4,119,83,127,87,45,45,87,127,83,139,52,87,68,46,
+10,8,13,47,67,86,53,141,86,129,87,44,44,87,129,86,141,53,86,66,46,13,8,11,
+47,68,87,52,139,252,0,25,52,77,53,53,77,52,25,2,43,27,52,77,51,51,77,52,27,
+2,160,27,51,76,49,49,76,51,27,253,229,24,50,73,50,50,73,50,24,0,0,1,0,227,
+0,0,4,223,5,182,0,11,0,0,1,21,33,17,33,21,33,17,33,21,33,17,4,223,252,164,
+3,92,252,164,3,92,252,4,5,182,141,253,254,141,253,243,141,5,182,0,0,2,0,113,
+255,236,6,55,5,182,0,70,0,84,0,0,1,6,6,7,21,16,2,35,34,46,2,53,52,62,2,55,
+17,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,
+53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,54,54,55,1,14,3,21,20,22,51,50,
+62,2,53,6,55,75,127,54,138,146,39,80,63,40,44,87,130,86,9,16,48,54,56,24,
+31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,160,30,
+51,70,41,39,67,48,27,159,50,109,60,254,134,60,80,47,20,40,42,25,45,35,20,
+3,14,21,49,26,168,254,246,254,240,32,66,101,69,58,129,129,125,54,1,5,36,51,
+32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,
+186,190,72,102,63,29,38,78,118,81,141,253,135,23,40,15,254,193,45,93,88,79,
+31,63,70,40,93,153,113,0,0,3,0,227,0,0,4,223,5,182,0,11,0,23,0,35,0,0,1,21,
+33,17,33,21,33,17,33,21,33,17,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,
+34,38,53,52,54,51,50,22,4,223,252,164,3,92,252,164,3,92,252,4,2,152,56,47,
+49,53,57,45,45,58,56,47,49,53,57,45,45,58,5,182,141,253,254,141,253,243,141,
+5,182,254,125,49,53,53,49,48,55,55,253,65,50,53,53,50,48,54,54,0,0,4,0,113,
+255,236,6,92,5,182,0,70,0,84,0,96,0,108,0,0,1,6,6,7,21,16,2,35,34,46,2,53,
+52,62,2,55,17,35,14,3,35,34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,
+51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,51,17,54,54,55,1,14,3,21,
+20,22,51,50,62,2,53,5,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,
+52,54,51,50,22,6,55,75,127,54,138,146,39,80,63,40,44,87,130,86,9,16,48,54,
+56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,85,46,159,104,89,34,65,49,30,
+160,30,51,70,41,39,67,48,27,159,50,109,60,254,134,60,80,47,20,40,42,25,45,
+35,20,1,196,56,46,50,53,58,45,45,57,252,160,56,46,50,53,58,45,45,57,3,14,
+21,49,26,168,254,246,254,240,32,66,101,69,58,129,129,125,54,1,5,36,51,32,
+15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,186,
+190,72,102,63,29,38,78,118,81,141,253,135,23,40,15,254,193,45,93,88,79,31,
+63,70,40,93,153,113,57,50,53,53,50,48,54,54,48,50,53,53,50,48,54,54,0,0,2,
+0,158,255,244,3,197,5,205,0,47,0,67,0,0,19,52,62,2,55,46,3,53,52,62,2,51,
+50,30,2,23,7,38,38,35,34,14,2,21,20,30,6,21,20,14,2,35,34,46,2,55,20,30,2,
+51,50,62,2,53,52,46,2,39,14,3,158,43,79,114,71,44,91,74,47,58,102,140,81,
+44,77,73,70,37,78,46,115,62,60,84,53,24,51,84,107,112,107,84,51,65,111,147,
+81,85,147,109,62,159,42,69,88,45,44,87,70,43,28,53,75,47,68,106,73,38,1,111,
+71,122,96,70,19,27,68,91,119,78,74,130,97,56,14,27,41,27,116,34,52,37,61,
+78,40,56,86,74,66,71,80,100,128,82,89,147,105,58,46,95,142,89,53,87,63,34,
+36,66,96,60,44,85,75,62,21,9,53,81,104,0,0,3,0,111,254,180,3,199,5,205,0,
+23,0,71,0,91,0,0,5,34,6,7,39,54,54,51,50,30,2,51,50,54,55,23,6,6,35,34,46,
+2,3,52,62,2,55,46,3,53,52,62,2,51,50,30,2,23,7,38,38,35,34,14,2,21,20,30,
+6,21,20,14,2,35,34,46,2,55,20,30,2,51,50,62,2,53,52,46,2,39,14,3,1,102,47,
+75,31,94,38,121,97,45,97,93,85,32,47,75,31,95,39,120,97,43,96,93,87,234,43,
+79,114,71,44,91,74,47,58,102,140,81,44,77,73,70,37,78,46,115,62,60,84,53,
+24,51,84,107,112,107,84,51,65,111,147,81,85,147,109,62,159,42,69,88,45,44,
+87,70,43,28,53,75,47,68,106,73,38,233,39,60,56,97,89,24,28,24,39,59,55,97,
+89,24,28,24,2,88,71,122,96,70,19,27,68,91,119,78,74,130,97,56,14,27,41,27,
+116,34,52,37,61,78,40,56,86,74,66,71,80,100,128,82,89,147,105,58,46,95,142,
+89,53,87,63,34,36,66,96,60,44,85,75,62,21,9,53,81,104,0,0,2,0,68,0,0,5,164,
+5,195,0,57,0,77,0,0,1,34,14,2,7,39,62,3,51,50,22,23,54,51,50,30,2,23,7,46,
+3,35,34,34,7,30,3,21,20,14,2,7,17,33,21,33,53,33,17,38,38,53,52,62,2,55,38,
+38,19,50,62,2,53,52,46,2,39,14,3,21,20,30,2,2,51,62,108,93,82,36,114,44,99,
+119,144,89,48,94,47,84,92,89,152,127,106,42,125,34,84,98,113,62,10,25,8,40,
+69,51,30,34,63,90,57,1,56,252,241,1,56,111,125,28,50,69,40,13,34,180,41,60,
+39,19,26,47,64,39,36,54,35,18,19,39,60,5,55,27,71,120,93,59,115,152,89,36,
+23,20,43,35,87,151,115,63,93,120,71,27,2,38,96,112,128,70,72,128,102,70,15,
+254,151,141,141,1,105,25,189,173,65,124,112,98,41,3,3,253,66,39,69,93,55,
+61,121,106,87,28,28,87,106,121,61,55,93,69,39,0,0,4,0,68,0,0,5,164,5,195,
+0,57,0,77,0,89,0,101,0,0,1,34,14,2,7,39,62,3,51,50,22,23,54,51,50,30,2,23,
+7,46,3,35,34,34,7,30,3,21,20,14,2,7,17,33,21,33,53,33,17,38,38,53,52,62,2,
+55,38,38,19,50,62,2,53,52,46,2,39,14,3,21,20,30,2,5,52,54,51,50,22,21,20,
+6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,2,51,62,108,93,82,36,114,44,
+99,119,144,89,48,94,47,84,92,89,152,127,106,42,125,34,84,98,113,62,10,25,
+8,40,69,51,30,34,63,90,57,1,56,252,241,1,56,111,125,28,50,69,40,13,34,180,
+41,60,39,19,26,47,64,39,36,54,35,18,19,39,60,254,179,56,46,50,53,58,45,45,
+57,2,41,56,46,50,53,58,45,45,57,5,55,27,71,120,93,59,115,152,89,36,23,20,
+43,35,87,151,115,63,93,120,71,27,2,38,96,112,128,70,72,128,102,70,15,254,
+151,141,141,1,105,25,189,173,65,124,112,98,41,3,3,253,66,39,69,93,55,61,121,
+106,87,28,28,87,106,121,61,55,93,69,39,252,49,53,53,49,48,54,54,48,49,53,
+53,49,48,54,54,0,0,1,0,68,0,0,5,96,5,199,0,72,0,0,1,34,6,7,17,33,21,33,53,
+33,17,62,3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,53,46,3,35,34,14,
+2,7,17,51,62,3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,53,38,38,3,147,
+114,184,78,1,55,252,242,1,55,90,157,156,164,98,54,117,98,63,24,43,57,33,30,
+45,31,15,36,29,11,33,39,42,20,84,133,113,99,50,8,34,79,95,116,71,54,117,97,
+64,25,42,58,33,30,45,31,15,37,29,22,83,3,68,86,80,253,239,141,141,3,252,93,
+123,72,30,22,55,94,71,47,74,52,28,24,40,51,27,37,64,21,9,8,14,11,6,32,58,
+79,46,254,206,28,51,39,22,22,55,94,71,47,74,52,28,24,40,51,27,37,64,21,9,
+17,22,0,3,0,90,0,0,6,59,5,199,0,11,0,23,0,96,0,0,1,20,6,35,34,38,53,52,54,
+51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,37,34,6,7,17,33,21,33,53,33,17,
+62,3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,53,38,38,35,34,14,2,7,17,
+51,62,3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,53,46,3,6,59,56,46,50,
+52,57,45,45,57,250,236,56,46,50,53,58,45,45,57,2,131,115,183,79,1,55,252,
+242,1,55,90,157,156,165,98,54,117,97,64,25,42,58,33,30,45,31,15,37,29,22,
+83,41,84,133,113,99,50,8,35,79,95,115,72,54,116,98,63,24,43,57,33,30,45,31,
+15,36,29,11,33,39,42,2,219,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,57,
+86,80,253,239,141,141,3,252,93,123,72,30,22,55,94,71,47,74,52,28,24,40,51,
+27,37,64,21,9,17,22,32,58,79,46,254,206,28,51,39,22,22,55,94,71,47,74,52,
+28,24,40,51,27,37,64,21,9,8,14,11,6,0,1,0,68,0,0,5,96,5,199,0,80,0,0,1,62,
+3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,53,46,3,35,34,14,2,7,17,51,
+62,3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,53,38,38,35,34,6,7,17,33,
+21,33,21,33,21,33,53,33,53,33,53,33,1,123,90,157,156,164,98,54,117,98,63,
+24,43,57,33,30,45,31,15,36,29,11,33,39,42,20,84,133,113,99,50,8,34,79,95,
+116,71,54,117,97,64,25,42,58,33,30,45,31,15,37,29,22,83,41,114,184,78,1,55,
+254,201,1,55,252,242,1,55,254,201,1,55,4,137,93,123,72,30,22,55,94,71,47,
+74,52,28,24,40,51,27,37,64,21,9,8,14,11,6,32,58,79,46,254,206,28,51,39,22,
+22,55,94,71,47,74,52,28,24,40,51,27,37,64,21,9,17,22,86,80,254,229,141,105,
+141,141,105,141,0,0,3,0,90,0,0,6,59,5,199,0,80,0,92,0,104,0,0,1,62,3,51,50,
+30,2,21,20,14,2,35,34,46,2,53,52,54,55,53,38,38,35,34,14,2,7,17,51,62,3,51,
+50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,53,46,3,35,34,6,7,17,33,21,33,21,
+33,21,33,53,33,53,33,53,33,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,
+38,53,52,54,51,50,22,1,145,90,157,156,165,98,54,117,97,64,25,42,58,33,30,
+45,31,15,37,29,22,83,41,84,133,113,99,50,8,35,79,95,115,72,54,116,98,63,24,
+43,57,33,30,45,31,15,36,29,11,33,39,42,20,115,183,79,1,55,254,201,1,55,252,
+242,1,55,254,201,1,55,4,170,56,46,50,52,57,45,45,57,250,236,56,46,50,53,58,
+45,45,57,4,137,93,123,72,30,22,55,94,71,47,74,52,28,24,40,51,27,37,64,21,
+9,17,22,32,58,79,46,254,206,28,51,39,22,22,55,94,71,47,74,52,28,24,40,51,
+27,37,64,21,9,8,14,11,6,86,80,254,229,141,105,141,141,105,141,1,88,49,53,
+53,49,48,55,55,48,49,53,53,49,48,55,55,0,5,0,68,0,0,3,190,5,100,0,29,0,42,
+0,55,0,67,0,79,0,0,37,33,21,33,53,33,17,33,50,30,2,21,20,14,2,7,21,30,3,21,
+20,14,2,35,35,17,51,50,62,2,53,52,46,2,35,35,17,51,50,62,2,53,52,46,2,35,
+35,3,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,2,
+27,1,55,252,242,1,55,1,33,81,111,68,30,12,31,52,40,40,52,31,12,30,69,112,
+83,125,125,40,55,34,16,16,34,54,37,129,125,39,55,35,16,16,34,55,40,125,252,
+56,47,49,53,57,45,45,58,2,32,55,47,49,53,57,45,45,57,141,141,141,4,215,32,
+60,85,54,27,57,51,41,10,9,11,40,51,57,27,54,85,60,32,1,225,20,34,44,25,22,
+39,30,17,253,187,17,30,39,22,26,45,32,18,253,209,50,52,52,50,48,54,54,48,
+50,52,52,50,48,54,54,0,4,0,68,0,0,4,219,5,100,0,29,0,33,0,46,0,59,0,0,1,50,
+30,2,21,20,14,2,7,21,30,3,21,20,14,2,35,35,17,33,21,33,53,33,17,1,17,35,17,
+1,51,50,62,2,53,52,46,2,35,35,17,51,50,62,2,53,52,46,2,35,35,3,184,81,112,
+68,30,12,31,52,40,40,52,31,12,30,69,113,83,125,1,56,251,213,1,55,1,39,146,
+1,39,125,40,56,34,16,16,34,54,38,129,125,39,56,35,16,16,34,56,40,125,5,100,
+32,60,85,54,27,57,51,41,10,9,11,40,51,57,27,54,85,60,32,254,116,141,141,4,
+215,251,41,4,84,251,172,3,109,20,34,44,25,22,39,30,17,253,187,17,30,39,22,
+26,45,32,18,0,6,0,68,0,0,4,219,5,100,0,29,0,42,0,55,0,67,0,79,0,83,0,0,37,
+33,21,33,53,33,17,33,50,30,2,21,20,14,2,7,21,30,3,21,20,14,2,35,35,17,51,
+50,62,2,53,52,46,2,35,35,17,51,50,62,2,53,52,46,2,35,35,1,20,6,35,34,38,53,
+52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,5,17,35,17,3,55,1,56,251,
+213,1,55,2,61,81,112,68,30,12,31,52,40,40,52,31,12,30,69,113,83,125,125,40,
+56,34,16,16,34,54,38,129,125,39,56,35,16,16,34,56,40,125,1,37,56,46,50,53,
+58,45,45,57,252,195,56,47,49,53,57,45,45,58,1,131,146,141,141,141,4,215,32,
+60,85,54,27,57,51,41,10,9,11,40,51,57,27,54,85,60,32,1,225,20,34,44,25,22,
+39,30,17,253,187,17,30,39,22,26,45,32,18,253,209,50,52,52,50,48,54,54,48,
+50,52,52,50,48,54,54,245,4,84,251,172,0,0,5,0,158,255,236,3,219,5,205,0,11,
+0,53,0,73,0,93,0,105,0,0,1,50,22,21,20,6,35,34,38,53,52,54,55,30,3,21,20,
+14,2,35,34,46,2,53,52,62,2,55,53,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,
+19,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,19,52,46,2,35,34,14,2,21,20,30,
+2,51,50,62,2,1,50,22,21,20,6,35,34,38,53,52,54,2,59,50,53,53,50,48,54,54,
+225,45,86,67,41,66,113,152,85,87,150,112,64,42,67,85,43,44,82,64,39,68,112,
+147,78,80,147,113,68,40,64,84,43,71,42,70,89,47,46,88,69,42,39,67,89,50,49,
+90,68,41,8,42,71,93,50,49,92,70,43,40,69,92,53,52,94,69,41,255,0,50,53,53,
+50,48,54,54,1,250,56,47,49,53,57,45,45,58,227,15,57,86,111,69,102,155,105,
+53,53,105,155,102,69,111,84,57,15,8,12,59,87,111,65,100,153,105,54,54,105,
+153,100,65,110,86,59,12,1,76,66,102,69,36,36,69,102,66,66,100,66,34,34,66,
+100,253,156,69,105,70,35,35,70,105,69,69,104,69,34,34,69,104,3,88,56,47,49,
+53,57,45,45,58,0,0,1,0,227,255,242,5,47,5,199,0,98,0,0,1,51,62,3,51,50,30,
+2,21,20,14,2,35,53,50,62,2,53,52,46,2,35,34,14,2,7,17,51,62,3,51,50,30,2,
+21,20,14,2,35,53,50,62,2,53,52,46,2,35,34,14,2,7,35,17,62,3,51,50,30,2,21,
+20,14,2,35,53,50,62,2,53,52,46,2,35,34,14,2,7,1,131,8,57,120,125,129,67,54,
+117,97,64,38,67,93,54,12,34,33,23,25,47,68,42,63,134,131,124,54,8,64,148,
+156,158,74,54,117,98,63,38,67,92,55,12,35,33,23,24,46,68,45,94,177,157,132,
+48,160,82,188,198,202,98,54,117,98,63,38,67,92,55,12,35,33,23,28,49,67,39,
+94,177,157,132,48,2,229,53,90,66,37,22,56,96,74,49,85,63,36,129,8,21,36,29,
+22,40,30,17,46,79,104,58,254,151,60,102,73,42,22,56,96,74,49,85,63,36,129,
+8,21,36,29,22,39,30,17,58,91,113,55,4,35,93,154,111,62,22,57,96,73,49,82,
+59,33,129,8,21,36,29,22,39,30,17,58,91,113,55,0,5,0,180,0,0,7,176,5,82,0,
+73,0,85,0,97,0,109,0,121,0,0,1,6,6,35,34,46,2,39,35,14,3,35,34,46,2,39,35,
+14,3,35,34,38,39,7,17,35,17,51,17,30,3,51,50,62,2,53,53,51,21,20,30,2,51,
+50,62,2,53,53,51,21,20,30,2,51,50,54,55,17,51,17,35,17,1,20,6,35,34,38,53,
+52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,
+51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,7,10,38,94,60,32,75,73,66,23,8,
+20,56,67,76,39,39,81,73,59,16,8,23,63,70,72,32,60,95,38,6,160,160,14,38,53,
+69,45,39,62,43,24,160,27,49,69,43,43,70,49,27,159,34,54,67,34,65,97,34,160,
+160,252,123,56,46,50,53,58,45,45,57,2,27,56,47,49,53,57,45,45,58,56,47,49,
+53,57,45,45,58,253,229,56,46,50,53,58,45,45,57,2,135,46,58,18,43,71,52,54,
+71,42,17,17,42,71,54,52,71,43,18,58,46,2,253,123,4,18,254,250,19,34,25,14,
+26,61,99,74,23,23,74,102,65,29,29,65,102,74,23,23,74,99,61,26,56,38,1,4,251,
+238,2,133,2,103,50,53,53,50,48,54,54,251,167,50,53,53,50,48,54,54,3,249,50,
+53,53,50,48,54,54,251,167,50,53,53,50,48,54,54,0,5,0,68,255,254,6,6,5,205,
+0,19,0,39,0,51,0,63,0,75,0,0,1,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,55,
+20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,3,20,6,35,34,38,53,52,54,51,50,22,
+5,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,1,102,
+72,121,162,90,90,160,121,71,71,121,160,90,90,162,121,72,156,46,79,105,59,
+59,105,78,45,45,78,105,59,59,105,79,46,242,56,46,50,52,57,45,45,57,4,246,
+56,46,50,53,58,45,45,57,253,131,56,46,50,53,58,45,45,57,2,145,98,161,115,
+63,63,115,161,98,97,160,114,63,63,114,160,97,68,110,78,43,43,78,110,68,68,
+111,79,43,43,79,111,253,143,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,
+4,210,49,53,53,49,48,55,55,0,0,4,0,135,0,0,4,98,5,154,0,19,0,39,0,43,0,47,
+0,0,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,
+30,2,51,50,62,2,19,21,33,53,1,21,33,53,4,96,70,129,181,111,118,184,126,66,
+74,131,181,108,106,181,130,74,159,50,88,122,72,73,123,88,50,45,86,124,79,
+74,123,87,48,161,252,43,3,213,252,43,2,213,117,188,132,71,71,132,188,117,
+115,190,135,74,74,135,190,115,84,138,99,54,54,99,138,84,85,137,96,51,51,96,
+137,254,13,141,141,5,13,142,142,0,0,1,0,113,255,236,4,23,5,205,0,72,0,0,1,
+34,14,2,21,20,30,2,23,30,3,21,20,14,2,35,21,35,53,38,39,21,35,17,51,17,22,
+22,23,17,51,17,50,62,2,53,52,46,2,39,46,3,53,52,62,2,51,53,51,21,22,22,23,
+53,51,17,35,17,38,38,39,17,35,2,102,72,116,81,44,41,86,130,89,97,149,102,
+52,74,139,200,126,150,55,41,149,149,20,49,27,150,91,140,96,50,40,89,139,99,
+94,141,95,47,68,125,174,106,150,26,48,22,150,150,22,48,26,150,5,41,31,56,
+78,48,55,81,67,59,33,36,76,97,127,86,98,146,98,49,20,40,14,21,55,1,219,254,
+244,11,21,9,1,12,254,217,33,61,87,55,54,80,68,63,36,34,80,103,132,85,87,131,
+89,45,23,41,8,18,9,55,254,37,1,10,11,20,8,254,248,0,0,1,0,68,255,227,7,53,
+5,197,0,122,0,0,37,62,3,51,50,30,2,51,50,54,55,23,6,6,35,34,46,2,35,34,7,
+39,62,3,55,54,54,55,33,6,6,7,23,62,3,51,50,30,2,51,50,54,55,23,6,6,35,34,
+46,2,35,34,7,39,54,54,55,36,0,53,52,46,2,35,34,14,2,21,35,52,62,2,51,50,30,
+2,21,20,7,33,54,54,53,52,46,2,35,34,14,2,21,35,52,62,2,51,50,30,2,21,20,14,
+2,7,5,2,9,25,27,25,8,32,61,56,51,21,48,75,31,94,38,121,97,43,95,94,86,34,
+93,61,94,6,18,27,38,28,145,213,68,253,22,55,211,162,2,8,24,26,24,9,31,62,
+58,52,22,47,75,31,95,39,120,97,43,96,93,87,34,92,61,94,12,49,55,1,18,1,17,
+37,59,74,37,47,79,58,33,147,59,99,132,74,72,132,101,60,45,2,243,26,28,37,
+59,74,37,47,79,58,33,148,59,100,132,74,71,132,101,60,53,124,203,150,180,4,
+9,8,6,19,24,19,39,60,56,97,97,30,36,30,119,56,18,39,41,44,24,125,246,122,
+111,246,143,6,4,9,8,6,19,24,19,39,60,56,97,97,30,36,30,119,56,37,81,48,235,
+1,200,208,66,94,61,28,39,66,89,51,81,139,102,59,45,94,148,103,118,142,69,
+131,65,66,94,61,28,39,66,89,51,81,139,102,59,45,94,148,103,85,215,236,247,
+118,0,4,0,113,255,236,5,33,5,203,0,69,0,83,0,99,0,111,0,0,1,17,20,14,2,35,
+34,38,53,52,62,2,55,17,51,17,54,54,55,38,38,53,52,62,2,51,50,22,21,20,14,
+2,7,22,22,23,54,54,55,23,6,6,7,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,38,
+38,39,19,52,38,39,6,6,21,20,30,2,51,50,54,3,20,22,23,62,3,53,52,38,35,34,
+14,2,1,50,62,2,53,17,6,6,21,20,22,2,94,27,58,89,61,128,130,53,92,123,70,155,
+54,108,49,37,47,34,65,95,62,128,130,39,69,93,55,14,31,17,49,108,62,41,54,
+95,42,26,46,35,20,34,65,96,61,64,96,65,33,28,52,77,48,19,34,17,230,52,38,
+60,65,15,28,40,25,50,57,217,30,25,35,59,42,24,58,51,24,40,27,15,254,0,24,
+31,18,7,85,104,58,2,119,254,168,71,114,79,43,132,130,70,121,104,91,42,3,24,
+253,64,29,56,29,73,150,81,70,114,80,43,135,127,59,102,91,80,37,26,50,24,32,
+51,17,121,15,45,28,42,86,88,92,48,71,114,79,43,39,69,96,58,54,112,108,103,
+45,27,57,28,254,6,72,148,69,65,167,83,26,49,38,22,90,3,225,65,127,56,28,63,
+69,75,40,66,69,24,43,60,251,162,24,43,59,35,1,17,60,145,84,68,77,0,2,0,135,
+1,66,9,111,4,168,0,68,0,88,0,0,19,52,62,2,51,50,30,2,23,50,62,2,55,51,30,
+3,51,50,62,2,55,51,30,3,51,17,51,17,35,17,46,3,39,35,14,3,35,34,46,2,39,35,
+14,3,7,14,3,35,34,46,2,55,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,135,72,
+121,162,90,84,153,119,76,8,59,91,63,33,2,159,1,28,49,69,42,40,68,49,29,2,
+160,1,44,76,106,64,160,160,74,118,92,67,22,8,18,55,69,77,39,39,82,73,58,16,
+9,22,68,85,99,53,15,81,115,143,78,90,162,121,72,156,46,79,105,59,59,104,78,
+45,45,78,104,59,59,105,79,46,2,244,97,161,115,63,57,103,146,89,27,60,96,69,
+69,96,60,27,27,60,96,69,69,96,60,27,1,137,252,158,1,82,1,19,44,69,51,54,71,
+42,17,17,42,71,54,51,69,44,19,1,78,125,89,48,63,114,160,97,68,110,78,43,43,
+78,110,68,67,111,80,43,43,80,111,0,1,0,135,255,236,5,172,5,205,0,26,0,0,1,
+35,17,1,39,55,1,7,39,1,1,55,23,1,39,55,1,17,51,21,33,53,51,17,35,53,33,2,
+201,209,2,57,133,107,1,114,108,144,254,74,1,227,133,109,254,141,106,133,253,
+164,209,253,190,209,209,2,66,5,41,253,203,1,223,160,90,254,67,88,170,254,
+146,254,110,158,88,254,68,90,159,1,250,253,174,141,141,4,156,141,0,5,0,158,
+255,236,5,143,5,203,0,96,0,112,0,128,0,140,0,154,0,0,1,20,14,2,7,22,22,23,
+54,54,55,23,6,6,7,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,38,38,39,6,6,7,
+22,22,21,20,14,2,35,34,38,53,52,62,2,55,38,38,39,6,6,7,39,54,55,38,38,53,
+52,62,2,51,50,30,2,21,20,6,7,23,54,54,55,38,38,53,52,62,2,51,50,22,3,52,38,
+39,6,6,21,20,30,2,51,50,62,2,1,20,22,23,54,54,53,52,46,2,35,34,14,2,19,52,
+38,39,6,6,21,20,22,51,50,54,1,20,22,23,54,54,53,52,38,35,34,14,2,5,78,39,
+67,92,54,14,28,15,50,107,62,41,54,94,42,26,46,35,20,34,65,96,61,64,96,65,
+33,27,53,76,49,17,33,16,84,170,78,37,47,34,65,96,61,128,130,39,67,92,54,17,
+34,18,48,102,57,41,98,80,48,67,34,65,95,62,64,96,65,33,113,100,74,84,169,
+79,37,47,34,65,95,62,128,130,148,52,38,60,65,15,28,40,26,24,40,27,15,252,
+185,47,37,63,68,15,28,41,25,24,40,27,15,217,32,26,71,86,57,51,50,57,1,149,
+31,25,71,88,57,51,25,39,28,15,4,197,61,105,91,81,37,25,46,23,32,51,17,121,
+15,45,28,42,86,88,92,48,71,114,79,43,39,69,96,58,54,112,109,103,46,26,52,
+26,48,88,46,71,150,80,71,114,79,43,132,130,60,103,92,80,37,29,56,28,26,44,
+16,121,27,47,80,167,93,70,114,80,43,39,69,97,57,113,212,87,119,48,88,46,73,
+150,81,70,114,80,43,135,251,202,72,148,69,65,167,83,26,49,38,22,24,43,59,
+3,189,69,144,68,60,160,88,26,49,37,23,24,43,60,252,67,63,129,56,54,135,75,
+68,77,90,3,225,65,127,56,57,137,81,66,69,24,43,60,0,7,0,68,255,236,7,123,
+5,203,0,95,0,109,0,125,0,139,0,155,0,167,0,179,0,0,1,20,14,2,7,22,22,23,54,
+54,55,23,6,6,7,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,39,6,6,7,22,22,21,
+20,14,2,35,34,38,53,52,62,2,55,38,38,39,6,6,7,39,54,54,55,38,38,53,52,62,
+2,51,50,30,2,21,20,6,7,23,54,54,55,38,38,53,52,62,2,51,50,22,3,52,38,39,6,
+6,21,20,30,2,51,50,54,1,20,22,23,54,54,53,52,46,2,35,34,14,2,19,52,38,39,
+6,6,21,20,22,51,50,62,2,1,20,22,23,62,3,53,52,38,35,34,14,2,1,20,6,35,34,
+38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,6,18,38,68,91,54,14,
+27,16,49,108,62,41,54,94,42,26,46,34,20,34,65,96,61,64,96,65,33,28,52,77,
+48,65,84,171,77,37,47,34,65,96,61,128,130,38,68,92,54,17,34,19,48,102,57,
+41,50,88,40,47,67,34,65,95,62,64,96,65,33,113,100,74,83,170,78,37,47,34,66,
+95,61,128,130,147,52,38,60,65,15,28,40,25,50,57,252,184,47,37,63,68,15,28,
+40,25,25,39,28,15,217,31,26,71,87,58,51,24,40,27,15,1,150,30,25,35,59,42,
+24,58,51,24,40,27,15,252,106,56,46,50,52,57,45,45,57,6,107,56,47,49,53,57,
+45,45,58,4,197,61,105,91,81,37,25,46,23,32,51,17,121,15,45,28,42,86,88,92,
+48,71,114,79,43,39,69,96,58,54,112,108,103,45,106,48,88,46,71,150,80,71,114,
+79,43,132,130,60,103,92,80,37,29,56,28,26,44,16,121,14,37,23,79,169,92,70,
+114,80,43,39,69,97,57,113,212,87,119,48,88,46,73,150,81,70,114,80,43,135,
+251,202,72,148,69,65,167,83,26,49,38,22,90,3,225,69,144,68,60,160,88,26,49,
+37,23,24,43,60,252,67,63,129,56,54,135,75,68,77,24,43,59,3,189,65,127,56,
+28,63,69,75,40,66,69,24,43,60,254,65,49,53,53,49,48,55,55,48,49,53,53,49,
+48,55,55,0,2,0,68,255,236,5,164,5,195,0,75,0,95,0,0,1,34,14,2,7,39,62,3,51,
+50,22,23,54,51,50,30,2,23,7,46,3,35,34,34,7,30,3,21,20,14,2,7,21,20,30,2,
+51,50,62,2,53,51,20,14,2,35,34,46,4,53,53,38,38,53,52,62,2,55,38,38,19,50,
+62,2,53,52,46,2,39,14,3,21,20,30,2,2,51,62,108,93,82,36,114,44,99,119,144,
+89,48,94,47,84,92,89,152,127,106,42,125,34,84,98,113,62,10,25,8,40,69,51,
+30,34,63,90,57,19,32,42,24,31,49,32,17,140,40,72,99,58,34,68,61,53,38,22,
+111,125,28,50,69,40,13,34,180,41,60,39,19,26,47,64,39,36,54,35,18,19,39,60,
+5,55,27,71,120,93,59,115,152,89,36,23,20,43,35,87,151,115,63,93,120,71,27,
+2,38,96,112,128,70,72,128,102,70,15,129,79,101,57,21,21,54,91,71,98,141,90,
+43,9,29,53,89,128,89,125,25,189,173,65,124,112,98,41,3,3,253,66,39,69,93,
+55,61,114,99,80,29,29,80,99,114,61,55,93,69,39,0,2,0,47,255,236,5,205,5,195,
+0,87,0,107,0,0,1,38,38,53,52,62,2,55,38,38,35,34,14,2,7,39,62,3,51,50,22,
+23,54,51,50,30,2,23,7,46,3,35,34,34,7,30,3,21,20,14,2,7,21,20,30,2,51,50,
+62,2,53,51,20,22,51,50,54,53,51,20,6,35,34,38,39,35,6,6,35,34,46,4,53,19,
+50,62,2,53,52,46,2,39,14,3,21,20,30,2,2,139,110,125,28,50,68,40,12,35,12,
+62,108,94,81,36,115,45,99,119,144,89,48,94,46,84,92,89,152,128,105,42,125,
+41,86,95,107,62,9,26,8,40,70,51,30,34,63,90,57,19,31,43,24,31,49,32,17,139,
+45,37,35,47,125,104,85,29,59,28,9,35,124,84,34,68,61,53,39,22,84,42,60,39,
+19,26,47,65,38,36,54,36,18,19,39,61,1,246,25,189,173,65,124,112,98,41,3,3,
+27,71,120,93,59,115,152,89,36,23,20,43,35,87,151,115,63,93,120,71,27,2,38,
+96,112,128,70,72,128,102,70,15,129,78,101,57,22,23,56,90,68,49,53,55,49,105,
+114,21,32,113,95,9,29,53,89,128,89,1,0,39,69,93,55,61,114,99,80,29,29,80,
+99,114,61,55,93,69,39,0,0,1,0,135,255,236,4,35,5,203,0,9,0,0,5,9,3,23,9,3,
+3,225,252,166,2,82,253,182,3,82,64,253,176,2,37,253,192,2,109,20,1,139,1,
+119,1,88,1,133,127,254,235,254,185,254,163,254,215,0,0,3,0,90,255,236,5,14,
+5,203,0,9,0,21,0,33,0,0,5,9,3,23,9,4,52,54,51,50,22,21,20,6,35,34,38,37,20,
+6,35,34,38,53,52,54,51,50,22,3,227,252,166,2,82,253,182,3,82,64,253,176,2,
+37,253,192,2,109,252,53,58,45,45,57,53,49,47,56,4,180,56,46,50,52,57,45,45,
+57,20,1,139,1,119,1,88,1,133,127,254,235,254,185,254,163,254,215,2,127,48,
+55,55,48,49,53,53,49,49,53,53,49,48,55,55,0,0,2,0,227,255,236,4,190,5,209,
+0,3,0,25,0,0,33,35,17,51,5,34,14,2,21,20,30,2,51,7,34,36,38,2,53,52,18,54,
+36,51,1,131,160,160,3,59,124,202,144,78,70,138,205,135,10,174,254,251,175,
+88,99,182,1,2,159,5,182,112,90,164,229,138,141,226,158,85,139,104,194,1,21,
+174,170,1,24,200,110,0,0,4,0,227,255,236,5,139,5,209,0,3,0,25,0,37,0,49,0,
+0,33,35,17,51,5,34,14,2,21,20,30,2,51,7,34,36,38,2,53,52,18,54,36,51,5,20,
+6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,1,131,160,
+160,4,8,125,202,144,78,70,139,205,135,10,174,254,251,175,88,99,182,1,2,159,
+253,55,56,46,50,52,57,45,45,57,56,46,50,52,57,45,45,57,5,182,112,90,164,229,
+138,141,226,158,85,139,104,194,1,21,174,170,1,24,200,110,129,50,53,53,50,
+48,54,54,250,228,49,53,53,49,48,55,55,0,3,0,68,1,240,6,213,3,254,0,37,0,49,
+0,61,0,0,1,20,14,2,35,34,38,39,33,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,
+33,54,54,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,
+20,22,51,50,54,6,213,41,74,100,59,106,139,20,253,162,10,48,70,88,50,61,99,
+71,39,39,71,99,61,49,87,69,49,12,2,96,20,139,104,58,100,74,42,150,70,54,54,
+69,69,54,54,70,251,144,71,54,54,69,69,54,54,71,2,250,63,99,68,36,102,94,47,
+73,50,26,36,68,98,62,61,98,67,36,26,48,70,44,89,99,36,67,96,61,63,70,72,63,
+65,72,73,66,63,70,72,63,65,72,73,0,0,5,0,68,1,20,6,213,3,254,0,37,0,49,0,
+61,0,73,0,85,0,0,1,20,14,2,35,34,38,39,33,14,3,35,34,46,2,53,52,62,2,51,50,
+30,2,23,33,54,54,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,
+34,6,21,20,22,51,50,54,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,
+53,52,54,51,50,22,6,213,41,74,100,59,106,139,20,253,162,10,48,70,88,50,61,
+99,71,39,39,71,99,61,49,87,69,49,12,2,96,20,139,104,58,100,74,42,150,70,54,
+54,69,69,54,54,70,251,144,71,54,54,69,69,54,54,71,1,98,56,46,50,53,58,45,
+45,57,1,131,56,46,50,53,58,45,45,57,2,250,63,99,68,36,102,94,47,73,50,26,
+36,68,98,62,61,98,67,36,26,48,70,44,89,99,36,67,96,61,63,70,72,63,65,72,73,
+66,63,70,72,63,65,72,73,254,195,50,53,53,50,48,54,54,48,50,53,53,50,48,54,
+54,0,5,0,68,1,20,6,213,4,219,0,37,0,49,0,61,0,73,0,85,0,0,1,20,14,2,35,34,
+38,39,33,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,33,54,54,51,50,30,2,7,52,
+38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,1,20,6,35,
+34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,6,213,41,74,100,
+59,106,139,20,253,162,10,48,70,88,50,61,99,71,39,39,71,99,61,49,87,69,49,
+12,2,96,20,139,104,58,100,74,42,150,70,54,54,69,69,54,54,70,251,144,71,54,
+54,69,69,54,54,71,2,33,56,47,49,53,57,45,45,58,56,47,49,53,57,45,45,58,2,
+250,63,99,68,36,102,94,47,73,50,26,36,68,98,62,61,98,67,36,26,48,70,44,89,
+99,36,67,96,61,63,70,72,63,65,72,73,66,63,70,72,63,65,72,73,254,195,50,53,
+53,50,48,54,54,2,202,50,53,53,50,48,54,54,0,0,3,0,158,0,141,6,94,5,23,0,9,
+0,12,0,15,0,0,1,1,39,17,55,1,1,23,17,7,1,17,1,5,17,1,3,119,253,133,94,94,
+2,137,2,123,94,94,251,57,1,170,2,224,254,86,2,123,254,18,43,3,123,43,254,
+201,1,240,43,252,133,43,2,67,253,240,1,74,168,2,16,254,182,0,0,5,0,158,0,
+141,6,94,5,23,0,9,0,12,0,15,0,27,0,39,0,0,1,1,39,17,55,1,1,23,17,7,1,17,1,
+5,17,1,3,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,
+22,3,119,253,133,94,94,2,137,2,123,94,94,251,57,1,170,2,224,254,86,48,55,
+47,49,53,57,45,45,57,55,47,49,53,57,45,45,57,2,123,254,18,43,3,123,43,254,
+201,1,240,43,252,133,43,2,67,253,240,1,74,168,2,16,254,182,1,123,49,53,53,
+49,48,55,55,252,173,49,53,53,49,48,55,55,0,1,0,227,255,242,5,47,5,199,0,61,
+0,0,37,62,3,51,50,30,2,21,20,14,2,35,53,50,62,2,53,52,38,35,34,14,2,7,35,
+17,62,3,51,50,30,2,21,20,14,2,35,53,50,62,2,53,52,38,35,34,14,2,7,17,1,139,
+64,148,156,158,74,54,117,98,63,38,67,92,55,12,35,33,23,96,87,94,177,157,132,
+48,160,82,188,198,202,98,54,117,98,63,38,67,92,55,12,35,33,23,96,87,94,177,
+157,132,48,190,60,102,73,42,22,56,96,74,49,85,63,36,129,8,21,36,29,45,63,
+58,91,113,55,4,35,93,154,111,62,26,60,99,73,49,82,60,33,129,8,22,36,29,45,
+63,58,91,113,55,252,202,0,2,0,227,255,242,5,47,5,199,0,56,0,65,0,0,1,34,6,
+7,17,54,54,51,50,30,2,21,20,14,2,35,53,50,62,2,53,52,38,35,34,14,2,7,35,17,
+62,3,51,50,30,2,21,20,14,2,35,53,50,62,2,53,52,38,1,54,54,55,17,6,6,7,17,
+3,227,74,141,65,71,141,68,54,117,98,63,38,67,92,55,12,35,33,23,96,87,94,177,
+157,132,48,160,82,188,198,202,98,54,117,98,63,38,67,92,55,12,35,33,23,96,
+253,81,37,80,43,50,84,34,5,49,36,31,252,163,31,35,22,56,96,74,49,85,63,36,
+129,8,21,36,29,45,63,58,91,113,55,4,35,93,154,111,62,26,60,99,73,49,82,60,
+33,129,8,22,36,29,45,63,251,141,35,63,27,3,82,37,78,38,252,202,0,0,3,0,90,
+255,236,6,53,5,205,0,19,0,39,0,109,0,0,1,52,46,2,35,34,14,2,21,20,30,2,51,
+50,62,2,19,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,52,62,2,51,50,30,2,
+21,20,14,2,7,23,54,54,51,51,53,51,17,35,53,35,34,38,39,7,30,3,21,20,14,2,
+35,34,46,2,53,52,62,2,55,39,6,6,35,35,21,35,17,51,21,51,50,22,23,55,46,3,
+3,248,29,51,68,39,37,66,51,30,28,49,67,40,40,69,50,28,8,31,53,71,40,39,70,
+52,31,28,51,70,43,42,72,52,29,253,229,61,97,123,63,66,124,98,59,32,49,57,
+24,2,56,165,102,91,159,159,91,102,170,51,2,24,60,51,35,59,98,129,69,70,127,
+97,58,35,51,60,24,2,51,170,102,72,160,160,72,102,165,56,2,24,57,49,32,4,70,
+66,95,62,29,29,62,95,66,66,106,75,40,40,75,106,253,115,69,111,77,42,42,77,
+111,69,69,98,61,28,28,61,98,3,20,100,147,97,47,47,97,147,100,53,97,79,54,
+10,8,11,7,184,254,17,172,6,12,8,10,52,80,104,61,102,149,97,47,47,97,149,102,
+61,104,80,52,10,8,12,6,172,1,239,184,7,11,8,10,54,79,97,0,7,0,90,255,236,
+6,217,5,205,0,19,0,39,0,51,0,63,0,75,0,87,0,157,0,0,1,52,46,2,35,34,14,2,
+21,20,30,2,51,50,62,2,19,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,20,6,
+35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,
+38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,5,20,14,2,35,34,46,
+2,53,52,62,2,55,39,6,6,35,35,21,35,17,51,21,51,50,22,23,55,46,3,53,52,62,
+2,51,50,30,2,21,20,14,2,7,23,54,54,51,51,53,51,17,35,53,35,34,38,39,7,30,
+3,4,74,29,51,68,39,37,66,51,30,28,49,67,40,40,69,50,28,8,31,53,71,40,39,70,
+52,31,28,51,70,43,42,72,52,29,1,164,56,47,49,53,57,45,45,58,56,47,49,53,57,
+45,45,58,252,20,56,46,50,53,58,45,45,57,56,46,50,53,58,45,45,57,2,232,59,
+98,129,69,70,127,97,58,35,51,60,24,2,51,171,102,153,160,160,153,103,165,56,
+2,24,57,49,32,60,98,123,63,65,125,97,59,32,48,57,24,2,55,166,102,172,160,
+160,172,102,170,51,2,24,60,51,35,4,70,66,95,62,29,29,62,95,66,66,106,75,40,
+40,75,106,253,115,69,111,77,42,42,77,111,69,69,98,61,28,28,61,98,2,249,50,
+52,52,50,48,54,54,253,69,50,53,53,50,48,54,54,2,91,50,52,52,50,48,54,54,253,
+69,50,53,53,50,48,54,54,89,102,149,97,47,47,97,149,102,61,104,80,52,10,8,
+12,6,172,1,239,184,7,11,8,10,54,79,97,53,100,147,97,47,47,97,147,100,53,97,
+79,54,10,8,11,7,184,254,17,172,6,12,8,10,52,80,104,0,0,5,0,135,255,236,5,
+244,5,205,0,69,0,80,0,91,0,102,0,113,0,0,1,51,17,35,53,35,14,3,7,21,30,3,
+23,51,53,51,17,35,53,35,14,3,35,34,46,2,39,35,21,35,17,51,21,51,62,3,55,53,
+46,3,39,35,21,35,17,51,21,51,62,3,51,50,30,2,23,51,1,34,14,2,7,33,46,3,3,
+50,62,2,55,33,30,3,19,34,14,2,7,33,46,3,3,50,62,2,55,33,30,3,5,84,160,160,
+133,10,45,60,73,37,39,75,63,46,10,125,160,160,123,12,73,110,139,78,79,140,
+108,71,11,125,160,160,127,10,47,63,73,38,38,72,60,44,9,135,160,160,133,12,
+75,109,134,71,72,135,109,74,12,133,253,233,43,80,67,47,10,1,241,10,48,67,
+82,43,45,82,66,47,10,254,15,9,45,65,82,46,40,77,64,48,10,1,223,10,48,64,78,
+40,42,79,64,47,10,254,31,9,45,64,78,5,6,254,98,132,52,87,68,46,10,8,13,48,
+67,87,53,164,254,78,129,86,128,87,43,43,87,128,86,129,1,178,164,53,86,67,
+47,13,8,11,47,68,87,52,132,1,158,143,83,127,87,45,45,87,127,83,254,43,27,
+52,79,51,51,79,52,27,253,213,25,51,77,52,52,77,51,25,4,203,27,51,76,49,49,
+76,51,27,253,229,24,50,73,50,50,73,50,24,0,7,0,135,255,236,5,244,5,205,0,
+69,0,80,0,91,0,102,0,113,0,125,0,137,0,0,1,51,17,35,53,35,14,3,7,21,30,3,
+23,51,53,51,17,35,53,35,14,3,35,34,46,2,39,35,21,35,17,51,21,51,62,3,55,53,
+46,3,39,35,21,35,17,51,21,51,62,3,51,50,30,2,23,51,1,34,14,2,7,33,46,3,3,
+50,62,2,55,33,30,3,19,34,14,2,7,33,46,3,3,50,62,2,55,33,30,3,5,20,6,35,34,
+38,53,52,54,51,50,22,5,52,54,51,50,22,21,20,6,35,34,38,5,84,160,160,133,10,
+45,60,73,37,39,75,63,46,10,125,160,160,123,12,73,110,139,78,79,140,108,71,
+11,125,160,160,127,10,47,63,73,38,38,72,60,44,9,135,160,160,133,12,75,109,
+134,71,72,135,109,74,12,133,253,233,43,80,67,47,10,1,241,10,48,67,82,43,45,
+82,66,47,10,254,15,9,45,65,82,46,40,77,64,48,10,1,223,10,48,64,78,40,42,79,
+64,47,10,254,31,9,45,64,78,2,99,56,47,49,53,57,45,45,58,251,137,57,45,45,
+58,53,50,46,56,5,6,254,98,132,52,87,68,46,10,8,13,48,67,87,53,143,254,99,
+129,86,128,87,43,43,87,128,86,129,1,157,143,53,86,67,47,13,8,11,47,68,87,
+52,132,1,158,143,83,127,87,45,45,87,127,83,254,43,27,52,79,51,51,79,52,27,
+253,213,25,51,77,52,52,77,51,25,4,203,27,51,76,49,49,76,51,27,253,229,24,
+50,73,50,50,73,50,24,70,49,53,53,49,48,55,55,48,48,55,55,48,49,53,53,0,3,
+0,135,0,0,4,90,5,182,0,3,0,7,0,11,0,0,1,35,17,51,1,35,17,51,1,35,17,51,4,
+90,160,160,252,205,160,160,1,154,160,160,3,113,2,69,253,187,2,69,250,74,2,
+70,0,4,0,135,254,180,4,90,5,182,0,23,0,27,0,31,0,35,0,0,5,34,6,7,39,54,54,
+51,50,30,2,51,50,54,55,23,6,6,35,34,46,2,1,35,17,51,1,35,17,51,1,35,17,51,
+1,190,47,75,31,94,38,121,97,45,97,93,85,32,47,76,31,94,38,121,97,43,96,93,
+87,2,122,160,160,252,205,160,160,1,154,160,160,233,39,60,56,97,89,24,28,24,
+39,59,55,97,89,24,28,24,4,90,2,69,253,187,2,69,250,74,2,70,0,5,0,135,0,0,
+4,90,5,182,0,11,0,23,0,27,0,31,0,35,0,0,37,20,6,35,34,38,53,52,54,51,50,22,
+5,20,6,35,34,38,53,52,54,51,50,22,19,35,17,51,1,35,17,51,1,35,17,51,1,84,
+56,46,50,53,58,45,45,57,3,4,56,46,50,53,58,45,45,57,2,160,160,252,205,160,
+160,1,154,160,160,182,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,2,139,
+2,69,253,187,2,69,250,74,2,70,0,0,4,0,135,0,0,4,90,5,182,0,3,0,7,0,11,0,15,
+0,0,1,35,17,51,1,35,17,51,1,35,17,51,17,35,17,51,4,90,160,160,252,205,160,
+160,1,154,160,160,160,160,1,209,2,65,253,191,2,65,251,238,2,70,1,43,2,69,
+0,1,0,90,0,0,6,227,5,182,0,61,0,0,1,54,54,55,51,30,3,51,50,54,55,51,14,3,
+35,34,46,2,39,35,6,6,7,17,35,17,46,3,39,35,14,3,35,34,46,2,39,51,22,22,51,
+50,62,2,55,51,20,22,23,17,51,3,233,51,59,5,160,1,29,45,60,33,86,69,5,159,
+5,44,76,106,68,32,76,73,66,23,8,28,99,58,159,29,56,48,38,12,8,23,63,70,72,
+32,74,110,73,40,4,160,3,80,79,37,60,44,25,2,159,55,48,159,2,240,21,133,106,
+69,96,60,27,123,129,111,148,90,38,18,43,71,52,83,82,13,253,137,2,121,7,28,
+43,59,39,52,71,43,18,38,90,148,111,122,130,27,60,96,69,100,133,23,2,194,0,
+3,0,90,0,0,6,227,5,182,0,61,0,73,0,85,0,0,1,54,54,55,51,30,3,51,50,54,55,
+51,14,3,35,34,46,2,39,35,6,6,7,17,35,17,46,3,39,35,14,3,35,34,46,2,39,51,
+22,22,51,50,62,2,55,51,20,22,23,17,51,1,20,6,35,34,38,53,52,54,51,50,22,5,
+20,6,35,34,38,53,52,54,51,50,22,3,233,51,59,5,160,1,29,45,60,33,86,69,5,159,
+5,44,76,106,68,32,76,73,66,23,8,28,99,58,159,29,56,48,38,12,8,23,63,70,72,
+32,74,110,73,40,4,160,3,80,79,37,60,44,25,2,159,55,48,159,2,52,56,47,49,53,
+57,45,45,58,251,209,56,47,49,53,57,45,45,58,2,240,21,133,106,69,96,60,27,
+123,129,111,148,90,38,18,43,71,52,83,82,13,253,137,2,121,7,28,43,59,39,52,
+71,43,18,38,90,148,111,122,130,27,60,96,69,100,133,23,2,194,252,2,49,53,53,
+49,48,55,55,48,49,53,53,49,48,55,55,0,0,5,0,90,0,0,6,227,5,182,0,61,0,73,
+0,85,0,97,0,109,0,0,1,54,54,55,51,30,3,51,50,54,55,51,14,3,35,34,46,2,39,
+35,6,6,7,17,35,17,46,3,39,35,14,3,35,34,46,2,39,51,22,22,51,50,62,2,55,51,
+20,22,23,17,51,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,
+51,50,22,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,
+22,3,233,51,59,5,160,1,29,45,60,33,86,69,5,159,5,44,76,106,68,32,76,73,66,
+23,8,28,99,58,159,29,56,48,38,12,8,23,63,70,72,32,74,110,73,40,4,160,3,80,
+79,37,60,44,25,2,159,55,48,159,2,52,56,47,49,53,57,45,45,58,251,209,56,47,
+49,53,57,45,45,58,4,47,56,47,49,53,57,45,45,58,251,209,56,47,49,53,57,45,
+45,58,2,240,21,133,106,69,96,60,27,123,129,111,148,90,38,18,43,71,52,83,82,
+13,253,137,2,121,7,28,43,59,39,52,71,43,18,38,90,148,111,122,130,27,60,96,
+69,100,133,23,2,194,254,207,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,
+253,3,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,0,5,0,90,0,0,6,227,5,182,
+0,69,0,81,0,93,0,105,0,117,0,0,1,33,17,54,54,55,51,30,3,51,50,54,55,51,14,
+3,35,34,46,2,39,35,6,6,7,17,33,21,33,53,33,17,46,3,39,35,14,3,35,34,46,2,
+39,51,22,22,51,50,62,2,55,51,20,22,23,17,33,53,33,1,20,6,35,34,38,53,52,54,
+51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,
+22,5,20,6,35,34,38,53,52,54,51,50,22,5,39,254,194,51,59,5,160,1,29,45,60,
+33,86,69,5,159,5,44,76,106,68,32,76,73,66,23,8,28,99,58,1,62,252,242,1,49,
+29,56,48,38,12,8,23,63,70,72,32,74,110,73,40,4,160,3,80,79,37,60,44,25,2,
+159,55,48,254,207,3,14,252,199,56,47,49,53,57,45,45,58,4,47,56,47,49,53,57,
+45,45,58,56,47,49,53,57,45,45,58,251,209,56,47,49,53,57,45,45,58,5,41,253,
+199,21,133,106,69,96,60,27,123,129,111,148,90,38,18,43,71,52,83,82,13,254,
+22,141,141,1,236,7,28,43,59,39,52,71,43,18,38,90,148,111,122,130,27,60,96,
+69,100,133,23,2,53,141,252,2,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,
+2,157,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,0,0,1,0,90,255,240,5,100,
+5,199,0,67,0,0,1,34,14,2,7,39,62,3,51,50,30,2,21,20,14,2,35,21,33,21,33,21,
+50,30,2,21,20,14,2,35,34,46,2,39,55,30,3,51,50,62,2,53,52,38,35,35,17,51,
+50,62,2,53,52,46,2,2,143,68,129,119,109,48,92,61,140,146,148,70,54,117,98,
+63,38,67,92,55,2,133,253,123,55,92,67,38,63,98,117,54,70,148,146,140,61,103,
+48,106,115,125,68,47,69,45,22,81,69,106,106,34,56,39,21,21,44,70,5,59,35,
+62,82,48,76,74,110,72,35,22,57,96,73,49,82,59,33,183,139,231,33,60,82,49,
+74,95,56,22,35,72,109,74,86,48,86,65,38,17,30,39,22,57,38,3,43,8,21,36,29,
+22,39,30,17,0,0,4,0,90,255,240,6,111,5,199,0,67,0,79,0,91,0,103,0,0,1,34,
+14,2,7,39,62,3,51,50,30,2,21,20,14,2,35,21,33,21,33,21,50,30,2,21,20,14,2,
+35,34,46,2,39,55,30,3,51,50,62,2,53,52,38,35,35,17,51,50,62,2,53,52,46,2,
+1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,37,20,
+6,35,34,38,53,52,54,51,50,22,2,143,68,129,119,109,48,92,61,140,146,148,70,
+54,117,98,63,38,67,92,55,2,133,253,123,55,92,67,38,63,98,117,54,70,148,146,
+140,61,103,48,106,115,125,68,47,69,45,22,81,69,106,106,34,56,39,21,21,44,
+70,2,6,56,47,49,53,57,45,45,58,56,47,49,53,57,45,45,58,1,170,56,47,49,53,
+57,45,45,58,5,59,35,62,82,48,76,74,110,72,35,22,57,96,73,49,82,59,33,183,
+139,231,33,60,82,49,74,95,56,22,35,72,109,74,86,48,86,65,38,17,30,39,22,57,
+38,3,43,8,21,36,29,22,39,30,17,254,187,50,53,53,50,48,54,54,253,204,50,53,
+53,50,48,54,54,212,50,53,53,50,48,54,54,0,0,3,0,90,255,240,6,23,5,199,0,71,
+0,83,0,95,0,0,1,34,14,2,7,39,62,3,51,50,30,2,21,20,14,2,35,21,33,17,51,17,
+35,17,33,21,50,30,2,21,20,14,2,35,34,46,2,39,55,30,3,51,50,62,2,53,52,38,
+35,35,17,51,50,62,2,53,52,46,2,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,
+35,34,38,53,52,54,51,50,22,2,143,68,129,119,109,48,92,61,140,146,148,70,54,
+117,98,63,38,67,92,55,2,152,160,160,253,104,55,92,67,38,63,98,117,54,70,148,
+146,140,61,103,48,106,115,125,68,47,69,45,22,81,69,106,106,34,56,39,21,21,
+44,70,2,6,56,47,49,53,57,45,45,58,56,47,49,53,57,45,45,58,5,59,35,62,82,48,
+76,74,110,72,35,22,57,96,73,49,82,59,33,183,1,72,252,229,1,72,231,33,60,82,
+49,74,95,56,22,35,72,109,74,86,48,86,65,38,17,30,39,22,57,38,3,43,8,21,36,
+29,22,39,30,17,254,187,50,53,53,50,48,54,54,253,204,50,53,53,50,48,54,54,
+0,1,0,90,255,240,5,238,5,199,0,71,0,0,1,34,14,2,7,39,62,3,51,50,30,2,21,20,
+14,2,35,21,33,17,51,17,35,17,33,21,50,30,2,21,20,14,2,35,34,46,2,39,55,30,
+3,51,50,62,2,53,52,38,35,35,17,51,50,62,2,53,52,46,2,2,143,68,129,119,109,
+48,92,61,140,146,148,70,54,117,98,63,38,67,92,55,2,111,160,160,253,145,55,
+92,67,38,63,98,117,54,70,148,146,140,61,103,48,106,115,125,68,47,69,45,22,
+81,69,106,106,34,56,39,21,21,44,70,5,59,35,62,82,48,76,74,110,72,35,22,57,
+96,73,49,82,59,33,183,1,72,252,229,1,72,231,33,60,82,49,74,95,56,22,35,72,
+109,74,86,48,86,65,38,17,30,39,22,57,38,3,43,8,21,36,29,22,39,30,17,0,1,0,
+113,0,0,5,53,5,182,0,53,0,0,1,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,
+62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,
+33,21,33,53,33,2,131,8,21,53,56,52,19,72,118,85,46,159,101,82,38,69,51,30,
+160,30,51,69,38,82,101,159,46,85,118,72,16,54,58,55,18,8,1,55,252,242,1,55,
+3,215,35,43,26,9,44,105,174,130,139,141,161,154,29,64,103,74,186,186,74,103,
+64,29,154,161,141,139,130,174,105,44,8,25,44,36,252,182,141,141,0,3,0,113,
+0,0,5,53,5,182,0,53,0,65,0,77,0,0,1,35,14,3,35,34,46,2,53,53,51,21,20,22,
+51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,
+35,17,33,21,33,53,33,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,
+52,54,51,50,22,2,131,8,21,53,56,52,19,72,118,85,46,159,101,82,38,69,51,30,
+160,30,51,69,38,82,101,159,46,85,118,72,16,54,58,55,18,8,1,55,252,242,1,55,
+2,2,56,46,50,53,58,45,45,57,253,100,55,47,49,53,57,45,45,57,3,215,35,43,26,
+9,44,105,174,130,139,141,161,154,29,64,103,74,186,186,74,103,64,29,154,161,
+141,139,130,174,105,44,8,25,44,36,252,182,141,141,1,166,49,53,53,49,48,55,
+55,48,49,53,53,49,48,55,55,0,0,3,0,113,0,0,5,53,5,182,0,61,0,73,0,85,0,0,
+37,53,33,53,33,17,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,
+21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,33,21,33,21,33,
+21,33,53,19,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,
+22,2,131,254,119,1,137,8,21,53,56,52,19,72,118,85,46,159,101,82,38,69,51,
+30,160,30,51,69,38,82,101,159,46,85,118,72,16,54,58,55,18,8,1,137,254,119,
+1,137,252,78,239,55,47,49,53,57,45,45,57,2,156,56,46,50,53,58,45,45,57,141,
+105,141,2,84,35,43,26,9,44,105,174,130,139,141,161,154,29,64,103,74,186,186,
+74,103,64,29,154,161,141,139,130,174,105,44,8,25,44,36,253,172,141,105,141,
+141,1,228,50,53,53,50,48,54,54,48,50,53,53,50,48,54,54,0,0,1,0,113,0,0,5,
+53,5,182,0,61,0,0,1,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,
+51,21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,17,33,21,33,17,
+33,21,33,53,33,17,33,53,33,2,131,8,21,53,56,52,19,72,118,85,46,159,101,82,
+38,69,51,30,160,30,51,69,38,82,101,159,46,85,118,72,16,54,58,55,18,8,1,55,
+254,201,1,55,252,242,1,55,254,201,1,55,3,215,35,43,26,9,44,105,174,130,139,
+141,161,154,29,64,103,74,186,186,74,103,64,29,154,161,141,139,130,174,105,
+44,8,25,44,36,254,100,141,254,223,141,141,1,33,141,0,1,0,113,0,0,5,53,5,182,
+0,61,0,0,37,21,35,17,51,21,33,17,35,14,3,35,34,46,2,53,53,51,21,20,22,51,
+50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,2,35,34,46,2,39,35,
+17,33,53,51,17,35,53,1,76,160,160,1,55,8,21,53,56,52,19,72,118,85,46,159,
+101,82,38,69,51,30,160,30,51,69,38,82,101,159,46,85,118,72,16,54,58,55,18,
+8,1,55,160,160,172,172,1,240,185,2,160,35,43,26,9,44,105,174,130,139,141,
+161,154,29,64,103,74,186,186,74,103,64,29,154,161,141,139,130,174,105,44,
+8,25,44,36,253,96,185,254,16,172,0,0,4,0,227,0,0,6,80,5,182,0,3,0,7,0,11,
+0,15,0,0,33,35,17,51,1,35,17,51,1,35,17,51,1,35,17,51,1,131,160,160,1,154,
+160,160,3,51,160,160,254,102,159,159,5,182,250,74,5,182,250,74,5,182,250,
+74,5,182,0,2,0,90,255,236,4,49,5,209,0,39,0,51,0,0,19,50,22,23,54,54,51,23,
+34,6,7,22,22,21,20,6,7,22,22,51,7,34,38,39,6,6,35,39,50,54,55,38,38,53,52,
+54,55,38,38,35,1,20,22,23,54,54,53,52,38,39,6,6,100,138,245,99,97,245,139,
+10,108,194,79,79,89,85,79,76,190,111,10,146,241,94,96,240,146,10,110,190,
+75,79,83,88,80,80,195,106,1,117,62,57,57,61,63,55,57,62,5,209,82,78,78,82,
+139,67,62,97,248,147,155,251,96,52,56,139,71,68,68,71,139,56,52,96,251,155,
+147,248,97,62,67,253,147,118,206,75,75,206,118,112,200,75,75,200,0,5,0,113,
+0,0,5,158,5,182,0,51,0,55,0,59,0,63,0,67,0,0,33,17,35,14,3,35,34,46,2,53,
+53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,54,53,53,51,21,20,14,
+2,35,34,46,2,39,35,21,33,17,3,35,21,51,37,21,51,53,1,53,35,21,37,21,51,53,
+2,131,8,21,53,56,52,19,72,118,85,46,159,101,82,38,69,51,30,160,30,51,69,38,
+82,101,159,46,85,118,72,16,54,58,55,18,8,2,123,150,174,174,254,27,162,1,67,
+174,254,201,162,3,215,35,43,26,9,44,105,174,130,139,141,161,154,29,64,103,
+74,186,186,74,103,64,29,154,161,141,139,130,174,105,44,8,25,44,36,213,252,
+254,2,119,185,185,185,185,254,20,168,168,168,168,168,0,2,0,113,255,233,6,
+59,5,205,0,67,0,90,0,0,1,20,14,4,35,34,46,2,53,52,18,55,38,38,39,35,14,3,
+35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,23,54,54,55,23,
+14,3,7,23,62,3,51,50,30,2,37,34,14,2,7,6,6,21,20,30,2,51,50,62,2,53,52,46,
+2,6,59,40,69,90,102,107,50,92,147,103,56,76,68,50,88,22,8,23,64,73,81,40,
+72,118,85,46,159,104,89,34,65,49,30,160,22,39,54,32,68,165,91,131,70,135,
+119,98,33,6,21,55,64,71,37,81,143,106,61,254,119,50,90,76,60,19,5,3,33,62,
+88,55,55,107,85,52,37,64,85,1,152,68,116,96,74,51,26,56,105,150,93,114,1,
+0,134,15,81,74,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,74,186,
+190,62,93,63,37,7,118,239,118,74,90,191,192,189,87,5,27,49,36,22,50,98,142,
+150,28,46,60,32,29,46,29,61,97,69,37,37,74,108,72,60,91,61,31,0,2,0,90,1,
+211,4,186,3,248,0,3,0,7,0,0,19,33,21,33,17,33,21,33,90,4,96,251,160,4,96,
+251,160,2,94,139,2,37,139,0,0,1,0,135,255,236,3,61,2,80,0,6,0,0,5,3,3,39,
+1,51,1,2,168,209,205,131,1,33,117,1,32,20,1,149,254,109,55,2,43,253,215,0,
+0,1,0,135,255,231,4,6,3,135,0,17,0,0,19,33,3,55,19,19,23,3,33,21,33,19,7,
+3,3,39,19,33,135,1,43,182,127,207,209,118,184,1,45,254,205,190,118,209,207,
+127,190,254,205,2,2,1,49,84,254,162,1,90,82,254,209,139,254,207,90,1,90,254,
+161,93,1,51,0,1,0,135,255,238,5,104,1,215,0,88,0,0,1,34,14,2,21,20,22,23,
+51,54,54,51,50,22,21,20,14,2,35,34,46,2,53,52,62,2,51,50,23,53,51,21,22,22,
+23,17,51,17,22,22,51,50,62,2,53,52,38,39,35,6,6,35,34,38,53,52,62,2,51,50,
+30,2,21,20,14,2,35,34,38,39,21,35,53,38,38,39,21,35,17,38,38,1,164,34,59,
+45,26,18,11,8,8,47,37,45,55,23,38,50,28,61,81,49,20,62,89,98,36,59,58,141,
+43,81,42,141,28,56,31,34,59,45,26,15,14,8,8,47,37,45,56,23,39,50,28,60,81,
+49,20,62,88,98,36,31,58,26,141,47,81,38,141,29,59,1,94,16,32,45,28,26,42,
+14,38,48,55,59,26,45,33,19,39,61,73,34,71,93,55,22,22,49,129,32,71,32,1,8,
+254,156,13,14,16,32,46,29,25,41,14,37,49,56,58,26,45,33,19,39,60,73,34,72,
+93,55,22,8,8,28,94,28,67,34,223,1,73,19,20,0,0,1,0,90,255,244,10,84,5,205,
+0,147,0,0,1,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,21,20,6,7,21,22,22,51,
+50,54,55,53,52,62,2,51,50,30,2,21,21,22,22,51,50,54,55,53,38,38,53,52,62,
+2,51,50,30,2,21,20,14,2,35,34,46,2,39,35,17,30,3,51,50,54,55,53,38,38,53,
+52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,39,17,52,46,2,35,34,14,2,21,17,22,
+22,51,50,54,55,53,38,38,53,52,62,2,51,50,30,2,21,20,14,2,35,34,36,39,3,37,
+8,35,78,96,115,72,54,110,90,57,25,42,58,33,30,45,31,15,37,29,22,63,40,115,
+183,79,81,144,199,119,117,198,144,81,79,184,114,40,63,22,29,37,15,31,45,30,
+33,58,42,25,57,90,110,54,72,115,95,79,35,8,47,99,104,110,58,40,63,22,29,37,
+15,31,45,30,33,58,42,25,57,90,110,54,98,161,143,133,69,57,101,140,83,84,141,
+101,57,78,172,106,40,63,22,29,37,15,31,45,30,33,58,42,25,57,90,110,54,158,
+254,242,115,2,152,29,50,39,22,22,55,93,72,47,74,52,28,24,40,51,27,37,64,22,
+8,17,22,86,80,74,136,218,153,83,83,153,220,136,72,80,86,22,17,8,22,64,37,
+27,51,40,24,28,52,74,47,72,93,55,22,22,39,50,29,254,161,43,71,51,29,22,17,
+8,22,64,37,27,50,40,24,28,52,74,47,71,93,55,22,34,76,122,87,2,74,111,170,
+114,58,59,115,169,110,253,188,96,98,22,17,8,22,64,37,27,50,40,24,28,52,74,
+47,71,93,55,22,154,163,0,0,2,0,180,255,246,5,121,5,182,0,73,0,95,0,0,37,6,
+6,35,34,46,2,53,53,51,21,20,22,23,17,46,3,53,53,51,21,20,30,2,51,50,62,2,
+53,53,51,21,20,30,2,51,50,62,2,53,53,51,21,20,14,2,7,17,62,3,53,53,51,21,
+20,14,2,35,34,46,2,39,3,6,6,7,17,62,3,53,53,51,21,20,30,2,23,17,38,38,39,
+3,18,42,137,105,72,119,85,46,154,58,44,58,95,67,36,154,28,51,68,41,39,70,
+54,32,147,32,54,70,39,40,69,51,28,154,38,69,96,59,24,39,29,16,154,46,85,119,
+72,59,90,68,49,18,9,32,93,65,25,44,33,19,147,18,31,42,24,71,87,26,143,69,
+84,38,97,167,130,16,18,114,131,28,3,103,7,50,100,157,114,16,18,81,112,70,
+32,23,57,96,74,63,63,74,96,57,23,32,70,112,81,18,16,108,156,104,55,7,252,
+151,13,46,67,92,59,18,16,130,167,97,38,21,39,57,36,4,0,52,74,17,252,135,9,
+36,58,81,56,63,63,54,80,56,36,10,3,115,15,75,55,0,0,1,0,135,255,236,7,147,
+5,203,0,43,0,0,1,14,3,35,33,1,1,7,9,3,23,1,1,33,50,30,2,23,55,46,3,39,39,
+1,23,9,3,7,1,55,62,3,55,6,66,26,85,103,113,54,254,180,254,61,2,109,66,252,
+166,2,82,253,182,3,82,64,253,176,1,182,1,64,55,112,100,84,28,2,34,69,88,115,
+81,193,3,82,63,253,177,2,36,253,193,2,108,65,252,166,198,81,117,90,69,33,
+2,184,6,8,4,2,254,239,254,215,126,1,139,1,119,1,88,1,133,127,254,235,254,
+250,2,5,8,5,8,7,22,40,62,47,111,1,133,127,254,235,254,185,254,163,254,215,
+126,1,139,123,50,67,43,23,7,0,0,1,0,158,255,236,3,147,5,205,0,59,0,0,37,6,
+6,35,34,46,2,53,52,62,2,55,53,46,3,53,52,62,2,51,50,22,23,7,46,3,35,34,14,
+2,21,20,30,2,51,51,21,35,34,14,2,21,20,30,2,51,50,54,55,3,147,57,169,97,95,
+160,115,64,42,67,85,43,44,82,64,39,68,117,155,86,90,164,57,108,18,47,53,57,
+28,51,95,75,45,39,67,89,50,52,52,49,92,70,43,42,74,100,59,59,114,48,94,57,
+57,53,105,155,102,69,111,84,57,15,8,12,59,87,111,65,100,153,105,54,57,56,
+110,21,31,21,11,36,69,102,66,66,100,66,34,133,35,70,105,69,69,104,69,34,39,
+53,0,1,0,113,0,0,6,137,5,182,0,77,0,0,1,35,14,3,35,34,46,2,39,35,14,3,35,
+34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,30,2,51,50,62,2,53,53,
+51,17,22,51,50,54,55,23,6,6,35,34,38,39,17,35,17,38,38,35,34,6,7,39,54,54,
+51,50,22,23,4,152,9,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,40,72,118,
+85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,67,48,27,159,51,39,48,75,
+31,94,38,121,97,20,40,22,159,31,57,23,48,75,31,94,38,121,97,25,52,26,3,236,
+36,51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,
+103,74,186,190,72,102,63,29,38,78,118,81,141,252,224,17,39,59,55,97,89,5,
+5,254,0,2,45,9,12,39,60,56,97,89,8,6,0,0,2,0,68,0,0,6,137,5,182,0,57,0,77,
+0,0,33,35,17,35,17,35,17,35,34,38,39,6,6,35,34,46,2,39,55,30,3,51,50,50,55,
+46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,22,22,51,51,17,51,17,51,17,51,1,34,
+14,2,21,20,30,2,23,62,3,53,52,46,2,6,137,160,147,160,237,56,103,48,42,88,
+48,89,152,128,105,42,125,34,84,98,113,62,11,39,11,39,69,51,29,47,81,109,62,
+62,109,81,47,26,45,62,37,17,47,20,237,160,147,160,252,107,34,52,36,18,22,
+41,58,37,31,46,30,14,19,36,52,1,33,254,223,1,33,23,22,22,23,35,87,150,115,
+63,93,120,70,28,2,38,96,112,127,71,82,145,107,62,48,97,149,102,65,122,111,
+99,41,5,3,4,10,251,246,4,10,254,180,39,69,93,55,60,117,104,87,29,29,86,104,
+118,60,55,93,69,39,0,0,5,0,227,0,0,4,162,5,182,0,3,0,7,0,19,0,31,0,43,0,0,
+33,33,17,33,1,33,17,33,1,50,22,21,20,6,35,34,38,53,52,54,19,50,22,21,20,6,
+35,34,38,53,52,54,19,50,22,21,20,6,35,34,38,53,52,54,4,162,252,65,3,191,252,
+225,2,127,253,129,1,51,50,53,53,50,48,54,54,48,50,53,53,50,48,54,54,48,50,
+53,53,50,48,54,54,5,182,250,215,4,156,252,209,56,47,49,53,57,45,45,58,2,164,
+56,47,49,53,57,45,45,58,254,184,56,46,50,53,58,45,45,57,0,0,2,0,68,0,0,4,
+201,5,182,0,19,0,39,0,0,1,1,51,17,35,17,52,62,4,55,39,14,3,7,7,1,23,30,3,
+23,55,46,5,53,17,51,17,35,1,2,170,1,127,160,160,1,3,3,5,5,3,10,13,33,50,72,
+51,72,253,154,72,51,72,50,33,13,10,3,5,5,3,3,1,159,159,254,129,4,55,1,127,
+250,74,3,35,99,143,101,67,47,31,16,4,26,49,59,75,51,72,254,16,71,52,75,59,
+49,25,4,15,32,46,67,101,143,99,3,35,250,74,1,127,0,0,1,0,68,0,0,5,168,5,199,
+0,87,0,0,19,1,51,21,51,62,3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,55,
+53,38,38,35,34,14,2,7,17,51,62,3,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,
+55,53,38,38,35,34,6,7,17,33,21,33,53,33,17,52,62,2,55,39,14,3,7,7,68,1,127,
+159,8,55,114,123,132,74,54,117,98,63,25,42,58,33,30,45,31,15,37,29,22,83,
+40,84,134,113,99,50,8,35,79,95,115,72,54,117,97,64,25,42,58,33,30,45,31,15,
+37,29,22,84,40,114,184,79,1,56,252,241,1,56,3,5,7,5,10,13,33,50,72,51,72,
+4,55,1,127,164,50,69,43,19,22,55,94,71,47,74,52,28,24,40,51,27,37,64,21,9,
+17,22,32,58,79,46,254,206,28,51,39,22,22,55,94,71,47,74,52,28,24,40,51,27,
+37,64,21,9,17,22,86,80,253,239,141,141,2,240,114,141,86,50,23,4,26,49,59,
+75,51,72,0,1,0,113,0,0,5,150,5,182,0,33,0,0,1,33,17,33,50,30,2,21,20,14,2,
+35,53,50,54,53,52,46,2,35,33,17,33,21,33,53,33,17,33,53,33,4,76,254,98,1,
+66,119,161,99,43,46,80,108,61,60,75,22,58,101,79,254,188,1,158,252,37,1,157,
+254,99,3,219,5,41,254,125,33,66,100,67,64,96,65,33,129,66,63,31,48,32,16,
+253,114,141,141,4,156,141,0,0,9,0,180,254,203,8,70,6,233,0,21,0,43,0,65,0,
+77,0,89,0,101,0,113,0,125,0,137,0,0,1,34,14,2,21,20,30,2,51,7,34,36,38,2,
+53,52,18,54,36,51,5,34,14,2,21,20,30,2,51,7,34,36,38,2,53,52,18,54,36,51,
+5,34,14,2,21,20,30,2,51,7,34,36,38,2,53,52,18,54,36,51,37,20,6,35,34,38,53,
+52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,
+51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,1,20,6,35,34,38,53,52,54,51,50,
+22,17,20,6,35,34,38,53,52,54,51,50,22,3,121,125,202,144,78,70,138,206,135,
+10,174,254,251,176,88,99,183,1,2,159,2,112,125,202,144,78,70,139,205,135,
+10,174,254,251,175,88,99,182,1,2,159,2,113,125,202,144,78,70,138,206,135,
+11,173,254,250,175,88,99,182,1,2,159,250,207,56,46,50,53,58,45,45,57,56,46,
+50,53,58,45,45,57,2,103,56,47,49,53,57,45,45,58,56,47,49,53,57,45,45,58,2,
+102,56,46,50,53,58,45,45,57,56,46,50,53,58,45,45,57,5,70,90,164,229,138,141,
+226,158,85,139,104,194,1,21,174,170,1,24,200,110,139,90,164,229,138,141,226,
+158,85,139,104,194,1,21,174,170,1,24,200,110,139,90,164,229,138,141,226,158,
+85,139,104,194,1,21,174,170,1,24,200,110,178,49,53,53,49,48,54,54,248,126,
+49,53,53,49,48,55,55,7,34,49,53,53,49,48,54,54,248,126,49,53,53,49,48,55,
+55,7,34,49,53,53,49,48,54,54,248,126,49,53,53,49,48,55,55,0,0,2,0,68,255,
+240,6,223,5,182,0,10,0,67,0,0,1,20,30,2,51,50,54,53,53,33,3,35,6,6,35,34,
+46,2,39,35,14,3,35,34,46,2,53,51,20,30,2,51,50,62,2,53,51,30,3,51,50,62,2,
+55,51,17,33,17,20,14,2,35,34,46,2,53,4,88,31,62,92,61,121,120,254,25,160,
+8,25,92,51,24,53,51,45,17,8,23,49,54,59,31,70,109,75,40,159,22,39,52,29,29,
+51,37,22,158,1,26,41,52,27,29,49,37,22,2,160,2,135,49,100,151,101,108,154,
+98,46,1,154,55,103,80,49,147,140,252,2,22,57,49,17,42,71,54,52,71,43,18,39,
+87,142,104,69,91,55,22,28,58,89,62,61,89,59,28,26,56,90,65,253,107,254,121,
+102,158,109,57,71,119,153,83,0,3,0,45,0,0,5,154,5,182,0,13,0,27,0,31,0,0,
+37,62,3,55,19,33,17,20,14,2,7,35,46,3,53,17,33,19,30,3,23,1,33,1,35,3,41,
+7,24,38,56,39,235,254,131,5,8,9,4,107,3,9,8,6,254,129,235,41,56,38,23,8,253,
+127,5,109,253,176,199,186,43,119,145,169,94,2,45,253,213,102,181,149,109,
+29,31,109,148,180,102,2,43,253,213,95,170,146,118,43,4,252,250,74,0,3,0,68,
+0,0,6,66,5,182,0,30,0,43,0,55,0,0,1,33,21,20,14,2,35,34,46,2,39,35,14,3,35,
+34,46,2,39,35,17,33,21,33,53,33,1,50,62,2,53,53,33,21,20,30,2,33,50,62,2,
+53,33,21,20,30,2,1,123,4,199,46,85,119,72,48,90,78,59,16,8,21,61,67,68,29,
+27,55,50,41,15,8,1,55,252,242,1,55,1,84,40,71,51,30,254,140,27,48,66,2,57,
+51,74,46,22,254,141,30,49,64,5,182,129,134,178,106,45,17,43,71,54,53,70,44,
+18,12,27,43,31,252,182,141,141,3,97,29,63,102,72,61,12,81,118,78,38,31,75,
+126,95,57,74,103,64,29,0,3,0,68,0,0,7,0,5,182,0,11,0,23,0,78,0,0,1,20,6,35,
+34,38,53,52,54,51,50,22,17,20,6,35,34,38,53,52,54,51,50,22,37,35,14,3,35,
+34,46,2,39,35,14,3,35,34,46,2,53,53,51,21,20,22,51,50,62,2,53,53,51,21,20,
+30,2,51,50,62,2,53,53,51,17,33,21,33,17,35,6,98,56,46,50,52,57,45,45,57,56,
+46,50,52,57,45,45,57,254,8,8,16,48,54,56,24,31,72,69,58,16,8,23,64,73,81,
+40,72,118,85,46,159,104,89,34,65,49,30,160,30,51,70,41,39,66,48,27,160,1,
+246,254,10,160,1,184,49,53,53,49,48,55,55,1,167,49,53,53,49,48,55,55,45,36,
+51,32,15,17,43,71,54,53,70,44,18,44,104,171,128,145,145,158,153,29,64,103,
+74,186,190,72,102,63,29,38,78,118,81,141,253,49,139,253,164,0,3,0,90,255,
+246,4,160,5,203,0,63,0,83,0,103,0,0,5,46,3,53,52,54,55,38,38,53,53,46,3,53,
+52,62,2,51,50,30,2,21,20,14,2,7,21,20,6,7,23,62,3,51,50,30,2,21,20,14,2,35,
+34,46,2,39,7,30,3,23,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,50,62,2,
+53,52,46,2,35,34,14,2,7,30,3,2,170,86,118,73,32,20,19,19,20,59,104,76,44,
+59,100,132,74,73,133,99,59,44,77,105,61,2,6,6,16,61,84,102,57,87,127,81,39,
+40,82,126,86,48,103,94,75,18,6,1,27,53,82,58,254,33,34,57,75,41,40,74,58,
+35,35,58,74,40,41,75,57,34,2,90,47,66,42,19,18,41,67,48,35,83,84,75,26,21,
+72,85,88,10,31,79,95,113,67,34,70,35,43,94,49,70,12,62,91,118,69,81,133,95,
+52,52,95,133,81,70,118,91,61,12,63,16,36,20,6,22,53,45,31,46,77,101,54,55,
+101,77,46,26,47,65,38,4,55,85,69,58,28,3,254,51,83,59,32,32,59,83,51,51,83,
+59,33,33,59,83,252,203,30,45,52,23,22,52,45,30,19,36,54,34,43,60,37,16,0,
+3,0,90,255,236,4,104,5,182,0,19,0,39,0,81,0,0,1,20,14,2,35,34,46,2,53,52,
+62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,14,3,35,34,46,
+2,53,51,20,30,2,51,50,62,2,53,51,20,22,51,50,62,2,53,51,20,14,2,35,34,46,
+2,39,4,33,72,121,162,90,95,162,119,68,73,123,161,87,87,161,123,74,160,49,
+79,103,54,54,103,79,48,45,77,103,59,56,103,79,47,254,215,22,49,54,59,31,70,
+109,76,40,160,21,37,52,31,31,51,37,20,158,77,62,31,52,38,21,159,40,75,109,
+70,32,58,54,50,22,1,166,102,164,114,62,62,114,164,102,100,166,119,65,65,119,
+166,100,70,114,82,45,45,82,114,70,70,112,79,42,42,79,112,3,154,52,71,43,18,
+39,87,142,104,69,91,55,22,28,58,89,62,123,114,22,55,91,69,104,142,87,39,18,
+43,71,52,0,0,1,0,227,0,0,1,131,5,182,0,3,0,0,33,35,17,51,1,131,160,160,5,
+182,0,4,0,135,255,236,5,31,5,203,0,52,0,72,0,84,0,96,0,0,37,34,14,2,7,39,
+17,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,17,23,54,54,51,50,30,2,51,50,62,
+2,55,23,14,3,35,34,46,2,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,19,20,
+6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,2,211,24,55,
+54,47,15,94,61,105,77,44,59,100,132,74,74,132,100,59,44,77,103,59,6,22,75,
+34,45,73,66,67,40,24,55,54,47,15,94,19,61,78,91,48,55,79,65,58,254,60,34,
+57,75,41,40,74,58,35,35,58,74,40,41,75,57,34,35,56,46,50,53,58,45,45,57,2,
+43,56,46,50,53,58,45,45,57,119,21,38,50,30,55,2,223,12,61,91,118,70,81,133,
+95,52,52,95,133,81,69,118,91,62,12,253,201,4,35,28,37,43,37,8,23,38,30,56,
+48,71,45,22,37,43,37,3,235,51,83,59,32,32,59,83,51,51,83,59,33,33,59,83,253,
+117,49,53,53,49,48,55,55,48,49,53,53,49,48,55,55,0,0,2,0,113,0,0,4,205,5,
+203,0,65,0,85,0,0,33,17,51,50,54,53,52,46,2,35,35,53,51,50,62,2,53,52,38,
+35,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,51,50,30,2,21,20,14,2,7,21,
+30,3,21,20,14,2,7,17,1,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,3,41,125,
+78,67,16,34,55,40,125,125,40,55,34,16,66,75,100,10,65,97,122,67,74,132,99,
+59,59,99,132,74,64,119,95,67,12,104,81,112,68,30,12,31,52,40,40,52,31,12,
+27,62,99,72,253,69,34,58,74,41,40,75,57,35,35,57,75,40,41,74,58,34,1,227,
+64,45,26,45,32,18,121,20,33,45,24,45,64,69,112,79,43,52,95,132,81,81,133,
+95,52,41,75,106,65,32,60,85,54,27,57,51,41,11,8,11,41,51,56,27,51,82,60,35,
+4,254,160,4,98,51,83,59,32,32,59,83,51,51,83,59,33,33,59,83,0,0,1,0,203,0,
+0,4,203,5,182,0,31,0,0,1,17,33,17,35,17,33,17,35,17,33,17,51,1,7,39,46,3,
+39,7,30,5,21,21,33,17,3,27,1,176,160,254,240,160,254,80,159,1,127,102,72,
+51,72,50,33,13,10,3,5,5,3,3,1,1,17,3,123,254,235,253,154,1,217,254,39,1,217,
+3,221,254,129,100,72,51,75,59,49,26,4,16,31,47,67,101,143,99,189,1,21,0,0,
+1,0,203,255,236,4,238,5,182,0,51,0,0,19,51,1,7,39,46,3,39,7,30,5,21,17,51,
+62,3,51,50,30,2,21,20,6,7,39,62,3,53,52,46,2,35,34,14,4,7,35,203,159,1,127,
+102,72,51,72,50,33,13,10,3,5,5,3,3,1,9,49,113,132,152,88,59,127,104,67,101,
+84,94,32,46,29,14,26,53,82,56,59,120,111,100,77,51,7,159,5,182,254,129,100,
+72,51,75,59,49,26,4,16,31,47,67,101,143,99,253,248,90,147,105,57,43,90,139,
+97,102,170,61,90,30,56,58,62,35,45,83,65,39,57,93,117,121,113,42,0,2,0,90,
+255,236,4,4,5,182,0,39,0,59,0,0,1,21,33,6,6,7,33,21,33,6,6,7,23,54,54,51,
+50,30,2,21,20,14,2,35,34,46,2,53,52,18,55,35,53,33,54,54,55,3,20,30,2,51,
+50,62,2,53,52,46,2,35,34,14,2,4,4,254,84,17,30,14,1,69,254,123,35,46,11,6,
+45,129,78,65,118,90,53,66,113,149,84,64,121,95,58,54,46,227,1,27,35,81,43,
+155,10,40,83,72,43,82,64,38,21,48,78,56,41,69,57,45,5,182,141,25,52,27,142,
+97,229,141,2,48,67,45,91,135,90,89,141,98,52,43,94,149,105,218,1,93,137,142,
+75,122,48,252,23,53,122,103,68,35,64,90,56,41,81,64,40,21,34,46,0,2,0,66,
+255,236,4,205,5,188,0,54,0,74,0,0,1,50,62,2,55,23,17,30,3,21,20,14,2,35,34,
+46,2,53,52,62,2,55,17,39,14,3,35,34,46,2,35,34,14,2,7,39,62,3,51,50,30,2,
+1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,2,141,24,58,55,46,12,94,60,105,
+77,45,59,100,132,74,74,132,99,59,43,76,103,60,6,11,30,36,37,17,45,73,66,67,
+40,24,55,53,47,15,94,19,61,77,91,48,55,79,65,58,1,196,34,57,75,41,40,74,58,
+35,35,58,74,40,41,75,57,34,5,72,18,31,41,24,55,253,49,12,61,91,118,70,81,
+132,95,52,52,95,132,81,69,117,91,62,13,2,64,4,18,24,15,7,37,43,37,8,22,38,
+30,55,48,71,45,22,36,44,36,252,12,51,83,59,32,32,59,83,51,51,83,59,32,32,
+59,83,0,4,0,158,255,236,4,23,5,205,0,19,0,31,0,43,0,87,0,0,1,52,46,2,35,34,
+14,2,21,20,30,2,51,50,62,2,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,
+38,53,52,54,51,50,22,19,20,14,2,35,34,46,2,53,52,62,2,55,53,46,3,53,51,20,
+30,2,51,50,62,2,53,51,20,14,2,7,21,30,3,3,119,49,80,102,54,54,103,80,48,45,
+77,104,59,56,103,79,47,254,69,56,46,50,52,57,45,45,57,2,7,56,47,49,53,57,
+45,45,58,84,72,121,162,90,95,162,119,68,39,68,93,54,48,91,71,44,159,45,77,
+104,59,56,103,79,47,160,44,71,91,48,54,92,69,39,1,166,70,114,82,45,45,82,
+114,70,70,112,79,42,42,79,112,4,6,49,53,53,49,48,55,55,48,49,53,53,49,48,
+55,55,252,16,102,164,114,62,62,114,164,102,65,127,104,72,11,8,6,60,97,129,
+75,70,113,79,42,42,79,113,70,75,129,97,60,6,8,11,72,104,127,0,3,0,90,255,
+246,4,160,5,203,0,63,0,83,0,103,0,0,37,62,3,55,39,14,3,35,34,46,2,53,52,62,
+2,51,50,30,2,23,55,38,38,53,53,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,21,
+20,6,7,22,22,21,20,14,2,7,1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,50,
+62,2,55,46,3,35,34,14,2,21,20,30,2,2,35,64,84,50,21,2,6,18,75,94,103,48,86,
+126,82,40,39,81,126,88,57,101,84,61,16,7,7,2,60,105,77,44,59,99,132,74,74,
+132,100,59,44,77,103,59,20,19,19,20,32,73,118,86,1,178,34,57,75,41,40,74,
+58,35,35,58,74,40,41,75,57,34,253,166,37,88,85,72,21,26,76,83,84,34,48,67,
+41,18,19,42,66,100,31,59,68,82,55,4,38,65,47,26,46,77,101,55,54,101,77,46,
+31,45,53,22,6,20,36,16,63,12,61,91,118,70,81,133,95,52,52,95,133,81,69,118,
+91,62,12,70,49,94,43,35,70,34,67,113,95,79,31,4,108,51,83,59,33,33,59,83,
+51,51,83,59,32,32,59,83,253,49,16,37,60,43,34,54,36,19,30,45,52,22,23,52,
+45,30,0,0,3,0,68,255,236,6,233,5,211,0,63,0,74,0,85,0,0,5,46,3,39,6,6,35,
+34,38,39,14,3,7,1,55,1,54,18,55,46,3,53,52,62,2,51,50,30,2,23,22,22,51,50,
+54,55,62,3,51,50,30,2,21,20,14,2,7,22,18,23,1,23,1,20,30,2,23,38,38,35,34,
+6,37,34,6,7,62,3,53,52,38,5,51,43,74,56,37,5,46,102,57,51,91,42,5,36,57,77,
+48,254,76,125,1,4,49,60,5,77,107,68,30,33,56,72,39,69,92,56,25,2,38,92,52,
+59,101,43,1,25,57,92,69,39,73,55,34,33,70,107,75,5,63,51,1,12,108,250,191,
+14,35,57,43,3,40,45,27,34,3,166,45,42,3,42,58,35,16,32,20,78,213,238,247,
+112,8,6,5,5,111,243,236,213,81,1,196,105,254,231,143,1,73,171,26,76,94,109,
+60,69,88,51,19,63,123,182,119,7,4,6,7,117,180,124,64,19,51,88,69,59,107,92,
+75,26,174,254,182,147,1,27,99,3,54,31,63,59,52,19,158,158,40,40,158,158,18,
+51,58,65,32,52,40,0,0,2,0,113,255,236,3,254,5,199,0,44,0,64,0,0,1,46,3,53,
+52,62,2,51,50,30,2,21,20,14,2,7,21,20,30,2,51,50,62,2,53,51,20,14,2,35,34,
+46,4,53,1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,221,80,134,96,54,73,
+123,161,87,87,160,123,74,57,98,133,76,19,31,43,24,31,49,32,17,139,40,72,98,
+58,35,67,62,53,38,22,1,109,49,80,102,54,54,103,80,48,45,77,104,59,56,103,
+79,47,2,80,12,70,112,150,92,100,167,118,66,66,118,167,100,91,149,111,72,13,
+219,79,101,57,21,21,54,91,71,98,141,90,43,9,29,53,89,128,89,2,139,70,114,
+82,45,45,82,114,70,70,112,79,42,42,79,112,0,0,0,0,0,0,15,0,186,0,3,0,1,4,
+9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,26,0,94,0,3,0,1,4,9,0,2,0,14,0,120,0,3,0,
+1,4,9,0,3,0,64,0,134,0,3,0,1,4,9,0,4,0,26,0,94,0,3,0,1,4,9,0,5,0,30,0,198,
+0,3,0,1,4,9,0,6,0,22,0,228,0,3,0,1,4,9,0,7,0,68,0,250,0,3,0,1,4,9,0,8,0,42,
+1,62,0,3,0,1,4,9,0,9,0,40,1,104,0,3,0,1,4,9,0,10,0,96,1,144,0,3,0,1,4,9,0,
+11,0,62,1,240,0,3,0,1,4,9,0,12,0,60,2,46,0,3,0,1,4,9,0,13,2,150,2,106,0,3,
+0,1,4,9,0,14,0,52,5,0,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,86,0,97,0,105,0,82,0,101,0,103,
+0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,
+111,0,32,0,83,0,97,0,110,0,115,0,32,0,86,0,97,0,105,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,78,0,111,0,
+116,0,111,0,83,0,97,0,110,0,115,0,86,0,97,0,105,0,78,0,111,0,116,0,111,0,
+32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,
+0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,14,0,
+7,255,255,0,15,};
+#endif
@@ -0,0 +1,5667 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSansYi_Regular_ttf_size = 135392;
+asm(".section .rodata");
+asm(".global fz_font_NotoSansYi_Regular_ttf");
+asm(".type fz_font_NotoSansYi_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSansYi_Regular_ttf, 135392");
+asm(".balign 64");
+asm("fz_font_NotoSansYi_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSansYi-Regular.ttf\"");
+#else
+const int fz_font_NotoSansYi_Regular_ttf_size = 135392;
+const char fz_font_NotoSansYi_Regular_ttf[] = {
+0,1,0,0,0,11,0,128,0,3,0,48,79,83,47,50,118,70,102,138,0,0,1,56,0,0,0,96,
+99,109,97,112,22,36,17,24,0,0,21,36,0,0,0,132,103,97,115,112,0,7,0,7,0,2,
+16,212,0,0,0,12,103,108,121,102,162,174,108,136,0,0,31,112,0,1,186,146,104,
+101,97,100,5,230,116,187,0,0,0,188,0,0,0,54,104,104,101,97,14,136,7,92,0,
+0,0,244,0,0,0,36,104,109,116,120,18,70,42,219,0,0,1,152,0,0,19,138,108,111,
+99,97,14,88,125,205,0,0,21,168,0,0,9,200,109,97,120,112,4,245,0,200,0,0,1,
+24,0,0,0,32,110,97,109,101,136,251,181,246,0,1,218,4,0,0,5,232,112,111,115,
+116,147,253,121,238,0,1,223,236,0,0,48,229,0,1,0,0,0,1,5,31,49,247,155,192,
+95,15,60,245,0,11,8,0,0,0,0,0,206,166,88,147,0,0,0,0,210,40,204,10,0,0,254,
+247,5,248,7,10,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,8,0,0,0,
+252,209,5,248,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,226,0,1,0,0,4,227,0,108,0,
+7,0,90,0,8,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,4,134,1,144,0,5,0,0,5,
+154,5,51,0,0,1,98,5,154,5,51,0,0,4,92,0,150,2,43,0,0,2,11,5,2,4,5,4,2,2,4,
+0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,71,79,79,71,0,64,0,0,255,101,8,141,253,168,
+0,0,8,141,2,88,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,5,42,0,166,0,0,0,0,3,
+132,0,0,1,244,0,0,4,240,0,100,4,240,0,120,4,240,0,120,5,33,0,100,4,235,0,
+100,4,140,0,120,4,140,0,120,5,10,0,140,4,52,0,80,4,88,0,80,4,88,0,80,4,127,
+0,80,4,190,0,180,4,190,0,180,4,149,0,80,4,168,0,120,5,123,0,80,5,123,0,80,
+5,123,0,80,4,182,0,80,4,160,0,80,5,24,0,140,5,2,0,140,4,66,0,172,4,66,0,180,
+4,66,0,180,5,102,0,140,4,173,0,140,4,173,0,140,5,5,0,140,4,28,0,154,5,24,
+0,140,5,24,0,140,4,216,0,120,4,169,0,100,4,169,0,100,3,152,0,120,4,207,0,
+80,4,40,0,140,4,40,0,140,4,36,0,100,4,230,0,120,4,230,0,120,3,152,0,110,4,
+148,0,120,4,50,0,80,4,50,0,80,3,246,0,140,4,217,0,180,4,217,0,180,4,97,0,
+120,4,80,0,120,4,80,0,120,4,208,0,100,5,163,0,120,5,163,0,120,4,219,0,120,
+4,249,0,120,4,249,0,120,4,148,0,80,5,85,0,140,5,85,0,140,4,230,0,120,4,190,
+0,180,4,232,0,180,4,232,0,180,4,251,0,180,4,149,0,140,4,149,0,140,4,183,0,
+130,4,246,0,80,5,28,0,120,5,28,0,120,4,129,0,130,4,3,0,180,4,163,0,130,4,
+163,0,130,4,199,0,120,4,251,0,140,4,251,0,140,4,219,0,120,5,36,0,180,5,36,
+0,180,4,228,0,100,4,239,0,120,4,239,0,120,4,230,0,120,4,168,0,80,4,168,0,
+80,4,189,0,132,5,4,0,130,4,146,0,80,4,146,0,80,4,234,0,110,5,9,0,110,6,104,
+0,80,6,104,0,80,5,24,0,140,4,151,0,130,4,151,0,130,4,219,0,120,4,223,0,120,
+4,6,0,110,4,6,0,110,4,230,0,120,4,156,0,130,4,156,0,130,4,221,0,130,4,238,
+0,80,4,186,0,80,4,186,0,80,4,110,0,140,4,155,0,130,4,155,0,130,4,118,0,80,
+4,62,0,120,4,62,0,120,4,20,0,80,4,175,0,140,4,139,0,120,4,139,0,120,4,108,
+0,180,4,183,0,80,4,183,0,80,4,56,0,80,5,78,0,140,4,92,0,100,4,92,0,100,5,
+95,0,180,4,211,0,80,5,24,0,140,5,24,0,140,5,24,0,140,4,124,0,140,4,219,0,
+120,4,219,0,120,4,130,0,140,5,173,0,140,5,173,0,140,4,176,0,140,4,232,0,180,
+4,232,0,180,4,143,0,80,4,132,0,160,4,132,0,160,4,20,0,80,4,123,0,100,4,123,
+0,100,4,189,0,140,5,28,0,140,4,244,0,120,4,12,0,120,4,211,0,80,4,195,0,140,
+4,195,0,140,4,156,0,120,4,178,0,80,4,178,0,80,4,69,0,120,4,219,0,120,4,172,
+0,120,4,172,0,120,4,114,0,100,4,101,0,110,4,85,0,100,4,85,0,100,4,189,0,140,
+5,28,0,120,5,28,0,120,4,40,0,120,4,40,0,120,4,70,0,120,4,230,0,120,4,230,
+0,120,4,189,0,140,4,84,0,80,4,84,0,80,4,36,0,80,4,189,0,140,4,189,0,140,4,
+92,0,80,5,17,0,180,4,200,0,100,4,200,0,100,5,24,0,140,4,120,0,180,4,142,0,
+80,4,142,0,80,5,123,0,80,4,219,0,120,4,123,0,100,4,123,0,100,4,169,0,100,
+4,204,0,100,4,204,0,100,4,157,0,120,5,59,0,80,5,59,0,80,4,168,0,120,4,55,
+0,80,4,55,0,80,4,66,0,180,5,28,0,120,5,28,0,120,4,56,0,80,4,110,0,80,4,114,
+0,120,4,114,0,120,4,50,0,120,5,67,0,80,4,124,0,110,4,124,0,110,4,124,0,110,
+4,58,0,100,4,58,0,100,4,73,0,100,3,219,0,100,4,249,0,100,4,249,0,100,4,222,
+0,120,4,96,0,100,4,96,0,100,4,122,0,120,4,222,0,60,4,222,0,60,4,222,0,100,
+4,222,0,100,4,82,0,80,4,82,0,80,4,96,0,120,4,79,0,80,4,6,0,110,4,6,0,110,
+4,30,0,120,4,189,0,140,4,189,0,140,4,189,0,140,4,31,0,80,4,136,0,120,4,117,
+0,80,4,117,0,80,5,20,0,120,4,86,0,120,4,86,0,120,4,158,0,80,4,36,0,120,4,
+36,0,120,4,82,0,80,4,114,0,80,4,114,0,80,4,123,0,100,5,28,0,120,5,28,0,120,
+4,123,0,100,4,254,0,120,4,254,0,120,5,100,0,130,4,110,0,10,4,110,0,10,4,240,
+0,120,4,146,0,80,4,146,0,80,4,136,0,120,5,3,0,180,4,44,0,60,4,44,0,60,4,229,
+0,80,4,74,0,120,4,74,0,120,4,139,0,140,4,134,0,140,4,134,0,140,4,20,0,80,
+3,252,0,80,3,252,0,80,4,75,0,90,3,236,0,100,4,17,0,100,4,17,0,100,4,108,0,
+120,4,7,0,80,4,7,0,80,4,20,0,80,3,241,0,100,3,241,0,100,4,16,0,80,4,147,0,
+80,4,147,0,80,4,141,0,80,3,252,0,100,4,76,0,100,4,76,0,100,3,252,0,100,4,
+120,0,80,3,219,0,80,3,219,0,80,4,195,0,80,4,20,0,80,4,69,0,120,4,69,0,120,
+4,77,0,130,4,128,0,80,4,128,0,80,4,75,0,90,4,184,0,140,4,189,0,140,4,189,
+0,140,4,178,0,80,4,236,0,80,4,236,0,80,4,76,0,120,4,43,0,80,4,43,0,80,4,76,
+0,120,4,76,0,120,4,76,0,120,4,75,0,90,4,128,0,120,4,76,0,120,4,76,0,120,4,
+76,0,120,4,120,0,130,4,120,0,130,4,104,0,80,4,40,0,88,4,14,0,120,4,14,0,120,
+4,61,0,80,4,36,0,196,4,36,0,196,4,219,0,101,4,153,0,80,5,28,0,120,5,28,0,
+120,4,179,0,120,4,232,0,180,4,232,0,180,4,76,0,120,3,228,0,95,3,228,0,120,
+4,110,0,145,4,150,0,80,4,150,0,80,4,130,0,80,4,122,0,95,4,122,0,95,5,42,0,
+80,4,109,0,120,4,123,0,100,4,123,0,100,4,123,0,100,4,219,0,120,4,219,0,120,
+4,198,0,80,4,20,0,80,4,64,0,80,4,64,0,80,4,168,0,120,4,108,0,120,4,108,0,
+120,3,243,0,40,3,223,0,80,3,223,0,80,4,123,0,100,4,83,0,80,4,222,0,100,4,
+222,0,100,4,132,0,100,4,4,0,80,4,177,0,80,4,177,0,80,4,70,0,80,5,83,0,120,
+5,83,0,120,4,155,0,80,4,45,0,100,4,45,0,100,4,75,0,80,4,75,0,80,4,145,0,80,
+4,166,0,80,4,189,0,80,4,232,0,100,4,232,0,100,4,219,0,120,4,193,0,80,4,193,
+0,80,4,102,0,80,4,120,0,80,4,120,0,80,4,100,0,120,4,77,0,80,4,77,0,80,4,149,
+0,180,4,131,0,140,4,142,0,80,4,142,0,80,4,132,0,80,4,50,0,80,4,50,0,80,4,
+40,0,80,4,96,0,100,4,156,0,80,4,156,0,80,4,156,0,80,4,86,0,80,4,86,0,80,4,
+123,0,100,4,123,0,100,4,123,0,100,4,80,0,100,4,123,0,100,4,123,0,100,4,168,
+0,100,4,249,0,140,4,223,0,120,4,223,0,120,4,148,0,100,4,112,0,120,4,112,0,
+120,4,146,0,120,4,73,0,80,4,73,0,80,4,146,0,120,4,40,0,140,4,40,0,140,4,40,
+0,140,4,134,0,140,4,1,0,80,4,1,0,80,4,86,0,100,4,96,0,60,4,96,0,60,4,192,
+0,80,4,204,0,80,4,204,0,80,4,164,0,80,4,155,0,80,4,155,0,80,4,76,0,120,3,
+180,0,80,3,180,0,80,4,189,0,140,3,236,0,80,3,231,0,80,3,231,0,80,3,230,0,
+80,5,1,0,180,4,26,0,141,4,26,0,180,4,121,0,80,4,64,0,120,4,64,0,80,4,64,0,
+80,4,205,0,80,4,202,0,120,4,140,0,120,4,140,0,120,4,110,0,145,4,3,0,81,4,
+3,0,101,5,24,0,140,4,189,0,140,5,24,0,140,5,24,0,140,4,122,0,80,4,23,0,80,
+4,23,0,80,4,204,0,80,4,124,0,110,4,124,0,110,4,76,0,120,3,253,0,130,3,253,
+0,130,4,196,0,100,4,169,0,100,4,169,0,100,4,40,0,80,4,40,0,80,4,202,0,120,
+4,202,0,120,4,40,0,80,4,127,0,120,4,95,0,80,4,95,0,80,4,189,0,140,5,0,0,80,
+5,36,0,80,5,36,0,80,4,189,0,140,5,60,0,140,4,117,0,150,4,117,0,150,4,56,0,
+80,4,65,0,100,4,20,0,80,4,20,0,80,3,243,0,100,5,2,0,80,4,232,0,180,4,232,
+0,180,4,189,0,140,4,120,0,70,4,120,0,70,4,144,0,180,4,110,0,110,4,110,0,110,
+3,248,0,80,4,76,0,120,4,76,0,120,4,132,0,160,4,166,0,140,4,64,0,80,4,64,0,
+80,4,65,0,100,4,86,0,110,4,86,0,110,4,160,0,80,4,56,0,80,4,6,0,80,4,6,0,80,
+4,94,0,100,4,238,0,120,3,162,0,97,3,162,0,140,5,28,0,120,4,204,0,80,4,151,
+0,130,4,151,0,130,4,78,0,120,4,14,0,80,4,14,0,80,4,188,0,140,4,75,0,80,4,
+75,0,80,4,198,0,80,4,198,0,80,4,136,0,120,4,145,0,120,4,106,0,120,4,106,0,
+120,4,51,0,120,4,97,0,100,5,2,0,100,5,2,0,100,4,168,0,120,4,60,0,100,3,189,
+0,103,3,189,0,120,3,169,0,100,4,86,0,80,4,190,0,180,4,190,0,180,5,99,0,100,
+4,210,0,80,4,60,0,80,4,60,0,80,4,60,0,80,4,108,0,120,4,108,0,120,4,200,0,
+120,4,200,0,120,4,80,0,60,4,223,0,180,4,223,0,180,4,80,0,120,4,108,0,120,
+4,108,0,120,4,83,0,80,4,83,0,80,4,174,0,80,4,174,0,80,4,156,0,80,4,33,0,100,
+4,33,0,100,4,96,0,140,5,8,0,80,3,208,0,80,3,208,0,80,4,149,0,100,4,232,0,
+180,4,232,0,180,4,120,0,142,4,132,0,160,4,132,0,160,4,100,0,100,4,14,0,80,
+4,118,0,80,4,118,0,80,4,221,0,140,4,178,0,100,4,67,0,100,4,67,0,100,4,127,
+0,100,4,216,0,120,4,143,0,140,4,143,0,140,4,216,0,120,3,252,0,100,4,50,0,
+80,4,50,0,80,4,132,0,160,4,108,0,120,4,108,0,120,4,111,0,120,4,120,0,120,
+4,120,0,120,4,50,0,80,4,223,0,180,4,76,0,120,4,76,0,120,4,180,0,120,4,188,
+0,120,4,45,0,80,4,45,0,80,3,210,0,100,4,130,0,140,4,130,0,140,5,42,0,120,
+4,37,0,100,4,37,0,100,4,228,0,140,4,51,0,80,4,51,0,80,4,51,0,80,4,213,0,100,
+4,237,0,120,4,237,0,120,4,237,0,120,4,88,0,80,4,109,0,80,4,109,0,80,4,163,
+0,120,4,54,0,120,4,189,0,140,4,189,0,140,4,137,0,80,4,182,0,80,4,182,0,80,
+4,230,0,100,4,245,0,80,4,116,0,140,4,116,0,140,4,116,0,140,4,103,0,110,4,
+103,0,110,4,163,0,100,4,35,0,100,4,35,0,100,3,231,0,80,4,98,0,80,4,98,0,80,
+4,156,0,120,4,143,0,80,4,240,0,120,4,240,0,120,4,124,0,140,4,142,0,120,4,
+142,0,120,4,112,0,110,4,94,0,120,4,94,0,120,4,94,0,120,4,240,0,120,4,130,
+0,80,4,130,0,80,4,214,0,80,4,159,0,80,4,200,0,100,4,200,0,100,4,128,0,130,
+4,146,0,100,4,146,0,100,4,52,0,180,4,108,0,140,3,211,0,80,3,211,0,80,4,95,
+0,100,5,52,0,120,5,52,0,120,4,35,0,80,4,84,0,80,4,84,0,80,3,213,0,120,4,101,
+0,120,4,101,0,120,4,37,0,180,3,223,0,80,3,223,0,80,3,248,0,80,4,194,0,80,
+4,108,0,140,4,108,0,140,4,110,0,130,4,189,0,140,4,189,0,140,4,189,0,140,5,
+103,0,100,4,20,0,80,4,20,0,80,4,142,0,120,5,20,0,80,5,10,0,80,5,10,0,80,4,
+137,0,80,4,189,0,140,4,189,0,140,5,24,0,140,4,196,0,100,5,16,0,80,5,16,0,
+80,4,134,0,110,4,181,0,140,4,181,0,140,3,234,0,80,4,170,0,80,4,170,0,80,4,
+20,0,80,4,26,0,80,4,26,0,80,4,146,0,120,4,219,0,120,4,219,0,120,4,66,0,180,
+4,36,0,40,4,108,0,80,4,108,0,80,4,116,0,140,4,181,0,100,4,158,0,80,4,158,
+0,80,4,181,0,80,4,168,0,120,4,168,0,120,4,83,0,80,4,170,0,140,4,170,0,140,
+4,153,0,80,4,108,0,80,4,108,0,80,4,100,0,80,4,19,0,155,4,19,0,180,4,213,0,
+100,4,31,0,80,4,31,0,80,4,76,0,120,4,203,0,120,4,203,0,120,4,136,0,100,4,
+86,0,80,4,86,0,80,4,59,0,100,5,41,0,180,5,41,0,180,5,41,0,180,4,86,0,80,4,
+86,0,80,4,86,0,80,4,64,0,80,4,198,0,100,4,198,0,100,4,128,0,120,4,128,0,120,
+3,173,0,113,3,173,0,140,4,198,0,100,4,198,0,100,4,152,0,100,4,232,0,180,4,
+232,0,180,4,136,0,100,3,208,0,123,3,208,0,180,4,189,0,140,4,232,0,180,4,232,
+0,180,4,202,0,80,4,199,0,120,4,199,0,120,4,51,0,120,5,16,0,80,5,16,0,80,4,
+222,0,104,4,41,0,80,4,12,0,80,4,12,0,80,4,105,0,120,3,209,0,118,3,209,0,180,
+3,209,0,180,4,94,0,130,4,27,0,100,4,27,0,100,4,94,0,130,4,146,0,100,4,146,
+0,100,4,46,0,100,4,200,0,100,4,28,0,80,4,28,0,80,4,130,0,80,4,107,0,80,4,
+107,0,80,4,149,0,100,4,149,0,100,4,149,0,100,4,85,0,120,4,149,0,100,4,149,
+0,100,3,253,0,100,4,2,0,148,4,2,0,180,4,48,0,100,4,122,0,120,4,122,0,120,
+4,76,0,120,5,24,0,140,4,108,0,120,4,108,0,120,4,108,0,120,4,91,0,120,4,189,
+0,140,4,189,0,140,5,62,0,180,4,20,0,80,4,20,0,80,4,189,0,140,4,86,0,80,4,
+100,0,120,4,100,0,120,5,7,0,120,5,50,0,180,4,103,0,120,4,103,0,120,4,118,
+0,100,4,230,0,120,4,230,0,120,4,171,0,120,4,156,0,130,4,156,0,130,4,17,0,
+100,4,85,0,80,4,85,0,80,4,65,0,120,5,85,0,80,5,17,0,180,5,17,0,180,4,146,
+0,120,4,40,0,80,4,40,0,80,4,40,0,80,4,232,0,180,5,73,0,80,5,32,0,100,5,32,
+0,100,4,218,0,80,4,158,0,80,4,158,0,80,4,106,0,120,4,123,0,100,4,123,0,100,
+4,36,0,120,4,120,0,140,4,120,0,140,4,70,0,80,4,197,0,100,4,197,0,100,4,123,
+0,100,4,156,0,180,4,78,0,80,4,78,0,80,4,192,0,80,4,132,0,80,4,6,0,120,4,6,
+0,120,4,52,0,80,4,140,0,80,4,140,0,80,4,140,0,80,4,76,0,120,5,163,0,140,5,
+163,0,140,4,170,0,140,4,151,0,80,4,151,0,80,4,119,0,80,4,148,0,140,4,148,
+0,140,4,70,0,80,4,119,0,178,4,119,0,178,4,129,0,80,4,129,0,80,4,65,0,80,4,
+65,0,80,4,179,0,80,4,110,0,145,4,110,0,145,4,169,0,100,4,46,0,80,4,16,0,96,
+4,16,0,120,4,123,0,130,4,64,0,180,4,169,0,100,4,169,0,100,5,17,0,80,4,62,
+0,80,4,62,0,80,4,136,0,120,4,62,0,120,4,62,0,120,4,29,0,100,4,108,0,80,4,
+108,0,80,4,189,0,140,4,173,0,80,4,173,0,80,4,37,0,60,4,169,0,100,4,169,0,
+100,4,169,0,100,4,16,0,80,4,140,0,80,4,140,0,80,4,219,0,120,4,122,0,140,4,
+130,0,100,4,130,0,100,4,222,0,100,4,148,0,110,4,148,0,110,4,71,0,120,4,135,
+0,20,4,135,0,20,4,76,0,100,4,199,0,80,4,199,0,80,4,64,0,80,4,139,0,120,4,
+139,0,120,4,252,0,80,4,6,0,110,4,6,0,110,4,0,0,85,4,166,0,80,4,198,0,100,
+4,198,0,100,4,226,0,130,4,204,0,120,4,46,0,120,4,46,0,120,4,46,0,120,4,38,
+0,85,4,159,0,80,4,159,0,80,4,108,0,130,4,86,0,130,4,86,0,130,4,76,0,120,3,
+212,0,127,3,212,0,140,4,222,0,100,4,7,0,120,4,7,0,120,4,189,0,120,5,54,0,
+140,5,54,0,140,4,96,0,140,4,172,0,180,4,172,0,180,4,10,0,180,4,154,0,80,4,
+130,0,140,4,153,0,140,4,223,0,80,4,119,0,100,4,119,0,100,4,234,0,100,4,6,
+0,110,4,76,0,120,4,76,0,120,4,70,0,80,4,6,0,110,4,6,0,110,5,156,0,100,4,66,
+0,130,4,66,0,130,4,158,0,40,4,16,0,80,4,16,0,80,4,124,0,110,4,76,0,120,4,
+76,0,120,4,135,0,80,4,101,0,80,4,220,0,80,4,220,0,80,4,112,0,120,4,83,0,80,
+4,198,0,100,4,198,0,100,4,199,0,140,5,24,0,140,5,24,0,140,5,24,0,140,4,198,
+0,100,4,189,0,140,3,240,0,120,3,240,0,120,4,124,0,140,4,232,0,180,4,232,0,
+180,4,157,0,100,4,146,0,140,4,146,0,140,3,252,0,180,4,132,0,100,4,132,0,100,
+4,201,0,100,4,143,0,100,4,143,0,100,4,189,0,140,6,50,0,100,4,220,0,80,4,220,
+0,80,5,14,0,80,4,65,0,120,4,120,0,180,4,120,0,180,4,120,0,180,4,56,0,140,
+5,102,0,140,5,102,0,140,4,189,0,140,4,135,0,140,4,189,0,140,4,189,0,140,4,
+36,0,120,4,189,0,140,4,189,0,140,4,98,0,80,4,222,0,100,4,222,0,100,4,222,
+0,100,4,111,0,120,4,111,0,120,4,123,0,100,4,26,0,80,4,26,0,80,4,121,0,100,
+4,149,0,100,4,131,0,80,4,131,0,80,4,239,0,100,4,95,0,100,4,95,0,100,5,60,
+0,80,4,177,0,80,4,123,0,100,4,123,0,100,4,95,0,100,4,168,0,120,5,71,0,130,
+5,71,0,130,4,148,0,120,4,125,0,100,4,125,0,100,4,76,0,120,4,244,0,100,4,244,
+0,100,4,83,0,120,4,61,0,100,4,149,0,100,4,149,0,100,4,205,0,180,5,24,0,140,
+4,246,0,124,4,246,0,124,4,108,0,80,5,24,0,140,5,24,0,140,4,206,0,180,5,70,
+0,180,5,70,0,180,4,130,0,120,4,8,0,140,4,8,0,140,3,255,0,140,4,158,0,80,4,
+158,0,80,4,84,0,100,4,34,0,120,4,34,0,120,4,20,0,80,4,119,0,80,4,119,0,80,
+4,146,0,100,3,223,0,80,3,223,0,80,3,209,0,180,4,172,0,80,4,212,0,80,4,212,
+0,80,4,0,0,80,4,108,0,100,4,108,0,100,4,182,0,80,4,118,0,80,4,156,0,120,4,
+156,0,120,4,140,0,130,4,189,0,140,4,64,0,180,4,64,0,180,4,86,0,120,5,24,0,
+140,4,233,0,80,4,233,0,80,4,84,0,120,5,24,0,140,5,24,0,135,5,24,0,135,5,98,
+0,80,4,123,0,100,4,123,0,100,5,24,0,140,4,166,0,80,4,166,0,80,4,196,0,80,
+4,84,0,120,4,76,0,120,4,76,0,120,4,76,0,120,4,75,0,90,4,75,0,90,4,240,0,120,
+4,165,0,120,4,165,0,120,4,20,0,80,4,240,0,63,4,84,0,40,4,84,0,40,4,148,0,
+120,4,124,0,80,4,65,0,80,4,65,0,80,4,87,0,120,4,120,0,80,4,124,0,140,4,124,
+0,140,4,149,0,100,4,69,0,120,4,240,0,120,4,240,0,120,4,64,0,100,4,85,0,120,
+4,85,0,120,4,83,0,80,4,67,0,140,4,67,0,140,4,100,0,100,4,114,0,120,4,114,
+0,120,2,28,0,200,3,67,0,80,3,67,0,180,3,1,0,180,4,20,0,80,4,73,0,180,4,73,
+0,140,3,213,0,120,4,1,0,80,4,120,0,142,4,94,0,130,2,183,0,140,4,169,0,100,
+4,124,0,140,3,220,0,180,3,156,0,120,3,252,0,100,5,28,0,120,5,28,0,120,3,234,
+0,80,4,232,0,180,4,79,0,180,4,138,0,100,4,140,0,130,4,189,0,140,4,0,0,140,
+4,148,0,130,4,79,0,120,4,219,0,120,4,172,0,120,4,240,0,120,4,7,0,120,3,24,
+0,140,3,24,0,120,2,209,0,140,5,24,0,140,6,132,0,140,4,244,0,100,5,226,0,140,
+4,131,0,80,3,197,0,100,4,17,0,100,4,86,0,130,3,231,0,80,4,23,0,80,4,142,0,
+120,3,248,0,80,4,182,0,160,4,64,0,80,4,104,0,120,4,226,0,130,3,250,0,80,3,
+232,0,80,4,109,0,80,3,92,0,150,0,0,0,78,8,0,0,100,8,0,0,100,4,176,2,18,4,
+176,0,130,5,110,1,174,5,110,0,100,4,176,2,88,4,176,0,110,4,226,1,244,4,226,
+0,100,4,176,1,244,4,176,0,100,4,176,2,88,4,176,0,130,4,226,1,244,4,226,0,
+100,4,176,2,38,4,176,0,150,4,176,1,244,4,176,0,140,8,0,3,29,4,0,0,100,2,88,
+0,0,2,88,0,110,4,0,0,100,1,29,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,120,0,0,
+0,26,0,16,0,3,0,10,0,0,0,13,0,32,0,160,48,2,48,17,48,27,48,251,164,140,164,
+198,254,255,255,101,255,255,0,0,0,0,0,13,0,32,0,160,48,1,48,8,48,20,48,251,
+160,0,164,144,254,255,255,97,255,255,0,1,255,245,255,227,255,99,212,200,212,
+195,212,193,211,226,96,4,96,1,1,2,5,125,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,20,0,20,0,20,0,67,0,78,0,147,0,215,1,45,
+1,57,1,118,1,214,1,242,1,254,2,32,2,80,2,92,2,128,2,224,3,55,3,67,3,141,3,
+209,3,220,4,26,4,89,4,159,4,170,4,214,5,6,5,89,5,101,5,164,6,0,6,60,6,72,
+6,138,6,179,6,191,7,3,7,27,7,115,7,126,7,191,7,233,7,245,8,61,8,110,8,165,
+8,177,8,202,9,3,9,15,9,76,9,128,9,139,9,184,9,240,9,252,10,68,10,127,10,139,
+10,202,10,245,11,1,11,73,11,153,11,176,11,188,11,244,12,28,12,40,12,101,12,
+170,13,21,13,33,13,83,13,142,13,168,13,180,13,255,14,51,14,63,14,147,14,188,
+14,200,14,244,15,51,15,63,15,118,15,212,15,224,16,10,16,124,16,211,16,223,
+17,36,17,98,17,166,17,178,17,243,18,51,18,62,18,107,18,193,18,237,18,248,
+19,46,19,133,19,145,19,190,19,237,20,81,20,93,20,132,20,173,20,184,20,235,
+21,26,21,37,21,66,21,103,21,153,21,164,21,249,22,37,22,49,22,95,22,131,22,
+221,22,232,23,38,23,81,23,127,23,139,23,222,24,42,24,97,24,109,24,193,25,
+0,25,12,25,122,25,228,25,240,26,53,26,131,26,143,26,194,26,231,26,242,27,
+56,27,148,27,160,27,227,28,4,28,77,28,89,28,143,28,189,28,201,28,254,29,37,
+29,111,29,123,29,195,30,33,30,73,30,84,30,129,30,206,30,218,31,14,31,25,31,
+74,31,129,31,141,31,242,32,83,32,94,32,133,32,179,32,191,33,11,33,49,33,95,
+33,107,33,171,33,247,34,43,34,55,34,104,34,194,34,242,34,254,35,66,35,117,
+35,129,35,186,36,1,36,13,36,42,36,142,36,153,36,189,37,5,37,17,37,63,37,99,
+37,193,37,204,37,238,38,17,38,110,38,122,38,178,38,239,38,250,39,58,39,126,
+39,164,39,176,39,228,40,31,40,42,40,87,40,123,40,135,40,191,40,237,41,28,
+41,39,41,80,41,133,41,179,41,190,42,0,42,51,42,116,42,128,42,193,42,239,43,
+42,43,54,43,111,43,181,43,192,44,3,44,63,44,74,44,157,44,205,44,216,45,17,
+45,92,45,104,45,156,45,225,45,237,46,48,46,125,46,136,46,188,47,15,47,27,
+47,88,47,135,47,192,47,203,47,246,48,41,48,52,48,85,48,136,48,147,48,183,
+48,218,48,229,49,37,49,86,49,155,49,166,49,246,50,55,50,66,50,101,50,143,
+50,154,50,197,50,228,50,239,51,46,51,106,51,163,51,174,51,232,52,30,52,125,
+52,136,52,172,52,219,52,255,53,10,53,55,53,192,53,203,54,0,54,49,54,124,54,
+136,54,182,54,246,55,2,55,57,55,97,55,108,55,146,55,194,55,205,55,254,56,
+53,56,123,56,134,56,193,56,255,57,10,57,63,57,109,57,165,57,176,57,244,58,
+57,58,68,58,139,58,194,58,243,58,255,59,46,59,110,59,122,59,165,59,214,59,
+225,60,2,60,73,60,85,60,166,60,223,60,234,61,46,61,121,61,179,61,190,62,6,
+62,64,62,75,62,148,62,218,63,1,63,12,63,63,63,129,63,140,63,204,64,5,64,16,
+64,56,64,118,64,173,64,185,64,252,65,45,65,89,65,101,65,141,65,191,65,203,
+66,34,66,144,66,155,66,197,66,208,67,42,67,120,67,201,68,7,68,19,68,66,68,
+124,68,136,68,211,69,11,69,22,69,74,69,122,69,133,69,175,69,245,70,72,70,
+83,70,155,70,217,70,228,71,8,71,46,71,81,71,93,71,172,71,226,71,237,72,39,
+72,107,72,118,72,213,73,54,73,66,73,149,73,212,74,18,74,30,74,86,74,154,74,
+165,75,0,75,82,75,93,75,160,75,236,75,247,76,57,76,113,76,159,76,170,76,255,
+77,78,77,89,77,160,77,215,77,227,78,19,78,66,78,78,78,125,78,173,78,184,78,
+209,79,18,79,57,79,68,79,135,79,185,79,227,79,238,80,11,80,85,80,146,80,157,
+80,233,81,72,81,149,81,160,81,228,82,63,82,74,82,121,82,191,83,1,83,13,83,
+89,83,147,83,158,83,199,84,0,84,12,84,58,84,91,84,102,84,165,84,220,84,231,
+85,33,85,84,85,145,85,157,85,229,86,37,86,131,86,142,86,194,87,20,87,75,87,
+87,87,160,87,232,88,94,88,105,88,147,88,181,88,215,88,226,88,255,89,30,89,
+112,89,124,89,172,89,246,90,1,90,59,90,108,90,119,90,192,90,242,90,253,91,
+35,91,81,91,133,91,144,91,189,91,230,91,241,92,41,92,123,92,159,92,170,92,
+232,93,27,93,104,93,115,93,143,93,196,93,246,94,1,94,42,94,77,94,88,94,129,
+94,214,94,225,95,29,95,41,95,150,95,181,95,212,95,223,96,42,96,88,96,131,
+96,143,96,236,97,55,97,96,97,107,97,130,97,158,97,211,97,223,98,5,98,76,98,
+141,98,152,98,209,99,3,99,14,99,89,99,101,99,168,99,235,99,247,100,27,100,
+70,100,81,100,182,101,1,101,86,101,98,101,170,101,245,102,0,102,86,102,176,
+103,26,103,37,103,102,103,168,103,180,103,232,104,11,104,23,104,72,104,127,
+104,166,104,177,104,226,105,43,105,122,105,133,105,177,105,234,106,57,106,
+69,106,112,106,201,107,30,107,41,107,71,107,105,107,116,107,210,107,246,108,
+1,108,72,108,123,108,180,108,191,108,229,109,34,109,106,109,117,109,181,109,
+225,109,237,110,54,110,124,110,135,110,169,111,14,111,70,111,81,111,141,111,
+198,111,210,112,43,112,117,112,184,112,195,113,10,113,110,113,170,113,182,
+114,2,114,62,114,74,114,125,114,212,115,25,115,36,115,69,115,104,115,115,
+115,203,116,23,116,34,116,120,116,168,116,179,116,246,117,31,117,85,117,97,
+117,196,117,249,118,5,118,59,118,98,118,172,118,183,119,16,119,99,119,110,
+119,175,120,0,120,36,120,48,120,93,120,197,120,209,121,2,121,46,121,129,121,
+140,121,179,121,246,122,2,122,67,122,127,122,138,122,196,123,26,123,38,123,
+111,123,144,123,155,123,184,123,192,123,236,123,247,124,64,124,122,124,185,
+124,197,125,1,125,81,125,92,125,155,125,213,126,22,126,34,126,113,126,191,
+126,203,127,41,127,143,127,244,128,0,128,55,128,96,128,108,128,173,128,203,
+128,215,128,253,129,20,129,31,129,83,129,123,129,135,129,192,129,240,130,
+53,130,64,130,118,130,159,130,219,130,231,131,30,131,80,131,92,131,162,131,
+222,131,234,132,57,132,130,132,141,132,215,133,20,133,31,133,69,133,133,133,
+144,133,189,133,236,133,248,134,46,134,84,134,95,134,136,134,200,134,212,
+135,46,135,115,135,152,135,163,135,210,136,37,136,49,136,132,136,144,136,
+199,136,210,136,250,137,6,137,73,137,169,137,181,137,234,138,66,138,77,138,
+126,138,209,138,221,139,24,139,72,139,84,139,169,139,200,139,212,140,31,140,
+112,140,174,140,185,140,229,141,40,141,51,141,83,141,124,141,202,141,213,
+142,9,142,96,142,107,142,161,142,209,143,42,143,53,143,88,143,146,143,157,
+143,207,143,254,144,10,144,59,144,101,144,113,144,148,144,192,144,203,144,
+239,145,28,145,39,145,99,145,144,145,245,146,0,146,87,146,172,146,209,146,
+221,147,24,147,84,147,95,147,136,147,206,147,248,148,3,148,51,148,137,148,
+209,148,220,149,24,149,100,149,112,149,182,150,30,150,42,150,99,150,150,150,
+161,150,212,151,17,151,84,151,96,151,138,151,195,151,247,152,2,152,47,152,
+118,152,186,152,198,153,26,153,138,153,150,153,216,154,27,154,38,154,106,
+154,155,154,166,154,214,155,12,155,24,155,103,155,187,155,243,155,254,156,
+49,156,102,156,152,156,163,156,207,156,246,157,48,157,60,157,112,157,170,
+157,182,158,17,158,99,158,110,158,161,158,219,158,231,159,33,159,94,159,105,
+159,166,159,177,159,220,159,231,160,56,160,131,160,142,160,222,161,35,161,
+81,161,92,161,131,161,186,161,222,161,234,162,89,162,225,162,236,163,43,163,
+84,163,95,163,124,163,186,163,197,164,1,164,69,164,81,164,174,164,204,164,
+216,165,26,165,109,165,153,165,164,165,200,166,2,166,87,166,98,166,175,166,
+243,166,255,167,62,167,108,167,120,167,156,167,186,167,198,168,11,168,19,
+168,30,168,67,168,121,168,132,168,186,168,237,169,59,169,71,169,163,169,171,
+169,232,169,243,170,39,170,105,170,185,170,197,170,243,171,82,171,93,171,
+190,171,231,171,242,172,32,172,77,172,88,172,141,172,197,172,209,173,39,173,
+122,173,134,173,195,173,235,174,44,174,55,174,148,174,240,174,252,175,66,
+175,142,175,208,175,219,176,12,176,72,176,83,176,135,176,200,176,211,177,
+14,177,77,177,88,177,173,177,225,177,236,178,14,178,56,178,112,178,124,178,
+172,179,15,179,134,179,146,179,213,180,31,180,98,180,110,180,183,181,11,181,
+79,181,90,181,153,181,231,181,243,182,41,182,90,182,102,182,143,182,195,182,
+206,182,252,183,71,183,83,183,128,183,180,183,238,183,250,184,37,184,92,184,
+154,184,165,184,199,184,244,185,23,185,35,185,141,185,203,186,5,186,17,186,
+68,186,128,186,140,186,196,186,237,186,249,187,33,187,101,187,112,187,170,
+187,234,187,245,188,39,188,102,188,163,188,175,189,10,189,65,189,76,189,164,
+189,248,190,57,190,68,190,111,190,179,190,248,191,4,191,82,191,170,191,181,
+191,250,192,45,192,57,192,125,192,177,192,234,192,246,193,44,193,103,193,
+179,193,191,194,27,194,118,194,130,194,205,195,6,195,18,195,96,195,187,195,
+198,195,249,196,51,196,63,196,118,196,210,196,221,197,10,197,47,197,59,197,
+100,197,166,197,177,197,226,197,251,198,92,198,104,198,174,198,236,198,247,
+199,57,199,129,199,184,199,196,199,253,200,5,200,67,200,78,200,114,200,165,
+200,236,200,248,201,35,201,116,201,217,201,229,202,60,202,120,202,132,202,
+205,203,54,203,66,203,135,203,185,203,236,203,247,204,23,204,68,204,79,204,
+130,204,192,204,204,205,10,205,56,205,156,205,167,205,210,206,47,206,120,
+206,131,206,203,207,9,207,70,207,81,207,132,207,187,207,236,207,248,208,74,
+208,111,208,122,208,173,208,238,208,249,209,35,209,98,209,109,209,213,209,
+225,209,242,210,3,210,21,210,44,210,65,210,86,210,110,210,134,210,155,210,
+218,210,238,211,33,211,79,211,106,211,140,211,173,211,205,211,236,211,254,
+212,37,212,83,212,144,212,209,212,255,213,46,213,90,213,111,213,152,213,204,
+213,246,214,29,214,73,214,117,214,184,214,233,215,52,215,91,215,157,215,217,
+216,28,216,93,216,190,216,250,217,25,217,76,217,115,217,150,217,187,217,227,
+218,76,218,111,218,130,218,152,218,172,218,195,218,216,218,255,219,18,219,
+37,219,69,219,100,219,116,219,131,219,157,219,182,219,204,219,226,219,248,
+220,13,220,49,220,85,220,113,220,142,220,167,220,192,220,215,220,254,221,
+14,221,29,221,50,221,73,0,2,0,166,0,0,4,132,5,118,0,3,0,7,0,0,51,17,33,17,
+37,33,17,33,166,3,222,252,182,2,182,253,74,5,118,250,138,148,4,78,0,2,0,100,
+255,230,4,60,5,182,0,16,0,29,0,0,1,20,6,35,34,38,53,53,35,53,51,17,51,17,
+33,17,51,1,35,21,20,22,51,50,54,53,17,33,17,51,4,60,203,190,189,202,200,200,
+140,1,248,140,254,78,210,129,124,124,127,254,8,210,1,116,191,207,207,191,
+188,120,3,14,254,195,1,61,252,122,189,135,142,143,134,2,142,254,167,0,255,
+255,0,120,255,230,4,60,7,10,2,38,0,6,0,0,0,6,4,200,79,0,0,3,0,120,255,230,
+4,60,5,182,0,23,0,37,0,42,0,0,1,20,6,35,32,39,6,35,53,50,55,39,17,38,39,53,
+22,23,17,51,17,33,17,51,1,20,6,7,22,51,50,54,53,17,33,21,22,22,7,52,39,17,
+54,4,60,203,190,254,219,76,110,92,103,78,1,58,122,108,72,140,1,248,140,254,
+167,144,138,49,187,124,127,254,8,146,153,130,169,169,1,116,191,207,240,18,
+119,13,22,1,153,6,6,119,3,10,2,73,254,195,1,61,252,105,96,151,47,155,143,
+134,2,142,175,39,155,113,136,52,254,143,63,0,0,3,0,100,0,0,4,209,5,212,0,
+24,0,35,0,43,0,0,55,50,55,38,53,52,55,38,35,53,50,23,54,51,51,17,5,7,39,17,
+35,34,39,6,35,1,34,7,22,21,20,7,22,51,51,17,1,20,23,54,53,52,39,6,100,97,
+73,110,118,84,94,163,135,152,213,58,1,156,41,231,174,247,152,129,159,2,130,
+115,97,152,158,95,123,79,253,247,106,136,133,109,150,20,116,188,189,122,23,
+120,53,83,2,22,225,121,122,251,12,81,51,3,40,38,122,204,194,123,37,2,206,
+254,148,153,93,86,160,163,90,98,0,3,0,100,255,230,4,135,5,208,0,28,0,46,0,
+54,0,0,19,22,23,18,51,50,19,54,55,51,6,7,22,21,16,2,35,34,38,39,35,53,51,
+38,53,52,55,38,39,1,35,18,51,50,18,17,52,39,6,35,34,39,6,21,20,23,51,19,34,
+3,22,51,50,55,2,231,23,45,100,231,231,99,43,25,131,45,109,26,205,196,153,
+195,35,119,105,5,26,109,45,1,222,194,44,200,132,131,9,110,144,141,111,8,4,
+206,50,177,56,98,131,142,96,56,5,148,109,93,1,6,254,250,83,119,232,138,136,
+189,254,138,254,127,252,234,120,63,98,186,132,136,233,252,56,254,146,1,54,
+1,73,116,99,68,68,77,130,85,76,3,20,254,235,91,90,1,22,0,255,255,0,120,255,
+230,4,20,7,10,2,38,0,10,0,0,0,7,4,200,0,138,0,0,0,2,0,120,255,230,4,20,5,
+212,0,25,0,37,0,0,19,52,54,54,55,17,5,7,37,21,30,2,21,20,6,6,7,17,37,55,5,
+53,46,2,55,20,22,51,50,54,53,52,38,35,34,6,126,94,174,118,2,20,46,254,166,
+120,173,93,94,174,118,253,236,46,1,90,121,174,91,140,160,157,154,161,162,
+153,156,161,2,242,89,154,99,11,1,129,200,114,134,205,12,99,155,87,90,154,
+99,10,254,85,200,114,134,247,10,98,154,91,114,121,120,115,117,119,121,0,0,
+3,0,140,255,230,4,126,5,208,0,35,0,54,0,63,0,0,19,16,18,51,50,22,23,54,55,
+53,51,17,35,53,6,7,22,21,17,20,7,22,23,53,51,17,35,53,38,39,6,6,35,34,2,17,
+23,20,22,51,50,54,55,38,38,53,52,54,55,38,38,35,34,6,21,5,20,22,23,55,17,
+39,6,6,140,177,195,138,160,37,76,87,140,140,70,68,12,13,66,73,140,140,86,
+78,38,161,135,193,179,140,105,127,90,99,22,132,142,141,133,22,99,90,127,105,
+1,43,87,75,3,3,74,88,3,169,1,32,1,7,124,122,25,9,186,254,66,139,6,23,86,103,
+254,110,115,84,24,6,140,254,66,186,8,26,120,126,1,13,1,36,20,234,187,89,90,
+74,238,153,144,232,75,90,89,189,232,209,105,169,57,108,1,176,109,56,161,0,
+0,1,0,80,0,0,3,188,5,182,0,11,0,0,33,17,1,55,1,17,5,17,51,17,37,17,1,222,
+254,114,86,1,56,1,92,130,254,174,2,73,1,131,93,254,203,2,45,218,1,111,253,
+181,217,251,188,0,255,255,0,80,255,230,3,253,7,10,2,38,0,14,0,0,0,7,4,200,
+0,206,0,0,0,1,0,80,255,230,3,164,5,208,0,15,0,0,19,5,17,1,55,5,17,1,53,51,
+17,35,17,39,17,1,141,1,45,254,155,77,1,24,1,94,140,140,210,254,10,1,91,149,
+1,200,1,29,101,227,2,163,254,232,254,250,74,4,26,168,251,36,1,5,0,1,0,80,
+255,230,4,27,5,218,0,25,0,0,19,5,17,1,55,5,17,5,54,55,23,6,6,21,20,22,23,
+7,38,38,53,52,55,39,17,1,141,1,45,254,155,77,1,24,1,98,61,107,84,72,90,89,
+76,88,93,124,10,174,254,10,1,91,149,1,200,1,29,101,227,2,163,181,128,63,99,
+46,178,93,85,170,46,104,57,224,124,56,47,92,250,233,1,5,255,255,0,180,0,0,
+4,10,7,10,2,38,0,17,0,0,0,7,4,200,0,162,0,0,0,3,0,180,0,0,4,10,5,182,0,11,
+0,15,0,19,0,0,33,35,17,33,17,35,17,51,17,33,17,51,1,35,17,51,17,35,17,51,
+4,10,140,253,194,140,140,2,62,140,254,150,130,130,130,130,2,188,253,68,5,
+182,253,126,2,130,254,20,1,81,251,147,1,81,0,3,0,80,255,230,4,69,5,208,0,
+42,0,54,0,66,0,0,19,52,54,51,50,22,21,16,7,7,21,20,18,22,51,50,54,54,17,52,
+39,38,17,52,54,51,50,22,21,20,6,7,22,21,16,2,35,34,2,17,52,55,38,55,20,22,
+51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,80,113,109,110,
+118,173,2,46,100,84,86,101,46,3,172,118,110,109,113,72,67,4,186,185,186,186,
+3,138,120,46,62,52,51,52,57,53,49,3,5,50,52,58,51,51,52,62,46,4,146,152,166,
+163,155,254,251,37,61,70,254,254,251,132,130,253,1,0,91,48,37,1,5,155,163,
+167,151,120,144,26,58,69,254,107,254,138,1,128,1,147,81,39,51,238,92,101,
+91,102,117,89,89,117,117,89,90,116,103,90,101,0,3,0,120,255,236,4,48,5,208,
+0,44,0,51,0,58,0,0,19,52,54,54,51,50,22,21,20,6,7,21,35,34,6,6,21,20,22,51,
+21,6,6,21,20,22,51,50,55,23,6,6,35,32,53,52,55,38,53,52,54,55,53,38,38,55,
+20,22,23,17,6,6,5,52,38,39,17,54,54,120,113,214,150,223,252,218,190,15,138,
+119,61,137,145,177,147,107,99,103,86,38,35,139,55,254,168,156,114,173,170,
+197,217,130,150,134,134,150,2,180,143,135,142,136,4,135,98,150,81,177,152,
+142,172,13,186,20,45,39,60,46,113,4,51,64,49,55,16,116,9,11,224,143,51,46,
+113,87,109,10,69,13,174,140,94,113,9,1,176,9,111,96,92,112,12,254,80,12,117,
+0,255,255,0,80,255,230,4,239,7,10,2,38,0,21,0,0,0,7,4,200,1,48,0,0,0,3,0,
+80,255,230,4,239,5,208,0,23,0,39,0,43,0,0,19,23,17,5,54,54,51,50,22,18,17,
+16,2,6,35,34,38,2,17,52,55,39,17,37,1,16,38,38,35,34,6,6,17,16,22,22,51,50,
+54,54,39,35,17,51,129,195,1,59,27,149,127,113,142,66,68,144,111,111,142,67,
+5,171,254,138,4,19,35,79,69,69,77,34,35,77,68,69,79,35,116,130,130,1,209,
+98,3,237,255,191,180,139,254,211,254,197,254,211,254,198,144,142,1,52,1,61,
+139,90,139,252,94,173,1,125,1,29,234,116,116,231,254,232,254,227,240,122,
+118,235,103,1,141,0,0,2,0,80,255,230,4,239,5,208,0,23,0,39,0,0,19,23,17,5,
+54,54,51,50,22,18,17,16,2,6,35,34,38,2,17,52,55,39,17,37,1,16,38,38,35,34,
+6,6,17,16,22,22,51,50,54,54,129,195,1,59,27,149,127,113,142,66,68,144,111,
+111,142,67,5,171,254,138,4,19,35,79,69,69,77,34,35,77,68,69,79,35,1,209,98,
+3,237,255,191,180,139,254,211,254,197,254,211,254,198,144,142,1,52,1,61,138,
+90,135,252,92,180,1,125,1,29,234,116,116,231,254,232,254,227,240,122,118,
+235,0,255,255,0,80,255,230,4,80,7,10,0,38,0,24,0,0,0,6,4,200,124,0,0,1,0,
+80,255,230,4,80,5,208,0,38,0,0,1,23,17,33,22,21,20,6,6,7,53,54,54,53,52,38,
+39,39,53,54,54,53,52,38,39,53,30,2,21,20,7,33,17,5,7,39,17,37,1,155,246,254,
+251,47,89,165,109,116,107,43,45,5,48,45,106,117,111,163,89,45,1,3,1,191,61,
+246,254,65,1,78,132,2,117,68,71,82,135,77,1,108,13,95,89,47,83,22,3,55,21,
+86,48,89,95,13,108,2,76,134,83,70,66,2,35,228,112,129,250,233,248,0,0,3,0,
+140,0,0,4,140,5,182,0,34,0,38,0,42,0,0,1,20,51,50,54,54,53,53,51,21,20,14,
+2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,17,51,3,35,17,51,1,
+35,17,51,2,210,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,67,35,140,
+26,63,62,151,140,242,130,130,1,218,130,130,4,91,241,61,144,172,211,231,164,
+165,96,52,122,122,52,96,165,164,231,211,174,142,61,241,1,91,250,74,2,78,253,
+178,2,78,0,0,2,0,140,255,230,4,178,5,208,0,20,0,41,0,0,19,16,18,51,50,18,
+17,21,55,23,1,1,7,39,21,16,2,35,34,2,17,23,20,22,51,50,54,53,53,7,39,1,1,
+55,23,53,52,38,35,34,6,21,140,177,195,195,177,235,83,254,203,1,53,85,233,
+179,193,193,179,140,105,127,127,105,236,85,1,52,254,204,83,238,105,127,127,
+105,3,169,1,32,1,7,254,250,254,223,6,238,79,254,199,254,201,79,236,88,254,
+221,254,242,1,13,1,36,20,234,187,189,232,111,239,79,1,55,1,57,79,241,19,234,
+187,189,232,0,255,255,0,172,0,0,3,242,7,10,2,38,0,28,0,0,0,6,4,200,94,0,0,
+1,0,180,0,0,3,242,5,182,0,23,0,0,37,38,0,39,35,17,35,17,51,17,51,54,0,55,
+23,6,6,7,33,21,33,22,18,23,3,187,219,254,251,11,144,140,140,147,23,1,1,207,
+44,167,204,19,1,90,254,162,12,219,175,58,79,1,80,221,253,74,5,182,253,120,
+206,1,53,75,114,63,250,163,120,186,254,234,62,0,0,1,0,180,0,0,3,202,5,182,
+0,27,0,0,37,38,36,39,35,17,35,17,5,17,51,17,37,17,51,54,36,55,21,6,6,7,33,
+21,33,22,22,51,3,182,221,254,206,28,75,140,2,55,140,253,201,75,26,1,41,232,
+196,202,24,1,186,254,70,27,222,173,166,2,176,143,254,25,5,122,226,1,30,254,
+44,221,253,160,143,165,5,119,9,99,86,120,94,108,0,2,0,140,255,230,5,22,5,
+208,0,33,0,49,0,0,37,38,2,39,35,2,2,6,35,34,38,2,17,16,18,54,51,50,22,18,
+23,51,54,18,55,23,6,6,7,51,21,35,18,5,1,16,38,38,35,34,6,6,17,16,18,22,51,
+50,54,54,4,215,156,186,12,82,3,73,146,111,113,148,69,67,145,120,116,141,70,
+3,85,15,176,161,63,124,138,13,148,150,19,1,2,253,129,38,84,71,71,82,37,37,
+83,70,71,84,38,121,86,1,43,188,254,236,254,211,143,150,1,67,1,38,1,30,1,49,
+156,142,254,233,253,171,1,30,94,108,77,214,152,120,254,200,153,1,248,1,8,
+248,123,121,247,254,253,254,249,255,0,128,124,247,255,255,0,140,255,230,4,
+93,7,10,2,38,0,32,0,0,0,7,4,200,0,134,0,0,0,3,0,140,255,230,4,93,5,208,0,
+18,0,26,0,34,0,0,19,16,18,51,50,22,23,55,23,3,22,21,17,16,2,35,34,2,17,1,
+50,54,53,17,1,22,22,3,1,38,38,35,34,6,21,140,177,195,137,161,37,178,92,241,
+8,179,193,193,179,1,116,127,105,254,54,15,106,127,1,200,15,105,104,127,105,
+3,169,1,32,1,7,123,121,218,77,254,217,70,83,254,110,254,221,254,242,1,13,
+1,36,254,71,189,232,1,156,253,206,147,124,1,197,2,48,139,122,189,232,0,0,
+2,0,140,255,230,4,131,5,208,0,42,0,58,0,0,37,54,54,53,52,38,35,35,2,2,6,35,
+34,38,2,17,16,18,54,51,50,22,18,19,51,50,54,53,52,39,55,22,22,21,20,6,7,22,
+22,21,20,6,7,1,16,38,38,35,34,6,6,17,16,18,22,51,50,54,54,3,120,66,60,117,
+85,10,3,73,145,111,113,148,69,67,145,120,111,143,73,3,10,89,114,124,91,85,
+88,85,71,70,86,94,94,254,208,38,84,71,71,82,37,37,83,70,71,84,38,183,51,122,
+95,101,136,254,239,254,212,141,150,1,67,1,38,1,30,1,49,156,132,254,224,254,
+242,138,98,176,93,86,69,170,120,85,155,48,45,161,85,112,174,72,2,128,1,8,
+248,123,121,247,254,253,254,249,255,0,128,124,247,0,0,3,0,154,255,230,3,130,
+5,182,0,13,0,25,0,37,0,0,19,52,54,54,51,50,22,21,20,6,35,34,38,38,1,35,17,
+33,17,35,17,51,17,33,17,51,1,20,22,51,50,54,53,52,38,35,34,6,170,85,158,114,
+168,187,189,166,113,159,85,2,216,140,254,48,140,140,1,208,140,253,170,118,
+109,108,117,118,107,106,121,1,82,108,175,101,216,168,167,197,91,167,1,252,
+1,54,254,202,2,210,254,220,1,36,251,156,126,127,127,126,136,138,143,0,255,
+255,0,140,255,230,4,140,7,10,2,38,0,36,0,0,0,7,4,200,0,208,0,0,0,2,0,140,
+255,230,4,140,5,182,0,34,0,46,0,0,1,20,51,50,54,54,53,53,51,21,20,14,2,35,
+34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,53,51,37,35,17,33,17,35,
+17,51,17,33,17,51,2,210,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,
+67,35,140,26,63,62,151,140,1,26,140,254,88,140,140,1,168,140,1,79,241,61,
+144,172,111,131,164,165,96,52,122,122,52,96,165,164,131,111,174,142,61,241,
+247,83,1,94,254,162,3,29,254,185,1,71,0,3,0,120,255,231,4,96,5,182,0,11,0,
+15,0,19,0,0,1,35,17,33,17,35,17,51,17,33,17,51,1,23,1,39,33,7,1,55,3,204,
+140,254,88,140,140,1,168,140,253,245,109,254,183,109,3,232,109,254,183,109,
+2,153,1,94,254,162,3,29,254,185,1,71,252,121,70,253,254,70,70,2,2,70,255,
+255,0,100,0,0,3,245,7,10,2,38,0,39,0,0,0,7,4,200,0,134,0,0,0,2,0,100,0,0,
+3,245,5,208,0,32,0,44,0,0,19,54,36,51,50,22,21,17,20,6,6,35,34,38,39,39,17,
+35,17,51,4,51,50,54,54,53,17,52,38,35,34,6,7,1,33,53,51,17,35,53,33,21,35,
+17,51,100,123,1,25,134,190,185,48,112,112,51,130,125,138,140,33,1,181,114,
+70,46,16,107,128,118,244,106,2,47,254,82,150,150,1,174,150,150,4,235,109,
+120,207,209,253,237,144,146,64,37,51,52,254,185,2,8,213,31,93,173,1,198,157,
+153,107,93,253,202,110,1,44,110,110,254,212,0,0,1,0,120,0,0,3,32,5,182,0,
+11,0,0,33,33,53,33,17,33,53,33,21,33,17,33,3,32,253,88,1,14,254,242,2,168,
+254,242,1,14,120,4,198,120,120,251,58,0,0,2,0,80,0,0,4,85,5,182,0,36,0,55,
+0,0,1,38,53,52,55,39,55,23,54,55,54,36,55,21,34,6,21,20,22,22,23,21,14,2,
+21,20,22,51,21,38,36,39,38,39,7,39,1,6,21,20,23,55,23,7,22,23,54,54,55,38,
+39,6,7,23,7,1,13,63,61,187,85,173,99,163,45,1,14,194,188,202,101,177,112,
+113,177,100,201,189,203,254,247,42,157,100,177,85,1,35,25,25,74,83,93,58,
+86,4,128,120,245,7,86,59,94,83,1,233,105,133,134,107,189,79,175,99,40,124,
+136,2,119,137,131,92,130,69,2,102,2,69,130,92,131,137,119,2,140,123,38,96,
+179,79,2,52,65,71,73,62,75,79,94,61,34,119,167,46,93,237,35,63,95,79,255,
+255,0,140,255,230,3,156,7,10,2,38,0,43,0,0,0,6,4,200,85,0,0,3,0,140,255,230,
+3,156,5,208,0,13,0,27,0,39,0,0,19,16,18,51,50,18,17,21,16,2,35,34,2,17,23,
+20,18,51,50,18,53,17,52,2,35,34,2,21,1,33,53,51,17,35,53,33,21,35,17,51,140,
+203,189,188,204,204,188,188,204,140,130,122,123,129,130,122,123,129,1,171,
+254,162,110,110,1,94,110,110,3,89,1,45,1,74,254,183,254,210,252,254,210,254,
+183,1,73,1,46,10,245,255,0,1,2,243,1,16,245,1,0,254,254,243,254,15,110,2,
+28,110,110,253,228,0,0,2,0,100,0,0,3,192,5,182,0,11,0,23,0,0,1,33,53,33,17,
+33,53,33,21,33,17,33,17,33,53,33,17,33,53,33,21,33,17,33,3,192,252,164,1,
+104,254,192,3,12,254,192,1,104,252,164,1,104,254,192,3,12,254,192,1,104,3,
+44,120,1,154,120,120,254,102,252,92,120,1,154,120,120,254,102,255,255,0,120,
+255,230,4,110,7,10,2,38,0,46,0,0,0,7,4,200,0,180,0,0,0,3,0,120,255,230,4,
+110,5,208,0,28,0,32,0,46,0,0,1,35,17,52,35,34,6,6,21,35,52,54,54,51,50,23,
+54,51,50,22,22,21,35,52,38,38,35,34,21,3,35,17,51,5,2,2,35,34,2,3,51,22,22,
+51,50,54,55,2,185,140,151,64,60,27,135,61,124,91,149,82,80,151,92,123,61,
+135,27,60,64,151,5,130,130,1,64,24,203,165,159,205,27,136,13,132,108,110,
+134,13,3,82,1,21,241,59,141,138,179,191,88,122,122,87,190,181,135,144,59,
+241,253,37,1,72,224,254,254,254,244,1,14,1,0,191,215,211,195,0,0,1,0,110,
+0,0,3,42,5,182,0,25,0,0,19,1,1,55,23,17,33,53,33,21,33,17,55,23,1,1,7,39,
+17,33,21,33,53,33,17,7,110,1,13,254,243,84,196,254,242,2,168,254,242,196,
+84,254,243,1,13,82,198,1,14,253,88,1,14,198,1,236,1,18,1,18,79,200,1,167,
+120,120,254,89,200,79,254,238,254,238,82,201,254,21,120,120,1,235,201,0,0,
+3,0,120,0,0,4,28,5,208,0,18,0,30,0,34,0,0,19,52,54,54,51,50,22,22,21,20,6,
+6,7,17,35,17,46,2,55,20,22,51,50,54,53,52,38,35,34,6,1,35,17,51,120,110,209,
+148,147,209,109,96,181,118,140,120,181,96,140,174,153,156,169,169,156,155,
+172,2,177,130,130,4,60,117,183,104,102,183,119,104,174,111,12,253,85,2,171,
+12,111,177,101,134,149,147,136,138,146,153,252,118,1,72,255,255,0,80,255,
+230,3,185,7,10,2,38,0,50,0,0,0,7,4,200,0,138,0,0,0,2,0,80,255,230,3,166,5,
+182,0,3,0,9,0,0,37,35,17,51,1,17,1,55,5,17,3,166,130,130,254,170,254,0,56,
+1,60,109,2,248,2,81,250,48,1,28,113,169,4,236,0,2,0,140,0,0,3,126,5,182,0,
+17,0,34,0,0,33,38,36,2,53,52,18,36,55,21,34,4,2,21,20,18,4,51,39,34,38,38,
+53,52,54,54,51,21,34,6,6,21,20,22,51,3,126,203,254,148,187,188,1,104,204,
+160,254,215,155,158,1,45,153,56,108,168,101,93,169,115,76,111,60,134,113,
+13,215,1,64,193,196,1,56,201,12,120,164,254,247,172,172,254,237,174,244,90,
+177,107,104,182,108,110,75,132,77,120,143,0,255,255,0,180,255,230,4,117,7,
+10,2,38,0,53,0,0,0,7,4,200,0,174,0,0,0,1,0,180,255,230,4,117,5,208,0,43,0,
+0,1,35,14,2,35,34,2,17,17,51,17,20,22,51,50,54,55,35,53,51,53,35,53,51,53,
+16,51,50,23,7,38,38,35,34,6,6,21,21,51,21,35,21,51,4,60,201,5,85,155,107,
+174,177,140,113,100,96,106,8,199,200,200,200,241,86,70,46,26,47,35,39,45,
+19,200,200,200,2,5,172,249,122,1,52,1,44,3,112,252,133,223,254,214,209,120,
+230,120,172,1,73,59,108,20,27,49,83,81,168,120,230,0,2,0,120,255,230,3,233,
+5,208,0,22,0,27,0,0,19,23,17,5,7,37,21,22,23,54,53,23,6,7,22,23,7,52,39,6,
+7,17,37,1,38,39,17,54,181,246,1,221,44,254,219,156,111,32,135,2,80,80,2,135,
+32,110,157,254,65,2,144,74,135,136,1,78,132,5,6,184,123,112,241,71,141,108,
+128,16,190,166,166,190,16,127,108,139,72,254,130,248,1,226,128,82,254,91,
+85,0,255,255,0,120,255,230,3,216,7,10,2,38,0,56,0,0,0,6,4,200,124,0,0,2,0,
+120,255,230,3,216,5,208,0,17,0,20,0,0,19,23,17,5,7,37,17,37,23,5,5,21,5,5,
+7,37,17,37,1,17,55,181,246,2,22,44,254,162,1,108,53,254,231,1,25,254,231,
+1,25,53,254,148,254,65,1,191,228,1,78,132,5,6,189,123,117,254,132,211,104,
+159,160,40,160,159,104,211,254,37,248,2,78,254,249,132,0,2,0,100,255,230,
+4,128,5,212,0,19,0,33,0,0,1,35,17,35,17,35,53,51,17,5,53,5,7,39,17,35,17,
+37,17,51,19,2,33,34,38,39,51,30,2,51,50,54,55,2,155,200,140,200,200,1,164,
+1,149,51,214,140,254,232,200,27,18,254,233,138,148,11,117,15,37,69,59,92,
+77,11,2,235,254,154,1,102,120,2,43,166,236,220,116,112,251,12,4,89,115,254,
+151,254,55,254,76,210,226,156,106,54,145,171,255,255,0,120,0,0,5,83,7,10,
+2,38,0,59,0,0,0,7,4,200,1,11,0,0,0,7,0,120,0,0,5,83,5,212,0,13,0,17,0,24,
+0,28,0,32,0,36,0,40,0,0,1,39,17,33,32,36,53,52,54,36,51,51,17,5,1,17,33,17,
+1,20,22,23,17,6,6,5,35,53,51,17,35,53,51,37,35,53,51,17,35,53,51,5,42,231,
+254,168,254,211,254,186,149,1,20,178,228,1,156,253,87,1,13,253,77,153,142,
+141,154,2,102,107,107,107,107,254,117,107,107,107,107,4,122,122,251,12,246,
+228,148,218,118,2,22,225,254,83,253,50,2,206,254,148,127,178,33,2,172,36,
+182,68,197,254,2,197,116,117,254,162,117,0,0,4,0,120,0,0,4,139,5,212,0,13,
+0,20,0,26,0,32,0,0,1,39,17,35,32,36,53,52,54,36,51,51,17,5,1,20,23,33,53,
+33,6,1,53,33,22,22,51,17,34,6,7,33,53,4,98,231,144,254,211,254,186,149,1,
+20,178,28,1,156,252,121,6,1,229,254,31,10,1,235,254,70,51,206,136,120,201,
+59,1,173,4,122,122,251,12,246,228,148,218,118,2,22,225,252,231,37,33,160,
+40,254,108,174,81,93,2,206,83,81,164,0,255,255,0,120,255,230,4,109,7,10,2,
+38,0,62,0,0,0,7,4,200,0,194,0,0,0,3,0,120,255,230,4,109,5,208,0,19,0,28,0,
+37,0,0,1,16,18,51,50,18,17,17,16,2,35,34,2,17,53,5,17,51,17,55,55,37,53,52,
+38,35,34,6,21,19,50,54,53,53,5,21,20,22,1,133,177,195,195,177,179,193,193,
+179,254,243,130,139,140,1,208,105,127,127,105,232,127,105,254,48,105,3,169,
+1,32,1,7,254,250,254,223,254,110,254,221,254,242,1,13,1,36,65,49,2,180,253,
+222,24,24,81,121,234,187,189,232,252,171,189,232,195,85,110,234,187,0,3,0,
+80,0,0,4,28,5,182,0,11,0,15,0,19,0,0,1,1,51,19,19,51,1,1,35,3,3,35,1,35,17,
+51,3,35,17,51,1,102,254,234,131,212,213,131,254,234,1,22,131,213,212,131,
+3,204,130,130,215,130,130,2,219,2,219,253,209,2,47,253,37,253,37,2,47,253,
+209,1,240,2,78,253,178,2,78,0,255,255,0,140,255,230,4,211,7,10,2,38,0,65,
+0,0,0,7,4,200,0,234,0,0,0,5,0,140,255,230,4,211,5,208,0,15,0,23,0,30,0,34,
+0,38,0,0,1,16,2,6,35,34,38,2,17,16,18,54,51,50,22,18,1,50,54,19,33,30,2,19,
+34,6,3,33,2,38,1,35,17,51,19,35,17,51,3,35,73,147,113,113,148,69,67,145,120,
+122,143,66,254,179,100,91,2,254,129,2,38,81,69,97,90,3,1,126,3,90,1,195,130,
+130,215,130,130,2,221,254,220,254,192,147,150,1,67,1,38,1,30,1,49,156,155,
+254,209,252,88,254,1,90,240,239,121,4,250,237,254,195,1,52,246,252,92,2,198,
+253,58,2,198,0,0,3,0,120,255,230,4,110,5,208,0,40,0,51,0,55,0,0,19,52,54,
+54,51,50,22,21,20,6,7,17,20,51,50,54,54,53,51,20,6,6,35,34,39,6,35,34,38,
+38,53,51,20,22,22,51,50,53,17,38,38,55,20,22,51,50,54,53,16,35,34,6,1,35,
+17,51,241,90,174,123,180,205,165,151,151,64,60,27,135,61,124,91,151,80,82,
+149,92,123,61,135,27,60,64,151,151,165,130,133,124,123,132,255,122,135,1,
+65,130,130,4,35,127,194,108,228,201,173,213,19,254,193,241,59,141,138,179,
+191,88,122,122,87,190,181,135,144,59,241,1,63,19,211,175,148,150,151,147,
+1,63,159,254,231,1,12,0,1,0,180,0,0,4,10,5,182,0,11,0,0,33,35,17,33,17,35,
+17,51,17,33,17,51,4,10,140,253,194,140,140,2,62,140,2,188,253,68,5,182,253,
+126,2,130,255,255,0,180,255,230,4,52,7,10,2,38,0,69,0,0,0,7,4,200,0,180,0,
+0,0,3,0,180,255,230,4,52,5,182,0,19,0,27,0,35,0,0,1,51,17,51,17,20,6,6,35,
+34,46,2,53,17,51,17,51,17,51,17,62,3,53,53,35,5,20,30,2,23,17,35,2,181,243,
+140,90,200,161,123,171,103,48,140,243,130,90,98,47,8,243,254,139,8,47,98,
+90,243,3,131,2,51,252,121,243,232,110,63,124,204,194,3,135,253,205,2,51,250,
+171,10,74,117,153,88,240,240,88,153,116,75,10,2,170,0,0,1,0,180,255,230,4,
+91,5,182,0,25,0,0,1,35,17,35,17,20,6,35,34,38,53,17,51,17,20,22,51,50,54,
+53,17,51,17,51,17,51,4,91,130,141,165,168,164,167,140,86,107,104,87,140,141,
+130,1,4,2,13,254,99,204,194,191,207,4,66,251,189,150,127,126,151,4,67,253,
+211,1,189,255,255,0,140,0,0,4,9,7,10,2,38,0,72,0,0,0,7,4,200,0,144,0,0,0,
+4,0,140,0,0,4,9,5,182,0,22,0,26,0,30,0,34,0,0,1,35,17,35,17,38,36,53,52,36,
+33,33,21,33,32,7,33,21,33,22,22,51,33,1,35,17,51,19,35,17,51,1,35,17,51,4,
+6,254,140,238,254,254,1,35,1,1,1,86,254,136,254,185,42,2,236,253,21,20,181,
+167,1,120,253,35,130,130,235,130,130,1,222,130,130,2,223,253,33,2,224,8,187,
+169,172,190,120,188,110,89,100,253,84,1,153,254,103,1,153,254,103,1,153,0,
+0,5,0,130,255,236,4,3,5,182,0,23,0,27,0,31,0,35,0,40,0,0,19,22,22,51,50,54,
+54,53,53,35,34,38,38,53,52,54,54,51,33,17,16,33,32,39,1,17,51,25,2,35,17,
+3,6,7,33,5,22,22,23,17,231,56,177,132,111,118,62,254,145,231,127,127,231,
+145,1,138,254,85,254,177,134,2,24,220,220,130,242,23,1,9,254,250,18,135,109,
+1,21,84,93,51,106,93,194,120,214,133,127,208,116,251,165,254,145,223,4,115,
+254,227,1,29,253,90,1,17,254,239,2,159,40,238,120,110,136,20,1,10,0,2,0,80,
+255,230,4,116,5,208,0,53,0,78,0,0,37,54,54,53,52,38,35,35,21,16,14,2,35,34,
+38,38,39,35,53,51,17,35,53,51,62,2,51,50,30,2,21,21,51,50,54,53,52,39,55,
+22,22,21,20,6,7,22,22,21,20,6,7,1,35,21,20,22,22,51,50,54,54,53,17,52,38,
+38,35,34,6,6,21,51,21,35,17,51,3,105,66,60,117,85,9,33,66,108,76,97,119,57,
+6,146,145,145,147,5,59,118,98,79,108,64,30,9,89,114,124,91,85,88,85,71,70,
+86,94,94,254,90,165,27,60,53,54,61,28,28,62,53,52,61,27,165,165,165,183,51,
+122,95,101,136,10,254,236,228,132,68,105,205,215,120,1,4,120,194,196,99,66,
+134,229,253,8,138,98,176,93,86,69,170,120,85,155,48,45,161,85,112,174,72,
+1,150,19,168,145,73,71,142,168,2,4,168,140,69,66,137,166,120,254,252,255,
+255,0,120,0,0,4,164,7,10,2,38,0,76,0,0,0,7,4,200,0,205,0,0,0,3,0,120,0,0,
+4,164,5,182,0,16,0,20,0,24,0,0,1,2,0,35,34,0,3,51,22,18,23,17,51,17,54,18,
+55,19,33,53,33,3,33,53,33,4,164,18,254,229,233,241,254,235,16,140,11,169,
+149,130,143,170,15,48,252,164,3,92,20,252,204,3,52,5,100,254,182,254,142,
+1,105,1,83,250,254,214,27,2,145,253,112,26,1,41,251,250,156,120,1,4,120,0,
+0,1,0,130,0,0,3,255,5,182,0,38,0,0,37,33,21,35,53,33,53,33,53,33,53,33,53,
+38,38,53,52,36,33,33,21,33,32,7,33,21,33,22,22,51,33,21,33,21,33,21,33,21,
+33,3,252,254,172,140,254,172,1,84,254,202,1,54,200,210,1,35,1,1,1,86,254,
+136,254,185,42,2,236,253,21,20,181,167,1,120,254,172,1,54,254,202,1,84,214,
+214,214,120,140,120,148,23,184,151,172,190,120,188,110,89,100,120,141,120,
+140,0,0,1,0,180,0,0,3,119,5,182,0,11,0,0,33,35,17,5,17,5,17,51,17,37,17,37,
+3,119,140,253,201,2,55,140,253,201,2,55,1,100,226,4,178,226,1,100,253,230,
+221,252,196,221,255,255,0,130,0,0,3,239,7,10,2,38,0,80,0,0,0,7,4,200,0,151,
+0,0,0,4,0,130,0,0,3,239,5,182,0,19,0,30,0,40,0,49,0,0,33,35,34,38,38,53,52,
+55,38,38,53,52,55,38,53,52,54,36,51,51,1,34,6,6,21,20,22,22,51,51,17,3,34,
+6,6,21,20,22,51,51,17,3,34,6,21,20,22,51,51,17,3,239,254,251,253,119,166,
+77,89,163,163,125,1,8,254,234,254,224,182,176,91,87,166,196,148,148,199,164,
+86,183,228,186,180,238,179,184,233,180,58,125,99,158,67,32,107,87,155,67,
+70,155,98,126,58,252,15,34,73,64,62,69,31,1,77,3,121,31,69,62,89,81,1,76,
+254,70,80,87,89,81,1,81,0,3,0,120,255,226,4,119,5,212,0,14,0,21,0,25,0,0,
+1,36,36,53,52,36,37,53,5,7,37,17,1,55,5,1,20,22,51,17,6,6,1,35,53,51,2,182,
+254,236,254,214,1,55,1,7,1,193,44,254,247,253,169,44,1,159,254,78,219,215,
+213,221,1,55,130,130,1,116,9,221,198,196,235,7,254,216,115,130,250,215,1,
+3,115,173,2,117,151,158,2,116,2,166,254,249,238,0,255,255,0,140,255,230,4,
+111,7,10,2,38,0,83,0,0,0,7,4,200,0,184,0,0,0,3,0,140,255,230,4,111,5,208,
+0,36,0,54,0,58,0,0,1,35,17,35,17,35,17,35,21,16,14,2,35,34,46,2,17,53,52,
+62,2,51,50,30,2,21,51,17,51,17,51,17,51,5,52,38,38,35,34,6,6,21,17,20,22,
+22,51,50,54,54,53,39,35,17,51,4,111,130,85,130,87,33,66,108,76,78,105,65,
+32,30,65,108,79,79,108,64,30,87,130,85,130,253,196,28,62,53,52,61,27,27,60,
+53,54,61,28,76,130,130,1,50,1,132,254,124,1,132,16,254,236,228,132,68,67,
+131,234,1,6,145,253,225,132,65,67,131,226,250,1,156,254,100,1,156,235,168,
+140,69,67,136,164,253,247,168,145,73,71,142,168,75,1,141,0,2,0,120,0,0,4,
+139,5,212,0,13,0,22,0,0,1,39,17,35,32,36,53,52,54,36,51,51,17,5,1,34,6,21,
+20,22,51,51,17,4,98,231,144,254,217,254,180,153,1,20,174,28,1,156,254,51,
+209,233,229,213,49,4,122,122,251,12,234,210,136,206,112,2,82,225,254,23,176,
+158,156,168,2,146,255,255,0,180,0,0,4,112,7,10,2,38,0,86,0,0,0,7,4,200,0,
+212,0,0,0,4,0,180,0,0,4,112,5,182,0,9,0,12,0,15,0,19,0,0,1,1,51,17,35,1,1,
+35,17,51,1,1,17,33,17,1,5,35,53,51,2,146,1,108,114,114,254,148,254,148,114,
+114,1,181,1,9,253,92,1,8,1,95,94,94,3,93,2,89,250,74,2,89,253,167,5,182,253,
+36,254,65,3,128,252,128,1,192,98,197,0,3,0,100,255,230,4,128,5,212,0,19,0,
+33,0,37,0,0,1,35,17,35,17,35,53,51,17,5,53,5,7,39,17,35,17,37,17,51,19,2,
+33,34,38,39,51,30,2,51,50,54,55,37,35,17,51,2,155,205,130,205,205,1,159,1,
+149,51,214,140,254,227,205,27,18,254,233,138,148,11,117,15,37,69,59,92,77,
+11,2,41,130,130,2,235,254,154,1,102,120,2,43,165,235,220,116,112,251,12,4,
+94,110,254,151,254,55,254,76,210,226,156,106,54,145,171,80,1,104,0,255,255,
+0,120,0,0,4,139,7,10,2,38,0,89,0,0,0,7,4,200,0,182,0,0,0,4,0,120,0,0,4,139,
+5,212,0,13,0,22,0,26,0,30,0,0,1,39,17,35,32,36,53,52,54,36,51,51,17,5,1,34,
+6,21,20,22,51,51,17,37,35,17,51,1,35,17,51,4,98,231,144,254,217,254,180,153,
+1,20,174,28,1,156,254,51,209,233,229,213,49,254,211,130,130,2,168,130,130,
+4,122,122,251,12,234,210,136,206,112,2,82,225,254,23,176,158,156,168,2,146,
+232,1,104,252,144,1,104,0,0,4,0,120,255,230,4,110,5,208,0,39,0,48,0,54,0,
+61,0,0,19,52,18,51,50,18,17,20,2,7,21,20,51,50,54,54,53,51,20,6,6,35,34,39,
+6,35,34,38,38,53,51,20,22,22,51,50,53,53,38,2,55,20,23,33,54,53,52,39,33,
+1,34,6,7,33,38,3,50,54,55,33,22,22,190,233,204,203,234,192,175,151,64,60,
+27,135,61,124,91,151,80,82,149,92,123,61,135,27,60,64,151,175,192,140,6,2,
+70,6,4,253,181,1,36,99,142,32,2,37,64,212,93,143,35,253,230,32,135,3,176,
+254,1,34,254,221,255,0,233,254,223,25,59,241,59,141,138,179,191,88,122,122,
+87,190,181,135,144,59,241,59,26,1,33,235,61,49,48,56,47,42,1,85,115,116,231,
+252,165,101,114,104,111,0,255,255,0,80,0,0,4,88,7,10,2,38,0,92,0,0,0,7,4,
+200,0,150,0,0,0,1,0,80,0,0,4,88,5,182,0,17,0,0,19,1,17,51,17,1,23,1,1,7,1,
+17,35,17,1,39,1,1,160,1,109,140,1,111,80,254,84,1,172,82,254,147,140,254,
+149,82,1,172,254,84,4,235,254,173,2,30,253,224,1,85,89,254,114,254,114,87,
+1,83,253,142,2,112,254,175,87,1,142,1,142,0,0,4,0,132,255,230,4,72,5,208,
+0,35,0,53,0,62,0,70,0,0,1,16,7,22,23,7,38,39,6,35,34,39,6,7,39,54,55,38,17,
+16,55,38,39,55,22,23,54,51,50,23,54,55,23,6,7,22,1,52,18,55,38,35,34,7,22,
+18,21,16,7,22,51,50,55,38,3,16,39,6,21,16,23,54,54,37,52,39,6,21,20,23,54,
+4,49,101,53,71,63,68,64,113,181,175,112,55,70,63,65,50,107,112,50,70,63,67,
+63,113,169,175,113,64,74,63,75,54,106,254,111,61,77,78,127,116,78,80,65,152,
+76,125,132,78,143,246,84,62,57,48,41,1,251,55,76,79,52,2,221,254,188,198,
+55,47,108,41,62,130,124,51,46,108,43,50,200,1,83,1,79,195,50,46,108,45,59,
+117,123,62,48,108,48,57,196,254,189,155,1,2,109,103,95,110,254,249,157,254,
+170,208,99,111,205,1,77,1,1,151,155,255,254,252,162,84,206,124,249,154,146,
+247,253,152,160,0,0,3,0,130,0,0,4,130,5,208,0,46,0,58,0,62,0,0,1,52,54,51,
+50,22,22,21,20,6,7,21,20,51,50,54,54,53,53,51,21,20,14,2,35,34,39,6,35,34,
+46,2,53,53,51,21,20,22,22,51,50,53,53,38,38,55,20,22,51,50,54,53,52,38,35,
+34,6,1,17,35,17,1,24,203,156,101,168,96,164,128,151,61,64,26,140,35,66,104,
+76,151,80,82,149,74,105,67,35,140,26,63,62,151,129,163,130,128,101,107,128,
+130,105,104,125,1,56,140,4,157,129,178,81,143,83,112,169,20,65,241,61,144,
+172,7,27,164,165,96,52,122,122,52,96,165,164,27,7,174,142,61,241,65,20,166,
+117,87,111,113,85,87,108,111,252,155,254,114,1,142,255,255,0,80,255,226,4,
+26,7,10,2,38,0,96,0,0,0,7,4,200,0,140,0,0,0,2,0,80,255,226,4,26,5,194,0,21,
+0,40,0,0,5,36,17,53,55,39,17,37,55,23,17,23,54,54,55,23,6,2,21,20,18,23,19,
+35,22,22,23,7,38,39,35,53,51,54,54,55,23,6,6,7,51,3,145,254,121,2,100,254,
+168,64,150,251,34,179,155,73,166,158,153,171,33,97,7,66,55,89,161,14,77,79,
+10,80,83,89,65,53,8,95,10,251,1,235,40,40,85,252,97,244,100,103,3,192,213,
+158,255,103,108,104,254,202,220,220,254,213,115,2,72,91,140,63,86,161,219,
+120,102,176,83,86,76,126,73,0,0,1,0,110,255,246,4,124,5,194,0,33,0,0,19,33,
+38,2,39,55,22,18,23,51,54,18,55,23,6,2,7,33,21,33,22,18,23,7,36,3,35,2,5,
+39,54,18,55,33,171,1,3,15,156,149,73,182,189,16,118,16,186,185,73,151,154,
+15,1,3,254,249,4,152,168,73,254,130,9,110,9,254,130,73,167,153,4,254,249,
+3,61,177,1,9,95,108,121,254,194,206,202,1,64,123,108,96,254,249,178,120,210,
+254,222,111,108,245,1,218,254,38,245,108,112,1,32,211,0,3,0,110,255,246,4,
+155,5,194,0,25,0,31,0,37,0,0,55,54,18,53,52,2,39,55,22,23,33,54,55,23,6,2,
+21,20,18,23,7,38,39,33,6,7,1,38,39,35,6,7,1,54,55,33,22,23,110,154,130,134,
+150,73,188,84,1,122,86,187,73,151,133,131,153,73,187,86,254,135,85,188,2,
+96,31,4,223,6,29,1,2,4,31,254,219,31,4,98,103,1,29,246,245,1,39,94,108,129,
+186,187,128,108,95,254,217,244,248,254,228,102,108,119,190,188,121,1,173,
+112,138,138,112,1,114,136,114,114,136,0,255,255,0,80,255,240,5,180,7,10,2,
+38,0,100,0,0,0,7,4,200,1,93,0,0,0,4,0,80,255,240,5,180,5,193,0,10,0,21,0,
+24,0,27,0,0,5,1,1,39,1,1,55,1,1,51,17,1,19,23,17,7,3,3,39,19,3,55,1,19,17,
+1,17,3,5,135,254,173,254,181,113,1,117,254,139,113,1,75,1,83,45,251,165,175,
+142,151,166,166,99,204,204,90,3,208,174,253,6,152,16,2,103,253,153,66,2,166,
+2,167,66,253,152,2,104,250,47,3,94,1,81,50,252,223,50,1,71,254,185,55,1,136,
+1,148,50,254,57,254,190,2,133,253,154,2,81,254,211,0,0,3,0,140,0,0,4,140,
+5,182,0,34,0,38,0,42,0,0,1,20,51,50,54,54,53,53,51,21,20,14,2,35,34,39,6,
+35,34,46,2,53,53,51,21,20,22,22,51,50,53,17,51,1,33,53,33,19,33,53,33,2,210,
+151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,67,35,140,26,63,62,151,
+140,1,95,252,204,3,52,20,252,164,3,92,4,91,241,61,144,172,211,231,164,165,
+96,52,122,122,52,96,165,164,231,211,174,142,61,241,1,91,251,198,120,254,12,
+120,0,255,255,0,130,255,226,3,227,7,10,2,38,0,103,0,0,0,6,4,200,114,0,0,4,
+0,130,255,226,3,227,5,182,0,5,0,13,0,17,0,21,0,0,5,37,55,5,17,51,3,1,17,35,
+17,1,17,51,3,33,53,33,17,33,53,33,3,227,252,216,41,2,115,140,255,254,32,130,
+1,224,130,10,253,188,2,68,253,188,2,68,30,246,123,196,5,39,253,176,1,81,254,
+195,2,40,254,181,1,55,253,22,110,254,172,110,0,6,0,120,255,230,4,99,5,208,
+0,21,0,39,0,43,0,47,0,51,0,55,0,0,1,16,14,2,35,34,46,2,17,53,52,62,2,51,50,
+30,2,21,39,52,38,38,35,34,6,6,21,17,20,22,22,51,50,54,54,53,1,35,17,51,17,
+35,17,51,1,35,17,51,17,35,17,51,3,135,33,66,108,76,78,105,65,32,30,65,108,
+79,79,108,64,30,140,28,62,53,52,61,27,27,60,53,54,61,28,1,104,130,130,130,
+130,252,151,130,130,130,130,2,166,254,236,228,132,68,67,131,234,1,6,145,253,
+225,132,65,66,134,229,253,185,168,140,69,67,136,164,253,247,168,145,73,71,
+142,168,254,172,1,72,2,87,1,72,251,25,1,72,2,87,1,72,0,0,3,0,120,0,0,4,83,
+5,182,0,11,0,18,0,22,0,0,1,36,36,53,52,54,36,55,53,51,17,35,1,20,22,23,17,
+6,6,1,35,17,51,2,182,254,238,254,212,146,1,8,164,140,140,254,78,221,213,208,
+226,3,79,130,130,1,91,11,230,202,132,204,113,4,219,250,74,3,22,152,169,3,
+2,146,2,178,253,121,3,218,255,255,0,110,0,0,3,152,7,10,2,38,0,107,0,0,0,6,
+4,200,68,0,0,1,0,110,0,0,3,152,5,182,0,29,0,0,1,55,23,1,1,7,39,17,33,21,33,
+21,33,21,33,53,33,53,33,53,33,17,7,39,1,1,55,23,17,51,2,74,250,84,254,192,
+1,64,82,252,1,14,254,242,1,54,253,8,1,54,254,242,1,14,254,82,1,64,254,192,
+84,252,140,4,95,231,79,254,216,254,218,82,232,254,121,120,200,120,120,200,
+120,1,137,234,82,1,38,1,40,79,233,1,89,0,0,3,0,120,255,230,4,110,5,208,0,
+41,0,55,0,59,0,0,1,22,22,23,35,38,38,35,34,6,7,35,54,54,55,53,52,35,34,6,
+6,21,35,52,54,54,51,50,23,54,51,50,22,22,21,35,52,38,38,35,34,21,1,6,6,35,
+34,38,39,51,22,22,51,50,54,55,7,35,17,51,2,185,166,222,29,141,28,167,162,
+150,169,17,140,27,219,171,151,64,60,27,135,61,124,91,149,82,80,151,92,123,
+61,135,27,60,64,151,1,50,29,197,150,146,201,25,133,18,125,94,96,127,18,174,
+130,130,3,121,22,215,173,148,147,153,142,180,214,17,237,241,59,141,138,179,
+191,88,122,122,87,190,181,135,144,59,241,253,16,192,209,215,186,137,144,144,
+137,29,1,22,255,255,0,130,0,0,4,26,7,10,2,38,0,110,0,0,0,7,4,200,0,130,0,
+0,0,4,0,130,0,0,4,26,5,202,0,3,0,7,0,15,0,23,0,0,33,33,53,33,39,33,53,33,
+55,1,17,35,17,1,17,51,39,37,21,35,17,5,53,51,3,182,253,48,2,208,50,253,148,
+2,108,150,252,234,130,3,22,130,170,254,52,130,1,204,130,120,170,120,58,1,
+162,254,114,2,92,254,78,1,108,16,241,191,1,138,247,227,0,3,0,130,255,226,
+4,141,5,182,0,9,0,17,0,21,0,0,1,17,19,23,1,17,1,55,5,17,3,1,17,35,17,1,17,
+51,17,33,53,33,3,84,213,100,254,199,253,151,45,1,176,112,254,172,130,1,84,
+130,254,42,1,214,5,182,254,7,1,35,79,254,92,252,245,1,37,110,198,5,7,253,
+146,1,51,254,225,2,40,254,211,1,25,252,230,120,0,5,0,80,255,246,4,158,5,182,
+0,7,0,21,0,35,0,49,0,63,0,0,1,17,35,17,23,17,51,17,37,22,22,21,20,6,7,53,
+54,54,53,52,38,39,19,22,22,21,20,6,7,53,54,54,53,52,38,39,1,38,38,53,52,54,
+55,21,6,6,21,20,22,23,3,38,38,53,52,54,55,21,6,6,21,20,22,23,2,69,140,240,
+140,253,27,133,128,142,119,72,64,73,63,240,133,128,142,119,72,64,73,63,3,
+94,133,128,142,119,73,63,73,63,240,133,128,142,119,73,63,73,63,2,175,253,
+81,3,123,119,2,178,252,135,61,27,141,97,102,143,24,120,22,72,55,64,66,18,
+3,176,27,141,97,102,143,24,120,22,72,55,64,66,18,254,95,27,140,98,102,143,
+24,120,23,72,54,64,66,18,251,226,27,140,98,102,143,24,120,23,72,54,64,66,
+18,0,255,255,0,80,0,0,4,46,7,10,2,38,0,114,0,0,0,7,4,200,0,150,0,0,0,2,0,
+80,0,0,4,46,5,182,0,15,0,19,0,0,1,37,17,35,17,39,17,37,55,23,17,5,17,5,53,
+51,17,35,17,51,4,46,254,184,140,178,254,168,64,150,1,52,1,82,130,130,130,
+3,255,155,251,102,3,58,126,253,36,244,100,103,2,218,223,1,170,176,244,251,
+123,2,48,0,0,2,0,140,0,0,3,246,5,208,0,15,0,19,0,0,1,39,17,37,17,35,17,5,
+17,37,17,35,17,1,17,5,3,35,17,51,3,185,246,254,85,140,1,171,254,215,130,1,
+171,1,191,39,130,130,4,124,128,251,181,204,254,131,2,88,222,2,10,192,254,
+240,1,255,254,223,1,190,228,253,55,1,161,0,255,255,0,130,0,0,4,25,7,10,2,
+38,0,117,0,0,0,6,4,200,120,0,0,2,0,130,0,0,4,25,5,202,0,20,0,24,0,0,19,17,
+1,1,23,1,22,18,19,35,2,33,34,6,7,35,18,18,55,1,17,1,35,17,51,149,1,193,1,
+41,116,254,174,158,192,26,130,53,254,234,134,167,26,131,28,212,172,254,249,
+1,120,130,130,2,140,3,15,253,96,2,207,45,252,221,32,254,201,254,251,1,236,
+253,239,1,19,1,58,20,1,134,254,135,253,116,1,60,0,3,0,80,255,236,4,38,5,212,
+0,15,0,19,0,23,0,0,37,55,23,53,33,17,37,55,23,17,5,53,5,7,39,17,1,33,17,37,
+19,35,53,51,2,8,58,143,254,212,254,171,58,143,1,184,1,85,58,143,254,72,1,
+44,254,212,208,107,107,228,104,101,223,254,38,248,104,101,4,237,244,240,248,
+104,101,251,23,2,72,2,27,162,254,3,197,0,255,255,0,120,0,0,3,198,7,10,2,38,
+0,120,0,0,0,6,4,200,87,0,0,1,0,120,0,0,3,198,5,182,0,15,0,0,19,51,21,23,17,
+5,53,51,17,35,53,39,17,37,21,35,120,130,223,1,107,130,130,223,254,149,130,
+2,98,235,117,4,150,207,237,253,158,234,118,251,106,207,237,0,0,1,0,80,255,
+230,3,196,5,208,0,15,0,0,19,5,17,37,55,5,17,1,7,37,17,5,7,37,17,1,141,1,56,
+254,147,61,1,48,1,255,61,254,202,1,115,61,254,202,253,255,1,114,168,2,166,
+209,115,174,1,202,254,228,112,175,253,152,212,115,177,253,241,1,28,0,0,3,
+0,140,0,0,4,55,5,212,0,21,0,25,0,29,0,0,37,35,17,35,17,35,17,35,17,35,17,
+5,7,37,17,51,17,51,17,51,17,51,1,35,17,51,53,35,17,51,4,1,130,115,130,120,
+140,2,177,41,254,4,120,130,115,130,253,13,130,130,130,130,176,1,182,254,74,
+1,182,253,154,5,212,228,123,178,253,183,1,76,254,180,1,76,252,79,1,203,241,
+1,203,0,255,255,0,120,255,230,4,39,7,10,2,38,0,124,0,0,0,6,4,200,110,0,0,
+6,0,120,255,230,4,39,5,208,0,28,0,33,0,38,0,42,0,47,0,51,0,0,19,52,54,54,
+51,50,22,22,21,20,2,7,21,20,22,51,50,54,55,23,6,6,35,34,38,53,53,38,2,1,6,
+6,7,51,33,38,38,39,17,17,54,19,35,33,22,22,23,17,1,35,53,51,120,110,200,127,
+128,200,109,195,172,57,63,57,113,34,112,57,165,96,135,123,170,197,1,116,108,
+118,5,231,1,105,7,118,106,202,26,228,254,153,12,118,99,1,86,107,107,3,226,
+149,224,121,122,227,148,205,254,246,26,190,102,108,95,80,55,118,122,144,176,
+200,24,1,11,2,65,22,175,138,140,173,21,254,178,254,100,41,1,5,125,158,19,
+1,46,253,92,197,0,1,0,180,0,0,4,28,5,212,0,27,0,0,1,35,17,35,17,35,53,51,
+53,35,53,51,17,37,17,35,17,5,53,5,7,37,17,51,21,35,21,51,3,157,190,140,180,
+180,180,180,254,227,130,1,159,1,201,51,254,246,190,190,190,1,140,254,116,
+1,140,110,190,110,1,122,110,250,242,5,208,165,169,238,116,130,254,50,110,
+190,255,255,0,80,0,0,4,103,7,10,2,38,0,127,0,0,0,7,4,200,0,160,0,0,0,1,0,
+80,0,0,4,103,5,182,0,25,0,0,1,33,17,35,17,33,53,33,17,33,53,33,17,33,53,33,
+19,7,3,33,17,33,21,33,17,33,3,122,254,202,140,254,202,1,54,254,232,1,24,254,
+152,3,92,187,108,160,254,233,1,24,254,232,1,54,1,180,254,76,1,180,110,1,24,
+110,1,160,110,254,195,67,1,18,254,96,110,254,232,0,0,1,0,80,0,0,3,232,5,182,
+0,19,0,0,1,33,17,35,17,33,53,33,17,33,53,33,17,51,17,33,21,33,17,33,3,232,
+254,122,140,254,122,1,134,254,152,1,104,140,1,104,254,152,1,134,1,180,254,
+76,1,180,110,1,184,110,1,110,254,146,110,254,72,0,0,4,0,140,255,230,4,194,
+5,208,0,27,0,49,0,53,0,57,0,0,1,35,17,33,22,21,20,6,35,34,38,39,6,6,35,34,
+38,53,16,18,18,51,50,18,19,33,17,51,1,20,22,51,50,54,53,52,2,2,35,34,2,2,
+21,20,51,50,54,53,53,51,1,35,17,51,17,35,17,51,4,194,130,254,251,17,105,96,
+59,69,23,32,67,52,100,101,80,157,115,120,162,41,1,17,130,253,107,40,36,42,
+34,58,96,63,67,97,53,76,36,40,130,1,210,130,130,130,130,1,24,1,209,195,210,
+178,188,54,58,58,54,173,193,1,87,2,18,1,19,254,205,254,196,1,179,252,59,117,
+124,114,132,248,2,7,1,5,254,232,253,246,226,246,122,119,135,1,229,1,23,252,
+166,1,23,0,255,255,0,100,255,230,3,248,7,10,2,38,0,131,0,0,0,6,4,200,112,
+0,0,3,0,100,255,230,3,248,5,208,0,29,0,32,0,35,0,0,1,33,55,23,7,51,21,35,
+3,19,51,21,35,23,7,39,33,7,39,55,35,53,51,19,3,35,53,51,39,55,19,33,3,17,
+19,33,1,95,1,157,106,116,77,107,168,218,224,162,101,71,116,100,254,87,99,
+116,70,100,161,224,218,167,106,76,116,160,1,47,151,145,254,221,5,0,208,57,
+151,120,254,83,254,71,120,139,57,196,196,57,139,120,1,185,1,173,120,151,57,
+251,82,1,42,1,29,1,31,0,0,3,0,180,0,0,4,171,5,182,0,11,0,15,0,19,0,0,1,3,
+55,19,19,23,3,19,7,3,3,39,3,35,17,51,1,35,17,51,2,113,225,102,185,186,102,
+226,226,101,187,186,101,80,140,140,3,107,140,140,2,243,1,196,47,254,138,1,
+118,47,254,60,254,59,45,1,118,254,138,45,254,210,5,182,250,74,5,182,0,2,0,
+80,0,0,4,71,5,182,0,20,0,24,0,0,19,52,54,54,55,17,5,17,51,17,37,17,37,17,
+35,17,5,17,6,6,21,5,35,17,51,80,77,140,91,2,55,140,253,201,2,55,140,253,201,
+79,89,2,155,130,130,2,90,88,167,115,17,1,87,226,1,100,253,230,221,252,196,
+221,253,230,1,100,226,2,232,26,158,111,19,1,104,0,255,255,0,140,255,230,4,
+140,7,10,2,38,0,135,0,0,0,7,4,200,0,206,0,0,0,3,0,140,255,230,4,140,5,182,
+0,34,0,47,0,59,0,0,1,20,51,50,54,54,53,53,51,21,20,14,2,35,34,39,6,35,34,
+46,2,53,53,51,21,20,22,22,51,50,53,53,51,1,6,6,35,34,38,39,55,18,33,50,54,
+55,39,35,21,35,53,35,53,51,53,51,21,51,2,210,151,61,64,26,140,35,66,104,76,
+151,80,82,149,74,105,67,35,140,26,63,62,151,140,1,134,44,233,184,183,240,
+44,133,57,1,21,135,165,29,53,210,130,210,210,130,210,4,211,241,61,144,172,
+91,111,164,165,96,52,122,122,52,96,165,164,111,91,174,142,61,241,227,251,
+213,203,218,216,205,50,254,161,180,171,61,230,230,110,198,198,0,0,3,0,140,
+255,230,4,140,5,182,0,3,0,38,0,51,0,0,1,35,17,51,19,20,51,50,54,54,53,53,
+51,21,20,14,2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,17,51,1,
+6,6,35,34,38,39,55,18,33,50,54,55,2,205,130,130,5,151,61,64,26,140,35,66,
+104,76,151,80,82,149,74,105,67,35,140,26,63,62,151,140,1,134,44,233,184,183,
+240,44,133,57,1,21,135,165,29,1,20,1,192,1,195,241,61,144,172,151,171,164,
+165,96,52,122,122,52,96,165,164,171,151,174,142,61,241,1,31,251,213,203,218,
+216,205,50,254,161,180,171,0,2,0,140,255,230,4,4,5,182,0,25,0,30,0,0,1,33,
+17,54,54,55,23,2,33,34,2,17,16,18,51,50,22,23,53,51,17,35,38,39,17,33,5,16,
+23,17,6,3,212,254,182,85,128,60,105,161,254,227,211,231,229,213,93,143,42,
+130,130,64,146,1,74,253,68,230,230,2,134,253,221,14,98,105,63,254,233,1,100,
+1,75,1,73,1,82,54,51,239,254,80,148,24,254,66,95,254,20,66,4,72,58,0,255,
+255,0,120,255,230,4,79,7,10,2,38,0,139,0,0,0,7,4,200,0,170,0,0,0,5,0,120,
+255,230,4,79,5,208,0,19,0,35,0,42,0,46,0,50,0,0,1,16,2,6,35,34,38,3,38,38,
+53,52,54,55,54,54,51,50,22,18,3,16,38,38,35,34,6,6,17,16,22,22,51,50,54,54,
+1,55,6,21,20,23,39,3,35,17,51,17,35,17,51,4,79,68,144,111,144,152,17,157,
+190,190,158,19,154,141,114,142,65,140,35,79,69,69,77,34,35,77,68,69,79,35,
+254,9,2,212,212,2,68,130,130,130,130,2,221,254,211,254,198,144,236,1,16,2,
+143,121,121,142,4,249,224,141,254,208,254,202,1,29,234,116,116,231,254,232,
+254,227,240,122,118,235,1,121,80,4,150,152,6,74,253,212,1,11,2,241,1,11,0,
+4,0,140,0,0,3,246,5,182,0,17,0,24,0,31,0,35,0,0,1,21,22,18,21,20,2,7,21,35,
+53,38,2,53,52,18,55,53,1,52,38,39,17,54,54,37,20,22,23,17,6,6,1,35,53,51,
+2,130,174,198,197,175,130,174,198,199,173,1,106,120,112,114,118,253,174,119,
+113,115,117,2,23,107,107,5,182,158,23,254,227,235,239,254,226,23,213,213,
+23,1,31,241,235,1,25,23,159,253,64,184,215,24,252,179,25,215,188,185,221,
+23,3,78,26,213,254,237,217,0,255,255,0,140,255,230,5,33,7,10,2,38,0,142,0,
+0,0,7,4,200,1,23,0,0,0,5,0,140,255,230,5,33,5,208,0,39,0,53,0,67,0,71,0,75,
+0,0,1,35,21,16,6,6,35,34,38,38,17,53,16,54,54,51,50,22,22,17,21,51,53,16,
+54,54,51,50,22,22,17,21,16,6,6,35,34,38,38,17,23,20,22,51,50,54,53,17,52,
+38,35,34,6,21,33,52,38,35,34,6,21,17,20,22,51,50,54,53,1,35,17,51,17,35,17,
+51,3,52,187,46,107,95,94,104,47,46,105,96,95,106,45,187,46,106,94,96,105,
+46,46,105,94,96,106,46,140,51,57,54,51,49,56,57,51,254,45,51,57,56,49,50,
+55,57,51,1,31,107,107,107,107,2,182,66,254,211,236,117,117,231,1,50,225,1,
+43,225,111,111,226,254,217,42,42,1,44,222,110,111,225,254,213,225,254,209,
+233,118,118,237,1,43,153,208,173,173,213,2,9,201,166,170,207,208,169,167,
+200,253,247,210,176,173,208,2,172,1,24,250,146,1,24,0,0,6,0,140,255,230,4,
+56,5,208,0,29,0,46,0,51,0,55,0,59,0,64,0,0,37,38,39,6,35,34,38,2,17,16,18,
+54,51,50,22,23,54,55,23,6,7,22,23,33,21,33,6,7,22,23,5,50,54,55,38,17,16,
+55,38,35,34,6,6,17,16,22,22,19,54,55,35,22,1,35,53,51,17,35,53,51,37,38,39,
+6,7,4,5,183,116,74,196,111,142,67,68,140,114,99,134,39,127,168,33,197,106,
+21,2,1,42,254,215,2,24,105,200,253,166,65,73,18,231,232,38,119,69,77,34,35,
+77,242,6,3,127,11,1,252,130,130,130,130,254,120,3,6,94,21,82,56,63,227,142,
+1,52,1,61,1,49,1,45,141,108,120,68,50,111,58,60,128,207,120,238,144,60,59,
+99,95,86,177,1,33,1,15,173,183,116,231,254,232,254,227,240,122,1,56,81,207,
+175,1,138,183,253,75,183,228,172,69,96,145,255,255,0,180,255,230,4,52,7,10,
+2,38,0,145,0,0,0,7,4,200,0,176,0,0,0,5,0,180,255,230,4,52,5,182,0,23,0,31,
+0,35,0,39,0,43,0,0,37,62,3,53,17,51,17,20,6,6,35,34,46,2,53,17,51,17,51,17,
+51,1,20,30,2,23,17,35,1,35,17,51,17,35,17,51,17,35,17,51,2,168,95,104,48,
+9,140,90,200,161,123,171,103,48,140,230,130,254,152,8,44,93,85,230,2,34,116,
+116,116,116,116,116,96,7,74,117,155,90,3,155,252,121,243,232,110,63,124,204,
+194,3,135,253,155,2,101,252,101,87,150,115,76,12,2,118,1,55,1,4,253,138,1,
+4,253,138,1,4,0,3,0,80,0,0,4,63,5,212,0,9,0,33,0,47,0,0,1,39,17,37,17,35,
+17,5,17,5,1,38,38,53,52,55,38,38,53,52,54,55,23,6,21,20,22,23,21,6,6,21,20,
+23,37,54,54,53,52,38,39,55,22,22,21,20,6,7,4,12,209,254,85,140,1,171,1,144,
+254,18,122,123,140,66,74,131,114,26,141,65,73,74,64,141,253,229,51,53,54,
+50,67,77,90,92,76,4,145,104,251,184,204,254,131,2,88,222,4,90,207,253,109,
+36,126,80,127,56,26,94,64,76,132,34,117,37,88,56,58,12,115,12,59,55,88,37,
+77,45,123,59,60,127,43,98,54,179,95,91,185,47,255,255,0,160,0,0,3,228,7,10,
+2,38,0,148,0,0,0,7,4,200,0,131,0,0,0,5,0,160,0,0,3,228,5,182,0,11,0,14,0,
+17,0,20,0,23,0,0,1,17,1,17,1,17,35,17,1,17,1,17,3,21,55,5,53,35,37,51,39,
+5,51,53,2,136,1,92,254,164,140,254,164,1,92,226,189,1,147,189,254,109,187,
+187,1,148,188,5,182,254,0,1,200,250,245,1,199,253,198,2,58,254,57,5,11,254,
+56,2,0,253,12,236,236,236,236,110,235,235,235,0,0,3,0,80,255,230,3,196,5,
+208,0,3,0,7,0,15,0,0,1,35,17,51,1,35,17,51,3,5,17,1,7,37,17,1,3,119,130,130,
+253,168,130,130,146,1,56,1,255,61,254,202,253,255,2,23,1,194,254,62,1,194,
+253,153,168,5,6,254,228,112,175,250,243,1,28,0,255,255,0,100,0,0,4,23,7,10,
+2,38,0,151,0,0,0,6,4,200,127,0,0,1,0,100,0,0,4,23,5,182,0,43,0,0,19,22,22,
+23,17,51,17,54,54,55,23,6,6,7,21,33,21,33,21,22,22,23,7,38,38,39,17,35,17,
+6,6,7,39,54,54,55,53,33,53,33,53,38,38,39,224,32,147,101,140,104,146,30,123,
+44,209,150,1,104,254,152,149,210,44,123,30,144,106,140,99,148,33,124,44,213,
+147,254,152,1,104,148,212,44,5,171,159,206,26,1,146,254,111,26,204,160,38,
+203,248,25,105,110,106,23,249,203,38,157,204,29,254,19,1,237,25,203,162,39,
+201,248,25,106,110,105,25,251,199,0,0,5,0,140,255,230,4,49,5,208,0,11,0,21,
+0,33,0,45,0,57,0,0,19,16,18,51,50,18,17,16,2,35,34,2,23,22,51,50,55,39,6,
+35,34,39,39,20,23,55,38,53,52,54,55,17,6,2,5,20,7,23,54,53,16,2,39,17,22,
+22,7,52,38,35,34,6,21,20,22,51,50,54,140,242,224,223,244,244,223,224,242,
+195,81,192,189,82,162,45,63,65,48,216,15,108,31,90,80,130,132,2,49,32,109,
+15,136,125,79,90,115,63,54,56,66,66,50,54,69,2,221,1,102,1,141,254,114,254,
+163,254,149,254,108,1,144,44,236,234,250,24,25,154,132,101,170,58,79,95,142,
+22,1,38,34,254,191,198,76,61,171,111,131,1,9,1,66,32,254,218,23,144,92,71,
+85,86,70,61,82,80,255,255,0,140,255,240,4,144,7,10,0,38,0,154,20,0,0,7,4,
+200,0,207,0,0,0,3,0,120,255,240,4,124,5,182,0,31,0,35,0,39,0,0,1,22,22,51,
+50,54,53,17,38,2,3,51,18,22,23,17,51,17,54,54,19,51,2,2,7,17,20,6,35,34,38,
+39,1,35,53,51,5,35,53,51,1,21,21,93,53,67,53,213,215,16,140,11,147,151,130,
+147,147,14,141,16,216,212,128,140,93,150,35,2,239,120,120,254,82,120,120,
+1,1,70,83,102,98,1,173,21,1,57,1,67,254,251,254,21,2,96,253,160,22,254,1,
+4,254,204,254,187,24,254,73,168,142,119,101,3,132,251,251,251,0,3,0,120,0,
+0,3,148,5,182,0,7,0,11,0,15,0,0,1,37,17,35,17,5,53,51,17,35,17,51,1,35,17,
+51,3,148,254,184,140,1,82,130,130,130,253,102,130,130,3,255,155,251,102,5,
+114,176,244,251,123,2,48,253,208,2,48,0,0,4,0,80,255,230,4,91,5,208,0,20,
+0,28,0,34,0,40,0,0,19,5,17,1,7,37,17,22,22,21,20,7,39,54,54,53,52,38,39,17,
+1,1,22,21,7,35,55,52,39,3,22,23,7,38,39,39,38,39,55,22,23,136,1,11,2,0,56,
+254,196,167,187,39,114,10,13,123,101,254,49,3,232,35,1,131,2,22,56,90,52,
+107,39,72,47,78,105,19,121,103,1,93,147,5,6,254,228,113,169,254,101,14,208,
+170,109,75,45,20,83,36,114,160,9,253,2,1,6,1,164,111,127,31,62,97,78,1,44,
+80,109,50,93,62,35,49,19,110,17,65,255,255,0,140,255,230,4,75,7,10,2,38,0,
+158,0,0,0,7,4,200,0,142,0,0,0,2,0,140,255,230,4,75,5,182,0,20,0,32,0,0,1,
+52,54,55,1,17,35,17,1,17,51,17,22,22,21,20,6,35,34,38,38,55,20,22,51,50,54,
+53,52,38,35,34,6,1,131,155,132,254,118,140,2,83,140,102,122,189,166,113,159,
+85,130,118,109,108,117,118,107,106,121,1,82,151,205,22,1,140,253,28,4,14,
+253,179,2,129,253,7,35,194,134,167,197,91,167,106,126,127,127,126,136,138,
+143,0,0,1,0,120,0,0,4,76,5,212,0,24,0,0,33,17,35,6,2,7,39,36,19,33,53,33,
+38,38,39,55,22,18,23,51,17,5,7,39,17,2,145,121,12,187,154,63,1,3,17,254,253,
+1,2,14,138,123,63,161,175,16,122,1,187,59,244,2,182,189,254,212,84,108,154,
+1,55,120,152,214,77,108,94,254,226,171,2,166,251,112,131,251,20,0,255,255,
+0,80,0,0,4,98,7,10,2,38,0,161,0,0,0,7,4,200,0,132,0,0,0,2,0,80,0,0,4,98,5,
+182,0,11,0,29,0,0,1,17,1,23,1,17,37,17,35,17,5,17,7,21,20,6,6,35,34,38,39,
+55,22,22,51,50,54,54,53,53,2,238,1,34,82,254,140,254,85,140,1,171,107,41,
+91,78,80,113,20,120,9,49,29,33,36,17,5,182,254,23,1,9,97,254,177,253,139,
+204,254,131,2,88,222,4,60,52,245,155,133,69,98,81,47,38,68,43,85,118,236,
+0,0,2,0,120,0,0,3,245,5,208,0,13,0,17,0,0,1,37,17,5,7,37,17,37,17,35,17,5,
+17,1,1,35,17,51,3,184,254,204,1,113,61,254,204,254,128,140,1,128,1,253,253,
+5,130,130,4,68,176,254,204,211,115,176,253,185,174,254,111,2,88,172,4,36,
+254,228,254,185,1,161,0,4,0,120,0,0,4,139,5,212,0,13,0,24,0,36,0,47,0,0,1,
+39,17,35,32,36,53,52,54,36,51,51,17,5,1,34,6,6,21,20,22,22,51,51,17,3,20,
+6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,4,98,231,144,
+254,211,254,186,149,1,20,178,28,1,156,254,51,126,204,112,111,202,129,49,47,
+89,81,83,91,94,80,80,90,93,39,38,40,41,35,41,82,4,122,122,251,12,246,228,
+148,218,118,2,22,225,254,83,89,166,109,108,160,86,2,206,254,149,105,113,113,
+105,110,120,124,106,73,61,61,73,51,72,255,255,0,120,0,0,4,92,7,10,2,38,0,
+165,0,0,0,7,4,200,0,132,0,0,0,5,0,120,0,0,4,92,5,212,0,20,0,30,0,34,0,38,
+0,42,0,0,1,38,39,17,35,32,36,53,52,54,54,51,50,23,17,5,7,39,17,22,23,37,38,
+35,34,6,21,20,22,51,51,1,35,17,51,1,35,17,51,3,35,17,51,4,2,100,115,144,254,
+231,254,246,99,166,90,101,95,1,156,41,231,153,152,254,67,97,92,101,121,187,
+205,19,1,116,130,130,254,25,130,130,107,130,130,1,115,148,92,253,157,213,
+221,124,194,108,33,2,153,225,121,122,254,4,96,196,230,42,164,142,158,156,
+2,159,1,23,253,12,1,23,1,175,1,23,0,3,0,100,255,231,3,230,5,208,0,42,0,54,
+0,66,0,0,1,38,38,35,34,6,21,20,22,23,30,2,21,20,6,6,35,34,38,39,55,22,22,
+51,50,54,53,52,46,6,53,52,54,54,51,32,23,3,20,6,35,34,38,53,52,54,51,50,22,
+7,52,38,35,34,6,21,20,22,51,50,54,3,111,46,159,100,136,156,110,117,230,169,
+90,107,205,140,147,243,56,121,30,189,106,141,171,62,100,129,134,129,100,62,
+103,196,133,1,13,144,223,121,99,101,123,126,98,98,122,103,63,54,58,63,59,
+57,60,62,4,141,98,105,117,106,69,106,45,89,123,171,113,134,206,114,160,133,
+57,100,130,183,148,88,121,84,57,51,55,78,111,83,99,151,84,252,252,223,97,
+121,121,97,102,128,132,98,65,69,72,62,51,72,69,0,0,4,0,110,0,0,3,237,5,182,
+0,5,0,8,0,11,0,15,0,0,51,1,1,33,9,2,3,33,3,33,19,1,35,17,51,110,1,59,254,
+197,2,253,254,197,1,59,254,129,201,1,147,11,254,131,190,2,1,130,130,2,226,
+2,212,253,44,253,30,2,71,254,49,4,198,254,66,254,138,2,27,0,255,255,0,100,
+255,226,3,161,7,10,2,38,0,169,0,0,0,6,4,200,80,0,0,5,0,100,255,226,3,161,
+5,182,0,5,0,9,0,13,0,17,0,21,0,0,5,37,55,5,17,51,1,35,17,51,1,35,17,51,37,
+35,17,51,1,35,17,51,3,161,252,216,41,2,115,140,254,157,130,130,254,168,130,
+130,1,88,130,130,254,168,130,130,30,246,123,196,5,39,252,72,1,61,254,195,
+1,61,193,1,61,254,195,1,61,0,0,7,0,140,255,230,4,49,5,208,0,11,0,18,0,25,
+0,29,0,33,0,37,0,41,0,0,1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,39,17,54,
+18,1,16,18,23,17,6,2,1,35,53,51,37,35,53,51,17,35,53,51,37,35,53,51,4,49,
+243,223,223,244,245,222,224,242,140,134,128,127,135,253,115,133,128,125,136,
+2,49,107,107,254,149,107,107,107,107,1,107,107,107,2,221,254,152,254,113,
+1,148,1,107,1,94,1,141,254,115,254,154,1,17,1,64,34,251,22,33,1,67,1,27,254,
+229,254,187,32,4,235,32,254,189,253,186,214,246,214,253,94,214,246,214,0,
+255,255,0,120,0,0,4,164,7,10,2,38,0,172,0,0,0,7,4,200,0,204,0,0,0,4,0,120,
+0,0,4,164,5,182,0,3,0,17,0,21,0,25,0,0,1,35,17,51,37,2,0,35,34,0,3,51,18,
+18,51,50,18,19,1,35,17,51,1,35,17,51,2,207,130,130,1,213,18,254,229,233,241,
+254,235,16,140,14,205,175,173,203,17,253,208,130,130,1,218,130,130,4,0,1,
+150,32,254,182,254,142,1,105,1,83,254,229,254,215,1,46,1,22,250,74,2,78,253,
+178,2,78,255,255,0,120,255,226,3,176,7,10,2,38,0,174,0,0,0,6,4,200,77,0,0,
+3,0,120,255,226,3,176,5,182,0,18,0,22,0,26,0,0,1,54,54,53,52,38,39,17,37,
+55,5,17,51,17,22,22,21,20,7,1,35,17,51,1,35,17,51,3,23,10,13,123,101,254,
+63,44,1,9,140,167,187,39,253,113,130,130,2,158,130,130,1,62,20,83,36,114,
+160,9,252,254,216,115,130,5,11,253,155,14,208,170,109,75,1,188,1,211,254,
+225,1,161,0,7,0,120,0,0,3,146,5,182,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,0,
+1,17,37,17,35,17,5,17,7,35,53,51,17,35,53,51,17,35,53,51,1,35,53,51,17,35,
+53,51,17,35,53,51,3,146,253,181,140,2,75,214,120,120,120,120,120,120,254,
+192,120,120,120,120,120,120,5,182,250,211,224,254,151,2,38,222,4,110,207,
+197,254,5,197,254,5,197,1,167,197,254,5,197,254,5,197,0,255,255,0,120,255,
+230,4,110,7,10,2,38,0,177,0,0,0,7,4,200,0,182,0,0,0,7,0,120,255,230,4,110,
+5,208,0,40,0,45,0,50,0,54,0,58,0,62,0,66,0,0,19,52,54,54,51,50,22,21,20,6,
+7,17,20,51,50,54,54,53,51,20,6,6,35,34,39,6,35,34,38,38,53,51,20,22,22,51,
+50,53,17,38,38,5,54,54,55,35,33,22,22,23,53,37,38,39,21,39,6,7,51,1,35,53,
+51,5,35,53,51,241,90,174,123,180,205,165,151,151,64,60,27,135,61,124,91,151,
+80,82,149,92,123,61,135,27,60,64,151,151,165,1,195,81,98,10,189,254,193,9,
+100,80,1,61,25,162,130,163,24,187,1,87,120,120,254,76,120,120,4,35,127,194,
+108,228,201,173,213,19,254,193,241,59,141,138,179,191,88,122,122,87,190,181,
+135,144,59,241,1,63,19,211,117,15,121,107,107,121,15,243,120,209,33,242,241,
+35,206,252,242,247,247,247,0,4,0,140,255,230,4,49,5,208,0,11,0,23,0,58,0,
+62,0,0,1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,
+39,33,53,51,53,52,38,38,35,34,6,21,7,35,54,54,51,50,23,54,51,50,22,23,35,
+39,38,38,35,34,6,6,21,21,51,3,33,53,33,4,49,243,223,223,244,245,222,224,242,
+140,169,159,154,171,166,159,158,170,85,254,29,182,9,18,25,19,16,3,115,5,68,
+72,74,46,44,76,71,69,5,115,2,1,16,19,25,18,9,181,70,254,169,1,87,2,221,254,
+152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,1,70,254,184,254,
+213,254,192,254,185,1,73,148,120,151,73,78,32,35,36,46,131,106,92,92,106,
+131,46,37,34,33,78,72,151,254,162,120,255,255,0,80,255,226,3,240,7,10,2,38,
+0,180,0,0,0,6,4,200,122,0,0,1,0,80,255,226,3,240,5,182,0,17,0,0,1,17,51,17,
+37,17,37,23,1,21,1,7,37,17,37,55,5,17,3,39,130,254,104,1,165,58,254,33,1,
+223,58,254,91,254,63,44,1,9,4,134,1,48,254,3,225,253,240,234,99,254,245,6,
+254,246,99,233,254,102,216,115,130,4,189,0,0,1,0,80,255,226,3,162,5,182,0,
+25,0,0,1,33,17,37,55,5,17,33,53,33,53,33,53,33,17,5,17,51,17,37,17,33,21,
+33,21,33,3,162,254,174,254,0,35,1,81,254,192,1,64,254,192,1,64,1,92,130,254,
+174,1,82,254,174,1,82,1,248,253,234,218,120,147,1,87,110,150,110,1,213,148,
+1,11,254,55,147,254,234,110,150,255,255,0,140,255,230,4,49,7,10,2,38,0,183,
+0,0,0,7,4,200,0,161,0,0,0,6,0,140,255,230,4,49,5,208,0,11,0,17,0,23,0,29,
+0,35,0,39,0,0,19,16,18,51,50,18,17,16,2,35,34,2,19,16,23,19,3,6,1,16,39,3,
+19,54,1,22,51,50,55,3,17,19,38,35,34,7,1,35,53,51,140,242,224,223,244,244,
+223,224,242,140,71,195,183,83,2,141,83,183,196,70,254,3,75,109,111,72,184,
+165,69,95,97,70,1,179,107,107,2,221,1,102,1,141,254,114,254,163,254,149,254,
+108,1,144,1,103,254,230,163,1,215,1,186,164,254,216,1,36,166,254,72,254,39,
+166,254,233,79,78,1,186,1,35,1,144,63,62,253,100,234,0,0,3,0,80,255,226,3,
+248,5,182,0,9,0,13,0,17,0,0,1,17,51,17,37,17,37,55,5,17,1,35,17,51,1,35,17,
+51,3,118,130,254,104,253,240,44,1,88,1,199,130,130,253,128,130,130,4,124,
+1,58,254,3,225,251,72,246,115,160,4,189,252,25,1,194,254,152,1,194,0,3,0,
+180,0,0,4,193,5,208,0,15,0,19,0,23,0,0,1,37,17,35,17,35,17,35,17,35,17,35,
+17,1,53,5,1,51,17,39,1,51,17,39,4,142,254,246,140,155,140,155,130,2,68,1,
+201,252,117,155,155,1,39,155,155,4,64,130,251,62,2,124,253,132,2,124,253,
+132,5,208,254,241,225,238,254,54,1,224,68,253,220,1,70,76,255,255,0,100,255,
+230,4,100,7,10,2,38,0,187,0,0,0,7,4,200,0,165,0,0,0,3,0,100,255,230,4,100,
+5,208,0,21,0,30,0,39,0,0,1,35,21,16,2,35,34,2,17,53,35,53,51,53,16,18,51,
+50,18,17,21,51,1,50,18,53,53,33,21,20,18,3,33,53,52,2,35,34,2,21,4,100,120,
+204,188,188,204,120,120,203,189,188,204,120,254,0,123,129,254,8,130,130,1,
+248,130,122,123,129,2,162,69,254,210,254,183,1,73,1,46,69,120,63,1,45,1,74,
+254,183,254,210,63,253,68,1,2,243,79,79,245,255,0,2,188,73,245,1,0,254,254,
+243,0,2,0,140,0,0,4,140,5,182,0,34,0,54,0,0,1,20,51,50,54,54,53,53,51,21,
+20,14,2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,53,51,1,33,17,
+35,17,33,53,33,53,33,53,33,53,51,21,33,21,33,21,33,2,210,151,61,64,26,140,
+35,66,104,76,151,80,82,149,74,105,67,35,140,26,63,62,151,140,1,79,254,172,
+130,254,172,1,84,254,202,1,54,130,1,54,254,202,1,84,4,211,241,61,144,172,
+91,111,164,165,96,52,122,122,52,96,165,164,111,91,174,142,61,241,227,251,
+103,254,227,1,29,110,145,110,164,164,110,145,0,4,0,180,255,230,3,196,5,182,
+0,17,0,21,0,25,0,29,0,0,1,20,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,
+51,7,7,39,55,19,7,39,55,19,7,39,55,3,196,203,190,189,202,140,129,124,124,
+127,140,237,75,235,75,235,75,235,75,235,75,235,75,1,116,191,207,207,191,4,
+66,251,189,135,142,143,134,4,67,231,106,163,107,253,234,106,163,107,253,234,
+106,163,107,255,255,0,80,255,230,4,60,7,10,2,38,0,191,0,0,0,7,4,200,0,132,
+0,0,0,2,0,80,255,230,4,60,5,208,0,15,0,23,0,0,1,5,17,5,7,39,21,5,7,39,21,
+5,7,39,17,1,1,7,39,17,37,55,23,17,1,81,1,44,1,191,61,246,1,48,56,248,1,48,
+56,248,254,11,1,58,54,141,254,197,57,128,1,91,149,5,10,228,112,129,235,162,
+114,134,238,162,114,134,253,222,1,5,3,98,95,80,253,93,183,94,73,2,163,0,0,
+3,0,80,255,230,4,239,5,208,0,39,0,55,0,59,0,0,1,16,2,6,35,34,38,2,17,52,55,
+39,21,51,21,35,21,51,21,35,17,37,55,23,53,35,53,51,53,35,53,51,17,1,54,54,
+51,50,22,18,3,16,38,38,35,34,6,6,17,16,22,22,51,50,54,54,39,35,17,51,4,239,
+68,144,111,112,141,67,6,172,104,104,104,104,254,138,49,195,104,104,104,104,
+1,61,27,147,127,113,142,66,140,35,79,69,69,77,34,35,77,68,69,79,35,116,130,
+130,2,221,254,211,254,198,144,137,1,45,1,58,158,85,140,166,110,120,110,254,
+88,173,113,98,236,110,120,110,1,173,254,255,189,184,139,254,211,254,197,1,
+29,234,116,116,231,254,232,254,227,240,122,118,235,103,1,141,0,3,0,120,0,
+0,4,139,5,212,0,13,0,22,0,26,0,0,1,39,17,35,32,36,53,52,54,36,51,51,17,5,
+1,34,6,21,20,22,51,51,17,3,35,17,51,4,98,231,144,254,217,254,180,153,1,20,
+174,28,1,156,254,51,209,233,229,213,49,145,130,130,4,122,122,251,12,234,210,
+136,206,112,2,82,225,254,23,176,158,156,168,2,146,254,48,1,43,0,255,255,0,
+100,0,0,4,23,7,10,2,38,0,195,0,0,0,7,4,200,0,132,0,0,0,2,0,100,0,0,4,23,5,
+208,0,32,0,42,0,0,55,54,54,55,17,1,7,37,21,54,51,50,22,21,20,6,35,34,39,21,
+22,22,23,7,38,38,39,17,35,17,6,6,7,1,34,7,21,22,51,50,54,53,52,100,44,213,
+147,2,0,56,254,196,33,41,112,131,131,112,41,33,149,210,44,123,30,144,106,
+140,99,148,33,1,245,48,33,30,40,66,73,82,201,248,25,3,164,254,228,113,169,
+185,9,122,98,91,117,6,106,23,249,203,38,157,204,29,254,79,1,177,25,203,162,
+3,172,13,207,7,54,54,119,0,0,1,0,100,0,0,3,245,5,208,0,32,0,0,19,54,36,51,
+50,22,21,17,20,6,6,35,34,38,39,39,17,35,17,51,4,51,50,54,54,53,17,52,38,35,
+34,6,7,100,123,1,25,134,190,185,48,112,112,51,130,125,138,140,33,1,181,114,
+70,46,16,107,128,118,244,106,4,235,109,120,207,209,253,237,144,146,64,37,
+51,52,254,185,2,8,213,31,93,173,1,198,157,153,107,93,255,255,0,100,255,226,
+4,104,7,10,2,38,0,198,0,0,0,7,4,200,0,137,0,0,0,2,0,100,255,226,4,104,5,182,
+0,24,0,36,0,0,1,35,17,37,55,23,17,33,53,33,17,51,17,51,18,51,50,22,21,20,
+6,35,34,38,53,51,20,22,22,51,50,17,16,35,34,6,6,2,124,89,254,65,61,246,254,
+221,1,35,140,95,32,209,122,123,123,122,123,124,130,23,49,45,115,115,44,50,
+23,3,80,252,146,252,112,132,2,134,110,1,248,254,8,1,21,187,207,196,178,180,
+194,114,94,55,1,7,1,28,63,109,0,3,0,120,255,226,4,37,5,182,0,35,0,39,0,43,
+0,0,1,17,51,50,54,53,52,38,39,55,22,22,21,20,6,7,22,22,21,20,6,7,39,62,2,
+53,52,38,35,35,17,1,55,5,17,1,35,17,51,19,35,17,51,2,196,34,91,88,66,82,55,
+116,117,78,72,73,77,118,115,55,56,64,28,88,91,34,253,254,61,1,57,254,194,
+130,130,215,130,130,5,182,253,204,90,71,81,77,28,111,45,141,101,72,116,38,
+39,117,70,102,140,45,111,18,48,63,57,71,90,252,206,1,32,112,168,4,236,252,
+178,2,18,253,238,2,18,0,255,255,0,80,255,230,4,135,7,10,2,38,0,201,0,0,0,
+7,4,200,0,213,0,0,0,1,0,80,255,230,4,135,5,182,0,13,0,0,1,17,33,17,51,17,
+35,17,33,17,37,55,23,17,2,15,1,236,140,140,254,20,254,65,61,246,5,182,253,
+126,2,130,250,74,2,188,253,42,248,112,132,4,236,0,0,4,0,120,255,230,4,48,
+5,208,0,44,0,51,0,58,0,66,0,0,19,52,54,55,53,6,35,34,38,53,52,54,51,50,23,
+54,55,23,2,7,23,21,22,22,21,20,6,7,21,20,6,35,34,38,39,55,22,22,51,50,54,
+53,53,38,38,37,52,38,39,17,54,54,37,20,22,23,17,6,6,19,50,55,38,35,34,21,
+20,120,214,192,45,79,103,127,119,101,209,51,101,60,124,98,174,1,190,216,220,
+186,99,109,92,151,51,109,39,101,43,44,26,187,219,3,54,138,143,143,138,253,
+76,138,143,143,138,163,61,49,16,113,97,2,167,139,172,15,62,7,116,96,98,118,
+252,73,179,26,254,245,87,15,88,13,172,141,142,173,12,58,177,143,104,90,59,
+68,65,73,137,48,12,173,142,88,117,11,254,80,11,117,88,88,116,12,1,176,11,
+117,1,147,10,198,106,102,255,255,0,80,255,230,3,231,7,10,2,38,0,204,0,0,0,
+6,4,200,92,0,0,2,0,80,255,230,3,231,5,182,0,13,0,17,0,0,1,33,17,1,55,5,17,
+51,17,33,21,33,17,33,37,35,17,51,3,231,254,105,254,0,61,1,55,140,1,151,254,
+105,1,151,253,20,130,130,1,188,254,42,1,28,112,168,4,236,254,234,110,253,
+248,61,2,68,0,3,0,180,0,0,3,182,5,182,0,26,0,35,0,43,0,0,37,38,39,6,7,21,
+35,17,5,17,51,17,37,17,22,23,54,55,21,6,7,22,21,20,7,22,51,1,52,55,38,39,
+17,54,55,38,55,20,23,54,53,52,39,6,3,182,191,139,130,170,140,2,55,140,253,
+201,170,130,142,188,122,98,120,126,95,131,253,208,119,77,112,114,82,126,130,
+100,100,100,100,76,2,78,72,8,76,5,122,206,1,10,254,64,201,254,245,15,67,73,
+11,119,4,38,111,165,160,120,38,1,62,166,110,31,9,253,134,4,34,120,160,130,
+87,87,130,132,81,81,255,255,0,120,0,0,4,164,7,10,2,38,0,207,0,0,0,7,4,200,
+0,204,0,0,0,3,0,120,0,0,4,164,5,182,0,13,0,17,0,21,0,0,1,2,0,35,34,0,3,51,
+18,18,51,50,18,19,1,35,17,51,1,35,17,51,4,164,18,254,229,233,241,254,235,
+16,140,14,205,175,173,203,17,253,208,130,130,1,218,130,130,5,182,254,182,
+254,142,1,105,1,83,254,229,254,215,1,46,1,22,250,74,2,78,253,178,2,78,0,0,
+3,0,80,0,0,3,232,5,182,0,11,0,15,0,19,0,0,1,33,17,35,17,35,53,51,17,51,17,
+33,39,35,17,51,17,35,17,51,3,232,253,218,140,230,230,140,2,38,137,130,130,
+130,130,2,228,253,28,2,228,110,2,100,253,156,150,1,111,251,126,1,111,0,0,
+2,0,80,255,230,4,30,5,208,0,32,0,69,0,0,19,51,18,51,50,19,51,21,35,23,51,
+21,35,22,18,21,16,35,34,39,6,35,34,38,53,52,55,35,53,51,54,55,35,1,20,51,
+50,54,53,52,39,35,53,51,38,39,35,53,51,38,35,34,6,7,51,21,35,7,51,21,35,2,
+21,20,22,51,50,53,53,51,110,158,117,182,178,114,165,132,29,133,113,24,24,
+251,127,44,62,109,126,125,41,106,126,12,17,125,2,10,116,57,49,39,161,141,
+14,13,144,110,75,92,46,87,33,109,142,28,140,159,41,51,55,116,130,4,128,1,
+80,254,176,110,120,110,146,254,254,68,254,146,112,112,167,199,230,242,110,
+59,61,253,61,241,123,123,230,242,110,74,46,110,216,117,99,110,120,110,254,
+254,214,134,112,241,85,0,255,255,0,120,255,230,4,34,7,10,2,38,0,211,0,0,0,
+6,4,200,122,0,0,1,0,120,255,230,4,34,5,208,0,15,0,0,19,5,17,33,17,35,17,51,
+17,33,17,1,7,37,17,1,235,1,56,254,215,130,130,1,41,1,255,61,254,202,253,255,
+1,114,168,2,122,254,176,2,250,254,196,2,30,254,228,112,175,250,243,1,28,0,
+0,1,0,120,0,0,3,226,5,208,0,17,0,0,19,33,17,5,7,39,17,37,17,35,17,5,17,33,
+17,35,17,51,250,1,41,1,191,61,246,254,85,140,1,171,254,215,130,130,4,80,1,
+128,228,112,128,251,181,204,254,131,2,88,222,2,104,254,216,2,200,0,0,5,0,
+80,255,230,4,243,5,208,0,15,0,27,0,39,0,50,0,61,0,0,1,17,33,17,5,7,39,17,
+35,17,33,17,37,55,23,17,1,20,6,35,34,38,53,52,54,51,50,22,17,20,6,35,34,38,
+53,52,54,51,50,22,3,52,38,35,34,6,21,20,22,51,50,17,52,38,35,34,6,21,20,22,
+51,50,1,171,1,237,1,91,64,143,140,254,19,254,165,64,143,2,46,89,81,83,91,
+94,80,80,90,89,81,83,91,94,80,80,90,93,39,38,40,41,35,41,82,39,38,40,41,35,
+41,82,5,182,253,96,2,186,240,100,97,251,35,2,158,253,72,240,100,97,4,221,
+251,178,105,113,113,105,110,120,124,2,110,105,113,113,105,110,120,124,252,
+190,73,61,61,73,51,72,3,83,73,61,61,73,51,72,255,255,0,110,255,230,4,14,7,
+10,2,38,0,215,0,0,0,7,4,200,0,129,0,0,0,4,0,110,255,230,4,14,5,212,0,7,0,
+11,0,15,0,28,0,0,1,1,17,35,17,1,17,51,1,35,17,51,1,35,17,51,1,6,6,35,34,38,
+39,55,18,33,50,54,55,3,234,253,48,140,2,208,140,254,2,130,130,1,34,130,130,
+1,0,44,233,184,183,240,44,133,57,1,21,135,165,29,3,120,1,137,254,139,2,72,
+254,116,1,110,251,225,2,16,253,240,2,16,253,228,203,218,216,205,50,254,161,
+180,171,0,0,5,0,110,255,230,4,14,5,212,0,7,0,11,0,24,0,28,0,32,0,0,1,1,17,
+35,17,1,17,51,1,35,17,51,1,6,6,35,34,38,39,55,18,33,50,54,55,39,35,17,51,
+3,35,17,51,3,238,253,48,140,2,208,140,254,2,130,130,2,30,44,233,184,183,240,
+44,133,57,1,21,135,165,29,120,130,130,145,130,130,3,140,1,122,254,194,2,12,
+254,136,1,90,252,239,1,12,253,218,203,218,216,205,50,254,161,180,171,232,
+1,12,253,140,1,12,255,255,0,100,0,0,3,134,7,10,2,38,0,218,0,0,0,6,4,200,72,
+0,0,2,0,100,0,0,3,134,5,182,0,25,0,36,0,0,19,54,54,53,16,37,55,22,23,54,55,
+37,55,5,17,51,17,35,17,5,39,37,38,39,6,7,37,51,55,17,39,34,6,21,21,22,22,
+100,123,133,255,0,36,202,92,63,111,254,241,53,1,120,140,140,254,136,53,1,
+13,109,66,92,199,2,75,21,18,39,110,127,3,121,1,193,29,163,121,1,11,62,109,
+36,171,85,30,155,93,215,1,65,250,74,1,142,214,93,153,26,83,157,42,187,2,1,
+226,3,134,120,9,111,113,0,0,4,0,100,0,0,3,229,5,182,0,20,0,30,0,34,0,38,0,
+0,1,33,17,35,17,5,39,37,38,38,53,52,54,55,37,55,5,17,51,17,33,1,51,55,17,
+39,34,6,21,20,22,1,35,17,51,17,35,17,51,3,229,254,184,140,254,136,53,1,13,
+112,134,134,113,254,242,53,1,120,140,1,72,254,5,21,18,39,110,127,122,2,12,
+130,130,130,130,2,189,253,67,1,142,214,93,153,27,175,128,129,189,30,155,93,
+215,1,65,253,117,254,228,2,1,226,3,134,120,116,117,1,188,1,52,251,234,1,52,
+0,0,4,0,100,0,0,3,139,5,208,0,3,0,7,0,13,0,17,0,0,1,35,17,51,37,35,17,51,
+19,17,1,7,37,17,37,35,17,51,3,62,130,130,253,168,130,130,166,1,255,61,254,
+202,254,206,130,130,1,209,1,194,10,1,194,250,161,5,208,254,228,112,175,251,
+13,205,1,194,255,255,0,100,0,0,4,149,7,10,2,38,0,222,0,0,0,7,4,200,0,191,
+0,0,0,1,0,100,0,0,4,149,5,182,0,33,0,0,1,54,54,53,53,51,21,20,6,6,7,17,35,
+17,33,17,35,17,46,2,53,53,51,21,20,22,23,17,51,17,33,17,51,3,165,64,46,130,
+49,108,83,140,254,199,140,82,109,49,130,49,61,140,1,57,140,3,22,19,166,186,
+131,151,183,185,98,9,253,102,1,74,254,182,2,154,9,98,186,182,151,131,199,
+153,19,2,160,252,12,3,244,0,0,6,0,120,0,0,4,122,5,182,0,8,0,11,0,15,0,19,
+0,23,0,27,0,0,1,1,7,1,1,17,1,1,23,1,45,2,35,17,51,17,35,17,51,1,35,17,51,
+17,35,17,51,2,209,1,169,62,254,45,254,15,1,241,1,211,62,252,128,1,7,254,249,
+2,140,130,130,130,130,254,58,130,130,130,130,2,244,254,239,94,1,44,254,192,
+3,6,254,192,1,44,94,254,70,169,169,220,1,61,250,74,1,61,254,195,1,61,3,60,
+1,61,255,255,0,100,0,0,3,252,7,10,2,38,0,225,0,0,0,6,4,200,112,0,0,2,0,100,
+0,0,3,252,5,182,0,22,0,26,0,0,19,50,54,53,52,38,35,53,50,22,23,17,5,17,51,
+17,37,17,35,17,6,6,35,19,35,17,51,100,199,243,239,203,132,229,81,1,92,130,
+254,174,140,84,232,126,183,130,130,1,74,175,149,154,180,120,69,69,1,67,148,
+1,61,254,5,147,251,178,1,95,71,70,1,66,1,4,0,1,0,120,0,0,4,42,5,182,0,15,
+0,0,1,17,1,23,1,21,1,23,1,17,37,17,35,17,5,17,2,132,1,34,82,254,140,1,84,
+82,254,90,254,128,140,1,128,5,182,254,153,1,9,97,254,177,228,1,54,97,254,
+132,254,198,174,254,111,2,88,172,4,10,255,255,0,60,0,0,4,122,7,10,2,38,0,
+228,0,0,0,7,4,200,0,175,0,0,0,1,0,60,0,0,4,122,5,182,0,31,0,0,1,54,54,55,
+51,6,2,7,17,37,17,35,17,5,17,38,39,7,39,55,38,39,51,22,23,55,23,7,22,23,17,
+51,2,176,123,162,31,142,34,237,182,254,128,140,1,128,177,111,114,91,133,71,
+22,140,15,39,110,86,132,78,122,130,3,240,23,231,200,250,254,210,24,253,109,
+174,254,111,2,88,172,1,202,21,130,116,91,132,139,179,122,94,109,91,133,103,
+21,1,199,0,0,1,0,100,0,0,4,122,5,182,0,24,0,0,19,22,22,51,50,54,55,51,6,2,
+7,21,37,23,5,17,37,17,35,17,5,17,38,2,3,240,28,194,161,151,198,32,142,34,
+237,182,1,34,58,254,164,254,128,140,1,128,186,234,33,5,182,218,242,238,222,
+250,254,210,24,191,161,113,190,254,186,174,254,111,2,88,172,1,202,22,1,37,
+1,5,0,2,0,100,0,0,4,122,5,182,0,20,0,24,0,0,19,22,22,51,50,54,55,51,6,2,7,
+17,37,17,35,17,5,17,38,2,3,1,35,17,51,240,28,194,161,151,198,32,142,34,237,
+182,254,128,140,1,128,186,234,33,2,76,130,130,5,182,218,242,238,222,250,254,
+210,24,253,109,174,254,111,2,88,172,1,202,22,1,37,1,5,254,208,1,18,0,255,
+255,0,80,255,226,4,2,7,10,2,38,0,232,0,0,0,6,4,200,82,0,0,1,0,80,255,226,
+4,2,5,194,0,20,0,0,5,36,17,53,55,39,17,37,55,23,17,5,18,37,23,6,2,21,20,18,
+23,3,185,254,121,1,139,254,168,64,150,1,29,63,1,55,73,166,158,153,171,10,
+251,1,235,24,24,117,252,97,244,100,103,3,192,242,1,84,205,108,104,254,202,
+220,220,254,213,115,0,3,0,120,0,0,3,232,5,212,0,18,0,25,0,29,0,0,1,37,21,
+22,22,21,20,6,7,21,35,17,39,17,35,17,1,17,51,3,52,38,39,17,54,54,5,35,17,
+51,3,212,254,152,179,201,199,181,140,220,140,2,208,140,110,122,128,129,121,
+253,248,130,130,3,140,189,194,18,172,134,134,173,18,254,4,146,116,254,194,
+2,12,254,136,1,90,252,141,84,112,17,254,86,16,114,139,1,208,0,0,2,0,80,255,
+226,3,215,5,182,0,21,0,25,0,0,1,17,22,51,50,54,54,53,17,51,17,20,14,2,35,
+39,17,1,55,5,17,3,35,17,51,2,158,22,20,57,59,25,130,31,61,97,72,52,253,178,
+44,1,150,225,130,130,5,182,252,224,5,54,127,196,1,56,254,180,172,161,93,51,
+3,253,198,1,25,115,195,5,11,253,13,2,71,0,255,255,0,110,0,0,3,152,7,10,2,
+38,0,236,0,0,0,6,4,200,69,0,0,3,0,110,0,0,3,152,5,182,0,29,0,33,0,37,0,0,
+1,55,23,1,1,7,39,17,33,21,33,21,33,21,33,53,33,53,33,53,33,17,7,39,1,1,55,
+23,17,51,1,35,53,51,5,35,53,51,2,74,250,84,254,192,1,64,82,252,1,14,254,242,
+1,54,253,8,1,54,254,242,1,14,254,82,1,64,254,192,84,252,140,254,172,120,120,
+2,148,120,120,4,95,231,79,254,216,254,218,82,232,254,121,120,200,120,120,
+200,120,1,137,234,82,1,38,1,40,79,233,1,89,253,169,203,203,203,0,3,0,120,
+0,0,3,166,5,182,0,19,0,26,0,30,0,0,33,33,53,33,17,33,53,33,21,33,21,30,2,
+21,20,6,35,17,33,3,52,38,39,17,50,54,5,35,17,51,3,162,252,214,1,54,254,202,
+3,42,254,152,113,163,88,197,167,1,104,126,124,110,112,122,253,254,130,130,
+120,4,198,120,120,218,1,95,165,103,159,185,254,216,2,128,118,135,1,254,25,
+119,220,2,176,0,0,4,0,140,255,230,4,49,5,208,0,11,0,21,0,28,0,35,0,0,1,16,
+2,35,34,2,17,16,18,51,50,18,3,52,39,33,6,21,20,23,33,54,1,50,54,55,33,22,
+22,19,34,6,7,33,38,38,4,49,243,223,223,244,245,222,224,242,140,13,253,141,
+13,12,2,116,13,254,184,110,148,35,253,183,34,148,110,105,147,38,2,71,37,149,
+2,221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,121,93,89,117,
+118,102,91,253,250,159,148,150,157,4,250,155,146,149,152,0,255,255,0,140,
+0,0,4,49,7,10,2,38,0,240,0,0,0,7,4,200,0,155,0,0,0,2,0,140,0,0,4,49,5,182,
+0,35,0,43,0,0,1,21,20,23,54,51,50,23,54,53,53,51,21,16,7,22,17,21,35,53,52,
+39,6,35,34,39,6,21,21,35,53,16,55,38,17,53,1,34,7,22,51,50,55,38,1,24,55,
+113,159,159,113,54,140,104,104,140,54,112,160,159,113,55,140,105,105,1,209,
+125,83,81,127,133,79,81,5,182,201,241,161,113,113,164,246,193,193,254,178,
+204,204,254,178,193,193,247,162,112,113,161,241,201,201,1,70,204,204,1,70,
+201,253,158,121,121,121,121,0,2,0,80,255,230,3,167,5,208,0,18,0,21,0,0,19,
+5,17,5,7,39,17,37,17,37,17,37,55,23,17,5,39,37,37,5,7,23,139,1,42,1,191,61,
+246,1,102,254,154,254,65,61,246,254,214,59,1,58,254,198,2,213,194,194,4,67,
+186,2,71,228,112,129,254,148,228,253,81,227,253,61,248,112,132,1,231,185,
+94,199,200,79,121,120,0,2,0,120,255,230,4,16,5,182,0,26,0,35,0,0,1,39,17,
+20,6,6,35,34,38,38,53,17,39,17,35,17,23,17,51,17,23,17,51,17,23,17,51,1,50,
+54,53,17,39,17,20,22,4,16,218,48,106,89,88,105,48,88,130,218,140,204,140,
+88,130,254,53,58,43,204,42,2,146,115,254,131,168,166,84,83,164,171,2,125,
+47,254,114,2,92,120,1,44,254,135,112,1,233,253,202,48,1,168,251,102,115,182,
+1,200,108,253,204,183,114,0,255,255,0,80,255,230,4,37,7,10,2,38,0,244,0,0,
+0,7,4,200,0,131,0,0,0,3,0,80,255,230,4,37,5,182,0,9,0,20,0,32,0,0,1,17,19,
+23,1,17,1,55,5,17,1,52,54,51,50,22,21,16,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,2,243,207,99,254,206,253,167,61,1,144,253,233,113,109,110,118,
+228,111,111,120,46,62,52,51,52,57,53,49,5,182,254,3,1,23,79,254,105,252,252,
+1,64,112,204,4,236,253,250,152,166,163,155,254,209,155,148,92,101,91,102,
+117,89,89,0,3,0,120,0,0,4,156,5,182,0,28,0,35,0,42,0,0,1,39,17,35,17,39,17,
+35,34,38,38,53,52,54,55,38,38,53,52,54,55,53,23,53,51,17,23,17,51,1,20,22,
+23,17,6,6,3,20,22,23,17,6,6,4,156,230,130,100,132,138,210,113,100,93,103,
+97,243,217,240,130,100,130,252,101,175,148,149,174,7,174,156,160,170,3,121,
+165,254,248,1,101,72,251,61,95,163,101,95,155,49,44,148,89,148,176,4,194,
+169,170,254,250,70,1,76,251,177,107,136,5,1,240,5,137,1,218,102,114,2,1,181,
+4,113,0,255,255,0,120,0,0,3,222,7,10,2,38,0,247,0,0,0,6,4,200,101,0,0,2,0,
+120,0,0,3,222,5,182,0,30,0,44,0,0,37,54,54,53,52,38,35,35,53,51,50,54,54,
+53,52,38,39,53,50,22,22,21,20,6,7,22,22,21,20,4,35,3,6,6,21,20,22,23,7,38,
+38,53,52,54,55,1,228,185,191,183,162,43,43,105,159,81,200,176,155,229,122,
+116,104,113,107,254,247,241,2,107,125,113,103,54,142,150,160,144,114,3,153,
+142,139,156,130,66,115,72,121,135,2,114,95,171,106,101,172,47,54,190,114,
+191,221,4,62,46,179,117,111,169,47,106,60,224,149,145,236,64,0,1,0,80,255,
+240,4,78,5,208,0,34,0,0,1,7,19,22,51,50,54,53,17,5,7,39,17,20,6,35,34,38,
+39,3,7,39,55,39,7,39,55,3,55,19,55,23,7,23,55,2,113,159,127,27,13,14,8,1,
+191,61,246,76,82,50,78,35,112,107,75,140,46,119,75,151,139,117,126,115,75,
+148,46,127,2,189,147,254,183,72,50,101,4,160,228,112,129,252,30,164,135,89,
+95,1,34,99,81,129,120,110,81,140,1,107,59,254,185,107,81,137,119,117,255,
+255,0,120,255,240,3,172,7,10,2,38,0,250,0,0,0,6,4,200,121,0,0,2,0,120,255,
+240,3,172,5,202,0,35,0,52,0,0,19,51,54,55,38,39,55,22,23,54,55,23,6,7,22,
+17,16,7,22,23,7,38,39,6,7,39,54,55,38,39,35,53,51,39,55,35,33,7,21,23,51,
+21,35,22,23,54,17,16,39,6,7,51,21,120,159,48,138,90,179,18,209,145,142,212,
+18,179,90,209,211,107,164,18,208,146,146,208,18,162,108,146,45,155,138,2,
+3,139,1,23,3,2,189,169,40,110,172,172,103,42,164,3,159,181,130,56,67,121,
+67,96,95,68,121,66,57,192,254,199,254,203,199,70,50,121,61,99,99,61,121,50,
+70,136,196,120,56,74,74,28,28,120,149,104,166,1,7,1,8,163,95,138,120,0,0,
+3,0,80,0,0,4,2,5,194,0,13,0,16,0,20,0,0,1,21,1,1,7,1,1,39,1,1,53,33,39,55,
+3,19,33,1,35,17,51,3,218,254,151,1,145,94,254,133,254,133,94,1,144,254,152,
+2,182,190,92,163,236,254,40,1,45,130,130,4,161,39,254,36,253,241,69,1,244,
+254,12,69,2,15,1,220,39,203,86,253,59,1,54,251,205,1,64,0,255,255,0,80,0,
+0,3,190,7,10,2,38,0,253,0,0,0,6,4,200,112,0,0,2,0,80,0,0,3,190,5,182,0,19,
+0,37,0,0,1,17,35,34,36,39,35,53,51,39,52,55,35,53,51,54,36,51,51,17,3,34,
+6,7,51,21,35,6,21,23,51,21,35,22,22,51,51,17,3,190,144,222,254,225,47,178,
+159,2,9,166,196,58,1,18,182,28,49,113,178,50,172,212,11,3,220,193,44,191,
+127,49,5,182,250,74,189,175,110,60,57,53,110,151,173,1,128,254,8,107,97,110,
+55,55,60,110,116,128,3,70,0,3,0,100,0,0,4,23,5,208,0,36,0,40,0,44,0,0,33,
+17,6,6,7,39,54,54,55,53,38,38,39,55,22,22,23,17,5,7,39,17,54,55,23,6,6,7,
+21,22,22,23,7,38,38,39,17,1,35,53,51,5,35,53,51,1,248,99,148,33,124,44,213,
+147,131,188,53,120,38,129,85,1,127,61,182,174,79,120,55,192,126,149,210,44,
+123,30,144,106,254,188,107,107,2,103,107,107,1,147,25,203,162,39,201,248,
+25,221,22,192,150,44,116,147,22,2,106,192,112,93,254,106,44,240,42,159,186,
+21,221,23,249,203,38,157,204,29,254,109,2,26,187,187,187,0,255,255,0,120,
+0,0,4,164,7,10,2,38,1,0,0,0,0,7,4,200,0,204,0,0,0,4,0,120,0,0,4,164,5,182,
+0,3,0,7,0,11,0,25,0,0,1,35,17,51,1,35,17,51,1,35,17,51,1,2,0,35,34,0,3,51,
+18,18,51,50,18,55,1,151,130,130,2,112,130,130,254,200,130,130,1,213,29,254,
+229,222,231,254,236,27,140,23,203,168,163,203,26,1,204,1,24,254,232,1,24,
+253,28,1,78,4,104,254,207,254,175,1,76,1,54,255,0,254,246,1,13,253,0,2,0,
+100,0,0,4,23,5,208,0,36,0,40,0,0,33,17,6,6,7,39,54,54,55,53,38,38,39,55,22,
+22,23,17,5,7,39,17,54,55,23,6,6,7,21,22,22,23,7,38,38,39,17,1,35,53,51,1,
+248,99,148,33,124,44,213,147,131,188,53,120,38,129,85,1,127,61,182,174,79,
+120,55,192,126,149,210,44,123,30,144,106,1,15,107,107,1,177,25,203,162,39,
+201,248,25,191,22,192,150,44,116,147,22,2,106,192,112,93,254,106,44,240,42,
+159,186,21,191,23,249,203,38,157,204,29,254,79,2,36,177,0,255,255,0,120,0,
+0,4,134,7,10,2,38,1,3,0,0,0,7,4,200,0,194,0,0,0,3,0,120,0,0,4,134,5,182,0,
+31,0,35,0,39,0,0,1,54,54,55,51,6,2,7,17,33,21,33,21,33,21,33,53,33,53,33,
+53,33,17,38,2,39,51,22,22,23,17,51,1,35,17,51,1,35,17,51,2,192,121,159,32,
+142,39,234,176,1,64,254,192,1,104,252,164,1,104,254,192,1,64,182,229,38,140,
+29,161,124,130,254,200,130,130,2,112,130,130,4,12,23,218,185,240,254,228,
+24,254,88,120,250,120,120,250,120,1,168,22,1,23,247,186,220,21,1,171,252,
+152,1,24,254,232,1,24,0,0,3,0,130,0,0,4,226,5,182,0,31,0,39,0,47,0,0,37,54,
+54,53,52,38,35,35,17,35,17,51,17,51,50,54,53,52,39,55,22,22,21,20,6,7,22,
+22,21,20,6,7,37,1,17,35,17,1,17,51,53,1,17,35,17,1,17,51,3,215,66,60,117,
+85,29,140,140,29,89,114,124,91,85,88,85,71,70,86,94,94,254,60,254,162,130,
+1,94,130,254,162,130,1,94,130,183,51,122,95,101,136,253,80,5,182,253,104,
+138,98,176,93,86,69,170,120,85,155,48,45,161,85,112,174,72,37,1,61,254,215,
+2,40,254,221,1,15,118,1,61,254,215,2,40,254,221,1,15,0,255,255,0,10,0,0,3,
+246,7,10,2,38,1,6,0,0,0,6,4,200,102,0,0,2,0,10,0,0,3,246,5,208,0,19,0,29,
+0,0,1,23,22,21,20,6,35,34,39,55,22,22,51,50,54,53,52,38,39,39,5,39,17,37,
+17,35,17,5,17,5,1,50,111,66,118,104,184,67,120,13,74,48,43,45,31,11,128,3,
+2,246,254,85,140,1,171,1,191,5,165,215,132,76,90,103,198,47,56,69,46,29,42,
+61,22,235,236,128,251,181,204,254,131,2,88,222,4,86,228,0,0,3,0,120,255,230,
+4,120,5,203,0,37,0,51,0,55,0,0,1,19,23,7,37,3,21,20,51,50,54,54,53,51,20,
+6,7,21,16,2,35,34,2,17,53,46,2,53,51,20,22,22,51,50,53,53,55,3,50,18,53,53,
+35,34,39,6,35,35,21,20,18,19,35,53,51,1,135,166,111,78,1,81,225,151,60,64,
+27,140,60,60,204,188,188,204,45,52,23,140,27,62,62,151,103,33,123,129,21,
+151,80,82,149,21,130,187,130,130,4,119,1,84,48,154,52,254,234,40,241,58,133,
+156,196,184,43,93,254,210,254,183,1,73,1,46,93,32,106,141,144,157,131,59,
+241,62,109,251,188,1,2,243,59,122,122,59,245,255,0,1,6,238,255,255,0,80,255,
+226,4,26,7,10,2,38,1,9,0,0,0,7,4,200,0,140,0,0,0,2,0,80,255,226,4,26,5,194,
+0,21,0,35,0,0,5,36,17,53,55,39,17,37,55,23,17,23,54,54,55,23,6,2,21,20,18,
+23,39,38,38,53,52,54,55,23,14,2,21,20,23,3,145,254,121,2,100,254,168,64,150,
+251,34,179,155,73,166,158,153,171,25,92,84,83,93,89,59,43,28,130,10,251,1,
+235,40,40,85,252,97,244,100,103,3,192,213,158,255,103,108,104,254,202,220,
+220,254,213,115,204,94,210,127,123,215,92,86,71,89,112,74,196,147,0,0,1,0,
+120,255,230,4,16,5,208,0,22,0,0,1,37,19,7,3,3,39,1,39,39,17,35,17,5,3,55,
+19,19,23,3,23,17,51,4,16,254,136,237,114,207,207,114,1,0,11,254,130,1,70,
+187,114,207,207,114,231,240,130,1,222,199,253,109,44,2,64,253,192,44,2,201,
+31,134,254,114,2,92,179,2,9,44,253,192,2,64,44,253,124,132,1,168,0,4,0,180,
+255,230,4,239,5,182,0,16,0,25,0,29,0,33,0,0,1,33,17,20,6,35,34,38,53,17,51,
+17,33,17,51,17,33,1,50,54,53,17,33,17,20,22,37,35,17,51,17,35,17,51,4,239,
+254,93,165,168,164,167,140,1,128,140,1,163,253,18,104,87,254,128,86,2,197,
+130,130,130,130,3,17,254,99,204,194,191,207,4,66,253,211,2,45,253,211,252,
+213,126,151,1,158,254,98,150,127,166,1,114,1,174,1,34,255,255,0,60,255,240,
+3,120,7,10,2,38,1,13,0,0,0,6,4,200,55,0,0,3,0,60,255,240,3,120,5,193,0,10,
+0,13,0,17,0,0,5,1,1,39,1,1,55,1,1,51,17,1,19,17,5,51,17,35,3,75,254,173,254,
+181,113,1,117,254,139,113,1,75,1,83,45,254,198,174,253,110,130,130,16,2,103,
+253,153,66,2,166,2,167,66,253,152,2,104,250,47,2,232,254,190,2,133,100,254,
+108,0,3,0,80,255,240,4,49,5,193,0,10,0,18,0,21,0,0,5,1,1,39,1,1,55,1,1,51,
+17,1,55,23,17,5,7,39,17,1,19,17,4,4,254,173,254,181,113,1,117,254,139,113,
+1,75,1,83,45,252,31,58,92,1,11,58,79,1,143,174,16,2,103,253,153,66,2,166,
+2,167,66,253,152,2,104,250,47,2,83,104,58,1,149,163,104,53,254,107,1,61,254,
+190,2,133,255,255,0,120,255,226,3,150,7,10,2,38,1,16,0,0,0,6,4,200,90,0,0,
+2,0,120,255,226,3,150,5,182,0,5,0,15,0,0,5,1,55,5,17,51,1,1,21,35,17,51,21,
+23,17,51,3,150,253,80,41,1,251,140,254,224,254,132,130,130,250,130,30,1,21,
+123,217,5,29,252,22,1,1,227,2,78,216,163,2,135,0,2,0,140,255,230,3,255,5,
+182,0,14,0,27,0,0,1,22,18,17,16,2,35,34,2,17,16,18,55,53,51,19,16,39,17,35,
+17,6,17,20,18,51,50,18,2,135,185,191,226,215,210,232,194,183,130,236,236,
+130,237,155,145,152,151,4,200,24,254,193,254,234,254,206,254,189,1,78,1,47,
+1,21,1,56,24,238,252,165,1,188,54,254,115,1,141,50,254,72,251,254,246,1,5,
+0,255,255,0,140,0,0,4,54,7,10,2,38,1,19,0,0,0,6,4,200,119,0,0,1,0,140,0,0,
+4,54,5,208,0,17,0,0,1,33,17,37,17,35,17,5,17,33,53,33,17,5,7,37,17,33,4,1,
+254,194,254,85,140,1,171,254,192,1,64,1,255,61,254,202,1,62,3,76,253,101,
+204,254,131,2,88,222,1,210,110,2,22,255,112,155,254,190,0,1,0,80,255,230,
+3,196,5,208,0,15,0,0,1,33,17,1,55,5,17,33,53,33,17,1,7,37,17,33,3,143,254,
+194,253,255,61,1,56,254,192,1,64,1,255,61,254,202,1,62,2,202,253,28,1,28,
+112,168,2,0,110,2,152,254,228,112,175,254,69,0,255,255,0,80,255,230,3,172,
+7,10,2,38,1,22,0,0,0,6,4,200,64,0,0,5,0,80,255,230,3,172,5,208,0,21,0,24,
+0,27,0,30,0,33,0,0,1,1,53,33,17,5,7,39,21,33,21,1,1,21,33,17,37,55,23,53,
+33,53,1,53,35,19,53,7,37,21,51,3,21,55,1,170,254,166,1,107,1,125,61,180,1,
+101,254,165,1,91,254,155,254,131,61,180,254,149,1,117,171,171,171,1,35,165,
+165,165,2,243,1,42,62,1,117,196,108,97,166,62,254,214,254,215,62,254,90,196,
+108,97,215,62,1,155,136,254,13,135,135,131,131,1,243,131,131,0,0,1,0,90,0,
+0,3,241,5,212,0,25,0,0,37,2,39,17,35,17,6,3,35,18,18,55,17,39,17,35,17,1,
+17,51,17,37,17,22,18,19,3,111,43,216,140,211,48,131,29,199,162,220,140,2,
+208,140,254,152,163,196,30,30,1,165,61,254,0,2,0,61,254,91,1,12,1,54,28,2,
+13,120,254,139,2,72,254,116,1,110,253,194,196,254,64,28,254,207,254,239,0,
+2,0,100,255,226,3,56,5,182,0,5,0,43,0,0,5,37,55,5,17,51,3,38,38,39,6,6,21,
+20,22,23,21,38,38,53,52,54,55,38,53,52,54,55,21,6,6,21,20,22,23,54,54,55,
+21,6,6,21,20,23,3,56,253,202,41,1,129,140,208,116,119,13,63,75,74,85,134,
+155,85,74,159,157,132,85,74,76,62,13,132,109,72,66,133,30,237,123,168,5,20,
+252,212,22,126,87,10,84,56,72,75,6,112,4,139,112,75,116,26,69,148,112,139,
+4,112,6,75,72,56,85,10,101,138,21,115,23,107,69,142,38,255,255,0,100,255,
+230,3,193,7,10,2,38,1,26,0,0,0,6,4,200,62,0,0,3,0,100,255,230,3,193,5,208,
+0,39,0,43,0,53,0,0,1,35,21,20,22,22,51,50,54,55,23,6,6,35,34,38,38,53,17,
+6,35,34,38,53,52,54,51,50,19,54,55,23,2,7,21,51,21,35,21,51,1,35,17,51,19,
+50,55,38,38,35,34,21,20,22,3,77,246,11,27,32,43,101,39,109,50,160,94,74,86,
+38,60,59,107,133,122,98,231,40,88,62,124,103,163,246,246,246,253,208,130,
+130,66,58,49,3,70,63,92,64,1,219,171,98,80,32,65,68,59,88,106,63,125,132,
+2,190,16,148,124,103,133,254,228,95,189,26,254,236,121,230,110,140,254,196,
+1,251,1,68,17,134,117,116,72,80,0,2,0,120,0,0,3,244,5,208,0,29,0,42,0,0,1,
+33,21,20,22,51,33,21,33,34,38,38,53,17,38,38,53,52,54,54,51,50,22,22,21,20,
+6,7,21,33,1,20,22,51,50,54,53,52,38,38,35,34,6,3,185,254,134,35,49,1,81,254,
+126,68,75,32,149,166,112,204,131,132,202,111,236,201,1,122,253,65,175,142,
+139,176,77,142,96,143,174,1,112,154,54,40,120,37,78,99,1,233,31,198,147,115,
+189,105,104,189,116,174,213,2,212,2,89,123,155,156,122,83,138,78,170,0,255,
+255,0,80,0,0,3,183,7,10,2,38,1,29,0,0,0,6,4,200,62,0,0,2,0,80,0,0,3,183,5,
+208,0,13,0,17,0,0,33,17,33,53,33,17,1,7,37,17,33,21,33,17,37,35,17,51,1,184,
+254,152,1,104,1,255,61,254,202,1,104,254,152,254,199,130,130,2,234,110,2,
+120,254,228,112,175,254,101,110,253,22,167,1,161,0,2,0,80,255,230,3,196,5,
+182,0,15,0,19,0,0,1,33,17,1,55,5,17,33,53,33,17,1,7,37,17,33,3,33,53,33,3,
+155,254,182,253,255,61,1,56,254,182,1,74,1,255,61,254,202,1,74,30,253,48,
+2,208,2,134,253,96,1,28,112,168,1,188,110,2,0,254,228,112,175,254,221,2,84,
+110,0,255,255,0,100,255,230,3,161,7,10,2,38,1,32,0,0,0,6,4,200,62,0,0,2,0,
+100,255,230,3,161,5,182,0,21,0,25,0,0,1,35,17,1,55,5,17,35,53,51,17,35,53,
+51,17,51,17,51,21,35,17,51,5,35,17,51,3,161,237,253,255,61,1,56,213,213,213,
+213,140,237,237,237,253,69,130,130,2,184,253,46,1,28,112,168,1,238,110,1,
+24,110,1,10,254,246,110,254,232,234,2,175,0,1,0,80,0,0,3,172,5,182,0,15,0,
+0,33,17,33,53,33,17,5,17,51,17,37,17,33,21,33,17,1,154,254,182,1,74,1,92,
+130,254,174,1,134,254,122,2,34,110,2,95,148,1,91,253,231,147,254,96,110,253,
+222,0,255,255,0,80,255,230,4,67,7,10,2,38,1,35,0,0,0,6,4,200,112,0,0,2,0,
+80,255,230,4,67,5,208,0,15,0,35,0,0,1,33,17,1,55,5,17,33,53,33,17,1,7,37,
+17,33,1,22,22,51,50,54,53,52,38,39,39,55,23,22,21,20,6,35,34,39,3,230,254,
+234,253,255,61,1,56,254,112,1,144,1,255,61,254,202,1,22,252,215,19,59,32,
+43,45,31,11,76,120,62,66,118,104,144,71,2,162,253,68,1,28,112,168,1,216,110,
+2,192,254,228,112,175,254,29,1,73,29,35,46,29,42,61,22,139,62,120,132,76,
+90,103,119,0,0,3,0,80,255,226,3,217,5,182,0,5,0,20,0,35,0,0,5,37,55,5,17,
+51,1,38,38,35,34,6,6,7,35,54,54,51,50,22,23,17,6,6,35,34,38,39,51,30,2,51,
+50,54,55,3,217,252,216,41,2,115,140,254,138,23,93,79,63,79,47,21,126,39,162,
+137,125,156,36,36,156,125,137,163,38,126,20,47,79,64,78,94,23,30,246,123,
+196,5,39,252,72,150,115,48,96,121,205,180,186,199,3,77,198,187,181,204,119,
+98,48,114,151,0,0,2,0,100,0,0,3,72,5,182,0,16,0,36,0,0,1,34,38,38,53,52,54,
+54,51,21,34,6,6,21,20,22,51,1,33,50,22,21,17,20,6,35,33,53,33,50,54,53,17,
+52,38,35,33,1,240,108,168,101,93,169,115,76,111,60,134,113,254,116,1,242,
+136,106,105,137,254,14,1,231,71,42,45,68,254,25,1,138,90,177,107,104,182,
+108,110,75,132,77,120,143,3,189,106,144,252,60,143,105,120,44,76,3,215,78,
+41,0,255,255,0,100,0,0,3,212,7,10,2,38,1,39,0,0,0,6,4,200,41,0,0,5,0,100,
+0,0,3,212,5,182,0,17,0,21,0,25,0,29,0,33,0,0,19,33,50,54,53,52,38,35,33,53,
+33,50,22,21,20,6,35,33,1,35,17,51,1,35,17,51,1,35,17,51,1,35,17,51,100,2,
+25,115,98,101,112,253,231,2,25,178,165,173,170,253,231,2,189,130,130,254,
+28,130,130,1,228,130,130,254,28,130,130,2,115,70,75,74,68,120,125,137,131,
+134,2,136,1,51,254,205,1,51,250,74,1,98,254,158,1,98,0,4,0,100,0,0,3,72,5,
+182,0,3,0,7,0,11,0,31,0,0,1,33,53,33,53,33,53,33,17,33,53,33,1,33,50,22,21,
+17,20,6,35,33,53,33,50,54,53,17,52,38,35,33,2,78,254,84,1,172,254,84,1,172,
+254,84,1,172,254,22,1,242,136,106,105,137,254,14,1,231,71,42,45,68,254,25,
+2,182,110,230,110,252,234,110,3,230,106,144,252,60,143,105,120,44,76,3,215,
+78,41,0,0,4,0,80,255,243,4,40,5,191,0,26,0,53,0,57,0,61,0,0,19,54,54,53,52,
+38,39,55,22,22,21,20,6,7,22,22,21,20,6,7,39,54,54,53,52,38,39,33,6,6,21,20,
+22,23,7,38,38,53,52,54,55,38,38,53,52,54,55,23,6,6,21,20,22,23,1,35,17,51,
+17,35,17,51,104,113,90,116,111,40,149,168,107,93,93,107,165,152,40,111,116,
+91,112,3,168,113,90,116,111,40,151,166,107,93,93,107,168,149,40,111,116,91,
+112,254,109,130,130,130,130,3,18,41,124,109,117,154,29,111,37,216,158,100,
+177,54,55,176,100,156,217,38,111,29,154,117,109,124,41,41,124,109,117,154,
+29,111,38,217,156,100,177,54,55,176,100,157,216,38,111,29,153,118,109,124,
+41,253,12,1,131,2,116,1,131,0,255,255,0,80,0,0,3,76,7,10,2,38,1,43,0,0,0,
+6,4,200,29,0,0,1,0,80,0,0,3,39,5,182,0,19,0,0,1,17,37,17,35,17,5,17,33,53,
+33,53,33,53,33,53,33,53,33,53,3,39,253,241,140,2,15,253,181,2,75,253,181,
+2,75,253,181,2,75,5,182,251,15,184,254,131,2,58,192,1,32,110,130,110,130,
+110,206,0,0,5,0,80,255,230,4,75,5,182,0,7,0,13,0,17,0,21,0,25,0,0,1,39,17,
+35,17,23,17,51,33,17,37,55,23,17,1,35,53,51,17,35,53,51,17,35,53,51,4,75,
+172,140,172,140,253,96,254,165,64,143,1,129,130,130,130,130,130,130,3,198,
+119,251,195,5,32,120,1,14,250,48,240,100,97,4,221,252,220,254,253,134,254,
+1,250,254,0,1,0,80,255,230,3,196,5,208,0,15,0,0,19,5,17,1,7,37,17,5,7,37,
+21,5,7,37,17,1,141,1,56,1,255,61,254,202,1,115,61,254,202,1,115,61,254,202,
+253,255,1,114,168,5,6,254,228,112,175,255,0,212,115,177,230,212,115,177,254,
+5,1,28,255,255,0,120,0,0,3,245,7,10,2,38,1,47,0,0,0,6,4,200,82,0,0,2,0,120,
+0,0,3,245,5,208,0,17,0,21,0,0,1,37,21,5,7,37,21,5,7,37,17,37,17,35,17,5,17,
+1,1,35,17,51,3,184,254,204,1,113,61,254,204,1,113,61,254,204,254,128,140,
+1,128,1,253,253,5,130,130,4,68,176,178,211,115,176,160,211,115,176,254,109,
+174,254,111,2,88,172,4,36,254,228,254,185,1,161,0,5,0,130,0,0,3,203,5,182,
+0,47,0,95,0,99,0,103,0,107,0,0,37,51,50,54,53,52,38,35,35,53,51,50,54,53,
+52,38,35,35,53,51,50,54,53,52,38,35,35,53,51,50,22,21,20,6,7,22,22,21,20,
+6,7,22,22,21,20,6,43,3,34,38,53,52,54,55,38,38,53,52,54,55,38,38,53,52,54,
+51,51,21,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,51,21,35,34,6,21,20,
+22,51,51,19,35,53,51,53,35,53,51,17,35,53,51,2,158,29,65,82,79,62,35,35,62,
+79,75,66,35,35,64,77,75,66,35,35,128,138,52,47,48,51,52,47,48,51,152,109,
+40,239,40,110,151,52,47,47,52,51,48,47,52,139,127,35,35,65,76,77,64,35,35,
+65,76,80,61,35,35,62,79,82,65,29,182,130,130,130,130,130,130,106,93,75,75,
+92,120,98,69,71,92,120,95,73,71,92,120,151,132,63,115,39,36,121,77,63,115,
+39,36,125,76,115,159,159,115,78,124,35,39,115,63,76,122,36,39,115,63,134,
+149,120,91,72,73,95,120,91,72,69,98,120,92,75,75,93,2,8,200,251,200,251,174,
+200,0,255,255,0,80,255,226,3,204,7,10,2,38,1,50,0,0,0,6,4,200,97,0,0,2,0,
+80,255,226,3,204,5,182,0,25,0,31,0,0,1,55,23,7,23,7,39,21,51,21,35,21,35,
+53,35,53,51,17,7,39,55,39,55,23,53,51,1,37,55,5,17,51,1,237,200,72,249,249,
+70,202,212,212,130,223,223,213,70,249,249,72,211,130,1,223,252,216,41,2,115,
+140,4,175,158,90,197,196,93,159,254,110,185,185,110,1,7,168,93,196,197,90,
+167,214,250,102,246,123,196,5,39,0,0,1,0,90,0,0,3,241,5,208,0,24,0,0,37,2,
+39,17,35,17,6,6,7,35,18,18,55,17,1,7,37,21,5,7,37,17,22,18,19,3,111,48,216,
+130,107,133,24,131,29,199,162,1,255,61,254,202,1,115,61,254,202,163,196,30,
+30,1,172,56,253,254,2,2,29,245,210,1,12,1,54,28,3,84,254,228,112,175,206,
+212,115,177,254,237,28,254,207,254,239,0,0,3,0,140,255,230,4,84,5,208,0,24,
+0,40,0,44,0,0,5,38,39,2,35,34,38,2,17,16,18,54,51,50,22,23,54,55,23,6,2,21,
+20,18,23,1,16,38,38,35,34,6,6,17,16,22,22,51,50,54,54,37,35,17,51,4,11,186,
+98,62,229,111,142,67,68,140,114,117,142,32,94,188,73,166,158,153,171,254,
+47,35,79,69,69,77,34,35,77,68,69,79,35,1,108,130,130,10,119,173,254,204,142,
+1,52,1,61,1,49,1,45,141,147,157,165,125,108,104,254,202,220,220,254,213,115,
+2,123,1,29,234,116,116,231,254,232,254,227,240,122,118,235,148,1,54,255,255,
+0,140,255,230,4,49,7,10,2,38,1,54,0,0,0,7,4,200,0,163,0,0,0,2,0,140,255,230,
+4,49,5,208,0,11,0,23,0,0,1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,2,
+17,16,18,51,50,18,4,49,243,223,223,244,245,222,224,242,140,169,159,154,171,
+166,159,158,170,2,221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,
+154,1,53,1,70,254,184,254,213,254,192,254,185,1,73,0,0,4,0,80,0,0,4,58,5,
+208,0,19,0,31,0,35,0,39,0,0,19,52,54,54,51,50,22,21,20,6,7,17,39,17,35,17,
+23,17,38,38,55,20,22,51,50,54,53,52,38,35,34,6,1,35,17,51,1,35,17,51,130,
+113,214,150,223,252,211,192,229,140,229,190,219,130,182,165,163,182,180,165,
+166,181,2,137,130,130,253,69,130,130,4,135,98,150,81,177,152,139,173,15,253,
+233,174,254,41,2,198,172,1,38,13,174,140,105,113,112,106,105,114,115,251,
+139,1,112,254,144,1,112,255,255,0,80,255,226,4,136,7,10,2,38,1,57,0,0,0,7,
+4,200,0,152,0,0,0,2,0,80,255,226,4,136,5,212,0,23,0,31,0,0,1,35,17,35,17,
+35,17,35,17,37,55,5,17,5,7,37,17,51,53,51,21,51,53,51,1,55,23,17,5,7,39,17,
+4,136,130,110,130,117,253,175,44,1,153,2,81,44,254,103,117,130,110,130,251,
+225,58,86,1,14,58,82,1,209,1,10,254,246,1,10,253,7,223,115,158,5,62,223,115,
+158,254,41,227,227,227,254,15,104,50,2,153,158,104,48,253,103,0,3,0,120,0,
+0,3,212,5,212,0,11,0,15,0,19,0,0,1,37,17,35,17,39,17,35,17,1,17,51,1,35,17,
+51,1,35,17,51,3,212,254,152,140,220,140,2,208,140,253,78,130,130,2,138,130,
+130,3,120,196,251,196,4,137,120,254,139,2,72,254,116,1,110,251,78,1,214,254,
+42,1,214,255,255,0,80,255,230,3,219,7,10,2,38,1,60,0,0,0,6,4,200,102,0,0,
+3,0,80,255,230,3,219,5,208,0,7,0,11,0,15,0,0,19,5,17,1,7,37,17,1,1,7,39,55,
+19,7,39,55,164,1,56,1,255,61,254,202,253,255,1,51,75,235,75,215,75,235,75,
+1,114,168,5,6,254,228,112,175,250,243,1,28,3,185,106,163,107,254,18,106,163,
+107,0,1,0,120,0,0,3,212,5,182,0,27,0,0,1,23,17,51,17,37,17,33,21,33,17,33,
+21,33,53,33,17,33,53,33,17,39,17,35,17,5,17,51,2,108,220,140,254,152,1,64,
+254,192,1,104,252,164,1,104,254,192,1,64,220,140,1,104,140,4,93,121,1,110,
+253,194,196,254,78,120,254,202,120,120,1,54,120,1,255,120,254,139,2,72,198,
+1,12,0,255,255,0,120,0,0,3,212,7,10,2,38,1,63,0,0,0,6,4,200,102,0,0,1,0,120,
+0,0,3,212,5,182,0,31,0,0,33,33,53,33,17,33,53,33,17,35,17,35,17,51,17,51,
+17,51,17,51,17,51,17,35,17,35,17,33,21,33,17,33,3,212,252,164,1,104,254,192,
+1,64,220,140,140,220,140,220,140,140,220,1,64,254,192,1,104,120,1,14,120,
+1,204,254,217,2,184,254,231,1,116,254,140,1,26,253,71,1,39,254,52,120,254,
+242,0,1,0,90,0,0,3,241,5,182,0,33,0,0,1,21,51,17,51,17,51,53,51,17,35,53,
+35,17,22,18,19,35,2,39,17,35,17,6,3,35,18,18,55,17,35,21,35,17,1,4,220,140,
+220,140,140,220,163,196,30,130,43,216,140,211,48,131,29,199,162,220,140,5,
+91,211,1,46,254,210,212,253,221,215,254,108,28,254,207,254,239,1,165,61,254,
+0,2,0,61,254,91,1,12,1,54,28,1,148,215,2,34,0,0,3,0,120,0,0,4,8,5,182,0,29,
+0,36,0,43,0,0,33,33,53,33,17,46,2,53,52,54,54,55,53,33,53,33,21,33,21,30,
+2,21,20,6,6,7,17,33,3,52,38,39,17,54,54,37,20,22,23,17,6,6,3,238,252,214,
+1,54,121,174,91,94,174,118,254,202,3,42,254,152,120,173,93,94,174,118,1,104,
+114,128,118,119,127,253,136,129,117,119,127,120,1,25,10,98,154,91,89,154,
+99,11,235,120,120,235,12,99,155,87,90,154,99,10,254,231,2,122,103,117,12,
+254,48,12,119,101,102,118,12,1,208,12,119,0,255,255,0,120,0,0,3,212,7,10,
+2,38,1,67,0,0,0,6,4,200,99,0,0,2,0,120,0,0,3,212,5,182,0,30,0,33,0,0,19,5,
+17,33,53,33,21,33,17,37,17,37,17,33,21,33,21,33,21,33,53,33,53,33,53,33,17,
+5,39,37,37,1,53,7,182,1,42,254,152,3,92,254,152,1,102,254,154,1,64,254,192,
+1,104,252,164,1,104,254,192,1,64,254,214,59,1,58,254,198,2,213,194,4,167,
+186,1,81,120,120,254,183,228,253,81,227,254,211,120,240,120,120,240,120,1,
+53,185,94,199,200,254,192,241,121,0,1,0,120,0,0,3,212,5,182,0,39,0,0,1,33,
+17,23,17,51,17,37,21,33,21,33,21,33,21,33,53,33,53,33,53,33,17,39,17,35,17,
+5,53,33,53,33,53,33,53,33,21,33,21,33,3,112,254,252,220,140,254,152,1,4,254,
+252,1,44,253,28,1,44,254,252,1,4,220,140,1,104,254,252,1,4,254,212,2,228,
+254,212,1,4,4,68,254,205,109,1,70,253,254,176,244,120,180,120,120,180,120,
+1,57,108,254,179,2,12,178,238,120,130,120,120,130,0,255,255,0,130,255,230,
+3,246,7,10,2,38,1,70,0,0,0,6,4,200,127,0,0,2,0,130,255,230,3,246,5,182,0,
+18,0,30,0,0,1,33,17,22,18,21,16,2,35,34,2,17,52,18,55,17,33,53,33,1,20,22,
+51,50,54,53,52,38,35,34,6,3,236,254,155,175,192,234,203,205,232,194,173,254,
+135,3,106,253,44,152,143,146,153,153,146,142,153,5,72,254,228,26,254,227,
+231,254,250,254,222,1,38,1,5,230,1,28,25,1,28,110,252,91,211,224,220,209,
+208,222,221,0,0,2,0,80,255,243,4,24,5,182,0,16,0,19,0,0,1,33,17,33,1,1,7,
+1,1,39,1,1,33,17,33,53,33,1,55,33,3,231,254,132,1,134,254,147,1,148,104,254,
+132,254,132,104,1,147,254,148,1,104,254,162,3,102,254,77,195,254,122,5,62,
+254,229,254,38,253,250,80,1,238,254,18,80,2,6,1,218,1,27,120,252,251,250,
+0,0,4,0,88,0,0,3,208,5,208,0,18,0,22,0,26,0,30,0,0,1,6,6,35,34,38,39,55,22,
+22,23,17,5,7,39,17,54,54,55,3,17,51,17,33,17,51,17,51,17,51,17,3,208,46,217,
+180,183,219,43,132,26,119,97,1,191,61,246,97,116,26,40,130,252,226,130,204,
+130,3,86,217,213,208,217,42,160,162,19,3,170,228,112,129,253,42,21,166,153,
+252,133,1,101,254,155,1,101,254,155,1,101,254,155,0,255,255,0,120,0,0,3,150,
+7,10,2,38,1,74,0,0,0,6,4,200,71,0,0,6,0,120,0,0,3,150,5,182,0,16,0,22,0,28,
+0,32,0,36,0,40,0,0,1,20,6,35,34,38,53,17,51,17,51,17,51,17,51,17,51,1,20,
+22,23,17,35,1,54,54,53,53,35,19,17,51,17,33,17,51,17,51,17,51,17,3,143,203,
+190,189,202,140,187,130,187,140,253,124,97,90,187,1,61,91,96,187,204,130,
+252,226,130,204,130,3,64,191,207,207,191,2,118,254,130,1,126,254,130,1,126,
+253,137,119,136,16,1,144,254,112,17,138,116,129,252,64,1,101,254,155,1,101,
+254,155,1,101,254,155,0,5,0,80,0,0,3,237,5,182,0,15,0,28,0,32,0,36,0,40,0,
+0,1,53,33,53,33,17,5,53,51,17,37,21,33,21,33,21,37,22,22,51,50,55,51,6,6,
+35,34,38,39,1,17,51,17,33,17,51,17,33,17,51,17,1,218,254,212,1,44,1,92,130,
+254,174,1,44,254,212,254,117,35,160,131,245,74,141,54,239,167,179,236,50,
+1,143,130,254,48,130,2,26,130,2,129,205,110,1,151,148,247,254,75,147,216,
+110,205,92,120,119,239,173,186,185,174,253,35,1,51,254,205,1,51,254,205,1,
+51,254,205,0,255,255,0,196,255,240,3,172,7,10,2,38,1,77,0,0,0,6,4,200,121,
+0,0,3,0,196,255,240,3,172,5,202,0,27,0,36,0,40,0,0,55,54,55,38,17,16,55,38,
+39,55,22,23,54,55,23,6,7,22,17,16,7,22,23,7,38,39,6,7,19,16,23,54,17,16,39,
+6,6,19,35,17,51,196,162,108,210,209,90,179,18,209,145,142,212,18,179,90,209,
+211,107,164,18,208,146,146,208,182,172,172,172,90,82,237,130,130,105,50,70,
+200,1,52,1,55,194,56,67,121,67,96,95,68,121,66,57,192,254,199,254,203,199,
+70,50,121,61,99,99,61,2,237,254,247,164,166,1,7,1,8,163,85,210,254,240,1,
+63,0,0,2,0,101,0,0,4,139,5,212,0,23,0,32,0,0,1,39,17,35,32,36,53,52,54,36,
+51,51,53,33,21,37,55,23,17,51,21,33,17,5,1,34,6,21,20,22,51,51,17,4,98,231,
+144,254,217,254,180,153,1,20,174,28,254,217,254,157,48,177,130,1,39,1,156,
+254,51,209,233,229,213,49,4,122,122,251,12,234,210,136,206,112,218,197,176,
+110,92,1,93,236,1,10,225,254,23,176,158,156,168,2,146,0,0,3,0,80,0,0,4,33,
+5,182,0,16,0,19,0,22,0,0,1,1,33,17,51,17,35,17,33,1,21,33,53,1,1,53,33,1,
+33,3,3,19,33,3,168,254,185,1,62,130,130,254,193,1,72,252,168,1,100,254,156,
+3,88,253,98,1,232,245,1,243,254,26,5,151,253,123,1,9,253,134,1,3,253,123,
+31,31,2,189,2,187,31,250,184,1,223,1,29,1,222,0,255,255,0,120,0,0,4,164,7,
+10,2,38,1,81,0,0,0,7,4,200,0,204,0,0,0,2,0,120,0,0,4,164,5,182,0,19,0,23,
+0,0,1,2,2,7,17,35,17,38,2,3,51,22,18,23,17,51,17,54,18,55,1,35,17,51,4,164,
+26,243,195,140,199,241,24,140,20,172,137,130,133,170,24,253,69,130,130,5,
+152,254,234,254,178,26,252,230,3,26,23,1,72,1,31,231,254,249,23,2,35,253,
+222,24,1,9,227,251,123,1,112,0,0,3,0,120,0,0,4,59,5,182,0,20,0,28,0,38,0,
+0,1,35,17,35,17,35,32,36,53,52,54,55,38,53,16,33,51,17,51,17,51,1,20,22,23,
+17,35,6,6,17,20,22,22,23,55,17,14,2,4,59,130,152,144,254,250,254,237,121,
+121,242,2,25,144,152,130,252,201,190,211,12,189,200,78,153,158,12,163,155,
+83,1,107,1,92,253,57,205,196,120,185,57,88,242,1,113,253,137,1,106,252,232,
+139,137,5,2,79,7,158,2,35,91,110,56,6,1,1,255,4,51,104,0,255,255,0,180,255,
+230,4,52,7,10,2,38,1,84,0,0,0,7,4,200,0,182,0,0,0,1,0,180,255,230,4,52,5,
+182,0,27,0,0,37,62,3,53,17,51,17,20,6,6,35,34,46,2,53,17,51,17,20,30,2,23,
+17,51,2,181,90,98,47,8,140,90,200,161,123,171,103,48,140,8,47,98,90,130,97,
+10,74,117,153,88,3,155,252,121,243,232,110,63,124,204,194,3,135,252,101,88,
+153,116,75,10,5,85,0,5,0,120,0,0,3,212,5,182,0,7,0,11,0,15,0,19,0,23,0,0,
+1,1,17,35,17,1,17,51,1,17,51,17,33,17,51,17,33,17,51,17,1,17,51,17,3,212,
+253,48,140,2,208,140,254,17,130,254,48,130,2,26,130,254,48,130,2,76,1,137,
+254,139,2,72,254,116,1,110,251,118,1,201,254,55,1,201,254,55,1,201,254,55,
+4,126,1,56,254,200,255,255,0,95,255,230,3,64,7,10,2,38,1,87,0,0,0,6,4,200,
+17,0,0,1,0,120,255,230,3,48,5,182,0,17,0,0,19,33,17,51,17,1,21,35,17,51,17,
+5,17,33,21,35,17,51,250,1,170,140,253,202,130,130,1,170,254,86,130,130,4,
+120,1,62,250,48,1,10,240,2,152,254,218,205,3,101,199,2,32,0,0,3,0,145,255,
+230,3,221,5,208,0,19,0,40,0,44,0,0,1,50,22,22,18,18,21,16,35,34,39,6,35,34,
+38,53,52,18,18,54,19,20,51,50,54,53,52,2,2,35,34,2,2,21,20,22,51,50,53,53,
+51,3,17,51,17,2,55,72,122,100,78,50,251,127,44,62,109,126,125,68,117,149,
+153,116,57,49,84,130,73,73,129,85,51,55,116,130,130,130,5,208,111,206,254,
+198,254,114,119,254,146,112,112,167,199,203,1,195,1,75,163,251,127,241,123,
+123,238,1,252,1,26,254,225,253,247,220,134,112,241,85,1,24,1,96,254,160,255,
+255,0,80,255,230,4,70,7,10,2,38,1,90,0,0,0,7,4,200,0,134,0,0,0,3,0,80,255,
+230,4,70,5,208,0,23,0,37,0,51,0,0,1,35,17,37,55,5,17,35,53,51,53,35,53,51,
+17,5,7,37,17,51,21,35,21,51,1,38,38,53,52,54,55,23,6,6,21,20,22,23,37,54,
+54,53,52,38,39,55,22,22,21,20,6,7,3,9,120,254,53,61,1,2,120,120,120,120,1,
+205,61,254,252,120,120,120,1,4,89,111,102,93,62,63,64,62,65,252,10,65,62,
+65,62,62,93,102,111,89,2,64,253,166,248,112,140,1,126,110,150,110,2,30,248,
+112,139,254,191,110,150,254,219,46,187,103,105,175,55,100,36,124,75,73,124,
+36,40,36,124,73,76,124,35,100,55,176,104,103,187,46,0,2,0,80,0,0,4,55,5,208,
+0,23,0,35,0,0,19,52,54,51,50,22,23,51,17,5,7,39,17,37,17,35,17,5,17,35,2,
+35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,80,113,109,92,114,16,108,1,191,
+61,246,254,85,140,1,171,103,9,218,111,111,120,46,62,52,51,52,57,53,49,4,10,
+152,166,116,115,1,111,228,112,128,251,181,204,254,131,2,88,222,2,121,254,
+232,155,148,92,101,91,102,117,89,89,255,255,0,95,0,0,4,42,7,10,2,38,1,93,
+0,0,0,6,4,200,82,0,0,3,0,95,0,0,4,42,5,208,0,17,0,29,0,41,0,0,1,33,17,37,
+17,35,17,5,17,33,53,33,17,5,7,39,17,33,1,20,6,35,34,38,53,52,54,51,50,22,
+7,52,38,35,34,6,21,20,22,51,50,54,4,13,254,234,254,85,140,1,171,254,42,1,
+214,1,191,61,246,1,22,254,1,117,96,100,118,120,98,96,117,120,44,49,53,46,
+42,51,55,44,2,182,253,251,204,254,131,2,88,222,1,60,110,2,172,228,112,128,
+254,40,1,114,121,142,141,122,125,153,156,122,93,73,71,95,75,78,76,0,0,3,0,
+80,255,230,4,158,5,182,0,24,0,35,0,47,0,0,1,17,20,6,7,17,35,53,34,39,17,1,
+55,5,17,51,17,22,23,17,51,17,54,53,17,1,52,54,51,50,22,21,16,35,34,38,55,
+20,22,51,50,54,53,52,38,35,34,6,4,158,111,114,130,58,37,253,255,61,1,56,140,
+36,59,130,95,252,52,113,109,110,118,228,111,111,120,46,62,52,51,52,57,53,
+49,5,85,253,251,120,167,29,254,255,244,7,253,216,1,28,112,168,4,236,252,206,
+13,2,2,224,253,49,39,171,1,253,254,101,152,166,163,155,254,209,155,148,92,
+101,91,102,117,89,89,0,0,3,0,120,0,0,3,245,5,182,0,26,0,30,0,34,0,0,1,21,
+33,21,33,21,33,21,33,21,33,21,33,17,37,17,35,17,5,53,38,38,53,52,54,55,53,
+17,6,7,33,5,22,23,53,2,177,1,65,254,191,1,68,254,188,1,65,254,191,254,125,
+140,1,131,213,216,221,208,249,35,1,28,254,229,36,247,5,182,150,120,188,110,
+189,120,254,124,184,254,131,2,88,202,192,21,184,155,150,183,23,156,254,238,
+23,161,110,162,23,185,255,255,0,100,0,0,3,199,7,10,2,38,1,97,0,0,0,6,4,200,
+99,0,0,4,0,100,0,0,3,199,5,198,0,7,0,20,0,32,0,44,0,0,1,17,37,17,35,17,5,
+17,1,38,53,52,54,55,23,6,6,21,20,22,23,37,20,6,35,34,38,53,52,54,51,50,22,
+7,52,38,35,34,6,21,20,22,51,50,54,3,199,253,251,140,2,5,253,146,105,136,123,
+62,88,103,46,36,1,185,117,96,100,118,120,98,96,117,120,44,49,53,46,42,51,
+55,44,5,183,251,24,224,254,81,2,108,222,4,41,253,55,138,190,132,204,64,100,
+39,163,98,72,138,52,238,121,142,141,122,125,153,156,122,93,73,71,95,75,78,
+76,0,0,5,0,100,0,0,3,199,5,198,0,7,0,20,0,24,0,28,0,32,0,0,1,17,37,17,35,
+17,5,17,1,38,53,52,54,55,23,6,6,21,20,22,23,37,35,53,51,5,35,53,51,19,35,
+53,51,3,199,253,251,140,2,5,253,146,105,136,123,62,88,103,46,36,1,170,130,
+130,254,248,130,130,132,130,130,5,183,251,24,224,254,81,2,108,222,4,41,253,
+55,138,190,132,204,64,100,39,163,98,72,138,52,171,240,240,240,253,198,234,
+255,255,0,120,0,0,4,139,7,10,2,38,1,100,0,0,0,6,4,200,123,0,0,4,0,120,0,0,
+4,139,5,212,0,11,0,23,0,37,0,46,0,0,1,20,6,35,34,38,53,52,54,51,50,22,7,52,
+38,35,34,6,21,20,22,51,50,54,37,39,17,35,32,36,53,52,54,36,51,51,17,5,1,34,
+6,21,20,22,51,51,17,2,74,117,96,100,118,120,98,96,117,120,44,49,53,46,42,
+51,55,44,2,144,231,144,254,217,254,180,153,1,20,174,28,1,156,254,51,209,233,
+229,213,49,4,160,121,142,141,122,125,153,156,122,93,73,71,95,75,78,76,39,
+122,251,12,234,210,136,206,112,2,82,225,254,23,176,158,156,168,2,146,0,0,
+3,0,80,255,230,4,118,5,208,0,19,0,31,0,42,0,0,1,5,17,6,35,34,0,3,51,22,22,
+51,50,55,17,5,7,39,17,1,1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,
+21,20,22,51,50,1,126,1,56,39,41,243,254,232,11,140,4,209,181,41,39,1,192,
+61,247,253,255,1,62,89,81,83,91,94,80,80,90,93,39,38,40,41,35,41,82,1,114,
+168,1,236,6,1,56,1,24,227,245,9,2,159,229,112,126,250,237,1,28,3,186,105,
+113,113,105,110,120,124,106,73,61,61,73,51,72,0,0,1,0,80,0,0,3,156,5,182,
+0,18,0,0,1,19,51,1,33,17,51,17,35,17,33,1,35,3,3,35,1,1,51,1,167,213,131,
+254,255,1,28,130,130,254,228,1,1,131,213,212,131,1,22,254,234,131,3,135,2,
+47,253,92,1,9,253,134,1,3,253,92,2,47,253,209,2,219,2,219,255,255,0,80,255,
+230,3,240,7,10,2,38,1,104,0,0,0,6,4,200,97,0,0,1,0,80,255,230,3,240,5,182,
+0,30,0,0,1,6,6,35,34,38,39,55,18,23,17,51,17,23,51,50,54,54,53,17,51,17,20,
+6,6,35,35,39,17,54,19,3,240,44,233,184,183,240,44,133,48,215,140,9,9,66,60,
+25,140,56,121,104,14,14,207,53,1,139,203,218,216,205,50,254,208,41,5,82,253,
+17,1,34,83,114,1,152,254,84,133,133,65,1,254,21,42,1,47,0,0,2,0,120,0,0,4,
+48,5,208,0,31,0,43,0,0,1,33,17,35,17,33,53,33,53,33,53,33,53,38,38,53,52,
+54,54,51,50,22,21,20,6,7,21,33,21,33,21,33,1,20,22,51,50,54,53,52,38,35,34,
+6,4,19,254,137,140,254,137,1,119,254,167,1,89,189,219,113,214,150,223,252,
+216,188,1,89,254,167,1,119,252,231,182,165,163,182,180,165,166,181,1,29,254,
+227,1,29,110,145,110,182,13,174,140,98,150,81,177,152,141,173,13,182,110,
+145,2,252,105,113,112,106,105,114,115,0,255,255,0,120,0,0,3,244,7,10,2,38,
+1,107,0,0,0,6,4,200,124,0,0,3,0,120,0,0,3,244,5,208,0,24,0,37,0,41,0,0,19,
+52,54,54,51,50,22,22,21,20,6,7,17,35,53,33,53,33,53,33,53,33,53,38,38,55,
+20,22,51,50,54,53,52,38,38,35,34,6,1,35,17,51,120,112,204,131,132,202,111,
+198,175,140,254,158,1,98,254,158,1,98,176,203,130,175,142,139,176,77,142,
+96,143,174,2,141,130,130,4,55,115,189,105,104,189,116,158,208,19,253,74,215,
+110,145,110,113,17,207,162,123,155,156,122,83,138,78,170,251,232,1,164,0,
+0,2,0,40,0,0,3,163,5,208,0,21,0,33,0,0,33,17,33,53,33,53,33,53,33,17,1,7,
+37,17,33,21,33,21,33,21,33,17,1,38,38,53,52,54,55,23,6,21,20,23,1,164,254,
+192,1,64,254,192,1,64,1,255,61,254,202,1,82,254,174,1,82,254,174,254,195,
+104,99,109,115,48,142,121,1,108,110,190,110,2,202,254,228,112,175,254,19,
+110,190,110,254,148,3,109,44,148,90,94,154,42,103,55,132,121,57,0,255,255,
+0,80,0,0,3,143,7,10,2,38,1,110,0,0,0,6,4,200,42,0,0,1,0,80,0,0,3,143,5,208,
+0,21,0,0,33,17,33,53,33,17,33,53,33,17,1,7,37,17,33,21,33,17,33,21,33,17,
+1,144,254,192,1,64,254,192,1,64,1,255,61,254,202,1,82,254,174,1,82,254,174,
+1,138,110,1,4,110,2,102,254,228,112,175,254,119,110,254,252,110,254,118,0,
+0,1,0,100,0,0,4,23,5,208,0,36,0,0,33,17,6,6,7,39,54,54,55,53,38,38,39,55,
+22,22,23,17,5,7,39,17,54,55,23,6,6,7,21,22,22,23,7,38,38,39,17,1,248,99,148,
+33,124,44,213,147,131,188,53,120,38,129,85,1,127,61,182,174,79,120,55,192,
+126,149,210,44,123,30,144,106,1,177,25,203,162,39,201,248,25,191,22,192,150,
+44,116,147,22,2,106,192,112,93,254,106,44,240,42,159,186,21,191,23,249,203,
+38,157,204,29,254,79,0,2,0,80,0,0,4,3,5,208,0,26,0,30,0,0,1,33,17,22,22,23,
+7,38,38,35,34,6,7,39,54,54,55,17,33,53,33,17,5,7,39,17,33,1,35,17,51,3,176,
+254,192,149,210,44,123,38,185,129,127,185,36,124,44,213,147,254,192,1,64,
+1,191,61,246,1,64,254,187,130,130,3,72,254,228,23,249,203,38,192,207,215,
+184,39,201,248,25,1,28,120,2,16,228,112,129,254,195,252,64,1,49,0,255,255,
+0,100,0,0,4,122,7,10,2,38,1,114,0,0,0,7,4,200,0,172,0,0,0,2,0,100,0,0,4,122,
+5,182,0,23,0,39,0,0,1,6,2,7,17,37,17,35,17,5,17,38,2,39,51,22,22,23,17,51,
+17,54,54,55,1,23,51,50,54,53,52,38,39,55,22,21,20,6,35,39,4,122,41,236,176,
+254,128,140,1,128,179,234,40,140,30,159,124,140,117,160,33,254,68,13,13,116,
+121,19,12,127,34,195,172,26,5,103,237,254,236,24,253,229,174,254,31,2,168,
+172,1,82,22,1,18,241,177,214,24,1,238,254,19,25,212,177,251,82,1,118,115,
+42,77,20,36,78,97,157,187,1,0,4,0,100,0,0,4,52,5,208,0,9,0,15,0,19,0,23,0,
+0,1,39,17,37,17,35,17,5,17,5,37,17,37,55,23,17,1,35,17,51,1,35,17,51,3,247,
+155,254,55,140,1,201,1,100,253,132,254,197,58,127,1,84,130,130,254,92,130,
+130,4,171,81,251,181,204,254,131,2,88,222,4,86,181,123,252,225,183,104,73,
+2,73,254,93,1,34,254,222,1,34,0,2,0,80,0,0,3,140,5,182,0,23,0,27,0,0,33,17,
+35,53,51,53,35,53,51,17,5,17,51,17,37,17,51,21,35,21,51,21,35,17,1,35,17,
+51,1,74,250,250,250,250,1,92,130,254,174,248,248,248,248,1,182,130,130,1,
+148,110,150,110,2,57,148,1,11,254,55,147,254,134,110,150,110,254,108,1,40,
+2,56,0,255,255,0,80,0,0,4,57,7,10,2,38,1,118,0,0,0,7,4,200,0,149,0,0,0,1,
+0,80,0,0,4,57,5,182,0,19,0,0,1,37,17,5,7,37,17,35,17,39,17,37,55,23,17,5,
+17,5,53,51,4,12,254,184,1,117,54,254,193,140,173,254,197,58,127,1,47,1,82,
+130,3,255,155,254,221,187,107,158,253,17,3,52,86,253,93,183,104,73,2,153,
+152,1,180,176,244,0,0,3,0,80,255,247,3,246,5,182,0,10,0,18,0,21,0,0,19,33,
+21,1,1,7,1,1,39,1,1,19,55,23,17,5,7,39,17,3,23,55,180,2,222,254,223,1,133,
+94,254,139,254,139,94,1,132,254,224,26,58,189,1,69,53,142,196,160,160,5,182,
+49,254,173,254,61,79,1,182,254,74,79,1,195,1,83,251,72,104,114,2,83,189,94,
+79,253,173,5,81,186,186,0,255,255,0,120,255,230,4,219,7,10,2,38,1,121,0,0,
+0,7,4,200,0,234,0,0,0,5,0,120,255,230,4,219,5,208,0,26,0,33,0,39,0,44,0,49,
+0,0,1,39,2,2,35,34,38,2,17,53,55,39,17,35,17,23,18,54,51,50,22,18,17,7,23,
+17,51,1,20,22,22,23,17,39,5,52,38,38,39,17,17,54,54,55,39,3,6,6,7,23,4,219,
+244,13,156,150,111,142,67,1,111,130,247,19,152,144,113,142,66,1,111,130,253,
+25,22,51,44,117,1,107,22,50,44,58,55,2,115,130,58,53,4,115,1,162,126,254,
+204,254,250,142,1,52,1,61,67,65,58,254,49,2,152,130,1,2,228,139,254,211,254,
+197,63,57,1,223,254,161,243,225,137,26,2,119,61,59,237,212,131,27,253,222,
+253,75,35,227,242,59,2,166,33,201,186,60,0,7,0,80,0,0,4,75,5,208,0,9,0,21,
+0,33,0,45,0,55,0,65,0,75,0,0,37,37,17,35,17,5,17,5,7,39,5,20,6,35,34,38,53,
+52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,3,20,6,35,34,38,53,52,54,
+51,50,22,7,52,38,35,34,6,21,20,51,50,19,52,38,35,34,6,21,20,51,50,37,52,38,
+35,34,6,21,20,51,50,3,99,253,251,140,2,5,1,116,61,171,253,255,71,64,66,73,
+73,66,63,72,1,64,71,64,66,73,73,66,63,72,160,71,64,66,73,73,66,63,72,86,24,
+26,27,25,48,54,160,24,26,27,25,48,54,254,192,24,26,27,25,48,54,207,224,254,
+81,2,108,222,4,66,189,112,90,5,86,95,93,88,87,103,105,85,86,95,93,88,87,103,
+105,253,254,86,95,93,88,87,103,105,84,58,45,45,58,96,2,13,58,45,45,58,96,
+96,58,45,45,58,96,255,255,0,100,0,0,3,221,7,10,2,38,1,124,0,0,0,6,4,200,74,
+0,0,4,0,100,0,0,3,221,5,208,0,9,0,13,0,17,0,21,0,0,1,7,39,17,37,17,35,17,
+5,17,3,35,53,51,5,35,53,51,19,35,53,51,3,221,61,171,253,251,140,2,5,121,130,
+130,254,248,130,130,132,130,130,5,19,112,90,251,210,224,254,81,2,108,222,
+4,66,254,198,240,240,240,253,198,234,0,255,255,0,80,255,230,3,251,7,10,2,
+38,1,126,0,0,0,6,4,200,105,0,0,4,0,80,255,230,3,251,5,208,0,29,0,37,0,45,
+0,53,0,0,19,54,55,38,53,52,55,38,39,53,22,4,23,54,36,55,21,6,7,22,21,20,7,
+22,23,21,36,39,6,5,5,21,39,55,23,53,5,7,3,21,39,55,23,53,5,7,1,20,23,54,53,
+52,39,6,80,182,156,138,134,142,192,108,1,2,103,103,1,2,109,194,141,135,138,
+157,181,254,233,191,192,254,235,2,20,255,32,118,1,2,36,119,255,32,118,1,2,
+36,254,195,139,140,140,139,1,222,12,44,92,115,114,89,40,20,114,10,54,42,41,
+55,10,114,20,40,89,114,115,92,44,12,114,26,77,77,26,138,252,113,107,46,252,
+126,105,4,121,245,113,107,46,245,126,105,253,252,89,68,68,89,88,65,66,0,0,
+3,0,80,255,235,4,65,5,210,0,26,0,34,0,42,0,0,55,54,18,53,52,2,39,55,22,19,
+33,54,18,55,23,6,2,21,20,18,23,7,36,3,33,2,5,1,17,39,55,23,17,23,7,3,17,39,
+55,23,17,23,7,80,111,118,115,114,82,252,30,1,24,16,136,131,82,114,115,118,
+111,82,254,230,5,254,241,5,254,230,1,183,242,32,100,242,36,26,242,32,100,
+242,36,167,100,1,18,191,190,1,19,99,100,215,254,170,169,1,20,112,100,99,254,
+237,190,191,254,238,100,100,239,1,157,254,99,239,1,33,254,135,117,107,40,
+1,121,117,105,3,220,254,135,117,107,40,1,121,117,105,0,4,0,80,0,0,4,86,5,
+208,0,9,0,23,0,37,0,51,0,0,1,17,35,17,5,17,5,7,39,17,1,34,6,21,20,22,51,21,
+38,38,53,52,54,55,37,34,6,21,20,22,51,21,38,38,53,52,54,55,17,34,6,21,20,
+22,51,21,38,38,53,52,54,55,1,105,140,2,5,1,116,61,171,253,241,74,82,85,71,
+129,142,147,124,1,44,72,60,64,68,118,124,129,113,72,60,64,68,118,124,129,
+113,1,175,254,81,2,108,222,4,66,189,112,90,251,210,3,161,59,51,54,55,111,
+7,113,100,98,119,4,87,43,41,43,40,105,6,97,85,85,100,4,253,213,43,41,43,40,
+105,6,97,85,85,100,4,0,0,6,0,80,0,0,4,109,5,212,0,11,0,18,0,22,0,26,0,30,
+0,34,0,0,1,39,17,35,32,36,53,52,54,55,17,5,1,20,22,23,17,6,6,37,35,53,51,
+5,35,53,51,1,35,53,51,5,35,53,51,4,68,231,51,255,0,254,208,253,218,1,156,
+253,25,169,162,160,171,2,168,130,130,252,164,130,130,3,92,130,130,252,164,
+130,130,4,122,122,251,12,238,206,176,238,31,2,91,225,252,201,133,163,21,2,
+131,23,169,142,230,230,230,253,38,230,230,230,255,255,0,100,255,230,4,52,
+7,10,2,38,1,131,0,0,0,7,4,200,0,149,0,0,0,4,0,100,255,230,4,52,5,182,0,13,
+0,17,0,21,0,25,0,0,33,35,17,35,17,37,55,23,17,51,17,51,17,51,1,35,17,51,19,
+35,17,51,19,33,53,33,4,52,140,202,254,65,61,246,140,202,140,252,208,130,130,
+224,130,130,30,254,98,1,158,2,228,253,2,248,112,132,4,236,253,166,2,90,253,
+253,1,161,254,95,1,161,253,104,120,0,0,3,0,120,0,0,4,149,5,212,0,17,0,25,
+0,31,0,0,1,39,17,55,23,5,17,35,32,36,53,52,54,36,51,51,17,5,1,34,6,21,20,
+23,1,53,17,17,1,22,22,51,4,98,231,216,66,254,230,144,254,217,254,180,153,
+1,20,174,28,1,156,254,51,209,233,15,1,220,254,93,55,193,122,4,122,122,253,
+255,145,95,189,253,152,234,210,136,206,112,2,82,225,254,23,176,158,58,45,
+1,64,117,253,110,1,146,254,232,61,61,255,255,0,80,255,230,4,53,7,10,2,38,
+1,134,0,0,0,7,4,200,0,149,0,0,0,3,0,80,255,230,4,53,5,208,0,23,0,33,0,42,
+0,0,1,18,54,51,50,22,18,17,16,2,6,35,34,38,2,17,53,55,39,17,37,55,23,17,1,
+50,54,54,55,37,21,16,22,22,19,16,38,38,35,34,6,7,5,1,185,19,153,143,114,142,
+65,68,144,111,111,142,67,1,81,254,238,58,86,2,18,64,77,38,3,254,150,35,77,
+251,35,79,69,86,84,8,1,105,3,231,1,5,228,141,254,208,254,202,254,211,254,
+198,144,142,1,52,1,61,60,59,43,253,103,160,104,50,2,153,252,1,99,200,202,
+191,45,254,227,240,122,2,127,1,29,234,116,189,253,196,0,3,0,80,255,230,4,
+22,5,208,0,18,0,25,0,29,0,0,19,23,17,5,7,39,17,22,23,55,23,7,22,21,20,4,7,
+17,37,1,52,39,1,21,54,54,3,38,39,21,141,246,1,191,61,246,179,126,132,82,116,
+100,254,231,222,254,65,3,52,58,254,197,173,200,159,78,136,1,78,132,5,6,228,
+112,129,254,252,12,63,128,82,113,93,139,153,208,14,254,218,248,1,165,89,58,
+254,207,98,10,137,1,64,31,12,252,255,255,0,80,0,0,4,40,7,10,2,38,1,137,0,
+0,0,6,4,200,119,0,0,1,0,80,0,0,4,40,5,208,0,29,0,0,1,35,17,37,17,35,17,5,
+53,35,53,51,17,39,17,37,55,23,17,5,17,5,7,39,21,5,7,39,21,51,3,182,193,254,
+128,140,1,128,188,188,254,254,229,32,121,1,128,1,191,61,246,1,29,36,249,193,
+2,132,254,95,174,254,111,2,88,172,216,110,1,12,91,254,108,125,107,48,1,137,
+139,1,85,228,112,130,181,103,110,88,218,0,0,2,0,120,0,0,4,20,5,208,0,25,0,
+29,0,0,1,39,21,51,21,35,21,51,21,35,17,37,17,35,17,5,17,35,53,51,53,35,53,
+51,17,5,1,35,17,51,3,215,246,223,223,223,223,254,128,140,1,128,248,248,248,
+248,1,191,252,230,130,130,4,124,130,204,110,170,110,254,55,174,254,111,2,
+88,172,1,0,110,170,110,1,158,228,253,176,2,40,0,255,255,0,80,255,230,3,253,
+7,10,2,38,1,140,0,0,0,6,4,200,108,0,0,1,0,80,255,230,3,253,5,208,0,24,0,0,
+19,51,50,54,53,52,38,35,35,53,51,50,23,53,1,7,37,17,1,55,5,17,6,35,35,80,
+64,160,185,183,162,64,49,250,131,1,255,61,254,202,253,255,61,1,56,130,251,
+49,3,76,120,108,107,122,110,116,193,254,228,112,175,250,243,1,28,112,168,
+2,134,115,0,4,0,180,255,230,4,9,5,208,0,3,0,19,0,35,0,39,0,0,1,35,17,51,5,
+16,2,6,35,34,38,2,17,16,18,54,51,50,22,18,3,16,38,38,35,34,6,6,17,16,22,22,
+51,50,54,54,1,17,51,17,3,9,130,130,1,0,68,144,111,111,142,67,68,140,114,113,
+142,66,140,35,79,69,69,77,34,35,77,68,69,79,35,253,55,130,2,38,1,141,214,
+254,211,254,198,144,142,1,52,1,61,1,49,1,45,141,139,254,211,254,197,1,29,
+234,116,116,231,254,232,254,227,240,122,118,235,254,179,4,230,251,26,0,0,
+5,0,140,255,230,3,207,5,208,0,25,0,36,0,45,0,49,0,53,0,0,37,17,35,14,2,35,
+34,46,2,17,53,52,62,2,51,50,22,22,23,51,17,51,17,1,33,21,20,22,22,51,50,54,
+54,53,17,52,38,38,35,34,6,6,21,17,33,17,33,1,51,17,35,3,77,144,6,58,119,98,
+78,105,65,32,30,65,108,79,96,120,58,5,144,130,254,100,254,229,27,60,53,54,
+61,28,27,61,55,52,61,27,1,27,254,229,1,167,142,142,114,1,129,209,210,106,
+67,131,234,1,6,145,253,225,132,65,101,201,187,1,113,251,26,1,129,19,168,145,
+73,71,142,168,2,12,156,142,71,68,139,162,254,132,1,4,254,252,1,4,255,255,
+0,80,0,0,4,62,7,10,2,38,1,144,0,0,0,6,4,200,119,0,0,4,0,80,0,0,4,62,5,208,
+0,9,0,21,0,33,0,45,0,0,1,7,39,17,37,17,35,17,5,17,3,35,21,35,53,35,53,51,
+53,51,21,51,5,22,22,51,50,55,23,6,35,34,38,39,17,54,54,51,50,23,7,38,35,34,
+6,7,4,62,61,171,253,251,140,2,5,138,153,120,153,153,120,153,254,122,23,82,
+77,121,51,105,89,188,111,136,41,41,136,111,188,89,105,51,121,77,82,23,5,19,
+112,90,251,210,224,254,81,2,108,222,4,66,254,38,130,130,100,124,124,218,59,
+61,120,44,196,103,93,1,162,93,103,196,44,120,61,59,0,3,0,80,0,0,4,52,5,208,
+0,9,0,22,0,35,0,0,1,7,39,17,37,17,35,17,5,17,1,22,51,50,54,55,23,6,6,35,34,
+38,39,19,22,51,50,54,55,23,6,6,35,34,38,39,4,52,61,171,253,251,140,2,5,254,
+4,19,123,48,57,27,115,23,131,93,106,135,17,116,19,123,48,57,27,115,23,131,
+93,106,135,17,5,19,112,90,251,210,224,254,81,2,108,222,4,66,254,80,140,57,
+83,14,118,128,129,117,1,118,140,57,83,14,118,128,129,117,255,255,0,80,255,
+230,3,226,7,10,2,38,1,147,0,0,0,6,4,200,89,0,0,1,0,80,255,230,3,226,5,208,
+0,15,0,0,19,5,17,37,55,5,53,37,55,5,17,1,7,37,17,1,171,1,56,254,109,61,1,
+86,254,109,61,1,86,1,255,61,254,202,253,255,1,114,168,1,84,231,115,196,250,
+231,115,196,1,140,254,228,112,175,250,243,1,28,0,1,0,80,0,0,3,216,5,208,0,
+17,0,0,1,39,17,37,17,35,17,5,53,1,55,5,53,1,55,5,17,5,3,155,246,254,85,140,
+1,171,254,55,61,1,140,254,55,61,1,140,1,191,4,124,128,251,181,204,254,131,
+2,88,222,243,1,6,115,227,160,1,6,115,227,1,151,228,0,3,0,100,255,230,4,16,
+5,208,0,7,0,11,0,15,0,0,1,5,17,5,7,39,17,1,19,35,17,51,19,35,17,51,1,25,1,
+56,1,191,61,246,253,255,10,130,130,235,130,130,1,114,168,5,6,228,112,129,
+250,233,1,28,1,142,2,148,253,108,2,148,255,255,0,80,255,230,4,76,7,10,2,38,
+1,151,0,0,0,7,4,200,0,129,0,0,0,4,0,80,255,230,4,76,5,208,0,7,0,20,0,33,0,
+46,0,0,1,5,17,5,7,39,17,1,3,22,51,50,54,55,23,6,6,35,34,38,39,19,22,51,50,
+54,55,23,6,6,35,34,38,39,19,22,51,50,54,55,23,6,6,35,34,38,39,1,85,1,56,1,
+191,61,246,253,255,84,19,123,48,57,27,115,23,131,93,106,135,17,116,19,123,
+48,57,27,115,23,131,93,106,135,17,116,19,123,48,57,27,115,23,131,93,106,135,
+17,1,114,168,5,6,228,112,129,250,233,1,28,4,154,140,57,83,14,118,128,129,
+117,254,216,140,57,83,14,118,128,129,117,254,216,140,57,83,14,118,128,129,
+117,0,4,0,80,255,230,4,76,5,208,0,7,0,20,0,24,0,28,0,0,1,5,17,5,7,39,17,1,
+3,22,51,50,54,55,23,6,6,35,34,38,39,55,35,17,51,19,35,17,51,1,85,1,56,1,191,
+61,246,253,255,84,19,123,48,57,27,115,23,131,93,106,135,17,191,130,130,254,
+130,130,1,114,168,5,6,228,112,129,250,233,1,28,2,126,140,57,83,14,118,128,
+129,117,110,1,124,254,132,1,124,0,255,255,0,80,255,230,4,6,7,10,2,38,1,154,
+0,0,0,6,4,200,105,0,0,4,0,80,255,230,4,6,5,208,0,18,0,22,0,26,0,30,0,0,1,
+54,53,52,38,39,17,1,55,5,17,5,7,39,17,22,22,21,7,1,35,17,51,3,35,17,51,19,
+33,53,33,3,123,6,95,79,253,255,61,1,56,1,191,61,246,143,161,4,253,209,130,
+130,224,130,130,254,254,98,1,158,1,154,40,37,97,152,24,252,238,1,28,112,168,
+5,6,228,112,129,254,108,26,204,156,66,1,170,1,191,254,65,1,191,253,74,120,
+0,0,1,0,100,0,0,4,23,5,182,0,41,0,0,1,37,21,22,22,23,7,38,38,39,17,35,17,
+6,6,7,39,54,54,55,17,39,17,35,17,5,53,38,3,51,22,51,50,55,51,6,6,7,21,23,
+17,51,3,236,254,147,153,212,43,123,31,146,108,130,103,150,32,124,47,212,150,
+225,140,1,109,236,61,139,30,196,186,33,140,29,151,117,225,140,2,96,174,245,
+23,251,202,38,161,204,26,254,98,1,158,24,206,161,39,206,246,23,1,51,107,254,
+189,2,22,176,142,36,1,42,219,219,146,171,18,203,108,1,60,0,255,255,0,100,
+255,239,4,23,7,10,2,38,1,157,0,0,0,6,4,200,126,0,0,2,0,100,255,239,4,23,5,
+182,0,55,0,66,0,0,1,33,21,22,22,23,7,38,38,39,17,35,17,6,6,7,39,54,54,55,
+53,35,34,38,53,52,54,51,51,53,38,3,51,22,51,50,55,51,6,6,7,21,51,50,54,53,
+53,51,21,20,6,6,35,35,21,33,37,20,22,22,51,51,53,35,34,6,6,3,212,254,171,
+153,212,43,123,31,146,108,130,103,150,32,124,47,212,150,66,175,168,158,171,
+80,236,61,139,30,196,186,33,140,29,151,117,137,50,34,130,32,75,68,176,1,85,
+253,18,40,82,91,66,66,100,76,37,2,47,62,23,251,202,38,161,204,26,254,138,
+1,118,24,206,161,39,206,246,23,62,114,116,120,107,112,36,1,42,219,219,146,
+171,18,111,41,53,39,39,100,78,36,217,110,42,48,20,217,20,44,0,4,0,100,255,
+230,3,236,5,208,0,25,0,39,0,53,0,61,0,0,1,6,7,22,21,16,2,35,34,2,17,52,55,
+38,39,51,22,23,54,54,51,50,22,23,54,55,1,20,22,51,50,54,53,52,39,6,35,34,
+39,6,3,22,22,51,50,54,55,23,6,6,35,34,38,39,1,34,7,22,51,50,55,38,3,236,35,
+74,24,198,169,169,198,23,79,29,139,9,19,49,146,90,89,144,49,18,10,253,231,
+121,104,114,115,5,93,128,134,90,4,102,43,170,118,112,170,44,120,65,229,152,
+164,224,60,1,188,148,52,77,126,125,75,53,5,145,189,111,105,129,254,235,254,
+187,1,73,1,20,121,104,112,194,83,54,96,104,101,92,58,72,253,237,242,243,246,
+233,49,72,55,52,52,253,128,103,117,117,106,54,141,148,152,132,4,86,221,73,
+77,217,255,255,0,100,255,249,4,23,7,10,2,38,1,160,0,0,0,7,4,200,0,128,0,0,
+0,2,0,100,255,249,4,23,5,208,0,42,0,54,0,0,1,37,21,22,22,23,7,38,38,39,17,
+35,17,6,6,7,39,54,54,55,53,39,17,35,17,5,53,38,38,53,52,54,51,50,22,21,20,
+6,7,21,23,17,51,37,20,22,51,50,54,53,52,38,35,34,6,3,236,254,147,153,212,
+43,123,31,146,108,130,103,150,32,124,47,212,150,225,140,1,109,113,143,178,
+140,139,185,140,116,225,140,253,147,101,82,86,113,112,87,83,100,1,213,174,
+136,23,251,202,38,161,204,26,254,128,1,128,24,206,161,39,206,246,23,198,107,
+254,189,2,22,176,142,16,137,94,105,147,147,105,90,138,18,205,108,1,60,246,
+64,80,82,62,60,79,78,0,2,0,100,0,0,4,48,5,182,0,23,0,35,0,0,55,18,18,55,17,
+5,17,51,17,37,21,22,18,19,7,38,2,39,17,35,17,6,2,7,1,6,6,35,34,38,39,51,22,
+51,50,55,100,21,212,172,1,171,140,254,85,175,218,24,137,13,146,126,130,118,
+142,13,2,145,41,173,128,130,177,41,137,48,163,156,48,60,1,8,1,82,33,1,159,
+172,2,12,253,43,174,214,26,254,176,254,237,30,228,1,32,29,253,193,2,60,33,
+254,231,228,5,134,132,139,136,135,151,151,0,2,0,140,255,230,4,129,5,208,0,
+15,0,34,0,0,1,37,2,2,35,32,17,16,18,51,50,18,17,23,17,51,37,5,2,38,35,34,
+6,6,21,20,18,22,51,50,18,19,39,17,35,4,129,254,238,16,184,167,254,140,186,
+186,187,184,140,130,253,78,1,22,7,111,113,85,100,45,46,100,84,120,110,3,150,
+130,1,97,226,254,197,254,222,2,255,1,129,1,106,254,155,254,113,121,1,200,
+30,242,1,25,232,127,253,247,254,254,251,132,1,10,1,76,124,254,69,0,255,255,
+0,120,0,0,4,83,7,10,2,38,1,164,0,0,0,7,4,200,0,165,0,0,0,5,0,120,0,0,4,83,
+5,182,0,11,0,18,0,22,0,26,0,30,0,0,1,36,36,53,52,54,36,55,53,51,17,35,1,20,
+22,23,17,6,6,37,35,17,51,17,35,17,51,17,35,17,51,2,182,254,238,254,212,146,
+1,8,164,140,140,254,78,221,213,208,226,3,79,130,130,130,130,130,130,1,91,
+11,230,202,132,204,113,4,219,250,74,3,22,152,169,3,2,146,2,178,106,1,4,253,
+98,1,4,253,98,1,4,0,0,1,0,100,0,0,4,48,5,208,0,45,0,0,1,21,20,22,23,17,52,
+38,35,34,6,7,39,54,54,51,50,22,21,17,54,17,53,51,6,6,7,21,20,6,35,34,39,17,
+35,17,51,4,51,50,54,53,53,38,38,39,1,243,78,76,87,99,71,157,61,78,104,190,
+99,159,141,141,138,11,137,131,101,101,106,188,140,33,1,51,94,37,25,140,144,
+8,4,74,38,129,169,27,1,120,129,128,97,83,71,125,104,185,185,254,130,56,1,
+7,43,238,229,21,164,134,125,125,254,200,2,8,213,86,78,138,22,238,229,0,255,
+255,0,120,255,240,3,248,7,10,2,38,1,167,0,0,0,6,4,200,121,0,0,4,0,120,255,
+240,3,248,5,202,0,37,0,46,0,51,0,55,0,0,19,51,54,55,38,39,55,22,23,54,55,
+23,6,7,22,23,51,21,35,22,21,16,7,22,23,7,38,39,6,7,39,54,55,38,17,52,55,35,
+5,16,23,54,17,52,39,33,6,19,6,7,33,38,3,35,53,51,120,167,50,128,90,179,18,
+209,145,142,212,18,179,90,127,50,168,143,7,211,107,164,18,208,146,146,208,
+18,162,108,210,6,142,1,20,172,172,8,254,183,7,172,92,43,1,14,42,38,110,110,
+3,189,163,118,56,67,121,67,96,95,68,121,66,57,119,162,120,58,46,254,203,199,
+70,50,121,61,99,99,61,121,50,70,200,1,52,54,50,104,254,247,164,166,1,7,54,
+50,58,1,125,86,117,114,253,219,213,0,0,4,0,120,255,230,4,26,5,208,0,25,0,
+39,0,47,0,51,0,0,19,52,55,38,39,51,22,23,54,51,50,23,54,55,51,6,7,22,21,21,
+16,2,35,34,2,17,23,20,18,51,50,18,53,17,39,6,35,34,39,7,55,50,55,2,35,34,
+3,22,19,35,17,51,193,16,79,10,140,4,14,102,205,205,102,13,5,140,12,77,16,
+204,188,188,204,140,130,122,123,129,1,102,149,148,103,1,250,154,81,53,180,
+181,53,82,217,130,130,3,89,115,100,148,242,91,77,194,194,75,93,243,148,100,
+114,252,254,210,254,183,1,73,1,46,10,245,255,0,1,2,243,1,16,55,73,75,28,73,
+124,1,19,254,237,124,253,189,1,41,255,255,0,80,255,230,3,229,7,10,2,38,1,
+170,0,0,0,6,4,200,105,0,0,2,0,80,255,230,3,229,5,182,0,35,0,41,0,0,1,21,20,
+6,7,17,35,17,38,39,17,37,55,23,17,51,17,22,23,17,51,17,54,54,53,53,51,21,
+20,6,7,17,54,54,53,53,37,38,39,17,22,23,3,229,126,139,130,109,66,254,165,
+64,143,140,76,99,130,77,58,130,126,139,77,58,254,247,109,66,76,99,3,67,207,
+156,140,11,254,191,1,64,2,8,254,156,240,100,97,4,221,254,55,11,4,1,149,254,
+108,7,96,102,199,207,156,140,11,254,62,7,96,102,199,45,2,8,254,67,11,4,0,
+3,0,120,255,230,4,26,5,208,0,25,0,39,0,47,0,0,19,52,55,38,39,51,22,23,54,
+51,50,23,54,55,51,6,7,22,21,21,16,2,35,34,2,17,23,20,18,51,50,18,53,17,39,
+6,35,34,39,7,55,50,55,2,35,34,3,22,193,16,79,10,140,4,14,102,205,205,102,
+13,5,140,12,77,16,204,188,188,204,140,130,122,123,129,1,102,149,148,103,1,
+250,154,81,53,180,181,53,82,3,89,115,100,148,242,91,77,194,194,75,93,243,
+148,100,114,252,254,210,254,183,1,73,1,46,10,245,255,0,1,2,243,1,16,55,73,
+75,28,73,124,1,19,254,237,124,0,255,255,0,140,255,230,3,156,7,10,2,38,1,173,
+0,0,0,6,4,200,89,0,0,4,0,140,255,230,3,156,5,208,0,13,0,21,0,28,0,34,0,0,
+19,16,18,51,50,18,17,21,16,2,35,34,2,17,1,50,18,53,53,5,22,22,19,34,7,1,53,
+52,2,1,23,37,1,6,21,140,203,189,188,204,204,188,188,204,1,136,123,129,254,
+26,24,120,90,167,57,1,220,130,254,138,3,1,163,254,96,6,3,89,1,45,1,74,254,
+183,254,210,252,254,210,254,183,1,73,1,46,254,1,1,2,243,28,252,136,141,4,
+250,232,254,183,60,245,1,0,252,251,95,217,1,31,66,71,0,0,3,0,140,255,230,
+3,156,5,208,0,13,0,22,0,31,0,0,19,16,18,51,50,18,17,21,16,2,35,34,2,17,1,
+50,18,53,53,33,21,20,18,3,33,53,52,2,35,34,2,21,140,203,189,188,204,204,188,
+188,204,1,136,123,129,254,8,130,130,1,248,130,122,123,129,3,89,1,45,1,74,
+254,183,254,210,252,254,210,254,183,1,73,1,46,254,1,1,2,243,79,79,245,255,
+0,2,188,73,245,1,0,254,254,243,0,0,1,0,140,0,0,4,54,5,208,0,25,0,0,1,33,17,
+37,17,35,17,5,17,33,53,33,53,33,53,33,17,5,7,37,21,33,21,33,21,33,4,1,254,
+194,254,85,140,1,171,254,192,1,64,254,192,1,64,1,255,61,254,202,1,62,254,
+194,1,62,2,152,254,25,204,254,131,2,88,222,1,30,110,140,110,1,208,255,112,
+155,252,110,140,0,255,255,0,80,0,0,3,137,7,10,2,38,1,177,0,0,0,6,4,200,69,
+0,0,3,0,80,0,0,3,137,5,182,0,30,0,43,0,56,0,0,33,34,36,53,52,54,55,38,38,
+53,52,54,54,51,21,6,6,21,20,22,22,51,51,21,35,34,6,21,20,22,23,1,38,38,53,
+52,54,55,23,6,6,21,20,23,3,38,38,53,52,54,55,23,6,6,21,20,23,3,125,240,254,
+246,107,113,103,117,122,228,156,177,199,81,158,106,43,43,162,183,191,185,
+253,178,108,115,122,101,40,72,71,138,35,108,115,122,101,40,72,71,138,221,
+191,114,190,54,46,173,101,107,170,95,114,3,134,121,72,115,66,130,156,139,
+142,153,3,2,164,30,147,109,111,166,27,105,23,107,69,141,39,252,218,30,147,
+109,111,166,27,105,23,107,69,141,39,0,0,4,0,100,0,0,3,222,5,210,0,36,0,45,
+0,49,0,53,0,0,1,34,6,21,20,22,51,51,21,35,34,38,53,52,55,38,53,52,55,38,38,
+53,52,54,51,50,22,21,20,6,7,6,21,20,22,51,23,1,20,33,32,53,52,33,34,6,3,35,
+17,51,53,35,17,51,3,47,166,181,179,178,88,98,231,246,152,147,68,131,141,230,
+196,195,230,205,180,132,148,141,53,253,222,1,40,1,39,254,217,148,148,49,120,
+120,120,120,2,10,115,104,97,86,120,158,145,167,90,64,138,101,68,27,146,99,
+130,157,156,131,125,153,8,35,118,64,67,1,2,59,174,174,175,90,251,111,1,11,
+173,1,11,0,255,255,0,60,255,231,4,36,7,10,2,38,1,180,0,0,0,6,4,200,114,0,
+0,2,0,60,255,231,4,36,5,208,0,21,0,43,0,0,19,38,17,53,16,18,51,50,18,17,21,
+2,7,23,7,39,6,35,34,39,7,39,1,54,53,53,16,2,35,34,2,17,21,20,23,55,23,7,22,
+51,50,55,39,55,213,94,235,207,209,232,2,91,151,109,125,103,162,164,102,126,
+109,2,249,41,159,144,144,156,40,90,109,133,70,124,123,72,132,109,1,28,179,
+1,82,30,1,52,1,93,254,161,254,198,38,254,182,174,236,70,194,95,98,197,70,
+1,116,134,229,43,1,5,1,28,254,232,254,255,30,253,130,141,70,208,87,88,207,
+70,0,1,0,80,0,23,4,112,5,182,0,33,0,0,55,54,54,55,17,5,53,38,38,39,51,22,
+22,51,50,19,51,6,6,7,17,37,21,55,50,22,23,7,38,38,35,34,6,7,80,38,158,111,
+1,27,153,205,44,132,38,153,109,227,78,131,40,169,127,254,229,37,174,251,48,
+123,38,185,129,127,185,36,62,167,227,51,1,249,206,205,11,235,205,163,169,
+1,76,184,227,30,254,54,205,228,2,253,228,38,192,207,215,184,255,255,0,80,
+0,0,4,124,7,10,2,38,1,183,0,0,0,7,4,200,0,168,0,0,0,1,0,80,0,0,4,124,5,182,
+0,25,0,0,1,2,2,7,17,35,17,39,17,35,17,5,53,38,2,3,51,22,18,23,17,51,17,54,
+18,55,4,124,26,243,195,140,227,140,1,111,199,241,24,140,20,172,137,130,133,
+170,24,5,152,254,234,254,178,26,252,230,1,166,98,254,91,2,118,171,236,23,
+1,72,1,31,231,254,249,23,2,35,253,222,24,1,9,227,0,1,0,80,255,226,4,84,5,
+208,0,26,0,0,37,55,23,17,23,38,35,34,7,23,7,39,17,37,55,23,17,23,54,51,50,
+22,23,23,7,39,17,2,28,64,150,147,86,159,143,84,219,64,150,254,158,64,150,
+37,116,211,159,208,41,42,64,150,214,100,103,4,77,97,153,140,150,100,103,251,
+169,244,100,103,4,87,26,192,197,186,27,100,103,251,169,0,255,255,0,80,0,0,
+4,75,7,10,2,38,1,186,0,0,0,7,4,200,0,148,0,0,0,1,0,80,0,0,4,75,5,208,0,25,
+0,0,1,23,17,5,7,39,17,37,17,35,17,5,17,39,17,35,17,39,17,39,55,23,17,5,53,
+51,2,81,134,1,116,61,171,253,251,140,2,5,134,130,136,247,32,95,1,0,130,4,
+136,61,1,133,189,112,90,251,210,224,254,81,2,108,222,2,67,58,254,217,1,95,
+59,254,135,117,107,40,1,121,116,244,0,1,0,120,0,0,3,212,5,182,0,27,0,0,33,
+17,39,17,35,17,5,17,5,17,51,17,37,17,23,17,51,17,23,17,51,17,39,21,35,17,
+39,17,1,143,139,140,1,23,1,92,130,254,174,85,130,86,140,226,130,85,2,149,
+76,254,139,2,72,154,2,37,148,1,11,254,55,147,254,77,46,1,34,254,150,47,1,
+110,253,194,123,217,1,32,46,253,184,0,255,255,0,80,255,226,3,73,7,10,2,38,
+1,189,0,0,0,6,4,200,26,0,0,2,0,80,255,226,3,0,5,182,0,5,0,9,0,0,5,1,55,5,
+17,51,1,17,51,17,3,0,253,80,41,1,251,140,253,204,130,30,1,21,123,217,5,29,
+252,183,2,126,253,130,0,5,0,140,255,230,4,49,5,208,0,11,0,16,0,21,0,26,0,
+31,0,0,1,16,2,35,34,2,17,16,18,51,50,18,1,18,18,23,17,19,54,18,55,33,37,38,
+2,39,17,3,6,2,7,33,4,49,243,223,223,244,245,222,224,242,252,231,7,133,121,
+130,122,132,7,254,251,1,5,9,133,119,130,117,134,9,1,4,2,221,254,152,254,113,
+1,148,1,107,1,94,1,141,254,115,254,108,254,253,254,213,28,2,74,253,183,31,
+1,43,255,120,238,1,29,30,253,215,2,41,30,254,225,236,0,4,0,80,255,226,3,56,
+5,182,0,5,0,9,0,13,0,17,0,0,5,1,55,5,17,51,1,17,51,17,1,17,51,17,51,17,51,
+17,3,56,253,80,41,1,251,140,253,204,130,254,202,130,230,130,30,1,21,123,217,
+5,29,254,141,1,52,254,204,254,82,1,52,254,204,1,52,254,204,0,255,255,0,80,
+255,220,3,83,7,10,2,38,1,193,0,0,0,6,4,200,36,0,0,3,0,80,255,220,3,51,5,182,
+0,27,0,31,0,42,0,0,1,17,20,6,35,34,39,6,7,39,54,55,38,38,53,52,54,51,50,22,
+21,20,7,22,51,50,53,17,1,35,17,51,19,52,38,35,34,6,21,20,22,23,54,3,51,142,
+137,72,110,96,127,55,102,83,70,81,113,88,99,126,95,69,46,119,254,185,130,
+130,68,53,51,35,47,70,48,68,5,182,251,190,181,170,67,74,50,108,29,57,59,140,
+60,85,114,123,96,115,112,39,243,4,64,253,76,2,18,252,121,48,61,45,48,36,99,
+40,82,0,0,3,0,80,255,226,3,50,5,182,0,5,0,16,0,28,0,0,5,1,55,5,17,51,1,16,
+51,50,22,21,20,6,35,34,38,55,20,22,22,51,50,17,16,35,34,6,6,3,50,253,80,41,
+1,251,140,253,30,247,122,123,123,122,123,124,130,23,49,45,115,115,44,50,23,
+30,1,21,123,217,5,29,254,21,1,138,187,207,196,178,180,194,114,94,55,1,7,1,
+28,63,109,0,0,4,0,180,0,0,4,77,5,182,0,11,0,15,0,19,0,23,0,0,33,35,17,33,
+17,35,17,51,17,33,17,51,19,35,17,51,17,35,17,51,17,35,17,51,3,84,140,254,
+120,140,140,1,136,140,249,130,130,130,130,130,130,2,188,253,68,5,182,253,
+126,2,130,254,145,1,71,252,197,1,71,252,197,1,71,0,255,255,0,141,255,226,
+3,110,7,10,2,38,1,197,0,0,0,6,4,200,63,0,0,2,0,180,255,226,3,102,5,212,0,
+5,0,11,0,0,1,37,17,35,17,5,3,5,17,51,17,37,2,73,254,247,140,1,193,164,1,9,
+140,254,63,4,137,130,250,245,5,212,216,252,49,130,5,11,250,44,216,0,0,2,0,
+80,0,0,4,41,5,208,0,25,0,50,0,0,1,35,17,37,17,35,17,5,17,35,53,51,53,35,53,
+51,17,5,7,39,21,51,21,35,21,51,1,34,6,21,20,22,51,21,34,6,21,20,22,51,21,
+38,38,53,52,55,38,53,52,54,55,3,183,193,254,85,140,1,171,178,178,178,178,
+1,191,61,246,193,193,193,253,168,74,82,85,71,74,82,85,71,129,142,97,97,147,
+124,2,199,253,234,204,254,131,2,88,222,1,77,110,160,110,1,141,228,112,128,
+185,110,160,1,222,59,51,54,55,111,59,51,54,55,111,7,113,100,106,59,58,107,
+98,119,4,0,0,4,0,120,255,231,3,180,5,182,0,26,0,30,0,34,0,38,0,0,1,17,35,
+38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,2,17,52,18,51,50,23,17,1,35,
+53,51,23,35,53,51,23,35,53,51,3,175,135,74,179,142,153,152,143,104,138,30,
+121,52,202,137,205,232,233,204,152,104,254,51,107,107,190,107,107,190,107,
+107,5,182,253,93,167,221,203,211,224,113,102,65,134,136,1,38,1,5,254,1,34,
+87,1,219,254,211,217,217,217,217,217,255,255,0,80,255,230,3,240,7,10,2,38,
+1,201,0,0,0,6,4,200,101,0,0,3,0,80,255,230,3,240,5,212,0,30,0,37,0,44,0,0,
+19,52,54,55,17,5,7,37,21,22,22,21,20,6,7,17,54,19,23,6,6,35,34,38,39,55,18,
+23,17,38,38,55,20,22,23,17,6,6,5,52,38,39,17,54,54,176,166,134,2,20,46,254,
+166,126,158,160,124,207,53,132,44,233,184,183,240,44,133,48,215,134,166,130,
+89,81,81,89,1,208,82,72,72,82,3,29,115,170,18,1,136,200,114,134,216,22,170,
+107,110,168,21,254,114,42,1,47,50,203,218,216,205,50,254,208,41,1,139,18,
+167,119,72,105,16,1,126,15,103,71,69,98,18,254,139,19,100,0,0,3,0,80,255,
+230,4,125,5,182,0,39,0,53,0,62,0,0,55,54,55,38,53,53,6,7,39,54,55,17,51,17,
+54,51,50,23,17,51,17,22,23,7,38,39,21,20,7,22,23,7,38,39,6,35,34,39,6,7,1,
+54,53,53,38,35,34,7,21,20,23,54,51,50,3,50,55,38,35,34,7,22,22,142,40,90,
+20,35,23,114,55,117,140,102,121,115,106,140,116,57,114,21,38,20,91,42,123,
+21,34,89,209,207,88,34,18,2,51,7,97,124,124,99,7,101,116,118,119,147,49,87,
+110,109,87,23,101,62,179,121,121,209,22,62,89,64,181,113,2,29,254,65,47,48,
+1,192,253,223,111,179,64,78,73,22,197,127,116,191,38,103,72,224,217,76,92,
+1,205,78,129,184,67,68,183,130,80,61,254,64,249,79,83,120,125,0,0,4,0,120,
+255,240,4,82,5,182,0,36,0,40,0,44,0,48,0,0,1,22,22,51,50,54,53,53,33,53,33,
+53,38,2,3,51,18,22,51,50,54,19,51,2,2,7,21,33,21,33,21,20,6,35,34,38,39,1,
+35,53,51,55,35,53,51,5,35,53,51,1,0,21,93,53,67,53,254,175,1,81,207,205,11,
+140,6,165,182,173,167,12,141,15,210,198,1,81,254,175,128,140,93,150,35,2,
+29,130,130,170,120,120,254,162,120,120,1,1,70,83,102,98,230,120,139,21,1,
+39,1,55,254,238,236,237,1,17,254,209,254,209,21,139,120,240,168,142,119,101,
+3,44,218,27,201,201,201,0,255,255,0,120,255,230,4,20,7,10,2,38,1,205,0,0,
+0,6,4,200,117,0,0,3,0,120,255,230,4,20,5,212,0,25,0,32,0,39,0,0,19,52,54,
+54,55,17,5,7,37,21,30,2,21,20,6,6,7,17,37,55,5,53,46,2,37,52,38,39,17,54,
+54,37,20,22,23,17,6,6,126,94,174,118,2,20,46,254,166,120,173,93,94,174,118,
+253,236,46,1,90,121,174,91,3,4,128,118,119,127,253,136,129,117,119,127,2,
+242,89,154,99,11,1,129,200,114,134,205,12,99,155,87,90,154,99,10,254,85,200,
+114,134,247,10,98,154,91,103,117,12,254,48,12,119,101,102,118,12,1,208,12,
+119,0,7,0,145,255,228,3,221,5,206,0,19,0,28,0,37,0,42,0,47,0,51,0,55,0,0,
+1,50,22,22,18,18,21,16,35,34,39,6,35,34,38,53,52,18,18,54,3,50,53,53,35,6,
+21,20,22,37,52,39,35,21,20,51,50,54,3,38,39,35,21,37,6,7,51,53,37,38,39,17,
+3,6,7,51,2,55,72,122,100,78,50,251,127,44,62,109,126,125,68,117,149,93,116,
+210,12,51,2,11,11,211,116,57,49,22,15,20,165,254,218,16,18,198,1,15,61,80,
+130,82,57,139,5,206,111,206,254,198,254,114,119,254,146,112,112,167,199,203,
+1,195,1,75,163,250,142,241,247,132,110,134,112,246,103,139,247,241,123,1,
+219,121,99,220,220,79,141,220,110,240,76,254,196,1,60,76,240,0,255,255,0,
+81,0,0,3,92,7,10,0,38,1,208,236,0,0,6,4,200,45,0,0,3,0,101,0,0,3,100,5,198,
+0,7,0,20,0,24,0,0,1,17,37,17,35,17,5,17,1,38,53,52,54,55,23,6,6,21,20,22,
+23,37,35,17,51,3,100,253,251,140,2,5,253,246,105,136,123,62,88,103,46,36,
+1,6,130,130,5,183,251,24,224,254,81,2,108,222,4,41,253,55,138,190,132,204,
+64,100,39,163,98,72,138,52,71,1,84,0,0,3,0,140,255,230,4,140,5,212,0,3,0,
+11,0,46,0,0,1,35,17,51,5,1,17,35,17,1,17,51,1,20,51,50,54,54,53,53,51,21,
+20,14,2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,53,51,2,205,130,
+130,1,109,253,48,140,2,208,140,254,152,151,61,64,26,140,35,66,104,76,151,
+80,82,149,74,105,67,35,140,26,63,62,151,140,2,201,1,22,103,1,137,254,139,
+2,72,254,116,1,110,251,153,241,61,144,172,111,131,164,165,96,52,122,122,52,
+96,165,164,131,111,174,142,61,241,247,0,5,0,140,255,230,4,49,5,208,0,3,0,
+7,0,11,0,23,0,35,0,0,1,35,17,51,39,35,17,51,1,35,17,51,1,16,2,35,34,2,17,
+16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,2,160,130,130,140,130,130,
+1,24,130,130,1,5,243,223,223,244,245,222,224,242,140,169,159,154,171,166,
+159,158,170,1,122,1,40,144,1,40,254,216,1,40,254,131,254,152,254,113,1,148,
+1,107,1,94,1,141,254,115,254,154,1,53,1,70,254,184,254,213,254,192,254,185,
+1,73,0,255,255,0,140,255,236,4,140,7,10,2,38,1,212,0,0,0,7,4,200,0,205,0,
+0,0,3,0,140,255,236,4,140,5,182,0,36,0,48,0,52,0,0,1,20,51,50,54,54,53,53,
+51,21,20,6,6,7,17,20,6,35,34,38,53,17,46,2,53,53,51,21,20,22,22,51,50,53,
+17,51,3,50,54,53,17,34,39,6,35,17,20,22,19,35,17,51,2,210,151,61,64,26,140,
+28,60,53,192,178,179,193,53,61,27,140,26,63,62,151,140,70,125,106,151,80,
+82,149,105,191,130,130,4,151,241,61,144,172,151,171,147,157,112,29,254,103,
+220,237,237,220,1,153,30,111,153,151,171,151,174,142,61,241,1,31,250,174,
+175,192,1,91,122,122,254,165,192,175,1,19,1,32,0,3,0,80,0,0,4,42,5,182,0,
+17,0,25,0,29,0,0,1,1,51,1,1,35,1,1,35,19,38,38,53,52,54,55,3,51,3,20,22,23,
+55,3,6,6,55,51,17,35,2,110,1,47,141,254,140,1,116,145,254,213,254,214,145,
+188,131,156,138,118,157,141,110,111,100,130,164,86,91,100,120,120,3,101,2,
+81,253,35,253,39,2,76,253,180,1,113,36,210,143,131,215,48,1,54,253,64,109,
+150,26,255,1,66,36,154,34,254,240,0,255,255,0,80,0,0,3,199,7,10,2,38,1,215,
+0,0,0,6,4,200,76,0,0,3,0,80,0,0,3,199,5,182,0,11,0,15,0,19,0,0,1,1,51,1,1,
+35,1,1,35,1,1,59,2,21,35,17,51,21,35,2,11,1,47,141,254,140,1,116,145,254,
+213,254,214,145,1,116,254,140,141,238,130,130,130,130,3,101,2,81,253,35,253,
+39,2,76,253,180,2,217,2,221,244,252,50,244,0,3,0,80,0,0,4,124,5,182,0,19,
+0,27,0,31,0,0,33,17,38,2,39,51,22,22,23,17,51,17,54,54,55,51,6,2,7,17,1,17,
+39,55,23,17,5,7,3,53,51,21,2,43,179,234,40,140,30,159,124,140,117,160,33,
+143,41,236,176,254,144,247,32,95,1,18,36,61,120,3,78,22,1,18,241,177,214,
+24,1,238,254,19,25,212,177,237,254,236,24,252,178,2,120,253,191,117,107,40,
+2,65,127,105,254,84,248,248,255,255,0,110,255,230,4,14,7,10,2,38,1,218,0,
+0,0,7,4,200,0,130,0,0,0,2,0,110,255,230,4,14,5,212,0,11,0,24,0,0,1,37,17,
+35,17,39,17,35,17,1,17,51,19,6,6,35,34,38,39,55,18,33,50,54,55,3,238,254,
+152,140,220,140,2,208,140,32,44,233,184,183,240,44,133,57,1,21,135,165,29,
+3,80,213,253,114,2,225,131,254,105,2,112,254,85,1,141,251,213,203,218,216,
+205,50,254,161,180,171,0,1,0,120,0,0,3,212,5,212,0,15,0,0,1,17,35,17,1,17,
+51,17,37,17,37,17,35,17,5,17,1,4,140,2,208,140,254,152,254,223,140,1,33,5,
+1,254,139,2,72,254,116,1,110,253,194,196,252,168,173,254,111,2,88,171,2,220,
+255,255,0,130,255,231,3,123,7,10,2,38,1,221,0,0,0,6,4,200,66,0,0,1,0,130,
+255,231,3,123,5,208,0,43,0,0,1,38,38,35,34,6,21,20,30,6,21,20,6,35,34,38,
+39,55,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,54,51,50,22,23,3,6,50,121,
+89,99,110,50,83,105,110,105,83,50,204,178,137,196,46,113,47,133,96,108,124,
+55,100,138,129,107,57,87,156,103,123,182,64,4,119,123,102,117,107,65,97,77,
+66,68,78,100,131,88,179,220,162,158,57,130,127,143,120,79,118,97,84,78,109,
+135,89,86,159,96,135,144,0,1,0,100,0,0,4,56,5,208,0,36,0,0,1,35,17,35,17,
+20,6,35,34,39,17,35,17,51,4,51,50,54,53,17,52,38,35,34,6,7,39,54,54,51,50,
+22,21,21,51,17,51,4,56,130,157,101,101,106,188,140,33,1,51,94,37,25,87,99,
+71,157,61,78,104,190,99,159,141,157,130,1,50,1,187,254,209,134,125,125,254,
+200,2,8,213,86,78,2,128,129,128,97,83,71,125,104,185,185,249,1,151,0,255,
+255,0,100,0,0,3,245,7,10,2,38,1,224,0,0,0,6,4,200,116,0,0,2,0,100,0,0,3,245,
+5,208,0,32,0,36,0,0,19,54,36,51,50,22,21,17,20,6,6,35,34,38,39,39,17,35,17,
+51,4,51,50,54,54,53,17,52,38,35,34,6,7,1,35,17,51,100,123,1,25,134,190,185,
+48,112,112,51,130,125,138,140,33,1,181,114,70,46,16,107,128,118,244,106,1,
+83,130,130,4,235,109,120,207,209,253,237,144,146,64,37,51,52,254,185,2,8,
+213,31,93,173,1,198,157,153,107,93,254,48,1,88,0,2,0,80,255,230,3,216,5,182,
+0,15,0,29,0,0,37,17,33,53,33,17,5,17,51,17,37,17,33,21,33,17,37,6,6,35,34,
+38,39,51,22,22,51,50,54,55,1,206,254,192,1,64,1,92,130,254,174,1,82,254,174,
+1,126,42,222,187,189,225,39,139,31,152,131,129,149,31,241,2,11,110,1,213,
+148,1,11,254,55,147,254,234,110,253,245,204,238,233,226,245,188,163,171,180,
+0,1,0,80,255,230,3,216,5,208,0,37,0,0,1,38,38,39,17,33,21,33,17,54,54,55,
+51,6,6,35,34,38,39,51,22,22,23,17,33,53,33,17,6,6,7,35,54,54,51,50,22,23,
+3,74,26,118,96,1,64,254,192,96,118,26,142,42,222,187,189,225,39,139,26,119,
+98,254,192,1,64,98,119,26,139,39,224,190,187,222,42,3,249,156,167,21,253,
+201,110,253,185,20,168,156,238,233,226,245,164,161,20,2,72,110,2,55,19,161,
+164,245,226,233,238,0,255,255,0,120,255,240,4,82,7,10,2,38,1,228,0,0,0,7,
+4,200,0,165,0,0,0,2,0,120,255,240,4,82,5,182,0,28,0,46,0,0,1,22,22,51,50,
+54,53,17,38,2,3,51,18,22,51,50,54,19,51,2,2,7,17,20,6,35,34,38,39,1,20,6,
+35,34,38,53,53,51,21,20,22,51,50,54,53,53,51,1,0,21,93,53,67,53,207,205,11,
+140,6,165,182,173,167,12,141,15,210,198,128,140,93,150,35,2,210,133,115,113,
+129,120,65,63,57,65,120,1,1,70,83,102,98,1,233,21,1,39,1,55,254,238,236,237,
+1,17,254,209,254,209,21,254,13,168,142,119,101,4,137,138,153,157,134,97,85,
+92,101,98,86,94,0,4,0,80,255,230,3,216,5,182,0,15,0,29,0,33,0,37,0,0,37,17,
+33,53,33,17,5,17,51,17,37,21,33,21,33,17,37,6,6,35,34,38,39,51,22,22,51,50,
+54,55,7,17,51,17,33,17,51,17,1,206,254,192,1,64,1,92,130,254,174,1,82,254,
+174,1,126,42,222,187,189,225,39,139,31,152,131,129,149,31,172,120,253,252,
+120,241,2,41,110,1,183,148,1,11,254,55,147,248,110,253,215,204,238,233,226,
+245,188,163,171,180,5,1,2,254,254,1,2,254,254,0,0,4,0,120,0,0,4,7,5,182,0,
+13,0,31,0,45,0,63,0,0,19,22,22,51,50,54,55,51,2,2,35,34,2,39,37,20,6,35,34,
+38,53,53,51,21,20,22,51,50,54,53,53,51,1,54,18,51,50,18,19,35,38,38,35,34,
+6,7,5,35,53,52,38,35,34,6,21,21,35,53,52,54,51,50,22,21,254,24,171,125,130,
+171,25,131,41,236,178,178,240,38,2,190,139,109,107,135,120,71,57,52,70,120,
+253,66,38,239,179,177,237,41,131,25,171,130,125,171,24,2,56,120,69,53,57,
+71,120,135,107,109,139,5,30,188,222,213,197,254,255,254,239,1,21,253,85,149,
+192,196,145,67,55,102,141,138,96,64,250,226,252,1,22,254,240,254,254,196,
+214,222,188,152,64,95,139,142,101,55,67,145,196,192,149,0,255,255,0,80,0,
+0,4,15,7,10,2,38,1,232,0,0,0,6,4,200,110,0,0,2,0,80,0,0,4,15,5,182,0,13,0,
+27,0,0,33,38,2,35,34,2,7,35,18,0,51,50,18,19,17,2,2,35,34,0,3,51,22,18,51,
+50,18,55,3,141,26,185,140,133,188,26,131,31,1,2,191,193,255,31,31,255,193,
+192,254,255,31,131,26,188,133,139,185,27,245,1,21,254,229,239,1,39,1,91,254,
+171,254,211,5,182,254,212,254,170,1,90,1,40,239,254,229,1,20,246,0,4,0,140,
+255,230,4,49,5,208,0,13,0,25,0,37,0,51,0,0,1,20,6,35,34,38,53,51,20,22,51,
+50,54,53,1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,
+7,52,38,35,34,6,21,35,52,54,51,50,22,21,3,64,122,106,103,119,120,56,52,48,
+54,1,105,243,223,223,244,245,222,224,242,140,169,159,154,171,166,159,158,
+170,221,54,48,52,56,120,119,103,106,122,4,110,157,187,190,154,117,117,127,
+107,254,111,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,1,
+70,254,184,254,213,254,192,254,185,1,73,43,107,127,119,115,155,189,188,156,
+0,0,2,0,80,255,240,4,136,5,193,0,23,0,26,0,0,1,38,39,17,35,1,1,39,1,1,55,
+1,1,51,17,54,55,21,6,6,21,20,22,23,1,19,17,4,136,154,98,45,254,173,254,181,
+113,1,117,254,139,113,1,75,1,83,45,95,157,119,132,132,119,253,202,174,1,46,
+42,94,254,58,2,103,253,153,66,2,166,2,167,66,253,152,2,104,254,94,93,42,129,
+41,168,112,107,163,42,1,44,254,190,2,133,0,255,255,0,80,255,240,4,172,7,10,
+2,38,1,236,0,0,0,7,4,200,0,187,0,0,0,2,0,80,255,240,4,172,5,193,0,38,0,41,
+0,0,1,38,39,21,54,55,21,6,6,7,21,20,22,23,21,38,39,21,35,1,1,39,1,1,55,1,
+1,51,21,54,55,21,6,6,7,21,20,22,23,5,19,17,4,172,179,109,108,180,138,148,
+2,148,140,179,109,45,254,173,254,181,113,1,117,254,139,113,1,75,1,83,45,108,
+180,138,148,2,148,140,253,166,174,3,2,13,86,246,85,15,119,12,117,89,9,95,
+120,11,120,13,86,146,2,103,253,153,66,2,166,2,167,66,253,152,2,104,111,85,
+15,119,12,117,89,9,95,120,11,162,254,190,2,133,0,6,0,140,255,230,4,49,5,208,
+0,3,0,7,0,19,0,31,0,35,0,39,0,0,1,35,17,51,55,33,53,33,23,16,2,35,34,2,17,
+16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,1,35,17,51,19,35,17,51,2,
+159,130,130,197,253,245,2,11,205,243,223,223,244,245,222,224,242,140,169,
+159,154,171,166,159,158,170,254,130,130,130,240,130,130,1,15,1,48,112,120,
+74,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,1,70,254,184,
+254,213,254,192,254,185,1,73,1,237,1,8,254,248,1,8,0,0,5,0,140,255,230,4,
+176,5,182,0,47,0,60,0,72,0,76,0,80,0,0,1,20,7,17,20,6,6,35,34,39,6,6,35,34,
+38,53,17,38,53,17,51,17,20,22,51,50,54,53,17,51,17,20,22,51,50,54,53,17,51,
+17,20,22,51,50,54,53,17,51,1,35,39,17,20,51,50,54,53,17,38,39,6,1,20,51,50,
+54,53,17,7,34,39,6,7,19,35,17,51,1,35,17,51,4,176,55,70,123,73,135,76,35,
+107,57,128,146,55,130,41,50,49,40,130,41,50,49,40,130,41,50,49,40,130,252,
+173,13,11,146,67,67,52,45,67,1,38,146,67,67,36,98,60,44,42,200,120,120,254,
+102,120,120,4,94,150,82,253,156,95,133,72,90,42,48,159,141,2,83,72,177,1,
+88,254,245,163,108,107,164,1,11,254,245,163,108,107,164,1,11,254,245,163,
+108,107,164,1,11,253,110,1,254,48,247,116,131,1,214,13,58,78,254,36,234,116,
+131,1,209,2,74,52,13,254,147,1,2,254,254,1,2,255,255,0,150,255,230,4,37,7,
+10,2,38,1,240,0,0,0,6,4,200,105,0,0,3,0,150,255,230,4,37,5,182,0,9,0,13,0,
+17,0,0,1,17,19,23,1,17,1,55,5,17,3,7,37,55,37,7,37,55,2,243,207,99,254,206,
+253,167,61,1,144,108,75,254,230,75,1,46,75,254,230,75,5,182,254,3,1,23,79,
+254,105,252,252,1,64,112,204,4,236,253,163,106,174,107,155,106,174,107,0,
+4,0,80,0,0,3,232,5,182,0,3,0,7,0,11,0,15,0,0,1,17,35,17,37,33,53,33,3,17,
+35,17,33,17,35,17,2,93,130,2,13,252,104,3,152,135,130,254,122,130,2,34,253,
+222,2,34,160,110,2,134,254,26,1,230,254,26,1,230,0,1,0,100,0,0,3,241,5,208,
+0,17,0,0,1,53,35,17,37,17,35,17,5,17,5,7,37,17,51,53,51,17,3,84,228,254,128,
+140,1,128,2,13,61,254,188,228,130,1,230,226,254,27,174,254,111,2,88,172,4,
+36,252,112,154,254,56,202,253,230,255,255,0,80,255,230,3,196,7,10,2,38,1,
+244,0,0,0,6,4,200,66,0,0,2,0,80,255,230,3,196,5,208,0,7,0,11,0,0,19,5,17,
+1,7,37,17,1,19,35,17,51,141,1,56,1,255,61,254,202,253,255,147,130,130,1,114,
+168,5,6,254,228,112,175,250,243,1,28,1,214,2,40,0,2,0,100,0,0,3,163,5,208,
+0,3,0,13,0,0,1,35,17,51,5,39,17,37,17,35,17,5,17,5,1,1,130,130,2,101,246,
+254,128,140,1,128,1,191,3,60,2,40,232,130,251,229,174,254,111,2,88,172,4,
+36,228,0,0,5,0,80,255,230,4,118,5,208,0,24,0,33,0,42,0,46,0,50,0,0,55,54,
+54,55,53,52,38,39,55,22,23,18,33,50,18,17,21,16,2,35,34,38,39,6,7,5,50,18,
+53,53,33,21,20,18,3,33,53,52,2,35,34,2,21,1,35,53,51,17,35,53,51,80,138,136,
+4,137,141,63,155,88,84,1,24,188,204,204,188,142,187,39,89,150,2,95,123,129,
+254,8,130,130,1,248,130,122,123,129,1,61,130,130,130,130,229,82,245,168,19,
+174,252,88,108,92,138,1,97,254,183,254,210,252,254,210,254,183,189,180,137,
+85,27,1,2,243,79,79,245,255,0,2,188,73,245,1,0,254,254,243,253,253,214,1,
+80,214,255,255,0,180,255,230,4,52,7,10,2,38,1,248,0,0,0,7,4,200,0,176,0,0,
+0,2,0,180,255,230,4,52,5,182,0,15,0,28,0,0,1,20,6,6,35,34,46,2,53,17,51,17,
+33,17,51,1,50,62,2,53,17,33,17,20,30,2,4,52,90,200,161,123,171,103,48,140,
+2,104,140,254,66,86,117,70,33,253,152,11,59,125,2,47,243,232,110,63,124,204,
+194,3,135,254,209,1,47,250,168,42,81,144,178,1,244,254,12,96,163,119,67,0,
+0,4,0,140,255,230,4,49,5,208,0,11,0,23,0,36,0,45,0,0,1,16,2,35,34,2,17,16,
+18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,39,20,6,35,34,38,53,17,51,21,
+51,53,51,3,50,54,53,53,35,21,20,22,4,49,243,223,223,244,245,222,224,242,140,
+169,159,154,171,166,159,158,170,82,139,109,107,135,120,250,120,242,52,70,
+250,71,2,221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,
+1,70,254,184,254,213,254,192,254,185,1,73,255,149,192,196,145,1,131,174,174,
+253,150,138,96,90,81,102,141,0,255,255,0,70,255,230,4,46,7,10,2,38,1,251,
+0,0,0,6,4,200,123,0,0,2,0,70,255,230,4,46,5,182,0,20,0,33,0,0,1,33,17,51,
+17,20,7,23,7,39,6,35,34,39,7,39,55,38,53,17,51,1,17,33,17,55,23,3,22,51,50,
+55,3,55,1,64,1,248,140,16,122,109,80,102,208,212,99,81,109,124,14,140,1,248,
+254,8,79,109,165,56,174,170,56,167,109,4,121,1,61,251,190,72,64,191,70,124,
+125,127,126,70,195,54,78,4,66,251,247,2,84,253,179,123,70,254,254,137,134,
+1,5,70,0,4,0,180,255,230,3,220,5,182,0,15,0,19,0,23,0,27,0,0,37,5,6,35,34,
+38,53,17,51,17,20,22,51,50,54,37,3,33,53,33,53,33,53,33,17,33,53,33,3,220,
+253,201,42,41,79,79,140,29,42,13,30,2,1,6,253,248,2,8,253,248,2,8,253,248,
+2,8,162,174,14,102,120,4,242,251,41,49,55,5,161,1,238,110,210,110,253,18,
+110,0,255,255,0,110,255,230,3,221,7,10,2,38,1,254,0,0,0,6,4,200,118,0,0,2,
+0,110,255,230,3,221,5,208,0,23,0,48,0,0,19,51,54,54,51,50,22,22,18,18,21,
+16,35,34,39,6,35,34,38,53,52,18,55,35,1,20,51,50,54,53,52,2,2,35,34,3,51,
+21,35,6,2,21,20,22,51,50,53,53,51,110,133,59,165,100,72,122,100,78,50,251,
+127,44,62,109,126,125,38,32,105,2,10,116,57,49,84,130,73,108,83,134,161,33,
+36,51,55,116,130,4,48,205,211,111,206,254,198,254,114,119,254,146,112,112,
+167,199,147,1,84,135,253,141,241,123,123,238,1,252,1,26,254,216,110,153,254,
+171,128,134,112,241,85,0,0,5,0,80,0,0,3,168,5,182,0,9,0,12,0,15,0,19,0,23,
+0,0,9,2,21,33,53,1,1,53,33,1,33,3,3,19,33,23,51,21,35,17,51,21,35,3,168,254,
+157,1,99,252,168,1,100,254,156,3,88,253,98,1,232,245,1,243,254,26,183,120,
+120,120,120,5,151,253,67,253,69,31,31,2,189,2,187,31,250,184,1,223,1,29,1,
+222,80,165,253,21,165,0,255,255,0,120,0,0,3,212,7,10,2,38,2,1,0,0,0,6,4,200,
+116,0,0,1,0,120,0,0,3,212,5,182,0,19,0,0,33,17,39,17,35,17,5,17,5,17,51,17,
+37,17,23,17,51,17,37,17,1,224,220,140,1,104,1,92,130,254,174,220,140,254,
+152,2,51,120,254,139,2,72,198,2,135,148,1,11,254,55,147,253,235,121,1,110,
+253,194,196,254,26,0,0,3,0,160,0,0,3,228,5,182,0,11,0,15,0,19,0,0,1,17,1,
+17,1,17,35,17,1,17,1,17,3,19,53,3,1,21,19,17,2,136,1,92,254,164,140,254,164,
+1,92,226,226,226,1,110,226,5,182,254,0,1,200,250,245,1,199,253,198,2,58,254,
+57,5,11,254,56,2,0,252,32,1,26,15,1,28,254,228,15,254,230,2,69,0,0,2,0,140,
+0,0,4,66,5,182,0,28,0,32,0,0,1,33,34,6,21,17,20,22,51,33,21,33,34,38,53,17,
+35,17,35,17,51,17,51,17,52,54,54,51,33,3,35,17,51,4,66,254,145,69,44,43,70,
+1,111,254,134,138,104,200,130,130,200,46,105,91,1,122,170,130,130,5,62,41,
+78,252,41,77,43,120,104,144,1,227,254,36,3,235,254,95,1,115,104,101,45,251,
+203,2,231,0,255,255,0,80,255,240,3,140,7,10,2,38,2,5,0,0,0,6,4,200,80,0,0,
+3,0,80,255,240,3,140,5,193,0,13,0,16,0,19,0,0,19,33,1,55,1,1,51,17,35,1,1,
+39,1,33,1,17,35,55,51,17,80,1,85,254,171,113,1,75,1,83,45,45,254,173,254,
+181,113,1,88,254,168,2,176,146,3,143,3,18,2,109,66,253,152,2,104,250,47,2,
+103,253,153,66,2,114,254,242,1,14,110,1,9,0,0,2,0,100,0,0,3,241,5,208,0,3,
+0,21,0,0,1,35,17,51,1,53,35,17,37,17,35,17,5,17,5,7,37,17,51,53,51,17,1,1,
+130,130,2,83,228,254,128,140,1,128,2,13,61,254,188,228,130,3,60,2,40,252,
+130,226,254,27,174,254,111,2,88,172,4,36,252,112,154,254,56,202,253,230,255,
+255,0,110,255,230,4,6,7,10,2,38,2,8,0,0,0,6,4,200,87,0,0,4,0,110,255,230,
+4,6,5,208,0,18,0,22,0,26,0,30,0,0,1,54,53,52,38,39,17,1,55,5,17,5,7,39,17,
+22,22,21,7,37,35,17,51,55,35,17,51,3,35,17,51,3,123,6,95,79,253,255,61,1,
+56,1,191,61,246,143,161,4,253,97,130,130,112,130,130,224,130,130,1,154,40,
+37,97,152,24,252,238,1,28,112,168,5,6,228,112,129,254,108,26,204,156,66,196,
+1,61,143,1,61,254,195,1,61,0,3,0,80,255,246,4,80,5,212,0,35,0,42,0,49,0,0,
+19,52,54,55,17,5,7,37,21,22,22,21,20,6,7,21,55,50,22,23,7,38,38,35,34,6,7,
+39,54,55,37,55,5,53,38,38,55,20,22,23,17,6,6,5,52,38,39,17,54,54,172,164,
+136,2,20,46,254,166,125,159,156,128,49,153,229,61,123,46,164,112,103,166,
+48,124,88,186,254,100,46,1,90,135,165,130,89,81,81,89,1,208,82,72,72,82,3,
+139,113,159,16,1,41,200,114,134,120,20,156,109,107,158,20,230,3,192,179,34,
+134,151,147,136,31,251,85,155,114,134,125,16,157,117,72,93,14,1,98,13,91,
+71,69,87,16,254,165,17,89,0,0,1,0,80,0,0,3,212,5,182,0,19,0,0,33,17,33,53,
+33,17,33,53,33,17,5,17,51,17,37,17,33,21,33,17,1,194,254,142,1,114,254,142,
+1,114,1,92,130,254,174,1,134,254,122,1,120,110,1,134,110,1,21,148,1,91,253,
+231,147,254,176,110,253,142,255,255,0,80,255,230,3,182,7,10,2,38,2,12,0,0,
+0,6,4,200,77,0,0,4,0,80,255,230,3,182,5,208,0,18,0,22,0,26,0,30,0,0,1,54,
+53,52,38,39,17,1,55,5,17,5,7,39,17,22,22,21,7,1,7,37,55,37,7,37,55,37,7,37,
+55,3,43,6,95,79,253,255,61,1,56,1,191,61,246,143,161,4,253,232,65,254,250,
+62,1,9,65,254,250,62,1,9,65,254,250,62,1,154,40,37,97,152,24,252,238,1,28,
+112,168,5,6,228,112,129,254,108,26,204,156,66,1,0,112,143,109,130,112,143,
+109,140,112,143,109,0,0,2,0,100,0,0,3,250,5,212,0,20,0,27,0,0,1,33,17,33,
+21,33,17,35,17,38,38,53,52,54,55,17,5,7,37,17,33,1,20,22,23,17,6,6,3,242,
+254,128,1,128,254,128,140,179,207,216,170,2,20,46,254,166,1,128,252,244,140,
+116,114,142,3,156,254,65,120,254,155,1,101,4,180,158,152,188,5,1,192,200,
+114,134,254,244,254,167,99,120,3,1,191,2,123,0,0,2,0,120,255,230,4,118,5,
+182,0,40,0,52,0,0,1,6,6,7,21,20,51,50,54,55,51,6,6,7,21,20,6,35,34,38,53,
+53,38,38,39,51,22,22,51,50,53,53,38,3,51,22,22,51,50,54,55,3,50,54,53,53,
+34,39,6,35,21,20,22,3,156,4,113,106,151,83,63,4,140,6,69,65,192,178,179,193,
+68,69,3,140,4,65,81,151,212,5,140,6,63,80,82,65,4,153,125,106,151,80,82,149,
+105,5,182,174,177,20,86,241,118,168,173,164,37,245,220,237,237,220,245,39,
+175,160,172,114,241,84,42,1,75,149,109,117,141,250,168,175,192,183,122,122,
+183,192,175,0,255,255,0,97,0,0,3,66,7,10,2,38,2,16,0,0,0,6,4,200,19,0,0,3,
+0,140,0,0,3,22,5,182,0,3,0,7,0,11,0,0,1,17,35,17,1,17,35,17,33,17,35,17,2,
+18,130,1,134,130,254,122,130,2,114,253,142,2,114,3,68,253,172,2,84,253,172,
+2,84,0,0,4,0,120,0,0,4,164,5,182,0,13,0,17,0,21,0,25,0,0,1,2,0,35,34,0,3,
+51,18,18,51,50,18,19,1,35,17,51,1,35,17,51,1,35,17,51,4,164,18,254,229,233,
+241,254,235,16,140,14,205,175,173,203,17,253,58,130,130,1,131,130,130,1,131,
+130,130,5,182,254,182,254,142,1,105,1,83,254,229,254,215,1,46,1,22,250,74,
+2,78,253,178,2,78,253,178,2,78,0,0,1,0,80,0,0,4,124,5,182,0,27,0,0,1,2,2,
+7,21,33,21,33,17,35,17,33,53,33,53,38,2,3,51,22,18,23,17,51,17,54,18,55,4,
+124,26,243,195,1,154,254,102,140,254,102,1,154,199,241,24,140,20,172,137,
+130,133,170,24,5,152,254,234,254,178,26,244,120,254,82,1,174,120,244,23,1,
+72,1,31,231,254,249,23,2,35,253,222,24,1,9,227,0,255,255,0,130,255,226,3,
+227,7,10,2,38,2,20,0,0,0,6,4,200,71,0,0,2,0,130,255,226,3,227,5,182,0,15,
+0,21,0,0,1,39,17,35,17,39,17,35,17,23,17,51,17,23,17,51,19,37,55,5,17,51,
+2,228,232,130,118,130,248,130,102,130,255,252,216,41,2,115,140,2,128,163,
+254,110,1,237,83,254,195,2,40,171,1,134,254,32,70,1,55,251,58,246,123,196,
+5,39,0,1,0,120,0,0,3,254,5,208,0,17,0,0,19,54,54,51,32,19,7,38,39,17,37,17,
+35,17,5,17,6,7,124,50,227,174,1,84,107,131,62,185,254,128,140,1,128,190,60,
+4,98,181,185,254,144,40,243,38,251,146,174,254,111,2,88,172,3,165,37,244,
+255,255,0,80,255,226,3,110,7,10,2,38,2,23,0,0,0,6,4,200,56,0,0,2,0,80,255,
+226,3,110,5,182,0,5,0,21,0,0,5,1,55,5,17,51,3,35,17,37,55,23,17,35,53,51,
+17,5,7,39,21,51,3,110,253,80,41,1,251,140,221,203,254,138,49,195,198,199,
+1,94,49,171,202,30,1,21,123,217,5,29,253,220,254,10,180,113,98,1,51,110,1,
+149,169,113,87,210,0,2,0,140,0,0,4,48,5,208,0,53,0,57,0,0,1,6,6,21,20,22,
+23,21,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,22,21,
+20,6,7,53,54,54,53,52,38,39,53,54,54,53,52,38,35,34,6,21,20,22,23,19,17,51,
+17,2,5,109,128,88,79,143,164,93,89,81,90,113,204,140,140,203,112,89,84,86,
+96,168,137,80,85,121,114,109,117,162,153,156,161,118,108,20,140,3,11,17,134,
+104,90,129,29,137,38,209,138,99,166,52,47,154,90,98,165,93,93,164,99,86,153,
+50,48,168,103,137,208,38,135,30,127,91,107,133,16,123,16,118,95,117,119,121,
+115,97,116,16,252,121,2,27,253,229,0,255,255,0,80,255,226,3,151,7,10,2,38,
+2,26,0,0,0,6,4,200,96,0,0,3,0,80,255,226,3,151,5,182,0,5,0,19,0,34,0,0,5,
+1,55,5,17,51,1,38,38,53,52,54,55,23,14,2,21,20,23,33,54,54,53,52,38,38,39,
+55,22,22,21,20,6,7,3,151,253,80,41,1,251,140,254,189,92,84,83,93,87,57,47,
+28,134,253,163,71,64,28,46,59,87,94,82,83,93,30,1,21,123,217,5,29,252,77,
+94,210,127,123,215,92,86,69,91,116,71,191,151,80,165,98,73,112,90,71,86,93,
+213,124,127,208,96,0,255,255,0,80,0,0,4,118,7,10,2,38,2,28,0,0,0,7,4,200,
+0,138,0,0,0,3,0,80,0,0,4,118,5,208,0,58,0,68,0,78,0,0,55,38,53,52,55,38,53,
+52,55,38,53,52,54,51,50,22,23,53,5,7,39,17,35,17,38,38,35,34,6,21,21,54,51,
+50,22,21,20,6,35,34,39,6,21,20,23,54,51,50,22,21,20,6,35,34,39,6,21,20,23,
+19,34,7,22,51,50,54,53,52,38,3,34,7,22,51,50,54,53,52,38,107,27,43,41,35,
+33,190,151,62,143,65,1,191,61,246,140,61,155,57,110,98,80,104,92,106,109,
+98,95,76,5,7,74,95,97,110,107,91,108,75,5,22,164,85,51,50,81,31,49,43,37,
+81,47,50,83,32,43,49,183,87,91,107,96,92,118,107,93,68,78,119,148,43,39,183,
+228,112,129,251,3,4,133,54,66,91,73,9,61,101,88,81,95,52,47,30,46,37,61,94,
+82,89,100,59,28,39,94,44,3,45,83,62,38,32,38,37,254,100,67,78,37,38,32,38,
+0,1,0,120,0,0,4,16,5,182,0,15,0,0,1,39,17,35,17,37,17,35,17,23,17,51,17,5,
+17,51,4,16,220,140,254,82,130,200,140,1,194,130,1,212,116,253,184,2,146,228,
+253,130,3,76,110,1,224,253,211,247,2,92,0,1,0,120,0,0,4,25,5,182,0,15,0,0,
+1,35,17,33,17,37,17,35,17,5,17,51,17,33,17,51,4,25,140,254,167,254,208,140,
+1,48,140,1,89,140,1,95,2,18,253,114,164,254,121,2,108,182,4,0,254,51,1,161,
+255,255,0,120,0,0,3,242,7,10,2,38,2,32,0,0,0,6,4,200,116,0,0,1,0,120,0,0,
+3,242,5,208,0,52,0,0,37,33,21,35,53,33,53,33,53,33,53,33,53,38,38,39,55,22,
+51,50,53,52,38,39,38,38,53,52,54,51,50,23,7,38,38,35,34,21,20,22,23,22,22,
+21,20,6,7,21,33,21,33,21,33,3,242,254,137,140,254,137,1,119,254,167,1,89,
+103,199,73,49,193,232,234,129,139,199,203,191,173,241,170,49,63,190,109,234,
+133,135,205,197,166,157,1,89,254,167,1,119,215,215,215,110,145,110,94,13,
+67,50,106,131,122,59,55,7,9,111,110,112,124,111,108,48,60,122,60,55,7,11,
+111,107,104,123,8,89,110,145,0,2,0,120,0,0,3,207,5,182,0,21,0,25,0,0,1,38,
+39,17,37,17,35,17,5,17,51,21,54,55,21,6,6,7,21,20,22,23,37,17,51,17,3,207,
+179,109,254,85,140,1,171,140,108,180,138,148,2,148,140,252,231,130,2,161,
+13,86,253,173,204,254,131,2,88,222,4,60,197,85,15,119,12,117,89,9,95,120,
+11,38,1,253,254,3,0,2,0,100,0,1,3,253,5,182,0,18,0,22,0,0,1,22,19,35,38,38,
+35,34,6,7,35,54,54,55,37,55,5,17,51,1,35,17,51,2,186,249,74,142,33,151,125,
+128,154,32,139,39,201,159,254,96,41,1,161,140,254,150,130,130,1,227,78,254,
+108,192,189,184,197,242,241,15,169,123,182,3,85,253,156,1,242,0,255,255,0,
+100,255,230,4,158,7,10,2,38,2,36,0,0,0,7,4,200,0,195,0,0,0,2,0,100,255,230,
+4,158,5,208,0,50,0,62,0,0,1,38,38,35,34,6,21,17,22,18,23,35,38,39,21,20,6,
+35,34,38,39,6,7,35,54,18,55,17,52,38,35,34,6,7,39,54,54,51,50,17,17,54,51,
+50,23,17,16,51,50,22,23,1,34,7,21,20,22,51,50,54,53,53,38,4,30,5,45,40,47,
+34,100,134,23,130,27,100,115,128,124,115,2,64,23,131,17,110,91,34,47,40,45,
+5,128,11,103,102,223,58,64,43,39,223,102,103,11,253,245,64,56,47,56,56,45,
+39,4,186,85,73,118,179,254,11,72,254,223,209,255,139,58,194,168,162,187,128,
+195,169,1,23,87,2,24,180,117,73,85,23,133,122,254,183,253,231,20,9,2,14,1,
+73,122,133,253,57,34,117,153,124,127,150,136,15,0,3,0,120,255,230,4,48,5,
+208,0,33,0,45,0,49,0,0,1,33,17,37,55,23,53,33,53,33,53,33,53,33,53,38,38,
+53,52,54,54,51,50,22,21,20,6,7,21,33,21,33,21,33,1,20,22,51,50,54,53,52,38,
+35,34,6,5,21,35,53,4,19,254,137,254,65,61,246,254,137,1,119,254,167,1,89,
+189,219,113,214,150,223,252,216,188,1,89,254,167,1,119,252,231,182,165,163,
+182,180,165,166,181,1,157,130,1,129,254,101,198,112,112,213,110,145,110,82,
+13,174,140,98,150,81,177,152,141,173,13,82,110,145,2,152,105,113,112,106,
+105,114,115,10,177,177,0,1,0,100,255,230,3,216,5,208,0,19,0,0,1,37,17,1,55,
+5,17,39,17,35,17,5,17,1,7,37,17,23,17,51,3,204,254,153,253,255,61,1,56,221,
+140,1,105,1,255,61,254,202,219,140,1,202,196,253,88,1,28,112,168,2,16,121,
+254,139,2,72,199,2,113,254,228,112,175,254,31,120,1,110,255,255,0,103,0,0,
+3,72,7,10,2,38,2,40,0,0,0,6,4,200,25,0,0,1,0,120,0,0,3,9,5,182,0,9,0,0,1,
+5,17,51,17,37,17,35,17,51,1,4,1,121,140,253,251,140,140,2,48,162,4,40,251,
+25,224,254,81,3,181,0,0,2,0,100,0,0,2,245,5,182,0,7,0,11,0,0,1,17,37,17,35,
+17,5,17,1,35,17,51,2,245,253,251,140,2,5,254,157,130,130,5,182,251,25,224,
+254,81,2,108,222,4,40,253,170,2,8,0,0,5,0,80,255,230,4,6,5,208,0,11,0,15,
+0,19,0,23,0,27,0,0,1,5,17,33,53,33,17,5,7,39,17,1,55,35,17,51,3,35,17,51,
+17,35,17,51,19,35,17,51,1,15,1,56,254,9,1,247,1,191,61,246,253,255,254,130,
+130,224,130,130,130,130,224,130,130,1,114,168,2,116,120,2,26,228,112,129,
+250,233,1,28,199,1,11,254,245,1,11,1,77,1,11,254,245,1,11,0,255,255,0,180,
+0,0,4,10,7,10,2,38,2,44,0,0,0,7,4,200,0,158,0,0,0,5,0,180,0,0,4,10,5,182,
+0,3,0,7,0,11,0,15,0,19,0,0,33,35,17,51,1,35,17,51,1,35,17,51,17,35,17,51,
+17,35,17,51,1,64,140,140,2,202,140,140,254,150,130,130,130,130,130,130,5,
+182,250,74,5,182,250,113,1,51,3,1,1,51,252,180,1,51,0,4,0,100,255,230,5,19,
+5,208,0,20,0,32,0,36,0,40,0,0,1,5,17,33,6,6,35,34,38,53,16,51,50,19,33,17,
+5,7,39,17,1,3,20,22,22,51,50,17,16,35,34,6,6,37,17,51,17,3,17,51,17,2,26,
+1,58,254,252,3,124,118,123,124,247,219,22,1,8,1,191,61,246,253,253,247,23,
+49,45,115,115,44,50,23,1,153,130,130,130,1,114,168,2,197,187,168,180,194,
+1,138,254,209,1,211,228,112,129,250,233,1,28,2,160,114,94,55,1,7,1,28,63,
+109,64,1,12,254,244,253,168,1,12,254,244,0,0,2,0,80,0,0,4,90,5,182,0,29,0,
+40,0,0,33,17,6,35,35,6,5,39,54,55,38,38,53,52,54,51,50,22,21,20,7,50,55,17,
+5,17,51,17,37,17,1,20,22,23,54,53,52,38,35,34,6,2,124,46,55,22,89,254,249,
+81,226,83,139,162,127,103,111,129,14,38,54,1,92,130,254,174,253,205,104,100,
+11,59,53,47,56,2,167,7,251,214,83,165,233,31,156,105,97,131,156,133,65,72,
+7,1,248,148,1,61,254,5,147,251,178,3,212,64,97,24,58,56,91,97,64,0,255,255,
+0,80,255,230,3,196,7,10,2,38,2,48,0,0,0,6,4,200,88,0,0,4,0,80,255,230,3,196,
+5,202,0,8,0,17,0,20,0,23,0,0,19,5,1,17,1,5,39,37,37,19,5,1,17,1,5,39,37,37,
+1,17,7,19,7,23,139,1,113,1,200,254,56,254,143,59,1,67,254,189,59,1,113,1,
+200,254,56,254,143,59,1,67,254,189,2,242,220,220,220,220,5,142,236,1,40,253,
+40,1,40,236,94,210,210,253,82,236,1,40,253,40,1,40,236,94,210,210,1,173,1,
+26,141,253,129,141,141,0,0,3,0,80,0,0,3,196,5,202,0,8,0,20,0,23,0,0,19,5,
+1,17,1,5,39,37,37,1,33,17,35,17,33,53,33,17,51,17,33,3,7,23,139,1,113,1,200,
+254,56,254,143,59,1,67,254,189,3,94,254,172,140,254,172,1,84,140,1,84,108,
+220,220,5,142,236,1,40,253,40,1,40,236,94,210,210,252,130,254,78,1,178,110,
+1,64,254,192,2,203,141,141,0,255,255,0,120,255,230,3,244,7,10,2,38,2,51,0,
+0,0,6,4,200,126,0,0,4,0,120,255,230,3,244,5,208,0,13,0,25,0,39,0,51,0,0,19,
+52,54,54,51,50,22,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,
+3,52,54,54,51,50,22,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,
+6,120,109,203,135,135,202,108,241,204,200,247,130,170,147,143,172,169,146,
+147,170,130,109,203,135,135,202,108,241,204,200,247,130,170,147,143,172,169,
+146,147,170,4,145,93,147,79,80,146,93,144,175,178,141,96,112,114,94,98,111,
+113,252,52,93,147,79,80,146,93,144,175,178,141,96,112,114,94,98,111,113,255,
+255,0,120,255,255,4,120,7,10,2,38,2,53,0,0,0,7,4,200,0,146,0,0,0,3,0,120,
+255,255,4,120,5,203,0,24,0,31,0,38,0,0,5,17,39,17,35,34,38,38,53,52,54,55,
+38,38,53,52,54,55,53,1,17,1,7,39,17,1,20,22,23,17,6,6,3,20,22,23,17,6,6,3,
+2,170,12,138,210,113,100,93,103,97,175,165,1,54,1,118,58,176,253,115,109,
+94,94,109,7,102,108,108,102,1,4,6,151,251,100,95,163,101,95,155,49,44,148,
+89,123,168,27,204,254,239,1,39,254,243,104,122,251,48,1,103,81,125,25,1,205,
+25,122,1,241,76,109,21,1,157,22,109,0,3,0,60,255,230,3,196,5,208,0,18,0,33,
+0,39,0,0,19,16,18,51,50,18,17,21,16,2,35,34,38,39,7,39,55,38,53,23,20,23,
+55,23,7,22,51,50,18,53,17,39,33,7,19,34,3,33,38,38,180,203,189,188,204,204,
+188,119,169,46,113,65,145,25,140,9,202,65,243,59,160,123,129,3,254,13,2,252,
+188,49,1,218,24,121,3,89,1,45,1,74,254,183,254,210,252,254,210,254,183,131,
+123,77,94,98,115,147,10,90,78,137,94,165,211,1,2,243,1,16,87,87,1,245,254,
+218,145,149,255,255,0,180,0,0,4,143,7,10,2,38,2,56,0,0,0,7,4,200,0,156,0,
+0,0,1,0,180,0,0,4,143,5,208,0,19,0,0,51,17,5,7,39,17,33,17,5,7,39,17,35,17,
+35,17,35,17,35,17,180,1,191,61,246,1,144,1,191,61,246,140,135,130,135,5,208,
+228,112,129,254,12,2,199,228,112,129,251,3,2,155,253,101,2,155,253,101,0,
+0,1,0,120,0,0,4,0,5,182,0,22,0,0,1,17,51,18,55,23,6,17,20,22,23,7,38,2,39,
+35,17,37,17,35,17,5,17,2,52,129,29,225,77,194,99,95,75,115,135,8,127,254,
+208,140,1,48,5,182,254,18,1,41,183,102,165,254,224,156,221,78,102,91,1,7,
+158,253,147,164,254,121,2,108,182,4,0,0,255,255,0,120,0,0,3,244,7,10,2,38,
+2,59,0,0,0,6,4,200,116,0,0,7,0,120,0,0,3,244,5,182,0,31,0,37,0,43,0,50,0,
+57,0,61,0,65,0,0,19,52,54,55,53,51,21,22,22,21,20,6,7,21,22,22,21,20,6,7,
+21,35,53,38,38,53,52,54,55,53,38,38,55,20,23,17,6,6,17,20,23,17,6,6,5,52,
+38,39,17,54,54,17,52,38,39,17,54,54,5,21,35,53,33,21,35,53,120,204,177,130,
+179,202,198,183,179,202,198,183,130,174,207,204,177,174,207,130,251,118,133,
+251,118,133,2,120,133,118,121,130,133,118,121,130,253,156,120,3,64,120,4,
+85,107,139,11,96,96,12,137,108,106,139,12,196,12,137,108,106,139,12,142,142,
+12,138,107,107,139,11,196,12,138,107,129,17,1,37,8,73,252,248,129,17,1,37,
+8,73,66,66,73,8,254,219,8,77,3,3,66,73,8,254,219,8,77,220,137,137,137,137,
+0,2,0,80,0,0,4,3,5,208,0,34,0,48,0,0,19,52,54,54,51,50,22,22,21,20,6,6,7,
+21,22,18,23,7,38,38,39,17,35,17,6,6,7,39,54,18,55,53,46,2,55,20,22,22,51,
+50,54,54,53,52,38,35,34,6,118,108,199,130,129,199,107,92,168,111,148,215,
+45,123,31,149,105,130,100,152,33,124,47,216,146,109,168,94,130,77,139,91,
+86,140,79,169,136,137,170,4,105,97,167,95,95,165,99,90,156,99,11,137,26,254,
+219,236,38,189,249,31,254,0,2,0,29,247,193,39,239,1,33,26,137,12,101,155,
+88,68,115,65,66,115,67,108,141,142,0,5,0,80,0,0,4,3,5,208,0,32,0,36,0,41,
+0,46,0,51,0,0,19,52,54,54,51,50,22,22,21,20,6,7,21,22,18,23,7,38,38,39,17,
+35,17,6,6,7,39,54,18,55,53,38,38,37,38,39,21,39,6,6,7,51,7,22,22,23,53,23,
+54,54,55,35,118,106,198,133,133,197,105,200,171,155,210,43,123,31,146,108,
+130,105,148,32,124,45,211,153,170,201,2,226,27,210,130,100,124,13,237,237,
+13,119,105,130,105,118,14,237,4,65,116,182,101,100,181,118,164,216,16,96,
+24,254,245,225,38,187,218,26,254,38,1,218,25,218,188,39,228,1,7,24,96,18,
+219,213,199,31,230,230,15,118,97,110,93,119,16,228,227,16,124,87,255,255,
+0,80,0,0,4,54,7,10,2,38,2,63,0,0,0,7,4,200,0,136,0,0,0,2,0,80,0,0,4,54,5,
+208,0,34,0,46,0,0,37,38,38,39,17,35,17,6,6,7,39,54,54,55,17,23,53,38,38,53,
+52,54,51,50,22,21,20,6,7,17,39,21,22,22,23,1,20,22,51,50,54,53,52,38,35,34,
+6,3,92,36,134,94,140,91,135,37,113,51,194,131,212,164,210,225,164,167,228,
+150,120,212,131,194,51,253,220,142,117,120,145,142,123,116,143,52,130,167,
+24,254,139,1,117,23,166,130,39,173,207,23,1,88,83,178,4,155,117,122,155,156,
+121,97,141,25,254,134,98,172,21,209,176,4,99,77,91,89,79,76,89,88,0,2,0,80,
+0,0,4,36,5,182,0,32,0,49,0,0,19,51,54,54,55,54,36,51,21,6,6,21,20,22,22,51,
+51,21,35,34,6,21,20,22,23,21,34,38,39,38,38,39,35,37,38,38,39,6,6,7,51,21,
+35,22,22,23,39,53,52,54,80,89,23,210,159,43,1,1,187,177,199,81,158,106,43,
+43,162,183,191,185,174,242,51,173,235,9,84,2,170,96,120,4,94,121,17,170,176,
+8,125,107,2,107,3,27,152,220,36,121,138,114,3,134,121,72,115,66,130,156,139,
+142,153,3,114,121,111,36,250,167,85,43,162,98,33,144,101,110,116,168,37,24,
+24,114,190,0,255,255,0,100,0,0,3,189,7,10,2,38,2,66,0,0,0,6,4,200,76,0,0,
+6,0,100,0,0,3,189,5,182,0,14,0,29,0,44,0,48,0,52,0,56,0,0,33,38,38,53,52,
+54,54,55,21,6,6,21,20,22,23,17,38,38,53,52,54,54,55,21,6,6,21,20,22,23,1,
+34,38,53,52,54,54,51,21,34,6,21,20,22,51,5,35,53,51,17,35,53,51,1,35,53,51,
+3,189,189,223,98,188,126,138,150,148,140,189,223,98,188,126,138,150,148,140,
+254,42,183,204,102,171,114,121,136,137,120,1,177,120,120,120,120,254,66,120,
+120,14,189,143,91,150,95,10,119,11,120,96,95,120,11,2,138,14,189,143,91,150,
+95,10,119,11,120,96,95,120,11,253,222,219,175,115,197,102,110,161,143,130,
+153,203,198,2,60,198,253,198,198,0,3,0,140,255,230,3,232,5,208,0,29,0,47,
+0,55,0,0,1,35,2,7,22,23,7,38,39,6,6,35,34,38,2,17,16,18,54,51,50,23,54,55,
+23,6,7,22,23,51,5,16,55,38,38,35,34,6,6,17,16,22,22,51,50,54,55,38,19,52,
+39,6,21,20,23,54,3,206,191,2,27,103,143,55,125,101,35,123,101,111,142,67,
+68,140,114,188,72,99,123,44,133,100,25,2,192,253,187,218,20,71,60,69,77,34,
+35,77,68,60,71,20,218,250,9,111,111,9,2,182,254,251,138,74,53,110,47,66,91,
+106,142,1,52,1,61,1,49,1,45,141,194,63,47,114,52,69,136,219,81,1,26,195,75,
+83,116,231,254,232,254,227,240,122,84,75,197,1,27,198,128,134,192,191,136,
+107,0,3,0,80,255,230,4,184,5,182,0,44,0,60,0,76,0,0,1,54,55,23,6,6,21,20,
+22,23,7,38,39,21,20,6,35,34,38,53,53,6,7,39,54,54,55,53,52,38,39,55,22,23,
+17,51,17,20,22,51,50,54,53,17,51,5,21,20,51,50,53,53,51,21,20,6,35,34,38,
+53,53,19,21,20,51,50,53,53,51,21,20,6,35,34,38,53,53,3,208,72,102,58,107,
+125,113,103,54,94,68,165,168,164,167,68,94,54,94,118,4,125,107,58,102,72,
+140,86,107,104,87,140,254,129,48,54,93,75,67,70,76,93,48,54,93,75,67,70,76,
+4,121,75,45,103,46,179,117,111,169,47,106,40,66,121,204,194,191,207,121,66,
+40,106,43,159,113,12,117,178,47,103,46,74,1,61,251,189,150,127,126,151,4,
+67,162,84,86,86,84,95,80,91,90,81,95,254,62,84,86,86,84,95,80,91,90,81,95,
+0,255,255,0,80,255,246,3,108,7,10,2,38,2,70,0,0,0,6,4,200,36,0,0,1,0,80,255,
+246,3,108,5,194,0,35,0,0,1,37,6,7,33,21,33,22,23,37,23,5,22,23,7,38,39,5,
+39,37,38,39,33,53,33,54,55,37,55,5,54,55,23,6,7,23,3,68,254,248,61,14,1,54,
+254,199,4,52,1,30,40,254,243,73,138,73,170,97,254,225,40,1,16,63,6,254,238,
+1,21,14,73,254,219,40,1,61,91,146,73,111,69,238,3,243,93,118,167,120,171,
+122,101,113,95,108,93,108,109,154,101,113,96,147,191,120,187,143,104,113,
+112,122,98,108,72,86,84,0,0,1,0,100,255,240,4,49,5,182,0,44,0,0,19,22,22,
+51,50,54,53,53,33,53,33,53,33,53,33,53,38,2,39,51,22,22,51,50,54,55,51,6,
+2,7,21,33,21,33,21,33,21,33,21,20,6,35,34,38,39,230,21,93,53,67,53,254,182,
+1,74,254,202,1,54,191,204,22,139,19,166,163,157,165,23,141,27,206,183,1,64,
+254,192,1,84,254,172,128,140,93,150,35,1,1,70,83,102,98,146,120,130,120,113,
+18,1,1,254,222,190,194,218,252,254,254,19,113,120,130,120,156,168,142,119,
+101,255,255,0,180,255,230,4,52,7,10,2,38,2,73,0,0,0,7,4,200,0,186,0,0,0,1,
+0,180,255,230,4,52,5,182,0,31,0,0,1,51,3,37,3,62,3,53,17,51,17,20,6,6,35,
+34,46,2,53,17,51,17,20,30,2,23,19,5,2,69,130,122,1,2,147,87,96,45,8,140,90,
+200,161,123,171,103,48,140,9,47,101,93,117,254,247,5,182,253,171,116,252,
+141,11,75,116,152,87,3,155,252,121,243,232,110,63,124,204,194,3,135,252,101,
+89,154,117,74,9,2,180,124,0,2,0,142,255,236,3,234,5,204,0,7,0,15,0,0,1,1,
+17,35,17,1,17,51,17,1,17,35,17,1,17,51,3,234,253,48,140,2,208,140,253,48,
+140,2,208,140,3,72,1,167,254,109,2,112,254,96,1,138,250,54,1,167,254,109,
+2,112,254,96,1,140,255,255,0,160,0,0,3,228,7,10,2,38,2,76,0,0,0,7,4,200,0,
+132,0,0,0,5,0,160,0,0,3,228,5,182,0,5,0,8,0,11,0,15,0,19,0,0,1,1,17,1,1,17,
+1,19,17,1,19,3,1,17,35,17,19,17,35,17,2,66,1,162,254,94,254,94,1,226,232,
+253,176,232,232,1,110,140,140,140,3,91,2,35,250,245,2,35,253,221,5,11,253,
+122,254,222,2,69,253,187,1,34,1,35,1,155,254,229,1,27,251,101,254,229,1,27,
+0,3,0,100,0,0,4,20,5,182,0,18,0,24,0,31,0,0,1,35,17,35,32,36,53,52,54,55,
+38,38,53,16,37,53,33,53,33,1,20,22,51,17,4,17,20,22,23,17,34,6,4,20,195,74,
+254,210,254,231,117,118,117,118,2,5,253,159,3,176,253,56,205,172,254,135,
+183,194,170,207,5,72,250,184,161,166,100,150,45,42,150,101,1,65,10,106,110,
+253,221,108,129,1,191,8,252,234,99,103,5,1,191,131,0,4,0,80,255,226,3,90,
+5,182,0,3,0,7,0,11,0,17,0,0,1,35,17,51,1,35,17,51,19,33,53,33,19,1,55,5,17,
+51,1,24,130,130,1,8,130,130,70,253,234,2,22,244,253,80,41,1,251,140,3,79,
+2,35,253,221,2,35,252,230,120,253,18,1,21,123,217,5,29,0,255,255,0,80,255,
+226,3,254,7,10,2,38,2,80,0,0,0,6,4,200,96,0,0,1,0,80,255,226,3,254,5,194,
+0,25,0,0,5,36,17,55,39,17,37,55,23,17,5,54,18,55,23,6,6,7,23,17,51,17,37,
+22,18,23,3,165,254,121,2,120,254,168,64,150,1,14,35,178,156,73,137,159,21,
+193,140,254,172,4,154,166,10,251,1,235,76,89,252,97,244,100,103,3,182,205,
+158,1,1,103,108,88,245,172,145,1,90,253,164,249,210,254,223,110,0,4,0,140,
+255,230,4,141,5,208,0,18,0,34,0,38,0,42,0,0,1,16,2,6,35,34,38,2,17,16,18,
+54,51,50,18,19,33,21,33,7,16,38,38,35,34,6,6,17,16,18,22,51,50,54,54,1,35,
+17,51,17,35,17,51,3,35,73,147,113,113,148,69,67,145,120,161,160,8,1,108,254,
+150,140,38,84,71,71,82,37,37,83,70,71,84,38,1,101,130,130,130,130,2,221,254,
+220,254,192,147,150,1,67,1,38,1,30,1,49,156,254,225,254,172,120,8,1,8,248,
+123,121,247,254,253,254,249,255,0,128,124,247,2,39,1,104,251,120,1,104,0,
+3,0,100,255,230,4,98,5,208,0,22,0,37,0,48,0,0,1,17,22,23,7,38,39,21,20,6,
+35,34,38,53,16,37,53,37,55,5,17,5,7,1,38,38,53,52,54,54,55,21,6,6,21,20,22,
+23,19,50,54,54,53,53,14,2,21,20,3,47,149,105,51,78,125,149,140,134,165,1,
+192,254,198,40,1,18,1,191,61,253,174,169,198,89,164,114,111,126,125,112,59,
+58,63,28,112,134,62,4,253,253,88,15,54,109,40,17,178,161,163,170,136,1,53,
+13,232,156,109,132,2,9,228,112,254,30,24,207,143,91,163,107,14,119,9,137,
+110,109,134,10,253,75,54,98,104,132,3,43,76,78,188,0,255,255,0,100,255,230,
+3,243,7,10,2,38,2,84,0,0,0,6,4,200,106,0,0,2,0,100,255,230,3,243,5,208,0,
+11,0,22,0,0,1,23,17,37,55,23,17,5,7,39,17,37,19,6,21,20,23,7,38,38,53,16,
+55,1,62,246,254,252,40,220,1,191,61,246,254,65,135,162,165,78,98,119,218,
+1,78,132,2,120,127,109,104,2,10,228,112,129,250,233,248,4,55,103,229,215,
+101,114,60,230,140,1,34,151,0,4,0,100,255,230,4,47,5,208,0,11,0,22,0,26,0,
+30,0,0,1,5,17,37,55,5,17,5,7,39,17,1,19,6,21,20,23,7,38,38,53,16,55,19,35,
+53,51,17,35,53,51,1,22,1,90,254,192,40,1,24,1,191,61,246,253,221,175,162,
+165,78,98,119,218,227,115,115,115,115,1,108,172,2,101,156,109,132,2,38,228,
+112,129,250,233,1,22,4,25,103,229,215,101,114,60,230,140,1,34,151,254,187,
+197,253,51,197,0,3,0,120,255,230,4,96,5,182,0,17,0,36,0,54,0,0,1,20,6,35,
+34,38,53,17,51,17,20,22,51,50,54,53,17,51,1,20,6,6,35,34,38,53,17,51,17,20,
+22,51,50,54,53,17,51,19,20,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,51,
+2,48,105,113,118,104,130,41,50,53,36,130,1,74,70,123,73,128,146,130,69,77,
+67,67,130,230,105,113,118,104,130,41,50,53,36,130,4,94,172,142,140,174,1,
+88,254,165,112,79,71,120,1,91,251,92,95,133,72,159,141,1,190,254,92,108,98,
+102,110,1,158,1,142,172,142,140,174,1,88,254,165,112,79,71,120,1,91,255,255,
+0,140,255,230,4,3,7,10,2,38,2,88,0,0,0,7,4,200,0,146,0,0,0,1,0,140,255,230,
+4,3,5,208,0,23,0,0,1,6,6,35,34,2,17,16,18,51,50,22,23,7,38,35,34,2,17,16,
+18,51,50,19,4,3,55,214,151,223,244,245,222,140,204,59,128,81,196,154,171,
+166,159,213,79,1,97,190,189,1,148,1,107,1,94,1,141,161,161,43,245,254,184,
+254,213,254,192,254,185,1,41,0,0,4,0,120,255,230,4,96,5,182,0,13,0,25,0,43,
+0,61,0,0,1,52,54,54,51,50,22,21,20,6,35,34,38,38,55,20,22,51,50,54,53,52,
+38,35,34,6,19,20,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,51,1,20,6,35,
+34,38,53,17,51,17,20,22,51,50,54,53,17,51,1,4,85,158,114,168,187,189,166,
+113,159,85,130,118,109,108,117,118,107,106,121,170,105,113,118,104,130,41,
+50,53,36,130,2,48,105,113,118,104,130,41,50,53,36,130,1,82,108,175,101,216,
+168,167,197,91,167,106,126,127,127,126,136,138,143,2,87,172,142,140,174,1,
+138,254,115,112,79,71,120,1,141,254,118,172,142,140,174,1,138,254,115,112,
+79,71,120,1,141,0,0,2,0,100,0,0,3,72,5,182,0,37,0,57,0,0,1,38,38,35,34,6,
+21,20,22,23,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,39,38,38,
+53,52,54,51,50,22,23,1,33,50,22,21,17,20,6,35,33,53,33,50,54,53,17,52,38,
+35,33,2,21,42,83,30,53,58,81,98,87,91,142,106,71,136,57,83,29,105,55,53,68,
+80,98,91,88,131,107,52,125,53,253,252,1,242,136,106,105,137,254,14,1,231,
+71,42,45,68,254,25,4,4,47,37,62,54,50,81,52,47,121,78,102,136,69,72,78,47,
+60,71,55,60,85,48,43,114,79,102,126,59,59,1,100,106,144,252,60,143,105,120,
+44,76,3,215,78,41,0,255,255,0,80,255,230,3,226,7,10,2,38,2,92,0,0,0,6,4,200,
+76,0,0,1,0,80,255,230,3,226,5,208,0,11,0,0,19,5,17,37,55,5,17,1,7,37,17,1,
+171,1,56,254,109,61,1,86,1,255,61,254,202,253,255,1,114,168,2,38,231,115,
+196,2,74,254,228,112,175,250,243,1,28,0,0,3,0,160,255,241,3,228,5,186,0,5,
+0,8,0,11,0,0,1,1,17,1,1,17,19,19,3,1,19,17,2,74,1,154,254,101,254,87,122,
+231,231,1,123,213,3,68,2,118,250,55,2,117,253,139,5,201,251,184,1,99,1,100,
+254,157,254,196,2,119,255,255,0,120,0,0,3,244,7,10,2,38,2,95,0,0,0,6,4,200,
+119,0,0,3,0,120,0,0,3,244,5,182,0,41,0,47,0,54,0,0,1,2,5,21,22,22,21,20,6,
+7,21,4,19,7,2,39,17,35,17,6,3,39,18,37,53,38,38,53,52,54,55,53,36,3,55,18,
+23,17,51,17,54,19,1,20,23,17,6,6,5,52,38,39,17,54,54,3,244,98,254,229,179,
+202,198,183,1,26,99,112,71,198,130,194,74,113,101,1,24,174,207,204,177,254,
+232,101,113,74,194,130,199,70,253,118,251,118,133,2,120,133,118,121,130,5,
+134,254,178,34,57,12,137,108,106,139,12,57,36,254,180,38,1,1,37,254,206,1,
+50,35,254,255,39,1,73,36,57,12,138,107,107,139,11,57,36,1,73,39,254,255,35,
+1,48,254,208,37,1,1,253,48,129,17,1,37,8,73,66,66,73,8,254,219,8,77,0,1,0,
+120,0,0,4,31,5,208,0,17,0,0,33,17,37,17,35,17,5,17,37,17,35,17,5,17,5,7,39,
+17,2,91,254,159,130,1,227,254,159,130,1,227,1,196,61,251,1,167,136,254,165,
+2,18,185,1,180,136,254,225,1,214,185,1,105,248,112,139,251,13,0,255,255,0,
+120,255,230,4,0,7,10,2,38,2,98,0,0,0,6,4,200,125,0,0,3,0,120,255,230,4,0,
+5,208,0,36,0,40,0,44,0,0,1,37,17,20,22,51,50,54,53,51,20,6,6,35,34,38,39,
+6,6,35,34,38,38,53,51,20,22,51,50,54,53,53,37,55,5,17,1,3,35,17,51,5,35,17,
+51,3,132,254,254,60,71,66,45,140,47,103,91,77,93,41,44,91,76,90,104,47,140,
+46,65,71,60,254,159,61,1,36,1,203,50,130,130,253,207,130,130,4,96,147,252,
+92,128,113,142,204,192,177,97,50,62,64,48,96,174,196,207,139,113,128,176,
+202,115,168,3,60,255,0,253,223,1,42,47,1,42,0,0,3,0,80,255,230,3,226,5,208,
+0,7,0,19,0,31,0,0,19,5,17,1,7,37,17,1,1,35,21,35,53,35,53,51,53,51,21,51,
+5,35,21,35,53,35,53,51,53,51,21,51,155,1,56,1,255,61,254,202,253,255,3,132,
+102,125,110,110,125,102,253,191,102,125,110,110,125,102,1,114,168,5,6,254,
+228,112,175,250,243,1,28,1,171,193,193,110,178,178,10,193,193,110,178,178,
+0,2,0,180,255,230,4,83,5,182,0,26,0,35,0,0,1,22,51,50,54,53,17,51,17,20,6,
+35,34,39,17,20,6,35,34,38,53,17,51,17,5,17,51,1,50,54,53,17,37,17,20,22,3,
+76,56,29,28,20,130,56,72,57,78,165,168,164,167,140,1,128,140,254,181,104,
+87,254,128,86,3,100,14,45,48,1,170,254,89,127,89,18,254,132,204,194,191,207,
+4,66,254,61,105,2,44,250,168,126,151,1,161,100,253,251,150,127,255,255,0,
+120,0,0,3,212,7,10,2,38,2,102,0,0,0,6,4,200,96,0,0,1,0,120,0,0,3,212,5,182,
+0,19,0,0,1,37,17,37,17,35,17,5,17,39,17,35,17,5,17,51,17,23,17,51,3,212,254,
+152,254,248,140,1,8,220,140,1,104,140,220,140,2,230,196,253,47,156,254,139,
+2,68,152,2,75,120,254,139,2,72,198,1,58,254,121,121,1,110,0,3,0,120,255,230,
+4,60,5,182,0,15,0,26,0,38,0,0,19,5,17,51,17,55,50,22,22,21,20,6,35,39,17,
+1,1,34,7,17,22,51,50,54,53,52,38,5,35,21,35,53,35,53,51,53,51,21,51,215,1,
+56,140,50,114,165,88,195,172,50,253,255,2,51,28,22,22,28,116,121,126,254,
+141,102,125,110,110,125,102,1,114,168,4,236,254,211,3,95,164,105,157,187,
+2,254,28,1,28,3,28,4,254,33,4,118,115,120,134,139,253,253,110,228,228,0,0,
+3,0,120,255,230,4,68,5,208,0,11,0,25,0,39,0,0,1,3,55,19,19,23,3,19,7,3,3,
+39,5,6,4,35,34,36,39,55,22,22,51,50,54,55,17,38,38,35,34,6,7,39,54,36,51,
+50,4,23,2,20,226,95,201,202,95,226,226,93,204,203,93,3,18,52,255,0,178,176,
+254,253,51,113,39,198,134,140,192,44,44,192,140,133,199,39,113,51,1,4,175,
+178,1,1,51,3,0,1,83,74,254,206,1,50,74,254,173,254,170,68,1,49,254,207,68,
+120,158,174,176,153,39,123,135,131,129,3,6,129,131,135,123,39,153,176,174,
+158,255,255,0,80,255,240,3,221,7,10,2,38,2,106,0,0,0,6,4,200,88,0,0,4,0,80,
+255,240,3,221,5,208,0,19,0,28,0,31,0,35,0,0,1,51,21,1,1,7,1,1,39,1,1,53,51,
+53,52,54,51,50,22,21,7,52,38,35,34,6,21,21,33,3,19,33,37,35,53,51,3,66,135,
+254,156,1,120,94,254,151,254,152,94,1,119,254,157,144,161,131,133,165,130,
+82,80,85,83,1,74,170,228,254,57,1,36,120,120,4,21,49,254,59,254,32,79,1,203,
+254,53,79,1,224,1,197,49,152,131,160,158,133,3,86,98,101,92,140,254,111,1,
+35,173,184,0,1,0,100,255,246,3,110,5,194,0,23,0,0,5,38,39,6,7,39,54,18,53,
+52,2,39,55,22,23,54,55,23,6,2,21,20,18,23,3,37,223,93,93,223,73,170,149,158,
+161,73,223,93,92,224,73,162,157,149,170,10,142,222,220,144,108,114,1,41,223,
+225,1,52,101,108,154,217,218,153,108,102,254,203,223,223,254,215,114,0,255,
+255,0,140,0,9,3,246,7,10,2,38,2,109,0,0,0,7,4,200,0,131,0,0,0,4,0,140,0,9,
+3,246,5,208,0,17,0,29,0,41,0,45,0,0,1,22,17,16,2,35,34,2,17,16,55,53,52,54,
+51,50,22,21,1,20,22,51,50,54,53,52,38,35,34,6,1,50,23,53,52,38,35,34,6,21,
+21,54,19,17,35,17,3,104,142,234,203,205,232,142,161,131,133,165,253,176,152,
+143,146,153,153,146,142,153,1,41,90,75,82,80,85,83,75,155,130,3,223,146,254,
+228,254,250,254,222,1,38,1,5,1,25,146,206,131,160,158,133,253,135,211,224,
+220,209,208,222,221,1,85,30,116,86,98,101,92,107,30,254,136,254,180,1,76,
+0,0,3,0,120,255,230,4,178,5,182,0,15,0,33,0,40,0,0,37,17,51,17,1,23,1,22,
+22,21,20,6,7,17,1,55,19,21,20,6,6,35,34,38,39,55,22,22,51,50,54,54,53,53,
+1,52,38,39,17,54,54,2,138,140,1,34,82,254,160,188,204,215,197,253,205,61,
+255,41,91,78,80,113,20,120,9,49,29,33,36,17,2,147,148,134,135,147,202,4,236,
+254,193,1,9,97,254,195,17,173,135,139,175,13,254,144,1,55,112,3,145,245,155,
+133,69,98,81,47,38,68,43,85,118,236,253,127,95,112,9,254,80,9,114,0,255,255,
+0,100,255,226,3,118,7,10,2,38,2,112,0,0,0,6,4,200,71,0,0,2,0,100,255,226,
+3,113,5,182,0,5,0,17,0,0,5,1,55,5,17,51,3,35,17,35,17,35,53,51,17,51,17,51,
+3,113,253,80,41,1,251,140,231,210,130,210,210,130,210,30,1,21,123,217,5,29,
+253,206,254,192,1,64,110,1,82,254,174,0,0,6,0,140,255,230,4,88,5,208,0,31,
+0,44,0,51,0,55,0,59,0,66,0,0,1,20,6,35,34,3,35,21,16,6,6,35,34,38,38,17,53,
+16,54,54,51,50,22,22,17,21,51,54,54,51,50,22,7,52,38,35,34,6,6,21,20,22,51,
+50,54,1,50,54,55,35,22,22,3,51,53,35,17,51,53,35,19,34,6,7,51,38,38,4,88,
+104,98,188,19,70,46,107,95,94,104,47,46,105,96,95,106,45,71,10,107,89,98,
+104,120,40,42,33,39,17,40,43,45,43,253,161,52,50,4,210,4,51,56,213,213,213,
+213,105,50,44,7,204,7,46,2,245,160,163,1,14,76,254,211,236,117,117,231,1,
+50,225,1,43,225,111,111,226,254,217,42,143,138,175,163,135,91,44,84,98,111,
+102,96,253,222,138,142,143,137,2,208,220,253,218,220,2,152,118,106,105,119,
+0,0,1,0,80,0,0,3,227,5,208,0,35,0,0,1,38,38,53,52,54,55,38,38,53,52,54,55,
+23,6,6,21,20,22,51,51,17,5,7,39,17,35,17,35,34,6,21,20,22,22,23,1,57,116,
+117,77,73,71,79,118,115,55,82,66,87,92,149,1,191,61,246,140,149,92,87,29,
+65,54,1,34,45,141,101,70,116,40,37,117,72,102,140,45,111,28,78,80,71,90,2,
+118,228,112,129,251,3,2,236,90,71,59,62,48,17,255,255,0,80,255,230,3,227,
+7,10,2,38,2,116,0,0,0,6,4,200,106,0,0,1,0,80,255,230,3,227,5,208,0,37,0,0,
+1,38,38,53,52,54,55,38,38,53,52,54,55,23,6,6,21,20,22,51,51,17,5,7,39,17,
+37,55,23,17,35,34,6,21,20,22,22,23,1,57,116,117,77,73,71,79,118,115,55,82,
+66,87,92,149,1,191,61,246,254,65,61,246,149,92,87,29,65,54,1,154,45,141,101,
+70,116,40,37,117,72,102,140,45,111,28,78,80,71,90,1,254,228,112,129,250,233,
+248,112,132,2,154,90,71,59,62,48,17,0,1,0,100,0,0,4,93,5,182,0,31,0,0,1,17,
+23,17,51,17,39,17,35,17,39,17,22,18,19,7,38,2,39,17,35,17,6,2,7,39,18,18,
+55,17,23,53,3,107,102,140,242,130,100,175,218,24,137,13,146,126,130,118,142,
+13,137,21,212,172,240,5,182,254,229,41,1,68,254,7,94,254,248,1,59,39,254,
+68,26,254,176,254,237,30,228,1,32,29,253,193,2,60,33,254,231,228,30,1,8,1,
+82,33,2,123,98,230,255,255,0,120,0,0,4,117,7,10,2,38,2,119,0,0,0,7,4,200,
+0,205,0,0,0,6,0,120,0,0,4,117,5,208,0,32,0,37,0,42,0,46,0,50,0,54,0,0,55,
+18,55,37,17,35,17,5,53,38,38,53,52,54,54,51,50,22,21,20,6,7,21,22,22,23,7,
+38,38,35,34,6,7,1,54,54,55,35,33,22,22,23,53,37,38,39,21,39,6,7,51,19,35,
+53,51,255,95,202,254,220,140,1,213,151,170,90,174,123,180,205,169,152,143,
+220,59,123,46,164,112,103,166,48,1,84,81,98,10,189,254,193,9,100,80,1,61,
+25,162,130,163,24,187,173,120,120,73,1,13,77,113,254,170,2,10,177,118,17,
+210,179,127,194,108,228,201,177,212,17,209,6,191,173,34,134,151,147,136,2,
+213,15,121,107,107,121,15,243,120,209,33,242,241,35,206,251,150,247,0,3,0,
+120,0,0,4,117,5,208,0,32,0,43,0,47,0,0,55,18,55,37,17,35,17,5,53,38,38,53,
+52,54,54,51,50,22,21,20,6,7,21,22,22,23,7,38,38,35,34,6,7,19,20,22,51,50,
+54,53,16,35,34,6,1,35,53,51,255,95,202,254,220,140,1,213,151,170,90,174,123,
+180,205,169,152,143,220,59,123,46,164,112,103,166,48,19,133,124,123,132,255,
+122,135,1,108,120,120,73,1,13,77,113,254,170,2,10,177,118,17,210,179,127,
+194,108,228,201,177,212,17,209,6,191,173,34,134,151,147,136,3,249,148,150,
+151,147,1,63,159,251,61,247,0,3,0,80,0,0,4,8,5,208,0,21,0,33,0,43,0,0,33,
+17,33,53,33,53,33,53,33,17,1,7,37,17,33,21,33,21,33,21,33,17,3,20,6,35,34,
+38,53,52,54,51,50,22,7,52,38,35,34,21,20,22,51,50,2,9,254,192,1,64,254,192,
+1,64,1,255,61,254,202,1,82,254,174,1,82,254,174,209,94,90,90,98,99,89,88,
+96,100,41,43,87,42,40,89,1,138,110,180,110,2,182,254,228,112,175,254,39,110,
+180,110,254,118,4,148,111,125,123,113,116,133,135,114,77,68,145,63,70,255,
+255,0,80,255,226,4,29,7,10,2,38,2,123,0,0,0,6,4,200,101,0,0,3,0,80,255,226,
+4,29,5,192,0,21,0,33,0,44,0,0,1,52,38,37,55,22,22,23,17,1,7,39,17,35,17,6,
+6,7,39,36,54,53,7,20,6,35,34,38,53,52,54,51,50,22,7,52,35,34,6,21,20,22,51,
+50,54,2,111,222,254,249,44,168,207,66,1,174,61,229,140,67,197,177,44,1,5,
+224,94,122,100,105,122,126,101,97,125,115,107,54,58,55,51,55,58,2,243,155,
+203,69,124,49,102,63,1,124,254,249,112,143,251,10,1,173,63,99,52,124,68,203,
+156,8,109,134,133,110,115,143,145,113,146,74,72,60,73,71,0,4,0,120,0,0,4,
+43,5,182,0,34,0,46,0,53,0,65,0,0,1,22,22,21,20,6,7,21,22,22,23,7,38,38,39,
+17,35,17,6,6,7,39,54,54,55,53,33,53,33,17,33,53,33,53,51,1,52,54,51,50,22,
+21,20,6,35,34,38,37,52,38,39,17,54,54,37,20,22,51,50,54,53,52,38,35,34,6,
+2,147,172,199,205,166,153,212,43,123,31,146,108,130,103,150,32,124,47,212,
+150,254,103,1,153,254,103,1,153,130,253,239,99,71,70,100,99,71,70,100,3,2,
+132,109,107,134,253,85,47,35,35,48,48,35,35,47,5,43,8,180,153,148,187,9,101,
+23,251,202,38,161,204,26,254,98,1,158,24,206,161,39,206,246,23,100,120,1,
+191,120,138,254,31,70,100,99,71,70,100,99,72,95,119,7,254,66,7,120,96,35,
+47,47,35,35,48,48,0,1,0,120,0,0,3,200,5,182,0,38,0,0,1,38,38,39,6,6,21,20,
+22,51,21,38,36,53,52,55,38,38,53,52,36,55,21,34,6,21,20,22,23,54,54,55,21,
+6,6,21,20,22,23,3,200,202,230,15,123,138,201,189,246,254,228,252,125,127,
+1,26,248,188,202,138,125,24,228,193,154,156,160,150,1,26,29,198,155,27,143,
+107,131,137,119,2,207,178,245,99,47,175,122,178,206,3,119,137,131,108,143,
+28,154,188,25,123,28,167,128,131,160,23,255,255,0,140,255,230,4,49,7,10,2,
+38,2,127,0,0,0,7,4,200,0,156,0,0,0,4,0,140,255,230,4,49,5,208,0,10,0,22,0,
+34,0,46,0,0,1,52,54,51,50,22,21,16,35,34,38,55,20,22,51,50,54,53,52,38,35,
+34,6,5,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,1,
+126,113,109,111,116,227,111,111,120,46,62,52,50,51,57,53,49,2,59,243,223,
+223,244,245,222,224,242,140,169,159,154,171,166,159,158,170,2,238,152,166,
+163,155,254,209,155,148,92,101,92,101,117,89,89,134,254,152,254,113,1,148,
+1,107,1,94,1,141,254,115,254,154,1,53,1,70,254,184,254,213,254,192,254,185,
+1,73,0,3,0,80,0,0,4,57,5,182,0,11,0,22,0,34,0,0,1,1,51,19,19,51,1,1,35,3,
+3,35,1,52,54,51,50,22,21,16,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,
+102,254,234,131,212,213,131,254,234,1,22,131,213,212,131,2,40,113,109,111,
+116,227,111,111,120,46,62,52,50,51,57,53,49,2,219,2,219,253,209,2,47,253,
+37,253,37,2,47,253,209,3,12,152,166,163,155,254,209,155,148,92,101,92,101,
+117,89,89,255,255,0,80,0,0,4,102,7,10,2,38,2,130,0,0,0,7,4,200,0,136,0,0,
+0,1,0,80,0,0,4,102,5,212,0,27,0,0,33,17,37,17,22,18,17,35,52,38,39,17,35,
+17,6,3,7,35,16,18,55,17,1,17,5,7,39,17,3,17,254,192,122,123,130,59,61,130,
+116,3,1,130,124,121,1,204,1,85,58,143,4,63,178,253,201,38,254,222,254,242,
+209,214,39,253,206,2,50,73,254,197,74,1,13,1,36,37,3,26,254,252,1,0,248,104,
+101,251,43,0,0,3,0,100,0,0,4,49,5,208,0,31,0,52,0,56,0,0,19,55,35,53,51,54,
+54,51,50,18,17,20,6,7,22,19,7,38,38,35,34,6,7,39,18,55,38,39,35,53,51,38,
+5,33,22,22,51,50,54,53,52,38,35,34,6,7,33,21,33,7,20,23,33,19,21,35,53,190,
+3,93,110,40,218,159,203,234,129,112,175,75,112,44,175,117,113,172,46,113,
+77,175,160,57,116,96,6,1,219,254,205,32,135,100,146,153,153,146,99,142,32,
+1,57,254,180,3,6,1,73,32,140,3,176,83,110,167,184,254,221,255,0,197,254,57,
+97,254,246,38,159,171,172,156,39,1,5,98,81,211,110,51,161,104,111,220,209,
+208,222,115,116,110,83,61,49,253,185,251,251,0,0,3,0,80,255,230,4,125,5,182,
+0,28,0,37,0,41,0,0,1,39,17,20,6,6,35,34,38,38,53,17,39,17,37,55,23,17,23,
+17,51,17,23,17,51,17,23,17,51,1,50,54,53,17,39,17,20,22,19,35,17,51,4,125,
+218,48,106,89,88,105,48,88,254,233,58,91,218,140,204,140,88,130,254,53,58,
+43,204,42,114,108,108,2,146,115,254,131,168,166,84,83,164,171,2,125,47,254,
+80,168,104,58,1,168,120,1,44,254,135,112,1,233,253,202,48,1,168,251,102,115,
+182,1,200,108,253,204,183,114,1,17,1,74,255,255,0,140,0,0,3,232,7,10,2,38,
+2,134,0,0,0,6,4,200,105,0,0,3,0,140,0,0,3,232,5,202,0,3,0,7,0,15,0,0,33,33,
+53,33,17,33,53,33,55,1,17,35,17,1,17,51,3,112,253,148,2,108,253,148,2,108,
+120,253,48,140,2,208,140,120,1,94,120,168,1,227,254,49,2,192,254,35,1,201,
+0,3,0,140,0,0,3,232,5,202,0,7,0,11,0,15,0,0,1,1,17,35,17,1,17,51,1,35,17,
+51,1,35,17,51,3,232,253,48,140,2,208,140,253,198,130,130,1,154,130,130,2,
+246,1,227,254,49,2,192,254,35,1,201,250,74,2,78,253,178,2,78,255,255,0,110,
+255,182,3,249,7,10,2,38,2,137,0,0,0,6,4,200,106,0,0,3,0,110,255,182,3,249,
+5,202,0,39,0,47,0,51,0,0,37,54,55,38,17,16,55,38,38,39,55,4,23,54,37,23,6,
+6,7,22,17,16,7,22,23,7,36,39,6,7,23,7,39,6,7,39,54,55,39,55,19,20,23,54,53,
+52,39,6,1,35,17,51,1,130,34,37,157,156,77,180,89,18,1,8,155,157,1,6,18,89,
+181,76,156,157,128,219,18,254,252,159,50,44,82,109,88,94,116,18,89,73,136,
+110,194,107,107,107,107,2,65,130,130,229,21,31,184,1,12,1,12,181,63,84,32,
+121,85,126,127,84,121,32,84,63,181,254,244,254,244,184,110,66,121,74,135,
+41,27,128,71,137,45,34,121,28,33,212,70,1,29,210,145,145,210,210,144,141,
+254,139,1,133,0,2,0,100,0,0,4,43,5,208,0,39,0,46,0,0,1,22,22,21,20,5,21,22,
+22,23,7,38,38,39,17,35,17,6,6,7,39,54,54,55,53,33,53,33,53,33,53,33,53,33,
+53,33,17,5,7,39,19,52,38,39,17,54,54,2,152,163,153,254,196,149,210,44,123,
+30,144,106,140,99,148,33,124,44,213,147,254,88,1,168,254,109,1,147,254,88,
+1,168,1,191,61,246,186,85,101,91,95,4,109,5,124,132,251,14,71,23,249,203,
+38,157,204,29,254,99,1,157,25,203,162,39,201,248,25,71,120,91,110,86,120,
+1,98,228,112,129,254,107,67,69,5,254,226,4,63,0,255,255,0,100,255,240,3,191,
+7,10,2,38,2,140,0,0,0,6,4,200,71,0,0,2,0,100,255,240,3,191,5,208,0,49,0,59,
+0,0,1,22,22,51,50,54,53,53,33,53,33,53,33,53,33,53,39,6,35,34,38,53,52,54,
+54,51,50,23,54,55,23,6,7,22,21,21,33,21,33,21,33,21,33,21,20,6,35,34,38,39,
+19,50,55,38,35,34,6,21,20,22,1,16,21,93,53,67,53,254,222,1,34,254,222,1,34,
+2,91,106,118,142,66,116,68,218,88,56,49,124,79,116,9,1,4,254,252,1,4,254,
+252,128,140,93,150,35,218,99,74,40,152,51,71,77,1,1,70,83,102,98,180,110,
+180,110,83,74,41,139,113,61,110,65,220,78,142,26,212,116,59,66,125,110,180,
+110,190,168,142,119,101,3,148,42,206,64,52,64,68,0,0,2,0,80,0,0,3,111,5,182,
+0,19,0,23,0,0,1,3,55,23,55,1,51,19,19,51,1,1,35,3,7,23,7,39,7,35,1,35,17,
+51,1,6,182,109,130,81,254,234,131,212,213,131,254,234,1,22,131,213,63,145,
+109,93,92,131,2,245,130,130,1,113,1,23,71,199,211,2,219,253,209,2,47,253,
+37,253,37,2,47,166,220,71,141,243,1,240,2,78,255,255,0,80,0,0,4,18,7,10,2,
+38,2,143,0,0,0,6,4,200,106,0,0,4,0,80,0,0,4,18,5,208,0,21,0,25,0,29,0,33,
+0,0,55,18,18,55,17,5,7,39,17,22,18,19,7,38,2,39,17,35,17,6,2,7,19,7,37,55,
+37,7,37,55,37,7,37,55,80,21,214,171,1,191,61,246,176,216,24,137,12,147,125,
+130,119,143,12,197,65,254,250,62,1,9,65,254,250,62,1,9,65,254,250,62,50,1,
+1,1,63,29,3,65,228,112,129,253,148,25,254,193,254,249,30,225,1,10,25,253,
+232,2,22,29,254,250,223,3,39,112,143,109,90,112,143,109,100,112,143,109,0,
+2,0,120,0,0,4,36,5,208,0,17,0,21,0,0,1,17,51,17,37,17,35,17,39,17,35,17,5,
+17,5,7,37,17,55,35,53,51,3,152,140,254,72,140,220,140,1,104,2,21,61,254,180,
+217,130,130,2,71,1,153,253,151,239,253,154,2,179,120,254,39,2,172,198,2,152,
+248,112,149,253,238,74,254,0,1,0,80,0,0,4,43,5,182,0,35,0,0,19,51,53,51,21,
+51,17,38,38,39,55,22,22,23,17,51,17,54,54,55,23,6,6,7,17,35,17,35,21,35,53,
+35,21,35,17,51,210,95,130,89,148,212,44,124,32,147,101,140,104,146,30,123,
+44,209,150,140,89,130,95,130,130,2,102,202,202,1,67,25,251,199,39,159,206,
+26,1,146,254,111,26,204,160,38,203,248,25,252,87,1,248,218,218,218,2,18,255,
+255,0,120,0,0,4,120,7,10,2,38,2,147,0,0,0,7,4,200,0,185,0,0,0,1,0,120,0,0,
+4,120,5,182,0,76,0,0,33,35,53,52,38,35,34,6,21,21,35,17,52,55,46,2,53,51,
+20,22,22,51,50,53,53,38,38,53,53,51,21,20,22,51,50,54,53,53,51,21,20,6,7,
+21,20,51,50,54,54,53,51,20,6,7,22,21,17,35,53,52,38,35,34,6,21,21,35,17,52,
+55,38,39,6,7,22,21,2,78,130,39,50,50,41,130,86,43,51,22,140,27,62,62,151,
+111,120,130,82,94,88,76,130,123,106,151,60,64,27,140,59,62,91,130,39,50,50,
+41,130,64,63,43,47,65,70,187,161,110,107,164,187,1,8,205,69,32,106,144,138,
+157,131,59,241,111,24,154,115,206,179,104,103,102,105,179,206,114,154,24,
+112,241,58,133,156,196,183,44,77,194,254,248,187,161,110,107,164,187,1,8,
+180,73,31,65,69,30,80,170,0,2,0,140,255,230,4,4,5,182,0,3,0,30,0,0,1,35,17,
+51,37,35,38,35,32,17,16,18,51,50,54,54,55,23,2,33,34,2,17,16,18,51,50,22,
+23,53,51,2,158,130,130,1,64,130,76,204,254,212,151,149,78,119,93,53,105,161,
+254,227,211,231,229,213,93,143,42,130,1,195,1,184,139,178,253,221,254,237,
+254,220,46,86,90,63,254,233,1,100,1,75,1,73,1,82,54,51,239,0,255,255,0,120,
+0,0,4,42,7,10,2,38,2,150,0,0,0,7,4,200,0,131,0,0,0,1,0,120,0,0,4,42,5,182,
+0,35,0,0,1,51,17,51,17,33,21,33,17,33,21,33,21,33,21,33,53,33,53,33,53,33,
+17,35,17,35,17,35,17,35,17,51,17,51,17,51,1,249,111,140,1,14,254,242,1,14,
+254,242,1,54,253,8,1,54,254,242,1,14,111,130,125,130,130,125,130,4,10,1,172,
+254,84,110,254,28,120,200,120,120,200,120,1,228,254,194,1,62,254,194,2,248,
+254,180,1,76,0,2,0,110,0,0,4,32,5,208,0,17,0,21,0,0,1,51,17,5,7,39,17,33,
+21,33,17,35,17,35,17,35,17,51,3,35,17,51,1,224,129,1,191,61,246,1,17,254,
+239,140,129,130,130,240,130,130,3,38,2,170,228,112,129,254,41,110,253,72,
+2,184,254,159,3,69,252,187,3,69,0,3,0,120,0,0,3,230,5,182,0,43,0,47,0,51,
+0,0,19,51,50,54,55,53,52,38,35,35,53,51,50,23,53,5,17,51,17,37,17,54,51,51,
+21,35,34,6,7,21,20,22,51,51,21,35,34,39,21,35,17,6,35,35,19,35,53,51,1,51,
+21,35,120,24,156,185,4,187,158,24,9,228,132,1,92,130,254,174,132,228,9,24,
+152,189,4,186,159,24,9,228,132,140,132,228,9,184,120,120,1,254,120,120,2,
+197,132,106,10,113,136,110,108,203,218,1,13,254,23,217,254,51,108,110,130,
+110,9,111,137,111,108,227,2,194,108,1,3,200,254,33,200,0,255,255,0,120,0,
+0,3,230,7,10,2,38,2,154,0,0,0,6,4,200,111,0,0,3,0,120,0,0,3,230,5,182,0,43,
+0,58,0,62,0,0,33,35,34,38,39,46,2,53,52,54,54,55,54,54,51,51,21,35,34,6,21,
+20,51,51,21,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,22,51,51,1,20,22,23,
+54,55,38,38,53,52,55,38,39,6,6,19,35,17,51,3,230,98,122,184,21,125,209,119,
+115,205,128,7,149,129,145,145,85,76,153,153,145,85,76,78,83,145,75,114,117,
+66,116,64,60,253,30,168,143,22,100,61,65,92,54,23,161,161,238,130,130,135,
+110,18,137,212,122,129,215,137,17,107,123,120,65,68,153,120,65,68,78,75,120,
+112,104,65,92,51,2,116,145,198,24,128,79,32,122,75,133,66,43,70,29,201,254,
+225,1,54,0,0,3,0,120,0,0,4,120,5,182,0,51,0,55,0,59,0,0,1,20,6,7,21,20,51,
+50,54,54,53,53,51,21,20,14,2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,
+50,53,53,38,38,53,53,51,21,20,22,51,50,54,53,53,51,19,33,53,33,5,33,53,33,
+3,163,123,106,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,67,35,140,
+26,63,62,151,111,120,130,82,94,88,76,130,153,254,136,1,120,253,240,254,136,
+1,120,4,232,114,154,24,203,241,61,144,172,61,81,164,165,96,52,122,122,52,
+96,165,164,81,61,174,142,61,241,202,24,154,115,206,179,104,103,102,105,179,
+250,74,110,110,110,0,255,255,0,80,255,230,3,246,7,10,2,38,2,157,0,0,0,6,4,
+200,121,0,0,2,0,80,255,230,3,246,5,208,0,20,0,40,0,0,19,55,35,53,51,54,54,
+51,50,18,17,21,16,2,35,34,2,3,35,53,51,1,33,17,33,21,33,22,22,51,50,18,53,
+17,52,2,35,34,6,7,33,230,1,151,160,29,197,156,188,204,204,188,171,200,18,
+153,150,1,178,254,218,1,38,254,220,11,127,112,123,129,130,122,100,123,20,
+1,29,3,118,28,120,223,231,254,183,254,210,252,254,210,254,183,1,15,1,3,120,
+1,34,254,222,120,198,212,1,2,243,1,16,245,1,0,168,166,0,5,0,80,255,236,4,
+74,5,182,0,26,0,34,0,42,0,46,0,50,0,0,1,20,14,2,35,34,38,39,35,17,37,55,23,
+17,51,17,51,62,2,51,50,30,2,21,1,50,54,54,55,33,22,22,19,34,6,7,33,46,2,3,
+33,53,33,35,35,21,51,4,74,36,67,106,74,132,135,10,117,254,171,58,143,140,
+116,7,61,117,95,77,106,65,33,254,229,50,60,29,3,254,231,2,65,72,75,63,2,1,
+26,4,29,60,189,1,27,254,229,140,114,114,2,176,192,185,108,59,188,217,253,
+199,248,104,101,4,207,254,29,157,159,83,56,111,188,217,253,226,54,111,120,
+158,127,3,226,124,155,121,105,53,253,179,190,190,0,3,0,80,0,2,4,79,5,207,
+0,6,0,9,0,12,0,0,1,1,33,1,33,1,33,5,1,33,1,3,33,2,80,1,195,254,132,1,184,
+252,1,1,184,254,132,1,195,254,211,2,91,254,210,241,1,227,5,207,253,2,253,
+49,2,207,129,254,42,4,95,254,112,0,255,255,0,100,0,0,4,100,7,10,2,38,2,161,
+0,0,0,7,4,200,0,171,0,0,0,2,0,100,0,0,4,100,5,182,0,19,0,23,0,0,33,17,39,
+17,37,17,35,17,5,17,51,17,55,53,5,17,51,17,37,17,1,23,17,7,2,208,216,254,
+248,140,1,8,140,216,1,8,140,254,248,254,156,216,216,1,167,143,254,163,156,
+254,139,2,68,152,4,10,253,164,143,244,156,1,117,253,188,152,251,246,2,198,
+144,1,36,144,0,4,0,130,255,230,3,254,5,208,0,36,0,49,0,61,0,73,0,0,19,52,
+54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,7,22,22,21,20,6,35,
+34,38,38,53,52,54,55,38,38,19,20,22,51,50,54,53,52,38,39,35,34,6,17,20,22,
+51,50,54,53,52,38,35,34,6,17,20,22,51,50,54,53,52,38,35,34,6,130,85,83,81,
+87,241,206,204,241,84,81,81,84,84,81,81,84,242,203,130,203,114,85,83,81,87,
+130,172,145,142,173,159,142,14,147,170,172,145,142,173,169,146,147,170,172,
+145,142,173,169,146,147,170,2,219,73,122,40,39,122,72,127,162,161,128,73,
+122,39,40,122,72,73,122,39,40,122,72,129,160,73,132,84,73,122,40,39,122,254,
+116,83,95,97,81,81,94,4,97,1,130,83,95,97,81,83,96,97,1,130,83,95,97,81,83,
+96,97,255,255,0,100,0,0,4,46,7,10,2,38,2,164,0,0,0,7,4,200,0,135,0,0,0,3,
+0,100,0,0,4,46,5,208,0,21,0,25,0,29,0,0,33,17,35,53,51,53,35,53,51,17,1,7,
+37,17,51,21,35,21,51,21,35,17,1,51,17,35,1,51,17,35,1,251,177,177,177,177,
+1,252,61,254,205,193,193,193,193,1,37,130,130,252,184,130,130,1,120,110,210,
+110,2,170,254,246,112,167,254,41,110,210,110,254,136,3,82,253,228,2,28,253,
+228,0,0,2,0,180,0,0,3,228,5,182,0,18,0,21,0,0,37,19,3,17,35,17,5,17,51,17,
+37,17,33,21,1,19,7,39,7,19,23,55,1,96,212,244,140,2,55,140,253,201,2,164,
+254,230,212,93,194,194,54,140,140,152,1,13,1,60,253,31,5,122,226,1,30,254,
+44,221,254,102,19,254,147,254,243,78,250,250,2,109,178,178,0,2,0,140,255,
+230,3,244,5,208,0,40,0,58,0,0,1,21,20,6,35,6,6,35,34,46,2,17,53,52,62,2,51,
+50,22,22,23,50,54,54,53,53,51,21,20,6,7,21,20,7,50,54,54,53,53,37,52,38,38,
+35,34,6,6,21,17,20,22,22,51,50,54,54,53,3,244,150,172,22,130,118,78,105,65,
+32,30,65,108,79,96,120,58,5,87,63,31,130,148,161,4,88,64,31,254,193,28,62,
+53,52,61,27,27,60,53,54,61,28,3,17,157,169,140,185,160,67,131,234,1,6,145,
+253,225,132,65,101,201,187,36,84,77,149,157,168,139,2,201,125,114,36,84,77,
+149,206,168,140,69,67,136,164,253,247,168,145,73,71,142,168,255,255,0,80,
+255,226,3,73,7,10,2,38,2,168,0,0,0,6,4,200,26,0,0,2,0,80,255,226,3,71,5,182,
+0,9,0,19,0,0,5,37,55,5,53,37,55,5,53,51,53,37,55,5,53,37,55,5,53,51,3,71,
+253,9,41,2,66,253,179,41,2,36,140,253,9,41,2,66,253,179,41,2,36,140,30,222,
+123,172,176,173,123,163,219,90,222,123,172,176,173,123,163,219,0,4,0,100,
+255,186,3,251,5,208,0,3,0,17,0,21,0,35,0,0,5,35,17,51,5,2,2,35,34,2,7,35,
+18,18,51,50,18,19,1,35,17,51,5,2,2,35,34,2,7,35,18,18,51,50,18,19,2,113,130,
+130,1,8,27,170,134,129,171,27,131,32,240,188,189,238,32,254,118,130,130,1,
+8,27,170,134,129,171,27,131,32,240,188,189,238,32,70,1,60,246,1,0,1,10,254,
+239,249,1,47,1,83,254,180,254,202,3,8,1,60,246,1,0,1,10,254,239,249,1,47,
+1,83,254,180,254,202,0,255,255,0,120,255,240,4,188,7,10,2,38,2,171,0,0,0,
+7,4,200,0,206,0,0,0,2,0,120,255,240,4,188,5,202,0,33,0,36,0,0,19,17,51,1,
+1,23,17,54,54,53,53,51,21,20,6,7,17,54,54,53,53,51,21,20,6,7,17,7,1,1,39,
+1,3,17,5,19,17,120,130,1,25,1,40,114,79,62,130,129,142,79,62,130,129,142,
+114,254,217,254,226,113,1,75,214,1,91,204,3,108,2,74,253,178,2,98,34,254,
+23,2,91,104,149,157,158,140,9,254,70,2,91,104,149,157,158,140,9,254,249,34,
+2,96,253,160,66,2,171,1,185,254,214,144,254,81,3,96,0,1,0,80,0,0,3,211,5,
+181,0,35,0,0,1,39,17,37,17,55,23,7,23,7,39,21,35,53,7,39,55,39,55,23,17,5,
+17,7,39,55,39,55,23,53,51,21,55,23,7,23,3,129,163,254,239,162,84,223,223,
+82,164,140,159,82,222,222,84,157,1,17,160,82,222,222,84,158,140,161,84,223,
+223,3,163,133,254,4,127,254,226,133,79,183,181,82,134,139,135,130,82,181,
+183,79,129,1,217,126,1,57,130,82,181,183,79,129,134,137,132,79,183,181,255,
+255,0,80,255,230,4,4,7,10,2,38,2,174,0,0,0,6,4,200,105,0,0,2,0,80,255,230,
+4,4,5,182,0,11,0,31,0,0,1,1,51,1,1,35,1,3,35,19,1,51,1,6,6,35,34,38,53,52,
+54,55,23,6,6,21,20,22,51,50,54,55,2,72,1,47,141,254,140,1,116,145,254,213,
+134,145,207,254,141,141,1,75,33,142,96,128,134,36,41,107,25,29,69,59,54,88,
+13,3,102,2,80,253,35,253,39,2,76,254,248,1,150,2,220,250,246,97,101,144,143,
+52,138,66,48,43,110,55,80,87,69,56,0,4,0,120,0,0,3,103,5,182,0,49,0,53,0,
+57,0,61,0,0,1,35,34,6,21,20,22,51,51,21,35,34,38,38,53,52,54,55,38,38,53,
+52,54,55,38,38,53,52,54,54,51,51,21,35,34,6,21,20,22,51,51,21,35,34,6,21,
+20,22,51,51,37,35,17,51,53,35,17,51,17,35,17,51,3,103,179,90,117,114,87,185,
+185,101,145,80,79,61,61,79,63,61,57,67,80,145,101,185,185,86,115,117,84,185,
+185,86,115,118,89,179,253,147,130,130,130,130,130,130,1,200,102,84,68,82,
+120,70,125,75,72,131,36,36,131,73,59,115,40,40,122,67,76,124,70,120,82,68,
+79,94,120,82,68,78,95,56,1,11,233,1,11,251,13,1,11,0,255,255,0,120,255,251,
+3,247,7,10,2,38,2,177,0,0,0,7,4,200,0,141,0,0,0,4,0,120,255,251,3,247,5,187,
+0,34,0,38,0,42,0,46,0,0,5,38,38,53,52,55,38,38,53,52,54,55,21,6,6,21,20,22,
+23,54,55,21,6,21,20,23,21,36,39,6,6,21,20,22,23,5,35,17,51,17,35,17,51,17,
+35,17,51,3,3,206,234,252,125,127,230,210,142,158,137,127,36,244,146,146,254,
+254,26,125,135,157,143,253,247,130,130,130,130,130,130,5,21,209,162,245,99,
+47,175,122,159,210,23,119,17,138,118,106,146,27,238,90,143,88,176,177,83,
+136,95,248,27,146,104,116,141,16,22,1,11,2,221,1,11,253,1,1,11,0,0,2,0,180,
+0,0,3,213,5,212,0,11,0,15,0,0,33,17,37,17,35,17,1,17,5,7,39,17,3,35,17,51,
+2,128,254,192,140,1,204,1,85,58,143,235,130,130,4,63,178,251,15,5,212,254,
+252,1,0,248,104,101,251,43,1,236,1,111,255,255,0,80,0,0,3,143,7,10,2,38,2,
+180,0,0,0,6,4,200,31,0,0,1,0,80,0,0,3,143,5,208,0,13,0,0,33,17,33,53,33,17,
+1,7,37,17,33,21,33,17,1,144,254,192,1,64,1,255,61,254,202,1,82,254,174,2,
+102,110,2,252,254,228,112,175,253,225,110,253,154,0,255,255,0,80,0,0,3,168,
+5,182,2,6,4,191,0,0,0,2,0,80,255,230,4,114,5,212,0,13,0,21,0,0,1,17,5,7,39,
+17,35,17,37,17,37,55,23,17,1,23,7,39,17,39,55,23,3,29,1,85,58,143,140,254,
+142,254,165,64,143,1,14,216,53,48,216,53,48,4,208,1,0,248,104,101,251,43,
+4,63,178,250,245,240,100,97,4,251,253,250,111,94,28,254,66,111,94,28,255,
+255,0,140,255,230,3,244,7,10,2,38,2,184,0,0,0,6,4,200,96,0,0,2,0,140,255,
+230,3,244,5,208,0,31,0,49,0,0,1,17,20,6,7,14,3,35,34,46,2,17,53,52,62,2,51,
+50,30,2,21,21,50,54,54,53,17,1,52,38,38,35,34,6,6,21,17,20,22,22,51,50,54,
+54,53,3,244,148,162,3,35,64,105,75,78,105,65,32,30,65,108,79,79,108,64,30,
+86,61,32,254,193,28,62,53,52,61,27,27,60,53,54,61,28,5,65,254,55,168,139,
+2,212,210,120,63,67,131,234,1,6,145,253,225,132,65,66,134,229,253,107,36,
+84,77,1,193,254,158,168,140,69,67,136,164,253,247,168,145,73,71,142,168,0,
+3,0,130,255,245,3,236,5,208,0,17,0,24,0,31,0,0,19,52,18,55,17,1,7,37,17,22,
+18,21,20,2,35,34,38,38,5,50,54,55,33,22,22,19,34,6,7,33,38,38,130,178,154,
+2,0,56,254,196,182,220,239,198,129,199,109,1,179,134,155,9,253,176,10,153,
+131,126,153,14,2,77,14,153,1,238,191,1,0,35,2,0,254,228,113,169,254,238,13,
+254,246,216,230,254,240,123,229,232,174,164,164,174,2,247,161,150,151,160,
+0,3,0,140,255,230,4,49,5,208,0,9,0,21,0,33,0,0,1,17,37,55,23,53,39,55,23,
+17,1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,2,251,
+254,115,61,206,239,72,167,1,184,243,223,223,244,245,222,224,242,140,169,159,
+154,171,166,159,158,170,4,155,252,119,254,112,138,236,190,105,138,1,28,254,
+66,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,1,70,254,184,
+254,213,254,192,254,185,1,73,0,255,255,0,140,255,230,4,49,7,10,2,38,2,188,
+0,0,0,7,4,200,0,161,0,0,0,3,0,140,255,230,4,49,5,208,0,7,0,19,0,31,0,0,1,
+55,23,17,5,7,39,17,1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,2,17,16,
+18,51,50,18,1,101,61,125,1,60,61,135,1,154,243,223,223,244,245,222,224,242,
+140,169,159,154,171,166,159,158,170,1,247,107,98,2,179,229,107,98,253,77,
+1,203,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,1,70,254,
+184,254,213,254,192,254,185,1,73,0,2,0,100,0,0,4,239,5,208,0,44,0,52,0,0,
+19,54,36,51,50,22,21,17,62,2,53,53,51,21,20,6,6,7,21,20,6,6,35,34,38,39,39,
+17,35,17,51,4,51,50,54,54,53,17,52,38,35,34,6,7,5,7,39,17,37,55,23,17,100,
+123,1,25,134,190,185,56,45,19,130,48,107,95,48,112,112,51,130,125,138,140,
+33,1,181,114,70,46,16,107,128,118,244,106,2,95,61,131,254,190,61,131,4,235,
+109,120,207,209,254,220,5,52,116,113,161,131,178,161,96,10,110,144,146,64,
+37,51,52,254,185,2,8,213,31,93,173,1,198,157,153,107,93,166,112,76,254,81,
+162,112,76,1,175,0,255,255,0,80,255,230,3,196,7,10,2,38,2,191,0,0,0,6,4,200,
+70,0,0,3,0,80,255,230,3,196,5,208,0,21,0,28,0,35,0,0,19,5,53,38,38,53,52,
+54,55,17,5,7,37,21,22,22,21,20,6,7,17,1,19,20,22,23,53,6,6,1,52,38,39,21,
+54,54,141,1,56,153,170,169,154,1,255,41,254,182,149,158,160,147,253,255,170,
+102,101,95,108,2,18,99,88,88,99,1,114,168,150,4,119,103,103,119,4,2,172,254,
+112,165,133,8,120,98,100,117,8,253,39,1,28,1,66,60,56,2,233,2,50,1,31,60,
+50,4,231,4,51,0,0,2,0,120,0,0,4,22,5,201,0,27,0,31,0,0,1,7,6,7,22,18,21,17,
+35,17,16,1,0,17,17,35,17,52,18,55,38,39,39,55,22,23,54,55,1,51,17,35,4,22,
+75,177,113,162,153,140,254,239,254,239,140,156,159,113,176,76,53,251,159,
+163,247,254,34,130,130,5,93,45,100,86,153,254,168,220,254,87,1,169,1,114,
+1,7,254,253,254,138,254,87,1,169,223,1,90,148,86,100,45,108,130,126,129,127,
+252,124,254,78,0,2,0,80,255,230,4,136,5,182,0,30,0,39,0,0,1,17,51,17,23,17,
+51,17,23,17,51,17,35,17,39,17,20,6,6,35,34,38,38,53,17,39,17,37,55,23,17,
+1,50,54,53,17,39,17,20,22,1,191,140,204,140,99,130,130,99,48,106,89,88,105,
+48,93,254,238,58,86,1,210,58,43,204,42,4,12,1,170,254,23,91,2,68,253,125,
+45,1,155,252,72,1,155,45,254,215,168,166,84,83,164,171,2,1,42,253,139,160,
+104,50,2,93,251,237,115,182,1,104,92,254,60,183,114,255,255,0,80,255,230,
+4,126,7,10,2,38,2,195,0,0,0,7,4,200,0,191,0,0,0,3,0,80,255,230,4,126,5,208,
+0,31,0,40,0,49,0,0,1,62,2,51,50,22,22,17,21,23,17,51,17,35,17,39,2,6,6,35,
+34,38,38,17,53,39,17,37,55,23,17,1,39,17,20,22,51,50,54,53,3,23,53,52,38,
+35,34,6,21,1,187,4,50,104,88,95,106,45,85,130,130,85,2,48,106,92,94,104,47,
+88,254,238,58,86,2,59,213,50,55,57,51,213,213,51,57,56,49,3,218,210,196,96,
+111,226,254,217,141,47,2,55,251,248,1,73,46,254,242,223,111,117,231,1,50,
+217,48,253,163,160,104,50,2,93,254,59,115,254,223,210,176,173,208,1,179,118,
+199,208,169,167,200,0,0,3,0,80,255,230,3,253,5,208,0,29,0,40,0,51,0,0,37,
+17,35,21,16,14,2,35,34,46,2,17,53,35,53,51,16,54,54,51,50,22,22,17,51,17,
+51,17,1,33,17,20,22,22,51,50,54,54,53,1,33,53,52,38,38,35,34,6,6,21,3,123,
+113,33,66,108,76,78,105,65,32,135,135,54,120,108,106,121,54,113,130,254,129,
+254,229,27,60,53,54,61,28,254,229,1,27,28,62,53,52,61,27,142,2,85,61,254,
+236,228,132,68,67,131,234,1,6,71,120,1,16,238,119,119,237,254,239,1,247,251,
+60,2,85,254,253,168,145,73,71,142,168,1,128,132,168,140,69,67,136,164,255,
+255,0,140,255,230,4,49,7,10,2,38,2,198,0,0,0,7,4,200,0,161,0,0,0,3,0,140,
+255,230,4,49,5,208,0,37,0,49,0,61,0,0,1,54,54,51,50,22,21,20,6,7,22,22,21,
+20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,35,34,7,
+1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,1,136,47,
+112,47,100,117,65,55,77,73,139,108,47,112,47,80,44,83,55,61,91,82,59,43,76,
+83,86,83,44,2,89,243,223,223,244,245,222,224,242,140,169,159,154,171,166,
+159,158,170,4,84,57,49,113,99,67,113,29,25,108,93,102,145,49,57,82,74,73,
+70,79,82,110,72,66,114,74,254,219,254,152,254,113,1,148,1,107,1,94,1,141,
+254,115,254,154,1,53,1,70,254,184,254,213,254,192,254,185,1,73,0,4,0,140,
+255,230,4,140,5,182,0,3,0,7,0,42,0,77,0,0,1,35,53,51,5,35,53,51,3,20,51,50,
+54,54,53,53,51,21,20,14,2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,
+53,53,51,17,20,51,50,54,54,53,53,51,21,20,14,2,35,34,39,6,35,34,46,2,53,53,
+51,21,20,22,22,51,50,53,53,51,1,224,130,130,1,218,130,130,232,151,61,64,26,
+140,35,66,104,76,151,80,82,149,74,105,67,35,140,26,63,62,151,140,151,61,64,
+26,140,35,66,104,76,151,80,82,149,74,105,67,35,140,26,63,62,151,140,2,13,
+237,237,237,254,85,241,61,144,172,111,131,164,165,96,52,122,122,52,96,165,
+164,131,111,174,142,61,241,247,2,141,241,61,144,172,91,111,164,165,96,52,
+122,122,52,96,165,164,111,91,174,142,61,241,227,0,2,0,100,255,230,4,56,5,
+208,0,57,0,71,0,0,1,38,38,53,52,54,55,38,38,53,52,54,55,23,6,6,21,20,22,23,
+53,52,62,2,51,50,30,2,21,21,51,17,51,17,35,17,35,21,16,14,2,35,34,46,2,53,
+53,6,6,21,20,22,22,23,1,52,38,35,34,6,21,17,20,22,51,50,54,53,1,77,116,117,
+77,73,71,79,118,115,55,82,66,84,88,8,43,92,84,84,91,43,8,85,130,130,85,25,
+53,87,63,83,91,43,8,88,84,29,65,54,1,81,41,47,45,40,40,45,47,41,1,14,45,141,
+101,70,116,40,37,117,72,102,140,45,111,28,78,80,70,89,2,15,144,234,167,90,
+89,164,234,145,18,1,141,252,42,1,219,100,254,236,203,118,57,96,174,240,144,
+100,2,89,70,59,62,48,17,2,98,230,147,144,223,253,247,230,156,148,233,0,255,
+255,0,80,255,240,4,152,7,10,2,38,2,202,0,0,0,7,4,200,0,181,0,0,0,3,0,80,255,
+240,4,152,5,193,0,18,0,21,0,25,0,0,1,17,35,17,35,1,1,39,1,1,55,1,1,51,17,
+51,17,51,17,1,19,17,1,17,51,17,4,22,138,45,254,173,254,181,113,1,117,254,
+139,113,1,75,1,83,45,138,130,253,186,174,253,126,130,1,56,1,91,253,93,2,103,
+253,153,66,2,166,2,167,66,253,152,2,104,253,74,1,87,252,214,1,160,254,190,
+2,133,253,229,1,154,254,102,0,0,1,0,110,0,0,4,54,5,208,0,23,0,0,1,39,17,37,
+17,35,17,5,17,38,36,53,53,51,21,20,22,23,53,35,53,51,17,5,3,249,246,254,85,
+140,1,171,236,254,227,130,210,181,217,217,1,191,4,124,128,251,181,204,254,
+131,2,88,222,1,77,13,244,187,205,205,135,174,13,222,110,1,67,228,255,255,
+0,140,255,230,4,41,7,10,2,38,2,205,0,0,0,7,4,200,0,131,0,0,0,2,0,140,255,
+230,4,41,5,208,0,22,0,38,0,0,37,35,17,35,2,2,6,35,34,38,2,17,16,18,54,51,
+50,22,18,19,51,17,51,1,16,38,38,35,34,6,6,17,16,22,22,51,50,54,54,4,41,130,
+152,3,71,141,108,111,142,67,68,140,114,114,137,66,3,153,130,254,90,35,79,
+69,69,77,34,35,77,68,69,79,35,216,1,222,254,218,254,222,136,142,1,52,1,61,
+1,49,1,45,141,137,254,242,254,245,1,216,253,215,1,29,234,116,116,231,254,
+232,254,227,240,122,118,235,0,2,0,80,0,0,3,134,5,182,0,5,0,11,0,0,19,1,17,
+51,17,9,2,17,35,17,1,168,2,42,140,252,242,2,222,253,214,140,3,14,5,91,254,
+38,2,53,252,172,2,141,251,108,1,218,253,203,3,84,253,115,255,255,0,80,0,0,
+4,50,7,10,2,38,2,208,0,0,0,7,4,200,0,140,0,0,0,2,0,80,0,0,4,50,5,182,0,11,
+0,15,0,0,1,1,51,1,1,35,1,1,35,1,1,51,1,51,17,35,2,11,1,47,141,254,140,1,116,
+145,254,213,254,214,145,1,116,254,140,141,2,211,130,130,3,101,2,81,253,35,
+253,39,2,76,253,180,2,217,2,221,254,101,253,134,0,1,0,80,255,230,3,196,5,
+208,0,7,0,0,19,5,17,1,7,37,17,1,141,1,56,1,255,61,254,202,253,255,1,114,168,
+5,6,254,228,112,175,250,243,1,28,0,255,255,0,80,0,0,3,202,7,10,2,38,2,211,
+0,0,0,6,4,200,79,0,0,2,0,80,0,0,3,202,5,208,0,11,0,23,0,0,19,1,1,55,1,1,23,
+1,1,7,9,2,33,17,35,17,33,53,33,17,51,17,33,80,1,98,254,158,76,1,113,1,113,
+76,254,157,1,99,79,254,146,254,146,2,234,254,202,130,254,192,1,64,130,1,54,
+3,44,1,38,1,37,89,254,205,1,51,89,254,219,254,218,83,1,46,254,210,254,173,
+254,122,1,134,110,1,82,254,174,0,0,2,0,120,0,0,4,26,5,204,0,15,0,19,0,0,1,
+39,17,35,17,33,17,35,17,39,17,35,17,1,17,51,1,33,17,37,4,26,166,130,254,226,
+130,78,140,3,22,140,253,186,1,30,254,226,3,82,89,252,85,1,225,254,31,4,207,
+42,254,99,2,112,254,96,1,139,252,162,1,151,153,0,255,255,0,120,0,0,4,139,
+7,10,2,38,2,214,0,0,0,7,4,200,0,165,0,0,0,4,0,120,0,0,4,139,5,212,0,3,0,7,
+0,21,0,30,0,0,1,7,37,55,19,7,37,55,5,39,17,35,32,36,53,52,54,36,51,51,17,
+5,1,34,6,21,20,22,51,51,17,2,42,65,254,250,62,195,65,254,250,62,3,135,231,
+144,254,217,254,180,153,1,20,174,28,1,156,254,51,209,233,229,213,49,4,233,
+112,143,109,254,152,112,143,109,31,122,251,12,234,210,136,206,112,2,82,225,
+254,23,176,158,156,168,2,146,0,5,0,180,0,0,3,182,5,182,0,3,0,7,0,11,0,15,
+0,23,0,0,1,35,17,51,1,35,17,51,1,35,17,51,1,35,17,51,3,37,17,35,17,5,17,51,
+2,84,130,130,1,98,130,130,254,158,130,130,1,98,130,130,63,253,201,140,2,55,
+140,2,96,1,64,254,192,1,64,252,214,1,64,254,192,1,64,2,44,221,251,65,5,122,
+226,1,30,0,0,7,0,40,0,0,3,252,5,182,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,0,
+1,33,17,35,17,33,53,33,1,7,37,55,5,7,37,55,1,7,37,55,37,7,37,55,5,7,37,55,
+1,7,37,55,3,252,254,92,140,254,92,3,212,253,127,65,254,250,62,3,129,65,254,
+250,62,254,145,65,254,250,62,1,9,65,254,250,62,3,129,65,254,250,62,1,9,65,
+254,250,62,5,62,250,194,5,62,120,254,114,112,143,109,140,112,143,109,252,
+214,112,143,109,190,112,143,109,140,112,143,109,254,42,112,143,109,0,255,
+255,0,80,0,0,4,28,7,10,2,38,2,218,0,0,0,6,4,200,120,0,0,4,0,80,0,0,4,28,5,
+208,0,7,0,21,0,25,0,29,0,0,1,33,17,35,17,33,53,33,55,38,38,35,34,6,7,39,54,
+36,51,50,4,23,1,35,17,51,1,35,17,51,3,169,254,212,140,254,212,2,228,3,44,
+192,140,133,199,39,113,51,1,4,175,178,1,1,51,253,73,130,130,2,38,130,130,
+3,124,252,132,3,124,120,106,129,131,135,123,39,153,176,174,158,252,58,1,234,
+254,22,1,234,0,4,0,140,0,0,3,232,5,202,0,7,0,11,0,15,0,19,0,0,1,1,17,35,17,
+1,17,51,1,35,17,51,1,35,17,51,39,35,17,51,3,232,253,48,140,2,208,140,253,
+198,130,130,1,154,130,130,205,130,130,3,90,1,157,254,119,2,92,254,107,1,129,
+250,74,1,164,254,92,1,164,130,1,114,0,2,0,100,0,0,4,61,5,182,0,30,0,33,0,
+0,1,33,17,37,17,51,17,51,17,35,17,35,17,37,17,33,21,33,53,33,17,5,39,37,37,
+55,5,17,33,53,33,1,23,53,3,107,254,202,1,11,123,130,130,123,254,245,1,54,
+253,8,1,54,254,246,59,1,35,254,221,59,1,10,254,202,2,248,254,201,148,5,62,
+254,118,223,254,201,1,18,253,113,1,15,254,199,222,253,229,120,120,2,56,221,
+94,243,243,94,222,1,167,120,253,110,124,248,255,255,0,80,0,0,4,58,7,10,2,
+38,2,222,0,0,0,7,4,200,0,140,0,0,0,5,0,80,0,0,4,58,5,182,0,11,0,15,0,19,0,
+23,0,27,0,0,1,1,51,19,19,51,1,1,35,3,3,35,1,35,17,51,19,35,17,51,3,35,17,
+51,55,35,17,51,1,102,254,234,131,212,213,131,254,234,1,22,131,213,212,131,
+3,0,130,130,234,130,130,234,130,130,234,130,130,2,219,2,219,253,209,2,47,
+253,37,253,37,2,47,253,209,3,72,1,64,252,204,1,64,254,192,1,64,180,1,64,0,
+4,0,80,0,0,4,81,5,182,0,11,0,15,0,19,0,23,0,0,1,1,51,19,19,51,1,1,35,3,3,
+35,1,35,17,51,19,35,17,51,19,33,53,33,1,102,254,234,131,212,213,131,254,234,
+1,22,131,213,212,131,3,0,130,130,234,130,130,23,254,102,1,154,2,219,2,219,
+253,209,2,47,253,37,253,37,2,47,253,209,2,238,1,104,254,152,1,104,253,180,
+110,0,255,255,0,120,255,230,4,48,7,10,2,38,2,225,0,0,0,7,4,200,0,131,0,0,
+0,2,0,120,255,230,4,48,5,182,0,34,0,46,0,0,1,33,21,22,22,21,20,6,35,34,38,
+53,52,54,55,53,33,53,33,53,33,53,33,17,5,53,51,17,37,21,33,21,33,21,33,1,
+20,22,51,50,54,53,52,38,35,34,6,4,19,254,137,192,212,251,224,225,252,216,
+192,254,137,1,119,254,167,1,89,1,92,130,254,174,1,89,254,167,1,119,252,231,
+182,165,163,182,180,165,166,181,2,192,75,15,173,138,152,177,178,151,139,174,
+13,75,110,105,110,1,128,148,197,254,138,147,206,110,105,254,1,105,113,112,
+106,105,114,115,0,1,0,80,255,249,4,3,5,183,0,36,0,0,19,22,22,23,17,35,53,
+51,17,51,17,51,21,35,17,54,54,55,23,2,7,22,19,7,38,38,35,34,6,7,39,54,54,
+55,38,38,39,204,32,146,104,224,224,140,220,220,105,143,30,123,67,198,198,
+67,123,38,185,129,127,185,36,124,33,135,100,100,135,33,3,154,160,205,26,2,
+43,110,1,11,254,245,110,253,214,28,204,158,38,254,200,115,115,254,201,38,
+192,207,215,184,39,147,220,58,58,220,148,0,255,255,0,140,255,230,4,30,7,10,
+2,38,2,228,0,0,0,7,4,200,0,140,0,0,0,4,0,140,255,230,4,30,5,208,0,26,0,35,
+0,41,0,48,0,0,19,52,18,51,50,18,17,20,2,7,21,20,22,51,50,54,55,23,6,6,35,
+34,38,53,53,38,2,55,20,23,33,54,53,52,39,33,1,34,6,7,33,38,3,50,54,55,33,
+22,22,140,233,204,203,234,211,186,57,63,57,115,33,112,55,166,98,135,123,161,
+176,140,6,2,70,6,4,253,181,1,36,99,142,32,2,37,64,212,93,143,35,253,230,32,
+135,3,176,254,1,34,254,221,255,0,248,254,224,15,86,102,108,96,79,55,115,125,
+144,176,105,34,1,30,225,61,49,48,56,47,42,1,85,115,116,231,252,165,101,114,
+104,111,0,4,0,80,255,230,4,73,5,182,0,28,0,33,0,40,0,44,0,0,1,17,20,22,51,
+50,54,55,23,14,2,35,34,38,53,53,38,38,53,52,54,55,38,38,53,52,36,51,17,4,
+21,20,33,1,20,22,23,17,6,6,37,17,35,17,2,198,57,63,46,69,40,112,53,70,87,
+59,135,123,239,244,94,99,103,97,1,7,227,254,159,1,97,254,152,171,189,178,
+182,2,218,130,5,182,251,122,102,108,78,97,55,110,85,45,144,176,21,2,159,148,
+88,130,51,44,128,89,140,168,253,148,13,205,198,2,216,100,95,3,1,141,4,103,
+23,254,64,1,192,0,255,255,0,80,255,230,4,28,7,10,2,38,2,231,0,0,0,6,4,200,
+127,0,0,3,0,80,255,230,4,28,5,208,0,20,0,32,0,46,0,0,19,52,54,54,55,17,5,
+7,37,21,30,2,21,20,6,6,35,34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,1,6,
+4,35,34,36,39,55,22,22,51,50,54,55,116,94,174,118,2,20,46,254,166,120,173,
+93,112,204,139,142,205,110,140,160,157,154,161,162,153,156,161,3,28,52,255,
+0,178,176,254,253,51,113,39,198,134,140,192,44,2,192,89,154,99,11,1,175,200,
+114,134,251,12,99,155,87,99,164,93,90,165,101,114,121,120,115,117,119,121,
+253,255,158,174,176,153,39,123,135,131,129,0,2,0,80,255,230,4,20,5,208,0,
+31,0,38,0,0,1,51,53,51,17,35,53,35,21,35,53,35,17,37,55,23,53,38,38,53,52,
+54,54,55,17,5,7,39,17,51,53,51,1,20,22,23,17,6,6,3,61,85,130,130,85,130,83,
+254,65,61,246,179,217,94,178,124,1,191,61,246,83,130,253,159,132,124,118,
+138,3,46,202,253,238,218,218,218,253,38,248,112,132,152,18,223,159,106,174,
+108,12,1,78,228,112,129,254,49,202,254,250,113,149,17,2,46,15,147,255,255,
+0,155,0,0,3,195,7,10,2,38,2,234,0,0,0,6,4,200,77,0,0,1,0,180,0,0,3,195,5,
+202,0,21,0,0,1,51,17,51,17,35,17,35,17,35,17,35,17,35,17,1,7,37,17,51,17,
+51,2,108,125,130,130,125,130,170,140,3,15,41,253,166,170,130,2,152,1,26,253,
+58,1,62,254,194,1,62,253,214,5,202,254,250,123,199,253,136,1,26,0,6,0,100,
+255,226,4,113,5,202,0,3,0,7,0,11,0,15,0,19,0,23,0,0,1,1,55,1,3,1,55,1,3,1,
+55,9,2,23,1,3,1,23,1,3,1,23,1,4,36,254,122,77,1,134,77,254,122,77,1,134,77,
+254,122,77,1,134,251,243,1,134,77,254,122,77,1,134,77,254,122,77,1,134,77,
+254,122,4,43,1,70,89,254,190,253,127,1,70,89,254,190,253,126,1,70,89,254,
+190,4,73,1,66,89,254,186,254,57,1,66,89,254,186,254,56,1,66,89,254,186,0,
+255,255,0,80,0,0,3,167,7,10,2,38,2,237,0,0,0,6,4,200,81,0,0,2,0,80,0,0,3,
+167,5,182,0,18,0,21,0,0,19,5,17,5,17,51,17,37,17,37,17,37,17,35,17,5,39,37,
+37,1,53,7,139,1,42,1,92,130,254,174,1,102,254,154,140,254,214,59,1,58,254,
+198,2,213,194,3,73,186,2,244,218,1,13,254,23,217,253,241,228,253,81,227,254,
+81,1,183,185,94,199,200,254,192,241,121,0,2,0,120,0,0,3,152,5,182,0,18,0,
+27,0,0,19,51,21,1,35,34,38,38,53,52,54,51,33,17,35,17,1,17,35,19,20,22,51,
+33,17,33,34,6,120,130,1,127,99,114,184,105,216,187,1,130,140,253,238,130,
+141,147,116,1,0,255,0,115,148,2,180,221,1,48,85,157,103,160,182,250,74,2,
+225,254,91,254,196,4,96,102,123,1,191,122,255,255,0,120,0,0,4,23,7,10,2,38,
+2,240,0,0,0,7,4,200,0,146,0,0,0,2,0,120,0,0,4,23,5,208,0,24,0,33,0,0,1,14,
+2,21,17,35,17,52,54,54,55,17,52,54,51,50,22,21,17,35,17,5,17,35,19,37,53,
+52,38,35,34,6,21,1,127,57,49,27,130,53,105,105,165,168,164,167,140,254,128,
+140,140,1,128,86,107,104,87,2,184,7,24,44,36,254,66,1,187,75,95,53,12,1,17,
+204,194,191,207,251,190,2,240,41,253,57,3,63,38,222,150,127,126,151,0,2,0,
+100,255,230,4,36,5,182,0,15,0,19,0,0,19,23,17,23,53,33,53,33,21,33,21,5,7,
+37,17,37,37,35,17,51,161,246,179,254,207,2,228,254,207,1,88,61,254,60,254,
+65,3,70,130,130,1,78,132,4,2,73,187,120,120,239,139,112,185,251,217,248,26,
+1,230,0,255,255,0,80,0,0,4,6,7,10,2,38,2,243,0,0,0,6,4,200,116,0,0,5,0,80,
+0,0,4,6,5,182,0,3,0,7,0,11,0,15,0,19,0,0,1,17,35,17,33,17,35,17,1,33,53,33,
+3,17,35,17,33,17,35,17,3,112,130,254,122,130,3,32,252,74,3,182,150,130,254,
+122,130,5,182,254,26,1,230,254,26,1,230,253,0,120,254,184,254,26,1,230,254,
+26,1,230,0,3,0,100,0,0,3,215,5,182,0,33,0,37,0,41,0,0,1,62,2,53,52,38,35,
+35,17,35,17,51,17,51,50,54,53,52,38,39,55,22,22,21,20,6,7,22,22,21,20,6,7,
+5,35,17,51,17,35,17,51,2,183,56,64,28,88,91,149,140,140,149,91,88,66,82,55,
+116,117,78,72,73,77,118,115,253,248,130,130,130,130,1,145,18,48,63,57,71,
+90,253,20,5,182,253,164,90,71,81,77,28,111,45,141,101,72,116,38,39,117,70,
+102,140,45,32,1,121,1,4,1,121,255,255,0,180,255,230,4,197,7,10,2,38,2,246,
+0,0,0,7,4,200,0,190,0,0,0,4,0,180,255,230,4,197,5,182,0,42,0,51,0,55,0,59,
+0,0,1,51,50,54,53,52,38,39,55,22,22,21,20,6,7,22,22,21,20,6,7,39,62,2,53,
+52,38,35,35,17,20,6,35,34,38,53,17,51,17,33,17,51,1,50,54,53,17,33,17,20,
+22,19,35,17,51,17,35,17,51,3,76,58,91,88,66,82,55,116,117,78,72,73,77,118,
+115,55,56,64,28,88,91,58,165,168,164,167,140,1,128,140,254,181,104,87,254,
+128,86,171,130,130,130,130,3,132,90,71,81,77,28,111,45,141,101,72,116,38,
+39,117,70,102,140,45,111,18,48,63,57,71,90,254,94,204,194,191,207,4,66,253,
+206,2,50,250,168,126,151,1,163,254,93,150,127,1,18,1,4,1,174,1,4,0,0,1,0,
+180,255,230,4,197,5,182,0,47,0,0,1,51,50,54,53,52,38,39,55,22,22,21,20,6,
+7,22,22,21,20,6,7,39,62,2,53,52,38,35,35,17,20,6,35,34,38,53,17,51,17,20,
+22,51,50,54,53,17,51,3,76,58,91,88,66,82,55,116,117,78,72,73,77,118,115,55,
+56,64,28,88,91,58,165,168,164,167,140,86,107,104,87,140,3,132,90,71,81,77,
+28,111,45,141,101,72,116,38,39,117,70,102,140,45,111,18,48,63,57,71,90,254,
+94,204,194,191,207,4,66,251,189,150,127,126,151,4,67,0,0,2,0,80,255,230,4,
+6,5,182,0,7,0,19,0,0,55,55,5,17,5,7,37,17,1,33,21,35,53,33,53,33,53,51,21,
+33,80,61,1,88,2,33,61,254,168,1,8,254,232,130,254,232,1,24,130,1,24,221,112,
+154,3,0,247,112,154,253,0,4,202,163,163,110,152,152,255,255,0,80,255,230,
+4,6,7,10,2,38,2,250,0,0,0,6,4,200,100,0,0,2,0,80,255,230,4,6,5,182,0,15,0,
+27,0,0,55,55,5,53,33,53,33,17,5,7,37,21,33,21,33,17,1,33,21,35,53,33,53,33,
+53,51,21,33,80,61,1,88,254,126,1,130,2,33,61,254,168,1,108,254,148,1,8,254,
+232,130,254,232,1,24,130,1,24,221,112,154,251,110,1,151,247,112,154,202,110,
+254,56,4,202,163,163,110,152,152,0,5,0,80,0,0,3,220,5,202,0,35,0,39,0,43,
+0,47,0,51,0,0,1,37,17,35,17,35,34,6,21,20,22,22,23,7,38,38,53,52,54,55,38,
+38,53,52,54,55,23,6,6,21,20,22,51,51,17,5,3,35,17,51,19,35,17,51,3,35,17,
+51,19,35,17,51,3,173,254,123,140,13,92,87,29,65,54,55,116,117,77,73,71,79,
+118,115,55,82,66,87,92,13,2,58,218,130,130,224,130,130,224,130,130,224,130,
+130,4,136,136,250,240,2,216,90,71,59,62,48,17,111,45,141,101,70,116,40,37,
+117,72,102,140,45,111,28,78,80,71,90,2,132,199,253,241,1,21,254,235,1,21,
+252,237,1,21,254,235,1,21,0,255,255,0,100,0,0,4,98,7,10,2,38,2,253,0,0,0,
+7,4,200,0,166,0,0,0,1,0,100,0,0,4,98,5,182,0,54,0,0,37,55,39,55,23,17,6,35,
+34,38,39,51,22,22,51,50,54,55,38,3,51,22,22,51,50,54,55,51,6,6,7,22,22,51,
+50,54,55,51,14,2,35,34,39,17,55,23,7,23,7,39,17,35,17,7,1,17,249,249,84,189,
+65,101,138,137,5,140,4,61,83,78,74,2,212,5,140,6,63,80,82,65,4,140,4,113,
+106,5,68,79,80,64,4,140,4,59,120,97,101,65,193,84,249,249,82,195,130,191,
+191,203,204,79,155,1,24,51,183,220,168,115,109,109,42,1,75,149,109,117,141,
+174,177,20,111,109,120,163,157,161,85,51,254,229,158,79,204,203,82,159,254,
+244,1,9,156,0,255,255,0,120,255,230,4,8,7,10,2,38,2,255,0,0,0,7,4,200,0,136,
+0,0,0,2,0,120,255,230,4,8,5,182,0,22,0,34,0,0,19,52,54,54,55,17,5,17,51,17,
+37,17,30,2,21,20,6,6,35,34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,120,94,
+174,118,1,92,130,254,174,120,173,93,112,204,139,142,205,110,140,160,157,154,
+161,162,153,156,161,1,74,89,154,99,11,2,136,218,1,93,253,199,217,254,85,12,
+99,155,87,99,164,93,90,165,101,114,121,120,115,117,119,121,255,255,0,113,
+0,0,3,93,7,10,2,38,3,1,0,0,0,6,4,200,35,0,0,3,0,140,0,0,3,93,5,182,0,5,0,
+17,0,21,0,0,51,17,5,7,37,17,1,33,21,35,53,33,53,33,53,51,21,33,3,35,17,51,
+174,2,175,53,254,18,2,4,254,232,130,254,232,1,24,130,1,24,125,130,130,4,40,
+248,115,182,252,141,4,176,163,163,110,152,152,251,154,1,200,0,255,255,0,100,
+0,0,4,98,7,10,2,38,3,3,0,0,0,7,4,200,0,166,0,0,0,2,0,100,0,0,4,98,5,182,0,
+34,0,46,0,0,1,35,21,20,22,51,50,54,55,51,6,6,35,34,39,6,35,34,38,39,51,22,
+22,51,50,54,53,53,35,53,51,53,51,21,51,19,33,17,35,17,33,53,33,53,51,21,33,
+3,118,210,81,75,83,63,4,140,4,137,139,151,80,82,149,138,137,5,140,4,64,82,
+76,80,210,210,130,210,100,254,202,130,254,202,1,54,130,1,54,4,130,182,111,
+117,118,165,219,184,122,122,183,220,170,113,122,119,169,110,198,198,252,40,
+254,232,1,24,110,208,208,0,0,2,0,100,0,0,4,52,5,182,0,61,0,73,0,0,37,33,21,
+35,53,33,53,33,53,33,53,33,53,38,39,6,35,34,38,53,53,51,21,20,22,51,50,55,
+53,51,21,20,22,51,50,54,53,53,51,21,7,22,51,50,54,53,53,51,21,20,6,35,34,
+39,6,7,21,33,21,33,21,33,3,35,21,35,53,35,53,51,53,51,21,51,3,230,254,172,
+140,254,172,1,84,254,202,1,54,117,40,37,56,84,84,120,25,30,44,24,120,65,63,
+57,65,120,1,25,44,29,26,120,84,84,58,36,39,117,1,54,254,202,1,84,185,160,
+130,160,160,130,160,250,250,250,110,110,110,122,29,128,26,115,107,145,145,
+66,46,17,172,135,92,101,98,86,144,159,13,17,45,67,145,145,108,114,26,124,
+32,123,110,110,3,87,160,160,110,137,137,0,255,255,0,180,255,230,4,52,7,10,
+2,38,3,6,0,0,0,7,4,200,0,179,0,0,0,3,0,180,255,230,4,52,5,182,0,15,0,23,0,
+31,0,0,1,20,6,6,35,34,46,2,53,17,51,17,33,17,51,1,62,3,53,17,35,1,20,30,2,
+23,17,35,4,52,90,200,161,123,171,103,48,140,2,104,140,254,129,90,98,47,8,
+243,254,139,8,47,98,90,243,2,47,243,232,110,63,124,204,194,3,135,254,209,
+1,47,250,171,10,74,117,153,88,1,244,254,12,88,153,116,75,10,3,174,0,5,0,100,
+0,0,3,212,5,183,0,15,0,22,0,29,0,42,0,55,0,0,1,52,54,55,38,38,53,52,54,54,
+51,51,17,35,34,36,55,20,22,23,17,6,6,17,20,22,23,17,6,6,3,38,38,53,52,54,
+55,21,6,6,21,20,23,17,38,38,53,52,54,55,21,6,6,21,20,23,1,147,114,114,111,
+117,126,239,158,54,54,244,254,233,140,159,138,144,153,153,144,137,160,202,
+115,126,132,109,53,63,116,115,126,132,109,53,63,116,1,131,114,177,53,51,178,
+116,115,176,96,250,73,212,175,114,143,4,2,33,18,143,2,54,124,143,18,2,34,
+4,143,254,122,23,155,117,113,164,22,120,16,94,69,145,33,252,207,23,155,117,
+113,164,22,120,16,94,69,145,33,0,255,255,0,123,0,0,3,108,7,10,2,38,3,9,0,
+0,0,6,4,200,45,0,0,2,0,180,0,0,3,108,5,182,0,16,0,25,0,0,1,37,23,5,22,22,
+21,20,6,7,5,7,37,17,35,17,51,1,52,38,38,39,7,17,23,36,1,64,1,249,51,254,157,
+154,153,154,154,1,100,51,254,7,140,140,1,122,81,139,153,5,6,1,116,4,88,234,
+91,172,36,181,135,132,181,39,172,91,234,254,162,5,182,253,37,89,107,53,8,
+2,254,2,3,4,0,4,0,140,255,230,4,49,5,208,0,11,0,23,0,51,0,55,0,0,1,16,2,35,
+34,2,17,16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,1,51,53,51,21,51,
+21,35,17,51,21,35,21,35,53,35,21,35,53,35,53,51,17,35,53,51,53,51,17,51,17,
+35,4,49,243,223,223,244,245,222,224,242,140,169,159,154,171,166,159,158,170,
+254,112,146,107,80,80,80,80,107,146,107,80,80,80,80,107,146,146,2,221,254,
+152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,1,70,254,184,254,
+213,254,192,254,185,1,73,2,77,175,175,110,254,182,110,191,191,191,191,110,
+1,74,110,175,253,153,1,74,255,255,0,180,255,230,4,52,7,10,2,38,3,12,0,0,0,
+7,4,200,0,181,0,0,0,4,0,180,255,230,4,52,5,182,0,24,0,28,0,32,0,36,0,0,1,
+20,6,6,35,34,46,2,53,17,51,17,20,30,2,51,50,62,2,53,17,51,1,35,17,51,39,35,
+17,51,1,35,17,51,4,52,90,200,161,123,171,103,48,140,11,59,125,115,86,117,
+70,33,140,254,129,130,130,130,130,130,1,4,130,130,2,47,243,232,110,63,124,
+204,194,3,135,252,101,96,163,119,67,42,81,144,178,3,155,251,201,1,120,203,
+1,84,254,172,1,84,0,2,0,80,255,230,4,22,5,182,0,13,0,27,0,0,33,35,17,33,17,
+37,55,23,17,51,17,33,17,51,1,6,6,21,20,23,7,38,38,53,52,54,54,55,4,22,140,
+254,249,254,165,64,143,140,1,7,140,253,113,86,95,115,69,87,89,74,141,96,2,
+238,252,248,240,100,97,4,221,253,176,2,80,252,79,16,117,96,157,56,94,43,161,
+103,88,148,95,10,255,255,0,120,0,0,4,79,7,10,2,38,3,15,0,0,0,7,4,200,0,165,
+0,0,0,5,0,120,0,0,4,79,5,208,0,23,0,32,0,39,0,46,0,50,0,0,19,52,18,51,50,
+18,17,20,6,7,22,19,35,38,38,35,32,3,35,54,54,55,38,38,55,20,23,33,54,53,52,
+39,33,1,34,6,7,33,38,38,3,50,54,55,33,22,22,19,35,53,51,175,233,204,203,234,
+127,110,255,36,141,22,176,154,254,204,42,140,17,149,126,109,128,140,5,2,72,
+5,4,253,181,1,36,102,138,30,2,31,35,144,94,93,143,35,253,230,32,135,166,130,
+130,3,176,254,1,34,254,221,255,0,195,253,58,96,254,173,180,169,254,163,168,
+220,47,57,254,198,42,58,55,39,47,42,1,85,115,106,117,104,252,165,101,114,
+104,111,254,3,228,0,0,3,0,120,0,0,3,227,5,208,0,3,0,7,0,13,0,0,19,35,17,51,
+17,35,17,51,19,17,1,7,37,17,250,130,130,130,130,234,1,255,61,254,202,3,151,
+1,164,251,180,1,164,253,109,5,208,254,228,112,175,251,13,0,255,255,0,80,255,
+187,4,172,7,10,2,38,3,18,0,0,0,7,4,200,0,224,0,0,0,2,0,80,255,187,4,172,5,
+182,0,32,0,46,0,0,1,20,6,35,34,38,38,39,55,22,22,51,50,54,53,17,38,2,39,51,
+22,22,23,17,51,17,54,54,55,51,6,2,7,1,6,6,21,20,23,7,38,38,53,52,54,54,55,
+2,231,106,108,59,97,66,9,116,20,50,33,48,38,179,234,40,140,30,159,124,140,
+117,160,33,143,41,236,176,254,160,86,95,115,69,87,89,74,141,96,1,38,167,153,
+58,115,67,43,92,71,98,112,2,30,22,1,18,241,177,214,24,1,238,254,19,25,212,
+177,237,254,236,24,254,133,16,117,96,157,56,94,43,161,103,88,148,95,10,0,
+2,0,104,255,230,4,87,5,182,0,40,0,50,0,0,1,2,5,21,20,7,22,21,20,7,39,54,53,
+52,39,6,6,35,34,38,53,52,54,51,50,23,55,53,38,2,3,51,18,18,23,17,51,17,54,
+18,19,1,50,55,38,35,34,6,21,20,22,4,87,54,254,148,6,122,82,78,41,34,38,157,
+117,100,140,151,119,88,89,2,188,204,23,139,15,133,128,140,126,131,20,253,
+144,155,38,72,82,66,85,61,5,142,253,119,49,201,55,49,104,134,106,101,70,63,
+65,57,53,110,128,137,99,111,141,34,67,159,25,1,81,1,80,254,248,254,229,28,
+2,103,253,153,30,1,33,1,0,251,22,215,33,68,64,53,63,0,0,2,0,80,255,230,3,
+197,5,182,0,38,0,42,0,0,37,35,34,39,17,1,55,5,17,51,21,54,51,51,21,35,34,
+6,7,21,20,51,51,21,35,34,39,21,54,51,51,21,35,34,6,21,20,51,51,1,35,17,51,
+3,197,142,131,82,253,238,61,1,73,140,82,131,142,142,97,113,3,213,142,142,
+131,82,82,131,142,142,110,103,213,142,253,88,130,130,234,44,254,208,1,34,
+112,174,4,236,130,39,120,58,72,7,140,120,44,186,39,120,68,69,140,1,29,2,108,
+0,255,255,0,80,255,230,3,148,7,10,2,38,3,22,0,0,0,6,4,200,65,0,0,2,0,80,255,
+230,3,148,5,182,0,21,0,25,0,0,1,35,17,1,55,5,17,51,17,51,53,51,17,35,53,35,
+17,51,53,51,17,35,1,35,17,51,3,18,193,253,255,61,1,56,140,193,130,130,193,
+193,130,130,253,239,130,130,1,150,254,80,1,28,112,168,4,236,254,176,165,254,
+78,159,254,12,165,254,78,1,125,2,40,0,0,2,0,120,255,230,3,241,5,197,0,27,
+0,41,0,0,1,35,38,35,34,6,21,20,22,51,50,54,54,55,23,2,33,34,2,17,16,18,51,
+50,22,23,17,51,1,38,38,35,34,6,7,39,54,54,51,50,22,23,3,203,130,76,204,144,
+156,160,140,78,119,93,53,105,161,254,227,202,240,238,204,93,143,42,130,254,
+161,8,94,80,85,95,8,130,14,167,131,129,172,17,3,62,178,235,212,214,253,46,
+86,90,63,254,233,1,65,1,10,1,9,1,46,54,51,1,183,254,233,86,98,101,92,32,119,
+152,145,126,255,255,0,118,0,0,3,109,7,10,2,38,3,25,0,0,0,6,4,200,40,0,0,3,
+0,180,0,0,3,109,5,202,0,5,0,9,0,13,0,0,1,37,17,35,17,1,1,35,17,51,19,35,17,
+51,3,68,253,252,140,2,185,254,205,130,130,235,130,130,4,72,200,250,240,5,
+202,254,249,252,62,2,98,253,158,2,98,0,0,2,0,180,0,0,3,109,5,202,0,5,0,17,
+0,0,1,37,17,35,17,1,1,19,3,55,23,55,23,3,19,7,3,3,3,68,253,252,140,2,185,
+253,253,179,179,99,145,146,99,180,180,95,150,149,4,72,200,250,240,5,202,254,
+249,252,99,1,57,1,55,55,253,253,55,254,201,254,199,58,1,2,254,254,0,3,0,130,
+255,231,3,220,5,208,0,3,0,7,0,50,0,0,1,39,55,23,3,39,55,23,19,38,38,35,34,
+6,21,20,22,22,23,22,22,21,20,6,6,35,34,38,39,55,22,22,51,50,54,53,52,46,6,
+53,52,54,54,51,32,23,2,156,233,77,233,147,233,77,233,194,46,159,100,133,159,
+65,133,160,201,157,110,204,138,136,211,59,121,32,155,98,140,172,62,100,129,
+134,129,100,62,103,194,135,1,13,144,3,162,206,89,202,253,15,206,89,202,3,
+34,98,105,140,123,68,109,91,69,88,181,125,116,183,100,153,140,57,107,123,
+147,116,70,101,77,62,61,71,96,129,89,106,171,97,252,0,255,255,0,100,255,230,
+3,183,7,10,2,38,3,29,0,0,0,6,4,200,76,0,0,5,0,100,255,230,3,183,5,208,0,7,
+0,11,0,15,0,19,0,23,0,0,19,23,17,5,7,39,17,37,1,39,55,23,3,39,55,23,1,23,
+7,39,19,23,7,39,210,246,1,191,61,246,254,65,2,251,249,41,247,39,249,41,247,
+252,212,249,41,247,39,249,41,247,1,78,132,5,6,228,112,129,250,233,248,2,17,
+99,101,95,253,253,99,101,95,1,69,99,101,95,2,3,99,101,95,0,0,5,0,130,255,
+231,3,220,5,208,0,3,0,7,0,11,0,15,0,58,0,0,1,35,53,51,19,35,53,51,1,35,53,
+51,19,35,53,51,19,38,38,35,34,6,21,20,22,22,23,22,22,21,20,6,6,35,34,38,39,
+55,22,22,51,50,54,53,52,46,6,53,52,54,54,51,32,23,2,22,120,120,234,120,120,
+254,208,120,120,234,120,120,171,46,159,100,133,159,65,133,160,201,157,110,
+204,138,136,211,59,121,32,155,98,140,172,62,100,129,134,129,100,62,103,194,
+135,1,13,144,3,217,220,254,232,220,252,194,220,254,232,220,2,178,98,105,140,
+123,68,109,91,69,88,181,125,116,183,100,153,140,57,107,123,147,116,70,101,
+77,62,61,71,96,129,89,106,171,97,252,255,255,0,100,0,0,4,66,7,10,2,38,3,32,
+0,0,0,6,4,200,115,0,0,4,0,100,0,0,4,66,5,208,0,14,0,23,0,27,0,31,0,0,33,17,
+35,34,36,53,52,36,51,51,17,5,7,39,17,1,20,22,51,51,17,35,34,6,19,35,17,51,
+17,35,17,51,2,131,39,233,254,241,1,15,233,39,1,191,61,246,253,209,187,178,
+54,54,178,187,177,130,130,130,130,1,185,166,143,143,166,1,173,228,112,129,
+251,3,2,238,97,101,1,141,101,1,10,1,24,250,246,1,24,0,0,5,0,100,0,0,3,202,
+5,183,0,7,0,11,0,15,0,19,0,23,0,0,1,5,17,51,17,37,17,35,19,35,17,51,1,35,
+17,51,1,35,17,51,1,35,17,51,1,72,1,32,130,254,234,140,42,120,120,2,88,120,
+120,253,18,120,120,2,88,120,120,3,203,148,2,128,252,184,147,252,254,4,16,
+1,84,254,172,1,84,251,90,1,84,254,172,1,84,0,0,2,0,100,0,0,4,100,5,182,0,
+51,0,65,0,0,1,20,6,7,21,20,51,50,54,54,53,53,51,21,20,14,2,35,34,39,6,35,
+34,46,2,53,53,51,21,20,22,22,51,50,53,53,38,38,53,53,51,21,20,22,51,50,54,
+53,53,51,19,38,38,35,34,6,7,35,54,54,51,50,22,23,3,143,123,106,151,61,64,
+26,140,35,66,104,76,151,80,82,149,74,105,67,35,140,26,63,62,151,111,120,130,
+82,94,88,76,130,27,45,167,114,107,166,46,135,60,238,158,164,235,57,5,46,114,
+154,24,203,241,61,144,172,61,81,164,165,96,52,122,122,52,96,165,164,81,61,
+174,142,61,241,202,24,154,115,136,109,104,103,102,105,109,250,74,139,153,
+157,135,199,213,215,197,0,255,255,0,80,255,230,3,204,7,10,2,38,3,36,0,0,0,
+6,4,200,65,0,0,3,0,80,255,230,3,204,5,182,0,9,0,13,0,17,0,0,19,23,17,51,17,
+33,21,33,17,37,1,35,17,51,17,35,17,51,141,246,140,1,189,254,67,254,65,3,11,
+130,130,130,130,1,78,132,4,236,253,186,110,252,228,248,2,246,1,172,251,104,
+1,172,0,2,0,80,255,230,3,246,5,208,0,17,0,35,0,0,19,16,18,51,50,18,17,21,
+16,2,35,34,2,17,53,35,53,51,5,33,21,20,18,51,50,18,53,17,52,2,35,34,2,21,
+21,33,230,203,189,188,204,204,188,188,204,150,150,1,178,254,218,130,122,123,
+129,130,122,123,129,1,38,3,89,1,45,1,74,254,183,254,210,252,254,210,254,183,
+1,73,1,46,99,120,120,109,245,255,0,1,2,243,1,16,245,1,0,254,254,243,43,0,
+255,255,0,80,255,230,4,27,7,10,2,38,3,39,0,0,0,6,4,200,111,0,0,4,0,80,255,
+230,4,27,5,182,0,9,0,21,0,25,0,29,0,0,19,5,17,51,17,33,21,33,17,1,1,35,21,
+35,53,35,53,51,53,51,21,51,5,35,17,51,17,35,17,51,185,1,95,140,1,119,254,
+137,253,216,1,100,130,130,140,140,130,130,1,202,130,130,130,130,1,140,194,
+4,236,253,186,110,252,228,1,54,2,127,223,223,110,232,232,53,1,172,251,104,
+1,172,0,2,0,100,0,0,4,49,5,182,0,13,0,25,0,0,1,2,2,35,34,2,3,51,22,22,51,
+50,54,55,19,33,17,35,17,33,53,33,17,51,17,33,4,49,32,252,202,210,249,28,139,
+22,177,149,142,177,26,57,254,172,130,254,172,1,84,130,1,84,5,182,254,211,
+254,191,1,58,1,52,252,250,255,247,251,181,254,149,1,107,110,1,11,254,245,
+0,255,255,0,100,255,240,4,49,7,10,2,38,3,42,0,0,0,7,4,200,0,136,0,0,0,1,0,
+100,255,240,4,49,5,182,0,27,0,0,19,22,22,51,50,54,53,17,38,2,3,51,18,18,51,
+50,18,19,51,2,5,17,20,6,35,34,38,39,226,21,93,53,67,53,188,202,23,139,20,
+169,159,151,170,24,141,55,254,147,128,140,93,150,35,1,1,70,83,102,98,1,185,
+29,1,94,1,82,254,197,254,225,1,36,1,54,253,103,53,254,62,168,142,119,101,
+0,0,1,0,120,0,0,3,241,5,182,0,23,0,0,1,33,17,33,21,33,17,37,17,35,17,5,17,
+33,53,33,17,33,53,33,53,51,21,33,3,241,254,147,1,109,254,147,254,128,140,
+1,128,254,147,1,109,254,147,1,109,140,1,109,4,106,254,252,110,253,235,174,
+254,111,2,88,172,1,76,110,1,4,110,222,222,0,255,255,0,100,0,0,4,49,7,10,2,
+38,3,45,0,0,0,7,4,200,0,136,0,0,0,2,0,100,0,0,4,49,5,182,0,3,0,16,0,0,33,
+35,17,51,1,2,33,34,2,3,51,18,18,51,50,18,19,2,137,130,130,1,168,60,254,86,
+221,240,26,139,20,169,159,151,170,24,2,28,3,154,253,46,1,95,1,115,254,197,
+254,225,1,36,1,54,0,2,0,100,0,0,3,133,5,182,0,23,0,27,0,0,33,17,35,21,35,
+17,51,21,51,17,35,21,35,17,51,21,51,17,5,53,51,17,37,17,19,51,17,35,1,167,
+193,130,130,193,193,130,130,193,1,92,130,254,174,196,130,130,1,50,159,1,178,
+165,1,244,159,1,178,165,1,151,218,247,254,45,217,251,68,3,112,253,216,0,255,
+255,0,148,0,0,3,138,7,10,2,38,3,48,0,0,0,6,4,200,70,0,0,2,0,180,0,0,3,138,
+5,182,0,7,0,19,0,0,1,37,17,35,17,5,17,51,19,35,17,35,17,35,53,51,17,51,17,
+51,3,119,253,201,140,2,55,140,19,200,130,200,200,130,200,3,226,221,251,65,
+5,122,226,1,30,252,112,254,149,1,107,110,1,11,254,245,0,2,0,100,0,0,3,204,
+5,182,0,15,0,27,0,0,19,33,17,33,53,33,17,5,53,51,17,37,17,35,17,33,1,51,53,
+51,21,51,21,35,21,35,53,35,100,1,60,254,196,1,60,1,92,130,254,174,140,254,
+196,1,246,116,130,124,124,130,116,1,160,1,244,110,1,151,218,247,254,45,217,
+251,68,1,50,1,175,187,187,110,205,205,255,255,0,120,255,240,4,2,7,10,2,38,
+3,51,0,0,0,6,4,200,106,0,0,4,0,120,255,240,4,2,5,212,0,23,0,27,0,31,0,35,
+0,0,1,37,17,20,22,51,50,54,55,23,6,6,35,34,38,53,17,39,17,35,17,1,17,51,3,
+35,17,51,5,35,53,51,17,35,53,51,3,212,254,152,54,66,53,94,20,119,35,150,93,
+139,129,220,140,2,208,140,100,130,130,253,238,130,130,130,130,3,120,196,252,
+244,98,102,85,68,53,101,119,141,169,3,99,120,254,139,2,72,254,116,1,110,251,
+225,1,112,188,248,253,120,248,0,0,3,0,120,0,0,3,212,5,212,0,15,0,19,0,23,
+0,0,33,33,53,33,17,39,17,35,17,1,17,51,17,37,17,33,3,35,17,51,1,35,17,51,
+3,212,252,164,1,104,220,140,2,208,140,254,152,1,104,100,130,130,253,238,130,
+130,120,4,17,120,254,139,2,72,254,116,1,110,253,194,196,252,60,1,31,1,112,
+254,144,1,112,0,0,3,0,140,255,230,4,140,5,182,0,68,0,72,0,76,0,0,1,20,51,
+50,54,54,53,53,51,21,20,14,2,35,34,39,17,20,51,50,54,54,53,53,51,21,20,14,
+2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,17,6,35,34,46,2,53,
+53,51,21,20,22,22,51,50,53,53,51,19,35,53,51,5,35,53,51,2,210,151,61,64,26,
+140,35,66,104,76,96,65,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,
+67,35,140,26,63,62,151,65,96,74,105,67,35,140,26,63,62,151,140,232,130,130,
+254,38,130,130,4,211,241,61,144,172,91,111,164,165,96,52,47,253,182,241,61,
+144,172,111,131,164,165,96,52,122,122,52,96,165,164,131,111,174,142,61,241,
+2,74,47,52,96,165,164,111,91,174,142,61,241,227,252,87,237,237,237,0,255,
+255,0,120,255,230,3,244,7,10,2,38,3,55,0,0,0,6,4,200,119,0,0,5,0,120,255,
+230,3,244,5,208,0,27,0,39,0,51,0,55,0,59,0,0,19,52,54,55,53,38,38,53,52,54,
+54,51,50,22,22,21,20,6,7,21,22,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,
+38,35,34,6,17,20,22,51,50,54,53,52,38,35,34,6,1,35,53,51,5,35,53,51,120,202,
+174,170,206,109,203,135,135,202,108,204,172,176,200,241,204,200,247,130,170,
+147,143,172,169,146,147,170,170,147,143,172,169,146,147,170,2,136,130,130,
+253,234,130,130,1,37,130,171,15,244,15,174,127,93,147,79,80,146,93,131,172,
+13,244,15,171,130,144,175,178,141,96,112,114,94,98,111,113,3,12,96,112,114,
+94,98,111,113,253,128,217,217,217,0,0,3,0,120,255,230,3,244,5,208,0,35,0,
+47,0,59,0,0,19,52,54,54,51,50,22,22,21,20,6,7,21,33,21,33,21,22,22,21,20,
+6,35,34,38,53,52,54,55,53,33,53,33,53,38,38,19,20,22,51,50,54,53,52,38,35,
+34,6,17,20,22,51,50,54,53,52,38,35,34,6,120,109,203,135,135,202,108,204,172,
+1,106,254,150,176,200,241,204,200,247,202,174,254,150,1,106,170,206,130,170,
+147,143,172,169,146,147,170,170,147,143,172,169,146,147,170,4,145,93,147,
+79,80,146,93,131,172,13,60,110,74,15,171,130,144,175,178,141,130,171,15,74,
+110,60,15,174,253,19,96,112,114,94,98,111,113,3,12,96,112,114,94,98,111,113,
+0,0,2,0,120,0,0,3,227,5,182,0,15,0,19,0,0,19,33,17,5,17,51,17,37,17,35,17,
+33,17,35,17,51,17,33,53,33,250,1,11,1,92,130,254,174,140,254,245,130,130,
+1,11,254,245,3,173,1,174,218,1,53,253,239,217,251,130,1,225,254,238,3,164,
+253,220,240,255,255,0,140,255,230,4,49,7,10,2,38,3,59,0,0,0,7,4,200,0,160,
+0,0,0,4,0,140,255,230,4,49,5,208,0,11,0,18,0,23,0,28,0,0,1,16,2,35,34,2,17,
+16,18,51,50,18,1,34,2,7,33,38,2,1,16,18,23,17,19,54,18,17,33,4,49,243,223,
+223,244,245,222,224,242,254,44,140,167,15,2,134,15,165,254,43,134,128,130,
+127,134,254,251,2,221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,1,21,
+254,241,248,252,1,11,253,129,254,237,254,190,31,2,116,253,141,33,1,72,1,10,
+0,0,3,0,180,0,0,4,238,5,208,0,11,0,21,0,35,0,0,33,35,17,1,17,5,7,37,17,35,
+17,37,1,20,6,35,34,38,53,16,51,50,3,52,38,38,35,34,6,6,21,20,22,51,50,54,
+1,54,130,2,113,1,201,51,254,246,140,254,17,1,186,96,96,98,100,198,192,120,
+14,31,27,31,33,15,33,40,41,37,5,208,254,241,1,2,238,116,130,251,29,4,48,222,
+253,61,167,156,154,169,1,82,254,174,109,76,41,39,71,116,126,87,82,0,255,255,
+0,80,255,230,3,196,7,10,2,38,3,62,0,0,0,6,4,200,83,0,0,1,0,80,255,230,3,196,
+5,208,0,21,0,0,19,5,17,1,7,37,17,22,22,21,20,7,35,54,54,53,52,38,38,39,17,
+1,141,1,56,1,255,61,254,202,175,196,24,128,8,14,59,108,74,253,255,1,114,168,
+5,6,254,228,112,175,254,165,10,210,173,102,70,16,109,47,75,130,76,2,252,188,
+1,28,0,3,0,140,255,230,4,49,5,208,0,11,0,23,0,39,0,0,1,16,2,35,34,2,17,16,
+18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,37,55,23,17,5,7,39,21,22,22,
+21,35,52,38,39,17,4,49,243,223,223,244,245,222,224,242,140,169,159,154,171,
+166,159,158,170,253,192,61,125,1,60,61,135,111,124,118,61,56,2,221,254,152,
+254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,1,70,254,184,254,213,
+254,192,254,185,1,73,80,107,98,2,179,229,107,98,151,32,178,130,73,124,33,
+254,82,0,0,2,0,80,0,0,4,6,5,182,0,19,0,23,0,0,1,33,17,37,17,35,17,5,17,33,
+53,33,53,51,21,33,21,33,21,33,5,35,17,51,3,242,254,209,254,85,140,1,171,254,
+25,1,231,140,1,67,254,189,1,47,253,57,130,130,3,26,253,151,204,254,131,2,
+88,222,2,254,120,198,198,120,230,184,1,54,255,255,0,120,0,0,4,20,7,10,2,38,
+3,66,0,0,0,6,4,200,95,0,0,2,0,120,0,0,4,20,5,208,0,15,0,27,0,0,1,39,17,37,
+17,35,17,5,17,37,17,35,17,5,53,5,1,35,21,35,53,35,53,51,53,51,21,51,3,215,
+246,254,85,140,1,171,254,165,130,1,221,1,191,254,33,114,120,114,114,120,114,
+4,124,128,251,181,204,254,131,2,88,222,2,240,152,254,240,1,184,189,227,228,
+254,24,180,180,120,177,177,0,0,2,0,120,0,0,4,163,5,182,0,48,0,52,0,0,1,6,
+6,7,17,22,22,23,7,38,38,35,34,6,7,39,54,54,55,37,17,35,17,5,53,38,38,39,55,
+22,22,23,53,38,39,55,22,23,53,51,21,54,55,23,6,7,21,54,55,1,17,35,17,4,156,
+55,208,133,149,210,44,123,38,185,129,127,185,36,124,38,174,124,254,186,130,
+2,12,131,209,56,106,38,150,102,192,134,103,101,122,140,130,90,102,128,194,
+205,84,254,218,130,4,40,123,139,14,254,250,23,249,203,38,192,207,215,184,
+39,172,240,45,143,254,180,1,244,208,176,14,138,123,54,91,113,14,210,27,169,
+58,120,23,242,241,27,116,59,169,27,211,27,191,252,180,254,240,1,16,0,0,5,
+0,180,0,0,4,176,5,182,0,31,0,35,0,39,0,43,0,47,0,0,37,54,54,53,52,38,35,35,
+17,35,17,51,17,51,50,54,53,52,39,55,22,22,21,20,6,7,22,22,21,20,6,7,5,35,
+17,51,19,35,53,51,53,35,53,51,17,35,53,51,3,165,66,60,117,85,23,140,140,23,
+89,114,124,91,85,88,85,71,70,86,94,94,253,76,140,140,252,130,130,130,130,
+130,130,233,51,122,95,101,136,253,30,5,182,253,154,138,98,176,93,86,69,170,
+120,85,155,48,45,161,85,112,174,72,143,5,182,252,200,247,230,247,251,77,247,
+0,255,255,0,120,0,0,4,3,7,10,2,38,3,70,0,0,0,6,4,200,95,0,0,2,0,120,0,0,4,
+3,5,208,0,27,0,34,0,0,1,33,17,37,17,35,17,5,53,38,38,53,16,37,17,5,7,37,21,
+33,21,33,21,33,21,33,21,33,37,20,22,23,17,6,6,4,3,254,129,254,128,140,1,128,
+178,189,1,111,2,11,57,254,186,1,127,254,129,1,127,254,129,1,127,253,8,113,
+124,126,111,1,241,254,172,174,254,181,2,18,172,140,8,158,138,1,32,13,1,129,
+220,117,149,196,120,123,120,124,185,88,92,5,1,110,5,91,0,5,0,100,0,0,3,254,
+5,208,0,28,0,40,0,44,0,48,0,52,0,0,19,54,54,51,50,22,21,17,20,6,35,34,39,
+17,35,17,51,4,51,50,54,53,17,52,38,35,34,6,7,1,35,21,35,53,35,53,51,53,51,
+21,51,5,35,53,51,53,35,53,51,17,35,53,51,100,104,190,99,159,141,101,101,106,
+188,140,33,1,51,94,37,25,87,99,71,157,61,1,155,130,120,130,130,120,130,1,
+177,130,130,130,130,130,130,4,235,125,104,185,185,253,96,134,125,125,254,
+200,2,8,213,86,78,2,128,129,128,97,83,254,126,198,198,110,186,186,244,247,
+230,247,251,77,247,0,255,255,0,120,0,0,4,110,7,10,2,38,3,73,0,0,0,7,4,200,
+0,182,0,0,0,4,0,120,0,0,4,110,5,208,0,32,0,36,0,40,0,44,0,0,1,33,53,33,17,
+52,35,34,6,6,21,35,52,54,54,51,50,23,54,51,50,22,22,21,35,52,38,38,35,34,
+21,17,33,3,35,17,51,1,35,17,51,1,35,17,51,4,5,252,220,1,76,151,64,60,27,135,
+61,124,91,149,82,80,151,92,123,61,135,27,60,64,151,1,76,17,130,130,253,128,
+130,130,1,64,130,130,2,116,110,1,133,241,59,141,138,179,191,88,122,122,87,
+190,181,135,144,59,241,254,123,253,30,1,162,254,94,1,162,254,94,1,162,0,0,
+5,0,120,255,230,4,51,5,208,0,39,0,55,0,59,0,63,0,67,0,0,37,36,39,6,35,34,
+38,2,17,16,18,54,51,50,23,54,54,55,21,34,6,21,20,22,23,21,38,39,23,21,7,54,
+55,21,34,6,21,20,22,23,1,16,38,38,35,34,6,6,17,16,22,22,51,50,54,54,39,35,
+17,51,37,35,53,51,17,35,53,51,4,51,254,245,113,75,180,111,142,67,68,140,114,
+176,75,57,195,130,156,166,170,152,200,114,2,1,125,188,156,166,170,152,254,
+60,35,79,69,69,77,34,35,77,68,69,79,35,116,130,130,2,36,120,120,120,120,15,
+21,125,187,142,1,52,1,61,1,49,1,45,141,171,65,75,5,120,115,108,108,114,4,
+118,16,74,132,59,58,81,5,120,115,108,108,114,4,2,88,1,29,234,116,116,231,
+254,232,254,227,240,122,118,235,103,1,141,72,210,252,54,210,0,255,255,0,130,
+0,0,4,26,7,10,2,38,3,76,0,0,0,7,4,200,0,143,0,0,0,7,0,130,0,0,4,26,5,182,
+0,3,0,7,0,15,0,19,0,23,0,27,0,31,0,0,1,35,53,51,5,35,53,51,19,1,17,35,17,
+1,17,51,37,35,53,51,3,35,53,51,5,35,53,51,3,35,53,51,1,214,130,130,1,118,
+130,130,206,252,234,130,3,22,130,254,119,130,130,187,130,130,1,118,130,130,
+187,130,130,3,211,220,220,220,253,4,1,152,254,124,2,62,254,108,1,108,253,
+220,251,81,220,220,220,254,29,220,0,2,0,100,0,0,3,153,5,182,0,24,0,28,0,0,
+19,54,54,53,52,38,39,55,22,23,53,5,17,51,17,37,17,37,17,35,17,5,17,6,7,19,
+35,17,51,100,150,193,189,154,36,184,123,1,92,130,254,174,1,82,130,254,164,
+118,189,128,130,130,1,133,27,202,136,138,207,30,117,34,121,252,148,1,11,254,
+55,147,252,182,147,254,55,1,11,148,1,52,114,41,1,104,1,4,255,255,0,80,0,0,
+4,5,7,10,2,38,3,79,0,0,0,6,4,200,96,0,0,2,0,80,0,0,4,5,5,212,0,13,0,30,0,
+0,33,17,33,53,33,17,5,7,37,17,33,21,33,17,3,21,20,6,6,35,34,38,39,55,22,22,
+51,50,54,53,53,2,58,254,101,1,155,1,193,44,254,247,1,63,254,193,217,37,85,
+78,80,113,20,120,9,49,29,42,34,1,188,120,3,160,216,115,130,253,41,120,254,
+68,5,30,190,166,125,66,98,81,47,38,68,93,153,181,0,3,0,120,255,230,3,141,
+5,182,0,25,0,34,0,38,0,0,19,22,22,51,50,54,54,53,53,35,34,38,38,53,52,54,
+51,33,17,20,6,6,35,34,38,39,19,20,22,51,33,17,33,34,6,3,51,17,35,238,55,159,
+82,97,98,40,246,114,184,105,216,187,1,130,67,155,157,112,203,72,107,147,116,
+1,0,255,0,115,148,20,130,130,1,3,76,89,71,167,215,228,85,157,103,160,182,
+252,22,196,202,88,104,94,3,180,102,123,1,191,122,253,250,254,196,0,0,2,0,
+80,0,0,4,221,5,212,0,21,0,39,0,0,33,38,38,39,17,35,17,6,6,7,35,18,18,55,17,
+5,7,37,17,22,18,19,1,21,20,6,6,35,34,38,39,55,22,22,51,50,54,54,53,53,4,80,
+14,163,151,130,155,164,10,140,13,241,210,1,193,44,254,247,207,241,16,253,
+26,41,91,78,80,113,20,120,9,49,29,33,36,17,235,241,20,254,16,1,240,19,242,
+235,1,21,1,61,22,3,108,216,115,130,253,93,24,254,190,254,242,5,190,245,155,
+133,69,98,81,47,38,68,43,85,118,236,255,255,0,180,0,0,4,193,7,10,2,38,3,83,
+0,0,0,7,4,200,0,177,0,0,0,3,0,180,0,0,4,193,5,208,0,11,0,15,0,19,0,0,1,37,
+17,35,17,33,17,35,17,1,53,5,1,17,37,17,55,17,51,17,4,142,254,246,140,254,
+62,130,2,68,1,201,254,55,254,62,155,140,4,64,130,251,62,1,80,254,176,5,208,
+254,241,225,238,253,20,2,104,222,252,186,219,1,23,254,233,0,0,3,0,120,0,0,
+4,26,5,182,0,22,0,26,0,30,0,0,1,19,51,3,23,17,51,17,37,1,35,3,3,35,1,39,39,
+17,35,17,5,3,51,5,35,53,51,17,35,53,51,2,72,213,131,245,227,140,254,129,1,
+5,131,213,212,131,1,22,16,243,140,1,61,196,131,1,17,120,120,120,120,3,135,
+2,47,253,123,119,1,139,253,155,205,253,83,2,47,253,209,2,219,41,131,254,99,
+2,112,167,2,3,220,220,250,74,220,0,0,3,0,80,255,230,3,216,5,182,0,20,0,24,
+0,28,0,0,1,6,6,35,34,38,39,51,22,22,23,17,5,53,51,17,37,17,54,54,55,37,35,
+17,51,1,35,17,51,3,216,42,222,187,189,225,39,139,26,119,98,1,92,130,254,174,
+96,118,26,254,7,130,130,2,8,130,130,1,189,238,233,226,245,164,161,20,5,53,
+218,247,254,45,217,251,169,20,168,156,133,1,104,254,152,1,104,0,255,255,0,
+80,255,230,3,216,7,10,2,38,3,87,0,0,0,6,4,200,86,0,0,3,0,80,255,230,3,216,
+5,182,0,16,0,20,0,24,0,0,1,6,6,35,34,38,39,51,22,22,23,17,51,17,54,54,55,
+37,35,17,51,1,35,17,51,3,216,42,222,187,189,225,39,139,26,119,98,140,96,118,
+26,253,233,130,130,2,68,130,130,1,189,238,233,226,245,164,161,20,5,82,250,
+175,20,168,156,163,2,98,253,158,2,98,0,5,0,180,255,230,4,52,5,182,0,27,0,
+31,0,35,0,39,0,43,0,0,37,62,3,53,17,51,17,20,6,6,35,34,46,2,53,17,51,17,20,
+30,2,23,17,51,19,35,17,51,1,35,17,51,1,35,17,51,1,35,17,51,2,181,67,92,57,
+27,140,90,200,161,123,171,103,48,140,8,47,98,90,130,179,116,116,254,140,116,
+116,1,116,116,116,254,140,116,116,98,9,55,94,156,167,3,115,252,121,243,232,
+110,63,124,204,194,3,135,252,101,88,153,116,75,10,5,85,252,22,1,84,254,172,
+1,84,1,24,1,4,254,252,1,4,0,0,2,0,80,0,0,4,199,5,232,0,23,0,40,0,0,1,16,2,
+7,21,35,53,38,2,17,52,55,39,17,37,55,23,17,5,54,51,50,22,18,3,52,38,38,35,
+34,6,6,21,16,22,23,17,51,17,54,54,4,199,128,128,130,132,125,17,143,254,138,
+49,195,1,48,72,202,108,144,69,140,36,79,68,67,78,35,57,60,130,59,57,3,65,
+254,192,254,209,29,181,180,27,1,46,1,76,184,107,117,251,230,173,113,98,4,
+101,246,222,128,254,241,255,0,223,204,108,107,201,219,254,244,228,35,1,51,
+254,206,35,222,255,255,0,100,0,0,4,188,7,10,2,38,3,91,0,0,0,7,4,200,0,150,
+0,0,0,4,0,100,0,0,4,188,5,208,0,28,0,35,0,42,0,55,0,0,1,20,6,35,34,38,53,
+39,17,35,34,38,53,52,54,55,38,38,53,52,54,54,51,53,23,54,51,50,22,1,20,33,
+17,34,6,6,3,20,22,51,17,34,6,37,52,38,35,34,6,6,21,20,22,51,50,54,4,188,104,
+98,102,106,102,142,211,240,97,99,102,101,115,212,133,254,42,154,98,104,252,
+49,1,67,100,145,78,7,163,167,153,177,3,94,40,42,33,39,17,40,43,45,43,4,100,
+160,163,163,152,91,251,73,189,163,103,146,51,43,135,109,88,148,82,231,224,
+198,175,252,96,231,1,220,67,114,2,4,111,104,1,159,109,94,135,91,44,84,98,
+111,102,96,0,6,0,80,255,230,4,138,5,208,0,13,0,25,0,39,0,51,0,65,0,77,0,0,
+1,52,54,51,50,22,22,21,20,6,6,35,34,38,55,20,22,22,51,50,53,16,35,34,6,6,
+1,52,54,51,50,22,22,21,20,6,6,35,34,38,55,20,22,22,51,50,53,16,35,34,6,6,
+5,52,54,51,50,22,22,21,20,6,6,35,34,38,55,20,22,22,51,50,53,16,35,34,6,6,
+1,74,124,123,88,107,50,51,106,88,123,124,130,23,49,45,115,115,44,50,23,254,
+132,124,123,88,107,50,51,106,88,123,124,130,23,49,45,115,115,44,50,23,1,204,
+124,123,88,107,50,51,106,88,123,124,130,23,49,45,115,115,44,50,23,4,85,196,
+183,88,156,135,132,145,82,168,191,110,88,50,248,1,13,57,102,252,138,196,183,
+88,156,135,132,145,82,168,191,110,88,50,248,1,13,57,102,110,196,183,88,156,
+135,132,145,82,168,191,110,88,50,248,1,13,57,102,255,255,0,80,255,230,4,58,
+7,10,2,38,3,94,0,0,0,7,4,200,0,133,0,0,0,2,0,80,255,230,4,58,5,208,0,27,0,
+40,0,0,19,5,17,37,55,23,53,37,55,23,17,5,54,51,50,22,21,20,6,35,34,38,53,
+52,55,39,17,1,1,52,38,35,34,6,6,21,20,22,51,50,54,141,1,56,254,224,63,225,
+254,224,63,225,1,16,54,101,98,104,104,98,102,106,11,90,253,255,3,114,40,42,
+33,39,17,40,43,45,43,1,114,168,1,25,231,97,175,217,231,97,175,1,226,173,87,
+175,163,160,163,163,160,74,57,65,250,250,1,28,3,38,135,91,44,84,98,111,102,
+96,0,3,0,120,0,0,3,242,5,208,0,33,0,37,0,41,0,0,1,20,22,23,22,22,21,20,6,
+35,34,36,39,55,22,51,50,53,52,38,39,38,38,53,52,54,51,50,23,7,38,38,35,34,
+1,33,53,33,19,33,53,33,1,32,133,135,205,197,191,173,129,254,251,84,49,193,
+232,234,129,139,199,203,191,173,241,170,49,63,190,109,234,2,180,252,194,3,
+62,30,252,134,3,122,4,231,60,55,7,11,111,107,112,124,78,58,106,131,122,59,
+55,7,9,111,110,112,124,111,108,48,60,251,198,110,254,107,110,0,255,255,0,
+100,0,0,4,23,7,10,2,38,3,97,0,0,0,6,4,200,125,0,0,2,0,100,0,0,4,23,5,182,
+0,35,0,39,0,0,1,54,54,55,23,6,6,7,17,22,22,23,7,38,38,39,17,35,17,6,6,7,39,
+54,54,55,17,38,38,39,55,22,22,23,17,51,19,17,51,17,2,132,104,146,30,123,44,
+209,150,149,210,44,123,30,144,106,140,99,148,33,124,44,213,147,148,212,44,
+124,32,147,101,140,150,130,4,28,26,204,160,38,203,248,25,254,120,23,249,203,
+38,157,204,29,254,99,1,157,25,203,162,39,201,248,25,1,136,25,251,199,39,159,
+206,26,1,155,252,197,1,12,254,244,0,3,0,120,255,236,3,172,5,212,0,7,0,15,
+0,23,0,0,1,1,17,35,17,1,17,51,17,1,17,35,17,1,17,51,17,1,17,35,17,1,17,51,
+3,172,253,88,140,2,168,140,253,88,140,2,168,140,253,88,140,2,168,140,3,240,
+1,47,254,239,1,198,254,226,1,0,252,58,1,47,254,239,1,198,254,226,1,0,252,
+54,1,37,254,239,1,198,254,226,1,0,255,255,0,140,0,0,4,0,7,10,2,38,3,100,0,
+0,0,6,4,200,114,0,0,2,0,140,0,0,4,0,5,182,0,24,0,28,0,0,1,33,34,6,21,17,33,
+21,33,17,20,22,51,33,21,33,34,38,53,17,52,54,54,51,33,5,17,35,17,4,0,254,
+175,69,44,1,174,254,82,43,70,1,81,254,164,138,104,46,105,91,1,92,253,24,140,
+5,62,41,78,254,88,120,254,73,77,43,120,104,144,3,196,104,101,45,153,251,200,
+4,56,0,0,3,0,80,0,0,3,246,5,208,0,19,0,22,0,25,0,0,33,17,1,39,1,1,53,33,17,
+1,7,37,17,33,21,1,1,7,1,17,17,21,55,5,53,35,1,225,254,205,94,1,134,254,152,
+1,115,1,255,61,254,202,1,117,254,147,1,129,94,254,213,156,254,216,154,1,156,
+254,184,79,1,152,1,136,39,1,230,254,228,112,175,254,247,39,254,120,254,104,
+79,1,68,254,104,3,124,163,163,164,164,0,255,255,0,100,0,0,4,97,7,10,2,38,
+3,103,0,0,0,7,4,200,0,148,0,0,0,3,0,100,0,0,4,97,5,212,0,35,0,41,0,46,0,0,
+19,52,54,55,17,5,7,37,21,22,22,21,20,6,7,21,22,18,23,7,38,38,39,17,35,17,
+6,6,7,39,54,54,55,53,38,38,55,20,5,17,6,6,5,52,37,17,36,121,218,189,2,81,
+39,254,98,190,215,215,190,159,237,43,123,34,161,121,140,119,153,32,124,42,
+228,158,194,213,140,1,11,140,127,2,160,254,247,1,9,3,126,125,157,12,1,48,
+173,108,126,149,13,157,124,124,157,13,80,22,255,0,198,38,172,200,21,254,113,
+1,141,25,205,161,39,189,255,29,82,11,154,129,166,17,1,111,10,93,81,165,19,
+254,145,17,0,2,0,100,0,0,4,23,5,182,0,36,0,54,0,0,1,30,2,21,20,6,6,7,21,22,
+22,23,7,38,38,39,17,35,17,6,6,7,39,18,37,53,46,2,53,52,54,54,55,53,51,1,20,
+22,23,53,51,21,54,54,53,52,38,39,21,35,53,6,6,2,127,126,180,94,96,181,118,
+159,198,46,123,27,137,116,140,115,136,29,124,94,1,54,120,181,96,95,181,126,
+130,254,120,135,122,140,124,131,136,124,130,125,137,5,55,10,109,174,108,104,
+174,111,12,75,17,197,183,38,143,156,15,254,175,1,81,16,155,143,39,1,107,33,
+75,12,111,177,101,108,174,109,10,127,253,240,116,147,16,217,217,15,146,118,
+122,143,15,167,167,16,149,0,0,3,0,180,0,0,4,76,5,212,0,23,0,27,0,31,0,0,1,
+6,21,20,23,7,38,38,53,53,55,39,17,35,17,33,17,35,17,5,53,23,54,55,1,33,17,
+37,23,17,35,17,4,73,162,165,78,98,119,1,76,140,254,242,140,1,154,239,49,145,
+253,65,1,14,254,242,200,130,5,103,103,229,215,101,114,60,230,140,22,22,42,
+251,143,1,7,254,249,5,68,209,209,123,167,100,251,161,2,111,141,210,254,181,
+1,75,255,255,0,80,255,236,3,254,7,10,2,38,3,107,0,0,0,6,4,200,98,0,0,2,0,
+80,255,236,3,254,5,208,0,15,0,27,0,0,55,55,23,17,39,55,23,17,5,7,39,17,23,
+7,39,17,55,55,23,17,39,55,23,17,5,7,39,17,80,58,143,179,63,116,1,85,58,143,
+171,63,108,59,58,143,183,63,120,1,85,58,143,228,104,101,2,7,122,94,79,2,89,
+248,104,101,254,66,116,94,73,253,94,248,104,101,2,34,125,94,82,2,62,248,104,
+101,251,23,0,4,0,80,0,0,4,112,5,182,0,12,0,15,0,19,0,23,0,0,1,35,17,1,1,39,
+1,1,55,1,1,17,51,5,19,17,3,17,35,17,19,17,35,17,4,112,172,254,94,254,126,
+76,1,142,254,110,88,1,122,1,162,172,253,242,232,231,130,130,130,2,194,253,
+177,2,35,254,24,90,1,240,2,5,78,254,16,2,35,253,178,56,254,222,2,69,253,5,
+254,224,1,32,4,150,254,224,1,32,0,3,0,80,255,236,4,52,5,208,0,19,0,23,0,27,
+0,0,55,55,23,17,5,7,39,17,33,17,5,7,39,17,37,55,23,17,33,17,19,35,53,51,17,
+35,53,51,80,58,138,1,54,58,112,1,94,1,54,58,112,254,176,58,138,254,162,234,
+120,120,120,120,191,104,84,4,253,221,104,74,254,60,2,191,221,104,74,251,23,
+211,104,84,1,198,253,83,1,123,226,1,18,226,255,255,0,120,0,0,3,142,7,10,2,
+38,3,111,0,0,0,6,4,200,72,0,0,1,0,120,0,0,3,142,5,192,0,23,0,0,37,37,17,35,
+17,39,17,35,17,5,17,39,17,35,17,1,17,51,17,37,17,23,17,51,3,142,254,192,140,
+190,140,1,74,190,140,2,138,140,254,192,180,140,198,176,254,138,1,195,105,
+254,174,2,32,184,2,71,105,254,174,2,32,254,151,1,95,253,214,176,253,185,100,
+1,95,0,0,1,0,80,255,236,3,228,5,208,0,19,0,0,55,55,23,17,5,7,39,17,33,17,
+5,7,39,17,37,55,23,17,33,17,80,58,138,1,54,58,112,1,14,1,54,58,112,254,176,
+58,138,254,242,191,104,84,4,253,221,104,74,254,110,2,141,221,104,74,251,23,
+211,104,84,1,248,253,33,0,0,5,0,80,0,0,4,60,5,182,0,13,0,17,0,21,0,24,0,27,
+0,0,55,1,1,53,33,21,1,1,7,1,17,35,17,1,1,35,17,51,1,35,17,51,55,17,35,33,
+17,19,80,1,177,254,149,3,96,254,149,1,177,92,254,167,130,254,167,3,47,130,
+130,253,88,130,130,210,180,1,54,180,222,2,143,2,34,39,39,253,222,253,113,
+64,2,6,253,92,2,164,253,250,2,20,1,76,254,180,1,76,58,1,16,254,240,1,16,0,
+255,255,0,80,0,0,4,60,7,10,2,38,3,115,0,0,0,7,4,200,0,136,0,0,0,3,0,80,0,
+0,4,60,5,182,0,16,0,19,0,23,0,0,1,33,1,7,1,1,39,1,33,53,33,1,53,33,21,1,33,
+1,19,19,3,35,17,51,4,20,254,141,1,155,92,254,102,254,102,92,1,155,254,141,
+1,79,254,207,3,96,254,207,1,79,253,61,245,245,180,130,130,3,76,253,146,64,
+2,104,253,152,64,2,110,120,1,203,39,39,254,53,1,132,254,142,1,114,250,184,
+1,202,0,3,0,120,0,0,3,212,5,182,0,20,0,23,0,27,0,0,1,37,1,7,1,1,39,1,39,17,
+35,17,5,3,53,33,21,1,23,17,51,37,19,19,3,35,17,51,3,212,254,238,1,18,96,254,
+178,254,178,96,1,85,201,140,1,29,243,3,8,254,203,211,140,253,137,201,201,
+80,130,130,2,126,126,254,64,59,2,27,253,229,59,2,50,93,254,199,1,248,133,
+1,138,39,39,254,13,98,1,50,220,254,182,1,74,250,184,1,172,0,255,255,0,140,
+255,230,5,23,7,10,2,38,3,118,0,0,0,7,4,200,1,24,0,0,0,5,0,140,255,230,5,23,
+5,208,0,28,0,44,0,48,0,53,0,57,0,0,1,35,17,35,17,35,2,2,35,34,38,2,17,16,
+18,54,51,50,22,19,51,53,51,21,51,53,51,17,35,1,16,38,38,35,34,6,6,17,16,22,
+22,51,50,54,54,39,35,17,51,1,51,53,35,23,5,51,53,35,4,149,130,130,132,10,
+158,153,111,142,67,68,140,114,143,153,18,137,130,130,130,130,253,238,35,79,
+69,69,77,34,35,77,68,69,79,35,116,130,130,1,0,130,132,2,1,4,130,130,2,68,
+254,255,1,1,254,185,254,233,142,1,52,1,61,1,49,1,45,141,230,254,244,243,243,
+243,252,114,1,154,1,29,234,116,116,231,254,232,254,227,240,122,118,235,103,
+1,141,254,255,190,147,43,190,0,0,5,0,140,255,230,4,90,5,208,0,21,0,37,0,41,
+0,45,0,49,0,0,1,33,21,33,2,2,35,34,38,2,17,16,18,54,51,50,22,19,33,21,33,
+23,35,16,38,38,35,34,6,6,17,16,22,22,51,50,54,54,39,35,17,51,1,51,17,35,17,
+51,17,35,3,15,1,75,254,179,10,158,153,111,142,67,68,140,114,143,153,18,1,
+82,254,179,2,140,35,79,69,69,77,34,35,77,68,69,79,35,116,130,130,1,90,130,
+130,130,130,2,178,110,254,185,254,233,142,1,52,1,61,1,49,1,45,141,230,254,
+244,110,147,1,29,234,116,116,231,254,232,254,227,240,122,118,235,103,1,141,
+1,170,254,230,253,156,254,230,255,255,0,80,0,0,4,31,7,10,2,38,3,121,0,0,0,
+6,4,200,123,0,0,2,0,80,0,0,4,31,5,182,0,11,0,27,0,0,1,5,17,51,17,37,17,37,
+17,35,17,5,3,35,17,37,55,23,17,35,53,51,17,5,7,39,17,51,2,105,1,52,130,254,
+214,1,42,130,254,204,80,138,254,193,64,125,130,130,1,36,64,98,138,5,91,178,
+1,13,254,23,177,252,186,177,254,23,1,13,178,2,169,253,108,210,100,89,1,183,
+110,2,26,190,100,69,254,195,0,2,0,80,255,226,3,255,5,182,0,31,0,35,0,0,1,
+33,17,37,55,5,17,33,53,33,53,6,35,53,50,54,55,53,52,38,35,53,50,23,53,5,53,
+51,17,37,17,33,1,51,21,35,3,255,254,152,253,185,43,1,144,254,172,1,84,126,
+219,163,177,5,180,165,217,128,1,92,130,254,174,1,104,252,232,120,120,1,250,
+253,232,230,116,163,1,97,110,232,90,111,109,99,10,105,114,110,91,125,220,
+232,254,49,219,253,166,2,57,198,255,255,0,140,255,230,4,8,7,10,2,38,3,124,
+0,0,0,7,4,200,0,136,0,0,0,2,0,140,255,230,4,8,5,212,0,23,0,35,0,0,1,37,17,
+22,22,21,20,6,6,35,34,38,53,52,54,55,17,39,17,35,17,1,17,51,1,20,22,51,50,
+54,53,52,38,35,34,6,3,249,254,152,171,204,106,201,138,207,240,203,174,220,
+140,2,208,140,253,31,161,146,150,155,157,148,147,160,3,120,196,254,166,18,
+209,153,115,175,94,207,177,151,210,19,1,167,120,254,139,2,72,254,116,1,110,
+251,176,125,139,135,129,126,137,139,0,6,0,80,255,226,3,146,5,182,0,5,0,17,
+0,21,0,25,0,29,0,33,0,0,5,37,55,5,17,51,1,17,35,53,51,17,51,17,51,21,35,17,
+55,17,51,17,33,17,51,17,1,17,51,17,33,17,51,17,3,146,253,60,41,2,15,140,253,
+184,250,250,130,250,250,70,130,253,238,130,1,14,130,253,238,130,30,227,116,
+167,5,36,251,183,1,228,110,1,184,254,72,110,254,28,86,1,32,254,224,1,32,254,
+224,2,108,1,32,254,224,1,32,254,224,0,255,255,0,178,0,0,3,255,7,10,2,38,3,
+127,0,0,0,6,4,200,113,0,0,2,0,178,0,0,3,255,5,182,0,36,0,40,0,0,19,50,54,
+53,52,38,35,53,50,23,53,5,17,51,17,37,17,33,21,33,21,33,21,33,21,35,53,33,
+53,33,53,33,53,33,53,6,35,19,51,21,35,178,163,182,180,165,217,128,1,92,130,
+254,174,1,104,254,152,1,104,254,152,140,254,172,1,84,254,172,1,84,126,219,
+53,120,120,3,101,112,106,105,114,110,91,95,220,1,6,254,19,219,253,216,110,
+170,110,246,246,110,170,110,212,90,1,171,198,0,255,255,0,80,255,236,4,49,
+7,10,2,38,3,129,0,0,0,6,4,200,123,0,0,2,0,80,255,236,4,49,5,208,0,13,0,25,
+0,0,19,55,5,17,5,53,5,7,39,17,35,17,39,17,3,35,21,35,53,35,53,51,53,51,21,
+51,139,58,1,20,1,34,1,54,58,112,140,150,185,114,120,114,114,120,114,1,2,104,
+154,5,0,207,207,221,104,74,251,43,4,112,101,251,23,3,198,230,230,120,227,
+227,255,255,0,80,255,230,3,241,7,10,2,38,3,131,0,0,0,6,4,200,63,0,0,5,0,80,
+255,230,3,241,5,182,0,9,0,25,0,41,0,45,0,49,0,0,1,33,17,1,55,5,17,51,17,33,
+5,52,54,54,51,50,22,22,21,20,6,6,35,34,38,38,55,20,22,22,51,50,54,54,53,52,
+38,38,35,34,6,6,1,51,17,35,17,51,17,35,3,241,254,196,253,255,61,1,56,140,
+1,60,252,95,41,88,68,66,89,40,42,88,65,65,89,43,120,15,32,30,29,32,14,14,
+32,29,30,32,15,2,74,130,130,130,130,3,28,252,202,1,28,112,168,4,236,253,212,
+6,149,166,79,78,162,154,151,152,71,72,149,153,120,90,53,57,92,114,120,101,
+63,60,99,254,168,254,78,4,74,254,188,0,0,4,0,80,255,230,4,99,5,182,0,9,0,
+27,0,45,0,49,0,0,1,33,17,1,55,5,17,51,17,33,19,35,53,52,38,35,34,6,21,21,
+35,53,52,54,51,50,22,21,17,20,6,35,34,38,53,53,51,21,20,22,51,50,54,53,53,
+51,1,35,17,51,4,78,253,227,254,31,61,1,24,140,2,29,21,120,67,55,61,67,120,
+133,109,112,136,136,112,111,131,120,67,61,55,67,120,252,203,120,120,2,169,
+253,61,1,12,112,152,4,236,253,97,253,184,37,88,113,117,93,28,27,142,179,179,
+142,3,226,143,178,182,139,27,28,94,116,113,88,37,253,138,2,65,0,255,255,0,
+145,255,230,3,221,7,10,2,38,3,134,0,0,0,6,4,200,121,0,0,4,0,145,255,230,3,
+221,5,208,0,19,0,37,0,43,0,49,0,0,1,50,22,22,18,18,21,16,35,34,39,6,35,34,
+38,53,52,18,18,54,19,20,51,50,54,53,52,39,33,6,21,20,22,51,50,53,53,51,1,
+6,7,33,38,39,3,34,3,33,38,38,2,55,72,122,100,78,50,251,127,44,62,109,126,
+125,68,117,149,153,116,57,49,15,253,225,16,51,55,116,130,254,225,15,21,2,
+5,15,20,224,112,84,1,138,39,103,5,208,111,206,254,198,254,114,119,254,146,
+112,112,167,199,203,1,195,1,75,163,251,127,241,123,123,125,159,156,128,134,
+112,241,85,2,10,71,137,115,93,1,170,254,196,149,167,0,4,0,100,0,0,3,245,5,
+208,0,32,0,36,0,40,0,44,0,0,19,54,36,51,50,22,21,17,20,6,6,35,34,38,39,39,
+17,35,17,51,4,51,50,54,54,53,17,52,38,35,34,6,7,1,35,53,51,39,35,53,51,5,
+35,53,51,100,123,1,25,134,190,185,48,112,112,51,130,125,138,140,33,1,181,
+114,70,46,16,107,128,118,244,106,1,153,130,130,140,130,130,1,24,130,130,4,
+235,109,120,207,209,253,237,144,146,64,37,51,52,254,185,2,8,213,31,93,173,
+1,198,157,153,107,93,253,204,225,105,225,225,225,0,2,0,80,0,0,3,222,5,182,
+0,15,0,27,0,0,1,33,17,35,17,33,53,33,17,5,17,51,17,37,17,33,1,35,21,35,53,
+35,53,51,53,51,21,51,3,222,254,129,140,254,125,1,131,1,92,130,254,174,1,127,
+253,206,114,120,114,114,120,114,2,244,253,12,2,244,120,1,239,218,1,53,253,
+239,217,254,238,253,248,200,200,120,197,197,255,255,0,96,0,0,3,92,7,10,2,
+38,3,138,0,0,0,6,4,200,18,0,0,1,0,120,0,0,3,92,5,182,0,23,0,0,19,33,50,22,
+21,17,20,6,35,33,53,33,50,54,53,17,33,53,33,17,52,38,35,33,120,1,242,136,
+106,105,137,254,14,1,231,71,42,253,188,2,68,45,68,254,25,5,182,106,144,252,
+60,143,105,120,44,76,1,183,120,1,168,78,41,0,0,1,0,130,255,230,3,249,5,212,
+0,32,0,0,1,33,17,20,6,35,34,38,38,39,55,22,22,51,50,54,53,17,33,53,33,17,
+39,17,35,17,1,17,51,17,37,17,33,3,159,254,242,124,134,59,88,70,52,112,42,
+69,44,64,56,254,242,1,14,220,140,2,208,140,254,152,1,14,2,138,254,156,177,
+143,45,86,109,55,100,75,109,101,1,90,110,1,145,120,254,139,2,72,254,116,1,
+110,253,194,196,254,188,0,0,3,0,180,255,230,3,140,5,208,0,5,0,11,0,15,0,0,
+1,17,37,55,23,17,1,17,5,7,39,17,1,35,17,51,3,140,254,108,61,203,253,180,1,
+148,61,203,1,33,130,130,5,182,250,48,224,112,108,4,236,250,74,5,208,224,112,
+108,251,20,2,35,1,112,255,255,0,100,255,230,4,69,7,10,2,38,3,142,0,0,0,7,
+4,200,0,151,0,0,0,4,0,100,255,230,4,69,5,208,0,39,0,51,0,63,0,76,0,0,1,20,
+6,7,3,22,21,20,6,35,34,38,53,52,55,3,38,38,53,52,54,51,50,22,21,20,7,19,54,
+51,50,23,19,38,53,52,54,51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,
+35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,6,21,20,22,51,50,54,4,69,96,92,
+138,47,104,98,102,106,34,150,92,96,113,109,110,118,143,111,41,53,36,32,106,
+143,118,110,109,113,252,151,46,62,52,51,52,57,53,49,2,241,50,52,58,51,51,
+52,62,46,254,233,40,42,33,39,17,40,43,45,43,4,146,139,151,11,254,180,87,153,
+160,163,163,160,126,85,1,105,11,151,139,152,166,163,155,239,51,254,242,25,
+13,1,2,51,239,155,163,167,151,92,101,91,102,117,89,89,117,117,89,90,116,103,
+90,101,252,243,135,91,44,84,98,111,102,96,0,0,5,0,80,255,246,4,193,5,194,
+0,63,0,68,0,73,0,78,0,83,0,0,1,2,7,22,23,7,38,39,6,7,39,54,55,38,3,35,53,
+51,54,55,38,39,55,22,23,54,55,23,6,7,22,23,51,54,55,38,39,55,22,23,54,55,
+23,6,7,22,23,51,21,35,2,7,22,23,7,38,39,6,7,39,54,55,38,3,51,22,23,54,55,
+33,22,23,54,55,3,6,7,51,38,37,6,7,51,38,2,51,5,113,74,118,73,114,82,80,116,
+73,118,73,113,4,93,97,16,98,71,121,73,113,83,78,118,73,116,76,96,18,188,16,
+98,71,121,73,113,83,78,118,73,116,76,96,18,88,84,5,113,74,118,73,114,82,80,
+116,73,118,73,113,4,130,4,61,61,4,253,68,4,61,61,4,65,47,14,121,12,2,10,47,
+14,121,12,2,197,254,255,188,94,77,103,73,95,93,75,103,79,92,189,1,0,120,209,
+161,93,79,103,74,96,91,79,103,74,98,157,213,209,161,93,79,103,74,96,91,79,
+103,74,98,157,213,120,254,255,188,94,77,103,73,95,93,75,103,79,92,189,1,0,
+185,132,137,180,185,132,137,180,1,105,105,136,134,107,105,136,134,255,255,
+0,80,255,253,3,218,7,10,2,38,3,145,0,0,0,6,4,200,103,0,0,3,0,80,255,253,3,
+218,5,184,0,17,0,34,0,38,0,0,37,54,54,18,53,52,38,38,39,53,22,4,18,21,20,
+2,4,7,19,34,38,38,53,52,54,54,51,21,34,6,6,21,20,22,51,55,35,17,51,1,121,
+130,216,123,118,214,137,182,1,26,145,153,254,226,170,80,108,168,101,93,169,
+115,76,111,60,134,113,121,130,130,114,33,177,1,3,158,154,249,170,33,117,42,
+211,254,217,175,181,254,204,216,39,1,111,90,177,107,104,182,108,110,75,132,
+77,120,143,110,1,72,0,1,0,120,0,0,4,16,5,182,0,23,0,0,1,17,51,17,51,17,51,
+17,51,17,35,17,35,17,35,17,35,17,37,17,35,17,5,17,2,32,121,130,115,130,130,
+115,130,121,254,228,140,1,28,5,182,254,24,1,76,254,180,1,76,252,234,1,82,
+254,174,1,82,253,111,174,254,141,2,88,172,4,10,0,255,255,0,120,0,0,3,198,
+7,10,2,38,3,148,0,0,0,6,4,200,86,0,0,2,0,120,0,0,3,198,5,182,0,3,0,11,0,0,
+1,35,17,51,1,17,1,17,35,17,1,17,3,198,130,130,254,233,254,85,140,1,171,1,
+10,3,22,1,150,251,65,1,18,253,247,3,2,254,220,3,216,0,0,4,0,100,0,0,3,205,
+5,208,0,18,0,25,0,32,0,36,0,0,1,39,17,35,34,38,53,52,54,55,38,38,53,52,54,
+54,51,53,1,1,20,33,17,34,6,6,3,20,22,51,17,34,6,5,51,17,35,3,132,200,142,
+211,240,97,99,102,101,115,212,133,1,157,253,32,1,67,100,145,78,7,163,167,
+153,177,2,47,130,130,4,6,177,251,73,189,163,103,146,51,43,135,109,88,148,
+82,231,254,168,252,239,231,1,220,67,114,2,4,111,104,1,159,109,191,254,30,
+255,255,0,80,0,0,4,28,7,10,2,38,3,151,0,0,0,6,4,200,96,0,0,2,0,80,0,0,4,28,
+5,182,0,23,0,35,0,0,55,18,18,55,17,5,17,51,17,37,17,22,18,19,7,38,2,39,17,
+35,17,6,2,7,19,35,21,35,53,35,53,51,53,51,21,51,90,21,212,172,1,71,140,254,
+185,175,218,24,137,13,146,126,130,118,142,13,198,110,125,110,110,125,110,
+60,1,8,1,82,33,2,123,172,1,48,254,7,174,254,78,26,254,176,254,237,30,228,
+1,32,29,253,193,2,60,33,254,231,228,3,217,163,163,110,168,168,0,5,0,140,255,
+230,4,49,5,208,0,11,0,18,0,25,0,29,0,33,0,0,1,16,2,35,34,2,17,16,18,51,50,
+18,1,50,18,19,33,18,18,19,34,2,3,33,2,2,3,17,51,17,3,17,51,17,4,49,243,223,
+223,244,245,222,224,242,254,44,153,167,7,253,116,9,164,152,146,169,9,2,139,
+9,168,213,130,130,130,2,221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,
+252,27,1,51,1,23,254,222,254,216,4,250,254,215,254,241,1,20,1,36,251,186,
+1,20,254,236,2,178,1,20,254,236,0,255,255,0,80,255,230,4,93,7,10,2,38,3,154,
+0,0,0,7,4,200,0,154,0,0,0,7,0,80,255,230,4,93,5,208,0,25,0,34,0,43,0,47,0,
+51,0,55,0,59,0,0,1,33,21,16,6,6,35,34,38,38,17,53,33,53,33,53,16,54,54,51,
+50,22,22,17,21,33,5,35,21,20,22,51,50,54,53,3,51,53,52,38,35,34,6,21,3,35,
+17,51,1,35,17,51,17,35,17,51,1,35,17,51,4,93,254,240,46,107,95,94,104,47,
+254,240,1,16,46,105,96,95,106,45,1,16,254,100,213,50,55,57,51,213,213,51,
+57,56,49,200,107,107,2,208,107,107,107,107,253,48,107,107,2,182,66,254,211,
+236,117,117,231,1,50,66,120,39,1,43,225,111,111,226,254,217,42,120,214,210,
+176,173,208,1,83,177,208,169,167,200,252,142,1,24,2,218,1,24,250,246,1,24,
+2,218,1,24,0,2,0,60,0,0,3,233,5,182,0,7,0,15,0,0,33,35,17,7,39,55,17,51,33,
+51,17,55,23,7,17,35,1,121,140,114,63,177,140,1,51,140,114,63,177,140,1,189,
+88,97,141,3,99,254,226,89,97,142,251,254,255,255,0,100,0,0,3,245,7,10,2,38,
+3,157,0,0,0,7,4,200,0,133,0,0,0,2,0,100,0,0,3,245,5,208,0,32,0,44,0,0,19,
+54,36,51,50,22,21,17,20,6,6,35,34,38,39,39,17,35,17,51,4,51,50,54,54,53,17,
+52,38,35,34,6,7,1,35,21,35,53,35,53,51,53,51,21,51,100,123,1,25,134,190,185,
+48,112,112,51,130,125,138,140,33,1,181,114,70,46,16,107,128,118,244,106,2,
+37,210,120,210,210,120,210,4,235,109,120,207,209,253,237,144,146,64,37,51,
+52,254,185,2,8,213,31,93,173,1,198,157,153,107,93,254,146,198,198,110,186,
+186,0,0,2,0,100,0,0,3,245,5,182,0,48,0,56,0,0,1,21,20,7,22,21,17,20,6,6,35,
+34,38,39,39,17,35,17,51,4,51,50,54,54,53,53,52,39,6,35,34,39,6,7,39,54,55,
+38,53,53,51,21,23,54,51,50,23,55,53,3,34,7,22,51,50,55,38,3,146,8,107,48,
+112,112,51,130,125,138,140,33,1,181,114,70,46,16,23,83,186,204,80,61,66,70,
+74,88,12,140,3,125,120,74,61,1,136,106,114,44,121,130,40,48,5,182,190,64,
+58,101,227,254,231,144,146,64,37,51,52,254,185,2,8,213,31,93,173,204,106,
+67,137,168,36,58,91,66,51,60,86,190,191,81,48,16,24,216,254,168,45,109,132,
+22,0,3,0,80,0,0,3,192,5,182,0,15,0,19,0,23,0,0,1,37,17,33,21,33,17,35,17,
+33,53,33,17,5,53,51,17,35,17,51,1,35,17,51,3,148,254,184,1,116,254,140,140,
+254,144,1,112,1,82,130,130,130,253,102,130,130,3,255,155,254,214,110,252,
+254,3,2,110,2,2,176,244,251,13,1,144,254,112,1,144,0,255,255,0,80,0,0,4,60,
+7,10,2,38,3,161,0,0,0,6,4,200,123,0,0,1,0,80,0,0,4,60,5,182,0,19,0,0,33,17,
+33,17,39,17,35,17,23,17,51,17,33,17,23,17,51,17,39,17,2,198,255,0,234,140,
+234,140,1,0,234,140,234,2,242,253,141,174,254,211,2,38,172,4,60,253,180,1,
+205,174,1,45,253,218,172,251,196,0,0,2,0,120,0,0,4,42,5,212,0,26,0,33,0,0,
+37,38,39,17,36,36,53,52,54,55,17,5,7,37,17,54,51,21,34,6,7,33,21,33,22,22,
+51,37,20,22,23,17,6,6,4,16,200,119,254,224,254,199,248,213,1,229,60,254,227,
+126,193,126,164,22,1,56,254,197,15,168,132,252,244,164,157,157,164,214,2,
+102,254,194,6,234,204,176,234,33,2,93,255,111,142,254,149,117,110,125,111,
+110,113,128,119,132,161,23,2,129,25,169,0,2,0,140,255,230,4,2,5,208,0,26,
+0,54,0,0,1,39,6,6,35,34,38,2,17,16,18,54,51,50,22,23,23,53,51,17,39,23,20,
+7,23,53,51,37,52,39,39,21,35,17,23,38,38,35,34,6,6,17,16,18,22,51,50,54,55,
+39,21,35,17,23,55,4,2,239,26,157,134,113,148,69,67,145,120,140,157,23,104,
+130,226,3,5,98,130,254,149,5,109,130,227,17,86,73,71,82,37,37,83,70,85,90,
+11,107,130,243,1,1,20,126,221,207,150,1,67,1,38,1,30,1,49,156,215,243,53,
+226,254,85,119,162,81,125,50,226,30,147,90,58,217,1,156,117,132,130,121,247,
+254,253,254,249,255,0,128,182,195,57,217,1,156,126,67,0,255,255,0,100,0,0,
+4,50,7,10,2,38,3,165,0,0,0,6,4,200,123,0,0,3,0,100,0,0,4,50,5,208,0,35,0,
+44,0,53,0,0,33,17,35,6,6,35,34,38,53,52,54,51,50,22,23,51,17,35,6,6,35,34,
+38,53,52,54,51,50,22,23,51,17,5,7,39,17,1,52,35,34,6,21,20,51,50,17,52,35,
+34,6,21,20,51,50,2,158,122,12,118,90,106,122,126,102,85,116,16,125,122,12,
+118,90,106,122,126,102,85,116,16,125,1,148,61,203,254,133,103,56,53,103,109,
+103,56,53,103,109,1,145,103,112,140,123,127,151,107,99,1,244,103,112,140,
+123,127,151,107,99,1,91,224,112,108,251,20,4,45,166,79,87,153,254,45,166,
+79,87,153,0,0,3,0,100,0,0,4,122,5,182,0,20,0,32,0,44,0,0,1,6,2,7,17,37,17,
+35,17,5,17,38,2,39,51,22,22,51,50,54,55,19,35,21,35,53,35,53,51,53,51,21,
+51,5,35,21,35,53,35,53,51,53,51,21,51,4,122,41,236,176,254,128,140,1,128,
+179,234,40,140,35,196,152,142,199,39,143,110,125,110,110,125,110,253,67,110,
+125,110,110,125,110,5,182,237,254,236,24,252,206,174,254,231,1,224,172,2,
+105,22,1,18,241,203,218,212,209,252,247,143,143,110,138,138,110,143,143,110,
+138,138,0,255,255,0,110,255,240,4,28,7,10,2,38,3,168,0,0,0,7,4,200,0,133,
+0,0,0,2,0,110,255,240,4,28,5,208,0,29,0,41,0,0,19,22,22,51,50,54,53,17,38,
+38,53,52,54,54,51,50,22,22,21,20,6,6,7,17,20,6,35,34,38,39,19,20,22,51,50,
+54,53,52,38,35,34,6,229,21,93,53,67,53,179,217,110,209,148,147,209,109,96,
+181,119,128,140,93,150,35,150,174,153,156,169,169,156,155,172,1,1,70,83,102,
+98,1,124,18,223,159,117,183,104,102,183,119,104,173,112,12,254,123,168,142,
+119,101,3,112,134,149,147,136,138,146,153,0,0,2,0,120,0,0,3,207,5,182,0,18,
+0,21,0,0,1,17,37,17,37,17,37,17,35,17,5,17,5,39,37,37,55,5,17,1,53,7,2,105,
+1,102,254,154,254,228,140,1,28,254,214,59,1,58,254,198,59,1,42,1,112,194,
+5,182,254,153,228,253,81,227,253,94,174,254,141,2,88,172,1,195,185,94,199,
+200,94,186,1,111,253,173,241,121,255,255,0,20,0,0,3,211,7,10,2,38,3,171,0,
+0,0,7,4,200,0,133,0,0,0,1,0,20,0,0,3,211,5,182,0,19,0,0,1,17,35,17,7,39,55,
+17,51,17,33,17,51,17,35,17,33,17,55,23,1,91,140,114,73,187,140,1,236,140,
+140,254,20,139,73,1,111,254,145,1,15,77,108,127,4,9,254,40,1,216,250,74,3,
+102,254,166,94,107,0,1,0,100,0,0,3,252,5,182,0,15,0,0,1,33,17,51,17,33,21,
+33,53,33,17,33,17,35,17,51,1,9,1,49,140,1,54,252,104,1,214,254,207,130,130,
+3,246,1,192,250,194,120,120,3,6,254,254,2,148,0,255,255,0,80,255,230,4,119,
+7,10,2,38,3,174,0,0,0,7,4,200,0,143,0,0,0,3,0,80,255,230,4,119,5,208,0,19,
+0,31,0,42,0,0,19,23,17,1,7,37,17,54,51,50,0,19,35,38,38,35,34,7,17,37,37,
+52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,141,248,
+2,22,61,254,179,39,41,243,1,24,11,140,4,209,181,43,37,254,63,1,248,90,80,
+83,91,94,80,80,90,93,39,38,40,41,35,41,82,1,77,131,5,6,254,248,112,161,254,
+217,6,254,201,254,231,227,245,9,252,143,247,239,105,113,113,105,110,120,123,
+107,73,61,61,73,51,72,0,255,255,0,80,255,240,3,140,5,193,2,6,4,193,0,0,255,
+255,0,120,0,0,4,59,7,10,2,38,3,177,0,0,0,6,4,200,116,0,0,1,0,120,0,0,4,59,
+5,208,0,21,0,0,33,17,35,17,35,17,35,17,35,17,51,17,51,17,51,17,51,17,5,7,
+39,17,2,124,141,130,115,130,130,115,130,141,1,191,61,246,2,192,254,34,1,222,
+254,34,3,252,254,90,1,166,254,90,2,152,228,112,129,251,3,0,0,3,0,80,255,236,
+4,172,5,208,0,23,0,27,0,31,0,0,1,51,17,5,7,39,17,35,17,35,17,35,17,35,17,
+37,55,23,17,51,17,51,17,51,17,51,17,35,1,51,17,35,2,204,170,1,54,58,112,140,
+170,130,170,254,176,58,138,140,170,130,170,170,254,212,170,170,4,61,1,147,
+221,104,74,251,43,2,73,253,213,2,43,253,163,211,104,84,4,227,254,135,1,91,
+253,41,1,4,254,252,1,4,255,255,0,110,0,0,3,152,7,10,2,38,3,180,0,0,0,6,4,
+200,69,0,0,1,0,110,0,0,3,152,5,182,0,29,0,0,1,33,21,33,21,33,17,55,23,1,1,
+7,39,17,35,17,7,39,1,1,55,23,17,33,53,33,53,33,53,33,3,128,254,202,1,54,254,
+202,250,84,254,192,1,64,82,252,140,254,82,1,64,254,192,84,252,254,202,1,54,
+254,202,2,248,5,62,200,120,254,139,231,79,254,216,254,218,82,232,254,151,
+1,107,234,82,1,38,1,40,79,233,1,119,120,200,120,0,1,0,85,0,0,3,177,5,200,
+0,25,0,0,1,17,55,17,37,17,55,23,1,1,7,39,17,35,17,7,39,1,1,55,23,17,39,17,
+35,17,3,37,140,254,153,250,84,254,192,1,64,82,252,140,254,82,1,64,254,192,
+84,252,221,140,4,106,1,75,1,253,224,177,254,66,231,79,254,216,254,218,82,
+232,254,151,1,107,234,82,1,38,1,40,79,233,2,5,109,254,177,2,30,0,0,2,0,80,
+0,0,4,66,5,182,0,48,0,52,0,0,1,33,34,6,21,17,20,22,51,33,21,33,34,38,53,17,
+35,34,6,21,20,22,23,7,38,38,53,52,54,55,38,38,53,52,54,55,23,6,21,20,22,51,
+51,17,52,54,54,51,33,3,35,17,51,4,66,254,145,69,44,43,70,1,111,254,134,138,
+104,47,84,118,61,65,79,94,94,85,71,71,85,88,85,91,124,115,88,47,46,105,91,
+1,122,170,130,130,5,62,41,78,252,41,77,43,120,104,144,1,227,136,101,96,122,
+50,90,73,173,112,85,160,46,47,157,84,119,171,69,86,93,176,100,136,1,115,104,
+101,45,251,203,2,231,0,255,255,0,100,255,230,4,98,7,10,2,38,3,184,0,0,0,7,
+4,200,0,166,0,0,0,4,0,100,255,230,4,98,5,182,0,45,0,57,0,61,0,65,0,0,1,6,
+6,7,21,20,6,35,34,38,53,53,38,38,39,51,22,22,51,50,53,53,38,38,53,53,51,21,
+20,22,51,50,54,53,53,51,21,20,6,7,21,20,51,50,54,55,1,6,35,21,20,22,51,50,
+54,53,53,34,3,35,17,51,17,35,53,51,4,98,3,68,69,192,178,179,193,68,69,3,140,
+4,66,80,151,111,120,130,82,94,88,76,130,123,106,151,80,66,4,254,141,82,149,
+105,126,125,106,151,15,130,130,130,130,3,242,160,178,40,201,220,237,237,220,
+201,39,174,165,174,116,241,12,24,154,115,94,67,104,103,102,105,67,94,114,
+154,24,13,241,116,174,254,224,122,139,192,175,175,192,139,254,181,1,32,2,
+165,228,0,255,255,0,130,0,24,4,86,5,152,2,6,4,195,0,0,0,4,0,120,0,0,4,124,
+5,182,0,21,0,25,0,29,0,33,0,0,55,54,54,55,37,17,35,17,5,17,51,17,22,18,23,
+7,38,38,35,34,6,7,1,35,17,51,1,35,17,51,19,17,51,17,221,44,181,126,254,200,
+140,1,239,140,144,203,46,123,39,179,124,122,178,38,2,192,130,130,253,170,
+130,130,169,130,62,194,250,39,157,254,120,2,80,242,3,34,252,118,26,255,0,
+213,38,200,219,226,193,3,140,1,71,254,185,1,71,251,22,1,46,254,210,0,255,
+255,0,120,0,0,3,182,7,10,2,38,3,188,0,0,0,6,4,200,83,0,0,2,0,120,0,0,3,182,
+5,212,0,25,0,29,0,0,1,51,17,5,7,37,17,23,17,51,17,37,17,35,17,39,17,35,17,
+5,17,35,21,35,17,51,1,51,17,35,1,19,195,1,193,44,254,247,200,140,254,172,
+140,210,140,1,94,195,130,130,1,124,116,116,4,199,1,13,216,115,130,253,52,
+104,1,95,253,214,176,254,68,2,5,109,254,174,2,32,183,1,198,150,1,175,254,
+137,254,244,0,3,0,120,0,0,3,182,5,212,0,30,0,34,0,38,0,0,19,54,54,53,52,38,
+39,53,22,23,53,5,7,37,17,23,17,51,17,37,17,35,17,39,17,35,17,5,17,6,7,37,
+51,17,35,1,51,21,35,186,132,148,147,133,179,105,1,193,44,254,247,200,140,
+254,172,140,210,140,1,94,111,173,1,213,116,116,254,99,110,110,3,208,7,104,
+87,85,102,6,120,5,72,82,216,115,130,253,52,104,1,95,253,214,176,254,68,2,
+5,109,254,174,2,32,183,1,48,77,6,139,254,244,2,3,158,0,0,1,0,85,255,230,3,
+209,5,182,0,48,0,0,1,6,6,7,17,54,54,55,23,6,6,7,17,54,54,55,23,6,6,35,34,
+38,39,55,22,22,23,17,38,38,39,55,22,22,23,17,38,38,39,55,22,22,23,17,51,17,
+54,54,55,3,209,51,197,134,96,138,36,112,51,197,134,96,138,36,112,58,229,159,
+157,232,57,113,36,132,89,127,192,51,113,36,132,89,127,192,51,113,36,132,89,
+140,96,138,36,5,31,180,209,18,254,184,23,168,132,38,180,209,18,254,159,23,
+168,132,38,201,211,213,196,39,128,165,25,1,96,22,207,173,39,128,165,25,1,
+71,22,207,173,39,128,165,25,1,177,254,76,23,168,132,255,255,0,80,255,230,
+4,39,7,10,2,38,3,192,0,0,0,7,4,200,0,133,0,0,0,1,0,80,255,230,4,39,5,182,
+0,25,0,0,1,17,20,6,7,17,35,17,38,39,17,1,55,5,17,51,17,22,23,17,51,17,54,
+54,53,17,4,39,122,113,130,82,23,253,255,61,1,56,140,34,71,130,56,49,5,85,
+253,251,128,166,24,254,97,1,148,3,6,253,214,1,28,112,168,4,236,252,210,14,
+5,2,224,253,45,21,103,90,1,253,0,3,0,130,255,230,3,234,5,208,0,40,0,54,0,
+65,0,0,19,52,54,54,51,50,22,22,21,20,6,7,7,22,22,21,20,6,7,39,54,54,53,52,
+39,6,6,35,34,38,53,52,54,51,50,23,55,35,34,38,38,55,20,22,22,51,50,54,54,
+53,52,38,35,34,6,19,50,54,55,38,35,34,6,21,20,22,130,108,199,130,129,199,
+107,154,124,3,96,99,140,113,59,85,97,76,21,140,121,123,138,173,129,60,54,
+1,17,125,202,110,130,77,139,91,86,140,79,169,136,137,170,166,64,74,13,62,
+57,69,92,73,4,105,97,167,95,95,165,99,120,185,34,144,51,167,98,118,196,42,
+109,30,129,88,115,64,181,163,143,123,123,149,10,77,97,166,96,68,115,65,66,
+115,67,108,141,142,252,73,129,157,12,81,71,65,81,0,255,255,0,130,255,238,
+3,212,7,10,2,38,3,195,0,0,0,6,4,200,103,0,0,3,0,130,255,238,3,212,5,194,0,
+43,0,54,0,65,0,0,1,52,39,6,35,34,38,53,52,54,54,51,50,22,23,54,55,23,6,7,
+22,21,21,20,7,22,23,7,38,39,6,6,35,34,38,38,53,52,54,51,50,23,54,53,1,50,
+55,38,38,35,34,6,21,20,22,19,50,54,55,38,35,34,6,21,20,22,2,245,27,150,170,
+119,161,73,132,86,92,171,67,62,43,124,51,102,70,70,103,50,124,43,62,67,171,
+92,86,132,73,160,120,170,150,27,254,176,137,118,47,133,77,71,88,95,64,77,
+133,47,119,136,67,94,88,3,8,102,91,146,158,124,72,124,70,87,79,117,152,26,
+211,151,142,171,90,172,142,152,209,26,152,117,79,87,70,124,72,122,160,146,
+89,104,1,7,147,76,85,83,63,73,89,253,30,84,76,148,90,72,63,83,0,1,0,120,0,
+0,3,212,5,182,0,23,0,0,1,23,17,51,17,39,17,35,17,39,17,35,17,39,17,35,17,
+23,17,51,17,23,17,51,2,248,80,140,220,130,160,130,80,140,220,130,160,130,
+3,11,53,1,190,253,84,144,253,136,2,206,105,252,201,3,140,53,254,59,2,182,
+146,1,150,254,20,105,2,85,255,255,0,127,0,0,3,96,7,10,2,38,3,198,0,0,0,6,
+4,200,49,0,0,1,0,140,0,0,3,92,5,182,0,31,0,0,1,34,6,21,20,22,51,51,21,35,
+34,36,53,52,55,38,38,53,52,36,51,51,21,35,34,6,21,20,22,51,51,21,2,160,171,
+221,202,188,190,190,243,254,225,252,125,127,1,30,244,190,190,188,202,200,
+181,179,2,167,154,138,130,137,120,206,181,245,99,47,175,122,180,207,119,137,
+131,130,146,120,0,1,0,100,0,0,4,122,5,182,0,23,0,0,19,22,22,23,17,51,17,54,
+54,55,51,6,2,7,17,37,17,35,17,5,17,38,2,3,240,26,158,129,140,120,161,30,142,
+34,237,182,254,128,140,1,128,186,234,33,5,82,196,233,25,2,42,253,215,24,230,
+199,250,254,210,24,253,209,174,254,111,2,88,172,1,102,22,1,37,1,5,0,255,255,
+0,120,255,250,3,163,7,10,2,38,3,201,0,0,0,6,4,200,68,0,0,4,0,120,255,250,
+3,163,5,190,0,15,0,19,0,23,0,27,0,0,1,33,22,18,23,7,36,0,17,16,37,23,6,2,
+7,33,5,35,17,51,53,35,17,51,17,35,17,51,3,122,254,95,10,229,218,24,254,226,
+254,224,2,63,24,220,217,18,1,158,253,128,130,130,130,130,130,130,2,182,203,
+254,219,83,121,105,1,120,1,2,2,4,221,122,92,254,248,178,212,1,51,213,1,51,
+250,189,1,51,0,1,0,120,0,0,4,69,5,208,0,33,0,0,37,53,16,2,39,17,51,21,35,
+17,35,17,35,53,51,17,6,2,21,21,35,53,16,18,55,17,1,7,37,17,22,18,17,21,3,
+185,146,134,150,150,140,150,150,128,145,140,218,195,2,6,61,254,195,199,221,
+150,103,1,5,1,69,35,254,158,120,254,112,1,144,120,1,96,37,254,191,253,111,
+111,1,55,1,135,33,1,236,254,255,112,158,254,232,29,254,121,254,188,103,0,
+255,255,0,140,255,230,4,230,7,10,2,38,3,204,0,0,0,7,4,200,0,233,0,0,0,2,0,
+140,255,230,4,230,5,208,0,37,0,55,0,0,1,35,21,16,14,2,35,34,46,2,17,53,52,
+62,2,51,50,22,22,17,51,3,55,19,19,23,3,51,21,35,19,7,3,3,39,3,52,38,38,35,
+34,6,6,21,17,20,22,22,51,50,54,54,53,3,125,190,33,66,108,76,78,105,65,32,
+30,65,108,79,103,125,53,173,152,106,144,144,106,152,182,200,170,104,146,146,
+104,161,28,62,53,52,61,27,27,60,53,54,61,28,2,215,49,254,236,228,132,68,67,
+131,234,1,6,145,253,225,132,65,117,255,254,243,1,100,49,254,175,1,81,49,254,
+156,120,254,115,55,1,86,254,170,55,2,149,168,140,69,67,136,164,253,247,168,
+145,73,71,142,168,0,0,3,0,140,255,230,3,232,5,208,0,25,0,41,0,49,0,0,1,16,
+7,22,23,7,38,39,6,35,34,38,2,17,16,18,54,51,50,23,54,55,23,6,7,22,1,16,55,
+38,35,34,6,6,17,16,18,22,51,50,55,38,1,52,39,6,21,20,23,54,3,35,35,95,137,
+55,124,91,80,180,113,148,69,67,145,120,183,79,92,118,44,126,92,33,254,102,
+230,44,109,71,82,37,37,83,70,108,44,229,1,14,14,126,126,14,2,221,254,226,
+162,65,52,110,48,58,190,150,1,67,1,38,1,30,1,49,156,187,57,46,114,49,62,155,
+254,221,1,35,196,148,121,247,254,253,254,249,255,0,128,149,197,1,37,216,128,
+141,203,202,143,130,255,255,0,180,255,230,3,248,7,10,2,38,3,207,0,0,0,7,4,
+200,0,149,0,0,0,4,0,180,255,230,3,248,5,208,0,5,0,17,0,30,0,36,0,0,51,17,
+5,7,39,17,1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,6,21,20,22,51,
+50,54,1,17,37,55,23,17,180,1,145,61,200,1,227,104,98,102,106,107,101,98,104,
+120,40,42,33,39,17,40,43,45,43,1,77,254,111,61,200,5,208,199,112,103,251,
+0,3,1,160,163,163,160,164,174,175,163,135,91,44,84,98,111,102,96,3,42,250,
+48,199,112,103,5,0,0,1,0,180,0,0,3,166,5,182,0,21,0,0,1,35,19,35,3,3,35,19,
+35,17,35,17,51,17,51,3,51,19,19,51,3,51,3,166,200,191,126,151,150,126,191,
+243,140,140,240,188,121,155,156,121,189,198,2,215,254,60,1,104,254,152,1,
+196,253,41,5,182,253,153,1,195,254,144,1,112,254,61,0,2,0,80,255,234,4,74,
+5,192,0,27,0,31,0,0,1,3,55,19,55,3,55,19,19,23,3,23,19,23,3,19,7,3,7,19,7,
+3,3,39,19,39,3,39,37,55,39,7,1,26,202,103,176,153,212,106,183,183,106,212,
+152,177,103,203,203,103,177,152,212,106,183,183,106,212,153,176,103,1,253,
+152,152,153,2,213,1,53,78,254,242,233,1,69,72,254,232,1,24,72,254,187,233,
+1,14,78,254,203,254,203,78,1,13,233,254,188,72,1,23,254,233,72,1,68,233,254,
+243,78,76,233,233,233,255,255,0,140,255,230,4,33,7,10,0,38,3,211,0,0,0,6,
+4,200,113,0,0,4,0,140,255,230,4,33,5,208,0,19,0,39,0,48,0,57,0,0,1,20,6,7,
+6,6,35,34,38,2,17,16,18,54,51,50,22,23,22,22,5,52,54,55,38,38,35,34,6,6,17,
+16,18,22,51,50,54,55,38,38,37,52,39,6,6,21,20,23,54,55,20,7,54,53,52,38,39,
+22,4,33,146,136,32,151,122,113,148,69,67,145,120,123,150,33,129,150,253,88,
+142,122,18,79,74,71,82,37,37,83,70,73,80,18,128,136,1,30,9,72,75,147,9,140,
+11,135,70,64,10,2,210,165,206,28,179,170,150,1,67,1,38,1,30,1,49,156,165,
+184,20,226,171,164,225,25,109,123,121,247,254,253,254,249,255,0,128,124,109,
+32,201,173,174,117,24,156,122,223,57,117,174,162,123,62,212,115,155,27,132,
+0,0,5,0,80,0,0,4,143,5,182,0,11,0,23,0,35,0,46,0,57,0,0,1,1,51,1,1,35,1,1,
+35,1,1,51,1,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,
+34,38,55,20,22,51,50,54,53,52,38,35,34,5,20,22,51,50,54,53,52,38,35,34,2,
+111,1,47,141,254,140,1,116,145,254,213,254,214,145,1,116,254,140,141,1,246,
+90,80,83,91,94,80,80,90,253,25,90,80,83,91,94,80,80,90,93,39,38,40,41,35,
+41,82,2,231,39,38,40,41,35,41,82,3,101,2,81,253,35,253,39,2,76,253,180,2,
+217,2,221,253,64,105,113,113,105,110,120,123,107,105,113,113,105,110,120,
+123,107,73,61,61,73,51,72,123,73,61,61,73,51,72,255,255,0,100,0,0,3,255,7,
+10,2,38,3,214,0,0,0,7,4,200,0,139,0,0,0,3,0,100,0,0,3,255,5,208,0,27,0,39,
+0,42,0,0,19,52,54,54,51,50,22,22,21,20,6,7,21,37,17,37,17,35,17,5,39,37,37,
+55,5,53,38,38,55,20,22,51,50,54,53,52,38,35,34,6,1,53,7,131,109,203,135,135,
+202,108,194,168,1,102,254,154,140,254,150,59,1,114,254,142,59,1,106,178,212,
+130,170,147,143,172,169,146,147,170,2,116,197,4,145,93,147,79,80,146,93,129,
+169,17,207,224,253,81,224,254,104,1,167,221,94,231,232,94,221,220,14,173,
+130,96,112,114,94,98,111,113,252,166,241,121,0,3,0,100,255,230,4,94,5,208,
+0,20,0,37,0,40,0,0,1,16,2,6,35,34,38,2,3,5,39,1,1,55,5,18,18,51,50,22,18,
+3,16,38,38,35,34,6,7,37,17,37,18,22,51,50,54,54,1,23,53,4,94,73,147,113,112,
+141,71,5,254,227,71,1,51,254,205,71,1,30,10,162,158,122,143,66,140,38,84,
+71,89,89,10,1,16,254,239,5,91,93,71,84,38,254,131,147,2,221,254,220,254,192,
+147,142,1,17,1,2,238,99,1,1,1,2,99,239,1,65,1,28,155,254,209,254,215,1,8,
+248,123,196,248,228,252,251,228,254,233,234,124,247,1,44,122,245,0,3,0,110,
+0,0,3,152,5,182,0,29,0,33,0,37,0,0,1,55,23,1,1,7,39,17,33,21,33,21,33,21,
+33,53,33,53,33,53,33,17,7,39,1,1,55,23,17,51,3,35,53,51,5,35,53,51,2,74,250,
+84,254,192,1,64,82,252,1,14,254,242,1,54,253,8,1,54,254,242,1,14,254,82,1,
+64,254,192,84,252,140,232,107,107,1,175,107,107,4,165,231,79,254,216,254,
+218,82,232,254,1,120,150,120,120,150,120,2,1,234,82,1,38,1,40,79,233,1,19,
+252,50,147,147,147,0,255,255,0,120,0,0,3,212,7,10,2,38,3,218,0,0,0,6,4,200,
+102,0,0,3,0,120,0,0,3,212,5,182,0,19,0,23,0,27,0,0,1,37,17,35,17,39,17,35,
+17,5,17,35,53,33,21,35,17,23,17,51,3,35,17,51,1,35,17,51,3,212,254,152,140,
+220,140,1,104,250,2,128,250,220,140,100,130,130,253,238,130,130,2,136,196,
+252,180,3,153,120,254,139,2,72,198,1,32,120,120,254,147,121,1,110,251,214,
+1,148,254,108,1,148,0,2,0,80,0,0,3,206,5,182,0,30,0,33,0,0,1,37,17,20,6,35,
+33,53,33,50,54,53,17,5,39,1,1,55,5,17,52,38,35,33,53,33,50,22,21,17,37,1,
+23,53,3,206,254,238,105,137,254,134,1,111,71,42,254,228,71,1,51,254,205,71,
+1,28,45,68,254,145,1,122,136,106,1,18,254,240,147,1,123,229,254,152,143,105,
+120,44,76,1,150,237,99,1,1,1,2,99,238,1,83,78,41,120,106,144,254,222,230,
+254,125,122,245,0,255,255,0,110,0,0,3,152,7,10,2,38,3,221,0,0,0,6,4,200,68,
+0,0,3,0,110,0,0,3,152,5,182,0,17,0,21,0,25,0,0,1,55,23,1,1,7,39,17,35,17,
+7,39,1,1,55,23,17,51,1,35,17,51,1,35,17,51,2,74,250,84,254,192,1,64,82,252,
+140,254,82,1,64,254,192,84,252,140,254,212,130,130,2,78,130,130,4,155,231,
+79,254,216,254,218,82,232,252,133,3,125,234,82,1,38,1,40,79,233,1,29,250,
+230,1,148,254,108,1,148,0,1,0,100,0,0,5,56,5,182,0,38,0,0,33,17,6,6,7,39,
+54,54,55,17,5,53,38,38,39,51,18,23,17,51,17,54,54,55,51,6,6,7,17,37,21,22,
+22,23,7,38,38,39,17,1,248,99,148,33,124,44,213,147,1,34,156,210,45,133,62,
+216,130,104,138,39,131,43,209,160,254,232,149,210,44,123,30,144,106,1,177,
+25,203,162,39,201,248,25,1,151,190,201,20,227,201,254,223,38,1,111,254,145,
+16,157,154,198,230,20,254,91,189,186,23,249,203,38,157,204,29,254,79,0,255,
+255,0,130,0,0,3,125,7,10,2,38,3,224,0,0,0,6,4,200,78,0,0,3,0,130,0,0,3,119,
+5,182,0,7,0,35,0,39,0,0,1,37,17,35,17,5,17,51,3,35,21,51,21,35,17,35,17,35,
+17,35,17,35,53,51,53,35,53,51,53,51,21,51,53,51,21,51,1,51,53,35,3,119,253,
+151,140,2,105,140,12,95,95,95,130,120,130,64,64,64,64,130,120,130,95,254,
+167,120,120,3,226,221,251,65,5,122,226,1,30,252,228,190,120,254,252,1,4,254,
+252,1,4,120,190,120,155,155,155,155,254,202,190,0,0,3,0,40,255,240,4,78,5,
+208,0,22,0,30,0,33,0,0,19,23,3,55,19,55,19,17,5,7,39,17,20,6,35,34,38,39,
+3,7,39,55,39,1,50,54,53,17,39,19,22,3,23,39,45,201,154,117,137,102,207,1,
+191,61,246,76,82,50,78,35,151,84,98,105,206,2,81,14,8,222,160,27,212,120,
+70,3,11,18,1,146,59,254,156,220,254,141,3,5,228,112,129,252,30,164,135,89,
+95,1,137,187,53,226,15,253,253,50,101,1,65,15,254,97,72,2,83,10,121,0,255,
+255,0,80,0,0,3,162,7,10,2,38,3,227,0,0,0,6,4,200,58,0,0,2,0,80,0,0,3,162,
+5,182,0,49,0,60,0,0,1,35,34,6,21,20,22,51,51,21,35,34,38,38,53,52,54,55,38,
+38,53,52,54,55,38,38,53,52,54,54,51,51,21,35,34,6,21,20,22,51,51,21,35,34,
+6,21,20,22,51,51,1,22,17,20,6,7,39,54,53,52,39,3,162,179,90,117,114,87,185,
+185,101,145,80,79,61,61,79,63,61,57,67,80,145,101,185,185,86,115,117,84,185,
+185,86,115,118,89,179,252,251,218,117,100,78,165,162,1,200,102,84,68,82,120,
+70,125,75,72,131,36,36,131,73,59,115,40,40,122,67,76,124,70,120,82,68,79,
+94,120,82,68,78,95,2,81,151,254,222,139,228,63,114,101,215,229,103,0,0,2,
+0,110,255,230,4,14,5,182,0,15,0,28,0,0,1,23,17,51,17,37,17,35,17,39,17,35,
+17,5,17,51,1,6,6,35,34,38,39,55,18,33,50,54,55,2,125,225,140,254,147,130,
+225,140,1,109,130,1,145,44,233,184,183,240,44,133,57,1,21,135,165,29,3,196,
+148,1,190,253,94,239,254,79,2,7,148,254,79,2,152,242,1,156,251,213,203,218,
+216,205,50,254,161,180,171,0,255,255,0,120,0,0,3,212,7,10,2,38,3,230,0,0,
+0,6,4,200,100,0,0,3,0,120,0,0,3,212,5,182,0,7,0,11,0,15,0,0,1,1,17,35,17,
+1,17,51,37,35,17,51,17,35,17,51,3,212,253,48,140,2,208,140,254,147,130,130,
+130,130,1,182,1,217,254,79,2,152,254,36,1,190,12,1,82,250,74,1,186,0,0,3,
+0,80,0,0,4,55,5,182,0,15,0,19,0,23,0,0,33,33,53,51,17,5,17,33,53,33,21,35,
+17,37,17,33,1,51,21,35,3,51,21,35,3,165,252,171,146,2,55,253,201,3,85,146,
+253,201,2,55,254,93,120,120,40,120,120,120,3,75,226,2,93,120,120,252,237,
+221,253,112,1,191,198,3,60,198,0,1,0,80,255,230,4,21,5,208,0,31,0,0,1,23,
+53,39,55,23,53,39,55,23,53,37,17,37,55,23,17,39,55,23,53,39,55,23,17,5,53,
+5,7,39,17,37,2,29,154,192,61,131,192,61,131,254,252,254,157,61,154,192,61,
+131,192,61,131,1,144,1,94,61,149,254,157,1,25,79,206,110,115,76,251,110,115,
+76,163,147,250,243,195,112,79,1,60,110,115,76,251,110,115,76,1,165,223,223,
+187,112,78,250,243,195,255,255,0,80,0,0,4,140,7,10,2,38,3,234,0,0,0,7,4,200,
+0,163,0,0,0,3,0,80,0,0,4,140,5,182,0,19,0,23,0,27,0,0,33,17,33,17,39,17,35,
+17,23,17,51,17,33,17,23,17,51,17,39,17,3,35,17,51,17,35,17,51,3,22,254,176,
+234,140,234,140,1,80,234,140,234,250,130,130,130,130,2,242,253,141,174,254,
+211,2,38,172,4,60,253,180,1,205,174,1,45,253,218,172,251,196,3,231,1,51,252,
+17,1,51,0,4,0,120,255,240,3,248,5,202,0,43,0,48,0,56,0,61,0,0,19,51,54,55,
+38,39,55,22,23,54,55,23,6,7,22,23,51,21,35,23,7,51,21,35,6,7,22,23,7,38,39,
+6,7,39,54,55,38,39,35,53,51,39,55,35,5,22,23,54,55,37,21,23,33,55,52,39,33,
+19,6,7,33,38,120,159,48,138,90,179,18,209,145,142,212,18,179,90,140,45,160,
+139,3,2,138,155,44,148,107,164,18,208,146,146,208,18,162,108,146,45,155,138,
+2,3,139,1,42,40,110,111,39,254,190,2,1,84,2,4,254,175,169,103,42,1,34,43,
+3,159,181,130,56,67,121,67,96,95,68,121,66,57,134,177,120,74,56,120,193,139,
+70,50,121,61,99,99,61,121,50,70,136,196,120,56,74,250,149,104,107,146,176,
+28,28,56,38,36,1,97,95,138,138,0,0,5,0,80,255,230,4,3,5,208,0,37,0,53,0,63,
+0,73,0,77,0,0,55,54,55,38,53,17,52,55,38,39,55,22,23,54,51,50,23,54,55,23,
+6,7,22,21,17,20,7,22,23,7,38,39,6,35,34,39,6,7,19,23,54,51,50,23,55,17,52,
+39,6,35,34,39,6,21,19,50,54,55,38,35,34,7,22,22,19,34,6,7,22,51,50,55,38,
+38,3,35,53,51,80,39,81,19,21,84,38,124,17,33,90,209,209,91,33,18,123,39,84,
+21,19,82,39,123,15,32,91,213,212,91,30,16,117,2,105,126,127,101,3,4,101,126,
+128,101,4,232,83,105,25,90,124,119,93,21,100,92,88,98,23,90,118,121,89,23,
+98,28,120,120,62,172,114,106,141,1,26,141,116,117,172,39,88,76,190,193,73,
+94,38,179,115,114,139,254,230,138,105,115,176,38,82,75,206,203,70,84,2,40,
+103,70,68,101,1,56,64,58,66,69,60,65,252,231,110,122,96,99,107,122,4,250,
+112,99,94,91,100,114,253,52,197,0,255,255,0,100,0,0,4,98,7,10,2,38,3,238,
+0,0,0,7,4,200,0,164,0,0,0,2,0,100,0,0,4,98,5,182,0,42,0,46,0,0,1,14,2,35,
+34,39,6,35,34,38,39,51,22,22,51,50,53,53,38,38,53,53,51,21,20,22,51,50,54,
+53,53,51,21,20,6,7,21,20,51,50,54,55,1,35,17,51,4,98,4,58,119,99,151,80,82,
+149,139,137,4,140,4,66,80,151,111,120,130,82,94,88,76,130,123,106,151,80,
+66,4,254,211,140,140,4,36,163,159,88,122,122,186,224,174,116,241,12,24,154,
+115,146,119,104,103,102,105,119,146,114,154,24,13,241,116,174,251,220,2,45,
+0,0,3,0,140,255,230,4,99,5,208,0,22,0,36,0,44,0,0,37,38,39,6,6,35,32,17,17,
+16,33,32,19,54,55,23,6,6,21,21,22,22,23,1,20,22,51,50,54,53,17,52,38,35,34,
+6,21,19,55,23,17,23,7,39,17,4,42,124,79,32,177,142,254,140,1,116,1,31,65,
+79,119,58,110,126,3,127,109,252,181,113,119,119,113,113,119,119,113,30,61,
+99,253,61,72,142,79,117,178,186,2,109,1,26,2,99,254,151,114,77,113,80,239,
+153,15,148,234,79,1,62,255,226,226,255,1,56,255,226,226,255,254,107,107,77,
+2,179,188,107,57,253,77,0,0,2,0,140,0,0,4,140,5,182,0,34,0,46,0,0,1,20,51,
+50,54,54,53,53,51,21,20,14,2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,
+50,53,53,51,1,33,17,35,17,33,53,33,17,51,17,33,2,210,151,61,64,26,140,35,
+66,104,76,151,80,82,149,74,105,67,35,140,26,63,62,151,140,1,69,254,187,140,
+254,187,1,69,140,1,69,4,211,241,61,144,172,91,111,164,165,96,52,122,122,52,
+96,165,164,111,91,174,142,61,241,227,251,194,254,136,1,120,120,1,62,254,194,
+255,255,0,140,255,249,4,140,7,10,2,38,3,242,0,0,0,7,4,200,0,207,0,0,0,2,0,
+140,255,249,4,140,5,182,0,16,0,51,0,0,1,22,22,51,50,54,53,17,51,17,20,6,35,
+34,38,38,39,1,20,51,50,54,54,53,53,51,21,20,14,2,35,34,39,6,35,34,46,2,53,
+53,51,21,20,22,22,51,50,53,17,51,1,41,2,64,80,73,71,140,147,139,94,118,59,
+7,2,47,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,67,35,140,26,63,
+62,151,140,1,55,108,90,115,125,1,115,254,150,180,189,66,131,119,3,98,241,
+61,144,172,151,171,164,165,96,52,122,122,52,96,165,164,171,151,174,142,61,
+241,1,31,0,2,0,100,255,249,4,98,5,182,0,42,0,59,0,0,1,14,2,35,34,39,6,35,
+34,38,39,51,22,22,51,50,53,53,38,38,53,53,51,21,20,22,51,50,54,53,53,51,21,
+20,6,7,21,20,51,50,54,55,1,22,22,51,50,54,53,17,51,17,20,6,35,34,38,38,39,
+4,98,4,58,119,99,151,80,82,149,139,137,4,140,4,66,80,151,111,120,130,82,94,
+88,76,130,123,106,151,80,66,4,253,83,2,56,73,62,51,140,121,130,92,112,55,
+8,4,76,163,159,88,122,122,186,224,174,116,241,12,24,154,115,106,79,104,103,
+102,105,79,106,114,154,24,13,241,116,174,252,235,118,80,106,126,1,56,254,
+209,195,166,63,125,128,0,0,3,0,140,255,230,4,49,5,208,0,11,0,23,0,39,0,0,
+1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,2,17,16,18,51,50,18,37,55,23,
+53,35,53,51,17,5,7,39,21,51,21,35,17,4,49,243,223,223,244,245,222,224,242,
+140,169,159,154,171,166,159,158,170,253,192,61,125,177,177,1,60,61,135,182,
+182,2,221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,53,1,70,
+254,184,254,213,254,192,254,185,1,73,80,107,98,184,115,1,136,229,107,98,154,
+115,254,90,0,255,255,0,120,255,240,3,120,7,10,2,38,3,246,0,0,0,6,4,200,58,
+0,0,3,0,120,255,240,3,120,5,201,0,13,0,24,0,36,0,0,5,36,0,17,52,18,36,55,
+21,4,17,20,0,5,1,52,54,51,50,22,21,16,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,3,101,254,156,254,119,184,1,82,227,253,159,1,52,1,45,254,81,113,109,
+110,118,228,111,111,120,46,62,52,51,52,57,53,49,16,77,1,137,1,23,189,1,50,
+208,45,134,145,254,43,233,254,200,70,2,87,152,166,163,155,254,209,155,148,
+92,101,91,102,117,89,89,0,0,3,0,140,255,230,4,4,5,182,0,11,0,23,0,50,0,0,
+1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,1,35,
+38,35,32,17,16,18,51,50,54,54,55,23,2,33,34,2,17,16,18,51,50,22,23,53,51,
+3,61,117,96,100,118,120,98,96,117,120,44,49,53,46,42,51,55,44,1,25,130,76,
+204,254,212,151,149,78,119,93,53,105,161,254,227,211,231,229,213,93,143,42,
+130,2,162,121,142,141,122,125,153,156,122,93,73,71,95,75,78,76,1,177,178,
+253,221,254,237,254,220,46,86,90,63,254,233,1,100,1,75,1,73,1,82,54,51,239,
+255,255,0,180,255,230,4,52,7,10,2,38,3,249,0,0,0,7,4,200,0,176,0,0,0,2,0,
+180,255,230,4,52,5,182,0,7,0,32,0,0,1,55,23,17,5,7,39,17,1,20,6,6,35,34,46,
+2,53,17,51,17,20,30,2,51,50,62,2,53,17,51,1,126,61,125,1,60,61,135,1,132,
+90,200,161,123,171,103,48,140,11,59,125,115,86,117,70,33,140,1,247,107,98,
+3,173,229,107,98,252,83,1,29,243,232,110,63,124,204,194,3,135,252,101,96,
+163,119,67,42,81,144,178,3,155,0,0,2,0,100,0,0,4,77,5,208,0,13,0,27,0,0,33,
+17,35,53,51,17,1,7,37,17,33,21,33,17,1,38,38,53,52,54,55,23,6,6,21,20,22,
+23,2,78,250,250,1,255,61,254,202,1,12,254,244,254,168,134,152,154,132,49,
+103,102,111,94,2,152,110,2,202,254,228,112,175,254,19,110,253,104,1,8,56,
+254,160,161,245,59,119,47,178,121,127,185,39,0,255,255,0,140,0,0,4,46,7,10,
+2,38,3,252,0,0,0,7,4,200,0,128,0,0,0,2,0,140,0,0,4,46,5,182,0,3,0,24,0,0,
+37,35,17,51,37,33,34,6,21,17,20,22,51,33,21,33,34,38,53,17,52,54,54,51,33,
+1,14,130,130,3,32,254,145,69,44,43,70,1,111,254,134,138,104,46,105,91,1,122,
+235,4,19,64,41,78,252,41,77,43,120,104,144,3,196,104,101,45,0,2,0,180,0,0,
+3,152,5,182,0,20,0,32,0,0,1,33,34,6,21,17,20,22,51,33,21,33,34,38,53,17,52,
+54,54,51,33,1,51,17,51,17,51,21,35,17,35,17,35,3,152,254,25,69,44,43,70,1,
+231,254,14,138,104,46,105,91,1,242,253,248,185,130,185,185,130,185,5,62,41,
+78,252,41,77,43,120,104,144,3,196,104,101,45,253,150,1,96,254,160,120,254,
+104,1,152,0,255,255,0,100,0,0,4,32,7,10,2,38,3,255,0,0,0,6,4,200,108,0,0,
+2,0,100,0,0,4,32,5,182,0,11,0,25,0,0,1,17,37,17,35,17,35,53,51,17,5,17,1,
+38,38,53,52,54,55,23,6,6,21,20,22,23,4,32,254,185,140,248,248,1,71,253,238,
+134,152,154,132,49,103,102,111,94,5,182,254,7,174,251,149,2,200,110,1,252,
+172,1,48,251,82,56,254,160,161,245,59,119,47,178,121,127,185,39,0,3,0,100,
+0,0,4,121,5,212,0,35,0,41,0,45,0,0,1,39,17,36,36,39,6,6,21,20,22,23,21,38,
+38,53,52,54,55,38,53,52,54,55,21,6,6,21,20,22,23,54,54,55,17,5,1,20,22,23,
+17,4,23,51,21,35,4,61,137,254,217,254,207,1,53,64,74,85,134,155,85,74,159,
+157,132,85,74,69,59,29,236,185,1,81,253,110,154,167,254,191,111,119,119,4,
+179,65,251,12,7,247,223,15,81,50,72,75,6,112,4,139,112,75,116,26,69,148,112,
+139,4,112,6,75,72,53,84,12,152,201,28,2,3,178,252,194,151,174,25,2,203,52,
+191,247,255,255,0,100,0,0,4,43,7,10,2,38,4,2,0,0,0,7,4,200,0,138,0,0,0,3,
+0,100,0,0,4,43,5,182,0,11,0,15,0,19,0,0,1,1,51,1,1,35,1,1,35,1,1,51,1,51,
+17,35,1,51,17,35,2,71,1,47,141,254,140,1,116,145,254,213,254,214,145,1,116,
+254,140,141,2,144,130,130,252,187,130,130,3,101,2,81,253,35,253,39,2,76,253,
+180,2,217,2,221,254,101,253,134,2,122,253,134,0,3,0,140,255,230,4,49,5,208,
+0,3,0,15,0,27,0,0,1,35,17,51,5,16,2,35,34,2,17,16,18,51,50,18,3,16,2,35,34,
+2,17,16,18,51,50,18,2,159,130,130,1,146,243,223,223,244,245,222,224,242,140,
+169,159,154,171,166,159,158,170,2,63,1,147,245,254,152,254,113,1,148,1,107,
+1,94,1,141,254,115,254,154,1,53,1,70,254,184,254,213,254,192,254,185,1,73,
+0,3,0,100,0,0,5,206,5,182,0,19,0,22,0,25,0,0,1,33,1,33,1,1,33,1,33,3,55,19,
+19,23,3,19,7,3,3,39,3,33,19,17,3,33,4,43,254,20,1,34,253,13,1,54,254,192,
+3,7,254,219,1,229,221,100,220,220,100,253,253,102,218,218,102,163,254,121,
+195,196,1,137,2,168,253,88,2,214,2,224,253,96,1,127,56,254,133,1,123,56,254,
+74,254,76,56,1,120,254,136,56,4,19,254,54,254,199,254,61,255,255,0,80,255,
+230,4,120,7,10,2,38,4,6,0,0,0,7,4,200,0,183,0,0,0,1,0,80,255,230,4,120,5,
+182,0,23,0,0,1,35,17,37,55,23,17,51,17,51,3,51,19,19,51,3,51,21,35,19,35,
+3,3,35,3,5,244,254,63,61,248,140,241,188,121,155,156,121,189,198,200,191,
+126,151,150,126,2,215,253,15,247,112,131,4,236,253,153,1,195,254,144,1,112,
+254,61,120,254,60,1,104,254,152,0,1,0,80,0,0,4,170,5,182,0,28,0,0,1,35,19,
+35,39,7,35,19,33,1,35,3,3,35,1,1,51,19,19,51,3,33,3,51,19,19,51,3,51,4,170,
+185,166,126,116,115,126,165,254,145,1,21,131,213,212,131,1,22,254,234,131,
+212,213,131,234,1,41,138,121,120,121,121,139,158,2,215,254,159,250,250,1,
+97,253,41,2,47,253,209,2,219,2,219,253,209,2,47,253,153,1,44,254,254,1,2,
+254,212,0,2,0,120,255,230,3,141,5,182,0,31,0,40,0,0,19,22,22,51,50,54,55,
+33,53,33,55,53,33,53,33,53,35,34,38,53,52,54,51,33,17,20,6,6,35,34,38,39,
+19,20,22,51,33,17,33,34,6,238,55,159,82,119,100,11,253,243,2,17,1,253,238,
+2,18,246,189,214,207,196,1,130,67,155,157,112,203,72,107,133,130,1,0,255,
+0,128,135,1,3,76,89,112,156,120,32,82,120,119,166,149,154,158,252,22,196,
+202,88,104,94,3,210,94,101,1,131,98,255,255,0,180,0,0,3,196,7,10,2,38,4,10,
+0,0,0,6,4,200,118,0,0,2,0,180,0,0,3,196,5,182,0,11,0,19,0,0,33,17,33,53,33,
+17,33,53,33,53,51,17,33,17,51,17,51,21,35,17,3,56,254,252,1,4,254,252,1,4,
+140,252,240,140,233,233,1,109,120,2,108,120,237,250,74,5,182,253,161,120,
+253,33,0,1,0,180,255,230,3,196,5,182,0,29,0,0,1,35,17,20,22,51,50,54,53,53,
+33,53,33,17,33,53,33,53,51,17,20,6,35,34,38,53,17,51,17,51,2,41,233,129,124,
+124,127,254,252,1,4,254,252,1,4,140,203,190,189,202,140,233,3,37,254,78,135,
+142,143,134,134,120,1,224,120,237,251,190,191,207,207,191,4,66,253,231,0,
+4,0,140,0,0,3,172,5,182,0,3,0,7,0,11,0,15,0,0,1,51,17,35,1,51,17,35,1,17,
+35,17,1,51,17,35,3,42,130,130,253,98,130,130,1,214,140,254,182,130,130,4,
+82,253,108,3,62,254,116,2,70,250,74,5,182,252,168,254,116,0,255,255,0,140,
+255,230,5,2,7,10,2,38,4,14,0,0,0,7,4,200,1,3,0,0,0,3,0,140,255,230,5,2,5,
+208,0,34,0,60,0,72,0,0,1,34,38,39,35,21,16,14,2,35,34,46,2,17,53,52,62,2,
+51,50,22,22,17,51,54,54,51,50,22,21,20,6,1,35,53,51,53,52,38,38,35,34,7,23,
+7,39,7,17,23,55,23,7,22,51,50,54,54,53,1,20,22,22,51,50,17,16,35,34,6,6,4,
+13,114,124,8,88,33,66,108,76,78,105,65,32,30,65,108,79,103,125,53,89,9,126,
+110,122,123,123,253,172,135,135,28,62,53,90,29,168,74,113,2,2,113,74,168,
+29,90,54,61,28,1,101,23,49,45,115,115,44,50,23,1,149,154,168,49,254,236,228,
+132,68,67,131,234,1,6,145,253,225,132,65,117,255,254,243,166,160,187,207,
+196,178,1,66,120,144,168,140,69,104,160,92,108,119,253,180,61,108,92,161,
+113,71,142,168,1,48,114,94,55,1,7,1,28,63,109,0,0,2,0,140,255,230,4,49,5,
+208,0,11,0,34,0,0,1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,39,17,35,17,6,2,
+17,20,23,55,23,3,22,51,50,55,3,55,23,54,4,49,243,223,223,244,245,222,224,
+242,140,134,128,130,125,136,15,141,103,206,80,192,194,82,200,103,134,15,2,
+221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,254,154,1,17,1,64,34,254,
+247,1,9,32,254,189,254,248,132,112,180,80,254,246,237,244,1,3,80,172,105,
+0,2,0,140,255,230,4,55,5,208,0,22,0,34,0,0,1,22,23,51,21,35,6,7,51,21,35,
+6,6,35,34,2,17,16,33,50,19,51,21,1,16,2,35,34,2,17,16,18,51,50,18,3,106,24,
+4,177,177,5,23,205,232,47,162,116,191,191,1,126,235,90,232,254,196,117,126,
+124,116,118,122,125,118,4,74,126,184,110,194,116,110,146,138,1,135,1,120,
+2,235,254,232,110,254,147,1,94,1,29,254,232,254,165,254,161,254,216,1,32,
+255,255,0,140,255,230,4,49,7,10,2,38,4,18,0,0,0,7,4,200,0,160,0,0,0,2,0,140,
+255,230,4,49,5,208,0,11,0,26,0,0,1,16,2,35,34,2,17,16,18,51,50,18,3,16,2,
+35,34,2,17,16,18,23,17,51,17,54,18,4,49,243,223,223,244,245,222,224,242,140,
+169,159,154,171,133,128,130,127,135,2,221,254,152,254,113,1,148,1,107,1,94,
+1,141,254,115,254,154,1,53,1,70,254,184,254,213,254,229,254,187,32,2,135,
+253,122,33,1,67,0,0,3,0,120,255,226,3,112,5,182,0,3,0,29,0,35,0,0,1,51,17,
+35,39,6,6,21,20,22,23,21,38,38,53,52,54,55,38,53,52,54,55,21,6,6,21,20,22,
+23,1,37,55,5,17,51,1,252,119,119,108,68,82,74,85,134,155,85,74,159,157,132,
+85,74,82,68,1,224,253,58,41,2,17,140,4,182,253,201,244,6,89,57,72,75,6,112,
+4,139,112,75,116,26,69,148,112,139,4,112,6,75,72,57,89,6,252,1,240,123,190,
+5,39,0,255,255,0,140,255,230,4,49,7,10,2,38,4,21,0,0,0,7,4,200,0,160,0,0,
+0,2,0,140,255,230,4,49,5,208,0,11,0,31,0,0,1,16,2,35,34,2,17,16,18,51,50,
+18,1,54,17,16,2,35,34,2,17,16,23,17,51,17,22,51,50,55,17,51,4,49,243,223,
+223,244,245,222,224,242,254,240,132,169,159,154,171,131,130,28,36,40,26,130,
+2,221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,252,119,159,1,132,1,
+53,1,70,254,184,254,213,254,112,157,2,52,253,121,7,8,2,134,0,2,0,80,0,0,3,
+234,5,182,0,14,0,17,0,0,1,17,35,17,1,39,1,1,55,1,17,51,17,1,17,1,23,17,2,
+142,140,254,168,90,1,167,254,89,90,1,88,140,1,92,254,177,205,2,103,253,153,
+2,100,254,148,80,1,190,1,191,80,254,148,2,13,253,240,1,111,251,227,2,14,216,
+1,177,255,255,0,100,0,0,4,122,7,10,2,38,4,24,0,0,0,7,4,200,0,178,0,0,0,1,
+0,100,0,0,4,122,5,182,0,20,0,0,19,22,22,51,50,54,55,51,6,2,7,17,37,17,35,
+17,5,17,38,2,3,240,28,194,161,151,198,32,142,34,237,182,254,128,140,1,128,
+186,234,33,5,182,218,242,238,222,250,254,210,24,253,109,174,254,111,2,88,
+172,1,202,22,1,37,1,5,0,0,3,0,100,0,0,4,122,5,208,0,20,0,32,0,42,0,0,19,22,
+22,51,50,54,55,51,6,2,7,17,37,17,35,17,5,17,38,2,3,5,20,6,35,34,38,53,52,
+54,51,50,22,7,52,38,35,34,21,20,22,51,50,240,28,194,161,151,198,32,142,34,
+237,182,254,128,140,1,128,186,234,33,2,196,94,90,90,98,99,89,88,96,100,41,
+43,87,42,40,89,5,92,218,242,238,222,250,254,210,24,253,199,174,254,111,2,
+88,172,1,112,22,1,37,1,5,133,111,125,123,113,116,133,135,114,77,68,145,63,
+70,255,255,0,120,0,0,3,247,7,10,2,38,4,27,0,0,0,6,4,200,121,0,0,3,0,120,0,
+0,3,247,5,208,0,22,0,25,0,28,0,0,55,1,1,55,23,17,5,17,1,1,17,37,17,55,23,
+1,1,7,39,17,35,17,7,19,21,55,51,23,53,158,1,64,254,192,84,252,254,138,1,191,
+1,192,254,131,250,84,254,192,1,64,82,252,140,254,10,206,223,206,141,1,38,
+1,40,79,233,1,216,220,2,147,254,248,1,8,253,109,223,254,39,231,79,254,216,
+254,218,82,232,254,221,1,37,234,4,196,241,120,120,241,0,3,0,100,0,23,4,23,
+5,162,0,29,0,33,0,37,0,0,19,22,22,51,50,54,55,23,6,6,7,17,22,22,23,7,38,38,
+35,34,6,7,39,54,54,55,17,38,38,39,19,17,51,17,33,17,51,17,224,36,184,128,
+128,186,38,123,44,209,150,149,210,44,123,38,185,129,127,185,36,124,44,213,
+147,148,212,44,124,130,1,184,130,5,162,183,216,207,192,38,203,248,25,254,
+120,23,249,203,38,192,207,215,184,39,201,248,25,1,136,25,251,199,253,0,1,
+12,254,244,1,12,254,244,255,255,0,80,0,0,3,202,7,10,2,38,4,30,0,0,0,6,4,200,
+78,0,0,2,0,80,0,0,3,202,5,182,0,27,0,31,0,0,1,33,17,35,17,35,53,51,17,35,
+53,51,17,51,17,33,17,51,17,51,21,35,17,51,21,35,17,35,1,33,17,33,2,156,254,
+226,140,162,162,162,162,140,1,30,140,162,162,162,162,140,254,226,1,30,254,
+226,1,183,254,73,1,183,120,1,254,120,1,17,254,239,1,17,254,239,120,254,2,
+120,254,73,2,47,1,254,0,2,0,100,0,0,4,41,5,212,0,31,0,36,0,0,19,54,54,55,
+33,53,33,38,38,39,53,22,22,23,51,17,5,7,39,17,35,32,36,53,52,36,55,53,35,
+6,6,7,19,16,5,17,4,100,151,125,20,254,216,1,43,15,134,150,195,212,20,126,
+1,156,63,209,44,254,210,254,187,1,26,249,130,26,216,181,162,1,135,254,121,
+3,151,15,62,57,120,58,60,14,120,19,120,113,1,63,225,107,108,251,12,217,207,
+186,227,18,198,110,131,13,254,137,254,228,19,2,98,24,0,3,0,100,255,240,4,
+49,5,182,0,28,0,32,0,36,0,0,19,22,22,51,50,54,53,17,38,2,39,51,22,22,51,50,
+54,55,51,6,2,7,17,20,6,35,34,38,39,1,35,17,51,1,35,17,51,230,21,93,53,67,
+53,191,204,22,139,19,166,163,157,165,23,141,27,206,183,128,140,93,150,35,
+3,88,130,130,253,148,130,130,1,1,70,83,102,98,2,117,18,1,1,254,222,190,194,
+218,252,254,254,19,253,129,168,142,119,101,1,13,1,104,254,152,1,104,255,255,
+0,80,255,234,4,51,7,10,2,38,4,34,0,0,0,7,4,200,0,133,0,0,0,1,0,80,255,234,
+4,51,5,208,0,66,0,0,19,33,53,38,38,53,53,52,38,35,34,6,7,35,54,54,51,50,22,
+21,21,20,22,22,51,50,54,53,53,52,54,51,50,22,23,35,38,38,35,34,6,21,21,20,
+6,7,21,33,21,33,17,20,6,35,34,38,39,55,22,22,51,50,54,54,53,53,33,170,1,81,
+71,66,33,45,34,37,6,135,14,106,92,112,96,14,31,33,45,32,96,112,91,107,14,
+135,6,37,34,46,32,65,73,1,82,254,174,112,129,108,114,3,131,2,44,50,40,42,
+17,254,175,2,201,20,21,156,172,44,142,100,47,52,119,100,151,178,89,87,96,
+43,97,129,89,177,152,100,119,52,47,104,138,44,168,157,23,21,120,254,252,198,
+157,148,146,24,107,91,37,86,117,255,0,4,0,100,0,0,4,139,5,182,0,16,0,20,0,
+24,0,28,0,0,33,17,38,2,3,51,18,18,51,50,18,19,51,2,2,7,17,37,35,17,51,1,35,
+17,51,19,17,51,17,2,55,205,239,23,140,21,202,169,164,202,24,141,25,238,193,
+1,76,130,130,253,94,130,130,202,140,3,37,24,1,81,1,40,254,245,254,239,1,22,
+1,6,254,225,254,174,30,252,217,240,1,134,254,122,1,134,1,222,1,58,254,198,
+255,255,0,100,0,0,3,251,7,10,2,38,4,37,0,0,0,6,4,200,110,0,0,6,0,100,0,0,
+3,251,5,182,0,14,0,18,0,33,0,37,0,41,0,55,0,0,1,34,38,53,52,54,54,51,21,34,
+6,21,20,22,51,39,35,53,51,1,50,54,53,52,38,35,53,50,22,22,21,20,6,35,19,51,
+21,35,1,17,35,17,1,38,38,35,34,2,7,35,18,18,51,50,18,19,3,222,183,204,102,
+171,114,121,136,137,120,13,120,120,252,150,120,137,136,121,113,172,102,204,
+183,13,120,120,1,253,130,1,138,27,169,135,133,169,25,131,31,238,191,191,236,
+32,2,142,219,175,115,197,102,110,161,143,130,153,195,198,254,119,153,130,
+143,161,110,102,197,115,174,220,1,248,198,253,151,254,239,1,17,254,169,251,
+251,254,249,239,1,41,1,69,254,195,254,207,0,4,0,80,0,0,4,216,5,182,0,13,0,
+25,0,37,0,51,0,0,33,38,38,35,34,2,7,35,18,18,51,50,18,19,1,34,38,53,52,54,
+51,50,22,21,20,6,3,34,6,21,20,22,51,50,54,53,52,38,1,2,2,35,34,2,3,51,22,
+18,51,50,54,55,4,86,27,169,135,133,169,25,131,31,238,191,191,236,32,252,82,
+100,118,120,98,96,117,117,96,53,46,42,51,55,44,44,3,125,32,236,191,191,238,
+31,131,26,168,133,135,169,27,251,251,254,249,239,1,41,1,69,254,195,254,207,
+1,213,141,122,125,153,156,122,121,142,1,173,71,95,75,78,76,77,93,73,2,52,
+254,208,254,194,1,70,1,40,241,254,251,250,252,0,0,1,0,80,0,0,4,77,5,208,0,
+37,0,0,33,17,6,7,39,18,55,17,6,7,39,18,55,17,5,53,23,53,51,17,39,17,35,17,
+37,21,22,19,7,38,39,17,22,19,7,38,39,17,1,51,99,4,124,27,200,99,4,124,27,
+200,1,164,234,140,234,140,254,232,193,28,123,6,92,193,28,123,6,92,1,132,55,
+217,28,1,73,43,1,156,55,217,28,1,73,43,1,176,247,174,174,221,254,42,172,251,
+116,4,69,167,205,47,254,191,34,211,59,254,104,47,254,191,34,211,59,254,129,
+0,255,255,0,100,0,0,4,43,7,10,2,38,4,41,0,0,0,6,4,200,119,0,0,1,0,100,0,0,
+4,43,5,212,0,27,0,0,1,35,17,35,17,35,53,51,53,35,53,51,17,5,53,5,7,39,17,
+35,17,39,17,51,21,35,21,51,2,108,185,140,195,195,195,195,1,129,1,131,51,196,
+140,245,185,185,185,1,180,254,76,1,180,110,150,110,2,170,153,157,201,116,
+103,251,2,4,177,98,254,19,110,150,0,3,0,100,0,0,3,251,5,182,0,14,0,29,0,43,
+0,0,1,34,38,53,52,54,54,51,21,34,6,21,20,22,51,33,50,54,53,52,38,35,53,50,
+22,22,21,20,6,35,1,38,38,35,34,2,7,35,18,18,51,50,18,19,3,222,183,204,102,
+171,114,121,136,137,120,252,137,120,137,136,121,113,172,102,204,183,3,18,
+27,169,135,133,169,25,131,31,238,191,191,236,32,2,142,219,175,115,197,102,
+110,161,143,130,153,153,130,143,161,110,102,197,115,174,220,253,114,251,251,
+254,249,239,1,41,1,69,254,195,254,207,0,2,0,120,255,230,4,68,5,208,0,35,0,
+47,0,0,19,52,54,54,51,50,22,21,20,6,7,21,35,34,6,21,20,22,51,50,54,55,23,
+6,4,35,34,38,38,53,52,54,55,53,38,38,55,20,22,51,50,54,53,52,38,35,34,6,120,
+113,214,150,223,252,216,188,81,150,177,174,153,139,219,40,107,69,254,237,
+161,137,213,117,219,189,189,219,130,182,165,163,182,180,165,166,181,4,135,
+98,150,81,177,152,141,173,13,228,138,118,117,136,120,93,83,113,138,96,172,
+106,155,202,14,113,13,174,140,105,113,112,106,105,114,115,255,255,0,130,0,
+0,4,197,7,10,2,38,4,45,0,0,0,7,4,200,0,241,0,0,0,3,0,130,0,0,4,197,5,182,
+0,38,0,43,0,48,0,0,1,33,21,22,18,23,35,38,38,39,17,35,17,6,6,7,35,18,37,53,
+38,38,53,16,37,53,51,21,33,53,51,21,33,21,33,21,33,21,33,37,22,22,23,53,17,
+6,6,7,33,4,153,254,78,195,245,38,144,32,165,137,140,139,164,31,139,79,1,138,
+236,227,1,207,140,1,48,130,254,78,1,181,254,75,1,178,252,133,20,155,142,143,
+155,19,1,61,2,151,122,19,254,244,254,196,204,20,254,92,1,164,18,199,203,1,
+244,41,124,13,165,155,1,48,26,134,132,132,252,158,110,159,159,77,76,5,158,
+1,11,5,74,78,0,4,0,120,255,229,4,28,5,208,0,23,0,50,0,54,0,58,0,0,19,52,55,
+38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,21,20,4,35,34,38,1,54,54,53,52,
+38,38,35,34,6,21,20,22,23,21,6,6,21,20,22,51,50,54,53,52,38,39,39,17,51,17,
+3,17,51,17,120,190,84,86,112,204,131,132,202,111,87,84,191,255,0,209,213,
+254,2,83,85,102,77,142,96,143,174,106,84,98,112,191,146,143,192,104,103,194,
+130,130,130,1,136,247,113,52,170,105,115,189,105,104,189,116,102,170,53,112,
+250,186,233,233,2,92,28,149,92,83,138,78,170,129,93,145,29,121,27,151,121,
+135,173,176,132,115,157,29,237,1,6,254,250,253,101,1,6,254,250,255,255,0,
+100,0,0,4,25,7,10,2,38,4,48,0,0,0,6,4,200,121,0,0,2,0,100,0,0,4,25,5,182,
+0,35,0,44,0,0,33,17,6,6,7,39,54,54,55,53,34,38,53,52,54,54,51,53,51,21,33,
+21,33,17,33,21,33,21,22,22,23,7,38,38,39,17,1,20,22,51,51,17,35,34,6,1,250,
+99,148,33,124,44,213,147,188,218,105,187,114,140,1,108,254,148,1,108,254,
+148,149,210,44,123,30,144,106,254,96,148,115,13,13,116,147,1,177,25,203,162,
+39,201,248,25,121,181,161,104,157,84,98,98,120,254,65,120,121,23,249,203,
+38,157,204,29,254,79,3,251,101,121,1,191,124,0,0,3,0,120,255,196,3,212,5,
+212,0,19,0,23,0,27,0,0,5,1,17,35,17,5,17,39,17,35,17,1,17,51,17,37,17,23,
+17,51,37,35,53,51,5,35,53,51,3,212,253,48,140,1,104,220,140,2,208,140,254,
+152,220,140,253,178,130,130,1,194,130,130,60,1,152,254,164,2,42,203,3,42,
+125,254,164,2,42,254,106,1,120,253,184,204,252,214,124,1,120,93,218,218,218,
+0,255,255,0,100,255,240,4,144,7,10,2,38,4,51,0,0,0,7,4,200,0,182,0,0,0,1,
+0,100,255,240,4,144,5,182,0,45,0,0,1,33,21,20,6,35,34,38,39,55,22,22,51,50,
+54,53,53,33,53,33,53,38,2,3,35,53,33,21,35,30,2,51,50,54,55,35,53,33,21,35,
+2,2,7,21,33,4,34,254,158,128,140,93,150,35,119,21,93,53,67,53,254,158,1,98,
+173,187,26,78,1,115,154,16,73,129,99,138,150,26,151,1,115,80,31,190,163,1,
+98,2,33,251,168,142,119,101,53,70,83,102,98,241,120,101,23,1,19,1,22,120,
+120,177,189,94,207,253,120,120,254,238,254,235,24,102,0,1,0,120,0,0,4,3,5,
+212,0,37,0,0,1,51,17,5,7,39,17,35,17,35,21,35,53,35,21,35,17,51,21,51,53,
+51,21,51,17,35,21,35,53,35,21,35,17,51,21,51,53,51,1,219,165,1,131,51,196,
+140,165,130,95,130,130,95,130,165,165,130,95,130,130,95,130,4,90,1,122,201,
+116,103,251,2,1,118,218,218,218,2,18,202,202,202,2,8,218,218,218,2,18,202,
+202,0,0,2,0,100,255,240,3,217,5,182,0,30,0,36,0,0,19,22,22,51,50,54,53,17,
+38,38,53,52,54,55,53,51,21,33,21,33,17,33,21,33,17,20,6,35,34,38,39,19,20,
+22,51,17,32,219,21,93,53,67,53,199,202,210,191,140,1,83,254,173,1,83,254,
+173,128,140,93,150,35,135,136,135,254,241,1,1,70,83,102,98,1,57,2,153,147,
+143,159,3,238,238,120,254,145,120,254,189,168,142,119,101,2,203,88,94,1,111,
+255,255,0,100,255,240,4,49,7,10,2,38,4,55,0,0,0,7,4,200,0,138,0,0,0,1,0,100,
+255,240,4,49,5,182,0,30,0,0,19,22,22,51,50,54,53,17,38,2,3,51,18,18,23,17,
+51,17,54,18,19,51,2,5,17,20,6,35,34,38,39,226,21,93,53,67,53,188,202,23,139,
+15,136,123,140,121,137,21,141,55,254,147,128,140,93,150,35,1,1,70,83,102,
+98,1,185,29,1,94,1,82,254,242,254,220,31,2,81,253,173,31,1,38,1,14,253,103,
+53,254,62,168,142,119,101,0,0,3,0,180,255,230,4,105,5,182,0,18,0,27,0,34,
+0,0,1,4,21,20,6,7,17,20,6,35,34,38,53,17,51,17,33,17,51,1,50,54,53,17,33,
+17,20,22,1,52,38,39,17,54,54,3,76,1,29,150,135,165,168,164,167,140,1,128,
+140,254,181,104,87,254,128,86,2,81,70,85,73,82,4,145,24,220,106,125,12,254,
+202,204,194,191,207,4,66,254,223,1,33,250,168,126,151,2,170,253,86,150,127,
+3,65,58,58,7,254,254,8,59,0,5,0,140,0,0,4,140,5,182,0,3,0,7,0,42,0,46,0,50,
+0,0,33,33,53,33,37,35,17,51,19,20,51,50,54,54,53,53,51,21,20,14,2,35,34,39,
+6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,17,51,1,35,17,51,1,35,17,51,4,
+60,252,160,3,96,254,145,130,130,5,151,61,64,26,140,35,66,104,76,151,80,82,
+149,74,105,67,35,140,26,63,62,151,140,1,19,130,130,253,208,130,130,120,156,
+1,142,1,245,241,61,144,172,151,171,164,165,96,52,122,122,52,96,165,164,171,
+151,174,142,61,241,1,31,251,94,1,142,254,114,1,142,0,255,255,0,124,255,230,
+4,83,7,10,2,38,4,59,0,0,0,7,4,200,0,167,0,0,0,5,0,124,255,230,4,83,5,208,
+0,29,0,40,0,51,0,55,0,59,0,0,1,23,17,51,17,39,14,2,35,34,46,2,17,53,39,17,
+35,17,23,62,2,51,50,30,2,21,7,37,17,20,22,22,51,50,54,54,53,1,5,53,52,38,
+38,35,34,6,6,21,19,53,51,21,3,53,51,21,3,129,80,130,211,2,56,120,104,78,105,
+65,32,80,130,211,6,58,119,98,79,108,64,30,140,254,229,27,60,53,54,61,28,254,
+229,1,27,28,62,53,52,61,27,76,130,130,130,2,186,40,1,138,253,184,103,247,
+230,120,67,131,234,1,6,179,39,254,114,2,92,108,205,199,100,66,134,229,253,
+167,139,254,214,168,145,73,71,142,168,1,183,144,221,168,140,69,67,136,164,
+253,58,238,238,2,188,238,238,0,0,5,0,80,255,230,4,28,5,193,0,23,0,35,0,49,
+0,53,0,57,0,0,1,33,17,35,17,33,53,33,53,38,38,53,52,54,51,50,22,22,21,20,
+6,7,21,33,1,20,22,51,50,54,53,52,38,35,34,6,1,6,4,35,34,36,39,55,22,22,51,
+50,54,55,7,35,17,51,1,35,17,51,3,241,254,150,140,254,150,1,106,134,166,203,
+156,101,168,96,160,124,1,106,253,96,128,101,107,128,130,105,104,125,2,203,
+52,255,0,178,176,254,253,51,113,39,198,134,140,192,44,68,130,130,254,52,130,
+130,2,174,254,26,1,230,120,58,18,167,117,129,178,81,143,83,110,168,21,61,
+1,106,87,111,113,85,87,108,111,252,78,158,174,176,153,39,123,135,131,129,
+2,1,12,254,244,1,12,0,255,255,0,140,255,230,4,202,7,10,2,38,4,62,0,0,0,7,
+4,200,0,208,0,0,0,3,0,140,255,230,4,202,5,212,0,11,0,46,0,50,0,0,1,39,17,
+35,53,33,21,35,17,5,53,5,1,20,51,50,54,54,53,53,51,21,20,14,2,35,34,39,6,
+35,34,46,2,53,53,51,21,20,22,22,51,50,53,53,51,1,33,53,37,4,151,196,140,254,
+138,140,2,2,1,131,254,8,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,
+67,35,140,26,63,62,151,140,254,255,1,118,254,138,4,151,103,253,120,235,235,
+3,90,210,214,201,252,68,241,61,144,172,81,101,164,165,96,52,122,122,52,96,
+165,164,101,81,174,142,61,241,217,1,167,170,154,0,6,0,180,0,0,4,86,5,182,
+0,9,0,12,0,15,0,19,0,23,0,27,0,0,33,1,3,35,17,51,19,1,51,17,1,19,17,1,19,
+3,37,35,17,51,17,35,17,51,17,35,17,51,3,17,255,0,255,94,94,255,1,0,94,254,
+232,140,254,93,139,139,3,22,130,130,130,130,130,130,2,62,253,194,5,182,253,
+194,2,62,250,74,2,219,254,198,2,116,253,140,1,58,1,58,77,1,51,252,197,1,51,
+252,197,1,51,0,255,255,0,180,255,240,4,226,7,10,2,38,4,65,0,0,0,7,4,200,0,
+223,0,0,0,3,0,180,255,240,4,226,5,193,0,39,0,42,0,45,0,0,1,62,2,53,52,38,
+35,35,17,35,1,1,35,17,51,1,1,51,17,51,50,54,53,52,38,39,55,22,22,21,20,6,
+7,22,22,21,20,6,7,37,19,3,1,19,17,3,194,56,64,28,88,91,24,45,254,193,254,
+194,45,45,1,62,1,63,45,24,91,88,66,82,55,116,117,78,72,73,77,118,115,253,
+61,164,164,1,46,165,1,97,18,48,63,57,71,90,253,52,2,100,253,156,5,209,253,
+156,2,100,253,105,90,71,81,77,28,111,45,141,101,72,116,38,39,117,70,102,140,
+45,170,1,60,1,61,254,195,254,197,2,119,0,0,3,0,120,255,240,4,10,5,202,0,42,
+0,48,0,53,0,0,1,39,6,7,22,23,7,38,39,6,7,39,54,55,38,17,52,55,39,17,35,17,
+23,54,55,38,38,39,55,22,23,54,37,23,6,6,7,22,17,7,23,17,51,1,20,23,54,55,
+39,19,6,7,23,38,4,10,213,38,114,129,201,18,248,156,156,248,18,202,127,169,
+5,70,130,224,41,98,74,170,84,18,255,149,148,1,0,18,85,170,74,169,2,67,130,
+253,189,122,94,21,237,122,80,28,229,4,1,192,114,167,128,102,60,121,73,124,
+124,73,121,61,101,191,1,19,38,57,38,254,114,2,92,124,142,106,57,77,31,121,
+83,116,116,83,121,31,77,57,186,254,235,58,37,1,138,254,213,222,153,116,156,
+126,1,94,97,131,127,214,255,255,0,140,255,240,3,164,7,10,2,38,4,68,0,0,0,
+6,4,200,78,0,0,3,0,140,255,240,3,164,5,202,0,18,0,22,0,26,0,0,5,36,0,17,16,
+0,37,23,14,3,7,33,21,33,22,0,5,39,53,51,21,3,53,51,21,3,38,254,182,254,176,
+1,58,1,96,18,162,182,119,71,8,2,138,253,118,15,1,12,1,3,242,130,130,130,16,
+97,1,120,1,20,1,11,1,112,114,121,59,109,131,163,102,120,210,254,229,79,244,
+228,228,2,36,228,228,0,0,2,0,140,255,240,3,155,5,202,0,18,0,31,0,0,5,36,0,
+17,16,0,37,23,14,3,7,33,21,33,22,0,5,3,54,54,53,52,39,55,22,22,21,20,6,7,
+3,38,254,182,254,176,1,58,1,96,18,162,182,119,71,8,1,143,254,113,15,1,12,
+1,3,214,83,100,183,53,125,135,143,117,16,97,1,120,1,20,1,11,1,112,114,121,
+59,109,131,163,102,120,210,254,229,79,1,111,36,149,90,205,87,104,60,205,131,
+120,206,53,255,255,0,80,0,0,4,78,7,10,2,38,4,71,0,0,0,7,4,200,0,133,0,0,0,
+2,0,80,0,0,4,78,5,208,0,17,0,31,0,0,1,33,17,37,17,35,17,5,17,33,53,33,17,
+5,7,37,21,33,1,53,52,54,51,50,23,7,38,35,34,6,21,21,4,25,254,194,254,215,
+140,1,41,254,192,1,64,1,255,61,254,202,1,62,252,55,148,134,73,84,30,71,60,
+70,78,3,146,253,21,164,254,181,2,38,162,2,14,110,1,208,255,112,155,252,253,
+91,135,137,150,26,115,21,91,76,139,0,0,2,0,100,0,0,3,240,5,208,0,55,0,68,
+0,0,19,22,22,51,50,54,53,52,46,6,53,52,54,51,50,23,54,51,50,22,21,20,6,35,
+34,38,53,55,38,35,34,6,21,20,30,6,21,20,6,35,34,39,21,35,17,51,1,52,38,35,
+34,6,6,21,20,22,51,50,54,230,33,151,97,112,129,53,87,110,116,110,87,53,170,
+144,94,86,52,124,97,105,103,99,101,107,3,70,74,90,91,53,87,110,116,110,87,
+53,200,181,162,119,130,130,2,146,39,43,33,39,17,40,43,45,43,1,111,100,117,
+111,97,72,103,77,60,59,66,91,122,86,138,176,39,119,161,147,144,149,146,147,
+69,39,105,98,63,92,71,59,60,69,91,123,83,159,185,109,139,2,50,2,106,119,77,
+36,70,90,99,84,78,0,255,255,0,120,0,0,3,190,7,10,2,38,4,74,0,0,0,6,4,200,
+81,0,0,1,0,120,0,0,3,190,5,182,0,21,0,0,1,55,23,1,1,7,39,17,37,17,35,17,5,
+17,7,39,1,1,55,23,17,51,2,112,250,84,254,192,1,64,82,252,254,148,140,1,108,
+254,82,1,64,254,192,84,252,140,4,168,231,79,254,216,254,218,82,232,253,91,
+154,254,131,2,58,152,1,232,234,82,1,38,1,40,79,233,1,16,0,3,0,80,255,230,
+3,196,5,182,0,3,0,7,0,15,0,0,1,35,17,51,1,35,17,51,1,5,17,1,7,37,17,1,1,97,
+130,130,1,214,130,130,253,86,1,56,1,255,61,254,202,253,255,4,176,1,6,254,
+250,1,6,251,188,168,3,218,254,228,112,175,252,31,1,28,255,255,0,80,0,0,4,
+39,7,10,2,38,4,77,0,0,0,7,4,200,0,130,0,0,0,2,0,80,0,0,4,39,5,208,0,9,0,19,
+0,0,1,39,17,37,17,35,17,5,17,5,1,53,39,55,23,17,51,17,37,55,3,234,246,254,
+85,140,1,171,1,191,253,29,244,61,183,120,254,148,61,4,124,128,251,181,204,
+254,131,2,68,202,4,86,228,254,131,155,148,107,110,1,27,252,223,221,107,0,
+0,1,0,100,0,0,4,46,5,182,0,39,0,0,19,54,54,55,53,38,38,39,55,22,22,23,17,
+51,17,54,54,55,23,6,6,7,21,22,22,23,7,38,38,39,17,37,21,35,17,5,17,6,6,7,
+100,49,216,150,149,217,49,121,36,147,111,140,106,148,39,122,57,210,148,148,
+210,57,122,39,148,106,254,215,140,1,41,111,147,36,2,44,163,198,18,61,18,198,
+164,52,126,164,20,1,88,254,168,20,161,131,54,165,196,19,60,20,195,165,54,
+131,160,20,253,42,164,251,1,204,162,2,4,21,164,125,255,255,0,80,0,0,3,143,
+7,10,2,38,4,80,0,0,0,6,4,200,52,0,0,1,0,80,0,0,3,143,5,208,0,29,0,0,33,17,
+33,53,33,53,33,53,33,53,33,53,33,17,1,7,37,17,33,21,33,21,33,21,33,21,33,
+21,33,17,1,144,254,192,1,64,254,192,1,64,254,192,1,64,1,255,61,254,202,1,
+82,254,174,1,82,254,174,1,82,254,174,1,78,110,160,110,160,110,1,248,254,228,
+112,175,254,229,110,160,110,160,110,254,178,0,0,2,0,180,0,0,3,109,5,202,0,
+5,0,9,0,0,1,37,17,35,17,1,3,35,17,51,3,68,253,252,140,2,185,92,130,130,4,
+72,200,250,240,5,202,254,249,252,62,2,98,0,0,3,0,80,255,254,4,92,5,183,0,
+25,0,43,0,61,0,0,19,22,19,33,18,55,23,6,2,21,16,23,7,38,2,39,33,6,2,7,39,
+54,17,52,2,39,1,52,38,38,35,34,6,6,21,35,52,54,54,51,50,22,22,21,17,20,6,
+6,35,34,38,38,53,51,20,22,22,51,50,54,54,53,159,252,16,1,86,16,252,79,107,
+111,218,77,118,142,10,254,170,10,142,118,77,218,111,107,2,57,7,20,24,25,19,
+7,130,34,76,71,71,77,33,33,77,71,71,77,33,130,7,19,25,26,19,6,5,183,207,254,
+65,1,192,206,101,92,254,201,208,254,55,195,101,86,1,104,245,246,254,153,86,
+101,195,1,201,209,1,55,91,250,196,202,114,39,59,150,146,238,155,77,77,163,
+230,5,140,227,164,79,78,156,236,161,139,55,44,128,183,0,255,255,0,80,255,
+236,4,132,7,10,2,38,4,84,0,0,0,7,4,200,0,178,0,0,0,3,0,80,255,236,4,132,5,
+183,0,20,0,38,0,42,0,0,55,55,23,17,51,17,33,18,55,23,6,2,21,16,23,7,38,2,
+39,33,17,37,52,38,38,35,34,6,6,21,35,52,54,54,51,50,22,22,21,3,35,17,51,80,
+58,143,140,1,132,16,252,79,107,111,218,77,118,142,10,254,124,1,32,7,20,24,
+25,19,7,130,34,76,71,71,77,33,117,130,130,228,104,101,4,207,253,115,1,192,
+206,101,92,254,201,208,254,55,195,101,86,1,104,245,253,59,42,202,114,39,59,
+150,146,238,155,77,77,163,230,3,210,1,119,0,0,3,0,80,255,254,4,12,5,183,0,
+25,0,29,0,33,0,0,19,22,19,33,18,55,23,6,2,21,16,23,7,38,2,39,33,6,2,7,39,
+54,17,52,2,39,1,35,17,51,17,35,17,51,159,252,16,1,6,16,252,79,107,111,218,
+77,118,142,10,254,250,10,142,118,77,218,111,107,2,31,130,130,130,130,5,183,
+207,254,65,1,192,206,101,92,254,201,208,254,55,195,101,86,1,104,245,246,254,
+153,86,101,195,1,201,209,1,55,91,254,190,1,119,250,201,1,119,0,255,255,0,
+100,0,0,4,48,7,1,2,38,4,87,0,0,0,6,4,200,119,247,0,4,0,100,0,0,4,48,5,209,
+0,14,0,24,0,36,0,40,0,0,19,52,54,54,51,50,22,22,21,20,6,6,35,34,38,1,1,33,
+21,33,53,1,33,53,33,1,20,22,51,50,54,53,52,38,35,34,6,23,53,51,21,120,110,
+203,134,134,202,109,106,201,138,207,240,3,144,253,112,2,184,252,52,2,81,253,
+175,3,164,252,252,161,146,150,155,157,148,147,160,237,140,4,81,109,177,98,
+99,175,110,115,175,94,207,254,67,254,149,120,107,1,76,120,2,34,125,139,135,
+129,126,137,139,254,252,252,0,2,0,80,0,0,4,102,5,182,0,32,0,49,0,0,33,17,
+35,17,35,17,51,21,51,53,38,2,39,51,22,22,51,50,54,55,51,6,2,7,21,51,53,51,
+17,35,17,35,17,19,20,6,6,35,34,46,2,53,51,20,22,51,50,54,53,2,21,196,140,
+140,196,179,234,40,140,35,196,152,142,199,39,143,41,236,176,196,140,140,196,
+176,49,108,94,68,94,60,29,140,48,63,65,46,1,186,254,244,2,102,226,254,22,
+1,18,241,203,218,212,209,237,254,236,24,254,226,253,154,1,12,254,70,5,182,
+172,156,80,44,83,139,142,170,118,112,176,0,0,3,0,80,0,0,4,38,5,182,0,3,0,
+17,0,31,0,0,33,35,17,51,1,38,2,53,52,18,55,23,6,6,21,20,22,23,33,54,54,53,
+52,38,39,55,22,18,21,20,2,7,2,129,140,140,1,97,140,150,146,142,68,109,117,
+119,109,252,42,110,118,116,110,68,140,148,148,142,5,182,250,238,101,1,38,
+174,172,1,33,104,108,88,234,135,136,240,85,86,241,134,135,234,88,108,101,
+254,220,172,172,254,217,102,255,255,0,120,255,230,4,36,7,10,2,38,4,91,0,0,
+0,7,4,200,0,139,0,0,0,1,0,120,255,230,4,36,5,208,0,31,0,0,1,37,17,37,55,23,
+17,37,21,35,17,5,17,37,21,35,17,5,17,5,7,39,17,5,53,51,17,37,17,5,53,51,4,
+36,254,112,254,65,61,246,254,252,140,1,144,254,252,140,1,144,1,191,61,246,
+1,4,140,254,112,1,4,140,1,63,129,254,38,248,112,132,1,35,84,208,1,128,133,
+1,48,84,208,1,128,133,1,181,228,112,129,254,239,86,186,254,158,129,254,206,
+86,186,255,255,0,130,255,230,4,10,5,208,2,6,4,168,0,0,0,3,0,140,255,230,4,
+49,5,208,0,11,0,22,0,33,0,0,1,16,2,35,34,2,17,16,18,51,50,18,1,53,33,18,18,
+51,50,18,19,33,21,17,33,2,2,35,34,2,3,33,53,51,4,49,243,223,223,244,245,222,
+224,242,253,236,254,251,7,166,152,152,169,6,254,251,1,4,11,166,149,146,170,
+8,1,4,130,2,221,254,152,254,113,1,148,1,107,1,94,1,141,254,115,253,133,232,
+254,218,254,212,1,48,1,34,232,1,96,1,20,1,28,254,216,254,248,189,255,255,
+0,180,0,0,3,240,7,10,2,38,4,95,0,0,0,6,4,200,106,0,0,2,0,180,0,0,3,240,5,
+182,0,15,0,19,0,0,1,33,17,35,17,51,17,33,17,51,17,33,21,33,17,35,19,51,17,
+35,2,94,254,226,140,140,1,30,140,1,6,254,250,140,244,130,130,3,131,252,125,
+5,182,254,69,1,187,254,69,120,252,125,2,170,254,61,0,3,0,120,0,0,4,6,5,182,
+0,18,0,27,0,31,0,0,33,17,34,38,53,52,54,51,53,51,21,33,21,33,17,33,21,33,
+17,1,20,22,51,51,17,35,34,6,1,51,17,35,2,14,206,200,206,200,140,1,108,254,
+148,1,108,254,148,254,96,117,146,13,13,143,120,2,88,130,130,2,165,142,150,
+143,152,198,198,120,254,165,120,253,91,3,201,86,86,1,91,87,253,233,254,191,
+0,2,0,140,0,0,4,140,5,182,0,34,0,46,0,0,1,20,51,50,54,54,53,53,51,21,20,14,
+2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,53,51,3,1,51,19,19,
+51,1,1,35,3,3,35,2,210,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,
+67,35,140,26,63,62,151,140,146,254,235,156,199,199,156,254,235,1,21,156,199,
+199,156,4,191,241,61,144,172,111,131,164,165,96,52,122,122,52,96,165,164,
+131,111,174,142,61,241,247,251,191,1,118,254,243,1,13,254,138,254,139,1,12,
+254,244,255,255,0,80,0,0,4,73,7,10,2,38,4,99,0,0,0,7,4,200,0,169,0,0,0,2,
+0,80,0,0,4,73,5,182,0,11,0,19,0,0,1,1,51,19,19,51,1,1,35,3,3,35,1,5,17,51,
+17,39,19,35,1,102,254,234,131,212,213,131,254,234,1,22,131,213,212,131,2,
+90,1,29,130,228,168,130,2,219,2,219,253,209,2,47,253,37,253,37,2,47,253,209,
+3,150,144,2,176,252,133,126,253,71,0,5,0,120,255,226,3,160,5,202,0,11,0,23,
+0,35,0,47,0,53,0,0,19,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,
+52,38,35,34,6,3,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,
+35,34,6,1,37,55,5,17,51,136,145,111,113,144,144,113,110,146,120,78,58,59,
+78,76,61,58,78,120,145,111,113,144,144,113,110,146,120,78,58,59,78,76,61,
+58,78,2,160,252,216,41,2,115,140,4,201,110,147,149,108,108,148,145,111,63,
+83,83,63,62,85,84,253,105,110,147,149,108,108,148,145,111,63,83,83,63,62,
+85,84,253,50,246,123,196,5,39,0,0,2,0,140,255,240,4,140,5,182,0,53,0,73,0,
+0,1,20,51,50,54,54,53,53,51,21,20,6,6,7,22,21,20,6,7,21,20,6,35,34,38,39,
+55,22,22,51,50,54,53,53,38,38,53,52,55,46,2,53,53,51,21,20,22,22,51,50,53,
+53,51,17,17,54,54,53,52,39,35,34,39,6,35,35,39,6,21,20,22,23,17,2,210,151,
+61,64,26,140,27,59,50,17,169,154,128,140,93,150,35,119,21,93,53,67,53,162,
+167,17,49,56,25,140,26,63,62,151,140,93,100,10,22,151,80,82,149,14,13,11,
+101,98,4,251,241,61,144,172,51,71,151,151,110,30,68,71,172,205,18,121,168,
+142,119,101,53,70,83,102,98,110,18,204,174,78,64,32,112,150,145,71,51,174,
+142,61,241,187,253,152,254,204,17,139,116,54,50,122,122,1,46,59,116,141,16,
+1,53,0,255,255,0,135,255,231,4,140,7,10,2,38,4,103,0,0,0,7,4,200,0,206,0,
+0,0,1,0,135,255,231,4,140,5,182,0,62,0,0,1,20,51,50,54,54,53,53,51,21,20,
+6,6,7,17,20,6,35,34,38,39,51,22,22,51,50,54,53,17,38,39,6,7,17,20,6,35,34,
+38,39,51,22,22,51,50,54,53,17,46,2,53,53,51,21,20,22,22,51,50,53,17,51,2,
+210,151,61,64,26,140,34,75,64,96,102,101,105,2,135,5,23,35,40,28,125,74,49,
+62,96,102,101,105,2,135,5,23,35,40,28,89,118,54,140,26,63,62,151,140,4,151,
+241,61,144,172,151,171,163,163,110,24,253,232,167,153,134,125,71,68,77,138,
+1,249,11,110,70,29,253,226,167,153,134,125,71,68,77,138,1,248,4,93,186,194,
+171,151,174,142,61,241,1,31,0,0,2,0,80,0,0,4,234,5,182,0,11,0,35,0,0,1,1,
+51,19,19,51,1,1,35,3,3,35,1,51,17,5,17,51,17,37,21,51,21,35,21,51,21,35,17,
+35,17,35,53,51,53,35,1,102,254,234,131,212,213,131,254,234,1,22,131,213,212,
+131,2,131,120,1,29,130,254,227,120,120,120,120,130,120,120,120,2,219,2,219,
+253,209,2,47,253,37,253,37,2,47,253,209,3,27,1,187,144,1,112,253,197,149,
+245,110,180,110,254,117,1,139,110,180,255,255,0,100,255,229,4,23,7,10,2,38,
+4,106,0,0,0,7,4,200,0,129,0,0,0,4,0,100,255,229,4,23,5,191,0,24,0,31,0,38,
+0,42,0,0,19,22,22,51,50,54,55,23,2,7,22,22,21,16,2,35,34,2,17,52,54,55,38,
+38,39,1,50,54,55,33,22,22,19,34,6,7,33,38,38,3,21,35,53,224,36,184,128,128,
+186,38,123,65,187,102,116,234,203,205,232,116,100,94,129,32,1,218,143,154,
+2,253,174,3,153,139,124,152,15,2,73,16,150,63,130,5,191,183,216,207,192,38,
+254,214,120,61,245,184,254,250,254,222,1,38,1,5,181,245,60,60,215,143,250,
+197,213,205,201,217,3,91,174,157,159,172,1,253,216,216,0,4,0,140,255,230,
+4,140,5,182,0,34,0,48,0,60,0,72,0,0,1,20,51,50,54,54,53,53,51,21,20,14,2,
+35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,53,51,1,6,6,35,34,36,
+39,55,22,22,51,50,54,55,39,6,6,35,34,3,51,22,22,51,50,55,19,6,6,35,34,3,51,
+22,22,51,50,55,2,210,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,67,
+35,140,26,63,62,151,140,1,154,44,252,185,188,255,0,43,133,28,184,142,138,
+182,29,75,27,139,118,220,46,140,14,62,60,98,36,140,27,139,118,220,46,140,
+14,62,60,98,36,5,15,241,61,144,172,31,51,164,165,96,52,122,122,52,96,165,
+164,51,31,174,142,61,241,167,251,213,201,220,223,198,50,171,180,184,167,92,
+134,129,1,7,67,76,143,1,54,134,129,1,7,67,76,143,0,255,255,0,80,0,0,4,86,
+7,10,2,38,4,109,0,0,0,7,4,200,0,142,0,0,0,3,0,80,0,0,4,86,5,212,0,25,0,32,
+0,39,0,0,33,17,37,17,22,22,21,20,6,7,17,35,17,38,38,53,52,54,55,17,1,17,5,
+7,39,17,1,20,22,23,17,6,6,5,52,38,39,17,54,54,3,1,254,192,96,120,117,99,140,
+101,128,123,106,1,204,1,85,58,143,253,60,59,54,54,59,1,87,53,47,47,53,4,63,
+178,254,215,26,158,100,98,158,27,254,111,1,141,20,159,108,104,161,23,2,8,
+254,252,1,0,248,104,101,251,43,2,174,62,94,17,1,86,17,91,61,58,86,20,254,
+181,20,87,0,2,0,80,0,0,4,116,5,212,0,22,0,25,0,0,33,17,37,17,55,17,39,17,
+35,17,7,39,55,39,55,23,17,1,17,5,7,39,17,1,7,23,3,31,254,192,233,233,140,
+183,76,228,228,76,183,1,204,1,85,58,143,254,165,112,112,4,63,178,254,48,193,
+253,100,193,253,249,2,27,156,88,189,189,88,157,2,200,254,252,1,0,248,104,
+101,251,43,2,244,96,96,0,0,1,0,120,0,0,3,212,5,192,0,28,0,0,19,18,51,50,19,
+23,2,7,17,23,17,51,17,37,17,33,21,33,53,33,17,39,17,35,17,5,53,38,3,249,90,
+209,212,90,118,108,240,220,140,254,152,1,104,252,164,1,104,220,140,1,104,
+239,108,5,192,254,232,1,24,46,254,201,38,254,189,136,1,160,253,114,221,254,
+31,120,120,2,55,136,254,89,2,152,223,237,40,1,50,0,255,255,0,120,0,24,3,212,
+7,10,2,38,4,113,0,0,0,6,4,200,106,0,0,1,0,120,0,24,3,212,5,182,0,15,0,0,1,
+23,17,51,17,1,17,35,17,39,17,35,17,1,17,51,2,108,220,140,254,152,140,220,
+140,1,104,140,3,34,164,1,250,253,4,1,10,253,146,2,214,163,253,255,3,6,254,
+244,2,44,0,1,0,120,0,0,3,212,5,192,0,24,0,0,19,18,51,50,19,23,2,7,17,23,17,
+51,17,37,17,35,17,39,17,35,17,5,53,38,3,249,90,209,212,90,118,108,240,220,
+140,254,152,140,220,140,1,104,239,108,5,192,254,232,1,24,46,254,201,38,254,
+189,136,1,160,253,114,221,253,167,2,175,136,254,89,2,152,223,237,40,1,50,
+255,255,0,90,255,236,3,241,7,10,2,38,4,116,0,0,0,6,4,200,106,0,0,1,0,90,255,
+236,3,241,5,182,0,26,0,0,1,2,2,7,17,35,23,17,51,17,1,17,35,17,5,17,38,2,3,
+51,18,23,17,51,17,54,19,3,241,29,197,163,5,225,140,253,48,140,1,104,162,200,
+28,131,48,211,140,216,43,5,62,254,239,254,205,27,254,134,139,1,160,253,114,
+1,187,254,89,2,152,223,1,39,28,1,55,1,11,254,90,61,2,91,253,165,61,1,166,
+0,0,5,0,120,0,0,4,120,5,182,0,15,0,21,0,27,0,31,0,35,0,0,33,32,36,53,52,54,
+36,51,51,17,23,17,51,17,39,17,39,17,35,17,22,51,17,34,7,17,51,17,1,22,23,
+17,17,6,7,51,2,235,254,217,254,180,153,1,20,174,28,253,140,253,140,159,46,
+64,58,52,159,254,22,15,196,174,32,206,234,210,136,206,112,1,137,176,1,91,
+253,171,185,251,230,120,1,37,254,226,7,2,146,8,254,255,1,9,254,147,188,71,
+1,3,1,71,65,162,255,255,0,120,0,0,3,241,7,10,2,38,4,119,0,0,0,7,4,200,0,157,
+0,0,0,1,0,120,0,0,3,241,5,208,0,42,0,0,19,51,17,51,21,54,54,51,50,22,22,21,
+17,20,6,35,34,39,17,35,17,51,4,51,50,54,53,17,52,38,38,35,34,6,7,17,35,17,
+35,17,35,17,51,250,130,130,79,122,59,95,98,46,101,101,106,188,140,33,1,51,
+94,37,25,22,51,55,45,122,64,130,130,130,130,4,52,1,87,54,70,53,74,162,134,
+253,96,134,125,125,254,200,2,8,213,86,78,2,128,108,107,42,97,83,253,209,1,
+81,254,175,3,22,0,1,0,80,255,230,3,196,5,208,0,21,0,0,19,37,37,55,23,17,1,
+7,37,17,55,23,5,5,7,39,17,1,55,5,17,7,167,1,10,254,246,83,203,1,255,61,254,
+202,206,83,254,246,1,10,82,207,253,255,61,1,56,204,1,250,236,232,94,181,2,
+89,254,228,112,175,254,130,183,94,232,236,82,179,253,139,1,28,112,168,1,143,
+177,0,0,4,0,63,0,0,4,120,5,182,0,38,0,51,0,56,0,64,0,0,55,54,55,38,53,52,
+55,38,39,55,22,23,54,33,51,17,23,17,51,17,39,21,54,55,21,6,7,17,22,23,21,
+38,39,21,35,32,39,6,7,1,34,7,22,21,20,7,22,51,38,53,52,55,3,20,23,17,6,5,
+52,39,6,21,20,23,54,64,85,66,95,84,61,80,36,104,89,167,1,8,28,253,140,253,
+58,71,71,58,60,69,64,65,144,254,238,162,89,120,2,88,200,118,96,79,115,182,
+158,211,81,81,81,254,192,51,39,47,43,122,14,43,107,158,142,107,38,12,113,
+20,59,121,1,137,176,1,91,253,171,185,221,15,4,119,5,16,253,216,19,1,119,1,
+16,34,99,68,23,3,2,83,113,155,135,105,67,113,194,229,122,254,161,114,79,1,
+140,79,124,99,77,68,91,101,69,71,255,255,0,40,0,0,3,169,7,10,2,38,4,123,0,
+0,0,6,4,200,94,0,0,1,0,40,0,0,3,169,5,182,0,23,0,0,1,33,17,35,17,33,53,33,
+17,33,53,33,17,5,17,51,17,37,17,33,21,33,17,33,3,150,254,123,140,254,163,
+1,93,254,163,1,93,1,162,130,254,104,1,133,254,123,1,133,1,88,254,168,1,88,
+110,1,24,110,2,28,226,1,48,254,3,225,254,178,110,254,232,0,0,7,0,120,255,
+230,4,28,5,212,0,25,0,31,0,37,0,41,0,45,0,49,0,53,0,0,19,52,54,54,55,17,5,
+7,37,21,30,2,21,20,6,6,7,17,37,55,5,53,46,2,37,52,39,7,23,54,37,20,23,55,
+39,6,19,22,23,53,23,54,55,39,39,53,6,7,37,38,39,21,120,94,179,125,2,20,46,
+254,166,125,177,92,96,180,118,253,236,46,1,90,120,182,96,3,24,40,194,200,
+34,253,116,35,199,192,42,112,58,95,126,87,64,151,126,82,59,1,151,56,84,2,
+244,107,174,108,12,1,79,200,114,134,156,12,107,173,108,104,174,111,11,254,
+130,200,114,134,201,12,112,176,101,90,67,149,154,64,82,84,61,153,148,67,254,
+195,40,12,170,170,9,42,117,239,153,9,36,2,34,9,151,0,0,3,0,80,255,230,4,44,
+5,208,0,15,0,29,0,43,0,0,1,5,17,5,7,39,21,5,7,39,21,5,7,39,17,1,55,38,38,
+35,34,6,7,35,54,54,51,50,22,23,17,6,6,35,34,38,39,51,22,22,51,50,54,55,1,
+71,1,56,1,173,61,228,1,2,61,197,1,2,61,197,253,255,174,4,53,58,63,48,4,130,
+5,123,117,117,120,7,7,119,118,117,123,5,130,4,47,64,59,52,4,1,114,168,5,6,
+238,112,129,241,147,115,113,251,147,115,112,254,10,1,28,249,133,107,108,132,
+188,172,173,187,3,92,186,174,172,188,131,109,110,130,255,255,0,80,255,230,
+3,241,7,10,2,38,4,127,0,0,0,6,4,200,96,0,0,4,0,80,255,230,3,241,5,208,0,18,
+0,30,0,35,0,42,0,0,1,54,53,52,38,39,17,1,55,5,17,5,7,39,17,22,22,21,7,1,52,
+54,51,50,22,21,20,6,35,34,38,23,50,55,35,22,19,34,6,7,51,38,38,3,102,6,95,
+79,253,255,61,1,56,1,191,61,246,143,161,4,252,102,104,98,101,107,105,103,
+98,104,208,77,5,170,5,77,39,40,2,169,5,43,1,154,40,37,97,152,24,252,238,1,
+28,112,168,5,6,228,112,129,254,108,26,204,156,66,2,24,164,174,175,163,159,
+164,163,53,174,174,1,183,74,81,87,68,0,2,0,120,255,230,3,223,5,182,0,28,0,
+40,0,0,1,38,35,34,6,7,33,21,33,18,33,50,55,23,6,6,35,34,2,53,52,54,54,51,
+50,23,17,51,17,1,51,53,51,21,51,21,35,21,35,53,35,3,28,51,170,129,170,14,
+2,85,253,171,23,1,34,208,126,82,78,214,122,215,242,112,209,136,129,90,140,
+253,35,193,130,193,193,130,193,2,245,116,171,148,120,254,172,168,86,103,99,
+1,17,252,151,223,120,56,2,13,253,63,2,37,156,156,110,141,141,0,0,3,0,80,255,
+230,4,40,5,208,0,13,0,27,0,35,0,0,1,6,6,35,34,38,39,51,22,22,51,50,54,55,
+53,38,38,35,34,6,7,35,54,54,51,50,22,23,3,5,17,5,7,39,17,1,2,57,7,119,118,
+117,123,5,130,4,47,64,59,52,4,4,53,58,63,48,4,130,5,123,117,117,120,7,247,
+1,56,1,174,61,229,253,255,3,119,186,174,172,188,131,109,110,130,120,133,107,
+108,132,188,172,173,187,253,131,168,5,6,240,112,131,250,243,1,28,255,255,
+0,140,255,230,4,4,7,10,2,38,4,131,0,0,0,6,4,200,106,0,0,1,0,140,255,230,4,
+4,5,182,0,29,0,0,1,35,38,35,32,3,33,21,33,18,18,51,50,54,54,55,23,2,33,34,
+2,17,16,18,51,50,22,23,53,51,3,222,130,76,204,254,240,26,2,84,253,170,1,151,
+148,78,119,93,53,105,161,254,227,211,231,229,213,93,143,42,130,4,6,178,254,
+64,110,254,242,254,226,46,86,90,63,254,233,1,100,1,75,1,73,1,82,54,51,239,
+0,1,0,100,255,240,4,49,5,182,0,32,0,0,37,6,6,35,34,38,53,17,38,2,3,51,18,
+22,51,50,54,55,51,2,2,7,21,37,23,5,21,20,22,51,50,54,55,3,241,35,150,93,139,
+129,171,174,18,139,17,161,170,159,166,20,141,26,230,214,1,59,61,254,136,54,
+66,53,94,20,204,101,119,141,169,2,46,36,1,45,1,17,254,246,236,247,255,254,
+203,254,206,7,224,155,115,188,164,98,102,85,68,0,0,1,0,120,0,0,3,232,5,208,
+0,29,0,0,1,39,17,23,53,51,17,37,21,51,21,35,17,37,17,35,17,5,53,35,53,51,
+53,39,21,35,17,5,17,5,3,99,223,216,140,254,156,206,206,254,128,140,1,128,
+214,214,224,140,1,108,1,168,4,154,109,254,213,80,216,254,118,130,173,110,
+254,112,174,254,161,2,38,172,199,110,224,82,243,1,168,135,1,193,198,0,255,
+255,0,120,255,230,4,120,7,10,2,38,4,135,0,0,0,7,4,200,0,186,0,0,0,2,0,120,
+255,230,4,120,5,182,0,45,0,57,0,0,1,2,5,17,20,51,50,54,54,53,53,51,21,20,
+14,2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,17,38,2,3,51,22,
+22,51,32,19,5,51,53,51,21,51,21,35,21,35,53,35,4,67,57,254,180,151,61,64,
+26,140,35,66,104,76,151,80,82,149,74,105,67,35,140,26,63,62,151,165,197,28,
+131,25,166,136,1,24,51,253,210,163,130,163,163,130,163,4,218,253,234,53,254,
+192,241,61,144,172,21,41,164,165,96,52,122,122,52,96,165,164,41,21,174,142,
+61,241,1,64,27,1,42,1,6,233,239,1,216,6,226,226,110,231,231,0,0,1,0,100,255,
+226,3,140,5,182,0,21,0,0,19,51,17,51,17,51,17,51,17,37,55,5,17,35,17,35,17,
+35,17,35,17,51,250,193,130,195,140,252,216,41,2,115,195,130,193,130,130,3,
+228,1,87,254,169,1,210,250,44,246,123,196,2,231,254,175,1,81,254,175,3,22,
+255,255,0,120,255,230,3,221,7,10,2,38,4,138,0,0,0,6,4,200,94,0,0,1,0,120,
+255,230,3,221,5,208,0,27,0,0,1,33,17,1,55,5,17,33,53,33,17,39,21,35,17,5,
+17,5,7,39,17,23,53,51,17,37,17,33,3,151,254,226,253,255,61,1,56,254,218,1,
+38,224,140,1,108,1,168,61,223,216,140,254,156,1,30,1,232,253,254,1,28,112,
+168,1,30,110,1,57,82,243,1,168,135,1,193,198,112,109,254,213,80,216,254,118,
+130,254,250,0,0,3,0,80,0,0,4,3,5,182,0,15,0,31,0,35,0,0,1,54,19,23,6,6,35,
+34,2,39,55,22,22,23,17,51,1,54,18,51,50,22,23,7,2,39,17,35,17,6,6,7,1,33,
+53,33,2,107,226,59,123,44,246,183,181,247,46,124,30,147,108,130,253,229,46,
+246,182,184,245,44,123,60,225,130,104,149,32,2,243,252,214,3,42,3,248,46,
+1,101,38,238,253,1,0,234,39,179,204,20,1,190,250,156,234,1,0,254,237,38,1,
+102,44,254,67,1,190,21,195,187,2,122,110,0,255,255,0,140,0,0,3,144,7,10,2,
+38,4,141,0,0,0,6,4,200,97,0,0,2,0,140,0,0,3,143,5,182,0,13,0,24,0,0,1,17,
+35,53,35,32,36,53,52,54,36,51,51,17,3,34,6,6,21,20,22,22,51,51,17,3,143,140,
+4,254,211,254,186,149,1,20,178,28,49,126,204,112,111,202,129,49,5,182,250,
+74,230,246,228,148,218,118,1,18,254,118,89,166,109,108,160,86,2,206,0,2,0,
+100,0,0,4,0,5,182,0,27,0,38,0,0,1,6,6,21,20,22,51,21,38,36,39,38,38,53,52,
+54,55,54,36,55,21,34,6,21,20,22,22,23,5,38,38,39,6,6,21,20,22,23,54,4,0,181,
+211,201,189,201,254,244,42,197,214,201,195,23,1,21,226,188,202,101,177,112,
+254,234,104,127,16,125,132,129,123,3,2,168,4,155,134,131,137,119,2,140,126,
+35,223,171,176,223,38,152,174,2,119,137,131,92,130,69,2,51,37,143,97,34,161,
+116,118,153,31,239,255,255,0,120,0,0,3,250,7,10,2,38,4,144,0,0,0,6,4,200,
+121,0,0,5,0,120,0,0,3,250,5,182,0,11,0,25,0,39,0,53,0,67,0,0,19,33,17,51,
+17,33,21,33,17,35,17,33,37,38,38,53,52,54,55,21,6,6,21,20,22,23,17,6,6,21,
+20,22,23,21,38,38,53,52,54,55,1,54,54,53,52,38,39,53,22,22,21,20,6,7,17,22,
+22,21,20,6,7,53,54,54,53,52,38,39,120,1,123,140,1,123,254,133,140,254,133,
+3,130,150,149,162,137,96,78,78,96,97,77,78,96,137,162,149,150,252,126,97,
+77,78,96,137,162,149,150,150,149,162,137,96,78,78,96,3,28,2,154,253,102,120,
+253,92,2,164,215,23,144,104,110,147,19,116,21,77,62,59,75,23,253,230,23,75,
+59,62,77,21,116,19,146,111,104,144,23,1,168,23,75,59,62,77,21,116,19,146,
+111,104,144,23,254,202,23,144,104,110,147,19,116,21,77,62,59,75,23,0,0,1,
+0,200,0,0,1,84,5,182,0,3,0,0,33,35,17,51,1,84,140,140,5,182,0,1,0,80,255,
+226,2,143,5,182,0,5,0,0,19,5,17,51,17,37,121,1,138,140,253,193,1,25,125,5,
+26,250,44,188,0,1,0,180,255,226,2,243,5,182,0,5,0,0,37,5,17,51,17,37,2,243,
+253,193,140,1,138,158,188,5,212,250,230,125,0,1,0,180,0,0,2,177,5,202,0,5,
+0,0,1,37,17,35,17,5,2,136,254,184,140,1,253,4,151,121,250,240,5,202,184,0,
+0,1,0,80,255,230,3,196,5,208,0,7,0,0,19,5,17,1,7,37,17,1,136,1,60,2,0,56,
+254,196,254,0,1,115,169,5,6,254,228,113,169,250,250,1,28,0,0,1,0,180,0,0,
+3,189,5,202,0,7,0,0,1,1,17,35,17,1,17,51,3,189,253,131,140,2,125,140,3,126,
+1,105,251,25,5,202,254,146,1,90,0,1,0,140,0,0,3,149,5,182,0,7,0,0,19,1,17,
+51,17,1,17,35,140,2,125,140,253,131,140,2,116,254,151,4,171,250,114,1,110,
+254,106,0,0,1,0,120,0,0,3,133,5,208,0,9,0,0,1,39,17,37,17,35,17,5,17,5,3,
+72,196,254,128,140,1,128,1,141,4,128,116,251,239,174,254,111,2,88,172,4,36,
+224,0,1,0,80,255,230,3,137,5,182,0,9,0,0,1,17,51,17,37,17,37,55,5,17,2,253,
+140,254,164,254,35,56,1,25,4,71,1,111,253,181,217,251,162,247,113,132,4,87,
+0,1,0,142,3,120,3,234,5,212,0,7,0,0,1,1,17,35,17,1,17,51,3,234,253,48,140,
+2,208,140,3,120,1,137,254,139,2,72,254,116,1,110,0,1,0,130,255,231,3,220,
+5,208,0,42,0,0,1,38,38,35,34,6,21,20,22,22,23,22,22,21,20,6,6,35,34,38,39,
+55,22,22,51,50,54,53,52,46,6,53,52,54,54,51,32,23,3,101,46,159,100,133,159,
+65,133,160,201,157,110,204,138,136,211,59,121,32,155,98,140,172,62,100,129,
+134,129,100,62,103,194,135,1,13,144,4,141,98,105,140,123,68,109,91,69,88,
+181,125,116,183,100,153,140,57,107,123,147,116,70,101,77,62,61,71,96,129,
+89,106,171,97,252,0,0,1,0,140,0,0,2,43,5,182,0,7,0,0,19,5,17,51,17,37,17,
+35,140,1,29,130,254,227,130,3,190,144,2,136,252,173,149,253,8,0,0,1,0,100,
+0,0,3,245,5,208,0,32,0,0,19,54,36,51,50,22,21,17,20,6,6,35,34,38,39,39,17,
+35,17,51,4,51,50,54,54,53,17,52,38,35,34,6,7,100,123,1,25,134,190,185,48,
+112,112,51,130,125,138,140,33,1,181,114,70,46,16,107,128,118,244,106,4,235,
+109,120,207,209,253,237,144,146,64,37,51,52,254,185,2,8,213,31,93,173,1,198,
+157,153,107,93,0,1,0,140,255,230,4,4,5,182,0,26,0,0,1,35,38,35,32,17,16,18,
+51,50,54,54,55,23,2,33,34,2,17,16,18,51,50,22,23,53,51,3,222,130,76,204,254,
+212,151,149,78,119,93,53,105,161,254,227,211,231,229,213,93,143,42,130,4,
+6,178,253,221,254,237,254,220,46,86,90,63,254,233,1,100,1,75,1,73,1,82,54,
+51,239,0,1,0,180,0,0,3,80,5,182,0,11,0,0,1,17,51,17,37,17,37,17,35,17,5,17,
+2,196,140,253,240,2,16,140,253,240,4,71,1,111,253,221,197,253,6,197,253,221,
+1,111,198,4,100,0,0,1,0,120,255,240,3,36,5,202,0,15,0,0,5,36,0,17,16,0,37,
+23,14,3,21,20,0,5,3,18,254,182,254,176,1,58,1,96,18,173,192,118,61,1,10,1,
+22,16,97,1,120,1,20,1,11,1,112,114,121,63,121,146,183,115,233,254,203,86,
+0,1,0,100,0,0,3,72,5,182,0,19,0,0,19,33,50,22,21,17,20,6,35,33,53,33,50,54,
+53,17,52,38,35,33,100,1,242,136,106,105,137,254,14,1,231,71,42,45,68,254,
+25,5,182,106,144,252,60,143,105,120,44,76,3,215,78,41,0,1,0,120,2,250,4,164,
+5,182,0,13,0,0,1,2,0,35,34,0,3,51,18,18,51,50,18,19,4,164,18,254,229,233,
+241,254,235,16,140,14,205,175,173,203,17,5,182,254,182,254,142,1,105,1,83,
+254,229,254,215,1,46,1,22,0,0,1,0,120,0,0,4,164,2,188,0,13,0,0,33,2,2,35,
+34,2,3,35,18,0,51,50,0,19,4,23,17,203,173,176,204,14,140,16,1,21,241,233,
+1,27,18,1,22,1,46,254,215,254,229,1,82,1,106,254,142,254,182,0,0,1,0,80,2,
+98,3,94,5,182,0,5,0,0,19,1,17,51,17,1,168,2,42,140,252,242,5,91,254,38,2,
+53,252,172,2,141,0,1,0,180,255,230,4,52,5,182,0,24,0,0,1,20,6,6,35,34,46,
+2,53,17,51,17,20,30,2,51,50,62,2,53,17,51,4,52,90,200,161,123,171,103,48,
+140,11,59,125,115,86,117,70,33,140,2,47,243,232,110,63,124,204,194,3,135,
+252,101,96,163,119,67,42,81,144,178,3,155,0,1,0,180,255,230,3,235,5,208,0,
+29,0,0,1,38,38,35,34,6,6,21,17,20,6,35,34,38,53,17,51,17,20,22,51,50,54,53,
+17,52,54,51,50,23,3,169,32,42,21,32,33,13,154,139,139,152,140,73,80,80,71,
+99,104,94,82,5,56,22,10,43,99,155,253,39,174,194,194,174,4,106,251,149,122,
+125,128,119,3,50,172,157,47,0,0,1,0,100,255,230,4,38,5,208,0,41,0,0,19,54,
+51,50,22,21,17,20,22,51,50,54,53,17,52,54,51,50,23,7,38,38,35,34,6,6,21,17,
+20,6,35,34,38,53,17,52,38,38,35,34,6,7,100,82,94,104,99,47,56,56,45,99,104,
+94,82,66,32,42,21,32,33,13,116,127,127,114,14,33,31,21,42,32,5,161,47,157,
+172,252,236,153,124,127,150,3,20,172,157,47,105,22,10,43,99,155,253,29,194,
+164,165,193,2,227,159,96,42,10,22,0,0,2,0,130,255,230,4,10,5,208,0,19,0,40,
+0,0,1,50,22,18,18,21,20,6,35,34,38,39,6,6,35,32,17,16,18,18,19,20,51,50,54,
+53,52,2,2,35,34,2,2,21,20,22,51,50,53,53,51,2,70,100,165,119,68,141,130,59,
+99,23,32,97,52,254,241,116,201,200,116,73,63,92,141,84,82,141,94,63,73,116,
+130,5,208,176,254,167,254,43,158,174,192,54,58,58,54,1,110,1,34,2,48,1,42,
+251,127,241,117,129,252,1,249,1,15,254,242,253,249,239,131,115,241,85,0,2,
+0,140,255,230,4,49,5,208,0,11,0,23,0,0,1,16,2,35,34,2,17,16,18,51,50,18,3,
+16,2,35,34,2,17,16,18,51,50,18,4,49,243,223,223,244,245,222,224,242,140,169,
+159,154,171,166,159,158,170,2,221,254,152,254,113,1,148,1,107,1,94,1,141,
+254,115,254,154,1,53,1,70,254,184,254,213,254,192,254,185,1,73,0,0,2,0,140,
+255,230,3,116,5,208,0,13,0,27,0,0,19,16,18,51,50,18,17,17,16,2,35,34,2,17,
+23,20,22,51,50,54,53,17,52,38,35,34,6,21,140,177,195,195,177,179,193,193,
+179,140,105,127,127,105,105,127,127,105,3,169,1,32,1,7,254,250,254,223,254,
+110,254,221,254,242,1,13,1,36,20,234,187,189,232,1,176,234,187,189,232,0,
+0,2,0,130,3,8,4,18,5,208,0,15,0,27,0,0,19,52,54,54,51,50,22,22,21,20,6,6,
+35,34,38,38,55,20,22,51,50,54,53,52,38,35,34,6,130,113,204,140,140,203,112,
+112,204,139,142,205,110,140,160,157,154,161,162,153,156,161,4,108,98,165,
+93,93,164,99,99,164,93,90,165,101,114,121,120,115,117,119,121,0,0,2,0,120,
+3,3,3,215,5,207,0,2,0,5,0,0,1,1,33,1,3,33,2,40,1,175,252,161,1,175,221,1,
+187,5,207,253,52,1,214,254,162,0,0,2,0,120,0,0,4,139,5,212,0,13,0,22,0,0,
+1,39,17,35,32,36,53,52,54,36,51,51,17,5,1,34,6,21,20,22,51,51,17,4,98,231,
+144,254,217,254,180,153,1,20,174,28,1,156,254,51,209,233,229,213,49,4,122,
+122,251,12,234,210,136,206,112,2,82,225,254,23,176,158,156,168,2,146,0,2,
+0,120,0,0,4,92,5,212,0,20,0,30,0,0,1,38,39,17,35,32,36,53,52,54,54,51,50,
+23,17,5,7,39,17,22,23,37,38,35,34,6,21,20,22,51,51,4,2,100,115,144,254,231,
+254,246,99,166,90,101,95,1,156,41,231,153,152,254,67,97,92,101,121,187,205,
+19,1,115,148,92,253,157,213,221,124,194,108,33,2,153,225,121,122,254,4,96,
+196,230,42,164,142,158,156,0,0,2,0,120,0,0,4,120,5,182,0,15,0,24,0,0,33,32,
+36,53,52,54,36,51,51,17,23,17,51,17,39,17,3,34,6,21,20,22,51,51,17,2,235,
+254,217,254,180,153,1,20,174,28,253,140,253,189,209,233,229,213,49,234,210,
+136,206,112,1,137,176,1,91,253,171,185,251,230,3,10,176,158,156,168,2,146,
+0,2,0,120,0,0,3,83,5,183,0,11,0,21,0,0,1,17,35,32,0,53,52,54,36,51,51,17,
+3,34,6,6,21,20,22,51,51,17,3,83,144,254,244,254,193,152,1,14,161,8,29,120,
+194,108,237,185,29,5,183,250,73,1,16,232,143,236,135,1,189,253,203,100,181,
+113,172,212,3,10,0,1,0,140,0,0,2,160,5,182,0,26,0,0,1,6,6,21,20,22,51,21,
+38,36,53,52,55,38,38,53,52,36,55,21,34,6,21,20,22,22,23,2,160,181,211,201,
+189,246,254,228,252,125,127,1,26,248,188,202,101,177,112,2,168,4,155,134,
+131,137,119,2,207,178,245,99,47,175,122,178,206,3,119,137,131,92,130,69,2,
+0,0,1,0,120,0,0,2,140,5,182,0,26,0,0,1,52,38,35,53,22,4,21,20,6,7,22,21,20,
+4,7,53,50,54,53,52,38,39,55,62,2,2,0,201,189,246,1,28,127,125,252,254,230,
+248,188,202,211,181,2,114,175,101,4,51,131,137,119,2,207,178,122,175,47,99,
+245,178,206,3,119,137,131,134,155,4,102,2,69,130,0,0,1,0,140,0,0,2,69,5,182,
+0,49,0,0,33,35,34,38,38,53,52,54,55,38,38,53,52,54,55,38,38,53,52,54,54,51,
+51,21,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,
+51,51,2,69,125,96,141,79,54,56,52,58,54,57,51,60,75,140,101,125,145,76,95,
+97,74,145,145,73,98,96,75,145,145,76,95,97,74,145,67,136,85,57,116,42,37,
+120,74,57,119,43,37,126,73,79,125,69,120,79,74,76,96,120,86,77,75,94,120,
+83,74,76,92,0,0,1,0,140,3,106,4,140,5,182,0,34,0,0,1,20,51,50,54,54,53,53,
+51,21,20,14,2,35,34,39,6,35,34,46,2,53,53,51,21,20,22,22,51,50,53,53,51,2,
+210,151,61,64,26,140,35,66,104,76,151,80,82,149,74,105,67,35,140,26,63,62,
+151,140,4,211,241,61,144,172,91,111,164,165,96,52,122,122,52,96,165,164,111,
+91,174,142,61,241,227,0,0,1,0,140,2,82,5,248,5,182,0,54,0,0,1,20,22,22,51,
+50,54,54,53,53,51,21,20,14,2,35,34,39,6,6,35,34,38,39,6,35,34,46,2,53,53,
+51,21,20,22,22,51,50,54,54,53,53,51,17,20,22,22,51,50,54,53,17,51,4,88,29,
+59,61,50,52,25,140,31,64,101,75,91,61,18,137,123,127,131,10,59,89,74,103,
+64,30,140,24,52,51,61,59,29,140,24,52,51,77,72,140,5,10,109,128,59,70,152,
+140,106,126,172,152,91,47,41,168,153,146,173,39,47,93,154,168,126,106,137,
+154,71,59,129,108,172,254,126,137,154,71,165,171,1,156,0,1,0,100,2,250,4,
+144,5,182,0,22,0,0,1,35,30,2,51,50,54,55,35,53,33,21,35,2,2,35,34,2,3,35,
+53,33,1,215,154,16,73,129,99,138,150,26,151,1,115,80,33,224,197,205,222,29,
+78,1,115,5,62,177,189,94,207,253,120,120,254,214,254,230,1,16,1,52,120,0,
+0,1,0,140,3,106,5,86,5,182,0,48,0,0,1,20,6,6,35,34,39,6,35,34,39,6,35,34,
+46,2,53,53,51,21,20,22,22,51,50,54,53,53,51,21,20,22,22,51,50,54,53,53,51,
+21,20,22,51,50,54,53,53,51,5,86,48,107,96,120,60,57,125,120,60,57,125,69,
+95,58,29,130,21,49,51,67,49,130,20,47,49,66,50,130,48,68,66,55,130,5,27,193,
+162,78,69,69,69,69,44,82,145,168,149,116,140,147,65,130,170,168,116,150,140,
+62,120,147,201,157,183,128,128,172,168,0,0,1,0,80,2,212,4,51,5,208,0,42,0,
+0,1,50,54,53,53,52,54,51,50,22,23,35,38,38,35,34,6,21,21,20,6,35,34,38,53,
+53,52,38,35,34,6,7,35,54,54,51,50,22,21,21,20,22,22,2,66,45,32,96,112,91,
+107,14,135,6,37,34,46,32,99,111,109,96,33,45,34,37,6,135,14,106,92,112,96,
+14,31,3,76,97,129,89,177,152,100,119,52,47,104,138,44,200,158,156,202,44,
+142,100,47,52,119,100,151,178,89,87,96,43,0,2,0,100,255,240,3,117,5,208,0,
+33,0,43,0,0,1,22,22,51,50,54,53,17,39,6,35,34,38,53,52,54,54,51,50,23,54,
+55,23,6,7,22,21,17,20,6,35,34,38,39,19,50,55,38,35,34,6,21,20,22,1,16,21,
+93,53,67,53,2,91,106,118,142,66,116,68,218,88,56,49,124,79,116,9,128,140,
+93,150,35,218,99,74,40,152,51,71,77,1,1,70,83,102,98,2,151,74,41,139,113,
+61,110,65,220,78,142,26,212,116,59,66,253,53,168,142,119,101,3,148,42,206,
+64,52,64,68,0,0,2,0,100,255,230,3,193,5,208,0,31,0,41,0,0,1,20,22,22,51,50,
+54,55,23,6,6,35,34,38,38,53,17,6,35,34,38,53,52,54,51,50,19,54,55,23,2,7,
+39,50,55,38,38,35,34,21,20,22,2,87,11,27,32,43,101,39,109,50,160,94,74,86,
+38,60,59,107,133,122,98,223,47,88,63,124,103,163,248,58,49,3,70,63,92,64,
+1,48,98,80,32,65,68,59,88,106,63,125,132,2,190,16,148,124,103,133,254,227,
+93,192,26,254,236,121,35,17,134,117,116,72,80,0,0,3,0,130,255,238,3,212,5,
+194,0,43,0,54,0,65,0,0,1,6,7,22,21,21,20,7,22,23,7,38,39,6,6,35,34,38,38,
+53,52,54,51,50,23,54,53,53,52,39,6,35,34,38,53,52,54,54,51,50,22,23,54,55,
+1,50,55,38,38,35,34,6,21,20,22,19,50,54,55,38,35,34,6,21,20,22,3,212,51,102,
+70,70,103,50,124,43,62,67,171,92,86,132,73,160,120,170,150,27,27,150,170,
+119,161,73,132,86,92,171,67,62,43,254,77,137,118,47,133,77,71,88,95,64,77,
+133,47,119,136,67,94,88,5,168,211,151,142,171,90,172,142,152,209,26,152,117,
+79,87,70,124,72,122,160,146,89,104,96,102,91,146,158,124,72,124,70,87,79,
+117,152,253,237,147,76,85,83,63,73,89,253,30,84,76,148,90,72,63,83,0,0,2,
+0,80,255,220,3,51,5,182,0,27,0,38,0,0,1,17,20,6,35,34,39,6,7,39,54,55,38,
+38,53,52,54,51,50,22,21,20,7,22,51,50,53,17,1,52,38,35,34,6,21,20,22,23,54,
+3,51,142,137,72,110,96,127,55,102,83,70,81,113,88,99,126,95,69,46,119,254,
+253,53,51,35,47,70,48,68,5,182,251,190,181,170,67,74,50,108,29,57,59,140,
+60,85,114,123,96,115,112,39,243,4,64,251,215,48,61,45,48,36,99,40,82,0,1,
+0,80,0,0,3,199,5,182,0,11,0,0,1,1,51,1,1,35,1,1,35,1,1,51,2,11,1,47,141,254,
+140,1,116,145,254,213,254,214,145,1,116,254,140,141,3,101,2,81,253,35,253,
+39,2,76,253,180,2,217,2,221,0,1,0,120,0,0,4,22,5,201,0,27,0,0,1,7,6,7,22,
+18,21,17,35,17,16,1,0,17,17,35,17,52,18,55,38,39,39,55,22,23,54,55,4,22,75,
+177,113,162,153,140,254,239,254,239,140,156,159,113,176,76,53,251,159,163,
+247,5,93,45,100,86,153,254,168,220,254,87,1,169,1,114,1,7,254,253,254,138,
+254,87,1,169,223,1,90,148,86,100,45,108,130,126,129,127,0,3,0,80,0,0,3,168,
+5,182,0,9,0,12,0,15,0,0,9,2,21,33,53,1,1,53,33,1,33,3,3,19,33,3,168,254,157,
+1,99,252,168,1,100,254,156,3,88,253,98,1,232,245,1,243,254,26,5,151,253,67,
+253,69,31,31,2,189,2,187,31,250,184,1,223,1,29,1,222,0,0,3,0,160,255,241,
+4,22,5,186,0,5,0,8,0,11,0,0,1,1,17,1,1,17,19,9,2,19,17,2,95,1,183,254,73,
+254,65,122,1,1,254,255,1,138,248,3,56,2,130,250,55,2,129,253,127,5,201,251,
+164,1,119,1,120,254,136,254,157,2,199,0,0,2,0,80,255,240,3,140,5,193,0,10,
+0,13,0,0,5,1,1,39,1,1,55,1,1,51,17,1,19,17,3,95,254,173,254,181,113,1,117,
+254,139,113,1,75,1,83,45,254,198,174,16,2,103,253,153,66,2,166,2,167,66,253,
+152,2,104,250,47,2,232,254,190,2,133,0,0,2,0,120,255,240,3,180,5,193,0,13,
+0,16,0,0,19,1,1,51,17,35,1,1,39,1,3,17,35,17,1,19,17,238,1,70,1,83,45,45,
+254,173,254,181,113,1,117,243,130,2,2,174,5,182,253,163,2,104,250,47,2,103,
+253,153,66,2,166,1,187,254,217,2,74,253,34,254,190,2,133,0,0,4,0,130,0,24,
+4,86,5,152,0,42,0,47,0,57,0,67,0,0,37,38,3,7,22,23,7,38,39,6,6,35,34,38,53,
+52,54,51,50,23,54,55,38,39,6,35,34,38,53,52,54,51,50,22,23,54,55,23,6,7,23,
+18,55,1,22,23,17,6,37,50,55,38,38,35,34,21,20,22,19,50,54,55,38,35,34,6,21,
+20,4,86,226,143,53,125,82,124,57,69,56,138,101,97,123,133,107,113,99,42,43,
+43,42,99,113,107,133,122,98,97,141,57,69,57,124,83,123,52,141,228,254,207,
+75,100,98,254,11,90,73,43,91,58,92,64,28,57,92,43,75,88,57,64,131,127,1,39,
+157,125,221,26,165,90,135,120,132,104,124,148,55,137,114,114,137,55,148,124,
+103,133,117,138,89,166,26,223,123,157,1,34,132,253,171,180,112,2,72,110,134,
+42,118,108,116,72,80,252,124,106,119,43,80,72,116,0,0,2,0,80,255,230,3,170,
+5,182,0,10,0,13,0,0,55,1,1,53,33,21,1,1,7,9,2,19,33,80,1,100,254,156,3,88,
+254,157,1,101,114,254,197,254,201,1,54,243,254,26,29,2,191,2,187,31,31,253,
+67,253,67,55,2,103,253,153,3,132,1,222,0,1,0,80,0,0,3,152,5,182,0,7,0,0,1,
+33,17,35,17,33,53,33,3,152,254,162,140,254,162,3,72,5,62,250,194,5,62,120,
+0,1,0,80,0,0,4,29,5,182,0,9,0,0,1,19,35,3,35,17,35,17,33,53,3,121,164,132,
+125,226,140,254,162,5,182,254,97,1,39,250,194,5,62,120,0,2,0,150,3,232,2,
+198,5,182,0,3,0,7,0,0,1,35,17,51,1,35,17,51,1,24,130,130,1,174,130,130,3,
+232,1,206,254,50,1,206,0,1,0,78,6,49,3,47,7,10,0,10,0,0,1,38,35,34,7,39,54,
+54,51,50,23,2,225,126,165,165,126,77,91,180,97,210,159,6,49,102,102,80,75,
+62,137,0,0,1,0,100,255,176,2,42,1,162,0,7,0,0,5,38,38,39,55,22,0,23,1,154,
+50,175,85,52,107,1,4,35,80,122,252,59,65,43,254,239,81,0,0,2,0,100,255,236,
+2,155,2,35,0,11,0,23,0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,
+35,34,6,21,20,22,51,1,245,166,167,117,118,165,164,119,71,103,102,72,72,101,
+101,72,2,35,166,118,119,164,165,118,117,167,254,55,101,72,72,102,102,72,72,
+101,0,0,1,2,18,254,247,4,46,5,182,0,5,0,0,1,1,35,1,1,51,2,180,1,122,165,254,
+137,1,88,165,2,117,252,130,3,126,3,65,0,1,0,130,254,247,2,158,5,182,0,5,0,
+0,19,51,1,1,35,1,161,165,1,88,254,137,165,1,122,5,182,252,191,252,130,3,126,
+0,0,2,1,174,254,247,5,10,5,182,0,5,0,11,0,0,1,1,35,1,1,51,1,1,35,1,1,51,3,
+144,1,122,165,254,137,1,88,165,253,101,1,122,165,254,137,1,88,165,2,117,252,
+130,3,126,3,65,252,191,252,130,3,126,3,65,0,2,0,100,254,247,3,192,5,182,0,
+5,0,11,0,0,19,51,1,1,35,1,3,51,1,1,35,1,131,165,1,88,254,137,165,1,122,27,
+165,1,88,254,137,165,1,122,5,182,252,191,252,130,3,126,3,65,252,191,252,130,
+3,126,0,1,2,88,255,56,4,66,5,182,0,5,0,0,1,21,33,17,35,17,4,66,254,174,152,
+5,182,144,250,18,6,126,0,1,0,110,255,56,2,88,5,182,0,5,0,0,23,53,33,17,51,
+17,110,1,82,152,200,144,5,238,249,130,0,2,1,244,255,56,4,126,5,182,0,5,0,
+11,0,0,1,17,33,17,33,17,23,17,51,17,33,53,4,126,254,227,254,147,125,115,1,
+29,5,182,254,172,250,214,6,126,115,250,104,5,42,110,0,2,0,100,255,56,2,238,
+5,182,0,5,0,11,0,0,23,17,33,17,33,17,39,17,35,17,33,21,100,1,29,1,109,125,
+115,254,227,200,1,84,5,42,249,130,115,5,152,250,214,110,0,1,1,244,255,56,
+4,76,5,182,0,8,0,0,1,6,2,21,20,18,23,33,17,4,76,189,209,191,192,253,183,5,
+182,145,254,88,238,241,254,85,187,6,126,0,0,1,0,100,255,56,2,188,5,182,0,
+8,0,0,1,17,33,54,18,53,52,2,39,2,188,253,183,191,192,209,189,5,182,249,130,
+187,1,171,241,238,1,168,145,0,0,1,2,88,255,56,4,46,5,182,0,7,0,0,5,37,17,
+37,23,5,17,5,3,245,254,99,1,157,57,254,194,1,62,200,205,4,228,205,135,154,
+251,196,154,0,0,1,0,130,255,56,2,88,5,182,0,7,0,0,23,37,17,37,55,5,17,5,130,
+1,62,254,194,57,1,157,254,99,65,154,4,60,154,135,205,251,28,205,0,2,1,244,
+255,56,4,126,5,182,0,8,0,17,0,0,1,6,2,21,20,18,23,33,17,23,17,33,38,2,53,
+52,18,55,4,126,127,162,144,122,253,141,120,1,28,76,92,102,86,5,182,135,254,
+34,242,237,254,74,132,6,126,115,250,104,115,1,127,191,200,1,155,132,0,2,0,
+100,255,56,2,238,5,182,0,8,0,17,0,0,1,17,33,54,18,53,52,2,39,23,22,18,21,
+20,2,7,33,17,2,238,253,141,122,144,162,127,226,86,102,92,76,1,28,5,182,249,
+130,132,1,182,237,242,1,222,135,115,132,254,101,200,191,254,129,115,5,152,
+0,2,2,38,255,56,4,26,5,182,0,7,0,11,0,0,5,7,37,17,37,23,7,17,39,23,17,7,4,
+26,64,254,76,1,180,64,138,242,122,122,100,100,245,4,148,245,100,79,250,232,
+132,63,4,142,63,0,0,2,0,150,255,56,2,138,5,182,0,7,0,11,0,0,5,17,39,55,5,
+17,5,39,1,39,17,55,1,32,138,64,1,180,254,76,64,1,124,122,122,21,5,24,79,100,
+245,251,108,245,100,4,227,63,251,114,63,0,0,2,1,244,255,56,4,36,5,182,0,7,
+0,11,0,0,1,21,35,17,51,21,33,17,19,51,17,35,4,36,195,195,253,208,125,115,
+115,5,182,130,250,134,130,6,126,250,4,5,122,0,0,2,0,140,255,56,2,188,5,182,
+0,7,0,11,0,0,1,17,33,53,51,17,35,53,5,35,17,51,2,188,253,208,195,195,1,179,
+115,115,5,182,249,130,130,5,122,130,130,250,134,0,0,1,3,29,1,248,4,227,3,
+190,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,4,94,133,134,94,94,132,131,
+95,3,190,133,95,95,131,132,94,94,134,0,0,2,0,100,255,236,2,155,2,35,0,11,
+0,23,0,0,0,22,21,20,6,35,34,38,53,52,54,51,18,54,53,52,38,35,34,6,21,20,22,
+51,1,245,166,167,117,118,165,164,119,71,103,102,72,72,101,101,72,2,35,166,
+118,119,164,165,118,117,167,254,55,101,72,72,102,102,72,72,101,0,0,1,0,0,
+255,56,1,234,5,182,0,5,0,0,1,21,33,17,35,17,1,234,254,174,152,5,182,144,250,
+18,6,126,0,1,0,110,255,56,2,88,5,182,0,5,0,0,23,53,33,17,51,17,110,1,82,152,
+200,144,5,238,249,130,0,1,0,100,255,176,2,42,1,162,0,7,0,0,5,38,38,39,55,
+22,0,23,1,154,50,175,85,52,107,1,4,35,80,122,252,59,65,43,254,239,81,0,0,
+1,1,29,1,248,2,227,3,190,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,2,94,
+133,134,94,94,132,131,95,3,190,133,95,95,131,132,94,94,134,0,0,0,0,0,0,15,
+0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,24,0,94,0,3,0,1,4,9,0,2,
+0,14,0,118,0,3,0,1,4,9,0,3,0,62,0,132,0,3,0,1,4,9,0,4,0,24,0,94,0,3,0,1,4,
+9,0,5,0,30,0,194,0,3,0,1,4,9,0,6,0,20,0,224,0,3,0,1,4,9,0,7,0,68,0,244,0,
+3,0,1,4,9,0,8,0,42,1,56,0,3,0,1,4,9,0,9,0,40,1,98,0,3,0,1,4,9,0,10,0,96,1,
+138,0,3,0,1,4,9,0,11,0,62,1,234,0,3,0,1,4,9,0,12,0,60,2,40,0,3,0,1,4,9,0,
+13,2,150,2,100,0,3,0,1,4,9,0,14,0,52,4,250,0,67,0,111,0,112,0,121,0,114,0,
+105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,51,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,
+0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,
+0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,89,0,105,0,
+82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,
+78,0,111,0,116,0,111,0,32,0,83,0,97,0,110,0,115,0,32,0,89,0,105,0,86,0,101,
+0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,
+78,0,111,0,116,0,111,0,83,0,97,0,110,0,115,0,89,0,105,0,78,0,111,0,116,0,
+111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,
+97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,
+0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,
+104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,
+0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,
+0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,
+0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,
+0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,39,0,
+150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,227,0,0,1,2,0,2,0,3,1,3,1,4,
+1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,
+1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,
+1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,
+1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,
+1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,
+1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,
+1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,
+1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,
+121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,
+1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,
+146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,
+1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,
+171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,
+1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,
+196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,
+1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,
+221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,
+1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,
+246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,
+2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,
+2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,
+2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,
+2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,
+2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,
+2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,
+2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,
+2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,
+120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,
+2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,
+145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,
+2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,
+170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,
+2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,
+195,2,196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,
+2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,
+220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,
+2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,
+245,2,246,2,247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,
+2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,
+3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,
+3,34,3,35,3,36,3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,
+3,49,3,50,3,51,3,52,3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,
+3,64,3,65,3,66,3,67,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,
+3,79,3,80,3,81,3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,
+3,94,3,95,3,96,3,97,3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,3,106,3,
+107,3,108,3,109,3,110,3,111,3,112,3,113,3,114,3,115,3,116,3,117,3,118,3,119,
+3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,127,3,128,3,129,3,130,3,131,3,
+132,3,133,3,134,3,135,3,136,3,137,3,138,3,139,3,140,3,141,3,142,3,143,3,144,
+3,145,3,146,3,147,3,148,3,149,3,150,3,151,3,152,3,153,3,154,3,155,3,156,3,
+157,3,158,3,159,3,160,3,161,3,162,3,163,3,164,3,165,3,166,3,167,3,168,3,169,
+3,170,3,171,3,172,3,173,3,174,3,175,3,176,3,177,3,178,3,179,3,180,3,181,3,
+182,3,183,3,184,3,185,3,186,3,187,3,188,3,189,3,190,3,191,3,192,3,193,3,194,
+3,195,3,196,3,197,3,198,3,199,3,200,3,201,3,202,3,203,3,204,3,205,3,206,3,
+207,3,208,3,209,3,210,3,211,3,212,3,213,3,214,3,215,3,216,3,217,3,218,3,219,
+3,220,3,221,3,222,3,223,3,224,3,225,3,226,3,227,3,228,3,229,3,230,3,231,3,
+232,3,233,3,234,3,235,3,236,3,237,3,238,3,239,3,240,3,241,3,242,3,243,3,244,
+3,245,3,246,3,247,3,248,3,249,3,250,3,251,3,252,3,253,3,254,3,255,4,0,4,1,
+4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,
+18,4,19,4,20,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,30,4,31,4,32,
+4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,
+4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,58,4,59,4,60,4,61,4,62,
+4,63,4,64,4,65,4,66,4,67,4,68,4,69,4,70,4,71,4,72,4,73,4,74,4,75,4,76,4,77,
+4,78,4,79,4,80,4,81,4,82,4,83,4,84,4,85,4,86,4,87,4,88,4,89,4,90,4,91,4,92,
+4,93,4,94,4,95,4,96,4,97,4,98,4,99,4,100,4,101,4,102,4,103,4,104,4,105,4,
+106,4,107,4,108,4,109,4,110,4,111,4,112,4,113,4,114,4,115,4,116,4,117,4,118,
+4,119,4,120,4,121,4,122,4,123,4,124,4,125,4,126,4,127,4,128,4,129,4,130,4,
+131,4,132,4,133,4,134,4,135,4,136,4,137,4,138,4,139,4,140,4,141,4,142,4,143,
+4,144,4,145,4,146,4,147,4,148,4,149,4,150,4,151,4,152,4,153,4,154,4,155,4,
+156,4,157,4,158,4,159,4,160,4,161,4,162,4,163,4,164,4,165,4,166,4,167,4,168,
+4,169,4,170,4,171,4,172,4,173,4,174,4,175,4,176,4,177,4,178,4,179,4,180,4,
+181,4,182,4,183,4,184,4,185,4,186,4,187,4,188,4,189,4,190,4,191,4,192,4,193,
+4,194,4,195,4,196,4,197,4,198,4,199,4,200,4,201,4,202,4,203,4,204,4,205,4,
+206,4,207,4,208,4,209,4,210,4,211,4,212,4,213,4,214,4,215,4,216,4,217,4,218,
+4,219,4,220,4,221,4,222,4,223,4,224,4,225,4,226,4,227,4,228,4,229,4,230,4,
+231,4,232,4,233,4,234,4,235,4,236,4,237,4,238,4,239,4,240,4,241,4,242,4,243,
+4,244,4,245,4,246,4,247,4,248,4,249,4,250,4,251,4,252,4,253,4,254,4,255,5,
+0,5,1,5,2,5,3,5,4,5,5,5,6,5,7,5,8,5,9,5,10,5,11,5,12,5,13,5,14,5,15,5,16,
+5,17,5,18,5,19,5,20,5,21,5,22,5,23,5,24,5,25,5,26,5,27,5,28,5,29,5,30,5,31,
+5,32,5,33,5,34,5,35,5,36,5,37,5,38,5,39,5,40,5,41,5,42,5,43,5,44,5,45,5,46,
+5,47,5,48,5,49,5,50,5,51,5,52,5,53,5,54,5,55,5,56,5,57,5,58,5,59,5,60,5,61,
+5,62,5,63,5,64,5,65,5,66,5,67,5,68,5,69,5,70,5,71,5,72,5,73,5,74,5,75,5,76,
+5,77,5,78,5,79,5,80,5,81,5,82,5,83,5,84,5,85,5,86,5,87,5,88,5,89,5,90,5,91,
+5,92,5,93,5,94,5,95,5,96,5,97,5,98,5,99,5,100,5,101,5,102,5,103,5,104,5,105,
+5,106,5,107,5,108,5,109,5,110,5,111,5,112,5,113,5,114,5,115,5,116,5,117,5,
+118,5,119,5,120,5,121,5,122,5,123,5,124,5,125,5,126,5,127,5,128,5,129,5,130,
+5,131,5,132,5,133,5,134,5,135,5,136,5,137,5,138,5,139,5,140,5,141,5,142,5,
+143,5,144,5,145,5,146,5,147,5,148,5,149,5,150,5,151,5,152,5,153,5,154,5,155,
+5,156,5,157,5,158,5,159,5,160,5,161,5,162,5,163,5,164,5,165,5,166,5,167,5,
+168,5,169,5,170,5,171,5,172,5,173,5,174,5,175,5,176,5,177,5,178,5,179,5,180,
+5,181,5,182,5,183,5,184,5,185,5,186,5,187,5,188,5,189,5,190,5,191,5,192,5,
+193,5,194,5,195,5,196,5,197,5,198,5,199,5,200,5,201,5,202,5,203,5,204,5,205,
+5,206,5,207,5,208,5,209,5,210,5,211,5,212,5,213,5,214,5,215,5,216,5,217,5,
+218,5,219,5,220,5,221,5,222,5,223,5,224,5,225,4,110,117,108,108,7,117,110,
+105,65,48,48,48,7,117,110,105,65,48,48,49,7,117,110,105,65,48,48,50,7,117,
+110,105,65,48,48,51,7,117,110,105,65,48,48,52,7,117,110,105,65,48,48,53,7,
+117,110,105,65,48,48,54,7,117,110,105,65,48,48,55,7,117,110,105,65,48,48,
+56,7,117,110,105,65,48,48,57,7,117,110,105,65,48,48,65,7,117,110,105,65,48,
+48,66,7,117,110,105,65,48,48,67,7,117,110,105,65,48,48,68,7,117,110,105,65,
+48,48,69,7,117,110,105,65,48,48,70,7,117,110,105,65,48,49,48,7,117,110,105,
+65,48,49,49,7,117,110,105,65,48,49,50,7,117,110,105,65,48,49,51,7,117,110,
+105,65,48,49,52,7,117,110,105,65,48,49,53,7,117,110,105,65,48,49,54,7,117,
+110,105,65,48,49,55,7,117,110,105,65,48,49,56,7,117,110,105,65,48,49,57,7,
+117,110,105,65,48,49,65,7,117,110,105,65,48,49,66,7,117,110,105,65,48,49,
+67,7,117,110,105,65,48,49,68,7,117,110,105,65,48,49,69,7,117,110,105,65,48,
+49,70,7,117,110,105,65,48,50,48,7,117,110,105,65,48,50,49,7,117,110,105,65,
+48,50,50,7,117,110,105,65,48,50,51,7,117,110,105,65,48,50,52,7,117,110,105,
+65,48,50,53,7,117,110,105,65,48,50,54,7,117,110,105,65,48,50,55,7,117,110,
+105,65,48,50,56,7,117,110,105,65,48,50,57,7,117,110,105,65,48,50,65,7,117,
+110,105,65,48,50,66,7,117,110,105,65,48,50,67,7,117,110,105,65,48,50,68,7,
+117,110,105,65,48,50,69,7,117,110,105,65,48,50,70,7,117,110,105,65,48,51,
+48,7,117,110,105,65,48,51,49,7,117,110,105,65,48,51,50,7,117,110,105,65,48,
+51,51,7,117,110,105,65,48,51,52,7,117,110,105,65,48,51,53,7,117,110,105,65,
+48,51,54,7,117,110,105,65,48,51,55,7,117,110,105,65,48,51,56,7,117,110,105,
+65,48,51,57,7,117,110,105,65,48,51,65,7,117,110,105,65,48,51,66,7,117,110,
+105,65,48,51,67,7,117,110,105,65,48,51,68,7,117,110,105,65,48,51,69,7,117,
+110,105,65,48,51,70,7,117,110,105,65,48,52,48,7,117,110,105,65,48,52,49,7,
+117,110,105,65,48,52,50,7,117,110,105,65,48,52,51,7,117,110,105,65,48,52,
+52,7,117,110,105,65,48,52,53,7,117,110,105,65,48,52,54,7,117,110,105,65,48,
+52,55,7,117,110,105,65,48,52,56,7,117,110,105,65,48,52,57,7,117,110,105,65,
+48,52,65,7,117,110,105,65,48,52,66,7,117,110,105,65,48,52,67,7,117,110,105,
+65,48,52,68,7,117,110,105,65,48,52,69,7,117,110,105,65,48,52,70,7,117,110,
+105,65,48,53,48,7,117,110,105,65,48,53,49,7,117,110,105,65,48,53,50,7,117,
+110,105,65,48,53,51,7,117,110,105,65,48,53,52,7,117,110,105,65,48,53,53,7,
+117,110,105,65,48,53,54,7,117,110,105,65,48,53,55,7,117,110,105,65,48,53,
+56,7,117,110,105,65,48,53,57,7,117,110,105,65,48,53,65,7,117,110,105,65,48,
+53,66,7,117,110,105,65,48,53,67,7,117,110,105,65,48,53,68,7,117,110,105,65,
+48,53,69,7,117,110,105,65,48,53,70,7,117,110,105,65,48,54,48,7,117,110,105,
+65,48,54,49,7,117,110,105,65,48,54,50,7,117,110,105,65,48,54,51,7,117,110,
+105,65,48,54,52,7,117,110,105,65,48,54,53,7,117,110,105,65,48,54,54,7,117,
+110,105,65,48,54,55,7,117,110,105,65,48,54,56,7,117,110,105,65,48,54,57,7,
+117,110,105,65,48,54,65,7,117,110,105,65,48,54,66,7,117,110,105,65,48,54,
+67,7,117,110,105,65,48,54,68,7,117,110,105,65,48,54,69,7,117,110,105,65,48,
+54,70,7,117,110,105,65,48,55,48,7,117,110,105,65,48,55,49,7,117,110,105,65,
+48,55,50,7,117,110,105,65,48,55,51,7,117,110,105,65,48,55,52,7,117,110,105,
+65,48,55,53,7,117,110,105,65,48,55,54,7,117,110,105,65,48,55,55,7,117,110,
+105,65,48,55,56,7,117,110,105,65,48,55,57,7,117,110,105,65,48,55,65,7,117,
+110,105,65,48,55,66,7,117,110,105,65,48,55,67,7,117,110,105,65,48,55,68,7,
+117,110,105,65,48,55,69,7,117,110,105,65,48,55,70,7,117,110,105,65,48,56,
+48,7,117,110,105,65,48,56,49,7,117,110,105,65,48,56,50,7,117,110,105,65,48,
+56,51,7,117,110,105,65,48,56,52,7,117,110,105,65,48,56,53,7,117,110,105,65,
+48,56,54,7,117,110,105,65,48,56,55,7,117,110,105,65,48,56,56,7,117,110,105,
+65,48,56,57,7,117,110,105,65,48,56,65,7,117,110,105,65,48,56,66,7,117,110,
+105,65,48,56,67,7,117,110,105,65,48,56,68,7,117,110,105,65,48,56,69,7,117,
+110,105,65,48,56,70,7,117,110,105,65,48,57,48,7,117,110,105,65,48,57,49,7,
+117,110,105,65,48,57,50,7,117,110,105,65,48,57,51,7,117,110,105,65,48,57,
+52,7,117,110,105,65,48,57,53,7,117,110,105,65,48,57,54,7,117,110,105,65,48,
+57,55,7,117,110,105,65,48,57,56,7,117,110,105,65,48,57,57,7,117,110,105,65,
+48,57,65,7,117,110,105,65,48,57,66,7,117,110,105,65,48,57,67,7,117,110,105,
+65,48,57,68,7,117,110,105,65,48,57,69,7,117,110,105,65,48,57,70,7,117,110,
+105,65,48,65,48,7,117,110,105,65,48,65,49,7,117,110,105,65,48,65,50,7,117,
+110,105,65,48,65,51,7,117,110,105,65,48,65,52,7,117,110,105,65,48,65,53,7,
+117,110,105,65,48,65,54,7,117,110,105,65,48,65,55,7,117,110,105,65,48,65,
+56,7,117,110,105,65,48,65,57,7,117,110,105,65,48,65,65,7,117,110,105,65,48,
+65,66,7,117,110,105,65,48,65,67,7,117,110,105,65,48,65,68,7,117,110,105,65,
+48,65,69,7,117,110,105,65,48,65,70,7,117,110,105,65,48,66,48,7,117,110,105,
+65,48,66,49,7,117,110,105,65,48,66,50,7,117,110,105,65,48,66,51,7,117,110,
+105,65,48,66,52,7,117,110,105,65,48,66,53,7,117,110,105,65,48,66,54,7,117,
+110,105,65,48,66,55,7,117,110,105,65,48,66,56,7,117,110,105,65,48,66,57,7,
+117,110,105,65,48,66,65,7,117,110,105,65,48,66,66,7,117,110,105,65,48,66,
+67,7,117,110,105,65,48,66,68,7,117,110,105,65,48,66,69,7,117,110,105,65,48,
+66,70,7,117,110,105,65,48,67,48,7,117,110,105,65,48,67,49,7,117,110,105,65,
+48,67,50,7,117,110,105,65,48,67,51,7,117,110,105,65,48,67,52,7,117,110,105,
+65,48,67,53,7,117,110,105,65,48,67,54,7,117,110,105,65,48,67,55,7,117,110,
+105,65,48,67,56,7,117,110,105,65,48,67,57,7,117,110,105,65,48,67,65,7,117,
+110,105,65,48,67,66,7,117,110,105,65,48,67,67,7,117,110,105,65,48,67,68,7,
+117,110,105,65,48,67,69,7,117,110,105,65,48,67,70,7,117,110,105,65,48,68,
+48,7,117,110,105,65,48,68,49,7,117,110,105,65,48,68,50,7,117,110,105,65,48,
+68,51,7,117,110,105,65,48,68,52,7,117,110,105,65,48,68,53,7,117,110,105,65,
+48,68,54,7,117,110,105,65,48,68,55,7,117,110,105,65,48,68,56,7,117,110,105,
+65,48,68,57,7,117,110,105,65,48,68,65,7,117,110,105,65,48,68,66,7,117,110,
+105,65,48,68,67,7,117,110,105,65,48,68,68,7,117,110,105,65,48,68,69,7,117,
+110,105,65,48,68,70,7,117,110,105,65,48,69,48,7,117,110,105,65,48,69,49,7,
+117,110,105,65,48,69,50,7,117,110,105,65,48,69,51,7,117,110,105,65,48,69,
+52,7,117,110,105,65,48,69,53,7,117,110,105,65,48,69,54,7,117,110,105,65,48,
+69,55,7,117,110,105,65,48,69,56,7,117,110,105,65,48,69,57,7,117,110,105,65,
+48,69,65,7,117,110,105,65,48,69,66,7,117,110,105,65,48,69,67,7,117,110,105,
+65,48,69,68,7,117,110,105,65,48,69,69,7,117,110,105,65,48,69,70,7,117,110,
+105,65,48,70,48,7,117,110,105,65,48,70,49,7,117,110,105,65,48,70,50,7,117,
+110,105,65,48,70,51,7,117,110,105,65,48,70,52,7,117,110,105,65,48,70,53,7,
+117,110,105,65,48,70,54,7,117,110,105,65,48,70,55,7,117,110,105,65,48,70,
+56,7,117,110,105,65,48,70,57,7,117,110,105,65,48,70,65,7,117,110,105,65,48,
+70,66,7,117,110,105,65,48,70,67,7,117,110,105,65,48,70,68,7,117,110,105,65,
+48,70,69,7,117,110,105,65,48,70,70,7,117,110,105,65,49,48,48,7,117,110,105,
+65,49,48,49,7,117,110,105,65,49,48,50,7,117,110,105,65,49,48,51,7,117,110,
+105,65,49,48,52,7,117,110,105,65,49,48,53,7,117,110,105,65,49,48,54,7,117,
+110,105,65,49,48,55,7,117,110,105,65,49,48,56,7,117,110,105,65,49,48,57,7,
+117,110,105,65,49,48,65,7,117,110,105,65,49,48,66,7,117,110,105,65,49,48,
+67,7,117,110,105,65,49,48,68,7,117,110,105,65,49,48,69,7,117,110,105,65,49,
+48,70,7,117,110,105,65,49,49,48,7,117,110,105,65,49,49,49,7,117,110,105,65,
+49,49,50,7,117,110,105,65,49,49,51,7,117,110,105,65,49,49,52,7,117,110,105,
+65,49,49,53,7,117,110,105,65,49,49,54,7,117,110,105,65,49,49,55,7,117,110,
+105,65,49,49,56,7,117,110,105,65,49,49,57,7,117,110,105,65,49,49,65,7,117,
+110,105,65,49,49,66,7,117,110,105,65,49,49,67,7,117,110,105,65,49,49,68,7,
+117,110,105,65,49,49,69,7,117,110,105,65,49,49,70,7,117,110,105,65,49,50,
+48,7,117,110,105,65,49,50,49,7,117,110,105,65,49,50,50,7,117,110,105,65,49,
+50,51,7,117,110,105,65,49,50,52,7,117,110,105,65,49,50,53,7,117,110,105,65,
+49,50,54,7,117,110,105,65,49,50,55,7,117,110,105,65,49,50,56,7,117,110,105,
+65,49,50,57,7,117,110,105,65,49,50,65,7,117,110,105,65,49,50,66,7,117,110,
+105,65,49,50,67,7,117,110,105,65,49,50,68,7,117,110,105,65,49,50,69,7,117,
+110,105,65,49,50,70,7,117,110,105,65,49,51,48,7,117,110,105,65,49,51,49,7,
+117,110,105,65,49,51,50,7,117,110,105,65,49,51,51,7,117,110,105,65,49,51,
+52,7,117,110,105,65,49,51,53,7,117,110,105,65,49,51,54,7,117,110,105,65,49,
+51,55,7,117,110,105,65,49,51,56,7,117,110,105,65,49,51,57,7,117,110,105,65,
+49,51,65,7,117,110,105,65,49,51,66,7,117,110,105,65,49,51,67,7,117,110,105,
+65,49,51,68,7,117,110,105,65,49,51,69,7,117,110,105,65,49,51,70,7,117,110,
+105,65,49,52,48,7,117,110,105,65,49,52,49,7,117,110,105,65,49,52,50,7,117,
+110,105,65,49,52,51,7,117,110,105,65,49,52,52,7,117,110,105,65,49,52,53,7,
+117,110,105,65,49,52,54,7,117,110,105,65,49,52,55,7,117,110,105,65,49,52,
+56,7,117,110,105,65,49,52,57,7,117,110,105,65,49,52,65,7,117,110,105,65,49,
+52,66,7,117,110,105,65,49,52,67,7,117,110,105,65,49,52,68,7,117,110,105,65,
+49,52,69,7,117,110,105,65,49,52,70,7,117,110,105,65,49,53,48,7,117,110,105,
+65,49,53,49,7,117,110,105,65,49,53,50,7,117,110,105,65,49,53,51,7,117,110,
+105,65,49,53,52,7,117,110,105,65,49,53,53,7,117,110,105,65,49,53,54,7,117,
+110,105,65,49,53,55,7,117,110,105,65,49,53,56,7,117,110,105,65,49,53,57,7,
+117,110,105,65,49,53,65,7,117,110,105,65,49,53,66,7,117,110,105,65,49,53,
+67,7,117,110,105,65,49,53,68,7,117,110,105,65,49,53,69,7,117,110,105,65,49,
+53,70,7,117,110,105,65,49,54,48,7,117,110,105,65,49,54,49,7,117,110,105,65,
+49,54,50,7,117,110,105,65,49,54,51,7,117,110,105,65,49,54,52,7,117,110,105,
+65,49,54,53,7,117,110,105,65,49,54,54,7,117,110,105,65,49,54,55,7,117,110,
+105,65,49,54,56,7,117,110,105,65,49,54,57,7,117,110,105,65,49,54,65,7,117,
+110,105,65,49,54,66,7,117,110,105,65,49,54,67,7,117,110,105,65,49,54,68,7,
+117,110,105,65,49,54,69,7,117,110,105,65,49,54,70,7,117,110,105,65,49,55,
+48,7,117,110,105,65,49,55,49,7,117,110,105,65,49,55,50,7,117,110,105,65,49,
+55,51,7,117,110,105,65,49,55,52,7,117,110,105,65,49,55,53,7,117,110,105,65,
+49,55,54,7,117,110,105,65,49,55,55,7,117,110,105,65,49,55,56,7,117,110,105,
+65,49,55,57,7,117,110,105,65,49,55,65,7,117,110,105,65,49,55,66,7,117,110,
+105,65,49,55,67,7,117,110,105,65,49,55,68,7,117,110,105,65,49,55,69,7,117,
+110,105,65,49,55,70,7,117,110,105,65,49,56,48,7,117,110,105,65,49,56,49,7,
+117,110,105,65,49,56,50,7,117,110,105,65,49,56,51,7,117,110,105,65,49,56,
+52,7,117,110,105,65,49,56,53,7,117,110,105,65,49,56,54,7,117,110,105,65,49,
+56,55,7,117,110,105,65,49,56,56,7,117,110,105,65,49,56,57,7,117,110,105,65,
+49,56,65,7,117,110,105,65,49,56,66,7,117,110,105,65,49,56,67,7,117,110,105,
+65,49,56,68,7,117,110,105,65,49,56,69,7,117,110,105,65,49,56,70,7,117,110,
+105,65,49,57,48,7,117,110,105,65,49,57,49,7,117,110,105,65,49,57,50,7,117,
+110,105,65,49,57,51,7,117,110,105,65,49,57,52,7,117,110,105,65,49,57,53,7,
+117,110,105,65,49,57,54,7,117,110,105,65,49,57,55,7,117,110,105,65,49,57,
+56,7,117,110,105,65,49,57,57,7,117,110,105,65,49,57,65,7,117,110,105,65,49,
+57,66,7,117,110,105,65,49,57,67,7,117,110,105,65,49,57,68,7,117,110,105,65,
+49,57,69,7,117,110,105,65,49,57,70,7,117,110,105,65,49,65,48,7,117,110,105,
+65,49,65,49,7,117,110,105,65,49,65,50,7,117,110,105,65,49,65,51,7,117,110,
+105,65,49,65,52,7,117,110,105,65,49,65,53,7,117,110,105,65,49,65,54,7,117,
+110,105,65,49,65,55,7,117,110,105,65,49,65,56,7,117,110,105,65,49,65,57,7,
+117,110,105,65,49,65,65,7,117,110,105,65,49,65,66,7,117,110,105,65,49,65,
+67,7,117,110,105,65,49,65,68,7,117,110,105,65,49,65,69,7,117,110,105,65,49,
+65,70,7,117,110,105,65,49,66,48,7,117,110,105,65,49,66,49,7,117,110,105,65,
+49,66,50,7,117,110,105,65,49,66,51,7,117,110,105,65,49,66,52,7,117,110,105,
+65,49,66,53,7,117,110,105,65,49,66,54,7,117,110,105,65,49,66,55,7,117,110,
+105,65,49,66,56,7,117,110,105,65,49,66,57,7,117,110,105,65,49,66,65,7,117,
+110,105,65,49,66,66,7,117,110,105,65,49,66,67,7,117,110,105,65,49,66,68,7,
+117,110,105,65,49,66,69,7,117,110,105,65,49,66,70,7,117,110,105,65,49,67,
+48,7,117,110,105,65,49,67,49,7,117,110,105,65,49,67,50,7,117,110,105,65,49,
+67,51,7,117,110,105,65,49,67,52,7,117,110,105,65,49,67,53,7,117,110,105,65,
+49,67,54,7,117,110,105,65,49,67,55,7,117,110,105,65,49,67,56,7,117,110,105,
+65,49,67,57,7,117,110,105,65,49,67,65,7,117,110,105,65,49,67,66,7,117,110,
+105,65,49,67,67,7,117,110,105,65,49,67,68,7,117,110,105,65,49,67,69,7,117,
+110,105,65,49,67,70,7,117,110,105,65,49,68,48,7,117,110,105,65,49,68,49,7,
+117,110,105,65,49,68,50,7,117,110,105,65,49,68,51,7,117,110,105,65,49,68,
+52,7,117,110,105,65,49,68,53,7,117,110,105,65,49,68,54,7,117,110,105,65,49,
+68,55,7,117,110,105,65,49,68,56,7,117,110,105,65,49,68,57,7,117,110,105,65,
+49,68,65,7,117,110,105,65,49,68,66,7,117,110,105,65,49,68,67,7,117,110,105,
+65,49,68,68,7,117,110,105,65,49,68,69,7,117,110,105,65,49,68,70,7,117,110,
+105,65,49,69,48,7,117,110,105,65,49,69,49,7,117,110,105,65,49,69,50,7,117,
+110,105,65,49,69,51,7,117,110,105,65,49,69,52,7,117,110,105,65,49,69,53,7,
+117,110,105,65,49,69,54,7,117,110,105,65,49,69,55,7,117,110,105,65,49,69,
+56,7,117,110,105,65,49,69,57,7,117,110,105,65,49,69,65,7,117,110,105,65,49,
+69,66,7,117,110,105,65,49,69,67,7,117,110,105,65,49,69,68,7,117,110,105,65,
+49,69,69,7,117,110,105,65,49,69,70,7,117,110,105,65,49,70,48,7,117,110,105,
+65,49,70,49,7,117,110,105,65,49,70,50,7,117,110,105,65,49,70,51,7,117,110,
+105,65,49,70,52,7,117,110,105,65,49,70,53,7,117,110,105,65,49,70,54,7,117,
+110,105,65,49,70,55,7,117,110,105,65,49,70,56,7,117,110,105,65,49,70,57,7,
+117,110,105,65,49,70,65,7,117,110,105,65,49,70,66,7,117,110,105,65,49,70,
+67,7,117,110,105,65,49,70,68,7,117,110,105,65,49,70,69,7,117,110,105,65,49,
+70,70,7,117,110,105,65,50,48,48,7,117,110,105,65,50,48,49,7,117,110,105,65,
+50,48,50,7,117,110,105,65,50,48,51,7,117,110,105,65,50,48,52,7,117,110,105,
+65,50,48,53,7,117,110,105,65,50,48,54,7,117,110,105,65,50,48,55,7,117,110,
+105,65,50,48,56,7,117,110,105,65,50,48,57,7,117,110,105,65,50,48,65,7,117,
+110,105,65,50,48,66,7,117,110,105,65,50,48,67,7,117,110,105,65,50,48,68,7,
+117,110,105,65,50,48,69,7,117,110,105,65,50,48,70,7,117,110,105,65,50,49,
+48,7,117,110,105,65,50,49,49,7,117,110,105,65,50,49,50,7,117,110,105,65,50,
+49,51,7,117,110,105,65,50,49,52,7,117,110,105,65,50,49,53,7,117,110,105,65,
+50,49,54,7,117,110,105,65,50,49,55,7,117,110,105,65,50,49,56,7,117,110,105,
+65,50,49,57,7,117,110,105,65,50,49,65,7,117,110,105,65,50,49,66,7,117,110,
+105,65,50,49,67,7,117,110,105,65,50,49,68,7,117,110,105,65,50,49,69,7,117,
+110,105,65,50,49,70,7,117,110,105,65,50,50,48,7,117,110,105,65,50,50,49,7,
+117,110,105,65,50,50,50,7,117,110,105,65,50,50,51,7,117,110,105,65,50,50,
+52,7,117,110,105,65,50,50,53,7,117,110,105,65,50,50,54,7,117,110,105,65,50,
+50,55,7,117,110,105,65,50,50,56,7,117,110,105,65,50,50,57,7,117,110,105,65,
+50,50,65,7,117,110,105,65,50,50,66,7,117,110,105,65,50,50,67,7,117,110,105,
+65,50,50,68,7,117,110,105,65,50,50,69,7,117,110,105,65,50,50,70,7,117,110,
+105,65,50,51,48,7,117,110,105,65,50,51,49,7,117,110,105,65,50,51,50,7,117,
+110,105,65,50,51,51,7,117,110,105,65,50,51,52,7,117,110,105,65,50,51,53,7,
+117,110,105,65,50,51,54,7,117,110,105,65,50,51,55,7,117,110,105,65,50,51,
+56,7,117,110,105,65,50,51,57,7,117,110,105,65,50,51,65,7,117,110,105,65,50,
+51,66,7,117,110,105,65,50,51,67,7,117,110,105,65,50,51,68,7,117,110,105,65,
+50,51,69,7,117,110,105,65,50,51,70,7,117,110,105,65,50,52,48,7,117,110,105,
+65,50,52,49,7,117,110,105,65,50,52,50,7,117,110,105,65,50,52,51,7,117,110,
+105,65,50,52,52,7,117,110,105,65,50,52,53,7,117,110,105,65,50,52,54,7,117,
+110,105,65,50,52,55,7,117,110,105,65,50,52,56,7,117,110,105,65,50,52,57,7,
+117,110,105,65,50,52,65,7,117,110,105,65,50,52,66,7,117,110,105,65,50,52,
+67,7,117,110,105,65,50,52,68,7,117,110,105,65,50,52,69,7,117,110,105,65,50,
+52,70,7,117,110,105,65,50,53,48,7,117,110,105,65,50,53,49,7,117,110,105,65,
+50,53,50,7,117,110,105,65,50,53,51,7,117,110,105,65,50,53,52,7,117,110,105,
+65,50,53,53,7,117,110,105,65,50,53,54,7,117,110,105,65,50,53,55,7,117,110,
+105,65,50,53,56,7,117,110,105,65,50,53,57,7,117,110,105,65,50,53,65,7,117,
+110,105,65,50,53,66,7,117,110,105,65,50,53,67,7,117,110,105,65,50,53,68,7,
+117,110,105,65,50,53,69,7,117,110,105,65,50,53,70,7,117,110,105,65,50,54,
+48,7,117,110,105,65,50,54,49,7,117,110,105,65,50,54,50,7,117,110,105,65,50,
+54,51,7,117,110,105,65,50,54,52,7,117,110,105,65,50,54,53,7,117,110,105,65,
+50,54,54,7,117,110,105,65,50,54,55,7,117,110,105,65,50,54,56,7,117,110,105,
+65,50,54,57,7,117,110,105,65,50,54,65,7,117,110,105,65,50,54,66,7,117,110,
+105,65,50,54,67,7,117,110,105,65,50,54,68,7,117,110,105,65,50,54,69,7,117,
+110,105,65,50,54,70,7,117,110,105,65,50,55,48,7,117,110,105,65,50,55,49,7,
+117,110,105,65,50,55,50,7,117,110,105,65,50,55,51,7,117,110,105,65,50,55,
+52,7,117,110,105,65,50,55,53,7,117,110,105,65,50,55,54,7,117,110,105,65,50,
+55,55,7,117,110,105,65,50,55,56,7,117,110,105,65,50,55,57,7,117,110,105,65,
+50,55,65,7,117,110,105,65,50,55,66,7,117,110,105,65,50,55,67,7,117,110,105,
+65,50,55,68,7,117,110,105,65,50,55,69,7,117,110,105,65,50,55,70,7,117,110,
+105,65,50,56,48,7,117,110,105,65,50,56,49,7,117,110,105,65,50,56,50,7,117,
+110,105,65,50,56,51,7,117,110,105,65,50,56,52,7,117,110,105,65,50,56,53,7,
+117,110,105,65,50,56,54,7,117,110,105,65,50,56,55,7,117,110,105,65,50,56,
+56,7,117,110,105,65,50,56,57,7,117,110,105,65,50,56,65,7,117,110,105,65,50,
+56,66,7,117,110,105,65,50,56,67,7,117,110,105,65,50,56,68,7,117,110,105,65,
+50,56,69,7,117,110,105,65,50,56,70,7,117,110,105,65,50,57,48,7,117,110,105,
+65,50,57,49,7,117,110,105,65,50,57,50,7,117,110,105,65,50,57,51,7,117,110,
+105,65,50,57,52,7,117,110,105,65,50,57,53,7,117,110,105,65,50,57,54,7,117,
+110,105,65,50,57,55,7,117,110,105,65,50,57,56,7,117,110,105,65,50,57,57,7,
+117,110,105,65,50,57,65,7,117,110,105,65,50,57,66,7,117,110,105,65,50,57,
+67,7,117,110,105,65,50,57,68,7,117,110,105,65,50,57,69,7,117,110,105,65,50,
+57,70,7,117,110,105,65,50,65,48,7,117,110,105,65,50,65,49,7,117,110,105,65,
+50,65,50,7,117,110,105,65,50,65,51,7,117,110,105,65,50,65,52,7,117,110,105,
+65,50,65,53,7,117,110,105,65,50,65,54,7,117,110,105,65,50,65,55,7,117,110,
+105,65,50,65,56,7,117,110,105,65,50,65,57,7,117,110,105,65,50,65,65,7,117,
+110,105,65,50,65,66,7,117,110,105,65,50,65,67,7,117,110,105,65,50,65,68,7,
+117,110,105,65,50,65,69,7,117,110,105,65,50,65,70,7,117,110,105,65,50,66,
+48,7,117,110,105,65,50,66,49,7,117,110,105,65,50,66,50,7,117,110,105,65,50,
+66,51,7,117,110,105,65,50,66,52,7,117,110,105,65,50,66,53,7,117,110,105,65,
+50,66,54,7,117,110,105,65,50,66,55,7,117,110,105,65,50,66,56,7,117,110,105,
+65,50,66,57,7,117,110,105,65,50,66,65,7,117,110,105,65,50,66,66,7,117,110,
+105,65,50,66,67,7,117,110,105,65,50,66,68,7,117,110,105,65,50,66,69,7,117,
+110,105,65,50,66,70,7,117,110,105,65,50,67,48,7,117,110,105,65,50,67,49,7,
+117,110,105,65,50,67,50,7,117,110,105,65,50,67,51,7,117,110,105,65,50,67,
+52,7,117,110,105,65,50,67,53,7,117,110,105,65,50,67,54,7,117,110,105,65,50,
+67,55,7,117,110,105,65,50,67,56,7,117,110,105,65,50,67,57,7,117,110,105,65,
+50,67,65,7,117,110,105,65,50,67,66,7,117,110,105,65,50,67,67,7,117,110,105,
+65,50,67,68,7,117,110,105,65,50,67,69,7,117,110,105,65,50,67,70,7,117,110,
+105,65,50,68,48,7,117,110,105,65,50,68,49,7,117,110,105,65,50,68,50,7,117,
+110,105,65,50,68,51,7,117,110,105,65,50,68,52,7,117,110,105,65,50,68,53,7,
+117,110,105,65,50,68,54,7,117,110,105,65,50,68,55,7,117,110,105,65,50,68,
+56,7,117,110,105,65,50,68,57,7,117,110,105,65,50,68,65,7,117,110,105,65,50,
+68,66,7,117,110,105,65,50,68,67,7,117,110,105,65,50,68,68,7,117,110,105,65,
+50,68,69,7,117,110,105,65,50,68,70,7,117,110,105,65,50,69,48,7,117,110,105,
+65,50,69,49,7,117,110,105,65,50,69,50,7,117,110,105,65,50,69,51,7,117,110,
+105,65,50,69,52,7,117,110,105,65,50,69,53,7,117,110,105,65,50,69,54,7,117,
+110,105,65,50,69,55,7,117,110,105,65,50,69,56,7,117,110,105,65,50,69,57,7,
+117,110,105,65,50,69,65,7,117,110,105,65,50,69,66,7,117,110,105,65,50,69,
+67,7,117,110,105,65,50,69,68,7,117,110,105,65,50,69,69,7,117,110,105,65,50,
+69,70,7,117,110,105,65,50,70,48,7,117,110,105,65,50,70,49,7,117,110,105,65,
+50,70,50,7,117,110,105,65,50,70,51,7,117,110,105,65,50,70,52,7,117,110,105,
+65,50,70,53,7,117,110,105,65,50,70,54,7,117,110,105,65,50,70,55,7,117,110,
+105,65,50,70,56,7,117,110,105,65,50,70,57,7,117,110,105,65,50,70,65,7,117,
+110,105,65,50,70,66,7,117,110,105,65,50,70,67,7,117,110,105,65,50,70,68,7,
+117,110,105,65,50,70,69,7,117,110,105,65,50,70,70,7,117,110,105,65,51,48,
+48,7,117,110,105,65,51,48,49,7,117,110,105,65,51,48,50,7,117,110,105,65,51,
+48,51,7,117,110,105,65,51,48,52,7,117,110,105,65,51,48,53,7,117,110,105,65,
+51,48,54,7,117,110,105,65,51,48,55,7,117,110,105,65,51,48,56,7,117,110,105,
+65,51,48,57,7,117,110,105,65,51,48,65,7,117,110,105,65,51,48,66,7,117,110,
+105,65,51,48,67,7,117,110,105,65,51,48,68,7,117,110,105,65,51,48,69,7,117,
+110,105,65,51,48,70,7,117,110,105,65,51,49,48,7,117,110,105,65,51,49,49,7,
+117,110,105,65,51,49,50,7,117,110,105,65,51,49,51,7,117,110,105,65,51,49,
+52,7,117,110,105,65,51,49,53,7,117,110,105,65,51,49,54,7,117,110,105,65,51,
+49,55,7,117,110,105,65,51,49,56,7,117,110,105,65,51,49,57,7,117,110,105,65,
+51,49,65,7,117,110,105,65,51,49,66,7,117,110,105,65,51,49,67,7,117,110,105,
+65,51,49,68,7,117,110,105,65,51,49,69,7,117,110,105,65,51,49,70,7,117,110,
+105,65,51,50,48,7,117,110,105,65,51,50,49,7,117,110,105,65,51,50,50,7,117,
+110,105,65,51,50,51,7,117,110,105,65,51,50,52,7,117,110,105,65,51,50,53,7,
+117,110,105,65,51,50,54,7,117,110,105,65,51,50,55,7,117,110,105,65,51,50,
+56,7,117,110,105,65,51,50,57,7,117,110,105,65,51,50,65,7,117,110,105,65,51,
+50,66,7,117,110,105,65,51,50,67,7,117,110,105,65,51,50,68,7,117,110,105,65,
+51,50,69,7,117,110,105,65,51,50,70,7,117,110,105,65,51,51,48,7,117,110,105,
+65,51,51,49,7,117,110,105,65,51,51,50,7,117,110,105,65,51,51,51,7,117,110,
+105,65,51,51,52,7,117,110,105,65,51,51,53,7,117,110,105,65,51,51,54,7,117,
+110,105,65,51,51,55,7,117,110,105,65,51,51,56,7,117,110,105,65,51,51,57,7,
+117,110,105,65,51,51,65,7,117,110,105,65,51,51,66,7,117,110,105,65,51,51,
+67,7,117,110,105,65,51,51,68,7,117,110,105,65,51,51,69,7,117,110,105,65,51,
+51,70,7,117,110,105,65,51,52,48,7,117,110,105,65,51,52,49,7,117,110,105,65,
+51,52,50,7,117,110,105,65,51,52,51,7,117,110,105,65,51,52,52,7,117,110,105,
+65,51,52,53,7,117,110,105,65,51,52,54,7,117,110,105,65,51,52,55,7,117,110,
+105,65,51,52,56,7,117,110,105,65,51,52,57,7,117,110,105,65,51,52,65,7,117,
+110,105,65,51,52,66,7,117,110,105,65,51,52,67,7,117,110,105,65,51,52,68,7,
+117,110,105,65,51,52,69,7,117,110,105,65,51,52,70,7,117,110,105,65,51,53,
+48,7,117,110,105,65,51,53,49,7,117,110,105,65,51,53,50,7,117,110,105,65,51,
+53,51,7,117,110,105,65,51,53,52,7,117,110,105,65,51,53,53,7,117,110,105,65,
+51,53,54,7,117,110,105,65,51,53,55,7,117,110,105,65,51,53,56,7,117,110,105,
+65,51,53,57,7,117,110,105,65,51,53,65,7,117,110,105,65,51,53,66,7,117,110,
+105,65,51,53,67,7,117,110,105,65,51,53,68,7,117,110,105,65,51,53,69,7,117,
+110,105,65,51,53,70,7,117,110,105,65,51,54,48,7,117,110,105,65,51,54,49,7,
+117,110,105,65,51,54,50,7,117,110,105,65,51,54,51,7,117,110,105,65,51,54,
+52,7,117,110,105,65,51,54,53,7,117,110,105,65,51,54,54,7,117,110,105,65,51,
+54,55,7,117,110,105,65,51,54,56,7,117,110,105,65,51,54,57,7,117,110,105,65,
+51,54,65,7,117,110,105,65,51,54,66,7,117,110,105,65,51,54,67,7,117,110,105,
+65,51,54,68,7,117,110,105,65,51,54,69,7,117,110,105,65,51,54,70,7,117,110,
+105,65,51,55,48,7,117,110,105,65,51,55,49,7,117,110,105,65,51,55,50,7,117,
+110,105,65,51,55,51,7,117,110,105,65,51,55,52,7,117,110,105,65,51,55,53,7,
+117,110,105,65,51,55,54,7,117,110,105,65,51,55,55,7,117,110,105,65,51,55,
+56,7,117,110,105,65,51,55,57,7,117,110,105,65,51,55,65,7,117,110,105,65,51,
+55,66,7,117,110,105,65,51,55,67,7,117,110,105,65,51,55,68,7,117,110,105,65,
+51,55,69,7,117,110,105,65,51,55,70,7,117,110,105,65,51,56,48,7,117,110,105,
+65,51,56,49,7,117,110,105,65,51,56,50,7,117,110,105,65,51,56,51,7,117,110,
+105,65,51,56,52,7,117,110,105,65,51,56,53,7,117,110,105,65,51,56,54,7,117,
+110,105,65,51,56,55,7,117,110,105,65,51,56,56,7,117,110,105,65,51,56,57,7,
+117,110,105,65,51,56,65,7,117,110,105,65,51,56,66,7,117,110,105,65,51,56,
+67,7,117,110,105,65,51,56,68,7,117,110,105,65,51,56,69,7,117,110,105,65,51,
+56,70,7,117,110,105,65,51,57,48,7,117,110,105,65,51,57,49,7,117,110,105,65,
+51,57,50,7,117,110,105,65,51,57,51,7,117,110,105,65,51,57,52,7,117,110,105,
+65,51,57,53,7,117,110,105,65,51,57,54,7,117,110,105,65,51,57,55,7,117,110,
+105,65,51,57,56,7,117,110,105,65,51,57,57,7,117,110,105,65,51,57,65,7,117,
+110,105,65,51,57,66,7,117,110,105,65,51,57,67,7,117,110,105,65,51,57,68,7,
+117,110,105,65,51,57,69,7,117,110,105,65,51,57,70,7,117,110,105,65,51,65,
+48,7,117,110,105,65,51,65,49,7,117,110,105,65,51,65,50,7,117,110,105,65,51,
+65,51,7,117,110,105,65,51,65,52,7,117,110,105,65,51,65,53,7,117,110,105,65,
+51,65,54,7,117,110,105,65,51,65,55,7,117,110,105,65,51,65,56,7,117,110,105,
+65,51,65,57,7,117,110,105,65,51,65,65,7,117,110,105,65,51,65,66,7,117,110,
+105,65,51,65,67,7,117,110,105,65,51,65,68,7,117,110,105,65,51,65,69,7,117,
+110,105,65,51,65,70,7,117,110,105,65,51,66,48,7,117,110,105,65,51,66,49,7,
+117,110,105,65,51,66,50,7,117,110,105,65,51,66,51,7,117,110,105,65,51,66,
+52,7,117,110,105,65,51,66,53,7,117,110,105,65,51,66,54,7,117,110,105,65,51,
+66,55,7,117,110,105,65,51,66,56,7,117,110,105,65,51,66,57,7,117,110,105,65,
+51,66,65,7,117,110,105,65,51,66,66,7,117,110,105,65,51,66,67,7,117,110,105,
+65,51,66,68,7,117,110,105,65,51,66,69,7,117,110,105,65,51,66,70,7,117,110,
+105,65,51,67,48,7,117,110,105,65,51,67,49,7,117,110,105,65,51,67,50,7,117,
+110,105,65,51,67,51,7,117,110,105,65,51,67,52,7,117,110,105,65,51,67,53,7,
+117,110,105,65,51,67,54,7,117,110,105,65,51,67,55,7,117,110,105,65,51,67,
+56,7,117,110,105,65,51,67,57,7,117,110,105,65,51,67,65,7,117,110,105,65,51,
+67,66,7,117,110,105,65,51,67,67,7,117,110,105,65,51,67,68,7,117,110,105,65,
+51,67,69,7,117,110,105,65,51,67,70,7,117,110,105,65,51,68,48,7,117,110,105,
+65,51,68,49,7,117,110,105,65,51,68,50,7,117,110,105,65,51,68,51,7,117,110,
+105,65,51,68,52,7,117,110,105,65,51,68,53,7,117,110,105,65,51,68,54,7,117,
+110,105,65,51,68,55,7,117,110,105,65,51,68,56,7,117,110,105,65,51,68,57,7,
+117,110,105,65,51,68,65,7,117,110,105,65,51,68,66,7,117,110,105,65,51,68,
+67,7,117,110,105,65,51,68,68,7,117,110,105,65,51,68,69,7,117,110,105,65,51,
+68,70,7,117,110,105,65,51,69,48,7,117,110,105,65,51,69,49,7,117,110,105,65,
+51,69,50,7,117,110,105,65,51,69,51,7,117,110,105,65,51,69,52,7,117,110,105,
+65,51,69,53,7,117,110,105,65,51,69,54,7,117,110,105,65,51,69,55,7,117,110,
+105,65,51,69,56,7,117,110,105,65,51,69,57,7,117,110,105,65,51,69,65,7,117,
+110,105,65,51,69,66,7,117,110,105,65,51,69,67,7,117,110,105,65,51,69,68,7,
+117,110,105,65,51,69,69,7,117,110,105,65,51,69,70,7,117,110,105,65,51,70,
+48,7,117,110,105,65,51,70,49,7,117,110,105,65,51,70,50,7,117,110,105,65,51,
+70,51,7,117,110,105,65,51,70,52,7,117,110,105,65,51,70,53,7,117,110,105,65,
+51,70,54,7,117,110,105,65,51,70,55,7,117,110,105,65,51,70,56,7,117,110,105,
+65,51,70,57,7,117,110,105,65,51,70,65,7,117,110,105,65,51,70,66,7,117,110,
+105,65,51,70,67,7,117,110,105,65,51,70,68,7,117,110,105,65,51,70,69,7,117,
+110,105,65,51,70,70,7,117,110,105,65,52,48,48,7,117,110,105,65,52,48,49,7,
+117,110,105,65,52,48,50,7,117,110,105,65,52,48,51,7,117,110,105,65,52,48,
+52,7,117,110,105,65,52,48,53,7,117,110,105,65,52,48,54,7,117,110,105,65,52,
+48,55,7,117,110,105,65,52,48,56,7,117,110,105,65,52,48,57,7,117,110,105,65,
+52,48,65,7,117,110,105,65,52,48,66,7,117,110,105,65,52,48,67,7,117,110,105,
+65,52,48,68,7,117,110,105,65,52,48,69,7,117,110,105,65,52,48,70,7,117,110,
+105,65,52,49,48,7,117,110,105,65,52,49,49,7,117,110,105,65,52,49,50,7,117,
+110,105,65,52,49,51,7,117,110,105,65,52,49,52,7,117,110,105,65,52,49,53,7,
+117,110,105,65,52,49,54,7,117,110,105,65,52,49,55,7,117,110,105,65,52,49,
+56,7,117,110,105,65,52,49,57,7,117,110,105,65,52,49,65,7,117,110,105,65,52,
+49,66,7,117,110,105,65,52,49,67,7,117,110,105,65,52,49,68,7,117,110,105,65,
+52,49,69,7,117,110,105,65,52,49,70,7,117,110,105,65,52,50,48,7,117,110,105,
+65,52,50,49,7,117,110,105,65,52,50,50,7,117,110,105,65,52,50,51,7,117,110,
+105,65,52,50,52,7,117,110,105,65,52,50,53,7,117,110,105,65,52,50,54,7,117,
+110,105,65,52,50,55,7,117,110,105,65,52,50,56,7,117,110,105,65,52,50,57,7,
+117,110,105,65,52,50,65,7,117,110,105,65,52,50,66,7,117,110,105,65,52,50,
+67,7,117,110,105,65,52,50,68,7,117,110,105,65,52,50,69,7,117,110,105,65,52,
+50,70,7,117,110,105,65,52,51,48,7,117,110,105,65,52,51,49,7,117,110,105,65,
+52,51,50,7,117,110,105,65,52,51,51,7,117,110,105,65,52,51,52,7,117,110,105,
+65,52,51,53,7,117,110,105,65,52,51,54,7,117,110,105,65,52,51,55,7,117,110,
+105,65,52,51,56,7,117,110,105,65,52,51,57,7,117,110,105,65,52,51,65,7,117,
+110,105,65,52,51,66,7,117,110,105,65,52,51,67,7,117,110,105,65,52,51,68,7,
+117,110,105,65,52,51,69,7,117,110,105,65,52,51,70,7,117,110,105,65,52,52,
+48,7,117,110,105,65,52,52,49,7,117,110,105,65,52,52,50,7,117,110,105,65,52,
+52,51,7,117,110,105,65,52,52,52,7,117,110,105,65,52,52,53,7,117,110,105,65,
+52,52,54,7,117,110,105,65,52,52,55,7,117,110,105,65,52,52,56,7,117,110,105,
+65,52,52,57,7,117,110,105,65,52,52,65,7,117,110,105,65,52,52,66,7,117,110,
+105,65,52,52,67,7,117,110,105,65,52,52,68,7,117,110,105,65,52,52,69,7,117,
+110,105,65,52,52,70,7,117,110,105,65,52,53,48,7,117,110,105,65,52,53,49,7,
+117,110,105,65,52,53,50,7,117,110,105,65,52,53,51,7,117,110,105,65,52,53,
+52,7,117,110,105,65,52,53,53,7,117,110,105,65,52,53,54,7,117,110,105,65,52,
+53,55,7,117,110,105,65,52,53,56,7,117,110,105,65,52,53,57,7,117,110,105,65,
+52,53,65,7,117,110,105,65,52,53,66,7,117,110,105,65,52,53,67,7,117,110,105,
+65,52,53,68,7,117,110,105,65,52,53,69,7,117,110,105,65,52,53,70,7,117,110,
+105,65,52,54,48,7,117,110,105,65,52,54,49,7,117,110,105,65,52,54,50,7,117,
+110,105,65,52,54,51,7,117,110,105,65,52,54,52,7,117,110,105,65,52,54,53,7,
+117,110,105,65,52,54,54,7,117,110,105,65,52,54,55,7,117,110,105,65,52,54,
+56,7,117,110,105,65,52,54,57,7,117,110,105,65,52,54,65,7,117,110,105,65,52,
+54,66,7,117,110,105,65,52,54,67,7,117,110,105,65,52,54,68,7,117,110,105,65,
+52,54,69,7,117,110,105,65,52,54,70,7,117,110,105,65,52,55,48,7,117,110,105,
+65,52,55,49,7,117,110,105,65,52,55,50,7,117,110,105,65,52,55,51,7,117,110,
+105,65,52,55,52,7,117,110,105,65,52,55,53,7,117,110,105,65,52,55,54,7,117,
+110,105,65,52,55,55,7,117,110,105,65,52,55,56,7,117,110,105,65,52,55,57,7,
+117,110,105,65,52,55,65,7,117,110,105,65,52,55,66,7,117,110,105,65,52,55,
+67,7,117,110,105,65,52,55,68,7,117,110,105,65,52,55,69,7,117,110,105,65,52,
+55,70,7,117,110,105,65,52,56,48,7,117,110,105,65,52,56,49,7,117,110,105,65,
+52,56,50,7,117,110,105,65,52,56,51,7,117,110,105,65,52,56,52,7,117,110,105,
+65,52,56,53,7,117,110,105,65,52,56,54,7,117,110,105,65,52,56,55,7,117,110,
+105,65,52,56,56,7,117,110,105,65,52,56,57,7,117,110,105,65,52,56,65,7,117,
+110,105,65,52,56,66,7,117,110,105,65,52,56,67,7,117,110,105,65,52,57,48,7,
+117,110,105,65,52,57,49,7,117,110,105,65,52,57,50,7,117,110,105,65,52,57,
+51,7,117,110,105,65,52,57,52,7,117,110,105,65,52,57,53,7,117,110,105,65,52,
+57,54,7,117,110,105,65,52,57,55,7,117,110,105,65,52,57,56,7,117,110,105,65,
+52,57,57,7,117,110,105,65,52,57,65,7,117,110,105,65,52,57,66,7,117,110,105,
+65,52,57,67,7,117,110,105,65,52,57,68,7,117,110,105,65,52,57,69,7,117,110,
+105,65,52,57,70,7,117,110,105,65,52,65,48,7,117,110,105,65,52,65,49,7,117,
+110,105,65,52,65,50,7,117,110,105,65,52,65,51,7,117,110,105,65,52,65,52,7,
+117,110,105,65,52,65,53,7,117,110,105,65,52,65,54,7,117,110,105,65,52,65,
+55,7,117,110,105,65,52,65,56,7,117,110,105,65,52,65,57,7,117,110,105,65,52,
+65,65,7,117,110,105,65,52,65,66,7,117,110,105,65,52,65,67,7,117,110,105,65,
+52,65,68,7,117,110,105,65,52,65,69,7,117,110,105,65,52,65,70,7,117,110,105,
+65,52,66,48,7,117,110,105,65,52,66,49,7,117,110,105,65,52,66,50,7,117,110,
+105,65,52,66,51,7,117,110,105,65,52,66,52,7,117,110,105,65,52,66,53,7,117,
+110,105,65,52,66,54,7,117,110,105,65,52,66,55,7,117,110,105,65,52,66,56,7,
+117,110,105,65,52,66,57,7,117,110,105,65,52,66,65,7,117,110,105,65,52,66,
+66,7,117,110,105,65,52,66,67,7,117,110,105,65,52,66,68,7,117,110,105,65,52,
+66,69,7,117,110,105,65,52,66,70,7,117,110,105,65,52,67,48,7,117,110,105,65,
+52,67,49,7,117,110,105,65,52,67,50,7,117,110,105,65,52,67,51,7,117,110,105,
+65,52,67,52,7,117,110,105,65,52,67,53,7,117,110,105,65,52,67,54,7,121,105,
+95,109,97,114,107,7,117,110,105,51,48,48,49,7,117,110,105,51,48,48,50,7,117,
+110,105,51,48,48,56,7,117,110,105,51,48,48,57,7,117,110,105,51,48,48,65,7,
+117,110,105,51,48,48,66,7,117,110,105,51,48,48,67,7,117,110,105,51,48,48,
+68,7,117,110,105,51,48,48,69,7,117,110,105,51,48,48,70,7,117,110,105,51,48,
+49,48,7,117,110,105,51,48,49,49,7,117,110,105,51,48,49,52,7,117,110,105,51,
+48,49,53,7,117,110,105,51,48,49,54,7,117,110,105,51,48,49,55,7,117,110,105,
+51,48,49,56,7,117,110,105,51,48,49,57,7,117,110,105,51,48,49,65,7,117,110,
+105,51,48,49,66,7,117,110,105,51,48,70,66,7,117,110,105,70,70,54,49,7,117,
+110,105,70,70,54,50,7,117,110,105,70,70,54,51,7,117,110,105,70,70,54,52,7,
+117,110,105,70,70,54,53,0,0,0,0,0,0,2,0,8,0,2,255,255,0,3,};
+#endif
@@ -0,0 +1,9983 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerif_Regular_ttf_size = 247392;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerif_Regular_ttf");
+asm(".type fz_font_NotoSerif_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerif_Regular_ttf, 247392");
+asm(".balign 64");
+asm("fz_font_NotoSerif_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerif-Regular.ttf\"");
+#else
+const int fz_font_NotoSerif_Regular_ttf_size = 247392;
+const char fz_font_NotoSerif_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,53,228,69,168,0,3,19,120,0,0,1,166,
+71,80,79,83,217,243,28,207,0,3,21,32,0,0,168,64,71,83,85,66,244,118,165,107,
+0,3,189,96,0,0,8,254,79,83,47,50,127,146,77,90,0,0,1,104,0,0,0,96,99,109,
+97,112,186,248,8,252,0,0,39,128,0,0,6,98,103,97,115,112,0,7,0,7,0,3,19,108,
+0,0,0,12,103,108,121,102,169,63,64,149,0,0,83,160,0,2,185,202,104,101,97,
+100,250,63,131,84,0,0,0,236,0,0,0,54,104,104,101,97,14,252,12,133,0,0,1,36,
+0,0,0,36,104,109,116,120,93,238,160,186,0,0,1,200,0,0,37,184,108,111,99,97,
+13,175,169,19,0,0,45,228,0,0,37,188,109,97,120,112,9,203,2,16,0,0,1,72,0,
+0,0,32,110,97,109,101,135,212,181,81,0,3,13,108,0,0,5,222,112,111,115,116,
+255,105,0,102,0,3,19,76,0,0,0,32,0,1,0,0,0,1,17,236,140,49,96,14,95,15,60,
+245,0,11,8,0,0,0,0,0,193,154,52,242,0,0,0,0,211,25,241,21,251,137,254,0,10,
+227,8,98,0,0,0,9,0,2,0,1,0,0,0,0,0,1,0,0,8,141,253,168,0,0,10,231,251,137,
+250,135,10,227,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,110,0,1,0,0,9,110,1,82,0,
+84,0,188,0,5,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,4,209,1,144,0,5,0,0,
+5,154,5,51,0,0,1,30,5,154,5,51,0,0,3,208,0,102,1,242,2,0,2,11,5,2,4,5,4,2,
+2,4,224,0,2,255,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,255,253,8,141,
+253,168,0,0,8,141,2,88,32,0,1,159,223,215,0,0,4,74,5,182,0,0,0,32,0,4,4,0,
+0,102,0,0,0,0,4,20,0,0,2,20,0,0,2,170,0,211,3,68,0,117,4,121,0,51,4,121,0,
+135,7,43,0,92,5,240,0,74,1,195,0,117,2,197,0,117,2,197,0,66,4,0,0,84,4,121,
+0,133,2,0,0,61,2,123,0,51,2,0,0,127,2,78,0,0,4,121,0,92,4,121,0,135,4,121,
+0,104,4,121,0,119,4,121,0,35,4,121,0,113,4,121,0,125,4,121,0,121,4,121,0,
+94,4,121,0,104,2,74,0,166,2,74,0,98,4,121,0,133,4,121,0,133,4,121,0,133,4,
+0,0,88,7,94,0,133,5,164,0,0,5,59,0,78,4,233,0,117,5,209,0,78,4,252,0,78,4,
+184,0,78,5,182,0,117,6,88,0,78,2,240,0,78,2,219,255,233,5,154,0,78,4,252,
+0,78,7,129,0,78,6,27,0,78,5,240,0,115,4,213,0,78,5,240,0,115,5,63,0,78,4,
+90,0,98,4,231,0,41,5,188,0,31,5,102,0,0,8,96,0,18,5,72,0,16,5,0,255,246,4,
+188,0,74,2,225,0,205,2,78,0,0,2,225,0,76,4,121,0,104,3,172,255,246,4,158,
+1,137,4,129,0,102,4,233,0,37,3,240,0,113,4,233,0,113,4,72,0,113,2,244,0,55,
+4,78,0,47,5,20,0,37,2,143,0,47,2,102,255,231,4,174,0,37,2,123,0,27,7,143,
+0,57,5,41,0,57,4,158,0,113,4,233,0,27,4,233,0,113,3,197,0,68,3,156,0,92,2,
+209,0,39,5,20,0,47,4,162,0,8,6,229,0,2,4,160,0,10,4,133,0,8,4,23,0,86,3,109,
+0,102,4,121,1,254,3,109,0,102,4,121,0,111,2,20,0,0,2,170,0,211,4,121,0,162,
+4,121,0,100,4,121,0,131,4,121,0,10,4,121,1,254,4,90,0,160,4,158,1,35,6,195,
+0,113,3,14,0,72,4,29,0,133,4,121,0,133,2,123,0,51,6,195,0,113,3,172,255,246,
+3,51,0,98,4,121,0,133,3,51,0,86,3,51,0,82,4,158,1,135,4,236,0,176,4,240,0,
+82,2,0,0,127,2,170,0,123,3,51,0,86,3,45,0,72,4,29,0,133,6,184,0,21,6,184,
+0,21,6,184,0,82,4,0,0,104,5,164,0,0,5,164,0,0,5,164,0,0,5,164,0,0,5,164,0,
+0,5,164,0,0,7,156,0,0,4,233,0,117,4,252,0,78,4,252,0,78,4,252,0,78,4,252,
+0,78,2,240,0,75,2,240,0,78,2,240,0,73,2,240,0,73,5,209,0,78,6,27,0,78,5,240,
+0,115,5,240,0,115,5,240,0,115,5,240,0,115,5,240,0,115,4,121,0,145,5,240,0,
+115,5,188,0,31,5,188,0,31,5,188,0,31,5,188,0,31,5,0,255,246,4,213,0,78,5,
+45,0,47,4,129,0,102,4,129,0,102,4,129,0,102,4,129,0,102,4,129,0,102,4,129,
+0,102,6,186,0,102,3,240,0,113,4,72,0,113,4,72,0,113,4,72,0,113,4,72,0,113,
+2,143,0,38,2,143,0,47,2,143,0,22,2,143,0,18,4,158,0,113,5,41,0,57,4,158,0,
+113,4,158,0,113,4,158,0,113,4,158,0,113,4,158,0,113,4,121,0,133,4,158,0,113,
+5,20,0,47,5,20,0,47,5,20,0,47,5,20,0,47,4,133,0,8,4,233,0,37,4,133,0,8,5,
+164,0,0,4,129,0,102,5,164,0,0,4,129,0,102,5,164,0,0,4,129,0,102,4,233,0,117,
+3,240,0,113,4,233,0,117,3,240,0,113,4,233,0,117,3,240,0,113,4,233,0,117,3,
+240,0,113,5,209,0,78,4,233,0,113,5,209,0,78,4,233,0,113,4,252,0,78,4,72,0,
+113,4,252,0,78,4,72,0,113,4,252,0,78,4,72,0,113,4,252,0,78,4,72,0,113,4,252,
+0,78,4,72,0,113,5,182,0,117,4,78,0,47,5,182,0,117,4,78,0,47,5,182,0,117,4,
+78,0,47,5,182,0,117,4,78,0,47,6,88,0,78,5,20,0,37,6,88,0,78,5,20,0,35,2,240,
+0,11,2,143,255,208,2,240,0,78,2,143,0,1,2,240,0,78,2,143,0,25,2,240,0,78,
+2,143,0,47,2,240,0,78,2,143,0,47,5,145,0,78,4,246,0,47,2,219,255,233,2,102,
+255,231,5,154,0,78,4,174,0,37,4,174,0,37,4,252,0,78,2,123,0,27,4,252,0,78,
+2,123,0,27,4,252,0,78,2,123,0,27,4,252,0,78,2,246,0,27,4,252,0,78,2,152,0,
+57,6,27,0,78,5,41,0,57,6,27,0,78,5,41,0,57,6,27,0,78,5,41,0,57,6,61,0,1,6,
+27,0,78,5,20,0,57,5,240,0,115,4,158,0,113,5,240,0,115,4,158,0,113,5,240,0,
+115,4,158,0,113,7,172,0,115,7,61,0,113,5,63,0,78,3,197,0,68,5,63,0,78,3,197,
+0,68,5,63,0,78,3,197,0,68,4,90,0,98,3,156,0,92,4,90,0,98,3,156,0,92,4,90,
+0,98,3,156,0,92,4,90,0,98,3,156,0,92,4,231,0,41,2,209,0,39,4,231,0,41,2,209,
+0,39,4,231,0,41,2,209,0,39,5,188,0,31,5,20,0,47,5,188,0,31,5,20,0,47,5,188,
+0,31,5,20,0,47,5,188,0,31,5,20,0,47,5,188,0,31,5,20,0,47,5,188,0,31,5,20,
+0,47,8,96,0,18,6,229,0,2,5,0,255,246,4,133,0,8,5,0,255,246,4,188,0,74,4,23,
+0,86,4,188,0,74,4,23,0,86,4,188,0,74,4,23,0,86,2,215,0,27,4,121,255,174,5,
+164,0,0,4,129,0,102,7,156,0,0,6,186,0,102,5,240,0,115,4,158,0,113,4,90,0,
+98,3,156,0,92,4,158,1,33,4,158,1,33,4,0,0,215,4,158,1,47,2,154,0,223,2,170,
+0,94,4,0,1,96,4,158,0,225,4,158,0,209,4,158,1,248,4,158,1,20,5,164,0,0,2,
+37,0,147,5,162,255,147,6,250,255,147,3,145,255,147,5,240,255,188,5,250,255,
+147,6,6,255,188,2,172,0,5,5,164,0,0,5,59,0,78,4,125,0,78,4,221,0,63,4,252,
+0,78,4,188,0,74,6,88,0,78,5,240,0,115,2,240,0,78,5,154,0,78,5,102,0,2,7,129,
+0,78,6,27,0,78,4,248,0,86,5,240,0,115,6,27,0,78,4,213,0,78,4,215,0,47,4,231,
+0,41,5,0,255,246,6,35,0,68,5,72,0,16,6,160,0,25,6,6,0,86,2,240,0,73,5,0,255,
+246,4,227,0,113,3,248,0,111,4,215,0,147,2,172,0,201,4,190,0,37,4,227,0,113,
+4,219,0,201,4,152,0,0,4,158,0,111,3,248,0,111,3,178,0,111,4,215,0,147,4,162,
+0,113,2,172,0,201,4,217,0,37,4,72,0,16,4,236,0,176,4,162,0,0,3,195,0,111,
+4,158,0,113,5,10,0,66,4,225,0,180,3,201,0,113,4,213,0,113,3,244,0,66,4,190,
+0,37,5,147,0,113,4,57,255,248,5,141,0,37,6,37,0,113,2,172,0,5,4,190,0,37,
+4,158,0,113,4,190,0,37,6,37,0,113,4,252,0,78,6,29,0,41,4,125,0,78,4,233,0,
+117,4,90,0,98,2,240,0,78,2,240,0,73,2,219,255,233,7,29,0,0,7,195,0,78,6,152,
+0,41,5,154,0,78,5,92,0,0,6,27,0,78,5,164,0,0,4,213,0,78,5,59,0,78,4,125,0,
+78,5,117,0,29,4,252,0,78,7,213,0,0,4,211,0,92,6,109,0,78,6,109,0,78,5,154,
+0,78,5,158,0,0,7,129,0,78,6,88,0,78,5,240,0,115,6,27,0,78,4,213,0,78,4,233,
+0,117,4,231,0,41,5,92,0,0,6,35,0,68,5,72,0,16,6,27,0,78,6,12,0,43,8,162,0,
+78,8,162,0,78,5,166,0,41,7,66,0,78,4,213,0,78,4,231,0,92,8,82,0,78,5,63,255,
+233,4,129,0,102,4,156,0,113,4,195,0,47,3,170,0,47,4,166,0,27,4,72,0,113,7,
+10,0,6,3,233,0,82,5,129,0,47,5,129,0,47,4,236,0,37,5,6,0,0,6,76,0,47,5,129,
+0,47,4,158,0,113,5,88,0,47,4,233,0,27,3,240,0,113,4,96,0,41,4,133,0,8,5,188,
+0,113,4,160,0,10,5,109,0,47,5,31,0,31,7,145,0,47,7,145,0,47,5,162,0,61,6,
+156,0,47,4,195,0,47,3,238,0,82,6,223,0,47,4,115,0,16,4,72,0,113,4,229,0,35,
+3,170,0,47,3,240,0,113,3,156,0,92,2,143,0,47,2,143,0,32,2,102,255,231,6,215,
+0,0,7,70,0,47,5,20,0,35,4,236,0,37,4,133,0,8,5,109,0,47,4,90,0,78,3,143,0,
+47,8,96,0,18,6,229,0,2,8,96,0,18,6,229,0,2,8,96,0,18,6,229,0,2,5,0,255,246,
+4,133,0,8,4,0,255,246,8,0,255,246,8,0,255,246,3,74,255,246,2,0,0,115,2,0,
+0,61,2,0,0,61,2,0,0,115,3,154,0,115,3,154,0,61,3,154,0,61,3,150,0,72,3,150,
+0,72,2,229,0,100,6,221,0,164,10,84,0,92,2,170,0,133,2,170,0,135,4,123,0,211,
+0,127,254,143,3,82,0,20,4,121,0,90,4,121,0,100,6,141,0,55,4,121,0,84,6,12,
+0,82,4,0,0,92,8,53,0,57,6,174,0,55,6,6,0,86,4,244,0,102,6,184,0,36,6,184,
+0,94,6,184,0,94,6,184,0,118,3,252,0,70,4,221,0,63,6,88,0,78,5,135,0,80,4,
+121,0,133,4,47,0,66,5,168,0,72,4,80,0,41,4,121,0,111,4,121,0,133,4,121,0,
+133,4,121,0,133,4,98,0,61,5,78,0,55,5,98,0,55,4,158,0,207,2,102,255,231,4,
+0,1,145,4,0,1,123,4,0,1,115,3,51,0,33,3,51,0,88,3,51,0,102,3,51,0,82,4,0,
+0,0,8,0,0,0,4,0,0,0,8,0,0,0,2,171,0,0,2,0,0,0,1,85,0,0,4,121,0,0,2,68,0,0,
+1,154,0,0,0,205,0,0,0,0,0,0,0,0,0,0,8,0,0,84,8,0,0,84,2,102,255,231,2,0,0,
+61,4,213,0,18,5,31,255,246,7,111,0,66,7,129,0,78,7,143,0,57,5,164,0,0,4,129,
+0,102,0,127,254,143,2,170,0,113,3,252,0,60,8,4,0,55,8,2,0,55,6,57,0,115,4,
+219,0,113,6,57,0,31,5,104,0,47,0,0,252,144,0,0,253,68,0,0,252,9,0,0,252,195,
+0,0,253,39,4,252,0,78,6,109,0,78,4,72,0,113,5,129,0,47,7,219,0,117,6,129,
+0,0,5,84,0,41,4,195,0,47,7,74,0,78,6,90,0,47,5,135,0,0,4,182,0,6,8,74,0,78,
+6,166,0,47,6,76,0,0,5,158,0,6,9,25,0,78,7,141,0,47,4,211,0,127,3,233,0,43,
+6,160,0,25,5,141,0,37,5,240,0,115,4,158,0,113,5,141,0,0,4,176,0,8,5,141,0,
+0,4,176,0,8,9,213,0,115,8,86,0,113,6,66,0,115,5,25,0,113,7,219,0,119,6,80,
+0,104,7,219,0,117,6,129,0,0,4,233,0,117,3,240,0,113,4,223,0,104,4,117,0,201,
+4,158,0,244,4,158,1,225,4,158,1,225,7,233,0,41,7,166,0,41,6,109,0,78,5,129,
+0,47,4,213,0,78,4,195,0,47,4,213,0,78,4,233,0,27,4,125,0,47,3,170,0,47,5,
+68,0,78,4,100,0,47,8,72,0,0,7,92,0,6,4,211,0,92,3,233,0,82,5,238,0,78,5,35,
+0,37,5,215,0,78,5,41,0,37,5,154,0,78,4,236,0,37,6,72,0,41,5,170,0,41,6,88,
+0,78,5,129,0,47,7,6,0,78,6,63,0,47,8,111,0,78,7,25,0,47,5,236,0,115,4,252,
+0,113,4,233,0,117,3,240,0,113,4,231,0,41,4,96,0,41,5,0,255,246,4,162,0,8,
+5,0,255,246,4,162,0,8,5,170,0,16,4,229,0,10,7,37,0,41,6,133,0,41,6,12,0,43,
+5,31,0,31,6,12,0,43,5,31,0,31,6,12,0,78,5,31,0,47,6,119,0,20,5,29,0,20,6,
+119,0,20,5,29,0,20,2,240,0,78,7,213,0,0,7,10,0,6,5,141,0,78,4,229,0,37,5,
+158,0,0,5,6,0,0,6,68,0,78,5,111,0,47,6,88,0,78,5,129,0,47,6,12,0,43,5,31,
+0,31,7,129,0,78,6,76,0,47,2,240,0,78,5,164,0,0,4,129,0,102,5,164,0,0,4,129,
+0,102,7,156,0,0,6,186,0,102,4,252,0,78,4,72,0,113,5,133,0,111,4,72,0,102,
+5,133,0,111,4,72,0,102,7,213,0,0,7,10,0,6,4,211,0,92,3,233,0,82,4,211,0,92,
+4,96,0,82,6,109,0,78,5,129,0,47,6,109,0,78,5,129,0,47,5,240,0,115,4,158,0,
+113,5,240,0,115,4,158,0,113,5,240,0,115,4,158,0,113,4,231,0,92,3,238,0,82,
+5,92,0,0,4,133,0,8,5,92,0,0,4,133,0,8,5,92,0,0,4,133,0,8,6,12,0,43,5,31,0,
+31,4,125,0,78,3,170,0,47,7,66,0,78,6,156,0,47,4,125,0,47,3,170,0,47,5,72,
+0,16,4,160,0,10,5,72,0,16,4,160,0,10,4,213,0,80,4,233,0,113,7,0,0,80,7,33,
+0,113,7,78,0,61,6,74,0,37,5,16,0,61,4,4,0,37,7,201,0,0,7,39,0,0,8,131,0,78,
+7,162,0,47,5,244,0,117,5,8,0,113,6,20,0,41,5,164,0,41,4,190,0,115,3,205,0,
+102,5,158,0,0,5,6,0,0,5,164,0,0,4,129,0,102,5,164,0,0,4,129,0,102,5,164,0,
+0,4,129,0,102,5,164,0,0,4,129,0,20,5,164,0,0,4,129,0,102,5,164,0,0,4,129,
+0,102,5,164,0,0,4,129,0,102,5,164,0,0,4,129,0,102,5,164,0,0,4,129,0,102,5,
+164,0,0,4,129,0,102,5,164,0,0,4,129,0,102,5,164,0,0,4,129,0,102,4,252,0,78,
+4,72,0,113,4,252,0,78,4,72,0,113,4,252,0,78,4,72,0,113,4,252,0,78,4,72,0,
+113,4,252,0,78,4,72,0,14,4,252,0,78,4,72,0,113,4,252,0,78,4,72,0,113,4,252,
+0,78,4,72,0,113,2,240,0,78,2,143,0,47,2,240,0,78,2,143,0,47,5,240,0,115,4,
+158,0,113,5,240,0,115,4,158,0,113,5,240,0,115,4,158,0,113,5,240,0,115,4,158,
+0,43,5,240,0,115,4,158,0,113,5,240,0,115,4,158,0,113,5,240,0,115,4,158,0,
+113,6,57,0,115,4,219,0,113,6,57,0,115,4,219,0,113,6,57,0,115,4,219,0,113,
+6,57,0,115,4,219,0,113,6,57,0,115,4,219,0,113,5,188,0,31,5,20,0,47,5,188,
+0,31,5,20,0,47,6,57,0,31,5,104,0,47,6,57,0,31,5,104,0,47,6,57,0,31,5,104,
+0,47,6,57,0,31,5,104,0,47,6,57,0,31,5,104,0,47,5,0,255,246,4,133,0,8,5,0,
+255,246,4,133,0,8,5,0,255,246,4,133,0,8,4,233,0,113,0,0,251,219,0,0,252,115,
+0,0,251,137,0,0,252,115,0,0,252,100,0,0,252,129,0,0,252,129,0,0,252,129,0,
+0,252,104,1,164,0,35,1,164,0,6,4,231,0,41,2,209,0,39,4,233,0,35,5,217,0,20,
+4,213,0,78,4,233,0,37,4,166,0,31,4,213,0,16,4,231,0,92,4,233,0,117,3,240,
+0,113,5,209,0,78,6,111,0,20,4,213,0,80,4,233,0,113,4,158,0,113,4,252,0,86,
+5,133,0,111,4,190,0,115,4,184,255,233,5,182,0,117,5,102,0,0,7,74,0,37,2,240,
+0,78,2,240,0,41,5,154,0,78,4,174,0,37,2,123,0,20,4,72,0,16,8,111,0,31,6,27,
+0,39,5,41,0,57,5,240,0,115,8,209,0,115,6,203,0,113,5,115,0,20,4,233,0,37,
+5,63,0,78,4,90,0,104,3,156,0,90,4,215,0,47,2,102,255,125,2,209,0,39,5,6,0,
+20,2,209,0,39,4,231,0,41,6,6,0,86,5,123,0,31,5,31,255,246,4,236,0,8,4,188,
+0,74,4,23,0,86,4,211,0,92,4,211,0,125,4,96,0,113,3,233,0,43,4,113,0,102,4,
+119,0,66,3,215,0,66,3,113,0,49,4,233,0,27,4,104,1,233,4,104,1,33,4,104,0,
+102,2,170,0,211,10,141,0,78,9,231,0,78,9,0,0,113,7,215,0,78,7,98,0,78,4,225,
+0,27,8,246,0,78,8,129,0,78,7,143,0,57,5,164,0,0,4,129,0,102,2,240,0,75,2,
+143,0,28,5,240,0,115,4,158,0,113,5,188,0,31,5,20,0,47,5,188,0,31,5,20,0,47,
+5,188,0,31,5,20,0,47,5,188,0,31,5,20,0,47,5,188,0,31,5,20,0,47,4,72,0,102,
+5,164,0,0,4,129,0,102,5,164,0,0,4,129,0,102,7,156,0,0,6,186,0,102,5,182,0,
+117,4,78,0,47,5,182,0,117,4,78,0,47,5,154,0,78,4,174,0,37,5,240,0,115,4,158,
+0,113,5,240,0,115,4,158,0,113,4,211,0,92,4,96,0,82,10,141,0,78,9,231,0,78,
+9,0,0,113,5,182,0,117,4,78,0,47,8,131,0,78,5,141,0,37,6,27,0,78,5,41,0,57,
+5,164,0,0,4,129,0,86,5,164,0,0,4,129,0,102,4,252,0,78,4,72,0,78,4,252,0,78,
+4,72,0,113,2,240,255,162,2,143,255,113,2,240,0,78,2,143,0,20,5,240,0,115,
+4,158,0,113,5,240,0,115,4,158,0,113,5,63,0,78,3,197,0,53,5,63,0,78,3,197,
+0,68,5,188,0,31,5,20,0,47,5,188,0,31,5,20,0,47,4,211,0,92,4,29,0,25,6,88,
+0,78,5,20,0,37,6,61,0,78,4,233,0,113,5,57,0,115,4,158,0,113,4,188,0,74,4,
+23,0,86,5,164,0,0,4,129,0,102,4,252,0,78,4,72,0,113,5,240,0,115,4,158,0,113,
+5,240,0,115,4,158,0,113,5,240,0,115,4,158,0,113,5,240,0,115,4,158,0,113,5,
+0,255,246,4,133,0,8,3,35,0,37,5,209,0,57,3,8,0,18,7,88,0,113,7,88,0,113,5,
+164,0,0,4,233,0,117,3,240,0,113,4,252,0,78,4,231,0,41,3,156,0,92,4,6,0,86,
+3,244,0,74,3,84,0,37,5,59,0,41,5,188,0,20,5,102,0,2,4,252,0,78,4,72,0,113,
+2,219,255,233,2,102,255,231,6,119,0,115,4,233,0,113,5,63,0,41,3,197,0,20,
+5,0,255,246,4,133,0,0,4,129,0,88,4,233,0,113,4,233,0,37,4,233,0,37,3,240,
+0,72,4,35,0,113,4,233,0,113,5,2,0,113,4,72,0,102,4,72,0,102,5,164,0,102,3,
+205,0,102,3,233,0,82,4,215,0,82,4,113,0,113,2,102,255,231,4,233,0,113,4,233,
+0,113,4,174,0,113,4,162,0,8,4,178,255,231,5,20,0,57,5,20,0,37,5,20,0,37,2,
+143,0,20,2,172,0,201,2,164,0,47,2,238,0,10,2,205,0,10,2,152,0,25,5,45,0,27,
+7,143,0,57,7,143,0,57,7,143,0,57,5,41,255,102,5,41,0,57,5,78,0,57,4,158,0,
+113,6,82,0,113,6,37,0,113,5,147,0,113,3,197,0,31,3,197,0,31,3,197,0,31,3,
+197,0,68,3,197,0,68,3,156,0,47,3,156,0,31,4,135,0,47,4,135,0,47,3,156,0,92,
+2,172,255,106,2,147,255,231,2,172,255,113,2,172,255,129,2,209,0,47,2,209,
+0,39,5,20,0,20,4,174,0,74,4,190,0,37,4,162,0,6,6,229,0,2,4,133,0,0,4,129,
+0,10,4,23,0,86,4,23,0,86,4,96,0,82,4,96,0,82,3,225,0,66,3,225,0,94,3,225,
+0,66,3,240,0,113,5,240,0,115,4,195,0,47,4,113,0,113,4,174,0,113,5,129,0,47,
+2,102,255,127,4,174,255,254,3,248,0,47,5,2,0,113,3,225,0,66,3,225,0,94,7,
+176,0,113,7,156,0,113,7,176,0,113,5,197,0,39,4,106,0,39,6,70,0,39,7,55,0,
+55,5,115,0,27,5,66,0,27,4,119,0,10,4,55,0,98,5,242,0,31,5,242,0,31,3,152,
+0,29,3,152,0,29,1,221,255,227,2,182,0,59,2,182,0,23,2,182,0,25,3,47,0,39,
+4,188,0,0,3,31,0,2,1,102,0,53,2,231,0,53,2,0,0,115,2,0,0,115,0,246,0,0,0,
+246,0,0,2,88,0,39,2,88,0,59,2,46,0,62,2,46,0,62,2,46,0,15,2,46,0,15,0,206,
+0,43,1,185,0,22,1,185,0,24,0,206,0,43,2,132,0,25,1,185,0,24,1,185,0,22,1,
+174,0,35,1,174,0,35,1,74,0,42,1,74,0,42,1,188,0,25,1,188,0,25,1,188,0,25,
+2,14,0,25,0,0,254,242,1,188,0,15,3,53,0,2,1,205,0,20,2,178,0,80,3,53,0,4,
+2,217,0,82,3,33,0,68,3,33,0,68,3,33,0,68,3,33,0,68,3,33,0,68,3,33,0,182,3,
+33,0,182,4,158,1,33,3,64,255,246,3,154,0,61,2,46,0,15,2,46,0,15,2,46,0,62,
+2,46,0,62,1,185,0,22,3,38,0,22,3,38,0,22,3,2,0,20,2,74,0,166,1,124,0,20,1,
+124,0,20,1,124,0,20,1,124,0,20,3,216,0,35,3,216,0,35,3,176,0,30,0,0,252,130,
+0,0,254,216,0,0,254,94,0,0,254,226,0,0,255,140,0,0,254,214,0,0,252,195,0,
+0,255,11,0,0,254,210,0,0,252,126,0,0,255,199,0,0,255,51,0,0,254,225,0,0,254,
+225,0,0,255,89,0,0,255,89,0,0,255,89,0,0,255,89,0,0,255,58,0,0,255,58,0,0,
+255,100,0,0,255,100,0,0,254,229,0,0,255,66,0,0,255,133,0,0,255,59,0,0,255,
+59,0,0,255,59,0,0,254,215,0,0,254,144,0,0,0,0,0,0,254,214,0,0,255,29,0,0,
+255,139,0,0,255,44,0,0,255,38,0,0,255,197,0,0,254,143,0,0,254,184,0,0,254,
+209,0,0,254,209,0,0,254,225,0,0,254,225,0,0,254,147,0,0,254,215,3,51,255,
+236,3,51,255,236,0,0,254,148,0,0,254,154,0,0,253,133,0,0,254,174,0,0,254,
+94,0,0,255,133,0,0,254,143,0,0,255,68,0,0,254,184,0,0,255,78,0,0,255,125,
+0,0,254,82,0,0,254,253,0,0,255,120,0,0,254,148,0,0,255,136,0,0,254,199,0,
+0,255,181,0,0,254,143,0,0,254,82,0,0,255,51,0,0,255,96,0,0,254,147,0,0,254,
+147,0,0,254,148,0,0,254,215,0,0,255,66,0,0,253,37,0,0,255,70,0,0,255,143,
+0,0,254,225,0,0,255,59,0,0,255,59,0,0,255,59,0,0,254,111,0,0,255,144,0,0,
+0,223,0,0,255,6,0,0,254,158,0,0,255,61,0,0,255,104,0,0,255,104,0,0,255,72,
+0,0,255,72,0,0,255,84,0,0,255,104,0,0,255,72,0,0,254,197,0,0,254,223,0,0,
+255,61,0,0,254,199,0,0,254,121,0,0,254,244,0,0,254,154,0,0,254,121,0,0,253,
+184,0,0,254,227,0,0,255,45,0,0,254,133,0,0,254,135,1,160,0,82,1,160,0,41,
+2,8,0,184,3,240,0,72,3,240,0,113,3,240,0,72,2,74,0,98,4,156,0,113,6,25,255,
+147,5,31,255,246,5,147,0,113,5,29,0,92,5,240,0,115,4,158,0,113,4,213,0,117,
+4,27,0,113,4,184,0,78,4,66,0,55,3,156,0,70,3,250,0,86,5,31,0,70,3,78,0,37,
+8,111,0,31,7,143,0,57,5,164,0,82,4,240,0,74,5,201,0,55,4,162,0,47,4,90,0,
+104,3,227,0,41,5,6,0,63,4,137,0,86,5,240,0,115,4,166,0,113,4,137,0,33,3,213,
+0,20,5,29,0,92,4,156,0,113,3,240,0,113,2,102,255,231,5,240,0,115,3,240,0,
+113,3,238,0,82,4,213,0,78,4,233,0,37,4,233,0,117,7,129,0,78,6,76,0,27,4,225,
+255,250,4,231,0,92,4,233,0,117,4,231,0,92,0,0,254,137,5,240,0,115,4,233,0,
+113,8,96,0,18,6,229,0,2,4,111,0,2,5,250,255,250,6,186,0,102,4,74,0,70,4,6,
+0,117,4,186,0,76,4,186,0,70,4,14,0,76,4,4,0,92,2,123,0,76,2,72,255,225,4,
+102,0,76,4,14,0,76,5,248,0,76,4,223,0,53,4,221,0,115,4,6,0,82,4,217,0,51,
+4,217,0,51,4,217,255,246,7,61,0,102,4,80,0,115,4,221,0,115,4,221,0,115,3,
+240,0,76,4,37,255,236,4,37,255,236,3,229,0,37,4,131,0,27,4,238,0,72,6,45,
+0,51,4,197,0,51,4,47,255,250,6,125,0,12,3,223,0,72,4,0,0,92,3,154,0,104,4,
+53,0,51,3,160,0,76,4,47,255,248,4,227,0,76,3,240,0,76,5,45,0,18,4,113,255,
+250,4,111,0,2,5,250,255,250,4,74,0,76,4,74,0,70,4,186,0,76,4,14,0,76,4,14,
+0,84,4,154,0,117,5,20,0,76,2,123,0,76,2,72,255,225,4,102,0,76,4,14,0,76,5,
+248,0,76,4,223,0,76,4,223,0,53,4,221,0,115,4,80,0,115,3,240,0,76,4,37,0,76,
+3,229,0,37,4,131,0,27,6,125,0,12,3,182,0,102,3,182,0,86,3,248,0,113,5,104,
+0,102,3,248,0,33,3,248,0,113,3,145,0,113,3,145,0,102,3,41,0,102,3,68,0,80,
+3,104,0,43,2,25,0,23,3,170,0,33,5,240,0,53,4,57,0,53,3,215,0,113,3,98,0,82,
+3,215,0,113,3,215,0,113,3,246,0,23,2,76,0,35,4,6,0,43,3,174,0,51,5,240,0,
+55,3,152,0,0,3,109,0,51,4,29,0,207,3,176,255,252,3,215,0,111,4,150,0,113,
+3,72,255,244,2,25,0,43,3,10,0,66,4,6,0,43,3,152,0,0,4,29,0,207,3,176,255,
+252,3,213,0,113,4,150,0,113,3,72,255,244,7,72,0,47,4,233,255,195,4,233,0,
+113,2,244,255,242,7,143,255,246,5,41,255,246,4,233,255,195,3,197,255,231,
+3,156,255,207,3,156,0,6,2,209,255,184,4,23,0,86,4,233,0,37,4,55,0,72,4,158,
+0,113,7,182,0,29,2,143,0,20,2,172,0,20,4,233,0,20,4,131,0,20,4,174,0,20,4,
+233,0,37,4,233,0,113,2,244,0,55,5,229,0,113,4,174,0,37,2,123,0,27,7,143,0,
+57,5,41,0,57,4,233,0,27,3,197,0,68,3,156,0,92,3,143,255,106,4,162,0,8,4,160,
+0,10,4,23,0,86,4,129,0,102,4,233,0,113,4,233,0,113,4,72,0,113,3,248,0,111,
+3,233,0,82,4,147,0,102,2,143,0,47,3,240,0,72,3,35,255,236,5,20,0,47,3,233,
+0,82,3,248,0,33,3,72,0,113,3,90,0,113,3,215,0,113,3,68,0,80,2,90,0,51,1,227,
+255,223,3,248,0,113,4,6,0,53,2,14,0,14,2,57,0,174,2,45,0,43,2,45,0,43,2,23,
+255,145,2,57,0,33,2,43,0,49,3,80,0,43,5,240,0,53,5,240,0,53,4,29,255,152,
+4,29,0,53,4,14,0,43,3,215,0,113,4,143,0,113,3,4,0,90,1,190,255,90,2,76,0,
+35,4,6,0,14,3,203,0,72,3,227,0,53,3,215,0,33,3,152,0,0,3,102,0,84,3,29,0,
+84,3,82,0,84,3,158,0,80,3,217,0,113,0,0,254,135,0,0,254,123,0,0,255,133,0,
+0,254,137,0,0,254,215,0,0,254,195,0,0,254,215,0,0,254,195,0,0,254,72,0,0,
+254,72,0,0,255,43,0,0,255,70,0,0,254,111,5,59,0,78,4,233,0,37,5,59,0,78,4,
+233,0,37,5,59,0,78,4,233,0,37,4,233,0,117,3,240,0,113,5,209,0,78,4,233,0,
+113,5,209,0,78,4,233,0,113,5,209,0,78,4,233,0,113,5,209,0,78,4,233,0,113,
+5,209,0,78,4,233,0,113,4,252,0,78,4,72,0,113,4,252,0,78,4,72,0,113,4,252,
+0,78,4,72,0,113,4,252,0,78,4,72,0,113,4,252,0,78,4,72,0,113,4,184,0,78,2,
+244,0,55,5,182,0,117,4,78,0,47,6,88,0,78,5,20,0,37,6,88,0,78,5,20,0,37,6,
+88,0,78,5,20,0,37,6,88,0,78,5,20,0,37,6,88,0,78,5,20,0,37,2,240,0,10,2,143,
+255,229,2,240,0,75,2,143,0,7,5,154,0,78,4,174,0,37,5,154,0,78,4,174,0,37,
+5,154,0,78,4,174,0,37,4,252,0,78,2,123,0,27,4,252,0,75,2,123,0,1,4,252,0,
+78,2,123,0,20,4,252,0,78,2,123,0,14,7,129,0,78,7,143,0,57,7,129,0,78,7,143,
+0,57,6,27,0,78,5,41,0,57,6,27,0,78,5,41,0,57,6,27,0,78,5,41,0,57,6,27,0,78,
+5,41,0,57,5,240,0,115,4,158,0,113,5,240,0,115,4,158,0,113,5,240,0,115,4,158,
+0,113,5,240,0,115,4,158,0,113,4,213,0,78,4,233,0,27,4,213,0,78,4,233,0,27,
+5,63,0,78,3,197,0,68,5,63,0,78,3,197,0,68,5,63,0,78,3,197,0,68,5,63,0,78,
+3,197,0,68,4,90,0,98,3,156,0,92,4,90,0,98,3,156,0,92,4,90,0,98,3,156,0,92,
+4,90,0,98,3,156,0,92,4,90,0,98,3,156,0,92,4,231,0,41,2,209,0,39,4,231,0,41,
+2,209,0,39,4,231,0,41,2,209,0,39,4,231,0,41,2,209,0,39,5,188,0,31,5,20,0,
+47,5,188,0,31,5,20,0,47,5,188,0,31,5,20,0,47,5,188,0,31,5,20,0,47,5,188,0,
+31,5,20,0,47,5,102,0,0,4,162,0,8,5,102,0,0,4,162,0,8,8,96,0,18,6,229,0,2,
+8,96,0,18,6,229,0,2,5,72,0,16,4,160,0,10,5,72,0,16,4,160,0,10,5,0,255,246,
+4,133,0,8,4,188,0,74,4,23,0,86,4,188,0,74,4,23,0,86,4,188,0,74,4,23,0,86,
+5,20,0,37,2,209,0,39,6,229,0,2,4,133,0,8,4,129,0,102,2,215,0,27,5,117,0,31,
+4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,
+227,0,113,4,227,0,113,5,164,0,0,5,164,0,0,5,207,255,175,5,197,255,175,5,176,
+255,176,5,186,255,175,5,180,255,175,5,170,255,175,3,248,0,111,3,248,0,111,
+3,248,0,111,3,248,0,111,3,248,0,111,3,248,0,111,5,160,255,175,5,143,255,175,
+6,182,255,175,6,172,255,175,6,213,255,176,6,223,255,175,4,215,0,147,4,215,
+0,147,4,215,0,147,4,215,0,147,4,215,0,147,4,215,0,147,4,215,0,147,4,215,0,
+147,6,252,255,175,6,236,255,175,8,18,255,175,8,8,255,175,8,49,255,176,8,59,
+255,175,8,2,255,175,7,248,255,175,2,172,0,190,2,172,0,190,2,172,0,19,2,172,
+0,13,2,172,0,65,2,172,0,21,2,172,255,214,2,172,255,193,3,147,255,175,3,131,
+255,175,4,170,255,175,4,160,255,175,4,201,255,176,4,211,255,175,4,154,255,
+175,4,154,255,175,4,158,0,113,4,158,0,113,4,158,0,113,4,158,0,113,4,158,0,
+113,4,158,0,113,6,4,255,175,6,70,255,175,7,109,255,175,7,98,255,175,7,6,255,
+176,7,16,255,175,4,190,0,37,4,190,0,37,4,190,0,37,4,190,0,37,4,190,0,37,4,
+190,0,37,4,190,0,37,4,190,0,37,5,250,255,175,7,23,255,175,7,84,255,175,7,
+27,255,175,6,37,0,113,6,37,0,113,6,37,0,113,6,37,0,113,6,37,0,113,6,37,0,
+113,6,37,0,113,6,37,0,113,6,47,255,175,6,113,255,175,7,152,255,175,7,141,
+255,175,7,49,255,176,7,59,255,175,7,33,255,175,7,63,255,175,4,227,0,113,4,
+227,0,113,3,248,0,111,3,248,0,111,4,215,0,147,4,215,0,147,2,172,0,125,2,172,
+0,201,4,158,0,113,4,158,0,113,4,190,0,37,4,190,0,37,6,37,0,113,6,37,0,113,
+4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,
+227,0,113,4,227,0,113,8,80,0,0,8,80,0,0,8,123,255,175,8,113,255,175,8,92,
+255,176,8,102,255,175,8,96,255,175,8,86,255,175,4,215,0,147,4,215,0,147,4,
+215,0,147,4,215,0,147,4,215,0,147,4,215,0,147,4,215,0,147,4,215,0,147,9,168,
+255,175,9,152,255,175,10,190,255,175,10,180,255,175,10,221,255,176,10,231,
+255,175,10,174,255,175,10,164,255,175,6,37,0,113,6,37,0,113,6,37,0,113,6,
+37,0,113,6,37,0,113,6,37,0,113,6,37,0,113,6,37,0,113,8,219,255,175,9,29,255,
+175,10,68,255,175,10,57,255,175,9,221,255,176,9,231,255,175,9,205,255,175,
+9,236,255,175,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,
+4,227,0,113,4,227,0,113,5,164,0,0,5,164,0,0,5,164,0,0,5,164,0,0,8,80,0,0,
+2,8,0,131,2,8,0,184,2,8,0,131,4,158,0,225,4,158,0,225,4,215,0,147,4,215,0,
+147,4,215,0,147,4,215,0,147,4,215,0,147,5,137,255,175,5,172,255,175,6,229,
+255,175,7,8,255,175,9,4,0,78,3,51,0,131,3,51,0,152,3,51,0,45,2,172,0,15,2,
+172,0,5,2,172,255,204,2,172,255,204,2,172,255,193,2,172,255,193,2,240,0,78,
+2,240,0,78,3,125,255,175,3,160,255,175,3,51,0,141,3,51,0,141,3,51,0,55,4,
+190,0,37,4,190,0,37,4,190,0,37,4,190,0,37,4,225,0,180,4,225,0,180,4,190,0,
+37,4,190,0,37,5,0,255,246,5,0,255,246,5,223,255,175,6,23,255,175,5,104,255,
+175,4,158,0,236,4,158,0,236,2,8,0,92,6,37,0,113,6,37,0,113,6,37,0,113,6,37,
+0,113,6,37,0,113,6,63,255,175,6,23,255,175,6,106,255,175,6,66,255,175,8,178,
+0,86,2,8,0,160,2,8,0,147,0,0,255,213,0,0,255,33,0,0,255,215,0,0,254,76,4,
+121,0,82,4,121,1,101,3,154,0,115,0,0,255,215,0,0,254,78,0,0,255,18,0,0,255,
+18,0,0,255,18,1,154,0,0,3,172,255,246,2,76,0,166,0,0,255,18,0,0,255,18,0,
+0,255,16,0,0,255,16,0,0,255,16,0,0,255,18,3,37,0,66,3,47,0,96,3,49,0,80,3,
+182,0,102,3,145,0,113,3,215,0,113,3,152,0,4,3,145,0,102,5,76,0,92,4,233,0,
+117,4,233,0,117,7,143,0,57,5,78,0,20,8,43,0,78,8,96,0,18,5,51,0,20,4,121,
+0,37,8,0,0,41,4,121,255,240,4,213,0,20,5,182,0,117,5,164,0,0,4,90,0,20,4,
+233,0,117,4,121,0,121,0,0,254,29,6,195,0,113,6,12,0,25,3,219,0,86,6,184,0,
+21,6,184,0,36,3,240,0,72,8,0,1,162,4,0,1,16,8,0,1,162,4,0,1,16,8,0,1,162,
+4,0,1,16,4,0,1,16,0,127,254,143,2,74,0,166,7,213,1,152,5,193,1,23,4,170,0,
+100,4,213,0,158,4,172,0,100,4,213,2,35,4,213,1,4,5,170,255,246,5,0,1,215,
+5,170,2,141,5,170,255,246,5,170,2,141,5,170,255,246,5,170,2,141,5,170,255,
+246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,1,217,5,
+170,2,141,5,170,1,217,5,170,1,217,5,170,255,246,5,170,255,246,5,170,255,246,
+5,170,2,141,5,170,1,217,5,170,1,217,5,170,255,246,5,170,255,246,5,170,255,
+246,5,170,2,141,5,170,1,217,5,170,1,217,5,170,255,246,5,170,255,246,5,170,
+255,246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,255,
+246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,255,246,5,170,0,0,5,170,
+0,0,5,170,0,0,5,170,0,0,5,170,2,213,5,170,0,102,5,170,0,0,5,213,0,0,4,213,
+0,123,4,213,0,6,2,213,0,109,2,213,0,109,8,0,0,0,7,236,1,158,7,236,1,145,7,
+236,1,158,7,236,1,145,4,213,0,168,4,193,0,98,4,213,0,178,4,213,0,41,4,213,
+0,41,2,213,0,115,8,43,1,176,8,106,1,209,7,86,1,70,6,0,1,217,6,0,1,82,4,63,
+0,59,5,63,0,59,4,193,0,102,4,20,0,66,4,0,0,197,6,0,1,16,4,104,0,102,4,190,
+0,20,2,123,0,20,4,252,0,8,4,213,0,78,5,43,0,57,4,129,0,102,2,209,0,39,6,88,
+0,78,5,20,0,37,5,154,0,78,4,174,0,37,4,188,0,74,4,23,0,86,6,119,0,115,4,176,
+0,8,8,172,0,18,7,51,0,2,4,139,0,41,4,59,0,78,3,207,0,47,5,147,0,113,3,70,
+0,12,0,0,255,152,0,0,255,152,0,0,254,215,0,0,254,229,3,47,0,143,3,47,0,143,
+2,170,0,211,2,170,0,211,2,170,0,211,0,0,254,229,0,0,254,229,4,0,0,210,2,76,
+0,166,3,156,0,102,2,170,0,221,2,170,0,221,5,135,0,86,4,47,255,164,7,213,1,
+117,4,80,0,53,4,121,0,111,4,158,1,35,4,158,1,31,4,121,0,133,0,0,252,233,0,
+0,255,254,0,0,252,238,0,0,255,250,4,86,0,160,4,86,0,160,4,86,0,160,4,86,0,
+160,4,86,0,78,4,86,0,82,4,86,0,78,4,86,0,78,4,86,0,70,3,16,0,70,4,86,0,53,
+4,86,0,53,4,86,0,80,4,86,0,45,4,86,0,72,3,16,0,45,4,86,0,37,4,86,0,37,4,86,
+0,37,4,86,0,39,4,86,0,47,3,16,0,37,4,86,0,29,4,86,0,23,4,86,0,53,4,86,0,53,
+4,86,0,47,3,16,0,41,4,86,0,80,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,94,3,16,
+0,76,4,86,0,160,4,86,0,160,4,86,0,160,4,86,0,160,4,86,0,80,4,86,0,76,4,86,
+0,70,4,86,0,76,4,86,0,76,3,16,0,76,4,86,0,47,4,86,0,57,4,86,0,63,4,86,0,63,
+4,86,0,63,3,16,0,63,4,86,0,53,4,86,0,53,4,86,0,53,4,86,0,53,4,86,0,53,3,16,
+0,53,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,76,3,16,0,104,4,86,0,
+76,4,86,0,70,4,86,0,76,4,86,0,76,4,86,0,76,3,16,0,76,4,86,0,160,4,86,0,160,
+4,86,0,160,4,86,0,160,4,86,0,86,4,86,0,86,4,86,0,88,4,86,0,86,4,86,0,86,3,
+16,0,92,4,86,0,55,4,86,0,55,4,86,0,55,4,86,0,55,4,86,0,55,3,16,0,55,4,86,
+0,72,4,86,0,70,4,86,0,70,4,86,0,70,4,86,0,70,3,16,0,70,4,86,0,129,4,86,0,
+129,4,86,0,57,4,86,0,57,4,86,0,57,3,16,0,57,4,86,0,145,4,86,0,145,4,86,0,
+145,4,86,0,145,4,86,0,145,3,16,0,76,4,86,0,160,4,86,0,160,4,86,0,160,4,86,
+0,160,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,76,4,86,0,80,3,16,0,80,4,86,0,
+47,4,86,0,53,4,86,0,53,4,86,0,23,4,86,0,29,3,16,0,41,4,86,0,47,4,86,0,39,
+4,86,0,37,4,86,0,37,4,86,0,37,3,16,0,37,4,86,0,72,4,86,0,45,4,86,0,80,4,86,
+0,53,4,86,0,53,3,16,0,45,4,86,0,70,4,86,0,78,4,86,0,78,4,86,0,82,4,86,0,78,
+3,16,0,70,4,86,0,160,4,86,0,160,4,86,0,160,4,86,0,160,4,227,0,113,4,227,0,
+113,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,4,227,0,113,
+2,172,0,5,2,172,0,5,2,172,0,3,2,172,0,5,2,172,0,15,2,172,255,255,2,172,0,
+15,2,172,0,13,4,190,0,37,4,190,0,37,4,190,0,37,4,190,0,37,4,190,0,37,4,190,
+0,37,4,190,0,37,4,190,0,37,2,172,0,3,2,172,0,3,2,172,0,3,2,172,0,3,4,190,
+0,37,4,190,0,37,4,190,0,37,4,190,0,37,6,61,0,78,6,88,0,78,6,61,0,78,4,199,
+0,180,4,0,0,215,4,0,0,215,4,0,0,213,4,0,0,215,4,158,1,10,4,158,1,33,4,0,0,
+213,4,158,0,225,4,213,1,2,4,158,0,225,4,0,0,215,4,0,0,215,4,158,1,23,4,158,
+1,35,4,0,0,147,4,0,0,215,4,213,2,33,4,0,0,213,4,0,0,213,4,0,0,213,4,0,0,213,
+4,0,0,225,4,0,0,223,4,0,0,225,4,0,0,225,7,207,0,0,6,233,0,0,6,233,0,78,6,
+147,0,27,7,66,255,233,6,156,0,16,5,154,0,78,4,236,0,37,7,180,0,0,6,199,0,
+0,8,172,0,78,7,66,0,47,6,27,0,78,5,88,0,47,6,12,0,78,5,31,0,37,4,121,0,33,
+1,129,0,41,3,2,0,41,4,131,0,41,0,0,0,1,0,3,0,1,0,0,0,12,0,4,6,86,0,0,1,96,
+1,0,0,7,0,96,0,0,0,13,0,126,1,97,1,99,1,127,1,145,1,146,1,159,1,161,1,174,
+1,176,1,239,1,240,1,249,1,255,2,23,2,27,2,54,2,55,2,187,2,188,2,197,2,201,
+2,215,2,221,2,242,2,243,2,255,3,3,3,14,3,15,3,34,3,35,3,111,3,117,3,126,3,
+138,3,140,3,161,3,206,3,214,3,255,4,0,4,12,4,13,4,79,4,80,4,92,4,95,4,134,
+4,145,5,19,5,29,5,39,29,202,30,1,30,61,30,63,30,127,30,133,30,155,30,158,
+30,241,30,243,30,249,31,21,31,29,31,69,31,77,31,87,31,89,31,91,31,93,31,125,
+31,180,31,196,31,211,31,219,31,239,31,244,31,254,32,11,32,15,32,34,32,38,
+32,47,32,48,32,52,32,58,32,60,32,62,32,68,32,94,32,112,32,121,32,127,32,148,
+32,169,32,172,32,181,32,186,32,240,33,5,33,19,33,23,33,34,33,38,33,46,33,
+78,33,84,33,94,33,132,33,149,33,168,34,2,34,6,34,15,34,18,34,21,34,26,34,
+31,34,41,34,43,34,72,34,97,34,101,35,2,35,16,35,33,37,0,37,2,37,12,37,16,
+37,20,37,24,37,28,37,36,37,44,37,52,37,60,37,108,37,128,37,132,37,136,37,
+140,37,147,37,161,37,172,37,178,37,186,37,188,37,196,37,204,37,207,37,217,
+37,230,38,60,38,64,38,66,38,96,38,99,38,102,38,107,38,111,41,245,44,109,44,
+119,46,23,167,33,167,140,251,4,254,35,254,255,255,253,255,255,0,0,0,0,0,13,
+0,32,0,160,1,98,1,100,1,128,1,146,1,147,1,160,1,162,1,175,1,177,1,240,1,241,
+1,250,2,0,2,24,2,28,2,55,2,56,2,188,2,189,2,198,2,202,2,216,2,222,2,243,2,
+244,3,0,3,4,3,15,3,16,3,35,3,36,3,116,3,122,3,132,3,140,3,142,3,163,3,208,
+3,215,4,0,4,1,4,13,4,14,4,80,4,81,4,93,4,96,4,135,4,146,5,20,5,30,29,0,29,
+254,30,2,30,62,30,64,30,128,30,134,30,158,30,160,30,242,30,244,31,0,31,24,
+31,32,31,72,31,80,31,89,31,91,31,93,31,95,31,128,31,182,31,198,31,214,31,
+221,31,242,31,246,32,0,32,12,32,18,32,38,32,42,32,48,32,50,32,57,32,60,32,
+62,32,68,32,94,32,106,32,116,32,127,32,144,32,160,32,171,32,173,32,185,32,
+240,33,5,33,19,33,22,33,34,33,38,33,46,33,77,33,83,33,91,33,132,33,144,33,
+168,34,2,34,6,34,15,34,17,34,21,34,25,34,30,34,41,34,43,34,72,34,96,34,100,
+35,2,35,16,35,32,37,0,37,2,37,12,37,16,37,20,37,24,37,28,37,36,37,44,37,52,
+37,60,37,80,37,128,37,132,37,136,37,140,37,144,37,160,37,170,37,178,37,186,
+37,188,37,196,37,202,37,207,37,216,37,230,38,58,38,64,38,66,38,96,38,99,38,
+101,38,106,38,111,41,245,44,96,44,113,46,23,167,23,167,136,251,1,254,32,254,
+255,255,252,255,255,0,1,255,245,255,227,255,194,2,26,255,194,1,254,255,176,
+1,253,0,186,1,251,0,173,1,249,0,92,1,248,255,73,1,242,0,0,1,238,255,254,1,
+237,255,145,1,236,0,0,1,233,254,118,1,227,255,99,1,226,0,0,1,223,0,98,1,222,
+255,63,1,221,1,217,1,213,253,208,253,207,253,206,253,205,0,0,1,129,254,99,
+253,155,254,87,253,154,254,21,253,153,0,0,254,7,0,0,254,4,0,0,4,66,232,134,
+0,0,232,81,228,19,232,79,227,122,232,73,232,71,228,120,227,14,228,118,231,
+230,231,228,231,226,231,224,231,222,231,221,231,220,231,219,231,218,231,216,
+231,215,231,214,231,212,231,211,231,209,231,208,226,61,231,195,0,0,225,234,
+231,172,225,225,233,57,225,217,225,216,231,158,225,209,231,127,231,116,0,
+0,225,151,231,87,0,0,0,0,231,70,0,0,231,13,225,22,225,9,0,0,224,252,224,249,
+224,242,230,178,230,174,224,198,230,127,230,116,230,98,224,35,224,32,224,
+24,224,23,229,246,0,0,0,0,229,229,224,1,223,229,0,0,223,203,229,14,229,1,
+228,242,227,20,227,19,227,10,227,7,227,4,227,1,226,254,226,247,226,240,226,
+233,226,226,226,207,226,188,226,185,226,182,226,179,226,176,226,164,226,156,
+226,151,226,144,226,143,226,136,0,0,226,128,226,120,226,108,226,25,226,22,
+226,21,225,248,225,246,225,245,225,242,225,239,216,96,219,255,219,252,218,
+93,97,94,96,248,0,0,10,109,3,74,2,78,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,62,0,0,0,0,0,0,0,0,0,0,1,58,0,0,0,0,
+0,0,0,0,0,0,1,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,38,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,36,0,0,1,38,0,0,1,56,0,0,0,0,1,70,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,34,0,0,0,0,
+1,40,1,58,0,0,1,58,0,0,0,0,0,0,1,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,28,1,30,0,0,0,0,0,0,1,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,200,0,0,0,0,0,0,0,0,1,73,1,74,1,36,1,37,1,75,1,76,4,178,1,77,2,94,
+2,95,4,226,2,96,5,84,2,78,2,79,5,85,5,86,5,87,2,80,2,102,1,246,1,247,5,129,
+2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,1,248,1,249,9,90,9,91,9,92,
+9,93,9,94,9,95,5,130,5,131,5,132,5,133,6,81,6,82,2,83,2,84,7,211,2,2,2,3,
+2,4,7,212,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,7,213,2,13,2,14,2,15,2,57,2,
+58,7,229,2,59,2,60,7,230,7,236,7,237,7,238,2,23,2,24,7,239,7,240,2,25,7,241,
+7,242,3,112,2,26,7,252,9,106,2,29,7,254,8,12,2,42,2,43,8,13,2,46,8,15,2,49,
+8,77,8,78,2,50,2,51,2,88,2,89,0,0,0,0,0,0,0,0,0,40,0,0,0,40,0,0,0,40,0,0,
+0,40,0,0,0,118,0,0,0,160,0,0,1,17,0,0,1,221,0,0,2,203,0,0,3,215,0,0,3,241,
+0,0,4,60,0,0,4,135,0,0,4,213,0,0,5,5,0,0,5,79,0,0,5,104,0,0,5,167,0,0,5,193,
+0,0,6,62,0,0,6,153,0,0,7,39,0,0,7,233,0,0,8,99,0,0,8,253,0,0,9,164,0,0,9,
+213,0,0,10,174,0,0,11,92,0,0,11,206,0,0,12,77,0,0,12,116,0,0,12,156,0,0,12,
+194,0,0,13,99,0,0,14,145,0,0,15,35,0,0,15,205,0,0,16,87,0,0,16,206,0,0,17,
+69,0,0,17,180,0,0,18,87,0,0,19,9,0,0,19,98,0,0,19,185,0,0,20,111,0,0,20,209,
+0,0,21,110,0,0,21,238,0,0,22,107,0,0,22,240,0,0,23,139,0,0,24,51,0,0,24,222,
+0,0,25,72,0,0,25,218,0,0,26,92,0,0,27,13,0,0,27,233,0,0,28,153,0,0,28,240,
+0,0,29,43,0,0,29,69,0,0,29,128,0,0,29,168,0,0,29,195,0,0,29,246,0,0,30,166,
+0,0,31,94,0,0,31,212,0,0,32,132,0,0,33,3,0,0,33,138,0,0,34,207,0,0,35,112,
+0,0,35,239,0,0,36,106,0,0,37,23,0,0,37,98,0,0,38,72,0,0,38,226,0,0,39,81,
+0,0,40,28,0,0,40,222,0,0,41,100,0,0,42,20,0,0,42,116,0,0,42,253,0,0,43,138,
+0,0,44,72,0,0,45,21,0,0,45,189,0,0,46,18,0,0,46,137,0,0,46,163,0,0,47,24,
+0,0,47,135,0,0,47,135,0,0,47,214,0,0,48,97,0,0,49,60,0,0,49,227,0,0,50,177,
+0,0,50,215,0,0,51,231,0,0,52,82,0,0,53,91,0,0,53,253,0,0,54,65,0,0,54,97,
+0,0,54,113,0,0,55,149,0,0,55,176,0,0,56,35,0,0,56,96,0,0,56,220,0,0,57,133,
+0,0,57,184,0,0,58,82,0,0,58,195,0,0,59,3,0,0,59,81,0,0,59,175,0,0,60,0,0,
+0,60,69,0,0,60,101,0,0,60,133,0,0,60,165,0,0,61,70,0,0,61,94,0,0,61,118,0,
+0,61,142,0,0,61,166,0,0,61,190,0,0,61,214,0,0,62,139,0,0,62,163,0,0,62,187,
+0,0,62,211,0,0,62,235,0,0,63,3,0,0,63,27,0,0,63,51,0,0,63,75,0,0,63,99,0,
+0,63,240,0,0,64,8,0,0,64,32,0,0,64,56,0,0,64,80,0,0,64,104,0,0,64,128,0,0,
+64,194,0,0,65,101,0,0,65,125,0,0,65,149,0,0,65,173,0,0,65,197,0,0,65,221,
+0,0,66,113,0,0,67,81,0,0,67,103,0,0,67,125,0,0,67,147,0,0,67,169,0,0,67,191,
+0,0,67,215,0,0,68,209,0,0,68,233,0,0,68,255,0,0,69,21,0,0,69,43,0,0,69,65,
+0,0,69,89,0,0,69,113,0,0,69,137,0,0,69,161,0,0,70,71,0,0,70,93,0,0,70,115,
+0,0,70,137,0,0,70,159,0,0,70,181,0,0,70,203,0,0,71,73,0,0,71,224,0,0,71,246,
+0,0,72,14,0,0,72,36,0,0,72,58,0,0,72,80,0,0,73,36,0,0,73,58,0,0,73,82,0,0,
+73,104,0,0,73,128,0,0,73,150,0,0,73,174,0,0,73,198,0,0,73,222,0,0,73,244,
+0,0,74,12,0,0,74,34,0,0,74,58,0,0,74,82,0,0,74,106,0,0,74,128,0,0,74,152,
+0,0,74,176,0,0,74,192,0,0,75,127,0,0,75,151,0,0,75,173,0,0,75,197,0,0,75,
+219,0,0,75,243,0,0,76,11,0,0,76,35,0,0,76,57,0,0,76,81,0,0,76,103,0,0,76,
+127,0,0,76,149,0,0,76,173,0,0,76,195,0,0,76,219,0,0,76,243,0,0,77,11,0,0,
+77,33,0,0,77,57,0,0,77,81,0,0,78,33,0,0,78,211,0,0,78,235,0,0,79,3,0,0,79,
+27,0,0,79,51,0,0,79,75,0,0,79,99,0,0,79,123,0,0,79,147,0,0,79,171,0,0,79,
+246,0,0,80,14,0,0,80,38,0,0,80,62,0,0,80,86,0,0,80,110,0,0,80,132,0,0,81,
+49,0,0,81,73,0,0,81,97,0,0,81,121,0,0,81,145,0,0,81,169,0,0,81,191,0,0,81,
+215,0,0,81,239,0,0,82,108,0,0,82,205,0,0,82,229,0,0,82,253,0,0,83,21,0,0,
+83,45,0,0,83,69,0,0,83,91,0,0,83,115,0,0,84,17,0,0,84,182,0,0,84,206,0,0,
+84,228,0,0,84,252,0,0,85,18,0,0,85,42,0,0,85,64,0,0,85,249,0,0,86,206,0,0,
+86,230,0,0,86,252,0,0,87,20,0,0,87,44,0,0,87,68,0,0,87,92,0,0,87,116,0,0,
+87,138,0,0,87,162,0,0,87,184,0,0,87,208,0,0,87,230,0,0,87,254,0,0,88,20,0,
+0,88,42,0,0,88,64,0,0,88,88,0,0,88,112,0,0,88,241,0,0,89,99,0,0,89,123,0,
+0,89,145,0,0,89,169,0,0,89,191,0,0,89,215,0,0,89,237,0,0,90,5,0,0,90,29,0,
+0,90,53,0,0,90,77,0,0,90,101,0,0,90,125,0,0,90,149,0,0,90,173,0,0,90,197,
+0,0,90,219,0,0,90,243,0,0,91,11,0,0,91,33,0,0,91,57,0,0,91,81,0,0,91,105,
+0,0,91,127,0,0,91,231,0,0,92,120,0,0,93,136,0,0,94,197,0,0,94,221,0,0,94,
+245,0,0,95,13,0,0,95,35,0,0,95,57,0,0,95,79,0,0,95,150,0,0,95,229,0,0,96,
+0,0,0,96,62,0,0,96,126,0,0,96,242,0,0,97,76,0,0,97,171,0,0,98,10,0,0,98,65,
+0,0,98,189,0,0,98,213,0,0,99,21,0,0,99,47,0,0,99,73,0,0,99,99,0,0,99,123,
+0,0,99,149,0,0,99,173,0,0,99,197,0,0,99,213,0,0,99,229,0,0,100,72,0,0,100,
+88,0,0,100,104,0,0,100,120,0,0,100,136,0,0,101,80,0,0,101,96,0,0,101,112,
+0,0,101,241,0,0,102,1,0,0,102,17,0,0,102,206,0,0,102,222,0,0,103,102,0,0,
+103,118,0,0,103,214,0,0,103,230,0,0,103,246,0,0,104,218,0,0,104,234,0,0,105,
+184,0,0,106,102,0,0,106,126,0,0,106,150,0,0,106,172,0,0,106,194,0,0,106,216,
+0,0,106,240,0,0,107,6,0,0,107,170,0,0,108,117,0,0,109,31,0,0,109,226,0,0,
+110,175,0,0,111,92,0,0,111,217,0,0,112,99,0,0,112,165,0,0,113,62,0,0,113,
+204,0,0,113,220,0,0,114,93,0,0,115,108,0,0,115,124,0,0,116,35,0,0,116,162,
+0,0,117,55,0,0,117,178,0,0,118,38,0,0,118,163,0,0,119,30,0,0,119,181,0,0,
+120,62,0,0,121,17,0,0,121,41,0,0,121,63,0,0,121,85,0,0,121,107,0,0,121,131,
+0,0,121,155,0,0,122,89,0,0,122,113,0,0,123,4,0,0,123,20,0,0,123,36,0,0,123,
+60,0,0,123,76,0,0,124,44,0,0,125,13,0,0,125,209,0,0,125,233,0,0,126,1,0,0,
+126,165,0,0,126,181,0,0,127,70,0,0,127,86,0,0,127,102,0,0,128,0,0,0,128,16,
+0,0,129,162,0,0,130,94,0,0,131,18,0,0,131,42,0,0,132,34,0,0,132,212,0,0,132,
+228,0,0,132,244,0,0,133,4,0,0,133,20,0,0,133,36,0,0,133,52,0,0,133,68,0,0,
+133,237,0,0,133,253,0,0,134,13,0,0,134,165,0,0,135,84,0,0,136,7,0,0,136,197,
+0,0,137,86,0,0,138,47,0,0,138,184,0,0,139,67,0,0,140,20,0,0,140,194,0,0,140,
+210,0,0,141,118,0,0,142,29,0,0,142,127,0,0,143,36,0,0,143,52,0,0,144,185,
+0,0,145,94,0,0,146,20,0,0,146,42,0,0,147,25,0,0,147,197,0,0,148,102,0,0,149,
+26,0,0,149,42,0,0,149,178,0,0,149,194,0,0,149,210,0,0,150,61,0,0,150,77,0,
+0,151,13,0,0,151,29,0,0,151,184,0,0,152,104,0,0,153,25,0,0,153,225,0,0,154,
+110,0,0,155,67,0,0,155,200,0,0,156,72,0,0,157,13,0,0,157,187,0,0,157,209,
+0,0,158,139,0,0,158,161,0,0,159,37,0,0,159,53,0,0,159,69,0,0,159,93,0,0,159,
+109,0,0,160,65,0,0,161,30,0,0,161,46,0,0,161,70,0,0,161,92,0,0,162,0,0,0,
+162,100,0,0,162,200,0,0,162,224,0,0,162,248,0,0,163,16,0,0,163,40,0,0,163,
+64,0,0,163,88,0,0,163,112,0,0,163,134,0,0,163,161,0,0,163,188,0,0,163,215,
+0,0,163,254,0,0,164,72,0,0,164,147,0,0,164,221,0,0,165,38,0,0,165,175,0,0,
+166,56,0,0,166,192,0,0,167,20,0,0,167,167,0,0,167,231,0,0,168,142,0,0,169,
+229,0,0,170,13,0,0,170,54,0,0,170,78,0,0,170,103,0,0,170,246,0,0,171,115,
+0,0,172,100,0,0,173,56,0,0,173,233,0,0,174,189,0,0,175,98,0,0,176,54,0,0,
+177,21,0,0,177,37,0,0,177,176,0,0,177,208,0,0,177,240,0,0,178,16,0,0,178,
+48,0,0,178,242,0,0,179,53,0,0,179,189,0,0,180,30,0,0,180,57,0,0,180,100,0,
+0,181,35,0,0,181,203,0,0,182,146,0,0,182,218,0,0,183,13,0,0,183,64,0,0,183,
+119,0,0,184,32,0,0,184,199,0,0,185,14,0,0,185,85,0,0,185,132,0,0,185,179,
+0,0,185,226,0,0,186,77,0,0,186,220,0,0,187,17,0,0,187,214,0,0,187,214,0,0,
+187,214,0,0,187,214,0,0,187,214,0,0,187,214,0,0,187,214,0,0,187,214,0,0,187,
+214,0,0,187,214,0,0,187,214,0,0,187,214,0,0,187,214,0,0,187,214,0,0,189,210,
+0,0,190,136,0,0,190,160,0,0,190,176,0,0,191,137,0,0,192,78,0,0,193,75,0,0,
+193,99,0,0,193,123,0,0,193,147,0,0,193,171,0,0,193,197,0,0,194,52,0,0,194,
+195,0,0,195,214,0,0,196,231,0,0,197,88,0,0,197,189,0,0,198,48,0,0,198,172,
+0,0,198,190,0,0,198,208,0,0,198,226,0,0,199,26,0,0,199,58,0,0,199,82,0,0,
+199,106,0,0,199,128,0,0,199,150,0,0,200,19,0,0,200,136,0,0,201,19,0,0,201,
+124,0,0,202,18,0,0,202,153,0,0,203,18,0,0,203,140,0,0,204,58,0,0,204,221,
+0,0,205,129,0,0,206,37,0,0,206,252,0,0,207,206,0,0,208,138,0,0,209,51,0,0,
+209,67,0,0,209,83,0,0,209,212,0,0,210,63,0,0,210,162,0,0,211,9,0,0,211,33,
+0,0,211,57,0,0,211,255,0,0,212,180,0,0,213,47,0,0,213,156,0,0,214,102,0,0,
+215,47,0,0,215,212,0,0,216,112,0,0,216,217,0,0,217,34,0,0,217,123,0,0,217,
+177,0,0,217,231,0,0,218,18,0,0,218,61,0,0,219,43,0,0,219,246,0,0,220,157,
+0,0,221,68,0,0,221,164,0,0,222,4,0,0,222,117,0,0,223,1,0,0,223,92,0,0,223,
+180,0,0,224,61,0,0,224,187,0,0,225,167,0,0,226,135,0,0,226,159,0,0,226,183,
+0,0,227,79,0,0,227,226,0,0,228,134,0,0,229,32,0,0,229,193,0,0,230,86,0,0,
+230,241,0,0,231,133,0,0,232,1,0,0,232,127,0,0,232,255,0,0,233,125,0,0,234,
+23,0,0,234,167,0,0,235,66,0,0,235,205,0,0,235,229,0,0,235,253,0,0,236,80,
+0,0,236,174,0,0,236,190,0,0,237,60,0,0,237,196,0,0,238,83,0,0,238,248,0,0,
+239,157,0,0,240,15,0,0,240,138,0,0,241,1,0,0,241,118,0,0,241,249,0,0,242,
+119,0,0,242,227,0,0,243,78,0,0,243,192,0,0,244,46,0,0,244,175,0,0,245,46,
+0,0,245,62,0,0,245,86,0,0,245,110,0,0,246,16,0,0,246,169,0,0,247,31,0,0,247,
+146,0,0,248,13,0,0,248,141,0,0,249,13,0,0,249,142,0,0,250,3,0,0,250,120,0,
+0,250,248,0,0,251,119,0,0,251,135,0,0,251,159,0,0,251,181,0,0,251,205,0,0,
+251,227,0,0,251,243,0,0,252,3,0,0,252,27,0,0,252,49,0,0,252,142,0,0,252,225,
+0,0,252,249,0,0,253,15,0,0,253,39,0,0,253,63,0,0,253,87,0,0,253,109,0,0,253,
+211,0,0,254,58,0,0,254,82,0,0,254,106,0,0,254,130,0,0,254,152,0,0,254,176,
+0,0,254,198,0,0,255,41,0,0,255,120,0,0,255,144,0,0,255,166,0,0,255,190,0,
+0,255,212,0,0,255,236,0,1,0,2,0,1,0,26,0,1,0,48,0,1,0,72,0,1,0,94,0,1,0,118,
+0,1,0,140,0,1,0,217,0,1,1,41,0,1,1,65,0,1,1,89,0,1,1,113,0,1,1,137,0,1,1,
+161,0,1,1,185,0,1,2,101,0,1,3,15,0,1,3,108,0,1,3,124,0,1,4,2,0,1,4,138,0,
+1,5,13,0,1,5,135,0,1,5,240,0,1,6,83,0,1,6,215,0,1,7,87,0,1,7,229,0,1,8,114,
+0,1,8,222,0,1,9,66,0,1,9,169,0,1,10,22,0,1,10,134,0,1,10,234,0,1,11,2,0,1,
+11,26,0,1,11,50,0,1,11,74,0,1,11,98,0,1,11,122,0,1,11,146,0,1,11,170,0,1,
+11,194,0,1,11,218,0,1,11,242,0,1,12,10,0,1,12,34,0,1,12,58,0,1,12,90,0,1,
+12,120,0,1,12,144,0,1,12,168,0,1,12,192,0,1,12,216,0,1,12,240,0,1,13,8,0,
+1,13,32,0,1,13,56,0,1,13,88,0,1,13,118,0,1,13,142,0,1,13,166,0,1,13,190,0,
+1,13,214,0,1,13,238,0,1,14,4,0,1,14,28,0,1,14,52,0,1,14,76,0,1,14,100,0,1,
+14,124,0,1,14,148,0,1,14,172,0,1,14,196,0,1,14,228,0,1,15,2,0,1,15,26,0,1,
+15,50,0,1,15,74,0,1,15,98,0,1,15,122,0,1,15,146,0,1,15,170,0,1,15,194,0,1,
+15,218,0,1,15,242,0,1,16,10,0,1,16,34,0,1,16,58,0,1,16,82,0,1,16,106,0,1,
+16,130,0,1,16,162,0,1,16,192,0,1,16,216,0,1,16,238,0,1,17,6,0,1,17,28,0,1,
+17,52,0,1,17,76,0,1,17,100,0,1,17,122,0,1,17,146,0,1,17,170,0,1,17,194,0,
+1,17,218,0,1,17,242,0,1,18,10,0,1,18,34,0,1,18,58,0,1,18,82,0,1,18,104,0,
+1,18,128,0,1,18,152,0,1,18,176,0,1,18,198,0,1,18,222,0,1,18,246,0,1,19,14,
+0,1,19,38,0,1,19,62,0,1,19,86,0,1,19,110,0,1,19,132,0,1,19,156,0,1,19,217,
+0,1,20,36,0,1,20,111,0,1,20,206,0,1,21,42,0,1,21,111,0,1,21,179,0,1,22,10,
+0,1,22,96,0,1,22,143,0,1,22,188,0,1,22,212,0,1,22,234,0,1,23,126,0,1,24,34,
+0,1,24,50,0,1,24,201,0,1,25,46,0,1,25,159,0,1,26,1,0,1,26,144,0,1,27,23,0,
+1,27,39,0,1,27,171,0,1,28,29,0,1,28,167,0,1,29,48,0,1,29,149,0,1,29,165,0,
+1,29,181,0,1,30,11,0,1,30,177,0,1,31,89,0,1,31,243,0,1,32,63,0,1,32,150,0,
+1,33,53,0,1,33,220,0,1,34,42,0,1,34,188,0,1,35,117,0,1,35,216,0,1,36,86,0,
+1,36,102,0,1,37,11,0,1,37,149,0,1,38,31,0,1,38,200,0,1,39,95,0,1,39,211,0,
+1,40,69,0,1,40,85,0,1,40,199,0,1,41,60,0,1,41,168,0,1,42,22,0,1,42,116,0,
+1,43,4,0,1,43,113,0,1,43,129,0,1,44,24,0,1,44,127,0,1,44,225,0,1,44,241,0,
+1,45,102,0,1,45,212,0,1,46,93,0,1,46,228,0,1,47,85,0,1,47,189,0,1,48,40,0,
+1,48,166,0,1,48,192,0,1,48,232,0,1,49,44,0,1,49,60,0,1,49,92,0,1,49,124,0,
+1,49,156,0,1,49,180,0,1,49,204,0,1,49,228,0,1,49,252,0,1,50,20,0,1,50,44,
+0,1,50,68,0,1,50,90,0,1,50,114,0,1,50,138,0,1,50,162,0,1,50,184,0,1,50,208,
+0,1,50,230,0,1,50,254,0,1,51,20,0,1,51,44,0,1,51,66,0,1,51,90,0,1,51,112,
+0,1,51,136,0,1,51,158,0,1,51,174,0,1,51,198,0,1,51,220,0,1,51,244,0,1,52,
+10,0,1,52,34,0,1,52,58,0,1,52,200,0,1,53,191,0,1,53,215,0,1,53,237,0,1,54,
+5,0,1,54,29,0,1,54,179,0,1,55,58,0,1,55,82,0,1,55,104,0,1,55,128,0,1,55,150,
+0,1,55,174,0,1,55,198,0,1,55,222,0,1,55,246,0,1,56,12,0,1,56,28,0,1,56,154,
+0,1,56,178,0,1,56,200,0,1,56,224,0,1,56,248,0,1,57,16,0,1,57,40,0,1,57,64,
+0,1,57,88,0,1,57,112,0,1,57,136,0,1,57,160,0,1,57,184,0,1,57,208,0,1,57,232,
+0,1,58,0,0,1,58,24,0,1,58,48,0,1,58,72,0,1,58,96,0,1,58,120,0,1,58,144,0,
+1,58,168,0,1,58,192,0,1,58,216,0,1,58,240,0,1,59,8,0,1,59,24,0,1,59,147,0,
+1,59,171,0,1,59,195,0,1,60,65,0,1,60,219,0,1,61,107,0,1,61,247,0,1,62,85,
+0,1,62,177,0,1,62,201,0,1,62,225,0,1,63,128,0,1,64,28,0,1,64,52,0,1,64,74,
+0,1,64,98,0,1,64,120,0,1,64,144,0,1,64,168,0,1,64,192,0,1,64,214,0,1,64,238,
+0,1,65,4,0,1,65,123,0,1,66,51,0,1,66,180,0,1,67,112,0,1,68,57,0,1,68,241,
+0,1,69,146,0,1,70,44,0,1,70,142,0,1,71,11,0,1,71,169,0,1,72,15,0,1,72,114,
+0,1,72,217,0,1,73,111,0,1,73,251,0,1,74,11,0,1,74,163,0,1,75,82,0,1,75,167,
+0,1,76,16,0,1,76,170,0,1,77,62,0,1,77,204,0,1,78,68,0,1,78,248,0,1,79,168,
+0,1,80,46,0,1,80,170,0,1,81,39,0,1,81,191,0,1,82,25,0,1,82,180,0,1,83,77,
+0,1,83,228,0,1,84,71,0,1,84,171,0,1,85,80,0,1,85,96,0,1,85,112,0,1,86,36,
+0,1,86,155,0,1,86,229,0,1,87,152,0,1,88,47,0,1,88,165,0,1,89,73,0,1,89,232,
+0,1,90,97,0,1,90,238,0,1,91,143,0,1,91,252,0,1,92,12,0,1,92,83,0,1,92,215,
+0,1,93,84,0,1,93,151,0,1,94,32,0,1,94,200,0,1,95,120,0,1,96,53,0,1,96,178,
+0,1,97,55,0,1,97,158,0,1,98,1,0,1,98,146,0,1,99,42,0,1,99,58,0,1,99,164,0,
+1,100,1,0,1,100,130,0,1,100,234,0,1,101,87,0,1,101,168,0,1,101,250,0,1,102,
+127,0,1,103,5,0,1,103,159,0,1,103,251,0,1,104,90,0,1,104,182,0,1,105,68,0,
+1,105,146,0,1,105,225,0,1,106,103,0,1,106,231,0,1,106,247,0,1,107,112,0,1,
+108,23,0,1,108,163,0,1,109,36,0,1,109,156,0,1,110,33,0,1,110,49,0,1,110,217,
+0,1,111,60,0,1,111,158,0,1,112,0,0,1,112,97,0,1,112,121,0,1,112,137,0,1,113,
+1,0,1,113,162,0,1,113,178,0,1,114,46,0,1,114,189,0,1,115,11,0,1,115,181,0,
+1,116,38,0,1,116,151,0,1,117,59,0,1,118,10,0,1,118,232,0,1,119,160,0,1,120,
+63,0,1,121,1,0,1,121,186,0,1,122,94,0,1,122,187,0,1,123,247,0,1,124,80,0,
+1,124,221,0,1,125,123,0,1,125,245,0,1,126,131,0,1,126,216,0,1,127,57,0,1,
+127,153,0,1,128,21,0,1,128,149,0,1,129,62,0,1,129,190,0,1,129,233,0,1,130,
+49,0,1,130,65,0,1,130,81,0,1,130,128,0,1,130,176,0,1,130,250,0,1,131,68,0,
+1,131,129,0,1,131,191,0,1,131,253,0,1,132,59,0,1,132,84,0,1,132,102,0,1,132,
+120,0,1,132,144,0,1,132,169,0,1,132,187,0,1,132,205,0,1,132,246,0,1,133,17,
+0,1,133,65,0,1,133,114,0,1,133,147,0,1,133,180,0,1,133,221,0,1,133,248,0,
+1,134,61,0,1,134,112,0,1,135,19,0,1,135,80,0,1,135,186,0,1,136,97,0,1,136,
+195,0,1,136,227,0,1,137,8,0,1,137,45,0,1,137,80,0,1,137,113,0,1,137,146,0,
+1,137,183,0,1,137,201,0,1,137,240,0,1,138,0,0,1,138,62,0,1,138,123,0,1,138,
+183,0,1,138,244,0,1,139,31,0,1,139,49,0,1,139,121,0,1,139,188,0,1,140,7,0,
+1,140,36,0,1,140,66,0,1,140,95,0,1,140,125,0,1,140,161,0,1,140,193,0,1,141,
+7,0,1,141,25,0,1,141,43,0,1,141,70,0,1,141,88,0,1,141,106,0,1,141,124,0,1,
+141,140,0,1,141,158,0,1,141,176,0,1,141,194,0,1,141,220,0,1,142,3,0,1,142,
+87,0,1,142,139,0,1,142,157,0,1,142,175,0,1,142,193,0,1,142,211,0,1,142,229,
+0,1,142,247,0,1,143,24,0,1,143,56,0,1,143,87,0,1,143,142,0,1,143,189,0,1,
+143,222,0,1,143,254,0,1,144,38,0,1,144,64,0,1,144,82,0,1,144,140,0,1,144,
+158,0,1,144,233,0,1,145,19,0,1,145,37,0,1,145,55,0,1,145,79,0,1,145,129,0,
+1,145,215,0,1,146,21,0,1,146,84,0,1,146,136,0,1,146,187,0,1,146,252,0,1,147,
+23,0,1,147,50,0,1,147,89,0,1,147,107,0,1,147,134,0,1,147,161,0,1,147,193,
+0,1,147,225,0,1,148,17,0,1,148,66,0,1,148,105,0,1,148,190,0,1,148,240,0,1,
+149,50,0,1,149,89,0,1,149,107,0,1,149,125,0,1,149,143,0,1,149,161,0,1,149,
+179,0,1,149,197,0,1,149,215,0,1,149,254,0,1,150,16,0,1,150,44,0,1,150,145,
+0,1,151,18,0,1,151,44,0,1,151,84,0,1,151,115,0,1,153,118,0,1,153,179,0,1,
+153,227,0,1,154,55,0,1,154,105,0,1,154,166,0,1,154,227,0,1,155,81,0,1,155,
+129,0,1,155,145,0,1,155,211,0,1,156,95,0,1,156,131,0,1,156,189,0,1,156,248,
+0,1,157,18,0,1,157,43,0,1,157,112,0,1,157,171,0,1,157,204,0,1,158,74,0,1,
+158,170,0,1,159,4,0,1,159,81,0,1,159,177,0,1,160,9,0,1,160,133,0,1,160,252,
+0,1,161,154,0,1,161,252,0,1,162,72,0,1,162,193,0,1,163,108,0,1,163,150,0,
+1,163,192,0,1,163,208,0,1,163,224,0,1,163,248,0,1,164,16,0,1,164,32,0,1,164,
+192,0,1,164,218,0,1,164,242,0,1,165,131,0,1,166,24,0,1,166,151,0,1,166,246,
+0,1,167,94,0,1,167,204,0,1,168,52,0,1,168,133,0,1,169,11,0,1,169,121,0,1,
+169,242,0,1,170,81,0,1,171,57,0,1,172,12,0,1,172,154,0,1,173,38,0,1,173,205,
+0,1,174,107,0,1,174,241,0,1,175,119,0,1,175,242,0,1,176,107,0,1,176,239,0,
+1,177,118,0,1,177,245,0,1,178,83,0,1,178,190,0,1,179,56,0,1,179,72,0,1,179,
+88,0,1,179,104,0,1,179,120,0,1,179,136,0,1,179,152,0,1,179,168,0,1,179,184,
+0,1,180,54,0,1,180,196,0,1,181,59,0,1,181,75,0,1,181,99,0,1,181,123,0,1,181,
+183,0,1,181,199,0,1,181,215,0,1,181,231,0,1,181,247,0,1,182,126,0,1,183,29,
+0,1,183,223,0,1,184,107,0,1,184,202,0,1,185,39,0,1,185,152,0,1,185,252,0,
+1,186,118,0,1,186,219,0,1,187,30,0,1,187,175,0,1,188,20,0,1,188,148,0,1,188,
+254,0,1,189,86,0,1,189,176,0,1,190,3,0,1,190,95,0,1,190,232,0,1,191,143,0,
+1,192,26,0,1,192,81,0,1,192,136,0,1,192,233,0,1,193,107,0,1,193,238,0,1,194,
+69,0,1,194,175,0,1,195,34,0,1,195,215,0,1,196,126,0,1,196,246,0,1,197,160,
+0,1,197,237,0,1,198,86,0,1,198,202,0,1,199,68,0,1,199,147,0,1,200,13,0,1,
+200,119,0,1,200,135,0,1,201,25,0,1,201,143,0,1,202,23,0,1,202,183,0,1,203,
+58,0,1,203,198,0,1,204,35,0,1,204,136,0,1,204,237,0,1,205,96,0,1,205,236,
+0,1,206,51,0,1,206,118,0,1,207,8,0,1,207,88,0,1,207,218,0,1,208,71,0,1,208,
+179,0,1,209,11,0,1,209,150,0,1,209,249,0,1,210,122,0,1,210,210,0,1,211,61,
+0,1,211,231,0,1,212,102,0,1,212,229,0,1,213,97,0,1,214,40,0,1,214,169,0,1,
+215,39,0,1,215,136,0,1,215,233,0,1,216,102,0,1,216,225,0,1,218,0,0,1,218,
+92,0,1,218,229,0,1,219,135,0,1,219,254,0,1,220,75,0,1,220,162,0,1,220,211,
+0,1,221,4,0,1,221,143,0,1,221,220,0,1,222,62,0,1,222,173,0,1,223,79,0,1,223,
+200,0,1,224,66,0,1,224,218,0,1,225,90,0,1,225,219,0,1,226,75,0,1,226,200,
+0,1,227,34,0,1,227,131,0,1,227,228,0,1,228,93,0,1,228,245,0,1,229,114,0,1,
+229,225,0,1,230,81,0,1,230,206,0,1,231,116,0,1,232,58,0,1,232,255,0,1,233,
+170,0,1,234,174,0,1,235,102,0,1,236,54,0,1,236,218,0,1,237,114,0,1,238,18,
+0,1,238,165,0,1,239,54,0,1,239,206,0,1,240,86,0,1,240,210,0,1,241,173,0,1,
+241,250,0,1,242,67,0,1,242,236,0,1,243,106,0,1,244,10,0,1,244,189,0,1,245,
+100,0,1,245,239,0,1,246,191,0,1,247,117,0,1,247,216,0,1,248,166,0,1,249,64,
+0,1,249,252,0,1,250,140,0,1,251,43,0,1,251,191,0,1,252,102,0,1,253,66,0,1,
+253,186,0,1,254,98,0,1,254,252,0,1,255,169,0,2,0,55,0,2,0,253,0,2,1,158,0,
+2,2,50,0,2,2,179,0,2,3,56,0,2,3,191,0,2,4,73,0,2,4,217,0,2,5,84,0,2,5,173,
+0,2,6,65,0,2,6,200,0,2,7,67,0,2,7,166,0,2,7,237,0,2,8,129,0,2,8,251,0,2,9,
+101,0,2,9,158,0,2,9,229,0,2,10,59,0,2,10,185,0,2,10,253,0,2,11,96,0,2,11,
+176,0,2,12,105,0,2,13,20,0,2,13,142,0,2,14,17,0,2,14,126,0,2,14,218,0,2,15,
+73,0,2,15,226,0,2,16,63,0,2,16,179,0,2,17,50,0,2,17,177,0,2,18,26,0,2,18,
+111,0,2,18,234,0,2,19,49,0,2,19,164,0,2,20,27,0,2,20,132,0,2,20,231,0,2,21,
+81,0,2,21,188,0,2,22,28,0,2,22,88,0,2,22,120,0,2,22,153,0,2,22,186,0,2,22,
+218,0,2,23,4,0,2,23,46,0,2,23,141,0,2,23,202,0,2,24,56,0,2,24,80,0,2,24,104,
+0,2,24,128,0,2,24,152,0,2,24,176,0,2,24,200,0,2,24,232,0,2,25,6,0,2,25,30,
+0,2,25,54,0,2,25,78,0,2,25,102,0,2,25,126,0,2,25,150,0,2,25,174,0,2,25,198,
+0,2,25,222,0,2,25,246,0,2,26,14,0,2,26,36,0,2,26,60,0,2,26,82,0,2,26,106,
+0,2,26,130,0,2,26,154,0,2,26,178,0,2,26,202,0,2,26,224,0,2,26,248,0,2,27,
+16,0,2,27,40,0,2,27,62,0,2,27,86,0,2,27,110,0,2,27,134,0,2,27,158,0,2,27,
+182,0,2,27,206,0,2,28,147,0,2,29,67,0,2,29,91,0,2,29,115,0,2,29,139,0,2,29,
+163,0,2,29,187,0,2,29,211,0,2,29,235,0,2,30,3,0,2,30,27,0,2,30,51,0,2,30,
+75,0,2,30,99,0,2,30,123,0,2,30,147,0,2,30,179,0,2,30,211,0,2,30,235,0,2,31,
+3,0,2,31,27,0,2,31,51,0,2,31,75,0,2,31,99,0,2,31,123,0,2,31,147,0,2,31,171,
+0,2,31,195,0,2,31,219,0,2,31,243,0,2,32,11,0,2,32,35,0,2,32,59,0,2,32,83,
+0,2,32,107,0,2,32,129,0,2,32,153,0,2,32,175,0,2,32,199,0,2,32,221,0,2,32,
+245,0,2,33,11,0,2,33,35,0,2,33,57,0,2,33,81,0,2,33,105,0,2,33,129,0,2,33,
+153,0,2,33,177,0,2,33,201,0,2,33,233,0,2,34,7,0,2,34,31,0,2,34,55,0,2,34,
+79,0,2,34,101,0,2,34,125,0,2,34,149,0,2,34,173,0,2,34,195,0,2,34,219,0,2,
+34,241,0,2,35,17,0,2,35,47,0,2,35,71,0,2,35,95,0,2,35,119,0,2,35,143,0,2,
+35,167,0,2,35,191,0,2,35,215,0,2,35,239,0,2,36,7,0,2,36,31,0,2,36,55,0,2,
+36,79,0,2,36,103,0,2,36,127,0,2,36,151,0,2,36,173,0,2,36,197,0,2,36,219,0,
+2,36,243,0,2,37,9,0,2,37,33,0,2,37,57,0,2,37,81,0,2,37,105,0,2,37,129,0,2,
+37,153,0,2,37,177,0,2,37,201,0,2,37,225,0,2,37,247,0,2,38,15,0,2,38,39,0,
+2,38,63,0,2,38,85,0,2,38,109,0,2,38,133,0,2,38,157,0,2,38,181,0,2,38,205,
+0,2,38,229,0,2,38,253,0,2,39,21,0,2,39,45,0,2,39,69,0,2,39,194,0,2,39,218,
+0,2,39,242,0,2,40,10,0,2,40,32,0,2,40,56,0,2,40,78,0,2,40,102,0,2,40,126,
+0,2,40,148,0,2,40,170,0,2,40,194,0,2,40,218,0,2,40,242,0,2,41,10,0,2,41,32,
+0,2,41,56,0,2,41,80,0,2,41,104,0,2,41,126,0,2,41,148,0,2,41,172,0,2,41,194,
+0,2,41,220,0,2,41,246,0,2,42,16,0,2,42,42,0,2,42,68,0,2,42,94,0,2,42,118,
+0,2,42,142,0,2,42,166,0,2,42,190,0,2,42,214,0,2,42,238,0,2,43,6,0,2,43,30,
+0,2,43,56,0,2,43,82,0,2,43,108,0,2,43,134,0,2,43,160,0,2,43,186,0,2,43,210,
+0,2,43,236,0,2,44,2,0,2,44,24,0,2,44,46,0,2,44,68,0,2,44,90,0,2,44,112,0,
+2,44,134,0,2,44,156,0,2,44,182,0,2,44,208,0,2,44,234,0,2,45,4,0,2,45,30,0,
+2,45,56,0,2,45,80,0,2,45,106,0,2,45,130,0,2,45,154,0,2,45,178,0,2,45,202,
+0,2,45,226,0,2,45,250,0,2,46,18,0,2,46,42,0,2,46,68,0,2,46,94,0,2,46,120,
+0,2,46,146,0,2,46,170,0,2,46,194,0,2,46,218,0,2,46,242,0,2,47,10,0,2,47,34,
+0,2,47,58,0,2,47,82,0,2,47,108,0,2,47,134,0,2,47,160,0,2,47,186,0,2,47,210,
+0,2,47,234,0,2,48,2,0,2,48,26,0,2,48,50,0,2,48,74,0,2,48,98,0,2,48,122,0,
+2,48,146,0,2,48,170,0,2,48,196,0,2,48,222,0,2,48,248,0,2,49,18,0,2,49,42,
+0,2,49,68,0,2,49,92,0,2,49,116,0,2,49,140,0,2,49,164,0,2,49,188,0,2,49,212,
+0,2,49,234,0,2,50,0,0,2,50,24,0,2,50,48,0,2,50,72,0,2,50,96,0,2,50,120,0,
+2,50,144,0,2,50,176,0,2,50,208,0,2,50,240,0,2,51,14,0,2,51,46,0,2,51,76,0,
+2,51,108,0,2,51,140,0,2,51,170,0,2,51,200,0,2,51,232,0,2,52,8,0,2,52,40,0,
+2,52,72,0,2,52,102,0,2,52,134,0,2,52,164,0,2,52,194,0,2,52,224,0,2,52,254,
+0,2,53,28,0,2,53,58,0,2,53,88,0,2,53,118,0,2,53,152,0,2,53,186,0,2,53,220,
+0,2,53,254,0,2,54,32,0,2,54,66,0,2,54,98,0,2,54,132,0,2,54,164,0,2,54,196,
+0,2,54,228,0,2,55,4,0,2,55,36,0,2,55,68,0,2,55,100,0,2,55,132,0,2,55,164,
+0,2,55,196,0,2,55,230,0,2,56,8,0,2,56,42,0,2,56,76,0,2,56,108,0,2,56,142,
+0,2,56,164,0,2,56,186,0,2,56,218,0,2,56,242,0,2,57,18,0,2,57,40,0,2,57,70,
+0,2,57,94,0,2,57,118,0,2,57,140,0,2,57,162,0,2,57,186,0,2,57,245,0,2,58,41,
+0,2,58,57,0,2,58,73,0,2,58,204,0,2,58,234,0,2,59,0,0,2,59,30,0,2,59,52,0,
+2,59,80,0,2,59,106,0,2,59,132,0,2,59,158,0,2,59,184,0,2,59,208,0,2,60,41,
+0,2,60,129,0,2,60,239,0,2,61,7,0,2,61,31,0,2,61,55,0,2,61,79,0,2,61,103,0,
+2,61,127,0,2,61,151,0,2,61,175,0,2,61,201,0,2,61,227,0,2,62,57,0,2,62,144,
+0,2,62,255,0,2,63,21,0,2,63,43,0,2,63,65,0,2,63,87,0,2,63,111,0,2,63,135,
+0,2,63,157,0,2,63,179,0,2,63,203,0,2,63,227,0,2,63,253,0,2,64,23,0,2,64,49,
+0,2,64,154,0,2,65,4,0,2,65,47,0,2,65,79,0,2,65,103,0,2,65,135,0,2,65,159,
+0,2,65,191,0,2,65,215,0,2,65,239,0,2,66,7,0,2,66,31,0,2,66,55,0,2,66,97,0,
+2,66,152,0,2,66,178,0,2,66,237,0,2,67,28,0,2,67,74,0,2,67,101,0,2,67,127,
+0,2,67,226,0,2,68,1,0,2,68,33,0,2,68,69,0,2,68,116,0,2,68,163,0,2,68,163,
+0,2,68,179,0,2,69,59,0,2,69,112,0,2,69,164,0,2,69,198,0,2,69,234,0,2,70,27,
+0,2,70,76,0,2,70,153,0,2,71,13,0,2,71,129,0,2,72,0,0,2,72,96,0,2,72,172,0,
+2,73,86,0,2,73,183,0,2,74,83,0,2,75,19,0,2,75,180,0,2,76,109,0,2,77,46,0,
+2,78,23,0,2,79,54,0,2,79,230,0,2,80,115,0,2,81,149,0,2,82,50,0,2,82,239,0,
+2,83,143,0,2,84,77,0,2,84,244,0,2,85,118,0,2,85,227,0,2,86,50,0,2,86,252,
+0,2,87,232,0,2,88,67,0,2,88,99,0,2,88,131,0,2,88,147,0,2,88,201,0,2,88,255,
+0,2,89,53,0,2,89,106,0,2,89,188,0,2,90,14,0,2,90,109,0,2,90,125,0,2,90,141,
+0,2,90,173,0,2,90,239,0,2,91,36,0,2,91,90,0,2,91,121,0,2,91,192,0,2,92,4,
+0,2,92,29,0,2,92,55,0,2,92,87,0,2,92,118,0,2,92,150,0,2,92,181,0,2,92,218,
+0,2,92,254,0,2,93,34,0,2,93,70,0,2,93,117,0,2,93,156,0,2,93,196,0,2,93,238,
+0,2,94,24,0,2,94,76,0,2,94,117,0,2,94,158,0,2,94,210,0,2,94,252,0,2,95,38,
+0,2,95,90,0,2,95,131,0,2,95,173,0,2,95,223,0,2,96,14,0,2,96,65,0,2,96,128,
+0,2,96,174,0,2,96,224,0,2,97,33,0,2,97,83,0,2,97,129,0,2,97,192,0,2,97,242,
+0,2,98,32,0,2,98,98,0,2,98,165,0,2,98,233,0,2,99,65,0,2,99,93,0,2,99,121,
+0,2,99,149,0,2,99,177,0,2,99,205,0,2,101,201,0,2,105,128,0,2,108,253,0,2,
+109,24,0,2,109,66,0,2,109,94,0,2,109,137,0,2,109,163,0,2,109,190,0,2,109,
+218,0,2,109,246,0,2,110,17,0,2,110,116,0,2,111,193,0,2,111,248,0,2,112,62,
+0,2,112,175,0,2,112,254,0,2,113,189,0,2,114,83,0,2,114,245,0,2,115,102,0,
+2,116,8,0,2,116,115,0,2,117,7,0,2,117,89,0,2,117,149,0,2,117,229,0,2,118,
+75,0,2,118,186,0,2,119,50,0,2,119,145,0,2,120,42,0,2,120,161,0,2,121,45,0,
+2,121,247,0,2,122,112,0,2,122,128,0,2,123,4,0,2,123,169,0,2,124,64,0,2,124,
+135,0,2,124,207,0,2,125,85,0,2,125,101,0,2,126,12,0,2,126,183,0,2,127,106,
+0,2,127,190,0,2,128,17,0,2,128,130,0,2,128,180,0,2,128,239,0,2,129,47,0,2,
+129,107,0,2,129,138,0,2,129,209,0,2,130,24,0,2,130,81,0,2,130,139,0,2,130,
+157,0,2,130,195,0,2,130,231,0,2,130,249,0,2,131,68,0,2,131,108,0,2,131,134,
+0,2,131,160,0,2,131,182,0,2,131,204,0,2,131,226,0,2,132,75,0,2,132,97,0,2,
+132,203,0,2,133,53,0,2,133,75,0,2,133,116,0,2,133,157,0,2,133,209,0,2,134,
+5,0,2,134,50,0,2,134,95,0,2,134,140,0,2,134,182,0,2,134,229,0,2,135,19,0,
+2,135,59,0,2,135,107,0,2,135,153,0,2,135,193,0,2,135,240,0,2,136,34,0,2,136,
+80,0,2,136,128,0,2,136,165,0,2,136,205,0,2,136,252,0,2,137,45,0,2,137,95,
+0,2,137,141,0,2,137,186,0,2,137,225,0,2,138,16,0,2,138,65,0,2,138,115,0,2,
+138,164,0,2,138,204,0,2,138,241,0,2,139,26,0,2,139,76,0,2,139,126,0,2,139,
+174,0,2,139,220,0,2,140,1,0,2,140,42,0,2,140,87,0,2,140,132,0,2,140,173,0,
+2,140,220,0,2,141,14,0,2,141,60,0,2,141,100,0,2,141,146,0,2,141,186,0,2,141,
+233,0,2,142,26,0,2,142,76,0,2,142,122,0,2,142,167,0,2,142,207,0,2,142,254,
+0,2,143,47,0,2,143,97,0,2,143,146,0,2,143,186,0,2,143,223,0,2,144,8,0,2,144,
+58,0,2,144,108,0,2,144,157,0,2,144,204,0,2,144,241,0,2,145,22,0,2,145,68,
+0,2,145,118,0,2,145,168,0,2,145,214,0,2,145,253,0,2,146,38,0,2,146,81,0,2,
+146,126,0,2,146,168,0,2,146,214,0,2,147,7,0,2,147,57,0,2,147,103,0,2,147,
+140,0,2,147,180,0,2,147,227,0,2,148,20,0,2,148,70,0,2,148,120,0,2,148,160,
+0,2,148,197,0,2,148,237,0,2,149,31,0,2,149,81,0,2,149,130,0,2,149,177,0,2,
+149,214,0,2,150,3,0,2,150,48,0,2,150,98,0,2,150,147,0,2,150,194,0,2,150,233,
+0,2,151,23,0,2,151,64,0,2,151,110,0,2,151,160,0,2,151,205,0,2,151,245,0,2,
+152,30,0,2,152,74,0,2,152,119,0,2,152,161,0,2,152,207,0,2,152,255,0,2,153,
+49,0,2,153,99,0,2,153,140,0,2,153,177,0,2,153,217,0,2,154,10,0,2,154,60,0,
+2,154,109,0,2,154,156,0,2,154,193,0,2,154,238,0,2,155,27,0,2,155,77,0,2,155,
+126,0,2,155,173,0,2,155,212,0,2,155,249,0,2,156,41,0,2,156,87,0,2,156,137,
+0,2,156,184,0,2,156,224,0,2,157,14,0,2,157,62,0,2,157,102,0,2,157,148,0,2,
+157,195,0,2,157,235,0,2,158,21,0,2,158,65,0,2,158,110,0,2,158,155,0,2,158,
+177,0,2,158,199,0,2,158,221,0,2,158,243,0,2,159,9,0,2,159,31,0,2,159,53,0,
+2,159,75,0,2,159,99,0,2,159,123,0,2,159,147,0,2,159,171,0,2,159,195,0,2,159,
+219,0,2,159,243,0,2,160,11,0,2,160,33,0,2,160,55,0,2,160,77,0,2,160,99,0,
+2,160,121,0,2,160,143,0,2,160,165,0,2,160,187,0,2,160,211,0,2,160,235,0,2,
+161,3,0,2,161,27,0,2,161,49,0,2,161,71,0,2,161,93,0,2,161,115,0,2,161,235,
+0,2,162,102,0,2,162,223,0,2,163,112,0,2,163,212,0,2,164,55,0,2,164,156,0,
+2,164,255,0,2,165,73,0,2,165,167,0,2,166,3,0,2,166,135,0,2,166,157,0,2,166,
+254,0,2,167,55,0,2,167,112,0,2,167,239,0,2,168,75,0,2,168,155,0,2,168,214,
+0,2,168,236,0,2,169,125,0,2,170,14,0,2,170,133,0,2,170,251,0,2,171,122,0,
+2,171,249,0,2,172,118,0,2,172,244,0,2,173,238,0,2,174,220,0,2,175,151,0,2,
+176,120,0,2,177,28,0,2,177,202,0,2,178,146,0,2,179,86,0,2,180,36,0,2,180,
+229,0,2,181,189,0,2,182,143,0,2,183,2,0,2,183,120,0,2,184,8,0,2,184,141,0,
+2,185,79,0,2,185,105,0,2,185,146,0,2,185,202,0,2,0,102,0,0,3,154,5,182,0,
+3,0,7,0,0,51,17,33,17,37,33,17,33,102,3,52,253,47,2,110,253,146,5,182,250,
+74,98,4,242,0,2,0,211,255,242,1,213,5,182,0,3,0,23,0,0,19,51,3,35,3,52,62,
+2,51,50,30,2,21,20,14,2,35,34,46,2,221,238,72,94,82,20,35,47,27,26,47,35,
+21,21,35,47,26,27,47,35,20,5,182,251,230,254,225,40,53,32,14,14,32,53,40,
+39,54,32,14,14,32,54,0,2,0,117,3,213,2,207,5,182,0,3,0,7,0,0,1,51,3,35,1,
+51,3,35,1,246,217,62,94,254,66,217,62,94,5,182,254,31,1,225,254,31,0,2,0,
+51,0,0,4,70,5,182,0,3,0,31,0,0,1,33,19,33,1,21,33,3,35,19,33,3,35,19,35,53,
+51,19,35,53,51,19,51,3,33,19,51,3,51,21,35,3,1,131,1,29,76,254,227,2,53,254,
+254,78,123,78,254,227,77,123,78,189,211,78,223,245,74,125,76,1,29,76,123,
+76,201,224,75,2,25,1,145,254,111,121,254,96,1,160,254,96,1,160,121,1,145,
+121,1,147,254,109,1,147,254,109,121,254,111,0,3,0,135,255,94,3,233,6,20,0,
+50,0,59,0,70,0,0,1,30,3,21,20,6,35,52,46,2,39,17,30,3,21,20,6,7,21,35,53,
+34,46,2,39,17,51,20,30,2,23,17,46,3,53,52,62,2,55,53,51,19,52,46,2,39,17,
+54,54,1,20,30,2,23,17,14,3,2,109,92,129,82,37,88,74,15,39,70,54,92,142,96,
+50,198,182,103,51,104,99,91,38,86,43,79,109,66,96,133,82,37,49,90,129,80,
+103,192,20,46,73,53,92,100,254,53,21,42,61,40,40,62,41,21,5,121,2,37,61,82,
+48,66,67,45,91,75,52,6,254,34,40,80,93,113,73,154,171,19,248,244,9,21,32,
+22,1,59,57,107,85,55,5,1,250,43,84,93,108,67,69,112,83,51,9,159,251,123,41,
+65,56,48,24,254,57,16,117,3,11,43,65,50,40,18,1,173,9,39,55,70,0,5,0,92,255,
+236,6,207,5,203,0,19,0,39,0,59,0,79,0,83,0,0,1,20,14,2,35,34,46,2,53,52,62,
+2,51,50,30,2,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,20,14,2,35,34,46,
+2,53,52,62,2,51,50,30,2,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,35,1,
+51,2,252,42,84,126,84,88,127,82,39,39,82,128,89,84,125,83,42,254,24,16,36,
+58,42,42,58,35,15,15,35,56,42,42,59,37,16,5,187,42,84,126,84,88,128,81,39,
+39,82,128,89,84,125,83,42,254,24,16,36,58,42,42,58,34,15,15,34,56,42,42,59,
+37,16,253,129,135,2,219,134,4,6,103,168,120,66,66,120,168,103,103,167,119,
+64,64,119,167,103,88,139,96,50,50,96,139,88,87,136,95,49,49,95,136,253,87,
+103,168,120,65,65,120,168,103,103,167,119,64,64,119,167,103,88,139,96,50,
+50,96,139,88,87,136,95,49,49,95,136,253,245,5,182,0,3,0,74,255,236,5,221,
+5,203,0,62,0,78,0,96,0,0,33,39,14,3,35,34,46,2,53,52,62,2,55,46,3,53,52,62,
+2,51,50,30,2,21,20,14,2,7,1,62,3,53,53,33,21,35,34,14,2,7,6,6,7,23,30,3,51,
+51,21,37,50,62,2,55,1,14,3,21,20,30,2,1,52,46,2,35,34,6,21,20,30,2,23,62,
+3,4,150,170,37,89,108,131,78,123,183,121,60,47,85,121,74,39,59,39,20,44,94,
+147,102,98,138,87,39,38,83,131,94,1,117,14,18,11,4,1,113,19,34,66,57,45,13,
+18,47,35,190,15,32,43,59,42,18,252,103,60,103,86,72,29,254,59,47,75,53,28,
+44,81,112,1,46,20,45,73,52,91,98,16,35,54,39,60,89,58,28,180,42,73,54,31,
+62,113,158,97,87,129,98,74,31,46,85,84,88,50,68,110,80,43,46,80,106,59,66,
+102,86,77,40,254,117,46,95,91,87,37,80,86,8,29,55,47,66,154,77,203,15,20,
+12,4,86,94,25,44,61,36,1,229,26,63,83,104,66,75,115,79,40,4,72,41,70,51,30,
+106,88,39,68,67,72,43,26,58,69,84,0,1,0,117,3,213,1,78,5,182,0,3,0,0,19,51,
+3,35,117,217,62,94,5,182,254,31,0,1,0,117,254,250,2,131,6,20,0,21,0,0,1,20,
+30,2,23,21,46,2,2,53,52,18,54,54,55,21,14,3,1,74,19,64,125,105,141,200,127,
+58,58,127,200,141,105,125,64,19,2,137,122,238,213,180,64,94,56,160,221,1,
+33,185,185,1,31,220,159,56,92,64,179,212,238,0,1,0,66,254,250,2,80,6,20,0,
+21,0,0,1,52,46,2,39,53,30,2,18,21,20,2,6,6,7,53,62,3,1,123,19,65,124,105,
+141,200,126,59,59,126,200,141,105,124,65,19,2,137,122,238,212,179,64,92,56,
+159,220,254,225,185,185,254,223,221,160,56,94,64,180,213,238,0,1,0,84,3,6,
+3,160,6,20,0,17,0,0,19,55,5,3,51,3,37,23,5,5,7,37,19,35,19,5,39,37,84,72,
+1,59,53,178,57,1,61,72,254,166,1,90,72,254,195,57,178,51,254,199,72,1,88,
+4,244,162,199,1,69,254,189,192,159,101,100,158,191,254,188,1,68,195,160,102,
+0,1,0,133,1,37,3,244,4,147,0,11,0,0,1,17,35,17,33,53,33,17,51,17,33,21,2,
+121,123,254,135,1,121,123,1,123,2,160,254,133,1,123,121,1,122,254,134,121,
+0,1,0,61,254,197,1,141,1,8,0,23,0,0,37,20,14,2,7,53,54,54,53,52,46,4,53,52,
+54,51,50,30,2,1,141,36,81,127,92,101,94,22,34,38,34,22,77,57,32,56,44,25,
+86,65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,62,23,45,67,0,1,0,
+51,1,225,2,72,2,123,0,3,0,0,19,53,33,21,51,2,21,1,225,154,154,0,1,0,127,255,
+242,1,129,1,8,0,19,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,127,20,
+35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,125,40,53,32,14,14,32,53,40,
+39,54,32,14,14,32,54,0,1,0,0,255,8,2,78,6,20,0,3,0,0,23,35,1,51,121,121,1,
+215,119,248,7,12,0,2,0,92,255,236,4,29,5,203,0,19,0,39,0,0,1,20,2,6,6,35,
+34,38,38,2,53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,
+35,34,14,2,4,29,59,120,180,121,126,182,117,56,56,117,183,127,120,179,120,
+59,253,20,28,63,103,74,75,102,63,27,27,63,101,74,75,103,64,28,2,221,169,254,
+234,198,108,108,198,1,23,170,170,1,20,196,106,106,196,254,235,171,152,239,
+165,87,87,165,239,152,152,238,164,85,85,164,238,0,1,0,135,0,0,3,209,5,190,
+0,31,0,0,51,53,51,50,62,2,53,17,14,3,35,34,38,53,62,3,55,55,51,17,20,30,2,
+51,51,21,197,137,35,61,45,27,39,70,64,61,30,45,58,31,63,71,83,51,144,131,
+26,46,61,35,100,86,10,31,58,48,4,52,48,78,56,31,61,49,8,23,37,53,37,106,251,
+43,48,58,31,10,86,0,1,0,104,0,0,3,227,5,203,0,47,0,0,1,20,14,2,7,1,33,50,
+62,2,55,55,51,3,33,53,1,62,3,53,52,46,2,35,34,14,2,21,34,46,2,53,52,62,2,
+51,50,30,2,3,176,46,88,127,81,254,166,1,217,46,60,38,21,7,8,86,10,252,143,
+1,86,82,111,68,30,25,51,79,54,70,87,50,18,37,64,48,27,51,101,150,99,97,154,
+108,57,4,117,72,136,143,154,89,254,129,26,42,55,30,37,254,158,150,1,139,95,
+150,133,127,70,59,95,69,37,50,84,110,61,12,31,51,39,59,101,74,41,49,89,126,
+0,1,0,119,255,236,4,2,5,203,0,74,0,0,37,50,62,2,53,52,46,2,35,35,53,51,50,
+62,2,53,52,46,2,35,34,14,2,21,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,7,
+30,5,21,20,14,4,35,34,46,2,53,52,54,51,20,30,2,1,252,61,110,84,50,51,96,138,
+86,65,65,68,117,87,50,24,53,83,59,70,88,50,18,37,64,48,27,51,102,150,99,97,
+158,113,62,49,88,120,71,38,86,84,77,59,35,44,77,102,116,122,59,101,146,95,
+45,70,59,35,66,97,90,34,78,126,92,65,105,74,41,104,45,82,117,73,60,94,66,
+34,50,84,110,61,12,31,51,39,59,101,74,41,44,83,121,78,69,122,99,70,17,4,19,
+36,54,78,103,68,82,130,97,68,42,19,37,62,83,45,62,69,54,91,66,37,0,2,0,35,
+0,0,4,92,5,182,0,24,0,39,0,0,1,21,20,30,2,51,51,21,33,53,51,50,62,2,53,53,
+33,53,1,51,17,51,21,1,52,62,2,55,14,5,7,1,33,3,94,27,45,62,34,27,253,151,
+58,35,61,45,27,253,137,2,121,194,254,254,62,2,3,5,4,7,26,33,37,37,32,12,254,
+198,1,228,1,145,168,48,58,31,10,86,86,10,31,58,48,168,84,3,209,252,78,115,
+1,238,45,108,112,111,48,14,47,58,64,61,53,18,254,24,0,1,0,113,255,236,3,227,
+5,180,0,53,0,0,37,50,62,2,53,52,46,2,35,34,14,2,7,39,19,33,19,35,39,46,3,
+35,33,3,54,54,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,51,20,30,2,1,233,
+63,107,79,44,44,82,114,71,53,77,59,44,19,49,66,2,172,10,86,8,3,11,24,41,32,
+254,115,39,31,117,91,99,171,126,71,67,127,184,117,114,149,88,36,63,66,31,
+61,93,100,35,81,133,97,81,120,80,39,8,13,16,8,14,2,213,254,203,61,22,31,21,
+10,254,62,11,22,54,108,163,108,104,172,123,67,39,60,73,34,57,64,44,76,55,
+32,0,2,0,125,255,236,4,16,5,203,0,42,0,58,0,0,1,34,2,3,62,3,51,50,30,2,21,
+20,14,2,35,34,38,38,2,53,52,62,4,51,50,30,2,21,20,6,35,52,46,2,3,34,14,2,
+7,30,3,51,50,54,53,52,38,2,147,154,158,11,25,61,72,85,50,94,152,107,58,59,
+113,163,105,102,174,127,72,29,58,88,119,150,90,86,127,84,41,80,77,19,44,68,
+121,40,74,65,54,21,2,39,70,100,61,110,115,125,5,104,254,209,254,213,21,39,
+29,18,58,108,156,98,108,180,129,72,85,183,1,31,202,97,186,166,140,101,56,
+36,60,78,41,59,64,50,87,65,37,253,168,21,33,43,21,154,218,138,64,171,186,
+175,160,0,1,0,121,0,0,4,23,5,180,0,10,0,0,33,1,33,34,7,7,35,19,33,21,1,1,
+133,1,227,253,230,110,9,8,86,10,3,148,254,8,5,16,104,102,1,114,59,250,135,
+0,3,0,94,255,236,4,27,5,203,0,39,0,57,0,77,0,0,19,52,62,2,55,46,3,53,52,62,
+2,51,50,30,2,21,20,14,2,7,30,3,21,20,14,2,35,34,46,2,5,50,62,2,53,52,46,2,
+39,6,6,21,20,30,2,1,52,46,2,35,34,14,2,21,20,30,2,23,62,3,94,47,84,114,67,
+58,98,70,39,50,106,169,118,96,150,103,54,40,72,102,62,76,125,90,49,70,128,
+182,112,115,174,117,59,1,219,67,109,77,42,38,86,137,99,97,114,35,69,104,1,
+48,25,55,89,65,57,89,60,31,35,69,104,68,58,75,44,18,1,111,74,111,87,70,32,
+33,77,92,109,64,71,132,102,62,53,94,129,77,67,102,81,65,31,36,82,96,112,67,
+97,153,106,55,60,105,141,212,41,72,100,59,52,89,83,79,43,52,166,116,64,104,
+75,41,4,37,47,90,71,43,37,65,90,53,55,88,72,63,32,29,61,73,87,0,2,0,104,255,
+233,3,252,5,203,0,42,0,61,0,0,37,50,18,19,14,3,35,34,46,2,53,52,62,2,51,50,
+22,22,18,21,20,14,4,35,34,46,2,53,52,54,55,30,3,19,62,3,55,53,46,3,35,34,
+6,21,20,30,2,1,211,170,162,10,22,59,75,91,54,89,149,107,59,60,113,163,103,
+104,174,128,71,27,57,89,123,160,99,87,115,67,28,38,23,14,41,59,76,134,50,
+83,64,47,14,2,40,70,97,59,109,119,30,60,89,90,1,48,1,52,27,50,39,23,52,104,
+156,104,111,185,133,75,80,168,254,252,180,107,205,182,152,111,61,31,50,64,
+32,38,52,8,32,59,45,26,2,82,1,27,45,60,33,4,135,195,126,60,190,181,84,120,
+76,35,0,2,0,166,255,242,1,168,4,84,0,19,0,39,0,0,55,52,62,2,51,50,30,2,21,
+20,14,2,35,34,46,2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,166,20,35,
+47,27,26,47,35,21,21,35,47,26,27,47,35,20,20,35,47,27,26,47,35,21,21,35,47,
+26,27,47,35,20,125,40,53,32,14,14,32,53,40,39,54,32,14,14,32,54,3,115,40,
+53,32,14,14,32,53,40,39,54,33,14,14,33,54,0,2,0,98,254,197,1,178,4,84,0,23,
+0,43,0,0,37,20,14,2,7,53,54,54,53,52,46,4,53,52,54,51,50,30,2,1,52,62,2,51,
+50,30,2,21,20,14,2,35,34,46,2,1,178,36,81,127,92,101,94,22,34,38,34,22,77,
+57,32,56,44,25,254,244,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,86,
+65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,62,23,45,67,3,72,40,
+53,32,14,14,32,53,40,39,54,33,14,14,33,54,0,1,0,133,0,225,3,244,4,217,0,6,
+0,0,19,53,1,21,1,1,21,133,3,111,253,80,2,176,2,184,72,1,217,137,254,139,254,
+143,137,0,2,0,133,1,213,3,244,3,225,0,3,0,7,0,0,1,21,33,53,1,21,33,53,3,244,
+252,145,3,111,252,145,2,78,121,121,1,147,121,121,0,1,0,133,0,225,3,244,4,
+217,0,6,0,0,55,53,1,1,53,1,21,133,2,176,253,80,3,111,225,137,1,113,1,117,
+137,254,39,72,0,2,0,88,255,242,3,152,5,203,0,37,0,57,0,0,1,35,17,62,3,53,
+52,46,2,35,34,14,2,21,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,7,3,52,62,
+2,51,50,30,2,21,20,14,2,35,34,46,2,2,10,125,89,121,73,31,26,54,85,59,64,87,
+54,24,37,62,45,26,45,95,144,99,97,164,120,68,53,102,148,95,194,20,35,47,27,
+26,47,35,21,21,35,47,26,27,47,35,20,1,156,1,55,36,95,111,121,61,53,87,61,
+34,42,72,95,53,17,33,50,33,49,84,62,35,50,95,138,88,84,138,114,94,39,253,
+250,40,53,32,14,14,32,53,40,39,54,32,14,14,32,54,0,2,0,133,254,221,6,242,
+5,182,0,91,0,110,0,0,1,20,14,2,35,34,38,39,35,14,3,35,34,46,2,53,52,62,4,
+51,50,22,23,55,51,3,6,7,6,6,21,20,30,2,51,50,62,2,53,52,46,2,35,34,14,4,21,
+20,30,2,51,50,62,2,55,23,14,3,35,34,36,38,2,53,52,18,62,3,51,50,4,22,22,1,
+20,22,51,50,62,2,55,19,38,38,35,34,14,4,6,242,72,116,143,71,91,121,29,11,
+21,53,67,83,52,62,113,85,51,25,53,83,116,151,94,66,95,31,82,49,104,3,4,3,
+4,21,34,45,25,45,94,76,49,86,153,213,128,100,193,172,147,106,60,98,167,221,
+124,84,150,131,111,44,48,51,126,147,169,95,165,254,236,199,112,63,119,169,
+212,249,140,172,1,4,174,87,251,229,87,69,52,76,52,32,9,78,13,65,37,61,99,
+75,54,35,16,3,35,148,239,168,90,98,88,40,68,50,28,42,86,132,90,55,128,127,
+119,91,55,36,25,43,253,246,24,24,20,48,21,36,53,35,16,72,139,202,130,134,
+205,139,71,56,109,157,201,244,140,171,241,153,70,29,48,61,32,74,38,73,57,
+35,91,184,1,20,186,145,1,7,226,183,129,70,102,177,241,254,49,108,105,45,72,
+92,47,1,160,29,32,53,86,111,116,110,0,2,0,0,0,0,5,164,5,182,0,36,0,47,0,0,
+1,7,6,6,21,20,22,51,51,21,33,53,51,50,62,2,55,1,51,1,30,3,51,51,21,33,53,
+51,50,53,52,38,39,39,3,38,38,39,14,3,7,3,33,1,158,78,9,10,67,69,47,254,12,
+39,30,42,34,31,19,1,198,160,1,207,12,25,34,44,30,27,253,205,47,123,9,8,82,
+164,32,53,17,7,19,22,28,18,139,1,206,1,233,215,24,47,17,52,48,86,86,13,36,
+62,49,4,192,251,13,32,42,25,10,86,86,98,17,36,23,229,1,205,91,159,74,37,69,
+72,79,48,254,135,0,3,0,78,0,0,4,190,5,182,0,33,0,46,0,59,0,0,1,20,14,2,7,
+21,30,3,21,20,4,33,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,32,4,1,51,50,
+62,2,53,52,46,2,35,35,53,51,50,62,2,53,52,46,2,35,35,4,129,39,68,93,54,70,
+116,83,46,254,252,254,246,253,158,26,35,61,46,26,27,46,61,34,26,2,37,1,10,
+1,4,253,94,199,87,120,76,34,30,73,120,90,203,142,90,120,72,31,34,76,121,87,
+137,4,72,69,104,78,53,18,8,12,58,93,127,81,198,197,86,10,31,58,48,3,236,45,
+55,30,9,86,177,251,97,32,71,114,82,80,118,78,38,102,32,67,106,74,75,101,62,
+26,0,1,0,117,255,236,4,164,5,203,0,47,0,0,1,50,30,2,21,20,14,2,35,52,46,2,
+35,34,14,2,21,20,30,2,51,50,62,2,55,22,22,21,20,14,2,35,34,38,38,2,53,52,
+18,54,54,3,6,105,155,103,51,27,48,65,38,25,57,91,67,116,162,102,46,48,104,
+161,113,75,115,88,67,26,17,22,53,108,166,114,153,232,157,80,84,165,246,5,
+203,35,62,84,49,33,53,37,20,48,94,75,47,85,163,239,154,137,228,163,90,29,
+48,63,34,11,38,31,39,81,66,43,108,198,1,22,169,166,1,20,198,110,0,2,0,78,
+0,0,5,92,5,182,0,26,0,37,0,0,1,20,2,6,6,35,33,53,51,50,62,2,53,17,52,46,2,
+35,35,53,33,50,22,22,18,1,50,62,2,53,16,2,35,35,17,5,92,84,166,250,167,253,
+141,26,35,61,46,26,27,46,61,34,26,2,115,158,248,171,90,253,53,122,183,122,
+61,243,243,180,2,221,168,254,241,191,103,86,10,31,58,48,3,236,45,55,30,9,
+86,97,186,254,240,252,221,83,160,234,152,1,49,1,66,251,24,0,1,0,78,0,0,4,
+166,5,182,0,39,0,0,37,33,50,62,2,55,55,51,3,33,53,51,50,62,2,53,17,52,46,
+2,35,35,53,33,19,35,39,46,3,35,33,17,33,21,33,1,223,1,139,49,69,46,26,5,14,
+107,14,251,182,26,34,61,46,27,26,46,61,35,26,4,8,10,106,10,4,23,43,65,46,
+254,168,1,238,254,18,102,27,46,61,34,88,254,154,86,9,28,55,45,3,238,48,58,
+31,10,86,254,154,88,34,61,46,27,253,223,100,0,1,0,78,0,0,4,96,5,182,0,37,
+0,0,1,17,33,21,33,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,
+53,33,19,35,39,46,3,35,1,223,1,238,254,18,27,45,62,34,68,253,131,26,34,61,
+46,27,27,46,61,34,26,4,8,10,106,10,4,24,45,68,48,5,80,253,176,100,254,77,
+48,58,31,10,86,86,9,28,55,45,3,246,45,55,30,9,86,254,154,88,35,61,45,27,0,
+1,0,117,255,236,5,143,5,203,0,57,0,0,5,34,36,38,2,53,52,18,54,36,51,50,30,
+2,21,20,14,2,35,52,46,2,35,34,14,2,21,20,30,2,51,50,54,55,17,52,46,2,35,35,
+53,33,21,35,34,14,2,21,17,6,6,3,53,178,254,247,175,86,91,181,1,12,177,114,
+169,113,56,30,51,69,40,28,64,104,75,130,183,116,52,54,122,194,140,59,111,
+43,27,46,61,34,8,2,20,8,29,52,38,22,103,218,20,108,198,1,22,169,166,1,20,
+198,110,35,62,84,49,33,53,37,20,48,94,75,47,85,163,239,154,153,238,162,84,
+12,13,1,74,45,55,29,10,86,86,10,31,59,48,254,144,48,46,0,1,0,78,0,0,6,10,
+5,182,0,67,0,0,33,53,51,50,62,2,53,17,33,17,20,30,2,51,51,21,33,53,51,50,
+62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,
+33,21,35,34,14,2,21,17,20,30,2,51,51,21,3,182,27,35,61,45,27,253,102,27,45,
+62,34,27,253,172,26,35,61,46,26,27,46,61,34,26,2,84,27,34,62,45,27,2,154,
+27,45,61,35,27,2,84,26,35,61,46,26,27,46,61,34,26,86,10,31,58,48,1,224,254,
+32,48,58,31,10,86,86,10,31,58,48,3,236,45,55,30,9,86,86,10,31,58,48,254,98,
+1,158,48,58,31,10,86,86,10,31,58,48,252,18,45,55,28,9,86,0,1,0,78,0,0,2,162,
+5,182,0,31,0,0,51,53,51,50,62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,
+17,20,30,2,51,51,21,78,26,35,61,46,26,26,46,61,35,26,2,84,27,34,62,45,27,
+27,45,62,34,27,86,10,31,58,48,3,228,48,58,31,10,86,86,10,31,58,48,252,28,
+48,58,31,10,86,0,1,255,233,254,20,2,162,5,182,0,29,0,0,3,51,50,62,2,53,17,
+52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,14,2,35,35,23,19,66,103,70,37,
+27,46,61,34,26,2,84,27,34,62,45,27,72,126,171,98,35,254,117,37,87,145,108,
+4,231,45,55,30,9,86,86,10,31,58,48,251,35,138,183,109,46,0,1,0,78,0,0,5,178,
+5,182,0,64,0,0,1,62,3,53,52,38,35,53,33,21,34,14,2,7,1,1,22,22,51,51,21,35,
+34,46,2,39,1,7,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,
+33,21,35,34,14,2,21,17,3,135,33,44,25,11,50,51,1,197,35,65,65,69,40,254,215,
+1,176,59,109,57,4,22,103,132,90,67,38,254,159,174,27,45,62,34,27,253,172,
+26,34,61,46,27,27,46,61,34,26,2,84,27,34,62,45,27,4,113,38,59,48,36,15,26,
+19,84,84,27,49,71,45,254,178,253,166,81,83,86,16,42,71,55,1,250,141,254,196,
+48,58,31,10,86,86,9,28,55,45,3,246,45,55,30,9,86,86,10,31,58,48,253,190,0,
+1,0,78,0,0,4,166,5,182,0,33,0,0,51,53,51,50,62,2,53,17,52,46,2,35,35,53,33,
+21,35,34,14,2,21,17,33,50,62,2,55,55,51,3,78,26,35,61,46,26,26,46,61,35,26,
+2,84,27,34,61,46,27,1,148,46,65,42,23,4,20,107,14,86,10,31,58,48,3,228,48,
+58,31,10,86,86,9,30,55,45,251,145,33,53,66,33,153,254,72,0,1,0,78,0,0,7,51,
+5,182,0,54,0,0,33,53,51,50,62,2,55,17,1,35,1,17,20,30,2,51,51,21,33,53,51,
+50,62,2,53,17,52,46,2,35,35,53,33,1,1,33,21,35,34,14,2,21,17,20,30,2,51,51,
+21,5,18,7,33,53,37,22,2,254,43,111,254,37,20,39,55,34,6,254,39,26,34,61,46,
+27,27,46,61,34,26,1,211,1,168,1,164,1,198,26,35,61,46,26,26,46,61,35,26,86,
+9,27,51,42,4,70,250,227,5,25,251,208,48,58,31,10,86,86,9,28,55,45,3,246,45,
+55,30,9,86,251,109,4,147,86,10,31,58,48,252,28,48,58,31,10,86,0,1,0,78,0,
+0,5,225,5,182,0,44,0,0,33,1,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,
+46,2,35,35,53,33,1,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,4,141,253,0,
+27,45,62,34,27,253,254,26,35,61,46,26,27,46,61,34,26,1,119,2,221,27,46,61,
+34,27,2,2,26,35,61,46,26,4,156,252,77,48,58,31,10,86,86,10,31,58,48,3,236,
+45,55,30,9,86,251,148,3,139,45,55,30,9,86,86,10,31,58,48,251,51,0,2,0,115,
+255,236,5,123,5,205,0,19,0,39,0,0,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,
+51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,5,123,84,164,240,
+155,163,242,160,80,80,160,244,163,155,238,164,84,251,219,45,100,159,114,114,
+159,99,44,44,99,157,114,114,160,101,45,2,221,169,254,234,198,108,108,198,
+1,23,170,170,1,21,196,107,107,197,254,235,171,152,239,165,87,87,165,239,152,
+152,239,164,86,86,164,239,0,2,0,78,0,0,4,133,5,182,0,35,0,48,0,0,51,53,51,
+50,62,2,53,17,52,46,2,35,35,53,33,50,30,2,21,20,14,2,35,35,17,20,30,2,51,
+51,21,3,51,50,62,2,53,52,46,2,35,35,78,26,35,61,46,26,27,46,61,34,26,2,63,
+129,190,124,61,57,130,210,152,129,27,46,61,34,68,236,109,93,132,84,39,34,
+76,121,87,139,86,10,31,58,48,3,236,45,55,30,9,86,59,111,158,100,91,168,129,
+77,254,166,45,55,28,9,86,2,154,39,87,137,97,86,127,84,41,0,2,0,115,254,41,
+5,123,5,205,0,32,0,52,0,0,1,20,14,2,7,30,3,51,51,21,35,34,46,2,39,46,2,2,
+53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,
+5,123,66,129,189,122,9,50,78,104,62,33,88,81,161,132,89,10,141,209,138,69,
+80,160,244,163,155,238,164,84,251,219,45,100,159,114,114,159,99,44,44,99,
+157,114,114,160,101,45,2,221,150,252,192,125,22,105,141,85,36,96,43,105,175,
+132,15,119,195,1,7,159,170,1,21,196,107,107,197,254,235,171,152,239,165,87,
+87,165,239,152,152,239,164,86,86,164,239,0,2,0,78,0,0,5,76,5,182,0,46,0,59,
+0,0,37,22,22,51,51,21,35,34,46,2,39,1,35,17,20,30,2,51,51,21,33,53,51,50,
+62,2,53,17,52,46,2,35,35,53,33,32,4,21,20,14,2,7,37,51,50,62,2,53,52,46,2,
+35,35,4,111,52,98,65,6,29,96,123,86,61,35,254,235,170,27,46,61,34,27,253,
+172,26,34,61,46,27,27,46,61,34,26,2,39,1,10,1,4,53,86,108,54,254,137,144,
+90,120,72,31,34,76,121,87,139,250,82,82,86,14,40,72,58,1,205,254,90,45,55,
+28,9,86,86,9,28,55,45,3,246,45,55,30,9,86,197,198,82,123,90,60,18,47,40,80,
+120,80,82,115,73,33,0,1,0,98,255,236,3,242,5,203,0,63,0,0,5,34,46,2,53,52,
+54,51,30,3,51,50,54,53,52,46,2,39,46,3,53,52,62,2,51,50,30,2,21,20,6,35,52,
+46,2,35,34,14,2,21,20,30,2,23,30,3,21,20,14,2,1,250,100,153,103,52,77,71,
+3,33,66,102,72,138,155,32,74,121,90,95,142,94,46,67,120,164,97,92,142,98,
+51,87,74,23,54,88,65,59,93,64,34,32,75,122,89,90,141,98,52,71,132,186,20,
+42,75,107,64,62,76,64,118,90,54,133,125,56,86,73,67,37,39,89,109,134,84,88,
+138,95,50,38,64,83,45,66,67,48,93,73,46,33,61,86,53,61,93,75,67,36,37,82,
+101,125,79,97,153,106,55,0,1,0,41,0,0,4,190,5,182,0,35,0,0,37,20,30,2,51,
+51,21,33,53,51,50,62,2,53,17,35,34,14,2,7,7,35,19,33,19,35,39,46,3,35,35,
+2,217,27,45,62,34,47,253,131,47,34,61,46,27,196,45,61,39,19,4,11,106,10,4,
+129,10,106,10,4,20,38,62,46,199,233,48,58,31,10,86,86,9,28,55,45,4,113,27,
+46,61,34,88,1,102,254,154,88,34,61,46,27,0,1,0,31,255,236,5,158,5,182,0,53,
+0,0,5,34,46,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,30,2,51,50,
+62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,14,2,2,229,121,192,
+133,70,27,46,61,34,26,2,84,27,34,62,45,27,51,91,125,75,89,129,85,41,27,46,
+61,34,26,2,2,27,34,62,45,27,65,127,188,20,51,111,175,125,3,27,45,55,30,9,
+86,86,10,31,58,48,252,225,89,125,78,36,48,85,117,70,3,47,45,55,30,9,86,86,
+10,31,58,48,252,213,102,163,113,60,0,1,0,0,0,0,5,102,5,182,0,42,0,0,33,1,
+46,3,35,35,53,33,21,35,34,6,21,20,22,23,19,22,22,23,54,54,55,19,54,54,53,
+52,38,35,35,53,33,21,35,34,14,2,7,1,2,102,254,70,11,26,34,44,30,27,2,51,47,
+62,61,9,8,225,31,44,17,16,44,34,226,8,10,67,68,47,1,243,39,30,43,35,30,17,
+254,88,4,244,32,42,24,10,86,86,47,51,17,36,23,253,103,91,171,74,74,166,96,
+2,139,25,46,17,53,47,86,86,12,35,62,50,251,63,0,1,0,18,0,0,8,78,5,182,0,56,
+0,0,1,1,22,22,23,54,54,55,19,62,3,53,52,38,35,35,53,33,21,35,34,14,2,7,1,
+35,1,1,35,1,46,3,35,35,53,33,21,35,34,6,21,20,22,23,19,22,22,23,54,54,55,
+19,4,156,1,0,29,45,14,15,39,28,180,3,8,6,5,67,68,47,1,244,39,30,45,36,30,
+15,254,166,184,254,178,254,199,189,254,137,10,25,34,46,30,27,2,52,47,62,61,
+10,6,188,26,46,17,15,41,27,244,5,168,252,137,102,187,71,74,163,99,2,120,12,
+30,30,26,9,53,47,86,86,12,34,62,51,251,63,4,123,251,133,4,244,32,42,24,10,
+86,86,47,51,17,36,23,253,113,93,179,74,80,189,99,3,111,0,1,0,16,0,0,5,55,
+5,182,0,76,0,0,1,52,46,2,35,35,53,33,21,35,34,14,2,7,1,1,22,22,51,51,21,33,
+53,51,50,53,52,46,2,39,3,3,14,3,21,20,22,51,51,21,33,53,51,50,62,2,55,1,1,
+38,38,35,35,53,33,21,35,34,14,2,21,20,30,2,23,19,19,54,54,3,186,17,29,40,
+24,6,1,192,18,30,49,46,49,29,254,215,1,121,45,80,39,26,253,215,11,122,5,14,
+27,21,203,227,9,18,16,10,65,68,6,254,24,13,37,55,47,46,28,1,86,254,174,37,
+93,46,27,2,43,6,35,46,26,10,3,10,19,17,185,194,23,28,5,37,18,23,13,5,86,86,
+14,35,56,42,254,84,253,162,60,49,86,86,68,11,22,30,44,34,1,70,254,176,13,
+33,36,37,16,35,29,86,86,15,34,54,40,1,234,2,37,59,49,86,86,9,16,22,12,11,
+20,27,36,27,254,213,1,39,35,62,0,1,255,246,0,0,5,6,5,182,0,62,0,0,33,53,51,
+50,62,2,53,17,1,46,3,35,35,53,33,21,35,34,14,2,21,20,22,23,19,22,22,23,62,
+3,55,55,54,54,53,52,38,35,35,53,33,21,35,34,14,2,7,1,17,20,30,2,51,51,21,
+1,70,47,34,61,46,27,254,133,17,30,33,40,26,26,2,51,76,28,35,20,7,25,12,151,
+36,50,17,9,27,33,36,18,131,20,17,64,59,60,1,244,24,22,39,40,43,26,254,168,
+26,46,61,34,48,86,9,28,55,45,1,131,2,146,29,41,26,12,86,86,10,18,24,13,29,
+58,22,254,238,63,123,48,22,54,61,65,32,235,35,63,25,45,45,86,86,15,37,61,
+46,253,161,254,135,48,58,31,10,86,0,1,0,74,0,0,4,102,5,182,0,23,0,0,1,1,33,
+50,62,2,55,55,51,3,33,53,1,33,34,14,2,7,7,35,19,33,4,70,252,254,2,4,46,62,
+38,20,4,10,106,10,251,238,3,0,254,67,45,61,38,20,4,10,106,10,3,203,5,98,251,
+4,27,46,61,34,88,254,154,82,4,254,27,46,61,34,88,1,102,0,1,0,205,254,250,
+2,150,6,20,0,17,0,0,19,17,33,21,35,34,14,2,21,17,20,30,2,51,51,21,205,1,201,
+89,34,61,46,26,26,46,61,34,89,254,250,7,26,86,10,31,58,48,250,184,48,58,31,
+10,86,0,1,0,0,255,8,2,78,6,20,0,3,0,0,17,51,1,35,119,1,215,121,6,20,248,244,
+0,1,0,76,254,250,2,20,6,20,0,17,0,0,19,53,51,50,62,2,53,17,52,46,2,35,35,
+53,33,17,76,88,35,61,45,27,27,45,61,35,88,1,200,254,250,86,10,31,58,48,5,
+72,48,58,31,10,86,248,230,0,1,0,104,2,33,4,14,5,182,0,6,0,0,1,51,1,35,1,1,
+35,2,23,71,1,176,137,254,180,254,185,138,5,182,252,107,2,217,253,39,0,1,255,
+246,254,221,3,182,255,86,0,3,0,0,1,33,53,33,3,182,252,64,3,192,254,221,121,
+0,1,1,137,4,217,3,23,6,33,0,13,0,0,1,35,46,3,39,53,51,30,3,23,3,23,78,41,
+96,90,74,19,219,16,43,48,50,22,4,217,28,83,88,81,27,21,34,81,81,76,29,0,2,
+0,102,255,236,4,41,4,94,0,14,0,63,0,0,1,20,22,51,50,62,2,53,53,7,14,3,19,
+34,14,2,21,34,38,53,52,62,2,51,50,30,2,21,17,20,30,2,51,51,21,33,39,35,14,
+3,35,34,46,2,53,52,54,55,55,53,52,46,2,1,45,81,85,62,101,71,38,131,87,117,
+72,31,248,59,73,41,14,85,89,58,101,134,76,94,140,94,47,14,30,49,34,6,254,
+235,32,17,32,60,72,91,64,68,117,85,48,232,235,170,12,40,75,1,41,96,95,40,
+74,106,65,166,6,4,35,63,92,2,147,33,60,82,48,58,71,53,74,47,22,37,84,135,
+98,253,237,43,56,34,14,86,176,43,72,52,29,39,81,123,84,163,158,7,6,123,55,
+93,67,37,0,2,0,37,255,236,4,121,6,20,0,45,0,65,0,0,1,20,14,2,35,34,46,2,39,
+35,7,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,17,20,6,7,6,7,51,62,3,51,
+50,30,2,1,34,14,2,21,20,30,2,51,50,62,2,53,52,46,2,4,121,55,106,156,101,59,
+96,77,59,22,13,36,254,184,16,35,61,45,27,27,46,61,34,16,1,121,2,2,2,2,8,23,
+58,76,96,60,101,156,106,55,254,59,80,107,64,27,27,65,107,81,68,95,61,28,28,
+61,97,2,39,148,216,140,67,26,48,66,40,160,86,10,31,58,48,4,74,45,55,30,9,
+86,254,136,35,91,42,48,51,47,76,53,29,67,139,214,1,33,53,108,164,111,107,
+164,112,57,57,112,165,108,109,163,108,54,0,1,0,113,255,236,3,160,4,94,0,41,
+0,0,5,34,46,2,53,52,62,2,51,50,30,2,21,20,6,35,52,46,2,35,34,14,2,21,20,22,
+51,50,54,55,22,22,21,20,14,2,2,68,102,172,124,69,69,123,167,97,64,127,102,
+64,92,91,16,39,67,52,59,95,68,36,145,165,95,142,35,15,20,44,87,130,20,63,
+136,213,151,164,221,134,56,25,52,79,53,71,58,48,86,65,37,44,108,182,137,218,
+214,80,63,12,40,28,35,70,56,35,0,2,0,113,255,236,4,197,6,20,0,45,0,63,0,0,
+37,20,30,2,51,51,21,33,39,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,51,
+38,39,38,38,53,53,52,46,2,35,35,53,33,1,50,62,2,53,52,46,2,35,34,14,2,21,
+20,22,4,12,27,46,61,34,17,254,165,22,8,23,59,76,96,60,101,156,106,54,54,106,
+156,101,59,96,77,60,22,12,3,3,2,4,27,46,61,34,17,1,121,254,41,80,107,65,27,
+27,65,108,81,67,96,61,28,118,225,45,55,30,9,86,184,47,75,53,29,67,139,214,
+147,148,216,140,67,26,48,66,40,50,44,38,75,18,168,45,55,30,9,86,250,91,53,
+108,164,111,107,164,111,58,58,112,165,107,218,216,0,2,0,113,255,236,3,225,
+4,94,0,8,0,41,0,0,1,34,6,7,33,52,46,2,3,34,46,2,53,16,18,51,50,30,2,21,21,
+33,30,3,51,50,62,2,55,22,22,21,20,14,2,2,51,114,123,11,1,215,24,52,85,37,
+111,177,122,65,236,218,99,158,110,59,253,86,2,41,77,112,73,53,91,74,57,18,
+14,25,44,90,135,3,240,185,178,81,134,96,52,251,252,75,144,209,133,1,31,1,
+34,62,123,183,121,94,112,161,104,49,24,40,51,28,6,38,26,31,71,60,40,0,1,0,
+55,0,0,3,131,6,41,0,49,0,0,37,21,33,53,51,50,62,2,53,17,35,53,51,53,52,62,
+2,51,50,30,2,21,20,14,2,35,52,46,2,35,34,14,2,21,21,33,21,33,17,20,30,2,51,
+2,176,253,135,27,35,61,45,27,187,187,50,94,134,84,80,110,67,30,25,45,61,37,
+13,31,52,39,44,59,36,15,1,33,254,223,27,45,62,34,86,86,86,10,31,58,48,3,0,
+97,102,92,140,96,49,21,38,52,32,28,43,29,15,31,59,46,28,34,67,98,65,121,97,
+253,0,48,58,31,10,0,3,0,47,254,20,4,53,4,137,0,87,0,108,0,122,0,0,1,20,14,
+2,35,52,46,2,35,34,6,7,22,22,21,20,14,2,35,34,46,2,39,14,3,21,20,30,2,51,
+51,50,30,2,21,20,14,2,35,34,38,53,52,62,2,55,46,3,53,52,54,55,46,3,53,52,
+62,2,51,50,30,2,23,62,3,51,50,30,2,1,20,30,2,51,50,62,2,53,52,46,2,35,35,
+34,14,2,19,20,22,51,50,62,2,53,52,38,35,34,6,4,53,13,26,41,28,6,15,26,21,
+26,42,20,35,45,46,91,139,93,12,30,30,26,8,20,36,27,16,19,34,47,27,232,92,
+128,81,37,65,134,205,139,214,212,42,71,92,51,21,40,32,20,64,70,44,69,47,25,
+48,96,144,97,37,72,61,49,15,15,40,50,59,34,31,45,30,15,252,160,24,60,102,
+78,110,143,84,34,27,53,78,51,201,43,81,63,38,119,87,99,50,69,44,19,84,100,
+99,85,4,31,22,39,29,17,12,24,21,13,12,13,43,117,88,76,129,94,53,1,1,3,1,10,
+24,30,38,23,25,30,17,5,46,81,113,66,88,142,99,54,158,141,60,90,64,40,9,9,
+30,42,54,33,61,89,42,18,63,81,96,51,89,140,98,52,11,19,24,13,16,39,33,22,
+17,29,39,251,24,45,78,56,32,37,66,91,54,47,61,35,14,15,42,76,3,96,131,122,
+30,62,97,67,138,132,135,0,1,0,37,0,0,4,219,6,20,0,58,0,0,37,21,33,53,51,50,
+62,2,53,17,52,46,2,35,35,53,33,17,20,6,7,6,7,51,54,51,50,30,2,21,17,20,30,
+2,51,51,21,33,17,52,46,2,35,34,14,2,21,17,20,30,2,51,2,76,253,217,16,35,61,
+45,27,27,46,61,34,16,1,121,2,2,2,2,10,92,209,87,135,92,48,24,42,58,34,6,254,
+156,24,53,86,62,64,93,61,30,27,46,61,34,86,86,86,10,31,58,48,4,74,45,55,30,
+9,86,254,62,28,61,26,30,29,186,47,97,152,105,254,28,48,58,31,10,86,2,195,
+67,104,72,37,47,87,123,75,254,80,45,55,28,9,0,2,0,47,0,0,2,117,6,20,0,24,
+0,44,0,0,55,50,62,2,53,17,52,46,2,35,35,53,33,17,20,30,2,51,51,21,33,53,19,
+52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,74,34,61,46,27,27,46,61,34,6,1,110,
+27,45,62,34,27,253,186,166,18,32,42,25,24,42,31,19,19,31,42,24,25,42,32,18,
+86,9,28,55,45,2,137,45,55,30,10,86,252,159,48,58,31,10,86,86,5,64,36,48,30,
+12,12,30,48,36,36,48,30,13,13,30,48,0,2,255,231,254,20,1,170,6,20,0,22,0,
+42,0,0,1,17,20,14,2,35,35,53,51,50,62,2,53,17,52,46,2,35,35,53,19,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,1,158,60,108,149,89,33,15,55,86,59,31,27,
+46,61,34,6,146,18,31,43,24,24,43,31,19,19,31,43,24,24,43,31,18,4,74,251,166,
+138,183,109,46,97,37,87,145,108,3,122,45,55,30,10,86,1,76,36,48,30,12,12,
+30,48,36,36,48,30,13,13,30,48,0,1,0,37,0,0,4,176,6,20,0,60,0,0,1,1,22,22,
+51,51,21,35,34,46,2,39,3,7,21,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,
+46,2,35,35,53,33,17,20,6,7,6,7,1,62,3,53,52,38,35,53,33,21,34,6,7,2,182,1,
+17,53,105,69,6,29,89,115,84,70,43,205,151,27,46,61,34,6,253,217,16,35,61,
+45,27,27,46,61,34,16,1,121,2,2,2,2,1,0,33,43,26,10,49,51,1,196,71,137,80,
+2,147,254,107,82,86,86,11,41,79,68,1,65,112,185,45,55,28,9,86,86,10,31,58,
+48,4,74,45,55,30,9,86,252,234,28,87,42,48,53,1,24,37,56,42,33,15,26,15,86,
+86,100,91,0,1,0,27,0,0,2,96,6,20,0,24,0,0,55,50,62,2,53,17,52,46,2,35,35,
+53,33,17,20,30,2,51,51,21,33,53,53,35,61,45,27,27,46,61,34,26,1,131,26,46,
+61,35,26,253,187,86,10,31,58,48,4,74,45,55,30,9,86,250,213,48,58,31,10,86,
+86,0,1,0,57,0,0,7,86,4,94,0,87,0,0,37,21,33,53,51,50,62,2,53,17,52,46,2,35,
+35,53,33,23,51,62,3,51,50,30,2,23,51,62,3,51,50,30,2,21,17,20,30,2,51,51,
+21,33,17,52,46,2,35,34,14,2,21,17,20,30,2,51,51,21,33,17,52,46,2,35,34,14,
+2,21,17,20,30,2,51,2,96,253,217,27,35,58,42,23,24,42,58,34,6,1,65,27,10,31,
+68,77,85,48,50,90,77,61,19,17,31,72,81,89,48,78,124,86,46,24,42,58,34,6,254,
+156,23,51,82,59,64,87,54,23,24,42,58,34,6,254,156,23,51,82,59,67,91,56,24,
+27,46,61,34,86,86,86,10,31,58,48,2,127,45,55,30,10,86,166,57,73,41,15,20,
+44,71,51,57,73,41,15,47,97,152,105,254,28,48,58,31,10,86,2,195,67,104,72,
+37,49,84,110,62,254,63,48,58,31,10,86,2,195,67,104,72,37,54,92,120,66,254,
+80,45,55,28,9,0,1,0,57,0,0,4,240,4,94,0,56,0,0,37,21,33,53,51,50,62,2,53,
+17,52,46,2,35,35,53,33,23,51,62,3,51,50,30,2,21,17,20,30,2,51,51,21,33,17,
+52,46,2,35,34,14,2,21,17,20,30,2,51,2,96,253,217,17,35,61,45,27,27,46,61,
+34,6,1,75,27,10,32,71,79,89,49,81,127,89,47,23,42,58,34,7,254,155,24,53,86,
+62,70,95,58,25,27,46,61,34,86,86,86,10,31,58,48,2,127,45,55,30,10,86,166,
+57,73,41,15,47,97,152,105,254,28,48,58,31,10,86,2,195,67,104,72,37,54,92,
+120,66,254,80,45,55,28,9,0,2,0,113,255,236,4,45,4,94,0,15,0,35,0,0,1,16,2,
+35,34,46,2,53,16,18,51,50,30,2,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,
+4,45,245,236,111,176,123,65,243,238,111,176,123,65,253,10,30,67,107,77,77,
+106,66,29,30,66,107,77,77,106,66,30,2,39,254,223,254,230,70,142,215,144,1,
+31,1,24,69,141,213,144,114,174,117,60,60,117,174,114,114,172,115,58,58,115,
+172,0,2,0,27,254,20,4,121,4,94,0,19,0,74,0,0,1,34,14,2,21,20,30,2,51,50,62,
+2,53,52,46,2,1,20,14,2,35,34,46,2,39,35,22,23,30,3,21,21,20,30,2,51,51,21,
+33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,23,51,62,3,51,50,30,2,2,180,80,
+107,64,27,27,65,107,81,68,95,61,28,28,61,97,1,129,55,106,156,101,59,96,77,
+59,22,8,2,2,1,1,1,1,27,46,61,34,6,253,217,16,35,61,45,27,27,46,61,34,26,1,
+102,21,8,23,58,76,96,60,101,156,106,55,3,219,53,108,164,111,107,164,112,57,
+57,112,165,108,109,163,108,54,254,76,148,216,140,67,26,48,66,40,53,46,19,
+41,36,29,8,196,45,55,29,9,86,86,10,31,59,48,4,106,45,55,30,10,86,185,47,76,
+53,29,67,139,214,0,2,0,113,254,20,4,197,4,94,0,52,0,70,0,0,1,33,53,51,50,
+62,2,53,53,52,54,55,54,55,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,51,
+55,33,21,35,34,14,2,21,17,20,30,2,51,51,1,50,62,2,53,52,46,2,35,34,14,2,21,
+20,22,4,197,253,155,68,35,61,45,27,2,2,2,2,8,23,59,76,96,60,101,156,106,54,
+54,106,156,101,59,96,77,60,22,12,37,1,72,17,34,62,45,27,27,46,61,34,17,253,
+112,80,107,65,27,27,65,108,81,67,96,61,28,118,254,20,86,10,31,59,48,176,35,
+91,42,48,50,47,75,53,29,67,139,214,147,148,216,140,67,26,48,66,40,160,86,
+10,31,59,48,251,150,45,55,30,10,2,5,53,108,164,111,107,164,111,58,58,112,
+165,107,218,216,0,1,0,68,0,0,3,166,4,94,0,49,0,0,33,33,53,51,50,62,2,53,17,
+52,46,2,35,35,53,33,23,51,62,3,51,50,22,21,20,14,2,35,52,38,35,34,14,4,21,
+17,20,30,2,51,51,2,147,253,177,6,35,61,45,27,27,46,61,34,6,1,59,39,10,20,
+42,61,90,68,112,109,21,46,72,52,48,60,38,60,45,31,19,8,27,46,61,34,57,86,
+10,31,58,48,2,127,45,55,30,10,86,203,46,81,61,35,78,71,32,54,39,21,85,75,
+43,71,92,97,96,39,254,190,45,55,28,9,0,1,0,92,255,236,3,66,4,92,0,65,0,0,
+5,34,46,2,53,52,62,2,51,20,30,2,51,50,62,2,53,52,46,2,39,46,3,53,52,62,2,
+51,50,30,2,21,20,6,35,52,38,35,34,14,2,21,20,30,2,23,30,3,21,20,14,2,1,174,
+77,125,88,48,27,39,45,18,22,52,85,62,55,84,57,30,23,57,98,74,79,117,76,38,
+55,102,142,87,73,112,76,38,77,71,85,91,52,74,47,22,28,61,97,68,81,116,75,
+36,58,106,149,20,27,55,81,54,41,55,32,13,54,94,71,41,27,49,69,41,38,55,48,
+50,32,35,65,76,97,67,70,108,73,38,30,51,69,38,56,67,103,114,24,44,60,36,39,
+57,48,45,28,34,66,78,98,64,80,120,81,40,0,1,0,39,255,236,2,162,5,70,0,31,
+0,0,37,50,54,55,21,14,3,35,34,46,2,53,17,35,53,50,54,55,54,54,55,51,21,33,
+21,33,17,20,22,2,31,37,62,32,13,42,49,54,24,78,112,72,35,156,37,89,34,35,
+43,16,94,1,12,254,244,85,88,8,6,90,6,12,9,5,33,74,122,88,2,172,82,30,35,38,
+105,79,252,117,253,78,105,98,0,1,0,47,255,236,4,229,4,74,0,49,0,0,37,20,30,
+2,51,51,21,33,39,35,14,3,35,34,46,2,53,17,52,46,2,35,35,53,33,17,20,30,2,
+51,50,62,2,53,17,52,46,2,35,35,53,33,4,55,27,46,61,34,6,254,187,27,10,31,
+75,84,92,50,81,126,86,45,27,46,61,34,6,1,111,21,49,83,62,68,97,63,30,27,45,
+61,35,6,1,110,223,45,55,28,9,86,166,58,72,41,15,46,98,152,105,1,235,45,55,
+30,10,86,253,61,67,104,72,37,48,87,122,74,1,166,48,59,31,10,86,0,1,0,8,0,
+0,4,156,4,74,0,47,0,0,19,53,33,21,35,34,6,21,20,22,23,19,30,3,23,51,62,3,
+55,19,54,54,53,52,38,35,35,53,33,21,35,34,14,2,7,1,35,1,46,3,35,8,2,0,26,
+62,61,8,8,139,13,28,25,20,4,7,5,23,29,31,14,147,10,9,67,68,15,1,183,25,30,
+42,34,31,19,254,189,187,254,183,12,26,34,44,30,3,244,86,86,48,51,17,35,23,
+254,125,36,87,84,75,26,22,65,77,80,37,1,143,25,46,17,53,48,86,86,13,36,62,
+49,252,172,3,135,32,42,25,10,0,1,0,2,0,0,6,227,4,74,0,63,0,0,1,19,30,3,23,
+51,54,54,55,19,54,54,53,52,38,35,35,53,33,21,35,34,14,2,7,1,35,3,39,1,35,
+1,46,3,35,35,53,33,21,35,34,6,21,20,22,23,19,30,3,23,51,62,3,55,19,3,207,
+205,12,27,24,20,5,6,9,40,31,102,8,11,67,69,14,1,182,26,30,44,35,30,15,254,
+248,164,244,37,254,222,162,254,244,12,26,34,44,30,6,1,250,27,61,62,11,6,96,
+10,22,19,16,5,6,5,17,23,26,13,213,4,68,253,161,37,85,83,74,26,51,149,99,1,
+74,26,59,17,53,48,86,86,12,35,62,51,252,172,2,209,135,252,168,3,135,32,42,
+25,10,86,86,36,50,17,48,23,254,168,37,88,87,76,26,26,69,79,82,37,2,107,0,
+1,0,10,0,0,4,150,4,74,0,72,0,0,1,52,38,35,35,53,33,21,35,34,14,2,7,3,1,22,
+22,51,51,21,33,53,51,50,53,52,46,2,39,39,7,14,3,21,20,22,51,51,21,33,53,51,
+50,62,2,55,1,1,38,38,35,35,53,33,21,35,34,14,2,21,20,22,23,23,55,54,54,3,
+18,63,47,6,1,192,18,30,49,47,50,31,211,1,45,45,81,38,27,253,239,10,123,6,
+18,30,24,137,143,9,20,16,10,58,69,6,254,24,19,37,56,50,50,30,1,2,254,254,
+45,85,46,27,2,8,6,35,46,26,10,25,23,135,106,23,28,3,184,37,23,86,86,10,28,
+52,41,254,231,254,107,60,49,86,86,68,11,23,31,44,32,184,200,12,32,34,35,16,
+35,29,86,86,12,30,51,38,1,78,1,96,53,56,86,86,9,17,22,12,21,41,32,184,153,
+35,62,0,1,0,8,254,20,4,133,4,74,0,58,0,0,1,21,35,34,14,2,7,1,14,5,35,35,53,
+50,62,2,55,1,46,3,35,35,53,33,21,35,34,6,21,20,22,23,19,30,3,23,51,54,54,
+55,19,54,54,53,52,38,35,35,53,4,133,6,30,43,35,30,18,254,201,36,64,70,83,
+106,138,91,18,104,150,109,73,25,254,133,14,26,33,43,30,6,1,236,6,62,61,7,
+9,150,14,31,27,22,4,6,11,39,26,137,9,9,67,68,6,4,74,86,13,36,62,49,252,164,
+99,150,107,70,42,16,97,62,108,147,86,3,127,32,41,26,10,86,86,48,51,17,35,
+23,254,147,35,83,81,72,26,45,129,74,1,143,25,46,17,53,48,86,0,1,0,86,0,0,
+3,164,4,74,0,23,0,0,37,50,62,2,55,55,51,3,33,53,1,33,34,14,2,7,7,35,19,33,
+21,1,2,184,36,47,31,19,7,10,86,10,252,188,2,82,254,192,40,52,33,21,11,2,86,
+20,3,17,253,172,117,28,46,61,33,47,254,180,82,3,131,21,42,62,41,8,1,35,84,
+252,127,0,1,0,102,254,250,3,6,6,20,0,41,0,0,1,34,46,2,53,17,52,46,2,39,53,
+62,3,53,17,52,54,51,51,21,35,34,6,21,17,20,6,7,21,22,22,21,17,20,22,51,51,
+21,2,127,72,111,74,38,37,66,88,51,51,88,66,37,149,146,135,61,91,77,113,115,
+118,110,77,91,61,254,250,42,76,109,68,1,100,63,82,49,21,2,86,2,20,49,82,62,
+1,101,140,152,88,108,107,254,162,100,133,19,2,20,132,102,254,158,105,110,
+88,0,1,1,254,254,20,2,121,6,20,0,3,0,0,1,35,17,51,2,121,123,123,254,20,8,
+0,0,1,0,102,254,250,3,6,6,20,0,41,0,0,23,51,50,54,53,17,52,54,55,53,38,38,
+53,17,52,38,35,35,53,51,50,22,21,17,20,30,2,23,21,14,3,21,17,20,14,2,35,35,
+102,62,91,77,109,118,114,113,77,91,62,136,145,149,38,65,88,51,51,88,65,38,
+38,74,110,72,136,174,110,105,1,98,102,132,20,2,19,133,100,1,94,107,108,88,
+152,140,254,155,62,82,49,20,2,86,2,21,49,82,63,254,156,68,109,76,42,0,1,0,
+111,2,39,4,8,3,141,0,37,0,0,1,34,46,2,39,46,3,35,34,6,7,35,62,3,51,50,30,
+2,23,30,3,51,50,54,55,51,14,3,3,6,30,64,63,57,23,23,44,43,44,23,60,58,11,
+120,6,25,56,95,76,34,68,64,57,24,22,42,41,42,21,57,54,14,123,7,28,57,93,2,
+39,25,38,45,21,21,39,30,18,116,121,64,128,102,64,26,40,48,21,20,37,28,17,
+123,114,64,128,102,64,0,2,0,211,254,145,1,213,4,86,0,3,0,23,0,0,1,35,19,51,
+19,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,203,238,72,94,82,20,35,47,27,
+26,47,35,21,21,35,47,26,27,47,35,20,254,145,4,27,1,31,40,54,32,14,14,32,54,
+40,39,53,33,14,14,33,53,0,2,0,162,0,0,3,248,5,182,0,38,0,47,0,0,37,46,3,53,
+52,62,2,55,53,51,21,30,3,21,20,6,35,52,46,2,39,17,50,62,2,55,21,6,6,7,21,
+35,3,20,22,23,17,14,3,2,72,93,155,112,62,66,114,154,88,102,59,118,94,59,91,
+91,18,36,56,38,42,85,78,68,24,53,153,91,102,224,109,115,49,82,60,33,180,10,
+71,133,203,142,152,212,135,67,8,149,149,5,29,51,74,48,71,58,42,77,61,42,7,
+252,115,12,19,23,11,112,28,44,2,176,2,229,183,218,31,3,129,9,57,109,169,0,
+1,0,100,255,236,4,61,5,203,0,81,0,0,1,22,22,21,20,6,7,23,54,54,51,50,30,2,
+51,50,62,2,55,21,14,3,35,34,46,2,35,34,6,7,7,53,55,62,3,53,52,38,39,35,53,
+51,46,3,53,52,62,2,51,50,30,2,21,20,6,35,52,46,2,35,34,6,21,20,30,2,23,33,
+21,1,244,15,26,99,82,5,42,73,34,41,98,97,89,31,36,61,54,45,19,18,50,66,83,
+51,51,98,100,103,55,68,118,66,27,37,38,75,60,38,30,21,228,189,14,28,22,14,
+58,108,155,97,99,138,86,39,87,75,17,45,81,65,119,111,16,24,28,12,1,92,2,178,
+51,106,62,88,135,55,9,20,17,24,30,24,21,34,43,23,133,25,54,44,28,29,34,29,
+39,31,12,108,23,23,65,85,104,61,60,115,56,96,32,78,85,89,42,88,138,95,50,
+35,62,84,49,66,67,48,93,73,46,136,128,48,92,85,75,30,96,0,2,0,131,1,37,3,
+244,4,152,0,35,0,55,0,0,19,52,54,55,39,55,23,54,54,51,50,22,23,55,23,7,22,
+22,21,20,6,7,23,7,39,6,6,35,34,38,39,7,39,55,38,38,55,20,30,2,51,50,62,2,
+53,52,46,2,35,34,14,2,197,35,34,135,86,133,47,111,63,60,111,46,138,86,135,
+34,37,37,34,135,84,137,47,111,62,62,110,47,135,86,133,32,35,114,41,71,94,
+54,56,96,70,41,41,70,96,56,54,94,71,41,2,221,62,111,46,135,87,136,34,38,38,
+34,138,89,135,46,111,62,62,111,46,135,86,135,32,38,36,34,135,86,135,46,111,
+62,54,95,71,42,42,71,95,54,56,96,71,41,41,71,96,0,1,0,10,0,0,4,111,5,182,
+0,76,0,0,33,53,51,50,62,2,55,53,33,53,33,53,33,53,51,1,46,3,35,35,53,33,21,
+35,34,6,21,20,22,23,23,30,3,23,62,3,55,55,54,54,53,52,38,35,35,53,33,21,35,
+34,14,2,7,3,51,21,33,21,33,21,33,21,20,30,2,51,51,21,1,8,47,34,60,45,27,2,
+254,226,1,30,254,226,247,254,234,15,26,33,42,30,6,1,242,14,62,55,16,17,98,
+15,28,25,20,6,4,18,23,25,10,117,24,25,57,68,6,1,162,19,26,38,33,35,23,250,
+254,254,225,1,31,254,225,27,45,61,35,47,86,9,28,55,45,139,97,143,96,2,58,
+30,41,26,11,86,86,38,42,24,61,35,218,32,74,72,62,20,11,43,51,53,21,249,54,
+91,23,42,40,86,86,14,36,62,47,253,249,96,143,97,129,48,58,31,10,86,0,2,1,
+254,254,20,2,121,6,20,0,3,0,7,0,0,1,35,17,51,17,35,17,51,2,121,123,123,123,
+123,2,225,3,51,248,0,3,52,0,2,0,160,255,23,3,242,6,20,0,21,0,99,0,0,1,38,
+38,39,6,6,21,20,30,2,23,22,22,23,54,54,53,52,46,2,3,50,54,53,52,46,2,39,46,
+3,53,52,54,55,38,38,53,52,62,2,51,50,30,2,21,20,6,35,52,46,2,35,34,6,21,20,
+30,2,23,30,3,21,20,14,2,7,22,22,21,20,14,2,35,34,46,2,53,52,62,2,51,20,30,
+2,2,86,74,129,53,22,29,28,68,115,88,62,120,49,17,22,20,57,103,109,126,124,
+22,75,143,120,81,115,72,33,68,53,38,38,57,100,139,81,84,125,83,41,79,66,20,
+47,75,55,102,113,41,81,118,78,87,126,82,39,21,34,44,24,29,34,45,95,149,104,
+79,129,92,50,27,39,45,18,27,57,89,3,27,35,68,42,20,56,41,41,65,63,66,43,31,
+63,43,24,58,34,35,62,64,69,252,137,111,94,45,67,67,81,59,40,83,92,105,61,
+77,115,37,45,111,74,78,121,83,43,35,61,84,49,66,59,48,90,71,43,102,97,54,
+73,59,56,38,42,84,91,102,60,37,73,67,59,24,40,100,63,81,134,97,54,31,60,88,
+58,42,55,33,13,54,101,78,47,0,2,1,35,5,14,3,121,5,244,0,17,0,35,0,0,1,52,
+62,2,51,50,30,2,21,20,14,2,35,34,38,37,52,62,2,51,50,30,2,21,20,14,2,35,34,
+38,1,35,16,28,38,22,22,38,29,16,16,29,38,22,45,59,1,133,16,28,38,22,22,38,
+29,16,16,29,38,22,45,59,5,129,32,44,27,12,12,27,44,32,31,44,28,12,52,63,32,
+44,27,12,12,27,44,32,31,44,28,12,52,0,3,0,113,255,236,6,82,5,205,0,45,0,73,
+0,101,0,0,1,50,62,2,55,22,22,21,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,
+21,20,14,2,35,52,46,2,35,34,14,2,21,20,22,1,52,62,4,51,50,30,4,21,20,14,4,
+35,34,46,4,55,20,30,4,51,50,62,4,53,52,46,4,35,34,14,4,3,133,47,80,64,47,
+14,12,17,39,77,115,77,102,153,103,51,56,111,163,108,71,105,70,35,22,38,51,
+29,15,34,55,41,72,101,64,29,138,253,110,54,97,137,167,192,104,104,193,167,
+138,98,54,54,98,138,167,193,104,104,192,167,137,97,54,112,46,83,117,142,163,
+88,89,164,142,117,83,46,46,83,117,142,164,89,88,163,142,117,83,46,1,109,24,
+40,50,25,9,33,22,28,58,48,30,66,120,168,103,100,166,120,67,23,39,53,31,22,
+36,25,13,29,55,45,27,48,94,136,89,177,191,1,110,104,193,167,138,98,54,54,
+98,138,167,193,104,104,192,167,137,98,53,53,98,137,167,192,104,88,163,142,
+117,83,46,46,83,117,142,163,88,88,164,143,117,83,46,46,83,117,143,163,0,2,
+0,72,3,10,2,236,5,193,0,14,0,58,0,0,19,20,22,51,50,62,2,53,53,7,14,3,19,34,
+14,2,21,34,38,53,52,62,2,51,50,30,2,21,17,20,22,51,21,35,39,35,14,3,35,34,
+38,53,52,54,55,55,53,52,46,2,250,54,40,34,54,37,20,63,50,67,41,18,137,31,
+38,21,8,78,84,42,72,96,54,68,100,67,33,39,50,199,37,10,18,43,53,64,39,99,
+114,162,167,88,7,21,40,3,217,64,49,24,44,60,36,97,3,1,21,37,52,1,122,22,38,
+51,29,41,48,35,48,30,14,24,53,84,61,254,201,46,34,69,94,20,39,30,18,106,103,
+102,97,8,4,59,31,51,37,21,0,2,0,133,0,164,3,152,3,174,0,6,0,13,0,0,19,1,51,
+3,19,35,1,37,1,51,3,19,35,1,133,1,57,103,207,207,103,254,199,1,115,1,57,103,
+207,207,103,254,199,2,74,1,100,254,123,254,123,1,100,66,1,100,254,123,254,
+123,1,100,0,1,0,133,0,252,3,244,3,25,0,5,0,0,1,17,35,17,33,53,3,244,123,253,
+12,3,25,253,227,1,164,121,255,255,0,51,1,225,2,72,2,123,18,2,0,16,0,0,0,4,
+0,113,255,236,6,82,5,205,0,41,0,54,0,82,0,110,0,0,1,51,50,62,2,55,17,46,3,
+35,35,53,33,32,21,20,14,2,7,19,30,3,51,21,35,3,35,21,30,3,51,51,21,33,1,51,
+50,62,2,53,52,46,2,35,35,1,52,62,4,51,50,30,4,21,20,14,4,35,34,46,4,55,20,
+30,4,51,50,62,4,53,52,46,4,35,34,14,4,1,221,27,20,36,27,16,1,1,16,27,36,20,
+27,1,113,1,96,32,52,67,35,182,10,19,26,35,25,217,226,108,2,16,27,35,20,29,
+254,102,1,25,86,55,74,44,19,22,47,75,54,80,253,123,54,97,137,167,192,104,
+104,193,167,138,98,54,54,98,138,167,193,104,104,192,167,137,97,54,112,46,
+83,117,142,163,88,89,164,142,117,83,46,46,83,117,142,164,89,88,163,142,117,
+83,46,1,102,5,15,28,24,2,88,24,29,15,4,72,244,49,74,54,37,11,254,219,17,21,
+12,4,69,1,125,240,24,28,15,5,69,1,203,22,44,68,46,45,64,39,18,254,149,104,
+193,167,138,98,54,54,98,138,167,193,104,104,192,167,137,98,53,53,98,137,167,
+192,104,88,163,142,117,83,46,46,83,117,142,163,88,88,164,143,117,83,46,46,
+83,117,143,163,0,1,255,246,6,20,3,182,6,141,0,3,0,0,1,33,53,33,3,182,252,
+64,3,192,6,20,121,0,2,0,98,3,74,2,207,5,182,0,19,0,39,0,0,19,52,62,2,51,50,
+30,2,21,20,14,2,35,34,46,2,55,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,98,
+49,84,113,64,65,113,84,49,49,84,113,65,64,113,84,49,123,29,51,68,39,40,68,
+51,29,29,51,68,40,39,68,51,29,4,127,65,113,84,49,49,84,113,65,64,113,84,48,
+48,84,113,64,38,69,51,30,30,51,69,38,40,69,51,30,30,51,69,0,2,0,133,0,0,3,
+244,4,147,0,11,0,15,0,0,1,17,35,17,33,53,33,17,51,17,33,21,17,33,53,33,2,
+121,123,254,135,1,121,123,1,123,252,145,3,111,2,160,254,133,1,123,121,1,122,
+254,134,121,253,96,121,0,1,0,86,2,74,2,203,5,203,0,41,0,0,1,20,14,2,7,7,33,
+50,54,55,55,51,3,33,53,37,62,3,53,52,46,2,35,34,14,2,21,34,38,53,52,62,2,
+51,50,22,2,178,22,52,85,64,217,1,41,47,37,6,8,70,6,253,145,1,4,45,62,37,16,
+13,29,46,33,37,52,32,14,69,79,36,71,106,70,143,162,4,238,48,84,84,90,55,186,
+50,34,43,255,0,92,233,41,84,85,84,40,34,57,42,23,29,49,65,35,34,54,37,63,
+46,26,113,0,1,0,82,2,61,2,207,5,203,0,63,0,0,1,34,38,53,52,54,51,20,30,2,
+51,50,54,53,52,38,35,35,53,51,50,62,2,53,52,38,35,34,14,2,21,34,46,2,53,52,
+62,2,51,50,30,2,21,20,14,2,7,21,30,3,21,20,14,2,1,100,134,140,51,43,21,43,
+65,45,85,97,104,113,67,67,39,66,50,28,54,63,39,52,31,13,35,57,39,21,37,73,
+107,70,68,112,80,43,34,57,76,42,41,86,71,46,67,106,128,2,61,93,75,45,56,32,
+63,50,31,83,95,72,85,84,25,46,65,41,68,71,29,49,65,35,7,20,34,27,37,63,46,
+26,28,52,75,48,45,71,54,39,12,10,7,25,46,73,56,75,103,63,28,0,1,1,135,4,217,
+3,20,6,33,0,13,0,0,1,62,3,55,51,21,14,3,7,35,1,135,23,49,47,43,16,219,19,
+74,90,95,41,78,4,244,29,76,81,81,34,21,27,81,88,83,28,0,1,0,176,254,20,4,
+150,4,74,0,55,0,0,5,34,38,39,30,3,23,20,14,2,35,34,46,2,53,52,62,2,55,17,
+51,17,20,30,2,51,50,62,2,53,17,51,17,20,30,2,51,51,21,35,34,38,39,35,14,3,
+2,57,86,123,41,2,10,33,64,57,17,35,54,37,32,60,46,28,7,8,9,1,192,20,47,79,
+59,57,92,64,35,192,24,37,46,22,7,111,84,96,19,8,24,55,69,85,20,63,57,85,144,
+108,67,9,39,65,48,27,24,57,94,69,61,141,171,208,128,2,125,253,80,67,110,79,
+43,48,87,122,74,2,144,252,190,45,67,44,22,86,83,81,41,68,48,27,0,1,0,82,255,
+29,4,156,6,20,0,39,0,0,1,35,17,33,53,51,50,62,2,53,17,35,34,46,2,53,52,62,
+2,51,33,21,35,34,14,2,21,17,20,30,2,51,51,21,33,3,92,194,254,192,27,35,61,
+45,27,146,90,120,72,31,34,76,120,87,3,13,27,34,62,45,27,27,45,62,34,27,254,
+192,5,172,249,113,86,10,31,58,48,3,17,65,111,145,80,82,134,96,52,86,10,31,
+58,48,250,219,48,58,31,10,86,0,1,0,127,2,78,1,129,3,100,0,19,0,0,19,52,62,
+2,51,50,30,2,21,20,14,2,35,34,46,2,127,20,35,47,27,26,47,35,21,21,35,47,26,
+27,47,35,20,2,217,40,54,32,13,13,32,54,40,39,53,33,14,14,33,53,0,1,0,123,
+254,20,2,39,0,18,0,23,0,0,1,20,6,35,34,46,2,39,53,22,22,51,50,54,53,52,38,
+39,55,51,7,22,22,2,39,139,131,16,40,42,42,18,37,74,28,59,66,87,67,43,97,21,
+100,99,254,254,109,125,3,6,9,5,104,8,8,62,53,60,60,5,159,88,8,99,0,1,0,86,
+2,76,2,176,5,193,0,31,0,0,1,14,3,35,34,38,53,62,3,55,51,17,20,30,2,51,51,
+21,33,53,51,50,62,2,53,17,1,59,24,38,35,36,22,34,40,24,45,68,102,81,102,14,
+23,31,18,94,253,207,113,18,30,23,13,5,45,24,35,21,10,47,37,4,6,27,60,57,253,
+30,26,31,16,5,69,69,5,16,31,26,2,78,0,2,0,72,3,10,2,229,5,193,0,11,0,25,0,
+0,19,20,22,51,50,54,53,52,38,35,34,6,5,20,6,35,34,38,53,52,54,51,50,30,2,
+250,70,88,86,71,73,86,86,70,1,235,170,165,158,176,170,168,77,122,86,46,4,
+102,133,133,133,133,131,129,129,131,176,172,173,175,176,171,43,86,130,0,2,
+0,133,0,164,3,152,3,174,0,6,0,13,0,0,1,1,35,19,3,51,1,5,1,35,19,3,51,1,3,
+152,254,198,102,207,207,102,1,58,254,141,254,199,103,207,207,103,1,57,2,8,
+254,156,1,133,1,133,254,156,66,254,156,1,133,1,133,254,156,255,255,0,21,0,
+0,6,137,5,193,16,34,0,123,191,0,16,35,2,21,3,31,0,0,16,3,2,57,3,129,253,181,
+255,255,0,21,0,0,6,109,5,193,16,34,0,123,191,0,16,35,2,21,2,246,0,0,16,3,
+0,116,3,162,253,183,255,255,0,82,0,0,6,137,5,203,16,34,0,117,0,0,16,35,2,
+21,3,72,0,0,16,3,2,57,3,129,253,181,0,2,0,104,254,123,3,168,4,84,0,37,0,57,
+0,0,1,51,17,14,3,21,20,30,2,51,50,62,2,53,50,30,2,21,20,14,2,35,34,46,2,53,
+52,62,2,55,19,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,246,125,89,121,73,
+31,26,54,85,59,64,87,54,24,37,62,45,26,45,95,144,99,97,164,120,68,53,102,
+148,95,194,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,2,170,254,201,
+36,96,110,120,62,53,87,62,34,42,72,95,53,17,33,50,33,49,84,61,35,50,95,138,
+88,84,139,114,93,39,2,6,40,54,32,14,14,32,54,40,39,53,33,14,14,33,53,255,
+255,0,0,0,0,5,164,7,115,18,34,0,36,0,0,16,3,0,67,0,14,1,82,255,255,0,0,0,
+0,5,164,7,115,18,34,0,36,0,0,16,3,0,118,0,246,1,82,255,255,0,0,0,0,5,164,
+7,115,18,34,0,36,0,0,16,3,1,75,0,133,1,82,255,255,0,0,0,0,5,164,7,49,18,34,
+0,36,0,0,16,3,1,82,0,133,1,82,255,255,0,0,0,0,5,164,7,70,18,34,0,36,0,0,16,
+3,0,106,0,133,1,82,255,255,0,0,0,0,5,164,7,16,18,34,0,36,0,0,16,3,1,80,1,
+129,0,141,0,2,0,0,0,0,7,70,5,182,0,51,0,59,0,0,37,33,50,62,2,55,55,51,3,33,
+53,51,50,62,2,55,17,33,7,6,6,21,20,22,51,51,21,33,53,51,50,54,55,1,39,53,
+33,19,35,39,46,3,39,33,17,33,21,33,0,14,2,7,33,17,35,4,127,1,139,48,69,46,
+26,6,14,107,15,251,183,26,34,60,45,28,1,254,41,113,17,15,63,60,47,254,14,
+33,54,85,43,2,80,160,4,111,10,106,11,4,22,43,65,46,254,168,1,238,254,18,254,
+251,82,103,118,61,1,162,29,102,27,46,61,34,88,254,154,86,9,28,55,45,1,10,
+215,32,58,18,42,38,86,86,76,84,4,96,10,86,254,154,88,34,60,45,28,1,253,223,
+100,2,77,166,201,228,117,3,0,255,255,0,117,254,20,4,164,5,203,18,34,0,38,
+0,0,16,3,0,122,1,135,0,0,255,255,0,78,0,0,4,166,7,115,18,34,0,40,0,0,16,3,
+0,67,255,208,1,82,255,255,0,78,0,0,4,166,7,115,18,34,0,40,0,0,16,3,0,118,
+0,154,1,82,255,255,0,78,0,0,4,166,7,115,18,34,0,40,0,0,16,3,1,75,0,61,1,82,
+255,255,0,78,0,0,4,166,7,70,18,34,0,40,0,0,16,3,0,106,0,51,1,82,255,255,0,
+75,0,0,2,162,7,115,18,34,0,44,0,0,16,3,0,67,254,194,1,82,255,255,0,78,0,0,
+2,162,7,115,18,34,0,44,0,0,16,3,0,118,255,136,1,82,255,255,0,73,0,0,2,165,
+7,115,18,34,0,44,0,0,16,3,1,75,255,40,1,82,255,255,0,73,0,0,2,162,7,70,18,
+34,0,44,0,0,16,3,0,106,255,38,1,82,0,2,0,78,0,0,5,92,5,182,0,30,0,47,0,0,
+19,51,17,52,46,2,35,35,53,33,50,22,22,18,21,20,2,6,6,35,33,53,51,50,62,2,
+53,17,35,1,50,62,2,53,52,46,2,35,35,17,33,21,33,17,78,194,27,46,61,34,26,
+2,115,158,248,171,90,84,166,251,166,253,141,26,35,61,46,26,194,2,67,122,183,
+122,61,61,121,183,121,180,1,92,254,164,3,47,1,166,45,55,30,9,86,97,186,254,
+240,174,168,254,241,191,103,86,10,31,58,48,1,226,253,157,83,160,234,152,152,
+234,159,82,253,223,100,253,157,255,255,0,78,0,0,5,225,7,49,18,34,0,49,0,0,
+16,3,1,82,0,217,1,82,255,255,0,115,255,236,5,123,7,115,18,34,0,50,0,0,16,
+3,0,67,0,70,1,82,255,255,0,115,255,236,5,123,7,115,18,34,0,50,0,0,16,3,0,
+118,1,2,1,82,255,255,0,115,255,236,5,123,7,115,18,34,0,50,0,0,16,3,1,75,0,
+170,1,82,255,255,0,115,255,236,5,123,7,49,18,34,0,50,0,0,16,3,1,82,0,156,
+1,82,255,255,0,115,255,236,5,123,7,70,18,34,0,50,0,0,16,3,0,106,0,164,1,82,
+0,1,0,145,1,51,3,229,4,137,0,11,0,0,1,1,39,1,1,55,1,1,23,1,1,7,2,59,254,172,
+86,1,84,254,172,86,1,84,1,84,86,254,172,1,84,86,2,135,254,172,88,1,84,1,82,
+86,254,172,1,86,88,254,172,254,172,86,0,3,0,115,255,174,5,123,6,10,0,27,0,
+38,0,49,0,0,1,22,18,21,20,2,6,6,35,34,38,39,7,35,55,38,2,53,52,18,54,54,51,
+50,22,23,55,51,1,20,22,23,1,38,35,34,14,2,5,52,38,39,1,22,51,50,62,2,4,139,
+118,122,84,164,240,155,93,159,66,71,121,104,121,118,80,160,244,163,91,156,
+66,76,119,252,96,45,51,2,60,94,154,114,160,101,45,3,66,45,50,253,197,95,155,
+114,159,99,44,5,74,97,254,196,208,169,254,234,198,108,35,34,131,188,98,1,
+65,210,170,1,21,196,107,39,35,135,252,211,155,236,84,4,10,82,86,164,239,152,
+153,237,83,251,244,80,87,165,239,255,255,0,31,255,236,5,158,7,115,18,34,0,
+56,0,0,16,3,0,67,0,61,1,82,255,255,0,31,255,236,5,158,7,115,18,34,0,56,0,
+0,16,3,0,118,1,2,1,82,255,255,0,31,255,236,5,158,7,115,18,34,0,56,0,0,16,
+3,1,75,0,182,1,82,255,255,0,31,255,236,5,158,7,70,18,34,0,56,0,0,16,3,0,106,
+0,186,1,82,255,255,255,246,0,0,5,6,7,115,18,34,0,60,0,0,16,3,0,118,0,176,
+1,82,0,2,0,78,0,0,4,133,5,182,0,42,0,55,0,0,51,53,51,50,62,2,53,17,52,46,
+2,35,35,53,33,21,35,34,14,2,21,21,51,32,22,21,20,14,2,35,35,21,20,30,2,51,
+51,21,3,51,50,62,2,53,52,46,2,35,35,78,26,35,61,46,26,26,46,61,35,26,2,104,
+47,34,62,45,27,174,1,2,246,57,130,210,152,129,27,45,62,34,47,215,109,93,132,
+84,39,34,76,121,87,139,86,10,31,58,48,3,228,48,58,31,10,86,86,10,31,58,48,
+62,207,200,91,162,122,70,82,48,58,31,10,86,1,156,33,79,131,97,86,120,76,35,
+0,1,0,47,255,236,4,211,6,27,0,85,0,0,37,50,54,53,52,46,2,39,46,3,53,52,62,
+2,51,52,46,2,35,34,14,2,21,17,33,53,51,50,62,2,53,17,35,53,51,53,52,62,2,
+51,50,30,2,23,35,34,6,21,20,30,2,23,30,3,21,20,14,2,35,34,46,2,53,52,62,2,
+51,20,30,2,3,119,75,97,15,44,78,62,64,98,65,33,41,83,127,87,28,62,97,69,62,
+93,62,31,254,125,27,35,61,45,27,166,166,68,119,161,94,128,170,103,44,1,149,
+109,102,20,50,82,61,77,98,56,21,48,89,128,81,72,118,84,46,24,36,41,16,21,
+47,77,78,92,94,34,58,54,54,30,32,62,76,96,65,62,102,73,40,97,139,90,42,40,
+73,104,65,251,92,86,10,31,58,48,3,0,97,61,113,154,95,42,73,141,208,135,83,
+83,31,51,47,47,29,35,79,86,90,46,78,120,80,41,27,55,81,54,41,55,32,13,54,
+94,71,41,255,255,0,102,255,236,4,41,6,33,18,34,0,68,0,0,16,2,0,67,132,0,255,
+255,0,102,255,236,4,41,6,33,18,34,0,68,0,0,16,2,0,118,80,0,255,255,0,102,
+255,236,4,41,6,33,18,34,0,68,0,0,16,2,1,75,228,0,255,255,0,102,255,236,4,
+41,5,223,18,34,0,68,0,0,16,2,1,82,237,0,255,255,0,102,255,236,4,41,5,244,
+18,34,0,68,0,0,16,2,0,106,222,0,255,255,0,102,255,236,4,41,6,131,18,34,0,
+68,0,0,16,3,1,80,0,233,0,0,0,3,0,102,255,236,6,84,4,94,0,16,0,25,0,91,0,0,
+1,20,22,51,50,62,2,61,3,7,14,3,1,34,6,7,33,52,46,2,3,34,38,39,14,3,35,34,
+46,2,53,52,54,55,55,53,52,46,2,35,34,14,2,21,34,38,53,52,62,2,51,50,22,23,
+54,51,50,30,2,21,21,33,30,3,51,50,62,2,55,22,22,21,20,14,2,1,45,81,85,62,
+101,71,38,131,87,117,72,31,3,121,115,122,11,1,215,24,52,85,31,150,209,57,
+19,68,97,125,76,68,117,85,48,232,235,170,12,40,75,63,59,73,41,14,85,89,58,
+101,134,76,116,159,45,114,203,99,158,110,59,253,86,2,39,77,118,81,45,84,73,
+59,20,14,25,44,88,133,1,41,96,95,40,74,106,65,123,27,16,6,4,35,63,92,2,139,
+185,178,81,134,96,52,251,252,118,115,46,84,65,38,39,81,123,84,163,158,7,6,
+123,55,93,67,37,33,60,82,48,58,71,53,74,47,22,59,66,125,62,123,183,121,94,
+112,161,104,49,22,39,52,30,6,38,26,31,71,60,40,255,255,0,113,254,20,3,160,
+4,94,18,34,0,70,0,0,16,3,0,122,0,233,0,0,255,255,0,113,255,236,3,225,6,33,
+18,34,0,72,0,0,16,2,0,67,148,0,255,255,0,113,255,236,3,225,6,33,18,34,0,72,
+0,0,16,2,0,118,82,0,255,255,0,113,255,236,3,225,6,33,18,34,0,72,0,0,16,2,
+1,75,222,0,255,255,0,113,255,236,3,225,5,244,18,34,0,72,0,0,16,2,0,106,218,
+0,255,255,0,38,0,0,2,117,6,33,18,34,0,243,0,0,16,3,0,67,254,157,0,0,255,255,
+0,47,0,0,2,125,6,33,18,34,0,243,0,0,16,3,0,118,255,105,0,0,255,255,0,22,0,
+0,2,117,6,33,18,34,0,243,0,0,16,3,1,75,254,245,0,0,255,255,0,18,0,0,2,117,
+5,244,18,34,0,243,0,0,16,3,0,106,254,239,0,0,0,2,0,113,255,236,4,45,6,25,
+0,34,0,54,0,0,1,22,22,23,37,21,7,30,3,21,16,2,35,34,46,2,53,16,18,51,50,22,
+23,38,38,39,5,53,55,38,38,39,19,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,
+1,51,94,180,81,1,8,181,72,120,85,47,245,236,111,176,123,65,243,238,68,116,
+51,21,107,78,255,0,172,51,116,65,4,30,67,107,77,77,106,66,29,30,66,107,77,
+77,106,66,30,6,23,23,75,54,154,117,103,60,155,188,219,123,254,200,254,208,
+65,132,199,134,1,10,1,4,28,25,68,151,68,146,115,98,34,57,20,252,86,105,158,
+107,54,54,107,158,105,104,157,105,52,52,105,157,255,255,0,57,0,0,4,240,5,
+223,18,34,0,81,0,0,16,2,1,82,80,0,255,255,0,113,255,236,4,45,6,33,18,34,0,
+82,0,0,16,2,0,67,161,0,255,255,0,113,255,236,4,45,6,33,18,34,0,82,0,0,16,
+2,0,118,121,0,255,255,0,113,255,236,4,45,6,33,18,34,0,82,0,0,16,2,1,75,251,
+0,255,255,0,113,255,236,4,45,5,223,18,34,0,82,0,0,16,2,1,82,251,0,255,255,
+0,113,255,236,4,45,5,244,18,34,0,82,0,0,16,2,0,106,249,0,0,3,0,133,0,231,
+3,244,4,209,0,3,0,23,0,41,0,0,1,33,53,33,1,52,62,2,51,50,30,2,21,20,14,2,
+35,34,46,2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,38,3,244,252,145,3,111,
+253,225,16,28,38,22,22,38,29,16,16,29,38,22,22,38,28,16,16,28,38,22,22,38,
+29,16,16,29,38,22,45,59,2,160,121,1,71,32,44,26,11,11,26,44,32,31,43,27,11,
+11,27,43,253,23,32,44,26,11,11,26,44,32,31,44,26,12,50,0,3,0,113,255,174,
+4,45,4,156,0,23,0,34,0,45,0,0,1,22,22,21,16,2,35,34,38,39,7,35,55,38,38,53,
+16,18,51,50,22,23,55,51,1,20,22,23,1,38,35,34,14,2,5,52,39,1,22,22,51,50,
+62,2,3,162,68,71,245,236,71,124,51,74,121,111,71,74,243,238,74,127,53,78,
+118,253,35,20,21,1,168,68,118,77,106,66,30,2,47,36,254,90,32,89,59,77,106,
+66,29,3,223,69,219,152,254,223,254,230,28,29,119,180,72,223,158,1,31,1,24,
+32,31,125,253,139,94,150,57,2,174,74,58,115,172,114,177,108,253,84,32,34,
+60,117,174,255,255,0,47,255,236,4,229,6,33,18,34,0,88,0,0,16,2,0,67,177,0,
+255,255,0,47,255,236,4,229,6,33,18,34,0,88,0,0,16,3,0,118,0,150,0,0,255,255,
+0,47,255,236,4,229,6,33,18,34,0,88,0,0,16,2,1,75,53,0,255,255,0,47,255,236,
+4,229,5,244,18,34,0,88,0,0,16,2,0,106,57,0,255,255,0,8,254,20,4,133,6,33,
+18,34,0,92,0,0,16,2,0,118,113,0,0,2,0,37,254,20,4,121,6,20,0,17,0,77,0,0,
+1,34,14,2,21,20,30,2,51,50,62,2,53,52,38,1,20,14,2,35,34,46,2,39,35,22,23,
+30,3,21,21,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,17,
+20,6,7,6,7,51,62,3,51,50,30,2,2,180,80,107,64,27,27,65,107,81,67,96,61,28,
+118,1,61,55,106,156,101,59,96,77,59,22,8,2,2,1,1,1,1,27,46,61,34,6,253,217,
+16,34,62,45,27,27,46,61,34,16,1,121,2,2,2,2,8,23,58,76,96,60,101,156,106,
+55,3,219,53,108,164,111,107,164,112,57,57,112,165,108,218,216,254,76,148,
+216,140,67,26,48,66,40,53,46,20,40,36,29,8,196,45,55,29,9,86,86,10,31,59,
+48,6,53,45,55,30,9,86,254,136,35,91,42,48,51,47,76,53,29,67,139,214,255,255,
+0,8,254,20,4,133,5,244,18,34,0,92,0,0,16,2,0,106,29,0,255,255,0,0,0,0,5,164,
+6,185,18,34,0,36,0,0,16,3,1,77,0,205,1,82,255,255,0,102,255,236,4,41,5,103,
+18,34,0,68,0,0,16,2,1,77,43,0,255,255,0,0,0,0,5,164,7,68,18,34,0,36,0,0,16,
+3,1,78,0,127,1,82,255,255,0,102,255,236,4,41,5,242,18,34,0,68,0,0,16,2,1,
+78,230,0,255,255,0,0,254,20,5,164,5,182,18,34,0,36,0,0,16,3,1,81,2,70,0,0,
+255,255,0,102,254,20,4,41,4,94,18,34,0,68,0,0,16,3,1,81,0,197,0,0,255,255,
+0,117,255,236,4,164,7,115,18,34,0,38,0,0,16,3,0,118,1,10,1,82,255,255,0,113,
+255,236,3,160,6,33,18,34,0,70,0,0,16,2,0,118,74,0,255,255,0,117,255,236,4,
+164,7,115,18,34,0,38,0,0,16,3,1,75,0,170,1,82,255,255,0,113,255,236,3,160,
+6,33,18,34,0,70,0,0,16,2,1,75,245,0,255,255,0,117,255,236,4,164,7,71,18,34,
+0,38,0,0,16,3,1,79,1,172,1,82,255,255,0,113,255,236,3,160,5,245,18,34,0,70,
+0,0,16,3,1,79,0,240,0,0,255,255,0,117,255,236,4,164,7,115,18,34,0,38,0,0,
+16,3,1,76,0,147,1,82,255,255,0,113,255,236,3,160,6,33,18,34,0,70,0,0,16,2,
+1,76,241,0,255,255,0,78,0,0,5,92,7,115,18,34,0,39,0,0,16,3,1,76,0,88,1,82,
+255,255,0,113,255,236,5,109,6,20,18,34,0,71,0,0,16,3,2,54,2,236,0,0,255,255,
+0,78,0,0,5,92,5,182,18,2,0,146,0,0,0,2,0,113,255,236,4,199,6,20,0,53,0,69,
+0,0,1,51,21,35,17,20,30,2,51,51,21,33,39,35,14,3,35,34,46,2,53,52,62,2,51,
+50,30,2,23,51,38,39,38,38,53,53,33,53,33,53,52,46,2,35,35,53,33,1,50,62,2,
+53,52,46,2,35,34,6,21,20,22,4,12,187,187,27,46,61,34,17,254,165,22,8,23,59,
+76,96,60,101,156,106,54,54,106,156,101,59,96,77,60,22,12,3,3,2,4,254,162,
+1,94,27,46,61,34,17,1,121,254,41,80,107,65,27,27,65,108,81,135,117,118,5,
+31,97,252,35,45,55,30,9,86,184,47,75,53,29,64,134,206,142,143,208,135,65,
+26,48,66,40,50,45,38,78,20,86,97,20,45,54,30,10,86,250,91,51,103,156,105,
+102,157,107,54,216,206,207,206,255,255,0,78,0,0,4,166,6,185,18,34,0,40,0,
+0,16,3,1,77,0,139,1,82,255,255,0,113,255,236,3,225,5,103,18,34,0,72,0,0,16,
+2,1,77,47,0,255,255,0,78,0,0,4,166,7,68,18,34,0,40,0,0,16,3,1,78,0,49,1,82,
+255,255,0,113,255,236,3,225,5,242,18,34,0,72,0,0,16,2,1,78,234,0,255,255,
+0,78,0,0,4,166,7,42,18,34,0,40,0,0,16,3,1,79,1,63,1,53,255,255,0,113,255,
+236,3,225,5,245,18,34,0,72,0,0,16,3,1,79,0,223,0,0,255,255,0,78,254,20,4,
+166,5,182,18,34,0,40,0,0,16,3,1,81,1,106,0,0,255,255,0,113,254,51,3,225,4,
+94,18,34,0,72,0,0,16,2,1,81,119,31,255,255,0,78,0,0,4,166,7,115,18,34,0,40,
+0,0,16,3,1,76,0,43,1,82,255,255,0,113,255,236,3,225,6,33,18,34,0,72,0,0,16,
+2,1,76,228,0,255,255,0,117,255,236,5,143,7,115,18,34,0,42,0,0,16,3,1,75,0,
+215,1,82,255,255,0,47,254,20,4,53,6,33,18,34,0,74,0,0,16,2,1,75,198,0,255,
+255,0,117,255,236,5,143,7,68,18,34,0,42,0,0,16,3,1,78,0,217,1,82,255,255,
+0,47,254,20,4,53,5,242,18,34,0,74,0,0,16,2,1,78,191,0,255,255,0,117,255,236,
+5,143,7,71,18,34,0,42,0,0,16,3,1,79,1,229,1,82,255,255,0,47,254,20,4,53,5,
+245,18,34,0,74,0,0,16,3,1,79,0,184,0,0,255,255,0,117,254,59,5,143,5,203,18,
+34,0,42,0,0,16,3,2,55,1,23,0,0,255,255,0,47,254,20,4,53,6,33,18,34,0,74,0,
+0,16,2,2,56,59,0,255,255,0,78,0,0,6,10,7,115,18,34,0,43,0,0,16,3,1,75,0,221,
+1,82,255,255,0,37,0,0,4,219,7,170,18,34,0,75,0,0,16,3,1,75,0,43,1,137,0,2,
+0,78,0,0,6,10,5,182,0,75,0,79,0,0,1,17,20,30,2,51,51,21,33,53,51,50,62,2,
+53,17,33,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,35,53,51,53,52,46,2,35,
+35,53,33,21,35,34,14,2,21,21,33,53,52,46,2,35,35,53,33,21,35,34,14,2,21,21,
+51,21,5,53,33,21,5,72,27,46,61,34,26,253,172,27,35,61,45,27,253,102,27,45,
+62,34,27,253,172,26,35,61,46,26,194,194,27,46,61,34,26,2,84,27,34,62,45,27,
+2,154,27,45,61,35,27,2,84,26,35,61,46,26,194,254,111,253,102,3,254,252,225,
+45,55,28,9,86,86,10,31,58,48,1,224,254,32,48,58,31,10,86,86,10,31,58,48,3,
+21,100,115,45,55,30,9,86,86,10,31,58,48,107,107,48,58,31,10,86,86,10,31,58,
+48,107,100,207,207,207,0,1,0,35,0,0,4,219,6,20,0,66,0,0,37,21,33,53,51,50,
+62,2,53,17,35,53,51,53,52,46,2,35,35,53,33,21,33,21,33,21,20,6,7,6,7,51,54,
+51,50,30,2,21,17,20,30,2,51,51,21,33,17,52,46,2,35,34,14,2,21,17,20,30,2,
+51,2,76,253,217,16,35,61,45,27,186,186,27,46,61,34,16,1,121,1,94,254,162,
+2,2,2,2,10,92,209,87,135,92,48,24,42,58,34,6,254,156,24,53,86,62,64,93,61,
+30,27,46,61,34,86,86,86,10,31,58,48,3,213,97,20,45,55,30,9,86,245,97,149,
+28,61,26,30,29,186,47,97,152,105,254,69,48,58,31,10,86,2,154,67,104,72,37,
+47,87,123,75,254,121,45,55,28,9,255,255,0,11,0,0,2,228,7,49,18,34,0,44,0,
+0,16,3,1,82,255,42,1,82,255,255,255,208,0,0,2,169,5,223,18,34,0,243,0,0,16,
+3,1,82,254,239,0,0,255,255,0,78,0,0,2,162,6,185,18,34,0,44,0,0,16,3,1,77,
+255,120,1,82,255,255,0,1,0,0,2,117,5,103,18,34,0,243,0,0,16,3,1,77,255,42,
+0,0,255,255,0,78,0,0,2,162,7,68,18,34,0,44,0,0,16,3,1,78,255,42,1,82,255,
+255,0,25,0,0,2,117,5,242,18,34,0,243,0,0,16,3,1,78,254,234,0,0,255,255,0,
+78,254,20,2,162,5,182,18,34,0,44,0,0,16,3,1,81,255,85,0,0,255,255,0,47,254,
+20,2,117,6,20,18,34,0,76,0,0,16,3,1,81,255,7,0,0,255,255,0,78,0,0,2,162,7,
+71,18,34,0,44,0,0,16,3,1,79,0,35,1,82,0,1,0,47,0,0,2,117,4,74,0,24,0,0,55,
+50,62,2,53,17,52,46,2,35,35,53,33,17,20,30,2,51,51,21,33,53,74,34,61,46,27,
+27,46,61,34,6,1,110,27,45,62,34,27,253,186,86,9,28,55,45,2,137,45,55,30,10,
+86,252,159,48,58,31,10,86,86,255,255,0,78,254,20,5,88,5,182,16,34,0,44,0,
+0,16,3,0,45,2,182,0,0,255,255,0,47,254,20,4,57,6,20,16,34,0,76,0,0,16,3,0,
+77,2,143,0,0,255,255,255,233,254,20,2,165,7,115,18,34,0,45,0,0,16,3,1,75,
+255,40,1,82,255,255,255,231,254,20,2,69,6,33,18,34,2,53,0,0,16,3,1,75,254,
+200,0,0,255,255,0,78,254,59,5,178,5,182,18,34,0,46,0,0,16,3,2,55,0,233,0,
+0,255,255,0,37,254,59,4,176,6,20,18,34,0,78,0,0,16,2,2,55,115,0,0,1,0,37,
+0,0,4,176,4,74,0,60,0,0,1,1,22,22,51,51,21,35,34,46,2,39,3,7,21,20,30,2,51,
+51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,17,20,6,7,6,7,1,62,3,53,
+52,38,35,53,33,21,34,6,7,2,182,1,17,53,105,69,6,29,89,115,84,70,43,205,151,
+27,46,61,34,6,253,217,16,35,61,45,27,27,46,61,34,16,1,121,2,2,2,2,1,0,33,
+43,26,10,49,51,1,196,71,137,80,2,147,254,107,82,86,86,11,41,79,68,1,65,112,
+185,45,55,28,9,86,86,10,31,58,48,2,128,45,55,30,9,86,254,180,28,87,42,48,
+53,1,24,37,56,42,33,15,26,15,86,86,100,91,255,255,0,78,0,0,4,166,7,115,18,
+34,0,47,0,0,16,3,0,118,255,169,1,82,255,255,0,27,0,0,2,101,7,172,18,34,0,
+79,0,0,16,3,0,118,255,81,1,139,255,255,0,78,254,59,4,166,5,182,18,34,0,47,
+0,0,16,3,2,55,0,143,0,0,255,255,0,27,254,59,2,96,6,20,18,34,0,79,0,0,16,3,
+2,55,255,40,0,0,255,255,0,78,0,0,4,166,5,183,18,34,0,47,0,0,16,3,2,54,1,207,
+255,163,255,255,0,27,0,0,2,254,6,20,18,34,0,79,0,0,16,2,2,54,125,0,255,255,
+0,78,0,0,4,166,5,182,18,34,0,47,0,0,16,3,1,79,2,145,253,124,255,255,0,27,
+0,0,3,45,6,20,16,34,0,79,0,0,16,3,1,79,1,100,253,11,0,1,0,78,0,0,4,166,5,
+182,0,41,0,0,19,55,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,37,21,5,17,
+33,50,62,2,55,55,51,3,33,53,51,50,62,2,53,17,7,78,194,26,46,61,35,26,2,84,
+27,34,61,46,27,1,64,254,192,1,148,46,65,42,23,4,20,107,14,251,182,26,35,61,
+46,26,194,2,72,112,2,21,48,58,31,10,86,86,9,30,55,45,254,90,186,118,185,253,
+172,33,53,66,33,153,254,72,86,10,31,58,48,1,91,111,0,1,0,57,0,0,2,127,6,20,
+0,32,0,0,19,17,52,46,2,35,35,53,33,17,55,21,7,17,20,30,2,51,51,21,33,53,51,
+50,62,2,53,17,7,53,252,27,46,61,34,27,1,131,193,193,27,45,62,34,27,253,186,
+27,35,61,45,27,174,2,172,2,135,45,55,30,9,86,253,7,110,119,108,254,67,48,
+58,31,10,86,86,10,31,58,48,1,78,98,115,255,255,0,78,0,0,5,225,7,115,18,34,
+0,49,0,0,16,3,0,118,1,59,1,82,255,255,0,57,0,0,4,240,6,33,18,34,0,81,0,0,
+16,3,0,118,0,178,0,0,255,255,0,78,254,59,5,225,5,182,18,34,0,49,0,0,16,3,
+2,55,1,37,0,0,255,255,0,57,254,59,4,240,4,94,18,34,0,81,0,0,16,3,2,55,0,154,
+0,0,255,255,0,78,0,0,5,225,7,115,18,34,0,49,0,0,16,3,1,76,0,238,1,82,255,
+255,0,57,0,0,4,240,6,33,18,34,0,81,0,0,16,2,1,76,86,0,255,255,0,1,0,0,6,4,
+5,182,16,35,0,81,1,20,0,0,16,2,2,7,196,0,0,1,0,78,254,20,5,225,5,182,0,57,
+0,0,5,20,14,2,35,35,53,51,50,62,2,53,53,1,17,20,30,2,51,51,21,33,53,51,50,
+62,2,53,17,52,46,2,35,35,53,33,1,17,52,46,2,35,35,53,33,21,35,34,14,2,21,
+5,31,39,78,117,78,47,29,49,76,53,27,252,235,27,45,61,35,27,253,254,26,35,
+61,46,26,27,46,61,34,26,1,119,2,221,27,46,61,34,27,2,2,26,35,61,46,26,16,
+138,183,109,46,97,37,87,145,108,18,4,156,252,77,48,58,31,10,86,86,10,31,58,
+48,3,236,45,55,30,9,86,251,176,3,111,45,55,30,9,86,86,10,31,58,48,0,1,0,57,
+254,20,4,76,4,94,0,61,0,0,37,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,
+23,51,62,3,51,50,30,2,21,17,20,14,2,35,35,53,51,50,62,2,53,17,52,46,2,35,
+34,14,2,21,17,20,30,2,51,2,96,253,217,17,35,61,45,27,27,46,61,34,6,1,75,27,
+10,32,71,79,89,49,81,127,89,47,56,101,139,83,31,12,50,76,52,27,24,53,86,62,
+70,95,58,25,27,46,61,34,86,86,86,10,31,58,48,2,127,45,55,30,10,86,166,57,
+73,41,15,47,97,152,105,253,35,138,183,109,46,97,37,87,145,108,2,213,67,104,
+72,37,54,92,120,66,254,80,45,55,28,9,255,255,0,115,255,236,5,123,6,185,18,
+34,0,50,0,0,16,3,1,77,0,244,1,82,255,255,0,113,255,236,4,45,5,103,18,34,0,
+82,0,0,16,2,1,77,74,0,255,255,0,115,255,236,5,123,7,68,18,34,0,50,0,0,16,
+3,1,78,0,170,1,82,255,255,0,113,255,236,4,45,5,242,18,34,0,82,0,0,16,2,1,
+78,0,0,255,255,0,115,255,236,5,123,7,115,18,34,0,50,0,0,16,3,1,83,0,236,1,
+82,255,255,0,113,255,236,4,45,6,33,18,34,0,82,0,0,16,2,1,83,70,0,0,2,0,115,
+255,236,7,86,5,205,0,44,0,61,0,0,37,33,50,62,2,55,55,51,3,33,14,3,35,34,38,
+38,2,53,52,18,54,54,51,50,30,2,23,33,19,35,39,46,3,35,33,17,33,21,33,1,50,
+54,55,17,38,38,35,34,14,2,21,20,30,2,4,143,1,140,48,69,46,26,5,15,106,14,
+252,131,21,53,57,56,24,163,242,160,80,80,160,244,163,24,57,57,52,21,3,57,
+10,106,10,4,23,43,65,46,254,168,1,238,254,18,254,105,60,100,41,41,98,60,114,
+160,101,45,45,100,159,102,27,46,61,34,88,254,154,5,7,5,3,108,198,1,23,170,
+170,1,21,196,107,3,6,8,6,254,154,88,34,61,46,27,253,223,100,253,143,17,14,
+4,194,17,18,86,164,239,152,152,239,165,87,0,3,0,113,255,236,6,215,4,94,0,
+20,0,29,0,73,0,0,1,20,30,2,51,50,62,2,55,53,46,3,35,34,14,2,1,34,6,7,33,52,
+46,2,3,34,38,39,6,33,34,46,2,53,16,18,51,50,22,23,54,54,51,50,30,2,21,21,
+33,30,3,51,50,62,2,55,22,22,21,20,14,2,1,55,30,67,107,77,76,105,66,30,1,1,
+32,66,106,75,77,106,66,30,3,242,115,122,11,1,215,24,52,85,37,130,183,60,119,
+254,246,111,176,123,65,243,238,124,187,62,58,179,121,99,158,110,59,253,86,
+2,34,72,114,83,53,91,74,57,18,14,25,44,90,135,2,39,114,174,117,60,58,115,
+170,112,28,110,165,111,55,58,115,172,1,87,185,178,81,134,96,52,251,252,104,
+100,204,70,142,215,144,1,31,1,24,98,100,100,98,62,123,183,121,94,99,157,111,
+59,24,40,51,28,6,38,26,31,71,60,40,255,255,0,78,0,0,5,76,7,115,18,34,0,53,
+0,0,16,3,0,118,0,133,1,82,255,255,0,68,0,0,3,166,6,33,18,34,0,85,0,0,16,2,
+0,118,239,0,255,255,0,78,254,59,5,76,5,182,18,34,0,53,0,0,16,3,2,55,0,154,
+0,0,255,255,0,68,254,59,3,166,4,94,18,34,0,85,0,0,16,3,2,55,255,56,0,0,255,
+255,0,78,0,0,5,76,7,115,18,34,0,53,0,0,16,3,1,76,0,33,1,82,255,255,0,68,0,
+0,3,166,6,33,18,34,0,85,0,0,16,3,1,76,255,122,0,0,255,255,0,98,255,236,3,
+242,7,115,18,34,0,54,0,0,16,3,0,118,0,59,1,82,255,255,0,92,255,236,3,66,6,
+33,18,34,0,86,0,0,16,2,0,118,230,0,255,255,0,98,255,236,3,242,7,115,18,34,
+0,54,0,0,16,3,1,75,255,237,1,82,255,255,0,92,255,236,3,66,6,33,18,34,0,86,
+0,0,16,2,1,75,155,0,255,255,0,98,254,20,3,242,5,203,18,34,0,54,0,0,16,3,0,
+122,0,195,0,0,255,255,0,92,254,20,3,66,4,92,18,34,0,86,0,0,16,2,0,122,123,
+0,255,255,0,98,255,236,3,242,7,115,18,34,0,54,0,0,16,3,1,76,255,230,1,82,
+255,255,0,92,255,236,3,66,6,33,18,34,0,86,0,0,16,2,1,76,136,0,255,255,0,41,
+254,59,4,190,5,182,18,34,0,55,0,0,16,2,2,55,86,0,255,255,0,39,254,59,2,162,
+5,70,18,34,0,87,0,0,16,2,2,55,155,0,255,255,0,41,0,0,4,190,7,115,18,34,0,
+55,0,0,16,3,1,76,0,35,1,82,255,255,0,39,255,236,3,4,6,20,18,34,0,87,0,0,16,
+3,2,54,0,131,0,0,0,1,0,41,0,0,4,190,5,182,0,43,0,0,1,33,21,33,17,20,30,2,
+51,51,21,33,53,51,50,62,2,53,17,33,53,33,17,35,34,14,2,7,7,35,19,33,19,35,
+39,46,3,35,35,2,217,1,90,254,166,27,45,62,34,47,253,131,47,34,61,46,27,254,
+170,1,86,196,45,61,39,19,4,11,106,10,4,129,10,106,10,4,20,38,62,46,199,3,
+4,100,254,73,48,58,31,10,86,86,9,28,55,45,1,193,100,2,76,27,46,61,34,88,1,
+102,254,154,88,34,61,46,27,0,1,0,39,255,236,2,162,5,70,0,39,0,0,37,50,54,
+55,21,14,3,35,34,46,2,53,17,35,53,51,17,35,53,50,54,55,54,54,55,51,21,33,
+21,33,17,51,21,35,17,20,22,2,31,37,62,32,13,42,49,54,24,78,112,72,35,140,
+140,156,37,89,34,35,43,16,94,1,12,254,244,248,248,85,88,8,6,90,6,12,9,5,33,
+74,122,88,1,43,96,1,33,82,30,35,38,105,79,252,117,254,223,96,254,207,105,
+98,255,255,0,31,255,236,5,158,7,49,18,34,0,56,0,0,16,3,1,82,0,168,1,82,255,
+255,0,47,255,236,4,229,5,223,18,34,0,88,0,0,16,2,1,82,45,0,255,255,0,31,255,
+236,5,158,6,185,18,34,0,56,0,0,16,3,1,77,1,4,1,82,255,255,0,47,255,236,4,
+229,5,103,18,34,0,88,0,0,16,2,1,77,113,0,255,255,0,31,255,236,5,158,7,68,
+18,34,0,56,0,0,16,3,1,78,0,170,1,82,255,255,0,47,255,236,4,229,5,242,18,34,
+0,88,0,0,16,2,1,78,45,0,255,255,0,31,255,236,5,158,7,213,18,34,0,56,0,0,16,
+3,1,80,1,164,1,82,255,255,0,47,255,236,4,229,6,131,18,34,0,88,0,0,16,3,1,
+80,1,27,0,0,255,255,0,31,255,236,5,158,7,115,18,34,0,56,0,0,16,3,1,83,0,250,
+1,82,255,255,0,47,255,236,4,229,6,33,18,34,0,88,0,0,16,3,1,83,0,129,0,0,255,
+255,0,31,254,20,5,158,5,182,18,34,0,56,0,0,16,3,1,81,0,207,0,0,255,255,0,
+47,254,20,4,229,4,74,18,34,0,88,0,0,16,3,1,81,1,84,0,0,255,255,0,18,0,0,8,
+78,7,115,18,34,0,58,0,0,16,3,1,75,2,6,1,82,255,255,0,2,0,0,6,227,6,33,18,
+34,0,90,0,0,16,3,1,75,1,63,0,0,255,255,255,246,0,0,5,6,7,115,18,34,0,60,0,
+0,16,3,1,75,0,53,1,82,255,255,0,8,254,20,4,133,6,33,18,34,0,92,0,0,16,2,1,
+75,14,0,255,255,255,246,0,0,5,6,7,70,18,34,0,60,0,0,16,3,0,106,0,68,1,82,
+255,255,0,74,0,0,4,102,7,115,18,34,0,61,0,0,16,3,0,118,0,104,1,82,255,255,
+0,86,0,0,3,164,6,33,18,34,0,93,0,0,16,2,0,118,37,0,255,255,0,74,0,0,4,102,
+7,71,18,34,0,61,0,0,16,3,1,79,1,41,1,82,255,255,0,86,0,0,3,164,5,245,18,34,
+0,93,0,0,16,3,1,79,0,205,0,0,255,255,0,74,0,0,4,102,7,115,18,34,0,61,0,0,
+16,3,1,76,0,31,1,82,255,255,0,86,0,0,3,164,6,33,18,34,0,93,0,0,16,2,1,76,
+214,0,0,1,0,27,0,0,3,102,6,41,0,37,0,0,51,53,51,50,62,2,53,17,52,62,2,51,
+50,30,2,21,20,6,35,52,46,2,35,34,6,21,17,20,30,2,51,51,21,27,26,35,61,45,
+27,50,95,134,84,80,109,68,29,93,75,13,31,52,39,87,66,26,46,61,35,77,86,10,
+31,58,48,3,199,92,140,96,49,21,38,52,32,56,59,31,59,46,28,135,129,252,38,
+48,58,31,10,86,0,1,255,174,254,20,4,137,5,203,0,49,0,0,1,33,3,14,3,35,34,
+46,2,39,55,30,3,51,50,62,2,55,19,35,55,51,55,62,3,51,50,22,21,20,6,35,52,
+46,2,35,34,6,7,7,33,3,143,254,244,162,27,83,112,139,83,14,33,33,29,10,19,
+7,22,26,27,12,50,78,62,48,20,162,207,18,207,39,17,62,96,130,84,131,133,88,
+82,8,23,41,32,76,82,24,43,1,12,3,47,252,193,138,183,109,46,2,5,5,3,96,2,4,
+5,3,40,90,144,103,3,65,96,205,88,136,94,49,84,68,68,65,39,70,52,30,125,129,
+224,0,4,0,0,0,0,5,164,7,170,0,50,0,61,0,81,0,95,0,0,1,20,6,7,1,30,3,51,51,
+21,33,53,51,50,53,52,38,39,39,33,7,6,6,21,20,51,51,21,33,53,51,50,62,2,55,
+1,38,38,53,52,62,2,51,50,30,2,3,38,38,39,14,3,7,3,33,3,52,46,2,35,34,14,2,
+21,20,30,2,51,50,62,2,3,62,3,55,51,21,14,3,7,35,3,201,70,59,1,176,12,25,34,
+44,30,27,253,205,47,123,9,8,82,253,230,78,9,10,136,47,254,12,39,30,42,34,
+31,19,1,163,62,75,38,67,90,51,51,90,67,38,181,30,55,17,8,19,23,27,17,133,
+1,194,51,21,37,49,28,28,49,37,21,21,37,49,28,28,49,37,21,221,22,49,48,43,
+16,219,19,74,90,95,41,78,5,158,76,100,25,251,227,29,38,22,9,86,86,90,16,30,
+22,200,188,22,42,14,92,86,86,12,32,57,44,3,234,23,103,79,54,84,56,29,29,56,
+84,253,146,82,143,68,32,62,66,73,43,254,172,3,123,33,47,29,14,14,29,47,33,
+33,47,29,14,14,29,47,1,59,24,61,65,64,28,16,22,65,71,66,22,0,5,0,102,255,
+236,4,41,7,170,0,13,0,28,0,77,0,97,0,117,0,0,1,62,3,55,51,21,14,3,7,35,3,
+20,22,51,50,62,2,53,53,7,14,3,19,34,14,2,21,34,38,53,52,62,2,51,50,30,2,21,
+17,20,30,2,51,51,21,33,39,35,14,3,35,34,46,2,53,52,54,55,55,53,52,46,2,19,
+20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,30,2,
+51,50,62,2,1,221,23,49,47,43,16,219,19,74,90,95,41,78,176,81,85,62,101,71,
+38,131,87,117,72,31,248,59,73,41,14,85,89,58,101,134,76,94,140,94,47,14,30,
+49,34,6,254,235,32,17,32,60,72,91,64,68,117,85,48,232,235,170,12,40,75,207,
+38,66,90,52,51,90,66,38,38,66,90,51,52,90,66,38,110,22,37,49,28,27,49,37,
+22,22,37,49,27,28,49,37,22,6,184,24,61,65,64,28,16,22,65,71,66,22,250,133,
+96,95,40,74,106,65,166,6,4,35,63,92,2,147,33,60,82,48,58,71,53,74,47,22,37,
+84,135,98,253,237,43,56,34,14,86,176,43,72,52,29,39,81,123,84,163,158,7,6,
+123,55,93,67,37,1,145,54,84,56,29,29,56,84,54,55,83,56,29,29,56,83,55,33,
+47,29,14,14,29,47,33,33,47,29,14,14,29,47,255,255,0,0,0,0,7,70,7,115,18,34,
+0,136,0,0,16,3,0,118,2,170,1,82,255,255,0,102,255,236,6,84,6,33,18,34,0,168,
+0,0,16,3,0,118,1,117,0,0,255,255,0,115,255,174,5,123,7,115,18,34,0,154,0,
+0,16,3,0,118,1,2,1,82,255,255,0,113,255,174,4,45,6,33,18,34,0,186,0,0,16,
+2,0,118,80,0,255,255,0,98,254,59,3,242,5,203,18,34,0,54,0,0,16,2,2,55,29,
+0,255,255,0,92,254,59,3,66,4,92,18,34,0,86,0,0,16,2,2,55,187,0,0,1,1,33,4,
+217,3,125,6,33,0,20,0,0,1,62,3,55,51,30,3,23,21,35,38,38,39,6,6,7,35,1,33,
+24,58,57,50,16,194,16,50,57,58,24,80,59,118,46,47,116,58,80,4,244,29,76,81,
+81,34,34,81,81,76,29,27,34,101,49,49,101,34,0,1,1,33,4,217,3,125,6,33,0,24,
+0,0,1,51,30,3,23,62,3,55,51,21,14,3,7,35,46,3,39,1,33,80,29,59,57,53,23,23,
+53,58,60,29,80,24,58,57,50,16,194,16,50,57,58,24,6,33,18,44,49,51,25,25,51,
+49,44,18,27,29,76,81,80,35,35,80,81,76,29,0,1,0,215,4,238,3,41,5,103,0,3,
+0,0,1,33,53,33,3,41,253,174,2,82,4,238,121,0,1,1,47,4,217,3,109,5,242,0,17,
+0,0,1,34,46,2,39,51,22,22,51,50,54,55,51,14,3,2,78,73,107,70,35,2,94,17,100,
+76,75,100,17,95,2,35,71,106,4,217,45,76,102,58,75,65,65,75,58,102,76,45,0,
+1,0,223,4,248,1,201,5,245,0,19,0,0,19,52,62,2,51,50,30,2,21,20,14,2,35,34,
+46,2,223,18,32,42,25,24,42,32,19,19,32,42,24,25,42,32,18,5,119,36,48,30,12,
+12,30,48,36,36,48,30,13,13,30,48,0,2,0,94,4,197,2,74,6,131,0,19,0,39,0,0,
+1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,30,
+2,51,50,62,2,2,74,38,67,90,51,51,90,67,38,38,67,90,51,51,90,67,38,111,21,
+37,49,28,28,49,37,21,21,37,49,28,28,49,37,21,5,164,55,83,56,29,29,56,83,55,
+54,84,56,29,29,56,84,54,33,47,29,14,14,29,47,33,33,47,29,14,14,29,47,0,1,
+1,96,254,20,3,23,0,0,0,29,0,0,1,52,62,2,55,51,14,3,21,20,30,2,51,50,54,55,
+21,14,3,35,34,46,2,1,96,40,68,87,47,117,32,68,55,36,21,38,52,31,27,64,38,
+16,41,44,41,16,65,104,73,39,254,246,48,86,71,50,11,10,40,59,78,49,34,49,31,
+15,9,8,111,8,12,8,5,27,55,85,0,1,0,225,4,217,3,186,5,223,0,31,0,0,1,50,62,
+2,55,51,14,3,35,34,46,2,35,34,14,2,7,35,62,3,51,50,30,2,2,250,30,37,21,9,
+3,92,3,27,52,78,55,55,89,77,67,33,31,36,21,10,3,92,3,27,53,79,55,55,89,77,
+67,5,94,18,31,39,21,47,87,68,40,40,49,40,18,30,39,21,47,86,68,40,40,49,40,
+0,2,0,209,4,217,3,203,6,33,0,15,0,31,0,0,19,53,62,3,55,51,21,14,5,7,33,53,
+62,3,55,51,21,14,5,7,209,21,48,47,42,16,219,11,39,50,57,58,55,23,1,13,21,
+48,47,42,16,219,11,39,50,57,58,55,23,4,217,27,33,76,80,78,34,21,18,49,56,
+59,56,50,19,27,33,76,80,78,34,21,18,49,56,59,56,50,19,0,1,1,248,4,217,3,45,
+6,94,0,15,0,0,1,62,3,55,51,21,14,5,7,35,1,248,17,38,35,28,7,184,5,28,39,48,
+51,50,21,67,4,248,33,91,98,97,39,24,20,56,66,71,68,61,23,0,3,1,20,5,12,3,
+137,6,180,0,13,0,27,0,41,0,0,1,52,54,51,50,30,2,21,20,6,35,34,38,37,52,54,
+51,50,30,2,21,20,6,35,34,38,39,62,3,55,51,21,14,3,7,35,1,20,56,41,19,35,26,
+16,58,38,41,56,1,181,56,40,19,35,26,16,58,38,40,56,195,12,25,24,19,4,184,
+6,44,59,64,27,68,5,115,54,48,12,25,38,27,53,50,50,53,54,48,12,25,38,27,53,
+50,50,73,28,76,83,81,33,20,25,80,89,84,29,255,255,0,0,0,0,5,164,5,182,18,
+34,0,36,0,0,16,3,1,84,254,153,255,88,0,1,0,147,2,72,1,145,3,94,0,19,0,0,19,
+52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,20,20,34,
+47,26,27,46,34,20,2,211,38,53,33,15,15,33,53,38,37,52,34,16,16,34,52,255,
+255,255,147,0,0,5,76,5,182,16,35,0,40,0,166,0,0,16,3,1,84,253,155,255,88,
+255,255,255,147,0,0,6,172,5,182,16,35,0,43,0,162,0,0,16,3,1,84,253,155,255,
+88,255,255,255,147,0,0,3,68,5,182,16,35,0,44,0,162,0,0,16,3,1,84,253,155,
+255,88,255,255,255,188,255,236,5,123,5,205,18,34,0,50,0,0,16,3,1,84,253,196,
+255,88,255,255,255,147,0,0,6,0,5,182,16,35,0,60,0,250,0,0,16,3,1,84,253,155,
+255,88,255,255,255,188,0,0,5,176,5,205,18,34,1,118,0,0,16,3,1,84,253,196,
+255,88,255,255,0,5,255,236,2,168,6,180,18,34,1,134,0,0,16,3,1,85,254,241,
+0,0,255,255,0,0,0,0,5,164,5,182,18,2,0,36,0,0,255,255,0,78,0,0,4,190,5,182,
+18,2,0,37,0,0,0,1,0,78,0,0,4,84,5,182,0,33,0,0,33,33,53,51,50,62,2,53,17,
+52,46,2,35,35,53,33,19,35,39,46,3,35,33,17,20,30,2,51,51,2,203,253,131,26,
+35,61,46,26,26,46,61,35,26,3,250,12,107,8,5,21,44,75,60,254,203,27,46,61,
+34,68,86,10,31,58,48,3,228,48,58,31,10,86,254,154,72,43,68,48,25,251,145,
+45,55,30,9,255,255,0,63,0,0,4,158,5,182,18,2,2,38,0,0,255,255,0,78,0,0,4,
+166,5,182,18,2,0,40,0,0,255,255,0,74,0,0,4,102,5,182,18,2,0,61,0,0,255,255,
+0,78,0,0,6,10,5,182,18,2,0,43,0,0,0,3,0,115,255,236,5,123,5,205,0,27,0,47,
+0,67,0,0,1,23,30,3,51,51,50,54,55,55,51,17,35,39,38,38,35,35,34,14,2,7,7,
+35,17,5,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,
+50,62,2,53,52,46,2,35,34,14,2,2,39,10,6,21,37,60,46,51,82,81,11,11,86,86,
+11,11,81,82,51,46,60,37,21,6,10,86,3,170,84,164,240,155,163,242,160,80,80,
+160,244,163,155,238,164,84,251,219,45,100,159,114,114,159,99,44,44,99,157,
+114,114,160,101,45,3,162,39,22,35,24,13,51,43,39,254,143,39,43,51,13,24,35,
+22,39,1,113,197,169,254,234,198,108,108,198,1,23,170,170,1,21,196,107,107,
+197,254,235,171,152,239,165,87,87,165,239,152,152,239,164,86,86,164,239,255,
+255,0,78,0,0,2,162,5,182,18,2,0,44,0,0,255,255,0,78,0,0,5,178,5,182,18,2,
+0,46,0,0,0,1,0,2,0,0,5,104,5,182,0,41,0,0,1,1,30,3,51,51,21,33,53,51,50,53,
+52,38,39,3,38,38,39,6,6,7,3,6,6,21,20,22,51,51,21,33,53,51,50,62,2,55,1,3,
+2,1,186,11,26,34,45,30,26,253,205,47,123,8,8,225,31,45,17,15,47,32,225,8,
+11,68,68,47,254,12,39,30,44,35,30,17,1,168,5,182,251,13,32,42,25,10,86,86,
+98,17,36,23,2,160,91,164,75,75,159,96,253,110,24,47,17,52,48,86,86,13,35,
+62,50,4,192,255,255,0,78,0,0,7,51,5,182,18,2,0,48,0,0,255,255,0,78,0,0,5,
+225,5,182,18,2,0,49,0,0,0,3,0,86,0,0,4,162,5,182,0,17,0,35,0,63,0,0,33,33,
+3,51,23,30,3,51,33,50,62,2,55,55,51,3,35,39,46,3,35,33,34,14,2,7,7,35,19,
+33,1,23,30,3,51,51,50,54,55,55,51,17,35,39,38,38,35,35,34,14,2,7,7,35,17,
+4,152,251,200,10,107,8,4,20,39,63,46,2,14,46,63,39,20,4,8,107,62,106,8,4,
+20,40,62,46,254,108,46,63,39,20,4,8,107,11,3,188,253,51,11,6,20,38,60,46,
+112,82,81,11,10,87,87,10,11,81,82,112,46,60,38,20,6,11,86,1,147,61,31,56,
+42,25,25,42,56,31,61,2,168,62,31,55,42,25,25,42,55,31,62,1,123,253,254,39,
+22,35,24,13,51,43,39,254,123,39,43,51,13,24,35,22,39,1,133,255,255,0,115,
+255,236,5,123,5,205,18,2,0,50,0,0,0,1,0,78,0,0,5,205,5,182,0,49,0,0,19,33,
+21,35,34,14,2,21,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,33,17,20,30,2,
+51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,78,5,127,27,34,62,45,27,27,
+46,61,34,27,253,172,26,35,61,46,26,253,164,27,45,62,34,27,253,172,26,35,61,
+46,26,27,46,61,34,26,5,182,86,10,31,58,48,252,18,45,55,28,9,86,86,10,31,58,
+48,4,103,251,153,48,58,31,10,86,86,10,31,58,48,3,236,45,55,30,9,255,255,0,
+78,0,0,4,133,5,182,18,2,0,51,0,0,0,1,0,47,0,0,4,129,5,182,0,26,0,0,37,50,
+62,2,55,55,51,3,33,53,1,1,53,33,19,35,39,46,3,35,33,1,21,1,3,78,48,68,45,
+26,5,9,106,10,251,184,1,170,254,131,3,193,10,107,10,4,22,43,65,46,254,86,
+1,47,254,123,188,29,52,72,42,61,254,68,66,2,139,2,174,59,254,154,88,34,60,
+45,27,253,223,31,253,174,255,255,0,41,0,0,4,190,5,182,18,2,0,55,0,0,255,255,
+255,246,0,0,5,6,5,182,18,2,0,60,0,0,0,3,0,68,0,0,5,217,5,182,0,12,0,74,0,
+87,0,0,1,51,50,62,2,53,52,46,2,35,35,1,53,51,50,62,2,53,53,35,34,46,4,53,
+52,62,2,51,51,53,52,46,2,35,35,53,33,21,35,34,14,2,21,21,51,50,30,2,21,20,
+14,4,35,35,21,20,30,2,51,51,21,1,35,34,14,2,21,20,30,2,51,51,3,113,47,93,
+132,84,39,34,76,121,87,77,254,120,27,35,61,45,27,68,101,160,122,86,54,25,
+60,125,189,129,113,27,45,61,35,27,2,74,26,35,61,46,26,112,129,190,124,61,
+25,54,86,122,160,102,67,26,46,61,35,26,254,121,78,87,120,76,34,39,84,132,
+93,47,1,115,46,94,144,97,86,133,92,47,251,170,86,10,31,58,48,41,38,67,93,
+108,119,61,100,165,118,65,21,48,58,31,10,86,86,10,31,58,48,21,65,118,165,
+100,61,119,108,93,67,38,41,48,58,31,10,86,4,86,47,92,133,86,97,144,94,46,
+255,255,0,16,0,0,5,55,5,182,18,2,0,59,0,0,0,1,0,25,0,0,6,135,5,182,0,79,0,
+0,1,51,50,62,2,53,17,33,21,34,14,2,21,21,20,14,4,35,35,17,20,30,2,51,51,21,
+33,53,51,50,62,2,53,17,35,34,46,4,53,53,52,46,2,35,53,33,17,20,30,2,51,51,
+17,52,46,2,35,35,53,33,21,35,34,14,2,21,3,178,47,93,119,69,26,1,115,34,62,
+45,27,16,41,71,109,151,101,68,27,45,62,34,27,253,182,27,35,61,45,27,68,101,
+152,109,70,41,16,27,45,61,35,1,114,26,69,119,93,48,27,45,61,35,27,2,74,27,
+34,62,45,27,2,94,43,92,141,97,1,227,86,10,31,58,48,254,61,116,104,86,63,35,
+254,235,48,58,31,10,86,86,10,31,58,48,1,21,35,63,86,104,116,61,254,48,58,
+31,10,86,254,29,97,141,92,43,2,111,48,58,31,10,86,86,10,31,58,48,0,1,0,86,
+0,0,5,176,5,205,0,59,0,0,19,52,62,2,51,50,30,2,21,20,2,7,7,51,50,62,2,55,
+55,51,3,33,19,62,3,53,52,46,2,35,34,14,2,21,20,30,2,23,19,33,3,51,23,30,3,
+51,51,39,38,2,127,80,160,244,163,155,238,164,84,238,227,4,195,48,68,45,26,
+7,15,106,14,253,160,14,93,130,81,36,44,99,157,114,114,160,101,45,37,81,129,
+93,15,253,159,14,107,14,7,26,45,68,48,195,4,227,238,3,129,133,217,154,84,
+84,154,217,133,226,254,230,45,180,14,31,48,34,67,254,154,1,172,10,73,120,
+165,103,113,177,121,64,64,121,177,113,103,165,120,73,10,254,84,1,102,67,34,
+48,31,14,180,45,1,26,255,255,0,73,0,0,2,162,7,70,18,34,0,44,0,0,16,3,0,106,
+255,38,1,82,255,255,255,246,0,0,5,6,7,70,18,34,0,60,0,0,16,3,0,106,0,68,1,
+82,255,255,0,113,255,236,4,197,6,94,18,34,1,126,0,0,16,2,1,84,25,0,255,255,
+0,111,255,236,3,180,6,94,18,34,1,130,0,0,16,2,1,84,251,0,255,255,0,147,254,
+20,4,53,6,94,18,34,1,132,0,0,16,2,1,84,78,0,255,255,0,201,255,236,2,168,6,
+94,18,34,1,134,0,0,16,3,1,84,254,220,0,0,255,255,0,37,255,236,4,78,6,180,
+18,34,1,146,0,0,16,2,1,85,16,0,0,2,0,113,255,236,4,197,4,94,0,42,0,59,0,0,
+33,34,46,2,39,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,51,54,54,55,51,
+14,3,21,17,20,22,51,51,21,37,50,62,2,53,53,46,3,35,34,6,21,20,22,4,25,51,
+70,46,25,5,8,23,59,76,96,60,101,156,106,54,64,117,166,101,60,96,75,56,20,
+13,17,52,31,109,9,20,15,10,87,81,17,253,112,80,107,65,27,14,51,68,81,44,143,
+132,118,36,57,71,35,47,80,59,33,67,139,214,147,148,216,140,67,31,57,79,48,
+54,103,38,30,97,112,116,49,254,94,91,99,86,111,80,141,190,111,80,74,105,67,
+32,225,221,218,216,0,2,0,201,254,20,4,106,6,27,0,31,0,72,0,0,19,17,52,62,
+2,51,50,22,21,20,14,2,7,6,7,21,30,3,21,20,14,2,35,34,38,39,17,1,50,54,53,
+52,46,2,39,6,6,35,34,38,53,52,54,51,50,30,2,23,54,54,53,52,46,2,35,34,14,
+2,21,17,30,3,201,68,119,161,94,214,214,22,35,46,24,56,71,71,115,82,45,61,
+115,164,102,105,145,45,1,27,123,133,31,60,86,55,26,65,38,34,43,56,56,12,32,
+32,29,10,74,86,31,61,89,59,62,93,62,31,23,61,73,82,254,20,6,115,113,154,95,
+42,177,157,49,83,68,53,21,48,28,13,23,67,98,135,90,118,178,118,59,50,42,253,
+204,2,66,178,187,83,121,86,55,17,11,18,34,32,35,41,3,4,7,3,26,149,122,59,
+97,69,39,40,73,104,65,252,45,25,44,34,20,0,1,0,0,254,20,4,43,4,94,0,61,0,
+0,19,50,30,3,18,23,62,3,53,52,38,39,52,54,51,50,30,2,21,20,14,4,7,22,22,21,
+20,14,2,35,34,38,53,52,62,2,55,46,5,35,34,6,7,39,62,3,221,43,71,62,59,63,
+74,46,65,103,71,37,50,54,68,51,41,53,31,12,36,61,81,91,96,45,2,3,27,49,67,
+40,42,42,20,30,37,18,34,64,63,62,61,62,31,22,41,19,41,20,51,57,62,4,80,34,
+82,137,204,254,232,185,64,167,176,172,68,63,89,14,63,60,35,56,71,36,74,163,
+166,161,144,118,41,26,51,25,97,162,118,66,63,52,56,108,98,88,37,132,245,215,
+177,126,70,16,11,62,18,33,27,16,0,2,0,111,255,236,4,45,6,31,0,17,0,70,0,0,
+1,52,46,2,39,14,3,21,20,30,2,51,50,54,1,20,30,2,23,30,3,21,20,14,2,35,34,
+46,2,53,52,62,2,55,46,3,53,52,62,2,51,50,30,2,21,20,6,35,52,46,2,35,34,14,
+2,3,113,50,81,102,52,58,107,80,48,38,73,105,67,142,153,254,82,28,61,98,69,
+82,134,94,52,69,127,178,109,103,174,127,71,64,112,150,87,51,88,64,36,55,98,
+136,81,85,127,85,43,80,71,28,54,77,48,49,71,45,21,1,201,74,127,107,87,33,
+17,72,116,163,109,70,118,86,48,191,4,8,44,70,67,70,44,52,109,123,144,88,127,
+193,131,67,61,117,170,110,106,162,120,82,26,33,73,84,97,57,70,108,73,38,40,
+61,76,36,65,64,51,91,67,39,24,44,60,0,1,0,111,255,236,3,180,4,92,0,76,0,0,
+1,20,22,23,62,3,51,50,22,21,20,6,35,34,46,2,39,14,3,21,20,22,51,50,62,2,55,
+22,22,21,20,14,2,35,34,46,2,53,52,62,2,55,53,46,3,53,52,62,2,51,50,30,2,21,
+20,6,35,52,38,35,34,14,2,1,84,89,97,18,42,42,39,15,37,45,63,54,15,43,46,43,
+15,37,64,48,27,137,132,60,100,83,64,24,14,25,47,101,160,114,107,157,102,49,
+39,65,84,45,46,74,51,28,57,110,159,102,86,127,84,41,80,81,104,103,58,79,46,
+20,3,59,81,107,6,4,8,6,4,34,35,35,49,4,8,11,7,8,37,56,75,47,102,98,23,40,
+52,28,6,38,26,37,73,57,35,49,86,117,67,62,89,64,42,15,11,15,49,64,76,41,70,
+108,73,38,32,53,69,38,65,58,103,118,31,53,71,0,1,0,111,254,96,3,178,6,53,
+0,62,0,0,19,52,62,2,55,46,3,39,55,30,3,23,62,3,51,50,22,21,20,6,35,14,3,21,
+20,30,2,23,30,3,21,20,14,2,7,53,62,3,53,52,46,2,39,46,3,111,59,112,161,102,
+44,94,93,90,40,58,32,85,98,107,54,23,56,62,64,29,45,49,145,158,87,127,81,
+39,30,70,115,84,61,98,69,38,37,77,118,81,44,58,35,15,20,53,93,74,87,135,92,
+48,1,162,127,255,240,219,91,6,28,42,56,34,73,27,53,44,30,5,16,33,26,17,35,
+35,64,57,97,215,222,221,105,84,107,71,44,20,13,37,52,73,50,54,107,92,68,15,
+107,12,31,39,46,27,31,47,37,30,15,17,60,97,141,0,1,0,147,254,20,4,53,4,94,
+0,43,0,0,19,52,46,2,39,51,22,22,23,51,62,3,51,50,30,2,21,17,20,30,2,23,35,
+46,3,53,17,52,38,35,34,14,2,21,17,35,201,10,15,20,9,115,34,47,17,13,22,57,
+75,98,63,89,132,87,42,6,11,14,8,196,9,14,8,4,112,91,70,95,59,26,192,2,182,
+49,116,112,97,30,42,91,54,41,75,57,34,47,97,152,105,252,164,38,103,102,86,
+20,19,87,106,114,47,3,78,129,131,54,101,145,91,253,172,0,3,0,113,255,236,
+4,49,6,29,0,19,0,30,0,41,0,0,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,50,
+22,22,18,1,50,62,2,55,33,30,3,19,34,14,2,7,33,46,3,4,49,59,120,180,120,127,
+182,117,55,55,118,183,127,120,179,119,59,254,33,72,106,70,36,3,253,192,2,
+35,71,108,75,71,106,72,38,4,2,62,3,37,70,103,3,6,185,254,218,206,109,110,
+205,1,39,186,185,1,37,203,108,108,203,254,218,252,148,90,170,244,153,153,
+244,170,90,5,96,84,160,231,147,147,231,160,84,0,1,0,201,255,236,2,168,4,74,
+0,19,0,0,1,17,20,22,51,50,54,55,21,14,3,35,34,46,2,53,17,1,137,85,71,37,62,
+32,13,42,49,54,24,78,112,72,35,4,74,252,217,105,98,8,6,90,6,12,9,5,33,74,
+122,88,3,33,0,1,0,37,0,0,4,176,4,84,0,52,0,0,19,52,46,2,35,35,53,33,17,20,
+6,7,6,7,62,5,51,50,22,21,20,6,7,38,38,35,34,14,2,7,7,1,22,22,51,51,21,35,
+34,46,2,39,3,7,17,35,221,27,46,61,34,16,1,121,2,2,2,2,80,128,108,91,84,82,
+45,75,77,12,9,15,55,45,42,72,67,64,35,74,1,25,52,106,69,6,29,89,117,85,69,
+41,201,155,193,3,104,45,55,30,10,86,254,180,28,99,50,58,64,121,189,142,99,
+62,28,75,56,23,45,14,15,24,16,36,57,41,86,254,68,84,84,86,10,40,80,69,1,86,
+217,254,188,0,1,0,16,0,0,4,66,6,41,0,48,0,0,1,46,3,35,34,6,7,38,38,53,52,
+62,2,51,50,30,2,23,19,30,3,51,51,21,35,34,46,2,39,46,3,39,35,14,3,7,1,35,
+2,47,28,59,66,72,41,57,86,25,17,18,25,51,77,52,62,101,83,67,27,182,27,65,
+69,70,31,11,48,64,90,70,56,29,27,42,31,17,2,6,4,27,34,39,17,254,252,211,4,
+29,120,151,86,32,51,31,12,44,28,27,48,37,21,37,87,145,108,253,51,106,150,
+96,45,86,21,65,121,100,92,180,148,104,17,25,82,90,89,34,253,240,255,255,0,
+176,254,20,4,150,4,74,18,2,0,119,0,0,0,1,0,0,0,0,4,49,4,94,0,44,0,0,1,20,
+14,4,7,35,46,5,35,34,6,7,39,54,54,51,50,30,3,18,23,62,3,53,52,38,39,52,54,
+51,50,30,2,4,49,39,69,93,109,118,59,109,35,65,61,59,58,59,31,17,37,18,37,
+40,105,62,44,68,59,55,62,74,47,66,112,82,46,51,54,64,51,41,55,32,13,3,152,
+74,166,172,171,155,133,49,132,247,217,179,129,71,10,11,64,35,51,35,84,138,
+204,254,233,182,64,167,176,172,68,63,89,14,63,60,35,56,71,0,1,0,111,254,96,
+3,150,6,53,0,101,0,0,1,20,30,2,23,30,3,21,20,14,2,7,53,62,3,53,52,46,2,39,
+46,3,53,52,62,2,55,53,46,3,53,52,62,2,55,46,3,39,55,30,3,23,62,3,51,50,22,
+21,20,14,2,35,6,6,21,20,30,2,23,62,3,51,50,22,21,20,14,2,35,34,46,2,39,14,
+3,1,53,44,86,128,84,61,98,70,38,38,77,118,81,44,58,35,15,20,53,93,74,87,149,
+108,61,62,109,149,87,61,115,89,54,39,67,88,49,38,85,84,78,32,57,29,80,92,
+98,47,23,63,72,74,33,45,39,46,87,126,79,73,83,39,64,84,46,17,45,47,47,19,
+40,50,22,44,64,42,8,26,28,26,9,51,107,88,57,1,168,67,88,62,42,20,13,37,52,
+73,50,54,107,92,68,15,107,12,31,39,46,27,31,47,37,30,15,17,54,87,127,88,83,
+150,127,101,34,11,15,39,54,72,47,45,81,72,62,25,5,19,30,40,25,73,21,39,32,
+23,4,16,33,26,16,33,29,30,45,31,15,51,119,75,37,62,49,36,11,10,20,15,10,33,
+28,19,36,27,16,2,3,4,1,18,83,114,135,255,255,0,113,255,236,4,45,4,94,18,2,
+0,82,0,0,0,1,0,66,255,240,4,182,4,74,0,58,0,0,1,35,6,7,14,3,21,20,30,2,51,
+50,54,55,21,6,6,35,34,46,2,53,52,62,2,55,54,55,33,3,14,3,35,35,53,50,62,2,
+55,19,35,34,6,7,35,52,62,2,51,33,4,182,227,3,3,1,2,2,1,21,35,43,21,23,39,
+20,24,85,46,45,74,52,28,4,6,8,5,11,13,254,121,27,4,31,63,100,72,86,40,67,
+53,37,10,59,78,59,58,7,86,24,54,87,62,3,145,3,160,133,124,53,112,107,96,37,
+52,62,33,10,10,6,94,20,27,28,58,92,65,37,101,113,119,56,132,143,253,188,89,
+131,86,42,86,29,71,120,91,2,19,73,56,61,108,82,48,0,2,0,180,254,20,4,113,
+4,94,0,23,0,42,0,0,1,20,14,2,35,34,38,39,22,22,21,17,35,17,52,62,2,51,50,
+30,2,7,52,46,2,35,34,14,2,21,17,22,22,51,50,62,2,4,113,61,117,168,107,91,
+158,66,2,2,193,54,113,173,119,111,183,131,73,199,37,75,114,77,77,101,60,24,
+63,152,96,56,94,67,37,2,16,144,208,133,63,44,50,28,91,55,254,120,4,68,125,
+193,132,68,77,149,220,144,115,179,123,65,58,108,151,93,254,119,54,67,47,105,
+168,0,1,0,113,254,96,3,158,4,94,0,53,0,0,1,20,30,2,23,30,3,21,20,14,2,7,53,
+62,3,53,52,46,2,39,46,3,53,52,62,2,51,50,30,2,21,20,6,35,52,46,2,35,34,14,
+2,1,55,34,75,118,85,60,99,69,38,37,78,118,81,44,58,35,15,20,53,93,74,87,139,
+97,51,71,123,167,95,72,130,98,57,92,91,16,39,67,52,57,94,69,38,2,37,96,121,
+76,47,23,16,40,57,80,56,61,113,94,69,16,107,15,36,45,54,34,38,50,37,29,18,
+21,69,112,163,114,156,224,144,68,25,52,79,53,71,58,48,86,65,37,55,115,176,
+0,2,0,113,255,236,4,190,4,74,0,22,0,41,0,0,1,20,2,35,34,46,2,53,52,62,4,51,
+33,21,33,30,3,5,20,30,2,51,50,54,53,52,46,2,39,35,34,14,2,4,72,249,249,111,
+179,126,69,52,91,124,144,160,80,1,194,254,195,28,69,61,41,252,233,42,79,117,
+75,134,145,25,38,45,19,41,77,152,120,75,1,246,255,254,245,73,137,198,124,
+116,177,130,87,53,23,170,28,90,111,129,74,90,151,108,61,194,181,81,147,123,
+91,25,39,98,167,0,1,0,66,255,236,3,205,4,74,0,39,0,0,1,33,6,2,21,20,30,2,
+51,50,54,55,21,14,3,35,34,38,53,52,62,2,55,35,34,14,2,21,35,52,62,2,51,33,
+3,205,254,149,40,42,24,40,54,30,38,82,35,19,41,50,61,39,139,134,24,42,55,
+31,191,45,61,36,15,86,38,69,98,59,2,131,3,160,206,254,181,108,52,75,46,22,
+17,14,90,12,18,12,7,144,130,65,151,169,187,102,27,48,63,36,93,130,83,38,0,
+1,0,37,255,236,4,78,4,90,0,44,0,0,5,34,46,2,53,17,52,46,2,35,35,53,33,17,
+20,22,51,50,62,2,53,52,46,2,39,52,62,2,51,50,30,2,21,20,14,4,2,117,103,153,
+102,50,30,50,64,34,6,1,121,129,119,95,121,70,27,35,56,70,34,19,33,43,24,53,
+77,49,24,18,44,70,106,142,20,58,110,159,101,1,208,45,55,30,10,86,253,96,155,
+160,75,133,182,107,86,133,94,56,10,30,47,33,17,79,130,165,85,87,168,150,126,
+92,52,0,2,0,113,254,20,5,35,4,94,0,25,0,35,0,0,1,6,6,21,20,22,23,17,52,54,
+51,50,18,21,16,0,5,17,35,17,36,0,17,52,18,55,1,54,54,53,52,38,35,34,6,21,
+1,244,97,92,163,179,134,135,176,217,254,237,254,248,123,254,249,254,235,180,
+172,1,55,175,165,116,95,57,72,4,0,41,229,203,224,222,17,2,180,168,170,254,
+199,248,254,239,254,223,13,254,38,1,218,15,1,35,1,7,231,1,31,49,251,250,17,
+226,226,211,244,121,107,0,1,255,248,254,20,4,70,4,80,0,47,0,0,19,35,1,3,46,
+3,35,34,14,2,7,39,54,54,51,50,30,2,23,19,1,51,1,19,30,3,51,50,62,2,55,23,
+6,6,35,34,46,2,39,3,207,215,1,219,164,15,31,36,43,26,11,29,30,28,9,39,40,
+99,62,45,63,48,37,20,119,1,41,198,254,103,176,14,31,37,43,26,11,29,30,28,
+9,35,41,94,62,45,64,48,37,19,131,254,20,3,84,1,179,39,69,52,30,4,8,9,6,66,
+35,45,32,63,92,61,254,152,2,90,252,239,254,21,39,69,52,31,4,8,10,5,66,35,
+44,31,62,93,61,1,160,0,1,0,37,254,20,5,29,6,20,0,48,0,0,37,62,3,53,52,46,
+2,39,52,62,2,51,50,22,21,20,14,4,7,17,35,17,46,3,53,17,52,46,2,35,35,53,33,
+17,20,22,23,17,51,3,72,96,133,84,37,26,46,65,39,19,33,43,24,81,95,19,43,72,
+104,140,91,123,125,187,123,61,30,50,64,34,6,1,121,156,147,123,115,13,82,125,
+163,94,86,130,96,64,19,30,46,31,16,229,230,79,153,139,122,94,64,12,254,32,
+1,216,1,59,110,158,100,1,208,45,55,30,10,86,253,96,146,160,9,5,165,0,1,0,
+113,255,236,5,180,4,94,0,78,0,0,5,34,46,2,39,35,14,3,35,34,46,2,53,52,62,
+2,55,23,14,3,21,20,30,2,51,50,62,2,55,46,3,53,52,54,51,50,22,21,20,14,2,7,
+30,3,51,50,62,2,53,52,46,2,39,55,30,3,21,20,14,2,4,49,53,90,72,52,15,9,15,
+53,71,90,53,89,143,101,54,39,70,96,57,86,34,56,39,21,35,60,80,44,50,72,49,
+31,7,7,17,14,9,54,40,41,54,10,14,16,7,8,30,49,72,49,45,80,60,35,21,39,55,
+35,86,57,96,70,39,54,100,144,20,32,56,77,45,45,77,56,32,65,129,196,130,101,
+176,154,132,55,67,60,120,133,151,91,105,153,100,48,35,66,92,57,24,62,71,74,
+35,86,74,74,86,35,74,71,62,24,57,92,66,35,48,100,153,105,91,151,133,120,60,
+67,55,132,154,176,101,130,196,129,65,255,255,0,5,255,236,2,168,5,244,18,34,
+1,134,0,0,16,3,0,106,254,226,0,0,255,255,0,37,255,236,4,78,5,244,18,34,1,
+146,0,0,16,2,0,106,0,0,255,255,0,113,255,236,4,45,6,94,18,34,0,82,0,0,16,
+2,1,84,14,0,255,255,0,37,255,236,4,78,6,94,18,34,1,146,0,0,16,2,1,84,66,0,
+255,255,0,113,255,236,5,180,6,94,18,34,1,150,0,0,16,3,1,84,0,195,0,0,255,
+255,0,78,0,0,4,166,7,70,18,34,0,40,0,0,16,3,0,106,0,51,1,82,0,1,0,41,0,0,
+5,182,5,182,0,69,0,0,1,20,14,2,35,35,53,51,50,62,2,53,52,46,2,35,34,14,2,
+7,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,35,34,14,2,7,7,35,19,33,19,35,
+39,46,3,35,35,17,62,3,51,50,30,2,5,182,53,101,146,93,47,29,49,76,52,27,41,
+75,102,62,45,85,75,61,21,27,45,62,34,27,253,151,47,34,61,46,27,155,45,61,
+39,19,4,11,106,10,4,43,10,106,10,4,20,38,62,46,154,24,66,79,91,49,112,173,
+119,61,1,199,132,176,104,43,96,33,81,135,101,102,128,72,26,10,14,17,8,254,
+20,48,58,31,10,86,86,9,28,55,45,4,113,27,46,61,34,88,1,102,254,154,88,34,
+61,46,27,253,246,9,21,17,12,42,102,170,255,255,0,78,0,0,4,84,7,115,18,34,
+1,97,0,0,16,3,0,118,0,125,1,82,0,1,0,117,255,236,4,164,5,203,0,50,0,0,1,50,
+30,2,21,20,14,2,35,52,46,2,35,34,14,2,7,33,21,33,30,3,51,50,62,2,55,22,22,
+21,20,14,2,35,34,38,38,2,53,52,18,54,54,3,6,105,155,103,51,27,48,65,38,25,
+57,91,67,111,158,102,51,4,2,53,253,203,4,53,103,158,108,75,115,88,67,26,17,
+22,53,108,166,114,153,232,157,80,84,165,246,5,203,35,62,84,49,33,53,37,20,
+48,94,75,47,78,149,218,141,100,128,211,151,83,29,48,63,34,11,38,31,39,81,
+66,43,108,198,1,22,169,166,1,20,198,110,255,255,0,98,255,236,3,242,5,203,
+18,2,0,54,0,0,255,255,0,78,0,0,2,162,5,182,18,2,0,44,0,0,255,255,0,73,0,0,
+2,162,7,70,18,34,0,44,0,0,16,3,0,106,255,38,1,82,255,255,255,233,254,20,2,
+162,5,182,18,2,0,45,0,0,0,2,0,0,255,242,6,205,5,182,0,69,0,82,0,0,1,21,35,
+34,14,2,21,17,51,50,30,2,21,20,14,2,35,33,53,51,50,62,2,53,17,33,6,2,2,6,
+7,14,3,35,34,38,53,52,54,51,20,30,2,51,50,62,2,55,62,5,53,52,46,2,35,35,53,
+1,51,50,62,2,53,52,46,2,35,35,5,39,47,33,61,46,28,88,148,209,132,60,61,124,
+190,129,253,233,27,33,61,46,28,254,240,6,26,37,49,30,28,61,75,92,57,82,82,
+48,42,12,25,38,25,28,52,50,49,26,18,30,25,19,13,6,26,45,59,34,31,3,25,98,
+87,121,76,34,39,85,132,93,67,5,182,86,9,27,51,42,254,74,59,107,148,89,90,
+149,108,59,86,9,27,51,42,4,121,128,254,231,254,235,255,102,93,127,78,33,75,
+68,53,72,14,33,29,20,17,60,114,97,66,158,164,163,144,116,35,28,34,17,5,86,
+250,172,37,73,112,75,86,121,76,35,0,2,0,78,0,0,7,115,5,182,0,71,0,84,0,0,
+1,21,35,34,14,2,21,17,51,50,30,2,21,20,14,2,35,33,53,51,50,62,2,53,17,33,
+17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,
+2,21,17,33,17,52,46,2,35,35,53,1,51,50,62,2,53,52,46,2,35,35,5,184,26,33,
+61,46,28,88,148,209,132,60,61,124,190,129,253,233,27,33,61,46,28,253,184,
+27,45,62,34,27,253,172,26,35,61,46,26,27,46,61,34,26,2,84,27,34,62,45,27,
+2,72,27,45,61,35,27,1,146,98,87,121,76,34,39,85,132,93,67,5,182,86,9,27,51,
+42,254,74,59,107,148,89,90,149,108,59,86,9,27,51,42,1,242,254,32,48,58,31,
+10,86,86,10,31,58,48,3,236,45,55,30,9,86,86,10,31,58,48,254,98,1,158,48,58,
+31,10,86,250,172,37,73,112,75,86,121,76,35,0,1,0,41,0,0,6,121,5,182,0,73,
+0,0,33,53,51,50,62,2,53,53,52,46,2,35,34,14,2,7,17,20,30,2,51,51,21,33,53,
+51,50,62,2,53,17,35,34,14,2,7,7,35,19,33,19,35,39,46,3,35,35,17,62,3,51,50,
+30,2,21,21,20,30,2,51,51,21,4,37,26,35,61,46,26,41,75,102,62,45,85,75,61,
+21,27,45,62,34,27,253,151,47,34,61,46,27,155,45,61,39,19,4,11,106,10,4,43,
+10,106,10,4,20,38,62,46,154,24,66,79,91,49,112,173,119,61,27,45,62,34,27,
+86,10,31,58,48,213,102,128,72,26,10,14,17,8,254,20,48,58,31,10,86,86,9,28,
+55,45,4,113,27,46,61,34,88,1,102,254,154,88,34,61,46,27,253,246,9,21,17,12,
+42,102,170,128,222,48,58,31,10,86,255,255,0,78,0,0,5,123,7,115,18,34,1,180,
+0,0,16,3,0,118,1,25,1,82,255,255,0,0,0,0,5,102,7,64,18,34,1,189,0,0,16,3,
+2,52,0,117,1,82,0,1,0,78,254,82,5,205,5,182,0,61,0,0,55,51,50,62,2,53,17,
+52,46,2,35,35,53,33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,33,21,35,34,
+14,2,21,17,20,30,2,51,51,21,33,34,14,2,21,35,52,46,2,35,33,78,26,34,61,46,
+27,26,46,61,35,26,2,84,27,34,62,45,27,2,92,26,46,61,35,26,2,84,27,34,61,46,
+27,27,45,62,34,27,254,86,55,86,59,30,94,36,66,92,56,254,105,86,9,30,55,45,
+3,236,48,58,31,10,86,86,10,31,58,48,251,153,4,103,48,58,31,10,86,86,9,28,
+55,45,252,18,48,58,31,10,86,49,105,162,114,114,162,105,49,255,255,0,0,0,0,
+5,164,5,182,18,2,0,36,0,0,0,2,0,78,0,0,4,133,5,182,0,37,0,50,0,0,1,19,35,
+39,46,3,35,33,17,51,50,30,2,21,20,14,2,35,33,53,51,50,62,2,53,17,52,46,2,
+35,35,53,1,51,50,62,2,53,52,46,2,35,35,4,41,10,106,11,4,19,39,62,46,254,203,
+129,149,208,132,60,61,124,190,129,253,193,26,34,61,46,27,26,46,61,35,26,1,
+145,139,87,121,76,34,39,84,132,93,109,5,182,254,154,88,34,61,46,27,253,217,
+59,107,148,89,90,149,108,59,86,9,30,55,45,3,236,48,58,31,10,86,250,172,37,
+73,112,75,86,121,76,35,255,255,0,78,0,0,4,190,5,182,18,2,0,37,0,0,255,255,
+0,78,0,0,4,84,5,182,18,2,1,97,0,0,0,2,0,29,254,82,5,53,5,182,0,9,0,52,0,0,
+1,20,14,4,7,33,17,1,54,26,2,53,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,
+30,2,51,51,17,35,52,46,2,35,33,34,14,2,21,35,17,2,143,33,57,75,83,86,40,2,
+127,253,2,73,138,107,65,30,50,65,34,6,3,174,26,28,53,39,24,27,45,62,34,41,
+94,42,78,112,71,254,2,70,113,78,42,94,5,80,101,220,225,225,212,193,82,4,234,
+251,22,152,1,65,1,55,1,31,119,29,33,17,5,86,86,9,28,55,45,252,35,48,59,31,
+10,253,236,114,162,105,49,49,105,162,114,2,20,255,255,0,78,0,0,4,166,5,182,
+18,2,0,40,0,0,0,1,0,0,0,0,7,213,5,195,0,151,0,0,1,52,46,2,35,35,53,33,21,
+35,34,14,2,21,17,50,62,2,55,54,54,55,62,3,51,50,30,2,21,20,14,2,7,46,3,35,
+34,6,7,14,3,7,30,3,23,19,22,22,51,51,21,35,34,46,2,39,3,46,3,35,17,20,30,
+2,51,51,21,33,53,51,50,62,2,53,17,34,14,2,7,3,14,3,35,35,53,51,50,54,55,19,
+62,3,55,46,3,39,38,38,35,34,14,2,7,46,3,53,52,62,2,51,50,30,2,23,22,22,23,
+30,3,51,3,139,27,46,61,34,6,2,27,6,34,62,45,27,41,52,36,26,13,26,76,57,39,
+79,87,100,60,45,64,39,18,16,27,36,19,4,18,30,42,27,60,109,63,32,49,42,39,
+24,54,77,59,45,23,192,48,113,69,6,29,98,130,88,62,31,187,24,41,57,88,72,27,
+45,62,34,6,253,229,6,34,61,46,27,72,88,57,41,24,187,31,62,88,130,98,29,6,
+69,113,48,192,23,45,59,77,54,24,39,42,49,32,63,109,60,27,42,30,18,4,19,36,
+27,16,18,39,64,45,60,100,87,79,39,57,76,26,13,26,36,53,40,4,213,45,55,30,
+9,86,86,10,31,58,48,254,65,7,15,24,16,32,152,113,77,123,87,47,20,34,48,27,
+29,48,35,22,4,23,42,32,18,118,124,63,96,73,54,21,2,25,44,65,42,254,166,87,
+77,86,16,43,75,59,1,100,46,55,29,9,254,57,48,58,31,10,86,86,9,28,55,45,1,
+209,9,29,55,46,254,156,59,75,43,16,86,77,87,1,90,42,65,44,25,2,21,54,73,96,
+63,124,118,18,32,42,23,4,22,35,48,29,27,48,34,20,47,87,123,77,113,152,32,
+16,24,15,7,0,1,0,92,255,233,4,86,5,203,0,71,0,0,37,50,62,2,53,52,46,2,35,
+35,53,51,50,62,2,53,52,46,2,35,34,14,2,21,34,46,2,53,52,62,2,51,50,30,2,21,
+20,14,2,7,21,30,3,21,20,14,2,35,34,46,2,53,52,54,51,20,30,2,2,47,72,120,85,
+47,45,89,131,86,174,174,68,117,87,50,30,65,104,73,86,109,62,22,37,64,48,27,
+58,115,170,112,107,179,129,72,52,89,120,69,57,130,111,73,89,151,199,110,130,
+179,111,49,92,80,35,72,111,90,34,78,126,92,64,106,74,41,104,44,83,117,73,
+60,94,66,34,50,84,110,61,12,31,51,39,59,101,73,42,40,84,129,89,80,122,90,
+59,16,10,7,36,77,128,98,119,167,106,49,47,73,90,44,76,76,54,105,83,51,0,1,
+0,78,0,0,6,31,5,182,0,67,0,0,33,53,51,50,62,2,53,17,1,21,20,30,2,51,51,21,
+33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,1,53,52,46,
+2,35,35,53,33,21,35,34,14,2,21,17,20,30,2,51,51,21,3,203,26,35,61,46,26,253,
+82,27,45,62,34,27,253,172,26,35,61,46,26,27,46,61,34,26,2,84,27,34,62,45,
+27,2,174,26,46,61,35,26,2,84,27,34,62,45,27,27,46,61,34,27,86,10,31,58,48,
+3,43,252,254,41,48,58,31,10,86,86,10,31,58,48,3,236,45,55,30,9,86,86,10,31,
+58,48,252,213,3,2,41,48,58,31,10,86,86,10,31,58,48,252,18,45,55,28,9,86,255,
+255,0,78,0,0,6,31,7,64,18,34,1,178,0,0,16,3,2,52,0,233,1,82,0,1,0,78,0,0,
+5,123,5,195,0,91,0,0,1,20,14,2,7,46,3,35,34,6,7,14,3,7,30,3,23,19,22,22,51,
+51,21,35,34,46,2,39,3,46,3,35,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,
+52,46,2,35,35,53,33,21,35,34,14,2,21,17,50,62,2,55,54,54,55,62,3,51,50,30,
+2,5,74,16,28,35,20,4,18,29,42,27,60,109,63,32,49,42,39,24,54,77,58,46,23,
+192,48,113,69,6,29,98,130,88,62,31,187,24,46,63,94,72,27,45,62,34,27,253,
+172,26,34,61,46,27,27,46,61,34,26,2,84,27,34,62,45,27,48,60,39,25,13,26,76,
+57,39,79,87,100,60,45,64,39,18,5,66,29,48,35,22,4,23,42,32,18,118,124,63,
+96,73,54,21,2,25,44,65,42,254,166,87,77,86,16,43,75,59,1,100,46,55,29,9,254,
+57,48,58,31,10,86,86,9,28,55,45,3,246,45,55,30,9,86,86,10,31,58,48,254,65,
+7,15,24,16,32,152,113,77,123,87,47,20,34,48,0,1,0,0,255,242,5,80,5,182,0,
+65,0,0,23,34,38,53,52,54,51,20,30,2,51,50,62,2,55,62,5,53,52,46,2,35,35,53,
+33,21,35,34,14,2,21,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,33,6,2,2,6,
+7,14,3,164,82,82,48,42,12,25,38,25,28,52,50,49,26,18,30,25,19,13,6,26,45,
+59,34,31,4,25,27,35,61,45,27,27,45,61,35,27,253,172,27,34,61,46,26,254,179,
+6,26,37,49,30,28,61,75,92,14,75,68,53,72,14,33,29,20,17,60,114,97,66,156,
+164,161,144,118,37,28,34,17,5,86,86,10,31,58,48,252,28,48,58,31,10,86,86,
+10,31,58,48,4,103,128,254,231,254,235,255,102,93,127,78,33,255,255,0,78,0,
+0,7,51,5,182,18,2,0,48,0,0,255,255,0,78,0,0,6,10,5,182,18,2,0,43,0,0,255,
+255,0,115,255,236,5,123,5,205,18,2,0,50,0,0,255,255,0,78,0,0,5,205,5,182,
+18,2,1,110,0,0,255,255,0,78,0,0,4,133,5,182,18,2,0,51,0,0,255,255,0,117,255,
+236,4,164,5,203,18,2,0,38,0,0,255,255,0,41,0,0,4,190,5,182,18,2,0,55,0,0,
+0,1,0,0,0,0,5,102,5,182,0,58,0,0,1,35,34,14,2,7,1,14,5,35,35,53,51,50,62,
+2,55,1,46,3,35,35,53,33,21,35,34,6,21,20,22,23,19,22,22,23,62,3,55,19,54,
+54,53,52,38,35,35,53,33,5,102,39,30,41,33,31,20,254,166,33,58,59,67,86,110,
+73,149,112,52,99,85,65,17,254,47,15,26,33,41,30,27,2,61,32,62,61,8,8,225,
+35,51,17,7,19,23,28,17,193,9,9,67,68,43,1,237,5,96,13,36,62,48,252,182,80,
+119,83,53,29,11,96,30,55,76,46,3,197,31,41,25,11,86,86,47,51,17,36,23,254,
+27,72,144,63,32,62,64,71,42,1,223,25,46,17,53,47,86,255,255,0,68,0,0,5,217,
+5,182,18,2,1,115,0,0,255,255,0,16,0,0,5,55,5,182,18,2,0,59,0,0,0,1,0,78,254,
+82,5,219,5,182,0,55,0,0,1,52,46,2,35,33,53,51,50,62,2,53,17,52,46,2,35,35,
+53,33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,
+30,2,51,51,17,5,125,42,81,117,75,252,12,26,34,61,46,27,26,46,61,35,26,2,84,
+27,34,62,45,27,2,92,26,46,61,35,26,2,84,27,34,61,46,27,27,45,62,34,41,254,
+82,114,162,105,49,86,9,30,55,45,3,236,48,58,31,10,86,86,10,31,58,48,251,153,
+4,103,48,58,31,10,86,86,9,28,55,45,252,18,48,58,31,10,253,252,0,1,0,43,0,
+0,5,190,5,182,0,65,0,0,1,14,3,35,34,38,53,17,52,46,2,35,35,53,33,21,35,34,
+14,2,21,17,20,22,51,50,62,2,55,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,
+20,30,2,51,51,21,33,53,51,50,62,2,53,4,45,55,100,105,118,73,188,192,27,46,
+61,34,27,2,84,27,34,62,45,27,128,112,51,92,93,95,54,27,45,61,35,27,2,84,26,
+34,62,45,27,27,46,61,34,26,253,172,27,35,61,45,27,2,152,27,46,35,19,185,185,
+1,74,45,55,30,9,86,86,10,31,58,48,254,192,125,116,14,27,40,25,1,199,48,58,
+31,10,86,86,10,31,58,48,252,18,45,55,28,9,86,86,10,31,58,48,0,1,0,78,0,0,
+8,84,5,182,0,67,0,0,37,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,30,2,
+51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,33,
+17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,6,195,27,45,61,35,27,2,84,27,34,
+62,45,27,27,46,61,34,27,247,250,26,34,61,46,27,26,46,61,35,26,2,84,27,34,
+62,45,27,2,10,23,41,53,30,6,2,2,6,31,55,39,23,102,4,103,48,58,31,10,86,86,
+10,31,58,48,252,20,45,55,30,9,86,86,9,30,55,45,3,236,48,58,31,10,86,86,10,
+31,58,48,251,153,4,111,42,54,31,12,86,86,12,33,57,45,251,153,0,1,0,78,254,
+82,8,98,5,182,0,71,0,0,1,35,52,38,35,33,53,51,50,62,2,53,17,52,46,2,35,35,
+53,33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,33,
+17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,30,2,51,51,8,98,94,158,143,
+249,119,26,34,61,46,27,26,46,61,35,26,2,84,27,34,62,45,27,2,10,23,41,53,30,
+6,2,2,6,31,55,39,23,2,11,27,45,61,35,27,2,84,27,34,62,45,27,27,45,62,34,41,
+254,82,217,213,86,9,30,55,45,3,236,48,58,31,10,86,86,10,31,58,48,251,153,
+4,111,42,54,31,12,86,86,12,33,57,45,251,153,4,103,48,58,31,10,86,86,10,31,
+58,48,252,28,48,58,31,10,0,2,0,41,0,0,5,86,5,182,0,37,0,50,0,0,1,21,35,34,
+14,2,21,17,51,50,30,2,21,20,14,2,35,33,53,51,50,62,2,53,17,35,34,14,2,7,7,
+35,19,1,51,50,62,2,53,52,46,2,35,35,3,156,68,34,61,46,27,129,148,209,132,
+60,61,124,190,129,253,193,26,34,61,46,27,155,45,61,39,19,4,11,106,10,2,125,
+139,87,121,76,34,39,84,132,93,109,5,182,86,9,28,55,45,254,82,59,107,148,89,
+90,149,108,59,86,9,30,55,45,4,111,27,46,61,34,88,1,102,250,172,37,73,112,
+75,86,121,76,35,0,3,0,78,0,0,6,244,5,182,0,35,0,48,0,80,0,0,1,21,35,34,14,
+2,21,17,51,50,30,2,21,20,14,2,35,33,53,51,50,62,2,53,17,52,46,2,35,35,53,
+1,51,50,62,2,53,52,46,2,35,35,1,53,51,50,62,2,53,17,52,46,2,35,35,53,33,21,
+35,34,14,2,21,17,20,30,2,51,51,21,2,203,68,34,61,46,27,88,149,208,132,60,
+61,124,190,129,253,234,26,34,61,46,27,26,46,61,35,26,1,145,99,87,120,76,34,
+39,84,132,93,68,2,193,26,35,61,46,26,26,46,61,35,26,2,84,27,34,62,45,27,27,
+45,62,34,27,5,182,86,9,28,55,45,254,82,59,107,148,89,90,149,108,59,86,9,30,
+55,45,3,236,48,58,31,10,86,250,172,37,73,112,75,86,121,76,35,253,55,86,10,
+31,58,48,3,228,48,58,31,10,86,86,10,31,58,48,252,28,48,58,31,10,86,0,2,0,
+78,0,0,4,133,5,182,0,35,0,48,0,0,1,21,35,34,14,2,21,17,51,50,30,2,21,20,14,
+2,35,33,53,51,50,62,2,53,17,52,46,2,35,35,53,1,51,50,62,2,53,52,46,2,35,35,
+2,203,68,34,61,46,27,129,149,208,132,60,61,124,190,129,253,193,26,34,61,46,
+27,26,46,61,35,26,1,145,139,87,121,76,34,39,84,132,93,109,5,182,86,9,28,55,
+45,254,82,59,107,148,89,90,149,108,59,86,9,30,55,45,3,236,48,58,31,10,86,
+250,172,37,73,112,75,86,121,76,35,0,1,0,92,255,236,4,115,5,203,0,48,0,0,5,
+34,46,2,53,52,54,51,20,30,2,51,50,62,2,55,33,53,33,46,3,35,34,14,2,21,34,
+38,53,52,62,2,51,50,22,22,18,21,20,2,6,6,2,18,125,168,102,43,92,80,30,65,
+103,73,93,138,93,48,4,253,203,2,53,4,42,84,131,93,67,103,70,36,76,92,55,111,
+168,114,136,215,148,79,81,155,227,20,46,72,89,44,76,76,54,105,84,52,91,161,
+220,128,100,141,218,149,78,47,78,101,54,66,63,51,94,72,43,95,187,254,235,
+181,173,254,230,200,108,0,2,0,78,255,236,7,221,5,205,0,54,0,74,0,0,1,20,2,
+6,6,35,34,38,38,2,39,33,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,
+2,35,35,53,33,21,35,34,14,2,21,17,33,62,3,51,50,22,22,18,5,20,30,2,51,50,
+62,2,53,52,46,2,35,34,14,2,7,221,81,156,228,147,153,228,153,78,3,254,205,
+27,45,62,34,27,253,172,26,35,61,46,26,27,46,61,34,26,2,84,27,34,62,45,27,
+1,53,9,84,153,222,147,147,227,155,81,252,25,42,92,148,105,106,147,91,41,41,
+91,146,105,106,148,93,42,2,221,169,254,234,198,108,104,192,1,15,166,254,32,
+48,58,31,10,86,86,10,31,58,48,3,236,45,55,30,9,86,86,10,31,58,48,254,98,153,
+248,174,95,107,197,254,235,171,152,239,165,87,87,165,239,152,152,239,164,
+86,86,164,239,0,2,255,233,0,0,4,242,5,182,0,12,0,61,0,0,1,35,34,14,2,21,20,
+30,2,51,51,7,1,14,3,35,35,53,51,50,62,2,55,1,46,3,53,52,36,33,33,21,35,34,
+14,2,21,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,3,96,100,95,135,86,40,
+37,77,116,79,147,202,254,247,34,61,84,120,92,29,7,32,56,51,50,26,1,8,51,98,
+78,48,1,23,1,8,2,23,27,34,61,46,27,27,46,61,34,27,253,172,26,34,61,46,27,
+5,84,37,78,122,85,73,116,82,44,96,254,65,57,71,41,15,86,20,41,61,42,1,166,
+18,60,93,134,92,202,191,86,9,30,55,45,252,10,45,55,28,9,86,86,9,28,55,45,
+1,152,255,255,0,102,255,236,4,41,4,94,18,2,0,68,0,0,0,2,0,113,255,236,4,43,
+6,31,0,39,0,57,0,0,19,52,62,4,55,62,3,55,51,14,3,7,14,3,7,51,62,3,51,50,18,
+17,20,14,2,35,34,2,37,52,46,2,35,34,14,2,21,20,22,51,50,62,2,113,16,41,71,
+109,153,103,68,124,98,67,12,65,2,59,111,163,107,114,136,75,28,5,8,16,61,89,
+114,70,233,236,58,120,182,123,234,237,2,245,29,67,109,81,81,107,62,25,130,
+145,81,109,67,29,2,123,113,203,175,145,108,69,12,9,14,22,34,28,85,99,56,26,
+13,13,53,101,162,123,47,82,61,35,254,239,254,246,131,202,138,71,1,64,222,
+108,162,109,55,55,109,162,108,213,223,56,111,163,0,3,0,47,0,0,4,82,4,74,0,
+35,0,46,0,59,0,0,19,33,50,22,21,20,14,2,7,21,30,3,21,20,14,2,35,33,53,51,
+50,62,2,53,17,52,46,2,35,35,1,50,62,2,53,52,38,35,35,25,2,51,50,62,2,53,52,
+46,2,35,47,2,84,215,199,33,61,85,53,65,103,74,39,52,105,159,108,253,133,27,
+34,61,46,27,27,46,61,34,27,2,84,68,97,62,29,139,129,197,199,62,87,54,24,24,
+53,87,63,4,74,136,128,61,91,63,37,7,10,8,38,61,87,58,67,115,84,47,86,9,28,
+55,45,2,137,45,55,30,10,252,106,25,54,86,60,108,89,254,90,3,142,254,122,29,
+53,73,44,40,70,51,30,0,1,0,47,0,0,3,129,4,74,0,33,0,0,1,17,35,39,46,3,35,
+35,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,3,129,100,
+11,7,21,32,48,35,209,27,46,61,34,47,253,166,27,34,61,46,27,27,46,61,34,27,
+4,74,254,184,68,48,64,38,16,252,243,45,55,28,9,86,86,9,28,55,45,2,137,45,
+55,30,10,86,0,2,0,27,254,82,4,125,4,74,0,45,0,56,0,0,55,54,54,55,62,3,53,
+52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,22,23,51,17,35,39,46,3,39,33,34,
+14,2,7,7,35,17,37,6,6,7,33,17,33,14,3,168,32,65,34,12,26,23,15,27,46,61,34,
+27,3,195,27,34,61,46,27,48,38,115,100,11,5,38,55,66,34,254,8,48,71,48,27,
+5,10,100,1,88,26,36,20,1,211,254,248,10,26,30,35,94,50,177,125,42,119,124,
+115,39,41,49,28,9,86,86,9,29,55,45,253,117,62,58,9,253,244,149,78,106,65,
+30,2,30,67,107,77,149,2,12,223,87,107,29,3,142,94,187,176,161,255,255,0,113,
+255,236,3,225,4,94,18,2,0,72,0,0,0,1,0,6,0,0,7,4,4,86,0,147,0,0,1,52,46,2,
+35,35,53,33,21,35,34,14,2,21,17,50,62,2,55,54,54,55,62,3,51,50,22,21,20,14,
+2,7,46,3,35,34,14,2,7,14,3,7,22,22,23,23,22,22,51,51,21,35,34,46,2,39,39,
+46,3,35,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,34,14,2,7,7,14,3,35,35,
+53,51,50,54,55,55,54,54,55,46,3,39,46,3,35,34,14,2,7,46,3,53,52,54,51,50,
+30,2,23,22,22,23,30,3,51,3,43,24,41,53,29,9,1,234,6,29,54,41,24,30,41,31,
+23,12,26,71,53,35,61,67,85,59,87,89,16,27,36,19,4,17,29,39,26,25,45,44,46,
+26,28,44,38,36,20,96,128,46,107,47,101,69,6,72,78,105,76,58,31,100,23,51,
+66,86,59,24,41,54,29,6,254,22,9,30,53,40,24,58,87,66,51,23,100,31,57,76,106,
+78,72,6,69,101,47,107,46,128,96,20,36,38,44,28,26,45,44,45,26,25,40,28,18,
+4,19,36,27,16,89,87,59,85,67,61,35,53,71,26,12,24,30,41,30,3,104,45,55,30,
+10,86,86,9,27,51,42,254,254,5,10,16,12,24,106,79,54,86,60,33,69,56,28,45,
+32,20,4,23,42,32,18,19,39,59,39,40,62,48,35,14,5,88,85,188,86,78,86,16,43,
+75,59,198,45,54,30,10,254,205,45,55,28,9,86,86,10,31,58,48,1,41,10,30,54,
+45,198,59,75,43,16,86,78,86,188,85,88,5,14,35,48,62,40,39,59,39,19,18,32,
+42,23,4,20,32,45,28,56,69,33,60,86,54,79,106,24,12,16,10,5,0,1,0,82,255,236,
+3,121,4,92,0,62,0,0,37,50,54,53,52,38,35,35,53,51,50,62,2,53,52,46,2,35,34,
+6,21,34,38,53,52,62,2,51,50,30,2,21,20,14,2,7,21,30,3,21,20,14,2,35,34,46,
+2,53,52,51,20,30,2,1,203,118,113,127,112,191,193,52,78,51,25,19,43,71,51,
+103,108,81,81,44,92,143,98,88,139,97,51,30,55,76,46,53,89,64,36,50,107,166,
+117,110,142,83,32,151,28,56,85,78,129,112,104,97,111,31,53,71,41,40,71,53,
+31,118,103,58,65,37,70,53,32,37,69,100,62,49,85,67,50,15,11,13,41,62,83,55,
+71,122,92,52,42,65,78,36,131,54,93,68,39,0,1,0,47,0,0,5,82,4,74,0,67,0,0,
+1,21,35,34,14,2,21,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,1,21,20,30,
+2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,
+1,53,52,46,2,35,35,53,5,82,27,34,61,46,27,27,46,61,34,27,253,186,27,34,61,
+46,27,253,227,27,46,61,34,27,253,186,27,34,61,46,27,27,46,61,34,27,2,70,27,
+34,61,46,27,2,29,27,46,61,34,6,4,74,86,9,29,55,45,253,117,45,55,28,9,86,86,
+9,28,55,45,1,254,254,12,10,45,55,28,9,86,86,9,28,55,45,2,137,45,55,30,10,
+86,86,9,29,55,45,254,0,1,248,6,45,55,30,10,86,255,255,0,47,0,0,5,82,5,238,
+18,34,1,210,0,0,16,2,2,52,125,0,0,1,0,37,0,0,4,215,4,86,0,89,0,0,33,34,46,
+2,39,39,46,3,35,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,
+53,33,21,35,34,14,2,21,17,50,62,2,55,54,54,55,62,3,51,50,22,21,20,14,2,7,
+46,3,35,34,6,7,14,3,7,30,3,23,23,22,22,51,51,21,4,143,78,112,83,64,31,101,
+23,44,59,80,58,27,46,61,34,6,253,197,37,34,62,45,27,27,46,61,34,37,2,59,6,
+33,61,46,28,30,44,33,27,12,26,70,53,35,61,68,84,59,87,89,16,27,36,19,4,18,
+28,40,25,50,84,52,28,44,38,36,20,48,72,59,48,23,107,48,112,69,6,16,43,75,
+59,198,45,54,30,10,254,205,45,55,28,9,86,86,10,31,58,48,2,127,45,55,30,10,
+86,86,9,27,51,42,254,254,5,10,16,12,24,106,79,54,86,60,33,69,56,29,44,32,
+20,4,23,42,31,19,77,79,41,61,48,35,14,2,25,44,65,42,188,87,77,86,0,1,0,0,
+255,242,4,215,4,74,0,63,0,0,1,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,
+30,2,51,51,21,33,53,51,50,62,2,53,17,33,14,3,7,14,3,35,34,38,53,52,54,51,
+20,30,2,51,50,62,2,55,62,3,1,215,27,46,61,34,27,3,195,27,34,61,46,27,27,46,
+61,34,27,253,207,6,34,61,46,27,254,248,10,26,30,35,20,28,58,71,89,57,82,82,
+48,42,12,25,38,25,29,51,50,49,26,12,26,23,15,3,117,41,49,28,9,86,86,9,29,
+55,45,253,117,45,55,28,9,86,86,9,28,55,45,3,13,94,187,176,161,69,93,127,78,
+33,75,68,53,72,14,33,29,20,17,60,114,97,42,119,124,115,0,1,0,47,0,0,6,29,
+4,74,0,56,0,0,33,33,53,51,50,62,2,53,17,35,1,35,1,35,17,20,30,2,51,51,21,
+33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,1,1,33,21,35,34,14,2,21,17,20,
+30,2,51,51,6,29,253,207,6,34,61,46,27,15,254,156,94,254,166,15,27,46,61,34,
+6,254,33,27,34,61,46,27,27,46,61,34,27,1,182,1,68,1,82,1,162,27,34,61,46,
+27,27,46,61,34,27,86,9,28,55,45,2,144,252,145,3,111,253,112,45,55,28,9,86,
+86,9,28,55,45,2,137,45,55,30,10,86,252,196,3,60,86,9,29,55,45,253,117,45,
+55,28,9,0,1,0,47,0,0,5,82,4,74,0,67,0,0,1,21,35,34,14,2,21,17,20,30,2,51,
+51,21,33,53,51,50,62,2,53,17,33,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,
+52,46,2,35,35,53,33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,5,82,27,34,
+61,46,27,27,46,61,34,27,253,207,6,34,61,46,27,253,227,27,46,61,34,6,253,207,
+27,34,61,46,27,27,46,61,34,27,2,49,6,34,61,46,27,2,29,27,46,61,34,6,4,74,
+86,9,29,55,45,253,117,45,55,28,9,86,86,9,28,55,45,1,37,254,219,45,55,28,9,
+86,86,9,28,55,45,2,137,45,55,30,10,86,86,9,29,55,45,254,248,1,6,45,55,30,
+10,86,255,255,0,113,255,236,4,45,4,94,18,2,0,82,0,0,0,1,0,47,0,0,5,41,4,74,
+0,49,0,0,1,21,35,34,14,2,21,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,33,
+17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,5,41,27,34,61,
+46,27,27,46,61,34,27,253,207,6,34,61,46,27,254,12,27,46,61,34,6,253,207,27,
+34,61,46,27,27,46,61,34,27,4,74,86,9,29,55,45,253,117,45,55,28,9,86,86,9,
+28,55,45,3,13,252,243,45,55,28,9,86,86,9,28,55,45,2,137,45,55,30,10,86,255,
+255,0,27,254,20,4,121,4,94,18,2,0,83,0,0,255,255,0,113,255,236,3,160,4,94,
+18,2,0,70,0,0,0,1,0,41,0,0,4,55,4,74,0,35,0,0,1,19,35,39,46,3,35,35,17,20,
+30,2,51,51,21,33,53,51,50,62,2,53,17,35,34,14,2,7,7,35,19,4,43,12,100,10,
+8,20,32,48,36,168,27,46,61,34,47,253,166,27,34,61,46,27,170,35,48,32,20,8,
+11,100,12,4,74,254,184,68,48,64,38,16,252,243,45,55,28,9,86,86,9,28,55,45,
+3,13,16,38,64,48,68,1,72,255,255,0,8,254,20,4,133,4,74,18,2,0,92,0,0,0,3,
+0,113,254,18,5,76,6,20,0,42,0,53,0,64,0,0,1,50,62,2,53,53,46,3,53,16,0,37,
+53,52,46,2,35,35,53,33,17,30,3,21,16,0,5,21,20,30,2,51,51,21,33,53,3,20,30,
+2,23,17,14,3,5,52,46,2,39,17,62,3,1,223,35,61,45,27,126,198,138,72,1,14,1,
+8,27,46,61,34,26,1,114,125,198,137,73,254,242,254,249,27,45,62,34,27,253,
+203,136,35,78,126,91,91,126,78,35,3,66,35,78,125,90,91,125,78,34,254,104,
+10,31,59,48,244,9,79,142,204,133,1,10,1,23,18,217,45,55,30,9,86,254,70,10,
+80,140,201,132,254,245,254,230,18,244,48,59,31,10,86,86,3,191,103,162,116,
+69,11,3,148,11,68,114,159,103,102,160,114,68,11,252,108,11,69,116,162,255,
+255,0,10,0,0,4,150,4,74,18,2,0,91,0,0,0,1,0,47,254,82,5,61,4,74,0,56,0,0,
+1,35,39,46,3,35,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,
+21,17,33,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,30,2,23,51,5,61,100,
+10,5,38,56,66,34,252,60,6,34,61,46,27,27,46,61,34,27,2,70,27,34,61,46,27,
+2,8,27,46,61,34,26,2,69,26,34,61,46,27,23,40,53,31,47,254,82,149,78,108,66,
+29,86,9,30,55,45,2,137,45,55,29,9,86,86,9,29,55,45,252,244,3,12,45,55,29,
+9,86,86,9,29,55,45,253,123,42,52,29,11,1,0,1,0,31,0,0,4,240,4,74,0,67,0,0,
+33,53,51,50,62,2,53,17,14,3,35,34,46,2,53,53,52,46,2,35,35,53,33,21,35,34,
+14,2,21,21,20,22,51,50,62,2,55,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,
+20,30,2,51,51,21,2,170,27,34,61,46,27,49,90,92,98,59,68,106,72,38,27,46,61,
+34,6,2,28,6,34,61,46,27,83,81,39,73,74,82,48,27,46,61,34,7,2,50,27,34,61,
+46,27,27,46,61,34,27,86,9,28,55,45,1,35,31,50,36,20,37,68,97,60,233,45,55,
+30,10,86,86,9,29,55,45,215,71,76,10,22,34,24,1,14,45,55,30,10,86,86,9,29,
+55,45,253,117,45,55,28,9,86,0,1,0,47,0,0,7,98,4,74,0,67,0,0,51,53,51,50,62,
+2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,33,
+21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,30,2,
+51,51,21,47,27,34,61,46,27,27,46,61,34,27,2,37,6,34,61,46,27,1,201,27,46,
+61,34,6,2,16,6,34,61,46,27,1,201,27,46,61,34,7,2,37,26,34,61,46,27,27,46,
+61,34,26,86,9,30,55,45,2,137,45,55,29,9,86,86,9,29,55,45,252,244,3,12,45,
+55,29,9,86,86,9,29,55,45,252,244,3,12,45,55,29,9,86,86,9,29,55,45,253,119,
+45,55,30,9,86,0,1,0,47,254,82,7,98,4,74,0,74,0,0,1,39,46,3,35,33,53,51,50,
+62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,
+33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,20,30,
+2,23,51,17,6,254,10,6,38,55,66,34,250,2,27,34,61,46,27,27,46,61,34,27,2,37,
+6,34,61,46,27,1,201,27,46,61,34,6,2,16,6,34,61,46,27,1,201,27,46,61,34,7,
+2,37,26,34,61,46,27,24,41,53,29,47,254,82,149,78,108,66,29,86,9,30,55,45,
+2,137,45,55,29,9,86,86,9,29,55,45,252,244,3,12,45,55,29,9,86,86,9,29,55,45,
+252,244,3,12,45,55,29,9,86,86,9,29,55,45,253,105,36,45,25,10,1,253,244,0,
+2,0,61,0,0,5,49,4,74,0,37,0,48,0,0,1,21,35,34,14,2,21,17,51,50,30,2,21,20,
+14,2,35,33,53,51,50,62,2,53,17,35,34,14,2,7,7,35,19,1,50,62,2,53,52,38,35,
+35,17,3,104,26,34,61,46,27,178,95,171,130,77,52,105,159,108,253,154,26,34,
+61,46,27,170,35,48,32,20,8,10,101,13,3,24,69,97,61,29,139,129,176,4,74,86,
+10,30,55,45,254,250,22,64,116,95,67,115,84,47,86,9,28,55,45,3,13,16,38,64,
+48,68,1,72,252,20,25,55,88,62,104,88,254,90,0,3,0,47,0,0,6,88,4,74,0,35,0,
+46,0,78,0,0,1,21,35,34,14,2,21,17,51,50,30,2,21,20,14,2,35,33,53,51,50,62,
+2,53,17,52,46,2,35,35,53,1,50,62,2,53,52,38,35,35,17,1,21,35,34,14,2,21,17,
+20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,2,117,27,34,61,46,
+27,137,95,171,130,77,52,105,159,107,253,194,27,34,61,46,27,27,46,61,34,27,
+2,23,68,97,62,29,140,129,135,4,166,6,34,61,46,27,27,46,61,34,6,253,227,7,
+34,60,46,27,27,46,60,34,7,4,74,86,10,30,55,45,254,250,22,64,116,95,67,115,
+84,47,86,9,28,55,45,2,137,45,55,30,10,86,252,20,25,55,88,62,104,88,254,90,
+3,236,86,9,29,55,45,253,117,45,55,28,9,86,86,9,28,55,45,2,137,45,55,30,10,
+86,0,2,0,47,0,0,4,82,4,74,0,35,0,46,0,0,1,21,35,34,14,2,21,17,51,50,30,2,
+21,20,14,2,35,33,53,51,50,62,2,53,17,52,46,2,35,35,53,1,50,62,2,53,52,38,
+35,35,17,2,117,27,34,61,46,27,199,95,171,130,77,52,105,159,108,253,133,27,
+34,61,46,27,27,46,61,34,27,2,84,68,97,62,29,139,129,197,4,74,86,10,30,55,
+45,254,250,22,64,116,95,67,115,84,47,86,9,28,55,45,2,137,45,55,30,10,86,252,
+20,25,55,88,62,104,88,254,90,0,1,0,82,255,236,3,125,4,94,0,45,0,0,1,50,30,
+2,21,20,14,2,35,34,46,2,53,52,51,20,30,2,51,50,54,55,33,53,33,46,3,35,34,
+14,2,21,34,38,53,52,62,2,1,205,100,160,112,60,67,120,165,99,110,139,81,30,
+151,23,51,80,57,121,119,8,254,58,1,198,4,38,64,86,51,46,73,50,26,71,79,38,
+85,136,4,94,63,136,212,150,156,219,139,63,42,65,78,36,131,54,92,68,38,212,
+208,110,117,156,94,39,32,58,79,48,55,61,35,72,59,37,0,2,0,47,255,236,6,111,
+4,94,0,50,0,70,0,0,1,16,2,35,34,46,2,39,33,17,20,30,2,51,51,21,33,53,51,50,
+62,2,53,17,52,46,2,35,35,53,33,21,35,34,14,2,21,17,33,18,54,51,50,30,2,5,
+20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,6,111,235,226,103,165,117,66,4,254,
+215,27,46,61,34,6,253,207,27,34,61,46,27,27,46,61,34,27,2,49,6,34,61,46,27,
+1,41,13,233,215,106,169,117,63,253,51,28,61,99,72,71,99,61,27,28,62,99,71,
+72,98,61,27,2,39,254,223,254,230,66,133,201,136,254,219,45,55,28,9,86,86,
+9,28,55,45,2,137,45,55,30,10,86,86,9,29,55,45,254,248,1,1,251,69,141,213,
+144,114,174,117,60,60,117,174,114,114,172,115,58,58,115,172,0,2,0,16,0,0,
+4,88,4,74,0,12,0,62,0,0,1,34,14,2,21,20,30,2,51,51,17,1,14,3,35,53,51,50,
+62,2,55,19,46,3,53,52,62,2,51,33,21,35,34,14,2,21,17,20,30,2,51,51,21,33,
+53,51,50,62,2,53,17,35,2,14,63,86,53,23,24,53,86,62,199,254,172,22,51,80,
+122,94,7,27,45,39,37,19,181,47,96,77,49,49,101,156,108,2,64,7,34,60,46,27,
+27,46,60,34,27,253,186,27,34,61,46,27,170,3,236,34,57,74,40,44,79,59,35,1,
+166,252,186,42,62,41,21,86,14,29,47,33,1,55,9,43,71,99,65,68,108,75,40,86,
+10,30,55,45,253,119,45,55,28,9,86,86,9,28,55,45,1,4,255,255,0,113,255,236,
+3,225,5,244,18,34,0,72,0,0,16,2,0,106,218,0,0,1,0,35,254,20,4,55,6,20,0,71,
+0,0,51,53,51,50,62,2,53,17,35,53,51,53,52,46,2,35,35,53,33,21,33,21,33,21,
+20,6,7,6,7,51,54,51,50,30,2,21,17,20,14,2,35,35,53,51,50,62,2,53,17,52,46,
+2,35,34,14,2,21,17,20,30,2,51,51,21,37,16,35,61,45,27,186,186,27,46,61,34,
+16,1,121,1,94,254,162,2,2,2,2,10,92,209,87,135,92,48,56,100,140,83,30,12,
+49,76,53,27,24,53,86,62,64,93,61,30,27,46,61,34,6,86,10,31,58,48,3,213,97,
+20,45,55,30,9,86,245,97,149,28,61,26,30,29,186,47,97,152,105,253,76,138,183,
+109,46,97,37,87,145,108,2,172,67,104,72,37,47,87,123,75,254,121,45,55,28,
+9,86,255,255,0,47,0,0,3,129,6,33,18,34,1,205,0,0,16,2,0,118,218,0,0,1,0,113,
+255,236,3,160,4,94,0,46,0,0,5,34,46,2,53,52,62,2,51,50,30,2,21,20,6,35,52,
+46,2,35,34,14,2,7,33,21,33,30,3,51,50,54,55,22,22,21,20,14,2,2,68,102,172,
+124,69,69,123,167,97,64,127,102,64,92,91,16,39,67,52,55,91,66,40,4,1,199,
+254,55,4,39,75,114,78,95,142,35,15,20,44,87,130,20,63,136,213,151,164,221,
+134,56,25,52,79,53,71,58,48,86,65,37,39,93,156,118,110,98,146,96,47,80,63,
+12,40,28,35,70,56,35,255,255,0,92,255,236,3,66,4,92,18,2,0,86,0,0,255,255,
+0,47,0,0,2,117,6,20,18,2,0,76,0,0,255,255,0,32,0,0,2,118,5,244,18,34,0,243,
+0,0,16,3,0,106,254,253,0,0,255,255,255,231,254,20,1,170,6,20,18,2,0,77,0,
+0,0,2,0,0,255,242,6,102,4,74,0,67,0,78,0,0,1,52,46,2,35,35,53,33,21,35,34,
+14,2,21,17,51,50,30,2,21,20,14,2,35,33,53,51,50,62,2,53,17,35,14,3,7,14,3,
+35,34,38,53,52,54,51,20,30,2,51,50,62,2,55,62,3,1,50,62,2,53,52,38,35,35,
+17,1,215,27,46,61,34,27,3,179,27,34,61,46,27,137,95,171,130,77,52,105,159,
+108,253,195,27,34,61,46,27,248,10,26,30,35,20,28,58,71,89,57,82,82,48,42,
+12,25,38,25,29,51,50,49,26,12,26,23,15,2,193,68,97,62,29,140,129,135,3,117,
+41,49,28,9,86,86,10,30,55,45,254,250,22,64,116,95,67,115,84,47,86,9,28,55,
+45,3,13,94,187,176,161,69,93,127,78,33,75,68,53,72,14,33,29,20,17,60,114,
+97,42,119,124,115,253,16,25,55,88,62,104,88,254,90,0,2,0,47,0,0,6,213,4,74,
+0,71,0,82,0,0,1,21,35,34,14,2,21,17,51,50,30,2,21,20,14,2,35,33,53,51,50,
+62,2,53,17,33,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,
+33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,1,50,62,2,53,52,38,35,35,17,
+5,53,26,34,61,46,27,137,95,171,130,77,52,105,159,108,253,215,6,34,61,46,27,
+254,0,27,46,61,34,6,253,207,27,34,61,46,27,27,46,61,34,27,2,49,6,34,61,46,
+27,2,0,27,46,61,34,6,2,2,68,97,62,29,139,129,135,4,74,86,10,30,55,45,254,
+250,22,64,116,95,67,115,84,47,86,9,28,55,45,1,37,254,219,45,55,28,9,86,86,
+9,28,55,45,2,137,45,55,30,10,86,86,9,29,55,45,254,248,1,6,45,55,30,10,86,
+252,20,25,55,88,62,104,88,254,90,255,255,0,35,0,0,4,219,6,20,18,2,0,233,0,
+0,255,255,0,37,0,0,4,215,6,33,18,34,1,212,0,0,16,3,0,118,0,152,0,0,255,255,
+0,8,254,20,4,133,5,238,18,34,0,92,0,0,16,2,2,52,255,0,0,1,0,47,254,82,5,61,
+4,74,0,61,0,0,33,33,34,14,2,21,35,52,46,2,35,33,53,51,50,62,2,53,17,52,46,
+2,35,35,53,33,21,35,34,14,2,21,17,33,17,52,46,2,35,35,53,33,21,35,34,14,2,
+21,17,20,30,2,51,51,5,61,254,80,55,66,36,11,94,17,43,73,55,254,100,27,34,
+61,46,27,27,46,61,34,27,2,70,27,34,61,46,27,2,8,27,46,61,34,26,2,69,26,34,
+61,46,27,27,46,61,34,26,49,105,162,114,114,162,105,49,86,9,30,55,45,2,137,
+45,55,29,9,86,86,9,29,55,45,252,244,3,12,45,55,29,9,86,86,9,29,55,45,253,
+117,45,55,28,9,0,1,0,78,0,0,4,37,6,182,0,33,0,0,1,33,17,20,30,2,51,51,21,
+33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,50,62,2,55,55,51,4,25,253,198,
+27,46,61,34,68,253,131,26,35,61,46,26,26,46,61,35,26,2,151,60,75,44,21,5,
+8,107,5,80,251,145,45,55,30,9,86,86,10,31,58,48,3,228,48,58,31,10,86,25,48,
+69,43,71,0,1,0,47,0,0,3,88,5,51,0,33,0,0,1,17,20,30,2,51,51,21,33,53,51,50,
+62,2,53,17,52,46,2,35,35,53,33,50,62,2,55,55,51,17,1,178,27,46,61,34,47,253,
+166,27,34,61,46,27,27,46,61,34,27,2,43,35,48,32,21,7,11,100,3,236,252,243,
+45,55,28,9,86,86,9,28,55,45,2,135,45,55,30,10,88,16,38,64,48,67,254,185,255,
+255,0,18,0,0,8,78,7,115,18,34,0,58,0,0,16,3,0,67,1,186,1,82,255,255,0,2,0,
+0,6,227,6,33,18,34,0,90,0,0,16,3,0,67,0,178,0,0,255,255,0,18,0,0,8,78,7,115,
+18,34,0,58,0,0,16,3,0,118,2,170,1,82,255,255,0,2,0,0,6,227,6,33,18,34,0,90,
+0,0,16,3,0,118,1,147,0,0,255,255,0,18,0,0,8,78,7,70,18,34,0,58,0,0,16,3,0,
+106,2,47,1,82,255,255,0,2,0,0,6,227,5,244,18,34,0,90,0,0,16,3,0,106,1,47,
+0,0,255,255,255,246,0,0,5,6,7,115,18,34,0,60,0,0,16,3,0,67,255,210,1,82,255,
+255,0,8,254,20,4,133,6,33,18,34,0,92,0,0,16,2,0,67,153,0,0,1,255,246,1,233,
+4,10,2,98,0,3,0,0,1,33,53,33,4,10,251,236,4,20,1,233,121,0,1,255,246,1,233,
+8,10,2,98,0,3,0,0,1,33,53,33,8,10,247,236,8,20,1,233,121,0,1,255,246,1,233,
+8,10,2,98,0,3,0,0,1,33,53,33,8,10,247,236,8,20,1,233,121,0,2,255,246,254,
+100,3,84,255,207,0,3,0,7,0,0,5,33,53,33,17,33,53,33,3,84,252,162,3,94,252,
+162,3,94,170,121,254,149,121,0,1,0,115,3,117,1,195,5,184,0,23,0,0,19,52,62,
+2,55,21,6,6,21,20,30,4,21,20,6,35,34,46,2,115,36,81,128,91,101,94,22,34,38,
+34,22,77,57,31,57,44,25,4,39,65,122,104,83,27,86,32,92,60,20,27,21,20,28,
+41,31,59,62,23,45,67,0,1,0,61,3,115,1,141,5,182,0,23,0,0,1,20,14,2,7,53,54,
+54,53,52,46,4,53,52,54,51,50,30,2,1,141,36,81,127,92,101,94,22,34,38,34,22,
+77,57,32,56,44,25,5,4,65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,
+62,23,45,67,0,1,0,61,254,197,1,141,1,8,0,23,0,0,37,20,14,2,7,53,54,54,53,
+52,46,4,53,52,54,51,50,30,2,1,141,36,81,127,92,101,94,22,34,38,34,22,77,57,
+32,56,44,25,86,65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,62,23,
+45,67,0,1,0,115,3,115,1,195,5,182,0,23,0,0,19,52,62,2,51,50,22,21,20,14,4,
+21,20,22,23,21,46,3,115,25,44,57,31,57,77,22,34,38,34,22,94,101,91,128,81,
+36,5,4,43,67,45,23,62,59,31,41,28,20,21,27,20,60,92,32,86,27,83,104,122,0,
+2,0,115,3,117,3,92,5,184,0,23,0,47,0,0,1,52,62,2,55,21,6,6,21,20,30,4,21,
+20,6,35,34,46,2,37,52,62,2,55,21,6,6,21,20,30,4,21,20,6,35,34,46,2,2,12,36,
+81,128,91,100,94,22,33,39,33,22,76,57,31,58,43,26,254,103,36,81,128,91,101,
+94,22,34,38,34,22,77,57,31,57,44,25,4,39,65,122,104,83,27,86,32,92,60,20,
+27,21,20,28,41,31,59,62,23,45,67,43,65,122,104,83,27,86,32,92,60,20,27,21,
+20,28,41,31,59,62,23,45,67,0,2,0,61,3,115,3,39,5,182,0,23,0,47,0,0,1,20,14,
+2,7,53,54,54,53,52,46,4,53,52,54,51,50,30,2,5,20,14,2,7,53,54,54,53,52,46,
+4,53,52,54,51,50,30,2,1,141,36,81,127,92,101,94,22,34,38,34,22,77,57,32,56,
+44,25,1,154,36,81,127,92,100,95,22,34,38,34,22,76,57,32,57,43,26,5,4,65,122,
+104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,62,23,45,67,43,65,122,104,83,
+27,86,32,92,60,20,27,21,20,28,41,31,59,62,23,45,67,0,2,0,61,254,197,3,39,
+1,8,0,23,0,47,0,0,37,20,14,2,7,53,54,54,53,52,46,4,53,52,54,51,50,30,2,5,
+20,14,2,7,53,54,54,53,52,46,4,53,52,54,51,50,30,2,1,141,36,81,127,92,101,
+94,22,34,38,34,22,77,57,32,56,44,25,1,154,36,81,127,92,100,95,22,34,38,34,
+22,76,57,32,57,43,26,86,65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,
+59,62,23,45,67,43,65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,62,
+23,45,67,0,1,0,72,255,29,3,78,6,20,0,21,0,0,1,6,7,6,2,21,35,52,2,39,38,39,
+55,5,53,5,3,51,3,37,21,37,2,68,21,18,15,24,86,23,14,17,20,74,254,168,1,88,
+54,197,57,1,88,254,168,3,4,126,157,134,254,148,218,216,1,108,134,157,128,
+232,58,176,53,1,231,254,25,53,176,58,0,1,0,72,255,29,3,78,6,20,0,41,0,0,37,
+37,21,37,19,35,19,5,53,5,39,54,55,54,54,55,38,38,39,38,39,55,5,53,5,3,51,
+3,37,21,37,23,6,7,6,6,7,22,22,23,22,23,1,246,1,88,254,168,57,197,54,254,168,
+1,88,74,19,18,15,28,8,8,28,15,18,19,74,254,168,1,88,54,197,57,1,88,254,168,
+78,20,18,15,31,9,9,31,15,18,20,223,58,177,54,254,127,1,129,54,177,58,232,
+14,28,24,83,66,67,80,22,26,9,232,57,176,54,1,129,254,127,54,176,57,232,12,
+26,23,79,66,69,83,23,26,12,0,1,0,100,1,176,2,129,4,2,0,19,0,0,19,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,100,41,72,100,58,56,98,74,42,42,74,98,56,
+58,100,72,41,2,217,84,114,69,30,30,69,114,84,84,113,70,30,30,70,113,0,3,0,
+164,255,242,6,57,1,8,0,19,0,39,0,59,0,0,55,52,62,2,51,50,30,2,21,20,14,2,
+35,34,46,2,37,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,37,52,62,2,51,50,30,
+2,21,20,14,2,35,34,46,2,164,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,
+20,2,74,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,2,73,20,35,47,27,
+26,47,35,21,21,35,47,26,27,47,35,20,125,40,53,32,14,14,32,53,40,39,54,32,
+14,14,32,54,39,40,53,32,14,14,32,53,40,39,54,32,14,14,32,54,39,40,53,32,14,
+14,32,53,40,39,54,32,14,14,32,54,0,7,0,92,255,236,9,248,5,203,0,19,0,39,0,
+59,0,79,0,83,0,103,0,123,0,0,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,
+20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,20,14,2,35,34,46,2,53,52,62,2,
+51,50,30,2,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,35,1,51,1,20,14,2,
+35,34,46,2,53,52,62,2,51,50,30,2,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,
+2,2,252,42,84,126,84,88,127,82,39,39,82,128,89,84,125,83,42,254,24,16,36,
+58,42,42,58,35,15,15,35,56,42,42,59,37,16,5,187,42,84,126,84,88,128,81,39,
+39,82,128,89,84,125,83,42,254,24,16,36,58,42,42,58,34,15,15,34,56,42,42,59,
+37,16,253,129,135,2,219,134,4,182,42,84,126,84,88,128,81,39,39,82,128,89,
+84,125,83,42,254,24,16,36,58,42,42,58,34,15,15,34,56,42,42,59,37,16,4,6,103,
+168,120,66,66,120,168,103,103,167,119,64,64,119,167,103,88,139,96,50,50,96,
+139,88,87,136,95,49,49,95,136,253,87,103,168,120,65,65,120,168,103,103,167,
+119,64,64,119,167,103,88,139,96,50,50,96,139,88,87,136,95,49,49,95,136,253,
+245,5,182,251,254,103,168,120,65,65,120,168,103,103,167,119,64,64,119,167,
+103,88,139,96,50,50,96,139,88,87,136,95,49,49,95,136,0,1,0,133,0,164,2,37,
+3,174,0,6,0,0,19,1,51,3,19,35,1,133,1,57,103,207,207,103,254,199,2,74,1,100,
+254,123,254,123,1,100,0,1,0,135,0,164,2,39,3,174,0,6,0,0,1,1,35,19,3,51,1,
+2,39,254,199,103,207,207,103,1,57,2,8,254,156,1,133,1,133,254,156,255,255,
+0,211,255,242,3,166,5,182,16,34,0,4,0,0,16,3,0,4,1,209,0,0,0,1,254,143,0,
+0,1,240,5,182,0,3,0,0,35,35,1,51,233,136,2,219,134,5,182,0,1,0,20,3,23,3,
+59,5,195,0,52,0,0,1,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,51,23,51,62,
+3,51,50,22,21,17,20,30,2,51,51,21,33,17,52,38,35,34,14,2,21,21,20,30,2,51,
+1,150,254,126,11,21,36,27,16,16,28,36,20,4,254,16,6,21,45,51,57,31,104,115,
+14,26,34,20,6,254,242,53,68,38,52,31,14,16,28,37,21,3,92,69,69,6,18,33,27,
+1,115,24,31,17,6,69,100,35,43,26,9,113,123,254,221,28,35,19,6,69,1,165,78,
+84,30,51,66,37,252,25,31,17,5,0,1,0,90,0,0,4,47,5,182,0,45,0,0,51,53,51,50,
+62,2,53,53,35,53,51,17,52,46,2,35,35,53,33,19,35,39,46,3,35,33,17,33,21,33,
+21,33,21,33,21,20,30,2,51,51,21,90,27,34,61,46,27,189,189,27,46,61,34,27,
+3,203,10,106,11,4,23,45,68,48,254,217,1,217,254,39,1,39,254,217,27,45,62,
+34,68,86,9,28,55,45,150,96,3,0,45,55,30,9,86,254,154,88,35,61,45,27,253,176,
+100,199,96,140,48,58,31,10,86,0,1,0,100,255,236,4,61,5,203,0,89,0,0,1,22,
+22,23,33,21,33,21,20,6,7,23,54,54,51,50,30,2,51,50,62,2,55,21,14,3,35,34,
+46,2,35,34,6,7,7,53,55,62,3,53,53,33,53,33,38,38,39,35,53,51,46,3,53,52,62,
+2,51,50,30,2,21,20,6,35,52,46,2,35,34,6,21,20,30,2,23,33,21,1,244,9,17,6,
+1,31,254,234,99,82,5,42,73,34,41,98,97,88,32,36,61,54,45,19,18,50,66,83,51,
+51,98,100,103,55,68,118,66,27,37,37,76,60,38,254,233,1,11,7,20,12,228,189,
+14,28,22,14,58,108,155,97,99,138,86,39,87,75,17,45,82,64,119,111,16,24,28,
+12,1,92,2,207,31,74,39,96,8,88,135,55,9,20,17,24,30,24,21,34,43,23,133,26,
+53,44,28,29,34,29,39,31,12,108,23,23,65,85,103,62,20,96,39,74,31,96,32,69,
+74,80,42,88,138,95,50,35,62,84,49,66,67,48,93,73,46,136,128,48,84,74,66,29,
+96,0,3,0,55,255,236,6,61,5,182,0,35,0,48,0,78,0,0,51,53,51,50,62,2,53,17,
+52,46,2,35,35,53,33,50,30,2,21,20,14,2,35,35,17,20,30,2,51,51,21,3,51,50,
+62,2,53,52,46,2,35,35,1,50,54,55,21,6,6,35,34,46,2,53,17,35,53,50,54,55,54,
+54,55,51,21,51,21,35,17,20,22,55,27,35,61,45,27,27,46,61,34,27,2,2,129,190,
+124,61,57,130,210,152,67,27,46,61,34,67,235,47,93,132,84,39,34,76,120,87,
+78,4,6,37,47,26,26,79,60,69,96,60,27,156,37,89,34,35,43,16,74,227,227,64,
+86,10,31,58,48,3,236,45,55,30,9,86,59,111,158,100,91,168,129,77,254,166,45,
+55,28,9,86,2,154,39,87,137,97,86,127,84,41,251,4,8,6,90,14,18,33,74,122,88,
+1,96,72,30,35,38,105,79,252,107,254,154,105,98,0,1,0,84,255,236,4,61,5,199,
+0,65,0,0,37,50,62,2,55,22,22,21,20,14,2,35,34,46,2,39,35,53,51,38,38,53,53,
+35,53,51,62,3,51,50,30,2,21,20,6,35,52,46,2,35,34,14,2,7,33,21,33,21,20,20,
+23,33,21,33,30,3,3,8,52,81,62,47,18,13,24,37,76,116,80,96,176,142,98,19,149,
+141,2,2,137,145,14,91,137,173,95,78,127,91,50,91,87,20,44,71,51,53,98,79,
+55,10,1,174,254,78,2,1,94,254,170,13,59,88,115,100,20,34,45,24,8,30,31,27,
+61,52,34,61,135,216,155,96,23,54,21,45,97,171,229,138,58,31,55,76,45,71,58,
+48,86,64,37,46,114,191,144,97,49,21,54,19,96,109,167,113,58,0,4,0,82,255,
+236,5,186,5,195,0,3,0,15,0,31,0,75,0,0,33,35,1,51,3,20,22,51,50,54,53,52,
+38,35,34,6,5,20,6,35,34,46,2,53,52,54,51,50,30,2,1,34,46,2,53,52,62,2,51,
+50,30,2,21,20,14,2,35,52,46,2,35,34,14,2,21,20,22,51,50,54,55,22,22,21,20,
+14,2,1,211,135,2,219,133,221,70,88,86,71,73,87,86,69,1,235,171,165,79,123,
+86,45,169,169,77,122,86,46,251,234,74,124,90,50,50,88,121,71,46,93,74,47,
+22,43,64,43,8,22,38,29,32,52,37,20,89,91,76,98,25,12,19,31,63,95,5,182,251,
+146,133,134,134,133,131,129,129,131,175,173,43,87,130,88,176,170,43,86,130,
+1,109,42,85,131,90,99,134,80,34,18,33,49,32,21,43,35,21,29,60,50,31,20,58,
+102,83,131,118,51,37,8,29,25,25,46,35,21,0,2,0,92,255,233,3,137,5,221,0,41,
+0,57,0,0,37,50,62,2,55,51,14,3,35,34,46,2,53,53,6,6,7,53,54,54,55,17,52,54,
+51,50,22,21,20,14,2,7,17,20,30,2,19,52,46,2,35,34,14,2,21,17,62,3,2,131,35,
+59,46,33,9,80,12,47,73,101,68,70,111,78,42,51,106,54,57,105,49,136,151,124,
+134,55,97,133,78,19,39,60,140,19,34,50,32,38,48,27,10,62,96,66,34,86,25,56,
+89,63,84,127,87,44,44,88,130,85,192,18,31,14,90,15,33,17,2,51,158,172,173,
+159,109,175,139,107,41,254,244,53,90,65,36,4,61,53,87,61,33,36,64,87,51,254,
+45,33,86,114,145,0,4,0,57,0,0,7,217,5,182,0,44,0,56,0,70,0,74,0,0,33,1,17,
+20,30,2,51,51,21,33,53,51,50,62,2,53,17,52,46,2,35,35,53,33,1,17,52,46,2,
+35,35,53,33,21,35,34,14,2,21,17,1,20,22,51,50,54,53,52,38,35,34,6,5,20,6,
+35,34,38,53,52,54,51,50,30,2,1,53,33,21,4,27,253,82,26,46,61,34,27,254,10,
+27,35,61,45,27,27,46,61,34,27,1,107,2,139,27,46,61,34,26,1,245,26,34,62,45,
+27,1,78,70,87,86,72,73,87,86,69,1,235,171,165,158,176,170,168,77,123,86,46,
+253,168,2,21,4,156,252,77,48,58,31,10,86,86,10,31,58,48,3,236,45,55,30,9,
+86,251,148,3,139,45,55,30,9,86,86,10,31,58,48,251,51,2,109,133,134,134,133,
+131,129,129,131,177,172,174,175,176,170,43,86,130,253,60,154,154,0,2,0,55,
+2,242,6,88,5,182,0,46,0,80,0,0,1,53,50,54,55,17,3,35,3,17,20,22,51,21,35,
+53,51,50,54,55,17,46,3,35,35,53,51,19,19,51,21,35,34,14,2,21,17,20,30,2,51,
+51,21,37,20,30,2,51,51,21,33,53,51,50,62,2,53,17,35,14,3,7,7,35,55,33,23,
+35,39,38,38,39,35,5,41,35,42,3,232,71,232,42,40,248,21,31,47,2,1,13,22,29,
+15,21,236,225,232,231,22,17,29,21,11,11,21,29,17,22,251,78,13,21,29,15,32,
+254,164,35,15,28,21,12,90,22,30,18,10,2,8,60,6,2,86,7,60,8,4,34,44,94,2,242,
+55,20,35,1,201,253,201,2,57,254,61,41,22,55,55,20,37,1,226,19,23,12,3,57,
+253,201,2,55,57,4,12,25,21,254,41,21,24,14,4,55,118,21,24,14,4,55,55,4,12,
+23,18,2,19,1,11,20,25,15,49,186,186,49,29,42,1,255,255,0,86,0,0,5,176,5,205,
+18,2,1,118,0,0,0,2,0,102,255,221,4,139,4,72,0,34,0,47,0,0,5,34,46,2,53,52,
+62,4,51,50,30,2,21,33,17,30,3,51,50,62,2,55,23,14,3,19,17,46,3,35,34,14,2,
+7,17,2,121,130,198,134,69,44,76,102,118,128,63,113,194,142,81,252,197,22,
+64,77,88,46,74,116,94,77,34,72,36,83,110,143,204,19,59,77,93,53,51,87,73,
+60,24,35,94,157,204,110,99,160,126,92,60,29,79,147,209,131,254,156,24,44,
+34,21,32,60,87,55,41,57,101,77,44,2,139,1,21,20,42,35,22,19,33,42,23,254,
+233,255,255,0,36,255,240,6,69,5,193,16,34,0,123,206,0,16,35,2,21,3,4,0,0,
+16,3,2,60,3,94,253,179,255,255,0,94,255,240,6,71,5,203,16,34,0,117,12,0,16,
+35,2,21,3,10,0,0,16,3,2,60,3,96,253,179,255,255,0,94,255,240,6,71,5,182,16,
+34,2,58,6,0,16,35,2,21,3,16,0,0,16,3,2,60,3,96,253,179,255,255,0,118,255,
+240,6,71,5,182,16,34,2,59,16,0,16,35,2,21,2,184,0,0,16,3,2,60,3,96,253,179,
+0,2,0,70,255,236,3,166,5,203,0,51,0,71,0,0,1,34,14,2,21,34,38,53,52,62,2,
+51,50,30,2,21,20,6,7,14,3,35,34,46,2,53,52,62,4,51,50,22,23,51,54,54,52,52,
+53,52,46,2,3,50,62,2,55,46,3,35,34,14,4,21,20,22,2,43,54,76,50,23,68,73,39,
+75,111,72,103,159,108,56,21,22,30,93,126,156,93,90,124,76,33,24,50,79,110,
+144,90,85,129,40,8,1,1,38,71,102,163,65,115,90,62,12,8,37,53,67,38,57,92,
+72,52,35,16,91,5,90,32,54,70,38,51,57,43,73,53,30,78,143,203,125,105,205,
+96,128,204,141,75,60,101,132,71,56,133,134,125,96,58,70,71,8,25,27,27,9,101,
+171,126,71,251,0,92,154,199,108,42,74,54,31,51,85,109,117,116,49,104,123,
+0,2,0,63,0,0,4,158,5,182,0,5,0,14,0,0,33,33,53,1,51,1,39,1,38,38,39,6,6,7,
+1,4,158,251,161,1,224,178,1,205,228,254,248,31,54,17,16,44,34,254,223,109,
+5,73,250,197,14,3,35,91,169,74,73,148,95,252,203,0,1,0,78,254,20,6,10,5,182,
+0,49,0,0,1,21,35,34,14,2,21,17,30,3,51,51,21,33,53,51,50,62,2,53,17,33,17,
+20,30,2,51,51,21,33,53,51,50,62,2,53,17,46,3,35,35,53,6,10,26,35,61,46,26,
+2,27,45,60,34,26,253,172,27,35,61,45,27,253,102,27,45,62,34,27,253,172,26,
+35,61,46,26,1,28,45,60,34,26,5,182,86,10,31,58,48,250,39,45,55,29,9,86,86,
+10,31,59,48,6,82,249,174,48,59,31,10,86,86,10,31,59,48,5,215,45,55,30,9,86,
+0,1,0,80,254,20,5,49,5,182,0,26,0,0,1,50,62,2,55,55,51,3,33,53,1,1,53,33,
+19,35,39,46,3,35,33,1,21,1,3,254,48,68,45,26,5,9,106,10,251,41,2,57,253,244,
+4,80,10,106,11,4,22,43,65,46,253,199,1,190,253,230,254,209,29,52,71,42,62,
+254,67,99,3,92,3,147,80,254,154,88,34,60,45,27,252,254,74,252,207,0,1,0,133,
+2,160,3,244,3,25,0,3,0,0,1,33,53,33,3,244,252,145,3,111,2,160,121,0,1,0,66,
+255,242,4,139,6,141,0,8,0,0,5,35,1,35,53,33,19,1,51,2,135,123,254,221,167,
+1,28,250,1,197,110,14,3,49,100,253,58,5,204,0,3,0,72,0,201,5,96,3,221,0,33,
+0,49,0,65,0,0,1,20,14,2,35,34,38,39,6,6,35,34,46,2,53,52,62,2,51,50,30,2,
+23,54,54,51,50,30,2,37,34,6,7,22,22,51,50,62,2,53,52,46,2,1,50,54,55,38,38,
+35,34,14,2,21,20,30,2,5,96,46,83,117,71,95,179,74,63,164,91,70,118,86,47,
+46,84,118,73,47,93,89,81,34,63,158,103,70,116,83,46,254,195,77,123,62,57,
+123,84,47,75,53,28,29,54,76,253,52,74,128,60,55,127,84,45,74,52,28,25,50,
+77,2,80,80,142,107,62,117,133,121,123,55,101,145,90,82,143,105,61,27,59,92,
+66,119,119,56,102,144,179,133,135,134,134,42,73,99,56,56,97,72,41,253,238,
+132,136,133,135,42,74,98,56,54,96,73,43,0,1,0,41,254,20,4,27,6,31,0,62,0,
+0,1,34,38,53,52,54,51,20,30,2,51,50,54,53,52,46,2,53,52,62,4,55,62,3,51,50,
+22,21,20,6,35,52,46,2,35,34,17,20,22,20,22,20,22,21,20,14,4,7,14,3,1,14,121,
+108,75,74,5,21,44,39,72,75,1,2,1,1,3,2,3,3,1,6,52,90,126,80,122,120,76,74,
+4,21,44,39,148,1,2,1,1,2,3,2,3,1,6,56,95,130,254,20,76,68,56,59,31,59,46,
+28,149,150,57,140,156,167,84,51,120,124,122,107,85,26,94,156,113,63,76,68,
+55,59,31,59,46,28,254,213,40,110,124,127,114,92,26,42,112,122,124,107,81,
+19,93,157,113,63,0,2,0,111,1,123,4,10,4,37,0,35,0,71,0,0,1,46,3,35,34,14,
+2,7,53,54,51,50,30,2,23,30,3,51,50,62,2,55,21,6,35,34,46,2,3,46,3,35,34,14,
+2,7,53,54,51,50,30,2,23,30,3,51,50,62,2,55,21,6,35,34,46,2,2,27,37,56,45,
+41,22,29,59,59,56,24,99,148,29,50,55,67,47,37,56,46,41,21,28,60,59,56,24,
+99,149,29,49,55,67,47,37,56,45,41,22,29,59,59,56,24,98,149,29,50,55,67,47,
+37,56,46,41,21,28,60,59,56,24,98,150,29,49,55,67,1,188,16,22,13,5,19,33,44,
+25,162,108,5,13,25,20,16,22,13,5,19,33,44,25,162,108,5,13,25,1,174,16,21,
+13,5,19,32,45,25,162,109,5,14,25,20,16,21,13,5,19,32,44,26,162,108,5,13,25,
+0,1,0,133,0,250,3,244,4,188,0,19,0,0,1,55,51,7,33,21,33,3,33,21,33,7,35,55,
+33,53,33,19,33,53,2,68,57,119,58,1,58,254,168,74,1,162,254,63,55,121,57,254,
+201,1,86,74,254,96,3,225,219,219,121,254,230,121,219,219,121,1,26,121,0,2,
+0,133,0,0,3,244,4,217,0,6,0,10,0,0,19,53,1,21,1,1,21,21,33,53,33,133,3,111,
+253,80,2,176,252,145,3,111,2,184,72,1,217,137,254,139,254,143,137,225,121,
+0,2,0,133,0,0,3,244,4,217,0,6,0,10,0,0,55,53,1,1,53,1,21,17,33,53,33,133,
+2,176,253,80,3,111,252,145,3,111,225,137,1,113,1,117,137,254,39,72,253,72,
+121,0,2,0,61,0,0,4,37,5,182,0,5,0,9,0,0,33,35,1,1,51,9,4,2,90,82,254,53,1,
+203,82,1,203,254,14,254,158,1,98,1,94,2,217,2,221,253,37,2,66,253,190,253,
+184,2,72,0,1,0,55,0,0,5,51,6,51,0,63,0,0,37,50,62,2,53,17,33,17,20,30,2,51,
+51,21,33,53,51,50,62,2,53,17,35,53,51,53,52,62,2,51,50,22,21,20,14,2,35,52,
+46,2,35,34,14,2,21,21,33,17,20,30,2,51,51,21,33,53,3,8,34,61,46,27,254,10,
+27,45,62,34,37,253,176,27,35,61,45,27,187,187,58,121,184,126,191,192,27,49,
+68,42,22,52,89,68,79,102,59,23,2,183,26,46,61,35,26,253,207,86,9,28,55,45,
+3,10,253,0,48,58,31,10,86,86,10,31,58,48,3,0,97,61,95,157,113,63,93,77,30,
+50,35,20,31,73,64,43,57,93,121,65,59,252,159,48,58,31,10,86,86,0,1,0,55,0,
+0,5,49,6,41,0,62,0,0,37,50,62,2,53,17,52,46,2,35,34,14,2,21,21,33,21,33,17,
+20,30,2,51,51,21,33,53,51,50,62,2,53,17,35,53,51,53,52,62,2,51,50,30,2,23,
+51,17,20,30,2,51,51,21,33,53,3,6,35,61,45,27,27,57,90,63,79,102,59,23,1,58,
+254,198,27,45,62,34,37,253,176,27,35,61,45,27,187,187,58,121,184,126,25,56,
+53,45,12,205,26,46,61,35,26,253,207,86,10,31,58,48,4,17,43,76,57,33,53,90,
+118,65,59,97,253,0,48,58,31,10,86,86,10,31,58,48,3,0,97,61,95,154,109,60,
+5,6,7,3,250,213,48,58,31,10,86,86,0,1,0,207,4,217,3,205,5,238,0,21,0,0,1,
+14,3,35,34,46,2,39,51,30,3,51,50,62,2,55,3,205,6,49,93,141,100,103,140,88,
+41,5,170,5,27,50,76,53,44,73,54,34,6,5,238,62,102,73,40,38,72,103,64,57,73,
+41,16,19,43,72,53,0,1,255,231,254,20,1,158,4,74,0,22,0,0,1,17,20,14,2,35,
+35,53,51,50,62,2,53,17,52,46,2,35,35,53,1,158,60,108,149,89,33,15,55,86,59,
+31,27,46,61,34,6,4,74,251,166,138,183,109,46,97,37,87,145,108,3,122,45,55,
+30,10,86,0,1,1,145,4,205,2,129,6,20,0,11,0,0,1,54,54,55,51,21,14,3,7,35,1,
+145,17,32,13,178,14,40,47,48,21,70,4,231,69,158,74,20,32,80,83,80,32,0,1,
+1,123,254,59,2,127,255,131,0,11,0,0,1,54,54,55,51,21,14,3,7,35,1,123,17,32,
+12,199,14,40,47,48,21,90,254,86,68,159,74,20,32,80,84,80,32,0,1,1,115,4,217,
+2,119,6,33,0,11,0,0,1,6,6,7,35,53,62,3,55,51,2,119,17,32,13,198,14,40,46,
+48,22,90,6,6,68,159,74,21,32,80,83,80,32,0,2,0,33,2,76,3,8,5,193,0,24,0,33,
+0,0,1,21,20,30,2,51,51,21,33,53,51,50,62,2,53,53,33,53,1,51,17,51,21,1,52,
+54,55,6,6,7,3,51,2,68,14,24,31,17,41,254,61,57,17,30,23,14,254,148,1,127,
+164,196,254,133,6,5,8,18,5,223,243,3,80,113,26,31,16,5,69,69,5,16,31,26,113,
+61,2,52,253,231,88,1,63,32,82,38,17,34,8,254,188,0,1,0,88,2,61,2,221,5,182,
+0,49,0,0,1,50,62,2,53,52,38,35,34,6,7,39,19,33,23,35,39,46,3,35,33,7,54,54,
+51,50,22,21,20,14,2,35,34,46,2,53,52,62,2,51,20,30,2,1,125,38,62,43,23,97,
+90,65,84,29,59,37,1,252,6,70,8,3,8,16,28,23,254,232,23,26,91,65,161,175,46,
+90,133,87,84,111,66,28,13,29,46,33,24,45,64,2,152,21,47,76,54,84,86,24,13,
+15,1,196,217,37,13,19,13,6,246,10,19,129,131,64,104,74,41,27,45,57,29,19,
+37,29,18,35,62,46,27,0,1,0,102,2,76,2,209,5,182,0,11,0,0,1,1,33,34,6,7,7,
+35,55,33,21,1,1,8,1,82,254,162,34,31,3,8,74,7,2,100,254,188,2,76,2,233,28,
+31,66,254,98,252,248,0,3,0,82,2,61,2,231,5,203,0,39,0,53,0,69,0,0,19,52,62,
+2,55,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,30,3,21,20,14,2,35,34,46,2,5,
+50,54,53,52,38,39,6,6,21,20,30,2,19,52,46,2,35,34,6,21,20,30,2,23,54,54,82,
+31,55,75,44,35,65,49,29,33,74,119,85,66,106,75,40,28,48,65,36,50,79,55,29,
+42,84,127,84,81,121,81,41,1,82,69,82,102,100,47,62,20,41,60,160,16,32,49,
+32,62,63,27,45,57,30,44,51,3,45,42,63,50,38,16,18,46,59,73,44,40,79,63,39,
+28,54,77,48,37,62,51,40,15,23,47,59,73,48,52,91,67,38,38,65,87,110,73,65,
+65,89,38,26,92,60,31,55,42,24,2,107,24,47,37,23,70,51,34,53,41,30,12,23,77,
+0,22,0,84,254,129,7,193,5,238,0,5,0,11,0,17,0,23,0,27,0,31,0,35,0,39,0,43,
+0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,91,0,107,0,132,0,141,0,150,0,176,0,0,
+19,17,33,21,35,21,37,53,33,17,35,53,1,17,51,21,51,21,33,53,51,53,51,17,33,
+53,33,21,33,53,33,21,1,53,33,21,1,35,17,51,17,35,17,51,1,53,33,21,1,35,17,
+51,1,53,33,21,51,53,33,21,1,35,17,51,53,35,17,51,1,35,17,51,5,20,14,2,35,
+34,46,2,53,52,62,2,51,50,30,2,5,20,22,51,50,54,53,52,46,2,35,34,14,2,37,20,
+6,7,21,22,22,21,20,35,33,53,51,50,54,53,17,52,38,35,35,53,51,50,22,1,51,50,
+54,53,52,38,35,35,39,51,50,54,53,52,38,35,35,37,35,34,6,21,17,20,14,2,35,
+35,53,51,50,62,2,53,17,52,38,35,35,53,33,84,1,47,192,5,206,1,48,109,249,0,
+111,192,5,14,195,109,253,73,1,17,251,225,1,14,254,242,1,14,4,183,109,109,
+109,109,251,194,1,16,252,48,111,111,2,192,1,16,119,1,17,250,168,111,111,111,
+111,6,254,109,109,251,157,36,70,103,67,70,105,69,35,35,69,105,70,67,103,70,
+36,254,96,63,77,76,63,15,33,53,38,39,53,33,15,3,170,58,46,57,72,235,254,247,
+35,17,26,26,17,35,240,118,117,254,244,53,56,45,42,57,55,8,31,56,42,45,55,
+29,2,141,35,17,23,37,61,80,42,28,14,20,37,28,17,24,17,34,1,26,4,190,1,48,
+111,193,193,111,254,208,193,249,2,1,47,194,109,109,194,254,209,109,109,109,
+109,6,254,111,111,250,168,1,14,2,2,1,15,250,59,109,109,1,166,1,14,4,74,111,
+111,111,111,252,47,1,16,121,1,15,253,104,1,16,71,68,110,80,43,43,80,110,68,
+68,111,79,43,43,79,111,68,117,131,131,117,58,92,64,34,34,64,92,83,54,55,16,
+4,14,73,58,162,43,19,34,1,137,32,22,43,73,254,50,50,63,60,56,52,48,56,56,
+42,9,20,34,254,211,55,75,45,19,47,15,34,57,41,1,47,32,20,43,0,3,0,84,254,
+193,7,170,6,20,0,3,0,41,0,61,0,0,9,3,37,52,46,2,35,34,14,2,21,20,30,2,51,
+52,62,2,51,50,30,2,21,20,14,2,7,23,51,55,62,3,1,20,30,2,51,50,62,2,53,52,
+46,2,35,34,14,2,3,254,3,172,252,84,252,86,5,49,60,107,147,87,90,131,86,41,
+34,62,84,51,13,31,50,37,34,48,31,14,20,52,89,70,32,101,32,82,122,81,41,253,
+223,21,36,49,27,28,49,37,22,22,37,49,28,27,49,36,21,6,20,252,86,252,87,3,
+169,240,71,112,77,41,30,51,69,40,29,44,28,14,42,75,57,33,26,47,65,40,48,96,
+88,76,28,201,150,34,72,86,104,253,66,37,50,31,13,13,31,50,37,37,51,30,13,
+13,30,51,255,255,255,231,254,20,2,79,6,33,18,34,2,53,0,0,16,3,1,76,254,210,
+0,0,255,255,0,61,3,115,1,141,5,182,18,2,2,7,0,0,0,2,0,18,255,236,4,186,6,
+29,0,12,0,79,0,0,1,46,3,35,34,6,21,20,30,2,5,22,22,21,20,2,6,6,35,34,46,2,
+53,52,62,2,53,52,46,2,35,35,53,51,50,30,2,21,20,14,2,21,20,30,2,51,50,18,
+17,52,46,2,39,46,3,53,52,62,2,51,50,30,2,23,51,21,3,102,13,53,72,88,48,75,
+87,43,101,167,1,72,2,2,64,129,196,131,111,154,96,42,7,9,8,9,21,36,28,66,138,
+64,84,48,19,8,9,8,25,54,83,57,163,153,1,1,1,1,174,238,146,63,40,84,129,89,
+101,158,116,76,18,143,3,197,117,182,126,66,93,79,61,114,88,55,92,23,59,32,
+166,254,227,210,119,55,94,126,71,41,94,88,76,24,23,38,26,14,86,27,48,67,41,
+35,79,83,86,42,51,88,65,38,1,83,1,79,12,31,32,28,11,3,69,113,143,76,62,105,
+77,43,85,158,223,138,87,0,1,255,246,0,0,5,55,5,197,0,74,0,0,37,51,21,33,53,
+51,50,62,2,53,53,52,46,4,39,46,3,35,35,53,51,50,30,2,23,30,3,23,62,3,55,62,
+3,51,50,22,21,20,14,2,35,38,38,35,34,14,2,7,14,5,21,21,20,30,2,3,147,48,253,
+131,47,34,61,46,27,34,54,68,67,60,20,23,53,60,67,37,8,104,70,102,84,73,42,
+35,65,56,46,17,18,46,49,49,22,39,71,73,78,45,81,80,16,27,33,18,9,48,47,26,
+47,49,55,34,15,37,40,38,30,18,26,46,60,86,86,86,9,28,55,45,180,62,144,148,
+146,130,105,33,39,74,58,36,84,25,61,105,81,69,141,133,122,51,68,144,138,126,
+50,84,107,62,24,79,63,29,49,34,19,45,62,20,56,99,79,34,93,107,117,115,109,
+46,203,48,58,31,10,0,2,0,66,255,236,7,45,4,248,0,51,0,94,0,0,5,34,46,2,39,
+35,14,3,35,34,46,2,53,52,54,55,35,34,14,2,21,35,52,62,2,51,33,50,62,2,53,
+51,20,14,2,35,35,22,22,21,20,14,2,1,6,6,21,20,30,2,51,50,62,2,55,46,3,53,
+52,54,51,50,22,21,20,14,2,7,30,3,51,50,62,2,53,52,38,39,4,227,53,90,71,53,
+15,8,15,53,72,90,53,89,144,100,54,80,65,127,45,61,36,15,86,38,69,98,59,4,
+239,45,61,37,15,86,38,69,98,59,80,65,80,54,101,143,253,14,47,50,35,60,80,
+45,49,72,50,30,8,8,17,14,9,54,41,40,54,10,14,16,7,7,31,50,72,49,44,80,60,
+35,52,45,20,32,56,77,45,45,77,56,32,52,114,182,131,136,236,97,27,48,63,36,
+93,130,83,38,27,48,63,36,93,131,82,38,97,235,137,131,182,114,52,3,180,100,
+229,144,105,140,84,36,32,58,82,51,21,56,63,66,32,75,66,66,75,32,66,63,56,
+21,51,82,58,32,36,84,140,105,144,229,100,255,255,0,78,0,0,7,51,7,115,18,34,
+0,48,0,0,16,3,0,118,1,221,1,82,255,255,0,57,0,0,7,86,6,33,18,34,0,80,0,0,
+16,3,0,118,1,240,0,0,255,255,0,0,254,20,5,164,5,182,18,34,0,36,0,0,16,3,2,
+86,1,125,0,0,255,255,0,102,254,20,4,41,4,94,18,34,0,68,0,0,16,3,2,86,0,195,
+0,0,0,1,254,143,0,0,1,240,5,182,0,3,0,0,33,35,1,51,1,240,135,253,38,135,5,
+182,0,2,0,113,254,20,2,55,255,174,0,19,0,37,0,0,1,20,14,2,35,34,46,2,53,52,
+62,2,51,50,30,2,7,52,46,2,35,34,6,21,20,30,2,51,50,62,2,2,55,35,62,82,48,
+48,82,62,35,35,62,82,48,48,82,62,35,110,19,32,42,24,48,69,19,31,43,24,24,
+42,32,19,254,225,50,76,52,27,27,52,76,50,50,76,52,27,27,52,76,50,28,39,26,
+12,50,55,28,40,25,11,11,25,40,0,2,0,60,255,236,3,242,5,203,0,31,0,46,0,0,
+1,34,6,2,7,51,54,54,51,50,22,21,20,2,6,35,34,38,53,16,18,36,51,50,22,21,20,
+6,7,54,53,52,1,50,54,54,53,52,38,35,34,6,7,6,21,20,22,2,184,105,192,155,39,
+4,54,178,87,160,188,126,218,138,156,178,186,1,58,206,119,125,83,77,13,254,
+21,89,133,77,111,95,74,159,46,19,106,5,90,136,254,238,177,70,93,204,171,162,
+254,233,150,227,210,1,49,1,251,254,78,73,73,81,2,31,35,128,251,0,116,227,
+135,127,149,113,88,133,79,149,192,0,1,0,55,0,0,7,233,6,51,0,107,0,0,37,50,
+62,2,53,17,33,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,33,17,20,30,2,51,
+51,21,33,53,51,50,62,2,53,17,35,53,51,53,52,54,51,50,30,2,21,20,14,2,35,52,
+46,2,35,34,14,2,21,21,33,53,52,62,2,51,50,22,21,20,14,2,35,52,46,2,35,34,
+14,2,21,21,33,17,20,30,2,51,51,21,33,53,5,190,34,61,46,27,254,11,26,46,61,
+35,36,253,177,26,34,62,45,27,254,10,27,45,61,35,37,253,176,27,34,62,45,27,
+187,187,199,180,73,103,65,29,25,45,61,37,13,31,52,39,44,59,36,15,1,246,59,
+120,185,126,190,193,27,50,68,42,22,52,90,67,79,102,58,23,2,182,27,45,61,35,
+26,253,207,86,9,28,55,45,3,10,253,0,48,58,31,10,86,86,10,31,58,48,3,0,253,
+0,48,58,31,10,86,86,10,31,58,48,3,0,97,24,214,220,21,38,53,31,28,43,29,15,
+31,59,46,28,45,82,114,70,53,16,111,176,122,64,93,77,30,50,35,20,31,73,64,
+43,58,102,138,81,16,252,159,48,58,31,10,86,86,0,1,0,55,0,0,7,231,6,41,0,106,
+0,0,37,50,62,2,53,17,52,46,2,35,34,14,2,21,21,33,21,33,17,20,30,2,51,51,21,
+33,53,51,50,62,2,53,17,33,17,20,30,2,51,51,21,33,53,51,50,62,2,53,17,35,53,
+51,53,52,54,51,50,30,2,21,20,14,2,35,52,46,2,35,34,14,2,21,21,33,53,52,62,
+2,51,50,30,2,23,51,17,20,30,2,51,51,21,33,53,5,188,35,61,46,26,26,57,90,64,
+79,102,58,23,1,57,254,199,26,46,61,35,36,253,177,26,34,62,45,27,254,10,27,
+45,61,35,37,253,176,27,34,62,45,27,187,187,199,180,73,103,65,29,25,45,61,
+37,13,31,52,39,44,59,36,15,1,246,59,120,185,126,24,57,52,45,12,205,27,45,
+61,35,26,253,207,86,10,31,58,48,4,17,43,76,57,33,54,96,130,75,30,97,253,0,
+48,58,31,10,86,86,10,31,58,48,3,0,253,0,48,58,31,10,86,86,10,31,58,48,3,0,
+97,24,214,220,21,38,53,31,28,43,29,15,31,59,46,28,45,82,114,70,53,24,108,
+170,116,61,5,6,7,3,250,213,48,58,31,10,86,86,0,2,0,115,255,236,6,37,6,41,
+0,23,0,31,0,0,1,54,53,52,38,53,52,51,50,21,20,7,22,21,16,0,33,32,0,17,16,
+0,33,32,1,32,17,16,33,32,17,16,5,10,129,88,117,125,248,78,254,169,254,212,
+254,201,254,178,1,79,1,56,1,100,254,154,1,160,254,98,254,92,4,180,35,94,27,
+66,49,102,129,221,90,175,229,254,162,254,109,1,143,1,100,1,101,1,137,250,
+141,2,131,2,129,253,127,253,125,0,2,0,113,255,236,4,244,5,6,0,20,0,31,0,0,
+1,54,53,52,38,53,52,51,50,21,20,7,22,21,16,33,32,17,16,33,32,1,50,54,53,52,
+38,35,34,6,21,16,3,219,127,88,117,125,248,49,254,31,254,37,1,225,1,19,254,
+235,144,134,133,147,147,132,3,145,35,94,27,66,49,102,129,216,93,122,175,253,
+197,2,59,2,55,251,248,218,247,240,219,219,240,254,47,0,1,0,31,255,236,6,37,
+6,41,0,39,0,0,1,20,4,35,32,17,17,52,35,35,53,33,21,35,34,21,17,16,33,50,54,
+53,17,52,35,35,53,33,17,54,53,52,38,53,52,51,50,21,16,5,4,219,254,250,240,
+253,252,168,26,2,84,27,168,1,86,164,180,168,26,1,63,176,88,117,125,254,182,
+1,162,208,230,1,206,3,27,139,86,86,147,252,225,254,184,169,151,3,47,139,86,
+254,242,28,113,27,66,49,102,129,254,236,60,0,2,0,47,255,236,5,129,5,6,0,40,
+0,41,0,0,1,54,53,52,38,53,52,51,50,21,16,5,17,20,51,51,21,33,39,35,6,35,32,
+17,17,52,35,35,53,33,17,16,51,32,17,17,52,35,35,53,33,19,4,55,176,88,117,
+125,254,182,168,6,254,187,27,10,97,235,254,174,168,6,1,111,215,1,2,168,6,
+1,110,221,3,133,30,111,27,66,49,102,129,254,236,60,253,170,137,86,166,186,
+1,145,1,235,140,86,253,61,254,232,1,75,1,166,148,86,251,182,255,255,252,144,
+4,217,254,30,6,33,16,3,0,67,251,7,0,0,255,255,253,68,4,217,254,209,6,33,16,
+3,0,118,251,189,0,0,255,255,252,9,4,217,254,226,5,223,16,3,1,82,251,40,0,
+0,0,1,252,195,4,184,254,133,6,143,0,16,0,0,1,7,35,39,54,53,52,35,34,7,38,
+53,52,51,50,21,20,253,199,11,102,14,174,103,96,67,41,208,242,5,47,119,185,
+18,90,76,82,19,57,108,168,150,0,1,253,39,254,137,254,16,255,135,0,7,0,0,5,
+50,21,20,35,34,53,52,253,156,116,116,117,121,127,127,127,127,255,255,0,78,
+0,0,4,166,7,115,18,34,0,40,0,0,16,3,0,67,255,208,1,82,255,255,0,78,0,0,6,
+31,7,115,18,34,1,178,0,0,16,3,0,67,0,109,1,82,255,255,0,113,255,236,3,225,
+6,33,18,34,0,72,0,0,16,2,0,67,148,0,255,255,0,47,0,0,5,82,6,33,18,34,1,210,
+0,0,16,2,0,67,239,0,0,1,0,117,255,236,7,100,5,203,0,41,0,0,37,6,35,32,17,
+16,0,51,50,22,21,20,35,38,35,34,17,16,33,50,55,17,51,17,22,51,32,17,16,35,
+34,7,34,53,52,54,51,32,17,16,33,34,3,219,153,207,254,2,1,18,244,123,164,136,
+61,133,248,1,72,139,88,211,117,131,1,51,250,136,54,131,190,148,1,204,253,
+213,208,100,120,2,231,1,109,1,139,114,73,127,205,253,127,253,150,65,1,226,
+254,49,84,2,106,2,129,205,115,80,119,253,30,253,3,0,1,0,0,0,0,6,16,4,94,0,
+33,0,0,1,18,19,54,18,53,52,39,52,51,50,21,20,0,7,35,38,39,3,35,2,2,35,34,
+7,39,54,51,50,18,19,19,2,39,3,66,119,180,115,153,105,115,141,254,248,186,
+107,62,73,201,149,174,162,65,38,34,37,92,94,116,156,185,176,93,87,4,74,254,
+201,253,163,126,1,126,139,139,27,123,198,206,253,221,167,224,235,254,53,2,
+84,1,123,21,64,86,254,215,253,147,1,146,1,39,215,0,2,0,41,0,0,5,4,5,182,0,
+39,0,48,0,0,1,17,51,32,17,20,4,35,33,53,51,50,53,17,35,34,6,7,7,35,55,33,
+53,52,35,35,53,33,21,35,34,21,21,33,23,35,39,38,38,35,3,51,50,54,53,52,38,
+35,35,2,94,129,2,37,254,254,246,253,193,26,168,73,89,78,18,4,96,8,1,94,168,
+26,2,94,37,168,1,111,10,96,4,15,66,104,92,139,163,155,161,187,109,4,47,254,
+250,254,109,190,216,86,139,3,78,35,94,22,245,72,139,86,86,137,74,245,22,81,
+48,252,51,136,161,172,146,0,2,0,47,0,0,4,82,6,20,0,26,0,34,0,0,19,17,52,35,
+35,53,33,17,33,21,33,17,51,32,22,21,20,6,35,33,53,51,50,53,17,35,53,1,50,
+54,53,52,33,35,17,242,168,27,1,131,1,43,254,213,199,1,1,216,220,204,253,133,
+27,168,195,2,84,139,117,254,244,197,4,16,1,35,139,86,253,252,96,254,178,146,
+151,143,170,86,137,2,209,96,252,78,107,123,192,254,90,0,1,0,78,255,236,7,
+4,5,203,0,49,0,0,1,2,35,32,3,33,21,33,18,33,50,55,22,21,20,6,35,32,0,3,33,
+17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,33,18,0,33,
+50,22,21,20,6,88,21,206,254,144,15,1,248,254,8,19,1,118,222,120,39,225,191,
+254,241,254,203,6,254,205,168,27,253,172,26,168,168,26,2,84,27,168,1,53,23,
+1,71,1,13,185,204,4,86,1,8,253,209,100,253,168,174,25,55,92,137,1,126,1,95,
+254,32,147,86,86,147,3,236,139,86,86,147,254,98,1,62,1,94,126,104,128,0,1,
+0,47,255,236,6,10,4,94,0,47,0,0,1,33,17,20,51,51,21,33,53,51,50,53,17,52,
+35,35,53,33,21,35,34,21,17,33,18,33,50,22,21,20,35,52,35,34,3,33,21,33,18,
+33,50,55,22,21,20,6,35,32,2,219,254,215,168,6,253,207,27,168,168,27,2,49,
+6,168,1,41,27,1,174,150,206,182,174,243,13,1,198,254,56,12,1,41,187,85,35,
+189,159,254,58,2,4,254,219,137,86,86,137,2,137,140,86,86,138,254,248,1,252,
+114,95,129,236,254,106,110,254,125,143,27,53,79,117,0,2,0,0,0,0,5,135,5,182,
+0,29,0,36,0,0,1,35,3,6,21,20,23,21,33,53,51,50,55,1,51,1,22,51,51,21,33,53,
+54,53,52,39,3,35,17,35,3,33,39,38,39,6,3,2,66,101,162,18,123,254,92,18,96,
+60,1,209,149,1,236,43,86,6,254,29,131,23,170,100,192,62,1,62,43,62,51,22,
+97,2,201,254,73,49,39,92,8,86,86,160,4,192,251,15,111,86,86,3,81,33,57,1,
+197,253,55,3,47,117,169,167,76,254,252,0,2,0,6,0,0,4,174,4,74,0,29,0,37,0,
+0,1,35,7,6,21,20,23,21,33,53,51,50,55,1,51,1,22,51,51,21,33,53,54,53,52,39,
+3,35,17,35,3,33,39,38,39,35,6,3,1,217,90,100,28,67,254,196,4,78,68,1,108,
+180,1,119,46,71,6,254,113,73,24,103,100,172,51,1,31,17,63,49,7,4,120,2,4,
+242,68,44,66,10,86,86,160,3,84,252,123,111,86,86,7,67,40,60,1,0,253,252,2,
+98,41,152,170,11,254,224,0,2,0,78,0,0,8,74,5,182,0,53,0,60,0,0,51,53,51,50,
+53,17,52,35,35,53,33,21,35,34,21,17,33,19,51,1,22,51,51,21,33,53,54,53,52,
+39,3,35,17,35,17,35,3,6,21,20,23,21,33,53,51,50,55,19,33,17,20,51,51,21,1,
+33,39,38,39,6,7,78,26,168,168,26,2,84,27,168,2,107,248,149,1,236,43,86,6,
+254,28,131,22,170,100,193,100,162,18,122,254,103,8,96,60,178,253,188,168,
+27,2,37,1,61,43,62,51,29,89,86,147,3,236,139,86,86,147,254,98,2,135,251,15,
+111,86,86,3,81,29,61,1,197,253,55,2,201,254,73,49,39,92,8,86,86,160,1,211,
+254,32,147,86,3,47,117,169,167,98,238,0,2,0,47,0,0,6,158,4,74,0,49,0,55,0,
+0,1,35,7,6,21,20,23,21,33,53,51,50,55,19,33,17,33,53,51,50,53,17,52,35,35,
+53,33,21,35,34,21,17,33,19,51,1,22,51,51,21,33,53,54,53,52,39,3,35,17,35,
+3,33,39,38,39,35,3,201,90,101,28,67,254,197,4,77,68,115,254,180,254,125,27,
+168,168,27,2,49,6,168,1,117,209,180,1,119,46,71,6,254,112,73,24,102,100,172,
+51,1,30,16,74,39,6,2,4,242,68,44,66,10,86,86,160,1,14,253,252,86,137,2,137,
+140,86,86,138,254,248,1,232,252,123,111,86,86,7,67,40,60,1,0,253,252,2,98,
+41,191,131,0,2,0,0,0,0,6,76,5,182,0,49,0,52,0,0,1,1,51,50,23,19,22,22,51,
+51,21,35,34,38,39,3,38,38,35,17,20,51,51,21,33,53,51,50,53,17,34,6,7,3,6,
+6,35,35,53,51,50,54,55,19,54,51,51,1,53,33,1,1,33,5,96,254,90,64,231,70,111,
+33,76,67,6,17,203,131,34,105,31,92,98,168,6,253,230,6,168,100,92,30,104,34,
+132,203,16,6,69,76,31,111,69,232,45,254,111,4,114,253,219,1,117,253,33,5,
+74,253,225,215,254,166,101,63,86,81,116,1,96,102,68,254,26,147,86,86,137,
+1,240,71,99,254,160,116,81,86,67,97,1,90,215,2,31,108,253,140,1,235,0,2,0,
+6,0,0,5,152,4,74,0,49,0,53,0,0,19,54,55,1,53,33,21,1,22,23,23,22,22,51,51,
+21,35,34,38,39,39,38,38,35,17,20,22,51,51,21,33,53,51,50,54,53,17,34,6,7,
+7,6,6,35,35,53,51,50,54,55,1,51,1,33,244,71,230,254,188,3,234,254,174,237,
+72,76,46,58,51,7,43,157,104,45,71,33,82,88,46,81,6,254,64,8,80,47,96,74,33,
+72,48,111,146,43,6,60,59,37,2,53,10,1,54,253,157,1,182,177,10,1,116,101,101,
+254,140,7,180,188,113,51,86,70,123,198,91,53,254,200,67,70,86,86,71,76,1,
+46,57,87,198,132,61,86,69,95,1,119,1,90,0,2,0,78,0,0,9,25,5,182,0,71,0,74,
+0,0,1,52,35,35,53,33,21,35,34,21,17,33,1,53,33,21,1,51,50,23,19,22,22,51,
+51,21,35,34,38,39,3,38,38,35,17,20,51,51,21,33,53,51,50,53,17,34,6,7,3,6,
+6,35,35,53,51,50,54,55,19,54,55,33,17,20,51,51,21,33,53,51,50,53,1,1,33,1,
+16,168,26,2,84,27,168,3,105,254,114,4,115,254,90,64,231,70,110,31,77,68,7,
+17,203,131,34,105,31,92,98,168,6,253,229,7,167,100,91,30,104,34,132,203,16,
+6,69,76,31,111,24,37,253,176,168,27,253,172,26,168,4,248,1,117,253,33,4,213,
+139,86,86,147,254,98,2,27,108,108,253,225,215,254,166,97,67,86,81,116,1,96,
+102,68,254,26,147,86,86,137,1,240,71,99,254,160,116,81,86,67,97,1,90,75,42,
+254,32,147,86,86,147,2,89,1,235,0,2,0,47,0,0,7,135,4,74,0,68,0,72,0,0,1,54,
+55,33,17,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,33,1,53,33,21,1,
+22,23,23,22,22,51,51,21,35,34,38,39,39,38,38,35,17,20,22,51,51,21,33,53,51,
+50,54,53,17,34,6,7,7,6,6,35,35,53,51,50,54,55,1,51,1,33,2,227,21,24,254,162,
+254,125,27,168,168,27,2,49,6,168,2,94,254,189,3,233,254,174,235,75,75,39,
+58,59,6,43,136,113,56,72,34,86,82,46,81,6,254,63,8,80,47,106,72,24,72,48,
+111,146,43,6,53,63,40,2,53,10,1,53,253,158,1,182,52,26,253,252,86,137,2,137,
+140,86,86,138,254,248,1,131,101,101,254,125,11,175,174,91,73,86,55,138,184,
+86,57,254,215,67,70,86,86,71,76,1,31,62,67,198,132,61,86,62,102,1,104,1,105,
+0,1,0,127,254,82,4,106,6,205,0,65,0,0,1,51,22,23,54,51,50,21,20,7,38,35,34,
+7,4,17,16,5,21,4,17,20,6,5,6,21,20,51,50,36,51,50,21,20,7,38,35,34,4,35,32,
+53,52,54,36,54,53,52,38,35,35,53,51,50,54,53,52,33,32,17,34,53,52,37,38,39,
+1,61,80,101,127,125,139,90,14,38,32,109,81,1,108,254,182,1,115,245,254,208,
+211,152,90,1,19,87,176,120,31,96,52,254,241,79,254,166,183,1,181,128,185,
+166,174,174,138,184,254,240,254,233,176,1,113,67,112,6,203,62,133,197,72,
+25,28,12,153,48,254,226,254,225,80,10,47,254,213,189,208,21,14,133,129,110,
+143,96,25,96,53,237,114,130,33,150,143,135,150,104,176,141,254,254,207,133,
+237,34,98,135,0,1,0,43,254,109,3,174,5,74,0,62,0,0,19,51,22,23,54,51,50,21,
+20,7,38,35,34,7,4,21,20,7,21,22,21,16,5,6,21,20,51,50,36,51,50,21,20,7,38,
+35,34,6,35,32,53,52,54,36,53,52,35,35,53,51,50,54,53,52,35,34,21,34,53,52,
+55,38,39,186,80,101,127,125,139,90,14,38,32,103,77,1,14,207,242,254,49,188,
+135,80,1,4,78,151,111,23,91,51,232,78,254,199,160,1,231,239,191,193,96,110,
+184,211,162,250,48,118,5,72,62,133,197,72,25,28,12,133,45,215,194,72,11,58,
+196,254,215,36,17,117,118,106,133,84,24,86,48,213,101,118,40,212,201,111,
+107,89,195,221,123,148,36,70,147,255,255,0,25,0,0,6,135,5,182,18,2,1,117,
+0,0,255,255,0,37,254,20,5,29,6,20,18,2,1,149,0,0,0,3,0,115,255,236,5,123,
+5,205,0,11,0,22,0,33,0,0,5,32,0,17,16,0,33,32,0,17,16,0,1,54,51,50,4,51,50,
+55,2,33,32,1,6,35,34,36,35,34,7,18,33,32,2,248,254,201,254,178,1,79,1,56,
+1,43,1,86,254,169,253,50,121,119,77,1,28,81,79,73,25,254,123,254,113,3,47,
+123,117,79,254,225,80,79,73,7,1,157,1,152,20,1,143,1,100,1,101,1,137,254,
+111,254,161,254,162,254,109,3,67,76,131,55,2,47,253,107,76,131,55,253,145,
+0,3,0,113,255,236,4,45,4,94,0,7,0,18,0,29,0,0,5,32,17,16,33,32,17,16,1,54,
+51,50,22,51,50,55,2,33,32,1,6,35,34,38,35,34,7,18,33,32,2,76,254,37,1,225,
+1,219,253,10,85,59,62,198,53,55,47,18,254,250,254,250,2,32,84,61,62,197,54,
+55,50,9,1,18,1,15,20,2,59,2,55,253,201,253,197,2,129,47,86,39,1,133,254,20,
+47,86,39,254,80,0,1,0,0,0,0,5,152,5,195,0,31,0,0,33,35,1,38,35,35,53,33,21,
+35,34,21,20,23,19,22,23,54,55,19,54,54,51,50,21,20,7,38,35,34,6,7,2,252,150,
+254,70,38,107,27,2,51,47,123,17,225,46,46,48,32,160,63,160,121,121,68,29,
+53,60,84,46,4,244,108,86,86,98,27,49,253,103,136,200,224,112,2,49,221,156,
+105,67,27,47,104,142,0,1,0,8,0,0,4,197,4,86,0,32,0,0,33,1,38,35,35,53,33,
+21,35,34,21,20,23,19,22,23,51,18,55,55,54,54,51,50,21,20,7,38,35,34,6,7,3,
+1,233,254,183,40,106,6,2,0,26,123,16,139,72,18,7,63,35,61,66,127,123,123,
+68,36,46,50,68,52,225,3,135,109,86,86,99,29,46,254,125,199,109,1,25,113,202,
+219,152,104,66,29,60,77,169,253,43,255,255,0,0,0,0,5,152,7,115,18,34,2,123,
+0,0,16,3,3,113,5,61,1,82,255,255,0,8,0,0,4,197,6,33,18,34,2,124,0,0,16,3,
+3,113,4,182,0,0,0,3,0,115,254,20,9,213,5,205,0,11,0,19,0,59,0,0,5,32,0,17,
+16,0,33,32,0,17,16,0,37,32,17,16,33,32,17,16,1,21,35,34,6,7,1,2,6,35,35,53,
+32,19,1,38,35,35,53,33,21,35,34,21,20,23,19,22,23,51,54,54,55,19,54,53,52,
+35,35,53,2,207,254,221,254,199,1,57,1,37,1,24,1,64,254,192,254,230,1,119,
+254,139,254,133,8,127,6,61,58,37,254,211,121,215,241,19,1,84,111,254,143,
+45,100,6,1,235,6,123,16,146,76,16,6,11,42,23,127,18,135,6,20,1,140,1,103,
+1,103,1,135,254,111,254,161,254,163,254,108,110,2,131,2,129,253,127,253,125,
+3,240,86,60,100,252,164,254,167,139,97,1,147,3,127,109,86,86,99,34,41,254,
+139,194,95,45,128,75,1,143,57,31,101,86,0,3,0,113,254,20,8,86,4,94,0,7,0,
+18,0,58,0,0,5,32,17,16,33,32,17,16,37,50,54,53,52,38,35,34,6,21,16,1,21,35,
+34,6,7,1,2,6,35,35,53,32,19,1,38,35,35,53,33,21,35,34,21,20,23,19,22,23,51,
+54,54,55,19,54,53,52,35,35,53,2,55,254,58,1,204,1,199,254,55,134,124,122,
+138,134,124,7,31,6,61,58,37,254,211,121,215,241,19,1,84,111,254,143,45,100,
+6,1,235,6,123,16,146,76,16,6,11,42,23,127,18,135,6,20,2,59,2,55,253,201,253,
+197,106,220,245,239,220,215,244,254,47,3,244,86,60,100,252,164,254,167,139,
+97,1,147,3,127,109,86,86,99,34,41,254,139,194,95,45,128,75,1,143,57,31,101,
+86,0,2,0,115,255,131,5,205,6,49,0,17,0,33,0,0,5,6,35,34,39,36,17,16,37,54,
+51,50,23,4,0,17,16,0,37,36,17,16,37,6,35,34,39,4,17,16,5,54,51,50,3,176,25,
+118,121,23,253,226,2,30,21,123,119,24,1,0,1,29,254,230,254,245,1,65,254,191,
+27,108,108,29,254,190,1,66,28,109,104,8,117,117,95,2,136,2,128,98,112,112,
+46,254,122,254,208,254,211,254,120,69,85,2,27,2,26,85,90,88,89,253,236,253,
+231,87,86,0,2,0,113,255,145,4,168,4,182,0,15,0,31,0,0,5,6,35,34,39,36,17,
+16,37,54,51,50,23,4,17,16,37,54,51,50,23,54,17,16,39,6,35,34,39,6,17,16,3,
+12,18,107,113,12,254,95,1,161,10,115,111,12,1,158,253,111,16,104,101,18,219,
+219,18,101,104,16,224,10,101,99,68,1,239,1,241,62,96,98,68,254,23,254,15,
+46,76,74,59,1,134,1,125,61,73,75,57,254,125,254,120,0,3,0,119,255,236,7,100,
+8,57,0,14,0,26,0,69,0,0,1,21,35,34,36,35,34,7,7,35,54,51,50,4,51,1,53,54,
+53,52,38,53,52,51,50,21,20,19,34,53,52,54,51,50,0,17,16,33,34,39,6,35,32,
+17,16,0,51,50,22,21,20,35,38,38,35,34,17,16,33,50,55,51,22,51,32,17,16,35,
+34,6,5,143,41,125,254,192,58,96,11,4,92,18,215,71,1,61,112,254,4,129,98,96,
+115,84,135,159,123,246,1,16,254,2,209,167,168,209,254,2,1,16,246,123,160,
+136,39,83,68,248,1,72,164,161,13,161,164,1,72,248,70,82,7,201,129,112,86,
+26,241,112,254,65,64,37,63,22,51,42,71,106,181,254,72,127,73,114,254,126,
+254,152,253,11,141,141,2,245,1,104,1,130,113,74,127,125,80,253,127,253,150,
+202,202,2,106,2,129,86,0,3,0,104,255,236,5,236,7,8,0,14,0,26,0,71,0,0,1,21,
+35,34,36,35,34,7,7,35,54,51,50,4,51,1,53,54,53,52,38,53,52,51,50,21,20,3,
+22,51,50,17,52,38,35,34,6,21,34,53,52,54,51,32,17,16,2,35,34,39,6,35,34,2,
+17,16,33,50,22,21,20,35,52,38,35,34,6,21,16,51,50,55,4,150,41,126,254,192,
+58,96,11,4,92,18,215,71,1,61,112,254,4,129,98,96,115,76,90,180,230,82,102,
+80,60,141,149,129,1,130,217,201,177,110,107,180,201,219,1,129,131,148,141,
+60,80,102,82,232,180,90,6,152,129,112,86,26,241,112,254,65,64,37,63,22,51,
+42,71,106,181,251,246,178,1,197,255,216,82,103,111,74,102,253,193,254,244,
+254,217,102,102,1,37,1,14,2,63,103,73,111,103,82,216,255,254,59,178,0,2,0,
+117,255,236,7,100,7,4,0,13,0,55,0,0,1,21,7,35,39,35,7,35,39,35,7,35,39,53,
+1,6,35,32,17,16,0,51,50,22,21,20,35,38,35,34,17,16,33,50,55,17,51,17,22,51,
+32,17,16,35,34,7,34,53,52,54,51,32,17,16,33,34,5,139,82,34,50,184,49,35,49,
+184,50,34,80,1,143,153,207,254,2,1,18,244,123,164,136,61,133,248,1,72,139,
+88,211,117,131,1,51,250,136,54,131,190,148,1,204,253,213,208,7,4,27,172,103,
+103,103,103,172,27,249,96,120,2,231,1,109,1,139,114,73,127,205,253,127,253,
+150,65,1,226,254,49,84,2,106,2,129,205,115,80,119,253,30,253,3,0,2,0,0,0,
+0,6,16,5,164,0,13,0,47,0,0,1,21,7,35,39,35,7,35,39,35,7,35,39,53,1,18,19,
+54,18,53,52,39,52,51,50,21,20,0,7,35,38,39,3,35,2,2,35,34,7,39,54,51,50,18,
+19,19,2,39,4,223,82,35,49,184,49,35,49,184,50,34,80,1,162,119,180,115,153,
+105,115,141,254,248,186,107,62,73,201,149,174,162,65,38,34,37,92,94,116,156,
+185,176,93,87,5,164,27,172,103,103,103,103,172,27,254,166,254,201,253,163,
+126,1,126,139,139,27,123,198,206,253,221,167,224,235,254,53,2,84,1,123,21,
+64,86,254,215,253,147,1,146,1,39,215,0,1,0,117,254,23,4,164,5,203,0,33,0,
+0,1,52,38,35,32,17,16,33,50,55,51,17,20,51,51,21,33,53,51,50,53,53,35,32,
+0,17,16,0,33,50,22,21,20,6,3,242,126,114,254,86,1,170,100,86,9,168,26,253,
+172,27,168,19,254,217,254,185,1,92,1,53,198,216,100,4,86,118,146,253,127,
+253,150,37,254,104,147,86,86,147,236,1,147,1,94,1,91,1,147,126,104,64,79,
+0,1,0,113,254,23,3,158,4,94,0,22,0,0,5,32,17,16,33,50,22,21,20,35,52,35,34,
+6,21,16,33,50,55,51,17,35,17,2,68,254,45,1,200,150,207,183,174,138,120,1,
+54,96,74,4,193,20,2,51,2,63,115,94,129,236,230,241,254,80,45,253,121,1,213,
+0,1,0,104,255,250,4,121,5,10,0,19,0,0,1,5,7,37,3,39,19,37,55,5,19,37,55,5,
+19,23,3,5,7,37,2,76,1,28,71,254,227,180,129,180,254,229,70,1,31,198,254,228,
+71,1,29,182,127,182,1,31,74,254,229,1,176,166,123,164,254,199,74,1,59,164,
+123,164,1,90,164,125,164,1,57,73,254,196,164,123,164,0,1,0,201,4,143,3,176,
+5,184,0,15,0,0,1,6,35,34,53,52,54,51,33,54,51,50,21,20,6,35,1,139,13,85,96,
+43,55,1,193,10,88,98,43,57,4,238,95,107,59,37,94,104,57,41,0,1,0,244,4,229,
+3,223,5,215,0,14,0,0,1,50,36,51,50,23,35,39,38,35,34,4,35,35,53,1,2,114,1,
+57,73,215,18,92,4,13,94,60,254,196,127,41,5,102,113,242,27,86,113,129,0,1,
+1,225,4,215,2,211,6,53,0,11,0,0,1,21,38,53,52,51,50,21,20,6,21,20,2,211,242,
+127,97,99,5,35,76,61,162,127,76,40,42,24,51,0,1,1,225,4,215,2,211,6,53,0,
+11,0,0,1,53,54,53,52,38,53,52,51,50,21,20,1,225,117,98,96,127,4,215,76,41,
+51,23,44,39,76,127,162,0,8,0,41,254,193,7,193,5,145,0,9,0,19,0,29,0,39,0,
+49,0,59,0,69,0,79,0,0,1,38,35,34,7,35,54,51,50,23,1,38,35,34,7,35,54,51,50,
+23,33,38,35,34,7,35,54,51,50,23,1,38,35,34,7,35,54,51,50,23,33,38,35,34,7,
+35,54,51,50,23,1,38,35,34,7,35,54,51,50,23,33,38,35,34,7,35,54,51,50,23,1,
+38,35,34,7,35,54,51,50,23,4,111,7,127,130,3,75,13,195,196,17,1,244,6,127,
+131,2,76,14,195,196,17,251,47,6,127,131,2,76,14,195,196,17,4,240,7,126,131,
+3,75,13,196,195,18,249,190,6,127,131,2,76,13,196,196,17,4,227,7,126,131,2,
+76,14,195,196,17,251,47,7,126,131,2,76,14,195,196,17,1,238,8,126,130,3,75,
+14,194,196,17,4,207,88,88,194,194,254,227,88,88,195,195,88,88,195,195,254,
+25,88,88,194,194,88,88,194,194,254,12,88,88,195,195,88,88,195,195,254,234,
+88,88,194,194,0,8,0,41,254,127,7,125,5,211,0,6,0,13,0,20,0,27,0,34,0,41,0,
+48,0,55,0,0,1,39,54,55,51,6,7,1,39,38,39,55,22,23,37,55,54,55,23,6,7,19,55,
+22,23,21,38,39,5,7,38,39,53,22,23,1,23,22,23,7,38,39,5,7,6,7,39,54,55,5,23,
+6,7,35,54,55,3,113,11,43,80,97,50,20,253,240,17,84,67,67,107,92,2,223,2,150,
+174,69,175,122,144,14,160,176,210,140,251,104,14,156,180,210,140,4,49,17,
+81,70,67,110,89,253,35,2,140,184,69,175,122,2,32,11,41,82,97,50,20,4,117,
+14,160,176,210,140,254,248,2,149,174,70,171,126,43,16,85,67,68,109,89,254,
+243,11,43,80,97,50,20,59,11,41,82,97,50,20,254,104,2,140,183,70,175,122,41,
+16,81,71,68,109,89,178,14,156,180,210,140,0,2,0,78,254,82,6,88,7,63,0,10,
+0,58,0,0,1,2,33,32,3,51,22,22,51,50,55,1,20,22,51,51,21,3,35,19,33,53,51,
+50,53,17,1,21,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,
+1,53,52,35,35,53,33,21,35,34,21,4,182,26,254,149,254,150,15,170,8,84,119,
+194,17,1,84,66,104,82,131,168,170,253,244,26,168,253,82,168,27,253,172,26,
+168,168,26,2,84,27,168,2,174,168,26,2,84,27,168,7,63,254,236,1,20,101,85,
+186,249,173,71,71,10,253,254,1,174,86,147,3,43,252,254,41,147,86,86,147,3,
+236,139,86,86,147,252,213,3,2,41,147,86,86,147,0,2,0,47,254,82,5,137,5,238,
+0,10,0,58,0,0,1,2,33,32,3,51,22,22,51,50,55,3,51,50,53,17,1,21,20,51,51,21,
+33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,1,53,52,35,35,53,33,21,35,
+34,21,17,20,22,51,51,21,3,35,19,33,4,74,28,254,151,254,150,15,170,8,82,121,
+192,19,144,27,168,253,227,168,27,253,186,27,168,168,27,2,70,27,168,2,29,168,
+6,2,49,27,168,62,106,82,129,166,170,254,0,5,238,254,235,1,21,101,86,187,250,
+104,137,1,254,254,12,10,137,86,86,137,2,137,140,86,86,138,254,0,1,248,6,140,
+86,86,138,253,119,63,68,10,253,254,1,174,0,2,0,78,0,0,4,133,6,20,0,21,0,30,
+0,0,19,51,17,51,17,33,21,33,17,51,32,17,20,4,35,33,53,51,50,53,17,35,1,51,
+50,54,53,52,38,35,35,78,194,207,1,92,254,164,129,2,37,254,254,246,253,193,
+26,168,194,1,145,139,163,155,161,187,109,4,227,1,49,254,207,100,254,170,254,
+109,190,216,86,139,3,158,251,227,136,161,172,146,0,2,0,47,0,0,4,82,5,39,0,
+22,0,30,0,0,19,17,51,17,33,21,33,17,51,32,22,21,20,6,35,33,53,51,50,53,17,
+35,53,1,50,54,53,52,33,35,17,242,192,1,43,254,213,199,1,1,216,220,204,253,
+133,27,168,195,2,84,139,117,254,244,197,4,16,1,23,254,233,96,254,178,146,
+151,143,170,86,137,2,209,96,252,78,107,123,192,254,90,0,2,0,78,0,0,4,133,
+5,182,0,25,0,38,0,0,51,53,51,50,53,17,52,35,35,53,33,32,17,16,7,23,7,39,6,
+35,35,17,20,51,51,21,3,51,50,55,39,55,23,54,53,52,38,35,35,78,26,168,168,
+26,2,63,1,248,219,113,82,123,102,136,129,168,68,236,109,117,73,129,82,129,
+76,151,167,139,86,147,3,236,139,86,254,84,254,238,119,160,55,176,33,254,166,
+137,86,2,154,30,187,55,184,85,187,180,158,0,2,0,27,254,20,4,121,4,94,0,33,
+0,48,0,0,37,23,7,39,6,35,34,39,35,22,21,21,20,51,51,21,33,53,51,50,53,17,
+52,35,35,53,33,23,51,54,51,32,17,16,5,39,55,23,54,17,16,35,34,6,21,20,22,
+51,50,3,190,101,82,109,57,84,214,99,8,8,168,6,253,217,16,168,168,26,1,102,
+21,8,98,215,1,162,254,147,123,82,121,86,254,150,128,132,148,52,43,143,56,
+156,20,180,212,20,196,138,86,86,148,4,106,140,86,185,205,253,201,254,131,
+45,176,55,174,105,1,10,1,178,196,240,237,203,0,1,0,47,0,0,4,84,5,182,0,30,
+0,0,33,33,53,51,50,53,17,35,53,51,17,52,35,35,53,33,19,35,39,38,38,35,33,
+17,33,21,33,17,20,51,51,2,203,253,131,26,168,225,225,168,26,3,250,12,107,
+8,12,93,100,254,203,1,62,254,194,168,68,86,147,1,216,100,1,168,147,86,254,
+154,72,107,77,253,213,100,254,32,139,0,1,0,47,0,0,3,129,4,74,0,30,0,0,1,17,
+35,39,38,38,35,35,17,51,21,35,17,20,51,51,21,33,53,51,50,53,17,35,53,51,17,
+52,35,35,53,3,129,100,11,17,61,65,209,240,240,168,47,253,166,27,168,195,195,
+168,27,4,74,254,184,68,106,60,254,112,96,254,227,137,86,86,137,1,29,96,1,
+12,140,86,0,1,0,78,254,0,5,0,5,182,0,45,0,0,33,33,53,51,50,53,17,52,35,35,
+53,33,19,35,39,38,38,35,33,17,54,51,32,0,17,16,0,33,34,38,53,52,51,20,51,
+32,17,16,0,35,34,7,17,20,51,51,2,203,253,131,26,168,168,26,3,250,12,107,8,
+12,93,100,254,203,74,109,1,4,1,102,254,210,254,236,208,213,172,249,1,115,
+254,229,212,52,47,168,68,86,147,3,228,147,86,254,154,72,107,77,253,199,12,
+254,178,254,201,254,183,254,171,118,99,148,252,2,41,1,4,1,12,6,254,61,139,
+0,1,0,47,254,20,4,49,4,74,0,43,0,0,1,17,35,39,38,38,35,35,17,54,51,50,0,17,
+16,2,35,32,53,52,51,20,51,50,17,16,33,34,7,17,20,51,51,21,33,53,51,50,53,
+17,52,35,35,53,3,129,100,11,17,61,65,209,69,77,227,1,10,250,209,254,166,152,
+205,249,254,187,73,42,168,47,253,166,27,168,168,27,4,74,254,184,68,106,60,
+254,108,14,254,240,254,248,254,232,254,222,191,131,223,1,207,1,182,8,254,
+235,137,86,86,137,2,137,140,86,0,1,0,0,254,82,8,8,5,195,0,83,0,0,1,38,38,
+35,17,20,51,51,21,33,53,51,50,53,17,34,6,7,3,6,6,35,35,53,51,50,55,19,54,
+54,55,38,0,35,34,7,38,53,52,51,50,22,18,22,51,17,52,35,35,53,33,21,35,34,
+21,17,50,54,18,54,51,50,21,20,7,38,35,34,0,7,22,22,23,19,22,51,51,17,35,52,
+38,39,38,39,5,100,48,91,143,168,6,253,229,6,168,142,92,48,187,69,161,179,
+29,6,140,90,192,53,104,101,44,254,247,109,99,22,98,166,125,169,223,81,94,
+168,6,2,27,6,168,93,81,223,170,125,166,98,22,99,109,254,247,44,100,106,52,
+192,91,165,31,94,72,145,106,72,2,37,92,47,254,57,147,86,86,137,1,209,47,92,
+254,156,132,61,86,164,1,90,95,79,4,28,2,9,115,25,113,129,192,254,66,55,1,
+199,139,86,86,147,254,65,54,1,190,193,129,113,25,115,253,247,28,4,79,95,254,
+166,164,253,252,199,172,63,48,141,0,1,0,6,254,82,7,45,4,86,0,81,0,0,1,38,
+38,35,17,20,51,51,21,33,53,51,50,53,17,34,6,7,7,6,6,35,35,53,51,50,55,55,
+54,55,38,2,35,34,7,38,53,52,51,50,22,18,22,51,53,52,35,35,53,33,21,35,34,
+21,17,50,54,18,54,51,50,21,20,7,38,35,34,2,7,22,23,23,22,51,51,17,35,39,46,
+2,39,4,252,41,121,123,148,6,254,22,9,147,140,106,39,100,56,124,168,72,6,127,
+90,107,98,172,44,226,82,93,22,98,176,112,108,230,73,71,147,9,1,234,6,148,
+73,72,229,108,112,176,98,21,94,82,226,44,173,97,107,85,138,41,100,11,10,79,
+204,63,1,135,87,52,254,205,137,86,86,147,1,41,63,76,198,111,82,86,164,188,
+172,6,25,1,74,115,24,105,125,104,254,170,39,247,140,86,86,129,254,254,40,
+1,85,104,125,105,24,115,254,182,25,6,172,192,152,253,244,149,140,117,80,137,
+255,255,0,92,254,66,4,86,5,203,18,34,1,177,0,0,16,3,3,122,1,150,0,0,255,255,
+0,82,254,66,3,121,4,92,18,34,1,209,0,0,16,3,3,122,1,33,0,0,0,1,0,78,254,82,
+5,174,5,195,0,52,0,0,1,38,35,34,0,7,22,22,23,19,22,51,51,17,35,52,38,39,38,
+39,3,38,38,35,17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,
+17,50,54,18,54,51,50,21,20,4,231,22,98,109,254,247,44,99,107,52,209,72,167,
+31,94,72,145,106,72,187,46,98,155,168,27,253,172,26,168,168,26,2,84,27,168,
+107,82,225,170,125,166,4,184,115,253,247,28,4,79,95,254,133,131,253,252,199,
+172,63,48,141,1,100,88,51,254,57,147,86,86,137,3,246,139,86,86,147,254,65,
+49,1,195,193,129,113,0,1,0,37,254,82,4,244,4,86,0,51,0,0,1,17,20,51,51,21,
+33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,50,54,18,54,51,50,21,20,7,
+38,35,34,2,7,22,23,23,22,51,51,17,35,39,46,2,39,39,38,38,1,178,168,6,253,
+197,37,168,168,37,2,59,6,168,86,73,217,116,110,176,98,21,94,82,226,44,149,
+101,104,88,132,47,101,10,10,83,195,70,101,49,103,2,18,254,205,137,86,86,147,
+2,127,140,86,86,129,254,254,48,1,72,109,125,105,24,115,254,182,25,1,177,186,
+158,253,244,149,143,115,81,135,198,96,43,0,1,0,78,0,0,5,184,5,195,0,57,0,
+0,1,35,17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,51,
+17,51,17,52,55,54,0,51,50,21,20,7,38,35,34,0,7,22,22,23,19,22,51,51,21,35,
+34,38,39,3,38,39,17,35,2,86,119,168,27,253,172,26,168,168,26,2,84,27,168,
+119,123,4,27,1,46,195,166,98,22,99,108,254,248,46,100,105,53,193,91,138,6,
+28,176,164,70,186,54,65,123,2,176,254,57,147,86,86,137,3,246,139,86,86,147,
+254,65,1,76,254,236,2,4,33,2,86,129,113,25,115,253,248,29,4,78,96,254,166,
+164,86,59,134,1,100,103,20,254,196,0,1,0,37,0,0,5,20,4,86,0,56,0,0,1,35,17,
+20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,51,53,51,21,54,
+18,54,51,50,21,20,7,38,35,34,6,6,7,22,23,23,22,51,51,21,35,34,38,39,39,38,
+39,21,35,2,31,109,168,6,253,197,37,168,168,37,2,59,6,168,109,116,30,162,129,
+118,176,98,22,93,57,89,144,32,122,97,107,93,136,6,71,163,145,61,100,54,47,
+116,2,18,254,205,137,86,86,147,2,127,140,86,86,129,254,254,245,219,36,1,47,
+120,125,105,24,115,89,229,37,1,177,188,164,86,77,116,198,108,17,235,0,1,0,
+78,0,0,5,123,5,195,0,58,0,0,1,38,35,34,0,7,22,22,23,19,22,51,51,21,35,34,
+38,39,3,38,38,35,17,20,51,51,21,33,53,51,50,53,17,35,53,51,53,52,35,35,53,
+33,21,35,34,21,21,51,21,35,17,50,54,18,54,51,50,21,20,4,231,22,98,109,254,
+247,44,99,107,52,192,91,139,6,29,179,161,69,187,46,98,155,168,27,253,172,
+26,168,194,194,168,26,2,84,27,168,195,195,107,82,225,170,125,166,4,184,115,
+253,247,28,4,79,95,254,166,164,86,61,132,1,100,88,51,254,57,147,86,86,137,
+3,129,101,16,139,86,86,147,8,101,254,174,49,1,195,193,129,113,0,1,0,37,0,
+0,4,215,6,20,0,53,0,0,1,50,54,18,54,51,50,21,20,7,38,35,34,2,7,22,23,23,22,
+51,51,21,35,34,38,39,39,38,38,35,17,20,51,51,21,33,53,51,50,53,17,35,53,51,
+53,52,35,35,53,33,21,33,21,33,1,178,86,73,217,116,110,176,98,21,94,82,226,
+44,154,96,107,93,136,6,72,165,143,60,101,43,95,126,168,6,253,197,37,168,187,
+187,168,17,1,121,1,8,254,248,2,113,48,1,72,109,125,105,24,115,254,182,25,
+2,176,188,164,86,79,114,198,84,55,254,205,137,86,86,147,3,213,97,20,139,86,
+245,97,0,1,0,41,0,0,6,41,5,195,0,53,0,0,1,38,35,34,0,7,22,22,23,19,22,51,
+51,21,35,34,38,39,3,38,38,35,17,20,51,51,21,33,53,51,50,53,17,35,34,6,7,7,
+35,55,33,21,35,34,21,17,50,54,18,54,51,50,21,20,5,150,22,99,109,254,247,44,
+99,107,52,192,91,139,6,29,179,161,69,187,46,98,155,168,27,253,172,27,167,
+161,73,56,15,4,96,8,3,31,27,168,107,82,225,170,125,166,4,184,115,253,247,
+28,4,79,95,254,166,164,86,61,132,1,100,88,51,254,57,147,86,86,137,4,121,53,
+76,22,245,86,147,254,65,49,1,195,193,129,113,0,1,0,41,0,0,5,150,4,86,0,52,
+0,0,33,34,38,39,39,38,38,35,17,20,51,51,21,33,53,51,50,53,17,35,34,6,7,7,
+35,55,33,21,35,34,21,17,50,54,18,54,51,50,21,20,7,38,35,34,2,7,22,23,23,22,
+51,51,21,5,78,163,145,61,100,44,103,117,168,6,253,196,37,168,151,73,56,15,
+4,92,8,2,238,6,168,79,76,227,108,112,176,98,22,93,82,226,44,153,96,107,93,
+136,7,77,116,198,88,51,254,205,137,86,86,147,3,5,53,76,23,244,86,129,254,
+254,42,1,83,104,125,105,24,115,254,182,25,2,176,188,164,86,0,1,0,78,254,82,
+6,25,5,182,0,46,0,0,37,17,35,16,33,35,53,51,50,53,17,33,17,20,51,51,21,33,
+53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,33,17,52,35,35,53,33,21,35,34,
+21,17,20,51,6,25,95,254,199,203,27,168,253,102,168,27,253,172,26,168,168,
+26,2,84,27,168,2,154,168,27,2,84,26,168,168,86,253,252,1,174,86,147,1,224,
+254,32,147,86,86,147,3,236,139,86,86,147,254,98,1,158,147,86,86,147,252,28,
+147,0,1,0,47,254,82,5,82,4,74,0,47,0,0,33,53,51,50,53,17,33,17,20,51,51,21,
+33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,33,17,52,35,35,53,33,21,35,
+34,21,17,20,51,51,17,35,39,2,35,3,33,6,168,253,227,168,6,253,207,27,168,168,
+27,2,49,6,168,2,29,168,6,2,49,27,168,152,43,100,11,21,177,86,137,1,37,254,
+219,137,86,86,137,2,137,140,86,86,138,254,248,1,6,140,86,86,138,253,123,135,
+253,244,149,1,25,0,1,0,78,0,0,6,221,5,182,0,47,0,0,37,20,51,51,21,33,53,51,
+50,53,17,33,17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,
+33,17,52,35,35,53,33,19,35,39,46,2,35,35,5,72,168,26,253,172,27,168,253,102,
+168,27,253,172,26,168,168,26,2,84,27,168,2,154,168,27,3,31,8,104,15,8,22,
+53,60,143,223,137,86,86,147,1,224,254,32,147,86,86,147,3,236,139,86,86,147,
+254,98,1,158,147,86,254,164,125,40,50,39,0,1,0,47,0,0,6,23,4,74,0,46,0,0,
+37,20,51,51,21,33,53,51,50,53,17,33,17,20,51,51,21,33,53,51,50,53,17,52,35,
+35,53,33,21,35,34,21,17,33,17,52,35,35,53,33,19,35,39,38,38,35,35,4,143,168,
+27,253,207,6,168,253,227,168,6,253,207,27,168,168,27,2,49,6,168,2,29,168,
+6,2,237,9,101,8,6,50,83,144,223,137,86,86,137,1,37,254,219,137,86,86,137,
+2,137,140,86,86,138,254,248,1,6,140,86,254,209,82,68,61,0,1,0,78,254,0,8,
+43,5,182,0,54,0,0,19,33,21,35,34,21,17,54,51,32,0,17,16,0,33,34,38,53,52,
+51,20,51,32,17,16,0,35,34,7,17,20,51,51,21,33,53,51,50,53,17,33,17,20,51,
+51,21,33,53,51,50,53,17,52,35,35,78,5,127,27,168,74,109,1,4,1,102,254,210,
+254,236,208,213,172,249,1,115,254,229,212,52,47,168,27,253,172,26,168,253,
+164,168,27,253,172,26,168,168,26,5,182,86,147,254,74,12,254,178,254,201,254,
+183,254,171,118,99,148,252,2,41,1,4,1,12,6,254,59,137,86,86,147,4,103,251,
+153,147,86,86,147,3,236,139,0,1,0,47,254,20,6,229,4,74,0,52,0,0,1,21,35,34,
+21,17,54,51,50,0,17,16,2,35,32,53,52,51,20,51,50,17,16,33,34,7,17,20,51,51,
+21,33,53,51,50,53,17,33,17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,5,41,
+27,168,69,77,228,1,9,250,208,254,166,151,205,250,254,186,73,42,168,27,253,
+207,6,168,254,12,168,6,253,207,27,168,168,27,4,74,86,138,254,238,14,254,240,
+254,248,254,232,254,222,191,131,223,1,207,1,182,8,254,235,137,86,86,137,3,
+13,252,243,137,86,86,137,2,137,140,86,0,2,0,115,255,172,5,186,5,205,0,40,
+0,48,0,0,37,22,51,50,55,22,21,20,6,35,34,39,6,35,32,0,17,16,0,33,50,21,20,
+7,38,35,32,17,16,33,50,55,38,17,16,18,51,50,18,17,16,5,54,17,16,35,34,17,
+16,4,94,71,87,96,51,43,108,84,180,138,98,98,254,201,254,178,1,79,1,56,233,
+37,93,103,254,92,1,162,58,30,209,202,185,183,194,254,123,162,150,160,78,51,
+61,20,48,42,62,88,24,1,143,1,100,1,101,1,137,99,52,17,57,253,127,253,125,
+8,231,1,66,1,5,1,28,254,231,254,254,254,120,93,143,1,80,1,178,254,84,254,
+220,0,2,0,113,255,195,4,197,4,94,0,39,0,47,0,0,37,22,51,50,55,22,21,20,35,
+34,39,6,35,32,17,16,33,50,21,20,7,38,35,34,6,21,20,22,51,50,55,38,17,52,54,
+51,50,22,21,16,5,54,17,16,35,34,17,20,3,195,52,68,62,39,37,154,126,124,84,
+100,253,248,2,16,176,33,85,64,168,156,159,169,27,28,159,174,145,141,168,254,
+197,117,113,119,68,23,35,17,34,90,63,22,2,59,2,55,78,39,24,33,214,245,244,
+221,4,150,1,4,172,196,192,172,254,214,54,96,1,0,1,2,254,252,215,255,255,0,
+117,254,66,4,164,5,203,18,34,0,38,0,0,16,3,3,122,2,20,0,0,255,255,0,113,254,
+66,3,160,4,94,18,34,0,70,0,0,16,3,3,122,1,139,0,0,0,1,0,41,254,82,4,190,5,
+182,0,26,0,0,37,20,51,51,17,35,16,33,35,53,51,50,53,17,35,34,7,7,35,19,33,
+19,35,39,38,35,35,2,215,176,41,94,254,211,242,47,168,196,148,20,11,106,10,
+4,129,10,106,10,19,151,199,223,137,253,252,1,174,86,137,4,113,168,88,1,102,
+254,154,88,168,0,1,0,41,254,82,4,55,4,74,0,29,0,0,1,19,35,39,38,38,35,35,
+17,20,51,51,17,35,39,2,35,33,53,51,50,53,17,35,34,6,7,7,35,19,4,43,12,100,
+10,12,53,79,168,158,57,100,10,19,174,254,213,27,168,170,66,60,17,11,100,12,
+4,74,254,184,68,83,83,252,249,135,253,244,149,1,25,86,137,3,13,61,105,68,
+1,72,255,255,255,246,0,0,5,6,5,182,18,2,0,60,0,0,0,1,0,8,254,23,4,156,4,74,
+0,42,0,0,19,53,33,21,35,34,21,20,23,19,22,23,51,54,55,19,54,53,52,35,35,53,
+33,21,35,34,6,7,1,17,20,51,51,21,33,53,51,50,53,17,1,38,35,8,2,0,26,123,16,
+139,72,18,7,7,95,147,19,135,15,1,183,25,64,56,36,254,193,168,26,253,187,26,
+168,254,185,40,106,3,244,86,86,99,29,46,254,125,199,109,29,252,1,143,52,36,
+101,86,86,67,93,252,182,254,246,147,86,86,139,1,12,3,131,109,0,1,255,246,
+0,0,5,6,5,182,0,48,0,0,33,53,51,50,53,53,33,53,33,53,1,38,35,35,53,33,21,
+35,34,21,20,23,19,22,23,54,55,55,54,53,52,35,35,53,33,21,35,34,7,1,21,33,
+21,33,21,20,51,51,21,1,70,47,168,254,225,1,31,254,133,62,84,26,2,51,76,90,
+37,151,56,47,19,104,131,37,123,60,1,244,24,80,90,254,168,1,30,254,226,167,
+48,86,137,185,100,102,2,146,108,86,86,65,41,68,254,238,102,132,49,185,235,
+66,57,90,86,86,159,253,161,102,100,175,147,86,0,1,0,8,254,23,4,156,4,74,0,
+50,0,0,5,21,20,51,51,21,33,53,51,50,53,53,33,53,33,53,1,38,35,35,53,33,21,
+35,34,21,20,23,19,22,23,51,54,55,19,54,53,52,35,35,53,33,21,35,34,6,7,1,21,
+33,21,2,168,168,26,253,187,26,168,254,252,1,4,254,185,40,106,6,2,0,26,123,
+16,139,72,18,7,7,95,147,19,135,15,1,183,25,64,56,36,254,193,1,6,96,160,147,
+86,86,139,168,96,4,3,131,109,86,86,99,29,46,254,125,199,109,29,252,1,143,
+52,36,101,86,86,67,93,252,182,10,96,0,1,0,16,254,82,5,106,5,182,0,55,0,0,
+1,53,33,21,35,34,7,1,1,22,23,51,17,35,16,33,35,53,51,50,53,52,39,3,3,6,21,
+20,51,51,21,33,53,51,50,54,55,1,1,38,35,35,53,33,21,35,34,21,20,23,19,19,
+54,53,52,35,3,70,1,192,18,101,102,254,215,1,96,89,116,61,94,254,197,195,11,
+122,67,203,227,53,133,6,254,24,13,66,84,63,1,86,254,174,66,110,27,2,43,6,
+117,49,185,194,51,110,5,96,86,86,147,254,84,253,200,143,4,253,252,1,174,86,
+68,33,108,1,70,254,176,78,57,64,86,86,53,90,1,234,2,37,108,86,86,59,43,78,
+254,213,1,39,78,47,59,0,1,0,10,254,82,4,182,4,74,0,57,0,0,1,53,33,21,35,34,
+6,7,3,1,22,51,51,17,35,39,2,35,35,53,51,50,53,52,39,39,7,6,21,20,51,51,21,
+33,53,51,50,54,55,1,1,38,35,35,53,33,21,35,34,21,20,23,23,55,54,53,52,35,
+2,158,1,192,18,69,81,57,211,1,45,75,101,47,100,10,19,180,252,10,123,78,137,
+143,55,127,6,254,24,19,73,88,62,1,2,254,254,80,96,27,2,8,6,117,48,135,106,
+51,110,3,244,86,86,56,75,254,231,254,107,101,253,244,149,1,25,86,68,37,104,
+184,200,77,52,64,86,86,52,79,1,78,1,96,109,86,86,60,27,67,184,153,74,51,60,
+0,1,0,41,254,82,6,229,5,182,0,38,0,0,1,16,33,33,53,51,50,53,17,35,34,7,7,
+35,19,33,19,35,39,38,35,35,17,33,17,52,35,35,53,33,21,35,34,21,17,20,51,51,
+17,6,135,254,197,251,186,27,168,131,148,20,11,106,10,3,223,11,107,10,19,151,
+102,2,174,168,17,2,74,27,168,168,41,254,82,1,174,86,139,4,111,168,88,1,102,
+254,154,88,168,251,22,4,103,147,86,86,137,252,18,147,253,252,0,1,0,41,254,
+82,6,86,4,74,0,41,0,0,1,35,39,2,35,33,53,51,50,53,17,35,34,6,7,7,35,19,33,
+19,35,39,38,38,35,35,17,33,17,52,35,35,53,33,21,35,34,21,17,20,23,51,6,86,
+100,11,21,177,251,196,7,167,108,66,60,17,11,100,12,3,125,12,100,10,12,54,
+77,109,2,127,168,12,2,55,27,168,148,47,254,82,149,1,25,86,139,3,11,61,105,
+68,1,72,254,184,68,84,82,252,114,3,12,138,86,86,138,253,123,130,5,0,1,0,43,
+254,82,5,205,5,182,0,43,0,0,1,6,35,32,17,17,52,35,35,53,33,21,35,34,21,17,
+20,51,50,55,17,52,35,35,53,33,21,35,34,21,17,20,22,51,51,17,35,16,33,35,53,
+51,50,53,4,45,245,206,254,132,168,27,2,84,27,168,240,165,220,168,27,2,84,
+26,168,68,100,41,94,254,211,216,27,168,2,152,127,1,114,1,74,139,86,86,147,
+254,192,241,106,1,199,147,86,86,147,252,28,75,72,253,252,1,174,86,147,0,1,
+0,31,254,82,4,240,4,74,0,44,0,0,33,53,51,50,53,17,6,35,34,38,53,53,52,35,
+35,53,33,21,35,34,21,21,20,51,50,55,17,52,35,35,53,33,21,35,34,21,17,20,51,
+51,17,35,39,2,35,2,170,27,168,210,178,134,150,168,6,2,28,6,168,164,139,177,
+168,7,2,50,27,168,148,47,101,10,19,180,86,137,1,35,137,140,122,233,140,86,
+86,138,215,147,90,1,14,140,86,86,138,253,117,129,253,244,149,1,25,0,1,0,43,
+0,0,5,190,5,182,0,47,0,0,1,7,32,17,17,52,35,35,53,33,21,35,34,21,17,20,51,
+51,17,51,17,54,55,17,52,35,35,53,33,21,35,34,21,17,20,51,51,21,33,53,51,50,
+53,17,6,7,17,35,2,182,73,254,129,168,27,2,84,27,168,240,10,123,100,152,168,
+27,2,84,26,168,168,26,253,172,27,168,171,81,123,2,27,3,1,115,1,74,139,86,
+86,147,254,192,241,1,92,254,178,19,73,1,199,147,86,86,147,252,18,137,86,86,
+147,1,175,84,21,254,166,0,1,0,31,0,0,4,240,4,74,0,49,0,0,33,53,51,50,53,17,
+6,7,21,35,53,6,35,34,38,53,53,52,35,35,53,33,21,35,34,21,21,20,51,51,53,51,
+21,54,55,17,52,35,35,53,33,21,35,34,21,17,20,51,51,21,2,170,27,168,124,59,
+116,43,46,134,150,168,6,2,28,6,168,164,17,116,63,120,168,7,2,50,27,168,168,
+27,86,137,1,35,77,21,234,201,6,140,122,233,140,86,86,138,215,147,231,215,
+16,58,1,14,140,86,86,138,253,117,137,86,0,1,0,78,0,0,5,225,5,182,0,39,0,0,
+1,54,51,32,17,17,20,51,51,21,33,53,51,50,53,17,52,35,34,7,17,20,51,51,21,
+33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,1,223,246,205,1,125,168,26,253,
+172,27,168,240,165,220,168,27,253,172,26,168,168,26,2,84,27,168,3,31,127,
+254,141,254,182,139,86,86,147,1,64,242,107,254,57,147,86,86,147,3,238,137,
+86,86,147,0,1,0,47,0,0,5,0,4,74,0,40,0,0,1,21,35,34,21,17,54,51,50,22,21,
+21,20,51,51,21,33,53,51,50,53,53,52,35,34,7,17,20,51,51,21,33,53,51,50,53,
+17,52,35,35,53,2,117,27,168,210,177,136,149,168,6,253,227,6,168,163,139,177,
+168,6,253,207,27,168,168,27,4,74,86,138,254,222,137,142,120,234,139,86,86,
+137,215,148,90,254,241,139,86,86,137,2,139,138,86,0,2,0,20,255,236,6,6,5,
+205,0,27,0,32,0,0,1,22,21,20,4,35,32,3,32,53,52,51,50,23,6,21,20,51,18,0,
+33,32,17,21,33,18,33,50,1,33,2,33,32,5,168,16,254,238,180,253,146,32,254,
+176,140,38,29,22,153,20,1,78,1,15,2,47,252,66,22,1,160,210,253,120,2,229,
+5,254,169,254,156,1,18,28,33,99,134,2,194,211,160,23,42,62,127,1,70,1,100,
+253,28,59,253,199,2,174,2,59,0,2,0,20,255,236,4,182,4,94,0,29,0,34,0,0,1,
+32,53,52,51,50,23,6,21,20,22,51,18,33,50,22,21,21,33,18,33,50,55,22,21,20,
+6,35,34,2,19,33,16,35,34,1,70,254,206,127,39,29,22,54,83,43,1,151,204,222,
+253,86,7,1,42,193,100,39,199,161,219,254,200,1,215,223,225,2,23,198,148,23,
+46,54,60,53,1,217,254,235,94,254,86,143,21,49,75,127,1,34,1,119,1,107,0,2,
+0,20,254,82,6,6,5,205,0,32,0,37,0,0,1,22,21,20,5,6,17,35,52,38,39,36,3,32,
+53,52,51,50,23,6,21,20,51,18,0,33,32,17,21,33,18,33,50,1,33,2,33,32,5,168,
+16,254,242,152,94,97,132,254,167,18,254,176,140,38,29,22,153,20,1,78,1,15,
+2,47,252,66,22,1,160,210,253,120,2,229,5,254,169,254,156,1,18,28,33,149,64,
+100,254,182,181,219,63,149,1,248,211,160,23,42,62,127,1,70,1,100,253,28,59,
+253,199,2,174,2,59,0,2,0,20,254,82,4,182,4,94,0,35,0,40,0,0,5,6,6,21,35,52,
+38,39,36,17,32,53,52,51,50,23,6,21,20,22,51,18,33,50,22,21,21,33,18,33,50,
+55,22,21,20,6,1,33,16,35,34,3,174,63,37,94,60,106,255,0,254,206,127,39,29,
+22,54,83,43,1,151,204,222,253,86,7,1,42,193,100,39,117,253,252,1,215,223,
+225,4,52,158,216,216,177,62,126,1,128,198,148,23,46,54,60,53,1,217,254,235,
+94,254,86,143,21,49,54,110,2,115,1,107,255,255,0,78,0,0,2,162,5,182,18,2,
+0,44,0,0,255,255,0,0,0,0,7,213,7,64,18,34,1,176,0,0,16,3,2,52,1,156,1,82,
+255,255,0,6,0,0,7,4,5,238,18,34,1,208,0,0,16,3,2,52,1,55,0,0,0,1,0,78,254,
+0,5,74,5,195,0,55,0,0,1,38,35,34,6,2,7,4,0,17,16,0,33,34,38,53,52,51,20,51,
+32,17,16,0,35,34,7,17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,
+34,21,17,50,54,18,54,51,50,21,20,4,231,22,98,66,110,180,36,1,20,1,75,254,
+210,254,236,207,215,172,250,1,115,254,229,213,92,76,168,27,253,172,26,168,
+168,26,2,84,27,168,107,82,225,170,125,166,4,184,115,132,254,160,36,11,254,
+172,254,218,254,183,254,171,118,99,148,252,2,41,1,4,1,12,16,254,79,147,86,
+86,137,3,246,139,86,86,147,254,65,49,1,195,193,129,113,0,1,0,37,254,20,4,
+178,4,86,0,54,0,0,5,20,51,32,17,52,38,35,34,7,17,20,51,51,21,33,53,51,50,
+53,17,52,35,35,53,33,21,35,34,21,17,50,54,18,54,51,50,21,20,7,38,35,34,2,
+7,51,50,0,17,16,0,35,32,53,52,1,252,205,1,35,207,160,134,69,168,6,253,197,
+37,168,168,37,2,49,6,158,66,74,222,108,112,176,98,22,93,82,199,49,19,231,
+1,47,254,233,221,254,166,170,223,1,211,221,231,22,254,231,137,86,86,147,2,
+127,140,86,86,129,254,254,50,1,75,104,125,105,24,115,254,217,37,254,224,254,
+243,254,233,254,217,191,131,0,1,0,0,254,82,5,137,5,182,0,40,0,0,55,20,22,
+51,50,54,18,18,53,52,35,35,53,33,21,35,34,21,17,20,22,51,51,21,3,35,19,33,
+53,51,50,53,17,33,2,2,6,35,34,53,52,90,57,43,59,91,104,62,164,31,4,25,27,
+168,67,103,82,131,168,170,253,244,27,167,254,179,18,130,181,132,164,254,35,
+61,90,1,116,2,28,132,84,86,86,147,252,28,71,68,10,253,254,1,174,86,147,4,
+103,254,141,252,252,231,143,125,0,1,0,0,254,82,5,14,4,74,0,39,0,0,37,51,50,
+53,17,33,2,2,6,35,34,53,52,51,20,22,51,50,54,18,53,52,35,35,53,33,21,35,34,
+21,17,20,22,51,51,21,3,35,19,33,2,166,6,168,254,248,34,121,154,115,164,90,
+57,43,71,105,105,168,27,3,195,27,168,62,106,82,129,166,170,254,21,86,137,
+3,13,254,190,253,239,167,143,125,35,61,142,1,225,104,127,86,86,138,253,130,
+69,73,10,253,254,1,174,0,1,0,78,254,20,6,10,5,182,0,44,0,0,37,16,33,32,53,
+52,55,22,51,32,17,17,33,17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,
+35,34,21,17,33,17,52,35,35,53,33,21,35,34,21,5,72,253,186,254,96,123,100,
+205,1,107,253,102,168,27,253,172,26,168,168,26,2,84,27,168,2,154,168,27,2,
+84,26,168,172,253,104,181,108,15,205,2,51,2,31,254,32,147,86,86,147,3,236,
+139,86,86,147,254,98,1,158,147,86,86,147,0,1,0,47,254,20,5,82,4,74,0,46,0,
+0,1,21,35,34,21,17,20,2,35,34,38,53,52,55,22,51,32,17,17,33,17,20,51,51,21,
+33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,33,17,52,35,35,53,5,82,27,
+168,232,214,176,201,117,73,183,1,2,253,227,168,6,253,207,27,168,168,27,2,
+49,6,168,2,29,168,6,4,74,86,138,252,175,251,254,246,98,81,106,12,200,1,162,
+1,237,254,219,137,86,86,137,2,137,140,86,86,138,254,248,1,6,140,86,0,1,0,
+78,254,82,6,68,5,182,0,47,0,0,37,20,22,51,51,21,3,35,19,33,53,51,50,53,17,
+33,17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,33,17,52,
+35,35,53,33,21,35,34,21,5,72,66,104,82,131,168,170,253,243,27,168,253,102,
+168,27,253,172,26,168,168,26,2,84,27,168,2,154,168,27,2,84,26,168,236,71,
+71,10,253,254,1,174,86,147,1,224,254,32,147,86,86,147,3,236,139,86,86,147,
+254,98,1,158,147,86,86,147,0,1,0,47,254,82,5,137,4,74,0,47,0,0,1,21,35,34,
+21,17,20,22,51,51,21,3,35,19,33,53,51,50,53,17,33,17,20,51,51,21,33,53,51,
+50,53,17,52,35,35,53,33,21,35,34,21,17,33,17,52,35,35,53,5,82,27,168,62,106,
+82,129,166,170,254,21,6,168,253,227,168,6,253,207,27,168,168,27,2,49,6,168,
+2,29,168,6,4,74,86,138,253,130,69,73,10,253,254,1,174,86,137,1,37,254,219,
+137,86,86,137,2,137,140,86,86,138,254,248,1,6,140,86,0,1,0,43,254,82,5,190,
+5,182,0,42,0,0,1,6,35,32,17,17,52,35,35,53,33,21,35,34,21,17,20,51,50,55,
+17,52,35,35,53,33,21,35,34,21,17,20,51,51,21,35,32,17,35,17,51,50,55,4,45,
+245,206,254,132,168,27,2,84,27,168,240,165,220,168,27,2,84,26,168,168,26,
+200,254,196,94,41,165,3,2,152,127,1,114,1,74,139,86,86,147,254,192,241,106,
+1,199,147,86,86,147,252,18,137,86,254,82,2,4,147,0,1,0,31,254,82,4,240,4,
+74,0,44,0,0,33,34,3,7,35,17,51,50,53,17,6,35,34,38,53,53,52,35,35,53,33,21,
+35,34,21,21,20,51,50,55,17,52,35,35,53,33,21,35,34,21,17,20,51,51,21,3,215,
+172,18,11,100,47,148,210,178,134,150,168,6,2,28,6,168,164,139,177,168,7,2,
+50,27,168,168,27,254,231,149,2,12,129,1,35,137,140,122,233,140,86,86,138,
+215,147,90,1,14,140,86,86,138,253,117,137,86,0,1,0,78,254,82,7,109,5,182,
+0,42,0,0,37,20,22,51,51,21,3,35,19,33,53,51,50,54,53,17,1,35,1,17,20,22,51,
+51,21,33,53,51,50,53,17,52,35,35,53,33,1,1,33,21,35,34,21,6,113,64,106,82,
+132,167,170,254,38,7,87,60,254,43,111,254,37,58,90,6,254,39,26,168,168,26,
+1,211,1,168,1,164,1,198,26,168,225,63,68,10,253,254,1,174,86,62,67,4,70,250,
+227,5,25,251,208,77,70,86,86,137,3,246,139,86,251,109,4,147,86,147,0,1,0,
+47,254,82,6,84,4,74,0,42,0,0,37,51,50,53,17,35,1,35,1,35,17,20,51,51,21,33,
+53,51,50,53,17,52,35,35,53,33,1,1,33,21,35,34,21,17,20,22,51,51,21,3,35,19,
+33,3,236,6,168,15,254,156,94,254,166,15,168,6,254,33,27,168,168,27,1,182,
+1,68,1,82,1,162,27,168,62,106,82,129,166,170,254,21,86,137,2,144,252,145,
+3,111,253,112,137,86,86,137,2,137,140,86,252,196,3,60,86,138,253,119,63,68,
+10,253,254,1,174,255,255,0,78,0,0,2,162,5,182,18,2,0,44,0,0,255,255,0,0,0,
+0,5,164,7,64,18,34,0,36,0,0,16,3,2,52,0,137,1,82,255,255,0,102,255,236,4,
+41,5,238,18,34,0,68,0,0,16,2,2,52,230,0,255,255,0,0,0,0,5,164,7,70,18,34,
+0,36,0,0,16,3,0,106,0,133,1,82,255,255,0,102,255,236,4,41,5,244,18,34,0,68,
+0,0,16,2,0,106,222,0,255,255,0,0,0,0,7,70,5,182,18,2,0,136,0,0,255,255,0,
+102,255,236,6,84,4,94,18,2,0,168,0,0,255,255,0,78,0,0,4,166,7,64,18,34,0,
+40,0,0,16,3,2,52,0,49,1,82,255,255,0,113,255,236,3,225,5,238,18,34,0,72,0,
+0,16,2,2,52,226,0,0,2,0,111,255,236,5,16,5,205,0,18,0,23,0,0,19,38,53,52,
+36,51,32,0,17,16,0,33,32,17,53,33,2,33,34,1,33,18,33,32,225,16,1,12,166,1,
+59,1,82,254,175,254,223,253,209,3,190,26,254,100,205,2,131,253,27,9,1,83,
+1,97,4,186,28,34,91,122,254,116,254,152,254,165,254,110,2,249,60,2,35,253,
+104,253,174,0,2,0,102,255,236,3,215,4,94,0,18,0,23,0,0,19,33,2,33,34,7,38,
+53,52,54,51,50,18,17,16,33,34,38,53,5,33,16,51,50,102,2,170,7,254,214,191,
+102,39,198,163,223,252,254,57,203,223,2,166,254,41,223,226,2,51,1,170,143,
+20,49,74,129,254,215,254,248,253,191,253,236,16,254,149,255,255,0,111,255,
+236,5,16,7,70,18,34,2,220,0,0,16,3,0,106,0,94,1,82,255,255,0,102,255,236,
+3,215,5,244,18,34,2,221,0,0,16,2,0,106,202,0,255,255,0,0,0,0,7,213,7,70,18,
+34,1,176,0,0,16,3,0,106,1,156,1,82,255,255,0,6,0,0,7,4,5,244,18,34,1,208,
+0,0,16,3,0,106,1,55,0,0,255,255,0,92,255,233,4,86,7,70,18,34,1,177,0,0,16,
+3,0,106,0,4,1,82,255,255,0,82,255,236,3,121,5,244,18,34,1,209,0,0,16,2,0,
+106,144,0,0,1,0,92,255,233,4,86,5,182,0,30,0,0,1,1,33,34,6,7,7,35,19,33,21,
+1,4,17,20,4,35,34,38,53,52,51,20,22,51,32,17,52,38,35,35,1,115,1,200,254,
+123,96,64,10,2,86,10,3,89,254,8,2,55,254,216,253,225,244,172,157,138,1,68,
+190,173,149,3,37,1,235,45,82,18,1,55,84,253,228,16,254,108,211,230,146,108,
+152,124,169,1,74,143,158,0,1,0,82,254,20,3,240,4,74,0,30,0,0,1,1,33,34,6,
+7,7,35,19,33,21,1,4,17,20,0,35,34,38,53,52,51,20,22,51,50,54,53,16,33,35,
+1,96,1,148,254,141,65,57,11,4,101,13,3,26,254,70,1,240,254,221,232,199,204,
+151,133,117,154,172,254,102,47,1,184,1,238,49,80,29,1,66,101,253,236,28,254,
+91,241,254,245,110,91,131,98,135,204,189,1,100,255,255,0,78,0,0,6,31,6,185,
+18,34,1,178,0,0,16,3,1,77,1,53,1,82,255,255,0,47,0,0,5,82,5,103,18,34,1,210,
+0,0,16,3,1,77,0,193,0,0,255,255,0,78,0,0,6,31,7,70,18,34,1,178,0,0,16,3,0,
+106,0,231,1,82,255,255,0,47,0,0,5,82,5,244,18,34,1,210,0,0,16,2,0,106,115,
+0,255,255,0,115,255,236,5,123,7,70,18,34,0,50,0,0,16,3,0,106,0,164,1,82,255,
+255,0,113,255,236,4,45,5,244,18,34,0,82,0,0,16,2,0,106,249,0,0,3,0,115,255,
+236,5,123,5,205,0,11,0,16,0,21,0,0,5,32,0,17,16,0,33,32,0,17,16,0,1,33,2,
+33,32,1,33,18,33,32,2,248,254,201,254,178,1,79,1,56,1,43,1,86,254,169,253,
+50,3,66,25,254,123,254,113,3,47,252,186,7,1,157,1,152,20,1,143,1,100,1,101,
+1,137,254,111,254,161,254,162,254,109,3,67,2,47,253,107,253,145,0,3,0,113,
+255,236,4,45,4,94,0,7,0,12,0,17,0,0,5,32,17,16,33,32,17,16,1,33,2,33,32,1,
+33,18,33,32,2,76,254,37,1,225,1,219,253,10,2,47,18,254,250,254,250,2,32,253,
+205,9,1,18,1,15,20,2,59,2,55,253,201,253,197,2,129,1,133,254,20,254,80,255,
+255,0,115,255,236,5,123,7,70,18,34,2,236,0,0,16,3,0,106,0,170,1,82,255,255,
+0,113,255,236,4,45,5,244,18,34,2,237,0,0,16,2,0,106,0,0,255,255,0,92,255,
+236,4,115,7,70,18,34,1,199,0,0,16,3,0,106,0,2,1,82,255,255,0,82,255,236,3,
+125,5,244,18,34,1,231,0,0,16,2,0,106,155,0,255,255,0,0,0,0,5,102,6,185,18,
+34,1,189,0,0,16,3,1,77,0,215,1,82,255,255,0,8,254,20,4,133,5,103,18,34,0,
+92,0,0,16,2,1,77,102,0,255,255,0,0,0,0,5,102,7,70,18,34,1,189,0,0,16,3,0,
+106,0,141,1,82,255,255,0,8,254,20,4,133,5,244,18,34,0,92,0,0,16,2,0,106,29,
+0,255,255,0,0,0,0,5,102,7,115,18,34,1,189,0,0,16,3,1,83,0,205,1,82,255,255,
+0,8,254,20,4,133,6,33,18,34,0,92,0,0,16,2,1,83,123,0,255,255,0,43,0,0,5,190,
+7,70,18,34,1,193,0,0,16,3,0,106,0,184,1,82,255,255,0,31,0,0,4,240,5,244,18,
+34,1,225,0,0,16,2,0,106,66,0,0,1,0,78,254,82,4,84,5,182,0,25,0,0,51,53,51,
+50,53,17,52,35,35,53,33,17,35,39,38,38,35,33,17,20,51,51,17,35,16,33,78,26,
+168,168,26,4,6,107,8,12,96,97,254,203,158,78,94,254,196,86,147,3,228,147,
+86,254,154,72,109,75,251,153,147,253,252,1,174,0,1,0,47,254,82,3,129,4,74,
+0,26,0,0,51,53,51,50,53,17,52,35,35,53,33,17,35,39,38,38,35,35,17,20,23,51,
+17,35,39,2,35,47,27,168,168,27,3,82,100,11,17,61,65,209,148,67,100,10,19,
+180,86,137,2,137,140,86,254,184,68,106,60,252,249,130,5,253,244,149,1,25,
+255,255,0,78,0,0,6,244,7,70,18,34,1,197,0,0,16,3,0,106,1,82,1,82,255,255,
+0,47,0,0,6,88,5,244,18,34,1,229,0,0,16,3,0,106,1,0,0,0,255,255,0,47,254,109,
+4,84,5,182,18,34,2,150,0,0,16,3,3,123,1,84,0,0,255,255,0,47,254,109,3,129,
+4,74,18,34,2,151,0,0,16,3,3,123,1,18,0,0,255,255,0,16,254,109,5,56,5,182,
+18,34,0,59,0,0,16,3,3,123,3,193,0,0,255,255,0,10,254,109,4,150,4,74,18,34,
+0,91,0,0,16,3,3,123,3,31,0,0,0,1,0,16,0,0,5,55,5,182,0,58,0,0,1,53,33,21,
+35,34,7,1,33,21,33,1,22,51,51,21,33,53,51,50,53,52,39,3,3,6,21,20,51,51,21,
+33,53,51,50,54,55,1,33,53,33,1,38,35,35,53,33,21,35,34,21,20,23,19,19,54,
+53,52,35,3,70,1,192,18,101,102,254,225,1,170,254,127,1,70,68,96,26,253,215,
+11,122,67,203,227,53,133,6,254,24,13,66,84,63,1,84,254,98,1,100,254,234,67,
+109,27,2,43,6,117,49,185,194,51,110,5,96,86,86,147,254,100,100,253,246,109,
+86,86,68,33,108,1,70,254,176,78,57,64,86,86,53,90,1,232,100,1,195,108,86,
+86,59,43,78,254,213,1,39,78,47,59,0,1,0,10,0,0,4,150,4,74,0,60,0,0,1,53,33,
+21,35,34,6,7,7,33,21,33,1,22,51,51,21,33,53,51,50,53,52,39,39,7,6,21,20,51,
+51,21,33,53,51,50,54,55,1,39,33,53,33,39,38,35,35,53,33,21,35,34,21,20,23,
+23,55,54,53,52,35,2,158,1,192,18,69,81,57,174,1,76,254,178,1,10,81,83,27,
+253,239,10,123,78,137,143,55,127,6,254,24,19,73,88,62,1,2,2,254,160,1,26,
+186,80,96,27,2,8,6,117,48,135,106,51,110,3,244,86,86,56,75,232,96,254,154,
+109,86,86,68,37,104,184,200,77,52,64,86,86,52,79,1,78,2,96,254,109,86,86,
+60,27,67,184,153,74,51,60,0,2,0,80,0,0,4,135,5,182,0,21,0,30,0,0,1,21,35,
+34,21,17,20,51,51,21,33,32,17,52,36,33,51,17,52,35,35,53,19,35,34,6,21,20,
+22,51,51,4,135,26,168,168,26,253,182,254,19,1,31,1,16,119,168,68,236,109,
+187,161,154,163,140,5,182,86,147,252,20,139,86,1,133,199,221,1,174,137,86,
+253,19,146,172,160,137,255,255,0,113,255,236,4,197,6,20,18,2,0,71,0,0,0,2,
+0,80,255,236,6,225,5,182,0,38,0,47,0,0,1,53,33,21,35,34,21,21,16,33,34,39,
+35,6,35,32,17,52,36,33,51,17,52,35,35,53,33,21,35,34,21,17,16,51,50,17,53,
+52,35,5,35,34,6,21,16,51,50,53,4,141,2,84,26,168,254,108,248,100,8,104,189,
+254,78,1,29,1,18,119,168,68,2,125,26,168,198,197,168,254,78,109,193,155,229,
+228,2,211,86,86,139,234,254,142,165,165,1,141,206,226,1,174,137,86,86,147,
+252,147,254,242,1,14,223,148,10,151,177,254,205,227,0,2,0,113,255,236,7,6,
+6,20,0,37,0,47,0,0,1,16,51,50,17,53,52,35,35,53,33,21,35,34,21,21,16,33,32,
+39,35,6,35,32,17,16,33,50,23,51,38,53,53,52,35,35,53,33,3,52,38,35,34,17,
+16,51,50,54,4,12,199,197,168,7,2,29,6,168,254,123,254,243,106,8,108,214,254,
+95,1,161,213,101,12,12,168,17,1,121,192,135,146,252,254,149,130,1,104,254,
+234,1,14,115,147,86,86,139,125,254,142,206,206,2,55,2,59,180,189,36,168,139,
+86,252,15,240,200,254,70,254,78,195,0,1,0,61,255,236,7,47,5,203,0,46,0,0,
+1,16,51,50,17,53,52,35,35,53,33,21,35,34,21,21,16,33,32,17,53,52,38,35,35,
+53,51,50,54,53,52,33,32,17,34,53,52,54,51,50,22,21,16,5,21,4,17,4,20,197,
+197,168,27,2,84,27,167,254,108,254,88,185,165,174,174,139,182,254,240,254,
+234,177,239,216,234,254,254,182,1,114,1,96,254,242,1,14,223,148,86,86,139,
+234,254,142,1,114,76,127,152,104,177,140,254,254,207,133,124,151,178,164,
+254,226,81,10,47,254,213,0,1,0,37,255,236,6,47,4,92,0,44,0,0,1,53,33,21,35,
+34,21,21,16,33,34,38,2,35,35,53,51,50,54,53,52,35,34,21,34,53,52,54,51,50,
+22,21,20,7,21,22,18,22,51,50,54,53,53,52,35,4,18,2,29,6,168,254,123,203,182,
+23,227,190,192,98,109,184,211,162,199,178,174,200,206,226,25,89,102,98,95,
+168,2,102,86,86,139,125,254,142,150,1,134,111,109,87,195,221,123,85,107,143,
+125,195,71,11,50,254,175,102,118,152,115,147,0,1,0,61,254,82,4,209,5,203,
+0,35,0,0,37,20,51,51,17,35,16,33,35,17,52,38,35,35,53,51,50,54,53,52,33,32,
+17,34,53,52,54,51,50,22,21,16,5,21,4,17,4,0,168,41,94,254,211,21,185,165,
+174,174,139,182,254,240,254,234,177,239,216,234,254,254,182,1,94,233,147,
+253,252,1,174,1,170,127,152,104,177,140,254,254,207,133,124,151,178,164,254,
+226,81,10,43,254,209,0,1,0,37,254,82,3,213,4,92,0,35,0,0,1,52,35,35,53,51,
+50,54,53,52,35,34,21,34,53,52,54,51,50,22,21,20,7,21,22,21,21,20,23,51,17,
+35,39,2,35,35,2,102,229,190,192,98,109,184,211,162,199,178,174,200,206,225,
+147,27,100,11,21,171,64,1,63,201,111,109,87,195,221,123,85,107,143,125,195,
+71,11,52,202,88,130,5,253,244,149,1,25,0,1,0,0,255,236,7,170,5,182,0,46,0,
+0,1,2,2,6,35,34,53,52,51,20,22,51,50,54,18,18,53,52,35,35,53,33,21,35,34,
+21,17,16,51,50,17,53,52,35,35,53,33,21,35,34,21,21,16,33,32,17,17,2,113,18,
+130,181,132,164,90,57,43,59,91,104,62,164,31,4,25,27,168,199,197,168,27,2,
+84,27,168,254,109,254,106,5,80,254,141,252,252,231,143,125,35,61,90,1,116,
+2,28,132,84,86,86,147,252,147,254,242,1,14,223,148,86,86,139,234,254,142,
+1,114,3,242,0,1,0,0,255,236,7,12,4,74,0,45,0,0,1,2,2,6,35,34,53,52,51,20,
+22,51,50,54,18,53,52,35,35,53,33,21,35,34,21,17,16,51,50,17,53,52,35,35,53,
+33,21,35,34,21,21,16,33,32,17,17,2,76,34,121,154,115,164,90,57,43,71,105,
+105,168,27,3,195,27,168,197,197,168,6,2,28,6,168,254,123,254,123,3,236,254,
+190,253,239,167,143,125,35,61,142,1,225,104,127,86,86,138,253,246,254,242,
+1,14,115,147,86,86,139,125,254,142,1,104,2,152,0,1,0,78,255,236,8,100,5,182,
+0,53,0,0,1,16,51,50,17,53,52,35,35,53,33,21,35,34,21,21,16,33,32,17,17,33,
+17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,33,17,52,35,
+35,53,33,21,35,34,21,5,72,198,197,168,27,2,84,26,168,254,108,254,107,253,
+102,168,27,253,172,26,168,168,26,2,84,27,168,2,154,168,27,2,84,26,168,1,96,
+254,242,1,14,223,148,86,86,139,234,254,142,1,114,1,107,254,32,147,86,86,147,
+3,236,139,86,86,147,254,98,1,158,147,86,86,147,0,1,0,47,255,236,7,135,4,74,
+0,53,0,0,1,16,51,50,17,53,52,35,35,53,33,21,35,34,21,21,16,33,32,17,53,33,
+17,20,51,51,21,33,53,51,50,53,17,52,35,35,53,33,21,35,34,21,17,33,17,52,35,
+35,53,33,21,35,34,21,4,143,197,197,168,7,2,29,6,168,254,123,254,123,253,227,
+168,6,253,207,27,168,168,27,2,49,6,168,2,29,168,6,2,49,27,168,1,96,254,242,
+1,14,115,147,86,86,139,125,254,142,1,104,176,254,219,137,86,86,137,2,137,
+140,86,86,138,254,248,1,15,131,86,86,138,0,1,0,117,255,236,5,205,5,203,0,
+32,0,0,1,52,38,35,32,17,16,33,32,17,52,35,35,53,33,21,35,34,6,7,2,33,32,0,
+17,16,0,33,50,22,21,20,6,4,72,155,145,254,60,1,217,1,55,167,9,2,21,8,81,55,
+6,35,253,254,254,198,254,157,1,124,1,81,211,241,107,4,70,124,156,253,127,
+253,131,1,99,139,86,86,78,70,254,50,1,149,1,92,1,93,1,145,139,107,63,80,0,
+1,0,113,255,236,4,225,4,94,0,31,0,0,1,52,35,32,17,16,33,50,53,52,35,35,53,
+33,21,35,34,6,7,6,6,35,34,0,17,16,0,33,50,22,21,20,3,156,236,254,135,1,119,
+250,137,33,1,227,8,65,41,9,27,232,236,247,254,241,1,56,1,30,177,218,3,6,242,
+254,47,254,47,252,106,86,86,55,57,181,171,1,36,1,13,1,15,1,50,134,101,109,
+0,1,0,41,255,236,5,246,5,182,0,33,0,0,1,34,7,7,35,19,33,19,35,39,38,35,35,
+17,16,51,50,17,53,52,35,35,53,33,21,35,34,21,21,16,33,32,17,17,1,70,148,20,
+11,106,10,4,129,10,106,10,19,151,199,199,196,168,26,2,84,27,168,254,109,254,
+106,5,80,168,88,1,102,254,154,88,168,252,16,254,242,1,14,223,148,86,86,139,
+234,254,142,1,114,3,242,0,1,0,41,255,236,5,137,4,74,0,35,0,0,1,34,6,7,7,35,
+19,33,19,35,39,38,38,35,35,17,16,51,50,17,53,52,35,35,53,33,21,35,34,21,21,
+16,33,32,17,17,1,39,66,60,17,11,100,12,3,246,12,100,10,12,53,79,168,197,197,
+168,6,2,28,6,168,254,123,254,123,3,236,61,105,68,1,72,254,184,68,83,83,253,
+116,254,242,1,14,25,147,86,86,139,35,254,142,1,104,2,152,0,1,0,115,255,233,
+4,86,5,203,0,36,0,0,1,22,21,20,6,35,32,17,16,37,53,36,17,52,36,51,50,22,21,
+20,35,16,33,32,21,20,22,51,51,21,35,34,6,21,16,33,32,4,47,39,254,211,253,
+238,1,114,254,183,1,7,224,216,239,176,254,233,254,240,183,138,174,174,165,
+185,1,49,1,36,1,31,26,54,87,143,1,160,1,59,56,10,75,1,11,172,195,151,124,
+133,1,49,254,141,176,104,151,134,254,205,0,1,0,102,255,236,3,123,4,92,0,36,
+0,0,1,22,21,20,6,35,34,38,53,52,55,53,38,53,52,54,51,50,22,21,20,35,52,35,
+34,21,20,22,51,51,21,35,34,21,20,33,50,3,88,35,190,166,206,227,242,207,205,
+170,178,199,162,211,184,111,96,192,190,240,1,12,200,1,0,25,55,78,118,169,
+150,211,61,11,68,179,127,160,107,85,123,221,195,90,106,111,201,206,255,255,
+0,0,254,109,5,80,5,182,18,34,1,181,0,0,16,3,3,123,3,217,0,0,255,255,0,0,254,
+109,4,215,4,74,18,34,1,213,0,0,16,3,3,123,3,96,0,0,255,255,0,0,254,137,5,
+164,5,182,18,34,0,36,0,0,16,3,2,98,5,53,0,0,255,255,0,102,254,137,4,41,4,
+94,18,34,0,68,0,0,16,3,2,98,4,137,0,0,255,255,0,0,0,0,5,164,7,225,18,34,0,
+36,0,0,16,3,2,97,5,57,1,82,255,255,0,102,255,236,4,41,6,143,18,34,0,68,0,
+0,16,3,2,97,4,141,0,0,255,255,0,0,0,0,5,164,7,209,18,34,0,36,0,0,16,3,3,114,
+5,49,1,82,255,255,0,102,255,236,4,77,6,127,18,34,0,68,0,0,16,3,3,114,4,143,
+0,0,255,255,0,0,0,0,5,164,7,209,18,34,0,36,0,0,16,3,3,115,5,45,1,82,255,255,
+0,20,255,236,4,41,6,127,18,34,0,68,0,0,16,3,3,115,4,139,0,0,255,255,0,0,0,
+0,5,164,8,51,18,34,0,36,0,0,16,3,3,116,5,49,1,82,255,255,0,102,255,236,4,
+41,6,225,18,34,0,68,0,0,16,3,3,116,4,143,0,0,255,255,0,0,0,0,5,164,8,98,18,
+34,0,36,0,0,16,3,3,117,5,49,1,82,255,255,0,102,255,236,4,41,7,16,18,34,0,
+68,0,0,16,3,3,117,4,143,0,0,255,255,0,0,254,137,5,164,7,115,18,34,0,36,0,
+0,16,35,1,75,0,133,1,82,16,3,2,98,5,53,0,0,255,255,0,102,254,137,4,41,6,33,
+18,34,0,68,0,0,16,34,1,75,228,0,16,3,2,98,4,137,0,0,255,255,0,0,0,0,5,164,
+8,19,18,34,0,36,0,0,16,3,3,118,5,49,1,82,255,255,0,102,255,236,4,41,6,193,
+18,34,0,68,0,0,16,3,3,118,4,147,0,0,255,255,0,0,0,0,5,164,8,19,18,34,0,36,
+0,0,16,3,3,119,5,49,1,82,255,255,0,102,255,236,4,41,6,193,18,34,0,68,0,0,
+16,3,3,119,4,147,0,0,255,255,0,0,0,0,5,164,8,88,18,34,0,36,0,0,16,3,3,120,
+5,49,1,82,255,255,0,102,255,236,4,41,7,6,18,34,0,68,0,0,16,3,3,120,4,147,
+0,0,255,255,0,0,0,0,5,164,8,98,18,34,0,36,0,0,16,3,3,121,5,49,1,82,255,255,
+0,102,255,236,4,41,7,16,18,34,0,68,0,0,16,3,3,121,4,147,0,0,255,255,0,0,254,
+137,5,164,7,68,18,34,0,36,0,0,16,35,2,98,5,53,0,0,16,3,1,78,0,127,1,82,255,
+255,0,102,254,137,4,41,5,242,18,34,0,68,0,0,16,34,1,78,230,0,16,3,2,98,4,
+137,0,0,255,255,0,78,254,137,4,166,5,182,18,34,0,40,0,0,16,3,2,98,4,221,0,
+0,255,255,0,113,254,137,3,225,4,94,18,34,0,72,0,0,16,3,2,98,4,143,0,0,255,
+255,0,78,0,0,4,166,7,225,18,34,0,40,0,0,16,3,2,97,4,250,1,82,255,255,0,113,
+255,236,3,225,6,143,18,34,0,72,0,0,16,3,2,97,4,154,0,0,255,255,0,78,0,0,4,
+166,7,49,18,34,0,40,0,0,16,3,1,82,0,70,1,82,255,255,0,113,255,236,3,225,5,
+223,18,34,0,72,0,0,16,2,1,82,226,0,255,255,0,78,0,0,4,167,7,209,18,34,0,40,
+0,0,16,3,3,114,4,233,1,82,255,255,0,113,255,236,4,71,6,127,18,34,0,72,0,0,
+16,3,3,114,4,137,0,0,255,255,0,78,0,0,4,166,7,209,18,34,0,40,0,0,16,3,3,115,
+4,229,1,82,255,255,0,14,255,236,3,225,6,127,18,34,0,72,0,0,16,3,3,115,4,133,
+0,0,255,255,0,78,0,0,4,166,8,51,18,34,0,40,0,0,16,3,3,116,4,233,1,82,255,
+255,0,113,255,236,3,241,6,225,18,34,0,72,0,0,16,3,3,116,4,137,0,0,255,255,
+0,78,0,0,4,166,8,98,18,34,0,40,0,0,16,3,3,117,4,233,1,82,255,255,0,113,255,
+236,3,225,7,16,18,34,0,72,0,0,16,3,3,117,4,137,0,0,255,255,0,78,254,137,4,
+166,7,115,18,34,0,40,0,0,16,35,1,75,0,61,1,82,16,3,2,98,4,221,0,0,255,255,
+0,113,254,137,3,225,6,33,18,34,0,72,0,0,16,34,1,75,222,0,16,3,2,98,4,143,
+0,0,255,255,0,78,0,0,2,162,7,225,18,34,0,44,0,0,16,3,2,97,3,223,1,82,255,
+255,0,47,0,0,2,117,6,143,18,34,0,243,0,0,16,3,2,97,3,176,0,0,255,255,0,78,
+254,137,2,162,5,182,18,34,0,44,0,0,16,3,2,98,3,219,0,0,255,255,0,47,254,137,
+2,117,6,20,18,34,0,76,0,0,16,3,2,98,3,172,0,0,255,255,0,115,254,137,5,123,
+5,205,18,34,0,50,0,0,16,3,2,98,5,92,0,0,255,255,0,113,254,137,4,45,4,94,18,
+34,0,82,0,0,16,3,2,98,4,178,0,0,255,255,0,115,255,236,5,123,7,225,18,34,0,
+50,0,0,16,3,2,97,5,96,1,82,255,255,0,113,255,236,4,45,6,143,18,34,0,82,0,
+0,16,3,2,97,4,182,0,0,255,255,0,115,255,236,5,123,7,209,18,34,0,50,0,0,16,
+3,3,114,5,86,1,82,255,255,0,113,255,236,4,100,6,127,18,34,0,82,0,0,16,3,3,
+114,4,166,0,0,255,255,0,115,255,236,5,123,7,209,18,34,0,50,0,0,16,3,3,115,
+5,82,1,82,255,255,0,43,255,236,4,45,6,127,18,34,0,82,0,0,16,3,3,115,4,162,
+0,0,255,255,0,115,255,236,5,123,8,51,18,34,0,50,0,0,16,3,3,116,5,86,1,82,
+255,255,0,113,255,236,4,45,6,225,18,34,0,82,0,0,16,3,3,116,4,166,0,0,255,
+255,0,115,255,236,5,123,8,98,18,34,0,50,0,0,16,3,3,117,5,86,1,82,255,255,
+0,113,255,236,4,45,7,16,18,34,0,82,0,0,16,3,3,117,4,166,0,0,255,255,0,115,
+254,137,5,123,7,115,18,34,0,50,0,0,16,35,1,75,0,170,1,82,16,3,2,98,5,92,0,
+0,255,255,0,113,254,137,4,45,6,33,18,34,0,82,0,0,16,35,2,98,4,178,0,0,16,
+2,1,75,251,0,255,255,0,115,255,236,6,37,7,115,18,34,2,90,0,0,16,3,0,118,1,
+2,1,82,255,255,0,113,255,236,4,244,6,33,18,34,2,91,0,0,16,2,0,118,121,0,255,
+255,0,115,255,236,6,37,7,115,18,34,2,90,0,0,16,3,0,67,0,70,1,82,255,255,0,
+113,255,236,4,244,6,33,18,34,2,91,0,0,16,2,0,67,161,0,255,255,0,115,255,236,
+6,37,7,225,18,34,2,90,0,0,16,3,2,97,5,96,1,82,255,255,0,113,255,236,4,244,
+6,143,18,34,2,91,0,0,16,3,2,97,4,182,0,0,255,255,0,115,255,236,6,37,7,49,
+18,34,2,90,0,0,16,3,1,82,0,156,1,82,255,255,0,113,255,236,4,244,5,223,18,
+34,2,91,0,0,16,2,1,82,251,0,255,255,0,115,254,137,6,37,6,41,18,34,2,90,0,
+0,16,3,2,98,5,92,0,0,255,255,0,113,254,137,4,244,5,6,18,34,2,91,0,0,16,3,
+2,98,4,178,0,0,255,255,0,31,254,137,5,158,5,182,18,34,0,56,0,0,16,3,2,98,
+5,66,0,0,255,255,0,47,254,137,4,229,4,74,18,34,0,88,0,0,16,3,2,98,4,238,0,
+0,255,255,0,31,255,236,5,158,7,225,18,34,0,56,0,0,16,3,2,97,5,111,1,82,255,
+255,0,47,255,236,4,229,6,143,18,34,0,88,0,0,16,3,2,97,4,242,0,0,255,255,0,
+31,255,236,6,37,7,115,18,34,2,92,0,0,16,3,0,118,1,2,1,82,255,255,0,47,255,
+236,5,129,6,33,18,34,2,93,0,0,16,3,0,118,0,150,0,0,255,255,0,31,255,236,6,
+37,7,115,18,34,2,92,0,0,16,3,0,67,0,61,1,82,255,255,0,47,255,236,5,129,6,
+33,18,34,2,93,0,0,16,2,0,67,177,0,255,255,0,31,255,236,6,37,7,225,18,34,2,
+92,0,0,16,3,2,97,5,111,1,82,255,255,0,47,255,236,5,129,6,143,18,34,2,93,0,
+0,16,3,2,97,4,242,0,0,255,255,0,31,255,236,6,37,7,49,18,34,2,92,0,0,16,3,
+1,82,0,168,1,82,255,255,0,47,255,236,5,129,5,223,18,34,2,93,0,0,16,2,1,82,
+45,0,255,255,0,31,254,137,6,37,6,41,18,34,2,92,0,0,16,3,2,98,5,66,0,0,255,
+255,0,47,254,137,5,129,5,6,18,34,2,93,0,0,16,3,2,98,4,238,0,0,255,255,255,
+246,254,137,5,6,5,182,18,34,0,60,0,0,16,3,2,98,4,233,0,0,255,255,0,8,254,
+20,4,133,4,74,18,34,0,92,0,0,16,3,2,98,6,0,0,0,255,255,255,246,0,0,5,6,7,
+225,18,34,0,60,0,0,16,3,2,97,4,238,1,82,255,255,0,8,254,20,4,133,6,143,18,
+34,0,92,0,0,16,3,2,97,4,190,0,0,255,255,255,246,0,0,5,6,7,49,18,34,0,60,0,
+0,16,3,1,82,0,76,1,82,255,255,0,8,254,20,4,133,5,223,18,34,0,92,0,0,16,2,
+1,82,29,0,255,255,0,113,254,221,4,199,6,20,18,34,0,211,0,0,16,3,0,66,0,190,
+0,0,0,2,251,219,4,217,254,186,6,33,0,7,0,15,0,0,1,35,38,39,53,51,22,23,5,
+35,38,39,53,51,22,23,254,186,100,160,112,198,80,94,254,150,100,161,112,199,
+80,94,4,217,134,173,21,168,133,27,135,172,21,168,133,0,2,252,115,4,217,255,
+190,6,127,0,7,0,20,0,0,1,54,55,51,21,6,7,35,5,54,55,51,22,23,21,35,38,39,
+6,7,35,254,139,75,52,180,100,129,78,253,232,156,51,192,55,150,80,112,109,
+87,136,80,5,182,91,110,21,121,85,168,166,94,102,158,27,70,96,79,87,0,2,251,
+137,4,217,254,213,6,127,0,7,0,20,0,0,1,35,38,39,53,51,22,23,5,35,38,39,6,
+7,35,53,54,55,51,22,23,252,188,77,133,97,180,52,75,2,25,80,136,87,109,112,
+80,152,53,192,51,156,5,156,88,118,21,110,91,221,86,80,96,70,27,162,98,94,
+166,0,2,252,115,4,217,255,104,6,225,0,16,0,29,0,0,1,7,35,39,54,53,52,35,34,
+7,38,53,52,51,50,21,20,1,54,55,51,22,23,21,35,38,39,6,7,35,254,238,9,86,10,
+121,86,57,39,29,131,186,253,11,156,51,192,55,150,80,112,109,87,136,80,5,219,
+51,92,11,67,61,32,14,29,71,137,97,254,253,166,94,102,158,27,70,96,79,87,0,
+2,252,100,4,217,254,233,7,16,0,15,0,28,0,0,1,35,54,51,50,22,51,50,55,51,6,
+35,34,38,35,34,3,54,55,51,22,23,21,35,38,39,6,7,35,252,193,93,26,163,54,183,
+31,71,25,92,25,163,50,183,35,72,102,156,51,192,55,150,80,112,109,87,136,80,
+6,49,221,90,92,221,90,254,103,166,94,102,158,27,70,96,79,87,0,2,252,129,4,
+217,254,190,6,193,0,7,0,17,0,0,1,54,55,51,21,6,7,35,37,2,33,32,3,51,22,51,
+50,55,253,94,75,52,180,104,125,78,1,96,30,255,0,254,247,22,98,35,156,143,
+47,5,248,91,110,21,126,81,6,254,246,1,10,125,125,0,2,252,129,4,217,254,190,
+6,193,0,7,0,17,0,0,1,35,38,39,53,51,22,23,23,2,33,32,3,51,22,51,50,55,253,
+213,78,125,104,180,52,75,233,30,255,0,254,247,22,98,35,156,143,47,5,221,81,
+126,21,110,91,21,254,246,1,10,125,125,0,2,252,129,4,217,254,190,7,6,0,16,
+0,26,0,0,1,7,35,39,54,53,52,35,34,7,38,53,52,51,50,21,20,23,2,33,32,3,51,
+22,51,50,55,253,195,9,86,10,121,86,56,40,29,131,186,129,30,255,0,254,247,
+22,98,35,156,143,47,6,0,51,92,11,67,61,33,16,27,72,137,97,57,254,246,1,10,
+125,125,0,2,252,104,4,217,254,238,7,16,0,15,0,25,0,0,1,35,54,51,50,22,51,
+50,55,51,6,35,34,38,35,34,5,2,33,32,3,51,22,51,50,55,252,197,93,26,163,54,
+183,31,71,25,93,26,163,50,183,35,72,1,225,30,255,0,254,247,22,98,35,156,143,
+47,6,49,221,90,92,221,90,170,254,246,1,10,125,125,0,1,0,35,254,66,1,113,0,
+0,0,14,0,0,51,51,22,21,20,35,34,53,52,55,22,51,50,53,52,80,108,181,201,133,
+14,45,39,86,121,131,194,84,29,24,17,88,111,0,1,0,6,254,109,1,119,0,86,0,12,
+0,0,37,21,16,35,34,53,52,55,22,51,50,53,53,1,119,213,156,31,47,59,117,86,
+186,254,209,112,45,31,33,148,186,255,255,0,41,254,20,4,190,5,182,18,34,0,
+55,0,0,16,3,0,122,1,44,0,0,255,255,0,39,254,20,2,162,5,70,18,34,0,87,0,0,
+16,2,0,122,70,0,0,2,0,35,255,236,4,121,6,20,0,39,0,51,0,0,36,2,35,34,38,39,
+35,7,33,53,51,50,54,53,17,35,53,51,53,52,38,35,35,53,33,21,33,21,33,21,20,
+6,7,51,54,54,51,50,18,17,0,6,21,20,22,51,50,54,53,52,38,35,4,121,208,210,
+108,156,49,13,36,254,184,16,97,71,186,186,71,97,16,1,121,1,94,254,162,5,3,
+8,54,153,106,211,207,253,166,129,132,148,135,117,118,136,255,254,237,91,89,
+160,86,74,73,3,213,97,20,68,71,86,245,97,75,69,121,77,109,96,254,238,254,
+239,1,160,187,229,225,194,215,206,208,206,0,3,0,20,0,0,5,92,5,182,0,38,0,
+47,0,56,0,0,1,32,4,21,20,6,7,21,22,22,21,20,4,33,33,53,51,50,54,53,17,52,
+38,35,34,6,21,20,22,23,6,6,35,34,38,53,52,54,51,1,51,50,54,53,52,38,35,35,
+17,51,50,54,53,52,38,35,35,3,16,1,8,1,7,121,133,151,164,254,251,254,247,253,
+158,26,97,71,58,79,57,60,16,17,14,37,25,56,57,145,167,1,49,141,171,143,138,
+180,137,199,173,144,144,169,203,5,182,175,191,116,162,44,8,26,194,151,198,
+197,86,74,73,3,240,69,70,72,65,34,48,24,14,17,72,53,119,112,253,123,121,158,
+147,117,251,22,134,165,171,143,255,255,0,78,0,0,4,133,5,182,18,2,1,171,0,
+0,0,2,0,37,255,236,4,121,6,20,0,38,0,50,0,0,0,2,35,34,38,39,35,7,33,53,51,
+50,54,53,17,52,38,35,35,53,33,17,35,39,38,38,35,33,17,20,6,7,51,54,54,51,
+50,18,17,0,6,21,20,22,51,50,54,53,52,38,35,4,121,207,211,108,156,49,13,36,
+254,184,16,97,71,71,97,16,3,235,100,10,16,52,76,254,140,5,3,8,54,153,106,
+210,208,253,165,128,132,148,128,124,118,136,1,10,254,226,91,89,160,86,74,
+73,4,74,68,71,86,254,205,68,95,50,254,230,69,121,77,109,96,254,228,254,229,
+1,180,196,240,237,203,213,229,218,216,0,2,0,31,255,236,4,86,5,182,0,22,0,
+33,0,0,4,38,53,17,52,38,35,35,53,33,21,35,34,6,21,17,51,32,4,21,20,6,35,54,
+54,53,52,38,35,35,17,20,22,51,1,199,230,72,96,26,2,125,68,97,71,129,1,14,
+1,23,230,212,114,107,164,184,109,106,124,20,212,193,3,76,75,72,86,86,68,69,
+254,82,214,200,193,222,98,151,156,175,153,254,174,154,143,0,2,0,16,255,236,
+4,100,6,20,0,23,0,35,0,0,19,52,38,35,35,53,33,17,20,6,7,51,54,54,51,50,18,
+17,16,2,35,34,2,17,0,6,21,20,22,51,50,54,53,52,38,35,201,71,97,17,1,121,5,
+3,8,52,155,107,209,208,229,233,231,230,1,66,130,129,152,134,118,118,136,5,
+51,68,71,86,254,136,69,121,77,107,98,254,232,254,225,254,225,254,228,1,28,
+1,27,1,184,194,242,253,212,227,240,218,216,0,1,0,92,255,236,4,115,5,203,0,
+29,0,0,4,38,53,52,54,51,20,22,51,50,18,17,16,2,35,34,6,21,34,38,53,52,54,
+51,32,0,17,16,0,33,1,65,229,92,80,144,127,176,200,169,185,123,153,76,92,240,
+208,1,23,1,43,254,189,254,226,20,138,113,76,76,129,166,1,83,1,54,1,64,1,61,
+162,118,66,63,113,147,254,125,254,159,254,159,254,102,0,1,0,117,255,236,5,
+162,6,221,0,46,0,0,0,22,23,53,52,54,51,50,22,21,20,6,7,38,38,35,34,6,21,21,
+20,6,35,52,38,35,34,2,17,16,18,51,50,54,55,22,22,21,20,6,35,32,0,17,16,0,
+33,3,105,148,52,111,102,72,84,17,14,25,47,34,60,57,101,77,127,113,217,209,
+219,207,124,180,67,17,22,241,200,254,218,254,184,1,92,1,53,5,203,32,28,31,
+138,165,57,55,25,37,14,17,16,74,74,201,63,80,119,145,254,202,254,181,254,
+209,254,197,84,90,11,38,31,91,138,1,146,1,95,1,92,1,146,0,1,0,113,255,236,
+4,162,6,20,0,46,0,0,4,2,17,16,18,51,50,22,23,53,52,54,51,50,22,21,20,6,7,
+38,38,35,34,6,21,17,20,6,35,52,38,35,34,6,21,20,22,51,50,54,55,22,22,21,20,
+6,35,1,98,241,228,228,65,131,52,105,108,72,84,17,14,25,47,34,62,61,92,91,
+85,89,138,120,146,164,95,142,35,15,20,191,157,20,1,31,1,20,1,33,1,30,27,28,
+190,145,158,56,56,25,37,14,17,16,76,72,254,168,71,58,118,118,229,242,220,
+212,80,63,12,40,28,79,117,255,255,0,78,0,0,5,92,5,182,18,2,0,146,0,0,0,2,
+0,20,0,0,5,250,5,182,0,31,0,40,0,0,18,6,21,20,22,23,6,6,35,34,38,53,52,54,
+51,33,32,0,17,16,0,33,33,53,51,50,54,53,17,52,38,35,1,50,18,17,16,2,35,35,
+17,236,60,16,17,14,37,25,56,57,145,167,2,18,1,61,1,95,254,165,254,191,253,
+142,26,97,71,58,79,2,10,239,249,247,239,180,5,100,72,65,34,48,24,14,17,72,
+53,119,112,254,130,254,165,254,164,254,127,86,74,73,3,240,69,70,251,4,1,64,
+1,53,1,52,1,63,251,24,0,2,0,80,0,0,4,135,5,182,0,27,0,36,0,0,1,21,35,34,6,
+21,17,20,22,51,51,21,33,34,36,53,52,36,33,51,17,33,34,6,7,7,35,19,1,35,34,
+6,21,20,22,51,51,4,135,26,96,72,71,97,26,253,193,245,254,253,1,22,1,15,129,
+254,203,74,85,11,11,106,10,2,74,109,187,161,155,162,140,5,182,86,72,75,252,
+20,68,71,86,216,190,198,205,2,39,77,91,88,1,102,253,19,146,172,160,137,0,
+2,0,113,255,236,4,197,6,20,0,33,0,45,0,0,1,34,6,7,7,35,17,33,17,20,22,51,
+51,21,33,39,35,6,6,35,34,2,17,16,18,51,50,22,23,51,52,38,53,17,2,54,53,52,
+38,35,34,6,21,20,22,51,1,215,73,56,14,11,100,3,51,71,97,17,254,165,22,8,51,
+155,108,209,208,207,210,106,155,53,12,12,130,130,135,146,128,124,123,131,
+5,182,50,95,68,1,51,250,205,68,71,86,184,105,99,1,24,1,31,1,32,1,27,88,92,
+20,176,29,1,43,250,185,194,242,240,200,215,227,228,206,0,2,0,113,255,236,
+4,47,6,31,0,32,0,44,0,0,0,38,36,38,38,53,52,0,51,50,4,21,20,6,7,22,22,21,
+20,6,35,34,38,53,52,54,51,20,22,51,50,54,53,0,22,23,54,54,53,52,38,35,34,
+6,21,2,219,101,254,232,154,83,1,2,225,213,1,6,208,206,127,113,202,169,153,
+187,81,71,117,90,98,88,254,82,149,136,140,153,154,129,142,153,1,62,116,176,
+150,179,110,245,1,17,248,211,185,249,62,81,166,97,134,154,130,83,65,64,110,
+138,91,73,2,218,222,84,41,247,189,144,177,191,179,0,1,0,86,0,0,4,174,5,182,
+0,31,0,0,1,33,53,33,17,33,34,6,7,7,35,19,33,21,35,34,6,21,17,20,22,51,51,
+21,33,3,51,23,22,22,51,33,3,29,254,18,1,238,254,168,79,92,10,10,106,10,4,
+8,27,95,72,71,96,27,251,182,14,107,14,12,99,83,1,140,2,203,100,2,33,85,83,
+88,1,102,86,71,76,252,18,69,68,86,1,102,88,81,87,255,255,0,111,255,236,5,
+16,5,205,18,2,2,220,0,0,255,255,0,115,255,233,4,86,5,203,18,2,3,20,0,0,0,
+1,255,233,254,20,4,96,5,182,0,27,0,0,5,20,6,35,35,53,51,50,54,53,17,52,38,
+35,35,53,33,19,35,39,38,38,35,33,17,33,21,33,1,223,232,235,35,19,149,127,
+71,97,26,4,8,10,106,10,10,98,81,254,176,1,238,254,18,16,239,237,97,184,193,
+4,231,68,71,86,254,154,88,84,84,253,176,100,0,1,0,117,255,236,6,4,6,221,0,
+56,0,0,4,0,17,16,0,33,50,22,23,53,52,54,51,50,22,21,20,6,7,38,38,35,34,6,
+21,21,20,6,35,52,38,35,34,2,17,16,18,33,50,54,55,17,52,38,35,35,53,33,21,
+35,34,6,21,17,6,6,35,1,227,254,146,1,125,1,80,112,168,57,111,102,73,83,17,
+14,24,48,34,60,57,107,83,143,128,244,237,250,1,4,59,111,43,75,93,8,2,20,8,
+82,59,103,218,132,20,1,138,1,103,1,94,1,144,35,31,37,138,165,57,55,25,37,
+14,17,16,74,74,201,62,81,119,145,254,203,254,180,254,178,254,209,12,13,1,
+74,71,68,86,86,74,74,254,144,48,46,0,2,0,0,254,20,5,102,5,182,0,43,0,55,0,
+0,1,22,22,21,20,6,35,34,38,53,52,18,55,1,38,38,35,35,53,33,21,35,34,6,21,
+20,22,23,1,1,54,54,53,52,38,35,35,53,33,21,35,34,6,7,0,38,39,6,6,21,20,22,
+51,50,54,53,3,14,81,69,141,125,110,118,90,80,254,76,31,60,54,27,2,51,47,62,
+61,6,11,1,59,1,66,11,7,66,69,47,1,243,39,69,54,32,254,72,35,47,53,56,44,38,
+51,58,1,100,190,248,98,147,165,130,141,102,1,9,149,3,205,68,40,86,86,47,51,
+18,36,22,253,53,2,189,23,48,17,53,47,86,86,90,69,250,184,171,124,108,199,
+78,73,83,81,85,0,1,0,37,255,236,6,129,6,20,0,56,0,0,1,52,38,35,34,6,21,17,
+20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,17,20,6,7,51,54,51,
+50,22,21,17,20,22,51,50,54,53,17,52,38,35,35,53,33,17,20,6,35,34,38,53,3,
+78,100,105,111,116,69,97,8,253,217,16,97,71,71,97,16,1,121,6,2,10,86,196,
+165,175,107,110,116,102,70,96,9,1,111,202,208,213,196,2,195,148,132,172,160,
+254,80,70,67,86,86,74,73,4,74,68,71,86,254,62,53,92,29,186,191,210,254,147,
+149,121,136,171,1,219,75,73,86,253,45,201,194,185,193,0,1,0,78,255,236,2,
+162,5,182,0,24,0,0,1,52,38,35,35,53,33,21,35,34,6,21,17,20,51,50,54,55,21,
+6,6,35,34,38,53,1,16,72,96,26,2,84,27,97,71,127,19,32,17,21,72,34,145,130,
+4,205,75,72,86,86,74,73,252,61,172,6,6,96,12,18,139,153,0,1,0,41,0,0,2,199,
+5,182,0,31,0,0,51,53,51,50,54,53,17,35,53,51,17,52,38,35,35,53,33,21,35,34,
+6,21,17,51,21,35,17,20,22,51,51,21,78,26,96,72,231,231,72,96,26,2,84,27,97,
+71,232,232,71,97,27,86,72,75,1,226,100,1,158,75,72,86,86,74,73,254,98,100,
+254,30,73,74,86,0,1,0,78,0,0,5,178,5,197,0,54,0,0,1,1,22,22,51,51,21,35,34,
+38,38,39,1,7,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,21,
+35,34,6,21,17,1,54,54,51,50,22,21,20,6,35,38,38,35,34,6,7,3,12,1,193,59,109,
+57,4,22,139,137,92,62,254,143,158,71,97,27,253,172,26,97,71,71,97,26,2,84,
+27,97,71,1,178,113,156,98,63,74,58,36,9,48,47,36,60,36,3,111,253,139,81,83,
+86,28,66,90,2,21,137,254,165,73,74,86,86,68,69,3,246,68,71,86,86,74,73,253,
+221,2,12,138,133,79,63,56,75,45,62,44,40,0,1,0,37,0,0,4,176,6,31,0,58,0,0,
+1,20,6,7,1,54,54,53,52,38,35,53,33,21,34,6,7,7,1,22,22,51,51,21,35,34,38,
+38,39,3,7,21,20,22,51,51,21,33,53,51,50,54,53,17,52,54,51,50,22,21,20,6,35,
+52,38,35,34,6,21,1,158,5,3,1,0,50,62,48,52,1,196,71,137,80,144,1,17,53,103,
+69,8,29,138,112,88,63,205,151,69,97,8,253,217,16,97,71,169,173,110,130,76,
+82,55,51,70,55,2,254,60,131,67,1,24,56,90,37,26,15,86,86,100,91,162,254,107,
+82,86,86,26,73,100,1,65,112,185,70,67,86,86,74,73,3,156,209,201,91,71,51,
+66,87,98,95,139,0,1,0,20,0,0,2,102,6,20,0,26,0,0,55,50,54,53,17,35,53,51,
+17,52,38,35,35,53,33,17,51,21,35,17,20,22,51,51,21,33,53,53,97,71,201,201,
+71,97,26,1,131,200,200,72,96,26,253,187,86,74,73,2,3,96,1,231,68,71,86,253,
+56,96,253,253,75,72,86,86,0,1,0,16,0,0,4,66,6,41,0,45,0,0,1,7,22,22,23,19,
+22,22,51,51,21,35,34,38,38,2,39,35,6,6,7,1,35,1,38,38,39,7,53,55,38,38,35,
+34,6,7,38,38,53,52,54,51,50,22,23,55,3,45,207,8,15,6,182,48,142,72,11,48,
+131,107,85,102,3,8,11,73,35,254,252,211,2,31,14,25,14,252,213,37,85,48,57,
+86,25,17,18,108,97,90,135,49,240,5,129,117,23,43,26,253,51,189,208,86,97,
+240,1,198,57,55,196,69,253,240,4,29,55,92,37,143,114,123,65,46,51,31,12,44,
+28,58,75,85,103,137,0,1,0,31,255,236,8,33,5,182,0,70,0,0,33,39,35,6,6,35,
+34,38,39,6,6,35,34,38,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,50,
+54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,50,54,53,17,52,38,35,
+35,53,33,21,35,34,6,21,17,20,22,51,51,21,6,186,30,9,59,173,122,121,171,50,
+59,182,128,191,202,71,97,26,2,84,27,97,71,107,108,154,151,71,97,26,2,84,27,
+97,71,118,95,143,164,72,96,26,2,84,27,97,71,71,97,27,203,115,108,110,115,
+116,109,216,205,3,68,68,71,86,86,74,73,252,182,136,128,165,183,2,254,68,71,
+86,86,74,73,252,207,142,147,219,168,2,207,75,72,86,86,74,73,252,28,73,74,
+86,0,1,0,39,254,20,5,225,5,182,0,32,0,0,1,52,38,35,35,53,33,1,17,52,38,35,
+35,53,33,21,35,34,6,21,17,35,1,17,20,6,35,35,53,51,50,54,53,1,16,71,97,26,
+1,119,2,221,71,97,27,2,2,26,96,72,146,253,0,139,172,47,29,110,94,4,213,68,
+71,86,251,148,3,139,68,71,86,86,72,75,251,51,4,156,251,84,252,224,97,182,
+195,0,1,0,57,254,20,4,240,4,94,0,45,0,0,1,52,38,35,34,6,21,17,20,22,51,51,
+21,33,53,51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,50,22,21,17,20,22,
+51,51,21,33,53,51,50,54,53,3,139,108,117,121,127,70,96,8,253,217,17,97,71,
+73,93,8,1,75,27,10,50,145,125,169,175,62,93,9,253,247,9,93,62,2,195,144,136,
+173,159,254,80,68,69,86,86,74,73,2,127,69,71,86,166,93,93,200,201,252,49,
+74,74,86,86,74,74,255,255,0,115,255,236,5,123,5,205,18,2,2,236,0,0,0,2,0,
+115,254,20,8,172,5,205,0,37,0,50,0,0,1,54,54,51,50,22,21,17,20,22,51,51,21,
+33,53,51,50,54,53,17,52,38,35,34,6,7,3,2,0,33,32,0,17,16,0,33,32,23,0,18,
+51,50,18,17,17,52,38,35,34,2,17,4,236,56,180,122,199,208,74,94,27,253,172,
+27,97,71,113,125,129,125,2,2,3,254,218,254,209,254,226,254,190,1,79,1,56,
+1,71,162,252,115,192,189,222,169,194,158,211,209,4,209,121,129,214,208,250,
+209,70,70,86,86,75,73,5,53,136,128,160,171,254,137,254,180,254,191,1,145,
+1,98,1,100,1,138,252,252,201,254,192,1,18,1,23,1,43,209,223,254,204,254,179,
+0,2,0,113,254,20,6,166,4,94,0,33,0,45,0,0,1,54,54,51,50,22,21,17,20,22,51,
+51,21,33,17,52,38,35,34,6,21,21,16,2,35,34,2,17,16,18,51,50,22,23,0,22,51,
+50,54,53,52,38,35,34,6,21,3,205,48,138,107,128,144,63,93,8,254,156,73,77,
+84,80,230,229,223,237,234,231,136,193,56,253,116,129,135,137,128,127,138,
+137,127,3,129,122,99,176,168,251,248,75,73,86,4,226,119,110,148,157,131,254,
+223,254,230,1,36,1,23,1,31,1,24,108,113,253,176,219,219,246,239,220,216,243,
+0,2,0,20,0,0,5,35,5,182,0,38,0,47,0,0,1,50,4,21,20,4,33,35,17,20,22,51,51,
+21,33,53,51,50,54,53,17,52,38,35,34,6,21,20,22,23,6,6,35,34,38,53,52,54,51,
+1,51,50,54,53,52,38,35,35,3,43,248,1,0,254,229,254,246,129,71,97,67,253,132,
+26,97,71,58,79,57,60,16,17,14,37,25,56,57,145,167,1,49,108,189,160,151,167,
+139,5,182,220,208,215,250,254,166,69,68,86,86,74,73,3,240,69,70,72,65,34,
+48,24,14,17,72,53,119,112,252,228,166,194,180,158,0,2,0,37,254,20,4,121,6,
+31,0,48,0,60,0,0,1,20,6,7,51,54,54,51,50,18,17,16,2,35,34,38,39,35,20,22,
+21,21,20,22,51,51,21,33,53,51,50,54,53,17,52,54,51,50,22,21,20,6,35,52,38,
+35,34,6,21,18,6,21,20,22,51,50,54,53,52,38,35,1,158,5,3,8,54,153,106,210,
+208,207,211,108,156,49,8,8,71,97,6,253,217,16,97,71,169,173,110,130,76,82,
+55,51,70,55,128,128,132,148,128,124,118,136,4,74,47,91,47,109,96,254,228,
+254,229,254,227,254,226,91,89,15,191,26,196,69,69,86,86,75,73,5,135,209,201,
+91,71,51,66,87,98,94,136,255,0,196,240,237,203,213,229,218,216,0,2,0,78,255,
+10,5,76,5,182,0,43,0,52,0,0,1,35,34,6,21,21,51,32,4,21,20,6,7,1,22,22,51,
+51,21,35,34,38,39,1,35,21,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,
+53,33,3,51,50,54,53,52,38,35,35,2,162,27,97,71,150,1,9,1,5,157,144,1,25,57,
+98,58,8,29,193,138,70,254,235,170,71,97,27,253,172,26,97,71,71,97,26,2,84,
+195,144,166,147,144,174,139,5,96,68,69,22,198,198,136,188,48,254,67,91,73,
+86,66,119,1,204,176,69,68,86,86,68,69,3,246,68,71,86,252,58,144,175,166,137,
+0,1,0,104,255,236,4,6,5,203,0,39,0,0,36,54,55,22,22,21,20,6,35,34,38,53,52,
+54,36,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,4,6,21,20,22,
+51,2,211,206,62,17,22,247,199,239,241,183,1,117,143,123,115,116,125,75,87,
+223,180,203,225,180,254,145,147,147,146,106,100,83,11,38,31,92,137,205,206,
+145,199,149,137,126,104,129,148,122,67,66,99,141,200,171,163,211,149,135,
+116,117,115,0,1,0,90,255,236,3,72,4,92,0,39,0,0,36,54,55,22,22,21,20,6,35,
+34,38,53,52,62,2,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,4,6,
+21,20,22,51,2,84,172,37,15,20,197,168,194,191,152,232,177,94,90,98,88,72,
+76,183,167,144,190,134,254,210,125,126,110,102,86,68,12,40,28,80,116,170,
+151,132,144,93,95,93,79,85,114,103,61,56,86,108,157,132,123,141,129,87,83,
+83,79,255,255,0,47,0,0,4,129,5,182,18,2,1,112,0,0,0,2,255,125,254,20,2,188,
+6,31,0,25,0,37,0,0,0,38,53,17,6,35,34,38,53,52,54,51,50,22,21,17,20,22,51,
+50,54,55,21,6,6,35,0,38,35,34,6,21,20,22,51,50,54,53,1,98,133,51,68,107,126,
+149,123,129,144,84,71,37,62,32,30,109,43,254,215,67,54,58,62,65,55,65,56,
+254,20,150,168,4,242,23,135,113,113,137,152,133,250,74,105,98,8,6,90,14,19,
+7,81,69,76,57,62,69,67,64,0,1,0,39,254,109,2,162,5,70,0,40,0,0,36,54,55,21,
+20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,6,6,35,34,38,53,17,35,53,50,
+54,55,51,21,33,21,33,17,20,22,51,2,68,62,32,105,108,72,84,17,14,25,47,34,
+61,62,18,38,17,163,134,156,86,133,35,94,1,12,254,244,85,71,88,8,6,202,152,
+151,56,56,25,37,14,17,16,75,73,86,3,3,147,170,2,172,82,116,171,252,117,253,
+78,105,98,0,1,0,20,0,0,4,221,5,182,0,36,0,0,1,19,35,39,38,38,35,35,17,20,
+22,51,51,21,33,53,51,50,54,53,17,35,34,6,21,20,22,23,6,6,35,34,38,53,52,54,
+51,4,211,10,106,11,11,85,74,198,71,97,47,253,131,47,97,71,229,67,71,16,17,
+14,37,25,52,71,158,164,5,182,254,154,88,91,77,251,153,73,74,86,86,68,69,4,
+113,75,62,34,48,25,14,17,82,54,121,120,0,1,0,39,255,236,2,162,6,20,0,37,0,
+0,1,20,22,51,50,54,55,21,6,6,35,34,38,53,17,35,53,50,62,2,51,50,22,21,20,
+6,7,38,38,35,34,6,21,21,33,21,33,1,131,85,71,37,62,32,28,105,49,163,134,156,
+97,130,41,107,78,72,83,17,14,24,48,34,62,61,1,12,254,244,1,35,105,98,8,6,
+90,13,19,147,170,2,172,82,142,242,109,56,56,25,37,14,17,16,76,72,155,117,
+0,1,0,41,254,20,4,190,5,182,0,29,0,0,5,20,22,51,50,54,55,21,6,6,35,34,38,
+53,17,35,34,6,7,7,35,19,33,19,35,39,38,38,35,35,2,217,80,84,25,41,22,22,88,
+35,166,148,196,72,85,11,11,106,10,4,129,10,106,10,10,83,77,199,182,103,92,
+6,6,96,11,20,145,169,6,2,77,91,88,1,102,254,154,88,87,81,0,1,0,86,255,236,
+5,176,5,182,0,43,0,0,0,0,33,32,0,17,52,18,55,55,35,34,6,7,7,35,19,33,3,6,
+6,21,20,22,51,50,54,53,52,38,39,3,33,19,35,39,38,38,35,35,23,22,18,21,5,135,
+254,178,254,199,254,212,254,171,238,227,4,195,93,86,15,14,107,14,2,97,15,
+173,167,203,211,212,208,166,174,14,2,96,14,106,15,15,86,93,195,4,227,238,
+1,31,254,205,1,56,1,17,226,1,26,45,180,55,72,67,1,102,254,84,19,226,226,246,
+227,227,246,222,230,19,1,172,254,154,67,72,55,180,45,254,230,226,0,1,0,31,
+255,236,5,57,5,205,0,35,0,0,0,38,35,52,54,51,50,22,21,20,2,0,35,34,38,53,
+17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,50,0,18,53,4,176,122,138,88,
+66,112,131,220,254,172,171,198,183,71,97,26,2,84,27,97,71,97,89,129,1,14,
+183,4,173,126,74,88,211,191,231,253,231,254,177,199,198,3,92,68,71,86,86,
+74,73,252,133,121,115,1,24,1,201,210,255,255,255,246,0,0,5,55,5,197,18,2,
+2,79,0,0,0,1,0,8,254,20,4,246,4,94,0,49,0,0,1,54,54,51,50,22,21,20,6,7,38,
+38,35,34,6,7,7,1,14,2,35,35,53,50,54,55,1,38,38,35,35,53,33,21,35,34,6,21,
+20,22,23,19,22,22,23,51,54,54,55,3,70,63,135,92,65,77,18,17,19,56,34,48,59,
+22,34,254,233,80,115,183,210,18,168,226,67,254,133,26,56,62,8,1,236,8,61,
+60,7,9,150,27,57,12,8,11,39,26,3,6,189,155,67,54,27,44,13,34,36,65,60,94,
+252,252,220,174,90,97,181,222,3,127,62,47,86,86,47,52,17,35,23,254,147,68,
+171,58,45,129,74,0,1,0,74,0,0,4,102,5,182,0,27,0,0,1,1,33,21,33,1,33,50,54,
+55,55,51,3,33,53,1,33,53,33,1,33,34,6,7,7,35,19,33,4,70,254,172,1,30,254,
+164,254,144,2,4,77,83,10,10,106,10,251,238,1,123,254,225,1,92,1,72,254,67,
+75,83,10,10,106,10,3,203,5,98,253,205,100,253,155,81,87,88,254,154,82,2,121,
+100,2,33,81,87,88,1,102,0,1,0,86,0,0,3,164,4,74,0,27,0,0,37,50,54,55,55,51,
+3,33,53,1,35,53,33,19,33,34,6,7,7,35,19,33,21,1,51,21,33,1,2,184,53,66,21,
+10,86,10,252,188,1,29,215,1,22,246,254,192,65,66,26,2,86,20,3,17,254,243,
+215,254,234,254,248,117,69,99,47,254,180,82,1,176,96,1,115,61,105,8,1,35,
+84,254,108,96,254,115,255,255,0,92,255,233,4,86,5,182,18,2,2,228,0,0,0,2,
+0,125,255,236,4,133,5,182,0,33,0,34,0,0,36,54,55,22,22,21,20,4,35,32,36,53,
+52,36,37,1,53,33,19,35,39,38,38,35,33,1,21,35,34,6,21,20,22,51,7,3,73,218,
+59,17,22,254,245,204,254,254,254,209,1,34,1,21,254,8,3,88,11,86,2,9,58,103,
+254,123,1,200,149,170,193,166,189,57,115,95,79,11,38,31,88,141,230,208,198,
+216,6,2,28,84,254,201,18,77,50,254,21,84,153,136,157,160,25,0,1,0,113,254,
+20,3,246,4,74,0,33,0,0,0,54,55,22,22,21,20,6,35,34,0,53,52,54,55,1,53,33,
+19,35,39,38,38,35,33,1,21,35,34,6,21,20,22,51,2,232,199,36,15,20,226,182,
+209,254,228,255,240,254,70,3,27,12,101,4,11,56,66,254,142,1,147,47,204,206,
+164,162,254,150,90,65,12,40,28,86,119,1,0,216,224,247,14,2,20,101,254,190,
+29,78,51,254,18,84,174,182,182,180,0,1,0,43,254,20,3,121,4,74,0,45,0,0,0,
+54,55,22,22,21,20,6,35,34,38,53,52,54,36,54,53,52,38,35,35,53,1,33,34,6,7,
+7,35,19,33,21,1,21,50,22,21,20,14,3,21,20,22,51,2,43,175,52,16,19,212,181,
+169,212,180,1,85,126,130,109,119,1,65,254,181,62,58,14,4,100,12,2,242,254,
+151,186,214,107,206,244,94,109,93,254,123,89,93,12,40,28,87,118,127,119,127,
+106,27,134,110,105,137,84,1,94,46,83,29,1,66,101,254,123,10,206,136,108,149,
+83,21,64,75,66,79,0,1,0,102,0,0,3,236,6,20,0,43,0,0,0,6,7,51,21,35,6,6,7,
+1,33,50,54,55,55,51,3,33,53,1,54,54,55,33,53,33,54,54,53,52,38,35,34,6,21,
+34,38,53,52,54,51,50,22,21,3,143,50,50,193,252,32,77,43,254,176,1,217,74,
+85,13,9,86,11,252,133,1,74,45,72,29,254,98,1,211,40,34,106,91,106,99,91,85,
+202,179,191,212,4,77,162,87,96,48,98,53,254,119,67,78,45,254,158,150,1,149,
+54,100,47,96,82,149,78,138,149,140,159,67,66,126,148,193,181,0,1,0,66,255,
+236,4,8,5,182,0,37,0,0,1,50,4,21,20,4,35,34,38,53,52,54,51,22,22,51,50,54,
+53,52,38,35,33,17,52,38,35,35,53,33,19,35,39,38,38,35,35,17,2,37,227,1,0,
+254,240,254,197,243,86,67,8,149,146,138,145,147,136,254,244,70,94,10,3,117,
+10,107,10,11,85,74,227,3,141,246,223,216,244,157,131,65,83,156,170,170,180,
+172,183,1,178,76,71,86,254,154,88,91,77,254,61,0,1,0,66,255,236,3,104,4,74,
+0,35,0,0,19,33,19,35,39,38,38,35,35,17,51,50,22,21,20,6,35,34,38,53,52,54,
+51,16,51,50,54,53,52,38,35,35,17,52,38,35,74,2,237,13,101,4,11,55,67,199,
+64,197,212,227,201,165,213,84,57,242,109,116,116,109,242,65,68,4,74,254,237,
+31,78,49,254,229,179,169,174,196,132,105,68,73,254,242,126,122,122,132,1,
+45,68,53,0,1,0,49,255,236,3,23,5,70,0,38,0,0,19,35,53,50,54,55,51,21,33,21,
+33,21,20,30,4,21,20,6,35,34,38,53,52,54,51,20,22,51,50,54,53,52,46,2,53,252,
+156,89,134,31,94,1,13,254,243,20,40,143,98,46,203,172,175,192,68,61,119,117,
+98,113,83,206,84,3,213,82,122,165,252,117,154,108,43,38,66,89,112,70,149,
+172,131,114,59,70,130,136,92,84,74,80,97,131,151,0,2,0,27,254,20,4,121,4,
+94,0,30,0,40,0,0,0,2,4,7,21,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,
+35,53,33,23,51,54,54,51,50,22,21,0,6,21,17,54,0,53,52,38,35,4,121,186,254,
+181,214,69,97,28,253,197,16,97,71,74,94,26,1,102,21,8,54,153,106,198,220,
+253,165,128,224,1,52,132,122,1,235,254,192,190,12,237,69,69,86,86,75,73,4,
+106,70,70,86,185,109,96,241,213,1,67,196,240,254,39,16,1,80,238,151,168,0,
+1,1,233,254,20,2,127,6,20,0,3,0,0,1,51,17,35,1,233,150,150,6,20,248,0,0,2,
+1,33,254,20,3,82,6,20,0,3,0,7,0,0,1,51,17,35,1,51,17,35,1,33,149,149,1,153,
+152,152,6,20,248,0,8,0,248,0,0,1,0,102,254,20,4,2,6,20,0,19,0,0,55,53,33,
+17,33,53,33,17,51,17,33,21,33,17,33,21,33,17,35,17,102,1,131,254,125,1,131,
+150,1,131,254,125,1,131,254,125,150,250,149,1,4,150,2,235,253,21,150,254,
+252,149,253,26,2,230,255,255,0,211,255,242,1,213,5,182,18,2,0,4,0,0,255,255,
+0,78,0,0,10,55,7,115,16,34,0,39,0,0,16,35,0,61,5,209,0,0,16,3,1,76,5,240,
+1,82,255,255,0,78,0,0,9,117,6,33,16,34,0,39,0,0,16,35,0,93,5,209,0,0,16,3,
+1,76,5,166,0,0,255,255,0,113,255,236,8,141,6,33,16,34,0,71,0,0,16,35,0,93,
+4,233,0,0,16,3,1,76,4,190,0,0,255,255,0,78,254,20,7,158,5,182,16,34,0,47,
+0,0,16,3,0,45,4,252,0,0,255,255,0,78,254,20,6,166,6,20,16,34,0,47,0,0,16,
+3,0,77,4,252,0,0,255,255,0,27,254,20,4,37,6,20,16,34,0,79,0,0,16,3,0,77,2,
+123,0,0,255,255,0,78,254,20,8,189,5,182,16,34,0,49,0,0,16,3,0,45,6,27,0,0,
+255,255,0,78,254,20,7,197,6,20,16,34,0,49,0,0,16,3,0,77,6,27,0,0,255,255,
+0,57,254,20,6,211,6,20,16,34,0,81,0,0,16,3,0,77,5,41,0,0,255,255,0,0,0,0,
+5,164,7,115,18,34,0,36,0,0,16,3,1,76,0,152,1,82,255,255,0,102,255,236,4,41,
+6,33,18,34,0,68,0,0,16,2,1,76,232,0,255,255,0,75,0,0,2,167,7,115,18,34,0,
+44,0,0,16,3,1,76,255,42,1,82,255,255,0,28,0,0,2,120,6,33,18,34,0,243,0,0,
+16,3,1,76,254,251,0,0,255,255,0,115,255,236,5,123,7,115,18,34,0,50,0,0,16,
+3,1,76,0,168,1,82,255,255,0,113,255,236,4,45,6,33,18,34,0,82,0,0,16,2,1,76,
+0,0,255,255,0,31,255,236,5,158,7,115,18,34,0,56,0,0,16,3,1,76,0,184,1,82,
+255,255,0,47,255,236,4,229,6,33,18,34,0,88,0,0,16,2,1,76,39,0,255,255,0,31,
+255,236,5,158,8,0,18,34,0,56,0,0,16,3,9,78,0,184,1,82,255,255,0,47,255,236,
+4,229,6,174,18,34,0,88,0,0,16,2,9,78,39,0,255,255,0,31,255,236,5,158,8,74,
+18,34,0,56,0,0,16,3,8,138,0,182,1,82,255,255,0,47,255,236,4,229,6,248,18,
+34,0,88,0,0,16,2,8,138,37,0,255,255,0,31,255,236,5,158,8,74,18,34,0,56,0,
+0,16,3,9,77,0,184,1,82,255,255,0,47,255,236,4,229,6,248,18,34,0,88,0,0,16,
+2,9,77,39,0,255,255,0,31,255,236,5,158,8,74,18,34,0,56,0,0,16,3,8,139,0,186,
+1,82,255,255,0,47,255,236,4,229,6,248,18,34,0,88,0,0,16,2,8,139,41,0,255,
+255,0,102,255,236,3,215,4,94,18,2,4,70,0,0,255,255,0,0,0,0,5,164,8,0,18,34,
+0,36,0,0,16,3,9,78,0,141,1,82,255,255,0,102,255,236,4,41,6,174,18,34,0,68,
+0,0,16,2,9,78,222,0,255,255,0,0,0,0,5,164,8,0,18,34,0,36,0,0,16,3,9,80,0,
+217,1,82,255,255,0,102,255,236,4,41,6,174,18,34,0,68,0,0,16,2,9,80,43,0,255,
+255,0,0,0,0,7,70,6,205,18,34,0,136,0,0,16,3,1,77,2,31,1,102,255,255,0,102,
+255,236,6,84,5,123,18,34,0,168,0,0,16,3,1,77,1,92,0,20,0,1,0,117,255,236,
+5,152,5,203,0,47,0,0,1,33,53,52,38,35,35,53,33,21,35,34,6,21,21,51,21,35,
+21,6,6,35,32,0,17,16,0,33,50,22,21,20,6,35,52,38,35,34,2,17,16,18,33,50,54,
+55,53,33,3,33,1,10,75,93,8,2,20,8,82,59,158,158,103,218,132,254,174,254,146,
+1,125,1,80,214,238,107,83,143,128,244,237,250,1,4,59,111,43,254,246,1,156,
+39,71,68,86,86,74,74,30,101,237,48,46,1,138,1,103,1,94,1,144,126,104,62,81,
+119,145,254,203,254,180,254,178,254,209,12,13,190,0,3,0,47,254,20,4,106,4,
+137,0,60,0,76,0,88,0,0,0,6,35,52,38,35,34,6,7,22,22,21,20,6,35,34,38,39,6,
+6,21,20,22,51,51,50,22,21,51,21,35,6,4,35,34,38,53,52,54,55,38,38,53,52,54,
+55,38,38,53,52,54,51,50,22,23,54,54,51,50,22,21,1,33,38,38,35,35,34,6,21,
+20,22,51,50,54,55,33,2,22,51,50,54,53,52,38,35,34,6,21,4,53,53,55,34,34,26,
+42,20,35,45,193,176,28,61,17,40,59,52,75,232,169,169,114,131,37,254,253,230,
+214,212,139,117,50,63,64,70,85,100,197,188,72,131,31,61,93,44,61,60,253,195,
+1,86,3,90,114,201,118,107,132,132,159,177,25,254,178,172,86,100,95,87,84,
+100,98,86,3,243,63,31,39,12,13,43,117,88,161,191,5,3,20,60,47,39,38,163,159,
+96,126,145,158,141,106,136,21,21,90,57,61,89,42,35,169,105,182,197,40,27,
+65,45,63,43,251,100,70,69,97,97,112,99,82,88,3,68,123,114,142,139,131,134,
+139,255,255,0,117,255,236,5,143,7,115,18,34,0,42,0,0,16,3,1,76,0,221,1,82,
+255,255,0,47,254,20,4,53,6,33,18,34,0,74,0,0,16,2,1,76,198,0,255,255,0,78,
+0,0,5,178,7,115,18,34,0,46,0,0,16,3,1,76,0,190,1,82,255,255,0,37,0,0,4,176,
+7,166,18,34,0,78,0,0,16,3,1,76,0,8,1,133,0,2,0,115,254,20,5,123,5,205,0,32,
+0,44,0,0,4,54,55,35,32,0,17,16,0,33,32,0,17,16,2,7,51,6,6,21,20,22,51,50,
+54,55,21,6,6,35,34,38,53,2,18,51,50,18,17,16,2,35,34,2,17,2,70,104,78,4,254,
+203,254,176,1,79,1,56,1,42,1,87,246,219,2,81,109,73,68,28,64,37,30,98,30,
+131,149,240,207,211,211,205,204,210,211,209,191,136,35,1,138,1,105,1,100,
+1,138,254,112,254,160,254,220,254,125,54,25,127,84,63,66,9,8,111,15,18,109,
+117,2,156,254,200,1,53,1,78,1,76,1,53,254,204,254,179,0,2,0,113,254,20,4,
+45,4,94,0,31,0,43,0,0,4,54,55,38,2,17,16,18,51,50,18,17,20,2,7,51,6,6,21,
+20,22,51,50,54,55,21,6,6,35,34,38,53,2,22,51,50,54,53,52,38,35,34,6,21,1,
+145,103,78,227,242,242,239,231,244,162,157,10,80,111,75,67,28,64,37,30,98,
+30,136,145,90,137,144,143,135,133,147,146,133,191,135,36,2,1,38,1,19,1,31,
+1,24,254,222,254,235,236,254,240,43,25,126,85,64,65,9,8,111,15,18,114,112,
+2,60,220,218,247,241,218,219,240,255,255,0,115,254,20,5,123,6,185,18,34,3,
+227,0,0,16,3,1,77,0,244,1,82,255,255,0,113,254,20,4,45,5,103,18,34,3,228,
+0,0,16,2,1,77,74,0,255,255,0,92,255,233,4,86,7,115,18,34,2,228,0,0,16,3,1,
+76,0,20,1,82,255,255,0,82,254,20,3,240,6,33,18,34,2,229,0,0,16,2,1,76,206,
+0,255,255,0,78,0,0,10,55,5,182,16,34,0,39,0,0,16,3,0,61,5,209,0,0,255,255,
+0,78,0,0,9,117,5,182,16,34,0,39,0,0,16,3,0,93,5,209,0,0,255,255,0,113,255,
+236,8,141,6,20,16,34,0,71,0,0,16,3,0,93,4,233,0,0,255,255,0,117,255,236,5,
+143,7,142,18,34,0,42,0,0,16,3,0,118,1,49,1,109,255,255,0,47,254,20,4,53,6,
+33,18,34,0,74,0,0,16,2,0,118,43,0,255,255,0,78,255,236,8,100,5,182,18,2,3,
+14,0,0,0,2,0,37,254,20,5,55,5,203,0,30,0,40,0,0,1,20,22,51,51,21,33,53,51,
+50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,50,18,21,20,2,0,7,53,36,0,17,
+52,38,35,34,6,21,1,182,70,98,27,253,172,26,97,71,72,96,26,1,102,31,8,66,206,
+148,230,251,238,254,90,237,1,31,1,127,160,153,162,195,254,254,73,75,86,86,
+72,76,5,207,75,72,86,202,103,120,254,242,238,231,254,95,254,214,49,106,79,
+1,231,1,71,184,176,222,165,255,255,0,78,0,0,5,225,7,142,18,34,0,49,0,0,16,
+3,0,67,0,106,1,109,255,255,0,57,0,0,4,240,6,33,18,34,0,81,0,0,16,2,0,67,6,
+0,255,255,0,0,0,0,5,164,7,115,18,34,0,36,0,0,16,3,3,113,5,33,1,82,255,255,
+0,86,255,236,4,41,6,33,18,34,0,68,0,0,16,3,3,113,4,123,0,0,255,255,0,0,0,
+0,5,164,7,68,18,34,0,36,0,0,16,3,4,239,2,219,1,82,255,255,0,102,255,236,4,
+41,5,242,18,34,0,68,0,0,16,3,4,239,2,43,0,0,255,255,0,78,0,0,4,166,7,115,
+18,34,0,40,0,0,16,3,3,113,4,205,1,82,255,255,0,78,255,236,3,225,6,33,18,34,
+0,72,0,0,16,3,3,113,4,115,0,0,255,255,0,78,0,0,4,166,7,68,18,34,0,40,0,0,
+16,3,4,239,2,125,1,82,255,255,0,113,255,236,3,225,5,242,18,34,0,72,0,0,16,
+3,4,239,2,55,0,0,255,255,255,162,0,0,2,162,7,115,18,34,0,44,0,0,16,3,3,113,
+3,199,1,82,255,255,255,113,0,0,2,117,6,33,18,34,0,243,0,0,16,3,3,113,3,150,
+0,0,255,255,0,78,0,0,2,162,7,68,18,34,0,44,0,0,16,3,4,239,1,119,1,82,255,
+255,0,20,0,0,2,117,5,242,18,34,0,243,0,0,16,3,4,239,1,51,0,0,255,255,0,115,
+255,236,5,123,7,115,18,34,0,50,0,0,16,3,3,113,5,90,1,82,255,255,0,113,255,
+236,4,45,6,33,18,34,0,82,0,0,16,3,3,113,4,168,0,0,255,255,0,115,255,236,5,
+123,7,68,18,34,0,50,0,0,16,3,4,239,2,248,1,82,255,255,0,113,255,236,4,45,
+5,242,18,34,0,82,0,0,16,3,4,239,2,78,0,0,255,255,0,78,0,0,5,76,7,115,18,34,
+0,53,0,0,16,3,3,113,4,156,1,82,255,255,0,53,0,0,3,166,6,33,18,34,0,85,0,0,
+16,3,3,113,4,90,0,0,255,255,0,78,0,0,5,76,7,68,18,34,0,53,0,0,16,3,4,239,
+2,119,1,82,255,255,0,68,0,0,3,166,5,242,18,34,0,85,0,0,16,3,4,239,1,246,0,
+0,255,255,0,31,255,236,5,158,7,115,18,34,0,56,0,0,16,3,3,113,5,106,1,82,255,
+255,0,47,255,236,4,229,6,33,18,34,0,88,0,0,16,3,3,113,4,197,0,0,255,255,0,
+31,255,236,5,158,7,68,18,34,0,56,0,0,16,3,4,239,3,6,1,82,255,255,0,47,255,
+236,4,229,5,242,18,34,0,88,0,0,16,3,4,239,2,117,0,0,255,255,0,92,255,233,
+4,86,5,203,18,2,1,177,0,0,0,1,0,25,254,20,3,152,4,94,0,44,0,0,18,38,53,52,
+54,51,20,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,21,34,38,
+53,52,54,51,50,22,21,20,6,7,22,22,21,20,4,35,239,214,88,73,130,114,149,142,
+174,172,109,101,141,147,106,96,103,96,81,71,189,164,192,207,143,131,168,172,
+254,255,233,254,20,142,106,68,82,143,156,190,191,185,192,92,159,166,114,124,
+132,128,55,62,103,138,183,165,131,180,43,32,207,177,238,254,255,255,0,78,
+0,0,6,10,7,142,18,34,0,43,0,0,16,3,1,76,0,221,1,109,255,255,0,37,0,0,4,219,
+7,166,18,34,0,75,0,0,16,3,1,76,0,59,1,133,0,1,0,78,254,20,6,31,5,203,0,45,
+0,0,1,51,54,54,51,50,22,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,
+34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,1,211,8,
+79,223,141,224,230,74,94,27,253,172,26,97,71,143,154,180,209,71,97,27,253,
+172,26,96,72,72,96,26,1,102,4,205,124,130,232,231,250,250,70,70,86,86,72,
+76,5,10,152,155,218,169,253,49,73,74,86,86,72,75,3,228,75,72,86,0,2,0,113,
+254,20,5,43,6,20,0,41,0,53,0,0,5,20,22,51,50,54,55,21,6,6,35,34,38,53,53,
+52,54,55,35,6,6,35,34,2,17,16,18,51,50,22,23,51,52,38,53,53,52,38,35,35,53,
+33,0,54,53,52,38,35,34,6,21,20,22,51,4,12,85,71,37,62,32,29,111,42,164,133,
+9,3,10,50,157,109,209,208,207,210,106,155,53,12,12,71,97,17,1,121,254,190,
+130,135,146,128,124,123,131,180,105,98,8,6,90,14,19,150,168,174,46,92,46,
+103,101,1,24,1,31,1,32,1,27,88,92,20,176,29,168,68,71,86,250,91,194,242,240,
+200,215,227,228,206,0,2,0,115,255,236,4,199,5,203,0,35,0,47,0,0,1,50,22,21,
+20,6,7,22,22,21,20,0,33,32,36,53,52,54,55,38,38,53,52,54,51,6,6,21,20,22,
+51,50,54,53,52,38,0,22,51,50,54,53,52,38,35,34,6,21,3,127,121,135,147,121,
+160,180,254,221,254,248,254,249,254,222,174,155,119,139,141,117,19,28,139,
+132,126,146,19,253,183,171,161,155,178,164,167,167,167,5,203,153,132,98,176,
+45,47,221,156,219,255,0,247,230,161,214,47,44,171,102,142,145,39,142,67,144,
+161,163,140,82,114,251,130,189,191,174,186,178,179,185,0,2,0,113,255,236,
+4,45,6,31,0,35,0,47,0,0,18,54,55,6,6,21,20,22,51,50,54,53,52,38,39,22,22,
+21,20,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,18,22,51,50,54,53,52,
+38,35,34,6,21,164,131,127,23,37,111,119,118,109,36,23,127,131,124,106,143,
+138,245,236,231,244,141,141,108,123,147,136,145,144,134,133,147,147,132,5,
+100,163,24,47,146,102,167,136,133,170,102,146,47,24,162,134,105,182,38,52,
+228,165,251,246,255,242,175,224,48,41,172,110,252,51,188,186,209,203,186,
+186,203,0,2,0,74,254,162,4,131,5,182,0,25,0,26,0,0,37,50,22,21,20,6,7,54,
+54,53,52,38,35,33,53,1,33,34,6,7,7,35,19,33,21,1,37,3,100,142,145,109,94,
+18,17,66,108,253,29,3,0,254,67,75,83,10,10,106,10,3,203,252,254,3,34,102,
+102,123,85,124,18,43,100,27,94,86,82,4,254,81,87,88,1,102,84,251,4,176,0,
+2,0,86,254,176,3,182,4,74,0,25,0,26,0,0,51,53,1,33,34,6,7,7,35,19,33,21,1,
+33,50,22,21,20,6,7,54,54,53,52,38,35,37,86,2,82,254,192,65,66,26,2,86,20,
+3,17,253,172,1,84,143,143,97,97,20,12,66,108,1,62,82,3,131,61,105,8,1,35,
+84,252,127,117,123,83,111,19,51,90,15,94,86,215,255,255,0,0,0,0,5,164,7,71,
+18,34,0,36,0,0,16,3,1,79,1,125,1,82,255,255,0,102,255,236,4,41,5,245,18,34,
+0,68,0,0,16,3,1,79,0,215,0,0,0,1,0,78,254,20,4,166,5,182,0,53,0,0,0,6,35,
+34,38,39,53,22,22,51,50,54,53,52,38,39,55,33,53,51,50,54,53,17,52,38,35,35,
+53,33,19,35,39,38,38,35,33,17,33,21,33,17,33,50,54,55,55,51,3,33,7,22,22,
+21,3,125,139,131,34,83,41,37,74,28,59,66,87,67,37,253,234,26,97,71,72,96,
+26,4,8,10,106,10,10,92,79,254,168,1,238,254,18,1,139,85,98,12,14,107,14,254,
+47,17,100,99,254,145,125,12,11,104,8,8,62,53,60,60,5,141,86,68,69,3,238,75,
+72,86,254,154,88,83,85,253,223,100,253,155,87,81,88,254,154,70,8,99,81,0,
+2,0,113,254,20,3,225,4,94,0,43,0,50,0,0,0,6,35,34,38,39,53,22,22,51,50,54,
+53,52,38,39,55,38,2,53,16,18,51,50,22,21,21,33,22,22,51,50,54,55,22,22,21,
+20,6,7,7,22,22,21,0,6,7,33,52,38,35,3,25,140,131,34,83,40,37,74,28,59,66,
+83,71,33,188,207,236,218,204,222,253,86,4,146,155,96,158,39,14,25,189,155,
+10,100,99,254,168,123,11,1,215,110,113,254,145,125,12,11,104,8,8,62,53,56,
+65,4,127,24,1,37,238,1,31,1,34,255,234,94,214,212,82,61,6,38,26,72,126,4,
+50,8,99,81,4,242,185,178,179,184,255,255,0,115,255,236,5,123,8,0,18,34,0,
+50,0,0,16,3,9,78,0,168,1,82,255,255,0,113,255,236,4,45,6,174,18,34,0,82,0,
+0,16,2,9,78,0,0,255,255,0,115,255,236,5,123,8,0,18,34,0,50,0,0,16,3,9,79,
+0,248,1,82,255,255,0,113,255,236,4,45,6,174,18,34,0,82,0,0,16,2,9,79,78,0,
+255,255,0,115,255,236,5,123,7,71,18,34,0,50,0,0,16,3,1,79,1,164,1,82,255,
+255,0,113,255,236,4,45,5,245,18,34,0,82,0,0,16,3,1,79,0,250,0,0,255,255,0,
+115,255,236,5,123,8,0,18,34,0,50,0,0,16,3,9,80,0,247,1,82,255,255,0,113,255,
+236,4,45,6,174,18,34,0,82,0,0,16,2,9,80,78,0,255,255,255,246,0,0,5,6,6,205,
+18,34,0,60,0,0,16,3,1,77,0,147,1,102,255,255,0,8,254,20,4,133,5,123,18,34,
+0,92,0,0,16,2,1,77,98,20,0,2,0,37,255,193,2,254,6,20,0,25,0,38,0,0,4,38,39,
+6,6,7,39,54,54,55,17,52,38,35,35,53,33,17,54,51,50,22,21,20,6,35,2,6,7,21,
+20,22,51,50,54,53,52,38,35,1,137,133,24,26,43,15,107,29,88,59,71,97,16,1,
+121,42,46,125,139,149,123,17,43,20,56,65,58,62,81,74,20,98,96,49,119,69,28,
+119,185,63,3,231,68,71,86,251,175,12,132,100,114,137,1,124,8,8,94,78,76,77,
+58,60,69,0,2,0,57,255,193,5,172,4,94,0,52,0,65,0,0,1,54,51,50,22,21,20,6,
+35,34,38,39,6,6,7,39,54,54,55,17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,
+51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,50,22,21,18,6,7,21,20,22,
+51,50,54,53,52,38,35,4,76,42,46,125,139,149,123,101,133,24,26,43,15,107,29,
+88,59,108,117,121,127,70,96,8,253,217,17,97,71,73,93,8,1,75,27,10,50,145,
+125,169,175,63,43,20,56,65,58,62,81,74,1,195,12,132,100,114,137,98,96,49,
+119,69,28,119,185,63,1,119,144,136,173,159,254,80,68,69,86,86,74,73,2,127,
+69,71,86,166,93,93,200,201,254,155,8,8,94,78,76,77,58,60,69,0,2,0,18,255,
+193,2,227,5,70,0,29,0,42,0,0,4,38,39,6,6,7,39,54,54,55,17,35,53,50,54,55,
+51,21,33,21,33,17,54,51,50,22,21,20,6,35,2,6,7,21,20,22,51,50,54,53,52,38,
+35,1,107,130,24,28,41,15,107,29,89,59,156,86,133,35,94,1,12,254,244,43,45,
+125,139,149,123,17,43,20,56,65,59,62,81,75,20,98,96,49,119,69,28,119,185,
+63,2,137,82,116,171,252,117,253,238,12,132,100,114,137,1,124,8,8,94,78,76,
+77,58,61,68,0,3,0,113,255,236,6,231,6,20,0,40,0,52,0,64,0,0,4,38,39,35,6,
+6,35,34,2,17,16,18,51,50,22,23,51,38,38,53,53,52,38,35,35,53,33,17,20,6,7,
+51,54,54,51,50,18,17,16,2,35,2,6,21,20,22,51,50,54,53,52,38,35,32,6,21,20,
+22,51,50,54,53,52,38,35,4,163,185,58,8,48,179,134,233,229,208,209,107,155,
+52,8,3,5,71,97,17,1,121,5,3,8,52,155,107,209,208,229,233,139,130,129,152,
+134,118,118,136,252,143,123,118,134,152,129,130,149,20,109,110,102,117,1,
+28,1,31,1,31,1,24,98,107,77,121,69,151,68,71,86,254,136,69,121,77,107,98,
+254,232,254,225,254,225,254,228,3,239,194,242,253,212,227,240,218,216,206,
+228,245,222,212,253,242,194,0,3,0,113,254,20,6,231,4,94,0,45,0,57,0,69,0,
+0,0,22,23,51,54,54,51,50,18,17,16,2,35,34,38,39,35,22,22,21,21,20,22,51,51,
+21,33,53,51,50,54,53,53,52,54,55,35,6,6,35,34,2,17,16,18,51,18,54,53,52,38,
+35,34,6,21,20,22,51,0,6,21,20,22,51,50,54,53,52,38,35,2,186,187,51,8,47,186,
+128,217,245,207,210,104,159,51,8,2,6,77,99,9,253,206,17,97,71,5,3,8,50,152,
+112,209,208,241,219,139,132,136,145,127,125,124,130,2,92,133,139,142,127,
+125,126,128,4,94,123,108,113,118,254,221,254,236,254,224,254,229,99,93,48,
+154,42,196,68,70,86,86,75,73,184,65,105,76,102,90,1,24,1,31,1,20,1,39,252,
+17,202,244,244,211,226,231,231,213,3,133,209,246,226,220,217,231,234,219,
+0,4,0,0,255,137,5,164,6,20,0,34,0,43,0,52,0,55,0,0,1,3,51,21,35,7,35,55,33,
+53,51,50,54,55,1,51,23,19,51,3,1,22,22,51,51,21,33,53,51,50,53,52,38,39,39,
+37,51,19,38,38,39,6,6,7,0,22,23,19,35,7,6,6,21,1,3,51,2,147,174,15,51,52,
+112,51,254,176,39,63,56,37,1,198,160,72,127,112,188,1,84,25,60,60,27,253,
+205,47,123,9,8,82,254,13,139,178,26,44,14,13,37,44,254,237,31,29,170,133,
+78,9,10,1,246,117,213,1,233,254,109,86,119,119,86,65,95,4,192,198,1,36,254,
+78,252,97,67,42,86,86,98,17,36,23,229,103,1,156,74,133,63,61,127,117,252,
+206,44,11,1,137,215,24,47,17,2,162,254,244,0,2,0,117,255,137,4,164,6,20,0,
+39,0,48,0,0,0,22,23,55,51,7,22,22,21,20,6,35,52,38,39,1,22,22,51,50,54,55,
+22,22,21,20,6,35,34,38,39,7,35,55,38,2,53,16,0,33,0,18,23,1,38,35,34,2,17,
+3,41,65,29,27,108,32,91,91,101,77,27,29,254,156,37,86,49,124,180,67,17,22,
+241,200,51,92,43,37,108,49,165,175,1,92,1,53,254,82,83,81,1,102,39,57,217,
+209,5,203,5,3,81,104,29,105,65,63,80,48,95,37,251,137,17,15,84,90,11,38,31,
+91,138,11,11,121,158,82,1,101,255,1,92,1,146,252,88,254,247,75,4,125,18,254,
+202,254,181,0,2,0,113,254,88,3,160,5,182,0,38,0,47,0,0,4,39,3,35,19,38,2,
+53,16,18,51,50,22,23,19,51,3,22,22,21,20,6,35,52,38,39,3,22,22,51,50,54,55,
+22,22,21,20,6,35,0,22,23,19,38,35,34,6,21,2,24,42,93,104,98,141,141,228,228,
+19,37,20,80,104,84,89,92,92,91,15,17,187,22,49,26,95,142,35,15,20,191,157,
+254,243,57,62,191,23,29,138,120,20,6,254,102,1,178,52,1,15,210,1,33,1,30,
+2,2,1,92,254,142,28,94,61,71,58,47,82,31,252,207,6,4,80,63,12,40,28,79,117,
+1,168,187,49,3,74,6,229,242,0,1,0,78,0,0,4,166,5,182,0,33,0,0,51,53,51,50,
+54,53,17,35,53,51,17,52,38,35,35,53,33,21,35,34,6,21,17,33,21,33,17,33,50,
+54,55,55,51,3,78,26,96,72,194,194,72,96,26,2,84,27,97,71,1,25,254,231,1,148,
+73,93,14,20,107,14,86,72,75,1,226,100,1,158,75,72,86,86,71,68,254,90,100,
+253,155,91,94,153,254,72,0,2,0,41,255,137,4,190,6,20,0,34,0,37,0,0,1,17,35,
+34,6,7,7,35,19,33,55,51,7,51,19,35,39,38,38,39,1,17,20,22,51,51,21,33,53,
+50,54,53,53,1,35,1,19,35,2,10,196,72,85,11,11,106,10,3,160,55,117,55,108,
+10,106,10,6,31,37,254,217,71,97,47,253,178,97,71,254,183,119,2,143,193,193,
+2,152,2,184,77,91,88,1,102,94,94,254,154,88,45,77,21,253,252,253,182,73,74,
+86,86,68,69,234,253,192,4,119,1,80,0,1,0,92,254,20,3,141,4,92,0,57,0,0,18,
+54,51,20,22,51,50,54,53,52,38,36,38,53,52,54,51,50,22,21,20,6,35,52,38,35,
+34,6,21,20,30,2,21,20,6,7,30,2,51,50,54,53,22,22,21,20,6,35,34,46,3,39,38,
+53,92,76,53,113,108,107,119,124,254,203,129,209,177,136,163,77,71,85,91,97,
+98,192,230,140,181,168,72,43,65,33,44,51,54,62,119,94,101,109,41,101,211,
+30,11,1,7,75,129,131,102,84,83,86,133,142,119,137,152,105,83,56,67,103,114,
+86,78,96,97,95,144,125,143,162,14,60,225,57,76,87,2,70,55,78,90,123,223,119,
+72,82,30,40,0,1,0,86,254,20,4,6,4,74,0,31,0,0,51,53,1,33,34,6,7,7,35,19,33,
+21,1,30,3,51,50,54,55,22,22,21,20,6,35,34,38,2,38,35,86,2,72,254,192,65,66,
+26,3,86,21,3,16,253,172,99,128,102,102,57,54,67,2,44,62,125,96,123,153,112,
+134,123,82,3,131,61,105,8,1,35,84,252,112,12,122,227,99,92,84,2,74,53,78,
+103,139,1,9,88,0,1,0,74,0,0,3,137,5,203,0,33,0,0,0,6,7,17,20,22,51,51,21,
+33,53,51,50,54,53,17,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,
+3,137,161,181,71,97,27,253,172,26,96,72,209,150,124,114,119,122,75,87,223,
+180,198,230,3,142,249,96,254,180,73,74,86,86,72,75,1,183,96,184,142,129,157,
+136,134,67,66,99,141,222,178,0,1,0,37,0,0,3,10,4,94,0,35,0,0,1,55,54,54,53,
+52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,7,21,20,22,51,51,21,33,
+53,51,50,54,53,1,33,180,74,69,113,98,114,115,62,73,193,173,172,203,103,100,
+94,71,97,17,253,206,27,100,58,1,188,129,52,118,91,84,92,132,135,72,57,110,
+136,172,149,125,176,68,66,139,69,68,86,86,68,69,0,3,0,41,0,0,4,190,5,182,
+0,29,0,42,0,51,0,0,0,6,7,21,22,22,21,20,4,33,33,53,51,50,54,53,53,35,53,51,
+17,52,38,35,35,53,33,32,4,21,1,33,21,33,17,51,50,54,53,52,38,35,35,53,51,
+50,54,53,52,38,35,35,4,129,121,133,151,164,254,251,254,247,253,158,26,96,
+72,231,231,71,97,26,2,37,1,7,1,7,253,94,1,2,254,254,199,173,144,147,166,203,
+142,170,143,138,180,137,3,212,162,44,8,26,194,151,198,197,86,72,75,136,100,
+3,0,68,71,86,176,190,253,141,100,254,245,134,165,176,138,102,122,157,147,
+117,0,2,0,20,255,236,5,168,5,182,0,40,0,49,0,0,4,38,53,17,35,53,51,17,52,
+38,35,35,53,33,21,35,34,6,21,17,33,17,52,38,35,35,53,33,21,35,34,6,21,17,
+51,21,35,17,20,4,35,54,54,53,17,33,17,20,22,51,1,224,255,205,205,71,97,26,
+2,84,27,97,71,2,174,71,97,26,2,2,27,97,71,205,205,254,250,240,196,181,253,
+82,175,167,20,229,233,1,17,100,1,166,68,71,86,86,74,73,254,98,1,166,68,71,
+86,86,74,73,254,98,100,254,215,208,230,122,168,152,1,37,254,227,161,167,255,
+255,0,2,0,0,5,104,5,182,18,2,1,105,0,0,0,3,0,78,255,137,4,166,6,20,0,38,0,
+45,0,48,0,0,33,33,53,51,50,54,53,17,52,38,35,35,53,33,55,51,7,51,19,35,39,
+38,38,39,3,51,21,35,3,33,50,54,55,55,51,3,33,7,35,19,51,19,38,38,35,33,17,
+19,35,1,188,254,146,26,97,71,72,96,26,3,53,31,108,30,102,10,106,10,5,21,20,
+151,166,199,190,1,34,85,98,12,14,107,14,253,145,37,108,71,219,168,9,23,11,
+254,168,189,189,86,68,69,3,238,75,72,86,94,94,254,154,88,32,58,23,254,22,
+100,253,155,87,81,88,254,154,119,3,166,2,29,2,2,251,31,2,92,0,4,0,113,254,
+88,3,225,5,182,0,34,0,42,0,47,0,52,0,0,4,39,3,35,19,38,2,53,16,18,51,50,22,
+23,19,51,3,22,22,21,21,33,3,22,22,51,50,54,55,22,22,21,20,6,35,19,38,38,35,
+34,6,7,51,7,22,22,23,19,37,52,38,39,3,2,16,55,92,105,101,128,136,236,218,
+14,28,14,79,105,84,128,142,254,115,92,25,56,31,96,158,39,14,25,201,159,10,
+8,18,9,114,123,11,201,205,2,51,50,78,1,38,43,51,71,20,12,254,96,1,191,58,
+1,8,196,1,31,1,34,2,2,1,92,254,144,42,233,190,94,254,102,8,8,82,61,6,38,26,
+75,127,4,0,2,2,185,178,110,128,172,51,1,95,110,108,163,45,254,196,0,1,255,
+233,254,20,2,199,5,182,0,29,0,0,3,51,50,54,53,17,35,53,51,17,52,38,35,35,
+53,33,21,35,34,6,21,17,51,21,35,17,20,6,35,35,23,19,149,127,231,231,71,97,
+26,2,84,27,97,71,232,232,232,235,35,254,117,184,193,2,221,100,1,166,68,71,
+86,86,74,73,254,98,100,253,37,239,237,0,2,255,231,254,20,2,82,6,20,0,24,0,
+36,0,0,1,17,51,21,35,17,20,6,35,35,53,51,50,54,53,17,35,53,51,53,52,38,35,
+35,53,18,54,51,50,22,21,20,6,35,34,38,53,1,158,180,180,198,208,33,15,124,
+107,201,201,73,93,8,146,56,60,61,56,59,58,57,59,4,74,254,45,96,253,217,242,
+234,97,183,194,2,41,96,241,69,71,86,1,137,65,67,59,60,67,64,63,0,2,0,115,
+254,20,6,98,5,205,0,36,0,48,0,0,37,35,6,6,35,32,0,17,16,0,33,50,22,23,51,
+55,33,21,35,34,6,21,17,20,22,51,50,54,55,21,6,6,35,34,38,53,53,0,18,51,50,
+18,17,16,2,35,34,2,17,4,164,8,77,225,153,254,224,254,190,1,68,1,38,151,234,
+62,8,31,1,102,27,97,71,81,83,25,42,21,24,88,33,165,148,252,190,202,216,216,
+200,198,216,217,203,254,144,130,1,145,1,98,1,96,1,142,135,121,233,86,74,73,
+250,125,103,92,6,6,96,12,19,145,169,178,1,155,254,224,1,30,1,68,1,67,1,29,
+254,227,254,189,0,2,0,113,254,20,5,43,4,94,0,38,0,50,0,0,5,52,54,55,35,6,
+6,35,34,2,17,16,18,51,50,22,23,51,55,33,21,35,34,6,21,17,20,22,51,50,54,55,
+21,6,6,35,34,38,53,2,54,53,52,38,35,34,6,21,20,22,51,3,76,5,3,8,51,155,108,
+209,208,207,210,106,155,53,12,37,1,72,17,98,70,85,71,37,62,32,29,111,42,164,
+133,130,130,135,146,128,124,123,131,82,69,121,76,105,99,1,24,1,31,1,32,1,
+27,88,92,160,86,75,73,251,236,105,98,8,6,90,14,19,150,168,1,29,194,242,240,
+200,215,227,228,206,0,2,0,41,0,0,5,76,5,182,0,40,0,49,0,0,37,22,22,51,51,
+21,35,34,38,39,1,35,17,20,22,51,51,21,33,53,51,50,54,53,17,35,53,51,17,52,
+38,35,35,53,33,32,4,21,20,6,7,37,51,50,54,53,52,38,35,35,4,111,57,98,58,8,
+29,177,149,75,254,235,170,71,97,27,253,172,26,97,71,231,231,71,97,26,2,39,
+1,9,1,5,157,144,254,137,144,167,146,144,174,139,250,91,73,86,57,127,1,205,
+254,90,69,68,86,86,68,69,1,166,96,1,240,68,71,86,197,198,135,190,48,47,146,
+174,166,137,0,1,0,20,0,0,3,166,4,94,0,43,0,0,33,33,53,51,50,54,53,17,35,53,
+51,53,52,38,35,35,53,33,23,51,62,2,51,50,22,21,20,6,35,52,38,35,34,6,7,33,
+21,33,17,20,22,51,51,2,147,253,177,6,97,71,222,222,74,94,6,1,59,39,10,46,
+65,95,75,112,109,88,103,48,60,76,103,18,1,17,254,235,71,97,57,86,74,73,1,
+46,96,241,70,70,86,203,106,75,42,78,71,65,81,84,76,182,170,96,254,200,69,
+68,0,2,255,246,0,0,5,6,5,182,0,52,0,61,0,0,33,53,51,50,54,53,17,1,33,53,51,
+39,38,38,35,35,53,33,21,35,34,6,21,20,22,23,23,33,54,54,53,52,38,35,35,53,
+33,21,35,34,6,7,7,51,21,33,1,17,20,22,51,51,21,1,23,22,22,23,54,54,55,55,
+1,70,47,97,71,254,250,254,243,211,59,40,60,46,26,2,51,76,46,44,25,12,20,1,
+232,20,17,63,60,60,1,244,24,47,74,49,31,209,254,246,255,0,72,95,48,254,49,
+75,36,50,17,15,61,47,73,86,68,69,1,131,1,197,100,105,68,40,86,86,30,35,29,
+58,22,39,35,63,25,45,45,86,86,73,86,54,100,254,59,254,135,76,71,86,4,39,135,
+63,124,47,36,115,83,135,0,2,0,0,254,20,4,133,4,74,0,49,0,59,0,0,1,21,35,34,
+6,7,7,51,21,35,3,14,2,35,35,53,50,54,55,1,33,53,51,39,38,38,35,35,53,33,21,
+35,34,6,21,20,22,23,23,33,55,54,54,53,52,38,35,35,53,3,54,54,55,55,33,23,
+22,22,23,4,133,8,63,56,35,51,213,248,225,80,115,183,210,18,168,226,67,254,
+254,254,231,240,80,30,55,59,8,1,236,8,61,60,7,9,51,1,121,39,9,9,66,67,8,90,
+11,39,26,65,254,207,60,27,57,12,4,74,86,65,95,139,97,253,144,220,174,90,97,
+181,222,2,96,97,190,66,43,86,86,47,52,17,35,23,125,110,25,46,17,54,47,86,
+252,102,45,129,74,192,143,68,171,58,0,2,0,88,255,236,4,27,4,94,0,35,0,46,
+0,0,36,54,53,50,22,21,20,6,35,34,38,53,17,52,38,35,35,53,33,23,51,62,2,51,
+50,22,21,20,6,7,7,21,20,22,51,18,38,35,34,6,21,21,55,54,54,53,2,188,91,86,
+88,198,171,201,174,54,71,8,1,21,32,17,63,74,104,78,149,169,232,235,170,93,
+97,248,81,85,124,148,131,162,145,82,97,126,58,71,95,101,170,184,2,18,84,64,
+86,176,85,68,43,171,156,164,157,7,6,123,152,100,3,46,95,153,131,166,6,7,116,
+131,0,2,0,113,255,236,4,197,4,94,0,28,0,40,0,0,4,38,39,35,6,6,35,34,2,17,
+16,18,51,50,22,23,51,55,51,17,20,22,51,50,55,21,6,6,35,36,54,53,52,38,35,
+34,6,21,20,22,51,3,202,109,9,8,51,155,108,203,214,211,225,94,149,52,12,39,
+141,47,60,40,38,26,71,47,254,149,130,135,146,128,124,123,131,20,100,104,105,
+99,1,11,1,23,1,46,1,34,89,91,160,252,151,68,69,6,90,11,13,131,194,242,240,
+200,215,227,228,206,0,2,0,37,255,236,4,121,4,94,0,28,0,40,0,0,0,22,23,51,
+54,54,51,50,18,17,16,2,35,34,38,39,35,7,35,17,52,38,35,34,7,53,54,54,51,4,
+6,21,20,22,51,50,54,53,52,38,35,1,33,107,10,8,54,153,106,202,216,213,223,
+105,146,44,13,39,141,46,60,42,36,26,71,46,1,106,128,132,148,128,124,118,136,
+4,94,101,104,109,96,254,245,254,232,254,210,254,223,101,79,160,3,104,68,70,
+6,90,11,13,131,196,240,237,203,213,229,218,216,0,2,0,37,255,236,4,121,6,31,
+0,40,0,52,0,0,1,20,6,7,51,54,54,51,50,18,17,16,2,35,34,38,39,35,7,33,53,51,
+50,54,53,17,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,18,6,21,20,22,51,50,
+54,53,52,38,35,1,158,5,3,8,54,153,106,210,208,207,211,108,156,49,13,36,254,
+184,16,97,71,169,173,110,130,76,82,55,51,70,55,128,128,132,148,128,124,118,
+136,4,156,69,121,77,109,96,254,228,254,229,254,227,254,226,91,89,160,86,74,
+73,3,158,209,199,91,71,51,66,87,98,94,136,255,0,196,240,237,203,213,229,218,
+216,0,1,0,72,255,236,3,127,4,94,0,29,0,0,36,54,53,52,38,35,34,6,21,34,38,
+53,52,54,51,50,18,17,16,2,35,34,38,53,52,54,51,20,22,51,2,49,135,118,140,
+89,85,91,91,206,150,230,227,237,216,179,191,99,83,73,113,82,239,224,240,231,
+117,119,58,71,94,115,254,224,254,225,254,238,254,223,113,108,62,77,146,112,
+0,2,0,113,255,178,3,199,4,94,0,39,0,51,0,0,1,52,38,35,34,6,21,20,22,23,54,
+54,51,50,22,21,20,6,35,34,38,39,6,6,7,39,54,54,55,38,38,53,16,18,51,50,22,
+21,20,6,2,6,7,22,22,51,50,54,53,52,38,35,2,231,85,89,138,120,18,17,68,170,
+118,124,141,210,169,69,132,57,13,24,12,103,17,32,17,60,71,228,228,151,206,
+92,216,144,68,37,95,60,123,127,80,72,3,12,118,118,229,242,69,119,50,99,98,
+124,99,134,167,34,35,29,63,35,41,43,82,37,68,206,144,1,33,1,30,116,93,71,
+58,254,133,93,109,42,44,92,74,65,57,0,2,0,113,254,20,5,43,6,20,0,41,0,53,
+0,0,33,52,54,55,35,6,6,35,34,2,17,16,18,51,50,22,23,51,52,38,53,53,52,38,
+35,35,53,33,17,20,22,51,50,54,55,21,6,6,35,34,38,53,2,54,53,52,38,35,34,6,
+21,20,22,51,3,76,6,2,8,51,155,108,209,208,207,210,106,155,53,12,12,71,97,
+17,1,121,85,71,37,62,32,29,111,42,164,133,130,130,135,146,128,124,123,131,
+46,92,46,105,99,1,24,1,31,1,32,1,27,88,92,20,176,29,168,68,71,86,249,56,105,
+98,8,6,90,14,19,150,168,1,29,194,242,240,200,215,227,228,206,0,2,0,113,255,
+236,5,145,6,31,0,40,0,52,0,0,1,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,
+17,20,22,51,51,21,33,39,35,6,6,35,34,2,17,16,18,51,50,22,23,51,52,38,53,2,
+54,53,52,38,35,34,6,21,20,22,51,3,76,168,174,111,128,76,81,56,51,70,55,71,
+97,17,254,165,22,8,51,155,108,209,208,207,210,106,155,53,12,12,130,130,135,
+146,128,124,123,131,4,133,209,201,92,70,51,66,88,97,94,136,252,6,68,71,86,
+184,105,99,1,24,1,31,1,32,1,27,88,92,14,133,17,252,33,194,242,240,200,215,
+227,228,206,0,2,0,102,255,236,3,215,4,94,0,22,0,29,0,0,4,38,53,52,54,55,22,
+22,51,50,54,55,33,53,52,54,51,50,18,17,16,2,35,2,6,21,33,38,38,35,1,92,201,
+25,14,44,156,93,155,146,4,253,86,222,204,218,237,251,224,88,111,1,215,11,
+122,115,20,127,75,26,38,6,65,78,212,214,94,234,255,254,222,254,225,254,248,
+254,215,4,4,183,180,178,185,0,2,0,102,255,236,3,215,4,94,0,22,0,29,0,0,0,
+18,17,16,2,35,34,38,53,53,33,38,38,35,34,6,7,38,38,53,52,54,51,18,54,55,33,
+20,22,51,2,218,253,237,218,203,223,2,170,4,146,155,93,156,44,14,25,200,161,
+139,122,11,254,41,111,112,4,94,254,215,254,248,254,225,254,222,252,237,94,
+214,212,78,65,6,37,26,75,128,251,252,185,178,180,183,0,3,0,102,255,236,5,
+143,4,94,0,44,0,51,0,52,0,0,0,22,23,55,23,22,22,51,50,54,55,22,22,21,20,6,
+35,34,38,39,39,7,22,22,21,16,2,35,34,38,53,53,37,38,38,35,34,6,7,38,38,53,
+52,54,51,18,54,53,5,20,22,51,5,2,176,237,40,125,51,18,59,35,39,57,19,25,30,
+88,71,88,104,36,20,37,2,2,237,218,203,223,2,162,20,146,131,93,156,44,14,25,
+200,161,154,122,254,37,114,109,2,52,4,94,197,184,37,178,63,52,39,29,14,53,
+31,50,79,116,127,72,10,17,36,17,254,225,254,222,252,237,14,199,153,154,78,
+65,6,37,26,75,128,251,252,234,245,141,164,174,90,255,255,0,102,255,236,3,
+123,4,92,18,2,3,21,0,0,255,255,0,82,255,236,3,121,4,92,18,2,1,209,0,0,0,3,
+0,82,255,236,4,195,4,92,0,61,0,62,0,63,0,0,36,54,53,52,38,35,35,53,51,50,
+54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,23,55,23,22,22,51,50,54,55,
+22,22,21,20,6,35,34,38,39,6,6,7,21,22,22,21,20,6,35,34,38,53,52,51,20,22,
+51,5,3,2,65,113,127,112,191,193,96,110,94,90,103,108,81,81,199,178,133,180,
+37,56,51,19,58,36,38,58,18,25,31,92,68,84,102,37,23,100,66,125,117,227,213,
+178,189,151,120,106,2,30,147,78,129,112,104,97,111,106,90,95,100,118,103,
+58,65,85,107,84,76,17,178,63,52,39,29,14,54,31,52,77,105,125,60,87,21,11,
+31,128,95,157,180,120,101,131,117,137,78,3,64,0,2,0,113,255,236,4,0,4,94,
+0,18,0,39,0,0,5,34,2,17,16,18,51,50,22,21,20,6,7,21,22,22,21,20,6,0,6,21,
+20,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,2,76,236,239,247,234,
+181,214,113,94,125,117,226,254,141,116,137,144,115,118,127,112,109,111,97,
+110,107,98,20,1,30,1,29,1,23,1,32,155,134,81,133,31,11,31,128,95,157,180,
+4,6,226,235,245,220,123,113,103,97,111,108,88,83,100,0,1,255,231,254,20,2,
+82,4,74,0,24,0,0,1,17,51,21,35,17,20,6,35,35,53,51,50,54,53,17,35,53,51,17,
+52,38,35,35,53,1,158,180,180,198,208,33,15,124,107,201,201,73,93,8,4,74,253,
+227,96,254,35,242,234,97,183,194,1,223,96,1,59,69,71,86,0,2,0,113,254,20,
+5,145,6,31,0,52,0,64,0,0,37,16,6,35,34,38,53,52,54,51,20,22,51,50,54,53,53,
+52,54,53,35,6,6,35,34,2,17,16,18,51,50,22,23,51,38,38,53,53,52,54,51,50,22,
+21,20,6,35,52,38,35,34,6,21,0,54,53,52,38,35,34,6,21,20,22,51,4,12,208,222,
+205,206,91,81,102,131,116,128,8,8,52,155,107,211,206,204,213,106,155,53,12,
+4,8,168,174,111,128,76,81,56,51,70,55,254,188,132,135,146,134,118,121,133,
+18,255,0,254,115,107,63,76,147,111,179,173,57,43,137,5,107,98,1,17,1,28,1,
+28,1,21,88,92,41,112,11,55,209,201,92,70,51,66,88,97,94,136,251,168,191,235,
+232,198,216,216,226,198,0,2,0,113,254,20,4,197,4,94,0,40,0,52,0,0,37,16,6,
+35,34,38,53,52,54,51,20,22,51,50,54,53,53,52,54,53,35,6,6,35,34,2,17,16,18,
+51,50,22,23,51,55,33,21,35,34,6,21,0,54,53,52,38,35,34,6,21,20,22,51,4,12,
+208,222,205,206,91,81,102,131,116,128,7,7,52,155,107,211,206,204,213,106,
+155,53,12,37,1,72,17,98,70,254,188,132,135,146,134,118,121,133,18,255,0,254,
+115,107,63,76,147,111,179,173,57,45,133,7,107,98,1,17,1,28,1,28,1,21,88,92,
+160,86,75,73,253,35,191,235,232,198,216,216,226,198,0,1,0,113,255,236,4,131,
+4,94,0,39,0,0,1,53,33,21,35,34,6,21,17,6,6,35,34,0,17,16,0,51,50,22,21,20,
+6,35,52,38,35,34,6,21,20,22,51,50,54,55,53,52,38,35,2,123,2,8,12,88,54,73,
+188,111,253,254,249,1,15,243,160,223,92,91,103,99,159,155,154,160,51,88,45,
+67,95,1,213,82,82,68,79,254,247,37,40,1,39,1,20,1,4,1,51,116,93,71,58,113,
+123,224,241,237,224,14,13,215,70,67,0,2,0,8,254,20,4,156,4,74,0,43,0,55,0,
+0,37,22,22,21,20,6,35,34,38,53,52,54,55,1,38,38,35,35,53,33,21,35,34,6,21,
+20,22,23,19,19,54,54,53,52,38,35,35,53,33,21,35,34,6,7,0,38,39,6,6,21,20,
+22,51,50,54,53,2,178,62,63,125,119,93,109,62,75,254,166,34,53,57,8,2,17,27,
+64,59,12,11,225,231,8,11,67,68,15,1,189,25,71,58,27,254,138,31,33,45,39,41,
+35,31,41,221,136,234,72,130,141,114,97,89,197,138,2,248,70,39,86,86,39,47,
+17,50,21,254,16,1,225,19,54,15,53,48,86,86,105,55,251,226,134,84,83,151,58,
+50,63,60,63,0,2,255,231,255,236,4,203,4,94,0,41,0,53,0,0,0,54,55,38,38,35,
+34,6,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,7,38,38,35,34,6,
+7,22,22,21,20,6,35,34,38,53,36,38,39,6,6,21,20,22,51,50,54,53,1,109,82,75,
+82,213,90,42,38,6,31,45,102,95,123,247,105,125,224,89,65,77,18,17,19,56,34,
+85,202,96,58,73,131,106,122,107,1,18,37,31,45,51,43,37,45,39,1,26,217,126,
+150,192,33,29,6,43,29,62,73,157,154,156,155,67,54,27,44,13,34,36,141,125,
+104,244,101,132,156,119,118,75,153,75,86,162,63,66,61,70,71,0,1,0,57,254,
+20,4,240,4,74,0,42,0,0,1,53,33,21,35,34,6,21,17,20,22,51,51,21,33,17,52,54,
+55,35,6,35,34,38,53,17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,
+2,201,2,39,17,98,70,74,94,17,254,135,6,2,10,94,207,186,177,62,93,9,1,101,
+108,117,121,127,69,97,3,244,86,86,75,73,251,150,70,70,86,1,228,53,92,29,186,
+202,199,1,227,74,74,86,253,61,144,136,173,158,1,176,68,70,0,1,0,37,0,0,4,
+219,6,31,0,51,0,0,1,20,6,7,51,54,51,50,22,21,17,20,22,51,51,21,33,17,52,38,
+35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,54,51,50,22,21,20,6,
+35,52,38,35,34,6,21,1,158,6,2,10,92,209,181,181,63,93,8,254,156,108,117,121,
+127,69,97,8,253,217,16,97,71,169,173,110,130,76,82,55,51,70,55,4,82,53,92,
+29,186,199,202,254,28,75,72,86,2,195,144,136,174,158,254,80,70,67,86,86,74,
+73,3,158,209,199,91,71,51,66,87,98,94,136,0,1,0,37,254,20,4,55,6,31,0,60,
+0,0,55,51,50,54,53,17,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,21,20,6,
+7,51,54,51,50,22,21,17,20,6,35,34,38,53,52,54,55,20,22,51,50,54,53,17,52,
+38,35,34,6,21,17,20,22,51,51,21,33,37,16,97,71,169,173,110,130,76,82,55,51,
+70,55,6,2,10,92,209,181,181,163,158,125,141,76,81,54,53,79,52,108,117,121,
+127,69,97,8,253,217,86,74,73,3,156,209,201,91,71,51,66,87,98,94,136,137,53,
+92,29,186,199,202,253,35,235,241,88,74,56,79,2,105,91,185,186,2,213,144,136,
+174,158,254,80,70,67,86,0,2,0,20,0,0,2,123,6,20,0,26,0,38,0,0,55,50,54,53,
+17,35,53,51,53,52,38,35,35,53,33,17,51,21,35,17,20,22,51,51,21,33,53,18,54,
+51,50,22,21,20,6,35,34,38,53,74,97,71,222,222,73,93,8,1,110,201,201,71,97,
+27,253,186,166,56,61,60,56,59,57,58,59,86,68,69,1,56,96,241,69,71,86,254,
+45,96,254,210,73,74,86,86,5,124,66,67,59,60,67,65,62,255,255,0,201,255,236,
+2,168,4,74,18,2,1,134,0,0,0,1,0,47,0,0,2,117,4,74,0,23,0,0,19,52,38,35,35,
+53,33,21,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,242,71,97,27,2,70,
+27,97,71,71,97,27,253,186,27,97,71,3,96,73,75,86,86,69,69,253,127,73,74,86,
+86,68,69,0,1,0,10,0,0,2,227,6,20,0,45,0,0,0,54,55,51,6,6,35,34,34,39,17,20,
+22,51,51,21,33,53,51,50,54,53,17,38,38,35,34,6,7,35,54,54,51,50,23,17,52,
+38,35,35,53,33,17,22,22,51,2,78,48,9,92,7,112,96,14,27,12,71,97,27,253,186,
+27,97,71,20,38,18,43,49,9,92,7,114,96,26,26,71,97,27,1,131,20,37,19,3,33,
+43,65,111,130,4,254,73,73,74,86,86,74,73,2,27,11,14,44,65,112,130,6,1,151,
+68,71,86,253,37,11,13,0,2,0,10,0,0,2,174,6,20,0,33,0,44,0,0,55,50,54,53,17,
+35,34,38,53,52,54,51,50,22,23,17,52,38,35,35,53,33,17,51,21,35,17,20,22,51,
+51,21,33,53,18,22,51,51,53,52,38,35,34,6,21,109,95,72,22,123,121,113,96,14,
+29,14,71,96,27,1,131,217,217,71,97,27,253,176,49,66,71,18,39,38,37,41,86,
+71,76,1,185,93,101,74,109,4,5,1,33,68,71,86,252,244,102,254,71,73,74,86,86,
+2,230,52,60,52,60,47,31,0,1,0,25,254,20,2,147,6,20,0,20,0,0,19,52,38,35,35,
+53,33,17,20,22,51,50,54,55,21,6,6,35,34,38,53,180,57,90,8,1,92,84,71,38,62,
+31,30,109,43,164,133,5,51,69,70,86,249,56,105,98,8,6,90,14,19,150,168,0,1,
+0,27,254,20,4,188,6,20,0,47,0,0,55,50,54,53,17,52,38,35,35,53,33,17,33,21,
+1,22,22,21,20,0,35,34,38,53,52,54,51,20,22,51,50,54,53,52,38,35,35,53,1,33,
+17,20,22,51,51,21,33,53,53,97,71,71,97,26,1,131,2,233,254,70,250,245,254,
+222,232,197,206,76,75,134,116,151,175,206,204,47,1,148,253,221,72,96,26,253,
+187,86,74,73,4,74,68,71,86,254,54,101,253,236,14,228,207,241,254,245,110,
+91,65,66,98,135,202,191,182,174,84,1,238,253,67,75,72,86,86,0,1,0,57,255,
+236,7,86,4,74,0,61,0,0,1,53,33,21,35,34,6,21,17,20,22,51,51,21,33,39,35,6,
+6,35,34,38,39,35,6,6,35,34,38,53,17,52,38,35,35,53,33,17,20,22,51,50,54,53,
+17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,5,47,2,39,27,93,64,
+62,93,9,254,190,27,10,52,139,118,112,151,34,16,51,150,121,167,167,62,93,9,
+1,101,104,111,111,116,63,93,8,1,101,104,111,115,122,69,97,3,244,86,86,72,
+76,253,129,69,70,86,166,97,89,95,91,96,90,203,198,1,227,74,74,86,253,61,144,
+136,158,147,1,192,75,73,86,253,61,144,136,172,159,1,176,68,70,0,1,0,57,254,
+20,7,86,4,74,0,64,0,0,1,53,33,21,35,34,6,21,17,20,22,51,51,21,33,17,52,54,
+55,35,6,6,35,34,38,39,35,6,6,35,34,38,53,17,52,38,35,35,53,33,17,20,22,51,
+50,54,53,17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,5,47,2,39,
+27,93,64,65,90,29,254,135,5,3,10,52,139,118,112,151,34,16,51,150,121,167,
+167,62,93,9,1,101,104,111,111,116,63,93,8,1,101,104,111,115,122,69,97,3,244,
+86,86,72,76,251,150,71,69,86,1,236,40,84,42,97,89,95,91,96,90,203,198,1,227,
+74,74,86,253,61,144,136,158,147,1,192,75,73,86,253,61,144,136,172,159,1,176,
+68,70,0,1,0,57,254,20,6,178,4,94,0,70,0,0,1,52,38,35,34,6,21,17,20,22,51,
+51,21,33,17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,
+35,35,53,33,23,51,54,54,51,50,22,23,51,54,54,51,50,22,21,17,20,6,35,34,38,
+53,52,54,55,20,22,51,50,54,53,5,242,104,111,111,117,65,93,6,254,156,104,111,
+116,122,71,97,6,253,217,27,93,65,67,91,6,1,65,27,10,53,138,118,112,151,34,
+17,52,147,122,164,170,163,158,124,143,77,81,54,53,75,56,2,195,144,136,158,
+147,254,63,76,71,86,2,195,144,136,173,159,254,80,69,68,86,86,72,75,2,127,
+71,69,86,166,98,88,95,91,95,91,201,200,253,35,235,241,87,75,56,79,2,105,99,
+182,197,0,1,255,102,254,20,4,240,4,94,0,44,0,0,5,20,6,35,34,38,53,52,54,55,
+20,22,51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,50,22,21,17,20,22,51,
+51,21,33,17,52,38,35,34,6,21,1,178,163,158,124,143,77,81,54,53,75,56,73,93,
+8,1,75,27,10,50,145,125,169,175,62,93,9,254,155,108,117,121,127,16,235,241,
+87,75,56,79,2,105,99,182,197,3,122,69,71,86,166,93,93,200,201,254,28,74,73,
+86,2,195,144,136,173,159,0,1,0,57,254,20,5,106,4,94,0,47,0,0,1,52,38,35,34,
+6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,
+51,50,22,21,17,20,22,51,50,54,55,21,6,6,35,34,38,53,3,139,108,117,121,127,
+70,96,8,253,217,17,97,71,73,93,8,1,75,27,10,50,145,125,169,175,84,71,38,62,
+31,30,109,43,164,133,2,195,144,136,173,159,254,80,68,69,86,86,74,73,2,127,
+69,71,86,166,93,93,200,201,252,127,105,98,8,6,90,14,19,150,168,0,1,0,57,0,
+0,5,31,4,74,0,34,0,0,33,1,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,
+35,53,33,1,17,52,38,35,35,53,33,21,35,34,6,21,17,3,229,253,121,70,96,19,254,
+34,17,97,71,74,94,17,1,78,2,115,73,93,18,1,221,17,97,71,3,68,253,155,68,69,
+86,86,68,69,2,137,70,70,86,252,219,2,67,69,71,86,86,69,69,252,150,0,3,0,113,
+255,236,4,45,4,94,0,11,0,18,0,25,0,0,0,2,35,34,2,17,16,18,51,50,18,17,0,54,
+55,33,22,22,51,2,6,7,33,38,38,35,4,45,245,236,230,245,242,239,231,244,254,
+175,134,4,253,209,4,137,140,145,128,8,2,45,9,135,134,1,6,254,230,1,36,1,23,
+1,31,1,24,254,222,254,235,254,47,208,222,224,206,3,156,199,199,213,185,0,
+2,0,113,255,236,5,252,4,94,0,32,0,45,0,0,33,6,6,35,34,2,17,16,18,51,50,22,
+23,33,19,35,39,38,38,35,33,17,33,21,33,17,33,50,54,55,55,51,3,36,54,55,17,
+38,38,35,34,6,21,20,22,51,3,20,45,98,57,230,245,242,239,54,97,43,2,164,13,
+88,11,17,59,67,254,248,1,131,254,125,1,22,96,78,13,8,88,12,252,151,101,40,
+40,102,56,145,134,136,145,12,8,1,36,1,23,1,31,1,24,8,12,254,184,68,103,63,
+254,129,97,254,82,64,102,68,254,184,80,6,20,3,103,23,16,222,243,245,226,0,
+2,0,113,255,236,5,180,4,94,0,18,0,48,0,0,0,2,35,34,38,39,35,6,6,35,34,2,17,
+16,0,33,32,0,17,2,38,35,34,6,21,20,22,51,50,54,55,38,38,53,52,54,51,50,22,
+21,20,6,7,22,22,51,50,54,53,5,180,205,182,98,152,32,9,31,151,100,183,204,
+1,104,1,62,1,46,1,111,198,229,249,240,233,115,104,90,101,18,18,29,53,41,46,
+49,25,22,15,100,93,96,124,1,3,254,233,113,97,94,116,1,24,1,0,1,18,1,72,254,
+183,254,239,1,13,231,247,253,211,215,120,130,55,151,60,85,75,83,77,50,140,
+76,120,130,227,199,255,255,0,113,254,20,5,35,6,20,18,2,1,147,0,0,0,1,0,31,
+255,236,3,129,4,74,0,36,0,0,1,33,21,35,34,6,21,17,20,22,51,51,21,33,39,35,
+14,2,35,34,38,53,52,54,51,20,22,51,50,18,53,17,52,38,35,35,1,49,2,80,8,96,
+70,69,97,8,254,197,39,11,43,61,98,78,113,108,95,95,49,60,93,107,71,97,57,
+4,74,86,73,75,253,129,67,72,86,203,98,77,48,78,71,71,74,83,76,1,8,174,1,65,
+69,69,0,1,0,31,255,236,3,129,6,20,0,31,0,0,37,20,22,51,51,21,33,39,35,14,
+2,35,34,38,53,52,54,51,20,22,51,50,18,53,17,52,38,35,35,53,33,2,211,69,97,
+8,254,197,39,11,43,61,98,78,113,108,95,95,49,60,93,107,71,97,57,1,162,225,
+67,72,86,203,98,77,48,78,71,71,74,83,76,1,8,174,3,12,69,68,86,0,1,0,31,254,
+20,3,242,4,74,0,46,0,0,5,20,22,51,50,54,55,21,6,6,35,34,38,53,53,52,54,55,
+35,14,2,35,34,38,53,52,54,51,20,22,51,50,18,53,17,52,38,35,35,53,33,21,35,
+34,6,21,2,211,84,72,37,62,32,29,111,43,162,135,8,5,11,43,61,98,78,113,108,
+95,95,49,60,93,107,71,97,57,2,80,8,96,70,180,105,98,8,6,90,13,20,148,170,
+174,51,101,51,98,77,48,78,71,71,74,83,76,1,8,174,1,65,69,69,86,86,73,75,0,
+1,0,68,254,20,3,166,4,94,0,35,0,0,1,33,53,51,50,54,53,17,52,38,35,35,53,33,
+23,51,54,54,51,50,22,21,20,6,35,52,38,35,34,2,21,17,20,22,51,51,2,147,253,
+177,8,96,70,73,93,8,1,59,39,10,40,153,112,93,104,88,103,48,60,92,109,71,97,
+57,254,20,86,73,75,4,106,69,71,86,203,117,106,78,71,65,81,84,76,254,251,177,
+252,211,69,69,0,1,0,68,254,20,3,166,4,94,0,37,0,0,5,20,22,51,50,54,55,21,
+6,6,35,34,38,53,17,52,38,35,35,53,33,23,51,54,54,51,50,22,21,20,6,35,52,38,
+35,34,2,21,1,178,85,71,37,62,32,29,111,42,164,133,73,93,8,1,59,39,10,40,153,
+112,93,104,88,103,48,60,92,109,180,105,98,8,6,90,14,19,150,168,4,22,69,71,
+86,203,117,106,78,71,65,81,84,76,254,251,177,0,1,0,47,0,0,3,125,4,94,0,27,
+0,0,19,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,17,20,22,51,51,21,33,53,
+51,50,54,53,221,176,176,153,167,88,103,70,67,79,72,71,97,57,253,176,8,95,
+71,2,203,197,206,102,92,56,63,110,109,152,165,254,28,69,68,86,86,72,75,0,
+1,0,31,254,20,3,109,4,94,0,27,0,0,1,20,22,51,51,21,33,53,51,50,54,53,17,52,
+38,35,34,6,21,34,38,53,52,54,51,50,22,21,2,190,70,96,9,253,176,57,97,71,72,
+80,66,71,103,87,167,152,176,176,254,254,75,73,86,86,69,69,3,207,166,151,109,
+110,63,56,93,101,205,198,0,2,0,47,0,0,4,119,4,74,0,36,0,45,0,0,1,35,17,20,
+22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,50,22,21,20,6,7,19,22,
+22,51,51,21,35,34,38,39,1,17,51,50,54,53,52,38,35,2,72,150,71,97,27,253,186,
+27,97,71,73,93,8,2,43,203,210,150,118,201,54,62,37,21,70,105,131,63,254,172,
+178,108,118,118,108,1,227,254,252,69,68,86,86,68,69,2,137,69,71,86,148,143,
+110,154,23,254,201,83,40,86,59,107,3,70,254,90,113,104,97,108,0,2,0,47,0,
+0,4,119,4,74,0,37,0,46,0,0,1,62,2,51,51,21,35,34,6,7,3,22,22,21,20,6,35,33,
+53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,51,19,50,54,53,52,38,
+35,35,17,3,6,46,68,102,83,70,21,37,62,54,201,118,150,199,214,253,192,29,97,
+69,69,97,8,2,38,16,97,71,150,28,108,118,118,108,178,3,164,76,57,33,86,40,
+83,254,201,23,155,109,137,154,86,72,67,2,137,68,70,86,86,69,69,254,252,253,
+248,108,97,104,113,254,90,0,1,0,92,254,109,3,66,4,92,0,56,0,0,23,20,22,51,
+50,54,55,22,22,21,20,6,35,34,38,53,17,52,54,51,20,22,51,50,54,53,52,38,36,
+38,53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,20,30,2,21,20,6,35,34,38,
+39,201,57,61,34,48,25,14,17,84,72,107,102,76,53,113,108,107,119,124,254,203,
+129,209,177,136,163,77,71,85,91,97,98,192,230,140,212,192,71,120,38,100,72,
+76,16,17,14,37,25,56,56,147,156,1,41,66,75,129,131,102,84,83,86,133,142,119,
+137,152,105,83,56,67,103,114,86,78,96,97,95,144,125,151,170,34,31,0,1,255,
+106,254,20,3,59,6,31,0,31,0,0,5,20,6,35,34,38,53,52,54,55,20,22,51,50,54,
+53,17,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,1,182,163,158,124,143,77,
+81,54,53,79,52,168,174,111,128,76,81,56,51,70,55,16,235,241,87,75,56,79,2,
+105,91,185,186,4,151,209,201,92,70,51,66,88,97,94,136,0,1,255,231,254,20,
+3,35,6,31,0,33,0,0,1,51,21,35,17,20,6,35,35,53,51,50,54,53,17,35,53,51,17,
+52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,1,158,200,200,198,208,33,15,124,
+107,201,201,169,173,110,130,76,82,55,51,70,55,2,45,96,254,35,242,234,97,183,
+194,1,223,96,2,88,209,201,91,71,51,66,87,98,94,136,0,1,255,113,254,20,3,66,
+4,94,0,31,0,0,19,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,17,20,22,51,
+50,54,53,22,22,21,20,6,35,34,38,53,246,49,76,52,55,81,76,128,111,174,168,
+56,75,53,54,81,77,141,126,158,163,3,27,126,103,97,87,65,51,70,92,201,208,
+253,41,197,182,99,105,2,79,56,73,89,241,235,0,2,255,129,254,20,3,59,6,31,
+0,35,0,48,0,0,5,22,22,23,7,38,38,39,6,6,35,34,38,53,52,54,51,50,22,23,17,
+52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,2,54,53,53,38,38,35,34,6,21,20,
+22,51,1,182,73,113,35,102,22,63,38,15,147,139,112,148,154,141,20,38,20,168,
+174,111,128,76,81,56,51,70,55,252,60,20,43,21,87,91,72,59,55,47,145,99,43,
+62,98,39,157,145,145,122,107,138,3,3,4,119,209,201,92,70,51,66,88,97,94,136,
+249,174,107,118,60,5,3,76,67,69,81,0,1,0,47,255,4,2,170,4,94,0,24,0,0,18,
+6,7,53,54,54,51,50,22,21,17,51,21,34,6,7,35,53,33,53,33,17,52,38,35,141,62,
+32,29,110,43,165,132,156,83,136,35,94,254,244,1,12,85,71,3,242,8,7,90,13,
+20,150,167,253,84,82,115,172,252,117,2,178,105,98,0,1,0,39,254,20,2,162,5,
+70,0,24,0,0,0,54,55,21,6,6,35,34,38,53,17,35,53,50,54,55,51,21,33,21,33,17,
+20,22,51,2,68,62,32,29,111,42,164,133,156,86,133,35,94,1,12,254,244,85,71,
+254,129,8,6,90,14,19,150,168,4,131,82,116,171,252,117,251,119,105,98,0,2,
+0,20,255,236,5,0,4,74,0,38,0,47,0,0,1,51,21,35,17,20,22,51,51,21,33,39,35,
+6,6,35,34,38,53,53,35,53,51,53,52,38,35,35,53,33,17,33,53,52,38,35,35,53,
+33,0,54,53,53,33,21,20,22,51,4,55,201,201,70,96,8,254,187,27,10,53,153,126,
+172,166,201,201,73,93,8,1,111,1,217,70,96,8,1,110,254,187,133,254,39,104,
+111,2,119,96,254,200,68,69,86,166,95,91,201,200,154,96,241,69,71,86,254,45,
+233,75,73,86,252,37,170,161,93,144,153,127,0,1,0,74,255,236,4,100,4,74,0,
+41,0,0,36,6,35,34,38,53,52,54,55,55,35,34,6,7,35,19,33,3,6,6,21,20,22,51,
+50,54,53,52,38,39,3,33,19,35,38,38,35,35,23,22,22,21,4,53,245,236,229,246,
+166,147,2,133,71,55,9,94,12,1,201,11,101,112,137,144,145,134,113,100,11,1,
+201,12,94,9,55,71,133,2,146,167,211,231,239,227,153,201,29,117,43,90,1,29,
+254,186,11,172,143,191,169,171,189,147,168,11,1,70,254,227,90,43,115,31,203,
+151,255,255,0,37,255,236,4,78,4,90,18,2,1,146,0,0,0,1,0,6,0,0,4,154,4,74,
+0,38,0,0,37,21,33,53,51,50,53,52,38,39,3,38,38,39,35,6,6,7,3,6,6,21,20,22,
+51,51,21,33,53,51,50,54,55,1,51,1,22,22,51,4,154,254,0,26,123,8,8,140,22,
+59,9,8,11,86,3,148,9,9,67,68,14,254,74,25,64,58,33,1,68,186,1,74,24,59,60,
+86,86,86,98,17,36,23,1,131,60,200,47,48,225,7,254,112,24,47,17,52,48,86,86,
+69,91,3,84,252,121,65,44,0,1,0,2,0,0,6,227,4,74,0,53,0,0,33,3,38,38,39,35,
+6,6,7,3,6,6,21,20,22,51,51,21,33,53,51,50,54,55,1,51,19,23,1,51,1,22,22,51,
+51,21,33,53,51,50,54,53,52,38,39,3,38,38,39,35,6,6,7,3,3,23,205,38,42,6,8,
+10,39,31,103,8,10,67,68,14,254,74,27,66,60,27,1,8,164,244,37,1,35,161,1,13,
+20,57,64,10,254,6,27,62,61,10,6,97,14,49,6,8,8,47,29,213,2,100,117,152,37,
+51,149,100,254,183,26,60,17,52,48,86,86,70,90,3,84,253,41,135,3,94,252,121,
+59,50,86,86,35,51,17,48,23,1,88,52,225,37,39,173,81,253,143,0,1,0,0,0,0,4,
+125,6,20,0,47,0,0,49,53,51,50,54,55,1,62,2,51,51,21,34,6,7,1,22,22,51,51,
+21,33,53,51,50,54,53,52,38,39,3,38,38,39,35,6,6,7,3,6,6,21,20,22,51,51,21,
+8,63,56,35,1,45,80,118,182,208,18,180,212,59,1,123,24,56,64,8,254,20,9,61,
+59,7,9,149,25,61,11,8,11,39,26,137,9,9,65,68,8,86,65,95,3,59,221,175,87,96,
+167,203,252,129,59,50,86,86,46,52,17,36,23,1,109,57,184,56,45,129,74,254,
+112,24,47,17,52,48,86,0,1,0,10,0,0,4,119,4,74,0,44,0,0,1,17,20,22,51,51,21,
+33,53,51,50,54,53,17,1,38,38,35,35,53,33,21,35,34,6,21,20,22,23,23,55,54,
+54,53,52,38,35,35,53,33,21,35,34,6,7,2,164,71,97,26,253,187,26,97,71,254,
+230,42,84,38,27,2,17,11,63,59,29,38,143,138,28,27,57,68,8,1,211,19,56,73,
+73,2,6,254,227,73,74,86,86,68,69,1,0,1,168,62,47,86,86,26,34,30,64,55,207,
+223,47,64,18,34,30,86,86,38,93,0,1,0,86,254,109,4,154,4,74,0,38,0,0,37,50,
+54,55,55,51,6,6,21,21,20,22,51,50,54,55,22,22,21,20,6,35,34,38,53,53,33,53,
+1,33,34,6,7,7,35,19,33,21,1,2,184,53,66,21,10,86,3,7,57,61,34,48,25,14,17,
+84,72,107,102,253,41,2,82,254,192,65,66,26,2,86,20,3,17,253,172,117,69,99,
+47,90,150,92,100,72,76,16,17,14,37,25,56,56,147,156,100,82,3,131,61,105,8,
+1,35,84,252,127,0,3,0,86,255,90,3,231,4,74,0,29,0,39,0,40,0,0,33,6,6,7,39,
+54,55,33,53,1,33,34,6,7,7,35,19,33,21,1,51,54,54,51,50,22,21,20,6,35,18,6,
+7,51,50,54,53,52,38,35,19,2,51,9,14,8,106,12,17,254,143,2,82,254,192,65,66,
+26,2,86,20,3,17,253,172,163,54,149,111,89,109,165,156,44,91,37,100,96,91,
+50,47,148,37,82,47,29,74,63,82,3,131,61,105,8,1,35,84,252,127,167,158,109,
+87,122,124,1,84,106,117,68,59,42,54,254,172,255,255,0,82,254,20,3,240,4,74,
+18,2,2,229,0,0,0,2,0,82,254,20,4,68,4,74,0,42,0,54,0,0,1,38,38,39,6,6,35,
+34,38,53,52,54,51,50,22,23,54,53,52,38,35,35,53,1,33,34,6,7,7,35,19,33,21,
+1,22,22,21,20,6,7,22,22,23,36,54,55,38,38,35,34,6,21,20,22,51,3,236,31,64,
+32,78,222,135,170,190,181,173,100,179,82,12,204,206,47,1,148,254,141,66,56,
+11,4,101,13,3,26,254,70,245,251,34,32,38,73,39,253,222,166,48,74,163,87,132,
+114,130,120,254,29,45,79,35,81,87,131,105,129,127,53,56,58,74,163,170,84,
+1,238,51,78,29,1,66,101,253,236,14,218,200,79,133,57,38,92,54,27,87,91,56,
+61,75,79,65,76,0,1,0,66,0,0,3,131,6,20,0,33,0,0,0,6,7,17,20,22,51,51,21,33,
+53,51,50,54,53,17,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,3,
+131,164,188,71,97,26,253,187,26,96,72,200,153,124,114,118,124,74,87,220,183,
+202,228,3,220,240,99,254,96,73,74,86,86,72,75,2,0,91,185,146,130,157,137,
+133,67,66,97,142,223,176,0,1,0,94,0,0,3,160,6,20,0,33,0,0,18,54,51,50,22,
+21,20,6,35,52,38,35,34,6,21,20,22,23,17,20,22,51,51,21,33,53,51,50,54,53,
+17,38,38,53,94,228,202,182,222,88,74,124,118,112,125,151,201,71,97,27,253,
+186,27,95,72,188,164,5,53,223,141,98,66,67,133,137,153,134,145,185,92,254,
+0,73,74,86,86,71,76,1,160,99,240,169,0,1,0,66,255,236,3,131,6,20,0,33,0,0,
+36,6,35,34,38,53,52,54,51,20,22,51,50,54,53,52,38,39,17,52,38,35,35,53,33,
+21,35,34,6,21,17,22,22,21,3,131,228,202,183,220,87,74,124,118,114,124,153,
+200,72,96,26,2,69,26,97,71,188,164,203,223,142,97,66,67,133,137,157,130,146,
+185,91,2,20,75,72,86,86,74,73,254,76,99,240,169,0,1,0,113,254,25,3,160,4,
+94,0,29,0,0,0,2,17,16,18,51,50,22,21,20,6,35,52,38,35,34,2,17,16,18,51,50,
+54,55,22,22,21,20,6,35,1,101,244,241,226,143,203,92,91,85,89,137,121,146,
+164,95,142,35,15,20,191,157,254,25,1,157,1,125,1,136,1,163,116,93,71,58,118,
+118,254,166,254,143,254,180,254,189,80,63,12,40,28,79,117,255,255,0,115,255,
+236,5,123,5,205,18,34,0,50,0,0,16,3,0,121,1,248,0,20,255,255,0,47,0,0,4,82,
+4,74,18,2,1,204,0,0,0,2,0,113,255,236,4,0,4,94,0,18,0,39,0,0,5,38,38,53,52,
+54,55,53,38,38,53,52,54,51,50,18,17,16,2,0,6,21,20,22,51,51,21,35,34,6,21,
+20,22,51,50,54,53,52,38,35,2,37,210,226,117,124,94,113,215,181,234,247,239,
+254,176,107,110,97,110,108,113,127,118,116,145,135,114,164,20,2,180,157,95,
+129,30,11,31,133,81,135,154,254,224,254,233,254,227,254,226,4,8,100,83,88,
+108,111,97,103,113,123,222,243,232,229,0,1,0,113,255,236,4,246,6,20,0,56,
+0,0,1,52,54,51,50,22,21,20,6,7,38,38,35,34,6,21,17,20,6,35,52,38,35,34,6,
+21,20,22,51,50,54,55,53,52,38,35,35,53,33,21,35,34,6,21,17,6,6,35,34,0,17,
+16,0,51,50,22,23,3,133,105,108,72,84,17,14,25,47,34,62,61,92,91,103,99,159,
+155,154,160,51,88,45,67,95,12,2,8,12,88,54,73,188,111,253,254,249,1,15,243,
+72,145,57,4,229,145,158,56,56,25,37,14,17,16,76,72,254,168,71,58,113,123,
+224,241,237,224,14,13,215,70,67,82,82,68,79,254,247,37,40,1,39,1,20,1,4,1,
+51,30,29,255,255,0,47,0,0,5,82,4,74,18,2,1,215,0,0,0,3,255,127,254,20,2,82,
+6,20,0,20,0,32,0,41,0,0,5,6,6,35,34,38,53,52,54,51,51,17,52,38,35,35,53,33,
+17,51,21,0,54,51,50,22,21,20,6,35,34,38,53,2,54,55,35,34,6,21,20,51,1,154,
+18,165,139,101,116,152,143,55,73,93,8,1,111,180,254,111,56,60,61,56,59,58,
+57,59,48,65,7,55,97,83,104,168,158,166,107,90,105,118,3,176,69,71,86,251,
+110,96,6,123,65,67,59,60,67,64,63,248,223,114,113,65,62,100,0,1,255,254,254,
+20,4,137,4,74,0,48,0,0,1,1,38,38,35,35,53,51,50,22,23,19,55,53,52,38,35,35,
+53,33,21,35,34,6,21,17,20,22,51,51,21,33,17,52,54,55,1,6,6,21,20,22,51,21,
+33,53,50,54,55,1,248,254,239,53,103,69,8,29,178,134,89,205,151,69,97,8,2,
+39,16,98,70,74,94,16,254,135,5,4,255,0,68,45,48,52,254,60,71,137,80,1,182,
+1,150,81,87,86,60,139,254,191,112,184,69,69,86,86,75,73,251,150,70,70,86,
+3,56,50,132,76,254,231,76,77,29,26,15,86,86,99,91,0,1,0,47,0,0,3,203,4,74,
+0,25,0,0,51,53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,33,50,54,
+55,55,51,3,47,27,97,71,64,94,27,2,49,16,97,71,1,21,71,68,16,11,94,13,86,71,
+68,2,137,69,69,86,86,69,69,252,244,67,99,68,254,184,0,2,0,113,254,20,5,145,
+6,31,0,48,0,60,0,0,1,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,17,20,22,
+51,51,21,33,53,51,50,54,53,53,52,54,55,35,6,6,35,34,2,17,16,18,51,50,22,23,
+51,38,38,53,2,54,53,52,38,35,34,6,21,20,22,51,3,76,168,174,111,128,76,81,
+56,51,70,55,74,94,17,253,155,68,97,71,5,3,8,51,155,108,209,208,207,210,106,
+155,53,12,3,9,130,130,135,146,128,124,123,131,4,133,209,201,92,70,51,66,88,
+97,94,136,250,27,70,70,86,86,75,73,176,69,121,76,105,99,1,24,1,31,1,32,1,
+27,88,92,40,80,44,252,33,194,242,240,200,215,227,228,206,0,1,0,66,0,0,3,131,
+6,20,0,41,0,0,19,51,17,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,
+21,20,6,7,21,51,21,35,21,20,22,51,51,21,33,53,51,50,54,53,53,35,139,215,200,
+153,124,114,118,124,74,87,220,183,202,228,164,188,215,215,71,97,26,253,187,
+26,96,72,215,1,223,1,10,91,185,146,130,157,137,133,67,66,97,142,223,176,169,
+240,99,170,96,150,73,74,86,86,72,75,150,0,1,0,94,0,0,3,160,6,20,0,41,0,0,
+18,54,51,50,22,21,20,6,35,52,38,35,34,6,21,20,22,23,17,51,21,35,21,20,22,
+51,51,21,33,53,51,50,54,53,53,35,53,51,53,38,38,53,94,228,202,182,222,88,
+74,124,118,112,125,151,201,215,215,71,97,27,253,186,27,95,72,215,215,188,
+164,5,53,223,141,98,66,67,133,137,153,134,145,185,92,254,246,96,150,73,74,
+86,86,71,76,150,96,170,99,240,169,0,3,0,113,255,236,7,61,6,20,0,36,0,48,0,
+51,0,0,1,33,21,1,33,50,54,55,55,51,3,33,39,35,6,6,35,34,2,17,16,18,51,50,
+22,23,51,52,38,53,53,52,38,35,35,53,33,0,54,53,52,38,35,34,6,21,20,22,51,
+1,17,1,4,12,3,37,253,172,1,117,48,69,22,10,86,10,252,55,22,8,51,155,108,209,
+208,207,210,106,155,53,12,12,71,97,17,1,121,254,190,130,135,146,128,124,123,
+131,1,215,2,54,4,74,84,252,127,64,104,47,254,180,184,105,99,1,24,1,31,1,32,
+1,27,88,92,20,176,29,168,68,71,86,250,91,194,242,240,200,215,227,228,206,
+3,102,252,168,3,88,0,2,0,113,254,20,7,43,6,20,0,60,0,72,0,0,1,21,1,22,22,
+21,20,0,35,34,38,53,52,54,51,20,22,51,50,54,53,52,38,35,35,53,1,33,17,20,
+22,51,51,21,33,39,35,6,6,35,34,2,17,16,18,51,50,22,23,51,52,38,53,53,52,38,
+35,35,53,33,17,0,54,53,52,38,35,34,6,21,20,22,51,6,246,254,69,251,245,254,
+223,233,198,206,76,76,134,116,152,173,204,205,47,1,147,253,221,71,97,17,254,
+165,22,8,51,155,108,209,208,207,210,106,155,53,12,12,71,97,17,1,121,254,190,
+130,135,146,128,124,123,131,4,74,101,253,236,14,228,207,239,254,243,110,91,
+65,66,98,135,204,189,183,173,84,1,238,253,59,68,71,86,184,105,99,1,24,1,31,
+1,32,1,27,88,92,20,176,29,168,68,71,86,254,54,252,37,194,242,240,200,215,
+227,228,206,0,5,0,113,255,90,7,129,6,20,0,47,0,59,0,62,0,72,0,73,0,0,33,39,
+35,6,6,35,34,2,17,16,18,51,50,22,23,51,52,38,53,53,52,38,35,35,53,33,17,33,
+21,1,51,54,54,51,50,22,21,20,6,35,35,6,6,7,39,54,54,55,36,54,53,52,38,35,
+34,6,21,20,22,51,1,17,1,18,6,7,51,50,54,53,52,38,35,19,3,106,22,8,51,155,
+108,209,208,207,210,106,155,53,12,12,71,97,17,1,121,3,37,253,172,164,53,148,
+112,89,110,166,156,114,9,14,8,106,6,14,8,253,106,130,135,146,128,124,123,
+131,1,215,2,54,42,91,37,100,96,90,48,48,147,184,105,99,1,24,1,31,1,32,1,27,
+88,92,20,176,29,168,68,71,86,254,54,84,252,127,165,160,109,87,122,124,37,
+82,47,29,37,69,31,111,194,242,240,200,215,227,228,206,3,102,252,168,3,88,
+253,127,106,117,68,59,41,55,254,172,0,2,0,39,255,236,5,106,5,70,0,38,0,65,
+0,0,4,39,6,6,35,34,38,53,17,35,53,50,54,55,51,17,33,54,51,50,22,21,20,6,35,
+52,38,35,34,6,21,20,30,2,21,20,6,35,36,54,55,38,38,53,52,54,51,20,22,51,50,
+54,53,52,38,36,38,53,52,55,33,17,20,22,51,3,80,88,45,167,56,163,134,156,86,
+133,35,94,1,211,84,106,138,161,76,71,85,91,97,98,189,229,143,212,191,254,
+109,60,32,14,13,76,53,113,108,107,119,124,254,203,129,46,254,194,85,71,20,
+40,17,23,147,170,2,172,82,116,171,254,249,29,105,83,56,67,103,114,86,78,95,
+97,94,142,129,151,170,98,12,6,22,50,29,66,75,129,131,102,84,83,86,133,142,
+119,90,64,253,78,105,108,0,2,0,39,254,20,4,250,6,31,0,47,0,56,0,0,5,20,6,
+35,34,38,53,52,54,55,20,22,51,50,54,53,53,6,6,35,34,38,53,17,35,53,50,54,
+55,51,21,33,53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,0,54,55,17,33,17,
+20,22,51,3,160,164,158,125,141,76,82,54,52,75,56,33,115,57,181,154,156,86,
+133,35,94,1,92,157,161,103,118,76,82,45,41,57,45,254,204,76,39,254,164,102,
+86,16,235,241,88,74,56,79,2,105,99,182,197,30,13,19,144,173,2,172,82,116,
+171,252,59,209,201,92,70,51,66,90,95,94,136,251,125,8,6,3,111,253,78,104,
+99,0,2,0,39,255,236,5,233,5,70,0,56,0,68,0,0,0,22,23,54,54,51,50,22,21,20,
+6,35,34,38,39,6,6,35,34,38,53,17,35,53,50,54,55,51,21,33,21,33,17,20,22,51,
+50,54,55,38,38,53,16,18,51,50,22,21,20,6,35,52,38,35,34,6,21,4,6,7,22,22,
+51,50,54,53,52,38,35,3,82,9,11,84,176,119,123,141,209,165,104,176,66,72,144,
+85,163,134,156,97,126,31,94,1,12,254,244,74,65,65,99,43,40,42,226,231,150,
+206,91,91,85,89,140,118,1,38,150,87,37,114,87,121,129,80,72,1,229,102,43,
+86,78,124,99,132,169,61,70,72,59,147,170,2,172,82,142,145,252,117,253,78,
+94,109,57,43,65,175,115,1,30,1,33,115,94,71,58,119,117,231,240,144,65,96,
+66,61,92,74,65,57,0,1,0,55,254,20,6,111,6,41,0,70,0,0,37,21,33,53,51,50,54,
+53,17,35,53,51,53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,21,33,23,51,
+54,54,51,50,22,21,17,20,6,35,35,53,51,50,54,53,17,52,38,35,34,6,21,17,20,
+22,51,51,21,33,17,52,38,35,33,17,20,22,51,2,115,253,196,27,97,71,187,187,
+190,172,146,141,92,76,69,66,81,73,2,56,26,11,47,130,111,154,158,185,194,31,
+12,109,96,94,100,105,111,70,96,9,254,145,70,77,254,249,71,97,86,86,86,74,
+73,3,0,97,102,179,198,73,70,54,61,78,86,121,143,121,166,95,91,201,200,253,
+35,242,234,97,179,198,2,213,147,133,174,158,254,80,68,69,86,3,94,67,72,253,
+0,73,74,0,1,0,27,255,236,5,25,6,20,0,60,0,0,4,38,39,33,53,51,50,54,53,17,
+52,38,35,35,53,33,17,20,22,51,51,38,38,53,52,54,51,20,22,51,50,54,53,52,38,
+36,38,53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,20,30,2,21,20,6,35,3,
+85,83,35,253,60,26,97,71,71,97,26,1,131,72,96,14,17,16,76,53,112,109,107,
+119,123,254,207,133,207,178,136,163,77,71,85,91,97,98,192,230,140,212,192,
+20,11,9,86,74,73,4,74,68,71,86,250,213,75,72,23,56,32,66,75,125,135,102,84,
+82,86,132,140,123,136,153,105,83,56,67,103,114,86,78,96,97,95,144,125,151,
+170,0,2,0,27,0,0,4,207,6,20,0,23,0,26,0,0,55,50,54,53,17,52,38,35,35,53,33,
+17,33,21,1,33,50,54,55,55,51,3,33,53,37,1,33,53,97,71,71,97,26,1,131,3,37,
+253,172,1,116,53,66,21,10,86,10,251,86,1,131,2,53,253,203,86,74,73,4,74,68,
+71,86,254,54,84,252,127,69,99,47,254,180,86,39,3,88,0,2,0,10,0,0,4,109,5,
+182,0,54,0,109,0,0,1,54,54,53,52,35,35,53,33,21,35,34,6,7,3,35,3,38,38,39,
+35,3,35,3,38,38,35,53,33,21,35,34,6,21,20,22,21,23,22,22,23,51,52,54,55,19,
+51,19,22,22,23,51,54,54,55,19,54,54,53,52,35,35,53,33,21,35,34,6,7,3,35,3,
+38,38,39,35,3,35,3,38,38,35,53,33,21,35,34,6,21,20,22,21,23,22,22,23,51,54,
+54,55,19,51,19,22,22,23,51,54,54,55,3,109,5,7,84,27,1,99,52,35,44,17,160,
+112,125,8,14,3,8,158,112,162,12,55,46,1,125,31,38,39,15,32,6,26,7,8,31,14,
+115,90,112,11,23,15,9,8,22,11,39,5,7,84,27,1,99,52,35,44,17,160,112,125,8,
+14,3,8,158,112,162,12,55,46,1,125,31,38,39,15,32,4,32,3,8,15,23,7,115,90,
+112,11,23,15,9,8,22,11,1,225,16,44,12,57,76,76,49,57,254,8,1,106,22,52,25,
+254,51,2,25,38,35,76,76,23,28,15,64,3,115,23,107,39,4,115,38,1,70,254,194,
+31,83,56,34,89,37,3,141,16,44,12,57,76,76,49,57,254,8,1,107,21,52,25,254,
+51,2,25,38,35,76,76,23,28,15,64,3,114,14,142,14,64,73,20,1,70,254,195,31,
+84,55,34,88,37,0,2,0,98,0,0,3,213,5,182,0,13,0,27,0,0,1,53,52,38,35,33,34,
+6,21,21,35,17,33,17,3,53,52,38,35,33,34,6,21,21,35,17,33,17,3,115,97,84,254,
+187,85,95,99,3,115,98,97,84,254,187,85,95,99,3,115,4,0,106,75,93,94,74,106,
+1,182,254,74,252,0,106,75,93,94,74,106,1,182,254,74,0,1,0,31,254,20,5,205,
+4,94,0,51,0,0,1,20,22,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,
+22,51,51,21,33,17,52,54,55,35,6,35,34,38,53,17,52,38,35,34,6,21,34,38,53,
+52,54,51,50,22,21,2,123,108,117,121,127,69,97,8,2,39,17,98,70,74,94,17,254,
+135,6,2,10,94,207,186,177,63,53,52,53,103,87,147,139,158,160,1,135,144,136,
+173,158,1,176,68,70,86,86,75,73,251,150,70,70,86,1,228,53,92,29,186,202,199,
+1,154,122,111,114,105,63,56,90,104,176,170,0,1,0,31,254,20,6,51,4,94,0,58,
+0,0,5,52,54,55,35,6,35,34,38,53,17,52,38,35,34,6,21,34,38,53,52,54,51,50,
+22,21,17,20,22,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,
+50,54,55,21,6,6,35,34,38,53,4,84,6,2,10,94,207,186,177,63,53,52,53,103,87,
+147,139,158,160,108,117,121,127,69,97,8,2,39,17,98,70,70,86,37,62,32,29,111,
+42,164,133,8,53,92,29,186,202,199,1,154,122,111,114,105,63,56,90,104,176,
+170,254,131,144,136,173,158,1,176,68,70,86,86,75,73,251,236,107,96,8,6,90,
+14,19,150,168,0,1,0,29,2,20,3,104,6,20,0,42,0,0,1,21,33,53,51,50,54,53,17,
+52,38,35,35,53,33,17,20,6,7,51,54,54,51,50,22,21,17,20,22,51,21,33,17,52,
+38,35,34,6,21,17,20,22,51,1,174,254,111,26,61,40,43,58,26,1,26,5,3,8,35,95,
+63,128,132,42,66,254,244,61,76,80,76,44,59,2,96,76,76,44,42,2,195,42,38,75,
+254,252,37,60,21,48,56,130,140,254,194,45,41,76,1,216,84,90,113,94,254,229,
+43,37,0,1,0,29,2,20,3,104,6,20,0,51,0,0,1,20,6,7,51,54,54,51,50,22,21,17,
+20,22,51,21,33,17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,
+52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,1,55,5,3,8,35,95,63,128,132,42,
+66,254,244,61,76,80,76,44,59,16,254,111,26,61,40,115,128,85,91,62,73,30,27,
+38,34,5,14,38,58,20,46,58,130,140,254,194,45,41,76,1,213,86,91,114,95,254,
+231,43,37,76,76,44,42,2,74,141,135,66,48,37,49,63,58,53,87,0,2,255,227,0,
+252,1,47,6,20,0,15,0,27,0,0,1,17,20,6,35,35,53,51,50,54,53,17,52,38,35,53,
+54,54,51,50,22,21,20,6,35,34,38,53,1,39,142,145,37,23,79,64,48,69,99,47,45,
+45,47,54,38,38,54,4,246,253,69,162,157,82,116,121,2,31,42,38,76,238,48,48,
+46,49,43,43,49,0,1,0,59,2,20,2,162,5,2,0,33,0,0,1,33,53,50,54,53,17,52,38,
+35,53,51,23,51,54,54,51,50,22,21,20,6,35,52,38,35,34,6,21,21,20,22,51,51,
+1,231,254,84,71,46,48,69,240,18,7,43,96,61,73,77,79,77,28,35,57,64,42,60,
+51,2,20,76,44,42,1,162,41,41,76,127,87,52,54,52,53,54,58,49,172,105,211,42,
+38,0,1,0,23,2,8,2,125,4,246,0,33,0,0,19,33,21,34,6,21,17,20,22,51,21,35,39,
+35,6,6,35,34,38,53,52,54,51,20,22,51,50,54,53,53,52,38,35,35,209,1,172,67,
+50,46,71,240,18,8,42,93,66,71,76,80,75,28,34,57,63,41,59,51,4,246,76,43,43,
+254,94,40,42,76,127,84,55,56,53,51,53,57,47,162,112,211,41,39,0,1,0,25,0,
+252,2,201,4,246,0,44,0,0,1,20,22,51,50,54,55,21,6,6,35,34,38,53,53,52,54,
+55,35,6,6,35,34,38,53,52,54,51,20,22,51,50,54,53,53,52,38,35,35,53,33,21,
+34,6,21,2,8,47,43,22,52,29,18,78,42,115,100,5,2,9,25,81,66,83,78,75,80,26,
+32,57,65,37,63,51,1,172,72,45,1,209,65,58,4,8,80,9,13,99,118,74,11,40,14,
+43,45,56,51,51,53,54,50,168,108,213,39,39,76,76,43,41,0,2,0,39,2,20,3,39,
+4,246,0,35,0,44,0,0,1,54,54,51,51,21,35,34,6,7,7,22,22,21,20,6,35,33,53,51,
+50,54,53,17,52,38,35,53,33,21,35,34,6,21,21,51,19,50,54,53,52,38,35,35,17,
+2,23,42,96,75,59,27,26,42,28,129,75,105,141,152,254,109,33,59,37,46,69,1,
+144,25,59,41,78,28,67,72,72,67,106,4,135,73,38,76,36,40,190,14,105,78,94,
+105,76,43,39,1,168,42,38,76,76,38,42,164,254,172,69,58,63,70,254,252,0,1,
+0,0,2,20,4,188,4,246,0,55,0,0,1,54,54,53,52,38,35,35,53,33,21,35,34,6,7,3,
+35,3,38,38,39,35,3,35,3,38,38,35,53,33,21,35,34,6,21,20,22,23,23,22,22,23,
+51,54,54,55,19,51,19,22,22,23,51,54,54,55,3,209,5,5,37,41,24,1,71,32,32,41,
+17,177,133,153,7,11,5,8,180,133,181,9,45,48,1,113,31,35,37,10,7,57,15,16,
+6,10,5,21,11,143,111,141,11,22,14,11,8,15,11,4,51,17,38,13,26,25,76,76,46,
+52,253,204,1,179,18,49,23,253,243,2,82,30,38,76,76,21,26,11,47,16,205,56,
+61,28,29,75,29,1,150,254,114,29,69,51,32,73,34,0,1,0,2,0,252,3,31,4,246,0,
+41,0,0,1,21,34,6,7,3,14,2,35,35,53,50,54,55,1,38,38,35,53,33,7,34,21,20,22,
+23,23,22,22,23,51,54,54,55,55,54,54,53,52,35,53,3,31,41,49,19,211,48,85,130,
+142,25,136,152,32,254,247,14,44,44,1,102,4,84,5,8,100,16,27,14,9,2,15,15,
+90,7,8,96,4,246,76,49,51,253,206,126,109,45,82,97,104,2,81,33,33,76,76,53,
+2,29,18,236,35,72,38,17,55,40,254,20,31,13,53,76,0,1,0,53,3,193,1,49,5,182,
+0,8,0,0,1,23,6,6,7,35,54,18,55,1,33,16,19,68,48,117,21,30,7,5,182,22,106,
+251,122,130,1,24,91,0,2,0,53,3,193,2,178,5,182,0,8,0,17,0,0,1,23,6,6,7,35,
+54,18,55,33,23,6,6,7,35,54,18,55,1,33,16,19,68,48,117,21,30,7,2,51,16,19,
+68,48,117,21,30,7,5,182,22,106,251,122,130,1,24,91,22,106,251,122,130,1,24,
+91,255,255,0,115,3,117,1,195,5,184,18,2,2,6,0,0,255,255,0,115,3,115,1,195,
+5,182,18,2,2,9,0,0,0,1,0,0,4,135,0,246,6,70,0,13,0,0,17,50,54,53,52,38,35,
+53,50,22,21,20,6,35,65,70,73,62,109,137,138,108,4,236,64,58,61,62,101,121,
+103,104,119,0,1,0,0,4,135,0,246,6,70,0,13,0,0,19,34,6,21,20,22,51,21,34,38,
+53,52,54,51,246,62,73,70,65,108,138,137,109,5,225,62,61,58,64,101,119,104,
+103,121,0,1,0,39,3,225,2,29,6,20,0,23,0,0,1,35,53,54,54,53,52,38,35,34,6,
+21,34,38,53,52,54,51,50,22,21,20,6,7,1,61,106,88,82,47,53,52,59,62,69,122,
+111,119,150,110,114,3,225,170,33,101,67,46,65,72,62,35,43,63,74,114,94,91,
+108,37,0,1,0,59,3,225,2,49,6,20,0,23,0,0,1,38,38,53,52,54,51,50,22,21,20,
+6,35,52,38,35,34,6,21,20,22,23,21,35,1,27,114,110,150,119,111,122,69,62,59,
+52,53,47,82,88,106,4,88,37,108,91,94,114,74,63,43,35,62,72,65,46,67,101,33,
+170,0,1,0,62,4,53,1,240,6,70,0,16,0,0,19,22,22,23,21,35,38,38,39,53,54,54,
+55,51,21,6,6,252,68,117,59,20,101,206,107,171,170,73,20,59,117,5,62,32,80,
+48,105,73,97,43,101,70,92,53,105,48,79,0,1,0,62,4,53,1,240,6,70,0,16,0,0,
+1,38,38,39,53,51,22,22,23,21,6,6,7,35,53,54,54,1,50,68,117,59,20,101,205,
+108,216,146,52,20,59,117,5,62,32,79,48,105,72,98,43,100,92,86,38,105,48,80,
+0,1,0,15,4,147,2,31,6,70,0,16,0,0,1,6,6,7,35,53,54,54,55,51,22,22,23,21,35,
+38,38,1,23,32,80,48,104,52,92,69,100,54,103,58,104,48,80,5,135,68,117,59,
+21,72,174,168,136,198,80,21,59,117,0,1,0,15,4,147,2,31,6,70,0,16,0,0,1,54,
+54,55,51,21,6,6,7,35,38,38,39,53,51,22,22,1,23,32,80,48,104,72,98,43,100,
+81,90,44,104,48,80,5,82,68,117,59,21,100,206,108,193,161,60,21,59,117,0,1,
+0,43,4,205,0,163,6,20,0,3,0,0,19,51,17,35,43,120,120,6,20,254,185,255,255,
+0,22,4,217,1,163,6,33,16,3,0,118,254,143,0,0,255,255,0,24,4,217,1,166,6,33,
+16,3,0,67,254,143,0,0,0,1,0,43,254,104,0,163,255,176,0,3,0,0,23,51,17,35,
+43,120,120,80,254,184,0,1,0,25,254,201,2,107,255,66,0,3,0,0,23,33,21,33,25,
+2,82,253,174,190,121,255,255,0,24,254,42,1,166,255,114,16,3,0,67,254,143,
+249,81,255,255,0,22,254,42,1,163,255,114,16,3,0,118,254,143,249,81,0,2,0,
+35,0,0,1,139,4,74,0,2,0,5,0,0,1,3,3,1,33,19,1,139,180,180,1,104,254,152,180,
+4,74,254,233,1,23,251,182,1,23,0,1,0,35,3,51,1,139,4,74,0,2,0,0,1,3,3,1,139,
+180,180,4,74,254,233,1,23,0,1,0,42,1,238,1,32,3,172,0,13,0,0,19,50,54,53,
+52,38,35,53,50,22,21,20,6,35,42,62,73,73,62,108,138,138,108,2,82,62,61,61,
+62,100,119,104,104,119,0,1,0,42,1,238,1,32,3,172,0,13,0,0,1,34,6,21,20,22,
+51,21,34,38,53,52,54,51,1,32,62,73,73,62,108,138,138,108,3,72,62,61,61,62,
+100,119,104,104,119,0,1,0,25,254,94,1,163,255,150,0,7,0,0,19,53,51,21,51,
+21,33,53,169,108,142,254,118,254,203,203,203,109,109,0,1,0,25,254,94,1,163,
+255,150,0,7,0,0,5,21,35,53,35,53,33,21,1,19,108,142,1,138,215,203,203,109,
+109,0,1,0,25,254,41,1,163,255,180,0,11,0,0,1,21,35,53,35,53,51,53,51,21,51,
+21,1,19,108,142,144,108,142,254,184,143,143,109,143,143,109,0,1,0,25,254,
+176,1,245,255,29,0,3,0,0,1,33,53,33,1,245,254,36,1,220,254,176,109,0,1,254,
+242,1,98,0,238,2,248,0,19,0,0,3,7,39,55,23,22,22,51,50,54,55,22,22,21,20,
+6,35,34,38,39,158,84,28,188,37,19,58,36,38,58,18,25,31,92,68,84,102,37,2,
+117,25,105,51,131,63,52,39,29,14,54,31,52,77,105,125,0,1,0,15,4,215,1,173,
+6,117,0,11,0,0,19,55,23,55,23,7,23,7,39,7,39,55,15,78,129,131,76,129,129,
+78,129,129,78,131,6,41,76,129,129,76,131,129,78,129,129,78,129,0,2,0,2,0,
+252,3,53,4,246,0,43,0,55,0,0,1,22,22,21,20,6,35,34,38,53,52,54,55,3,38,38,
+35,35,53,33,21,35,34,6,21,20,22,23,19,55,54,54,53,52,38,35,35,53,33,21,35,
+34,6,7,0,38,39,6,6,21,20,22,51,50,54,53,1,240,46,42,99,79,76,80,44,56,244,
+20,30,46,8,1,131,18,46,40,12,8,141,132,7,13,43,49,12,1,71,16,46,39,24,255,
+0,14,29,29,28,28,25,22,25,2,219,87,146,60,86,100,81,73,56,122,98,1,184,37,
+35,76,76,24,31,13,35,14,254,252,250,18,42,8,34,25,76,76,60,44,253,120,83,
+65,53,92,35,36,38,38,42,0,1,0,20,2,20,1,186,6,20,0,18,0,0,19,50,54,53,17,
+52,38,35,35,53,33,17,20,22,51,51,21,33,53,53,61,40,47,54,33,1,31,41,62,32,
+254,90,2,96,44,42,2,195,40,40,75,252,162,43,43,76,76,0,1,0,80,2,8,2,98,5,
+0,0,37,0,0,18,38,53,52,54,51,20,22,51,50,54,53,52,38,38,53,52,54,51,50,22,
+21,20,6,35,52,38,35,34,6,21,20,22,22,21,20,6,35,208,128,67,50,71,66,66,71,
+221,158,148,125,102,115,67,60,51,56,63,54,226,153,154,132,2,8,80,72,48,52,
+84,92,69,50,69,86,108,105,91,106,73,58,42,48,68,77,57,45,72,79,109,103,103,
+116,0,1,0,4,2,20,3,49,4,246,0,59,0,0,0,38,35,53,33,21,35,34,6,7,7,19,22,22,
+51,51,21,33,53,51,50,53,52,39,39,35,7,6,6,21,20,22,51,21,33,53,51,50,54,55,
+55,39,38,38,35,35,53,33,21,34,6,21,20,23,23,51,55,54,54,53,2,16,42,35,1,73,
+26,44,56,29,140,199,31,45,26,31,254,129,21,67,45,80,8,86,11,24,42,50,254,
+156,25,43,64,34,172,172,38,40,31,30,1,116,47,30,26,78,6,62,12,18,4,154,16,
+76,76,41,39,178,254,252,41,27,76,76,35,31,57,103,115,16,42,22,16,15,76,76,
+39,43,213,225,48,18,76,76,16,13,22,33,104,86,17,38,12,0,1,0,82,2,20,2,164,
+6,20,0,33,0,0,18,54,51,50,22,21,20,6,35,52,38,35,34,6,21,20,22,23,17,20,22,
+51,51,21,33,53,51,50,54,53,55,38,38,53,82,161,144,129,160,74,63,76,76,70,
+77,100,139,39,62,30,254,92,31,59,41,5,127,117,5,123,153,100,67,47,50,87,91,
+99,79,91,117,62,254,184,44,42,76,76,44,42,252,66,158,112,0,1,0,68,254,20,
+2,213,6,20,0,5,0,0,1,17,35,17,33,53,2,213,121,253,232,6,20,248,0,7,136,120,
+0,1,0,68,254,20,2,213,6,20,0,7,0,0,1,51,17,35,17,33,53,33,2,92,121,121,253,
+232,2,24,6,20,248,0,5,166,119,0,1,0,68,254,20,2,213,6,20,0,7,0,0,1,51,17,
+35,17,33,53,33,2,92,121,121,253,232,2,24,6,20,248,0,3,195,121,0,1,0,68,254,
+20,2,213,6,20,0,7,0,0,23,53,33,17,51,17,35,17,68,2,24,121,121,10,121,5,165,
+248,0,1,226,0,1,0,68,254,20,2,213,6,20,0,5,0,0,1,17,33,53,33,17,2,213,253,
+111,2,24,6,20,248,0,119,7,137,0,1,0,182,0,0,2,96,4,109,0,5,0,0,1,17,33,21,
+33,17,1,4,1,92,254,86,4,109,251,225,78,4,109,0,1,0,182,0,0,2,96,4,109,0,7,
+0,0,1,33,21,33,17,35,17,51,1,4,1,92,254,164,78,78,2,92,78,253,242,4,109,255,
+255,1,33,254,42,3,125,255,114,16,3,1,76,0,0,249,81,0,2,255,246,5,33,3,74,
+6,94,0,3,0,7,0,0,1,33,53,33,53,33,53,33,3,74,252,172,3,84,252,172,3,84,5,
+33,106,107,104,255,255,0,61,3,115,3,39,5,182,18,2,2,11,0,0,0,1,0,15,254,20,
+2,31,255,199,0,16,0,0,1,54,54,55,51,21,6,6,7,35,38,38,39,53,51,22,22,1,23,
+32,80,48,104,72,98,43,100,81,90,44,104,48,80,254,211,68,117,59,21,100,206,
+108,193,161,60,21,59,117,0,1,0,15,254,20,2,31,255,199,0,16,0,0,5,6,6,7,35,
+53,54,54,55,51,22,22,23,21,35,38,38,1,23,32,80,48,104,52,92,69,100,54,103,
+58,104,48,80,248,68,117,59,21,72,174,168,136,198,80,21,59,117,0,1,0,62,254,
+20,1,240,0,37,0,16,0,0,23,22,22,23,21,35,38,38,39,53,54,54,55,51,21,6,6,252,
+68,117,59,20,101,206,107,171,170,73,20,59,117,227,32,80,48,105,73,97,43,101,
+70,92,53,105,48,79,0,1,0,62,254,20,1,240,0,37,0,16,0,0,5,38,38,39,53,51,22,
+22,23,21,6,6,7,35,53,54,54,1,50,68,117,59,20,101,205,108,216,146,52,20,59,
+117,227,32,79,48,105,72,98,43,100,92,86,38,105,48,80,0,1,0,22,2,68,1,164,
+3,139,0,9,0,0,1,35,38,38,39,53,51,22,22,23,1,164,78,71,210,39,219,31,110,
+38,2,68,47,205,55,20,68,185,48,255,255,0,22,2,62,3,16,3,134,16,3,1,83,255,
+69,253,101,0,2,0,22,2,61,3,16,3,133,0,9,0,19,0,0,1,38,38,39,53,51,22,22,23,
+21,33,38,38,39,53,51,22,22,23,21,2,172,72,192,29,219,20,70,84,254,43,57,203,
+33,219,20,70,84,2,61,57,202,49,20,43,126,132,27,45,209,54,20,43,126,132,27,
+0,1,0,20,254,119,2,238,255,125,0,19,0,0,0,54,55,51,6,6,35,34,38,35,34,6,7,
+35,54,54,51,50,22,51,2,88,48,9,93,7,110,98,89,187,46,42,48,10,93,7,111,100,
+86,189,44,254,252,43,65,106,135,129,40,69,107,135,129,0,2,0,166,1,145,1,164,
+6,20,0,11,0,23,0,0,18,54,51,50,22,21,20,6,35,34,38,53,16,54,51,50,22,21,20,
+6,35,34,38,53,166,65,62,62,65,69,58,54,73,65,62,61,66,69,58,58,69,2,99,69,
+71,68,68,72,67,73,3,179,68,69,70,67,72,70,69,0,1,0,20,4,31,1,104,5,115,0,
+5,0,0,19,33,21,35,21,35,20,1,84,231,109,5,115,109,231,0,1,0,20,4,31,1,104,
+5,115,0,5,0,0,1,17,35,53,35,53,1,104,109,231,5,115,254,172,231,109,0,1,0,
+20,1,231,1,104,3,59,0,5,0,0,19,17,51,21,51,21,20,109,231,1,231,1,84,231,109,
+0,1,0,20,1,231,1,104,3,59,0,5,0,0,1,33,53,51,53,51,1,104,254,172,231,109,
+1,231,109,231,0,1,0,35,254,86,3,181,255,168,0,7,0,0,1,33,17,51,21,33,53,51,
+3,181,252,110,99,2,202,101,254,86,1,82,203,203,0,1,0,35,254,86,3,181,255,
+168,0,5,0,0,1,33,17,51,21,33,3,181,252,110,99,3,47,254,86,1,82,203,0,1,0,
+30,254,20,3,146,0,37,0,19,0,0,5,6,6,7,33,21,33,22,22,23,21,35,38,38,39,53,
+54,54,55,51,1,208,38,98,51,2,125,253,129,51,100,38,21,100,205,108,172,171,
+70,21,59,31,60,28,98,26,63,32,95,73,97,43,101,70,94,51,255,255,252,130,4,
+217,254,222,6,33,16,3,1,75,251,97,0,0,255,255,254,216,4,238,1,42,5,103,16,
+3,1,77,254,1,0,0,0,1,254,94,6,20,1,162,6,141,0,3,0,0,1,33,53,33,1,162,252,
+188,3,68,6,20,121,255,255,254,226,4,217,1,32,5,242,16,3,1,78,253,179,0,0,
+255,255,255,140,4,248,0,118,5,245,16,3,1,79,254,173,0,0,255,255,254,214,5,
+14,1,44,5,244,16,3,0,106,253,179,0,0,255,255,252,195,4,184,254,133,6,143,
+18,2,2,97,0,0,255,255,255,11,4,197,0,247,6,131,16,3,1,80,254,173,0,0,255,
+255,254,210,4,217,1,204,6,33,16,3,1,83,254,1,0,0,255,255,252,126,4,217,254,
+218,6,33,16,3,1,76,251,93,0,0,0,1,255,199,4,197,0,57,6,20,0,3,0,0,19,17,35,
+17,57,114,6,20,254,177,1,79,0,2,255,51,4,197,0,205,6,20,0,3,0,7,0,0,3,17,
+35,17,33,17,35,17,90,115,1,154,115,6,20,254,177,1,79,254,177,1,79,0,2,254,
+225,4,197,1,31,6,170,0,11,0,25,0,0,18,6,35,34,38,53,52,54,51,50,22,21,2,38,
+39,51,22,22,51,50,54,55,51,6,6,35,104,59,45,48,56,60,44,51,53,240,149,2,94,
+17,101,75,75,101,17,94,5,149,133,5,249,52,56,58,63,52,58,57,254,142,157,123,
+74,65,65,74,129,151,0,1,254,225,4,217,1,31,5,242,0,13,0,0,18,22,23,35,38,
+38,35,34,6,7,35,54,54,51,130,152,5,94,17,101,75,75,101,17,94,2,152,133,5,
+242,149,132,74,65,65,74,127,154,255,255,255,89,3,117,0,169,5,184,16,3,2,6,
+254,230,0,0,255,255,255,89,3,115,0,169,5,182,16,3,2,7,255,28,0,0,255,255,
+255,89,3,115,0,169,5,182,16,3,2,9,254,230,0,0,255,255,255,89,3,115,0,169,
+5,182,16,3,2,7,255,28,0,0,255,255,255,58,254,42,0,200,255,114,16,3,0,67,253,
+177,249,81,255,255,255,58,254,42,0,199,255,114,16,3,0,118,253,179,249,81,
+0,1,255,100,254,80,0,156,255,178,0,7,0,0,19,35,53,51,53,51,17,35,47,203,203,
+109,109,254,203,108,123,254,158,0,1,255,100,254,78,0,156,255,176,0,7,0,0,
+7,51,21,35,21,35,17,51,47,203,203,109,109,203,108,123,1,98,0,1,254,229,4,
+217,1,27,6,16,0,5,0,0,1,17,35,53,33,53,1,27,109,254,55,6,16,254,201,203,108,
+0,1,255,66,4,88,0,139,6,41,0,15,0,0,3,54,54,53,52,38,53,52,54,51,50,22,21,
+20,6,7,190,84,92,88,59,57,60,65,167,162,4,168,13,72,56,31,57,54,43,59,68,
+61,142,164,30,0,1,255,133,254,22,0,123,255,212,0,13,0,0,23,34,6,21,20,22,
+51,21,34,38,53,52,54,51,123,62,73,73,62,108,138,138,108,144,62,61,61,62,100,
+119,104,104,119,0,1,255,59,254,94,0,197,255,150,0,7,0,0,3,53,51,21,51,21,
+33,53,53,108,142,254,118,254,203,203,203,109,109,0,1,255,59,254,94,0,197,
+255,150,0,7,0,0,23,21,35,53,35,53,33,21,53,108,142,1,138,215,203,203,109,
+109,0,1,255,59,254,41,0,197,255,180,0,11,0,0,19,21,35,53,35,53,51,53,51,21,
+51,21,53,108,142,144,108,142,254,184,143,143,109,143,143,109,0,1,254,215,
+254,201,1,41,255,66,0,3,0,0,5,33,21,33,254,215,2,82,253,174,190,121,255,255,
+254,144,254,109,0,1,0,86,16,3,3,123,254,138,0,0,0,1,0,0,254,109,1,113,0,86,
+0,17,0,0,55,21,20,22,51,50,54,55,22,22,21,20,6,35,34,38,53,53,115,55,61,34,
+48,25,14,17,84,72,108,105,86,186,73,75,16,17,14,37,25,56,56,147,156,186,255,
+255,254,214,254,152,1,44,255,126,16,3,0,106,253,179,249,138,0,2,255,29,254,
+20,0,227,255,174,0,11,0,23,0,0,18,6,35,34,38,53,52,54,51,50,22,21,38,38,35,
+34,6,21,20,22,51,50,54,53,227,128,99,99,128,128,99,99,128,110,63,54,54,63,
+60,57,57,60,254,130,110,110,95,95,110,110,95,49,56,56,49,49,55,55,49,0,1,
+255,139,254,59,0,143,255,131,0,9,0,0,3,54,54,55,51,21,6,6,7,35,117,17,32,
+13,198,29,99,42,90,254,86,68,159,74,20,67,180,61,255,255,255,44,254,20,0,
+216,0,18,16,3,0,122,254,177,0,0,255,255,255,38,254,20,0,221,0,0,16,3,1,81,
+253,198,0,0,0,1,255,197,254,104,0,61,255,176,0,3,0,0,7,51,17,35,59,120,120,
+80,254,184,0,1,254,143,254,49,1,113,255,109,0,13,0,0,1,53,52,38,35,35,34,
+6,21,21,35,17,33,17,1,14,89,91,180,95,85,99,2,226,254,49,25,95,73,79,89,25,
+1,60,254,196,0,1,254,184,254,137,1,72,255,123,0,26,0,0,18,38,39,6,6,35,34,
+38,39,51,22,22,51,50,54,55,51,22,22,51,50,54,55,51,6,6,35,77,70,17,17,71,
+60,86,81,3,86,2,36,46,56,48,3,82,2,44,60,57,46,2,86,5,97,89,254,137,46,38,
+38,46,105,137,83,60,62,81,74,69,58,85,132,110,0,1,254,209,254,61,1,45,255,
+133,0,16,0,0,5,6,6,7,35,38,38,39,53,51,22,22,23,54,54,55,51,1,45,66,113,26,
+194,26,124,55,80,59,118,46,46,116,59,80,150,80,164,57,57,178,66,27,34,101,
+49,49,101,34,0,1,254,209,254,61,1,45,255,133,0,16,0,0,1,54,54,55,51,22,22,
+23,21,35,38,38,39,6,6,7,35,254,209,48,131,26,194,27,121,57,80,59,118,46,46,
+116,59,80,254,88,58,187,56,58,174,69,27,34,101,50,50,101,34,0,1,254,225,254,
+92,1,31,255,117,0,13,0,0,2,38,39,51,22,22,51,50,54,55,51,6,6,35,136,149,2,
+94,17,101,75,75,101,17,94,4,150,133,254,92,156,125,75,65,65,75,130,151,0,
+1,254,225,254,92,1,31,255,117,0,13,0,0,22,22,23,35,38,38,35,34,6,7,35,54,
+54,51,130,152,5,94,17,101,75,75,101,17,94,2,152,133,139,149,132,74,65,65,
+74,127,154,0,1,254,147,254,131,1,109,255,137,0,19,0,0,22,54,55,51,6,6,35,
+34,38,35,34,6,7,35,54,54,51,50,22,51,216,47,9,93,7,110,98,89,187,46,41,49,
+10,93,7,111,100,86,189,44,248,44,65,107,135,129,39,69,106,135,129,0,1,254,
+215,254,229,1,41,255,94,0,3,0,0,1,33,53,33,1,41,253,174,2,82,254,229,121,
+0,1,255,236,254,229,3,72,255,94,0,3,0,0,1,33,53,33,3,72,252,164,3,92,254,
+229,121,0,2,255,236,254,61,3,72,255,172,0,3,0,7,0,0,1,33,53,33,53,33,53,33,
+3,72,252,164,3,92,252,164,3,92,254,61,121,125,121,255,255,254,148,1,195,1,
+109,2,201,16,3,1,82,253,179,252,234,0,1,254,154,2,0,1,102,2,121,0,3,0,0,1,
+33,53,33,1,102,253,52,2,204,2,0,121,0,1,253,133,2,0,2,123,2,121,0,3,0,0,1,
+33,53,33,2,123,251,10,4,246,2,0,121,0,1,254,174,1,84,1,82,3,41,0,3,0,0,1,
+1,39,1,1,82,253,154,62,2,102,2,193,254,147,104,1,109,0,1,254,94,255,92,1,
+117,6,41,0,3,0,0,1,1,39,1,1,117,253,90,113,2,166,5,252,249,96,45,6,160,0,
+1,255,133,254,20,0,123,255,211,0,13,0,0,3,50,54,53,52,38,35,53,50,22,21,20,
+6,35,123,62,73,73,62,108,138,137,109,254,121,62,61,61,62,100,119,104,103,
+121,0,1,254,143,254,20,1,113,255,109,0,13,0,0,5,21,20,22,51,51,50,54,53,53,
+51,17,33,17,254,242,86,94,180,95,85,99,253,30,147,25,94,74,79,89,25,254,167,
+1,89,0,2,255,68,254,41,0,188,255,162,0,3,0,7,0,0,19,33,17,33,3,53,35,21,188,
+254,136,1,120,96,184,254,41,1,121,254,231,187,187,0,1,254,184,254,137,1,72,
+255,123,0,26,0,0,6,22,23,54,54,51,50,22,23,35,38,38,35,34,6,7,35,38,38,35,
+34,6,7,35,54,54,51,77,70,17,17,71,60,80,84,6,86,2,35,47,57,47,3,82,3,46,57,
+58,45,2,86,2,96,93,133,46,38,38,46,94,148,82,62,64,80,80,64,61,83,123,119,
+0,1,255,78,4,164,0,178,6,6,0,11,0,0,17,7,39,55,39,55,23,55,23,7,23,7,102,
+76,100,100,76,102,102,76,100,98,76,5,8,100,76,100,102,76,102,102,78,100,100,
+76,0,1,255,125,4,147,0,131,6,250,0,19,0,0,18,22,21,20,6,7,53,54,54,53,52,
+38,53,52,54,55,21,6,6,21,2,129,127,115,66,43,129,133,109,62,47,6,39,155,70,
+79,93,7,93,6,39,37,37,154,73,79,92,5,92,6,40,36,0,2,254,82,6,20,1,174,7,131,
+0,3,0,7,0,0,1,33,53,33,53,33,53,33,1,174,252,164,3,92,252,164,3,92,6,20,121,
+125,121,255,255,254,253,4,217,0,139,6,33,16,3,0,67,253,116,0,0,255,255,255,
+120,4,217,1,5,6,33,16,3,0,118,253,241,0,0,255,255,254,148,4,217,1,109,5,223,
+16,3,1,82,253,179,0,0,255,255,255,136,4,110,0,140,5,182,16,3,2,55,254,13,
+6,51,255,255,254,199,4,208,1,60,6,120,16,3,1,85,253,179,255,196,255,255,255,
+181,254,45,0,202,255,113,16,3,7,149,254,253,0,0,255,255,254,143,4,217,1,113,
+6,21,18,3,5,7,0,0,6,168,0,2,254,82,254,61,1,174,255,172,0,3,0,7,0,0,1,33,
+53,33,53,33,53,33,1,174,252,164,3,92,252,164,3,92,254,61,121,125,121,255,
+255,255,51,254,106,0,205,255,185,18,3,4,237,0,0,249,165,0,1,255,96,254,43,
+0,160,255,98,0,5,0,0,23,17,35,53,35,53,160,109,211,158,254,201,203,108,0,
+1,254,147,4,143,1,109,6,41,0,31,0,0,3,38,38,35,34,6,7,35,54,54,51,50,22,23,
+55,23,7,22,22,51,50,54,55,51,6,6,35,34,38,39,7,39,76,25,46,25,41,49,10,93,
+7,111,100,40,68,31,57,90,63,26,47,23,44,47,9,93,7,110,98,42,69,31,57,88,5,
+51,17,22,39,69,106,135,23,16,113,45,121,17,20,44,65,107,135,22,17,113,45,
+0,3,254,147,4,147,1,109,7,92,0,11,0,23,0,43,0,0,2,54,51,50,22,21,20,6,35,
+34,38,53,16,54,51,50,22,21,20,6,35,34,38,53,4,54,55,51,6,6,35,34,38,35,34,
+6,7,35,54,54,51,50,22,51,96,56,40,43,53,58,38,40,56,56,40,43,53,58,38,40,
+56,1,56,47,9,93,7,110,98,88,189,45,40,50,10,93,7,111,100,86,189,44,5,47,49,
+53,49,53,50,50,53,2,49,49,55,47,53,50,50,53,242,44,65,107,135,109,40,69,107,
+135,109,255,255,254,148,4,177,1,109,6,233,16,35,1,82,253,179,255,216,16,3,
+1,82,253,179,1,10,0,1,254,215,254,66,1,41,255,182,0,9,0,0,3,21,39,55,21,51,
+53,23,7,53,113,184,184,226,184,184,254,178,112,186,186,112,112,186,186,112,
+0,1,255,66,254,20,0,190,255,215,0,6,0,0,21,23,35,17,35,17,35,190,112,156,
+112,41,184,254,245,1,11,0,24,253,37,0,0,2,219,5,182,0,5,0,9,0,13,0,19,0,25,
+0,29,0,33,0,39,0,47,0,55,0,65,0,73,0,83,0,93,0,103,0,113,0,121,0,131,0,140,
+0,150,0,158,0,168,0,176,0,186,0,0,1,35,53,35,53,33,5,33,53,33,1,35,17,51,
+1,35,21,35,17,33,1,33,53,51,53,51,37,35,17,51,1,33,53,33,5,33,17,51,21,51,
+1,52,51,50,21,20,35,34,17,52,51,50,21,20,35,34,1,34,53,52,51,50,22,21,20,
+6,33,34,53,52,51,50,21,20,3,52,51,50,21,20,6,35,34,38,17,52,51,50,21,20,6,
+35,34,38,1,52,51,50,21,20,6,35,34,38,17,52,51,50,21,20,6,35,34,38,37,50,21,
+20,35,34,53,52,33,50,21,20,35,34,38,53,52,54,1,50,21,20,35,34,53,52,54,33,
+50,21,20,35,34,38,53,52,54,37,52,51,50,21,20,35,34,17,52,51,50,21,20,6,35,
+34,38,1,52,51,50,21,20,35,34,17,52,51,50,21,20,6,35,34,38,2,219,108,211,1,
+63,253,199,254,188,1,68,2,57,108,108,251,137,209,110,1,63,4,119,254,193,211,
+108,250,184,110,110,3,15,254,188,1,68,253,194,254,193,110,209,1,101,55,55,
+55,55,55,55,55,55,254,121,56,56,27,28,28,3,108,56,56,55,246,56,55,31,24,25,
+31,56,55,31,24,25,31,253,125,55,56,31,25,24,31,55,56,31,25,24,31,3,27,55,
+55,56,252,252,56,56,27,28,28,3,87,55,55,56,28,252,224,56,56,27,28,28,2,46,
+55,55,55,55,55,55,30,25,25,30,254,160,55,55,55,55,55,55,30,25,25,30,4,119,
+209,110,110,110,252,133,1,66,1,203,209,1,63,250,74,111,211,249,1,66,252,131,
+111,111,1,66,211,4,43,55,55,56,252,187,55,55,56,1,191,55,55,30,25,25,30,55,
+55,55,55,1,119,55,55,28,28,28,253,157,55,55,28,28,28,2,155,55,55,28,28,28,
+253,157,55,55,28,28,28,226,55,55,55,55,55,55,30,25,25,30,1,97,56,55,55,25,
+31,56,55,30,25,25,31,182,55,55,55,252,251,56,56,27,28,28,3,87,55,55,55,252,
+251,56,56,27,28,28,0,1,255,70,4,141,0,186,6,53,0,16,0,0,19,38,38,39,53,51,
+22,22,23,21,6,6,7,35,53,54,54,16,55,107,40,20,68,149,135,79,180,93,20,70,
+90,5,98,22,63,32,94,47,72,43,100,27,72,63,95,54,48,0,1,255,143,4,217,0,112,
+6,135,0,13,0,0,19,34,6,21,20,22,51,21,34,38,53,52,54,51,112,51,66,60,57,103,
+122,122,103,6,33,59,54,54,59,102,112,103,99,116,0,2,254,225,4,217,1,31,6,
+190,0,11,0,25,0,0,2,54,51,50,22,21,20,6,35,34,38,53,18,22,23,35,38,38,35,
+34,6,7,35,54,54,51,104,59,45,49,55,56,48,51,53,237,149,5,94,17,101,75,75,
+101,17,94,2,149,136,5,138,52,57,57,58,57,58,57,1,114,151,129,74,65,65,74,
+123,157,0,1,255,59,254,20,0,197,255,158,0,11,0,0,7,55,23,55,23,7,23,7,39,
+7,39,55,197,78,119,121,76,119,119,78,119,119,78,121,174,76,119,119,76,121,
+119,78,119,119,78,119,0,1,255,59,254,20,0,197,255,174,0,16,0,0,19,22,22,23,
+21,35,38,38,39,53,54,54,55,51,21,6,6,4,53,101,39,21,100,181,92,89,174,110,
+21,44,100,254,225,20,54,26,105,56,67,23,119,13,70,62,104,31,52,0,1,255,59,
+254,20,0,197,255,174,0,16,0,0,3,38,38,39,53,51,22,22,23,21,6,6,7,35,53,54,
+54,4,53,101,39,21,100,186,87,94,178,101,21,43,94,254,225,20,55,26,104,56,
+68,21,119,14,75,57,105,30,50,0,2,254,111,254,20,1,145,255,174,0,16,0,33,0,
+0,3,38,38,39,53,51,22,22,23,21,6,6,7,35,53,54,54,37,6,6,7,35,53,54,54,55,
+51,22,22,23,21,35,38,38,209,53,101,38,20,113,165,74,99,157,96,20,52,91,1,
+199,20,55,26,104,56,66,23,119,12,63,70,104,31,54,254,225,20,55,26,104,63,
+64,18,119,15,78,53,105,36,46,6,53,101,39,21,100,181,92,78,167,128,21,45,103,
+0,1,255,144,4,217,0,113,6,135,0,13,0,0,3,50,54,53,52,38,35,53,50,22,21,20,
+6,35,112,51,66,60,57,103,122,122,103,5,63,59,54,54,59,102,112,103,99,116,
+255,255,0,223,4,248,1,201,5,245,16,2,1,79,0,0,0,1,255,6,254,20,0,250,255,
+195,0,17,0,0,7,39,51,7,55,23,7,23,7,39,23,35,55,7,39,55,39,55,18,50,136,50,
+170,62,215,215,62,170,50,136,50,170,62,215,215,62,242,181,181,131,116,49,
+50,116,133,183,183,133,116,50,49,116,0,3,254,158,254,20,1,98,255,174,0,23,
+0,35,0,47,0,0,0,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,54,51,
+50,22,21,38,38,35,34,6,21,20,22,51,50,54,53,36,38,35,34,6,21,20,22,51,50,
+54,53,1,98,112,95,46,75,26,26,76,48,93,111,112,92,42,80,28,26,75,46,95,112,
+106,56,45,44,54,54,44,46,55,254,215,56,45,44,54,54,44,46,55,254,131,111,35,
+31,31,35,112,93,95,110,33,32,31,34,110,95,54,53,54,53,50,56,55,51,54,53,54,
+53,50,56,55,51,0,1,255,61,4,197,0,195,6,68,0,7,0,0,19,7,35,55,35,55,51,7,
+195,70,105,37,252,70,105,37,5,186,245,137,246,138,0,1,255,104,254,88,5,113,
+255,203,0,13,0,0,5,6,4,33,32,36,39,51,22,4,51,50,36,55,5,113,109,254,136,
+254,225,254,232,254,130,111,91,87,1,89,250,246,1,89,88,53,188,183,176,195,
+123,125,123,125,0,1,255,104,4,195,5,113,6,53,0,13,0,0,1,6,4,33,32,36,39,51,
+22,4,51,50,36,55,5,113,109,254,134,254,227,254,219,254,137,105,91,87,1,89,
+250,246,1,89,88,6,53,190,180,183,187,123,125,123,125,0,1,255,72,4,246,4,0,
+5,111,0,3,0,0,3,33,21,33,184,4,184,251,72,5,111,121,0,1,255,72,254,219,4,
+0,255,84,0,3,0,0,7,33,21,33,184,4,184,251,72,172,121,0,1,255,84,4,217,5,121,
+5,227,0,19,0,0,0,36,35,34,6,7,35,54,54,51,50,4,51,50,54,55,51,6,6,35,3,60,
+254,25,157,110,120,34,92,32,188,142,211,1,238,149,101,144,20,92,25,185,161,
+4,219,139,66,75,124,140,139,77,64,125,139,0,1,255,104,4,195,5,113,6,53,0,
+13,0,0,1,38,36,35,34,4,7,35,54,36,33,32,4,23,5,20,87,254,172,252,239,254,
+162,93,91,107,1,121,1,33,1,23,1,124,113,4,195,124,123,117,130,188,182,177,
+193,0,1,255,72,254,66,4,0,255,182,0,6,0,0,3,53,33,53,23,7,53,184,4,0,184,
+184,254,178,148,112,186,186,112,0,2,254,197,2,41,1,59,4,236,0,33,0,43,0,0,
+2,6,21,34,38,53,52,54,51,50,22,21,17,20,22,51,21,35,39,35,6,6,35,34,38,53,
+52,54,55,55,53,52,38,35,2,51,50,54,53,53,7,6,6,21,77,52,66,65,123,121,133,
+112,40,46,198,21,6,39,94,59,98,115,149,156,96,52,57,143,92,75,85,82,94,76,
+4,156,56,77,38,48,61,66,108,114,254,189,47,33,70,94,61,45,103,89,113,104,
+5,4,67,85,57,253,237,86,76,92,4,5,70,70,0,2,254,223,2,41,1,33,4,236,0,22,
+0,29,0,0,2,38,53,52,54,51,50,22,21,21,33,22,22,51,50,54,55,22,22,21,20,6,
+35,2,6,7,33,38,38,35,122,167,154,143,130,151,254,84,5,90,85,53,99,28,14,25,
+131,106,79,72,9,1,14,2,66,59,2,41,185,163,180,179,156,150,65,124,116,51,41,
+6,32,17,49,84,2,113,108,99,100,107,0,2,255,61,2,53,0,197,5,246,0,17,0,29,
+0,0,3,50,54,53,17,52,38,35,53,51,17,20,22,51,51,21,33,53,18,54,51,50,22,21,
+20,6,35,34,38,53,166,52,42,47,61,254,39,55,29,254,120,107,48,36,40,44,49,
+35,36,48,2,123,35,39,1,139,37,37,69,253,236,41,39,70,70,3,85,38,45,41,47,
+39,39,47,0,2,254,199,2,41,1,57,4,236,0,11,0,23,0,0,0,6,35,34,38,53,52,54,
+51,50,22,21,4,22,51,50,54,53,52,38,35,34,6,21,1,57,159,156,145,166,158,157,
+150,161,254,35,75,89,89,73,75,89,91,71,2,215,174,175,179,178,175,182,171,
+135,137,137,135,135,136,135,136,0,1,254,121,2,41,1,135,4,223,0,32,0,0,1,20,
+22,51,21,35,39,35,6,6,35,34,38,53,17,52,38,35,53,51,17,20,22,51,50,54,53,
+17,52,38,35,53,33,1,27,46,62,227,17,8,40,99,57,110,114,47,63,254,59,66,72,
+77,46,64,1,0,2,197,39,35,70,84,57,39,120,132,1,41,38,38,69,254,76,83,79,101,
+92,1,2,40,38,69,0,1,254,244,2,41,1,12,4,236,0,29,0,0,2,38,53,52,54,51,50,
+22,21,20,6,35,52,38,35,34,6,21,20,22,51,50,54,55,22,22,21,20,6,35,110,158,
+147,152,99,136,70,69,47,49,80,70,84,96,56,90,24,14,23,125,106,2,41,179,171,
+177,180,72,62,49,37,69,71,131,146,129,123,52,42,15,33,15,53,76,0,2,254,154,
+2,41,1,104,5,246,0,31,0,43,0,0,19,20,22,51,51,21,35,39,35,6,6,35,34,38,53,
+52,54,51,50,22,23,51,38,38,53,53,52,38,35,35,53,33,2,54,53,52,38,35,34,6,
+21,20,22,51,244,40,54,22,241,15,6,29,87,66,134,140,140,134,65,84,29,8,2,2,
+40,52,22,1,4,222,76,76,88,77,68,68,77,2,199,40,36,70,80,43,49,169,181,184,
+173,40,42,26,58,16,104,40,34,70,252,147,116,138,138,122,133,127,128,126,0,
+1,254,121,2,53,1,135,5,246,0,42,0,0,3,21,33,53,51,50,54,53,17,52,38,35,35,
+53,33,21,20,6,7,51,54,54,51,50,22,21,17,20,22,51,21,35,17,52,38,35,34,6,21,
+17,20,22,51,20,254,141,24,54,39,42,51,24,1,6,5,3,8,32,87,59,118,122,40,62,
+250,56,71,74,69,42,52,2,123,70,70,39,41,2,155,39,35,70,254,35,55,19,44,53,
+120,130,254,217,40,40,70,1,180,79,83,105,87,254,250,39,35,0,1,253,184,2,53,
+2,72,4,236,0,58,0,0,3,21,33,53,51,50,54,53,17,52,38,35,53,51,23,51,54,54,
+51,50,22,23,51,54,54,51,50,22,21,17,20,22,51,21,35,17,52,38,35,34,6,21,17,
+20,22,51,21,35,17,52,38,35,34,6,21,17,20,22,51,211,254,139,29,54,34,41,61,
+223,18,9,38,91,63,54,97,29,8,40,99,60,106,115,40,63,248,55,68,64,65,39,63,
+249,53,68,67,71,46,51,2,123,70,70,41,39,1,131,39,37,69,84,53,44,49,58,62,
+45,127,123,254,217,40,40,70,1,180,79,83,93,83,254,240,41,39,70,1,180,79,83,
+101,91,254,250,39,35,0,1,254,227,2,53,1,29,4,236,0,34,0,0,19,33,53,50,54,
+53,17,52,38,35,53,51,23,51,62,2,51,50,22,21,20,6,35,52,38,35,34,6,21,21,20,
+22,51,51,113,254,114,64,45,45,64,224,16,6,32,36,66,52,67,71,65,79,25,32,53,
+60,41,54,47,2,53,70,40,40,1,131,38,38,69,117,58,39,33,51,50,41,57,54,44,156,
+100,194,39,35,0,1,255,45,2,41,0,211,5,123,0,24,0,0,18,54,55,21,6,6,35,34,
+38,53,17,35,53,50,54,55,51,21,51,21,35,17,20,22,51,138,47,26,16,72,37,109,
+92,96,46,94,20,82,172,172,45,41,2,123,6,8,76,7,13,92,109,1,168,61,59,105,
+156,69,254,84,60,55,0,1,254,133,2,53,1,125,4,223,0,39,0,0,1,53,33,21,35,34,
+6,21,20,22,23,23,22,22,23,51,54,54,55,55,54,54,53,52,38,35,35,53,33,21,35,
+34,6,7,3,35,3,38,38,35,254,133,1,90,26,34,36,9,14,79,16,24,7,9,12,23,8,94,
+5,5,37,35,22,1,43,27,31,36,19,202,140,211,12,36,34,4,154,69,69,20,17,9,30,
+41,215,40,81,27,44,67,20,248,14,29,8,26,24,69,69,40,51,253,246,2,43,34,24,
+0,1,254,135,2,53,1,121,4,223,0,61,0,0,18,38,35,53,33,21,35,34,6,7,7,23,22,
+22,51,51,21,33,53,51,50,53,52,38,39,39,35,7,6,6,21,20,22,51,21,33,53,51,50,
+54,55,55,39,38,38,35,35,53,33,21,34,6,21,20,22,23,23,51,55,54,54,53,109,40,
+32,1,49,25,36,50,34,129,184,29,42,25,29,254,155,19,65,24,19,73,8,80,10,21,
+37,47,254,182,23,40,59,32,160,160,27,43,31,28,1,90,45,29,12,13,71,9,55,11,
+18,4,139,15,69,69,30,44,166,240,38,25,70,70,33,12,43,25,98,109,14,39,20,14,
+15,70,70,37,39,196,211,38,22,69,69,15,12,9,27,15,99,80,17,34,13,0,1,0,82,
+4,70,1,119,5,182,0,9,0,0,19,54,54,55,51,21,6,6,7,35,82,29,47,4,213,43,107,
+45,98,4,100,77,203,58,20,101,197,50,0,1,0,41,254,20,1,78,255,133,0,9,0,0,
+5,6,6,7,35,53,54,54,55,51,1,78,28,48,4,213,42,107,46,98,154,72,207,59,21,
+99,199,50,255,255,0,184,254,45,1,205,255,113,18,2,7,149,0,0,255,255,0,72,
+255,236,3,127,4,94,18,2,4,65,0,0,255,255,0,113,255,236,3,160,4,94,18,34,0,
+70,0,0,16,3,1,79,0,227,252,206,255,255,0,72,255,236,3,127,4,94,18,34,4,65,
+0,0,16,3,1,79,0,102,252,206,255,255,0,98,254,197,1,178,4,84,18,2,0,30,0,0,
+0,3,0,113,255,236,4,43,6,20,0,27,0,39,0,51,0,0,0,38,39,6,6,7,51,54,54,51,
+50,18,21,20,6,35,34,2,17,16,0,33,50,22,21,20,6,35,18,38,35,34,6,21,20,22,
+51,50,54,53,0,6,7,22,22,51,50,54,53,52,38,35,2,41,176,70,31,33,3,8,35,188,
+127,233,236,246,237,245,226,1,25,1,5,141,165,170,152,231,136,150,146,129,
+136,139,149,137,254,194,147,53,53,152,88,97,100,103,90,4,47,55,50,82,202,
+118,93,110,254,255,241,247,252,1,62,1,83,1,179,1,228,131,108,112,134,254,
+128,185,176,217,196,197,187,206,3,207,96,88,44,52,71,74,59,76,255,255,255,
+147,0,0,6,49,5,245,16,35,2,79,0,250,0,0,16,3,1,84,253,155,255,151,255,255,
+255,246,0,0,5,55,7,70,18,34,2,79,0,0,16,3,0,106,0,68,1,82,0,3,0,113,254,20,
+5,35,6,20,0,21,0,32,0,43,0,0,1,16,0,5,17,35,17,46,3,53,16,0,37,17,51,17,30,
+3,5,20,30,2,23,17,14,3,5,52,46,2,39,17,62,3,5,35,254,237,254,248,123,127,
+200,139,74,1,17,1,11,123,125,200,140,74,252,20,37,81,130,94,94,130,81,37,
+3,37,37,81,130,92,93,130,81,36,2,39,254,238,254,230,13,254,38,1,218,7,77,
+141,207,137,1,16,1,24,13,1,184,254,72,7,76,141,205,136,106,165,116,67,9,3,
+152,8,65,114,164,106,105,163,114,65,8,252,106,9,67,116,165,0,1,0,92,254,109,
+4,213,4,94,0,50,0,0,1,6,2,21,20,22,51,21,20,6,35,34,38,53,52,54,55,22,22,
+51,50,54,53,53,6,6,35,34,38,53,52,54,55,1,35,54,18,53,52,38,35,52,54,51,50,
+22,21,20,6,7,1,4,113,58,61,102,117,105,108,72,84,17,14,25,48,34,61,55,12,
+23,14,125,129,46,42,253,127,125,67,73,93,96,59,54,132,142,26,43,2,100,4,74,
+200,254,169,152,149,137,217,156,147,56,56,25,37,14,17,16,75,73,86,3,3,160,
+167,109,233,121,252,254,164,1,99,173,157,163,46,60,190,187,88,168,116,2,217,
+0,2,0,115,0,0,5,123,5,205,0,24,0,36,0,0,1,36,0,17,16,0,33,32,0,17,20,0,5,
+21,20,22,51,51,21,33,53,51,50,54,53,0,22,51,50,54,17,16,38,35,34,6,17,2,143,
+254,254,254,230,1,76,1,59,1,41,1,88,254,227,255,0,71,97,27,253,172,26,96,
+72,254,199,206,212,211,205,205,209,210,210,1,16,26,1,58,1,11,1,30,1,64,254,
+189,254,227,255,254,190,28,39,73,74,86,86,72,75,1,132,242,240,1,2,1,2,239,
+238,254,253,0,2,0,113,254,20,4,45,4,94,0,14,0,26,0,0,1,17,38,2,53,16,18,51,
+50,18,17,16,2,7,17,0,22,51,50,54,53,52,38,35,34,6,21,1,240,186,197,242,239,
+231,244,194,189,254,137,137,144,143,135,133,147,146,133,254,20,1,222,27,1,
+32,250,1,31,1,24,254,222,254,235,254,254,254,233,28,254,34,3,30,220,218,247,
+241,218,219,240,0,1,0,117,0,0,4,164,5,203,0,34,0,0,37,20,22,51,51,21,33,53,
+51,50,54,53,53,38,0,53,16,0,33,50,22,21,20,6,35,52,38,35,34,6,21,20,18,51,
+51,3,74,71,97,26,253,172,27,97,71,245,254,239,1,83,1,29,217,230,101,77,142,
+131,193,200,223,203,72,233,73,74,86,86,74,73,43,27,1,56,253,1,17,1,86,123,
+107,63,80,123,141,255,249,231,254,252,0,1,0,113,254,96,4,16,4,139,0,36,0,
+0,18,0,33,50,54,55,51,6,6,35,34,38,35,34,6,21,20,22,4,22,21,20,6,35,34,38,
+53,54,54,53,52,46,4,53,113,1,59,1,8,146,121,16,65,4,106,111,90,160,39,103,
+116,90,1,77,134,202,123,38,46,120,128,82,220,156,99,37,3,32,1,42,25,40,127,
+123,64,233,230,140,140,78,118,101,152,201,49,50,2,97,93,76,60,47,73,129,180,
+103,0,1,0,78,0,0,4,96,5,182,0,33,0,0,1,17,20,22,51,51,21,33,53,51,50,54,53,
+17,52,38,35,35,53,33,19,35,39,38,38,35,33,17,33,19,35,38,38,35,1,223,71,97,
+68,253,131,26,97,71,71,97,26,4,8,10,106,10,10,98,81,254,176,1,238,6,107,13,
+90,85,2,154,254,79,73,74,86,86,68,69,3,246,68,71,86,254,154,88,84,84,253,
+176,254,221,108,81,0,1,0,55,254,20,3,240,4,74,0,24,0,0,1,17,35,17,52,38,35,
+35,53,33,19,35,39,38,38,35,33,17,33,17,35,53,52,38,35,1,168,193,74,94,8,3,
+172,13,101,10,16,56,71,254,182,1,131,86,70,77,1,115,252,161,5,84,70,70,86,
+254,178,67,100,66,253,242,254,248,10,91,63,0,1,0,70,255,236,3,66,5,195,0,
+45,0,0,0,54,55,33,53,54,54,53,52,38,35,34,6,7,38,38,53,52,54,51,50,22,21,
+20,6,7,33,21,6,2,21,20,22,51,50,54,55,22,22,21,20,6,35,34,38,53,1,213,95,
+93,253,250,70,72,41,35,30,29,17,32,27,78,71,96,105,76,70,2,7,79,98,36,42,
+31,44,15,27,23,93,84,89,99,1,24,243,147,102,130,229,96,48,52,25,26,12,44,
+32,40,71,110,105,77,211,114,102,132,254,215,112,42,46,39,24,10,45,31,52,72,
+112,103,0,1,0,86,254,20,3,164,6,20,0,33,0,0,0,38,53,52,18,55,1,53,54,18,53,
+52,38,35,52,54,51,50,22,21,20,2,7,1,21,6,2,21,20,22,23,20,6,35,2,83,110,175,
+133,253,61,130,110,105,104,71,66,117,133,128,151,2,195,118,161,93,92,71,67,
+254,20,147,136,150,1,174,200,254,236,186,236,1,77,160,121,119,49,57,173,152,
+128,254,200,232,1,21,195,177,254,34,162,87,76,5,70,78,0,1,0,70,255,236,4,
+170,5,203,0,33,0,0,1,1,38,38,35,34,6,21,34,38,53,52,36,51,32,0,17,16,0,33,
+53,50,18,17,52,38,39,5,39,1,38,38,39,1,1,51,2,39,56,153,96,155,173,74,81,
+1,3,224,1,42,1,87,254,149,254,191,236,221,2,2,254,38,47,1,254,8,24,17,253,
+221,3,160,1,35,81,74,166,135,66,63,114,167,254,118,254,156,254,162,254,109,
+110,1,59,1,72,26,52,25,254,94,1,14,54,90,40,254,218,0,1,0,37,254,20,2,221,
+4,90,0,24,0,0,1,38,38,39,53,4,0,17,20,2,7,39,54,18,53,52,38,39,5,39,37,38,
+39,5,39,1,199,68,217,133,1,53,1,131,141,141,64,75,77,2,2,254,198,28,1,77,
+12,29,254,156,29,2,139,168,185,16,94,14,254,5,254,112,212,254,167,128,56,
+93,1,45,187,28,53,26,98,92,104,112,97,113,93,0,1,0,31,254,20,8,33,5,182,0,
+87,0,0,0,36,35,34,6,21,34,38,53,52,54,51,50,4,51,50,54,53,52,54,55,35,6,6,
+35,34,38,39,6,6,35,34,38,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,
+50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,50,54,53,17,52,38,
+35,35,53,33,21,35,34,6,21,17,20,0,35,4,199,254,59,149,88,78,78,74,157,156,
+167,1,199,200,142,108,2,2,9,59,173,122,121,171,50,59,182,128,191,202,71,97,
+26,2,84,27,97,71,107,108,154,151,71,97,26,2,84,27,97,71,118,95,143,164,72,
+96,26,2,84,27,97,71,254,255,202,254,20,224,101,123,62,51,104,105,223,233,
+230,34,65,34,115,108,110,115,116,109,216,205,3,68,68,71,86,86,74,73,252,182,
+136,128,165,183,2,254,68,71,86,86,74,73,252,207,142,147,219,168,2,207,75,
+72,86,86,74,73,251,74,249,254,246,0,1,0,57,254,20,7,86,4,74,0,78,0,0,0,54,
+53,52,54,55,35,6,6,35,34,38,39,35,6,6,35,34,38,53,17,52,38,35,35,53,33,17,
+20,22,51,50,54,53,17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,
+53,33,21,35,34,6,21,17,20,6,35,34,36,35,34,6,21,38,38,53,52,54,51,50,4,51,
+5,116,105,3,5,10,52,139,118,112,151,34,16,51,150,121,167,167,62,93,9,1,101,
+104,111,111,116,63,93,8,1,101,104,111,115,122,69,97,8,2,39,27,93,64,232,219,
+190,254,169,126,73,75,74,83,151,125,161,1,106,167,254,115,181,214,55,75,38,
+97,89,95,91,96,90,203,198,1,227,74,74,86,253,61,144,136,158,147,1,192,75,
+73,86,253,61,144,136,172,159,1,176,68,70,86,86,72,76,252,144,235,241,205,
+99,106,2,75,61,71,90,204,0,1,0,82,0,0,5,86,5,203,0,51,0,0,0,22,51,50,54,55,
+17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,
+6,6,35,34,38,53,52,18,51,50,22,21,20,6,35,52,38,35,34,6,21,1,33,153,166,81,
+180,96,60,88,8,2,45,27,97,71,71,97,27,253,172,27,97,71,106,219,105,218,235,
+217,172,142,147,92,80,53,76,77,93,3,56,156,55,51,1,199,78,69,86,86,74,73,
+252,18,69,68,86,86,74,73,1,175,64,63,226,226,231,1,7,105,92,72,75,123,118,
+205,184,0,1,0,74,0,0,4,203,6,39,0,50,0,0,18,18,51,50,22,21,20,6,35,52,38,
+35,34,6,21,20,22,51,50,54,53,17,33,21,35,34,6,21,17,20,22,51,51,21,33,53,
+51,50,54,53,53,52,54,55,35,6,6,35,34,2,17,74,206,185,127,135,66,75,63,70,
+90,91,137,138,148,155,1,121,17,97,71,70,96,19,253,196,29,95,71,6,2,10,54,
+172,122,216,210,4,242,1,53,97,79,54,57,110,83,234,246,216,195,172,160,2,122,
+86,74,73,251,180,68,69,86,86,72,75,238,53,92,29,93,93,1,16,1,12,0,1,0,55,
+254,23,5,102,5,182,0,57,0,0,0,6,21,34,38,53,52,54,51,50,4,51,50,18,17,16,
+2,35,34,6,7,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,21,35,
+34,6,21,17,54,54,51,50,0,17,16,0,35,34,36,35,1,29,58,80,92,149,120,122,1,
+21,123,153,177,207,197,77,148,68,71,97,27,253,172,26,96,72,71,97,26,2,84,
+27,97,71,85,177,97,229,1,59,254,227,251,160,254,236,74,254,195,97,75,57,57,
+72,96,172,1,56,1,38,1,21,1,35,56,51,254,57,73,74,86,86,72,75,3,238,69,68,
+86,86,74,73,254,82,66,61,254,152,254,177,254,169,254,135,172,0,1,0,47,254,
+20,4,123,4,74,0,56,0,0,0,18,17,52,38,35,34,6,21,21,20,22,51,51,21,33,53,51,
+50,54,53,17,52,38,35,35,53,33,17,20,6,7,51,54,54,51,50,18,17,16,2,35,34,38,
+35,34,6,21,34,38,53,52,54,51,50,22,51,3,57,123,127,131,129,127,71,97,27,253,
+186,27,97,71,72,92,10,1,110,5,3,10,45,156,113,188,209,242,182,153,205,76,
+44,52,69,69,123,78,125,206,101,254,117,1,7,1,7,245,242,167,164,54,73,74,86,
+86,68,69,2,137,71,69,86,254,151,55,97,22,88,99,254,193,254,220,254,207,254,
+186,127,67,60,39,45,63,85,135,0,1,0,104,255,236,4,6,5,203,0,47,0,0,1,22,22,
+21,20,6,35,34,38,53,52,54,36,54,53,52,38,35,34,6,21,20,22,51,51,21,20,6,35,
+34,38,53,52,54,51,50,22,21,20,6,4,6,21,20,22,51,50,54,3,223,17,22,247,199,
+239,241,183,1,117,143,129,123,101,128,51,49,31,70,57,85,85,227,182,201,227,
+180,254,145,147,147,146,131,206,1,33,11,38,31,92,137,205,206,145,199,149,
+137,126,107,126,109,91,44,46,17,45,61,93,79,161,183,205,166,163,211,149,135,
+116,117,115,100,0,1,0,41,254,20,3,154,4,92,0,46,0,0,0,22,51,20,6,35,34,38,
+53,52,54,51,50,22,21,20,6,4,6,21,20,22,51,50,54,55,22,22,21,20,6,35,34,38,
+53,52,54,54,36,54,53,52,38,35,34,6,21,1,16,44,51,53,60,68,80,217,164,177,
+221,152,254,111,125,170,135,124,191,58,15,22,230,178,222,251,106,178,1,31,
+107,123,113,96,115,3,42,46,51,60,94,78,114,177,192,164,157,199,209,161,110,
+131,162,102,93,12,40,28,100,138,242,230,121,175,128,150,139,104,103,122,97,
+73,0,2,0,63,0,0,4,199,5,197,0,34,0,37,0,0,33,33,53,1,38,38,35,34,6,7,34,38,
+53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,38,38,35,34,6,7,1,39,1,1,4,
+199,251,120,1,230,53,86,58,32,51,5,42,60,102,94,89,140,64,60,129,75,94,95,
+58,36,10,57,48,53,87,38,1,250,238,254,135,254,113,109,3,208,115,111,57,50,
+64,41,80,88,93,102,99,96,79,63,56,75,45,62,77,71,251,240,14,3,41,252,215,
+0,2,0,86,0,0,4,39,4,94,0,34,0,37,0,0,51,53,1,38,38,35,34,6,21,38,38,53,52,
+54,51,50,22,23,54,54,51,50,22,21,20,6,7,52,38,35,34,6,7,1,21,39,1,1,86,1,
+139,75,79,42,31,39,69,60,102,82,110,129,75,74,140,95,69,80,57,72,33,38,47,
+94,62,1,168,236,254,224,254,211,92,2,160,148,100,63,62,6,61,43,52,69,83,113,
+106,90,69,52,42,62,6,62,63,88,95,253,31,92,129,2,10,253,246,0,2,0,115,255,
+236,5,123,5,182,0,26,0,38,0,0,1,20,6,35,34,6,6,7,23,54,54,51,32,0,21,16,0,
+33,32,0,17,16,0,33,50,54,55,0,22,51,50,54,53,52,38,35,34,6,21,5,12,220,232,
+232,223,109,24,10,112,253,192,1,9,1,63,254,177,254,200,254,202,254,181,1,
+117,1,85,190,165,22,252,160,208,210,209,207,205,209,210,210,5,182,137,133,
+66,149,176,4,166,108,254,213,248,254,255,254,225,1,63,1,45,1,106,1,150,36,
+58,251,117,209,207,227,227,210,210,227,0,2,0,113,255,236,4,43,4,115,0,42,
+0,43,0,0,0,6,7,38,38,53,52,54,55,22,22,21,20,4,35,34,38,17,16,0,51,50,54,
+55,51,6,6,35,34,38,35,34,6,21,20,22,51,50,54,53,52,38,35,1,2,17,85,6,18,14,
+117,114,207,223,254,255,226,234,237,1,76,247,145,122,16,65,4,107,110,88,163,
+38,105,116,123,152,146,140,128,130,255,0,2,176,37,24,14,27,28,44,48,7,2,214,
+190,189,220,243,1,8,1,9,1,65,24,42,129,121,63,237,226,216,187,142,161,156,
+143,1,154,0,1,0,33,0,0,4,104,5,182,0,47,0,0,1,53,52,38,35,35,53,33,21,35,
+34,6,21,21,51,50,22,21,20,6,35,52,38,35,35,17,20,22,51,51,21,33,53,51,50,
+54,53,17,35,34,6,21,34,38,53,52,54,51,1,221,71,97,26,2,84,27,97,71,150,146,
+148,91,81,90,108,74,71,97,27,253,172,26,97,71,71,107,94,81,91,153,148,4,74,
+131,73,74,86,86,74,73,131,80,82,71,62,102,90,253,6,73,74,86,86,74,73,2,250,
+89,103,62,71,83,79,0,1,0,20,0,0,3,152,6,20,0,31,0,0,1,33,21,33,17,33,53,51,
+50,54,53,17,35,34,6,21,20,23,34,38,53,52,54,51,51,17,33,21,35,34,6,21,2,66,
+1,86,254,170,254,124,27,97,71,74,78,71,12,78,76,151,157,57,1,111,17,93,64,
+4,74,94,252,20,86,74,73,3,3,55,68,27,31,57,54,87,77,1,202,86,70,69,0,1,0,
+92,255,236,4,213,4,94,0,33,0,0,1,6,2,21,20,22,51,20,6,35,34,38,53,52,54,55,
+1,35,54,18,53,52,38,35,52,54,51,50,22,21,20,6,7,1,4,113,58,61,102,117,89,
+75,125,129,46,42,253,127,125,67,73,93,96,59,54,132,142,26,43,2,100,4,74,200,
+254,169,152,149,137,57,80,160,167,109,233,121,252,254,164,1,99,173,157,163,
+46,60,190,187,88,168,116,2,217,0,2,0,113,254,20,4,43,4,94,0,26,0,38,0,0,18,
+18,51,50,18,17,16,2,35,34,38,39,35,30,2,51,50,22,23,35,38,38,35,34,2,17,0,
+38,35,34,6,21,20,22,51,50,54,53,113,236,235,235,248,243,226,128,187,35,8,
+7,59,142,150,253,186,3,65,22,200,147,249,244,2,245,139,147,136,139,131,144,
+148,138,3,13,1,81,254,231,254,236,254,239,254,224,122,103,198,167,73,131,
+148,52,55,1,146,1,176,1,94,213,224,227,249,208,219,238,255,255,0,113,255,
+236,3,160,4,94,18,2,0,70,0,0,255,255,255,231,254,20,1,170,6,20,18,2,0,77,
+0,0,255,255,0,115,255,236,5,123,5,205,18,2,2,236,0,0,255,255,0,113,255,236,
+3,160,4,94,18,2,1,237,0,0,255,255,0,82,255,236,3,125,4,94,18,2,1,231,0,0,
+255,255,0,78,0,0,4,133,5,182,18,2,0,160,0,0,255,255,0,37,254,20,4,121,6,20,
+18,2,0,192,0,0,255,255,0,117,255,236,4,164,5,203,18,2,0,38,0,0,0,1,0,78,0,
+0,7,51,5,182,0,42,0,0,33,53,51,50,54,53,17,1,35,1,17,20,22,51,51,21,33,53,
+51,50,54,53,17,52,38,35,35,53,33,1,1,33,21,35,34,6,21,17,20,22,51,51,21,4,
+233,48,86,61,254,43,111,254,37,59,89,47,253,254,26,97,71,71,97,26,1,186,1,
+193,1,184,1,178,26,96,72,72,96,26,86,61,68,4,70,253,30,2,222,251,208,78,69,
+86,86,68,69,3,246,68,71,86,253,70,2,186,86,72,75,252,28,75,72,86,0,1,0,27,
+254,20,6,35,4,74,0,46,0,0,1,35,34,6,21,17,20,22,51,50,55,21,6,6,35,34,38,
+53,17,35,1,35,1,35,17,20,22,23,20,6,35,34,38,53,52,18,53,17,52,38,35,35,53,
+33,1,1,33,6,8,26,94,74,60,83,40,38,19,83,54,134,124,14,254,155,94,254,166,
+14,71,103,76,68,79,86,24,74,94,26,1,141,1,113,1,100,1,139,3,244,70,70,253,
+152,90,78,12,90,12,18,137,149,2,111,253,217,2,39,252,153,192,123,16,85,94,
+124,120,86,1,171,196,1,155,70,70,86,253,198,2,58,0,2,255,250,254,20,4,113,
+4,94,0,25,0,38,0,0,36,2,35,34,38,39,22,22,21,21,33,21,33,21,35,53,35,53,51,
+17,16,18,51,50,0,17,38,38,35,34,6,21,17,22,22,51,50,54,53,4,113,228,225,91,
+158,66,2,2,1,94,254,162,193,186,186,230,229,229,1,13,199,155,148,135,127,
+63,152,96,126,128,253,254,239,44,50,28,91,55,64,96,232,232,96,2,252,1,4,1,
+2,254,198,254,236,238,244,191,219,254,119,54,67,221,221,255,255,0,92,255,
+236,4,115,5,203,18,2,3,132,0,0,255,255,0,117,255,236,4,164,5,203,18,34,0,
+38,0,0,16,3,0,121,1,229,0,0,255,255,0,92,255,236,4,115,5,203,18,34,3,132,
+0,0,16,3,0,121,1,0,0,0,0,1,254,137,6,20,1,117,7,6,0,16,0,0,1,21,35,34,36,
+35,34,6,7,7,35,54,54,51,50,4,51,1,117,41,137,254,217,72,40,60,7,4,92,10,114,
+110,81,1,42,120,6,150,130,113,41,45,27,121,121,112,255,255,0,115,254,41,5,
+123,5,205,18,2,0,52,0,0,255,255,0,113,254,20,4,197,4,94,18,2,0,84,0,0,255,
+255,0,18,0,0,8,78,5,182,18,2,0,58,0,0,255,255,0,2,0,0,6,227,4,74,18,2,0,90,
+0,0,0,2,0,2,0,0,4,109,4,74,0,32,0,42,0,0,37,6,6,21,20,51,51,21,33,53,51,50,
+54,55,1,51,1,22,22,51,51,21,33,53,51,50,54,53,52,38,39,39,33,1,38,38,39,35,
+6,6,7,3,33,1,37,11,14,90,54,254,102,45,40,40,23,1,92,147,1,98,16,41,42,35,
+254,51,53,39,39,7,5,62,254,121,1,8,20,27,12,8,10,29,17,104,1,63,244,29,48,
+20,63,84,84,50,63,3,133,252,84,44,30,84,84,29,32,10,30,14,161,1,89,54,96,
+48,40,94,42,254,244,0,2,255,250,0,0,5,166,4,74,0,44,0,51,0,0,37,33,50,54,
+55,55,51,3,33,53,51,50,54,53,53,33,7,6,6,21,20,51,51,21,33,53,51,50,54,55,
+1,39,53,33,19,35,39,38,38,35,33,17,33,21,33,3,35,6,6,7,3,33,3,135,1,39,58,
+70,7,10,103,14,252,157,35,69,48,254,174,72,20,13,80,49,254,103,41,34,58,31,
+1,188,115,3,127,9,101,8,8,55,60,255,0,1,119,254,137,186,8,14,34,22,203,1,
+25,96,60,55,74,254,227,84,46,46,184,129,37,48,13,49,84,84,56,57,3,39,10,84,
+254,227,72,60,54,254,136,97,1,213,30,81,42,254,129,0,3,0,102,255,236,6,84,
+4,94,0,48,0,55,0,66,0,0,0,22,23,54,54,51,50,22,21,20,6,7,7,21,20,22,51,50,
+54,53,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,53,33,38,38,35,34,6,7,38,
+38,53,52,54,51,18,54,55,33,20,22,51,0,38,35,34,6,21,21,55,54,54,53,2,139,
+210,57,43,204,138,148,169,232,235,170,94,97,97,89,87,87,198,171,115,159,45,
+57,158,103,203,223,2,170,4,149,164,86,154,41,14,25,196,159,145,122,11,254,
+41,111,112,3,121,81,85,124,148,131,164,143,4,94,119,114,104,129,172,155,164,
+157,7,6,123,152,100,98,125,58,71,95,101,58,66,61,63,252,237,94,221,205,82,
+61,6,37,26,74,129,251,252,185,178,180,183,3,38,95,156,128,166,6,8,116,130,
+0,3,0,70,0,0,4,4,4,74,0,31,0,40,0,49,0,0,0,6,7,51,21,35,22,22,21,20,6,35,
+33,53,51,50,54,53,17,35,53,51,17,52,38,35,35,53,33,50,22,21,1,51,50,54,53,
+52,38,35,35,53,51,50,54,53,52,38,35,35,3,158,55,44,201,170,53,62,206,212,
+254,33,35,68,44,153,153,49,63,35,1,176,213,205,253,254,137,123,104,105,120,
+139,94,118,105,99,126,92,2,238,96,31,97,35,111,79,151,150,84,50,48,1,88,97,
+1,43,47,45,84,135,146,253,47,95,114,127,94,97,84,110,101,81,0,1,0,117,255,
+242,3,195,4,88,0,29,0,0,0,22,21,20,6,35,52,38,35,34,6,21,20,22,51,50,54,55,
+22,22,21,20,6,35,34,0,17,16,0,51,3,22,173,91,73,90,80,156,151,156,151,86,
+136,58,22,25,189,159,234,254,255,1,15,245,4,88,97,83,50,65,90,105,219,244,
+218,227,63,71,14,36,22,73,107,1,47,1,4,1,4,1,47,0,2,0,76,0,0,4,70,4,74,0,
+18,0,27,0,0,0,0,35,33,53,51,50,54,53,17,52,38,35,35,53,33,50,0,17,1,50,54,
+53,52,38,35,35,17,4,70,254,239,252,254,19,35,68,46,51,63,35,1,237,251,1,18,
+253,209,177,177,174,178,125,1,31,254,225,84,49,49,2,228,46,46,84,254,225,
+254,250,254,61,234,217,219,231,252,123,0,2,0,70,0,0,4,70,4,74,0,22,0,35,0,
+0,19,51,17,52,38,35,35,53,33,50,0,17,16,0,35,33,53,51,50,54,53,17,35,1,50,
+54,53,52,38,35,35,17,33,21,33,17,70,155,51,63,35,1,237,251,1,18,254,239,252,
+254,19,35,68,46,155,1,209,177,177,174,178,125,1,12,254,244,2,111,1,43,46,
+46,84,254,225,254,250,254,250,254,225,84,49,49,1,88,254,84,234,217,219,231,
+254,136,97,254,84,0,1,0,76,0,0,3,186,4,74,0,31,0,0,37,33,50,54,55,55,51,3,
+33,53,51,50,54,53,17,52,38,35,35,53,33,19,35,39,38,38,35,33,17,33,21,33,1,
+156,1,41,55,68,14,6,102,10,252,156,35,66,46,47,65,35,3,49,8,100,8,7,62,56,
+255,0,1,123,254,133,96,66,84,39,254,227,84,44,48,2,227,49,50,84,254,227,72,
+54,60,254,136,97,0,1,0,92,255,240,3,135,4,94,0,44,0,0,36,54,53,52,38,35,35,
+53,51,50,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,22,22,21,
+20,6,35,34,38,53,52,54,51,20,22,51,2,77,109,127,127,143,143,103,129,94,99,
+98,100,79,87,194,170,185,202,116,119,133,135,237,199,178,197,89,75,108,101,
+90,116,116,90,108,101,124,99,92,84,96,127,54,54,96,117,139,125,97,139,36,
+24,132,107,160,175,113,85,56,65,92,121,0,2,0,76,254,137,2,47,4,74,0,23,0,
+35,0,0,51,53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,51,
+21,4,54,51,50,22,21,20,6,35,34,38,53,76,33,68,46,49,65,33,1,227,35,65,49,
+46,68,35,254,148,60,56,58,59,59,58,57,59,84,49,49,2,221,50,49,84,84,51,48,
+253,35,48,50,84,184,63,65,62,60,67,65,62,0,1,255,225,254,150,2,18,4,74,0,
+21,0,0,3,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,6,35,35,31,
+31,106,89,53,62,35,1,229,32,68,49,182,189,41,254,244,128,138,3,156,47,45,
+84,84,51,48,252,107,178,182,0,1,0,76,0,0,4,135,4,74,0,49,0,0,37,20,22,51,
+51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,1,54,54,53,
+52,38,35,53,33,21,34,6,7,7,1,22,22,51,21,35,34,38,39,1,7,1,154,46,68,33,254,
+31,33,66,48,51,63,33,1,225,33,65,49,1,41,40,31,28,39,1,123,44,92,80,221,1,
+70,43,86,51,33,157,119,66,254,252,114,182,48,50,84,84,45,47,2,234,46,46,84,
+84,51,48,254,121,1,72,43,67,19,14,19,84,84,55,82,240,254,78,57,62,84,49,90,
+1,111,96,0,1,0,76,0,0,3,176,4,74,0,33,0,0,19,55,17,52,38,35,35,53,33,21,35,
+34,6,21,17,55,21,7,17,33,50,54,55,55,51,17,33,53,51,50,54,53,53,7,76,147,
+47,65,35,1,227,35,60,52,245,245,1,37,50,64,8,15,102,252,156,35,68,44,147,
+1,190,80,1,133,49,50,84,84,45,47,254,223,135,111,135,254,86,67,62,121,254,
+166,84,50,48,234,80,0,1,0,76,0,0,5,172,4,74,0,43,0,0,33,53,50,54,53,17,35,
+1,35,1,35,17,20,22,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,1,51,1,33,
+21,35,34,6,21,17,20,22,51,51,21,3,238,69,49,8,254,189,109,254,178,8,46,79,
+254,121,35,65,47,50,62,35,1,121,1,57,8,1,45,1,121,35,65,47,44,68,35,84,43,
+43,2,197,252,145,3,104,253,78,48,50,84,84,45,47,2,234,46,46,84,252,198,3,
+58,84,50,49,253,35,48,50,84,0,1,0,53,0,0,4,147,4,74,0,36,0,0,51,17,52,38,
+35,35,53,33,21,35,34,6,21,17,51,1,33,21,35,34,6,21,17,20,22,51,51,21,33,53,
+51,50,54,53,17,35,1,203,48,67,35,1,162,37,62,50,8,2,28,1,45,32,64,51,45,70,
+32,254,91,45,66,44,8,253,203,3,147,50,49,84,84,46,46,253,149,3,27,84,46,46,
+253,28,49,49,84,84,49,49,2,133,252,197,0,2,0,115,255,242,4,104,4,90,0,11,
+0,23,0,0,0,0,35,34,0,17,16,0,51,50,0,17,4,22,51,50,54,53,52,38,35,34,6,21,
+4,104,254,243,236,245,254,249,1,6,248,237,1,10,252,215,151,153,153,148,148,
+151,154,152,1,33,254,209,1,43,1,10,1,10,1,41,254,210,254,249,237,226,221,
+242,244,221,225,240,0,1,0,82,255,236,3,150,4,94,0,29,0,0,36,54,53,52,38,35,
+34,6,21,34,38,53,52,54,51,50,18,17,16,2,35,34,38,53,52,54,51,20,22,51,2,60,
+147,120,138,89,85,91,92,206,151,230,227,243,224,182,187,85,93,90,82,82,233,
+230,242,229,117,119,58,71,93,116,254,224,254,225,254,235,254,226,128,109,
+69,64,126,142,0,2,0,51,0,70,4,166,4,2,0,11,0,23,0,0,36,36,53,52,36,33,32,
+4,21,20,4,33,2,6,21,20,22,51,50,54,53,52,38,35,1,78,254,229,1,38,1,22,1,31,
+1,24,254,220,254,237,243,222,223,242,241,217,215,243,70,245,236,231,244,243,
+238,230,245,2,245,133,147,146,133,134,147,146,132,0,1,0,51,0,141,4,166,3,
+188,0,29,0,0,18,36,33,32,4,21,20,6,35,34,38,53,50,54,53,52,38,35,34,6,21,
+20,22,23,6,6,35,34,38,53,51,1,31,1,20,1,35,1,29,115,94,71,58,119,116,229,
+242,219,213,80,64,13,39,28,79,118,2,203,241,229,227,146,211,92,91,86,88,138,
+120,146,163,94,143,36,15,20,190,158,0,3,255,246,0,70,4,227,4,2,0,23,0,32,
+0,40,0,0,37,6,6,35,32,36,53,52,54,55,39,53,23,54,54,51,32,4,21,20,6,7,23,
+21,0,6,7,1,54,53,52,38,35,18,55,1,6,21,20,22,51,4,39,69,220,151,254,223,254,
+229,29,29,119,180,71,224,158,1,31,1,24,33,31,125,253,46,150,57,2,174,73,215,
+243,175,109,253,84,65,223,242,209,68,71,245,236,71,124,51,73,121,110,71,74,
+243,238,75,127,52,76,119,2,219,19,22,254,88,69,118,146,132,253,209,37,1,166,
+65,115,146,133,0,3,0,102,255,236,6,205,4,94,0,33,0,40,0,53,0,0,0,22,23,54,
+33,50,18,17,16,2,35,34,38,39,6,6,35,34,38,53,53,33,38,38,35,34,6,7,38,38,
+53,52,54,51,18,54,55,33,20,22,51,0,38,35,34,6,7,21,22,22,51,50,54,53,2,126,
+183,60,119,1,10,230,245,243,238,124,187,62,59,179,121,203,223,2,170,4,149,
+152,93,156,44,14,25,200,161,139,122,11,254,41,111,112,3,242,137,143,143,134,
+2,2,134,145,145,133,4,94,104,101,205,254,220,254,233,254,225,254,232,98,100,
+100,98,252,237,94,218,208,78,65,6,37,26,75,128,251,252,185,178,180,183,2,
+190,220,213,242,29,227,213,218,241,0,2,0,115,255,242,3,221,4,88,0,35,0,47,
+0,0,1,50,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,51,
+6,6,21,20,22,51,50,54,53,52,38,0,22,51,50,54,53,52,38,35,34,6,21,2,193,112,
+119,108,101,117,145,228,210,205,231,132,118,82,113,124,107,20,19,102,87,87,
+105,21,254,105,123,113,112,130,118,122,120,118,4,88,117,104,75,119,38,34,
+176,103,166,194,187,173,113,160,40,23,139,70,108,113,45,106,41,104,114,118,
+98,63,100,252,164,139,139,125,130,128,126,132,0,1,0,115,2,29,4,104,4,90,0,
+13,0,0,1,52,38,35,34,6,21,35,16,0,51,50,0,17,3,156,147,152,154,152,204,1,
+8,246,234,1,13,2,29,244,229,233,240,1,11,1,50,254,204,254,247,0,1,0,115,255,
+236,4,104,2,41,0,13,0,0,1,20,22,51,50,54,53,51,16,0,35,34,0,17,1,63,147,152,
+154,152,204,254,246,244,234,254,243,2,41,244,229,233,240,254,241,254,210,
+1,52,1,9,0,2,0,76,0,0,3,160,4,74,0,25,0,34,0,0,51,53,51,50,54,53,17,52,38,
+35,35,53,33,50,22,21,20,6,35,35,21,20,22,51,51,21,3,51,50,54,53,52,38,35,
+35,76,35,68,44,49,63,35,1,196,206,194,221,211,84,49,63,68,180,69,136,114,
+105,124,90,84,50,48,2,228,47,45,84,172,154,163,191,242,48,44,84,2,0,121,133,
+121,117,0,2,255,236,0,0,3,217,4,74,0,35,0,44,0,0,1,38,38,53,52,54,51,33,21,
+35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,35,3,6,6,35,35,53,50,54,
+55,1,35,34,6,21,20,22,51,51,1,104,112,115,204,212,1,180,35,63,49,46,66,35,
+254,29,33,64,50,106,209,59,109,150,36,54,86,34,1,239,92,123,104,107,116,96,
+2,4,33,142,106,149,152,84,45,47,253,22,48,44,84,84,43,49,1,43,254,176,93,
+46,84,66,53,3,33,93,118,127,101,0,2,255,236,0,0,3,217,4,74,0,36,0,45,0,0,
+19,38,38,35,53,51,50,22,22,23,19,51,17,52,38,35,35,53,33,21,35,34,6,21,17,
+20,22,51,51,21,33,34,38,53,52,54,55,5,35,34,6,21,20,22,51,51,154,34,86,54,
+36,112,100,62,44,209,106,50,64,33,1,227,35,66,46,49,63,35,254,76,212,204,
+115,112,1,33,96,116,107,104,123,92,3,127,53,66,84,22,49,69,254,177,1,43,49,
+43,84,84,44,48,253,22,47,45,84,151,150,106,142,33,50,101,126,118,93,0,1,0,
+37,0,0,3,193,4,74,0,27,0,0,37,20,22,51,51,21,33,53,51,50,54,53,17,35,34,6,
+7,7,35,19,33,19,35,39,38,38,35,35,2,80,46,67,53,253,252,49,65,47,145,47,58,
+8,8,100,6,3,141,9,101,8,5,57,51,147,182,48,50,84,84,45,47,3,55,50,62,84,1,
+39,254,217,84,58,54,0,1,0,27,255,242,4,104,4,74,0,37,0,0,4,38,53,17,52,38,
+35,35,53,33,21,35,34,6,21,17,20,22,51,50,54,53,17,52,38,35,35,53,33,21,35,
+34,6,21,17,20,6,35,1,116,198,51,62,34,1,227,35,66,47,128,122,120,132,49,63,
+37,1,157,34,66,47,208,187,14,176,174,2,74,47,45,84,84,50,49,253,181,114,118,
+122,104,2,88,47,45,84,84,51,48,253,172,160,173,0,1,0,72,255,211,4,166,4,137,
+0,40,0,0,19,35,17,51,21,20,22,51,33,50,54,53,53,51,17,7,21,22,22,21,20,6,
+35,33,34,6,21,21,35,17,33,50,54,53,52,38,35,33,34,6,21,158,86,86,74,73,2,
+127,69,70,86,165,99,87,204,198,254,29,77,70,86,2,194,146,135,174,158,254,
+80,69,68,2,98,2,39,16,97,71,69,95,10,254,180,26,11,56,143,120,170,174,63,
+91,10,1,100,112,114,121,126,68,95,0,3,0,51,255,205,5,250,4,131,0,40,0,52,
+0,64,0,0,1,35,17,51,21,20,22,51,33,50,54,53,53,51,17,7,21,22,22,21,20,6,7,
+33,34,6,21,21,35,17,33,50,54,53,52,38,35,33,34,6,21,36,22,21,20,6,35,34,38,
+53,52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,242,86,86,74,73,2,127,68,
+71,86,166,99,88,202,200,254,29,77,70,86,2,194,145,136,173,159,254,80,69,68,
+254,237,58,52,63,57,58,53,62,57,58,52,63,57,58,53,62,2,92,2,39,16,97,71,67,
+97,10,254,180,27,10,54,143,120,170,174,2,63,91,10,1,100,110,115,121,127,68,
+96,201,53,51,45,60,55,50,45,59,254,123,53,51,45,60,55,50,45,59,0,1,0,51,254,
+160,4,145,5,188,0,61,0,0,19,35,17,51,21,20,22,51,33,50,54,53,53,51,17,7,21,
+22,22,21,20,6,7,21,22,22,21,20,6,35,33,34,6,21,21,35,17,33,50,54,53,52,38,
+35,33,34,6,21,21,35,17,33,50,54,53,52,38,35,33,34,6,21,137,86,86,72,76,2,
+127,72,67,86,166,95,91,95,91,95,91,204,197,254,29,75,73,86,2,195,144,136,
+158,147,254,64,77,71,86,2,195,144,136,171,160,254,79,69,68,3,150,2,38,26,
+94,64,67,91,6,254,190,26,10,51,140,119,112,151,34,16,51,148,121,169,166,65,
+93,6,1,100,104,111,111,116,65,92,6,1,100,104,111,115,123,71,97,0,1,255,250,
+0,0,4,55,4,74,0,38,0,0,33,1,38,38,35,35,53,33,21,35,34,6,21,20,22,23,19,22,
+22,23,51,54,54,55,19,54,54,53,52,35,35,53,33,21,35,34,6,7,1,1,209,254,170,
+17,39,38,35,1,203,52,37,40,10,8,164,14,28,11,8,11,27,16,159,10,15,88,51,1,
+157,47,38,44,22,254,188,3,172,44,30,84,84,31,31,11,43,21,254,34,40,94,44,
+42,89,43,1,201,26,57,15,64,84,84,48,63,252,121,0,1,0,12,0,0,6,113,4,74,0,
+54,0,0,1,19,22,22,23,51,54,54,55,19,54,54,53,52,35,35,53,33,21,35,34,6,7,
+1,35,3,35,6,6,7,3,35,1,38,38,35,35,53,33,21,35,34,21,20,22,23,19,22,22,23,
+51,54,54,55,19,3,156,198,14,24,9,9,9,23,13,131,12,12,92,47,1,154,45,32,57,
+16,254,242,162,240,8,15,27,13,164,170,254,225,12,44,42,33,1,203,49,80,5,5,
+148,14,17,14,8,9,22,14,188,4,59,253,109,45,95,40,37,83,42,1,180,42,48,18,
+64,84,84,55,54,252,119,3,25,65,109,48,253,197,3,172,42,32,84,84,62,12,23,
+14,254,23,47,65,58,45,95,48,2,139,0,1,0,72,0,0,3,139,4,74,0,19,0,0,1,1,33,
+50,54,55,55,51,3,33,53,1,33,34,6,7,7,35,19,33,3,113,253,186,1,125,50,57,8,
+10,102,8,252,197,2,67,254,187,48,58,13,6,99,9,3,2,4,2,252,94,51,64,74,254,
+227,70,3,161,55,92,39,1,29,0,1,0,92,255,240,3,131,4,74,0,33,0,0,1,1,33,34,
+6,7,7,35,55,33,21,1,22,22,21,20,6,35,34,38,53,52,54,51,20,22,51,50,54,53,
+52,38,35,35,1,51,1,76,254,250,79,41,3,2,100,8,2,172,254,139,218,210,237,199,
+177,194,87,69,113,100,121,112,138,126,123,2,98,1,88,35,49,22,250,76,254,131,
+12,170,140,160,175,112,86,60,61,93,126,121,117,103,107,0,1,0,104,255,242,
+3,72,4,88,0,40,0,0,36,54,55,22,22,21,20,6,35,34,38,53,52,54,36,54,53,52,38,
+35,34,6,21,34,38,53,52,54,51,50,22,21,20,14,3,21,20,22,51,2,69,154,53,22,
+30,194,163,188,191,143,1,34,98,83,81,81,89,71,80,175,146,163,177,68,133,227,
+98,107,97,100,72,66,14,35,23,72,108,154,159,107,155,113,94,86,73,89,106,93,
+55,54,77,109,151,130,79,128,103,90,91,82,85,73,0,1,0,51,255,242,4,2,4,94,
+0,41,0,0,1,38,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,54,55,50,22,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,22,22,51,50,54,1,197,122,106,180,144,
+141,162,106,121,50,91,61,48,48,9,37,57,88,74,93,125,107,108,125,93,74,88,
+57,37,10,47,48,60,90,1,47,151,227,91,149,197,191,155,89,229,151,67,74,61,
+45,76,55,70,81,98,147,148,97,81,70,55,76,45,61,72,0,1,0,76,0,0,3,123,4,74,
+0,25,0,0,33,33,53,51,50,54,53,17,52,38,35,35,53,33,19,35,39,38,38,35,35,17,
+20,22,51,51,2,80,253,252,35,68,44,47,65,35,3,39,8,100,7,8,70,63,231,48,64,
+68,84,50,48,2,221,49,50,84,254,227,61,73,52,252,203,47,47,0,1,255,248,0,0,
+4,53,4,74,0,38,0,0,1,1,22,22,51,51,21,33,53,51,50,54,53,52,38,39,3,38,38,
+39,35,6,6,7,3,6,6,21,20,51,51,21,33,53,51,50,54,55,1,2,94,1,86,15,40,39,35,
+254,53,52,37,41,10,9,164,14,28,11,8,11,26,16,160,14,11,88,52,254,98,47,39,
+44,21,1,68,4,74,252,84,42,32,84,84,30,31,7,44,25,1,221,41,90,43,36,88,46,
+254,56,41,42,16,63,84,84,50,61,3,135,0,1,0,76,0,0,4,152,4,74,0,37,0,0,19,
+33,21,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,33,17,20,22,51,51,
+21,33,53,51,50,54,53,17,52,38,35,35,76,4,76,33,66,49,50,65,33,254,30,33,70,
+45,254,80,46,68,35,254,29,33,68,46,51,63,33,4,74,84,51,48,253,29,49,43,84,
+84,49,49,3,49,252,207,48,50,84,84,49,49,2,228,46,46,255,255,0,76,0,0,3,160,
+4,74,18,2,5,158,0,0,0,1,0,18,0,0,5,27,4,74,0,55,0,0,1,51,50,54,53,17,33,21,
+34,6,21,21,20,6,35,35,21,20,22,51,51,21,33,53,51,50,54,53,53,35,34,38,53,
+53,52,38,35,53,33,17,20,22,51,51,17,52,38,35,35,53,33,21,35,34,6,21,2,240,
+20,122,99,1,58,74,55,196,194,36,46,68,35,254,35,35,68,44,34,194,196,55,74,
+1,58,98,121,20,47,65,35,1,221,35,65,49,1,213,109,153,1,111,84,50,49,186,185,
+167,195,49,49,84,84,50,48,195,167,185,186,49,50,84,254,145,156,106,1,190,
+49,50,84,84,49,50,0,1,255,250,255,246,4,37,4,74,0,41,0,0,22,38,53,52,54,51,
+20,22,51,50,54,18,53,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,51,21,33,
+53,51,50,54,53,17,35,2,2,6,35,62,68,52,46,35,27,57,104,62,44,65,39,3,64,37,
+66,47,44,69,37,254,26,37,67,46,223,18,95,138,118,10,60,54,44,61,25,47,228,
+1,221,121,28,23,84,84,51,48,253,35,48,50,84,84,50,48,3,49,254,236,253,237,
+202,0,2,0,2,2,125,4,109,6,199,0,32,0,42,0,0,1,6,6,21,20,51,51,21,33,53,51,
+50,54,55,1,51,1,22,22,51,51,21,33,53,51,50,54,53,52,38,39,39,33,1,38,38,39,
+35,6,6,7,3,33,1,37,11,14,90,54,254,102,45,40,40,23,1,92,147,1,98,16,41,42,
+35,254,51,53,39,39,7,5,62,254,121,1,8,20,27,12,8,10,29,17,104,1,63,3,113,
+29,48,20,63,84,84,50,63,3,133,252,84,44,30,84,84,29,32,10,30,14,161,1,88,
+54,97,48,40,94,42,254,244,0,2,255,250,2,125,5,166,6,199,0,44,0,51,0,0,1,33,
+50,54,55,55,51,3,33,53,51,50,54,53,53,33,7,6,6,21,20,51,51,21,33,53,51,50,
+54,55,1,39,53,33,19,35,39,38,38,35,33,17,33,21,33,3,35,6,6,7,3,33,3,135,1,
+39,61,67,7,10,103,14,252,157,35,69,48,254,174,72,20,13,80,49,254,103,41,34,
+58,31,1,188,115,3,127,9,101,8,8,55,60,255,0,1,119,254,137,186,8,14,34,22,
+203,1,25,2,221,62,53,74,254,227,84,46,46,184,129,37,49,12,49,84,84,56,57,
+3,38,11,84,254,227,72,60,54,254,136,97,1,213,30,81,42,254,129,0,3,0,76,2,
+125,3,205,6,199,0,27,0,36,0,45,0,0,0,6,7,35,21,51,22,22,21,20,6,35,33,53,
+51,50,54,53,17,52,38,35,35,53,33,50,22,21,1,51,50,54,53,52,38,35,35,53,51,
+50,54,53,52,38,35,35,3,158,95,79,2,2,111,110,206,212,254,33,35,68,44,49,63,
+35,1,176,213,205,253,254,137,123,104,105,120,139,94,118,105,99,126,92,5,88,
+120,29,9,30,140,102,151,150,84,50,48,2,228,47,45,84,135,146,253,47,95,114,
+127,94,97,84,110,101,81,0,3,0,70,2,125,4,4,6,199,0,31,0,40,0,49,0,0,0,6,7,
+51,21,35,22,22,21,20,6,35,33,53,51,50,54,53,17,35,53,51,17,52,38,35,35,53,
+33,50,22,21,1,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,35,3,158,55,
+44,201,170,53,62,206,212,254,33,35,68,44,153,153,49,63,35,1,176,213,205,253,
+254,137,123,104,105,120,139,94,118,105,99,126,92,5,106,96,30,97,35,112,78,
+151,150,84,50,48,1,88,97,1,43,47,45,84,135,146,253,47,95,114,127,94,97,84,
+110,101,81,0,2,0,76,2,125,4,70,6,199,0,18,0,27,0,0,0,0,35,33,53,51,50,54,
+53,17,52,38,35,35,53,33,50,0,17,1,50,54,53,52,38,35,35,17,4,70,254,239,252,
+254,19,35,68,46,51,63,35,1,237,251,1,18,253,209,177,177,174,178,125,3,156,
+254,225,84,49,49,2,228,46,46,84,254,225,254,250,254,61,234,217,219,231,252,
+123,0,1,0,76,2,125,3,186,6,199,0,31,0,0,1,33,50,54,55,55,51,3,33,53,51,50,
+54,53,17,52,38,35,35,53,33,19,35,39,38,38,35,33,17,33,21,33,1,156,1,41,55,
+68,14,6,102,10,252,156,35,66,46,47,65,35,3,49,8,100,8,7,62,56,255,0,1,123,
+254,133,2,221,66,84,39,254,227,84,44,48,2,227,49,50,84,254,227,72,54,60,254,
+136,97,0,1,0,84,2,125,3,195,6,199,0,31,0,0,1,33,53,33,17,33,34,6,7,7,35,19,
+33,21,35,34,6,21,17,20,22,51,51,21,33,3,51,23,22,22,51,33,2,115,254,133,1,
+123,255,0,54,64,7,8,101,8,3,50,35,66,47,48,65,35,252,155,10,102,7,10,67,60,
+1,41,4,139,97,1,120,57,57,72,1,29,84,51,48,253,29,49,43,84,1,29,39,74,76,
+0,1,0,117,2,111,4,119,6,213,0,37,0,0,0,0,17,16,0,33,50,22,21,20,6,35,52,38,
+35,34,6,21,20,22,51,50,54,55,53,52,38,35,53,33,21,34,6,21,17,6,6,35,1,147,
+254,226,1,40,1,11,171,185,96,76,101,91,176,174,179,193,37,82,29,56,77,1,178,
+64,51,81,174,103,2,111,1,40,1,11,1,6,1,45,98,82,53,62,87,108,220,243,237,
+222,10,8,234,48,44,86,86,48,50,254,235,38,35,0,1,0,76,2,125,4,201,6,199,0,
+51,0,0,1,53,51,50,54,53,17,33,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,
+35,35,53,33,21,35,34,6,21,17,33,17,52,38,35,35,53,33,21,35,34,6,21,17,20,
+22,51,51,21,2,227,35,69,44,254,37,44,68,35,254,29,35,68,44,50,62,35,1,227,
+35,65,47,1,219,47,66,35,1,230,37,64,49,50,63,37,2,125,84,50,48,1,86,254,170,
+48,50,84,84,50,48,2,228,46,46,84,84,50,49,254,220,1,36,48,51,84,84,51,48,
+253,29,49,43,84,0,1,0,76,2,125,2,47,6,199,0,23,0,0,19,53,51,50,54,53,17,52,
+38,35,35,53,33,21,35,34,6,21,17,20,22,51,51,21,76,33,68,46,49,65,33,1,227,
+35,65,49,46,68,35,2,125,84,49,49,2,221,50,49,84,84,51,48,253,35,48,50,84,
+0,1,255,225,1,18,2,18,6,199,0,21,0,0,3,51,50,54,53,17,52,38,35,35,53,33,21,
+35,34,6,21,17,20,6,35,35,31,31,106,89,53,62,35,1,229,32,68,49,181,190,41,
+1,113,128,138,3,156,47,45,84,84,51,48,252,107,178,183,0,1,0,76,2,125,4,135,
+6,199,0,49,0,0,1,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,21,
+35,34,6,21,17,1,54,54,53,52,38,35,53,33,21,34,6,7,7,1,22,22,51,21,35,34,38,
+39,1,7,1,154,46,68,33,254,31,33,66,48,51,63,33,1,225,33,65,49,1,41,40,31,
+28,39,1,123,41,90,85,221,1,70,43,86,51,33,157,119,66,254,252,114,3,51,48,
+50,84,84,45,47,2,234,46,46,84,84,51,48,254,121,1,72,43,67,19,14,19,84,84,
+49,89,239,254,78,57,62,84,49,90,1,111,96,0,1,0,76,2,125,3,186,6,199,0,25,
+0,0,19,53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,33,50,54,55,55,
+51,3,76,35,68,44,47,65,35,1,227,35,60,52,1,47,52,64,7,14,102,10,2,125,84,
+50,48,2,221,49,50,84,84,45,47,252,198,71,58,121,254,166,0,1,0,76,2,125,5,
+172,6,199,0,43,0,0,1,53,50,54,53,17,35,1,35,1,35,17,20,22,51,21,33,53,51,
+50,54,53,17,52,38,35,35,53,33,1,51,1,33,21,35,34,6,21,17,20,22,51,51,21,3,
+238,69,49,8,254,189,109,254,178,8,46,79,254,121,35,65,47,50,62,35,1,121,1,
+57,8,1,45,1,121,35,65,47,44,68,35,2,125,84,43,43,2,197,252,145,3,104,253,
+78,48,50,84,84,45,47,2,234,46,46,84,252,198,3,58,84,50,49,253,35,48,50,84,
+0,1,0,76,2,125,4,170,6,199,0,36,0,0,1,1,35,17,20,22,51,51,21,33,53,51,50,
+54,53,17,52,38,35,35,53,33,1,51,17,52,38,35,35,53,33,21,35,34,6,21,17,3,147,
+253,203,8,45,66,45,254,90,33,68,46,51,63,33,1,45,2,29,8,51,62,37,1,162,35,
+66,49,2,125,3,59,253,123,49,49,84,84,49,49,2,228,46,46,84,252,229,2,107,47,
+45,84,84,51,48,252,109,0,1,0,53,2,125,4,147,6,199,0,36,0,0,19,17,52,38,35,
+35,53,33,21,35,34,6,21,17,51,1,33,21,35,34,6,21,17,20,22,51,51,21,33,53,51,
+50,54,53,17,35,1,203,48,67,35,1,162,37,62,50,8,2,28,1,45,32,64,51,45,70,32,
+254,91,45,66,44,8,253,203,2,125,3,147,50,49,84,84,46,46,253,149,3,27,84,46,
+46,253,28,49,49,84,84,49,49,2,133,252,197,0,2,0,115,2,111,4,104,6,215,0,11,
+0,23,0,0,0,0,35,34,0,17,16,0,51,50,0,17,4,22,51,50,54,53,52,38,35,34,6,21,
+4,104,254,243,236,245,254,249,1,6,248,237,1,10,252,215,151,153,153,148,148,
+151,154,152,3,158,254,209,1,43,1,10,1,10,1,41,254,210,254,249,237,226,221,
+242,244,221,225,240,0,2,0,115,2,111,3,221,6,213,0,35,0,47,0,0,1,50,22,21,
+20,6,7,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,54,51,6,6,21,20,22,
+51,50,54,53,52,38,0,22,51,50,54,53,52,38,35,34,6,21,2,193,112,119,108,101,
+114,148,228,210,205,231,132,118,82,113,124,107,20,19,99,90,89,103,21,254,
+105,123,113,112,130,118,122,120,118,6,213,117,104,75,119,38,33,175,105,166,
+194,187,173,113,160,40,23,139,70,108,113,45,106,42,102,115,118,97,63,101,
+252,164,139,139,125,130,128,126,132,0,2,0,76,2,125,3,160,6,199,0,25,0,34,
+0,0,19,53,51,50,54,53,17,52,38,35,35,53,33,50,22,21,20,6,35,35,21,20,22,51,
+51,21,3,51,50,54,53,52,38,35,35,76,35,68,44,49,63,35,1,196,206,194,221,211,
+84,49,63,68,180,69,136,114,105,124,90,2,125,84,50,48,2,228,47,45,84,172,154,
+163,191,242,48,44,84,2,0,121,133,121,116,0,2,0,76,2,125,4,57,6,199,0,35,0,
+44,0,0,1,22,22,51,21,35,34,38,39,3,35,17,20,22,51,51,21,33,53,51,50,54,53,
+17,52,38,35,35,53,33,50,22,21,20,6,7,37,51,50,54,53,52,38,35,35,3,139,34,
+86,54,37,148,110,59,209,106,50,64,33,254,29,35,66,46,49,63,35,1,180,212,204,
+114,114,254,224,96,115,108,104,123,92,3,72,53,66,84,46,93,1,80,254,213,49,
+43,84,84,44,48,2,234,47,45,84,152,149,106,142,33,49,100,128,117,93,0,1,0,
+37,2,125,3,193,6,199,0,27,0,0,1,20,22,51,51,21,33,53,51,50,54,53,17,35,34,
+6,7,7,35,19,33,19,35,39,38,38,35,35,2,80,46,67,53,253,252,49,65,47,145,47,
+58,8,8,100,6,3,141,9,101,8,5,57,51,147,3,51,48,50,84,84,45,47,3,55,50,62,
+84,1,39,254,217,84,58,54,0,1,0,27,2,111,4,104,6,199,0,37,0,0,0,38,53,17,52,
+38,35,35,53,33,21,35,34,6,21,17,20,22,51,50,54,53,17,52,38,35,35,53,33,21,
+35,34,6,21,17,20,6,35,1,116,198,51,62,34,1,227,35,66,47,128,122,121,131,49,
+63,37,1,157,34,66,47,208,187,2,111,176,174,2,74,47,45,84,84,50,49,253,181,
+114,118,123,102,2,89,47,45,84,84,51,48,253,172,160,173,0,1,0,12,2,125,6,113,
+6,199,0,54,0,0,1,19,22,22,23,51,54,54,55,19,54,54,53,52,35,35,53,33,21,35,
+34,6,7,1,35,3,35,6,6,7,3,35,1,38,38,35,35,53,33,21,35,34,21,20,22,23,19,22,
+22,23,51,54,54,55,19,3,156,198,14,24,9,9,9,23,13,131,12,12,92,47,1,154,45,
+32,57,16,254,242,162,240,8,15,27,13,164,170,254,225,12,44,42,33,1,203,49,
+80,5,5,148,14,17,14,8,9,22,14,188,6,184,253,109,45,95,40,37,82,42,1,181,42,
+48,18,64,84,84,55,54,252,119,3,25,65,109,48,253,197,3,172,42,32,84,84,62,
+12,23,14,254,23,47,65,58,45,95,48,2,139,0,2,0,102,2,111,3,96,5,197,0,33,0,
+43,0,0,0,6,21,34,38,53,52,54,51,50,22,21,17,20,22,51,21,35,39,35,6,6,35,34,
+38,53,52,54,55,55,53,52,38,35,2,51,50,54,53,53,7,6,6,21,1,133,61,81,79,150,
+145,160,137,44,60,239,25,8,47,112,75,117,139,181,188,115,65,66,172,110,90,
+103,99,104,100,5,100,66,95,45,59,73,81,129,140,254,121,54,42,84,113,71,56,
+125,106,136,126,6,4,82,105,67,253,125,105,92,110,4,5,80,91,0,2,0,86,2,111,
+3,80,5,197,0,33,0,43,0,0,0,54,53,50,22,21,20,6,35,34,38,53,17,52,38,35,53,
+51,23,51,54,54,51,50,22,21,20,6,7,7,21,20,22,51,18,35,34,6,21,21,55,54,54,
+53,2,51,60,80,79,151,144,158,139,46,58,240,24,8,46,112,76,114,142,175,194,
+114,65,66,172,111,90,102,98,105,100,2,207,70,92,46,59,73,80,127,141,1,135,
+54,42,84,112,71,56,123,109,133,129,6,4,82,106,66,2,131,105,92,110,4,6,79,
+91,0,2,0,113,2,111,3,215,5,197,0,29,0,41,0,0,0,38,39,35,6,6,35,34,38,53,52,
+54,51,50,22,23,51,55,51,17,20,22,51,50,54,55,21,6,6,35,36,54,53,52,38,35,
+34,6,21,20,22,51,3,18,92,20,8,45,111,66,161,170,171,175,74,104,35,8,27,135,
+34,31,20,31,25,25,63,37,254,229,91,93,104,94,82,82,94,2,111,66,54,61,59,200,
+209,231,214,65,50,100,253,119,54,38,3,5,86,11,9,116,139,169,168,145,161,152,
+156,152,0,3,0,102,2,111,5,2,5,197,0,50,0,57,0,68,0,0,0,22,23,51,54,54,51,
+50,22,21,20,6,7,7,21,20,22,51,50,54,53,50,22,21,20,6,35,34,38,39,35,6,6,35,
+34,38,53,53,33,38,38,35,34,6,7,38,38,53,52,54,51,18,54,55,33,22,22,51,0,38,
+35,34,6,21,21,55,54,54,53,2,16,159,46,8,48,154,83,118,138,182,187,114,65,
+66,64,63,80,80,151,144,79,122,35,8,33,132,75,160,176,2,7,8,107,111,63,116,
+32,15,32,159,126,98,88,8,254,185,2,79,72,2,148,54,57,90,102,84,111,108,5,
+197,81,69,67,83,131,119,123,121,6,4,82,106,70,72,94,46,59,73,80,52,48,43,
+57,192,176,80,149,142,65,48,6,39,23,59,101,253,12,133,121,119,135,2,65,64,
+105,92,110,4,5,76,95,0,2,0,33,2,111,3,135,7,6,0,31,0,43,0,0,0,6,35,34,38,
+39,35,7,33,53,51,50,54,53,17,52,38,35,35,53,33,17,20,6,7,51,54,54,51,50,22,
+21,0,6,21,20,22,51,50,54,53,52,38,35,3,135,169,163,87,109,37,8,23,254,238,
+28,66,47,51,62,28,1,59,4,2,8,39,106,76,163,169,254,51,94,96,101,95,83,82,
+96,3,62,207,58,52,96,84,48,48,3,39,48,42,84,254,225,45,78,16,58,47,207,219,
+1,53,136,173,171,141,160,152,155,154,0,2,0,113,2,111,3,215,7,6,0,31,0,43,
+0,0,1,20,22,51,51,21,33,39,35,6,6,35,34,38,53,52,54,51,50,22,23,51,52,38,
+53,53,52,38,35,35,53,33,0,54,53,52,38,35,34,6,21,20,22,51,3,74,46,66,29,254,
+219,16,8,36,105,81,161,170,170,161,79,103,36,8,4,47,64,29,1,60,254,245,91,
+93,104,94,82,82,94,3,45,46,46,84,96,52,58,204,220,220,210,49,50,14,100,7,
+125,46,44,84,251,221,139,169,168,145,161,152,156,152,0,2,0,113,2,111,3,43,
+5,197,0,22,0,29,0,0,0,38,53,52,54,51,50,22,21,21,33,22,22,51,50,54,55,22,
+22,21,20,6,35,2,6,7,33,38,38,35,1,58,201,188,172,160,178,253,252,6,109,102,
+65,113,39,17,30,156,131,93,88,11,1,72,5,79,70,2,111,224,195,217,218,191,178,
+80,150,141,58,55,8,38,22,58,101,2,243,131,121,127,125,0,2,0,102,2,111,3,33,
+5,197,0,22,0,29,0,0,0,22,21,20,6,35,34,38,53,53,33,38,38,35,34,6,7,38,38,
+53,52,54,51,18,54,55,33,22,22,51,2,87,202,189,172,159,179,2,4,6,108,103,67,
+115,35,17,30,159,128,94,87,11,254,185,2,79,72,5,197,225,195,217,217,190,178,
+80,150,141,61,52,8,38,22,58,102,253,12,131,121,116,136,0,1,0,102,2,111,2,
+217,5,195,0,44,0,0,0,54,55,22,22,21,20,6,35,34,38,53,52,54,55,38,38,53,52,
+54,51,50,22,21,20,6,35,52,38,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,
+2,18,121,33,22,23,153,132,166,176,84,78,63,74,163,138,143,156,73,79,76,69,
+60,67,77,66,164,161,81,85,84,90,2,219,66,55,19,39,16,64,91,129,114,67,109,
+31,26,92,64,97,123,84,66,55,45,75,84,66,65,59,78,96,68,69,76,76,0,1,0,80,
+2,111,2,211,5,195,0,44,0,0,0,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,
+6,21,34,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,54,51,
+20,22,51,1,206,81,88,78,119,119,66,75,66,59,71,72,79,73,154,145,140,159,76,
+61,81,83,181,167,142,153,75,70,84,72,2,203,90,78,69,68,96,77,60,65,66,84,
+75,45,55,67,83,111,96,61,106,32,28,97,63,122,136,95,77,52,54,84,102,0,3,0,
+43,1,20,3,84,5,229,0,75,0,94,0,106,0,0,1,20,6,35,52,46,2,35,34,6,7,22,22,
+21,20,14,2,35,34,46,2,39,14,3,21,20,22,51,51,50,30,2,21,20,14,2,35,34,38,
+53,52,62,2,55,38,38,53,52,54,55,38,38,53,52,62,2,51,50,22,23,62,3,51,50,22,
+1,20,30,2,51,50,62,2,53,52,38,35,35,34,14,2,19,20,22,51,50,54,53,52,38,35,
+34,6,3,84,51,62,4,10,15,12,12,24,11,28,38,37,75,112,75,7,23,24,24,8,10,21,
+18,11,43,37,185,73,102,65,30,51,105,161,109,170,168,26,47,63,38,28,37,41,
+47,59,70,38,77,115,77,54,93,29,12,30,37,45,27,56,51,253,106,20,45,74,54,79,
+105,62,26,74,69,166,30,56,44,26,97,61,66,68,59,61,68,66,59,5,139,37,51,9,
+21,18,12,6,5,32,94,60,59,99,72,40,1,2,2,1,7,18,20,24,13,31,14,36,63,85,50,
+68,108,76,41,124,106,43,66,48,31,8,19,62,38,44,65,31,34,120,75,67,106,74,
+40,24,15,10,25,22,14,53,252,84,32,51,38,20,25,44,62,37,63,41,10,28,51,2,124,
+91,89,87,93,99,93,96,0,2,0,23,1,45,1,238,5,182,0,17,0,29,0,0,1,34,6,21,17,
+20,22,51,21,33,17,52,38,35,35,53,33,21,2,6,35,34,38,53,52,54,51,50,22,21,
+1,203,65,48,57,74,254,205,46,67,34,1,215,127,50,53,51,51,54,48,50,53,5,98,
+43,47,254,35,46,44,84,2,133,48,48,84,84,252,1,54,55,50,49,55,54,50,0,1,0,
+33,2,125,3,178,7,6,0,47,0,0,1,19,22,22,51,21,35,34,38,39,39,7,21,20,22,51,
+21,33,53,51,50,54,53,17,52,38,35,35,53,33,17,20,6,7,51,55,54,54,53,52,38,
+35,53,33,21,34,6,7,2,47,205,35,88,59,37,130,120,67,150,94,56,77,254,64,28,
+66,47,51,62,28,1,59,6,2,8,164,47,33,38,38,1,117,56,113,54,4,102,254,226,51,
+68,84,50,99,226,64,137,47,43,84,84,48,48,3,39,48,42,84,253,180,43,82,24,172,
+49,52,14,18,12,84,84,74,59,0,1,0,53,2,125,5,184,5,197,0,58,0,0,1,21,33,53,
+51,50,54,53,17,52,38,35,53,33,23,51,54,54,51,50,22,23,51,54,54,51,50,22,21,
+17,20,22,51,21,33,17,52,38,35,34,6,21,17,20,22,51,21,33,17,52,38,35,34,6,
+21,17,20,22,51,1,248,254,61,37,65,40,51,72,1,14,23,8,50,107,76,74,112,33,
+9,48,121,70,131,137,48,75,254,213,66,81,76,80,47,76,254,211,65,82,80,86,53,
+63,2,209,84,84,48,48,1,213,48,42,86,102,65,52,65,64,73,56,157,146,254,155,
+48,48,84,2,14,96,101,107,106,254,182,49,47,84,2,14,95,102,122,112,254,197,
+46,44,0,1,0,53,1,20,3,109,5,197,0,42,0,0,1,52,38,35,34,6,21,17,20,22,51,51,
+21,33,53,51,50,54,53,17,52,38,35,53,33,23,51,54,54,51,50,22,21,17,20,6,35,
+35,53,51,50,54,53,2,188,71,84,84,90,51,65,17,254,61,29,67,46,56,76,1,21,18,
+9,48,114,69,137,142,146,156,38,22,79,62,4,139,95,102,122,112,254,197,45,45,
+84,84,49,47,1,213,47,43,86,102,65,52,156,147,253,229,178,181,93,133,133,0,
+2,0,113,2,111,3,102,5,197,0,11,0,23,0,0,0,6,35,34,38,53,52,54,51,50,22,21,
+4,22,51,50,54,53,52,38,35,34,6,21,3,102,194,187,184,192,194,189,177,197,253,
+193,89,108,101,95,90,109,103,91,3,66,211,224,204,214,212,218,208,164,170,
+156,178,163,168,157,174,0,1,0,82,2,111,2,242,5,197,0,29,0,0,0,22,21,20,6,
+35,34,38,53,52,54,51,20,22,51,50,54,53,52,38,35,34,6,21,34,38,53,52,54,51,
+2,53,189,198,187,136,151,75,54,78,76,101,105,83,109,71,58,69,75,140,125,5,
+197,212,221,209,212,93,77,54,58,93,103,172,166,171,162,78,75,54,46,68,82,
+0,1,0,113,4,18,3,102,5,197,0,13,0,0,1,52,38,35,34,6,21,35,52,54,51,50,22,
+21,2,176,97,102,101,93,182,193,190,177,197,4,18,177,159,158,178,217,218,226,
+209,0,1,0,113,2,111,3,102,4,33,0,13,0,0,1,20,22,51,50,54,53,51,20,6,35,34,
+38,53,1,39,96,103,101,93,182,193,190,176,198,4,33,176,160,158,178,217,217,
+224,210,0,2,0,23,1,20,3,133,5,197,0,36,0,48,0,0,0,6,35,34,38,39,35,22,22,
+21,21,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,
+50,22,21,0,6,21,20,22,51,50,54,53,52,38,35,3,133,169,163,74,110,37,8,2,2,
+53,78,10,254,58,28,63,50,51,62,36,1,43,16,8,37,106,80,163,169,254,48,93,95,
+104,95,83,82,96,3,62,207,59,41,23,64,20,163,48,45,84,84,49,50,3,61,48,42,
+84,102,51,66,207,219,1,53,140,169,167,145,160,152,155,154,0,1,0,35,2,111,
+2,33,6,113,0,24,0,0,0,54,55,21,6,6,35,34,38,53,17,35,53,50,54,55,51,21,51,
+21,35,17,20,22,51,1,200,57,32,17,94,41,130,111,117,63,112,17,101,207,207,
+54,48,2,209,7,9,90,9,15,107,134,2,0,76,85,112,187,86,253,252,72,67,0,1,0,
+43,2,111,3,219,5,182,0,32,0,0,1,20,22,51,21,33,39,35,6,6,35,34,38,53,17,52,
+38,35,53,33,17,20,22,51,50,54,53,17,52,38,35,53,33,3,88,54,77,254,238,21,
+8,43,109,88,131,137,57,76,1,51,72,78,88,92,54,79,1,53,3,43,47,43,84,100,58,
+56,145,158,1,104,47,45,84,253,240,104,91,120,112,1,55,48,48,84,0,1,0,51,2,
+72,3,123,5,248,0,38,0,0,19,35,17,51,21,20,22,51,33,50,54,53,51,17,7,21,22,
+22,21,20,6,35,33,34,6,21,35,17,33,50,54,53,52,38,35,33,34,6,21,135,84,84,
+49,47,1,213,46,45,86,103,65,52,155,148,254,155,50,46,84,2,15,95,101,125,108,
+254,196,45,45,4,53,1,195,29,67,46,56,76,254,235,18,9,48,114,69,136,142,48,
+73,1,41,71,84,87,87,51,65,0,1,0,55,2,111,5,186,5,182,0,58,0,0,1,53,33,21,
+35,34,6,21,17,20,22,51,21,33,39,35,6,6,35,34,38,39,35,6,6,35,34,38,53,17,
+52,38,35,53,33,17,20,22,51,50,54,53,17,52,38,35,53,33,17,20,22,51,50,54,53,
+17,52,38,35,3,248,1,194,36,65,40,51,72,254,242,23,8,48,109,77,72,114,33,8,
+42,116,82,129,139,47,76,1,43,66,82,76,79,47,75,1,45,64,83,80,86,53,64,5,98,
+84,84,49,47,254,43,48,42,86,102,63,53,63,66,67,62,155,148,1,100,47,49,84,
+253,242,96,101,110,103,1,74,48,48,84,253,242,95,102,122,112,1,59,46,44,0,
+1,0,0,2,125,3,152,5,182,0,39,0,0,17,53,33,21,35,34,6,21,20,22,23,19,22,22,
+23,51,54,54,55,19,54,54,53,52,38,35,35,53,33,21,35,34,6,7,3,35,3,38,38,35,
+1,162,33,40,42,11,16,96,19,29,9,9,15,28,10,112,7,8,46,42,27,1,107,33,37,45,
+23,245,168,254,16,43,42,5,98,84,84,25,20,12,41,43,254,250,47,95,34,52,81,
+24,1,43,17,36,11,31,28,84,84,48,62,253,137,2,158,41,30,0,1,0,51,2,111,3,57,
+5,197,0,41,0,0,1,38,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,54,55,50,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,22,22,51,50,54,1,115,79,97,140,
+111,111,125,89,87,42,64,52,37,43,8,28,45,71,62,82,96,76,67,97,90,63,70,46,
+28,8,43,37,59,66,3,96,85,181,87,112,148,145,115,76,180,97,54,40,48,32,63,
+42,52,70,67,101,89,79,70,52,42,63,32,48,51,0,2,0,207,1,20,3,172,7,10,0,20,
+0,51,0,0,19,17,52,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,38,39,17,0,54,
+53,52,38,39,6,6,35,34,38,53,52,54,51,50,22,51,54,54,53,52,38,35,34,6,21,3,
+22,22,51,207,176,172,171,171,107,83,115,118,183,167,60,114,37,1,32,93,82,
+78,19,48,31,29,45,50,48,16,69,3,47,60,86,82,87,87,2,50,107,48,1,20,4,195,
+151,156,135,119,91,137,34,46,154,107,172,184,29,22,254,114,1,187,124,134,
+102,126,26,8,11,30,28,31,36,12,23,111,71,81,101,105,89,253,55,42,44,0,1,255,
+252,1,20,3,68,5,197,0,40,0,0,0,18,19,51,54,18,53,52,38,39,52,54,51,50,22,
+21,20,2,7,22,22,21,20,6,35,34,38,53,52,54,55,2,2,35,34,6,7,39,54,54,51,1,
+23,133,92,8,74,112,44,42,61,44,58,61,205,107,2,4,88,67,38,40,41,35,80,135,
+52,17,36,14,43,37,102,45,5,186,254,236,254,115,81,1,26,99,45,59,11,55,52,
+78,76,149,254,115,97,14,36,20,146,188,50,45,64,152,72,1,92,1,89,17,8,64,33,
+42,0,2,0,111,2,111,3,102,7,12,0,31,0,43,0,0,0,30,2,21,20,6,35,34,38,53,52,
+54,55,38,38,53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,0,38,39,6,6,21,
+20,22,51,50,54,53,1,145,191,161,117,204,179,168,208,150,155,86,86,164,133,
+121,151,77,68,78,64,68,57,1,39,113,98,89,107,108,90,101,108,5,238,122,108,
+167,109,181,208,187,159,131,185,50,58,120,70,103,118,101,65,54,48,78,100,
+61,49,253,233,160,59,30,180,134,100,125,135,127,0,2,0,113,1,18,4,37,5,203,
+0,25,0,35,0,0,1,6,6,21,20,22,23,17,52,54,51,50,22,21,20,6,7,17,35,17,38,38,
+53,52,54,55,19,54,54,53,52,38,35,34,6,21,1,178,70,69,111,126,114,99,140,176,
+216,202,111,206,213,145,143,242,121,115,75,63,42,56,5,115,28,153,161,157,
+158,15,1,244,118,140,239,185,203,217,14,254,163,1,93,13,221,196,170,220,40,
+253,8,15,159,160,148,177,74,81,0,1,255,244,1,20,3,88,5,186,0,37,0,0,19,35,
+1,3,38,38,35,34,6,7,39,54,54,51,50,22,23,23,51,19,51,1,19,22,22,51,50,54,
+55,23,6,6,35,34,38,39,3,35,180,192,1,114,131,29,45,34,16,41,19,41,34,84,50,
+62,76,40,78,8,201,184,254,197,129,26,49,25,19,53,14,37,32,80,50,66,76,36,
+86,8,1,20,2,127,1,56,68,63,14,11,70,29,34,66,120,221,1,147,253,185,254,155,
+69,66,14,13,68,31,36,76,114,1,8,0,2,0,43,255,113,2,2,3,250,0,17,0,29,0,0,
+23,50,54,53,17,52,38,35,53,33,17,20,22,51,51,21,33,53,18,54,51,50,22,21,20,
+6,35,34,38,53,78,65,47,57,74,1,52,45,67,35,254,41,127,58,44,49,54,55,48,43,
+59,59,44,46,1,221,47,43,84,253,123,48,48,84,84,4,7,46,52,52,50,55,49,56,0,
+1,0,66,255,113,2,242,2,184,0,33,0,0,5,33,53,50,54,53,17,52,38,35,53,33,23,
+51,54,54,51,50,22,21,20,6,35,52,38,35,34,6,21,21,20,22,51,51,2,33,254,33,
+76,55,55,76,1,12,20,8,51,106,69,80,86,87,87,32,38,63,72,47,65,58,143,84,48,
+48,1,213,47,45,84,141,98,57,62,58,57,62,64,55,188,122,235,46,44,0,1,0,43,
+255,98,3,219,2,170,0,32,0,0,37,20,22,51,21,33,39,35,6,6,35,34,38,53,17,52,
+38,35,53,33,17,20,22,51,50,54,53,17,52,38,35,53,33,3,88,54,77,254,238,21,
+8,44,113,83,131,137,57,76,1,51,72,78,88,92,54,79,1,53,31,47,43,84,100,60,
+55,146,158,1,104,47,45,84,253,240,104,91,120,112,1,55,48,48,84,0,1,0,0,255,
+113,3,152,2,170,0,39,0,0,17,53,33,21,35,34,6,21,20,22,23,19,22,22,23,51,54,
+54,55,19,54,54,53,52,38,35,35,53,33,21,35,34,6,7,3,35,3,38,38,35,1,162,33,
+40,42,11,16,96,19,29,9,9,15,28,10,112,7,8,46,42,27,1,107,33,37,45,23,245,
+168,254,16,43,42,2,86,84,84,25,20,12,41,43,254,250,47,95,34,52,81,24,1,43,
+17,36,11,31,28,84,84,48,62,253,137,2,158,41,30,0,2,0,207,254,20,3,172,3,254,
+0,20,0,51,0,0,19,17,52,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,38,39,17,
+0,54,53,52,38,39,6,6,35,34,38,53,52,54,51,50,22,51,54,54,53,52,38,35,34,6,
+21,3,22,22,51,207,176,172,171,171,107,83,115,118,186,164,60,114,37,1,31,94,
+82,78,19,48,31,29,45,50,48,16,69,3,45,62,86,82,87,87,2,50,107,48,254,20,4,
+183,151,156,135,119,91,137,34,46,154,107,173,184,30,22,254,126,1,175,124,
+134,102,126,26,8,11,30,27,31,37,12,21,111,73,81,101,105,90,253,56,42,44,0,
+1,255,252,254,20,3,68,2,184,0,39,0,0,0,18,19,51,54,18,53,52,39,52,54,51,50,
+22,21,20,2,7,22,22,21,20,6,35,34,38,53,52,54,55,2,2,35,34,6,7,39,54,54,51,
+1,24,133,91,8,75,111,86,61,44,58,61,205,107,2,4,87,68,38,40,32,44,81,135,
+51,17,36,14,43,38,104,42,2,174,254,230,254,120,82,1,26,99,92,23,54,52,78,
+75,149,254,115,97,14,36,20,145,177,50,45,55,127,94,1,96,1,84,16,8,63,33,43,
+0,2,0,113,254,27,3,100,2,184,0,22,0,34,0,0,18,54,51,50,22,21,20,6,35,34,38,
+39,35,22,22,4,22,23,35,38,36,2,17,36,38,35,34,6,21,20,22,51,50,54,53,113,
+187,185,190,193,185,185,87,122,35,8,9,116,1,75,143,3,80,24,254,122,241,2,
+63,96,107,102,90,89,103,108,95,1,199,241,201,206,201,205,55,48,131,106,28,
+88,118,55,28,1,13,1,82,251,144,158,153,174,135,143,166,0,2,0,113,254,20,4,
+37,2,190,0,25,0,35,0,0,1,6,6,21,20,22,23,17,52,54,51,50,22,21,20,6,7,17,35,
+17,38,38,53,52,54,55,19,54,54,53,52,38,35,34,6,21,1,178,70,69,110,127,111,
+102,140,176,216,202,111,204,215,146,142,242,121,115,75,63,42,56,2,102,28,
+153,161,156,158,15,1,243,116,142,239,185,202,218,14,254,178,1,78,12,221,197,
+170,222,38,253,9,15,158,160,149,177,74,82,0,1,255,244,254,20,3,88,2,174,0,
+37,0,0,19,35,1,3,38,38,35,34,6,7,39,54,54,51,50,22,23,23,51,19,51,1,19,22,
+22,51,50,54,55,23,6,6,35,34,38,39,3,35,180,192,1,114,131,28,45,35,16,41,19,
+41,34,84,50,59,74,45,78,8,201,184,254,197,129,26,49,25,19,53,14,37,32,80,
+50,66,76,36,86,8,254,20,2,121,1,49,68,64,14,11,70,29,34,60,126,215,1,141,
+253,190,254,162,69,66,14,13,68,31,36,76,114,1,2,0,2,0,47,255,236,6,225,4,
+94,0,50,0,57,0,0,4,38,39,6,6,35,34,38,53,17,52,38,35,35,53,33,17,20,22,51,
+50,54,53,17,52,38,35,35,53,33,23,54,54,51,50,22,21,21,33,22,22,51,50,54,55,
+22,22,21,20,6,35,2,6,7,33,52,38,35,4,180,212,56,56,186,135,172,166,73,93,
+8,1,111,104,111,124,134,70,96,8,1,69,21,57,130,89,204,222,253,86,4,146,155,
+96,158,39,14,25,201,159,139,123,11,1,215,110,113,20,136,128,136,128,201,200,
+1,235,69,71,86,253,61,153,127,187,177,1,133,75,73,86,109,68,61,255,234,94,
+214,212,82,61,6,38,26,75,127,4,4,185,178,179,184,0,2,255,195,255,236,4,121,
+6,20,0,57,0,69,0,0,0,2,35,34,38,39,35,7,33,53,51,50,54,53,17,38,38,35,34,
+6,7,35,54,54,51,50,22,23,53,52,38,35,35,53,33,17,22,51,50,54,55,51,6,6,35,
+34,38,35,6,6,21,51,54,54,51,50,18,17,0,6,21,20,22,51,50,54,53,52,38,35,4,
+121,207,211,108,156,49,13,36,254,184,16,97,71,25,43,22,44,47,9,92,7,111,99,
+17,33,15,57,66,61,1,121,30,31,45,47,8,93,7,109,99,11,19,9,2,6,8,54,153,106,
+210,208,253,165,128,132,148,128,124,118,136,1,10,254,226,91,89,160,86,74,
+73,3,230,11,15,36,62,108,113,5,3,12,44,42,86,254,250,12,40,58,104,117,2,84,
+150,14,109,96,254,228,254,229,1,180,196,240,237,203,213,229,218,216,0,2,0,
+113,255,236,5,18,6,20,0,56,0,68,0,0,1,22,51,50,54,55,51,6,6,35,34,38,39,17,
+20,22,51,51,21,33,39,35,6,6,35,34,2,17,16,18,51,50,22,23,51,38,38,53,53,38,
+38,35,34,6,7,35,54,54,51,50,23,38,38,35,35,53,33,0,54,53,52,38,35,34,6,21,
+20,22,51,4,12,37,33,45,47,8,92,7,111,97,12,24,11,71,97,17,254,165,22,8,51,
+155,108,209,208,207,210,106,155,53,12,6,6,22,40,20,44,47,9,93,7,111,99,29,
+29,2,58,67,58,1,121,254,190,130,135,146,128,124,123,131,5,18,16,40,58,107,
+114,2,2,252,86,68,71,86,184,105,99,1,24,1,31,1,32,1,27,88,92,59,136,30,72,
+9,13,36,62,105,116,6,49,47,86,250,91,194,242,240,200,215,227,228,206,0,1,
+255,242,0,0,3,131,6,41,0,62,0,0,37,21,33,53,51,50,54,53,17,38,38,35,34,6,
+7,35,54,54,51,50,22,23,17,35,53,51,53,52,54,51,50,22,21,20,6,35,52,38,35,
+34,6,21,21,33,21,33,17,22,22,51,50,54,55,51,6,6,35,34,39,17,20,22,51,2,176,
+253,135,27,97,71,19,36,17,41,49,10,92,7,112,98,12,22,13,187,187,190,172,146,
+141,92,76,69,66,81,73,1,33,254,223,20,40,20,42,50,9,92,7,112,96,31,27,71,
+97,86,86,86,74,73,1,103,9,13,39,69,110,132,3,2,1,2,97,102,179,198,73,70,54,
+61,78,86,121,143,121,97,254,156,12,15,43,66,111,131,7,254,253,73,74,0,3,255,
+246,0,0,7,154,4,94,0,71,0,82,0,92,0,0,37,21,33,53,51,50,54,53,17,6,6,7,35,
+54,54,55,53,52,38,35,35,53,33,23,51,54,54,51,50,22,23,51,54,54,51,50,22,21,
+21,54,54,55,51,6,6,7,21,20,22,51,51,21,33,17,38,38,39,21,20,22,51,51,21,33,
+17,38,38,39,17,20,22,51,1,22,22,23,53,52,38,35,34,6,21,37,22,22,23,53,52,
+38,35,34,6,2,96,253,217,27,93,65,60,72,28,92,31,126,95,67,89,8,1,65,27,10,
+53,138,118,112,151,34,17,52,147,122,164,170,56,69,14,93,20,112,100,63,93,
+8,254,156,97,227,119,63,93,8,254,156,126,233,94,70,96,1,223,125,227,91,104,
+111,111,117,253,125,100,230,121,104,111,107,119,86,86,86,72,75,1,84,14,75,
+62,113,140,21,176,73,67,86,166,98,88,95,91,95,91,201,200,174,21,78,46,99,
+143,28,185,75,72,86,1,150,5,34,22,234,75,72,86,1,248,23,41,10,254,157,68,
+69,2,2,23,37,10,177,144,136,158,147,20,8,35,22,70,144,136,146,0,2,255,246,
+0,0,5,51,4,94,0,53,0,63,0,0,37,21,33,53,51,50,54,53,17,6,6,7,35,54,54,55,
+53,52,38,35,35,53,33,23,51,54,54,51,50,22,21,21,54,54,55,51,6,6,7,21,20,22,
+51,51,21,33,17,38,36,39,17,20,22,51,3,22,4,23,53,52,38,35,34,6,2,96,253,217,
+17,97,71,62,72,26,92,22,128,102,72,92,10,1,75,27,10,50,145,125,169,175,56,
+71,12,92,17,109,105,61,92,11,254,155,136,254,255,80,69,95,164,99,1,15,103,
+108,117,120,126,86,86,86,74,73,1,72,4,58,77,120,129,11,190,71,69,86,166,93,
+93,200,201,166,11,69,57,112,131,17,195,76,71,86,1,172,13,91,17,254,186,70,
+67,2,78,15,93,13,152,144,136,166,0,2,255,195,254,20,4,121,4,94,0,62,0,74,
+0,0,0,2,35,34,38,39,35,20,22,21,21,22,51,50,54,55,51,6,6,35,34,38,35,22,22,
+51,51,21,33,53,51,50,54,53,53,38,38,35,34,6,7,35,54,54,51,50,22,23,17,52,
+38,35,35,53,33,23,51,54,54,51,50,18,17,0,6,21,20,22,51,50,54,53,52,38,35,
+4,121,207,211,108,156,49,8,8,30,31,45,47,8,93,7,109,99,11,19,9,6,75,87,6,
+253,217,16,97,71,25,43,22,44,47,9,92,7,111,99,17,33,15,74,94,26,1,102,21,
+8,54,153,106,210,208,253,165,128,132,148,128,124,118,136,1,10,254,226,91,
+89,15,191,26,102,12,40,58,104,117,2,49,50,86,86,75,73,20,11,16,36,62,108,
+113,5,3,3,200,70,70,86,185,109,96,254,228,254,229,1,180,196,240,237,203,213,
+229,218,216,0,1,255,231,0,0,3,166,4,94,0,60,0,0,33,33,53,51,50,54,53,17,38,
+38,35,34,6,7,35,54,54,51,50,23,53,52,38,35,35,53,33,23,51,54,54,51,50,22,
+21,20,6,35,52,38,35,34,6,21,22,22,51,50,54,55,51,6,6,35,34,39,21,20,22,51,
+51,2,147,253,177,6,97,71,20,35,19,41,49,10,93,7,111,100,25,24,73,93,8,1,59,
+35,10,48,146,91,112,109,88,103,48,60,90,111,20,38,20,43,48,9,93,7,111,98,
+31,24,71,97,57,86,74,73,1,60,11,13,39,69,107,135,7,172,69,71,86,199,110,109,
+78,71,65,81,84,76,248,131,12,14,43,65,107,135,7,228,69,68,0,1,255,207,0,0,
+3,125,4,94,0,55,0,0,19,38,38,35,34,6,7,35,54,54,51,50,22,23,53,52,54,51,50,
+22,21,20,6,35,52,38,35,34,6,21,21,22,22,51,50,54,55,51,6,6,35,34,38,39,21,
+20,22,51,51,21,33,53,51,50,54,53,221,20,39,19,41,49,10,92,7,112,98,14,27,
+12,176,176,153,167,88,103,70,67,79,72,18,37,18,43,49,9,92,7,112,96,14,25,
+12,71,97,57,253,176,8,95,71,2,35,12,14,39,69,110,132,3,4,15,197,206,102,92,
+56,63,110,109,152,165,105,11,13,42,66,111,131,3,2,226,69,68,86,86,72,75,0,
+1,0,6,255,236,3,162,4,92,0,58,0,0,19,38,53,52,54,51,50,22,21,20,6,35,52,38,
+35,34,6,21,20,30,2,51,50,54,55,51,6,6,7,22,22,21,20,6,35,34,38,53,52,54,51,
+20,22,51,50,54,53,52,46,2,35,34,6,7,35,54,54,145,39,209,177,136,163,77,71,
+85,91,97,98,86,207,94,78,43,49,9,92,4,71,60,20,19,212,192,163,175,76,53,113,
+108,107,119,114,189,83,73,48,54,9,92,5,74,2,158,61,96,137,152,105,83,56,67,
+103,114,86,78,65,80,88,47,42,66,83,120,24,32,78,48,151,170,115,102,66,75,
+129,131,102,84,80,83,81,45,49,60,81,120,0,1,255,184,255,236,2,162,5,70,0,
+51,0,0,36,54,55,21,6,6,35,34,38,53,53,38,38,35,34,6,7,35,54,54,51,50,23,17,
+35,53,50,54,55,51,21,33,21,33,17,22,22,51,50,54,55,51,6,6,35,34,38,39,21,
+20,22,51,2,68,62,32,28,105,49,163,134,20,36,18,44,48,9,92,7,112,98,26,24,
+156,86,133,35,94,1,12,254,244,20,38,20,43,48,9,92,7,111,97,15,28,12,85,71,
+88,8,6,90,13,19,147,170,252,11,13,43,65,107,135,7,1,25,82,116,171,252,117,
+254,135,12,14,43,65,110,132,3,4,160,105,98,0,1,0,86,0,0,3,164,4,74,0,45,0,
+0,37,50,54,55,55,51,3,33,53,1,38,35,34,6,7,35,54,54,51,50,22,23,19,33,34,
+6,7,7,35,19,33,21,1,22,51,50,54,55,51,6,6,35,34,38,39,3,2,184,53,66,21,10,
+86,10,252,188,1,41,54,48,42,49,10,92,7,114,96,40,77,35,223,254,192,65,66,
+26,2,86,20,3,17,254,217,39,43,44,47,9,92,7,112,96,35,68,34,223,117,69,99,
+47,254,180,82,1,192,23,40,69,112,130,24,17,1,80,61,105,8,1,35,84,254,67,12,
+44,65,111,131,17,14,254,174,0,2,0,37,254,20,4,121,4,94,0,40,0,52,0,0,19,16,
+54,51,50,22,21,20,6,35,52,38,35,34,6,21,21,20,6,7,51,54,54,51,50,18,17,16,
+2,35,34,38,39,35,7,33,53,51,50,54,53,0,6,21,20,22,51,50,54,53,52,38,35,221,
+208,222,203,209,88,84,101,133,115,128,6,2,8,54,153,106,212,206,204,214,107,
+156,50,13,36,254,184,16,97,71,1,66,129,134,146,134,118,118,136,2,96,1,0,254,
+113,108,62,77,146,112,179,173,58,53,99,32,109,96,254,236,254,231,254,230,
+254,232,90,91,160,86,74,73,2,222,194,232,231,199,216,216,217,207,0,1,0,72,
+1,203,3,240,4,184,0,51,0,0,1,53,51,50,54,53,53,33,21,20,22,51,51,21,33,53,
+51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,21,33,53,52,38,35,35,53,33,
+21,35,34,6,21,17,20,22,51,51,21,2,66,14,65,48,254,180,48,64,15,254,84,14,
+64,49,51,62,14,1,172,15,65,47,1,76,47,66,14,1,174,17,64,48,48,64,17,1,203,
+73,48,51,184,184,51,48,73,73,47,52,1,155,47,46,73,73,50,49,133,133,49,50,
+73,73,52,47,254,101,48,45,73,0,2,0,113,254,20,4,45,4,74,0,27,0,39,0,0,4,6,
+35,34,38,53,52,54,51,51,39,53,37,33,34,6,7,7,35,19,33,21,1,21,5,22,22,21,
+4,22,51,50,54,53,52,38,35,34,6,21,4,45,245,236,231,244,242,239,31,142,1,49,
+254,127,62,57,14,4,100,12,3,47,254,121,1,41,79,91,253,10,133,148,147,131,
+131,149,148,131,254,238,249,243,252,231,113,94,244,47,82,29,1,66,144,254,
+207,10,236,61,196,146,205,180,178,207,201,174,175,200,0,1,0,29,255,137,7,
+125,6,20,0,77,0,0,23,55,38,53,17,35,53,50,54,55,51,21,33,21,33,17,1,17,52,
+38,35,35,53,33,17,1,51,1,6,6,21,51,54,51,50,22,21,17,20,22,51,51,21,33,17,
+52,38,35,34,6,21,17,20,22,51,51,21,33,53,50,54,53,17,1,22,22,51,50,54,55,
+21,6,6,35,34,38,39,7,29,190,24,156,86,133,35,94,1,12,254,244,1,252,71,97,
+16,1,120,1,13,131,254,110,2,3,10,92,209,181,181,63,93,8,254,156,110,116,121,
+127,70,96,9,253,233,97,71,254,18,19,72,51,36,54,20,26,86,49,70,104,37,121,
+119,242,67,107,2,172,82,116,171,252,117,253,121,2,129,1,100,68,71,86,254,
+173,1,83,254,7,42,50,27,186,199,202,254,28,75,72,86,2,195,145,135,174,158,
+254,80,68,69,86,86,74,73,2,64,253,145,51,47,10,4,90,12,20,26,29,154,0,1,0,
+20,0,0,2,123,4,74,0,26,0,0,55,50,54,53,17,35,53,51,53,52,38,35,35,53,33,17,
+51,21,35,17,20,22,51,51,21,33,53,74,97,71,222,222,73,93,8,1,110,201,201,71,
+97,27,253,186,86,68,69,1,56,96,241,69,71,86,254,45,96,254,210,73,74,86,86,
+0,1,0,20,255,236,2,168,4,74,0,23,0,0,1,17,51,21,35,21,20,22,51,50,54,55,21,
+6,6,35,34,38,53,53,35,53,51,17,1,137,201,201,85,71,37,62,32,28,105,49,163,
+134,181,181,4,74,254,45,96,244,105,98,8,6,90,13,19,147,170,238,96,1,211,0,
+3,0,20,254,20,4,215,4,94,0,43,0,50,0,57,0,0,19,51,53,52,38,35,35,53,33,23,
+51,54,54,51,50,22,23,51,21,35,2,2,35,34,38,39,35,20,22,21,21,20,22,51,51,
+21,33,53,51,50,54,53,17,35,0,54,55,33,22,22,51,2,6,7,33,38,38,35,20,201,74,
+94,26,1,102,21,8,47,145,101,175,198,14,145,143,4,193,192,101,145,47,8,8,71,
+97,6,253,217,16,97,71,201,2,255,107,3,254,29,2,120,132,125,118,9,1,223,9,
+108,112,2,119,241,70,70,86,185,106,99,235,252,96,254,231,254,238,90,90,15,
+191,26,196,69,69,86,86,75,73,3,25,254,88,217,207,227,197,3,108,164,192,179,
+177,0,2,0,20,255,242,4,111,4,74,0,35,0,44,0,0,1,33,17,52,38,35,35,53,33,21,
+35,34,6,21,17,51,21,35,21,20,6,35,34,38,53,53,35,53,51,17,52,38,35,35,53,
+33,0,54,53,53,33,21,20,22,51,1,106,1,246,49,63,37,1,157,34,66,47,154,154,
+208,187,214,198,154,154,51,62,34,1,79,1,114,132,254,10,128,122,2,119,1,35,
+47,45,84,84,51,48,254,228,96,216,160,173,176,174,199,96,1,35,47,45,84,252,
+22,122,104,213,207,114,118,0,2,0,20,255,236,4,154,4,74,0,42,0,49,0,0,1,35,
+6,6,35,34,38,39,35,53,51,54,54,55,55,35,34,6,7,35,19,33,3,6,6,7,33,38,38,
+39,3,33,19,35,38,38,35,35,23,22,22,23,51,0,54,55,33,22,22,51,4,154,101,5,
+243,233,230,243,2,101,107,21,159,127,2,133,71,55,9,94,12,1,201,11,81,112,
+15,2,36,14,107,85,11,1,201,12,94,9,55,71,133,2,119,164,22,109,254,74,135,
+4,253,208,2,136,143,1,176,230,222,235,217,96,118,157,26,117,43,90,1,29,254,
+186,8,123,113,110,125,9,1,70,254,227,90,43,115,24,160,119,254,70,161,185,
+180,166,0,2,0,37,254,109,4,121,6,20,0,50,0,62,0,0,0,6,7,17,20,6,35,34,38,
+53,52,54,55,22,22,51,50,54,53,53,6,35,34,38,39,35,7,33,53,51,50,54,53,17,
+52,38,35,35,53,33,17,20,6,7,51,54,54,51,50,18,17,0,6,21,20,22,51,50,54,53,
+52,38,35,4,121,39,35,105,108,72,84,17,14,25,48,34,61,55,95,134,108,156,49,
+13,36,254,184,16,97,71,71,97,16,1,121,5,3,8,54,153,106,210,208,253,165,128,
+132,148,128,124,118,136,1,171,188,69,254,242,156,147,56,56,25,37,14,17,16,
+75,73,139,59,91,89,160,86,74,73,4,74,68,71,86,254,136,69,121,77,109,96,254,
+228,254,229,1,180,196,240,237,203,213,229,218,216,0,2,0,113,254,109,4,197,
+6,20,0,47,0,59,0,0,37,20,22,51,51,21,20,6,35,34,38,53,52,54,55,22,22,51,50,
+54,53,53,35,39,35,6,6,35,34,2,17,16,18,51,50,22,23,51,52,38,53,53,52,38,35,
+35,53,33,0,54,53,52,38,35,34,6,21,20,22,51,4,12,71,97,17,105,108,73,83,17,
+14,24,48,34,60,57,232,22,8,51,155,108,209,208,207,210,106,155,53,12,12,71,
+97,17,1,121,254,190,130,135,146,128,124,123,131,225,68,71,186,152,151,56,
+56,25,37,14,17,16,73,75,100,184,105,99,1,24,1,31,1,32,1,27,88,92,20,176,29,
+168,68,71,86,250,91,194,242,240,200,215,227,228,206,0,1,0,55,254,109,3,131,
+6,41,0,51,0,0,37,21,20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,33,53,
+51,50,54,53,17,35,53,51,53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,21,
+33,21,33,17,20,22,51,2,176,105,108,72,84,17,14,25,48,34,61,55,253,250,27,
+97,71,187,187,190,172,146,141,92,76,69,66,81,73,1,33,254,223,71,97,86,186,
+156,147,56,56,25,37,14,17,16,75,73,100,86,74,73,3,0,97,102,179,198,73,70,
+54,61,78,86,121,143,121,97,253,0,73,74,0,3,0,113,254,20,5,188,4,94,0,60,0,
+72,0,73,0,0,37,33,17,20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,33,21,
+16,6,35,34,38,53,52,54,51,20,22,51,50,54,53,53,52,54,55,35,6,6,35,34,2,17,
+16,18,51,50,22,23,51,55,33,21,35,34,6,21,0,54,53,52,38,35,34,6,21,20,22,51,
+5,4,12,1,176,105,108,72,83,16,14,25,48,34,60,57,254,194,208,222,205,206,91,
+81,102,131,116,128,6,2,8,52,155,107,211,206,204,213,106,155,53,12,37,1,72,
+17,98,70,254,188,132,135,146,134,118,121,133,2,180,250,254,162,156,147,56,
+56,25,37,14,17,16,73,75,243,125,255,0,254,115,107,63,76,147,111,179,173,57,
+54,86,45,107,98,1,17,1,28,1,28,1,21,88,92,160,86,75,73,253,35,191,235,232,
+198,216,216,226,198,131,0,1,0,37,254,109,4,176,6,20,0,63,0,0,1,1,22,22,23,
+51,21,20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,38,38,39,3,7,21,20,22,
+51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,17,20,6,7,1,54,54,53,52,38,
+35,53,33,21,34,6,7,2,182,1,17,52,98,63,20,105,108,72,84,17,14,25,48,34,61,
+55,118,118,79,205,151,69,97,8,253,217,16,97,71,71,97,16,1,121,5,3,1,0,50,
+62,48,52,1,196,71,137,80,2,147,254,107,77,88,3,186,156,147,56,56,25,37,14,
+17,16,75,73,100,4,70,125,1,65,112,185,70,67,86,86,74,73,4,74,68,71,86,252,
+234,60,131,67,1,24,56,90,37,26,15,86,86,100,91,0,1,0,27,254,109,2,96,6,20,
+0,34,0,0,55,50,54,53,17,52,38,35,35,53,33,17,20,22,51,51,21,20,6,35,34,38,
+53,52,54,55,22,22,51,50,54,53,53,33,53,53,97,71,71,97,26,1,131,72,96,26,105,
+108,72,83,16,14,25,48,34,62,55,254,45,86,74,73,4,74,68,71,86,250,213,75,72,
+186,156,147,56,56,25,37,14,17,16,77,71,100,86,0,1,0,57,254,109,7,86,4,94,
+0,77,0,0,37,21,33,53,51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,50,22,
+23,51,54,54,51,50,22,21,17,20,22,23,51,21,20,6,35,34,38,53,52,54,55,22,22,
+51,50,54,53,53,35,17,52,38,35,34,6,21,17,20,22,51,51,21,33,17,52,38,35,34,
+6,21,17,20,22,51,2,96,253,217,27,93,65,67,89,8,1,65,27,10,53,138,118,112,
+151,34,17,52,147,122,164,170,56,81,27,105,108,72,84,17,14,25,48,34,61,55,
+241,104,111,111,117,63,93,8,254,156,104,111,116,122,70,96,86,86,86,72,75,
+2,127,73,67,86,166,98,88,95,91,95,91,201,200,254,28,71,73,3,186,156,147,56,
+56,25,37,14,17,16,75,73,100,2,195,144,136,158,147,254,63,75,72,86,2,195,144,
+136,173,159,254,80,68,69,0,1,0,57,254,109,4,240,4,94,0,56,0,0,37,21,33,53,
+51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,50,22,21,17,20,22,23,51,21,
+20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,35,17,52,38,35,34,6,21,17,
+20,22,51,2,96,253,217,17,97,71,72,92,10,1,75,27,10,50,145,125,169,175,54,
+79,31,105,108,73,83,17,14,24,48,34,60,57,242,108,117,121,127,69,95,86,86,
+86,74,73,2,127,71,69,86,166,93,93,200,201,254,28,75,69,3,186,152,151,56,56,
+25,37,14,17,16,73,75,100,2,195,144,136,173,159,254,80,70,67,0,2,0,27,254,
+20,4,121,4,94,0,55,0,67,0,0,0,6,7,17,20,6,35,34,38,53,52,54,55,22,22,51,50,
+54,53,53,6,35,34,38,39,35,20,22,21,21,20,22,51,51,21,33,53,51,50,54,53,17,
+52,38,35,35,53,33,23,51,54,54,51,50,18,17,0,6,21,20,22,51,50,54,53,52,38,
+35,4,121,39,35,105,108,72,84,17,14,25,48,34,61,55,95,134,108,156,49,8,8,69,
+97,8,253,217,16,97,71,74,94,26,1,102,21,8,54,153,106,210,208,253,165,128,
+132,148,128,124,118,136,1,171,188,69,254,242,156,147,56,56,25,37,14,17,16,
+75,73,139,59,91,89,15,191,26,196,69,69,86,86,75,73,4,106,70,70,86,185,109,
+96,254,228,254,229,1,180,196,240,237,203,213,229,218,216,0,1,0,68,254,109,
+3,166,4,94,0,52,0,0,5,20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,33,53,
+51,50,54,53,17,52,38,35,35,53,33,23,51,62,2,51,50,22,21,20,6,35,52,38,35,
+34,2,21,17,20,22,51,51,2,147,105,108,72,83,17,14,24,48,34,60,57,254,35,8,
+95,71,73,93,8,1,59,39,10,46,65,95,75,112,109,88,103,48,60,92,109,71,97,57,
+100,156,147,56,56,25,37,14,17,16,73,75,100,86,72,75,2,127,69,71,86,203,106,
+75,42,78,71,65,81,84,76,254,251,177,254,190,69,68,0,1,0,92,254,109,3,66,4,
+92,0,58,0,0,4,38,53,52,54,51,20,22,51,50,54,53,52,38,36,38,53,52,54,51,50,
+22,21,20,6,35,52,38,35,34,6,21,20,30,2,21,20,6,7,21,20,6,35,34,38,53,52,54,
+55,22,22,51,50,54,53,53,6,35,1,11,175,76,53,113,108,107,119,124,254,203,129,
+209,177,136,163,77,71,85,91,97,98,192,230,140,27,25,105,108,72,83,16,14,25,
+48,34,62,55,100,138,20,115,102,66,75,129,131,102,84,83,86,133,142,119,137,
+152,105,83,56,67,103,114,86,78,96,97,95,144,125,54,89,35,223,156,147,56,56,
+25,37,14,17,16,77,71,127,47,0,2,255,106,254,20,3,102,6,31,0,51,0,52,0,0,37,
+33,17,20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,33,21,20,6,35,34,38,
+53,52,54,55,20,22,51,50,54,53,17,52,54,51,50,22,21,20,6,35,52,38,35,34,6,
+21,19,1,182,1,176,105,108,72,83,16,14,25,48,34,60,57,254,194,163,158,124,
+143,77,81,54,53,79,52,168,174,111,128,76,81,56,51,70,55,246,250,254,162,156,
+147,56,56,25,37,14,17,16,73,75,243,159,235,241,87,75,56,79,2,105,91,185,186,
+4,151,209,201,92,70,51,66,88,97,94,136,251,37,0,1,0,8,254,109,4,156,4,74,
+0,57,0,0,19,53,33,21,35,34,6,21,20,22,23,19,22,22,23,51,54,54,55,19,54,54,
+53,52,38,35,35,53,33,21,35,34,6,7,1,51,21,20,6,35,34,38,53,52,54,55,22,22,
+51,50,54,53,53,35,1,38,38,35,8,2,0,26,61,62,8,8,139,25,48,15,9,8,83,11,147,
+10,9,67,68,15,1,183,25,63,56,37,254,228,129,105,108,72,84,17,14,25,47,34,
+60,57,240,254,183,24,59,61,3,244,86,86,48,51,17,35,23,254,125,70,165,73,37,
+215,29,1,143,25,46,17,53,48,86,86,65,95,253,22,206,152,151,56,56,25,37,14,
+17,16,73,75,100,3,135,65,44,0,1,0,10,254,109,4,150,4,74,0,78,0,0,0,38,35,
+35,53,33,21,35,34,6,7,3,1,22,22,51,51,21,20,6,35,34,38,53,52,54,55,22,22,
+51,50,54,53,53,33,53,51,50,53,52,38,39,39,7,6,6,21,20,22,51,51,21,33,53,51,
+50,54,55,1,1,38,38,35,35,53,33,21,35,34,6,21,20,22,23,23,55,54,54,53,3,18,
+61,47,8,1,192,18,71,84,52,211,1,45,45,81,38,27,105,108,73,83,17,14,24,48,
+34,60,57,254,98,10,123,35,43,137,143,25,30,56,68,9,254,24,19,73,88,62,1,2,
+254,254,45,85,46,27,2,8,8,59,56,25,23,135,106,23,28,3,221,23,86,86,62,69,
+254,231,254,107,60,49,186,152,151,56,56,25,37,14,17,16,73,75,100,86,68,24,
+60,57,184,200,33,69,27,35,29,86,86,52,79,1,78,1,96,53,56,86,86,28,32,21,41,
+32,184,153,35,62,28,0,1,0,86,254,109,3,164,4,74,0,38,0,0,37,50,54,55,55,51,
+6,6,21,21,20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,33,53,1,33,34,6,
+7,7,35,19,33,21,1,2,184,53,66,21,10,86,3,7,105,108,73,83,17,14,24,48,34,60,
+57,253,47,2,82,254,192,65,66,26,2,86,20,3,17,253,172,117,69,99,47,87,156,
+89,100,152,151,56,56,25,37,14,17,16,73,75,100,82,3,131,61,105,8,1,35,84,252,
+127,0,2,0,102,254,109,4,229,4,94,0,50,0,61,0,0,33,39,35,14,2,35,34,38,53,
+52,54,55,55,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,17,20,22,51,51,
+21,20,22,51,50,54,55,22,21,20,6,35,34,38,53,53,36,22,51,50,54,53,53,7,6,6,
+21,3,20,32,17,63,74,104,78,149,169,232,235,170,93,97,97,90,86,88,198,171,
+198,177,48,62,23,38,48,26,35,19,22,75,64,88,76,253,119,81,85,124,148,131,
+162,145,176,85,68,43,171,156,163,157,8,6,123,152,100,97,126,58,71,95,101,
+169,185,253,237,80,66,187,75,73,16,17,28,40,56,64,149,154,100,201,95,154,
+131,166,6,7,116,131,0,2,0,113,254,109,5,129,4,94,0,41,0,53,0,0,5,34,38,39,
+35,6,6,35,34,2,17,16,18,51,50,22,23,51,55,51,17,20,22,51,50,55,21,20,22,51,
+50,54,55,22,21,20,6,35,34,38,53,53,36,54,53,52,38,35,34,6,21,20,22,51,4,53,
+107,109,9,8,51,155,108,203,214,211,225,94,149,52,12,39,141,47,60,40,38,38,
+48,26,35,18,23,75,64,88,76,254,120,130,135,146,128,124,123,131,20,100,104,
+105,99,1,11,1,23,1,46,1,34,89,91,160,252,151,68,69,6,194,75,73,16,17,28,40,
+56,64,149,154,80,131,194,242,240,200,215,227,228,206,0,2,0,113,254,20,5,145,
+6,31,0,49,0,61,0,0,5,20,22,51,50,54,55,21,6,6,35,34,38,53,53,52,54,55,35,
+6,6,35,34,2,17,16,18,51,50,22,23,51,52,38,53,52,54,51,50,22,21,20,6,35,52,
+38,35,34,6,21,0,54,53,52,38,35,34,6,21,20,22,51,4,12,85,71,37,62,32,29,111,
+42,164,133,9,3,10,50,157,109,209,208,207,210,106,155,53,12,12,168,174,111,
+128,76,81,51,56,70,55,254,190,130,135,146,128,124,123,131,180,105,98,8,6,
+90,14,19,150,168,174,46,92,46,103,101,1,24,1,31,1,32,1,27,88,92,20,176,46,
+196,191,92,70,51,66,93,92,94,136,251,148,194,242,240,200,215,227,228,206,
+0,2,0,113,254,109,4,113,4,94,0,39,0,46,0,0,4,2,17,16,18,51,50,22,21,21,33,
+22,22,51,50,54,55,22,22,21,17,20,22,51,50,54,55,22,22,21,20,6,35,34,38,53,
+53,6,6,35,2,6,7,33,52,38,35,1,108,251,236,218,204,222,253,86,4,146,155,96,
+158,39,14,25,38,48,26,36,18,11,12,77,63,89,74,45,123,78,139,123,11,1,215,
+110,113,20,1,41,1,8,1,31,1,34,255,234,94,214,212,82,61,6,38,26,254,230,75,
+73,16,17,14,35,19,57,63,151,152,135,25,30,4,4,185,178,179,184,0,1,0,111,254,
+109,4,113,4,92,0,72,0,0,0,22,22,51,54,54,51,50,22,21,20,6,35,34,38,39,6,6,
+21,20,22,51,50,54,55,22,22,21,17,20,22,51,50,54,55,22,22,21,20,6,35,34,38,
+53,53,6,6,35,34,38,53,52,54,55,53,38,38,53,52,54,51,50,22,21,20,6,35,52,38,
+35,34,6,21,1,84,56,98,30,51,86,21,37,45,63,54,36,100,26,78,98,136,133,105,
+170,56,14,25,38,48,26,36,18,11,12,77,63,89,74,51,151,106,197,218,105,128,
+94,105,224,204,156,182,80,81,104,103,102,101,2,253,98,35,11,12,34,35,35,49,
+18,12,17,117,89,101,99,76,67,6,38,26,254,230,75,73,16,17,14,35,19,57,63,151,
+152,133,25,28,170,149,95,134,43,11,31,134,80,140,149,108,84,65,58,103,118,
+100,95,0,1,0,82,254,109,3,121,4,92,0,60,0,0,36,54,53,52,38,35,35,53,51,50,
+54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,21,22,22,21,20,6,
+35,34,38,39,21,20,22,51,50,54,55,22,21,20,6,35,34,38,53,17,52,51,20,22,51,
+2,65,113,127,112,191,193,96,110,94,90,103,108,81,81,199,178,175,200,112,95,
+125,117,227,213,87,123,42,52,64,34,48,25,31,93,77,106,93,151,120,106,78,129,
+112,104,97,111,106,90,95,100,118,103,58,65,85,107,143,125,95,140,31,11,31,
+128,95,157,180,27,22,129,76,72,16,17,28,40,57,63,146,157,1,45,131,117,137,
+0,3,0,102,254,109,5,2,4,94,0,39,0,46,0,47,0,0,0,18,19,51,17,20,22,51,50,54,
+55,22,21,20,6,35,34,38,53,17,6,6,35,34,38,53,53,33,38,38,35,34,6,7,38,38,
+53,52,54,51,18,54,55,33,20,22,51,5,2,216,253,2,111,38,48,26,35,19,22,75,64,
+88,76,20,232,199,203,223,2,170,4,146,155,93,156,44,14,25,200,161,139,122,
+11,254,41,111,112,2,52,4,94,254,220,254,249,253,105,75,73,16,17,28,40,56,
+64,149,154,2,49,240,241,252,237,94,214,212,78,65,6,37,26,75,128,251,252,185,
+178,180,183,90,0,2,0,47,254,109,3,49,6,20,0,33,0,45,0,0,55,50,54,53,17,52,
+38,35,35,53,33,17,20,22,23,51,21,20,22,51,50,54,55,22,21,20,6,35,34,38,53,
+53,33,53,18,54,51,50,22,21,20,6,35,34,38,53,74,97,71,74,94,6,1,110,62,86,
+47,38,48,26,35,19,22,75,64,88,76,254,45,166,56,61,60,56,59,57,58,59,86,68,
+69,2,137,70,70,86,252,159,70,74,3,186,75,73,16,17,28,40,56,64,149,154,100,
+86,5,124,66,67,59,60,67,65,62,0,1,0,72,254,109,3,127,4,94,0,46,0,0,36,54,
+53,52,38,35,34,6,21,34,38,53,52,54,51,50,18,17,16,2,35,34,38,39,21,20,22,
+51,50,54,55,22,22,21,20,6,35,34,38,53,17,52,54,51,20,22,51,2,49,135,118,140,
+89,85,91,91,206,150,230,227,237,216,77,131,48,52,65,34,48,25,15,15,92,78,
+105,93,99,83,73,113,82,239,224,240,231,117,119,58,71,94,115,254,224,254,225,
+254,238,254,223,22,23,125,76,72,16,17,14,35,19,57,63,146,157,1,45,62,77,146,
+112,0,1,255,236,254,109,3,188,6,31,0,48,0,0,1,20,6,35,34,38,39,21,20,22,51,
+50,54,55,22,22,21,20,6,35,34,38,53,53,52,54,55,20,22,51,50,54,53,17,52,54,
+51,50,22,21,20,6,35,52,38,35,34,6,21,2,55,161,160,47,76,29,52,65,35,47,24,
+16,15,92,78,105,93,83,74,54,53,78,53,168,174,111,128,76,81,56,51,70,55,1,
+199,233,242,13,9,102,76,72,16,17,14,35,19,57,63,146,157,241,61,75,2,105,92,
+181,190,2,192,209,201,92,70,51,66,88,97,94,136,0,1,0,47,254,109,5,162,4,74,
+0,50,0,0,37,20,22,51,51,21,20,22,51,50,54,55,22,21,20,6,35,34,38,53,53,35,
+39,35,6,6,35,34,38,53,17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,
+35,35,53,33,4,55,70,96,8,38,48,26,36,18,23,75,64,88,76,211,27,10,53,153,126,
+172,166,74,94,6,1,111,104,111,125,133,71,97,6,1,110,223,68,69,186,75,73,16,
+17,28,40,56,64,149,154,100,166,95,91,201,200,1,235,70,70,86,253,61,153,127,
+170,161,1,166,73,75,86,0,1,0,82,254,109,3,121,4,74,0,49,0,0,1,50,22,21,20,
+6,35,34,38,39,21,20,22,51,50,54,55,22,21,20,6,35,34,38,53,17,52,51,20,22,
+51,50,54,53,52,38,35,35,53,1,33,34,6,7,7,35,19,33,21,1,1,252,187,194,227,
+213,87,123,42,52,64,34,48,25,31,93,77,106,93,151,120,106,118,113,106,113,
+119,1,47,254,207,66,56,11,4,100,12,2,213,254,170,2,127,169,153,157,180,27,
+22,129,76,72,16,17,28,40,57,63,146,157,1,45,131,117,137,129,112,104,118,84,
+1,53,51,78,29,1,66,101,254,164,0,2,0,33,2,158,3,135,5,244,0,29,0,41,0,0,18,
+22,23,51,54,54,51,50,22,21,20,6,35,34,38,39,35,7,35,17,52,38,35,34,6,7,53,
+54,54,51,4,6,21,20,22,51,50,54,53,52,38,35,230,92,20,8,48,112,61,161,171,
+167,179,74,104,35,8,27,135,34,31,20,31,25,25,63,37,1,28,92,93,104,94,82,82,
+94,5,244,67,54,64,57,201,209,224,220,63,51,100,2,137,54,38,3,5,86,11,10,117,
+137,170,169,145,161,153,157,150,0,1,0,113,2,158,2,250,5,244,0,29,0,0,0,38,
+53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,20,22,51,50,54,55,22,22,21,
+20,6,35,1,49,192,179,183,122,163,85,83,58,59,97,83,101,116,68,108,29,18,27,
+152,127,2,158,218,204,215,217,88,74,60,45,86,84,158,175,156,150,64,49,18,
+39,19,63,92,0,2,0,113,2,98,2,250,5,244,0,37,0,49,0,0,0,22,23,54,54,51,50,
+22,21,20,6,35,34,38,39,7,39,54,54,55,38,38,53,52,54,51,50,22,21,20,6,35,52,
+38,35,34,6,21,0,54,53,52,38,35,34,6,7,22,22,51,1,39,7,9,50,127,75,92,107,
+138,124,30,98,63,22,90,4,22,8,52,66,184,178,122,163,85,83,58,59,97,83,1,24,
+74,46,46,62,101,34,26,87,37,4,26,86,32,74,67,104,84,97,118,16,21,97,23,15,
+94,16,52,170,112,208,224,88,74,60,45,86,84,158,175,254,202,59,42,40,52,70,
+71,22,30,0,2,0,113,2,158,3,102,7,66,0,31,0,43,0,0,1,22,22,23,55,21,7,22,18,
+21,20,6,35,34,38,53,52,54,51,50,22,23,55,38,38,39,7,53,55,38,38,39,18,22,
+51,50,54,53,52,38,35,34,6,21,1,6,74,146,63,217,135,114,129,192,189,181,195,
+193,190,45,63,33,6,19,65,45,207,125,35,85,50,33,89,108,100,96,90,109,104,
+90,7,59,20,54,40,121,113,76,101,254,231,157,233,227,205,192,202,195,18,14,
+6,42,87,41,111,111,65,22,38,14,252,196,151,137,162,149,150,140,159,0,1,0,
+80,2,158,2,211,5,242,0,44,0,0,0,54,53,52,38,35,35,53,51,50,54,53,52,38,35,
+34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,54,
+51,20,22,51,1,206,81,88,78,119,119,66,75,65,60,71,72,79,73,154,145,140,159,
+76,61,81,83,181,167,142,153,75,70,84,72,2,250,90,78,69,68,96,77,60,64,68,
+85,75,45,55,67,83,111,96,61,106,32,28,97,63,122,136,95,77,52,54,84,102,0,
+1,0,51,2,172,2,209,7,68,0,35,0,0,1,21,33,53,51,50,54,53,17,35,53,51,53,52,
+54,51,50,22,21,20,6,35,52,38,35,34,6,21,21,51,21,35,17,20,22,51,2,35,254,
+16,35,66,47,140,140,154,134,119,115,85,71,44,44,59,43,190,190,46,66,3,0,84,
+84,47,49,2,47,86,64,132,155,58,57,47,49,58,62,91,91,78,86,253,209,47,49,0,
+1,255,223,1,68,1,213,5,229,0,23,0,0,1,17,51,21,35,17,20,6,35,35,53,51,50,
+54,53,17,35,53,51,53,52,38,35,53,1,74,139,139,155,167,41,27,88,74,142,142,
+56,75,5,229,254,117,92,254,172,180,178,92,131,135,1,84,92,219,48,42,86,0,
+2,0,113,1,68,3,215,5,244,0,40,0,52,0,0,1,20,6,35,34,38,53,52,54,51,20,22,
+51,50,54,53,53,52,54,55,35,6,6,35,34,38,53,52,54,51,50,22,23,51,55,33,21,
+35,34,6,21,0,54,53,52,38,35,34,6,21,20,22,51,3,74,165,175,164,164,80,82,74,
+88,79,89,2,2,8,38,108,72,170,161,162,169,81,112,35,8,25,1,22,29,67,45,254,
+244,92,94,103,94,82,82,94,2,197,194,191,89,85,48,64,114,76,127,121,43,15,
+47,20,47,62,206,212,214,208,66,53,104,84,46,48,253,238,136,165,164,141,152,
+155,154,145,0,1,0,53,1,92,3,229,5,229,0,42,0,0,1,53,33,21,35,34,6,21,17,20,
+22,51,51,21,33,17,52,54,55,35,6,6,35,34,38,53,17,52,38,35,53,33,17,20,22,
+51,50,54,53,17,52,38,35,2,37,1,192,28,66,47,50,63,28,254,197,5,3,8,40,106,
+69,143,148,47,76,1,45,68,86,85,89,49,66,5,145,84,84,49,47,252,217,48,42,84,
+1,51,43,65,23,52,64,146,157,1,100,47,49,84,253,242,95,102,123,111,1,59,46,
+44,0,2,0,14,2,172,2,0,7,53,0,25,0,37,0,0,19,50,54,53,53,35,53,51,53,52,38,
+35,53,33,17,51,21,35,21,20,22,51,51,21,33,53,18,54,51,50,22,21,20,6,35,34,
+38,53,72,65,47,170,170,56,77,1,53,152,152,46,67,35,254,41,125,54,50,49,54,
+55,48,44,60,3,0,44,46,217,92,166,47,43,86,254,170,92,211,47,49,84,84,4,2,
+51,52,52,50,55,49,56,0,1,0,174,2,158,2,53,5,229,0,15,0,0,1,17,20,22,51,50,
+54,55,21,6,6,35,34,38,53,17,1,92,57,48,21,57,34,18,92,43,128,110,5,229,253,
+166,72,67,7,9,90,9,15,110,131,2,86,0,1,0,43,2,172,2,2,5,229,0,23,0,0,19,52,
+38,35,35,53,33,21,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,190,45,67,
+35,1,215,35,67,45,45,67,35,254,41,35,65,47,5,49,48,46,86,86,44,44,254,41,
+48,48,84,84,44,46,0,1,0,43,2,172,2,2,5,229,0,31,0,0,19,35,53,51,53,52,38,
+35,35,53,33,21,35,34,6,21,21,51,21,35,21,20,22,51,51,21,33,53,51,50,54,53,
+190,139,139,45,67,35,1,215,35,67,45,139,139,45,67,35,254,41,35,65,47,3,254,
+92,215,48,46,86,86,44,44,221,92,158,48,48,84,84,44,46,0,3,255,145,1,68,1,
+213,7,53,0,19,0,31,0,41,0,0,1,6,6,35,34,38,53,52,54,51,51,17,52,38,35,53,
+33,17,51,21,0,54,51,50,22,21,20,6,35,34,38,53,2,54,55,35,34,6,21,20,22,51,
+1,70,16,135,107,85,94,117,123,25,53,76,1,49,139,254,178,51,52,50,52,53,49,
+45,58,38,55,2,27,66,71,41,22,2,49,113,124,85,68,79,95,2,170,46,44,86,252,
+166,90,4,208,52,53,51,48,57,49,56,250,211,77,68,42,42,27,34,0,1,0,33,1,68,
+2,53,7,6,0,20,0,0,1,20,22,51,50,54,55,21,6,6,35,34,38,53,17,52,38,35,35,53,
+33,1,92,57,48,21,57,34,18,92,43,128,110,51,62,28,1,59,2,49,72,67,7,9,90,9,
+15,110,131,4,35,48,42,84,0,1,0,49,1,133,1,242,7,6,0,34,0,0,19,53,51,50,54,
+53,17,52,38,35,35,53,33,17,20,22,51,51,21,20,6,35,34,38,53,52,54,55,22,22,
+51,50,54,53,53,49,29,67,45,49,63,29,1,60,51,65,17,86,90,59,75,20,15,22,38,
+26,43,43,2,172,84,48,48,2,248,47,43,84,252,84,45,45,147,118,114,47,45,20,
+36,14,16,11,50,47,63,0,1,0,43,2,172,3,18,5,229,0,25,0,0,19,51,50,54,53,17,
+52,38,35,35,53,33,21,35,34,6,21,17,51,50,54,55,55,51,3,33,43,35,65,47,45,
+67,35,1,215,35,67,45,225,46,45,9,10,84,14,253,39,3,0,44,46,1,215,48,46,86,
+86,44,44,253,213,52,57,59,254,248,0,1,0,53,1,68,5,61,5,244,0,68,0,0,1,52,
+38,35,34,6,21,17,20,22,51,21,33,17,52,38,35,34,6,21,17,20,22,51,51,21,33,
+53,51,50,54,53,17,52,38,35,53,33,23,51,54,54,51,50,22,23,51,54,54,51,50,22,
+21,17,20,6,35,34,38,53,52,54,55,20,22,51,50,54,53,4,141,66,81,76,80,47,76,
+254,211,65,82,80,86,53,63,17,254,61,37,65,40,51,72,1,14,23,8,50,107,76,74,
+112,33,9,48,121,70,131,137,134,126,106,109,77,73,33,32,50,34,4,186,96,101,
+107,106,254,182,49,47,84,2,14,95,102,122,111,254,196,46,44,84,84,48,48,1,
+213,48,42,86,102,65,52,65,64,73,56,155,148,253,229,180,178,73,56,48,62,2,
+77,68,126,136,0,1,0,53,1,68,5,184,5,229,0,62,0,0,1,52,54,55,35,6,6,35,34,
+38,39,35,6,6,35,34,38,53,17,52,38,35,53,33,17,20,22,51,50,54,53,17,52,38,
+35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,
+51,51,21,33,4,123,4,2,8,48,109,77,74,112,33,8,44,114,82,129,139,47,76,1,43,
+66,82,75,80,47,76,1,46,64,83,80,86,53,64,16,1,194,37,64,40,41,61,37,254,197,
+2,162,28,57,27,63,53,65,64,67,62,155,148,1,100,47,49,84,253,242,96,101,109,
+104,1,74,48,48,84,253,242,95,102,122,112,1,59,45,45,84,84,49,47,252,195,46,
+46,84,0,1,255,152,1,68,3,229,5,244,0,42,0,0,1,20,6,35,34,38,53,52,54,55,20,
+22,51,50,54,53,17,52,38,35,53,33,23,51,54,54,51,50,22,21,17,20,22,51,21,33,
+17,52,38,35,34,6,21,1,115,131,129,107,108,77,72,34,32,49,35,56,76,1,21,18,
+9,48,114,69,136,143,46,74,254,215,71,84,85,89,2,170,174,184,73,56,48,62,2,
+77,68,126,136,2,139,47,43,86,102,65,52,154,149,254,155,49,47,84,2,14,95,102,
+123,110,0,1,0,53,1,68,4,25,5,244,0,46,0,0,1,20,22,51,50,54,55,21,6,6,35,34,
+38,53,17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,
+53,33,23,51,54,54,51,50,22,21,3,109,45,39,17,43,28,14,76,29,127,103,71,84,
+85,89,51,65,17,254,61,29,67,46,56,76,1,21,18,9,48,114,69,136,143,2,49,72,
+67,7,9,90,8,16,110,131,2,133,95,102,123,110,254,196,45,45,84,84,49,47,1,213,
+47,43,86,102,65,52,154,149,0,1,0,43,2,172,3,250,5,229,0,36,0,0,1,1,35,17,
+20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,1,51,17,52,38,35,35,
+53,33,21,35,34,6,21,17,2,227,254,82,8,45,66,45,254,98,33,68,46,51,63,33,1,
+45,1,150,8,51,62,37,1,154,35,66,49,2,172,2,72,254,110,49,49,84,84,49,49,1,
+211,46,46,84,253,217,1,119,47,45,84,84,49,49,253,125,0,3,0,113,2,158,3,102,
+5,244,0,11,0,18,0,25,0,0,0,6,35,34,38,53,52,54,51,50,22,21,0,54,55,33,22,
+22,51,2,6,7,33,38,38,35,3,102,194,187,184,192,194,189,177,197,254,231,95,
+4,254,119,4,91,102,103,88,6,1,135,6,91,100,3,113,211,224,204,214,212,218,
+208,254,178,146,151,145,152,2,154,144,135,136,143,0,3,0,113,1,68,4,31,7,53,
+0,17,0,24,0,31,0,0,0,6,7,17,35,17,38,38,53,52,54,55,17,51,17,22,22,21,4,22,
+23,17,6,6,21,36,38,39,17,54,54,53,4,31,209,199,125,197,212,204,205,125,197,
+211,253,6,106,123,123,106,2,69,106,121,122,105,3,141,222,15,254,164,1,92,
+12,212,202,202,208,14,1,67,254,189,14,217,193,146,163,17,2,135,14,163,144,
+141,164,14,253,123,17,162,147,0,1,0,90,1,133,2,172,5,242,0,56,0,0,0,38,39,
+21,20,22,51,50,54,55,22,22,21,20,6,35,34,38,53,53,52,54,51,20,22,51,50,54,
+53,52,46,2,53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,20,30,2,21,20,6,
+35,1,57,84,34,41,43,24,39,23,12,20,73,60,94,80,75,54,78,76,70,83,83,238,103,
+165,141,113,130,75,68,56,63,71,60,123,185,118,174,148,2,158,27,20,96,48,49,
+11,16,14,36,20,45,47,122,110,219,54,58,93,103,74,59,49,62,100,111,89,103,
+119,82,66,46,54,75,87,64,51,60,66,70,112,98,117,128,0,1,255,90,1,68,2,94,
+7,59,0,31,0,0,1,20,6,35,34,38,53,52,54,55,20,22,51,50,54,53,17,52,54,51,50,
+22,21,20,6,35,52,38,35,34,6,21,1,55,134,126,105,112,80,72,32,31,51,37,131,
+142,91,105,74,75,34,32,46,34,2,170,180,178,73,56,49,61,2,77,68,120,142,3,
+90,158,153,72,57,42,54,61,74,67,88,0,1,0,35,1,133,2,33,6,160,0,40,0,0,0,54,
+55,21,20,6,35,34,38,53,52,54,55,22,22,51,50,54,53,53,6,6,35,34,38,53,17,35,
+53,50,54,55,51,21,51,21,35,17,20,22,51,1,199,56,34,86,90,59,74,19,15,22,38,
+26,43,43,12,26,11,130,111,117,63,112,17,101,207,207,54,48,3,0,6,10,163,118,
+114,47,45,20,36,14,16,11,50,47,53,2,2,107,134,2,0,76,85,112,187,86,253,252,
+72,67,0,2,0,14,2,158,3,248,5,229,0,35,0,44,0,0,1,51,21,35,21,20,22,51,21,
+33,39,35,6,6,35,34,38,53,53,35,53,51,53,52,38,35,53,33,17,33,53,52,38,35,
+53,33,0,54,53,53,33,21,20,22,51,3,88,160,160,54,77,254,238,21,8,43,109,88,
+131,137,162,162,57,76,1,51,1,74,54,79,1,53,254,244,92,254,182,72,78,4,143,
+92,217,47,43,84,100,58,56,145,158,102,92,166,47,45,84,254,170,162,48,48,84,
+253,45,120,112,57,94,104,91,0,1,0,72,2,158,3,131,5,229,0,41,0,0,0,6,35,34,
+38,53,52,54,55,55,35,34,6,7,35,55,33,3,6,6,21,20,22,51,50,54,53,52,38,39,
+3,33,23,35,38,38,35,35,23,22,22,21,3,94,191,190,179,196,136,108,6,106,41,
+37,8,92,10,1,108,8,71,78,95,101,105,92,74,78,6,1,107,12,92,5,37,46,105,4,
+108,136,3,76,174,182,170,114,149,22,84,36,75,229,254,252,6,115,106,138,120,
+126,132,103,116,8,1,4,229,65,46,84,20,149,116,0,1,0,53,2,158,3,174,5,229,
+0,36,0,0,1,35,34,6,21,17,20,22,51,50,54,53,17,52,38,35,35,53,33,21,35,34,
+6,21,17,20,6,35,34,38,53,17,52,38,35,53,33,1,201,17,46,46,91,81,100,91,46,
+47,16,1,84,8,66,47,165,158,164,160,47,74,1,148,5,145,41,51,254,187,110,112,
+107,111,1,73,51,41,84,84,49,49,254,186,171,160,171,150,1,86,46,44,86,0,1,
+0,33,2,158,3,102,5,242,0,27,0,0,0,38,53,17,52,38,35,53,33,17,20,22,51,50,
+54,53,52,38,39,52,54,51,50,22,21,20,6,35,1,78,160,64,77,1,59,91,81,115,117,
+87,69,61,43,80,90,188,184,2,158,171,150,1,86,47,43,86,254,11,110,112,166,
+187,102,149,21,47,64,201,147,249,255,0,1,0,0,2,172,3,152,5,229,0,39,0,0,1,
+21,33,53,51,50,54,53,52,38,39,3,38,38,39,35,6,6,7,3,6,6,21,20,22,51,51,21,
+33,53,51,50,54,55,19,51,19,22,22,51,3,152,254,94,33,40,41,11,15,96,16,23,
+19,8,14,28,11,113,6,8,46,42,26,254,150,33,37,44,23,246,168,254,15,44,41,3,
+0,84,84,25,20,12,41,43,1,6,40,73,64,51,77,30,254,213,17,36,11,31,28,84,84,
+49,62,2,118,253,99,42,30,0,1,0,84,2,172,2,244,5,229,0,18,0,0,1,50,54,55,55,
+51,3,33,53,1,35,34,6,7,35,55,33,21,1,2,59,34,49,10,8,84,6,253,102,1,186,231,
+38,46,21,84,15,2,112,254,66,3,23,64,50,43,254,248,72,2,135,42,85,233,73,253,
+123,0,1,0,84,1,133,3,186,5,229,0,37,0,0,1,50,54,55,55,51,20,6,21,21,20,22,
+51,50,54,55,22,22,21,20,6,35,34,38,53,53,33,53,1,35,34,6,7,35,55,33,21,1,
+2,57,33,49,11,8,86,6,41,43,24,39,23,14,20,75,60,89,83,253,205,1,186,231,40,
+44,21,86,15,2,114,254,66,3,23,60,54,43,44,165,45,73,48,49,11,16,14,36,20,
+45,47,116,116,63,72,2,135,43,84,233,73,253,123,0,2,0,84,2,47,3,39,5,229,0,
+27,0,37,0,0,1,20,6,7,39,55,33,53,1,35,34,6,7,35,55,33,21,1,51,54,54,51,50,
+22,21,20,6,35,54,6,7,51,50,54,53,52,38,35,1,217,9,13,101,21,254,225,1,186,
+231,38,46,21,84,15,2,112,254,66,94,44,118,84,71,97,132,126,42,71,24,73,66,
+61,35,32,2,172,5,58,62,23,102,72,2,135,42,85,233,73,253,123,123,114,84,70,
+95,95,250,66,77,44,37,22,40,0,1,0,80,1,68,3,45,5,229,0,33,0,0,1,1,35,34,6,
+7,7,35,19,33,21,1,22,22,21,20,6,35,34,38,53,52,54,51,20,22,51,50,54,53,52,
+38,35,35,1,33,1,37,246,48,47,10,4,94,8,2,119,254,186,189,178,226,184,154,
+169,72,73,97,79,106,124,145,150,47,3,252,1,92,34,54,27,1,0,88,254,135,20,
+171,144,182,203,86,71,53,54,73,97,144,132,127,125,0,3,0,113,2,158,3,104,7,
+59,0,11,0,18,0,25,0,0,0,2,35,34,2,17,16,18,51,50,18,17,0,54,55,33,22,22,51,
+2,6,7,33,38,38,35,3,104,194,182,190,193,194,189,182,194,254,227,103,6,254,
+107,2,105,98,89,107,9,1,147,7,101,90,3,205,254,209,1,38,1,44,1,41,1,34,254,
+212,254,223,254,12,241,224,214,251,3,229,219,223,224,218,0,3,254,135,5,12,
+1,39,6,109,0,11,0,23,0,33,0,0,0,54,51,50,22,21,20,6,35,34,38,53,36,54,51,
+50,22,21,20,6,35,34,38,53,7,35,38,38,39,53,51,22,22,23,254,135,56,40,39,58,
+58,39,40,56,1,223,56,41,44,52,58,38,41,56,10,67,60,130,11,184,7,56,21,5,168,
+49,50,52,53,50,50,53,201,49,55,48,52,50,50,52,235,64,198,45,20,61,191,49,
+0,3,254,123,5,12,1,96,6,104,0,11,0,23,0,33,0,0,0,54,51,50,22,21,20,6,35,34,
+38,53,36,54,51,50,22,21,20,6,35,34,38,53,5,54,54,55,51,21,6,6,7,35,254,123,
+56,40,43,53,58,38,40,56,2,37,56,40,43,53,58,38,40,56,254,205,29,46,9,184,
+10,130,61,67,5,168,49,55,47,53,50,50,53,196,49,53,49,52,50,49,53,205,74,168,
+59,20,42,199,66,0,1,255,133,254,78,0,102,255,170,0,33,0,0,19,34,53,52,54,
+53,52,38,53,52,54,53,52,35,34,7,39,54,54,51,50,21,20,6,21,20,22,21,20,6,21,
+20,22,23,90,178,106,106,113,50,44,46,8,21,68,32,104,102,94,94,33,57,254,78,
+63,27,34,7,11,22,26,25,44,11,17,21,55,8,19,61,41,43,11,7,24,30,28,27,9,7,
+9,2,0,1,254,137,4,219,1,117,5,205,0,16,0,0,1,34,4,35,34,38,39,51,23,22,22,
+51,50,36,51,51,21,1,102,122,254,217,82,110,114,10,92,4,7,60,40,72,1,39,137,
+41,5,76,113,121,121,27,45,41,113,129,0,1,254,215,4,238,1,61,5,233,0,5,0,0,
+19,33,53,33,55,23,49,254,166,1,57,244,57,4,238,120,131,106,0,1,254,195,4,
+238,1,41,5,233,0,5,0,0,1,55,23,33,21,33,254,195,57,244,1,57,254,166,5,127,
+106,131,120,0,1,254,215,4,217,1,61,5,213,0,5,0,0,1,7,39,33,53,33,1,61,57,
+244,254,199,1,90,5,68,107,131,121,0,1,254,195,4,217,1,41,5,213,0,5,0,0,3,
+33,21,33,7,39,49,1,90,254,199,244,57,5,213,121,131,107,0,1,254,72,4,205,1,
+184,5,221,0,7,0,0,3,37,55,23,37,5,7,39,147,254,219,57,244,1,35,1,32,57,240,
+4,205,157,107,131,139,153,107,127,0,1,254,72,4,205,1,184,5,221,0,7,0,0,19,
+55,23,5,37,7,39,37,143,240,57,254,224,254,221,244,57,1,37,5,82,127,107,153,
+139,131,106,158,0,1,255,43,254,20,0,221,255,190,0,33,0,0,19,33,53,50,54,53,
+53,52,38,35,53,51,23,51,54,54,51,50,22,21,20,6,35,52,38,35,34,6,21,21,20,
+22,51,51,104,254,195,50,36,35,51,178,10,9,24,70,53,49,41,51,43,21,26,40,48,
+32,42,38,254,20,56,33,30,180,31,31,55,94,48,56,45,34,30,50,43,37,115,55,62,
+31,28,0,1,255,70,4,141,0,186,6,53,0,16,0,0,3,22,22,23,21,35,38,38,39,53,54,
+54,55,51,21,6,6,16,42,90,70,20,93,180,79,135,149,68,20,40,107,5,98,16,48,
+54,95,63,72,27,100,43,72,47,94,32,63,0,2,254,111,254,20,1,145,255,174,0,16,
+0,33,0,0,3,38,38,39,53,51,22,22,23,21,6,6,7,35,53,54,54,37,54,54,55,51,21,
+6,6,7,35,38,38,39,53,51,22,22,209,53,101,38,20,113,165,74,99,157,96,20,52,
+91,1,199,20,54,26,104,55,67,23,119,14,74,57,104,31,52,254,225,20,55,26,104,
+63,64,18,119,15,78,53,105,36,46,14,53,101,39,21,100,181,92,94,178,101,21,
+44,100,255,255,0,78,0,0,4,190,7,71,18,34,0,37,0,0,16,3,1,79,1,12,1,82,255,
+255,0,37,255,236,4,121,6,20,18,34,0,69,0,0,16,3,1,79,1,145,0,0,255,255,0,
+78,254,137,4,190,5,182,18,34,0,37,0,0,16,3,2,98,5,2,0,0,255,255,0,37,254,
+137,4,121,6,20,18,34,0,69,0,0,16,3,2,98,5,43,0,0,255,255,0,78,254,229,4,190,
+5,182,18,34,0,37,0,0,16,3,5,14,2,158,0,0,255,255,0,37,254,229,4,121,6,20,
+18,34,0,69,0,0,16,3,5,14,2,117,0,0,255,255,0,117,254,20,4,164,7,115,18,34,
+0,38,0,0,16,35,0,122,1,135,0,0,16,3,0,118,0,244,1,82,255,255,0,113,254,20,
+3,160,6,33,18,34,0,70,0,0,16,35,0,122,0,233,0,0,16,2,0,118,16,0,255,255,0,
+78,0,0,5,92,7,71,18,34,0,39,0,0,16,3,1,79,1,86,1,82,255,255,0,113,255,236,
+4,197,6,20,18,34,0,71,0,0,16,3,1,79,0,145,0,0,255,255,0,78,254,137,5,92,5,
+182,18,34,0,39,0,0,16,3,2,98,5,35,0,0,255,255,0,113,254,137,4,197,6,20,18,
+34,0,71,0,0,16,3,2,98,4,156,0,0,255,255,0,78,254,229,5,92,5,182,18,34,0,39,
+0,0,16,3,5,14,2,231,0,0,255,255,0,113,254,229,4,197,6,20,18,34,0,71,0,0,16,
+3,5,14,2,117,0,0,255,255,0,78,254,59,5,92,5,182,18,34,0,39,0,0,16,3,5,3,2,
+178,0,0,255,255,0,113,254,59,4,197,6,20,18,34,0,71,0,0,16,3,5,3,2,41,0,0,
+255,255,0,78,254,61,5,92,5,182,18,34,0,39,0,0,16,3,5,10,2,193,0,0,255,255,
+0,113,254,61,4,197,6,20,18,34,0,71,0,0,16,3,5,10,2,76,0,0,255,255,0,78,0,
+0,4,166,8,74,18,34,0,40,0,0,16,3,9,75,0,125,1,82,255,255,0,113,255,236,3,
+225,6,248,18,34,0,72,0,0,16,2,9,75,55,0,255,255,0,78,0,0,4,166,8,74,18,34,
+0,40,0,0,16,3,9,76,0,125,1,82,255,255,0,113,255,236,3,225,6,248,18,34,0,72,
+0,0,16,2,9,76,55,0,255,255,0,78,254,61,4,166,5,182,18,34,0,40,0,0,16,3,5,
+10,2,127,0,0,255,255,0,113,254,61,3,225,4,94,18,34,0,72,0,0,16,3,5,10,2,68,
+0,0,255,255,0,78,254,131,4,166,5,182,18,34,0,40,0,0,16,3,5,13,2,125,0,0,255,
+255,0,113,254,131,3,225,4,94,18,34,0,72,0,0,16,3,5,13,2,66,0,0,255,255,0,
+78,254,20,4,166,7,68,18,34,4,22,0,0,16,3,1,78,0,49,1,82,255,255,0,113,254,
+20,3,225,5,242,18,34,4,23,0,0,16,2,1,78,234,0,255,255,0,78,0,0,4,96,7,71,
+18,34,0,41,0,0,16,3,1,79,1,29,1,82,255,255,0,55,0,0,3,131,7,122,18,34,0,73,
+0,0,16,3,1,79,0,221,1,133,255,255,0,117,255,236,5,143,6,185,18,34,0,42,0,
+0,16,3,1,77,1,66,1,82,255,255,0,47,254,20,4,53,5,103,18,34,0,74,0,0,16,2,
+1,77,39,0,255,255,0,78,0,0,6,10,7,71,18,34,0,43,0,0,16,3,1,79,1,215,1,82,
+255,255,0,37,0,0,4,219,7,102,18,34,0,75,0,0,16,3,1,79,1,74,1,113,255,255,
+0,78,254,137,6,10,5,182,18,34,0,43,0,0,16,3,2,98,5,143,0,0,255,255,0,37,254,
+137,4,219,6,20,18,34,0,75,0,0,16,3,2,98,5,2,0,0,255,255,0,78,0,0,6,10,7,70,
+18,34,0,43,0,0,16,3,0,106,0,221,1,82,255,255,0,37,0,0,4,219,7,101,18,34,0,
+75,0,0,16,3,0,106,0,59,1,113,0,1,0,78,254,20,6,10,5,182,0,73,0,0,0,6,35,34,
+38,39,53,22,22,51,50,54,53,52,38,39,55,35,53,51,50,54,53,17,52,38,35,35,53,
+33,21,35,34,6,21,17,33,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,51,
+21,33,53,51,50,54,53,17,33,17,20,22,51,51,21,33,7,22,22,21,2,84,139,131,34,
+83,41,37,74,28,59,66,81,72,36,237,26,96,72,71,97,26,2,84,27,97,71,2,154,71,
+97,27,2,84,26,96,72,71,97,26,253,172,27,97,71,253,102,71,97,27,254,252,17,
+100,99,254,145,125,12,11,104,8,8,62,53,55,66,4,141,86,72,75,3,236,68,71,86,
+86,74,73,254,98,1,158,73,74,86,86,72,75,252,18,69,68,86,86,74,73,1,224,254,
+32,73,74,86,70,8,99,81,0,1,0,37,254,20,4,219,6,20,0,64,0,0,0,6,35,34,38,39,
+53,22,22,51,50,54,53,52,38,39,55,35,53,51,50,54,53,17,52,38,35,35,53,33,17,
+20,6,7,51,54,51,50,22,21,17,20,22,51,51,21,33,17,52,38,35,34,6,21,17,20,22,
+51,51,21,35,7,22,22,21,2,25,140,131,34,83,40,37,74,28,59,66,83,71,37,219,
+16,97,71,71,97,16,1,121,6,2,10,92,209,181,181,63,93,8,254,156,108,117,121,
+127,69,97,8,234,16,100,99,254,145,125,12,11,104,8,8,62,53,56,65,4,141,86,
+74,73,4,74,68,71,86,254,62,53,92,29,186,199,202,254,28,75,72,86,2,195,144,
+136,174,158,254,80,70,67,86,70,8,99,81,255,255,0,78,254,92,6,10,5,182,18,
+34,0,43,0,0,16,3,5,11,3,43,0,0,255,255,0,37,254,92,4,219,6,20,18,34,0,75,
+0,0,16,3,5,11,2,137,0,0,255,255,0,10,254,131,2,228,5,182,18,34,0,44,0,0,16,
+3,5,13,1,119,0,0,255,255,255,229,254,131,2,191,6,20,18,34,0,76,0,0,16,3,5,
+13,1,82,0,0,255,255,0,75,0,0,2,167,8,74,18,34,0,44,0,0,16,3,8,138,255,40,
+1,82,255,255,0,7,0,0,2,117,6,248,18,34,0,243,0,0,16,3,8,138,254,228,0,0,255,
+255,0,78,0,0,5,178,7,115,18,34,0,46,0,0,16,3,0,118,0,229,1,82,255,255,0,37,
+0,0,4,176,7,170,18,34,0,78,0,0,16,3,0,118,0,172,1,137,255,255,0,78,254,137,
+5,178,5,182,18,34,0,46,0,0,16,3,2,98,5,111,0,0,255,255,0,37,254,137,4,176,
+6,20,18,34,0,78,0,0,16,3,2,98,4,227,0,0,255,255,0,78,254,229,5,178,5,182,
+18,34,0,46,0,0,16,3,5,14,3,31,0,0,255,255,0,37,254,229,4,176,6,20,18,34,0,
+78,0,0,16,3,5,14,2,127,0,0,255,255,0,78,254,137,4,166,5,182,18,34,0,47,0,
+0,16,3,2,98,4,225,0,0,255,255,0,27,254,137,2,96,6,20,18,34,0,79,0,0,16,3,
+2,98,3,162,0,0,255,255,0,75,254,137,4,166,6,212,18,34,0,47,0,0,16,35,2,98,
+4,225,0,0,16,3,1,77,255,116,1,109,255,255,0,1,254,137,2,96,7,1,18,34,0,79,
+0,0,16,35,2,98,3,162,0,0,16,3,1,77,255,42,1,154,255,255,0,78,254,229,4,166,
+5,182,18,34,0,47,0,0,16,3,5,14,2,125,0,0,255,255,0,20,254,229,2,102,6,20,
+18,34,0,79,0,0,16,3,5,14,1,61,0,0,255,255,0,78,254,61,4,166,5,182,18,34,0,
+47,0,0,16,3,5,10,2,127,0,0,255,255,0,14,254,61,2,106,6,20,18,34,0,79,0,0,
+16,3,5,10,1,61,0,0,255,255,0,78,0,0,7,51,7,71,18,34,0,48,0,0,16,3,1,79,2,
+109,1,82,255,255,0,57,0,0,7,86,5,245,18,34,0,80,0,0,16,3,1,79,2,115,0,0,255,
+255,0,78,254,137,7,51,5,182,18,34,0,48,0,0,16,3,2,98,6,2,0,0,255,255,0,57,
+254,137,7,86,4,94,18,34,0,80,0,0,16,3,2,98,6,63,0,0,255,255,0,78,0,0,5,225,
+7,71,18,34,0,49,0,0,16,3,1,79,1,184,1,82,255,255,0,57,0,0,4,240,5,245,18,
+34,0,81,0,0,16,3,1,79,1,63,0,0,255,255,0,78,254,137,5,225,5,182,18,34,0,49,
+0,0,16,3,2,98,5,113,0,0,255,255,0,57,254,137,4,240,4,94,18,34,0,81,0,0,16,
+3,2,98,5,33,0,0,255,255,0,78,254,229,5,225,5,182,18,34,0,49,0,0,16,3,5,14,
+3,12,0,0,255,255,0,57,254,229,4,240,4,94,18,34,0,81,0,0,16,3,5,14,2,147,0,
+0,255,255,0,78,254,61,5,225,5,182,18,34,0,49,0,0,16,3,5,10,3,14,0,0,255,255,
+0,57,254,61,4,240,4,94,18,34,0,81,0,0,16,3,5,10,2,150,0,0,255,255,0,115,255,
+236,5,123,8,74,18,34,0,50,0,0,16,3,9,74,0,170,1,82,255,255,0,113,255,236,
+4,45,6,248,18,34,0,82,0,0,16,2,9,74,0,0,255,255,0,115,255,236,5,123,8,80,
+18,34,0,50,0,0,16,3,9,72,0,170,1,82,255,255,0,113,255,236,4,45,6,254,18,34,
+0,82,0,0,16,2,9,72,0,0,255,255,0,115,255,236,5,123,8,74,18,34,0,50,0,0,16,
+3,9,75,0,248,1,82,255,255,0,113,255,236,4,45,6,248,18,34,0,82,0,0,16,2,9,
+75,78,0,255,255,0,115,255,236,5,123,8,74,18,34,0,50,0,0,16,3,9,76,0,248,1,
+82,255,255,0,113,255,236,4,45,6,248,18,34,0,82,0,0,16,2,9,76,78,0,255,255,
+0,78,0,0,4,133,7,115,18,34,0,51,0,0,16,3,0,118,0,49,1,82,255,255,0,27,254,
+20,4,121,6,33,18,34,0,83,0,0,16,2,0,118,121,0,255,255,0,78,0,0,4,133,7,71,
+18,34,0,51,0,0,16,3,1,79,1,23,1,82,255,255,0,27,254,20,4,121,5,245,18,34,
+0,83,0,0,16,3,1,79,1,33,0,0,255,255,0,78,0,0,5,76,7,71,18,34,0,53,0,0,16,
+3,1,79,1,76,1,82,255,255,0,68,0,0,3,166,5,245,18,34,0,85,0,0,16,3,1,79,0,
+141,0,0,255,255,0,78,254,137,5,76,5,182,18,34,0,53,0,0,16,3,2,98,5,45,0,0,
+255,255,0,68,254,137,3,166,4,94,18,34,0,85,0,0,16,3,2,98,3,186,0,0,255,255,
+0,78,254,137,5,76,6,212,18,34,0,53,0,0,16,35,2,98,5,45,0,0,16,3,1,77,0,129,
+1,109,255,255,0,68,254,137,3,166,5,103,18,34,0,85,0,0,16,35,2,98,3,186,0,
+0,16,2,1,77,228,0,255,255,0,78,254,229,5,76,5,182,18,34,0,53,0,0,16,3,5,14,
+2,160,0,0,255,255,0,68,254,229,3,166,4,94,18,34,0,85,0,0,16,3,5,14,1,109,
+0,0,255,255,0,98,255,236,3,242,7,71,18,34,0,54,0,0,16,3,1,79,0,217,1,82,255,
+255,0,92,255,236,3,66,5,245,18,34,0,86,0,0,16,2,1,79,121,0,255,255,0,98,254,
+137,3,242,5,203,18,34,0,54,0,0,16,3,2,98,4,145,0,0,255,255,0,92,254,137,3,
+66,4,92,18,34,0,86,0,0,16,3,2,98,4,49,0,0,255,255,0,98,255,236,3,242,7,115,
+18,34,0,54,0,0,16,3,9,69,0,16,1,82,255,255,0,92,255,236,3,80,6,33,18,34,0,
+86,0,0,16,2,9,69,189,0,255,255,0,98,255,236,3,242,8,59,18,34,0,54,0,0,16,
+3,9,70,255,222,1,82,255,255,0,92,255,236,3,66,6,233,18,34,0,86,0,0,16,2,9,
+70,128,0,255,255,0,98,254,137,3,242,7,71,18,34,0,54,0,0,16,35,1,79,0,217,
+1,82,16,3,2,98,4,145,0,0,255,255,0,92,254,137,3,66,5,245,18,34,0,86,0,0,16,
+34,1,79,121,0,16,3,2,98,4,49,0,0,255,255,0,41,0,0,4,190,7,71,18,34,0,55,0,
+0,16,3,1,79,1,31,1,82,255,255,0,39,255,236,2,162,6,235,18,34,0,87,0,0,16,
+3,1,79,255,245,0,246,255,255,0,41,254,137,4,190,5,182,18,34,0,55,0,0,16,3,
+2,98,4,215,0,0,255,255,0,39,254,137,2,162,5,70,18,34,0,87,0,0,16,3,2,98,4,
+10,0,0,255,255,0,41,254,229,4,190,5,182,18,34,0,55,0,0,16,3,5,14,2,115,0,
+0,255,255,0,39,254,229,2,207,5,70,18,34,0,87,0,0,16,3,5,14,1,166,0,0,255,
+255,0,41,254,61,4,190,5,182,18,34,0,55,0,0,16,3,5,10,2,117,0,0,255,255,0,
+39,254,61,2,231,5,70,18,34,0,87,0,0,16,3,5,10,1,186,0,0,255,255,0,31,254,
+152,5,158,5,182,18,34,0,56,0,0,16,3,0,106,0,143,249,138,255,255,0,47,254,
+152,4,229,4,74,18,34,0,88,0,0,16,3,0,106,0,18,249,138,255,255,0,31,254,131,
+5,158,5,182,18,34,0,56,0,0,16,3,5,13,2,221,0,0,255,255,0,47,254,131,4,229,
+4,74,18,34,0,88,0,0,16,3,5,13,2,123,0,0,255,255,0,31,254,61,5,158,5,182,18,
+34,0,56,0,0,16,3,5,10,2,223,0,0,255,255,0,47,254,61,4,229,4,74,18,34,0,88,
+0,0,16,3,5,10,2,98,0,0,255,255,0,31,255,236,5,158,8,74,18,34,0,56,0,0,16,
+3,9,74,0,184,1,82,255,255,0,47,255,236,4,229,6,248,18,34,0,88,0,0,16,2,9,
+74,39,0,255,255,0,31,255,236,5,158,8,19,18,34,0,56,0,0,16,3,9,71,1,6,1,82,
+255,255,0,47,255,236,4,229,6,193,18,34,0,88,0,0,16,2,9,71,117,0,255,255,0,
+0,0,0,5,102,7,49,18,34,0,57,0,0,16,3,1,82,0,137,1,82,255,255,0,8,0,0,4,156,
+5,223,18,34,0,89,0,0,16,2,1,82,43,0,255,255,0,0,254,137,5,102,5,182,18,34,
+0,57,0,0,16,3,2,98,5,23,0,0,255,255,0,8,254,137,4,156,4,74,18,34,0,89,0,0,
+16,3,2,98,4,180,0,0,255,255,0,18,0,0,8,78,7,71,18,34,0,58,0,0,16,3,1,79,2,
+254,1,82,255,255,0,2,0,0,6,227,5,245,18,34,0,90,0,0,16,3,1,79,2,61,0,0,255,
+255,0,18,254,137,8,78,5,182,18,34,0,58,0,0,16,3,2,98,6,147,0,0,255,255,0,
+2,254,137,6,227,4,74,18,34,0,90,0,0,16,3,2,98,5,215,0,0,255,255,0,16,0,0,
+5,55,7,71,18,34,0,59,0,0,16,3,1,79,1,100,1,82,255,255,0,10,0,0,4,150,5,245,
+18,34,0,91,0,0,16,3,1,79,1,16,0,0,255,255,0,16,0,0,5,55,7,70,18,34,0,59,0,
+0,16,3,0,106,0,106,1,82,255,255,0,10,0,0,4,150,5,244,18,34,0,91,0,0,16,2,
+0,106,12,0,255,255,255,246,0,0,5,6,7,71,18,34,0,60,0,0,16,3,1,79,1,63,1,82,
+255,255,0,8,254,20,4,133,5,245,18,34,0,92,0,0,16,3,1,79,1,12,0,0,255,255,
+0,74,0,0,4,102,7,115,18,34,0,61,0,0,16,3,1,75,0,14,1,82,255,255,0,86,0,0,
+3,164,6,33,18,34,0,93,0,0,16,2,1,75,189,0,255,255,0,74,254,137,4,102,5,182,
+18,34,0,61,0,0,16,3,2,98,4,195,0,0,255,255,0,86,254,137,3,164,4,74,18,34,
+0,93,0,0,16,3,2,98,4,90,0,0,255,255,0,74,254,229,4,102,5,182,18,34,0,61,0,
+0,16,3,5,14,2,94,0,0,255,255,0,86,254,229,3,164,4,74,18,34,0,93,0,0,16,3,
+5,14,1,246,0,0,255,255,0,37,254,229,4,219,6,20,18,34,0,75,0,0,16,3,5,14,2,
+137,0,0,255,255,0,39,255,236,2,162,6,213,18,34,0,87,0,0,16,3,0,106,255,7,
+0,225,255,255,0,2,0,0,6,227,6,131,18,34,0,90,0,0,16,3,1,80,2,51,0,0,255,255,
+0,8,254,20,4,133,6,131,18,34,0,92,0,0,16,3,1,80,1,10,0,0,255,255,0,102,255,
+236,4,41,6,90,18,34,0,68,0,0,16,3,4,170,1,197,0,20,255,255,0,27,0,0,3,102,
+7,122,18,34,1,65,0,0,16,3,1,79,0,186,1,133,0,1,0,31,255,236,5,25,5,203,0,
+44,0,0,1,52,38,35,34,6,21,17,33,53,51,50,54,53,17,52,54,51,50,22,21,7,22,
+22,21,20,4,35,34,38,53,52,54,51,20,22,51,50,54,53,52,38,35,35,53,3,133,109,
+137,123,100,254,111,26,96,72,215,228,226,216,250,220,225,254,250,195,166,
+172,76,84,95,89,107,116,176,184,47,4,25,188,135,146,179,251,233,86,72,75,
+3,27,226,229,216,198,217,11,225,200,197,239,103,97,59,72,104,115,161,173,
+170,147,95,255,255,0,113,255,236,4,197,6,29,18,34,1,126,0,0,16,3,7,148,1,
+76,0,82,255,255,0,113,255,236,4,197,6,29,18,34,1,126,0,0,16,3,7,206,1,29,
+0,82,255,255,0,113,255,236,4,197,6,29,18,34,1,126,0,0,16,3,7,163,0,129,0,
+82,255,255,0,113,255,236,4,197,6,29,18,34,1,126,0,0,16,2,7,176,123,82,255,
+255,0,113,255,236,4,197,6,29,18,34,1,126,0,0,16,3,7,164,0,195,0,82,255,255,
+0,113,255,236,4,197,6,29,18,34,1,126,0,0,16,2,7,177,123,82,255,255,0,113,
+255,236,4,197,7,16,18,34,1,126,0,0,16,3,7,165,0,154,0,41,255,255,0,113,255,
+236,4,197,7,16,18,34,1,126,0,0,16,3,7,178,0,143,0,41,255,255,0,0,0,0,5,164,
+5,203,18,34,0,36,0,0,16,2,7,148,228,0,255,255,0,0,0,0,5,164,5,203,18,34,0,
+36,0,0,16,2,7,206,208,0,255,255,255,175,0,0,5,207,5,203,16,34,0,36,43,0,16,
+3,7,163,255,44,0,0,255,255,255,175,0,0,5,197,5,203,16,34,0,36,33,0,16,3,7,
+176,255,34,0,0,255,255,255,176,0,0,5,176,5,203,16,34,0,36,12,0,16,3,7,164,
+255,24,0,0,255,255,255,175,0,0,5,187,5,203,16,34,0,36,23,0,16,3,7,177,255,
+34,0,0,255,255,255,175,0,0,5,180,6,231,16,34,0,36,16,0,16,2,7,165,130,0,255,
+255,255,175,0,0,5,170,6,231,16,34,0,36,6,0,16,3,7,178,255,120,0,0,255,255,
+0,111,255,236,3,180,6,29,18,34,1,130,0,0,16,3,7,148,1,41,0,82,255,255,0,111,
+255,236,3,180,6,29,18,34,1,130,0,0,16,3,7,206,0,250,0,82,255,255,0,111,255,
+236,3,180,6,29,18,34,1,130,0,0,16,2,7,163,113,82,255,255,0,111,255,236,3,
+180,6,29,18,34,1,130,0,0,16,2,7,176,78,82,255,255,0,111,255,236,3,180,6,29,
+18,34,1,130,0,0,16,3,7,164,0,139,0,82,255,255,0,111,255,236,3,180,6,29,18,
+34,1,130,0,0,16,2,7,177,109,82,255,255,255,175,0,0,5,74,5,203,16,35,0,40,
+0,164,0,0,16,3,7,148,255,44,0,0,255,255,255,175,0,0,5,57,5,203,16,35,0,40,
+0,147,0,0,16,3,7,206,255,28,0,0,255,255,255,175,0,0,6,96,5,203,16,35,0,40,
+1,186,0,0,16,3,7,163,255,44,0,0,255,255,255,175,0,0,6,86,5,203,16,35,0,40,
+1,176,0,0,16,3,7,176,255,34,0,0,255,255,255,176,0,0,6,127,5,203,16,35,0,40,
+1,217,0,0,16,3,7,164,255,24,0,0,255,255,255,175,0,0,6,137,5,203,16,35,0,40,
+1,227,0,0,16,3,7,177,255,34,0,0,255,255,0,147,254,20,4,53,6,29,18,34,1,132,
+0,0,16,3,7,148,1,152,0,82,255,255,0,147,254,20,4,53,6,29,18,34,1,132,0,0,
+16,3,7,206,1,125,0,82,255,255,0,147,254,20,4,53,6,29,18,34,1,132,0,0,16,3,
+7,163,0,205,0,82,255,255,0,147,254,20,4,53,6,29,18,34,1,132,0,0,16,3,7,176,
+0,199,0,82,255,255,0,147,254,20,4,53,6,29,18,34,1,132,0,0,16,3,7,164,0,250,
+0,82,255,255,0,147,254,20,4,53,6,29,18,34,1,132,0,0,16,3,7,177,0,229,0,82,
+255,255,0,147,254,20,4,53,7,16,18,34,1,132,0,0,16,3,7,165,0,229,0,41,255,
+255,0,147,254,20,4,53,7,16,18,34,1,132,0,0,16,3,7,178,0,199,0,41,255,255,
+255,175,0,0,6,174,5,203,16,35,0,43,0,164,0,0,16,3,7,148,255,44,0,0,255,255,
+255,175,0,0,6,157,5,203,16,35,0,43,0,147,0,0,16,3,7,206,255,28,0,0,255,255,
+255,175,0,0,7,196,5,203,16,35,0,43,1,186,0,0,16,3,7,163,255,44,0,0,255,255,
+255,175,0,0,7,186,5,203,16,35,0,43,1,176,0,0,16,3,7,176,255,34,0,0,255,255,
+255,176,0,0,7,227,5,203,16,35,0,43,1,217,0,0,16,3,7,164,255,24,0,0,255,255,
+255,175,0,0,7,237,5,203,16,35,0,43,1,227,0,0,16,3,7,177,255,34,0,0,255,255,
+255,175,0,0,7,180,6,231,16,35,0,43,1,170,0,0,16,2,7,165,130,0,255,255,255,
+175,0,0,7,170,6,231,16,35,0,43,1,160,0,0,16,3,7,178,255,120,0,0,255,255,0,
+190,255,236,2,168,6,29,18,34,1,134,0,0,16,2,7,148,59,82,255,255,0,190,255,
+236,2,168,6,29,18,34,1,134,0,0,16,2,7,206,43,82,255,255,0,19,255,236,2,168,
+6,29,18,34,1,134,0,0,16,2,7,163,144,82,255,255,0,13,255,236,2,168,6,29,18,
+34,1,134,0,0,16,2,7,176,128,82,255,255,0,65,255,236,2,168,6,29,18,34,1,134,
+0,0,16,2,7,164,169,82,255,255,0,21,255,236,2,168,6,29,18,34,1,134,0,0,16,
+2,7,177,136,82,255,255,255,214,255,236,2,175,7,16,18,34,1,134,0,0,16,2,7,
+165,169,41,255,255,255,193,255,236,2,168,7,16,18,34,1,134,0,0,16,2,7,178,
+138,41,255,255,255,175,0,0,3,70,5,203,16,35,0,44,0,164,0,0,16,3,7,148,255,
+44,0,0,255,255,255,175,0,0,3,53,5,203,16,35,0,44,0,147,0,0,16,3,7,206,255,
+28,0,0,255,255,255,175,0,0,4,92,5,203,16,35,0,44,1,186,0,0,16,3,7,163,255,
+44,0,0,255,255,255,175,0,0,4,82,5,203,16,35,0,44,1,176,0,0,16,3,7,176,255,
+34,0,0,255,255,255,176,0,0,4,123,5,203,16,35,0,44,1,217,0,0,16,3,7,164,255,
+24,0,0,255,255,255,175,0,0,4,133,5,203,16,35,0,44,1,227,0,0,16,3,7,177,255,
+34,0,0,255,255,255,175,0,0,4,76,6,231,16,35,0,44,1,170,0,0,16,2,7,165,130,
+0,255,255,255,175,0,0,4,76,6,231,16,35,0,44,1,170,0,0,16,3,7,178,255,120,
+0,0,255,255,0,113,255,236,4,45,6,29,18,34,0,82,0,0,16,3,7,148,1,82,0,82,255,
+255,0,113,255,236,4,45,6,29,18,34,0,82,0,0,16,3,7,206,1,66,0,82,255,255,0,
+113,255,236,4,45,6,29,18,34,0,82,0,0,16,3,7,163,0,176,0,82,255,255,0,113,
+255,236,4,45,6,29,18,34,0,82,0,0,16,3,7,176,0,150,0,82,255,255,0,113,255,
+236,4,45,6,29,18,34,0,82,0,0,16,3,7,164,0,180,0,82,255,255,0,113,255,236,
+4,45,6,29,18,34,0,82,0,0,16,3,7,177,0,160,0,82,255,255,255,175,255,236,5,
+143,5,205,16,34,0,50,20,0,16,3,7,148,255,44,0,0,255,255,255,175,255,236,5,
+209,5,205,16,34,0,50,86,0,16,3,7,206,255,28,0,0,255,255,255,175,255,236,6,
+248,5,205,16,35,0,50,1,125,0,0,16,3,7,163,255,44,0,0,255,255,255,175,255,
+236,6,238,5,205,16,35,0,50,1,115,0,0,16,3,7,176,255,34,0,0,255,255,255,176,
+255,236,6,146,5,205,16,35,0,50,1,23,0,0,16,3,7,164,255,24,0,0,255,255,255,
+175,255,236,6,156,5,205,16,35,0,50,1,33,0,0,16,3,7,177,255,34,0,0,255,255,
+0,37,255,236,4,78,6,29,18,34,1,146,0,0,16,3,7,148,1,129,0,82,255,255,0,37,
+255,236,4,78,6,29,18,34,1,146,0,0,16,3,7,206,1,102,0,82,255,255,0,37,255,
+236,4,78,6,29,18,34,1,146,0,0,16,3,7,163,0,203,0,82,255,255,0,37,255,236,
+4,78,6,29,18,34,1,146,0,0,16,3,7,176,0,186,0,82,255,255,0,37,255,236,4,78,
+6,29,18,34,1,146,0,0,16,3,7,164,0,238,0,82,255,255,0,37,255,236,4,78,6,29,
+18,34,1,146,0,0,16,3,7,177,0,197,0,82,255,255,0,37,255,236,4,78,7,16,18,34,
+1,146,0,0,16,3,7,165,0,248,0,41,255,255,0,37,255,236,4,78,7,16,18,34,1,146,
+0,0,16,3,7,178,0,186,0,41,255,255,255,175,0,0,6,0,5,203,16,35,0,60,0,250,
+0,0,16,3,7,206,255,28,0,0,255,255,255,175,0,0,7,29,5,203,16,35,0,60,2,23,
+0,0,16,3,7,176,255,34,0,0,255,255,255,175,0,0,7,90,5,203,16,35,0,60,2,84,
+0,0,16,3,7,177,255,34,0,0,255,255,255,175,0,0,7,33,6,231,16,35,0,60,2,27,
+0,0,16,3,7,178,255,120,0,0,255,255,0,113,255,236,5,180,6,29,18,34,1,150,0,
+0,16,3,7,148,2,23,0,82,255,255,0,113,255,236,5,180,6,29,18,34,1,150,0,0,16,
+3,7,206,2,6,0,82,255,255,0,113,255,236,5,180,6,29,18,34,1,150,0,0,16,3,7,
+163,1,115,0,82,255,255,0,113,255,236,5,180,6,29,18,34,1,150,0,0,16,3,7,176,
+1,90,0,82,255,255,0,113,255,236,5,180,6,29,18,34,1,150,0,0,16,3,7,164,1,121,
+0,82,255,255,0,113,255,236,5,180,6,29,18,34,1,150,0,0,16,3,7,177,1,100,0,
+82,255,255,0,113,255,236,5,180,7,16,18,34,1,150,0,0,16,3,7,165,1,121,0,41,
+255,255,0,113,255,236,5,180,7,16,18,34,1,150,0,0,16,3,7,178,1,111,0,41,255,
+255,255,175,0,0,5,217,5,205,16,34,1,118,41,0,16,3,7,148,255,44,0,0,255,255,
+255,175,0,0,6,26,5,205,16,34,1,118,106,0,16,3,7,206,255,28,0,0,255,255,255,
+175,0,0,7,65,5,205,16,35,1,118,1,145,0,0,16,3,7,163,255,44,0,0,255,255,255,
+175,0,0,7,55,5,205,16,35,1,118,1,135,0,0,16,3,7,176,255,34,0,0,255,255,255,
+176,0,0,6,219,5,205,16,35,1,118,1,43,0,0,16,3,7,164,255,24,0,0,255,255,255,
+175,0,0,6,229,5,205,16,35,1,118,1,53,0,0,16,3,7,177,255,34,0,0,255,255,255,
+175,0,0,6,203,6,231,16,35,1,118,1,27,0,0,16,2,7,165,130,0,255,255,255,175,
+0,0,6,233,6,231,16,35,1,118,1,57,0,0,16,3,7,178,255,120,0,0,255,255,0,113,
+255,236,4,197,6,20,18,34,1,126,0,0,16,3,7,194,1,41,0,0,255,255,0,113,255,
+236,4,197,6,20,18,34,1,126,0,0,16,3,7,205,1,35,0,0,255,255,0,111,255,236,
+3,180,6,20,18,34,1,130,0,0,16,3,7,194,1,25,0,0,255,255,0,111,255,236,3,180,
+6,20,18,34,1,130,0,0,16,3,7,205,1,18,0,0,255,255,0,147,254,20,4,53,6,20,18,
+34,1,132,0,0,16,3,7,194,1,117,0,0,255,255,0,147,254,20,4,53,6,20,18,34,1,
+132,0,0,16,3,7,205,1,104,0,0,255,255,0,125,255,236,2,168,6,20,18,34,1,134,
+0,0,16,2,7,194,33,0,255,255,0,201,255,236,2,168,6,20,18,34,1,134,0,0,16,2,
+7,205,47,0,255,255,0,113,255,236,4,45,6,20,18,34,0,82,0,0,16,3,7,194,1,68,
+0,0,255,255,0,113,255,236,4,45,6,20,18,34,0,82,0,0,16,3,7,205,1,82,0,0,255,
+255,0,37,255,236,4,78,6,20,18,34,1,146,0,0,16,3,7,194,1,84,0,0,255,255,0,
+37,255,236,4,78,6,20,18,34,1,146,0,0,16,3,7,205,1,139,0,0,255,255,0,113,255,
+236,5,180,6,20,18,34,1,150,0,0,16,3,7,194,2,6,0,0,255,255,0,113,255,236,5,
+180,6,20,18,34,1,150,0,0,16,3,7,205,2,20,0,0,255,255,0,113,254,45,4,197,6,
+29,18,34,1,126,0,0,16,35,7,148,1,76,0,82,16,3,7,149,1,16,0,0,255,255,0,113,
+254,45,4,197,6,29,18,34,1,126,0,0,16,35,7,206,1,29,0,82,16,3,7,149,1,16,0,
+0,255,255,0,113,254,45,4,197,6,29,18,34,1,126,0,0,16,35,7,163,0,129,0,82,
+16,3,7,149,1,16,0,0,255,255,0,113,254,45,4,197,6,29,18,34,1,126,0,0,16,34,
+7,176,123,82,16,3,7,149,1,16,0,0,255,255,0,113,254,45,4,197,6,29,18,34,1,
+126,0,0,16,35,7,164,0,195,0,82,16,3,7,149,1,16,0,0,255,255,0,113,254,45,4,
+197,6,29,18,34,1,126,0,0,16,34,7,177,123,82,16,3,7,149,1,16,0,0,255,255,0,
+113,254,45,4,197,7,16,18,34,1,126,0,0,16,35,7,165,0,154,0,41,16,3,7,149,1,
+16,0,0,255,255,0,113,254,45,4,197,7,16,18,34,1,126,0,0,16,35,7,178,0,143,
+0,41,16,3,7,149,1,16,0,0,255,255,0,0,255,236,8,76,5,203,16,34,0,36,0,0,16,
+34,7,148,228,0,16,3,1,134,5,164,0,0,255,255,0,0,255,236,8,76,5,203,16,34,
+0,36,0,0,16,34,7,206,208,0,16,3,1,134,5,164,0,0,255,255,255,175,255,236,8,
+119,5,203,16,34,0,36,43,0,16,35,7,163,255,44,0,0,16,3,1,134,5,207,0,0,255,
+255,255,175,255,236,8,109,5,203,16,34,0,36,33,0,16,35,7,176,255,34,0,0,16,
+3,1,134,5,197,0,0,255,255,255,176,255,236,8,88,5,203,16,34,0,36,12,0,16,35,
+7,164,255,24,0,0,16,3,1,134,5,176,0,0,255,255,255,175,255,236,8,98,5,203,
+16,34,0,36,23,0,16,35,7,177,255,34,0,0,16,3,1,134,5,186,0,0,255,255,255,175,
+255,236,8,92,6,231,16,34,0,36,16,0,16,34,7,165,130,0,16,3,1,134,5,180,0,0,
+255,255,255,175,255,236,8,82,6,231,16,34,0,36,6,0,16,35,7,178,255,120,0,0,
+16,3,1,134,5,170,0,0,255,255,0,147,254,20,4,53,6,29,18,34,1,132,0,0,16,35,
+7,148,1,152,0,82,16,2,7,149,37,0,255,255,0,147,254,20,4,53,6,29,18,34,1,132,
+0,0,16,35,7,206,1,125,0,82,16,2,7,149,37,0,255,255,0,147,254,20,4,53,6,29,
+18,34,1,132,0,0,16,35,7,163,0,205,0,82,16,2,7,149,37,0,255,255,0,147,254,
+20,4,53,6,29,18,34,1,132,0,0,16,35,7,176,0,199,0,82,16,2,7,149,37,0,255,255,
+0,147,254,20,4,53,6,29,18,34,1,132,0,0,16,35,7,164,0,250,0,82,16,2,7,149,
+37,0,255,255,0,147,254,20,4,53,6,29,18,34,1,132,0,0,16,35,7,177,0,229,0,82,
+16,2,7,149,37,0,255,255,0,147,254,20,4,53,7,16,18,34,1,132,0,0,16,35,7,165,
+0,229,0,41,16,2,7,149,37,0,255,255,0,147,254,20,4,53,7,16,18,34,1,132,0,0,
+16,35,7,178,0,199,0,41,16,2,7,149,37,0,255,255,255,175,255,236,9,164,5,203,
+16,35,0,43,0,164,0,0,16,35,7,148,255,44,0,0,16,3,1,134,6,252,0,0,255,255,
+255,175,255,236,9,148,5,203,16,35,0,43,0,147,0,0,16,35,7,206,255,28,0,0,16,
+3,1,134,6,236,0,0,255,255,255,175,255,236,10,186,5,203,16,35,0,43,1,186,0,
+0,16,35,7,163,255,44,0,0,16,3,1,134,8,18,0,0,255,255,255,175,255,236,10,176,
+5,203,16,35,0,43,1,176,0,0,16,35,7,176,255,34,0,0,16,3,1,134,8,8,0,0,255,
+255,255,176,255,236,10,217,5,203,16,35,0,43,1,217,0,0,16,35,7,164,255,24,
+0,0,16,3,1,134,8,49,0,0,255,255,255,175,255,236,10,227,5,203,16,35,0,43,1,
+227,0,0,16,35,7,177,255,34,0,0,16,3,1,134,8,59,0,0,255,255,255,175,255,236,
+10,170,6,231,16,35,0,43,1,170,0,0,16,34,7,165,130,0,16,3,1,134,8,2,0,0,255,
+255,255,175,255,236,10,160,6,231,16,35,0,43,1,160,0,0,16,35,7,178,255,120,
+0,0,16,3,1,134,7,248,0,0,255,255,0,113,254,45,5,180,6,29,18,34,1,150,0,0,
+16,35,7,148,2,23,0,82,16,3,7,149,2,12,0,0,255,255,0,113,254,45,5,180,6,29,
+18,34,1,150,0,0,16,35,7,206,2,6,0,82,16,3,7,149,2,12,0,0,255,255,0,113,254,
+45,5,180,6,29,18,34,1,150,0,0,16,35,7,163,1,115,0,82,16,3,7,149,2,12,0,0,
+255,255,0,113,254,45,5,180,6,29,18,34,1,150,0,0,16,35,7,176,1,90,0,82,16,
+3,7,149,2,12,0,0,255,255,0,113,254,45,5,180,6,29,18,34,1,150,0,0,16,35,7,
+164,1,121,0,82,16,3,7,149,2,12,0,0,255,255,0,113,254,45,5,180,6,29,18,34,
+1,150,0,0,16,35,7,177,1,100,0,82,16,3,7,149,2,12,0,0,255,255,0,113,254,45,
+5,180,7,16,18,34,1,150,0,0,16,35,7,165,1,121,0,41,16,3,7,149,2,12,0,0,255,
+255,0,113,254,45,5,180,7,16,18,34,1,150,0,0,16,35,7,178,1,111,0,41,16,3,7,
+149,2,12,0,0,255,255,255,175,255,236,8,215,5,205,16,34,1,118,41,0,16,35,7,
+148,255,44,0,0,16,3,1,134,6,47,0,0,255,255,255,175,255,236,9,25,5,205,16,
+34,1,118,106,0,16,35,7,206,255,28,0,0,16,3,1,134,6,113,0,0,255,255,255,175,
+255,236,10,64,5,205,16,35,1,118,1,145,0,0,16,35,7,163,255,44,0,0,16,3,1,134,
+7,152,0,0,255,255,255,175,255,236,10,53,5,205,16,35,1,118,1,135,0,0,16,35,
+7,176,255,34,0,0,16,3,1,134,7,141,0,0,255,255,255,176,255,236,9,217,5,205,
+16,35,1,118,1,43,0,0,16,35,7,164,255,24,0,0,16,3,1,134,7,49,0,0,255,255,255,
+175,255,236,9,227,5,205,16,35,1,118,1,53,0,0,16,35,7,177,255,34,0,0,16,3,
+1,134,7,59,0,0,255,255,255,175,255,236,9,201,6,231,16,35,1,118,1,27,0,0,16,
+34,7,165,130,0,16,3,1,134,7,33,0,0,255,255,255,175,255,236,9,231,6,231,16,
+35,1,118,1,57,0,0,16,35,7,178,255,120,0,0,16,3,1,134,7,63,0,0,255,255,0,113,
+255,236,4,197,5,242,18,34,1,126,0,0,16,2,1,78,251,0,255,255,0,113,255,236,
+4,197,5,103,18,34,1,126,0,0,16,2,1,77,72,0,255,255,0,113,254,45,4,197,6,20,
+18,34,1,126,0,0,16,35,7,194,1,41,0,0,16,3,7,149,1,16,0,0,255,255,0,113,254,
+45,4,197,4,94,18,34,1,126,0,0,16,3,7,149,1,16,0,0,255,255,0,113,254,45,4,
+197,6,20,18,34,1,126,0,0,16,35,7,205,1,35,0,0,16,3,7,149,1,16,0,0,255,255,
+0,113,255,236,4,197,5,223,18,34,1,126,0,0,16,2,1,82,251,0,255,255,0,113,254,
+45,4,197,5,223,18,34,1,126,0,0,16,34,1,82,251,0,16,3,7,149,1,16,0,0,255,255,
+0,0,0,0,5,164,7,68,18,34,0,36,0,0,16,3,1,78,0,127,1,82,255,255,0,0,0,0,5,
+164,6,185,18,34,0,36,0,0,16,3,1,77,0,205,1,82,255,255,0,0,0,0,5,164,5,183,
+18,34,0,36,0,0,16,2,7,194,208,163,255,255,0,0,0,0,5,164,5,183,18,34,0,36,
+0,0,16,2,7,205,208,163,255,255,0,0,255,236,8,76,5,182,16,34,0,36,0,0,16,3,
+1,134,5,164,0,0,0,1,0,131,4,96,1,117,5,203,0,16,0,0,0,6,7,53,54,54,53,52,
+38,38,53,52,54,51,50,22,21,1,117,122,120,67,50,53,45,49,47,56,71,4,231,113,
+22,62,15,50,31,27,22,31,37,37,51,78,62,0,1,0,184,254,45,1,205,255,113,0,14,
+0,0,1,20,51,50,54,55,21,6,6,35,34,38,53,53,51,1,78,63,19,34,11,23,61,43,68,
+82,150,254,209,78,5,3,78,8,8,90,74,160,255,255,0,131,4,96,1,117,5,203,18,
+2,7,148,0,0,255,255,0,225,4,217,3,186,5,223,18,2,1,82,0,0,0,3,0,225,4,219,
+3,186,6,231,0,11,0,23,0,43,0,0,0,54,51,50,22,21,20,6,35,34,38,53,36,54,51,
+50,22,21,20,6,35,34,38,53,18,54,55,51,6,6,35,34,38,35,34,6,7,35,54,54,51,
+50,22,51,1,35,53,51,52,53,53,52,45,59,1,133,53,51,52,53,53,52,45,59,127,47,
+8,92,7,112,96,86,191,44,47,46,8,92,7,114,96,86,192,42,5,135,58,60,55,53,62,
+53,62,57,58,60,55,53,62,53,62,1,55,40,58,109,122,98,40,58,111,120,98,255,
+255,0,147,254,20,4,53,6,20,18,34,1,132,0,0,16,35,7,194,1,117,0,0,16,2,7,149,
+37,0,255,255,0,147,254,20,4,53,4,94,18,34,1,132,0,0,16,2,7,149,37,0,255,255,
+0,147,254,20,4,53,6,20,18,34,1,132,0,0,16,35,7,205,1,104,0,0,16,2,7,149,37,
+0,255,255,0,147,254,20,4,53,5,223,18,34,1,132,0,0,16,2,1,82,29,0,255,255,
+0,147,254,20,4,53,5,223,18,34,1,132,0,0,16,34,1,82,29,0,16,2,7,149,37,0,255,
+255,255,175,0,0,5,51,5,183,16,35,0,40,0,141,0,0,16,3,7,194,255,83,255,163,
+255,255,255,175,0,0,5,86,5,183,16,35,0,40,0,176,0,0,16,3,7,205,255,15,255,
+163,255,255,255,175,0,0,6,151,5,183,16,35,0,43,0,141,0,0,16,3,7,194,255,83,
+255,163,255,255,255,175,0,0,6,186,5,183,16,35,0,43,0,176,0,0,16,3,7,205,255,
+15,255,163,255,255,0,78,255,236,9,0,5,182,16,34,0,43,0,0,16,3,1,134,6,88,
+0,0,0,2,0,131,4,96,2,186,5,203,0,9,0,26,0,0,1,35,38,38,39,53,51,22,22,23,
+36,6,7,53,54,54,53,52,38,38,53,52,54,51,50,22,21,2,186,67,61,129,11,184,8,
+45,31,254,187,122,120,67,50,53,45,49,47,56,71,4,123,65,186,44,20,54,158,76,
+81,113,22,62,15,50,31,27,22,31,37,37,51,78,62,0,2,0,152,4,96,2,197,5,203,
+0,9,0,26,0,0,1,54,54,55,51,21,6,6,7,35,38,6,7,53,54,54,53,52,38,38,53,52,
+54,51,50,22,21,1,184,20,53,11,185,10,128,63,68,47,119,122,67,49,53,45,50,
+46,54,73,4,150,46,170,72,20,41,187,67,109,114,22,62,15,50,31,27,22,31,37,
+37,51,73,67,0,2,0,45,4,141,3,6,6,231,0,19,0,35,0,0,0,54,55,51,6,6,35,34,38,
+35,34,6,7,35,54,54,51,50,22,51,2,6,7,53,54,54,53,52,38,53,52,54,51,50,22,
+21,2,115,47,8,92,7,112,96,86,191,44,44,48,9,92,7,114,96,86,192,42,56,122,
+119,65,51,98,50,46,59,68,6,133,40,58,109,122,98,35,63,111,120,98,254,120,
+101,11,62,9,36,26,27,37,43,37,39,70,57,255,255,0,15,255,236,2,168,5,242,18,
+34,1,134,0,0,16,3,1,78,254,224,0,0,255,255,0,5,255,236,2,168,5,103,18,34,
+1,134,0,0,16,3,1,77,255,46,0,0,255,255,255,204,255,236,2,168,6,82,18,34,1,
+134,0,0,16,3,7,192,254,224,0,0,255,255,255,204,255,236,2,168,6,82,18,34,1,
+134,0,0,16,3,7,193,254,224,0,0,255,255,255,193,255,236,2,168,5,223,18,34,
+1,134,0,0,16,3,1,82,254,224,0,0,255,255,255,193,255,236,2,168,6,231,18,34,
+1,134,0,0,16,3,7,152,254,224,0,0,255,255,0,78,0,0,2,162,7,68,18,34,0,44,0,
+0,16,3,1,78,255,42,1,82,255,255,0,78,0,0,2,162,6,185,18,34,0,44,0,0,16,3,
+1,77,255,120,1,82,255,255,255,175,0,0,3,47,5,183,16,35,0,44,0,141,0,0,16,
+3,7,194,255,83,255,163,255,255,255,175,0,0,3,82,5,183,16,35,0,44,0,176,0,
+0,16,3,7,205,255,15,255,163,0,2,0,141,4,96,2,186,5,203,0,9,0,25,0,0,1,35,
+38,38,39,53,51,22,22,23,36,54,51,50,22,21,20,6,21,20,22,23,21,38,38,53,2,
+186,67,61,129,11,184,8,45,31,253,211,71,56,47,50,99,63,54,120,122,4,123,65,
+186,44,20,54,158,76,231,78,51,37,50,35,32,38,47,11,62,21,114,88,0,2,0,141,
+4,96,2,207,5,203,0,9,0,25,0,0,1,54,54,55,51,21,6,6,7,35,0,54,51,50,22,21,
+20,6,21,20,22,23,21,38,38,53,1,195,31,45,8,184,10,128,63,67,254,202,71,56,
+47,50,99,63,54,120,122,4,150,76,158,54,20,41,187,67,1,2,78,51,37,50,35,32,
+38,47,11,62,21,114,88,0,2,0,55,4,141,3,16,6,231,0,15,0,35,0,0,0,54,51,50,
+22,21,20,6,21,20,22,23,21,38,38,53,0,54,55,51,6,6,35,34,38,35,34,6,7,35,54,
+54,51,50,22,51,1,37,68,59,46,50,98,52,65,118,124,1,88,47,8,92,7,112,96,86,
+191,44,47,46,8,92,7,114,96,86,192,42,5,131,70,39,37,43,37,27,26,36,9,62,10,
+102,77,1,59,40,58,109,122,98,40,58,111,120,98,255,255,0,37,255,236,4,78,5,
+242,18,34,1,146,0,0,16,2,1,78,37,0,255,255,0,37,255,236,4,78,5,103,18,34,
+1,146,0,0,16,2,1,77,115,0,255,255,0,37,255,236,4,78,6,82,18,34,1,146,0,0,
+16,2,7,192,37,0,255,255,0,37,255,236,4,78,6,82,18,34,1,146,0,0,16,2,7,193,
+57,0,255,255,0,180,254,20,4,113,6,29,18,34,1,142,0,0,16,3,7,148,1,137,0,82,
+255,255,0,180,254,20,4,113,6,29,18,34,1,142,0,0,16,3,7,206,1,80,0,82,255,
+255,0,37,255,236,4,78,5,223,18,34,1,146,0,0,16,2,1,82,57,0,255,255,0,37,255,
+236,4,78,6,231,18,34,1,146,0,0,16,2,7,152,57,0,255,255,255,246,0,0,5,6,7,
+68,18,34,0,60,0,0,16,3,1,78,0,76,1,82,255,255,255,246,0,0,5,6,6,185,18,34,
+0,60,0,0,16,3,1,77,0,160,1,82,255,255,255,175,0,0,5,229,5,183,16,35,0,60,
+0,223,0,0,16,3,7,194,255,83,255,163,255,255,255,175,0,0,6,29,5,183,16,35,
+0,60,1,23,0,0,16,3,7,205,255,15,255,163,255,255,255,175,0,0,5,24,5,203,16,
+35,0,51,0,147,0,0,16,3,7,206,255,28,0,0,0,3,0,236,5,12,3,178,6,82,0,11,0,
+23,0,33,0,0,18,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,
+34,38,53,7,35,38,38,39,53,51,22,22,23,236,56,40,43,53,58,38,40,56,2,6,56,
+40,43,53,58,38,40,56,70,68,62,127,11,184,7,55,22,5,168,49,55,47,53,50,50,
+53,53,49,55,47,53,50,50,53,88,67,181,42,21,59,174,52,0,3,0,236,5,12,3,178,
+6,82,0,11,0,23,0,33,0,0,18,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,
+21,20,6,35,34,38,53,5,54,54,55,51,21,6,6,7,35,236,56,40,43,53,58,38,40,56,
+2,6,56,40,43,53,58,38,40,56,255,0,37,40,7,184,10,123,68,67,5,168,49,55,47,
+53,50,50,53,53,49,55,47,53,50,50,53,62,94,143,48,21,41,176,73,0,1,0,92,4,
+217,1,104,6,20,0,9,0,0,1,35,38,38,39,53,51,22,22,23,1,104,67,63,128,10,184,
+8,45,31,4,217,67,187,41,20,54,158,76,255,255,0,113,254,45,5,180,6,20,18,34,
+1,150,0,0,16,35,7,194,2,6,0,0,16,3,7,149,2,12,0,0,255,255,0,113,254,45,5,
+180,4,94,18,34,1,150,0,0,16,3,7,149,2,12,0,0,255,255,0,113,254,45,5,180,6,
+20,18,34,1,150,0,0,16,35,7,205,2,20,0,0,16,3,7,149,2,12,0,0,255,255,0,113,
+255,236,5,180,5,223,18,34,1,150,0,0,16,3,1,82,0,197,0,0,255,255,0,113,254,
+45,5,180,5,223,18,34,1,150,0,0,16,35,1,82,0,197,0,0,16,3,7,149,2,12,0,0,255,
+255,255,175,255,236,5,203,5,205,16,34,0,50,80,0,16,3,7,194,255,83,255,163,
+255,255,255,175,255,236,5,162,5,205,16,34,0,50,39,0,16,3,7,205,255,15,255,
+163,255,255,255,175,0,0,6,20,5,205,16,34,1,118,100,0,16,3,7,194,255,83,255,
+163,255,255,255,175,0,0,5,235,5,205,16,34,1,118,59,0,16,3,7,205,255,15,255,
+163,255,255,0,86,255,236,8,174,5,205,16,34,1,118,0,0,16,3,1,134,6,6,0,0,0,
+1,0,160,4,217,1,172,6,20,0,9,0,0,19,54,54,55,51,21,6,6,7,35,160,31,45,8,184,
+11,129,61,67,4,244,76,158,54,20,44,186,65,0,1,0,147,4,96,1,133,5,203,0,15,
+0,0,18,54,51,50,22,21,20,6,21,20,22,23,21,38,38,53,147,71,56,47,50,99,63,
+54,120,122,5,125,78,51,37,50,35,32,38,47,11,62,21,114,88,0,1,255,213,254,
+240,0,43,5,6,0,3,0,0,19,17,35,17,43,86,5,6,249,234,6,22,0,1,255,33,254,240,
+0,223,5,133,0,14,0,0,19,35,17,7,39,55,39,55,23,55,23,7,23,7,39,43,86,127,
+53,168,168,53,170,170,53,168,168,53,127,254,240,5,88,127,55,168,166,55,170,
+170,55,166,168,55,127,0,1,255,215,254,240,1,178,5,133,0,10,0,0,1,7,39,55,
+35,17,35,17,33,39,55,1,178,221,55,131,248,82,1,74,131,55,4,170,219,53,125,
+250,111,5,225,125,55,0,1,254,76,254,240,0,41,5,133,0,10,0,0,19,35,17,35,23,
+7,39,55,23,7,33,41,84,248,133,55,223,223,55,133,1,76,254,240,5,145,125,53,
+219,219,55,125,0,1,0,82,2,178,4,39,3,43,0,3,0,0,1,33,53,33,4,39,252,43,3,
+213,2,178,121,255,255,1,101,254,20,3,19,6,20,16,35,0,95,255,103,0,0,16,3,
+0,95,0,154,0,0,0,2,0,115,3,115,3,92,5,182,0,15,0,31,0,0,0,54,51,50,22,21,
+20,6,21,20,22,23,21,38,38,53,36,54,51,50,22,21,20,6,21,20,22,23,21,38,38,
+53,2,12,89,69,57,76,149,94,100,163,173,254,103,90,67,57,77,150,94,101,163,
+173,5,83,99,62,59,74,71,43,60,92,32,86,48,204,149,82,96,62,59,74,71,43,60,
+92,32,86,48,204,149,0,1,255,215,254,240,1,178,4,209,0,5,0,0,19,17,35,17,33,
+21,43,84,1,219,4,129,250,111,5,225,80,0,1,254,78,254,240,0,41,4,209,0,5,0,
+0,1,53,33,17,35,17,254,78,1,219,84,4,129,80,250,31,5,145,0,1,255,18,254,240,
+0,238,5,131,0,7,0,0,19,35,17,35,17,35,17,33,238,195,86,195,1,220,3,209,251,
+31,4,225,1,178,0,1,255,18,254,240,0,238,5,131,0,11,0,0,19,35,17,35,17,35,
+17,33,21,33,17,33,238,195,86,195,1,220,254,116,1,140,3,209,251,31,4,225,1,
+178,80,254,236,0,1,255,18,254,240,0,238,5,131,0,11,0,0,3,33,17,33,53,33,17,
+35,17,35,17,35,238,1,140,254,116,1,220,195,86,195,4,31,1,20,80,254,78,251,
+31,4,225,255,255,255,246,6,20,3,182,6,141,18,2,0,113,0,0,0,4,0,166,255,236,
+1,168,5,203,0,11,0,23,0,35,0,47,0,0,54,54,51,50,22,21,20,6,35,34,38,53,16,
+54,51,50,22,21,20,6,35,34,38,53,16,54,51,50,22,21,20,6,35,34,38,53,16,54,
+51,50,22,21,20,6,35,34,38,53,166,66,63,62,67,66,63,63,66,66,63,62,67,66,63,
+63,66,66,63,63,66,66,63,64,65,66,63,63,66,66,63,64,65,189,69,70,69,68,71,
+70,69,3,119,69,70,69,68,71,70,69,254,173,69,71,69,66,73,71,68,3,120,69,71,
+69,66,73,71,68,0,1,255,18,254,240,0,238,5,131,0,15,0,0,3,51,17,35,53,33,21,
+35,17,51,21,35,17,35,17,35,238,195,195,1,220,195,195,195,86,195,4,31,1,20,
+80,80,254,236,78,251,31,4,225,0,2,255,18,254,240,0,238,5,131,0,3,0,11,0,0,
+3,33,17,33,3,17,33,17,35,17,35,17,158,1,60,254,196,80,1,220,195,86,4,31,1,
+20,254,158,1,178,254,78,251,31,4,225,0,1,255,16,254,240,0,240,5,131,0,5,0,
+0,19,35,17,3,33,3,43,86,197,1,224,197,254,240,5,36,1,111,254,145,0,1,255,
+16,254,240,0,240,5,137,0,6,0,0,19,17,35,17,35,19,19,43,86,197,240,240,3,209,
+251,31,4,225,1,184,254,72,0,2,255,16,254,240,0,240,5,133,0,6,0,10,0,0,19,
+35,17,39,55,23,7,55,39,7,23,43,86,197,240,240,197,84,127,127,127,254,240,
+5,4,182,219,219,182,182,113,113,113,0,1,255,18,254,240,0,238,5,131,0,13,0,
+0,3,51,17,35,53,33,17,51,21,35,17,35,17,35,238,195,195,1,25,195,195,86,195,
+4,31,1,20,80,254,156,78,251,31,4,225,0,2,0,66,2,53,2,225,5,195,0,11,0,23,
+0,0,0,6,35,34,38,53,52,54,51,50,22,21,4,22,51,50,54,53,52,38,35,34,6,21,2,
+225,173,161,163,174,175,162,160,174,254,27,74,77,76,72,73,75,77,74,3,39,242,
+236,221,224,229,236,217,187,184,181,190,190,177,179,188,0,2,0,96,2,53,2,225,
+5,195,0,26,0,38,0,0,0,6,7,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,21,20,6,35,52,38,35,2,6,7,22,22,51,50,54,53,52,38,35,1,117,83,9,31,85,
+49,133,158,168,141,158,174,199,170,119,125,85,65,48,46,80,85,24,5,76,75,59,
+70,76,65,5,109,148,154,17,24,142,120,138,163,236,223,199,252,78,64,42,60,
+70,88,254,170,32,24,166,174,100,103,96,97,0,2,0,80,2,53,2,209,5,195,0,26,
+0,38,0,0,0,54,55,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,
+51,20,22,51,18,54,55,38,38,35,34,6,21,20,22,51,1,186,84,11,31,86,49,138,153,
+170,139,158,174,201,168,120,123,83,66,48,46,82,83,24,5,76,75,59,70,70,71,
+2,139,142,159,17,24,140,123,138,163,236,223,200,251,78,64,42,60,70,88,1,86,
+32,24,166,174,100,103,103,90,0,2,0,102,255,98,3,96,2,184,0,33,0,43,0,0,0,
+6,21,34,38,53,52,54,51,50,22,21,17,20,22,51,21,35,39,35,6,6,35,34,38,53,52,
+54,55,55,53,52,38,35,2,51,50,54,53,53,7,6,6,21,1,134,62,81,79,151,144,159,
+138,44,60,239,25,8,44,111,79,114,142,181,188,115,65,66,172,110,90,103,99,
+104,100,2,88,66,96,46,59,74,79,127,141,254,121,54,42,84,112,67,60,123,109,
+136,126,6,4,82,105,67,253,125,105,92,110,4,5,80,91,0,2,0,113,255,98,3,43,
+2,184,0,22,0,29,0,0,4,38,53,52,54,51,50,22,21,21,33,22,22,51,50,54,55,22,
+22,21,20,6,35,2,6,7,33,38,38,35,1,58,201,188,172,163,175,253,252,6,109,102,
+64,115,38,17,30,159,128,93,88,11,1,72,5,79,70,158,226,194,217,217,193,175,
+80,150,141,58,55,8,38,22,58,102,2,244,131,121,127,125,0,2,0,113,255,98,3,
+102,2,184,0,11,0,23,0,0,36,6,35,34,38,53,52,54,51,50,22,21,4,22,51,50,54,
+53,52,38,35,34,6,21,3,102,194,187,182,194,194,189,179,195,253,193,89,108,
+100,96,90,109,103,91,54,212,223,206,214,211,219,206,165,169,153,181,163,168,
+157,174,0,1,0,4,255,113,3,147,2,170,0,60,0,0,0,38,35,53,33,21,35,34,6,7,7,
+19,22,22,51,51,21,33,53,51,50,53,52,38,39,39,35,7,6,6,21,20,22,51,21,33,53,
+51,50,54,55,55,39,38,38,35,35,53,33,21,34,6,21,20,23,23,51,55,54,54,53,2,
+80,48,40,1,114,30,47,61,38,155,223,29,49,37,34,254,82,23,78,28,23,91,8,96,
+12,27,47,55,254,113,29,47,72,38,193,193,29,50,41,35,1,162,54,34,28,88,8,68,
+14,21,2,67,19,84,84,42,48,201,254,222,40,36,84,84,39,15,52,31,117,129,17,
+49,24,17,18,84,84,44,48,238,253,40,34,84,84,19,14,22,39,119,96,20,42,14,0,
+2,0,102,255,98,3,33,2,184,0,22,0,29,0,0,0,22,21,20,6,35,34,38,53,53,33,38,
+38,35,34,6,7,38,38,53,52,54,51,18,54,55,33,22,22,51,2,86,203,189,172,159,
+179,2,4,6,108,103,67,115,35,17,30,156,131,94,87,11,254,185,2,79,72,2,184,
+223,196,217,218,190,179,80,150,141,61,52,8,38,22,58,101,253,13,131,121,116,
+136,0,1,0,92,0,0,5,4,5,203,0,55,0,0,37,33,50,54,55,55,51,3,33,53,51,50,54,
+53,17,35,34,38,53,52,18,51,50,22,21,20,6,35,52,38,35,34,6,21,20,22,51,51,
+17,52,38,35,35,53,33,19,35,39,38,38,35,35,17,33,21,33,3,14,1,19,53,65,11,
+4,94,10,252,223,31,63,41,45,223,248,251,226,144,161,87,64,85,73,144,138,143,
+139,43,43,61,31,2,242,8,92,8,7,60,48,238,1,95,254,161,88,62,75,35,254,252,
+76,42,42,1,65,255,231,238,1,22,90,76,47,58,82,97,204,220,199,199,1,13,46,
+44,78,254,249,66,54,52,254,166,88,0,3,0,117,255,137,4,164,6,20,0,44,0,52,
+0,59,0,0,1,22,22,21,20,6,35,52,38,39,3,51,50,54,55,22,22,21,20,6,35,35,7,
+35,55,38,38,39,7,35,19,38,2,53,16,0,55,55,51,7,50,22,23,55,51,1,22,23,19,
+38,38,35,35,0,22,23,19,6,6,21,3,209,106,105,101,77,30,32,186,8,124,180,67,
+17,22,239,198,8,37,98,39,35,65,31,43,98,51,145,156,1,23,253,35,98,34,49,61,
+25,35,98,254,35,54,73,194,20,44,26,43,254,129,54,57,172,143,140,5,78,28,110,
+69,63,80,51,101,38,252,43,84,90,11,38,31,90,139,201,205,5,14,10,234,1,15,
+73,1,45,207,1,13,1,79,35,184,176,3,3,182,250,254,33,16,4,8,7,8,253,109,198,
+69,3,139,38,249,231,0,1,0,117,255,236,4,164,5,203,0,53,0,0,0,22,21,20,6,35,
+52,38,35,34,2,17,20,18,23,17,52,38,35,53,33,23,51,54,54,51,50,22,21,20,6,
+35,52,38,35,34,6,21,17,54,54,55,22,22,21,20,6,35,32,0,17,16,0,33,3,203,217,
+101,77,127,113,217,209,142,137,55,76,1,12,20,8,51,107,68,80,86,87,87,32,38,
+63,72,110,164,66,17,22,241,200,254,218,254,184,1,92,1,53,5,203,126,104,63,
+80,119,145,254,202,254,181,243,254,212,51,2,80,47,45,84,141,98,58,62,59,57,
+62,64,55,184,125,254,135,5,82,87,11,38,31,91,138,1,146,1,95,1,92,1,146,0,
+1,0,57,255,31,7,86,5,84,0,66,0,0,33,33,53,51,50,54,53,17,52,38,35,35,53,33,
+23,51,54,54,51,50,22,23,19,51,3,54,54,51,50,22,21,17,20,22,51,51,21,33,17,
+52,38,35,34,6,21,17,20,22,51,51,21,33,17,3,35,1,53,52,38,35,34,6,21,17,20,
+22,51,2,66,253,247,27,93,65,67,89,8,1,65,27,10,53,138,118,102,146,39,172,
+111,119,42,93,49,164,170,63,93,8,254,156,104,111,111,117,63,93,8,254,156,
+232,110,1,86,104,111,116,122,53,91,86,72,75,2,127,73,67,86,166,98,88,82,84,
+1,156,254,227,22,17,201,200,254,28,75,72,86,2,195,144,136,158,147,254,63,
+75,72,86,1,76,253,211,3,55,109,144,136,173,159,254,80,76,61,0,5,0,20,0,0,
+5,57,5,182,0,52,0,56,0,60,0,63,0,66,0,0,1,21,51,21,35,17,35,1,33,17,20,22,
+51,51,21,33,53,51,50,54,53,17,35,53,51,53,35,53,51,17,52,38,35,35,53,33,1,
+33,17,52,38,35,35,53,33,21,35,34,6,21,17,51,21,5,51,53,35,5,51,39,35,1,53,
+35,1,51,39,4,82,231,231,156,254,215,254,226,69,96,9,254,49,8,95,71,232,232,
+232,232,69,97,8,1,88,1,18,1,39,69,97,8,1,207,8,96,70,231,253,250,172,246,
+254,134,237,72,165,2,112,123,254,11,116,116,3,55,143,96,253,184,2,72,254,
+161,73,74,86,86,72,75,1,95,96,143,97,1,61,67,72,86,253,226,1,61,67,72,86,
+86,73,74,254,203,97,143,143,143,143,254,29,244,1,80,229,0,3,0,78,255,236,
+7,209,5,182,0,36,0,45,0,85,0,0,37,22,22,51,51,21,35,34,38,39,3,35,17,20,22,
+51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,32,4,21,20,6,7,37,51,50,54,
+53,52,38,35,35,0,38,53,52,54,51,20,22,51,50,54,53,52,38,36,38,53,52,54,51,
+50,22,21,20,6,35,52,38,35,34,6,21,20,30,2,21,20,6,35,4,29,54,82,58,8,10,189,
+138,66,236,137,71,97,27,253,172,35,97,71,71,97,35,1,254,1,9,1,5,157,144,254,
+178,111,167,146,144,173,107,3,188,175,75,54,113,108,106,119,125,254,210,134,
+207,178,136,163,76,72,85,91,98,96,177,232,152,212,192,250,98,66,86,57,127,
+1,205,254,90,69,68,86,86,68,69,3,246,68,71,86,197,198,135,190,48,47,146,174,
+165,138,250,152,115,102,67,74,129,131,102,84,83,87,129,141,123,136,153,105,
+83,56,67,103,114,87,77,93,95,93,144,132,151,170,0,7,0,18,0,0,8,78,5,182,0,
+57,0,61,0,65,0,74,0,83,0,87,0,90,0,0,1,7,33,21,33,3,35,3,33,3,35,3,33,53,
+33,39,33,53,33,3,38,38,35,35,53,33,21,35,34,6,21,20,22,23,19,33,19,51,19,
+33,55,54,54,53,52,38,35,35,53,33,21,35,34,6,7,3,33,21,5,51,55,33,5,51,55,
+33,1,54,54,55,55,35,23,22,22,5,54,54,55,55,35,23,22,22,19,33,39,35,55,51,
+39,7,27,41,1,90,254,139,166,184,170,254,194,159,189,172,254,139,1,89,43,254,
+210,1,17,103,20,63,62,27,2,52,47,62,61,10,6,80,1,121,147,148,151,1,127,72,
+11,11,66,69,47,1,244,39,70,60,26,84,1,21,253,45,246,41,254,184,252,242,241,
+39,254,191,3,219,15,39,28,12,188,6,29,45,252,219,15,41,27,5,189,12,31,41,
+252,1,6,41,182,27,127,66,3,55,143,96,253,184,2,72,253,184,2,72,96,143,97,
+1,92,63,45,86,86,47,51,17,36,23,254,230,2,16,253,240,249,42,54,11,53,47,86,
+86,72,87,254,215,97,143,143,143,143,253,146,74,163,99,47,23,102,187,71,80,
+189,99,15,37,91,181,1,149,143,97,227,0,1,0,20,0,0,5,66,5,182,0,60,0,0,19,
+33,17,52,38,35,35,53,33,21,35,34,6,21,17,51,1,54,54,53,52,38,35,53,33,21,
+34,6,7,1,23,33,21,33,1,22,22,51,51,21,35,34,38,38,39,1,35,17,20,22,51,51,
+21,33,53,51,50,54,53,17,33,20,1,7,71,97,27,2,74,27,97,71,43,1,23,52,60,48,
+52,1,186,53,112,109,254,215,23,1,231,254,98,1,80,59,105,57,9,23,154,127,77,
+62,254,146,58,71,97,27,253,182,27,97,71,254,249,3,51,1,162,68,71,86,86,74,
+73,254,102,1,62,58,101,37,26,19,84,84,70,122,254,178,33,102,254,45,81,83,
+86,34,62,88,2,21,254,28,73,74,86,86,68,69,1,238,0,1,0,37,0,0,4,104,5,182,
+0,43,0,0,1,37,23,5,21,37,23,5,17,20,22,51,51,21,33,53,51,50,54,53,53,5,39,
+37,53,5,39,37,17,35,34,6,7,7,35,19,33,19,35,39,38,38,35,35,2,168,1,14,39,
+254,203,1,14,39,254,203,71,97,47,253,139,47,97,71,254,248,41,1,49,254,248,
+41,1,49,159,73,85,10,11,106,10,4,47,10,106,10,10,83,77,162,3,137,123,88,139,
+203,123,88,139,254,251,73,74,86,86,68,69,191,119,88,137,201,119,88,137,2,
+21,72,88,76,1,82,254,174,76,84,76,0,6,0,41,254,104,7,238,6,115,0,18,0,56,
+0,68,0,80,0,90,0,91,0,0,36,6,35,34,39,3,6,7,35,54,54,55,19,54,54,51,50,22,
+21,0,38,39,6,6,35,34,38,53,52,54,51,50,22,23,55,18,18,55,6,6,7,53,54,37,55,
+54,55,23,6,7,22,0,17,20,2,4,35,0,38,35,34,6,21,20,22,51,50,54,53,1,6,2,7,
+22,51,50,54,18,53,52,2,1,38,35,34,6,21,20,22,51,50,19,7,238,175,143,106,86,
+58,37,30,178,26,48,12,112,35,156,127,129,168,250,205,160,76,37,129,76,88,
+92,100,80,39,86,29,33,60,133,89,125,235,68,187,1,51,37,79,127,48,76,78,227,
+1,21,162,254,244,164,4,53,84,72,75,93,89,69,73,93,252,0,118,180,50,135,139,
+119,199,119,195,253,102,63,74,43,59,55,45,113,212,168,172,78,254,254,162,
+62,57,156,41,1,197,147,140,156,121,254,203,79,68,69,78,84,80,69,89,23,18,
+174,1,114,1,172,113,6,49,37,65,93,2,41,88,88,27,76,114,6,254,158,254,226,
+215,254,138,199,1,127,113,115,94,98,115,118,95,4,55,194,252,185,124,123,195,
+1,96,188,248,1,41,251,125,41,41,49,49,45,5,115,0,2,255,240,254,20,3,252,5,
+205,0,38,0,49,0,0,4,2,39,11,2,35,1,19,19,38,2,53,52,54,51,50,22,21,20,3,18,
+18,21,20,6,35,34,38,53,52,54,51,20,22,51,50,54,53,18,38,35,34,21,20,18,23,
+54,54,53,3,82,95,93,242,170,166,100,1,39,182,149,83,76,149,145,136,139,227,
+120,103,189,159,145,163,76,53,98,91,92,80,51,79,64,142,72,53,80,80,151,1,
+43,219,254,120,1,70,254,211,2,31,254,188,1,6,195,1,58,118,187,190,156,141,
+251,254,148,254,240,254,191,117,169,186,114,104,66,75,128,124,91,83,5,205,
+104,192,93,254,223,116,137,243,103,0,4,0,20,0,0,4,193,5,182,0,44,0,50,0,59,
+0,65,0,0,19,53,35,53,51,53,52,38,35,35,53,33,50,22,23,51,21,35,22,22,21,20,
+7,51,21,35,6,4,35,35,17,20,22,51,51,21,33,53,51,50,54,53,17,35,53,1,50,54,
+55,33,21,0,38,39,33,21,33,54,54,53,37,33,38,38,35,35,252,232,232,64,94,26,
+2,22,202,238,41,134,115,2,2,6,117,142,52,254,249,203,98,71,97,67,253,142,
+26,93,65,232,2,5,137,157,31,254,109,1,170,2,2,254,90,1,166,2,2,254,86,1,147,
+28,142,125,108,3,182,144,96,47,69,70,86,143,129,96,16,28,16,44,40,96,140,
+145,254,166,69,68,86,86,72,75,2,109,96,254,228,88,100,188,1,123,32,17,144,
+17,39,20,164,88,86,0,3,0,117,255,94,5,143,6,20,0,31,0,38,0,48,0,0,5,53,36,
+0,17,16,0,37,53,51,21,22,22,21,20,6,35,52,38,39,17,33,21,35,34,6,21,17,6,
+6,7,21,0,18,23,17,6,2,17,5,17,51,50,54,55,17,52,38,35,2,231,254,213,254,185,
+1,74,1,40,103,218,222,107,83,133,117,2,65,8,82,59,98,207,123,254,10,196,203,
+205,194,1,246,8,59,111,43,75,93,162,146,21,1,133,1,83,1,70,1,137,27,77,73,
+4,127,99,62,81,114,143,7,253,70,86,74,74,254,144,47,44,3,142,2,87,254,209,
+30,4,240,25,254,201,254,213,143,254,18,12,13,1,74,71,68,0,3,0,0,0,0,5,164,
+5,182,0,48,0,52,0,61,0,0,1,7,6,6,21,20,22,51,51,21,33,53,51,50,54,55,55,33,
+53,33,55,33,53,33,19,51,19,33,21,33,23,33,21,33,19,22,22,51,51,21,33,53,51,
+50,53,52,38,39,39,3,33,7,33,1,51,39,38,38,39,6,6,7,1,158,78,9,10,67,69,47,
+254,12,39,63,56,37,92,254,245,1,46,79,254,131,1,162,211,160,205,1,153,254,
+138,79,1,39,254,252,109,25,60,60,27,253,205,47,123,9,8,82,112,254,202,79,
+1,211,254,159,242,19,32,53,17,13,37,44,1,236,218,24,47,17,52,48,86,86,65,
+95,246,96,215,96,2,51,253,205,96,215,96,254,215,67,42,86,86,98,17,36,23,232,
+1,55,215,1,55,51,91,159,74,61,127,117,0,1,0,20,255,236,4,70,5,203,0,59,0,
+0,19,54,36,55,33,53,33,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,
+21,20,7,51,21,35,6,6,7,7,33,21,33,6,6,21,20,22,51,50,54,55,22,22,21,20,6,
+35,34,38,53,52,54,55,35,53,199,79,1,20,42,253,192,2,205,35,31,123,115,116,
+125,75,87,223,180,203,225,24,125,174,47,150,107,45,2,11,253,71,54,44,147,
+146,131,206,62,17,22,247,199,239,241,15,14,113,2,127,85,120,20,97,37,89,60,
+104,129,148,122,67,66,99,141,200,171,84,67,97,65,98,44,18,96,42,97,66,117,
+115,100,83,11,38,31,92,137,205,206,44,74,34,96,0,2,0,117,255,94,4,164,6,20,
+0,30,0,37,0,0,5,53,36,0,17,16,0,37,53,51,21,22,22,21,20,6,35,52,38,39,17,
+54,54,55,22,22,21,20,6,7,21,0,18,23,17,6,2,17,2,190,254,235,254,204,1,53,
+1,20,103,180,203,101,77,105,100,107,161,68,17,22,202,173,254,51,183,175,183,
+175,162,144,13,1,142,1,84,1,70,1,141,23,77,75,4,123,101,63,80,105,145,12,
+251,23,6,79,89,11,38,31,82,134,11,144,2,108,254,197,24,4,227,22,254,201,254,
+208,0,1,0,121,0,0,4,61,5,182,0,34,0,0,1,6,6,7,19,22,22,51,51,21,35,34,38,
+39,1,53,51,50,54,55,33,53,33,38,38,35,35,53,33,21,33,22,23,51,21,3,88,16,
+242,221,235,50,100,65,27,49,189,144,69,254,230,170,182,155,9,253,252,2,4,
+10,146,159,201,3,196,254,160,113,12,227,3,250,177,181,9,254,111,84,80,86,
+61,123,1,250,58,124,146,96,138,114,96,96,88,164,96,0,1,254,29,3,82,1,227,
+6,246,0,17,0,0,1,55,5,3,51,3,37,23,5,5,7,37,19,35,19,5,39,37,254,29,86,1,
+100,63,210,67,1,102,86,254,119,1,137,86,254,154,67,210,61,254,158,86,1,135,
+5,158,192,235,1,131,254,127,229,190,119,121,188,227,254,127,1,129,231,190,
+123,0,4,0,113,255,236,6,82,5,205,0,15,0,31,0,57,0,66,0,0,18,18,36,51,50,4,
+18,21,20,2,4,35,34,36,2,53,22,18,4,51,50,36,18,53,52,2,36,35,34,4,2,21,5,
+21,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,50,22,21,20,6,35,
+39,51,50,54,53,52,38,35,35,113,201,1,93,201,202,1,94,202,199,254,163,206,
+205,254,163,197,112,172,1,41,170,172,1,41,172,170,254,213,172,171,254,214,
+170,2,45,44,57,69,254,62,26,56,45,45,56,26,1,153,178,175,161,171,150,127,
+104,89,88,111,121,3,164,1,95,202,202,254,162,202,199,254,165,205,205,1,92,
+198,170,254,215,172,171,1,42,170,169,1,43,173,173,254,213,169,102,209,33,
+29,69,69,34,38,2,88,38,34,72,134,133,139,139,78,89,111,100,87,0,4,0,25,255,
+236,5,207,5,182,0,37,0,41,0,73,0,82,0,0,4,38,53,52,54,51,22,22,51,50,54,53,
+52,36,38,53,52,54,51,50,22,21,20,6,35,52,38,35,34,6,21,20,4,22,21,20,6,35,
+37,35,1,51,1,6,6,21,20,51,51,21,33,53,51,50,54,55,19,51,19,22,22,51,51,21,
+33,53,51,50,53,52,38,39,39,35,55,38,38,39,6,6,7,7,51,4,72,138,61,60,5,74,
+54,59,72,254,242,92,148,108,97,124,68,59,53,45,47,62,1,4,103,151,132,253,
+125,125,2,230,122,251,187,6,8,47,45,254,252,20,18,20,17,226,106,223,10,21,
+23,12,254,215,45,41,5,3,31,238,154,8,18,5,5,17,6,60,172,20,83,66,35,47,75,
+75,58,47,75,77,111,83,84,109,73,50,39,39,47,67,55,37,80,75,107,74,97,113,
+20,5,182,253,232,16,25,8,29,70,70,20,43,2,39,253,193,23,16,70,70,29,2,18,
+8,90,230,20,57,25,20,51,17,164,0,1,0,86,0,0,3,143,4,74,0,29,0,0,37,17,33,
+53,33,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,51,21,33,3,51,23,22,
+22,51,2,63,254,134,1,122,48,64,68,2,4,34,65,48,51,62,34,252,207,8,104,5,3,
+61,65,98,1,158,94,1,53,49,50,84,84,43,49,253,22,48,44,84,1,29,72,50,65,255,
+255,0,21,255,240,6,117,5,193,16,35,2,21,3,2,0,0,16,34,0,123,191,0,16,3,0,
+117,3,166,253,179,255,255,0,36,255,240,6,117,5,203,16,35,2,21,3,33,0,0,16,
+34,0,116,206,0,16,3,0,117,3,166,253,179,255,255,0,72,255,236,3,127,4,94,18,
+2,4,65,0,0,0,1,1,162,0,100,6,94,2,68,0,13,0,0,1,22,23,35,38,39,53,54,55,51,
+6,7,33,21,2,129,57,62,72,127,143,143,127,72,62,57,3,221,1,41,68,129,150,72,
+36,72,150,129,68,86,0,1,1,16,255,195,2,240,4,127,0,13,0,0,1,6,7,53,54,55,
+51,22,23,21,38,39,17,35,1,213,68,129,150,72,36,72,150,129,68,86,3,160,58,
+61,72,127,143,143,127,72,61,58,252,35,0,1,1,162,0,100,6,94,2,68,0,13,0,0,
+1,38,39,51,22,23,21,6,7,35,54,55,33,53,5,127,57,62,72,127,143,143,127,72,
+62,57,252,35,1,127,68,129,150,72,36,72,150,129,68,86,0,1,1,16,255,195,2,240,
+4,127,0,13,0,0,37,54,55,21,6,7,35,38,39,53,22,23,17,51,2,43,68,129,150,72,
+36,72,150,129,68,86,162,57,62,72,127,143,143,127,72,62,57,3,221,0,1,1,162,
+0,100,6,94,2,68,0,23,0,0,1,22,23,35,38,39,53,54,55,51,6,7,33,38,39,51,22,
+23,21,6,7,35,54,55,2,129,57,62,72,127,143,143,127,72,62,57,2,254,57,62,72,
+127,143,143,127,72,62,57,1,41,68,129,150,72,36,72,150,129,68,68,129,150,72,
+36,72,150,129,68,0,1,1,16,255,195,2,240,4,127,0,23,0,0,1,6,7,53,54,55,51,
+22,23,21,38,39,17,54,55,21,6,7,35,38,39,53,22,23,1,213,68,129,150,72,36,72,
+150,129,68,68,129,150,72,36,72,150,129,68,3,160,58,61,72,127,143,143,127,
+72,61,58,253,2,57,62,72,127,143,143,127,72,62,57,0,2,1,16,255,72,2,240,4,
+127,0,3,0,27,0,0,5,33,21,33,19,6,7,53,54,55,51,22,23,21,38,39,17,54,55,21,
+6,7,35,38,39,53,22,23,1,16,1,224,254,32,197,68,129,150,72,36,72,150,129,68,
+68,129,150,72,36,72,150,129,68,104,80,4,88,58,61,72,127,143,143,127,72,61,
+58,253,2,57,62,72,127,143,143,127,72,62,57,255,255,254,143,0,0,1,240,5,182,
+18,2,2,21,0,0,255,255,0,166,2,78,1,168,3,100,16,2,0,121,39,0,0,1,1,152,0,
+0,6,96,4,199,0,5,0,0,1,51,17,33,21,33,1,152,94,4,106,251,56,4,199,251,151,
+94,0,1,1,23,255,254,4,170,4,8,0,19,0,0,5,17,52,54,54,51,50,22,22,21,17,35,
+17,52,38,35,34,6,21,17,1,23,114,209,131,131,211,119,102,197,160,162,192,2,
+2,0,149,240,133,133,242,147,254,0,2,2,190,228,225,195,254,0,0,3,0,100,0,244,
+4,72,4,80,0,3,0,7,0,11,0,0,19,53,33,21,1,53,33,21,1,53,33,21,100,3,228,252,
+28,3,228,252,28,3,228,3,188,148,148,253,56,147,147,1,100,148,148,0,2,0,158,
+0,0,4,55,4,129,0,4,0,9,0,0,51,17,1,1,17,37,33,17,1,1,158,1,204,1,205,252,
+183,2,249,254,131,254,132,2,123,2,6,253,250,253,133,82,2,6,1,170,254,86,0,
+1,0,100,0,180,4,72,2,242,0,5,0,0,55,17,33,21,33,17,100,3,228,252,174,180,
+2,62,146,254,84,0,1,2,35,254,20,3,211,6,170,0,21,0,0,1,35,17,52,54,51,50,
+22,21,20,6,35,34,39,38,39,38,35,34,7,6,21,2,180,145,168,125,63,76,51,37,31,
+12,17,38,33,17,34,11,6,254,20,6,220,196,246,64,47,41,51,10,9,41,39,39,35,
+105,0,1,1,4,254,20,2,180,6,170,0,20,0,0,1,51,17,20,6,35,34,38,53,52,54,51,
+50,23,22,23,22,51,50,54,53,2,35,145,162,133,57,80,51,35,35,25,10,30,31,17,
+28,25,6,170,249,35,195,246,62,47,39,53,16,4,41,37,51,127,0,1,255,246,2,166,
+5,180,3,55,0,3,0,0,3,53,33,21,10,5,190,2,166,145,145,0,1,1,215,254,20,2,104,
+7,201,0,3,0,0,1,51,17,35,1,215,145,145,7,201,246,75,0,1,2,141,254,20,5,180,
+3,55,0,5,0,0,1,33,21,33,17,35,2,141,3,39,253,107,146,3,55,145,251,110,0,1,
+255,246,254,20,3,31,3,55,0,5,0,0,3,53,33,17,35,17,10,3,41,146,2,166,145,250,
+221,4,146,0,1,2,141,2,166,5,180,7,201,0,5,0,0,1,51,17,33,21,33,2,141,146,
+2,149,252,217,7,201,251,110,145,0,1,255,246,2,166,3,31,7,201,0,5,0,0,3,53,
+33,17,51,17,10,2,151,146,2,166,145,4,146,250,221,0,1,2,141,254,20,5,180,7,
+201,0,7,0,0,1,51,17,33,21,33,17,35,2,141,146,2,149,253,107,146,7,201,251,
+110,145,251,110,0,1,255,246,254,20,3,31,7,201,0,7,0,0,3,53,33,17,51,17,35,
+17,10,2,151,146,146,2,166,145,4,146,246,75,4,146,0,1,255,246,254,20,5,180,
+3,55,0,7,0,0,3,53,33,21,33,17,35,17,10,5,190,253,107,146,2,166,145,145,251,
+110,4,146,0,1,255,246,2,166,5,180,7,201,0,7,0,0,3,53,33,17,51,17,33,21,10,
+2,151,146,2,149,2,166,145,4,146,251,110,145,0,1,255,246,254,20,5,180,7,201,
+0,11,0,0,3,53,33,17,51,17,33,21,33,17,35,17,10,2,151,146,2,149,253,107,146,
+2,166,145,4,146,251,110,145,251,110,4,146,0,2,255,246,1,242,5,180,3,236,0,
+3,0,7,0,0,3,53,33,21,1,53,33,21,10,5,190,250,66,5,190,3,90,146,146,254,152,
+145,145,0,2,1,217,254,20,3,211,7,201,0,3,0,7,0,0,1,51,17,35,1,51,17,35,1,
+217,145,145,1,105,145,145,7,201,246,75,9,181,246,75,0,1,2,141,254,20,5,180,
+3,236,0,9,0,0,1,33,21,33,21,33,21,33,17,35,2,141,3,39,253,107,2,149,253,107,
+146,3,236,146,215,145,252,34,0,1,1,217,254,20,5,180,3,55,0,9,0,0,1,21,33,
+17,35,17,35,17,35,17,5,180,254,31,145,216,145,3,55,145,251,110,4,146,251,
+110,5,35,0,2,1,217,254,20,5,180,3,236,0,5,0,11,0,0,1,33,21,33,17,35,1,33,
+21,33,17,35,1,217,3,219,252,182,145,1,105,2,114,254,31,145,3,236,146,250,
+186,4,111,145,252,34,0,1,255,246,254,20,3,31,3,236,0,9,0,0,3,53,33,53,33,
+53,33,17,35,17,10,2,151,253,105,3,41,146,1,242,145,215,146,250,40,3,222,0,
+1,255,246,254,20,3,211,3,55,0,9,0,0,3,53,33,17,35,17,35,17,35,17,10,3,221,
+145,216,145,2,166,145,250,221,4,146,251,110,4,146,0,2,255,246,254,20,3,211,
+3,236,0,5,0,11,0,0,1,17,35,17,33,53,1,35,17,33,53,33,3,211,145,252,180,2,
+116,145,254,29,2,116,3,236,250,40,5,70,146,250,40,3,222,145,0,1,2,141,1,242,
+5,180,7,201,0,9,0,0,1,51,17,33,21,33,21,33,21,33,2,141,146,2,149,253,107,
+2,149,252,217,7,201,252,35,146,215,145,0,1,1,217,2,166,5,180,7,201,0,9,0,
+0,1,51,17,33,21,33,17,51,17,51,3,66,145,1,225,252,37,145,216,7,201,251,110,
+145,5,35,251,110,0,2,1,217,1,242,5,180,7,201,0,5,0,11,0,0,1,51,17,33,21,33,
+1,51,17,33,21,33,1,217,145,3,74,252,37,1,105,145,1,225,253,142,7,201,250,
+186,145,5,215,252,35,146,0,1,255,246,1,242,3,31,7,201,0,9,0,0,3,53,33,53,
+33,53,33,17,51,17,10,2,151,253,105,2,151,146,1,242,145,215,146,3,221,250,
+41,0,1,255,246,2,166,3,211,7,201,0,9,0,0,1,33,53,33,17,51,17,51,17,51,3,211,
+252,35,1,227,145,216,145,2,166,145,4,146,251,110,4,146,0,2,255,246,1,242,
+3,211,7,201,0,5,0,11,0,0,1,33,53,33,17,51,33,51,17,33,53,33,3,211,252,35,
+3,76,145,254,6,145,253,140,1,227,1,242,145,5,70,251,145,146,0,1,2,141,254,
+20,5,180,7,201,0,11,0,0,1,51,17,33,21,33,21,33,21,33,17,35,2,141,146,2,149,
+253,107,2,149,253,107,146,7,201,252,35,146,215,145,252,34,0,2,1,217,254,20,
+5,180,7,201,0,7,0,11,0,0,1,51,17,33,21,33,17,35,1,51,17,35,3,66,145,1,225,
+254,31,145,254,151,145,145,7,201,251,110,145,251,110,9,181,246,75,0,3,1,217,
+254,20,5,180,7,201,0,3,0,9,0,15,0,0,1,35,17,51,19,33,21,33,17,35,17,51,17,
+33,21,33,2,106,145,145,216,2,114,254,31,145,145,1,225,253,142,254,20,9,181,
+250,186,145,252,34,9,181,252,35,146,0,1,255,246,254,20,3,31,7,201,0,11,0,
+0,3,53,33,53,33,53,33,17,51,17,35,17,10,2,151,253,105,2,151,146,146,1,242,
+145,215,146,3,221,246,75,3,222,0,2,255,246,254,20,3,211,7,201,0,7,0,11,0,
+0,3,53,33,17,51,17,35,17,1,51,17,35,10,1,227,145,145,1,105,145,145,2,166,
+145,4,146,246,75,4,146,5,35,246,75,0,3,255,246,254,20,3,211,7,201,0,3,0,9,
+0,15,0,0,1,51,17,35,1,51,17,33,53,33,19,35,17,33,53,33,3,66,145,145,254,151,
+145,253,140,1,227,145,145,254,29,2,116,7,201,246,75,9,181,251,145,146,250,
+40,3,222,145,0,2,255,246,254,20,5,180,3,236,0,7,0,11,0,0,3,53,33,21,33,17,
+35,17,1,53,33,21,10,5,190,253,107,146,253,105,5,190,1,242,145,145,252,34,
+3,222,1,104,146,146,0,1,255,246,254,20,5,180,3,55,0,11,0,0,3,53,33,21,33,
+17,35,17,35,17,35,17,10,5,190,254,31,145,216,145,2,166,145,145,251,110,4,
+146,251,110,4,146,0,3,255,246,254,20,5,180,3,236,0,5,0,11,0,15,0,0,1,35,17,
+33,53,33,51,33,21,33,17,35,1,21,33,53,2,106,145,254,29,2,116,216,2,114,254,
+31,145,2,114,250,66,254,20,3,222,145,145,252,34,5,216,146,146,0,2,255,246,
+1,242,5,180,7,201,0,7,0,11,0,0,3,53,33,17,51,17,33,21,1,53,33,21,10,2,151,
+146,2,149,250,66,5,190,3,90,146,3,221,252,35,146,254,152,145,145,0,1,255,
+246,2,166,5,180,7,201,0,11,0,0,3,53,33,17,51,17,51,17,51,17,33,21,10,1,227,
+145,216,145,1,225,2,166,145,4,146,251,110,4,146,251,110,145,0,3,255,246,1,
+242,5,180,7,201,0,5,0,11,0,15,0,0,1,51,17,33,21,33,1,51,17,33,53,33,1,53,
+33,21,3,66,145,1,225,253,142,254,151,145,253,140,1,227,254,29,5,190,7,201,
+252,35,146,4,111,251,145,146,254,6,145,145,0,1,255,246,254,20,5,180,7,201,
+0,19,0,0,3,53,33,53,33,53,33,17,51,17,33,21,33,21,33,21,33,17,35,17,10,2,
+151,253,105,2,151,146,2,149,253,107,2,149,253,107,146,1,242,145,215,146,3,
+221,252,35,146,215,145,252,34,3,222,0,1,255,246,254,20,5,180,7,201,0,19,0,
+0,1,51,17,33,21,33,17,35,17,35,17,35,17,33,53,33,17,51,17,51,3,66,145,1,225,
+254,31,145,216,145,254,29,1,227,145,216,7,201,251,110,145,251,110,4,146,251,
+110,4,146,145,4,146,251,110,0,4,255,246,254,20,5,180,7,201,0,5,0,11,0,17,
+0,23,0,0,1,51,17,33,21,33,3,35,17,33,53,33,51,33,21,33,17,35,1,51,17,33,53,
+33,3,66,145,1,225,253,142,216,145,254,29,2,116,216,2,114,254,31,145,254,151,
+145,253,140,1,227,7,201,252,35,146,250,186,3,222,145,145,252,34,9,181,251,
+145,146,0,1,0,0,2,238,5,170,7,201,0,3,0,0,1,33,17,33,5,170,250,86,5,170,2,
+238,4,219,0,1,0,0,254,20,5,170,2,238,0,3,0,0,1,33,17,33,5,170,250,86,5,170,
+254,20,4,218,0,1,0,0,254,20,5,170,7,201,0,3,0,0,1,33,17,33,5,170,250,86,5,
+170,254,20,9,181,0,1,0,0,254,20,2,213,7,201,0,3,0,0,1,33,17,33,2,213,253,
+43,2,213,254,20,9,181,0,1,2,213,254,20,5,170,7,201,0,3,0,0,1,33,17,33,5,170,
+253,43,2,213,254,20,9,181,0,42,0,102,254,119,5,170,7,37,0,3,0,7,0,11,0,15,
+0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,
+0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,119,0,123,0,127,0,
+131,0,135,0,139,0,143,0,147,0,151,0,155,0,159,0,163,0,167,0,0,19,51,21,35,
+37,51,21,35,37,51,21,35,5,51,21,35,37,51,21,35,37,51,21,35,7,51,21,35,37,
+51,21,35,37,51,21,35,5,51,21,35,37,51,21,35,37,51,21,35,7,51,21,35,37,51,
+21,35,37,51,21,35,23,51,21,35,37,51,21,35,37,51,21,35,7,51,21,35,37,51,21,
+35,37,51,21,35,5,51,21,35,37,51,21,35,37,51,21,35,7,51,21,35,37,51,21,35,
+37,51,21,35,23,51,21,35,37,51,21,35,37,51,21,35,1,51,21,35,37,51,21,35,37,
+51,21,35,1,51,21,35,37,51,21,35,37,51,21,35,1,51,21,35,17,51,21,35,17,51,
+21,35,17,51,21,35,17,51,21,35,17,51,21,35,102,105,105,1,158,105,105,1,162,
+102,102,253,143,105,105,1,160,104,104,1,160,102,102,207,102,102,254,94,105,
+105,254,98,105,105,4,15,102,102,254,96,104,104,254,96,105,105,207,105,105,
+1,158,105,105,1,162,102,102,207,102,102,254,96,104,104,254,96,105,105,207,
+105,105,1,158,105,105,1,162,102,102,253,143,105,105,1,160,104,104,1,160,102,
+102,207,102,102,254,94,105,105,254,98,105,105,207,105,105,1,160,104,104,1,
+160,102,102,252,192,105,105,1,160,104,104,1,160,102,102,251,241,105,105,1,
+158,105,105,1,162,102,102,1,158,102,102,102,102,102,102,102,102,102,102,102,
+102,5,164,98,98,98,98,98,99,94,94,94,94,94,96,96,96,96,96,96,101,94,94,94,
+94,94,96,97,97,97,97,97,100,94,94,94,94,94,96,99,99,99,99,99,98,92,92,92,
+92,92,98,99,99,99,99,99,94,96,96,96,96,96,7,235,98,98,98,98,98,1,37,96,96,
+96,96,96,254,223,98,254,223,96,254,221,97,254,222,99,254,224,99,7,240,96,
+0,84,0,0,254,119,5,170,7,37,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,
+39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,
+0,99,0,103,0,107,0,111,0,115,0,119,0,123,0,127,0,131,0,135,0,139,0,143,0,
+147,0,151,0,155,0,159,0,163,0,167,0,171,0,175,0,179,0,183,0,187,0,191,0,195,
+0,199,0,203,0,207,0,211,0,215,0,219,0,223,0,227,0,231,0,235,0,239,0,243,0,
+247,0,251,0,255,1,3,1,7,1,11,1,15,1,19,1,23,1,27,1,31,1,35,1,39,1,43,1,47,
+1,51,1,55,1,59,1,63,1,67,1,71,1,75,1,79,0,0,19,51,21,35,55,51,21,35,55,51,
+21,35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,51,21,
+35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,51,21,35,
+55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,51,21,35,55,
+51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,51,21,35,55,51,
+21,35,55,51,21,35,55,51,21,35,5,51,21,35,37,51,21,35,55,51,21,35,55,51,21,
+35,55,51,21,35,37,51,21,35,5,51,21,35,39,51,21,35,39,51,21,35,39,51,21,35,
+39,51,21,35,39,51,21,35,7,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,
+51,21,35,55,51,21,35,23,51,21,35,39,51,21,35,39,51,21,35,39,51,21,35,39,51,
+21,35,39,51,21,35,7,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,
+35,55,51,21,35,1,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,
+55,51,21,35,1,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,
+51,21,35,19,51,21,35,7,51,21,35,23,51,21,35,7,51,21,35,23,51,21,35,7,51,21,
+35,23,51,21,35,7,51,21,35,23,51,21,35,7,51,21,35,17,51,21,35,19,51,21,35,
+102,105,105,207,105,105,207,105,105,209,104,104,209,102,102,207,102,102,251,
+139,102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,105,105,252,
+90,105,105,207,105,105,207,105,105,209,104,104,209,102,102,207,102,102,251,
+139,102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,105,105,252,
+90,105,105,207,105,105,207,105,105,209,104,104,209,102,102,207,102,102,251,
+139,102,102,1,158,102,102,207,104,104,208,105,105,207,105,105,252,195,102,
+102,3,166,102,102,207,102,102,209,104,104,209,105,105,207,105,105,207,105,
+105,102,102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,105,105,
+105,102,102,207,102,102,209,104,104,209,105,105,207,105,105,207,105,105,102,
+102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,105,105,251,244,
+102,102,207,102,102,207,102,102,207,104,104,208,105,105,207,105,105,252,90,
+105,105,207,105,105,207,105,105,209,104,104,209,102,102,207,102,102,207,102,
+102,105,105,105,105,102,102,105,105,105,105,102,102,105,105,105,105,102,102,
+105,105,105,105,102,102,105,105,105,105,105,105,102,102,5,164,98,98,98,98,
+98,98,98,98,98,98,98,99,94,94,94,94,94,94,94,94,94,94,94,96,96,96,96,96,96,
+96,96,96,96,96,96,101,94,94,94,94,94,94,94,94,94,94,94,96,97,97,97,97,97,
+97,97,97,97,97,97,100,94,94,94,94,94,94,94,94,94,94,94,96,99,99,99,99,99,
+99,99,99,99,99,99,98,92,92,92,92,92,92,92,92,92,92,92,98,99,99,99,99,99,99,
+99,99,99,99,99,94,96,96,96,96,96,96,96,96,96,96,96,7,235,98,98,98,98,98,98,
+98,98,98,98,98,1,37,96,96,96,96,96,96,96,96,96,96,96,254,223,98,99,94,96,
+96,101,94,96,97,100,94,96,99,98,92,98,99,94,96,7,235,98,1,37,96,0,67,0,0,
+254,20,5,213,7,37,0,73,0,77,0,81,0,85,0,89,0,93,0,97,0,101,0,105,0,109,0,
+113,0,117,0,121,0,125,0,129,0,133,0,137,0,141,0,145,0,149,0,153,0,157,0,161,
+0,165,0,169,0,173,0,177,0,181,0,185,0,189,0,193,0,197,0,201,0,205,0,209,0,
+213,0,217,0,221,0,225,0,229,0,233,0,237,0,241,0,245,0,249,0,253,1,1,1,5,1,
+9,1,13,1,17,1,21,1,25,1,29,1,33,1,37,1,41,1,45,1,49,1,53,1,57,1,61,1,65,1,
+69,1,73,1,77,1,81,0,0,1,33,17,51,53,35,17,51,53,35,17,51,53,35,17,51,53,35,
+17,51,53,35,17,51,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,
+51,53,51,21,51,53,51,21,35,21,51,17,35,21,51,17,35,21,51,17,35,21,51,17,35,
+21,51,17,35,21,51,1,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,23,35,21,
+51,39,35,21,51,39,35,21,51,39,35,21,51,7,21,51,53,51,21,51,53,51,21,51,53,
+51,21,51,53,5,35,21,51,55,21,51,53,51,21,51,53,51,21,51,53,5,21,51,53,33,
+21,51,53,7,53,35,21,37,21,51,53,19,53,35,21,35,53,35,21,35,53,35,21,35,53,
+35,21,7,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,19,53,35,21,35,53,35,
+21,35,53,35,21,35,53,35,21,7,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,
+19,35,21,51,39,35,21,51,39,35,21,51,39,35,21,51,1,35,21,51,39,35,21,51,39,
+35,21,51,39,35,21,51,1,21,51,53,51,21,51,53,23,35,21,51,39,35,21,51,7,21,
+51,53,51,21,51,53,7,35,21,51,55,21,51,53,5,21,51,53,23,53,35,21,23,53,35,
+21,35,53,35,21,7,21,51,53,51,21,51,53,19,53,35,21,35,53,35,21,7,21,51,53,
+51,21,51,53,19,35,21,51,39,35,21,51,19,35,21,51,39,35,21,51,5,213,250,43,
+106,106,106,106,106,106,106,106,106,106,106,107,106,107,106,107,106,109,107,
+106,107,106,106,107,107,107,107,107,107,107,107,107,107,107,107,107,250,149,
+107,106,107,106,107,106,109,107,107,107,216,106,106,213,106,106,213,106,106,
+213,107,106,107,106,107,106,109,253,233,106,106,107,106,107,106,109,107,252,
+169,107,1,63,107,213,107,1,170,109,107,107,109,106,107,106,107,106,107,107,
+106,107,106,107,106,109,107,107,109,106,107,106,107,106,107,107,106,107,106,
+107,106,109,107,107,107,216,106,106,213,106,106,213,106,106,2,23,109,109,
+215,107,107,213,107,107,213,107,107,2,236,106,107,106,106,106,106,212,107,
+107,213,106,107,106,106,107,107,106,106,254,87,106,213,106,212,106,106,107,
+106,106,107,106,106,106,106,107,106,106,107,106,106,106,106,212,107,107,106,
+106,106,213,106,106,254,20,1,33,99,1,32,99,1,34,97,1,32,99,1,33,98,1,33,96,
+96,96,96,96,96,96,96,96,96,96,96,96,195,98,254,223,94,254,219,94,254,219,
+94,254,219,92,254,221,96,6,104,94,94,94,94,94,94,94,94,190,99,99,99,99,99,
+99,99,98,94,94,94,94,94,94,94,94,190,97,97,97,97,97,97,97,97,197,94,94,94,
+94,94,94,94,94,94,94,254,223,99,99,99,99,99,99,99,99,98,92,92,92,92,92,92,
+92,92,254,223,99,99,99,99,99,99,99,99,94,96,96,96,96,96,96,96,96,6,205,98,
+98,98,98,98,98,98,1,32,98,98,98,98,98,98,98,254,223,94,94,94,94,190,99,99,
+99,98,94,94,94,94,190,97,97,97,97,197,94,94,94,94,94,195,99,99,99,99,98,92,
+92,92,92,254,223,99,99,99,99,94,96,96,96,96,6,205,98,98,98,1,32,98,98,98,
+0,1,0,123,0,246,4,90,4,213,0,3,0,0,19,33,17,33,123,3,223,252,33,4,213,252,
+33,0,2,0,6,0,0,4,207,4,201,0,3,0,7,0,0,19,33,17,33,19,17,33,17,6,4,201,251,
+55,76,4,49,4,201,251,55,4,125,251,207,4,49,0,1,0,109,1,127,2,104,3,123,0,
+3,0,0,1,33,17,33,2,104,254,5,1,251,1,127,1,252,0,2,0,109,1,127,2,104,3,123,
+0,3,0,7,0,0,1,33,17,33,3,17,33,17,2,104,254,5,1,251,75,254,155,1,127,1,252,
+254,80,1,98,254,158,0,1,0,0,0,129,8,0,2,233,0,3,0,0,17,33,17,33,8,0,248,0,
+2,233,253,152,0,1,1,158,0,0,6,76,4,174,0,2,0,0,33,1,1,1,158,2,88,2,86,4,174,
+251,82,0,1,1,145,255,229,6,90,4,172,0,2,0,0,9,2,1,145,4,201,251,55,4,172,
+253,158,253,155,0,1,1,158,255,229,6,76,4,147,0,2,0,0,9,2,6,76,253,170,253,
+168,4,147,251,82,4,174,0,1,1,145,255,229,6,90,4,172,0,2,0,0,1,17,1,6,90,251,
+55,4,172,251,57,2,101,0,2,0,168,0,162,4,45,4,41,0,15,0,31,0,0,19,52,54,54,
+51,50,22,22,21,20,6,6,35,34,38,38,55,20,22,22,51,50,54,54,53,52,38,38,35,
+34,6,6,168,119,209,120,123,209,121,121,209,123,120,209,119,86,96,168,98,99,
+170,98,96,172,99,96,170,96,2,100,121,211,121,121,211,121,120,209,121,121,
+206,123,98,170,96,96,170,98,99,170,98,98,168,0,16,0,98,0,86,4,94,4,82,0,7,
+0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,119,
+0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,52,
+51,50,23,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,
+50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,
+20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,
+34,53,52,51,50,37,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,39,20,35,34,
+53,52,51,50,3,215,51,55,55,51,147,52,57,57,52,247,55,53,55,53,35,51,55,55,
+51,254,56,54,53,53,54,173,55,53,53,55,2,82,55,53,53,55,253,27,55,54,54,55,
+2,129,51,55,55,51,147,52,57,57,52,253,174,52,57,55,54,35,53,56,56,53,1,199,
+54,53,53,54,254,92,54,55,55,54,247,55,53,53,55,147,55,54,54,55,3,150,54,54,
+55,43,53,53,55,254,211,55,55,53,227,53,53,53,1,148,56,56,53,90,53,53,55,253,
+119,53,53,55,1,185,54,51,58,253,67,53,53,56,154,51,51,55,2,29,55,55,53,227,
+53,53,53,254,4,55,55,54,227,53,53,55,254,213,55,51,55,43,53,53,56,0,1,0,178,
+0,137,4,35,3,250,0,13,0,0,1,50,22,22,21,20,0,35,34,0,53,52,54,54,2,106,109,
+217,115,254,254,183,182,254,254,111,215,3,250,117,217,106,183,254,254,1,2,
+183,108,213,119,0,2,0,41,0,0,4,172,4,131,0,3,0,19,0,0,51,17,33,17,1,20,22,
+22,51,50,54,54,53,52,38,38,35,34,6,6,41,4,131,252,4,119,203,118,117,205,119,
+119,203,119,118,205,117,4,131,251,125,2,66,119,203,119,119,205,117,116,205,
+119,119,205,0,3,0,41,0,0,4,172,4,131,0,3,0,19,0,35,0,0,51,17,33,17,1,52,54,
+54,51,50,22,22,21,20,6,6,35,34,38,38,39,20,22,22,51,50,54,54,53,52,38,38,
+35,34,6,6,41,4,131,252,82,96,170,98,97,170,98,98,170,97,98,170,96,78,119,
+203,118,117,205,119,119,203,119,118,205,117,4,131,251,125,2,66,96,170,98,
+98,170,96,99,170,96,96,170,99,119,203,119,119,205,117,116,205,119,119,205,
+0,2,0,115,1,133,2,98,3,117,0,12,0,24,0,0,1,20,6,35,34,38,53,52,54,51,50,23,
+22,7,52,38,35,34,6,21,20,22,51,50,54,2,98,149,99,102,145,147,100,105,70,73,
+75,103,70,69,103,99,73,78,95,2,125,107,141,144,104,102,146,74,72,102,70,102,
+102,70,72,100,104,0,5,1,176,255,229,6,121,4,172,0,11,0,24,0,36,0,48,0,58,
+0,0,1,20,0,35,34,0,39,52,0,33,32,0,7,52,0,35,34,7,6,21,20,0,51,50,0,1,20,
+6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,1,22,51,50,
+55,23,6,35,34,39,6,121,254,151,252,251,254,153,2,1,98,1,2,1,3,1,98,90,254,
+207,218,217,151,154,1,51,215,218,1,49,253,90,45,33,33,45,45,33,33,45,1,211,
+43,33,33,47,47,33,33,43,253,233,76,147,146,76,61,96,187,184,98,2,72,254,254,
+155,1,103,252,250,1,106,254,150,250,217,1,51,154,153,217,215,254,204,1,52,
+1,86,31,47,47,31,32,45,45,32,31,47,47,31,32,45,45,254,191,137,137,35,186,
+186,0,4,1,209,255,229,6,154,4,172,0,11,0,23,0,35,0,45,0,0,1,20,0,35,34,0,
+39,52,0,33,32,0,5,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,
+22,51,50,54,1,22,51,50,55,39,6,35,34,39,6,154,254,151,252,254,254,156,2,1,
+98,1,2,1,2,1,99,253,0,48,30,33,45,45,33,30,48,1,211,46,30,33,47,47,33,30,
+46,253,174,98,184,185,98,62,75,146,147,76,2,72,254,254,155,1,103,252,250,
+1,106,254,150,123,32,45,45,32,31,47,47,31,32,45,45,32,31,47,47,254,219,186,
+186,35,137,137,0,2,1,70,255,115,6,14,4,59,0,41,0,53,0,0,1,51,21,22,22,23,
+55,23,7,22,23,51,21,35,6,7,23,7,39,6,6,7,21,35,53,38,39,7,39,55,38,39,35,
+53,51,54,55,39,55,23,54,55,23,34,6,21,20,22,51,50,54,53,52,38,3,137,66,65,
+101,59,186,45,184,86,6,215,215,16,76,184,49,182,50,87,88,66,121,100,188,43,
+182,78,16,215,215,12,80,180,41,188,111,112,31,139,193,195,137,139,195,197,
+4,59,217,6,39,45,182,45,184,113,116,62,125,96,188,43,182,37,42,13,217,217,
+16,74,180,45,184,100,125,62,129,94,184,49,182,78,12,61,199,135,135,197,200,
+132,135,199,0,2,1,217,0,80,4,39,4,129,0,23,0,36,0,0,1,38,38,53,52,54,51,50,
+23,22,21,20,6,7,21,33,21,33,17,35,17,33,53,33,19,34,6,21,20,22,51,50,55,54,
+53,52,38,2,219,113,137,174,113,119,84,86,146,104,1,0,255,0,76,254,254,1,2,
+37,88,119,123,84,86,59,62,119,2,66,18,162,104,125,166,86,84,121,108,162,14,
+166,70,254,250,1,6,70,2,145,120,85,86,121,62,61,84,86,119,0,2,1,82,0,250,
+4,174,4,129,0,44,0,56,0,0,1,38,39,38,53,52,55,54,51,23,22,51,50,55,54,51,
+50,21,7,6,21,20,23,23,20,7,7,34,38,38,39,7,22,21,20,6,35,34,38,53,52,54,51,
+50,23,7,34,6,21,20,22,51,50,54,53,52,38,4,0,147,43,9,6,7,8,33,67,60,88,41,
+34,15,14,4,16,12,4,4,14,21,37,35,14,235,84,177,114,117,172,168,123,69,84,
+153,90,123,125,88,88,123,125,4,0,43,43,4,14,9,8,4,4,17,13,12,14,27,59,99,
+77,52,32,9,6,6,66,90,49,238,82,108,125,174,164,121,120,170,43,32,121,90,95,
+118,125,88,88,123,0,1,0,59,0,0,4,4,4,207,0,33,0,0,1,22,22,23,22,22,23,20,
+6,35,34,39,30,2,23,23,33,55,50,54,54,53,53,6,35,34,38,53,52,54,55,54,54,2,
+33,24,97,149,141,70,2,129,88,156,100,4,80,162,133,6,252,234,6,123,172,88,
+90,170,91,129,88,101,137,133,4,207,96,168,140,127,131,71,97,127,191,160,166,
+94,8,37,37,96,172,146,14,191,127,93,90,135,82,119,186,0,1,0,59,0,0,5,4,4,
+199,0,51,0,0,33,33,55,62,3,53,39,6,6,35,34,38,53,52,54,55,50,23,38,39,38,
+53,52,54,51,50,22,21,20,7,54,55,54,51,50,23,22,21,20,6,35,34,38,38,39,30,
+3,23,4,70,252,182,8,135,119,94,54,3,57,176,90,115,162,148,92,61,101,37,18,
+11,162,113,116,160,69,84,16,22,39,105,67,74,156,116,56,118,95,61,4,49,111,
+127,112,35,26,56,119,149,76,47,121,117,157,122,115,157,2,51,66,39,36,39,121,
+150,160,107,86,98,39,4,8,78,75,117,117,164,50,81,105,125,154,120,54,20,0,
+1,0,102,255,233,4,90,4,121,0,24,0,0,5,38,38,39,39,38,38,53,52,54,51,50,22,
+23,54,54,51,50,22,21,20,6,7,6,6,2,98,22,90,176,91,75,54,140,100,86,143,39,
+33,143,88,97,143,88,111,141,129,23,86,183,235,123,101,129,65,107,137,115,
+119,119,117,135,99,86,190,137,179,213,0,1,0,66,255,231,3,211,4,199,0,11,0,
+0,1,22,0,23,6,0,7,38,0,39,54,0,2,6,74,1,8,123,70,254,207,84,43,254,250,149,
+116,1,2,4,199,125,254,151,137,70,254,105,148,82,1,109,178,137,1,88,0,1,0,
+197,0,29,3,59,4,129,0,25,0,0,1,51,21,23,22,21,20,7,35,54,53,52,38,39,17,20,
+6,35,34,38,53,52,54,51,50,23,1,233,76,154,108,94,47,57,114,64,147,107,57,
+57,125,77,43,47,4,129,100,193,147,170,150,121,127,121,119,160,10,254,6,123,
+151,55,45,78,115,19,0,2,1,16,255,213,4,240,4,135,0,26,0,30,0,0,1,20,6,35,
+34,53,52,54,51,50,23,17,5,17,20,6,35,34,38,53,52,54,51,50,23,17,37,1,37,53,
+5,4,240,155,95,115,123,78,47,43,253,217,137,115,57,58,119,74,54,46,2,187,
+253,143,2,39,253,217,1,68,127,148,101,81,111,18,1,192,149,254,118,116,156,
+53,45,76,117,19,2,240,178,254,103,149,117,152,0,2,0,102,255,55,4,2,5,205,
+0,27,0,31,0,0,1,7,17,35,17,5,17,35,17,7,53,55,17,7,53,55,17,51,17,37,17,51,
+17,55,21,7,17,55,5,17,5,17,4,2,201,96,254,182,96,201,201,201,201,96,1,74,
+96,201,201,201,254,215,254,182,1,188,88,254,156,1,61,159,254,153,1,64,96,
+159,94,1,246,96,160,96,1,70,254,225,160,1,92,254,203,94,158,96,254,10,90,
+129,1,246,160,254,10,0,1,0,20,0,0,4,104,5,182,0,41,0,0,1,33,21,33,21,33,17,
+33,50,54,55,55,51,3,33,53,51,50,54,53,17,35,53,51,53,35,53,51,17,52,38,35,
+35,53,33,21,35,34,6,21,17,33,3,16,254,207,1,49,254,207,1,86,73,93,14,21,106,
+14,251,244,26,96,72,252,252,252,252,72,96,26,2,84,27,97,71,1,49,3,55,143,
+96,254,30,91,94,153,254,72,86,72,75,1,95,96,143,97,1,53,75,72,86,86,71,68,
+254,195,0,1,0,20,0,0,2,102,6,20,0,34,0,0,19,53,35,53,51,17,52,38,35,35,53,
+33,17,51,21,35,21,51,21,35,17,20,22,51,51,21,33,53,51,50,54,53,17,35,53,221,
+201,201,71,97,26,1,131,200,200,200,200,72,96,26,253,187,26,97,71,201,2,168,
+143,97,1,155,68,71,86,253,132,97,143,96,254,161,75,72,86,86,74,73,1,95,96,
+0,1,0,8,0,0,4,166,5,182,0,52,0,0,0,54,55,51,6,6,35,34,38,39,17,33,50,54,55,
+55,51,3,33,53,51,50,54,53,17,38,38,35,34,6,7,35,54,54,51,50,22,23,17,52,38,
+35,35,53,33,21,35,34,6,21,17,22,51,2,75,49,9,92,7,111,97,12,20,11,1,148,73,
+93,14,20,107,14,251,182,26,96,72,18,36,17,44,48,9,92,7,115,95,13,22,12,72,
+96,26,2,84,27,97,71,34,32,3,12,44,65,110,132,2,2,253,219,91,94,153,254,72,
+86,72,75,2,9,9,13,43,65,112,129,2,2,1,68,75,72,86,86,71,68,254,74,19,0,2,
+0,78,0,0,4,133,5,182,0,29,0,42,0,0,1,52,38,35,35,53,33,50,4,21,20,4,33,35,
+17,20,22,51,51,21,33,53,51,50,54,53,17,35,53,59,2,21,35,17,51,50,54,53,52,
+38,35,35,1,16,71,97,26,2,63,248,1,0,254,228,254,247,129,71,97,68,253,131,
+26,96,72,194,194,207,246,246,109,190,158,151,167,139,4,213,68,71,86,220,208,
+217,248,254,166,69,68,86,86,72,75,2,220,100,100,254,213,168,192,180,158,0,
+2,0,57,254,20,5,55,5,182,0,38,0,47,0,0,5,20,22,51,50,54,55,21,6,6,35,34,38,
+53,17,52,38,35,35,53,33,32,4,21,20,6,7,1,22,22,51,51,21,35,34,38,39,1,35,
+53,51,50,54,53,52,38,35,35,1,203,84,71,38,62,31,29,121,44,162,137,71,97,27,
+2,39,1,10,1,5,157,144,1,24,57,98,58,8,28,184,146,72,254,236,170,143,164,149,
+144,173,139,180,105,98,8,6,90,13,20,147,171,5,131,68,71,86,197,198,135,190,
+48,254,68,91,73,86,61,123,1,205,96,142,178,165,138,0,4,0,102,254,88,4,41,
+5,182,0,43,0,51,0,57,0,63,0,0,0,6,21,34,38,53,52,54,51,50,22,51,19,51,3,22,
+22,21,17,20,22,51,51,21,33,39,35,14,2,7,3,35,19,38,38,53,52,54,55,19,34,38,
+35,19,6,6,35,3,54,54,53,4,23,19,6,6,21,1,52,38,39,3,55,1,196,90,86,88,198,
+171,12,23,12,78,104,81,113,114,53,72,8,254,235,32,17,65,67,91,65,91,104,92,
+115,131,194,198,86,8,15,8,190,90,67,2,101,119,141,254,74,78,92,94,76,1,182,
+23,38,78,139,3,248,97,126,58,71,95,101,2,1,90,254,152,26,161,151,253,237,
+83,64,86,176,86,62,42,4,254,106,1,154,19,165,137,150,155,17,1,129,2,254,53,
+3,5,254,69,6,151,128,226,40,1,149,24,116,93,1,211,71,112,32,254,168,6,0,2,
+0,39,254,88,2,213,5,182,0,34,0,37,0,0,36,54,55,21,6,6,35,34,38,39,3,35,19,
+38,38,53,17,35,53,50,54,55,51,21,51,19,51,3,51,21,35,3,22,22,51,3,19,35,2,
+68,62,32,28,105,49,28,50,23,92,104,100,53,47,156,86,133,35,94,152,82,104,
+82,12,39,190,22,58,37,156,125,125,88,8,6,90,13,19,5,3,254,100,1,193,34,132,
+106,2,172,82,116,171,252,1,108,254,148,117,252,184,28,25,1,84,2,41,255,255,
+0,78,254,82,6,25,5,182,18,2,2,166,0,0,0,1,0,37,254,82,5,4,6,20,0,47,0,0,33,
+17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,
+33,17,20,6,7,51,54,51,50,22,21,17,20,22,51,51,17,35,39,38,38,35,3,119,108,
+117,121,127,69,97,8,253,217,16,97,71,71,97,16,1,121,6,2,10,92,209,181,181,
+65,93,47,100,10,11,106,82,2,195,144,136,174,158,254,80,70,67,86,86,74,73,
+4,74,68,71,86,254,62,53,92,29,186,199,202,254,28,76,71,253,252,149,137,144,
+0,2,0,78,254,82,5,199,5,182,0,54,0,55,0,0,37,1,7,17,20,22,51,51,21,33,53,
+51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,1,54,54,53,52,38,35,53,
+33,21,34,6,7,1,1,22,22,51,51,17,35,52,46,4,37,3,238,254,159,174,71,97,27,
+253,172,26,97,71,71,97,26,2,84,27,97,71,1,168,60,53,49,52,1,197,53,112,109,
+254,215,1,176,59,109,57,25,95,31,53,74,88,81,1,145,184,1,250,141,254,196,
+73,74,86,86,68,69,3,246,68,71,86,86,74,73,253,190,1,230,67,97,32,26,19,84,
+84,70,122,254,178,253,166,81,83,253,252,111,169,105,61,23,68,87,0,1,0,37,
+254,82,4,190,6,20,0,51,0,0,37,3,7,21,20,22,51,51,21,33,53,51,50,54,53,17,
+52,38,35,35,53,33,17,20,6,7,1,54,54,53,52,38,35,53,33,21,34,6,7,7,1,22,22,
+51,51,17,35,39,46,3,3,2,205,151,71,97,6,253,217,16,97,71,71,97,16,1,121,5,
+3,1,0,50,62,48,52,1,196,71,137,80,144,1,17,53,105,69,20,100,10,8,72,85,87,
+199,1,65,112,185,69,68,86,86,74,73,4,74,68,71,86,252,234,60,131,67,1,24,56,
+90,37,26,15,86,86,100,91,162,254,107,82,86,253,252,149,125,135,48,40,0,1,
+0,74,254,82,4,94,5,182,0,18,0,0,1,35,52,38,35,33,53,1,33,34,6,7,7,35,19,33,
+21,1,33,4,94,94,142,173,253,133,3,0,254,67,75,83,10,10,106,10,3,203,252,254,
+3,26,254,82,231,199,82,4,254,81,87,88,1,102,84,251,4,0,1,0,86,254,82,3,158,
+4,74,0,19,0,0,51,53,1,33,34,6,7,7,35,19,33,21,1,33,17,35,39,38,38,35,86,2,
+82,254,192,65,66,26,2,86,20,3,17,253,172,2,90,101,10,9,107,83,82,3,131,61,
+105,8,1,35,84,252,127,253,221,149,135,146,0,2,0,115,255,236,6,41,5,205,0,
+28,0,40,0,0,37,20,22,51,51,21,33,39,35,6,6,35,32,0,17,16,0,33,50,22,23,51,
+55,33,21,35,34,6,21,0,18,51,50,18,17,16,2,35,34,2,17,5,102,71,97,27,254,154,
+31,8,57,231,167,254,224,254,190,1,68,1,38,153,238,56,8,31,1,102,27,97,71,
+251,240,207,211,211,205,204,210,211,209,233,73,74,86,193,102,111,1,145,1,
+98,1,96,1,142,115,100,192,86,74,73,252,197,254,200,1,53,1,78,1,76,1,53,254,
+204,254,179,255,255,0,8,0,0,4,197,4,86,18,2,2,124,0,0,0,1,0,18,0,0,8,182,
+5,195,0,51,0,0,1,54,54,51,50,22,21,20,6,7,38,38,35,34,6,7,1,35,1,1,35,1,38,
+38,35,35,53,33,21,35,34,6,21,20,22,23,19,22,22,23,54,54,55,19,51,1,22,22,
+23,54,54,55,6,231,63,157,122,60,61,35,32,16,37,29,67,89,35,254,207,184,254,
+178,254,199,189,254,137,20,63,62,27,2,52,47,62,61,10,6,188,24,47,18,15,41,
+27,244,148,1,0,29,45,14,15,39,28,4,74,219,158,62,43,32,50,12,25,22,118,128,
+251,203,4,123,251,133,4,244,63,45,86,86,47,51,17,36,23,253,113,87,180,79,
+80,189,99,3,111,252,137,102,187,71,74,163,99,0,1,0,2,0,0,7,72,4,86,0,54,0,
+0,1,54,54,51,50,22,21,20,6,7,38,38,35,34,6,7,3,35,3,39,1,35,1,38,38,35,35,
+53,33,21,35,34,6,21,20,22,23,19,22,22,23,51,54,54,55,19,51,19,22,22,23,51,
+54,54,55,5,150,66,126,119,60,63,36,32,15,38,29,53,67,50,225,164,244,37,254,
+222,162,254,244,24,59,61,8,1,250,27,62,61,11,6,96,23,33,14,8,6,46,32,213,
+129,205,26,49,11,8,9,36,31,2,227,223,148,61,43,32,50,13,25,35,84,162,253,
+43,2,209,135,252,168,3,135,65,44,86,86,36,50,17,48,23,254,168,85,159,70,40,
+160,93,2,107,253,161,80,172,53,51,149,99,0,2,0,41,0,0,4,119,4,94,0,45,0,58,
+0,0,0,6,7,23,22,22,23,51,54,54,55,19,54,54,53,52,38,35,35,53,33,21,35,34,
+6,7,1,35,3,34,38,39,55,22,22,23,39,38,38,53,52,54,51,50,22,21,4,22,23,23,
+54,54,53,52,38,35,34,6,21,2,86,92,94,80,40,50,10,8,8,83,11,148,9,9,67,68,
+14,1,168,10,63,59,34,254,188,186,242,43,90,51,27,34,54,28,10,17,16,127,117,
+99,114,254,242,13,15,19,51,61,44,35,45,35,3,54,131,42,198,103,155,50,37,215,
+29,1,143,25,46,17,53,48,86,86,67,93,252,172,2,98,16,15,100,12,13,3,30,45,
+86,29,94,121,104,103,21,62,37,48,28,81,55,47,47,50,40,0,1,0,78,0,0,3,254,
+5,182,0,27,0,0,1,33,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,
+33,21,35,34,6,21,17,33,3,254,253,225,71,97,27,253,172,26,96,72,71,97,26,2,
+84,27,97,71,2,31,2,201,254,32,73,74,86,86,72,75,3,236,68,71,86,86,74,73,254,
+98,0,1,0,47,0,0,3,145,4,74,0,27,0,0,1,17,20,22,51,51,21,33,53,51,50,54,53,
+17,52,38,35,35,53,33,21,35,34,6,21,17,33,21,1,178,70,96,8,253,207,27,97,71,
+74,94,27,2,49,8,97,69,1,223,2,4,254,219,68,69,86,86,68,69,2,137,70,70,86,
+86,70,68,254,248,94,0,2,0,113,255,236,5,35,4,94,0,22,0,32,0,0,1,6,6,21,20,
+22,23,17,52,54,51,50,18,21,16,0,33,32,0,17,52,18,55,1,54,54,53,52,38,35,34,
+6,21,1,244,97,92,163,177,138,133,176,217,254,208,254,216,254,218,254,204,
+180,172,1,53,175,167,116,95,57,74,4,0,41,229,203,227,219,17,2,180,171,167,
+254,199,248,254,226,254,221,1,36,1,23,231,1,31,49,251,250,17,224,228,211,
+244,123,105,0,2,0,12,1,31,3,57,4,4,0,3,0,7,0,0,1,1,39,1,1,39,1,23,3,57,252,
+252,41,3,6,253,35,41,3,6,39,3,172,254,166,88,1,90,253,27,88,1,90,88,0,2,255,
+152,5,23,1,98,7,104,0,3,0,15,0,0,1,17,35,17,4,54,51,50,22,21,20,6,35,34,38,
+53,1,98,121,254,175,51,53,51,53,61,43,45,59,7,104,253,175,2,81,231,59,57,
+57,62,53,53,62,0,2,255,152,4,133,1,197,6,188,0,3,0,15,0,0,1,1,39,1,36,54,
+51,50,22,21,20,6,35,34,38,53,1,197,254,92,86,1,166,254,39,51,53,51,53,61,
+43,45,59,6,41,254,92,84,1,166,2,59,57,57,62,53,53,62,0,2,254,215,4,213,1,
+41,6,188,0,3,0,15,0,0,1,33,53,33,0,54,51,50,22,21,20,6,35,34,38,53,1,41,253,
+174,2,82,254,111,51,53,51,53,61,43,45,59,4,213,121,1,51,59,57,57,62,53,53,
+62,0,1,254,229,4,217,1,27,6,16,0,5,0,0,1,53,33,53,51,17,254,229,1,201,109,
+4,217,109,202,254,201,0,1,0,143,4,182,2,160,7,45,0,19,0,0,1,17,6,6,7,35,53,
+54,54,55,51,22,22,23,21,35,38,38,39,17,1,102,26,60,34,95,77,94,42,101,40,
+94,81,97,30,60,28,4,182,1,129,51,79,38,21,107,177,109,103,179,111,21,40,75,
+51,254,129,0,1,0,143,4,182,2,160,7,45,0,19,0,0,1,17,54,54,55,51,21,6,6,7,
+35,38,38,39,53,51,22,22,23,17,1,201,26,60,35,94,73,93,47,101,37,96,82,97,
+31,60,27,7,45,254,127,51,79,38,21,102,171,120,96,183,114,21,38,77,51,1,127,
+0,2,0,211,2,111,1,213,7,6,0,3,0,15,0,0,19,51,3,35,6,54,51,50,22,21,20,6,35,
+34,38,53,221,238,72,94,82,66,63,62,67,66,63,63,66,7,6,253,19,217,69,70,69,
+68,71,70,69,0,2,0,211,2,131,1,213,7,27,0,3,0,15,0,0,1,35,19,51,54,6,35,34,
+38,53,52,54,51,50,22,21,1,203,238,72,94,82,66,63,62,67,65,64,64,65,2,131,
+2,238,216,69,70,69,67,73,71,69,255,255,0,211,1,52,1,213,5,204,18,3,8,124,
+0,0,254,177,0,1,254,229,4,217,1,27,6,16,0,9,0,0,1,21,35,21,35,53,35,21,35,
+17,1,27,201,109,147,109,6,16,108,203,203,203,1,55,0,1,254,229,0,0,1,27,1,
+55,0,9,0,0,33,53,51,53,51,21,51,53,51,17,254,229,201,109,147,109,109,202,
+202,202,254,201,255,255,0,210,254,44,3,46,255,116,16,3,1,75,255,177,249,83,
+0,2,0,166,0,190,1,168,4,84,0,11,0,23,0,0,18,54,51,50,22,21,20,6,35,34,38,
+53,16,54,51,50,22,21,20,6,35,34,38,53,166,66,63,62,67,65,64,64,65,66,63,62,
+67,65,64,64,65,1,144,69,70,69,67,73,71,69,2,197,69,70,69,67,73,71,69,0,2,
+0,102,1,131,3,53,3,143,0,3,0,7,0,0,1,21,33,53,1,21,33,53,3,53,253,49,2,207,
+253,49,1,252,121,121,1,147,120,120,0,1,0,221,1,156,1,203,5,182,0,3,0,0,19,
+51,3,35,221,238,72,94,5,182,251,230,0,1,0,221,3,53,1,203,5,182,0,3,0,0,19,
+51,3,35,221,238,72,94,5,182,253,127,255,255,0,86,254,20,5,55,5,182,16,67,
+2,40,5,135,0,0,192,0,64,0,255,255,255,164,255,242,3,237,6,141,16,67,2,42,
+4,47,0,0,192,0,64,0,255,255,1,117,0,0,6,61,4,199,16,67,8,13,7,213,0,0,192,
+0,64,0,0,1,0,53,254,20,4,39,6,31,0,32,0,0,1,34,38,39,3,3,19,16,35,34,6,6,
+21,34,38,53,52,54,51,50,22,23,18,17,3,16,51,50,54,53,50,21,20,3,66,155,200,
+12,7,5,4,148,41,46,21,74,76,120,122,152,189,13,13,4,147,56,53,149,254,20,
+232,194,1,13,1,82,2,121,1,43,32,59,73,59,55,68,76,228,198,254,174,254,215,
+253,164,254,213,67,97,115,144,255,255,0,111,1,123,4,10,4,37,16,67,2,45,4,
+121,0,0,192,0,64,0,0,3,1,35,4,209,3,127,6,248,0,11,0,23,0,33,0,0,0,54,51,
+50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,39,54,54,55,
+51,21,6,6,7,35,1,35,51,53,54,51,53,52,45,59,1,135,51,53,54,51,53,52,45,59,
+154,36,90,22,219,41,179,69,78,5,123,59,61,53,53,62,53,62,55,59,61,53,53,62,
+53,62,155,51,172,58,21,59,182,45,0,3,1,31,4,209,3,123,6,248,0,11,0,23,0,33,
+0,0,0,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,
+39,35,38,38,39,53,51,22,22,23,1,35,51,53,54,51,53,52,45,59,1,135,51,53,54,
+51,53,52,45,59,27,77,69,179,43,219,24,87,38,5,123,59,61,53,53,62,53,62,55,
+59,61,53,53,62,53,62,129,46,179,61,21,62,163,56,255,255,0,133,0,250,3,244,
+4,188,16,67,2,46,4,121,0,0,192,0,64,0,0,1,252,233,4,190,0,4,6,63,0,8,0,0,
+19,34,4,7,35,54,36,33,51,4,240,254,166,114,95,125,1,121,1,13,24,5,182,108,
+140,207,178,0,1,255,254,4,190,3,25,6,63,0,8,0,0,3,51,32,4,23,35,38,36,35,
+2,25,1,12,1,121,125,95,114,254,166,240,6,63,178,207,140,108,0,1,252,238,4,
+197,0,6,5,205,0,13,0,0,19,38,38,35,34,6,7,35,54,54,51,50,22,23,6,157,182,
+97,101,126,37,92,32,188,142,125,215,90,5,2,41,39,62,79,125,139,40,22,0,1,
+255,250,4,199,3,18,5,207,0,13,0,0,3,22,22,51,50,54,55,51,6,6,35,34,38,39,
+6,179,163,94,112,120,32,92,32,189,141,125,214,91,5,145,46,33,69,72,127,137,
+39,22,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,
+135,254,164,254,205,1,100,1,43,135,3,158,1,92,135,254,213,1,43,0,1,0,160,
+0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,143,254,
+226,1,100,1,43,135,2,213,2,37,135,254,70,1,186,0,1,0,160,0,0,3,182,5,129,
+0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,133,254,236,1,110,1,33,
+135,1,160,3,90,135,253,90,2,166,0,1,0,160,0,0,3,182,5,129,0,8,0,0,33,35,1,
+33,53,33,1,17,51,3,182,135,254,127,254,242,1,110,1,33,135,4,250,135,252,68,
+3,188,0,1,0,78,0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,1,1,51,3,182,135,254,
+184,254,103,92,1,61,1,72,135,4,199,254,204,1,134,96,254,213,1,51,0,1,0,82,
+0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,55,1,33,17,51,3,182,135,254,148,254,
+143,98,1,72,1,51,135,3,168,1,111,96,254,184,1,82,0,1,0,78,0,0,3,182,5,129,
+0,7,0,0,33,35,17,1,55,1,17,51,3,182,135,253,31,94,2,131,135,2,74,2,205,94,
+253,153,2,115,0,1,0,78,0,0,3,182,5,129,0,9,0,0,33,35,53,1,1,55,1,19,17,51,
+3,182,135,254,184,254,103,82,1,180,219,135,236,2,165,1,134,106,254,104,254,
+48,3,104,0,1,0,70,0,0,3,182,5,129,0,8,0,0,33,35,1,1,55,1,19,17,51,3,182,135,
+254,166,254,113,90,1,174,225,135,3,162,1,121,102,254,107,253,155,3,250,0,
+1,0,70,0,0,2,113,5,129,0,7,0,0,33,35,17,1,55,1,17,51,2,113,138,254,95,90,
+1,71,138,3,158,1,127,100,254,215,1,41,0,1,0,53,0,0,3,182,5,129,0,8,0,0,33,
+35,17,1,1,55,1,1,51,3,182,135,254,180,254,82,107,1,71,1,72,135,4,121,253,
+215,2,227,78,253,223,2,33,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,
+1,1,17,51,3,182,135,254,180,254,82,107,1,96,1,47,135,3,162,254,176,2,227,
+76,253,178,1,45,1,33,0,1,0,80,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,55,1,
+33,17,51,3,182,135,254,168,254,121,115,1,100,1,8,135,2,156,2,157,72,253,162,
+2,94,0,1,0,45,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,23,17,51,3,182,135,
+254,158,254,96,119,1,147,248,135,1,14,1,99,2,202,70,253,70,248,3,178,0,1,
+0,72,0,0,3,182,5,129,0,6,0,0,33,35,1,55,1,17,51,3,182,135,253,25,118,2,113,
+135,5,61,68,251,154,4,102,0,1,0,45,0,0,2,113,5,129,0,7,0,0,33,35,17,1,55,
+1,17,51,2,113,138,254,70,115,1,71,138,2,86,2,227,72,253,223,2,33,0,1,0,37,
+0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,1,1,51,3,182,135,254,184,254,62,123,
+1,71,1,72,135,4,25,252,221,4,90,49,252,221,3,35,0,1,0,37,0,0,3,182,5,129,
+0,9,0,0,33,35,17,1,1,55,1,1,53,51,3,182,135,254,195,254,51,127,1,88,1,51,
+135,3,160,253,133,4,39,53,252,231,2,103,178,0,1,0,37,0,0,3,182,5,129,0,9,
+0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,178,254,68,123,1,114,1,29,135,
+2,86,254,176,4,74,49,252,125,1,18,2,113,0,1,0,39,0,0,3,182,5,129,0,9,0,0,
+33,35,17,33,1,55,1,33,17,51,3,182,135,254,150,254,98,121,1,131,1,12,135,1,
+82,3,254,49,252,88,3,168,0,1,0,47,0,0,3,182,5,129,0,8,0,0,33,35,1,1,55,1,
+23,17,51,3,182,135,254,184,254,72,127,1,172,213,135,1,72,4,2,55,252,21,216,
+4,195,0,1,0,37,0,0,2,113,5,129,0,7,0,0,33,35,53,1,55,1,17,51,2,113,138,254,
+62,123,1,71,138,244,4,92,49,252,221,3,35,0,1,0,29,0,0,3,182,5,129,0,8,0,0,
+33,35,17,1,1,55,1,1,51,3,182,135,254,184,254,54,125,1,77,1,72,135,3,215,252,
+41,5,82,47,252,41,3,215,0,1,0,23,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,
+1,1,53,51,3,182,135,254,184,254,48,127,1,88,1,65,135,3,117,252,139,5,80,47,
+252,23,3,106,129,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,
+51,3,182,135,254,184,254,78,127,1,78,1,45,135,2,143,253,113,5,84,43,251,227,
+2,111,1,176,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,37,17,51,3,
+182,135,254,184,254,78,127,1,117,1,6,135,1,55,254,201,5,84,43,251,125,250,
+3,139,0,1,0,47,0,0,3,182,5,129,0,7,0,0,33,33,1,55,1,51,17,51,3,182,254,43,
+254,78,129,1,148,235,135,5,84,45,251,6,4,250,0,1,0,41,0,0,2,113,5,129,0,6,
+0,0,33,35,1,55,1,17,51,2,113,138,254,66,129,1,61,138,5,84,45,252,41,3,215,
+0,1,0,80,0,0,3,182,5,129,0,7,0,0,33,35,17,33,1,39,1,33,3,182,135,254,205,
+254,180,96,1,115,1,243,4,250,254,182,98,1,111,0,1,0,76,0,0,3,182,5,129,0,
+9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,182,254,195,92,1,155,1,72,135,
+3,145,1,54,254,219,102,1,121,254,205,1,51,0,1,0,76,0,0,3,182,5,129,0,9,0,
+0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,152,254,219,86,1,155,1,72,135,2,
+41,2,129,254,246,104,1,121,253,193,2,63,0,1,0,76,0,0,3,182,5,129,0,9,0,0,
+33,35,53,1,5,39,1,1,17,51,3,182,135,254,131,254,238,84,1,155,1,72,135,233,
+3,173,246,104,1,121,252,211,3,45,0,1,0,94,0,0,3,182,5,129,0,8,0,0,33,35,1,
+5,39,1,1,17,51,3,182,135,254,141,254,242,80,1,156,1,53,135,4,137,231,102,
+1,121,252,61,3,195,0,1,0,76,0,0,2,113,5,129,0,6,0,0,33,35,17,1,39,1,51,2,
+113,138,254,195,94,1,155,138,4,195,254,221,104,1,121,0,1,0,160,0,0,3,182,
+5,129,0,8,0,0,33,35,17,5,33,53,33,1,51,3,182,135,255,0,254,113,1,84,1,59,
+135,4,197,226,135,1,23,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,
+33,1,17,51,3,182,135,254,156,254,213,1,96,1,47,135,2,104,1,123,135,254,195,
+2,84,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,
+135,254,158,254,211,1,127,1,16,135,1,53,2,174,135,253,242,3,37,0,1,0,160,
+0,0,3,182,5,129,0,8,0,0,33,35,1,33,53,33,19,17,51,3,182,135,254,172,254,197,
+1,157,242,135,3,227,135,253,64,3,215,0,1,0,80,0,0,3,182,5,129,0,8,0,0,33,
+35,17,1,1,55,1,1,51,3,182,135,254,184,254,105,96,1,31,1,96,135,4,121,253,
+213,1,160,98,254,219,2,86,0,1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,
+1,1,17,51,3,182,135,254,184,254,101,96,1,59,1,72,135,3,176,254,184,1,156,
+96,254,199,1,70,1,16,0,1,0,70,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,55,1,
+33,17,51,3,182,135,254,103,254,176,98,1,43,1,92,135,2,156,1,116,93,254,182,
+2,94,0,1,0,76,0,0,3,182,5,129,0,7,0,0,33,35,17,1,55,1,17,51,3,182,135,253,
+29,94,2,133,135,1,39,2,227,101,253,122,3,152,0,1,0,76,0,0,3,182,5,129,0,8,
+0,0,33,35,1,1,55,1,19,17,51,3,182,135,254,184,254,101,92,1,174,217,135,2,
+115,1,153,101,254,82,254,100,4,90,0,1,0,76,0,0,2,113,5,129,0,7,0,0,33,35,
+17,1,55,1,17,51,2,113,138,254,101,94,1,61,138,2,100,1,156,100,254,195,2,90,
+0,1,0,47,0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,1,1,51,3,182,135,254,184,
+254,72,117,1,55,1,84,135,4,29,252,229,3,96,72,253,152,3,63,0,1,0,57,0,0,3,
+182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,53,51,3,182,135,254,184,254,82,117,
+1,57,1,72,135,3,158,253,112,3,72,70,253,161,2,144,180,0,1,0,63,0,0,3,182,
+5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,195,254,77,119,1,92,
+1,29,135,2,115,254,164,3,88,61,253,84,1,57,2,72,0,1,0,63,0,0,3,182,5,129,
+0,9,0,0,33,35,17,33,1,55,1,33,17,51,3,182,135,254,164,254,108,119,1,111,1,
+10,135,1,86,3,25,61,253,49,3,164,0,1,0,63,0,0,3,182,5,129,0,8,0,0,33,35,1,
+1,55,1,23,17,51,3,182,135,254,180,254,92,119,1,154,223,135,1,53,3,58,61,252,
+221,203,4,195,0,1,0,63,0,0,2,113,5,129,0,7,0,0,33,35,17,1,55,1,17,51,2,113,
+138,254,88,119,1,49,138,1,45,3,66,61,253,170,3,43,0,1,0,53,0,0,3,182,5,129,
+0,8,0,0,33,35,17,1,1,55,1,1,51,3,182,135,254,184,254,78,125,1,53,1,72,135,
+3,215,252,41,5,8,49,252,113,3,215,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,
+17,1,1,55,1,1,53,51,3,182,135,254,184,254,78,125,1,60,1,65,135,3,117,252,
+139,5,8,49,252,93,3,106,129,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,
+55,1,1,17,51,3,182,135,254,184,254,78,127,1,78,1,45,135,2,143,253,113,5,10,
+45,252,43,2,111,1,176,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,
+37,17,51,3,182,135,254,184,254,78,127,1,117,1,6,135,1,55,254,201,5,10,45,
+251,197,250,3,139,0,1,0,53,0,0,3,182,5,129,0,7,0,0,33,33,1,55,1,51,17,51,
+3,182,254,49,254,78,127,1,156,223,135,5,10,45,251,80,4,250,0,1,0,53,0,0,2,
+113,5,129,0,6,0,0,33,35,1,55,1,17,51,2,113,138,254,78,127,1,51,138,5,10,45,
+252,121,3,209,0,1,0,76,0,0,3,182,5,129,0,7,0,0,33,35,17,33,1,39,1,33,3,182,
+135,254,225,254,170,110,1,119,1,243,4,250,253,194,74,2,123,0,1,0,76,0,0,3,
+182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,209,254,186,110,
+1,155,1,72,135,3,145,1,31,254,12,74,2,123,254,205,1,51,0,1,0,76,0,0,3,182,
+5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,176,254,219,110,1,155,
+1,72,135,2,41,2,84,254,63,74,2,123,253,193,2,63,0,1,0,76,0,0,3,182,5,129,
+0,9,0,0,33,35,53,1,1,39,1,1,17,51,3,182,135,254,156,254,239,110,1,155,1,72,
+135,233,3,117,254,94,74,2,123,252,211,3,45,0,1,0,76,0,0,3,182,5,129,0,8,0,
+0,33,35,1,1,39,1,1,17,51,3,182,135,254,158,254,237,110,1,174,1,53,135,4,82,
+254,106,74,2,123,252,61,3,195,0,1,0,104,0,0,2,113,5,129,0,6,0,0,33,35,17,
+1,39,1,51,2,113,138,254,240,111,1,127,138,4,127,254,59,76,2,123,0,1,0,76,
+0,0,3,182,5,129,0,6,0,0,33,35,17,1,39,1,51,3,182,135,253,107,78,2,227,135,
+4,207,253,209,102,2,123,0,1,0,70,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,39,
+1,33,17,51,3,182,135,254,191,254,186,98,1,106,1,127,135,3,227,254,152,92,
+1,147,1,23,0,1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,
+135,254,182,254,195,92,1,155,1,72,135,2,129,1,53,254,219,103,1,121,254,202,
+2,70,0,1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,
+254,152,254,219,86,1,155,1,72,135,1,25,2,129,254,245,105,1,121,253,192,3,
+80,0,1,0,76,0,0,3,182,5,129,0,8,0,0,33,35,1,3,39,1,1,17,51,3,182,135,254,
+105,230,102,1,114,1,113,135,3,182,254,230,92,1,192,252,164,4,37,0,1,0,76,
+0,0,2,113,5,129,0,7,0,0,33,35,17,1,39,1,53,51,2,113,138,254,195,94,1,155,
+138,3,201,254,192,103,1,155,246,0,1,0,160,0,0,3,182,5,129,0,8,0,0,33,35,17,
+3,33,53,33,1,51,3,182,135,231,254,88,1,86,1,57,135,4,90,254,66,135,2,94,0,
+1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,7,33,53,33,1,17,51,3,182,135,242,
+254,99,1,102,1,41,135,3,154,254,135,1,57,1,37,0,1,0,160,0,0,3,182,5,129,0,
+9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,158,254,211,1,98,1,45,135,
+1,37,1,119,135,254,196,3,154,0,1,0,160,0,0,3,182,5,129,0,8,0,0,33,35,1,33,
+53,33,1,17,51,3,182,135,254,168,254,201,1,137,1,6,135,2,156,135,254,4,4,90,
+0,1,0,86,0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,5,1,51,3,182,135,254,193,
+254,102,94,1,10,1,113,135,4,37,253,16,1,140,94,254,3,96,0,1,0,86,0,0,3,182,
+5,129,0,9,0,0,33,35,17,1,1,55,1,1,53,51,3,182,135,254,184,254,111,94,1,19,
+1,104,135,3,127,253,190,1,132,94,254,248,2,120,242,0,1,0,88,0,0,3,182,5,129,
+0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,184,254,113,92,1,51,1,72,
+135,2,109,254,202,1,131,103,254,213,1,49,2,90,0,1,0,86,0,0,3,182,5,129,0,
+9,0,0,33,35,17,33,1,55,1,33,17,51,3,182,135,254,152,254,143,98,1,76,1,43,
+135,1,86,1,109,92,254,190,3,164,0,1,0,86,0,0,3,182,5,129,0,6,0,0,33,35,1,
+55,1,17,51,3,182,135,253,39,94,2,123,135,2,193,94,253,157,4,197,0,1,0,92,
+0,0,2,113,5,129,0,7,0,0,33,35,17,1,55,1,17,51,2,113,138,254,117,92,1,47,138,
+1,51,1,139,103,254,209,3,139,0,1,0,55,0,0,3,182,5,129,0,8,0,0,33,35,17,1,
+1,55,1,1,51,3,182,135,254,203,254,61,113,1,43,1,92,135,3,195,252,61,2,217,
+76,254,24,4,68,0,1,0,55,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,53,51,
+3,182,135,254,184,254,80,111,1,43,1,94,135,3,45,252,211,2,217,76,254,10,3,
+105,233,0,1,0,55,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,
+135,254,184,254,80,111,1,63,1,74,135,2,63,253,193,2,217,76,253,231,2,76,2,
+41,0,1,0,55,255,254,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,
+254,184,254,80,113,1,88,1,47,135,1,88,254,166,2,219,76,253,184,1,66,3,98,
+0,1,0,55,0,0,3,182,5,129,0,7,0,0,33,33,1,55,1,51,17,51,3,182,254,49,254,80,
+113,1,139,252,135,2,217,76,253,98,4,250,0,1,0,55,0,0,2,113,5,129,0,6,0,0,
+33,35,1,55,1,17,51,2,113,138,254,80,113,1,63,138,2,217,76,253,225,4,123,0,
+1,0,72,0,0,3,182,5,129,0,7,0,0,33,35,17,35,1,39,1,33,3,182,135,237,254,127,
+121,1,153,1,213,4,250,252,92,49,3,250,0,1,0,70,0,0,3,182,5,129,0,9,0,0,33,
+35,17,1,1,39,1,1,17,51,3,182,135,254,227,254,175,123,1,155,1,78,135,3,121,
+1,16,252,205,49,3,250,254,176,1,80,0,1,0,70,0,0,3,182,5,129,0,9,0,0,33,35,
+17,1,1,39,1,1,17,51,3,182,135,254,207,254,195,123,1,161,1,72,135,2,98,1,242,
+253,2,49,3,250,253,231,2,25,0,1,0,70,0,0,3,182,5,131,0,9,0,0,33,35,53,1,1,
+39,1,1,17,51,3,182,135,254,180,254,222,123,1,161,1,72,135,158,3,116,253,68,
+49,3,252,252,162,3,92,0,1,0,70,0,0,3,182,5,129,0,8,0,0,33,35,1,1,39,1,1,17,
+51,3,182,135,254,172,254,230,123,1,161,1,72,135,3,254,253,88,49,3,250,252,
+41,3,215,0,1,0,70,0,0,2,113,5,129,0,6,0,0,33,35,17,1,39,1,51,2,113,138,254,
+218,123,1,161,138,4,29,253,57,49,3,250,0,1,0,129,0,0,3,182,5,129,0,8,0,0,
+33,35,17,7,1,39,1,1,51,3,182,135,223,254,168,119,1,98,1,76,135,4,195,203,
+253,94,61,2,185,1,53,0,1,0,129,0,0,3,182,5,129,0,9,0,0,33,35,17,35,1,39,1,
+33,17,51,3,182,135,233,254,178,119,1,115,1,59,135,3,227,253,115,61,2,215,
+1,23,0,1,0,57,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,
+254,209,254,174,117,1,174,1,72,135,2,88,1,141,253,113,72,3,69,254,84,2,74,
+0,1,0,57,0,0,3,182,5,129,0,9,0,0,33,35,53,1,1,39,1,1,17,51,3,182,135,254,
+176,254,207,117,1,174,1,72,135,180,2,240,253,178,72,3,71,253,31,3,125,0,1,
+0,57,0,0,3,182,5,129,0,8,0,0,33,35,1,1,39,1,1,17,51,3,182,135,254,168,254,
+215,117,1,174,1,72,135,3,147,253,195,72,3,71,252,150,4,6,0,1,0,57,0,0,2,113,
+5,129,0,7,0,0,33,35,17,1,39,1,53,51,2,113,138,254,201,119,1,174,138,3,184,
+253,160,62,3,75,160,0,1,0,145,0,0,3,182,5,129,0,8,0,0,33,35,17,3,1,39,1,1,
+51,3,182,135,217,254,150,91,1,86,1,72,135,4,90,254,100,254,152,98,1,86,2,
+115,0,1,0,145,0,0,3,182,5,129,0,7,0,0,1,1,39,1,53,51,17,35,3,47,253,189,91,
+2,158,135,135,3,219,253,123,98,2,228,229,250,127,0,1,0,145,0,0,3,182,5,129,
+0,9,0,0,33,35,17,33,1,39,1,33,17,51,3,182,135,254,223,254,222,91,1,72,1,86,
+135,2,156,254,186,98,1,107,2,94,0,1,0,145,0,0,3,182,5,129,0,9,0,0,33,35,17,
+1,1,39,1,1,17,51,3,182,135,254,189,255,0,91,1,86,1,72,135,1,66,1,49,254,227,
+98,1,121,254,205,3,131,0,1,0,145,0,0,3,182,5,129,0,8,0,0,33,35,1,7,39,1,1,
+17,51,3,182,135,254,158,221,95,1,86,1,72,135,2,76,248,100,1,121,253,211,4,
+125,0,1,0,76,0,0,2,113,5,129,0,7,0,0,33,35,17,1,39,1,17,51,2,113,138,254,
+195,94,1,155,138,2,147,254,195,100,1,156,2,43,0,1,0,160,0,0,3,182,5,129,0,
+8,0,0,33,35,17,3,33,53,33,1,51,3,182,135,219,254,76,1,82,1,61,135,3,215,253,
+127,135,3,164,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,3,33,53,33,1,17,
+51,3,182,135,240,254,97,1,78,1,65,135,3,37,254,49,135,2,111,1,53,0,1,0,160,
+0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,213,254,
+156,1,30,1,113,135,2,147,254,195,135,1,135,2,29,0,1,0,160,0,0,3,182,5,129,
+0,8,0,0,1,33,53,33,1,17,51,17,35,1,190,254,226,1,100,1,43,135,135,1,86,135,
+254,236,4,184,250,127,0,1,0,76,0,0,3,182,5,129,0,8,0,0,33,35,17,1,1,55,5,
+1,51,3,182,135,254,184,254,101,92,1,0,1,135,135,3,211,252,45,1,121,102,235,
+4,141,0,1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,5,1,53,51,3,182,135,
+254,184,254,101,92,1,10,1,125,135,3,86,252,170,1,121,102,248,3,218,192,0,
+1,0,76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,184,
+254,101,92,1,29,1,106,135,2,63,253,193,1,121,102,254,250,2,127,2,41,0,1,0,
+76,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,55,1,1,17,51,3,182,135,254,184,254,
+101,92,1,61,1,74,135,1,51,254,205,1,121,102,254,219,1,54,3,145,0,1,0,80,0,
+0,3,182,5,129,0,7,0,0,33,33,1,55,1,33,17,51,3,182,254,49,254,105,92,1,121,
+1,10,135,1,119,104,254,168,4,250,0,1,0,80,0,0,2,113,5,129,0,6,0,0,33,35,1,
+55,1,17,51,2,113,138,254,105,92,1,59,138,1,119,104,254,223,4,195,0,1,0,47,
+0,0,3,182,5,129,0,7,0,0,33,35,17,35,1,39,1,33,3,182,135,235,254,108,129,1,
+178,1,213,4,250,251,6,45,5,84,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,37,
+1,39,1,1,17,51,3,182,135,254,250,254,139,127,1,178,1,72,135,3,139,250,251,
+123,45,5,84,254,201,1,55,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,
+1,1,17,51,3,182,135,254,219,254,170,127,1,178,1,72,135,2,74,1,237,251,201,
+45,5,84,253,213,2,43,0,1,0,23,0,0,3,182,5,129,0,9,0,0,33,35,53,1,1,39,1,1,
+17,51,3,182,135,254,195,254,164,127,1,208,1,72,135,233,3,17,252,8,47,5,80,
+252,219,3,37,0,1,0,29,0,0,3,182,5,129,0,8,0,0,33,35,1,1,39,1,1,17,51,3,182,
+135,254,184,254,179,125,1,202,1,72,135,3,215,252,41,47,5,82,252,41,3,215,
+0,1,0,41,0,0,2,113,5,129,0,6,0,0,33,35,17,1,39,1,51,2,113,138,254,195,129,
+1,190,138,3,215,252,41,45,5,84,0,1,0,47,0,0,3,182,5,129,0,8,0,0,33,35,17,
+7,1,39,1,1,51,3,182,135,213,254,84,127,1,184,1,72,135,4,195,215,252,20,55,
+4,2,1,72,0,1,0,39,0,0,3,182,5,129,0,9,0,0,33,35,17,35,1,39,1,33,17,51,3,182,
+135,244,254,101,121,1,180,1,84,135,3,227,252,29,49,4,57,1,23,0,1,0,37,0,0,
+3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,254,227,254,142,123,
+1,188,1,78,135,2,113,1,18,252,125,49,4,74,254,176,2,86,0,1,0,37,0,0,3,182,
+5,129,0,9,0,0,33,35,53,1,1,39,1,1,17,51,3,182,135,254,215,254,158,127,1,215,
+1,51,135,199,2,104,252,209,53,4,64,253,129,3,139,0,1,0,37,0,0,3,182,5,129,
+0,8,0,0,33,35,1,1,39,1,1,17,51,3,182,135,254,184,254,185,123,1,194,1,72,135,
+3,35,252,221,49,4,90,252,221,4,25,0,1,0,37,0,0,2,113,5,129,0,7,0,0,33,35,
+17,1,39,1,53,51,2,113,138,254,185,123,1,194,138,3,121,252,135,49,4,193,143,
+0,1,0,72,0,0,3,182,5,129,0,6,0,0,33,35,17,1,39,1,51,3,182,135,253,143,118,
+2,231,135,4,102,251,154,68,5,61,0,1,0,45,0,0,3,182,5,129,0,9,0,0,33,35,17,
+7,1,39,1,1,17,51,3,182,135,248,254,109,119,1,160,1,98,135,3,178,248,253,70,
+70,2,202,1,99,1,14,0,1,0,80,0,0,3,182,5,129,0,9,0,0,33,35,17,33,1,39,1,33,
+17,51,3,182,135,254,248,254,156,115,1,135,1,88,135,2,156,253,100,72,2,219,
+2,94,0,1,0,53,0,0,3,182,5,129,0,9,0,0,33,35,17,1,1,39,1,1,17,51,3,182,135,
+254,209,254,160,107,1,174,1,76,135,1,33,1,45,253,178,76,2,227,254,176,3,162,
+0,1,0,53,0,0,3,182,5,129,0,8,0,0,33,35,1,1,39,1,1,17,51,3,182,135,254,184,
+254,185,107,1,174,1,76,135,2,33,253,223,78,2,227,253,215,4,121,0,1,0,45,0,
+0,2,113,5,129,0,7,0,0,33,35,17,1,39,1,17,51,2,113,138,254,185,115,1,186,138,
+2,33,253,223,72,2,227,2,86,0,1,0,70,0,0,3,182,5,129,0,8,0,0,33,35,17,3,1,
+39,1,1,51,3,182,135,225,254,82,90,1,143,1,90,135,3,250,253,156,254,106,102,
+1,121,3,162,0,1,0,78,0,0,3,182,5,129,0,9,0,0,33,35,17,3,1,39,1,1,53,51,3,
+182,135,219,254,76,82,1,153,1,72,135,3,104,254,48,254,104,106,1,134,2,166,
+235,0,1,0,78,0,0,3,182,5,129,0,7,0,0,33,35,17,1,39,1,17,51,3,182,135,253,
+125,94,2,225,135,2,115,253,153,94,2,205,2,74,0,1,0,82,0,0,3,182,5,129,0,9,
+0,0,33,35,17,33,1,39,1,33,17,51,3,182,135,254,205,254,184,98,1,113,1,108,
+135,1,86,254,180,96,1,115,3,164,0,1,0,78,0,0,3,182,5,129,0,8,0,0,33,35,1,
+1,39,1,1,17,51,3,182,135,254,184,254,195,92,1,153,1,72,135,1,51,254,213,96,
+1,134,254,204,4,199,0,1,0,70,0,0,2,113,5,129,0,7,0,0,33,35,17,1,39,1,17,51,
+2,113,138,254,185,90,1,161,138,1,41,254,215,100,1,127,3,158,0,1,0,160,0,0,
+3,182,5,129,0,8,0,0,33,35,17,1,33,53,33,1,51,3,182,135,254,223,254,146,1,
+14,1,129,135,3,188,252,68,135,4,250,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,
+35,17,1,33,53,33,1,53,51,3,182,135,254,223,254,146,1,16,1,127,135,3,39,252,
+217,135,4,41,209,0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,
+17,51,3,182,135,254,225,254,144,1,28,1,115,135,2,68,253,188,135,2,244,2,6,
+0,1,0,160,0,0,3,182,5,129,0,9,0,0,33,35,17,1,33,53,33,1,17,51,3,182,135,254,
+213,254,156,1,51,1,92,135,1,43,254,213,135,1,92,3,158,255,255,0,113,255,236,
+4,197,6,242,18,34,1,126,0,0,16,2,9,65,72,0,255,255,0,113,255,236,4,197,6,
+242,18,34,1,126,0,0,16,2,9,66,72,0,255,255,0,113,255,236,4,197,6,242,18,34,
+1,126,0,0,16,2,9,67,72,0,255,255,0,113,255,236,4,197,6,242,18,34,1,126,0,
+0,16,2,9,68,72,0,255,255,0,113,255,236,4,197,7,68,18,34,1,126,0,0,16,2,9,
+89,61,0,255,255,0,113,255,236,4,197,7,68,18,34,1,126,0,0,16,2,9,88,61,0,255,
+255,0,113,255,236,4,197,7,68,18,34,1,126,0,0,16,2,9,87,61,0,255,255,0,113,
+255,236,4,197,7,68,18,34,1,126,0,0,16,2,9,86,61,0,255,255,0,5,255,236,2,168,
+6,242,18,34,1,134,0,0,16,3,9,65,255,46,0,0,255,255,0,5,255,236,2,168,6,242,
+18,34,1,134,0,0,16,3,9,66,255,46,0,0,255,255,0,3,255,236,2,168,6,242,18,34,
+1,134,0,0,16,3,9,67,255,46,0,0,255,255,0,5,255,236,2,168,6,242,18,34,1,134,
+0,0,16,3,9,68,255,46,0,0,255,255,0,15,255,236,2,168,7,68,18,34,1,134,0,0,
+16,3,9,89,255,46,0,0,255,255,255,255,255,236,2,168,7,68,18,34,1,134,0,0,16,
+3,9,88,255,30,0,0,255,255,0,15,255,236,2,168,7,68,18,34,1,134,0,0,16,3,9,
+87,255,48,0,0,255,255,0,13,255,236,2,168,7,68,18,34,1,134,0,0,16,3,9,86,255,
+44,0,0,255,255,0,37,255,236,4,78,6,242,18,34,1,146,0,0,16,2,9,65,115,0,255,
+255,0,37,255,236,4,78,6,242,18,34,1,146,0,0,16,2,9,66,115,0,255,255,0,37,
+255,236,4,78,6,242,18,34,1,146,0,0,16,2,9,67,115,0,255,255,0,37,255,236,4,
+78,6,242,18,34,1,146,0,0,16,2,9,68,115,0,255,255,0,37,255,236,4,78,7,68,18,
+34,1,146,0,0,16,2,9,89,115,0,255,255,0,37,255,236,4,78,7,68,18,34,1,146,0,
+0,16,2,9,88,98,0,255,255,0,37,255,236,4,78,7,68,18,34,1,146,0,0,16,2,9,87,
+115,0,255,255,0,37,255,236,4,78,7,68,18,34,1,146,0,0,16,2,9,86,115,0,255,
+255,0,3,255,236,2,168,7,133,18,34,1,134,0,0,16,3,9,85,255,46,0,0,255,255,
+0,3,255,236,2,168,7,133,18,34,1,134,0,0,16,3,9,84,255,46,0,0,255,255,0,3,
+255,236,2,168,7,141,18,34,1,134,0,0,16,3,9,83,255,46,0,0,255,255,0,3,255,
+236,2,168,7,141,18,34,1,134,0,0,16,3,9,82,255,46,0,0,255,255,0,37,255,236,
+4,78,7,133,18,34,1,146,0,0,16,2,9,85,115,0,255,255,0,37,255,236,4,78,7,133,
+18,34,1,146,0,0,16,2,9,84,115,0,255,255,0,37,255,236,4,78,7,141,18,34,1,146,
+0,0,16,2,9,83,115,0,255,255,0,37,255,236,4,78,7,141,18,34,1,146,0,0,16,2,
+9,82,115,0,0,1,0,78,254,20,5,92,5,203,0,43,0,0,5,20,6,35,35,53,51,50,54,53,
+17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,
+33,23,51,54,54,51,50,22,21,5,92,232,235,35,19,149,127,143,154,180,209,71,
+97,27,253,172,26,96,72,72,96,26,1,102,31,8,79,223,141,224,230,16,239,237,
+97,184,193,4,26,152,155,218,169,253,49,73,74,86,86,72,75,3,228,75,72,86,233,
+124,130,232,231,0,1,0,78,254,20,6,31,5,182,0,43,0,0,37,20,22,51,51,21,33,
+53,51,50,54,53,17,52,38,35,35,53,33,1,17,52,38,35,35,53,33,21,35,34,6,21,
+17,20,6,35,35,53,51,50,54,53,53,1,1,141,71,97,27,253,254,26,96,72,71,97,26,
+1,119,3,26,71,97,26,2,2,27,97,71,139,172,47,28,111,94,252,174,233,73,74,86,
+86,72,75,3,236,68,71,86,251,156,3,131,68,71,86,86,74,73,251,35,252,224,97,
+182,195,18,4,176,0,1,0,78,255,236,5,92,5,203,0,43,0,0,1,20,6,35,35,53,51,
+50,54,53,17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,
+35,35,53,33,23,51,54,54,51,50,22,21,5,92,229,238,35,19,149,127,143,154,180,
+209,71,97,27,253,172,26,96,72,72,96,26,1,102,31,8,79,223,141,224,230,1,199,
+236,239,96,184,193,2,67,152,155,218,169,253,49,73,74,86,86,72,75,3,228,75,
+72,86,233,124,130,232,231,0,2,0,180,255,236,4,86,6,27,0,19,0,50,0,0,4,38,
+53,17,52,54,51,50,22,21,20,6,7,21,22,22,21,20,6,35,54,54,53,52,38,39,6,6,
+35,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,6,21,17,20,22,51,1,168,
+244,226,217,213,215,137,117,167,146,239,222,127,135,108,123,26,66,37,34,44,
+57,56,16,67,31,75,85,129,110,118,130,138,136,20,245,226,2,196,200,204,177,
+157,119,185,46,13,55,201,157,230,243,106,177,188,150,173,39,11,18,34,32,35,
+41,8,9,26,149,122,123,141,147,135,253,33,185,182,0,3,0,215,4,217,3,41,6,242,
+0,3,0,19,0,29,0,0,1,33,53,33,36,6,7,53,54,54,53,52,38,53,52,54,51,50,22,21,
+5,35,38,38,39,53,51,22,22,23,3,41,253,174,2,82,254,178,120,122,60,57,98,50,
+46,59,68,1,70,68,51,139,11,185,7,56,21,4,217,121,211,115,31,62,22,46,38,27,
+37,43,37,39,70,57,209,55,207,45,20,61,191,49,0,3,0,215,4,217,3,43,6,242,0,
+15,0,25,0,29,0,0,0,6,7,53,54,54,53,52,38,53,52,54,51,50,22,21,23,54,54,55,
+51,21,6,6,7,35,5,33,53,33,1,240,120,122,60,57,99,51,46,58,69,47,29,46,9,184,
+11,135,55,67,1,10,253,174,2,82,6,37,115,31,62,22,46,38,27,36,44,38,38,69,
+58,183,74,168,59,20,47,201,59,201,121,0,3,0,213,4,217,3,41,6,242,0,3,0,19,
+0,29,0,0,1,33,53,33,0,54,51,50,22,21,20,6,21,20,22,23,21,38,38,53,5,35,38,
+38,39,53,51,22,22,23,3,41,253,174,2,82,253,172,68,59,46,50,98,57,60,122,120,
+2,45,68,52,137,11,184,7,56,21,4,217,121,1,90,70,39,37,43,37,27,38,46,22,62,
+31,115,78,209,55,205,47,20,61,191,49,0,3,0,215,4,217,3,41,6,242,0,15,0,25,
+0,29,0,0,18,54,51,50,22,21,20,6,21,20,22,23,21,38,38,53,5,54,54,55,51,21,
+6,6,7,35,5,33,53,33,227,68,59,46,51,99,57,60,122,120,1,54,29,46,9,184,10,
+134,57,67,1,16,253,174,2,82,6,172,70,38,38,44,36,27,38,46,22,62,31,115,78,
+183,74,168,59,20,43,203,61,201,121,0,2,1,10,4,217,3,147,6,33,0,9,0,21,0,0,
+1,54,54,55,51,21,6,6,7,35,38,54,51,50,22,21,20,6,35,34,38,53,2,6,47,103,28,
+219,39,207,73,78,252,59,46,44,60,61,43,45,60,4,244,62,177,62,21,55,202,50,
+231,52,52,63,62,53,53,62,0,2,1,33,4,217,3,125,6,233,0,11,0,28,0,0,0,54,51,
+50,22,21,20,6,35,34,38,53,7,51,22,22,23,54,54,55,51,21,6,6,7,35,38,38,39,
+1,229,50,55,51,53,61,43,45,60,196,80,56,117,48,50,116,57,80,57,119,29,194,
+27,129,49,6,174,59,57,57,62,53,53,62,86,35,100,52,54,98,35,27,69,171,61,58,
+184,59,0,3,0,213,4,217,3,43,6,193,0,3,0,15,0,27,0,0,1,33,53,33,0,54,51,50,
+22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,3,41,253,174,2,
+82,253,172,53,51,52,53,53,52,45,59,1,133,59,46,44,60,61,43,45,60,4,217,121,
+1,53,58,60,55,53,62,53,62,63,52,52,63,62,53,53,62,0,3,0,225,4,217,3,186,6,
+254,0,19,0,31,0,43,0,0,0,54,55,51,6,6,35,34,38,35,34,6,7,35,54,54,51,50,22,
+51,0,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,3,
+39,46,9,92,7,111,97,86,191,44,47,46,8,92,7,113,97,87,190,43,254,41,53,51,
+52,53,54,51,45,59,1,133,53,51,52,53,54,51,45,59,5,94,39,60,108,124,98,40,
+58,110,122,99,1,102,58,60,55,54,60,52,62,57,58,60,55,54,60,52,62,255,255,
+1,2,254,20,2,178,6,170,16,67,8,18,4,213,0,0,192,0,64,0,0,2,0,225,4,217,3,
+186,6,248,0,19,0,29,0,0,0,54,55,51,6,6,35,34,38,35,34,6,7,35,54,54,51,50,
+22,51,37,54,54,55,51,21,6,6,7,35,3,39,46,9,92,7,111,97,86,191,44,47,46,8,
+92,7,113,97,87,190,43,254,215,46,80,21,219,31,164,93,78,5,94,39,60,108,124,
+98,40,58,110,122,99,160,63,130,57,21,45,146,65,0,2,0,215,4,217,3,41,6,248,
+0,9,0,13,0,0,1,35,38,38,39,53,51,22,22,23,19,33,53,33,2,92,78,67,180,41,219,
+18,87,42,205,253,174,2,82,5,197,44,184,58,21,51,167,63,254,250,121,0,2,0,
+215,4,217,3,41,6,248,0,3,0,13,0,0,1,33,53,33,37,54,54,55,51,21,6,6,7,35,3,
+41,253,174,2,82,254,123,40,82,25,219,41,178,69,78,4,217,121,141,59,155,67,
+21,59,180,47,0,3,1,23,4,209,3,135,6,248,0,11,0,23,0,40,0,0,0,54,51,50,22,
+21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,19,6,6,7,35,38,38,
+39,53,51,22,22,23,54,54,55,51,1,35,51,53,54,51,53,52,45,59,1,135,51,53,54,
+51,53,52,45,59,221,97,98,22,192,21,103,91,90,58,112,51,49,115,59,90,5,123,
+59,61,53,53,62,53,62,55,59,61,53,53,62,53,62,1,153,101,118,41,40,125,95,27,
+32,79,45,45,79,32,0,3,1,35,4,229,3,123,6,174,0,3,0,15,0,27,0,0,1,33,53,33,
+0,54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,3,119,
+253,176,2,80,253,172,53,51,52,53,53,52,45,59,1,135,53,51,52,53,53,52,45,59,
+6,53,121,254,227,58,60,55,53,62,53,62,57,58,60,55,53,62,53,62,0,2,0,147,4,
+217,3,109,6,174,0,19,0,23,0,0,0,54,55,51,6,6,35,34,38,35,34,6,7,35,54,54,
+51,50,22,51,55,33,53,33,2,217,46,9,93,7,109,99,87,191,44,44,47,9,93,7,110,
+101,85,191,43,125,253,174,2,82,5,94,39,60,105,127,98,36,62,105,127,99,215,
+121,0,2,0,215,4,219,3,41,6,174,0,11,0,15,0,0,0,54,51,50,22,21,20,6,35,34,
+38,53,37,33,53,33,1,152,53,51,44,60,61,43,45,59,1,145,253,174,2,82,5,135,
+58,52,63,62,53,53,62,231,121,255,255,2,33,254,20,3,209,6,170,16,67,8,19,4,
+213,0,0,192,0,64,0,0,4,0,213,4,209,3,43,7,141,0,11,0,23,0,37,0,47,0,0,18,
+54,51,50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,19,6,6,
+35,34,38,39,51,22,22,51,50,54,55,33,54,54,55,51,21,6,6,7,35,213,58,46,51,
+54,54,51,45,59,1,133,59,46,44,60,56,48,46,59,197,12,150,125,131,146,10,99,
+21,78,91,72,94,25,254,249,32,72,23,181,36,145,49,78,5,113,47,54,49,50,54,
+47,57,56,47,47,56,54,50,47,57,1,140,125,142,140,127,69,56,60,65,38,112,50,
+20,46,130,31,0,4,0,213,4,209,3,43,7,141,0,11,0,23,0,37,0,47,0,0,18,54,51,
+50,22,21,20,6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,19,6,6,35,34,
+38,39,51,22,22,51,50,54,55,7,35,38,38,39,53,51,22,22,23,213,58,46,51,54,54,
+51,45,59,1,133,59,46,44,60,56,48,46,59,197,12,150,125,131,146,10,99,21,78,
+91,72,94,25,119,78,51,148,30,180,16,78,33,5,113,47,54,49,50,54,47,57,56,47,
+47,56,54,50,47,57,1,140,125,142,140,127,69,56,60,65,27,32,134,41,20,39,122,
+39,0,4,0,213,4,209,3,43,7,133,0,11,0,23,0,27,0,37,0,0,18,54,51,50,22,21,20,
+6,35,34,38,53,36,54,51,50,22,21,20,6,35,34,38,53,55,33,53,33,37,54,54,55,
+51,21,6,6,7,35,213,58,46,51,54,54,51,45,59,1,133,59,46,44,60,56,48,46,59,
+207,253,174,2,82,254,127,34,72,21,180,28,148,53,78,5,113,47,54,49,50,54,47,
+57,56,47,47,56,54,50,47,57,170,121,96,40,114,47,20,39,135,33,0,4,0,213,4,
+209,3,43,7,133,0,11,0,23,0,27,0,37,0,0,18,54,51,50,22,21,20,6,35,34,38,53,
+36,54,51,50,22,21,20,6,35,34,38,53,55,33,53,33,39,35,38,38,39,53,51,22,22,
+23,213,58,46,51,54,54,51,45,59,1,133,59,46,44,60,56,48,46,59,207,253,174,
+2,82,209,78,53,148,28,180,21,72,34,5,113,47,54,49,50,54,47,57,56,47,47,56,
+54,50,47,57,170,121,70,33,135,39,20,47,114,40,0,3,0,225,4,197,3,37,7,68,0,
+13,0,29,0,39,0,0,0,38,39,51,22,22,51,50,54,55,51,6,6,35,0,54,51,50,22,21,
+20,6,21,20,22,23,21,38,38,53,5,54,54,55,51,21,6,6,7,35,1,123,152,2,94,17,
+101,75,75,101,17,94,5,152,130,254,227,68,59,46,51,99,57,60,122,120,1,54,29,
+46,9,184,10,134,57,67,4,197,146,103,58,50,50,58,108,141,2,57,70,38,38,44,
+36,27,38,47,21,62,31,115,78,183,74,168,59,20,43,203,61,0,3,0,223,4,197,3,
+31,7,68,0,13,0,29,0,39,0,0,0,38,39,51,22,22,51,50,54,55,51,6,6,35,0,54,51,
+50,22,21,20,6,21,20,22,23,21,38,38,53,5,35,38,38,39,53,51,22,22,23,1,123,
+152,2,94,17,101,75,75,101,17,94,5,152,130,254,223,68,59,47,49,98,57,60,122,
+120,2,45,67,55,135,11,184,9,46,29,4,197,146,103,58,50,50,58,108,141,2,57,
+70,39,37,43,37,27,38,47,21,62,31,115,78,209,59,201,47,20,59,168,74,0,3,0,
+225,4,197,3,63,7,68,0,13,0,29,0,39,0,0,0,38,39,51,22,22,51,50,54,55,51,6,
+6,35,18,6,7,53,54,54,53,52,38,53,52,54,51,50,22,21,23,54,54,55,51,21,6,6,
+7,35,1,123,152,2,94,17,101,75,75,101,17,94,5,152,130,4,120,122,60,57,98,50,
+46,59,68,47,20,52,12,184,11,137,52,68,4,197,146,103,58,50,50,58,108,141,1,
+178,115,31,62,21,47,38,27,37,43,37,39,70,57,183,46,178,77,20,47,205,55,0,
+3,0,225,4,197,3,31,7,68,0,13,0,29,0,39,0,0,0,38,39,51,22,22,51,50,54,55,51,
+6,6,35,2,6,7,53,54,54,53,52,38,53,52,54,51,50,22,21,5,35,38,38,39,53,51,22,
+22,23,1,123,152,2,94,17,101,75,75,101,17,94,5,152,130,43,120,122,60,57,98,
+50,46,59,68,1,70,68,57,134,10,185,7,56,21,4,197,146,103,58,50,50,58,108,141,
+1,178,115,31,62,21,47,38,27,37,43,37,39,70,57,209,61,203,43,20,61,191,49,
+0,1,0,0,255,242,7,190,5,182,0,86,0,0,1,33,21,35,34,6,21,20,22,23,19,19,54,
+54,53,52,38,35,35,53,33,21,35,34,6,7,1,1,22,22,51,51,21,33,53,51,50,53,52,
+38,39,3,3,6,6,21,20,22,51,51,21,33,53,51,50,54,55,1,1,38,38,35,35,6,2,2,6,
+35,34,38,53,52,54,51,20,22,51,50,54,54,18,18,53,52,38,35,35,1,55,3,166,8,
+56,59,25,24,185,194,23,29,62,47,8,1,192,18,62,84,57,254,215,1,121,40,86,38,
+26,253,216,10,123,38,30,203,227,17,36,63,68,8,254,25,12,67,84,62,1,86,254,
+133,11,18,20,178,12,74,104,141,130,82,82,48,42,57,43,81,82,65,55,33,66,98,
+31,5,182,86,26,33,28,54,39,254,213,1,39,35,62,28,37,22,86,86,65,82,254,84,
+253,162,63,46,86,86,68,28,64,49,1,70,254,176,25,81,29,35,29,86,86,55,88,1,
+234,2,100,20,9,251,253,200,254,132,175,75,68,53,72,35,61,140,227,1,73,1,85,
+97,43,41,0,1,0,0,255,242,6,223,4,74,0,84,0,0,1,10,2,35,34,38,53,52,54,51,
+20,22,51,50,54,54,18,53,52,38,35,35,53,33,21,35,34,6,21,20,22,23,23,55,54,
+54,53,52,38,35,35,53,33,21,35,34,6,7,3,1,22,22,51,51,21,33,53,51,50,53,52,
+38,39,39,7,6,6,21,20,22,51,51,21,33,53,51,50,54,55,1,1,38,38,35,2,76,30,100,
+141,153,82,82,48,42,57,43,77,80,66,58,73,95,27,3,111,6,62,55,24,23,135,107,
+23,28,63,47,7,1,193,18,71,84,52,211,1,45,45,80,39,26,253,240,10,123,35,43,
+137,143,22,34,59,68,6,254,25,18,74,87,63,1,2,254,215,21,23,28,3,236,254,230,
+254,34,254,254,75,68,53,72,35,61,125,218,1,52,76,62,65,86,86,30,30,21,41,
+32,184,153,35,62,28,37,23,86,86,62,69,254,231,254,107,60,49,86,86,68,24,60,
+57,184,200,30,70,29,35,29,86,86,51,80,1,78,1,149,28,20,0,2,0,78,0,0,6,217,
+5,182,0,58,0,67,0,0,37,22,22,51,51,21,33,53,51,50,53,52,38,39,3,6,6,35,35,
+17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,50,22,21,20,7,19,
+54,54,53,52,38,35,35,53,33,21,35,34,6,7,1,5,51,50,54,53,52,38,35,35,6,27,
+45,80,38,27,253,215,10,123,47,20,252,65,204,147,119,71,97,68,253,131,26,96,
+72,71,97,26,2,53,246,254,23,232,23,28,50,61,6,1,203,8,63,102,56,254,182,253,
+61,109,190,158,151,167,139,195,60,49,86,86,68,31,77,33,1,149,60,71,254,166,
+69,68,86,86,72,75,3,236,68,71,86,220,208,82,75,1,59,35,62,28,30,29,86,86,
+72,75,254,84,135,168,192,180,158,0,3,0,27,254,20,6,137,4,94,0,67,0,79,0,80,
+0,0,0,22,23,55,54,54,53,52,38,35,35,53,33,21,35,34,6,7,3,1,22,22,51,51,21,
+33,53,51,50,53,52,38,39,39,6,6,35,34,38,39,35,20,22,21,21,20,22,51,51,21,
+33,53,51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,6,6,21,20,22,51,50,
+54,53,52,38,35,1,3,137,206,22,102,23,28,63,47,7,1,193,19,70,84,52,211,1,45,
+45,80,39,26,253,240,10,123,35,43,72,29,205,167,108,156,49,8,8,71,97,6,253,
+217,16,97,71,74,94,26,1,102,21,8,54,153,106,185,128,132,148,128,124,118,136,
+1,197,4,94,211,227,147,35,62,28,37,23,86,86,62,69,254,231,254,107,60,49,86,
+86,68,24,60,57,98,208,205,91,89,15,191,26,196,69,69,86,86,75,73,4,106,70,
+70,86,185,109,96,131,196,240,237,203,213,229,218,216,254,84,0,2,255,233,0,
+0,6,236,5,182,0,44,0,53,0,0,1,19,35,39,38,38,35,33,17,33,21,33,17,33,50,54,
+55,55,51,3,33,53,51,50,54,53,17,35,1,6,6,35,35,53,51,50,54,55,1,38,38,53,
+52,36,33,23,35,34,6,21,20,22,51,51,6,156,10,107,10,10,93,77,254,168,1,237,
+254,19,1,139,81,99,15,14,107,15,251,193,26,97,71,202,254,247,76,148,167,29,
+7,63,100,52,1,8,135,140,1,20,1,11,133,100,188,168,160,149,147,5,182,254,154,
+88,86,82,253,223,100,253,155,83,85,88,254,154,86,68,69,1,152,254,65,127,57,
+86,80,84,1,166,48,199,150,200,193,98,150,172,154,161,0,3,0,16,255,236,6,53,
+4,94,0,41,0,50,0,57,0,0,4,2,39,35,3,6,6,35,53,51,50,54,55,19,38,38,53,52,
+54,51,33,21,54,54,51,50,22,21,21,33,22,22,51,50,54,55,22,22,21,20,6,35,1,
+34,6,21,20,22,51,51,17,36,6,7,33,52,38,35,3,208,235,12,174,170,57,170,142,
+7,52,75,40,181,119,150,209,205,1,125,51,132,83,204,222,253,86,4,146,155,96,
+158,39,14,25,201,159,253,110,109,116,116,109,199,1,64,124,14,1,219,110,113,
+20,1,5,242,254,195,109,57,86,54,69,1,55,23,154,110,143,148,88,51,57,255,234,
+94,214,212,82,61,6,38,26,75,127,4,0,109,96,103,114,1,166,4,185,178,179,184,
+0,1,0,78,0,0,5,123,5,195,0,69,0,0,0,6,7,38,38,35,34,6,7,23,7,39,6,6,7,22,
+22,23,19,22,22,51,51,21,35,34,38,39,3,38,38,35,17,20,22,51,51,21,33,53,51,
+50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,50,54,54,55,39,55,23,54,54,
+51,50,22,21,5,74,57,42,10,63,47,57,108,57,226,56,215,65,54,32,84,114,60,192,
+48,113,69,6,29,188,155,66,187,48,103,148,71,97,27,253,172,26,97,71,71,97,
+26,2,84,27,97,71,108,70,73,61,173,56,162,84,166,102,81,85,5,11,74,9,55,60,
+102,109,147,80,141,132,91,29,3,65,110,254,166,87,77,86,66,127,1,100,92,47,
+254,57,73,74,86,86,68,69,3,246,68,71,86,86,74,73,254,65,43,131,121,115,80,
+109,164,148,67,62,0,1,0,37,0,0,4,215,4,86,0,69,0,0,33,34,38,39,39,38,38,35,
+17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,
+50,54,55,39,55,23,55,54,54,51,50,22,21,20,6,7,38,38,35,34,6,7,23,7,39,6,6,
+7,22,22,23,23,22,22,51,51,21,4,143,164,144,60,101,45,97,122,71,97,6,253,197,
+37,97,71,74,94,37,2,59,6,94,74,80,88,86,127,55,127,59,46,106,82,87,89,54,
+44,9,62,44,47,79,48,207,53,209,37,55,31,79,115,56,107,48,112,69,6,78,115,
+198,87,52,254,205,69,68,86,86,74,73,2,127,70,70,86,86,64,65,254,254,52,128,
+82,82,82,88,68,67,69,56,52,68,9,54,61,68,69,132,81,131,51,63,22,3,73,102,
+188,87,77,86,0,1,0,0,254,0,7,113,5,182,0,71,0,0,1,54,51,50,4,18,21,16,0,33,
+34,38,53,52,54,51,20,22,51,50,18,17,16,0,35,34,7,17,20,22,51,51,21,33,53,
+51,50,54,53,17,33,6,2,2,6,35,34,38,53,52,54,51,20,22,51,50,54,54,18,18,53,
+52,38,35,35,53,33,21,35,34,6,21,4,80,73,109,166,1,39,158,254,210,254,236,
+206,216,91,81,123,127,177,194,254,230,214,52,46,71,97,26,253,172,27,94,74,
+254,240,12,74,104,141,130,82,82,48,42,57,43,81,82,65,55,33,66,98,31,3,240,
+47,94,74,3,23,12,153,254,221,201,254,184,254,170,118,99,71,77,125,127,1,24,
+1,17,1,2,1,14,6,254,59,69,68,86,86,64,65,4,121,251,253,200,254,132,175,75,
+68,53,72,35,61,140,227,1,73,1,85,97,43,41,86,86,64,65,0,1,0,0,254,20,6,147,
+4,74,0,69,0,0,1,54,54,51,50,0,17,16,2,35,34,38,53,52,51,20,22,51,50,54,53,
+52,38,35,34,6,7,17,20,22,51,51,21,33,53,51,50,54,53,17,33,10,2,35,34,38,53,
+52,54,51,20,22,51,50,54,54,18,53,52,38,35,35,53,33,21,35,34,6,21,4,20,29,
+74,43,228,1,9,250,208,169,177,151,106,99,128,122,165,161,31,56,28,71,97,27,
+253,207,6,97,71,254,248,30,100,141,153,82,82,48,42,57,43,77,80,66,58,73,95,
+27,3,195,27,97,71,2,88,6,8,254,239,254,249,254,232,254,222,101,90,131,108,
+115,231,232,215,223,3,5,254,235,69,68,86,86,68,69,3,13,254,230,254,34,254,
+254,75,68,53,72,35,61,125,218,1,52,76,62,65,86,86,69,69,0,1,0,78,254,0,8,
+104,5,182,0,78,0,0,1,54,51,50,4,18,21,16,0,33,34,38,53,52,54,51,20,22,51,
+50,18,17,16,0,35,34,7,17,20,22,51,51,21,33,53,51,50,54,53,17,33,17,20,22,
+51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,33,17,52,
+38,35,35,53,33,21,35,34,6,21,5,72,73,109,165,1,38,159,254,212,254,235,206,
+216,91,81,124,126,177,194,254,230,214,53,45,71,97,26,253,172,27,97,71,253,
+102,71,97,27,253,172,26,96,72,71,97,26,2,84,27,97,71,2,154,71,97,27,2,84,
+26,96,72,3,23,12,151,254,220,202,254,185,254,169,118,99,71,77,129,123,1,24,
+1,17,1,2,1,14,6,254,59,69,68,86,86,74,73,1,224,254,32,73,74,86,86,72,75,3,
+236,68,71,86,86,74,73,254,98,1,158,73,74,86,86,72,75,0,1,0,47,254,20,7,14,
+4,74,0,78,0,0,1,54,54,51,50,0,17,16,2,35,34,38,53,52,51,20,22,51,50,54,53,
+52,38,35,34,6,7,17,20,22,51,51,21,33,53,51,50,54,53,17,33,17,20,22,51,51,
+21,33,53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,33,17,52,38,35,
+35,53,33,21,35,34,6,21,4,143,29,73,44,228,1,9,250,208,170,177,152,106,99,
+128,122,165,161,31,56,28,71,97,27,253,207,6,97,71,253,227,71,97,6,253,207,
+27,97,71,74,94,27,2,49,6,97,71,2,29,74,94,6,2,49,27,97,71,2,88,6,8,254,239,
+254,249,254,232,254,222,101,90,131,108,115,231,232,215,223,3,5,254,235,69,
+68,86,86,68,69,1,37,254,219,69,68,86,86,68,69,2,137,70,70,86,86,69,69,254,
+248,1,6,70,70,86,86,69,69,0,1,0,78,254,82,5,219,5,182,0,41,0,0,1,33,17,20,
+22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,53,33,21,35,34,6,21,17,20,22,
+51,51,17,35,52,38,35,35,53,51,50,54,53,4,59,253,164,71,97,27,253,172,26,96,
+72,71,97,26,5,127,27,97,71,73,95,41,94,162,151,203,26,96,72,5,80,251,153,
+73,74,86,86,72,75,3,236,68,71,86,86,74,73,252,28,74,73,253,252,223,207,86,
+72,75,0,1,0,47,254,82,5,41,4,74,0,42,0,0,37,20,22,51,51,17,35,39,38,38,35,
+35,53,51,50,54,53,17,33,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,
+53,33,21,35,34,6,21,4,102,70,82,43,100,11,10,85,103,252,6,97,71,254,12,71,
+97,6,253,207,27,97,71,74,94,27,4,250,27,97,71,229,68,67,253,244,149,141,140,
+86,68,69,3,13,252,243,69,68,86,86,68,69,2,137,70,70,86,86,69,69,0,1,0,78,
+254,82,5,221,5,182,0,53,0,0,37,20,22,51,51,17,35,52,38,35,35,53,51,50,54,
+53,17,52,38,35,34,6,7,17,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,35,
+53,33,21,35,34,6,21,17,54,54,51,50,22,21,5,31,73,95,22,94,139,164,195,27,
+97,71,127,113,83,158,144,71,97,27,253,172,26,96,72,71,97,26,2,84,27,97,71,
+180,181,90,190,191,233,74,73,253,252,230,200,86,74,73,1,64,125,117,40,67,
+254,57,73,74,86,86,72,75,3,238,69,68,86,86,74,73,254,82,89,38,186,185,0,1,
+0,37,254,82,4,250,6,20,0,47,0,0,1,52,38,35,34,6,21,17,20,22,51,51,21,33,53,
+51,50,54,53,17,52,38,35,35,53,33,17,20,6,7,51,54,51,50,22,21,17,20,22,51,
+51,17,35,39,38,38,35,35,3,119,108,117,121,127,71,97,6,253,217,16,97,71,71,
+97,16,1,121,6,2,10,92,209,181,181,73,79,43,100,11,9,88,101,78,2,195,144,136,
+174,158,254,80,69,68,86,86,74,73,4,74,68,71,86,254,62,53,92,29,186,199,202,
+254,28,69,70,253,244,149,139,142,0,1,0,33,0,0,4,72,5,182,0,70,0,0,1,5,17,
+20,30,2,51,50,62,2,53,52,46,2,39,52,62,2,51,50,30,2,21,20,14,2,35,33,53,51,
+50,62,2,53,17,7,53,55,53,7,53,55,53,52,46,2,35,35,53,33,21,35,34,14,2,21,
+21,37,21,5,21,37,3,27,254,198,25,42,58,33,78,120,80,41,31,54,70,39,19,34,
+47,29,37,72,58,36,65,114,156,91,253,188,27,34,62,45,27,252,252,252,252,27,
+45,62,34,27,2,74,27,35,61,45,27,1,58,254,198,1,58,3,51,129,254,55,48,58,31,
+10,43,72,93,50,45,69,49,31,7,30,52,37,22,32,66,101,69,95,154,109,60,86,10,
+31,58,48,1,134,103,96,103,162,103,99,102,250,48,58,31,10,86,86,10,31,58,48,
+182,129,97,129,162,130,0,1,0,41,3,213,1,88,5,182,0,3,0,0,19,51,3,35,127,217,
+209,94,5,182,254,31,0,2,0,41,3,213,2,217,5,182,0,3,0,7,0,0,19,51,3,35,1,51,
+3,35,127,217,209,94,1,215,217,209,94,5,182,254,31,1,225,254,31,0,3,0,41,3,
+213,4,90,5,182,0,3,0,7,0,11,0,0,19,51,3,35,1,51,3,35,1,51,3,35,127,217,209,
+94,1,215,217,209,94,1,215,217,209,94,5,182,254,31,1,225,254,31,1,225,254,
+31,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,20,0,94,
+0,3,0,1,4,9,0,2,0,14,0,114,0,3,0,1,4,9,0,3,0,58,0,128,0,3,0,1,4,9,0,4,0,20,
+0,94,0,3,0,1,4,9,0,5,0,30,0,186,0,3,0,1,4,9,0,6,0,18,0,216,0,3,0,1,4,9,0,
+7,0,68,0,234,0,3,0,1,4,9,0,8,0,42,1,46,0,3,0,1,4,9,0,9,0,40,1,88,0,3,0,1,
+4,9,0,10,0,96,1,128,0,3,0,1,4,9,0,11,0,62,1,224,0,3,0,1,4,9,0,12,0,60,2,30,
+0,3,0,1,4,9,0,13,2,150,2,90,0,3,0,1,4,9,0,14,0,52,4,240,0,67,0,111,0,112,
+0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,
+111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,
+0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,
+0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,
+0,102,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,
+0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,
+0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,86,0,101,
+0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,55,0,32,0,117,0,104,0,
+78,0,111,0,116,0,111,0,83,0,101,0,114,0,105,0,102,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,3,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,8,0,2,255,255,
+0,3,0,1,0,0,0,12,0,0,0,190,0,232,0,2,0,29,0,0,2,49,0,1,2,50,2,51,0,2,2,53,
+2,53,0,1,2,57,2,87,0,1,2,88,2,89,0,2,2,90,2,93,0,1,2,94,2,96,0,3,2,98,2,98,
+0,3,2,99,2,137,0,1,2,138,2,141,0,3,2,142,3,112,0,1,3,113,3,113,0,3,3,124,
+4,192,0,1,4,193,4,193,0,3,4,194,4,225,0,1,4,226,5,76,0,3,5,77,5,128,0,1,5,
+129,5,129,0,3,5,130,6,69,0,1,6,70,6,82,0,3,6,83,7,252,0,1,7,253,7,253,0,3,
+7,254,8,137,0,1,8,140,8,140,0,1,8,141,8,144,0,3,8,145,9,64,0,1,9,73,9,73,
+0,1,9,81,9,81,0,1,9,90,9,106,0,1,0,12,0,4,0,24,0,24,0,28,0,28,0,1,0,4,2,50,
+2,51,2,88,2,89,0,1,0,10,0,2,0,6,0,10,0,1,2,244,0,1,5,232,0,2,0,31,2,94,2,
+96,0,3,2,98,2,98,0,2,2,138,2,141,0,3,3,113,3,113,0,3,4,226,4,242,0,3,4,244,
+4,247,0,2,4,248,4,248,0,3,4,250,4,254,0,2,5,1,5,3,0,2,5,6,5,16,0,2,5,22,5,
+25,0,2,5,26,5,28,0,3,5,31,5,33,0,3,5,34,5,34,0,2,5,35,5,35,0,3,5,36,5,38,
+0,2,5,39,5,41,0,3,5,42,5,43,0,2,5,45,5,47,0,3,5,48,5,51,0,2,5,52,5,52,0,3,
+5,54,5,55,0,2,5,56,5,56,0,3,5,64,5,76,0,3,6,70,6,71,0,3,6,72,6,72,0,2,6,73,
+6,79,0,3,6,80,6,80,0,2,6,81,6,81,0,3,6,82,6,82,0,2,8,141,8,144,0,1,0,0,0,
+1,0,0,0,10,0,78,0,172,0,3,99,121,114,108,0,20,103,114,101,107,0,36,108,97,
+116,110,0,52,0,4,0,0,0,0,255,255,0,3,0,0,0,3,0,6,0,4,0,0,0,0,255,255,0,3,
+0,1,0,4,0,7,0,4,0,0,0,0,255,255,0,3,0,2,0,5,0,8,0,9,107,101,114,110,0,56,
+107,101,114,110,0,56,107,101,114,110,0,56,109,97,114,107,0,62,109,97,114,
+107,0,68,109,97,114,107,0,68,109,107,109,107,0,86,109,107,109,107,0,86,109,
+107,109,107,0,86,0,0,0,1,0,10,0,0,0,1,0,1,0,0,0,7,0,0,0,2,0,3,0,4,0,5,0,6,
+0,7,0,0,0,2,0,8,0,9,0,11,0,24,42,26,43,86,46,2,47,222,68,12,84,62,97,230,
+98,214,101,92,104,132,0,4,0,0,0,1,0,8,0,1,0,12,0,100,0,3,1,70,3,130,0,2,0,
+14,2,94,2,96,0,0,2,98,2,98,0,3,2,138,2,141,0,4,3,113,3,113,0,8,4,226,4,248,
+0,9,4,250,4,254,0,32,5,1,5,3,0,37,5,6,5,16,0,40,5,22,5,28,0,51,5,31,5,43,
+0,58,5,45,5,52,0,71,5,54,5,56,0,79,5,64,5,76,0,82,6,70,6,82,0,95,0,2,0,37,
+0,36,0,61,0,0,0,68,0,93,0,26,0,130,0,152,0,52,0,154,0,184,0,75,0,186,1,66,
+0,106,1,250,2,1,0,243,2,53,2,53,0,251,2,76,2,76,0,252,2,81,2,84,0,253,2,90,
+2,93,1,1,3,24,3,27,1,5,3,48,3,53,1,9,3,64,3,71,1,15,3,92,3,95,1,23,3,106,
+3,111,1,27,3,124,3,177,1,33,3,181,3,182,1,87,3,184,3,184,1,89,3,189,3,205,
+1,90,3,214,3,214,1,107,3,219,4,23,1,108,4,28,4,29,1,169,4,32,4,156,1,171,
+5,242,6,32,2,40,6,83,6,88,2,87,6,91,6,100,2,93,6,105,6,108,2,103,6,111,6,
+126,2,107,6,129,6,154,2,123,6,163,6,170,2,149,6,173,6,198,2,157,6,203,6,228,
+2,183,8,0,8,0,2,209,8,78,8,78,2,210,8,95,8,101,2,211,8,112,8,112,2,218,8,
+115,8,115,2,219,0,108,0,0,1,178,0,0,1,178,0,0,1,184,0,2,1,190,0,0,1,196,0,
+0,1,202,0,0,41,180,0,0,41,180,0,0,1,208,0,0,1,226,0,0,66,214,0,0,1,214,0,
+0,66,214,0,0,66,214,0,0,66,214,0,0,1,220,0,0,66,214,0,0,66,214,0,0,1,226,
+0,0,66,214,0,0,66,214,0,0,66,214,0,0,66,214,0,0,1,232,0,0,1,232,0,0,1,232,
+0,1,1,238,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,0,66,214,0,2,1,244,0,2,2,
+54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,
+0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,2,1,250,
+0,2,2,0,0,2,2,6,0,2,2,54,0,2,2,54,0,2,2,54,0,0,66,214,0,0,2,12,0,0,2,18,0,
+0,66,214,0,0,2,24,0,0,66,214,0,2,2,54,0,0,66,214,0,2,2,30,0,2,2,54,0,2,2,
+54,0,0,66,214,0,0,66,214,0,0,66,214,0,2,2,54,0,2,2,54,0,0,66,214,0,0,66,214,
+0,0,66,214,0,2,2,54,0,2,2,54,0,2,2,54,0,2,2,54,0,0,66,214,0,2,2,54,0,2,2,
+54,0,0,66,214,0,0,2,36,0,0,2,36,0,0,2,36,0,0,2,36,0,0,2,36,0,0,2,36,0,0,2,
+36,0,0,2,36,0,0,2,36,0,0,2,36,0,0,2,36,0,0,2,36,0,0,2,36,0,0,2,42,0,0,2,42,
+0,2,2,54,0,0,66,214,0,0,66,214,0,0,66,214,0,0,66,214,0,0,66,214,0,0,66,214,
+0,0,66,214,0,2,2,48,0,0,66,214,0,2,2,54,0,1,253,158,4,74,0,1,253,117,4,74,
+0,1,253,156,0,0,0,1,2,58,4,24,0,1,2,58,4,74,0,1,253,139,4,74,0,1,0,0,5,95,
+0,1,253,148,4,74,0,1,253,176,4,74,0,1,0,0,2,248,0,1,255,72,3,3,0,1,0,20,0,
+0,0,1,1,153,0,0,0,1,1,153,0,100,0,1,255,236,0,0,0,1,0,0,4,44,0,1,0,0,5,122,
+0,1,0,0,3,200,0,1,0,0,0,100,0,1,0,0,1,166,0,1,0,0,4,174,0,1,255,226,0,0,0,
+1,0,0,0,0,2,220,39,42,38,42,90,144,33,26,38,42,37,34,27,134,61,148,89,10,
+17,42,62,252,17,48,57,182,33,128,89,88,22,154,33,128,17,54,24,188,24,194,
+25,118,34,16,34,22,33,248,38,12,34,40,38,30,38,12,34,40,17,60,60,68,61,148,
+34,70,38,12,41,58,38,18,60,194,17,66,34,184,39,54,35,24,34,244,39,66,30,152,
+92,34,38,24,38,42,38,30,39,66,30,152,17,72,38,36,38,42,28,28,38,54,37,118,
+35,222,36,56,61,148,36,32,60,56,36,104,20,72,36,170,61,148,36,146,17,78,36,
+212,93,150,17,84,28,40,37,4,28,34,28,40,92,76,37,82,64,82,23,168,32,156,33,
+146,37,196,33,110,37,118,33,56,30,134,37,100,28,70,33,110,33,128,33,56,33,
+140,33,146,25,232,32,60,32,66,35,120,32,72,43,250,32,78,37,112,37,118,92,
+76,32,204,34,166,35,120,17,90,30,206,30,212,34,112,41,142,34,88,17,96,34,
+166,38,6,34,214,34,220,34,196,35,36,35,42,35,0,39,120,42,78,29,66,32,168,
+35,42,35,84,32,168,43,250,35,84,17,102,35,156,35,120,35,174,35,180,92,124,
+36,68,17,108,37,142,36,116,36,122,93,36,36,182,42,78,36,164,36,224,36,230,
+37,160,32,138,42,78,37,16,37,238,42,78,37,178,37,94,37,100,20,174,25,190,
+38,42,90,144,25,190,38,42,90,144,25,190,38,42,90,144,26,252,38,42,90,144,
+26,252,38,42,90,144,17,114,38,42,90,144,63,26,17,120,24,164,27,134,61,148,
+17,126,18,104,33,128,91,44,18,104,33,128,91,44,17,132,33,128,89,88,17,138,
+33,128,91,44,25,238,43,136,38,30,25,238,17,144,38,30,25,238,17,150,38,30,
+26,6,17,150,38,30,33,98,62,252,22,88,17,156,35,24,34,244,26,24,30,152,92,
+34,26,24,30,152,92,34,26,24,30,152,92,34,27,26,30,152,92,34,27,26,30,152,
+92,34,39,66,30,152,92,34,26,108,36,104,20,72,26,108,36,104,20,72,26,108,36,
+104,20,72,26,132,36,104,20,72,26,192,28,40,92,76,38,24,35,42,38,30,17,162,
+17,168,17,174,25,196,33,146,37,196,25,196,33,146,37,196,25,196,33,146,37,
+196,27,8,42,78,37,196,27,8,33,146,37,196,17,180,33,146,37,196,17,186,17,192,
+24,182,30,134,37,100,30,146,25,220,33,146,25,232,25,220,33,146,25,232,25,
+220,33,146,25,232,21,146,33,146,25,232,25,250,17,198,35,120,25,250,42,90,
+35,120,25,250,42,90,35,120,17,204,42,90,35,120,24,128,41,196,29,66,17,210,
+35,42,31,190,24,128,42,78,29,66,24,128,42,78,29,66,24,128,42,78,29,66,24,
+128,42,78,29,66,27,38,42,78,29,66,39,120,42,84,29,66,26,120,36,122,93,36,
+26,120,36,122,93,36,26,120,36,122,93,36,17,216,36,122,93,36,17,222,42,78,
+37,178,33,110,35,42,35,84,35,60,42,78,37,178,17,228,17,234,90,144,17,240,
+17,246,37,196,26,252,35,96,90,144,25,202,38,60,37,196,39,42,38,42,17,252,
+32,156,33,146,18,2,18,38,36,140,89,10,18,8,18,14,28,70,18,38,36,140,89,10,
+18,44,26,126,18,50,18,20,36,140,18,26,18,32,26,126,18,50,18,38,36,140,89,
+10,18,44,26,126,18,50,18,56,33,50,22,88,33,110,58,10,33,56,33,98,62,252,22,
+88,33,110,33,128,33,56,18,62,18,68,89,88,18,74,18,80,25,232,21,140,33,164,
+89,88,18,110,18,86,25,232,21,140,33,164,89,88,18,110,38,60,25,232,57,182,
+33,128,18,92,33,140,33,146,18,98,18,104,33,164,91,44,18,110,37,190,25,232,
+25,106,18,128,25,118,18,140,18,158,24,206,18,116,18,128,25,118,18,140,33,
+212,24,206,18,122,18,128,18,134,18,140,33,212,24,206,24,188,24,194,18,146,
+18,152,18,158,33,218,26,180,33,242,33,248,18,164,18,170,92,76,34,16,34,22,
+33,248,37,112,37,118,92,76,18,176,18,200,38,30,32,204,18,206,35,120,34,124,
+18,182,38,30,18,188,18,194,35,120,26,6,18,200,38,30,32,204,18,206,35,120,
+38,12,34,40,18,212,32,204,34,166,19,196,26,6,18,218,38,30,32,12,32,216,35,
+120,58,100,18,224,18,230,18,236,32,48,18,242,25,238,26,12,18,248,18,254,21,
+14,30,212,60,68,61,148,19,4,34,112,41,142,19,10,32,42,42,78,34,88,25,238,
+35,192,38,18,19,16,19,22,38,6,38,12,41,58,19,28,37,250,34,166,19,34,38,12,
+41,58,38,18,37,250,19,40,38,6,38,12,41,58,38,18,37,250,19,46,38,6,38,12,41,
+58,38,18,19,52,34,166,19,58,19,82,34,238,34,244,19,64,35,78,31,190,39,54,
+35,24,19,70,31,184,35,42,19,76,19,82,34,238,34,244,19,88,35,78,19,94,19,100,
+19,106,19,112,39,54,35,24,19,118,19,124,35,42,19,130,24,254,27,32,92,34,25,
+16,25,22,29,66,27,26,19,136,92,34,26,36,37,46,29,66,26,24,19,136,92,34,26,
+36,35,78,29,66,19,142,19,148,19,154,19,160,29,24,19,166,19,172,35,96,19,178,
+26,90,19,184,35,120,38,36,38,42,19,190,31,196,35,156,19,196,26,48,35,96,28,
+28,19,202,19,208,35,120,35,186,35,246,35,222,36,2,26,66,92,124,35,186,35,
+246,35,222,36,2,19,214,92,124,38,54,37,118,19,220,35,174,35,180,29,204,35,
+186,35,246,35,222,36,2,19,226,92,124,36,56,61,148,19,232,36,68,36,74,19,238,
+19,244,36,140,36,32,36,68,19,250,37,142,36,56,61,148,36,32,36,68,36,74,37,
+142,20,0,20,36,20,72,20,6,20,42,93,36,20,12,20,18,20,72,20,24,20,30,94,56,
+26,132,20,36,20,72,28,184,20,42,92,76,20,48,21,242,20,72,20,54,20,60,92,76,
+26,108,20,66,20,72,28,184,20,78,92,76,60,56,36,104,20,84,20,90,36,122,20,
+96,20,102,36,212,93,150,20,108,31,106,37,160,26,192,37,28,92,76,20,114,24,
+146,37,178,20,120,37,28,20,126,20,150,37,58,23,168,20,132,37,190,20,174,20,
+138,37,58,20,156,20,162,20,144,20,174,20,150,37,58,20,156,20,162,20,168,20,
+174,20,180,20,186,20,192,20,198,33,128,20,204,20,210,36,212,93,150,20,216,
+36,230,37,160,20,210,36,212,93,150,20,216,20,222,37,160,20,228,36,212,93,
+150,20,234,20,240,37,160,20,246,28,40,94,56,20,252,37,46,37,178,21,2,28,130,
+30,212,21,8,21,14,21,20,21,26,21,32,34,184,21,38,21,44,34,196,39,42,38,42,
+21,50,32,156,33,146,21,56,39,66,21,62,92,34,39,120,21,68,29,66,60,56,21,74,
+27,212,36,116,21,80,93,36,39,42,38,42,21,86,32,156,33,146,32,162,21,92,21,
+122,90,144,21,98,21,134,37,196,57,182,33,128,21,104,33,140,33,146,21,110,
+21,116,21,122,89,88,21,128,21,134,25,232,21,140,33,164,89,88,21,146,21,152,
+25,232,21,158,21,164,38,30,21,170,21,176,31,208,38,12,34,40,21,182,34,52,
+34,166,21,188,39,66,30,152,21,194,39,120,42,78,21,200,21,206,21,212,92,34,
+21,218,22,22,29,66,60,56,36,104,21,224,36,116,36,122,21,230,21,236,21,242,
+27,212,21,248,21,254,93,36,28,34,28,40,37,124,37,238,42,78,37,178,22,4,22,
+10,92,76,22,16,22,22,37,178,33,254,37,28,92,76,22,28,22,34,37,178,36,56,61,
+148,23,114,36,68,36,74,38,84,35,72,37,118,33,56,22,40,62,252,22,46,22,112,
+41,58,22,118,35,72,30,80,33,56,22,52,60,182,22,58,22,64,31,160,22,118,27,
+236,22,70,25,232,27,134,22,76,89,10,30,134,22,82,28,70,33,98,62,252,22,88,
+22,94,22,100,22,106,22,112,27,152,22,118,35,72,58,34,33,56,26,36,60,182,29,
+66,26,150,31,160,26,156,22,124,29,108,22,130,22,136,22,142,22,148,22,154,
+33,128,22,160,24,188,22,166,25,118,22,172,43,184,22,178,22,184,34,202,22,
+190,22,202,34,40,22,196,22,202,34,40,38,30,22,208,61,148,22,214,23,48,41,
+142,30,86,22,220,34,166,31,208,22,226,22,232,23,42,32,48,22,238,22,244,39,
+54,35,24,22,250,31,184,35,42,23,0,39,66,30,152,92,34,23,6,23,12,23,18,23,
+24,23,30,88,164,23,36,25,136,23,42,23,48,38,42,23,54,35,138,38,42,35,102,
+23,60,32,66,23,66,32,102,23,72,23,78,23,84,41,58,94,50,23,90,23,96,23,102,
+36,68,36,74,38,84,23,150,29,108,23,156,23,108,60,44,37,142,36,56,61,148,23,
+114,23,120,23,126,23,132,23,138,58,10,23,144,23,150,60,212,23,156,41,214,
+42,84,23,162,37,82,64,82,23,168,37,94,37,100,89,196,26,150,41,142,26,156,
+36,56,41,58,36,32,31,154,23,174,37,16,23,180,23,186,23,192,32,168,23,198,
+35,84,23,204,23,210,23,216,23,222,23,228,23,234,23,240,23,246,23,252,24,2,
+24,8,24,14,24,20,24,26,24,32,24,38,24,44,24,50,24,56,24,62,24,68,24,74,24,
+80,24,86,24,92,24,98,24,104,24,110,26,114,89,28,25,196,37,190,37,196,25,238,
+24,116,38,30,25,250,24,122,31,208,26,24,26,114,92,34,24,128,28,190,29,66,
+26,108,24,134,27,212,24,140,24,146,92,76,28,82,33,146,28,88,24,152,24,158,
+24,164,24,170,24,176,24,182,24,188,24,194,25,118,24,200,43,250,24,206,25,
+106,24,212,25,118,24,218,24,224,24,230,24,236,24,242,29,96,34,76,24,248,34,
+88,39,66,30,152,25,10,39,120,42,78,31,244,24,254,25,4,25,10,25,16,25,22,31,
+244,25,28,25,34,26,156,25,40,25,46,30,116,25,52,25,58,25,64,25,70,25,76,25,
+82,25,88,25,94,25,100,25,106,25,112,25,118,25,124,25,130,32,78,25,136,25,
+142,25,148,25,154,25,160,25,166,25,172,25,178,34,244,25,184,36,158,35,0,25,
+190,26,114,90,144,25,196,37,190,37,196,26,252,35,96,90,144,25,202,38,60,37,
+196,25,208,25,214,38,18,25,220,37,190,25,232,25,226,33,164,38,18,27,236,38,
+60,25,232,25,238,25,244,38,30,25,250,26,0,31,208,26,6,26,12,38,30,32,204,
+26,18,31,208,26,24,26,30,92,34,26,36,35,204,29,66,27,26,36,140,92,34,26,36,
+26,42,29,66,26,48,26,54,28,28,26,60,26,66,26,72,26,78,26,84,28,28,26,90,26,
+96,26,102,26,108,26,114,27,212,26,120,26,126,93,36,26,132,26,138,27,212,28,
+184,26,144,92,76,26,150,27,152,26,156,26,162,26,168,26,174,26,180,26,186,
+33,248,26,192,26,198,92,76,26,204,34,22,26,210,33,110,33,128,35,84,26,216,
+38,42,26,222,26,228,26,234,29,66,26,240,64,82,26,246,37,94,37,100,32,150,
+26,252,27,2,90,144,27,8,38,60,37,196,57,182,33,128,27,14,33,140,33,146,27,
+20,27,26,27,32,92,34,27,38,38,60,29,66,27,44,27,50,37,34,27,56,37,46,27,62,
+27,68,27,74,27,80,31,184,35,42,27,86,36,68,27,92,27,98,27,104,27,110,94,26,
+28,94,27,116,27,122,39,42,38,42,27,128,27,134,61,148,27,140,27,146,27,152,
+27,158,38,12,41,58,38,18,36,56,61,148,27,164,35,174,35,180,27,170,37,94,37,
+100,27,176,27,182,31,22,27,188,27,194,27,200,27,206,33,26,38,42,37,34,60,
+56,36,104,27,212,27,218,38,42,27,224,57,182,33,128,27,230,27,236,37,118,33,
+152,27,242,34,40,27,248,27,254,30,206,30,212,28,4,28,10,28,16,32,168,28,22,
+33,56,38,36,38,42,28,28,31,196,35,156,35,120,28,34,28,40,92,76,37,238,41,
+178,37,178,44,138,42,78,28,46,32,168,44,24,33,56,32,168,43,250,33,56,28,52,
+28,58,33,56,28,64,37,100,88,14,30,134,30,140,28,70,35,72,33,128,35,84,30,
+236,30,242,28,76,28,82,28,94,28,88,28,82,28,94,28,88,37,94,28,94,89,196,28,
+100,37,100,28,106,28,112,28,118,28,124,28,112,28,118,28,124,32,42,30,170,
+34,88,32,12,28,130,30,212,28,136,30,242,35,84,32,72,28,142,35,84,28,148,41,
+178,28,154,37,238,41,178,28,160,28,166,42,78,28,172,36,116,36,122,28,178,
+28,184,28,190,92,76,28,184,28,190,34,10,34,52,34,166,35,120,28,196,32,24,
+28,202,28,208,28,214,28,220,28,226,34,166,28,238,28,232,34,166,28,238,28,
+244,28,250,29,0,29,6,29,12,29,18,34,214,29,24,29,30,34,214,29,24,29,30,34,
+214,34,220,29,36,35,36,35,42,29,42,35,36,35,42,29,42,29,48,29,54,29,60,39,
+120,42,78,29,66,29,72,29,78,29,84,29,90,42,72,29,96,29,102,29,108,29,114,
+29,138,29,144,29,132,29,120,29,126,29,132,29,138,29,144,29,150,31,196,35,
+156,29,156,31,196,35,156,29,162,29,168,29,174,31,208,29,180,29,186,29,192,
+29,198,41,178,33,8,30,158,41,178,30,164,35,174,35,180,29,204,32,60,32,120,
+29,222,29,210,29,216,29,222,29,228,29,234,29,240,29,246,59,138,29,252,30,
+2,30,8,30,14,36,68,36,74,38,84,36,116,36,122,93,36,32,42,30,20,34,88,30,26,
+42,84,30,32,30,38,30,44,30,50,30,56,30,62,30,68,30,74,30,80,30,86,32,156,
+30,92,37,196,37,94,37,100,30,98,37,94,37,100,30,104,30,110,30,224,30,116,
+30,110,30,224,30,116,30,254,31,4,31,10,31,16,31,22,90,252,30,122,32,120,30,
+128,30,134,30,140,30,146,39,66,30,152,92,34,30,158,44,24,30,164,39,150,30,
+170,30,176,32,42,30,182,34,88,30,188,30,194,92,70,30,200,30,206,30,212,39,
+150,31,214,30,218,32,12,30,224,30,230,30,236,30,242,30,248,30,254,31,4,31,
+10,31,16,31,22,90,252,31,46,31,52,31,28,31,46,31,34,31,40,31,46,31,52,31,
+58,31,64,31,70,90,228,60,182,62,252,31,76,31,82,31,88,31,94,31,100,31,106,
+31,112,31,118,31,124,31,130,31,136,31,142,31,148,31,154,31,160,37,16,41,76,
+31,160,93,66,31,166,31,172,31,178,31,166,31,172,31,178,33,110,37,118,33,56,
+33,110,33,128,33,56,32,60,32,66,35,120,34,214,34,220,34,196,31,184,35,42,
+31,190,32,168,35,42,35,84,31,196,35,156,35,120,32,102,31,202,31,208,35,174,
+35,180,92,124,36,68,36,74,37,142,37,94,37,100,89,196,32,168,31,214,35,84,
+31,220,31,226,31,232,39,120,31,238,31,244,31,250,32,0,32,6,32,12,37,220,35,
+120,32,18,32,24,32,30,32,168,35,42,35,84,39,126,42,78,32,36,32,42,35,42,34,
+88,33,110,37,118,32,54,33,110,32,48,32,54,32,60,32,66,32,96,32,72,43,250,
+32,78,34,112,41,142,32,84,37,250,34,166,32,96,34,214,34,220,32,90,35,36,35,
+42,35,48,32,168,35,42,35,84,35,150,35,156,32,96,32,102,35,180,32,108,32,114,
+32,120,32,126,36,182,42,78,32,132,32,138,42,78,32,144,37,94,37,100,32,150,
+32,156,33,146,32,162,32,168,44,24,33,80,33,110,32,174,35,84,33,140,33,146,
+33,152,32,180,41,202,32,186,32,246,41,202,32,252,32,192,33,146,32,198,32,
+204,34,166,32,210,32,216,35,156,32,222,32,228,32,234,32,240,36,116,36,122,
+88,50,32,246,37,100,32,252,33,2,35,96,33,8,33,110,33,14,33,56,33,26,38,42,
+33,32,33,110,33,38,33,20,33,26,38,42,33,32,35,60,33,38,33,80,33,44,33,50,
+92,70,33,110,33,128,33,56,33,98,62,252,33,62,33,110,33,128,33,68,33,98,62,
+252,33,74,33,110,33,128,33,80,33,98,62,252,33,86,33,110,33,128,33,92,33,98,
+62,252,33,104,33,110,33,128,33,116,57,182,33,128,33,134,33,140,33,146,33,
+122,57,182,33,128,33,134,33,140,33,146,33,152,33,158,33,164,33,170,33,176,
+33,182,35,120,33,188,33,194,33,200,33,206,33,212,33,218,33,236,33,242,33,
+248,33,224,33,230,93,6,34,16,34,22,34,28,37,112,34,34,37,124,33,236,33,242,
+33,248,33,254,35,96,92,76,34,16,34,22,34,4,37,112,34,34,34,10,34,16,34,22,
+34,28,37,112,34,34,37,124,38,12,34,40,34,46,34,52,34,166,34,58,34,64,36,140,
+34,70,34,76,34,82,34,88,60,68,61,148,34,94,34,112,41,142,34,100,60,68,61,
+148,34,106,34,112,41,142,34,118,38,12,41,58,34,148,37,250,34,166,34,154,34,
+124,34,130,34,148,34,136,34,142,34,154,38,12,41,58,34,148,37,250,34,166,34,
+154,38,12,41,58,34,160,37,250,34,166,34,172,34,178,34,202,34,184,34,190,34,
+220,34,196,60,194,34,202,34,208,34,214,34,220,34,226,34,232,34,238,34,244,
+34,250,36,158,35,0,35,18,35,24,35,6,35,36,35,42,36,176,35,18,35,24,35,6,35,
+36,35,42,35,12,35,18,35,24,35,30,35,36,35,42,35,48,35,54,35,96,38,30,35,60,
+35,78,35,84,35,66,35,96,38,30,35,72,35,78,35,84,35,90,35,96,35,102,35,108,
+35,114,35,120,35,138,38,42,35,126,35,150,35,156,35,132,35,138,38,42,35,144,
+35,150,35,156,35,162,35,240,35,246,35,222,35,168,36,8,92,124,38,54,37,118,
+35,252,35,174,35,180,36,14,35,186,35,192,35,222,35,198,35,204,92,124,35,210,
+35,216,35,222,35,228,35,234,92,124,35,240,35,246,35,252,36,2,36,8,36,14,36,
+20,36,26,36,32,37,130,36,38,37,142,36,56,61,148,36,44,36,68,36,74,36,50,36,
+56,61,148,36,44,36,68,36,74,36,50,36,56,61,148,36,62,36,68,36,74,36,80,60,
+56,36,104,36,86,36,116,36,122,36,92,60,56,36,104,36,110,36,116,36,122,36,
+98,60,56,36,104,36,110,36,116,36,122,36,128,36,134,36,140,36,146,36,152,36,
+158,36,164,36,170,61,148,36,176,36,182,42,78,36,188,36,194,36,212,93,150,
+36,200,36,230,37,160,36,206,36,212,36,218,36,224,36,230,36,236,36,242,37,
+28,37,4,36,248,37,46,37,16,36,254,37,28,37,4,37,10,37,46,37,16,37,22,37,28,
+37,34,37,40,37,46,37,178,37,52,37,58,37,64,37,70,37,76,89,196,37,82,64,82,
+37,88,37,94,37,100,37,106,37,82,64,82,37,88,37,94,37,100,37,106,37,112,37,
+118,37,124,37,130,37,136,37,142,37,148,37,154,37,160,37,166,37,172,37,178,
+37,184,37,190,37,196,37,202,37,208,37,214,37,220,37,226,37,232,37,238,42,
+78,37,244,38,12,41,58,38,18,37,250,38,0,38,6,38,12,41,58,38,18,38,24,38,42,
+38,30,38,36,38,42,38,48,38,54,38,60,38,66,38,72,38,78,38,84,38,90,42,78,38,
+96,38,102,38,108,38,114,0,1,2,233,5,182,0,1,2,233,0,0,0,1,2,142,0,0,0,1,1,
+120,254,70,0,1,6,113,5,182,0,1,1,204,255,136,0,1,4,98,5,182,0,1,2,184,5,182,
+0,1,1,51,5,242,0,1,1,62,6,90,0,1,2,11,4,74,0,1,2,143,4,74,0,1,2,210,7,16,
+0,1,6,244,5,182,0,1,2,197,254,20,0,1,2,156,7,115,0,1,2,136,7,71,0,1,2,168,
+5,182,0,1,2,188,5,182,0,1,3,54,7,71,0,1,2,151,6,90,0,1,4,26,5,180,0,1,2,131,
+0,0,0,1,2,65,6,131,0,1,3,93,4,74,0,1,5,240,4,74,0,1,2,8,4,74,0,1,1,72,5,223,
+0,1,2,159,6,33,0,1,2,148,5,223,0,1,2,97,6,33,0,1,2,210,6,235,0,1,4,76,5,222,
+0,1,2,65,5,103,0,1,3,132,4,174,0,1,2,210,254,60,0,1,2,65,254,110,0,1,2,52,
+5,242,0,1,3,122,5,118,0,1,3,1,7,71,0,1,3,1,0,0,0,1,2,62,5,182,0,1,2,237,7,
+115,0,1,2,62,5,242,0,1,2,62,0,0,0,1,2,173,7,115,0,1,2,156,6,235,0,1,4,96,
+6,26,0,1,2,56,5,103,0,1,3,192,4,174,0,1,3,212,5,18,0,1,2,156,254,60,0,1,2,
+56,254,110,0,1,2,136,7,115,0,1,2,56,5,242,0,1,3,43,7,71,0,1,3,53,7,71,0,1,
+5,10,6,126,0,1,3,53,0,0,0,1,2,19,5,242,0,1,3,43,254,60,0,1,2,39,6,33,0,1,
+4,56,5,68,0,1,2,138,7,170,0,1,3,252,7,8,0,1,1,120,7,16,0,1,3,32,6,26,0,1,
+1,72,5,103,0,1,2,208,4,174,0,1,3,32,6,126,0,1,2,208,5,18,0,1,1,120,254,60,
+0,1,2,88,6,126,0,1,4,149,5,182,0,1,2,201,254,20,0,1,2,123,5,242,0,1,2,123,
+254,20,0,1,1,120,254,110,0,1,1,31,5,242,0,1,2,205,254,60,0,1,2,87,254,60,
+0,1,1,62,7,172,0,1,2,188,6,204,0,1,2,126,254,60,0,1,1,62,254,60,0,1,2,108,
+6,26,0,1,1,244,5,182,0,1,1,76,6,20,0,1,1,76,0,0,0,1,2,159,5,242,0,1,3,14,
+254,60,0,1,2,159,254,60,0,1,3,54,7,115,0,1,2,169,5,242,0,1,2,169,0,0,0,1,
+3,161,4,74,0,1,5,70,4,74,0,1,3,181,0,0,0,1,3,14,254,110,0,1,2,158,4,74,0,
+1,2,158,254,20,0,1,5,60,6,126,0,1,3,214,5,182,0,1,7,8,5,182,0,1,4,38,0,0,
+0,1,3,159,4,74,0,1,3,199,0,0,0,1,2,130,7,115,0,1,2,130,0,0,0,1,3,82,5,118,
+0,1,2,120,254,60,0,1,1,92,254,60,0,1,1,207,5,242,0,1,3,112,5,118,0,1,2,228,
+5,118,0,1,2,15,254,20,0,1,3,22,5,118,0,1,2,116,254,62,0,1,1,185,254,62,0,
+1,2,116,7,115,0,1,3,72,5,118,0,1,3,6,7,16,0,1,2,148,5,242,0,1,3,6,6,235,0,
+1,4,219,6,26,0,1,2,128,5,103,0,1,4,55,4,174,0,1,4,219,6,126,0,1,4,55,5,18,
+0,1,3,6,7,213,0,1,2,138,6,131,0,1,4,55,5,170,0,1,4,255,6,126,0,1,2,242,0,
+0,0,1,4,115,5,118,0,1,2,242,254,60,0,1,2,138,4,74,0,1,2,138,254,60,0,1,4,
+98,7,115,0,1,3,135,5,242,0,1,2,97,5,242,0,1,2,143,7,71,0,1,2,143,0,0,0,1,
+2,12,5,242,0,1,2,124,7,16,0,1,3,92,5,18,0,1,2,104,7,115,0,1,2,124,0,0,0,1,
+2,32,5,242,0,1,3,142,5,118,0,1,1,248,0,0,0,1,2,52,6,20,0,1,3,102,5,182,0,
+1,1,74,0,0,0,1,3,105,5,182,0,1,0,223,254,20,0,1,4,68,7,115,0,1,3,145,6,33,
+0,1,6,44,5,118,0,1,4,128,7,71,0,1,3,115,5,223,0,1,6,44,5,18,0,1,2,128,7,115,
+0,1,2,67,6,33,0,1,1,51,4,74,0,1,1,44,6,33,0,1,2,108,5,118,0,1,1,44,254,20,
+0,1,3,193,7,115,0,1,6,124,6,126,0,1,3,200,6,33,0,1,6,184,5,118,0,1,2,210,
+253,246,0,1,2,65,253,246,0,1,5,252,6,26,0,1,4,176,4,174,0,1,6,36,5,182,0,
+1,5,100,4,174,0,1,2,210,254,152,0,1,2,210,7,225,0,1,2,65,6,143,0,1,2,126,
+254,152,0,1,2,46,254,152,0,1,2,156,7,225,0,1,4,76,7,8,0,1,2,56,6,143,0,1,
+3,132,5,180,0,1,2,156,7,71,0,1,2,56,5,223,0,1,3,222,5,18,0,1,1,120,7,225,
+0,1,2,168,7,8,0,1,1,72,6,143,0,1,2,82,5,180,0,1,1,120,254,152,0,1,1,72,254,
+152,0,1,2,248,254,152,0,1,2,79,254,152,0,1,2,248,7,225,0,1,5,60,7,8,0,1,2,
+79,6,143,0,1,2,222,254,152,0,1,2,148,254,152,0,1,3,6,7,225,0,1,4,219,7,8,
+0,1,2,148,6,143,0,1,4,55,5,180,0,1,2,138,7,225,0,1,4,106,7,8,0,1,2,97,6,143,
+0,1,3,232,5,180,0,1,2,97,5,223,0,1,4,26,5,18,0,1,3,11,5,182,0,1,3,11,0,0,
+0,1,2,83,5,182,0,1,2,83,0,0,0,1,2,107,5,242,0,1,4,36,5,182,0,1,5,140,6,126,
+0,1,4,216,5,118,0,1,2,173,0,0,0,1,3,56,5,182,0,1,5,140,5,182,0,1,3,56,0,0,
+0,1,2,107,5,182,0,1,2,107,0,0,0,1,2,155,5,182,0,1,2,155,0,0,0,1,2,145,5,182,
+0,1,4,46,5,182,0,1,2,145,0,0,0,1,2,142,5,182,0,1,2,142,254,20,0,1,5,240,6,
+126,0,1,2,209,5,182,0,1,2,169,254,20,0,1,3,165,5,182,0,1,3,165,0,0,0,1,1,
+140,0,0,0,1,1,120,5,242,0,1,2,245,5,182,0,1,2,245,0,0,0,1,1,62,5,242,0,1,
+2,36,5,242,0,1,2,168,6,26,0,1,7,108,5,182,0,1,4,56,0,0,0,1,3,54,0,0,0,1,2,
+159,254,20,0,1,4,105,5,182,0,1,7,198,5,182,0,1,4,105,0,0,0,1,3,102,4,74,0,
+1,5,250,4,74,0,1,2,186,5,182,0,1,2,36,0,0,0,1,2,47,5,242,0,1,2,47,254,20,
+0,1,2,45,5,182,0,1,2,75,0,0,0,1,2,255,4,74,0,1,1,206,0,0,0,1,2,108,5,182,
+0,1,1,51,6,20,0,1,1,174,5,182,0,1,1,91,254,20,0,1,1,85,6,20,0,1,2,116,254,
+20,0,1,3,3,5,182,0,1,5,170,5,182,0,1,3,3,0,0,0,1,2,250,5,182,0,1,2,250,0,
+0,0,1,2,144,5,182,0,1,2,144,0,0,0,1,2,58,254,20,0,1,2,104,0,0,0,1,3,198,5,
+182,0,1,1,236,4,74,0,1,3,53,4,74,0,1,1,236,0,0,0,1,4,29,4,74,0,1,8,63,7,115,
+0,1,9,200,6,144,0,1,8,63,0,0,0,1,7,236,6,33,0,1,9,96,5,118,0,1,7,236,0,0,
+0,1,7,10,6,33,0,1,8,114,5,118,0,1,7,10,0,0,0,1,6,128,5,182,0,1,6,245,5,182,
+0,1,6,128,254,20,0,1,6,59,5,223,0,1,6,214,5,182,0,1,6,59,254,20,0,1,3,187,
+5,223,0,1,4,85,5,182,0,1,3,187,254,20,0,1,7,155,5,182,0,1,7,250,5,182,0,1,
+7,155,254,112,0,1,7,97,5,223,0,1,7,245,5,182,0,1,7,97,254,20,0,1,6,102,5,
+223,0,1,7,3,5,182,0,1,6,102,254,20,0,1,2,230,7,115,0,1,2,213,6,144,0,1,2,
+168,5,118,0,1,2,79,6,33,0,1,4,119,6,144,0,1,2,138,6,33,0,1,3,232,5,118,0,
+1,4,30,6,235,0,1,7,0,6,26,0,1,4,20,0,0,0,1,3,93,5,103,0,1,6,11,4,174,0,1,
+3,93,0,0,0,1,3,43,5,182,0,1,5,10,5,182,0,1,2,19,4,74,0,1,2,19,254,20,0,1,
+5,10,6,144,0,1,2,29,6,33,0,1,4,6,5,118,0,1,2,29,254,20,0,1,3,19,7,115,0,1,
+4,216,6,144,0,1,3,252,6,244,0,1,2,248,6,235,0,1,5,20,6,26,0,1,2,248,254,20,
+0,1,2,79,5,103,0,1,3,232,4,174,0,1,2,106,7,115,0,1,3,239,6,144,0,1,2,48,6,
+33,0,1,3,140,5,118,0,1,8,43,5,182,0,1,9,246,5,182,0,1,8,43,0,0,0,1,7,216,
+4,74,0,1,9,57,4,74,0,1,7,216,0,0,0,1,7,0,4,74,0,1,8,102,4,74,0,1,7,0,0,0,
+0,1,3,43,7,115,0,1,4,248,6,144,0,1,3,43,0,0,0,1,2,9,6,33,0,1,3,182,5,118,
+0,1,4,226,5,182,0,1,7,206,5,118,0,1,4,226,0,0,0,1,2,229,5,182,0,1,5,50,5,
+182,0,1,2,229,254,20,0,1,3,14,7,115,0,1,5,25,6,26,0,1,2,149,6,33,0,1,2,210,
+7,115,0,1,2,65,6,33,0,1,2,65,5,242,0,1,2,126,7,115,0,1,4,96,6,144,0,1,2,56,
+6,33,0,1,2,126,7,71,0,1,2,56,0,0,0,1,1,120,7,115,0,1,2,148,6,144,0,1,1,72,
+6,33,0,1,2,88,5,118,0,1,1,120,7,71,0,1,2,208,6,126,0,1,2,148,5,18,0,1,2,248,
+7,115,0,1,4,126,6,144,0,1,2,79,5,242,0,1,3,182,5,18,0,1,2,120,7,115,0,1,3,
+182,6,144,0,1,1,207,6,33,0,1,3,12,5,118,0,1,1,207,0,0,0,1,2,120,7,71,0,1,
+3,202,6,126,0,1,1,247,5,242,0,1,3,72,5,18,0,1,1,247,0,0,0,1,3,6,7,115,0,1,
+4,76,6,144,0,1,2,148,6,33,0,1,3,172,5,118,0,1,3,6,7,71,0,1,4,119,6,126,0,
+1,3,242,5,18,0,1,2,106,5,182,0,1,2,106,0,0,0,1,1,231,4,74,0,1,2,216,4,74,
+0,1,1,231,254,20,0,1,3,44,7,115,0,1,5,72,6,226,0,1,2,138,7,115,0,1,4,26,6,
+226,0,1,3,31,5,182,0,1,3,31,0,0,0,1,2,157,5,242,0,1,2,157,0,0,0,1,2,79,6,
+20,0,1,3,197,5,182,0,1,2,94,5,182,0,1,2,94,254,112,0,1,2,210,7,71,0,1,3,212,
+6,126,0,1,2,65,5,223,0,1,2,156,254,20,0,1,2,56,254,20,0,1,2,248,7,71,0,1,
+5,60,6,26,0,1,2,79,5,223,0,1,2,158,6,235,0,1,4,106,6,26,0,1,2,107,5,103,0,
+1,2,107,254,20,0,1,1,46,6,20,0,1,1,164,5,182,0,1,1,46,255,216,0,1,2,159,255,
+216,0,1,2,143,5,200,0,1,1,85,255,216,0,1,3,172,6,20,0,1,6,78,5,182,0,1,6,
+78,4,74,0,1,3,172,254,20,0,1,2,210,255,136,0,1,2,237,5,182,0,1,2,237,255,
+136,0,1,2,52,5,182,0,1,3,192,5,182,0,1,2,52,254,112,0,1,2,116,255,156,0,1,
+1,216,254,20,0,1,2,12,254,20,0,1,1,230,5,182,0,1,1,230,0,0,0,1,1,150,4,74,
+0,1,2,218,4,74,0,1,1,150,0,0,0,1,3,6,0,0,0,1,2,179,5,182,0,1,2,179,0,0,0,
+1,2,156,255,136,0,1,2,56,5,182,0,1,1,110,5,182,0,1,1,110,254,20,0,1,1,51,
+5,223,0,1,3,40,5,182,0,1,5,107,5,182,0,1,3,40,0,0,0,1,4,6,4,74,0,1,2,120,
+0,0,0,1,2,138,5,182,0,1,4,106,5,182,0,1,2,105,0,0,0,1,2,37,5,242,0,1,4,56,
+5,118,0,1,1,198,4,74,0,1,2,52,0,0,0,1,2,129,0,0,0,1,2,16,4,74,0,1,2,16,0,
+0,0,1,3,172,4,74,0,1,2,5,4,74,0,1,2,5,0,0,0,1,1,215,4,74,0,1,3,62,4,74,0,
+1,1,215,0,0,0,1,1,218,4,74,0,1,2,117,5,182,0,1,4,12,4,74,0,1,2,110,4,74,0,
+1,2,110,0,0,0,1,2,97,254,20,0,1,2,89,4,74,0,1,2,89,0,0,0,1,2,148,254,20,0,
+1,2,138,5,242,0,1,3,212,5,118,0,1,1,64,4,74,0,1,1,64,0,0,0,1,1,82,4,74,0,
+1,1,228,4,74,0,1,1,82,0,0,0,1,1,119,5,242,0,1,1,103,5,242,0,1,1,119,0,0,0,
+1,1,46,5,242,0,1,1,134,5,182,0,1,1,46,254,20,0,1,2,151,5,242,0,1,4,66,4,74,
+0,1,2,151,254,20,0,1,6,164,4,74,0,1,3,200,0,0,0,1,2,246,0,0,0,1,2,149,254,
+20,0,1,2,167,4,74,0,1,4,96,4,74,0,1,2,167,0,0,0,1,2,79,0,0,0,1,3,41,4,74,
+0,1,5,200,4,74,0,1,3,121,0,0,0,1,3,19,4,74,0,1,3,19,0,0,0,1,2,202,5,242,0,
+1,4,216,5,182,0,1,2,202,254,20,0,1,2,101,5,242,0,1,2,208,5,182,0,1,1,197,
+0,0,0,1,2,101,4,74,0,1,2,208,4,74,0,1,2,101,254,20,0,1,1,92,254,20,0,1,1,
+207,254,20,0,1,2,40,4,74,0,1,2,248,4,74,0,1,1,126,4,74,0,1,2,188,4,74,0,1,
+2,88,254,20,0,1,2,68,4,74,0,1,1,186,254,20,0,1,2,8,6,20,0,1,3,2,5,182,0,1,
+1,72,254,20,0,1,1,46,4,74,0,1,1,164,4,74,0,1,1,96,254,20,0,1,2,30,6,20,0,
+1,1,84,254,20,0,1,1,105,4,74,0,1,1,254,4,74,0,1,1,105,255,6,0,1,4,106,4,74,
+0,1,2,115,4,74,0,1,2,115,0,0,0,1,2,81,4,74,0,1,3,52,4,74,0,1,2,81,0,0,0,1,
+3,115,4,74,0,1,5,180,4,74,0,1,3,115,0,0,0,1,2,47,6,20,0,1,4,16,6,26,0,1,2,
+47,0,0,0,1,3,202,4,74,0,1,2,12,254,220,0,1,2,12,255,86,0,1,2,48,4,74,0,1,
+2,48,254,20,0,1,1,191,6,20,0,1,1,231,0,0,0,1,2,52,4,74,0,1,3,122,4,74,0,1,
+2,52,254,20,0,1,5,60,5,182,0,1,2,98,4,74,0,1,2,98,0,0,0,1,3,192,4,74,0,1,
+2,57,0,0,0,1,4,216,5,218,0,1,2,193,4,74,0,1,4,143,4,74,0,1,1,51,5,182,0,1,
+1,218,5,182,0,1,1,51,254,20,0,1,2,57,254,20,0,1,3,112,4,74,0,1,2,26,0,0,0,
+1,2,129,5,182,0,1,5,0,6,26,0,1,2,129,254,20,0,1,1,221,6,20,0,1,3,92,5,182,
+0,1,1,191,0,0,0,1,2,5,6,20,0,1,3,112,5,182,0,1,5,144,0,0,0,1,6,194,4,74,0,
+1,5,84,254,20,0,1,5,144,4,74,0,1,6,244,4,74,0,1,5,144,255,86,0,1,3,242,4,
+74,0,1,5,0,4,74,0,1,2,108,254,20,0,1,4,59,4,74,0,1,5,160,4,74,0,1,4,59,0,
+0,0,1,4,230,4,74,0,1,6,84,4,74,0,1,4,230,254,20,0,1,3,170,4,74,0,1,4,216,
+4,74,0,1,3,170,0,0,0,1,3,55,4,74,0,1,4,116,4,74,0,1,3,55,0,0,0,1,2,60,5,182,
+0,1,3,212,5,182,0,1,2,249,4,74,0,1,5,20,4,74,0,1,2,249,254,20,0,1,2,159,4,
+74,0,1,2,159,0,0,0,1,1,207,4,74,0,1,2,238,4,74,0,1,1,72,0,0,0,1,3,209,4,74,
+0,1,2,28,4,184,0,1,3,132,4,184,0,1,2,28,1,203,0,1,3,198,4,74,0,1,2,79,254,
+20,0,1,3,219,5,242,0,1,6,14,5,182,0,1,3,219,0,0,0,1,1,72,4,74,0,1,1,56,4,
+74,0,1,1,148,4,74,0,1,1,86,0,0,0,1,2,66,0,0,0,1,2,87,4,74,0,1,4,56,5,182,
+0,1,2,117,254,112,0,1,2,66,6,20,0,1,3,152,5,182,0,1,2,9,4,74,0,1,2,9,254,
+20,0,1,2,87,254,112,0,1,3,240,254,152,0,1,1,92,254,112,0,1,1,206,4,74,0,1,
+1,186,254,112,0,1,2,14,6,20,0,1,3,32,5,182,0,1,2,14,254,20,0,1,2,61,254,112,
+0,1,2,100,4,74,0,1,2,100,254,112,0,1,2,12,254,112,0,1,2,65,4,74,0,1,2,65,
+254,152,0,1,2,117,4,74,0,1,5,145,5,182,0,1,2,26,4,74,0,1,2,26,254,112,0,1,
+2,34,4,74,0,1,2,34,254,152,0,1,1,72,5,242,0,1,1,72,254,72,0,1,1,208,4,74,
+0,1,1,208,254,72,0,1,2,150,6,20,0,1,3,132,6,31,0,1,2,150,254,72,0,1,1,235,
+4,74,0,1,1,235,254,72,0,1,2,118,7,71,0,1,2,118,0,0,0,1,3,222,5,182,0,1,2,
+197,254,152,0,1,2,158,5,182,0,1,2,158,254,152,0,1,3,162,5,182,0,1,2,193,7,
+71,0,1,4,236,6,126,0,1,2,117,0,0,0,1,2,193,254,152,0,1,2,67,254,152,0,1,2,
+223,254,152,0,1,2,117,254,152,0,1,2,173,254,62,0,1,2,117,254,62,0,1,2,173,
+5,182,0,1,2,193,254,112,0,1,2,117,6,20,0,1,2,97,254,112,0,1,2,76,254,112,
+0,1,4,96,5,182,0,1,2,136,254,112,0,1,2,56,4,74,0,1,3,132,4,74,0,1,2,56,254,
+112,0,1,2,122,7,71,0,1,4,96,6,126,0,1,2,122,0,0,0,1,2,56,7,115,0,1,3,152,
+6,226,0,1,3,63,6,235,0,1,5,10,6,26,0,1,3,63,0,0,0,1,2,39,5,103,0,1,4,56,5,
+18,0,1,2,39,254,20,0,1,2,168,7,71,0,1,3,172,6,126,0,1,3,44,7,71,0,1,5,72,
+6,126,0,1,3,44,0,0,0,1,2,138,7,71,0,1,3,44,254,20,0,1,2,138,254,20,0,1,3,
+44,5,182,0,1,5,72,5,182,0,1,3,44,254,152,0,1,3,172,5,182,0,1,1,223,5,182,
+0,1,1,120,254,112,0,1,1,72,5,182,0,1,1,72,254,112,0,1,2,205,7,115,0,1,2,205,
+0,0,0,1,2,87,7,172,0,1,4,26,7,8,0,1,2,87,0,0,0,1,3,9,254,152,0,1,2,127,254,
+152,0,1,3,19,254,152,0,1,2,87,6,20,0,1,2,137,254,152,0,1,1,120,6,235,0,1,
+4,26,6,26,0,1,1,62,7,1,0,1,2,168,6,126,0,1,2,124,254,152,0,1,1,62,254,152,
+0,1,2,124,254,112,0,1,1,238,5,182,0,1,1,62,254,112,0,1,3,203,7,71,0,1,3,163,
+0,0,0,1,3,200,5,242,0,1,3,240,0,0,0,1,6,124,5,182,0,1,3,163,254,152,0,1,3,
+200,4,74,0,1,6,178,4,74,0,1,3,220,254,152,0,1,3,24,7,71,0,1,5,31,6,126,0,
+1,3,14,0,0,0,1,2,149,5,242,0,1,2,149,0,0,0,1,3,14,254,152,0,1,2,149,254,152,
+0,1,3,14,5,182,0,1,5,31,5,182,0,1,3,14,254,112,0,1,2,149,4,74,0,1,4,76,4,
+74,0,1,2,149,254,112,0,1,2,107,7,115,0,1,2,117,6,33,0,1,2,107,7,71,0,1,2,
+117,5,242,0,1,4,76,5,118,0,1,2,117,254,20,0,1,2,160,7,71,0,1,4,76,6,126,0,
+1,2,160,0,0,0,1,1,227,5,223,0,1,3,32,5,118,0,1,1,92,0,0,0,1,2,190,254,152,
+0,1,1,87,254,152,0,1,2,160,5,182,0,1,2,160,254,152,0,1,1,227,4,74,0,1,3,32,
+4,74,0,1,1,107,254,152,0,1,1,216,5,223,0,1,1,216,4,74,0,1,2,228,4,74,0,1,
+2,65,7,115,0,1,4,26,6,126,0,1,1,216,6,33,0,1,3,152,5,118,0,1,2,65,8,59,0,
+1,3,172,7,88,0,1,2,15,0,0,0,1,1,216,6,233,0,1,3,72,5,240,0,1,2,65,7,71,0,
+1,3,132,6,126,0,1,2,45,254,152,0,1,1,216,5,242,0,1,2,228,5,18,0,1,1,216,254,
+152,0,1,2,116,7,71,0,1,4,176,6,26,0,1,2,116,0,0,0,1,2,143,6,44,0,1,2,116,
+254,152,0,1,1,165,254,152,0,1,2,116,5,182,0,1,2,116,254,112,0,1,1,85,5,103,
+0,1,2,143,4,174,0,1,1,185,254,112,0,1,2,232,254,152,0,1,2,88,254,152,0,1,
+2,128,254,112,0,1,4,219,5,182,0,1,2,212,254,112,0,1,2,148,4,74,0,1,4,55,4,
+74,0,1,2,98,254,112,0,1,2,219,7,71,0,1,4,176,6,126,0,1,2,189,0,0,0,1,2,121,
+5,223,0,1,4,76,5,18,0,1,2,61,0,0,0,1,2,219,5,182,0,1,2,189,254,152,0,1,2,
+121,4,74,0,1,2,71,254,152,0,1,4,78,7,71,0,1,3,155,5,223,0,1,4,68,5,182,0,
+1,7,158,5,182,0,1,4,58,254,152,0,1,3,145,4,74,0,1,6,44,4,74,0,1,3,105,254,
+152,0,1,2,194,7,71,0,1,2,110,5,223,0,1,2,184,7,71,0,1,2,134,0,0,0,1,2,80,
+5,223,0,1,2,60,0,0,0,1,2,158,7,71,0,1,4,106,6,126,0,1,2,158,0,0,0,1,2,107,
+5,223,0,1,3,232,5,18,0,1,2,94,7,71,0,1,4,16,6,126,0,1,2,94,0,0,0,1,2,12,6,
+33,0,1,3,92,5,118,0,1,2,104,5,182,0,1,2,94,254,152,0,1,2,12,4,74,0,1,3,92,
+4,74,0,1,1,248,254,152,0,1,2,138,6,20,0,1,3,132,5,182,0,1,2,138,254,152,0,
+1,1,85,6,235,0,1,2,188,6,26,0,1,1,185,0,0,0,1,3,145,6,131,0,1,6,44,5,100,
+0,1,3,95,0,0,0,1,2,107,6,131,0,1,3,232,5,200,0,1,2,61,254,20,0,1,2,65,6,90,
+0,1,3,132,5,118,0,1,2,65,0,0,0,1,2,22,7,115,0,1,3,92,6,226,0,1,1,78,0,0,0,
+1,1,238,4,74,0,1,2,252,4,74,0,1,1,238,0,0,0,1,2,97,4,74,0,1,2,97,0,0,0,1,
+1,62,6,20,0,1,1,158,5,182,0,1,1,62,0,0,0,1,1,120,5,182,0,1,2,126,0,0,0,1,
+2,147,5,182,0,1,1,120,0,0,0,1,2,120,5,182,0,1,4,76,5,182,0,1,2,120,254,20,
+0,1,2,65,5,182,0,1,3,132,5,18,0,1,2,65,254,20,0,1,1,85,5,182,0,1,2,243,5,
+18,0,1,1,185,254,20,0,1,2,70,4,74,0,1,2,70,0,0,0,1,2,202,4,74,0,1,4,185,4,
+74,0,1,2,202,0,0,0,4,0,0,0,1,0,8,0,1,0,12,0,24,0,1,0,80,0,104,0,1,0,4,2,94,
+2,95,4,227,4,235,0,1,0,26,1,156,1,168,1,170,1,175,1,178,1,179,1,184,1,189,
+1,197,1,199,1,200,1,201,1,202,1,207,1,210,1,211,1,216,1,221,1,229,1,231,1,
+232,1,233,1,234,1,246,3,141,3,214,0,4,0,0,0,18,0,0,0,18,0,0,25,202,0,0,0,
+18,0,1,253,172,4,74,0,26,0,54,0,60,0,66,0,72,0,78,0,84,0,90,0,96,0,102,0,
+108,0,114,0,120,0,126,0,198,0,132,0,138,0,144,0,150,0,156,0,162,0,168,0,174,
+0,180,0,186,0,192,0,198,0,1,2,126,7,48,0,1,2,174,7,48,0,1,2,210,5,182,0,1,
+2,126,5,182,0,1,3,54,5,182,0,1,3,54,7,48,0,1,2,248,5,182,0,1,2,174,5,182,
+0,1,3,161,5,182,0,1,2,115,5,182,0,1,4,41,5,182,0,1,2,159,5,182,0,1,2,64,4,
+74,0,1,2,192,4,74,0,1,2,192,5,220,0,1,2,79,4,74,0,1,2,66,4,74,0,1,3,78,4,
+74,0,1,1,247,4,74,0,1,3,111,4,74,0,1,2,57,4,74,0,1,2,36,5,220,0,1,2,66,5,
+220,0,1,2,194,5,182,0,1,2,36,4,74,0,4,0,0,0,1,0,8,0,1,0,12,0,18,0,1,0,148,
+0,160,0,1,0,1,4,193,0,2,0,21,0,36,0,61,0,0,0,68,0,93,0,26,0,162,0,168,0,52,
+0,170,0,177,0,59,0,180,0,184,0,67,0,186,0,191,0,72,0,193,0,193,0,78,0,243,
+0,243,0,79,1,21,1,21,0,80,3,214,3,214,0,81,4,61,4,63,0,82,4,65,4,65,0,85,
+4,69,4,69,0,86,4,72,4,73,0,87,4,75,4,75,0,89,4,81,4,81,0,90,4,85,4,85,0,91,
+4,87,4,87,0,92,4,98,4,99,0,93,4,118,4,119,0,95,4,121,4,121,0,97,0,1,0,0,0,
+6,0,1,254,242,2,197,0,98,0,198,0,204,0,210,0,216,0,222,0,222,0,228,0,234,
+0,240,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,14,1,20,1,26,1,32,17,174,3,92,
+1,38,1,44,1,44,1,50,1,188,1,176,1,56,1,62,1,152,1,68,1,74,1,80,1,218,1,218,
+1,86,1,92,1,98,1,176,1,230,1,176,1,104,1,110,1,116,1,122,1,158,1,242,1,128,
+1,134,1,242,1,140,1,188,1,188,1,188,1,188,1,188,1,188,1,146,1,152,1,152,1,
+152,1,152,1,218,1,218,1,218,1,218,1,230,1,230,1,230,1,230,1,230,1,230,1,158,
+1,158,1,158,1,158,1,242,1,242,1,218,1,164,1,188,1,170,1,242,1,176,1,182,1,
+188,1,194,1,200,1,206,1,212,1,218,1,224,1,230,1,236,1,242,1,248,1,254,0,1,
+3,2,5,188,0,1,4,46,4,225,0,1,4,80,5,117,0,1,4,226,4,126,0,1,4,26,5,182,0,
+1,4,188,5,117,0,1,5,190,5,182,0,1,2,28,5,182,0,1,4,206,5,182,0,1,2,48,5,182,
+0,1,6,183,5,182,0,1,5,88,5,182,0,1,5,10,4,126,0,1,4,66,4,126,0,1,3,92,5,120,
+0,1,4,116,5,182,0,1,7,208,5,182,0,1,4,126,5,182,0,1,3,232,5,182,0,1,3,72,
+4,45,0,1,3,232,6,20,0,1,3,52,6,14,0,1,4,1,4,74,0,1,3,252,3,132,0,1,3,212,
+4,74,0,1,1,98,6,20,0,1,6,114,3,132,0,1,4,16,4,74,0,1,3,72,4,74,0,1,2,228,
+4,20,0,1,2,118,4,74,0,1,6,64,4,74,0,1,3,182,4,74,0,1,3,60,4,74,0,1,5,240,
+3,132,0,1,3,132,3,132,0,1,3,247,4,74,0,1,6,134,3,132,0,1,3,232,3,132,0,1,
+4,16,3,132,0,1,3,12,3,132,0,1,3,112,3,132,0,1,3,52,4,16,0,1,3,42,3,132,0,
+1,3,192,3,132,0,1,4,26,4,94,0,1,1,98,4,74,0,1,1,224,4,74,0,1,3,212,3,132,
+0,1,5,120,4,74,0,1,3,232,4,74,0,1,4,26,4,74,0,1,2,168,4,74,0,4,0,0,0,1,0,
+8,0,1,0,12,0,18,0,1,0,88,0,100,0,1,0,1,4,249,0,2,0,11,0,36,0,61,0,0,0,68,
+0,93,0,26,0,148,0,149,0,52,0,151,0,151,0,54,0,155,0,156,0,55,0,180,0,181,
+0,57,0,183,0,183,0,59,0,187,0,188,0,60,1,42,1,43,0,62,3,68,3,71,0,64,3,92,
+3,95,0,68,0,1,0,0,0,6,0,1,255,66,4,168,0,72,0,146,0,152,0,158,0,164,0,170,
+0,170,0,176,0,182,0,188,0,188,15,62,0,188,0,194,0,200,1,88,0,206,1,88,0,206,
+0,212,0,218,1,100,0,224,0,230,0,236,0,236,0,242,1,4,1,40,0,248,0,254,1,4,
+1,10,1,76,1,40,1,16,1,22,1,76,1,28,1,34,1,40,1,94,1,40,1,46,1,52,1,58,1,64,
+1,106,1,106,1,70,1,76,1,106,1,82,1,88,1,88,1,88,1,100,1,100,1,94,1,94,1,94,
+1,106,1,106,1,100,1,106,1,88,1,94,1,88,1,94,1,100,1,106,1,100,1,106,0,1,3,
+32,5,188,0,1,3,182,5,120,0,1,4,66,5,130,0,1,3,210,5,120,0,1,4,8,5,182,0,1,
+4,136,5,130,0,1,5,203,5,182,0,1,2,88,5,182,0,1,6,219,5,182,0,1,5,164,5,182,
+0,1,3,152,5,120,0,1,3,88,5,121,0,1,4,108,5,182,0,1,5,40,5,182,0,1,8,12,5,
+182,0,1,4,196,5,182,0,1,4,42,5,182,0,1,3,32,4,35,0,1,3,242,6,20,0,1,3,72,
+3,232,0,1,3,27,5,250,0,1,1,144,4,74,0,1,1,124,4,74,0,1,1,134,6,20,0,1,6,64,
+3,232,0,1,3,212,3,232,0,1,4,56,4,74,0,1,3,32,4,82,0,1,2,193,4,20,0,1,1,109,
+5,70,0,1,6,144,4,74,0,1,3,252,4,74,0,1,3,96,4,74,0,1,4,220,4,168,0,1,3,162,
+3,145,0,1,5,127,5,182,0,1,4,36,4,74,0,4,0,0,0,1,0,8,0,1,0,12,36,114,0,2,0,
+22,0,82,0,2,0,1,5,57,5,63,0,0,0,7,0,1,0,30,0,0,0,48,0,0,0,36,0,1,0,42,0,0,
+0,48,0,0,0,48,0,1,0,54,0,1,2,105,0,60,0,1,1,168,4,74,0,1,1,168,0,40,0,1,2,
+105,4,74,0,1,2,78,0,0,3,49,15,36,15,42,17,112,17,118,15,210,17,130,17,154,
+17,160,18,168,18,174,13,188,17,184,14,142,17,208,17,220,17,226,17,232,17,
+244,15,84,15,90,18,6,18,12,19,128,19,134,18,48,18,54,18,78,18,84,16,56,18,
+96,19,140,19,146,16,56,18,96,19,152,19,158,18,132,18,144,18,168,18,174,18,
+180,18,186,18,204,18,210,18,216,18,222,16,254,18,240,15,108,19,2,19,14,19,
+20,19,164,19,170,18,102,18,108,17,136,17,142,18,102,18,108,17,166,17,172,
+17,40,17,196,18,102,18,108,19,38,19,44,19,116,19,122,19,116,19,122,18,18,
+18,24,19,116,19,122,18,60,18,66,19,38,19,44,19,140,19,146,18,102,18,108,18,
+102,18,108,18,120,18,126,18,150,18,156,19,176,19,182,19,38,19,44,19,188,19,
+194,18,228,19,62,18,246,18,252,19,8,19,74,19,26,19,32,14,238,15,42,14,238,
+15,42,14,238,15,42,14,238,15,42,14,238,15,42,14,238,15,42,14,130,14,136,17,
+124,17,130,18,162,18,174,18,162,18,174,18,162,18,174,18,162,18,174,17,238,
+17,244,17,238,17,244,17,238,17,244,17,238,17,244,17,148,17,160,18,72,18,84,
+18,90,18,96,18,90,18,96,18,90,18,96,18,90,18,96,18,90,18,96,18,90,18,96,33,
+6,18,186,33,6,18,186,33,6,18,186,33,6,18,186,34,50,19,2,19,140,19,146,12,
+198,12,204,19,164,19,170,19,164,19,170,19,164,19,170,19,164,19,170,19,164,
+19,170,19,164,19,170,15,216,15,222,17,136,17,142,17,166,17,172,17,166,17,
+172,17,166,17,172,17,166,17,172,19,116,19,122,19,116,19,122,19,116,19,122,
+19,116,19,122,19,140,19,146,19,38,19,44,19,140,19,146,19,140,19,146,19,140,
+19,146,19,140,19,146,19,140,19,146,19,140,19,146,19,38,19,44,19,38,19,44,
+19,38,19,44,19,38,19,44,19,8,19,74,18,102,18,108,19,8,19,74,14,238,15,42,
+19,164,19,170,14,238,15,42,19,164,19,170,15,36,15,42,19,164,19,170,17,124,
+17,130,17,136,17,142,17,124,17,130,17,136,17,142,17,124,17,130,17,136,17,
+142,17,124,17,130,17,136,17,142,17,148,17,160,18,102,18,108,17,154,17,160,
+12,210,12,216,18,162,18,174,17,166,17,172,18,162,18,174,17,166,17,172,18,
+162,18,174,17,166,17,172,18,168,18,174,17,166,17,172,18,162,18,174,17,166,
+17,172,17,202,17,208,18,102,18,108,17,202,17,208,18,102,18,108,17,202,17,
+208,18,102,18,108,14,142,17,208,18,102,18,108,17,214,17,226,18,192,19,44,
+17,220,17,226,19,38,19,44,17,238,17,244,19,116,19,122,17,238,17,244,19,116,
+19,122,17,238,17,244,19,116,19,122,17,232,17,244,19,116,19,122,17,238,17,
+244,19,116,19,122,13,128,13,134,12,222,12,228,12,234,15,90,19,116,19,122,
+18,6,18,12,18,18,18,24,18,18,18,24,18,30,19,134,18,36,19,122,19,128,19,134,
+19,116,19,122,19,128,19,134,19,116,19,122,19,128,19,134,12,240,12,246,19,
+128,19,134,19,116,19,122,18,72,18,84,19,38,19,44,18,78,18,84,19,38,19,44,
+18,72,18,84,19,38,19,44,12,252,13,2,18,78,18,84,19,38,19,44,18,90,18,96,19,
+140,19,146,18,90,18,96,19,140,19,146,18,90,18,96,19,140,19,146,13,8,13,14,
+13,20,13,26,18,114,19,158,18,120,18,126,19,152,19,158,18,120,18,126,18,114,
+19,158,18,120,18,126,18,138,18,144,18,150,18,156,18,138,18,144,18,150,18,
+156,18,132,18,144,18,150,18,156,18,138,18,144,18,150,18,156,18,168,18,174,
+19,176,19,182,18,162,18,174,19,176,19,182,18,168,18,174,19,176,19,182,33,
+6,18,186,19,38,19,44,33,6,18,186,19,38,19,44,33,6,18,186,19,38,19,44,33,6,
+18,186,19,38,19,44,33,6,18,186,19,38,19,44,18,180,18,186,19,38,19,44,13,38,
+18,222,18,228,19,62,34,50,19,2,19,8,19,74,34,50,19,2,34,206,19,20,19,26,19,
+32,34,206,19,20,19,26,19,32,34,206,19,20,19,26,19,32,13,32,19,86,19,14,19,
+20,13,38,18,222,18,228,19,62,13,38,18,222,18,228,19,62,13,38,18,222,18,228,
+19,62,34,50,19,2,19,8,19,74,19,116,19,122,19,116,19,122,18,42,18,54,18,60,
+18,66,15,36,15,42,19,164,19,170,13,80,13,86,13,92,13,98,17,46,17,52,13,44,
+13,50,15,36,15,42,19,164,19,170,14,238,15,42,13,56,19,170,14,238,15,42,13,
+56,19,170,14,238,15,42,13,56,19,170,14,238,15,42,13,56,19,170,14,238,15,42,
+13,62,19,170,14,238,15,42,19,164,19,170,14,238,15,42,13,62,19,170,14,238,
+15,42,13,62,19,170,14,238,15,42,13,62,19,170,14,238,15,42,13,62,19,170,14,
+238,15,42,19,164,19,170,18,168,18,174,17,166,17,172,18,162,18,174,17,166,
+17,172,18,162,18,174,17,166,17,172,18,162,18,174,13,68,17,172,18,162,18,174,
+13,68,17,172,18,162,18,174,13,68,17,172,18,162,18,174,34,182,17,172,18,162,
+18,174,17,166,17,172,17,238,17,244,19,116,19,122,17,232,17,244,19,116,19,
+122,16,56,18,96,19,140,19,146,18,90,18,96,19,140,19,146,18,90,18,96,13,74,
+19,146,18,90,18,96,13,74,19,146,18,90,18,96,13,74,19,146,18,90,18,96,33,246,
+19,146,18,90,18,96,19,140,19,146,34,128,13,86,13,92,13,98,34,128,13,86,13,
+92,13,98,34,128,13,86,13,92,13,98,34,128,13,86,13,92,13,98,13,80,13,86,13,
+92,13,98,18,180,18,186,19,38,19,44,33,6,18,186,19,38,19,44,33,174,17,52,13,
+104,13,110,33,174,17,52,13,104,13,110,33,174,17,52,13,104,13,110,33,174,17,
+52,13,104,13,110,17,46,17,52,13,104,13,110,15,108,19,2,19,8,19,74,34,50,19,
+2,19,8,19,74,34,50,19,2,19,8,19,74,18,168,18,174,19,176,19,182,18,102,18,
+108,17,154,17,160,18,102,18,108,18,102,18,108,13,116,13,122,13,128,13,134,
+15,210,17,130,17,124,17,130,13,140,13,146,17,154,17,160,13,152,13,158,18,
+102,18,108,18,102,18,108,13,164,13,170,18,168,18,174,13,176,13,182,14,214,
+14,220,13,188,17,184,17,202,17,208,14,10,14,16,13,194,13,200,13,206,13,212,
+17,232,17,244,18,6,18,12,18,18,18,24,19,116,19,122,16,20,16,26,13,218,13,
+224,18,78,18,84,19,38,19,44,15,228,15,234,13,230,13,236,13,242,13,248,13,
+254,14,4,18,102,18,108,19,152,19,158,18,132,18,144,18,150,18,156,14,10,14,
+16,14,22,14,28,19,176,19,182,16,62,16,68,19,176,19,182,18,168,18,174,15,228,
+15,234,18,204,18,210,15,108,19,2,16,20,16,26,19,14,19,20,19,26,19,32,14,34,
+47,80,14,34,47,80,14,34,47,80,17,94,17,100,14,40,14,46,14,52,14,58,14,64,
+14,160,14,166,14,172,14,178,14,184,14,70,14,76,15,228,15,234,14,82,14,88,
+14,94,14,100,14,106,14,112,14,118,14,124,14,238,15,42,19,164,19,170,17,238,
+17,244,19,116,19,122,18,90,18,96,19,140,19,146,33,6,18,186,19,38,19,44,17,
+166,17,172,14,130,14,136,15,216,15,222,14,142,17,208,18,102,18,108,17,202,
+17,208,18,102,18,108,17,250,18,12,18,0,18,24,16,56,18,96,19,140,19,146,18,
+90,18,96,19,140,19,146,14,148,47,80,16,32,16,38,14,154,14,160,14,166,14,172,
+14,178,14,184,17,202,17,208,18,102,18,108,14,190,14,196,14,202,14,208,18,
+72,18,84,19,38,19,44,14,238,15,42,19,164,19,170,14,238,15,42,19,164,19,170,
+18,162,18,174,17,166,17,172,18,162,18,174,17,166,17,172,17,238,17,244,19,
+116,19,122,17,238,17,244,19,116,19,122,18,90,18,96,19,140,19,146,18,90,18,
+96,19,140,19,146,18,114,19,158,18,120,18,126,18,114,19,158,18,120,18,126,
+33,6,18,186,19,38,19,44,33,6,18,186,19,38,19,44,14,214,14,220,16,32,16,38,
+17,214,17,226,18,192,19,44,17,220,17,226,18,102,18,108,14,226,14,232,19,140,
+19,146,19,14,19,20,19,26,19,32,14,238,15,42,19,164,19,170,18,168,18,174,17,
+166,17,172,18,90,18,96,19,140,19,146,34,50,19,2,19,8,19,74,14,244,14,250,
+15,0,15,6,15,12,15,18,15,24,15,30,15,24,15,30,15,36,15,42,15,210,17,130,17,
+136,17,142,19,128,19,134,18,168,18,174,18,150,18,156,19,26,19,32,15,48,15,
+54,15,60,15,66,17,112,17,118,18,180,18,186,15,72,15,78,18,168,18,174,17,166,
+17,172,15,84,15,90,19,116,19,122,15,96,15,102,18,102,18,108,19,152,19,158,
+18,120,18,126,15,108,19,2,19,8,19,74,19,164,19,170,18,102,18,108,18,102,18,
+108,18,102,18,108,17,136,17,142,15,114,15,120,18,102,18,108,18,102,18,108,
+17,166,17,172,17,166,17,172,15,126,15,132,15,138,15,144,17,94,17,100,17,112,
+17,118,18,204,18,210,19,116,19,122,18,102,18,108,18,102,18,108,16,74,16,80,
+19,188,19,194,19,188,19,194,19,38,19,44,19,38,19,44,19,38,19,44,19,116,19,
+122,17,16,17,22,15,150,15,156,15,162,15,168,15,174,15,180,15,186,15,192,15,
+198,15,204,18,60,18,66,18,60,18,66,18,60,18,66,19,38,19,44,19,38,19,44,15,
+210,17,130,19,140,19,146,15,216,15,222,15,228,15,234,19,200,19,206,18,120,
+18,126,18,120,18,126,18,120,18,126,18,120,18,126,18,120,18,126,17,16,17,22,
+17,16,17,22,15,240,15,246,15,240,15,246,18,150,18,156,19,116,19,122,19,116,
+19,122,19,116,19,122,19,116,19,122,19,176,19,182,19,176,19,182,19,38,19,44,
+19,140,19,146,15,252,16,2,19,188,19,194,18,228,19,62,19,8,19,74,16,8,16,14,
+19,26,19,32,16,20,16,26,16,32,16,38,16,32,16,38,16,110,16,116,16,110,16,116,
+16,110,16,116,16,44,16,50,16,56,18,96,16,62,16,68,18,204,18,210,16,74,16,
+80,16,86,16,92,19,116,19,122,18,18,18,24,16,98,16,104,18,102,18,108,16,110,
+16,116,16,110,16,116,16,122,16,128,16,134,16,140,16,146,16,152,16,158,16,
+164,16,206,16,212,16,170,16,176,16,170,16,176,16,182,16,188,16,194,16,200,
+16,206,16,212,16,218,16,224,16,230,16,236,16,230,16,236,18,102,18,108,18,
+102,18,108,17,40,17,196,18,60,18,66,19,38,19,44,18,102,18,108,18,120,18,126,
+17,16,17,22,18,150,18,156,19,176,19,182,19,26,19,32,18,102,18,108,16,242,
+16,248,16,254,18,240,17,4,17,10,19,116,19,122,17,16,17,22,18,102,18,108,17,
+28,17,34,19,140,19,146,18,102,18,108,18,102,18,108,17,40,17,196,17,46,17,
+52,18,18,18,24,19,116,19,122,18,60,18,66,19,38,19,44,18,102,18,108,18,120,
+18,126,18,150,18,156,17,58,17,64,19,188,19,194,18,246,18,252,19,26,19,32,
+19,164,19,170,18,102,18,108,18,102,18,108,17,166,17,172,17,70,17,76,17,94,
+17,100,17,82,17,88,19,116,19,122,17,136,17,142,19,116,19,122,19,38,19,44,
+17,94,17,100,17,106,17,118,18,102,18,108,17,112,17,118,18,102,18,108,17,112,
+17,118,18,102,18,108,17,124,17,130,17,136,17,142,17,148,17,160,18,102,18,
+108,17,154,17,160,18,102,18,108,17,154,17,160,18,102,18,108,17,154,17,160,
+18,102,18,108,17,154,17,160,18,102,18,108,18,162,18,174,34,182,17,172,18,
+162,18,174,34,182,17,172,18,168,18,174,17,166,17,172,18,168,18,174,17,166,
+17,172,18,162,18,174,17,166,17,172,17,178,17,184,17,190,17,196,17,202,17,
+208,18,102,18,108,17,214,17,226,18,192,19,44,17,220,17,226,19,38,19,44,17,
+214,17,226,18,192,19,44,17,220,17,226,19,38,19,44,17,220,17,226,19,38,19,
+44,17,232,17,244,19,116,19,122,17,238,17,244,18,36,19,122,17,250,18,12,18,
+0,18,24,18,6,18,12,18,18,18,24,18,6,18,12,18,18,18,24,19,128,19,134,19,116,
+19,122,18,30,19,134,18,36,19,122,19,128,19,134,19,116,19,122,19,128,19,134,
+19,116,19,122,18,42,18,54,18,60,18,66,18,48,18,54,18,60,18,66,18,72,18,84,
+19,38,19,44,18,78,18,84,19,38,19,44,18,78,18,84,19,38,19,44,18,78,18,84,19,
+38,19,44,18,90,18,96,33,246,19,146,18,90,18,96,33,246,19,146,18,90,18,96,
+33,246,19,146,18,90,18,96,33,246,19,146,33,246,19,146,18,102,18,108,33,246,
+19,146,18,102,18,108,18,114,19,158,18,120,18,126,19,152,19,158,18,120,18,
+126,18,114,19,158,18,120,18,126,19,152,19,158,18,120,18,126,18,138,18,144,
+18,150,18,156,18,132,18,144,18,150,18,156,18,138,18,144,18,150,18,156,18,
+138,18,144,18,150,18,156,18,138,18,144,18,150,18,156,18,162,18,174,19,50,
+19,182,18,168,18,174,19,176,19,182,18,168,18,174,19,176,19,182,18,168,18,
+174,19,176,19,182,18,180,18,186,19,38,19,44,18,180,18,186,19,38,19,44,18,
+180,18,186,19,38,19,44,33,6,18,186,18,192,19,44,33,6,18,186,18,192,19,44,
+18,198,18,210,19,188,19,194,18,204,18,210,19,188,19,194,18,216,18,222,18,
+228,19,62,18,216,18,222,18,228,19,62,18,234,18,240,18,246,18,252,18,234,18,
+240,18,246,18,252,34,50,19,2,19,8,19,74,34,206,19,20,19,26,19,32,19,14,19,
+20,19,26,19,32,19,14,19,20,19,26,19,32,19,38,19,44,19,50,19,182,19,56,19,
+62,19,68,19,74,19,164,19,170,19,80,19,86,19,92,19,98,19,104,19,110,19,128,
+19,134,19,116,19,122,19,128,19,134,19,140,19,146,19,152,19,158,19,164,19,
+170,19,176,19,182,19,188,19,194,19,200,19,206,0,1,5,12,5,182,0,1,5,12,254,
+132,0,1,4,240,5,182,0,1,4,240,254,132,0,1,4,29,6,44,0,1,4,29,254,132,0,1,
+2,47,7,48,0,1,2,154,5,182,0,1,2,154,254,132,0,1,5,135,5,182,0,1,5,135,254,
+132,0,1,7,109,5,182,0,1,7,109,254,132,0,1,7,145,5,182,0,1,7,145,254,132,0,
+1,2,156,5,182,0,1,7,113,7,48,0,1,5,59,5,182,0,1,5,59,254,132,0,1,4,125,6,
+104,0,1,4,125,7,48,0,1,4,131,6,104,0,1,4,215,6,104,0,1,6,70,5,182,0,1,6,70,
+254,132,0,1,4,238,5,182,0,1,4,238,254,132,0,1,5,100,5,182,0,1,5,100,254,132,
+0,1,5,20,5,182,0,1,5,20,254,132,0,1,4,229,5,182,0,1,4,229,254,132,0,1,4,6,
+5,182,0,1,4,6,254,132,0,1,6,123,5,182,0,1,6,123,254,132,0,1,4,213,5,182,0,
+1,4,213,254,132,0,1,5,233,5,182,0,1,5,233,254,132,0,1,4,39,5,182,0,1,7,121,
+5,182,0,1,7,121,254,132,0,1,2,201,5,182,0,1,2,201,254,132,0,1,8,61,5,182,
+0,1,8,61,254,132,0,1,8,154,5,182,0,1,8,154,254,132,0,1,6,195,5,182,0,1,6,
+195,254,132,0,1,5,123,5,182,0,1,5,123,254,132,0,1,4,143,5,182,0,1,4,143,254,
+132,0,1,2,121,5,182,0,1,2,121,254,132,0,1,4,172,5,182,0,1,3,180,5,182,0,1,
+3,180,254,132,0,1,4,178,5,182,0,1,4,178,254,132,0,1,10,86,7,48,0,1,6,96,5,
+182,0,1,6,96,254,132,0,1,4,33,5,182,0,1,4,33,254,132,0,1,8,68,5,182,0,1,8,
+68,254,132,0,1,8,37,5,182,0,1,8,37,254,132,0,1,7,2,5,182,0,1,7,2,254,132,
+0,1,7,12,7,48,0,1,7,12,254,132,0,1,5,211,5,182,0,1,4,172,7,48,0,1,10,86,5,
+182,0,1,10,86,254,132,0,1,9,154,5,182,0,1,9,154,254,132,0,1,8,174,5,182,0,
+1,8,174,254,132,0,1,7,129,5,182,0,1,7,129,254,132,0,1,5,74,5,182,0,1,5,74,
+254,132,0,1,4,180,5,182,0,1,4,180,254,132,0,1,5,94,5,182,0,1,5,94,254,132,
+0,1,5,29,7,48,0,1,3,12,5,182,0,1,3,12,254,132,0,1,5,246,5,182,0,1,5,246,254,
+132,0,1,3,27,5,182,0,1,3,27,254,132,0,1,7,199,5,182,0,1,7,199,254,132,0,1,
+5,29,5,182,0,1,5,29,254,132,0,1,3,150,5,182,0,1,3,150,254,132,0,1,3,125,5,
+182,0,1,3,125,254,132,0,1,4,221,5,182,0,1,4,221,254,132,0,1,2,47,5,182,0,
+1,2,47,254,132,0,1,6,35,5,182,0,1,6,35,254,132,0,1,4,135,5,182,0,1,4,63,5,
+182,0,1,4,63,254,132,0,1,6,27,5,182,0,1,6,27,254,132,0,1,3,221,5,182,0,1,
+3,221,254,132,0,1,2,143,5,182,0,1,2,143,254,132,0,1,3,6,5,182,0,1,3,6,254,
+132,0,1,2,205,5,182,0,1,2,205,254,132,0,1,2,14,5,182,0,1,2,14,254,132,0,1,
+5,66,5,182,0,1,5,66,254,132,0,1,5,14,5,182,0,1,6,233,5,182,0,1,6,233,254,
+132,0,1,6,66,5,182,0,1,6,66,254,132,0,1,4,121,5,182,0,1,4,121,254,132,0,1,
+4,231,5,182,0,1,4,231,254,132,0,1,3,203,5,182,0,1,3,203,254,132,0,1,4,86,
+5,182,0,1,4,86,254,132,0,1,3,252,5,182,0,1,3,252,254,132,0,1,3,193,5,182,
+0,1,3,193,254,132,0,1,6,63,5,182,0,1,4,156,5,182,0,1,4,156,254,132,0,1,4,
+152,5,182,0,1,4,152,254,132,0,1,5,25,5,182,0,1,5,25,254,132,0,1,3,123,5,182,
+0,1,3,123,254,132,0,1,3,104,5,182,0,1,3,104,254,132,0,1,7,174,5,182,0,1,7,
+174,254,132,0,1,7,217,5,182,0,1,7,217,254,132,0,1,8,66,5,182,0,1,8,66,254,
+132,0,1,6,18,5,182,0,1,6,18,254,132,0,1,6,229,5,182,0,1,6,229,254,132,0,1,
+5,76,5,182,0,1,5,76,254,132,0,1,4,211,5,182,0,1,4,211,254,132,0,1,4,18,5,
+182,0,1,4,18,254,132,0,1,4,184,5,182,0,1,4,184,254,132,0,1,5,4,5,182,0,1,
+5,4,254,132,0,1,4,37,5,182,0,1,4,37,254,132,0,1,4,176,5,182,0,1,7,213,5,182,
+0,1,7,213,254,132,0,1,2,197,5,182,0,1,2,197,254,132,0,1,4,197,5,182,0,1,4,
+197,254,132,0,1,2,193,5,182,0,1,6,61,5,182,0,1,6,61,254,132,0,1,3,100,5,182,
+0,1,3,100,254,132,0,1,3,242,5,182,0,1,3,242,254,132,0,1,5,49,5,182,0,1,5,
+49,254,132,0,1,3,236,5,182,0,1,3,236,254,132,0,1,5,51,7,48,0,1,5,51,5,182,
+0,1,5,51,254,132,0,1,5,14,7,48,0,1,5,14,254,132,0,1,3,215,5,182,0,1,3,215,
+254,132,0,1,5,215,7,48,0,1,5,215,5,182,0,1,5,215,254,132,0,1,4,131,5,182,
+0,1,4,131,254,132,0,1,4,39,7,48,0,1,4,39,254,132,0,1,2,193,7,48,0,1,2,193,
+254,132,0,1,5,211,7,48,0,1,5,211,254,132,0,1,5,238,7,48,0,1,5,238,5,182,0,
+1,5,238,254,132,0,1,2,182,5,182,0,1,2,182,7,48,0,1,2,182,254,132,0,1,4,244,
+7,48,0,1,4,70,7,48,0,1,4,244,5,182,0,1,4,244,254,132,0,1,4,70,5,182,0,1,4,
+70,254,132,0,1,4,49,7,48,0,1,2,16,7,48,0,1,7,66,7,48,0,1,7,66,5,182,0,1,7,
+66,254,132,0,1,7,123,5,182,0,1,7,123,254,132,0,1,6,20,7,48,0,1,6,20,5,182,
+0,1,6,20,254,132,0,1,6,63,7,48,0,1,6,63,254,132,0,1,4,236,5,182,0,1,4,236,
+254,132,0,1,4,250,7,48,0,1,3,78,5,182,0,1,3,78,254,132,0,1,4,100,5,182,0,
+1,4,100,7,48,0,1,4,100,254,132,0,1,3,213,5,182,0,1,3,213,254,132,0,1,4,115,
+7,48,0,1,4,115,5,182,0,1,4,115,254,132,0,1,5,217,5,182,0,1,5,217,254,132,
+0,1,4,242,7,48,0,1,4,205,7,48,0,1,4,205,5,182,0,1,4,205,254,132,0,1,7,113,
+5,182,0,1,7,113,254,132,0,1,6,74,5,182,0,1,4,176,7,48,0,1,4,176,254,132,0,
+1,4,59,5,182,0,1,4,59,254,132,0,1,4,135,254,132,0,1,4,20,5,182,0,1,4,147,
+5,182,0,1,4,147,254,132,0,1,3,195,5,182,0,1,3,195,254,132,0,1,4,242,5,182,
+0,1,4,242,254,132,0,1,2,227,7,48,0,1,6,74,6,104,0,1,6,74,254,132,0,1,4,20,
+6,104,0,1,4,20,254,132,0,1,2,156,7,48,0,1,2,156,254,132,0,1,3,127,5,182,0,
+1,3,127,254,132,0,1,4,193,5,182,0,1,4,193,254,132,0,1,2,16,5,182,0,1,2,16,
+254,132,0,1,4,49,5,182,0,1,4,49,254,132,0,1,4,215,5,182,0,1,4,215,254,132,
+0,1,4,250,5,182,0,1,4,250,254,132,0,1,4,125,5,182,0,1,4,125,254,132,0,1,2,
+227,5,182,0,1,2,227,254,132,0,1,4,16,5,182,0,1,4,16,254,132,0,1,5,205,5,182,
+0,1,5,205,254,132,0,4,1,0,0,1,0,8,0,1,0,12,16,68,0,2,0,22,0,46,0,2,0,1,8,
+141,8,144,0,0,0,4,0,0,0,18,0,1,0,18,0,0,0,18,0,1,0,18,0,1,0,0,4,74,3,49,13,
+224,36,12,14,214,36,12,15,72,36,12,14,226,36,12,15,210,36,12,14,238,36,12,
+14,250,36,12,15,6,36,12,15,12,36,12,13,206,36,12,15,24,36,12,15,210,36,12,
+15,36,36,12,15,48,36,12,15,60,36,12,15,216,36,12,15,60,36,12,15,78,36,12,
+15,90,36,12,15,102,36,12,15,108,36,12,15,114,36,12,15,126,36,12,15,132,36,
+12,15,144,36,12,15,150,36,12,15,228,36,12,15,72,36,12,14,220,36,12,15,72,
+36,12,14,232,36,12,14,244,36,12,15,0,36,12,15,162,36,12,15,18,36,12,14,76,
+36,12,15,30,36,12,15,204,36,12,15,42,36,12,15,54,36,12,15,66,36,12,15,72,
+36,12,15,72,36,12,15,84,36,12,15,96,36,12,15,234,36,12,15,162,36,12,15,120,
+36,12,15,168,36,12,15,138,36,12,15,174,36,12,15,156,36,12,13,224,36,12,13,
+224,36,12,13,224,36,12,13,224,36,12,13,224,36,12,13,224,36,12,14,94,36,12,
+15,72,36,12,15,210,36,12,15,210,36,12,15,210,36,12,15,210,36,12,15,12,36,
+12,15,12,36,12,15,12,36,12,15,12,36,12,14,226,36,12,15,48,36,12,15,60,36,
+12,15,60,36,12,15,60,36,12,15,60,36,12,15,60,36,12,15,60,36,12,15,108,36,
+12,15,108,36,12,15,108,36,12,15,108,36,12,15,144,36,12,15,216,36,12,14,16,
+36,12,15,228,36,12,15,228,36,12,15,228,36,12,15,228,36,12,15,228,36,12,15,
+228,36,12,13,116,36,12,14,220,36,12,14,232,36,12,14,232,36,12,14,232,36,12,
+14,232,36,12,15,18,36,12,15,18,36,12,15,18,36,12,15,18,36,12,15,66,36,12,
+15,54,36,12,15,66,36,12,15,66,36,12,15,66,36,12,15,66,36,12,15,66,36,12,15,
+66,36,12,15,162,36,12,15,162,36,12,15,162,36,12,15,162,36,12,15,174,36,12,
+15,72,36,12,15,174,36,12,13,224,36,12,15,228,36,12,13,224,36,12,15,228,36,
+12,13,224,36,12,15,228,36,12,15,72,36,12,14,220,36,12,15,72,36,12,14,220,
+36,12,15,72,36,12,14,220,36,12,15,72,36,12,14,220,36,12,14,226,36,12,15,72,
+36,12,14,226,36,12,15,72,36,12,15,210,36,12,14,232,36,12,15,210,36,12,14,
+232,36,12,15,210,36,12,14,232,36,12,15,210,36,12,14,232,36,12,15,210,36,12,
+14,232,36,12,14,250,36,12,15,0,36,12,14,250,36,12,15,0,36,12,14,250,36,12,
+15,0,36,12,14,250,36,12,15,0,36,12,15,6,36,12,15,162,36,12,15,6,36,12,15,
+162,36,12,15,12,36,12,15,18,36,12,15,12,36,12,15,18,36,12,15,12,36,12,15,
+18,36,12,15,12,36,12,15,18,36,12,15,12,36,12,15,18,36,12,12,198,36,12,12,
+204,36,12,13,206,36,12,14,76,36,12,15,24,36,12,15,30,36,12,15,30,36,12,15,
+210,36,12,15,204,36,12,15,210,36,12,15,204,36,12,15,210,36,12,15,204,36,12,
+15,210,36,12,12,210,36,12,15,210,36,12,14,10,36,12,15,48,36,12,15,54,36,12,
+15,48,36,12,15,54,36,12,15,48,36,12,15,54,36,12,13,164,36,12,15,48,36,12,
+15,162,36,12,15,60,36,12,15,66,36,12,15,60,36,12,15,66,36,12,15,60,36,12,
+15,66,36,12,12,216,36,12,12,222,36,12,15,78,36,12,15,84,36,12,15,78,36,12,
+15,84,36,12,15,78,36,12,15,84,36,12,15,90,36,12,15,96,36,12,15,90,36,12,15,
+96,36,12,15,90,36,12,15,96,36,12,15,90,36,12,15,96,36,12,15,102,36,12,15,
+234,36,12,15,102,36,12,15,234,36,12,15,102,36,12,15,234,36,12,15,108,36,12,
+15,162,36,12,15,108,36,12,15,162,36,12,15,108,36,12,15,162,36,12,15,108,36,
+12,15,162,36,12,15,108,36,12,15,162,36,12,15,108,36,12,15,162,36,12,15,126,
+36,12,15,168,36,12,15,144,36,12,15,174,36,12,15,144,36,12,15,150,36,12,15,
+156,36,12,15,150,36,12,15,156,36,12,15,150,36,12,15,156,36,12,15,180,36,12,
+12,228,36,12,15,126,36,12,15,168,36,12,15,126,36,12,15,168,36,12,15,126,36,
+12,15,168,36,12,15,144,36,12,15,174,36,12,14,76,36,12,14,76,36,12,15,36,36,
+12,15,42,36,12,13,224,36,12,15,228,36,12,12,240,36,12,12,234,36,12,12,240,
+36,12,12,246,36,12,13,224,36,12,15,228,36,12,13,224,36,12,15,228,36,12,13,
+224,36,12,15,228,36,12,13,224,36,12,15,228,36,12,13,224,36,12,15,228,36,12,
+13,224,36,12,15,228,36,12,13,224,36,12,15,228,36,12,13,224,36,12,15,228,36,
+12,13,224,36,12,15,228,36,12,13,224,36,12,15,228,36,12,13,224,36,12,15,228,
+36,12,13,224,36,12,15,228,36,12,15,210,36,12,14,232,36,12,15,210,36,12,14,
+232,36,12,15,210,36,12,14,232,36,12,15,210,36,12,14,232,36,12,15,210,36,12,
+14,232,36,12,15,210,36,12,14,232,36,12,15,210,36,12,14,232,36,12,15,210,36,
+12,14,232,36,12,15,12,36,12,15,18,36,12,15,12,36,12,15,18,36,12,15,60,36,
+12,15,66,36,12,15,60,36,12,15,66,36,12,15,60,36,12,15,66,36,12,15,60,36,12,
+15,66,36,12,15,60,36,12,15,66,36,12,15,60,36,12,15,66,36,12,15,60,36,12,15,
+66,36,12,12,240,36,12,12,234,36,12,12,240,36,12,12,234,36,12,12,240,36,12,
+12,234,36,12,12,240,36,12,12,234,36,12,12,240,36,12,12,234,36,12,15,108,36,
+12,15,162,36,12,15,108,36,12,15,162,36,12,12,240,36,12,12,246,36,12,12,240,
+36,12,12,246,36,12,12,240,36,12,12,246,36,12,12,240,36,12,12,246,36,12,12,
+240,36,12,12,246,36,12,15,144,36,12,15,174,36,12,15,144,36,12,15,174,36,12,
+15,144,36,12,15,174,36,12,15,102,36,12,15,234,36,12,15,72,36,12,12,252,36,
+12,15,216,36,12,15,72,36,12,13,2,36,12,15,216,36,12,15,102,36,12,15,72,36,
+12,14,220,36,12,14,226,36,12,13,8,36,12,15,216,36,12,15,72,36,12,15,66,36,
+12,15,210,36,12,13,14,36,12,15,198,36,12,14,238,36,12,14,250,36,12,15,114,
+36,12,13,20,36,12,15,12,36,12,15,12,36,12,15,24,36,12,15,30,36,12,15,204,
+36,12,14,232,36,12,13,26,36,12,15,48,36,12,15,54,36,12,15,60,36,12,13,32,
+36,12,13,38,36,12,14,130,36,12,15,72,36,12,15,78,36,12,15,90,36,12,15,96,
+36,12,13,236,36,12,14,76,36,12,15,234,36,12,13,44,36,12,15,234,36,12,15,102,
+36,12,13,50,36,12,13,56,36,12,13,62,36,12,13,68,36,12,15,150,36,12,15,156,
+36,12,13,152,36,12,13,152,36,12,14,142,36,12,13,74,36,12,13,80,36,12,15,72,
+36,12,13,122,36,12,13,128,36,12,13,134,36,12,13,86,36,12,13,92,36,12,13,98,
+36,12,13,104,36,12,13,110,36,12,15,42,36,12,13,224,36,12,15,228,36,12,15,
+12,36,12,15,18,36,12,15,60,36,12,15,66,36,12,15,108,36,12,15,162,36,12,14,
+232,36,12,14,94,36,12,13,116,36,12,14,250,36,12,15,0,36,12,14,250,36,12,15,
+0,36,12,15,24,36,12,15,30,36,12,15,60,36,12,15,66,36,12,15,60,36,12,15,66,
+36,12,13,152,36,12,14,52,36,12,13,122,36,12,13,128,36,12,13,134,36,12,14,
+250,36,12,15,0,36,12,13,140,36,12,13,146,36,12,15,48,36,12,15,54,36,12,13,
+224,36,12,15,228,36,12,13,224,36,12,15,228,36,12,15,210,36,12,14,232,36,12,
+15,210,36,12,14,232,36,12,15,12,36,12,15,18,36,12,15,12,36,12,15,18,36,12,
+15,60,36,12,15,66,36,12,15,60,36,12,15,66,36,12,15,78,36,12,15,84,36,12,15,
+78,36,12,15,84,36,12,15,108,36,12,15,162,36,12,15,108,36,12,15,162,36,12,
+13,152,36,12,13,158,36,12,15,6,36,12,15,162,36,12,13,164,36,12,15,72,36,12,
+13,170,36,12,15,66,36,12,15,150,36,12,15,156,36,12,13,224,36,12,15,228,36,
+12,15,210,36,12,14,232,36,12,15,60,36,12,15,66,36,12,15,144,36,12,15,174,
+36,12,14,202,36,12,14,226,36,12,13,176,36,12,13,182,36,12,13,182,36,12,13,
+224,36,12,15,72,36,12,14,220,36,12,15,210,36,12,15,102,36,12,15,96,36,12,
+13,188,36,12,13,194,36,12,13,200,36,12,14,214,36,12,15,108,36,12,15,114,36,
+12,15,210,36,12,14,232,36,12,13,206,36,12,14,76,36,12,13,212,36,12,15,72,
+36,12,15,78,36,12,15,84,36,12,15,144,36,12,15,174,36,12,15,228,36,12,15,72,
+36,12,15,72,36,12,15,72,36,12,14,220,36,12,13,218,36,12,15,72,36,12,14,82,
+36,12,14,232,36,12,14,232,36,12,13,224,36,12,13,230,36,12,14,208,36,12,13,
+236,36,12,14,64,36,12,14,76,36,12,15,72,36,12,15,72,36,12,15,30,36,12,15,
+120,36,12,13,242,36,12,15,162,36,12,15,162,36,12,15,162,36,12,15,18,36,12,
+14,166,36,12,13,248,36,12,13,254,36,12,14,4,36,12,14,10,36,12,14,16,36,12,
+15,42,36,12,15,42,36,12,15,42,36,12,15,54,36,12,15,54,36,12,14,22,36,12,15,
+66,36,12,14,28,36,12,14,34,36,12,15,246,36,12,15,84,36,12,15,84,36,12,15,
+84,36,12,15,84,36,12,15,84,36,12,15,96,36,12,15,96,36,12,14,40,36,12,14,40,
+36,12,15,96,36,12,14,166,36,12,14,46,36,12,14,166,36,12,14,166,36,12,15,234,
+36,12,15,234,36,12,15,162,36,12,15,30,36,12,15,198,36,12,15,120,36,12,15,
+168,36,12,15,174,36,12,15,228,36,12,15,156,36,12,15,156,36,12,14,52,36,12,
+14,52,36,12,14,88,36,12,14,88,36,12,14,88,36,12,14,220,36,12,15,60,36,12,
+14,58,36,12,14,64,36,12,15,30,36,12,14,70,36,12,14,76,36,12,15,30,36,12,14,
+190,36,12,14,82,36,12,14,88,36,12,14,88,36,12,14,100,36,12,14,94,36,12,14,
+100,36,12,14,106,36,12,14,112,36,12,14,118,36,12,14,124,36,12,14,130,36,12,
+14,136,36,12,14,142,36,12,14,154,36,12,14,148,36,12,14,148,36,12,15,72,36,
+12,15,72,36,12,14,244,36,12,15,42,36,12,15,54,36,12,15,72,36,12,15,84,36,
+12,15,96,36,12,15,96,36,12,15,234,36,12,15,156,36,12,15,72,36,12,14,154,36,
+12,15,66,36,12,14,160,36,12,15,18,36,12,14,166,36,12,15,72,36,12,14,172,36,
+12,15,30,36,12,15,72,36,12,15,72,36,12,14,244,36,12,14,178,36,12,15,30,36,
+12,15,204,36,12,15,42,36,12,15,54,36,12,15,72,36,12,15,84,36,12,15,96,36,
+12,14,184,36,12,15,120,36,12,15,138,36,12,15,156,36,12,15,228,36,12,15,72,
+36,12,15,72,36,12,14,232,36,12,14,190,36,12,14,208,36,12,14,196,36,12,15,
+18,36,12,14,220,36,12,14,202,36,12,15,162,36,12,14,208,36,12,14,214,36,12,
+15,72,36,12,14,214,36,12,15,72,36,12,14,214,36,12,15,72,36,12,15,72,36,12,
+14,220,36,12,14,226,36,12,15,72,36,12,14,226,36,12,15,72,36,12,14,226,36,
+12,15,72,36,12,14,226,36,12,15,72,36,12,14,226,36,12,15,72,36,12,15,210,36,
+12,14,232,36,12,15,210,36,12,14,232,36,12,15,210,36,12,14,232,36,12,15,210,
+36,12,14,232,36,12,15,210,36,12,14,232,36,12,14,238,36,12,14,244,36,12,14,
+250,36,12,15,0,36,12,15,6,36,12,15,162,36,12,15,6,36,12,15,162,36,12,15,6,
+36,12,15,162,36,12,15,6,36,12,15,162,36,12,15,6,36,12,15,162,36,12,15,12,
+36,12,15,18,36,12,15,12,36,12,15,18,36,12,15,24,36,12,15,30,36,12,15,24,36,
+12,15,30,36,12,15,24,36,12,15,30,36,12,15,210,36,12,15,204,36,12,15,210,36,
+12,15,204,36,12,15,210,36,12,15,204,36,12,15,210,36,12,15,204,36,12,15,36,
+36,12,15,42,36,12,15,36,36,12,15,42,36,12,15,48,36,12,15,54,36,12,15,48,36,
+12,15,54,36,12,15,48,36,12,15,54,36,12,15,48,36,12,15,54,36,12,15,60,36,12,
+15,66,36,12,15,60,36,12,15,66,36,12,15,60,36,12,15,66,36,12,15,60,36,12,15,
+66,36,12,15,216,36,12,15,72,36,12,15,216,36,12,15,72,36,12,15,78,36,12,15,
+84,36,12,15,78,36,12,15,84,36,12,15,78,36,12,15,84,36,12,15,78,36,12,15,84,
+36,12,15,90,36,12,15,96,36,12,15,90,36,12,15,96,36,12,15,90,36,12,15,96,36,
+12,15,90,36,12,15,96,36,12,15,90,36,12,15,96,36,12,15,102,36,12,15,234,36,
+12,15,102,36,12,15,234,36,12,15,102,36,12,15,234,36,12,15,102,36,12,15,234,
+36,12,15,108,36,12,15,162,36,12,15,108,36,12,15,162,36,12,15,108,36,12,15,
+162,36,12,15,108,36,12,15,162,36,12,15,108,36,12,15,162,36,12,15,114,36,12,
+15,120,36,12,15,114,36,12,15,120,36,12,15,126,36,12,15,168,36,12,15,126,36,
+12,15,168,36,12,15,132,36,12,15,138,36,12,15,132,36,12,15,138,36,12,15,144,
+36,12,15,174,36,12,15,150,36,12,15,156,36,12,15,150,36,12,15,156,36,12,15,
+150,36,12,15,156,36,12,15,162,36,12,15,234,36,12,15,168,36,12,15,174,36,12,
+15,228,36,12,15,180,36,12,15,186,36,12,15,192,36,12,15,198,36,12,15,204,36,
+12,15,210,36,12,15,216,36,12,15,222,36,12,15,228,36,12,15,234,36,12,15,240,
+36,12,15,246,36,12,0,1,5,145,7,48,0,1,4,246,7,48,0,1,2,246,7,48,0,1,7,172,
+7,48,0,1,7,61,7,48,0,1,4,121,7,48,0,1,4,219,7,48,0,1,6,57,7,48,0,1,5,104,
+7,48,0,1,5,217,7,48,0,1,4,166,7,48,0,1,6,111,7,48,0,1,5,133,7,48,0,1,7,74,
+7,48,0,1,8,111,7,48,0,1,8,209,7,48,0,1,6,203,7,48,0,1,5,6,7,48,0,1,6,6,7,
+48,0,1,5,123,7,48,0,1,5,31,7,48,0,1,4,236,7,48,0,1,3,215,7,48,0,1,3,113,7,
+48,0,1,7,215,7,48,0,1,7,98,7,48,0,1,4,225,7,48,0,1,8,246,7,48,0,1,8,129,7,
+48,0,1,6,186,7,48,0,1,10,141,7,48,0,1,9,231,7,48,0,1,9,0,7,48,0,1,8,131,7,
+48,0,1,5,141,7,48,0,1,4,211,7,48,0,1,4,29,7,48,0,1,6,61,7,48,0,1,5,57,7,48,
+0,1,3,8,7,48,0,1,7,88,7,48,0,1,4,6,7,48,0,1,3,244,7,48,0,1,3,84,7,48,0,1,
+2,219,7,48,0,1,6,119,7,48,0,1,4,35,7,48,0,1,5,164,7,48,0,1,3,205,7,48,0,1,
+4,215,7,48,0,1,4,178,7,48,0,1,2,164,7,48,0,1,2,238,7,48,0,1,2,205,7,48,0,
+1,2,152,7,48,0,1,5,45,7,48,0,1,5,78,7,48,0,1,6,82,7,48,0,1,6,37,7,48,0,1,
+4,135,7,48,0,1,2,147,7,48,0,1,4,96,7,48,0,1,4,195,7,48,0,1,4,113,7,48,0,1,
+5,129,7,48,0,1,2,102,7,48,0,1,5,2,7,48,0,1,3,225,7,48,0,1,7,156,7,48,0,1,
+7,176,7,48,0,1,5,197,7,48,0,1,4,106,7,48,0,1,6,70,7,48,0,1,7,55,7,48,0,1,
+5,115,7,48,0,1,5,66,7,48,0,1,4,119,7,48,0,1,5,242,7,48,0,1,4,55,7,48,0,1,
+7,182,7,48,0,1,2,172,7,48,0,1,4,131,7,48,0,1,5,229,7,48,0,1,3,143,7,48,0,
+1,3,248,7,48,0,1,4,147,7,48,0,1,3,35,7,48,0,1,3,233,7,48,0,1,5,59,7,48,0,
+1,3,240,7,48,0,1,5,209,7,48,0,1,4,72,7,48,0,1,4,184,7,48,0,1,2,244,7,48,0,
+1,5,182,7,48,0,1,4,78,7,48,0,1,6,88,7,48,0,1,2,240,7,48,0,1,2,143,7,48,0,
+1,5,154,7,48,0,1,4,174,7,48,0,1,7,129,7,48,0,1,7,143,7,48,0,1,6,27,7,48,0,
+1,5,41,7,48,0,1,5,240,7,48,0,1,4,158,7,48,0,1,4,233,7,48,0,1,5,63,7,48,0,
+1,3,197,7,48,0,1,4,90,7,48,0,1,3,156,7,48,0,1,4,231,7,48,0,1,5,188,7,48,0,
+1,5,102,7,48,0,1,4,162,7,48,0,1,8,96,7,48,0,1,5,72,7,48,0,1,4,160,7,48,0,
+1,5,0,7,48,0,1,4,188,7,48,0,1,4,23,7,48,0,1,5,20,7,48,0,1,6,229,7,48,0,1,
+4,133,7,48,0,1,2,215,7,48,0,1,3,219,7,48,0,1,4,193,7,48,0,1,4,190,7,48,0,
+1,2,123,7,48,0,1,4,252,7,48,0,1,4,213,7,48,0,1,5,43,7,48,0,1,4,129,7,48,0,
+1,2,209,7,48,0,1,4,139,7,48,0,1,5,147,7,48,0,4,0,0,0,1,0,8,0,1,0,12,0,18,
+0,1,0,172,0,184,0,1,0,1,5,5,0,2,0,25,0,36,0,61,0,0,0,68,0,93,0,26,0,130,0,
+152,0,52,0,154,0,184,0,75,0,186,1,66,0,106,1,250,2,1,0,243,2,53,2,53,0,251,
+2,76,2,76,0,252,2,81,2,84,0,253,2,90,2,93,1,1,3,24,3,111,1,5,3,124,3,177,
+1,93,3,181,3,184,1,147,3,189,3,205,1,151,3,214,3,214,1,168,3,219,4,23,1,169,
+4,28,4,29,1,230,4,32,4,156,1,232,5,242,6,32,2,101,6,83,6,228,2,148,8,0,8,
+0,3,38,8,78,8,78,3,39,8,95,8,101,3,40,8,112,8,112,3,47,8,115,8,115,3,48,0,
+1,0,0,0,6,0,1,0,141,255,220,3,49,8,128,8,164,8,134,10,234,12,190,12,196,12,
+190,11,44,12,196,8,176,11,74,12,190,11,122,11,134,11,164,12,196,10,54,12,
+202,11,200,11,224,12,52,12,172,12,82,12,88,12,100,12,106,12,160,10,204,11,
+170,10,240,11,170,11,32,11,38,11,50,12,166,8,182,11,68,12,184,11,128,11,140,
+11,170,11,176,6,100,12,166,11,206,11,230,11,50,12,64,12,148,12,94,12,154,
+12,118,8,128,8,128,8,128,8,128,8,128,8,128,6,106,6,112,12,190,12,190,12,190,
+12,190,12,196,12,196,12,196,12,196,10,234,11,134,11,164,11,164,11,164,11,
+164,11,164,11,164,12,52,12,52,12,52,12,52,12,100,12,196,6,118,12,160,12,160,
+12,160,12,160,12,160,12,160,6,184,8,26,11,170,11,170,11,170,11,170,12,166,
+12,166,12,166,12,166,11,170,11,140,11,170,11,170,11,170,11,170,11,170,11,
+170,11,50,11,50,11,50,11,50,12,154,11,176,12,154,8,128,12,160,8,128,12,160,
+6,124,6,130,8,134,11,170,8,134,11,170,8,134,11,170,8,134,11,170,10,234,10,
+240,10,234,10,240,12,190,11,170,12,190,11,170,12,190,11,170,6,136,12,16,12,
+190,11,170,12,178,12,22,12,178,12,22,12,178,12,22,6,142,12,22,11,44,11,50,
+11,44,11,50,12,196,12,166,12,196,12,166,6,148,12,166,6,154,6,160,12,196,12,
+166,6,166,6,172,8,176,8,182,11,74,11,68,11,68,12,190,12,184,9,250,12,184,
+12,190,12,184,12,190,12,184,12,190,6,178,11,134,11,140,11,134,11,140,11,134,
+11,140,6,184,6,190,6,196,11,164,11,170,11,164,11,170,11,164,11,170,6,202,
+8,116,12,202,12,166,12,202,12,166,12,202,12,166,11,200,11,206,11,200,11,206,
+11,14,6,208,11,200,11,206,6,214,6,220,11,224,11,230,11,224,11,230,12,52,11,
+50,12,52,11,50,12,52,11,50,12,52,11,50,12,52,11,50,6,226,6,232,12,82,12,148,
+12,100,12,154,12,100,12,106,12,118,12,106,12,118,12,106,12,118,12,166,6,238,
+12,82,12,148,12,82,12,148,12,82,12,148,12,100,12,154,8,182,8,182,11,122,11,
+128,8,128,6,244,11,164,11,170,12,52,11,50,8,128,6,250,8,128,12,160,8,128,
+12,160,8,128,12,160,8,128,12,160,8,128,12,160,8,128,7,0,8,128,12,160,8,128,
+12,160,8,128,12,160,8,128,12,160,8,128,7,0,7,6,11,212,12,190,11,170,12,190,
+11,170,12,190,11,170,12,190,11,170,12,190,11,170,12,190,11,170,7,12,11,212,
+12,196,12,166,7,18,7,24,7,30,7,36,11,164,11,170,11,164,11,170,11,164,11,170,
+11,164,11,170,11,164,11,170,7,30,7,36,11,164,11,170,11,164,11,170,11,164,
+11,170,11,164,11,170,7,30,7,36,7,48,7,42,12,52,11,50,12,52,11,50,12,52,11,
+50,12,52,11,50,12,52,11,50,7,48,11,50,7,54,12,154,12,100,12,154,12,100,12,
+154,7,60,7,66,10,204,12,190,10,198,10,204,10,198,9,124,11,200,8,134,11,170,
+10,234,7,72,7,78,10,240,11,200,8,74,7,84,10,198,7,90,12,190,7,96,7,102,7,
+156,12,196,11,74,11,68,12,184,7,108,7,114,11,134,7,120,11,164,7,126,7,132,
+7,138,11,176,7,144,7,150,7,156,12,112,7,162,7,168,7,174,11,230,7,180,7,186,
+10,54,7,192,12,154,12,106,12,118,7,198,8,20,7,204,11,206,7,210,9,58,8,32,
+8,38,8,44,7,216,7,222,7,228,7,234,7,240,7,246,8,128,12,160,12,196,12,166,
+11,164,11,170,12,52,11,50,7,252,8,2,8,8,12,190,11,38,12,190,11,38,11,74,11,
+68,8,14,11,26,8,14,11,26,8,20,8,26,8,32,8,38,8,44,12,190,11,38,8,50,9,58,
+11,134,11,140,8,128,12,160,8,128,12,160,12,190,11,170,12,190,11,170,12,196,
+12,166,12,196,12,166,11,164,11,170,11,164,11,170,12,202,12,166,12,202,12,
+166,12,52,9,118,12,52,9,118,9,124,8,56,11,44,11,50,8,62,8,68,8,74,9,124,8,
+80,8,86,8,128,12,160,8,92,8,98,11,164,11,170,12,100,12,154,8,104,8,110,12,
+142,8,116,8,122,8,128,8,134,11,170,12,190,11,224,8,140,8,146,8,152,8,158,
+8,164,12,52,8,170,12,190,9,124,8,176,8,182,8,188,8,200,12,202,12,166,12,100,
+12,154,11,200,11,8,9,124,9,124,8,194,12,214,8,200,11,8,11,200,11,200,11,200,
+11,200,11,206,11,206,9,124,8,206,12,22,12,22,9,124,8,212,12,214,8,218,11,
+140,8,224,12,166,8,230,8,236,8,242,8,242,8,248,8,254,9,4,9,10,9,16,11,140,
+9,22,9,28,11,170,9,34,9,40,9,46,9,52,9,52,10,222,9,58,9,64,12,166,9,70,11,
+140,12,214,9,76,9,82,9,88,9,94,9,100,9,106,9,112,9,118,9,124,10,54,12,112,
+9,130,9,136,9,142,9,148,10,0,11,38,11,38,9,154,9,208,9,160,9,166,11,164,10,
+240,10,240,9,172,11,86,9,178,9,184,9,190,9,196,9,202,9,208,9,214,9,220,9,
+226,9,250,9,232,9,238,9,244,12,106,9,250,10,0,10,6,10,12,10,18,10,204,10,
+240,11,32,11,128,11,140,11,176,12,166,12,184,11,206,11,230,12,118,10,24,10,
+30,10,36,10,42,12,166,10,48,11,176,10,54,10,54,10,60,10,66,10,72,12,22,10,
+78,10,84,10,90,10,96,11,176,10,102,10,108,10,114,10,120,10,126,10,132,10,
+138,10,144,10,150,10,156,10,156,10,192,10,162,10,168,10,174,10,180,10,186,
+10,192,10,198,10,204,10,246,10,210,10,216,12,136,10,222,10,228,10,234,10,
+240,10,246,11,8,10,252,11,2,11,110,11,8,13,120,11,8,12,190,11,170,12,190,
+11,170,11,110,11,14,12,34,11,20,11,26,12,46,12,196,11,32,12,190,11,38,11,
+44,11,50,11,44,11,50,11,44,11,50,11,44,11,50,11,44,11,50,11,56,11,62,12,196,
+12,166,11,74,11,68,11,74,11,68,11,74,11,80,11,86,11,92,11,86,11,92,11,98,
+11,104,11,110,11,116,11,122,11,128,11,122,11,128,11,134,11,140,11,134,11,
+140,11,146,12,136,11,152,11,158,11,164,11,170,11,164,11,170,11,164,11,170,
+11,164,11,170,12,196,11,176,12,196,11,176,12,202,12,166,12,202,11,182,12,
+202,11,182,11,188,11,194,11,200,11,206,11,212,11,218,11,200,11,206,11,200,
+11,206,11,212,11,218,11,224,11,230,11,236,11,242,11,248,11,254,12,4,12,10,
+12,16,12,22,12,28,12,34,12,40,12,46,12,52,12,58,12,52,12,58,12,172,12,64,
+12,70,12,76,12,82,12,148,12,82,12,148,12,88,12,94,12,88,12,94,12,100,12,154,
+12,106,12,118,12,112,12,118,12,124,12,130,12,136,12,142,12,148,12,154,12,
+160,12,166,12,172,12,178,12,190,12,184,12,190,12,196,12,202,12,208,12,214,
+12,220,12,226,0,1,4,12,254,20,0,1,6,219,0,0,0,1,3,72,254,72,0,1,3,232,0,0,
+0,1,5,27,254,92,0,1,3,164,254,92,0,1,4,16,254,92,0,1,4,250,0,74,0,1,1,222,
+0,0,0,1,2,17,254,92,0,1,1,198,254,92,0,1,3,62,254,115,0,1,3,12,254,115,0,
+1,1,198,0,0,0,1,5,80,0,0,0,1,4,96,254,122,0,1,3,92,254,122,0,1,6,117,0,0,
+0,1,2,78,254,112,0,1,2,148,254,112,0,1,1,224,254,112,0,1,3,142,254,92,0,1,
+4,38,254,92,0,1,0,220,254,72,0,1,3,212,0,0,0,1,2,118,254,202,0,1,2,120,254,
+202,0,1,2,228,254,202,0,1,2,188,254,202,0,1,1,233,254,202,0,1,1,184,254,202,
+0,1,3,92,254,202,0,1,2,168,254,202,0,1,3,24,254,202,0,1,3,82,254,202,0,1,
+2,236,254,202,0,1,2,238,254,72,0,1,2,8,254,72,0,1,3,102,0,0,0,1,3,12,0,0,
+0,1,3,92,0,0,0,1,0,120,254,117,0,1,3,12,254,72,0,1,5,100,0,0,0,1,4,16,0,0,
+0,1,5,200,0,0,0,1,4,76,254,20,0,1,7,225,254,20,0,1,6,9,254,20,0,1,2,125,0,
+0,0,1,5,40,255,31,0,1,2,178,0,0,0,1,2,88,0,0,0,1,2,68,254,72,0,1,2,68,254,
+172,0,1,2,237,0,0,0,1,2,217,254,72,0,1,3,132,0,0,0,1,2,230,0,0,0,1,2,194,
+0,0,0,1,2,93,0,0,0,1,2,9,0,0,0,1,5,170,254,117,0,1,5,143,254,117,0,1,3,32,
+254,117,0,1,6,184,254,117,0,1,6,204,254,117,0,1,5,180,254,117,0,1,2,156,0,
+0,0,1,6,28,0,0,0,1,5,95,0,0,0,1,3,172,254,112,0,1,2,218,0,0,0,1,2,168,254,
+72,0,1,9,205,0,0,0,1,9,31,0,0,0,1,8,55,0,0,0,1,6,128,0,0,0,1,2,78,254,72,
+0,1,5,92,254,20,0,1,4,216,254,72,0,1,3,32,0,0,0,1,2,2,0,0,0,1,1,188,0,0,0,
+1,3,19,254,72,0,1,2,169,254,72,0,1,2,12,0,0,0,1,5,7,0,0,0,1,5,220,0,0,0,1,
+5,250,0,0,0,1,5,27,0,0,0,1,3,122,0,0,0,1,2,237,254,72,0,1,3,18,254,72,0,1,
+2,46,0,0,0,1,1,228,0,0,0,1,2,248,0,4,0,1,4,196,0,0,0,1,0,150,254,117,0,1,
+0,90,254,117,0,1,5,225,254,72,0,1,2,18,0,0,0,1,4,196,254,72,0,1,0,200,254,
+72,0,1,2,108,254,72,0,1,4,68,254,20,0,1,3,232,254,72,0,1,1,244,0,0,0,1,1,
+182,0,0,0,1,1,221,0,0,0,1,1,244,254,72,0,1,3,92,254,72,0,1,6,205,0,0,0,1,
+6,213,254,20,0,1,6,104,254,72,0,1,4,236,254,72,0,1,4,96,0,0,0,1,5,117,0,0,
+0,1,4,146,0,0,0,1,3,8,254,20,0,1,2,210,0,0,0,1,1,178,254,20,0,1,1,229,254,
+72,0,1,2,179,254,20,0,1,1,164,254,122,0,1,1,8,254,72,0,1,0,104,254,72,0,1,
+2,78,254,63,0,1,0,175,254,72,0,1,1,167,255,13,0,1,2,35,254,54,0,1,4,68,0,
+0,0,1,2,208,0,0,0,1,6,74,0,0,0,1,3,242,0,0,0,1,2,166,0,0,0,1,4,56,254,112,
+0,1,2,42,0,0,0,1,2,45,0,0,0,1,2,208,254,72,0,1,2,198,0,0,0,1,1,24,254,72,
+0,1,3,212,254,20,0,1,2,215,0,0,0,1,4,1,254,20,0,1,2,22,0,0,0,1,2,136,0,0,
+0,1,6,224,0,0,0,1,6,9,254,72,0,1,6,207,0,0,0,1,2,234,254,72,0,1,4,207,0,0,
+0,1,5,149,254,72,0,1,4,116,0,0,0,1,3,72,0,0,0,1,3,236,0,0,0,1,5,20,254,20,
+0,1,5,60,254,72,0,1,3,22,254,72,0,1,3,140,1,203,0,1,2,228,254,72,0,1,6,217,
+0,0,0,1,2,58,0,0,0,1,2,188,0,0,0,1,3,212,254,132,0,1,4,96,254,132,0,1,2,68,
+254,132,0,1,4,56,254,132,0,1,1,244,254,132,0,1,6,224,254,132,0,1,4,116,254,
+132,0,1,2,8,254,132,0,1,2,160,254,132,0,1,1,4,254,72,0,1,2,208,254,132,0,
+1,3,232,254,132,0,1,3,22,254,132,0,1,4,172,254,132,0,1,5,50,254,132,0,1,4,
+206,254,72,0,1,4,76,254,132,0,1,4,207,254,132,0,1,2,248,254,132,0,1,1,104,
+254,132,0,1,0,240,254,132,0,1,5,80,254,132,0,1,1,74,254,132,0,1,2,248,0,0,
+0,1,3,52,0,0,0,1,3,52,254,202,0,1,2,248,254,232,0,1,3,52,254,72,0,1,2,128,
+254,72,0,1,2,193,0,0,0,1,2,138,0,0,0,1,2,248,254,202,0,1,3,62,254,232,0,1,
+2,178,254,232,0,1,4,61,0,0,0,1,2,168,254,112,0,1,2,168,254,162,0,1,3,12,254,
+112,0,1,1,186,0,0,0,1,2,148,254,72,0,1,5,72,0,0,0,1,4,55,0,0,0,1,1,182,254,
+162,0,1,1,138,254,162,0,1,4,156,0,0,0,1,5,154,0,0,0,1,3,2,254,232,0,1,4,136,
+0,0,0,1,1,174,254,202,0,1,2,228,254,232,0,1,1,164,254,232,0,1,2,228,254,112,
+0,1,1,164,254,112,0,1,6,113,0,0,0,1,6,178,0,0,0,1,5,31,0,0,0,1,4,76,0,0,0,
+1,3,112,254,232,0,1,3,132,254,112,0,1,2,238,254,112,0,1,3,152,0,0,0,1,2,168,
+0,0,0,1,1,158,254,20,0,1,1,178,254,202,0,1,3,12,254,232,0,1,1,178,254,232,
+0,1,2,148,0,0,0,1,2,38,0,0,0,1,2,148,254,202,0,1,2,48,254,202,0,1,2,217,0,
+0,0,1,2,28,0,0,0,1,2,217,254,202,0,1,2,28,254,202,0,1,2,217,254,232,0,1,2,
+8,254,232,0,1,2,217,254,112,0,1,2,28,254,112,0,1,3,82,254,92,0,1,2,188,254,
+72,0,1,3,47,254,162,0,1,2,208,254,162,0,1,3,52,254,112,0,1,2,188,254,112,
+0,1,3,82,0,0,0,1,4,58,0,0,0,1,2,164,0,0,0,1,2,242,254,202,0,1,2,164,254,202,
+0,1,6,49,0,0,0,1,4,126,0,0,0,1,4,26,0,0,0,1,2,236,0,0,0,1,3,252,0,0,0,1,4,
+6,0,0,0,1,3,78,0,0,0,1,2,188,254,232,0,1,2,68,254,232,0,1,2,208,254,232,0,
+1,2,8,0,0,0,1,5,39,0,0,0,1,0,220,254,117,0,1,3,164,0,0,0,1,1,178,0,0,0,1,
+2,252,0,0,0,1,3,192,0,0,0,1,1,158,0,0,0,1,3,172,0,0,0,1,1,223,0,0,0,1,5,30,
+0,0,0,1,3,167,0,0,0,1,2,108,0,0,0,1,2,128,0,0,0,1,3,69,0,0,0,4,0,0,0,1,0,
+8,0,1,0,12,0,20,0,1,0,54,0,76,0,1,0,2,4,255,5,0,0,2,0,5,0,69,0,71,0,0,0,73,
+0,75,0,3,0,77,0,81,0,6,0,83,0,90,0,11,0,93,0,93,0,19,0,2,0,0,0,10,0,0,0,16,
+0,1,0,1,0,86,0,1,0,115,0,86,0,20,0,102,0,42,0,48,0,54,0,60,0,66,0,72,0,78,
+0,84,0,90,0,96,0,102,0,108,0,114,0,120,0,126,0,132,0,138,0,144,0,150,0,1,
+3,32,0,86,0,1,4,197,0,86,0,1,2,176,0,86,0,1,3,22,254,112,0,1,4,219,0,86,0,
+1,1,44,254,132,0,1,4,176,0,86,0,1,2,96,0,86,0,1,7,86,0,86,0,1,4,240,0,86,
+0,1,3,212,0,86,0,1,4,197,254,106,0,1,2,147,0,86,0,1,2,231,0,86,0,1,2,162,
+0,86,0,1,4,229,0,86,0,1,2,164,0,86,0,1,5,39,0,86,0,1,3,154,0,86,0,6,2,0,0,
+1,0,8,0,1,0,12,0,12,0,1,0,100,1,198,0,2,0,14,2,98,2,98,0,0,4,244,4,247,0,
+1,4,250,4,254,0,5,5,1,5,3,0,10,5,6,5,16,0,13,5,22,5,25,0,24,5,34,5,34,0,28,
+5,36,5,38,0,29,5,42,5,43,0,32,5,48,5,51,0,34,5,54,5,55,0,38,6,72,6,72,0,40,
+6,80,6,80,0,41,6,82,6,82,0,42,0,43,0,0,0,174,0,0,0,180,0,0,0,180,0,0,0,186,
+0,0,0,186,0,0,0,192,0,0,0,198,0,0,0,198,0,0,0,204,0,0,0,210,0,0,0,216,0,0,
+1,74,0,0,0,222,0,0,1,62,0,0,1,14,0,0,1,26,0,0,0,228,0,0,0,228,0,0,0,234,0,
+0,0,234,0,0,0,240,0,0,0,246,0,0,0,252,0,0,1,2,0,0,1,8,0,0,1,14,0,0,1,20,0,
+0,1,26,0,0,1,32,0,0,1,38,0,0,1,44,0,0,1,50,0,0,1,62,0,0,1,56,0,0,1,92,0,0,
+1,62,0,0,1,62,0,0,1,62,0,0,1,68,0,0,1,74,0,0,1,80,0,0,1,86,0,0,1,92,0,1,253,
+156,255,135,0,1,0,0,255,114,0,1,0,0,255,178,0,1,0,20,255,212,0,1,0,0,255,
+150,0,1,0,0,255,180,0,1,0,0,255,76,0,1,0,0,255,126,0,1,0,0,255,131,0,1,0,
+0,255,133,0,1,0,0,255,117,0,1,0,0,255,136,0,1,0,0,255,104,0,1,1,154,255,104,
+0,1,1,154,255,182,0,1,255,236,255,211,0,1,0,0,255,109,0,1,0,0,255,162,0,1,
+0,0,255,123,0,1,0,0,255,113,0,1,0,0,255,182,0,1,0,0,255,186,0,1,0,0,255,98,
+0,1,0,0,255,196,0,1,0,0,255,176,0,1,0,0,255,195,0,1,0,0,255,174,0,1,0,0,255,
+170,0,1,0,0,255,203,0,1,0,0,255,158,0,43,0,88,0,166,0,166,0,154,0,154,0,94,
+0,172,0,172,0,100,0,106,0,112,0,166,0,166,0,172,0,172,0,112,0,166,0,118,0,
+118,0,148,0,148,0,124,0,130,0,136,0,142,0,160,0,178,0,148,0,166,0,154,0,172,
+0,166,0,172,0,160,0,166,0,166,0,166,0,178,0,178,0,166,0,172,0,178,0,178,0,
+1,253,156,253,248,0,1,0,20,253,128,0,1,0,0,253,198,0,1,0,0,254,72,0,1,0,0,
+254,32,0,1,0,0,253,248,0,1,0,0,254,92,0,1,1,154,254,72,0,1,1,154,253,188,
+0,1,255,236,253,128,0,1,0,0,254,12,0,1,0,0,253,208,0,1,0,0,253,148,0,1,0,
+0,253,188,0,1,0,0,253,228,0,1,0,0,253,168,0,6,3,0,0,1,0,8,0,1,0,12,0,12,0,
+1,0,112,1,252,0,2,0,16,2,94,2,96,0,0,2,138,2,141,0,3,3,113,3,113,0,7,4,226,
+4,242,0,8,4,248,4,248,0,25,5,26,5,28,0,26,5,31,5,33,0,29,5,35,5,35,0,32,5,
+39,5,41,0,33,5,45,5,47,0,36,5,52,5,52,0,39,5,56,5,56,0,40,5,64,5,76,0,41,
+6,70,6,71,0,54,6,73,6,79,0,56,6,81,6,81,0,63,0,64,0,0,1,2,0,0,1,2,0,0,1,2,
+0,0,1,8,0,0,1,14,0,0,1,14,0,0,1,14,0,0,1,20,0,0,1,26,0,0,1,116,0,0,2,74,0,
+0,1,116,0,0,1,116,0,0,1,116,0,0,1,32,0,0,1,116,0,0,1,116,0,0,1,38,0,0,1,44,
+0,0,1,44,0,0,1,116,0,0,1,116,0,0,1,50,0,0,1,50,0,0,1,50,0,0,1,98,0,0,1,56,
+0,0,1,74,0,0,1,62,0,0,1,116,0,0,1,68,0,0,1,122,0,0,1,116,0,0,1,74,0,0,1,74,
+0,0,1,116,0,0,1,134,0,0,1,80,0,0,1,86,0,0,1,92,0,0,1,98,0,0,1,104,0,0,1,104,
+0,0,1,104,0,0,1,104,0,0,1,104,0,0,1,104,0,0,1,104,0,0,1,104,0,0,1,104,0,0,
+1,104,0,0,1,104,0,0,1,104,0,0,1,104,0,0,1,110,0,0,1,110,0,0,1,116,0,0,1,122,
+0,0,1,122,0,0,1,122,0,0,1,122,0,0,1,128,0,0,1,128,0,0,1,134,0,1,253,120,4,
+184,0,1,2,58,4,156,0,1,2,79,4,184,0,1,253,162,4,184,0,1,253,175,4,184,0,1,
+253,142,4,184,0,1,253,171,4,184,0,1,0,0,4,144,0,1,0,0,3,82,0,1,0,0,4,116,
+0,1,0,0,5,240,0,1,0,0,4,84,0,1,0,0,4,96,0,1,255,144,4,154,0,1,0,0,4,196,0,
+1,0,112,4,154,0,1,0,0,4,164,0,1,0,0,1,254,0,1,0,0,4,216,0,1,0,0,4,184,0,1,
+0,0,4,176,0,1,0,0,4,156,0,1,0,0,4,154,0,64,0,130,0,130,0,136,0,142,0,148,
+0,154,0,154,0,160,0,166,0,190,0,172,1,30,1,30,1,30,0,178,1,18,0,250,0,184,
+0,250,0,250,0,220,1,0,0,190,0,190,0,190,0,196,1,30,0,202,0,208,0,214,0,214,
+0,220,0,250,0,250,0,226,0,238,1,30,0,232,0,238,0,244,0,250,1,12,1,12,1,0,
+1,12,1,12,1,12,1,0,1,0,1,12,1,12,1,6,1,12,1,12,1,18,1,18,1,24,1,24,1,24,1,
+24,1,24,1,24,1,24,1,30,0,1,253,120,6,144,0,1,253,120,6,64,0,1,2,58,5,220,
+0,1,2,79,6,64,0,1,2,79,6,144,0,1,253,162,6,144,0,1,253,175,6,144,0,1,0,0,
+7,8,0,1,253,142,6,224,0,1,253,171,6,104,0,1,0,0,6,4,0,1,0,0,6,124,0,1,0,0,
+7,88,0,1,0,0,7,248,0,1,0,0,6,64,0,1,0,0,6,244,0,1,0,0,7,168,0,1,255,144,6,
+244,0,1,0,0,7,48,0,1,0,112,6,244,0,1,0,0,6,144,0,1,0,0,6,84,0,1,0,0,5,200,
+0,1,0,0,5,100,0,1,0,0,6,204,0,1,0,0,6,44,0,1,0,0,6,104,0,2,0,8,0,1,0,8,0,
+1,3,72,0,4,0,0,1,159,6,138,6,138,7,20,7,250,10,176,50,100,50,42,11,198,17,
+184,18,18,20,254,50,100,13,132,50,100,21,134,26,36,60,162,54,108,14,6,32,
+50,16,132,57,246,50,0,51,38,17,98,17,136,20,16,50,0,51,38,51,38,22,248,17,
+174,34,152,60,140,47,74,47,74,47,74,47,74,47,74,47,74,50,42,50,42,50,42,50,
+42,50,42,50,100,50,100,50,100,50,100,50,100,50,100,50,100,54,108,54,108,54,
+108,54,108,57,246,50,100,51,38,50,0,50,0,50,0,50,0,50,0,50,0,51,38,50,0,51,
+38,51,38,51,38,51,38,51,38,51,38,60,140,51,38,60,140,23,114,47,74,47,74,50,
+100,21,104,50,100,50,42,50,42,50,42,50,42,50,42,17,184,17,184,17,184,17,184,
+50,0,50,0,18,18,20,16,20,16,20,254,20,254,21,104,50,0,50,0,50,0,50,0,50,0,
+50,100,51,38,50,100,51,38,50,100,51,38,50,42,21,134,22,248,21,134,22,248,
+21,134,22,248,26,36,26,36,26,36,26,36,60,162,60,162,60,162,54,108,54,108,
+54,108,54,108,54,108,32,50,34,152,57,246,60,140,57,246,23,114,50,100,51,38,
+26,36,27,204,35,248,27,204,27,26,28,126,27,96,28,74,35,248,27,122,27,204,
+28,74,35,248,28,88,28,126,29,122,28,216,29,2,29,32,29,122,29,252,30,18,29,
+212,30,18,29,242,29,252,30,18,30,24,30,62,30,76,30,124,30,124,30,124,30,102,
+30,124,30,124,30,124,40,138,43,94,30,138,47,56,47,56,38,0,44,210,42,36,38,
+154,40,204,43,94,40,138,44,210,40,204,44,210,46,118,36,80,43,94,42,36,46,
+118,31,124,47,56,47,56,46,118,46,118,40,92,41,254,44,148,46,16,41,254,46,
+16,41,254,41,254,44,148,60,140,41,254,46,16,41,254,41,254,40,92,44,148,40,
+92,46,16,60,140,43,94,44,148,32,50,34,152,32,50,34,152,32,50,34,152,57,246,
+60,140,34,180,34,174,34,180,35,86,47,74,50,0,35,248,51,72,53,158,54,206,57,
+228,40,138,46,118,36,34,47,56,38,154,38,154,44,210,46,16,44,210,46,16,40,
+204,41,254,36,194,46,118,41,254,42,36,60,140,42,36,60,140,60,140,60,140,46,
+118,41,254,46,118,41,254,46,118,36,34,47,56,41,254,36,80,41,254,43,94,44,
+148,38,0,44,210,46,16,40,204,41,254,44,210,46,16,44,210,46,16,44,210,46,16,
+44,210,46,16,43,94,38,0,43,94,44,148,36,194,60,140,36,194,60,140,46,16,38,
+0,46,118,46,118,44,210,46,16,38,0,38,154,40,92,38,154,40,92,40,138,40,138,
+46,118,41,254,46,118,41,254,44,210,46,16,40,204,40,204,46,118,41,254,46,118,
+41,254,46,118,41,254,46,118,42,36,60,140,42,36,60,140,42,36,60,140,43,94,
+44,148,43,94,44,148,44,210,44,210,46,16,47,56,47,56,47,56,47,56,46,118,47,
+56,47,74,50,0,47,74,50,0,47,74,50,0,47,74,50,0,47,74,50,0,47,74,50,0,47,74,
+50,0,47,74,50,0,47,74,50,0,47,74,50,0,47,74,50,0,47,74,50,0,50,42,50,42,50,
+42,50,42,50,42,50,42,50,42,50,42,50,100,51,38,50,100,51,38,50,100,51,38,50,
+100,51,38,50,100,51,38,50,100,51,38,50,100,51,38,51,72,53,158,51,72,53,158,
+51,72,53,158,51,72,53,158,51,72,53,158,54,108,54,108,54,206,57,228,54,206,
+57,228,54,206,57,228,54,206,57,228,54,206,57,228,57,246,60,140,57,246,60,
+140,57,246,60,140,60,162,0,1,1,159,0,5,0,10,0,13,0,36,0,37,0,39,0,40,0,41,
+0,42,0,46,0,47,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,68,
+0,69,0,73,0,75,0,78,0,81,0,82,0,83,0,85,0,89,0,90,0,92,0,130,0,131,0,132,
+0,133,0,134,0,135,0,136,0,138,0,139,0,140,0,141,0,146,0,148,0,149,0,150,0,
+151,0,152,0,154,0,155,0,156,0,157,0,158,0,159,0,160,0,161,0,162,0,163,0,164,
+0,165,0,166,0,167,0,178,0,179,0,180,0,181,0,182,0,183,0,184,0,186,0,191,0,
+192,0,193,0,194,0,196,0,198,0,208,0,209,0,210,0,212,0,214,0,216,0,218,0,220,
+0,222,0,224,0,226,0,228,0,231,0,233,0,248,0,249,0,250,0,251,0,253,1,0,1,6,
+1,8,1,10,1,11,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,22,1,23,1,24,1,25,
+1,26,1,27,1,28,1,30,1,32,1,34,1,36,1,38,1,40,1,42,1,44,1,46,1,48,1,52,1,54,
+1,55,1,56,1,57,1,58,1,67,1,71,1,72,1,73,1,86,1,91,1,95,1,96,1,97,1,98,1,99,
+1,102,1,104,1,105,1,108,1,109,1,111,1,113,1,114,1,115,1,116,1,117,1,120,1,
+123,1,127,1,128,1,129,1,131,1,132,1,134,1,135,1,136,1,138,1,140,1,142,1,147,
+1,148,1,150,1,153,1,155,1,156,1,158,1,160,1,164,1,165,1,166,1,167,1,168,1,
+170,1,172,1,173,1,175,1,176,1,177,1,180,1,184,1,186,1,188,1,189,1,190,1,191,
+1,196,1,198,1,199,1,200,1,202,1,204,1,205,1,208,1,209,1,212,1,216,1,218,1,
+220,1,221,1,222,1,223,1,231,1,232,1,235,1,236,1,244,1,245,1,246,1,248,1,249,
+1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,6,2,7,2,10,2,38,2,83,2,84,2,
+85,2,90,2,91,2,92,2,93,2,99,2,103,2,104,2,105,2,109,2,111,2,113,2,114,2,115,
+2,116,2,117,2,118,2,119,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,
+129,2,130,2,131,2,132,2,133,2,134,2,146,2,147,2,148,2,149,2,150,2,151,2,152,
+2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,
+168,2,170,2,176,2,177,2,178,2,179,2,180,2,181,2,183,2,190,2,192,2,194,2,197,
+2,198,2,199,2,212,2,213,2,214,2,215,2,216,2,218,2,220,2,221,2,222,2,223,2,
+224,2,225,2,226,2,228,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,242,2,243,
+2,244,2,245,2,246,2,247,2,250,2,251,2,254,2,255,3,0,3,2,3,3,3,6,3,8,3,12,
+3,14,3,16,3,18,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,
+3,36,3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,50,3,52,
+3,54,3,56,3,58,3,60,3,62,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,
+3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,
+3,94,3,96,3,97,3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,3,106,3,107,
+3,108,3,109,3,110,3,111,3,124,0,34,0,36,255,92,0,74,255,174,0,130,255,92,
+0,131,255,92,0,132,255,92,0,133,255,92,0,134,255,92,0,135,255,92,0,136,255,
+10,0,194,255,92,0,196,255,92,0,198,255,92,1,67,255,92,1,69,255,10,1,95,255,
+92,1,105,255,92,1,170,255,92,2,83,255,92,2,109,255,92,2,212,255,92,2,214,
+255,92,2,216,255,10,3,24,255,92,3,26,255,92,3,28,255,92,3,30,255,92,3,32,
+255,92,3,34,255,92,3,36,255,92,3,38,255,92,3,40,255,92,3,42,255,92,3,44,255,
+92,3,46,255,92,0,57,0,15,255,10,0,17,255,10,0,36,255,154,0,130,255,154,0,
+131,255,154,0,132,255,154,0,133,255,154,0,134,255,154,0,135,255,154,0,136,
+255,92,0,194,255,154,0,196,255,154,0,198,255,154,1,67,255,154,1,69,255,92,
+1,95,255,154,1,98,255,195,1,105,255,154,1,164,255,113,1,168,255,215,1,170,
+255,154,1,174,255,113,1,181,255,113,1,189,255,215,1,206,255,154,1,213,255,
+154,1,242,255,154,2,8,255,10,2,12,255,10,2,16,255,10,2,38,255,195,2,83,255,
+154,2,109,255,154,2,201,255,113,2,202,255,154,2,212,255,154,2,214,255,154,
+2,216,255,92,2,242,255,215,2,244,255,215,2,246,255,215,3,12,255,113,3,13,
+255,154,3,22,255,113,3,23,255,154,3,24,255,154,3,26,255,154,3,28,255,154,
+3,30,255,154,3,32,255,154,3,34,255,154,3,36,255,154,3,38,255,154,3,40,255,
+154,3,42,255,154,3,44,255,154,3,46,255,154,0,173,0,5,255,92,0,10,255,92,0,
+13,255,113,0,34,255,133,0,38,255,215,0,42,255,215,0,50,255,215,0,52,255,215,
+0,55,255,133,0,56,255,215,0,57,255,92,0,58,255,113,0,60,255,113,0,70,255,
+215,0,71,255,215,0,72,255,215,0,74,255,215,0,82,255,215,0,84,255,215,0,88,
+255,215,0,89,255,133,0,90,255,195,0,92,255,154,0,148,255,215,0,149,255,215,
+0,150,255,215,0,151,255,215,0,152,255,215,0,154,255,215,0,155,255,215,0,156,
+255,215,0,157,255,215,0,158,255,215,0,159,255,113,0,169,255,215,0,170,255,
+215,0,171,255,215,0,172,255,215,0,173,255,215,0,178,255,215,0,180,255,215,
+0,181,255,215,0,182,255,215,0,183,255,215,0,184,255,215,0,186,255,215,0,187,
+255,215,0,188,255,215,0,189,255,215,0,190,255,215,0,191,255,154,0,193,255,
+154,0,200,255,215,0,201,255,215,0,202,255,215,0,203,255,215,0,204,255,215,
+0,205,255,215,0,206,255,215,0,207,255,215,0,209,255,215,0,211,255,215,0,213,
+255,215,0,215,255,215,0,217,255,215,0,219,255,215,0,221,255,215,0,222,255,
+215,0,223,255,215,0,224,255,215,0,225,255,215,0,226,255,215,0,227,255,215,
+0,228,255,215,0,229,255,215,1,14,255,215,1,15,255,215,1,16,255,215,1,17,255,
+215,1,18,255,215,1,19,255,215,1,20,255,215,1,21,255,215,1,36,255,133,1,38,
+255,133,1,40,255,133,1,42,255,215,1,43,255,215,1,44,255,215,1,45,255,215,
+1,46,255,215,1,47,255,215,1,48,255,215,1,49,255,215,1,50,255,215,1,51,255,
+215,1,52,255,215,1,53,255,215,1,54,255,113,1,55,255,195,1,56,255,113,1,57,
+255,154,1,58,255,113,1,71,255,215,1,72,255,215,1,250,255,113,1,251,255,195,
+1,252,255,113,1,253,255,195,1,254,255,113,1,255,255,195,2,0,255,113,2,1,255,
+154,2,7,255,113,2,11,255,113,2,30,255,113,2,90,255,215,2,91,255,215,2,92,
+255,215,2,93,255,215,3,49,255,215,3,51,255,215,3,53,255,215,3,55,255,215,
+3,57,255,215,3,59,255,215,3,61,255,215,3,63,255,215,3,68,255,215,3,69,255,
+215,3,70,255,215,3,71,255,215,3,72,255,215,3,73,255,215,3,74,255,215,3,75,
+255,215,3,76,255,215,3,77,255,215,3,78,255,215,3,79,255,215,3,80,255,215,
+3,81,255,215,3,82,255,215,3,83,255,215,3,84,255,215,3,85,255,215,3,86,255,
+215,3,87,255,215,3,88,255,215,3,89,255,215,3,90,255,215,3,91,255,215,3,92,
+255,215,3,93,255,215,3,94,255,215,3,95,255,215,3,96,255,215,3,97,255,215,
+3,98,255,215,3,99,255,215,3,100,255,215,3,101,255,215,3,102,255,215,3,103,
+255,215,3,104,255,215,3,105,255,215,3,106,255,113,3,107,255,154,3,108,255,
+113,3,109,255,154,3,110,255,113,3,111,255,154,3,124,255,133,0,69,0,13,255,
+215,0,34,255,215,0,36,255,215,0,55,255,215,0,57,255,174,0,58,255,195,0,59,
+255,215,0,60,255,174,0,61,255,215,0,90,255,236,0,92,255,215,0,130,255,215,
+0,131,255,215,0,132,255,215,0,133,255,215,0,134,255,215,0,135,255,215,0,136,
+255,195,0,159,255,174,0,191,255,215,0,193,255,215,0,194,255,215,0,196,255,
+215,0,198,255,215,1,36,255,215,1,38,255,215,1,40,255,215,1,54,255,195,1,55,
+255,236,1,56,255,174,1,57,255,215,1,58,255,174,1,59,255,215,1,61,255,215,
+1,63,255,215,1,67,255,215,1,69,255,195,1,250,255,195,1,251,255,236,1,252,
+255,195,1,253,255,236,1,254,255,195,1,255,255,236,2,0,255,174,2,1,255,215,
+2,7,255,215,2,11,255,215,2,30,255,215,2,38,255,215,2,83,255,215,3,24,255,
+215,3,26,255,215,3,28,255,215,3,30,255,215,3,32,255,215,3,34,255,215,3,36,
+255,215,3,38,255,215,3,40,255,215,3,42,255,215,3,44,255,215,3,46,255,215,
+3,106,255,174,3,107,255,215,3,108,255,174,3,109,255,215,3,110,255,174,3,111,
+255,215,3,124,255,215,0,111,0,36,255,113,0,68,255,174,0,70,255,174,0,71,255,
+174,0,72,255,174,0,74,255,174,0,82,255,174,0,84,255,174,0,130,255,113,0,131,
+255,113,0,132,255,113,0,133,255,113,0,134,255,113,0,135,255,113,0,136,255,
+31,0,162,255,174,0,163,255,174,0,164,255,174,0,165,255,174,0,166,255,174,
+0,167,255,174,0,168,255,174,0,169,255,174,0,170,255,174,0,171,255,174,0,172,
+255,174,0,173,255,174,0,178,255,174,0,180,255,174,0,181,255,174,0,182,255,
+174,0,183,255,174,0,184,255,174,0,186,255,174,0,194,255,113,0,195,255,174,
+0,196,255,113,0,197,255,174,0,198,255,113,0,199,255,174,0,201,255,174,0,203,
+255,174,0,205,255,174,0,207,255,174,0,209,255,174,0,211,255,174,0,213,255,
+174,0,215,255,174,0,217,255,174,0,219,255,174,0,221,255,174,0,223,255,174,
+0,225,255,174,0,227,255,174,0,229,255,174,1,15,255,174,1,17,255,174,1,19,
+255,174,1,21,255,174,1,67,255,113,1,68,255,174,1,69,255,31,1,70,255,174,1,
+72,255,174,2,83,255,113,2,84,255,174,2,91,255,174,3,24,255,113,3,25,255,174,
+3,26,255,113,3,27,255,174,3,28,255,113,3,29,255,174,3,30,255,113,3,31,255,
+174,3,32,255,113,3,33,255,174,3,34,255,113,3,35,255,174,3,36,255,113,3,37,
+255,174,3,38,255,113,3,39,255,174,3,40,255,113,3,41,255,174,3,42,255,113,
+3,43,255,174,3,44,255,113,3,45,255,174,3,46,255,113,3,47,255,174,3,49,255,
+174,3,51,255,174,3,53,255,174,3,55,255,174,3,57,255,174,3,59,255,174,3,61,
+255,174,3,63,255,174,3,69,255,174,3,71,255,174,3,73,255,174,3,75,255,174,
+3,77,255,174,3,79,255,174,3,81,255,174,3,83,255,174,3,85,255,174,3,87,255,
+174,3,89,255,174,3,91,255,174,0,32,0,15,255,10,0,17,255,10,0,36,255,154,0,
+130,255,154,0,131,255,154,0,132,255,154,0,133,255,154,0,134,255,154,0,135,
+255,154,0,136,255,92,0,194,255,154,0,196,255,154,0,198,255,154,1,67,255,154,
+1,69,255,92,2,8,255,10,2,12,255,10,2,16,255,10,2,38,255,195,2,83,255,154,
+3,24,255,154,3,26,255,154,3,28,255,154,3,30,255,154,3,32,255,154,3,34,255,
+154,3,36,255,154,3,38,255,154,3,40,255,154,3,42,255,154,3,44,255,154,3,46,
+255,154,0,159,0,15,255,31,0,17,255,31,0,36,255,92,0,38,255,215,0,42,255,215,
+0,50,255,215,0,52,255,215,0,68,255,133,0,70,255,133,0,71,255,133,0,72,255,
+133,0,74,255,133,0,82,255,133,0,84,255,133,0,86,255,174,0,130,255,92,0,131,
+255,92,0,132,255,92,0,133,255,92,0,134,255,92,0,135,255,92,0,136,254,246,
+0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,255,215,0,154,
+255,215,0,162,255,133,0,163,255,133,0,164,255,133,0,165,255,133,0,166,255,
+133,0,167,255,133,0,168,255,133,0,169,255,133,0,170,255,133,0,171,255,133,
+0,172,255,133,0,173,255,133,0,178,255,133,0,180,255,133,0,181,255,133,0,182,
+255,133,0,183,255,133,0,184,255,133,0,186,255,133,0,194,255,92,0,195,255,
+133,0,196,255,92,0,197,255,133,0,198,255,92,0,199,255,133,0,200,255,215,0,
+201,255,133,0,202,255,215,0,203,255,133,0,204,255,215,0,205,255,133,0,206,
+255,215,0,207,255,133,0,209,255,133,0,211,255,133,0,213,255,133,0,215,255,
+133,0,217,255,133,0,219,255,133,0,221,255,133,0,222,255,215,0,223,255,133,
+0,224,255,215,0,225,255,133,0,226,255,215,0,227,255,133,0,228,255,215,0,229,
+255,133,1,14,255,215,1,15,255,133,1,16,255,215,1,17,255,133,1,18,255,215,
+1,19,255,133,1,20,255,215,1,21,255,133,1,29,255,174,1,31,255,174,1,33,255,
+174,1,35,255,174,1,67,255,92,1,68,255,133,1,69,254,246,1,70,255,133,1,71,
+255,215,1,72,255,133,1,74,255,174,2,8,255,31,2,12,255,31,2,16,255,31,2,38,
+255,133,2,83,255,92,2,84,255,133,2,90,255,215,2,91,255,133,3,24,255,92,3,
+25,255,133,3,26,255,92,3,27,255,133,3,28,255,92,3,29,255,133,3,30,255,92,
+3,31,255,133,3,32,255,92,3,33,255,133,3,34,255,92,3,35,255,133,3,36,255,92,
+3,37,255,133,3,38,255,92,3,39,255,133,3,40,255,92,3,41,255,133,3,42,255,92,
+3,43,255,133,3,44,255,92,3,45,255,133,3,46,255,92,3,47,255,133,3,49,255,133,
+3,51,255,133,3,53,255,133,3,55,255,133,3,57,255,133,3,59,255,133,3,61,255,
+133,3,63,255,133,3,68,255,215,3,69,255,133,3,70,255,215,3,71,255,133,3,72,
+255,215,3,73,255,133,3,74,255,215,3,75,255,133,3,76,255,215,3,77,255,133,
+3,78,255,215,3,79,255,133,3,80,255,215,3,81,255,133,3,82,255,215,3,83,255,
+133,3,84,255,215,3,85,255,133,3,86,255,215,3,87,255,133,3,88,255,215,3,89,
+255,133,3,90,255,215,3,91,255,133,0,55,0,38,255,215,0,42,255,215,0,50,255,
+215,0,52,255,215,0,54,255,236,0,90,255,195,0,92,255,154,0,148,255,215,0,149,
+255,215,0,150,255,215,0,151,255,215,0,152,255,215,0,154,255,215,0,191,255,
+154,0,193,255,154,0,200,255,215,0,202,255,215,0,204,255,215,0,206,255,215,
+0,222,255,215,0,224,255,215,0,226,255,215,0,228,255,215,1,14,255,215,1,16,
+255,215,1,18,255,215,1,20,255,215,1,28,255,236,1,30,255,236,1,32,255,236,
+1,34,255,236,1,55,255,195,1,57,255,154,1,71,255,215,1,73,255,236,1,251,255,
+195,1,253,255,195,1,255,255,195,2,1,255,154,2,90,255,215,3,68,255,215,3,70,
+255,215,3,72,255,215,3,74,255,215,3,76,255,215,3,78,255,215,3,80,255,215,
+3,82,255,215,3,84,255,215,3,86,255,215,3,88,255,215,3,90,255,215,3,107,255,
+154,3,109,255,154,3,111,255,154,0,9,0,5,0,164,0,10,0,164,0,12,0,184,0,13,
+0,164,0,64,0,184,0,96,0,184,2,7,0,164,2,11,0,164,2,30,0,164,0,9,0,5,255,174,
+0,92,255,215,0,191,255,215,0,193,255,215,1,57,255,215,2,1,255,215,3,107,255,
+215,3,109,255,215,3,111,255,215,0,2,0,15,255,154,0,17,255,113,0,22,0,34,255,
+215,0,55,255,215,0,57,255,215,0,58,255,215,0,60,255,215,0,136,255,215,0,159,
+255,215,1,36,255,215,1,38,255,215,1,40,255,215,1,54,255,215,1,56,255,215,
+1,58,255,215,1,69,255,215,1,250,255,215,1,252,255,215,1,254,255,215,2,0,255,
+215,3,106,255,215,3,108,255,215,3,110,255,215,3,124,255,215,0,127,0,38,255,
+215,0,42,255,215,0,50,255,215,0,52,255,215,0,70,255,215,0,71,255,215,0,72,
+255,215,0,74,255,215,0,82,255,215,0,84,255,215,0,88,255,215,0,90,255,195,
+0,92,255,195,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,
+255,215,0,154,255,215,0,169,255,215,0,170,255,215,0,171,255,215,0,172,255,
+215,0,173,255,215,0,178,255,215,0,180,255,215,0,181,255,215,0,182,255,215,
+0,183,255,215,0,184,255,215,0,186,255,215,0,187,255,215,0,188,255,215,0,189,
+255,215,0,190,255,215,0,191,255,195,0,193,255,195,0,200,255,215,0,201,255,
+215,0,202,255,215,0,203,255,215,0,204,255,215,0,205,255,215,0,206,255,215,
+0,207,255,215,0,209,255,215,0,211,255,215,0,213,255,215,0,215,255,215,0,217,
+255,215,0,219,255,215,0,221,255,215,0,222,255,215,0,223,255,215,0,224,255,
+215,0,225,255,215,0,226,255,215,0,227,255,215,0,228,255,215,0,229,255,215,
+1,14,255,215,1,15,255,215,1,16,255,215,1,17,255,215,1,18,255,215,1,19,255,
+215,1,20,255,215,1,21,255,215,1,43,255,215,1,45,255,215,1,47,255,215,1,49,
+255,215,1,51,255,215,1,53,255,215,1,55,255,195,1,57,255,195,1,71,255,215,
+1,72,255,215,1,251,255,195,1,253,255,195,1,255,255,195,2,1,255,195,2,90,255,
+215,2,91,255,215,2,93,255,215,3,49,255,215,3,51,255,215,3,53,255,215,3,55,
+255,215,3,57,255,215,3,59,255,215,3,61,255,215,3,63,255,215,3,68,255,215,
+3,69,255,215,3,70,255,215,3,71,255,215,3,72,255,215,3,73,255,215,3,74,255,
+215,3,75,255,215,3,76,255,215,3,77,255,215,3,78,255,215,3,79,255,215,3,80,
+255,215,3,81,255,215,3,82,255,215,3,83,255,215,3,84,255,215,3,85,255,215,
+3,86,255,215,3,87,255,215,3,88,255,215,3,89,255,215,3,90,255,215,3,91,255,
+215,3,93,255,215,3,95,255,215,3,97,255,215,3,99,255,215,3,101,255,215,3,103,
+255,215,3,105,255,215,3,107,255,195,3,109,255,195,3,111,255,195,0,59,0,70,
+255,215,0,71,255,215,0,72,255,215,0,74,255,215,0,82,255,215,0,84,255,215,
+0,169,255,215,0,170,255,215,0,171,255,215,0,172,255,215,0,173,255,215,0,178,
+255,215,0,180,255,215,0,181,255,215,0,182,255,215,0,183,255,215,0,184,255,
+215,0,186,255,215,0,201,255,215,0,203,255,215,0,205,255,215,0,207,255,215,
+0,209,255,215,0,211,255,215,0,213,255,215,0,215,255,215,0,217,255,215,0,219,
+255,215,0,221,255,215,0,223,255,215,0,225,255,215,0,227,255,215,0,229,255,
+215,1,15,255,215,1,17,255,215,1,19,255,215,1,21,255,215,1,72,255,215,2,91,
+255,215,3,49,255,215,3,51,255,215,3,53,255,215,3,55,255,215,3,57,255,215,
+3,59,255,215,3,61,255,215,3,63,255,215,3,69,255,215,3,71,255,215,3,73,255,
+215,3,75,255,215,3,77,255,215,3,79,255,215,3,81,255,215,3,83,255,215,3,85,
+255,215,3,87,255,215,3,89,255,215,3,91,255,215,0,26,0,5,255,133,0,10,255,
+133,0,13,255,92,0,34,255,113,0,55,255,113,0,57,255,154,0,58,255,154,0,60,
+255,133,0,159,255,133,1,36,255,113,1,38,255,113,1,40,255,113,1,54,255,154,
+1,56,255,133,1,58,255,133,1,250,255,154,1,252,255,154,1,254,255,154,2,0,255,
+133,2,7,255,92,2,11,255,92,2,30,255,92,3,106,255,133,3,108,255,133,3,110,
+255,133,3,124,255,113,0,7,0,13,0,82,0,34,0,61,0,69,0,184,0,79,0,184,2,7,0,
+82,2,11,0,82,2,30,0,82,0,92,0,13,255,215,0,34,255,215,0,38,255,215,0,42,255,
+215,0,50,255,215,0,52,255,215,0,55,255,215,0,56,255,236,0,57,255,195,0,58,
+255,195,0,60,255,195,0,90,255,215,0,92,255,215,0,148,255,215,0,149,255,215,
+0,150,255,215,0,151,255,215,0,152,255,215,0,154,255,215,0,155,255,236,0,156,
+255,236,0,157,255,236,0,158,255,236,0,159,255,195,0,191,255,215,0,193,255,
+215,0,200,255,215,0,202,255,215,0,204,255,215,0,206,255,215,0,222,255,215,
+0,224,255,215,0,226,255,215,0,228,255,215,1,14,255,215,1,16,255,215,1,18,
+255,215,1,20,255,215,1,36,255,215,1,38,255,215,1,40,255,215,1,42,255,236,
+1,44,255,236,1,46,255,236,1,48,255,236,1,50,255,236,1,52,255,236,1,54,255,
+195,1,55,255,215,1,56,255,195,1,57,255,215,1,58,255,195,1,71,255,215,1,250,
+255,195,1,251,255,215,1,252,255,195,1,253,255,215,1,254,255,195,1,255,255,
+215,2,0,255,195,2,1,255,215,2,7,255,215,2,11,255,215,2,30,255,215,2,90,255,
+215,2,92,255,236,3,68,255,215,3,70,255,215,3,72,255,215,3,74,255,215,3,76,
+255,215,3,78,255,215,3,80,255,215,3,82,255,215,3,84,255,215,3,86,255,215,
+3,88,255,215,3,90,255,215,3,92,255,236,3,94,255,236,3,96,255,236,3,98,255,
+236,3,100,255,236,3,102,255,236,3,104,255,236,3,106,255,195,3,107,255,215,
+3,108,255,195,3,109,255,215,3,110,255,195,3,111,255,215,3,124,255,215,0,30,
+0,13,0,61,0,68,255,215,0,162,255,215,0,163,255,215,0,164,255,215,0,165,255,
+215,0,166,255,215,0,167,255,215,0,168,255,215,0,195,255,215,0,197,255,215,
+0,199,255,215,1,68,255,215,1,70,255,215,2,7,0,61,2,11,0,61,2,30,0,61,2,84,
+255,215,3,25,255,215,3,27,255,215,3,29,255,215,3,31,255,215,3,33,255,215,
+3,35,255,215,3,37,255,215,3,39,255,215,3,41,255,215,3,43,255,215,3,45,255,
+215,3,47,255,215,0,172,0,5,255,92,0,10,255,92,0,13,255,113,0,34,255,133,0,
+38,255,215,0,42,255,215,0,50,255,215,0,52,255,215,0,55,255,133,0,56,255,215,
+0,57,255,92,0,58,255,113,0,60,255,113,0,70,255,215,0,71,255,215,0,72,255,
+215,0,74,255,215,0,82,255,215,0,84,255,215,0,88,255,215,0,90,255,195,0,92,
+255,154,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,255,
+215,0,154,255,215,0,155,255,215,0,156,255,215,0,157,255,215,0,158,255,215,
+0,159,255,113,0,169,255,215,0,170,255,215,0,171,255,215,0,172,255,215,0,173,
+255,215,0,178,255,215,0,180,255,215,0,181,255,215,0,182,255,215,0,183,255,
+215,0,184,255,215,0,186,255,215,0,187,255,215,0,188,255,215,0,189,255,215,
+0,190,255,215,0,191,255,154,0,193,255,154,0,200,255,215,0,201,255,215,0,202,
+255,215,0,203,255,215,0,204,255,215,0,205,255,215,0,206,255,215,0,207,255,
+215,0,209,255,215,0,211,255,215,0,213,255,215,0,215,255,215,0,217,255,215,
+0,219,255,215,0,221,255,215,0,222,255,215,0,223,255,215,0,224,255,215,0,225,
+255,215,0,226,255,215,0,227,255,215,0,228,255,215,0,229,255,215,1,14,255,
+215,1,15,255,215,1,16,255,215,1,17,255,215,1,18,255,215,1,19,255,215,1,20,
+255,215,1,21,255,215,1,36,255,133,1,38,255,133,1,40,255,133,1,42,255,215,
+1,43,255,215,1,44,255,215,1,45,255,215,1,46,255,215,1,47,255,215,1,48,255,
+215,1,49,255,215,1,50,255,215,1,51,255,215,1,52,255,215,1,53,255,215,1,54,
+255,113,1,55,255,195,1,56,255,113,1,57,255,154,1,58,255,113,1,71,255,215,
+1,72,255,215,1,250,255,113,1,251,255,195,1,252,255,113,1,253,255,195,1,254,
+255,113,1,255,255,195,2,0,255,113,2,1,255,154,2,7,255,113,2,11,255,113,2,
+30,255,113,2,90,255,215,2,91,255,215,2,92,255,215,2,93,255,215,3,49,255,215,
+3,51,255,215,3,53,255,215,3,55,255,215,3,57,255,215,3,59,255,215,3,61,255,
+215,3,63,255,215,3,68,255,215,3,69,255,215,3,70,255,215,3,71,255,215,3,72,
+255,215,3,73,255,215,3,74,255,215,3,75,255,215,3,76,255,215,3,77,255,215,
+3,78,255,215,3,79,255,215,3,80,255,215,3,81,255,215,3,82,255,215,3,83,255,
+215,3,84,255,215,3,85,255,215,3,86,255,215,3,87,255,215,3,88,255,215,3,89,
+255,215,3,90,255,215,3,91,255,215,3,92,255,215,3,93,255,215,3,94,255,215,
+3,95,255,215,3,96,255,215,3,97,255,215,3,98,255,215,3,99,255,215,3,100,255,
+215,3,101,255,215,3,102,255,215,3,103,255,215,3,104,255,215,3,105,255,215,
+3,106,255,113,3,107,255,154,3,108,255,113,3,109,255,154,3,110,255,113,3,111,
+255,154,3,124,255,133,0,61,0,34,255,215,0,36,255,215,0,55,255,215,0,57,255,
+215,0,58,255,215,0,59,255,215,0,60,255,215,0,90,255,236,0,92,255,215,0,130,
+255,215,0,131,255,215,0,132,255,215,0,133,255,215,0,134,255,215,0,135,255,
+215,0,136,255,215,0,159,255,215,0,191,255,215,0,193,255,215,0,194,255,215,
+0,196,255,215,0,198,255,215,1,36,255,215,1,38,255,215,1,40,255,215,1,54,255,
+215,1,55,255,236,1,56,255,215,1,57,255,215,1,58,255,215,1,67,255,215,1,69,
+255,215,1,250,255,215,1,251,255,236,1,252,255,215,1,253,255,236,1,254,255,
+215,1,255,255,236,2,0,255,215,2,1,255,215,2,38,255,236,2,83,255,215,3,24,
+255,215,3,26,255,215,3,28,255,215,3,30,255,215,3,32,255,215,3,34,255,215,
+3,36,255,215,3,38,255,215,3,40,255,215,3,42,255,215,3,44,255,215,3,46,255,
+215,3,106,255,215,3,107,255,215,3,108,255,215,3,109,255,215,3,110,255,215,
+3,111,255,215,3,124,255,215,0,17,0,13,255,215,0,34,255,215,1,95,255,215,1,
+100,255,215,1,105,255,215,1,113,255,215,1,114,255,174,1,116,255,215,1,117,
+255,174,1,120,255,174,1,128,255,215,1,138,255,215,1,148,255,215,2,7,255,215,
+2,11,255,215,2,30,255,215,2,38,255,215,0,6,0,34,255,174,1,113,255,174,1,114,
+255,174,1,115,255,236,1,117,255,195,1,120,255,174,0,20,1,91,255,215,1,102,
+255,215,1,109,255,215,1,115,255,215,1,121,255,215,1,122,255,215,1,126,255,
+215,1,128,255,195,1,130,255,215,1,138,255,195,1,140,255,215,1,144,255,215,
+1,146,255,215,1,147,255,215,1,148,255,195,1,149,255,215,1,150,255,215,1,152,
+255,215,1,153,255,215,1,154,255,215,0,31,0,5,255,92,0,10,255,92,0,13,255,
+113,0,34,255,133,1,91,255,215,1,102,255,215,1,109,255,215,1,113,255,133,1,
+114,255,113,1,115,255,215,1,117,255,113,1,120,255,113,1,121,255,215,1,122,
+255,215,1,126,255,215,1,128,255,154,1,130,255,215,1,138,255,154,1,140,255,
+215,1,144,255,215,1,146,255,215,1,147,255,215,1,148,255,154,1,149,255,215,
+1,150,255,215,1,152,255,215,1,153,255,215,1,154,255,215,2,7,255,113,2,11,
+255,113,2,30,255,113,0,3,1,114,255,215,1,117,255,215,1,120,255,215,0,9,0,
+15,255,10,0,17,255,10,1,95,255,154,1,98,255,195,1,105,255,154,2,8,255,10,
+2,12,255,10,2,16,255,10,2,38,255,195,0,22,0,15,255,72,0,17,255,72,1,91,255,
+215,1,95,255,133,1,98,255,154,1,102,255,215,1,105,255,133,1,109,255,215,1,
+115,255,215,1,121,255,195,1,122,255,195,1,126,255,195,1,130,255,195,1,140,
+255,195,1,144,255,195,1,147,255,195,1,150,255,195,1,153,255,195,2,8,255,72,
+2,12,255,72,2,16,255,72,2,38,255,154,0,10,0,34,255,215,1,95,255,215,1,98,
+255,215,1,105,255,215,1,113,255,215,1,114,255,195,1,116,255,215,1,117,255,
+195,1,120,255,195,2,38,255,215,0,7,1,91,255,215,1,102,255,215,1,109,255,215,
+1,115,255,215,1,128,255,154,1,138,255,154,1,148,255,154,0,22,0,15,255,92,
+0,17,255,92,1,91,255,195,1,95,255,113,1,98,255,154,1,102,255,195,1,105,255,
+113,1,109,255,195,1,115,255,195,1,121,255,113,1,122,255,113,1,126,255,113,
+1,130,255,113,1,140,255,113,1,144,255,113,1,147,255,113,1,150,255,113,1,153,
+255,113,2,8,255,92,2,12,255,92,2,16,255,92,2,38,255,154,0,22,0,15,255,92,
+0,17,255,92,1,91,255,195,1,95,255,113,1,98,255,133,1,102,255,195,1,105,255,
+113,1,109,255,195,1,115,255,195,1,121,255,113,1,122,255,113,1,126,255,113,
+1,130,255,113,1,140,255,113,1,144,255,113,1,147,255,113,1,150,255,113,1,153,
+255,113,2,8,255,92,2,12,255,92,2,16,255,92,2,38,255,133,0,7,0,15,255,92,0,
+17,255,92,1,129,255,236,1,136,255,195,2,8,255,92,2,12,255,92,2,16,255,92,
+0,2,1,128,255,215,1,129,255,195,0,5,0,5,255,174,0,10,255,174,1,128,255,215,
+1,138,255,215,1,148,255,215,0,1,1,128,255,215,0,9,1,121,255,215,1,122,255,
+215,1,126,255,215,1,130,255,215,1,140,255,215,1,144,255,215,1,147,255,215,
+1,150,255,215,1,153,255,215,0,3,1,128,255,195,1,138,255,154,1,145,255,195,
+0,6,0,15,255,133,0,17,255,133,1,136,255,215,2,8,255,133,2,12,255,133,2,16,
+255,133,0,5,0,15,255,174,0,17,255,174,2,8,255,174,2,12,255,174,2,16,255,174,
+0,3,1,128,255,215,1,138,255,215,1,148,255,215,0,60,0,34,255,215,1,164,255,
+215,1,166,255,215,1,168,255,236,1,170,255,215,1,174,255,215,1,176,255,215,
+1,181,255,215,1,188,255,215,1,189,255,236,1,191,255,215,1,193,255,195,1,196,
+255,215,1,221,255,215,1,246,255,215,2,38,255,236,2,104,255,236,2,105,255,
+215,2,109,255,215,2,113,255,215,2,119,255,215,2,123,255,215,2,124,255,215,
+2,125,255,215,2,126,255,215,2,134,255,236,2,154,255,215,2,164,255,215,2,176,
+255,215,2,178,255,215,2,179,255,215,2,180,255,215,2,181,255,215,2,182,255,
+215,2,184,255,215,2,186,255,195,2,188,255,195,2,197,255,215,2,201,255,215,
+2,207,255,195,2,212,255,215,2,214,255,215,2,216,255,215,2,224,255,215,2,242,
+255,236,2,243,255,215,2,244,255,236,2,245,255,215,2,246,255,236,2,247,255,
+215,2,248,255,195,3,0,255,215,3,2,255,215,3,8,255,215,3,9,255,236,3,10,255,
+215,3,11,255,236,3,12,255,215,3,18,255,215,3,22,255,215,0,45,1,159,255,215,
+1,160,255,236,1,184,255,215,1,187,255,215,1,190,255,215,1,199,255,215,1,200,
+255,215,1,220,255,174,1,221,255,154,1,228,255,174,1,246,255,154,2,103,255,
+215,2,104,255,195,2,121,255,215,2,124,255,154,2,126,255,154,2,127,255,215,
+2,129,255,215,2,131,255,215,2,133,255,215,2,134,255,195,2,135,255,215,2,165,
+255,174,2,172,255,215,2,174,255,215,2,177,255,174,2,179,255,154,2,181,255,
+154,2,185,255,174,2,192,255,215,2,194,255,215,2,220,255,215,2,222,255,215,
+2,234,255,215,2,236,255,215,2,238,255,215,2,240,255,215,2,243,255,154,2,245,
+255,154,2,247,255,154,3,9,255,195,3,11,255,195,3,16,255,215,3,19,255,174,
+3,20,255,215,0,153,0,15,255,72,0,17,255,72,0,36,255,133,0,38,255,215,0,42,
+255,215,0,50,255,215,0,52,255,215,0,68,255,154,0,70,255,133,0,71,255,133,
+0,72,255,133,0,74,255,133,0,82,255,133,0,84,255,133,0,130,255,133,0,131,255,
+133,0,132,255,133,0,133,255,133,0,134,255,133,0,135,255,133,0,136,254,246,
+0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,255,215,0,154,
+255,215,0,162,255,154,0,163,255,154,0,164,255,154,0,165,255,154,0,166,255,
+154,0,167,255,154,0,168,255,154,0,169,255,133,0,170,255,133,0,171,255,133,
+0,172,255,133,0,173,255,133,0,178,255,133,0,180,255,133,0,181,255,133,0,182,
+255,133,0,183,255,133,0,184,255,133,0,186,255,133,0,194,255,133,0,195,255,
+154,0,196,255,133,0,197,255,154,0,198,255,133,0,199,255,154,0,200,255,215,
+0,201,255,133,0,202,255,215,0,203,255,133,0,204,255,215,0,205,255,133,0,206,
+255,215,0,207,255,133,0,209,255,133,0,211,255,133,0,213,255,133,0,215,255,
+133,0,217,255,133,0,219,255,133,0,221,255,133,0,222,255,215,0,223,255,133,
+0,224,255,215,0,225,255,133,0,226,255,215,0,227,255,133,0,228,255,215,0,229,
+255,133,1,14,255,215,1,15,255,133,1,16,255,215,1,17,255,133,1,18,255,215,
+1,19,255,133,1,20,255,215,1,21,255,133,1,67,255,133,1,68,255,154,1,69,254,
+246,1,70,255,154,1,71,255,215,1,72,255,133,2,8,255,72,2,12,255,72,2,16,255,
+72,2,38,255,154,2,83,255,133,2,84,255,154,2,90,255,215,2,91,255,133,3,24,
+255,133,3,25,255,154,3,26,255,133,3,27,255,154,3,28,255,133,3,29,255,154,
+3,30,255,133,3,31,255,154,3,32,255,133,3,33,255,154,3,34,255,133,3,35,255,
+154,3,36,255,133,3,37,255,154,3,38,255,133,3,39,255,154,3,40,255,133,3,41,
+255,154,3,42,255,133,3,43,255,154,3,44,255,133,3,45,255,154,3,46,255,133,
+3,47,255,154,3,49,255,133,3,51,255,133,3,53,255,133,3,55,255,133,3,57,255,
+133,3,59,255,133,3,61,255,133,3,63,255,133,3,68,255,215,3,69,255,133,3,70,
+255,215,3,71,255,133,3,72,255,215,3,73,255,133,3,74,255,215,3,75,255,133,
+3,76,255,215,3,77,255,133,3,78,255,215,3,79,255,133,3,80,255,215,3,81,255,
+133,3,82,255,215,3,83,255,133,3,84,255,215,3,85,255,133,3,86,255,215,3,87,
+255,133,3,88,255,215,3,89,255,133,3,90,255,215,3,91,255,133,0,5,0,15,255,
+113,0,17,255,113,2,8,255,113,2,12,255,113,2,16,255,113,0,1,0,86,255,154,0,
+40,0,36,255,113,0,130,255,113,0,131,255,113,0,132,255,113,0,133,255,113,0,
+134,255,113,0,135,255,113,0,136,254,225,0,194,255,113,0,196,255,113,0,198,
+255,113,1,67,255,113,1,69,254,225,1,95,255,113,1,105,255,113,1,164,255,92,
+1,170,255,113,1,174,255,92,1,181,255,92,1,206,255,174,2,83,255,113,2,109,
+255,113,2,201,255,92,2,212,255,113,2,214,255,113,2,216,254,225,3,12,255,92,
+3,22,255,92,3,24,255,113,3,26,255,113,3,28,255,113,3,30,255,113,3,32,255,
+113,3,34,255,113,3,36,255,113,3,38,255,113,3,40,255,113,3,42,255,113,3,44,
+255,113,3,46,255,113,0,40,0,34,255,174,0,55,255,174,0,57,255,133,0,58,255,
+154,0,60,255,174,0,159,255,174,1,36,255,174,1,38,255,174,1,40,255,174,1,54,
+255,154,1,56,255,174,1,58,255,174,1,113,255,174,1,114,255,174,1,115,255,236,
+1,117,255,195,1,120,255,174,1,166,255,174,1,188,255,174,1,196,255,174,1,250,
+255,154,1,252,255,154,1,254,255,154,2,0,255,174,2,105,255,174,2,119,255,174,
+2,123,255,133,2,125,255,133,2,164,255,174,2,176,255,174,2,178,255,174,2,180,
+255,174,2,184,255,174,3,8,255,174,3,10,255,174,3,18,255,174,3,106,255,174,
+3,108,255,174,3,110,255,174,3,124,255,174,0,10,0,34,255,215,1,95,255,215,
+1,98,255,236,1,105,255,215,1,113,255,215,1,114,255,195,1,116,255,215,1,117,
+255,195,1,120,255,195,2,38,255,236,0,11,0,15,255,113,0,17,255,113,1,206,255,
+174,1,213,255,174,1,242,255,174,2,8,255,113,2,12,255,113,2,16,255,113,2,202,
+255,174,3,13,255,174,3,23,255,174,0,28,0,15,255,10,0,17,255,10,1,164,255,
+113,1,168,255,215,1,170,255,154,1,174,255,113,1,181,255,113,1,189,255,215,
+1,206,255,154,1,213,255,154,1,242,255,154,2,8,255,10,2,12,255,10,2,16,255,
+10,2,38,255,195,2,109,255,154,2,201,255,113,2,202,255,154,2,212,255,154,2,
+214,255,154,2,216,255,92,2,242,255,215,2,244,255,215,2,246,255,215,3,12,255,
+113,3,13,255,154,3,22,255,113,3,23,255,154,0,79,0,15,255,92,0,17,255,92,1,
+159,255,195,1,160,255,215,1,164,255,133,1,170,255,113,1,174,255,133,1,181,
+255,133,1,184,255,195,1,187,255,195,1,190,255,195,1,199,255,195,1,200,255,
+195,1,202,255,133,1,206,255,113,1,207,255,113,1,213,255,113,1,216,255,113,
+1,219,255,113,1,222,255,113,1,234,255,113,1,237,255,113,1,238,255,133,1,242,
+255,113,2,8,255,92,2,12,255,92,2,16,255,92,2,38,255,133,2,103,255,195,2,109,
+255,113,2,121,255,195,2,122,255,113,2,127,255,195,2,128,255,113,2,129,255,
+195,2,130,255,113,2,131,255,195,2,132,255,113,2,133,255,195,2,135,255,195,
+2,136,255,113,2,172,255,195,2,173,255,113,2,174,255,195,2,175,255,113,2,192,
+255,195,2,194,255,195,2,201,255,133,2,202,255,113,2,212,255,113,2,213,255,
+133,2,214,255,113,2,215,255,133,2,216,255,72,2,217,255,133,2,219,255,113,
+2,220,255,195,2,221,255,113,2,222,255,195,2,223,255,113,2,234,255,195,2,235,
+255,113,2,236,255,195,2,237,255,113,2,238,255,195,2,239,255,113,2,240,255,
+195,3,4,255,113,3,5,255,113,3,6,255,113,3,7,255,113,3,12,255,133,3,13,255,
+113,3,16,255,195,3,17,255,113,3,20,255,195,3,21,255,113,3,22,255,133,3,23,
+255,113,0,38,0,13,255,113,0,34,255,113,1,166,255,113,1,188,255,113,1,193,
+255,113,1,196,255,113,1,221,255,195,1,246,255,195,2,7,255,113,2,11,255,113,
+2,30,255,113,2,104,255,215,2,105,255,113,2,119,255,154,2,123,255,154,2,124,
+255,195,2,125,255,154,2,126,255,195,2,134,255,215,2,164,255,113,2,176,255,
+113,2,178,255,154,2,179,255,195,2,180,255,154,2,181,255,195,2,184,255,113,
+2,186,255,113,2,188,255,113,2,207,255,113,2,243,255,195,2,245,255,195,2,247,
+255,195,2,248,255,113,3,8,255,113,3,9,255,215,3,10,255,113,3,11,255,215,3,
+18,255,113,0,112,0,5,255,92,0,10,255,92,0,13,255,113,0,34,255,133,1,159,255,
+215,1,166,255,133,1,168,255,174,1,184,255,215,1,187,255,215,1,188,255,133,
+1,189,255,174,1,190,255,215,1,193,255,72,1,196,255,133,1,199,255,215,1,200,
+255,215,1,206,0,41,1,207,255,215,1,213,0,41,1,216,255,215,1,219,255,215,1,
+220,255,174,1,221,255,154,1,222,255,215,1,225,255,215,1,228,255,174,1,234,
+255,215,1,237,255,215,1,242,0,41,1,246,255,154,2,7,255,113,2,11,255,113,2,
+30,255,113,2,103,255,215,2,104,255,195,2,105,255,133,2,119,255,113,2,121,
+255,215,2,122,255,215,2,123,255,92,2,124,255,154,2,125,255,92,2,126,255,154,
+2,127,255,215,2,128,255,215,2,129,255,215,2,130,255,215,2,131,255,215,2,132,
+255,215,2,133,255,215,2,134,255,195,2,135,255,215,2,136,255,215,2,164,255,
+133,2,165,255,174,2,172,255,215,2,173,255,215,2,174,255,215,2,175,255,215,
+2,176,255,133,2,177,255,174,2,178,255,113,2,179,255,154,2,180,255,113,2,181,
+255,154,2,184,255,133,2,185,255,174,2,186,255,72,2,187,255,215,2,188,255,
+72,2,189,255,215,2,192,255,215,2,194,255,215,2,202,0,41,2,207,255,72,2,208,
+255,215,2,219,255,215,2,220,255,215,2,221,255,215,2,222,255,215,2,223,255,
+215,2,234,255,215,2,235,255,215,2,236,255,215,2,237,255,215,2,238,255,215,
+2,239,255,215,2,240,255,215,2,242,255,174,2,243,255,154,2,244,255,174,2,245,
+255,154,2,246,255,174,2,247,255,154,2,248,255,72,2,249,255,215,3,4,255,215,
+3,5,255,215,3,6,255,215,3,7,255,215,3,8,255,133,3,9,255,195,3,10,255,133,
+3,11,255,195,3,13,0,41,3,16,255,215,3,17,255,215,3,18,255,133,3,19,255,174,
+3,20,255,215,3,21,255,215,3,23,0,41,0,11,0,5,255,174,0,10,255,174,1,221,255,
+215,1,246,255,215,2,124,255,215,2,126,255,215,2,179,255,215,2,181,255,215,
+2,243,255,215,2,245,255,215,2,247,255,215,0,16,1,168,255,215,1,189,255,215,
+1,220,255,215,1,228,255,215,2,119,255,215,2,123,255,215,2,125,255,215,2,165,
+255,215,2,177,255,215,2,178,255,215,2,180,255,215,2,185,255,215,2,242,255,
+215,2,244,255,215,2,246,255,215,3,19,255,215,0,76,0,13,255,215,0,34,255,215,
+1,164,255,195,1,166,255,215,1,168,255,195,1,170,255,215,1,174,255,195,1,176,
+255,215,1,181,255,195,1,188,255,215,1,189,255,195,1,191,255,215,1,193,255,
+174,1,196,255,215,1,206,255,215,1,213,255,215,1,220,255,215,1,221,255,215,
+1,228,255,215,1,242,255,215,1,246,255,215,2,7,255,215,2,11,255,215,2,30,255,
+215,2,38,255,215,2,104,255,236,2,105,255,215,2,109,255,215,2,113,255,215,
+2,119,255,174,2,123,255,174,2,124,255,215,2,125,255,174,2,126,255,215,2,134,
+255,236,2,154,255,215,2,164,255,215,2,165,255,215,2,176,255,215,2,177,255,
+215,2,178,255,174,2,179,255,215,2,180,255,174,2,181,255,215,2,182,255,215,
+2,184,255,215,2,185,255,215,2,186,255,174,2,188,255,174,2,197,255,215,2,201,
+255,195,2,202,255,215,2,207,255,174,2,212,255,215,2,214,255,215,2,216,255,
+195,2,224,255,215,2,242,255,195,2,243,255,215,2,244,255,195,2,245,255,215,
+2,246,255,195,2,247,255,215,2,248,255,174,3,0,255,215,3,2,255,215,3,8,255,
+215,3,9,255,236,3,10,255,215,3,11,255,236,3,12,255,195,3,13,255,215,3,18,
+255,215,3,19,255,215,3,22,255,195,3,23,255,215,0,9,1,221,255,215,1,246,255,
+215,2,124,255,215,2,126,255,215,2,179,255,215,2,181,255,215,2,243,255,215,
+2,245,255,215,2,247,255,215,0,78,0,15,255,31,0,17,255,31,1,159,255,215,1,
+164,255,92,1,170,255,92,1,174,255,92,1,181,255,92,1,184,255,215,1,187,255,
+215,1,190,255,215,1,199,255,215,1,200,255,215,1,202,255,133,1,206,255,92,
+1,207,255,133,1,213,255,92,1,216,255,133,1,219,255,133,1,222,255,133,1,234,
+255,133,1,237,255,133,1,238,255,174,1,242,255,92,2,8,255,31,2,12,255,31,2,
+16,255,31,2,38,255,133,2,103,255,215,2,109,255,92,2,121,255,215,2,122,255,
+133,2,127,255,215,2,128,255,133,2,129,255,215,2,130,255,133,2,131,255,215,
+2,132,255,133,2,133,255,215,2,135,255,215,2,136,255,133,2,172,255,215,2,173,
+255,133,2,174,255,215,2,175,255,133,2,192,255,215,2,194,255,215,2,201,255,
+92,2,202,255,92,2,212,255,92,2,213,255,133,2,214,255,92,2,215,255,133,2,216,
+254,246,2,217,255,133,2,219,255,133,2,220,255,215,2,221,255,133,2,222,255,
+215,2,223,255,133,2,234,255,215,2,235,255,133,2,236,255,215,2,237,255,133,
+2,238,255,215,2,239,255,133,2,240,255,215,3,4,255,133,3,5,255,133,3,6,255,
+133,3,7,255,133,3,12,255,92,3,13,255,92,3,16,255,215,3,17,255,133,3,20,255,
+215,3,21,255,133,3,22,255,92,3,23,255,92,0,77,0,15,255,72,0,17,255,72,1,159,
+255,215,1,164,255,133,1,170,255,133,1,174,255,133,1,181,255,133,1,184,255,
+215,1,187,255,215,1,190,255,215,1,199,255,215,1,200,255,215,1,202,255,195,
+1,206,255,133,1,207,255,195,1,213,255,133,1,216,255,195,1,219,255,195,1,222,
+255,195,1,234,255,195,1,237,255,195,1,242,255,133,2,8,255,72,2,12,255,72,
+2,16,255,72,2,38,255,154,2,103,255,215,2,109,255,133,2,121,255,215,2,122,
+255,195,2,127,255,215,2,128,255,195,2,129,255,215,2,130,255,195,2,131,255,
+215,2,132,255,195,2,133,255,215,2,135,255,215,2,136,255,195,2,172,255,215,
+2,173,255,195,2,174,255,215,2,175,255,195,2,192,255,215,2,194,255,215,2,201,
+255,133,2,202,255,133,2,212,255,133,2,213,255,195,2,214,255,133,2,215,255,
+195,2,216,255,92,2,217,255,195,2,219,255,195,2,220,255,215,2,221,255,195,
+2,222,255,215,2,223,255,195,2,234,255,215,2,235,255,195,2,236,255,215,2,237,
+255,195,2,238,255,215,2,239,255,195,2,240,255,215,3,4,255,195,3,5,255,195,
+3,6,255,195,3,7,255,195,3,12,255,133,3,13,255,133,3,16,255,215,3,17,255,195,
+3,20,255,215,3,21,255,195,3,22,255,133,3,23,255,133,0,15,0,13,0,61,0,15,255,
+113,0,17,255,113,1,206,255,174,1,213,255,174,1,242,255,174,2,7,0,61,2,8,255,
+113,2,11,0,61,2,12,255,113,2,16,255,113,2,30,0,61,2,202,255,174,3,13,255,
+174,3,23,255,174,0,79,1,159,255,215,1,184,255,215,1,187,255,215,1,190,255,
+215,1,193,255,215,1,199,255,215,1,200,255,215,1,207,255,215,1,216,255,215,
+1,219,255,215,1,220,255,195,1,221,255,195,1,222,255,215,1,225,255,215,1,228,
+255,195,1,234,255,215,1,237,255,215,1,246,255,195,2,103,255,215,2,104,255,
+195,2,121,255,215,2,122,255,215,2,124,255,195,2,126,255,195,2,127,255,215,
+2,128,255,215,2,129,255,215,2,130,255,215,2,131,255,215,2,132,255,215,2,133,
+255,215,2,134,255,195,2,135,255,215,2,136,255,215,2,165,255,195,2,172,255,
+215,2,173,255,215,2,174,255,215,2,175,255,215,2,177,255,195,2,179,255,195,
+2,181,255,195,2,185,255,195,2,186,255,215,2,187,255,215,2,188,255,215,2,189,
+255,215,2,192,255,215,2,194,255,215,2,207,255,215,2,208,255,215,2,219,255,
+215,2,220,255,215,2,221,255,215,2,222,255,215,2,223,255,215,2,234,255,215,
+2,235,255,215,2,236,255,215,2,237,255,215,2,238,255,215,2,239,255,215,2,240,
+255,215,2,243,255,195,2,245,255,195,2,247,255,195,2,248,255,215,2,249,255,
+215,3,4,255,215,3,5,255,215,3,6,255,215,3,7,255,215,3,9,255,195,3,11,255,
+195,3,16,255,215,3,17,255,215,3,19,255,195,3,20,255,215,3,21,255,215,0,25,
+1,207,255,215,1,216,255,215,1,219,255,215,1,222,255,215,1,234,255,215,1,237,
+255,215,2,122,255,215,2,128,255,215,2,130,255,215,2,132,255,215,2,136,255,
+215,2,173,255,215,2,175,255,215,2,219,255,215,2,221,255,215,2,223,255,215,
+2,235,255,215,2,237,255,215,2,239,255,215,3,4,255,215,3,5,255,215,3,6,255,
+215,3,7,255,215,3,17,255,215,3,21,255,215,0,48,0,34,255,215,1,164,255,154,
+1,166,255,215,1,168,255,215,1,170,255,215,1,174,255,154,1,176,255,215,1,181,
+255,154,1,188,255,215,1,189,255,215,1,191,255,215,1,196,255,215,1,206,255,
+174,1,213,255,174,1,242,255,174,2,38,255,236,2,105,255,215,2,109,255,215,
+2,113,255,215,2,119,255,195,2,123,255,215,2,125,255,215,2,154,255,215,2,164,
+255,215,2,176,255,215,2,178,255,195,2,180,255,195,2,182,255,215,2,184,255,
+215,2,197,255,215,2,201,255,154,2,202,255,174,2,212,255,215,2,214,255,215,
+2,216,255,154,2,224,255,215,2,242,255,215,2,244,255,215,2,246,255,215,3,0,
+255,215,3,2,255,215,3,8,255,215,3,10,255,215,3,12,255,154,3,13,255,174,3,
+18,255,215,3,22,255,154,3,23,255,174,0,4,0,13,255,154,2,7,255,154,2,11,255,
+154,2,30,255,154,0,173,0,5,255,92,0,10,255,92,0,13,255,113,0,34,255,133,0,
+38,255,215,0,42,255,215,0,50,255,215,0,52,255,215,0,55,255,133,0,56,255,215,
+0,57,255,92,0,58,255,113,0,60,255,113,0,70,255,215,0,71,255,215,0,72,255,
+215,0,74,255,215,0,82,255,215,0,84,255,215,0,88,255,215,0,89,255,154,0,90,
+255,195,0,92,255,154,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,
+215,0,152,255,215,0,154,255,215,0,155,255,215,0,156,255,215,0,157,255,215,
+0,158,255,215,0,159,255,113,0,169,255,215,0,170,255,215,0,171,255,215,0,172,
+255,215,0,173,255,215,0,178,255,215,0,180,255,215,0,181,255,215,0,182,255,
+215,0,183,255,215,0,184,255,215,0,186,255,215,0,187,255,215,0,188,255,215,
+0,189,255,215,0,190,255,215,0,191,255,154,0,193,255,154,0,200,255,215,0,201,
+255,215,0,202,255,215,0,203,255,215,0,204,255,215,0,205,255,215,0,206,255,
+215,0,207,255,215,0,209,255,215,0,211,255,215,0,213,255,215,0,215,255,215,
+0,217,255,215,0,219,255,215,0,221,255,215,0,222,255,215,0,223,255,215,0,224,
+255,215,0,225,255,215,0,226,255,215,0,227,255,215,0,228,255,215,0,229,255,
+215,1,14,255,215,1,15,255,215,1,16,255,215,1,17,255,215,1,18,255,215,1,19,
+255,215,1,20,255,215,1,21,255,215,1,36,255,133,1,38,255,133,1,40,255,133,
+1,42,255,215,1,43,255,215,1,44,255,215,1,45,255,215,1,46,255,215,1,47,255,
+215,1,48,255,215,1,49,255,215,1,50,255,215,1,51,255,215,1,52,255,215,1,53,
+255,215,1,54,255,113,1,55,255,195,1,56,255,113,1,57,255,154,1,58,255,113,
+1,71,255,215,1,72,255,215,1,250,255,113,1,251,255,195,1,252,255,113,1,253,
+255,195,1,254,255,113,1,255,255,195,2,0,255,113,2,1,255,154,2,7,255,113,2,
+11,255,113,2,30,255,113,2,90,255,215,2,91,255,215,2,92,255,215,2,93,255,215,
+3,49,255,215,3,51,255,215,3,53,255,215,3,55,255,215,3,57,255,215,3,59,255,
+215,3,61,255,215,3,63,255,215,3,68,255,215,3,69,255,215,3,70,255,215,3,71,
+255,215,3,72,255,215,3,73,255,215,3,74,255,215,3,75,255,215,3,76,255,215,
+3,77,255,215,3,78,255,215,3,79,255,215,3,80,255,215,3,81,255,215,3,82,255,
+215,3,83,255,215,3,84,255,215,3,85,255,215,3,86,255,215,3,87,255,215,3,88,
+255,215,3,89,255,215,3,90,255,215,3,91,255,215,3,92,255,215,3,93,255,215,
+3,94,255,215,3,95,255,215,3,96,255,215,3,97,255,215,3,98,255,215,3,99,255,
+215,3,100,255,215,3,101,255,215,3,102,255,215,3,103,255,215,3,104,255,215,
+3,105,255,215,3,106,255,113,3,107,255,154,3,108,255,113,3,109,255,154,3,110,
+255,113,3,111,255,154,3,124,255,133,0,10,0,5,255,174,0,10,255,174,0,92,255,
+215,0,191,255,215,0,193,255,215,1,57,255,215,2,1,255,215,3,107,255,215,3,
+109,255,215,3,111,255,215,0,14,0,57,255,215,0,58,255,215,0,60,255,215,0,159,
+255,215,1,54,255,215,1,56,255,215,1,58,255,215,1,250,255,215,1,252,255,215,
+1,254,255,215,2,0,255,215,3,106,255,215,3,108,255,215,3,110,255,215,0,48,
+0,34,255,215,0,36,255,215,0,55,255,215,0,57,255,215,0,58,255,215,0,59,255,
+215,0,60,255,195,0,130,255,215,0,131,255,215,0,132,255,215,0,133,255,215,
+0,134,255,215,0,135,255,215,0,136,255,154,0,159,255,195,0,194,255,215,0,196,
+255,215,0,198,255,215,1,36,255,215,1,38,255,215,1,40,255,215,1,54,255,215,
+1,56,255,195,1,58,255,195,1,67,255,215,1,69,255,154,1,250,255,215,1,252,255,
+215,1,254,255,215,2,0,255,195,2,38,255,236,2,83,255,215,3,24,255,215,3,26,
+255,215,3,28,255,215,3,30,255,215,3,32,255,215,3,34,255,215,3,36,255,215,
+3,38,255,215,3,40,255,215,3,42,255,215,3,44,255,215,3,46,255,215,3,106,255,
+195,3,108,255,195,3,110,255,195,3,124,255,215,0,8,0,92,255,215,0,191,255,
+215,0,193,255,215,1,57,255,215,2,1,255,215,3,107,255,215,3,109,255,215,3,
+111,255,215,0,149,0,34,0,41,0,36,255,174,0,55,0,41,0,57,0,41,0,58,0,41,0,
+60,0,41,0,68,255,215,0,70,255,215,0,71,255,215,0,72,255,215,0,74,255,215,
+0,82,255,215,0,84,255,215,0,86,255,215,0,90,255,215,0,91,255,215,0,92,255,
+215,0,130,255,174,0,131,255,174,0,132,255,174,0,133,255,174,0,134,255,174,
+0,135,255,174,0,159,0,41,0,162,255,215,0,163,255,215,0,164,255,215,0,165,
+255,215,0,166,255,215,0,167,255,215,0,168,255,215,0,169,255,215,0,170,255,
+215,0,171,255,215,0,172,255,215,0,173,255,215,0,178,255,215,0,180,255,215,
+0,181,255,215,0,182,255,215,0,183,255,215,0,184,255,215,0,186,255,215,0,191,
+255,215,0,193,255,215,0,194,255,174,0,195,255,215,0,196,255,174,0,197,255,
+215,0,198,255,174,0,199,255,215,0,201,255,215,0,203,255,215,0,205,255,215,
+0,207,255,215,0,209,255,215,0,211,255,215,0,213,255,215,0,215,255,215,0,217,
+255,215,0,219,255,215,0,221,255,215,0,223,255,215,0,225,255,215,0,227,255,
+215,0,229,255,215,1,15,255,215,1,17,255,215,1,19,255,215,1,21,255,215,1,29,
+255,215,1,31,255,215,1,33,255,215,1,35,255,215,1,36,0,41,1,38,0,41,1,40,0,
+41,1,54,0,41,1,55,255,215,1,56,0,41,1,57,255,215,1,58,0,41,1,67,255,174,1,
+68,255,215,1,70,255,215,1,72,255,215,1,74,255,215,1,250,0,41,1,251,255,215,
+1,252,0,41,1,253,255,215,1,254,0,41,1,255,255,215,2,0,0,41,2,1,255,215,2,
+83,255,174,2,84,255,215,2,91,255,215,3,24,255,174,3,25,255,215,3,26,255,174,
+3,27,255,215,3,28,255,174,3,29,255,215,3,30,255,174,3,31,255,215,3,32,255,
+174,3,33,255,215,3,34,255,174,3,35,255,215,3,36,255,174,3,37,255,215,3,38,
+255,174,3,39,255,215,3,40,255,174,3,41,255,215,3,42,255,174,3,43,255,215,
+3,44,255,174,3,45,255,215,3,46,255,174,3,47,255,215,3,49,255,215,3,51,255,
+215,3,53,255,215,3,55,255,215,3,57,255,215,3,59,255,215,3,61,255,215,3,63,
+255,215,3,69,255,215,3,71,255,215,3,73,255,215,3,75,255,215,3,77,255,215,
+3,79,255,215,3,81,255,215,3,83,255,215,3,85,255,215,3,87,255,215,3,89,255,
+215,3,91,255,215,3,106,0,41,3,107,255,215,3,108,0,41,3,109,255,215,3,110,
+0,41,3,111,255,215,3,124,0,41,0,51,0,13,0,41,0,80,0,41,0,81,0,41,0,83,0,41,
+0,87,0,61,0,88,0,41,0,90,0,61,0,92,0,61,0,179,0,41,0,187,0,41,0,188,0,41,
+0,189,0,41,0,190,0,41,0,191,0,61,0,193,0,61,0,250,0,41,1,6,0,41,1,8,0,41,
+1,10,0,41,1,13,0,41,1,37,0,61,1,39,0,61,1,41,0,61,1,43,0,41,1,45,0,41,1,47,
+0,41,1,49,0,41,1,51,0,41,1,53,0,41,1,55,0,61,1,57,0,61,1,251,0,61,1,253,0,
+61,1,255,0,61,2,1,0,61,2,7,0,41,2,11,0,41,2,30,0,41,2,82,0,41,2,93,0,41,3,
+93,0,41,3,95,0,41,3,97,0,41,3,99,0,41,3,101,0,41,3,103,0,41,3,105,0,41,3,
+107,0,61,3,109,0,61,3,111,0,61,3,125,0,61,0,24,0,36,255,215,0,130,255,215,
+0,131,255,215,0,132,255,215,0,133,255,215,0,134,255,215,0,135,255,215,0,194,
+255,215,0,196,255,215,0,198,255,215,1,67,255,215,2,83,255,215,3,24,255,215,
+3,26,255,215,3,28,255,215,3,30,255,215,3,32,255,215,3,34,255,215,3,36,255,
+215,3,38,255,215,3,40,255,215,3,42,255,215,3,44,255,215,3,46,255,215,0,197,
+0,36,255,133,0,38,255,215,0,42,255,215,0,50,255,215,0,52,255,215,0,68,255,
+154,0,70,255,133,0,71,255,133,0,72,255,133,0,74,255,133,0,80,255,195,0,81,
+255,195,0,82,255,133,0,83,255,195,0,84,255,133,0,86,255,133,0,88,255,195,
+0,90,255,215,0,92,255,215,0,93,255,195,0,130,255,133,0,131,255,133,0,132,
+255,133,0,133,255,133,0,134,255,133,0,135,255,133,0,148,255,215,0,149,255,
+215,0,150,255,215,0,151,255,215,0,152,255,215,0,154,255,215,0,162,255,154,
+0,163,255,154,0,164,255,154,0,165,255,154,0,166,255,154,0,167,255,154,0,168,
+255,154,0,169,255,133,0,170,255,133,0,171,255,133,0,172,255,133,0,173,255,
+133,0,178,255,133,0,179,255,195,0,180,255,133,0,181,255,133,0,182,255,133,
+0,183,255,133,0,184,255,133,0,186,255,133,0,187,255,195,0,188,255,195,0,189,
+255,195,0,190,255,195,0,191,255,215,0,193,255,215,0,194,255,133,0,195,255,
+154,0,196,255,133,0,197,255,154,0,198,255,133,0,199,255,154,0,200,255,215,
+0,201,255,133,0,202,255,215,0,203,255,133,0,204,255,215,0,205,255,133,0,206,
+255,215,0,207,255,133,0,209,255,133,0,211,255,133,0,213,255,133,0,215,255,
+133,0,217,255,133,0,219,255,133,0,221,255,133,0,222,255,215,0,223,255,133,
+0,224,255,215,0,225,255,133,0,226,255,215,0,227,255,133,0,228,255,215,0,229,
+255,133,0,250,255,195,1,6,255,195,1,8,255,195,1,10,255,195,1,13,255,195,1,
+14,255,215,1,15,255,133,1,16,255,215,1,17,255,133,1,18,255,215,1,19,255,133,
+1,20,255,215,1,21,255,133,1,29,255,133,1,31,255,133,1,33,255,133,1,35,255,
+133,1,43,255,195,1,45,255,195,1,47,255,195,1,49,255,195,1,51,255,195,1,53,
+255,195,1,55,255,215,1,57,255,215,1,60,255,195,1,62,255,195,1,64,255,195,
+1,67,255,133,1,68,255,154,1,70,255,154,1,71,255,215,1,72,255,133,1,74,255,
+133,1,251,255,215,1,253,255,215,1,255,255,215,2,1,255,215,2,82,255,195,2,
+83,255,133,2,84,255,154,2,90,255,215,2,91,255,133,2,93,255,195,3,24,255,133,
+3,25,255,154,3,26,255,133,3,27,255,154,3,28,255,133,3,29,255,154,3,30,255,
+133,3,31,255,154,3,32,255,133,3,33,255,154,3,34,255,133,3,35,255,154,3,36,
+255,133,3,37,255,154,3,38,255,133,3,39,255,154,3,40,255,133,3,41,255,154,
+3,42,255,133,3,43,255,154,3,44,255,133,3,45,255,154,3,46,255,133,3,47,255,
+154,3,49,255,133,3,51,255,133,3,53,255,133,3,55,255,133,3,57,255,133,3,59,
+255,133,3,61,255,133,3,63,255,133,3,68,255,215,3,69,255,133,3,70,255,215,
+3,71,255,133,3,72,255,215,3,73,255,133,3,74,255,215,3,75,255,133,3,76,255,
+215,3,77,255,133,3,78,255,215,3,79,255,133,3,80,255,215,3,81,255,133,3,82,
+255,215,3,83,255,133,3,84,255,215,3,85,255,133,3,86,255,215,3,87,255,133,
+3,88,255,215,3,89,255,133,3,90,255,215,3,91,255,133,3,93,255,195,3,95,255,
+195,3,97,255,195,3,99,255,195,3,101,255,195,3,103,255,195,3,105,255,195,3,
+107,255,215,3,109,255,215,3,111,255,215,0,4,0,13,0,41,2,7,0,41,2,11,0,41,
+2,30,0,41,0,165,0,15,255,92,0,17,255,92,0,36,255,113,0,38,255,195,0,42,255,
+195,0,50,255,195,0,52,255,195,0,54,255,215,0,68,255,133,0,70,255,113,0,71,
+255,113,0,72,255,113,0,74,255,113,0,82,255,113,0,84,255,113,0,86,255,133,
+0,130,255,113,0,131,255,113,0,132,255,113,0,133,255,113,0,134,255,113,0,135,
+255,113,0,136,255,72,0,148,255,195,0,149,255,195,0,150,255,195,0,151,255,
+195,0,152,255,195,0,154,255,195,0,162,255,133,0,163,255,133,0,164,255,133,
+0,165,255,133,0,166,255,133,0,167,255,133,0,168,255,133,0,169,255,113,0,170,
+255,113,0,171,255,113,0,172,255,113,0,173,255,113,0,178,255,113,0,180,255,
+113,0,181,255,113,0,182,255,113,0,183,255,113,0,184,255,113,0,186,255,113,
+0,194,255,113,0,195,255,133,0,196,255,113,0,197,255,133,0,198,255,113,0,199,
+255,133,0,200,255,195,0,201,255,113,0,202,255,195,0,203,255,113,0,204,255,
+195,0,205,255,113,0,206,255,195,0,207,255,113,0,209,255,113,0,211,255,113,
+0,213,255,113,0,215,255,113,0,217,255,113,0,219,255,113,0,221,255,113,0,222,
+255,195,0,223,255,113,0,224,255,195,0,225,255,113,0,226,255,195,0,227,255,
+113,0,228,255,195,0,229,255,113,1,14,255,195,1,15,255,113,1,16,255,195,1,
+17,255,113,1,18,255,195,1,19,255,113,1,20,255,195,1,21,255,113,1,28,255,215,
+1,29,255,133,1,30,255,215,1,31,255,133,1,32,255,215,1,33,255,133,1,34,255,
+215,1,35,255,133,1,67,255,113,1,68,255,133,1,69,255,72,1,70,255,133,1,71,
+255,195,1,72,255,113,1,73,255,215,1,74,255,133,2,8,255,92,2,12,255,92,2,16,
+255,92,2,38,255,133,2,83,255,113,2,84,255,133,2,90,255,195,2,91,255,113,3,
+24,255,113,3,25,255,133,3,26,255,113,3,27,255,133,3,28,255,113,3,29,255,133,
+3,30,255,113,3,31,255,133,3,32,255,113,3,33,255,133,3,34,255,113,3,35,255,
+133,3,36,255,113,3,37,255,133,3,38,255,113,3,39,255,133,3,40,255,113,3,41,
+255,133,3,42,255,113,3,43,255,133,3,44,255,113,3,45,255,133,3,46,255,113,
+3,47,255,133,3,49,255,113,3,51,255,113,3,53,255,113,3,55,255,113,3,57,255,
+113,3,59,255,113,3,61,255,113,3,63,255,113,3,68,255,195,3,69,255,113,3,70,
+255,195,3,71,255,113,3,72,255,195,3,73,255,113,3,74,255,195,3,75,255,113,
+3,76,255,195,3,77,255,113,3,78,255,195,3,79,255,113,3,80,255,195,3,81,255,
+113,3,82,255,195,3,83,255,113,3,84,255,195,3,85,255,113,3,86,255,195,3,87,
+255,113,3,88,255,195,3,89,255,113,3,90,255,195,3,91,255,113,0,5,0,15,255,
+72,0,17,255,72,2,8,255,72,2,12,255,72,2,16,255,72,0,153,0,15,255,72,0,17,
+255,72,0,36,255,133,0,38,255,215,0,42,255,215,0,50,255,215,0,52,255,215,0,
+68,255,195,0,70,255,195,0,71,255,195,0,72,255,195,0,74,255,195,0,82,255,195,
+0,84,255,195,0,130,255,133,0,131,255,133,0,132,255,133,0,133,255,133,0,134,
+255,133,0,135,255,133,0,136,255,92,0,148,255,215,0,149,255,215,0,150,255,
+215,0,151,255,215,0,152,255,215,0,154,255,215,0,162,255,195,0,163,255,195,
+0,164,255,195,0,165,255,195,0,166,255,195,0,167,255,195,0,168,255,195,0,169,
+255,195,0,170,255,195,0,171,255,195,0,172,255,195,0,173,255,195,0,178,255,
+195,0,180,255,195,0,181,255,195,0,182,255,195,0,183,255,195,0,184,255,195,
+0,186,255,195,0,194,255,133,0,195,255,195,0,196,255,133,0,197,255,195,0,198,
+255,133,0,199,255,195,0,200,255,215,0,201,255,195,0,202,255,215,0,203,255,
+195,0,204,255,215,0,205,255,195,0,206,255,215,0,207,255,195,0,209,255,195,
+0,211,255,195,0,213,255,195,0,215,255,195,0,217,255,195,0,219,255,195,0,221,
+255,195,0,222,255,215,0,223,255,195,0,224,255,215,0,225,255,195,0,226,255,
+215,0,227,255,195,0,228,255,215,0,229,255,195,1,14,255,215,1,15,255,195,1,
+16,255,215,1,17,255,195,1,18,255,215,1,19,255,195,1,20,255,215,1,21,255,195,
+1,67,255,133,1,68,255,195,1,69,255,92,1,70,255,195,1,71,255,215,1,72,255,
+195,2,8,255,72,2,12,255,72,2,16,255,72,2,38,255,154,2,83,255,133,2,84,255,
+195,2,90,255,215,2,91,255,195,3,24,255,133,3,25,255,195,3,26,255,133,3,27,
+255,195,3,28,255,133,3,29,255,195,3,30,255,133,3,31,255,195,3,32,255,133,
+3,33,255,195,3,34,255,133,3,35,255,195,3,36,255,133,3,37,255,195,3,38,255,
+133,3,39,255,195,3,40,255,133,3,41,255,195,3,42,255,133,3,43,255,195,3,44,
+255,133,3,45,255,195,3,46,255,133,3,47,255,195,3,49,255,195,3,51,255,195,
+3,53,255,195,3,55,255,195,3,57,255,195,3,59,255,195,3,61,255,195,3,63,255,
+195,3,68,255,215,3,69,255,195,3,70,255,215,3,71,255,195,3,72,255,215,3,73,
+255,195,3,74,255,215,3,75,255,195,3,76,255,215,3,77,255,195,3,78,255,215,
+3,79,255,195,3,80,255,215,3,81,255,195,3,82,255,215,3,83,255,195,3,84,255,
+215,3,85,255,195,3,86,255,215,3,87,255,195,3,88,255,215,3,89,255,195,3,90,
+255,215,3,91,255,195,0,1,0,0,0,10,0,76,0,154,0,3,99,121,114,108,0,20,103,
+114,101,107,0,34,108,97,116,110,0,48,0,4,0,0,0,0,255,255,0,2,0,1,0,5,0,4,
+0,0,0,0,255,255,0,2,0,2,0,6,0,4,0,0,0,0,255,255,0,4,0,0,0,3,0,7,0,4,0,8,97,
+97,108,116,0,50,99,99,109,112,0,56,99,99,109,112,0,56,99,99,109,112,0,56,
+108,105,103,97,0,66,114,116,108,109,0,72,114,116,108,109,0,72,114,116,108,
+109,0,72,0,0,0,1,0,4,0,0,0,3,0,0,0,1,0,2,0,0,0,1,0,3,0,0,0,1,0,5,0,7,0,16,
+5,140,6,10,7,174,7,234,8,16,8,70,0,4,0,0,0,1,0,8,0,1,5,106,0,5,0,16,1,34,
+2,52,3,70,4,88,0,28,0,58,0,66,0,74,0,82,0,90,0,98,0,106,0,114,0,122,0,130,
+0,136,0,144,0,152,0,160,0,168,0,176,0,182,0,190,0,198,0,206,0,214,0,222,0,
+228,0,236,0,244,0,252,1,4,1,12,8,145,0,3,4,200,4,201,8,146,0,3,4,200,4,202,
+8,147,0,3,4,200,4,203,8,148,0,3,4,200,4,204,8,149,0,3,4,201,4,200,8,150,0,
+3,4,201,4,201,8,151,0,3,4,201,4,202,8,152,0,3,4,201,4,203,8,153,0,3,4,201,
+4,204,8,154,0,2,4,201,8,155,0,3,4,202,4,200,8,156,0,3,4,202,4,201,8,157,0,
+3,4,202,4,202,8,158,0,3,4,202,4,203,8,159,0,3,4,202,4,204,8,160,0,2,4,202,
+8,161,0,3,4,203,4,200,8,162,0,3,4,203,4,201,8,163,0,3,4,203,4,202,8,164,0,
+3,4,203,4,203,8,165,0,3,4,203,4,204,8,166,0,2,4,203,8,167,0,3,4,204,4,200,
+8,168,0,3,4,204,4,201,8,169,0,3,4,204,4,202,8,170,0,3,4,204,4,203,8,171,0,
+3,4,204,4,204,8,172,0,2,4,204,0,28,0,58,0,66,0,74,0,82,0,90,0,98,0,104,0,
+112,0,120,0,128,0,136,0,144,0,152,0,160,0,168,0,176,0,182,0,190,0,198,0,206,
+0,214,0,222,0,228,0,236,0,244,0,252,1,4,1,12,8,173,0,3,4,200,4,200,8,174,
+0,3,4,200,4,201,8,175,0,3,4,200,4,202,8,176,0,3,4,200,4,203,8,177,0,3,4,200,
+4,204,8,178,0,2,4,200,8,179,0,3,4,201,4,200,8,180,0,3,4,201,4,202,8,181,0,
+3,4,201,4,203,8,182,0,3,4,201,4,204,8,183,0,3,4,202,4,200,8,184,0,3,4,202,
+4,201,8,185,0,3,4,202,4,202,8,186,0,3,4,202,4,203,8,187,0,3,4,202,4,204,8,
+188,0,2,4,202,8,189,0,3,4,203,4,200,8,190,0,3,4,203,4,201,8,191,0,3,4,203,
+4,202,8,192,0,3,4,203,4,203,8,193,0,3,4,203,4,204,8,194,0,2,4,203,8,195,0,
+3,4,204,4,200,8,196,0,3,4,204,4,201,8,197,0,3,4,204,4,202,8,198,0,3,4,204,
+4,203,8,199,0,3,4,204,4,204,8,200,0,2,4,204,0,28,0,58,0,66,0,74,0,82,0,90,
+0,98,0,104,0,112,0,120,0,128,0,136,0,144,0,150,0,158,0,166,0,174,0,182,0,
+190,0,198,0,206,0,214,0,222,0,228,0,236,0,244,0,252,1,4,1,12,8,201,0,3,4,
+200,4,200,8,202,0,3,4,200,4,201,8,203,0,3,4,200,4,202,8,204,0,3,4,200,4,203,
+8,205,0,3,4,200,4,204,8,206,0,2,4,200,8,207,0,3,4,201,4,200,8,208,0,3,4,201,
+4,201,8,209,0,3,4,201,4,202,8,210,0,3,4,201,4,203,8,211,0,3,4,201,4,204,8,
+212,0,2,4,201,8,213,0,3,4,202,4,200,8,214,0,3,4,202,4,201,8,215,0,3,4,202,
+4,203,8,216,0,3,4,202,4,204,8,217,0,3,4,203,4,200,8,218,0,3,4,203,4,201,8,
+219,0,3,4,203,4,202,8,220,0,3,4,203,4,203,8,221,0,3,4,203,4,204,8,222,0,2,
+4,203,8,223,0,3,4,204,4,200,8,224,0,3,4,204,4,201,8,225,0,3,4,204,4,202,8,
+226,0,3,4,204,4,203,8,227,0,3,4,204,4,204,8,228,0,2,4,204,0,28,0,58,0,66,
+0,74,0,82,0,90,0,98,0,104,0,112,0,120,0,128,0,136,0,144,0,150,0,158,0,166,
+0,174,0,182,0,190,0,196,0,204,0,212,0,220,0,228,0,234,0,242,0,250,1,2,1,10,
+8,229,0,3,4,200,4,200,8,230,0,3,4,200,4,201,8,231,0,3,4,200,4,202,8,232,0,
+3,4,200,4,203,8,233,0,3,4,200,4,204,8,234,0,2,4,200,8,235,0,3,4,201,4,200,
+8,236,0,3,4,201,4,201,8,237,0,3,4,201,4,202,8,238,0,3,4,201,4,203,8,239,0,
+3,4,201,4,204,8,240,0,2,4,201,8,241,0,3,4,202,4,200,8,242,0,3,4,202,4,201,
+8,243,0,3,4,202,4,202,8,244,0,3,4,202,4,203,8,245,0,3,4,202,4,204,8,246,0,
+2,4,202,8,247,0,3,4,203,4,200,8,248,0,3,4,203,4,201,8,249,0,3,4,203,4,202,
+8,250,0,3,4,203,4,204,9,0,0,2,4,204,8,251,0,3,4,204,4,200,8,252,0,3,4,204,
+4,201,8,253,0,3,4,204,4,202,8,254,0,3,4,204,4,203,8,255,0,3,4,204,4,204,0,
+28,0,58,0,66,0,74,0,82,0,90,0,98,0,104,0,112,0,120,0,128,0,136,0,144,0,150,
+0,158,0,166,0,174,0,182,0,190,0,196,0,204,0,212,0,220,0,228,0,236,0,242,0,
+250,1,2,1,10,9,1,0,3,4,200,4,200,9,2,0,3,4,200,4,201,9,3,0,3,4,200,4,202,
+9,4,0,3,4,200,4,203,9,5,0,3,4,200,4,204,9,6,0,2,4,200,9,7,0,3,4,201,4,200,
+9,8,0,3,4,201,4,201,9,9,0,3,4,201,4,202,9,10,0,3,4,201,4,203,9,11,0,3,4,201,
+4,204,9,12,0,2,4,201,9,13,0,3,4,202,4,200,9,14,0,3,4,202,4,201,9,15,0,3,4,
+202,4,202,9,16,0,3,4,202,4,203,9,17,0,3,4,202,4,204,9,18,0,2,4,202,9,19,0,
+3,4,203,4,200,9,20,0,3,4,203,4,201,9,21,0,3,4,203,4,202,9,22,0,3,4,203,4,
+203,9,23,0,3,4,203,4,204,9,24,0,2,4,203,9,25,0,3,4,204,4,200,9,26,0,3,4,204,
+4,201,9,27,0,3,4,204,4,202,9,28,0,3,4,204,4,203,0,2,0,1,4,200,4,204,0,0,0,
+6,0,0,0,1,0,8,0,3,0,0,0,1,2,198,0,1,0,18,0,1,0,0,0,6,0,2,0,16,2,94,2,96,0,
+0,2,138,2,141,0,3,3,113,3,113,0,7,4,226,4,242,0,8,4,248,4,248,0,25,5,26,5,
+28,0,26,5,31,5,33,0,29,5,35,5,35,0,32,5,39,5,41,0,33,5,45,5,47,0,36,5,52,
+5,52,0,39,5,56,5,56,0,40,5,64,5,76,0,41,6,70,6,71,0,54,6,73,6,79,0,56,6,81,
+6,81,0,63,0,4,0,0,0,1,0,8,0,1,1,146,0,3,0,12,0,110,1,0,0,8,0,18,0,28,0,38,
+0,48,0,58,0,68,0,78,0,88,9,29,0,4,4,227,4,241,2,94,9,30,0,4,4,227,4,241,2,
+95,9,31,0,4,4,227,4,242,2,94,9,32,0,4,4,227,4,242,2,95,9,33,0,4,4,229,4,241,
+2,94,9,34,0,4,4,229,4,241,2,95,9,35,0,4,4,229,4,242,2,94,9,36,0,4,4,229,4,
+242,2,95,0,12,0,26,0,36,0,46,0,56,0,66,0,76,0,86,0,96,0,106,0,116,0,126,0,
+136,9,37,0,4,4,227,4,241,2,94,9,38,0,4,4,227,4,241,2,95,9,39,0,4,4,227,4,
+242,2,94,9,40,0,4,4,227,4,242,2,95,9,41,0,4,4,229,4,241,2,94,9,42,0,4,4,229,
+4,241,2,95,9,43,0,4,4,229,4,242,2,94,9,44,0,4,4,229,4,242,2,95,9,53,0,4,4,
+231,4,227,2,94,9,54,0,4,4,231,4,227,2,95,9,55,0,4,4,231,4,229,2,94,9,56,0,
+4,4,231,4,229,2,95,0,12,0,26,0,36,0,46,0,56,0,66,0,76,0,86,0,96,0,106,0,116,
+0,126,0,136,9,45,0,4,4,227,4,241,2,94,9,46,0,4,4,227,4,241,2,95,9,47,0,4,
+4,227,4,242,2,94,9,48,0,4,4,227,4,242,2,95,9,49,0,4,4,229,4,241,2,94,9,50,
+0,4,4,229,4,241,2,95,9,51,0,4,4,229,4,242,2,94,9,52,0,4,4,229,4,242,2,95,
+9,57,0,4,4,231,4,227,2,94,9,58,0,4,4,231,4,227,2,95,9,59,0,4,4,231,4,229,
+2,94,9,60,0,4,4,231,4,229,2,95,0,1,0,3,1,126,1,134,1,146,0,4,0,0,0,1,0,8,
+0,1,0,46,0,1,0,8,0,4,0,10,0,16,0,22,0,30,2,50,0,2,0,76,2,51,0,2,0,79,2,88,
+0,3,0,73,0,76,2,89,0,3,0,73,0,79,0,1,0,1,0,73,0,3,0,0,0,1,0,8,0,1,0,22,0,
+2,0,10,0,18,0,3,9,61,9,62,9,63,0,1,9,64,0,1,0,2,1,12,1,127,0,1,0,0,0,1,0,
+8,0,2,0,24,0,9,2,87,8,133,8,134,8,136,8,137,8,140,8,135,9,73,9,81,0,1,0,9,
+2,37,2,40,2,42,2,44,2,45,2,46,8,13,8,18,8,19,0,1,0,0,0,1,0,8,0,2,0,12,0,3,
+0,243,2,53,6,1,0,1,0,3,0,76,0,77,4,85,0,0,};
+#endif
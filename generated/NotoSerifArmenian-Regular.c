@@ -0,0 +1,694 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifArmenian_Regular_ttf_size = 16892;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifArmenian_Regular_ttf");
+asm(".type fz_font_NotoSerifArmenian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifArmenian_Regular_ttf, 16892");
+asm(".balign 64");
+asm("fz_font_NotoSerifArmenian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifArmenian-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifArmenian_Regular_ttf_size = 16892;
+const char fz_font_NotoSerifArmenian_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,16,0,98,0,0,58,164,0,0,0,22,71,
+80,79,83,202,223,225,86,0,0,58,188,0,0,6,170,71,83,85,66,209,58,216,137,0,
+0,65,104,0,0,0,146,79,83,47,50,133,59,109,67,0,0,1,104,0,0,0,96,99,109,97,
+112,7,107,17,5,0,0,3,80,0,0,0,124,103,97,115,112,0,7,0,7,0,0,58,152,0,0,0,
+12,103,108,121,102,188,200,36,227,0,0,4,148,0,0,44,2,104,101,97,100,12,31,
+38,156,0,0,0,236,0,0,0,54,104,104,101,97,19,190,9,114,0,0,1,36,0,0,0,36,104,
+109,116,120,249,250,46,27,0,0,1,200,0,0,1,136,108,111,99,97,241,28,230,145,
+0,0,3,204,0,0,0,198,109,97,120,112,0,106,0,193,0,0,1,72,0,0,0,32,110,97,109,
+101,142,134,186,177,0,0,48,152,0,0,6,18,112,111,115,116,236,216,178,163,0,
+0,54,172,0,0,3,235,0,1,0,0,0,2,7,174,143,141,131,63,95,15,60,245,0,11,8,0,
+0,0,0,0,207,168,9,108,0,0,0,0,210,40,204,11,255,211,253,215,11,91,6,162,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,11,195,255,211,255,164,11,
+91,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,1,0,0,0,98,0,127,0,3,0,64,0,2,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,5,55,1,144,0,5,0,0,5,154,5,51,0,0,2,
+76,5,154,5,51,0,0,7,209,0,102,2,31,2,0,2,11,5,2,4,5,4,2,2,4,0,0,4,0,0,0,0,
+0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,
+88,0,0,0,1,0,0,0,0,4,164,6,162,0,0,0,32,0,2,4,0,0,102,0,0,0,0,2,20,0,0,2,
+20,0,0,6,204,0,150,5,125,0,250,5,181,0,98,5,212,0,133,5,128,0,150,5,70,0,
+136,4,244,0,168,5,145,0,250,6,181,0,250,5,106,0,100,5,46,0,168,4,81,0,168,
+6,151,0,168,5,169,0,104,5,62,0,60,5,5,0,145,5,68,0,105,6,17,0,133,5,184,0,
+114,6,93,0,150,5,46,0,142,5,31,0,108,5,116,0,146,5,238,0,250,5,38,0,123,6,
+137,0,145,5,50,0,120,6,151,0,250,5,230,0,150,6,15,0,70,4,168,0,78,5,95,0,
+250,4,208,0,120,5,13,0,168,6,121,0,114,4,220,0,71,6,20,0,134,5,183,0,78,1,
+242,0,94,1,242,0,135,2,73,0,120,2,82,0,190,2,103,0,120,3,77,0,160,3,100,0,
+120,7,72,0,102,4,135,0,104,4,247,0,133,5,20,0,104,4,195,0,94,4,186,0,127,
+3,198,0,104,4,212,0,104,5,15,0,104,4,235,0,127,4,214,0,104,2,99,0,104,7,46,
+0,104,4,126,0,127,4,205,0,94,4,78,0,142,4,118,0,94,4,206,0,104,4,170,0,81,
+4,220,0,102,2,85,0,103,4,183,0,129,3,235,0,64,4,214,0,104,2,160,255,211,7,
+2,0,102,4,114,0,99,5,7,0,104,4,214,0,102,4,212,0,102,7,60,0,102,4,214,0,104,
+4,174,0,127,2,201,0,104,7,64,0,102,4,194,0,67,4,126,0,127,5,69,0,88,5,37,
+0,94,2,98,0,187,3,157,0,123,9,123,0,102,9,99,0,102,9,107,0,102,9,123,0,102,
+11,195,0,102,5,151,0,133,10,251,0,250,7,160,0,104,0,0,0,1,0,3,0,1,0,0,0,12,
+0,4,0,112,0,0,0,24,0,16,0,3,0,8,0,0,0,13,0,32,0,160,5,86,5,95,5,135,5,138,
+5,143,251,23,254,255,255,255,0,0,0,0,0,13,0,32,0,160,5,49,5,89,5,97,5,137,
+5,143,251,19,254,255,255,255,0,1,255,245,255,227,255,99,250,211,250,209,250,
+208,250,207,250,208,5,71,1,2,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,20,0,20,0,20,0,20,0,85,0,129,0,182,0,227,1,15,1,90,1,135,1,
+169,1,237,2,36,2,88,2,119,2,184,3,2,3,63,3,110,3,208,3,242,4,54,4,111,4,175,
+4,225,5,35,5,81,5,137,5,181,5,250,6,58,6,104,6,160,6,220,7,3,7,82,7,131,7,
+205,7,253,8,46,8,113,8,140,8,166,8,190,8,213,8,236,9,18,9,52,9,136,9,198,
+10,6,10,68,10,121,10,175,10,229,11,25,11,112,11,165,11,225,11,252,12,96,12,
+162,12,224,13,36,13,115,13,167,13,245,14,68,14,105,14,177,14,231,15,31,15,
+83,15,172,15,238,16,34,16,91,16,148,16,218,17,18,17,86,17,113,17,209,18,29,
+18,71,18,148,18,200,18,238,19,7,19,145,20,6,20,137,21,6,21,175,21,233,21,
+245,22,1,0,0,0,2,0,102,0,0,3,154,5,182,0,3,0,7,0,0,51,17,33,17,37,33,17,33,
+102,3,52,253,47,2,110,253,146,5,182,250,74,98,4,242,0,1,0,150,255,236,6,134,
+5,182,0,44,0,0,19,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,38,
+35,35,53,33,17,54,54,51,50,22,21,21,35,53,52,38,35,34,6,7,6,4,35,34,36,253,
+13,37,47,6,1,54,157,145,146,155,13,37,47,6,1,54,25,58,28,161,128,207,52,82,
+17,32,12,14,254,233,215,234,254,239,1,174,3,57,69,36,22,80,251,228,159,161,
+162,158,3,77,69,36,22,80,252,47,5,10,179,190,131,139,127,124,9,5,186,210,
+234,0,0,1,0,250,0,0,5,12,5,202,0,27,0,0,1,21,33,17,20,22,22,51,51,21,33,17,
+52,36,51,32,4,21,21,35,53,52,38,35,34,6,21,17,5,12,252,189,13,37,47,6,254,
+202,1,8,235,1,1,1,4,207,158,144,139,161,2,199,111,254,119,69,36,22,80,4,18,
+212,228,227,235,10,24,169,169,174,156,254,181,0,0,2,0,98,0,0,5,161,5,202,
+0,22,0,33,0,0,1,35,32,36,53,52,36,51,32,22,21,17,33,21,33,17,20,22,22,51,
+51,21,33,17,17,52,38,35,34,6,21,20,22,51,3,144,254,254,250,254,214,1,26,225,
+1,7,251,1,66,254,190,13,37,47,6,254,202,141,158,140,154,184,177,2,88,226,
+201,212,243,220,242,254,203,111,254,119,69,36,22,80,2,199,1,77,161,167,174,
+159,158,170,0,1,0,133,0,0,5,192,5,202,0,27,0,0,1,52,38,35,34,6,21,17,35,17,
+52,36,51,32,4,21,17,33,21,33,17,20,22,22,51,51,21,33,3,175,158,144,141,160,
+207,1,10,234,1,1,1,4,1,66,254,190,13,37,47,6,254,202,4,10,169,169,172,148,
+254,171,1,75,213,227,227,235,254,203,111,254,119,69,36,22,80,0,0,1,0,150,
+255,236,5,15,5,182,0,27,0,0,1,21,20,4,35,34,36,53,17,52,38,38,35,35,53,33,
+17,33,21,33,17,20,22,51,50,54,53,53,4,246,254,233,231,234,254,239,13,37,47,
+6,1,54,3,67,252,189,157,145,146,155,2,88,170,213,237,234,216,3,57,69,36,22,
+80,254,60,111,254,23,159,161,162,158,190,0,0,2,0,136,0,0,5,1,5,203,0,32,0,
+48,0,0,1,54,36,55,6,6,35,34,36,53,52,0,51,50,0,21,20,0,5,33,50,22,21,21,35,
+52,38,35,33,21,35,17,51,0,38,35,34,6,21,20,22,51,50,62,4,53,1,103,119,1,146,
+58,46,169,78,239,254,242,1,63,234,238,1,32,254,224,254,217,1,73,169,151,210,
+112,117,254,29,206,206,2,132,171,151,146,182,163,141,47,94,85,84,20,16,1,
+34,43,250,85,43,56,243,202,203,1,10,254,246,213,219,254,161,143,138,128,25,
+107,73,180,1,124,3,20,204,190,168,153,181,22,40,68,27,102,55,0,0,1,0,168,
+255,129,4,149,5,182,0,28,0,0,37,55,54,54,51,50,22,21,21,35,53,52,38,35,34,
+4,7,17,52,38,38,35,35,53,33,17,33,21,33,1,222,104,48,114,57,182,165,207,84,
+107,67,254,245,145,13,37,47,6,1,54,2,183,253,73,161,20,8,13,138,141,50,60,
+78,74,47,38,4,231,69,36,22,80,254,60,111,0,0,1,0,250,0,0,5,12,5,202,0,19,
+0,0,37,21,33,17,52,36,51,32,4,21,17,35,17,52,38,35,34,6,21,17,5,12,251,238,
+1,10,234,1,1,1,4,207,158,144,140,161,111,111,4,18,213,227,227,235,254,203,
+1,67,169,169,174,156,252,93,0,2,0,250,0,0,6,150,5,202,0,33,0,43,0,0,1,51,
+21,35,21,16,2,35,34,38,53,52,36,33,38,38,35,34,6,21,17,20,22,22,51,51,21,
+33,17,52,0,33,32,0,3,53,6,6,21,20,22,51,50,54,5,241,165,160,219,195,173,206,
+1,34,1,43,17,227,194,200,227,13,37,47,6,254,202,1,85,1,45,1,39,1,55,174,217,
+188,96,95,114,100,3,211,98,65,254,245,254,221,186,147,198,190,192,201,203,
+172,252,234,69,36,22,80,3,229,229,1,0,254,253,254,62,108,6,134,152,118,114,
+183,0,2,0,100,255,236,5,86,5,182,0,22,0,33,0,0,18,0,33,51,17,52,38,38,35,
+35,53,33,17,33,21,33,17,16,2,35,34,36,53,37,17,35,34,6,21,20,22,51,50,54,
+100,1,113,1,82,75,13,38,47,6,1,55,1,21,254,235,248,234,241,254,246,3,14,75,
+249,237,145,135,137,144,2,177,1,5,1,49,69,36,22,80,254,0,111,254,189,254,
+252,254,236,248,222,50,1,83,209,194,171,174,204,0,0,1,0,168,0,0,4,222,5,182,
+0,34,0,0,1,52,38,38,35,35,53,33,17,20,7,7,51,54,54,51,50,22,21,21,35,53,16,
+33,34,6,21,17,20,22,22,51,51,21,33,1,15,13,37,47,6,1,54,3,5,10,51,185,94,
+209,227,207,254,250,136,163,13,37,47,6,254,202,4,231,69,36,22,80,254,163,
+31,26,55,66,79,227,228,129,109,1,99,176,154,254,23,69,36,22,80,0,0,1,0,168,
+0,0,4,61,5,182,0,17,0,0,1,52,38,38,35,35,53,33,17,33,50,54,54,53,53,51,21,
+33,1,16,13,38,47,6,1,55,1,143,69,36,22,80,252,211,4,231,69,36,22,80,250,185,
+13,37,47,6,214,0,0,1,0,168,0,0,6,24,5,182,0,44,0,0,1,52,38,38,35,35,53,33,
+21,20,7,7,33,17,20,22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,6,35,34,38,
+53,17,33,17,20,22,22,51,51,21,33,1,16,13,38,47,6,1,55,3,5,1,248,96,89,89,
+104,13,38,47,6,1,55,217,184,183,208,254,223,13,35,48,6,254,203,4,231,69,36,
+22,80,204,31,26,55,254,38,127,119,119,127,1,11,69,36,22,80,254,46,176,188,
+187,177,1,99,252,195,70,35,21,80,0,0,2,0,104,255,236,5,40,5,199,0,33,0,45,
+0,0,18,18,55,38,38,53,51,20,22,23,54,54,51,50,22,21,20,6,35,52,38,35,34,6,
+7,4,0,21,20,0,33,32,0,53,36,0,39,6,2,21,20,22,51,50,54,53,112,188,189,230,
+155,207,130,133,180,199,84,125,157,110,80,75,76,71,139,82,1,36,1,86,254,171,
+254,250,254,229,254,190,3,209,254,239,205,125,143,198,176,179,193,2,159,1,
+70,159,44,151,111,83,112,31,151,92,115,95,65,98,120,104,59,68,62,254,169,
+250,246,254,190,1,28,247,239,1,67,50,121,254,189,168,200,221,235,221,0,1,
+0,60,0,0,4,217,5,182,0,41,0,0,1,55,52,55,55,35,6,6,35,34,38,53,17,52,38,38,
+35,35,53,33,17,20,22,51,50,54,53,52,38,38,35,35,53,33,17,20,22,22,51,51,21,
+33,3,163,1,2,5,10,51,185,94,209,227,13,37,47,6,1,54,131,131,132,167,6,50,
+41,6,1,54,13,37,47,6,254,202,1,35,59,30,26,55,66,79,228,228,1,227,69,36,22,
+80,253,78,176,160,168,160,43,69,23,80,252,252,69,36,22,80,0,0,1,0,145,255,
+129,4,178,5,202,0,27,0,0,5,52,38,39,37,55,18,18,36,51,50,22,21,20,6,35,52,
+35,34,2,3,7,5,22,22,21,21,35,3,215,89,123,253,142,21,33,171,1,25,209,145,
+197,106,84,181,162,234,45,14,1,192,202,164,207,67,67,70,15,81,236,1,103,1,
+225,240,110,90,62,82,234,254,0,254,60,145,58,26,134,122,50,0,3,0,105,255,
+236,4,222,5,203,0,38,0,50,0,65,0,0,37,6,6,35,34,38,53,52,54,51,50,22,23,54,
+54,55,6,6,35,34,36,53,52,0,51,32,0,21,20,2,7,22,22,51,6,6,35,34,38,39,38,
+38,35,34,6,21,20,22,51,50,54,1,54,55,53,52,38,35,34,6,21,20,22,51,50,54,3,
+51,97,192,100,145,179,221,140,94,165,79,60,84,12,84,178,88,224,254,230,1,
+48,234,1,0,1,29,121,140,63,125,135,2,79,62,61,113,200,65,135,70,65,97,85,
+68,67,137,1,58,2,1,179,157,145,178,160,131,95,189,148,91,77,128,111,120,148,
+64,70,90,217,105,69,67,220,190,188,1,0,254,226,243,191,254,169,174,63,62,
+63,78,58,211,63,64,84,66,62,74,72,2,217,26,28,52,165,210,181,152,133,166,
+83,0,0,1,0,133,0,0,5,253,5,202,0,19,0,0,37,33,21,33,17,52,38,35,34,6,21,17,
+35,17,52,36,33,50,4,21,4,126,1,127,253,178,161,140,144,158,207,1,4,1,1,234,
+1,10,111,111,4,18,156,174,169,169,254,189,1,53,235,227,227,213,0,2,0,114,
+0,0,5,83,5,199,0,33,0,43,0,0,33,34,38,53,52,18,55,38,38,39,35,53,50,22,23,
+54,54,51,50,22,21,20,6,35,52,38,35,34,6,7,22,18,18,17,39,16,2,39,6,2,21,20,
+22,51,2,49,219,228,207,206,55,176,64,85,105,251,97,119,254,118,122,150,110,
+80,83,88,75,146,60,225,247,112,227,189,241,136,171,142,137,183,168,176,1,
+142,223,8,10,1,102,17,14,112,129,113,97,65,98,122,102,70,60,69,254,255,254,
+70,254,80,111,1,237,1,174,86,144,254,111,184,142,138,0,1,0,150,255,236,6,
+93,5,182,0,38,0,0,19,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,
+38,35,35,53,33,50,22,21,20,6,35,52,38,39,17,20,4,35,34,36,253,13,37,47,6,
+1,54,157,145,146,155,13,37,47,6,1,64,155,194,106,84,85,84,254,233,231,234,
+254,239,1,174,3,57,69,36,22,80,251,228,159,161,162,158,3,77,69,36,22,80,108,
+92,62,82,120,111,3,252,102,213,237,234,0,1,0,142,255,236,4,222,5,192,0,44,
+0,0,18,54,51,20,22,51,50,54,53,52,38,35,33,53,33,50,54,53,52,38,35,34,6,21,
+34,53,52,36,51,50,4,21,20,6,7,21,22,22,21,20,4,35,34,36,53,148,91,81,186,
+159,172,188,216,171,254,16,1,216,171,169,143,123,144,135,176,1,3,196,225,
+1,6,175,155,183,218,254,180,247,228,254,221,1,57,76,134,164,174,155,137,168,
+110,152,139,110,125,142,144,133,128,136,181,150,128,184,35,10,24,200,142,
+198,240,143,114,0,0,1,0,108,255,236,4,149,6,5,0,30,0,0,1,20,0,35,34,0,53,
+52,18,55,34,38,53,52,54,51,22,22,51,23,6,2,21,20,22,51,50,54,53,17,51,4,149,
+254,241,225,242,254,234,146,131,150,176,95,80,6,141,174,21,111,136,157,153,
+143,135,207,1,207,227,255,0,1,33,245,149,1,100,172,101,96,71,82,129,92,28,
+191,254,98,177,215,205,193,204,1,107,0,0,1,0,146,255,236,5,116,5,192,0,43,
+0,0,1,20,4,35,34,0,53,52,0,55,38,38,35,34,6,7,53,54,54,51,50,4,51,50,54,53,
+51,20,6,35,34,38,39,6,0,21,20,22,51,50,54,53,53,51,4,189,254,225,249,245,
+254,226,1,73,238,112,129,80,50,141,54,48,154,53,181,1,164,114,84,85,110,141,
+138,63,138,93,173,254,229,166,152,169,152,207,1,207,229,254,1,33,235,235,
+1,174,102,56,34,18,13,102,15,25,155,68,77,137,215,45,54,58,254,90,229,192,
+218,196,201,117,0,1,0,250,0,0,5,90,5,202,0,29,0,0,19,52,36,51,32,4,21,17,
+20,22,22,51,51,21,33,17,52,38,35,34,6,21,17,20,22,22,51,51,21,33,250,1,10,
+234,1,1,1,4,13,37,47,6,254,202,158,144,140,161,13,37,47,6,254,202,4,18,213,
+227,227,235,252,211,69,36,22,80,4,10,169,169,174,156,252,189,69,36,22,80,
+0,1,0,123,0,0,4,191,5,203,0,32,0,0,1,22,22,23,54,18,53,52,38,35,34,6,21,21,
+35,53,52,36,51,50,0,17,20,2,5,23,22,22,23,7,36,36,39,1,74,40,147,84,221,172,
+152,165,155,167,207,1,34,247,253,1,21,222,254,207,10,92,244,110,15,254,181,
+254,28,191,2,41,55,142,57,172,1,43,172,217,213,176,171,45,47,205,251,254,
+225,254,254,158,254,193,217,5,52,76,14,97,32,226,204,0,0,1,0,145,0,0,5,245,
+5,203,0,26,0,0,37,20,22,22,51,51,21,33,17,52,38,39,17,35,17,6,6,21,17,35,
+17,52,36,33,32,4,21,5,142,13,37,47,6,254,202,160,168,207,167,161,207,1,64,
+1,74,1,66,1,49,207,69,36,22,80,3,254,167,162,15,252,27,3,231,15,164,167,254,
+156,1,88,240,233,228,245,0,2,0,120,0,0,4,241,5,203,0,31,0,45,0,0,1,52,46,
+3,53,52,0,51,50,0,21,20,0,5,33,50,22,21,21,35,52,38,35,33,21,35,17,51,50,
+54,55,54,18,53,52,38,35,34,6,21,20,30,2,2,51,66,198,121,58,1,63,234,242,1,
+33,254,250,254,231,1,28,169,151,210,112,117,254,29,206,183,82,117,148,164,
+151,177,140,144,179,86,157,82,1,99,50,98,143,130,150,88,203,1,10,254,241,
+218,188,254,175,178,138,128,25,107,73,180,1,35,37,85,125,1,18,187,160,213,
+188,170,94,152,149,131,0,1,0,250,0,0,6,131,5,202,0,44,0,0,19,52,36,51,32,
+4,21,21,54,54,51,50,22,21,21,35,53,52,38,35,34,7,17,20,22,22,51,51,21,33,
+17,52,38,35,34,6,21,17,20,22,22,51,51,21,33,250,1,10,234,1,1,1,4,25,56,30,
+161,128,207,52,82,32,27,13,37,47,6,254,202,158,144,140,161,13,37,47,6,254,
+202,4,18,213,227,227,235,182,5,7,179,190,51,59,127,124,8,253,243,69,36,22,
+80,4,10,169,169,174,156,252,189,69,36,22,80,0,0,1,0,150,255,236,4,246,5,182,
+0,29,0,0,19,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,38,35,35,
+53,33,17,20,4,35,34,36,253,13,37,47,6,1,54,157,145,146,155,13,37,47,6,1,54,
+254,233,231,234,254,239,1,174,3,57,69,36,22,80,251,228,159,161,162,158,3,
+77,69,36,22,80,251,248,213,237,234,0,1,0,70,0,0,5,251,5,182,0,37,0,0,1,55,
+52,55,55,35,6,6,35,34,38,53,52,38,38,35,35,53,33,21,20,22,51,50,54,53,17,
+52,38,38,35,35,53,33,17,33,21,33,3,173,1,2,5,10,51,185,94,209,227,13,37,47,
+6,1,54,124,138,134,165,13,37,47,6,1,54,1,127,253,178,1,35,59,30,26,55,66,
+79,228,228,69,36,22,80,197,176,170,170,150,1,243,69,36,22,80,250,185,111,
+0,0,1,0,78,255,236,4,90,5,203,0,39,0,0,18,54,51,22,22,51,50,54,53,52,38,36,
+38,53,52,36,51,50,4,21,20,6,35,52,38,35,34,6,21,20,22,4,22,21,20,4,35,34,
+36,53,78,76,72,6,200,150,154,183,165,254,77,218,1,32,200,174,1,17,86,75,164,
+130,127,163,155,1,183,229,254,199,235,197,254,221,1,75,75,150,176,139,115,
+85,133,177,225,148,173,208,147,93,59,64,116,144,130,103,93,144,179,203,148,
+182,218,159,129,0,0,1,0,250,0,0,4,243,5,202,0,23,0,0,37,20,22,22,51,51,21,
+33,17,52,36,51,32,4,21,17,35,17,52,38,35,34,6,21,1,201,13,37,47,6,254,202,
+1,10,234,1,1,1,4,207,158,144,140,161,207,69,36,22,80,4,18,213,227,227,235,
+254,203,1,67,169,169,174,156,0,0,2,0,120,255,233,4,142,5,203,0,37,0,51,0,
+0,0,38,39,5,39,37,53,38,38,53,52,36,51,50,4,21,20,6,7,21,22,22,21,20,4,35,
+34,36,53,52,54,51,22,22,51,50,54,53,1,62,2,53,52,38,35,34,6,21,20,22,22,3,
+171,164,149,254,99,50,1,41,154,166,1,26,196,206,1,15,167,153,206,185,254,
+202,249,205,254,230,76,72,6,186,154,150,175,254,191,109,96,57,148,114,117,
+146,58,97,2,11,181,36,176,173,64,10,36,171,119,163,183,185,162,118,171,36,
+10,60,198,139,191,236,154,134,63,75,147,168,161,138,1,215,32,70,103,79,101,
+129,128,101,79,104,71,0,0,1,0,168,0,0,4,244,5,182,0,33,0,0,1,52,38,38,35,
+35,53,33,17,51,50,30,3,51,51,21,35,34,46,3,35,35,17,20,22,22,51,51,21,33,
+1,15,13,37,47,6,1,54,107,123,156,122,111,80,57,34,117,112,122,84,82,106,92,
+75,13,37,47,6,254,202,4,231,69,36,22,80,254,148,67,148,253,102,110,87,219,
+172,91,252,244,69,36,22,80,0,0,3,0,114,0,0,6,7,5,182,0,33,0,42,0,51,0,0,37,
+20,22,22,51,51,21,33,17,35,34,0,53,52,36,51,51,53,52,38,38,35,35,53,33,21,
+51,50,4,21,20,0,35,35,53,51,50,54,53,52,38,35,35,3,17,35,34,6,21,20,22,51,
+3,159,13,37,47,6,254,212,68,253,254,217,1,10,237,113,13,37,47,6,1,44,112,
+235,1,13,254,212,249,67,47,183,165,155,163,77,197,78,163,154,167,181,207,
+69,36,22,80,1,18,1,3,227,214,234,47,69,36,22,80,254,235,213,227,254,253,97,
+182,199,185,173,253,29,2,227,172,186,201,180,0,2,0,71,0,0,4,163,5,203,0,20,
+0,30,0,0,1,17,35,17,35,53,51,17,52,54,51,50,22,21,20,4,33,35,21,33,21,1,51,
+50,54,53,16,35,34,6,21,1,233,207,211,211,240,212,222,231,254,252,254,248,
+174,2,186,253,70,172,159,146,238,118,121,1,163,254,93,1,163,111,1,246,211,
+240,196,197,194,189,177,111,1,142,131,148,1,20,170,164,0,2,0,134,255,236,
+5,142,5,205,0,11,0,23,0,0,4,0,17,16,0,33,32,0,17,16,0,33,54,18,17,16,2,35,
+34,2,17,16,18,51,1,216,254,174,1,83,1,52,1,51,1,78,254,171,254,210,212,204,
+198,216,216,204,203,215,20,1,149,1,94,1,92,1,146,254,110,254,162,254,157,
+254,114,110,1,55,1,76,1,68,1,61,254,197,254,186,254,185,254,196,0,3,0,78,
+255,236,5,105,5,197,0,25,0,32,0,39,0,0,18,54,51,22,22,23,17,38,38,53,52,36,
+51,50,22,23,17,4,4,21,20,4,33,32,36,53,1,17,54,54,53,52,38,37,17,34,6,21,
+20,22,78,83,64,11,220,170,244,242,1,35,224,47,65,46,1,54,1,6,254,125,254,
+232,254,224,254,160,2,223,160,185,158,254,138,110,149,132,1,93,77,141,186,
+11,2,140,41,193,151,151,201,6,9,253,139,37,206,171,200,239,172,136,1,178,
+253,138,10,183,120,138,147,161,2,11,148,105,116,137,0,1,0,94,3,217,1,107,
+6,20,0,13,0,0,1,23,6,6,21,20,22,23,21,38,38,53,52,54,1,81,26,63,57,60,58,
+127,140,134,6,20,74,48,109,60,58,71,5,146,2,134,119,95,173,0,0,1,0,135,3,
+217,1,148,6,20,0,13,0,0,19,39,54,54,53,52,38,39,53,22,22,21,20,6,161,26,63,
+57,60,58,127,140,132,3,217,74,48,109,60,58,71,5,146,2,134,119,94,172,0,1,
+0,120,4,211,1,129,6,132,0,10,0,0,19,55,55,54,54,55,51,23,6,6,7,120,10,34,
+14,22,5,162,18,26,71,46,4,211,43,166,66,116,42,30,93,193,117,0,0,1,0,190,
+4,211,2,72,6,132,0,12,0,0,19,52,62,2,53,53,51,20,6,6,21,21,190,33,94,111,
+156,73,188,4,211,63,119,79,62,64,46,114,107,114,73,25,0,1,0,120,4,211,1,129,
+6,132,0,9,0,0,1,38,38,39,55,51,22,22,23,23,1,7,46,71,26,18,162,5,22,14,44,
+4,211,117,193,93,30,42,116,66,209,0,0,1,0,160,4,238,3,30,6,162,0,24,0,0,1,
+22,22,51,50,54,53,52,38,35,34,6,21,35,52,54,51,50,22,21,20,6,35,34,38,1,187,
+14,42,26,54,48,56,49,89,112,161,207,173,120,138,128,84,72,71,5,144,6,11,48,
+40,38,53,170,154,189,247,110,93,84,117,70,0,1,0,120,4,211,3,7,6,153,0,20,
+0,0,1,33,21,33,34,38,53,52,54,51,50,22,21,38,38,35,34,6,21,20,22,1,204,1,
+59,254,171,147,167,132,98,73,87,19,48,28,52,72,76,5,78,123,128,107,93,126,
+86,55,8,12,52,46,56,56,0,1,0,102,255,237,6,224,3,242,0,60,0,0,37,6,6,35,34,
+38,53,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,38,35,35,53,33,
+17,20,22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,22,22,51,51,21,33,39,35,
+6,6,35,34,38,39,3,80,58,151,105,158,171,13,36,48,6,1,37,102,105,109,119,14,
+36,47,6,1,38,102,105,109,119,14,36,47,6,1,38,15,43,49,6,254,240,25,9,47,138,
+109,115,158,30,184,110,93,193,183,1,191,70,35,21,80,253,134,136,132,166,143,
+1,132,70,35,20,80,253,134,136,132,166,143,1,132,70,35,20,80,252,222,65,41,
+23,79,154,85,88,107,96,0,1,0,104,253,225,4,47,4,5,0,42,0,0,1,20,22,22,51,
+51,21,33,53,52,38,35,34,6,21,17,33,21,33,17,20,22,22,51,51,21,33,17,52,38,
+38,35,35,53,33,23,51,54,54,51,50,22,21,3,201,10,30,35,5,254,252,77,90,98,
+116,2,151,253,105,13,37,47,6,254,218,15,43,49,6,1,16,25,9,56,139,91,130,143,
+2,102,47,25,17,79,205,126,125,171,144,254,28,103,254,176,69,36,22,80,5,65,
+65,41,23,79,153,94,78,170,149,0,0,2,0,133,253,225,4,247,4,5,0,30,0,42,0,0,
+5,52,54,55,55,35,6,35,34,2,17,16,18,51,50,23,51,55,51,17,33,21,33,17,20,22,
+22,51,51,21,33,16,38,35,34,6,21,20,22,51,50,54,53,3,46,2,2,5,9,91,197,192,
+201,198,195,197,91,12,34,144,1,11,254,245,13,37,47,6,254,219,131,127,118,
+114,111,123,126,130,1,28,61,26,55,187,1,5,1,4,1,10,1,4,166,147,252,117,103,
+254,176,69,36,22,80,4,237,184,195,206,200,192,181,213,0,1,0,104,253,225,5,
+20,4,5,0,42,0,0,1,52,38,35,34,6,21,17,20,22,22,51,51,21,33,17,52,38,38,35,
+35,53,33,23,51,54,54,51,50,22,21,17,33,21,33,17,20,22,22,51,51,21,33,3,75,
+102,105,110,118,14,36,47,6,254,218,15,43,49,6,1,16,25,9,47,138,109,158,171,
+1,11,254,245,13,37,47,6,254,219,2,122,136,132,169,150,254,134,70,34,21,80,
+3,34,65,41,23,79,154,85,88,193,183,253,218,103,254,176,69,36,22,80,0,1,0,
+94,255,238,4,109,6,20,0,35,0,0,19,17,52,38,38,35,35,53,33,17,33,21,33,17,
+20,22,51,50,54,53,53,51,17,20,22,51,51,21,33,39,35,6,6,35,34,38,197,13,37,
+47,6,1,38,2,233,253,23,93,105,115,122,190,52,62,6,254,240,25,9,46,143,117,
+157,167,1,102,3,223,69,36,22,80,253,222,103,253,228,136,122,153,151,231,254,
+73,84,42,79,153,86,85,189,0,0,2,0,127,253,225,4,241,4,5,0,22,0,34,0,0,5,52,
+54,55,55,35,6,35,34,2,17,16,18,51,50,23,51,55,51,17,33,21,33,16,38,35,34,
+6,21,20,22,51,50,54,53,3,40,2,2,5,9,91,197,192,201,198,195,197,91,12,34,144,
+1,11,254,55,131,127,118,114,111,123,126,130,1,28,61,26,55,187,1,5,1,4,1,10,
+1,4,166,147,250,86,103,4,237,184,195,206,200,192,181,213,0,1,0,104,254,181,
+3,168,6,20,0,35,0,0,5,50,54,53,52,38,35,34,6,7,39,17,52,38,38,35,35,53,33,
+17,33,21,33,17,23,54,54,51,50,22,21,20,6,35,34,38,1,155,145,176,89,89,73,
+218,32,24,13,37,47,6,1,38,2,26,253,230,8,65,101,47,141,163,219,137,70,86,
+239,94,85,63,64,60,7,20,5,49,69,36,22,80,253,222,103,252,246,6,23,21,123,
+107,115,153,52,0,0,1,0,104,253,225,4,122,4,5,0,34,0,0,19,52,38,38,35,35,53,
+33,23,51,54,54,51,50,22,21,17,20,22,22,51,51,21,33,17,52,38,35,34,6,21,17,
+33,21,33,217,15,43,49,6,1,16,25,9,47,138,109,158,171,13,36,48,6,254,219,102,
+105,110,118,2,226,252,95,3,34,65,41,23,79,154,85,88,193,183,254,65,70,35,
+21,80,2,122,136,132,169,150,252,1,103,0,0,2,0,104,253,225,4,250,4,4,0,44,
+0,59,0,0,19,52,38,38,35,35,53,33,23,51,54,54,51,50,18,19,23,21,39,6,6,35,
+34,38,53,52,54,51,50,22,23,38,38,35,34,6,21,17,20,22,22,51,51,21,33,0,39,
+39,38,38,35,34,6,21,20,22,51,50,54,53,217,15,43,49,6,1,16,25,9,48,156,100,
+199,219,15,127,130,10,164,136,121,161,168,153,23,51,9,18,148,129,114,139,
+14,36,47,6,254,218,2,231,1,2,11,43,20,79,75,60,55,64,52,3,34,65,41,23,79,
+154,86,86,254,244,254,245,32,103,32,184,225,157,116,138,147,6,2,184,186,170,
+148,252,103,70,34,21,80,3,153,18,32,3,5,95,94,89,74,124,129,0,0,2,0,127,255,
+238,4,235,6,20,0,22,0,33,0,0,18,0,51,51,17,52,38,38,35,35,53,33,17,33,21,
+33,17,20,2,35,34,2,53,33,17,35,34,6,21,20,22,51,50,54,127,1,17,251,158,13,
+37,47,6,1,37,1,4,254,253,228,213,216,216,2,169,151,185,154,128,116,123,123,
+2,239,1,3,1,83,69,36,22,80,253,222,103,254,112,255,254,242,1,12,253,1,148,
+187,219,219,197,182,0,1,0,104,253,225,4,112,6,20,0,41,0,0,19,52,38,38,35,
+35,53,33,17,20,7,7,51,54,54,51,50,22,21,17,20,22,22,51,51,21,33,17,52,38,
+35,34,6,21,17,20,22,22,51,51,21,33,217,15,43,49,6,1,48,3,4,9,47,138,109,158,
+171,13,36,48,6,254,219,102,105,110,118,14,36,47,6,254,218,5,69,65,41,23,78,
+253,184,31,26,59,85,88,193,183,254,65,70,35,21,80,2,122,136,132,169,150,252,
+103,70,34,21,80,0,1,0,104,253,225,2,191,3,242,0,15,0,0,19,52,38,38,35,35,
+53,33,17,50,54,53,53,51,21,33,207,13,37,47,6,1,38,113,112,80,254,16,3,35,
+69,36,22,80,250,86,14,83,6,206,0,1,0,104,253,225,6,198,6,20,0,73,0,0,1,7,
+7,20,7,20,22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,22,51,51,21,33,39,
+35,6,6,35,34,38,53,52,63,2,52,55,52,35,34,6,21,17,20,22,22,51,51,21,33,17,
+52,38,38,35,35,53,33,17,20,6,7,7,51,54,54,51,50,22,21,20,3,235,2,10,1,93,
+105,115,121,13,37,47,6,1,37,53,61,6,254,240,25,9,49,147,109,156,168,1,10,
+2,1,197,97,111,14,36,47,6,254,218,15,43,49,6,1,49,2,2,4,9,47,135,92,151,169,
+2,127,54,183,24,10,136,122,153,151,1,133,69,36,22,80,252,219,85,41,79,153,
+92,78,183,186,10,24,181,54,23,10,248,171,148,252,103,70,34,21,80,7,100,65,
+41,23,78,253,242,28,61,26,59,85,88,182,174,10,0,2,0,127,255,238,4,95,6,30,
+0,30,0,43,0,0,1,21,35,22,22,21,20,2,35,34,2,53,52,0,51,51,38,38,53,52,54,
+51,50,22,23,6,6,21,20,22,23,18,38,39,35,34,6,21,20,22,51,50,54,53,4,95,222,
+66,67,253,213,199,238,1,28,207,26,180,102,78,57,39,79,34,43,36,208,49,11,
+56,67,71,146,180,136,121,134,129,3,242,103,91,210,109,238,254,235,1,3,212,
+250,1,51,180,170,66,59,81,43,39,36,63,35,65,222,53,254,111,202,96,242,214,
+171,195,202,206,0,1,0,94,253,225,4,101,6,20,0,42,0,0,5,52,54,55,55,35,6,6,
+35,34,38,53,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,38,35,35,
+53,33,17,20,22,22,51,51,21,33,3,54,6,2,5,9,49,147,109,156,168,13,37,47,6,
+1,38,93,105,112,124,13,37,47,6,1,37,15,43,49,6,254,209,17,28,61,26,55,92,
+78,183,186,3,229,69,36,22,80,251,92,136,122,156,150,1,131,69,36,22,80,250,
+190,65,41,23,78,0,0,1,0,142,0,0,4,72,6,30,0,45,0,0,1,7,7,23,54,54,51,50,22,
+21,21,20,22,22,51,51,21,33,17,52,38,35,34,6,6,7,39,53,16,0,33,50,22,21,20,
+6,35,52,38,35,34,14,3,7,1,84,2,2,19,47,138,109,158,171,13,36,48,6,254,219,
+102,105,64,85,59,30,201,1,74,1,11,151,206,92,91,85,89,87,132,78,48,32,8,2,
+127,30,42,1,85,88,193,183,157,70,35,21,80,1,88,136,132,58,90,109,50,142,1,
+244,2,7,116,93,71,58,118,118,106,149,159,163,83,0,0,2,0,94,255,238,4,138,
+6,30,0,40,0,50,0,0,18,54,0,54,53,52,38,39,39,46,2,53,52,54,51,20,22,23,23,
+22,22,21,20,6,7,19,22,22,51,51,21,33,39,35,6,6,35,34,38,53,0,54,55,3,6,2,
+21,20,22,51,94,174,1,127,199,42,38,248,103,131,94,86,69,100,148,173,37,236,
+102,143,194,16,74,74,6,254,230,42,9,52,158,98,182,245,2,27,140,38,140,195,
+191,150,116,2,4,238,1,5,123,36,20,18,5,31,13,29,79,64,66,67,77,65,26,30,6,
+46,88,56,97,93,253,1,61,75,79,163,88,93,205,175,254,252,83,66,2,138,132,254,
+252,135,123,149,0,1,0,104,253,225,5,20,4,5,0,34,0,0,1,52,38,35,34,6,21,17,
+20,22,22,51,51,21,33,17,52,38,38,35,35,53,33,23,51,54,54,51,50,22,21,17,33,
+21,33,3,75,102,105,110,118,14,36,47,6,254,218,15,43,49,6,1,16,25,9,47,138,
+109,158,171,1,11,254,55,2,122,136,132,169,150,254,134,70,34,21,80,3,34,65,
+41,23,79,154,85,88,193,183,251,187,103,0,2,0,81,255,238,4,200,6,30,0,38,0,
+50,0,0,1,4,0,21,21,20,22,51,51,21,33,39,35,6,6,35,34,2,53,52,54,55,39,53,
+23,18,0,51,50,22,21,20,6,35,52,38,35,34,6,18,54,53,52,36,39,6,6,21,20,22,
+51,1,183,1,35,1,63,67,87,6,254,213,25,9,46,140,110,174,237,28,26,142,175,
+95,1,81,205,142,189,92,91,83,80,136,235,243,122,254,250,203,29,26,157,126,
+3,241,10,254,182,231,233,65,61,79,153,87,84,1,18,235,118,209,96,9,107,10,
+1,4,1,30,109,85,64,70,125,101,252,251,170,164,151,222,254,9,112,215,88,184,
+201,0,0,1,0,102,255,239,5,4,6,30,0,56,0,0,19,17,52,38,38,35,35,53,33,17,20,
+22,51,50,54,53,17,52,38,39,39,38,38,53,52,54,51,50,22,21,20,6,35,52,38,35,
+34,6,21,20,22,22,21,17,20,22,51,51,21,33,39,35,6,6,35,34,38,205,13,37,47,
+6,1,38,93,105,115,121,29,26,27,13,16,170,127,111,157,92,66,64,62,57,60,92,
+45,53,61,6,254,240,25,9,49,147,109,156,168,1,96,1,195,69,36,22,80,253,126,
+136,122,153,151,1,155,89,142,61,63,30,58,32,115,151,111,71,55,68,105,112,
+68,63,51,174,157,85,253,93,85,41,79,153,92,78,183,0,0,1,0,103,253,225,1,222,
+3,242,0,23,0,0,19,52,38,38,35,35,53,33,17,20,22,21,20,6,35,35,53,51,50,54,
+53,52,2,53,207,13,37,47,6,1,38,80,194,151,30,14,104,109,123,3,35,69,36,22,
+80,252,230,113,239,79,142,186,103,90,83,75,1,43,118,0,0,1,0,129,255,239,4,
+79,6,30,0,50,0,0,18,18,55,38,38,53,52,54,51,50,22,21,34,6,21,20,22,23,21,
+6,2,21,20,22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,22,51,51,21,33,39,
+35,6,6,35,34,38,53,129,142,58,90,100,186,115,74,107,147,159,80,114,60,120,
+125,113,109,117,13,37,47,6,1,37,53,61,6,254,240,25,9,46,139,110,166,207,2,
+53,1,165,90,30,117,85,116,142,58,34,88,81,55,77,41,24,128,254,94,155,151,
+146,153,151,1,133,69,36,22,80,252,219,85,41,79,153,87,83,228,190,0,1,0,64,
+253,225,3,136,4,4,0,34,0,0,0,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,
+6,0,2,21,20,22,51,33,21,33,34,38,53,52,54,18,54,54,53,2,181,105,104,107,125,
+88,100,254,166,184,236,100,254,255,148,40,59,1,129,253,177,58,68,106,234,
+127,60,3,24,141,189,135,70,64,110,175,199,166,95,213,254,149,254,229,76,33,
+40,103,55,45,66,204,1,73,217,184,106,0,0,1,0,104,0,0,4,112,4,5,0,38,0,0,33,
+17,52,38,35,34,6,21,17,20,22,22,51,51,21,33,17,52,38,38,35,35,53,33,23,51,
+54,54,51,50,22,21,17,20,22,22,51,51,21,3,75,102,105,109,119,14,36,47,6,254,
+218,15,43,49,6,1,16,25,9,47,138,109,158,171,13,36,48,6,2,122,136,132,166,
+143,254,124,70,34,21,80,3,34,65,41,23,79,154,85,88,193,183,254,65,70,35,21,
+80,0,0,1,255,211,253,225,2,110,3,242,0,31,0,0,19,52,54,55,51,6,21,20,30,2,
+23,7,2,2,21,20,22,51,33,21,33,34,38,53,52,54,0,55,39,38,38,113,63,49,84,32,
+31,55,174,85,61,218,155,39,60,1,79,253,227,58,68,106,1,45,56,153,69,83,3,
+32,62,109,39,66,64,32,54,48,114,53,111,254,120,254,137,68,33,40,103,55,45,
+57,247,2,18,94,96,44,112,0,0,1,0,102,253,225,6,154,3,242,0,64,0,0,5,52,54,
+55,55,35,6,6,35,34,38,39,35,6,6,35,34,38,53,17,52,38,38,35,35,53,33,17,20,
+22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,38,35,
+35,53,33,17,20,22,22,51,51,21,33,5,117,2,2,5,9,50,137,100,103,139,31,15,47,
+139,110,155,166,13,37,47,6,1,38,95,103,102,101,13,37,47,6,1,37,90,101,106,
+113,13,37,47,6,1,37,13,37,47,6,254,219,17,28,61,26,55,92,79,97,85,89,93,183,
+186,1,196,69,36,22,80,253,127,134,126,144,139,1,155,69,36,22,80,253,127,133,
+127,157,150,1,131,69,36,22,80,250,190,69,36,22,80,0,2,0,99,253,225,4,15,4,
+4,0,27,0,40,0,0,1,34,38,53,52,54,54,53,52,0,38,53,52,36,51,50,4,21,20,6,0,
+2,21,20,22,51,33,21,1,54,0,53,52,38,35,34,6,21,20,22,22,1,13,58,68,191,119,
+254,252,94,1,25,194,203,1,6,125,254,231,247,40,59,1,219,254,113,14,1,7,146,
+118,109,165,177,84,253,225,45,45,62,195,130,74,105,1,19,179,95,161,205,206,
+159,118,252,254,176,254,250,62,33,40,103,2,88,20,1,117,213,118,152,161,110,
+118,232,158,0,0,1,0,104,0,0,5,7,4,5,0,34,0,0,19,52,38,38,35,35,53,33,23,51,
+54,54,51,50,22,21,20,2,7,21,33,21,33,53,54,18,53,52,38,35,34,6,21,17,35,217,
+15,43,49,6,1,16,25,9,48,134,112,158,192,106,99,1,182,253,170,74,81,97,106,
+112,121,191,3,34,65,41,23,79,154,88,85,199,170,124,254,235,147,9,103,58,172,
+1,73,101,115,127,168,151,253,185,0,1,0,102,255,237,4,110,3,242,0,38,0,0,1,
+17,20,22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,22,22,51,51,21,33,39,35,
+6,6,35,34,38,53,17,52,38,38,35,35,53,1,139,102,105,109,119,14,36,47,6,1,38,
+15,43,49,6,254,240,25,9,47,138,109,158,171,13,36,48,6,3,242,253,134,136,132,
+166,143,1,132,70,35,20,80,252,222,65,41,23,79,154,85,88,193,183,1,191,70,
+35,21,80,0,0,1,0,102,253,225,5,11,6,20,0,38,0,0,5,52,54,55,55,35,6,6,35,34,
+38,53,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,38,35,35,53,33,
+17,33,21,33,3,66,2,2,5,9,49,147,109,156,168,13,37,47,6,1,38,93,105,112,124,
+13,37,47,6,1,43,1,9,254,55,17,28,61,26,55,92,78,183,186,1,195,69,36,22,80,
+253,126,136,122,156,150,3,165,69,36,22,80,248,52,103,0,1,0,102,255,239,6,
+214,4,5,0,49,0,0,19,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,51,23,
+51,54,54,51,50,22,21,17,20,22,22,51,51,21,33,17,52,38,35,34,6,21,17,35,39,
+35,6,6,35,34,38,205,13,37,47,6,1,38,93,105,115,121,160,25,9,47,138,109,158,
+171,13,36,48,6,254,219,102,105,110,118,154,25,9,49,147,109,156,168,1,96,1,
+195,69,36,22,80,253,126,136,122,153,151,2,84,154,85,88,193,183,254,65,70,
+35,21,80,2,122,136,132,169,150,253,185,153,92,78,183,0,1,0,104,253,225,4,
+112,4,5,0,38,0,0,33,17,52,38,35,34,6,21,17,20,22,22,51,51,21,33,17,52,38,
+38,35,35,53,33,23,51,54,54,51,50,22,21,17,20,22,22,51,51,21,3,75,102,105,
+110,118,14,36,47,6,254,218,15,43,49,6,1,16,25,9,47,138,109,158,171,13,36,
+48,6,2,122,136,132,169,150,252,103,70,34,21,80,5,65,65,41,23,79,154,85,88,
+193,183,254,65,70,35,21,80,0,0,2,0,127,253,215,3,230,4,5,0,34,0,46,0,0,37,
+52,54,55,55,35,6,35,34,2,17,16,18,51,50,23,51,55,51,17,20,2,35,34,38,53,52,
+54,51,20,22,51,50,54,53,16,38,35,34,6,21,20,22,51,50,54,53,3,41,2,1,5,9,91,
+197,192,201,198,195,197,91,12,34,144,244,221,149,226,107,83,102,102,125,131,
+131,127,118,114,111,123,126,130,27,21,49,17,55,187,1,5,1,4,1,10,1,4,166,147,
+251,246,249,254,232,146,94,62,81,132,142,190,193,3,11,184,195,206,200,192,
+181,213,0,1,0,104,0,0,2,191,3,242,0,15,0,0,19,52,38,38,35,35,53,33,17,50,
+54,53,53,51,21,33,207,13,37,47,6,1,38,113,112,80,254,16,3,35,69,36,22,80,
+252,117,14,83,6,206,0,1,0,102,253,225,6,218,6,20,0,69,0,0,5,52,54,55,55,35,
+6,6,35,34,38,53,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,38,
+35,35,53,33,17,20,6,7,7,51,54,54,51,50,22,21,17,20,22,22,51,51,21,33,17,52,
+38,35,34,6,21,17,20,22,22,51,51,21,33,3,66,2,2,5,9,49,147,109,156,168,13,
+37,47,6,1,38,93,105,113,128,15,43,49,6,1,49,2,2,4,9,47,138,109,158,171,13,
+36,48,6,254,219,102,105,110,118,15,43,49,6,254,207,17,28,61,26,55,92,78,183,
+186,1,195,69,36,22,80,253,126,136,122,162,144,3,165,65,41,23,78,253,242,28,
+61,26,59,85,88,193,183,254,65,70,35,21,80,2,122,136,132,169,150,252,105,65,
+41,23,78,0,0,2,0,67,253,225,4,67,4,5,0,40,0,52,0,0,23,35,53,51,17,52,38,38,
+35,35,53,33,23,51,54,51,50,18,17,16,2,35,34,39,35,23,22,22,21,21,33,21,33,
+21,20,22,22,51,51,21,33,0,38,35,34,6,21,20,22,51,50,54,53,220,153,153,15,
+43,49,6,1,11,24,12,91,197,195,198,201,192,197,91,9,5,2,2,2,121,253,135,13,
+37,47,6,254,219,2,168,114,118,127,131,131,125,123,111,250,103,3,181,65,41,
+23,79,147,166,254,252,254,246,254,252,254,251,187,55,26,61,28,146,103,86,
+69,36,22,80,4,226,195,184,215,215,179,192,200,0,0,2,0,127,255,238,3,255,4,
+5,0,11,0,23,0,0,4,2,17,16,18,51,50,18,17,16,2,35,54,54,53,52,38,35,34,6,21,
+20,22,51,1,93,222,223,228,226,219,226,224,137,122,124,133,133,124,125,134,
+18,1,5,1,8,1,2,1,8,254,251,254,251,254,248,254,251,80,220,225,223,219,219,
+223,224,221,0,0,3,0,88,253,225,4,225,6,30,0,34,0,41,0,48,0,0,33,38,36,53,
+52,54,51,22,22,23,17,38,38,53,52,36,51,50,22,23,17,4,22,21,20,0,7,17,20,22,
+22,51,51,21,33,17,34,6,21,20,22,23,19,54,54,53,52,38,39,2,67,201,254,222,
+89,59,9,194,140,243,204,1,44,225,21,41,29,1,15,230,254,215,204,13,38,47,6,
+254,239,108,148,125,131,169,126,164,134,156,11,163,118,53,88,132,191,17,2,
+234,66,176,129,161,195,5,5,253,112,73,208,151,188,254,249,17,254,176,69,35,
+23,80,7,209,141,100,101,128,40,252,169,17,198,134,127,174,48,0,0,1,0,94,255,
+239,5,37,6,20,0,34,0,0,19,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,
+52,38,38,35,35,53,33,17,33,21,33,39,35,6,6,35,34,38,197,13,37,47,6,1,38,93,
+105,115,121,13,37,47,6,1,37,1,49,254,55,25,9,49,147,109,156,168,1,96,3,229,
+69,36,22,80,251,92,136,122,153,151,1,133,69,36,22,80,252,117,103,153,92,78,
+183,0,2,0,187,255,227,1,167,4,21,0,11,0,23,0,0,36,22,21,20,6,35,34,38,53,
+52,54,51,18,22,21,20,6,35,34,38,53,52,54,51,1,104,63,63,57,55,61,59,57,60,
+60,63,57,56,60,58,58,227,65,61,61,69,67,63,61,65,3,50,66,63,60,68,68,60,63,
+66,0,1,0,123,1,158,3,50,2,180,0,12,0,0,1,20,22,51,50,54,55,23,6,35,34,38,
+53,1,37,66,76,81,174,100,28,203,217,135,140,2,180,70,75,25,26,80,104,131,
+147,0,0,1,0,102,255,239,9,19,6,30,0,101,0,0,19,17,52,38,38,35,35,53,33,17,
+20,22,51,50,54,53,17,52,38,39,39,38,38,53,52,54,51,50,4,23,6,6,21,20,22,23,
+21,6,2,21,20,22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,22,51,51,21,33,
+39,35,6,6,35,34,38,53,52,18,55,38,38,53,52,54,55,38,38,35,34,6,21,20,22,22,
+21,17,20,22,51,51,21,33,39,35,6,6,35,34,38,205,13,37,47,6,1,38,93,105,115,
+121,29,26,27,13,16,170,127,65,1,38,197,14,23,87,107,69,111,125,113,109,117,
+13,37,47,6,1,37,53,61,6,254,240,25,9,46,139,110,166,207,142,58,100,90,7,4,
+77,238,55,57,60,92,45,53,61,6,254,240,25,9,49,147,109,156,168,1,96,1,195,
+69,36,22,80,253,126,136,122,153,151,1,155,89,142,61,63,30,58,32,115,151,53,
+66,31,70,36,60,87,31,24,156,254,114,147,151,146,153,151,1,133,69,36,22,80,
+252,219,85,41,79,153,87,83,228,190,164,1,165,90,30,116,96,14,46,14,27,59,
+68,63,51,174,157,85,253,93,85,41,79,153,92,78,183,0,1,0,102,255,238,9,13,
+6,30,0,85,0,0,19,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,39,
+39,38,38,53,52,54,51,50,4,23,17,33,21,33,17,20,22,51,50,54,53,53,51,17,20,
+22,51,51,21,33,39,35,6,6,35,34,38,53,17,38,39,39,38,38,35,34,6,21,20,22,22,
+21,17,20,22,51,51,21,33,39,35,6,6,35,34,38,205,13,37,47,6,1,38,93,105,115,
+121,29,26,27,13,16,170,127,75,1,70,155,2,233,253,23,93,105,115,122,190,52,
+62,6,254,240,25,9,46,143,117,157,167,17,29,64,51,175,45,57,60,92,45,53,61,
+6,254,240,25,9,49,147,109,156,168,1,96,1,195,69,36,22,80,253,126,136,122,
+153,151,1,155,89,142,61,63,30,58,32,115,151,72,47,254,75,103,253,228,136,
+122,153,151,231,254,73,84,42,79,153,86,85,189,187,4,10,6,9,18,15,38,68,63,
+51,174,157,85,253,93,85,41,79,153,92,78,183,0,1,0,102,253,225,9,5,6,30,0,
+95,0,0,19,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,39,39,38,
+38,53,52,54,51,50,4,23,17,20,6,7,7,51,54,54,51,50,22,21,17,20,22,22,51,51,
+21,33,17,52,38,35,34,6,21,17,20,22,22,51,51,21,33,17,38,39,39,38,39,39,38,
+38,35,34,6,21,20,22,22,21,17,20,22,51,51,21,33,39,35,6,6,35,34,38,205,13,
+37,47,6,1,38,93,105,115,121,29,26,27,13,16,170,127,74,1,80,156,2,2,4,9,47,
+138,109,158,171,13,36,48,6,254,219,102,105,110,118,14,36,47,6,254,218,17,
+29,66,36,40,77,38,65,22,57,60,92,45,53,61,6,254,240,25,9,49,147,109,156,168,
+1,96,1,195,69,36,22,80,253,126,136,122,153,151,1,155,89,142,61,63,30,58,32,
+115,151,72,47,254,95,28,61,26,59,85,88,193,183,254,65,70,35,21,80,2,122,136,
+132,169,150,252,103,70,34,21,80,7,143,6,9,18,10,9,17,8,9,68,63,51,174,157,
+85,253,93,85,41,79,153,92,78,183,0,1,0,102,253,225,9,19,6,30,0,90,0,0,1,34,
+6,21,17,33,21,33,17,52,55,35,6,6,35,34,38,53,17,52,38,38,35,35,53,33,17,20,
+22,51,50,17,17,52,54,51,50,22,23,6,21,20,22,23,21,6,2,6,21,20,22,51,50,54,
+53,17,52,38,38,35,35,53,33,17,20,22,22,51,51,21,33,39,35,6,6,35,34,38,53,
+52,54,18,55,38,38,53,52,54,55,38,38,4,131,72,62,1,11,254,59,9,10,49,145,111,
+157,167,17,42,38,6,1,38,93,105,236,158,160,60,176,188,37,87,107,43,92,45,
+125,113,109,117,17,42,38,6,1,37,21,49,44,6,254,240,25,9,46,139,110,168,205,
+51,107,42,100,90,15,2,52,114,5,198,81,83,249,38,103,2,14,71,99,91,79,182,
+187,1,195,71,40,16,80,253,126,136,122,1,41,3,134,125,132,46,73,74,63,60,87,
+31,24,96,254,233,232,94,151,146,152,152,1,133,71,40,16,80,252,219,61,45,20,
+79,153,87,83,228,190,95,236,1,23,65,30,113,89,42,58,8,23,39,0,1,0,102,253,
+225,11,91,6,30,0,126,0,0,1,20,6,7,7,51,54,54,51,50,22,21,20,15,2,20,7,20,
+22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,22,51,51,21,33,39,35,6,6,35,
+34,38,53,52,63,2,52,55,52,35,34,6,21,17,20,22,22,51,51,21,33,17,38,39,39,
+38,39,39,38,38,35,34,6,21,20,22,22,21,17,20,22,51,51,21,33,39,35,6,6,35,34,
+38,53,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,39,39,38,38,53,
+52,54,51,50,4,23,6,46,2,2,4,9,47,135,92,151,169,1,2,10,1,93,105,115,121,13,
+37,47,6,1,37,53,61,6,254,240,25,9,49,147,109,156,168,1,10,2,1,197,97,111,
+14,36,47,6,254,218,17,29,66,36,40,77,38,65,22,57,60,92,45,53,61,6,254,240,
+25,9,49,147,109,156,168,13,37,47,6,1,38,93,105,115,121,29,26,27,13,16,170,
+127,74,1,80,156,4,6,28,61,26,59,85,88,182,174,10,24,54,183,24,10,136,122,
+153,151,1,133,69,36,22,80,252,219,85,41,79,153,92,78,183,186,10,24,181,54,
+23,10,248,171,148,252,103,70,34,21,80,7,143,6,9,18,10,9,17,8,9,68,63,51,174,
+157,85,253,93,85,41,79,153,92,78,183,186,1,195,69,36,22,80,253,126,136,122,
+153,151,1,155,89,142,61,63,30,58,32,115,151,72,47,0,0,1,0,133,0,0,5,131,5,
+101,0,39,0,0,1,33,53,33,53,33,53,33,53,52,38,35,34,6,21,21,35,53,52,36,51,
+32,4,21,21,33,21,33,21,33,21,33,21,20,22,22,51,51,21,33,3,175,254,251,1,5,
+254,251,1,5,157,145,141,160,207,1,10,234,1,1,1,4,1,5,254,251,1,5,254,251,
+13,37,47,6,254,202,1,156,91,129,91,220,163,165,172,148,227,217,213,227,227,
+235,196,91,129,91,205,69,36,22,80,0,255,255,0,250,0,0,10,226,5,202,0,38,0,
+27,0,0,0,7,0,37,5,238,0,0,255,255,0,104,0,0,7,150,4,5,0,38,0,72,0,0,0,7,0,
+82,4,215,0,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,
+0,38,0,94,0,3,0,1,4,9,0,2,0,14,0,132,0,3,0,1,4,9,0,3,0,76,0,146,0,3,0,1,4,
+9,0,4,0,38,0,94,0,3,0,1,4,9,0,5,0,30,0,222,0,3,0,1,4,9,0,6,0,34,0,252,0,3,
+0,1,4,9,0,7,0,68,1,30,0,3,0,1,4,9,0,8,0,42,1,98,0,3,0,1,4,9,0,9,0,40,1,140,
+0,3,0,1,4,9,0,10,0,96,1,180,0,3,0,1,4,9,0,11,0,62,2,20,0,3,0,1,4,9,0,12,0,
+60,2,82,0,3,0,1,4,9,0,13,2,150,2,142,0,3,0,1,4,9,0,14,0,52,5,36,0,67,0,111,
+0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,52,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,
+0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,
+0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,
+0,105,0,102,0,32,0,65,0,114,0,109,0,101,0,110,0,105,0,97,0,110,0,82,0,101,
+0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,
+116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,65,0,114,0,109,0,101,0,
+110,0,105,0,97,0,110,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,50,0,
+46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,101,0,114,0,105,
+0,102,0,65,0,114,0,109,0,101,0,110,0,105,0,97,0,110,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,
+105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,
+0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,
+0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,
+0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,
+0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,
+0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,
+46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,
+105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,
+97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,
+101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,1,2,0,2,0,3,1,
+3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,
+19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,
+1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,
+1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,
+1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,
+1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,
+1,94,1,95,1,96,4,110,117,108,108,7,117,110,105,48,53,51,49,7,117,110,105,
+48,53,51,50,7,117,110,105,48,53,51,51,7,117,110,105,48,53,51,52,7,117,110,
+105,48,53,51,53,7,117,110,105,48,53,51,54,7,117,110,105,48,53,51,55,7,117,
+110,105,48,53,51,56,7,117,110,105,48,53,51,57,7,117,110,105,48,53,51,65,7,
+117,110,105,48,53,51,66,7,117,110,105,48,53,51,67,7,117,110,105,48,53,51,
+68,7,117,110,105,48,53,51,69,7,117,110,105,48,53,51,70,7,117,110,105,48,53,
+52,48,7,117,110,105,48,53,52,49,7,117,110,105,48,53,52,50,7,117,110,105,48,
+53,52,51,7,117,110,105,48,53,52,52,7,117,110,105,48,53,52,53,7,117,110,105,
+48,53,52,54,7,117,110,105,48,53,52,55,7,117,110,105,48,53,52,56,7,117,110,
+105,48,53,52,57,7,117,110,105,48,53,52,65,7,117,110,105,48,53,52,66,7,117,
+110,105,48,53,52,67,7,117,110,105,48,53,52,68,7,117,110,105,48,53,52,69,7,
+117,110,105,48,53,52,70,7,117,110,105,48,53,53,48,7,117,110,105,48,53,53,
+49,7,117,110,105,48,53,53,50,7,117,110,105,48,53,53,51,7,117,110,105,48,53,
+53,52,7,117,110,105,48,53,53,53,7,117,110,105,48,53,53,54,7,117,110,105,48,
+53,53,57,7,117,110,105,48,53,53,65,7,117,110,105,48,53,53,66,7,117,110,105,
+48,53,53,67,7,117,110,105,48,53,53,68,7,117,110,105,48,53,53,69,7,117,110,
+105,48,53,53,70,7,117,110,105,48,53,54,49,7,117,110,105,48,53,54,50,7,117,
+110,105,48,53,54,51,7,117,110,105,48,53,54,52,7,117,110,105,48,53,54,53,7,
+117,110,105,48,53,54,54,7,117,110,105,48,53,54,55,7,117,110,105,48,53,54,
+56,7,117,110,105,48,53,54,57,7,117,110,105,48,53,54,65,7,117,110,105,48,53,
+54,66,7,117,110,105,48,53,54,67,7,117,110,105,48,53,54,68,7,117,110,105,48,
+53,54,69,7,117,110,105,48,53,54,70,7,117,110,105,48,53,55,48,7,117,110,105,
+48,53,55,49,7,117,110,105,48,53,55,50,7,117,110,105,48,53,55,51,7,117,110,
+105,48,53,55,52,7,117,110,105,48,53,55,53,7,117,110,105,48,53,55,54,7,117,
+110,105,48,53,55,55,7,117,110,105,48,53,55,56,7,117,110,105,48,53,55,57,7,
+117,110,105,48,53,55,65,7,117,110,105,48,53,55,66,7,117,110,105,48,53,55,
+67,7,117,110,105,48,53,55,68,7,117,110,105,48,53,55,69,7,117,110,105,48,53,
+55,70,7,117,110,105,48,53,56,48,7,117,110,105,48,53,56,49,7,117,110,105,48,
+53,56,50,7,117,110,105,48,53,56,51,7,117,110,105,48,53,56,52,7,117,110,105,
+48,53,56,53,7,117,110,105,48,53,56,54,7,117,110,105,48,53,56,55,7,117,110,
+105,48,53,56,57,7,117,110,105,48,53,56,65,7,117,110,105,70,66,49,51,7,117,
+110,105,70,66,49,52,7,117,110,105,70,66,49,53,7,117,110,105,70,66,49,54,7,
+117,110,105,70,66,49,55,7,117,110,105,48,53,56,70,15,117,110,105,48,53,52,
+56,95,117,110,105,48,53,53,50,15,117,110,105,48,53,55,56,95,117,110,105,48,
+53,56,50,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,0,0,2,0,1,0,
+0,0,97,0,1,0,0,0,1,0,0,0,10,0,30,0,44,0,1,97,114,109,110,0,8,0,4,0,0,0,0,
+255,255,0,1,0,0,0,1,107,101,114,110,0,8,0,0,0,1,0,0,0,1,0,4,0,2,0,0,0,2,0,
+10,1,52,0,1,4,190,0,4,0,0,0,11,0,32,0,102,0,140,0,166,0,192,0,198,0,216,0,
+230,1,0,1,22,1,36,0,17,0,4,255,226,0,6,255,121,0,7,255,131,0,8,255,226,0,
+17,255,216,0,18,255,131,0,21,255,131,0,23,255,226,0,25,255,204,0,26,255,204,
+0,28,255,201,0,29,255,141,0,32,255,226,0,33,255,184,0,38,255,206,0,40,255,
+206,0,95,255,131,0,9,0,6,255,131,0,7,255,131,0,18,255,121,0,21,255,131,0,
+29,255,196,0,33,255,121,0,38,255,236,0,40,255,236,0,95,255,131,0,6,0,6,255,
+131,0,7,255,131,0,18,255,164,0,21,255,131,0,33,255,211,0,95,255,131,0,6,0,
+6,255,131,0,7,255,131,0,18,255,174,0,21,255,131,0,33,255,211,0,95,255,131,
+0,1,0,6,255,176,0,4,0,44,253,173,0,45,253,172,0,47,252,179,0,73,0,60,0,3,
+0,44,253,173,0,45,253,172,0,47,252,179,0,6,0,69,0,80,0,71,0,80,0,73,0,230,
+0,75,0,80,0,81,0,40,0,84,0,80,0,5,0,69,0,30,0,71,0,30,0,73,0,200,0,75,0,30,
+0,84,0,50,0,3,0,44,253,173,0,45,253,172,0,47,252,181,0,1,0,6,255,196,0,2,
+3,174,0,4,0,0,3,246,4,156,0,18,0,25,0,0,253,181,252,174,253,172,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,253,173,252,174,253,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,200,0,30,0,30,
+0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,253,173,252,179,253,172,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,0,0,0,0,0,0,
+0,0,0,0,255,176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,253,191,253,198,253,172,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,241,255,241,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,246,255,236,255,241,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,255,226,255,236,
+255,234,255,211,255,196,255,236,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,131,0,0,0,0,255,216,
+255,176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,231,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,0,11,0,4,0,15,0,21,0,33,0,52,0,56,0,59,0,60,0,66,0,85,0,87,0,1,0,34,0,
+10,0,13,0,19,0,23,0,37,0,41,0,49,0,53,0,54,0,55,0,59,0,61,0,63,0,67,0,68,
+0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,80,0,82,0,83,0,90,0,91,0,92,
+0,93,0,94,0,96,0,97,0,2,0,27,0,10,0,10,0,13,0,13,0,13,0,12,0,19,0,19,0,14,
+0,23,0,23,0,15,0,37,0,37,0,16,0,41,0,41,0,17,0,53,0,53,0,1,0,54,0,54,0,2,
+0,55,0,55,0,3,0,59,0,59,0,4,0,63,0,63,0,5,0,67,0,67,0,6,0,68,0,68,0,7,0,71,
+0,71,0,8,0,72,0,72,0,4,0,73,0,73,0,9,0,74,0,74,0,5,0,75,0,75,0,8,0,76,0,76,
+0,10,0,78,0,78,0,2,0,80,0,80,0,4,0,82,0,82,0,11,0,83,0,83,0,4,0,91,0,91,0,
+1,0,92,0,92,0,4,0,96,0,96,0,16,0,97,0,97,0,11,0,1,0,4,0,82,0,18,0,0,0,11,
+0,0,0,18,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,24,0,12,0,23,0,0,0,0,0,0,0,18,
+0,22,0,13,0,14,0,0,0,15,0,0,0,0,0,0,0,18,0,20,0,0,0,0,0,0,0,0,0,17,0,16,0,
+21,0,0,0,0,0,0,0,1,0,3,0,0,0,2,0,0,0,0,0,0,0,9,0,0,0,0,0,9,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,9,0,0,0,0,0,10,0,0,0,0,0,0,0,4,0,0,0,7,0,0,0,5,0,0,0,6,0,
+0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,8,0,9,0,0,0,1,0,0,0,10,0,30,0,44,0,1,97,114,
+109,110,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,108,105,103,97,0,8,0,0,0,1,0,
+0,0,1,0,4,0,4,0,0,0,1,0,8,0,1,0,78,0,4,0,14,0,24,0,58,0,68,0,1,0,4,0,96,0,
+2,0,37,0,4,0,10,0,16,0,22,0,28,0,91,0,2,0,53,0,92,0,2,0,59,0,94,0,2,0,61,
+0,90,0,2,0,70,0,1,0,4,0,97,0,2,0,82,0,1,0,4,0,93,0,2,0,70,0,1,0,4,0,27,0,
+68,0,72,0,78,0,0,};
+#endif
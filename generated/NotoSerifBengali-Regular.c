@@ -0,0 +1,5165 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifBengali_Regular_ttf_size = 125676;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifBengali_Regular_ttf");
+asm(".type fz_font_NotoSerifBengali_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifBengali_Regular_ttf, 125676");
+asm(".balign 64");
+asm("fz_font_NotoSerifBengali_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifBengali-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifBengali_Regular_ttf_size = 125676;
+const char fz_font_NotoSerifBengali_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,3,225,3,220,0,1,169,252,0,0,0,52,
+71,80,79,83,185,31,26,62,0,1,170,48,0,0,37,162,71,83,85,66,141,195,197,38,
+0,1,207,212,0,0,27,24,79,83,47,50,121,77,105,72,0,0,1,104,0,0,0,96,99,109,
+97,112,6,36,18,161,0,0,11,0,0,0,1,134,103,97,115,112,0,7,0,7,0,1,169,240,
+0,0,0,12,103,108,121,102,243,214,202,171,0,0,17,40,0,1,123,62,104,101,97,
+100,11,144,67,215,0,0,0,236,0,0,0,54,104,104,101,97,13,231,4,27,0,0,1,36,
+0,0,0,36,104,109,116,120,109,55,166,41,0,0,1,200,0,0,9,56,108,111,99,97,134,
+130,227,167,0,0,12,136,0,0,4,160,109,97,120,112,2,104,1,59,0,0,1,72,0,0,0,
+32,110,97,109,101,141,51,185,232,0,1,140,104,0,0,6,10,112,111,115,116,111,
+223,247,130,0,1,146,116,0,0,23,123,0,1,0,0,0,1,2,143,210,189,237,35,95,15,
+60,245,0,11,8,0,0,0,0,0,211,79,225,235,0,0,0,0,211,100,21,33,251,226,253,
+23,9,219,8,39,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,39,252,217,0,0,9,159,251,
+226,251,85,9,219,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,77,0,1,0,0,2,79,0,194,
+0,16,0,119,0,5,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,5,27,1,144,0,5,0,0,
+5,51,4,205,0,0,0,153,5,51,4,205,0,0,2,205,0,50,2,252,0,0,2,2,5,2,4,5,4,2,
+2,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,39,252,
+217,0,0,8,39,3,39,0,0,0,1,0,0,0,0,4,250,4,250,0,0,0,32,0,3,4,205,0,193,0,
+0,0,0,2,20,0,0,2,20,0,0,6,26,255,196,7,224,255,196,3,175,255,197,4,239,255,
+196,4,242,255,197,5,113,255,197,5,198,0,63,5,198,0,63,4,50,0,88,4,98,0,88,
+5,51,0,87,5,201,0,87,5,124,0,36,6,90,0,36,1,201,255,159,1,201,255,196,1,201,
+252,67,0,0,253,77,0,0,253,99,0,0,253,80,0,0,253,80,0,0,253,180,0,0,252,201,
+2,140,255,196,2,140,255,25,6,71,255,196,6,71,255,196,1,201,253,220,5,149,
+255,197,4,240,0,60,4,166,0,34,4,35,255,197,4,242,255,197,3,218,255,197,4,
+148,255,197,6,105,255,197,5,76,255,197,7,41,0,87,3,251,255,197,4,73,255,197,
+4,242,255,197,3,250,255,197,4,87,0,75,4,226,255,196,4,121,0,66,4,16,255,196,
+4,35,0,54,4,47,255,196,5,5,0,34,5,217,255,197,4,29,255,197,5,10,255,197,4,
+135,255,197,4,87,255,197,4,29,255,197,5,44,255,197,4,184,255,197,4,87,255,
+197,4,188,255,197,3,175,255,197,4,54,255,197,4,29,255,197,6,13,255,197,6,
+249,255,197,3,20,0,122,0,0,253,159,3,17,0,129,0,0,254,239,0,0,253,114,3,175,
+255,196,4,187,0,118,3,142,0,109,3,249,0,102,4,227,0,47,3,169,0,69,4,114,0,
+104,4,249,0,35,3,170,0,72,4,148,0,22,4,62,0,82,3,180,0,70,3,194,0,141,3,204,
+0,15,3,242,0,59,4,201,0,79,4,155,0,70,2,16,0,25,4,91,0,28,3,141,0,130,4,128,
+0,127,2,115,0,72,3,63,1,104,4,133,1,104,4,121,0,121,0,0,0,0,0,0,255,213,0,
+0,255,33,4,193,0,98,5,149,255,197,4,240,0,60,4,166,0,34,4,35,255,197,4,242,
+255,197,3,218,255,197,4,148,255,197,6,105,255,197,5,76,255,197,7,41,0,87,
+3,251,255,197,4,73,255,197,4,242,255,197,3,250,255,197,4,87,0,75,4,226,255,
+196,4,121,0,66,4,16,255,196,4,35,0,54,4,47,255,196,5,5,0,34,5,217,255,197,
+5,10,255,197,4,135,255,197,4,87,255,197,5,44,255,197,4,184,255,197,4,87,255,
+197,4,188,255,197,3,175,255,197,4,54,255,197,4,29,255,197,0,0,254,209,0,0,
+252,248,2,72,255,197,0,0,251,226,4,174,0,132,4,218,255,196,4,240,0,60,2,220,
+0,34,4,35,255,197,4,51,255,197,3,167,255,197,4,148,255,197,6,105,255,197,
+5,76,255,197,7,41,0,87,3,212,255,197,4,73,255,197,4,81,255,197,3,202,255,
+197,2,136,0,75,4,226,255,196,4,121,0,66,3,198,255,196,4,35,0,54,2,101,255,
+196,3,64,0,34,5,217,255,197,3,189,255,197,5,10,255,197,4,59,255,197,4,87,
+255,197,4,29,255,197,3,101,255,197,2,238,255,197,3,174,255,197,4,126,255,
+197,3,175,255,197,4,54,255,197,4,29,255,197,6,13,255,197,6,249,255,197,5,
+149,255,197,4,240,0,60,4,166,0,34,4,35,255,197,4,242,255,197,3,218,255,197,
+4,148,255,197,6,105,255,197,5,76,255,197,7,41,0,87,3,251,255,197,4,73,255,
+197,4,242,255,197,3,250,255,197,4,87,0,75,4,226,255,196,4,121,0,66,4,16,255,
+196,4,35,0,54,4,47,255,196,5,5,0,34,5,217,255,197,5,10,255,197,4,135,255,
+197,4,87,255,197,5,44,255,197,4,184,255,197,4,87,255,197,4,188,255,197,3,
+175,255,197,4,54,255,197,4,29,255,197,4,218,255,197,4,103,0,45,4,132,0,40,
+4,40,255,197,4,51,255,197,3,167,255,197,4,116,255,196,5,242,255,196,5,4,255,
+197,6,189,0,84,3,222,255,197,3,183,255,197,4,81,255,197,3,221,255,197,4,47,
+0,75,4,40,255,197,4,121,0,66,3,235,255,196,7,65,0,54,4,47,255,196,4,209,0,
+12,5,200,255,197,7,59,255,197,4,154,255,197,4,59,255,197,4,66,255,197,3,172,
+255,197,4,80,255,197,4,152,255,197,3,178,255,196,4,126,255,197,4,2,255,197,
+3,172,255,197,3,175,255,197,6,21,255,197,6,249,255,197,4,80,255,197,3,226,
+255,197,4,67,255,197,6,192,255,197,4,183,0,93,4,198,0,106,4,130,255,197,4,
+105,255,197,4,16,255,197,4,162,255,197,6,127,255,197,5,94,255,197,6,164,0,
+73,4,23,255,197,4,9,255,197,4,113,255,197,4,22,255,197,4,157,0,97,4,154,255,
+197,4,193,0,91,4,183,255,196,4,135,0,77,4,136,255,206,5,3,0,61,6,40,255,197,
+4,61,255,197,4,85,255,197,4,129,255,197,4,151,255,197,4,61,255,197,5,119,
+255,197,5,11,255,197,3,230,255,197,4,132,255,197,4,75,255,197,4,61,255,197,
+4,61,255,197,6,19,255,197,6,249,255,197,4,81,255,197,4,22,255,197,4,151,255,
+197,5,9,255,197,4,155,255,197,4,165,255,197,7,95,255,197,7,36,255,197,7,57,
+255,197,4,229,255,197,6,59,255,197,5,37,255,197,6,130,255,197,4,156,0,54,
+6,191,0,34,5,170,0,40,4,132,0,40,5,203,0,40,4,118,0,36,4,59,255,197,4,64,
+255,197,5,14,255,197,5,129,255,197,7,254,255,197,4,249,255,197,7,199,255,
+197,5,141,255,197,9,159,255,197,5,235,255,197,6,184,255,197,6,152,255,197,
+6,152,255,197,7,173,255,197,3,174,255,197,9,38,255,196,8,169,255,193,7,47,
+255,196,5,179,0,82,5,15,0,113,5,255,0,51,6,179,0,84,4,159,255,197,5,81,255,
+197,8,83,255,197,8,83,255,197,8,80,255,197,5,221,255,197,6,149,0,75,6,116,
+0,75,5,135,0,52,5,96,0,45,5,116,0,55,6,149,0,75,4,87,0,95,4,87,0,95,5,157,
+0,75,5,50,255,196,4,255,255,197,5,164,0,88,4,53,255,197,5,133,255,196,4,12,
+255,197,7,183,255,197,7,53,255,197,5,152,255,197,5,237,255,197,5,8,255,197,
+5,16,255,197,3,235,255,197,4,85,255,197,4,72,255,197,5,28,255,197,4,49,0,
+88,5,118,0,88,6,110,255,197,6,35,255,197,5,114,255,197,5,151,255,197,5,151,
+255,197,4,99,255,197,4,96,255,197,5,221,255,197,4,62,255,197,4,98,255,197,
+6,12,255,196,6,36,255,197,6,104,255,197,5,13,255,197,5,65,255,197,4,23,255,
+213,5,117,255,197,6,58,255,197,7,68,0,34,5,44,0,12,4,209,0,12,5,5,0,44,6,
+23,0,12,4,209,0,12,7,73,255,197,6,59,255,197,5,218,255,197,6,122,255,197,
+5,148,255,197,6,12,255,197,4,210,255,197,4,109,255,207,3,237,255,197,4,147,
+255,197,4,114,255,197,6,106,255,197,4,107,255,197,7,244,255,198,7,243,255,
+197,7,139,255,196,4,77,255,197,4,147,255,207,4,128,255,197,5,143,255,197,
+4,101,255,197,7,190,255,197,5,134,255,197,4,210,255,197,6,254,255,196,6,212,
+255,196,6,139,255,196,6,139,255,196,5,104,255,197,6,242,255,196,6,23,255,
+197,4,249,255,197,8,166,255,196,5,228,255,196,4,196,255,196,6,216,255,197,
+7,172,255,197,4,205,255,197,4,143,255,197,5,253,255,197,4,132,255,197,4,59,
+255,197,7,112,255,197,3,172,255,197,4,77,255,197,4,214,255,197,6,65,255,197,
+7,163,255,197,7,73,255,197,5,73,255,197,4,236,255,197,8,8,255,197,5,210,255,
+197,6,252,255,197,6,208,255,197,4,173,255,197,4,176,255,197,5,238,255,197,
+4,184,255,197,4,120,255,197,8,49,255,197,8,61,255,197,7,181,255,196,5,236,
+255,197,4,145,255,197,4,46,255,197,6,13,255,197,5,209,255,197,3,251,255,197,
+6,21,255,197,7,121,255,197,5,194,255,196,5,167,255,196,5,224,255,196,6,100,
+255,196,6,110,255,196,6,104,255,196,7,26,255,196,5,118,255,196,6,22,255,196,
+5,203,255,160,5,167,255,124,5,224,255,181,6,100,255,197,6,111,255,197,6,104,
+255,197,7,26,255,197,8,94,0,75,8,61,0,75,8,55,255,197,7,236,255,197,9,13,
+0,34,8,4,255,197,8,199,255,196,8,157,255,196,5,125,255,82,6,22,255,197,8,
+197,255,197,8,153,255,197,6,19,255,197,5,128,255,197,5,210,255,197,7,80,0,
+52,7,59,255,197,6,159,255,197,5,158,0,25,6,60,255,196,6,3,255,196,4,62,255,
+197,4,187,255,196,5,34,255,196,5,238,255,197,6,152,0,106,6,136,255,197,6,
+146,0,91,6,173,255,196,6,89,0,75,6,14,255,196,6,11,255,197,6,220,255,196,
+6,90,255,196,6,62,255,196,6,8,255,197,5,124,255,196,6,37,0,106,6,31,0,91,
+6,30,255,196,5,230,0,75,5,183,255,197,6,106,255,196,5,180,255,196,5,149,255,
+196,5,79,255,196,5,217,255,197,5,167,255,197,5,224,255,197,6,100,255,197,
+6,110,255,197,6,114,255,197,8,104,0,75,8,61,0,75,8,65,255,197,7,236,255,197,
+9,13,0,34,8,4,255,197,8,209,255,196,8,157,255,196,5,127,255,197,6,22,255,
+197,8,197,255,197,8,153,255,197,2,140,0,83,2,140,255,25,1,201,255,196,4,242,
+255,197,4,84,255,197,0,0,253,169,1,201,255,196,1,201,255,196,1,201,252,67,
+1,201,252,67,1,201,252,67,2,170,0,211,3,68,0,117,4,121,0,51,7,43,0,92,1,195,
+0,117,2,197,0,117,2,197,0,66,4,0,0,84,4,121,0,133,2,0,0,61,2,123,0,51,2,0,
+0,127,2,78,0,0,4,121,0,92,4,121,0,135,4,121,0,104,4,121,0,119,4,121,0,35,
+4,121,0,113,4,121,0,125,4,121,0,121,4,121,0,94,4,121,0,104,2,74,0,166,2,74,
+0,98,4,121,0,133,4,121,0,133,4,121,0,133,4,100,0,188,2,225,0,205,2,78,0,0,
+2,225,0,76,4,121,0,104,3,172,255,246,3,109,0,102,4,121,1,254,3,109,0,102,
+4,121,0,111,2,123,0,51,4,0,255,246,8,0,255,246,2,0,0,115,2,0,0,61,3,154,0,
+115,3,154,0,61,6,221,0,164,4,121,0,145,0,133,0,133,0,0,0,1,0,3,0,1,0,0,0,
+12,0,4,1,122,0,0,0,82,0,64,0,5,0,18,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,
+160,0,173,0,215,0,247,9,101,9,131,9,139,9,140,9,144,9,148,9,168,9,176,9,178,
+9,185,9,189,9,196,9,200,9,206,9,215,9,221,9,227,9,239,9,241,9,251,32,13,32,
+20,32,25,32,29,32,38,32,185,34,18,37,204,254,255,255,255,0,0,0,0,0,13,0,32,
+0,37,0,39,0,91,0,123,0,160,0,173,0,215,0,247,9,100,9,128,9,133,9,140,9,143,
+9,147,9,149,9,170,9,178,9,182,9,188,9,190,9,199,9,203,9,215,9,220,9,223,9,
+230,9,240,9,242,32,11,32,19,32,24,32,28,32,38,32,185,34,18,37,204,254,255,
+255,255,0,1,255,245,0,0,1,252,1,251,1,224,1,197,255,99,1,151,1,117,1,86,246,
+251,0,0,246,127,246,128,246,127,246,125,246,139,246,138,246,137,246,134,246,
+140,246,84,246,84,0,0,246,72,246,150,0,0,246,100,246,80,246,99,224,87,226,
+50,226,47,226,45,226,37,223,168,224,60,218,153,1,99,0,1,0,0,0,0,0,78,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,50,0,0,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,3,2,30,2,31,2,32,0,84,0,69,0,68,0,70,0,29,0,30,0,71,0,138,0,126,0,11,
+0,13,0,25,0,26,0,0,0,0,0,21,0,21,0,21,0,21,0,100,0,202,1,41,1,157,1,249,2,
+95,2,180,3,27,3,104,3,230,4,55,4,171,4,253,5,115,5,150,5,196,5,253,6,48,6,
+100,6,129,6,175,6,236,6,249,7,38,7,114,7,130,7,146,7,197,8,9,8,73,8,135,8,
+196,9,32,9,86,9,161,9,251,10,56,10,190,11,18,11,98,11,157,11,209,12,12,12,
+70,12,141,12,187,12,252,13,41,13,109,13,184,13,227,14,32,14,101,14,153,14,
+165,14,237,15,55,15,110,15,183,15,247,16,47,16,103,16,227,17,99,17,155,17,
+198,18,17,18,36,18,58,18,120,18,170,18,237,19,43,19,94,19,171,19,236,20,44,
+20,100,20,175,20,254,21,57,21,80,21,143,21,164,21,214,22,29,22,66,22,121,
+22,159,22,205,22,234,22,250,23,6,23,61,23,61,23,74,23,104,24,112,24,124,24,
+136,24,148,24,160,24,172,24,184,24,196,24,208,24,220,24,232,24,244,25,0,25,
+12,25,24,25,36,25,48,25,60,25,72,25,84,25,96,25,108,25,120,25,132,25,144,
+25,156,25,168,25,180,25,192,25,204,25,216,25,228,25,240,26,0,26,33,26,84,
+26,135,26,209,27,18,27,30,27,79,27,91,27,180,27,236,27,248,28,4,28,16,28,
+28,28,109,28,121,28,179,28,229,29,19,29,31,29,43,29,87,29,99,29,138,29,192,
+29,204,29,244,30,0,30,68,30,80,30,96,30,163,30,223,31,20,31,76,31,88,31,100,
+31,112,31,124,31,136,31,152,31,168,31,184,31,200,31,216,31,232,31,248,32,
+8,32,24,32,40,32,56,32,72,32,88,32,104,32,120,32,136,32,152,32,168,32,184,
+32,200,32,216,32,232,32,248,33,8,33,24,33,40,33,56,33,72,33,88,33,104,33,
+120,33,136,33,222,34,49,34,135,34,210,35,65,35,140,35,242,36,87,36,165,37,
+62,37,163,38,8,38,87,38,158,38,238,39,61,39,155,39,215,40,57,40,118,40,205,
+41,42,41,117,41,205,42,44,42,114,42,190,43,17,43,110,43,183,44,7,44,94,44,
+160,44,233,45,116,46,10,46,111,46,204,47,36,47,152,47,249,48,90,48,185,49,
+59,49,156,50,16,50,147,50,243,51,151,52,17,52,138,52,240,53,77,53,172,54,
+3,54,113,54,188,55,33,55,111,55,213,56,70,56,145,56,228,57,82,57,171,58,7,
+58,115,58,225,59,55,59,153,60,4,60,87,60,175,61,74,61,243,62,103,62,211,63,
+61,63,169,64,54,64,232,65,93,65,228,66,129,66,220,67,59,67,174,68,28,68,132,
+68,219,69,69,69,159,69,252,70,104,70,187,71,35,71,149,72,46,72,186,73,38,
+73,175,74,52,75,1,75,92,75,200,76,80,76,231,77,136,77,219,78,115,79,26,79,
+143,80,0,80,166,81,71,81,238,82,87,82,204,83,63,83,75,83,179,84,19,84,136,
+85,35,85,150,85,251,86,141,86,227,87,67,87,150,87,238,88,69,88,175,89,9,89,
+99,89,190,90,45,90,143,90,236,91,43,91,120,91,199,92,40,92,103,92,188,93,
+40,93,113,93,205,94,43,94,149,95,35,95,136,95,212,96,79,96,176,97,39,97,167,
+98,14,98,158,98,226,99,49,99,148,99,230,100,91,100,157,100,227,101,67,101,
+194,102,42,102,132,102,244,103,82,103,195,104,58,104,186,105,53,105,162,105,
+227,106,74,106,155,106,240,107,71,107,190,108,43,108,141,108,240,109,110,
+110,14,110,139,111,10,111,127,112,5,112,110,112,232,113,98,113,204,114,58,
+114,189,115,103,115,203,116,96,116,201,117,40,117,151,118,7,118,136,118,231,
+119,93,119,194,120,60,120,171,121,11,121,114,121,234,122,71,122,221,123,92,
+123,254,124,107,124,214,125,68,125,178,126,14,126,116,127,14,127,124,128,
+4,128,177,129,20,129,142,130,11,130,112,130,199,131,56,131,201,132,58,132,
+149,133,2,133,108,133,203,134,56,134,173,135,70,135,220,136,77,136,209,137,
+104,138,14,138,221,139,98,139,246,140,144,141,80,141,192,142,67,142,217,143,
+126,144,75,144,210,145,100,145,246,146,175,147,53,147,224,148,123,149,30,
+149,190,150,134,151,32,151,222,152,130,153,76,153,203,154,98,155,13,155,175,
+156,68,156,224,157,71,157,232,158,94,158,180,159,49,159,171,160,8,160,139,
+161,3,161,152,162,5,162,141,162,251,163,110,163,254,164,129,165,16,165,106,
+165,189,166,53,166,189,167,29,167,154,168,1,168,134,168,251,169,74,169,157,
+170,2,170,123,171,7,171,162,172,101,172,227,173,105,174,23,174,145,175,49,
+175,194,176,90,176,239,177,172,178,58,178,236,179,133,180,68,180,111,180,
+185,180,230,180,242,181,55,181,107,181,191,181,242,182,81,182,150,183,1,183,
+25,183,46,183,100,183,181,183,195,183,229,184,6,184,46,184,71,184,101,184,
+115,184,131,184,144,184,191,184,229,185,23,185,85,185,132,185,186,185,246,
+186,13,186,91,186,156,186,182,186,224,186,245,187,9,187,31,187,80,187,106,
+187,120,187,145,187,165,187,179,187,232,187,245,188,41,188,84,188,92,188,
+106,188,120,188,151,188,182,188,238,189,37,189,76,189,109,189,145,189,159,
+0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,33,33,17,33,3,17,33,17,4,10,252,183,
+3,73,104,253,135,5,182,250,178,4,230,251,26,0,0,2,255,196,255,232,6,85,4,
+250,0,37,0,50,0,0,5,35,39,38,39,6,35,34,0,3,55,18,0,51,50,54,53,52,38,39,
+22,21,20,6,35,34,38,53,52,54,55,38,39,33,39,33,23,35,35,33,22,23,30,2,21,
+20,7,22,22,23,5,109,4,103,117,163,104,212,231,254,199,108,82,95,1,8,192,143,
+151,97,78,4,96,88,87,111,122,93,63,85,254,46,69,6,76,69,232,110,253,139,53,
+37,105,148,75,18,64,124,41,24,74,193,110,162,1,137,1,142,25,254,195,254,208,
+130,129,99,130,8,25,32,89,98,109,87,95,109,6,79,44,107,107,52,80,23,140,186,
+93,66,65,53,150,78,0,2,255,196,255,232,8,28,5,159,0,55,0,68,0,0,5,35,39,17,
+38,38,35,35,17,35,39,38,39,6,35,34,0,3,55,18,0,51,50,54,53,52,38,39,22,21,
+20,6,35,34,38,53,52,54,55,38,39,33,39,33,50,22,23,38,53,53,51,23,21,51,23,
+35,33,33,22,23,30,2,21,20,7,22,22,23,7,51,8,103,19,107,65,152,4,103,117,163,
+104,212,231,254,199,108,82,95,1,8,192,143,151,97,78,4,96,88,87,111,122,93,
+63,85,254,46,69,6,90,48,95,30,7,8,101,166,69,233,253,204,253,139,53,37,105,
+148,75,18,64,124,41,24,75,3,167,78,103,251,89,74,193,110,162,1,137,1,142,
+25,254,195,254,208,130,129,99,130,8,25,32,89,98,109,87,95,109,6,79,44,107,
+80,80,39,103,183,71,94,107,52,80,23,140,186,93,66,65,53,150,78,0,1,255,197,
+255,172,3,236,7,86,0,65,0,0,5,38,36,37,39,22,51,50,54,53,52,38,35,34,7,21,
+20,6,35,34,38,53,52,54,55,38,39,35,39,33,38,38,35,34,7,6,35,34,38,53,52,55,
+23,7,20,22,51,50,55,54,51,50,22,23,51,23,33,22,23,22,22,21,16,5,22,23,3,144,
+206,254,168,254,255,41,155,174,166,186,114,122,31,27,80,101,73,94,125,103,
+47,101,173,69,3,8,15,72,76,37,76,102,68,149,143,7,85,2,84,132,53,80,72,34,
+127,134,21,128,70,253,107,46,30,198,234,254,226,215,194,84,194,164,29,198,
+51,130,115,91,111,4,16,95,103,90,72,82,100,13,78,53,107,105,96,9,12,168,154,
+52,50,9,51,103,85,10,8,169,205,107,48,79,4,207,174,254,253,93,108,211,0,1,
+255,196,255,231,5,42,7,86,0,81,0,0,5,2,17,52,55,6,7,6,6,35,34,38,39,55,22,
+51,50,62,2,53,52,38,35,35,21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,38,
+38,35,34,7,6,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,23,
+33,22,23,22,22,23,54,55,23,6,6,21,20,22,23,4,33,140,51,167,146,80,113,67,
+86,142,64,74,70,102,48,75,89,46,89,103,3,79,89,67,84,110,89,47,99,137,69,
+4,30,18,87,91,45,92,15,138,70,180,171,7,85,2,103,159,66,102,92,45,153,162,
+24,170,69,252,6,47,30,138,172,14,117,176,167,66,59,46,52,25,1,13,1,0,153,
+134,163,210,115,77,126,153,34,142,39,112,115,51,83,104,10,90,91,82,71,70,
+96,12,77,53,107,105,96,9,1,11,168,154,52,50,9,51,106,82,10,8,170,204,107,
+49,79,11,168,136,150,134,151,108,204,113,115,198,111,0,0,1,255,197,0,73,5,
+46,7,86,0,61,0,0,1,33,17,20,51,50,54,55,22,21,20,6,35,32,0,3,55,18,0,51,50,
+54,53,52,39,6,6,35,34,38,38,53,17,33,39,33,38,38,35,34,7,6,6,35,34,38,53,
+52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,5,46,253,46,36,55,148,137,202,
+224,187,254,254,254,151,117,82,124,1,37,216,153,178,56,103,160,91,58,79,44,
+254,32,69,4,29,18,87,91,45,92,15,138,70,180,171,7,85,2,103,159,66,102,92,
+45,153,162,24,174,4,143,254,97,51,117,149,209,248,200,237,1,189,1,209,25,
+254,109,254,172,155,134,111,72,107,92,54,106,100,1,113,107,105,96,9,1,11,
+168,154,52,50,9,51,106,82,10,8,170,204,0,0,1,255,197,0,76,5,173,7,86,0,67,
+0,0,1,33,17,20,51,50,54,55,22,21,20,6,35,32,0,3,55,18,18,23,38,2,3,55,18,
+18,22,51,50,54,53,52,39,6,35,34,38,38,53,17,33,39,33,38,38,35,34,7,6,35,34,
+38,53,52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,5,173,253,46,41,53,149,
+133,202,217,216,254,221,254,105,116,82,88,206,126,95,128,69,82,80,124,195,
+151,137,167,55,189,166,58,79,44,253,161,69,4,156,18,91,92,73,174,187,106,
+181,175,7,85,2,108,159,88,140,153,104,154,166,24,174,4,143,254,97,51,122,
+144,209,248,204,230,1,190,1,205,25,254,226,254,158,79,98,1,64,1,20,25,254,
+244,254,216,179,161,128,108,75,199,54,106,100,1,113,107,104,97,10,11,164,
+158,52,50,9,51,109,79,9,9,174,200,0,2,0,63,255,232,6,2,5,159,0,48,0,53,0,
+0,37,35,39,38,39,17,35,39,38,36,39,39,54,36,55,38,39,6,35,34,38,53,52,54,
+51,50,22,21,20,7,54,55,22,23,55,17,51,23,17,22,22,23,17,51,23,21,51,23,35,
+1,4,7,4,23,5,25,4,103,87,132,4,103,117,254,175,192,79,175,1,31,157,34,63,
+178,209,99,120,73,69,59,68,14,135,182,150,51,33,9,101,64,114,37,8,101,166,
+69,233,254,76,254,225,233,1,54,210,175,74,148,110,253,237,74,153,145,10,220,
+109,155,64,103,69,188,102,87,64,79,70,57,40,31,37,228,146,209,12,1,237,71,
+253,49,55,141,68,4,30,71,94,107,254,106,105,159,70,250,0,2,0,63,254,70,6,
+2,5,159,0,59,0,64,0,0,1,38,36,39,39,54,55,38,37,39,54,36,55,38,39,6,35,34,
+38,53,52,54,51,50,22,21,20,7,54,55,22,23,55,17,51,23,17,22,22,23,17,51,23,
+21,51,23,35,17,35,39,38,39,17,35,39,6,7,22,4,23,1,4,7,4,23,4,85,137,254,220,
+178,68,163,195,217,254,163,79,175,1,31,157,34,63,178,209,99,120,73,69,59,
+68,14,135,182,150,51,33,9,101,64,114,37,8,101,166,69,233,4,103,87,132,4,67,
+185,117,160,1,12,120,254,227,254,225,233,1,54,210,254,70,111,113,22,167,91,
+77,202,17,220,109,155,64,103,69,188,102,87,64,79,70,57,40,31,37,228,146,209,
+12,1,237,71,253,49,55,141,68,4,30,71,94,107,252,32,74,148,110,253,237,48,
+58,61,20,154,110,4,116,105,159,70,250,0,1,0,88,255,248,3,214,4,251,0,54,0,
+0,33,54,53,52,38,35,34,7,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,50,
+54,54,53,52,38,39,39,38,38,53,52,54,51,50,22,21,20,6,35,35,22,22,23,23,4,
+17,20,6,6,7,2,53,6,93,115,75,41,8,55,75,71,69,71,86,163,129,170,164,10,35,
+75,51,129,127,226,165,133,81,76,62,78,70,62,1,14,76,84,240,1,43,116,184,103,
+48,57,152,222,47,72,58,59,83,95,79,121,156,238,180,41,84,61,110,131,49,87,
+63,162,118,74,102,75,54,58,67,26,41,33,95,119,254,226,130,187,102,10,0,1,
+0,88,253,181,3,232,4,251,0,93,0,0,1,54,53,52,35,34,7,51,50,22,21,20,6,35,
+34,38,53,52,54,51,50,22,23,50,54,53,52,38,39,46,2,53,55,54,53,52,38,35,34,
+7,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,50,54,54,53,52,38,39,39,
+38,38,53,52,54,51,50,22,21,20,6,35,35,22,22,23,23,4,17,20,6,7,23,22,22,21,
+20,6,7,2,204,5,114,25,19,1,35,48,49,44,42,60,91,75,88,113,9,40,61,67,112,
+117,43,28,3,6,93,115,75,41,8,55,75,71,69,71,86,163,129,170,164,10,35,75,51,
+129,127,226,165,133,81,76,62,78,70,62,1,14,76,84,240,1,43,177,153,152,98,
+98,147,128,253,186,35,32,191,13,47,39,38,57,68,55,76,97,119,97,66,45,47,62,
+40,41,24,46,34,33,48,57,152,222,47,72,58,59,83,95,79,121,156,238,180,41,84,
+61,110,131,49,87,63,162,118,74,102,75,54,58,67,26,41,33,95,119,254,226,157,
+222,37,54,35,110,97,127,158,11,0,1,0,87,255,233,4,134,5,15,0,57,0,0,5,35,
+39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,
+38,53,17,52,38,38,35,34,6,6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,
+50,22,22,21,4,134,8,103,50,93,74,71,118,109,82,161,202,26,89,20,146,124,92,
+100,77,58,90,122,64,8,26,53,45,64,140,112,23,39,66,75,82,101,95,97,120,135,
+224,126,76,109,55,23,74,74,54,14,15,191,211,113,107,21,85,80,128,120,12,9,
+101,112,95,117,2,104,98,81,31,109,164,77,43,89,65,77,94,132,111,111,235,154,
+58,129,119,0,0,1,0,87,255,233,5,175,7,188,0,84,0,0,5,35,39,38,38,35,34,7,
+6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,38,53,17,52,38,
+38,35,34,6,6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,22,21,21,
+54,53,52,38,38,39,46,3,53,52,55,23,6,21,20,22,23,30,2,21,20,2,7,4,134,8,103,
+50,93,74,71,118,109,82,161,202,26,89,20,146,124,92,100,77,58,90,122,64,8,
+26,53,45,64,140,112,23,39,66,75,82,101,95,97,120,134,224,127,76,109,55,182,
+55,123,156,178,145,91,41,53,89,27,161,216,151,184,77,168,129,23,74,74,54,
+14,15,191,211,113,107,21,85,80,128,120,12,9,101,112,95,117,2,84,98,81,31,
+101,155,74,43,89,65,77,94,132,111,111,224,145,58,129,119,191,155,200,66,87,
+60,31,38,64,89,107,71,98,136,28,69,55,98,128,43,31,107,143,108,160,254,246,
+86,0,0,1,0,36,0,64,5,26,5,15,0,55,0,0,1,50,22,21,20,6,35,34,38,53,52,54,36,
+51,50,22,21,20,7,22,22,21,20,6,6,35,32,0,3,55,18,18,4,51,50,54,53,52,39,6,
+35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,7,2,83,60,74,91,75,78,100,152,
+1,2,148,151,182,58,42,46,94,197,148,254,200,254,114,121,84,90,209,1,5,179,
+162,185,51,72,86,74,82,85,72,49,42,82,93,87,232,188,3,180,82,64,75,81,104,
+100,99,209,137,169,137,129,120,51,138,74,111,187,115,1,221,2,0,25,254,200,
+254,155,150,129,111,90,53,85,77,67,65,79,15,88,104,79,85,240,0,0,1,0,36,0,
+64,6,38,7,188,0,82,0,0,1,54,54,53,52,38,38,39,38,39,38,38,53,52,55,23,6,21,
+20,22,23,30,2,21,20,2,7,22,21,20,6,6,35,32,0,3,55,18,18,4,51,50,54,53,52,
+39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,7,55,50,22,21,20,6,35,34,
+38,53,52,54,36,51,50,22,21,20,7,4,203,108,124,51,115,166,156,62,112,127,53,
+89,27,161,216,151,184,77,168,136,36,94,197,148,254,200,254,114,121,84,90,
+209,1,5,179,162,185,51,72,86,74,82,85,72,49,42,82,93,87,232,188,24,60,74,
+91,75,78,100,152,1,2,148,151,182,58,2,216,77,210,118,64,85,60,34,35,23,41,
+146,125,98,136,28,78,46,98,128,43,31,107,143,108,164,254,246,85,82,96,111,
+187,115,1,221,2,0,25,254,200,254,155,150,129,111,90,53,85,77,67,65,79,15,
+88,104,79,85,240,2,82,64,75,81,104,100,99,209,137,169,137,129,120,0,1,255,
+159,255,232,2,5,5,159,0,21,0,0,5,35,39,17,38,38,35,35,39,51,50,22,23,38,53,
+53,51,23,21,51,23,35,1,28,8,103,19,103,69,10,69,104,48,95,30,7,8,101,166,
+69,233,24,75,3,167,74,107,107,80,80,39,103,183,71,94,107,0,1,255,196,255,
+232,5,2,7,86,0,27,0,0,5,35,39,17,35,39,51,38,39,54,54,51,50,22,22,23,7,38,
+36,35,34,6,7,22,23,51,23,35,1,28,7,104,163,70,229,111,55,131,247,154,123,
+245,233,146,49,238,254,228,145,137,187,73,44,58,176,70,233,24,75,4,92,107,
+103,64,241,196,115,187,141,54,196,148,184,138,63,66,107,0,0,1,252,67,255,
+232,2,5,7,86,0,37,0,0,5,35,39,17,35,39,51,2,33,34,6,21,20,22,51,51,50,22,
+23,35,46,2,35,35,34,38,38,53,52,54,51,32,0,19,51,23,35,1,28,8,103,163,70,
+233,30,253,142,183,200,56,73,213,182,154,16,90,9,31,72,71,106,163,160,83,
+250,204,1,103,1,149,23,163,70,233,24,75,4,92,107,1,207,57,53,28,30,132,168,
+60,61,27,40,92,76,114,139,254,216,254,204,107,0,2,253,77,253,178,1,12,0,139,
+0,22,0,31,0,0,19,38,38,39,6,6,35,34,38,53,52,54,51,50,23,52,39,55,22,23,22,
+22,23,37,50,55,38,35,34,21,20,22,216,117,164,80,22,146,130,111,137,131,126,
+89,88,10,80,44,6,106,195,104,253,17,180,37,84,95,160,67,253,178,124,146,44,
+123,141,134,109,109,123,30,169,52,13,107,178,62,200,136,117,201,23,118,52,
+54,0,1,253,99,253,139,0,187,0,140,0,33,0,0,19,38,39,6,6,35,34,38,38,53,52,
+54,51,50,23,52,39,55,22,22,21,7,38,35,34,21,20,22,51,50,55,22,22,23,142,144,
+92,53,150,84,71,133,84,131,126,68,81,10,79,24,27,110,72,98,160,88,74,181,
+114,55,142,116,253,139,117,62,44,46,58,111,74,109,123,27,162,56,14,58,166,
+81,67,29,118,52,54,131,41,130,108,0,0,1,253,80,254,29,0,32,0,141,0,12,0,0,
+3,38,36,39,39,54,37,23,6,7,22,4,23,13,137,254,220,178,68,216,1,3,56,226,133,
+160,1,12,120,254,29,111,113,22,167,120,91,141,65,71,20,154,110,0,0,1,253,
+80,253,71,0,52,0,141,0,24,0,0,19,38,38,39,39,54,55,38,39,39,54,37,23,6,7,
+22,4,23,7,38,39,6,7,22,23,2,118,251,152,68,66,83,90,92,68,216,1,3,56,226,
+133,160,1,12,120,45,114,116,94,78,237,230,253,71,79,85,19,167,37,40,21,12,
+167,120,91,141,65,71,20,154,110,63,91,54,35,40,30,184,0,1,253,180,253,181,
+255,216,0,8,0,41,0,0,1,54,53,52,35,34,7,51,50,22,21,20,6,35,34,38,53,52,54,
+51,50,22,23,50,54,53,52,38,39,46,2,53,55,55,23,22,22,21,20,6,7,254,188,5,
+114,25,19,1,35,48,49,44,42,60,91,75,88,113,9,40,61,67,112,114,46,28,3,78,
+161,98,98,149,126,253,186,35,32,191,13,47,39,38,57,68,55,76,97,119,97,66,
+45,47,63,39,38,27,46,34,33,8,57,35,110,97,127,157,12,0,255,255,252,201,253,
+23,1,84,0,8,2,39,0,25,255,21,255,98,0,7,0,25,1,124,0,0,0,1,255,196,0,0,2,
+200,4,250,0,26,0,0,1,35,0,17,20,22,23,38,53,52,54,51,50,22,21,20,6,35,34,
+38,2,53,16,55,33,39,33,2,200,134,254,126,75,91,6,83,64,72,90,98,88,106,180,
+106,233,254,207,71,2,189,4,143,254,250,254,134,129,181,63,20,23,66,76,96,
+75,73,95,150,1,8,164,1,90,243,107,0,0,1,255,25,0,0,2,200,7,86,0,51,0,0,1,
+35,0,17,20,22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,2,53,16,55,33,39,33,
+38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,2,
+200,134,254,126,75,91,6,83,64,72,90,98,88,106,180,106,233,254,207,71,2,55,
+15,72,76,37,76,102,68,149,143,7,85,2,84,132,53,80,72,34,127,134,21,45,4,143,
+254,250,254,134,129,181,63,20,23,66,76,96,75,73,95,150,1,8,164,1,90,243,107,
+105,96,9,12,168,154,52,50,9,51,103,85,10,8,169,205,255,255,255,196,255,232,
+6,131,5,159,0,34,0,27,0,0,0,35,0,72,5,102,3,122,0,3,0,18,4,126,0,0,255,255,
+255,196,255,232,6,130,7,86,0,34,0,27,0,0,0,35,0,72,5,102,3,122,0,3,0,31,4,
+126,0,0,0,1,253,220,255,232,2,4,7,86,0,33,0,0,5,35,39,17,35,39,51,38,38,35,
+34,7,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,23,35,1,28,
+7,104,163,70,250,15,72,76,37,76,102,68,149,143,7,85,2,84,132,53,80,72,34,
+127,134,21,168,69,232,24,75,4,92,107,105,96,9,12,168,154,52,50,9,51,103,85,
+10,8,169,205,107,0,0,2,255,197,255,232,5,208,4,250,0,36,0,42,0,0,5,35,39,
+38,36,39,39,54,36,55,53,33,39,33,23,33,21,30,2,21,20,6,35,34,38,53,52,54,
+51,50,22,23,53,52,38,39,7,4,7,22,22,23,3,94,4,103,114,254,211,204,84,188,
+1,60,196,253,26,69,5,198,69,253,142,138,226,129,89,94,71,85,69,63,47,63,12,
+220,188,110,254,245,232,154,248,97,24,74,189,216,26,232,124,162,71,97,107,
+107,97,16,141,210,114,111,132,83,66,62,81,44,35,20,134,165,7,8,96,163,67,
+200,169,0,0,1,0,60,255,232,5,44,5,159,0,42,0,0,5,35,39,38,36,39,39,23,50,
+54,53,52,39,6,35,34,38,53,52,54,51,50,22,21,20,7,54,55,22,21,20,6,7,22,22,
+23,17,51,23,21,51,23,35,4,67,4,103,113,254,189,222,82,40,191,231,34,182,211,
+99,120,73,69,59,68,14,135,182,172,145,134,149,223,83,8,101,166,69,233,24,
+74,187,216,26,229,1,138,114,68,47,194,102,87,64,79,70,57,40,31,37,228,165,
+202,126,172,39,57,188,147,4,232,71,94,107,0,0,1,0,34,255,232,4,226,5,159,
+0,41,0,0,5,35,39,17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,36,53,52,38,
+35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,21,51,23,35,3,249,8,103,111,162,
+107,66,115,72,62,75,114,138,127,148,122,1,35,64,55,131,133,139,123,215,124,
+108,176,135,9,8,101,166,69,233,24,75,3,3,170,130,58,80,20,131,109,108,193,
+110,185,114,141,50,57,106,137,188,169,141,211,78,133,1,36,71,94,107,0,2,255,
+197,255,232,4,94,4,250,0,18,0,36,0,0,5,35,39,38,36,39,39,54,55,38,38,53,52,
+55,35,39,33,23,35,3,6,7,22,4,23,17,33,34,6,21,20,22,51,50,55,54,55,3,118,
+4,103,125,254,184,193,79,82,142,93,117,36,94,69,4,84,69,232,222,245,163,136,
+1,26,102,254,126,73,95,75,62,44,50,73,72,24,74,186,213,19,220,50,80,31,118,
+85,68,47,107,107,254,162,113,98,37,235,158,3,223,74,73,59,74,22,37,29,0,0,
+2,255,197,0,73,4,158,5,15,0,49,0,61,0,0,1,20,51,50,54,55,22,22,21,20,6,35,
+32,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,53,53,38,39,33,39,33,22,22,
+23,54,54,51,50,22,21,20,6,35,34,39,55,54,53,52,38,35,34,6,7,22,51,50,2,92,
+49,72,167,134,73,83,224,187,254,254,254,151,117,82,124,1,37,216,153,178,26,
+83,183,79,103,117,128,86,254,246,69,1,123,38,75,58,9,126,114,111,121,121,
+149,51,47,231,43,59,47,71,88,7,40,43,103,2,189,51,113,153,86,209,111,200,
+237,1,189,1,209,25,254,109,254,172,155,134,72,60,86,102,127,122,161,76,183,
+107,83,116,39,124,135,120,101,89,132,11,157,34,51,41,47,99,100,8,0,2,255,
+197,0,73,4,22,4,250,0,19,0,30,0,0,1,6,2,6,35,34,38,38,53,17,35,39,33,23,33,
+21,18,33,50,55,1,20,22,22,51,50,18,55,38,38,39,3,149,13,141,226,134,76,109,
+58,150,69,4,12,69,252,249,158,1,58,27,41,253,228,26,56,46,116,184,34,145,
+228,89,2,225,181,254,208,179,56,122,121,3,27,107,107,48,254,250,4,254,54,
+100,78,33,1,15,217,18,154,155,0,0,2,255,197,255,104,4,208,4,250,0,38,0,47,
+0,0,5,38,36,37,39,22,51,50,54,53,52,38,39,6,6,35,34,38,38,53,17,35,39,33,
+23,33,21,22,22,51,51,22,22,21,20,6,7,22,23,1,20,22,51,50,54,55,38,39,4,11,
+206,254,168,254,255,41,156,174,237,208,130,113,67,197,131,61,84,45,124,69,
+4,198,69,252,37,49,164,80,110,193,227,192,182,219,184,252,172,36,43,78,113,
+32,190,112,152,194,164,29,193,47,158,129,108,109,6,203,171,47,92,106,1,149,
+107,107,14,60,59,4,218,176,170,206,28,112,204,3,59,66,45,137,120,36,145,0,
+0,1,255,197,255,231,6,164,4,250,0,58,0,0,5,2,17,52,55,38,38,39,6,6,21,20,
+22,51,50,54,55,22,22,21,20,6,35,34,0,3,55,18,0,51,50,54,53,52,39,6,35,34,
+38,53,52,55,6,35,33,39,33,23,33,22,33,55,23,6,6,21,20,22,23,5,172,140,34,
+139,226,76,177,189,69,54,80,143,76,87,69,212,184,239,254,180,115,82,121,1,
+15,201,142,164,20,142,182,110,131,217,99,198,254,171,69,6,154,69,253,52,139,
+1,20,32,117,62,51,46,52,25,1,13,1,0,141,125,37,185,142,87,172,95,60,65,122,
+114,79,176,101,191,223,1,165,1,189,25,254,132,254,194,132,113,62,53,138,148,
+121,209,162,5,107,107,217,1,137,106,166,119,109,196,110,0,0,2,255,197,255,
+232,5,136,5,159,0,28,0,34,0,0,37,35,39,38,39,17,35,39,2,37,39,54,36,55,53,
+33,39,33,17,22,22,23,17,51,23,21,51,23,35,1,4,7,22,22,23,4,159,4,103,87,132,
+4,103,204,254,100,82,171,1,72,196,253,31,69,3,148,64,114,37,8,101,166,69,
+233,254,76,254,239,223,153,245,98,175,74,148,110,253,237,74,1,100,78,228,
+117,166,72,100,107,253,143,55,141,68,4,30,71,94,107,254,220,103,157,62,205,
+168,0,0,2,0,87,255,233,6,208,5,15,0,72,0,99,0,0,5,35,39,38,38,35,34,7,6,35,
+34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,38,53,17,52,38,38,35,
+34,6,6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,54,51,50,
+22,21,20,6,7,22,21,20,6,35,34,39,37,52,39,6,35,34,38,53,52,54,51,50,23,54,
+53,52,38,35,34,6,6,21,20,22,51,50,54,4,134,8,103,50,93,74,71,118,109,82,161,
+202,26,89,20,146,124,92,100,77,58,90,122,64,8,26,53,45,64,140,112,23,39,66,
+75,82,101,95,97,120,135,224,126,114,118,7,48,151,101,128,154,35,32,72,156,
+129,204,97,1,238,52,66,82,67,78,75,62,62,54,81,88,79,114,141,60,157,138,97,
+101,23,74,74,54,14,15,191,211,113,107,21,85,80,128,120,12,9,101,112,95,117,
+2,104,98,81,31,109,164,77,43,89,65,77,94,132,111,111,235,154,122,130,99,125,
+165,138,69,131,48,93,148,142,174,214,119,77,66,58,68,65,61,72,29,70,110,66,
+77,135,196,98,184,213,98,0,1,255,197,0,73,4,53,7,86,0,58,0,0,1,33,17,20,22,
+22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,
+35,39,33,38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,51,50,22,
+23,51,4,53,252,218,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,
+137,78,112,59,150,69,3,62,15,72,76,37,76,102,68,149,143,7,85,2,84,132,53,
+80,72,34,127,134,21,148,4,143,253,4,102,77,32,127,192,94,34,89,73,79,97,142,
+125,116,254,243,184,56,125,118,3,27,107,105,96,9,12,168,154,52,50,9,51,103,
+85,10,8,169,205,0,0,2,255,197,0,0,4,132,7,86,0,34,0,50,0,0,1,33,34,39,22,
+18,21,20,6,35,32,3,54,54,53,52,39,33,39,33,46,2,53,52,54,55,23,6,6,21,20,
+22,23,33,1,6,7,22,22,51,50,54,53,52,2,39,22,22,21,20,4,132,254,100,61,48,
+210,168,238,208,254,110,118,236,218,47,254,68,69,1,213,60,64,38,70,89,124,
+75,68,59,72,2,57,253,211,88,194,29,145,116,153,164,132,182,39,39,4,143,4,
+233,254,169,165,202,228,1,249,47,231,151,120,113,107,81,98,104,59,73,129,
+60,135,48,91,56,62,123,89,253,32,110,77,112,132,190,170,163,1,41,221,95,143,
+88,174,0,0,1,255,197,0,73,5,45,4,250,0,35,0,0,1,33,17,20,51,50,54,55,22,21,
+20,6,35,32,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,38,53,17,33,39,33,5,
+45,253,47,36,55,148,137,202,224,187,254,254,254,151,117,82,124,1,37,216,153,
+178,56,103,160,91,58,79,44,254,32,69,5,35,4,143,254,97,51,114,152,209,248,
+200,237,1,189,1,209,25,254,109,254,172,155,134,111,72,107,92,54,106,100,1,
+113,107,0,0,1,255,197,0,73,4,53,4,250,0,33,0,0,1,33,17,20,22,22,51,50,54,
+54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,35,39,33,4,
+53,252,218,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,
+112,59,150,69,4,43,4,143,253,4,102,77,32,127,192,94,34,89,73,79,97,142,125,
+116,254,243,184,56,125,118,3,27,107,0,1,0,75,255,232,4,147,5,159,0,40,0,0,
+5,35,39,17,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,
+52,54,51,50,22,23,38,53,17,51,23,21,51,23,35,3,170,8,103,105,191,118,108,
+131,91,1,86,66,75,82,100,91,79,141,87,179,139,114,193,136,9,8,101,166,69,
+233,24,75,2,217,169,144,112,92,131,29,21,66,78,83,71,80,90,87,166,114,153,
+198,169,228,78,136,1,78,71,94,107,0,0,2,255,196,0,97,5,30,4,250,0,3,0,34,
+0,0,1,33,39,33,1,18,0,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,
+50,22,22,21,20,6,35,34,0,3,5,30,250,235,69,5,21,251,156,115,1,33,215,151,
+176,127,106,19,93,90,98,115,136,123,144,207,104,226,190,253,254,166,117,4,
+143,107,254,245,254,138,254,171,158,146,125,151,1,44,57,88,96,117,98,108,
+129,147,228,118,206,244,1,176,1,197,0,0,1,0,66,255,232,4,180,5,159,0,48,0,
+0,5,35,39,38,36,39,39,22,51,50,54,54,53,52,38,35,34,7,22,22,21,20,6,6,35,
+34,38,53,52,54,54,51,50,22,22,21,20,6,7,22,22,23,17,51,23,21,51,23,35,3,203,
+4,103,113,254,189,222,82,11,29,140,190,92,102,93,37,45,31,33,34,66,46,70,
+91,60,123,89,90,158,98,145,134,149,223,83,8,101,166,69,233,24,74,187,216,
+26,229,1,68,115,73,80,94,13,22,65,35,36,62,38,89,78,66,109,66,84,164,114,
+126,172,39,57,188,147,4,232,71,94,107,0,1,255,196,255,231,4,76,4,250,0,25,
+0,0,5,2,17,52,55,6,1,39,17,35,39,33,23,33,17,20,7,54,37,23,6,6,21,20,22,23,
+3,83,140,52,240,254,228,100,129,70,4,66,70,252,174,4,252,1,25,180,66,59,46,
+52,25,1,13,1,0,159,143,157,254,218,66,2,238,107,107,254,132,100,75,252,156,
+163,108,204,113,115,198,111,0,2,0,54,255,232,4,95,5,15,0,34,0,39,0,0,5,35,
+39,38,36,39,39,54,55,38,38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,
+22,23,54,55,53,33,23,35,3,4,7,4,19,3,118,4,103,123,254,200,211,79,142,135,
+70,93,138,100,90,91,65,53,49,68,1,78,79,86,131,207,1,17,70,233,110,254,226,
+234,1,75,189,24,74,182,194,32,220,96,67,29,119,85,93,128,82,67,54,62,53,55,
+26,80,50,70,9,64,79,228,107,254,206,107,163,118,254,217,0,0,1,255,196,255,
+232,4,107,4,250,0,27,0,0,5,35,39,17,2,39,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,38,53,17,33,39,33,23,35,3,130,6,104,125,216,16,93,89,100,118,146,
+124,150,245,65,5,252,246,70,4,97,70,233,24,104,1,0,1,23,23,38,44,86,95,122,
+99,106,125,194,172,76,155,1,219,107,107,0,0,2,0,34,255,232,5,65,5,159,0,31,
+0,43,0,0,5,35,39,17,38,39,1,39,55,54,53,52,38,35,34,7,39,54,54,51,50,22,23,
+38,53,17,51,23,21,51,23,35,5,38,38,35,34,6,7,54,51,50,22,23,4,88,8,103,38,
+40,254,0,127,50,78,55,44,72,63,144,146,220,140,113,204,153,9,8,101,166,69,
+233,254,224,61,122,71,103,148,94,29,42,93,124,3,24,75,2,181,64,57,254,46,
+127,44,80,74,54,53,42,143,206,150,176,255,133,118,1,75,71,94,107,173,68,64,
+87,116,9,118,94,0,1,255,197,255,232,6,18,4,250,0,48,0,0,5,35,39,38,36,39,
+39,54,55,38,38,35,39,35,39,33,23,33,22,22,23,23,6,7,22,4,23,17,51,30,2,21,
+20,6,35,34,38,53,52,54,51,50,22,23,53,52,38,39,3,160,6,101,119,254,218,216,
+79,202,177,91,174,113,66,38,69,6,9,68,250,199,113,213,73,40,236,112,135,1,
+18,101,111,138,226,129,89,94,71,85,69,63,47,63,12,219,190,24,74,163,188,29,
+212,147,92,67,55,164,107,107,49,165,94,96,126,84,30,199,146,3,124,16,140,
+209,116,111,132,83,66,62,81,44,35,20,132,164,11,0,0,2,255,197,255,232,4,89,
+4,250,0,15,0,21,0,0,5,35,39,38,36,39,39,54,36,55,53,33,39,33,23,35,3,6,6,
+7,4,19,3,112,4,103,113,254,200,212,84,176,1,80,206,253,8,69,4,78,70,233,110,
+148,245,124,1,78,183,24,74,187,216,28,231,120,169,75,91,107,107,254,230,55,
+126,87,112,254,187,0,0,2,255,197,0,97,5,70,4,250,0,3,0,36,0,0,1,33,39,33,
+1,18,0,51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,55,22,
+21,20,6,35,32,0,3,5,70,250,196,69,5,60,251,116,122,1,38,229,163,178,70,90,
+184,118,103,127,94,73,66,84,15,122,158,214,229,202,254,246,254,160,123,4,
+143,107,254,245,254,127,254,182,153,142,116,80,99,92,120,101,72,93,85,70,
+39,29,53,199,206,254,210,240,1,168,1,205,0,2,255,197,255,232,4,195,4,250,
+0,29,0,44,0,0,5,35,39,53,38,39,6,6,35,34,38,53,52,54,51,50,23,55,52,38,39,
+38,38,53,55,35,39,33,23,35,1,22,22,23,38,53,17,33,21,20,22,23,22,22,21,3,
+218,6,104,102,148,21,109,91,93,115,123,105,35,30,4,87,107,138,104,1,49,69,
+4,184,70,233,254,170,74,123,40,5,253,138,69,90,137,103,24,104,128,199,64,
+79,96,110,96,94,110,6,36,75,86,39,50,89,70,22,107,107,253,239,47,162,101,
+132,107,2,88,6,44,80,50,77,150,101,0,2,255,197,255,232,4,145,4,250,0,17,0,
+28,0,0,5,35,39,38,36,39,39,54,55,38,38,35,39,35,39,33,23,35,1,6,7,22,4,23,
+17,33,22,22,23,3,170,6,101,117,254,207,217,79,202,177,91,174,113,66,38,69,
+4,136,68,231,254,230,236,112,137,1,24,103,253,157,113,213,73,24,74,161,189,
+30,212,147,92,67,55,164,107,107,254,108,126,84,30,208,153,3,237,49,165,94,
+255,255,255,197,255,232,4,89,4,250,2,38,0,54,0,0,0,7,0,72,3,96,1,124,0,1,
+255,197,255,232,5,104,4,250,0,50,0,0,5,35,39,17,38,35,34,6,21,39,38,38,35,
+34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,
+54,51,50,22,23,38,53,53,33,39,33,23,35,4,127,6,104,87,112,54,76,45,35,119,
+91,107,126,91,1,80,61,75,93,101,90,79,141,87,165,125,88,123,46,33,131,66,
+113,68,7,251,249,69,5,93,70,233,24,104,2,19,164,95,96,16,93,83,105,99,131,
+29,21,66,78,85,79,73,87,87,166,114,154,197,94,82,171,115,131,93,108,246,107,
+107,0,1,255,197,255,232,4,244,5,159,0,50,0,0,5,35,39,17,38,38,35,34,7,22,
+22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,38,38,35,35,39,51,50,22,23,
+54,54,51,50,22,22,23,39,17,51,23,21,51,23,35,4,11,8,102,92,99,53,84,82,118,
+120,81,71,69,100,20,18,99,73,67,84,125,139,57,102,71,95,69,159,79,112,90,
+72,118,65,59,95,81,57,3,8,100,165,70,233,24,75,3,68,151,93,98,62,157,84,79,
+78,86,86,81,91,85,72,86,178,63,59,51,107,59,102,94,81,68,115,100,148,1,30,
+71,94,107,0,0,3,255,197,255,232,4,145,4,250,0,17,0,22,0,30,0,0,5,35,39,38,
+36,39,39,54,55,38,38,35,39,35,39,33,23,35,35,33,22,0,23,21,38,39,6,7,22,4,
+23,3,170,6,101,117,254,207,217,79,164,196,97,161,101,66,38,69,4,136,68,231,
+110,253,156,141,1,82,133,129,81,200,109,138,1,25,100,24,74,161,189,30,212,
+120,107,69,65,164,107,107,64,254,234,158,106,120,62,109,81,30,201,149,0,2,
+255,197,255,232,4,248,4,250,0,34,0,47,0,0,5,35,39,17,38,38,35,34,6,6,7,6,
+6,35,34,38,39,55,22,22,51,50,54,55,38,38,35,34,7,39,35,39,33,23,35,35,33,
+22,22,23,54,54,51,50,22,23,38,53,4,15,6,104,50,53,34,31,43,57,42,67,119,86,
+81,140,65,74,40,71,55,62,89,48,10,133,139,43,54,63,48,69,4,237,70,233,110,
+253,133,117,139,10,37,83,44,58,104,52,9,24,104,2,43,69,47,26,93,99,158,119,
+132,153,34,75,67,116,125,181,162,10,160,107,107,26,181,159,80,47,98,96,80,
+109,0,1,255,197,255,172,3,236,4,250,0,40,0,0,5,38,36,37,39,22,51,50,54,53,
+52,38,35,34,7,21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,23,33,22,23,22,
+22,21,16,5,22,23,3,144,206,254,168,254,255,41,155,174,166,186,114,122,31,
+27,80,101,73,94,125,103,47,101,173,69,3,225,70,253,107,46,30,198,234,254,
+226,215,194,84,194,164,29,198,51,130,115,91,111,4,16,95,103,90,72,82,100,
+13,78,53,107,107,48,79,4,207,174,254,253,93,108,211,0,0,3,255,197,255,232,
+4,114,4,250,0,15,0,21,0,30,0,0,5,35,39,38,36,39,39,54,36,55,53,33,39,33,23,
+35,3,53,6,7,22,23,7,38,38,39,6,7,22,4,23,3,137,4,103,118,254,193,225,84,175,
+1,100,212,252,239,69,4,103,70,233,110,128,108,144,94,2,74,181,119,88,81,164,
+1,30,93,24,74,192,209,30,231,119,176,75,85,107,107,254,56,185,46,51,104,141,
+139,112,152,48,49,57,50,225,164,0,3,255,197,255,166,4,89,4,250,0,15,0,21,
+0,29,0,0,5,35,39,38,36,39,39,54,36,55,53,33,39,33,23,35,3,6,6,7,4,19,3,38,
+38,39,39,22,22,23,3,112,4,103,113,254,200,212,84,176,1,80,206,253,8,69,4,
+78,70,233,110,148,245,124,1,78,183,139,105,163,106,61,157,236,97,24,74,187,
+216,28,231,120,169,75,91,107,107,254,230,55,126,87,112,254,187,254,242,128,
+96,14,168,7,202,154,0,3,255,197,255,232,6,72,4,250,0,63,0,79,0,87,0,0,5,35,
+39,53,38,39,23,20,6,35,34,38,53,52,54,51,51,38,38,39,21,20,6,35,34,38,53,
+52,54,55,38,39,35,39,33,23,33,17,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,55,52,38,35,34,6,7,6,7,7,34,38,53,53,33,22,23,22,22,23,22,22,23,
+38,53,3,20,51,50,54,55,17,35,3,248,8,103,143,156,1,70,65,69,77,93,85,2,22,
+88,56,68,65,69,79,87,79,74,95,46,69,6,62,69,253,176,59,48,172,197,95,85,71,
+88,72,63,43,57,11,1,85,77,38,61,49,37,37,111,150,183,254,177,62,29,98,150,
+22,92,166,54,5,222,85,30,61,46,222,24,75,108,190,36,12,67,72,86,66,74,94,
+80,119,23,4,68,71,85,68,71,92,4,150,64,107,107,254,222,16,203,179,116,128,
+83,67,61,80,41,28,21,109,121,19,21,18,12,17,167,134,213,90,143,40,217,136,
+26,139,97,85,115,1,145,88,20,20,1,79,0,0,3,255,197,0,77,7,52,4,250,0,49,0,
+60,0,86,0,0,1,33,22,23,22,23,54,54,51,50,22,21,20,7,22,21,20,6,35,34,38,39,
+6,6,35,34,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,53,52,54,55,5,33,39,
+33,1,38,39,6,6,21,20,22,51,50,54,1,52,39,6,35,34,38,53,52,54,51,50,23,54,
+53,52,38,35,34,6,21,20,22,51,50,54,7,52,252,78,12,87,64,35,23,155,135,125,
+147,55,60,144,121,91,155,40,37,202,157,249,254,175,118,82,124,1,23,215,150,
+167,21,73,176,88,125,138,94,69,254,249,254,191,69,7,42,252,198,133,45,106,
+126,72,62,84,129,2,195,30,68,86,60,76,73,55,78,62,42,87,70,117,153,140,118,
+81,98,4,143,211,109,58,64,122,161,146,122,96,65,78,101,114,135,109,94,126,
+151,1,157,1,197,25,254,123,254,203,128,117,65,53,67,74,146,123,107,238,64,
+3,107,254,17,103,217,73,200,90,60,65,86,254,251,47,34,61,62,63,59,66,48,42,
+60,53,65,172,127,129,148,68,0,0,3,0,122,255,179,2,229,4,251,0,11,0,25,0,33,
+0,0,1,20,6,35,34,38,53,52,54,51,50,22,7,54,54,53,52,38,35,34,6,21,20,22,51,
+50,1,38,36,39,55,22,18,23,2,144,155,121,109,142,152,118,113,144,228,54,69,
+43,36,90,144,48,33,55,1,56,140,254,254,166,132,138,253,96,3,249,118,151,147,
+112,118,150,144,246,38,114,51,32,45,148,91,33,45,252,99,202,248,105,178,114,
+254,131,209,0,0,2,253,159,5,197,0,162,7,170,0,11,0,25,0,0,3,20,6,35,34,38,
+53,52,54,51,50,22,5,6,6,35,34,38,39,55,22,22,51,50,54,55,127,57,40,43,58,
+58,43,41,56,1,33,50,181,155,155,180,50,75,68,144,98,97,146,67,7,72,45,52,
+53,44,45,53,54,75,171,185,185,171,34,128,99,99,128,0,0,4,0,129,255,255,2,
+144,4,251,0,11,0,25,0,37,0,51,0,0,1,20,6,35,34,38,53,52,54,51,50,22,7,54,
+54,53,52,38,35,34,6,21,20,22,51,50,1,20,6,35,34,38,53,52,54,51,50,22,7,54,
+54,53,52,38,35,34,6,21,20,22,51,50,2,144,155,121,109,142,152,118,113,144,
+228,54,69,43,36,90,144,48,33,55,1,26,155,121,109,142,152,118,113,144,228,
+54,69,43,36,90,144,48,33,55,3,249,118,151,147,112,118,150,144,246,38,114,
+51,32,45,148,91,33,45,253,188,118,151,147,112,118,150,144,246,38,114,51,32,
+45,148,91,33,45,0,1,254,239,254,14,0,234,255,147,0,6,0,0,19,38,38,39,55,4,
+23,175,89,230,129,41,1,38,172,254,14,94,132,28,135,90,235,0,0,1,253,114,254,
+131,254,114,255,128,0,11,0,0,5,20,6,35,34,38,53,52,54,51,50,22,254,114,74,
+52,54,76,75,55,53,73,255,56,70,72,54,55,72,72,0,1,255,196,255,172,3,206,4,
+250,0,39,0,0,5,38,36,37,39,22,51,50,54,53,52,38,35,34,7,21,20,6,35,34,38,
+53,52,54,55,38,39,35,39,33,22,23,30,2,21,16,5,22,23,3,144,206,254,168,254,
+255,41,155,174,166,186,114,122,31,27,80,101,73,94,125,103,47,101,174,69,1,
+61,117,46,142,194,95,254,226,215,194,84,194,164,29,198,51,130,115,91,111,
+4,16,95,103,90,72,82,100,13,78,53,107,117,117,3,105,172,105,254,253,93,108,
+211,0,0,2,0,118,0,122,4,68,4,150,0,16,0,31,0,0,1,6,6,35,34,38,38,53,52,54,
+54,51,50,22,22,21,20,5,54,54,53,52,38,35,34,6,6,21,20,22,51,50,4,8,59,222,
+148,137,221,127,123,222,140,151,221,117,254,187,96,106,158,138,125,193,106,
+164,139,120,1,131,122,143,126,236,158,145,244,143,138,236,143,148,186,71,
+226,121,136,157,132,216,122,144,168,0,0,1,0,109,255,247,3,50,4,250,0,45,0,
+0,1,22,22,21,20,6,6,35,34,38,38,53,52,54,51,50,22,21,20,6,7,22,51,50,54,53,
+52,38,39,39,38,38,53,52,54,51,50,22,21,20,6,35,39,22,22,23,2,38,138,130,82,
+173,128,71,151,104,80,80,68,78,46,40,61,87,111,131,109,113,120,110,123,93,
+80,61,72,63,59,43,7,65,73,3,50,73,187,133,115,198,121,51,114,90,73,102,81,
+59,46,63,11,37,128,102,99,143,60,64,59,161,125,97,112,73,55,54,72,3,38,65,
+39,0,0,1,0,102,255,116,3,233,4,250,0,39,0,0,5,38,36,39,39,22,4,51,50,53,52,
+38,38,39,38,38,53,52,54,51,50,22,21,20,6,35,34,39,22,22,23,23,22,22,21,20,
+6,7,22,23,3,177,206,254,125,226,24,132,1,17,99,152,36,92,182,110,123,93,80,
+61,72,63,59,26,21,6,67,76,120,125,118,140,115,185,207,140,179,227,61,214,
+67,88,98,34,49,56,97,59,161,125,97,112,73,55,54,72,4,38,65,40,63,65,134,94,
+107,161,21,108,201,0,0,1,0,47,0,83,4,68,4,158,0,31,0,0,19,18,18,22,51,50,
+54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,18,21,20,6,35,34,0,3,
+134,70,157,181,116,140,160,109,96,17,89,90,104,104,128,115,152,211,103,218,
+200,239,254,210,86,4,8,254,223,254,183,134,206,181,149,178,17,46,51,88,96,
+123,95,106,128,190,254,225,147,236,239,1,197,1,217,0,0,3,0,69,0,0,3,104,4,
+251,0,23,0,37,0,51,0,0,1,20,7,22,21,20,6,35,34,38,38,53,52,54,55,38,38,53,
+52,54,54,51,50,22,3,54,54,53,52,38,35,34,6,21,20,22,23,54,7,14,2,21,20,22,
+51,50,54,53,52,38,39,3,62,202,244,218,170,111,189,115,140,122,94,119,104,
+159,81,165,203,239,60,72,120,95,108,131,80,78,104,20,106,122,83,142,113,127,
+150,107,94,3,169,165,119,126,211,138,178,86,165,114,112,153,62,55,148,90,
+92,132,66,187,254,237,33,87,60,75,93,108,88,63,118,47,44,187,47,67,97,66,
+88,104,125,107,70,126,50,0,0,2,0,104,255,252,4,22,4,252,0,23,0,39,0,0,37,
+6,35,34,36,2,53,52,0,37,23,6,21,20,22,51,55,23,6,6,21,20,22,51,5,50,55,38,
+38,53,52,54,55,38,38,39,4,17,20,22,4,10,87,104,218,254,178,187,1,77,1,32,
+64,73,128,126,26,50,122,151,122,96,254,251,50,50,93,117,110,90,114,137,3,
+254,202,235,13,17,132,1,5,186,241,1,121,83,130,57,104,85,93,1,134,43,135,
+113,98,124,37,5,38,156,106,92,157,55,23,152,107,167,254,181,191,202,0,1,0,
+35,0,73,4,158,4,249,0,41,0,0,1,20,51,50,54,55,22,21,20,6,35,32,0,3,55,18,
+0,51,50,54,53,52,39,6,6,35,34,38,38,53,53,6,35,34,38,53,52,54,51,50,22,21,
+2,92,36,55,148,137,202,224,187,254,254,254,151,117,82,124,1,37,216,153,178,
+56,109,154,74,66,85,47,24,38,64,73,75,65,78,95,2,240,51,117,149,209,248,200,
+237,1,189,1,209,25,254,109,254,172,155,134,111,72,113,86,49,108,103,191,15,
+83,63,65,88,125,106,0,0,2,0,72,255,255,3,148,4,249,0,25,0,37,0,0,1,54,51,
+50,22,21,20,6,35,34,38,53,17,6,35,34,38,38,53,52,54,54,51,50,22,21,39,52,
+38,35,34,6,6,21,20,51,50,55,2,206,25,36,64,73,75,65,79,95,58,81,97,179,115,
+92,175,119,114,146,116,46,44,66,146,97,171,126,102,1,28,14,83,63,65,88,124,
+107,1,0,20,90,191,143,104,175,104,155,115,53,37,51,108,175,93,158,50,0,0,
+2,0,22,255,255,4,109,4,249,0,39,0,52,0,0,1,20,6,35,35,34,7,22,21,20,6,35,
+34,38,53,17,6,35,34,38,53,52,54,51,50,22,21,17,54,51,50,22,23,54,54,51,51,
+50,53,51,1,20,22,51,50,54,54,53,52,38,35,34,7,4,109,119,108,55,35,12,42,200,
+166,114,146,25,36,64,73,75,65,79,95,57,82,79,147,52,14,71,71,51,84,86,252,
+230,46,44,66,135,88,74,77,126,102,3,48,98,100,20,94,122,172,211,155,115,2,
+207,14,83,63,65,88,124,107,254,255,21,63,63,51,59,76,253,118,37,51,108,174,
+94,89,69,50,0,0,1,0,82,255,248,3,213,4,250,0,56,0,0,33,54,53,52,38,35,34,
+6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,50,54,53,52,
+38,39,39,46,2,53,52,54,51,50,22,21,20,6,7,22,23,23,22,22,21,20,6,7,2,52,6,
+116,101,78,85,17,35,62,55,75,74,69,94,115,165,138,148,179,11,69,89,136,126,
+146,90,119,84,76,76,61,72,53,49,46,104,160,150,158,218,185,48,57,169,195,
+96,73,49,32,48,72,58,58,84,132,120,161,193,216,192,100,92,112,146,58,67,41,
+75,124,90,76,100,73,55,48,71,6,39,49,75,70,207,160,177,231,21,0,0,1,0,70,
+255,255,3,158,4,249,0,41,0,0,1,54,51,50,22,21,20,6,35,34,38,53,17,52,38,35,
+34,6,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,21,
+2,216,25,36,64,73,75,65,79,95,46,44,67,161,111,77,1,80,61,75,93,101,90,80,
+140,87,210,188,114,146,1,28,14,83,63,65,88,124,107,3,58,37,51,109,175,92,
+128,25,22,66,78,85,79,73,87,92,188,137,189,210,155,115,0,1,0,141,0,132,3,
+51,3,159,0,9,0,0,37,46,2,39,55,22,22,18,19,2,231,107,188,180,127,47,161,194,
+186,90,132,237,253,105,28,172,57,127,254,211,254,226,0,1,0,15,255,255,3,148,
+4,249,0,43,0,0,1,33,17,20,22,51,50,54,55,38,38,53,52,54,51,50,22,21,20,6,
+6,35,34,38,38,53,17,35,39,51,53,6,35,34,38,53,52,54,51,50,22,21,21,33,3,148,
+253,215,52,46,81,139,23,49,60,78,68,79,77,99,179,112,79,117,64,162,70,232,
+25,36,64,73,75,65,79,95,1,227,2,224,253,248,39,49,125,89,4,68,52,59,81,110,
+75,99,196,127,74,125,71,1,211,107,145,14,83,63,65,88,124,107,199,0,0,1,0,
+59,255,247,3,144,4,250,0,6,0,0,55,0,19,23,2,0,7,59,2,54,198,89,87,254,140,
+245,130,1,43,3,77,14,254,13,253,147,149,0,0,1,0,79,255,247,4,125,4,250,0,
+29,0,0,37,54,53,52,38,35,7,22,21,20,6,35,34,38,53,52,54,51,50,22,23,0,19,
+23,2,0,7,39,54,55,1,220,85,92,91,34,42,79,69,69,90,137,111,124,192,23,1,10,
+128,89,88,254,156,240,149,86,75,233,62,92,69,85,2,40,65,57,79,89,78,92,120,
+150,115,1,58,2,36,14,254,8,253,149,146,139,45,58,0,1,0,70,255,255,4,39,4,
+251,0,46,0,0,1,2,2,6,35,34,38,38,53,52,54,54,55,54,54,53,52,38,35,7,22,21,
+20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,6,6,21,20,22,51,32,0,19,4,39,
+29,157,255,193,110,163,86,73,104,82,149,83,95,82,35,43,82,64,70,91,137,111,
+86,153,96,124,144,94,95,46,44,1,26,1,66,68,4,238,254,22,253,217,222,82,129,
+67,57,81,52,31,55,74,55,57,54,3,43,61,59,77,89,78,92,120,70,139,99,102,132,
+51,34,66,40,30,36,2,43,2,78,0,1,0,25,0,0,1,246,4,250,0,23,0,0,1,54,51,50,
+22,21,20,6,35,34,38,53,17,6,35,34,38,53,52,54,51,50,22,21,1,63,23,23,64,73,
+75,65,72,82,23,23,64,73,75,65,72,82,1,36,7,83,63,65,88,98,81,3,35,7,83,63,
+65,88,98,81,0,1,0,28,0,0,4,55,4,250,0,35,0,0,1,54,51,50,22,21,20,6,35,34,
+38,53,17,6,6,7,39,17,6,35,34,38,53,52,54,51,50,22,21,17,20,7,54,54,55,23,
+3,128,23,23,64,73,75,65,72,82,137,191,146,100,23,23,64,73,75,65,72,82,4,93,
+205,146,134,1,36,7,83,63,65,88,98,81,2,70,87,164,149,66,2,43,7,83,63,65,88,
+98,81,254,214,100,75,93,153,87,113,0,0,2,0,130,1,51,3,11,3,178,0,11,0,23,
+0,0,1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,3,
+11,186,139,139,185,185,139,139,186,115,120,90,91,118,120,89,90,120,2,115,
+138,182,183,137,136,183,181,138,91,120,119,92,91,118,119,0,2,0,127,1,175,
+3,245,4,101,0,14,0,26,0,0,1,6,2,6,35,34,38,39,55,22,22,51,50,54,19,1,20,6,
+35,34,38,53,52,54,51,50,22,3,245,67,128,178,128,153,181,51,75,68,144,98,128,
+177,116,254,200,64,45,47,66,65,48,46,63,4,75,236,254,228,148,201,175,34,128,
+99,214,1,41,254,235,50,59,60,49,50,60,61,0,1,0,72,255,230,2,102,3,157,0,15,
+0,0,37,7,39,46,2,53,52,55,23,6,21,20,22,22,23,2,102,62,160,121,124,75,217,
+75,120,78,118,105,33,59,177,131,151,155,81,181,75,168,46,108,66,151,151,121,
+0,1,1,104,255,232,1,215,4,250,0,5,0,0,5,35,39,17,51,23,1,215,7,104,7,104,
+24,75,4,199,75,0,255,255,1,104,255,232,3,29,4,250,0,34,0,95,0,0,0,3,0,95,
+1,70,0,0,0,1,0,121,0,0,4,61,5,182,0,34,0,0,33,35,34,38,38,39,1,53,51,50,54,
+55,33,53,33,38,38,35,35,53,33,21,33,22,23,51,21,35,2,5,19,22,22,51,51,3,86,
+49,133,137,85,47,254,230,170,182,153,11,253,252,2,4,9,146,160,201,3,196,254,
+160,113,12,227,229,32,254,65,235,51,101,63,27,27,75,82,1,250,58,124,146,96,
+135,117,96,96,88,164,96,254,162,17,254,111,85,79,0,0,1,255,213,254,240,0,
+43,5,6,0,3,0,0,19,35,17,51,43,86,86,254,240,6,22,0,0,1,255,33,254,240,0,223,
+5,133,0,14,0,0,19,35,17,7,39,55,39,55,23,55,23,7,23,7,39,43,86,127,53,168,
+168,53,170,170,53,168,168,53,127,254,240,5,88,127,55,168,166,55,170,170,55,
+166,168,55,127,0,0,16,0,98,0,86,4,94,4,82,0,11,0,23,0,35,0,47,0,60,0,72,0,
+84,0,96,0,108,0,120,0,132,0,144,0,157,0,169,0,181,0,193,0,0,1,20,6,35,34,
+38,53,52,54,51,50,22,7,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,
+52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,5,6,35,34,38,53,52,54,51,
+50,22,21,20,5,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,
+50,22,5,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,
+5,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,5,20,
+6,35,34,38,53,52,54,51,50,22,5,6,35,34,38,53,52,54,51,50,22,21,20,5,20,6,
+35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,22,7,20,6,35,34,
+38,53,52,54,51,50,22,2,150,32,22,21,32,32,21,22,32,173,31,22,21,32,32,21,
+22,31,1,89,32,22,21,32,32,21,22,32,254,16,32,21,22,32,32,22,21,32,2,119,15,
+22,22,31,31,22,22,31,253,25,32,22,21,32,32,21,22,32,3,71,31,22,22,31,31,22,
+22,31,252,148,32,21,22,32,32,22,21,32,3,145,31,22,22,31,31,22,22,31,252,148,
+32,22,21,32,32,21,22,32,3,71,31,22,22,31,31,22,22,31,253,25,32,21,22,32,32,
+22,21,32,2,119,15,22,22,31,31,22,22,31,254,16,31,22,21,32,32,21,22,31,1,89,
+32,22,21,32,32,21,22,32,172,32,22,21,32,32,21,22,32,4,29,22,32,32,22,21,32,
+32,58,22,31,31,22,21,32,32,21,22,31,31,22,21,32,32,117,22,32,32,22,21,32,
+32,59,16,32,22,21,32,32,21,22,130,22,31,31,22,22,31,31,22,22,31,31,22,22,
+31,31,194,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,194,22,31,31,22,22,
+31,31,22,22,31,31,22,22,31,31,174,21,32,32,21,22,32,32,59,16,32,21,22,32,
+32,22,21,75,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,59,21,32,32,21,22,
+32,32,0,255,255,255,197,255,232,5,208,4,250,2,34,0,32,0,0,0,3,0,72,3,60,1,
+158,255,255,0,60,255,232,5,44,5,159,2,34,0,33,0,0,0,3,0,72,4,3,1,158,255,
+255,0,34,255,232,4,226,5,159,2,34,0,34,0,0,0,3,0,72,3,140,1,108,255,255,255,
+197,255,232,4,94,4,250,2,34,0,35,0,0,0,3,0,72,3,50,1,148,255,255,255,197,
+254,200,4,158,5,15,2,34,0,36,0,0,0,3,0,72,4,236,0,69,255,255,255,197,254,
+210,4,22,4,250,2,34,0,37,0,0,0,3,0,72,3,142,0,79,255,255,255,197,255,54,4,
+208,4,250,2,34,0,38,0,0,0,3,0,72,3,252,0,179,255,255,255,197,254,244,6,164,
+4,250,2,34,0,39,0,0,0,3,0,72,4,187,0,113,255,255,255,197,255,232,5,136,5,
+159,2,34,0,40,0,0,0,3,0,72,3,30,1,158,255,255,0,87,255,44,6,208,5,15,2,34,
+0,41,0,0,0,3,0,72,5,40,0,169,255,255,255,197,254,210,4,53,7,86,2,34,0,42,
+0,0,0,3,0,72,3,151,0,79,255,255,255,197,254,128,4,132,7,86,2,34,0,43,0,0,
+0,3,0,72,4,46,255,253,255,255,255,197,254,200,5,45,4,250,2,34,0,44,0,0,0,
+3,0,72,4,236,0,69,255,255,255,197,254,199,4,53,4,250,2,34,0,45,0,0,0,3,0,
+72,3,174,0,68,255,255,0,75,255,232,4,147,5,159,2,34,0,46,0,0,0,3,0,72,3,140,
+1,138,255,255,255,196,254,222,5,30,4,250,2,34,0,47,0,0,0,3,0,72,4,215,0,91,
+255,255,0,66,255,232,4,180,5,159,2,34,0,48,0,0,0,3,0,72,3,120,1,158,255,255,
+255,196,255,231,4,76,4,250,2,34,0,49,0,0,0,3,0,72,3,206,1,106,255,255,0,54,
+255,232,4,95,5,15,2,34,0,50,0,0,0,3,0,72,3,80,1,128,255,255,255,196,255,232,
+4,107,4,250,2,34,0,51,0,0,0,3,0,72,3,130,1,118,255,255,0,34,255,232,5,65,
+5,159,2,34,0,52,0,0,0,3,0,72,3,200,1,118,255,255,255,197,255,232,6,18,4,250,
+2,34,0,53,0,0,0,3,0,72,3,120,1,108,255,255,255,197,254,223,5,70,4,250,2,34,
+0,55,0,0,0,3,0,72,4,246,0,92,255,255,255,197,255,229,4,195,4,250,2,34,0,56,
+0,0,0,3,0,72,4,94,1,98,255,255,255,197,255,232,4,145,4,250,2,34,0,57,0,0,
+0,3,0,72,3,120,1,108,255,255,255,197,255,232,5,104,4,250,2,34,0,59,0,0,0,
+3,0,72,4,244,1,118,255,255,255,197,255,232,4,244,5,159,2,34,0,60,0,0,0,3,
+0,72,3,180,1,128,255,255,255,197,255,232,4,145,4,250,2,34,0,61,0,0,0,3,0,
+72,3,120,1,108,255,255,255,197,255,232,4,248,4,250,2,34,0,62,0,0,0,3,0,72,
+4,84,1,108,255,255,255,197,255,119,3,236,4,250,2,34,0,63,0,0,0,3,0,72,3,120,
+0,244,255,255,255,197,255,232,4,114,4,250,2,34,0,64,0,0,0,3,0,72,3,80,1,158,
+255,255,255,197,254,255,4,89,4,250,2,34,0,65,0,0,0,3,0,72,3,97,0,124,0,1,
+254,209,5,144,1,12,7,133,0,3,0,0,1,1,39,1,1,12,254,48,107,2,17,7,84,254,60,
+125,1,120,0,2,252,248,254,155,255,83,1,69,0,10,0,16,0,0,3,35,39,38,38,39,
+39,54,37,53,51,7,6,7,22,22,23,173,4,103,69,190,170,67,195,1,41,111,111,144,
+120,78,148,38,254,155,74,84,84,5,199,113,113,10,190,58,59,26,104,58,0,1,255,
+197,255,190,2,132,4,250,0,32,0,0,23,39,23,50,54,54,53,52,38,39,38,38,53,52,
+55,33,39,33,23,35,6,6,21,20,22,23,22,22,21,20,6,6,35,169,50,1,5,90,76,39,
+40,43,44,190,254,207,69,2,121,70,200,64,94,40,40,42,42,125,146,9,65,69,1,
+74,134,95,55,110,83,92,126,67,173,155,107,107,51,156,88,63,109,81,82,120,
+69,124,184,106,0,1,251,226,254,170,255,83,1,137,0,33,0,0,3,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,22,23,38,53,
+17,51,173,8,103,47,78,62,29,100,118,50,136,150,33,85,21,94,97,24,86,15,81,
+38,61,83,62,40,8,111,254,170,74,80,48,12,14,176,164,113,106,24,87,72,93,108,
+8,1,9,43,82,75,95,117,1,66,0,2,0,132,255,194,4,52,5,7,0,37,0,48,0,0,5,54,
+53,52,38,38,39,37,38,38,53,52,54,54,51,50,22,21,20,6,6,35,34,38,39,6,21,20,
+22,22,23,23,22,22,21,20,6,7,1,34,7,22,22,51,50,54,53,52,38,3,152,33,46,83,
+78,254,244,160,186,97,195,138,136,156,46,105,83,127,138,12,100,77,116,87,
+231,184,138,31,37,254,53,73,61,21,125,72,54,59,113,28,63,63,46,60,42,28,98,
+58,238,165,118,208,128,148,127,66,139,97,198,151,71,127,90,117,68,34,89,71,
+140,102,55,98,59,4,156,22,106,98,50,45,58,73,0,2,255,196,1,80,5,21,4,250,
+0,34,0,40,0,0,1,35,39,38,38,39,39,54,54,55,53,33,39,33,23,33,21,22,22,21,
+20,6,35,34,38,53,52,54,51,50,22,23,52,38,39,7,6,7,22,22,23,2,229,4,102,78,
+215,207,84,169,249,162,253,147,70,5,12,69,253,208,194,229,77,81,67,68,60,
+54,42,55,9,196,154,110,204,158,108,201,53,1,80,74,96,94,11,232,98,116,53,
+57,107,107,56,20,215,160,96,114,76,52,54,70,41,32,100,131,9,7,73,92,34,122,
+75,0,255,255,0,60,254,14,5,218,5,159,2,38,0,33,0,0,0,7,0,71,4,240,0,0,0,1,
+0,34,1,97,3,166,5,8,0,30,0,0,1,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,36,
+53,52,38,35,34,7,39,54,54,51,50,22,22,23,3,152,122,164,108,66,115,72,62,75,
+114,138,127,148,122,1,35,64,55,131,133,139,123,215,124,85,137,126,90,3,32,
+190,132,58,80,20,131,109,108,193,110,185,114,141,50,57,106,137,188,169,82,
+158,143,255,255,255,197,254,14,4,255,4,250,2,38,0,35,0,0,0,7,0,71,4,21,0,
+0,0,2,255,197,1,64,3,191,5,12,0,49,0,60,0,0,1,20,22,51,50,54,55,22,22,21,
+20,6,35,34,0,3,55,18,18,51,50,54,53,52,39,6,6,35,34,38,53,53,38,39,35,39,
+33,22,23,54,54,51,50,22,21,20,6,35,34,39,55,54,53,52,38,35,34,7,22,51,50,
+1,219,23,29,63,169,67,58,75,187,165,188,254,210,95,82,89,235,178,119,138,
+12,62,144,62,106,112,96,75,184,69,1,38,47,87,14,108,89,86,108,102,119,42,
+36,168,35,41,36,110,14,37,29,65,3,83,25,19,91,74,57,157,89,164,185,1,73,1,
+115,25,254,228,254,243,111,103,43,24,58,54,119,110,79,64,134,107,114,62,88,
+106,108,84,78,111,9,145,23,44,29,39,151,7,0,2,255,197,1,17,3,226,4,250,0,
+20,0,33,0,0,1,6,2,6,35,34,38,38,53,17,35,39,33,23,33,21,30,2,51,55,1,20,22,
+22,51,50,54,54,55,46,2,39,3,85,20,111,190,129,76,109,58,150,69,3,216,69,253,
+45,46,116,133,113,68,254,36,26,56,46,76,112,67,15,85,134,131,48,3,89,143,
+254,245,174,56,122,121,2,83,107,107,28,75,69,18,4,254,134,100,78,33,138,190,
+88,6,32,93,88,255,255,255,197,254,113,4,208,4,250,2,38,0,38,0,0,0,7,0,71,
+3,4,0,99,255,255,255,197,254,94,6,164,4,250,2,38,0,39,0,0,0,7,0,71,4,112,
+0,80,255,255,255,197,254,14,5,136,5,159,2,38,0,40,0,0,0,7,0,71,4,2,0,0,255,
+255,0,87,254,14,6,208,5,15,2,38,0,41,0,0,0,7,0,71,5,50,0,0,0,1,255,197,1,
+77,4,15,7,86,0,56,0,0,1,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,54,51,
+50,22,21,20,6,6,35,34,38,38,53,17,35,39,33,38,38,35,34,7,6,35,34,38,53,52,
+55,23,7,20,22,51,50,55,55,50,22,23,51,4,15,252,246,26,59,48,114,181,34,43,
+65,77,86,97,98,110,126,123,221,140,75,117,57,140,69,3,12,15,72,76,35,100,
+77,31,149,143,7,85,2,84,132,39,70,90,128,133,21,160,4,143,254,8,102,74,35,
+144,119,34,89,73,79,97,138,119,115,197,117,58,119,122,2,23,107,104,91,8,7,
+168,154,52,50,9,51,103,85,6,6,165,203,0,255,255,255,197,254,14,4,132,7,86,
+2,38,0,43,0,0,0,7,0,71,3,12,0,0,0,1,255,197,1,55,4,140,4,250,0,36,0,0,1,33,
+17,20,22,51,50,54,55,22,22,21,20,6,35,34,0,3,55,18,22,51,50,54,53,52,39,6,
+35,34,38,38,53,53,33,39,33,4,140,253,118,20,22,47,116,82,96,117,199,173,227,
+254,226,87,83,92,231,185,131,149,29,140,159,53,85,47,254,122,69,4,130,4,143,
+254,227,28,23,102,123,67,176,123,177,202,1,79,1,90,28,254,229,242,128,111,
+67,47,180,49,108,103,239,107,0,1,255,197,1,77,4,5,4,250,0,32,0,0,1,33,17,
+20,22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,6,6,35,34,38,38,53,
+17,35,39,33,4,5,252,246,26,59,48,114,181,34,43,65,77,86,97,98,110,126,123,
+221,140,75,117,57,130,69,3,251,4,143,254,8,102,74,35,144,119,34,89,73,79,
+97,138,119,115,197,117,58,119,122,2,23,107,0,1,0,75,2,58,3,109,5,8,0,29,0,
+0,1,7,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,
+54,51,50,22,23,3,109,45,108,193,118,108,131,91,1,86,66,75,82,100,91,79,141,
+87,179,139,117,197,147,3,16,12,176,145,112,92,131,29,21,66,78,83,71,80,90,
+87,166,114,153,198,177,251,0,255,255,255,196,254,97,5,30,4,250,2,38,0,47,
+0,0,0,7,0,71,3,172,0,83,255,255,0,66,254,14,5,85,5,159,2,38,0,48,0,0,0,7,
+0,71,4,107,0,0,0,1,255,196,0,217,4,2,4,250,0,25,0,0,37,38,53,52,55,6,6,7,
+39,17,35,39,33,23,33,17,20,7,54,54,55,23,6,21,20,23,2,196,74,34,112,176,135,
+100,135,70,3,248,70,252,254,4,93,205,146,173,112,38,217,193,186,119,93,74,
+155,138,66,2,148,107,107,254,222,100,75,93,153,87,146,157,204,149,124,0,255,
+255,0,54,254,14,5,20,5,15,2,38,0,50,0,0,0,7,0,71,4,42,0,0,0,2,255,196,1,95,
+3,163,4,250,0,3,0,21,0,0,1,33,39,33,3,38,38,39,22,21,20,6,35,34,38,53,52,
+54,51,50,22,23,3,163,252,103,70,3,153,62,62,171,119,16,93,89,100,118,146,
+124,151,245,67,4,143,107,252,101,148,167,12,38,44,86,95,122,99,106,125,197,
+176,0,0,2,0,34,1,143,3,249,5,8,0,19,0,31,0,0,1,38,39,1,39,55,54,53,52,38,
+35,34,7,39,54,54,51,50,22,19,39,38,38,35,34,6,7,54,51,50,22,23,3,246,49,42,
+254,0,127,50,78,55,44,72,63,144,146,220,140,115,207,155,193,61,122,71,103,
+148,94,29,42,93,124,3,2,211,81,61,254,46,127,44,80,74,54,53,42,143,206,150,
+182,254,251,149,68,64,87,116,9,118,94,0,255,255,255,197,254,14,6,18,4,250,
+2,38,0,53,0,0,0,7,0,71,4,74,0,0,0,2,255,197,1,81,3,250,4,250,0,13,0,19,0,
+0,1,35,39,38,37,39,36,37,53,33,39,33,23,35,7,6,7,22,4,23,3,16,4,103,150,254,
+133,84,1,8,1,89,253,105,69,3,240,69,234,111,241,180,109,1,2,54,1,81,74,165,
+41,242,150,115,43,107,107,235,94,91,26,139,63,0,255,255,255,197,254,84,5,
+70,4,250,2,38,0,55,0,0,0,7,0,71,3,156,0,70,0,2,255,197,2,141,4,119,4,250,
+0,28,0,43,0,0,1,35,22,21,20,6,35,34,38,39,38,38,39,22,21,20,6,35,34,38,53,
+52,54,55,38,39,35,39,33,5,22,23,22,22,23,22,22,51,50,54,53,52,38,39,4,119,
+226,81,122,100,64,109,74,42,57,37,13,85,78,83,90,95,93,50,96,102,69,4,109,
+252,223,50,29,49,80,52,61,87,54,63,73,34,27,4,143,110,134,115,137,52,78,43,
+46,10,37,43,76,91,103,82,87,115,2,77,48,107,107,51,85,13,47,39,46,44,75,76,
+51,92,31,0,255,255,255,197,254,14,5,63,4,250,2,38,0,57,0,0,0,7,0,71,4,85,
+0,0,255,255,255,197,253,250,4,251,4,250,2,34,0,54,0,0,0,35,0,72,3,96,1,124,
+0,3,0,71,4,17,255,236,0,2,255,197,0,253,4,70,4,250,0,3,0,44,0,0,1,33,39,33,
+19,38,38,35,34,6,21,39,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,
+34,38,38,53,52,54,51,50,22,23,54,51,50,22,23,4,70,251,196,69,4,59,22,40,104,
+60,54,76,45,35,119,91,107,126,91,1,80,61,75,93,101,90,79,141,87,165,125,88,
+123,46,33,131,67,114,71,4,143,107,253,95,79,95,95,96,16,93,83,105,99,131,
+29,21,66,78,85,79,73,87,87,166,114,154,197,94,82,171,119,136,0,1,255,197,
+2,61,3,174,5,8,0,39,0,0,1,38,38,35,34,7,22,22,21,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,55,38,38,35,35,39,51,50,22,23,54,54,51,50,22,22,23,3,162,99,
+96,54,84,82,118,120,81,71,69,100,20,18,99,73,67,84,125,139,57,102,71,95,69,
+159,79,112,90,72,118,65,62,98,82,64,3,111,161,91,98,62,157,84,79,78,86,86,
+81,91,85,72,86,178,63,59,51,107,59,102,94,81,74,120,113,0,3,255,197,2,134,
+3,234,4,250,0,16,0,24,0,32,0,0,1,33,22,22,21,20,6,35,34,38,38,53,52,55,35,
+39,33,3,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,3,234,254,199,77,91,167,
+130,119,221,136,32,106,69,3,223,253,26,138,95,77,56,52,30,140,102,80,50,4,
+143,52,139,78,127,125,109,184,106,72,50,107,254,72,46,71,81,132,35,52,47,
+63,94,127,34,0,0,2,255,197,2,178,4,186,4,250,0,25,0,34,0,0,1,35,22,21,20,
+6,35,34,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,5,22,22,51,50,
+54,53,52,39,4,186,225,71,117,97,192,80,33,120,87,81,143,55,71,38,74,47,61,
+71,34,11,254,64,69,4,175,253,233,11,103,89,59,62,45,4,143,116,116,109,127,
+231,111,129,126,130,37,75,70,94,138,97,107,107,145,163,72,64,95,77,0,255,
+255,255,197,254,169,3,236,4,250,2,38,0,63,0,0,0,7,0,71,2,121,0,155,255,255,
+255,197,254,14,5,20,4,250,2,38,0,64,0,0,0,7,0,71,4,42,0,0,255,255,255,197,
+254,14,5,2,4,250,2,34,0,65,0,0,0,3,0,71,4,24,0,0,255,255,255,197,254,14,6,
+72,4,250,2,38,0,66,0,0,0,7,0,71,4,164,0,0,255,255,255,197,254,64,7,52,4,250,
+2,38,0,67,0,0,0,7,0,71,3,153,0,50,255,255,255,197,253,250,5,208,4,250,2,34,
+0,32,0,0,0,35,0,72,3,60,1,158,0,3,0,71,4,7,255,236,255,255,0,60,253,250,5,
+205,5,159,2,34,0,33,0,0,0,35,0,72,4,3,1,158,0,3,0,71,4,227,255,236,255,255,
+0,34,253,250,5,135,5,159,2,34,0,34,0,0,0,35,0,72,3,140,1,108,0,3,0,71,4,157,
+255,236,255,255,255,197,253,250,5,15,4,250,2,34,0,35,0,0,0,35,0,72,3,50,1,
+148,0,3,0,71,4,37,255,236,255,255,255,197,253,250,4,231,5,15,2,34,0,36,0,
+0,0,35,0,72,4,36,0,69,0,3,0,71,3,253,255,236,255,255,255,197,253,250,4,22,
+4,250,2,34,0,37,0,0,0,35,0,72,2,198,0,79,0,3,0,71,2,199,255,236,255,255,255,
+197,254,54,4,208,4,250,2,34,0,38,0,0,0,35,0,72,3,52,0,179,0,3,0,71,3,93,0,
+40,255,255,255,197,254,24,6,164,4,250,2,34,0,39,0,0,0,35,0,72,4,187,0,113,
+0,3,0,71,5,11,0,10,255,255,255,197,253,250,5,136,5,159,2,34,0,40,0,0,0,35,
+0,72,3,30,1,158,0,3,0,71,4,7,255,236,255,255,0,87,253,250,6,208,5,15,2,34,
+0,41,0,0,0,35,0,72,5,40,0,169,0,3,0,71,5,51,255,236,255,255,255,197,254,4,
+4,53,7,86,2,34,0,42,0,0,0,35,0,72,2,208,0,79,0,3,0,71,2,239,255,246,255,255,
+255,197,253,220,4,132,7,86,2,34,0,43,0,0,0,35,0,72,3,102,255,253,0,3,0,71,
+3,113,255,206,255,255,255,197,253,250,5,45,4,250,2,34,0,44,0,0,0,35,0,72,
+4,36,0,69,0,3,0,71,4,27,255,236,255,255,255,197,253,250,4,53,4,250,2,34,0,
+45,0,0,0,35,0,72,2,230,0,68,0,3,0,71,2,239,255,236,255,255,0,75,253,250,5,
+65,5,159,2,34,0,46,0,0,0,35,0,72,3,140,1,138,0,3,0,71,4,87,255,236,255,255,
+255,196,253,250,5,30,4,250,2,34,0,47,0,0,0,35,0,72,4,15,0,91,0,3,0,71,4,17,
+255,236,255,255,0,66,253,250,5,105,5,159,2,34,0,48,0,0,0,35,0,72,3,120,1,
+158,0,3,0,71,4,127,255,236,255,255,255,196,253,250,5,75,4,250,2,34,0,49,0,
+0,0,35,0,72,3,236,1,106,0,3,0,71,4,97,255,236,255,255,0,54,253,250,5,15,5,
+15,2,34,0,50,0,0,0,35,0,72,3,80,1,128,0,3,0,71,4,37,255,236,255,255,255,196,
+253,250,5,15,4,250,2,34,0,51,0,0,0,35,0,72,3,130,1,118,0,3,0,71,4,37,255,
+236,255,255,0,34,253,250,5,235,5,159,2,34,0,52,0,0,0,35,0,72,3,200,1,118,
+0,3,0,71,5,1,255,236,255,255,255,197,253,250,6,18,4,250,2,34,0,53,0,0,0,35,
+0,72,3,120,1,108,0,3,0,71,4,67,255,236,255,255,255,197,253,250,5,70,4,250,
+2,34,0,55,0,0,0,35,0,72,4,46,0,92,0,3,0,71,4,17,255,236,255,255,255,197,253,
+250,5,105,4,250,2,34,0,56,0,0,0,35,0,72,4,94,1,98,0,3,0,71,4,127,255,236,
+255,255,255,197,253,250,5,65,4,250,2,34,0,57,0,0,0,35,0,72,3,120,1,108,0,
+3,0,71,4,87,255,236,255,255,255,197,253,250,6,27,4,250,2,34,0,59,0,0,0,35,
+0,72,4,244,1,118,0,3,0,71,5,49,255,236,255,255,255,197,253,250,5,165,5,159,
+2,34,0,60,0,0,0,35,0,72,3,180,1,128,0,3,0,71,4,187,255,236,255,255,255,197,
+253,250,5,65,4,250,2,34,0,61,0,0,0,35,0,72,3,120,1,108,0,3,0,71,4,87,255,
+236,255,255,255,197,253,250,5,166,4,250,2,34,0,62,0,0,0,35,0,72,4,84,1,108,
+0,3,0,71,4,188,255,236,255,255,255,197,254,14,4,91,4,250,2,34,0,63,0,0,0,
+35,0,72,3,120,0,244,0,3,0,71,3,113,0,0,255,255,255,197,253,250,5,35,4,250,
+2,34,0,64,0,0,0,35,0,72,3,80,1,158,0,3,0,71,4,57,255,236,255,255,255,197,
+253,250,5,5,4,250,2,34,0,65,0,0,0,35,0,72,3,97,0,124,0,3,0,71,4,27,255,236,
+0,3,255,197,255,108,5,21,4,250,0,40,0,47,0,53,0,0,5,35,39,38,38,39,39,54,
+37,38,38,39,39,54,54,55,53,33,39,33,23,33,21,22,22,21,20,6,35,34,38,53,52,
+54,51,50,22,23,52,38,39,3,17,6,7,22,22,23,23,6,7,22,22,23,2,229,4,102,86,
+249,126,67,129,1,16,73,173,127,84,169,249,162,253,147,69,5,11,69,253,208,
+194,229,77,81,67,68,60,54,42,55,9,196,154,110,204,158,94,182,58,28,165,133,
+84,173,41,148,74,105,104,4,199,73,109,45,39,7,232,98,116,53,57,107,107,56,
+20,215,160,96,114,76,52,54,70,41,32,100,131,9,254,154,1,95,73,92,29,103,64,
+171,60,61,33,130,63,0,0,2,0,45,255,108,4,163,5,159,0,48,0,54,0,0,5,35,39,
+38,38,39,39,54,55,38,38,39,39,23,50,54,53,52,39,6,6,35,34,38,53,52,54,51,
+50,22,21,7,54,55,22,21,20,6,7,22,23,55,17,51,23,21,51,23,35,3,6,7,22,22,23,
+3,186,4,103,86,249,126,67,113,219,89,202,141,82,40,192,200,34,59,150,81,90,
+110,64,59,58,66,3,89,117,172,86,87,164,105,80,8,101,166,69,233,111,165,133,
+84,173,41,148,74,105,104,4,199,65,89,33,22,4,209,1,104,98,68,47,84,83,83,
+82,53,76,70,57,36,59,182,165,202,103,123,31,33,87,30,3,104,71,94,107,252,
+243,60,61,33,130,63,0,2,0,40,255,108,4,191,5,159,0,50,0,56,0,0,5,35,39,38,
+36,39,39,54,36,55,55,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,62,2,53,52,
+38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,21,51,23,35,3,6,7,22,22,23,
+3,215,4,102,73,254,225,161,67,88,1,78,160,1,112,163,105,59,97,49,63,72,111,
+135,130,175,122,120,126,75,59,53,138,133,139,110,195,117,108,176,135,9,8,
+101,165,69,232,110,161,194,100,210,45,148,74,91,116,6,199,50,148,61,225,171,
+129,39,49,18,122,99,98,165,112,185,41,56,72,50,43,45,106,137,167,142,141,
+211,78,133,1,36,71,94,107,253,17,58,92,34,132,62,0,3,255,197,255,128,4,99,
+4,250,0,22,0,40,0,46,0,0,5,35,39,38,38,39,39,54,55,38,35,39,54,55,38,53,52,
+55,35,39,33,23,35,3,17,33,34,6,21,20,22,51,50,55,55,23,6,6,7,22,23,23,6,7,
+22,22,23,3,123,4,103,66,232,191,67,122,223,180,236,79,108,112,206,30,112,
+69,4,89,69,232,111,254,146,74,94,78,59,48,60,110,72,175,147,63,238,163,91,
+138,175,94,178,41,128,74,81,86,6,199,70,83,59,204,63,59,56,150,61,44,107,
+107,253,145,2,111,63,64,49,64,27,52,155,80,70,37,38,113,148,44,74,29,104,
+56,0,3,255,197,255,45,3,191,5,12,0,57,0,68,0,74,0,0,5,35,39,38,38,39,39,54,
+55,38,3,55,18,18,51,50,54,53,52,39,6,6,35,34,38,53,53,38,39,35,39,33,22,23,
+54,54,51,50,22,21,20,6,35,34,39,21,20,22,51,50,54,55,22,22,21,20,6,7,3,54,
+53,52,38,35,34,7,22,51,50,19,6,7,22,22,23,3,41,4,102,86,249,126,67,79,136,
+242,126,82,89,235,178,119,138,12,62,144,62,106,112,96,75,184,69,1,38,47,87,
+14,108,89,86,108,102,119,42,36,23,29,63,169,67,58,75,76,74,166,35,41,36,110,
+14,37,29,65,91,165,133,84,173,41,211,74,105,104,4,199,44,61,146,1,238,25,
+254,228,254,243,111,103,43,24,58,54,119,110,79,64,134,107,114,62,88,106,108,
+84,78,111,9,69,25,19,91,74,57,157,89,102,154,44,2,184,23,44,29,39,151,7,253,
+49,60,61,33,130,63,0,0,3,255,197,255,21,3,226,4,250,0,26,0,39,0,45,0,0,5,
+35,39,38,38,39,39,54,55,38,38,53,17,35,39,33,23,33,21,30,2,51,55,23,6,7,37,
+20,22,22,51,50,54,54,55,46,2,39,1,6,7,22,22,23,2,210,4,102,86,249,126,67,
+68,96,45,47,150,69,3,216,69,253,45,46,116,133,113,68,106,30,101,254,61,25,
+56,44,70,119,77,9,86,134,132,48,1,85,165,133,84,173,41,235,74,105,104,4,199,
+38,44,31,118,110,2,63,107,107,28,75,69,18,4,124,221,152,139,105,70,36,122,
+185,89,6,32,93,88,253,40,60,61,33,130,63,0,3,255,196,254,174,4,174,4,250,
+0,49,0,59,0,65,0,0,1,35,39,38,38,39,39,54,55,38,39,39,22,51,50,54,53,52,38,
+35,35,6,6,35,34,38,38,53,17,35,39,33,23,33,21,22,22,51,51,22,22,21,20,6,7,
+22,23,7,38,39,1,20,22,51,50,54,55,38,38,39,1,6,7,22,22,23,3,65,4,102,86,249,
+126,67,120,229,140,190,41,156,174,191,194,127,103,3,40,179,116,61,84,45,124,
+70,4,165,69,252,71,47,143,88,95,183,197,152,143,190,204,48,120,96,253,180,
+36,43,60,79,20,74,114,50,1,222,165,133,84,173,41,254,174,74,105,104,4,199,
+68,93,28,8,193,47,115,127,93,86,148,157,47,92,106,1,59,107,107,14,58,41,4,
+186,163,147,161,29,56,139,72,73,44,2,107,66,45,107,85,16,75,65,252,150,60,
+61,33,130,63,0,0,2,255,196,254,124,6,49,4,250,0,58,0,64,0,0,1,35,39,38,37,
+39,54,37,17,38,38,39,6,6,21,20,22,51,50,54,55,22,22,21,20,6,35,34,0,3,55,
+18,18,51,50,54,53,52,39,6,35,34,38,53,52,54,55,6,35,33,39,33,23,33,22,22,
+51,55,23,3,6,7,22,22,23,5,91,4,102,149,254,200,67,174,1,93,146,200,79,149,
+184,68,54,74,118,75,89,67,198,170,220,254,196,110,82,116,255,184,133,143,
+17,124,153,111,148,94,108,192,92,254,211,70,6,40,69,253,100,68,176,128,32,
+50,110,151,144,85,169,41,254,124,74,183,10,196,100,132,1,251,30,152,136,68,
+147,87,59,60,103,113,80,158,98,182,212,1,148,1,166,25,254,153,254,213,123,
+102,57,43,124,148,113,96,152,73,6,107,107,100,87,1,60,252,229,54,66,30,117,
+60,0,3,255,197,255,99,5,63,5,159,0,33,0,40,0,46,0,0,5,35,39,38,38,39,39,54,
+37,38,39,39,36,37,53,33,39,33,17,22,22,23,17,51,23,21,51,23,35,17,35,39,38,
+39,7,17,6,7,22,22,23,23,6,7,22,22,23,3,16,4,102,86,249,126,67,122,1,11,168,
+223,84,1,8,1,89,253,105,69,3,75,64,114,37,8,101,166,69,233,4,103,87,132,111,
+242,191,91,237,74,32,165,133,84,173,41,157,74,105,104,4,199,70,108,86,24,
+242,150,115,43,107,253,233,55,141,68,3,196,71,94,107,252,122,74,148,110,38,
+1,126,94,98,19,118,65,170,60,61,33,130,63,0,3,0,84,254,148,6,82,5,7,0,78,
+0,104,0,110,0,0,1,35,39,46,2,39,39,54,55,38,38,35,34,7,6,35,34,38,53,52,55,
+23,6,21,20,22,51,50,54,55,54,51,50,22,23,55,38,53,17,52,38,38,35,34,6,7,54,
+51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,23,54,51,50,22,21,20,7,22,21,
+20,6,35,34,38,39,37,52,39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,
+6,21,20,22,51,50,54,1,6,7,22,22,23,4,61,4,104,52,138,135,104,84,245,199,31,
+70,50,48,110,91,61,160,203,26,89,20,146,124,29,85,14,90,39,88,121,61,5,7,
+26,53,45,94,171,34,37,68,75,82,101,95,97,120,114,203,128,201,31,86,178,125,
+147,55,60,144,121,81,143,44,1,184,30,68,86,60,76,73,55,78,62,42,87,70,117,
+153,140,118,81,98,253,217,177,118,87,167,41,254,148,74,58,56,16,3,232,138,
+79,27,22,14,13,191,211,113,107,21,85,80,128,120,8,1,10,97,106,2,94,106,1,
+190,98,81,31,156,114,43,89,65,77,94,132,111,111,193,116,192,146,146,122,96,
+65,78,101,114,135,88,78,119,47,34,61,62,63,59,66,48,42,60,53,65,172,127,129,
+148,68,254,30,72,66,20,95,61,0,0,2,255,197,255,99,4,25,7,86,0,63,0,69,0,0,
+5,35,39,38,38,39,39,54,55,38,38,53,17,35,39,33,38,38,35,34,7,6,35,34,38,53,
+52,55,23,7,20,22,51,50,55,55,50,22,23,51,23,33,17,20,22,22,51,50,54,55,6,
+35,34,38,53,52,54,51,50,22,21,20,6,7,7,6,7,22,22,23,3,5,4,102,86,249,126,
+67,48,85,59,53,150,69,3,22,15,72,76,35,100,77,31,149,143,7,85,2,84,132,39,
+70,90,128,133,21,160,69,252,246,26,59,48,113,179,35,34,59,74,82,93,82,107,
+129,63,57,110,181,114,84,169,42,157,74,105,104,4,199,27,41,31,120,117,1,246,
+107,104,91,8,7,168,154,52,50,9,51,103,85,6,6,165,203,107,254,41,102,74,35,
+141,116,28,77,70,74,85,129,106,77,144,57,131,72,50,33,128,63,0,3,255,197,
+254,251,3,241,7,86,0,43,0,58,0,64,0,0,1,35,39,38,38,39,39,54,55,38,3,62,2,
+53,52,39,33,39,33,46,2,53,52,54,55,23,6,6,21,20,22,23,33,23,33,34,39,22,22,
+21,20,7,1,6,7,22,51,50,54,53,52,38,39,22,22,21,20,19,6,7,22,22,23,2,239,4,
+102,86,249,126,67,91,137,222,58,118,142,84,37,254,150,69,1,131,60,64,38,70,
+89,124,75,68,59,72,1,248,68,254,165,61,48,186,122,110,254,220,68,124,49,177,
+118,93,106,138,34,34,113,181,114,84,169,42,254,251,74,105,104,4,199,51,59,
+77,1,87,19,48,98,86,77,84,107,81,98,104,59,73,129,60,135,48,91,56,62,123,
+89,107,4,206,230,115,164,80,1,75,68,34,185,141,96,109,219,163,80,115,57,120,
+254,8,72,50,33,128,63,0,0,2,255,197,255,39,4,140,4,250,0,44,0,50,0,0,5,35,
+39,38,38,39,39,54,55,38,3,55,18,22,51,50,54,53,52,39,6,35,34,38,38,53,53,
+33,39,33,23,33,17,20,22,51,50,54,55,22,22,21,20,6,7,7,6,7,22,22,23,3,75,4,
+102,86,249,126,67,81,118,242,124,81,92,232,186,131,149,29,140,159,53,85,47,
+254,122,69,4,130,69,253,118,20,22,47,116,82,96,117,87,84,110,165,133,84,173,
+41,217,74,105,104,4,199,46,52,131,1,238,28,254,230,243,128,111,67,47,180,
+49,108,103,239,107,107,254,227,28,23,102,123,67,176,123,114,172,46,41,60,
+61,33,130,63,0,2,255,197,255,99,4,25,4,250,0,39,0,45,0,0,5,35,39,38,38,39,
+39,54,55,38,38,53,17,35,39,33,23,33,17,20,22,22,51,50,54,55,6,35,34,38,53,
+52,54,51,50,22,21,20,6,7,7,6,7,22,22,23,3,5,4,102,86,249,126,67,48,85,59,
+53,150,69,4,15,69,252,246,26,59,48,113,179,35,34,59,74,82,93,82,107,129,63,
+57,110,165,133,84,173,41,157,74,105,104,4,199,27,41,31,120,117,1,246,107,
+107,254,41,102,74,35,141,116,28,77,70,74,85,129,106,77,144,57,130,60,61,33,
+130,63,0,0,2,0,75,255,189,4,107,5,159,0,47,0,53,0,0,5,35,39,38,36,39,39,54,
+36,55,53,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,
+52,54,51,50,22,23,38,53,17,51,23,21,51,23,35,3,6,7,22,22,23,3,130,4,102,83,
+254,228,139,67,90,1,70,152,86,179,117,102,129,91,1,86,66,75,82,100,91,79,
+141,87,173,137,123,199,87,7,8,101,166,69,233,110,160,181,97,200,44,67,74,
+102,96,5,199,52,148,58,114,159,153,106,98,131,29,21,66,78,83,71,80,90,87,
+166,114,155,196,184,198,91,108,1,78,71,94,107,253,87,59,89,32,125,62,0,3,
+255,197,255,85,4,99,4,250,0,3,0,43,0,49,0,0,1,33,39,33,3,35,39,38,38,39,39,
+54,55,38,2,39,55,18,22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,
+51,50,22,22,21,20,6,7,7,6,7,22,22,23,4,99,251,167,69,4,89,230,4,102,86,249,
+126,67,73,126,112,156,57,82,89,217,159,118,129,77,77,10,78,75,87,91,115,109,
+105,162,88,71,67,110,165,133,84,173,41,4,143,107,250,91,74,105,104,4,199,
+42,55,68,1,42,240,25,254,239,222,107,104,67,84,7,33,35,75,85,102,77,90,116,
+97,164,96,103,156,46,49,60,61,33,130,63,0,2,0,66,255,30,4,180,5,159,0,55,
+0,63,0,0,5,35,39,46,2,39,39,54,54,55,38,38,39,39,22,51,50,54,53,52,38,35,
+34,7,22,22,21,20,6,6,35,34,38,53,52,54,54,51,50,22,22,21,20,7,22,22,23,55,
+17,51,23,21,51,23,35,3,39,6,6,7,22,22,23,3,203,4,102,57,183,195,86,67,72,
+217,118,96,250,132,82,11,29,215,207,102,93,37,45,31,33,34,66,46,70,91,60,
+123,89,90,158,98,224,94,179,68,59,8,101,166,69,233,110,3,87,188,74,100,207,
+45,226,74,70,89,41,3,199,41,99,43,40,41,5,229,1,109,107,80,94,13,22,65,35,
+36,62,38,89,78,66,109,66,84,164,114,215,73,20,74,56,18,3,179,71,94,107,252,
+162,4,27,71,33,32,126,61,0,2,255,196,255,109,4,39,4,250,0,26,0,34,0,0,5,35,
+39,38,38,39,39,54,37,17,6,6,7,39,17,35,39,33,23,33,17,20,7,54,54,55,23,3,
+35,53,6,7,22,22,23,3,62,4,102,86,249,126,67,157,1,110,137,191,146,100,135,
+70,4,29,70,252,217,4,93,205,146,134,110,1,160,137,84,173,41,147,74,105,104,
+4,199,90,139,1,17,87,164,149,66,2,148,107,107,254,222,100,75,93,153,87,113,
+253,209,24,58,63,33,130,63,0,0,4,0,54,255,232,7,125,5,15,0,42,0,48,0,54,0,
+59,0,0,5,35,39,38,36,39,39,17,35,39,38,36,39,39,54,55,38,38,53,52,54,51,50,
+22,21,20,6,35,34,38,39,6,21,20,22,23,54,55,53,39,33,23,35,35,33,17,54,36,
+55,21,6,6,7,4,19,1,4,7,4,19,6,148,4,103,113,254,200,212,54,4,103,123,254,
+200,211,79,142,135,70,93,138,100,90,91,65,53,49,68,1,78,79,86,131,207,31,
+4,78,70,233,110,253,80,167,1,67,198,148,245,124,1,78,183,252,226,254,226,
+234,1,75,189,24,74,187,216,28,149,253,114,74,182,194,32,220,96,67,29,119,
+85,93,128,82,67,54,62,53,55,26,80,50,70,9,64,79,180,48,107,254,77,112,160,
+72,191,55,126,87,112,254,187,2,169,107,163,118,254,217,0,0,2,255,196,255,
+136,4,107,4,250,0,30,0,36,0,0,5,35,39,38,36,39,39,36,37,38,39,22,21,20,6,
+35,34,38,53,52,54,51,50,22,23,17,33,39,33,23,35,3,6,7,22,22,23,3,130,4,102,
+73,254,225,161,67,1,13,1,18,117,181,10,96,86,86,104,137,110,162,230,61,252,
+247,70,4,97,70,233,110,139,204,98,202,43,120,74,91,116,6,199,137,94,193,20,
+31,35,74,90,106,89,99,122,190,141,1,246,107,107,253,21,42,88,35,129,60,0,
+3,0,12,255,199,5,13,5,159,0,37,0,48,0,54,0,0,5,35,39,38,36,39,39,54,36,55,
+53,39,1,39,55,54,53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,21,
+51,23,35,5,38,35,34,6,7,54,51,50,22,23,1,6,7,22,22,23,4,36,4,102,71,254,231,
+169,67,90,1,83,154,64,254,16,127,50,68,47,42,72,63,144,118,234,144,126,204,
+118,7,8,101,166,69,233,254,227,109,128,84,136,98,24,30,83,115,10,1,211,194,
+158,100,207,45,57,74,88,109,6,199,52,140,49,171,87,254,90,127,44,70,74,37,
+40,42,143,148,158,156,189,119,96,1,18,71,94,107,129,95,60,89,5,99,88,254,
+189,62,70,32,126,61,0,2,255,197,255,65,6,2,4,250,0,53,0,59,0,0,5,35,39,38,
+38,39,39,54,55,38,39,39,54,55,46,2,35,39,35,39,33,23,33,4,23,23,6,7,22,22,
+23,55,17,51,22,0,21,20,6,35,34,38,53,52,54,51,50,22,23,53,52,38,39,3,6,7,
+22,22,23,3,150,4,103,66,238,195,67,110,252,163,252,79,204,174,56,116,113,
+92,66,38,69,5,249,68,250,216,1,20,122,40,195,145,98,221,88,85,111,213,1,23,
+89,94,71,85,69,63,47,63,12,199,209,111,195,132,97,188,42,191,74,81,86,6,199,
+62,105,55,13,212,130,88,39,36,8,164,107,107,110,158,96,100,88,12,74,61,33,
+2,57,25,254,255,173,111,132,83,66,62,81,44,35,20,118,152,11,253,203,76,60,
+27,106,58,0,4,255,197,255,232,7,119,4,250,0,22,0,28,0,34,0,40,0,0,5,35,39,
+38,36,39,39,17,35,39,38,36,39,39,54,36,55,53,33,39,33,23,35,35,33,17,54,36,
+55,5,6,6,7,4,19,1,6,6,7,4,19,6,142,4,103,113,254,200,212,54,4,103,113,254,
+200,212,84,176,1,80,206,253,8,69,7,108,70,233,110,253,80,167,1,67,198,252,
+226,148,245,124,1,78,183,3,30,148,245,124,1,78,183,24,74,187,216,28,149,253,
+114,74,187,216,28,231,120,169,75,91,107,107,254,77,112,160,72,191,55,126,
+87,112,254,187,2,193,55,126,87,112,254,187,0,3,255,197,255,24,4,213,4,250,
+0,3,0,47,0,54,0,0,1,33,39,33,1,35,39,38,38,39,39,54,55,38,2,3,55,18,0,51,
+50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,54,55,22,22,21,20,
+6,15,2,6,7,22,22,23,4,213,251,53,69,4,203,254,250,4,102,86,249,126,67,84,
+108,137,201,84,79,114,1,8,194,131,163,30,73,148,105,114,142,94,73,66,84,24,
+57,113,65,85,103,98,87,110,2,151,145,84,173,41,4,143,107,250,30,74,105,104,
+4,199,47,48,75,1,88,1,21,32,254,200,254,234,132,106,62,45,69,74,121,98,72,
+93,85,70,47,37,20,114,112,69,196,117,127,181,48,40,1,53,67,33,130,63,0,3,
+255,197,255,233,4,118,4,250,0,38,0,53,0,59,0,0,5,35,39,38,36,39,39,54,36,
+55,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,23,35,
+22,21,20,6,7,1,22,23,22,22,23,22,22,51,50,54,53,52,38,39,3,6,7,22,22,23,3,
+110,4,102,79,254,236,136,67,78,1,0,130,43,66,41,41,57,37,13,85,78,83,90,95,
+93,50,96,102,69,4,108,69,225,81,63,57,253,163,50,29,49,80,52,61,87,54,63,
+73,34,27,42,178,150,91,193,44,23,74,97,127,5,199,44,116,49,16,54,43,43,46,
+10,37,43,76,91,103,82,87,115,2,77,48,107,107,110,134,83,118,28,1,217,51,85,
+13,47,39,46,44,75,76,51,92,31,253,138,63,69,36,141,65,0,0,3,255,197,255,65,
+4,124,4,250,0,23,0,34,0,40,0,0,5,35,39,38,38,39,39,54,55,38,37,39,54,55,46,
+2,35,39,35,39,33,23,35,3,17,33,4,23,23,6,7,22,22,23,23,6,7,22,22,23,3,150,
+4,103,66,223,190,67,116,235,161,254,249,79,204,174,56,116,113,92,66,38,69,
+4,115,68,230,110,253,178,1,20,122,40,195,145,100,225,88,78,203,106,92,176,
+41,191,74,81,86,6,199,66,98,56,15,212,130,88,39,36,8,164,107,107,253,96,2,
+160,110,158,96,100,88,12,76,63,149,82,48,28,105,57,0,4,255,197,254,254,3,
+231,4,250,0,20,0,26,0,38,0,44,0,0,1,35,39,38,38,39,39,54,37,38,37,39,54,36,
+55,53,33,39,33,23,35,7,6,7,22,22,23,5,20,6,35,34,38,53,52,54,51,50,22,5,6,
+7,22,22,23,2,255,4,103,69,190,170,67,212,1,30,208,254,189,84,122,1,70,161,
+253,122,69,3,221,69,232,111,241,180,107,254,60,254,254,55,39,40,56,56,40,
+39,55,1,2,144,120,78,148,38,254,254,74,84,84,5,199,119,109,167,34,242,69,
+143,54,42,107,107,235,94,91,25,139,66,91,41,52,53,40,41,54,54,233,58,59,26,
+104,58,0,2,255,197,255,149,4,140,4,250,0,49,0,55,0,0,5,35,39,38,38,39,39,
+54,37,53,38,35,34,21,39,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,
+38,38,53,52,54,51,50,23,54,51,50,23,17,33,39,33,23,35,3,6,7,22,22,23,3,163,
+4,102,86,249,126,67,159,1,109,71,74,90,41,62,152,84,86,35,5,75,58,67,82,88,
+75,65,120,75,132,105,133,72,27,100,107,85,252,213,69,4,130,69,233,110,165,
+133,84,173,41,107,74,105,104,4,199,91,138,166,100,142,15,130,70,60,62,35,
+49,63,84,64,64,77,80,147,95,114,144,142,138,179,1,41,107,107,253,28,60,61,
+33,130,63,0,0,2,255,197,255,162,4,212,5,159,0,55,0,61,0,0,5,35,39,38,36,39,
+39,54,36,55,17,38,38,35,34,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+54,55,38,38,35,35,39,51,50,22,23,54,51,50,22,23,39,17,51,23,21,51,23,35,3,
+6,7,22,22,23,3,234,4,101,74,254,213,158,67,90,1,92,156,69,104,61,70,80,105,
+107,75,65,64,93,17,17,92,67,62,77,115,127,58,102,71,93,69,157,79,112,90,118,
+117,79,136,66,2,8,100,165,70,234,109,157,205,102,215,45,94,74,91,117,5,199,
+51,136,46,1,46,110,94,100,56,143,76,73,71,79,79,75,83,78,66,79,163,59,59,
+51,107,59,102,175,126,120,139,1,2,71,94,107,253,45,38,86,35,132,62,0,0,4,
+255,196,0,3,3,237,4,250,0,23,0,31,0,39,0,45,0,0,37,35,39,38,38,39,39,54,55,
+38,38,53,52,55,35,39,33,23,33,22,22,21,20,7,39,54,53,52,38,35,34,7,7,6,21,
+20,22,51,50,55,7,6,7,22,22,23,2,243,4,102,86,249,126,67,109,203,152,195,36,
+113,69,3,227,70,254,198,81,96,113,60,19,141,94,75,52,54,37,142,103,95,52,
+9,165,133,84,173,41,3,74,105,104,4,199,63,83,43,225,131,81,52,107,107,55,
+149,83,151,68,168,46,61,88,135,32,49,52,73,98,134,48,232,60,61,33,130,63,
+0,0,3,255,197,0,0,4,186,4,250,0,34,0,43,0,49,0,0,33,35,39,38,38,39,39,54,
+37,38,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,23,35,22,21,20,
+6,7,1,22,22,51,50,54,53,52,39,3,6,7,22,22,23,3,140,4,102,86,249,126,67,159,
+1,87,139,67,33,120,87,81,143,55,71,38,74,47,61,71,34,11,254,64,69,4,175,70,
+225,71,83,65,254,209,11,103,89,59,62,45,86,165,133,84,173,41,74,105,104,4,
+199,90,131,35,188,111,129,126,130,37,75,70,94,138,97,107,107,116,116,96,112,
+19,1,203,145,163,72,64,95,77,253,135,60,61,33,130,63,0,2,255,197,254,245,
+4,61,4,250,0,49,0,55,0,0,1,35,39,38,38,39,39,54,37,38,39,39,22,51,50,54,53,
+52,38,35,7,21,20,6,35,34,38,53,52,54,55,38,39,33,39,33,23,33,22,23,22,22,
+21,20,7,22,23,7,38,39,7,6,7,22,22,23,3,2,4,102,86,249,126,67,139,1,6,162,
+210,37,127,182,149,153,107,99,38,80,101,73,94,124,104,31,56,254,234,69,4,
+51,69,253,102,26,19,174,207,187,177,153,35,89,94,110,148,151,85,172,42,254,
+245,74,105,104,4,199,79,103,32,9,184,36,102,93,71,81,2,18,95,103,90,72,82,
+100,13,51,40,107,107,37,50,5,181,149,190,85,49,86,81,48,34,66,54,70,33,130,
+63,0,0,4,255,197,255,98,3,232,4,250,0,19,0,23,0,30,0,36,0,0,5,35,39,38,38,
+39,39,54,55,38,37,39,36,37,53,33,39,33,23,35,7,7,22,23,21,38,39,7,22,4,23,
+21,6,7,22,22,23,2,255,4,103,69,190,170,67,165,242,182,254,254,84,1,13,1,84,
+253,122,69,3,222,69,233,111,177,111,66,115,180,142,102,1,14,65,154,120,79,
+156,39,158,74,84,84,5,199,94,97,109,29,242,152,113,43,107,107,221,75,75,79,
+97,130,70,68,22,144,69,174,63,58,27,108,58,0,0,4,255,197,254,74,3,233,4,250,
+0,20,0,26,0,34,0,40,0,0,1,35,39,38,38,39,39,54,37,53,38,37,39,36,37,53,33,
+39,33,23,35,7,6,7,22,22,23,3,38,38,39,39,50,22,23,19,6,7,22,22,23,2,255,4,
+103,69,190,170,67,220,1,16,207,254,194,84,1,13,1,84,253,122,69,3,223,69,234,
+111,241,180,107,254,60,99,76,172,100,44,119,225,86,61,144,120,78,148,38,254,
+74,74,84,84,5,199,126,107,180,162,34,242,152,113,43,107,107,235,94,91,25,
+139,66,254,246,54,37,6,141,91,84,254,252,58,59,26,104,58,0,4,255,197,254,
+205,6,80,4,250,0,66,0,82,0,89,0,95,0,0,1,35,39,38,38,39,39,54,37,38,39,23,
+20,6,35,34,38,53,52,54,55,38,38,39,21,20,6,35,34,38,53,52,54,55,38,39,35,
+39,33,23,33,17,54,51,50,22,22,21,20,6,35,34,38,53,52,54,51,50,22,23,55,52,
+38,35,34,15,2,34,38,53,53,33,22,23,22,22,23,22,22,23,38,53,3,20,51,50,55,
+17,35,19,6,7,22,22,23,3,250,4,102,86,249,126,67,148,1,64,113,131,1,70,65,
+69,77,91,83,25,84,51,68,65,69,79,92,84,40,71,116,69,6,70,69,253,170,54,53,
+114,167,88,95,85,71,88,72,63,43,57,11,1,86,76,65,83,74,111,150,183,254,197,
+46,21,91,145,29,95,174,54,7,222,85,47,90,222,223,165,133,84,173,41,254,205,
+74,105,104,4,199,84,124,108,21,13,67,72,86,66,73,94,1,62,85,17,6,68,71,85,
+68,73,93,1,88,56,107,107,254,255,13,87,148,87,116,128,83,67,61,80,41,28,21,
+78,92,31,23,13,167,134,163,68,91,33,181,121,24,135,88,92,131,1,25,88,32,1,
+37,252,84,60,61,33,130,63,0,4,255,197,254,139,7,52,4,250,0,58,0,68,0,94,0,
+100,0,0,1,35,39,38,38,39,39,54,55,38,2,3,55,18,0,51,50,54,53,52,39,6,6,35,
+34,38,53,52,54,55,5,33,39,33,23,33,22,22,23,22,23,54,54,51,50,22,21,20,7,
+22,21,20,6,35,34,38,39,6,7,3,38,39,6,21,20,22,51,50,54,1,52,39,6,35,34,38,
+53,52,54,51,50,23,54,53,52,38,35,34,6,21,20,22,51,50,54,1,6,7,22,22,23,3,
+206,4,103,69,190,170,83,65,102,160,237,90,82,124,1,23,215,150,167,21,73,176,
+88,125,138,84,77,254,251,254,191,69,7,42,69,252,78,6,44,49,64,35,23,155,135,
+125,147,55,60,144,121,91,155,40,44,117,25,142,36,232,72,62,84,129,2,195,30,
+68,86,60,76,73,55,78,62,42,87,70,117,153,140,118,81,98,253,38,172,144,87,
+183,46,254,139,74,84,84,5,232,38,48,74,1,144,1,91,25,254,123,254,203,128,
+117,65,53,67,74,146,123,92,182,65,3,107,107,79,109,62,58,64,122,161,146,122,
+96,65,78,101,114,135,109,94,145,72,2,130,103,155,132,169,60,65,86,254,251,
+47,34,61,62,63,59,66,48,42,60,53,65,172,127,129,148,68,254,232,69,74,18,116,
+69,0,3,255,197,254,74,4,140,4,250,0,47,0,59,0,65,0,0,1,35,39,38,38,39,39,
+54,37,53,6,35,34,0,3,55,18,22,51,50,54,53,52,39,6,35,34,38,38,53,53,33,39,
+33,23,33,17,20,22,51,50,54,55,22,22,21,20,7,5,20,6,35,34,38,53,52,54,51,50,
+22,5,6,7,22,22,23,3,169,4,103,69,190,170,67,220,1,16,80,106,224,254,225,87,
+83,92,231,185,131,149,29,140,159,53,85,47,254,122,69,4,130,69,253,118,20,
+22,47,116,82,96,117,77,254,39,55,39,40,56,56,40,39,55,1,106,144,120,78,148,
+38,254,74,74,84,84,5,199,126,107,102,40,1,85,1,92,28,254,229,242,128,111,
+67,47,180,49,108,103,239,107,107,254,227,28,23,102,123,67,176,123,154,101,
+228,41,52,53,40,41,54,54,194,58,59,26,104,58,0,0,3,255,197,254,84,4,29,4,
+250,0,43,0,55,0,61,0,0,1,35,39,38,38,39,39,54,37,53,6,35,34,38,38,53,17,35,
+39,33,23,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,6,
+7,1,20,6,35,34,38,53,52,54,51,50,22,5,6,7,22,22,23,3,23,4,103,69,190,170,
+67,220,1,16,117,150,75,117,57,154,69,4,19,69,252,246,26,59,48,114,181,34,
+43,65,77,86,97,98,110,126,55,51,254,39,55,39,40,56,56,40,39,55,1,106,144,
+120,78,148,38,254,84,74,84,84,5,199,126,107,150,68,58,119,122,2,23,107,107,
+254,8,102,74,35,144,119,34,89,73,79,97,138,119,75,141,56,254,239,41,52,53,
+40,41,54,54,194,58,59,26,104,58,0,4,255,197,254,164,4,125,4,250,0,24,0,34,
+0,46,0,52,0,0,1,35,39,38,38,39,39,54,55,38,36,39,39,54,55,46,2,35,39,35,39,
+33,23,35,1,6,7,22,4,23,17,33,4,23,3,20,6,35,34,38,53,52,54,51,50,22,5,6,7,
+22,22,23,3,150,4,102,69,190,170,67,231,254,124,254,200,173,79,204,174,56,
+116,113,92,66,38,69,4,116,68,231,254,250,195,145,129,1,21,86,253,178,1,20,
+122,158,55,39,40,56,56,40,39,55,1,94,144,120,78,148,38,254,164,74,84,84,5,
+199,130,100,80,72,10,212,130,88,39,36,8,164,107,107,254,148,100,88,16,111,
+93,3,4,110,158,253,176,41,52,53,40,41,54,54,204,58,59,26,104,58,0,2,255,197,
+255,184,6,251,4,250,0,3,0,83,0,0,1,33,39,33,1,35,39,38,38,35,34,7,6,35,32,
+17,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,38,53,17,52,38,38,35,34,6,
+7,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,51,50,22,21,20,
+6,35,34,38,53,52,54,51,50,22,21,21,54,53,52,38,35,34,7,6,251,249,15,69,6,
+241,253,83,8,103,52,83,72,54,99,104,43,254,179,26,89,20,121,119,37,86,79,
+45,79,115,72,8,26,53,45,94,171,34,37,68,75,82,101,95,97,120,114,203,128,112,
+118,8,121,163,154,194,158,130,92,115,86,65,59,83,106,109,94,194,137,4,143,
+107,250,190,74,78,50,15,14,1,146,113,107,21,85,80,131,117,10,11,86,127,95,
+117,1,190,98,81,31,156,114,43,89,65,77,94,132,111,111,193,116,118,129,145,
+191,152,144,172,97,81,66,84,68,63,16,35,138,75,91,214,0,0,1,0,93,255,194,
+4,243,5,159,0,69,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,
+51,50,55,54,51,50,22,23,38,53,53,46,2,39,39,23,50,54,53,52,39,6,6,35,34,38,
+53,52,54,51,50,22,21,7,54,55,22,21,20,6,7,22,23,17,51,23,21,51,23,35,4,10,
+8,103,52,83,72,54,99,104,43,157,166,13,93,9,228,37,86,79,45,83,112,71,8,72,
+211,205,136,82,40,192,200,34,59,150,81,90,110,64,59,58,66,3,89,117,172,86,
+87,230,119,8,101,166,69,233,62,74,78,50,15,14,177,166,57,81,13,46,43,204,
+10,11,79,121,95,117,45,79,80,24,4,209,1,104,98,68,47,84,83,83,82,53,76,70,
+57,36,59,182,165,202,103,123,31,46,157,3,217,71,94,107,0,0,1,0,106,255,197,
+5,1,5,159,0,69,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,51,
+50,55,54,51,50,22,23,38,53,17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,62,
+2,53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,21,51,23,35,4,25,8,
+103,52,83,72,54,99,104,43,157,166,13,93,9,228,37,86,79,45,83,112,71,8,111,
+162,107,59,97,49,63,72,111,135,130,175,122,120,126,75,59,53,138,133,139,110,
+195,117,108,176,135,9,8,101,165,69,232,59,74,78,50,15,14,177,166,57,81,13,
+46,43,204,10,11,79,121,95,117,1,244,170,130,39,49,18,122,99,98,165,112,185,
+41,56,72,50,43,45,106,137,167,142,141,211,78,133,1,36,71,94,107,0,0,2,255,
+197,255,197,4,189,4,250,0,46,0,64,0,0,5,35,39,38,38,35,34,6,7,6,35,34,38,
+53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,38,53,53,38,36,35,39,54,55,
+38,53,52,55,35,39,33,23,35,3,6,6,7,22,4,23,17,33,34,6,21,20,22,51,50,55,55,
+3,213,8,103,52,83,72,40,92,10,85,50,157,159,13,93,9,100,121,44,67,90,23,83,
+112,71,8,109,254,187,189,79,98,121,205,30,202,69,4,179,69,232,218,175,147,
+63,140,1,7,89,254,146,74,94,78,59,45,54,119,59,71,78,50,12,1,13,173,167,57,
+81,13,46,43,96,105,9,9,79,121,95,117,47,83,81,204,57,65,56,150,61,44,107,
+107,254,196,80,70,37,23,112,91,2,217,63,64,49,64,23,56,0,2,255,197,255,111,
+4,7,5,12,0,82,0,93,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,
+20,22,51,50,55,54,51,50,22,22,23,38,53,53,6,35,34,0,3,55,30,2,51,32,53,52,
+39,6,6,35,34,38,53,53,38,39,33,39,33,22,23,54,54,51,50,22,21,20,6,35,34,39,
+21,20,22,51,50,54,55,22,22,21,20,7,3,54,53,52,38,35,34,7,22,51,50,3,174,8,
+103,47,78,62,29,78,90,50,136,150,13,93,9,94,97,18,81,61,34,61,83,62,40,8,
+69,83,196,254,219,96,82,68,148,168,108,1,11,12,62,144,62,106,112,96,75,255,
+0,69,1,110,57,77,14,107,90,86,108,102,119,42,36,23,29,63,169,67,58,75,89,
+227,35,41,36,110,14,29,37,65,145,74,80,48,12,14,176,164,57,81,13,46,43,93,
+108,9,9,43,82,75,95,117,109,25,1,69,1,119,25,215,242,96,214,43,24,58,54,119,
+110,79,64,134,107,120,57,89,106,108,84,78,111,9,69,25,19,91,74,57,157,89,
+159,93,2,136,23,44,29,39,151,7,0,2,255,197,254,240,4,75,4,250,0,52,0,65,0,
+0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,22,22,23,38,53,17,6,35,34,38,38,53,17,33,39,33,23,33,21,30,2,51,55,23,
+6,7,37,20,22,22,51,50,54,54,55,46,2,39,3,113,8,103,47,78,62,29,78,90,50,136,
+150,33,85,21,94,97,18,81,61,34,61,83,62,40,8,112,148,76,109,58,254,255,69,
+4,65,69,253,47,46,116,133,113,68,106,22,57,254,9,26,56,46,76,112,67,15,85,
+134,131,48,254,240,73,80,48,12,14,176,164,113,106,24,87,72,93,108,9,9,43,
+82,75,95,117,1,32,123,56,122,121,2,83,107,107,28,75,69,18,4,124,154,131,31,
+100,78,33,138,190,88,6,32,93,88,0,0,2,255,197,254,216,4,220,4,250,0,70,0,
+79,0,0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,
+51,50,22,22,23,38,53,53,38,38,39,39,22,51,32,17,52,33,35,6,6,35,34,38,38,
+53,17,35,39,33,23,33,21,22,22,51,51,22,22,21,16,5,22,23,7,38,39,1,20,22,51,
+50,55,38,38,39,3,118,8,103,47,78,62,29,78,90,50,136,150,13,93,9,94,97,18,
+81,61,34,61,83,62,40,8,113,226,153,41,149,162,1,169,254,242,1,40,179,118,
+61,84,45,170,69,4,210,69,252,71,47,143,88,95,205,215,254,205,179,187,48,112,
+97,253,173,36,43,114,46,75,114,50,254,216,74,80,48,12,14,176,164,57,81,13,
+46,43,93,108,9,9,43,82,75,95,117,147,38,39,14,189,41,1,6,179,160,165,47,92,
+106,1,79,107,107,14,58,41,4,185,164,254,220,74,57,129,72,69,42,2,113,66,45,
+212,16,75,65,0,1,255,197,255,49,6,186,4,250,0,90,0,0,5,39,38,38,35,34,6,7,
+6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,54,51,50,23,38,53,52,55,
+38,38,39,6,6,21,20,22,51,50,54,55,22,22,21,20,6,35,34,0,3,55,18,0,51,50,54,
+53,52,39,6,6,35,34,38,53,52,54,55,6,35,33,39,33,23,33,22,22,51,55,23,6,6,
+21,20,18,23,5,189,11,31,112,93,89,162,114,122,182,105,166,189,27,91,21,129,
+131,83,162,114,106,148,73,154,109,73,57,146,214,77,167,195,65,55,80,143,76,
+88,68,212,184,244,254,183,113,82,119,1,13,205,143,163,18,69,155,97,108,136,
+101,114,99,198,254,129,69,6,176,69,253,72,70,194,131,33,117,69,53,51,50,207,
+22,57,49,22,21,23,23,180,170,113,106,17,105,55,117,100,21,21,19,20,121,232,
+195,228,164,33,168,145,77,152,90,60,62,122,114,79,168,99,189,215,1,155,1,
+179,25,254,139,254,207,123,112,58,49,69,72,148,116,96,157,84,5,107,107,114,
+103,1,137,107,248,142,117,254,243,105,0,0,2,255,197,255,197,5,153,5,159,0,
+56,0,62,0,0,1,35,39,38,39,17,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,
+21,20,22,51,50,55,54,51,50,22,23,38,53,53,38,37,39,54,36,55,53,33,39,33,17,
+22,22,23,17,51,23,21,51,23,35,5,4,7,22,4,23,4,176,4,103,87,132,8,103,41,71,
+56,54,82,86,44,134,142,13,93,9,77,104,38,68,59,48,77,99,51,8,207,254,194,
+84,122,1,70,161,253,15,69,3,165,64,114,37,8,101,166,69,233,254,75,254,245,
+165,106,1,4,66,1,9,74,148,110,253,112,74,73,55,11,10,170,165,57,81,13,46,
+43,97,99,6,7,83,117,95,117,99,162,34,242,69,143,54,42,107,253,233,55,141,
+68,3,196,71,94,107,227,106,85,22,140,70,0,0,2,0,73,255,65,6,61,5,7,0,97,0,
+123,0,0,5,35,39,38,38,35,34,7,6,35,32,17,52,55,23,6,21,20,22,51,50,55,54,
+51,50,22,23,38,53,53,38,38,35,34,7,6,6,35,34,38,53,52,55,23,6,21,20,22,51,
+50,55,54,51,50,22,23,38,53,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,
+38,53,52,54,54,51,50,23,54,51,50,22,21,20,7,22,21,20,6,35,34,38,39,37,52,
+39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,21,20,22,51,50,54,4,40,
+8,103,52,83,72,55,124,128,43,254,189,11,90,4,104,124,36,112,101,48,83,112,
+71,8,46,85,70,47,94,11,87,37,158,185,26,89,20,128,122,34,77,74,38,78,118,
+64,8,26,53,45,94,171,34,37,68,75,82,101,95,97,120,114,203,128,201,31,86,178,
+125,147,55,60,144,121,81,143,44,1,184,30,68,86,60,76,73,55,78,62,42,87,70,
+117,153,140,118,81,98,191,74,78,50,15,14,1,67,38,68,11,28,31,92,92,10,11,
+79,121,95,117,33,71,57,12,1,10,186,212,113,107,21,85,80,130,114,7,8,88,116,
+95,117,1,171,98,81,31,156,114,43,89,65,77,94,132,111,111,193,116,192,146,
+146,122,96,65,78,101,114,135,88,78,119,47,34,61,62,63,59,66,48,42,60,53,65,
+172,127,129,148,68,0,1,255,197,254,212,4,82,7,86,0,88,0,0,1,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,17,
+6,35,34,38,38,53,17,35,39,33,38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,22,
+51,50,55,55,50,22,23,51,23,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,54,
+51,50,22,21,20,7,3,110,8,103,47,78,62,29,78,90,50,136,150,21,88,12,94,97,
+18,81,61,34,61,83,62,40,8,121,166,75,117,57,221,69,3,79,15,72,76,35,100,77,
+31,149,143,7,85,2,84,132,39,70,90,128,133,21,160,69,253,4,26,59,48,106,177,
+32,43,65,77,86,97,98,110,126,72,254,212,74,80,48,12,14,176,164,90,86,20,60,
+60,93,108,9,9,43,82,75,95,117,1,19,83,58,119,122,2,83,107,104,91,8,7,168,
+154,52,50,9,51,103,85,6,6,165,203,107,253,204,102,74,35,150,113,34,89,73,
+79,97,138,119,130,105,0,0,2,255,197,254,216,4,67,7,86,0,69,0,84,0,0,1,35,
+39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,
+23,38,53,53,6,35,34,38,39,62,2,53,52,39,33,39,33,46,2,53,52,54,55,23,6,6,
+21,20,22,23,33,23,33,34,39,22,22,21,20,7,1,6,7,22,51,50,54,53,52,38,39,22,
+22,21,20,3,100,8,103,47,72,58,29,78,90,50,136,150,21,88,12,94,97,18,81,61,
+34,61,77,55,43,8,73,95,179,224,39,118,142,84,37,254,68,69,1,213,60,64,38,
+70,89,124,75,68,59,72,1,248,68,254,165,61,48,186,122,75,254,186,68,125,47,
+179,118,93,106,138,34,34,254,216,74,83,45,12,14,176,164,90,86,20,60,60,93,
+108,9,9,43,78,79,95,117,243,28,211,244,19,48,98,86,77,84,107,81,98,104,59,
+73,129,60,135,48,91,56,62,123,89,107,4,206,230,115,135,83,1,49,68,35,194,
+149,98,109,219,163,80,115,57,120,0,0,1,255,197,254,200,4,172,4,250,0,70,0,
+0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,
+51,50,22,22,23,38,53,53,6,35,34,0,3,55,18,22,51,50,54,53,52,39,6,35,34,38,
+38,53,17,33,39,33,23,33,17,20,22,51,50,54,55,22,22,21,20,7,3,174,8,103,47,
+78,62,28,106,122,51,136,150,21,88,12,94,97,24,90,16,86,38,61,83,62,40,8,72,
+89,220,254,223,89,81,93,231,178,121,157,26,137,155,53,85,47,254,92,69,4,162,
+69,253,116,20,22,47,116,82,89,114,92,254,200,74,80,48,12,14,176,164,90,86,
+20,60,60,93,108,8,1,9,43,82,75,95,117,197,33,1,90,1,97,27,254,226,248,147,
+112,74,54,171,49,108,103,1,10,107,107,254,200,28,23,102,123,62,200,127,179,
+110,0,1,255,197,254,186,4,82,4,250,0,65,0,0,1,35,39,38,38,35,34,7,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,17,6,35,34,38,
+38,53,17,35,39,33,23,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,
+22,21,20,7,55,3,110,8,103,47,78,62,29,78,90,50,136,150,21,88,12,94,97,18,
+81,61,34,61,83,62,40,8,121,166,75,117,57,221,69,4,72,69,253,4,26,59,48,106,
+177,32,43,65,77,86,97,98,110,126,75,3,254,186,74,80,48,12,14,176,164,90,86,
+20,60,60,93,108,9,9,43,82,75,95,117,1,65,83,58,119,122,2,63,107,107,253,224,
+102,74,35,150,113,34,89,73,79,97,138,119,134,105,1,0,0,1,0,97,255,224,4,217,
+5,159,0,68,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,
+55,54,51,50,22,22,23,38,53,17,38,38,35,34,6,21,20,22,23,39,52,54,51,50,22,
+21,20,6,35,34,38,38,53,52,54,51,50,22,23,38,53,17,51,23,21,51,23,35,3,240,
+8,103,47,72,58,27,120,138,52,136,150,17,89,9,94,97,74,176,34,61,77,55,43,
+8,110,190,122,104,127,52,39,1,84,65,74,86,99,92,79,141,87,179,139,114,193,
+136,9,8,101,166,69,233,32,74,83,45,12,14,176,164,80,78,17,48,57,93,108,4,
+14,43,78,79,95,117,1,175,175,138,107,87,59,75,14,19,66,78,90,70,79,85,82,
+161,114,151,190,169,228,78,136,1,78,71,94,107,0,0,2,255,197,255,184,4,213,
+4,250,0,3,0,59,0,0,1,33,39,33,3,35,39,38,38,35,34,7,6,35,32,17,52,55,23,6,
+21,20,22,51,50,55,54,51,50,22,23,38,53,17,52,38,38,35,34,6,7,54,51,50,22,
+21,20,6,35,34,38,53,52,54,54,51,50,22,22,21,4,213,251,53,69,4,203,135,8,103,
+52,83,72,54,99,104,43,254,179,26,89,20,121,119,37,86,79,45,79,115,72,8,26,
+53,45,94,171,34,37,68,75,82,101,95,97,120,114,203,128,76,109,55,4,143,107,
+250,190,74,78,50,15,14,1,146,113,107,21,85,80,131,117,10,11,86,127,95,117,
+1,190,98,81,31,156,114,43,89,65,77,94,132,111,111,193,116,58,129,119,0,0,
+1,0,91,255,80,4,252,5,159,0,78,0,0,5,35,39,46,2,35,34,7,6,6,35,34,38,38,53,
+52,55,23,6,21,20,22,51,50,55,54,54,51,50,22,22,23,38,39,38,36,39,39,22,51,
+50,54,53,52,38,35,34,7,22,22,21,20,6,6,35,34,38,53,52,54,54,51,50,22,22,21,
+20,7,22,22,23,17,51,23,21,51,23,35,4,19,8,104,28,42,60,47,66,106,12,113,53,
+95,141,77,21,88,12,115,109,55,81,8,96,51,61,77,55,43,4,2,74,254,148,217,82,
+11,29,215,207,102,93,37,45,31,33,34,66,46,70,91,60,123,89,90,158,98,233,119,
+220,69,8,102,166,69,233,176,74,49,52,27,13,1,12,79,152,109,90,86,20,60,60,
+92,109,9,1,8,43,78,79,85,108,165,155,13,229,1,109,107,80,94,13,22,65,35,36,
+62,38,89,78,66,109,66,84,164,114,220,71,31,130,104,4,59,71,94,107,0,0,1,255,
+196,255,197,4,243,4,250,0,49,0,0,5,38,38,35,34,7,6,35,34,38,53,52,55,23,6,
+21,20,22,51,50,55,54,51,50,23,38,53,52,54,55,4,7,39,17,33,39,33,23,33,17,
+20,7,54,37,23,6,21,20,22,23,3,250,41,85,71,61,150,147,76,144,162,27,91,21,
+101,99,63,137,108,49,119,70,46,27,27,254,235,249,100,254,216,70,4,233,70,
+252,174,4,181,1,96,180,125,46,52,59,70,58,25,27,176,164,119,110,17,105,55,
+113,104,24,20,66,151,145,77,183,78,170,223,66,2,178,107,107,254,132,74,45,
+158,194,163,205,254,115,198,111,0,2,0,77,255,195,4,194,5,15,0,63,0,69,0,0,
+5,35,39,38,38,35,34,6,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,22,23,38,53,53,38,36,35,39,54,55,38,38,53,52,54,51,50,22,21,20,6,35,34,
+38,39,6,21,20,22,23,54,55,53,33,23,35,3,4,7,22,22,23,3,218,8,103,52,83,72,
+40,92,10,85,50,156,158,13,91,9,100,121,44,67,90,23,83,112,71,8,105,254,201,
+206,79,99,109,62,80,138,100,90,91,65,53,49,68,1,78,70,76,170,215,1,17,69,
+232,110,254,168,146,153,250,87,61,74,78,50,12,1,13,173,167,57,81,13,46,43,
+96,105,9,9,79,121,95,117,64,83,63,204,58,58,32,114,78,93,128,82,67,54,62,
+53,55,26,80,47,68,12,84,92,193,107,254,238,149,80,20,86,86,0,1,255,206,255,
+197,4,196,4,250,0,53,0,0,5,35,39,38,38,35,34,7,6,35,32,17,52,55,23,6,21,20,
+22,51,50,54,55,54,51,50,22,22,23,38,53,53,2,39,22,21,20,6,35,34,38,53,52,
+54,51,50,22,23,17,33,39,33,23,35,3,219,8,103,47,72,58,28,106,122,51,254,226,
+10,91,4,90,101,24,90,16,86,38,61,77,55,43,8,125,215,16,93,89,100,118,146,
+124,161,231,62,252,168,70,4,176,70,233,59,74,83,45,12,14,1,54,50,68,13,31,
+38,89,82,8,1,9,43,78,79,95,117,230,1,20,23,38,44,86,95,122,99,106,125,200,
+145,1,216,107,107,0,2,0,61,255,197,5,62,5,159,0,59,0,70,0,0,5,35,39,38,38,
+35,34,7,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,
+53,17,39,1,39,55,54,53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,
+21,51,23,35,5,38,35,34,6,7,54,51,50,22,23,4,85,8,103,47,72,58,67,130,15,136,
+52,147,166,21,88,12,115,109,58,101,126,56,61,77,55,43,8,64,254,16,127,50,
+68,47,42,72,63,144,118,234,144,126,204,118,7,8,101,166,69,233,254,227,109,
+128,84,136,98,24,30,83,115,10,59,74,83,45,13,1,12,181,159,90,86,20,60,60,
+92,109,9,9,43,78,79,95,117,1,253,87,254,90,127,44,70,74,37,40,42,143,148,
+158,156,189,119,96,1,18,71,94,107,129,95,60,89,5,99,88,0,1,255,197,255,195,
+6,98,4,250,0,78,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,
+22,51,50,55,54,51,50,22,22,23,38,53,53,46,2,47,2,54,55,46,2,35,39,35,39,33,
+23,33,4,23,23,6,7,22,4,23,17,51,22,0,21,20,6,35,34,38,53,52,54,51,50,22,23,
+53,52,38,39,3,234,8,102,47,72,58,65,102,130,43,143,160,21,88,12,106,108,55,
+76,72,78,61,77,55,43,8,81,186,175,123,51,79,204,174,56,116,113,92,66,122,
+69,6,89,68,250,204,1,20,122,40,195,145,142,1,10,84,111,213,1,23,89,94,71,
+85,69,63,47,63,12,199,209,61,74,83,45,13,13,176,164,90,86,20,60,60,93,108,
+9,9,43,78,79,95,147,3,53,55,20,6,3,212,130,88,39,36,8,164,107,107,110,158,
+96,100,88,15,86,89,2,133,25,254,255,173,111,132,83,66,62,81,44,35,20,118,
+152,11,0,0,2,255,197,255,197,4,120,4,250,0,42,0,48,0,0,5,35,39,46,2,35,34,
+7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,22,22,23,38,53,53,38,37,
+39,36,37,53,33,39,33,23,35,7,6,7,22,22,23,3,144,8,102,27,36,58,46,45,95,117,
+33,140,143,21,88,12,88,106,42,90,99,55,75,57,39,8,206,254,192,84,1,18,1,79,
+252,233,69,4,110,69,232,111,241,180,107,254,60,59,74,49,48,31,13,13,173,167,
+90,86,20,60,60,96,105,10,8,42,81,77,95,117,98,163,34,242,154,110,44,107,107,
+235,94,91,25,139,66,0,2,255,197,255,197,4,144,4,250,0,3,0,56,0,0,1,33,39,
+33,3,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,
+22,22,23,38,53,17,52,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,54,55,22,
+21,4,144,251,122,69,4,134,150,8,102,27,36,58,46,45,95,117,33,140,143,21,88,
+12,88,106,42,90,99,55,75,57,39,9,65,84,150,98,95,120,81,68,59,76,10,44,109,
+82,214,4,143,107,250,203,74,49,48,31,13,13,173,167,90,86,20,60,60,96,105,
+10,8,42,81,77,107,105,1,38,117,78,92,74,108,87,63,85,76,63,32,21,26,113,102,
+206,254,0,2,255,197,255,197,4,189,4,250,0,60,0,75,0,0,5,35,39,46,2,35,34,
+7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,22,22,23,38,53,17,38,38,
+39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,23,35,22,21,20,
+6,7,1,22,23,22,22,23,22,22,51,50,54,53,52,38,39,3,164,8,102,27,36,58,46,45,
+95,117,33,140,143,15,90,8,88,106,42,90,99,55,75,57,39,8,57,98,69,41,57,37,
+13,85,78,83,90,95,93,50,96,172,69,4,179,69,226,81,73,63,253,179,50,29,49,
+80,52,61,87,54,63,73,34,27,59,74,49,48,31,13,13,173,167,77,73,20,48,46,96,
+105,10,8,42,81,77,95,117,1,94,5,52,72,43,46,10,37,43,76,91,103,82,87,115,
+2,77,48,107,107,110,134,88,123,25,1,224,51,85,13,47,39,46,44,75,76,51,92,
+31,0,0,2,255,197,255,40,4,209,4,250,0,47,0,57,0,0,5,35,39,38,38,35,34,7,6,
+35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,38,36,
+39,39,54,55,46,2,35,39,35,39,33,23,35,1,6,7,22,4,23,17,33,4,23,3,234,8,102,
+47,72,58,65,102,130,43,143,160,21,88,12,106,108,55,76,72,78,61,77,55,43,8,
+146,254,182,140,79,204,174,56,116,113,92,66,122,69,4,200,68,231,254,250,190,
+150,119,1,29,88,253,178,1,20,122,216,74,83,45,13,13,176,164,90,86,20,60,60,
+93,108,9,9,43,78,79,95,117,89,97,131,8,212,130,88,39,36,8,164,107,107,254,
+148,97,91,18,156,97,3,55,110,158,0,0,3,255,197,255,113,4,120,4,250,0,43,0,
+49,0,61,0,0,5,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,
+55,55,50,22,22,23,38,53,53,38,37,39,54,36,55,53,33,39,33,23,35,7,6,7,22,22,
+23,7,20,6,35,34,38,53,52,54,51,50,22,3,144,8,102,27,36,58,46,45,95,117,33,
+140,143,21,88,12,88,106,42,90,99,55,75,57,39,8,206,254,192,84,124,1,68,161,
+252,233,69,4,110,69,232,111,241,180,107,254,60,223,64,46,47,67,66,48,46,64,
+143,74,49,48,31,13,13,173,167,90,86,20,60,60,96,105,10,8,42,81,77,95,117,
+182,163,34,242,70,142,54,42,107,107,235,94,91,25,139,66,125,49,60,62,47,48,
+64,64,0,0,1,255,197,255,131,5,178,4,250,0,78,0,0,5,35,39,46,2,35,34,7,6,35,
+34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,17,38,35,34,
+6,21,39,38,38,35,34,6,21,20,22,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,
+52,54,51,50,22,23,54,51,50,22,23,17,33,39,33,23,35,4,198,8,102,28,44,66,54,
+96,170,176,103,147,166,21,88,12,115,109,73,155,167,89,69,85,56,43,8,77,89,
+54,76,45,34,128,96,103,117,48,43,1,80,61,75,93,101,90,79,141,87,165,125,88,
+123,46,33,131,56,95,56,251,178,69,5,168,69,236,125,74,50,51,27,28,28,181,
+159,90,86,20,60,60,92,109,23,25,43,78,79,95,117,1,252,111,95,96,16,92,84,
+109,95,60,82,15,18,66,78,85,79,73,87,87,166,114,154,197,94,82,171,91,100,
+1,36,107,107,0,1,255,197,255,197,5,71,5,159,0,78,0,0,5,35,39,38,38,35,34,
+7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,17,38,
+38,35,34,6,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,38,38,35,
+35,39,33,50,22,23,54,54,51,50,22,23,39,17,51,23,21,51,23,35,4,94,8,102,47,
+72,58,58,254,77,51,143,160,21,88,12,106,108,59,119,162,41,61,77,55,43,8,69,
+104,61,40,58,32,105,107,75,65,64,93,17,17,92,67,62,77,115,127,58,102,71,228,
+69,1,36,79,112,90,63,92,60,79,136,66,2,8,100,165,70,233,59,74,83,45,20,6,
+176,164,90,86,20,60,60,93,108,9,9,43,78,79,95,117,2,93,110,94,51,48,57,142,
+77,73,71,79,79,75,83,78,66,79,163,59,59,51,107,59,102,92,83,126,120,139,1,
+2,71,94,107,0,0,3,255,197,255,197,4,33,4,250,0,42,0,50,0,58,0,0,5,35,39,46,
+2,35,7,32,17,52,55,23,6,21,20,22,51,55,50,22,23,38,53,17,6,35,34,38,38,53,
+52,55,35,39,33,23,33,22,22,21,20,7,39,54,53,52,38,35,34,7,7,6,21,20,22,51,
+50,55,3,78,8,102,31,34,55,47,205,254,238,21,88,12,85,82,164,66,93,67,8,54,
+62,120,224,138,36,164,69,4,22,70,254,198,81,96,74,99,19,141,94,75,52,54,37,
+140,105,95,52,59,74,54,47,27,13,1,82,90,86,20,60,60,92,109,7,74,126,95,117,
+1,53,15,114,193,111,81,52,107,107,55,149,83,121,69,139,46,61,88,135,32,49,
+52,73,100,132,48,0,2,255,197,255,197,4,192,4,250,0,57,0,66,0,0,5,35,39,46,
+2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,22,22,23,38,53,
+17,38,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,23,35,22,21,20,
+6,7,1,22,22,51,50,54,53,52,39,3,170,8,102,27,36,58,46,45,95,117,33,140,143,
+21,88,12,88,106,42,90,99,55,75,57,39,8,175,77,33,120,87,81,143,55,71,38,74,
+47,61,71,34,11,254,58,69,4,181,70,225,71,68,56,254,185,11,103,89,59,62,45,
+59,74,49,48,31,13,13,173,167,90,86,20,60,60,96,105,10,8,42,81,77,95,117,1,
+122,12,218,111,129,126,130,37,75,70,94,138,97,107,107,116,116,86,108,24,1,
+194,145,163,72,64,95,77,0,0,1,255,197,254,216,4,134,4,250,0,74,0,0,1,35,39,
+46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,22,22,23,38,
+53,53,36,37,39,22,51,50,54,53,52,38,35,34,7,21,20,6,35,34,38,53,52,54,55,
+38,39,33,39,33,23,33,22,23,22,22,21,20,6,7,22,23,7,38,39,3,145,8,102,27,36,
+58,46,45,95,117,33,140,143,21,88,12,88,106,42,90,99,55,75,57,39,8,254,251,
+254,237,41,126,179,166,166,121,95,31,27,80,101,73,94,124,104,31,56,254,140,
+69,4,124,69,253,123,27,17,192,220,137,106,175,173,35,59,67,254,216,74,49,
+48,31,13,13,173,167,90,86,20,60,60,96,105,10,8,42,81,77,95,117,165,140,12,
+183,35,119,96,75,97,4,16,95,103,90,72,82,100,13,51,40,107,107,39,48,4,191,
+160,120,158,37,83,149,81,45,43,0,3,255,197,255,233,4,120,4,250,0,42,0,46,
+0,53,0,0,5,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+55,50,22,22,23,38,53,53,38,37,39,36,37,53,33,39,33,23,35,7,7,22,23,21,38,
+39,7,22,22,23,3,144,8,102,27,36,58,46,45,95,117,33,140,143,21,88,12,88,106,
+42,90,99,55,75,57,39,8,205,254,191,84,1,13,1,84,252,233,69,4,110,69,232,111,
+167,99,68,105,181,136,103,254,65,23,74,49,48,31,13,13,173,167,90,86,20,60,
+60,96,105,10,8,42,81,77,95,117,62,161,36,242,152,113,43,107,107,235,69,67,
+71,106,114,78,65,23,137,69,0,3,255,197,255,96,4,120,4,250,0,42,0,48,0,56,
+0,0,5,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,
+22,22,23,38,53,53,38,37,39,36,37,53,33,39,33,23,35,7,6,7,22,22,23,3,38,38,
+39,39,50,22,23,3,144,8,102,27,36,58,46,45,95,117,33,140,143,21,88,12,88,106,
+42,90,99,55,75,57,39,8,206,254,192,84,1,25,1,72,252,233,69,4,110,69,232,111,
+241,180,107,254,60,104,76,172,100,44,119,225,86,160,74,49,48,31,13,13,173,
+167,90,86,20,60,60,96,105,10,8,42,81,77,95,117,199,163,34,242,157,108,43,
+107,107,235,94,91,25,139,66,254,246,54,37,6,141,91,84,0,3,255,197,255,138,
+6,79,4,250,0,89,0,105,0,112,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,
+23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,38,38,39,23,20,6,35,34,
+38,53,52,54,55,38,38,39,21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,23,33,
+17,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,55,52,38,35,34,15,2,
+34,38,53,53,33,22,23,22,22,23,22,22,23,38,53,3,20,51,50,55,17,35,4,10,8,102,
+47,72,58,65,102,130,43,143,160,21,88,12,106,108,55,76,72,78,61,77,55,43,8,
+55,155,90,1,70,65,69,77,91,83,25,84,51,68,65,69,79,92,84,40,71,132,69,6,69,
+69,253,187,54,53,172,197,95,85,71,88,72,63,43,57,11,1,85,77,59,89,74,111,
+150,183,254,197,46,21,91,145,29,95,174,54,7,222,85,47,90,222,118,74,83,45,
+13,13,176,164,90,86,20,60,60,93,108,9,9,43,78,79,95,117,63,70,105,15,13,67,
+72,86,66,73,94,1,62,85,17,6,68,71,85,68,73,93,1,88,56,107,107,254,255,13,
+203,179,116,128,83,67,61,80,41,28,21,109,121,31,23,13,167,134,163,68,91,33,
+181,121,24,135,88,92,131,1,25,88,32,1,37,0,3,255,197,254,186,7,52,4,250,0,
+83,0,93,0,119,0,0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,55,54,51,50,22,22,23,38,53,53,6,35,34,0,3,55,18,0,51,50,54,53,52,39,
+6,6,35,34,38,53,52,54,55,5,33,39,33,23,33,22,22,23,22,23,54,54,51,50,22,21,
+20,7,22,21,20,6,35,34,38,39,6,7,3,38,39,6,21,20,22,51,50,54,1,52,39,6,35,
+34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,21,20,22,51,50,54,4,28,8,102,
+47,72,58,66,111,143,40,143,160,21,88,12,106,108,55,85,99,62,61,77,55,43,8,
+86,117,249,254,175,118,82,124,1,23,215,150,167,21,73,176,88,125,138,84,77,
+254,251,254,191,69,7,42,69,252,78,6,44,49,64,35,23,155,135,125,147,55,60,
+144,121,91,155,40,27,56,103,142,36,232,72,62,84,129,2,195,30,68,86,60,76,
+73,55,78,62,42,87,70,117,153,140,118,81,98,254,186,74,83,45,13,13,176,164,
+90,86,20,60,60,93,108,9,9,43,78,79,95,117,135,43,1,157,1,197,25,254,123,254,
+203,128,117,65,53,67,74,146,123,92,182,65,3,107,107,79,109,62,58,64,122,161,
+146,122,96,65,78,101,114,135,109,94,91,61,2,65,103,155,132,169,60,65,86,254,
+251,47,34,61,62,63,59,66,48,42,60,53,65,172,127,129,148,68,0,2,255,197,254,
+107,4,140,4,250,0,69,0,81,0,0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,
+6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,17,6,35,34,0,3,55,18,22,51,50,
+54,53,52,39,6,35,34,38,38,53,53,33,39,33,23,33,21,20,22,51,50,54,55,22,22,
+21,20,7,3,20,6,35,34,38,53,52,54,51,50,22,3,169,8,103,47,78,62,38,74,94,51,
+136,150,13,93,9,94,97,23,81,65,35,61,83,62,40,8,80,106,224,254,225,87,81,
+92,232,186,131,149,29,140,159,53,85,47,254,122,69,4,130,69,253,118,20,22,
+47,116,82,96,117,77,246,64,46,47,67,66,48,46,64,254,107,74,80,48,12,14,176,
+164,57,81,13,46,43,93,108,9,9,43,82,75,95,117,1,141,40,1,85,1,92,28,254,230,
+243,128,111,67,47,180,49,108,103,209,107,107,255,28,23,102,123,67,176,123,
+154,101,254,189,49,60,62,47,48,64,64,0,2,255,197,254,85,4,82,4,250,0,64,0,
+76,0,0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,
+51,50,22,22,23,38,53,17,6,35,34,38,38,53,17,35,39,33,23,33,17,20,22,22,51,
+50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,7,1,20,6,35,34,38,53,52,54,51,
+50,22,3,110,8,103,47,78,62,29,78,90,50,136,150,21,88,12,94,97,18,81,61,34,
+61,83,62,40,8,121,166,75,117,57,221,69,4,72,69,253,4,26,59,48,106,177,32,
+43,65,77,86,97,98,110,126,72,254,225,64,46,47,67,66,48,46,64,254,85,74,80,
+48,12,14,176,164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,1,216,83,58,119,
+122,2,13,107,107,254,18,102,74,35,150,113,34,89,73,79,97,138,119,130,105,
+254,117,49,60,62,47,48,64,64,0,0,3,255,197,254,172,4,209,4,250,0,47,0,57,
+0,69,0,0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,22,22,23,38,53,17,38,36,39,39,54,55,46,2,35,39,35,39,33,23,35,1,
+6,7,22,4,23,17,33,4,23,3,20,6,35,34,38,53,52,54,51,50,22,3,234,8,102,47,72,
+58,65,102,130,43,143,160,21,88,12,106,108,55,76,72,78,61,77,55,43,8,125,254,
+199,178,79,146,232,56,116,113,92,66,122,69,4,200,68,231,254,250,239,101,130,
+1,20,86,253,178,1,20,122,19,64,46,47,67,66,48,46,64,254,172,74,83,45,13,13,
+176,164,90,86,20,60,60,93,108,9,9,43,78,79,95,117,1,38,82,73,10,212,93,115,
+39,36,8,164,107,107,254,148,119,59,16,111,93,2,250,110,158,253,103,49,60,
+62,47,48,64,64,0,0,3,255,197,255,136,5,68,4,250,0,58,0,65,0,71,0,0,5,35,39,
+38,38,39,39,54,55,38,38,39,39,54,54,55,53,33,39,33,23,33,21,22,22,21,20,6,
+35,34,38,53,52,54,51,50,22,23,52,38,39,17,22,22,21,20,35,34,38,53,52,54,51,
+50,22,23,38,38,39,39,17,6,7,22,22,23,23,6,7,22,22,23,2,240,4,103,69,190,170,
+84,199,154,67,159,113,84,187,240,153,253,136,69,5,58,69,253,172,212,241,77,
+81,67,68,60,54,42,55,9,228,152,192,230,165,63,75,60,54,42,55,9,1,188,150,
+110,180,196,88,174,61,53,179,124,85,175,43,120,74,84,84,5,232,116,64,34,31,
+7,228,109,116,46,57,107,107,56,20,189,146,96,114,76,52,54,70,41,32,107,96,
+5,254,176,20,214,158,214,72,56,54,70,41,32,106,137,5,178,1,74,58,116,25,92,
+57,168,69,72,22,117,65,0,0,2,255,197,255,241,4,214,7,86,0,92,0,99,0,0,1,33,
+21,22,22,21,20,6,35,34,38,53,52,54,51,50,22,23,52,38,39,17,20,6,6,7,14,2,
+21,20,22,51,50,54,55,38,38,53,52,54,51,50,22,21,20,6,6,35,34,38,38,53,52,
+54,54,55,55,38,38,39,39,36,55,53,33,39,33,38,38,35,34,7,6,35,34,38,53,52,
+55,23,7,20,22,51,50,55,54,51,50,22,23,51,1,6,7,22,23,54,53,4,214,253,230,
+187,206,77,81,67,68,60,54,42,55,9,186,134,46,66,54,45,51,35,67,74,80,143,
+48,51,68,79,62,72,91,116,175,89,122,161,76,48,69,57,44,75,158,115,70,1,23,
+249,253,189,69,3,176,15,72,76,37,76,102,68,148,144,7,85,2,93,123,53,80,72,
+34,127,134,21,195,253,188,127,177,157,109,38,4,143,54,22,193,157,96,114,76,
+52,54,70,41,32,105,108,7,254,231,67,96,61,38,32,45,63,42,46,58,54,50,1,63,
+53,58,71,97,75,96,133,65,84,135,78,55,86,62,41,33,61,62,6,201,151,70,57,107,
+105,96,9,12,176,146,52,50,9,51,101,87,10,8,169,205,254,164,38,87,52,122,50,
+54,0,0,2,255,197,254,109,4,224,7,86,0,122,0,129,0,0,1,35,39,38,38,35,34,7,
+6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,6,35,
+34,38,53,52,54,54,55,38,38,39,39,54,37,53,33,39,33,38,38,35,34,7,6,35,34,
+38,53,52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,23,33,21,22,22,21,20,6,
+35,34,38,53,52,54,51,50,22,23,52,38,39,21,20,6,6,7,14,2,21,20,22,51,50,54,
+55,38,38,53,52,54,51,50,22,21,20,7,1,6,7,22,23,54,53,3,166,8,103,47,78,62,
+29,78,90,50,136,150,21,88,12,94,97,18,81,61,34,61,83,62,40,8,93,100,167,189,
+48,70,56,64,143,100,70,236,1,36,253,179,69,3,186,15,72,76,37,76,102,68,148,
+144,7,85,2,93,123,53,80,72,34,127,134,21,195,69,253,230,186,207,77,81,67,
+68,60,54,42,55,9,178,142,50,71,56,41,48,31,67,74,80,143,48,51,68,79,62,72,
+91,76,254,177,145,172,145,105,67,254,109,74,80,48,12,14,176,164,90,86,20,
+60,60,93,108,9,9,43,82,75,95,117,116,39,160,143,55,89,66,42,45,47,6,201,128,
+83,47,107,105,96,9,12,176,146,52,50,9,51,101,87,10,8,169,205,107,44,22,175,
+135,96,114,76,52,54,70,41,32,80,108,9,198,86,117,69,40,30,43,59,40,46,58,
+54,50,1,63,53,58,71,97,75,108,74,3,12,41,80,46,103,63,61,0,0,2,255,197,255,
+215,7,155,4,250,0,3,0,82,0,0,1,33,39,33,1,54,53,52,38,35,34,6,7,22,21,20,
+6,35,32,0,3,55,18,18,22,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,23,54,
+53,52,38,35,34,6,7,55,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,51,
+50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,7,155,248,111,69,7,144,254,236,
+106,109,94,118,167,63,75,224,195,254,221,254,143,101,82,86,216,235,147,144,
+170,36,78,95,74,82,85,72,51,47,75,99,92,123,181,75,24,60,74,91,75,78,100,
+137,242,149,132,177,19,114,145,154,194,158,130,92,115,86,65,59,83,4,143,107,
+252,209,35,138,75,91,136,105,91,138,172,197,1,176,1,211,25,254,214,254,192,
+111,114,97,60,36,89,77,67,65,79,14,75,92,71,76,102,97,2,82,64,75,81,104,100,
+99,188,118,133,116,116,191,152,144,172,97,81,66,84,68,63,0,0,3,255,197,254,
+51,7,96,4,250,0,3,0,87,0,93,0,0,1,33,39,33,1,35,39,38,38,39,39,54,55,36,3,
+55,18,0,33,50,54,53,52,39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,
+7,22,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,51,50,22,21,20,6,35,34,
+38,53,52,54,51,50,22,21,21,54,53,52,38,35,34,6,7,22,21,20,6,7,7,6,7,22,22,
+23,7,96,248,170,69,7,85,252,180,4,103,69,190,170,83,71,119,254,148,141,82,
+100,1,60,1,1,127,158,22,80,107,74,82,85,72,73,60,40,95,82,190,135,50,60,91,
+75,79,99,142,235,131,133,170,23,114,149,152,196,154,127,100,114,86,65,59,
+83,106,98,94,117,165,61,57,109,97,111,172,144,87,183,46,4,143,107,249,57,
+74,84,84,5,232,41,57,148,2,142,25,254,166,254,179,95,88,42,27,84,77,67,65,
+79,22,55,70,69,68,129,8,79,57,75,81,96,99,96,157,91,122,103,122,186,147,134,
+162,99,79,66,84,68,63,17,31,123,70,86,121,95,77,117,115,164,39,28,69,74,18,
+116,69,0,0,2,255,197,254,89,7,117,4,250,0,3,0,113,0,0,1,33,39,33,1,35,39,
+38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,
+38,53,53,6,35,32,0,3,55,18,0,33,50,54,53,52,39,6,35,34,38,53,52,54,51,50,
+23,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,
+51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,21,54,53,52,38,35,34,6,7,22,
+21,20,6,7,7,117,248,149,69,7,106,252,240,8,103,47,78,62,75,104,114,74,136,
+150,21,88,12,94,97,67,99,86,62,61,83,62,40,8,59,64,254,229,254,134,95,82,
+100,1,60,1,1,127,158,22,80,107,74,82,85,72,73,60,40,95,82,190,135,50,60,91,
+75,79,99,142,235,131,133,170,23,114,149,152,196,154,127,100,114,86,65,59,
+83,106,98,94,117,165,61,57,78,72,4,143,107,249,95,74,80,48,13,13,176,164,
+90,86,20,60,60,93,108,9,9,43,82,75,95,117,125,14,1,153,1,184,25,254,166,254,
+179,95,88,42,27,84,77,67,65,79,22,55,70,69,68,129,8,79,57,75,81,96,99,96,
+157,91,122,103,122,186,147,134,162,99,79,66,84,68,63,17,31,123,70,86,121,
+95,77,117,97,148,45,0,0,2,255,197,255,232,5,32,4,250,0,54,0,61,0,0,5,35,39,
+53,38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,38,53,38,38,39,39,54,
+54,55,53,33,39,33,23,33,21,22,22,21,20,6,35,34,38,53,52,54,51,50,22,23,52,
+38,39,7,6,6,7,22,22,23,3,3,6,104,53,148,86,5,75,69,83,90,112,90,114,222,66,
+5,88,210,198,84,169,249,162,253,117,69,5,22,69,253,227,194,229,77,81,67,68,
+60,54,42,55,9,199,151,110,119,167,88,109,210,55,24,104,47,72,89,12,17,23,
+68,81,100,75,81,102,141,113,66,132,98,89,11,232,98,116,53,57,107,107,56,20,
+215,160,96,114,76,52,54,70,41,32,100,139,9,5,43,77,52,34,132,79,0,0,3,255,
+197,255,232,6,118,4,250,0,28,0,55,0,61,0,0,5,35,39,38,36,39,23,20,6,35,34,
+38,53,52,54,55,38,38,39,39,54,54,55,53,33,39,33,23,35,1,22,4,23,38,53,17,
+33,21,22,22,21,20,6,35,34,38,53,52,54,51,50,22,23,52,38,39,7,6,7,22,22,23,
+5,142,6,104,84,254,197,158,2,75,69,83,90,57,52,77,185,141,84,169,249,162,
+253,136,69,6,108,69,232,253,98,173,1,64,73,6,253,208,194,229,77,81,67,68,
+60,54,42,55,9,196,154,110,204,158,108,201,53,24,104,125,127,13,38,68,81,100,
+75,57,87,22,57,47,8,232,98,116,53,57,107,107,253,106,32,170,104,79,158,2,
+219,56,20,215,160,96,114,76,52,54,70,41,32,100,131,9,7,73,92,33,119,74,0,
+2,255,197,255,90,5,96,4,250,0,75,0,81,0,0,5,35,39,53,38,35,34,21,39,38,38,
+35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,23,54,
+54,51,50,22,23,53,38,38,39,39,54,54,55,53,33,39,33,23,33,21,30,2,21,20,6,
+35,34,38,53,52,54,51,50,22,23,52,38,38,39,7,6,7,22,22,23,3,53,6,104,65,67,
+80,42,25,85,73,63,78,39,2,66,55,60,71,77,67,59,110,69,101,99,117,64,13,54,
+45,55,82,37,88,208,200,84,169,249,162,253,67,69,5,86,69,253,213,133,192,98,
+77,81,67,68,60,54,42,55,9,105,162,83,110,212,149,110,198,53,166,104,210,106,
+141,16,59,69,63,56,59,27,50,61,73,62,62,70,66,131,93,106,140,141,70,67,94,
+86,165,98,89,11,232,98,116,53,57,107,107,57,14,125,183,102,96,114,76,52,54,
+70,41,32,75,119,70,6,7,77,87,32,111,73,0,0,3,255,197,255,233,6,189,4,250,
+0,38,0,68,0,74,0,0,5,35,39,38,38,35,34,6,7,6,6,35,34,38,53,52,55,23,6,21,
+20,22,51,50,55,53,38,38,39,39,54,54,55,53,33,39,33,23,35,1,54,51,50,22,23,
+38,53,17,33,21,22,22,21,20,6,35,34,38,53,52,54,51,50,22,23,52,38,38,39,7,
+6,7,22,22,23,5,213,8,103,50,93,74,61,156,131,138,166,68,181,175,10,93,5,131,
+119,88,186,98,236,162,84,169,249,162,253,67,69,6,179,69,232,253,96,202,91,
+91,122,63,8,253,207,190,233,77,81,67,68,60,54,42,55,9,105,161,84,110,203,
+160,104,202,57,23,74,74,54,29,29,31,30,187,158,56,56,10,31,37,111,89,39,75,
+112,116,10,232,98,116,53,77,107,107,252,160,47,95,109,95,117,3,41,77,20,229,
+165,96,114,76,52,54,70,41,32,75,114,65,6,7,72,93,36,147,81,0,0,2,0,54,255,
+52,4,216,5,159,0,54,0,72,0,0,5,35,39,17,46,2,35,34,6,7,54,51,50,22,21,20,
+6,7,39,62,2,53,52,38,35,34,7,39,54,54,55,39,54,54,53,52,35,34,7,39,54,54,
+51,50,22,23,17,51,23,21,51,23,35,3,38,38,35,34,6,7,54,51,50,22,21,20,7,55,
+50,22,23,3,239,8,103,76,96,104,69,59,96,49,60,68,109,133,147,136,115,103,
+114,71,58,44,138,137,121,79,135,72,101,141,143,100,129,152,143,107,204,121,
+107,175,128,8,101,166,69,233,111,112,167,101,59,96,49,60,68,109,139,209,42,
+116,178,81,204,75,1,1,109,112,56,38,49,17,111,89,98,150,74,175,31,43,59,42,
+35,33,99,140,119,132,27,153,42,84,61,63,109,153,162,137,137,202,1,226,71,
+94,107,254,178,168,129,38,49,17,112,89,157,133,2,153,160,0,0,1,0,34,255,231,
+6,231,5,8,0,57,0,0,5,2,17,52,55,6,6,7,39,17,38,38,35,34,6,7,54,51,50,22,21,
+20,6,7,39,36,53,52,38,35,34,7,39,54,54,51,50,22,23,52,38,53,53,33,23,33,17,
+20,7,54,37,23,6,6,21,20,22,23,5,238,140,50,112,195,155,100,109,143,88,66,
+115,72,62,75,114,138,127,148,122,1,35,64,55,131,133,139,123,215,124,109,170,
+99,8,3,63,70,252,234,4,206,1,11,180,66,59,46,52,25,1,13,1,0,154,140,84,192,
+167,66,1,150,181,118,58,80,20,131,109,108,193,110,185,114,141,50,57,106,137,
+188,169,152,197,7,117,90,121,107,254,132,97,73,234,169,163,108,204,113,115,
+198,111,0,0,2,0,40,255,136,5,229,5,159,0,64,0,70,0,0,5,38,53,52,55,7,17,35,
+39,38,38,39,39,54,37,53,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,62,2,53,
+52,38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,21,33,23,33,17,54,55,23,
+6,21,20,22,23,1,6,7,22,22,23,4,250,111,18,198,4,103,69,190,170,83,203,1,49,
+111,162,107,59,97,49,63,72,111,135,130,175,122,120,126,75,59,53,138,133,139,
+110,195,117,108,176,135,9,8,101,1,203,69,253,242,154,119,126,106,31,32,254,
+45,172,144,87,183,46,13,186,212,64,76,69,253,192,74,84,84,5,232,116,117,230,
+170,130,39,49,18,122,99,98,165,112,185,41,56,72,50,43,45,106,137,167,142,
+141,211,78,133,1,36,71,94,107,253,234,54,29,124,120,175,84,119,73,1,136,69,
+74,18,116,69,0,0,1,0,40,255,182,4,191,5,159,0,63,0,0,5,35,39,53,38,38,39,
+22,21,20,6,35,34,38,53,52,54,51,50,4,23,38,53,17,38,38,35,34,6,7,54,51,50,
+22,21,20,6,7,39,62,2,53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,
+21,51,23,35,3,215,6,104,86,230,112,6,75,69,83,90,125,108,139,1,35,81,6,111,
+162,107,59,97,49,63,72,111,135,126,162,119,109,122,70,59,53,138,133,139,110,
+195,117,108,176,135,9,8,101,165,69,232,74,104,47,96,97,4,24,20,68,81,93,74,
+87,104,164,120,91,140,1,180,170,130,39,49,18,122,99,98,161,105,181,38,55,
+71,48,43,45,106,137,167,142,141,211,78,133,1,36,71,94,107,0,0,2,0,40,255,
+232,6,7,5,159,0,56,0,63,0,0,5,35,39,38,38,39,23,20,6,35,34,38,53,52,54,55,
+17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,62,2,53,52,38,35,34,7,39,54,54,
+51,50,22,23,38,53,17,51,23,21,33,23,35,1,22,23,38,53,17,35,5,30,6,104,35,
+96,77,2,75,69,83,90,105,90,111,162,107,59,97,49,63,72,111,135,130,175,122,
+120,126,75,59,53,138,133,139,110,195,117,108,176,135,9,8,101,1,237,69,233,
+254,185,135,86,5,216,24,104,83,110,18,34,68,81,100,75,78,103,2,1,100,170,
+130,39,49,18,122,99,98,165,112,185,41,56,72,50,43,45,106,137,167,142,141,
+211,78,133,1,36,71,94,107,253,49,49,176,89,124,2,219,0,1,0,36,255,101,4,177,
+5,159,0,79,0,0,5,35,39,53,7,38,35,34,21,39,38,35,34,6,21,20,23,54,54,51,50,
+22,21,20,6,35,34,38,38,53,52,54,51,50,23,54,51,50,22,23,17,38,38,35,34,6,
+7,54,51,50,22,21,20,6,7,39,62,2,53,52,35,34,7,39,54,54,51,50,22,23,38,53,
+17,51,23,21,51,23,35,3,201,8,103,1,73,79,90,41,62,152,76,84,44,2,75,62,68,
+81,87,76,67,124,79,123,104,133,72,27,100,62,95,43,105,160,105,59,97,49,63,
+72,111,135,137,168,122,110,128,83,109,141,133,139,110,195,117,107,176,124,
+7,8,101,165,69,232,155,75,240,3,110,142,15,130,62,58,60,27,51,61,73,63,63,
+70,66,132,94,115,133,142,138,104,92,2,79,159,126,39,49,18,122,99,106,159,
+90,185,34,51,73,49,80,106,137,167,142,141,193,91,102,1,36,71,94,107,0,2,255,
+197,255,182,4,118,4,250,0,36,0,54,0,0,5,35,39,53,38,38,39,22,21,20,6,35,34,
+38,53,52,54,51,50,4,23,38,53,38,33,39,54,55,38,53,52,55,35,39,33,23,35,3,
+7,6,7,4,23,17,33,34,6,21,20,22,51,50,55,7,55,3,142,6,104,76,209,100,5,75,
+69,83,89,125,99,127,1,15,80,6,205,254,94,79,83,136,205,30,132,69,4,108,69,
+232,217,63,206,115,1,73,162,254,146,74,94,78,59,46,60,1,113,74,104,47,70,
+91,12,17,23,68,81,95,75,83,105,152,116,76,152,151,204,50,72,56,150,61,44,
+107,107,254,196,29,91,67,48,155,2,194,63,64,49,64,27,2,54,0,0,2,255,197,255,
+70,4,123,4,250,0,55,0,72,0,0,5,35,39,53,38,35,34,21,39,38,38,35,34,6,21,20,
+23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,23,54,54,51,50,22,23,
+53,38,33,39,54,55,38,53,52,55,35,39,33,23,35,3,7,6,7,4,23,17,33,34,6,21,20,
+22,51,50,55,55,3,147,6,104,65,67,80,42,25,85,73,63,78,39,2,66,55,60,71,77,
+67,59,110,69,101,99,117,64,13,54,45,55,82,37,205,254,94,79,83,136,205,30,
+137,69,4,113,69,232,217,63,206,115,1,77,158,254,146,74,94,78,59,45,60,113,
+186,104,160,106,141,16,59,69,63,56,59,27,50,61,73,62,62,70,66,131,93,106,
+140,141,70,67,94,86,201,151,204,50,72,56,150,61,44,107,107,254,196,29,91,
+67,49,149,2,189,63,64,49,64,25,54,0,0,3,255,197,255,232,5,75,4,250,0,61,0,
+70,0,76,0,0,5,35,39,38,38,39,39,54,54,55,38,38,35,7,20,35,34,38,53,52,54,
+55,38,39,35,39,33,23,35,22,21,20,6,35,34,38,39,33,22,23,30,2,23,22,22,21,
+20,6,35,34,38,53,52,54,51,50,22,23,38,38,39,19,22,22,51,50,54,53,52,39,1,
+6,7,22,22,23,3,9,4,103,86,212,201,84,172,249,159,2,125,105,41,165,66,85,109,
+91,50,104,114,69,5,64,70,194,37,96,93,115,145,18,254,70,50,29,109,179,109,
+10,201,234,77,81,67,68,60,54,37,56,14,7,203,151,41,17,98,62,51,48,15,254,
+100,210,160,107,208,55,24,74,98,91,12,232,98,114,52,70,80,2,181,82,64,73,
+89,13,81,51,107,107,58,69,75,97,153,146,50,77,4,87,131,67,20,208,157,96,114,
+76,52,54,70,37,27,94,125,7,2,85,77,76,50,39,32,32,253,164,75,93,33,128,76,
+0,0,3,255,197,254,216,5,190,4,250,0,92,0,101,0,107,0,0,1,35,39,38,38,35,34,
+7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,38,
+38,39,39,54,54,55,38,38,35,7,20,35,34,38,53,52,54,55,38,39,35,39,33,23,35,
+22,21,20,6,35,34,38,39,33,22,23,30,2,23,22,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,38,38,39,17,51,19,22,22,51,50,54,53,52,39,1,6,7,22,22,23,3,125,8,
+103,47,78,62,29,78,90,50,136,150,21,88,12,94,97,18,81,61,34,61,83,62,40,8,
+88,210,198,84,167,237,174,10,113,107,41,165,66,85,101,86,51,90,229,69,5,179,
+70,194,37,96,93,115,145,18,254,70,49,26,104,174,113,16,203,236,77,81,67,68,
+60,54,37,56,14,7,200,154,1,40,17,98,62,51,48,15,254,100,184,171,105,197,53,
+254,216,74,80,48,12,14,176,164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,
+28,98,89,11,232,90,100,56,55,73,2,181,82,64,71,88,14,69,45,107,107,58,69,
+75,97,153,146,48,59,3,79,122,65,19,208,158,96,114,76,52,54,70,37,27,93,120,
+8,254,43,4,7,77,76,50,39,32,32,253,199,65,82,36,124,73,0,2,255,197,255,231,
+8,88,5,159,0,90,0,99,0,0,5,35,39,46,2,39,39,23,50,54,53,52,39,6,6,35,34,39,
+21,20,6,35,34,0,3,55,18,18,51,50,54,53,52,39,6,6,35,34,38,53,53,38,39,35,
+39,33,22,23,54,54,51,50,22,21,20,6,35,34,39,21,20,22,51,50,54,55,22,23,54,
+51,50,22,21,7,54,55,22,21,20,6,7,22,23,17,51,23,21,51,23,33,5,50,54,53,52,
+38,35,34,7,7,81,4,103,56,204,213,155,82,40,192,200,34,59,150,81,90,53,193,
+159,222,254,202,100,82,108,240,183,135,140,10,70,156,67,92,103,110,75,232,
+69,1,90,67,75,9,109,95,89,110,125,108,40,31,14,17,61,140,119,56,31,31,81,
+58,66,3,89,117,172,86,87,230,119,8,101,166,99,254,249,251,5,70,77,42,40,115,
+10,25,74,90,90,25,5,209,1,104,98,68,47,84,83,41,19,172,207,1,120,1,136,25,
+254,169,254,234,134,110,39,35,68,81,122,107,120,66,151,107,144,54,97,119,
+106,86,88,111,7,117,25,19,93,132,65,67,71,70,57,36,59,182,165,202,103,123,
+31,46,157,4,253,71,94,107,135,55,45,30,38,164,0,2,255,197,255,231,5,52,4,
+250,0,66,0,75,0,0,5,38,38,53,52,55,6,6,7,14,2,35,34,38,39,55,22,51,50,62,
+2,53,52,38,35,35,21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,23,35,22,21,
+20,6,35,34,38,39,33,22,23,22,22,21,21,54,55,23,6,21,20,23,1,22,22,51,50,54,
+53,52,39,4,33,67,70,40,78,139,88,85,57,72,46,86,142,64,76,73,97,48,75,89,
+46,89,103,3,79,89,67,84,110,89,49,101,132,69,5,42,69,243,25,96,93,110,144,
+22,254,167,47,30,149,178,141,216,120,145,98,254,114,20,93,58,51,48,7,25,129,
+217,123,104,97,43,110,89,90,56,35,126,153,38,146,39,112,115,51,83,104,10,
+90,91,82,71,70,96,12,79,51,107,107,50,57,75,97,143,136,49,79,11,199,153,11,
+132,68,165,115,213,173,191,4,135,67,66,50,39,20,24,0,0,4,255,197,255,232,
+8,2,5,12,0,43,0,52,0,75,0,92,0,0,5,35,39,38,36,39,39,6,6,35,34,0,3,55,18,
+18,51,50,54,53,52,39,6,6,35,34,38,53,53,38,39,35,39,33,22,23,54,54,51,50,
+23,33,23,35,5,50,54,53,52,38,35,34,7,5,38,38,53,52,55,35,22,21,20,6,35,34,
+39,21,20,22,51,50,54,55,22,23,37,6,7,22,4,23,17,33,34,6,21,20,22,51,50,55,
+55,7,26,4,103,125,254,184,193,44,15,188,147,222,254,202,100,82,108,240,183,
+135,140,10,70,156,67,92,103,110,75,234,69,1,92,67,75,9,109,95,52,39,4,222,
+69,232,251,62,70,77,42,40,115,10,2,161,93,120,36,203,10,125,108,40,31,14,
+17,61,140,119,107,21,2,66,245,163,136,1,26,102,254,126,73,95,75,62,51,52,
+136,24,74,186,213,19,123,154,177,1,120,1,136,25,254,169,254,234,134,110,39,
+35,68,81,120,109,120,66,151,107,144,54,97,119,18,107,135,55,45,30,38,164,
+219,31,119,85,68,47,35,32,88,111,7,117,25,19,93,132,124,141,110,113,98,37,
+235,158,3,223,74,73,59,74,23,65,0,3,255,197,255,23,5,200,5,12,0,52,0,63,0,
+92,0,0,5,35,39,38,39,23,20,6,35,34,38,53,52,54,55,38,39,6,35,34,0,3,55,30,
+2,51,32,53,52,39,6,6,35,34,38,53,53,38,39,35,39,33,22,23,54,54,51,50,23,33,
+23,35,5,54,53,52,38,35,34,7,22,51,50,37,33,22,21,20,6,35,34,39,21,20,22,51,
+50,54,55,22,22,21,20,6,7,22,23,22,22,23,38,53,4,224,6,104,84,153,2,72,76,
+76,93,108,86,22,33,54,64,196,254,219,96,82,68,148,168,108,1,11,12,62,144,
+62,106,112,96,75,184,69,1,38,62,72,13,107,91,49,39,2,231,69,232,253,163,35,
+41,36,111,13,30,36,65,2,18,254,137,11,102,119,42,36,23,29,63,169,67,58,75,
+73,70,38,21,84,138,45,4,233,104,176,35,26,71,86,96,75,80,105,2,42,35,14,1,
+69,1,119,25,215,242,96,214,43,24,58,54,120,109,79,64,134,107,128,53,90,109,
+18,107,102,23,44,29,39,152,6,125,33,34,78,111,9,69,25,19,91,74,57,157,89,
+99,153,44,56,72,22,126,87,72,145,0,5,255,197,255,232,9,219,5,12,0,90,0,99,
+0,121,0,137,0,145,0,0,5,35,39,53,38,39,23,20,6,35,34,38,53,52,54,51,51,38,
+38,39,21,20,6,35,34,39,23,20,6,35,34,0,3,55,18,18,51,50,54,53,52,39,6,6,35,
+34,38,53,53,38,39,35,39,33,22,23,54,54,51,50,23,33,23,33,17,54,51,50,22,21,
+20,6,35,34,38,53,52,54,51,50,22,23,55,52,38,35,34,6,7,6,7,1,50,54,53,52,38,
+35,34,7,7,20,22,51,50,54,55,22,23,54,54,55,38,39,35,22,21,20,6,35,34,39,1,
+34,38,53,53,33,22,23,22,22,23,22,22,23,38,53,3,20,51,50,54,55,17,35,7,150,
+8,103,143,156,1,70,65,69,77,93,85,2,22,88,56,68,65,82,39,3,193,159,222,254,
+202,100,82,108,240,183,135,140,10,70,156,67,91,104,110,75,226,69,1,84,67,
+75,9,109,95,52,39,6,191,69,253,187,59,48,172,197,95,85,71,88,72,63,43,57,
+11,1,85,77,38,61,49,37,37,250,186,70,77,42,40,115,10,1,14,17,61,140,119,68,
+36,4,86,75,74,95,157,10,125,108,40,31,5,20,150,183,254,177,62,29,98,150,22,
+92,166,54,5,222,85,30,61,46,222,24,75,108,190,36,12,67,72,86,66,74,94,80,
+119,23,4,68,71,58,52,172,207,1,120,1,136,25,254,169,254,234,134,110,39,35,
+68,81,118,111,120,66,151,107,144,54,97,119,18,107,254,202,16,203,179,116,
+128,83,67,61,80,41,28,21,109,121,19,21,18,12,1,126,55,45,30,38,164,245,25,
+19,93,132,79,92,65,83,4,150,64,35,32,88,111,7,254,237,167,134,233,90,143,
+40,217,136,26,139,97,85,115,1,125,88,20,20,1,99,0,4,255,197,0,73,6,39,4,250,
+0,26,0,33,0,45,0,56,0,0,1,6,2,6,35,34,38,38,53,53,6,6,35,34,38,38,53,17,35,
+39,33,23,33,21,18,33,55,37,53,33,21,22,22,51,1,20,22,22,51,50,54,55,46,2,
+39,1,20,22,22,51,50,18,55,38,38,39,5,166,13,141,226,134,76,109,58,57,156,
+92,75,106,53,140,69,6,29,69,252,249,158,1,58,68,253,117,254,84,62,181,169,
+254,100,26,53,41,101,157,31,100,135,118,56,2,27,26,56,46,116,184,34,145,228,
+89,2,225,181,254,208,179,56,122,121,41,76,86,64,120,117,2,103,107,107,48,
+254,250,4,96,210,18,103,89,254,138,102,75,34,230,186,11,44,102,93,253,133,
+100,78,33,1,15,217,18,154,155,0,4,255,197,255,104,6,243,4,250,0,43,0,49,0,
+58,0,70,0,0,5,38,36,39,39,22,51,50,54,53,52,38,39,6,6,35,34,39,6,6,35,34,
+38,38,53,17,35,39,33,23,33,21,22,22,51,51,22,22,21,20,6,7,22,23,1,33,21,22,
+22,23,23,20,22,51,50,54,55,38,39,1,20,22,22,51,50,54,55,46,2,39,6,46,198,
+254,188,231,35,128,142,237,208,130,113,67,197,131,65,46,61,185,120,76,111,
+57,140,69,6,233,69,252,37,49,164,80,110,193,227,192,182,219,184,252,61,254,
+92,61,173,186,111,36,43,78,113,32,190,112,253,237,26,56,46,94,154,36,102,
+137,124,49,152,186,162,32,190,37,158,129,108,109,6,203,171,28,112,130,56,
+124,119,2,53,107,107,14,60,59,4,218,176,170,206,28,112,204,4,227,17,94,78,
+1,234,66,45,137,120,36,145,254,75,100,78,33,214,177,11,38,92,84,0,5,255,197,
+254,174,6,212,4,250,0,54,0,60,0,70,0,82,0,88,0,0,1,35,39,38,38,39,39,54,55,
+38,39,39,22,51,50,54,53,52,38,35,35,6,6,35,34,39,6,6,35,34,38,38,53,17,35,
+39,33,23,33,21,22,22,51,51,22,22,21,20,6,7,22,23,7,38,39,1,33,21,22,22,23,
+23,20,22,51,50,54,55,38,38,39,1,20,22,22,51,50,54,55,46,2,39,1,6,7,22,22,
+23,5,103,4,102,86,249,126,67,124,225,103,140,34,117,119,191,194,127,103,3,
+40,179,116,41,31,60,214,134,76,111,57,140,69,6,202,69,252,71,47,143,88,95,
+183,197,152,143,190,204,48,120,96,253,69,254,89,61,175,187,111,36,43,60,79,
+20,74,114,50,253,234,26,56,46,94,154,36,102,137,124,49,3,244,165,133,84,173,
+41,254,174,74,105,104,4,199,71,89,22,10,174,23,115,127,93,86,148,157,10,143,
+171,56,124,119,2,53,107,107,14,58,41,4,186,163,147,161,29,56,139,72,73,44,
+3,185,17,94,78,1,144,66,45,107,85,16,75,65,254,75,100,78,33,214,177,11,38,
+92,84,252,182,60,61,33,130,63,0,0,5,255,197,255,31,6,211,4,250,0,40,0,46,
+0,55,0,67,0,101,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,55,6,35,34,38,38,
+53,17,35,39,33,23,33,21,22,22,51,51,22,22,21,16,5,22,23,7,38,39,1,33,21,22,
+22,23,23,20,22,51,50,55,38,38,39,1,20,22,22,51,50,54,55,46,2,39,1,38,39,39,
+22,51,32,17,52,33,35,6,6,35,34,39,21,6,7,6,21,20,22,51,50,55,54,51,50,22,
+22,23,38,53,5,109,8,103,47,78,62,38,74,94,51,136,150,2,74,82,76,111,57,140,
+69,6,201,69,252,71,47,143,88,95,205,215,254,205,179,187,48,104,105,253,62,
+254,90,60,174,188,111,36,43,114,46,75,114,50,253,235,26,56,46,94,154,36,102,
+137,124,49,3,249,173,255,34,117,123,1,169,254,242,1,40,179,118,48,38,54,81,
+7,94,97,23,81,65,35,61,83,62,40,8,225,74,80,48,12,14,176,164,45,33,56,124,
+119,2,53,107,107,14,58,41,4,185,164,254,220,74,57,129,72,66,45,3,211,17,94,
+77,2,164,66,45,212,16,75,65,254,75,100,78,33,214,177,11,38,92,84,252,218,
+58,27,178,24,1,6,179,160,165,16,3,122,74,38,39,93,108,9,9,43,82,75,95,117,
+0,0,4,255,197,255,81,7,232,4,250,0,45,0,57,0,89,0,115,0,0,5,35,39,38,38,35,
+34,7,6,35,32,3,38,38,53,17,35,39,33,23,33,21,22,22,51,55,23,54,51,50,23,54,
+51,50,22,21,20,7,22,21,20,6,35,34,38,39,1,20,22,22,51,50,54,55,46,2,39,1,
+52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,39,6,35,35,22,51,50,55,54,51,
+50,22,23,38,53,37,52,39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,
+21,20,22,51,50,54,5,13,8,103,52,83,72,54,120,122,44,254,175,24,61,63,140,
+69,7,222,69,249,29,62,181,189,59,88,96,117,201,31,86,178,125,147,55,60,144,
+121,81,143,44,251,248,26,56,46,94,154,36,102,137,124,49,3,153,26,53,45,81,
+138,40,35,40,75,82,101,95,129,52,111,149,7,51,199,37,106,97,47,79,115,72,
+8,2,39,30,68,86,60,76,73,55,78,62,42,87,70,117,153,140,118,81,98,175,74,78,
+50,15,14,1,72,26,125,125,2,53,107,107,17,96,77,3,104,47,192,146,146,122,96,
+65,78,101,114,135,88,78,1,191,100,78,33,214,177,11,38,92,84,254,76,98,81,
+31,110,86,19,89,65,77,94,96,103,117,10,11,86,127,95,117,99,47,34,61,62,63,
+59,66,48,42,60,53,65,172,127,129,148,68,0,2,255,197,255,0,3,233,4,250,0,43,
+0,55,0,0,1,35,39,53,38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,38,
+53,53,6,35,34,38,38,53,17,35,39,33,23,33,21,22,22,51,55,23,6,7,37,20,22,22,
+51,50,54,55,46,2,39,3,16,6,104,53,148,86,5,75,69,83,90,112,90,113,222,67,
+6,116,163,76,111,57,140,69,3,223,69,253,28,62,181,189,59,105,18,55,253,245,
+26,56,46,94,154,36,102,137,124,49,255,0,104,47,72,89,12,17,23,68,81,100,75,
+81,102,140,113,88,132,220,121,56,124,119,2,53,107,107,17,96,77,3,123,142,
+123,41,100,78,33,214,177,11,38,92,84,0,0,2,255,196,255,161,9,101,4,250,0,
+72,0,104,0,0,5,2,17,52,54,55,7,34,38,39,6,6,21,20,22,51,50,54,55,22,22,21,
+20,6,35,32,3,6,6,35,34,0,3,55,18,18,51,50,54,53,52,39,6,35,34,38,53,52,54,
+55,6,35,33,39,33,23,33,22,22,51,55,22,22,51,50,55,23,6,6,21,20,22,23,1,52,
+39,6,35,34,38,53,52,55,38,38,39,6,6,21,20,22,51,50,54,55,22,22,21,20,7,22,
+22,51,50,54,8,114,140,21,20,69,115,252,105,97,122,68,54,74,118,75,89,67,198,
+170,254,215,188,45,161,110,220,254,196,110,82,116,255,184,133,143,17,124,
+153,111,148,94,108,192,92,254,211,70,9,92,69,250,122,73,229,147,32,118,204,
+122,73,152,117,61,52,46,52,254,16,17,124,153,111,148,90,133,197,60,176,216,
+68,54,74,118,75,89,67,5,86,205,138,133,143,95,1,13,1,0,70,165,61,2,86,68,
+51,138,64,59,60,103,113,80,158,98,182,212,1,120,81,90,1,148,1,166,25,254,
+153,254,213,123,102,57,43,124,148,113,96,152,73,6,107,107,86,65,1,73,63,10,
+137,104,177,120,109,196,110,1,216,57,43,124,148,113,130,101,37,131,113,76,
+156,97,59,60,103,113,80,158,98,34,38,172,162,123,0,0,3,255,193,254,5,8,232,
+4,250,0,76,0,108,0,114,0,0,1,35,39,38,38,39,39,54,37,17,6,35,34,38,39,6,6,
+21,20,22,51,50,54,55,22,22,21,20,6,35,34,38,39,6,35,34,38,2,39,55,22,18,22,
+51,50,54,53,52,39,6,35,34,38,53,52,55,5,33,39,33,23,33,30,2,51,51,55,21,55,
+22,22,51,50,55,55,23,1,52,39,6,35,34,38,53,52,55,38,38,39,6,6,21,20,22,51,
+50,54,55,22,22,21,20,7,22,22,51,50,54,1,6,7,22,22,23,8,30,4,102,83,236,142,
+67,174,1,93,36,50,116,173,108,107,119,67,50,62,108,78,82,74,182,175,145,225,
+95,88,220,156,223,157,71,82,75,134,181,125,123,141,10,105,164,110,139,200,
+254,245,254,211,70,8,226,69,250,176,46,128,136,97,40,32,1,125,207,111,44,
+84,57,50,254,112,9,105,165,110,139,93,181,176,52,197,154,67,50,62,108,78,
+83,73,5,80,219,116,128,136,1,34,162,132,86,167,41,254,5,74,102,76,5,196,100,
+132,2,78,4,63,76,51,111,70,51,58,88,128,78,152,90,176,204,168,168,167,187,
+1,79,254,25,206,255,0,146,113,99,42,37,109,140,113,170,125,3,107,107,50,48,
+13,1,2,2,78,58,6,4,60,254,119,42,31,108,140,113,114,96,37,107,86,80,132,74,
+51,58,88,128,80,154,91,37,43,137,144,113,254,125,58,61,29,110,60,0,0,3,255,
+196,254,124,7,110,4,250,0,58,0,68,0,74,0,0,5,35,39,38,39,17,35,39,38,37,39,
+54,37,17,38,38,39,6,6,21,20,22,51,50,54,55,22,22,21,20,6,35,34,0,3,55,18,
+0,51,50,54,53,52,39,6,35,34,38,53,52,54,55,6,35,33,39,33,23,35,1,22,23,17,
+33,22,22,51,55,23,3,6,7,22,22,23,6,152,4,103,87,123,4,102,149,254,200,67,
+174,1,93,145,201,79,149,184,68,54,74,118,75,89,67,196,170,220,254,196,110,
+82,116,1,0,181,133,143,17,124,153,111,148,94,108,192,92,254,211,70,7,101,
+69,214,254,195,128,78,253,108,68,177,127,32,50,110,151,144,85,169,41,231,
+74,146,104,254,31,74,183,10,196,100,132,1,251,30,152,136,68,147,87,59,60,
+103,113,80,158,98,182,212,1,148,1,166,25,254,153,254,213,123,102,57,43,124,
+148,113,96,152,73,6,107,107,252,92,116,140,4,164,100,87,1,60,252,229,54,66,
+30,117,60,0,3,0,82,255,230,5,61,5,159,0,44,0,71,0,77,0,0,5,35,39,38,37,39,
+36,37,38,38,39,23,20,6,35,34,38,53,52,54,51,50,22,23,38,53,17,51,23,17,54,
+51,50,22,21,20,7,22,21,20,6,35,34,38,39,37,52,39,6,35,34,38,53,52,54,51,50,
+23,54,53,52,38,35,34,6,6,21,20,22,51,50,54,37,6,7,22,22,23,3,42,4,102,178,
+254,161,84,1,66,1,10,57,145,81,3,75,69,83,90,112,90,118,236,68,5,8,101,86,
+168,124,148,59,64,141,124,80,140,46,1,182,34,65,85,60,76,73,55,76,60,46,81,
+76,81,123,66,141,117,85,94,253,221,234,177,114,236,61,26,74,250,21,242,186,
+96,86,124,19,33,68,81,100,75,81,102,167,130,90,126,1,16,71,254,231,163,159,
+129,103,77,83,117,125,144,87,75,143,52,45,57,62,63,59,66,46,50,70,58,80,96,
+156,87,143,174,84,106,96,99,30,173,97,0,0,3,0,113,255,33,4,159,5,5,0,81,0,
+107,0,120,0,0,5,46,2,39,39,22,22,51,50,54,53,52,38,38,39,6,6,35,34,38,53,
+52,54,54,55,62,2,53,52,38,35,34,6,7,22,22,21,20,6,35,34,38,53,52,54,51,50,
+22,23,54,54,51,50,22,21,20,7,22,21,20,6,35,34,38,39,6,7,30,2,23,30,2,21,20,
+6,7,22,23,19,52,39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,21,20,
+22,51,50,54,1,54,55,38,39,14,2,21,20,22,51,50,3,220,143,242,233,196,38,77,
+192,59,190,206,21,41,88,50,153,84,146,151,76,108,90,77,88,59,58,70,51,90,
+30,29,35,69,61,68,78,199,145,93,121,29,38,123,81,107,130,48,52,125,106,110,
+172,15,43,76,9,52,67,56,74,91,64,147,118,167,190,51,21,58,71,52,67,64,48,
+64,52,32,66,60,102,133,121,103,69,77,253,152,49,30,76,7,137,64,30,67,55,64,
+223,96,99,43,20,187,18,19,47,59,20,29,23,27,52,58,133,123,84,115,70,43,37,
+54,81,56,43,70,46,39,13,55,35,57,69,83,69,108,150,70,59,58,69,126,107,82,
+59,69,86,99,118,163,122,55,48,42,58,36,24,32,57,106,85,98,112,22,60,137,3,
+167,38,28,49,54,55,52,57,38,37,48,47,56,148,112,112,130,59,254,185,30,44,
+73,135,70,51,55,34,48,53,0,0,2,0,51,255,102,5,123,5,5,0,92,0,118,0,0,5,38,
+38,53,52,55,7,34,38,39,6,6,7,14,2,21,20,22,51,50,54,55,22,22,21,20,6,35,34,
+0,3,55,30,2,51,50,54,53,52,39,6,6,35,34,38,53,52,54,54,55,62,2,53,52,38,35,
+34,6,7,22,22,21,20,6,35,34,38,53,52,54,54,51,50,23,54,51,50,22,21,20,7,22,
+21,20,7,23,6,21,20,23,3,52,39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,
+34,6,21,20,22,51,50,54,5,29,70,76,46,37,114,174,10,40,104,79,69,79,52,58,
+50,87,138,76,80,66,192,172,198,254,223,104,83,60,130,187,128,123,143,9,53,
+145,81,128,153,83,117,95,76,86,58,66,86,97,157,40,35,43,71,62,67,74,107,199,
+130,212,67,86,152,107,130,48,52,81,57,96,98,69,21,58,71,52,67,64,48,64,52,
+32,66,60,102,133,121,103,69,77,154,126,226,124,112,105,2,172,125,41,54,33,
+28,41,62,43,47,48,113,113,74,187,91,192,216,1,110,1,91,32,171,238,143,137,
+116,41,33,49,52,138,116,87,115,66,38,31,45,69,49,44,69,63,51,11,60,39,57,
+71,91,66,73,134,84,122,120,126,107,82,59,69,86,114,60,54,116,160,173,191,
+3,131,38,28,49,54,55,52,57,38,37,48,47,56,148,112,112,130,59,0,0,4,0,84,254,
+148,6,82,5,7,0,80,0,106,0,113,0,119,0,0,5,35,39,38,39,17,35,39,46,2,39,39,
+54,55,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,
+22,23,55,38,53,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,53,52,54,
+54,51,50,23,54,51,50,22,21,20,7,22,21,20,6,7,19,52,39,6,35,34,38,53,52,54,
+51,50,23,54,53,52,38,35,34,6,21,20,22,51,50,54,7,38,38,39,17,22,23,37,6,7,
+22,22,23,5,132,4,103,88,132,4,104,52,138,135,104,84,245,199,31,70,50,48,110,
+91,61,160,203,26,89,20,146,124,29,85,14,90,39,88,121,61,5,7,26,53,45,94,171,
+34,37,68,75,82,101,95,97,120,114,203,128,201,31,86,178,125,147,55,60,109,
+97,113,30,68,86,60,76,73,55,78,62,42,87,70,117,153,140,118,81,98,224,67,113,
+36,137,79,254,185,177,118,87,167,41,231,74,149,109,254,47,74,58,56,16,3,232,
+138,79,27,22,14,13,191,211,113,107,21,85,80,128,120,8,1,10,97,106,2,94,106,
+1,190,98,81,31,156,114,43,89,65,77,94,132,111,111,193,116,192,146,146,122,
+96,65,78,101,97,131,16,1,24,47,34,61,62,63,59,66,48,42,60,53,65,172,127,129,
+148,68,214,12,84,65,254,206,120,145,142,72,66,20,95,61,0,0,1,255,197,255,
+112,4,218,7,86,0,73,0,0,1,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,54,
+51,50,22,21,20,7,22,21,20,6,35,34,0,3,55,22,4,51,50,54,53,52,39,6,6,35,34,
+38,38,53,17,33,39,33,38,38,35,34,7,7,34,38,53,52,55,23,7,20,22,51,50,55,55,
+50,22,23,51,4,218,252,183,26,59,48,121,193,35,43,65,77,86,99,98,108,125,73,
+97,203,194,211,254,204,123,84,109,1,13,165,140,161,51,70,188,107,75,117,57,
+254,232,69,3,162,15,72,76,36,104,113,149,143,7,85,2,84,132,39,76,94,128,133,
+21,213,4,143,253,234,102,74,35,157,126,34,89,73,79,97,142,125,119,106,120,
+167,176,198,1,34,1,53,38,230,212,127,108,90,66,65,74,58,119,122,2,53,107,
+104,91,8,7,168,154,52,50,9,51,103,85,6,6,165,203,0,2,255,197,255,23,5,140,
+7,86,0,51,0,82,0,0,5,35,39,38,39,23,20,6,35,34,38,53,52,54,55,38,39,6,35,
+34,38,38,53,17,35,39,33,38,38,35,34,7,7,34,38,53,52,55,23,7,20,22,51,50,55,
+55,50,22,23,33,23,35,35,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,54,51,
+50,22,21,20,6,7,22,23,22,22,23,38,53,4,164,6,104,84,153,2,72,76,76,93,108,
+86,31,47,112,131,75,117,57,140,69,3,22,15,72,76,36,104,113,149,143,7,85,2,
+84,132,39,76,94,128,133,21,2,19,69,232,110,252,207,26,59,48,121,193,35,43,
+65,77,86,99,98,108,125,93,82,58,30,84,138,45,4,233,104,176,35,26,71,86,96,
+75,80,105,2,58,43,55,58,119,122,2,53,107,104,91,8,7,168,154,52,50,9,51,103,
+85,6,6,165,203,107,253,234,102,74,35,157,126,34,89,73,79,97,142,125,95,174,
+62,61,105,22,126,87,72,145,0,0,2,255,197,255,232,8,142,5,159,0,67,0,78,0,
+0,5,35,39,17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,36,53,52,38,35,34,7,
+22,21,20,6,35,34,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,38,38,53,17,33,39,
+33,54,51,50,22,23,38,53,17,51,23,21,51,23,35,5,54,55,33,17,20,22,51,50,54,
+55,7,166,8,103,111,162,107,66,115,72,62,75,114,138,127,148,122,1,35,64,55,
+128,131,33,223,190,245,254,182,115,81,120,1,16,208,147,174,56,96,143,81,53,
+85,47,254,32,69,5,116,46,54,108,176,135,9,8,101,165,69,232,252,75,80,74,253,
+209,20,22,42,127,135,24,75,3,3,170,130,58,80,20,131,109,108,193,110,185,114,
+141,50,57,102,90,98,197,230,1,140,1,174,29,254,146,254,215,151,128,106,64,
+113,93,49,108,103,1,33,107,14,141,211,78,133,1,36,71,94,107,185,115,70,254,
+177,28,23,110,156,255,255,255,197,255,62,8,142,5,159,2,34,1,69,0,0,0,3,0,
+72,4,247,0,187,0,2,255,197,0,73,8,138,4,250,0,40,0,68,0,0,1,33,17,20,51,50,
+54,55,22,21,20,6,35,32,3,6,6,35,34,0,3,55,18,0,51,50,54,53,52,39,6,6,35,34,
+38,38,53,17,33,39,33,1,22,22,51,50,54,53,52,39,6,6,35,34,38,38,53,17,33,17,
+20,22,51,50,54,55,22,22,21,8,138,253,46,36,55,148,137,202,224,187,254,196,
+202,43,181,138,253,254,178,115,81,120,1,16,208,147,174,56,96,143,81,53,85,
+47,254,32,69,8,128,252,58,91,221,147,153,178,56,103,160,91,58,79,44,253,22,
+20,22,42,127,135,99,103,4,143,254,97,51,117,149,209,248,200,237,1,80,102,
+114,1,138,1,176,29,254,146,254,215,151,128,106,64,113,93,49,108,103,1,23,
+107,253,71,162,150,155,134,111,72,107,92,54,106,100,1,113,254,187,28,23,110,
+156,102,208,127,0,2,255,197,255,23,6,24,4,250,0,42,0,64,0,0,5,35,39,38,39,
+23,20,6,35,34,38,53,52,54,55,38,39,6,35,34,0,3,55,18,22,51,50,54,53,52,39,
+6,35,34,38,38,53,53,33,39,33,23,35,35,33,17,20,22,51,50,54,55,22,22,21,20,
+6,7,22,23,22,22,23,38,53,5,48,6,104,84,153,2,72,76,76,93,108,86,27,41,70,
+82,224,254,225,87,80,92,233,186,131,149,29,140,159,53,85,47,254,122,69,6,
+14,69,232,110,253,64,20,22,47,116,82,96,117,69,66,49,27,84,138,45,4,233,104,
+176,35,26,71,86,96,75,80,105,2,52,39,25,1,85,1,92,28,254,229,242,128,111,
+67,47,180,49,108,103,219,107,107,254,247,28,23,102,123,67,176,123,100,162,
+51,60,92,22,126,87,72,145,0,1,0,75,0,73,6,208,7,86,0,85,0,0,1,33,17,20,22,
+22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,
+38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,
+50,22,23,17,33,38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,51,
+50,22,23,51,6,208,252,218,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,
+150,246,137,78,112,59,105,191,118,108,131,91,1,86,66,75,82,100,91,79,141,
+87,179,139,113,190,131,2,128,15,72,76,37,76,102,68,149,143,7,85,2,84,132,
+53,80,72,34,127,134,21,119,4,143,253,4,102,77,32,127,192,94,34,89,73,79,97,
+142,125,116,254,243,184,56,125,118,1,152,169,144,112,92,131,29,21,66,78,83,
+71,80,90,87,166,114,153,198,163,219,1,112,105,96,9,12,168,154,52,50,9,51,
+103,85,10,8,169,205,0,1,0,75,255,84,6,175,7,86,0,116,0,0,5,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,22,23,38,53,
+53,6,35,34,38,38,53,53,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,
+34,38,38,53,52,54,51,50,22,23,17,33,38,38,35,34,7,6,35,34,38,53,52,55,23,
+7,20,22,51,50,55,55,50,22,23,51,23,33,17,20,22,22,51,50,54,55,6,35,34,38,
+53,52,54,51,50,22,21,20,7,5,193,8,103,47,78,62,29,100,118,50,136,150,21,88,
+12,94,97,24,86,15,81,38,61,83,62,40,8,121,166,75,117,57,104,192,117,108,131,
+91,1,84,65,72,87,98,88,79,143,89,179,139,113,189,131,2,45,15,72,76,35,100,
+77,31,149,143,7,85,2,84,132,39,70,90,128,133,21,170,69,252,250,26,59,48,106,
+177,32,43,65,77,86,97,98,110,126,72,172,74,80,48,12,14,176,164,90,86,20,60,
+60,93,108,8,1,9,43,82,75,95,117,207,83,58,119,122,150,168,143,112,92,131,
+29,21,66,78,86,69,78,91,87,166,114,153,198,162,219,1,111,104,91,8,7,168,154,
+52,50,9,51,103,85,6,6,165,203,107,254,8,102,74,35,150,113,34,89,73,79,97,
+138,119,130,105,0,2,0,52,0,0,5,194,7,86,0,62,0,78,0,0,1,33,34,39,22,18,21,
+20,6,35,32,3,54,54,55,38,38,35,34,6,21,20,22,23,39,52,54,51,50,22,21,20,6,
+35,34,38,38,53,52,54,51,50,22,23,55,52,38,39,46,2,53,52,54,55,23,6,6,21,20,
+22,23,33,1,6,7,22,22,51,50,54,53,52,2,39,22,22,21,20,5,194,254,99,61,48,210,
+168,238,208,254,110,118,182,212,38,106,193,124,101,121,52,39,1,86,66,75,82,
+100,91,79,141,87,179,139,115,194,137,2,38,24,83,72,36,70,89,124,75,68,59,
+72,2,58,253,210,88,194,29,145,116,153,164,132,182,39,39,4,143,4,233,254,169,
+165,202,228,1,249,36,156,106,165,135,104,90,58,76,14,19,66,78,83,71,80,90,
+82,161,114,151,190,171,232,39,59,173,57,119,111,103,60,73,129,60,135,48,91,
+56,62,123,89,253,32,110,77,112,132,190,170,163,1,41,221,95,143,88,174,0,0,
+1,0,45,0,34,4,254,4,250,0,70,0,0,1,38,38,35,34,6,21,20,23,53,52,54,51,50,
+22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,54,55,22,22,21,20,7,22,21,20,
+6,6,35,32,0,3,55,18,0,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,23,54,53,
+52,38,39,6,7,3,80,69,143,96,92,108,56,86,66,75,82,100,84,74,138,87,164,119,
+101,139,72,124,59,113,135,54,84,109,208,142,254,239,254,146,135,84,122,1,
+83,228,167,193,46,74,89,69,90,85,72,52,50,74,32,28,98,132,3,110,107,94,95,
+80,86,37,9,66,78,83,71,79,91,87,160,104,132,181,98,123,142,78,37,184,121,
+141,120,98,147,107,179,105,1,91,1,134,37,254,213,254,232,122,106,69,43,85,
+71,72,65,78,16,83,149,40,77,25,123,127,0,1,0,55,254,107,5,8,4,250,0,105,0,
+0,1,35,39,38,38,35,34,6,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,22,22,23,38,53,53,6,35,32,0,3,55,18,0,51,50,54,53,52,39,6,35,34,38,53,
+52,54,51,50,23,54,54,53,52,38,39,6,7,35,38,38,35,34,6,21,20,23,53,52,54,51,
+50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,54,55,22,22,21,20,7,22,21,
+20,6,7,4,135,8,103,47,78,62,62,163,16,149,70,136,157,21,88,12,100,98,69,126,
+162,50,61,83,62,40,8,90,111,254,223,254,137,128,84,119,1,94,235,159,186,41,
+74,94,69,90,85,72,58,46,40,32,32,28,98,132,5,69,143,96,92,108,56,86,66,75,
+82,100,84,74,138,87,164,119,101,139,72,124,59,113,135,51,81,66,63,254,107,
+74,80,48,12,1,13,177,163,90,86,20,60,60,92,109,9,9,43,82,75,95,117,142,34,
+1,81,1,114,37,254,220,254,255,114,97,60,39,85,71,72,65,78,18,42,104,68,40,
+77,25,123,127,107,94,95,80,86,37,9,66,78,83,71,79,91,87,160,104,132,181,98,
+123,142,78,37,184,121,134,113,98,128,84,143,51,0,0,1,0,75,0,73,6,208,5,8,
+0,60,0,0,1,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,
+20,2,6,35,34,38,38,53,17,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,
+35,34,38,38,53,52,54,51,50,22,23,17,33,6,208,252,218,28,58,47,79,156,119,
+25,43,65,77,86,99,98,108,125,150,246,137,78,112,59,105,191,118,108,131,91,
+1,84,65,72,87,98,88,79,143,89,179,139,113,190,131,3,80,4,143,253,4,102,77,
+32,127,192,94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,1,152,169,
+144,112,92,131,29,21,66,78,86,69,78,91,87,166,114,153,198,163,219,1,112,0,
+0,1,0,95,255,113,4,146,5,159,0,70,0,0,5,35,39,53,38,38,35,34,6,21,20,22,23,
+39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,17,38,38,35,34,
+6,21,20,22,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,
+39,17,51,23,21,51,23,35,3,170,8,103,97,183,114,109,128,51,38,1,86,66,75,82,
+100,91,80,140,87,179,139,110,184,120,97,183,114,109,128,51,38,1,86,66,75,
+82,100,91,80,140,87,179,139,110,183,123,2,8,101,165,69,232,143,75,155,149,
+133,102,98,54,73,15,19,66,78,83,71,80,90,77,157,113,153,198,154,196,2,95,
+149,133,102,98,54,73,15,19,66,78,83,71,80,90,77,157,113,153,198,151,201,144,
+1,93,71,94,107,0,1,0,95,255,232,4,147,5,159,0,59,0,0,5,35,39,38,38,39,22,
+21,20,6,35,34,38,53,52,54,51,50,22,23,38,53,17,38,38,35,34,6,21,20,22,23,
+39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,39,17,51,23,21,
+51,23,35,3,170,6,105,43,171,95,4,75,69,83,90,112,90,118,234,73,5,97,183,114,
+109,128,51,38,1,86,66,75,82,100,91,80,140,87,179,139,109,182,125,2,8,101,
+166,69,233,24,104,90,121,6,19,20,68,81,100,75,81,102,144,116,76,153,1,110,
+149,133,102,98,54,73,15,19,66,78,83,71,80,90,77,157,113,153,198,150,203,164,
+1,93,71,94,107,0,2,0,75,255,232,5,216,5,159,0,53,0,60,0,0,5,35,39,38,38,39,
+23,20,6,35,34,38,53,52,54,55,17,38,38,35,34,6,21,20,23,39,52,54,51,50,22,
+21,20,6,35,34,38,38,53,52,54,51,50,22,23,38,53,17,51,23,21,33,23,35,1,22,
+23,38,53,17,35,4,240,6,104,35,96,77,2,75,69,83,90,108,88,105,191,118,108,
+131,91,1,86,66,75,82,100,91,79,141,87,179,139,114,193,136,9,8,101,1,235,69,
+232,254,186,134,86,5,215,24,104,83,110,18,34,68,81,100,75,80,101,2,1,58,169,
+144,112,92,131,29,21,66,78,83,71,80,90,87,166,114,153,198,169,228,78,136,
+1,78,71,94,107,253,49,50,175,89,124,2,219,0,0,2,255,196,255,215,5,110,4,250,
+0,3,0,58,0,0,1,33,39,33,1,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,21,
+20,7,22,21,20,6,35,32,0,3,55,18,18,22,51,50,54,53,52,39,6,35,34,38,53,52,
+54,51,50,23,54,53,52,38,35,34,6,7,5,110,250,156,70,5,100,252,254,60,74,91,
+75,78,100,137,242,149,151,182,45,75,224,195,254,221,254,143,101,84,86,215,
+234,147,144,170,36,78,95,74,82,85,72,51,47,75,99,92,123,181,75,4,143,107,
+254,1,82,64,75,81,104,100,99,188,118,169,137,108,99,89,140,172,197,1,176,
+1,211,25,254,214,254,192,111,114,97,60,36,89,77,67,65,79,14,75,92,71,76,102,
+97,0,3,255,197,254,11,5,59,4,250,0,3,0,64,0,70,0,0,1,33,39,33,1,35,39,38,
+38,39,39,54,55,36,3,55,18,18,22,51,50,54,53,52,39,6,35,34,38,53,52,54,51,
+50,23,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,54,54,51,50,22,21,
+20,7,22,21,20,6,7,7,6,7,22,22,23,5,59,250,207,69,5,48,254,207,4,103,66,238,
+195,83,93,172,254,145,143,84,77,206,239,149,127,158,22,80,107,74,82,85,72,
+73,60,40,95,82,190,135,50,60,91,75,79,99,142,235,131,153,180,30,60,109,97,
+111,202,183,108,229,48,4,143,107,249,17,74,81,86,6,232,54,82,145,2,147,25,
+254,245,254,214,114,95,88,42,27,84,77,67,65,79,22,55,70,69,68,129,8,79,57,
+75,81,96,99,96,157,91,159,137,84,74,78,120,115,164,39,29,84,98,20,121,64,
+0,1,0,88,255,232,5,223,5,159,0,61,0,0,5,35,39,38,36,35,39,23,50,36,54,53,
+52,38,39,6,7,35,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,
+53,52,54,51,50,22,23,54,55,22,22,21,16,5,22,4,23,17,51,23,21,51,23,35,4,234,
+4,103,137,254,37,249,82,40,180,1,10,179,33,28,71,85,5,53,132,93,86,83,59,
+3,80,56,63,82,96,80,117,160,145,115,87,120,50,41,77,112,136,254,146,150,1,
+36,100,8,101,178,69,245,24,74,179,134,229,1,48,159,155,48,93,28,134,110,102,
+99,96,71,83,28,42,60,66,84,66,70,83,185,131,125,167,119,98,69,147,40,203,
+128,254,179,98,36,148,108,4,236,71,94,107,0,0,2,255,197,255,60,4,113,4,250,
+0,3,0,61,0,0,1,33,39,33,3,35,39,53,38,38,39,22,21,20,6,35,34,38,53,52,54,
+51,50,22,23,38,53,53,6,35,34,0,3,55,30,2,51,50,54,53,52,38,39,22,21,20,6,
+35,34,38,53,52,54,51,50,22,22,21,20,6,7,4,113,251,153,69,4,103,225,6,104,
+53,148,86,5,75,69,83,90,112,90,113,222,67,6,46,54,209,254,250,83,82,57,114,
+167,127,118,129,77,77,10,78,75,87,91,115,109,105,162,88,69,64,4,143,107,250,
+66,104,47,72,89,12,17,23,68,81,100,75,81,102,140,113,88,132,101,12,1,55,1,
+98,25,175,209,111,107,104,67,84,7,33,35,75,85,102,77,90,116,97,164,96,100,
+155,46,0,0,1,255,196,255,23,5,192,4,250,0,61,0,0,5,35,39,38,38,39,23,20,6,
+35,34,38,53,52,54,55,38,39,6,35,34,0,3,55,18,22,51,50,54,53,52,38,39,22,21,
+20,6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,23,22,23,38,53,17,33,39,33,23,
+35,4,216,6,104,40,100,77,2,72,76,76,93,108,86,34,50,37,47,218,254,234,82,
+82,102,222,154,116,133,76,77,10,78,75,87,91,115,109,153,201,81,73,53,29,155,
+92,4,251,159,69,5,183,69,232,233,104,82,110,18,25,71,86,96,75,80,105,2,62,
+44,10,1,87,1,66,25,254,233,216,113,98,67,84,7,33,35,75,85,102,77,90,116,204,
+153,99,166,48,62,97,45,187,71,143,3,172,107,107,0,0,2,255,197,254,206,4,71,
+4,250,0,3,0,78,0,0,1,33,39,33,3,35,39,53,38,35,34,21,39,38,38,35,34,6,21,
+20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,23,54,54,51,50,22,
+23,17,6,35,34,0,3,55,30,2,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,
+54,51,50,22,22,21,20,7,4,71,251,195,69,4,61,153,6,104,65,67,80,42,25,85,73,
+63,78,39,2,66,55,60,71,77,67,59,110,69,101,99,117,64,13,54,45,55,82,37,68,
+81,209,254,250,83,82,57,114,167,127,118,129,77,77,10,78,75,87,91,115,109,
+105,162,88,85,4,143,107,249,212,104,210,106,141,16,59,69,63,56,59,27,50,61,
+73,62,62,70,66,131,93,106,140,141,70,67,94,86,1,17,28,1,55,1,98,25,175,209,
+111,107,104,67,84,7,33,35,75,85,102,77,90,116,97,164,96,162,95,0,0,1,255,
+197,255,232,7,243,5,159,0,67,0,0,5,35,39,17,38,38,35,34,6,7,54,51,50,22,21,
+20,6,7,39,36,53,52,38,35,34,7,39,54,55,33,17,20,7,54,54,55,23,6,21,20,23,
+7,38,53,52,55,6,6,7,39,17,35,39,33,54,51,50,22,23,38,53,17,51,23,21,51,23,
+35,7,10,8,103,111,162,107,66,115,72,62,75,114,138,127,148,122,1,35,64,55,
+117,114,149,86,78,253,18,4,93,205,146,173,112,38,87,74,34,112,176,135,100,
+135,69,4,216,46,54,108,176,135,9,8,101,166,69,233,24,75,3,3,170,130,58,80,
+20,131,109,108,193,110,185,114,141,50,57,81,147,127,74,254,222,100,75,93,
+153,87,146,157,204,149,124,38,193,186,119,93,74,155,138,66,2,148,107,14,141,
+211,78,133,1,36,71,94,107,0,2,255,197,255,232,7,112,4,250,0,39,0,59,0,0,5,
+35,39,38,36,39,39,55,38,38,53,52,55,33,17,20,7,54,54,55,23,6,21,20,23,7,38,
+53,52,55,6,6,7,39,17,35,39,33,23,35,3,6,7,22,4,23,17,33,34,6,21,20,22,51,
+50,54,55,7,54,55,6,136,4,103,125,254,184,193,79,220,95,121,36,253,144,4,93,
+205,146,173,112,38,87,74,34,112,176,135,100,135,69,7,102,69,232,222,245,163,
+136,1,26,102,254,116,73,95,75,62,28,41,32,7,90,65,24,74,186,213,19,220,128,
+31,119,86,68,47,254,222,100,75,93,153,87,146,157,204,149,124,38,193,186,119,
+93,74,155,138,66,2,148,107,107,254,162,113,98,37,235,158,3,223,74,73,59,74,
+11,15,8,43,27,0,0,1,255,197,255,206,5,212,4,250,0,39,0,0,5,38,53,52,55,6,
+6,7,39,17,52,55,6,6,7,39,17,35,39,33,23,33,17,20,7,54,54,55,23,6,21,21,54,
+54,55,23,6,21,20,23,4,172,74,34,112,176,135,100,34,112,177,133,100,135,69,
+5,201,70,251,44,4,93,205,146,173,125,92,203,145,173,112,38,50,193,186,119,
+93,74,155,138,66,1,100,116,96,76,155,136,66,2,148,107,107,254,222,100,75,
+93,153,87,146,177,179,94,92,151,86,146,157,204,149,124,0,2,255,197,254,249,
+6,41,4,250,0,40,0,46,0,0,1,35,39,38,38,39,39,54,37,17,6,6,7,39,17,52,55,6,
+6,7,39,17,35,39,33,23,33,21,20,7,54,54,55,23,6,21,21,54,54,55,23,3,6,7,22,
+22,23,5,77,4,103,69,190,170,83,203,1,49,145,219,149,100,34,112,177,133,100,
+135,69,6,30,70,250,215,4,93,205,146,173,125,92,203,145,173,111,172,144,87,
+183,46,254,249,74,84,84,5,232,116,117,1,6,89,186,152,66,1,40,116,96,76,155,
+136,66,2,98,107,107,240,100,75,93,153,87,146,177,179,34,92,151,86,146,254,
+50,69,74,18,116,69,0,2,255,197,255,109,5,68,4,250,0,41,0,47,0,0,5,38,53,52,
+55,7,17,35,39,38,38,39,39,54,37,17,6,6,7,39,17,35,39,33,23,33,17,20,7,54,
+54,55,23,17,54,55,23,6,21,20,22,23,1,6,7,22,22,23,4,97,111,18,198,4,103,69,
+190,170,83,203,1,49,137,191,146,100,135,69,5,57,70,251,188,4,93,205,146,134,
+154,119,126,106,31,32,254,45,172,144,87,183,46,40,186,212,64,76,69,253,192,
+74,84,84,5,232,116,117,1,20,87,164,149,66,2,148,107,107,254,222,100,75,93,
+153,87,113,254,196,54,29,124,120,175,84,119,73,1,136,69,74,18,116,69,0,0,
+3,255,197,254,42,5,76,4,250,0,48,0,54,0,60,0,0,1,35,39,46,2,39,39,54,37,38,
+38,39,39,54,37,53,6,6,7,39,17,35,39,33,23,33,21,20,7,54,54,55,23,17,54,55,
+23,6,21,20,22,23,7,38,53,52,55,7,7,6,7,22,22,23,21,6,7,22,22,23,3,62,4,103,
+50,134,136,99,67,130,1,18,52,143,152,83,203,1,49,134,176,164,100,135,69,5,
+65,70,251,180,6,94,200,152,134,154,119,126,106,31,32,65,111,18,198,111,180,
+134,90,180,44,142,107,76,136,37,254,42,74,65,65,20,3,199,75,110,32,32,5,232,
+116,117,226,87,134,139,66,2,48,107,107,190,102,92,83,139,90,113,254,246,54,
+29,124,120,175,84,119,73,34,186,212,64,76,69,44,72,69,15,96,64,187,56,49,
+24,91,55,0,1,255,197,255,143,4,40,4,250,0,40,0,0,5,35,39,53,38,38,39,22,21,
+20,6,35,34,38,53,52,54,51,50,22,23,38,53,17,6,6,7,39,17,35,39,33,23,33,17,
+20,7,54,54,55,23,3,62,6,104,53,148,86,5,75,69,83,90,112,90,113,222,67,6,137,
+191,146,100,135,69,4,29,70,252,216,4,93,205,146,134,113,104,47,72,89,12,17,
+23,68,81,100,75,81,102,140,113,88,132,1,238,87,164,149,66,2,148,107,107,254,
+222,100,75,93,153,87,113,0,0,1,255,197,255,11,4,145,4,250,0,57,0,0,1,22,22,
+21,20,6,35,34,0,3,55,30,2,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,22,
+21,20,7,54,55,38,53,52,55,6,6,7,39,17,35,39,33,23,33,21,20,7,54,54,55,23,
+6,21,3,95,73,84,200,183,205,254,219,106,80,76,166,176,111,123,151,28,142,
+166,103,125,83,69,60,77,10,52,81,27,34,131,215,137,100,178,69,4,134,70,252,
+154,5,107,223,175,173,112,1,226,67,170,94,188,208,1,52,1,93,34,200,218,81,
+126,105,62,40,171,114,95,64,86,77,64,28,25,34,102,114,112,119,93,84,162,121,
+66,2,108,107,107,250,88,100,94,148,104,146,157,204,0,1,255,197,254,127,4,
+132,4,250,0,76,0,0,1,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,55,55,50,22,22,23,38,53,53,52,39,6,6,35,34,38,53,52,54,51,50,22,21,
+20,7,54,55,38,53,52,55,6,6,7,39,17,35,39,33,23,33,21,20,7,54,54,55,23,6,21,
+20,23,22,21,3,238,8,102,27,36,58,46,49,130,123,68,140,143,21,88,12,88,106,
+43,134,134,55,75,57,39,9,65,84,150,98,95,120,81,68,59,76,10,73,108,14,34,
+118,176,159,100,195,69,4,121,70,252,184,5,112,198,165,173,112,4,155,254,127,
+74,49,48,31,13,13,173,167,90,86,20,60,60,96,105,10,8,42,81,77,106,106,118,
+117,78,92,74,108,87,63,85,76,63,32,21,45,130,84,83,120,93,74,131,133,66,2,
+78,107,107,220,89,102,96,129,94,146,157,204,55,40,182,216,0,0,2,255,197,255,
+231,5,88,4,250,0,28,0,46,0,0,5,35,39,38,39,23,20,6,35,34,38,53,52,54,55,38,
+53,52,55,6,6,7,39,17,35,39,33,23,35,5,6,21,20,23,22,22,23,38,53,17,33,17,
+20,7,54,54,55,4,111,6,104,84,153,2,72,76,76,93,94,81,14,34,112,176,135,100,
+135,69,5,77,70,233,254,246,112,5,84,138,45,4,252,255,4,93,205,146,25,104,
+176,35,26,71,86,96,75,74,104,8,81,81,119,93,74,155,138,66,2,118,107,107,248,
+157,204,48,57,22,126,87,72,145,2,220,254,252,100,75,93,153,87,0,0,2,0,88,
+255,181,4,108,5,15,0,56,0,62,0,0,5,35,39,53,38,38,39,22,21,20,6,35,34,38,
+53,52,54,51,50,22,23,38,53,38,36,35,39,54,55,38,38,53,52,54,51,50,22,21,20,
+6,35,34,38,39,6,21,20,22,23,54,55,53,33,23,35,17,51,39,4,7,22,4,23,3,133,
+6,104,57,164,90,5,75,69,83,90,112,90,118,241,67,6,111,254,186,186,79,99,109,
+62,80,138,100,90,91,65,53,49,68,1,78,70,76,170,215,1,17,69,232,1,111,254,
+141,120,137,1,8,90,75,104,47,64,79,10,23,17,68,81,100,75,81,102,135,105,77,
+114,89,92,204,58,58,32,114,78,93,128,82,67,54,62,53,55,26,80,47,68,12,84,
+92,193,107,254,135,103,164,65,23,118,92,0,3,0,88,255,232,5,178,5,15,0,45,
+0,52,0,61,0,0,5,35,39,38,38,39,23,20,6,35,34,38,53,52,55,38,35,39,54,55,38,
+38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,23,54,55,53,33,23,35,
+1,22,23,38,53,17,35,3,4,6,7,22,22,23,54,51,4,201,6,104,35,96,77,2,75,69,83,
+90,53,225,253,79,99,109,62,80,138,100,90,91,65,53,49,68,1,78,70,76,170,215,
+2,87,69,233,254,187,135,84,5,214,110,254,227,143,63,111,233,92,26,29,24,104,
+83,110,18,34,68,81,100,75,79,51,117,204,58,58,32,114,78,93,128,82,67,54,62,
+53,55,26,80,47,68,12,84,92,193,107,253,48,50,174,89,124,2,219,254,238,126,
+69,35,20,107,76,6,0,0,1,255,197,0,73,6,169,7,86,0,75,0,0,1,33,17,20,22,22,
+51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,53,2,
+39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,33,39,33,38,38,35,34,7,6,35,
+34,38,53,52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,6,169,252,217,28,58,
+47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,112,59,125,215,
+16,93,89,100,118,146,124,161,231,62,252,247,69,5,177,15,72,76,37,76,102,68,
+149,143,7,85,2,84,132,53,80,72,34,127,134,21,149,4,143,253,4,102,77,32,127,
+192,94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,120,1,20,23,38,44,
+86,95,122,99,106,125,200,145,2,20,107,105,96,9,12,168,154,52,50,9,51,103,
+85,10,8,169,205,0,0,1,255,197,255,84,6,94,7,86,0,104,0,0,5,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,22,23,38,53,
+53,6,35,34,38,39,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,33,39,
+33,38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,22,51,50,55,55,50,22,23,51,23,
+33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,7,5,122,8,103,
+47,78,62,28,106,122,51,136,150,21,88,12,94,97,24,90,16,86,38,61,83,62,40,
+8,121,166,108,128,10,120,203,16,93,89,100,118,146,124,148,220,66,253,23,69,
+5,91,15,72,76,35,100,77,31,149,143,7,85,2,84,132,39,70,90,128,133,21,160,
+69,253,4,26,59,48,106,177,32,43,65,77,86,97,98,110,126,72,172,74,80,48,12,
+14,176,164,90,86,20,60,60,93,108,8,1,9,43,82,75,95,117,207,83,108,116,243,
+21,38,44,86,95,122,99,106,125,172,130,1,203,107,104,91,8,7,168,154,52,50,
+9,51,103,85,6,6,165,203,107,254,8,102,74,35,150,113,34,89,73,79,97,138,119,
+130,105,0,0,2,255,197,0,0,5,173,7,86,0,51,0,67,0,0,1,33,34,39,22,18,21,20,
+6,35,32,3,54,55,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,53,52,39,
+33,39,33,46,2,53,52,54,55,23,6,6,21,20,22,23,33,1,6,7,22,22,51,50,54,53,52,
+2,39,22,22,21,20,5,173,254,99,61,48,210,168,238,208,254,110,118,211,115,109,
+164,10,87,83,93,110,128,120,126,238,77,75,47,253,28,69,2,253,60,64,38,70,
+89,124,75,68,59,72,2,58,253,210,88,194,29,145,116,153,164,132,182,39,39,4,
+143,4,233,254,169,165,202,228,1,249,43,102,165,20,30,33,80,89,113,93,97,119,
+170,148,98,129,120,113,107,81,98,104,59,73,129,60,135,48,91,56,62,123,89,
+253,32,110,77,112,132,190,170,163,1,41,221,95,143,88,174,0,1,255,197,0,23,
+5,210,4,250,0,51,0,0,1,33,17,20,51,50,54,55,22,21,20,6,35,34,36,39,55,22,
+22,51,50,54,53,52,39,6,6,35,34,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,
+54,51,50,23,17,33,39,33,5,210,253,46,36,55,148,137,202,224,187,190,254,217,
+111,78,92,247,158,153,178,56,103,160,91,51,74,48,6,47,116,80,10,87,83,93,
+110,128,120,213,143,253,124,69,5,200,4,143,254,47,51,117,149,209,248,200,
+237,241,248,45,177,165,155,134,111,72,107,92,41,87,74,75,81,9,30,33,80,89,
+113,93,97,119,207,1,73,107,0,1,255,197,254,218,5,210,4,250,0,87,0,0,1,35,
+39,38,38,35,34,7,6,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,
+22,23,38,53,53,6,35,34,36,39,55,22,22,51,50,54,53,52,39,6,6,35,34,38,39,38,
+38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,33,39,33,23,33,17,20,51,
+50,54,55,22,22,21,20,6,7,4,145,8,103,47,78,62,64,132,15,147,55,136,154,21,
+88,12,97,98,53,135,108,64,61,83,62,40,8,59,64,185,254,227,107,74,81,241,160,
+152,179,40,110,166,94,71,87,15,48,118,83,10,87,83,93,110,128,120,112,179,
+65,253,124,69,5,200,69,253,46,36,57,160,137,95,93,92,85,254,218,74,80,48,
+13,1,12,176,164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,80,14,210,240,43,
+158,143,151,128,88,62,117,99,81,70,81,86,9,30,33,80,89,113,93,97,119,114,
+93,1,43,107,107,254,117,51,126,148,85,198,132,126,187,53,0,0,1,255,197,255,
+231,4,158,4,250,0,68,0,0,1,35,22,21,20,6,35,22,22,21,20,6,35,32,3,55,22,22,
+51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,51,38,38,39,38,38,39,
+22,21,20,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,33,39,
+33,4,158,252,81,122,98,101,117,188,163,254,92,184,81,84,249,183,123,131,77,
+77,10,80,75,87,89,115,109,18,36,57,37,44,59,39,19,85,78,78,95,99,96,63,116,
+89,62,85,55,63,73,34,27,252,211,69,4,148,4,143,110,134,114,138,39,181,112,
+170,194,2,99,29,212,233,106,105,67,84,7,33,35,74,86,102,77,90,116,17,49,39,
+45,46,9,44,37,76,91,102,80,89,118,44,66,46,44,75,76,51,92,31,107,0,0,2,255,
+197,254,21,4,155,4,250,0,74,0,81,0,0,1,35,39,38,36,39,39,54,55,38,3,55,22,
+22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,38,38,39,22,
+21,20,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,39,33,23,
+35,22,21,20,6,7,22,22,21,20,6,15,2,4,7,22,22,23,3,81,4,103,81,254,246,161,
+83,91,173,198,157,75,107,246,155,120,145,84,78,10,78,75,87,91,97,88,45,37,
+42,60,39,19,85,78,78,95,99,96,63,116,89,62,85,55,63,73,39,252,202,69,4,145,
+69,241,60,84,72,80,90,86,77,111,4,254,251,127,108,236,48,254,21,74,100,68,
+5,223,52,72,124,1,132,38,204,217,107,102,67,86,7,33,35,75,85,102,77,78,112,
+13,33,43,44,47,9,44,37,76,91,102,80,89,118,44,66,46,44,75,76,77,67,107,107,
+98,116,95,127,21,47,166,98,106,161,45,41,1,86,60,20,121,64,0,1,255,197,255,
+31,6,24,4,250,0,93,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,
+20,22,51,50,55,54,51,50,22,23,38,53,17,52,38,38,35,34,6,7,54,51,50,22,21,
+20,6,35,34,38,53,52,55,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,22,22,51,50,54,53,52,38,39,33,39,33,23,33,22,21,21,54,51,50,22,22,
+21,5,66,8,103,50,93,74,55,124,128,43,161,202,26,89,20,146,124,36,112,101,
+48,90,122,64,8,26,53,45,95,173,31,37,68,75,82,101,95,97,120,41,52,75,46,44,
+59,39,19,85,78,78,95,99,96,63,116,89,62,85,55,63,73,34,27,252,224,69,6,14,
+69,253,125,81,51,57,76,109,55,225,74,74,54,15,14,191,211,113,107,21,85,80,
+128,120,10,11,101,112,95,117,1,190,98,81,31,160,110,43,89,65,77,94,132,111,
+95,82,14,58,49,45,46,9,44,37,76,91,102,80,89,118,44,66,46,44,75,76,51,92,
+31,107,107,110,134,12,12,58,129,119,0,0,1,255,197,255,132,4,121,4,250,0,72,
+0,0,5,38,36,39,39,22,51,50,54,53,52,38,35,7,22,21,20,6,35,34,38,53,52,54,
+51,23,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,23,22,22,51,
+50,54,53,52,38,39,33,39,33,23,35,22,21,20,6,7,22,22,21,20,6,7,22,23,3,242,
+153,254,168,167,27,116,138,143,156,107,86,51,18,79,81,76,98,145,117,31,33,
+63,43,59,39,19,85,78,78,95,99,96,56,94,69,49,61,86,55,63,73,34,27,252,243,
+69,4,111,69,247,81,104,87,93,97,124,115,129,178,124,88,95,5,178,20,98,97,
+69,85,3,33,35,70,86,87,81,92,114,1,22,67,46,50,9,44,37,76,91,102,80,89,118,
+32,45,38,48,47,75,76,51,92,31,107,107,110,134,106,133,11,46,167,100,104,141,
+27,41,106,0,1,255,197,254,131,4,158,4,250,0,104,0,0,1,35,39,38,38,35,34,7,
+6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,38,
+39,39,22,51,50,54,53,52,38,35,7,22,21,20,6,35,34,38,53,52,54,51,23,38,39,
+38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,
+39,33,39,33,23,35,22,21,20,6,7,22,22,21,20,6,7,22,23,7,38,39,3,147,8,103,
+47,78,62,29,78,90,50,136,150,21,88,12,94,97,18,81,61,34,61,83,62,40,8,214,
+215,27,116,138,130,169,110,83,51,18,79,81,76,98,145,117,31,33,63,43,59,39,
+19,85,78,78,95,99,96,56,94,69,49,61,86,55,63,73,45,252,198,69,4,148,69,239,
+65,105,86,92,98,120,114,125,177,36,56,68,254,131,74,80,48,12,14,176,164,90,
+86,20,60,60,93,108,9,9,43,82,75,95,117,53,75,6,178,20,83,92,68,66,3,33,35,
+70,86,87,81,92,114,1,22,67,46,50,9,44,37,76,91,102,80,89,118,32,45,38,48,
+47,75,76,82,62,107,107,97,117,106,133,11,45,160,88,101,129,24,39,106,65,32,
+31,0,0,1,255,196,255,231,6,72,4,250,0,43,0,0,5,2,17,52,55,6,6,7,39,53,38,
+39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,33,39,33,23,33,17,20,7,54,
+37,23,6,6,21,20,22,23,5,89,140,49,112,206,143,100,120,181,9,96,83,96,98,133,
+115,138,213,66,253,60,69,6,62,70,252,244,4,207,1,10,180,66,59,46,52,25,1,
+13,1,0,153,140,85,202,155,66,123,247,27,30,29,77,95,114,90,101,117,180,130,
+1,216,107,107,254,132,97,73,232,171,163,108,204,113,115,198,111,0,2,255,197,
+255,109,6,97,4,250,0,43,0,49,0,0,5,35,39,38,38,39,39,54,37,17,6,6,7,39,53,
+38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,33,39,33,23,33,17,20,7,
+54,54,55,23,3,6,7,22,22,23,5,120,4,103,69,190,170,83,203,1,49,137,191,146,
+100,120,203,10,87,83,93,110,128,120,127,235,76,253,63,69,6,86,70,252,217,
+4,93,205,146,134,111,172,144,87,183,46,147,74,84,84,5,232,116,117,1,20,87,
+164,149,66,33,250,25,30,33,80,89,113,93,97,119,168,144,1,218,107,107,254,
+222,100,75,93,153,87,113,253,232,69,74,18,116,69,0,1,255,197,255,164,6,164,
+4,250,0,67,0,0,5,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,23,38,53,52,54,55,6,6,7,39,38,38,39,22,21,20,6,35,34,38,53,52,54,
+51,50,22,23,17,33,39,33,23,33,17,7,54,37,23,6,2,21,20,22,23,5,171,41,85,71,
+56,175,168,75,144,162,27,91,21,101,99,68,154,123,52,119,70,46,27,27,124,224,
+178,100,80,156,94,16,93,89,100,118,146,124,153,225,66,253,39,69,6,153,70,
+252,174,3,238,1,38,180,63,62,46,52,92,70,58,25,27,176,164,119,110,17,105,
+55,113,104,24,20,66,151,145,81,208,81,79,184,159,66,192,168,13,38,43,86,95,
+122,99,106,125,205,147,1,253,107,107,254,102,118,220,161,163,103,254,246,
+123,115,198,111,0,0,2,255,197,255,233,5,72,4,250,0,45,0,51,0,0,37,38,53,52,
+55,7,17,35,39,38,38,39,39,54,37,38,39,22,21,20,6,35,34,38,53,52,54,51,50,
+22,23,17,33,39,33,23,33,17,54,55,23,6,21,20,22,23,1,6,7,22,22,23,4,91,111,
+18,198,4,103,69,190,170,83,193,1,38,107,159,10,87,83,93,110,128,120,121,208,
+73,253,65,69,5,62,69,253,240,154,119,126,106,31,32,254,45,172,144,87,183,
+46,84,186,212,64,76,69,253,192,74,84,84,5,232,110,114,156,19,30,33,80,89,
+113,93,97,119,143,109,1,118,107,107,254,75,54,29,124,120,175,84,119,73,1,
+136,69,74,18,116,69,0,0,2,255,197,254,216,5,124,4,250,0,73,0,79,0,0,1,35,
+39,38,38,35,34,6,7,6,35,34,38,53,52,55,23,6,21,20,22,51,55,55,50,22,23,38,
+53,53,46,2,39,39,54,37,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,
+33,39,33,23,33,17,54,55,23,6,21,20,22,23,7,38,53,52,55,7,7,6,7,22,22,23,3,
+122,8,103,43,75,66,25,60,10,76,49,136,150,21,88,12,94,97,97,70,77,100,66,
+8,51,137,137,100,83,191,1,23,104,145,10,95,77,92,109,128,120,121,208,73,252,
+255,69,5,114,69,253,254,154,119,126,106,31,32,65,111,18,198,111,178,136,91,
+179,44,254,216,74,75,48,8,1,12,176,164,90,86,20,60,60,93,108,7,6,73,122,95,
+117,71,59,59,17,3,232,110,108,134,17,30,33,75,94,112,94,97,119,143,109,1,
+78,107,107,254,145,54,29,124,120,175,84,119,73,34,186,212,64,76,69,43,72,
+70,15,95,64,0,0,1,255,213,255,232,4,83,4,250,0,45,0,0,5,35,39,53,38,38,39,
+22,21,20,6,35,34,38,53,52,54,51,50,22,23,38,53,53,38,39,22,21,20,6,35,34,
+38,53,52,54,51,50,22,23,17,33,39,33,23,35,3,106,6,104,54,174,100,6,81,75,
+90,98,121,98,130,251,71,6,123,198,15,87,84,93,113,139,116,152,218,58,253,
+31,69,4,56,70,233,24,104,47,72,92,11,24,23,73,88,108,81,90,109,150,118,89,
+133,126,237,23,34,43,81,90,114,95,100,117,183,134,1,228,107,107,0,2,255,197,
+255,232,5,177,4,250,0,38,0,45,0,0,5,35,39,38,38,39,23,20,6,35,34,38,53,52,
+54,55,53,2,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,33,39,33,23,35,
+1,22,23,38,53,17,35,4,200,6,104,35,96,77,2,75,69,83,90,108,88,125,215,16,
+93,89,100,118,146,124,161,231,62,252,247,69,5,166,70,233,254,186,134,86,5,
+215,24,104,83,110,18,34,68,81,100,75,80,101,2,26,1,20,23,38,44,86,95,122,
+99,106,125,200,145,2,20,107,107,253,49,50,175,89,124,2,219,0,2,255,197,255,
+232,6,118,4,250,0,51,0,64,0,0,5,35,39,17,38,38,35,34,6,6,7,6,6,35,34,38,39,
+55,22,22,51,50,55,38,39,22,21,20,6,35,34,38,53,52,54,51,50,4,23,54,55,38,
+38,35,34,7,39,33,39,33,23,35,35,33,22,22,23,54,54,51,50,22,23,38,53,5,141,
+6,104,49,54,34,31,43,57,42,66,163,88,74,126,60,74,36,64,40,65,72,122,206,
+16,93,89,100,118,146,124,148,1,4,83,29,29,10,133,139,43,54,63,254,82,69,6,
+107,70,233,109,253,132,117,139,10,38,82,45,58,104,52,9,24,104,2,44,67,48,
+26,93,99,154,174,105,124,43,57,38,94,252,23,38,44,86,95,122,99,106,125,205,
+185,51,73,181,162,10,160,107,107,26,181,159,80,47,98,96,80,109,0,0,2,0,34,
+0,73,7,127,7,86,0,76,0,88,0,0,1,33,17,20,22,22,51,50,54,54,55,6,35,34,38,
+53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,38,39,1,39,54,54,53,52,38,35,
+34,7,39,54,54,51,50,22,23,17,33,38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,
+22,51,50,55,54,51,50,22,23,51,1,38,38,35,34,6,7,54,51,50,22,23,7,127,252,
+217,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,112,59,
+38,40,254,0,127,70,58,55,44,72,63,144,146,220,140,113,203,145,2,99,15,72,
+76,37,76,102,68,149,143,7,85,2,84,132,53,80,72,34,127,134,21,149,251,254,
+61,122,71,103,148,94,29,42,93,124,3,4,143,253,4,102,77,32,127,192,94,34,89,
+73,79,97,142,125,116,254,243,184,56,125,118,1,116,64,57,254,46,127,62,87,
+49,54,53,42,143,206,150,176,240,1,146,105,96,9,12,168,154,52,50,9,51,103,
+85,10,8,169,205,254,232,68,64,87,116,9,118,94,0,2,0,12,255,145,5,103,5,159,
+0,59,0,70,0,0,1,22,22,21,20,6,35,34,0,3,55,22,4,51,50,54,53,52,38,39,22,21,
+20,6,35,34,38,53,52,54,51,51,53,39,1,39,55,54,53,52,38,35,34,7,39,54,54,51,
+50,22,23,38,53,17,51,23,21,33,23,33,5,38,35,34,6,7,54,51,50,22,23,4,36,105,
+123,216,176,222,254,165,108,81,102,1,41,190,134,161,77,77,10,80,75,87,89,
+115,109,16,64,254,16,127,50,68,47,42,72,63,144,118,234,144,126,204,118,7,
+8,101,1,0,69,254,189,254,227,109,128,84,136,98,24,30,83,115,10,2,77,38,183,
+115,164,200,1,30,1,23,29,193,206,108,103,67,84,7,33,35,74,86,102,77,90,116,
+221,87,254,90,127,44,70,74,37,40,42,143,148,158,156,189,119,96,1,18,71,94,
+107,129,95,60,89,5,99,88,0,2,0,12,255,232,5,13,5,159,0,50,0,61,0,0,5,35,39,
+53,38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,38,53,17,39,1,39,55,
+54,53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,21,51,23,35,5,38,
+35,34,6,7,54,51,50,22,23,4,36,6,104,55,193,100,6,75,69,83,90,122,99,136,238,
+69,6,64,254,16,127,50,68,47,42,72,63,144,118,234,144,126,204,118,7,8,101,
+166,69,233,254,227,109,128,84,136,98,24,30,83,115,10,24,104,47,74,96,9,24,
+22,68,81,98,75,82,103,137,117,77,115,1,168,87,254,90,127,44,70,74,37,40,42,
+143,148,158,156,189,119,96,1,18,71,94,107,129,95,60,89,5,99,88,0,4,0,44,255,
+43,5,65,5,159,0,43,0,54,0,63,0,73,0,0,5,35,39,17,39,1,39,54,54,53,52,38,35,
+34,6,7,39,54,55,39,54,54,53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,
+23,21,51,23,35,5,38,35,34,6,7,54,51,50,22,23,5,38,39,1,54,51,50,22,23,39,
+38,35,34,6,7,55,50,22,23,4,88,8,103,46,254,28,127,46,73,44,36,37,56,32,142,
+135,147,104,70,48,47,42,72,63,144,118,234,144,133,213,124,9,8,101,166,69,
+233,254,207,113,124,96,144,88,27,37,83,115,10,1,231,41,43,254,75,53,50,126,
+223,69,162,109,126,77,131,76,46,89,105,4,213,75,1,20,67,254,129,127,25,92,
+42,36,40,21,21,143,170,64,104,62,78,48,37,40,42,143,148,158,173,208,133,118,
+1,18,71,94,107,129,95,71,80,7,99,88,2,63,55,254,141,11,159,129,49,77,49,65,
+3,98,96,0,3,0,12,255,232,6,82,5,159,0,43,0,50,0,61,0,0,5,35,39,38,38,39,23,
+20,6,35,34,38,53,52,54,55,17,39,1,39,55,54,53,52,38,35,34,7,39,54,54,51,50,
+22,23,38,53,17,51,23,21,33,23,35,1,22,23,38,53,17,35,5,38,35,34,6,7,54,51,
+50,22,23,5,106,6,104,35,96,77,2,75,69,83,90,108,88,64,254,16,127,50,68,47,
+42,72,63,144,118,234,144,126,204,118,7,8,101,1,235,69,232,254,186,134,86,
+5,215,254,227,109,128,84,136,98,24,30,83,115,10,24,104,83,110,18,34,68,81,
+100,75,80,101,2,1,109,87,254,90,127,44,70,74,37,40,42,143,148,158,156,189,
+119,96,1,18,71,94,107,253,49,50,175,89,124,2,219,129,95,60,89,5,99,88,0,2,
+0,12,255,117,5,12,5,159,0,69,0,80,0,0,5,35,39,53,38,38,35,34,6,21,39,38,38,
+35,34,6,21,20,23,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,
+54,51,50,23,17,39,1,39,55,54,53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,
+17,51,23,21,51,23,35,5,38,35,34,6,7,54,51,50,22,23,4,36,8,103,41,74,42,47,
+54,36,41,103,75,75,91,47,79,65,69,84,91,77,69,128,81,121,103,78,109,29,29,
+106,117,89,64,254,16,127,50,68,47,42,72,63,144,118,234,144,126,204,118,7,
+8,101,165,69,232,254,227,109,128,84,136,98,24,30,83,115,10,139,104,212,59,
+72,86,75,11,85,68,79,64,67,24,54,75,84,65,64,80,72,138,95,115,136,85,64,145,
+174,2,28,87,254,90,127,44,70,74,37,40,42,143,148,158,156,189,119,96,1,18,
+71,94,107,129,95,60,89,5,99,88,0,3,255,197,255,232,7,133,4,250,0,55,0,68,
+0,79,0,0,5,35,39,17,38,38,35,34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,55,38,
+39,1,39,55,54,53,52,38,35,34,7,39,54,54,51,50,22,22,23,54,55,38,38,35,34,
+7,39,33,39,33,23,35,35,33,22,22,23,54,54,51,50,22,23,38,53,5,38,35,34,6,7,
+54,51,50,22,23,6,156,6,104,49,54,34,31,43,57,42,72,142,83,74,126,60,75,37,
+63,33,61,62,80,61,254,17,127,50,68,47,42,72,63,144,118,234,144,114,197,160,
+84,34,35,10,133,139,43,54,63,253,67,69,7,122,70,233,109,253,132,117,139,10,
+38,82,45,58,104,52,9,252,236,110,126,84,136,98,24,30,83,115,10,24,104,2,44,
+67,48,26,93,99,169,186,105,124,43,53,42,94,131,78,254,91,127,44,70,74,37,
+40,42,143,148,158,142,224,156,66,94,181,162,10,160,107,107,26,181,159,80,
+47,98,96,80,109,145,96,60,89,5,99,88,0,1,255,197,255,37,6,117,7,86,0,90,0,
+0,37,34,38,53,52,54,51,50,22,21,20,6,35,34,38,38,53,53,46,2,39,39,54,55,46,
+2,35,39,35,39,33,38,38,35,5,34,38,53,52,55,23,7,20,22,51,37,50,22,23,51,23,
+33,4,23,23,6,7,22,4,23,17,51,22,4,21,20,6,35,34,38,53,52,54,51,50,22,23,53,
+52,38,39,17,20,22,22,51,50,54,55,4,228,70,78,90,89,90,115,244,188,75,117,
+57,95,189,185,146,79,204,174,56,116,113,92,66,38,69,5,167,15,72,76,254,189,
+149,143,7,85,2,84,132,1,23,128,133,21,108,68,250,101,1,20,122,40,184,157,
+130,1,12,95,111,225,1,11,89,94,71,85,69,63,47,63,12,175,233,26,59,48,78,117,
+36,42,81,66,71,88,118,91,156,202,58,119,122,194,80,85,36,15,212,130,88,39,
+36,8,164,107,104,91,15,168,154,52,50,9,51,103,85,12,165,203,107,110,158,96,
+93,96,19,123,113,2,199,26,191,168,111,132,83,66,62,81,44,35,20,105,95,11,
+252,249,102,74,35,77,67,0,1,255,197,254,206,6,20,4,250,0,86,0,0,1,35,39,53,
+38,35,34,21,39,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,
+53,52,54,51,50,23,54,54,51,50,22,23,53,38,36,39,39,54,55,46,2,35,39,35,39,
+33,23,33,4,23,23,6,7,22,4,23,17,51,22,0,21,20,6,35,34,38,53,52,54,51,50,22,
+23,53,52,38,39,3,168,6,104,65,67,80,42,25,85,73,63,78,39,2,66,55,60,71,77,
+67,59,110,69,101,99,117,64,13,54,45,55,82,37,125,254,205,184,79,204,174,56,
+116,113,92,66,56,69,6,11,68,250,216,1,20,122,40,195,145,129,1,21,86,111,213,
+1,23,89,94,71,85,69,63,47,63,12,199,209,254,206,104,210,106,141,16,59,69,
+63,56,59,27,50,61,73,62,62,70,66,131,93,106,140,141,70,67,94,86,215,86,71,
+10,212,130,88,39,36,8,164,107,107,110,158,96,100,88,16,111,93,2,163,25,254,
+255,173,111,132,83,66,62,81,44,35,20,118,152,11,0,2,255,197,255,182,6,181,
+4,250,0,60,0,68,0,0,5,2,17,52,55,38,36,39,17,20,22,51,50,54,54,55,22,22,21,
+20,6,35,34,0,3,55,18,33,50,54,53,52,39,6,6,35,34,39,38,37,39,54,54,55,53,
+33,39,33,23,33,21,22,4,33,55,23,6,6,21,20,23,1,17,6,6,7,22,22,23,5,225,139,
+35,201,254,109,126,66,54,50,76,67,66,87,69,212,184,201,254,189,107,79,175,
+1,110,142,164,19,63,128,94,131,72,150,254,199,84,158,204,148,253,217,69,6,
+171,69,251,234,89,1,169,1,12,32,117,62,51,97,251,254,101,124,71,82,165,50,
+74,1,11,1,11,148,121,22,170,116,254,72,60,65,49,86,101,79,176,101,191,223,
+1,16,1,30,35,254,112,132,113,57,55,69,66,119,171,12,232,89,99,49,43,107,107,
+3,116,138,1,137,106,166,119,217,207,2,151,1,53,39,57,41,20,105,68,0,0,2,255,
+197,255,231,5,208,4,250,0,29,0,35,0,0,5,2,17,52,55,6,6,7,36,37,39,54,37,53,
+33,39,33,23,33,2,7,54,37,23,6,6,21,20,22,23,1,6,7,22,22,23,4,214,140,50,112,
+201,161,254,244,254,227,84,235,1,59,253,191,69,5,197,70,252,234,1,4,206,1,
+11,180,66,59,46,52,253,36,216,142,89,210,59,25,1,13,1,0,154,140,85,200,173,
+242,37,242,132,105,73,107,107,254,30,68,234,169,163,108,204,113,115,198,111,
+3,126,81,73,29,142,73,0,0,2,255,197,255,161,6,72,4,250,0,59,0,65,0,0,5,38,
+38,35,34,6,7,6,6,35,34,38,53,52,55,23,6,21,20,51,50,54,55,54,54,51,50,23,
+38,53,52,54,55,6,1,38,36,39,39,54,37,53,33,39,33,23,33,17,20,7,54,36,55,23,
+6,2,21,20,22,23,1,6,7,22,22,23,5,76,44,96,83,71,143,114,116,168,86,154,172,
+10,93,6,220,75,146,114,103,141,68,118,73,48,21,20,233,254,235,130,254,221,
+145,84,235,1,59,253,131,69,6,61,70,252,174,5,112,1,26,140,167,57,58,46,52,
+252,234,216,142,89,210,59,95,76,52,22,22,23,25,176,164,76,67,13,48,30,217,
+21,22,20,21,75,157,148,70,189,75,159,254,228,132,144,18,242,132,105,73,107,
+107,254,102,121,54,112,219,77,151,96,254,251,120,115,198,111,3,196,81,73,
+29,142,73,0,0,3,255,197,255,136,5,14,4,250,0,34,0,41,0,47,0,0,5,38,53,52,
+55,7,17,35,39,38,38,39,39,54,55,38,39,39,36,37,53,33,39,33,23,33,17,54,55,
+23,6,21,20,22,23,1,17,6,7,22,22,23,23,6,7,22,22,23,4,46,111,18,198,4,103,
+69,190,170,83,136,204,153,204,84,1,8,1,89,253,110,69,5,3,70,253,253,154,119,
+126,106,31,32,254,45,248,182,80,210,76,64,172,144,87,183,46,13,186,212,64,
+76,69,253,192,74,84,84,5,232,77,87,72,22,242,150,115,43,107,107,253,234,54,
+29,124,120,175,84,119,73,2,59,1,92,93,98,18,104,60,154,69,74,18,116,69,0,
+0,2,255,207,254,247,4,169,4,250,0,47,0,53,0,0,1,22,22,21,20,6,35,34,0,3,55,
+30,2,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,22,21,20,7,54,55,38,36,39,
+39,54,36,55,53,33,39,33,23,33,7,4,7,22,4,23,3,108,64,74,200,183,205,254,219,
+106,80,76,166,176,111,123,151,28,142,166,103,125,83,69,60,77,10,58,79,110,
+254,201,141,84,120,1,102,171,253,23,69,4,148,70,254,195,111,254,250,187,126,
+1,1,66,1,187,64,160,88,188,208,1,52,1,93,34,200,218,81,126,105,62,40,171,
+114,95,64,86,77,64,32,21,38,102,91,107,15,242,68,150,57,43,107,107,235,98,
+91,29,141,79,0,0,2,255,197,255,60,4,41,4,250,0,52,0,58,0,0,5,35,39,53,38,
+35,34,21,39,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,
+52,54,51,50,23,54,54,51,50,22,23,53,38,37,39,36,37,53,33,39,33,23,35,7,6,
+7,22,22,23,3,64,6,104,65,67,80,42,25,85,73,63,78,39,2,66,55,60,71,77,67,59,
+110,69,101,99,117,64,13,54,45,55,82,37,206,254,192,84,1,12,1,85,253,57,69,
+4,30,70,233,111,241,180,107,254,60,196,104,210,106,141,16,59,69,63,56,59,
+27,50,61,73,62,62,70,66,131,93,106,140,141,70,67,94,86,202,163,34,242,152,
+114,42,107,107,235,94,91,25,139,66,0,0,2,255,197,254,150,4,206,4,250,0,3,
+0,84,0,0,1,33,39,33,3,35,39,53,38,35,34,21,39,38,38,35,34,6,21,20,23,54,54,
+51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,23,54,54,51,50,22,23,17,6,35,
+34,38,2,39,55,30,2,51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,21,20,
+7,54,54,55,22,22,21,20,6,7,4,206,251,60,69,4,196,234,6,104,65,67,80,42,25,
+85,73,63,78,39,2,66,55,60,71,77,67,59,110,69,101,99,117,64,13,54,45,55,82,
+37,58,68,170,233,163,78,79,92,177,174,117,128,166,32,74,161,106,109,130,94,
+73,66,84,12,39,95,93,84,100,83,74,4,143,107,249,156,104,210,106,141,16,59,
+69,63,56,59,27,50,61,73,62,62,70,66,131,93,106,140,141,70,67,94,86,1,3,18,
+161,1,48,247,37,237,241,76,144,114,66,42,93,103,120,101,72,93,85,70,35,27,
+24,106,116,68,183,103,116,181,55,0,0,2,255,197,255,231,4,173,4,250,0,59,0,
+74,0,0,1,22,22,21,20,6,35,32,3,55,22,22,51,50,54,53,52,38,39,22,21,20,6,35,
+34,38,53,52,54,51,23,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,
+39,35,39,33,23,35,22,21,20,6,35,1,22,23,22,22,23,22,22,51,50,54,53,52,38,
+39,3,33,101,117,190,164,254,94,183,81,84,247,182,123,134,77,77,10,80,75,87,
+89,115,109,24,36,55,41,40,58,37,13,85,78,83,90,95,93,50,96,130,69,4,163,69,
+252,81,122,100,254,9,50,29,49,80,52,61,87,54,63,73,34,27,2,159,39,181,112,
+170,194,2,99,29,213,232,107,104,67,84,7,33,35,74,86,102,77,90,116,1,16,48,
+42,42,46,11,37,43,76,91,103,82,87,115,2,77,48,107,107,110,134,115,137,1,240,
+51,85,13,47,39,46,44,75,76,51,92,31,0,0,2,255,197,255,231,6,166,4,250,0,49,
+0,63,0,0,5,2,17,52,55,6,3,39,17,7,34,38,38,39,38,38,39,22,21,20,6,35,34,38,
+53,52,54,55,38,39,35,39,33,23,33,22,21,20,7,7,54,54,55,23,6,6,21,20,22,23,
+1,22,23,22,22,23,22,22,51,50,54,53,52,39,5,174,140,49,217,244,100,26,57,88,
+62,40,41,58,37,13,85,78,83,90,95,93,50,96,102,69,6,156,69,252,244,76,85,4,
+122,233,122,176,66,59,46,52,251,18,49,30,49,80,51,62,86,55,63,73,55,25,1,
+13,1,0,151,141,173,254,204,66,1,46,1,35,50,41,41,45,10,36,44,76,91,103,82,
+87,115,2,77,48,107,107,106,131,140,66,147,139,224,77,160,108,204,113,115,
+198,111,4,135,51,84,13,46,37,45,42,75,76,96,71,0,2,255,197,255,232,4,166,
+4,250,0,52,0,67,0,0,5,35,39,53,38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,
+22,23,38,53,53,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,35,
+39,33,23,35,22,21,20,6,7,1,22,23,22,22,23,22,22,51,50,54,53,52,38,39,3,133,
+6,104,58,179,87,4,77,70,83,87,116,92,121,237,75,5,64,106,73,40,58,37,13,85,
+78,83,90,95,93,50,96,121,69,4,156,69,254,81,62,54,253,159,50,29,49,80,52,
+61,87,54,63,73,34,27,24,104,47,78,132,20,16,20,68,81,95,75,85,103,171,140,
+90,127,235,1,52,77,42,46,11,37,43,76,91,103,82,87,115,2,77,48,107,107,110,
+134,81,117,29,1,215,51,85,13,47,39,46,44,75,76,51,92,31,0,0,3,255,198,255,
+232,8,48,5,159,0,58,0,73,0,85,0,0,5,35,39,17,38,39,1,39,55,54,53,52,38,35,
+34,7,6,6,35,34,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,35,
+39,33,22,23,54,54,51,50,22,23,38,53,17,51,23,21,51,23,35,33,22,23,22,22,23,
+22,22,51,50,54,53,52,38,39,5,38,38,35,34,6,7,54,51,50,22,23,7,71,8,103,38,
+40,254,0,127,50,78,55,44,64,54,27,104,68,58,84,55,34,38,49,34,12,85,78,83,
+90,95,93,50,96,102,69,3,79,92,43,85,172,110,113,204,153,9,8,101,166,69,233,
+249,203,49,31,46,68,49,54,80,55,63,73,34,27,3,26,61,122,71,103,148,94,29,
+42,93,124,3,24,75,2,181,64,57,254,46,127,44,80,74,54,53,32,61,67,36,52,42,
+44,44,10,38,41,76,91,103,82,87,115,2,77,48,107,84,81,94,85,176,255,133,118,
+1,75,71,94,107,50,86,13,45,40,46,45,75,76,51,92,31,173,68,64,87,116,9,118,
+94,0,0,3,255,197,255,196,8,47,5,159,0,86,0,101,0,112,0,0,5,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,22,23,38,53,
+17,39,1,39,55,54,53,52,38,35,34,7,6,6,35,34,38,38,39,38,38,39,22,21,20,6,
+35,34,38,53,52,54,55,38,39,35,39,33,22,23,54,54,51,50,22,23,38,53,17,51,23,
+21,51,23,35,33,22,23,22,22,23,22,22,51,50,54,53,52,38,39,5,38,35,34,6,7,54,
+51,50,22,23,7,70,8,103,47,72,58,55,126,130,58,147,166,14,90,7,115,109,40,
+93,12,98,67,61,77,55,43,8,64,254,16,127,50,68,47,42,71,62,19,114,81,59,90,
+60,39,33,43,27,11,85,78,83,90,95,93,50,96,102,69,3,79,90,44,89,188,111,126,
+204,118,7,8,101,166,69,233,249,203,49,31,46,68,49,54,80,55,63,73,34,27,3,
+29,109,128,84,136,98,24,30,83,115,10,60,74,83,45,18,18,181,159,67,75,15,51,
+40,92,109,12,1,15,43,78,79,95,117,1,254,87,254,90,127,44,70,74,37,40,41,83,
+93,38,54,44,38,40,11,33,43,76,91,103,82,87,115,2,77,48,107,83,80,89,95,156,
+189,119,96,1,18,71,94,107,50,86,13,45,40,46,45,75,76,51,92,31,129,95,60,89,
+5,99,88,0,0,2,255,196,255,151,7,198,4,250,0,70,0,84,0,0,5,35,39,46,2,39,39,
+54,55,38,39,6,35,34,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,
+39,35,39,33,23,33,22,21,20,7,22,23,23,6,7,22,4,23,17,51,22,4,21,20,6,35,34,
+38,53,52,54,51,50,22,23,53,52,37,1,22,23,22,22,23,22,22,51,50,54,53,52,39,
+5,80,6,101,98,187,174,160,79,193,186,72,52,19,26,57,87,59,39,37,58,36,13,
+85,78,83,90,95,93,50,96,102,69,7,189,69,251,210,67,59,42,88,40,184,157,130,
+1,12,95,111,222,1,14,89,94,71,85,69,63,47,63,12,254,104,251,192,50,29,48,
+76,51,58,85,55,63,73,46,105,74,86,85,32,16,212,123,96,57,18,4,33,47,39,38,
+44,9,36,44,76,91,103,82,87,115,2,77,48,107,107,100,125,111,70,41,123,96,93,
+96,19,123,113,3,173,27,239,169,111,132,83,66,62,81,44,35,20,240,21,1,97,52,
+83,11,43,35,41,41,75,76,87,68,0,0,3,255,197,254,216,4,137,4,250,0,65,0,79,
+0,85,0,0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,22,22,23,38,53,53,38,38,39,39,54,37,38,39,38,38,39,22,21,20,6,35,
+34,38,53,52,54,55,38,39,35,39,33,23,35,22,21,20,6,7,1,22,23,22,22,23,22,22,
+51,50,54,53,52,39,3,6,7,22,22,23,3,129,8,103,47,78,62,35,64,81,49,135,149,
+21,88,12,92,97,32,58,58,28,61,83,62,40,8,89,251,115,67,122,1,3,38,61,40,58,
+37,13,85,78,83,90,95,93,33,62,171,69,4,127,69,205,60,63,56,253,187,35,19,
+49,80,52,61,87,54,63,73,39,64,235,64,82,173,44,254,216,74,80,48,11,13,174,
+164,90,86,20,60,60,93,106,8,8,43,82,75,95,117,50,108,126,4,199,69,102,24,
+64,42,46,11,37,43,76,91,103,82,87,115,2,53,42,107,107,98,116,82,118,28,1,
+186,50,56,13,47,39,46,44,75,76,77,67,253,220,93,30,37,148,68,0,0,2,255,207,
+255,201,4,188,4,250,0,65,0,80,0,0,1,33,22,21,20,6,7,22,22,21,20,6,35,34,0,
+3,55,30,2,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,22,21,20,7,54,55,6,
+35,34,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,5,
+22,23,22,22,23,22,22,51,50,54,53,52,38,39,4,188,254,247,88,72,63,75,88,200,
+183,194,254,232,108,78,73,160,171,105,123,151,28,142,166,103,125,83,69,60,
+77,10,65,118,19,25,57,89,62,39,40,58,37,12,85,78,83,90,95,93,50,96,129,69,
+4,168,252,191,49,31,48,78,53,77,83,43,63,73,40,30,4,143,114,140,88,122,26,
+67,173,96,188,208,1,22,1,65,34,176,193,72,126,105,62,40,171,114,95,64,86,
+77,64,32,21,41,160,4,38,54,43,44,48,11,38,41,76,91,103,82,87,115,2,77,48,
+107,107,50,86,13,49,42,60,35,75,76,55,99,30,0,0,2,255,197,255,66,4,187,4,
+250,0,81,0,95,0,0,5,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,55,55,50,22,22,23,38,53,53,52,39,6,6,35,34,38,53,52,54,51,50,22,21,
+20,7,54,55,34,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,35,
+39,33,23,33,22,21,20,6,7,22,21,1,22,23,22,22,23,22,22,51,50,54,53,52,39,4,
+20,8,102,27,36,58,46,49,130,123,68,140,143,21,88,12,88,106,43,134,134,55,
+75,57,39,9,64,101,121,81,95,120,81,68,59,76,4,36,124,57,87,61,40,40,58,36,
+12,85,78,83,90,95,93,40,71,155,69,4,177,69,254,243,74,80,69,177,253,32,36,
+27,48,78,53,77,83,43,63,73,53,190,74,49,48,31,13,13,173,167,90,86,20,60,60,
+96,105,10,8,42,81,77,107,105,118,115,79,116,69,108,87,63,85,76,63,22,15,35,
+161,38,53,44,44,48,11,38,41,76,91,103,82,87,115,2,61,44,107,107,105,129,93,
+125,23,189,233,3,129,46,70,13,49,42,60,35,75,76,96,68,0,3,255,197,255,232,
+5,202,4,250,0,42,0,57,0,70,0,0,5,35,39,38,38,39,23,20,6,35,34,38,53,52,54,
+51,51,38,39,38,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,35,39,
+33,23,35,33,22,23,22,22,23,22,22,51,50,54,53,52,38,39,33,33,22,21,20,6,7,
+22,23,22,23,38,53,4,226,6,104,59,99,58,1,72,76,76,93,110,92,11,43,92,63,82,
+49,34,38,24,10,85,78,83,90,105,84,51,96,102,69,5,192,69,232,252,47,50,28,
+47,69,45,63,76,44,60,66,34,27,1,124,254,239,81,69,61,67,23,139,97,4,24,104,
+123,105,18,23,71,86,96,75,82,105,106,65,11,63,56,38,35,12,33,37,76,91,103,
+82,85,112,6,78,48,107,107,53,80,12,47,41,57,35,79,72,51,92,31,110,134,85,
+125,26,80,122,57,204,71,141,0,0,2,255,197,255,183,4,160,4,250,0,71,0,86,0,
+0,5,35,39,53,38,35,34,21,39,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,
+35,34,38,38,53,52,54,51,50,23,54,54,51,50,22,23,17,35,34,38,39,38,38,39,22,
+21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,23,35,22,21,20,6,7,1,22,23,22,
+22,23,22,22,51,50,54,53,52,38,39,3,162,6,104,65,67,80,42,25,85,73,63,78,39,
+2,66,55,60,71,77,67,59,110,69,101,99,117,64,13,54,45,55,82,37,12,64,109,74,
+42,57,37,13,85,78,83,90,95,93,50,96,134,69,4,150,69,235,81,53,47,253,143,
+50,29,49,80,52,61,87,54,63,73,34,27,73,104,240,106,141,16,59,69,63,56,59,
+27,50,61,73,62,62,70,66,131,93,106,140,141,70,67,94,86,1,44,52,78,43,46,10,
+37,43,76,91,103,82,87,115,2,77,48,107,107,110,134,74,112,31,1,205,51,85,13,
+47,39,46,44,75,76,51,92,31,0,0,3,255,197,255,232,7,250,4,250,0,55,0,70,0,
+83,0,0,5,35,39,17,38,38,35,34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,55,
+38,38,35,22,21,20,6,35,34,38,39,38,38,39,22,21,20,6,35,34,38,53,52,54,55,
+38,39,35,39,33,23,35,33,22,23,22,22,23,22,22,51,50,54,53,52,38,39,33,33,22,
+22,23,54,54,51,50,22,23,38,53,7,17,6,104,50,53,34,31,43,57,42,67,119,86,81,
+140,65,74,40,71,55,62,89,48,10,133,139,10,122,100,64,109,74,42,57,37,13,85,
+78,83,90,95,93,50,96,102,69,7,239,70,233,250,0,50,29,49,80,52,61,87,54,63,
+73,34,27,3,121,253,133,117,139,10,37,83,44,58,104,52,9,24,104,2,43,69,47,
+26,93,99,158,119,132,153,34,75,67,116,125,181,162,50,44,115,137,52,78,43,
+46,10,37,43,76,91,103,82,87,115,2,77,48,107,107,51,85,13,47,39,46,44,75,76,
+51,92,31,26,181,159,80,47,98,96,80,109,0,2,255,197,255,116,5,193,4,250,0,
+68,0,74,0,0,5,35,39,38,38,39,39,54,54,55,53,38,35,34,21,39,38,35,34,6,21,
+20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,23,54,51,50,23,17,
+33,39,33,23,33,17,22,22,21,20,35,34,38,53,52,54,51,50,22,23,52,38,39,7,6,
+7,22,22,23,3,163,4,103,85,215,129,84,158,204,148,71,74,90,41,62,152,84,86,
+35,5,75,58,67,82,88,75,65,120,75,132,105,133,72,27,100,107,85,252,213,69,
+5,183,69,253,226,188,234,165,63,75,60,54,42,55,9,188,151,110,181,127,84,179,
+45,140,74,104,85,4,232,89,99,49,178,100,142,15,130,70,60,62,35,49,63,84,64,
+64,77,80,147,95,114,144,142,138,179,1,41,107,107,253,197,20,216,155,214,72,
+56,54,70,41,32,107,136,6,8,71,73,22,129,70,0,1,255,197,254,174,5,14,4,250,
+0,79,0,0,1,35,39,17,38,35,34,6,7,54,51,50,22,21,20,6,7,39,62,2,53,52,38,35,
+34,6,7,39,54,54,51,50,22,23,17,38,35,34,6,21,39,38,38,35,34,6,21,20,23,53,
+52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,51,50,22,23,17,33,
+39,33,23,35,4,37,6,104,157,201,57,115,41,60,84,116,132,140,131,122,102,110,
+66,46,40,69,154,61,139,97,207,118,112,181,88,81,89,50,65,42,33,116,92,89,
+104,83,75,58,71,88,95,85,133,159,147,118,83,110,44,31,117,57,92,59,252,83,
+69,5,3,70,233,254,174,104,1,18,222,54,48,23,106,89,99,153,74,185,30,41,56,
+38,32,35,52,44,137,154,145,127,135,2,78,139,88,92,15,88,78,87,83,94,35,14,
+62,74,80,75,69,82,171,145,145,178,88,78,161,93,109,1,47,107,107,0,1,255,196,
+0,73,7,57,7,86,0,96,0,0,1,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,
+54,51,50,22,21,20,2,6,35,34,38,38,53,17,38,35,34,6,21,39,38,35,34,6,21,20,
+23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,23,
+17,33,39,33,38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,51,50,
+22,23,51,7,57,252,217,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,
+246,137,78,112,59,66,69,47,63,41,57,185,86,106,63,76,63,67,82,87,74,123,165,
+143,113,80,125,35,14,73,53,99,83,252,102,69,6,66,15,72,76,37,76,102,68,149,
+143,7,85,2,84,132,53,80,72,34,127,134,21,149,4,143,253,4,102,77,32,127,192,
+94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,1,73,86,81,71,15,140,
+82,74,90,35,5,54,73,87,65,65,83,188,142,128,167,78,64,69,69,159,1,108,107,
+105,96,9,12,168,154,52,50,9,51,103,85,10,8,169,205,0,0,1,255,196,255,84,7,
+15,7,86,0,128,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,
+51,50,54,55,54,51,50,22,22,23,38,53,53,6,35,34,38,38,53,53,38,35,34,6,21,
+39,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,23,54,54,51,50,22,23,17,33,39,33,38,38,35,34,7,6,35,34,38,53,52,55,23,
+7,20,22,51,50,55,55,50,22,23,51,23,33,17,20,22,22,51,50,54,55,6,35,34,38,
+53,52,54,51,50,22,21,20,7,6,43,8,103,47,78,62,28,106,122,51,136,150,21,88,
+12,94,97,24,90,16,86,38,61,83,62,40,8,121,166,75,117,57,72,77,47,63,41,57,
+185,86,106,63,76,63,67,82,87,74,123,165,143,113,80,125,35,14,73,53,61,94,
+41,252,101,69,6,13,15,72,76,35,100,77,31,149,143,7,85,2,84,132,39,70,90,128,
+133,21,160,69,253,4,26,59,48,106,177,32,43,65,77,86,97,98,110,126,72,172,
+74,80,48,12,14,176,164,90,86,20,60,60,93,108,8,1,9,43,82,75,95,117,207,83,
+58,119,122,72,106,81,71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,142,128,
+167,78,64,69,69,99,88,1,113,107,104,91,8,7,168,154,52,50,9,51,103,85,6,6,
+165,203,107,254,8,102,74,35,150,113,34,89,73,79,97,138,119,130,105,0,1,255,
+196,0,43,6,198,4,250,0,71,0,0,1,33,17,20,51,50,54,55,22,21,20,6,35,34,36,
+39,55,22,22,51,50,54,53,52,39,6,6,35,34,39,38,35,34,6,21,39,38,35,34,6,21,
+20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,
+22,23,17,33,39,33,6,198,253,46,36,55,148,137,202,224,187,183,254,243,112,
+73,90,226,154,153,178,56,103,160,91,174,7,66,70,47,63,41,57,185,86,106,63,
+76,63,67,82,87,74,123,165,143,113,80,125,35,14,73,53,56,88,39,252,135,69,
+6,189,4,143,254,67,51,117,149,209,248,200,237,219,243,44,167,147,155,134,
+111,72,107,92,231,88,81,71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,142,
+128,167,78,64,69,69,85,76,1,70,107,0,0,1,255,196,254,200,6,198,4,250,0,109,
+0,0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,
+51,50,22,22,23,38,53,53,6,35,34,36,39,55,22,22,51,50,54,53,52,39,6,6,35,34,
+39,38,39,38,38,35,34,6,21,39,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,
+6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,23,17,33,39,33,23,33,17,20,51,
+50,54,55,22,22,21,20,6,7,5,159,8,103,47,78,62,28,106,122,51,136,150,21,88,
+12,94,97,24,90,16,86,38,61,83,62,40,8,67,82,173,254,248,107,72,87,223,141,
+153,178,53,105,161,91,91,46,14,6,44,77,46,47,63,41,57,185,86,106,63,76,63,
+67,82,87,74,123,165,143,113,80,125,35,14,73,53,105,85,252,135,69,6,189,69,
+253,46,36,55,148,137,99,103,77,74,254,200,74,80,48,12,14,176,164,90,86,20,
+60,60,93,108,8,1,9,43,82,75,95,117,117,23,208,228,45,155,134,155,134,103,
+63,109,93,66,19,16,80,68,81,71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,
+142,128,167,78,64,69,69,175,1,54,107,107,254,167,51,117,149,102,208,127,111,
+186,58,0,1,255,197,255,85,5,163,4,250,0,75,0,0,1,22,22,21,20,6,35,34,0,39,
+55,22,22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,55,53,38,35,34,
+6,21,39,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,54,54,51,50,22,23,17,33,39,33,23,33,4,26,112,137,189,163,190,254,
+226,88,83,77,242,155,122,133,77,77,10,80,75,87,89,112,107,73,79,47,63,41,
+57,185,86,106,63,76,63,67,82,87,74,123,165,143,113,80,125,35,14,73,53,62,
+94,43,252,95,69,5,153,69,254,119,2,30,32,190,121,171,199,1,3,239,35,156,182,
+112,105,67,84,7,33,35,74,86,102,77,90,115,1,197,110,81,71,15,140,82,74,90,
+35,5,54,73,87,65,65,83,188,142,128,167,78,64,69,69,103,91,1,67,107,107,0,
+1,255,196,255,231,7,46,4,250,0,65,0,0,5,2,17,52,55,6,6,7,39,17,38,35,34,6,
+21,39,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,54,54,51,50,22,23,17,33,39,33,23,33,17,20,7,54,37,23,6,6,21,20,22,
+23,6,63,140,49,112,206,143,100,73,77,47,63,41,57,185,86,106,63,76,63,67,82,
+87,74,123,165,143,113,80,125,35,14,73,53,61,95,41,252,86,69,7,36,70,252,244,
+4,207,1,10,180,66,59,46,52,25,1,13,1,0,153,140,85,202,155,66,1,37,107,81,
+71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,142,128,167,78,64,69,69,101,
+88,1,108,107,107,254,132,97,73,232,171,163,108,204,113,115,198,111,0,2,255,
+197,255,141,6,82,4,250,0,69,0,75,0,0,5,38,53,52,55,7,17,35,39,38,38,39,39,
+54,37,53,38,35,34,6,21,39,38,38,35,34,6,21,20,22,23,39,52,54,51,50,22,21,
+20,6,35,34,38,38,53,52,54,51,50,22,23,54,51,50,22,23,17,33,39,33,23,33,17,
+55,23,6,21,20,22,23,1,6,7,22,22,23,5,90,111,18,177,4,103,69,190,170,67,213,
+1,23,77,89,54,76,45,34,128,96,103,117,48,43,1,80,61,75,93,101,90,79,141,87,
+165,125,88,123,46,33,131,56,95,56,252,45,69,6,72,69,253,250,241,137,106,31,
+32,254,66,138,127,79,147,39,34,186,212,64,75,70,253,220,74,84,84,5,199,119,
+116,198,111,95,96,16,92,84,109,95,60,82,15,18,66,78,85,79,73,87,87,166,114,
+154,197,94,82,171,91,100,1,36,107,107,253,213,92,133,120,175,84,119,73,1,
+130,61,64,27,103,59,0,2,255,197,254,184,5,52,4,250,0,67,0,77,0,0,1,35,39,
+17,39,1,39,55,54,54,53,52,38,35,34,7,39,54,54,51,50,22,23,17,38,35,34,6,21,
+39,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,54,51,50,22,23,17,33,39,33,23,35,3,38,35,34,6,7,55,50,22,23,4,76,
+6,105,17,254,84,122,42,31,28,38,37,52,50,120,88,199,124,104,169,79,77,89,
+54,76,45,34,128,96,99,121,93,1,80,61,75,93,101,90,138,171,165,125,88,123,
+46,33,131,56,95,56,252,45,69,5,42,69,232,238,89,107,81,113,56,23,73,96,8,
+254,184,104,1,4,22,254,148,122,37,33,59,36,27,34,27,136,123,127,121,127,2,
+99,111,95,96,16,92,84,109,85,113,29,20,66,78,85,79,73,87,187,153,154,197,
+94,82,171,91,100,1,36,107,107,252,29,68,47,55,1,87,77,0,1,255,196,255,187,
+8,224,4,250,0,90,0,0,5,35,39,46,2,39,39,54,55,38,39,38,38,35,34,6,21,39,38,
+38,35,34,6,21,20,22,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,
+50,22,23,54,51,50,22,23,17,33,39,33,23,33,17,30,2,23,23,6,7,22,4,23,17,51,
+22,0,21,20,6,35,34,38,53,52,54,51,50,22,23,53,52,38,39,6,105,6,102,72,190,
+199,157,79,179,201,103,140,38,70,43,54,76,45,34,128,96,103,117,48,43,1,80,
+61,75,93,101,90,79,141,87,165,125,88,123,46,33,131,53,89,50,252,60,69,8,216,
+68,251,92,43,66,62,84,40,184,157,136,1,7,94,111,211,1,25,89,94,71,85,69,63,
+47,63,12,214,194,69,94,75,83,36,16,212,116,103,64,20,51,54,95,96,16,92,84,
+109,95,60,82,15,18,66,78,85,79,73,87,87,166,114,154,197,94,82,171,77,85,1,
+27,107,107,254,240,21,47,65,118,96,93,96,20,113,112,3,114,24,254,248,177,
+111,132,83,66,62,81,44,35,20,129,151,11,0,0,2,255,196,255,232,6,32,4,250,
+0,59,0,66,0,0,5,35,39,38,38,39,23,20,6,35,34,38,53,52,54,55,53,38,35,34,6,
+21,39,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,54,54,51,50,23,17,33,39,33,23,35,1,22,23,38,53,17,35,5,55,6,104,
+35,96,77,2,75,69,83,90,108,88,70,73,47,63,41,57,185,86,106,63,76,63,67,82,
+87,74,123,165,143,113,80,125,35,14,73,53,105,85,252,135,69,6,22,70,233,254,
+186,134,86,5,215,24,104,83,110,18,34,68,81,100,75,80,101,2,214,97,81,71,15,
+140,82,74,90,35,5,54,73,87,65,65,83,188,142,128,167,78,64,69,69,175,1,134,
+107,107,253,49,50,175,89,124,2,219,0,0,1,255,196,254,176,5,0,4,250,0,87,0,
+0,1,35,39,17,38,38,35,34,6,21,39,38,35,34,6,21,20,23,53,52,54,51,50,22,21,
+20,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,23,17,38,35,34,6,21,39,
+38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,
+23,54,54,51,50,22,23,17,33,39,33,23,35,4,23,6,105,35,65,42,47,63,41,57,165,
+83,95,59,76,63,67,82,87,74,123,161,139,111,76,98,38,14,73,53,61,86,42,73,
+79,47,63,41,57,185,86,106,63,76,63,67,82,87,74,123,165,143,113,80,125,35,
+14,73,53,62,94,43,252,97,69,4,246,70,233,254,176,104,1,35,52,58,81,71,15,
+140,78,69,89,31,5,54,73,87,65,65,83,183,142,124,162,73,69,69,69,100,93,2,
+74,110,81,71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,142,128,167,78,64,
+69,69,103,91,1,83,107,107,0,2,255,197,0,73,7,19,5,8,0,55,0,66,0,0,1,6,2,6,
+35,34,38,38,53,17,38,38,35,34,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,55,38,38,35,35,39,51,50,22,23,54,54,51,50,22,23,17,33,23,33,21,18,33,
+55,1,20,22,22,51,50,18,55,38,38,39,6,146,13,141,226,134,76,109,58,97,94,53,
+84,82,118,120,81,71,69,100,20,18,99,73,67,84,125,139,57,102,71,95,69,159,
+79,112,90,72,118,65,72,126,91,3,49,69,252,249,158,1,58,68,253,228,26,56,46,
+116,184,34,145,228,89,2,225,181,254,208,179,56,122,121,2,3,156,88,98,62,157,
+84,79,78,86,86,81,91,85,72,86,178,63,59,51,107,59,102,94,81,115,162,1,7,107,
+48,254,250,4,254,54,100,78,33,1,15,217,18,154,155,0,0,2,255,197,255,104,7,
+231,5,8,0,75,0,84,0,0,5,38,36,37,39,22,51,50,54,53,52,38,39,6,6,35,34,38,
+38,53,53,38,38,35,34,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,
+38,38,35,35,39,51,50,22,23,54,54,51,50,22,23,17,33,23,33,21,22,22,51,51,22,
+22,21,20,6,7,22,23,1,20,22,51,50,54,55,38,39,7,34,206,254,168,254,255,41,
+156,174,237,208,130,113,67,197,131,61,84,45,97,94,53,84,82,118,120,81,71,
+69,100,20,18,99,73,67,84,125,139,57,102,71,95,69,159,79,112,90,72,118,65,
+72,129,88,4,5,69,252,37,49,164,80,110,193,227,192,182,219,184,252,172,36,
+43,78,113,32,190,112,152,194,164,29,193,47,158,129,108,109,6,203,171,47,92,
+106,125,156,88,98,62,157,84,79,78,86,86,81,91,85,72,86,178,63,59,51,107,59,
+102,94,81,115,162,1,7,107,14,60,59,4,218,176,170,206,28,112,204,3,59,66,45,
+137,120,36,145,0,1,255,197,255,140,5,9,5,159,0,78,0,0,1,22,22,21,20,6,35,
+34,0,3,55,22,22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,23,
+17,38,38,35,34,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,38,38,
+35,35,39,51,50,22,23,54,51,50,22,23,39,17,51,23,21,51,23,33,3,216,82,93,190,
+164,227,254,218,90,81,95,251,177,123,134,77,77,10,80,75,87,89,115,109,37,
+33,69,104,61,74,76,105,107,75,65,64,93,17,17,92,67,62,77,115,127,58,102,71,
+74,69,138,79,112,90,118,117,79,136,66,2,8,100,237,70,254,207,2,48,46,167,
+99,170,194,1,54,1,45,29,239,206,107,104,67,84,7,33,35,74,86,102,77,90,116,
+6,1,72,110,94,100,56,143,76,73,71,79,79,75,83,78,66,79,163,59,59,51,107,59,
+102,175,126,120,139,1,2,71,94,107,0,0,1,255,197,255,232,4,203,5,159,0,68,
+0,0,5,35,39,53,38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,4,23,38,53,17,
+38,38,35,34,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,38,38,35,
+35,39,51,50,22,23,54,51,50,22,23,39,17,51,23,21,51,23,35,3,226,6,104,56,216,
+102,4,77,70,83,87,118,94,131,1,16,77,5,69,104,61,70,80,105,107,75,65,64,93,
+17,17,92,67,62,77,115,127,58,102,71,84,69,148,79,112,90,118,117,79,136,66,
+2,8,100,165,70,233,24,104,47,74,135,22,17,20,68,81,95,75,84,104,180,135,73,
+148,1,235,110,94,100,56,143,76,73,71,79,79,75,83,78,66,79,163,59,59,51,107,
+59,102,175,126,120,139,1,2,71,94,107,0,2,255,197,255,232,6,57,5,159,0,63,
+0,70,0,0,5,35,39,38,38,39,23,20,6,35,34,38,53,52,54,55,17,38,38,35,34,7,22,
+22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,38,38,35,35,39,51,50,22,23,
+54,54,51,50,22,22,23,39,17,51,23,21,33,23,35,1,22,23,38,53,17,35,5,80,6,104,
+35,96,77,2,75,69,83,90,108,90,92,99,53,84,82,118,120,81,71,69,100,20,18,99,
+73,67,84,125,139,57,102,71,95,69,159,79,112,90,72,118,65,59,95,81,57,3,8,
+100,1,234,70,233,254,187,135,84,5,214,24,104,83,110,18,34,68,81,100,75,81,
+100,2,1,165,151,93,98,62,157,84,79,78,86,86,81,91,85,72,86,178,63,59,51,107,
+59,102,94,81,68,115,100,148,1,30,71,94,107,253,48,50,174,89,124,2,219,0,0,
+1,255,197,255,133,4,192,5,159,0,88,0,0,5,35,39,17,38,35,34,6,21,39,38,38,
+35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,
+54,54,51,50,22,23,17,38,38,35,34,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,55,38,38,35,35,39,51,50,22,23,54,51,50,22,23,39,53,51,23,21,51,23,
+35,3,215,6,104,68,68,46,62,40,26,116,85,76,102,62,75,61,65,81,85,73,122,160,
+132,107,76,116,35,14,72,51,56,87,39,57,102,55,70,80,105,107,75,65,64,93,17,
+17,92,67,62,77,115,127,58,102,71,93,69,157,79,112,90,118,117,75,120,66,2,
+8,100,165,70,233,123,104,1,17,95,79,70,15,64,73,64,69,82,24,9,53,71,86,63,
+63,82,173,131,120,149,76,63,67,68,88,79,2,71,87,107,100,56,143,76,73,71,79,
+79,75,83,78,66,79,163,59,59,51,107,59,102,175,120,114,140,245,71,94,107,0,
+0,4,255,197,0,0,4,119,4,250,0,40,0,48,0,56,0,62,0,0,33,35,39,38,38,39,39,
+54,55,38,38,53,52,55,35,39,33,23,33,22,22,21,20,7,22,22,21,20,35,34,38,53,
+52,54,51,50,22,23,52,38,39,55,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,7,
+6,7,22,22,23,2,141,4,103,87,228,121,82,186,130,112,139,32,115,69,4,108,70,
+254,67,77,91,63,119,153,165,63,75,60,54,42,55,9,194,145,35,26,138,95,77,56,
+52,30,143,106,77,47,97,204,150,96,202,56,74,107,105,4,233,116,59,54,185,108,
+72,50,107,107,52,139,78,106,65,47,208,117,214,72,56,54,70,41,32,117,166,10,
+221,46,71,84,129,35,52,47,63,94,127,33,174,84,100,13,133,87,0,3,255,197,254,
+216,7,172,4,250,0,93,0,101,0,109,0,0,1,35,39,38,38,35,34,7,6,35,32,17,52,
+55,23,6,21,20,22,51,50,55,54,51,50,22,23,38,53,17,52,38,38,35,34,6,7,54,51,
+50,22,21,20,6,35,34,38,53,52,55,46,2,53,52,55,35,39,33,23,33,22,22,23,54,
+51,50,22,23,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,21,54,53,52,
+38,35,34,7,1,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,4,182,8,103,52,83,
+72,54,120,122,44,254,149,26,89,20,142,128,37,106,97,47,79,115,72,8,26,53,
+45,96,160,41,36,47,75,82,101,95,95,115,35,118,219,135,32,93,69,7,161,70,250,
+248,74,90,4,57,65,112,118,8,122,162,154,194,158,130,92,115,86,65,59,83,106,
+109,94,194,137,253,228,26,138,95,77,56,52,30,140,102,80,50,254,216,74,78,
+50,15,14,1,126,113,107,21,85,80,126,102,10,11,86,127,95,117,2,5,98,81,31,
+157,120,24,88,66,77,94,115,113,97,87,1,109,183,106,72,50,107,107,51,133,75,
+15,118,129,144,191,152,144,172,97,81,66,84,68,63,16,35,138,75,91,214,1,111,
+46,71,84,129,35,52,47,63,94,127,34,0,0,3,255,197,255,241,3,233,7,86,0,74,
+0,82,0,90,0,0,1,33,22,22,21,20,14,2,7,14,2,21,20,22,51,50,54,55,38,38,53,
+52,54,51,50,22,21,20,6,6,35,34,38,38,53,52,54,54,55,38,38,53,52,55,35,39,
+33,38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,22,22,51,50,55,54,51,50,22,23,
+51,1,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,3,233,254,194,77,91,35,86,
+120,82,101,120,82,77,72,80,148,49,50,68,79,62,72,91,119,179,89,120,162,77,
+96,137,95,148,193,32,100,69,3,12,15,72,76,37,72,96,68,148,144,7,85,2,26,93,
+97,52,76,68,33,127,134,21,121,254,254,26,138,95,77,56,52,30,140,102,80,50,
+4,143,52,139,78,55,100,90,75,42,53,78,110,72,51,71,54,50,2,62,53,58,71,97,
+75,96,133,65,95,142,70,97,142,90,44,41,213,126,72,50,107,105,96,9,12,169,
+153,52,50,9,51,66,77,45,10,8,169,205,254,72,46,71,84,129,35,52,47,63,94,127,
+34,0,3,255,197,254,117,4,137,7,86,0,102,0,110,0,118,0,0,1,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,
+6,35,34,38,53,52,54,55,38,38,53,52,55,35,39,33,38,38,35,34,7,6,35,34,38,53,
+52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,23,33,22,22,21,20,7,6,7,14,2,
+21,20,22,51,50,54,55,38,38,53,52,54,51,50,22,21,20,7,3,54,53,52,38,35,34,
+7,7,6,21,20,22,51,50,55,3,144,8,103,47,78,62,38,74,94,51,136,150,21,88,12,
+94,97,23,81,65,35,61,83,62,40,8,85,107,173,192,146,123,126,156,32,253,69,
+3,165,15,72,76,37,72,96,68,149,143,7,85,2,84,132,52,76,68,33,127,134,21,128,
+70,254,187,77,91,107,57,135,105,128,89,103,75,69,121,38,45,58,79,62,72,91,
+78,86,26,138,95,77,56,52,30,140,102,80,50,254,117,74,80,48,12,14,176,164,
+90,86,20,60,60,93,108,9,9,43,82,75,95,117,124,35,163,149,110,140,48,50,198,
+112,72,50,107,105,96,9,12,168,154,52,50,9,51,103,85,10,8,169,205,107,52,139,
+78,140,66,36,53,42,64,95,64,72,75,59,51,6,62,48,58,71,97,75,116,78,2,142,
+46,71,84,129,35,52,47,63,94,127,34,0,0,4,255,197,0,0,5,18,7,86,0,37,0,45,
+0,61,0,70,0,0,1,33,34,39,22,18,21,20,6,35,32,3,54,55,46,2,53,52,55,35,39,
+33,46,2,53,52,54,55,23,6,6,21,20,22,23,33,1,54,53,52,39,35,34,7,1,6,7,22,
+22,51,50,54,53,52,2,39,22,22,21,20,39,1,6,21,20,22,51,50,55,5,18,254,99,61,
+48,210,168,238,208,254,110,118,212,115,114,203,124,30,94,69,2,98,60,64,38,
+70,89,124,75,68,59,72,2,58,253,172,8,47,133,77,56,1,87,88,193,29,144,116,
+153,164,132,182,39,39,152,254,180,30,140,102,68,51,4,143,4,233,254,169,165,
+202,228,1,249,43,102,8,112,177,101,70,49,107,81,98,104,59,73,129,60,135,48,
+91,56,62,123,89,254,90,43,39,120,113,35,253,174,110,76,113,132,190,170,163,
+1,41,221,95,143,88,174,128,1,48,46,64,94,127,25,0,0,4,255,197,255,232,5,218,
+4,250,0,31,0,36,0,62,0,70,0,0,5,35,39,38,36,39,39,54,55,38,38,35,39,35,39,
+33,21,54,51,50,22,21,20,7,22,21,20,6,35,34,38,39,3,33,22,0,23,5,52,39,6,35,
+34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,21,20,22,51,50,54,37,38,39,6,
+7,22,4,23,3,170,6,101,117,254,207,217,79,164,196,97,161,101,66,38,69,3,229,
+89,194,122,150,61,66,147,118,97,154,44,110,253,156,141,1,82,133,2,65,32,68,
+84,60,76,73,55,75,63,44,90,78,130,159,162,126,82,97,253,191,129,81,195,115,
+144,1,19,101,24,74,161,189,30,212,120,107,69,65,164,107,199,170,161,127,105,
+77,87,111,118,151,112,95,2,140,64,254,234,158,54,58,41,59,62,63,59,66,46,
+47,73,61,77,188,151,142,175,85,17,120,62,105,85,33,198,146,0,4,255,197,255,
+232,7,223,5,159,0,45,0,53,0,65,0,73,0,0,5,35,39,17,38,39,1,39,55,54,53,52,
+38,35,34,7,6,6,35,34,38,38,53,52,55,35,39,33,50,22,23,54,54,51,50,22,23,38,
+53,17,51,23,21,51,23,35,1,54,53,52,38,35,34,7,5,38,38,35,34,6,7,54,51,50,
+22,23,1,6,21,20,22,51,50,55,6,246,8,103,38,40,254,0,127,50,78,55,44,69,59,
+31,149,98,119,221,136,31,122,69,1,198,117,231,68,96,184,119,113,204,153,9,
+8,101,166,69,233,251,194,26,139,94,78,55,4,114,61,122,71,103,148,94,29,42,
+93,124,3,252,142,30,140,102,80,50,24,75,2,181,64,57,254,46,127,44,80,74,54,
+53,38,74,73,109,184,106,72,50,107,113,89,114,102,176,255,133,118,1,75,71,
+94,107,254,179,46,71,84,130,36,135,68,64,87,116,9,118,94,1,101,47,63,94,127,
+34,0,3,255,197,255,141,7,132,4,250,0,58,0,66,0,74,0,0,5,35,39,46,2,39,39,
+54,55,38,39,6,35,34,38,38,53,52,55,35,39,33,23,33,22,22,21,20,7,22,22,23,
+23,6,7,22,4,23,17,51,22,4,21,20,6,35,34,38,53,52,54,51,50,22,23,53,52,37,
+37,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,5,1,6,101,98,187,174,160,79,
+193,186,74,55,71,108,119,221,136,32,93,69,7,121,70,251,32,77,91,26,39,62,
+60,40,184,157,130,1,12,95,111,222,1,14,89,94,71,85,69,63,47,63,12,254,104,
+253,153,26,138,95,77,56,52,30,140,102,80,50,115,74,86,85,32,16,212,123,96,
+59,18,40,109,184,106,72,50,107,107,52,139,78,69,50,31,77,84,96,93,96,19,123,
+113,3,168,27,239,169,111,132,83,66,62,81,44,35,20,240,21,35,46,71,84,129,
+35,52,47,63,94,127,34,0,4,255,197,255,232,5,133,4,250,0,31,0,44,0,52,0,60,
+0,0,5,35,39,38,38,39,23,20,6,35,34,38,53,52,54,51,23,38,39,6,35,34,38,38,
+53,52,55,35,39,33,23,35,3,17,33,22,22,21,20,7,22,22,23,22,23,1,54,53,52,38,
+35,34,7,7,6,21,20,22,51,50,55,4,156,6,104,35,88,63,1,72,76,76,93,110,92,35,
+21,74,68,95,119,221,136,32,93,69,5,122,70,233,110,254,118,77,91,63,41,53,
+7,111,80,254,105,26,138,95,77,56,52,30,140,102,80,50,24,104,85,131,26,19,
+71,86,96,75,82,105,2,101,75,32,109,184,106,72,50,107,107,253,37,2,219,52,
+139,78,106,65,46,133,69,54,182,2,79,46,71,84,129,35,52,47,63,94,127,34,0,
+3,255,197,0,0,5,19,4,250,0,52,0,61,0,67,0,0,33,35,39,38,38,39,39,54,54,55,
+38,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,23,33,22,21,20,7,22,
+22,21,20,35,34,38,53,52,54,51,50,22,23,52,38,38,39,3,22,22,51,50,54,53,52,
+39,3,6,7,22,22,23,3,34,4,103,87,228,121,82,123,222,133,64,38,33,120,87,81,
+143,55,71,38,74,47,61,71,34,11,254,81,69,5,8,70,254,181,71,101,122,164,165,
+63,75,60,54,42,55,9,96,156,87,214,11,103,89,59,62,45,176,204,150,96,202,56,
+74,107,105,4,233,74,116,51,57,109,111,129,126,130,37,75,70,94,138,97,107,
+107,116,116,149,58,41,211,121,214,72,56,54,70,41,32,81,128,74,6,2,46,145,
+163,72,64,95,77,253,206,84,100,13,133,87,0,2,255,197,254,216,8,68,4,250,0,
+103,0,112,0,0,1,35,39,38,38,35,34,7,6,35,32,17,52,55,23,6,21,20,22,51,50,
+55,54,51,50,22,23,38,53,17,52,38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,
+53,52,55,38,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,23,33,22,
+21,21,54,51,50,22,23,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,21,
+54,53,52,38,35,34,7,1,22,22,51,50,54,53,52,39,5,78,8,103,52,83,72,54,120,
+122,44,254,149,26,89,20,142,128,37,106,97,47,79,115,72,8,26,53,45,96,160,
+41,36,47,75,82,101,95,95,115,70,122,62,33,120,87,81,143,55,71,38,74,47,61,
+71,34,11,254,88,69,8,57,70,251,125,71,38,48,112,118,8,122,162,154,194,158,
+130,92,115,86,65,59,83,106,109,94,194,137,252,247,11,103,89,59,62,45,254,
+216,74,78,50,15,14,1,126,113,107,21,85,80,126,102,10,11,86,127,95,117,2,5,
+98,81,31,157,120,24,88,66,77,94,115,113,139,113,43,173,111,129,126,130,37,
+75,70,94,138,97,107,107,116,116,19,7,118,129,144,191,152,144,172,97,81,66,
+84,68,63,16,35,138,75,91,214,2,188,145,163,72,64,95,77,0,2,255,197,255,41,
+6,14,5,159,0,67,0,76,0,0,5,35,39,38,36,39,39,22,51,50,54,53,52,39,6,6,35,
+34,38,53,52,54,51,50,22,21,7,54,55,35,34,39,6,6,35,34,38,39,55,22,22,51,50,
+54,54,55,33,39,33,22,22,21,20,6,7,22,21,20,7,22,23,17,51,23,21,51,23,35,33,
+22,22,51,50,54,53,52,39,5,37,4,103,75,254,157,198,82,33,69,145,185,35,60,
+149,80,92,108,64,59,58,66,3,80,100,6,192,80,33,120,87,81,143,55,71,38,74,
+47,61,71,34,11,254,80,69,3,184,66,81,85,66,141,176,233,119,8,101,166,69,233,
+253,40,11,103,89,59,62,45,215,74,109,86,1,185,3,90,92,60,53,85,88,89,84,53,
+76,70,57,36,54,147,231,111,129,126,130,37,75,70,94,138,97,107,71,182,86,96,
+114,18,153,165,181,68,39,142,5,200,71,94,107,145,163,72,64,95,77,0,0,2,255,
+197,0,73,7,55,7,86,0,84,0,95,0,0,1,33,17,20,22,22,51,50,54,54,55,6,35,34,
+38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,38,38,35,34,6,6,7,6,6,35,
+34,38,39,55,22,22,51,50,54,55,38,38,35,34,7,39,35,39,33,38,38,35,34,7,6,35,
+34,38,53,52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,5,33,22,22,23,54,54,
+51,50,22,23,7,55,252,217,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,
+150,246,137,78,112,59,49,59,29,31,43,57,42,67,119,86,81,140,65,74,40,71,55,
+62,89,48,10,133,139,43,54,64,47,69,6,63,15,72,76,37,76,102,68,149,143,7,85,
+2,84,132,53,80,72,34,127,134,21,149,252,175,253,133,117,139,10,37,83,44,60,
+97,48,4,143,253,4,102,77,32,127,192,94,34,89,73,79,97,142,125,116,254,243,
+184,56,125,118,1,8,68,47,26,93,99,158,119,132,153,34,75,67,116,125,181,162,
+10,160,107,105,96,9,12,168,154,52,50,9,51,103,85,10,8,169,205,107,26,181,
+159,80,47,97,81,0,0,2,255,197,255,84,7,11,7,86,0,114,0,125,0,0,5,35,39,38,
+38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,
+53,53,6,35,34,38,38,53,53,38,38,35,34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,
+54,55,38,38,35,34,7,39,35,39,33,38,38,35,34,7,6,35,34,38,53,52,55,23,7,20,
+22,51,50,55,55,50,22,23,51,23,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,
+54,51,50,22,21,20,7,1,33,22,22,23,54,54,51,50,22,23,6,39,8,103,47,78,62,35,
+77,94,51,136,150,12,90,5,94,97,32,72,72,28,61,83,62,40,8,121,166,75,117,57,
+48,59,29,31,43,57,42,67,119,86,81,140,65,74,40,71,55,62,89,48,10,133,139,
+43,54,64,47,69,6,8,15,72,76,35,100,77,31,149,143,7,85,2,84,132,39,70,90,128,
+133,21,160,69,253,4,26,59,48,106,177,32,43,65,77,86,97,98,110,126,72,253,
+121,253,134,117,139,10,37,83,44,60,98,46,172,74,80,48,11,13,176,164,64,69,
+17,43,37,93,108,8,8,43,82,75,95,117,207,83,58,119,122,5,67,47,26,93,99,158,
+119,132,153,34,75,67,116,125,181,162,10,160,107,104,91,8,7,168,154,52,50,
+9,51,103,85,6,6,165,203,107,254,8,102,74,35,150,113,34,89,73,79,97,138,119,
+130,105,2,128,26,181,159,80,47,96,80,0,0,2,255,197,255,249,4,233,4,250,0,
+57,0,66,0,0,1,22,22,21,20,6,35,34,0,3,55,22,22,51,50,54,53,52,38,39,22,21,
+20,6,35,34,38,53,52,54,51,23,38,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,
+33,39,33,23,33,22,21,20,6,35,3,22,22,51,50,54,53,52,39,3,64,112,135,193,165,
+220,254,225,90,81,94,245,170,124,137,77,77,10,80,75,87,89,115,109,22,122,
+62,33,120,87,81,143,55,71,38,74,47,61,71,34,11,254,72,69,4,222,70,254,232,
+71,117,97,237,11,103,89,59,62,45,2,187,33,187,122,169,195,1,54,1,45,29,239,
+206,107,104,67,84,7,33,35,74,86,102,77,90,116,1,44,173,111,129,126,130,37,
+75,70,94,138,97,107,107,116,116,109,127,1,212,145,163,72,64,95,77,0,0,3,255,
+197,254,21,4,235,4,250,0,63,0,72,0,79,0,0,1,35,39,38,36,39,39,54,55,38,3,
+55,22,22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,55,38,39,6,6,35,
+34,38,39,55,22,22,51,50,54,54,55,33,39,33,23,33,22,21,20,6,7,22,22,21,20,
+6,7,1,22,22,51,50,54,53,52,39,3,7,4,7,22,22,23,3,126,4,103,81,254,246,161,
+83,91,173,198,157,75,107,246,155,120,145,84,78,10,78,75,87,91,110,99,68,41,
+33,120,87,81,143,55,71,38,74,47,61,71,34,11,254,64,69,4,224,70,254,238,71,
+90,70,76,85,86,77,254,223,11,103,89,59,62,45,101,4,254,251,127,108,236,48,
+254,21,74,100,68,5,223,52,72,124,1,132,38,204,217,107,102,67,86,7,33,35,75,
+85,102,77,84,114,7,58,115,111,129,126,130,37,75,70,94,138,97,107,107,116,
+116,100,114,16,48,163,95,106,161,45,4,56,145,163,72,64,95,77,251,159,1,86,
+60,20,121,64,0,0,2,255,197,255,81,6,42,4,250,0,79,0,88,0,0,5,35,39,38,38,
+35,34,7,6,35,32,17,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,38,53,17,52,
+38,38,35,34,6,7,54,51,50,22,21,20,6,35,34,38,53,52,55,38,39,6,6,35,34,38,
+39,55,22,22,51,50,54,54,55,33,39,33,23,33,22,21,21,54,51,50,22,22,21,1,22,
+22,51,50,54,53,52,39,5,86,8,103,52,83,72,54,120,122,44,254,149,26,89,20,142,
+128,37,106,97,47,79,115,72,8,26,53,45,81,138,40,35,40,75,82,101,95,95,115,
+44,125,61,33,120,87,81,143,55,71,38,74,47,61,71,34,11,254,78,69,6,31,70,253,
+161,71,36,48,76,109,55,252,249,11,103,89,59,62,45,175,74,78,50,15,14,1,126,
+113,107,21,85,80,126,102,10,11,86,127,95,117,1,140,98,81,31,110,86,19,89,
+65,77,94,115,113,95,80,43,174,111,129,126,130,37,75,70,94,138,97,107,107,
+116,116,19,7,58,129,119,2,38,145,163,72,64,95,77,0,2,255,197,255,141,4,244,
+4,250,0,58,0,67,0,0,5,38,36,39,39,22,51,32,53,52,38,35,7,22,21,20,6,35,34,
+38,53,52,54,51,23,38,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,
+23,33,22,21,20,6,7,22,22,21,20,6,7,22,23,1,22,22,51,50,54,53,52,39,4,98,153,
+254,168,167,27,116,138,1,29,99,80,51,18,79,81,76,98,145,117,31,101,54,33,
+120,87,81,143,55,71,38,74,47,61,71,34,11,254,72,69,4,233,70,254,221,71,112,
+80,110,110,118,111,129,182,253,207,11,103,89,59,62,45,115,88,95,5,178,20,
+195,68,86,3,33,35,70,86,87,81,92,114,1,53,151,111,129,126,130,37,75,70,94,
+138,97,107,107,116,116,112,116,7,39,179,113,97,145,29,39,109,4,193,145,163,
+72,64,95,77,0,0,2,255,197,255,232,4,181,4,250,0,49,0,58,0,0,5,35,39,53,38,
+38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,38,53,17,38,39,6,6,35,34,38,
+39,55,22,22,51,50,54,54,55,33,39,33,23,35,22,21,20,6,7,1,22,22,51,50,54,53,
+52,39,3,118,6,104,58,179,87,4,77,70,83,87,116,92,121,237,75,5,150,71,33,120,
+87,81,143,55,71,38,74,47,61,71,34,11,254,80,69,4,170,70,236,71,87,67,254,
+215,11,103,89,59,62,45,24,104,47,78,132,20,16,20,68,81,95,75,85,103,171,140,
+90,127,1,12,28,198,111,129,126,130,37,75,70,94,138,97,107,107,116,116,97,
+114,17,1,204,145,163,72,64,95,77,0,3,255,197,255,232,8,109,5,159,0,54,0,63,
+0,76,0,0,5,35,39,17,38,39,1,39,55,54,53,52,38,35,34,7,6,6,35,34,39,6,6,35,
+34,38,39,55,22,22,51,50,54,54,55,33,39,33,22,23,54,54,51,50,22,23,38,53,17,
+51,23,21,51,23,35,33,22,22,51,50,54,53,52,39,5,38,38,35,34,6,7,21,54,51,50,
+22,23,7,132,8,103,38,40,254,0,127,50,78,55,44,61,55,28,99,56,192,80,33,120,
+87,81,143,55,71,38,74,47,61,71,34,11,254,80,69,3,194,51,40,84,168,106,113,
+204,153,9,8,101,166,69,233,250,201,11,103,89,59,62,39,2,250,61,122,71,102,
+147,93,27,41,93,124,3,24,75,2,181,64,57,254,46,127,44,80,74,54,53,30,52,50,
+231,111,129,126,130,37,75,70,94,138,97,107,57,98,88,81,176,255,133,118,1,
+75,71,94,107,145,163,72,64,92,80,173,68,64,84,115,3,8,118,94,0,3,255,197,
+255,195,8,121,5,159,0,81,0,90,0,101,0,0,5,35,39,38,38,35,34,7,6,35,34,38,
+53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,22,23,38,53,17,39,1,39,55,
+54,53,52,38,35,34,7,6,6,35,34,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,
+33,39,33,22,23,54,51,50,22,23,38,53,17,51,23,21,51,23,35,33,22,22,51,50,54,
+53,52,39,5,38,35,34,6,7,54,51,50,22,23,7,144,8,103,47,72,58,55,126,130,58,
+147,166,14,90,7,115,109,40,93,12,98,67,61,77,55,43,8,64,254,16,127,50,68,
+47,42,63,56,20,114,71,192,80,33,120,87,81,143,55,71,38,74,47,61,71,34,11,
+254,63,69,3,211,49,40,175,200,126,204,118,7,8,101,166,69,233,250,206,11,103,
+89,59,62,39,2,248,109,128,84,136,98,24,30,83,115,10,61,74,83,45,18,18,181,
+159,67,75,15,51,40,92,109,12,1,15,43,78,79,95,117,1,255,87,254,90,127,44,
+70,74,37,40,32,80,77,231,111,129,126,130,37,75,70,94,138,97,107,55,95,171,
+156,189,119,96,1,18,71,94,107,145,163,72,64,92,80,129,95,60,89,5,99,88,0,
+0,2,255,196,255,161,7,241,4,250,0,66,0,75,0,0,5,35,39,46,2,39,39,54,55,38,
+39,6,35,34,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,23,33,22,21,
+20,7,22,23,23,6,7,22,4,23,17,51,22,4,21,20,6,35,34,38,53,52,54,51,50,22,23,
+53,52,37,1,22,22,51,50,54,53,52,39,5,123,6,101,98,187,174,160,79,179,201,
+63,42,24,24,193,81,33,120,86,81,143,55,71,38,74,47,61,71,34,11,254,81,69,
+7,231,70,251,220,66,58,41,79,40,184,157,130,1,12,95,111,222,1,14,89,94,71,
+85,69,63,47,63,12,254,104,252,207,6,109,96,69,66,39,95,74,86,85,32,16,212,
+116,103,48,19,7,237,109,127,126,130,37,75,70,94,138,97,107,107,109,133,100,
+63,45,110,96,93,96,19,123,113,3,163,27,239,169,111,132,83,66,62,81,44,35,
+20,240,21,1,97,152,176,80,66,112,70,0,0,3,255,197,255,232,6,40,4,250,0,39,
+0,48,0,60,0,0,5,35,39,38,38,39,23,20,6,35,34,38,53,52,54,51,51,38,39,38,39,
+6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,23,35,33,22,22,51,50,54,
+53,52,39,33,33,22,21,20,7,22,23,22,23,38,53,5,63,6,104,59,99,58,1,72,76,76,
+93,110,92,14,42,64,178,79,33,120,87,81,143,55,71,38,74,47,61,71,34,11,254,
+80,69,6,29,70,233,253,14,11,103,89,59,62,45,1,109,254,248,71,104,53,14,138,
+96,4,24,104,123,105,18,23,71,86,96,75,82,105,126,69,9,222,111,129,126,130,
+37,75,70,94,138,97,107,107,145,163,72,64,95,77,116,116,149,59,81,162,57,203,
+71,141,0,2,255,197,255,182,4,205,4,250,0,67,0,76,0,0,5,35,39,53,38,35,34,
+21,39,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,
+51,50,23,54,54,51,50,22,23,17,38,39,6,6,35,34,38,39,55,22,22,51,50,54,54,
+55,33,39,33,23,35,22,21,20,6,7,1,22,22,51,50,54,53,52,39,3,142,6,104,65,67,
+80,42,25,85,73,63,78,39,2,66,55,60,71,77,67,59,110,69,101,99,117,64,13,54,
+45,55,82,37,150,69,33,120,87,81,143,55,71,38,74,47,61,71,34,11,254,53,69,
+4,194,70,233,71,88,69,254,218,11,103,89,59,62,45,74,104,240,106,141,16,59,
+69,63,56,59,27,50,61,73,62,62,70,66,131,93,106,140,141,70,67,94,86,1,78,30,
+196,111,129,126,130,37,75,70,94,138,97,107,107,116,116,99,113,17,1,205,145,
+163,72,64,95,77,0,1,255,197,254,100,4,105,4,250,0,74,0,0,1,35,39,53,38,38,
+35,34,6,21,20,22,23,39,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,
+23,17,38,36,39,39,22,51,32,53,52,38,35,34,7,21,20,6,35,34,38,53,52,54,55,
+38,39,33,39,33,23,33,22,23,22,22,21,20,7,22,23,7,38,39,3,142,8,103,81,157,
+109,94,120,51,38,1,83,65,74,87,100,91,140,163,162,142,111,162,81,146,254,
+211,176,41,126,203,1,76,116,100,31,27,80,101,73,94,125,103,30,54,254,204,
+69,4,95,69,253,85,23,21,194,218,199,198,165,37,62,57,254,100,75,236,118,103,
+79,93,50,61,11,21,66,79,88,67,80,90,181,152,148,167,124,162,1,50,54,47,7,
+189,42,195,71,81,4,16,95,103,90,72,82,100,13,50,41,107,107,34,53,3,176,156,
+195,85,58,104,77,36,26,0,1,255,197,255,172,6,72,4,250,0,66,0,0,5,38,36,37,
+39,22,51,50,54,53,52,38,35,34,7,21,20,6,35,34,38,53,52,54,55,38,39,35,39,
+33,23,33,22,23,22,22,23,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,21,
+21,54,53,52,38,35,34,7,6,6,7,22,23,3,144,206,254,168,254,255,41,155,174,166,
+186,114,122,31,27,80,101,73,94,125,103,47,101,173,69,6,62,69,251,15,46,30,
+153,202,44,125,176,154,194,158,130,92,115,86,65,59,83,106,109,94,185,132,
+1,151,134,215,194,84,194,164,29,198,51,130,115,91,111,4,16,95,103,90,72,82,
+100,13,78,53,107,107,48,79,4,120,99,166,191,152,144,172,97,81,66,84,68,63,
+16,35,138,75,91,193,131,174,43,108,211,0,0,3,255,197,255,232,6,12,4,250,0,
+53,0,58,0,71,0,0,37,38,53,52,54,55,6,35,35,17,35,39,53,38,38,39,23,20,6,35,
+34,38,53,52,54,51,51,38,38,39,6,35,34,38,53,52,54,55,38,39,35,39,33,23,33,
+21,54,55,23,6,6,21,20,23,1,33,22,4,23,21,36,37,22,23,22,22,23,22,22,23,38,
+53,4,228,81,20,18,83,137,23,8,103,56,123,80,1,70,65,69,77,93,85,2,19,75,52,
+10,123,69,79,87,79,74,95,56,69,6,2,69,253,186,140,121,180,62,51,46,254,27,
+253,163,120,1,63,166,254,229,254,250,16,12,92,137,21,82,139,51,5,133,201,
+197,65,154,60,22,252,212,75,110,84,119,20,11,67,72,86,66,74,94,77,106,19,
+123,85,68,71,92,4,150,64,107,107,216,7,52,165,106,166,119,149,138,3,232,88,
+123,6,152,43,193,42,59,39,217,138,26,135,97,85,113,0,0,1,255,197,254,185,
+4,54,4,250,0,83,0,0,1,35,39,53,38,35,34,21,39,38,38,35,34,6,21,20,23,54,54,
+51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,23,54,54,51,50,22,23,53,38,36,
+39,39,22,51,32,53,52,38,35,34,7,21,20,6,35,34,38,53,52,54,55,38,39,33,39,
+33,23,33,22,23,22,22,21,20,7,22,23,7,38,39,3,94,6,104,65,67,80,42,25,85,73,
+63,78,39,2,66,55,60,71,77,67,59,110,69,101,99,117,64,13,54,45,55,82,37,146,
+254,211,176,41,126,203,1,76,116,100,31,27,80,101,73,94,125,103,30,54,254,
+251,69,4,44,69,253,89,27,17,194,218,199,198,165,37,60,60,254,185,104,210,
+106,141,16,59,69,63,56,59,27,50,61,73,62,62,70,66,131,93,106,140,141,70,67,
+94,86,248,54,47,7,189,42,195,71,81,4,16,95,103,90,72,82,100,13,50,41,107,
+107,39,48,3,176,156,195,85,58,104,77,35,28,0,3,255,197,254,225,6,80,4,250,
+0,88,0,104,0,111,0,0,1,35,39,53,38,38,35,34,21,20,23,39,52,54,51,50,22,21,
+20,6,35,34,38,53,52,54,51,50,22,23,17,38,38,39,23,20,6,35,34,38,53,52,54,
+55,38,38,39,21,20,6,35,34,38,53,52,54,55,38,39,35,39,33,23,33,17,54,51,50,
+22,21,20,6,35,34,38,53,52,54,51,50,22,23,55,52,38,35,34,15,2,34,38,53,53,
+33,22,23,22,22,23,22,22,23,38,53,3,20,51,50,55,17,35,3,250,8,103,64,154,107,
+162,50,2,75,53,60,78,82,76,109,145,134,108,99,176,68,56,153,90,1,70,65,69,
+77,91,83,25,84,51,68,65,69,79,92,84,40,71,116,69,6,70,69,253,170,54,53,172,
+197,95,85,71,88,72,63,43,57,11,1,85,77,59,89,74,111,150,183,254,197,46,21,
+91,145,29,95,174,54,7,222,85,47,90,222,254,225,75,122,108,114,150,70,30,26,
+57,62,79,64,67,79,177,130,119,147,129,130,1,20,69,104,15,13,67,72,86,66,73,
+94,1,62,85,17,6,68,71,85,68,73,93,1,88,56,107,107,254,255,13,203,179,116,
+128,83,67,61,80,41,28,21,109,121,31,23,13,167,134,163,68,91,33,181,121,24,
+135,88,92,131,1,25,88,32,1,37,0,4,255,197,255,87,7,179,4,250,0,48,0,64,0,
+71,0,104,0,0,5,35,39,38,36,39,23,20,6,35,34,38,53,52,54,55,38,38,39,23,20,
+6,35,34,38,53,52,54,55,38,38,39,21,20,6,35,34,38,53,52,54,55,38,39,35,39,
+33,23,35,1,34,38,53,53,33,22,23,22,22,23,22,22,23,38,53,17,35,21,20,51,50,
+55,1,52,38,35,34,7,7,17,22,4,23,38,53,17,33,21,54,51,50,22,21,20,6,35,34,
+38,53,52,54,51,50,22,23,6,204,6,104,64,254,178,179,2,75,69,83,90,77,69,54,
+142,80,1,70,65,69,77,91,83,24,85,51,68,65,69,79,92,84,40,71,116,69,7,169,
+69,231,252,191,150,183,254,197,46,21,91,145,29,94,174,53,5,222,85,47,90,1,
+239,85,77,59,89,74,169,1,105,88,6,253,156,54,53,172,197,95,85,71,88,72,63,
+43,57,11,169,104,93,143,18,37,68,81,100,75,67,95,15,60,88,13,13,67,72,86,
+66,73,94,1,61,86,17,6,68,71,85,68,73,93,1,88,56,107,107,254,128,167,134,83,
+68,91,33,181,120,22,125,84,89,117,2,6,157,88,32,254,178,109,121,31,23,254,
+70,26,176,105,78,156,3,118,177,13,203,179,116,128,83,67,61,80,41,28,0,0,3,
+255,196,255,232,5,253,7,86,0,49,0,60,0,74,0,0,1,33,17,20,22,22,51,50,54,54,
+55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,33,17,35,39,17,
+35,39,51,38,39,54,54,51,50,4,23,22,23,51,1,38,38,35,34,7,22,22,51,50,55,1,
+38,38,35,34,7,6,35,32,3,6,7,22,23,5,253,252,219,28,58,47,79,156,119,25,43,
+65,77,86,99,98,108,125,150,246,137,78,112,59,254,179,7,104,163,70,229,111,
+55,131,247,154,182,1,134,131,62,17,147,254,71,105,240,112,40,42,9,89,114,
+55,136,1,85,14,66,83,42,113,158,70,254,254,31,122,102,44,58,4,143,253,4,102,
+77,32,127,192,94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,3,27,251,
+89,75,4,92,107,103,64,241,196,199,158,69,178,1,58,69,68,10,85,60,10,254,206,
+96,65,9,12,1,5,75,197,63,66,0,0,4,255,196,255,101,5,226,7,86,0,55,0,66,0,
+80,0,86,0,0,5,35,39,38,38,39,39,54,55,38,38,53,17,33,17,35,39,17,35,39,51,
+38,39,54,54,51,50,4,23,22,23,51,23,33,17,20,22,22,51,50,54,55,6,35,34,38,
+53,52,54,51,50,22,21,20,6,7,1,54,51,38,35,34,7,22,22,51,50,1,38,38,35,34,
+7,6,35,32,3,6,7,22,23,1,6,7,22,22,23,4,180,4,103,69,190,170,67,65,68,62,55,
+254,179,7,104,163,70,229,111,55,131,247,154,177,1,100,130,62,17,160,69,252,
+246,26,59,48,114,181,34,43,65,77,86,97,98,110,126,77,69,254,172,94,32,190,
+234,40,42,9,89,114,54,1,182,14,66,83,39,99,136,69,254,254,31,122,102,44,58,
+3,54,144,120,78,148,38,155,74,84,84,5,199,37,33,33,118,120,2,23,251,89,75,
+4,92,107,103,64,241,196,192,165,69,178,107,254,8,102,74,35,144,119,34,89,
+73,79,97,138,119,89,162,60,4,105,8,137,10,85,60,254,216,96,65,9,12,1,5,75,
+197,63,66,252,87,58,59,26,104,58,0,0,3,255,196,255,84,6,27,7,86,0,80,0,91,
+0,105,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,
+54,51,50,22,22,23,38,53,53,6,35,34,38,38,53,17,33,17,35,39,17,35,39,51,38,
+39,54,54,51,50,4,23,22,23,51,23,33,17,20,22,22,51,50,54,55,6,35,34,38,53,
+52,54,51,50,22,21,20,7,1,38,38,35,34,7,22,22,51,50,55,1,38,38,35,34,7,6,35,
+32,3,6,7,22,23,5,55,8,103,47,78,62,29,78,90,50,136,150,21,88,12,94,97,18,
+81,61,34,61,83,62,40,8,121,166,75,117,57,254,108,7,104,163,70,229,111,55,
+131,247,154,186,1,156,125,62,17,157,69,253,4,26,59,48,106,177,32,43,65,77,
+86,97,98,110,126,72,254,217,109,252,113,40,42,9,89,114,54,144,1,98,14,66,
+83,42,122,166,73,254,254,31,122,102,44,58,172,74,80,48,12,14,176,164,90,86,
+20,60,60,93,108,9,9,43,82,75,95,117,207,83,58,119,122,2,23,251,89,75,4,92,
+107,103,64,241,196,205,152,69,178,107,254,8,102,74,35,150,113,34,89,73,79,
+97,138,119,130,105,4,37,68,69,10,85,60,10,254,206,96,65,9,12,1,5,75,197,63,
+66,0,0,4,255,196,255,232,6,159,7,86,0,81,0,92,0,106,0,113,0,0,1,33,21,22,
+22,21,20,6,35,34,38,53,52,54,51,50,22,23,52,38,39,21,20,6,6,7,14,2,21,20,
+22,51,50,54,55,38,38,53,52,54,51,50,22,21,20,6,6,35,34,38,53,52,54,54,55,
+38,38,39,39,36,55,53,33,17,35,39,17,35,39,51,38,39,54,54,51,50,4,23,22,23,
+33,1,38,38,35,34,7,22,22,51,50,55,1,38,38,35,34,7,6,35,32,3,6,7,22,23,1,6,
+7,22,23,54,53,6,159,253,230,187,206,77,81,67,68,60,54,42,55,9,186,134,50,
+71,56,41,48,31,67,74,80,143,48,51,68,79,62,72,91,116,175,89,167,189,27,59,
+122,72,156,113,70,1,23,249,253,6,7,104,163,70,229,111,55,131,247,154,182,
+1,134,131,62,17,1,53,253,165,105,240,112,40,42,9,89,114,55,136,1,85,14,66,
+83,42,113,158,70,254,254,31,122,102,44,58,3,7,127,177,155,107,42,4,143,54,
+22,193,157,96,114,76,52,54,70,41,32,105,108,7,241,86,117,69,40,30,43,59,40,
+46,58,54,50,1,63,53,58,71,97,75,96,133,65,160,143,42,70,73,92,58,58,7,201,
+151,70,57,251,89,75,4,92,107,103,64,241,196,199,158,69,178,1,58,69,68,10,
+85,60,10,254,206,96,65,9,12,1,5,75,197,63,66,254,164,38,87,53,117,50,50,0,
+4,255,196,254,109,6,169,7,86,0,113,0,124,0,137,0,144,0,0,1,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,
+6,35,34,38,53,52,54,54,55,38,38,39,39,36,55,53,33,17,35,39,17,35,39,51,38,
+39,54,54,51,50,4,4,23,22,23,51,23,33,21,4,17,20,6,35,34,38,53,52,54,51,50,
+22,23,52,38,39,21,20,6,6,7,14,2,21,20,22,51,50,54,55,38,38,53,52,54,51,50,
+22,21,20,7,3,38,36,35,34,7,22,22,51,50,55,1,38,38,35,7,6,35,32,3,6,7,22,23,
+1,6,7,22,23,54,53,5,111,8,103,47,78,62,29,78,90,50,136,150,21,88,12,94,97,
+18,81,61,34,61,83,62,40,8,93,100,167,189,48,70,56,64,143,100,70,1,23,249,
+252,252,7,104,163,70,229,111,55,131,247,154,139,1,51,1,28,96,62,17,196,69,
+253,230,1,137,77,81,67,68,60,54,42,55,9,176,144,50,71,56,41,48,31,67,74,80,
+143,48,51,68,79,62,72,91,76,248,119,254,210,156,40,42,9,89,114,58,200,1,141,
+14,66,83,207,224,75,254,254,31,122,102,44,58,3,17,127,177,136,101,67,254,
+109,74,80,48,12,14,176,164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,116,
+39,160,143,55,89,66,42,45,47,6,201,151,70,37,251,89,75,4,92,107,103,64,241,
+196,77,161,119,69,178,107,34,44,254,214,96,114,76,52,54,70,41,32,103,81,6,
+191,86,117,69,40,30,43,59,40,46,58,54,50,1,63,53,58,71,97,75,108,74,5,141,
+69,68,10,85,60,10,254,206,96,65,9,12,1,5,75,197,63,66,254,184,38,87,47,97,
+63,61,0,0,3,255,196,255,112,6,163,7,86,0,66,0,76,0,89,0,0,1,33,17,20,22,22,
+51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,7,22,21,20,6,35,34,0,3,55,
+22,4,51,50,54,53,52,39,6,6,35,34,38,38,53,17,33,17,35,39,17,35,39,51,38,39,
+54,36,51,50,4,23,22,23,51,1,38,33,34,7,22,22,51,50,55,1,38,38,35,7,6,35,34,
+39,6,7,22,23,6,163,252,183,26,59,48,121,193,35,43,65,77,86,99,98,108,125,
+73,97,203,194,211,254,204,123,84,109,1,13,165,140,161,51,70,188,107,75,117,
+57,254,49,7,104,163,70,229,111,55,121,1,14,181,253,1,121,133,62,17,213,254,
+6,211,254,205,65,56,12,89,110,60,194,1,122,14,66,83,198,210,75,254,34,137,
+88,44,58,4,143,253,234,102,74,35,157,126,34,89,73,79,97,142,125,119,106,120,
+167,176,198,1,34,1,53,38,230,212,127,108,90,66,65,74,58,119,122,2,53,251,
+89,75,4,92,107,103,64,238,199,195,162,69,178,1,58,137,18,82,55,10,254,206,
+96,65,9,12,254,82,183,63,66,0,4,255,196,255,23,7,85,7,86,0,44,0,55,0,69,0,
+100,0,0,5,35,39,38,39,23,20,6,35,34,38,53,52,54,55,38,39,6,35,34,38,38,53,
+17,33,17,35,39,17,35,39,51,38,39,54,54,51,50,4,23,22,23,33,23,35,1,54,51,
+38,35,34,7,22,22,51,50,1,38,38,35,34,7,6,35,32,3,6,7,22,23,5,33,17,20,22,
+22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,23,22,22,23,38,53,
+6,109,6,104,84,153,2,72,76,76,93,108,86,31,47,112,131,75,117,57,254,189,7,
+104,163,70,229,111,55,131,247,154,186,1,92,129,62,17,2,19,69,232,252,243,
+94,32,190,234,40,42,9,89,114,54,1,182,14,66,83,39,99,136,69,254,254,31,122,
+102,44,58,4,240,252,207,26,59,48,121,193,35,43,65,77,86,99,98,108,125,93,
+82,58,30,84,138,45,4,233,104,176,35,26,71,86,96,75,80,105,2,58,43,55,58,119,
+122,2,53,251,89,75,4,92,107,103,64,241,196,201,156,69,178,107,1,157,8,137,
+10,85,60,254,216,96,65,9,12,1,5,75,197,63,66,107,253,234,102,74,35,157,126,
+34,89,73,79,97,142,125,95,174,62,61,105,22,126,87,72,145,0,5,255,196,255,
+232,5,179,7,86,0,64,0,75,0,89,0,97,0,105,0,0,5,35,39,17,35,39,51,38,39,54,
+54,51,50,4,23,22,23,51,23,33,22,22,21,20,14,2,7,14,2,21,20,22,51,50,54,55,
+38,38,53,52,54,51,50,22,21,20,6,6,35,34,38,38,53,52,54,54,55,38,38,53,52,
+55,33,1,54,51,38,35,34,7,22,22,51,50,1,38,38,35,34,7,6,35,32,3,6,7,22,23,
+1,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,1,28,7,104,163,70,229,111,55,
+131,247,154,185,1,82,130,62,17,122,70,254,194,77,91,35,86,120,82,101,120,
+82,77,72,80,148,49,50,68,79,62,72,91,119,179,89,120,162,77,96,137,95,148,
+193,32,254,228,2,58,94,34,188,228,40,42,9,89,114,52,1,174,14,66,83,39,95,
+130,69,254,254,31,122,102,44,58,3,92,26,138,95,77,56,52,30,140,102,80,50,
+24,75,4,92,107,103,64,241,196,199,158,69,178,107,52,139,78,55,100,90,75,42,
+53,78,110,72,51,71,54,50,2,62,53,58,71,97,75,96,133,65,95,142,70,97,142,90,
+44,41,213,126,72,50,1,157,8,137,10,85,60,254,216,96,65,9,12,1,5,75,197,63,
+66,254,72,46,71,84,129,35,52,47,63,94,127,34,0,0,5,255,196,254,117,6,82,7,
+86,0,93,0,104,0,118,0,126,0,134,0,0,1,35,39,38,38,35,34,7,6,35,34,38,53,52,
+55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,6,35,34,38,53,52,54,
+55,38,38,53,52,55,33,17,35,39,17,35,39,51,38,39,54,54,51,50,4,23,22,23,51,
+23,33,22,22,21,20,7,6,7,14,2,21,20,22,51,50,54,55,38,38,53,52,54,51,50,22,
+21,20,7,1,38,36,35,34,7,22,22,51,50,55,1,38,38,35,34,7,6,35,32,3,6,7,22,23,
+1,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,5,89,8,103,47,78,62,38,74,94,
+51,136,150,21,88,12,94,97,23,81,65,35,61,83,62,40,8,85,107,173,192,146,123,
+126,156,32,254,76,7,104,163,70,229,111,55,131,247,154,199,1,219,119,62,17,
+141,70,254,187,77,91,107,57,135,105,128,89,103,75,69,121,38,45,58,79,62,72,
+91,78,254,240,120,254,218,117,40,42,9,89,114,65,153,1,148,14,66,83,44,149,
+206,74,254,254,31,122,102,44,58,3,244,26,138,95,77,56,52,30,140,102,80,50,
+254,117,74,80,48,12,14,176,164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,
+124,35,163,149,110,140,48,50,198,112,72,50,251,89,75,4,92,107,103,64,241,
+196,213,144,69,178,107,52,139,78,140,66,36,53,42,64,95,64,72,75,59,51,6,62,
+48,58,71,97,75,116,78,5,127,68,70,10,85,60,9,254,207,96,65,9,12,1,5,75,197,
+63,66,254,72,46,71,84,129,35,52,47,63,94,127,34,0,0,2,255,160,255,232,6,7,
+7,86,0,64,0,77,0,0,5,35,39,17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,
+52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,35,39,33,46,2,35,33,34,46,2,53,
+52,55,23,7,20,22,23,38,53,52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,
+23,51,50,22,23,5,30,8,103,252,96,28,58,47,79,156,119,25,43,65,77,86,99,98,
+108,125,150,246,137,78,112,59,150,69,3,54,9,31,72,70,254,198,92,141,85,45,
+7,85,2,81,101,7,208,182,1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,
+154,7,235,180,154,17,24,75,4,92,253,4,102,77,32,127,192,94,34,89,73,79,97,
+142,125,116,254,243,184,56,125,118,3,27,107,58,60,28,33,69,111,101,52,50,
+9,51,96,97,11,21,32,118,135,254,208,254,212,107,107,241,222,58,69,20,21,128,
+167,0,0,3,255,124,255,101,5,227,7,86,0,70,0,83,0,89,0,0,5,35,39,17,33,17,
+20,22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,6,7,17,35,39,38,38,
+39,39,54,55,38,38,53,17,35,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,
+38,53,52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,3,6,
+7,22,22,23,4,250,8,103,252,132,26,59,48,114,181,34,43,65,77,86,97,98,110,
+126,77,69,4,103,69,190,170,67,65,68,62,55,150,69,3,20,9,31,72,70,254,196,
+92,141,85,45,7,85,2,81,101,7,208,182,1,94,1,121,24,163,70,233,111,16,254,
+179,254,235,159,154,7,237,180,154,17,183,144,120,78,148,38,24,75,4,92,254,
+8,102,74,35,144,119,34,89,73,79,97,138,119,89,162,60,253,162,74,84,84,5,199,
+37,33,33,118,120,2,23,107,58,60,28,33,69,111,101,52,50,9,51,96,97,11,21,32,
+118,135,254,208,254,212,107,107,241,222,58,69,20,21,128,167,252,87,58,59,
+26,104,58,0,2,255,181,255,84,6,28,7,86,0,95,0,108,0,0,5,35,39,17,33,17,20,
+22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,7,17,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,
+6,35,34,38,38,53,17,35,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,
+53,52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,5,51,8,
+103,252,146,26,59,48,106,177,32,43,65,77,86,97,98,110,126,72,8,103,47,78,
+62,29,78,90,50,136,150,21,88,12,94,97,18,81,61,34,61,83,62,40,8,121,166,75,
+117,57,221,69,3,77,9,31,72,70,254,196,92,141,85,45,7,85,2,81,101,7,208,182,
+1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,237,180,154,17,
+24,75,4,92,254,8,102,74,35,150,113,34,89,73,79,97,138,119,130,105,253,69,
+74,80,48,12,14,176,164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,207,83,58,
+119,122,2,23,107,58,60,28,33,69,111,101,52,50,9,51,96,97,11,21,32,118,135,
+254,208,254,212,107,107,241,222,58,69,20,21,128,167,0,3,255,197,255,232,6,
+160,7,86,0,96,0,109,0,116,0,0,5,35,39,17,33,21,22,22,21,20,6,35,34,38,53,
+52,54,51,50,22,23,52,38,39,21,20,6,6,7,14,2,21,20,22,51,50,54,55,38,38,53,
+52,54,51,50,22,21,20,6,6,35,34,38,53,52,54,54,55,38,38,39,39,36,55,53,33,
+39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,54,51,32,0,19,51,
+23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,1,6,7,22,23,54,53,5,183,8,103,
+253,116,187,206,77,81,67,68,60,54,42,55,9,186,134,50,71,56,41,48,31,67,74,
+80,143,48,51,68,79,62,72,91,116,175,89,167,189,27,59,122,72,156,113,70,1,
+23,249,253,189,69,3,177,9,31,72,70,254,228,95,138,84,46,7,85,2,81,101,7,208,
+182,1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,205,180,154,
+17,254,125,127,177,155,107,42,24,75,4,92,54,22,193,157,96,114,76,52,54,70,
+41,32,105,108,7,241,86,117,69,40,30,43,59,40,46,58,54,50,1,63,53,58,71,97,
+75,96,133,65,160,143,42,70,73,92,58,58,7,201,151,70,57,107,58,60,28,32,69,
+110,103,52,50,9,51,96,97,11,21,32,118,135,254,208,254,212,107,107,241,222,
+58,69,20,21,128,167,254,164,38,87,53,117,50,50,0,3,255,197,254,109,6,171,
+7,86,0,127,0,140,0,147,0,0,5,35,39,17,33,21,4,17,20,6,35,34,38,53,52,54,51,
+50,22,23,52,38,39,21,20,6,6,7,14,2,21,20,22,51,50,54,55,38,38,53,52,54,51,
+50,22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,
+50,55,54,51,50,22,22,23,38,53,53,6,35,34,38,53,52,54,54,55,38,38,39,39,36,
+55,53,33,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,54,51,32,
+0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,1,6,7,22,23,54,53,5,194,
+8,103,253,115,1,137,77,81,67,68,60,54,42,55,9,176,144,50,71,56,41,48,31,67,
+74,80,143,48,51,68,79,62,72,91,76,8,103,47,78,62,29,78,90,50,136,150,21,88,
+12,94,97,18,81,61,34,61,83,62,40,8,93,100,167,189,48,70,56,64,143,100,70,
+1,23,249,253,179,69,3,180,9,31,72,70,254,196,92,141,85,45,7,85,2,93,130,8,
+208,182,1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,197,180,
+154,17,254,132,127,177,136,101,67,24,75,4,92,34,44,254,214,96,114,76,52,54,
+70,41,32,103,81,6,191,86,117,69,40,30,43,59,40,46,58,54,50,1,63,53,58,71,
+97,75,108,74,253,198,74,80,48,12,14,176,164,90,86,20,60,60,93,108,9,9,43,
+82,75,95,117,116,39,160,143,55,89,66,42,45,47,6,201,151,70,37,107,58,60,28,
+33,69,111,101,52,50,9,51,103,97,6,24,31,118,135,254,208,254,212,107,107,241,
+222,58,69,20,21,128,167,254,184,38,87,47,97,63,61,0,2,255,197,255,112,6,164,
+7,86,0,81,0,94,0,0,5,35,39,17,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,
+54,51,50,22,21,20,7,22,21,20,6,35,34,0,3,55,22,4,51,50,54,53,52,39,6,6,35,
+34,38,38,53,17,33,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,
+54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,5,187,8,103,
+252,69,26,59,48,121,193,35,43,65,77,86,99,98,108,125,73,97,203,194,211,254,
+204,123,84,109,1,13,165,140,161,51,70,188,107,75,117,57,254,232,69,3,171,
+9,31,72,70,254,238,92,141,85,45,7,85,2,81,101,7,208,182,1,94,1,121,24,163,
+70,233,111,16,254,179,254,235,159,154,7,195,180,154,17,24,75,4,92,253,234,
+102,74,35,157,126,34,89,73,79,97,142,125,119,106,120,167,176,198,1,34,1,53,
+38,230,212,127,108,90,66,65,74,58,119,122,2,53,107,58,60,28,33,69,111,101,
+52,50,9,51,96,97,11,21,32,118,135,254,208,254,212,107,107,241,222,58,69,20,
+21,128,167,0,3,255,197,255,23,7,86,7,86,0,57,0,69,0,100,0,0,5,35,39,17,33,
+17,35,39,38,39,23,20,6,35,34,38,53,52,54,55,38,39,6,35,34,38,38,53,17,35,
+39,33,38,38,35,5,34,38,38,53,52,55,23,7,20,22,51,55,39,52,54,51,32,0,19,51,
+23,35,39,38,36,33,34,6,21,23,55,50,22,23,23,33,17,20,22,22,51,50,54,55,6,
+35,34,38,53,52,54,51,50,22,21,20,6,7,22,23,22,22,23,38,53,6,109,8,103,254,
+166,6,104,84,153,2,72,76,76,93,108,86,31,47,112,131,75,117,57,140,69,3,162,
+12,74,87,254,129,107,121,64,7,85,2,98,118,148,3,208,182,1,98,1,147,24,163,
+70,233,111,16,254,153,254,231,159,154,2,101,144,130,18,118,252,207,26,59,
+48,121,193,35,43,65,77,86,99,98,108,125,93,82,58,30,84,138,45,4,24,75,4,92,
+250,136,104,176,35,26,71,86,96,75,80,105,2,58,43,55,58,119,122,2,53,107,90,
+75,15,66,141,105,52,50,9,51,109,87,5,38,118,135,254,205,254,215,107,107,239,
+224,58,69,19,3,143,177,107,253,234,102,74,35,157,126,34,89,73,79,97,142,125,
+95,174,62,61,105,22,126,87,72,145,0,0,2,0,75,255,232,8,154,7,86,0,91,0,104,
+0,0,5,35,39,17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,
+21,20,2,6,35,34,38,38,53,17,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,
+6,35,34,38,38,53,52,54,51,50,22,23,17,33,46,2,35,33,34,46,2,53,52,55,23,7,
+20,22,23,38,53,52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,33,50,
+22,23,7,177,8,103,252,104,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,
+150,246,137,78,112,59,105,191,118,108,131,91,1,86,66,75,82,100,91,79,141,
+87,179,139,113,190,131,2,123,9,31,72,70,254,158,92,141,85,45,7,85,2,81,101,
+7,208,182,1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,1,19,
+180,154,17,24,75,4,92,253,4,102,77,32,127,192,94,34,89,73,79,97,142,125,116,
+254,243,184,56,125,118,1,152,169,144,112,92,131,29,21,66,78,83,71,80,90,87,
+166,114,153,198,163,219,1,112,58,60,28,33,69,111,101,52,50,9,51,96,97,11,
+21,32,118,135,254,208,254,212,107,107,241,222,58,69,20,21,128,167,0,0,2,0,
+75,255,84,8,121,7,86,0,123,0,136,0,0,5,35,39,17,33,17,20,22,22,51,50,54,55,
+6,35,34,38,53,52,54,51,50,22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,38,53,
+52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,22,23,38,53,53,6,35,34,38,38,
+53,53,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,
+54,51,50,22,23,17,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,54,
+51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,7,144,8,103,252,
+136,26,59,48,106,177,32,43,65,77,86,97,98,110,126,72,8,103,47,78,62,29,100,
+118,50,136,150,21,88,12,94,97,24,86,15,81,38,61,83,62,40,8,121,166,75,117,
+57,104,192,117,108,131,91,1,86,66,75,82,100,91,79,141,87,179,139,113,189,
+131,2,53,9,31,72,70,254,196,92,141,85,45,7,85,2,81,101,7,208,182,1,94,1,121,
+24,163,70,233,111,16,254,179,254,235,159,154,7,237,180,154,17,24,75,4,92,
+254,8,102,74,35,150,113,34,89,73,79,97,138,119,130,105,253,69,74,80,48,12,
+14,176,164,90,86,20,60,60,93,108,8,1,9,43,82,75,95,117,207,83,58,119,122,
+150,168,143,112,92,131,29,21,66,78,83,71,80,90,87,166,114,153,198,162,219,
+1,111,58,60,28,33,69,111,101,52,50,9,51,96,97,11,21,32,118,135,254,208,254,
+212,107,107,241,222,58,69,20,21,128,167,0,0,2,255,197,255,232,8,115,7,86,
+0,81,0,94,0,0,5,35,39,17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,
+51,50,22,21,20,2,6,35,34,38,38,53,53,2,39,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,17,33,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,54,
+51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,7,138,8,103,252,
+103,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,112,59,
+125,215,16,93,89,100,118,146,124,161,231,62,252,247,69,5,172,9,31,72,70,254,
+188,92,141,85,45,7,85,2,81,101,7,208,182,1,94,1,121,24,163,70,233,111,16,
+254,179,254,235,159,154,7,245,180,154,17,24,75,4,92,253,4,102,77,32,127,192,
+94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,120,1,20,23,38,44,86,
+95,122,99,106,125,200,145,2,20,107,58,60,28,33,69,111,101,52,50,9,51,96,97,
+11,21,32,118,135,254,208,254,212,107,107,241,222,58,69,20,21,128,167,0,0,
+2,255,197,255,84,8,40,7,86,0,111,0,124,0,0,5,35,39,17,33,17,20,22,22,51,50,
+54,55,6,35,34,38,53,52,54,51,50,22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,22,23,38,53,53,6,35,34,
+38,39,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,33,39,33,46,2,35,
+33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,54,51,32,0,19,51,23,35,39,38,36,
+33,34,6,21,20,23,51,50,22,23,7,63,8,103,252,146,26,59,48,106,177,32,43,65,
+77,86,97,98,110,126,72,8,103,47,78,62,28,106,122,51,136,150,21,88,12,94,97,
+24,90,16,86,38,61,83,62,40,8,121,166,108,128,10,120,203,16,93,89,100,118,
+146,124,148,220,66,253,23,69,5,89,9,31,72,70,254,196,92,141,85,45,7,85,2,
+81,101,7,208,182,1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,
+7,237,180,154,17,24,75,4,92,254,8,102,74,35,150,113,34,89,73,79,97,138,119,
+130,105,253,69,74,80,48,12,14,176,164,90,86,20,60,60,93,108,8,1,9,43,82,75,
+95,117,207,83,108,116,243,21,38,44,86,95,122,99,106,125,172,130,1,203,107,
+58,60,28,33,69,111,101,52,50,9,51,96,97,11,21,32,118,135,254,208,254,212,
+107,107,241,222,58,69,20,21,128,167,0,3,0,34,255,232,9,73,7,86,0,82,0,95,
+0,107,0,0,5,35,39,17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,51,
+50,22,21,20,2,6,35,34,38,38,53,17,38,39,1,39,54,54,53,52,38,35,34,7,39,54,
+54,51,50,22,23,17,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,54,
+51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,1,38,38,35,34,6,
+7,54,51,50,22,23,8,96,8,103,252,103,28,58,47,79,156,119,25,43,65,77,86,99,
+98,108,125,150,246,137,78,112,59,38,40,254,0,127,70,58,55,44,72,63,144,146,
+220,140,113,203,145,2,96,9,31,72,70,254,186,92,141,85,45,7,85,2,81,101,7,
+208,182,1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,247,180,
+154,17,252,149,61,122,71,103,148,94,29,42,93,124,3,24,75,4,92,253,4,102,77,
+32,127,192,94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,1,116,64,
+57,254,46,127,62,87,49,54,53,42,143,206,150,176,240,1,146,58,60,28,33,69,
+111,101,52,50,9,51,96,97,11,21,32,118,135,254,208,254,212,107,107,241,222,
+58,69,20,21,128,167,254,232,68,64,87,116,9,118,94,0,2,255,197,255,37,8,64,
+7,86,0,102,0,115,0,0,5,35,39,17,33,4,23,23,6,7,22,4,23,17,51,22,4,21,20,6,
+35,34,38,53,52,54,51,50,22,23,53,52,38,39,17,20,22,22,51,50,54,55,7,34,38,
+53,52,54,51,50,22,21,20,6,35,34,38,38,53,53,46,2,39,39,54,55,46,2,35,39,35,
+39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,54,51,32,0,19,51,
+23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,7,87,8,103,249,242,1,20,122,40,
+184,157,130,1,12,95,111,225,1,11,89,94,71,85,69,63,47,63,12,175,233,26,59,
+48,78,117,36,30,70,78,90,89,90,115,244,188,75,117,57,95,189,185,146,79,204,
+174,56,116,113,92,66,38,69,5,113,9,31,72,70,254,196,92,141,85,45,7,85,2,81,
+101,7,208,182,1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,237,
+180,154,17,24,75,4,92,110,158,96,93,96,19,123,113,2,199,26,191,168,111,132,
+83,66,62,81,44,35,20,105,95,11,252,249,102,74,35,77,67,2,81,66,71,88,118,
+91,156,202,58,119,122,194,80,85,36,15,212,130,88,39,36,8,164,107,58,60,28,
+33,69,111,101,52,50,9,51,96,97,11,21,32,118,135,254,208,254,212,107,107,241,
+222,58,69,20,21,128,167,0,0,2,255,196,255,232,9,3,7,86,0,103,0,116,0,0,5,
+35,39,17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,
+2,6,35,34,38,38,53,17,38,35,34,6,21,39,38,35,34,6,21,20,23,53,52,54,51,50,
+22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,23,17,33,39,33,46,
+2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,52,54,51,32,0,19,51,23,35,39,
+38,36,33,34,6,21,20,23,51,50,22,23,8,26,8,103,252,103,28,58,47,79,156,119,
+25,43,65,77,86,99,98,108,125,150,246,137,78,112,59,72,74,47,63,41,57,185,
+86,106,63,76,63,67,82,87,74,123,165,143,113,80,125,35,14,73,53,59,93,41,252,
+102,69,6,63,9,31,72,70,254,186,92,141,85,45,7,85,2,81,101,7,208,182,1,94,
+1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,247,180,154,17,24,75,
+4,92,253,4,102,77,32,127,192,94,34,89,73,79,97,142,125,116,254,243,184,56,
+125,118,1,58,101,81,71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,142,128,
+167,78,64,69,69,96,85,1,130,107,58,60,28,33,69,111,101,52,50,9,51,96,97,11,
+21,32,118,135,254,208,254,212,107,107,241,222,58,69,20,21,128,167,0,2,255,
+196,255,84,8,217,7,86,0,135,0,148,0,0,5,35,39,17,33,17,20,22,22,51,50,54,
+55,6,35,34,38,53,52,54,51,50,22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,38,
+53,52,55,23,6,21,20,22,51,50,54,55,54,51,50,22,22,23,38,53,53,6,35,34,38,
+38,53,53,38,35,34,6,21,39,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,
+34,38,53,52,54,51,50,22,23,54,54,51,50,22,23,17,33,39,33,46,2,35,33,34,46,
+2,53,52,55,23,7,20,22,23,38,53,52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,
+21,20,23,51,50,22,23,7,240,8,103,252,146,26,59,48,106,177,32,43,65,77,86,
+97,98,110,126,72,8,103,47,78,62,28,106,122,51,136,150,21,88,12,94,97,24,90,
+16,86,38,61,83,62,40,8,121,166,75,117,57,72,74,47,63,41,57,185,86,106,63,
+76,63,67,82,87,74,123,165,143,113,80,125,35,14,73,53,59,93,41,252,101,69,
+6,11,9,31,72,70,254,196,92,141,85,45,7,85,2,81,101,7,208,182,1,94,1,121,24,
+163,70,233,111,16,254,179,254,235,159,154,7,237,180,154,17,24,75,4,92,254,
+8,102,74,35,150,113,34,89,73,79,97,138,119,130,105,253,69,74,80,48,12,14,
+176,164,90,86,20,60,60,93,108,8,1,9,43,82,75,95,117,207,83,58,119,122,84,
+101,81,71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,142,128,167,78,64,69,
+69,96,85,1,100,107,58,60,28,33,69,111,101,52,50,9,51,96,97,11,21,32,118,135,
+254,208,254,212,107,107,241,222,58,69,20,21,128,167,0,0,4,255,82,255,232,
+5,185,7,86,0,79,0,92,0,100,0,108,0,0,5,35,39,17,33,22,22,21,20,14,2,7,14,
+2,21,20,22,51,50,54,55,38,38,53,52,54,51,50,22,21,20,6,6,35,34,38,38,53,52,
+54,54,55,38,38,53,52,55,35,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,
+38,53,52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,33,50,22,23,3,54,
+53,52,38,35,34,7,7,6,21,20,22,51,50,55,4,208,8,103,254,74,77,91,35,86,120,
+82,101,120,82,77,72,80,148,49,50,68,79,62,72,91,119,179,89,120,162,77,96,
+137,95,148,193,32,100,69,3,10,9,31,72,70,254,164,92,141,85,45,7,85,2,81,101,
+7,208,182,1,94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,1,13,
+180,154,17,136,26,138,95,77,56,52,30,140,102,80,50,24,75,4,92,52,139,78,55,
+100,90,75,42,53,78,110,72,51,71,54,50,2,62,53,58,71,97,75,96,133,65,95,142,
+70,97,142,90,44,41,213,126,72,50,107,58,60,28,33,69,111,101,52,50,9,51,96,
+97,11,21,32,118,135,254,208,254,212,107,107,241,222,58,69,20,21,128,167,254,
+72,46,71,84,129,35,52,47,63,94,127,34,0,0,4,255,197,254,117,6,82,7,86,0,108,
+0,121,0,129,0,137,0,0,5,35,39,17,33,22,22,21,20,7,6,7,14,2,21,20,22,51,50,
+54,55,38,38,53,52,54,51,50,22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,38,53,
+52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,6,35,34,38,53,52,
+54,55,38,38,53,52,55,35,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,
+53,52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,33,50,22,23,3,54,53,
+52,38,35,34,7,7,6,21,20,22,51,50,55,5,105,8,103,254,74,77,91,107,57,135,105,
+128,89,103,75,69,121,38,45,58,79,62,72,91,78,8,103,47,78,62,38,74,94,51,136,
+150,21,88,12,94,97,23,81,65,35,61,83,62,40,8,85,107,173,192,146,123,126,156,
+32,253,69,3,163,9,31,72,70,254,164,92,141,85,45,7,85,2,81,101,7,208,182,1,
+94,1,121,24,163,70,233,111,16,254,179,254,235,159,154,7,1,13,180,154,17,136,
+26,138,95,77,56,52,30,140,102,80,50,24,75,4,92,52,139,78,140,66,36,53,42,
+64,95,64,72,75,59,51,6,62,48,58,71,97,75,116,78,253,193,74,80,48,12,14,176,
+164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,124,35,163,149,110,140,48,50,
+198,112,72,50,107,58,60,28,33,69,111,101,52,50,9,51,96,97,11,21,32,118,135,
+254,208,254,212,107,107,241,222,58,69,20,21,128,167,254,72,46,71,84,129,35,
+52,47,63,94,127,34,0,3,255,197,255,232,9,1,7,86,0,90,0,103,0,114,0,0,5,35,
+39,17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,
+6,35,34,38,38,53,17,38,38,35,34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,55,
+38,38,35,34,7,39,35,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,
+52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,5,33,22,22,
+23,54,54,51,50,22,23,8,24,8,103,252,103,28,58,47,79,156,119,25,43,65,77,86,
+99,98,108,125,150,246,137,78,112,59,49,59,29,31,43,57,42,67,119,86,81,140,
+65,74,40,71,55,62,89,48,10,133,139,43,54,64,47,69,6,58,9,31,72,70,254,188,
+92,141,85,45,7,85,2,81,101,7,208,182,1,94,1,121,24,163,70,233,111,16,254,
+179,254,235,159,154,7,245,180,154,17,253,72,253,133,117,139,10,37,83,44,60,
+97,48,24,75,4,92,253,4,102,77,32,127,192,94,34,89,73,79,97,142,125,116,254,
+243,184,56,125,118,1,8,68,47,26,93,99,158,119,132,153,34,75,67,116,125,181,
+162,10,160,107,58,60,28,33,69,111,101,52,50,9,51,96,97,11,21,32,118,135,254,
+208,254,212,107,107,241,222,58,69,20,21,128,167,107,26,181,159,80,47,97,81,
+0,0,3,255,197,255,84,8,213,7,86,0,121,0,134,0,145,0,0,5,35,39,17,33,17,20,
+22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,7,17,35,39,38,38,35,
+34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,
+6,35,34,38,38,53,53,38,38,35,34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,55,
+38,38,35,34,7,39,35,39,33,46,2,35,33,34,46,2,53,52,55,23,7,20,22,23,38,53,
+52,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,23,51,50,22,23,5,33,22,22,
+23,54,54,51,50,22,23,7,236,8,103,252,146,26,59,48,106,177,32,43,65,77,86,
+97,98,110,126,72,8,103,47,78,62,35,77,94,51,136,150,12,90,5,94,97,32,72,72,
+28,61,83,62,40,8,121,166,75,117,57,48,59,29,31,43,57,42,67,119,86,81,140,
+65,74,40,71,55,62,89,48,10,133,139,43,54,64,47,69,6,6,9,31,72,70,254,196,
+92,141,85,45,7,85,2,81,101,7,208,182,1,94,1,121,24,163,70,233,111,16,254,
+179,254,235,159,154,7,237,180,154,17,253,123,253,134,117,139,10,37,83,44,
+60,98,46,24,75,4,92,254,8,102,74,35,150,113,34,89,73,79,97,138,119,130,105,
+253,69,74,80,48,11,13,176,164,64,69,17,43,37,93,108,8,8,43,82,75,95,117,207,
+83,58,119,122,5,67,47,26,93,99,158,119,132,153,34,75,67,116,125,181,162,10,
+160,107,58,60,28,33,69,111,101,52,50,9,51,96,97,11,21,32,118,135,254,208,
+254,212,107,107,241,222,58,69,20,21,128,167,107,26,181,159,80,47,96,80,0,
+0,4,255,197,255,232,6,79,8,39,0,45,0,59,0,68,0,84,0,0,5,35,39,17,33,34,39,
+22,18,21,20,6,35,32,3,54,54,53,52,39,33,39,33,38,39,38,53,52,55,38,53,52,
+54,55,23,6,6,7,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,51,51,50,22,
+22,23,35,46,2,35,35,39,22,23,19,6,7,22,22,51,50,54,53,52,2,39,22,22,21,20,
+5,102,8,103,253,241,61,48,210,168,238,208,254,110,118,236,218,47,254,68,69,
+1,213,37,59,173,37,29,70,89,124,71,68,4,128,178,1,110,1,158,7,163,70,233,
+111,9,254,150,254,227,153,230,129,213,128,141,71,11,90,9,31,70,72,146,77,
+49,40,12,88,194,29,145,116,153,164,132,182,39,39,24,75,4,92,4,233,254,169,
+165,202,228,1,249,47,231,151,120,113,107,49,100,39,126,55,46,65,71,73,129,
+60,135,45,86,51,58,254,221,254,249,107,107,215,198,50,47,51,43,113,109,57,
+54,22,2,86,49,253,32,110,77,112,132,190,170,163,1,41,221,95,143,88,174,0,
+5,255,197,254,251,5,188,8,39,0,55,0,70,0,79,0,94,0,100,0,0,5,35,39,17,33,
+34,39,22,22,21,20,7,17,35,39,38,38,39,39,54,55,38,3,62,2,53,52,39,33,39,33,
+38,39,38,38,53,52,55,38,53,52,54,55,23,6,6,7,54,51,32,0,19,51,23,35,39,38,
+36,33,34,6,21,20,22,51,51,50,22,22,23,35,46,2,35,35,39,22,23,19,6,7,22,51,
+50,54,53,52,38,39,22,22,21,20,19,6,7,22,22,23,4,211,8,103,254,50,61,48,186,
+122,110,4,102,86,249,126,67,91,137,222,58,118,142,84,37,254,150,69,1,131,
+75,27,103,89,35,27,70,89,124,67,68,6,107,157,1,110,1,158,7,163,70,233,111,
+9,254,150,254,227,147,196,63,66,173,128,141,71,11,90,9,31,70,72,125,37,30,
+63,22,68,124,49,177,118,93,106,138,34,34,113,181,114,84,169,42,24,75,4,92,
+4,206,230,115,164,80,253,131,74,105,104,4,199,51,59,77,1,87,19,48,98,86,77,
+84,107,100,46,21,84,63,59,47,64,67,73,129,60,135,43,81,48,48,254,221,254,
+249,107,107,215,198,49,48,27,24,43,113,109,57,54,22,1,57,77,253,201,68,34,
+185,141,96,109,219,163,80,115,57,120,254,8,72,50,33,128,63,0,4,255,197,255,
+44,6,14,8,39,0,81,0,96,0,105,0,120,0,0,5,35,39,17,33,34,39,22,22,21,20,7,
+17,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,
+22,22,23,38,53,53,6,35,34,38,39,62,2,53,52,39,33,39,33,38,39,38,38,53,52,
+55,38,53,52,54,55,23,6,6,7,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,
+22,51,51,50,22,22,23,35,46,2,35,35,39,22,23,19,6,7,22,51,50,54,53,52,38,39,
+22,22,21,20,5,37,8,103,254,50,61,48,186,122,75,8,103,47,72,58,29,78,90,50,
+136,150,21,88,12,94,97,18,81,61,34,61,77,55,43,8,73,95,179,224,39,118,142,
+84,37,254,68,69,1,213,75,27,103,89,35,27,70,89,124,67,68,6,107,157,1,110,
+1,158,7,163,70,233,111,9,254,150,254,227,147,196,63,66,173,128,141,71,11,
+90,9,31,70,72,125,37,30,63,23,68,125,47,179,118,93,106,138,34,34,24,75,4,
+92,4,206,230,115,135,83,253,154,74,83,45,12,14,176,164,90,86,20,60,60,93,
+108,9,9,43,78,79,95,117,159,28,211,244,19,48,98,86,77,84,107,100,46,21,84,
+63,59,47,64,67,73,129,60,135,43,81,48,48,254,221,254,249,107,107,215,198,
+49,48,27,24,43,113,109,57,54,22,1,57,77,253,201,68,35,194,149,98,109,219,
+163,80,115,57,120,0,4,0,52,255,232,7,140,8,39,0,73,0,87,0,96,0,112,0,0,5,
+35,39,17,33,34,39,22,18,21,20,6,35,32,3,54,54,55,38,38,35,34,6,21,20,22,23,
+39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,55,52,38,39,38,
+39,38,53,52,55,38,53,52,54,55,23,6,6,7,54,51,32,0,19,51,23,35,39,38,36,33,
+34,6,21,20,51,51,50,22,22,23,35,46,2,35,35,39,22,23,19,6,7,22,22,51,50,54,
+53,52,2,39,22,22,21,20,6,163,8,103,253,241,61,48,210,168,238,208,254,110,
+118,182,212,38,106,193,124,101,121,52,39,1,86,66,75,82,100,91,79,141,87,179,
+139,115,194,137,2,38,24,112,24,162,37,29,70,89,124,71,68,4,128,178,1,110,
+1,158,7,163,70,233,111,9,254,150,254,227,153,230,129,213,128,141,71,11,90,
+9,31,70,72,146,82,33,61,12,88,194,29,145,116,153,164,132,182,39,39,24,75,
+4,92,4,233,254,169,165,202,228,1,249,36,156,106,165,135,104,90,58,76,14,19,
+66,78,83,71,80,90,82,161,114,151,190,171,232,39,59,173,57,159,43,44,119,55,
+46,65,71,73,129,60,135,45,86,51,58,254,221,254,249,107,107,215,198,50,47,
+51,43,113,109,57,54,22,2,61,74,253,32,110,77,112,132,190,170,163,1,41,221,
+95,143,88,174,0,4,255,197,255,232,7,119,8,39,0,62,0,76,0,85,0,101,0,0,5,35,
+39,17,33,34,39,22,18,21,20,6,35,32,3,54,55,38,39,22,21,20,6,35,34,38,53,52,
+54,51,50,22,23,54,53,52,39,33,39,33,38,39,38,53,52,55,38,53,52,54,55,23,6,
+6,7,54,51,32,0,19,51,23,35,39,38,36,33,34,6,21,20,51,51,50,22,22,23,35,46,
+2,35,35,39,22,23,19,6,7,22,22,51,50,54,53,52,2,39,22,22,21,20,6,142,8,103,
+253,241,61,48,210,168,238,208,254,110,118,211,115,109,164,10,87,83,93,110,
+128,120,126,238,77,75,47,253,28,69,2,253,73,32,164,37,29,70,89,124,71,68,
+4,128,178,1,110,1,158,7,163,70,233,111,9,254,150,254,227,153,230,129,213,
+128,141,71,11,90,9,31,70,72,146,82,29,65,12,88,194,29,145,116,153,164,132,
+182,39,39,24,75,4,92,4,233,254,169,165,202,228,1,249,43,102,165,20,30,33,
+80,89,113,93,97,119,170,148,98,129,120,113,107,94,57,41,122,55,46,65,71,73,
+129,60,135,45,86,51,58,254,221,254,249,107,107,215,198,50,47,51,43,113,109,
+57,54,22,2,56,79,253,32,110,77,112,132,190,170,163,1,41,221,95,143,88,174,
+0,0,6,255,197,255,232,6,219,8,39,0,48,0,62,0,71,0,79,0,95,0,104,0,0,5,35,
+39,17,33,34,39,22,18,21,20,6,35,32,3,54,55,46,2,53,52,55,35,39,33,38,39,38,
+53,52,55,38,53,52,54,55,23,6,6,7,54,51,32,0,19,51,23,35,39,38,36,33,34,6,
+21,20,51,51,50,22,22,23,35,46,2,35,35,39,22,23,3,54,53,52,39,35,34,7,1,6,
+7,22,22,51,50,54,53,52,2,39,22,22,21,20,39,1,6,21,20,22,51,50,55,5,242,8,
+103,253,242,61,48,210,168,238,208,254,110,118,212,115,114,203,124,30,94,69,
+2,98,73,32,165,37,29,70,89,124,71,68,4,128,178,1,110,1,158,7,163,70,233,111,
+9,254,150,254,227,153,230,129,213,128,141,71,11,90,9,31,70,72,146,80,26,67,
+26,8,47,133,77,56,1,87,88,193,29,144,116,153,164,132,182,39,39,152,254,180,
+30,140,102,68,51,24,75,4,92,4,233,254,169,165,202,228,1,249,43,102,8,112,
+177,101,70,49,107,94,57,40,123,55,46,65,71,73,129,60,135,45,86,51,58,254,
+221,254,249,107,107,215,198,50,47,51,43,113,109,57,54,22,2,52,83,254,90,43,
+39,120,113,35,253,174,110,76,113,132,190,170,163,1,41,221,95,143,88,174,128,
+1,48,46,64,94,127,25,0,1,0,25,255,240,5,64,4,251,0,70,0,0,1,38,38,35,34,6,
+7,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,7,39,54,54,51,50,22,23,54,
+55,22,22,21,20,7,22,21,20,6,35,32,0,3,55,0,33,50,54,53,52,39,6,35,34,38,53,
+52,54,51,50,23,54,53,52,38,39,6,7,3,146,86,156,92,57,98,50,59,70,110,139,
+153,122,118,131,152,55,54,124,119,144,105,188,110,96,151,85,126,58,115,153,
+58,68,251,210,254,197,254,88,119,78,1,14,1,253,168,194,38,77,94,69,90,85,
+72,59,49,88,47,34,98,131,3,110,123,108,46,53,18,125,95,103,196,69,191,39,
+106,63,40,45,88,147,154,138,105,118,144,77,38,219,132,137,108,95,129,197,
+234,1,170,1,120,35,253,126,132,116,72,46,71,71,72,65,78,18,84,130,51,90,30,
+123,126,0,1,255,196,254,57,6,120,4,250,0,117,0,0,1,38,38,35,34,6,7,54,51,
+50,22,21,20,6,7,39,54,54,53,52,35,34,7,39,54,54,51,50,23,53,38,35,34,6,21,
+39,38,38,35,34,6,21,20,22,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,
+51,50,22,23,54,51,50,22,23,17,33,39,33,23,33,17,22,23,54,55,22,22,21,20,7,
+22,21,20,6,35,34,0,3,55,22,4,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,
+23,54,53,52,39,6,7,4,173,74,133,76,44,74,39,39,53,92,120,131,102,101,114,
+126,92,114,112,118,95,165,97,35,28,81,89,50,65,42,33,116,92,89,104,46,34,
+78,58,71,85,94,86,124,165,147,118,83,110,44,31,117,57,92,59,252,83,70,6,110,
+70,253,173,44,53,73,55,96,131,51,59,216,173,247,254,179,119,77,104,1,63,197,
+152,144,26,63,77,59,76,72,61,48,43,69,58,70,89,1,16,105,96,35,39,11,110,82,
+87,172,58,177,34,80,52,73,90,116,144,127,7,140,139,88,92,15,88,78,87,83,53,
+72,16,14,62,74,78,75,70,83,185,143,145,178,88,78,161,93,109,1,47,107,107,
+253,147,38,74,92,86,31,188,110,120,91,81,114,147,185,1,60,1,58,36,247,237,
+101,80,50,34,57,61,60,56,66,16,63,109,77,56,104,91,0,1,255,196,255,240,5,
+138,5,8,0,81,0,0,1,46,2,35,34,6,7,22,22,21,20,6,35,34,38,39,6,35,34,38,53,
+52,54,55,38,38,35,35,39,33,50,22,23,54,54,51,50,22,23,54,55,22,22,21,20,7,
+22,21,20,6,6,35,32,0,3,55,18,0,33,50,54,53,52,39,6,35,34,38,53,52,54,51,50,
+23,54,53,52,38,39,6,7,3,220,40,56,77,42,36,52,27,91,93,71,61,60,87,17,35,
+129,58,75,96,99,62,74,55,243,70,1,52,82,105,85,60,92,61,79,111,48,113,56,
+115,153,56,66,116,234,171,254,209,254,96,135,85,117,1,130,1,11,193,227,34,
+76,99,69,90,85,72,59,49,88,47,34,98,131,3,110,81,98,75,42,38,47,128,73,63,
+78,74,75,145,77,64,70,140,50,65,34,107,54,98,89,77,112,107,130,74,38,219,
+132,135,107,89,128,123,200,118,1,134,1,163,36,254,192,254,182,140,118,71,
+42,76,71,72,65,78,17,82,131,51,90,30,123,126,0,2,255,197,255,128,4,121,4,
+250,0,3,0,56,0,0,1,33,39,33,3,38,36,37,39,22,51,50,54,54,53,52,38,39,6,7,
+35,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,23,54,55,22,22,21,16,5,22,23,4,121,251,145,69,4,111,75,202,254,166,
+254,253,41,155,174,94,182,125,41,31,76,79,5,53,132,93,87,85,62,3,80,56,63,
+82,96,80,117,160,145,115,87,120,50,41,77,115,143,254,176,224,188,4,143,107,
+250,134,175,153,29,198,51,65,162,135,63,103,31,140,102,102,99,92,70,81,34,
+41,60,66,84,66,70,83,185,131,125,167,119,98,69,147,41,219,141,254,154,85,
+100,205,0,1,255,196,255,35,4,246,4,250,0,88,0,0,1,33,22,21,20,7,22,22,21,
+20,7,22,21,20,6,35,32,0,3,55,18,18,22,51,50,54,53,52,39,6,35,34,38,53,52,
+54,51,50,23,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,54,55,39,38,
+38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,38,
+39,33,39,33,4,246,254,159,81,52,83,90,30,60,207,177,254,232,254,138,96,85,
+77,204,236,147,127,158,22,80,107,74,82,85,72,73,60,40,95,82,185,131,51,60,
+91,75,76,97,162,131,58,41,61,39,19,85,78,78,95,99,96,56,94,71,47,76,83,43,
+63,73,34,27,252,223,69,4,237,4,143,110,134,104,68,34,141,92,84,74,78,120,
+161,188,1,140,1,172,26,254,255,254,224,110,95,88,42,27,84,77,67,65,79,22,
+55,70,69,68,129,7,79,58,75,81,101,90,107,170,41,62,47,52,10,40,41,76,91,102,
+80,89,118,33,49,39,63,36,75,76,51,92,31,107,0,0,2,255,196,255,65,5,94,4,250,
+0,75,0,84,0,0,1,33,22,21,20,7,22,22,21,20,7,22,21,20,6,35,32,0,3,55,18,18,
+22,51,50,54,53,52,39,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,7,22,
+22,21,20,6,35,34,38,53,52,54,55,38,39,6,6,35,34,38,39,55,22,22,51,50,54,55,
+33,39,33,5,22,22,51,50,54,53,52,39,5,94,254,149,71,44,82,88,30,60,207,177,
+254,232,254,138,96,85,77,204,236,147,127,158,22,80,107,74,82,85,72,73,60,
+40,95,82,185,131,51,60,91,75,76,97,165,133,55,34,33,119,83,81,143,55,71,38,
+74,47,82,73,18,254,42,70,5,84,253,95,11,103,89,59,62,45,4,143,116,116,95,
+60,35,139,92,84,74,78,120,161,188,1,140,1,172,26,254,255,254,224,110,95,88,
+42,27,84,77,67,65,79,22,55,70,69,68,129,7,79,58,75,81,101,90,108,171,41,59,
+103,103,121,126,130,37,75,70,161,138,107,107,145,163,72,64,95,77,0,3,255,
+197,255,232,6,42,4,250,0,42,0,48,0,60,0,0,5,35,39,38,36,39,39,54,36,55,53,
+33,39,33,23,33,17,22,22,51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,
+21,20,6,35,34,38,39,3,6,6,7,4,19,5,20,6,35,34,38,53,52,54,51,50,22,3,112,
+4,103,113,254,200,212,84,176,1,80,206,253,8,69,6,31,70,253,70,57,134,89,89,
+101,53,1,79,62,75,90,90,85,130,154,148,129,84,149,59,110,148,245,124,1,78,
+183,254,208,74,52,54,76,75,55,53,73,24,74,187,216,28,231,120,169,75,91,107,
+107,254,30,88,96,104,82,99,41,64,79,85,71,74,91,197,169,155,178,119,101,1,
+103,55,126,87,112,254,187,55,56,70,72,54,55,72,72,0,0,1,0,106,255,231,6,211,
+5,159,0,96,0,0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,51,50,
+55,54,51,50,22,23,38,53,17,38,38,35,34,6,7,54,51,50,22,21,20,6,7,39,62,2,
+53,52,38,35,34,7,39,54,54,51,50,22,23,38,53,17,51,23,21,33,23,33,17,22,22,
+51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,4,25,
+8,103,52,83,72,54,99,104,43,157,166,13,93,9,228,37,86,79,45,83,112,71,8,111,
+162,107,59,97,49,63,72,111,135,130,175,122,120,126,75,59,53,138,133,139,110,
+195,117,108,176,135,9,8,101,2,119,69,253,70,57,134,89,89,101,53,1,79,62,75,
+90,90,85,130,154,148,129,84,149,59,25,74,78,50,15,14,177,166,57,81,13,46,
+43,204,10,11,79,121,95,117,1,210,170,130,39,49,18,122,99,98,165,112,185,41,
+56,72,50,43,45,106,137,167,142,141,211,78,133,1,36,71,94,107,254,30,88,96,
+104,82,99,41,64,79,85,71,74,91,197,169,155,178,119,101,0,2,255,197,255,184,
+6,195,4,250,0,3,0,86,0,0,1,33,39,33,1,35,39,38,38,35,34,7,6,35,32,17,52,55,
+23,6,21,20,22,51,50,55,54,51,50,22,23,38,53,17,52,38,38,35,34,6,7,54,51,50,
+22,21,20,6,35,34,38,53,52,54,54,51,50,22,22,21,21,22,22,51,50,54,53,52,39,
+6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,195,249,71,69,6,185,
+253,139,8,103,52,83,72,54,99,104,43,254,179,26,89,20,121,119,37,86,79,45,
+79,115,72,8,26,53,45,94,171,34,37,68,75,82,101,95,97,120,114,203,128,76,109,
+55,57,134,89,89,101,53,1,79,62,75,90,90,85,130,154,148,129,84,149,59,4,143,
+107,250,190,74,78,50,15,14,1,146,113,107,21,85,80,131,117,10,11,86,127,95,
+117,1,190,98,81,31,156,114,43,89,65,77,94,132,111,111,193,116,58,129,119,
+115,88,96,104,82,99,41,64,79,85,71,74,91,197,169,155,178,119,101,0,1,0,91,
+255,134,6,205,5,159,0,109,0,0,5,35,39,46,2,35,34,7,6,6,35,34,38,38,53,52,
+55,23,6,21,20,22,51,50,55,54,54,51,50,22,22,23,38,53,53,38,36,39,39,22,51,
+50,54,53,52,38,35,34,7,22,22,21,20,6,6,35,34,38,53,52,54,54,51,50,22,22,21,
+20,7,22,22,23,17,51,23,21,33,23,33,17,22,22,51,50,54,53,52,38,39,6,6,35,34,
+38,53,52,54,51,50,22,22,21,20,6,6,35,34,38,39,4,19,8,104,28,42,60,47,66,106,
+12,113,53,95,141,77,21,88,12,115,109,55,81,8,96,51,61,77,55,43,8,74,254,149,
+216,82,11,29,215,207,102,93,37,45,31,33,34,66,46,70,91,60,123,89,90,158,98,
+224,118,213,68,8,102,2,119,69,253,70,57,134,89,89,101,27,26,1,79,62,75,90,
+90,85,82,129,73,64,124,89,84,149,59,122,74,49,52,27,13,1,12,79,152,109,90,
+86,20,60,60,92,109,9,1,8,43,78,79,95,117,49,105,98,8,229,1,109,107,80,94,
+13,22,65,35,36,62,38,89,78,66,109,66,84,164,114,215,73,25,101,80,3,253,71,
+94,107,254,30,88,96,104,82,48,72,20,64,79,85,71,74,91,85,165,116,99,150,84,
+119,101,0,1,255,196,255,231,6,233,4,250,0,76,0,0,5,38,38,35,34,7,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,23,38,53,52,55,4,7,39,17,33,39,
+33,23,33,17,20,7,54,37,23,6,7,22,22,51,50,54,53,52,39,6,6,35,34,38,53,52,
+54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,23,3,250,41,85,71,61,150,147,76,
+144,162,27,91,21,101,99,63,137,108,49,119,70,46,53,254,232,245,100,254,216,
+70,6,223,70,250,184,4,181,1,96,180,53,27,61,144,99,89,101,53,1,79,62,75,90,
+90,85,130,154,148,129,105,179,59,18,46,52,25,70,58,25,27,176,164,119,110,
+17,105,55,113,104,24,20,66,151,145,158,145,172,220,66,2,178,107,107,254,132,
+74,45,158,194,163,87,76,106,117,104,82,99,41,64,79,85,71,74,91,197,169,155,
+178,181,144,76,93,115,198,111,0,0,2,0,75,255,161,6,148,5,15,0,90,0,96,0,0,
+5,35,39,38,38,35,34,6,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,22,23,38,53,53,38,36,35,39,54,55,38,38,53,52,54,51,50,22,21,20,6,35,34,
+38,39,6,21,20,22,23,54,55,53,33,23,33,17,22,22,51,50,54,53,52,39,6,6,35,34,
+38,53,52,54,51,50,22,21,20,6,35,34,38,39,3,4,7,22,4,23,3,218,8,103,52,83,
+72,40,92,10,85,50,157,159,13,93,9,100,121,44,67,90,23,83,112,71,8,111,254,
+187,186,79,99,109,62,80,138,100,90,91,65,53,49,68,1,78,70,76,170,215,2,227,
+69,253,70,57,134,89,89,101,53,1,79,62,75,90,90,85,130,154,148,129,84,149,
+59,110,254,141,120,139,1,7,89,95,74,78,50,12,1,13,173,167,57,81,13,46,43,
+96,105,9,9,79,121,95,117,64,88,92,204,58,58,32,114,78,93,128,82,67,54,62,
+53,55,26,80,47,68,12,84,92,193,107,254,30,88,96,104,82,99,41,64,79,85,71,
+74,91,197,169,155,178,119,101,1,111,164,65,23,112,91,0,0,2,255,196,255,233,
+6,73,4,250,0,69,0,75,0,0,5,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,
+20,22,51,50,55,55,50,22,22,23,38,53,53,38,37,39,36,37,53,33,39,33,23,33,17,
+22,22,51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,
+3,6,7,22,22,23,3,144,8,102,27,36,58,46,45,95,117,33,140,143,21,88,12,88,106,
+42,90,99,55,75,57,39,9,207,254,194,84,1,18,1,79,252,233,70,6,64,69,253,71,
+57,134,89,89,101,53,1,79,62,75,90,90,85,130,154,148,129,84,149,59,111,241,
+180,107,254,60,23,74,49,48,31,13,13,173,167,90,86,20,60,60,96,105,10,8,42,
+81,77,107,105,63,162,34,242,154,110,44,107,107,254,30,88,96,104,82,99,41,
+64,79,85,71,74,91,197,169,155,178,119,101,1,150,94,91,25,139,66,0,0,2,255,
+197,255,233,6,70,4,250,0,3,0,81,0,0,1,33,39,33,1,35,39,46,2,35,34,7,6,35,
+34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,22,22,23,38,53,17,52,39,6,6,35,
+34,38,53,52,54,51,50,22,21,20,7,54,54,55,22,22,23,22,51,50,54,53,52,39,6,
+6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,39,6,70,249,196,69,6,60,253,180,
+8,102,27,36,58,46,45,95,117,33,140,143,21,88,12,88,106,42,90,99,55,75,57,
+39,9,65,84,150,98,95,120,81,68,59,76,10,44,109,82,78,120,13,103,140,89,101,
+53,1,79,62,75,90,90,85,130,154,148,129,137,115,4,143,107,250,239,74,49,48,
+31,13,13,173,167,90,86,20,60,60,96,105,10,8,42,81,77,107,105,1,2,117,78,92,
+74,108,87,63,85,76,63,32,21,26,113,102,76,195,129,136,104,82,99,41,64,79,
+85,71,74,91,197,169,155,178,162,0,0,1,255,196,255,231,7,24,5,159,0,105,0,
+0,5,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,22,22,23,38,53,17,38,38,35,34,6,7,22,22,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,55,38,38,35,35,39,33,50,22,23,54,54,51,50,22,23,39,17,51,23,21,
+33,23,33,17,22,22,51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,21,20,
+6,35,34,38,39,4,94,8,102,47,72,58,58,254,77,51,143,160,21,88,12,106,108,59,
+119,162,41,61,77,55,43,8,69,104,61,40,58,32,105,107,75,65,64,93,17,17,92,
+67,62,77,115,127,58,102,71,228,70,1,37,79,112,90,63,92,60,79,136,66,2,8,100,
+2,118,70,253,70,57,134,89,89,101,53,1,79,62,75,90,90,85,130,154,148,129,84,
+149,59,25,74,83,45,20,6,176,164,90,86,20,60,60,93,108,9,9,43,78,79,95,117,
+2,59,110,94,51,48,57,142,77,73,71,79,79,75,83,78,66,79,163,59,59,51,107,59,
+102,92,83,126,120,139,1,2,71,94,107,254,30,88,96,104,82,99,41,64,79,85,71,
+74,91,197,169,155,178,119,101,0,2,255,196,255,233,6,150,4,250,0,84,0,93,0,
+0,5,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,22,
+22,23,38,53,17,38,39,6,6,35,34,38,39,55,22,22,51,50,54,54,55,33,39,33,23,
+33,22,21,20,6,7,21,22,22,51,50,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,
+21,20,6,35,34,38,39,1,22,22,51,50,54,53,52,39,3,170,8,102,27,36,58,46,45,
+95,117,33,140,143,21,88,12,88,106,42,90,99,55,75,57,39,8,175,77,33,120,87,
+81,143,55,71,38,74,47,61,71,34,11,254,58,70,6,140,70,253,73,71,68,56,67,152,
+110,89,101,53,1,79,62,75,90,90,85,130,154,148,129,104,177,60,254,185,11,103,
+89,59,62,45,23,74,49,48,31,13,13,173,167,90,86,20,60,60,96,105,10,8,42,81,
+77,95,117,1,86,12,218,111,129,126,130,37,75,70,94,138,97,107,107,116,116,
+86,108,24,87,129,140,104,82,99,41,64,79,85,71,74,91,197,169,155,178,177,143,
+2,169,145,163,72,64,95,77,0,2,255,196,255,232,6,122,4,250,0,94,0,103,0,0,
+5,35,39,53,38,35,34,21,39,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,
+34,38,38,53,52,54,51,50,23,54,54,51,50,22,23,17,38,39,6,6,35,34,38,39,55,
+22,22,51,50,54,54,55,33,39,33,23,33,22,21,20,6,7,21,22,22,51,50,54,53,52,
+39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,1,22,22,51,50,54,53,
+52,39,3,142,6,104,65,67,80,42,25,85,73,63,78,39,2,66,55,60,71,77,67,59,110,
+69,101,99,117,64,13,54,45,55,82,37,180,79,33,120,87,81,143,55,71,38,74,47,
+61,71,34,11,254,93,70,6,112,70,253,66,71,64,53,67,152,110,89,101,53,1,79,
+62,75,90,90,85,130,154,148,129,104,177,60,254,178,11,103,89,59,62,45,24,104,
+190,106,141,16,59,69,63,56,59,27,50,61,73,62,62,70,66,131,93,106,140,141,
+70,67,94,86,1,73,8,223,111,129,126,130,37,75,70,94,138,97,107,107,116,116,
+83,107,25,90,129,140,104,82,99,41,64,79,85,71,74,91,197,169,155,178,177,143,
+2,169,145,163,72,64,95,77,0,0,3,255,197,255,232,6,68,4,250,0,42,0,48,0,57,
+0,0,5,35,39,38,36,39,39,54,36,55,53,33,39,33,23,33,17,22,22,51,50,54,53,52,
+39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,39,53,6,7,22,23,7,38,
+38,39,6,7,22,4,23,3,137,4,103,118,254,193,225,84,175,1,100,212,252,239,69,
+6,57,70,253,69,56,135,90,89,101,53,2,78,62,75,90,90,85,130,154,148,129,85,
+150,58,110,128,108,144,94,2,74,181,119,88,81,164,1,30,93,24,74,192,209,30,
+231,119,176,75,85,107,107,254,31,88,97,104,82,99,41,65,78,85,71,74,91,197,
+169,155,178,119,103,183,185,46,51,104,141,139,112,152,48,49,57,50,225,164,
+0,0,3,255,196,255,232,5,184,4,250,0,31,0,38,0,50,0,0,37,38,53,52,55,6,7,17,
+35,39,38,36,39,39,54,36,55,53,33,39,33,23,33,17,54,55,23,6,6,21,20,23,1,6,
+6,7,22,4,23,5,20,6,35,34,38,53,52,54,51,50,22,4,153,72,32,127,130,4,103,113,
+254,200,212,84,176,1,80,206,253,8,70,5,174,70,253,184,164,152,149,59,58,40,
+254,14,148,245,124,156,1,11,94,254,208,74,52,54,76,75,55,53,73,135,191,182,
+122,92,70,77,253,169,74,187,216,28,231,120,169,75,91,107,107,254,124,94,72,
+136,87,175,107,135,143,2,211,55,126,87,53,218,164,73,56,70,72,54,55,72,72,
+0,0,1,0,106,255,231,6,96,5,159,0,85,0,0,37,38,53,52,55,6,7,17,35,39,38,38,
+35,34,7,6,35,34,38,53,52,55,23,6,21,20,51,50,55,54,51,50,22,23,38,53,17,38,
+38,35,34,6,7,54,51,50,22,21,20,6,7,39,62,2,53,52,38,35,34,7,39,54,54,51,50,
+22,23,38,53,17,51,23,21,33,23,33,17,54,55,23,6,6,21,20,23,5,66,72,32,127,
+130,8,103,52,83,72,54,99,104,43,157,166,13,93,9,228,37,86,79,45,83,112,71,
+8,111,162,107,59,97,49,63,72,111,135,130,175,122,120,126,75,59,53,138,133,
+139,110,195,117,108,176,135,9,8,101,2,4,69,253,185,164,152,149,59,58,40,135,
+191,182,122,92,70,77,253,168,74,78,50,15,14,177,166,57,81,13,46,43,204,10,
+11,79,121,95,117,1,210,170,130,39,49,18,122,99,98,165,112,185,41,56,72,50,
+43,45,106,137,167,142,141,211,78,133,1,36,71,94,107,254,124,94,72,136,87,
+175,107,135,143,0,0,1,0,91,255,134,6,90,5,159,0,97,0,0,37,38,53,52,55,6,7,
+17,35,39,46,2,35,34,7,6,6,35,34,38,38,53,52,55,23,6,21,20,22,51,50,55,54,
+54,51,50,22,22,23,38,53,53,38,36,39,39,22,51,50,54,53,52,38,35,34,7,22,22,
+21,20,6,6,35,34,38,53,52,54,54,51,50,22,22,21,20,7,22,22,23,17,51,23,21,33,
+23,33,17,54,54,55,23,6,6,21,20,22,23,5,60,72,32,127,130,8,104,28,42,60,47,
+66,106,12,113,53,95,141,77,21,88,12,115,109,55,81,8,96,51,61,77,55,43,8,74,
+254,149,216,82,11,29,215,207,102,93,37,45,31,33,34,66,46,70,91,60,123,89,
+90,158,98,224,118,213,68,8,102,2,4,69,253,185,82,139,95,149,59,58,19,21,135,
+191,182,122,92,70,77,253,71,74,49,52,27,13,1,12,79,152,109,90,86,20,60,60,
+92,109,9,1,8,43,78,79,95,117,49,105,98,8,229,1,109,107,80,94,13,22,65,35,
+36,62,38,89,78,66,109,66,84,164,114,215,73,25,101,80,3,253,71,94,107,254,
+124,47,74,45,136,87,175,107,73,130,75,0,1,255,196,255,231,6,90,4,250,0,64,
+0,0,37,38,53,52,55,6,7,7,20,22,23,7,38,38,35,34,7,6,35,34,38,53,52,55,23,
+6,21,20,22,51,50,55,54,51,50,23,38,53,52,55,4,7,39,17,33,39,33,23,33,17,20,
+7,54,37,23,6,7,54,55,23,6,6,21,20,23,5,52,72,32,132,156,3,46,52,81,41,85,
+71,61,150,147,76,144,162,27,91,21,101,99,63,137,108,49,119,70,46,53,254,232,
+245,100,254,216,70,6,80,70,251,71,4,181,1,96,180,34,24,129,154,149,59,58,
+40,85,191,182,122,92,73,92,75,115,198,111,33,70,58,25,27,176,164,119,110,
+17,105,55,113,104,24,20,66,151,145,158,145,172,220,66,2,178,107,107,254,132,
+74,45,158,194,163,54,55,74,73,136,87,175,107,135,143,0,2,0,75,255,161,6,33,
+5,15,0,79,0,85,0,0,37,38,53,52,55,6,7,17,35,39,38,38,35,34,6,7,6,35,34,38,
+53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,23,38,53,53,38,36,35,39,54,55,
+38,38,53,52,54,51,50,22,21,20,6,35,34,38,39,6,21,20,22,23,54,55,53,33,23,
+33,17,54,55,23,6,6,21,20,23,1,4,7,22,4,23,5,3,72,32,127,130,8,103,52,83,72,
+40,92,10,85,50,157,159,13,93,9,100,121,44,67,90,23,83,112,71,8,111,254,187,
+186,79,99,109,62,80,138,100,90,91,65,53,49,68,1,78,70,76,170,215,2,112,69,
+253,185,164,152,149,59,58,40,254,14,254,141,120,139,1,7,89,135,191,182,122,
+92,70,77,253,98,74,78,50,12,1,13,173,167,57,81,13,46,43,96,105,9,9,79,121,
+95,117,64,88,92,204,58,58,32,114,78,93,128,82,67,54,62,53,55,26,80,47,68,
+12,84,92,193,107,254,124,94,72,136,87,175,107,135,143,2,219,164,65,23,112,
+91,0,0,2,255,197,255,233,5,242,4,250,0,3,0,70,0,0,1,33,39,33,3,38,53,52,55,
+7,17,35,39,46,2,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,55,50,
+22,22,23,38,53,17,52,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,54,55,22,
+23,54,55,23,6,6,21,20,23,5,242,250,24,69,5,232,217,72,32,247,8,102,27,36,
+58,46,45,95,117,33,140,143,21,88,12,88,106,42,90,99,55,75,57,39,9,65,84,150,
+98,95,120,81,68,59,76,10,44,109,82,132,50,165,173,149,59,58,40,4,143,107,
+251,141,191,182,122,92,141,253,164,74,49,48,31,13,13,173,167,90,86,20,60,
+60,96,105,10,8,42,81,77,107,105,1,2,117,78,92,74,108,87,63,85,76,63,32,21,
+26,113,102,127,143,96,82,136,87,175,107,135,143,0,0,1,255,196,255,231,6,166,
+5,159,0,94,0,0,37,38,53,52,55,6,7,17,35,39,38,38,35,34,7,6,35,34,38,53,52,
+55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,17,38,38,35,34,6,7,22,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,38,38,35,35,39,33,50,22,23,54,
+54,51,50,22,23,39,17,51,23,21,33,23,33,17,54,55,23,6,6,21,20,23,5,135,72,
+32,127,130,8,102,47,72,58,58,254,77,51,143,160,21,88,12,106,108,59,119,162,
+41,61,77,55,43,8,69,104,61,40,58,32,105,107,75,65,64,93,17,17,92,67,62,77,
+115,127,58,102,71,228,70,1,37,79,114,88,63,92,60,79,136,66,2,8,100,2,4,70,
+253,184,164,152,149,59,58,40,135,191,182,122,92,70,77,253,168,74,83,45,20,
+6,176,164,90,86,20,60,60,93,108,9,9,43,78,79,95,117,2,59,110,94,51,48,57,
+142,77,73,71,79,79,75,83,78,66,79,163,59,59,51,107,57,104,92,83,126,120,139,
+1,2,71,94,107,254,124,94,72,136,87,175,107,135,143,0,0,2,255,196,255,233,
+5,240,4,250,0,71,0,80,0,0,37,38,53,52,55,6,7,17,35,39,46,2,35,34,7,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,55,55,50,22,22,23,38,53,17,38,39,6,6,35,34,
+38,39,55,22,22,51,50,54,54,55,33,39,33,23,33,22,21,20,7,54,55,23,6,6,21,20,
+23,1,22,22,51,50,54,53,52,39,4,210,72,32,124,132,8,102,27,36,58,46,45,95,
+117,33,140,143,21,88,12,88,106,42,90,99,55,75,57,39,8,173,78,33,120,87,81,
+143,55,71,38,74,47,61,71,34,11,254,57,70,5,230,70,253,240,71,37,91,136,149,
+59,58,40,253,55,11,103,89,59,62,45,95,191,182,122,92,68,78,253,209,74,49,
+48,31,13,13,173,167,90,86,20,60,60,96,105,10,8,42,81,77,95,117,1,86,11,219,
+111,129,126,130,37,75,70,94,138,97,107,107,116,116,88,58,52,64,136,87,175,
+107,135,143,4,21,145,163,72,64,95,77,0,3,255,196,255,232,5,208,4,250,0,31,
+0,37,0,46,0,0,37,38,53,52,55,6,7,17,35,39,38,36,39,39,54,36,55,53,33,39,33,
+23,33,17,54,55,23,6,6,21,20,23,1,53,6,7,22,23,7,38,38,39,6,7,22,4,23,4,178,
+72,32,127,130,4,103,118,254,193,225,84,175,1,100,212,252,239,70,5,198,70,
+253,185,149,167,149,59,58,40,254,14,128,108,144,94,2,74,181,119,88,81,164,
+1,30,93,135,191,182,122,92,70,77,253,169,74,192,209,30,231,119,176,75,85,
+107,107,254,125,85,80,136,87,175,107,135,143,2,37,185,46,51,104,141,139,112,
+152,48,49,57,50,225,164,0,1,255,196,255,172,5,138,4,250,0,54,0,0,37,38,53,
+52,55,7,6,7,22,23,7,38,36,37,39,22,51,50,54,53,52,38,35,34,7,21,20,6,35,34,
+38,53,52,54,55,38,39,35,39,33,23,33,22,23,22,22,23,54,55,23,6,6,21,20,23,
+4,108,72,32,248,39,240,215,194,62,206,254,168,254,255,41,155,174,166,186,
+114,122,31,27,80,101,73,94,125,103,47,101,173,70,5,129,69,251,205,46,30,167,
+211,36,138,180,149,59,58,40,135,191,182,122,92,142,200,77,108,211,68,194,
+164,29,198,51,130,115,91,111,4,16,95,103,90,72,82,100,13,78,53,107,107,48,
+79,4,142,116,81,86,136,87,175,107,135,143,0,0,2,255,197,255,232,6,20,7,86,
+0,62,0,69,0,0,5,35,39,17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,
+51,50,22,21,20,2,6,35,34,38,38,53,17,35,39,33,38,38,39,6,35,34,38,53,52,55,
+23,7,20,22,51,50,55,54,54,51,50,22,23,51,23,35,39,38,38,35,5,22,23,5,44,7,
+104,252,82,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,
+112,59,150,69,3,62,11,55,58,223,100,149,143,7,85,2,84,132,105,234,41,248,
+71,127,134,21,168,69,232,94,15,72,76,255,0,35,14,24,75,4,92,253,4,102,77,
+32,127,192,94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,3,27,107,
+81,103,5,9,168,154,52,50,9,51,103,85,9,1,8,169,205,107,107,105,96,6,61,134,
+0,0,3,255,197,255,101,5,226,7,86,0,68,0,76,0,82,0,0,5,35,39,17,33,17,20,22,
+22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,6,7,17,35,39,38,38,39,39,
+54,55,38,38,53,17,35,39,33,38,38,39,6,35,34,38,53,52,55,23,7,20,22,51,50,
+55,54,54,51,50,22,23,51,23,35,39,38,38,35,34,7,22,23,3,6,7,22,22,23,4,250,
+7,104,252,132,26,59,48,114,181,34,43,65,77,86,97,98,110,126,77,69,4,103,69,
+190,170,67,65,68,62,55,150,69,3,22,11,53,55,214,73,149,143,7,85,2,84,132,
+102,212,37,226,71,127,134,21,168,69,232,94,15,72,76,82,163,34,14,184,144,
+120,78,148,38,24,75,4,92,254,8,102,74,35,144,119,34,89,73,79,97,138,119,89,
+162,60,253,162,74,84,84,5,199,37,33,33,118,120,2,23,107,80,101,7,8,168,154,
+52,50,9,51,103,85,9,1,8,169,205,107,107,105,96,7,65,129,252,87,58,59,26,104,
+58,0,0,2,255,197,255,84,6,27,7,86,0,93,0,101,0,0,5,35,39,17,33,17,20,22,22,
+51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,7,17,35,39,38,38,35,34,7,6,
+35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,6,35,
+34,38,38,53,17,35,39,33,38,38,39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,
+54,54,51,50,22,23,51,23,35,39,38,38,35,34,7,22,23,5,51,7,104,252,146,26,59,
+48,106,177,32,43,65,77,86,97,98,110,126,72,8,103,47,78,62,29,78,90,50,136,
+150,21,88,12,94,97,18,81,61,34,61,83,62,40,8,121,166,75,117,57,221,69,3,79,
+11,53,55,214,74,149,143,7,85,2,84,132,103,212,35,227,72,127,134,21,168,69,
+232,94,15,72,76,82,163,34,14,24,75,4,92,254,8,102,74,35,150,113,34,89,73,
+79,97,138,119,130,105,253,69,74,80,48,12,14,176,164,90,86,20,60,60,93,108,
+9,9,43,82,75,95,117,207,83,58,119,122,2,23,107,80,101,7,8,168,154,52,50,9,
+51,103,85,9,1,8,169,205,107,107,105,96,7,65,129,0,0,3,255,197,255,232,6,159,
+7,86,0,94,0,102,0,109,0,0,5,35,39,17,33,21,22,22,21,20,6,35,34,38,53,52,54,
+51,50,22,23,52,38,39,21,20,6,6,7,14,2,21,20,22,51,50,54,55,38,38,53,52,54,
+51,50,22,21,20,6,6,35,34,38,53,52,54,54,55,38,38,39,39,36,55,53,33,39,33,
+38,38,39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,36,51,50,22,23,51,23,
+35,39,38,38,35,34,7,22,23,1,6,7,22,23,54,53,5,183,7,104,253,116,187,206,77,
+81,67,68,60,54,42,55,9,186,134,50,71,56,41,48,31,67,74,80,143,48,51,68,79,
+62,72,91,116,175,89,167,189,27,59,122,72,156,113,70,1,23,249,253,189,69,3,
+181,11,54,57,200,125,149,143,7,85,2,84,132,106,243,44,1,0,70,127,134,21,168,
+69,232,94,15,72,76,86,189,34,14,254,122,127,177,155,107,42,24,75,4,92,54,
+22,193,157,96,114,76,52,54,70,41,32,105,108,7,241,86,117,69,40,30,43,59,40,
+46,58,54,50,1,63,53,58,71,97,75,96,133,65,160,143,42,70,73,92,58,58,7,201,
+151,70,57,107,81,102,5,8,168,154,52,50,9,51,103,85,9,1,8,169,205,107,107,
+105,96,7,65,129,254,164,38,87,53,117,50,50,0,3,255,197,254,109,6,169,7,86,
+0,125,0,133,0,140,0,0,5,35,39,17,33,21,4,17,20,6,35,34,38,53,52,54,51,50,
+22,23,52,38,39,21,20,6,6,7,14,2,21,20,22,51,50,54,55,38,38,53,52,54,51,50,
+22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,
+55,54,51,50,22,22,23,38,53,53,6,35,34,38,53,52,54,54,55,38,38,39,39,36,55,
+53,33,39,33,38,38,39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,36,51,50,
+22,23,51,23,35,39,38,38,35,34,7,22,23,1,6,7,22,23,54,53,5,193,7,104,253,116,
+1,137,77,81,67,68,60,54,42,55,9,176,144,50,71,56,41,48,31,67,74,80,143,48,
+51,68,79,62,72,91,76,8,103,47,78,62,29,78,90,50,136,150,21,88,12,94,97,18,
+81,61,34,61,83,62,40,8,93,100,167,189,48,70,56,64,143,100,70,1,23,249,253,
+179,69,3,186,11,54,57,200,125,149,143,7,85,2,84,132,106,245,46,1,1,70,127,
+134,21,168,69,232,94,15,72,76,88,192,34,14,254,127,127,177,136,101,67,24,
+75,4,92,34,44,254,214,96,114,76,52,54,70,41,32,103,81,6,191,86,117,69,40,
+30,43,59,40,46,58,54,50,1,63,53,58,71,97,75,108,74,253,198,74,80,48,12,14,
+176,164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,116,39,160,143,55,89,66,
+42,45,47,6,201,151,70,37,107,81,102,5,8,168,154,52,50,9,51,103,85,9,1,8,169,
+205,107,107,105,96,7,65,129,254,184,38,87,47,97,63,61,0,2,255,197,255,112,
+6,173,7,86,0,79,0,87,0,0,5,35,39,17,33,17,20,22,22,51,50,54,55,6,35,34,38,
+53,52,54,51,50,22,21,20,7,22,21,20,6,35,34,0,3,55,22,4,51,50,54,53,52,39,
+6,6,35,34,38,38,53,17,33,39,33,38,38,39,6,35,34,38,53,52,55,23,7,20,22,51,
+50,55,54,36,51,50,22,23,51,23,35,39,38,38,35,34,5,22,23,5,197,7,104,252,59,
+26,59,48,121,193,35,43,65,77,86,99,98,108,125,73,97,203,194,211,254,204,123,
+84,109,1,13,165,140,161,51,70,188,107,75,117,57,254,232,69,3,165,11,51,54,
+186,115,149,143,7,85,2,84,132,106,243,44,1,0,70,127,134,21,168,69,232,94,
+15,72,76,49,255,0,34,14,24,75,4,92,253,234,102,74,35,157,126,34,89,73,79,
+97,142,125,119,106,120,167,176,198,1,34,1,53,38,230,212,127,108,90,66,65,
+74,58,119,122,2,53,107,79,100,9,8,168,154,52,50,9,51,103,85,9,1,8,169,205,
+107,107,105,96,8,63,130,0,0,2,0,75,255,232,8,163,7,86,0,89,0,96,0,0,5,35,
+39,17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,
+6,35,34,38,38,53,17,38,38,35,34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,
+38,38,53,52,54,51,50,22,23,17,33,38,38,39,6,35,34,38,53,52,55,23,7,20,22,
+51,50,55,54,54,51,50,22,23,51,23,35,39,38,38,35,7,22,23,7,187,7,104,252,94,
+28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,112,59,105,
+191,118,108,131,91,1,86,66,75,82,100,91,79,141,87,179,139,113,190,131,2,127,
+12,57,62,212,104,149,143,7,85,2,84,132,103,216,38,231,71,127,134,21,168,69,
+232,94,15,72,76,216,35,14,24,75,4,92,253,4,102,77,32,127,192,94,34,89,73,
+79,97,142,125,116,254,243,184,56,125,118,1,152,169,144,112,92,131,29,21,66,
+78,83,71,80,90,87,166,114,153,198,163,219,1,112,85,102,2,9,168,154,52,50,
+9,51,103,85,9,1,8,169,205,107,107,105,96,5,65,131,0,0,2,0,75,255,84,8,120,
+7,86,0,120,0,128,0,0,5,35,39,17,33,17,20,22,22,51,50,54,55,6,35,34,38,53,
+52,54,51,50,22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,
+20,22,51,50,54,55,54,51,50,22,22,23,38,53,53,6,35,34,38,38,53,53,38,38,35,
+34,6,21,20,23,39,52,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,
+17,33,38,38,39,5,34,38,53,52,55,23,7,20,22,51,50,55,54,54,51,50,22,23,51,
+23,35,39,38,38,35,34,7,22,23,7,144,7,104,252,136,26,59,48,106,177,32,43,65,
+77,86,97,98,110,126,72,8,103,47,78,62,29,100,118,50,136,150,21,88,12,94,97,
+24,86,15,81,38,61,83,62,40,8,121,166,75,117,57,104,192,117,108,131,91,1,86,
+66,75,82,100,91,79,141,87,179,139,113,189,131,2,45,11,52,55,254,224,149,143,
+7,85,2,84,132,103,216,37,231,71,127,134,21,168,69,232,94,15,72,76,85,170,
+34,14,24,75,4,92,254,8,102,74,35,150,113,34,89,73,79,97,138,119,130,105,253,
+69,74,80,48,12,14,176,164,90,86,20,60,60,93,108,8,1,9,43,82,75,95,117,207,
+83,58,119,122,150,168,143,112,92,131,29,21,66,78,83,71,80,90,87,166,114,153,
+198,162,219,1,111,79,102,7,8,168,154,52,50,9,51,103,85,9,1,8,169,205,107,
+107,105,96,7,65,129,0,0,2,255,197,255,232,8,124,7,86,0,79,0,86,0,0,5,35,39,
+17,33,17,20,22,22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,
+34,38,38,53,53,2,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,17,33,39,33,
+38,38,39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,54,51,50,22,23,51,23,
+35,39,38,38,35,7,22,23,7,148,7,104,252,93,28,58,47,79,156,119,25,43,65,77,
+86,99,98,108,125,150,246,137,78,112,59,125,215,16,93,89,100,118,146,124,161,
+231,62,252,247,69,5,176,12,55,58,220,100,149,143,7,85,2,84,132,104,229,40,
+243,71,127,134,21,168,69,232,94,15,72,76,246,35,14,24,75,4,92,253,4,102,77,
+32,127,192,94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,120,1,20,
+23,38,44,86,95,122,99,106,125,200,145,2,20,107,83,101,5,9,168,154,52,50,9,
+51,103,85,9,1,8,169,205,107,107,105,96,6,63,132,0,2,255,197,255,84,8,39,7,
+86,0,108,0,116,0,0,5,35,39,17,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,
+54,51,50,22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,
+22,51,50,54,55,54,51,50,22,22,23,38,53,53,6,35,34,38,39,38,39,22,21,20,6,
+35,34,38,53,52,54,51,50,22,23,17,33,39,33,38,38,39,6,35,34,38,53,52,55,23,
+7,20,22,51,50,55,36,51,50,22,23,51,23,35,39,38,38,35,7,7,22,23,7,63,7,104,
+252,146,26,59,48,106,177,32,43,65,77,86,97,98,110,126,72,8,103,47,78,62,28,
+106,122,51,136,150,21,88,12,94,97,24,90,16,86,38,61,83,62,40,8,121,166,108,
+128,10,120,203,16,93,89,100,118,146,124,148,220,66,253,23,69,5,91,11,53,57,
+210,76,149,143,7,85,2,84,132,102,203,1,32,36,144,139,19,168,69,232,94,16,
+84,83,205,21,35,14,24,75,4,92,254,8,102,74,35,150,113,34,89,73,79,97,138,
+119,130,105,253,69,74,80,48,12,14,176,164,90,86,20,60,60,93,108,8,1,9,43,
+82,75,95,117,207,83,108,116,243,21,38,44,86,95,122,99,106,125,172,130,1,203,
+107,80,102,6,8,168,154,52,50,9,51,103,85,9,9,186,188,107,107,115,86,5,1,63,
+132,0,3,0,34,255,232,9,72,7,86,0,80,0,88,0,100,0,0,5,35,39,17,33,17,20,22,
+22,51,50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,
+38,39,1,39,54,54,53,52,38,35,34,7,39,54,54,51,50,22,23,17,33,38,38,39,6,35,
+34,38,53,52,55,23,7,20,22,51,50,55,54,54,51,50,22,23,51,23,35,39,38,38,35,
+34,7,22,23,1,38,38,35,34,6,7,54,51,50,22,23,8,96,7,104,252,103,28,58,47,79,
+156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,112,59,38,40,254,0,127,
+70,58,55,44,72,63,144,146,220,140,113,203,145,2,98,12,55,60,218,102,149,143,
+7,85,2,84,132,104,225,41,239,70,127,134,21,168,69,232,94,15,72,76,80,156,
+35,14,252,148,61,122,71,103,148,94,29,42,93,124,3,24,75,4,92,253,4,102,77,
+32,127,192,94,34,89,73,79,97,142,125,116,254,243,184,56,125,118,1,116,64,
+57,254,46,127,62,87,49,54,53,42,143,206,150,176,240,1,146,84,102,3,9,168,
+154,52,50,9,51,103,85,9,1,8,169,205,107,107,105,96,6,63,132,254,232,68,64,
+87,116,9,118,94,0,0,2,255,197,255,37,8,63,7,86,0,100,0,108,0,0,5,35,39,17,
+33,4,23,23,6,7,22,4,23,17,51,22,4,21,20,6,35,34,38,53,52,54,51,50,22,23,53,
+52,38,39,17,20,22,22,51,50,54,55,7,34,38,53,52,54,51,50,22,21,20,6,35,34,
+38,38,53,53,46,2,39,39,54,55,46,2,35,39,35,39,33,38,38,39,6,35,34,38,53,52,
+55,23,7,20,22,51,50,55,54,54,51,50,22,23,51,23,35,39,38,38,35,34,7,22,23,
+7,87,7,104,249,242,1,20,122,40,184,157,130,1,12,95,111,225,1,11,89,94,71,
+85,69,63,47,63,12,175,233,26,59,48,78,117,36,30,70,78,90,89,90,115,244,188,
+75,117,57,95,189,185,146,79,204,174,56,116,113,92,66,38,69,5,105,11,51,55,
+208,72,149,143,7,85,2,84,132,103,212,35,227,72,127,134,21,168,69,232,94,15,
+72,76,85,170,34,14,24,75,4,92,110,158,96,93,96,19,123,113,2,199,26,191,168,
+111,132,83,66,62,81,44,35,20,105,95,11,252,249,102,74,35,77,67,2,81,66,71,
+88,118,91,156,202,58,119,122,194,80,85,36,15,212,130,88,39,36,8,164,107,79,
+101,8,8,168,154,52,50,9,51,103,85,9,1,8,169,205,107,107,105,96,7,65,129,0,
+2,255,196,255,232,9,12,7,86,0,101,0,108,0,0,5,35,39,17,33,17,20,22,22,51,
+50,54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,38,35,
+34,6,21,39,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,
+51,50,22,23,54,54,51,50,22,23,17,33,39,33,38,38,39,6,35,34,38,53,52,55,23,
+7,20,22,51,50,55,54,54,51,50,22,23,51,23,35,39,38,38,35,7,22,23,8,36,7,104,
+252,93,28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,112,
+59,73,75,47,63,41,57,185,86,106,63,76,63,67,82,87,74,123,165,143,113,80,125,
+35,14,73,53,60,94,41,252,102,69,6,65,12,55,59,220,101,149,143,7,85,2,84,132,
+104,230,41,243,71,127,134,21,168,69,232,94,15,72,76,246,35,14,24,75,4,92,
+253,4,102,77,32,127,192,94,34,89,73,79,97,142,125,116,254,243,184,56,125,
+118,1,55,104,81,71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,142,128,167,
+78,64,69,69,98,87,1,134,107,83,102,4,9,168,154,52,50,9,51,103,85,9,1,8,169,
+205,107,107,105,96,6,63,132,0,0,2,255,196,255,84,8,216,7,86,0,133,0,141,0,
+0,5,35,39,17,33,17,20,22,22,51,50,54,55,6,35,34,38,53,52,54,51,50,22,21,20,
+7,17,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,54,55,54,
+51,50,22,22,23,38,53,53,6,35,34,38,38,53,53,38,35,34,6,21,39,38,35,34,6,21,
+20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,
+22,23,17,33,39,33,38,38,39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,54,
+51,50,22,23,51,23,35,39,38,38,35,34,7,22,23,7,240,7,104,252,146,26,59,48,
+106,177,32,43,65,77,86,97,98,110,126,72,8,103,47,78,62,28,106,122,51,136,
+150,21,88,12,94,97,24,90,16,86,38,61,83,62,40,8,121,166,75,117,57,72,75,47,
+63,41,57,185,86,106,63,76,63,67,82,87,74,123,165,143,113,80,125,35,14,73,
+53,60,93,41,252,101,69,6,3,11,51,55,208,72,149,143,7,85,2,84,132,103,212,
+35,227,72,127,134,21,168,69,232,94,15,72,76,85,170,34,14,24,75,4,92,254,8,
+102,74,35,150,113,34,89,73,79,97,138,119,130,105,253,69,74,80,48,12,14,176,
+164,90,86,20,60,60,93,108,8,1,9,43,82,75,95,117,207,83,58,119,122,82,103,
+81,71,15,140,82,74,90,35,5,54,73,87,65,65,83,188,142,128,167,78,64,69,69,
+97,86,1,102,107,79,101,8,8,168,154,52,50,9,51,103,85,9,1,8,169,205,107,107,
+105,96,7,65,129,0,4,255,197,255,232,5,186,7,86,0,77,0,84,0,92,0,100,0,0,5,
+35,39,17,33,22,22,21,20,14,2,7,14,2,21,20,22,51,50,54,55,38,38,53,52,54,51,
+50,22,21,20,6,6,35,34,38,38,53,52,54,54,55,38,38,53,52,55,35,39,33,38,38,
+39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,54,51,50,22,23,51,23,35,39,
+38,38,35,7,22,23,3,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,4,210,7,104,
+254,72,77,91,35,86,120,82,101,120,82,77,72,80,148,49,50,68,79,62,72,91,119,
+179,89,120,162,77,96,137,95,148,193,32,100,69,3,12,12,56,60,207,102,149,143,
+7,85,2,84,132,103,212,35,227,72,127,134,21,168,69,232,94,15,72,76,216,36,
+13,137,26,138,95,77,56,52,30,140,102,80,50,24,75,4,92,52,139,78,55,100,90,
+75,42,53,78,110,72,51,71,54,50,2,62,53,58,71,97,75,96,133,65,95,142,70,97,
+142,90,44,41,213,126,72,50,107,83,103,3,9,168,154,52,50,9,51,103,85,9,1,8,
+169,205,107,107,105,96,5,67,129,254,72,46,71,84,129,35,52,47,63,94,127,34,
+0,0,4,255,197,254,117,6,81,7,86,0,106,0,113,0,121,0,129,0,0,5,35,39,17,33,
+22,22,21,20,7,6,7,14,2,21,20,22,51,50,54,55,38,38,53,52,54,51,50,22,21,20,
+7,17,35,39,38,38,35,34,7,6,35,34,38,53,52,55,23,6,21,20,22,51,50,55,54,51,
+50,22,22,23,38,53,53,6,35,34,38,53,52,54,55,38,38,53,52,55,35,39,33,38,38,
+39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,54,51,50,22,23,51,23,35,39,
+38,38,35,7,22,23,3,54,53,52,38,35,34,7,7,6,21,20,22,51,50,55,5,105,7,104,
+254,74,77,91,107,57,135,105,128,89,103,75,69,121,38,45,58,79,62,72,91,78,
+8,103,47,78,62,38,74,94,51,136,150,21,88,12,94,97,23,81,65,35,61,83,62,40,
+8,85,107,173,192,146,123,126,156,32,253,69,3,163,12,56,60,205,102,149,143,
+7,85,2,84,132,102,212,36,225,72,127,134,21,168,69,232,94,15,72,76,216,36,
+13,135,26,138,95,77,56,52,30,140,102,80,50,24,75,4,92,52,139,78,140,66,36,
+53,42,64,95,64,72,75,59,51,6,62,48,58,71,97,75,116,78,253,193,74,80,48,12,
+14,176,164,90,86,20,60,60,93,108,9,9,43,82,75,95,117,124,35,163,149,110,140,
+48,50,198,112,72,50,107,83,103,3,9,168,154,52,50,9,51,103,85,9,1,8,169,205,
+107,107,105,96,5,67,129,254,72,46,71,84,129,35,52,47,63,94,127,34,0,3,255,
+197,255,232,9,0,7,86,0,88,0,96,0,107,0,0,5,35,39,17,33,17,20,22,22,51,50,
+54,54,55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,38,38,35,
+34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,55,38,38,35,34,7,39,35,39,33,38,
+38,39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,54,51,50,22,23,51,23,35,
+39,38,38,35,34,7,22,23,5,33,22,22,23,54,54,51,50,22,23,8,24,7,104,252,103,
+28,58,47,79,156,119,25,43,65,77,86,99,98,108,125,150,246,137,78,112,59,49,
+59,29,31,43,57,42,67,119,86,81,140,65,74,40,71,55,62,89,48,10,133,139,43,
+54,64,47,69,6,62,12,55,60,218,102,149,143,7,85,2,84,132,104,225,41,239,70,
+127,134,21,168,69,232,94,15,72,76,80,156,35,14,253,69,253,133,117,139,10,
+37,83,44,60,97,48,24,75,4,92,253,4,102,77,32,127,192,94,34,89,73,79,97,142,
+125,116,254,243,184,56,125,118,1,8,68,47,26,93,99,158,119,132,153,34,75,67,
+116,125,181,162,10,160,107,84,102,3,9,168,154,52,50,9,51,103,85,9,1,8,169,
+205,107,107,105,96,6,63,132,107,26,181,159,80,47,97,81,0,3,255,197,255,84,
+8,212,7,86,0,119,0,127,0,138,0,0,5,35,39,17,33,17,20,22,22,51,50,54,55,6,
+35,34,38,53,52,54,51,50,22,21,20,7,17,35,39,38,38,35,34,7,6,35,34,38,53,52,
+55,23,6,21,20,22,51,50,55,54,51,50,22,22,23,38,53,53,6,35,34,38,38,53,53,
+38,38,35,34,6,6,7,6,6,35,34,38,39,55,22,22,51,50,54,55,38,38,35,34,7,39,35,
+39,33,38,38,39,6,35,34,38,53,52,55,23,7,20,22,51,50,55,54,54,51,50,22,23,
+51,23,35,39,38,38,35,34,7,22,23,5,33,22,22,23,54,54,51,50,22,23,7,236,7,104,
+252,146,26,59,48,106,177,32,43,65,77,86,97,98,110,126,72,8,103,47,78,62,35,
+77,94,51,136,150,12,90,5,94,97,32,72,72,28,61,83,62,40,8,121,166,75,117,57,
+48,59,29,31,43,57,42,67,119,86,81,140,65,74,40,71,55,62,89,48,10,133,139,
+43,54,64,47,69,6,8,11,53,55,214,74,149,143,7,85,2,84,132,103,212,35,227,72,
+127,134,21,168,69,232,94,15,72,76,82,163,34,14,253,122,253,134,117,139,10,
+37,83,44,60,98,46,24,75,4,92,254,8,102,74,35,150,113,34,89,73,79,97,138,119,
+130,105,253,69,74,80,48,11,13,176,164,64,69,17,43,37,93,108,8,8,43,82,75,
+95,117,207,83,58,119,122,5,67,47,26,93,99,158,119,132,153,34,75,67,116,125,
+181,162,10,160,107,80,101,7,8,168,154,52,50,9,51,103,85,9,1,8,169,205,107,
+107,105,96,7,65,129,107,26,181,159,80,47,96,80,0,1,0,83,0,0,2,200,4,250,0,
+25,0,0,1,35,0,17,20,22,23,38,53,52,54,51,50,22,21,20,6,35,34,38,2,53,52,18,
+55,51,2,200,135,254,127,75,91,6,83,64,72,90,98,88,106,180,106,174,166,218,
+4,143,254,249,254,135,129,181,63,20,23,66,76,96,75,73,95,150,1,8,164,213,
+1,95,132,0,0,1,255,25,0,0,2,200,7,86,0,50,0,0,1,35,0,17,20,22,23,38,53,52,
+54,51,50,22,21,20,6,35,34,38,2,53,52,18,55,51,38,38,35,34,7,6,35,34,38,53,
+52,55,23,7,20,22,51,50,55,54,51,50,22,23,51,2,200,135,254,127,75,91,6,83,
+64,72,90,98,88,106,180,106,174,166,84,15,72,76,37,76,102,68,149,143,7,85,
+2,84,132,53,80,72,34,127,134,21,45,4,143,254,249,254,135,129,181,63,20,23,
+66,76,96,75,73,95,150,1,8,164,213,1,95,132,105,96,9,12,168,154,52,50,9,51,
+103,85,10,8,169,205,0,1,255,196,255,232,3,227,7,86,0,27,0,0,5,35,39,17,35,
+39,51,38,39,54,54,51,50,22,23,7,38,38,35,34,6,6,7,22,23,51,23,35,1,28,7,104,
+163,70,229,111,55,137,237,148,113,227,130,40,106,193,100,95,146,98,48,44,
+58,176,70,233,24,75,4,92,107,103,64,251,186,110,100,66,68,55,96,136,90,63,
+66,107,255,255,255,197,255,135,5,45,4,250,2,38,0,44,0,0,0,7,0,72,3,65,1,4,
+0,2,255,197,255,86,4,144,4,250,0,33,0,45,0,0,1,33,17,20,22,22,51,50,54,54,
+55,6,35,34,38,53,52,54,51,50,22,21,20,2,6,35,34,38,38,53,17,35,39,33,1,20,
+6,35,34,38,53,52,54,51,50,22,4,144,252,218,28,58,47,79,156,119,25,43,65,77,
+86,99,98,108,125,150,246,137,78,112,59,241,69,4,134,252,216,74,52,54,76,75,
+55,53,73,4,143,253,4,102,77,32,127,192,94,34,89,73,79,97,142,125,116,254,
+243,184,56,125,118,3,27,107,250,218,56,70,72,54,55,72,72,0,0,3,253,169,5,
+64,1,52,7,170,0,11,0,25,0,29,0,0,3,20,6,35,34,38,53,52,54,51,50,22,23,6,6,
+35,34,38,39,55,22,22,51,50,54,55,5,1,39,1,247,51,36,39,52,52,39,36,51,179,
+16,137,113,113,136,16,65,17,99,84,84,99,17,1,186,254,48,107,2,17,7,82,40,
+47,47,40,40,48,49,80,140,146,145,141,24,74,103,103,74,61,254,60,125,1,120,
+0,0,3,255,196,255,232,6,116,7,170,0,11,0,39,0,53,0,0,1,20,6,35,34,38,53,52,
+54,51,50,22,1,35,39,17,35,39,51,38,39,54,54,51,50,22,22,23,7,38,36,35,34,
+6,7,22,23,51,23,35,1,6,6,35,34,38,39,55,22,22,51,50,54,55,5,193,51,36,39,
+52,52,39,36,51,251,91,7,104,163,70,229,111,55,131,247,154,123,245,233,146,
+49,238,254,228,145,137,187,73,44,58,176,70,233,5,88,16,137,113,113,136,16,
+65,17,99,84,84,99,17,7,82,40,47,47,40,40,48,49,248,111,75,4,92,107,103,64,
+241,196,115,187,141,54,196,148,184,138,63,66,107,2,154,140,146,145,141,24,
+74,103,103,74,0,0,1,255,196,255,232,5,148,7,133,0,29,0,0,5,35,39,17,35,39,
+51,38,39,54,54,51,50,5,1,23,1,39,55,38,38,35,34,6,7,22,23,51,23,35,1,28,7,
+104,163,70,229,111,55,131,247,154,223,1,9,1,107,42,254,48,107,77,106,171,
+91,137,187,73,44,58,176,70,233,24,75,4,92,107,103,64,241,196,211,1,2,49,254,
+60,125,55,66,55,184,138,63,66,107,0,0,3,252,67,255,232,2,190,7,170,0,11,0,
+49,0,63,0,0,1,20,6,35,34,38,53,52,54,51,50,22,3,35,39,17,35,39,51,2,33,34,
+6,21,20,22,51,51,50,22,23,35,46,2,35,35,34,38,38,53,52,54,51,32,0,19,51,23,
+35,1,6,6,35,34,38,39,55,22,22,51,50,54,55,2,11,51,36,39,52,52,39,36,51,239,
+8,103,163,70,233,30,253,142,183,200,56,73,213,182,154,16,90,9,31,72,71,106,
+163,160,83,250,204,1,103,1,149,23,163,70,233,1,162,16,137,113,113,136,16,
+65,17,99,84,84,99,17,7,82,40,47,47,40,40,48,49,248,111,75,4,92,107,1,207,
+57,53,28,30,132,168,60,61,27,40,92,76,114,139,254,216,254,204,107,2,154,140,
+146,145,141,24,74,103,103,74,0,0,1,252,67,255,232,2,5,7,131,0,46,0,0,5,35,
+39,17,35,39,51,38,39,7,39,55,38,33,34,6,21,20,22,51,51,50,22,23,35,46,2,35,
+35,34,38,38,53,52,54,51,32,23,37,23,7,22,23,51,23,35,1,28,8,103,163,70,233,
+10,87,126,107,127,162,254,221,183,200,56,73,213,182,154,16,90,9,31,72,71,
+106,163,160,83,250,204,1,127,198,1,38,42,252,106,16,163,70,233,24,75,4,92,
+107,163,108,123,125,90,100,57,53,28,30,132,168,60,61,27,40,92,76,114,139,
+164,209,49,246,140,214,107,0,2,252,67,255,232,2,32,8,39,0,11,0,73,0,0,19,
+20,6,35,34,38,53,52,54,51,50,22,19,35,39,17,35,39,51,38,39,7,39,55,38,33,
+34,6,21,20,22,51,51,50,22,23,35,46,2,35,35,34,38,38,53,52,54,51,50,23,38,
+39,55,22,22,51,50,54,55,23,6,6,7,22,23,37,23,1,22,23,51,23,35,182,51,36,39,
+52,52,39,36,51,102,8,103,163,70,233,5,15,73,107,115,151,254,92,183,200,56,
+73,213,182,154,16,90,9,31,72,71,106,163,160,83,250,204,209,156,23,9,65,17,
+99,84,84,99,17,66,15,123,101,33,29,1,62,42,254,210,33,9,163,70,233,7,207,
+40,47,47,40,40,48,49,247,242,75,4,92,107,69,50,71,125,82,208,57,53,28,30,
+132,168,60,61,27,40,92,76,114,139,49,52,78,24,74,103,103,74,24,132,145,8,
+35,42,226,49,254,218,91,115,107,0,2,0,211,255,242,1,213,5,182,0,3,0,11,0,
+0,1,35,3,51,19,20,35,34,53,52,51,50,1,131,94,72,238,10,129,129,129,129,1,
+156,4,26,250,199,139,139,139,0,0,2,0,117,3,213,2,207,5,182,0,3,0,7,0,0,1,
+35,3,51,1,35,3,51,1,16,94,61,217,1,67,94,61,217,3,213,1,225,254,31,1,225,
+0,2,0,51,0,0,4,70,5,182,0,27,0,31,0,0,33,35,19,33,3,35,19,35,53,51,19,35,
+53,51,19,51,3,33,19,51,3,51,21,35,3,51,21,33,39,19,33,3,2,180,123,78,254,
+227,77,123,78,189,211,78,223,245,74,125,76,1,29,76,123,76,201,224,75,233,
+254,254,98,76,254,227,76,1,160,254,96,1,160,121,1,145,121,1,147,254,109,1,
+147,254,109,121,254,111,121,121,1,145,254,111,0,5,0,92,255,236,6,207,5,203,
+0,12,0,16,0,28,0,41,0,53,0,0,1,6,35,34,38,53,52,54,51,50,22,21,20,3,35,1,
+51,1,50,54,53,52,38,35,34,6,21,20,22,1,6,35,34,38,53,52,54,51,50,22,21,20,
+5,50,54,53,52,38,35,34,6,21,20,22,2,166,85,165,170,166,166,172,164,170,148,
+135,2,219,134,252,106,81,69,68,80,82,72,72,5,29,85,165,171,165,165,173,164,
+170,254,176,81,68,67,80,82,72,72,2,183,122,243,214,214,239,242,211,212,252,
+206,5,182,252,219,188,185,183,184,186,181,184,189,253,213,122,242,214,215,
+238,242,211,211,162,187,186,183,184,186,181,184,189,0,1,0,117,3,213,1,78,
+5,182,0,3,0,0,1,35,3,51,1,16,94,61,217,3,213,1,225,0,0,1,0,117,254,250,2,
+131,6,20,0,15,0,0,1,36,2,17,16,18,37,21,6,6,2,21,20,18,22,23,2,131,254,233,
+247,245,1,25,132,138,43,43,138,132,254,250,111,1,169,1,119,1,118,1,165,112,
+92,80,250,254,220,193,192,254,218,251,80,0,0,1,0,66,254,250,2,80,6,20,0,15,
+0,0,23,54,54,18,53,52,2,38,39,53,4,18,17,16,2,5,66,132,137,44,44,137,132,
+1,23,247,247,254,233,168,80,252,1,37,192,192,1,37,250,80,92,111,254,90,254,
+138,254,139,254,85,111,0,0,1,0,84,3,6,3,160,6,20,0,17,0,0,1,37,19,35,19,5,
+39,37,37,55,5,3,51,3,37,23,5,5,3,88,254,195,57,178,51,254,199,72,1,88,254,
+168,72,1,59,53,178,57,1,61,72,254,166,1,90,3,139,191,254,188,1,68,195,160,
+102,103,162,199,1,69,254,189,192,159,101,100,0,1,0,133,1,37,3,244,4,147,0,
+11,0,0,1,33,17,35,17,33,53,33,17,51,17,33,3,244,254,133,123,254,135,1,121,
+123,1,123,2,160,254,133,1,123,121,1,122,254,134,0,0,1,0,61,254,197,1,141,
+1,8,0,17,0,0,23,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,31,
+32,54,33,75,59,69,88,162,174,229,63,121,25,28,18,31,51,35,57,64,98,80,140,
+210,51,0,1,0,51,1,225,2,72,2,123,0,3,0,0,1,33,53,33,2,72,253,235,2,21,1,225,
+154,0,0,1,0,127,255,242,1,129,1,8,0,7,0,0,37,20,35,34,53,52,51,50,1,129,129,
+129,129,129,125,139,139,139,0,1,0,0,255,8,2,78,6,20,0,3,0,0,23,35,1,51,121,
+121,1,215,119,248,7,12,0,2,0,92,255,236,4,29,5,203,0,12,0,24,0,0,37,6,35,
+34,2,17,16,18,51,50,18,17,16,1,50,18,17,16,2,35,34,2,17,16,18,3,159,126,228,
+244,237,237,246,229,249,254,32,144,123,122,143,145,125,125,176,196,1,144,
+1,99,1,98,1,138,254,121,254,153,254,152,254,229,1,68,1,63,1,62,1,65,254,191,
+254,194,254,194,254,187,0,1,0,135,0,0,3,209,5,190,0,23,0,0,33,33,53,51,50,
+54,53,17,6,6,35,34,38,53,54,54,55,55,51,17,20,22,51,51,3,209,252,244,137,
+96,72,92,116,56,45,58,66,137,96,144,131,73,95,100,86,71,76,4,52,111,102,61,
+49,17,70,71,106,251,43,76,71,0,0,1,0,104,0,0,3,227,5,203,0,31,0,0,33,33,53,
+1,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,1,33,50,54,
+54,55,51,3,217,252,143,1,86,169,122,104,105,128,97,82,94,214,187,192,224,
+139,203,254,166,1,217,59,70,35,16,86,150,1,139,197,243,135,121,139,164,141,
+60,73,127,148,186,156,117,254,223,254,129,42,71,77,0,0,1,0,119,255,236,4,
+2,5,203,0,44,0,0,1,53,51,50,54,53,52,35,34,6,21,34,38,53,52,54,51,50,22,21,
+20,6,7,22,22,21,20,6,6,35,34,38,53,52,54,51,20,22,51,50,54,53,52,38,35,1,
+121,65,142,180,219,129,97,82,94,216,186,199,231,183,145,184,195,154,237,129,
+180,207,70,59,142,118,135,170,200,171,2,193,104,178,139,254,164,141,60,73,
+127,148,175,151,135,208,34,20,190,152,155,196,87,122,105,61,70,113,135,158,
+172,131,154,0,0,2,0,35,0,0,4,92,5,182,0,20,0,28,0,0,33,33,53,51,50,54,53,
+53,33,53,1,51,17,51,21,35,21,20,22,51,51,1,17,52,55,6,6,7,1,4,33,253,151,
+58,96,72,253,137,2,121,194,254,254,73,95,27,254,121,14,20,127,37,254,198,
+86,71,76,168,84,3,209,252,78,115,168,76,71,1,174,1,123,248,176,40,218,57,
+254,24,0,1,0,113,255,236,3,227,5,180,0,34,0,0,1,35,39,38,38,35,33,3,54,51,
+50,22,21,20,4,35,34,38,53,52,51,20,22,51,32,17,52,38,35,34,6,7,39,19,33,3,
+162,86,8,7,46,58,254,115,39,97,142,216,251,254,246,229,181,206,129,133,114,
+1,37,166,145,94,108,50,49,66,2,172,4,127,61,51,33,254,62,33,233,200,214,252,
+109,97,121,95,112,1,90,158,162,23,22,14,2,213,0,2,0,125,255,236,4,16,5,203,
+0,26,0,36,0,0,1,6,35,52,38,35,32,3,54,51,50,22,21,20,2,35,34,2,17,52,18,54,
+51,50,22,21,20,1,6,7,18,33,50,17,16,35,34,3,188,40,76,87,94,254,210,21,128,
+165,189,222,238,202,231,244,119,241,174,152,186,253,219,66,48,6,1,10,225,
+243,74,4,153,32,108,131,253,166,107,226,194,225,254,248,1,138,1,107,201,1,
+84,205,120,95,59,254,52,34,49,253,194,1,101,1,79,0,0,1,0,121,0,0,4,23,5,180,
+0,10,0,0,33,35,1,33,34,7,7,35,19,33,21,2,31,154,1,227,253,230,110,9,8,86,
+10,3,148,5,16,104,102,1,114,59,0,3,0,94,255,236,4,27,5,203,0,26,0,39,0,51,
+0,0,1,6,7,22,22,21,20,4,35,34,38,53,52,54,54,55,38,38,53,52,54,54,51,50,22,
+21,20,5,22,23,54,54,53,52,38,35,34,6,21,20,1,38,39,6,21,20,22,51,50,54,53,
+52,3,161,57,161,164,176,254,249,229,213,252,78,132,102,126,139,93,199,151,
+184,219,253,173,59,159,107,88,124,110,109,128,1,192,82,196,211,142,134,131,
+164,3,175,78,81,78,189,126,191,220,210,177,93,136,96,49,71,182,122,100,166,
+101,193,160,109,47,69,74,53,133,118,118,133,133,112,97,253,253,78,85,114,
+220,131,153,150,122,105,0,2,0,104,255,233,3,252,5,203,0,27,0,40,0,0,37,54,
+19,6,6,35,34,38,53,52,18,51,50,18,17,20,2,6,35,34,38,53,52,54,55,22,51,50,
+1,22,51,54,54,55,2,2,35,34,6,21,20,2,204,82,11,50,152,99,191,213,240,199,
+230,247,116,249,190,160,137,37,24,70,168,168,254,250,59,121,94,134,30,4,142,
+122,109,119,240,150,1,56,61,78,221,195,228,1,20,254,151,254,185,226,254,142,
+222,102,75,36,54,8,162,2,156,74,1,94,71,1,8,1,0,192,179,166,0,2,0,166,255,
+242,1,168,4,84,0,7,0,15,0,0,1,20,35,34,53,52,51,50,17,20,35,34,53,52,51,50,
+1,168,129,129,129,129,129,129,129,129,3,201,140,140,139,252,41,139,139,139,
+0,2,0,98,254,197,1,178,4,84,0,7,0,25,0,0,1,20,35,34,53,52,51,50,1,54,53,52,
+38,39,38,38,53,52,54,51,50,22,21,20,6,7,1,168,129,129,129,129,254,186,195,
+31,32,54,33,75,58,70,88,162,174,3,201,140,140,139,250,199,63,121,25,28,18,
+31,51,35,57,64,99,79,140,210,51,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,37,
+1,53,1,21,1,1,3,244,252,145,3,111,253,80,2,176,225,1,215,72,1,217,137,254,
+139,254,143,0,2,0,133,1,213,3,244,3,225,0,3,0,7,0,0,1,33,53,33,17,33,53,33,
+3,244,252,145,3,111,252,145,3,111,3,104,121,253,244,121,0,1,0,133,0,225,3,
+244,4,217,0,6,0,0,1,1,53,1,1,53,1,3,244,252,145,2,176,253,80,3,111,2,184,
+254,41,137,1,113,1,117,137,254,39,0,0,2,0,188,255,242,3,252,5,203,0,23,0,
+32,0,0,1,35,17,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,
+7,19,20,6,35,34,53,52,51,50,2,110,125,167,147,110,114,120,109,76,94,200,183,
+203,246,200,198,64,72,57,129,129,129,1,156,1,55,67,222,135,111,124,145,117,
+69,64,109,121,204,167,163,224,82,253,250,74,65,139,139,0,1,0,205,254,250,
+2,150,6,20,0,13,0,0,1,33,17,33,21,35,34,6,21,17,20,22,51,51,2,150,254,55,
+1,201,89,95,72,72,95,89,254,250,7,26,86,71,76,250,184,75,72,0,0,1,0,0,255,
+8,2,78,6,20,0,3,0,0,5,35,1,51,2,78,121,254,43,119,248,7,12,0,0,1,0,76,254,
+250,2,20,6,20,0,13,0,0,1,33,53,51,50,54,53,17,52,38,35,35,53,33,2,20,254,
+56,88,96,72,73,95,88,1,200,254,250,86,71,76,5,72,76,71,86,0,1,0,104,2,33,
+4,14,5,182,0,6,0,0,1,35,1,1,35,1,51,4,14,137,254,180,254,185,138,1,175,71,
+2,33,2,217,253,39,3,149,0,1,255,246,254,221,3,182,255,86,0,3,0,0,1,33,53,
+33,3,182,252,64,3,192,254,221,121,0,0,1,0,102,254,250,3,6,6,20,0,35,0,0,1,
+35,34,38,53,17,52,38,39,53,54,54,53,17,52,54,51,51,21,35,34,6,21,17,20,6,
+7,21,22,22,21,17,20,22,51,51,3,6,135,142,153,127,115,114,128,151,144,135,
+61,89,79,116,112,115,113,80,88,61,254,250,158,137,1,100,117,95,5,86,3,96,
+116,1,101,140,152,88,106,109,254,162,102,132,18,2,19,131,104,254,158,107,
+108,0,0,1,1,254,254,20,2,121,6,20,0,3,0,0,1,35,17,51,2,121,123,123,254,20,
+8,0,0,1,0,102,254,250,3,6,6,20,0,35,0,0,37,20,6,35,35,53,51,50,54,53,17,52,
+54,55,53,38,38,53,17,52,38,35,35,53,51,50,22,21,17,20,22,23,21,6,6,21,2,20,
+152,142,136,62,88,80,113,114,111,116,79,89,62,136,143,151,129,113,114,128,
+33,137,158,88,108,107,1,98,104,131,19,2,18,132,102,1,94,109,106,88,152,140,
+254,155,116,96,3,86,5,95,117,0,0,1,0,111,2,39,4,8,3,141,0,25,0,0,1,6,6,35,
+34,38,39,38,38,35,34,6,7,35,54,54,51,50,22,23,22,22,51,50,54,55,4,8,17,105,
+128,67,114,64,61,73,43,58,59,12,120,14,105,130,67,110,79,57,73,38,54,57,14,
+3,141,150,208,66,63,58,50,114,123,155,203,62,73,52,50,117,120,0,255,255,0,
+51,1,225,2,72,2,123,2,6,2,40,0,0,0,1,255,246,1,233,4,10,2,98,0,3,0,0,1,33,
+53,33,4,10,251,236,4,20,1,233,121,0,0,1,255,246,1,233,8,10,2,98,0,3,0,0,1,
+33,53,33,8,10,247,236,8,20,1,233,121,0,0,1,0,115,3,117,1,195,5,184,0,17,0,
+0,1,6,21,20,22,23,22,22,21,20,6,35,34,38,53,52,54,55,1,195,195,30,33,42,45,
+75,59,69,88,162,174,5,98,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,
+0,1,0,61,3,115,1,141,5,182,0,17,0,0,19,54,53,52,38,39,38,38,53,52,54,51,50,
+22,21,20,6,7,61,195,30,33,42,45,75,59,68,89,162,174,3,201,63,121,25,28,19,
+22,49,45,57,64,98,80,140,210,51,0,0,2,0,115,3,117,3,92,5,184,0,17,0,35,0,
+0,1,6,21,20,22,23,22,22,21,20,6,35,34,38,53,52,54,55,5,6,21,20,22,23,22,22,
+21,20,6,35,34,38,53,52,54,55,1,195,195,30,33,42,45,75,59,69,88,162,174,1,
+153,194,30,33,41,45,74,59,70,88,162,174,5,98,63,121,25,28,19,22,49,45,57,
+64,98,80,140,210,51,86,63,121,25,28,19,22,49,45,57,64,99,79,140,210,51,0,
+0,2,0,61,3,115,3,39,5,182,0,17,0,35,0,0,19,54,53,52,38,39,38,38,53,52,54,
+51,50,22,21,20,6,7,37,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,
+195,30,33,42,45,75,59,69,88,162,174,1,154,195,30,33,42,45,74,59,70,88,162,
+174,3,201,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,86,63,121,25,28,
+19,22,49,45,57,64,99,79,140,210,51,0,3,0,164,255,242,6,57,1,8,0,8,0,17,0,
+25,0,0,37,20,6,35,34,53,52,51,50,5,20,6,35,34,53,52,51,50,5,20,35,34,53,52,
+51,50,1,166,72,57,129,129,129,2,74,72,57,129,129,129,2,73,129,129,129,129,
+125,74,65,139,139,139,74,65,139,139,139,139,139,139,0,1,0,145,1,51,3,229,
+4,137,0,11,0,0,1,7,1,1,39,1,1,55,1,1,23,1,3,229,86,254,172,254,172,86,1,84,
+254,172,86,1,84,1,84,86,254,172,1,137,86,1,84,254,172,88,1,84,1,82,86,254,
+172,1,86,88,254,172,0,3,0,133,0,231,3,244,4,209,0,7,0,11,0,20,0,0,1,20,35,
+34,53,52,51,50,1,33,53,33,1,20,6,35,34,53,52,51,50,2,166,105,104,104,105,
+1,78,252,145,3,111,254,178,58,47,104,104,105,4,96,112,112,113,253,207,121,
+254,63,59,54,113,113,0,1,0,133,2,160,3,244,3,25,0,3,0,0,1,33,53,33,3,244,
+252,145,3,111,2,160,121,0,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,
+0,1,4,9,0,1,0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,
+0,3,0,1,4,9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,32,
+0,248,0,3,0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,9,0,9,
+0,38,1,134,0,3,0,1,4,9,0,10,0,96,1,172,0,3,0,1,4,9,0,11,0,62,2,12,0,3,0,1,
+4,9,0,12,0,60,2,74,0,3,0,1,4,9,0,13,2,150,2,134,0,3,0,1,4,9,0,14,0,52,5,28,
+0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,
+0,54,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,
+0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,
+0,101,0,114,0,105,0,102,0,32,0,66,0,101,0,110,0,103,0,97,0,108,0,105,0,82,
+0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,
+111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,66,0,101,0,110,0,
+103,0,97,0,108,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,
+46,0,48,0,49,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,101,0,114,0,105,
+0,102,0,66,0,101,0,110,0,103,0,97,0,108,0,105,0,78,0,111,0,116,0,111,0,32,
+0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,
+0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,
+0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,73,0,110,0,
+100,0,105,0,97,0,110,0,32,0,84,0,121,0,112,0,101,0,32,0,70,0,111,0,117,0,
+110,0,100,0,114,0,121,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,
+110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,
+0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,
+0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,
+0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,
+0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,
+0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,
+0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,
+105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,
+0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,
+0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,
+0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,
+0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,
+0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,
+0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,
+0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,
+105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,
+44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,
+0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,
+0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,
+103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,
+0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,
+0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,79,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,
+6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,
+1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,
+1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,
+1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,
+1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,
+1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,
+1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,
+1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,
+122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,
+1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,
+147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,
+1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,
+172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,
+1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,
+197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,
+1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,
+222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,
+1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,
+247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,
+5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,
+2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,
+2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,
+2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,
+2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,
+2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,
+2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,
+2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,
+121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,
+2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,
+146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,
+2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,
+171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,
+2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,
+196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,
+2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,
+221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,
+2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,
+246,2,247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,
+3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,
+3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,0,4,0,5,0,6,0,8,0,10,0,11,0,
+12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,
+0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,62,0,63,0,64,0,65,0,66,0,94,0,95,
+0,96,0,97,3,29,0,178,0,179,0,182,0,183,0,180,0,181,0,171,0,240,0,184,0,239,
+4,78,85,76,76,3,98,110,65,4,98,110,65,65,3,98,110,73,4,98,110,73,73,3,98,
+110,85,4,98,110,85,85,4,98,110,118,82,5,98,110,118,82,82,4,98,110,118,76,
+5,98,110,118,76,76,3,98,110,69,4,98,110,65,73,3,98,110,79,4,98,110,65,85,
+5,98,110,109,65,65,4,98,110,109,73,5,98,110,109,73,73,4,98,110,109,85,5,98,
+110,109,85,85,5,98,110,109,118,82,6,98,110,109,118,82,82,5,98,110,109,118,
+76,6,98,110,109,118,76,76,4,98,110,109,69,5,98,110,109,65,73,4,98,110,109,
+79,5,98,110,109,65,85,14,98,110,65,85,108,101,110,103,116,104,109,97,114,
+107,4,98,110,75,65,5,98,110,75,72,65,4,98,110,71,65,5,98,110,71,72,65,5,98,
+110,78,71,65,4,98,110,67,65,5,98,110,67,72,65,4,98,110,74,65,5,98,110,74,
+72,65,5,98,110,78,89,65,5,98,110,84,84,65,6,98,110,84,84,72,65,5,98,110,68,
+68,65,6,98,110,68,68,72,65,5,98,110,78,78,65,4,98,110,84,65,5,98,110,84,72,
+65,4,98,110,68,65,5,98,110,68,72,65,4,98,110,78,65,4,98,110,80,65,5,98,110,
+80,72,65,4,98,110,66,65,5,98,110,66,72,65,4,98,110,77,65,4,98,110,89,65,4,
+98,110,82,65,4,98,110,76,65,5,98,110,83,72,65,5,98,110,83,83,65,4,98,110,
+83,65,4,98,110,72,65,4,97,115,82,65,4,97,115,87,65,7,98,110,75,95,83,83,65,
+7,98,110,74,95,78,89,65,10,98,110,65,110,117,115,118,97,114,97,13,98,110,
+67,97,110,100,114,97,98,105,110,100,117,9,98,110,86,105,115,97,114,103,97,
+8,98,110,86,105,114,97,109,97,7,98,110,78,117,107,116,97,10,98,110,65,118,
+97,103,114,97,104,97,6,98,110,90,101,114,111,5,98,110,79,110,101,5,98,110,
+84,119,111,7,98,110,84,104,114,101,101,6,98,110,70,111,117,114,6,98,110,70,
+105,118,101,5,98,110,83,105,120,7,98,110,83,101,118,101,110,7,98,110,69,105,
+103,104,116,6,98,110,78,105,110,101,6,98,110,65,110,106,105,6,98,110,84,97,
+107,97,17,98,110,66,97,110,103,108,97,100,101,115,104,105,116,97,107,97,14,
+98,110,78,117,109,101,114,97,116,111,114,111,110,101,14,98,110,78,117,109,
+101,114,97,116,111,114,116,119,111,16,98,110,78,117,109,101,114,97,116,111,
+114,116,104,114,101,101,15,98,110,78,117,109,101,114,97,116,111,114,102,111,
+117,114,18,98,110,78,117,109,101,114,97,116,111,114,111,110,101,108,101,115,
+115,20,98,110,68,101,110,111,109,105,110,97,116,111,114,115,105,120,116,101,
+101,110,8,98,110,73,115,115,104,97,114,7,98,110,71,97,110,100,97,7,117,110,
+105,48,57,54,52,7,117,110,105,48,57,54,53,7,117,110,105,50,48,66,57,7,117,
+110,105,50,48,48,66,7,117,110,105,50,48,48,67,7,117,110,105,50,48,48,68,7,
+117,110,105,50,53,67,67,5,98,110,75,120,65,6,98,110,75,72,120,65,5,98,110,
+71,120,65,6,98,110,71,72,120,65,6,98,110,78,71,120,65,5,98,110,67,120,65,
+6,98,110,67,72,120,65,5,98,110,74,120,65,6,98,110,74,72,120,65,6,98,110,78,
+89,120,65,6,98,110,84,84,120,65,7,98,110,84,84,72,120,65,6,98,110,68,68,120,
+65,7,98,110,68,68,72,120,65,6,98,110,78,78,120,65,5,98,110,84,120,65,6,98,
+110,84,72,120,65,5,98,110,68,120,65,6,98,110,68,72,120,65,5,98,110,78,120,
+65,5,98,110,80,120,65,6,98,110,80,72,120,65,6,98,110,66,72,120,65,5,98,110,
+77,120,65,5,98,110,89,120,65,5,98,110,76,120,65,6,98,110,83,72,120,65,6,98,
+110,83,83,120,65,5,98,110,83,120,65,5,98,110,72,120,65,5,97,115,82,120,65,
+5,97,115,87,120,65,6,98,110,82,101,112,104,6,98,110,66,65,99,50,6,98,110,
+89,65,99,50,6,98,110,82,65,99,50,10,98,110,84,65,107,104,97,110,100,97,3,
+98,110,75,4,98,110,75,72,3,98,110,71,4,98,110,71,72,4,98,110,78,71,3,98,110,
+67,4,98,110,67,72,3,98,110,74,4,98,110,74,72,4,98,110,78,89,4,98,110,84,84,
+5,98,110,84,84,72,4,98,110,68,68,5,98,110,68,68,72,4,98,110,78,78,3,98,110,
+84,4,98,110,84,72,3,98,110,68,4,98,110,68,72,3,98,110,78,3,98,110,80,4,98,
+110,80,72,3,98,110,66,4,98,110,66,72,3,98,110,77,3,98,110,89,3,98,110,82,
+3,98,110,76,4,98,110,83,72,4,98,110,83,83,3,98,110,83,3,98,110,72,3,97,115,
+82,3,97,115,87,6,98,110,75,95,83,83,6,98,110,74,95,78,89,12,98,110,75,120,
+65,95,86,105,114,97,109,97,13,98,110,75,72,120,65,95,86,105,114,97,109,97,
+12,98,110,71,120,65,95,86,105,114,97,109,97,13,98,110,71,72,120,65,95,86,
+105,114,97,109,97,13,98,110,78,71,120,65,95,86,105,114,97,109,97,12,98,110,
+67,120,65,95,86,105,114,97,109,97,13,98,110,67,72,120,65,95,86,105,114,97,
+109,97,12,98,110,74,120,65,95,86,105,114,97,109,97,13,98,110,74,72,120,65,
+95,86,105,114,97,109,97,13,98,110,78,89,120,65,95,86,105,114,97,109,97,13,
+98,110,84,84,120,65,95,86,105,114,97,109,97,14,98,110,84,84,72,120,65,95,
+86,105,114,97,109,97,13,98,110,68,68,120,65,95,86,105,114,97,109,97,14,98,
+110,68,68,72,120,65,95,86,105,114,97,109,97,13,98,110,78,78,120,65,95,86,
+105,114,97,109,97,12,98,110,84,120,65,95,86,105,114,97,109,97,13,98,110,84,
+72,120,65,95,86,105,114,97,109,97,12,98,110,68,120,65,95,86,105,114,97,109,
+97,13,98,110,68,72,120,65,95,86,105,114,97,109,97,12,98,110,78,120,65,95,
+86,105,114,97,109,97,12,98,110,80,120,65,95,86,105,114,97,109,97,13,98,110,
+80,72,120,65,95,86,105,114,97,109,97,13,98,110,66,72,120,65,95,86,105,114,
+97,109,97,12,98,110,77,120,65,95,86,105,114,97,109,97,12,98,110,89,120,65,
+95,86,105,114,97,109,97,12,98,110,76,120,65,95,86,105,114,97,109,97,13,98,
+110,83,72,120,65,95,86,105,114,97,109,97,13,98,110,83,83,120,65,95,86,105,
+114,97,109,97,12,98,110,83,120,65,95,86,105,114,97,109,97,12,98,110,72,120,
+65,95,86,105,114,97,109,97,12,97,115,82,120,65,95,86,105,114,97,109,97,12,
+97,115,87,120,65,95,86,105,114,97,109,97,6,98,110,75,95,66,65,7,98,110,75,
+72,95,66,65,6,98,110,71,95,66,65,7,98,110,71,72,95,66,65,7,98,110,78,71,95,
+66,65,6,98,110,67,95,66,65,7,98,110,67,72,95,66,65,6,98,110,74,95,66,65,7,
+98,110,74,72,95,66,65,7,98,110,78,89,95,66,65,7,98,110,84,84,95,66,65,8,98,
+110,84,84,72,95,66,65,7,98,110,68,68,95,66,65,8,98,110,68,68,72,95,66,65,
+7,98,110,78,78,95,66,65,6,98,110,84,95,66,65,7,98,110,84,72,95,66,65,6,98,
+110,68,95,66,65,7,98,110,68,72,95,66,65,6,98,110,78,95,66,65,6,98,110,80,
+95,66,65,7,98,110,80,72,95,66,65,6,98,110,66,95,66,65,7,98,110,66,72,95,66,
+65,6,98,110,77,95,66,65,6,98,110,89,95,66,65,6,98,110,82,95,66,65,6,98,110,
+76,95,66,65,7,98,110,83,72,95,66,65,7,98,110,83,83,95,66,65,6,98,110,83,95,
+66,65,6,98,110,72,95,66,65,6,97,115,82,95,66,65,6,97,115,87,95,66,65,9,98,
+110,75,95,83,83,95,66,65,9,98,110,74,95,78,89,95,66,65,8,98,110,68,68,120,
+95,66,65,9,98,110,68,68,72,120,95,66,65,7,98,110,89,120,95,66,65,6,98,110,
+75,95,82,65,7,98,110,75,72,95,82,65,6,98,110,71,95,82,65,7,98,110,71,72,95,
+82,65,7,98,110,78,71,95,82,65,6,98,110,67,95,82,65,7,98,110,67,72,95,82,65,
+6,98,110,74,95,82,65,7,98,110,74,72,95,82,65,7,98,110,78,89,95,82,65,7,98,
+110,84,84,95,82,65,8,98,110,84,84,72,95,82,65,7,98,110,68,68,95,82,65,8,98,
+110,68,68,72,95,82,65,7,98,110,78,78,95,82,65,6,98,110,84,95,82,65,7,98,110,
+84,72,95,82,65,6,98,110,68,95,82,65,7,98,110,68,72,95,82,65,6,98,110,78,95,
+82,65,6,98,110,80,95,82,65,7,98,110,80,72,95,82,65,6,98,110,66,95,82,65,7,
+98,110,66,72,95,82,65,6,98,110,77,95,82,65,6,98,110,89,95,82,65,6,98,110,
+82,95,82,65,6,98,110,76,95,82,65,7,98,110,83,72,95,82,65,7,98,110,83,83,95,
+82,65,6,98,110,83,95,82,65,6,98,110,72,95,82,65,6,97,115,82,95,82,65,6,97,
+115,87,95,82,65,9,98,110,75,95,83,83,95,82,65,9,98,110,74,95,78,89,95,82,
+65,8,98,110,68,68,120,95,82,65,9,98,110,68,68,72,120,95,82,65,7,98,110,89,
+120,95,82,65,6,98,110,75,95,75,65,7,98,110,75,95,84,84,65,9,98,110,75,95,
+84,84,95,82,65,6,98,110,75,95,84,65,8,98,110,75,95,84,95,66,65,8,98,110,75,
+95,84,95,82,65,6,98,110,75,95,78,65,6,98,110,75,95,77,65,6,98,110,75,95,76,
+65,6,98,110,75,95,83,65,6,98,110,71,95,71,65,6,98,110,71,95,68,65,7,98,110,
+71,95,68,72,65,6,98,110,71,95,78,65,6,98,110,71,95,77,65,6,98,110,71,95,76,
+65,7,98,110,71,72,95,78,65,7,98,110,71,72,95,76,65,7,98,110,78,71,95,75,65,
+9,98,110,78,71,95,75,95,82,65,8,98,110,78,71,95,75,72,65,7,98,110,78,71,95,
+71,65,8,98,110,78,71,95,71,72,65,7,98,110,78,71,95,77,65,10,98,110,78,71,
+95,75,95,83,83,65,6,98,110,67,95,67,65,7,98,110,67,95,67,72,65,9,98,110,67,
+95,67,72,95,66,65,9,98,110,67,95,67,72,95,82,65,7,98,110,67,95,78,89,65,6,
+98,110,67,95,78,65,6,98,110,74,95,74,65,8,98,110,74,95,74,95,66,65,7,98,110,
+74,95,74,72,65,7,98,110,78,89,95,67,65,8,98,110,78,89,95,67,72,65,7,98,110,
+78,89,95,74,65,8,98,110,78,89,95,74,72,65,8,98,110,84,84,95,84,84,65,7,98,
+110,84,84,95,77,65,7,98,110,68,68,95,71,65,8,98,110,68,68,120,95,71,65,8,
+98,110,68,68,95,68,68,65,7,98,110,68,68,95,77,65,8,98,110,78,78,95,84,84,
+65,10,98,110,78,78,95,84,84,95,82,65,9,98,110,78,78,95,84,84,72,65,8,98,110,
+78,78,95,68,68,65,10,98,110,78,78,95,68,68,95,82,65,9,98,110,78,78,95,68,
+68,72,65,8,98,110,78,78,95,78,78,65,7,98,110,78,78,95,78,65,7,98,110,78,78,
+95,77,65,6,98,110,84,95,84,65,8,98,110,84,95,84,95,66,65,7,98,110,84,95,84,
+72,65,6,98,110,84,95,78,65,6,98,110,84,95,77,65,6,98,110,84,95,76,65,6,98,
+110,68,95,71,65,7,98,110,68,95,71,72,65,6,98,110,68,95,68,65,8,98,110,68,
+95,68,95,66,65,7,98,110,68,95,68,72,65,9,98,110,68,95,68,72,95,66,65,6,98,
+110,68,95,78,65,7,98,110,68,95,66,72,65,9,98,110,68,95,66,72,95,82,65,6,98,
+110,68,95,77,65,7,98,110,68,72,95,78,65,7,98,110,68,72,95,77,65,7,98,110,
+78,95,84,84,65,9,98,110,78,95,84,84,95,82,65,8,98,110,78,95,84,84,72,65,7,
+98,110,78,95,68,68,65,9,98,110,78,95,68,68,95,82,65,6,98,110,78,95,84,65,
+8,98,110,78,95,84,95,66,65,8,98,110,78,95,84,95,82,65,7,98,110,78,95,84,72,
+65,9,98,110,78,95,84,72,95,82,65,6,98,110,78,95,68,65,8,98,110,78,95,68,95,
+66,65,8,98,110,78,95,68,95,82,65,7,98,110,78,95,68,72,65,9,98,110,78,95,68,
+72,95,82,65,6,98,110,78,95,78,65,6,98,110,78,95,77,65,6,98,110,78,95,83,65,
+7,98,110,80,95,84,84,65,6,98,110,80,95,84,65,6,98,110,80,95,78,65,6,98,110,
+80,95,80,65,6,98,110,80,95,77,65,6,98,110,80,95,76,65,6,98,110,80,95,83,65,
+8,98,110,80,72,95,84,84,65,7,98,110,80,72,95,76,65,6,98,110,66,95,74,65,6,
+98,110,66,95,68,65,8,98,110,66,95,68,95,82,65,7,98,110,66,95,68,72,65,7,98,
+110,66,95,66,72,65,6,98,110,66,95,76,65,7,98,110,66,72,95,76,65,6,98,110,
+77,95,84,65,6,98,110,77,95,68,65,6,98,110,77,95,78,65,6,98,110,77,95,80,65,
+8,98,110,77,95,80,95,82,65,7,98,110,77,95,80,72,65,8,98,110,77,95,66,95,82,
+65,7,98,110,77,95,66,72,65,9,98,110,77,95,66,72,95,82,65,6,98,110,77,95,77,
+65,6,98,110,77,95,76,65,6,98,110,77,95,83,65,6,98,110,76,95,75,65,6,98,110,
+76,95,71,65,7,98,110,76,95,84,84,65,9,98,110,76,95,84,84,95,82,65,7,98,110,
+76,95,68,68,65,9,98,110,76,95,68,68,95,82,65,6,98,110,76,95,84,65,6,98,110,
+76,95,68,65,7,98,110,76,95,68,72,65,6,98,110,76,95,80,65,7,98,110,76,95,80,
+72,65,6,98,110,76,95,77,65,6,98,110,76,95,76,65,7,98,110,83,72,95,67,65,8,
+98,110,83,72,95,67,72,65,7,98,110,83,72,95,84,65,7,98,110,83,72,95,78,65,
+7,98,110,83,72,95,77,65,7,98,110,83,72,95,76,65,7,98,110,83,83,95,75,65,9,
+98,110,83,83,95,75,95,82,65,8,98,110,83,83,95,84,84,65,10,98,110,83,83,95,
+84,84,95,82,65,9,98,110,83,83,95,84,84,72,65,8,98,110,83,83,95,78,78,65,7,
+98,110,83,83,95,80,65,8,98,110,83,83,95,80,72,65,7,98,110,83,83,95,77,65,
+6,98,110,83,95,75,65,8,98,110,83,95,75,95,82,65,7,98,110,83,95,75,72,65,7,
+98,110,83,95,84,84,65,9,98,110,83,95,84,84,95,82,65,6,98,110,83,95,84,65,
+8,98,110,83,95,84,95,66,65,8,98,110,83,95,84,95,82,65,7,98,110,83,95,84,72,
+65,6,98,110,83,95,78,65,6,98,110,83,95,80,65,8,98,110,83,95,80,95,82,65,7,
+98,110,83,95,80,72,65,6,98,110,83,95,77,65,6,98,110,83,95,76,65,7,98,110,
+72,95,78,78,65,6,98,110,72,95,78,65,6,98,110,72,95,77,65,6,98,110,72,95,76,
+65,10,98,110,75,95,83,83,95,78,78,65,9,98,110,75,95,83,83,95,77,65,8,98,110,
+84,84,65,95,109,73,10,98,110,84,84,95,66,65,95,109,73,10,98,110,84,84,95,
+82,65,95,109,73,10,98,110,75,95,84,84,65,95,109,73,12,98,110,75,95,84,84,
+95,82,65,95,109,73,11,98,110,84,84,95,84,84,65,95,109,73,10,98,110,84,84,
+95,77,65,95,109,73,11,98,110,83,83,95,84,84,65,95,109,73,13,98,110,83,83,
+95,84,84,95,82,65,95,109,73,9,98,110,84,84,65,95,109,73,73,11,98,110,84,84,
+95,66,65,95,109,73,73,11,98,110,84,84,95,82,65,95,109,73,73,11,98,110,75,
+95,84,84,65,95,109,73,73,13,98,110,75,95,84,84,95,82,65,95,109,73,73,12,98,
+110,84,84,95,84,84,65,95,109,73,73,11,98,110,84,84,95,77,65,95,109,73,73,
+12,98,110,78,78,95,84,84,65,95,109,73,73,14,98,110,78,78,95,84,84,95,82,65,
+95,109,73,73,11,98,110,78,95,84,84,65,95,109,73,73,13,98,110,78,95,84,84,
+95,82,65,95,109,73,73,11,98,110,80,95,84,84,65,95,109,73,73,12,98,110,80,
+72,95,84,84,65,95,109,73,73,11,98,110,76,95,84,84,65,95,109,73,73,13,98,110,
+76,95,84,84,95,82,65,95,109,73,73,12,98,110,83,83,95,84,84,65,95,109,73,73,
+14,98,110,83,83,95,84,84,95,82,65,95,109,73,73,11,98,110,83,95,84,84,65,95,
+109,73,73,13,98,110,83,95,84,84,95,82,65,95,109,73,73,10,98,110,84,84,72,
+65,95,109,73,73,12,98,110,84,84,72,95,66,65,95,109,73,73,12,98,110,84,84,
+72,95,82,65,95,109,73,73,13,98,110,78,78,95,84,84,72,65,95,109,73,73,12,98,
+110,78,95,84,84,72,65,95,109,73,73,13,98,110,83,83,95,84,84,72,65,95,109,
+73,73,7,98,110,71,65,95,109,85,9,98,110,76,95,71,65,95,109,85,8,98,110,83,
+72,65,95,109,85,7,98,110,72,65,95,109,85,9,98,110,78,95,84,65,95,109,85,9,
+98,110,83,95,84,65,95,109,85,7,98,110,82,65,95,109,85,9,98,110,71,95,82,65,
+95,109,85,9,98,110,84,95,82,65,95,109,85,10,98,110,84,72,95,82,65,95,109,
+85,9,98,110,68,95,82,65,95,109,85,10,98,110,68,72,95,82,65,95,109,85,9,98,
+110,66,95,82,65,95,109,85,10,98,110,66,72,95,82,65,95,109,85,10,98,110,83,
+72,95,82,65,95,109,85,9,98,110,83,95,82,65,95,109,85,9,98,110,83,95,76,65,
+95,109,85,7,97,115,82,65,95,109,85,8,98,110,82,65,95,109,85,85,10,98,110,
+71,95,82,65,95,109,85,85,11,98,110,84,72,95,82,65,95,109,85,85,10,98,110,
+68,95,82,65,95,109,85,85,11,98,110,68,72,95,82,65,95,109,85,85,11,98,110,
+66,72,95,82,65,95,109,85,85,11,98,110,83,72,95,82,65,95,109,85,85,10,98,110,
+83,95,82,65,95,109,85,85,8,97,115,82,65,95,109,85,85,8,98,110,72,65,95,109,
+118,82,18,98,110,84,84,65,95,65,85,108,101,110,103,116,104,109,97,114,107,
+20,98,110,84,84,95,66,65,95,65,85,108,101,110,103,116,104,109,97,114,107,
+20,98,110,84,84,95,82,65,95,65,85,108,101,110,103,116,104,109,97,114,107,
+20,98,110,75,95,84,84,65,95,65,85,108,101,110,103,116,104,109,97,114,107,
+22,98,110,75,95,84,84,95,82,65,95,65,85,108,101,110,103,116,104,109,97,114,
+107,21,98,110,84,84,95,84,84,65,95,65,85,108,101,110,103,116,104,109,97,114,
+107,21,98,110,78,78,95,84,84,65,95,65,85,108,101,110,103,116,104,109,97,114,
+107,23,98,110,78,78,95,84,84,95,82,65,95,65,85,108,101,110,103,116,104,109,
+97,114,107,20,98,110,78,95,84,84,65,95,65,85,108,101,110,103,116,104,109,
+97,114,107,22,98,110,78,95,84,84,95,82,65,95,65,85,108,101,110,103,116,104,
+109,97,114,107,20,98,110,80,95,84,84,65,95,65,85,108,101,110,103,116,104,
+109,97,114,107,21,98,110,80,72,95,84,84,65,95,65,85,108,101,110,103,116,104,
+109,97,114,107,20,98,110,76,95,84,84,65,95,65,85,108,101,110,103,116,104,
+109,97,114,107,22,98,110,76,95,84,84,95,82,65,95,65,85,108,101,110,103,116,
+104,109,97,114,107,21,98,110,83,83,95,84,84,65,95,65,85,108,101,110,103,116,
+104,109,97,114,107,23,98,110,83,83,95,84,84,95,82,65,95,65,85,108,101,110,
+103,116,104,109,97,114,107,20,98,110,83,95,84,84,65,95,65,85,108,101,110,
+103,116,104,109,97,114,107,22,98,110,83,95,84,84,95,82,65,95,65,85,108,101,
+110,103,116,104,109,97,114,107,9,98,110,109,69,46,105,110,105,116,10,98,110,
+109,65,73,46,105,110,105,116,10,98,110,109,73,46,115,104,111,114,116,13,98,
+110,68,68,120,65,46,109,97,116,114,97,117,14,98,110,68,68,72,120,65,46,109,
+97,116,114,97,117,18,98,110,82,101,112,104,95,67,97,110,100,114,97,98,105,
+110,100,117,16,98,110,109,73,95,67,97,110,100,114,97,98,105,110,100,117,9,
+98,110,109,73,95,82,101,112,104,17,98,110,109,73,73,95,67,97,110,100,114,
+97,98,105,110,100,117,10,98,110,109,73,73,95,82,101,112,104,22,98,110,109,
+73,73,95,82,101,112,104,95,67,97,110,100,114,97,98,105,110,100,117,7,117,
+110,105,48,48,65,68,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,
+0,0,2,0,6,0,21,0,26,0,3,0,69,0,69,0,3,0,71,0,71,0,3,0,134,0,135,0,3,0,137,
+0,137,0,3,2,24,2,24,0,3,0,1,0,0,0,10,0,72,0,170,0,3,68,70,76,84,0,20,98,101,
+110,103,0,34,98,110,103,50,0,48,0,4,0,0,0,0,255,255,0,2,0,0,0,3,0,4,0,0,0,
+0,255,255,0,2,0,1,0,4,0,4,0,0,0,0,255,255,0,2,0,2,0,5,0,6,97,98,118,109,0,
+38,97,98,118,109,0,46,97,98,118,109,0,54,98,108,119,109,0,62,98,108,119,109,
+0,74,98,108,119,109,0,86,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,
+0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,
+6,0,14,0,22,0,30,0,38,0,46,0,54,0,4,0,0,0,1,0,48,0,4,0,0,0,1,9,42,0,4,0,0,
+0,1,18,80,0,4,0,0,0,1,22,228,0,4,0,0,0,1,30,64,0,6,0,0,0,1,31,12,0,1,31,66,
+31,74,0,1,0,12,0,22,0,2,0,0,2,246,0,0,2,246,1,117,2,242,2,248,2,254,3,4,3,
+10,3,16,3,22,3,28,3,34,3,40,3,46,3,52,3,52,3,58,3,64,3,70,3,76,3,82,3,88,
+3,94,3,100,3,106,3,112,3,76,3,118,3,124,3,64,3,130,3,136,3,142,3,148,3,154,
+3,160,3,166,3,160,3,172,3,178,3,142,3,184,3,190,3,58,3,64,3,70,3,76,3,82,
+3,88,3,94,3,100,3,106,3,112,3,76,3,118,3,124,3,64,3,130,3,136,3,148,3,154,
+3,160,3,166,3,160,3,172,3,178,3,142,3,58,3,64,3,70,3,76,3,82,3,88,3,94,3,
+100,3,106,3,112,3,76,3,118,3,124,3,64,3,130,3,136,3,148,3,154,3,160,3,166,
+3,160,3,172,3,178,3,142,3,196,3,202,3,208,3,76,3,214,3,220,3,226,3,232,3,
+238,3,244,3,250,4,0,4,6,4,12,3,130,4,18,4,24,4,30,4,36,4,18,4,42,4,48,4,54,
+3,88,4,60,4,42,4,42,4,66,4,72,3,244,4,78,4,18,4,84,4,90,4,96,4,102,4,108,
+4,114,4,120,4,126,4,132,4,138,4,144,4,150,4,156,3,154,4,162,4,168,4,174,4,
+180,4,186,4,168,4,174,4,192,4,198,4,204,4,210,4,174,4,174,4,216,4,222,3,244,
+4,144,4,168,4,228,4,234,4,240,4,246,4,252,5,2,5,8,5,14,3,118,3,118,5,20,5,
+26,5,32,3,88,5,38,5,44,5,50,5,56,5,62,5,68,5,74,5,80,5,86,5,92,5,98,5,104,
+5,110,5,116,5,122,5,128,5,134,5,140,5,146,5,152,5,158,5,164,5,170,5,176,5,
+182,5,188,5,194,5,200,5,206,3,160,5,212,5,218,5,224,5,230,5,236,4,180,5,242,
+4,6,4,6,4,6,4,6,4,6,5,248,5,254,4,6,6,4,5,104,6,10,6,16,6,22,6,28,6,28,3,
+70,6,34,6,40,3,190,4,30,5,122,6,46,6,52,4,72,6,58,6,64,6,70,6,76,6,82,6,88,
+6,94,6,100,6,106,6,112,6,118,6,124,6,130,6,136,5,224,6,142,6,46,3,58,3,130,
+6,148,6,154,6,160,3,238,3,202,6,166,6,172,6,178,4,48,6,184,6,190,6,196,6,
+202,6,202,6,208,6,214,6,220,6,220,6,226,6,232,6,238,6,244,6,244,6,250,6,154,
+7,0,7,6,7,12,7,18,7,24,3,160,7,30,7,36,7,42,7,48,7,54,7,60,6,148,7,66,7,72,
+4,174,4,174,7,78,7,84,7,90,7,96,7,102,7,108,7,114,4,66,7,120,7,126,7,132,
+7,138,7,144,7,150,7,156,7,162,7,168,7,174,7,180,7,186,7,192,7,198,7,204,7,
+210,7,216,7,222,7,228,7,234,7,240,7,246,7,252,8,2,8,8,8,14,8,20,8,26,8,32,
+8,38,8,44,8,50,8,56,8,62,8,68,8,74,6,184,8,80,8,86,8,92,8,98,3,142,5,44,4,
+156,3,154,4,174,5,230,8,104,7,66,6,148,3,142,4,156,3,154,6,130,8,110,6,148,
+8,116,8,122,8,128,8,134,8,140,8,146,8,152,8,158,8,164,8,170,8,176,8,182,8,
+188,8,194,8,200,8,206,8,212,8,218,8,224,3,112,8,230,0,1,255,80,4,250,0,1,
+5,109,4,143,0,1,3,218,5,67,0,1,4,217,5,69,0,1,4,216,5,63,0,1,5,90,5,63,0,
+1,1,241,4,116,0,1,4,53,4,143,0,1,6,69,4,203,0,1,4,104,4,143,0,1,6,54,4,250,
+0,1,5,147,5,72,0,1,2,72,4,196,0,1,3,94,4,143,0,1,3,118,4,143,0,1,3,114,4,
+143,0,1,1,15,4,143,0,1,0,245,4,143,0,1,3,142,4,143,0,1,4,139,4,143,0,1,3,
+227,5,100,0,1,3,227,4,143,0,1,2,92,4,143,0,1,3,53,4,143,0,1,0,250,4,143,0,
+1,3,130,4,143,0,1,3,160,4,143,0,1,3,112,4,143,0,1,3,175,4,143,0,1,3,218,4,
+143,0,1,3,170,4,143,0,1,4,127,4,143,0,1,4,15,4,143,0,1,2,50,4,143,0,1,3,249,
+4,143,0,1,3,49,4,143,0,1,2,229,4,143,0,1,3,123,4,143,0,1,2,191,4,143,0,1,
+0,246,4,143,0,1,3,61,4,143,0,1,4,20,4,143,0,1,3,221,5,64,0,1,3,121,4,143,
+0,1,2,2,4,143,0,1,0,251,4,143,0,1,2,205,4,143,0,1,1,0,4,143,0,1,6,148,4,143,
+0,1,3,150,4,143,0,1,6,142,4,143,0,1,3,98,4,143,0,1,3,59,4,143,0,1,2,255,4,
+143,0,1,3,163,4,143,0,1,2,142,4,143,0,1,2,176,4,143,0,1,3,250,4,143,0,1,3,
+56,4,143,0,1,1,19,4,143,0,1,4,0,4,143,0,1,3,213,4,143,0,1,3,45,4,143,0,1,
+1,122,4,143,0,1,1,35,4,143,0,1,3,193,4,143,0,1,3,204,4,143,0,1,3,246,5,87,
+0,1,3,208,4,143,0,1,2,32,4,143,0,1,1,86,4,143,0,1,3,148,4,143,0,1,1,161,4,
+143,0,1,3,219,4,143,0,1,3,234,4,143,0,1,3,144,4,143,0,1,2,195,4,143,0,1,3,
+162,4,143,0,1,4,198,4,143,0,1,2,241,4,143,0,1,3,197,4,143,0,1,2,232,4,143,
+0,1,4,10,4,143,0,1,3,35,4,143,0,1,2,240,4,143,0,1,4,121,5,69,0,1,4,139,5,
+69,0,1,3,246,4,143,0,1,3,216,4,143,0,1,3,255,4,143,0,1,3,3,4,143,0,1,5,142,
+4,143,0,1,3,209,4,143,0,1,3,213,4,250,0,1,5,30,4,143,0,1,3,147,4,143,0,1,
+4,17,4,143,0,1,4,123,4,143,0,1,3,215,4,143,0,1,7,26,4,143,0,1,4,224,4,143,
+0,1,7,150,4,143,0,1,3,32,4,143,0,1,3,23,4,143,0,1,3,28,4,143,0,1,3,26,4,143,
+0,1,4,201,4,143,0,1,1,3,4,143,0,1,3,73,4,143,0,1,3,60,4,143,0,1,6,157,4,143,
+0,1,3,42,4,250,0,1,2,236,4,143,0,1,3,191,4,143,0,1,4,117,4,143,0,1,4,21,5,
+125,0,1,3,237,5,61,0,1,5,184,4,143,0,1,5,48,4,143,0,1,6,221,5,50,0,1,6,101,
+5,67,0,1,5,34,4,143,0,1,3,241,4,143,0,1,4,62,4,143,0,1,4,240,4,143,0,1,3,
+151,4,143,0,1,3,108,4,143,0,1,2,218,4,143,0,1,4,217,4,143,0,1,6,136,4,143,
+0,1,1,43,4,143,0,1,1,60,4,143,0,1,3,132,4,143,0,1,6,143,5,61,0,1,6,62,5,42,
+0,1,5,17,4,143,0,1,3,0,4,143,0,1,3,80,4,143,0,1,4,216,4,143,0,1,3,58,4,143,
+0,1,3,82,4,143,0,1,3,122,4,143,0,1,3,106,4,143,0,1,4,200,4,143,0,1,5,141,
+4,143,0,1,7,115,5,58,0,1,4,34,4,250,0,1,5,106,4,143,0,1,6,156,4,143,0,1,6,
+151,5,42,0,1,3,168,4,143,0,1,2,159,4,143,0,1,2,186,4,143,0,1,2,246,4,143,
+0,1,3,11,4,143,0,1,3,64,4,143,0,1,3,137,4,143,0,1,5,80,4,143,0,1,3,139,4,
+143,0,1,4,226,4,143,0,1,3,149,4,143,0,1,7,17,4,143,0,1,4,37,4,143,0,1,7,0,
+5,72,0,1,6,193,5,87,0,1,3,244,4,143,0,1,3,225,4,143,0,1,3,231,4,143,0,1,4,
+76,4,143,0,1,6,105,4,143,0,1,5,55,4,143,0,1,3,222,4,143,0,1,4,12,4,143,0,
+1,3,214,4,250,0,1,2,143,4,143,0,1,4,183,4,143,0,1,3,202,5,69,0,1,4,133,5,
+50,0,1,4,144,4,143,0,1,5,0,4,143,0,1,4,156,4,143,0,1,3,186,4,143,0,1,3,238,
+4,143,0,1,7,31,5,54,0,1,6,235,5,40,0,1,3,141,4,143,0,1,4,233,4,143,0,1,5,
+122,4,143,0,1,5,63,4,143,0,1,3,192,4,143,0,1,2,163,4,143,0,1,2,139,4,143,
+0,1,3,198,4,143,0,1,2,95,4,143,0,1,6,204,4,143,0,1,5,238,5,41,0,1,5,196,5,
+69,0,1,6,39,5,44,0,1,5,238,5,38,0,1,6,99,5,44,0,1,6,90,5,34,0,1,6,109,4,143,
+0,1,5,196,5,60,0,1,6,74,5,47,0,1,6,61,5,31,0,1,6,19,5,29,0,1,6,86,5,25,0,
+1,6,203,5,31,0,1,6,223,5,27,0,1,6,198,5,34,0,1,7,134,5,24,0,1,8,181,5,34,
+0,1,8,172,5,25,0,1,8,161,5,25,0,1,8,86,5,31,0,1,9,125,5,25,0,1,8,90,5,33,
+0,1,9,36,5,25,0,1,8,243,5,33,0,1,5,224,5,24,0,1,6,121,5,24,0,1,9,48,5,22,
+0,1,9,23,5,20,0,1,6,109,5,25,0,1,5,224,5,25,0,1,6,50,5,25,0,1,7,160,5,22,
+0,1,7,142,5,18,0,1,6,250,5,18,0,1,4,48,4,143,0,1,4,110,4,143,0,1,2,178,4,
+143,0,1,3,72,4,143,0,1,3,177,4,143,0,1,3,172,4,143,0,1,3,226,4,143,0,1,2,
+136,4,143,0,1,5,200,5,90,0,1,5,238,5,27,0,1,6,48,5,18,0,1,6,146,5,42,0,1,
+6,200,5,25,0,1,6,168,5,38,0,1,8,156,5,38,0,1,8,122,5,34,0,1,8,116,5,31,0,
+1,8,32,5,34,0,1,9,93,5,27,0,1,8,55,5,42,0,1,9,19,5,31,0,1,8,208,5,42,0,1,
+5,204,5,29,0,1,6,100,5,31,0,1,9,7,5,31,0,1,8,227,5,29,0,1,1,106,4,143,0,1,
+23,204,23,210,0,1,0,12,0,18,0,1,0,0,2,242,1,117,2,242,2,248,2,254,3,4,3,10,
+3,16,3,22,3,28,3,34,3,40,3,46,3,52,3,58,3,64,3,70,3,76,3,82,3,88,3,94,3,100,
+3,64,3,106,3,112,3,52,3,118,3,124,3,130,3,136,3,142,3,148,3,154,3,148,3,160,
+3,166,3,130,3,172,3,178,3,46,3,52,3,58,3,64,3,70,3,76,3,82,3,88,3,94,3,100,
+3,64,3,106,3,112,3,52,3,118,3,124,3,136,3,142,3,148,3,154,3,148,3,160,3,166,
+3,130,3,46,3,52,3,58,3,64,3,70,3,76,3,82,3,88,3,94,3,100,3,64,3,106,3,112,
+3,52,3,118,3,124,3,136,3,142,3,148,3,154,3,148,3,160,3,166,3,130,3,184,3,
+190,3,196,3,64,3,202,3,208,3,214,3,220,3,226,3,232,3,238,3,244,3,250,4,0,
+3,118,4,6,4,12,4,18,4,24,4,6,4,30,4,36,4,42,4,48,4,54,4,30,4,30,4,60,4,66,
+3,232,4,72,4,6,4,78,4,84,4,90,4,96,4,102,4,108,4,114,4,120,4,126,4,132,4,
+138,4,144,4,150,3,142,4,156,4,162,4,168,4,174,4,180,4,162,4,168,4,186,4,192,
+4,198,4,204,4,168,4,168,4,210,4,216,3,232,4,138,4,162,4,222,4,228,4,234,4,
+240,4,246,4,252,5,2,5,8,5,14,5,14,5,20,5,26,5,32,5,38,5,44,5,50,5,56,5,62,
+5,68,5,74,5,80,5,86,5,92,5,98,5,104,5,110,5,116,5,122,5,128,5,134,5,140,5,
+146,5,152,5,158,5,164,5,170,5,176,5,182,5,188,5,194,5,200,5,62,5,206,3,148,
+5,212,5,218,5,224,5,230,5,236,5,242,5,248,3,250,3,250,3,250,3,250,3,250,5,
+254,6,4,3,250,6,10,6,16,6,22,6,28,6,34,6,40,6,40,6,46,6,52,6,58,3,178,6,64,
+3,208,4,24,6,70,6,76,6,82,6,88,5,110,6,94,6,100,6,106,6,112,6,118,6,124,6,
+130,6,136,6,142,4,204,6,148,6,154,6,160,6,166,3,46,3,118,6,172,6,178,6,184,
+6,190,3,190,6,196,6,202,6,208,4,36,6,214,6,220,6,226,6,232,6,232,6,238,6,
+244,6,250,6,250,7,0,7,6,7,12,7,18,7,18,7,24,7,30,7,36,7,42,7,48,7,54,6,166,
+3,148,7,60,7,66,7,72,4,240,7,78,7,84,6,190,7,90,7,96,6,82,7,102,7,108,7,114,
+7,120,7,126,7,132,7,138,7,144,4,60,7,150,7,156,7,162,7,168,7,156,7,174,7,
+180,7,186,7,162,7,192,7,198,7,204,7,210,7,216,7,222,7,228,7,234,7,240,7,246,
+7,252,8,2,8,8,8,14,8,20,8,26,8,32,8,38,8,44,8,50,8,56,8,62,8,68,8,74,8,80,
+8,86,8,92,6,214,8,98,8,104,8,110,3,124,8,116,8,122,4,150,3,142,4,168,8,128,
+8,134,8,140,8,146,3,130,8,152,8,122,4,150,3,142,4,204,8,134,8,158,6,172,8,
+164,8,170,8,176,8,182,8,188,8,194,8,200,8,206,8,212,8,218,8,224,8,230,8,236,
+8,242,8,248,8,254,9,4,9,10,9,16,3,100,9,22,0,1,255,80,4,250,0,1,5,109,4,143,
+0,1,1,176,5,38,0,1,2,72,5,40,0,1,2,69,5,40,0,1,2,177,5,38,0,1,1,226,4,143,
+0,1,4,26,4,143,0,1,4,51,4,250,0,1,4,24,4,164,0,1,4,221,4,215,0,1,3,94,4,143,
+0,1,3,118,4,143,0,1,3,57,4,169,0,1,1,15,4,143,0,1,0,245,4,143,0,1,3,83,4,
+143,0,1,4,139,4,143,0,1,1,227,5,64,0,1,2,221,4,143,0,1,2,92,4,143,0,1,2,233,
+4,143,0,1,0,250,4,143,0,1,3,130,4,143,0,1,3,160,4,143,0,1,3,112,4,143,0,1,
+3,175,4,143,0,1,3,218,4,143,0,1,3,170,4,143,0,1,4,127,4,143,0,1,4,15,4,143,
+0,1,2,49,4,143,0,1,3,248,4,143,0,1,3,49,4,143,0,1,2,229,4,143,0,1,3,123,4,
+143,0,1,2,169,4,143,0,1,0,246,4,143,0,1,3,60,4,143,0,1,4,59,4,143,0,1,1,223,
+5,37,0,1,2,124,4,143,0,1,2,2,4,143,0,1,0,251,4,143,0,1,2,204,4,143,0,1,1,
+0,4,143,0,1,6,148,4,143,0,1,3,150,4,143,0,1,6,142,4,143,0,1,3,97,4,143,0,
+1,3,58,4,143,0,1,2,255,4,143,0,1,3,163,4,143,0,1,2,140,4,143,0,1,3,140,4,
+143,0,1,2,151,4,143,0,1,3,250,4,143,0,1,3,54,4,143,0,1,1,19,4,143,0,1,4,0,
+4,143,0,1,3,213,4,143,0,1,2,244,4,143,0,1,1,122,4,143,0,1,1,35,4,143,0,1,
+3,145,4,143,0,1,4,24,4,143,0,1,2,55,5,62,0,1,2,194,4,143,0,1,2,32,4,143,0,
+1,1,86,4,143,0,1,3,148,4,143,0,1,1,161,4,143,0,1,3,219,4,143,0,1,3,234,4,
+143,0,1,3,144,4,143,0,1,2,195,4,143,0,1,3,159,4,143,0,1,4,198,4,143,0,1,2,
+234,4,143,0,1,3,200,4,143,0,1,2,246,4,143,0,1,4,10,4,143,0,1,3,39,4,143,0,
+1,2,240,4,143,0,1,2,89,5,64,0,1,2,97,5,56,0,1,3,247,4,143,0,1,3,216,4,143,
+0,1,3,254,4,143,0,1,3,3,4,143,0,1,5,142,4,143,0,1,3,53,4,143,0,1,3,209,4,
+143,0,1,3,213,4,250,0,1,5,30,4,143,0,1,3,142,4,143,0,1,3,147,4,143,0,1,4,
+17,4,143,0,1,4,123,4,143,0,1,3,215,4,143,0,1,7,26,4,143,0,1,4,224,4,143,0,
+1,7,150,4,143,0,1,3,32,4,143,0,1,3,23,4,143,0,1,3,28,4,143,0,1,3,26,4,143,
+0,1,4,200,4,143,0,1,1,5,4,143,0,1,3,73,4,143,0,1,3,59,4,143,0,1,6,153,4,143,
+0,1,3,42,4,250,0,1,2,236,4,143,0,1,3,192,4,143,0,1,4,114,4,143,0,1,2,80,5,
+59,0,1,1,242,5,59,0,1,5,184,4,143,0,1,5,48,4,143,0,1,4,167,5,53,0,1,4,85,
+5,52,0,1,4,2,4,143,0,1,4,56,4,143,0,1,4,240,4,143,0,1,3,153,4,143,0,1,3,109,
+4,143,0,1,2,218,4,143,0,1,4,217,4,143,0,1,2,198,4,143,0,1,6,136,4,143,0,1,
+1,43,4,143,0,1,1,60,4,143,0,1,3,132,4,143,0,1,4,201,4,143,0,1,4,100,5,57,
+0,1,4,54,5,62,0,1,3,233,4,143,0,1,3,0,4,143,0,1,3,110,4,143,0,1,3,80,4,143,
+0,1,4,215,4,143,0,1,3,92,4,143,0,1,3,82,4,143,0,1,3,56,4,143,0,1,3,122,4,
+143,0,1,3,106,4,143,0,1,5,141,4,143,0,1,5,109,5,45,0,1,4,34,4,250,0,1,5,106,
+4,143,0,1,6,156,4,143,0,1,4,66,5,66,0,1,3,168,4,143,0,1,2,159,4,143,0,1,2,
+186,4,143,0,1,3,11,4,143,0,1,3,108,4,143,0,1,3,64,4,143,0,1,3,62,4,143,0,
+1,3,137,4,143,0,1,5,81,4,143,0,1,3,138,4,143,0,1,3,120,4,143,0,1,4,226,4,
+143,0,1,3,149,4,143,0,1,7,17,4,143,0,1,4,37,4,143,0,1,4,242,5,70,0,1,4,213,
+5,50,0,1,3,244,4,143,0,1,3,232,4,143,0,1,3,238,4,143,0,1,4,76,4,143,0,1,6,
+105,4,143,0,1,5,55,4,143,0,1,3,229,4,143,0,1,4,12,4,143,0,1,3,214,4,250,0,
+1,5,80,4,143,0,1,2,152,4,143,0,1,4,183,4,143,0,1,1,225,5,42,0,1,2,99,5,47,
+0,1,5,2,4,143,0,1,4,156,4,143,0,1,3,180,4,143,0,1,4,198,5,53,0,1,4,168,5,
+46,0,1,3,119,4,143,0,1,4,232,4,143,0,1,3,117,4,143,0,1,5,122,4,143,0,1,5,
+63,4,143,0,1,3,165,4,143,0,1,2,127,4,143,0,1,2,83,4,143,0,1,3,198,4,143,0,
+1,2,46,4,143,0,1,6,204,4,143,0,1,4,131,5,12,0,1,4,89,5,33,0,1,4,131,5,24,
+0,1,4,224,5,33,0,1,4,181,5,18,0,1,4,101,5,36,0,1,4,201,5,42,0,1,3,55,4,235,
+0,1,3,45,4,233,0,1,3,100,4,239,0,1,3,191,4,237,0,1,3,209,4,228,0,1,3,180,
+4,233,0,1,4,164,4,143,0,1,5,224,4,250,0,1,5,188,4,239,0,1,5,172,4,237,0,1,
+5,106,4,239,0,1,6,155,4,233,0,1,5,128,4,235,0,1,6,80,4,230,0,1,6,25,4,235,
+0,1,3,22,4,237,0,1,3,175,4,237,0,1,6,84,4,230,0,1,6,16,4,235,0,1,3,134,4,
+201,0,1,2,251,4,210,0,1,3,77,4,210,0,1,4,190,4,223,0,1,4,165,4,224,0,1,4,
+10,4,224,0,1,4,49,4,143,0,1,4,112,4,143,0,1,2,174,4,143,0,1,3,70,4,143,0,
+1,3,255,4,136,0,1,4,17,4,250,0,1,2,217,4,143,0,1,4,92,4,250,0,1,3,155,4,143,
+0,1,3,115,4,143,0,1,4,23,4,250,0,1,3,176,4,143,0,1,2,58,4,143,0,1,3,107,5,
+45,0,1,3,20,5,27,0,1,3,75,5,24,0,1,3,168,5,47,0,1,3,182,5,29,0,1,3,166,5,
+43,0,1,5,233,5,36,0,1,5,159,5,33,0,1,5,167,5,38,0,1,5,79,5,24,0,1,6,128,5,
+27,0,1,5,94,5,27,0,1,6,50,5,27,0,1,5,247,5,27,0,1,3,9,5,31,0,1,3,148,5,25,
+0,1,6,53,5,33,0,1,5,249,5,33,0,1,1,106,4,143,0,1,16,16,16,24,0,1,0,12,0,22,
+0,2,0,0,1,60,0,0,1,60,0,152,1,56,1,62,1,68,1,74,1,80,1,86,1,56,1,62,1,68,
+1,74,1,92,1,98,1,104,1,110,1,116,1,122,1,128,1,134,1,140,1,146,1,152,1,158,
+1,164,1,170,1,176,1,182,1,188,1,194,1,200,1,206,1,212,1,218,1,224,1,212,1,
+230,1,236,1,242,1,248,1,254,2,4,2,10,2,16,2,22,2,28,2,34,2,40,2,46,2,52,2,
+58,2,64,2,70,2,76,2,82,2,88,2,94,2,100,2,106,2,112,2,118,2,124,2,130,2,136,
+2,142,2,148,2,154,2,160,2,166,2,172,2,178,1,134,2,184,2,190,2,196,1,146,2,
+202,2,208,2,214,2,220,2,226,2,232,2,238,2,244,2,250,3,0,3,6,3,12,3,18,3,24,
+1,194,3,30,3,36,3,42,3,48,3,54,3,60,3,66,3,72,3,78,3,84,3,90,3,96,3,102,3,
+108,3,114,3,120,3,126,3,132,3,138,3,120,3,144,3,150,3,156,3,162,3,168,3,174,
+3,180,3,186,1,236,3,192,3,198,3,204,3,210,3,216,3,222,3,228,3,234,3,240,3,
+246,3,252,4,2,4,8,4,14,4,20,4,26,4,32,4,38,4,44,4,50,4,56,4,62,4,68,4,74,
+4,80,4,86,4,92,2,106,4,98,4,104,4,110,4,116,4,122,4,128,0,1,255,83,0,0,0,
+1,3,94,255,232,0,1,4,2,255,168,0,1,2,245,255,227,0,1,3,15,255,56,0,1,3,248,
+255,232,0,1,3,250,255,192,0,1,2,229,255,108,0,1,3,186,255,108,0,1,3,215,255,
+108,0,1,3,123,255,128,0,1,3,41,255,45,0,1,2,210,255,1,0,1,3,65,254,174,0,
+1,5,91,254,124,0,1,3,16,255,99,0,1,4,61,254,148,0,1,3,5,255,99,0,1,2,239,
+254,251,0,1,3,68,255,70,0,1,2,215,255,101,0,1,3,130,255,232,0,1,3,56,255,
+85,0,1,3,203,255,45,0,1,3,62,255,109,0,1,3,130,255,136,0,1,4,35,255,199,0,
+1,3,150,255,65,0,1,3,138,255,24,0,1,3,111,255,232,0,1,2,255,254,254,0,1,3,
+163,255,116,0,1,3,234,255,162,0,1,2,243,0,3,0,1,3,140,0,0,0,1,3,2,254,245,
+0,1,2,255,255,98,0,1,2,255,254,74,0,1,3,250,254,205,0,1,3,206,254,139,0,1,
+3,169,254,74,0,1,3,23,254,84,0,1,3,150,254,164,0,1,2,240,255,136,0,1,3,193,
+255,117,0,1,4,28,255,45,0,1,3,3,255,232,0,1,3,53,255,90,0,1,5,218,0,34,0,
+1,3,215,255,136,0,1,3,215,255,182,0,1,3,201,255,101,0,1,3,142,255,182,0,1,
+3,147,255,70,0,1,3,9,255,232,0,1,7,81,255,231,0,1,4,14,255,165,0,1,4,224,
+255,23,0,1,7,150,255,232,0,1,5,6,255,227,0,1,4,154,255,154,0,1,5,103,254,
+174,0,1,5,13,255,37,0,1,3,16,254,181,0,1,8,142,255,20,0,1,3,42,255,230,0,
+1,2,179,255,71,0,1,5,26,254,228,0,1,3,168,254,231,0,1,4,164,254,190,0,1,7,
+139,255,146,0,1,5,48,255,23,0,1,5,149,255,208,0,1,4,154,255,88,0,1,4,12,255,
+123,0,1,5,165,255,223,0,1,3,170,255,3,0,1,4,40,255,63,0,1,3,75,254,217,0,
+1,4,216,254,197,0,1,3,105,254,82,0,1,5,77,254,249,0,1,3,62,255,143,0,1,3,
+143,254,112,0,1,3,132,255,183,0,1,5,106,255,204,0,1,4,159,255,68,0,1,4,148,
+255,135,0,1,3,161,255,86,0,1,2,252,255,92,0,1,5,69,255,223,0,1,3,56,255,233,
+0,1,6,61,255,222,0,1,4,117,254,255,0,1,4,88,254,181,0,1,4,35,254,236,0,1,
+5,110,254,162,0,1,3,168,254,99,0,1,5,242,255,42,0,1,4,227,255,149,0,1,3,11,
+255,136,0,1,3,64,254,185,0,1,3,159,254,150,0,1,3,163,255,99,0,1,5,173,255,
+158,0,1,3,133,255,231,0,1,5,80,255,150,0,1,3,173,255,60,0,1,3,162,255,183,
+0,1,4,37,254,174,0,1,5,247,255,201,0,1,5,145,255,127,0,1,4,26,254,136,0,1,
+6,61,255,176,0,1,4,76,255,108,0,1,4,76,254,30,0,1,6,105,255,121,0,1,4,23,
+254,56,0,1,5,227,255,199,0,1,5,163,255,222,0,1,4,21,254,253,0,1,3,215,255,
+21,0,1,2,141,0,0,0,1,4,182,254,216,0,1,2,253,255,119,0,1,4,23,255,106,0,1,
+3,170,255,232,0,1,5,1,255,141,0,1,3,34,0,0,0,1,5,37,254,229,0,1,5,199,255,
+178,0,1,3,252,255,124,0,1,3,126,254,21,0,1,3,84,255,60,0,1,3,118,255,126,
+0,1,5,123,255,119,0,1,3,141,253,113,0,1,2,114,255,170,0,1,3,198,255,233,0,
+1,3,94,254,34,0,1,3,250,254,225,0,1,6,204,255,87,0,1,12,176,12,186,0,1,0,
+12,0,38,0,6,0,0,2,12,0,0,2,12,0,0,2,12,0,0,2,12,0,0,2,12,0,0,2,12,0,248,1,
+248,1,254,2,4,2,10,2,16,2,22,2,28,2,34,2,40,2,46,2,52,2,58,2,64,2,70,2,76,
+2,82,1,248,1,254,2,4,2,10,2,16,2,22,2,28,2,34,2,40,2,46,2,52,2,58,2,64,2,
+70,2,76,2,82,2,88,2,94,2,100,2,106,2,112,2,118,2,124,2,130,2,136,2,142,2,
+148,2,154,2,160,2,166,2,172,2,178,2,184,2,190,2,196,2,202,2,208,2,214,2,220,
+2,208,2,226,2,232,2,238,2,244,2,250,3,0,3,6,3,12,3,18,3,24,3,30,3,36,3,42,
+3,48,3,54,3,60,3,66,3,72,3,78,3,84,3,90,3,96,3,102,3,108,3,114,3,120,3,126,
+3,48,3,132,3,138,3,144,3,150,3,156,3,162,3,168,3,174,3,180,3,186,3,192,3,
+198,3,204,3,210,3,216,3,222,3,228,3,234,3,240,3,246,3,252,4,2,4,8,4,14,4,
+20,4,26,4,32,4,38,4,44,4,50,4,56,4,62,4,68,4,74,4,80,4,86,4,92,4,98,4,104,
+4,110,4,116,4,122,4,128,4,134,4,140,4,146,4,152,4,158,4,164,4,170,4,176,4,
+182,4,188,2,130,4,194,4,200,4,206,2,142,4,212,4,218,4,224,4,230,4,236,4,242,
+4,248,4,254,5,4,5,10,5,16,5,22,5,28,5,34,5,40,5,46,5,52,5,58,2,190,5,64,5,
+70,5,76,5,82,5,88,5,94,5,100,5,106,5,112,5,118,5,124,5,130,5,136,5,142,5,
+148,5,154,5,160,5,166,5,172,5,178,5,184,5,190,5,196,5,202,5,208,5,214,5,220,
+5,226,5,232,5,238,5,244,5,250,6,0,6,6,6,12,6,18,6,24,6,30,6,36,6,42,6,48,
+6,54,6,60,2,232,6,66,6,72,6,78,6,84,6,90,6,96,6,102,6,108,6,114,6,120,6,126,
+6,132,6,138,6,144,6,150,6,156,6,162,6,168,6,174,6,180,6,186,6,192,6,198,6,
+204,6,210,6,216,6,222,6,228,6,234,6,240,6,246,6,252,7,2,7,8,4,98,7,14,7,20,
+7,26,7,32,7,38,7,44,7,50,7,56,0,1,255,99,0,0,0,1,3,94,255,232,0,1,3,118,0,
+25,0,1,2,94,0,41,0,1,2,120,0,76,0,1,6,7,255,167,0,1,3,89,255,232,0,1,4,134,
+255,233,0,1,2,133,0,31,0,1,2,219,255,201,0,1,3,146,0,12,0,1,2,67,0,0,0,1,
+3,77,0,36,0,1,3,163,255,225,0,1,3,160,255,232,0,1,3,153,0,12,0,1,2,62,0,143,
+0,1,2,229,255,108,0,1,3,186,255,108,0,1,3,215,255,108,0,1,3,123,255,128,0,
+1,3,41,255,45,0,1,2,210,255,1,0,1,3,65,254,174,0,1,5,91,254,124,0,1,3,16,
+255,99,0,1,4,61,254,148,0,1,3,5,255,99,0,1,2,239,254,251,0,1,3,68,255,70,
+0,1,2,215,255,101,0,1,3,130,255,232,0,1,3,56,255,85,0,1,3,203,255,45,0,1,
+3,62,255,109,0,1,3,130,255,136,0,1,4,35,255,199,0,1,3,150,255,65,0,1,3,138,
+255,24,0,1,3,111,255,232,0,1,2,255,254,254,0,1,3,163,255,116,0,1,3,234,255,
+162,0,1,2,243,0,3,0,1,3,140,0,0,0,1,3,2,254,245,0,1,2,255,255,98,0,1,2,255,
+254,74,0,1,3,250,254,205,0,1,3,206,254,139,0,1,3,169,254,74,0,1,3,23,254,
+84,0,1,3,150,254,164,0,1,4,9,255,184,0,1,4,9,255,194,0,1,3,213,255,197,0,
+1,3,174,255,111,0,1,3,113,254,240,0,1,3,118,254,216,0,1,6,19,255,13,0,1,3,
+106,255,197,0,1,4,40,255,63,0,1,3,110,255,84,0,1,3,100,254,216,0,1,3,173,
+254,200,0,1,3,110,254,186,0,1,3,240,255,224,0,1,4,19,255,80,0,1,4,78,255,
+236,0,1,3,218,255,197,0,1,3,219,255,197,0,1,4,85,255,197,0,1,3,234,255,197,
+0,1,3,144,255,197,0,1,3,181,255,197,0,1,3,164,255,197,0,1,3,234,255,40,0,
+1,3,144,255,113,0,1,4,198,255,131,0,1,4,94,255,197,0,1,3,78,255,197,0,1,3,
+170,255,197,0,1,3,145,254,216,0,1,3,144,255,233,0,1,3,144,255,96,0,1,4,10,
+255,137,0,1,4,28,254,186,0,1,3,169,254,107,0,1,3,110,254,85,0,1,3,234,254,
+172,0,1,2,240,255,136,0,1,2,248,255,195,0,1,3,166,254,109,0,1,3,168,255,168,
+0,1,3,206,254,51,0,1,4,31,254,89,0,1,3,3,255,232,0,1,3,53,255,90,0,1,5,213,
+255,233,0,1,3,239,255,52,0,1,6,53,255,216,0,1,3,215,255,136,0,1,3,215,255,
+182,0,1,3,201,255,101,0,1,3,142,255,182,0,1,3,147,255,70,0,1,3,9,255,232,
+0,1,3,125,254,216,0,1,7,81,255,231,0,1,4,114,255,199,0,1,4,224,255,23,0,1,
+7,150,255,232,0,1,4,111,0,41,0,1,5,11,0,45,0,1,5,103,254,174,0,1,5,109,255,
+31,0,1,5,13,255,81,0,1,3,16,255,0,0,1,8,182,255,164,0,1,8,29,254,6,0,1,3,
+42,255,230,0,1,2,99,255,171,0,1,5,99,255,88,0,1,3,85,255,63,0,1,4,164,255,
+23,0,1,7,3,255,247,0,1,5,48,255,23,0,1,5,25,0,0,0,1,5,193,255,84,0,1,4,85,
+255,204,0,1,3,249,255,235,0,1,4,135,254,107,0,1,5,34,255,254,0,1,3,170,255,
+113,0,1,3,202,255,147,0,1,3,196,254,11,0,1,3,75,255,60,0,1,4,216,255,23,0,
+1,3,105,254,206,0,1,5,2,255,206,0,1,5,77,254,249,0,1,3,62,254,42,0,1,3,62,
+255,143,0,1,3,24,254,217,0,1,3,238,254,127,0,1,4,111,255,231,0,1,3,132,255,
+182,0,1,4,201,255,232,0,1,5,14,0,27,0,1,5,122,255,84,0,1,4,33,255,211,0,1,
+4,49,255,218,0,1,4,145,254,218,0,1,3,15,255,177,0,1,3,81,254,21,0,1,5,66,
+255,31,0,1,2,214,255,201,0,1,3,147,254,131,0,1,5,173,255,197,0,1,5,120,255,
+109,0,1,6,2,255,200,0,1,3,56,255,233,0,1,3,122,254,216,0,1,6,3,0,21,0,1,4,
+26,255,97,0,1,4,88,255,43,0,1,4,36,255,117,0,1,4,230,254,239,0,1,3,168,254,
+206,0,1,6,48,255,164,0,1,5,58,255,202,0,1,5,172,255,183,0,1,3,11,255,136,
+0,1,3,40,254,223,0,1,3,64,255,60,0,1,3,159,254,200,0,1,3,94,255,190,0,1,6,
+11,255,184,0,1,3,133,255,232,0,1,5,80,255,161,0,1,3,129,254,216,0,1,3,18,
+255,146,0,1,4,20,255,66,0,1,3,162,255,183,0,1,4,37,254,174,0,1,5,168,0,21,
+0,1,6,43,255,84,0,1,5,68,0,5,0,1,5,159,254,200,0,1,4,26,255,30,0,1,6,149,
+255,212,0,1,4,76,255,141,0,1,4,76,254,184,0,1,6,105,255,187,0,1,4,23,254,
+176,0,1,5,113,0,11,0,1,5,152,0,66,0,1,3,186,255,93,0,1,3,215,255,133,0,1,
+2,141,0,0,0,1,4,182,254,216,0,1,2,70,255,203,0,1,3,144,254,117,0,1,3,102,
+255,202,0,1,3,170,255,232,0,1,5,1,255,141,0,1,3,34,0,0,0,1,5,78,254,216,0,
+1,5,37,255,41,0,1,5,151,0,16,0,1,6,39,255,84,0,1,3,132,255,205,0,1,3,126,
+254,21,0,1,5,86,255,81,0,1,3,36,255,209,0,1,3,117,255,232,0,1,5,123,255,161,
+0,1,5,63,255,232,0,1,3,142,254,100,0,1,2,45,0,125,0,1,3,198,255,232,0,1,3,
+94,254,185,0,1,3,250,254,225,0,1,6,204,255,87,0,1,3,246,0,12,0,1,3,52,0,30,
+0,1,6,56,6,62,0,1,0,12,0,18,0,1,0,0,0,80,0,36,0,80,0,86,0,92,0,98,0,104,0,
+110,0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,80,
+0,86,0,92,0,98,0,104,0,110,0,116,0,122,0,128,0,134,0,140,0,146,0,152,0,158,
+0,164,0,170,0,176,0,182,0,188,0,1,255,82,0,0,0,1,3,94,0,0,0,1,3,15,0,73,0,
+1,1,175,0,74,0,1,2,39,0,99,0,1,5,250,255,253,0,1,3,89,255,233,0,1,4,134,255,
+234,0,1,2,9,0,72,0,1,2,166,0,1,0,1,3,74,0,73,0,1,1,215,0,73,0,1,3,65,0,97,
+0,1,3,153,0,18,0,1,3,160,255,255,0,1,3,26,0,93,0,1,2,18,0,81,0,1,3,112,0,
+0,0,1,6,19,255,13,0,1,3,192,0,74,0,1,4,120,3,60,0,1,0,12,0,38,0,6,0,0,0,32,
+0,0,0,32,0,0,0,32,0,0,0,32,0,0,0,32,0,0,0,32,0,2,0,12,0,18,0,1,255,99,0,0,
+0,1,255,83,254,155,0,1,255,83,254,170,0,1,0,2,0,69,2,24,0,2,0,64,0,4,0,4,
+0,0,0,6,0,9,0,1,0,12,0,12,0,5,0,14,0,17,0,6,0,19,0,20,0,10,0,31,0,32,0,12,
+0,35,0,39,0,14,0,41,0,45,0,19,0,47,0,47,0,24,0,49,0,51,0,25,0,53,0,57,0,28,
+0,59,0,59,0,33,0,61,0,63,0,34,0,65,0,67,0,37,0,102,0,102,0,40,0,105,0,109,
+0,41,0,111,0,115,0,46,0,117,0,117,0,51,0,119,0,121,0,52,0,123,0,127,0,55,
+0,129,0,131,0,60,0,133,0,133,0,63,0,175,0,175,0,64,0,178,0,182,0,65,0,184,
+0,188,0,70,0,190,0,190,0,75,0,192,0,194,0,76,0,196,0,200,0,79,0,202,0,204,
+0,84,0,206,0,207,0,87,0,210,0,214,0,89,0,216,0,220,0,94,0,222,0,222,0,99,
+0,224,0,226,0,100,0,228,0,234,0,103,0,236,0,246,0,110,0,249,0,253,0,121,0,
+255,1,3,0,126,1,5,1,5,0,131,1,7,1,9,0,132,1,11,1,17,0,135,1,19,1,38,0,142,
+1,40,1,41,0,162,1,43,1,43,0,164,1,45,1,48,0,165,1,50,1,68,0,169,1,71,1,78,
+0,188,1,81,1,83,0,196,1,85,1,87,0,199,1,89,1,119,0,202,1,122,1,122,0,233,
+1,124,1,136,0,234,1,139,1,161,0,247,1,163,1,163,1,14,1,165,1,170,1,15,1,172,
+1,175,1,21,1,177,1,183,1,25,1,186,1,235,1,32,1,237,1,237,1,82,1,239,1,242,
+1,83,1,244,1,247,1,87,1,250,1,252,1,91,1,254,2,18,1,94,2,22,2,23,1,115,0,
+1,0,1,0,134,0,2,0,60,0,4,0,4,0,0,0,6,0,9,0,1,0,12,0,12,0,5,0,14,0,17,0,6,
+0,32,0,32,0,10,0,35,0,39,0,11,0,41,0,45,0,16,0,47,0,47,0,21,0,49,0,51,0,22,
+0,53,0,57,0,25,0,59,0,59,0,30,0,61,0,63,0,31,0,65,0,67,0,34,0,102,0,102,0,
+37,0,105,0,109,0,38,0,111,0,115,0,43,0,117,0,117,0,48,0,119,0,121,0,49,0,
+123,0,127,0,52,0,129,0,131,0,57,0,133,0,133,0,60,0,175,0,175,0,61,0,178,0,
+182,0,62,0,184,0,188,0,67,0,190,0,190,0,72,0,192,0,194,0,73,0,196,0,200,0,
+76,0,202,0,204,0,81,0,206,0,207,0,84,0,210,0,214,0,86,0,216,0,220,0,91,0,
+222,0,222,0,96,0,224,0,226,0,97,0,228,0,234,0,100,0,236,0,246,0,107,0,249,
+0,253,0,118,0,255,1,3,0,123,1,5,1,5,0,128,1,7,1,9,0,129,1,11,1,17,0,132,1,
+19,1,38,0,139,1,40,1,41,0,159,1,43,1,43,0,161,1,45,1,48,0,162,1,50,1,68,0,
+166,1,71,1,78,0,185,1,81,1,83,0,193,1,85,1,87,0,196,1,89,1,119,0,199,1,122,
+1,122,0,230,1,124,1,136,0,231,1,139,1,161,0,244,1,163,1,163,1,11,1,165,1,
+170,1,12,1,172,1,175,1,18,1,177,1,183,1,22,1,186,1,234,1,29,1,237,1,245,1,
+78,1,247,2,18,1,87,2,22,2,23,1,115,0,1,0,2,0,135,0,137,0,1,0,152,0,32,0,36,
+0,37,0,38,0,66,0,67,0,102,0,106,0,107,0,108,0,207,0,208,0,209,0,210,0,211,
+0,212,0,213,0,214,0,215,0,216,0,217,0,218,0,219,0,220,0,221,0,222,0,223,0,
+224,0,226,0,227,0,228,0,230,0,231,0,232,0,233,0,234,0,235,0,236,0,237,0,238,
+0,239,0,240,0,241,0,242,0,243,0,244,0,245,1,29,1,30,1,32,1,35,1,37,1,40,1,
+41,1,42,1,44,1,45,1,46,1,47,1,49,1,50,1,52,1,53,1,54,1,55,1,56,1,58,1,59,
+1,60,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,71,1,72,1,73,1,75,1,76,1,78,1,79,
+1,82,1,85,1,86,1,87,1,91,1,92,1,94,1,95,1,98,1,100,1,102,1,103,1,105,1,108,
+1,110,1,113,1,118,1,119,1,121,1,123,1,125,1,126,1,127,1,128,1,130,1,131,1,
+132,1,133,1,134,1,135,1,136,1,139,1,141,1,144,1,146,1,147,1,148,1,150,1,152,
+1,153,1,154,1,155,1,156,1,158,1,159,1,160,1,161,1,164,1,165,1,166,1,167,1,
+169,1,170,1,172,1,174,1,176,1,177,1,179,1,180,1,182,1,183,1,186,1,188,1,189,
+1,190,1,191,1,192,1,193,1,194,0,2,0,1,0,21,0,26,0,0,0,2,0,37,0,32,0,32,0,
+0,0,36,0,45,0,1,0,47,0,47,0,11,0,49,0,49,0,12,0,53,0,53,0,13,0,55,0,55,0,
+14,0,63,0,63,0,15,0,102,0,102,0,16,0,106,0,115,0,17,0,117,0,117,0,27,0,119,
+0,119,0,28,0,123,0,124,0,29,0,131,0,131,0,31,0,207,0,224,0,32,0,226,0,228,
+0,50,0,230,0,247,0,53,0,249,1,35,0,71,1,37,1,42,0,114,1,44,1,50,0,120,1,52,
+1,68,0,127,1,71,1,79,0,144,1,82,1,83,0,153,1,85,1,87,0,155,1,90,1,114,0,158,
+1,118,1,119,0,183,1,121,1,121,0,185,1,123,1,123,0,186,1,125,1,136,0,187,1,
+139,1,142,0,199,1,144,1,144,0,203,1,146,1,156,0,204,1,158,1,161,0,215,1,164,
+1,170,0,219,1,172,1,172,0,226,1,174,1,183,0,227,1,186,1,194,0,237,2,22,2,
+23,0,246,0,1,0,1,0,71,0,1,0,36,0,32,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,
+43,0,44,0,45,0,47,0,49,0,53,0,55,0,63,0,65,0,102,0,106,0,107,0,108,0,109,
+0,110,0,111,0,112,0,113,0,114,0,115,0,117,0,119,0,123,0,124,0,131,0,133,0,
+253,1,54,0,0,0,1,0,0,0,10,0,118,2,24,0,3,68,70,76,84,0,20,98,101,110,103,
+0,50,98,110,103,50,0,78,0,4,0,0,0,0,255,255,0,10,0,0,0,3,0,6,0,8,0,11,0,14,
+0,17,0,20,0,23,0,26,0,4,0,0,0,0,255,255,0,9,0,1,0,4,0,9,0,12,0,15,0,18,0,
+21,0,24,0,27,0,4,0,0,0,0,255,255,0,10,0,2,0,5,0,7,0,10,0,13,0,16,0,19,0,22,
+0,25,0,28,0,29,97,107,104,110,0,176,97,107,104,110,0,184,97,107,104,110,0,
+192,98,108,119,102,0,200,98,108,119,102,0,206,98,108,119,102,0,212,99,106,
+99,116,0,218,99,106,99,116,0,224,104,97,108,102,0,230,104,97,108,102,0,236,
+104,97,108,102,0,242,104,97,108,110,0,248,104,97,108,110,0,254,104,97,108,
+110,1,4,105,110,105,116,1,10,105,110,105,116,1,16,105,110,105,116,1,22,110,
+117,107,116,1,28,110,117,107,116,1,34,110,117,107,116,1,40,112,114,101,115,
+1,46,112,114,101,115,1,72,112,114,101,115,1,100,112,115,116,102,1,126,112,
+115,116,102,1,132,112,115,116,102,1,138,114,112,104,102,1,144,114,112,104,
+102,1,150,114,112,104,102,1,156,0,0,0,2,0,4,0,5,0,0,0,2,0,4,0,5,0,0,0,2,0,
+4,0,5,0,0,0,1,0,7,0,0,0,1,0,8,0,0,0,1,0,7,0,0,0,1,0,12,0,0,0,1,0,12,0,0,0,
+1,0,9,0,0,0,1,0,9,0,0,0,1,0,9,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,
+0,1,0,13,0,0,0,1,0,13,0,0,0,1,0,13,0,0,0,1,0,3,0,0,0,1,0,3,0,0,0,1,0,3,0,
+0,0,11,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,0,0,12,0,
+12,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,0,0,11,0,14,0,
+15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,0,0,1,0,10,0,0,0,1,0,11,
+0,0,0,1,0,10,0,0,0,1,0,6,0,0,0,1,0,6,0,0,0,1,0,6,0,30,0,62,0,70,0,78,0,86,
+0,94,0,102,0,110,0,118,0,126,0,134,0,142,0,150,0,158,0,166,0,174,0,184,0,
+192,0,200,0,208,0,216,0,224,0,232,0,242,0,250,1,4,1,12,1,20,1,28,1,36,1,44,
+0,1,0,0,0,1,0,246,0,1,0,0,0,1,0,248,0,1,0,0,0,1,0,250,0,4,0,0,0,1,0,252,0,
+4,0,0,0,1,2,122,0,6,0,0,0,1,2,148,0,4,0,0,0,1,2,160,0,4,0,0,0,1,2,182,0,4,
+0,0,0,1,2,208,0,4,0,0,0,1,2,242,0,4,0,0,0,1,3,188,0,4,0,0,0,1,3,198,0,4,0,
+0,0,1,3,208,0,1,0,0,0,1,4,240,0,6,0,0,0,2,4,238,5,4,0,6,0,0,0,1,5,16,0,4,
+0,0,0,1,5,30,0,4,0,0,0,1,8,180,0,4,0,0,0,1,10,242,0,4,0,8,0,1,13,254,0,4,
+0,0,0,1,16,4,0,6,0,0,0,2,17,42,17,60,0,4,0,0,0,1,17,68,0,6,0,0,0,2,17,108,
+17,128,0,6,0,0,0,1,17,138,0,4,0,0,0,1,17,150,0,4,0,0,0,1,19,248,0,1,0,0,0,
+1,20,2,0,1,0,0,0,1,20,6,0,1,0,0,0,1,20,4,0,2,20,8,0,2,0,69,0,18,0,2,20,6,
+0,2,0,136,0,69,0,2,20,4,0,2,0,69,0,31,0,1,20,2,0,32,0,70,0,80,0,90,0,100,
+0,110,0,120,0,130,0,140,0,150,0,160,0,170,0,180,0,190,0,200,0,210,0,220,0,
+230,0,240,0,250,1,4,1,14,1,24,1,34,1,44,1,54,1,64,1,74,1,84,1,94,1,104,1,
+114,1,124,0,1,0,4,0,102,0,2,0,72,0,1,0,4,0,103,0,2,0,72,0,1,0,4,0,104,0,2,
+0,72,0,1,0,4,0,105,0,2,0,72,0,1,0,4,0,106,0,2,0,72,0,1,0,4,0,107,0,2,0,72,
+0,1,0,4,0,108,0,2,0,72,0,1,0,4,0,109,0,2,0,72,0,1,0,4,0,110,0,2,0,72,0,1,
+0,4,0,111,0,2,0,72,0,1,0,4,0,112,0,2,0,72,0,1,0,4,0,113,0,2,0,72,0,1,0,4,
+0,114,0,2,0,72,0,1,0,4,0,115,0,2,0,72,0,1,0,4,0,116,0,2,0,72,0,1,0,4,0,117,
+0,2,0,72,0,1,0,4,0,118,0,2,0,72,0,1,0,4,0,119,0,2,0,72,0,1,0,4,0,120,0,2,
+0,72,0,1,0,4,0,121,0,2,0,72,0,1,0,4,0,122,0,2,0,72,0,1,0,4,0,123,0,2,0,72,
+0,1,0,4,0,124,0,2,0,72,0,1,0,4,0,125,0,2,0,72,0,1,0,4,0,126,0,2,0,72,0,1,
+0,4,0,127,0,2,0,72,0,1,0,4,0,128,0,2,0,72,0,1,0,4,0,129,0,2,0,72,0,1,0,4,
+0,130,0,2,0,72,0,1,0,4,0,131,0,2,0,72,0,1,0,4,0,132,0,2,0,72,0,1,0,4,0,133,
+0,2,0,72,0,1,18,146,0,2,0,10,0,22,0,1,0,4,0,66,0,3,0,71,0,61,0,1,0,4,0,67,
+0,3,0,71,0,41,0,3,0,0,0,2,18,120,18,126,0,1,18,132,0,1,0,0,0,26,0,1,18,118,
+0,2,0,10,0,20,0,1,0,4,0,134,0,2,0,71,0,1,0,4,0,134,0,2,0,71,0,1,18,76,0,1,
+0,8,0,3,0,8,0,14,0,20,0,135,0,2,0,54,0,137,0,2,0,58,0,137,0,2,0,64,0,1,18,
+62,0,3,0,12,0,22,0,32,0,1,0,4,0,135,0,2,0,71,0,1,0,4,0,137,0,2,0,71,0,1,0,
+4,0,137,0,2,0,71,0,1,18,30,0,17,0,40,0,50,0,60,0,70,0,80,0,90,0,100,0,110,
+0,120,0,130,0,140,0,150,0,160,0,170,0,180,0,190,0,200,0,1,0,4,0,139,0,2,0,
+71,0,1,0,4,0,141,0,2,0,71,0,1,0,4,0,143,0,2,0,71,0,1,0,4,0,144,0,2,0,71,0,
+1,0,4,0,149,0,2,0,71,0,1,0,4,0,151,0,2,0,71,0,1,0,4,0,152,0,2,0,71,0,1,0,
+4,0,153,0,2,0,71,0,1,0,4,0,156,0,2,0,71,0,1,0,4,0,158,0,2,0,71,0,1,0,4,0,
+159,0,2,0,71,0,1,0,4,0,161,0,2,0,71,0,1,0,4,0,163,0,2,0,71,0,1,0,4,0,166,
+0,2,0,71,0,1,0,4,0,167,0,2,0,71,0,1,0,4,0,168,0,2,0,71,0,1,0,4,0,169,0,2,
+0,71,0,1,17,46,0,1,0,8,0,1,0,4,0,136,0,2,0,57,0,1,17,96,0,1,0,8,0,1,0,4,0,
+136,0,2,0,71,0,1,17,84,0,10,0,26,0,48,0,70,0,112,0,164,0,186,0,208,0,220,
+1,6,1,28,0,2,0,6,0,14,1,45,0,3,0,71,0,51,1,46,0,3,0,71,0,59,0,2,0,6,0,14,
+1,60,0,3,0,71,0,39,1,62,0,3,0,71,0,40,0,4,0,10,0,18,0,26,0,34,1,63,0,3,0,
+71,0,37,1,64,0,3,0,71,0,38,1,65,0,3,0,71,0,39,1,66,0,3,0,71,0,40,0,5,0,12,
+0,20,0,28,0,36,0,44,1,82,0,3,0,71,0,47,1,84,0,3,0,71,0,48,1,85,0,3,0,71,0,
+51,1,86,0,3,0,71,0,56,1,87,0,3,0,71,0,59,0,2,0,6,0,14,1,98,0,3,0,71,0,51,
+1,99,0,3,0,71,0,56,0,2,0,6,0,14,1,125,0,3,0,71,0,42,1,126,0,3,0,71,0,59,0,
+1,0,4,1,133,0,3,0,71,0,59,0,4,0,10,0,18,0,26,0,34,1,189,0,3,0,71,0,46,1,190,
+0,3,0,71,0,51,1,191,0,3,0,71,0,56,1,192,0,3,0,71,0,59,0,2,0,6,0,14,1,193,
+0,3,0,71,0,46,1,194,0,3,0,71,0,56,0,1,0,4,1,70,0,3,0,71,0,34,0,1,16,68,1,
+248,0,3,0,0,0,2,16,70,16,76,0,0,0,2,0,0,0,0,0,1,0,0,0,3,0,0,0,2,16,54,16,
+60,0,0,0,2,0,0,0,2,0,1,0,2,0,3,0,0,0,2,16,44,16,32,0,0,0,2,0,0,0,1,0,1,0,
+1,0,1,16,28,0,16,0,38,0,96,0,146,0,196,0,230,0,248,1,18,1,76,1,134,1,216,
+2,18,2,60,2,134,2,224,3,18,3,76,0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,1,
+29,0,2,0,32,1,30,0,2,0,42,1,32,0,2,0,47,1,35,0,2,0,51,1,36,0,2,0,56,1,37,
+0,2,0,59,1,38,0,2,0,62,0,6,0,14,0,20,0,26,0,32,0,38,0,44,1,39,0,2,0,34,1,
+40,0,2,0,49,1,41,0,2,0,50,1,42,0,2,0,51,1,43,0,2,0,56,1,44,0,2,0,59,0,6,0,
+14,0,20,0,26,0,32,0,38,0,44,1,47,0,2,0,32,1,49,0,2,0,33,1,50,0,2,0,34,1,51,
+0,2,0,35,1,52,0,2,0,56,1,53,0,2,0,66,0,4,0,10,0,16,0,22,0,28,1,54,0,2,0,37,
+1,55,0,2,0,38,1,58,0,2,0,41,1,59,0,2,0,51,0,2,0,6,0,12,1,67,0,2,0,42,1,68,
+0,2,0,56,0,3,0,8,0,14,0,20,1,69,0,2,0,34,1,71,0,2,0,44,1,72,0,2,0,56,0,7,
+0,16,0,22,0,28,0,34,0,40,0,46,0,52,1,73,0,2,0,42,1,75,0,2,0,43,1,76,0,2,0,
+44,1,78,0,2,0,45,1,79,0,2,0,46,1,80,0,2,0,51,1,81,0,2,0,56,0,7,0,16,0,22,
+0,28,0,34,0,40,0,46,0,52,1,88,0,2,0,34,1,89,0,2,0,35,1,90,0,2,0,49,1,92,0,
+2,0,50,1,94,0,2,0,51,1,95,0,2,0,55,1,97,0,2,0,56,0,10,0,22,0,28,0,34,0,40,
+0,46,0,52,0,58,0,64,0,70,0,76,1,100,0,2,0,42,1,102,0,2,0,43,1,103,0,2,0,44,
+1,105,0,2,0,47,1,108,0,2,0,48,1,110,0,2,0,49,1,113,0,2,0,50,1,115,0,2,0,51,
+1,116,0,2,0,56,1,117,0,2,0,62,0,7,0,16,0,22,0,28,0,34,0,40,0,46,0,52,1,118,
+0,2,0,42,1,119,0,2,0,47,1,120,0,2,0,51,1,121,0,2,0,52,1,122,0,2,0,56,1,123,
+0,2,0,59,1,124,0,2,0,62,0,5,0,12,0,18,0,24,0,30,0,36,1,127,0,2,0,39,1,128,
+0,2,0,49,1,130,0,2,0,50,1,131,0,2,0,55,1,132,0,2,0,59,0,9,0,20,0,26,0,32,
+0,38,0,44,0,50,0,56,0,62,0,68,1,134,0,2,0,47,1,135,0,2,0,49,1,136,0,2,0,51,
+1,137,0,2,0,52,1,139,0,2,0,53,1,141,0,2,0,55,1,143,0,2,0,56,1,144,0,2,0,59,
+1,145,0,2,0,62,0,11,0,24,0,30,0,36,0,42,0,48,0,54,0,60,0,66,0,72,0,78,0,84,
+1,146,0,2,0,32,1,147,0,2,0,34,1,148,0,2,0,42,1,150,0,2,0,44,1,152,0,2,0,47,
+1,153,0,2,0,49,1,154,0,2,0,50,1,155,0,2,0,52,1,156,0,2,0,53,1,157,0,2,0,56,
+1,158,0,2,0,59,0,6,0,14,0,20,0,26,0,32,0,38,0,44,1,159,0,2,0,37,1,160,0,2,
+0,38,1,161,0,2,0,47,1,162,0,2,0,51,1,163,0,2,0,56,1,164,0,2,0,59,0,7,0,16,
+0,22,0,28,0,34,0,40,0,46,0,52,1,165,0,2,0,32,1,167,0,2,0,42,1,169,0,2,0,43,
+1,170,0,2,0,46,1,171,0,2,0,52,1,172,0,2,0,53,1,173,0,2,0,56,0,10,0,22,0,28,
+0,34,0,40,0,46,0,52,0,58,0,64,0,70,0,76,1,174,0,2,0,32,1,176,0,2,0,33,1,177,
+0,2,0,42,1,179,0,2,0,47,1,182,0,2,0,48,1,183,0,2,0,51,1,184,0,2,0,52,1,186,
+0,2,0,53,1,187,0,2,0,56,1,188,0,2,0,59,0,1,12,162,0,48,0,102,0,112,0,122,
+0,132,0,142,0,152,0,162,0,172,0,182,0,192,0,202,0,212,0,222,0,232,0,242,0,
+252,1,6,1,16,1,26,1,36,1,46,1,56,1,66,1,76,1,86,1,96,1,106,1,116,1,126,1,
+136,1,146,1,156,1,166,1,176,1,186,1,196,1,206,1,216,1,226,1,236,1,246,2,0,
+2,10,2,20,2,30,2,40,2,50,2,60,0,1,0,4,0,207,0,2,0,135,0,1,0,4,0,208,0,2,0,
+135,0,1,0,4,0,209,0,2,0,135,0,1,0,4,0,210,0,2,0,135,0,1,0,4,0,211,0,2,0,135,
+0,1,0,4,0,212,0,2,0,135,0,1,0,4,0,213,0,2,0,135,0,1,0,4,0,214,0,2,0,135,0,
+1,0,4,0,215,0,2,0,135,0,1,0,4,0,216,0,2,0,135,0,1,0,4,0,217,0,2,0,135,0,1,
+0,4,0,218,0,2,0,135,0,1,0,4,0,219,0,2,0,135,0,1,0,4,0,220,0,2,0,135,0,1,0,
+4,0,221,0,2,0,135,0,1,0,4,0,222,0,2,0,135,0,1,0,4,0,223,0,2,0,135,0,1,0,4,
+0,224,0,2,0,135,0,1,0,4,0,225,0,2,0,135,0,1,0,4,0,226,0,2,0,135,0,1,0,4,0,
+227,0,2,0,135,0,1,0,4,0,228,0,2,0,135,0,1,0,4,0,229,0,2,0,135,0,1,0,4,0,230,
+0,2,0,135,0,1,0,4,0,231,0,2,0,135,0,1,0,4,0,232,0,2,0,135,0,1,0,4,0,233,0,
+2,0,135,0,1,0,4,0,234,0,2,0,135,0,1,0,4,0,235,0,2,0,135,0,1,0,4,0,236,0,2,
+0,135,0,1,0,4,0,237,0,2,0,135,0,1,0,4,0,238,0,2,0,135,0,1,0,4,0,239,0,2,0,
+135,0,1,0,4,0,240,0,2,0,135,0,1,0,4,0,241,0,2,0,135,0,1,0,4,0,242,0,2,0,135,
+0,1,0,4,0,243,0,2,0,135,0,1,0,4,0,244,0,2,0,135,0,1,0,4,0,245,0,2,0,135,0,
+1,0,4,1,33,0,2,0,135,0,1,0,4,1,56,0,2,0,135,0,1,0,4,1,61,0,2,0,135,0,1,0,
+4,1,83,0,2,0,135,0,1,0,4,1,91,0,2,0,135,0,1,0,4,1,93,0,2,0,135,0,1,0,4,1,
+106,0,2,0,135,0,1,0,4,1,111,0,2,0,135,0,1,0,4,1,180,0,2,0,135,0,1,10,168,
+0,65,0,136,0,146,0,156,0,166,0,176,0,186,0,196,0,206,0,216,0,226,0,236,0,
+246,1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,1,80,1,90,1,100,1,110,1,120,1,
+130,1,140,1,150,1,160,1,170,1,180,1,190,1,200,1,210,1,220,1,230,1,240,1,250,
+2,4,2,14,2,26,2,36,2,46,2,56,2,66,2,76,2,86,2,96,2,106,2,116,2,126,2,136,
+2,146,2,156,2,166,2,176,2,186,2,196,2,206,2,216,2,226,2,236,2,246,3,0,3,10,
+0,1,0,4,0,246,0,2,0,137,0,1,0,4,0,247,0,2,0,137,0,1,0,4,0,248,0,2,0,137,0,
+1,0,4,0,249,0,2,0,137,0,1,0,4,0,250,0,2,0,137,0,1,0,4,0,251,0,2,0,137,0,1,
+0,4,0,252,0,2,0,137,0,1,0,4,0,253,0,2,0,137,0,1,0,4,0,254,0,2,0,137,0,1,0,
+4,0,255,0,2,0,137,0,1,0,4,1,0,0,2,0,137,0,1,0,4,1,1,0,2,0,137,0,1,0,4,1,2,
+0,2,0,137,0,1,0,4,1,3,0,2,0,137,0,1,0,4,1,4,0,2,0,137,0,1,0,4,1,5,0,2,0,137,
+0,1,0,4,1,6,0,2,0,137,0,1,0,4,1,7,0,2,0,137,0,1,0,4,1,8,0,2,0,137,0,1,0,4,
+1,9,0,2,0,137,0,1,0,4,1,10,0,2,0,137,0,1,0,4,1,11,0,2,0,137,0,1,0,4,1,12,
+0,2,0,137,0,1,0,4,1,13,0,2,0,137,0,1,0,4,1,14,0,2,0,137,0,1,0,4,1,15,0,2,
+0,137,0,1,0,4,1,16,0,2,0,137,0,1,0,4,1,17,0,2,0,137,0,1,0,4,1,18,0,2,0,137,
+0,1,0,4,1,19,0,2,0,137,0,1,0,4,1,20,0,2,0,137,0,1,0,4,1,21,0,2,0,137,0,1,
+0,4,1,22,0,2,0,137,0,1,0,4,1,23,0,2,0,137,0,1,0,4,1,24,0,2,0,137,0,1,0,4,
+1,25,0,2,0,137,0,1,0,4,1,26,0,2,0,137,0,1,0,4,1,27,0,2,0,137,0,1,0,4,1,28,
+0,2,0,137,0,1,0,4,1,140,0,3,0,54,0,137,0,1,0,4,1,140,0,2,0,137,0,1,0,4,1,
+31,0,2,0,137,0,1,0,4,1,34,0,2,0,137,0,1,0,4,1,48,0,2,0,137,0,1,0,4,1,57,0,
+2,0,137,0,1,0,4,1,74,0,2,0,137,0,1,0,4,1,77,0,2,0,137,0,1,0,4,1,96,0,2,0,
+137,0,1,0,4,1,101,0,2,0,137,0,1,0,4,1,104,0,2,0,137,0,1,0,4,1,107,0,2,0,137,
+0,1,0,4,1,109,0,2,0,137,0,1,0,4,1,112,0,2,0,137,0,1,0,4,1,114,0,2,0,137,0,
+1,0,4,1,129,0,2,0,137,0,1,0,4,1,138,0,2,0,137,0,1,0,4,1,142,0,2,0,137,0,1,
+0,4,1,149,0,2,0,137,0,1,0,4,1,151,0,2,0,137,0,1,0,4,1,166,0,2,0,137,0,1,0,
+4,1,168,0,2,0,137,0,1,0,4,1,175,0,2,0,137,0,1,0,4,1,178,0,2,0,137,0,1,0,4,
+1,181,0,2,0,137,0,1,0,4,1,185,0,2,0,137,0,1,8,26,0,26,0,58,0,132,0,150,0,
+160,0,178,0,188,0,206,0,216,0,234,0,252,1,14,1,24,1,42,1,60,1,70,1,88,1,106,
+1,116,1,134,1,152,1,170,1,188,1,206,1,224,1,234,1,252,0,9,0,20,0,26,0,32,
+0,38,0,44,0,50,0,56,0,62,0,68,1,195,0,2,0,42,1,196,0,2,0,217,1,197,0,2,1,
+0,1,198,0,2,1,30,1,199,0,2,1,31,1,200,0,2,1,67,1,201,0,2,1,68,1,202,0,2,1,
+167,1,203,0,2,1,168,0,2,0,6,0,12,1,204,0,2,0,20,2,1,0,2,0,31,0,1,0,4,1,223,
+0,2,0,20,0,2,0,6,0,12,1,205,0,2,0,20,2,2,0,2,0,31,0,1,0,4,1,224,0,2,0,20,
+0,2,0,6,0,12,1,206,0,2,0,20,2,3,0,2,0,31,0,1,0,4,1,225,0,2,0,20,0,2,0,6,0,
+12,1,207,0,2,0,20,2,4,0,2,0,31,0,2,0,6,0,12,1,208,0,2,0,20,2,5,0,2,0,31,0,
+2,0,6,0,12,1,209,0,2,0,20,2,6,0,2,0,31,0,1,0,4,1,210,0,2,0,20,0,2,0,6,0,12,
+1,211,0,2,0,20,2,7,0,2,0,31,0,2,0,6,0,12,1,212,0,2,0,20,2,8,0,2,0,31,0,1,
+0,4,1,226,0,2,0,20,0,2,0,6,0,12,1,213,0,2,0,20,2,9,0,2,0,31,0,2,0,6,0,12,
+1,214,0,2,0,20,2,10,0,2,0,31,0,1,0,4,1,227,0,2,0,20,0,2,0,6,0,12,1,215,0,
+2,0,20,2,11,0,2,0,31,0,2,0,6,0,12,1,216,0,2,0,20,2,12,0,2,0,31,0,2,0,6,0,
+12,1,217,0,2,0,20,2,13,0,2,0,31,0,2,0,6,0,12,1,218,0,2,0,20,2,14,0,2,0,31,
+0,2,0,6,0,12,1,219,0,2,0,20,2,15,0,2,0,31,0,2,0,6,0,12,1,220,0,2,0,20,2,16,
+0,2,0,31,0,1,0,4,1,228,0,2,0,20,0,2,0,6,0,12,1,221,0,2,0,20,2,17,0,2,0,31,
+0,2,0,6,0,12,1,222,0,2,0,20,2,18,0,2,0,31,0,1,6,68,0,18,0,42,0,52,0,70,0,
+80,0,98,0,116,0,134,0,144,0,162,0,180,0,198,0,208,0,226,0,244,1,6,1,16,1,
+26,1,36,0,1,0,4,1,229,0,2,0,21,0,2,0,6,0,12,1,235,0,2,0,21,1,247,0,2,0,22,
+0,1,0,4,1,231,0,2,0,21,0,2,0,6,0,12,1,232,0,2,0,21,2,0,0,2,0,23,0,2,0,6,0,
+12,1,246,0,2,0,21,1,255,0,2,0,22,0,2,0,6,0,12,1,236,0,2,0,21,1,248,0,2,0,
+22,0,1,0,4,1,237,0,2,0,21,0,2,0,6,0,12,1,238,0,2,0,21,1,249,0,2,0,22,0,2,
+0,6,0,12,1,239,0,2,0,21,1,250,0,2,0,22,0,2,0,6,0,12,1,240,0,2,0,21,1,251,
+0,2,0,22,0,1,0,4,1,241,0,2,0,21,0,2,0,6,0,12,1,242,0,2,0,21,1,252,0,2,0,22,
+0,2,0,6,0,12,1,243,0,2,0,21,1,253,0,2,0,22,0,2,0,6,0,12,1,244,0,2,0,21,1,
+254,0,2,0,22,0,1,0,4,1,233,0,2,0,21,0,1,0,4,1,230,0,2,0,21,0,1,0,4,1,234,
+0,2,0,21,0,1,0,4,1,245,0,2,0,21,0,3,0,0,0,1,5,62,0,1,5,68,0,1,0,0,0,27,0,
+3,0,0,0,1,5,64,0,1,5,72,0,1,0,0,0,27,0,1,5,64,0,2,0,10,0,20,0,1,0,4,2,27,
+0,2,0,69,0,3,0,8,0,16,0,22,2,29,0,3,0,20,0,69,2,28,0,2,0,20,2,24,0,2,0,69,
+0,3,0,0,0,1,4,234,0,2,5,24,6,42,0,1,0,0,0,28,0,3,0,0,0,1,4,214,0,2,5,4,3,
+110,0,1,0,0,0,29,0,3,0,2,4,240,6,8,0,1,6,16,0,0,0,1,0,0,0,29,0,1,6,4,0,51,
+0,108,0,118,0,128,0,138,0,148,0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,
+228,0,238,0,248,1,2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,1,92,1,102,1,
+112,1,122,1,132,1,142,1,152,1,162,1,172,1,182,1,192,1,202,1,212,1,222,1,232,
+1,242,1,252,2,6,2,16,2,26,2,36,2,46,2,56,2,66,2,76,2,86,2,96,0,1,0,4,0,140,
+0,2,0,71,0,1,0,4,0,142,0,2,0,71,0,1,0,4,0,145,0,2,0,71,0,1,0,4,0,146,0,2,
+0,71,0,1,0,4,0,147,0,2,0,71,0,1,0,4,0,148,0,2,0,71,0,1,0,4,0,150,0,2,0,71,
+0,1,0,4,0,154,0,2,0,71,0,1,0,4,0,155,0,2,0,71,0,1,0,4,0,157,0,2,0,71,0,1,
+0,4,0,160,0,2,0,71,0,1,0,4,0,162,0,2,0,71,0,1,0,4,0,164,0,2,0,71,0,1,0,4,
+0,165,0,2,0,71,0,1,0,4,0,170,0,2,0,71,0,1,0,4,0,171,0,2,0,71,0,1,0,4,0,172,
+0,2,0,71,0,1,0,4,0,173,0,2,0,71,0,1,0,4,0,174,0,2,0,71,0,1,0,4,0,175,0,2,
+0,71,0,1,0,4,0,176,0,2,0,71,0,1,0,4,0,177,0,2,0,71,0,1,0,4,0,178,0,2,0,71,
+0,1,0,4,0,179,0,2,0,71,0,1,0,4,0,180,0,2,0,71,0,1,0,4,0,181,0,2,0,71,0,1,
+0,4,0,182,0,2,0,71,0,1,0,4,0,183,0,2,0,71,0,1,0,4,0,184,0,2,0,71,0,1,0,4,
+0,185,0,2,0,71,0,1,0,4,0,186,0,2,0,71,0,1,0,4,0,187,0,2,0,71,0,1,0,4,0,188,
+0,2,0,71,0,1,0,4,0,189,0,2,0,71,0,1,0,4,0,190,0,2,0,71,0,1,0,4,0,191,0,2,
+0,71,0,1,0,4,0,192,0,2,0,71,0,1,0,4,0,193,0,2,0,71,0,1,0,4,0,194,0,2,0,71,
+0,1,0,4,0,195,0,2,0,71,0,1,0,4,0,196,0,2,0,71,0,1,0,4,0,197,0,2,0,71,0,1,
+0,4,0,198,0,2,0,71,0,1,0,4,0,199,0,2,0,71,0,1,0,4,0,200,0,2,0,71,0,1,0,4,
+0,201,0,2,0,71,0,1,0,4,0,202,0,2,0,71,0,1,0,4,0,203,0,2,0,71,0,1,0,4,0,204,
+0,2,0,71,0,1,0,4,0,205,0,2,0,71,0,1,0,4,0,206,0,2,0,71,0,1,0,102,0,1,0,8,
+0,1,0,4,0,138,0,2,0,71,0,2,3,206,0,3,2,21,2,22,2,23,0,1,2,38,2,7,0,2,3,198,
+0,3,2,25,0,1,0,1,0,1,0,2,0,18,0,69,0,1,0,2,0,69,0,136,0,1,0,2,0,31,0,69,0,
+2,0,3,0,32,0,53,0,0,0,55,0,57,0,22,0,59,0,65,0,25,0,1,0,2,0,32,0,39,0,1,0,
+1,0,47,0,1,0,1,0,71,0,1,0,1,0,100,0,1,0,2,0,58,0,64,0,1,0,3,0,54,0,58,0,64,
+0,1,0,17,0,32,0,34,0,36,0,37,0,42,0,44,0,45,0,46,0,49,0,51,0,52,0,54,0,56,
+0,59,0,60,0,61,0,62,0,1,0,1,0,57,0,1,0,10,0,35,0,39,0,41,0,47,0,50,0,53,0,
+55,0,63,0,66,0,114,0,1,0,2,0,27,0,28,0,1,0,1,0,18,0,1,0,1,0,69,0,1,0,1,0,
+31,0,1,0,1,0,136,0,1,0,16,0,139,0,141,0,143,0,144,0,149,0,151,0,153,0,156,
+0,158,0,159,0,161,0,163,0,166,0,167,0,168,0,169,0,2,0,12,0,32,0,67,0,0,0,
+114,0,115,0,36,0,126,0,126,0,38,1,32,1,32,0,39,1,55,1,55,0,40,1,60,1,60,0,
+41,1,82,1,82,0,42,1,90,1,90,0,43,1,92,1,92,0,44,1,105,1,105,0,45,1,110,1,
+110,0,46,1,179,1,179,0,47,0,1,0,65,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,
+0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,
+0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,114,0,
+115,0,126,0,163,0,231,1,30,1,32,1,47,1,55,1,73,1,76,1,95,1,100,1,103,1,105,
+1,108,1,110,1,113,1,128,1,137,1,141,1,148,1,150,1,165,1,167,1,174,1,177,1,
+179,1,184,0,1,0,26,0,19,0,42,0,43,0,217,0,218,1,0,1,1,1,30,1,31,1,67,1,68,
+1,73,1,74,1,75,1,100,1,101,1,102,1,118,1,125,1,148,1,149,1,167,1,168,1,169,
+1,177,1,178,0,1,0,18,0,34,0,58,0,60,0,63,0,64,0,248,1,5,1,6,1,7,1,8,1,12,
+1,13,1,18,1,20,1,105,1,147,1,179,1,188,0,1,0,1,0,19,0,1,0,5,1,73,1,74,1,100,
+1,101,1,125,0,1,0,2,0,114,0,115,0,2,0,1,0,21,0,26,0,0,0,1,0,2,0,20,0,134,
+0,2,0,45,0,32,0,39,0,0,0,41,0,42,0,8,0,44,0,51,0,10,0,53,0,58,0,18,0,60,0,
+67,0,24,0,102,0,109,0,32,0,111,0,112,0,40,0,114,0,121,0,42,0,123,0,126,0,
+50,0,128,0,133,0,54,0,207,0,214,0,60,0,216,0,217,0,68,0,219,0,219,0,70,0,
+221,0,226,0,71,0,228,0,228,0,77,0,230,0,253,0,78,0,255,1,0,0,102,1,2,1,9,
+0,104,1,11,1,16,0,112,1,19,1,35,0,118,1,37,1,37,0,135,1,39,1,42,0,136,1,44,
+1,48,0,140,1,50,1,50,0,145,1,54,1,57,0,146,1,59,1,61,0,150,1,63,1,68,0,153,
+1,76,1,80,0,159,1,82,1,83,0,164,1,85,1,85,0,166,1,87,1,87,0,167,1,90,1,98,
+0,168,1,103,1,115,0,177,1,126,1,136,0,190,1,140,1,142,0,201,1,144,1,144,0,
+204,1,146,1,147,0,205,1,150,1,155,0,207,1,158,1,162,0,213,1,164,1,165,0,218,
+1,167,1,168,0,220,1,170,1,170,0,222,1,174,1,175,0,223,1,179,1,183,0,225,1,
+188,1,193,0,230,0,1,0,1,0,134,0,1,0,2,2,25,2,26,0,1,0,2,0,69,0,134,0,2,0,
+11,0,33,0,33,0,0,0,35,0,35,0,1,0,38,0,41,0,2,0,43,0,43,0,6,0,47,0,48,0,7,
+0,50,0,50,0,9,0,53,0,53,0,10,0,55,0,55,0,11,0,57,0,58,0,12,0,63,0,67,0,14,
+0,102,0,133,0,19,0,1,0,3,0,19,0,114,0,115,0,1,0,3,0,19,0,69,0,134,};
+#endif
@@ -0,0 +1,3544 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifDevanagari_Regular_ttf_size = 86828;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifDevanagari_Regular_ttf");
+asm(".type fz_font_NotoSerifDevanagari_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifDevanagari_Regular_ttf, 86828");
+asm(".balign 64");
+asm("fz_font_NotoSerifDevanagari_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifDevanagari-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifDevanagari_Regular_ttf_size = 86828;
+const char fz_font_NotoSerifDevanagari_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,17,124,17,121,0,1,34,148,0,0,0,112,
+71,80,79,83,52,34,53,27,0,1,35,4,0,0,7,124,71,83,85,66,136,111,26,232,0,1,
+42,128,0,0,40,172,79,83,47,50,251,139,103,124,0,0,1,104,0,0,0,96,99,109,97,
+112,167,224,114,88,0,0,12,248,0,0,1,216,103,97,115,112,0,7,0,7,0,1,34,136,
+0,0,0,12,103,108,121,102,189,214,143,126,0,0,20,108,0,0,234,166,104,101,97,
+100,12,26,171,143,0,0,0,236,0,0,0,54,104,104,101,97,14,133,254,183,0,0,1,
+36,0,0,0,36,104,109,116,120,147,102,137,183,0,0,1,200,0,0,11,48,108,111,99,
+97,96,123,36,133,0,0,14,208,0,0,5,154,109,97,120,112,2,231,1,42,0,0,1,72,
+0,0,0,32,110,97,109,101,144,74,187,201,0,0,255,20,0,0,6,30,112,111,115,116,
+57,78,6,47,0,1,5,52,0,0,29,82,0,1,0,0,0,1,2,143,83,145,98,212,95,15,60,245,
+0,11,8,0,0,0,0,0,211,99,181,101,0,0,0,0,211,115,171,37,251,205,251,25,10,
+87,8,95,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,95,250,255,0,0,9,95,251,205,247,
+140,10,87,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,204,0,1,0,0,2,204,0,192,0,16,
+0,104,0,6,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,4,3,241,1,144,0,5,0,0,5,153,
+5,51,0,0,0,191,5,153,5,51,0,0,2,130,0,102,2,129,0,0,2,2,5,2,4,5,4,2,2,4,0,
+0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,95,250,255,
+0,0,8,95,5,1,0,0,0,1,0,0,0,0,4,250,4,250,0,0,0,32,0,4,4,205,0,193,0,0,0,0,
+2,20,0,0,2,20,0,0,5,102,0,20,7,73,0,20,3,152,255,169,3,152,255,169,3,216,
+255,169,5,114,255,169,6,93,255,169,6,108,255,169,5,44,255,169,5,47,255,169,
+4,14,255,169,4,14,255,169,7,73,0,20,7,73,0,20,5,102,0,20,4,14,255,169,7,73,
+0,20,5,102,0,20,4,14,255,169,7,73,0,20,5,102,0,20,5,102,0,20,5,102,0,20,7,
+73,0,20,7,73,0,20,1,227,255,169,1,227,255,169,1,227,254,89,0,0,252,184,0,
+0,253,216,0,0,253,239,0,0,253,239,0,0,253,185,0,0,253,185,0,0,252,113,0,0,
+252,253,1,227,254,83,1,227,254,227,0,0,253,110,1,227,255,80,0,0,252,145,1,
+227,254,121,0,0,252,82,0,0,252,82,0,0,254,199,1,227,255,169,1,227,254,31,
+2,48,0,170,0,0,253,110,5,156,255,169,5,213,255,169,4,29,255,169,4,78,255,
+169,4,110,255,169,4,127,255,169,4,228,255,169,5,39,255,169,5,120,255,169,
+5,81,255,169,3,162,255,169,4,57,255,167,4,19,255,169,4,9,255,169,5,125,255,
+169,4,52,255,169,4,158,0,82,3,162,255,169,4,112,0,68,4,4,255,169,4,33,255,
+169,5,183,255,169,4,0,255,169,5,41,0,82,4,96,255,169,4,99,255,169,2,232,255,
+169,5,14,255,169,3,242,255,169,4,250,0,64,4,63,255,169,5,34,255,169,3,175,
+255,169,5,116,255,169,5,119,0,131,4,158,255,169,4,29,255,169,5,39,255,169,
+4,19,255,169,4,0,255,169,5,39,255,169,4,99,255,169,4,96,255,169,0,0,254,170,
+0,0,253,131,1,246,0,138,0,0,254,132,0,0,253,142,3,179,0,23,3,193,0,160,2,
+139,0,225,0,0,254,216,0,0,251,235,0,0,254,0,0,0,254,190,0,0,253,131,4,18,
+0,110,3,50,0,89,4,11,0,147,3,214,0,123,4,84,0,118,4,19,0,118,4,6,0,130,4,
+204,0,86,4,44,0,114,3,110,0,92,7,69,0,96,3,104,0,147,2,244,1,142,4,181,1,
+142,0,0,252,252,0,0,252,212,0,0,253,28,2,50,0,102,0,0,253,164,0,0,252,72,
+0,0,252,140,0,0,252,95,0,0,253,110,0,0,253,160,0,0,254,54,0,0,253,214,0,0,
+254,175,0,0,254,92,0,0,253,112,0,0,252,78,3,137,0,79,3,43,255,175,0,0,253,
+167,1,163,254,200,1,153,0,67,1,164,0,74,1,173,254,207,2,47,254,240,1,174,
+255,194,6,121,0,100,5,233,0,77,6,2,0,83,6,160,0,83,0,0,254,170,3,234,0,115,
+3,175,0,127,4,74,0,80,4,7,0,79,3,225,0,70,4,87,0,74,0,0,253,110,4,19,0,80,
+4,36,0,98,1,187,0,150,3,58,0,150,4,185,0,150,4,254,0,75,4,254,0,75,4,254,
+0,75,3,124,0,130,4,18,0,130,2,116,254,199,2,179,254,165,0,0,254,48,0,0,254,
+101,0,0,254,92,0,0,254,90,0,0,254,11,0,0,254,1,0,0,254,51,0,0,253,220,0,0,
+254,38,0,0,254,82,0,0,253,137,0,0,253,218,0,0,253,70,0,0,253,164,0,0,253,
+179,0,0,254,14,0,0,253,241,0,0,254,22,3,204,0,100,3,224,0,110,3,224,0,110,
+3,234,0,120,3,234,0,120,3,234,0,112,5,48,0,110,5,64,0,110,0,0,254,128,5,145,
+0,130,4,121,0,121,0,0,0,0,0,0,255,213,0,0,255,33,4,193,0,98,5,102,0,20,7,
+73,0,20,3,152,255,169,3,152,255,169,3,216,255,169,5,114,255,169,6,93,255,
+169,6,108,255,169,5,44,255,169,5,47,255,169,4,14,255,169,4,14,255,169,7,73,
+0,20,7,73,0,20,5,102,0,20,4,14,255,169,7,73,0,20,5,102,0,20,4,14,255,169,
+7,73,0,20,5,156,255,169,5,213,255,169,4,29,255,169,4,78,255,169,4,110,255,
+169,4,127,255,169,4,228,255,169,5,39,255,169,5,120,255,169,5,81,255,169,3,
+162,255,169,4,57,255,167,4,19,255,169,4,9,255,169,5,125,255,169,4,52,255,
+169,4,158,0,82,3,162,255,169,4,112,0,68,4,4,255,169,4,33,255,169,5,183,255,
+169,4,0,255,169,5,41,0,82,4,96,255,169,4,99,255,169,2,232,255,169,5,14,255,
+169,3,242,255,169,4,250,0,64,4,63,255,169,5,34,255,169,3,175,255,169,5,116,
+255,169,0,0,254,107,2,67,255,169,0,0,253,160,4,88,255,169,4,37,255,169,2,
+117,255,169,2,200,255,169,4,110,255,169,3,1,255,169,4,228,255,169,3,142,255,
+169,3,202,255,169,3,215,255,169,3,162,255,169,4,57,255,167,4,19,255,169,4,
+9,255,169,3,182,255,169,2,137,255,169,3,1,0,82,3,162,255,169,2,232,0,68,2,
+107,255,169,2,145,255,169,4,105,255,169,2,156,255,169,3,147,0,82,2,203,255,
+169,2,196,255,169,2,232,255,169,3,164,255,169,2,123,255,169,3,40,0,64,2,200,
+255,169,3,115,255,169,3,98,255,169,5,116,255,169,3,191,0,131,2,250,255,169,
+4,88,255,169,4,37,255,169,2,117,255,169,2,200,255,169,4,110,255,169,3,1,255,
+169,4,228,255,169,3,142,255,169,3,202,255,169,3,215,255,169,3,162,255,169,
+4,57,255,167,4,19,255,169,4,9,255,169,3,182,255,169,2,137,255,169,3,1,0,82,
+3,162,255,169,2,232,0,68,2,107,255,169,2,145,255,169,4,105,255,169,2,156,
+255,169,3,147,0,82,2,203,255,169,2,196,255,169,2,232,255,169,3,164,255,169,
+2,123,255,169,3,40,0,64,2,200,255,169,3,115,255,169,3,98,255,169,5,116,255,
+169,5,156,255,169,5,213,255,169,4,29,255,169,4,78,255,169,4,110,255,169,4,
+127,255,169,4,228,255,169,5,39,255,169,5,120,255,169,5,81,255,169,3,162,255,
+169,4,57,255,167,4,19,255,169,4,9,255,169,5,125,255,169,4,132,255,169,4,158,
+0,82,3,162,255,169,4,112,0,68,4,4,255,169,4,33,255,169,5,183,255,169,4,0,
+255,169,5,41,0,82,4,96,255,169,4,99,255,169,2,232,255,169,5,14,255,169,3,
+242,255,169,5,15,0,109,4,63,255,169,5,88,255,169,3,236,255,169,5,101,255,
+169,5,249,0,131,4,158,255,169,5,156,255,169,5,213,255,169,4,29,255,169,4,
+78,255,169,4,110,255,169,4,127,255,169,4,228,255,169,5,39,255,169,5,120,255,
+169,5,81,255,169,3,162,255,169,4,57,255,167,4,19,255,169,4,9,255,169,5,125,
+255,169,4,132,255,169,4,158,0,82,3,162,255,169,4,112,0,68,4,4,255,169,4,33,
+255,169,5,183,255,169,4,0,255,169,5,41,0,82,4,96,255,169,4,99,255,169,2,232,
+255,169,5,14,255,169,3,242,255,169,5,5,0,109,4,63,255,169,5,88,255,169,3,
+236,255,169,5,116,255,169,4,88,255,169,4,37,255,169,2,117,255,169,2,200,255,
+169,4,110,255,169,3,1,255,169,4,228,255,169,3,112,255,169,3,202,255,169,3,
+215,255,169,3,162,255,169,4,57,255,167,4,19,255,169,4,9,255,169,3,182,255,
+169,3,4,255,169,3,1,0,82,3,162,255,169,2,232,0,68,2,107,255,169,2,145,255,
+169,4,105,255,169,2,156,255,169,3,147,0,82,2,203,255,169,2,196,255,169,2,
+232,255,169,3,164,255,169,2,123,255,169,3,97,0,109,2,200,255,169,3,115,255,
+169,3,236,255,169,5,116,255,169,4,11,0,131,3,128,255,169,4,88,255,169,4,37,
+255,169,2,117,255,169,2,200,255,169,4,110,255,169,3,1,255,169,4,228,255,169,
+3,112,255,169,3,202,255,169,3,215,255,169,3,162,255,169,4,57,255,167,4,19,
+255,169,4,9,255,169,3,182,255,169,3,4,255,169,3,1,0,82,3,162,255,169,2,232,
+0,68,2,107,255,169,2,145,255,169,4,105,255,169,2,156,255,169,3,147,0,82,2,
+203,255,169,2,196,255,169,2,232,255,169,3,164,255,169,2,123,255,169,3,97,
+0,109,2,200,255,169,3,115,255,169,3,236,255,169,5,116,255,169,6,76,255,169,
+9,14,255,169,9,95,255,169,3,211,255,169,3,208,255,169,7,204,255,169,4,85,
+255,169,8,151,255,167,4,46,255,169,4,46,255,169,8,84,255,169,4,46,255,169,
+8,81,255,169,4,232,255,169,3,75,255,169,3,164,255,169,4,158,255,169,3,152,
+255,169,4,185,255,169,8,244,255,169,3,209,255,174,4,253,255,169,5,142,255,
+169,4,108,255,169,2,170,255,169,3,204,255,169,6,237,255,169,4,236,0,109,3,
+89,0,109,8,62,0,109,5,15,0,109,3,137,0,109,4,42,255,169,4,74,255,169,4,54,
+255,169,4,14,255,169,5,114,255,169,5,104,255,169,4,37,255,169,4,7,255,169,
+0,0,253,178,0,0,254,107,1,227,254,89,1,227,254,89,2,18,254,89,0,0,252,113,
+0,0,252,113,0,0,252,113,0,0,252,253,0,0,252,253,0,0,252,253,1,227,254,83,
+1,227,254,84,1,227,254,84,1,227,254,227,1,227,254,224,1,227,254,224,0,0,252,
+84,0,0,252,28,0,0,252,28,1,227,254,55,1,227,253,255,1,227,253,255,0,0,252,
+145,0,0,252,145,0,0,252,145,1,227,254,116,1,227,254,116,1,227,254,116,1,227,
+255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,
+169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,
+1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,
+255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,
+169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,
+1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,
+255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,
+169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,
+1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,255,169,1,227,
+253,233,1,227,253,133,1,227,252,137,1,227,253,233,1,227,253,133,1,227,252,
+137,1,227,253,233,1,227,253,133,1,227,252,137,1,227,253,233,1,227,253,133,
+1,227,252,137,3,152,255,169,4,14,255,169,7,73,0,20,7,73,0,20,5,102,0,20,4,
+14,255,169,7,73,0,20,5,102,0,20,4,14,255,169,7,73,0,20,3,152,255,169,4,14,
+255,169,7,73,0,20,7,73,0,20,5,102,0,20,4,14,255,169,7,73,0,20,5,102,0,20,
+4,14,255,169,7,73,0,20,3,162,255,169,3,162,255,169,3,162,255,169,3,162,255,
+169,3,162,255,169,3,190,255,169,4,56,255,169,4,100,255,169,4,56,255,169,4,
+100,255,169,3,175,255,169,3,175,255,169,3,175,255,169,3,175,255,169,3,175,
+255,169,3,175,255,169,3,231,255,169,3,175,255,169,3,236,255,169,3,231,255,
+169,0,0,251,205,0,0,252,199,0,0,252,227,0,0,252,227,0,0,252,246,0,0,252,246,
+0,0,253,106,0,0,253,61,0,0,253,160,0,0,253,160,0,0,253,160,0,0,253,160,0,
+0,253,160,0,0,253,160,5,39,255,169,5,39,255,169,5,39,255,169,5,39,255,169,
+8,107,0,109,5,27,255,169,5,27,255,169,3,89,255,169,3,89,255,169,2,170,0,211,
+3,68,0,117,4,121,0,51,7,43,0,92,1,195,0,117,2,197,0,117,2,197,0,66,4,0,0,
+84,4,121,0,133,2,0,0,61,2,123,0,51,2,0,0,127,2,78,0,0,4,121,0,92,4,121,0,
+135,4,121,0,104,4,121,0,119,4,121,0,35,4,121,0,113,4,121,0,125,4,121,0,121,
+4,121,0,94,4,121,0,104,2,74,0,166,2,74,0,98,4,121,0,133,4,121,0,133,4,121,
+0,133,4,0,0,88,2,225,0,205,2,78,0,0,2,225,0,76,4,121,0,104,3,172,255,246,
+3,109,0,102,4,121,1,254,3,109,0,102,4,121,0,111,3,172,255,246,4,0,255,246,
+8,0,255,246,2,0,0,115,2,0,0,61,3,154,0,115,3,154,0,61,6,221,0,164,4,121,0,
+145,4,121,0,133,4,121,0,133,2,0,0,61,0,0,255,105,3,175,255,204,0,0,0,1,0,
+3,0,1,0,0,0,12,0,4,1,204,0,0,0,60,0,32,0,4,0,28,0,0,0,13,0,35,0,37,0,63,0,
+95,0,126,0,160,0,175,0,215,0,247,2,188,9,20,9,40,9,101,9,111,9,127,28,246,
+32,13,32,20,32,25,32,29,32,38,32,185,34,18,37,204,168,57,168,251,254,255,
+255,255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,175,0,215,0,247,2,
+188,9,0,9,21,9,41,9,102,9,112,28,208,32,11,32,19,32,24,32,28,32,38,32,185,
+34,18,37,204,168,48,168,224,254,255,255,255,0,1,255,245,0,0,2,118,2,117,2,
+90,2,63,255,99,2,15,1,239,1,208,0,13,0,0,247,32,0,0,247,7,0,0,227,171,224,
+190,226,172,226,169,226,167,226,159,224,15,224,182,219,0,88,114,87,204,1,
+202,0,1,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,0,82,0,
+0,0,200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,152,2,153,
+2,154,0,108,0,97,0,96,0,98,0,21,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,12,0,19,0,
+22,0,14,0,15,0,20,0,23,0,16,0,17,0,244,0,73,0,74,0,75,0,76,0,77,0,78,0,79,
+0,251,0,80,0,86,1,2,0,81,0,82,0,83,0,84,0,85,0,48,0,49,0,100,0,101,0,29,0,
+30,0,31,0,32,0,33,0,34,0,35,0,42,0,44,0,38,0,39,0,43,0,45,0,40,0,41,0,99,
+0,51,0,50,0,119,0,104,0,105,0,106,0,107,0,52,0,46,0,47,0,225,0,226,0,227,
+0,232,0,237,0,238,0,246,0,250,0,11,0,13,0,36,0,37,0,121,0,122,0,120,0,103,
+0,18,0,26,0,27,0,28,0,24,0,25,0,95,0,93,0,94,0,89,0,90,0,102,0,91,0,92,0,
+0,0,21,0,21,0,21,0,21,0,106,0,198,1,22,1,123,1,183,2,13,2,109,2,223,3,65,
+3,182,3,243,4,65,4,175,5,43,5,55,5,67,5,79,5,186,6,13,6,127,6,139,6,151,6,
+242,7,84,7,234,8,1,8,9,8,56,8,96,8,142,8,174,8,226,9,48,9,141,9,169,9,210,
+9,250,10,48,10,75,10,87,10,122,10,167,10,191,10,232,10,246,11,19,11,99,11,
+121,11,158,11,243,12,79,12,122,12,185,13,11,13,66,13,166,13,221,14,70,14,
+136,14,184,14,243,15,60,15,132,15,179,15,226,16,47,16,113,16,200,16,246,17,
+38,17,108,17,176,17,246,18,39,18,99,18,148,18,216,19,18,19,97,19,151,19,222,
+20,36,20,130,20,241,21,48,21,96,21,156,21,238,22,56,22,141,22,202,22,254,
+23,15,23,51,23,77,23,103,23,120,23,177,23,224,23,240,23,253,24,10,24,25,24,
+41,24,77,24,121,24,186,24,242,25,55,25,135,25,187,26,11,26,71,26,114,26,182,
+27,70,27,108,27,124,27,136,27,157,27,187,27,203,27,223,27,239,28,37,28,57,
+28,87,28,96,28,104,28,124,28,150,28,166,28,180,28,218,29,16,29,49,29,104,
+29,120,29,148,29,178,29,206,29,236,30,35,30,92,30,174,31,32,31,129,31,245,
+32,5,32,82,32,167,32,253,33,65,33,113,33,160,33,169,33,202,34,48,34,63,34,
+76,34,93,34,107,34,119,34,135,34,176,34,223,35,0,35,51,35,90,35,147,35,195,
+36,0,36,73,36,123,36,195,36,248,37,33,37,88,37,165,37,218,38,34,38,75,38,
+117,38,163,38,250,39,44,39,53,39,66,39,83,39,163,40,3,40,87,40,174,40,233,
+40,254,41,14,41,68,41,68,41,81,41,111,42,117,42,129,42,141,42,153,42,165,
+42,177,42,189,42,201,42,213,42,225,42,237,42,249,43,5,43,17,43,29,43,45,43,
+61,43,77,43,89,43,101,43,113,43,125,43,137,43,149,43,161,43,173,43,185,43,
+197,43,209,43,221,43,233,43,245,44,1,44,13,44,25,44,37,44,49,44,61,44,73,
+44,85,44,97,44,109,44,121,44,133,44,145,44,157,44,169,44,181,44,193,44,205,
+44,217,44,229,44,241,44,253,45,9,45,39,45,72,45,92,45,167,46,0,46,36,46,91,
+46,103,46,155,46,252,47,46,47,141,47,204,47,216,47,228,47,240,47,252,48,36,
+48,77,48,149,48,161,48,243,49,27,49,66,49,127,49,192,50,1,50,41,50,91,50,
+103,50,167,50,222,51,37,51,82,51,145,51,206,52,39,52,144,52,203,52,215,52,
+227,52,239,52,251,53,11,53,23,53,35,53,47,53,59,53,71,53,87,53,103,53,119,
+53,135,53,147,53,159,53,171,53,187,53,199,53,211,53,223,53,235,53,247,54,
+3,54,15,54,27,54,43,54,55,54,67,54,79,54,91,54,103,54,115,54,127,54,211,55,
+52,55,102,55,169,55,181,55,237,55,249,56,55,56,166,56,242,56,254,57,10,57,
+22,57,34,57,89,57,136,57,216,58,29,58,119,58,173,58,223,59,41,59,111,59,188,
+59,244,60,51,60,63,60,135,60,194,61,11,61,68,61,145,61,223,61,235,62,99,62,
+168,62,180,62,192,62,204,62,216,62,232,62,244,63,4,63,16,63,28,63,40,63,56,
+63,72,63,88,63,104,63,116,63,128,63,140,63,152,63,164,63,176,63,188,63,200,
+63,212,63,224,63,236,63,248,64,8,64,20,64,32,64,44,64,56,64,68,64,80,64,96,
+64,170,65,10,65,55,65,117,65,133,65,187,65,203,66,7,66,111,66,184,66,200,
+66,216,66,232,66,248,67,42,67,84,67,161,67,173,68,6,68,56,68,101,68,167,68,
+238,69,58,69,108,69,164,69,180,69,250,70,53,70,120,70,171,70,242,70,254,71,
+10,71,126,71,195,71,207,71,219,71,231,71,243,72,7,72,19,72,35,72,47,72,59,
+72,71,72,91,72,111,72,131,72,151,72,163,72,175,72,187,72,203,72,215,72,227,
+72,239,72,251,73,7,73,19,73,31,73,43,73,63,73,75,73,87,73,99,73,111,73,123,
+73,139,73,155,73,230,74,107,75,0,75,76,75,159,75,253,76,90,76,201,77,62,77,
+179,78,46,78,166,79,32,79,83,79,131,79,216,80,70,80,153,81,6,81,165,82,10,
+82,126,82,212,83,36,83,108,83,200,84,38,84,136,84,229,85,84,85,178,86,15,
+86,95,86,182,87,20,87,108,87,203,88,41,88,149,88,250,89,29,89,69,89,81,89,
+148,89,227,89,238,90,27,90,38,90,50,90,107,90,118,90,130,90,189,90,201,90,
+213,91,28,91,40,91,77,91,123,91,134,91,146,91,207,91,219,92,7,92,59,92,70,
+92,125,92,186,92,198,92,246,93,39,93,88,93,137,93,186,93,237,94,33,94,85,
+94,137,94,189,94,241,95,36,95,48,95,60,95,72,95,84,95,96,95,108,95,120,95,
+132,95,144,95,156,95,168,95,180,95,245,96,56,96,124,96,191,97,3,97,73,97,
+145,97,216,98,32,98,104,98,176,98,247,99,3,99,15,99,27,99,39,99,51,99,63,
+99,75,99,87,99,99,99,111,99,123,99,135,99,184,99,234,100,29,100,41,100,53,
+100,65,100,132,100,197,101,8,101,20,101,32,101,44,101,56,101,68,101,80,101,
+92,101,104,101,116,101,128,101,140,101,152,101,164,101,180,101,196,101,212,
+101,228,101,244,102,4,102,20,102,36,102,52,102,68,102,164,103,10,103,96,103,
+108,103,120,103,132,103,209,104,34,104,46,104,58,104,158,105,11,105,113,105,
+229,105,240,105,251,106,7,106,19,106,127,106,243,106,255,107,11,107,23,107,
+35,107,47,107,59,107,70,107,124,107,183,107,228,108,37,108,129,108,235,109,
+15,109,95,109,107,109,119,109,135,110,2,110,72,110,84,110,147,110,159,110,
+182,110,203,111,3,111,82,111,95,111,128,111,161,111,201,111,225,111,255,112,
+12,112,28,112,42,112,88,112,126,112,177,112,238,113,29,113,83,113,139,113,
+163,113,238,114,45,114,71,114,112,114,132,114,152,114,173,114,222,114,247,
+115,4,115,29,115,49,115,62,115,114,115,127,115,179,115,222,115,235,115,248,
+116,5,116,36,116,67,116,122,116,177,116,216,116,250,117,30,117,43,117,51,
+117,67,117,83,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,37,17,
+33,17,193,3,73,252,183,2,225,253,135,5,182,250,74,104,4,230,251,26,0,1,0,
+20,255,246,5,169,5,4,0,58,0,0,1,35,17,35,39,17,6,35,34,39,22,21,20,6,35,34,
+2,39,55,22,22,51,50,54,53,52,38,39,6,7,39,54,54,53,52,38,35,34,7,39,54,51,
+50,22,22,21,20,6,7,22,51,50,55,17,35,39,53,33,23,5,169,237,19,124,61,61,119,
+115,70,153,127,161,245,77,82,68,181,121,77,102,50,46,44,90,70,177,138,77,
+60,105,150,75,132,124,95,147,79,68,75,110,108,129,89,171,77,2,39,77,4,118,
+251,128,93,1,253,23,77,95,122,114,139,1,6,206,33,170,184,96,71,61,119,41,
+18,27,140,46,97,71,58,66,68,145,63,103,146,74,71,103,40,50,69,1,120,112,20,
+112,0,1,0,20,255,246,7,140,5,4,0,63,0,0,1,35,17,35,39,17,33,17,35,39,17,6,
+35,34,39,22,21,20,6,35,34,2,39,55,22,22,51,50,54,53,52,38,39,6,7,39,54,54,
+53,52,38,35,34,7,39,54,51,50,22,22,21,20,6,7,22,51,50,55,17,35,39,53,33,23,
+7,140,237,19,124,254,172,19,124,61,61,119,115,70,153,127,161,245,77,82,68,
+181,121,77,102,50,46,44,90,70,177,138,77,60,105,150,75,132,124,95,147,79,
+68,75,110,108,129,89,171,77,4,10,77,4,118,251,128,93,4,35,251,128,93,1,253,
+23,77,95,122,114,139,1,6,206,33,170,184,96,71,61,119,41,18,27,140,46,97,71,
+58,66,68,145,63,103,146,74,71,103,40,50,69,1,120,112,20,112,0,1,255,169,254,
+215,3,219,4,250,0,55,0,0,19,20,23,54,54,51,50,22,22,21,20,6,7,22,23,7,38,
+38,39,38,38,53,52,54,51,50,23,50,54,53,52,38,35,34,7,38,38,53,52,54,51,50,
+23,53,33,39,53,33,23,21,33,17,38,35,34,6,222,70,65,134,52,89,123,100,222,
+175,124,193,99,73,175,71,110,128,54,45,86,78,159,202,78,58,115,151,108,134,
+151,140,67,110,253,191,77,3,229,77,254,237,103,54,173,160,2,160,73,47,40,
+39,76,152,81,133,170,2,112,84,118,49,176,89,5,79,61,40,45,98,124,95,61,63,
+95,65,189,89,104,115,11,194,112,20,112,20,254,208,9,96,0,1,255,169,254,215,
+3,219,7,23,0,72,0,0,19,20,23,54,54,51,50,22,22,21,20,6,7,22,23,7,38,38,39,
+38,38,53,52,54,51,50,23,50,54,53,52,38,35,34,7,38,38,53,52,54,51,50,23,53,
+33,39,53,33,38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,51,23,21,33,17,
+38,35,34,6,222,70,65,134,52,89,123,100,222,175,124,193,99,73,175,71,110,128,
+54,45,86,78,159,202,78,58,115,151,108,134,151,140,67,110,253,191,77,2,180,
+69,68,122,99,156,93,41,61,79,71,84,84,224,77,254,237,103,54,173,160,2,160,
+73,47,40,39,76,152,81,133,170,2,112,84,118,49,176,89,5,79,61,40,45,98,124,
+95,61,63,95,65,189,89,104,115,11,194,112,20,91,150,81,98,121,159,35,59,88,
+76,111,131,112,20,254,208,9,96,0,1,255,169,0,30,4,27,4,250,0,37,0,0,1,33,
+22,21,20,7,22,22,21,20,6,35,34,36,3,55,22,22,51,50,54,53,52,38,39,6,7,39,
+54,54,53,52,39,33,39,53,33,23,4,27,254,201,85,130,88,99,170,145,146,254,229,
+114,82,76,212,136,96,114,62,55,80,107,75,164,178,71,253,126,77,4,37,77,4,
+118,102,133,138,92,75,186,88,136,162,252,1,26,33,170,240,104,86,72,136,50,
+39,23,149,34,125,90,98,73,112,20,112,0,0,1,255,169,255,255,5,181,4,250,0,
+57,0,0,1,33,22,21,20,7,22,23,54,51,50,22,22,21,20,6,7,39,54,54,53,52,38,35,
+34,6,7,22,21,20,6,35,34,36,3,55,22,22,51,50,54,53,52,38,39,6,7,39,54,54,53,
+52,39,33,39,53,33,23,5,181,253,47,85,130,47,36,144,108,81,144,79,99,74,138,
+87,104,59,57,59,115,70,28,170,145,146,254,229,114,82,76,212,136,96,114,62,
+55,80,107,75,164,178,71,253,126,77,5,191,77,4,118,102,133,138,92,39,47,104,
+99,147,83,79,206,82,86,88,193,92,48,64,56,51,72,63,136,162,252,1,26,33,170,
+240,104,86,72,136,50,39,23,149,34,125,90,98,73,112,20,112,0,0,1,255,169,255,
+246,6,160,4,250,0,64,0,0,1,17,54,54,55,38,53,52,54,51,50,22,21,20,7,23,6,
+6,21,20,22,51,50,55,23,6,35,34,38,38,53,52,54,55,39,6,6,35,39,17,35,39,53,
+55,1,39,1,38,38,35,34,7,39,54,51,50,22,23,17,33,39,53,33,23,21,3,148,93,130,
+35,20,70,56,57,78,70,158,152,142,56,46,139,107,75,90,116,93,138,95,128,101,
+72,51,165,93,32,19,124,3,254,14,112,2,42,85,123,80,100,157,101,170,128,118,
+168,115,252,241,77,6,170,77,4,118,254,4,4,65,49,36,45,59,72,89,65,82,49,195,
+65,134,58,43,52,83,125,74,74,125,84,84,115,51,83,35,50,2,253,209,93,206,182,
+254,200,132,1,47,107,75,88,157,88,115,152,1,220,112,20,112,20,0,1,255,169,
+255,92,6,175,4,250,0,77,0,0,1,17,54,54,55,38,53,52,54,51,50,22,21,20,7,23,
+6,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,23,6,35,34,38,53,52,55,38,
+38,53,52,54,55,39,6,6,35,39,17,35,39,53,55,1,39,1,38,38,35,34,7,39,54,51,
+50,22,23,17,33,39,53,33,23,21,3,148,93,130,35,20,70,56,57,78,72,160,152,137,
+64,62,160,66,104,114,38,30,55,131,33,66,115,107,81,162,7,68,75,124,103,68,
+50,167,94,32,19,124,3,254,14,112,2,42,85,123,80,100,157,101,170,128,118,168,
+115,252,241,77,6,185,77,4,118,254,4,4,65,49,36,45,59,72,89,65,79,51,197,58,
+101,63,62,23,72,50,124,36,80,49,27,28,55,28,131,70,149,75,28,21,31,103,65,
+85,113,45,78,34,48,2,253,209,93,206,182,254,200,132,1,47,107,75,88,157,88,
+115,152,1,220,112,20,112,20,0,0,1,255,169,255,30,5,111,4,250,0,67,0,0,1,17,
+30,2,21,20,6,7,6,6,21,20,51,50,55,23,6,6,35,34,38,38,53,52,54,54,55,54,54,
+53,52,38,35,34,6,21,23,39,38,53,52,55,38,35,34,6,21,20,22,23,7,0,17,52,54,
+51,50,23,54,55,17,33,39,53,33,23,21,3,254,57,92,53,67,98,83,49,132,104,107,
+85,67,97,58,78,159,106,42,61,49,85,55,77,60,96,120,4,161,5,31,68,70,90,115,
+124,158,62,254,130,149,124,141,134,87,151,252,135,77,5,121,77,4,118,254,202,
+26,98,107,67,66,130,100,87,89,42,121,79,134,38,32,96,154,61,58,96,73,49,85,
+104,56,63,86,152,125,77,32,37,38,87,73,41,120,96,110,205,130,69,1,61,1,19,
+129,156,113,112,6,1,25,112,20,112,20,0,0,1,255,169,254,250,5,167,4,250,0,
+82,0,0,5,6,35,34,38,53,52,55,46,2,53,52,54,54,55,62,2,53,52,38,35,34,6,21,
+23,39,38,53,52,55,38,35,34,6,21,20,22,23,7,0,17,52,54,51,50,23,54,55,17,33,
+39,53,33,23,21,33,17,22,22,21,20,6,6,7,6,6,21,20,23,54,55,23,6,6,21,20,22,
+51,50,54,55,5,167,115,107,81,162,8,34,70,40,34,48,41,39,44,30,77,60,96,120,
+4,161,5,31,68,70,90,115,124,158,62,254,130,149,124,141,134,87,151,252,135,
+77,5,124,77,254,140,79,123,40,56,45,54,53,53,63,154,66,104,114,38,30,55,131,
+33,192,70,149,75,28,27,15,58,80,47,43,74,56,40,38,50,64,36,59,78,152,125,
+77,32,37,38,87,73,41,120,96,110,205,130,69,1,61,1,19,129,156,113,112,6,1,
+25,112,20,112,20,254,202,37,169,82,44,80,64,44,52,70,36,51,20,69,48,124,36,
+80,49,27,28,55,28,0,1,255,169,254,194,4,81,4,250,0,38,0,0,1,17,33,17,20,22,
+22,23,23,22,22,21,20,7,39,54,53,52,38,39,39,46,2,53,17,35,39,53,33,23,21,
+35,17,20,7,39,54,54,2,224,254,78,23,72,91,202,108,107,71,157,75,59,104,206,
+97,93,38,165,77,4,91,77,222,107,131,48,43,2,255,1,119,253,236,88,84,68,58,
+128,69,138,83,96,116,64,111,82,50,76,66,129,61,86,106,89,2,28,112,20,112,
+20,254,103,173,125,84,40,115,0,0,1,255,169,254,194,4,81,7,28,0,51,0,0,1,17,
+33,17,20,22,22,23,23,22,22,21,20,7,39,54,53,52,38,39,39,46,2,53,17,35,39,
+53,33,46,2,35,34,7,39,54,51,50,18,19,51,23,21,35,17,20,7,39,54,54,2,224,254,
+78,23,72,91,202,108,107,71,157,75,59,104,206,97,93,38,165,77,3,94,46,146,
+111,84,79,78,93,95,78,164,255,136,162,77,222,107,131,48,43,2,255,1,119,253,
+236,88,84,68,58,128,69,138,83,96,116,64,111,82,50,76,66,129,61,86,106,89,
+2,28,112,20,92,214,71,37,176,30,254,255,254,223,112,20,254,103,173,125,84,
+40,115,0,1,0,20,255,246,7,140,7,28,0,76,0,0,1,35,17,35,39,17,33,17,35,39,
+17,6,35,34,39,22,21,20,6,35,34,2,39,55,22,22,51,50,54,53,52,38,39,6,7,39,
+54,54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,6,7,22,51,50,55,17,35,39,53,
+33,46,2,35,34,7,39,54,51,50,18,19,51,23,7,140,237,19,124,254,172,19,124,61,
+61,119,115,70,153,127,161,245,77,82,68,181,121,77,102,50,46,44,90,70,177,
+138,77,60,105,150,75,132,124,95,147,79,68,75,110,108,129,89,171,77,2,254,
+46,146,111,84,79,78,93,95,78,164,255,136,177,77,4,118,251,128,93,4,35,251,
+128,93,1,253,23,77,95,122,114,139,1,6,206,33,170,184,96,71,61,119,41,18,27,
+140,46,97,71,58,66,68,145,63,103,146,74,71,103,40,50,69,1,120,112,20,92,214,
+71,37,176,30,254,255,254,223,112,0,0,1,0,20,255,246,7,140,7,44,0,87,0,0,1,
+35,17,35,39,17,33,17,35,39,17,6,35,34,39,22,21,20,6,35,34,2,39,55,22,22,51,
+50,54,53,52,38,39,6,7,39,54,54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,6,
+7,22,51,50,55,17,35,39,53,33,38,38,35,34,7,39,54,51,50,23,55,38,38,35,34,
+7,39,54,51,50,22,22,23,51,23,7,140,237,19,124,254,172,19,124,61,61,119,115,
+70,153,127,161,245,77,82,68,181,121,77,102,50,46,44,90,70,177,138,77,60,105,
+150,75,132,124,95,147,79,68,75,110,108,129,89,171,77,2,211,59,129,79,65,75,
+51,64,75,189,153,8,59,150,102,56,63,54,71,76,93,139,132,78,175,77,4,118,251,
+128,93,4,35,251,128,93,1,253,23,77,95,122,114,139,1,6,206,33,170,184,96,71,
+61,119,41,18,27,140,46,97,71,58,66,68,145,63,103,146,74,71,103,40,50,69,1,
+120,112,20,81,83,28,140,23,224,3,170,172,25,138,29,97,241,224,112,0,255,255,
+0,20,255,246,5,242,6,227,2,38,0,4,0,0,0,7,0,42,5,139,0,0,255,255,255,169,
+254,194,4,81,6,227,2,38,0,14,0,0,0,7,0,42,3,29,0,0,255,255,0,20,255,246,7,
+140,6,227,2,38,0,5,0,0,0,7,0,42,6,123,0,0,0,1,0,20,255,246,5,169,7,18,0,74,
+0,0,1,35,17,35,39,17,6,35,34,39,22,21,20,6,35,34,2,39,55,22,22,51,50,54,53,
+52,38,39,6,7,39,54,54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,6,7,22,51,
+50,55,17,35,39,53,33,38,38,35,7,38,38,39,55,22,22,51,55,50,22,23,51,23,5,
+169,237,19,124,61,61,119,115,70,153,127,161,245,77,82,68,181,121,77,102,50,
+46,44,90,70,177,138,77,60,105,150,75,132,124,95,147,79,68,75,110,108,129,
+89,171,77,1,49,26,77,74,154,108,142,45,73,21,78,70,178,119,127,34,172,77,
+4,118,251,128,93,1,253,23,77,95,122,114,139,1,6,206,33,170,184,96,71,61,119,
+41,18,27,140,46,97,71,58,66,68,145,63,103,146,74,71,103,40,50,69,1,120,112,
+20,124,98,5,1,139,156,23,73,82,7,186,202,112,0,1,255,169,254,194,4,81,7,18,
+0,54,0,0,1,17,33,17,20,22,22,23,23,22,22,21,20,7,39,54,53,52,38,39,39,46,
+2,53,17,35,39,53,33,38,38,35,7,38,38,39,55,22,22,51,55,50,22,23,51,23,21,
+35,17,20,7,39,54,54,2,224,254,78,23,72,91,202,108,107,71,157,75,59,104,206,
+97,93,38,165,77,3,116,26,77,74,154,108,142,45,73,21,78,70,178,119,127,34,
+157,77,222,107,131,48,43,2,255,1,119,253,236,88,84,68,58,128,69,138,83,96,
+116,64,111,82,50,76,66,129,61,86,106,89,2,28,112,20,124,98,5,1,139,156,23,
+73,82,7,186,202,112,20,254,103,173,125,84,40,115,0,0,1,0,20,255,246,7,140,
+7,18,0,79,0,0,1,35,17,35,39,17,33,17,35,39,17,6,35,34,39,22,21,20,6,35,34,
+2,39,55,22,22,51,50,54,53,52,38,39,6,7,39,54,54,53,52,38,35,34,7,39,54,51,
+50,22,22,21,20,6,7,22,51,50,55,17,35,39,53,33,38,38,35,7,38,38,39,55,22,22,
+51,55,50,22,23,51,23,7,140,237,19,124,254,172,19,124,61,61,119,115,70,153,
+127,161,245,77,82,68,181,121,77,102,50,46,44,90,70,177,138,77,60,105,150,
+75,132,124,95,147,79,68,75,110,108,129,89,171,77,3,20,26,77,74,154,108,142,
+45,73,21,78,70,178,119,127,34,172,77,4,118,251,128,93,4,35,251,128,93,1,253,
+23,77,95,122,114,139,1,6,206,33,170,184,96,71,61,119,41,18,27,140,46,97,71,
+58,66,68,145,63,103,146,74,71,103,40,50,69,1,120,112,20,124,98,5,1,139,156,
+23,73,82,7,186,202,112,255,255,0,20,254,161,5,169,5,4,2,38,0,4,0,0,0,7,0,
+46,5,10,0,0,255,255,0,20,253,131,5,169,5,4,2,38,0,4,0,0,0,7,0,47,5,10,0,0,
+0,1,0,20,255,246,5,169,6,71,0,63,0,0,1,35,17,35,39,17,6,35,34,39,22,21,20,
+6,35,34,2,39,55,22,22,51,50,54,53,52,38,39,6,7,39,54,54,53,52,38,35,34,7,
+39,54,51,50,22,22,21,20,6,7,22,51,50,55,17,35,39,53,51,17,51,23,21,51,23,
+5,169,237,19,124,61,61,119,115,70,153,127,161,245,77,82,68,181,121,77,102,
+50,46,44,90,70,177,138,77,60,105,150,75,132,124,95,147,79,68,75,110,108,129,
+89,171,77,248,19,124,160,77,4,118,251,128,93,1,253,23,77,95,122,114,139,1,
+6,206,33,170,184,96,71,61,119,41,18,27,140,46,97,71,58,66,68,145,63,103,146,
+74,71,103,40,50,69,1,120,112,20,1,77,93,240,112,0,0,1,0,20,255,246,7,140,
+6,71,0,68,0,0,1,35,17,35,39,17,33,17,35,39,17,6,35,34,39,22,21,20,6,35,34,
+2,39,55,22,22,51,50,54,53,52,38,39,6,7,39,54,54,53,52,38,35,34,7,39,54,51,
+50,22,22,21,20,6,7,22,51,50,55,17,35,39,53,33,17,51,23,21,51,23,7,140,237,
+19,124,254,172,19,124,61,61,119,115,70,153,127,161,245,77,82,68,181,121,77,
+102,50,46,44,90,70,177,138,77,60,105,150,75,132,124,95,147,79,68,75,110,108,
+129,89,171,77,2,219,19,124,160,77,4,118,251,128,93,4,35,251,128,93,1,253,
+23,77,95,122,114,139,1,6,206,33,170,184,96,71,61,119,41,18,27,140,46,97,71,
+58,66,68,145,63,103,146,74,71,103,40,50,69,1,120,112,20,1,77,93,240,112,0,
+1,0,20,255,246,7,140,7,198,0,108,0,0,1,35,17,35,39,17,33,17,35,39,17,6,35,
+34,39,22,21,20,6,35,34,2,39,55,22,22,51,50,54,53,52,38,39,6,7,39,54,54,53,
+52,38,35,34,7,39,54,51,50,22,22,21,20,6,7,22,51,50,55,17,35,39,53,33,53,52,
+38,35,34,7,6,35,34,38,39,55,22,22,51,50,54,55,54,51,50,22,21,7,51,54,53,52,
+38,39,38,38,53,52,55,23,7,20,22,23,22,21,20,7,51,23,7,140,237,19,124,254,
+172,19,124,61,61,119,115,70,153,127,161,245,77,82,68,181,121,77,102,50,46,
+44,90,70,177,138,77,60,105,150,75,132,124,95,147,79,68,75,110,108,129,89,
+171,77,2,208,95,77,41,64,58,41,117,127,20,72,18,81,74,26,63,9,67,44,118,132,
+1,39,12,73,80,111,104,13,74,3,85,107,187,43,148,77,4,118,251,128,93,4,35,
+251,128,93,1,253,23,77,95,122,114,139,1,6,206,33,170,184,96,71,61,119,41,
+18,27,140,46,97,71,58,66,68,145,63,103,146,74,71,103,40,50,69,1,120,112,20,
+2,60,65,12,12,130,124,17,71,60,10,1,13,124,111,32,56,46,76,106,39,54,131,
+97,52,59,10,35,61,93,54,98,178,84,103,112,0,0,1,255,169,255,246,2,38,4,250,
+0,10,0,0,1,35,17,35,39,17,35,39,53,33,23,2,38,237,19,124,180,77,2,48,77,4,
+118,251,128,93,4,35,112,20,112,0,255,255,255,169,255,247,4,248,7,41,2,6,2,
+31,0,0,0,1,254,89,255,246,2,38,7,41,0,29,0,0,1,35,17,35,39,17,35,39,53,33,
+38,38,35,34,6,21,20,22,23,35,38,38,53,52,54,51,32,19,51,23,2,38,237,19,124,
+180,77,1,47,59,171,104,80,89,62,51,77,75,97,136,112,1,62,159,171,77,4,118,
+251,128,93,4,35,112,20,196,215,91,86,62,144,50,54,180,88,114,145,253,209,
+112,0,1,252,184,253,219,0,44,0,10,0,24,0,0,5,55,22,22,51,50,54,53,52,35,34,
+6,7,39,54,51,50,22,22,21,20,6,35,34,36,252,184,95,97,205,124,102,150,102,
+46,87,59,95,111,99,73,134,83,171,142,167,254,230,187,81,155,182,135,91,98,
+32,42,124,79,82,142,72,119,144,202,0,0,1,253,216,253,207,1,71,0,11,0,29,0,
+0,7,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,38,53,52,54,51,50,22,22,23,
+23,7,46,2,223,93,103,64,55,53,97,65,49,57,82,51,67,146,113,151,116,87,158,
+139,112,116,89,122,138,136,133,92,79,64,67,27,45,146,25,21,89,146,80,108,
+143,94,145,135,137,61,161,165,102,0,1,253,239,253,162,0,71,255,223,0,17,0,
+0,1,52,55,23,6,6,21,20,22,51,50,54,55,23,6,35,34,38,253,239,241,118,119,118,
+92,66,51,111,45,113,132,131,127,210,254,223,179,77,107,39,97,68,68,69,46,
+35,103,103,210,0,0,1,253,239,252,209,0,172,255,223,0,33,0,0,19,6,35,34,38,
+38,53,52,55,38,38,53,52,55,23,6,6,21,20,22,23,54,55,23,14,2,21,20,22,51,50,
+54,55,172,130,133,67,120,84,5,58,114,241,118,118,119,49,48,50,139,118,91,
+93,53,57,40,51,113,43,253,56,103,73,107,66,23,25,22,128,82,179,77,107,38,
+98,68,35,46,5,56,61,107,41,53,65,45,34,35,46,35,0,1,253,185,253,125,0,239,
+0,0,0,55,0,0,19,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,39,
+38,53,52,55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,51,50,22,21,
+20,6,7,6,6,21,20,51,50,55,239,62,81,63,149,41,39,37,36,41,34,56,72,5,118,
+5,14,37,37,49,66,53,51,57,171,98,80,89,84,59,102,80,151,49,45,35,32,37,53,
+64,253,204,79,121,71,39,65,42,41,56,33,35,43,86,77,31,28,23,31,37,44,42,21,
+69,56,57,93,53,54,164,150,84,102,69,72,137,82,48,80,50,40,47,25,37,62,0,0,
+1,253,185,253,2,1,116,0,0,0,66,0,0,1,6,35,34,38,53,53,38,53,52,54,55,54,54,
+53,52,38,35,34,6,21,20,23,39,38,53,52,55,38,35,34,6,21,20,22,23,7,38,53,52,
+54,51,50,23,54,51,50,22,21,20,6,7,6,6,21,20,23,54,55,23,6,6,21,20,51,50,55,
+1,116,62,81,60,143,119,34,34,31,31,41,34,56,72,5,118,5,14,37,37,49,66,53,
+51,57,171,98,80,89,84,59,102,80,151,43,40,31,28,38,46,75,88,62,66,32,53,64,
+253,81,79,112,68,5,71,92,34,57,37,36,50,29,35,43,86,77,31,28,23,31,37,44,
+42,21,69,56,57,93,53,54,164,150,84,102,69,72,137,82,42,70,44,35,42,21,38,
+4,52,24,92,21,62,30,25,62,0,0,1,252,113,4,235,255,80,7,28,0,13,0,0,1,34,7,
+39,54,51,50,0,19,35,46,3,253,107,74,83,93,90,83,167,1,0,139,91,43,128,78,
+84,6,115,37,176,30,254,249,254,214,92,191,76,33,0,0,1,252,253,4,235,255,84,
+7,44,0,23,0,0,1,34,7,39,54,51,54,23,55,38,38,35,34,7,39,54,51,50,22,22,23,
+35,38,38,253,188,65,75,51,64,75,186,156,8,59,150,102,56,63,54,71,76,94,140,
+133,80,130,62,133,5,158,28,140,23,2,226,3,170,172,25,138,29,99,248,230,88,
+91,0,0,1,254,83,255,246,2,38,7,28,0,23,0,0,1,35,17,35,39,17,35,39,53,33,46,
+2,35,34,7,39,54,51,50,18,19,51,23,2,38,237,19,124,180,77,1,39,46,146,111,
+84,79,78,93,95,78,164,255,136,174,77,4,118,251,128,93,4,35,112,20,92,214,
+71,37,176,30,254,255,254,223,112,0,1,254,227,255,246,2,38,7,44,0,34,0,0,1,
+35,17,35,39,17,35,39,53,33,38,38,35,34,7,39,54,51,50,23,55,38,38,35,34,7,
+39,54,51,50,22,22,23,51,23,2,38,237,19,124,180,77,1,4,59,129,79,65,75,51,
+64,75,189,153,8,59,150,102,56,63,54,71,76,93,139,132,78,164,77,4,118,251,
+128,93,4,35,112,20,81,83,28,140,23,224,3,170,172,25,138,29,97,241,224,112,
+0,1,253,110,5,121,0,103,6,227,0,13,0,0,1,55,22,22,51,50,54,55,23,6,6,35,34,
+38,253,110,74,45,140,110,98,138,25,131,33,202,144,127,204,6,173,28,106,104,
+119,117,43,150,169,165,255,255,255,80,255,246,2,73,6,227,2,38,0,29,0,0,0,
+7,0,42,1,226,0,0,0,1,252,145,4,235,255,79,7,18,0,19,0,0,1,34,6,35,38,38,39,
+55,22,22,51,50,54,51,50,22,23,35,38,38,254,82,40,76,38,108,142,45,73,21,78,
+70,45,88,45,120,128,34,73,29,77,5,216,5,1,139,156,23,73,82,7,193,210,139,
+98,0,0,1,254,121,255,246,2,38,7,18,0,26,0,0,1,35,17,35,39,17,35,39,53,33,
+38,38,35,7,38,38,39,55,22,22,51,55,50,22,23,51,23,2,38,237,19,124,180,77,
+1,66,26,77,74,154,108,142,45,73,21,78,70,178,119,127,34,164,77,4,118,251,
+128,93,4,35,112,20,124,98,5,1,139,156,23,73,82,7,186,202,112,0,0,1,252,82,
+254,161,255,138,255,140,0,11,0,0,5,22,22,51,50,55,23,6,35,34,38,39,252,145,
+64,176,91,178,141,111,182,215,124,218,85,129,47,49,109,103,132,85,76,0,0,
+2,252,82,253,131,255,138,255,140,0,11,0,23,0,0,5,55,22,22,51,50,55,23,6,35,
+34,38,7,55,22,22,51,50,55,23,6,35,34,38,252,82,63,64,176,91,178,141,111,182,
+215,124,218,85,63,64,176,91,178,141,111,182,215,124,218,190,61,47,49,109,
+103,132,85,210,61,47,49,109,103,132,85,0,0,1,254,199,4,190,255,86,6,71,0,
+4,0,0,3,17,35,17,51,170,143,19,5,234,254,212,1,137,0,1,255,169,255,246,2,
+38,6,71,0,15,0,0,1,35,17,35,39,17,35,39,53,33,17,51,23,21,51,23,2,38,237,
+19,124,180,77,1,1,19,124,160,77,4,118,251,128,93,4,35,112,20,1,77,93,240,
+112,0,0,1,254,31,255,246,2,38,7,198,0,55,0,0,1,35,17,35,39,17,35,39,53,51,
+53,52,38,35,34,7,6,35,34,38,39,55,22,22,51,50,54,55,54,51,50,22,21,7,51,54,
+53,52,38,39,38,38,53,52,55,23,7,20,22,23,22,21,20,7,51,23,2,38,237,19,124,
+180,77,246,95,77,41,64,58,41,117,127,20,72,18,81,74,26,63,9,67,44,118,132,
+1,39,12,73,80,111,104,13,74,3,85,107,187,43,148,77,4,118,251,128,93,4,35,
+112,20,2,60,65,12,12,130,124,17,71,60,10,1,13,124,111,32,56,46,76,106,39,
+54,131,97,52,59,10,35,61,93,54,98,178,84,103,112,0,0,1,0,170,255,246,2,115,
+4,250,0,9,0,0,1,35,17,35,39,17,39,53,33,23,2,115,237,19,124,77,1,124,77,4,
+118,251,128,93,4,35,112,20,112,0,0,2,253,110,5,109,0,117,7,196,0,13,0,19,
+0,0,1,55,22,22,51,50,54,55,23,6,6,35,34,38,19,53,33,23,21,33,253,110,74,45,
+140,110,98,138,25,131,33,202,144,127,204,7,2,128,77,253,128,7,142,28,106,
+104,119,117,43,150,169,165,254,222,20,112,20,0,0,2,255,169,255,246,5,223,
+4,250,0,43,0,57,0,0,1,17,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,
+7,17,35,39,17,6,6,35,34,38,39,38,53,52,54,51,50,23,17,33,39,53,33,23,21,1,
+53,38,38,35,34,6,6,21,20,22,51,50,54,3,72,105,106,128,185,80,59,136,66,87,
+62,52,69,145,74,19,124,44,122,70,88,121,61,119,182,133,171,139,253,61,77,
+5,233,77,252,218,59,105,65,81,121,63,99,84,86,161,4,118,254,111,90,191,154,
+80,179,68,98,82,158,82,58,70,104,80,253,235,93,1,23,45,55,58,56,111,142,125,
+168,110,1,74,112,20,112,20,253,204,140,38,33,69,107,57,73,90,99,0,3,255,169,
+255,246,6,24,4,250,0,26,0,49,0,61,0,0,1,35,17,35,39,53,6,35,34,36,2,53,52,
+54,51,50,22,23,54,53,52,39,33,39,53,33,23,5,33,22,21,16,5,18,33,32,55,53,
+6,35,34,38,38,53,52,54,51,50,22,23,21,38,35,34,6,21,20,22,51,50,54,55,6,24,
+237,19,124,155,242,171,254,199,224,61,47,42,63,36,114,49,254,113,77,6,34,
+77,254,132,253,86,67,254,202,140,1,110,1,0,163,72,99,88,169,112,169,130,62,
+126,53,76,84,108,139,96,73,62,130,46,4,118,251,128,93,54,112,189,1,86,124,
+55,64,40,40,61,175,100,87,112,20,112,20,140,121,255,0,159,254,212,133,126,
+56,90,159,89,114,145,48,41,79,33,103,84,73,81,62,49,0,1,255,169,255,246,4,
+96,4,250,0,26,0,0,1,35,17,35,39,17,33,18,17,20,35,34,38,53,52,51,50,23,54,
+53,52,39,35,39,53,33,23,4,96,237,19,124,254,133,50,106,81,160,98,44,43,8,
+13,254,77,4,106,77,4,118,251,128,93,4,35,254,212,254,244,186,178,88,92,5,
+64,69,129,139,112,20,112,0,0,2,255,169,255,246,4,145,4,250,0,22,0,40,0,0,
+1,35,17,35,39,17,6,6,35,34,38,53,52,55,38,53,52,55,35,39,53,33,23,5,33,6,
+21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,4,145,237,19,124,48,139,82,161,
+227,158,207,14,107,77,4,155,77,254,132,254,3,30,125,68,76,103,158,187,83,
+84,95,183,67,4,118,251,128,93,1,2,46,64,239,105,142,77,90,177,40,41,112,20,
+112,20,46,53,124,91,19,8,142,11,117,87,59,67,103,82,0,2,255,169,0,14,4,177,
+4,250,0,49,0,57,0,0,1,21,33,17,38,35,34,6,21,20,23,54,54,51,50,22,22,21,20,
+6,6,35,34,36,39,55,22,22,51,50,54,53,52,38,35,34,7,38,38,53,52,54,51,50,23,
+53,33,39,53,33,3,20,35,34,53,52,51,50,4,177,254,129,103,54,173,160,70,65,
+134,52,89,123,100,81,160,112,163,254,217,122,74,92,225,115,137,178,78,58,
+115,151,108,134,151,140,67,110,253,85,77,4,187,29,100,101,101,100,4,138,20,
+254,208,9,96,79,73,47,40,39,76,152,81,83,141,84,183,177,53,133,143,122,95,
+61,63,95,65,189,89,104,115,11,194,112,20,253,216,108,108,109,0,1,255,169,
+255,246,4,194,4,250,0,36,0,0,1,35,17,35,39,53,6,35,34,46,2,53,52,55,35,39,
+53,33,23,21,35,34,6,21,20,22,51,50,54,55,17,33,39,53,33,23,4,194,237,19,124,
+97,128,81,117,132,58,86,185,86,2,94,86,77,127,175,102,83,82,155,63,252,176,
+77,4,204,77,4,118,251,128,93,252,90,50,117,118,66,112,63,112,21,114,23,137,
+95,70,89,91,80,2,83,112,20,112,0,0,2,255,169,0,10,5,39,4,250,0,58,0,69,0,
+0,1,21,22,22,21,20,2,4,35,34,38,38,53,52,55,38,38,53,52,54,51,50,22,23,7,
+38,35,34,6,21,20,22,23,54,51,51,23,34,6,21,20,22,51,50,54,55,38,38,53,52,
+54,55,53,33,39,53,33,23,21,1,34,6,21,20,22,23,54,53,52,38,3,205,91,112,156,
+254,235,170,94,182,119,84,84,100,135,106,60,113,37,22,41,48,78,103,48,44,
+84,111,13,54,120,158,98,95,137,234,77,158,171,110,95,252,184,77,5,49,77,254,
+106,67,87,140,98,68,86,4,118,174,38,194,122,158,254,234,168,90,152,77,111,
+72,32,134,90,100,124,45,43,47,20,84,71,43,91,32,44,120,97,88,78,86,122,104,
+72,200,122,93,128,13,157,112,20,112,20,254,241,86,74,92,146,49,124,142,86,
+95,0,1,255,169,255,246,5,106,4,250,0,33,0,0,1,35,17,35,39,17,33,34,39,22,
+21,20,6,35,34,0,3,55,18,22,51,50,53,52,38,39,55,33,53,33,39,53,33,23,5,106,
+237,19,124,254,238,81,23,166,125,109,166,254,251,86,87,83,189,97,144,105,
+81,35,1,254,252,8,77,5,116,77,4,118,251,128,93,2,174,4,168,179,116,130,1,
+71,1,47,28,254,252,248,148,98,190,62,72,242,112,20,112,0,0,2,255,169,254,
+215,5,187,4,250,0,50,0,72,0,0,1,35,17,35,39,17,6,35,34,39,22,21,20,6,7,22,
+23,7,38,38,39,38,38,53,52,54,51,50,23,50,54,53,52,38,35,34,7,38,38,53,52,
+54,51,50,23,53,33,39,53,33,23,5,33,17,38,35,34,6,21,20,23,54,54,51,50,22,
+23,22,22,51,50,54,55,5,187,237,19,124,56,59,91,83,57,222,175,124,193,99,73,
+175,71,110,128,54,45,86,78,159,202,78,58,115,151,108,134,151,140,67,110,253,
+191,77,5,197,77,254,132,254,137,103,54,173,160,70,65,134,52,45,65,42,47,76,
+56,61,114,38,4,118,251,128,93,1,132,22,41,81,87,133,170,2,112,84,118,49,176,
+89,5,79,61,40,45,98,124,95,61,63,95,65,189,89,104,115,11,194,112,20,112,20,
+254,208,9,96,79,73,47,40,39,16,16,17,18,32,28,0,0,1,255,169,255,246,5,148,
+4,250,0,42,0,0,1,35,17,35,39,17,6,35,39,6,6,35,34,36,39,55,22,22,51,50,54,
+53,52,38,35,34,6,7,39,54,51,50,22,22,23,54,55,17,33,39,53,33,23,5,148,237,
+19,124,56,68,50,15,180,140,162,255,0,81,83,66,175,120,120,140,70,72,49,93,
+60,73,124,96,83,129,104,11,99,75,251,222,77,5,158,77,4,118,251,128,93,1,194,
+14,4,125,136,242,219,40,178,187,134,114,73,65,29,31,154,56,85,163,69,11,59,
+1,199,112,20,112,0,1,255,169,0,59,3,229,4,250,0,30,0,0,19,20,22,51,50,54,
+55,23,6,35,34,38,38,53,52,54,51,50,23,17,33,39,53,33,23,21,35,17,39,34,6,
+236,162,137,91,126,67,86,138,171,128,230,140,238,193,48,58,253,123,77,3,239,
+77,219,84,204,254,1,210,119,142,38,38,136,86,134,223,125,154,187,5,1,9,112,
+20,112,20,254,133,2,167,0,0,2,255,167,0,50,4,124,4,250,0,24,0,37,0,0,1,17,
+22,22,21,20,6,35,34,38,38,53,52,54,54,51,50,23,17,33,39,53,33,23,21,1,14,
+2,21,20,22,51,50,54,53,52,38,2,194,137,156,223,190,129,226,137,108,179,102,
+37,43,253,193,77,4,136,77,254,2,126,181,92,158,122,144,189,107,4,118,254,
+230,50,226,147,178,209,126,220,135,106,165,90,6,1,0,112,20,112,20,254,174,
+1,97,158,92,127,166,184,142,93,172,0,0,1,255,169,0,14,4,86,4,250,0,49,0,0,
+1,20,23,54,54,51,50,22,22,21,20,6,6,35,34,36,39,55,22,22,51,50,54,53,52,38,
+35,34,7,38,38,53,52,54,51,50,23,53,33,39,53,33,23,21,33,17,38,35,34,6,1,72,
+70,65,134,52,89,123,100,81,160,112,163,254,217,122,74,92,225,115,137,178,
+78,58,115,151,108,134,151,140,67,110,253,85,77,4,96,77,254,220,103,54,173,
+160,2,160,73,47,40,39,76,152,81,83,141,84,183,177,53,133,143,122,95,61,63,
+95,65,189,89,104,115,11,194,112,20,112,20,254,208,9,96,0,0,2,255,169,0,0,
+4,76,4,250,0,36,0,47,0,0,19,20,22,23,38,38,53,52,54,51,50,22,21,20,6,35,34,
+38,2,53,52,54,51,23,17,33,39,53,33,23,21,33,17,38,35,34,6,1,20,23,54,54,53,
+52,38,35,34,6,249,172,136,49,59,127,107,119,166,191,154,116,220,181,249,210,
+108,253,85,77,4,86,77,254,233,83,60,201,228,1,82,52,87,111,56,46,67,81,1,
+165,126,167,3,46,136,65,99,120,189,111,128,163,111,1,0,139,173,205,4,1,6,
+112,20,112,20,254,139,5,189,254,221,86,75,19,122,73,55,63,98,0,0,2,255,169,
+255,246,5,192,4,250,0,20,0,28,0,0,1,35,17,35,39,17,33,17,20,6,35,34,38,38,
+53,17,35,39,53,33,23,5,33,17,20,22,51,50,53,5,192,237,19,124,254,206,138,
+134,75,162,120,167,77,5,202,77,252,190,254,178,80,85,169,4,118,251,128,93,
+4,35,254,28,169,171,102,165,99,1,202,112,20,112,20,254,19,108,101,242,0,1,
+255,169,255,231,4,119,4,250,0,28,0,0,1,35,17,35,39,17,38,35,34,6,21,20,22,
+23,7,38,2,53,52,54,51,50,23,17,33,39,53,33,23,4,119,237,19,124,114,130,128,
+146,157,122,59,150,220,217,173,105,173,252,251,77,4,129,77,4,118,251,128,
+93,2,136,14,137,118,117,233,99,66,118,1,35,164,150,186,26,1,28,112,20,112,
+0,0,2,0,82,255,246,4,225,5,0,0,40,0,51,0,0,1,35,17,35,39,17,6,6,35,34,38,
+39,54,54,55,38,53,52,54,51,50,22,22,21,20,6,7,6,21,20,22,51,50,54,55,17,35,
+39,53,33,23,1,54,53,52,38,35,34,6,21,20,22,4,225,237,19,124,51,157,82,175,
+244,78,165,97,40,255,117,89,97,163,76,173,209,22,145,96,106,191,64,106,77,
+1,230,77,252,230,87,79,61,51,71,96,4,118,251,128,93,1,30,57,67,223,182,59,
+42,23,130,170,90,116,116,138,83,122,180,83,9,24,54,89,110,94,2,44,112,20,
+112,254,174,76,105,68,84,63,60,68,101,0,1,255,169,255,80,3,229,4,250,0,44,
+0,0,19,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,7,38,39,6,35,34,
+38,38,53,52,54,51,50,23,17,33,39,53,33,23,21,33,17,39,34,6,209,130,102,93,
+47,14,62,48,68,105,55,62,77,169,162,106,66,39,72,118,213,130,227,185,54,58,
+253,161,77,3,239,77,254,255,96,204,231,1,238,100,130,29,36,44,46,64,105,70,
+41,78,24,122,152,67,157,163,11,116,201,107,144,180,6,1,11,112,20,112,20,254,
+145,2,151,0,2,0,68,255,246,4,179,5,18,0,48,0,60,0,0,1,35,17,35,39,53,6,6,
+35,34,38,53,52,55,46,2,53,52,54,51,50,22,21,20,6,35,34,39,22,23,54,55,23,
+6,6,21,20,22,51,50,54,55,17,35,39,53,33,23,5,20,23,22,51,50,54,53,52,35,34,
+6,4,179,237,19,124,48,140,83,161,227,130,131,63,32,126,103,95,171,102,77,
+62,50,27,93,76,96,102,163,194,83,84,95,185,67,80,77,1,204,77,252,32,19,17,
+20,83,108,89,66,92,4,118,251,128,93,246,46,66,239,105,124,72,108,78,81,51,
+100,123,172,99,81,90,18,23,55,22,6,138,7,104,91,59,67,105,83,2,84,112,20,
+112,152,52,35,5,89,79,95,100,0,0,1,255,169,255,246,4,71,4,250,0,28,0,0,1,
+35,17,35,39,17,38,35,7,22,21,20,6,35,34,38,53,52,54,51,50,4,23,17,33,39,53,
+33,23,4,71,237,19,124,180,110,70,10,43,46,84,148,83,86,139,1,43,64,253,43,
+77,4,81,77,4,118,251,128,93,2,2,9,1,54,66,43,56,154,84,59,73,30,12,1,172,
+112,20,112,0,2,255,169,255,246,4,100,4,250,0,19,0,28,0,0,1,35,17,35,39,17,
+6,6,35,34,46,2,53,17,35,39,53,33,23,5,33,17,20,22,51,50,54,55,4,100,237,19,
+124,41,111,57,68,128,134,45,170,77,4,110,77,254,132,254,75,85,67,71,153,61,
+4,118,251,128,93,1,69,34,46,60,133,125,147,1,93,112,20,112,20,254,14,103,
+78,78,69,0,0,2,255,169,255,246,5,250,4,250,0,37,0,46,0,0,1,17,54,51,50,22,
+21,20,6,7,39,54,54,53,52,38,35,34,6,7,17,35,39,17,6,35,34,46,2,53,17,35,39,
+53,33,23,21,33,33,17,20,22,51,50,54,55,3,89,107,114,128,185,80,59,136,66,
+87,62,52,71,151,76,19,124,89,90,68,128,134,45,170,77,6,4,77,252,208,254,105,
+85,67,63,134,58,4,118,254,112,89,191,154,80,179,68,98,82,158,82,58,70,104,
+79,253,234,93,1,83,58,60,133,125,147,1,57,112,20,112,20,254,50,103,78,61,
+55,0,3,255,169,255,246,4,67,4,250,0,24,0,33,0,42,0,0,1,35,17,35,39,53,6,35,
+34,38,39,38,53,52,54,54,51,50,23,17,33,39,53,33,23,1,53,38,38,35,34,7,19,
+54,7,3,6,6,21,20,22,51,50,4,67,237,19,124,90,120,100,137,67,125,93,151,85,
+170,140,253,47,77,4,77,77,254,132,60,108,63,53,45,250,46,131,252,45,49,125,
+100,61,4,118,251,128,93,219,77,63,63,119,151,90,137,74,110,1,74,112,20,112,
+253,110,215,38,35,14,254,162,36,87,1,100,35,97,50,90,110,0,2,0,82,255,246,
+5,108,5,14,0,38,0,47,0,0,1,35,17,35,39,17,38,35,35,21,20,35,34,38,53,52,54,
+55,53,46,2,53,52,54,51,50,22,22,21,17,22,23,17,35,39,53,33,23,1,53,52,35,
+34,6,21,20,22,5,108,237,19,125,189,165,38,82,74,134,78,69,101,179,110,125,
+98,88,142,80,194,198,173,77,2,42,77,252,108,91,60,78,123,4,118,251,128,93,
+1,171,8,93,90,147,83,57,42,3,89,8,87,146,90,89,118,94,156,88,254,220,8,28,
+2,2,112,20,112,254,187,233,102,68,57,77,112,0,0,2,255,169,255,246,4,163,4,
+250,0,23,0,29,0,0,1,35,17,35,39,17,38,35,35,21,20,35,34,38,53,52,54,55,17,
+35,39,53,33,23,5,33,17,22,22,23,4,163,237,19,125,243,143,38,82,74,134,78,
+68,248,77,4,173,77,254,131,254,88,130,238,56,4,118,251,128,93,1,170,9,93,
+90,147,83,57,42,3,1,219,112,20,112,20,254,34,5,27,10,0,0,2,255,169,255,246,
+4,166,4,250,0,21,0,37,0,0,1,35,17,35,39,17,6,6,35,34,38,39,54,54,53,52,39,
+33,39,53,33,23,5,33,22,21,20,6,6,7,6,21,20,22,51,50,54,55,4,166,237,19,125,
+51,136,69,175,244,78,134,146,71,254,237,77,4,176,77,254,131,254,75,108,46,
+86,78,25,143,94,92,171,64,4,118,251,128,93,1,53,42,49,223,182,44,141,81,86,
+84,112,20,112,20,133,107,61,91,77,55,18,26,52,84,84,75,0,1,255,169,255,236,
+3,43,4,250,0,28,0,0,1,33,22,21,20,6,7,22,5,7,38,0,53,52,54,51,50,22,23,54,
+54,53,52,39,33,39,53,33,23,3,43,254,244,64,179,157,122,1,30,114,192,254,225,
+58,47,45,60,40,70,74,46,254,68,77,3,53,77,4,118,134,134,125,220,70,180,182,
+117,163,1,157,116,55,65,38,42,32,130,74,111,83,112,20,112,0,0,1,255,169,255,
+242,5,81,4,250,0,44,0,0,1,35,17,35,39,17,39,34,6,21,23,39,38,53,52,55,38,
+35,34,6,21,20,18,23,7,38,38,2,53,52,54,51,50,23,54,54,51,50,23,53,33,39,53,
+33,23,5,81,217,19,124,24,120,142,5,161,6,47,62,68,93,118,184,164,61,93,207,
+149,158,125,145,125,50,136,75,50,40,252,13,77,5,91,77,4,118,251,128,93,2,
+222,1,160,131,97,45,50,46,104,81,39,119,97,148,254,255,119,69,65,211,1,8,
+131,128,157,121,51,55,7,222,112,20,112,0,0,2,255,169,255,246,4,53,4,250,0,
+23,0,37,0,0,1,35,17,35,39,53,6,35,34,46,2,53,52,54,51,50,23,17,33,39,53,33,
+23,1,53,38,38,35,34,6,6,21,20,22,51,50,54,4,53,237,19,124,97,128,82,118,132,
+68,182,133,171,139,253,61,77,4,63,77,254,132,59,105,65,81,121,63,106,88,82,
+155,4,118,251,128,93,252,90,51,118,139,76,125,168,110,1,74,112,20,112,253,
+153,171,38,33,69,107,57,79,101,91,0,3,0,64,255,246,5,61,5,12,0,29,0,40,0,
+50,0,0,37,7,39,38,39,6,35,34,38,53,52,54,51,50,22,23,54,55,38,38,53,52,54,
+51,50,22,21,16,5,0,1,35,17,35,39,17,35,39,53,33,23,1,54,53,52,38,35,34,6,
+21,20,3,0,128,170,92,51,40,56,67,100,73,53,37,65,52,83,64,181,192,126,101,
+142,215,254,228,1,25,2,130,237,19,124,137,77,2,5,77,252,210,42,81,64,70,91,
+66,75,217,122,60,11,85,60,54,61,32,43,30,102,64,193,119,99,121,245,148,254,
+194,158,254,221,3,242,251,128,93,4,35,112,20,112,254,117,100,105,101,99,91,
+69,141,0,3,255,169,255,246,4,130,4,250,0,19,0,22,0,30,0,0,1,35,17,35,39,17,
+6,6,35,34,46,2,53,17,35,39,53,33,23,5,33,1,7,1,39,17,20,22,51,50,4,130,237,
+19,124,43,130,66,68,128,134,45,170,77,4,140,77,254,132,254,45,1,211,65,254,
+227,117,85,67,129,4,118,251,128,93,1,96,44,63,60,133,125,147,1,93,112,20,
+112,20,254,5,67,1,53,138,254,141,103,78,0,0,2,255,169,255,236,5,101,4,250,
+0,34,0,44,0,0,1,35,17,35,39,17,6,35,34,38,39,6,7,22,5,7,38,0,53,52,54,51,
+50,22,23,54,54,53,52,39,33,39,53,33,23,5,33,22,21,20,7,22,51,50,55,5,101,
+237,19,124,72,91,96,181,67,85,138,122,1,30,114,192,254,225,58,47,45,60,40,
+70,74,46,254,68,77,5,111,77,254,132,254,54,64,55,98,108,134,109,4,118,251,
+128,93,1,200,25,55,43,91,62,180,182,117,163,1,157,116,55,65,38,42,32,130,
+74,111,83,112,20,112,20,134,134,97,89,48,63,0,1,255,169,255,34,3,242,4,250,
+0,48,0,0,19,20,23,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,23,
+7,38,2,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,
+6,252,50,95,112,167,215,55,61,136,119,100,74,136,170,170,196,49,218,245,99,
+116,172,139,99,115,253,118,77,3,252,77,225,102,127,163,141,2,170,59,44,54,
+213,115,68,105,61,96,98,100,70,70,154,122,111,199,66,75,76,1,13,171,134,97,
+97,112,114,111,12,195,112,20,112,20,254,207,10,90,0,3,255,169,0,133,5,183,
+4,250,0,34,0,48,0,62,0,0,1,17,30,2,21,20,6,35,34,38,39,6,6,35,34,38,38,53,
+52,54,51,50,22,23,54,54,55,53,33,39,53,33,23,21,1,34,6,6,7,7,22,22,51,50,
+54,53,52,38,5,38,38,35,34,6,21,20,22,51,50,54,54,55,4,50,64,121,65,188,137,
+86,157,62,46,121,86,99,170,99,187,137,86,157,62,43,109,77,252,83,77,5,193,
+77,254,73,62,89,58,39,47,50,103,61,100,136,87,254,87,50,103,61,100,136,87,
+68,62,89,58,39,4,118,254,236,26,118,142,94,148,205,84,85,80,89,116,171,115,
+148,205,85,84,74,88,6,255,112,20,112,20,254,148,77,116,98,114,60,55,184,132,
+104,100,130,60,55,184,132,104,100,77,116,98,0,0,2,0,131,254,242,5,186,4,250,
+0,67,0,78,0,0,1,35,17,35,39,17,6,35,34,39,14,2,21,20,22,51,50,55,38,53,52,
+54,51,50,22,21,20,6,7,22,23,7,38,39,6,35,34,39,38,38,53,52,54,54,55,38,53,
+52,54,51,50,22,22,21,20,6,7,22,51,50,55,17,35,39,53,33,23,1,54,54,53,52,38,
+35,34,6,21,20,5,186,237,19,124,87,103,193,168,84,98,69,94,76,73,42,14,62,
+48,68,105,55,62,77,169,162,106,66,45,40,152,126,75,64,69,104,80,191,129,105,
+87,160,95,71,65,79,79,166,129,150,77,2,18,77,252,17,79,84,66,57,61,80,4,118,
+251,128,93,1,251,27,84,55,79,104,63,76,95,24,36,44,46,64,105,70,41,78,24,
+122,152,67,157,163,9,125,73,114,63,73,115,85,52,144,160,103,126,122,154,81,
+58,97,49,17,61,1,129,112,20,112,254,140,52,100,63,55,76,82,63,123,0,1,255,
+169,255,125,4,225,4,250,0,40,0,0,1,35,17,35,39,17,33,22,21,20,6,7,22,23,7,
+38,39,38,38,53,52,54,51,50,23,50,54,53,52,38,39,35,39,53,33,17,33,39,53,33,
+23,4,225,237,19,124,254,114,141,150,122,111,148,108,144,103,79,113,62,39,
+88,54,86,92,65,56,158,77,2,240,252,145,77,4,235,77,4,118,251,128,93,2,135,
+123,147,104,139,11,142,77,118,128,216,18,101,62,47,52,127,91,70,62,106,35,
+112,20,1,24,112,20,112,0,0,1,255,169,255,236,4,96,4,250,0,30,0,0,1,17,23,
+21,33,39,53,33,17,33,18,17,20,35,34,38,53,52,51,50,23,54,53,52,39,35,39,53,
+33,23,21,3,115,72,252,199,72,2,170,254,133,50,106,81,160,98,44,43,8,13,254,
+77,4,106,77,4,118,251,242,104,20,104,20,4,14,254,212,254,244,186,178,88,92,
+5,64,69,129,139,112,20,112,20,0,1,255,169,255,236,5,106,4,250,0,38,0,0,1,
+17,23,21,33,39,53,33,17,33,34,39,22,21,20,6,35,34,2,39,55,22,22,51,50,54,
+53,52,38,39,55,33,53,33,39,53,33,23,21,4,125,72,251,170,72,3,199,254,238,
+81,23,98,128,107,143,226,75,87,69,158,83,60,74,66,51,35,1,254,252,8,77,5,
+116,77,4,118,251,242,104,20,104,20,2,153,4,110,138,102,121,1,7,245,28,203,
+183,73,64,67,131,41,72,242,112,20,112,20,0,2,255,169,255,57,4,86,4,250,0,
+49,0,55,0,0,1,21,33,17,38,35,34,6,21,20,22,23,54,54,51,50,22,22,21,20,6,35,
+34,36,39,55,22,22,51,50,54,53,52,38,35,34,7,38,38,53,52,54,51,50,23,53,33,
+39,53,33,3,23,21,33,39,53,4,86,254,220,103,54,173,160,37,33,65,134,52,85,
+120,107,195,158,163,254,217,122,74,92,225,115,138,177,78,58,117,149,109,133,
+151,140,67,110,253,85,77,4,96,95,72,252,158,72,4,138,20,254,208,9,91,76,29,
+53,18,40,39,70,148,79,129,160,183,177,53,133,143,112,86,55,57,95,62,177,84,
+100,111,11,194,112,20,250,187,104,20,104,20,0,0,3,255,169,255,236,4,67,4,
+250,0,28,0,37,0,46,0,0,1,17,23,21,33,39,53,33,17,6,35,34,38,39,38,53,52,54,
+54,51,50,23,17,33,39,53,33,23,21,1,53,38,38,35,34,7,19,54,7,3,6,6,21,20,22,
+51,50,3,86,72,252,240,72,2,139,96,124,100,137,67,125,93,151,85,170,140,253,
+47,77,4,77,77,254,132,60,108,63,53,45,250,46,131,252,45,49,125,100,61,4,118,
+251,242,104,20,104,20,1,20,85,63,63,119,151,90,137,74,110,1,4,112,20,112,
+20,253,200,215,38,35,14,254,162,36,87,1,100,35,97,50,90,110,0,4,255,169,254,
+113,5,106,4,250,0,33,0,41,0,49,0,57,0,0,1,35,17,35,39,17,33,34,39,22,21,20,
+6,35,34,0,3,55,18,22,51,50,53,52,38,39,55,33,53,33,39,53,33,23,1,20,35,34,
+53,52,51,50,5,20,35,34,53,52,51,50,3,20,35,34,53,52,51,50,5,106,237,19,124,
+254,238,81,23,166,125,109,166,254,251,86,87,83,189,97,144,105,81,35,1,254,
+252,8,77,5,116,77,252,21,98,99,99,98,1,181,98,99,99,98,219,98,99,99,98,4,
+118,251,128,93,2,174,4,168,179,116,130,1,71,1,47,28,254,252,248,148,98,190,
+62,72,242,112,20,112,251,69,101,101,102,102,101,101,102,254,161,101,101,102,
+0,3,255,169,255,246,4,166,4,250,0,21,0,24,0,35,0,0,1,35,17,35,39,17,6,6,35,
+34,38,39,54,54,53,52,39,33,39,53,33,23,5,33,1,7,1,6,6,7,6,21,20,22,51,50,
+4,166,237,19,125,51,136,69,175,244,78,134,146,71,254,237,77,4,176,77,254,
+131,254,76,1,180,68,254,248,9,77,121,25,143,94,142,4,118,251,128,93,1,53,
+42,49,223,182,44,141,81,86,84,112,20,112,20,253,226,68,1,75,60,99,86,18,26,
+52,84,0,1,255,169,255,236,4,163,4,250,0,34,0,0,1,17,54,51,50,22,22,21,20,
+6,7,39,54,54,53,52,38,35,34,7,21,20,35,34,38,53,52,55,17,35,39,53,33,23,21,
+1,126,52,50,116,217,137,202,175,127,173,196,133,101,105,98,82,74,124,136,
+248,77,4,173,77,4,118,254,165,6,101,183,94,115,232,96,114,86,207,106,76,98,
+48,114,90,134,80,85,49,1,123,112,20,112,20,0,1,254,170,5,193,255,115,6,154,
+0,7,0,0,1,52,51,50,21,20,35,34,254,170,101,100,100,101,6,45,109,109,108,0,
+0,2,253,131,5,121,0,145,7,36,0,7,0,20,0,0,1,52,51,50,21,20,35,34,37,55,22,
+51,50,19,23,6,6,35,34,38,38,254,161,88,87,87,88,254,226,72,87,223,218,48,
+134,30,203,154,82,163,124,6,197,95,95,94,115,25,252,1,17,36,171,192,83,160,
+0,2,0,138,0,111,1,113,3,247,0,7,0,15,0,0,19,52,51,50,21,20,35,34,17,52,51,
+50,21,20,35,34,138,116,115,115,116,116,115,115,116,3,122,125,125,124,253,
+237,125,125,124,0,0,1,254,132,253,247,0,243,255,166,0,13,0,0,7,34,7,39,54,
+51,50,22,22,23,7,46,2,209,73,51,47,75,46,87,126,152,137,62,107,137,94,233,
+16,144,15,60,162,177,32,124,124,40,0,1,253,142,254,138,254,93,255,95,0,7,
+0,0,1,52,51,50,21,20,35,34,253,142,104,103,103,104,254,244,107,107,106,0,
+0,1,0,23,0,89,3,88,4,250,0,37,0,0,19,55,18,51,50,54,53,52,38,38,39,46,2,53,
+52,54,51,33,23,21,33,34,6,21,20,22,22,23,30,2,21,20,6,35,34,36,23,70,185,
+218,92,106,61,89,78,86,102,72,121,102,1,27,81,254,220,74,66,55,83,72,91,114,
+80,179,147,137,254,240,1,200,44,254,242,95,81,54,102,88,68,75,102,127,69,
+82,101,113,20,50,50,43,87,79,61,77,113,142,79,122,149,197,0,1,0,160,0,0,3,
+21,4,247,0,29,0,0,37,17,52,54,55,54,54,53,52,38,35,34,7,39,54,54,51,50,22,
+22,21,20,6,7,14,2,21,17,35,1,109,51,59,126,62,69,58,122,153,101,57,154,78,
+88,136,116,67,107,43,41,23,19,92,1,187,77,115,59,125,82,48,48,58,108,126,
+45,61,76,136,84,56,106,111,43,56,85,70,254,64,0,0,1,0,225,4,74,1,170,5,35,
+0,7,0,0,19,52,51,50,21,20,35,34,225,101,100,100,101,4,182,109,109,108,0,1,
+254,216,5,114,255,69,7,3,0,3,0,0,1,51,17,35,254,216,109,109,7,3,254,111,0,
+1,251,235,254,217,255,83,255,99,0,3,0,0,5,33,21,33,251,235,3,104,252,152,
+157,138,0,1,254,0,5,118,255,101,6,253,0,3,0,0,1,55,1,7,254,0,84,1,17,84,6,
+183,70,254,191,70,0,1,254,190,5,118,0,35,6,253,0,3,0,0,1,1,23,1,254,190,1,
+17,84,254,239,5,188,1,65,70,254,191,0,2,253,131,5,121,0,145,7,36,0,12,0,20,
+0,0,19,7,38,35,34,3,39,54,54,51,50,22,22,5,20,35,34,53,52,51,50,145,72,87,
+223,218,48,134,30,203,154,82,163,124,254,252,88,87,87,88,5,195,25,252,254,
+239,36,171,192,83,160,89,95,95,94,0,0,2,0,110,0,219,3,164,4,17,0,12,0,26,
+0,0,19,52,54,51,50,0,21,20,6,35,34,38,38,37,52,38,35,34,6,6,21,20,22,51,50,
+54,54,110,234,177,147,1,8,234,177,102,185,124,2,179,113,89,85,167,106,112,
+90,80,168,110,2,118,177,234,254,248,147,177,234,130,183,176,92,102,102,159,
+80,93,113,103,164,0,0,2,0,89,255,129,2,215,5,8,0,31,0,42,0,0,37,20,7,39,54,
+54,53,52,38,39,39,54,55,55,38,53,52,54,54,51,50,30,2,21,20,6,7,23,30,2,3,
+54,53,52,38,35,34,6,21,20,22,2,121,82,144,26,23,114,153,76,18,37,167,246,
+61,125,91,78,121,115,47,189,221,35,78,114,89,228,181,81,67,85,110,84,53,89,
+91,109,31,44,26,54,148,127,66,18,28,130,178,201,64,117,74,67,127,106,71,94,
+239,169,25,55,94,123,2,84,164,124,64,79,113,85,66,124,0,1,0,147,255,155,3,
+133,5,6,0,35,0,0,1,18,23,7,38,39,39,6,35,34,38,53,52,54,51,50,23,54,54,53,
+52,38,35,34,6,7,39,54,54,51,50,22,22,21,20,6,2,8,228,21,177,52,73,52,29,37,
+84,118,72,65,81,67,148,173,124,96,65,140,50,109,63,158,74,108,206,123,214,
+1,172,254,85,43,59,156,204,149,4,95,72,49,70,95,50,178,101,88,112,51,36,140,
+50,59,157,204,118,120,212,0,0,1,0,123,255,83,3,94,5,18,0,45,0,0,37,22,23,
+7,3,38,38,53,52,54,51,50,23,54,54,53,52,38,39,6,7,39,54,54,53,52,38,35,34,
+6,7,39,54,54,51,50,22,22,21,20,7,22,22,21,20,6,2,7,70,81,170,93,128,156,66,
+52,101,89,132,133,59,53,110,129,116,185,252,82,68,65,145,55,108,62,155,73,
+95,170,116,139,100,87,191,132,106,144,55,1,47,10,106,81,45,61,153,5,113,93,
+53,108,43,43,21,153,34,107,85,61,70,43,36,147,41,48,118,172,80,110,80,80,
+150,78,119,163,0,2,0,118,255,247,4,13,5,18,0,42,0,53,0,0,37,20,6,6,35,34,
+38,38,53,52,55,38,38,53,52,54,55,23,6,6,21,20,22,23,55,62,2,53,52,38,38,35,
+55,22,21,20,6,6,7,7,22,22,7,52,38,39,6,21,20,22,51,50,54,3,186,80,126,67,
+134,227,117,188,129,144,163,88,118,89,108,97,92,119,97,111,74,18,22,1,58,
+140,88,129,109,74,181,136,163,126,118,172,112,85,92,127,244,78,115,60,121,
+146,104,150,156,78,157,100,125,139,31,124,45,98,73,60,104,59,81,64,84,92,
+45,30,50,32,51,85,132,69,121,98,70,49,111,184,32,72,121,70,130,130,83,108,
+109,0,0,1,0,118,255,173,4,79,5,19,0,33,0,0,5,38,2,39,6,35,34,38,38,53,52,
+54,55,23,6,21,20,22,51,50,54,55,38,53,52,54,51,50,22,21,20,7,22,23,3,173,
+36,142,31,79,94,128,185,128,105,108,156,211,121,88,54,99,31,34,73,51,59,82,
+85,129,159,83,65,1,76,97,41,126,203,127,98,250,125,91,245,240,98,129,37,38,
+59,67,71,72,97,74,114,85,249,215,0,1,0,130,255,86,3,241,5,15,0,55,0,0,5,7,
+38,38,39,6,35,34,46,2,53,52,55,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,
+23,54,55,23,14,2,21,20,22,51,50,54,55,38,53,52,54,51,50,22,21,20,6,7,22,22,
+3,241,150,28,90,15,64,67,88,143,141,80,134,69,78,176,154,110,102,63,142,114,
+84,111,78,113,143,59,81,175,124,113,84,41,104,40,11,73,51,64,97,78,66,33,
+119,83,87,51,231,60,23,55,126,126,84,142,91,52,132,74,122,142,23,164,28,86,
+79,77,78,45,1,158,2,47,106,83,81,102,26,29,38,29,71,72,101,70,61,93,28,59,
+165,0,0,2,0,86,0,61,4,84,5,16,0,25,0,35,0,0,1,20,6,6,35,34,0,2,17,55,18,18,
+22,51,50,54,55,46,2,53,52,54,51,50,0,3,55,52,38,35,34,6,21,20,22,4,84,120,
+181,90,188,254,229,160,94,23,139,200,123,97,146,26,110,236,160,130,109,153,
+1,32,163,2,116,102,56,73,191,2,89,180,244,116,1,3,2,32,1,156,20,254,125,254,
+30,212,163,139,3,97,187,131,114,132,254,198,254,253,56,183,205,86,68,111,
+160,0,0,1,0,114,0,60,3,247,5,1,0,26,0,0,19,52,54,54,55,55,23,7,14,2,21,20,
+22,51,50,54,55,23,20,6,6,35,34,46,2,114,96,168,179,225,130,203,177,165,91,
+125,106,107,197,75,129,128,197,118,82,138,166,72,1,253,75,155,169,165,208,
+125,186,162,164,149,74,97,116,137,92,120,8,135,114,68,153,151,0,2,0,92,255,
+180,3,27,4,242,0,31,0,43,0,0,37,20,6,7,39,54,53,52,38,38,39,38,39,38,53,52,
+54,54,51,50,22,22,21,20,6,7,22,23,23,30,2,1,20,23,54,54,53,52,38,35,34,6,
+6,3,16,59,72,148,94,49,76,72,117,72,121,82,148,95,103,158,117,215,177,30,
+38,78,83,93,59,253,250,33,157,195,87,67,74,104,53,142,53,105,60,103,84,69,
+44,85,79,66,106,80,137,162,85,151,91,90,166,98,120,172,24,30,30,69,71,93,
+104,2,167,78,68,16,136,95,68,89,79,119,0,3,0,96,0,1,6,229,6,162,0,7,0,20,
+0,100,0,0,1,52,51,50,21,20,35,34,37,55,22,51,50,19,23,6,6,35,34,38,38,1,20,
+6,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,6,7,14,2,35,34,39,22,22,
+21,20,6,35,34,0,3,55,18,33,50,54,53,52,38,39,6,7,39,54,54,53,52,38,35,34,
+6,7,39,54,51,50,22,22,21,20,6,7,22,51,50,54,54,55,62,2,51,50,22,22,4,50,88,
+87,87,88,254,226,72,87,223,218,48,134,30,203,154,82,163,124,3,183,68,144,
+108,82,195,72,54,62,121,72,103,119,88,70,41,76,66,48,73,105,67,52,43,46,48,
+175,144,175,254,205,95,88,175,1,8,110,127,72,63,65,87,78,162,180,85,71,62,
+142,60,75,147,136,93,159,79,75,80,44,37,75,105,68,43,38,57,82,57,91,169,98,
+6,67,95,95,94,115,25,252,1,17,36,171,192,83,160,252,126,95,179,117,128,97,
+46,66,76,178,153,129,159,67,113,80,98,70,16,57,135,62,137,169,1,69,1,32,37,
+254,10,119,105,74,141,48,31,30,134,49,157,90,68,62,40,31,145,75,123,148,77,
+81,126,51,16,63,90,74,67,77,53,138,198,0,2,0,147,2,61,2,212,4,120,0,11,0,
+23,0,0,19,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,
+54,147,171,116,129,161,176,109,130,162,1,218,106,83,80,100,108,84,79,98,3,
+82,118,176,154,123,119,175,155,133,90,117,117,91,90,117,117,0,1,1,142,255,
+246,2,29,4,250,0,5,0,0,37,17,51,23,17,35,1,142,19,124,19,83,4,167,93,251,
+89,0,255,255,1,142,255,246,3,222,4,250,0,38,0,121,0,0,0,7,0,121,1,193,0,0,
+0,1,252,252,6,7,0,16,8,52,0,5,0,0,3,1,1,39,1,1,44,254,222,254,215,141,1,125,
+1,151,6,15,1,86,254,162,101,1,200,254,21,0,0,2,252,212,5,94,255,232,8,52,
+0,5,0,11,0,0,3,7,1,1,39,1,19,23,17,35,39,17,24,60,254,222,254,215,141,1,125,
+17,111,19,111,6,73,58,1,86,254,162,101,1,200,254,212,83,254,169,83,1,87,0,
+0,1,253,28,6,218,0,7,7,108,0,5,0,0,19,33,39,53,33,23,7,253,108,87,2,148,87,
+6,218,126,20,126,0,2,0,102,5,70,1,241,7,44,0,3,0,7,0,0,19,35,19,51,19,35,
+19,51,212,110,60,110,165,110,60,110,5,70,1,230,254,26,1,230,0,1,253,164,2,
+25,0,66,2,171,0,5,0,0,19,33,39,53,33,23,66,253,185,87,2,71,87,2,25,126,20,
+126,0,1,252,72,254,23,255,178,255,219,0,36,0,0,3,20,6,35,34,39,6,6,35,34,
+38,53,52,55,23,6,21,20,22,51,50,54,53,53,23,21,20,7,22,51,50,54,53,52,39,
+55,22,78,117,98,108,75,32,93,53,119,179,69,147,71,58,39,62,82,142,11,46,65,
+59,76,62,62,111,254,233,95,115,78,36,41,159,106,88,98,93,97,72,43,49,95,75,
+118,60,110,36,33,33,75,58,78,72,50,118,0,0,1,252,140,254,37,255,119,255,222,
+0,8,0,0,3,21,33,39,17,51,23,21,33,137,253,108,87,19,124,2,5,254,57,20,126,
+1,59,93,202,0,0,1,252,95,253,242,255,102,255,213,0,16,0,0,1,20,51,33,23,21,
+33,34,38,38,53,52,54,55,23,34,6,252,220,50,2,1,87,254,2,63,124,78,157,133,
+51,88,128,254,177,45,126,20,81,124,58,90,120,10,152,84,255,255,253,110,253,
+239,0,103,255,89,2,7,0,42,0,0,248,118,255,255,253,160,254,72,0,130,255,198,
+2,6,1,5,0,1,0,2,254,54,5,94,255,183,6,249,0,3,0,7,0,0,1,51,17,35,19,51,17,
+35,254,54,139,139,246,139,139,6,249,254,101,1,155,254,101,0,0,3,253,214,5,
+94,0,22,6,249,0,3,0,7,0,11,0,0,1,51,17,35,19,51,17,35,19,51,17,35,253,214,
+130,130,223,130,130,223,130,130,6,249,254,101,1,155,254,101,1,155,254,101,
+0,1,254,175,253,241,255,62,255,202,0,5,0,0,1,17,51,23,17,35,254,175,19,124,
+19,254,78,1,124,93,254,132,0,1,254,92,253,243,255,158,255,69,0,3,0,0,1,55,
+23,7,254,92,161,161,161,254,156,169,169,169,0,2,253,112,254,144,255,104,255,
+114,0,11,0,23,0,0,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,
+20,6,35,34,38,253,112,63,44,44,63,63,44,44,63,1,34,63,44,45,62,63,44,44,63,
+255,47,66,66,47,47,66,66,47,47,66,66,47,47,66,66,0,3,252,78,254,144,255,104,
+255,114,0,11,0,23,0,35,0,0,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,
+50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,252,78,63,44,45,
+62,63,44,45,62,1,34,63,44,44,63,63,44,44,63,1,34,63,44,45,62,63,44,44,63,
+255,47,66,66,47,47,66,66,47,47,66,66,47,47,66,66,47,47,66,66,47,47,66,66,
+0,1,0,79,4,111,3,127,6,96,0,19,0,0,1,34,6,21,20,51,50,55,23,6,35,34,38,53,
+52,54,51,33,23,21,1,130,88,114,116,65,68,38,44,49,114,185,155,119,1,199,87,
+5,206,70,54,80,29,160,16,166,103,101,127,126,20,0,0,1,255,175,254,182,3,109,
+6,217,0,34,0,0,1,50,22,23,7,38,38,35,34,6,21,20,22,23,22,18,21,20,6,35,34,
+39,55,22,51,50,17,52,2,39,38,38,53,52,54,2,62,111,145,47,74,35,94,49,88,80,
+20,21,24,25,177,145,145,161,47,111,76,205,23,23,22,22,139,6,217,159,142,31,
+70,70,126,168,105,227,182,206,254,216,151,194,236,123,80,48,1,79,129,1,6,
+195,193,251,123,209,231,0,0,1,253,167,1,236,0,35,2,126,0,5,0,0,19,21,33,39,
+53,33,35,253,219,87,2,37,2,0,20,126,20,0,0,1,254,200,1,237,1,98,4,175,0,14,
+0,0,1,20,6,35,33,39,53,33,50,53,52,37,55,22,22,1,98,164,127,254,224,87,1,
+52,197,254,235,59,171,208,2,229,109,139,126,20,144,149,195,72,113,221,0,1,
+0,67,1,237,2,210,4,173,0,16,0,0,19,20,22,51,33,23,21,33,34,38,53,52,54,55,
+23,6,6,210,39,42,1,88,87,254,134,106,171,208,161,91,141,176,2,193,35,31,126,
+20,157,101,111,248,87,140,61,195,0,1,0,74,255,189,2,228,2,127,0,14,0,0,19,
+52,54,51,33,23,21,33,34,21,20,5,7,38,38,74,164,127,1,32,87,254,204,197,1,
+21,59,171,208,1,135,109,139,126,20,144,149,195,72,113,221,0,0,1,254,207,255,
+189,1,97,2,127,0,16,0,0,19,52,38,35,33,39,53,33,50,22,21,20,6,7,39,54,54,
+207,39,42,254,168,87,1,122,106,174,207,165,110,143,193,1,171,35,31,126,20,
+159,101,111,245,90,142,62,199,0,1,254,240,1,244,1,218,6,18,0,35,0,0,1,52,
+38,39,39,46,2,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,23,22,22,21,20,6,
+35,33,39,53,33,50,54,1,24,52,96,61,65,73,51,129,100,110,174,79,76,105,134,
+64,74,46,79,153,136,163,134,254,179,77,1,123,84,89,2,241,42,86,93,58,60,81,
+100,57,97,127,136,154,36,208,82,67,46,79,70,142,173,78,92,107,112,20,62,0,
+0,1,255,194,254,83,2,215,2,126,0,38,0,0,7,55,22,22,51,50,54,53,52,38,38,39,
+46,2,53,52,54,51,33,23,21,33,34,6,21,20,22,23,30,2,21,20,6,35,34,38,38,62,
+70,104,128,80,77,102,57,82,69,64,73,51,118,95,1,81,74,254,171,55,67,61,100,
+71,89,63,161,129,97,155,112,95,47,150,90,84,65,65,109,83,60,55,74,93,53,86,
+99,110,18,52,50,48,97,86,62,96,130,80,116,122,95,142,0,1,0,100,255,246,6,
+21,5,4,0,53,0,0,1,20,6,7,39,54,54,53,52,35,34,6,6,21,16,0,51,50,36,18,53,
+52,38,35,34,6,21,20,22,23,7,46,2,53,52,54,51,50,18,17,16,0,33,34,36,2,53,
+52,54,54,51,50,22,3,34,198,168,53,126,168,96,94,145,80,1,9,254,186,1,42,167,
+109,100,66,87,155,125,6,109,198,122,123,111,186,222,254,125,254,191,208,254,
+169,198,101,191,130,123,157,3,218,107,145,25,167,9,117,80,91,147,239,133,
+255,0,254,236,186,1,44,163,202,175,82,63,82,102,9,81,1,93,160,95,96,110,254,
+185,254,235,254,199,254,135,200,1,91,211,146,245,145,167,0,0,1,0,77,255,246,
+5,166,5,17,0,82,0,0,19,52,54,54,55,62,2,53,52,38,35,34,6,21,20,22,23,7,38,
+38,53,52,54,51,50,22,22,21,20,6,6,7,14,2,21,20,33,50,54,53,52,38,39,46,2,
+53,52,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,22,22,23,30,2,
+21,20,6,6,35,34,36,38,166,49,70,61,62,75,51,59,56,79,110,52,53,35,108,115,
+141,115,78,162,107,56,80,66,58,67,45,1,166,201,215,60,93,49,59,40,173,140,
+114,174,133,120,70,84,118,45,43,97,128,36,52,47,53,64,45,124,239,164,155,
+254,227,176,1,186,65,100,71,51,50,76,108,70,56,59,93,65,40,77,29,50,47,154,
+82,95,116,106,164,81,67,114,89,61,54,73,87,47,219,150,134,68,132,107,58,81,
+100,57,128,156,168,112,82,109,22,153,9,82,51,30,42,116,88,52,92,76,59,65,
+95,124,74,94,155,91,115,207,0,0,1,0,83,255,246,5,179,5,8,0,67,0,0,19,52,54,
+54,55,62,2,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,6,
+6,7,14,2,21,20,22,51,50,36,18,53,16,35,34,6,21,20,22,23,7,38,38,53,52,54,
+51,50,18,21,20,2,4,35,34,36,38,203,45,65,56,57,68,47,59,56,78,110,106,39,
+108,114,142,115,78,162,107,52,75,61,54,59,41,202,172,169,1,24,161,184,73,
+105,147,126,13,188,226,131,105,183,227,166,254,215,189,166,254,235,161,1,
+186,65,100,72,50,51,76,107,70,56,59,92,65,87,60,63,50,159,82,96,120,106,164,
+81,69,117,90,61,54,69,85,47,101,116,166,1,34,176,1,22,93,69,85,81,20,74,17,
+170,129,110,132,254,228,233,192,254,208,171,124,208,0,0,2,0,83,255,244,6,
+127,5,8,0,70,0,80,0,0,37,20,6,7,39,54,54,53,52,38,39,6,0,35,34,36,38,53,52,
+54,54,55,62,2,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,20,
+6,6,7,6,6,21,20,22,51,50,36,55,38,38,53,52,54,51,50,18,21,20,7,22,22,1,54,
+53,52,35,34,6,21,20,22,6,127,76,61,150,62,73,66,67,55,254,184,229,155,254,
+253,149,45,65,56,57,68,47,59,56,78,110,106,39,108,114,142,115,78,162,107,
+51,72,60,97,62,179,140,195,1,46,68,201,225,131,105,164,197,7,137,133,254,
+101,19,136,70,98,118,255,82,143,40,121,33,109,54,70,88,33,236,254,238,129,
+209,116,65,100,72,50,51,76,107,70,56,59,92,65,87,60,63,50,159,82,96,120,106,
+164,81,63,112,88,62,100,112,55,97,123,230,199,69,179,130,110,132,254,252,
+212,65,53,62,157,1,17,83,95,222,98,68,68,106,0,0,1,254,170,253,246,0,241,
+255,187,0,3,0,0,5,1,7,1,254,229,2,12,59,253,244,69,254,122,63,1,134,0,0,2,
+0,115,255,246,4,13,5,4,0,47,0,55,0,0,37,20,6,6,35,34,38,38,53,52,55,38,53,
+52,54,51,50,23,23,38,35,34,6,21,20,22,23,54,51,51,23,35,34,6,6,21,20,22,51,
+50,55,38,53,52,54,51,50,22,19,20,35,34,53,52,51,50,3,189,110,167,81,121,214,
+129,146,166,200,160,89,93,53,112,91,106,126,43,44,130,151,19,59,20,102,195,
+127,121,94,94,97,15,83,62,68,76,80,100,101,101,100,228,73,108,57,115,195,
+113,151,99,145,154,146,176,30,169,38,101,105,65,98,47,55,169,59,125,87,90,
+103,50,39,35,63,72,84,1,143,108,108,109,0,2,0,127,255,245,3,96,5,18,0,52,
+0,60,0,0,37,20,6,35,34,38,38,53,52,54,55,38,38,53,52,36,51,23,23,38,35,34,
+6,6,21,20,22,51,50,54,55,23,6,7,14,2,21,20,22,51,50,54,53,52,35,34,7,39,54,
+51,50,22,3,20,35,34,53,52,51,50,3,59,150,110,99,180,111,87,83,100,120,1,12,
+233,66,74,34,50,106,202,130,160,134,66,154,59,45,99,110,87,176,115,128,102,
+86,137,87,48,62,45,48,45,105,141,123,108,109,109,108,188,86,113,94,168,106,
+77,152,53,54,167,94,160,184,2,164,5,59,113,76,80,81,27,24,167,36,6,11,78,
+117,67,75,70,63,40,48,16,154,11,153,2,114,101,101,100,0,3,0,80,255,246,3,
+233,5,15,0,39,0,47,0,59,0,0,1,20,6,35,34,38,38,53,52,54,51,51,38,38,39,46,
+2,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,22,22,23,22,22,3,52,51,
+50,21,20,35,34,19,52,38,35,34,6,21,20,22,51,50,54,3,230,228,193,128,230,139,
+242,183,16,12,57,51,43,52,35,116,103,110,148,58,71,48,92,59,52,58,33,37,46,
+55,9,172,220,198,101,100,100,101,44,149,119,149,200,166,121,136,194,1,51,
+145,172,112,194,115,132,170,44,71,49,41,59,76,45,92,105,134,126,31,82,66,
+53,50,41,53,39,46,90,75,29,223,1,121,109,109,108,254,184,96,115,163,122,98,
+128,176,0,3,0,79,255,189,3,177,4,175,0,29,0,37,0,45,0,0,1,50,22,22,21,20,
+6,7,39,54,54,53,52,38,35,33,34,38,38,53,52,54,55,23,6,6,21,20,22,51,37,52,
+51,50,21,20,35,34,1,52,51,50,21,20,35,34,2,96,81,157,99,186,180,110,135,215,
+61,52,254,222,81,157,99,186,180,110,135,215,61,52,1,31,101,100,100,101,254,
+138,101,100,100,101,2,127,84,141,80,111,193,97,151,52,199,79,40,39,84,141,
+80,111,193,97,151,52,199,79,40,39,222,109,109,108,254,31,109,109,108,0,0,
+2,0,70,0,119,3,165,4,7,0,13,0,27,0,0,19,55,22,22,51,50,54,55,23,6,6,35,34,
+38,1,7,38,38,35,34,6,7,39,54,54,51,50,22,80,74,45,167,133,117,158,26,133,
+34,227,160,149,232,3,24,74,45,168,133,117,158,26,132,34,226,160,150,232,3,
+219,28,129,131,147,129,44,164,194,192,253,110,28,129,131,147,129,46,164,192,
+192,0,0,2,0,74,0,102,4,25,4,2,0,13,0,27,0,0,55,39,54,54,53,52,38,39,55,22,
+22,21,20,6,1,23,6,6,21,20,22,23,7,38,38,53,52,54,126,52,141,143,125,127,33,
+171,199,204,2,180,52,141,143,125,127,33,171,199,204,112,158,29,165,119,132,
+168,54,89,60,247,152,172,243,3,96,158,29,165,119,132,168,54,89,60,247,152,
+172,243,255,255,253,110,6,165,0,103,8,15,2,7,0,42,0,0,1,44,0,1,0,80,0,52,
+3,205,4,68,0,11,0,0,1,1,7,1,1,39,1,1,55,1,1,23,2,114,1,77,73,254,197,254,
+157,136,1,129,254,191,73,1,48,1,60,136,2,44,254,76,46,1,157,254,77,100,1,
+217,1,165,46,254,113,1,132,100,0,2,0,98,0,85,3,204,4,23,0,36,0,73,0,0,19,
+52,55,23,6,21,20,22,51,50,54,53,53,23,21,20,7,22,51,50,54,53,52,39,55,22,
+21,20,6,35,34,39,6,6,35,34,38,1,20,7,39,54,53,52,38,35,34,6,21,21,39,53,52,
+55,38,35,34,6,21,20,23,7,38,53,52,54,51,50,23,54,54,51,50,22,98,69,147,71,
+58,39,62,82,142,11,47,64,60,75,62,62,111,117,98,108,75,32,93,53,119,179,3,
+106,69,147,71,58,39,62,82,142,11,46,65,59,76,62,62,111,117,98,108,75,32,93,
+53,119,179,3,93,88,98,93,97,72,43,49,95,75,118,60,110,36,33,33,76,57,78,72,
+50,118,119,95,115,78,36,41,159,254,28,88,98,93,97,72,43,49,95,75,118,60,110,
+36,33,33,75,58,78,72,50,118,119,95,115,78,36,41,159,0,0,1,0,150,255,246,1,
+37,4,250,0,5,0,0,55,17,51,23,17,35,150,19,124,19,83,4,167,93,251,89,255,255,
+0,150,255,246,2,164,4,250,0,39,0,121,255,8,0,0,0,7,0,121,0,135,0,0,255,255,
+0,150,255,246,4,35,4,250,0,39,0,121,255,8,0,0,0,39,0,121,0,135,0,0,0,7,0,
+121,2,6,0,0,0,1,0,75,3,124,4,179,4,250,0,3,0,0,19,39,37,23,205,130,3,230,
+130,3,124,130,252,130,255,255,0,75,1,206,4,179,4,250,2,38,0,165,0,0,0,7,0,
+165,0,0,254,82,255,255,0,75,0,32,4,179,4,250,2,38,0,165,0,0,0,39,0,165,0,
+0,254,82,0,7,0,165,0,0,252,164,0,2,0,130,1,75,2,250,3,195,0,13,0,25,0,0,19,
+52,54,51,50,22,22,21,20,6,35,34,38,38,37,52,38,35,34,6,21,20,22,51,50,54,
+130,180,136,77,147,92,180,136,74,148,94,2,0,67,50,97,178,73,51,96,172,2,135,
+136,180,95,148,73,136,180,96,148,149,52,61,167,93,56,66,174,0,2,0,130,0,181,
+3,227,4,250,0,16,0,28,0,0,1,23,7,6,7,22,22,21,20,6,35,34,38,53,52,54,55,5,
+52,38,35,34,6,21,20,22,51,50,54,3,117,110,206,129,153,113,142,180,136,115,
+201,72,79,1,105,67,50,105,170,73,51,103,165,4,250,105,168,105,110,21,162,
+106,136,180,208,121,80,120,65,201,52,61,160,100,56,66,167,0,0,1,254,199,254,
+129,1,249,5,16,0,15,0,0,3,34,39,55,22,51,32,17,52,2,3,55,18,17,16,0,123,90,
+100,33,128,106,1,189,118,108,161,171,254,179,254,129,21,170,30,2,18,193,1,
+222,1,0,61,254,51,254,118,254,124,254,76,0,0,1,254,165,254,15,2,179,5,17,
+0,31,0,0,3,34,39,55,22,51,50,54,54,53,52,38,39,38,38,53,52,54,55,23,6,6,21,
+20,22,23,22,22,21,20,6,4,170,89,88,30,104,98,145,237,140,58,57,73,46,230,
+239,49,192,221,52,54,74,49,175,254,205,254,15,13,182,23,95,188,134,91,172,
+125,158,167,78,162,216,36,172,19,129,139,73,153,123,168,182,78,176,252,130,
+0,0,2,254,48,6,58,255,203,7,213,0,11,0,23,0,0,1,52,54,51,50,22,21,20,6,35,
+34,38,37,52,38,35,34,6,21,20,22,51,50,54,254,48,117,89,74,131,118,87,73,133,
+1,83,56,45,62,103,58,43,59,106,7,7,88,118,133,73,87,118,135,102,46,51,98,
+59,49,54,104,0,0,2,254,101,5,115,255,165,8,57,0,25,0,36,0,0,3,20,7,39,54,
+53,52,38,39,39,55,38,53,52,54,51,50,22,22,21,20,6,7,30,2,3,54,53,52,38,35,
+34,6,21,20,22,136,41,76,25,71,61,41,111,121,78,61,46,75,60,117,82,45,58,51,
+116,86,40,34,41,49,41,5,206,46,45,55,31,20,34,78,51,35,88,89,100,55,74,51,
+84,52,58,127,63,32,47,69,1,42,79,57,32,40,53,39,32,62,0,0,1,254,92,5,171,
+255,197,8,57,0,30,0,0,3,23,22,23,7,39,7,34,38,53,52,54,51,50,23,54,54,53,
+52,38,35,34,7,39,54,51,50,22,21,20,6,235,9,55,56,88,87,33,38,59,36,33,38,
+31,66,82,57,47,58,59,54,67,74,73,136,101,6,163,15,97,108,28,237,2,45,39,23,
+34,42,22,77,49,39,50,44,76,51,148,81,60,96,0,0,1,254,90,5,91,255,207,8,58,
+0,40,0,0,3,22,23,7,39,38,38,53,52,54,51,50,23,54,54,53,52,39,6,7,39,54,54,
+53,52,38,35,34,7,39,54,51,50,22,21,20,7,22,21,20,6,221,33,42,87,45,55,89,
+34,26,52,43,65,65,54,49,69,59,94,121,41,34,71,57,54,68,77,69,122,68,93,100,
+5,240,47,75,27,148,5,50,47,22,31,74,2,57,44,57,44,19,13,81,18,49,40,30,33,
+38,77,44,127,58,54,40,71,82,64,80,0,2,254,11,5,208,255,215,8,71,0,37,0,48,
+0,0,3,20,6,35,34,38,38,53,52,55,38,38,53,52,54,55,23,6,21,20,22,23,55,54,
+54,53,52,38,39,55,22,21,20,6,7,7,22,22,7,52,38,39,6,21,20,22,51,50,54,83,
+80,56,71,117,51,90,63,70,84,42,62,99,44,43,66,70,66,13,7,32,70,66,94,41,75,
+84,84,61,59,82,57,38,41,66,6,78,54,72,66,71,48,76,72,37,73,46,56,72,14,66,
+47,56,26,45,26,43,45,57,30,16,32,8,28,42,66,38,76,57,26,43,88,27,36,58,33,
+63,63,40,51,50,0,1,254,1,5,146,255,241,8,69,0,32,0,0,3,38,38,39,6,35,34,38,
+38,53,52,54,55,23,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,23,
+96,18,70,17,40,46,63,95,66,53,54,81,106,63,42,58,32,17,38,26,31,40,43,65,
+79,5,146,31,162,51,20,66,103,61,49,125,63,46,122,120,49,62,38,29,31,36,35,
+48,37,59,43,124,106,0,1,254,51,5,92,255,236,8,57,0,49,0,0,3,7,38,38,39,6,
+35,34,38,38,53,52,55,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,54,55,23,
+6,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,20,77,15,45,7,33,31,
+57,91,78,67,74,87,78,55,51,32,66,62,42,53,38,51,75,30,82,105,56,39,57,36,
+6,36,26,31,50,71,46,5,136,44,26,114,30,11,50,94,52,72,44,57,73,59,73,12,85,
+14,41,38,39,38,20,2,82,2,64,50,43,46,27,18,16,35,34,49,36,58,33,78,0,0,2,
+253,220,5,222,255,225,8,71,0,23,0,33,0,0,3,20,6,6,35,34,2,17,55,18,22,51,
+50,54,55,46,2,53,52,54,51,50,22,7,55,52,38,35,34,6,21,20,22,31,61,91,47,154,
+164,50,17,130,95,45,73,14,55,118,79,66,55,92,132,88,1,55,50,28,37,95,6,236,
+91,121,58,1,60,1,35,10,254,228,253,78,70,2,48,94,65,58,65,175,111,27,93,98,
+42,32,57,79,0,1,254,38,5,208,255,242,8,57,0,24,0,0,1,52,54,54,55,55,23,14,
+2,21,20,22,51,50,54,55,23,20,6,6,35,34,38,38,254,38,55,99,104,73,66,196,80,
+34,67,49,52,99,37,69,66,100,60,61,112,61,6,181,41,87,99,94,67,63,179,88,67,
+32,54,54,68,46,63,4,69,58,84,94,0,2,254,82,5,154,255,178,8,57,0,23,0,34,0,
+0,3,20,7,39,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,23,22,22,1,20,
+23,54,54,53,52,38,35,34,6,84,66,78,47,46,53,92,58,94,68,79,111,113,80,33,
+95,59,255,0,17,73,95,45,33,47,60,6,7,52,57,52,43,33,30,58,49,82,102,59,67,
+96,111,66,64,81,12,29,81,73,1,67,39,34,8,68,46,35,43,74,0,1,253,137,5,178,
+0,87,8,57,0,54,0,0,19,35,17,35,39,53,6,35,34,39,22,21,20,6,35,34,38,39,55,
+22,51,50,54,53,52,39,6,7,39,54,54,53,52,38,35,34,7,39,54,51,50,22,21,20,7,
+22,51,50,55,53,35,39,53,33,23,87,122,10,65,27,31,58,59,35,79,61,80,123,38,
+43,69,114,37,49,48,25,41,35,83,75,39,30,50,75,38,66,62,65,96,73,57,53,63,
+43,82,42,1,23,42,7,238,253,196,50,247,10,41,48,60,59,68,131,103,17,174,45,
+32,69,44,11,11,73,22,47,35,27,32,34,76,31,99,62,69,38,25,32,186,60,10,60,
+0,1,253,218,5,198,0,26,8,52,0,34,0,0,19,35,22,21,20,7,22,22,21,20,6,35,34,
+38,39,55,22,51,50,54,53,52,39,6,7,39,54,53,52,39,33,39,53,33,23,26,156,40,
+64,43,49,89,68,73,141,58,44,90,119,50,52,56,38,53,42,171,29,254,187,42,2,
+22,42,7,238,49,64,71,45,37,93,44,71,78,126,141,18,202,53,40,71,54,18,12,78,
+35,87,48,33,60,10,60,0,2,253,70,5,178,0,104,8,52,0,38,0,49,0,0,3,21,54,51,
+50,22,23,20,6,7,39,54,53,52,38,35,34,7,17,35,39,53,6,35,34,38,53,52,54,51,
+50,23,53,33,39,53,33,23,21,1,53,38,35,34,6,21,20,22,51,50,229,52,52,62,92,
+2,40,29,70,76,30,25,59,83,9,66,51,65,75,120,92,66,85,68,254,160,42,2,248,
+42,254,104,55,58,55,74,46,42,86,7,238,195,44,92,81,40,89,34,49,93,68,27,35,
+91,254,246,50,135,49,114,70,62,84,54,160,60,10,60,10,254,232,71,34,67,47,
+32,46,0,0,1,253,164,5,178,255,252,8,52,0,26,0,0,3,35,17,35,39,53,39,35,22,
+21,20,35,34,38,53,52,54,51,50,22,23,53,33,39,53,33,23,4,122,9,66,140,35,5,
+48,43,74,42,44,69,147,33,254,151,42,2,46,42,7,238,253,196,50,254,4,35,25,
+50,78,41,30,38,14,6,207,60,10,60,0,2,253,179,5,178,0,24,8,52,0,18,0,26,0,
+0,19,35,17,35,39,53,6,35,34,46,2,53,53,35,39,53,33,23,7,35,21,20,51,50,54,
+55,24,121,10,65,50,52,35,66,68,22,82,42,2,59,42,196,216,76,34,76,30,7,238,
+253,196,50,157,38,32,70,65,66,170,60,10,60,10,242,90,38,33,0,0,1,254,14,5,
+173,255,214,8,52,0,28,0,0,3,35,22,21,20,6,7,22,23,7,38,38,53,52,54,51,50,
+22,23,54,54,53,52,39,35,39,53,33,23,42,133,31,92,78,61,142,60,99,142,32,25,
+22,30,20,35,37,20,225,42,1,158,42,7,238,65,65,62,112,35,91,88,59,85,204,57,
+29,33,19,21,17,63,36,53,40,60,10,60,0,0,3,253,241,5,218,0,46,8,95,0,38,0,
+47,0,60,0,0,19,35,17,35,39,53,6,35,34,38,39,38,53,52,54,51,50,23,53,33,17,
+35,39,17,35,39,53,51,38,38,53,52,54,51,50,22,23,51,23,39,38,38,35,34,6,21,
+20,23,5,53,38,38,35,34,6,21,20,22,51,50,54,46,85,7,46,34,43,32,44,23,41,66,
+44,58,49,254,222,7,46,63,29,104,17,21,73,53,90,148,47,67,29,133,43,117,66,
+44,54,16,1,47,20,37,22,41,49,35,31,28,53,7,106,254,112,35,83,30,23,22,39,
+52,46,57,37,110,254,112,35,1,109,42,7,19,49,24,48,56,119,77,42,42,64,81,47,
+39,29,30,254,58,13,11,49,30,24,37,31,0,0,1,254,22,5,228,255,183,8,52,0,33,
+0,0,1,55,22,51,50,54,53,52,38,39,38,38,53,52,54,51,51,23,21,35,34,21,20,22,
+23,30,2,21,20,6,35,34,38,254,22,37,91,108,44,52,57,56,76,53,57,55,142,42,
+147,70,51,54,46,57,40,90,74,78,133,6,155,24,133,47,37,38,70,48,65,83,39,38,
+53,60,10,48,30,58,45,39,56,72,39,61,74,111,255,255,0,100,2,229,3,114,4,144,
+0,7,0,97,2,225,253,108,255,255,0,110,0,137,3,124,4,144,0,39,0,97,2,235,253,
+108,0,7,0,99,2,129,2,146,255,255,0,110,254,81,3,124,4,144,0,39,0,97,2,235,
+253,108,0,39,0,99,2,129,0,90,0,7,0,97,2,235,251,48,0,3,0,120,253,222,3,134,
+4,144,0,7,0,20,0,51,0,0,1,52,51,50,21,20,35,34,37,55,22,51,50,19,23,6,6,35,
+34,38,38,1,20,6,7,19,7,3,7,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,
+7,39,54,54,51,50,22,1,150,88,87,87,88,254,226,72,87,223,218,48,134,30,203,
+154,82,163,124,2,213,178,131,209,162,151,30,83,109,65,56,66,53,110,147,95,
+73,54,117,42,106,52,146,63,123,241,4,49,95,95,94,115,25,252,1,17,36,171,192,
+83,160,252,244,99,185,39,254,134,49,1,151,1,88,66,40,59,73,40,142,79,64,83,
+42,30,133,41,50,253,0,0,3,0,120,253,176,3,134,4,144,0,7,0,20,0,63,0,0,1,52,
+51,50,21,20,35,34,37,55,22,51,50,19,23,6,6,35,34,38,38,1,20,6,7,23,7,39,38,
+38,53,52,54,51,50,23,54,54,53,52,39,6,7,39,36,53,52,38,35,34,6,7,39,54,54,
+51,50,22,22,21,20,7,22,22,1,150,88,87,87,88,254,226,72,87,223,218,48,134,
+30,203,154,82,163,124,2,202,152,127,129,159,78,103,125,55,43,95,73,93,100,
+85,85,104,97,1,108,67,58,54,120,47,101,52,139,62,76,141,100,116,76,80,4,49,
+95,95,94,115,25,252,1,17,36,171,192,83,160,251,197,93,128,17,209,46,254,11,
+90,62,37,51,126,7,90,67,80,81,31,18,142,67,97,42,43,36,30,137,34,41,96,139,
+64,86,65,56,129,0,0,3,0,112,254,120,3,134,4,144,0,7,0,20,0,57,0,0,1,52,51,
+50,21,20,35,34,37,55,22,51,50,19,23,6,6,35,34,38,38,3,55,22,22,51,50,54,53,
+52,38,39,46,2,53,52,54,51,51,23,21,35,34,21,20,22,22,23,30,2,21,20,6,35,34,
+38,1,150,88,87,87,88,254,226,72,87,223,218,48,134,30,203,154,82,163,124,34,
+64,76,161,94,76,89,77,116,71,88,60,96,95,236,70,246,117,46,70,61,77,96,68,
+151,126,112,229,4,49,95,95,94,115,25,252,1,17,36,171,192,83,160,251,214,40,
+112,106,75,62,51,112,97,61,87,105,58,67,89,103,17,78,36,72,65,52,64,95,118,
+66,103,127,169,0,0,2,0,110,0,10,4,184,3,224,0,49,0,60,0,0,1,20,2,4,35,34,
+38,38,53,52,55,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,23,54,51,
+51,23,34,6,21,20,22,51,50,54,55,38,38,53,52,54,51,50,22,7,52,38,35,34,6,21,
+20,22,23,54,4,184,156,254,235,170,94,182,119,84,84,100,135,106,60,113,37,
+22,41,48,78,103,48,44,84,111,13,54,120,158,98,95,137,234,77,158,171,137,110,
+128,176,111,86,66,67,87,140,98,68,2,102,158,254,234,168,90,152,77,111,72,
+32,134,90,100,124,45,43,47,20,84,71,43,91,32,44,120,97,88,78,86,122,104,72,
+200,122,106,131,216,82,86,95,86,74,92,146,49,124,0,1,0,110,255,255,4,200,
+3,226,0,40,0,0,1,34,6,21,20,22,51,50,36,54,53,52,38,35,34,6,21,20,22,23,7,
+38,38,53,52,54,51,50,22,21,20,6,4,35,34,38,53,52,54,51,51,2,11,117,161,123,
+106,160,1,32,176,92,73,75,96,109,94,12,149,197,141,113,157,206,173,254,213,
+180,217,245,196,157,6,1,206,98,77,80,74,139,238,142,112,97,82,65,72,76,20,
+77,22,155,129,98,121,248,191,151,255,150,204,128,130,161,0,1,254,128,5,17,
+1,155,7,62,0,5,0,0,9,2,55,1,1,1,155,254,131,254,98,67,1,34,1,41,6,217,254,
+56,1,237,54,254,172,1,94,0,0,1,0,130,4,104,5,45,4,250,0,5,0,0,1,21,33,39,
+53,33,5,45,251,172,87,4,84,4,124,20,126,20,0,1,0,121,0,0,4,61,5,182,0,34,
+0,0,19,53,51,50,54,55,33,53,33,38,38,35,35,53,33,21,33,22,23,51,21,35,2,5,
+19,22,22,51,51,21,35,34,38,38,39,121,170,182,153,11,253,252,2,4,9,146,160,
+201,3,196,254,160,113,12,227,229,32,254,65,235,51,101,63,27,49,133,137,85,
+47,2,178,58,124,146,96,135,117,96,96,88,164,96,254,162,17,254,111,85,79,86,
+27,75,82,0,0,1,255,213,254,240,0,43,5,6,0,3,0,0,3,51,17,35,43,86,86,5,6,249,
+234,0,0,1,255,33,254,240,0,223,5,133,0,14,0,0,3,7,39,55,39,55,23,55,23,7,
+23,7,39,17,35,43,127,53,168,168,53,170,170,53,168,168,53,127,86,4,72,127,
+55,168,166,55,170,170,55,166,168,55,127,250,168,0,0,16,0,98,0,86,4,94,4,82,
+0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,95,0,107,0,119,0,131,0,143,0,155,0,167,
+0,179,0,191,0,0,1,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,
+6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,
+34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,
+37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,
+54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,
+50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,
+21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,
+6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,2,43,32,21,22,32,32,22,21,32,
+172,32,21,22,31,31,22,21,32,1,88,32,21,22,32,32,22,21,32,254,16,32,22,21,
+32,32,21,22,32,2,136,31,22,22,31,31,22,22,31,253,24,32,21,22,32,32,22,21,
+32,3,72,31,22,22,31,31,22,22,31,252,147,32,22,21,32,32,21,22,32,3,146,31,
+22,22,31,31,22,22,31,252,147,32,21,22,32,32,22,21,32,3,72,31,22,22,31,31,
+22,22,31,253,24,32,22,21,32,32,21,22,32,2,136,31,22,22,31,31,22,22,31,254,
+16,32,21,22,31,31,22,21,32,1,88,32,21,22,32,32,22,21,32,172,32,21,22,32,32,
+22,21,32,4,29,21,32,32,21,22,32,32,15,21,32,32,21,22,31,31,22,21,32,32,21,
+22,31,31,74,21,32,32,21,22,32,32,22,21,32,32,21,22,32,32,130,22,31,31,22,
+22,31,31,22,22,31,31,22,22,31,31,150,22,31,31,22,22,31,31,22,22,31,31,22,
+22,31,31,150,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,130,22,32,32,22,
+21,32,32,21,22,32,32,22,21,32,32,75,22,31,31,22,22,31,31,22,22,31,31,22,22,
+31,31,15,22,32,32,22,21,32,32,0,255,255,0,20,255,79,5,169,5,4,2,38,0,4,0,
+0,0,7,0,100,3,239,0,197,255,255,0,20,255,79,7,140,5,4,2,38,0,5,0,0,0,7,0,
+100,3,239,0,197,255,255,255,169,254,178,3,219,4,250,2,38,0,6,0,0,0,7,0,100,
+2,221,0,40,255,255,255,169,254,178,3,219,7,23,2,38,0,7,0,0,0,7,0,100,2,221,
+0,40,255,255,255,169,254,189,4,27,4,250,2,38,0,8,0,0,0,7,0,100,4,79,0,51,
+255,255,255,169,254,189,5,181,4,250,2,38,0,9,0,0,0,7,0,100,4,79,0,51,255,
+255,255,169,255,139,6,160,4,250,2,38,0,10,0,0,0,7,0,100,3,251,1,1,255,255,
+255,169,255,92,6,175,4,250,2,38,0,11,0,0,0,7,0,100,3,251,1,1,255,255,255,
+169,254,129,5,111,4,250,2,38,0,12,0,0,0,7,0,100,3,231,255,247,255,255,255,
+169,254,129,5,167,4,250,2,38,0,13,0,0,0,7,0,100,3,231,255,247,255,255,255,
+169,254,194,4,81,4,250,2,38,0,14,0,0,0,7,0,100,3,216,0,176,255,255,255,169,
+254,194,4,81,7,28,2,38,0,15,0,0,0,7,0,100,3,216,0,176,255,255,0,20,255,79,
+7,140,7,28,2,38,0,16,0,0,0,7,0,100,3,239,0,197,255,255,0,20,255,79,7,140,
+7,44,2,38,0,17,0,0,0,7,0,100,3,239,0,197,255,255,0,20,255,79,5,242,6,227,
+2,38,0,4,0,0,0,39,0,42,5,139,0,0,0,7,0,100,3,239,0,197,255,255,255,169,254,
+194,4,81,6,227,2,38,0,14,0,0,0,39,0,42,3,29,0,0,0,7,0,100,3,216,0,176,255,
+255,0,20,255,79,7,140,6,227,2,38,0,5,0,0,0,39,0,42,6,123,0,0,0,7,0,100,3,
+239,0,197,255,255,0,20,255,79,5,169,7,18,2,38,0,21,0,0,0,7,0,100,3,239,0,
+197,255,255,255,169,254,194,4,81,7,18,2,38,0,22,0,0,0,7,0,100,3,216,0,176,
+255,255,0,20,255,79,7,140,7,18,2,38,0,23,0,0,0,7,0,100,3,239,0,197,255,255,
+255,169,255,165,5,223,4,250,2,38,0,53,0,0,0,7,0,100,3,97,1,27,255,255,255,
+169,255,116,6,24,4,250,2,38,0,54,0,0,0,7,0,100,2,231,0,234,255,255,255,169,
+255,246,4,96,4,250,2,38,0,55,0,0,0,7,0,100,3,12,1,152,255,255,255,169,255,
+136,4,145,4,250,2,38,0,56,0,0,0,7,0,100,3,116,0,254,255,255,255,169,254,173,
+4,177,4,250,2,38,0,57,0,0,0,7,0,100,4,31,0,35,255,255,255,169,255,178,4,194,
+4,250,2,38,0,58,0,0,0,7,0,100,3,60,1,40,255,255,255,169,254,169,5,39,4,250,
+2,38,0,59,0,0,0,7,0,100,4,132,0,31,255,255,255,169,255,83,5,106,4,250,2,38,
+0,60,0,0,0,7,0,100,4,27,0,201,255,255,255,169,254,178,5,187,4,250,2,38,0,
+61,0,0,0,7,0,100,2,221,0,40,255,255,255,169,255,164,5,148,4,250,2,38,0,62,
+0,0,0,7,0,100,4,34,1,26,255,255,255,169,254,216,3,229,4,250,2,38,0,63,0,0,
+0,7,0,100,4,14,0,78,255,255,255,167,254,208,4,124,4,250,2,38,0,64,0,0,0,7,
+0,100,4,47,0,70,255,255,255,169,254,173,4,86,4,250,2,38,0,65,0,0,0,7,0,100,
+4,31,0,35,255,255,255,169,254,159,4,76,4,250,2,38,0,66,0,0,0,7,0,100,4,76,
+0,21,255,255,255,169,255,220,5,192,4,250,2,38,0,67,0,0,0,7,0,100,3,205,1,
+82,255,255,255,169,254,136,4,119,4,250,2,38,0,68,0,0,0,7,0,100,3,225,255,
+254,255,255,0,82,255,204,4,225,5,0,2,38,0,69,0,0,0,7,0,100,3,24,1,66,255,
+255,255,169,255,27,3,229,4,250,2,38,0,70,0,0,0,7,0,100,3,210,0,145,255,255,
+0,68,255,122,4,179,5,18,2,38,0,71,0,0,0,7,0,100,3,148,0,240,255,255,255,169,
+255,228,4,71,4,250,2,38,0,72,0,0,0,7,0,100,3,13,1,90,255,255,255,169,255,
+246,4,100,4,250,2,38,0,73,0,0,0,7,0,100,3,7,1,140,255,255,255,169,255,246,
+5,250,4,250,2,38,0,74,0,0,0,7,0,100,3,7,1,176,255,255,255,169,255,128,4,67,
+4,250,2,38,0,75,0,0,0,7,0,100,3,95,0,246,255,255,0,82,255,237,5,108,5,14,
+2,38,0,76,0,0,0,7,0,100,3,247,1,99,255,255,255,169,255,237,4,163,4,250,2,
+38,0,77,0,0,0,7,0,100,3,15,1,99,255,255,255,169,255,204,4,166,4,250,2,38,
+0,78,0,0,0,7,0,100,3,117,1,66,255,255,255,169,255,222,3,43,4,250,2,38,0,79,
+0,0,0,7,0,100,2,168,1,84,255,255,255,169,254,147,5,81,4,250,2,38,0,80,0,0,
+0,7,0,100,4,50,0,9,255,255,255,169,255,148,4,53,4,250,2,38,0,81,0,0,0,7,0,
+100,3,86,1,10,255,255,0,64,255,219,5,61,5,12,2,38,0,82,0,0,0,7,0,100,3,37,
+1,81,255,255,255,169,255,246,4,130,4,250,2,38,0,83,0,0,0,7,0,100,3,7,1,140,
+255,255,255,169,255,223,5,101,4,250,2,38,0,84,0,0,0,7,0,100,2,162,1,85,255,
+255,255,169,254,74,3,242,4,250,2,38,0,85,0,0,0,7,0,100,3,23,255,192,255,255,
+255,169,255,149,5,183,4,250,2,38,0,86,0,0,0,7,0,100,2,199,1,11,0,1,254,107,
+4,228,0,65,7,23,0,16,0,0,1,52,54,51,50,23,7,38,35,34,6,21,20,23,39,38,38,
+254,107,122,99,156,93,41,63,77,71,84,99,84,75,74,6,60,98,121,159,35,59,88,
+76,122,142,7,96,157,0,2,255,169,2,8,2,252,4,250,0,5,0,17,0,0,3,53,33,23,21,
+33,19,55,22,51,50,55,23,6,6,35,34,38,87,2,144,77,253,112,104,56,128,193,137,
+110,46,54,100,71,108,241,4,230,20,112,20,254,78,68,104,41,161,18,14,90,0,
+1,253,160,254,71,0,130,255,197,0,5,0,0,19,37,5,39,1,1,70,254,245,254,232,
+131,1,105,1,121,254,71,223,221,111,1,13,254,188,0,0,2,255,169,255,246,5,63,
+4,250,0,35,0,49,0,0,1,7,38,38,35,34,7,17,35,39,17,6,6,35,34,38,39,38,53,52,
+54,51,50,23,17,33,39,53,33,23,21,33,17,54,51,50,1,53,38,38,35,34,6,6,21,20,
+22,51,50,54,5,63,61,33,68,44,120,177,19,124,44,122,70,88,121,61,119,182,133,
+171,139,253,61,77,4,165,77,254,173,111,120,152,253,242,59,105,65,81,121,63,
+99,84,86,161,2,189,62,38,38,191,253,234,93,1,23,45,55,58,56,111,142,125,168,
+110,1,74,112,20,112,20,254,111,97,254,252,140,38,33,69,107,57,73,90,99,0,
+2,255,169,0,25,5,125,4,250,0,34,0,58,0,0,1,6,4,35,34,36,2,53,52,54,51,50,
+22,23,54,53,52,39,33,39,53,33,23,21,33,22,21,16,5,22,22,51,50,36,55,1,50,
+22,23,7,38,35,34,6,21,20,22,51,50,55,23,6,35,34,38,38,53,52,54,5,125,100,
+254,204,204,173,254,188,221,61,47,42,63,36,114,49,254,113,77,4,114,77,253,
+138,67,254,202,63,253,200,193,1,5,95,254,131,91,186,66,37,105,120,108,139,
+96,73,140,100,90,111,152,88,169,112,169,1,28,118,141,194,1,80,125,55,64,40,
+40,61,175,100,87,112,20,112,20,140,121,255,0,159,135,165,120,99,2,69,102,
+83,43,93,103,84,73,81,110,106,125,90,159,89,114,145,0,1,255,169,1,132,2,184,
+4,250,0,21,0,0,1,33,18,17,20,35,34,38,53,52,51,50,23,54,53,52,39,35,39,53,
+33,23,2,184,254,177,50,106,81,160,98,44,43,8,13,254,77,2,194,77,4,118,254,
+212,254,244,186,178,88,92,5,64,69,129,139,112,20,112,0,1,255,169,0,231,3,
+144,4,250,0,35,0,0,1,6,6,35,34,38,53,52,55,38,53,52,55,35,39,53,33,23,21,
+33,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,3,144,67,200,125,161,227,
+158,207,14,107,77,3,42,77,253,248,30,125,68,76,103,158,187,83,84,106,203,
+69,1,224,102,147,239,105,142,77,90,177,40,41,112,20,112,20,46,53,124,91,19,
+8,142,11,117,87,59,67,128,101,0,255,255,255,169,253,231,4,177,4,250,2,38,
+0,57,0,0,0,7,0,99,3,52,255,240,0,2,255,169,0,245,3,197,4,250,0,5,0,32,0,0,
+1,33,39,53,33,23,19,6,6,35,34,46,2,53,52,55,35,39,53,33,23,21,35,34,6,21,
+20,22,51,50,54,55,3,68,252,178,77,3,78,77,129,59,181,112,81,117,132,58,86,
+185,86,2,94,86,77,127,175,102,83,93,169,63,4,118,112,20,112,253,92,103,138,
+50,117,118,66,112,63,112,21,114,23,137,95,70,89,110,93,0,0,3,255,169,0,10,
+5,39,4,250,0,5,0,55,0,66,0,0,1,21,33,39,53,33,3,20,2,4,35,34,38,38,53,52,
+55,38,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,22,23,54,51,51,23,34,6,21,
+20,22,51,50,54,55,38,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,23,54,
+5,39,250,207,77,5,49,66,156,254,235,170,94,182,119,84,84,100,135,106,60,113,
+37,22,41,48,78,103,48,44,84,111,13,54,120,158,98,95,137,234,77,158,171,137,
+110,128,176,111,86,66,67,87,140,98,68,4,138,20,112,20,253,108,158,254,234,
+168,90,152,77,111,72,32,134,90,100,124,45,43,47,20,84,71,43,91,32,44,120,
+97,88,78,86,122,104,72,200,122,106,131,216,82,86,95,86,74,92,146,49,124,0,
+0,2,255,169,0,180,4,216,4,250,0,5,0,29,0,0,3,53,33,23,21,33,19,55,18,22,51,
+50,53,52,38,39,55,33,23,21,33,34,39,22,21,20,6,35,34,0,87,3,219,77,252,37,
+57,87,83,189,97,144,105,81,35,2,155,77,254,4,81,23,166,125,109,166,254,251,
+4,230,20,112,20,254,180,28,254,252,248,148,98,190,62,72,112,19,4,168,179,
+116,130,1,71,0,0,1,255,169,254,215,4,126,4,250,0,66,0,0,1,34,39,22,21,20,
+6,7,22,23,7,38,38,39,38,38,53,52,54,51,50,23,50,54,53,52,38,35,34,7,38,38,
+53,52,54,51,50,23,53,33,39,53,33,23,21,33,17,38,35,34,6,21,20,23,54,54,51,
+50,22,23,22,22,51,50,55,23,6,3,204,91,83,57,222,175,124,193,99,73,175,71,
+110,128,54,45,86,78,159,202,78,58,115,151,108,134,151,140,67,110,253,191,
+77,4,32,77,254,178,103,54,173,160,70,65,134,52,45,65,42,47,76,56,136,90,50,
+78,1,193,41,81,87,133,170,2,112,84,118,49,176,89,5,79,61,40,45,98,124,95,
+61,63,95,65,189,89,104,115,11,194,112,20,112,20,254,208,9,96,79,73,47,40,
+39,16,16,17,18,71,129,57,0,2,255,169,1,6,4,150,4,250,0,5,0,38,0,0,1,33,39,
+53,33,23,3,39,6,6,35,34,36,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,54,
+51,50,22,22,23,54,54,55,23,6,4,26,251,220,77,4,36,77,120,56,15,180,140,162,
+255,0,81,83,66,175,120,120,140,70,72,49,93,60,73,124,96,83,129,103,12,73,
+138,43,46,101,4,118,112,20,112,253,125,3,125,135,242,219,40,178,187,134,114,
+73,65,29,31,154,56,85,161,72,7,69,54,168,59,255,255,255,169,254,40,3,229,
+4,250,2,38,0,63,0,0,0,7,0,99,2,238,0,49,255,255,255,167,254,32,4,124,4,250,
+2,38,0,64,0,0,0,7,0,99,3,30,0,41,255,255,255,169,253,251,4,86,4,250,2,38,
+0,65,0,0,0,7,0,99,3,22,0,4,255,255,255,169,253,237,4,76,4,250,2,38,0,66,0,
+0,0,7,0,99,3,14,255,246,0,2,255,169,1,62,3,249,4,250,0,15,0,23,0,0,1,35,17,
+20,6,35,34,38,38,53,17,35,39,53,33,23,5,33,17,20,22,51,50,53,3,249,231,138,
+134,75,162,120,167,77,4,3,77,254,133,254,178,80,85,169,4,118,254,28,169,171,
+102,165,99,1,202,112,20,112,20,254,19,108,101,242,0,2,255,169,255,231,3,131,
+4,250,0,5,0,23,0,0,3,53,33,23,21,33,19,52,54,51,50,23,21,38,35,34,6,21,20,
+22,23,7,38,2,87,2,214,77,253,42,105,217,173,159,255,174,206,128,146,157,122,
+59,150,220,4,230,20,112,20,253,174,150,186,51,121,33,137,118,117,233,99,66,
+118,1,35,0,0,3,0,82,0,245,3,200,5,0,0,29,0,35,0,46,0,0,1,6,6,35,34,38,39,
+54,54,55,38,53,52,54,51,50,22,22,21,20,6,7,6,21,20,22,51,50,54,55,3,39,53,
+51,23,21,1,54,53,52,38,35,34,6,21,20,22,3,200,55,215,119,175,244,78,165,97,
+40,255,117,89,97,163,76,173,209,22,145,96,112,191,67,115,77,84,77,254,120,
+87,79,61,51,71,96,1,228,106,133,223,182,59,42,23,130,170,90,116,116,138,83,
+122,180,83,9,24,54,89,112,106,2,30,112,20,112,20,254,194,76,105,68,84,63,
+60,68,101,0,255,255,255,169,253,140,4,106,4,250,2,38,0,70,0,0,0,7,0,99,3,
+119,255,149,0,3,0,68,0,217,3,176,5,18,0,37,0,43,0,55,0,0,1,6,6,35,34,38,53,
+52,55,46,2,53,52,54,51,50,22,21,20,6,35,34,39,22,23,54,55,23,6,6,21,20,22,
+51,50,54,55,3,39,53,51,23,21,5,20,23,22,51,50,54,53,52,35,34,6,3,176,67,200,
+125,161,227,130,131,63,32,126,103,95,171,102,77,62,50,27,93,76,96,102,163,
+194,83,84,106,203,69,111,77,68,77,253,168,19,17,20,83,108,89,66,92,1,210,
+102,147,239,105,124,72,108,78,81,51,100,123,172,99,81,90,18,23,55,22,6,138,
+7,104,91,59,67,128,101,2,43,112,20,112,20,132,52,35,5,89,79,95,100,0,0,2,
+255,169,1,130,3,16,4,250,0,5,0,23,0,0,3,53,33,23,21,33,19,52,54,51,50,4,23,
+21,38,35,7,22,21,20,6,35,34,38,87,2,184,77,253,72,54,83,86,145,1,91,79,216,
+143,70,10,43,46,84,148,4,230,20,112,20,253,250,59,73,36,18,108,12,1,54,66,
+43,56,154,0,1,255,169,1,72,3,74,4,250,0,23,0,0,1,6,6,35,34,46,2,53,17,35,
+39,53,33,23,21,33,17,20,22,51,50,54,55,3,74,54,166,87,68,128,134,45,170,77,
+2,222,77,254,95,85,67,75,162,63,1,243,70,101,60,133,125,147,1,93,112,20,112,
+20,254,14,103,78,85,75,0,2,255,169,255,246,5,70,4,250,0,29,0,38,0,0,1,7,38,
+35,34,6,7,17,35,39,17,6,35,34,46,2,53,17,35,39,53,33,23,21,33,17,54,51,50,
+5,17,33,17,20,22,51,50,54,5,70,61,65,69,71,151,76,19,124,89,90,68,128,134,
+45,170,77,4,182,77,254,173,107,114,152,253,252,254,105,85,67,63,134,2,182,
+62,75,104,79,253,234,93,1,83,58,60,133,125,147,1,57,112,20,112,20,254,112,
+89,216,2,15,254,50,103,78,61,0,0,3,255,169,0,225,3,87,4,250,0,5,0,30,0,39,
+0,0,1,33,39,53,33,23,19,6,6,35,34,38,39,38,53,52,54,54,51,50,22,23,7,38,38,
+35,34,7,19,54,55,7,3,6,6,21,20,22,51,50,2,223,253,23,77,2,233,77,120,59,182,
+113,100,137,67,125,93,151,85,131,187,84,39,75,132,77,53,45,250,65,54,204,
+252,45,49,125,100,59,4,118,112,20,112,253,71,102,138,63,63,119,151,90,137,
+74,108,87,47,59,53,14,254,163,51,79,182,1,100,35,97,50,90,110,0,3,0,82,1,
+79,4,22,5,14,0,28,0,34,0,43,0,0,1,21,38,35,35,21,20,35,34,38,53,52,54,55,
+53,46,2,53,52,54,51,50,22,22,21,17,22,22,3,39,53,51,23,21,1,53,52,35,34,6,
+21,20,22,4,22,212,181,38,82,74,134,78,69,101,179,110,125,98,88,142,80,139,
+255,175,77,148,77,254,2,91,60,78,123,2,109,112,9,93,90,147,83,57,42,3,89,
+8,87,146,90,89,118,94,156,88,254,220,6,29,2,1,112,20,112,20,254,207,233,102,
+68,57,77,112,0,1,255,169,1,79,3,46,4,250,0,24,0,0,1,21,38,35,35,21,20,35,
+34,38,53,52,54,55,17,35,39,53,33,23,21,33,17,22,22,3,46,211,183,38,82,74,
+134,78,68,248,77,3,24,77,254,112,138,255,2,109,112,9,93,90,147,83,57,42,3,
+1,219,112,20,112,20,254,34,6,29,0,0,1,255,169,1,45,3,123,4,250,0,31,0,0,1,
+6,6,35,34,38,39,54,54,53,52,39,33,39,53,33,23,21,33,22,21,20,6,6,7,6,21,20,
+22,51,50,55,3,123,63,180,95,175,244,78,134,146,71,254,237,77,3,17,77,254,
+109,108,46,86,78,25,143,94,187,133,1,207,75,87,223,182,44,141,81,86,84,112,
+20,112,20,133,107,61,91,77,55,18,26,52,84,151,255,255,255,169,253,247,3,125,
+4,250,2,38,0,79,0,0,0,7,0,99,2,138,0,0,0,2,255,169,255,242,4,124,4,250,0,
+5,0,40,0,0,1,33,39,53,33,23,19,7,38,35,34,6,21,23,39,38,53,52,55,38,35,34,
+6,21,20,18,23,7,38,38,2,53,52,54,51,50,23,54,54,51,50,3,231,252,15,77,3,241,
+77,149,37,71,72,116,137,5,161,6,47,62,68,93,118,184,164,61,93,207,149,158,
+125,145,125,50,136,75,137,4,118,112,20,112,254,212,72,25,158,130,97,45,50,
+46,104,81,39,119,97,148,254,255,119,69,65,211,1,8,131,128,157,121,51,55,0,
+2,255,169,0,245,3,56,4,250,0,5,0,34,0,0,3,53,33,23,21,33,19,52,54,51,50,22,
+23,7,38,38,35,34,6,6,21,20,22,51,50,54,55,23,6,6,35,34,46,2,87,2,200,77,253,
+56,82,182,133,131,187,84,39,75,130,77,81,121,63,106,88,93,169,63,102,59,181,
+112,82,118,132,68,4,230,20,112,20,253,255,125,168,108,87,47,58,51,69,107,
+57,79,101,110,93,93,103,138,51,118,139,0,0,3,0,64,255,247,3,107,5,12,0,29,
+0,35,0,45,0,0,37,7,39,38,39,6,35,34,38,53,52,54,51,50,22,23,54,55,38,38,53,
+52,54,51,50,22,21,16,5,0,19,21,35,39,53,51,1,54,53,52,38,35,34,6,21,20,3,
+0,128,170,92,51,40,56,67,100,73,53,37,65,52,83,64,181,192,126,101,142,215,
+254,228,1,25,176,51,77,51,254,241,42,81,64,70,91,66,75,217,122,60,11,85,60,
+54,61,32,43,30,102,64,193,119,99,121,245,148,254,194,158,254,221,4,6,20,112,
+20,254,5,100,105,101,99,91,69,141,0,2,255,169,1,72,3,100,4,250,0,16,0,25,
+0,0,1,6,6,35,34,46,2,53,17,35,39,53,33,23,21,33,1,1,39,17,20,22,51,50,54,
+3,100,57,181,95,68,128,134,45,170,77,3,21,77,254,40,1,144,254,229,117,85,
+67,60,130,2,21,85,120,60,133,125,147,1,93,112,20,112,20,253,196,1,51,138,
+254,141,103,78,56,0,1,255,169,255,236,4,12,4,250,0,39,0,0,1,22,5,7,38,0,53,
+52,54,51,50,22,23,54,54,53,52,39,33,39,53,33,23,21,33,22,21,20,7,22,51,50,
+55,23,6,35,34,38,39,6,1,15,122,1,30,114,192,254,225,58,47,45,60,40,70,74,
+46,254,68,77,3,192,77,254,105,64,55,98,108,119,101,58,88,110,96,181,67,85,
+1,203,180,182,117,163,1,157,116,55,65,38,42,32,130,74,111,83,112,20,112,20,
+134,134,97,89,48,52,140,38,55,43,91,0,0,1,255,169,255,34,4,41,4,250,0,40,
+0,0,37,20,22,23,7,38,2,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,
+35,17,38,35,34,6,21,20,23,54,51,33,23,21,33,34,6,1,22,170,196,49,218,245,
+100,117,172,139,99,115,253,118,77,3,175,77,148,102,127,163,141,53,105,144,
+1,177,78,254,25,136,164,228,110,199,66,75,76,1,13,171,138,92,96,114,114,111,
+12,195,112,20,112,20,254,207,10,90,75,61,45,57,114,22,146,0,0,4,255,169,0,
+133,5,183,4,250,0,5,0,30,0,44,0,58,0,0,1,21,33,39,53,33,3,20,6,35,34,38,39,
+6,6,35,34,38,38,53,52,54,51,50,22,23,54,54,51,50,22,7,52,38,35,34,6,6,7,7,
+22,22,51,50,54,37,38,38,35,34,6,21,20,22,51,50,54,54,55,5,183,250,63,77,5,
+193,62,188,137,86,157,62,46,121,86,99,170,99,187,137,86,157,62,46,120,87,
+142,227,145,87,68,62,89,58,39,47,50,103,61,100,136,254,0,50,103,61,100,136,
+87,68,62,89,58,39,4,138,20,112,20,252,236,148,205,84,85,80,89,116,171,115,
+148,205,85,84,80,89,237,77,104,100,77,116,98,114,60,55,184,206,60,55,184,
+132,104,100,77,116,98,0,0,3,0,131,254,242,4,144,4,250,0,56,0,62,0,73,0,0,
+5,7,38,39,6,35,34,39,38,38,53,52,54,54,55,38,53,52,54,51,50,22,22,21,20,6,
+7,22,51,50,55,23,6,35,34,39,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,
+20,6,7,22,19,39,53,51,23,21,1,54,54,53,52,38,35,34,6,21,20,3,199,162,106,
+66,45,40,152,126,75,64,69,104,80,191,129,105,87,160,95,71,65,79,79,181,137,
+59,109,163,193,168,84,98,69,94,76,73,42,14,62,48,68,105,55,62,77,138,77,90,
+77,253,201,79,84,66,57,61,80,203,67,157,163,9,125,73,114,63,73,115,85,52,
+144,160,103,126,122,154,81,58,97,49,17,72,144,61,84,55,79,104,63,76,95,24,
+36,44,46,64,105,70,41,78,24,122,4,169,112,20,112,20,254,160,52,100,63,55,
+76,82,63,123,0,2,255,169,255,125,4,26,4,250,0,5,0,36,0,0,1,33,39,53,33,23,
+19,33,22,21,20,6,7,22,23,7,38,39,38,38,53,52,54,51,50,23,50,54,53,52,38,39,
+35,39,53,33,23,3,60,252,186,77,3,70,77,222,253,189,141,150,122,111,148,108,
+144,103,79,113,62,39,88,54,86,92,65,56,158,77,3,88,77,4,118,112,20,112,254,
+80,123,147,104,139,11,142,77,118,128,216,18,101,62,47,52,127,91,70,62,106,
+35,112,20,112,255,255,255,169,255,165,5,63,4,250,2,38,1,6,0,0,0,7,0,100,3,
+80,1,27,255,255,255,169,255,116,5,125,4,250,2,38,1,7,0,0,0,7,0,100,2,231,
+0,234,255,255,255,169,0,34,2,184,4,250,2,38,1,8,0,0,0,7,0,100,3,12,1,152,
+255,255,255,169,255,136,3,144,4,250,2,38,1,9,0,0,0,7,0,100,3,116,0,254,255,
+255,255,169,253,231,4,177,4,250,2,38,0,57,0,0,0,39,0,100,3,26,0,22,0,7,0,
+99,3,52,255,240,255,255,255,169,255,178,3,197,4,250,2,38,1,11,0,0,0,7,0,100,
+3,60,1,40,255,255,255,169,254,169,5,39,4,250,2,38,1,12,0,0,0,7,0,100,4,132,
+0,31,255,255,255,169,255,83,4,216,4,250,2,38,1,13,0,0,0,7,0,100,4,27,0,201,
+255,255,255,169,254,178,4,126,4,250,2,38,1,14,0,0,0,7,0,100,2,221,0,40,255,
+255,255,169,255,164,4,150,4,250,2,38,1,15,0,0,0,7,0,100,4,34,1,26,255,255,
+255,169,254,40,3,229,4,250,2,38,0,63,0,0,0,39,0,100,2,212,0,87,0,7,0,99,2,
+238,0,49,255,255,255,167,254,32,4,124,4,250,2,38,0,64,0,0,0,39,0,100,3,4,
+0,79,0,7,0,99,3,30,0,41,255,255,255,169,253,251,4,86,4,250,2,38,0,65,0,0,
+0,39,0,100,2,252,0,42,0,7,0,99,3,22,0,4,255,255,255,169,253,237,4,76,4,250,
+2,38,0,66,0,0,0,39,0,100,2,244,0,28,0,7,0,99,3,14,255,246,255,255,255,169,
+255,220,3,249,4,250,2,38,1,20,0,0,0,7,0,100,3,205,1,82,255,255,255,169,254,
+136,3,131,4,250,2,38,1,21,0,0,0,7,0,100,3,225,255,254,255,255,0,82,255,204,
+3,200,5,0,2,38,1,22,0,0,0,7,0,100,3,24,1,66,255,255,255,169,253,140,4,106,
+4,250,2,38,0,70,0,0,0,39,0,100,3,120,0,205,0,7,0,99,3,119,255,149,255,255,
+0,68,255,122,3,176,5,18,2,38,1,24,0,0,0,7,0,100,3,148,0,240,255,255,255,169,
+255,228,3,16,4,250,2,38,1,25,0,0,0,7,0,100,3,13,1,90,255,255,255,169,0,22,
+3,74,4,250,2,38,1,26,0,0,0,7,0,100,3,7,1,140,255,255,255,169,255,246,5,70,
+4,250,2,38,1,27,0,0,0,7,0,100,3,7,1,176,255,255,255,169,255,128,3,87,4,250,
+2,38,1,28,0,0,0,7,0,100,3,95,0,246,255,255,0,82,255,237,4,22,5,14,2,38,1,
+29,0,0,0,7,0,100,3,247,1,99,255,255,255,169,255,237,3,46,4,250,2,38,1,30,
+0,0,0,7,0,100,3,15,1,99,255,255,255,169,255,204,3,123,4,250,2,38,1,31,0,0,
+0,7,0,100,3,117,1,66,255,255,255,169,253,247,3,125,4,250,2,38,0,79,0,0,0,
+39,0,100,2,168,1,84,0,7,0,99,2,138,0,0,255,255,255,169,254,147,4,124,4,250,
+2,38,1,33,0,0,0,7,0,100,4,50,0,9,255,255,255,169,255,148,3,56,4,250,2,38,
+1,34,0,0,0,7,0,100,3,81,1,10,255,255,0,64,255,219,3,107,5,12,2,38,1,35,0,
+0,0,7,0,100,3,37,1,81,255,255,255,169,0,22,3,100,4,250,2,38,1,36,0,0,0,7,
+0,100,3,7,1,140,255,255,255,169,255,223,4,12,4,250,2,38,1,37,0,0,0,7,0,100,
+2,162,1,85,255,255,255,169,254,74,4,41,4,250,2,38,1,38,0,0,0,7,0,100,3,23,
+255,192,255,255,255,169,255,149,5,183,4,250,2,38,1,39,0,0,0,7,0,100,2,199,
+1,11,0,2,255,169,255,229,5,223,4,250,0,41,0,55,0,0,1,17,54,51,50,22,21,20,
+6,7,39,54,54,53,52,38,35,34,6,7,17,35,39,17,1,39,55,38,38,53,52,54,51,50,
+23,17,33,39,53,33,23,21,1,53,38,38,35,34,6,6,21,20,22,51,50,54,3,72,105,106,
+128,185,80,59,136,66,87,62,52,69,145,74,19,120,254,69,116,249,132,187,182,
+133,171,139,253,61,77,5,233,77,252,218,59,105,65,81,121,63,99,84,86,161,4,
+118,254,111,90,191,154,80,179,68,98,82,158,82,58,70,104,80,253,235,90,1,32,
+254,117,100,211,16,203,126,125,168,110,1,74,112,20,112,20,253,204,140,38,
+33,69,107,57,73,90,99,0,3,255,169,255,4,6,24,4,250,0,27,0,51,0,63,0,0,1,35,
+17,35,39,53,1,39,37,38,36,2,53,52,54,51,50,22,23,54,53,52,39,33,39,53,33,
+23,5,33,22,21,16,5,18,33,50,54,55,53,6,35,34,38,38,53,52,54,51,50,22,23,21,
+38,35,34,6,21,20,22,51,50,54,55,6,24,237,19,120,252,89,76,1,213,136,254,254,
+173,61,47,42,63,36,114,49,254,113,77,6,34,77,254,132,253,86,67,254,202,140,
+1,110,136,201,82,72,99,88,169,112,169,130,62,126,53,76,84,108,139,96,73,62,
+130,46,4,118,251,128,90,49,254,131,133,179,20,195,1,44,105,55,64,40,40,61,
+175,100,87,112,20,112,20,140,121,255,0,159,254,212,68,54,137,56,90,159,89,
+114,145,48,41,79,33,103,84,73,81,62,49,0,1,255,169,255,246,4,96,4,250,0,30,
+0,0,1,35,17,35,39,17,1,39,1,17,33,18,21,20,35,34,38,53,52,51,50,23,54,53,
+52,39,35,39,53,33,23,4,96,237,19,120,254,30,116,2,82,254,132,51,106,81,160,
+98,49,43,3,13,254,77,4,106,77,4,118,251,128,90,1,81,254,86,100,1,248,2,35,
+254,217,194,186,178,88,92,5,31,72,102,117,112,20,112,0,2,255,169,255,149,
+4,145,4,250,0,23,0,41,0,0,1,35,17,35,39,17,1,39,1,46,2,53,52,55,38,53,52,
+55,35,39,53,33,23,5,33,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,4,145,
+237,19,120,253,254,116,1,54,94,133,114,158,207,14,107,77,4,155,77,254,132,
+254,3,30,125,68,76,103,158,187,83,84,95,183,67,4,118,251,128,90,1,15,254,
+54,100,1,7,1,79,167,72,142,77,90,177,40,41,112,20,112,20,46,53,124,91,19,
+8,142,11,117,87,59,67,103,82,255,255,255,169,254,84,4,177,4,250,2,38,0,57,
+0,0,0,7,1,5,3,59,0,13,0,1,255,169,255,229,4,194,4,250,0,35,0,0,1,35,17,35,
+39,17,1,39,55,38,38,53,52,55,35,39,53,33,23,21,35,34,6,21,20,22,51,50,54,
+55,17,33,39,53,33,23,4,194,237,19,120,254,95,116,229,119,194,86,185,86,2,
+94,86,77,127,175,102,83,82,155,63,252,176,77,4,204,77,4,118,251,128,90,1,
+9,254,140,100,194,13,197,119,112,63,112,21,114,23,137,95,70,89,91,80,2,83,
+112,20,112,255,255,255,169,254,80,5,39,4,250,2,38,0,59,0,0,0,7,1,5,3,96,0,
+9,0,1,255,169,255,169,5,106,4,250,0,38,0,0,1,35,17,35,39,53,1,39,1,17,33,
+34,39,22,21,20,6,35,34,2,39,55,22,22,51,50,54,53,52,38,39,55,33,53,33,39,
+53,33,23,5,106,237,19,120,254,44,116,2,68,254,238,81,23,98,128,107,143,226,
+75,87,69,158,83,60,74,66,51,35,1,254,252,8,77,5,116,77,4,118,251,128,90,247,
+254,98,100,1,236,1,8,4,110,138,102,121,1,7,245,28,203,183,73,64,67,131,41,
+72,242,112,20,112,0,2,255,169,254,215,6,11,4,250,0,54,0,76,0,0,1,35,17,35,
+39,53,7,39,1,53,6,35,34,39,22,21,20,6,7,22,23,7,38,38,39,38,38,53,52,54,51,
+50,23,50,54,53,52,38,35,34,7,38,38,53,52,54,51,50,23,53,33,39,53,33,23,5,
+33,17,38,35,34,6,21,20,23,54,54,51,50,22,23,22,22,51,50,54,55,6,11,237,19,
+116,255,111,1,106,90,109,91,83,57,222,175,124,193,99,73,175,71,110,128,54,
+45,86,78,159,202,78,58,115,151,108,134,151,140,67,110,253,191,77,6,21,77,
+254,132,254,57,103,54,173,160,70,65,134,52,45,65,42,47,76,56,87,157,49,4,
+118,251,128,87,94,226,96,1,51,168,67,41,81,87,133,170,2,112,84,118,49,176,
+89,5,79,61,40,45,98,124,95,61,63,95,65,189,89,104,115,11,194,112,20,112,20,
+254,208,9,96,79,73,47,40,39,16,16,17,18,66,57,0,0,1,255,169,255,203,5,148,
+4,250,0,48,0,0,1,35,17,35,39,53,1,39,1,53,6,35,34,39,6,6,35,34,36,39,55,22,
+22,51,50,54,53,52,38,35,34,6,7,39,54,51,50,22,22,23,54,54,55,17,33,39,53,
+33,23,5,148,237,19,120,254,83,116,2,33,58,70,28,20,8,169,126,173,254,238,
+86,83,73,191,131,99,128,76,67,49,93,60,73,120,87,85,132,100,17,45,98,37,251,
+222,77,5,158,77,4,118,251,128,90,247,254,132,100,1,205,86,15,4,100,128,209,
+189,40,146,154,104,80,57,80,29,31,154,55,79,142,66,5,37,29,1,139,112,20,112,
+0,255,255,255,169,254,129,3,229,4,250,2,38,0,63,0,0,0,7,1,5,2,232,0,58,255,
+255,255,167,254,120,4,124,4,250,2,38,0,64,0,0,0,7,1,5,3,39,0,49,255,255,255,
+169,254,84,4,86,4,250,2,38,0,65,0,0,0,7,1,5,3,14,0,13,255,255,255,169,254,
+70,4,76,4,250,2,38,0,66,0,0,0,7,1,5,3,34,255,255,0,2,255,169,255,169,5,192,
+4,250,0,24,0,32,0,0,1,35,17,35,39,53,1,39,1,17,33,17,20,6,35,34,38,38,53,
+17,35,39,53,33,23,5,33,17,20,22,51,50,53,5,192,237,19,120,254,44,116,2,68,
+254,206,138,134,75,162,120,167,77,5,202,77,252,190,254,178,80,85,169,4,118,
+251,128,90,247,254,98,100,1,236,2,125,254,108,169,171,102,165,99,1,122,112,
+20,112,20,254,99,108,101,242,0,0,1,255,169,255,246,4,199,4,250,0,26,0,0,1,
+35,17,35,39,17,1,39,1,38,38,35,34,7,39,54,51,50,22,23,55,17,33,39,53,33,23,
+4,199,237,19,120,253,234,106,2,25,91,137,70,100,123,107,123,124,130,223,98,
+29,252,171,77,4,209,77,4,118,251,128,90,1,135,254,172,112,1,73,110,83,89,
+139,102,170,132,18,1,253,112,20,112,0,2,0,82,255,170,4,225,5,0,0,40,0,51,
+0,0,1,35,17,35,39,17,1,39,37,38,38,39,54,54,55,38,53,52,54,51,50,22,22,21,
+20,6,7,6,21,20,22,51,50,54,55,17,35,39,53,33,23,1,54,53,52,38,35,34,6,21,
+20,22,4,225,237,19,120,253,248,116,1,37,160,218,70,165,97,40,255,117,89,97,
+163,76,173,209,22,145,96,106,191,64,106,77,1,230,77,252,230,87,79,61,51,71,
+96,4,118,251,128,90,1,38,254,52,100,248,7,216,165,59,42,23,130,170,90,116,
+116,138,83,122,180,83,9,24,54,89,110,94,2,44,112,20,112,254,174,76,105,68,
+84,63,60,68,101,0,0,1,255,169,255,67,3,229,4,250,0,44,0,0,19,20,22,51,50,
+55,38,53,52,54,51,50,22,21,20,6,7,22,23,7,38,39,1,39,37,38,38,53,52,54,51,
+50,23,17,33,39,53,33,23,21,33,17,39,34,6,209,130,102,93,47,14,62,48,68,105,
+55,62,77,169,162,106,66,254,138,116,1,27,153,212,227,185,54,58,253,161,77,
+3,239,77,254,255,96,204,231,1,238,100,130,29,36,44,46,64,105,70,41,78,24,
+122,152,67,157,163,254,179,100,240,23,242,141,144,180,6,1,11,112,20,112,20,
+254,145,2,151,0,0,2,0,68,255,135,4,179,5,18,0,48,0,60,0,0,1,35,17,35,39,53,
+1,39,1,38,38,53,52,55,46,2,53,52,54,51,50,22,21,20,6,35,34,39,22,23,54,55,
+23,6,6,21,20,22,51,50,54,55,17,35,39,53,33,23,5,20,23,22,51,50,54,53,52,35,
+34,6,4,179,237,19,124,254,0,116,1,52,140,199,130,131,63,32,126,103,95,171,
+102,77,62,50,27,93,76,96,102,163,194,83,84,95,185,67,80,77,1,204,77,252,32,
+19,17,20,83,108,89,66,92,4,118,251,128,93,252,254,56,100,1,5,2,220,99,124,
+72,108,78,81,51,100,123,172,99,81,90,18,23,55,22,6,138,7,104,91,59,67,105,
+83,2,84,112,20,112,152,52,35,5,89,79,95,100,0,0,1,255,169,255,222,4,71,4,
+250,0,32,0,0,1,35,17,35,39,17,1,39,1,53,38,35,7,22,21,20,6,35,34,38,53,52,
+54,51,50,4,23,17,33,39,53,33,23,4,71,237,19,120,254,44,116,2,68,180,110,70,
+10,43,46,84,148,83,86,139,1,43,64,253,43,77,4,81,77,4,118,251,128,90,1,44,
+254,98,100,1,236,109,9,1,54,66,43,56,154,84,59,73,30,12,1,102,112,20,112,
+0,0,2,255,169,255,226,4,100,4,250,0,19,0,28,0,0,1,35,17,35,39,17,1,39,1,46,
+3,53,17,35,39,53,33,23,5,33,17,20,22,51,50,54,55,4,100,237,19,120,254,9,116,
+1,79,59,99,107,39,170,77,4,110,77,254,132,254,75,85,67,71,153,61,4,118,251,
+128,90,1,79,254,67,100,1,28,9,54,116,119,141,1,93,112,20,112,20,254,14,103,
+78,78,69,0,2,255,169,255,246,5,250,4,250,0,38,0,47,0,0,1,17,54,51,50,22,21,
+20,6,7,39,54,54,53,52,38,35,34,6,7,17,35,39,17,1,39,1,46,3,53,17,35,39,53,
+33,23,21,33,33,17,20,22,51,50,54,55,3,89,107,114,128,185,80,59,136,66,87,
+62,52,71,151,76,19,120,254,39,116,1,79,59,99,107,39,170,77,6,4,77,252,208,
+254,105,85,67,63,134,58,4,118,254,112,89,191,154,80,179,68,98,82,158,82,58,
+70,104,79,253,234,90,1,89,254,93,100,1,28,9,54,116,119,141,1,57,112,20,112,
+20,254,50,103,78,61,55,0,3,255,169,255,187,4,67,4,250,0,24,0,33,0,42,0,0,
+1,35,17,35,39,53,1,39,55,46,2,53,52,54,54,51,50,23,17,33,39,53,33,23,1,53,
+38,38,35,34,7,19,54,7,50,55,3,6,6,21,20,22,4,67,237,19,124,254,99,116,253,
+84,169,110,93,151,85,170,140,253,47,77,4,77,77,254,132,60,108,63,53,45,250,
+46,252,61,60,252,45,49,125,4,118,251,128,93,216,254,144,100,214,5,99,172,
+100,90,137,74,110,1,74,112,20,112,253,110,215,38,35,14,254,162,36,113,26,
+1,100,35,97,50,90,110,0,2,0,82,255,162,5,108,5,14,0,42,0,51,0,0,1,35,17,35,
+39,53,1,39,1,53,38,35,35,21,20,35,34,38,53,52,54,55,53,46,2,53,52,54,51,50,
+22,22,21,17,22,23,17,35,39,53,33,23,1,53,52,35,34,6,21,20,22,5,108,237,19,
+120,254,44,116,2,72,187,172,38,82,74,134,78,69,101,179,110,125,98,88,142,
+80,223,170,174,77,2,42,77,252,108,91,60,78,123,4,118,251,128,90,240,254,98,
+100,1,239,29,8,93,90,147,83,57,42,3,69,8,87,146,90,89,118,94,156,88,254,240,
+10,27,1,239,112,20,112,254,187,233,102,68,57,77,112,0,0,2,255,169,255,162,
+4,163,4,250,0,27,0,33,0,0,1,35,17,35,39,53,1,39,1,53,36,35,35,21,20,35,34,
+38,53,52,54,55,17,35,39,53,33,23,5,33,17,22,22,23,4,163,237,19,120,254,44,
+116,2,72,254,255,134,38,82,74,134,78,68,248,77,4,173,77,254,132,254,87,132,
+241,52,4,118,251,128,90,240,254,98,100,1,239,28,9,93,90,147,83,57,42,3,1,
+199,112,20,112,20,254,54,5,27,10,0,2,255,169,255,226,4,166,4,250,0,21,0,37,
+0,0,1,35,17,35,39,17,1,39,37,38,38,39,54,54,53,52,39,33,39,53,33,23,5,33,
+22,21,20,6,6,7,6,21,20,22,51,50,54,55,4,166,237,19,125,254,30,116,1,38,157,
+219,73,134,146,71,254,237,77,4,176,77,254,131,254,75,108,46,86,78,25,143,
+94,92,171,64,4,118,251,128,93,1,58,254,85,100,249,7,211,169,44,141,81,86,
+84,112,20,112,20,133,107,61,91,77,55,18,26,52,84,84,75,0,255,255,255,169,
+254,91,3,62,4,250,2,38,0,79,0,0,0,7,1,5,2,188,0,20,0,1,255,169,255,193,5,
+81,4,250,0,46,0,0,1,35,17,35,39,53,1,39,1,17,39,34,6,21,23,39,38,53,52,55,
+38,35,34,6,21,20,23,7,38,2,53,52,54,51,50,23,54,54,51,50,23,53,33,39,53,33,
+23,5,81,217,19,120,254,88,116,2,24,24,120,142,5,161,6,47,62,68,93,118,165,
+68,113,146,158,125,145,125,50,136,75,50,40,252,13,77,5,91,77,4,118,251,128,
+90,231,254,138,100,1,195,1,73,1,160,131,97,45,50,46,104,81,39,119,97,191,
+176,62,116,1,6,129,128,157,121,51,55,7,222,112,20,112,0,0,2,255,169,255,212,
+4,53,4,250,0,22,0,36,0,0,1,35,17,35,39,53,1,39,55,38,38,53,52,54,51,50,23,
+17,33,39,53,33,23,1,53,38,38,35,34,6,6,21,20,22,51,50,54,4,53,237,19,124,
+254,84,116,249,138,192,182,133,171,139,253,61,77,4,63,77,254,132,59,105,65,
+81,121,63,106,88,82,155,4,118,251,128,93,255,254,130,100,211,19,213,130,125,
+168,110,1,74,112,20,112,253,153,171,38,33,69,107,57,79,101,91,0,2,0,109,255,
+246,5,82,4,250,0,35,0,45,0,0,1,35,17,35,39,17,1,39,1,38,39,6,7,39,54,55,38,
+53,52,54,51,50,22,22,21,20,7,22,23,55,17,35,39,53,33,23,1,54,53,52,38,35,
+34,6,21,20,5,82,237,19,120,254,23,116,1,107,126,117,110,161,121,166,102,223,
+128,97,86,169,95,155,109,137,162,151,77,2,19,77,252,116,135,79,59,59,79,4,
+118,251,128,90,1,158,254,81,100,1,50,59,74,90,92,105,88,78,181,179,95,126,
+106,141,89,121,150,70,62,136,1,217,112,20,112,254,105,128,121,64,87,82,72,
+122,0,3,255,169,255,226,4,130,4,250,0,19,0,22,0,30,0,0,1,35,17,35,39,17,1,
+39,1,46,3,53,17,35,39,53,33,23,5,33,1,5,50,55,1,39,17,20,22,4,130,237,19,
+124,253,239,116,1,79,59,99,107,39,170,77,4,140,77,254,132,254,45,1,211,254,
+197,129,121,254,227,117,85,4,118,251,128,93,1,99,254,44,100,1,28,9,54,116,
+119,141,1,93,112,20,112,20,254,5,172,105,1,53,138,254,141,103,78,0,2,255,
+169,255,236,5,155,4,250,0,38,0,48,0,0,1,35,17,35,39,53,7,39,1,53,6,35,34,
+38,39,6,7,22,5,7,38,0,53,52,54,51,50,22,23,54,54,53,52,39,33,39,53,33,23,
+5,33,22,21,20,7,22,51,50,55,5,155,237,19,120,218,113,1,75,102,119,96,181,
+67,85,138,122,1,30,114,192,254,225,58,47,45,60,40,70,74,46,254,68,77,5,165,
+77,254,132,254,0,64,55,98,108,175,122,4,118,251,128,90,230,194,98,1,22,70,
+48,55,43,91,62,180,182,117,163,1,157,116,55,65,38,42,32,130,74,111,83,112,
+20,112,20,134,134,97,89,48,81,0,1,255,169,255,34,4,47,4,250,0,53,0,0,19,20,
+23,54,51,50,30,3,21,17,35,39,53,52,39,5,39,37,38,35,34,6,21,20,22,23,7,38,
+2,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,6,252,
+50,92,105,63,106,105,124,37,19,120,8,254,250,113,1,34,54,70,128,172,171,195,
+49,218,245,99,116,172,139,113,142,253,77,77,4,57,77,245,142,128,163,141,2,
+170,61,42,54,27,63,140,103,65,254,249,90,249,29,27,233,98,243,30,153,119,
+111,203,66,75,76,1,13,171,134,97,97,112,114,111,16,199,112,20,112,20,254,
+203,14,90,0,255,255,255,169,254,223,5,183,4,250,0,38,0,86,0,0,0,7,1,5,4,208,
+0,152,0,2,0,131,254,242,6,60,4,250,0,72,0,83,0,0,1,35,17,35,39,17,7,39,1,
+53,6,6,35,34,39,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,
+23,7,38,39,6,35,34,39,38,38,53,52,54,54,55,38,53,52,54,51,50,22,22,21,20,
+6,7,22,51,50,55,17,33,39,53,33,23,1,54,54,53,52,38,35,34,6,21,20,6,60,237,
+19,120,201,116,1,57,62,166,92,193,168,84,98,69,94,76,73,42,14,62,48,68,105,
+55,62,77,169,162,106,66,45,40,152,126,75,64,69,104,80,191,129,105,87,160,
+95,71,65,79,79,240,185,254,232,77,2,148,77,251,143,79,84,66,57,61,80,4,118,
+251,48,90,1,50,181,100,1,5,163,40,46,84,55,79,104,63,76,95,24,36,44,46,64,
+105,70,41,78,24,122,152,67,157,163,9,125,73,114,63,73,115,85,52,144,160,103,
+126,122,154,81,58,97,49,17,127,1,63,112,20,112,254,140,52,100,63,55,76,82,
+63,123,0,0,1,255,169,255,125,5,29,4,250,0,44,0,0,1,35,17,35,39,53,7,39,1,
+17,33,22,21,20,6,7,22,23,7,38,39,38,38,53,52,54,51,50,23,50,54,53,52,38,39,
+35,39,53,33,17,33,39,53,33,23,5,29,237,19,120,204,116,1,60,254,54,141,150,
+122,111,148,108,144,103,79,113,62,39,88,54,86,92,65,56,158,77,3,44,252,85,
+77,5,39,77,4,118,251,48,90,235,189,100,1,12,1,60,123,147,104,139,11,142,77,
+118,128,216,18,101,62,47,52,127,91,70,62,106,35,112,20,1,24,112,20,112,255,
+255,255,169,255,11,5,223,4,250,2,38,1,76,0,0,0,7,0,100,3,229,0,129,255,255,
+255,169,253,246,6,24,4,250,2,38,1,77,0,0,0,7,0,100,3,197,255,108,255,255,
+255,169,255,29,4,96,4,250,2,38,1,78,0,0,0,7,0,100,3,233,0,147,255,255,255,
+169,254,187,4,145,4,250,2,38,1,79,0,0,0,7,0,100,3,250,0,49,255,255,255,169,
+254,84,4,177,4,250,2,38,0,57,0,0,0,39,0,100,2,169,0,188,0,7,1,5,3,59,0,13,
+255,255,255,169,255,11,4,194,4,250,2,38,1,81,0,0,0,7,0,100,4,140,0,129,255,
+255,255,169,254,80,5,39,4,250,2,38,0,59,0,0,0,39,0,100,2,206,0,184,0,7,1,
+5,3,96,0,9,255,255,255,169,255,169,5,106,4,250,2,38,1,83,0,0,0,7,0,100,2,
+248,1,151,255,255,255,169,254,178,6,11,4,250,2,38,1,84,0,0,0,7,0,100,2,221,
+0,40,255,255,255,169,255,203,5,148,4,250,2,38,1,85,0,0,0,7,0,100,3,76,1,189,
+255,255,255,169,254,129,3,229,4,250,2,38,0,63,0,0,0,39,0,100,2,145,1,17,0,
+7,1,5,2,232,0,58,255,255,255,167,254,120,4,124,4,250,2,38,0,64,0,0,0,39,0,
+100,2,158,0,240,0,7,1,5,3,39,0,49,255,255,255,169,254,84,4,86,4,250,2,38,
+0,65,0,0,0,39,0,100,2,144,0,208,0,7,1,5,3,14,0,13,255,255,255,169,254,70,
+4,76,4,250,2,38,0,66,0,0,0,39,0,100,2,173,0,199,0,7,1,5,3,34,255,255,255,
+255,255,169,255,169,5,192,4,250,2,38,1,90,0,0,0,7,0,100,2,249,1,184,255,255,
+255,169,255,111,4,199,4,250,2,38,1,91,0,0,0,7,0,100,4,30,0,229,255,255,0,
+82,254,208,4,225,5,0,2,38,1,92,0,0,0,7,0,100,4,68,0,70,255,255,255,169,254,
+105,3,229,4,250,2,38,1,93,0,0,0,7,0,100,3,242,255,223,255,255,0,68,254,173,
+4,179,5,18,2,38,1,94,0,0,0,7,0,100,4,26,0,35,255,255,255,169,255,4,4,71,4,
+250,2,38,1,95,0,0,0,7,0,100,3,222,0,122,255,255,255,169,255,8,4,100,4,250,
+2,38,1,96,0,0,0,7,0,100,3,216,0,126,255,255,255,169,255,44,5,250,4,250,2,
+38,1,97,0,0,0,7,0,100,3,216,0,162,255,255,255,169,254,225,4,67,4,250,2,38,
+1,98,0,0,0,7,0,100,4,13,0,87,255,255,0,82,254,200,5,108,5,14,2,38,1,99,0,
+0,0,7,0,100,5,3,0,62,255,255,255,169,254,200,4,163,4,250,2,38,1,100,0,0,0,
+7,0,100,4,58,0,62,255,255,255,169,255,8,4,166,4,250,2,38,1,101,0,0,0,7,0,
+100,4,42,0,126,255,255,255,169,254,91,3,62,4,250,2,38,0,79,0,0,0,39,0,100,
+2,167,1,78,0,7,1,5,2,188,0,20,255,255,255,169,255,76,5,81,4,250,2,38,1,103,
+0,0,0,7,0,100,3,19,0,194,255,255,255,169,254,250,4,53,4,250,2,38,1,104,0,
+0,0,7,0,100,3,240,0,112,255,255,0,109,255,65,5,82,4,250,0,38,1,105,0,0,0,
+7,0,100,4,212,0,183,255,255,255,169,255,8,4,130,4,250,2,38,1,106,0,0,0,7,
+0,100,3,216,0,126,255,255,255,169,255,223,5,155,4,250,2,38,1,107,0,0,0,7,
+0,100,2,162,1,85,255,255,255,169,254,74,4,47,4,250,2,38,1,108,0,0,0,7,0,100,
+3,23,255,192,255,255,255,169,254,223,5,183,4,250,2,38,0,86,0,0,0,39,1,5,4,
+208,0,152,0,7,0,100,2,199,1,11,0,2,255,169,255,229,5,63,4,250,0,33,0,47,0,
+0,1,7,38,38,35,34,7,17,35,39,17,1,39,55,38,38,53,52,54,51,50,23,17,33,39,
+53,33,23,21,33,17,54,51,50,1,53,38,38,35,34,6,6,21,20,22,51,50,54,5,63,61,
+33,68,44,120,177,19,120,254,69,116,249,132,187,182,133,171,139,253,61,77,
+4,165,77,254,173,111,120,152,253,242,59,105,65,81,121,63,99,84,86,161,2,189,
+62,38,38,191,253,234,90,1,32,254,117,100,211,16,203,126,125,168,110,1,74,
+112,20,112,20,254,111,97,254,252,140,38,33,69,107,57,73,90,99,0,2,255,169,
+255,4,5,125,4,250,0,37,0,61,0,0,1,6,6,7,1,39,37,38,36,2,53,52,54,51,50,22,
+23,54,53,52,39,33,39,53,33,23,21,33,22,21,16,5,22,4,51,50,36,55,1,50,22,23,
+7,38,35,34,6,21,20,22,51,50,55,23,6,35,34,38,38,53,52,54,5,125,55,169,92,
+252,184,76,1,232,164,254,244,154,61,47,42,63,36,114,49,254,113,77,4,114,77,
+253,138,67,254,202,67,1,17,170,155,1,42,102,254,131,91,186,66,37,105,120,
+108,139,96,73,140,100,90,111,152,90,171,108,169,1,28,62,109,36,254,183,133,
+177,16,225,1,30,95,55,64,40,40,61,175,100,87,112,20,112,20,140,121,255,0,
+159,153,152,119,105,2,69,102,83,43,93,103,84,73,81,110,106,125,93,156,89,
+114,145,0,2,255,169,255,247,3,72,4,250,0,21,0,25,0,0,19,54,53,52,39,35,39,
+53,33,23,21,33,18,21,20,35,34,38,53,52,51,50,1,1,39,1,254,3,13,254,77,2,194,
+77,254,176,51,106,81,160,98,49,2,117,253,190,116,2,75,3,52,31,72,102,117,
+112,20,112,20,254,217,194,186,178,88,92,254,184,254,6,100,1,242,0,0,1,255,
+169,255,149,3,144,4,250,0,38,0,0,1,6,7,1,39,1,46,2,53,52,55,38,53,52,55,35,
+39,53,33,23,21,33,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,55,3,144,34,65,
+253,234,116,1,54,94,133,114,158,207,14,107,77,3,42,77,253,248,30,125,68,76,
+103,158,187,83,84,106,203,69,1,224,54,57,254,36,100,1,7,1,79,167,72,142,77,
+90,177,40,41,112,20,112,20,46,53,124,91,19,8,142,11,117,87,59,67,128,101,
+0,255,255,255,169,252,188,4,177,4,250,2,38,0,57,0,0,0,39,0,99,3,92,254,197,
+0,7,1,5,3,59,0,13,0,2,255,169,255,229,3,197,4,250,0,5,0,32,0,0,1,33,39,53,
+33,23,19,6,7,1,39,55,38,38,53,52,55,35,39,53,33,23,21,35,34,6,21,20,22,51,
+50,54,55,3,68,252,178,77,3,78,77,129,45,77,254,94,116,229,119,194,86,185,
+86,2,94,86,77,127,175,102,83,93,169,63,4,118,112,20,112,253,92,72,68,254,
+139,100,194,13,197,119,112,63,112,21,114,23,137,95,70,89,110,93,255,255,255,
+169,252,184,5,39,4,250,2,38,1,12,0,0,0,39,1,5,3,96,0,9,0,7,0,99,3,129,254,
+193,0,3,255,169,255,169,4,216,4,250,0,5,0,30,0,34,0,0,3,53,33,23,21,33,19,
+55,22,22,51,50,54,53,52,38,39,55,33,23,21,33,34,39,22,21,20,6,35,34,2,1,1,
+23,1,87,3,219,77,252,37,57,87,69,158,83,60,74,66,51,35,2,155,77,254,4,81,
+23,98,128,107,143,226,1,48,2,83,106,253,183,4,230,20,112,20,254,180,28,203,
+183,73,64,67,131,41,72,112,19,4,110,138,102,121,1,7,253,216,1,249,90,253,
+253,0,2,255,169,254,215,5,9,4,250,0,66,0,70,0,0,37,22,23,7,38,38,39,38,38,
+53,52,54,51,50,23,50,54,53,52,38,35,34,7,38,38,53,52,54,51,50,23,53,33,39,
+53,33,23,21,33,17,38,35,34,6,21,20,23,54,54,51,50,22,23,22,22,51,50,55,23,
+6,35,34,39,22,21,20,6,37,1,39,1,1,202,124,193,99,73,175,71,110,128,54,45,
+86,78,159,202,78,58,115,151,108,134,151,140,67,110,253,191,77,4,32,77,254,
+178,103,54,173,160,70,65,134,52,45,65,42,47,76,56,136,90,50,78,100,91,83,
+57,222,2,144,254,143,111,1,126,17,112,84,118,49,176,89,5,79,61,40,45,98,124,
+95,61,63,95,65,189,89,104,115,11,194,112,20,112,20,254,208,9,96,79,73,47,
+40,39,16,16,17,18,71,129,57,41,81,87,133,170,255,254,183,96,1,68,0,0,3,255,
+169,255,203,4,194,4,250,0,5,0,38,0,42,0,0,1,33,39,53,33,23,1,34,36,39,55,
+22,22,51,50,54,53,52,38,35,34,6,7,39,54,51,50,22,22,23,54,54,55,23,6,35,39,
+6,6,37,1,39,1,4,26,251,220,77,4,36,77,254,35,173,254,238,86,83,73,191,131,
+99,128,76,67,49,93,60,73,120,87,85,132,100,17,75,141,44,46,101,143,54,8,169,
+2,7,253,173,116,2,93,4,118,112,20,112,252,217,209,189,40,146,154,104,80,57,
+80,29,31,154,55,79,142,66,5,69,56,168,59,3,99,128,114,253,246,100,2,0,255,
+255,255,169,252,233,3,252,4,250,2,38,0,63,0,0,0,39,0,99,3,9,254,242,0,7,1,
+5,2,232,0,58,255,255,255,167,252,224,4,124,4,250,2,38,0,64,0,0,0,39,0,99,
+3,72,254,233,0,7,1,5,3,39,0,49,255,255,255,169,252,188,4,86,4,250,2,38,0,
+65,0,0,0,39,0,99,3,47,254,197,0,7,1,5,3,14,0,13,255,255,255,169,252,174,4,
+76,4,250,2,38,0,66,0,0,0,39,0,99,3,67,254,183,0,7,1,5,3,34,255,255,0,3,255,
+169,255,169,4,189,4,250,0,15,0,23,0,27,0,0,1,34,38,38,53,17,35,39,53,33,23,
+21,35,17,20,6,39,50,53,17,33,17,20,22,5,1,39,1,2,2,75,162,120,167,77,4,3,
+77,231,138,179,169,254,178,80,3,61,253,183,116,2,83,1,142,102,165,99,1,122,
+112,20,112,20,254,108,169,171,122,242,1,124,254,99,108,101,92,253,253,100,
+1,249,0,0,2,255,169,0,131,3,203,4,250,0,5,0,21,0,0,1,33,39,53,33,23,19,1,
+39,1,38,38,35,34,7,39,54,51,50,22,23,55,3,71,252,175,77,3,81,77,132,253,110,
+106,2,24,73,138,86,100,123,107,123,124,129,222,99,64,4,118,112,20,112,253,
+152,254,97,112,1,74,88,104,89,139,102,169,132,39,0,3,0,82,255,170,3,200,5,
+0,0,31,0,37,0,48,0,0,1,6,7,1,39,37,38,38,39,54,54,55,38,53,52,54,51,50,22,
+22,21,20,6,7,6,21,20,22,51,50,54,55,3,39,53,51,23,21,1,54,53,52,38,35,34,
+6,21,20,22,3,200,28,63,253,244,116,1,37,160,218,70,165,97,40,255,117,89,97,
+163,76,173,209,22,145,96,112,191,67,115,77,84,77,254,120,87,79,61,51,71,96,
+1,228,50,56,254,48,100,248,7,216,165,59,42,23,130,170,90,116,116,138,83,122,
+180,83,9,24,54,89,112,106,2,30,112,20,112,20,254,194,76,105,68,84,63,60,68,
+101,255,255,255,169,253,140,4,106,4,250,2,38,1,93,0,0,0,7,0,99,3,119,255,
+149,0,3,0,68,255,135,3,176,5,18,0,40,0,46,0,58,0,0,1,6,7,1,39,1,46,2,53,52,
+55,46,2,53,52,54,51,50,22,21,20,6,35,34,39,22,23,54,55,23,6,6,21,20,22,51,
+50,54,55,3,39,53,51,23,21,5,20,23,22,51,50,54,53,52,35,34,6,3,176,34,65,253,
+234,116,1,54,92,131,118,130,131,63,32,126,103,95,171,102,77,62,50,27,93,76,
+96,102,163,194,83,84,106,203,69,111,77,68,77,253,168,19,17,20,83,108,89,66,
+92,1,210,54,57,254,36,100,1,7,1,76,165,77,124,72,108,78,81,51,100,123,172,
+99,81,90,18,23,55,22,6,138,7,104,91,59,67,128,101,2,43,112,20,112,20,132,
+52,35,5,89,79,95,100,0,0,3,255,169,255,222,3,61,4,250,0,5,0,23,0,27,0,0,3,
+53,33,23,21,33,19,52,54,51,50,4,23,21,38,35,7,22,21,20,6,35,34,38,19,1,23,
+1,87,2,184,77,253,72,54,83,86,145,1,91,79,216,143,70,10,43,46,84,148,91,2,
+75,107,253,190,4,230,20,112,20,254,64,59,73,36,18,108,12,1,54,66,43,56,154,
+253,224,1,242,92,254,6,0,0,1,255,169,255,226,3,71,4,250,0,25,0,0,1,6,7,1,
+39,1,46,3,53,17,35,39,53,33,23,21,33,17,20,22,51,50,54,55,3,71,35,37,253,
+246,116,1,79,59,99,107,39,170,77,2,222,77,254,95,85,67,75,164,61,1,247,39,
+32,254,50,100,1,28,9,54,116,119,141,1,93,112,20,112,20,254,14,103,78,86,74,
+0,0,2,255,169,255,246,5,70,4,250,0,30,0,39,0,0,1,7,38,35,34,6,7,17,35,39,
+17,1,39,1,46,3,53,17,35,39,53,33,23,21,33,17,54,51,50,1,50,54,55,17,33,17,
+20,22,5,70,61,65,69,71,151,76,19,120,254,39,116,1,79,59,99,107,39,170,77,
+4,182,77,254,173,107,114,152,252,253,63,134,58,254,105,85,2,182,62,75,104,
+79,253,234,90,1,89,254,93,100,1,28,9,54,116,119,141,1,57,112,20,112,20,254,
+112,89,254,180,61,55,2,15,254,50,103,78,0,0,3,255,169,255,187,3,87,4,250,
+0,5,0,32,0,41,0,0,1,33,39,53,33,23,19,6,6,7,1,39,55,46,2,53,52,54,54,51,50,
+22,23,7,38,38,35,34,7,19,54,55,5,50,55,3,6,6,21,20,22,2,223,253,23,77,2,233,
+77,120,19,51,53,254,78,116,253,84,169,110,93,151,85,131,187,84,39,75,132,
+77,53,45,250,65,54,254,187,59,62,252,45,49,125,4,118,112,20,112,253,71,35,
+64,48,254,125,100,214,5,99,172,100,90,137,74,108,87,47,59,53,14,254,163,51,
+79,208,26,1,100,35,97,50,90,110,0,0,4,0,82,255,162,4,98,5,14,0,28,0,34,0,
+43,0,47,0,0,1,34,38,53,52,54,55,53,46,2,53,52,54,51,50,22,22,21,17,22,22,
+23,21,38,35,35,21,20,19,39,53,51,23,21,1,53,52,35,34,6,21,20,22,1,1,39,1,
+2,21,74,134,78,69,101,179,110,125,98,88,142,80,139,255,37,212,181,38,219,
+77,148,77,254,2,91,60,78,123,2,244,253,190,116,2,75,1,99,147,83,57,42,3,69,
+8,87,146,90,89,118,94,156,88,254,240,6,29,8,112,9,93,90,3,19,112,20,112,20,
+254,207,233,102,68,57,77,112,254,66,254,6,100,1,242,0,0,2,255,169,255,162,
+3,153,4,250,0,24,0,28,0,0,1,34,38,53,52,54,55,17,35,39,53,33,23,21,33,17,
+22,22,23,23,38,35,35,21,20,37,1,39,1,1,44,74,134,78,68,248,77,3,24,77,254,
+112,139,255,37,1,211,183,38,2,27,253,190,116,2,75,1,99,147,83,57,42,3,1,199,
+112,20,112,20,254,54,6,29,8,112,9,93,90,57,254,6,100,1,242,0,1,255,169,255,
+226,3,116,4,250,0,33,0,0,1,6,7,1,39,37,38,38,39,54,54,53,52,39,33,39,53,33,
+23,21,33,22,21,20,6,6,7,6,21,20,22,51,50,55,3,116,43,43,254,41,116,1,38,157,
+219,73,134,146,71,254,237,77,3,17,77,254,109,108,46,86,78,25,143,94,187,133,
+1,218,48,39,254,95,100,249,7,211,169,44,141,81,86,84,112,20,112,20,133,107,
+61,91,77,55,18,26,52,84,151,0,255,255,255,169,252,203,3,225,4,250,2,38,0,
+79,0,0,0,39,1,5,2,188,0,20,0,7,0,99,2,238,254,212,0,3,255,169,255,193,4,150,
+4,250,0,5,0,38,0,42,0,0,1,33,39,53,33,23,1,20,23,7,38,2,53,52,54,51,50,23,
+54,54,51,50,23,7,38,35,34,6,21,23,39,38,53,52,55,38,35,34,6,5,23,1,39,3,231,
+252,15,77,3,241,77,253,28,165,68,113,146,158,125,145,125,50,136,75,153,110,
+36,86,84,116,137,5,161,6,47,62,68,93,118,3,25,107,253,190,116,4,118,112,20,
+112,253,185,191,176,62,116,1,6,129,128,157,121,51,55,81,71,40,158,130,97,
+45,50,46,104,81,39,119,141,92,254,6,100,0,2,255,169,255,212,3,56,4,250,0,
+5,0,35,0,0,1,33,39,53,33,23,19,6,6,7,1,39,55,38,38,53,52,54,51,50,22,23,7,
+38,38,35,34,6,6,21,20,22,51,50,54,55,2,190,253,56,77,2,200,77,122,16,79,43,
+254,95,116,249,138,192,182,133,131,187,84,39,75,130,77,81,121,63,106,88,92,
+169,64,4,118,112,20,112,253,92,28,92,38,254,140,100,211,19,213,130,125,168,
+108,87,47,58,51,69,107,57,79,101,109,94,0,3,0,109,0,27,4,36,4,250,0,5,0,30,
+0,40,0,0,1,39,53,51,23,21,19,1,39,1,38,39,6,7,39,54,55,38,53,52,54,51,50,
+22,22,21,20,7,22,23,55,37,54,53,52,38,35,34,6,21,20,3,63,77,101,77,128,253,
+205,116,1,135,146,125,110,161,121,165,104,224,128,97,86,169,95,155,111,163,
+109,254,9,135,79,59,59,79,4,118,112,20,112,20,253,146,254,19,100,1,73,67,
+79,90,92,105,87,79,182,178,95,126,106,141,89,121,150,72,73,91,144,128,121,
+64,87,82,72,122,0,2,255,169,255,226,3,100,4,250,0,18,0,27,0,0,1,6,7,1,39,
+1,46,3,53,17,35,39,53,33,23,21,33,19,50,54,55,1,39,17,20,22,3,100,29,54,253,
+228,116,1,79,59,99,107,39,170,77,3,21,77,254,40,152,60,130,58,254,229,117,
+85,2,21,38,47,254,34,100,1,28,9,54,116,119,141,1,93,112,20,112,20,253,89,
+56,51,1,51,138,254,141,103,78,0,0,2,255,169,255,236,4,111,4,250,0,39,0,43,
+0,0,37,7,38,0,53,52,54,51,50,22,23,54,54,53,52,39,33,39,53,33,23,21,33,22,
+21,20,7,22,51,50,55,23,6,35,34,38,39,6,7,22,37,1,39,37,2,167,114,192,254,
+225,58,47,45,60,40,70,74,46,254,68,77,3,192,77,254,105,64,55,98,108,119,101,
+58,88,110,96,181,67,85,138,122,2,230,254,218,113,1,46,97,117,163,1,157,116,
+55,65,38,42,32,130,74,111,83,112,20,112,20,134,134,97,89,48,52,140,38,55,
+43,91,62,180,97,254,252,98,253,0,255,255,255,169,253,37,4,47,4,250,2,38,1,
+108,0,0,0,7,0,99,2,168,255,46,255,255,255,169,254,223,5,183,4,250,2,38,1,
+39,0,0,0,7,1,5,4,208,0,152,0,4,0,131,255,23,5,32,4,250,0,57,0,63,0,74,0,78,
+0,0,5,7,38,39,6,35,34,46,2,53,52,54,54,55,38,53,52,54,51,50,22,22,21,20,6,
+7,22,51,50,55,23,6,35,34,39,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,
+20,6,7,22,22,19,39,53,33,23,21,1,54,54,53,52,38,35,34,6,21,20,1,5,39,37,3,
+158,146,108,38,40,45,81,131,147,59,69,104,80,191,129,105,87,160,95,73,67,
+64,62,212,168,53,136,156,189,171,83,100,69,94,76,71,44,16,62,48,68,107,55,
+62,21,132,62,77,1,40,77,252,249,79,86,66,57,61,80,3,186,254,249,122,1,41,
+161,72,185,94,8,66,148,107,57,73,115,85,52,144,160,103,126,122,154,81,59,
+98,49,14,59,147,46,84,54,79,105,63,76,95,25,38,46,46,64,110,71,41,77,25,38,
+146,4,232,112,20,112,20,254,159,52,101,63,55,76,82,63,123,253,246,195,112,
+202,0,0,3,255,169,255,131,4,120,4,250,0,5,0,36,0,40,0,0,1,33,39,53,33,23,
+1,22,22,23,7,38,39,38,38,53,52,54,51,50,23,50,54,53,52,38,39,35,39,53,33,
+21,33,22,21,20,6,37,1,39,1,3,195,252,51,77,3,205,77,253,143,39,127,58,95,
+151,77,77,110,62,39,88,54,86,92,65,56,178,77,4,19,253,99,141,151,2,171,254,
+147,116,1,121,4,118,112,20,112,252,68,61,121,31,118,153,186,19,100,61,47,
+52,127,91,70,62,106,35,112,20,132,123,147,104,139,206,254,246,108,1,7,0,255,
+255,255,169,255,11,5,63,4,250,2,38,1,146,0,0,0,7,0,100,3,229,0,129,255,255,
+255,169,253,246,5,125,4,250,2,38,1,147,0,0,0,7,0,100,3,197,255,108,255,255,
+255,169,255,29,3,72,4,250,2,38,1,148,0,0,0,7,0,100,3,233,0,147,255,255,255,
+169,254,187,3,144,4,250,2,38,1,149,0,0,0,7,0,100,3,250,0,49,255,255,255,169,
+252,158,4,177,4,250,2,38,0,57,0,0,0,39,0,100,2,169,0,188,0,39,0,99,3,62,254,
+167,0,7,1,5,3,59,0,13,255,255,255,169,255,11,3,197,4,250,2,38,1,151,0,0,0,
+7,0,100,4,140,0,129,255,255,255,169,254,80,5,39,4,250,2,38,1,12,0,0,0,39,
+1,5,3,96,0,9,0,7,0,100,2,206,0,184,255,255,255,169,255,169,4,216,4,250,2,
+38,1,153,0,0,0,7,0,100,2,248,1,151,255,255,255,169,254,178,5,9,4,250,2,38,
+1,154,0,0,0,7,0,100,2,221,0,40,255,255,255,169,255,203,4,194,4,250,2,38,1,
+155,0,0,0,7,0,100,3,76,1,189,255,255,255,169,252,233,3,252,4,250,2,38,0,63,
+0,0,0,39,0,100,2,145,1,17,0,39,0,99,3,9,254,242,0,7,1,5,2,232,0,58,255,255,
+255,167,252,224,4,124,4,250,2,38,0,64,0,0,0,39,0,100,2,158,0,240,0,39,0,99,
+3,72,254,233,0,7,1,5,3,39,0,49,255,255,255,169,252,188,4,86,4,250,2,38,0,
+65,0,0,0,39,0,100,2,144,0,208,0,39,0,99,3,47,254,197,0,7,1,5,3,14,0,13,255,
+255,255,169,252,174,4,76,4,250,2,38,0,66,0,0,0,39,0,100,2,173,0,199,0,39,
+1,5,3,34,255,255,0,7,0,99,3,67,254,183,255,255,255,169,255,169,4,189,4,250,
+2,38,1,160,0,0,0,7,0,100,2,249,1,184,255,255,255,169,255,111,3,203,4,250,
+2,38,1,161,0,0,0,7,0,100,4,30,0,229,255,255,0,82,254,208,3,200,5,0,2,38,1,
+162,0,0,0,7,0,100,4,68,0,70,255,255,255,169,253,140,4,106,4,250,2,38,1,93,
+0,0,0,39,0,99,3,119,255,149,0,7,0,100,3,93,255,137,255,255,0,68,254,173,3,
+176,5,18,2,38,1,164,0,0,0,7,0,100,4,26,0,35,255,255,255,169,255,4,3,61,4,
+250,2,38,1,165,0,0,0,7,0,100,3,222,0,122,255,255,255,169,255,8,3,71,4,250,
+2,38,1,166,0,0,0,7,0,100,3,216,0,126,255,255,255,169,255,44,5,70,4,250,2,
+38,1,167,0,0,0,7,0,100,3,216,0,162,255,255,255,169,254,225,3,87,4,250,2,38,
+1,168,0,0,0,7,0,100,4,13,0,87,255,255,0,82,254,200,4,98,5,14,2,38,1,169,0,
+0,0,7,0,100,5,3,0,62,255,255,255,169,254,200,3,153,4,250,2,38,1,170,0,0,0,
+7,0,100,4,58,0,62,255,255,255,169,255,8,3,116,4,250,2,38,1,171,0,0,0,7,0,
+100,4,42,0,126,255,255,255,169,252,203,3,225,4,250,2,38,0,79,0,0,0,39,0,100,
+2,167,1,78,0,39,1,5,2,188,0,20,0,7,0,99,2,238,254,212,255,255,255,169,255,
+76,4,150,4,250,2,38,1,173,0,0,0,7,0,100,3,19,0,194,255,255,255,169,254,250,
+3,56,4,250,2,38,1,174,0,0,0,7,0,100,3,240,0,112,255,255,0,109,255,65,4,36,
+4,250,2,38,1,175,0,0,0,7,0,100,4,212,0,183,255,255,255,169,255,8,3,100,4,
+250,2,38,1,176,0,0,0,7,0,100,3,216,0,126,255,255,255,169,255,223,4,111,4,
+250,2,38,1,177,0,0,0,7,0,100,2,162,1,85,255,255,255,169,253,37,4,47,4,250,
+2,38,1,108,0,0,0,39,0,100,2,216,0,26,0,7,0,99,3,22,255,46,255,255,255,169,
+254,223,5,183,4,250,2,38,1,39,0,0,0,39,1,5,4,208,0,152,0,7,0,100,2,199,1,
+11,0,1,255,169,255,246,6,143,4,250,0,50,0,0,1,54,51,50,22,21,20,6,7,39,54,
+54,53,52,38,35,34,6,7,17,35,39,17,38,35,34,6,21,20,22,23,7,38,2,53,52,55,
+35,39,53,33,50,23,17,33,39,53,33,23,21,33,3,248,105,106,128,185,80,59,136,
+66,87,62,52,69,145,74,19,124,90,84,133,131,141,117,59,186,163,69,255,87,2,
+57,132,160,252,141,77,6,153,77,253,105,2,229,90,191,154,80,179,68,98,82,158,
+82,58,70,104,80,253,235,93,2,122,9,142,114,111,202,99,66,150,1,4,126,111,
+79,126,20,22,1,44,112,20,112,20,0,3,255,169,255,169,9,112,4,250,0,65,0,87,
+0,95,0,0,1,35,17,35,39,17,6,6,35,34,38,39,62,2,53,52,35,33,38,35,34,6,21,
+20,23,54,54,51,50,22,22,21,20,6,6,35,34,36,39,55,22,22,51,50,54,53,52,38,
+35,34,7,38,38,53,52,54,51,50,23,53,33,39,53,33,23,5,33,21,33,50,30,2,21,20,
+6,6,7,6,6,21,20,22,51,50,54,55,37,20,35,34,53,52,51,50,9,112,237,19,117,53,
+138,72,155,253,69,102,125,82,201,253,175,103,54,173,160,70,65,134,52,89,123,
+100,81,160,112,163,254,217,122,74,92,225,115,137,178,78,58,115,151,108,134,
+151,140,67,110,253,85,77,9,122,77,254,131,251,63,2,30,77,118,108,92,56,75,
+54,41,35,114,86,100,175,66,252,186,100,101,101,100,4,118,251,51,87,1,30,45,
+52,185,163,35,53,67,42,104,9,96,79,73,47,40,39,76,152,81,83,141,84,183,177,
+53,133,143,122,95,61,63,95,65,189,89,104,115,11,194,112,20,112,20,171,30,
+82,127,72,50,73,45,25,19,22,13,35,52,80,78,138,108,108,109,0,0,3,255,169,
+255,169,9,162,4,250,0,73,0,95,0,106,0,0,1,35,17,35,39,17,6,6,35,34,38,39,
+62,2,53,52,35,33,22,21,20,2,4,35,34,38,38,53,52,55,38,38,53,52,54,51,50,22,
+23,7,38,35,34,6,21,20,22,23,54,51,51,23,34,6,21,20,22,51,50,54,55,38,38,53,
+52,54,55,53,33,39,53,33,23,5,33,21,33,50,30,2,21,20,6,6,7,6,6,21,20,22,51,
+50,54,55,37,52,38,35,34,6,21,20,22,23,54,9,162,237,19,117,53,138,72,155,253,
+69,102,125,82,201,254,168,59,156,254,235,170,94,182,119,84,84,100,135,106,
+60,113,37,22,41,48,78,103,48,44,84,111,13,54,120,158,98,95,137,234,77,158,
+171,110,95,252,184,77,9,172,77,254,131,251,168,1,181,77,118,108,92,56,75,
+54,41,35,114,86,100,175,66,252,4,86,66,67,87,140,98,68,4,118,251,51,87,1,
+30,45,52,185,163,35,53,67,42,104,99,125,158,254,234,168,90,152,77,111,72,
+32,134,90,100,124,45,43,47,20,84,71,43,91,32,44,120,97,88,78,86,122,104,72,
+200,122,93,128,13,157,112,20,112,20,171,30,82,127,72,50,73,45,25,19,22,13,
+35,52,80,78,206,86,95,86,74,92,146,49,124,0,1,255,169,254,37,4,22,4,250,0,
+53,0,0,19,20,22,51,50,55,23,6,7,17,39,34,6,21,20,22,51,50,55,23,6,35,34,38,
+38,53,52,54,51,50,23,53,7,34,38,38,53,52,54,51,50,23,53,33,39,53,33,23,21,
+35,17,39,34,6,254,155,119,177,132,86,58,69,104,210,228,155,119,177,132,86,
+136,173,127,230,141,231,200,53,58,44,127,230,141,231,200,48,58,253,105,77,
+4,32,77,250,104,210,228,2,136,80,108,77,136,36,23,254,255,2,113,116,80,108,
+77,136,86,117,190,101,137,134,5,118,2,117,190,101,137,134,5,153,112,20,112,
+20,254,245,2,113,0,2,255,169,254,37,4,19,4,250,0,45,0,58,0,0,19,20,22,51,
+50,55,23,6,7,21,22,22,21,20,6,35,34,38,38,53,52,54,51,50,23,53,38,38,53,52,
+54,51,50,23,53,33,39,53,33,23,21,35,17,39,34,6,1,35,34,6,21,20,22,51,50,54,
+53,52,38,254,155,119,177,132,86,106,134,142,166,223,190,125,228,140,211,169,
+36,44,174,255,231,200,48,58,253,105,77,4,29,77,247,104,210,228,1,128,11,181,
+215,156,124,144,189,102,2,136,80,108,77,136,67,15,156,32,181,119,141,165,
+98,174,106,128,161,6,134,23,239,141,137,134,5,153,112,20,112,20,254,245,2,
+113,253,108,137,117,92,120,138,107,68,121,0,2,255,169,255,169,8,15,4,250,
+0,45,0,65,0,0,1,35,17,35,39,17,6,6,35,34,38,39,54,54,53,52,35,33,39,34,6,
+21,20,22,51,50,54,55,23,6,35,34,38,38,53,52,54,51,50,23,17,33,39,53,33,23,
+5,33,21,51,50,30,2,21,20,6,7,6,21,20,22,51,50,54,55,8,15,237,19,117,53,138,
+72,155,253,69,189,120,201,254,232,84,204,254,162,137,91,126,67,86,138,171,
+128,230,140,238,193,48,58,253,123,77,8,25,77,254,131,252,120,229,77,118,108,
+92,79,106,76,114,86,100,175,66,4,118,251,51,87,1,20,45,52,185,163,44,56,32,
+104,2,167,132,119,142,38,38,136,86,134,223,125,154,187,5,1,9,112,20,112,20,
+246,30,82,127,72,41,66,36,25,14,35,52,80,78,0,3,255,169,254,37,4,152,4,250,
+0,40,0,53,0,66,0,0,1,21,22,22,21,20,6,7,21,22,22,21,20,6,35,34,38,38,53,52,
+54,51,50,23,53,46,2,53,52,54,51,50,23,53,33,39,53,33,23,21,5,35,34,6,21,20,
+22,51,50,54,53,52,38,3,35,34,6,21,20,22,51,50,54,53,52,38,2,197,140,163,163,
+140,140,163,223,190,125,228,140,211,169,37,43,120,211,129,211,169,37,43,253,
+192,77,4,162,77,253,251,11,181,215,156,124,144,189,102,104,11,181,215,156,
+124,144,189,102,4,118,178,34,178,119,120,156,22,173,34,178,119,141,165,98,
+174,106,128,161,6,142,7,101,167,102,128,161,6,154,112,20,112,20,236,137,117,
+92,120,138,107,68,121,252,254,137,117,92,120,138,107,68,121,0,3,255,167,255,
+169,8,218,4,250,0,41,0,63,0,76,0,0,1,35,17,35,39,17,6,6,35,34,38,39,62,2,
+53,52,38,35,33,22,22,21,20,6,35,34,38,38,53,52,54,54,51,50,23,17,33,39,53,
+33,23,5,33,21,33,50,30,2,21,20,6,6,7,6,6,21,20,22,51,50,54,55,37,52,38,39,
+14,2,21,20,22,51,50,54,8,218,237,19,117,53,138,72,155,253,69,103,124,82,113,
+88,254,51,91,108,223,190,129,226,137,108,179,102,37,43,253,193,77,8,230,77,
+254,131,251,101,1,248,77,118,109,91,55,74,56,39,37,114,86,100,175,66,251,
+247,107,107,126,181,92,158,122,144,189,4,118,251,51,87,1,30,45,52,185,163,
+28,40,53,32,55,49,58,180,119,178,209,126,220,135,106,165,90,6,1,0,112,20,
+112,20,215,30,83,128,70,41,60,36,22,15,19,10,35,52,80,78,5,93,172,50,1,97,
+158,92,127,166,184,0,0,1,255,169,254,37,4,113,4,250,0,83,0,0,1,20,22,23,54,
+51,50,22,22,21,20,6,6,35,34,6,21,20,22,23,54,51,50,22,22,21,20,6,6,35,34,
+36,39,55,22,22,51,50,54,53,52,38,35,34,7,38,38,53,52,54,55,38,39,55,22,22,
+51,50,54,53,52,38,35,34,7,38,38,53,52,33,50,23,53,33,39,53,33,23,21,33,17,
+38,35,32,1,92,28,20,139,118,97,128,90,80,156,109,136,139,28,20,139,118,94,
+125,106,84,162,109,153,254,234,111,74,85,225,115,115,156,64,56,139,158,93,
+123,64,58,145,114,74,85,225,115,115,156,64,56,139,158,93,123,1,22,92,102,
+253,68,77,4,123,77,254,210,104,63,254,192,2,234,27,47,12,83,80,138,79,63,
+110,67,76,65,27,47,12,83,74,153,70,62,111,67,155,140,53,108,107,99,73,48,
+52,99,51,163,74,52,86,21,78,145,53,108,107,99,73,48,52,99,51,163,74,199,11,
+154,112,20,112,20,254,248,9,0,0,2,255,169,254,37,4,113,4,250,0,72,0,83,0,
+0,1,20,22,23,54,51,50,22,22,21,20,6,6,35,34,6,21,20,22,23,38,38,53,52,54,
+51,50,22,22,21,20,6,35,34,38,38,53,52,54,55,38,39,55,22,22,51,50,54,53,52,
+38,35,34,7,38,38,53,52,33,50,23,53,33,39,53,33,23,21,33,17,38,35,32,19,20,
+23,54,54,53,52,38,35,34,6,1,92,28,20,139,118,97,128,90,80,156,109,170,193,
+162,127,48,57,128,96,71,130,94,191,154,106,216,173,117,109,148,120,74,85,
+225,115,115,156,64,56,139,158,93,123,1,22,92,102,253,68,77,4,123,77,254,210,
+104,63,254,192,234,48,85,117,57,45,65,83,2,223,30,52,14,83,80,138,79,63,110,
+67,146,134,107,145,3,41,119,57,87,118,69,141,76,115,146,99,218,126,105,146,
+33,76,152,53,108,107,99,73,48,52,99,53,168,77,199,11,165,112,20,112,20,254,
+237,9,251,193,70,63,16,95,79,46,56,90,0,2,255,169,255,169,8,151,4,250,0,65,
+0,87,0,0,1,35,17,35,39,17,6,6,35,34,38,39,62,2,53,52,35,33,38,35,34,6,21,
+20,23,54,54,51,50,22,22,21,20,6,6,35,34,36,39,55,22,22,51,50,54,53,52,38,
+35,34,7,38,38,53,52,54,51,50,23,53,33,39,53,33,23,5,33,21,33,50,30,2,21,20,
+6,6,7,6,6,21,20,22,51,50,54,55,8,151,237,19,117,53,138,72,155,253,69,102,
+125,82,201,254,136,103,54,173,160,70,65,134,52,89,123,100,81,160,112,163,
+254,217,122,74,92,225,115,137,178,78,58,115,151,108,134,151,140,67,110,253,
+85,77,8,161,77,254,131,252,24,1,69,77,118,108,92,56,75,54,41,35,114,86,100,
+175,66,4,118,251,51,87,1,30,45,52,185,163,35,53,67,42,104,9,96,79,73,47,40,
+39,76,152,81,83,141,84,183,177,53,133,143,122,95,61,63,95,65,189,89,104,115,
+11,194,112,20,112,20,171,30,82,127,72,50,73,45,25,19,22,13,35,52,80,78,0,
+0,3,255,169,254,37,4,113,4,250,0,62,0,73,0,84,0,0,1,20,22,23,38,38,53,52,
+54,51,50,22,22,21,20,6,7,4,21,20,22,23,38,38,53,52,54,51,50,22,22,21,20,6,
+35,34,38,38,53,52,54,55,38,38,53,52,54,51,50,23,53,33,39,53,33,23,21,33,17,
+38,35,34,6,5,20,23,54,54,53,52,38,35,34,6,17,20,23,54,54,53,52,38,35,34,6,
+1,7,170,132,48,57,128,96,71,130,94,175,170,254,141,168,134,48,57,128,96,71,
+130,94,191,154,115,219,174,126,117,93,155,232,203,72,56,253,74,77,4,123,77,
+254,207,83,80,192,214,1,79,49,93,108,56,46,67,81,49,93,108,56,46,67,81,2,
+67,107,145,3,41,119,57,87,118,69,141,76,108,140,13,30,253,115,148,3,41,119,
+57,87,118,69,141,76,115,146,105,222,127,103,157,36,54,209,115,147,169,4,177,
+112,20,112,20,254,224,5,141,255,70,64,15,103,69,48,56,90,253,27,70,64,15,
+103,69,48,56,90,0,0,3,255,169,255,169,8,148,4,250,0,52,0,74,0,85,0,0,1,35,
+17,35,39,17,6,6,35,34,38,39,62,2,53,52,35,33,38,35,34,6,21,20,22,23,38,38,
+53,52,54,51,50,22,21,20,6,35,34,38,2,53,52,54,51,23,17,33,39,53,33,23,5,33,
+21,33,50,30,2,21,20,6,6,7,6,6,21,20,22,51,50,54,55,5,20,23,54,54,53,52,38,
+35,34,6,8,148,237,19,117,53,138,72,155,253,69,107,120,82,201,254,141,82,60,
+201,228,172,136,49,59,127,107,119,166,191,154,116,220,181,249,210,108,253,
+85,77,8,158,77,254,131,252,30,1,63,77,118,108,92,56,73,56,43,33,114,86,100,
+175,66,251,52,52,87,111,56,46,67,81,4,118,251,51,87,1,0,45,52,185,163,30,
+40,54,34,104,5,189,164,126,167,3,46,136,65,99,120,189,111,128,163,111,1,0,
+139,173,205,4,1,6,112,20,112,20,240,30,82,127,72,42,62,37,22,17,17,11,35,
+52,80,78,160,86,75,19,122,73,55,63,98,0,0,1,255,169,255,231,5,43,4,250,0,
+31,0,0,1,35,17,35,39,17,38,35,34,6,21,20,22,23,7,38,2,53,52,55,35,39,53,33,
+50,23,17,33,39,53,33,23,5,43,237,19,124,114,130,128,146,157,122,59,150,220,
+69,255,87,2,151,105,173,252,71,77,5,53,77,4,118,251,128,93,2,136,14,137,118,
+117,233,99,66,118,1,35,164,111,79,126,20,26,1,28,112,20,112,0,0,2,255,169,
+255,231,3,253,4,250,0,5,0,27,0,0,1,33,39,53,33,23,1,20,22,23,7,38,2,53,52,
+55,35,39,53,33,50,23,21,38,38,35,34,6,3,142,252,104,77,3,152,77,254,27,157,
+122,59,150,220,69,255,87,2,151,164,192,49,209,64,128,146,4,118,112,20,112,
+253,96,117,233,99,66,118,1,35,164,111,79,126,20,36,123,6,14,137,0,0,1,255,
+169,255,34,4,52,4,250,0,60,0,0,5,7,38,38,39,6,35,34,39,22,21,20,35,34,38,
+53,52,51,50,23,54,53,39,38,38,53,52,54,51,50,23,53,33,39,53,33,23,21,33,17,
+39,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,4,52,145,78,132,
+76,39,72,65,58,18,89,68,134,82,38,35,7,2,100,125,224,188,54,58,253,161,77,
+3,241,77,254,253,96,213,222,131,101,93,47,14,62,48,67,106,55,62,168,139,83,
+96,222,150,11,18,148,137,156,149,74,78,5,47,65,81,59,179,92,128,154,6,235,
+112,20,112,20,254,177,2,129,112,88,114,29,36,44,46,64,106,69,42,78,23,235,
+0,0,2,255,169,255,34,5,16,4,250,0,56,0,78,0,0,5,38,39,21,20,6,35,34,38,38,
+53,53,38,38,53,52,54,51,51,38,53,52,54,51,50,23,53,33,39,53,33,23,21,33,17,
+39,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,1,6,35,34,
+38,39,6,6,21,20,22,23,54,55,23,6,21,20,22,51,50,54,4,127,104,111,135,118,
+82,126,112,128,160,137,113,3,35,224,188,54,58,252,197,77,4,235,77,254,223,
+96,213,222,131,101,93,47,14,62,48,67,106,55,62,168,175,254,52,38,44,104,197,
+71,69,85,81,77,31,69,122,97,53,39,103,124,222,128,204,13,143,164,57,115,71,
+7,13,143,100,90,108,68,69,128,154,6,235,112,20,112,20,254,177,2,129,112,88,
+114,29,36,44,46,64,106,69,42,78,23,235,171,1,123,5,97,82,7,74,59,54,82,23,
+54,44,94,66,78,37,43,185,0,1,255,169,254,242,3,219,4,250,0,57,0,0,1,20,23,
+54,55,23,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,7,38,
+39,6,35,34,38,38,53,52,55,38,38,53,52,54,51,50,23,53,33,39,53,33,23,21,33,
+17,38,35,32,1,16,78,99,121,103,185,218,104,83,81,37,14,62,48,68,105,55,62,
+77,169,162,106,66,42,31,116,197,123,125,64,85,147,123,111,95,253,176,77,3,
+229,77,254,250,90,95,254,244,2,234,68,48,32,5,142,112,96,62,80,24,36,44,46,
+64,105,70,41,78,24,122,152,67,157,163,5,101,160,81,129,73,34,112,65,90,108,
+19,163,112,20,112,20,254,240,12,0,1,255,169,255,34,5,43,4,250,0,78,0,0,5,
+38,39,21,20,6,35,34,38,38,53,53,38,38,53,55,52,39,55,30,2,21,7,20,23,54,55,
+23,6,21,20,22,51,50,54,55,6,35,34,38,38,53,52,54,51,50,23,53,33,39,53,33,
+23,21,33,17,39,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,
+4,154,104,111,135,118,82,126,112,126,159,3,51,28,63,83,26,2,158,30,70,122,
+97,53,39,103,124,6,38,44,112,213,136,224,188,53,59,252,170,77,5,6,77,254,
+223,96,213,222,131,101,93,47,14,62,48,67,106,55,62,168,175,222,128,204,13,
+143,164,57,115,71,7,12,140,101,76,38,25,58,23,48,47,37,70,103,46,53,44,94,
+66,78,37,43,185,160,5,113,188,95,128,154,6,235,112,20,112,20,254,177,2,129,
+112,88,114,29,36,44,46,64,106,69,42,78,23,235,171,0,0,2,255,169,255,34,9,
+55,4,250,0,93,0,115,0,0,1,35,17,35,39,17,6,6,35,34,38,39,54,54,53,52,35,33,
+39,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,7,38,39,21,
+20,6,35,34,38,38,53,53,38,38,53,55,52,39,55,30,2,21,7,20,23,54,55,23,6,21,
+20,22,51,50,54,55,6,35,34,38,38,53,52,54,51,50,23,53,33,39,53,33,23,5,33,
+21,33,50,30,2,21,20,6,6,7,6,6,21,20,22,51,50,54,55,9,55,237,19,117,53,138,
+72,155,253,69,183,126,201,254,145,96,213,222,131,101,93,47,14,62,48,67,106,
+55,62,168,175,145,104,111,135,118,82,126,112,126,159,3,51,28,63,83,26,2,158,
+30,70,122,97,53,39,103,124,6,38,44,112,213,136,224,188,53,59,252,170,77,9,
+65,77,254,131,252,33,1,60,77,118,108,92,56,74,55,42,34,114,86,100,175,66,
+4,118,251,51,87,1,30,45,52,185,163,52,73,41,104,2,129,112,88,114,29,36,44,
+46,64,106,69,42,78,23,235,171,83,128,204,13,143,164,57,115,71,7,12,140,101,
+76,38,25,58,23,48,47,37,70,103,46,53,44,94,66,78,37,43,185,160,5,113,188,
+95,128,154,6,235,112,20,112,20,202,30,82,127,72,44,64,39,22,18,18,11,35,52,
+80,78,0,0,3,255,174,255,34,4,67,4,250,0,52,0,61,0,69,0,0,5,38,39,21,20,6,
+35,34,38,38,53,52,54,55,38,38,53,52,54,51,50,23,53,33,39,53,33,23,21,33,17,
+39,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,1,6,7,23,54,
+55,6,35,34,19,39,6,21,20,22,51,50,3,178,104,111,147,124,83,134,114,81,82,
+92,112,224,188,53,59,253,151,77,4,25,77,254,223,96,213,222,131,101,93,47,
+14,62,48,67,106,55,62,168,175,253,120,39,32,207,49,3,38,44,51,23,217,48,80,
+62,71,222,128,204,13,139,168,74,137,95,61,124,33,61,168,88,128,154,6,235,
+112,20,112,20,254,177,2,129,112,88,114,29,36,44,46,64,106,69,42,78,23,235,
+171,1,131,13,18,214,89,148,5,254,213,227,53,68,65,82,0,2,255,169,255,34,5,
+111,4,250,0,71,0,82,0,0,37,5,22,22,21,20,6,35,34,38,53,52,55,55,39,6,6,35,
+34,38,53,52,54,51,50,23,23,54,55,46,2,53,52,54,51,50,23,53,33,39,53,33,23,
+21,33,17,39,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,7,
+38,38,37,39,38,35,34,6,21,20,22,51,50,3,192,254,248,45,23,81,68,59,98,38,
+8,62,40,118,47,82,110,122,89,115,103,133,86,109,105,191,118,224,188,54,58,
+252,102,77,5,74,77,254,223,96,213,222,131,101,93,47,14,62,48,67,106,55,62,
+168,175,145,78,133,253,121,85,36,31,25,31,66,45,44,245,239,38,41,18,37,47,
+53,51,35,37,8,62,37,44,91,75,71,106,103,134,82,64,10,114,174,91,128,154,6,
+235,112,20,112,20,254,177,2,129,112,88,114,29,36,44,46,64,106,69,42,78,23,
+235,171,83,96,223,29,86,36,32,23,40,58,0,0,2,255,169,255,133,5,209,4,250,
+0,36,0,59,0,0,1,35,17,35,39,53,37,21,20,35,34,38,53,52,54,55,53,6,7,6,6,35,
+34,38,38,53,52,54,51,50,23,53,33,39,53,33,23,5,33,17,38,35,34,6,21,20,22,
+51,50,55,54,51,50,30,2,21,21,22,23,5,209,237,19,125,254,216,75,68,121,66,
+59,51,83,46,70,49,68,145,96,144,130,168,134,253,117,77,5,219,77,254,131,254,
+190,130,128,164,152,65,48,43,79,86,41,43,82,87,26,134,162,4,118,251,15,93,
+233,5,84,82,135,74,50,39,3,189,7,34,20,19,94,148,75,95,112,30,196,112,20,
+112,20,254,199,25,85,70,45,59,29,30,35,86,60,64,67,6,20,0,0,2,255,169,255,
+133,4,175,4,250,0,29,0,55,0,0,1,35,17,35,39,17,6,6,35,34,46,2,53,52,55,38,
+38,53,52,54,51,50,23,53,33,39,53,33,23,5,35,17,38,35,34,6,21,20,22,23,54,
+51,51,23,21,35,34,6,21,20,22,51,50,54,55,4,175,237,19,125,55,152,91,71,126,
+100,88,98,69,75,132,100,60,44,254,77,77,4,185,77,254,131,250,44,58,115,112,
+39,36,72,82,43,83,43,135,139,91,76,103,201,70,4,118,251,15,93,1,1,57,80,38,
+83,123,70,105,65,34,100,57,87,90,5,205,112,20,112,20,254,210,6,62,53,39,55,
+25,22,122,20,77,73,52,59,121,93,0,1,255,169,0,94,3,166,4,250,0,50,0,0,1,6,
+6,35,34,46,2,53,52,55,38,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,
+38,35,34,6,21,20,22,23,54,51,51,23,21,35,34,6,21,20,22,51,50,54,55,3,166,
+72,219,133,70,124,98,83,98,69,75,132,100,60,44,254,77,77,2,247,77,181,44,
+58,115,112,39,36,72,82,43,83,43,135,139,91,76,105,202,70,1,105,108,159,38,
+85,119,68,105,65,34,100,57,87,90,5,205,112,20,112,20,254,210,6,62,53,39,55,
+25,22,122,20,77,73,52,59,123,95,0,0,2,255,169,255,34,4,62,4,250,0,52,0,64,
+0,0,5,38,39,21,20,6,35,34,38,38,53,52,54,55,38,38,53,52,54,51,50,23,53,33,
+39,53,33,23,21,33,17,39,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,
+6,7,22,23,1,6,35,35,6,6,21,20,22,51,50,54,3,173,104,111,147,124,67,123,117,
+88,90,107,136,224,188,54,58,253,151,77,4,28,77,254,220,96,213,222,131,101,
+93,47,14,62,48,67,106,55,62,168,175,254,52,38,44,14,112,139,66,48,103,124,
+222,128,204,13,139,168,53,133,88,64,128,35,57,187,96,128,154,6,235,112,20,
+112,20,254,177,2,129,112,88,114,29,36,44,46,64,106,69,42,78,23,235,171,1,
+123,5,23,126,76,50,65,185,0,3,255,169,255,246,7,48,4,250,0,34,0,50,0,63,0,
+0,1,35,17,35,39,17,6,6,35,34,39,6,6,35,34,46,2,53,52,54,51,50,22,23,54,54,
+53,52,39,33,39,53,33,23,5,33,22,21,20,6,6,7,6,21,20,22,51,50,54,55,37,38,
+38,35,34,6,6,21,20,22,51,50,54,7,48,237,19,125,51,136,69,217,154,64,186,110,
+82,118,132,68,182,133,129,186,83,98,103,71,252,99,77,7,58,77,254,131,254,
+75,108,46,86,78,25,143,94,92,171,64,253,71,76,137,81,81,121,63,106,88,111,
+202,4,118,251,128,93,1,53,42,49,189,108,137,51,118,139,76,125,168,101,83,
+45,121,68,86,84,112,20,112,20,133,107,61,91,77,55,18,26,52,84,84,75,63,69,
+60,69,107,57,79,101,158,0,2,0,109,255,206,5,132,5,7,0,55,0,65,0,0,1,35,17,
+35,39,53,6,6,35,34,38,38,39,6,7,39,54,55,23,7,6,21,20,22,51,50,54,55,53,38,
+36,39,6,7,39,54,55,38,53,52,54,51,50,22,22,21,20,7,22,5,17,35,39,53,33,23,
+1,54,53,52,38,35,34,6,21,20,5,132,237,19,115,37,138,76,60,119,77,4,74,91,
+117,241,124,127,62,56,67,40,97,173,42,115,254,237,123,116,182,121,174,107,
+236,128,97,86,169,95,128,171,1,4,151,77,2,19,77,252,76,125,79,59,59,79,4,
+118,251,88,86,156,63,78,55,97,59,50,52,101,126,117,75,56,51,57,47,44,143,
+119,65,10,72,57,101,104,105,92,83,154,197,95,126,106,141,89,111,133,74,43,
+2,40,112,20,112,254,130,123,116,64,87,82,72,133,0,4,0,109,0,55,4,122,5,7,
+0,21,0,27,0,37,0,59,0,0,1,6,7,39,54,55,38,53,52,54,51,50,22,22,21,20,7,22,
+23,21,38,36,19,39,53,51,23,21,1,54,53,52,38,35,34,6,21,20,1,6,6,35,34,38,
+39,6,7,39,54,55,23,7,6,21,20,22,51,50,54,55,2,16,116,182,121,174,107,236,
+128,97,86,169,95,127,166,254,114,254,249,236,77,43,77,254,53,124,79,59,59,
+79,3,65,57,190,123,93,147,6,74,91,117,241,124,127,62,56,67,40,97,173,44,2,
+128,101,104,105,92,83,154,197,95,126,106,141,89,109,134,71,43,91,12,70,2,
+45,112,20,112,20,254,151,122,116,64,87,82,72,133,253,237,140,157,123,84,50,
+52,101,126,117,75,56,51,57,47,44,143,123,0,2,0,109,255,242,8,129,4,250,0,
+66,0,76,0,0,1,35,17,35,39,17,39,34,6,21,23,39,38,53,52,55,38,35,34,6,21,20,
+18,23,7,38,38,39,38,39,6,7,39,54,55,38,38,53,52,54,51,50,22,22,21,20,7,22,
+23,38,53,52,54,51,50,23,54,54,51,50,23,53,33,39,53,33,23,1,54,53,52,38,35,
+34,6,21,20,8,129,217,19,124,24,120,142,5,161,6,47,62,68,93,118,184,164,61,
+106,229,62,240,217,117,161,121,160,110,105,120,128,97,86,169,95,146,142,202,
+14,158,125,145,125,50,136,75,50,40,252,13,77,5,91,77,249,71,133,79,59,59,
+79,4,118,251,128,93,2,222,1,160,131,97,45,50,46,104,81,39,119,97,148,254,
+255,119,69,74,244,135,44,125,96,92,105,84,83,81,183,95,95,126,106,141,89,
+118,143,75,54,58,53,128,157,121,51,55,7,222,112,20,112,254,108,126,120,64,
+87,82,72,128,0,3,0,109,255,206,5,132,5,7,0,41,0,51,0,62,0,0,1,35,17,35,39,
+53,6,6,35,34,38,38,53,52,54,55,38,39,6,7,39,54,55,38,53,52,54,51,50,22,22,
+21,20,7,22,5,17,35,39,53,33,23,1,54,53,52,38,35,34,6,21,20,1,38,35,34,6,21,
+20,22,51,50,54,5,132,237,19,115,33,137,81,69,144,92,123,95,100,81,124,168,
+121,171,108,234,128,97,86,169,95,133,165,1,15,151,77,2,19,77,252,76,125,79,
+59,59,79,2,212,83,68,121,158,76,46,98,169,4,118,251,88,86,174,71,88,83,130,
+62,88,120,19,38,43,103,96,105,90,84,163,189,95,126,106,141,89,114,135,81,
+71,2,80,112,20,112,254,130,122,117,64,87,82,72,127,254,77,15,108,82,55,50,
+152,0,0,4,0,109,0,51,4,115,5,7,0,33,0,39,0,49,0,60,0,0,1,14,2,35,34,38,38,
+53,52,54,55,38,39,6,7,39,54,55,38,53,52,54,51,50,22,22,21,20,7,22,5,23,39,
+3,39,53,51,23,21,1,54,53,52,38,35,34,6,21,20,1,38,35,34,6,21,20,22,51,50,
+54,4,115,3,96,160,90,69,144,92,123,95,100,81,124,168,121,171,108,234,128,
+97,86,169,95,133,172,1,34,14,12,179,77,91,77,254,4,125,79,59,59,79,2,212,
+83,68,121,158,76,46,98,169,1,152,82,166,109,83,130,62,88,120,19,38,43,103,
+96,105,90,84,163,189,95,126,106,141,89,113,136,84,75,90,2,2,175,112,20,112,
+20,254,150,122,117,64,87,82,72,127,254,77,15,108,82,55,50,152,0,0,3,255,169,
+255,242,4,109,4,250,0,35,0,45,0,50,0,0,1,20,22,51,50,54,55,23,6,35,34,38,
+38,53,52,55,46,2,53,53,35,39,53,33,23,21,35,17,20,6,6,7,14,2,19,50,55,2,38,
+39,35,17,20,22,1,33,1,54,53,1,52,135,104,112,164,66,86,151,191,112,214,133,
+175,47,104,36,172,77,4,119,77,214,76,115,85,115,128,92,143,99,124,234,86,
+44,1,81,1,130,254,151,1,80,25,1,60,79,106,69,56,136,134,112,176,90,133,74,
+28,112,98,120,213,112,20,112,20,254,182,86,109,58,25,33,48,79,1,9,51,1,24,
+112,60,254,170,97,64,1,247,254,112,31,49,0,0,4,255,169,255,242,4,141,4,250,
+0,26,0,36,0,41,0,56,0,0,1,22,22,21,20,6,35,34,38,38,53,52,55,46,2,53,53,35,
+39,53,33,23,21,35,17,20,5,50,55,2,38,39,35,17,20,22,1,33,1,54,53,23,6,7,14,
+2,21,20,22,51,50,54,53,52,38,3,84,82,104,222,183,112,214,133,175,47,104,36,
+172,77,4,151,77,246,254,44,99,124,234,86,44,1,81,1,130,254,151,1,80,25,3,
+47,89,115,128,92,147,116,145,191,70,2,124,60,165,101,146,178,112,176,90,133,
+74,28,112,98,120,213,112,20,112,20,254,182,111,62,51,1,24,112,60,254,170,
+97,64,1,247,254,112,31,49,238,23,27,33,48,79,58,83,111,136,106,58,119,0,2,
+255,169,255,36,4,121,4,250,0,57,0,67,0,0,19,20,23,54,51,50,30,2,21,21,35,
+39,53,52,38,39,21,20,6,35,34,38,53,52,55,6,6,21,20,22,23,7,38,2,53,52,55,
+38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,6,5,21,20,51,50,
+54,53,17,39,34,252,51,97,119,95,151,161,80,19,120,54,48,76,62,71,165,29,67,
+78,197,168,49,210,249,99,116,172,139,171,155,253,6,77,4,131,77,253,157,179,
+163,141,1,11,61,32,24,43,38,2,170,62,41,54,51,134,134,94,246,90,232,51,87,
+30,227,100,77,143,76,110,85,34,118,82,124,207,54,75,69,1,24,165,136,95,97,
+112,114,111,16,199,112,20,112,20,254,203,14,90,251,251,90,42,38,1,8,3,0,1,
+255,169,255,36,4,81,4,250,0,63,0,0,19,20,23,54,51,50,30,2,21,21,35,39,53,
+39,7,22,21,20,6,35,34,38,53,52,54,51,50,23,38,38,35,34,6,21,20,22,23,7,38,
+2,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,6,252,
+50,92,105,107,170,144,46,19,114,104,52,7,32,34,64,111,62,65,122,139,12,145,
+101,132,166,197,168,49,210,249,99,116,172,139,125,156,253,51,77,4,91,77,253,
+156,140,163,141,2,170,61,42,54,77,153,108,75,246,85,170,2,1,47,42,33,42,116,
+63,44,55,25,84,109,151,121,124,207,54,75,69,1,24,165,134,97,97,112,114,111,
+16,199,112,20,112,20,254,203,14,90,0,2,255,169,255,36,5,181,4,250,0,47,0,
+66,0,0,1,35,17,35,39,53,38,35,7,21,20,6,35,34,38,53,52,54,55,53,52,38,35,
+34,6,21,20,22,23,7,38,2,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,5,
+33,17,38,35,34,6,21,20,23,54,51,50,30,2,23,22,23,5,181,237,19,121,95,87,43,
+34,34,64,111,54,56,88,74,128,162,194,172,49,210,249,98,115,172,139,99,115,
+253,118,77,5,191,77,254,131,254,217,102,127,163,141,49,89,102,89,124,110,
+40,3,112,110,4,118,251,18,90,228,5,2,62,32,43,116,63,41,53,4,18,69,77,149,
+119,126,202,54,75,69,1,24,165,138,94,96,112,114,111,12,195,112,20,112,20,
+254,207,10,90,75,61,41,49,59,117,73,43,10,20,0,2,255,169,255,40,5,171,4,250,
+0,40,0,65,0,0,1,35,17,35,39,53,6,35,34,3,54,54,53,52,38,35,34,6,21,20,22,
+23,7,38,2,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,5,33,17,38,35,34,
+6,21,20,23,54,51,50,22,21,20,6,7,6,21,20,22,51,50,55,5,171,237,19,121,101,
+145,248,122,131,122,71,50,138,178,194,172,49,210,249,97,114,172,139,99,115,
+253,118,77,5,181,77,254,131,254,227,102,127,163,141,48,93,113,139,196,88,
+91,25,66,49,187,131,4,118,250,216,90,196,97,1,29,43,66,42,30,42,154,124,126,
+202,54,75,69,1,24,165,136,93,95,112,114,111,12,195,112,20,112,20,254,207,
+10,90,75,59,42,52,160,90,57,80,37,10,15,20,27,152,0,1,255,169,255,36,4,104,
+4,250,0,78,0,0,19,20,23,54,51,50,30,2,21,21,35,39,53,52,39,35,34,6,21,23,
+39,39,52,55,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,23,54,51,23,38,38,
+35,34,6,21,20,22,23,7,38,2,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,
+21,35,17,38,35,34,6,252,48,91,118,99,154,164,62,19,120,4,7,50,56,2,116,2,
+18,21,25,40,56,103,32,95,95,89,73,76,63,43,68,36,31,124,83,139,169,197,168,
+49,210,249,97,114,172,139,160,156,253,16,77,4,114,77,246,160,166,163,141,
+2,170,58,43,52,62,150,143,83,246,90,206,30,23,69,66,44,32,34,58,40,6,49,48,
+86,61,61,53,129,69,71,84,51,37,4,66,74,147,125,124,207,54,75,69,1,24,165,
+140,93,95,112,114,111,16,199,112,20,112,20,254,203,14,90,0,0,2,255,169,255,
+36,4,74,4,250,0,59,0,72,0,0,19,20,23,54,51,50,30,2,21,21,35,39,53,6,35,34,
+38,38,53,52,54,51,50,23,38,38,35,34,6,21,20,22,23,7,38,2,53,52,55,38,53,52,
+54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,6,1,53,52,39,38,35,34,6,21,
+20,22,51,50,252,45,87,115,98,163,153,45,19,99,58,74,83,145,85,126,100,84,
+90,31,114,77,137,161,197,168,49,210,249,94,111,172,139,130,156,253,46,77,
+4,84,77,246,156,140,163,141,2,65,4,60,66,88,103,60,63,111,2,170,56,43,50,
+72,153,125,88,236,73,1,43,72,112,57,82,102,26,58,65,146,126,124,207,54,75,
+69,1,24,165,141,94,94,111,114,111,16,199,112,20,112,20,254,203,14,90,253,
+188,68,31,24,12,75,58,37,54,0,0,2,253,178,5,121,0,103,7,36,0,7,0,19,0,0,1,
+52,51,50,21,20,35,34,39,55,18,51,50,19,23,6,6,35,34,38,254,161,88,87,87,88,
+239,72,73,190,182,42,134,27,181,137,120,195,6,197,95,95,94,127,25,254,248,
+1,29,36,177,198,204,0,0,2,254,107,4,228,0,65,7,23,0,16,0,24,0,0,1,52,54,51,
+50,23,7,38,35,34,6,21,20,23,39,38,38,23,52,51,50,21,20,35,34,254,107,122,
+99,156,93,41,63,77,71,84,99,84,75,74,245,85,84,84,85,6,60,98,121,159,35,59,
+88,76,120,144,7,96,157,36,92,92,91,0,255,255,254,89,255,246,2,38,7,41,2,38,
+0,31,0,0,0,7,0,96,2,130,0,70,0,1,254,89,255,246,2,46,7,41,0,45,0,0,1,23,21,
+35,17,35,39,17,35,39,53,33,38,38,35,34,6,21,20,22,23,35,38,38,53,52,54,51,
+50,23,54,54,51,50,23,7,38,35,34,6,21,20,22,23,22,23,1,217,77,237,19,124,180,
+77,1,47,59,171,104,80,89,62,51,77,75,97,136,112,179,128,15,103,77,144,87,
+41,55,67,71,84,15,16,20,11,4,250,112,20,251,128,93,4,35,112,20,196,215,91,
+86,62,144,50,54,180,88,114,145,177,73,86,143,35,43,88,76,37,59,46,56,44,0,
+2,254,89,255,246,2,39,7,46,0,46,0,54,0,0,1,23,21,35,17,35,39,17,35,39,53,
+33,38,38,35,34,6,21,20,22,23,35,38,38,53,52,54,51,50,23,54,54,51,50,22,23,
+7,38,35,34,6,21,20,22,23,22,23,19,50,21,20,35,34,53,52,1,217,77,237,19,124,
+180,77,1,47,59,171,104,80,89,62,51,77,75,97,136,112,177,129,15,103,78,71,
+106,47,34,55,67,69,87,15,17,21,10,115,84,84,85,4,250,112,20,251,128,93,4,
+35,112,20,196,215,91,86,62,144,50,54,180,88,114,145,176,82,99,66,52,43,26,
+94,79,41,64,49,61,41,1,80,92,91,91,92,0,255,255,252,113,4,235,255,236,7,28,
+2,38,0,38,0,0,0,6,0,96,121,79,0,1,252,113,4,235,0,74,7,28,0,28,0,0,19,7,38,
+35,34,6,21,20,22,23,23,35,46,3,35,34,7,39,54,51,50,22,23,54,54,51,50,74,41,
+61,79,78,76,31,29,25,91,88,86,87,86,47,74,83,93,89,84,100,171,84,8,112,88,
+156,6,120,35,59,94,74,53,89,59,52,167,118,75,32,37,176,30,93,109,88,109,0,
+255,255,252,113,4,235,0,74,7,28,2,38,2,6,0,0,0,6,2,202,0,0,255,255,252,253,
+4,235,0,18,7,44,2,38,0,39,0,0,0,7,0,96,0,159,0,95,0,1,252,253,4,235,0,92,
+7,44,0,37,0,0,19,7,38,35,34,6,21,20,22,23,23,35,38,38,35,34,7,39,54,51,50,
+23,55,38,38,35,34,7,39,54,51,50,22,23,54,54,51,50,92,41,61,79,71,84,24,25,
+23,130,62,133,83,65,75,51,64,75,188,154,8,59,150,102,56,63,54,71,76,90,134,
+63,10,105,70,151,6,120,35,59,88,76,44,87,65,61,88,91,28,140,23,224,3,170,
+172,25,138,29,88,110,76,98,255,255,252,253,4,235,0,92,7,44,2,38,2,9,0,0,0,
+6,2,202,18,0,255,255,254,83,255,246,2,38,7,28,2,38,0,40,0,0,0,7,0,96,2,92,
+0,79,0,1,254,84,255,246,2,45,7,28,0,38,0,0,1,23,21,35,17,35,39,17,35,39,53,
+33,46,2,35,34,7,39,54,51,50,22,23,54,54,51,50,23,7,38,35,34,6,21,20,22,23,
+23,1,217,77,237,19,124,180,77,1,39,74,111,125,76,79,78,93,95,78,100,171,84,
+8,112,88,156,93,41,61,79,78,76,30,30,18,4,250,112,20,251,128,93,4,35,112,
+20,144,151,82,37,176,30,93,109,88,109,159,35,59,94,74,53,88,59,38,0,255,255,
+254,84,255,246,2,45,7,28,2,38,2,12,0,0,0,7,2,202,1,228,0,0,255,255,254,227,
+255,246,2,38,7,44,2,38,0,41,0,0,0,7,0,96,2,130,0,95,0,1,254,224,255,246,2,
+63,7,44,0,47,0,0,1,23,21,35,17,35,39,17,35,39,53,33,38,38,35,34,7,39,54,51,
+50,23,55,38,38,35,34,7,39,54,51,50,22,23,54,54,51,50,23,7,38,35,34,6,21,20,
+22,23,1,217,77,237,19,124,180,77,1,1,59,129,79,65,75,51,64,75,189,153,8,59,
+150,102,56,63,54,71,76,90,134,63,10,105,70,151,88,41,61,79,71,84,14,53,4,
+250,112,20,251,128,93,4,35,112,20,81,83,28,140,23,224,3,170,172,25,138,29,
+88,110,76,98,156,35,59,88,76,34,65,143,0,255,255,254,224,255,246,2,63,7,44,
+2,38,2,15,0,0,0,7,2,202,1,245,0,0,0,2,252,84,5,121,0,101,6,227,0,13,0,21,
+0,0,1,55,22,22,51,50,54,55,23,6,6,35,34,38,5,52,51,50,21,20,35,34,252,84,
+74,45,140,110,98,138,25,131,33,202,144,127,204,3,21,101,100,100,101,6,173,
+28,106,104,119,117,43,150,169,165,25,109,109,108,0,1,252,28,4,228,0,65,7,
+21,0,28,0,0,19,7,38,35,34,6,21,20,23,39,38,39,6,35,34,38,39,55,22,22,51,50,
+54,54,55,54,54,51,50,65,41,61,79,71,84,99,84,103,23,92,140,127,204,51,74,
+43,124,91,69,100,66,43,65,98,58,141,6,120,35,59,88,76,122,142,7,132,92,82,
+165,143,28,101,111,43,61,51,79,54,255,255,252,28,4,228,0,65,7,21,2,38,2,18,
+0,0,0,6,2,202,247,0,255,255,254,55,255,246,2,72,6,227,2,38,0,29,0,0,0,7,2,
+17,1,227,0,0,0,1,253,255,255,246,2,38,7,21,0,39,0,0,1,35,17,35,39,17,35,39,
+53,33,38,39,6,35,34,38,39,55,22,22,51,50,54,54,55,54,54,51,50,23,7,38,35,
+34,6,21,20,23,51,23,2,38,237,19,124,180,77,1,46,90,24,92,140,127,204,51,74,
+43,124,91,69,100,66,43,65,98,58,141,89,41,61,79,71,84,84,177,77,4,118,251,
+128,93,4,35,112,20,116,93,82,165,143,28,101,111,43,61,51,79,54,157,35,59,
+88,76,111,131,112,0,255,255,253,255,255,246,2,38,7,21,2,38,2,21,0,0,0,7,2,
+202,1,218,0,0,0,2,252,145,4,235,0,30,7,18,0,19,0,27,0,0,1,34,6,35,38,38,39,
+55,22,22,51,50,54,51,50,22,23,35,38,38,55,52,51,50,21,20,35,34,254,82,38,
+78,38,108,142,45,73,21,78,70,46,87,45,120,128,34,73,29,77,185,101,100,100,
+101,5,216,5,1,139,156,23,73,82,7,193,210,139,98,164,109,109,108,0,1,252,145,
+4,235,0,110,7,23,0,33,0,0,19,7,38,35,34,6,21,20,23,22,23,35,38,38,35,34,6,
+35,38,38,39,55,22,22,51,50,54,51,50,23,54,54,51,50,110,41,61,79,71,84,26,
+14,9,73,29,77,74,38,68,48,108,142,45,73,21,78,70,51,91,21,75,51,10,112,87,
+156,6,120,35,59,88,76,47,94,57,59,139,98,5,1,139,156,23,73,82,7,34,83,104,
+0,255,255,252,145,4,235,0,110,7,23,2,38,2,24,0,0,0,6,2,202,36,0,0,2,254,116,
+255,246,2,38,7,18,0,26,0,34,0,0,1,35,17,35,39,17,35,39,53,33,38,38,35,7,38,
+38,39,55,22,22,51,55,50,22,23,51,23,3,52,51,50,21,20,35,34,2,38,237,19,124,
+180,77,1,61,26,77,74,154,108,142,45,73,21,78,70,178,119,127,34,169,77,238,
+101,100,100,101,4,118,251,128,93,4,35,112,20,124,98,5,1,139,156,23,73,82,
+7,186,202,112,1,242,109,109,108,0,0,1,254,116,255,246,2,81,7,23,0,39,0,0,
+1,20,23,23,51,23,21,35,17,35,39,17,35,39,53,33,38,38,35,7,38,38,39,55,22,
+22,51,55,50,23,54,54,51,50,23,7,38,35,34,6,1,1,26,21,169,77,237,19,124,180,
+77,1,61,26,77,74,154,108,142,45,73,21,78,70,163,75,51,10,112,87,156,93,41,
+61,79,71,84,5,236,40,101,101,112,20,251,128,93,4,35,112,20,124,98,5,1,139,
+156,23,73,82,7,34,83,104,159,35,59,88,255,255,254,116,255,246,2,81,7,23,2,
+34,2,27,0,0,0,3,2,202,2,7,0,0,0,1,255,169,255,247,3,251,7,41,0,30,0,0,55,
+17,35,39,53,33,38,38,53,52,54,51,50,22,18,23,7,38,2,35,34,6,21,20,23,51,23,
+21,35,17,35,169,179,77,1,30,50,59,183,143,157,247,159,40,80,65,248,149,113,
+132,46,195,77,238,18,84,4,34,112,20,51,141,70,131,166,189,254,243,133,37,
+224,1,3,130,114,87,83,112,20,251,129,0,0,1,255,169,255,247,4,121,7,41,0,30,
+0,0,55,17,35,39,53,33,38,38,53,52,54,51,50,4,18,23,7,38,0,35,34,6,21,20,23,
+51,23,21,35,17,35,169,179,77,1,30,50,59,192,150,169,1,30,199,59,78,100,254,
+206,166,120,143,46,195,77,238,18,84,4,34,112,20,51,141,70,131,166,187,254,
+244,134,39,226,1,1,134,110,87,83,112,20,251,129,0,0,1,255,169,255,247,4,248,
+7,41,0,30,0,0,55,17,35,39,53,33,38,38,53,52,54,51,50,4,18,23,7,38,0,35,34,
+6,21,20,23,51,23,21,35,17,35,169,179,77,1,30,50,59,203,156,182,1,67,238,80,
+76,136,254,150,186,125,155,46,195,77,238,18,84,4,34,112,20,51,141,70,131,
+166,187,254,248,136,41,226,1,1,135,109,87,83,112,20,251,129,0,0,1,255,169,
+255,247,5,118,7,41,0,30,0,0,55,17,35,39,53,33,38,38,53,52,54,51,50,4,0,23,
+7,38,36,35,34,6,21,20,23,51,23,21,35,17,35,169,179,77,1,30,50,59,211,164,
+195,1,105,1,21,100,74,176,254,97,203,132,166,46,195,77,238,18,84,4,34,112,
+20,51,141,70,132,165,186,254,250,137,43,231,251,134,109,87,83,112,20,251,
+129,0,0,1,255,169,255,247,5,245,7,41,0,30,0,0,55,17,35,39,53,33,38,38,53,
+52,54,51,50,4,0,23,7,38,0,35,34,6,21,20,23,51,23,21,35,17,35,169,179,77,1,
+30,50,59,219,172,208,1,143,1,60,121,73,188,254,40,245,137,178,46,195,77,238,
+18,84,4,34,112,20,51,141,70,132,165,184,254,251,138,45,206,1,20,134,109,87,
+83,112,20,251,129,0,1,255,169,255,247,6,115,7,41,0,31,0,0,55,17,35,39,53,
+33,38,38,53,52,54,54,51,50,4,0,23,7,38,0,33,34,6,21,20,23,51,23,21,35,17,
+35,169,179,77,1,30,50,59,117,187,104,220,1,181,1,99,141,71,220,253,238,254,
+247,147,186,46,195,77,238,18,84,4,34,112,20,51,141,70,98,134,65,183,254,252,
+138,47,206,1,20,134,109,87,83,112,20,251,129,0,1,255,169,255,247,6,242,7,
+41,0,31,0,0,55,17,35,39,53,33,38,38,53,52,54,54,51,32,0,5,7,36,0,33,34,6,
+6,21,20,23,51,23,21,35,17,35,170,180,77,1,29,49,59,124,194,106,1,80,2,148,
+1,12,69,255,0,253,183,254,226,85,160,104,46,194,77,237,19,84,4,34,112,20,
+51,141,70,101,133,63,254,162,228,50,207,1,19,50,110,83,90,80,112,20,251,129,
+0,1,255,169,255,247,7,112,7,41,0,31,0,0,55,17,35,39,53,33,38,38,53,52,54,
+54,51,32,0,5,7,36,0,33,34,6,6,21,20,23,51,23,21,35,17,35,170,180,77,1,29,
+49,59,130,201,110,1,98,2,206,1,45,67,254,224,253,125,254,206,87,167,113,46,
+194,77,237,19,84,4,34,112,20,51,141,70,103,133,61,254,165,229,52,207,1,19,
+48,109,86,90,80,112,20,251,129,0,1,255,169,255,247,7,239,7,41,0,31,0,0,55,
+17,35,39,53,33,38,38,53,52,54,54,51,32,0,5,7,36,0,33,34,6,6,21,20,23,51,23,
+21,35,17,35,170,180,77,1,29,49,59,137,208,112,1,116,3,8,1,80,66,254,189,253,
+70,254,185,88,175,121,46,194,77,237,19,84,4,34,112,20,51,141,70,105,134,58,
+254,167,229,54,208,1,18,45,109,89,90,80,112,20,251,129,0,1,255,169,255,247,
+8,109,7,41,0,31,0,0,55,17,35,39,53,33,38,38,53,52,54,54,51,32,0,5,7,36,0,
+33,34,6,6,21,20,23,51,23,21,35,17,35,170,180,77,1,29,49,59,144,214,115,1,
+135,3,66,1,113,64,254,155,253,14,254,165,91,182,129,46,194,77,237,19,84,4,
+34,112,20,51,141,70,108,133,56,254,169,229,56,208,1,17,42,108,92,90,80,112,
+20,251,129,0,1,255,169,255,247,8,236,7,41,0,31,0,0,55,17,35,39,53,33,38,38,
+53,52,54,54,51,32,0,5,7,36,0,33,34,6,6,21,20,23,51,23,21,35,17,35,170,180,
+77,1,29,49,59,150,221,119,1,153,3,121,1,150,62,254,118,252,215,254,145,94,
+188,137,46,194,77,237,19,84,4,34,112,20,51,141,70,110,133,54,254,172,230,
+58,208,1,17,39,108,95,90,80,112,20,251,129,0,1,255,169,255,247,9,106,7,41,
+0,30,0,0,55,17,35,39,53,33,38,38,53,52,54,54,51,32,0,5,7,36,0,33,34,4,21,
+20,23,51,23,21,35,17,35,170,180,77,1,29,49,59,156,228,122,1,172,3,180,1,182,
+60,254,82,252,161,254,125,164,254,239,46,194,77,237,19,84,4,34,112,20,51,
+141,70,113,132,52,254,173,229,60,209,1,16,101,141,90,80,112,20,251,129,255,
+255,255,169,255,247,4,190,7,41,2,38,2,29,0,0,0,7,0,96,5,75,0,15,255,255,255,
+169,255,247,5,53,7,41,2,38,2,30,0,0,0,7,0,96,5,194,0,10,255,255,255,169,255,
+247,5,172,7,41,2,38,2,31,0,0,0,7,0,96,6,57,0,5,255,255,255,169,255,247,6,
+34,7,41,2,38,2,32,0,0,0,7,0,96,6,175,255,255,255,255,255,169,255,247,6,153,
+7,41,2,38,2,33,0,0,0,7,0,96,7,38,255,250,255,255,255,169,255,247,7,16,7,41,
+2,38,2,34,0,0,0,7,0,96,7,157,255,245,255,255,255,169,255,247,7,135,7,41,2,
+38,2,35,0,0,0,7,0,96,8,20,255,240,255,255,255,169,255,247,7,254,7,41,2,38,
+2,36,0,0,0,7,0,96,8,139,255,235,255,255,255,169,255,247,8,117,7,41,2,38,2,
+37,0,0,0,7,0,96,9,2,255,230,255,255,255,169,255,247,8,235,7,41,2,38,2,38,
+0,0,0,7,0,96,9,120,255,224,255,255,255,169,255,247,9,98,7,41,2,38,2,39,0,
+0,0,7,0,96,9,239,255,219,255,255,255,169,255,247,9,217,7,41,2,38,2,40,0,0,
+0,7,0,96,10,102,255,214,0,1,255,169,255,247,5,1,7,41,0,43,0,0,1,7,38,35,34,
+6,21,20,23,23,7,38,2,35,34,6,21,20,23,51,23,21,35,17,35,39,17,35,39,53,33,
+38,38,53,52,54,51,50,22,23,54,54,51,50,5,1,41,61,79,71,84,50,24,80,65,248,
+149,113,132,46,195,77,238,18,125,179,77,1,30,50,59,183,143,108,220,85,6,117,
+80,156,6,110,35,59,88,76,70,127,67,37,224,1,3,130,114,87,83,112,20,251,129,
+93,4,34,112,20,51,141,70,131,166,112,112,100,96,0,0,1,255,169,255,247,5,125,
+7,41,0,44,0,0,1,7,38,35,34,6,21,20,23,23,7,38,0,35,34,6,21,20,23,51,23,21,
+35,17,35,39,17,35,39,53,33,38,38,53,52,54,51,50,4,23,39,52,54,51,50,5,125,
+41,61,79,71,84,54,22,78,100,254,206,166,120,143,46,195,77,238,18,125,179,
+77,1,30,50,59,192,150,135,1,24,105,1,111,94,156,6,112,35,59,88,76,70,134,
+60,39,226,1,1,134,110,87,83,112,20,251,129,93,4,34,112,20,51,141,70,131,166,
+136,129,24,99,116,0,0,1,255,169,255,247,5,249,7,41,0,45,0,0,1,7,38,35,34,
+6,21,20,22,23,7,38,0,35,34,6,21,20,23,51,23,21,35,17,35,39,17,35,39,53,33,
+38,38,53,52,54,51,50,4,23,38,53,52,54,51,50,5,249,41,61,79,71,84,19,60,76,
+136,254,150,186,125,155,46,195,77,238,18,125,179,77,1,30,50,59,203,156,170,
+1,84,123,9,114,93,156,6,114,35,59,88,76,37,76,151,41,226,1,1,135,109,87,83,
+112,20,251,129,93,4,34,112,20,51,141,70,131,166,164,141,33,32,100,116,0,0,
+1,255,169,255,247,6,118,7,41,0,45,0,0,1,7,38,35,34,6,21,20,22,23,7,38,36,
+35,34,6,21,20,23,51,23,21,35,17,35,39,17,35,39,53,33,38,38,53,52,54,51,50,
+4,23,38,53,52,54,51,50,6,118,41,61,79,71,84,28,52,74,176,254,97,203,132,166,
+46,195,77,238,18,125,179,77,1,30,50,59,211,164,197,1,151,148,21,114,95,156,
+6,116,35,59,88,76,46,95,123,43,231,251,134,109,87,83,112,20,251,129,93,4,
+34,112,20,51,141,70,132,165,186,158,58,48,99,117,0,1,255,169,255,247,6,242,
+7,41,0,45,0,0,1,7,38,35,34,6,21,20,22,23,7,38,0,35,34,6,21,20,23,51,23,21,
+35,17,35,39,17,35,39,53,33,38,38,53,52,54,51,50,4,23,38,53,52,54,51,50,6,
+242,41,61,79,71,84,32,51,73,188,254,40,245,137,178,46,195,77,238,18,125,179,
+77,1,30,50,59,219,172,224,1,222,172,36,116,94,156,6,118,35,59,88,76,43,109,
+112,45,206,1,20,134,109,87,83,112,20,251,129,93,4,34,112,20,51,141,70,132,
+165,208,172,75,69,100,116,0,0,1,255,169,255,247,7,110,7,41,0,46,0,0,1,7,38,
+35,34,6,21,20,22,23,7,38,0,33,34,6,21,20,23,51,23,21,35,17,35,39,17,35,39,
+53,33,38,38,53,52,54,54,51,50,4,23,38,53,52,54,51,50,7,110,41,61,79,71,84,
+45,40,71,220,253,238,254,247,147,186,46,195,77,238,18,125,179,77,1,30,50,
+59,117,187,104,247,2,34,202,52,116,96,156,6,120,35,59,88,76,59,121,84,47,
+206,1,20,134,109,87,83,112,20,251,129,93,4,34,112,20,51,141,70,98,134,65,
+226,185,93,84,98,118,0,0,1,255,169,255,247,7,234,7,41,0,47,0,0,1,7,38,35,
+34,6,21,20,22,23,7,36,0,33,34,6,6,21,20,23,51,23,21,35,17,35,39,17,35,39,
+53,33,38,38,53,52,54,54,51,32,4,23,38,53,52,54,51,50,7,234,41,61,79,71,84,
+49,39,69,255,0,253,183,254,226,85,160,104,46,194,77,237,19,124,180,77,1,29,
+49,59,124,194,106,1,13,2,107,228,66,117,96,156,6,123,35,59,88,76,60,130,74,
+50,207,1,19,50,110,83,90,80,112,20,251,129,93,4,34,112,20,51,141,70,101,133,
+63,242,193,104,98,99,119,0,1,255,169,255,247,8,102,7,41,0,46,0,0,1,7,38,35,
+34,6,21,20,23,7,36,0,33,34,6,6,21,20,23,51,23,21,35,17,35,39,17,35,39,53,
+33,38,38,53,52,54,54,51,32,4,5,38,53,52,54,51,50,8,102,41,61,79,71,84,90,
+67,254,224,253,125,254,206,87,167,113,46,194,77,237,19,124,180,77,1,29,49,
+59,130,201,110,1,32,2,163,1,14,78,118,97,156,6,125,35,59,88,76,102,162,52,
+207,1,19,48,109,86,90,80,112,20,251,129,93,4,34,112,20,51,141,70,103,133,
+61,249,205,116,107,98,120,0,1,255,169,255,247,8,226,7,41,0,46,0,0,1,7,38,
+35,34,6,21,20,23,7,36,0,33,34,6,6,21,20,23,51,23,21,35,17,35,39,17,35,39,
+53,33,38,38,53,52,54,54,51,32,0,5,38,53,52,54,51,50,8,226,41,61,79,71,84,
+93,66,254,189,253,70,254,185,88,175,121,46,194,77,237,19,124,180,77,1,29,
+49,59,137,208,112,1,48,2,223,1,56,89,119,97,156,6,127,35,59,88,76,108,156,
+54,208,1,18,45,109,89,90,80,112,20,251,129,93,4,34,112,20,51,141,70,105,134,
+58,254,254,213,125,117,99,119,0,0,1,255,169,255,247,9,95,7,41,0,46,0,0,1,
+7,38,35,34,6,21,20,23,7,36,0,33,34,6,6,21,20,23,51,23,21,35,17,35,39,17,35,
+39,53,33,38,38,53,52,54,54,51,32,0,5,38,53,52,54,51,50,9,95,41,61,79,71,84,
+94,64,254,155,253,14,254,165,91,182,129,46,194,77,237,19,124,180,77,1,29,
+49,59,144,214,115,1,60,3,19,1,104,94,120,98,156,6,129,35,59,88,76,113,151,
+56,208,1,17,42,108,92,90,80,112,20,251,129,93,4,34,112,20,51,141,70,108,133,
+56,254,253,223,133,122,98,120,0,0,1,255,169,255,247,9,219,7,41,0,46,0,0,1,
+7,38,35,34,6,21,20,23,7,36,0,33,34,6,6,21,20,23,51,23,21,35,17,35,39,17,35,
+39,53,33,38,38,53,52,54,54,51,32,0,5,38,53,52,54,51,50,9,219,41,61,79,71,
+84,97,62,254,118,252,215,254,145,94,188,137,46,194,77,237,19,124,180,77,1,
+29,49,59,150,221,119,1,69,3,54,1,174,103,122,98,156,6,131,35,59,88,76,117,
+147,58,208,1,17,39,108,95,90,80,112,20,251,129,93,4,34,112,20,51,141,70,110,
+133,54,255,0,239,143,126,98,121,0,0,1,255,169,255,247,10,87,7,41,0,45,0,0,
+1,7,38,35,34,6,21,20,23,7,36,0,33,34,4,21,20,23,51,23,21,35,17,35,39,17,35,
+39,53,33,38,38,53,52,54,54,51,32,0,5,38,53,52,54,51,50,10,87,41,61,79,71,
+84,99,60,254,82,252,161,254,125,164,254,239,46,194,77,237,19,124,180,77,1,
+29,49,59,156,228,122,1,136,3,108,1,163,106,122,99,156,6,133,35,59,88,76,120,
+144,60,209,1,16,101,141,90,80,112,20,251,129,93,4,34,112,20,51,141,70,113,
+132,52,254,219,210,148,131,98,121,0,255,255,255,169,255,247,5,1,7,41,2,38,
+2,53,0,0,0,7,2,202,4,168,255,246,255,255,255,169,255,247,5,125,7,41,2,38,
+2,54,0,0,0,7,2,202,5,38,255,248,255,255,255,169,255,247,5,249,7,41,2,38,2,
+55,0,0,0,7,2,202,5,163,255,250,255,255,255,169,255,247,6,118,7,41,2,38,2,
+56,0,0,0,7,2,202,6,33,255,252,255,255,255,169,255,247,6,242,7,41,2,38,2,57,
+0,0,0,7,2,202,6,158,255,254,255,255,255,169,255,247,7,110,7,41,2,38,2,58,
+0,0,0,7,2,202,7,28,0,0,255,255,255,169,255,247,7,234,7,41,2,38,2,59,0,0,0,
+7,2,202,7,153,0,3,255,255,255,169,255,247,8,102,7,41,2,38,2,60,0,0,0,7,2,
+202,8,23,0,5,255,255,255,169,255,247,8,226,7,41,2,38,2,61,0,0,0,7,2,202,8,
+148,0,7,255,255,255,169,255,247,9,95,7,41,2,38,2,62,0,0,0,7,2,202,9,18,0,
+9,255,255,255,169,255,247,9,219,7,41,2,38,2,63,0,0,0,7,2,202,9,143,0,11,255,
+255,255,169,255,247,10,87,7,41,2,38,2,64,0,0,0,7,2,202,10,13,0,13,0,1,253,
+233,255,246,2,38,7,41,0,30,0,0,1,35,17,35,39,17,35,39,53,33,38,38,35,34,6,
+21,20,22,23,35,38,38,53,52,54,51,50,0,23,51,23,2,38,237,19,124,180,77,1,46,
+61,209,154,89,101,62,51,77,75,97,159,128,218,1,0,76,171,77,4,118,251,128,
+93,4,35,112,20,166,245,94,83,62,144,50,54,180,88,115,144,254,182,229,112,
+0,0,1,253,133,255,246,2,38,7,40,0,32,0,0,1,35,17,35,39,17,35,39,53,33,46,
+2,35,34,6,21,20,22,23,35,38,38,53,52,54,51,50,22,22,23,51,23,2,38,237,19,
+124,180,77,1,46,42,149,200,111,99,113,61,52,77,75,97,168,136,141,245,185,
+61,172,77,4,118,251,128,93,4,35,112,20,95,188,127,94,82,63,143,50,54,180,
+88,115,143,155,253,150,112,0,1,252,137,255,246,2,38,7,40,0,31,0,0,1,35,17,
+35,39,17,35,39,53,33,38,36,35,34,6,21,20,22,23,35,38,38,53,52,54,51,50,4,
+4,23,51,23,2,38,237,19,124,180,77,1,42,150,254,125,176,117,132,61,52,77,73,
+99,190,151,169,1,69,1,6,89,174,77,4,118,251,128,93,4,35,112,20,186,224,102,
+89,59,135,47,49,174,84,121,152,165,255,138,112,0,255,255,253,233,255,246,
+2,38,7,41,2,38,2,77,0,0,0,7,0,96,2,128,0,100,255,255,253,133,255,246,2,38,
+7,40,2,38,2,78,0,0,0,7,0,96,2,98,0,100,255,255,252,137,255,246,2,38,7,40,
+2,38,2,79,0,0,0,7,0,96,2,38,0,100,0,1,253,233,255,246,2,59,7,41,0,45,0,0,
+1,23,21,35,17,35,39,17,35,39,53,33,38,38,35,34,6,21,20,22,23,35,38,38,53,
+52,54,51,50,22,23,54,54,51,50,23,7,38,35,34,6,21,20,22,23,23,1,217,77,237,
+19,124,180,77,1,46,61,209,154,89,101,62,51,77,75,97,159,128,114,192,66,13,
+111,85,146,92,41,61,79,71,84,24,23,20,4,250,112,20,251,128,93,4,35,112,20,
+166,245,94,83,62,144,50,54,180,88,115,144,111,87,78,101,158,35,59,88,76,43,
+84,60,55,0,1,253,133,255,246,2,50,7,40,0,44,0,0,1,23,21,35,17,35,39,17,35,
+39,53,33,46,2,35,34,6,21,20,22,23,35,38,38,53,52,54,51,50,23,54,54,51,50,
+23,7,38,35,34,6,21,20,22,23,1,217,77,237,19,124,180,77,1,46,42,149,200,111,
+99,113,61,52,77,75,97,168,136,233,192,10,117,92,156,93,41,61,79,71,84,34,
+41,4,250,112,20,251,128,93,4,35,112,20,95,188,127,94,82,63,143,50,54,180,
+88,115,143,215,88,110,159,35,59,88,76,49,102,91,0,1,252,137,255,246,2,38,
+7,40,0,45,0,0,1,23,21,35,17,35,39,17,35,39,53,33,38,36,35,34,6,21,20,22,23,
+35,38,38,53,52,54,51,50,4,23,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,1,
+217,77,237,19,124,180,77,1,42,150,254,125,176,117,132,61,52,77,73,99,190,
+151,169,1,68,139,6,122,99,156,93,41,61,79,71,84,84,4,250,112,20,251,128,93,
+4,35,112,20,186,224,102,89,59,135,47,49,174,84,121,152,165,135,32,32,98,121,
+159,35,59,88,76,111,131,255,255,253,233,255,246,2,59,7,41,2,38,2,83,0,0,0,
+7,2,202,1,241,0,0,255,255,253,133,255,246,2,50,7,40,2,38,2,84,0,0,0,7,2,202,
+1,232,0,0,255,255,252,137,255,246,2,38,7,40,2,38,2,85,0,0,0,7,2,202,1,220,
+0,0,255,255,255,169,254,215,3,219,7,23,2,38,0,7,0,0,0,7,2,202,3,97,0,0,255,
+255,255,169,254,194,4,81,7,28,2,38,0,15,0,0,0,7,0,96,4,146,0,79,255,255,0,
+20,255,246,7,140,7,28,2,38,0,16,0,0,0,7,0,96,7,190,0,79,255,255,0,20,255,
+246,7,140,7,44,2,38,0,17,0,0,0,7,0,96,7,224,0,95,255,255,0,20,255,246,5,203,
+6,227,2,38,0,4,0,0,0,7,2,17,5,102,0,0,255,255,255,169,254,194,4,156,6,227,
+2,38,0,14,0,0,0,7,2,17,4,55,0,0,255,255,0,20,255,246,7,250,6,227,2,38,0,5,
+0,0,0,7,2,17,7,149,0,0,255,255,0,20,255,246,5,169,7,18,2,38,0,21,0,0,0,7,
+0,96,6,14,0,79,255,255,255,169,254,194,4,81,7,18,2,38,0,22,0,0,0,7,0,96,4,
+197,0,79,255,255,0,20,255,246,7,140,7,18,2,38,0,23,0,0,0,7,0,96,7,241,0,79,
+255,255,255,169,254,178,3,219,7,23,2,38,0,7,0,0,0,39,2,202,3,96,0,0,0,7,0,
+100,2,221,0,40,255,255,255,169,254,194,4,81,7,28,2,38,0,15,0,0,0,39,0,96,
+4,146,0,79,0,7,0,100,3,216,0,176,255,255,0,20,255,79,7,140,7,28,2,38,0,16,
+0,0,0,39,0,96,7,190,0,79,0,7,0,100,3,239,0,197,255,255,0,20,255,79,7,140,
+7,44,2,38,0,17,0,0,0,39,0,96,7,224,0,95,0,7,0,100,3,239,0,197,255,255,0,20,
+255,79,5,203,6,227,2,38,0,4,0,0,0,39,2,17,5,102,0,0,0,7,0,100,3,239,0,197,
+255,255,255,169,254,194,4,156,6,227,2,38,0,14,0,0,0,39,2,17,4,55,0,0,0,7,
+0,100,3,216,0,176,255,255,0,20,255,79,7,250,6,227,2,38,0,5,0,0,0,39,2,17,
+7,149,0,0,0,7,0,100,3,239,0,197,255,255,0,20,255,79,5,169,7,18,2,38,0,21,
+0,0,0,39,0,96,6,14,0,79,0,7,0,100,3,239,0,197,255,255,255,169,254,194,4,81,
+7,18,2,38,0,22,0,0,0,39,0,96,4,197,0,79,0,7,0,100,3,216,0,176,255,255,0,20,
+255,79,7,140,7,18,2,38,0,23,0,0,0,39,0,96,7,241,0,79,0,7,0,100,3,239,0,197,
+0,1,255,169,253,219,4,13,4,250,0,67,0,0,1,20,6,35,34,36,39,55,22,22,51,50,
+54,53,52,35,34,6,7,39,54,55,39,6,35,34,38,38,53,52,54,51,50,23,17,33,39,53,
+33,23,21,33,17,39,34,6,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,6,7,22,
+23,30,2,4,13,171,142,167,254,230,122,95,97,205,124,102,150,102,46,87,59,95,
+102,90,84,39,72,118,213,130,227,185,54,58,253,161,77,3,239,77,254,255,96,
+204,231,130,102,93,47,14,62,48,68,105,55,62,47,93,59,65,40,254,226,119,144,
+202,160,81,155,182,135,91,98,32,42,124,66,5,142,11,116,201,107,144,180,6,
+1,11,112,20,112,20,254,145,2,151,132,100,130,29,36,44,46,64,105,70,41,78,
+24,61,99,62,80,94,0,1,255,169,253,207,5,34,4,250,0,72,0,0,1,7,46,2,35,34,
+6,21,20,22,51,50,54,55,23,6,6,35,34,38,38,53,52,54,51,23,38,39,6,35,34,38,
+38,53,52,54,51,50,23,17,33,39,53,33,23,21,33,17,39,34,6,21,20,22,51,50,55,
+38,53,52,54,51,50,22,21,20,6,7,22,22,23,23,5,34,89,122,138,136,65,93,103,
+64,55,53,97,65,49,57,82,51,67,146,113,151,119,26,50,36,39,72,118,213,130,
+227,185,54,58,253,161,77,3,239,77,254,255,96,204,231,130,102,93,47,14,62,
+48,68,105,55,62,26,111,96,105,254,12,61,161,165,102,92,79,64,67,27,45,146,
+25,21,89,146,80,104,137,1,79,65,11,116,201,107,144,180,6,1,11,112,20,112,
+20,254,145,2,151,132,100,130,29,36,44,46,64,105,70,41,78,24,42,122,102,113,
+0,1,255,169,253,197,4,194,4,250,0,60,0,0,1,6,35,34,38,38,53,52,55,39,6,35,
+34,38,38,53,52,54,51,50,23,17,33,39,53,33,23,21,33,17,39,34,6,21,20,22,51,
+50,55,38,53,52,54,51,50,22,21,20,6,7,22,23,6,6,21,20,22,51,50,54,55,4,194,
+156,143,82,167,103,191,113,39,72,118,213,130,227,185,54,58,253,161,77,3,239,
+77,254,255,96,204,231,130,102,93,47,14,62,48,68,105,55,62,77,169,147,148,
+104,74,78,168,44,254,12,71,88,136,73,144,85,189,11,116,201,107,144,180,6,
+1,11,112,20,112,20,254,145,2,151,132,100,130,29,36,44,46,64,105,70,41,78,
+24,122,152,48,101,70,58,60,49,28,255,255,255,169,253,219,4,13,4,250,2,38,
+2,109,0,0,0,7,0,100,2,140,1,80,255,255,255,169,253,207,5,34,4,250,2,38,2,
+110,0,0,0,7,0,100,3,4,0,226,255,255,255,169,253,197,4,194,4,250,0,38,2,111,
+0,0,0,7,0,100,3,4,0,226,0,1,255,169,255,236,4,123,4,250,0,49,0,0,1,33,22,
+21,7,54,51,50,23,22,22,21,20,6,7,39,54,54,53,52,38,35,34,6,6,7,6,7,22,5,7,
+38,0,53,52,54,51,50,22,23,54,54,53,52,39,33,39,53,33,23,4,123,253,164,64,
+2,60,54,139,101,42,27,147,109,109,104,145,78,59,45,82,82,115,77,103,122,1,
+30,114,192,254,225,58,47,45,60,40,70,74,46,254,68,77,4,133,77,4,118,134,134,
+34,25,126,53,84,48,88,162,24,118,23,126,65,57,73,25,49,98,65,46,180,182,117,
+163,1,157,116,55,65,38,42,32,130,74,111,83,112,20,112,0,0,1,255,169,255,236,
+4,167,4,250,0,53,0,0,1,33,22,21,21,54,51,50,22,23,7,38,38,35,34,6,21,20,22,
+51,50,54,55,23,6,6,35,34,38,39,6,7,22,5,7,38,0,53,52,54,51,50,22,23,54,54,
+53,52,39,33,39,53,33,23,4,167,253,120,64,39,45,146,240,53,95,48,160,85,73,
+106,45,31,35,80,23,126,29,111,52,79,151,31,74,105,122,1,30,114,192,254,225,
+58,47,45,60,40,70,74,46,254,68,77,4,177,77,4,118,134,134,4,9,238,200,36,179,
+152,82,61,38,42,46,53,84,67,66,102,73,64,47,180,182,117,163,1,157,116,55,
+65,38,42,32,130,74,111,83,112,20,112,255,255,255,169,255,222,4,123,4,250,
+2,38,2,115,0,0,0,7,0,100,2,168,1,84,255,255,255,169,255,222,4,167,4,250,2,
+38,2,116,0,0,0,7,0,100,2,168,1,84,0,1,255,169,253,161,3,242,4,250,0,72,0,
+0,19,20,23,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,23,54,51,
+50,22,22,21,20,6,35,34,36,39,55,22,22,51,50,54,53,52,35,34,6,7,39,38,38,53,
+52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,6,252,50,95,
+112,167,215,55,61,136,119,100,74,136,170,105,118,73,70,73,134,83,171,142,
+167,254,230,122,95,97,205,124,102,150,102,46,87,59,65,159,173,99,116,172,
+139,99,115,253,118,77,3,252,77,225,102,127,163,141,2,170,59,44,54,213,115,
+68,105,61,96,98,100,70,70,154,122,87,163,65,38,82,142,72,119,144,202,160,
+81,155,182,135,91,98,32,42,84,81,237,143,134,97,97,112,114,111,12,195,112,
+20,112,20,254,207,10,90,0,1,255,169,253,158,3,242,4,250,0,78,0,0,19,20,23,
+54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,22,23,30,2,23,23,7,
+46,2,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,38,53,52,54,55,38,38,53,
+52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,6,252,50,95,
+112,167,215,55,61,136,119,100,74,136,170,61,90,78,123,91,112,51,115,89,122,
+138,136,65,93,103,64,55,53,97,65,49,57,82,51,67,146,113,118,97,99,104,99,
+116,172,139,99,115,253,118,77,3,252,77,225,102,127,163,141,2,170,59,44,54,
+213,115,68,105,61,96,98,100,70,70,154,122,65,99,71,50,79,90,128,62,134,61,
+161,165,102,92,79,64,67,27,45,146,25,21,89,146,80,85,127,16,67,181,107,134,
+97,97,112,114,111,12,195,112,20,112,20,254,207,10,90,0,0,1,255,169,254,223,
+3,242,4,250,0,71,0,0,19,20,23,54,51,50,22,22,21,20,6,7,6,6,21,20,22,51,50,
+54,55,23,6,6,35,34,46,2,53,52,54,54,55,54,54,53,52,38,35,34,6,21,20,22,5,
+7,36,0,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,
+6,252,50,95,112,82,158,110,59,86,57,54,60,52,43,113,34,102,40,113,52,72,97,
+118,56,43,59,50,55,52,77,57,136,170,233,1,12,49,254,226,254,200,99,116,172,
+139,99,115,253,118,77,3,252,77,225,102,127,163,141,2,170,59,44,54,81,137,
+57,41,64,39,25,41,31,34,37,48,35,105,49,57,36,79,86,48,40,57,35,23,24,38,
+29,38,54,154,122,130,235,78,75,88,1,50,189,134,97,97,112,114,111,12,195,112,
+20,112,20,254,207,10,90,0,0,1,255,169,254,212,4,37,4,250,0,83,0,0,5,6,35,
+34,38,38,53,52,55,38,38,53,52,54,54,55,54,54,53,52,38,35,34,6,21,20,22,23,
+7,38,38,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,
+6,21,20,23,54,51,50,22,22,21,20,6,7,6,6,21,20,22,23,54,55,23,6,6,21,20,22,
+51,50,54,55,4,37,115,107,53,115,75,8,64,81,43,59,50,55,52,77,57,136,170,111,
+123,46,161,173,99,116,172,139,99,115,253,118,77,3,252,77,225,102,127,163,
+141,50,95,112,82,158,110,59,85,60,57,26,23,63,150,66,104,114,38,30,55,131,
+33,230,70,70,107,47,28,27,27,103,58,40,57,35,23,24,38,29,38,54,154,122,89,
+173,72,74,90,241,142,134,97,97,112,114,111,12,195,112,20,112,20,254,207,10,
+90,75,59,44,54,81,137,57,41,65,38,28,43,35,19,34,6,67,46,124,36,80,49,27,
+28,55,28,0,255,255,255,169,253,161,3,242,4,250,2,38,2,119,0,0,0,6,2,203,0,
+0,255,255,255,169,253,158,3,242,4,250,2,38,2,120,0,0,0,6,2,203,0,0,255,255,
+255,169,254,74,3,242,4,250,0,38,2,121,0,0,0,7,0,100,3,23,255,192,255,255,
+255,169,254,74,4,37,4,250,2,38,2,122,0,0,0,7,0,100,3,23,255,192,0,1,255,169,
+253,131,4,47,4,250,0,77,0,0,19,20,23,54,51,50,30,3,21,17,35,39,53,52,39,5,
+39,37,38,35,34,6,21,20,22,23,54,51,50,22,22,21,20,6,35,34,36,39,55,22,22,
+51,50,54,53,52,35,34,6,7,39,38,38,53,52,55,38,53,52,54,51,50,23,53,33,39,
+53,33,23,21,35,17,38,35,34,6,252,50,92,105,63,106,105,124,37,19,120,8,254,
+250,113,1,34,54,70,128,172,130,146,68,68,73,134,83,171,142,167,254,230,122,
+95,97,205,124,102,150,102,46,87,59,74,175,194,99,116,172,139,113,142,253,
+77,77,4,57,77,245,142,128,163,141,2,170,61,42,54,27,63,140,103,65,254,249,
+90,249,29,27,233,98,243,30,153,119,97,182,66,34,82,142,72,119,144,202,160,
+81,155,182,135,91,98,32,42,97,80,247,151,134,97,97,112,114,111,16,199,112,
+20,112,20,254,203,14,90,0,0,1,255,169,253,131,4,47,4,250,0,83,0,0,19,20,23,
+54,51,50,30,3,21,17,35,39,53,52,39,5,39,37,38,35,34,6,21,20,22,22,23,30,2,
+23,23,7,46,2,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,38,53,52,54,55,
+38,38,53,52,55,38,53,52,54,51,50,23,53,33,39,53,33,23,21,35,17,38,35,34,6,
+252,50,92,105,63,106,105,124,37,19,120,8,254,250,113,1,34,54,70,128,172,77,
+111,77,76,137,118,97,74,89,122,138,136,65,93,103,64,55,53,97,65,49,57,82,
+51,67,146,113,100,83,105,112,99,116,172,139,113,142,253,77,77,4,57,77,245,
+142,128,163,141,2,170,61,42,54,27,63,140,103,65,254,249,90,249,29,27,233,
+98,243,30,153,119,80,119,78,40,39,117,131,116,89,61,161,165,102,92,79,64,
+67,27,45,146,25,21,89,146,80,85,132,23,74,188,108,134,97,97,112,114,111,16,
+199,112,20,112,20,254,203,14,90,255,255,251,205,253,219,0,44,0,10,2,38,0,
+32,0,0,0,7,0,100,254,63,255,136,255,255,252,199,253,207,1,71,0,11,2,38,0,
+33,0,0,0,7,0,100,255,57,255,75,255,255,252,227,253,162,0,71,255,223,2,38,
+0,34,0,0,0,7,0,100,255,85,255,149,255,255,252,227,252,209,0,172,255,223,2,
+38,0,35,0,0,0,7,0,100,255,85,255,149,255,255,252,246,253,125,0,239,0,0,2,
+38,0,36,0,0,0,7,0,100,255,104,254,244,255,255,252,246,253,2,1,116,0,0,2,38,
+0,37,0,0,0,7,0,100,255,104,254,244,255,255,253,106,253,247,0,243,255,166,
+2,38,0,99,0,0,0,6,0,100,220,25,0,2,253,61,252,148,0,130,255,197,0,5,0,30,
+0,0,1,39,1,1,7,37,1,20,6,35,34,38,39,55,22,22,51,50,54,53,52,35,34,6,7,39,
+54,51,50,22,22,254,35,131,1,105,1,121,60,254,245,1,16,148,125,150,251,108,
+95,84,174,106,86,126,75,46,87,59,95,113,97,65,121,77,254,73,111,1,13,254,
+188,58,223,254,51,89,108,156,124,81,117,138,95,65,81,32,42,124,79,77,132,
+0,0,2,253,160,252,125,1,81,255,197,0,5,0,35,0,0,7,5,39,1,1,7,1,7,46,2,35,
+34,6,21,20,51,50,54,55,23,6,6,35,34,38,38,53,52,54,51,50,22,22,23,22,197,
+254,232,131,1,105,1,121,60,1,11,89,106,121,106,56,84,96,87,46,81,55,44,46,
+65,41,57,123,114,141,112,74,118,105,95,69,218,221,111,1,13,254,188,58,254,
+115,61,144,145,73,83,63,78,20,33,136,20,17,70,125,67,91,123,58,104,108,81,
+0,2,253,160,252,146,0,146,255,197,0,5,0,24,0,0,7,5,39,1,1,7,19,6,6,35,34,
+38,53,52,54,55,23,6,6,21,20,22,51,50,55,197,254,232,131,1,105,1,121,60,76,
+78,132,76,92,193,100,141,118,120,118,61,46,127,107,218,221,111,1,13,254,188,
+58,254,175,57,43,168,82,79,114,63,107,43,93,60,38,40,75,0,0,2,253,160,251,
+126,1,19,255,197,0,5,0,39,0,0,7,5,39,1,1,7,19,6,35,34,38,38,53,52,55,38,38,
+53,52,55,23,6,6,21,20,22,23,54,55,23,14,2,21,20,22,51,50,54,55,197,254,232,
+131,1,105,1,121,60,205,130,133,67,120,84,5,58,114,241,118,118,119,49,48,50,
+139,118,91,93,53,57,40,51,113,43,218,221,111,1,13,254,188,58,253,158,103,
+73,107,66,23,25,22,128,82,179,77,107,38,98,68,35,46,5,56,61,107,41,53,65,
+45,34,35,46,35,0,0,2,253,160,251,148,0,245,255,197,0,5,0,61,0,0,1,39,1,1,
+7,37,1,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,39,38,53,52,
+55,38,35,34,6,21,20,22,23,7,38,53,52,54,51,50,23,54,51,50,22,21,20,6,7,6,
+6,21,20,51,50,55,254,35,131,1,105,1,121,60,254,245,1,186,62,81,63,149,41,
+39,37,36,41,34,56,72,5,118,5,14,37,37,49,66,53,51,57,171,98,80,89,84,59,102,
+80,151,49,45,35,32,37,53,64,254,73,111,1,13,254,188,58,223,252,189,79,121,
+71,39,65,42,41,56,33,35,43,86,77,31,28,23,31,37,44,42,21,69,56,57,93,53,54,
+164,150,84,102,69,72,137,82,48,80,50,40,47,25,37,62,0,0,2,253,160,251,25,
+1,122,255,197,0,5,0,72,0,0,1,39,1,1,7,37,1,6,35,34,38,53,53,38,53,52,54,55,
+54,54,53,52,38,35,34,6,21,20,23,39,38,53,52,55,38,35,34,6,21,20,22,23,7,38,
+53,52,54,51,50,23,54,51,50,22,21,20,6,7,6,6,21,20,23,54,55,23,6,6,21,20,51,
+50,55,254,35,131,1,105,1,121,60,254,245,2,63,62,81,60,143,119,34,34,31,31,
+41,34,56,72,5,118,5,14,37,37,49,66,53,51,57,171,98,80,89,84,59,102,80,151,
+43,40,31,28,38,46,75,88,62,66,32,53,64,254,73,111,1,13,254,188,58,223,252,
+66,79,112,68,5,71,92,34,57,37,36,50,29,35,43,86,77,31,28,23,31,37,44,42,21,
+69,56,57,93,53,54,164,150,84,102,69,72,137,82,42,70,44,35,42,21,38,4,52,24,
+92,21,62,30,25,62,0,2,253,160,252,199,1,4,255,197,0,5,0,17,0,0,7,5,39,1,1,
+7,19,7,38,38,35,34,7,39,54,51,50,22,197,254,232,131,1,105,1,121,60,190,58,
+128,157,63,88,84,66,92,98,84,170,218,221,111,1,13,254,188,58,254,168,40,115,
+101,36,136,37,115,0,1,255,169,255,242,5,126,4,250,0,54,0,0,1,21,30,2,21,20,
+2,7,39,54,54,53,52,38,35,34,6,21,20,23,39,38,53,52,55,38,35,34,6,21,20,18,
+23,7,38,38,2,53,52,54,51,50,23,54,54,51,51,53,33,39,53,33,23,21,3,253,55,
+137,54,182,108,147,125,150,96,74,97,113,8,161,8,28,69,73,93,118,184,164,61,
+93,207,149,158,125,145,127,42,125,75,4,252,136,77,5,136,77,4,118,251,29,146,
+118,64,144,254,249,95,113,99,238,127,81,107,138,117,39,48,39,32,70,84,68,
+47,119,97,148,254,255,119,69,65,211,1,8,131,128,157,123,55,58,210,112,20,
+112,20,0,255,255,255,169,254,252,5,126,4,250,2,38,2,143,0,0,0,7,0,100,5,32,
+0,114,255,255,255,169,254,100,5,126,4,250,2,38,2,143,0,0,0,7,1,5,3,177,0,
+29,255,255,255,169,254,100,5,126,4,250,2,38,2,143,0,0,0,39,1,5,3,177,0,29,
+0,7,0,100,3,1,0,104,0,2,0,109,255,242,8,174,4,250,0,76,0,86,0,0,1,21,30,2,
+21,20,2,7,39,54,54,53,52,38,35,34,6,21,20,23,39,38,53,52,55,38,35,34,6,21,
+20,18,23,7,38,38,39,38,39,6,7,39,54,55,38,38,53,52,54,51,50,22,22,21,20,7,
+22,23,38,53,52,54,51,50,23,54,54,51,51,53,33,39,53,33,23,21,1,54,53,52,38,
+35,34,6,21,20,7,45,55,137,54,182,108,147,125,150,96,74,97,113,8,161,8,28,
+69,73,93,118,184,164,61,107,230,62,233,202,117,161,121,160,110,105,120,128,
+97,86,169,95,146,129,194,13,158,125,145,127,42,125,75,4,252,136,77,5,136,
+77,249,26,133,79,59,59,79,4,118,251,29,146,118,64,144,254,249,95,113,99,238,
+127,81,107,138,117,39,48,39,32,70,84,68,47,119,97,148,254,255,119,69,74,247,
+136,47,118,96,92,105,84,83,81,183,95,95,126,106,141,89,118,143,70,53,57,48,
+128,157,123,55,58,210,112,20,112,20,254,128,126,120,64,87,82,72,128,0,1,255,
+169,255,141,5,94,4,250,0,45,0,0,1,35,17,35,39,17,33,21,22,22,21,20,6,7,23,
+22,23,7,3,7,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,6,7,39,54,55,53,
+33,39,53,33,23,5,94,237,19,124,254,27,105,149,165,139,50,165,69,141,240,42,
+89,121,72,50,86,64,112,139,100,82,65,145,56,88,117,152,254,136,77,5,104,77,
+4,118,251,128,93,4,35,236,38,211,99,97,153,31,57,192,70,73,1,123,3,85,65,
+55,60,93,18,114,72,62,79,48,48,141,90,10,219,112,20,112,0,255,255,255,169,
+255,107,5,94,4,250,2,38,2,148,0,0,0,7,0,100,2,228,0,225,0,1,255,169,255,141,
+3,156,4,250,0,40,0,0,1,21,22,22,21,20,6,7,23,22,23,7,3,7,34,38,53,52,54,51,
+50,23,54,54,53,52,38,35,34,6,7,39,54,55,53,33,39,53,33,23,21,1,253,105,149,
+165,139,50,165,69,141,240,42,89,121,72,50,86,64,112,139,100,82,65,145,56,
+88,117,152,254,136,77,3,166,77,4,118,236,38,211,99,97,153,31,57,192,70,73,
+1,123,3,85,65,55,60,93,18,114,72,62,79,48,48,141,90,10,219,112,20,112,20,
+0,255,255,255,169,255,107,3,156,4,250,2,38,2,150,0,0,0,7,0,100,2,228,0,225,
+0,2,0,211,255,242,1,213,5,182,0,3,0,11,0,0,19,51,3,35,3,52,51,50,21,20,35,
+34,221,238,72,94,82,129,129,129,129,5,182,251,230,254,225,139,139,139,0,2,
+0,117,3,213,2,207,5,182,0,3,0,7,0,0,19,51,3,35,1,51,3,35,117,217,62,94,1,
+68,217,62,94,5,182,254,31,1,225,254,31,0,0,2,0,51,0,0,4,70,5,182,0,27,0,31,
+0,0,19,35,53,51,19,35,53,51,19,51,3,33,19,51,3,51,21,35,3,51,21,33,3,35,19,
+33,3,35,1,19,33,3,240,189,211,78,223,245,74,125,76,1,29,76,123,76,201,224,
+75,233,254,254,78,123,78,254,227,77,123,1,254,76,254,227,76,1,160,121,1,145,
+121,1,147,254,109,1,147,254,109,121,254,111,121,254,96,1,160,254,96,2,25,
+1,145,254,111,0,0,5,0,92,255,236,6,207,5,203,0,11,0,15,0,27,0,39,0,51,0,0,
+19,52,54,51,50,22,21,20,6,35,34,38,1,51,1,35,19,52,38,35,34,6,21,20,22,51,
+50,54,1,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,
+92,166,172,164,170,171,165,170,166,4,96,134,253,38,135,97,68,80,82,72,72,
+80,81,69,1,237,165,173,164,170,171,165,171,165,1,229,67,80,82,72,72,80,81,
+68,4,6,214,239,242,211,212,245,243,2,134,250,74,4,6,183,184,186,181,184,189,
+188,254,103,215,238,242,211,211,245,242,214,183,184,186,181,184,189,187,0,
+0,1,0,117,3,213,1,78,5,182,0,3,0,0,19,51,3,35,117,217,62,94,5,182,254,31,
+0,1,0,117,254,250,2,131,6,20,0,15,0,0,19,16,18,37,21,6,6,2,21,20,18,22,23,
+21,36,2,117,245,1,25,132,138,43,43,138,132,254,233,247,2,137,1,118,1,165,
+112,92,80,250,254,220,193,192,254,218,251,80,94,111,1,169,0,0,1,0,66,254,
+250,2,80,6,20,0,15,0,0,23,54,54,18,53,52,2,38,39,53,4,18,17,16,2,5,66,132,
+137,44,44,137,132,1,23,247,247,254,233,168,80,252,1,37,192,192,1,37,250,80,
+92,111,254,90,254,138,254,139,254,85,111,0,0,1,0,84,3,6,3,160,6,20,0,17,0,
+0,1,5,39,37,37,55,5,3,51,3,37,23,5,5,7,37,19,35,1,213,254,199,72,1,88,254,
+168,72,1,59,53,178,57,1,61,72,254,166,1,90,72,254,195,57,178,4,74,195,160,
+102,103,162,199,1,69,254,189,192,159,101,100,158,191,254,188,0,0,1,0,133,
+1,37,3,244,4,147,0,11,0,0,1,33,53,33,17,51,17,33,21,33,17,35,1,254,254,135,
+1,121,123,1,123,254,133,123,2,160,121,1,122,254,134,121,254,133,0,1,0,61,
+254,197,1,141,1,8,0,17,0,0,23,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,
+6,7,61,195,31,32,54,33,75,59,68,89,162,174,229,63,121,25,28,18,30,52,35,57,
+64,98,80,140,210,51,0,1,0,51,1,225,2,72,2,123,0,3,0,0,19,33,21,33,51,2,21,
+253,235,2,123,154,0,1,0,127,255,242,1,129,1,8,0,7,0,0,55,52,51,50,21,20,35,
+34,127,129,129,129,129,125,139,139,139,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,
+1,51,1,35,1,215,119,254,43,121,6,20,248,244,0,2,0,92,255,236,4,29,5,203,0,
+11,0,23,0,0,19,16,18,51,50,18,17,16,2,35,34,2,1,16,2,35,34,2,17,16,18,51,
+50,18,92,237,246,229,249,252,228,244,237,2,236,122,143,145,125,125,143,144,
+123,2,223,1,98,1,138,254,121,254,153,254,152,254,119,1,144,1,97,1,62,1,65,
+254,191,254,194,254,194,254,187,1,68,0,0,1,0,135,0,0,3,209,5,190,0,23,0,0,
+55,51,50,54,53,17,6,6,35,34,38,53,54,54,55,55,51,17,20,22,51,51,21,33,197,
+137,96,72,92,116,56,45,58,66,137,96,144,131,73,95,100,252,244,86,71,76,4,
+52,111,102,61,49,17,70,71,106,251,43,76,71,86,0,0,1,0,104,0,0,3,227,5,203,
+0,31,0,0,55,1,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,
+1,33,50,54,54,55,51,3,33,104,1,86,169,122,104,105,128,97,82,94,214,187,192,
+224,139,203,254,166,1,217,59,70,35,16,86,10,252,143,150,1,139,197,243,135,
+121,139,164,141,60,73,127,148,186,156,117,254,223,254,129,42,71,77,254,158,
+0,0,1,0,119,255,236,4,2,5,203,0,44,0,0,55,52,54,51,20,22,51,50,54,53,52,38,
+35,35,53,51,50,54,53,52,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,22,22,
+21,20,6,6,35,34,38,119,70,59,142,118,135,170,200,171,65,65,142,180,219,129,
+97,82,94,216,186,199,231,183,145,184,195,154,237,129,180,207,207,61,70,113,
+135,158,172,131,154,104,178,139,254,164,141,60,73,127,148,175,151,135,208,
+34,20,190,152,155,196,87,122,0,0,2,0,35,0,0,4,92,5,182,0,20,0,28,0,0,37,51,
+50,54,53,53,33,53,1,51,17,51,21,35,21,20,22,51,51,21,33,19,17,52,55,6,6,7,
+1,1,184,58,96,72,253,137,2,121,194,254,254,73,95,27,253,151,226,14,20,127,
+37,254,198,86,71,76,168,84,3,209,252,78,115,168,76,71,86,2,4,1,123,248,176,
+40,218,57,254,24,0,1,0,113,255,236,3,227,5,180,0,34,0,0,55,52,51,20,22,51,
+32,17,52,38,35,34,6,7,39,19,33,19,35,39,38,38,35,33,3,54,51,50,22,21,20,4,
+35,34,38,113,129,133,114,1,37,166,145,94,108,50,49,66,2,172,10,86,8,7,46,
+58,254,115,39,97,142,216,251,254,246,229,181,206,186,121,95,112,1,90,158,
+162,23,22,14,2,213,254,203,61,51,33,254,62,33,233,200,214,252,109,0,2,0,125,
+255,236,4,16,5,203,0,25,0,34,0,0,19,52,18,54,51,50,22,21,20,6,35,52,38,35,
+32,3,54,51,50,22,21,20,2,35,34,2,37,16,35,34,6,7,18,33,50,125,119,241,174,
+152,186,81,76,87,94,254,210,21,128,165,189,222,238,202,231,244,2,194,243,
+74,132,48,6,1,10,225,2,225,201,1,84,205,120,95,59,64,108,131,253,166,107,
+226,194,225,254,248,1,138,75,1,79,69,49,253,194,0,0,1,0,121,0,0,4,23,5,180,
+0,10,0,0,1,33,34,7,7,35,19,33,21,1,35,3,104,253,230,110,9,8,86,10,3,148,254,
+8,154,5,16,104,102,1,114,59,250,135,0,3,0,94,255,236,4,27,5,203,0,25,0,37,
+0,48,0,0,19,52,54,54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,
+4,35,34,38,1,52,38,35,34,6,21,20,22,23,54,54,19,52,38,39,6,21,20,22,51,50,
+54,94,78,132,102,126,139,93,199,151,184,219,115,161,164,176,254,249,229,213,
+252,2,199,124,110,109,128,117,159,107,88,59,164,196,211,142,134,131,164,1,
+111,93,136,96,49,71,182,122,100,166,101,193,160,109,156,81,78,189,126,191,
+220,210,3,177,118,133,133,112,97,139,74,53,133,253,97,105,156,85,114,220,
+131,153,150,0,0,2,0,104,255,233,3,252,5,203,0,26,0,38,0,0,55,52,54,55,22,
+51,50,18,19,6,6,35,34,38,53,52,18,51,50,18,17,20,2,6,35,34,38,1,2,2,35,34,
+6,21,20,22,51,54,54,168,37,24,70,168,168,163,11,50,152,99,191,213,240,199,
+230,247,116,249,190,160,137,2,131,4,142,122,109,119,117,121,94,134,154,36,
+54,8,162,1,44,1,56,61,78,221,195,228,1,20,254,151,254,185,226,254,142,222,
+102,3,3,1,8,1,0,192,179,166,149,1,94,0,0,2,0,166,255,242,1,168,4,84,0,7,0,
+15,0,0,19,52,51,50,21,20,35,34,17,52,51,50,21,20,35,34,166,129,129,129,129,
+129,129,129,129,3,201,139,139,140,253,64,139,139,139,0,0,2,0,98,254,197,1,
+178,4,84,0,7,0,25,0,0,19,52,51,50,21,20,35,34,3,54,53,52,38,39,38,38,53,52,
+54,51,50,22,21,20,6,7,166,129,129,129,129,68,195,31,32,54,33,75,58,70,88,
+162,174,3,201,139,139,140,251,222,63,121,25,28,18,31,51,35,57,64,99,79,140,
+210,51,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,53,1,21,1,1,21,133,3,111,
+253,80,2,176,2,184,72,1,217,137,254,139,254,143,137,0,0,2,0,133,1,213,3,244,
+3,225,0,3,0,7,0,0,19,33,21,33,17,33,21,33,133,3,111,252,145,3,111,252,145,
+3,225,121,254,230,121,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,1,1,53,1,21,
+1,133,2,176,253,80,3,111,252,145,1,106,1,113,1,117,137,254,39,72,254,41,0,
+2,0,88,255,242,3,152,5,203,0,23,0,32,0,0,1,54,54,53,52,38,35,34,6,21,34,38,
+53,52,54,51,50,22,21,20,6,7,21,35,3,52,51,50,21,20,6,35,34,1,141,167,147,
+110,114,120,109,76,94,200,183,203,246,200,198,125,69,129,129,72,57,129,2,
+211,67,222,135,111,124,145,117,69,64,109,121,204,167,163,224,82,231,254,225,
+139,139,74,65,0,0,1,0,205,254,250,2,150,6,20,0,13,0,0,19,33,21,35,34,6,21,
+17,20,22,51,51,21,33,205,1,201,89,95,72,72,95,89,254,55,6,20,86,71,76,250,
+184,75,72,86,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,17,51,1,35,119,1,215,121,6,
+20,248,244,0,1,0,76,254,250,2,20,6,20,0,13,0,0,23,51,50,54,53,17,52,38,35,
+35,53,33,17,33,76,88,96,72,73,95,88,1,200,254,56,176,71,76,5,72,76,71,86,
+248,230,0,0,1,0,104,2,33,4,14,5,182,0,6,0,0,1,51,1,35,1,1,35,2,23,71,1,176,
+137,254,180,254,185,138,5,182,252,107,2,217,253,39,0,1,255,246,254,221,3,
+182,255,86,0,3,0,0,7,33,21,33,10,3,192,252,64,170,121,0,0,1,0,102,254,250,
+3,6,6,20,0,35,0,0,37,17,52,38,39,53,54,54,53,17,52,54,51,51,21,35,34,6,21,
+17,20,6,7,21,22,22,21,17,20,22,51,51,21,35,34,38,1,88,127,115,114,128,151,
+144,135,61,89,79,116,112,115,113,80,88,61,135,142,153,33,1,100,117,95,5,86,
+3,96,116,1,101,140,152,88,106,109,254,162,102,132,18,2,19,131,104,254,158,
+107,108,88,158,0,1,1,254,254,20,2,121,6,20,0,3,0,0,1,51,17,35,1,254,123,123,
+6,20,248,0,0,1,0,102,254,250,3,6,6,20,0,35,0,0,23,51,50,54,53,17,52,54,55,
+53,38,38,53,17,52,38,35,35,53,51,50,22,21,17,20,22,23,21,6,6,21,17,20,6,35,
+35,102,62,88,80,113,114,111,116,79,89,62,136,143,151,129,113,114,128,152,
+142,136,174,108,107,1,98,104,131,19,2,18,132,102,1,94,109,106,88,152,140,
+254,155,116,96,3,86,5,95,117,254,156,137,158,0,0,1,0,111,2,39,4,8,3,141,0,
+25,0,0,1,50,22,23,22,22,51,50,54,55,51,6,6,35,34,38,39,38,38,35,34,6,7,35,
+54,54,1,104,67,110,79,57,73,38,54,57,14,123,17,105,128,67,114,64,61,73,43,
+58,59,12,120,14,105,3,141,62,73,52,50,117,120,150,208,66,63,58,50,114,123,
+155,203,0,0,1,255,246,6,20,3,182,6,141,0,3,0,0,3,33,21,33,10,3,192,252,64,
+6,141,121,0,1,255,246,1,233,4,10,2,98,0,3,0,0,3,33,21,33,10,4,20,251,236,
+2,98,121,0,1,255,246,1,233,8,10,2,98,0,3,0,0,3,33,21,33,10,8,20,247,236,2,
+98,121,0,1,0,115,3,117,1,195,5,184,0,17,0,0,19,52,54,55,21,6,21,20,22,23,
+22,22,21,20,6,35,34,38,115,162,174,195,30,33,42,45,75,59,69,88,4,39,140,210,
+51,86,63,121,25,28,19,22,49,45,57,64,98,0,0,1,0,61,3,115,1,141,5,182,0,17,
+0,0,19,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,30,33,42,45,
+75,59,68,89,162,174,3,201,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,
+0,0,2,0,115,3,117,3,92,5,184,0,17,0,35,0,0,19,52,54,55,21,6,21,20,22,23,22,
+22,21,20,6,35,34,38,37,52,54,55,21,6,21,20,22,23,22,22,21,20,6,35,34,38,115,
+162,174,195,30,33,42,45,75,59,69,88,1,153,162,174,194,30,33,41,45,74,59,70,
+88,4,39,140,210,51,86,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,86,
+63,121,25,28,19,22,49,45,57,64,99,0,2,0,61,3,115,3,39,5,182,0,17,0,35,0,0,
+19,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,37,54,53,52,38,39,38,
+38,53,52,54,51,50,22,21,20,6,7,61,195,30,33,42,45,75,59,69,88,162,174,1,154,
+195,30,33,42,45,74,59,70,88,162,174,3,201,63,121,25,28,19,22,49,45,57,64,
+98,80,140,210,51,86,63,121,25,28,19,22,49,45,57,64,99,79,140,210,51,0,3,0,
+164,255,242,6,57,1,8,0,8,0,17,0,25,0,0,55,52,51,50,21,20,6,35,34,37,52,51,
+50,21,20,6,35,34,37,52,51,50,21,20,35,34,164,129,129,72,57,129,2,74,129,129,
+72,57,129,2,73,129,129,129,129,125,139,139,74,65,139,139,139,74,65,139,139,
+139,139,0,0,1,0,145,1,51,3,229,4,137,0,11,0,0,19,1,1,55,1,1,23,1,1,7,1,1,
+145,1,84,254,172,86,1,84,1,84,86,254,172,1,84,86,254,172,254,172,1,139,1,
+84,1,82,86,254,172,1,86,88,254,172,254,172,86,1,84,254,172,0,0,3,0,133,0,
+231,3,244,4,209,0,7,0,11,0,20,0,0,1,52,51,50,21,20,35,34,5,33,21,33,1,52,
+51,50,21,20,6,35,34,1,213,104,105,105,104,254,176,3,111,252,145,1,80,104,
+105,58,47,104,4,96,113,113,112,215,121,254,184,113,113,59,54,0,0,1,0,133,
+2,160,3,244,3,25,0,3,0,0,19,33,21,33,133,3,111,252,145,3,25,121,255,255,0,
+61,3,115,1,141,5,182,2,6,2,194,0,0,0,1,255,105,5,105,0,18,6,32,0,7,0,0,19,
+20,35,34,53,52,51,50,18,84,85,85,84,5,196,91,91,92,0,1,255,204,255,130,0,
+133,0,65,0,7,0,0,23,34,53,52,51,50,21,20,41,93,93,92,126,95,96,96,95,0,0,
+0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,42,0,94,0,3,0,
+1,4,9,0,2,0,14,0,136,0,3,0,1,4,9,0,3,0,80,0,150,0,3,0,1,4,9,0,4,0,42,0,94,
+0,3,0,1,4,9,0,5,0,30,0,230,0,3,0,1,4,9,0,6,0,38,1,4,0,3,0,1,4,9,0,7,0,68,
+1,42,0,3,0,1,4,9,0,8,0,42,1,110,0,3,0,1,4,9,0,9,0,40,1,152,0,3,0,1,4,9,0,
+10,0,96,1,192,0,3,0,1,4,9,0,11,0,62,2,32,0,3,0,1,4,9,0,12,0,60,2,94,0,3,0,
+1,4,9,0,13,2,150,2,154,0,3,0,1,4,9,0,14,0,52,5,48,0,67,0,111,0,112,0,121,
+0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,54,0,32,0,71,0,111,0,
+111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,
+0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,
+0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,
+0,32,0,68,0,101,0,118,0,97,0,110,0,97,0,103,0,97,0,114,0,105,0,82,0,101,0,
+103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,
+116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,68,0,101,0,118,0,97,0,
+110,0,97,0,103,0,97,0,114,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,
+0,32,0,49,0,46,0,48,0,49,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,101,
+0,114,0,105,0,102,0,68,0,101,0,118,0,97,0,110,0,97,0,103,0,97,0,114,0,105,
+0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,
+100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,
+110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,97,0,116,0,
+97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,
+101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,
+110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,
+0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,
+119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,
+0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,
+0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,
+0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,
+0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,
+0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,
+0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,
+0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,
+0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,
+0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,
+0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,
+0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,
+0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,
+76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,
+0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,
+0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,
+0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,
+0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,
+0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,
+0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,
+0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,
+0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,
+0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,204,0,0,1,
+2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,
+1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,
+1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,
+1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,
+1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,
+1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,
+1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,
+1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,
+118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,
+1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,
+143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,
+1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,
+168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,
+1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,
+193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,
+1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,
+218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,
+1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,
+243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,
+2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,
+2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,
+2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,
+2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,
+2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,
+2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,
+2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,
+2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,
+118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,
+2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,
+143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,
+2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,
+168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,
+2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,
+193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,
+2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,
+218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,
+2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,
+243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,
+3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,
+3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,
+3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,
+3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,
+3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,
+3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,
+3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,
+3,106,3,107,3,108,3,109,3,110,3,111,3,112,3,113,3,114,3,115,3,116,3,117,3,
+118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,127,3,128,3,129,3,130,
+3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,138,3,139,3,140,3,141,3,142,3,
+143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,0,4,0,5,0,6,0,8,0,10,0,11,0,
+12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,
+0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,62,0,63,0,64,0,65,0,66,0,94,0,95,
+0,96,0,97,3,151,0,178,0,179,0,182,0,183,0,180,0,181,0,171,0,240,0,184,0,239,
+3,152,3,153,3,154,4,78,85,76,76,3,100,118,65,4,100,118,65,65,3,100,118,73,
+4,100,118,73,73,3,100,118,85,4,100,118,85,85,4,100,118,118,82,5,100,118,118,
+82,82,4,100,118,118,76,5,100,118,118,76,76,3,100,118,69,4,100,118,65,73,3,
+100,118,79,4,100,118,65,85,9,100,118,65,99,97,110,100,114,97,9,100,118,69,
+99,97,110,100,114,97,9,100,118,79,99,97,110,100,114,97,8,100,118,65,115,104,
+111,114,116,8,100,118,69,115,104,111,114,116,8,100,118,79,115,104,111,114,
+116,4,100,118,85,69,5,100,118,85,85,69,4,100,118,79,69,5,100,118,79,79,69,
+4,100,118,65,87,5,100,118,109,65,65,4,100,118,109,73,5,100,118,109,73,73,
+4,100,118,109,85,5,100,118,109,85,85,5,100,118,109,118,82,6,100,118,109,118,
+82,82,5,100,118,109,118,76,6,100,118,109,118,76,76,4,100,118,109,69,5,100,
+118,109,65,73,4,100,118,109,79,5,100,118,109,65,85,10,100,118,109,69,99,97,
+110,100,114,97,10,100,118,109,79,99,97,110,100,114,97,9,100,118,109,69,115,
+104,111,114,116,9,100,118,109,79,115,104,111,114,116,5,100,118,109,85,69,
+6,100,118,109,85,85,69,5,100,118,109,79,69,6,100,118,109,79,79,69,5,100,118,
+109,65,87,17,100,118,109,69,112,114,105,115,104,116,104,97,109,97,116,114,
+97,14,100,118,109,69,99,97,110,100,114,97,108,111,110,103,4,100,118,75,65,
+5,100,118,75,72,65,4,100,118,71,65,5,100,118,71,72,65,5,100,118,78,71,65,
+4,100,118,67,65,5,100,118,67,72,65,4,100,118,74,65,5,100,118,74,72,65,5,100,
+118,78,89,65,5,100,118,84,84,65,6,100,118,84,84,72,65,5,100,118,68,68,65,
+6,100,118,68,68,72,65,5,100,118,78,78,65,4,100,118,84,65,5,100,118,84,72,
+65,4,100,118,68,65,5,100,118,68,72,65,4,100,118,78,65,4,100,118,80,65,5,100,
+118,80,72,65,4,100,118,66,65,5,100,118,66,72,65,4,100,118,77,65,4,100,118,
+89,65,4,100,118,82,65,4,100,118,76,65,4,100,118,86,65,5,100,118,83,72,65,
+5,100,118,83,83,65,4,100,118,83,65,4,100,118,72,65,5,100,118,76,76,65,7,100,
+118,75,95,83,83,65,7,100,118,74,95,78,89,65,7,100,118,71,65,98,97,114,7,100,
+118,74,65,98,97,114,8,100,118,68,68,65,98,97,114,7,100,118,66,65,98,97,114,
+5,100,118,90,72,65,9,100,118,89,65,104,101,97,118,121,12,100,118,68,68,65,
+109,97,114,119,97,114,105,10,100,118,65,110,117,115,118,97,114,97,13,100,
+118,67,97,110,100,114,97,98,105,110,100,117,9,100,118,86,105,115,97,114,103,
+97,8,100,118,86,105,114,97,109,97,7,100,118,78,117,107,116,97,10,100,118,
+65,118,97,103,114,97,104,97,13,100,118,71,108,111,116,116,97,108,115,116,
+111,112,16,100,118,72,105,103,104,115,112,97,99,105,110,103,100,111,116,6,
+117,100,97,116,116,97,8,97,110,117,100,97,116,116,97,7,100,118,71,114,97,
+118,101,7,100,118,65,99,117,116,101,21,100,118,67,97,110,100,114,97,98,105,
+110,100,117,105,110,118,101,114,116,101,100,6,100,118,90,101,114,111,5,100,
+118,79,110,101,5,100,118,84,119,111,7,100,118,84,104,114,101,101,6,100,118,
+70,111,117,114,6,100,118,70,105,118,101,5,100,118,83,105,120,7,100,118,83,
+101,118,101,110,7,100,118,69,105,103,104,116,6,100,118,78,105,110,101,4,100,
+118,79,109,18,100,118,65,98,98,114,101,118,105,97,116,105,111,110,115,105,
+103,110,7,117,110,105,48,57,54,52,7,117,110,105,48,57,54,53,7,117,110,105,
+49,67,68,48,7,117,110,105,49,67,68,49,7,117,110,105,49,67,68,50,7,117,110,
+105,49,67,68,51,7,117,110,105,49,67,68,52,7,117,110,105,49,67,68,53,7,117,
+110,105,49,67,68,54,7,117,110,105,49,67,68,55,7,117,110,105,49,67,68,56,7,
+117,110,105,49,67,68,57,7,117,110,105,49,67,68,65,7,117,110,105,49,67,68,
+66,7,117,110,105,49,67,68,67,7,117,110,105,49,67,68,68,7,117,110,105,49,67,
+68,69,7,117,110,105,49,67,68,70,7,117,110,105,49,67,69,48,7,117,110,105,49,
+67,69,49,7,117,110,105,49,67,69,50,7,117,110,105,49,67,69,51,7,117,110,105,
+49,67,69,52,7,117,110,105,49,67,69,53,7,117,110,105,49,67,69,54,7,117,110,
+105,49,67,69,55,7,117,110,105,49,67,69,56,7,117,110,105,49,67,69,57,7,117,
+110,105,49,67,69,65,7,117,110,105,49,67,69,66,7,117,110,105,49,67,69,67,7,
+117,110,105,49,67,69,68,7,117,110,105,49,67,69,69,7,117,110,105,49,67,69,
+70,7,117,110,105,49,67,70,48,7,117,110,105,49,67,70,49,7,117,110,105,49,67,
+70,50,7,117,110,105,49,67,70,51,7,117,110,105,49,67,70,52,7,117,110,105,49,
+67,70,53,7,117,110,105,49,67,70,54,7,117,110,105,65,56,51,48,7,117,110,105,
+65,56,51,49,7,117,110,105,65,56,51,50,7,117,110,105,65,56,51,51,7,117,110,
+105,65,56,51,52,7,117,110,105,65,56,51,53,7,117,110,105,65,56,51,54,7,117,
+110,105,65,56,51,55,7,117,110,105,65,56,51,56,7,117,110,105,65,56,51,57,7,
+117,110,105,65,56,69,48,7,117,110,105,65,56,69,49,7,117,110,105,65,56,69,
+50,7,117,110,105,65,56,69,51,7,117,110,105,65,56,69,52,7,117,110,105,65,56,
+69,53,7,117,110,105,65,56,69,54,7,117,110,105,65,56,69,55,7,117,110,105,65,
+56,69,56,7,117,110,105,65,56,69,57,7,117,110,105,65,56,69,65,7,117,110,105,
+65,56,69,66,7,117,110,105,65,56,69,67,7,117,110,105,65,56,69,68,7,117,110,
+105,65,56,69,69,7,117,110,105,65,56,69,70,7,117,110,105,65,56,70,48,7,117,
+110,105,65,56,70,49,7,117,110,105,65,56,70,50,7,117,110,105,65,56,70,51,7,
+117,110,105,65,56,70,52,7,117,110,105,65,56,70,53,7,117,110,105,65,56,70,
+54,7,117,110,105,65,56,70,55,7,117,110,105,65,56,70,56,7,117,110,105,65,56,
+70,57,7,117,110,105,65,56,70,65,7,117,110,105,65,56,70,66,7,117,110,105,50,
+48,66,57,7,117,110,105,50,48,48,66,7,117,110,105,50,48,48,67,7,117,110,105,
+50,48,48,68,7,117,110,105,50,53,67,67,9,100,118,65,95,78,117,107,116,97,10,
+100,118,65,65,95,78,117,107,116,97,9,100,118,73,95,78,117,107,116,97,10,100,
+118,73,73,95,78,117,107,116,97,9,100,118,85,95,78,117,107,116,97,10,100,118,
+85,85,95,78,117,107,116,97,10,100,118,118,82,95,78,117,107,116,97,11,100,
+118,118,82,82,95,78,117,107,116,97,10,100,118,118,76,95,78,117,107,116,97,
+11,100,118,118,76,76,95,78,117,107,116,97,9,100,118,69,95,78,117,107,116,
+97,10,100,118,65,73,95,78,117,107,116,97,9,100,118,79,95,78,117,107,116,97,
+10,100,118,65,85,95,78,117,107,116,97,15,100,118,65,99,97,110,100,114,97,
+95,78,117,107,116,97,15,100,118,69,99,97,110,100,114,97,95,78,117,107,116,
+97,15,100,118,79,99,97,110,100,114,97,95,78,117,107,116,97,14,100,118,65,
+115,104,111,114,116,95,78,117,107,116,97,14,100,118,69,115,104,111,114,116,
+95,78,117,107,116,97,14,100,118,79,115,104,111,114,116,95,78,117,107,116,
+97,5,100,118,75,120,65,6,100,118,75,72,120,65,5,100,118,71,120,65,6,100,118,
+71,72,120,65,6,100,118,78,71,120,65,5,100,118,67,120,65,6,100,118,67,72,120,
+65,5,100,118,74,120,65,6,100,118,74,72,120,65,6,100,118,78,89,120,65,6,100,
+118,84,84,120,65,7,100,118,84,84,72,120,65,6,100,118,68,68,120,65,7,100,118,
+68,68,72,120,65,6,100,118,78,78,120,65,5,100,118,84,120,65,6,100,118,84,72,
+120,65,5,100,118,68,120,65,6,100,118,68,72,120,65,5,100,118,78,120,65,5,100,
+118,80,120,65,6,100,118,80,72,120,65,5,100,118,66,120,65,6,100,118,66,72,
+120,65,5,100,118,77,120,65,5,100,118,89,120,65,5,100,118,82,120,65,5,100,
+118,76,120,65,5,100,118,86,120,65,6,100,118,83,72,120,65,6,100,118,83,83,
+120,65,5,100,118,83,120,65,5,100,118,72,120,65,6,100,118,76,76,120,65,6,100,
+118,82,101,112,104,9,100,118,69,121,101,108,97,115,104,6,100,118,82,65,99,
+50,3,100,118,75,4,100,118,75,72,3,100,118,71,4,100,118,71,72,4,100,118,78,
+71,3,100,118,67,4,100,118,67,72,3,100,118,74,4,100,118,74,72,4,100,118,78,
+89,4,100,118,84,84,5,100,118,84,84,72,4,100,118,68,68,5,100,118,68,68,72,
+4,100,118,78,78,3,100,118,84,4,100,118,84,72,3,100,118,68,4,100,118,68,72,
+3,100,118,78,3,100,118,80,4,100,118,80,72,3,100,118,66,4,100,118,66,72,3,
+100,118,77,3,100,118,89,3,100,118,82,3,100,118,76,3,100,118,86,4,100,118,
+83,72,4,100,118,83,83,3,100,118,83,3,100,118,72,4,100,118,76,76,6,100,118,
+75,95,83,83,6,100,118,74,95,78,89,4,100,118,75,120,5,100,118,75,72,120,4,
+100,118,71,120,5,100,118,71,72,120,5,100,118,78,71,120,4,100,118,67,120,5,
+100,118,67,72,120,4,100,118,74,120,5,100,118,74,72,120,5,100,118,78,89,120,
+5,100,118,84,84,120,6,100,118,84,84,72,120,5,100,118,68,68,120,6,100,118,
+68,68,72,120,5,100,118,78,78,120,4,100,118,84,120,5,100,118,84,72,120,4,100,
+118,68,120,5,100,118,68,72,120,4,100,118,78,120,4,100,118,80,120,5,100,118,
+80,72,120,4,100,118,66,120,5,100,118,66,72,120,4,100,118,77,120,4,100,118,
+89,120,4,100,118,82,120,4,100,118,76,120,4,100,118,86,120,5,100,118,83,72,
+120,5,100,118,83,83,120,4,100,118,83,120,4,100,118,72,120,5,100,118,76,76,
+120,6,100,118,75,95,82,65,7,100,118,75,72,95,82,65,6,100,118,71,95,82,65,
+7,100,118,71,72,95,82,65,7,100,118,78,71,95,82,65,6,100,118,67,95,82,65,7,
+100,118,67,72,95,82,65,6,100,118,74,95,82,65,7,100,118,74,72,95,82,65,7,100,
+118,78,89,95,82,65,7,100,118,84,84,95,82,65,8,100,118,84,84,72,95,82,65,7,
+100,118,68,68,95,82,65,8,100,118,68,68,72,95,82,65,7,100,118,78,78,95,82,
+65,6,100,118,84,95,82,65,7,100,118,84,72,95,82,65,6,100,118,68,95,82,65,7,
+100,118,68,72,95,82,65,6,100,118,78,95,82,65,6,100,118,80,95,82,65,7,100,
+118,80,72,95,82,65,6,100,118,66,95,82,65,7,100,118,66,72,95,82,65,6,100,118,
+77,95,82,65,6,100,118,89,95,82,65,6,100,118,82,95,82,65,6,100,118,76,95,82,
+65,6,100,118,86,95,82,65,7,100,118,83,72,95,82,65,7,100,118,83,83,95,82,65,
+6,100,118,83,95,82,65,6,100,118,72,95,82,65,7,100,118,76,76,95,82,65,9,100,
+118,75,95,83,83,95,82,65,9,100,118,74,95,78,89,95,82,65,7,100,118,75,120,
+95,82,65,8,100,118,75,72,120,95,82,65,7,100,118,71,120,95,82,65,8,100,118,
+71,72,120,95,82,65,8,100,118,78,71,120,95,82,65,7,100,118,67,120,95,82,65,
+8,100,118,67,72,120,95,82,65,7,100,118,74,120,95,82,65,8,100,118,74,72,120,
+95,82,65,8,100,118,78,89,120,95,82,65,8,100,118,84,84,120,95,82,65,9,100,
+118,84,84,72,120,95,82,65,8,100,118,68,68,120,95,82,65,9,100,118,68,68,72,
+120,95,82,65,8,100,118,78,78,120,95,82,65,7,100,118,84,120,95,82,65,8,100,
+118,84,72,120,95,82,65,7,100,118,68,120,95,82,65,8,100,118,68,72,120,95,82,
+65,7,100,118,78,120,95,82,65,7,100,118,80,120,95,82,65,8,100,118,80,72,120,
+95,82,65,7,100,118,66,120,95,82,65,8,100,118,66,72,120,95,82,65,7,100,118,
+77,120,95,82,65,7,100,118,89,120,95,82,65,7,100,118,82,120,95,82,65,7,100,
+118,76,120,95,82,65,7,100,118,86,120,95,82,65,8,100,118,83,72,120,95,82,65,
+8,100,118,83,83,120,95,82,65,7,100,118,83,120,95,82,65,7,100,118,72,120,95,
+82,65,8,100,118,76,76,120,95,82,65,5,100,118,75,95,82,6,100,118,75,72,95,
+82,5,100,118,71,95,82,6,100,118,71,72,95,82,6,100,118,78,71,95,82,5,100,118,
+67,95,82,6,100,118,67,72,95,82,5,100,118,74,95,82,6,100,118,74,72,95,82,6,
+100,118,78,89,95,82,6,100,118,84,84,95,82,7,100,118,84,84,72,95,82,6,100,
+118,68,68,95,82,7,100,118,68,68,72,95,82,6,100,118,78,78,95,82,5,100,118,
+84,95,82,6,100,118,84,72,95,82,5,100,118,68,95,82,6,100,118,68,72,95,82,5,
+100,118,78,95,82,5,100,118,80,95,82,6,100,118,80,72,95,82,5,100,118,66,95,
+82,6,100,118,66,72,95,82,5,100,118,77,95,82,5,100,118,89,95,82,5,100,118,
+82,95,82,5,100,118,76,95,82,5,100,118,86,95,82,6,100,118,83,72,95,82,6,100,
+118,83,83,95,82,5,100,118,83,95,82,5,100,118,72,95,82,6,100,118,76,76,95,
+82,8,100,118,75,95,83,83,95,82,8,100,118,74,95,78,89,95,82,6,100,118,75,120,
+95,82,7,100,118,75,72,120,95,82,6,100,118,71,120,95,82,7,100,118,71,72,120,
+95,82,7,100,118,78,71,120,95,82,6,100,118,67,120,95,82,7,100,118,67,72,120,
+95,82,6,100,118,74,120,95,82,7,100,118,74,72,120,95,82,7,100,118,78,89,120,
+95,82,7,100,118,84,84,120,95,82,8,100,118,84,84,72,120,95,82,7,100,118,68,
+68,120,95,82,8,100,118,68,68,72,120,95,82,7,100,118,78,78,120,95,82,6,100,
+118,84,120,95,82,7,100,118,84,72,120,95,82,6,100,118,68,120,95,82,7,100,118,
+68,72,120,95,82,6,100,118,78,120,95,82,6,100,118,80,120,95,82,7,100,118,80,
+72,120,95,82,6,100,118,66,120,95,82,7,100,118,66,72,120,95,82,6,100,118,77,
+120,95,82,6,100,118,89,120,95,82,6,100,118,82,120,95,82,6,100,118,76,120,
+95,82,6,100,118,86,120,95,82,7,100,118,83,72,120,95,82,7,100,118,83,83,120,
+95,82,6,100,118,83,120,95,82,6,100,118,72,120,95,82,7,100,118,76,76,120,95,
+82,6,100,118,75,95,84,65,7,100,118,78,71,95,89,65,7,100,118,67,72,95,89,65,
+8,100,118,84,84,95,84,84,65,9,100,118,84,84,95,84,84,72,65,7,100,118,84,84,
+95,89,65,10,100,118,84,84,72,95,84,84,72,65,8,100,118,84,84,72,95,89,65,8,
+100,118,68,68,95,68,68,65,9,100,118,68,68,95,68,68,72,65,7,100,118,68,68,
+95,89,65,10,100,118,68,68,72,95,68,68,72,65,8,100,118,68,68,72,95,89,65,6,
+100,118,84,95,84,65,5,100,118,84,95,84,6,100,118,68,95,71,65,7,100,118,68,
+95,71,72,65,6,100,118,68,95,68,65,7,100,118,68,95,68,72,65,9,100,118,68,95,
+68,72,95,89,65,6,100,118,68,95,66,65,7,100,118,68,95,66,72,65,6,100,118,68,
+95,77,65,6,100,118,68,95,89,65,5,100,118,68,95,89,6,100,118,68,95,86,65,6,
+100,118,86,95,89,65,7,100,118,83,72,95,67,65,6,100,118,83,72,95,67,7,100,
+118,83,72,95,76,65,7,100,118,83,72,95,86,65,6,100,118,83,72,95,86,8,100,118,
+83,83,95,84,84,65,9,100,118,83,83,95,84,84,72,65,7,100,118,72,95,78,78,65,
+6,100,118,72,95,78,65,6,100,118,72,95,77,65,6,100,118,72,95,89,65,6,100,118,
+72,95,76,65,6,100,118,72,95,86,65,19,100,118,67,97,110,100,114,97,98,105,
+110,100,117,46,115,109,97,108,108,15,100,118,82,101,112,104,95,65,110,117,
+115,118,97,114,97,14,100,118,109,73,73,95,65,110,117,115,118,97,114,97,10,
+100,118,109,73,73,95,82,101,112,104,19,100,118,109,73,73,95,82,101,112,104,
+95,65,110,117,115,118,97,114,97,13,100,118,109,69,95,65,110,117,115,118,97,
+114,97,9,100,118,109,69,95,82,101,112,104,18,100,118,109,69,95,82,101,112,
+104,95,65,110,117,115,118,97,114,97,14,100,118,109,65,73,95,65,110,117,115,
+118,97,114,97,10,100,118,109,65,73,95,82,101,112,104,19,100,118,109,65,73,
+95,82,101,112,104,95,65,110,117,115,118,97,114,97,13,100,118,109,79,95,65,
+110,117,115,118,97,114,97,9,100,118,109,79,95,82,101,112,104,18,100,118,109,
+79,95,82,101,112,104,95,65,110,117,115,118,97,114,97,14,100,118,109,65,85,
+95,65,110,117,115,118,97,114,97,10,100,118,109,65,85,95,82,101,112,104,19,
+100,118,109,65,85,95,82,101,112,104,95,65,110,117,115,118,97,114,97,19,100,
+118,109,69,99,97,110,100,114,97,95,65,110,117,115,118,97,114,97,15,100,118,
+109,69,99,97,110,100,114,97,95,82,101,112,104,24,100,118,109,69,99,97,110,
+100,114,97,95,82,101,112,104,95,65,110,117,115,118,97,114,97,19,100,118,109,
+79,99,97,110,100,114,97,95,65,110,117,115,118,97,114,97,15,100,118,109,79,
+99,97,110,100,114,97,95,82,101,112,104,24,100,118,109,79,99,97,110,100,114,
+97,95,82,101,112,104,95,65,110,117,115,118,97,114,97,18,100,118,109,69,115,
+104,111,114,116,95,65,110,117,115,118,97,114,97,14,100,118,109,69,115,104,
+111,114,116,95,82,101,112,104,23,100,118,109,69,115,104,111,114,116,95,82,
+101,112,104,95,65,110,117,115,118,97,114,97,18,100,118,109,79,115,104,111,
+114,116,95,65,110,117,115,118,97,114,97,14,100,118,109,79,115,104,111,114,
+116,95,82,101,112,104,23,100,118,109,79,115,104,111,114,116,95,82,101,112,
+104,95,65,110,117,115,118,97,114,97,7,100,118,109,73,46,48,49,7,100,118,109,
+73,46,48,50,7,100,118,109,73,46,48,51,7,100,118,109,73,46,48,52,7,100,118,
+109,73,46,48,53,7,100,118,109,73,46,48,54,7,100,118,109,73,46,48,55,7,100,
+118,109,73,46,48,56,7,100,118,109,73,46,48,57,7,100,118,109,73,46,49,48,7,
+100,118,109,73,46,49,49,7,100,118,109,73,46,49,50,16,100,118,109,73,95,65,
+110,117,115,118,97,114,97,46,48,49,16,100,118,109,73,95,65,110,117,115,118,
+97,114,97,46,48,50,16,100,118,109,73,95,65,110,117,115,118,97,114,97,46,48,
+51,16,100,118,109,73,95,65,110,117,115,118,97,114,97,46,48,52,16,100,118,
+109,73,95,65,110,117,115,118,97,114,97,46,48,53,16,100,118,109,73,95,65,110,
+117,115,118,97,114,97,46,48,54,16,100,118,109,73,95,65,110,117,115,118,97,
+114,97,46,48,55,16,100,118,109,73,95,65,110,117,115,118,97,114,97,46,48,56,
+16,100,118,109,73,95,65,110,117,115,118,97,114,97,46,48,57,16,100,118,109,
+73,95,65,110,117,115,118,97,114,97,46,49,48,16,100,118,109,73,95,65,110,117,
+115,118,97,114,97,46,49,49,16,100,118,109,73,95,65,110,117,115,118,97,114,
+97,46,49,50,12,100,118,109,73,95,82,101,112,104,46,48,49,12,100,118,109,73,
+95,82,101,112,104,46,48,50,12,100,118,109,73,95,82,101,112,104,46,48,51,12,
+100,118,109,73,95,82,101,112,104,46,48,52,12,100,118,109,73,95,82,101,112,
+104,46,48,53,12,100,118,109,73,95,82,101,112,104,46,48,54,12,100,118,109,
+73,95,82,101,112,104,46,48,55,12,100,118,109,73,95,82,101,112,104,46,48,56,
+12,100,118,109,73,95,82,101,112,104,46,48,57,12,100,118,109,73,95,82,101,
+112,104,46,49,48,12,100,118,109,73,95,82,101,112,104,46,49,49,12,100,118,
+109,73,95,82,101,112,104,46,49,50,21,100,118,109,73,95,82,101,112,104,95,
+65,110,117,115,118,97,114,97,46,48,49,21,100,118,109,73,95,82,101,112,104,
+95,65,110,117,115,118,97,114,97,46,48,50,21,100,118,109,73,95,82,101,112,
+104,95,65,110,117,115,118,97,114,97,46,48,51,21,100,118,109,73,95,82,101,
+112,104,95,65,110,117,115,118,97,114,97,46,48,52,21,100,118,109,73,95,82,
+101,112,104,95,65,110,117,115,118,97,114,97,46,48,53,21,100,118,109,73,95,
+82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,54,21,100,118,109,73,
+95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,55,21,100,118,109,
+73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,56,21,100,118,
+109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,57,21,100,
+118,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,49,48,21,
+100,118,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,49,49,
+21,100,118,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,49,
+50,8,100,118,109,73,73,46,48,49,8,100,118,109,73,73,46,48,50,8,100,118,109,
+73,73,46,48,51,17,100,118,109,73,73,95,65,110,117,115,118,97,114,97,46,48,
+49,17,100,118,109,73,73,95,65,110,117,115,118,97,114,97,46,48,50,17,100,118,
+109,73,73,95,65,110,117,115,118,97,114,97,46,48,51,13,100,118,109,73,73,95,
+82,101,112,104,46,48,49,13,100,118,109,73,73,95,82,101,112,104,46,48,50,13,
+100,118,109,73,73,95,82,101,112,104,46,48,51,22,100,118,109,73,73,95,82,101,
+112,104,95,65,110,117,115,118,97,114,97,46,48,49,22,100,118,109,73,73,95,
+82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,50,22,100,118,109,73,
+73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,51,13,100,118,
+73,73,95,65,110,117,115,118,97,114,97,13,100,118,65,73,95,65,110,117,115,
+118,97,114,97,12,100,118,79,95,65,110,117,115,118,97,114,97,13,100,118,65,
+85,95,65,110,117,115,118,97,114,97,18,100,118,65,99,97,110,100,114,97,95,
+65,110,117,115,118,97,114,97,18,100,118,69,99,97,110,100,114,97,95,65,110,
+117,115,118,97,114,97,18,100,118,79,99,97,110,100,114,97,95,65,110,117,115,
+118,97,114,97,17,100,118,65,115,104,111,114,116,95,65,110,117,115,118,97,
+114,97,17,100,118,69,115,104,111,114,116,95,65,110,117,115,118,97,114,97,
+17,100,118,79,115,104,111,114,116,95,65,110,117,115,118,97,114,97,19,100,
+118,73,73,95,78,117,107,116,97,95,65,110,117,115,118,97,114,97,19,100,118,
+65,73,95,78,117,107,116,97,95,65,110,117,115,118,97,114,97,18,100,118,79,
+95,78,117,107,116,97,95,65,110,117,115,118,97,114,97,19,100,118,65,85,95,
+78,117,107,116,97,95,65,110,117,115,118,97,114,97,24,100,118,65,99,97,110,
+100,114,97,95,78,117,107,116,97,95,65,110,117,115,118,97,114,97,24,100,118,
+69,99,97,110,100,114,97,95,78,117,107,116,97,95,65,110,117,115,118,97,114,
+97,24,100,118,79,99,97,110,100,114,97,95,78,117,107,116,97,95,65,110,117,
+115,118,97,114,97,23,100,118,65,115,104,111,114,116,95,78,117,107,116,97,
+95,65,110,117,115,118,97,114,97,23,100,118,69,115,104,111,114,116,95,78,117,
+107,116,97,95,65,110,117,115,118,97,114,97,23,100,118,79,115,104,111,114,
+116,95,78,117,107,116,97,95,65,110,117,115,118,97,114,97,7,100,118,68,65,
+95,109,85,8,100,118,68,65,95,109,85,85,8,100,118,68,65,95,109,118,82,8,100,
+118,68,120,65,95,109,85,9,100,118,68,120,65,95,109,85,85,9,100,118,68,120,
+65,95,109,118,82,7,100,118,82,65,95,109,85,8,100,118,82,65,95,109,85,85,8,
+100,118,82,120,65,95,109,85,9,100,118,82,120,65,95,109,85,85,7,100,118,72,
+65,95,109,85,8,100,118,72,65,95,109,85,85,8,100,118,72,65,95,109,118,82,9,
+100,118,72,65,95,109,118,82,82,8,100,118,72,120,65,95,109,85,9,100,118,72,
+120,65,95,109,85,85,9,100,118,72,120,65,95,109,118,82,10,100,118,72,120,65,
+95,109,118,82,82,9,100,118,72,95,82,65,95,109,85,10,100,118,72,95,82,65,95,
+109,85,85,10,100,118,78,117,107,116,97,95,109,85,11,100,118,78,117,107,116,
+97,95,109,85,85,11,100,118,78,117,107,116,97,95,109,118,82,12,100,118,78,
+117,107,116,97,95,109,118,82,82,11,100,118,78,117,107,116,97,95,109,118,76,
+12,100,118,78,117,107,116,97,95,109,118,76,76,14,100,118,78,117,107,116,97,
+95,86,105,114,97,109,97,9,100,118,82,65,99,50,95,109,85,10,100,118,82,65,
+99,50,95,109,85,85,10,100,118,82,65,99,50,95,109,118,82,11,100,118,82,65,
+99,50,95,109,118,82,82,10,100,118,82,65,99,50,95,109,118,76,11,100,118,82,
+65,99,50,95,109,118,76,76,13,100,118,82,65,99,50,95,86,105,114,97,109,97,
+8,100,118,76,65,46,77,65,82,9,100,118,76,120,65,46,77,65,82,10,100,118,76,
+95,82,65,46,77,65,82,11,100,118,76,120,95,82,65,46,77,65,82,11,100,118,83,
+72,95,76,65,46,77,65,82,9,100,118,83,72,65,46,77,65,82,10,100,118,83,72,120,
+65,46,77,65,82,8,100,118,83,72,46,77,65,82,9,100,118,83,72,120,46,77,65,82,
+6,109,97,99,114,111,110,7,117,110,105,48,50,66,67,4,95,55,49,56,4,95,55,49,
+52,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,0,0,2,0,16,0,32,
+0,39,0,3,0,42,0,42,0,3,0,44,0,44,0,3,0,46,0,48,0,3,0,52,0,52,0,3,0,96,0,97,
+0,3,0,99,0,100,0,3,0,108,0,108,0,3,1,3,1,3,0,3,1,5,1,5,0,3,2,0,2,1,0,3,2,
+5,2,10,0,3,2,17,2,19,0,3,2,23,2,25,0,3,2,129,2,130,0,3,2,136,2,142,0,3,0,
+1,0,0,0,10,0,104,0,226,0,3,68,70,76,84,0,20,100,101,118,50,0,34,100,101,118,
+97,0,64,0,4,0,0,0,0,255,255,0,2,0,0,0,5,0,10,0,1,77,65,82,32,0,20,0,0,255,
+255,0,2,0,1,0,6,0,0,255,255,0,2,0,2,0,7,0,10,0,1,77,65,82,32,0,20,0,0,255,
+255,0,2,0,3,0,8,0,0,255,255,0,2,0,4,0,9,0,10,97,98,118,109,0,62,97,98,118,
+109,0,68,97,98,118,109,0,74,97,98,118,109,0,80,97,98,118,109,0,86,98,108,
+119,109,0,92,98,108,119,109,0,98,98,108,119,109,0,104,98,108,119,109,0,110,
+98,108,119,109,0,116,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,
+0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,1,0,0,0,1,0,1,0,0,0,1,0,1,0,0,0,1,0,1,0,2,0,
+6,0,14,0,4,0,0,0,1,0,16,0,4,0,0,0,1,2,122,0,1,4,134,4,186,0,1,0,12,0,110,
+0,24,0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,130,
+0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,130,0,0,
+1,130,0,0,1,130,0,0,1,130,0,0,1,130,0,0,1,124,0,0,1,124,0,0,1,124,0,0,1,124,
+0,0,1,124,0,0,1,124,0,140,1,38,1,44,1,50,1,56,1,56,1,62,1,62,1,68,1,74,1,
+80,1,86,1,92,1,98,1,80,1,104,1,110,1,116,1,122,1,74,1,128,1,134,1,38,1,44,
+1,50,1,56,1,56,1,62,1,62,1,68,1,74,1,80,1,86,1,92,1,98,1,80,1,104,1,110,1,
+116,1,122,1,128,1,134,1,80,1,92,1,98,1,80,1,104,1,110,1,122,1,80,1,92,1,98,
+1,80,1,104,1,110,1,122,1,74,1,80,1,86,1,92,1,98,1,80,1,104,1,110,1,116,1,
+122,1,128,1,134,1,74,1,80,1,86,1,92,1,98,1,80,1,104,1,110,1,116,1,122,1,128,
+1,134,1,80,1,92,1,98,1,80,1,104,1,110,1,122,1,128,1,80,1,92,1,98,1,80,1,104,
+1,110,1,122,1,128,1,140,1,146,1,146,1,152,1,158,1,158,1,164,1,110,1,170,1,
+176,1,182,1,188,1,194,1,200,1,206,1,206,1,212,1,218,1,224,1,218,1,110,1,110,
+1,110,1,110,1,110,1,110,1,230,1,236,1,230,1,236,1,128,1,128,1,128,1,128,1,
+128,1,128,1,128,1,128,1,242,1,242,1,248,1,248,1,248,1,248,1,254,0,1,255,106,
+4,250,0,1,255,86,4,250,0,1,2,195,4,250,0,1,2,65,4,250,0,1,3,2,4,250,0,1,3,
+148,4,250,0,1,3,254,4,250,0,1,2,70,4,250,0,1,3,72,4,250,0,1,3,50,4,250,0,
+1,3,205,4,250,0,1,3,10,4,250,0,1,2,194,4,250,0,1,3,53,4,250,0,1,2,228,4,250,
+0,1,3,89,4,250,0,1,2,30,4,250,0,1,3,17,4,250,0,1,4,50,4,250,0,1,3,248,4,250,
+0,1,3,28,4,250,0,1,2,197,4,250,0,1,3,67,4,250,0,1,3,64,4,250,0,1,3,192,4,
+250,0,1,2,213,4,250,0,1,3,219,4,250,0,1,2,243,4,250,0,1,4,31,4,250,0,1,2,
+238,4,250,0,1,3,151,4,250,0,1,3,124,4,250,0,1,3,84,4,250,0,1,3,114,4,250,
+0,1,2,108,4,250,0,1,2,140,4,250,0,1,3,58,4,250,0,1,3,253,4,250,0,1,7,45,4,
+250,0,1,3,100,3,140,0,1,0,12,0,94,0,20,0,0,0,226,0,0,0,226,0,0,0,226,0,0,
+0,226,0,0,0,220,0,0,0,220,0,0,0,232,0,0,0,232,0,0,0,226,0,0,0,238,0,0,0,214,
+0,0,0,226,0,0,0,226,0,0,0,214,0,0,0,214,0,0,0,214,0,0,0,214,0,0,0,214,0,0,
+0,214,0,0,0,214,0,65,0,162,0,168,0,174,0,180,0,186,0,168,0,192,0,198,0,204,
+0,162,0,198,0,204,0,174,0,204,0,204,0,162,0,210,0,216,0,222,0,228,0,234,0,
+240,0,246,0,198,0,252,1,2,1,8,0,210,1,14,0,222,0,228,0,234,0,240,0,252,1,
+20,1,26,1,32,1,38,1,44,1,50,1,56,1,62,1,68,1,74,1,80,1,86,1,92,1,98,1,104,
+1,110,1,116,1,122,1,122,1,128,1,134,1,140,1,140,1,146,1,152,1,158,1,158,1,
+164,1,170,1,170,1,176,0,1,255,105,255,170,0,1,255,87,0,0,0,1,255,86,0,0,0,
+1,254,182,0,0,0,1,253,246,254,244,0,1,3,72,0,0,0,1,2,195,255,190,0,1,2,240,
+255,186,0,1,2,125,255,235,0,1,2,145,255,226,0,1,2,175,255,176,0,1,3,89,0,
+0,0,1,4,50,0,53,0,1,2,213,254,107,0,1,2,250,254,107,0,1,2,131,254,150,0,1,
+2,193,254,140,0,1,2,168,254,108,0,1,2,189,254,86,0,1,3,123,255,209,0,1,2,
+18,254,93,0,1,2,200,255,180,0,1,4,108,254,242,0,1,2,243,254,107,0,1,4,111,
+254,247,0,1,3,248,0,0,0,1,2,143,253,213,0,1,2,137,253,213,0,1,2,158,253,213,
+0,1,2,212,253,213,0,1,2,170,253,213,0,1,2,186,253,213,0,1,3,235,255,166,0,
+1,4,208,255,162,0,1,3,120,255,115,0,1,4,233,255,164,0,1,4,1,255,164,0,1,5,
+45,255,164,0,1,4,228,255,145,0,1,3,194,255,145,0,1,3,252,255,164,0,1,4,151,
+255,218,0,1,2,195,255,162,0,1,2,184,255,162,0,1,2,208,255,179,0,1,4,200,255,
+148,0,1,4,190,255,90,0,1,2,202,255,176,0,1,3,229,255,208,0,1,3,79,254,123,
+0,1,7,21,255,208,0,1,0,24,0,38,0,39,0,42,0,44,0,48,0,52,0,96,0,97,0,108,1,
+3,2,0,2,1,2,5,2,6,2,7,2,8,2,9,2,10,2,17,2,18,2,19,2,23,2,24,2,25,0,1,0,140,
+0,6,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,53,0,57,0,59,0,63,0,64,0,65,0,66,0,
+70,0,74,0,79,0,81,0,85,0,86,0,207,0,209,0,210,0,211,0,212,0,213,0,214,0,215,
+0,225,0,229,0,231,0,235,0,236,0,237,0,238,0,242,0,246,0,251,1,1,1,2,1,10,
+1,16,1,17,1,18,1,19,1,23,1,32,1,46,1,52,1,53,1,54,1,55,1,59,1,68,1,76,1,80,
+1,82,1,86,1,87,1,88,1,89,1,93,1,97,1,102,1,108,1,109,1,112,1,116,1,118,1,
+122,1,123,1,124,1,125,1,129,1,133,1,138,1,144,1,145,1,150,1,156,1,157,1,158,
+1,159,1,163,1,172,1,178,1,186,1,192,1,193,1,194,1,195,1,199,1,208,1,214,1,
+216,1,219,1,220,1,222,1,224,1,225,1,227,1,231,1,232,1,233,1,234,1,236,1,237,
+1,241,1,248,1,249,1,250,1,251,1,254,1,255,2,109,2,110,2,111,2,112,2,113,2,
+114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,126,
+2,127,2,128,2,143,2,144,2,145,2,146,2,147,0,2,0,6,0,32,0,37,0,0,0,46,0,47,
+0,6,0,99,0,100,0,8,1,5,1,5,0,10,2,129,2,130,0,11,2,136,2,142,0,13,0,1,0,65,
+0,53,0,57,0,59,0,63,0,64,0,65,0,66,0,74,0,86,0,225,0,246,1,2,1,12,1,39,1,
+75,1,76,1,80,1,82,1,86,1,87,1,88,1,89,1,93,1,97,1,102,1,108,1,109,1,116,1,
+118,1,122,1,123,1,124,1,125,1,138,1,145,1,216,1,219,1,220,1,222,1,224,1,225,
+1,227,1,231,1,232,1,233,1,234,1,236,1,237,1,238,1,239,1,241,1,243,1,246,1,
+248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,143,2,145,2,146,2,147,0,1,
+0,0,0,10,0,204,4,16,0,3,68,70,76,84,0,20,100,101,118,50,0,54,100,101,118,
+97,0,126,0,4,0,0,0,0,255,255,0,12,0,0,0,5,0,10,0,15,0,20,0,23,0,28,0,35,0,
+40,0,45,0,50,0,53,0,10,0,1,77,65,82,32,0,40,0,0,255,255,0,12,0,1,0,6,0,11,
+0,16,0,21,0,24,0,29,0,36,0,41,0,46,0,51,0,54,0,0,255,255,0,13,0,2,0,7,0,12,
+0,17,0,22,0,25,0,30,0,33,0,37,0,42,0,47,0,52,0,55,0,10,0,1,77,65,82,32,0,
+38,0,0,255,255,0,11,0,3,0,8,0,13,0,18,0,26,0,31,0,38,0,43,0,48,0,56,0,58,
+0,0,255,255,0,12,0,4,0,9,0,14,0,19,0,27,0,32,0,34,0,39,0,44,0,49,0,57,0,59,
+0,60,97,98,118,115,1,106,97,98,118,115,1,116,97,98,118,115,1,126,97,98,118,
+115,1,136,97,98,118,115,1,146,97,107,104,110,1,156,97,107,104,110,1,164,97,
+107,104,110,1,172,97,107,104,110,1,180,97,107,104,110,1,188,98,108,119,102,
+1,196,98,108,119,102,1,202,98,108,119,102,1,208,98,108,119,102,1,214,98,108,
+119,102,1,220,98,108,119,115,1,226,98,108,119,115,1,238,98,108,119,115,1,
+250,98,108,119,115,2,6,98,108,119,115,2,24,99,106,99,116,2,42,99,106,99,116,
+2,48,99,106,99,116,2,54,104,97,108,102,2,60,104,97,108,102,2,68,104,97,108,
+102,2,76,104,97,108,102,2,84,104,97,108,102,2,90,104,97,108,110,2,96,104,
+97,108,110,2,102,104,97,108,110,2,108,104,97,108,110,2,114,104,97,108,110,
+2,120,108,111,99,108,2,126,108,111,99,108,2,132,110,117,107,116,2,140,110,
+117,107,116,2,146,110,117,107,116,2,152,110,117,107,116,2,158,110,117,107,
+116,2,164,112,114,101,115,2,170,112,114,101,115,2,178,112,114,101,115,2,186,
+112,114,101,115,2,194,112,114,101,115,2,204,112,115,116,115,2,214,112,115,
+116,115,2,224,112,115,116,115,2,234,112,115,116,115,2,244,112,115,116,115,
+2,254,114,107,114,102,3,8,114,107,114,102,3,14,114,107,114,102,3,20,114,112,
+104,102,3,26,114,112,104,102,3,32,114,112,104,102,3,38,114,112,104,102,3,
+44,114,112,104,102,3,50,118,97,116,117,3,56,118,97,116,117,3,62,0,0,0,3,0,
+17,0,18,0,19,0,0,0,3,0,17,0,18,0,19,0,0,0,3,0,17,0,18,0,19,0,0,0,3,0,17,0,
+18,0,19,0,0,0,3,0,17,0,18,0,19,0,0,0,2,0,3,0,4,0,0,0,2,0,3,0,4,0,0,0,2,0,
+3,0,4,0,0,0,2,0,3,0,4,0,0,0,2,0,3,0,4,0,0,0,1,0,7,0,0,0,1,0,7,0,0,0,1,0,7,
+0,0,0,1,0,8,0,0,0,1,0,8,0,0,0,4,0,25,0,27,0,28,0,29,0,0,0,4,0,25,0,27,0,28,
+0,29,0,0,0,4,0,25,0,27,0,28,0,29,0,0,0,7,0,22,0,23,0,24,0,25,0,27,0,28,0,
+29,0,0,0,7,0,22,0,23,0,24,0,25,0,27,0,28,0,29,0,0,0,1,0,12,0,0,0,1,0,12,0,
+0,0,1,0,12,0,0,0,2,0,9,0,10,0,0,0,2,0,9,0,10,0,0,0,2,0,9,0,10,0,0,0,1,0,9,
+0,0,0,1,0,9,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,
+33,0,0,0,1,0,0,0,0,0,2,0,0,0,1,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,
+1,0,2,0,0,0,1,0,2,0,0,0,2,0,13,0,14,0,0,0,2,0,13,0,14,0,0,0,2,0,13,0,14,0,
+0,0,3,0,12,0,13,0,14,0,0,0,3,0,12,0,13,0,14,0,0,0,3,0,30,0,31,0,32,0,0,0,
+3,0,30,0,31,0,32,0,0,0,3,0,30,0,31,0,32,0,0,0,3,0,30,0,31,0,32,0,0,0,3,0,
+30,0,31,0,32,0,0,0,1,0,6,0,0,0,1,0,6,0,0,0,1,0,6,0,0,0,1,0,5,0,0,0,1,0,5,
+0,0,0,1,0,5,0,0,0,1,0,5,0,0,0,1,0,5,0,0,0,1,0,11,0,0,0,1,0,11,0,56,0,114,
+0,122,0,130,0,138,0,146,0,156,0,164,0,172,0,180,0,188,0,196,0,204,0,212,0,
+220,0,228,1,0,1,14,1,22,1,30,1,38,1,46,1,54,1,62,1,70,1,78,1,86,1,94,1,102,
+1,110,1,118,1,126,1,144,1,154,1,166,1,174,1,182,1,190,1,198,1,206,1,214,1,
+222,1,230,1,238,1,246,1,254,2,6,2,14,2,22,2,30,2,38,2,46,2,54,2,62,2,70,2,
+78,2,86,0,1,0,0,0,1,1,236,0,1,0,0,0,1,1,242,0,4,0,0,0,1,1,250,0,4,0,0,0,1,
+4,152,0,6,0,0,0,2,4,178,4,196,0,4,0,0,0,1,4,206,0,4,0,0,0,1,4,216,0,4,0,0,
+0,1,8,58,0,4,0,0,0,1,8,68,0,4,0,0,0,1,8,78,0,4,0,0,0,1,11,40,0,4,0,0,0,1,
+13,198,0,4,0,0,0,1,18,236,0,4,0,0,0,1,19,224,0,6,0,0,0,11,20,182,20,200,20,
+218,20,236,20,254,21,16,21,34,21,52,21,70,21,88,21,106,0,6,0,0,0,4,21,96,
+21,114,21,132,21,150,0,1,0,0,0,1,21,154,0,6,0,0,0,1,21,160,0,4,0,0,0,1,21,
+174,0,6,0,0,0,1,23,182,0,1,0,0,0,1,23,192,0,2,0,0,0,1,23,194,0,6,0,0,0,1,
+23,208,0,6,0,0,0,1,23,218,0,4,0,0,0,1,23,232,0,4,0,0,0,1,24,22,0,1,0,0,0,
+1,24,208,0,6,0,0,0,1,24,236,0,4,0,0,0,1,24,250,0,4,0,0,0,1,25,112,0,6,0,0,
+0,6,25,254,26,18,26,38,26,58,26,80,26,102,0,6,0,0,0,2,26,106,26,126,0,6,0,
+8,0,3,26,138,26,156,26,174,0,4,0,0,0,1,26,180,0,4,0,0,0,1,28,26,0,1,0,0,0,
+1,28,38,0,1,0,0,0,1,28,36,0,1,0,0,0,1,28,34,0,1,0,0,0,1,28,32,0,1,0,0,0,1,
+28,30,0,1,0,0,0,1,28,28,0,1,0,0,0,1,28,26,0,1,0,0,0,1,28,24,0,1,0,0,0,1,28,
+22,0,1,0,0,0,1,28,20,0,1,0,0,0,1,28,18,0,1,0,0,0,1,28,20,0,1,0,0,0,1,28,18,
+0,1,0,0,0,1,28,16,0,1,0,0,0,1,28,42,0,1,0,0,0,1,28,40,0,1,0,0,0,1,28,38,0,
+1,0,0,0,1,28,36,0,1,0,0,0,1,28,34,0,1,0,8,0,1,28,70,0,1,0,8,0,1,28,76,0,2,
+28,82,0,4,2,143,2,148,2,144,2,149,0,2,28,80,0,5,2,150,2,151,2,145,2,146,2,
+147,0,1,28,78,0,56,0,118,0,128,0,138,0,148,0,158,0,168,0,178,0,188,0,198,
+0,208,0,218,0,228,0,238,0,248,1,2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,
+1,92,1,102,1,112,1,122,1,132,1,142,1,152,1,162,1,172,1,182,1,192,1,202,1,
+212,1,222,1,232,1,242,1,252,2,6,2,16,2,26,2,36,2,46,2,56,2,66,2,76,2,86,2,
+96,2,106,2,116,2,126,2,136,2,146,2,156,0,1,0,4,0,205,0,2,0,100,0,1,0,4,0,
+206,0,2,0,100,0,1,0,4,0,207,0,2,0,100,0,1,0,4,0,208,0,2,0,100,0,1,0,4,0,209,
+0,2,0,100,0,1,0,4,0,210,0,2,0,100,0,1,0,4,0,211,0,2,0,100,0,1,0,4,0,212,0,
+2,0,100,0,1,0,4,0,213,0,2,0,100,0,1,0,4,0,214,0,2,0,100,0,1,0,4,0,215,0,2,
+0,100,0,1,0,4,0,216,0,2,0,100,0,1,0,4,0,217,0,2,0,100,0,1,0,4,0,218,0,2,0,
+100,0,1,0,4,0,219,0,2,0,100,0,1,0,4,0,220,0,2,0,100,0,1,0,4,0,221,0,2,0,100,
+0,1,0,4,0,222,0,2,0,100,0,1,0,4,0,223,0,2,0,100,0,1,0,4,0,224,0,2,0,100,0,
+1,0,4,0,225,0,2,0,100,0,1,0,4,0,226,0,2,0,100,0,1,0,4,0,227,0,2,0,100,0,1,
+0,4,0,228,0,2,0,100,0,1,0,4,0,229,0,2,0,100,0,1,0,4,0,230,0,2,0,100,0,1,0,
+4,0,231,0,2,0,100,0,1,0,4,0,232,0,2,0,100,0,1,0,4,0,233,0,2,0,100,0,1,0,4,
+0,234,0,2,0,100,0,1,0,4,0,235,0,2,0,100,0,1,0,4,0,236,0,2,0,100,0,1,0,4,0,
+237,0,2,0,100,0,1,0,4,0,238,0,2,0,100,0,1,0,4,0,239,0,2,0,100,0,1,0,4,0,240,
+0,2,0,100,0,1,0,4,0,241,0,2,0,100,0,1,0,4,0,242,0,2,0,100,0,1,0,4,0,243,0,
+2,0,100,0,1,0,4,0,244,0,2,0,100,0,1,0,4,0,245,0,2,0,100,0,1,0,4,0,246,0,2,
+0,100,0,1,0,4,0,247,0,2,0,100,0,1,0,4,0,248,0,2,0,100,0,1,0,4,0,249,0,2,0,
+100,0,1,0,4,0,250,0,2,0,100,0,1,0,4,0,251,0,2,0,100,0,1,0,4,0,252,0,2,0,100,
+0,1,0,4,0,253,0,2,0,100,0,1,0,4,0,254,0,2,0,100,0,1,0,4,0,255,0,2,0,100,0,
+1,0,4,1,0,0,2,0,100,0,1,0,4,1,1,0,2,0,100,0,1,0,4,1,2,0,2,0,100,0,1,0,4,2,
+144,0,2,0,100,0,1,0,4,2,149,0,2,0,100,0,1,25,196,0,2,0,10,0,22,0,1,0,4,0,
+87,0,3,0,99,0,83,0,1,0,4,0,88,0,3,0,99,0,62,0,3,0,1,25,170,0,3,25,176,25,
+170,25,182,0,0,0,0,0,3,0,0,0,3,25,158,25,152,25,164,0,0,0,1,0,0,0,34,0,1,
+25,138,0,1,0,8,0,1,0,4,1,3,0,2,0,99,0,1,25,132,0,62,0,130,0,142,0,154,0,166,
+0,178,0,190,0,202,0,214,0,226,0,238,0,250,1,6,1,18,1,30,1,42,1,54,1,66,1,
+78,1,90,1,102,1,114,1,126,1,138,1,150,1,162,1,174,1,186,1,198,1,210,1,222,
+1,234,1,246,2,2,2,14,2,26,2,38,2,50,2,62,2,74,2,86,2,98,2,110,2,122,2,134,
+2,146,2,158,2,170,2,182,2,194,2,206,2,218,2,230,2,242,2,254,3,10,3,22,3,34,
+3,46,3,58,3,70,3,82,3,94,0,1,0,4,1,76,0,3,0,99,0,79,0,1,0,4,1,77,0,3,0,99,
+0,79,0,1,0,4,1,78,0,3,0,99,0,79,0,1,0,4,1,79,0,3,0,99,0,79,0,1,0,4,1,81,0,
+3,0,99,0,79,0,1,0,4,1,82,0,3,0,99,0,79,0,1,0,4,1,83,0,3,0,99,0,79,0,1,0,4,
+1,84,0,3,0,99,0,79,0,1,0,4,1,85,0,3,0,99,0,79,0,1,0,4,1,90,0,3,0,99,0,79,
+0,1,0,4,1,91,0,3,0,99,0,79,0,1,0,4,1,92,0,3,0,99,0,79,0,1,0,4,1,93,0,3,0,
+99,0,79,0,1,0,4,1,94,0,3,0,99,0,79,0,1,0,4,1,95,0,3,0,99,0,79,0,1,0,4,1,96,
+0,3,0,99,0,79,0,1,0,4,1,97,0,3,0,99,0,79,0,1,0,4,1,98,0,3,0,99,0,79,0,1,0,
+4,1,99,0,3,0,99,0,79,0,1,0,4,1,100,0,3,0,99,0,79,0,1,0,4,1,101,0,3,0,99,0,
+79,0,1,0,4,1,103,0,3,0,99,0,79,0,1,0,4,1,104,0,3,0,99,0,79,0,1,0,4,1,105,
+0,3,0,99,0,79,0,1,0,4,1,106,0,3,0,99,0,79,0,1,0,4,1,107,0,3,0,99,0,79,0,1,
+0,4,1,108,0,3,0,99,0,79,0,1,0,4,1,109,0,3,0,99,0,79,0,1,0,4,1,110,0,3,0,99,
+0,79,0,1,0,4,1,111,0,3,0,99,0,79,0,1,0,4,1,112,0,3,0,99,0,79,0,1,0,4,1,113,
+0,3,0,99,0,79,0,1,0,4,1,114,0,3,0,99,0,79,0,1,0,4,1,115,0,3,0,99,0,79,0,1,
+0,4,1,117,0,3,0,99,0,79,0,1,0,4,1,118,0,3,0,99,0,79,0,1,0,4,1,119,0,3,0,99,
+0,79,0,1,0,4,1,120,0,3,0,99,0,79,0,1,0,4,1,121,0,3,0,99,0,79,0,1,0,4,1,126,
+0,3,0,99,0,79,0,1,0,4,1,127,0,3,0,99,0,79,0,1,0,4,1,128,0,3,0,99,0,79,0,1,
+0,4,1,129,0,3,0,99,0,79,0,1,0,4,1,130,0,3,0,99,0,79,0,1,0,4,1,131,0,3,0,99,
+0,79,0,1,0,4,1,132,0,3,0,99,0,79,0,1,0,4,1,133,0,3,0,99,0,79,0,1,0,4,1,134,
+0,3,0,99,0,79,0,1,0,4,1,135,0,3,0,99,0,79,0,1,0,4,1,136,0,3,0,99,0,79,0,1,
+0,4,1,137,0,3,0,99,0,79,0,1,0,4,1,139,0,3,0,99,0,79,0,1,0,4,1,140,0,3,0,99,
+0,79,0,1,0,4,1,141,0,3,0,99,0,79,0,1,0,4,1,142,0,3,0,99,0,79,0,1,0,4,1,143,
+0,3,0,99,0,79,0,1,0,4,1,144,0,3,0,99,0,79,0,1,0,4,1,145,0,3,0,99,0,79,0,1,
+0,4,2,145,0,3,0,99,0,79,0,1,0,4,2,146,0,3,0,99,0,79,0,1,0,4,1,105,0,3,0,99,
+0,79,0,1,0,4,1,141,0,3,0,99,0,79,0,1,22,8,0,1,0,8,0,1,0,4,1,5,0,2,0,79,0,
+1,21,252,0,1,0,8,0,1,0,4,1,5,0,2,0,99,0,1,22,54,0,61,0,128,0,138,0,148,0,
+158,0,168,0,178,0,188,0,198,0,208,0,218,0,228,0,238,0,248,1,2,1,12,1,22,1,
+32,1,42,1,52,1,62,1,72,1,82,1,92,1,102,1,112,1,122,1,132,1,142,1,152,1,162,
+1,172,1,182,1,192,1,202,1,212,1,222,1,232,1,242,1,252,2,6,2,16,2,26,2,36,
+2,46,2,56,2,66,2,76,2,86,2,96,2,106,2,116,2,126,2,136,2,146,2,156,2,166,2,
+176,2,186,2,196,2,206,2,216,0,1,0,4,1,6,0,2,0,99,0,1,0,4,1,7,0,2,0,99,0,1,
+0,4,1,8,0,2,0,99,0,1,0,4,1,9,0,2,0,99,0,1,0,4,1,11,0,2,0,99,0,1,0,4,1,12,
+0,2,0,99,0,1,0,4,1,13,0,2,0,99,0,1,0,4,1,14,0,2,0,99,0,1,0,4,1,15,0,2,0,99,
+0,1,0,4,1,20,0,2,0,99,0,1,0,4,1,21,0,2,0,99,0,1,0,4,1,22,0,2,0,99,0,1,0,4,
+1,24,0,2,0,99,0,1,0,4,1,25,0,2,0,99,0,1,0,4,1,26,0,2,0,99,0,1,0,4,1,27,0,
+2,0,99,0,1,0,4,1,28,0,2,0,99,0,1,0,4,1,29,0,2,0,99,0,1,0,4,1,30,0,2,0,99,
+0,1,0,4,1,31,0,2,0,99,0,1,0,4,1,33,0,2,0,99,0,1,0,4,1,34,0,2,0,99,0,1,0,4,
+1,35,0,2,0,99,0,1,0,4,1,36,0,2,0,99,0,1,0,4,1,37,0,2,0,99,0,1,0,4,1,38,0,
+2,0,99,0,1,0,4,1,39,0,2,0,99,0,1,0,4,1,40,0,2,0,99,0,1,0,4,1,41,0,2,0,99,
+0,1,0,4,1,42,0,2,0,99,0,1,0,4,1,43,0,2,0,99,0,1,0,4,1,44,0,2,0,99,0,1,0,4,
+1,45,0,2,0,99,0,1,0,4,1,47,0,2,0,99,0,1,0,4,1,48,0,2,0,99,0,1,0,4,1,49,0,
+2,0,99,0,1,0,4,1,50,0,2,0,99,0,1,0,4,1,51,0,2,0,99,0,1,0,4,1,56,0,2,0,99,
+0,1,0,4,1,57,0,2,0,99,0,1,0,4,1,58,0,2,0,99,0,1,0,4,1,60,0,2,0,99,0,1,0,4,
+1,61,0,2,0,99,0,1,0,4,1,62,0,2,0,99,0,1,0,4,1,63,0,2,0,99,0,1,0,4,1,64,0,
+2,0,99,0,1,0,4,1,65,0,2,0,99,0,1,0,4,1,66,0,2,0,99,0,1,0,4,1,67,0,2,0,99,
+0,1,0,4,1,4,0,2,0,99,0,1,0,4,1,69,0,2,0,99,0,1,0,4,1,70,0,2,0,99,0,1,0,4,
+1,71,0,2,0,99,0,1,0,4,1,72,0,2,0,99,0,1,0,4,1,73,0,2,0,99,0,1,0,4,1,74,0,
+2,0,99,0,1,0,4,1,75,0,2,0,99,0,1,0,4,1,33,0,2,0,99,0,1,0,4,1,69,0,2,0,99,
+0,1,0,4,2,150,0,2,0,99,0,1,0,4,2,151,0,2,0,99,0,1,19,154,0,56,0,118,0,128,
+0,138,0,148,0,158,0,168,0,178,0,188,0,198,0,208,0,218,0,228,0,238,0,248,1,
+2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,1,92,1,102,1,112,1,122,1,132,1,
+142,1,152,1,162,1,172,1,182,1,192,1,202,1,212,1,222,1,232,1,242,1,252,2,6,
+2,16,2,26,2,36,2,46,2,56,2,66,2,76,2,86,2,96,2,106,2,116,2,126,2,136,2,146,
+2,156,0,1,0,4,1,146,0,2,0,99,0,1,0,4,1,147,0,2,0,99,0,1,0,4,1,148,0,2,0,99,
+0,1,0,4,1,149,0,2,0,99,0,1,0,4,1,151,0,2,0,99,0,1,0,4,1,152,0,2,0,99,0,1,
+0,4,1,153,0,2,0,99,0,1,0,4,1,154,0,2,0,99,0,1,0,4,1,155,0,2,0,99,0,1,0,4,
+1,160,0,2,0,99,0,1,0,4,1,161,0,2,0,99,0,1,0,4,1,162,0,2,0,99,0,1,0,4,1,164,
+0,2,0,99,0,1,0,4,1,165,0,2,0,99,0,1,0,4,1,166,0,2,0,99,0,1,0,4,1,167,0,2,
+0,99,0,1,0,4,1,168,0,2,0,99,0,1,0,4,1,169,0,2,0,99,0,1,0,4,1,170,0,2,0,99,
+0,1,0,4,1,171,0,2,0,99,0,1,0,4,1,173,0,2,0,99,0,1,0,4,1,174,0,2,0,99,0,1,
+0,4,1,175,0,2,0,99,0,1,0,4,1,176,0,2,0,99,0,1,0,4,1,177,0,2,0,99,0,1,0,4,
+1,179,0,2,0,99,0,1,0,4,1,180,0,2,0,99,0,1,0,4,1,181,0,2,0,99,0,1,0,4,1,182,
+0,2,0,99,0,1,0,4,1,183,0,2,0,99,0,1,0,4,1,184,0,2,0,99,0,1,0,4,1,185,0,2,
+0,99,0,1,0,4,1,187,0,2,0,99,0,1,0,4,1,188,0,2,0,99,0,1,0,4,1,189,0,2,0,99,
+0,1,0,4,1,190,0,2,0,99,0,1,0,4,1,191,0,2,0,99,0,1,0,4,1,196,0,2,0,99,0,1,
+0,4,1,197,0,2,0,99,0,1,0,4,1,198,0,2,0,99,0,1,0,4,1,200,0,2,0,99,0,1,0,4,
+1,201,0,2,0,99,0,1,0,4,1,202,0,2,0,99,0,1,0,4,1,203,0,2,0,99,0,1,0,4,1,204,
+0,2,0,99,0,1,0,4,1,205,0,2,0,99,0,1,0,4,1,206,0,2,0,99,0,1,0,4,1,207,0,2,
+0,99,0,1,0,4,1,209,0,2,0,99,0,1,0,4,1,210,0,2,0,99,0,1,0,4,1,211,0,2,0,99,
+0,1,0,4,1,212,0,2,0,99,0,1,0,4,1,213,0,2,0,99,0,1,0,4,1,215,0,2,0,99,0,1,
+0,4,1,173,0,2,0,99,0,1,0,4,1,209,0,2,0,99,0,1,17,64,0,110,0,226,0,236,0,246,
+1,0,1,10,1,20,1,30,1,40,1,50,1,60,1,70,1,80,1,90,1,100,1,110,1,120,1,130,
+1,140,1,150,1,160,1,170,1,180,1,190,1,200,1,210,1,220,1,230,1,240,1,250,2,
+4,2,14,2,24,2,34,2,44,2,54,2,64,2,74,2,84,2,94,2,104,2,114,2,124,2,134,2,
+144,2,154,2,164,2,174,2,184,2,194,2,204,2,214,2,224,2,234,2,244,2,254,3,8,
+3,18,3,28,3,38,3,48,3,58,3,68,3,78,3,88,3,98,3,108,3,118,3,128,3,138,3,148,
+3,158,3,168,3,178,3,188,3,198,3,208,3,218,3,228,3,238,3,248,4,2,4,12,4,22,
+4,32,4,42,4,52,4,62,4,72,4,82,4,92,4,102,4,112,4,122,4,132,4,142,4,152,4,
+162,4,172,4,182,4,192,4,202,4,212,4,222,4,232,4,242,4,252,5,6,5,16,5,26,5,
+36,0,1,0,4,1,76,0,2,1,5,0,1,0,4,1,77,0,2,1,5,0,1,0,4,1,78,0,2,1,5,0,1,0,4,
+1,79,0,2,1,5,0,1,0,4,1,81,0,2,1,5,0,1,0,4,1,83,0,2,1,5,0,1,0,4,1,84,0,2,1,
+5,0,1,0,4,1,85,0,2,1,5,0,1,0,4,1,90,0,2,1,5,0,1,0,4,1,91,0,2,1,5,0,1,0,4,
+1,92,0,2,1,5,0,1,0,4,1,93,0,2,1,5,0,1,0,4,1,94,0,2,1,5,0,1,0,4,1,95,0,2,1,
+5,0,1,0,4,1,96,0,2,1,5,0,1,0,4,1,97,0,2,1,5,0,1,0,4,1,98,0,2,1,5,0,1,0,4,
+1,99,0,2,1,5,0,1,0,4,1,100,0,2,1,5,0,1,0,4,1,101,0,2,1,5,0,1,0,4,1,103,0,
+2,1,5,0,1,0,4,1,104,0,2,1,5,0,1,0,4,1,105,0,2,1,5,0,1,0,4,1,106,0,2,1,5,0,
+1,0,4,1,107,0,2,1,5,0,1,0,4,1,108,0,2,1,5,0,1,0,4,1,110,0,2,1,5,0,1,0,4,1,
+111,0,2,1,5,0,1,0,4,1,112,0,2,1,5,0,1,0,4,1,113,0,2,1,5,0,1,0,4,1,114,0,2,
+1,5,0,1,0,4,1,115,0,2,1,5,0,1,0,4,1,117,0,2,1,5,0,1,0,4,1,119,0,2,1,5,0,1,
+0,4,1,120,0,2,1,5,0,1,0,4,1,121,0,2,1,5,0,1,0,4,1,126,0,2,1,5,0,1,0,4,1,127,
+0,2,1,5,0,1,0,4,1,128,0,2,1,5,0,1,0,4,1,129,0,2,1,5,0,1,0,4,1,130,0,2,1,5,
+0,1,0,4,1,131,0,2,1,5,0,1,0,4,1,132,0,2,1,5,0,1,0,4,1,133,0,2,1,5,0,1,0,4,
+1,134,0,2,1,5,0,1,0,4,1,135,0,2,1,5,0,1,0,4,1,136,0,2,1,5,0,1,0,4,1,137,0,
+2,1,5,0,1,0,4,1,139,0,2,1,5,0,1,0,4,1,140,0,2,1,5,0,1,0,4,1,141,0,2,1,5,0,
+1,0,4,1,142,0,2,1,5,0,1,0,4,1,143,0,2,1,5,0,1,0,4,1,144,0,2,1,5,0,1,0,4,1,
+146,0,2,1,5,0,1,0,4,1,147,0,2,1,5,0,1,0,4,1,148,0,2,1,5,0,1,0,4,1,149,0,2,
+1,5,0,1,0,4,1,151,0,2,1,5,0,1,0,4,1,153,0,2,1,5,0,1,0,4,1,154,0,2,1,5,0,1,
+0,4,1,155,0,2,1,5,0,1,0,4,1,160,0,2,1,5,0,1,0,4,1,161,0,2,1,5,0,1,0,4,1,162,
+0,2,1,5,0,1,0,4,1,164,0,2,1,5,0,1,0,4,1,165,0,2,1,5,0,1,0,4,1,166,0,2,1,5,
+0,1,0,4,1,167,0,2,1,5,0,1,0,4,1,168,0,2,1,5,0,1,0,4,1,169,0,2,1,5,0,1,0,4,
+1,170,0,2,1,5,0,1,0,4,1,171,0,2,1,5,0,1,0,4,1,173,0,2,1,5,0,1,0,4,1,174,0,
+2,1,5,0,1,0,4,1,175,0,2,1,5,0,1,0,4,1,176,0,2,1,5,0,1,0,4,1,177,0,2,1,5,0,
+1,0,4,1,180,0,2,1,5,0,1,0,4,1,181,0,2,1,5,0,1,0,4,1,182,0,2,1,5,0,1,0,4,1,
+183,0,2,1,5,0,1,0,4,1,184,0,2,1,5,0,1,0,4,1,185,0,2,1,5,0,1,0,4,1,187,0,2,
+1,5,0,1,0,4,1,189,0,2,1,5,0,1,0,4,1,190,0,2,1,5,0,1,0,4,1,191,0,2,1,5,0,1,
+0,4,1,196,0,2,1,5,0,1,0,4,1,197,0,2,1,5,0,1,0,4,1,198,0,2,1,5,0,1,0,4,1,200,
+0,2,1,5,0,1,0,4,1,201,0,2,1,5,0,1,0,4,1,202,0,2,1,5,0,1,0,4,1,203,0,2,1,5,
+0,1,0,4,1,204,0,2,1,5,0,1,0,4,1,205,0,2,1,5,0,1,0,4,1,206,0,2,1,5,0,1,0,4,
+1,207,0,2,1,5,0,1,0,4,1,209,0,2,1,5,0,1,0,4,1,210,0,2,1,5,0,1,0,4,1,211,0,
+2,1,5,0,1,0,4,1,212,0,2,1,5,0,1,0,4,1,213,0,2,1,5,0,1,0,4,2,145,0,2,1,5,0,
+1,0,4,2,146,0,2,1,5,0,1,0,4,1,105,0,2,1,5,0,1,0,4,1,141,0,2,1,5,0,1,0,4,1,
+175,0,2,1,5,0,1,0,4,1,211,0,2,1,5,0,1,12,172,0,6,0,18,0,30,0,62,0,84,0,116,
+0,138,0,1,0,4,1,217,0,3,0,99,0,78,0,3,0,8,0,16,0,24,1,219,0,3,0,99,0,63,1,
+220,0,3,0,99,0,64,1,221,0,3,0,99,0,78,0,2,0,6,0,14,1,222,0,3,0,99,0,64,1,
+223,0,3,0,99,0,78,0,3,0,8,0,16,0,24,1,224,0,3,0,99,0,65,1,225,0,3,0,99,0,
+66,1,226,0,3,0,99,0,78,0,2,0,6,0,14,1,227,0,3,0,99,0,66,1,228,0,3,0,99,0,
+78,0,11,0,24,0,34,0,42,0,50,0,58,0,66,0,74,0,82,0,90,0,98,0,106,1,235,0,4,
+0,99,1,24,0,78,1,231,0,3,0,99,0,55,1,232,0,3,0,99,0,56,1,233,0,3,0,99,0,70,
+1,234,0,3,0,99,0,71,1,236,0,3,0,99,0,75,1,237,0,3,0,99,0,76,1,238,0,3,0,99,
+0,77,1,239,0,3,0,99,0,78,1,241,0,3,0,99,0,81,1,240,0,3,0,99,1,31,0,1,11,192,
+0,8,0,22,0,32,0,42,0,60,0,70,0,112,0,130,0,180,0,1,0,4,1,216,0,2,0,68,0,1,
+0,4,1,218,0,2,0,78,0,2,0,6,0,12,1,229,0,2,0,68,1,230,0,2,1,21,0,1,0,4,1,242,
+0,2,0,78,0,5,0,12,0,18,0,24,0,30,0,36,1,243,0,2,0,58,1,245,0,2,0,80,1,246,
+0,2,0,81,1,244,0,2,1,11,1,247,0,2,1,34,0,2,0,6,0,12,1,248,0,2,0,63,1,249,
+0,2,0,64,0,6,0,14,0,20,0,26,0,32,0,38,0,44,1,250,0,2,0,67,1,251,0,2,0,72,
+1,252,0,2,0,77,1,253,0,2,0,78,1,254,0,2,0,80,1,255,0,2,0,81,0,5,0,12,0,18,
+0,24,0,30,0,36,1,243,0,2,0,58,1,246,0,2,0,81,1,244,0,2,1,11,1,247,0,2,1,34,
+2,147,0,2,2,143,0,3,0,0,0,1,10,246,0,1,10,252,0,1,0,0,0,35,0,3,0,0,0,1,10,
+228,0,1,10,242,0,1,0,0,0,36,0,3,0,0,0,1,10,210,0,1,10,240,0,1,0,0,0,37,0,
+3,0,0,0,1,10,192,0,1,11,54,0,1,0,0,0,38,0,3,0,0,0,1,10,174,0,1,11,154,0,1,
+0,0,0,39,0,3,0,0,0,1,10,156,0,1,11,194,0,1,0,0,0,40,0,3,0,0,0,1,10,138,0,
+1,11,250,0,1,0,0,0,41,0,3,0,0,0,1,10,120,0,1,11,254,0,1,0,0,0,42,0,3,0,0,
+0,1,10,102,0,1,11,242,0,1,0,0,0,43,0,3,0,0,0,1,10,84,0,1,11,230,0,1,0,0,0,
+44,0,3,0,0,0,1,10,66,0,1,11,220,0,1,0,0,0,45,0,3,0,0,0,1,8,148,0,1,11,220,
+0,1,0,0,0,45,0,3,0,0,0,1,8,130,0,1,11,208,0,1,0,0,0,46,0,3,0,0,0,1,8,112,
+0,1,11,196,0,1,0,0,0,47,0,3,0,0,0,1,8,94,0,1,11,184,0,1,0,0,0,48,0,2,11,172,
+0,4,1,3,1,3,1,3,1,3,0,3,0,0,0,2,8,62,11,158,0,0,0,2,0,0,0,15,0,1,0,16,0,1,
+11,146,0,30,0,66,0,76,0,86,0,96,0,106,0,116,0,126,0,136,0,146,0,156,0,166,
+0,194,0,222,0,250,1,22,1,50,1,78,1,106,1,134,1,162,1,172,1,182,1,192,1,202,
+1,212,1,222,1,232,1,242,1,252,2,6,0,1,0,4,2,89,0,2,0,96,0,1,0,4,2,90,0,2,
+0,96,0,1,0,4,2,91,0,2,0,96,0,1,0,4,2,92,0,2,0,96,0,1,0,4,2,93,0,2,0,96,0,
+1,0,4,2,94,0,2,0,96,0,1,0,4,2,95,0,2,0,96,0,1,0,4,2,96,0,2,0,96,0,1,0,4,2,
+97,0,2,0,96,0,1,0,4,2,98,0,2,0,96,0,3,0,8,0,16,0,22,2,4,0,3,1,3,0,96,2,2,
+0,2,0,96,2,3,0,2,1,3,0,3,0,8,0,16,0,22,2,7,0,3,1,3,0,96,2,5,0,2,0,96,2,6,
+0,2,1,3,0,3,0,8,0,16,0,22,2,10,0,3,1,3,0,96,2,8,0,2,0,96,2,9,0,2,1,3,0,3,
+0,8,0,16,0,22,2,13,0,3,1,3,0,96,2,11,0,2,0,96,2,12,0,2,1,3,0,3,0,8,0,16,0,
+22,2,16,0,3,1,3,0,96,2,14,0,2,0,96,2,15,0,2,1,3,0,3,0,8,0,16,0,22,2,19,0,
+3,1,3,0,96,2,17,0,2,0,96,2,18,0,2,1,3,0,3,0,8,0,16,0,22,2,22,0,3,1,3,0,96,
+2,20,0,2,0,96,2,21,0,2,1,3,0,3,0,8,0,16,0,22,2,25,0,3,1,3,0,96,2,23,0,2,0,
+96,2,24,0,2,1,3,0,3,0,8,0,16,0,22,2,28,0,3,1,3,0,96,2,26,0,2,0,96,2,27,0,
+2,1,3,0,1,0,4,2,99,0,2,0,96,0,1,0,4,2,100,0,2,0,96,0,1,0,4,2,101,0,2,0,96,
+0,1,0,4,2,102,0,2,0,96,0,1,0,4,2,103,0,2,0,96,0,1,0,4,2,104,0,2,0,96,0,1,
+0,4,2,105,0,2,0,96,0,1,0,4,2,106,0,2,0,96,0,1,0,4,2,107,0,2,0,96,0,1,0,4,
+2,108,0,2,0,96,0,1,0,4,2,1,0,2,0,96,0,3,0,1,9,176,0,1,9,192,0,0,0,1,0,0,0,
+48,0,2,9,180,0,2,1,5,0,99,0,1,9,178,0,2,0,10,0,16,0,2,0,85,0,99,0,2,1,1,0,
+99,0,3,0,0,0,1,9,156,0,1,9,164,0,1,0,0,0,21,0,3,0,0,0,2,5,206,9,146,0,0,0,
+2,0,0,0,20,0,1,0,20,0,1,9,130,0,4,0,14,0,24,0,34,0,44,0,1,0,4,1,93,0,2,1,
+5,0,1,0,4,1,108,0,2,1,5,0,1,0,4,1,129,0,2,1,5,0,1,0,4,1,144,0,2,1,5,0,1,9,
+88,0,7,0,20,0,46,0,64,0,98,0,124,0,142,0,176,0,3,0,8,0,14,0,20,2,109,0,2,
+0,32,2,110,0,2,0,33,2,111,0,2,0,34,0,2,0,6,0,12,2,115,0,2,0,32,2,116,0,2,
+0,33,0,4,0,10,0,16,0,22,0,28,2,119,0,2,0,32,2,120,0,2,0,33,2,121,0,2,0,34,
+2,122,0,2,0,35,0,3,0,8,0,14,0,20,2,112,0,2,0,32,2,113,0,2,0,33,2,114,0,2,
+0,34,0,2,0,6,0,12,2,117,0,2,0,32,2,118,0,2,0,33,0,4,0,10,0,16,0,22,0,28,2,
+123,0,2,0,32,2,124,0,2,0,33,2,125,0,2,0,34,2,126,0,2,0,35,0,2,0,6,0,12,2,
+127,0,2,0,32,2,128,0,2,0,33,0,2,8,168,0,15,2,129,2,130,2,131,2,132,2,133,
+2,134,0,57,0,59,0,63,0,64,0,65,0,66,0,70,0,79,0,85,0,3,0,0,0,2,8,166,8,188,
+0,0,0,2,0,0,0,26,0,1,0,26,0,1,8,176,0,2,0,10,0,68,0,7,0,16,0,22,0,28,0,34,
+0,40,0,46,0,52,2,129,0,2,0,32,2,130,0,2,0,33,2,131,0,2,0,34,2,132,0,2,0,35,
+2,133,0,2,0,36,2,134,0,2,0,37,2,135,0,2,0,99,0,7,0,16,0,22,0,28,0,34,0,40,
+0,46,0,52,2,136,0,2,0,32,2,137,0,2,0,33,2,138,0,2,0,34,2,139,0,2,0,35,2,140,
+0,2,0,36,2,141,0,2,0,37,2,142,0,2,0,99,0,1,8,58,0,12,0,30,0,40,0,50,0,60,
+0,70,0,80,0,90,0,100,0,110,0,120,0,130,0,140,0,1,0,4,1,80,0,2,1,5,0,1,0,4,
+1,86,0,2,1,5,0,1,0,4,1,87,0,2,1,5,0,1,0,4,1,88,0,2,1,5,0,1,0,4,1,89,0,2,1,
+5,0,1,0,4,1,102,0,2,1,5,0,1,0,4,1,116,0,2,1,5,0,1,0,4,1,122,0,2,1,5,0,1,0,
+4,1,123,0,2,1,5,0,1,0,4,1,124,0,2,1,5,0,1,0,4,1,125,0,2,1,5,0,1,0,4,1,138,
+0,2,1,5,0,3,0,0,0,1,7,192,0,2,7,202,8,4,0,1,0,0,0,48,0,3,0,0,0,1,7,172,0,
+2,7,182,7,246,0,1,0,0,0,49,0,3,0,0,0,1,7,152,0,2,7,162,7,232,0,1,0,0,0,50,
+0,3,0,0,0,1,7,132,0,3,7,142,6,250,7,200,0,1,0,0,0,51,0,3,0,0,0,1,7,110,0,
+3,7,120,6,228,7,184,0,1,0,0,0,52,0,3,0,0,0,1,7,88,0,3,7,98,6,206,7,168,0,
+1,0,0,0,53,0,3,0,2,7,76,7,152,0,1,7,162,0,0,0,1,0,0,0,53,0,3,0,3,6,164,7,
+56,7,132,0,1,7,142,0,0,0,1,0,0,0,53,0,3,0,1,7,130,0,1,7,184,0,0,0,1,0,0,0,
+53,0,3,0,1,7,178,0,1,7,166,0,0,0,1,0,0,0,54,0,3,0,1,7,190,0,1,7,148,0,0,0,
+1,0,0,0,55,0,1,7,194,0,30,0,66,0,76,0,86,0,96,0,106,0,116,0,126,0,136,0,146,
+0,156,0,166,0,176,0,186,0,196,0,206,0,216,0,226,0,236,0,246,1,0,1,10,1,20,
+1,30,1,40,1,50,1,60,1,70,1,80,1,90,1,100,0,1,0,4,1,10,0,2,0,99,0,1,0,4,1,
+16,0,2,0,99,0,1,0,4,1,17,0,2,0,99,0,1,0,4,1,18,0,2,0,99,0,1,0,4,1,19,0,2,
+0,99,0,1,0,4,1,23,0,2,0,99,0,1,0,4,1,32,0,2,0,99,0,1,0,4,1,46,0,2,0,99,0,
+1,0,4,1,52,0,2,0,99,0,1,0,4,1,53,0,2,0,99,0,1,0,4,1,54,0,2,0,99,0,1,0,4,1,
+55,0,2,0,99,0,1,0,4,1,59,0,2,0,99,0,1,0,4,1,68,0,2,0,99,0,1,0,4,1,150,0,2,
+0,99,0,1,0,4,1,156,0,2,0,99,0,1,0,4,1,157,0,2,0,99,0,1,0,4,1,158,0,2,0,99,
+0,1,0,4,1,159,0,2,0,99,0,1,0,4,1,163,0,2,0,99,0,1,0,4,1,172,0,2,0,99,0,1,
+0,4,1,178,0,2,0,99,0,1,0,4,1,186,0,2,0,99,0,1,0,4,1,192,0,2,0,99,0,1,0,4,
+1,193,0,2,0,99,0,1,0,4,1,194,0,2,0,99,0,1,0,4,1,195,0,2,0,99,0,1,0,4,1,199,
+0,2,0,99,0,1,0,4,1,208,0,2,0,99,0,1,0,4,1,214,0,2,0,99,0,1,1,44,0,1,0,8,0,
+1,0,4,1,4,0,3,0,99,0,203,0,1,2,180,1,255,0,1,2,174,2,0,0,1,2,168,2,1,0,1,
+2,162,2,2,0,1,2,156,2,3,0,1,2,150,2,4,0,1,2,144,2,5,0,1,2,138,2,6,0,1,2,132,
+2,7,0,1,2,126,2,9,0,2,6,68,0,2,2,40,0,10,0,1,0,210,255,188,0,1,0,204,255,
+189,0,2,6,54,0,14,0,13,2,0,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,
+62,2,63,2,64,0,1,4,236,0,12,0,1,4,230,0,36,0,1,4,224,0,24,0,1,4,218,0,12,
+0,2,6,18,0,19,2,77,0,1,0,1,0,1,2,80,2,83,2,86,2,65,2,66,2,67,2,68,2,69,2,
+70,2,71,2,72,2,73,2,74,2,75,2,76,0,2,5,72,0,4,2,78,2,81,2,84,2,87,0,2,5,58,
+0,4,2,79,2,82,2,85,2,88,0,1,0,4,0,80,0,82,0,252,0,254,0,1,0,5,1,35,1,71,1,
+103,1,139,1,245,0,2,0,4,0,4,0,23,0,0,0,53,0,86,0,20,2,143,2,143,0,54,2,148,
+2,148,0,55,0,1,0,2,0,53,0,60,0,1,0,1,0,99,0,1,0,1,0,79,0,1,0,1,0,203,0,2,
+0,10,0,53,0,56,0,0,0,58,0,62,0,4,0,67,0,78,0,9,0,80,0,88,0,21,0,225,0,228,
+0,30,0,230,0,234,0,34,0,239,0,250,0,39,0,252,1,2,0,51,2,143,2,144,0,58,2,
+148,2,149,0,60,0,2,0,11,0,53,0,56,0,0,0,58,0,62,0,4,0,67,0,69,0,9,0,71,0,
+78,0,12,0,80,0,88,0,20,0,225,0,228,0,29,0,230,0,234,0,33,0,239,0,241,0,38,
+0,243,1,2,0,41,2,143,2,144,0,57,2,148,2,149,0,59,0,2,0,12,1,76,1,79,0,0,1,
+81,1,85,0,4,1,90,1,92,0,9,1,94,1,101,0,12,1,103,1,107,0,20,1,109,1,115,0,
+25,1,117,1,121,0,32,1,126,1,128,0,37,1,130,1,137,0,40,1,139,1,143,0,48,1,
+145,1,145,0,53,2,145,2,146,0,54,0,2,0,25,0,53,0,56,0,0,0,58,0,58,0,4,0,60,
+0,62,0,5,0,67,0,78,0,8,0,80,0,85,0,20,0,87,0,88,0,26,0,225,0,228,0,28,0,230,
+0,230,0,32,0,232,0,234,0,33,0,239,0,250,0,36,0,252,1,1,0,48,1,6,1,9,0,54,
+1,11,1,11,0,58,1,13,1,15,0,59,1,20,1,22,0,62,1,24,1,31,0,65,1,33,1,37,0,73,
+1,40,1,45,0,78,1,47,1,47,0,84,1,49,1,51,0,85,1,56,1,58,0,88,1,60,1,67,0,91,
+1,69,1,73,0,99,2,143,2,144,0,104,2,148,2,151,0,106,0,1,0,6,0,57,0,63,0,64,
+0,65,0,66,0,70,0,1,0,8,1,6,1,12,1,21,1,34,1,35,1,36,1,38,2,150,0,1,0,1,0,
+30,0,1,0,2,0,79,0,251,0,1,0,6,0,64,0,236,1,87,1,123,1,222,1,233,0,1,0,42,
+0,53,0,57,0,63,0,65,0,66,0,70,0,81,0,85,0,225,0,229,0,235,0,237,0,238,0,242,
+0,253,1,1,1,76,1,80,1,86,1,88,1,89,1,93,1,104,1,108,1,112,1,116,1,122,1,124,
+1,125,1,129,1,140,1,144,1,219,1,220,1,224,1,225,1,227,1,231,1,236,1,241,1,
+251,1,255,0,1,0,57,0,55,0,56,0,59,0,68,0,71,0,72,0,73,0,74,0,75,0,77,0,78,
+0,83,0,89,0,91,0,92,0,94,0,95,0,227,0,228,0,231,0,240,0,243,0,244,0,245,0,
+246,0,247,0,249,0,250,0,255,1,78,1,79,1,82,1,94,1,95,1,96,1,97,1,98,1,100,
+1,101,1,106,1,114,1,115,1,118,1,130,1,131,1,132,1,133,1,134,1,136,1,137,1,
+142,1,232,1,239,1,248,1,249,1,250,1,254,0,1,0,27,0,58,0,69,0,82,0,86,0,88,
+0,230,0,241,0,254,1,2,1,81,1,91,1,92,1,109,1,111,1,117,1,127,1,128,1,145,
+1,216,1,229,1,234,1,237,1,243,2,143,2,144,2,145,2,146,0,1,0,35,0,4,0,60,0,
+61,0,62,0,76,0,80,0,84,0,87,0,90,0,93,0,232,0,233,0,234,0,248,0,252,1,0,1,
+83,1,84,1,85,1,99,1,103,1,105,1,107,1,119,1,120,1,121,1,135,1,139,1,141,1,
+143,1,246,1,252,1,253,2,148,2,149,0,1,0,9,0,54,0,67,0,226,0,239,1,77,1,90,
+1,113,1,126,1,238,0,1,0,1,1,110,0,1,0,1,1,242,0,1,0,2,1,221,2,147,0,1,0,7,
+1,217,1,218,1,223,1,226,1,228,1,235,1,245,0,1,0,1,0,34,0,1,0,1,0,35,0,1,0,
+1,0,36,0,1,0,1,0,37,0,2,0,1,0,34,0,37,0,0,0,2,0,7,0,7,0,7,0,0,0,15,0,23,0,
+1,0,31,0,31,0,10,0,38,0,45,0,11,0,208,0,208,0,19,0,216,0,224,0,20,1,3,1,3,
+0,29,0,2,0,2,0,7,0,7,0,0,0,15,0,23,0,1,0,1,0,1,0,97,0,1,0,2,0,99,1,5,0,1,
+0,2,1,38,1,74,0,1,0,1,1,5,0,1,0,4,0,70,0,85,0,242,1,1,0,1,0,7,0,70,0,79,0,
+85,0,242,0,251,1,1,1,108,0,1,0,15,0,32,0,33,0,34,0,35,0,36,0,37,0,229,0,231,
+0,235,0,236,0,237,0,238,0,242,0,251,1,1,0,1,0,9,0,229,0,231,0,235,0,236,0,
+237,0,238,0,242,0,251,1,1,0,2,0,1,0,32,0,37,0,0,0,1,0,2,0,100,1,5,0,1,0,12,
+0,57,0,63,0,64,0,65,0,66,0,79,0,229,0,235,0,236,0,237,0,238,0,251,0,2,0,1,
+2,29,2,40,0,0,0,2,0,9,0,53,0,95,0,0,0,225,1,2,0,43,1,76,1,145,0,77,1,216,
+1,229,0,147,1,231,1,239,0,161,1,241,1,243,0,170,1,245,1,246,0,173,1,248,1,
+255,0,175,2,143,2,149,0,183,0,1,0,1,1,3,0,1,0,1,0,96,0,1,0,1,2,1,0,2,0,1,
+2,41,2,76,0,0,0,1,0,3,0,96,1,3,2,1,0,1,0,25,0,59,0,65,0,66,0,79,0,91,0,231,
+0,237,0,238,0,251,1,82,1,88,1,89,1,102,1,118,1,124,1,125,1,138,1,224,1,225,
+1,227,2,143,2,144,2,145,2,146,2,147,0,1,0,4,0,31,2,2,2,3,2,4,0,1,0,13,0,57,
+0,64,0,86,0,229,0,236,1,2,1,80,1,87,1,109,1,116,1,123,1,145,1,222,0,1,0,9,
+0,53,0,74,0,225,0,246,1,76,1,97,1,112,1,133,1,216,0,1,0,30,0,57,0,63,0,64,
+0,65,0,66,0,70,0,79,0,229,0,235,0,236,0,237,0,238,0,242,0,251,1,80,1,86,1,
+87,1,88,1,89,1,93,1,102,1,108,1,116,1,122,1,123,1,124,1,125,1,129,1,138,1,
+144,0,1,0,2,0,30,0,79,0,2,0,3,0,79,0,79,0,0,0,97,0,97,0,1,2,29,2,40,0,2,0,
+2,0,5,0,31,0,31,0,0,0,96,0,96,0,1,1,3,1,3,0,2,2,1,2,4,0,3,2,29,2,40,0,7,};
+#endif
@@ -0,0 +1,1009 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifGeorgian_Regular_ttf_size = 23756;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifGeorgian_Regular_ttf");
+asm(".type fz_font_NotoSerifGeorgian_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifGeorgian_Regular_ttf, 23756");
+asm(".balign 64");
+asm("fz_font_NotoSerifGeorgian_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifGeorgian-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifGeorgian_Regular_ttf_size = 23756;
+const char fz_font_NotoSerifGeorgian_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,38,0,132,0,0,77,252,0,0,0,30,71,
+80,79,83,23,147,44,98,0,0,78,28,0,0,14,142,71,83,85,66,103,149,111,147,0,
+0,92,172,0,0,0,32,79,83,47,50,123,3,110,255,0,0,1,104,0,0,0,96,99,109,97,
+112,63,224,22,137,0,0,3,196,0,0,0,108,103,97,115,112,0,22,0,35,0,0,77,236,
+0,0,0,16,103,108,121,102,240,97,195,144,0,0,5,48,0,0,61,168,104,101,97,100,
+4,161,86,231,0,0,0,236,0,0,0,54,104,104,101,97,16,3,6,185,0,0,1,36,0,0,0,
+36,104,109,116,120,150,241,32,30,0,0,1,200,0,0,1,252,108,111,99,97,148,163,
+164,75,0,0,4,48,0,0,1,0,109,97,120,112,0,132,0,79,0,0,1,72,0,0,0,32,110,97,
+109,101,142,133,186,181,0,0,66,216,0,0,6,18,112,111,115,116,200,15,110,200,
+0,0,72,236,0,0,4,253,0,1,0,0,0,1,15,92,228,80,170,153,95,15,60,245,0,11,8,
+0,0,0,0,0,203,229,49,14,0,0,0,0,210,40,204,11,255,102,254,10,8,14,7,106,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,141,253,168,0,0,8,127,255,102,0,18,8,14,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,1,0,0,0,127,0,78,0,4,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,77,1,144,0,5,0,0,5,154,5,51,0,0,1,31,
+5,154,5,51,0,0,3,209,0,102,2,0,0,0,2,11,5,2,4,5,4,2,2,4,4,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,141,253,168,0,0,8,141,2,88,0,
+0,0,1,0,0,0,0,4,74,5,182,0,0,0,32,0,2,4,0,0,102,0,0,0,0,4,20,0,0,2,20,0,0,
+6,55,0,119,5,53,0,43,5,240,0,92,5,240,0,115,4,248,0,92,5,240,0,92,5,223,0,
+41,6,133,0,117,3,215,0,41,5,61,0,41,6,92,0,41,5,240,0,78,5,12,0,31,5,240,
+0,115,6,111,0,41,5,227,0,41,5,240,0,92,5,12,0,31,4,213,0,31,5,240,0,115,6,
+86,0,115,5,6,0,41,5,186,0,205,5,104,0,41,5,84,0,41,5,12,0,31,4,233,0,117,
+5,240,0,78,4,213,0,78,4,90,0,98,5,109,0,31,5,72,0,72,6,41,0,41,5,170,0,31,
+5,14,0,31,5,53,0,43,5,176,0,31,5,215,0,37,4,57,0,82,4,158,0,113,4,158,0,113,
+6,195,0,113,4,141,0,92,4,70,0,51,5,55,255,215,6,195,0,113,4,158,0,113,4,29,
+0,10,8,127,0,113,4,158,0,113,4,156,0,113,6,172,0,113,4,100,0,82,4,178,0,59,
+6,172,0,113,4,242,0,47,6,0,0,113,5,8,0,31,7,20,0,92,4,178,0,72,6,172,0,113,
+4,178,0,72,4,156,0,51,4,250,0,37,5,16,0,113,4,158,0,113,4,156,0,113,4,100,
+0,61,4,250,0,27,4,121,0,70,3,217,0,66,4,190,0,113,4,158,0,57,4,131,0,29,4,
+100,0,82,4,231,0,113,7,88,0,113,4,25,0,82,4,178,0,201,4,158,0,113,4,141,0,
+113,4,117,0,166,3,100,0,102,4,18,0,31,5,20,0,47,5,70,255,244,4,158,0,111,
+5,37,255,244,7,172,255,244,4,172,255,102,7,123,0,57,3,190,0,41,5,12,255,246,
+7,143,0,57,4,225,0,113,5,20,0,37,7,143,0,57,5,49,255,244,5,16,255,244,7,133,
+0,47,4,236,0,10,4,213,0,168,7,100,0,57,7,88,0,113,4,172,0,41,5,41,0,57,4,
+244,0,47,4,244,0,47,4,236,0,10,5,31,0,57,7,90,0,113,7,123,0,57,5,45,255,244,
+5,20,0,47,4,27,255,195,7,182,255,244,4,154,0,10,4,158,0,113,4,244,0,47,4,
+244,0,47,7,90,0,113,2,78,0,166,0,0,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,0,96,
+0,0,0,20,0,16,0,3,0,4,0,0,0,13,0,32,0,160,5,137,16,197,16,252,45,37,254,255,
+255,255,0,0,0,0,0,13,0,32,0,160,5,137,16,160,16,208,45,0,254,255,255,255,
+0,1,255,245,255,227,255,99,250,244,239,100,239,90,211,87,1,127,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,20,0,20,0,20,0,91,0,139,0,179,
+1,1,1,31,1,73,1,128,1,180,1,196,2,2,2,60,2,116,2,162,2,237,3,23,3,71,3,115,
+3,153,3,209,4,30,4,85,4,137,4,168,4,218,5,26,5,70,5,138,5,199,5,255,6,61,
+6,125,6,178,6,216,7,6,7,60,7,108,7,158,7,228,8,32,8,105,8,167,9,3,9,60,9,
+126,9,198,10,5,10,55,10,120,10,229,11,32,11,105,11,173,11,252,12,70,12,163,
+12,208,13,64,13,138,13,235,14,48,14,144,14,205,15,22,15,96,15,175,15,230,
+16,47,16,147,16,203,17,12,17,103,17,213,18,24,18,87,18,171,18,243,19,70,19,
+132,19,193,20,3,20,64,20,109,20,175,20,212,21,34,21,125,21,191,22,0,22,92,
+22,151,22,240,23,21,23,85,23,180,23,239,24,48,24,127,24,185,24,244,25,67,
+25,118,25,186,26,9,26,97,26,165,26,222,27,20,27,87,27,142,27,207,28,34,28,
+115,28,187,28,254,29,52,29,139,29,194,29,237,30,35,30,87,30,175,30,212,30,
+212,0,2,0,102,0,0,3,154,5,182,0,3,0,7,0,0,51,17,33,17,37,33,17,33,102,3,52,
+253,47,2,110,253,146,5,182,250,74,98,4,242,0,1,0,119,255,236,5,195,5,203,
+0,44,0,0,19,52,18,55,7,6,35,34,53,52,55,22,22,51,50,55,36,51,50,21,20,6,7,
+38,38,35,32,0,17,16,18,51,50,18,17,53,22,22,21,20,2,4,35,32,0,186,200,175,
+132,64,43,203,141,8,74,78,135,233,1,48,145,201,76,64,11,76,72,254,133,254,
+166,204,213,204,212,121,107,161,254,218,189,254,202,254,177,2,156,175,1,67,
+110,17,8,121,76,35,53,54,45,62,137,46,69,14,80,69,254,173,254,151,254,215,
+254,233,1,25,1,20,197,2,114,116,176,254,220,164,1,100,0,1,0,43,0,0,4,84,5,
+182,0,31,0,0,19,52,54,54,51,21,34,6,21,16,33,50,54,53,17,52,38,35,35,53,33,
+17,35,17,52,55,35,6,6,35,34,36,43,100,180,117,77,93,1,39,168,168,73,93,8,
+1,125,207,8,10,37,189,132,232,254,246,3,236,142,207,109,96,178,182,254,145,
+165,171,1,6,70,69,86,250,74,1,244,54,120,67,79,242,0,1,0,92,255,16,5,199,
+5,203,0,26,0,0,19,53,52,36,51,50,22,21,17,50,22,21,20,6,35,52,38,35,35,17,
+52,38,35,34,6,21,21,92,1,6,234,236,243,208,204,93,67,118,134,207,142,138,
+149,132,3,102,129,230,254,242,235,252,129,107,113,56,75,124,116,3,244,177,
+183,186,197,119,0,2,0,115,255,236,5,123,5,203,0,36,0,48,0,0,1,34,7,21,4,0,
+21,16,0,33,32,0,17,52,0,37,53,6,35,34,53,52,55,22,22,51,50,55,36,51,50,21,
+20,6,7,38,38,1,20,22,51,50,54,53,52,38,35,34,6,4,74,89,153,1,1,1,34,254,172,
+254,209,254,203,254,176,1,28,1,7,224,116,203,141,8,74,78,103,225,1,48,144,
+201,76,64,11,75,252,195,206,212,212,204,205,209,212,208,5,80,31,182,24,254,
+210,248,254,238,254,193,1,53,1,30,253,1,40,23,143,39,121,76,35,53,54,45,62,
+137,46,69,14,78,65,252,237,248,235,234,249,250,232,233,0,1,0,92,0,0,4,43,
+5,203,0,17,0,0,19,52,36,51,50,22,21,17,35,17,52,38,35,34,6,21,21,35,92,1,
+3,237,236,243,207,142,138,149,132,207,3,231,230,254,242,235,252,18,3,244,
+177,183,186,199,117,0,0,1,0,92,0,0,5,199,5,203,0,29,0,0,33,35,17,52,38,35,
+34,6,21,21,35,53,52,36,51,50,22,21,21,51,50,22,21,20,6,35,52,38,35,35,4,43,
+207,142,138,149,132,207,1,3,237,236,243,14,203,195,86,74,110,126,16,3,244,
+177,183,186,199,117,129,230,254,242,235,168,123,129,68,74,147,136,0,2,0,41,
+255,236,5,98,5,182,0,11,0,31,0,0,1,20,22,51,50,54,53,52,38,35,34,6,1,33,17,
+20,7,51,54,54,51,50,0,17,16,0,35,34,0,17,17,33,2,80,136,144,145,134,134,147,
+138,140,253,217,2,39,8,10,44,147,89,237,1,11,254,237,235,223,254,252,254,
+168,2,39,243,222,224,241,241,220,241,2,179,254,207,58,116,61,74,254,215,254,
+242,254,242,254,211,1,49,1,10,3,33,0,0,2,0,117,0,0,6,92,5,182,0,20,0,29,0,
+0,33,32,0,17,16,0,33,33,17,51,50,22,21,20,6,35,52,38,35,35,17,1,34,2,17,16,
+18,51,51,17,3,16,254,194,254,163,1,91,1,64,1,177,14,202,195,86,74,110,125,
+16,254,126,242,245,243,242,181,1,126,1,91,1,95,1,126,253,144,123,129,68,74,
+147,136,253,41,5,78,254,192,254,203,254,208,254,189,4,232,0,0,1,0,41,0,0,
+3,10,5,182,0,5,0,0,19,33,17,35,17,33,41,2,225,207,253,238,5,182,250,74,5,
+72,0,2,0,41,254,20,4,154,5,182,0,10,0,40,0,0,1,52,38,35,32,17,20,22,51,50,
+54,1,52,38,35,35,53,33,17,20,7,51,54,54,51,50,22,22,21,17,35,17,52,55,35,
+6,35,34,38,38,53,3,203,154,147,254,233,144,133,157,146,252,237,60,67,16,1,
+94,8,10,47,162,109,140,211,116,207,8,10,96,236,131,208,114,2,82,202,216,254,
+22,210,226,253,3,130,60,79,86,254,207,58,116,65,70,122,233,161,251,186,1,
+177,54,120,135,133,247,162,0,0,2,0,41,255,236,5,223,5,182,0,11,0,35,0,0,1,
+20,22,51,50,54,53,52,38,35,34,6,17,17,20,7,51,54,54,51,50,0,17,16,0,35,34,
+0,17,17,35,34,6,21,35,17,2,205,134,146,146,133,134,147,138,140,8,10,44,147,
+89,237,1,11,254,237,235,223,254,252,59,151,165,94,2,39,241,220,220,241,241,
+216,237,2,179,254,207,58,116,61,74,254,215,254,242,254,242,254,211,1,49,1,
+10,3,33,224,227,2,49,0,0,2,0,78,255,236,5,199,5,182,0,9,0,35,0,0,37,32,17,
+17,35,34,6,21,20,22,3,33,17,51,50,22,21,20,6,35,52,38,35,35,17,16,33,34,36,
+53,52,36,33,51,17,33,2,68,1,24,229,175,157,138,177,3,39,14,201,197,87,73,
+110,126,16,254,33,245,254,247,1,2,1,39,229,253,168,90,1,115,1,82,175,186,
+174,174,5,92,253,215,121,131,68,73,147,136,254,174,254,31,243,228,242,216,
+1,187,0,1,0,31,0,0,4,92,5,182,0,29,0,0,1,33,17,20,7,51,54,54,51,50,22,21,
+17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,35,53,33,4,41,253,135,8,10,30,
+156,107,184,205,207,102,121,126,128,207,75,93,26,4,10,5,72,254,164,59,116,
+67,79,229,211,253,233,2,23,163,154,151,166,253,233,4,205,77,70,86,0,0,2,0,
+115,254,156,5,139,5,205,0,32,0,44,0,0,1,20,2,7,6,6,21,20,22,51,50,55,22,22,
+21,20,6,35,34,38,53,52,55,6,35,32,0,17,16,0,33,32,0,1,16,18,51,50,18,17,16,
+2,35,34,2,5,123,117,117,27,44,71,64,90,55,19,22,123,100,133,148,29,86,98,
+254,203,254,176,1,78,1,57,1,43,1,86,251,219,207,211,211,205,204,210,212,208,
+2,221,189,254,200,115,26,98,65,79,82,81,8,47,26,56,67,123,106,69,60,22,1,
+137,1,106,1,101,1,137,254,113,254,159,254,182,254,199,1,55,1,76,1,76,1,53,
+254,204,0,1,0,41,255,236,5,162,5,182,0,25,0,0,19,33,17,20,22,51,50,54,53,
+17,52,38,38,35,35,53,33,17,20,4,35,32,36,53,17,33,41,2,39,163,158,153,169,
+35,67,66,27,1,146,254,241,249,254,241,254,246,254,168,5,182,251,248,161,167,
+169,151,3,47,50,61,28,86,251,236,210,228,228,234,3,142,0,1,0,41,0,0,5,23,
+5,182,0,31,0,0,19,33,21,34,6,21,16,33,50,54,53,17,52,38,35,35,53,33,17,35,
+17,52,55,35,6,35,34,36,53,52,55,33,41,2,82,78,92,1,39,168,168,73,93,8,1,125,
+207,8,10,108,251,236,254,251,143,254,172,5,182,86,191,184,254,150,165,171,
+1,6,70,69,86,250,74,1,244,54,120,146,241,230,223,130,0,1,0,92,255,236,5,199,
+5,182,0,29,0,0,19,51,21,20,22,51,50,54,53,17,51,17,51,50,22,21,20,6,35,52,
+38,35,35,17,20,6,35,34,36,53,92,207,134,147,142,138,207,14,203,195,86,74,
+110,126,16,243,236,235,254,251,2,139,176,202,183,190,171,3,243,253,144,123,
+129,68,74,147,136,254,242,235,242,252,231,0,0,1,0,31,255,236,4,176,5,182,
+0,23,0,0,1,20,4,35,34,38,17,17,52,38,38,35,35,53,33,17,20,22,51,50,54,53,
+53,51,4,176,254,253,236,244,236,35,67,66,26,1,145,137,144,148,132,207,1,207,
+230,253,251,1,2,2,236,50,61,28,86,252,37,193,192,184,201,176,0,2,0,31,255,
+61,4,86,5,182,0,8,0,35,0,0,1,51,50,54,53,52,38,35,35,1,32,21,20,6,35,52,38,
+38,35,33,17,52,38,38,35,35,53,33,50,4,21,20,4,33,35,17,1,176,109,189,159,
+151,167,139,1,100,1,33,82,77,44,101,95,254,59,35,67,66,26,2,63,248,1,0,254,
+225,254,250,129,2,154,168,192,180,158,251,27,181,60,65,81,79,35,4,213,50,
+61,28,86,220,208,222,243,254,54,0,0,2,0,115,254,156,5,180,5,205,0,33,0,45,
+0,0,1,16,7,22,22,21,20,6,6,35,34,38,53,52,54,55,22,51,50,54,53,52,38,39,6,
+35,32,0,17,16,0,33,32,0,1,16,18,51,50,18,17,16,2,35,34,2,5,123,164,108,113,
+75,138,86,90,115,23,18,55,91,62,69,69,60,153,232,254,203,254,176,1,78,1,57,
+1,43,1,86,251,219,207,211,211,205,204,210,212,208,2,221,254,171,204,26,145,
+99,75,127,72,70,53,26,47,8,81,74,65,77,100,15,118,1,137,1,106,1,101,1,137,
+254,113,254,159,254,182,254,199,1,55,1,76,1,76,1,53,254,204,0,0,3,0,115,0,
+0,5,225,5,203,0,14,0,21,0,26,0,0,1,20,0,5,17,35,17,36,0,53,16,0,33,32,0,7,
+52,38,39,17,54,54,37,16,5,17,4,5,225,254,194,254,224,197,254,228,254,209,
+1,104,1,82,1,70,1,110,227,190,189,191,188,252,88,1,104,254,152,3,178,237,
+254,222,22,254,115,1,141,23,1,32,240,1,2,1,21,254,228,253,203,208,15,252,
+162,19,212,205,254,113,37,3,94,26,0,1,0,41,0,0,4,221,5,182,0,34,0,0,1,52,
+38,35,35,53,33,17,54,51,50,21,20,6,7,38,38,35,34,7,17,35,17,6,35,34,53,52,
+54,55,22,22,51,50,55,2,10,60,67,16,1,94,229,86,201,73,66,11,74,75,88,129,
+207,192,86,203,76,65,12,76,72,79,101,4,213,60,79,86,253,230,45,168,56,84,
+20,110,95,25,252,203,3,12,43,144,45,70,16,82,68,19,0,1,0,205,0,0,4,238,5,
+203,0,17,0,0,33,17,52,38,35,34,6,21,17,35,17,52,36,33,50,4,21,17,4,31,171,
+151,155,166,207,1,8,1,16,250,1,15,4,16,154,178,177,163,251,248,3,252,233,
+230,230,209,251,236,0,1,0,41,0,0,4,135,5,182,0,32,0,0,1,20,22,51,32,17,17,
+52,38,38,35,35,53,33,17,35,17,52,55,35,6,6,35,34,38,53,17,52,38,35,35,53,
+33,1,135,137,125,1,43,35,67,66,26,1,145,207,9,11,33,187,109,207,230,60,67,
+16,1,94,3,160,167,163,1,74,1,53,50,61,28,86,250,74,1,203,84,90,64,82,232,
+209,1,53,60,79,86,0,0,1,0,41,255,236,4,135,5,182,0,46,0,0,1,20,22,51,50,54,
+53,53,52,55,35,6,35,34,38,53,53,52,38,35,35,53,33,17,20,22,51,50,54,53,53,
+52,38,38,35,35,53,33,17,20,6,35,34,36,53,53,51,1,135,139,142,136,144,9,11,
+96,233,207,230,60,67,16,1,94,137,125,150,149,35,67,66,26,1,145,243,236,236,
+254,252,207,1,154,168,152,193,180,160,84,90,146,232,209,145,60,79,86,254,
+142,167,163,162,168,145,50,61,28,86,252,19,235,242,212,191,106,0,1,0,31,0,
+0,4,176,5,182,0,27,0,0,1,20,7,51,54,54,51,50,22,21,17,35,17,52,38,35,32,17,
+17,35,17,52,38,38,35,35,53,33,1,176,8,10,35,174,121,206,230,207,137,125,254,
+213,207,35,67,66,26,1,145,4,123,58,116,68,77,232,208,253,90,2,166,167,163,
+254,182,253,90,4,213,50,61,28,86,0,0,1,0,117,254,150,4,164,5,203,0,44,0,0,
+37,20,14,3,35,34,38,53,52,55,22,51,50,54,55,6,35,32,0,17,52,18,36,51,50,22,
+21,20,6,35,52,38,35,34,2,17,16,18,51,50,54,55,22,4,156,66,132,103,84,52,44,
+68,28,54,45,58,124,59,113,147,254,218,254,184,156,1,41,204,195,219,100,78,
+129,111,217,209,221,205,114,184,73,39,209,52,155,203,111,50,70,54,57,56,35,
+92,88,40,1,144,1,97,229,1,84,181,124,106,63,80,122,142,254,201,254,182,254,
+205,254,188,88,99,25,0,0,2,0,78,255,236,5,199,5,182,0,29,0,38,0,0,1,52,38,
+38,35,35,53,33,17,51,50,22,21,20,6,35,52,38,35,35,17,16,33,34,36,53,52,54,
+33,33,1,20,22,51,32,17,17,33,32,3,92,35,67,66,26,1,145,14,201,197,87,73,110,
+126,16,254,33,245,254,247,240,1,14,1,16,253,207,138,143,1,24,254,232,254,
+231,4,213,50,61,28,86,253,215,121,131,68,73,147,136,254,174,254,31,243,228,
+234,224,254,41,174,174,1,115,1,82,0,0,2,0,78,0,0,4,133,5,182,0,28,0,37,0,
+0,1,17,35,17,52,38,38,35,35,53,33,50,4,21,20,4,33,35,21,51,50,22,21,20,6,
+35,52,38,35,3,51,50,54,53,52,38,35,35,1,223,207,35,67,66,26,2,63,248,1,0,
+254,223,254,252,129,15,200,197,87,73,110,125,17,109,186,162,151,167,139,1,
+117,254,139,4,213,50,61,28,86,198,189,201,219,172,121,131,68,73,147,136,1,
+123,145,170,159,138,0,1,0,98,255,236,3,242,5,203,0,42,0,0,5,34,38,53,52,54,
+51,22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,50,22,22,21,20,6,35,52,38,
+35,34,6,21,20,22,23,22,22,21,20,4,1,250,190,218,77,71,7,145,124,138,155,134,
+183,202,175,247,201,111,174,98,87,74,123,107,117,133,131,187,207,174,254,
+243,20,152,136,62,76,155,171,133,125,109,135,75,83,212,160,170,201,59,106,
+65,66,67,121,139,127,106,119,137,76,85,199,140,191,220,0,0,1,0,31,255,61,
+4,176,5,182,0,43,0,0,19,52,38,38,35,35,53,33,17,20,22,51,32,17,17,52,38,38,
+35,35,53,33,17,20,6,35,34,38,39,35,22,21,17,33,32,21,20,6,35,52,38,38,35,
+33,225,35,67,66,26,1,145,150,149,1,6,35,67,66,26,1,145,230,206,123,172,35,
+10,8,1,203,1,33,82,78,44,101,95,253,213,4,213,50,61,28,86,253,242,166,152,
+1,62,1,45,50,61,28,86,254,4,212,234,77,68,116,58,254,144,181,60,65,81,79,
+35,0,0,2,0,72,0,0,4,223,5,182,0,20,0,28,0,0,1,1,35,53,33,21,1,1,7,1,3,14,
+2,35,35,53,51,50,54,55,1,19,54,53,52,38,35,33,2,154,254,114,178,4,133,254,
+115,1,84,168,254,217,227,105,95,109,76,43,8,75,116,53,1,211,184,51,50,61,
+254,99,2,207,2,135,96,84,253,191,253,225,111,1,218,254,176,155,90,40,98,73,
+73,2,141,1,29,78,47,30,29,0,0,1,0,41,255,236,5,205,5,182,0,23,0,0,1,20,4,
+35,34,38,53,17,35,34,6,21,35,17,33,17,20,22,51,50,54,53,53,51,5,205,254,252,
+236,236,243,59,151,165,94,2,164,137,143,147,134,207,1,207,230,253,242,235,
+3,127,224,227,2,49,252,13,171,190,183,202,137,0,0,1,0,31,0,0,5,129,5,182,
+0,29,0,0,1,21,33,53,52,38,35,32,17,17,35,17,52,38,38,35,35,53,33,17,20,7,
+51,54,54,51,50,22,21,21,5,129,254,23,120,108,254,252,207,35,67,66,26,1,145,
+8,10,30,159,110,184,209,2,131,111,146,166,164,254,182,253,90,4,213,50,61,
+28,86,254,197,58,116,67,78,230,210,35,0,0,1,0,31,255,236,4,154,5,182,0,33,
+0,0,1,50,4,18,21,16,0,33,34,38,38,53,52,54,51,20,22,51,50,18,17,16,2,35,33,
+53,52,38,38,35,35,53,33,21,2,25,198,1,35,152,254,170,254,211,141,198,104,
+92,80,145,126,212,203,202,211,254,200,35,67,66,26,1,145,5,20,159,254,213,
+203,254,207,254,158,64,111,76,76,76,132,161,1,10,1,27,1,28,1,11,47,50,61,
+28,86,162,0,1,0,43,0,0,4,84,5,182,0,30,0,0,1,6,6,21,16,33,50,54,53,17,52,
+38,35,35,53,33,17,35,17,52,55,35,6,35,34,36,53,52,54,54,55,1,178,85,79,1,
+39,168,168,73,93,8,1,125,207,8,10,117,241,241,254,255,98,165,95,4,139,23,
+151,131,254,211,165,171,1,88,70,69,86,250,74,1,162,58,116,146,220,200,105,
+174,104,6,0,1,0,31,0,0,5,2,5,182,0,32,0,0,1,38,38,53,17,52,38,38,35,35,53,
+33,17,20,22,51,50,54,53,17,52,38,38,35,35,53,33,17,20,6,7,17,35,2,135,219,
+203,35,67,66,26,1,145,164,158,153,168,35,67,66,26,1,145,216,212,207,1,254,
+22,219,203,1,27,50,61,28,86,253,248,161,167,170,150,1,47,50,61,28,86,253,
+236,187,213,22,254,4,0,3,0,37,255,236,5,135,5,182,0,28,0,37,0,47,0,0,1,33,
+21,33,21,20,6,35,34,38,53,52,54,51,17,52,38,38,35,35,53,33,50,4,21,20,4,33,
+35,53,51,50,54,53,52,38,35,35,1,50,54,53,53,34,6,21,20,22,2,225,1,207,254,
+49,182,188,171,159,253,240,35,67,66,26,2,63,247,1,1,254,224,254,251,129,109,
+189,159,151,166,140,254,140,88,77,150,157,74,2,47,98,49,221,211,150,132,146,
+151,2,166,50,61,28,86,189,179,193,209,96,138,159,148,131,250,248,161,169,
+55,107,96,86,96,0,0,1,0,82,255,233,3,201,4,94,0,40,0,0,1,20,6,35,34,38,38,
+53,52,54,51,6,21,20,22,51,50,54,53,52,38,38,39,38,38,53,52,51,50,22,23,6,
+6,21,20,22,23,23,30,2,3,201,231,220,129,200,107,126,120,52,131,111,121,129,
+33,75,70,129,92,125,26,47,8,21,17,52,54,82,99,98,47,1,141,205,215,95,170,
+104,114,118,98,115,132,147,159,158,97,101,81,41,73,120,79,123,22,19,13,38,
+31,59,79,34,48,58,101,132,0,2,0,113,255,236,4,45,6,47,0,36,0,48,0,0,1,16,
+33,34,2,17,16,37,54,53,52,38,35,34,14,2,35,34,38,53,52,54,55,22,51,50,55,
+54,51,50,22,21,20,7,22,18,5,20,22,51,50,54,53,52,38,35,34,6,4,45,254,31,231,
+244,1,151,115,50,40,32,54,50,51,30,61,66,64,46,24,75,27,61,60,52,90,117,143,
+193,202,253,10,136,145,143,135,133,147,146,133,2,39,253,197,1,37,1,22,2,6,
+45,73,126,41,57,22,26,22,71,63,45,54,9,88,12,11,101,84,132,89,25,254,226,
+250,243,222,219,246,240,221,220,0,2,0,113,254,20,4,45,4,94,0,27,0,39,0,0,
+1,52,38,35,34,21,34,38,53,52,54,51,50,22,21,20,7,22,18,21,16,33,34,2,17,16,
+37,54,1,20,22,51,50,54,53,52,38,35,34,6,2,193,72,60,153,71,77,167,132,139,
+167,179,180,191,254,31,231,244,1,104,232,254,118,136,145,143,135,133,147,
+146,133,3,90,67,83,224,68,55,89,122,137,111,168,65,27,254,227,245,253,196,
+1,37,1,23,1,238,63,39,253,172,243,222,219,246,240,221,220,0,0,3,0,113,254,
+20,6,82,4,94,0,46,0,58,0,59,0,0,19,16,18,51,50,23,54,51,32,17,16,2,35,32,
+17,16,35,34,6,21,20,18,4,51,50,55,54,51,50,22,21,20,6,7,38,38,35,34,6,6,7,
+39,54,54,55,38,2,1,52,38,35,34,6,21,20,22,51,50,54,3,113,210,205,226,92,111,
+233,1,172,219,207,254,80,223,113,113,149,1,23,185,37,58,57,65,73,82,69,51,
+20,239,212,93,130,94,60,49,46,148,80,221,219,5,26,110,119,126,106,110,120,
+119,112,87,2,39,1,21,1,34,192,192,253,201,254,235,254,218,2,59,1,205,225,
+236,217,254,183,179,5,5,80,65,50,66,9,82,76,23,38,48,53,74,84,4,99,1,96,1,
+14,244,217,232,229,241,224,223,252,223,0,1,0,92,254,10,4,8,4,94,0,35,0,0,
+1,34,38,53,52,54,51,6,21,20,22,51,50,18,17,17,16,2,35,34,6,3,34,38,53,62,
+2,51,50,18,17,17,20,2,6,2,37,209,248,127,119,47,131,123,147,148,137,128,141,
+133,8,79,89,1,115,205,129,214,243,120,217,254,10,253,216,114,118,88,125,185,
+194,1,36,1,27,1,2,1,26,1,34,236,254,242,78,73,124,214,123,254,151,254,197,
+254,250,211,254,198,157,0,0,1,0,51,254,10,3,213,4,94,0,47,0,0,1,34,38,38,
+53,52,54,51,6,21,20,22,51,50,54,53,52,38,35,35,53,51,50,54,53,16,35,34,17,
+34,38,53,52,54,54,51,50,22,21,20,6,7,21,22,22,21,20,6,1,252,137,209,111,126,
+120,51,134,124,141,137,181,171,92,92,137,185,244,244,81,81,102,182,122,214,
+224,168,141,161,183,255,254,10,94,170,105,114,117,94,119,135,143,174,186,
+181,192,111,161,127,1,29,254,227,58,65,65,119,72,185,183,122,185,33,11,20,
+224,178,224,255,0,3,255,215,255,236,4,199,6,31,0,22,0,34,0,46,0,0,1,16,33,
+34,2,17,52,55,35,34,38,53,16,33,50,22,21,20,7,54,51,50,18,1,20,22,51,50,54,
+53,52,38,35,34,6,1,20,22,51,50,54,53,52,38,35,34,6,4,199,254,30,231,244,49,
+22,158,176,1,82,162,170,11,62,68,231,244,253,10,136,144,145,134,134,147,146,
+132,254,184,70,88,86,72,73,87,86,70,2,39,253,197,1,37,1,22,180,129,176,178,
+1,97,183,170,56,52,12,254,220,254,237,243,222,224,241,241,220,218,1,164,130,
+130,131,129,128,126,127,0,0,2,0,113,255,236,6,82,4,94,0,28,0,40,0,0,1,50,
+23,54,51,50,18,17,20,2,6,35,34,38,53,54,54,53,52,38,35,34,17,16,33,34,2,17,
+16,19,20,22,51,50,54,53,52,38,35,34,6,2,29,235,111,91,226,204,210,102,168,
+80,45,31,111,116,108,115,225,254,80,207,219,198,106,126,117,112,105,126,126,
+104,4,94,192,192,254,222,254,225,146,255,0,159,40,41,8,255,227,235,228,254,
+51,253,197,1,38,1,19,2,55,253,201,229,236,219,248,227,232,232,0,1,0,113,255,
+236,4,45,4,94,0,30,0,0,1,16,33,34,6,21,20,22,23,20,6,35,34,38,2,53,16,18,
+51,50,18,17,20,2,6,35,34,38,53,54,54,3,102,254,232,139,140,75,79,36,26,77,
+136,77,249,232,235,240,79,135,77,26,35,80,73,2,27,1,217,240,233,220,245,39,
+23,32,153,1,2,150,1,27,1,38,254,220,254,227,148,254,249,150,32,23,40,249,
+0,1,0,10,254,10,3,172,4,94,0,46,0,0,1,38,38,53,52,51,50,22,21,20,6,7,21,22,
+22,21,20,4,35,34,38,38,53,52,54,51,6,21,20,22,51,50,54,53,52,38,35,35,53,
+51,50,54,53,52,38,35,34,1,117,6,9,131,202,214,168,141,161,183,254,251,233,
+129,200,107,126,120,51,125,112,153,146,184,168,31,31,137,185,117,127,56,3,
+223,13,39,8,67,191,177,122,185,33,11,20,224,178,225,254,95,170,104,114,117,
+94,119,129,149,172,188,183,192,109,161,127,138,133,0,0,2,0,113,254,20,8,14,
+4,94,0,75,0,76,0,0,1,20,18,4,51,50,54,51,50,22,21,20,6,7,38,38,36,35,32,7,
+39,54,54,55,38,2,53,52,18,54,51,50,23,51,54,51,50,23,51,54,51,50,22,18,21,
+20,6,6,35,34,38,53,54,17,52,38,35,34,6,21,21,35,53,16,35,34,6,21,21,35,53,
+52,38,35,34,6,1,1,55,194,1,104,235,68,169,99,87,99,68,53,14,200,254,174,193,
+254,244,150,49,41,183,91,241,250,97,178,118,192,95,8,88,201,194,90,8,91,200,
+117,177,95,76,129,71,23,32,133,101,98,92,98,193,195,92,102,193,91,97,108,
+93,6,51,2,27,218,254,192,171,10,79,66,47,74,8,46,78,44,119,53,67,95,4,107,
+1,88,252,182,1,8,135,190,190,190,190,142,254,246,184,144,253,149,32,23,89,
+1,146,236,246,196,173,127,123,1,117,194,175,127,123,185,188,226,251,6,0,2,
+0,113,255,236,4,45,6,31,0,23,0,35,0,0,1,34,7,38,53,52,54,54,51,32,17,16,2,
+35,34,2,17,16,33,50,22,23,38,38,1,20,22,51,50,54,17,52,38,35,34,6,2,25,154,
+70,34,66,123,85,2,4,237,244,231,244,1,225,81,142,53,16,170,254,139,136,145,
+148,130,139,141,146,133,5,180,110,24,49,38,67,39,252,157,254,148,254,156,
+1,37,1,22,2,55,58,56,224,232,252,115,243,222,253,1,19,201,197,220,0,0,2,0,
+113,255,236,4,43,6,59,0,11,0,47,0,0,1,52,38,35,34,6,21,20,22,51,50,54,1,54,
+54,51,50,18,17,16,33,34,38,2,17,16,18,51,50,23,22,51,50,54,55,22,22,21,20,
+6,35,34,46,2,35,34,17,3,102,135,151,148,127,130,145,149,137,253,213,53,160,
+90,220,229,254,29,178,201,92,220,204,45,91,90,58,54,50,11,46,65,81,71,59,
+98,90,84,44,213,2,29,240,212,202,250,223,232,212,2,171,56,61,254,231,254,
+236,253,207,168,1,102,1,22,1,123,1,148,29,29,49,37,9,54,45,63,70,33,40,33,
+254,33,0,1,0,113,255,236,6,59,4,94,0,47,0,0,1,35,53,52,38,35,34,6,21,20,22,
+23,20,6,35,34,38,38,53,16,18,51,50,23,51,54,54,51,50,22,18,21,20,6,6,35,34,
+38,53,54,54,53,52,38,35,34,6,21,3,182,192,104,113,117,113,74,80,36,26,78,
+135,77,226,200,211,100,8,43,157,116,127,191,103,77,136,77,26,36,81,73,114,
+114,105,114,1,215,164,184,189,239,243,215,236,40,23,32,148,250,148,1,22,1,
+58,190,86,104,140,254,245,185,148,251,147,32,23,40,236,215,233,249,192,177,
+0,2,0,82,255,227,3,244,6,31,0,55,0,56,0,0,1,50,22,21,20,6,7,21,22,22,21,20,
+4,35,34,38,38,53,52,54,51,6,21,20,22,51,50,54,53,52,38,35,35,53,51,50,54,
+53,16,35,34,14,2,35,34,38,53,52,55,22,22,51,50,55,54,39,2,72,187,206,165,
+144,159,185,254,249,231,129,200,107,125,121,52,127,111,152,147,181,171,92,
+92,140,181,221,41,63,57,58,35,49,57,100,9,40,41,33,56,56,20,5,203,182,175,
+113,180,34,11,17,202,163,204,231,95,170,104,114,117,96,117,130,148,151,168,
+161,169,111,157,119,1,17,20,24,20,63,46,109,24,44,57,9,8,73,0,1,0,59,254,
+10,3,233,4,74,0,52,0,0,1,22,22,51,50,54,53,51,17,20,2,35,34,38,38,53,52,54,
+51,6,21,20,22,51,50,54,53,17,52,55,35,6,6,7,22,21,20,6,35,34,38,53,52,54,
+51,20,22,51,50,53,52,38,39,1,172,25,99,56,93,108,192,249,224,137,209,110,
+125,120,51,133,125,143,142,12,12,49,110,77,72,158,137,128,163,77,71,70,75,
+127,45,47,3,195,13,20,88,80,251,186,243,254,249,94,168,107,114,117,98,115,
+132,146,177,183,2,234,29,176,54,42,1,65,105,111,130,122,89,55,67,115,110,
+158,51,96,31,0,0,2,0,113,255,236,6,59,6,20,0,62,0,63,0,0,1,50,23,51,54,54,
+51,50,22,18,21,20,6,6,35,34,38,53,54,54,53,52,38,35,34,6,21,21,35,53,52,38,
+35,34,6,21,20,22,23,20,6,35,34,38,38,53,16,18,0,33,50,22,21,20,6,7,38,38,
+35,34,4,7,54,1,2,27,211,100,8,43,157,116,127,191,103,77,136,77,26,36,81,73,
+114,114,105,114,192,104,113,117,113,74,80,36,26,78,135,77,243,1,165,1,9,93,
+108,70,51,19,97,80,171,254,237,89,61,2,182,4,94,190,86,104,140,254,245,185,
+148,251,147,32,23,40,236,215,233,249,192,177,168,164,184,189,239,243,215,
+236,40,23,32,148,250,148,1,25,1,219,1,2,71,64,50,62,9,65,52,157,152,26,1,
+182,0,1,0,47,255,236,4,129,6,20,0,27,0,0,5,34,38,17,17,52,38,35,35,53,33,
+17,20,22,51,50,54,53,52,38,38,39,55,22,18,21,20,0,2,158,234,215,73,93,8,1,
+111,114,142,136,148,29,56,64,86,129,133,254,253,20,232,1,3,3,92,70,69,86,
+251,201,207,164,208,192,104,174,153,114,67,124,254,198,180,237,254,229,0,
+4,0,113,254,10,5,143,6,31,0,22,0,46,0,57,0,69,0,0,1,16,0,33,32,0,17,16,0,
+55,38,38,53,52,54,51,50,22,21,20,7,22,0,1,16,18,51,50,18,17,16,2,39,22,22,
+21,20,6,35,34,38,53,52,54,55,6,2,37,52,39,6,6,21,20,22,51,50,54,1,20,23,62,
+2,53,52,38,35,34,6,5,143,254,168,254,203,254,195,254,172,1,14,252,74,63,144,
+124,125,147,139,251,1,17,251,168,226,233,233,222,149,150,66,57,154,127,128,
+153,54,53,143,140,2,78,131,79,60,73,62,59,76,254,252,119,63,48,20,67,60,54,
+69,1,45,254,137,254,84,1,160,1,133,1,85,1,141,40,54,113,75,111,133,134,116,
+130,104,41,254,100,254,183,254,152,254,176,1,80,1,104,1,41,1,69,50,56,117,
+73,119,153,151,127,57,121,54,54,254,188,136,176,96,54,124,92,78,86,90,2,158,
+136,91,44,59,73,49,66,75,74,0,1,0,31,254,10,4,80,4,94,0,52,0,0,1,53,52,38,
+35,34,6,21,34,38,53,52,54,54,51,50,22,23,51,54,54,51,50,22,21,17,20,0,35,
+34,38,38,53,52,54,51,6,21,20,22,51,50,54,53,17,52,38,35,34,6,6,21,21,1,186,
+72,81,71,64,59,64,64,114,82,94,121,26,9,37,124,82,164,156,254,241,241,149,
+226,121,126,120,53,154,143,163,162,59,74,56,57,30,2,102,21,185,188,99,108,
+46,56,55,100,60,99,91,93,97,227,227,253,108,242,254,248,94,168,107,114,117,
+98,115,132,146,176,184,2,191,176,162,73,159,137,25,0,0,2,0,92,254,10,6,174,
+4,94,0,57,0,69,0,0,1,34,36,38,53,52,54,51,6,21,20,22,51,50,54,53,52,38,35,
+35,53,51,50,54,53,16,35,34,6,7,22,21,20,2,35,34,2,53,52,54,51,50,23,54,51,
+50,22,21,20,6,7,21,22,22,21,20,6,4,1,20,22,51,50,54,53,52,38,35,34,6,4,33,
+189,254,223,155,127,119,52,222,209,234,228,206,199,21,21,138,183,243,75,133,
+40,63,244,212,210,241,238,219,193,118,124,200,214,224,168,141,185,212,156,
+254,214,252,49,142,124,127,137,140,126,129,135,254,10,87,155,100,100,109,
+96,96,120,130,173,187,179,194,111,161,127,1,29,59,54,116,156,226,254,255,
+1,4,223,225,254,108,108,185,183,122,185,33,11,20,224,178,145,217,117,4,117,
+177,200,197,180,178,195,190,0,1,0,72,254,10,3,233,6,20,0,48,0,0,1,52,38,38,
+35,35,53,33,17,20,2,35,34,38,38,53,52,54,51,6,21,20,22,51,50,54,53,17,52,
+38,38,35,34,6,21,20,23,34,38,53,52,54,51,50,22,23,51,38,53,3,41,35,67,66,
+27,1,131,249,224,137,209,110,125,120,51,133,125,143,142,47,102,87,90,106,
+51,120,126,208,165,79,132,43,12,12,5,51,50,61,28,86,249,240,243,254,249,94,
+168,107,114,117,98,115,132,146,177,183,2,211,128,128,64,102,91,84,63,88,84,
+118,158,48,48,176,29,0,0,2,0,113,254,20,6,59,4,94,0,64,0,65,0,0,19,16,18,
+51,50,23,51,54,54,51,50,22,18,21,20,6,6,35,34,38,53,54,54,53,52,38,35,34,
+6,21,21,35,53,52,38,35,34,6,21,20,18,22,51,55,54,51,50,22,21,20,6,7,38,38,
+35,34,6,6,7,39,54,54,55,38,2,1,113,221,205,209,100,10,43,156,114,127,192,
+105,78,134,78,26,36,82,72,118,112,103,114,192,104,113,123,107,133,247,165,
+99,63,57,64,73,69,51,15,228,196,92,131,95,59,49,45,151,79,177,212,4,153,2,
+39,1,15,1,40,190,86,104,140,254,246,186,148,253,145,32,23,40,237,214,237,
+245,193,176,168,164,184,189,225,232,210,254,180,183,5,5,79,66,47,72,8,73,
+84,22,39,47,53,72,93,3,78,1,132,252,232,0,0,1,0,72,254,10,3,233,4,94,0,42,
+0,0,1,17,20,2,35,34,38,38,53,52,54,51,6,21,20,22,51,50,54,53,17,52,55,35,
+6,6,35,34,38,53,52,54,51,6,21,20,22,51,50,54,54,53,53,3,233,249,224,137,209,
+110,125,120,51,133,125,143,142,12,12,44,142,88,177,229,138,108,51,126,115,
+88,106,50,4,74,251,186,243,254,249,94,168,107,114,117,98,115,132,146,177,
+183,1,174,29,176,46,50,184,144,130,154,75,179,120,130,64,126,130,164,0,2,
+0,51,255,236,4,43,6,31,0,10,0,49,0,0,1,20,22,51,32,17,52,38,35,34,6,3,34,
+21,34,53,52,54,51,50,23,51,54,51,50,18,17,16,2,6,35,34,2,53,52,18,51,50,23,
+51,52,38,38,35,34,6,21,35,52,38,1,53,137,150,1,18,141,133,150,137,10,125,
+123,137,109,165,50,8,67,169,163,148,96,202,173,238,245,240,225,196,88,8,28,
+55,58,70,61,172,55,1,236,209,197,1,209,166,180,189,2,240,211,103,97,118,166,
+166,254,138,254,138,254,224,254,142,181,1,8,248,248,1,5,116,221,248,106,155,
+142,157,140,0,0,2,0,37,255,236,4,137,6,31,0,44,0,53,0,0,1,21,20,7,51,54,54,
+51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,
+50,54,53,17,52,54,51,50,22,21,20,33,39,51,50,54,53,52,35,34,21,1,158,8,10,
+42,166,97,213,227,126,136,86,89,61,137,154,120,138,70,94,10,253,217,16,95,
+73,154,137,120,134,254,205,45,37,104,100,118,123,4,68,146,58,116,82,104,244,
+229,148,247,110,67,126,189,119,173,173,154,132,254,194,71,66,86,86,73,74,
+3,183,179,204,119,123,233,98,67,74,129,219,0,1,0,113,254,10,4,170,4,94,0,
+53,0,0,1,6,2,17,16,18,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,
+34,38,53,52,54,51,23,6,21,20,22,51,50,22,21,20,6,7,21,22,22,21,20,4,35,32,
+0,17,52,18,55,1,154,56,53,74,162,149,148,161,184,168,92,92,152,170,111,104,
+112,124,79,48,41,6,52,69,166,196,156,153,159,185,254,233,253,254,239,254,
+236,112,99,4,6,86,254,160,254,223,254,249,254,212,135,159,150,153,160,111,
+143,121,126,136,73,71,46,64,4,27,22,59,48,184,162,128,164,23,10,17,196,156,
+199,221,1,149,1,144,241,1,175,123,0,0,2,0,113,255,236,4,43,6,31,0,19,0,30,
+0,0,1,38,2,39,55,22,18,17,16,2,35,34,2,17,16,18,51,50,22,23,1,20,22,51,32,
+17,52,38,35,34,6,3,100,8,84,63,71,156,127,233,246,231,244,235,217,108,140,
+47,253,219,136,145,1,22,137,143,146,133,3,217,178,1,19,59,70,139,254,119,
+254,175,254,147,254,159,1,37,1,22,1,31,1,24,69,64,254,78,243,222,2,14,200,
+200,220,0,0,2,0,113,255,236,4,104,6,31,0,10,0,49,0,0,1,52,38,35,34,6,21,16,
+33,50,54,19,34,6,21,35,52,38,35,34,6,6,21,51,54,51,50,18,21,20,2,35,34,38,
+2,17,16,18,51,50,23,51,54,51,50,22,21,20,35,52,3,102,134,152,134,141,1,19,
+149,137,9,68,57,172,62,69,59,56,27,8,88,197,224,241,248,235,176,202,93,149,
+162,168,67,9,48,167,107,138,122,1,236,215,190,180,166,254,47,196,4,154,135,
+162,144,153,111,247,217,116,254,252,249,249,254,249,186,1,116,1,25,1,121,
+1,115,166,166,119,96,103,211,0,0,2,0,61,254,10,4,8,6,20,0,59,0,71,0,0,1,22,
+21,20,7,38,39,21,20,22,23,30,2,21,20,6,35,34,38,38,53,52,54,51,6,21,20,22,
+51,50,54,53,52,38,39,46,2,53,53,6,6,35,34,38,53,52,54,51,50,23,17,52,38,38,
+35,35,53,33,1,50,54,54,55,38,35,34,6,21,20,22,2,182,240,31,57,152,40,42,114,
+100,42,252,237,139,217,117,125,120,51,152,127,139,149,67,74,87,66,35,34,103,
+60,107,137,139,111,103,88,35,67,66,27,1,131,254,164,30,70,52,4,65,83,44,60,
+48,3,123,120,122,40,44,118,85,252,65,75,32,88,118,129,91,205,215,95,169,105,
+114,117,98,115,132,156,168,159,110,155,55,62,73,82,55,146,59,58,129,100,101,
+129,35,1,106,50,61,28,86,252,140,47,83,44,31,61,42,46,56,0,2,0,27,255,236,
+4,137,6,20,0,11,0,34,0,0,1,34,6,21,20,22,51,50,54,53,52,38,5,54,54,51,50,
+18,17,16,33,34,2,17,17,52,38,38,35,35,53,33,17,20,3,2,170,153,126,136,145,
+145,134,137,254,89,64,153,97,229,215,254,31,231,238,35,67,66,16,1,120,8,3,
+199,198,218,243,222,224,241,221,195,31,82,80,254,242,254,235,253,197,1,38,
+1,21,3,12,50,61,28,86,254,240,60,254,224,0,1,0,70,254,10,4,8,4,74,0,44,0,
+0,1,21,20,22,23,22,22,21,20,6,35,34,38,38,53,52,54,51,6,21,20,22,51,50,54,
+53,52,39,38,38,53,53,37,53,5,53,52,38,35,35,53,33,17,5,21,2,182,38,44,152,
+104,251,238,139,217,117,125,120,51,152,127,139,152,144,116,72,254,225,1,31,
+76,92,27,1,131,1,31,2,39,133,59,66,31,105,155,125,185,194,95,169,105,114,
+117,98,115,132,156,150,142,196,89,74,104,66,227,141,117,141,110,71,69,86,
+254,82,142,114,0,2,0,66,255,236,3,104,6,31,0,66,0,67,0,0,1,50,22,21,20,6,
+7,21,22,22,21,20,6,7,21,22,21,16,33,34,38,38,53,52,51,20,22,51,50,54,53,52,
+38,35,35,53,51,50,53,52,38,35,35,53,51,50,54,53,52,38,35,34,14,2,35,34,38,
+53,52,55,22,22,51,50,55,54,55,1,207,174,201,114,93,119,102,107,114,241,254,
+72,121,162,83,151,119,106,119,113,127,113,129,131,221,113,120,119,121,103,
+114,94,90,41,60,53,55,35,49,57,100,9,40,41,30,44,44,172,5,203,139,119,93,
+133,28,10,27,101,94,78,109,34,10,55,185,254,224,55,99,67,131,117,137,91,103,
+94,91,110,172,95,75,111,101,83,90,95,20,24,20,63,46,109,24,44,57,9,8,73,0,
+2,0,113,255,236,4,78,6,31,0,68,0,77,0,0,1,20,2,7,30,2,51,32,53,52,35,35,53,
+51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,38,39,38,53,52,54,51,50,23,6,
+21,20,22,23,22,21,20,7,21,22,22,21,20,6,7,21,22,22,21,16,33,32,2,17,52,18,
+54,51,50,22,39,34,2,3,54,54,53,52,38,2,98,163,146,5,69,142,128,1,2,239,48,
+50,117,104,107,127,8,10,101,116,38,62,56,79,61,43,37,25,25,52,93,144,207,
+121,100,100,121,124,118,254,26,254,251,242,71,128,85,95,118,207,53,47,2,88,
+94,45,4,154,199,254,234,52,214,245,112,188,180,111,85,81,91,75,110,97,86,
+56,66,39,22,29,68,51,54,11,41,40,27,35,37,58,136,169,63,10,27,98,92,75,103,
+37,10,28,116,92,254,230,1,113,1,157,249,1,97,182,198,100,254,190,254,146,
+48,214,158,124,144,0,0,2,0,57,255,104,4,100,4,94,0,29,0,41,0,0,1,20,2,7,22,
+22,51,6,6,35,34,38,39,6,6,35,34,38,39,50,54,55,38,2,53,52,18,51,50,18,5,20,
+22,23,54,54,53,52,38,35,34,6,4,45,172,178,121,156,128,2,62,38,78,255,99,101,
+251,78,39,62,2,135,159,110,180,168,254,227,223,252,253,10,139,140,142,138,
+133,147,146,133,2,121,189,254,229,108,50,26,53,76,88,48,49,87,77,52,29,47,
+111,1,28,185,226,1,3,255,0,229,182,250,84,87,250,179,198,181,182,0,0,1,0,
+29,254,20,4,12,4,74,0,41,0,0,1,34,38,38,53,52,54,51,6,21,20,22,51,50,54,53,
+16,33,35,53,54,54,53,33,34,6,6,7,35,19,33,21,20,2,7,30,2,21,20,6,6,1,250,
+144,217,116,125,120,51,148,135,153,179,254,73,47,212,198,254,135,45,51,29,
+12,101,13,3,26,180,158,117,202,101,132,239,254,20,90,165,104,114,117,98,115,
+129,149,208,185,1,106,99,9,231,233,22,51,85,1,66,154,183,254,243,52,9,125,
+184,116,155,224,119,0,0,1,0,82,254,10,3,244,6,31,0,61,0,0,19,52,54,51,50,
+22,21,20,6,35,16,35,34,6,21,20,22,22,23,30,2,21,20,6,7,21,22,22,21,20,4,35,
+34,38,38,53,52,54,51,6,21,20,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,
+38,39,38,38,213,206,175,170,190,72,57,241,94,111,40,93,84,170,138,73,165,
+144,160,184,254,248,230,129,200,107,125,121,52,127,111,152,147,181,171,92,
+92,140,181,104,129,186,150,4,221,151,171,110,107,63,79,1,4,103,83,78,76,60,
+26,52,95,138,104,113,180,34,11,17,203,163,203,231,95,170,104,114,117,96,117,
+130,148,151,168,161,169,111,157,119,124,135,36,52,141,0,3,0,113,255,236,4,
+166,6,31,0,27,0,38,0,49,0,0,1,51,21,35,21,51,21,35,21,20,6,35,32,17,52,54,
+33,51,53,35,32,36,53,16,33,50,22,21,1,50,54,53,53,35,34,6,21,20,22,3,20,22,
+51,51,53,52,38,35,34,6,3,211,211,211,211,211,210,224,254,80,253,1,15,149,
+149,254,244,255,0,1,176,222,212,254,72,127,120,143,187,145,113,113,146,186,
+143,119,128,123,105,3,236,117,174,117,168,227,221,1,116,190,171,174,158,176,
+1,90,220,229,251,248,147,170,193,112,136,134,128,4,115,123,98,139,170,147,
+123,0,0,3,0,113,254,20,6,231,4,94,0,29,0,41,0,53,0,0,1,17,52,55,35,6,6,35,
+32,17,16,18,51,50,22,23,54,54,51,50,18,17,16,2,35,34,39,35,23,17,1,50,54,
+53,52,38,35,34,6,21,20,22,1,34,6,21,20,22,51,50,54,53,52,38,3,76,8,8,47,151,
+116,254,95,233,219,124,186,63,59,199,121,220,230,207,210,211,103,8,8,254,
+41,149,130,135,146,128,124,122,3,114,149,130,133,148,129,123,118,254,20,1,
+154,66,184,97,91,2,55,1,22,1,37,100,113,100,113,254,227,254,230,254,224,254,
+229,188,240,254,92,2,91,198,238,238,202,216,226,227,207,3,108,198,238,227,
+213,216,226,218,216,0,0,1,0,82,254,10,3,199,4,94,0,43,0,0,23,52,54,55,54,
+54,53,52,38,35,34,6,21,34,38,53,52,54,54,51,50,22,21,20,6,7,6,6,21,20,22,
+51,50,54,53,50,22,21,20,6,6,35,34,38,82,159,185,181,118,112,97,107,118,82,
+66,99,172,104,179,202,163,179,172,125,147,123,135,160,64,78,112,194,133,200,
+246,113,152,230,122,121,160,119,107,126,154,149,64,59,70,129,75,186,160,164,
+240,114,110,166,117,124,140,204,164,93,69,87,144,74,213,0,0,1,0,201,254,10,
+4,106,4,94,0,42,0,0,1,21,20,22,22,51,50,54,53,52,39,50,22,21,20,6,35,34,38,
+39,35,22,21,17,20,22,51,50,54,53,52,39,50,22,21,20,6,6,35,34,2,53,17,1,137,
+50,107,87,116,126,52,109,137,229,176,86,144,45,12,12,142,143,124,134,51,122,
+123,110,208,138,224,249,4,74,164,127,129,64,132,118,177,77,155,129,144,184,
+49,47,176,29,254,82,184,176,146,132,119,94,118,113,107,168,94,1,8,242,4,70,
+0,2,0,113,254,20,4,45,4,94,0,30,0,42,0,0,5,20,22,51,50,53,50,22,21,20,6,6,
+35,34,38,53,52,54,55,38,2,53,16,33,50,18,17,16,5,6,6,1,52,38,35,34,6,21,20,
+22,51,50,54,1,221,73,58,154,71,76,76,137,86,140,165,93,85,178,192,1,225,231,
+244,254,152,124,108,1,137,134,146,145,134,134,147,146,132,231,69,85,227,67,
+56,57,99,55,137,111,85,123,26,27,1,27,247,2,59,254,219,254,234,254,18,63,
+22,103,2,170,242,223,224,241,241,220,218,0,0,1,0,113,255,27,4,39,4,94,0,40,
+0,0,1,52,38,35,34,6,21,20,22,22,23,23,22,22,21,20,6,35,46,2,35,34,7,39,54,
+54,51,46,2,53,52,18,51,50,22,21,16,35,54,3,102,137,143,146,133,63,142,160,
+57,138,130,78,71,7,82,174,151,141,104,50,33,172,80,126,125,64,248,233,217,
+252,234,41,2,109,199,192,197,215,156,188,115,47,13,27,92,71,58,62,97,98,44,
+84,54,46,78,52,123,185,136,253,1,9,249,212,254,252,88,0,0,3,0,166,255,242,
+3,229,4,84,0,9,0,19,0,29,0,0,55,52,51,50,22,21,20,6,35,34,17,52,51,50,22,
+21,20,6,35,34,1,52,51,50,22,21,20,6,35,34,166,129,63,66,65,64,129,129,63,
+66,65,64,129,2,61,129,63,66,65,64,129,125,139,72,67,67,72,3,215,139,72,67,
+67,73,254,230,139,72,67,67,72,0,0,2,0,102,3,133,3,2,7,106,0,11,0,43,0,0,1,
+52,38,35,34,6,21,20,22,51,50,54,3,34,6,7,54,51,32,17,16,33,34,38,38,53,52,
+54,51,50,23,22,51,50,55,22,21,20,6,35,34,39,38,38,2,86,80,86,86,76,74,88,
+87,79,207,62,59,2,81,106,1,59,254,174,124,138,68,155,144,32,59,57,41,47,18,
+101,53,64,62,88,26,50,4,225,145,122,114,153,131,135,122,2,181,125,133,55,
+254,166,254,164,99,214,183,233,248,16,19,55,20,55,37,53,34,11,20,0,0,1,0,
+31,255,233,3,203,4,74,0,22,0,0,19,34,7,53,54,51,33,21,33,17,20,22,51,50,55,
+21,6,6,35,34,38,53,17,180,103,46,94,108,2,226,254,80,93,107,94,93,42,125,
+65,176,172,3,221,14,90,33,109,253,137,148,124,31,90,23,27,183,170,2,147,0,
+0,1,0,47,254,20,4,162,4,74,0,55,0,0,5,52,46,2,39,35,6,6,35,32,17,17,52,38,
+35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,53,33,17,20,22,23,22,22,21,
+20,6,6,35,34,38,38,53,52,54,51,20,22,51,50,54,3,225,21,27,25,5,10,58,159,
+129,254,174,74,92,8,1,111,102,113,125,133,72,94,8,1,110,25,29,28,25,130,236,
+148,144,222,128,76,72,173,173,164,157,90,50,79,64,52,23,105,93,1,145,1,235,
+70,70,86,253,61,151,129,169,162,1,166,76,72,86,253,12,52,97,63,65,99,56,114,
+185,103,63,125,71,63,68,151,144,161,0,1,255,244,254,20,4,211,4,94,0,65,0,
+0,1,54,54,51,32,17,17,20,22,23,22,22,21,20,6,6,35,34,38,38,53,52,54,51,20,
+22,51,50,54,53,52,38,39,38,53,17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,
+51,50,54,53,17,52,38,35,34,7,53,54,51,50,22,23,1,199,53,157,119,1,88,25,29,
+28,25,130,236,148,144,222,128,77,71,173,173,164,157,24,29,53,108,117,120,
+128,70,94,10,253,217,16,95,73,74,81,84,43,94,108,112,122,20,3,158,98,94,254,
+111,254,137,52,97,63,65,99,56,114,185,103,63,125,71,63,68,151,144,161,146,
+42,84,66,117,129,1,103,143,137,171,161,254,80,71,66,86,86,71,76,2,70,107,
+88,15,90,33,92,100,0,0,2,0,111,255,236,4,45,5,182,0,13,0,42,0,0,1,6,6,21,
+20,22,51,50,54,53,52,38,38,39,1,21,33,21,20,22,23,30,2,21,20,0,35,34,36,53,
+16,37,38,38,53,53,35,34,7,53,54,51,2,98,146,161,153,130,137,158,50,87,101,
+1,113,254,104,72,94,134,110,55,254,248,219,215,254,252,1,188,51,45,176,107,
+43,91,112,3,125,65,234,162,162,184,180,162,88,143,119,86,2,86,108,45,102,
+136,78,111,144,169,110,223,255,0,248,210,1,97,159,61,142,125,76,15,91,32,
+0,1,255,244,254,10,5,4,4,94,0,43,0,0,1,52,38,35,34,7,53,54,51,50,22,23,51,
+54,54,51,32,19,17,22,22,23,7,36,17,17,52,38,35,34,6,21,17,20,22,51,51,21,
+33,53,51,50,54,53,1,14,74,81,84,43,94,108,112,122,20,11,53,157,119,1,84,4,
+2,68,86,86,254,250,108,117,120,128,70,94,10,253,217,16,95,73,3,47,107,88,
+15,90,33,92,100,98,94,254,111,253,162,152,245,148,68,253,1,110,2,78,143,137,
+171,161,254,80,71,66,86,86,71,76,0,1,255,244,254,10,7,115,4,94,0,66,0,0,1,
+54,54,51,50,22,23,51,54,54,51,50,22,21,17,20,22,51,51,21,33,17,52,38,35,34,
+6,21,21,17,20,22,23,7,36,17,17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,
+50,54,53,17,52,38,35,34,7,53,54,51,50,22,23,1,209,54,140,115,112,151,34,16,
+53,150,119,164,170,64,91,9,254,155,104,111,109,118,67,89,86,254,249,104,111,
+116,121,71,95,8,253,217,27,90,67,74,81,84,43,94,108,117,128,20,3,164,100,
+86,95,91,97,89,200,201,254,28,76,71,86,2,195,143,137,154,141,10,253,197,147,
+246,152,68,254,1,109,2,78,143,137,172,160,254,80,70,67,86,86,69,78,2,70,107,
+88,15,90,33,89,97,0,2,255,102,255,236,4,59,6,31,0,11,0,36,0,0,1,52,38,35,
+34,6,21,20,22,51,50,54,1,51,54,54,51,50,18,17,16,33,34,38,2,17,17,52,38,35,
+34,7,53,54,51,32,17,3,119,137,150,148,126,130,144,148,139,253,205,8,53,156,
+94,220,228,254,29,178,201,92,72,84,87,40,97,106,1,19,2,29,242,210,203,249,
+223,232,212,2,171,55,62,254,231,254,236,253,207,168,1,102,1,22,1,224,105,
+89,14,90,33,254,209,0,0,2,0,57,255,236,7,66,4,94,0,12,0,63,0,0,1,52,38,35,
+34,6,21,17,20,22,51,50,17,19,39,35,6,6,35,34,38,53,17,52,38,35,35,53,33,23,
+51,54,54,51,50,22,23,51,54,54,51,50,22,21,17,20,22,51,51,21,33,17,52,38,35,
+34,6,21,17,20,22,51,51,21,3,98,104,111,116,121,96,108,248,41,26,11,55,145,
+121,167,161,68,87,9,1,66,27,10,54,140,115,112,151,34,16,53,150,119,164,170,
+64,91,9,254,155,104,111,111,116,64,91,9,2,195,143,137,172,160,254,248,156,
+124,1,75,254,70,166,99,87,195,206,1,235,73,67,86,166,100,86,95,91,97,89,200,
+201,254,28,76,71,86,2,195,143,137,157,148,254,63,76,71,86,0,0,1,0,41,0,0,
+3,133,4,94,0,23,0,0,37,20,22,51,51,21,33,53,51,50,54,53,17,52,38,35,34,7,
+53,54,54,51,32,17,2,205,70,94,20,253,207,18,95,71,118,138,114,113,32,166,
+68,1,154,233,76,71,86,86,65,72,1,244,150,137,31,90,16,33,254,131,0,2,255,
+246,254,10,4,244,6,20,0,11,0,41,0,0,1,52,38,35,34,6,21,20,22,51,50,54,7,6,
+35,32,17,17,52,38,38,35,35,53,33,17,20,7,51,54,51,50,18,17,17,20,22,23,7,
+38,2,53,3,158,136,145,152,126,140,150,140,129,15,117,171,254,63,35,67,66,
+16,1,121,9,9,123,190,227,211,65,85,86,135,127,2,14,235,206,199,217,232,208,
+204,180,155,2,59,3,12,50,61,28,86,254,125,149,84,162,254,245,254,232,254,
+72,163,242,140,68,133,1,48,200,0,2,0,57,255,236,7,86,4,94,0,13,0,69,0,0,1,
+20,22,51,50,54,53,17,52,38,35,34,6,21,39,52,38,35,34,6,21,17,20,22,51,51,
+21,33,53,51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,51,50,22,23,51,54,54,
+51,50,22,21,17,20,22,51,51,21,33,39,35,6,6,35,34,38,53,4,55,94,109,118,122,
+104,111,110,118,192,104,111,115,123,71,95,8,253,217,27,90,68,68,88,8,1,65,
+27,10,54,140,115,112,151,34,17,52,148,121,164,170,66,90,8,254,197,27,10,48,
+147,121,164,159,1,135,147,133,172,159,1,9,143,137,157,148,25,143,137,172,
+160,254,80,70,67,86,86,70,77,2,127,73,67,86,166,100,86,95,91,96,90,200,201,
+254,28,77,70,86,166,94,92,198,203,0,0,2,0,113,255,236,4,207,6,31,0,9,0,34,
+0,0,1,16,33,50,54,17,17,35,34,6,1,21,35,17,16,2,35,34,0,17,16,0,33,51,16,
+33,34,7,53,54,54,51,50,22,21,1,55,1,47,143,120,236,171,159,3,152,162,220,
+239,236,254,251,1,6,1,14,232,254,249,148,124,54,178,67,205,223,2,37,254,51,
+227,1,19,1,145,217,1,68,107,254,119,254,187,254,219,1,41,1,16,1,22,1,15,1,
+104,31,91,21,28,248,221,0,0,1,0,37,0,0,4,219,6,33,0,45,0,0,1,54,51,32,17,
+17,20,22,51,51,21,33,17,52,38,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,
+53,17,16,33,50,22,23,21,38,35,34,6,21,21,20,7,1,160,92,209,1,106,68,90,6,
+254,156,108,117,121,127,73,95,6,253,217,16,95,73,1,228,65,193,57,137,148,
+173,148,8,3,164,186,254,111,254,28,78,69,86,2,195,143,137,173,159,254,80,
+71,66,86,86,73,74,3,185,1,127,28,21,90,30,136,153,65,58,116,0,1,0,57,255,
+236,7,66,4,74,0,56,0,0,37,20,22,22,51,51,21,33,39,35,6,6,35,34,38,39,35,6,
+6,35,32,17,17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,53,33,
+17,20,22,51,50,54,53,17,52,38,35,35,53,33,6,158,31,62,62,9,254,190,27,10,
+52,141,116,112,151,34,16,51,151,120,254,178,64,91,9,1,101,104,111,111,116,
+66,90,8,1,101,104,111,114,123,71,95,8,1,111,225,51,61,27,86,166,98,88,95,
+91,96,90,1,145,1,227,76,72,86,253,61,143,137,157,148,1,192,77,71,86,253,61,
+143,137,171,160,1,176,69,69,86,0,0,1,255,244,255,236,5,2,4,94,0,39,0,0,1,
+20,22,51,50,54,53,17,52,38,35,35,53,33,17,20,22,51,51,21,33,39,35,6,6,35,
+32,17,17,52,38,35,34,7,53,54,51,50,22,21,1,186,101,114,125,133,70,95,9,1,
+111,71,95,8,254,186,26,10,53,154,125,254,174,66,78,79,39,90,104,137,123,1,
+135,148,132,169,162,1,166,75,73,86,252,149,70,67,86,166,96,90,1,145,1,178,
+104,91,15,90,33,152,143,0,0,1,255,244,254,10,4,240,4,94,0,40,0,0,37,20,22,
+23,7,38,2,53,35,6,6,35,34,38,53,17,52,38,35,34,7,53,54,51,50,22,21,17,20,
+22,51,50,54,53,17,52,38,35,35,53,33,4,84,66,90,86,138,125,8,59,161,85,176,
+176,66,78,79,39,90,104,137,123,101,114,125,133,70,95,9,1,111,111,155,243,
+147,68,136,1,47,198,77,78,205,196,1,178,104,91,15,90,33,152,143,254,80,148,
+132,169,162,1,166,75,73,86,0,1,0,47,255,236,7,76,6,20,0,57,0,0,37,20,22,51,
+51,21,33,39,35,6,6,35,34,38,53,17,52,38,35,35,53,33,17,20,22,51,50,17,17,
+52,38,35,35,53,33,17,20,7,51,54,54,51,50,22,21,17,20,22,51,51,21,33,17,52,
+38,35,34,17,4,35,71,95,8,254,186,26,11,55,145,121,167,161,74,92,8,1,111,96,
+108,248,73,93,8,1,111,8,10,46,139,106,175,177,66,90,8,254,155,101,114,237,
+223,70,67,86,166,99,87,195,206,1,235,70,70,86,253,61,156,124,1,75,3,113,76,
+71,86,254,62,58,116,93,93,191,210,254,28,77,70,86,2,195,148,132,254,180,0,
+1,0,10,255,236,4,188,6,20,0,34,0,0,37,20,22,51,51,21,33,39,35,6,6,35,32,17,
+17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,53,33,4,14,71,95,
+8,254,187,27,10,53,154,125,254,174,71,91,8,1,107,102,113,125,133,72,94,8,
+1,110,223,70,67,86,166,96,90,1,145,3,182,72,67,86,251,115,151,129,169,162,
+1,166,76,72,86,0,2,0,168,254,20,4,100,4,94,0,10,0,43,0,0,37,32,17,52,38,35,
+34,6,17,20,22,19,50,54,55,22,22,21,20,6,6,35,34,2,53,17,16,18,51,50,22,22,
+21,16,2,35,34,38,39,35,23,23,20,22,2,129,1,29,149,134,151,132,131,156,105,
+129,28,48,69,97,172,112,233,244,253,230,138,216,119,230,247,100,149,38,8,
+6,2,141,111,1,192,212,239,212,254,240,230,185,254,6,143,150,3,66,65,66,121,
+69,1,13,248,1,225,1,36,1,64,137,253,165,254,218,254,223,96,84,87,93,189,186,
+0,1,0,57,254,10,7,51,6,20,0,55,0,0,37,20,22,23,7,38,2,53,35,6,6,35,35,38,
+39,35,6,6,35,32,17,17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,
+35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,53,33,6,158,63,86,86,135,127,
+8,58,133,96,10,229,68,16,51,151,120,254,178,64,91,9,1,101,104,111,111,116,
+66,90,8,1,101,104,111,114,123,71,95,8,1,111,111,159,243,143,68,133,1,48,200,
+84,71,5,181,96,90,1,145,1,227,76,72,86,253,61,143,137,157,148,1,192,77,71,
+86,253,61,143,137,171,160,3,123,70,67,86,0,0,3,0,113,254,10,6,231,4,94,0,
+33,0,45,0,57,0,0,1,7,36,17,52,55,35,6,6,35,32,17,16,18,51,50,22,23,54,54,
+51,50,18,17,16,2,35,34,39,35,22,21,20,22,1,50,54,53,52,38,35,34,6,21,20,22,
+1,34,6,21,20,22,51,50,54,53,52,38,4,168,86,254,250,8,8,47,151,116,254,95,
+233,219,124,186,63,59,199,121,220,230,207,210,211,103,8,8,65,253,232,149,
+130,135,146,128,124,122,3,114,149,130,133,148,129,123,118,254,78,68,207,1,
+45,55,107,97,91,2,55,1,22,1,37,100,113,100,113,254,227,254,230,254,224,254,
+229,188,107,61,115,195,1,165,198,238,238,202,216,226,227,207,3,108,198,238,
+227,213,216,226,218,216,0,1,0,41,254,10,4,131,6,20,0,44,0,0,1,52,38,38,35,
+35,53,33,17,55,54,51,50,22,21,20,6,7,38,38,35,34,7,17,20,22,23,7,36,17,17,
+7,6,35,34,38,53,52,54,55,22,22,51,50,55,1,246,35,67,66,27,1,131,82,140,88,
+73,78,62,55,14,57,54,119,100,65,87,86,254,254,81,141,87,72,80,62,55,10,59,
+56,133,86,5,51,50,61,28,86,253,29,25,45,80,66,52,73,12,74,53,20,253,168,149,
+248,148,68,249,1,114,2,49,24,46,79,67,52,73,12,68,59,20,0,0,1,0,57,0,0,4,
+240,4,94,0,39,0,0,37,21,33,53,51,50,54,53,17,52,38,35,35,53,33,23,51,54,54,
+51,32,17,17,20,22,51,51,21,33,17,52,38,35,34,6,21,17,20,22,51,2,96,253,217,
+17,95,73,74,92,8,1,75,27,10,51,146,123,1,88,64,91,9,254,155,108,117,120,128,
+71,95,86,86,86,73,74,2,127,70,70,86,166,94,92,254,111,254,28,76,71,86,2,195,
+143,137,171,161,254,80,70,67,0,1,0,47,254,10,4,211,4,74,0,35,0,0,5,34,38,
+53,17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,53,33,17,20,22,
+23,7,38,2,53,35,6,6,2,61,176,176,74,92,8,1,111,102,113,125,133,72,94,8,1,
+110,66,90,86,135,127,8,59,162,20,205,196,1,235,70,70,86,253,61,151,129,169,
+162,1,166,76,72,86,252,37,155,243,147,68,133,1,48,200,77,78,0,0,1,0,47,254,
+20,4,55,4,74,0,47,0,0,37,52,55,35,6,6,35,32,17,17,52,38,35,35,53,33,17,20,
+22,51,50,54,53,17,52,38,35,35,53,33,17,20,6,6,35,34,38,38,53,52,54,51,20,
+22,51,50,54,53,3,119,14,10,53,154,125,254,174,74,92,8,1,111,102,113,125,133,
+72,94,8,1,110,120,219,138,120,170,93,76,72,124,109,155,132,4,69,93,96,90,
+1,145,1,235,70,70,86,253,61,151,129,169,162,1,166,76,72,86,251,184,149,225,
+120,71,119,69,63,68,136,159,175,214,0,1,0,10,254,10,4,178,6,20,0,36,0,0,37,
+20,22,23,7,38,2,53,17,52,38,35,35,53,33,17,20,7,51,54,51,32,17,17,20,22,51,
+51,21,33,17,52,38,35,34,6,21,1,117,67,84,86,124,134,71,91,8,1,107,8,10,92,
+209,1,106,66,90,8,254,156,108,117,121,127,111,156,244,145,68,120,1,57,186,
+4,190,72,67,86,254,62,58,116,186,254,111,254,28,77,70,86,2,195,143,137,173,
+159,0,1,0,57,254,20,4,229,4,94,0,44,0,0,5,20,22,51,50,54,55,22,22,21,20,6,
+6,35,34,2,53,17,52,38,35,35,53,33,23,51,54,54,51,32,17,17,20,22,51,51,21,
+33,17,52,38,35,34,6,21,1,168,126,128,101,103,15,61,66,85,160,105,216,227,
+75,90,9,1,76,27,10,53,147,119,1,89,64,91,8,254,156,108,117,120,128,20,192,
+183,137,135,5,74,54,65,108,63,1,13,248,3,79,72,68,86,166,97,89,254,111,254,
+28,76,71,86,2,195,143,137,171,161,0,0,2,0,113,255,238,7,33,6,20,0,44,0,56,
+0,0,1,16,33,34,2,17,16,18,51,50,22,23,51,38,53,53,52,38,38,35,35,53,33,17,
+7,7,51,54,54,51,32,17,17,20,22,51,51,21,33,17,52,38,35,34,17,7,52,38,35,34,
+6,21,20,22,51,50,54,3,248,254,59,218,232,200,207,101,149,53,13,13,35,67,66,
+16,1,121,8,4,10,51,139,123,1,78,66,90,8,254,155,101,114,237,193,126,144,125,
+117,123,135,133,121,2,41,253,197,1,33,1,20,1,35,1,24,86,96,163,64,168,50,
+61,28,86,254,115,164,59,95,87,254,111,254,28,77,70,86,2,195,148,132,254,180,
+104,242,194,208,234,239,220,222,0,0,1,0,57,254,10,7,66,4,94,0,57,0,0,37,20,
+22,23,7,38,2,53,17,52,38,35,35,53,33,23,51,54,54,51,50,22,23,51,54,54,51,
+50,22,21,17,20,22,51,51,21,33,17,52,38,35,34,6,21,17,20,22,51,51,21,33,17,
+52,38,35,34,6,21,1,158,67,84,86,124,134,68,87,9,1,66,27,10,54,140,115,112,
+151,34,16,53,150,119,164,170,64,91,9,254,155,104,111,111,116,64,91,9,254,
+155,104,111,116,121,111,156,244,145,68,120,1,57,186,2,243,73,67,86,166,100,
+86,95,91,97,89,200,201,254,28,76,71,86,2,195,143,137,157,148,254,63,76,71,
+86,2,195,143,137,172,160,0,0,1,255,244,254,20,4,147,4,94,0,52,0,0,1,52,38,
+35,34,7,53,54,51,50,22,23,51,54,54,51,32,17,21,35,53,52,38,35,34,6,21,21,
+54,51,50,22,21,16,33,34,38,53,52,51,6,21,20,22,51,50,54,53,52,38,35,34,7,
+1,14,74,81,84,43,94,108,112,122,20,11,53,157,119,1,88,192,108,117,120,128,
+105,110,244,249,254,33,224,253,246,47,139,141,145,134,163,183,147,210,3,47,
+107,88,15,90,33,92,100,98,94,254,111,191,181,143,137,171,161,245,24,235,226,
+254,47,189,160,252,88,125,145,136,172,186,196,157,39,0,1,0,47,254,20,4,57,
+4,74,0,47,0,0,37,22,21,21,20,22,51,50,54,53,50,22,21,20,6,6,35,34,38,38,53,
+17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,53,33,17,16,33,34,
+38,39,1,143,15,132,154,111,123,71,76,93,171,119,140,218,119,74,92,8,1,111,
+133,125,114,101,72,94,8,1,110,254,174,125,155,51,166,86,76,12,216,173,159,
+136,68,63,69,119,71,121,225,148,3,102,70,70,86,253,112,161,170,133,147,1,
+217,76,72,86,253,51,254,111,91,95,0,1,255,195,254,147,3,252,4,74,0,30,0,0,
+1,19,19,33,34,7,53,54,51,33,21,1,23,22,22,51,50,55,23,6,6,35,34,46,2,39,1,
+35,1,3,1,78,153,201,254,82,138,61,97,106,2,121,254,197,102,65,94,58,42,44,
+35,34,80,62,57,81,65,67,66,254,158,215,1,223,228,3,123,254,239,1,115,14,90,
+33,84,253,215,172,107,84,27,66,35,44,34,66,115,137,253,71,3,89,1,143,0,1,
+255,244,255,236,7,135,4,94,0,63,0,0,1,20,22,51,50,17,17,52,38,35,35,53,33,
+17,20,22,51,51,21,33,39,35,6,6,35,34,38,53,17,52,38,35,34,17,17,20,22,51,
+51,21,33,53,51,50,54,53,17,52,38,35,34,7,53,54,51,50,22,23,51,54,54,51,32,
+17,4,84,96,109,248,72,94,9,1,111,71,95,8,254,187,27,10,54,147,121,167,161,
+101,114,237,70,94,10,253,217,16,95,73,74,81,84,43,94,108,112,122,20,11,55,
+149,115,1,78,1,135,156,124,1,75,1,166,76,72,86,252,149,70,67,86,166,97,89,
+195,206,1,70,148,132,254,180,254,80,71,66,86,86,71,76,2,70,107,88,15,90,33,
+92,100,101,91,254,111,0,1,0,10,254,10,4,117,6,20,0,37,0,0,37,20,22,23,7,38,
+2,53,17,52,38,35,35,53,33,17,20,7,51,54,51,50,22,21,20,22,22,51,51,21,33,
+53,52,38,35,34,6,21,1,117,67,84,86,124,134,71,91,8,1,107,8,10,83,189,160,
+170,27,54,75,8,254,155,95,101,107,108,111,156,244,145,68,120,1,57,186,4,190,
+72,67,86,254,62,58,116,186,191,210,57,63,28,86,224,147,133,174,158,0,1,0,
+113,255,236,4,45,4,94,0,27,0,0,5,34,38,53,52,54,51,6,21,20,22,51,50,54,53,
+52,38,35,34,7,53,54,54,51,50,18,17,16,2,78,222,255,121,124,47,138,143,143,
+135,145,162,107,190,55,171,83,244,250,20,235,203,133,129,92,121,196,185,219,
+246,246,213,31,90,18,31,254,224,254,233,253,197,0,0,1,0,47,254,10,4,211,6,
+20,0,35,0,0,5,34,38,53,17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,
+35,35,53,33,17,20,22,23,7,38,2,53,35,6,6,2,61,176,176,74,92,8,1,111,102,113,
+125,133,73,93,8,1,110,66,90,86,135,127,8,59,162,20,205,196,1,235,70,70,86,
+253,61,151,129,169,162,3,113,76,71,86,250,91,155,243,147,68,133,1,48,200,
+77,78,0,0,1,0,47,254,10,4,55,4,74,0,32,0,0,1,16,5,22,22,23,7,38,3,38,38,53,
+17,52,38,35,35,53,33,17,20,22,51,50,54,53,17,52,38,35,35,53,33,4,55,254,154,
+5,63,83,86,240,18,146,161,74,92,8,1,111,113,124,124,112,72,94,8,1,110,1,217,
+254,63,38,108,187,125,68,204,1,36,31,233,209,1,149,70,70,86,253,135,201,178,
+185,202,1,135,76,72,86,0,2,0,113,255,238,7,33,6,33,0,11,0,60,0,0,1,52,38,
+35,34,6,21,20,22,51,50,54,19,7,7,51,54,54,51,32,17,17,20,22,51,51,21,33,17,
+52,38,35,34,17,21,16,33,34,2,17,16,18,51,50,22,23,51,38,53,53,16,33,50,22,
+23,21,38,35,34,6,21,3,55,124,146,125,117,123,135,132,122,193,8,4,10,51,139,
+123,1,78,66,90,8,254,155,101,114,237,254,59,218,232,200,207,101,149,53,11,
+11,1,228,65,193,57,137,148,173,148,2,41,240,194,208,234,239,220,222,3,83,
+164,59,95,87,254,111,254,28,77,70,86,2,195,148,132,254,180,102,253,197,1,
+33,1,20,1,35,1,24,86,96,183,44,23,1,127,28,21,90,30,136,153,0,2,0,166,255,
+242,1,168,4,84,0,11,0,23,0,0,55,52,54,51,50,22,21,20,6,35,34,38,17,52,54,
+51,50,22,21,20,6,35,34,38,166,64,65,63,66,65,64,65,64,64,65,63,66,65,64,65,
+64,125,69,70,72,67,67,72,69,3,146,69,70,72,67,67,73,70,0,0,0,15,0,186,0,3,
+0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,38,0,94,0,3,0,1,4,9,0,2,0,14,0,132,
+0,3,0,1,4,9,0,3,0,76,0,146,0,3,0,1,4,9,0,4,0,38,0,94,0,3,0,1,4,9,0,5,0,30,
+0,222,0,3,0,1,4,9,0,6,0,34,0,252,0,3,0,1,4,9,0,7,0,68,1,30,0,3,0,1,4,9,0,
+8,0,42,1,98,0,3,0,1,4,9,0,9,0,40,1,140,0,3,0,1,4,9,0,10,0,96,1,180,0,3,0,
+1,4,9,0,11,0,62,2,20,0,3,0,1,4,9,0,12,0,60,2,82,0,3,0,1,4,9,0,13,2,150,2,
+142,0,3,0,1,4,9,0,14,0,52,5,36,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,
+104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,
+0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,71,0,101,0,111,
+0,114,0,103,0,105,0,97,0,110,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,
+0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,
+105,0,102,0,32,0,71,0,101,0,111,0,114,0,103,0,105,0,97,0,110,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,54,0,32,0,117,0,104,0,78,
+0,111,0,116,0,111,0,83,0,101,0,114,0,105,0,102,0,71,0,101,0,111,0,114,0,103,
+0,105,0,97,0,110,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,
+116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,
+97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,
+32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,
+0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,
+0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,
+0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,
+0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,
+110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,
+101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,
+0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,
+111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,
+0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,
+0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,
+73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,
+0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,
+0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,
+0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,
+120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,
+0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,
+0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,
+0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,
+0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,
+0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,127,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,
+1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,
+1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,
+1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,
+1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,
+1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,
+1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,
+102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,
+1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,4,110,117,
+108,108,7,117,110,105,49,48,65,48,7,117,110,105,49,48,65,49,7,117,110,105,
+49,48,65,50,7,117,110,105,49,48,65,51,7,117,110,105,49,48,65,52,7,117,110,
+105,49,48,65,53,7,117,110,105,49,48,65,54,7,117,110,105,49,48,65,55,7,117,
+110,105,49,48,65,56,7,117,110,105,49,48,65,57,7,117,110,105,49,48,65,65,7,
+117,110,105,49,48,65,66,7,117,110,105,49,48,65,67,7,117,110,105,49,48,65,
+68,7,117,110,105,49,48,65,69,7,117,110,105,49,48,65,70,7,117,110,105,49,48,
+66,48,7,117,110,105,49,48,66,49,7,117,110,105,49,48,66,50,7,117,110,105,49,
+48,66,51,7,117,110,105,49,48,66,52,7,117,110,105,49,48,66,53,7,117,110,105,
+49,48,66,54,7,117,110,105,49,48,66,55,7,117,110,105,49,48,66,56,7,117,110,
+105,49,48,66,57,7,117,110,105,49,48,66,65,7,117,110,105,49,48,66,66,7,117,
+110,105,49,48,66,67,7,117,110,105,49,48,66,68,7,117,110,105,49,48,66,69,7,
+117,110,105,49,48,66,70,7,117,110,105,49,48,67,48,7,117,110,105,49,48,67,
+49,7,117,110,105,49,48,67,50,7,117,110,105,49,48,67,51,7,117,110,105,49,48,
+67,52,7,117,110,105,49,48,67,53,7,117,110,105,49,48,68,48,7,117,110,105,49,
+48,68,49,7,117,110,105,49,48,68,50,7,117,110,105,49,48,68,51,7,117,110,105,
+49,48,68,52,7,117,110,105,49,48,68,53,7,117,110,105,49,48,68,54,7,117,110,
+105,49,48,68,55,7,117,110,105,49,48,68,56,7,117,110,105,49,48,68,57,7,117,
+110,105,49,48,68,65,7,117,110,105,49,48,68,66,7,117,110,105,49,48,68,67,7,
+117,110,105,49,48,68,68,7,117,110,105,49,48,68,69,7,117,110,105,49,48,68,
+70,7,117,110,105,49,48,69,48,7,117,110,105,49,48,69,49,7,117,110,105,49,48,
+69,50,7,117,110,105,49,48,69,51,7,117,110,105,49,48,69,52,7,117,110,105,49,
+48,69,53,7,117,110,105,49,48,69,54,7,117,110,105,49,48,69,55,7,117,110,105,
+49,48,69,56,7,117,110,105,49,48,69,57,7,117,110,105,49,48,69,65,7,117,110,
+105,49,48,69,66,7,117,110,105,49,48,69,67,7,117,110,105,49,48,69,68,7,117,
+110,105,49,48,69,69,7,117,110,105,49,48,69,70,7,117,110,105,49,48,70,48,7,
+117,110,105,49,48,70,49,7,117,110,105,49,48,70,50,7,117,110,105,49,48,70,
+51,7,117,110,105,49,48,70,52,7,117,110,105,49,48,70,53,7,117,110,105,49,48,
+70,54,7,117,110,105,49,48,70,55,7,117,110,105,49,48,70,56,7,117,110,105,49,
+48,70,57,7,117,110,105,49,48,70,65,7,117,110,105,49,48,70,66,7,117,110,105,
+49,48,70,67,7,117,110,105,50,68,48,48,7,117,110,105,50,68,48,49,7,117,110,
+105,50,68,48,50,7,117,110,105,50,68,48,51,7,117,110,105,50,68,48,52,7,117,
+110,105,50,68,48,53,7,117,110,105,50,68,48,54,7,117,110,105,50,68,48,55,7,
+117,110,105,50,68,48,56,7,117,110,105,50,68,48,57,7,117,110,105,50,68,48,
+65,7,117,110,105,50,68,48,66,7,117,110,105,50,68,48,67,7,117,110,105,50,68,
+48,68,7,117,110,105,50,68,48,69,7,117,110,105,50,68,48,70,7,117,110,105,50,
+68,49,48,7,117,110,105,50,68,49,49,7,117,110,105,50,68,49,50,7,117,110,105,
+50,68,49,51,7,117,110,105,50,68,49,52,7,117,110,105,50,68,49,53,7,117,110,
+105,50,68,49,54,7,117,110,105,50,68,49,55,7,117,110,105,50,68,49,56,7,117,
+110,105,50,68,49,57,7,117,110,105,50,68,49,65,7,117,110,105,50,68,49,66,7,
+117,110,105,50,68,49,67,7,117,110,105,50,68,49,68,7,117,110,105,50,68,49,
+69,7,117,110,105,50,68,49,70,7,117,110,105,50,68,50,48,7,117,110,105,50,68,
+50,49,7,117,110,105,50,68,50,50,7,117,110,105,50,68,50,51,7,117,110,105,50,
+68,50,52,7,117,110,105,50,68,50,53,7,117,110,105,48,53,56,57,7,117,110,105,
+70,69,70,70,0,0,0,0,1,0,3,0,8,0,10,0,14,0,7,255,255,0,15,0,1,0,0,0,12,0,0,
+0,22,0,0,0,2,0,1,0,0,0,126,0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,30,0,44,
+0,1,103,101,111,114,0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,107,101,114,110,0,
+8,0,0,0,1,0,0,0,1,0,4,0,2,0,8,0,1,0,8,0,1,14,64,0,4,0,0,0,120,0,250,1,16,
+1,58,2,4,2,42,2,96,2,186,2,96,1,16,3,12,3,94,3,176,4,26,4,124,4,198,1,16,
+2,96,4,216,5,78,4,124,5,92,5,138,5,212,6,18,4,198,6,60,6,142,6,164,7,14,4,
+198,7,88,7,194,8,92,8,210,9,12,1,16,9,86,9,188,9,238,10,4,10,26,10,4,10,68,
+10,26,10,4,10,4,10,4,10,26,10,4,10,74,10,92,10,114,10,136,10,68,10,158,10,
+180,10,206,10,216,10,26,10,68,10,4,10,68,10,226,10,4,10,244,10,74,11,34,11,
+60,10,4,11,60,11,118,11,118,11,124,10,26,10,26,11,166,10,4,11,180,11,210,
+10,4,11,236,12,10,12,148,12,214,12,232,13,26,13,44,13,58,13,26,13,58,13,58,
+13,58,13,58,13,72,13,58,13,130,13,144,13,130,13,58,13,158,13,26,13,130,13,
+172,13,190,13,58,13,130,13,130,13,58,13,58,13,58,13,58,13,58,14,8,13,130,
+14,22,13,26,13,130,14,36,13,58,14,54,0,5,0,41,255,184,0,78,255,133,0,87,255,
+195,0,108,255,195,0,118,255,195,0,10,0,46,255,236,0,47,255,236,0,51,255,236,
+0,77,255,236,0,78,255,236,0,81,255,236,0,87,255,205,0,95,255,195,0,108,255,
+205,0,118,255,215,0,50,0,4,255,123,0,5,255,51,0,6,255,174,0,8,255,174,0,9,
+255,174,0,10,255,82,0,11,255,123,0,12,255,82,0,14,255,82,0,17,255,123,0,18,
+255,82,0,19,255,82,0,20,255,174,0,23,255,123,0,24,255,113,0,25,255,113,0,
+26,255,225,0,27,255,51,0,30,255,123,0,35,255,113,0,36,255,184,0,38,255,195,
+0,39,0,31,0,40,255,143,0,87,255,72,0,88,255,123,0,90,255,143,0,94,255,123,
+0,95,255,45,0,97,255,205,0,98,255,154,0,100,255,123,0,101,255,143,0,103,255,
+123,0,105,255,154,0,106,255,123,0,107,255,154,0,108,255,72,0,110,255,123,
+0,111,255,123,0,112,255,195,0,113,255,164,0,114,255,143,0,115,255,195,0,117,
+255,123,0,120,255,195,0,121,255,154,0,122,255,123,0,123,255,123,0,124,255,
+143,0,9,0,10,255,195,0,12,255,195,0,18,255,195,0,19,255,195,0,41,255,184,
+0,78,255,133,0,87,255,195,0,95,255,143,0,108,255,195,0,13,0,14,255,195,0,
+35,255,123,0,36,255,195,0,46,255,236,0,47,255,236,0,51,255,236,0,77,255,236,
+0,78,255,236,0,81,255,236,0,87,255,205,0,95,255,195,0,108,255,205,0,118,255,
+215,0,22,0,4,0,20,0,5,255,225,0,6,255,174,0,8,255,174,0,9,255,174,0,10,255,
+82,0,11,0,20,0,12,255,82,0,14,255,82,0,17,0,20,0,18,255,82,0,19,255,82,0,
+23,0,20,0,26,255,225,0,27,255,225,0,30,0,20,0,35,255,113,0,36,255,184,0,38,
+255,195,0,39,0,31,0,40,255,143,0,95,255,195,0,20,0,5,255,205,0,6,255,195,
+0,8,255,195,0,9,255,195,0,10,255,143,0,12,255,41,0,14,255,195,0,18,255,143,
+0,19,255,143,0,24,255,215,0,27,255,205,0,35,255,143,0,36,255,195,0,38,255,
+215,0,39,0,10,0,40,255,123,0,87,255,174,0,95,255,215,0,108,255,174,0,118,
+255,195,0,20,0,5,255,195,0,6,255,143,0,8,255,143,0,9,255,143,0,10,255,51,
+0,12,255,41,0,14,255,174,0,18,255,51,0,19,255,51,0,24,255,215,0,27,255,133,
+0,35,255,143,0,36,255,174,0,38,255,215,0,39,255,215,0,40,255,123,0,87,255,
+174,0,95,255,174,0,108,255,174,0,118,255,195,0,20,0,5,0,10,0,6,255,195,0,
+8,255,195,0,9,255,195,0,10,255,41,0,12,255,41,0,14,255,195,0,18,255,41,0,
+19,255,41,0,24,255,205,0,27,255,205,0,35,255,123,0,36,255,195,0,38,255,215,
+0,39,0,10,0,40,255,123,0,87,255,174,0,95,255,215,0,108,255,174,0,118,255,
+195,0,26,0,4,0,20,0,5,255,225,0,6,255,195,0,8,255,195,0,9,255,195,0,10,255,
+82,0,11,0,20,0,12,255,82,0,14,255,82,0,17,0,20,0,18,255,82,0,19,255,143,0,
+23,0,20,0,26,255,225,0,27,255,225,0,30,0,20,0,35,255,113,0,36,255,184,0,38,
+255,195,0,39,0,72,0,40,255,164,0,41,255,195,0,87,255,184,0,93,0,72,0,95,255,
+195,0,108,0,51,0,24,0,5,255,195,0,6,255,154,0,8,255,154,0,9,255,154,0,10,
+255,133,0,12,255,133,0,14,255,133,0,18,255,133,0,19,255,133,0,24,255,195,
+0,27,255,195,0,36,255,133,0,39,255,215,0,40,255,184,0,46,255,236,0,47,255,
+236,0,51,255,236,0,77,255,236,0,78,255,236,0,81,255,236,0,87,255,113,0,95,
+255,195,0,108,255,195,0,118,255,215,0,18,0,10,255,154,0,12,255,154,0,14,0,
+20,0,18,255,154,0,19,255,154,0,35,255,195,0,36,0,20,0,38,255,215,0,89,0,41,
+0,91,0,41,0,92,0,41,0,95,0,41,0,101,0,41,0,102,0,41,0,109,0,41,0,116,0,41,
+0,118,0,51,0,119,0,41,0,4,0,41,255,184,0,78,255,133,0,87,255,195,0,108,255,
+195,0,29,0,5,255,174,0,6,254,215,0,8,254,215,0,9,254,215,0,10,255,92,0,12,
+255,92,0,13,255,195,0,14,255,92,0,18,255,92,0,19,255,92,0,24,255,174,0,25,
+255,174,0,27,255,174,0,35,255,184,0,36,255,92,0,39,255,174,0,40,255,174,0,
+87,255,174,0,89,255,225,0,91,255,225,0,92,255,225,0,95,255,174,0,101,255,
+225,0,102,255,225,0,108,255,174,0,109,255,225,0,116,255,225,0,118,255,215,
+0,119,255,225,0,3,0,20,255,154,0,41,255,215,0,118,0,20,0,11,0,10,255,174,
+0,12,255,174,0,14,0,10,0,18,255,174,0,19,255,174,0,20,255,184,0,31,255,215,
+0,35,255,147,0,36,0,10,0,38,255,195,0,41,255,102,0,18,0,4,0,20,0,5,0,61,0,
+10,255,154,0,11,0,20,0,12,255,154,0,14,0,72,0,17,0,20,0,18,255,102,0,19,255,
+154,0,23,0,20,0,25,0,41,0,30,0,20,0,35,255,154,0,36,0,72,0,41,255,205,0,87,
+255,225,0,95,255,195,0,108,255,225,0,15,0,6,255,143,0,8,255,143,0,9,255,143,
+0,14,255,195,0,36,255,195,0,46,255,236,0,47,255,236,0,51,255,236,0,77,255,
+236,0,78,255,236,0,81,255,236,0,87,255,205,0,95,255,195,0,108,255,205,0,118,
+255,215,0,10,0,46,255,236,0,47,255,236,0,51,255,236,0,77,255,236,0,78,255,
+236,0,81,255,236,0,87,255,184,0,95,255,195,0,108,255,184,0,118,255,215,0,
+20,0,5,255,246,0,6,255,195,0,8,255,195,0,9,255,195,0,10,255,143,0,12,255,
+41,0,14,255,195,0,18,255,143,0,19,255,143,0,24,255,215,0,27,255,246,0,35,
+255,143,0,36,255,195,0,38,255,215,0,39,0,41,0,40,255,123,0,87,255,174,0,95,
+255,215,0,108,0,51,0,118,0,20,0,5,0,14,0,72,0,24,255,236,0,36,0,72,0,38,0,
+31,0,118,0,31,0,26,0,4,0,20,0,5,255,225,0,6,255,195,0,8,255,195,0,9,255,195,
+0,10,255,82,0,11,0,20,0,12,255,82,0,14,255,82,0,17,0,20,0,18,255,82,0,19,
+255,143,0,23,0,20,0,26,255,225,0,27,255,225,0,30,0,20,0,35,255,113,0,36,255,
+184,0,38,255,195,0,39,0,31,0,40,255,143,0,41,255,195,0,87,255,195,0,93,0,
+72,0,95,255,195,0,108,0,51,0,18,0,6,0,31,0,8,0,31,0,9,0,31,0,14,0,41,0,20,
+255,113,0,25,0,31,0,31,255,195,0,35,255,164,0,36,0,41,0,41,255,133,0,90,255,
+195,0,98,255,195,0,105,255,195,0,107,255,195,0,114,255,195,0,118,0,20,0,121,
+255,195,0,124,255,195,0,26,0,20,255,139,0,31,255,147,0,41,255,184,0,87,255,
+225,0,88,255,195,0,90,255,123,0,94,255,195,0,95,255,205,0,97,255,195,0,98,
+255,195,0,100,255,195,0,103,255,205,0,105,255,195,0,106,255,195,0,107,255,
+195,0,108,255,225,0,110,255,195,0,111,255,195,0,113,255,195,0,114,255,195,
+0,115,255,195,0,117,255,195,0,121,255,195,0,122,255,205,0,123,255,195,0,124,
+255,195,0,38,0,20,255,164,0,25,255,123,0,31,255,184,0,39,255,225,0,41,255,
+205,0,87,255,154,0,88,255,154,0,89,255,236,0,90,255,143,0,91,255,236,0,92,
+255,236,0,93,0,123,0,94,255,154,0,95,255,236,0,97,255,154,0,98,255,143,0,
+100,255,154,0,101,255,236,0,102,255,236,0,103,255,143,0,105,255,143,0,106,
+255,154,0,107,255,143,0,108,255,45,0,109,255,236,0,110,255,154,0,111,255,
+154,0,113,255,154,0,114,255,143,0,115,255,154,0,116,255,236,0,117,255,154,
+0,118,255,195,0,119,255,236,0,121,255,143,0,122,255,143,0,123,255,154,0,124,
+255,143,0,29,0,5,255,174,0,6,254,215,0,8,254,215,0,9,254,215,0,10,255,92,
+0,12,255,92,0,13,255,195,0,14,255,92,0,18,255,92,0,19,255,92,0,24,255,174,
+0,25,255,174,0,27,255,174,0,35,255,184,0,36,255,92,0,39,255,174,0,40,255,
+174,0,87,255,123,0,89,255,225,0,91,255,225,0,92,255,225,0,95,255,174,0,101,
+255,225,0,102,255,225,0,108,255,225,0,109,255,225,0,116,255,225,0,118,255,
+215,0,119,255,225,0,14,0,5,255,205,0,6,255,133,0,8,255,133,0,9,255,133,0,
+10,255,123,0,12,255,123,0,14,255,123,0,18,255,123,0,19,255,123,0,27,255,205,
+0,35,255,92,0,36,255,123,0,39,255,205,0,40,255,205,0,18,0,10,255,154,0,12,
+255,154,0,14,0,20,0,18,255,154,0,19,255,154,0,35,255,195,0,36,0,20,0,38,255,
+215,0,89,0,41,0,91,0,41,0,92,0,41,0,95,255,236,0,101,0,41,0,102,0,41,0,109,
+0,41,0,116,0,41,0,118,255,225,0,119,0,41,0,25,0,6,255,236,0,8,255,236,0,9,
+255,236,0,10,255,225,0,12,255,225,0,14,255,225,0,18,255,225,0,19,255,225,
+0,20,255,123,0,25,255,225,0,31,255,154,0,35,255,174,0,36,255,225,0,41,255,
+72,0,51,255,31,0,87,255,236,0,90,255,174,0,98,255,174,0,105,255,174,0,107,
+255,174,0,108,255,205,0,114,255,174,0,118,255,205,0,121,255,174,0,124,255,
+174,0,12,0,7,255,164,0,10,255,225,0,12,255,225,0,14,0,10,0,18,255,225,0,19,
+255,225,0,20,255,184,0,31,255,215,0,35,255,147,0,36,0,10,0,38,255,195,0,41,
+255,102,0,5,0,48,255,195,0,51,255,184,0,73,255,123,0,78,255,133,0,86,255,
+113,0,5,0,48,255,236,0,51,255,184,0,73,255,123,0,78,255,133,0,86,255,113,
+0,10,0,53,255,195,0,54,255,195,0,59,255,195,0,62,255,225,0,66,255,195,0,70,
+255,195,0,72,255,195,0,77,0,31,0,79,255,195,0,86,255,154,0,1,0,48,255,215,
+0,4,0,48,0,72,0,51,255,195,0,73,255,143,0,78,255,164,0,5,0,48,255,236,0,51,
+255,184,0,73,255,123,0,78,255,133,0,86,255,215,0,5,0,48,255,236,0,51,255,
+188,0,73,255,123,0,78,255,133,0,86,255,113,0,5,0,48,0,72,0,51,255,184,0,73,
+255,143,0,78,255,164,0,81,255,143,0,5,0,48,255,236,0,51,255,184,0,73,255,
+143,0,78,255,133,0,86,255,113,0,6,0,48,255,236,0,51,255,184,0,61,255,225,
+0,73,255,102,0,78,255,133,0,86,255,113,0,2,0,48,255,215,0,86,255,133,0,2,
+0,48,255,215,0,74,255,184,0,4,0,48,0,72,0,51,255,195,0,73,255,143,0,78,255,
+123,0,11,0,51,0,72,0,53,255,195,0,54,255,195,0,59,255,195,0,62,255,225,0,
+66,255,195,0,70,255,195,0,72,255,195,0,77,0,51,0,79,255,195,0,86,255,154,
+0,6,0,48,0,82,0,51,255,184,0,73,255,123,0,77,255,205,0,78,255,133,0,86,255,
+113,0,14,0,42,255,225,0,48,255,154,0,53,255,174,0,54,255,174,0,56,255,215,
+0,59,255,174,0,62,255,195,0,66,255,184,0,70,255,174,0,72,255,174,0,74,255,
+215,0,75,255,215,0,79,255,174,0,86,255,10,0,1,0,48,0,82,0,10,0,46,0,10,0,
+47,0,10,0,48,255,236,0,51,255,184,0,71,0,51,0,73,255,225,0,77,0,10,0,78,255,
+246,0,81,0,10,0,86,255,113,0,3,0,48,0,61,0,51,255,133,0,73,255,184,0,7,0,
+47,0,51,0,48,255,236,0,51,0,31,0,73,255,246,0,77,0,72,0,78,0,10,0,86,255,
+113,0,6,0,47,0,51,0,48,255,236,0,51,0,72,0,73,0,10,0,78,0,31,0,86,255,113,
+0,7,0,48,255,236,0,51,255,184,0,56,255,215,0,73,255,225,0,74,255,215,0,78,
+255,195,0,86,255,113,0,34,0,42,255,113,0,43,255,113,0,45,255,113,0,46,255,
+195,0,47,255,195,0,48,0,123,0,49,255,113,0,50,255,113,0,51,255,195,0,52,255,
+113,0,55,255,113,0,56,255,174,0,57,255,174,0,58,255,113,0,60,255,51,0,61,
+255,174,0,62,255,113,0,63,255,174,0,64,255,113,0,65,255,174,0,66,0,31,0,68,
+255,174,0,69,255,113,0,71,255,174,0,73,255,174,0,74,255,174,0,76,255,113,
+0,77,255,195,0,78,255,195,0,80,255,113,0,81,255,195,0,82,255,174,0,83,255,
+113,0,84,255,113,0,16,0,89,0,72,0,90,255,174,0,91,0,72,0,92,0,72,0,95,0,72,
+0,98,255,174,0,101,0,72,0,102,0,72,0,105,255,174,0,107,255,174,0,109,0,72,
+0,114,255,174,0,116,0,72,0,119,0,72,0,121,255,174,0,124,255,174,0,4,0,87,
+255,205,0,95,255,205,0,108,255,205,0,118,0,47,0,12,0,87,255,174,0,90,255,
+123,0,95,255,215,0,98,255,123,0,105,255,123,0,107,255,123,0,108,255,174,0,
+114,255,123,0,115,255,123,0,118,0,47,0,121,255,123,0,124,255,123,0,4,0,87,
+255,184,0,95,255,195,0,108,255,184,0,118,255,215,0,3,0,87,255,174,0,95,255,
+184,0,108,255,174,0,3,0,87,255,174,0,95,255,164,0,108,255,174,0,14,0,88,0,
+31,0,94,0,31,0,97,0,31,0,100,0,31,0,103,0,31,0,105,255,123,0,106,0,31,0,110,
+0,31,0,111,0,31,0,113,0,31,0,115,0,31,0,117,0,31,0,122,0,31,0,123,0,31,0,
+3,0,87,255,205,0,95,255,195,0,108,255,205,0,3,0,87,255,205,0,95,255,246,0,
+108,255,205,0,3,0,87,255,205,0,95,255,225,0,108,255,205,0,4,0,87,255,184,
+0,95,255,184,0,108,255,184,0,118,255,215,0,18,0,87,255,215,0,89,0,72,0,90,
+255,174,0,91,0,72,0,92,0,72,0,95,255,225,0,98,255,174,0,101,0,72,0,102,0,
+72,0,105,255,174,0,107,255,174,0,108,255,215,0,109,0,72,0,114,255,174,0,116,
+0,72,0,119,0,72,0,121,255,174,0,124,255,174,0,3,0,87,255,184,0,95,255,195,
+0,108,255,184,0,3,0,87,255,215,0,95,255,184,0,108,255,215,0,4,0,87,255,205,
+0,95,255,195,0,108,255,205,0,118,255,215,0,2,0,109,0,72,0,119,255,236,0,2,
+0,3,0,4,0,84,0,0,0,86,0,117,0,81,0,119,0,125,0,113,0,0,0,1,0,0,0,10,0,28,
+0,30,0,1,103,101,111,114,0,8,0,4,0,0,0,0,255,255,0,0,0,0,0,0,};
+#endif
@@ -0,0 +1,2812 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifGujarati_Regular_ttf_size = 70048;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifGujarati_Regular_ttf");
+asm(".type fz_font_NotoSerifGujarati_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifGujarati_Regular_ttf, 70048");
+asm(".balign 64");
+asm("fz_font_NotoSerifGujarati_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifGujarati-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifGujarati_Regular_ttf_size = 70048;
+const char fz_font_NotoSerifGujarati_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,9,80,9,117,0,0,213,52,0,0,0,92,71,
+80,79,83,131,141,136,155,0,0,213,144,0,0,11,64,71,83,85,66,90,217,143,99,
+0,0,224,208,0,0,48,206,79,83,47,50,122,189,101,127,0,0,1,104,0,0,0,96,99,
+109,97,112,127,118,103,102,0,0,9,56,0,0,1,152,103,97,115,112,0,8,0,27,0,0,
+213,40,0,0,0,12,103,108,121,102,42,3,14,15,0,0,14,140,0,0,175,22,104,101,
+97,100,11,81,196,94,0,0,0,236,0,0,0,54,104,104,101,97,13,35,254,89,0,0,1,
+36,0,0,0,36,104,109,116,120,21,151,241,72,0,0,1,200,0,0,7,112,108,111,99,
+97,186,181,143,230,0,0,10,208,0,0,3,186,109,97,120,112,1,244,1,56,0,0,1,72,
+0,0,0,32,110,97,109,101,142,105,186,134,0,0,189,164,0,0,6,16,112,111,115,
+116,3,225,146,245,0,0,195,180,0,0,17,114,0,1,0,0,0,1,5,31,86,84,21,146,95,
+15,60,245,0,11,8,0,0,0,0,0,211,81,85,136,0,0,0,0,211,117,34,95,251,85,251,
+11,10,23,7,79,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,181,250,146,0,0,9,193,251,
+85,248,41,10,23,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,220,0,1,0,0,1,220,0,192,
+0,16,0,118,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,4,68,1,144,0,5,0,0,
+5,51,4,204,0,0,0,153,5,51,4,204,0,0,2,204,0,50,2,215,0,0,2,2,5,2,4,5,4,2,
+2,4,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,181,250,
+146,0,0,7,181,5,110,0,0,0,1,0,0,0,0,4,189,4,189,0,0,0,32,0,4,4,205,0,193,
+0,0,0,0,2,100,0,0,2,100,0,0,6,113,0,72,8,116,0,72,4,183,0,108,4,190,0,108,
+4,181,0,95,6,139,0,95,6,217,0,20,7,81,0,20,5,147,0,80,5,207,0,80,6,113,0,
+72,6,113,0,72,8,116,0,72,8,116,0,72,6,113,0,72,8,116,0,72,2,3,0,175,2,3,0,
+175,2,3,254,114,0,0,252,207,0,0,254,3,0,0,254,113,0,0,254,113,0,0,252,107,
+0,0,252,107,0,0,252,222,0,0,252,42,2,3,254,242,2,3,254,61,0,0,253,24,2,4,
+255,28,3,240,0,113,6,17,255,218,4,224,0,32,4,178,0,104,4,25,0,71,4,237,0,
+71,5,105,0,110,5,154,0,45,5,140,0,65,5,113,0,32,3,217,0,128,3,232,0,108,3,
+214,0,73,4,4,0,110,6,112,0,175,4,88,0,114,4,157,0,69,3,98,0,117,4,143,0,117,
+4,57,0,55,4,86,255,218,3,227,0,133,5,158,0,87,5,249,0,90,4,163,0,36,4,140,
+0,69,3,115,0,78,5,26,0,95,4,109,0,87,5,173,0,90,4,126,255,218,5,79,0,61,4,
+125,0,110,5,166,0,95,5,157,0,91,5,223,0,118,0,0,254,147,0,0,253,131,1,251,
+0,138,0,0,254,132,0,0,253,137,3,186,0,73,4,36,0,95,3,76,0,40,3,173,0,98,3,
+124,0,12,3,232,255,244,4,61,255,214,3,151,0,113,4,87,0,45,3,148,0,105,4,55,
+0,105,7,42,0,105,3,103,0,153,6,252,0,130,3,120,2,18,5,57,2,18,1,229,0,160,
+3,127,0,160,5,25,0,160,5,55,0,70,5,55,0,70,5,55,0,70,3,206,0,131,4,97,0,116,
+2,191,254,181,2,167,254,198,4,121,0,121,0,0,0,0,0,0,255,213,0,0,255,33,4,
+193,0,98,0,0,254,76,0,0,252,91,3,165,0,113,4,67,255,218,3,18,0,32,2,238,0,
+104,3,23,0,71,5,54,0,45,3,165,0,32,4,160,0,175,2,140,0,114,2,239,0,69,2,210,
+0,117,2,89,0,55,2,158,255,218,3,159,0,133,3,207,0,87,4,60,0,90,2,199,0,36,
+2,172,0,69,3,78,0,95,2,161,0,87,3,155,0,90,2,218,255,218,3,121,0,61,3,127,
+0,140,3,198,0,95,3,97,0,91,3,218,0,118,3,240,0,113,6,17,255,218,4,224,0,32,
+4,178,0,104,4,237,0,71,6,38,0,45,5,140,0,64,5,113,0,32,6,112,0,175,4,141,
+0,20,4,157,0,69,3,165,0,96,4,143,0,117,4,57,0,55,4,86,255,218,3,227,0,95,
+5,158,0,87,5,249,0,90,4,163,0,36,4,140,0,69,5,26,0,95,4,109,0,87,5,40,0,69,
+4,126,255,218,5,179,0,61,4,91,0,140,5,166,0,95,6,81,0,91,6,29,0,118,3,165,
+0,113,4,67,255,218,3,18,0,32,2,238,0,104,3,23,0,71,5,172,0,45,3,165,0,32,
+4,160,0,175,2,113,0,20,2,239,0,69,2,210,0,117,2,89,0,55,2,158,255,218,3,159,
+0,95,3,207,0,87,4,60,0,90,2,199,0,36,2,172,0,69,3,78,0,95,2,161,0,87,3,92,
+0,69,2,218,255,218,3,121,0,61,3,198,0,95,4,153,0,91,4,77,0,118,7,3,0,117,
+8,1,0,113,4,107,0,150,4,131,0,112,4,119,0,167,4,97,0,122,8,51,0,73,9,193,
+0,110,5,51,0,110,6,162,0,48,6,162,0,48,4,26,0,142,4,27,0,152,8,20,0,128,4,
+50,0,175,4,42,0,152,8,26,0,36,3,230,0,105,3,235,0,110,8,11,0,71,4,96,0,162,
+8,96,0,128,4,238,0,7,3,30,0,7,3,165,0,42,5,17,0,95,3,148,0,117,5,51,0,120,
+3,165,0,96,3,241,0,157,5,8,0,127,5,44,0,65,4,143,0,117,3,226,0,157,8,63,0,
+133,6,138,0,69,4,53,255,218,4,122,255,218,8,77,0,61,5,118,0,140,5,26,0,140,
+5,236,0,140,5,236,0,140,5,118,0,140,5,46,0,140,7,237,0,95,3,240,0,113,6,17,
+255,218,4,224,0,32,4,178,0,104,4,25,0,71,4,237,0,71,5,105,0,110,5,154,0,45,
+5,140,0,65,5,113,0,32,3,217,0,128,3,232,0,108,3,214,0,73,4,4,0,110,6,112,
+0,175,4,88,0,114,4,157,0,69,3,98,0,117,4,143,0,117,4,57,0,55,4,86,255,218,
+3,227,0,133,5,158,0,87,5,249,0,90,4,163,0,36,4,140,0,69,3,115,0,78,5,26,0,
+95,4,109,0,87,5,173,0,90,4,126,255,218,5,79,0,61,4,125,0,110,5,166,0,95,3,
+165,0,113,4,67,255,218,3,18,0,32,2,238,0,104,3,23,0,71,5,54,0,45,3,165,0,
+32,4,160,0,175,2,140,0,114,2,239,0,69,2,210,0,117,2,89,0,55,2,158,255,218,
+3,159,0,133,3,207,0,87,4,60,0,90,2,199,0,36,2,172,0,69,3,78,0,95,2,161,0,
+87,3,155,0,90,2,218,255,218,3,121,0,61,3,127,0,140,3,198,0,95,3,240,0,113,
+6,17,255,218,4,224,0,32,4,178,0,104,4,237,0,71,6,38,0,45,5,140,0,64,5,113,
+0,32,6,112,0,175,4,141,0,20,4,157,0,69,3,165,0,96,4,143,0,117,4,57,0,55,4,
+86,255,218,3,227,0,95,5,158,0,87,5,249,0,90,4,163,0,36,4,140,0,69,5,26,0,
+95,4,109,0,87,5,40,0,69,4,126,255,218,5,179,0,61,4,91,0,140,5,166,0,95,3,
+165,0,113,4,67,255,218,3,18,0,32,2,238,0,104,3,23,0,71,5,193,0,45,3,165,0,
+32,4,160,0,175,2,113,0,20,2,239,0,69,2,210,0,117,2,89,0,55,2,158,255,218,
+3,159,0,95,3,207,0,87,4,60,0,90,2,199,0,36,2,172,0,69,3,78,0,95,2,161,0,87,
+3,92,0,69,2,218,255,218,3,121,0,61,3,198,0,95,0,0,254,76,2,3,254,114,2,3,
+254,114,2,3,254,114,0,0,252,222,0,0,252,222,0,0,252,222,0,0,252,42,0,0,252,
+42,0,0,252,42,0,0,253,24,0,0,251,240,0,0,251,240,7,13,0,45,7,153,0,45,7,13,
+0,45,7,153,0,45,7,21,0,45,7,184,0,45,7,21,0,45,7,184,0,45,4,253,0,78,3,149,
+0,130,3,189,0,120,4,26,0,140,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,
+0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,
+2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,
+0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,2,3,0,175,
+2,3,0,175,6,112,0,175,6,112,0,175,6,112,0,175,6,112,0,175,0,0,253,47,0,0,
+252,25,0,0,252,91,0,0,252,91,0,0,252,91,0,0,252,91,0,0,252,91,0,0,252,91,
+0,0,252,117,0,0,252,203,0,0,253,57,0,0,253,57,0,0,251,85,0,0,251,85,0,0,253,
+123,0,0,251,217,0,0,251,217,0,0,251,217,0,0,251,217,0,0,251,217,2,170,0,211,
+3,68,0,117,4,121,0,51,7,43,0,92,1,195,0,117,2,197,0,117,2,197,0,66,4,0,0,
+84,4,121,0,133,2,0,0,61,2,123,0,51,2,0,0,127,2,78,0,0,4,121,0,92,4,121,0,
+135,4,121,0,104,4,121,0,119,4,121,0,35,4,121,0,113,4,121,0,125,4,121,0,121,
+4,121,0,94,4,121,0,104,2,74,0,166,2,74,0,98,4,121,0,133,4,121,0,133,4,121,
+0,133,4,0,0,88,2,225,0,205,2,78,0,0,2,225,0,76,4,121,0,104,3,172,255,246,
+3,109,0,102,4,121,1,254,3,109,0,102,4,121,0,111,2,123,0,51,4,0,255,246,8,
+0,255,246,2,0,0,115,2,0,0,61,3,154,0,115,3,154,0,61,6,221,0,164,4,121,0,145,
+4,121,0,133,4,121,0,133,0,0,255,117,2,3,1,171,0,0,251,217,0,0,0,1,0,3,0,1,
+0,0,0,12,0,4,1,140,0,0,0,78,0,64,0,5,0,14,0,0,0,13,0,35,0,37,0,63,0,95,0,
+126,0,160,0,173,0,215,0,247,9,101,10,131,10,139,10,141,10,145,10,148,10,168,
+10,176,10,179,10,185,10,197,10,201,10,205,10,208,10,227,10,239,10,241,32,
+13,32,20,32,25,32,29,32,38,32,185,34,18,37,204,168,57,254,255,255,255,0,0,
+0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,173,0,215,0,247,9,100,10,129,10,
+133,10,140,10,143,10,147,10,149,10,170,10,178,10,181,10,188,10,199,10,203,
+10,208,10,224,10,230,10,240,32,11,32,19,32,24,32,28,32,38,32,185,34,18,37,
+204,168,48,254,255,255,255,0,1,255,245,0,0,1,134,1,133,1,106,1,79,255,99,
+1,33,0,255,0,224,246,246,0,0,245,127,0,0,0,0,245,125,245,142,245,141,0,0,
+245,138,0,0,0,0,0,0,245,135,0,0,245,103,245,104,224,92,225,188,225,185,225,
+183,225,175,223,173,223,198,218,158,88,44,1,104,0,1,0,0,0,0,0,74,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,64,0,66,0,0,0,0,0,0,0,64,0,0,0,64,
+0,82,0,86,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,1,168,1,169,1,170,0,72,0,71,0,73,0,12,0,18,0,14,0,15,0,19,0,62,0,68,0,75,
+0,76,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,33,0,29,0,30,0,34,0,31,0,32,0,74,
+0,11,0,13,0,27,0,28,0,0,0,21,0,21,0,21,0,21,0,121,0,133,0,215,1,46,1,125,
+1,226,2,69,2,176,3,15,3,125,3,137,3,149,3,165,3,181,3,193,3,209,3,237,3,245,
+4,40,4,81,4,123,4,156,4,207,5,37,5,137,5,165,5,215,5,227,5,239,6,9,6,21,6,
+84,6,168,6,229,7,46,7,58,7,134,7,221,8,50,8,121,8,193,9,2,9,70,9,131,9,206,
+10,47,10,94,10,174,10,231,11,44,11,91,11,152,11,231,12,51,12,123,12,184,12,
+252,13,52,13,117,13,176,14,4,14,75,14,165,14,248,15,70,15,188,16,44,16,61,
+16,97,16,123,16,149,16,166,16,223,17,14,17,74,17,130,17,191,18,0,18,61,18,
+137,18,201,18,241,19,30,19,172,19,212,19,224,19,240,19,252,20,9,20,21,20,
+37,20,52,20,64,20,80,20,123,20,167,20,205,21,5,21,59,21,59,21,72,21,102,22,
+108,22,141,22,160,22,222,23,32,23,71,23,126,23,186,24,18,24,73,24,148,24,
+176,24,239,25,33,25,63,25,107,25,185,25,244,26,43,26,87,26,136,26,182,26,
+223,27,29,27,84,27,153,27,211,28,13,28,113,28,209,29,19,29,110,29,178,29,
+253,30,75,30,171,30,247,31,69,31,168,31,221,32,48,32,120,32,190,32,243,33,
+51,33,133,33,215,34,37,34,105,34,176,34,246,35,50,35,126,35,199,36,36,36,
+111,36,196,37,66,37,186,37,251,38,70,38,118,38,173,38,238,39,75,39,139,39,
+220,39,251,40,60,40,110,40,150,40,196,41,22,41,90,41,153,41,206,42,2,42,55,
+42,96,42,153,42,211,43,31,43,99,43,209,44,59,44,167,45,29,45,146,46,0,46,
+131,46,240,47,113,48,3,48,129,48,225,49,71,49,177,50,36,50,157,51,3,51,123,
+51,251,52,97,52,209,53,76,53,203,54,80,54,133,54,167,55,8,55,125,55,199,56,
+57,56,147,56,249,57,102,57,201,58,30,58,126,59,5,59,97,59,183,60,28,60,143,
+60,247,61,85,61,180,62,23,62,127,62,227,63,76,63,88,63,100,63,112,63,124,
+63,140,63,152,63,164,63,176,63,188,63,200,63,212,63,224,63,236,63,248,64,
+4,64,16,64,28,64,40,64,52,64,64,64,76,64,88,64,100,64,112,64,124,64,136,64,
+148,64,160,64,172,64,184,64,196,64,208,64,220,64,232,64,244,65,0,65,12,65,
+24,65,36,65,48,65,60,65,72,65,84,65,96,65,108,65,120,65,132,65,144,65,156,
+65,168,65,180,65,192,65,204,65,216,65,228,65,240,65,252,66,8,66,20,66,32,
+66,44,66,56,66,68,66,80,66,92,66,104,66,116,66,128,66,140,66,152,66,164,66,
+176,66,188,66,200,66,212,66,224,66,236,66,248,67,4,67,16,67,28,67,40,67,52,
+67,64,67,76,67,88,67,100,67,112,67,124,67,136,67,148,67,160,67,172,67,184,
+67,196,67,208,67,220,67,232,67,244,68,0,68,12,68,24,68,36,68,48,68,60,68,
+72,68,84,68,96,68,108,68,120,68,131,68,143,68,212,68,223,68,235,69,24,69,
+36,69,48,69,115,69,127,69,139,69,187,69,199,70,49,70,163,70,175,70,187,71,
+44,71,163,71,175,71,187,72,16,72,97,72,184,73,17,73,62,73,107,73,154,73,202,
+73,250,74,44,74,94,74,106,74,118,74,130,74,142,74,154,74,166,74,178,74,239,
+75,47,75,113,75,180,75,248,76,60,76,129,76,141,76,153,76,165,76,177,76,189,
+76,201,76,213,77,50,77,149,77,161,77,173,77,213,78,9,78,68,78,111,78,174,
+79,18,79,138,79,174,79,186,79,198,79,210,80,17,80,29,80,145,80,156,80,167,
+80,178,80,189,80,200,80,211,80,234,80,255,81,55,81,134,81,147,81,180,81,213,
+81,253,82,21,82,51,82,64,82,80,82,94,82,140,82,178,82,229,83,34,83,81,83,
+135,83,191,83,215,84,34,84,97,84,123,84,164,84,184,84,204,84,225,85,18,85,
+43,85,56,85,81,85,101,85,114,85,166,85,179,85,231,86,18,86,26,86,39,86,52,
+86,83,86,114,86,169,86,224,87,7,87,41,87,77,87,90,87,106,87,123,87,139,0,
+0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,37,17,33,17,193,3,73,252,
+183,2,225,253,135,5,182,250,74,104,4,230,251,26,0,1,0,72,255,246,6,199,4,
+230,0,72,0,0,37,6,35,34,38,38,53,53,6,35,34,38,39,6,6,35,34,38,39,7,34,38,
+53,52,54,51,50,23,54,54,53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,7,22,51,
+50,54,55,38,53,52,54,51,50,22,21,7,22,51,50,55,17,23,17,20,51,50,54,55,6,
+199,75,75,65,145,66,35,49,43,85,59,27,180,145,146,199,65,43,71,90,64,56,64,
+61,91,121,82,83,74,101,91,97,103,69,135,120,53,166,125,95,149,127,132,5,80,
+53,45,63,77,1,55,50,102,53,165,19,37,87,33,52,62,98,92,76,236,13,28,34,152,
+164,155,114,3,78,60,45,64,70,34,156,80,61,76,43,164,37,80,134,105,61,108,
+191,40,173,171,135,82,84,54,61,123,126,41,15,57,2,62,69,251,219,20,47,39,
+255,255,0,72,255,246,8,202,4,230,0,38,0,4,0,0,0,7,0,20,6,113,0,0,0,1,0,108,
+255,240,4,97,5,222,0,56,0,0,1,20,6,35,34,38,38,53,52,55,38,38,53,52,54,51,
+50,23,23,38,35,34,6,21,20,22,23,54,51,23,6,6,21,20,22,51,50,54,54,53,52,38,
+39,38,38,53,52,55,23,6,6,21,20,22,23,22,22,4,97,236,208,124,221,134,128,99,
+119,187,151,66,52,25,60,43,103,112,74,61,114,129,64,166,186,140,110,93,176,
+113,55,54,51,49,165,125,83,60,44,44,50,52,1,170,207,235,132,188,96,138,92,
+62,171,90,129,155,11,174,10,84,76,65,117,44,53,165,7,126,108,91,112,87,173,
+123,91,173,124,119,152,78,160,102,148,53,103,67,65,141,112,126,174,0,0,1,
+0,108,255,240,5,42,6,14,0,61,0,0,1,7,38,35,34,6,21,20,22,23,22,22,21,20,6,
+35,34,38,38,53,52,55,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,22,23,54,
+51,23,6,6,21,20,22,51,50,54,54,53,52,38,39,38,38,53,52,54,51,50,5,42,78,56,
+81,82,103,46,46,53,54,236,208,124,221,134,128,99,119,187,151,66,52,25,60,
+43,103,112,74,61,114,129,64,166,186,140,110,93,176,113,55,54,51,49,148,111,
+172,5,109,54,65,121,98,69,152,120,136,186,92,207,235,132,188,96,138,92,62,
+171,90,129,155,11,174,10,84,76,65,117,44,53,165,7,126,108,91,112,87,173,123,
+95,179,126,123,158,80,125,161,0,0,1,0,95,255,248,4,175,6,5,0,50,0,0,19,20,
+18,22,51,50,54,53,52,39,6,7,39,54,54,53,52,38,35,34,6,7,39,54,51,50,22,22,
+21,20,7,22,21,20,6,6,35,32,0,17,16,0,33,50,22,23,7,38,35,32,0,250,106,210,
+149,110,140,114,80,134,77,237,169,78,80,47,116,35,80,97,112,92,148,114,160,
+195,64,145,114,254,249,254,65,1,79,1,29,136,248,100,57,135,190,254,237,254,
+220,2,252,159,254,222,183,116,86,145,101,32,30,168,61,109,74,60,69,32,17,
+169,42,91,201,86,136,89,153,181,70,133,89,1,236,1,97,1,68,1,124,100,96,65,
+107,254,191,0,0,1,0,95,255,246,6,225,6,5,0,67,0,0,37,6,35,34,38,38,53,17,
+52,38,38,35,32,0,17,20,18,22,51,50,54,53,52,39,6,7,39,54,54,53,52,38,35,34,
+6,7,39,54,51,50,22,22,21,20,7,22,21,20,6,6,35,32,0,17,16,0,33,50,4,22,22,
+21,17,20,51,50,54,55,6,225,75,75,65,145,66,127,236,155,254,237,254,220,106,
+210,149,110,140,114,80,134,77,237,169,78,80,47,116,35,80,97,112,92,148,114,
+160,195,64,145,114,254,249,254,65,1,79,1,29,150,1,26,226,127,19,37,87,33,
+52,62,98,92,76,2,130,125,225,139,254,191,254,210,159,254,222,183,116,86,145,
+101,32,30,168,61,109,74,60,69,32,17,169,42,91,201,86,136,89,153,181,70,133,
+89,1,236,1,97,1,68,1,124,125,226,236,125,253,63,20,47,39,0,0,1,0,20,255,246,
+6,202,4,230,0,66,0,0,1,20,6,7,39,23,50,54,54,53,52,38,39,6,35,34,39,17,20,
+51,50,54,55,23,6,35,34,38,38,53,17,1,39,1,38,38,35,34,7,39,54,54,51,50,22,
+23,55,17,23,17,22,51,50,54,55,38,53,52,54,51,50,22,21,20,7,22,22,6,202,101,
+111,107,1,5,80,69,46,43,118,160,109,108,19,37,87,33,85,75,75,65,145,66,253,
+204,100,2,50,90,150,85,140,173,65,73,176,85,132,215,102,22,165,48,57,78,146,
+52,35,76,62,58,83,64,107,80,1,180,80,138,43,139,1,43,81,60,48,82,48,90,42,
+254,9,20,47,39,138,62,98,92,76,1,62,254,189,152,1,35,123,96,79,169,37,40,
+158,187,11,1,252,69,254,45,13,53,52,55,58,62,81,95,59,91,81,107,135,0,0,1,
+0,20,255,246,7,205,4,230,0,73,0,0,37,6,35,34,38,38,53,52,54,55,38,39,6,35,
+34,39,17,20,51,50,54,55,23,6,35,34,38,38,53,17,1,39,1,38,38,35,34,7,39,54,
+54,51,50,22,23,55,17,23,17,22,51,50,54,55,38,53,52,54,51,50,22,21,20,7,22,
+23,6,6,21,20,22,51,50,55,7,205,111,127,84,156,121,88,82,57,49,112,143,109,
+108,19,37,87,33,85,75,75,65,145,66,253,204,100,2,50,90,150,85,140,173,65,
+73,176,85,132,215,102,22,165,48,57,77,143,51,30,76,62,58,83,74,69,187,112,
+152,74,68,109,102,111,79,75,159,73,66,108,28,55,62,73,42,254,9,20,47,39,138,
+62,98,92,76,1,62,254,189,152,1,35,123,96,79,169,37,40,158,187,11,1,252,69,
+254,45,13,51,50,67,50,62,81,95,59,99,86,93,212,2,85,66,43,54,69,0,0,1,0,80,
+255,161,6,10,4,230,0,66,0,0,37,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,
+35,34,6,21,20,23,39,38,53,52,55,38,35,34,6,21,20,22,23,7,38,2,53,52,54,51,
+50,22,23,54,54,51,51,17,23,17,22,22,21,20,6,7,6,6,21,20,22,51,50,54,55,6,
+10,58,126,84,81,151,101,62,60,52,49,97,74,105,120,4,164,8,23,85,97,90,118,
+168,125,54,179,217,171,139,70,148,58,42,130,77,5,165,86,143,48,73,49,48,52,
+51,47,122,64,22,58,59,87,136,61,63,110,75,65,81,43,71,87,156,138,52,33,46,
+52,63,81,64,59,121,93,116,198,72,77,104,1,33,135,133,158,67,56,60,64,1,85,
+69,254,200,42,188,100,48,103,89,61,79,40,37,54,61,64,0,0,1,0,80,255,36,6,
+187,4,230,0,78,0,0,5,6,35,34,38,38,53,52,55,38,38,53,52,54,55,54,54,53,52,
+38,35,34,6,21,23,39,38,53,52,55,38,35,34,6,21,20,22,23,7,38,2,53,52,54,51,
+50,22,23,54,54,51,51,17,23,17,22,22,21,20,6,7,6,6,21,20,22,51,50,55,23,7,
+6,6,21,20,51,50,54,55,6,187,144,184,74,130,108,29,69,88,54,51,43,41,80,67,
+105,120,3,164,7,23,85,97,90,118,168,125,54,179,217,171,139,70,148,58,42,130,
+77,5,165,92,116,52,50,43,42,41,48,72,118,95,42,99,119,109,73,155,60,117,103,
+68,130,69,45,34,33,117,63,53,80,48,42,57,34,58,73,156,138,73,46,49,54,81,
+64,59,121,93,116,198,72,77,104,1,33,135,133,158,67,56,60,64,1,85,69,254,200,
+47,167,94,47,71,45,40,55,33,25,38,33,139,10,22,49,42,60,45,41,255,255,0,72,
+255,246,6,199,7,44,2,38,0,4,0,0,0,7,0,29,6,112,0,0,255,255,0,72,255,246,6,
+199,7,40,2,38,0,4,0,0,0,7,0,30,6,134,0,0,255,255,0,72,255,246,8,202,7,44,
+0,38,0,4,0,0,0,39,0,20,6,113,0,0,0,7,0,29,8,133,0,0,255,255,0,72,255,246,
+8,202,7,40,0,38,0,4,0,0,0,39,0,30,8,132,0,0,0,7,0,20,6,113,0,0,255,255,0,
+72,255,246,6,199,6,122,2,38,0,4,0,0,0,7,0,33,6,113,0,0,255,255,0,72,255,246,
+8,202,6,122,0,38,0,4,0,0,0,39,0,20,6,113,0,0,0,7,0,33,8,116,0,0,0,1,0,175,
+255,246,2,89,4,230,0,14,0,0,19,17,23,17,20,51,50,54,55,23,6,35,34,38,38,175,
+165,19,37,87,33,85,75,75,65,145,66,1,0,3,230,69,251,219,20,47,39,138,62,98,
+92,0,255,255,0,175,255,246,5,193,7,40,2,6,1,118,0,0,0,1,254,114,255,246,2,
+90,7,40,0,32,0,0,19,17,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,0,
+21,17,20,51,50,54,55,23,6,35,34,38,38,176,135,114,75,91,30,25,58,64,92,134,
+112,170,1,67,19,37,87,33,85,75,75,65,145,66,1,0,3,243,188,225,101,81,48,94,
+32,19,44,149,90,110,134,254,134,223,251,173,20,47,39,138,62,98,92,0,0,1,252,
+207,253,164,0,73,255,205,0,25,0,0,5,55,22,22,51,50,54,53,52,38,35,34,6,7,
+39,54,51,50,22,22,21,20,6,35,34,36,252,207,104,80,208,138,99,137,78,53,40,
+82,28,103,101,97,80,128,102,153,118,149,254,174,240,87,137,179,93,65,56,56,
+35,25,147,61,80,167,65,104,137,199,0,1,254,3,253,145,1,164,255,205,0,25,0,
+0,1,52,54,51,50,22,22,23,23,7,38,38,35,34,6,21,20,22,51,50,55,23,6,35,34,
+38,254,3,169,130,92,163,147,124,104,108,142,224,119,84,107,80,57,86,79,62,
+80,95,111,223,254,215,107,139,91,147,142,119,67,215,199,91,71,55,72,61,151,
+41,217,0,0,1,254,113,253,119,1,18,255,203,0,18,0,0,1,52,54,55,23,14,2,21,
+20,22,51,50,55,23,6,35,34,38,254,113,166,136,97,52,123,89,88,81,133,125,111,
+135,150,147,241,254,212,104,138,5,141,1,35,79,61,62,77,89,130,99,231,0,0,
+1,254,113,252,215,1,113,255,203,0,32,0,0,1,6,35,34,38,38,53,52,55,38,38,53,
+52,54,55,23,6,6,21,20,51,50,55,23,7,6,6,21,20,51,50,54,55,1,113,144,184,74,
+130,108,29,69,88,165,137,95,104,156,101,70,122,95,42,99,119,109,73,155,60,
+253,62,103,68,130,69,45,34,33,117,63,84,108,5,139,2,69,52,63,33,139,10,22,
+49,42,60,45,41,0,0,1,252,107,253,0,0,236,255,205,0,60,0,0,19,6,6,35,34,38,
+38,53,52,54,55,54,54,55,52,38,35,34,6,21,23,39,38,53,52,55,38,35,34,6,21,
+20,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,22,21,20,6,7,6,6,21,20,
+51,50,54,55,236,40,107,51,73,105,92,29,29,26,28,3,61,47,72,91,2,136,3,16,
+61,65,63,83,169,46,114,145,126,97,56,110,44,31,100,61,86,139,84,37,35,25,
+22,66,43,104,29,253,82,42,40,66,107,63,39,59,40,35,53,33,43,58,106,87,62,
+39,17,35,60,53,35,80,67,129,145,61,74,221,106,97,121,60,54,52,55,92,119,77,
+44,70,45,33,37,19,54,44,30,0,1,252,107,252,136,1,111,255,205,0,71,0,0,1,6,
+35,34,38,53,52,55,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,23,39,38,53,
+52,55,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,22,
+21,20,6,7,6,21,20,22,51,50,55,23,6,6,21,20,51,50,54,55,1,111,113,138,90,151,
+23,48,73,25,25,24,24,56,44,72,91,2,136,3,16,61,65,63,83,169,46,114,145,126,
+97,56,110,44,31,100,61,81,131,89,32,29,41,32,27,55,88,71,97,89,71,54,120,
+47,252,215,79,135,70,32,28,21,96,48,29,47,30,32,42,25,34,47,106,87,62,39,
+17,35,60,53,35,80,67,129,145,61,74,221,106,97,121,60,54,52,55,80,113,75,33,
+54,32,43,26,20,22,23,107,22,39,33,45,35,30,0,0,1,252,222,5,33,255,62,7,44,
+0,13,0,0,1,34,7,39,54,51,50,22,23,19,35,39,38,38,253,178,67,72,73,82,81,98,
+142,59,146,87,135,36,80,6,135,23,160,28,108,120,254,217,241,64,53,0,0,2,252,
+42,5,4,255,67,7,40,0,14,0,29,0,0,1,34,7,39,54,51,50,22,23,22,23,35,46,2,7,
+34,7,39,54,51,50,22,22,23,23,7,39,38,38,253,208,44,61,48,59,62,96,137,50,
+25,95,78,62,73,90,233,81,67,109,103,86,61,110,97,84,80,42,49,110,114,6,137,
+16,158,17,96,112,56,255,150,139,71,222,42,133,60,48,76,74,71,49,36,80,51,
+255,255,254,242,255,246,2,89,7,44,2,38,0,20,0,0,0,7,0,29,2,20,0,0,255,255,
+254,61,255,246,2,89,7,40,2,38,0,20,0,0,0,7,0,30,2,19,0,0,0,1,253,24,5,77,
+0,31,6,122,0,12,0,0,1,55,22,22,51,50,54,55,23,6,6,35,34,253,24,47,112,176,
+80,81,119,69,91,47,149,86,230,6,69,53,93,74,36,47,131,37,49,0,255,255,255,
+28,255,246,2,90,6,122,0,38,0,20,1,0,0,7,0,33,2,4,0,0,0,1,0,113,255,244,3,
+205,4,210,0,39,0,0,1,20,6,35,34,38,39,55,22,51,50,54,53,52,38,39,5,39,37,
+38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,37,23,5,22,22,3,133,186,160,
+127,223,88,50,158,155,116,123,86,67,254,148,89,1,56,84,111,205,171,72,54,
+37,64,51,120,140,127,1,108,88,254,208,94,138,1,8,128,148,102,78,75,131,105,
+87,67,125,43,96,147,73,47,149,91,130,154,10,158,10,90,90,109,100,96,147,71,
+39,151,0,0,1,255,218,255,246,6,103,4,230,0,59,0,0,37,6,35,34,38,38,53,53,
+6,35,34,39,6,6,35,34,46,2,53,17,6,7,39,54,51,50,30,2,21,17,20,22,22,51,50,
+54,55,38,53,52,54,51,50,22,21,7,22,51,50,55,17,23,17,20,51,50,54,55,6,103,
+75,75,65,145,66,35,54,105,122,32,167,106,86,117,132,38,83,98,76,61,78,67,
+86,102,30,17,53,59,92,131,10,75,53,43,66,79,2,64,80,105,52,165,19,37,87,33,
+52,62,98,92,76,237,16,80,108,129,67,146,109,109,1,88,8,37,156,28,54,113,70,
+63,255,0,96,89,36,121,98,77,71,45,59,136,108,43,18,58,2,61,69,251,219,20,
+47,39,0,2,0,32,255,246,5,54,4,230,0,14,0,39,0,0,1,17,23,17,20,51,50,54,55,
+23,6,35,34,38,38,1,55,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,30,2,21,
+20,6,35,34,3,140,165,19,37,87,33,85,75,75,65,145,66,252,148,74,51,107,71,
+109,129,94,88,83,82,105,78,105,83,137,151,56,188,149,220,1,0,3,230,69,251,
+219,20,47,39,138,62,98,92,1,211,52,79,75,163,133,128,111,51,162,43,69,173,
+138,103,156,198,0,1,0,104,255,246,5,8,4,230,0,51,0,0,37,6,35,34,38,38,53,
+53,6,35,34,38,39,38,53,52,55,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,
+54,51,23,34,6,21,20,22,51,50,54,55,17,23,17,20,51,50,54,55,5,8,75,75,65,145,
+66,137,160,83,116,63,128,112,183,172,146,58,70,26,62,58,87,105,104,100,113,
+70,147,181,78,91,95,215,60,165,19,37,87,33,52,62,98,92,76,59,101,54,52,106,
+128,112,75,111,151,110,132,17,162,17,71,72,89,70,37,152,93,85,65,70,89,63,
+2,237,69,251,219,20,47,39,255,255,0,71,255,245,4,25,4,210,0,38,0,47,254,0,
+0,7,0,75,5,183,4,38,0,1,0,71,255,246,5,67,4,230,0,53,0,0,37,6,35,34,38,38,
+53,53,6,35,34,38,39,6,35,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,7,39,
+54,51,50,30,2,21,20,6,7,22,51,50,55,17,23,17,20,51,50,54,55,5,67,75,75,65,
+145,66,100,136,142,194,63,27,27,71,90,64,56,64,61,91,121,82,83,74,101,91,
+97,103,69,135,120,53,166,125,90,140,172,136,165,19,37,87,33,52,62,98,92,76,
+69,64,137,99,6,78,60,45,64,70,34,156,80,61,76,43,164,37,80,134,105,61,108,
+191,40,123,140,2,211,69,251,219,20,47,39,0,0,2,0,110,255,247,5,30,4,221,0,
+47,0,58,0,0,1,20,2,4,35,34,38,38,53,52,55,38,53,52,54,51,50,23,23,38,35,34,
+6,21,20,22,23,54,55,23,6,6,21,20,22,51,50,36,55,38,2,53,52,54,51,50,22,18,
+7,54,53,52,38,35,34,6,21,20,22,5,30,160,254,241,159,153,218,158,128,209,161,
+128,60,47,23,37,37,79,104,64,62,84,99,74,163,146,135,110,169,1,17,68,181,
+235,123,94,97,180,131,181,23,94,77,57,79,145,2,130,176,254,213,176,113,198,
+100,149,87,144,197,118,148,11,159,8,77,83,69,116,57,35,11,154,30,120,90,91,
+113,186,163,88,1,7,183,98,130,162,254,246,250,87,94,157,189,77,78,104,192,
+0,0,3,0,45,255,246,5,173,4,227,0,31,0,44,0,56,0,0,1,22,21,20,6,35,34,38,38,
+53,52,54,54,55,38,39,22,21,20,6,35,34,38,53,52,54,51,50,4,23,1,23,5,34,6,
+21,20,22,51,50,54,53,52,39,38,1,52,39,14,2,21,20,22,51,50,54,4,58,173,160,
+133,104,164,97,48,90,171,128,156,40,149,132,135,201,192,159,144,1,29,154,
+1,96,122,252,16,117,148,82,63,92,116,21,32,2,98,89,105,103,54,91,74,81,105,
+2,247,239,203,149,178,106,154,83,74,121,112,172,153,75,77,89,128,148,197,
+132,137,167,166,178,1,108,118,48,123,96,64,86,136,108,57,61,7,253,67,139,
+155,107,117,110,62,77,91,150,0,1,0,65,255,241,5,82,4,230,0,47,0,0,1,20,6,
+7,39,54,54,53,52,38,35,34,6,7,21,20,6,35,34,3,55,22,22,51,50,54,53,52,38,
+35,34,7,39,54,51,50,22,22,23,54,51,50,23,17,23,17,22,22,5,82,201,161,91,143,
+164,118,94,62,136,53,183,142,216,147,74,53,106,71,107,125,110,93,83,82,105,
+78,105,94,147,149,27,91,92,35,28,165,92,131,1,129,142,205,53,152,52,172,115,
+91,117,52,45,18,153,200,1,10,52,85,85,190,167,135,161,51,162,43,85,203,95,
+54,4,1,160,69,254,98,67,195,0,1,0,32,255,246,5,199,4,230,0,49,0,0,37,6,35,
+34,38,38,53,17,6,35,34,39,6,6,35,34,39,55,22,22,51,50,54,53,52,38,35,34,7,
+39,54,51,50,30,2,21,22,51,50,54,55,17,23,17,20,51,50,54,55,5,199,75,75,65,
+145,66,50,77,113,91,26,178,124,220,142,74,51,107,71,109,129,94,88,83,82,105,
+78,105,83,137,152,55,46,48,77,121,30,165,19,37,87,33,52,62,98,92,76,1,113,
+23,62,123,144,250,52,79,75,163,133,128,111,51,162,43,69,174,136,103,13,44,
+34,1,181,69,251,219,20,47,39,0,0,1,0,128,255,252,3,201,4,200,0,43,0,0,19,
+52,54,54,55,62,2,53,52,38,35,34,6,7,39,54,54,51,50,30,2,21,20,6,6,7,14,2,
+21,20,22,51,50,54,55,23,6,35,34,38,38,128,103,145,118,93,109,72,91,66,65,
+187,85,73,67,179,85,73,144,114,48,93,134,111,98,117,78,101,79,100,215,96,
+98,190,206,118,174,153,1,107,91,129,82,51,40,57,79,51,67,68,51,39,154,32,
+50,66,129,96,52,89,120,74,46,41,62,95,66,70,87,79,75,146,143,86,181,0,0,2,
+0,108,255,249,3,202,4,210,0,33,0,45,0,0,1,20,6,6,35,34,38,38,53,52,54,51,
+23,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,22,22,23,23,22,22,7,52,38,
+35,34,6,21,20,22,51,50,54,3,202,83,164,116,138,220,141,191,141,43,100,118,
+203,174,72,54,37,64,51,122,139,52,84,79,91,114,121,170,140,104,118,157,141,
+106,120,152,1,56,86,146,87,121,185,102,126,170,2,49,139,86,124,141,10,158,
+10,76,76,46,70,54,42,50,66,186,35,102,137,151,116,99,141,149,0,0,1,0,73,255,
+245,3,188,4,210,0,40,0,0,19,55,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,
+51,50,23,23,38,35,34,6,21,20,22,22,23,30,2,21,20,6,6,35,34,36,73,69,102,215,
+99,103,127,66,97,82,90,109,75,205,171,72,54,37,64,51,120,140,59,89,77,96,
+119,83,95,155,88,159,254,233,1,60,56,117,114,101,88,67,100,69,47,52,80,121,
+84,130,154,10,158,10,90,90,55,84,60,42,52,85,136,97,95,134,67,193,0,0,2,0,
+110,255,248,3,255,4,205,0,38,0,50,0,0,1,20,6,35,34,36,38,53,52,54,54,55,54,
+54,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,23,38,38,53,52,54,51,50,22,7,
+52,38,35,34,6,21,20,23,62,2,3,255,199,155,148,254,250,149,106,146,113,126,
+75,59,70,143,71,106,89,100,118,83,136,113,31,30,140,109,124,199,148,54,45,
+81,98,4,84,125,65,1,7,118,153,160,216,119,111,155,92,54,59,71,38,53,52,57,
+112,115,65,94,63,41,47,72,117,83,109,157,22,44,91,62,109,139,209,15,40,52,
+136,114,36,32,4,70,101,0,3,0,175,254,108,6,198,4,230,0,24,0,39,0,64,0,0,1,
+54,53,52,38,39,39,46,2,53,17,23,17,20,22,22,23,4,30,2,21,20,7,19,17,23,17,
+20,51,50,54,55,23,6,35,34,38,38,1,55,22,22,51,50,54,53,52,38,35,34,7,39,54,
+51,50,30,2,21,20,6,35,34,3,162,70,128,172,116,175,155,79,165,62,120,135,1,
+22,123,83,33,106,240,165,19,37,87,33,85,75,75,65,145,66,252,224,74,36,75,
+51,100,119,98,84,59,69,95,55,81,86,141,149,51,178,140,179,254,214,41,67,61,
+99,71,48,71,82,120,102,3,22,69,252,245,59,76,60,54,112,63,80,82,47,112,65,
+2,148,3,230,69,251,219,20,47,39,138,62,98,92,1,154,52,42,39,154,126,105,120,
+37,164,22,76,172,123,93,149,189,0,0,1,0,114,255,246,4,174,4,230,0,29,0,0,
+37,6,35,34,38,38,53,17,35,34,6,21,20,23,7,38,2,53,52,54,51,33,17,23,17,20,
+51,50,54,55,4,174,75,75,65,145,66,197,136,146,244,72,159,192,213,178,1,11,
+165,19,37,87,33,52,62,98,92,76,1,208,120,115,203,222,67,132,1,21,155,151,
+181,1,109,69,251,219,20,47,39,0,0,2,0,69,255,246,4,243,4,230,0,44,0,54,0,
+0,37,6,35,34,38,38,53,53,6,35,34,36,39,54,55,38,38,53,52,54,51,50,22,22,21,
+20,6,7,6,6,21,20,22,51,50,54,55,17,23,17,20,51,50,54,55,1,54,53,52,38,35,
+34,6,21,20,4,243,75,75,65,145,66,102,120,190,254,245,93,142,88,84,106,122,
+98,74,134,97,102,98,87,47,118,82,96,178,67,165,19,37,87,33,252,208,127,55,
+44,50,65,52,62,98,92,76,83,70,189,157,55,56,52,144,84,106,117,96,143,87,82,
+158,63,55,34,16,34,58,65,67,2,207,69,251,219,20,47,39,2,71,102,114,43,65,
+72,59,112,0,1,0,117,255,249,3,173,4,201,0,37,0,0,37,6,35,34,38,38,53,52,55,
+38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,22,23,54,55,23,6,4,21,20,22,51,
+50,54,55,3,173,134,183,125,187,165,147,77,100,200,171,96,90,37,97,82,117,
+143,50,58,128,170,76,180,254,225,125,112,91,148,71,98,105,95,207,109,147,
+87,51,157,90,133,156,17,166,18,100,84,61,92,46,47,7,157,10,111,125,83,97,
+43,47,0,1,0,117,255,246,4,229,5,82,0,46,0,0,37,6,35,34,38,38,53,53,6,35,34,
+46,2,53,52,55,38,53,52,54,55,23,6,6,21,20,23,54,55,23,4,21,20,22,51,50,54,
+55,17,23,17,20,51,50,54,55,4,229,75,75,65,145,66,119,147,73,112,129,70,115,
+175,116,109,109,88,86,89,83,105,60,254,209,95,81,93,193,54,165,19,37,87,33,
+52,62,98,92,76,63,92,46,106,117,75,138,82,113,148,97,149,64,141,55,107,70,
+92,65,36,13,154,46,181,58,76,91,68,2,217,69,251,219,20,47,39,0,0,1,0,55,255,
+246,4,143,4,230,0,31,0,0,37,6,35,34,38,38,53,17,35,34,6,6,21,21,20,35,34,
+38,38,53,52,51,50,23,17,23,17,20,51,50,54,55,4,143,75,75,65,145,66,221,63,
+58,18,82,50,115,79,193,244,249,165,19,37,87,33,52,62,98,92,76,1,148,12,25,
+24,71,99,80,125,64,120,63,1,243,69,251,219,20,47,39,0,1,255,218,255,246,4,
+172,4,230,0,41,0,0,37,6,35,34,38,38,53,53,6,6,35,34,46,2,53,17,6,7,39,54,
+51,50,30,2,21,21,20,22,22,51,50,55,17,23,17,20,51,50,54,55,4,172,75,75,65,
+145,66,36,102,53,81,113,129,37,83,98,76,61,78,67,86,102,30,16,53,59,151,105,
+165,19,37,87,33,52,62,98,92,76,174,29,33,69,146,110,105,1,41,8,37,156,28,
+54,113,70,63,209,95,88,36,111,2,125,69,251,219,20,47,39,0,1,0,133,254,204,
+3,187,4,210,0,52,0,0,5,50,55,7,34,38,39,38,38,53,52,54,51,50,22,23,54,54,
+53,52,38,39,5,39,37,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,37,23,
+5,22,22,21,20,6,35,35,22,22,3,81,46,38,64,151,247,63,105,138,62,42,74,97,
+28,113,122,89,69,254,189,89,1,13,83,107,205,171,72,54,37,64,51,120,140,123,
+1,112,88,254,201,96,143,186,160,21,58,158,131,5,182,166,143,22,102,69,47,
+54,116,69,1,107,86,69,126,43,85,147,62,48,146,90,130,154,10,158,10,90,90,
+108,98,97,147,73,38,152,113,128,148,67,52,0,1,0,87,255,246,5,244,4,230,0,
+52,0,0,37,6,35,34,38,38,53,53,6,35,34,39,6,6,35,34,38,38,53,52,18,55,23,6,
+6,21,20,22,51,50,54,55,38,53,52,54,51,50,22,21,7,22,51,50,55,17,23,17,20,
+51,50,54,55,5,244,75,75,65,145,66,30,44,105,122,30,159,102,113,194,112,188,
+159,128,148,162,96,80,87,124,10,76,53,43,66,79,2,64,80,90,52,165,19,37,87,
+33,52,62,98,92,76,231,10,80,107,129,141,195,106,156,1,5,68,133,60,229,149,
+100,121,122,97,77,72,45,59,136,108,43,18,43,2,76,69,251,219,20,47,39,0,0,
+1,0,90,255,246,6,79,4,230,0,48,0,0,37,6,35,34,38,38,53,17,33,21,20,6,35,34,
+38,53,52,54,55,17,34,6,21,16,5,7,38,2,53,52,0,51,50,30,3,21,21,22,23,17,23,
+17,20,51,50,54,55,6,79,75,75,65,145,66,254,174,35,42,78,160,66,85,206,245,
+1,26,57,167,204,1,2,196,49,73,71,88,26,195,143,165,19,37,87,33,52,62,98,92,
+76,1,61,102,53,46,172,82,52,61,7,1,86,239,203,255,0,215,67,110,1,85,174,213,
+1,24,16,41,86,71,115,156,22,43,2,66,69,251,219,20,47,39,0,1,0,36,255,246,
+4,249,4,230,0,40,0,0,37,6,35,34,38,38,53,53,33,21,20,6,35,34,38,53,52,54,
+55,17,6,7,39,54,51,50,30,2,21,17,22,23,17,23,17,20,51,50,54,55,4,249,75,75,
+65,145,66,254,143,35,42,78,160,66,85,91,111,76,71,89,67,90,97,28,205,164,
+165,19,37,87,33,52,62,98,92,76,235,102,53,46,172,82,52,61,7,1,175,9,46,156,
+38,57,111,69,63,254,237,18,47,2,148,69,251,219,20,47,39,0,0,1,0,69,255,246,
+4,226,4,230,0,46,0,0,37,6,35,34,38,38,53,53,6,35,34,38,39,36,53,52,38,35,
+34,7,39,54,51,50,30,2,21,20,6,7,6,21,20,22,51,50,54,55,17,23,17,20,51,50,
+54,55,4,226,75,75,65,145,66,100,120,171,242,87,1,59,59,53,70,83,85,85,75,
+67,89,113,55,87,141,22,123,84,94,162,58,165,19,37,87,33,52,62,98,92,76,130,
+59,205,161,141,155,41,50,33,158,26,49,113,106,53,76,124,98,15,20,44,72,65,
+52,2,164,69,251,219,20,47,39,0,0,1,0,78,255,238,3,123,4,199,0,36,0,0,1,7,
+34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,
+6,7,22,22,51,55,7,34,38,38,1,50,38,82,108,71,51,36,74,27,141,168,112,93,106,
+110,91,103,109,113,181,144,205,168,55,211,185,29,65,129,200,132,1,135,2,84,
+65,51,57,42,32,43,170,98,80,98,43,172,33,111,193,106,128,220,52,114,133,2,
+186,124,175,0,2,0,95,255,246,5,112,4,230,0,18,0,40,0,0,37,6,35,34,38,38,53,
+17,5,39,37,17,23,17,20,51,50,54,55,37,23,6,6,35,34,38,38,53,52,54,54,55,23,
+6,6,21,20,22,22,51,50,5,112,75,75,65,145,66,254,85,59,1,230,165,19,37,87,
+33,253,191,88,38,104,42,162,236,141,137,214,116,77,189,217,70,132,87,109,
+52,62,98,92,76,1,171,125,154,139,1,147,69,251,219,20,47,39,167,162,22,24,
+162,243,157,135,217,137,24,162,48,240,163,83,147,90,0,0,1,0,87,255,246,4,
+195,4,230,0,40,0,0,37,6,35,34,38,38,53,53,6,6,35,34,46,2,53,52,54,51,50,23,
+23,38,35,34,6,6,21,20,22,51,50,55,17,23,17,20,51,50,54,55,4,195,75,75,65,
+145,66,48,142,81,80,134,138,83,242,187,35,40,51,42,56,95,140,72,131,107,180,
+138,165,19,37,87,33,52,62,98,92,76,168,42,49,70,126,153,89,155,196,8,160,
+7,75,122,67,98,121,172,2,92,69,251,219,20,47,39,0,3,0,90,255,246,6,3,4,230,
+0,14,0,45,0,55,0,0,37,6,35,34,38,38,53,17,23,17,20,51,50,54,55,5,50,55,7,
+34,38,39,38,38,53,52,54,51,50,23,54,55,36,53,52,54,51,50,18,21,20,6,6,7,22,
+22,3,54,53,52,38,35,34,6,21,20,6,3,75,75,65,145,66,165,19,37,87,33,253,99,
+58,59,64,198,249,73,101,127,61,52,90,67,115,89,254,247,124,96,122,246,107,
+215,154,62,197,25,96,84,65,60,79,52,62,98,92,76,3,230,69,251,219,20,47,39,
+17,8,187,210,180,2,90,73,43,61,94,25,51,147,217,97,124,254,246,143,87,170,
+130,27,119,105,2,8,87,117,76,100,80,60,140,0,0,2,255,218,255,246,4,212,4,
+230,0,33,0,45,0,0,37,6,35,34,38,38,53,53,6,6,35,34,46,2,53,17,6,7,39,54,51,
+50,22,4,23,17,23,17,20,51,50,54,55,1,38,36,39,22,21,21,20,22,22,51,50,4,212,
+75,75,65,145,66,43,123,65,81,113,129,37,83,98,76,64,88,76,126,1,37,201,165,
+19,37,87,33,254,171,87,254,231,70,14,16,53,59,177,52,62,98,92,76,203,42,49,
+69,146,110,105,1,41,8,37,156,29,70,223,171,1,227,69,251,219,20,47,39,1,210,
+78,229,53,45,87,159,95,88,36,0,0,1,0,61,255,238,5,165,4,230,0,62,0,0,37,6,
+35,34,38,38,53,17,6,35,34,39,6,6,7,22,22,51,55,7,34,38,39,7,34,38,53,52,54,
+51,50,22,23,54,54,53,52,38,35,34,7,39,54,51,50,22,22,21,20,7,22,51,50,54,
+55,17,23,17,20,51,50,54,55,5,165,75,75,65,145,66,56,80,125,103,47,140,80,
+51,190,170,31,65,162,237,82,33,82,108,71,51,36,74,27,122,144,112,93,87,93,
+91,83,93,113,181,144,28,41,45,84,128,25,165,19,37,87,33,52,62,98,92,76,1,
+50,27,79,63,95,26,123,141,1,185,244,182,1,86,65,51,57,42,32,40,159,92,80,
+98,39,172,29,111,193,106,68,62,11,52,38,1,236,69,251,219,20,47,39,0,0,2,0,
+110,255,246,4,135,4,208,0,34,0,54,0,0,1,55,22,22,51,50,54,53,52,38,39,46,
+2,53,52,54,55,23,6,6,21,20,22,22,23,30,2,21,20,6,35,34,38,37,52,55,23,6,6,
+21,20,22,22,51,50,54,55,23,6,35,34,36,2,1,167,63,70,127,70,48,67,61,98,62,
+74,52,182,124,68,108,108,37,57,50,69,85,61,121,99,115,210,254,129,78,150,
+33,31,137,246,156,66,145,52,83,77,147,214,254,98,197,2,78,52,72,72,50,49,
+40,72,58,37,55,76,49,107,116,25,141,27,63,56,28,47,37,27,39,60,92,62,83,106,
+134,174,158,115,94,60,116,81,122,207,122,24,24,159,42,235,1,36,0,0,1,0,95,
+255,246,5,252,4,198,0,55,0,0,1,17,52,38,35,34,6,21,20,23,22,21,20,6,35,34,
+46,2,53,52,54,55,23,6,6,21,20,22,51,50,54,53,52,39,38,53,52,54,51,50,22,22,
+21,17,20,51,50,54,55,23,6,35,34,38,38,4,82,100,80,74,77,7,8,153,108,83,147,
+143,61,132,119,79,95,96,111,95,84,99,9,4,124,105,100,210,122,19,37,87,33,
+85,75,75,65,145,66,1,0,2,74,103,133,88,68,57,105,110,72,112,151,62,156,164,
+94,141,220,67,165,64,163,114,121,141,111,90,55,138,50,83,111,133,151,194,
+127,253,142,20,47,39,138,62,98,92,0,2,0,91,254,233,5,243,4,230,0,73,0,84,
+0,0,37,6,35,34,38,38,53,17,6,35,34,39,7,14,2,21,20,22,51,50,55,38,53,52,54,
+51,50,22,21,20,7,22,22,23,7,38,38,39,6,35,34,46,2,53,52,54,54,55,38,38,53,
+52,54,51,50,22,21,20,7,22,51,50,54,55,17,23,17,20,51,50,54,55,1,54,54,53,
+52,38,35,34,6,21,20,5,243,75,75,65,145,66,128,154,150,132,28,82,100,67,107,
+83,81,48,8,71,54,61,83,94,35,131,66,142,47,97,37,46,42,90,164,157,61,75,113,
+86,95,81,140,103,133,217,127,40,31,100,206,65,165,19,37,87,33,252,35,90,96,
+73,62,61,85,52,62,98,92,76,1,72,39,59,17,48,71,90,54,74,93,26,29,21,53,72,
+92,66,97,56,47,111,38,130,50,160,86,8,70,147,106,67,68,111,85,51,76,138,89,
+94,126,224,118,114,97,5,59,41,1,219,69,251,219,20,47,39,2,62,55,97,60,56,
+79,93,65,115,0,1,0,118,255,61,6,15,4,230,0,80,0,0,37,6,35,34,38,38,53,17,
+6,35,34,38,39,38,38,35,34,6,21,20,23,54,51,50,22,22,21,20,6,6,35,34,39,22,
+23,7,38,38,39,38,38,53,52,54,51,50,23,22,51,50,54,54,53,52,38,35,34,7,38,
+38,53,52,54,51,50,22,23,22,22,51,50,54,55,53,23,17,20,51,50,54,55,6,15,75,
+75,65,145,66,48,58,49,97,96,72,105,64,91,83,47,105,96,78,155,89,113,183,101,
+36,50,88,152,149,53,105,34,101,129,62,37,95,67,59,49,101,144,74,74,59,81,
+108,113,163,140,107,60,97,69,74,108,69,80,92,21,165,19,37,87,33,52,62,98,
+92,76,2,140,29,30,55,43,42,99,70,71,69,47,118,170,82,83,125,68,5,122,100,
+119,69,193,97,25,100,76,46,49,139,9,63,92,43,56,63,64,79,206,117,99,129,37,
+38,40,41,55,33,127,69,251,219,20,47,39,0,0,1,254,147,5,193,255,108,6,169,
+0,7,0,0,1,52,51,50,21,20,35,34,254,147,109,108,108,109,6,53,116,116,116,0,
+0,2,253,131,5,121,0,150,7,79,0,7,0,20,0,0,1,52,51,50,21,20,35,34,37,55,22,
+22,51,50,19,23,6,6,35,34,38,254,140,109,108,108,109,254,247,80,41,144,114,
+212,47,149,32,202,153,137,226,6,219,116,116,116,115,26,118,127,1,12,39,181,
+182,198,0,2,0,138,0,201,1,113,4,71,0,7,0,15,0,0,19,52,51,50,21,20,35,34,17,
+52,51,50,21,20,35,34,138,116,115,115,116,116,115,115,116,3,202,125,125,124,
+253,247,125,125,124,0,0,1,254,132,253,246,0,243,255,166,0,13,0,0,7,34,7,39,
+54,51,50,22,22,23,7,46,2,218,63,51,48,75,46,87,126,152,137,65,143,109,94,
+238,16,149,15,60,162,177,33,162,84,38,0,1,253,137,254,129,254,98,255,105,
+0,7,0,0,1,52,51,50,21,20,35,34,253,137,109,108,108,109,254,245,116,116,116,
+0,0,1,0,73,255,245,3,146,4,189,0,37,0,0,19,55,22,22,51,50,54,53,52,38,38,
+39,46,2,53,52,54,51,33,23,33,34,6,21,20,22,22,23,30,2,21,20,6,35,34,36,73,
+69,95,216,95,88,109,63,92,80,88,104,73,161,129,1,7,71,254,255,93,113,58,87,
+75,93,115,80,175,144,152,254,244,1,60,56,116,115,91,78,63,103,79,57,63,91,
+126,80,104,137,164,82,75,49,84,68,49,60,94,131,83,129,156,193,0,2,0,95,0,
+169,3,197,4,17,0,14,0,28,0,0,19,52,54,54,51,50,22,22,21,20,6,6,35,34,0,37,
+52,38,35,34,6,6,21,20,22,51,50,54,54,95,96,185,126,106,208,149,96,185,126,
+169,254,218,2,209,133,99,86,156,97,133,99,86,156,97,2,128,108,183,110,126,
+218,125,109,184,110,1,23,217,98,136,90,165,108,98,136,90,165,0,0,2,0,40,255,
+246,3,162,4,194,0,28,0,40,0,0,37,6,35,34,38,38,53,17,52,55,6,35,34,38,38,
+53,52,54,51,50,22,22,21,17,20,51,50,54,55,1,53,52,38,35,34,6,21,20,22,51,
+50,3,162,75,75,65,145,66,5,52,56,100,175,86,144,116,98,152,119,19,37,87,33,
+254,171,57,67,80,127,78,59,116,52,62,98,92,76,1,22,53,52,35,126,148,67,123,
+150,124,196,82,253,76,20,47,39,2,156,92,41,74,111,74,61,63,0,1,0,98,255,247,
+3,85,4,196,0,36,0,0,19,52,54,51,50,23,62,2,53,52,38,35,34,7,39,54,51,50,22,
+22,23,20,6,7,22,22,51,50,55,7,35,34,38,39,38,38,98,60,49,93,49,111,159,80,
+140,114,66,76,51,54,54,126,199,132,2,244,188,66,205,125,39,31,79,20,155,252,
+51,99,99,2,84,43,64,110,3,76,114,62,86,108,18,188,8,119,216,123,147,197,4,
+118,121,4,188,233,189,19,101,0,0,1,0,12,255,248,3,34,4,198,0,39,0,0,1,20,
+6,6,35,34,38,39,55,22,22,51,50,54,53,52,39,6,7,39,54,54,53,52,38,35,34,6,
+7,39,54,51,50,22,22,21,20,7,22,22,3,34,66,150,117,116,222,119,70,77,158,92,
+106,132,103,71,124,80,188,180,86,68,66,127,77,77,122,142,84,161,119,141,80,
+99,1,28,70,133,89,134,142,57,88,95,114,94,132,96,28,30,164,42,127,77,63,73,
+37,35,164,64,91,193,92,144,85,63,171,0,0,2,255,244,255,249,3,206,4,221,0,
+28,0,40,0,0,1,22,22,21,20,6,35,34,38,38,53,52,54,54,55,55,38,35,34,7,39,54,
+51,50,22,22,23,1,23,1,6,6,21,20,22,51,50,54,53,52,38,2,140,100,121,167,124,
+92,175,110,68,99,82,28,160,130,53,59,92,62,70,74,130,122,98,1,48,126,254,
+118,150,89,97,77,84,109,57,2,240,130,238,114,120,157,118,160,93,70,140,123,
+89,31,216,31,181,35,78,131,122,1,102,130,254,68,169,149,73,71,89,119,94,77,
+149,0,0,1,255,214,255,246,4,137,4,230,0,41,0,0,37,6,35,34,38,38,53,53,6,6,
+35,34,46,2,53,17,34,7,39,54,51,50,30,2,21,21,20,22,22,51,50,55,17,23,17,20,
+51,50,54,55,4,137,75,75,65,145,66,36,102,53,81,113,129,37,93,66,67,53,55,
+67,86,102,30,16,53,59,151,105,165,19,37,87,33,52,62,98,92,76,174,29,33,69,
+146,110,105,1,31,17,141,15,54,113,70,63,199,95,88,36,111,2,125,69,251,219,
+20,47,39,0,0,1,0,113,254,198,3,90,4,229,0,50,0,0,5,20,7,39,54,54,53,52,38,
+38,39,46,2,53,52,55,38,53,52,54,54,55,54,54,55,23,6,6,7,14,2,21,20,23,54,
+51,51,23,14,2,21,20,22,22,23,30,2,3,90,114,142,28,50,54,82,71,100,127,91,
+95,137,97,136,107,95,98,19,94,29,111,101,87,100,70,72,164,251,34,42,100,204,
+200,63,94,81,97,119,84,132,105,77,112,18,63,34,37,55,39,26,37,67,116,87,111,
+70,135,125,85,116,70,41,37,51,35,155,44,59,40,34,51,75,51,73,66,71,163,3,
+21,82,81,44,66,47,31,38,63,99,0,0,2,0,45,255,252,3,233,4,193,0,30,0,42,0,
+0,1,20,6,6,35,34,36,39,55,22,22,51,50,54,54,53,53,6,6,35,34,38,38,53,52,54,
+51,50,30,2,39,38,38,35,34,6,21,20,22,51,50,54,3,233,93,208,162,133,254,254,
+102,69,73,178,116,130,171,80,48,140,80,104,185,142,185,141,100,184,161,67,
+175,34,130,92,110,159,123,101,100,155,1,250,121,233,156,147,160,54,98,97,
+123,194,106,16,63,70,105,207,127,134,176,113,215,229,177,107,122,142,97,109,
+107,128,0,1,0,105,255,247,3,127,4,165,0,20,0,0,19,52,0,37,23,4,0,6,21,20,
+22,51,50,54,55,23,6,6,35,34,0,105,1,46,1,130,102,254,221,254,224,73,117,95,
+82,128,85,121,96,149,90,161,254,242,1,161,159,1,119,238,138,180,254,231,172,
+71,95,118,69,78,120,100,70,1,16,0,0,2,0,105,255,246,3,246,4,178,0,20,0,24,
+0,0,19,52,54,54,55,23,6,6,21,20,22,22,51,50,55,23,6,35,34,36,2,37,37,23,5,
+105,119,189,106,74,171,184,100,182,119,132,148,95,107,154,186,254,234,184,
+1,102,1,198,71,254,64,2,124,149,235,150,32,149,80,252,186,103,183,111,75,
+161,62,170,1,39,131,226,148,230,0,3,0,105,0,1,6,233,6,194,0,7,0,20,0,99,0,
+0,1,52,51,50,21,20,35,34,37,55,22,22,51,50,19,23,6,6,35,34,38,1,20,6,6,35,
+34,38,39,55,30,2,51,50,54,53,52,38,35,34,6,7,14,2,35,34,39,22,22,21,20,6,
+35,34,0,3,55,18,33,50,54,53,52,38,39,6,7,39,54,54,53,52,35,34,6,7,39,54,51,
+50,22,22,21,20,7,22,51,50,54,54,55,62,2,51,50,22,22,4,14,109,108,108,109,
+254,247,80,41,144,114,212,47,149,32,202,153,137,226,3,191,68,144,108,92,188,
+69,66,40,59,76,48,107,130,77,76,37,68,55,45,75,117,79,52,43,46,48,175,144,
+194,254,223,89,84,174,1,3,110,127,65,57,58,96,90,160,188,154,62,139,59,81,
+147,136,93,159,79,147,39,34,68,98,65,42,40,61,90,61,91,169,98,6,78,116,116,
+116,115,26,118,127,1,12,39,181,182,198,252,182,95,179,117,128,97,52,46,57,
+35,178,143,118,155,62,98,79,102,72,16,57,135,62,137,169,1,79,1,8,32,254,38,
+120,104,70,131,47,30,35,154,45,153,88,125,45,34,158,75,123,148,77,160,101,
+13,60,86,72,69,81,56,138,198,0,2,0,153,1,103,2,206,3,157,0,12,0,24,0,0,19,
+52,54,51,50,22,21,20,6,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,153,
+152,112,111,190,64,121,80,108,192,1,183,56,43,77,136,56,48,76,132,2,153,110,
+150,192,113,66,121,74,182,162,42,58,136,84,47,59,144,0,255,255,0,130,254,
+201,6,99,4,198,0,38,1,113,0,0,0,7,0,88,3,149,0,0,0,1,2,18,255,246,2,161,4,
+250,0,5,0,0,1,17,35,39,17,51,2,161,19,124,19,4,157,251,89,93,4,167,255,255,
+2,18,255,246,4,98,4,250,0,34,0,90,0,0,0,3,0,90,1,193,0,0,0,1,0,160,255,218,
+1,69,4,230,0,3,0,0,55,17,23,17,160,165,31,4,199,69,251,57,255,255,0,160,255,
+218,2,223,4,230,0,34,0,92,0,0,0,3,0,92,1,154,0,0,255,255,0,160,255,218,4,
+121,4,230,0,34,0,92,0,0,0,35,0,92,1,154,0,0,0,3,0,92,3,52,0,0,0,1,0,70,3,
+53,4,241,4,214,0,3,0,0,19,39,1,23,177,107,4,64,107,3,53,146,1,15,146,0,255,
+255,0,70,1,154,4,241,4,214,2,34,0,95,0,0,0,3,0,95,0,0,254,101,255,255,0,70,
+0,0,4,241,4,214,2,34,0,95,0,0,0,35,0,95,0,0,254,101,0,3,0,95,0,0,252,203,
+0,2,0,131,1,10,3,78,3,214,0,14,0,26,0,0,19,52,54,54,51,50,22,22,21,20,6,6,
+35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,131,79,152,104,85,173,122,79,
+152,104,138,242,2,35,88,66,94,131,86,68,94,131,2,141,88,151,90,105,181,100,
+88,151,91,231,167,65,91,140,103,67,89,140,0,0,2,0,116,0,140,4,27,4,230,0,
+13,0,25,0,0,1,20,6,35,34,38,53,52,55,1,23,1,22,22,7,52,38,35,34,6,21,20,22,
+51,50,54,3,19,182,135,119,235,166,2,133,124,254,7,101,140,165,81,59,88,127,
+78,62,88,127,1,192,129,179,209,142,154,124,1,229,117,254,132,26,172,49,60,
+83,130,92,62,80,128,0,1,254,181,254,120,1,255,4,168,0,19,0,0,7,50,18,17,16,
+3,23,22,18,21,16,0,33,34,38,39,39,55,22,22,72,201,210,136,189,57,62,254,213,
+254,241,45,109,36,82,7,45,149,227,1,16,1,5,1,136,1,238,57,190,254,46,190,
+254,187,254,156,21,15,162,7,16,24,0,1,254,198,254,19,2,157,4,212,0,35,0,0,
+3,50,54,53,52,38,38,39,38,38,53,52,54,37,23,6,6,21,20,22,23,30,2,21,20,6,
+6,35,34,38,39,39,55,22,22,36,196,229,42,59,49,60,58,224,1,14,54,208,195,49,
+78,52,63,44,161,248,130,62,133,43,89,12,52,155,254,186,189,190,85,154,125,
+87,105,141,75,154,207,50,155,49,134,105,66,146,138,94,131,165,92,151,205,
+98,19,17,159,13,16,25,0,1,0,121,0,0,4,61,5,182,0,34,0,0,19,53,51,50,54,55,
+33,53,33,38,38,35,35,53,33,21,33,22,23,51,21,35,2,5,19,22,22,51,51,21,35,
+34,38,38,39,121,170,182,153,11,253,252,2,4,9,146,160,201,3,196,254,160,113,
+12,227,229,32,254,65,235,51,101,63,27,49,133,137,85,47,2,178,58,124,146,96,
+135,117,96,96,88,164,96,254,162,17,254,111,85,79,86,27,75,82,0,0,1,255,213,
+254,240,0,43,5,6,0,3,0,0,3,51,17,35,43,86,86,5,6,249,234,0,0,1,255,33,254,
+240,0,223,5,133,0,14,0,0,3,7,39,55,39,55,23,55,23,7,23,7,39,17,35,43,127,
+53,168,168,53,170,170,53,168,168,53,127,86,4,72,127,55,168,166,55,170,170,
+55,166,168,55,127,250,168,0,0,16,0,98,0,86,4,94,4,82,0,11,0,23,0,35,0,47,
+0,59,0,71,0,83,0,95,0,107,0,119,0,131,0,143,0,155,0,167,0,179,0,191,0,0,1,
+52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,37,52,54,
+51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,
+22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,
+20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,
+35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,
+38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,
+52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,7,52,54,
+51,50,22,21,20,6,35,34,38,2,43,32,21,22,32,32,22,21,32,172,32,21,22,31,31,
+22,21,32,1,88,32,21,22,32,32,22,21,32,254,16,32,22,21,32,32,21,22,32,2,136,
+31,22,22,31,31,22,22,31,253,24,32,21,22,32,32,22,21,32,3,72,31,22,22,31,31,
+22,22,31,252,147,32,22,21,32,32,21,22,32,3,146,31,22,22,31,31,22,22,31,252,
+147,32,21,22,32,32,22,21,32,3,72,31,22,22,31,31,22,22,31,253,24,32,22,21,
+32,32,21,22,32,2,136,31,22,22,31,31,22,22,31,254,16,32,21,22,31,31,22,21,
+32,1,88,32,21,22,32,32,22,21,32,172,32,21,22,32,32,22,21,32,4,29,21,32,32,
+21,22,32,32,15,21,32,32,21,22,31,31,22,21,32,32,21,22,31,31,74,21,32,32,21,
+22,32,32,22,21,32,32,21,22,32,32,130,22,31,31,22,22,31,31,22,22,31,31,22,
+22,31,31,150,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,150,22,31,31,22,
+22,31,31,22,22,31,31,22,22,31,31,130,22,32,32,22,21,32,32,21,22,32,32,22,
+21,32,32,75,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,15,22,32,32,22,21,
+32,32,0,0,1,254,76,5,20,0,59,7,44,0,18,0,0,1,52,54,51,50,22,23,23,38,35,34,
+6,21,20,22,23,35,38,38,254,76,163,137,44,85,20,46,70,83,90,108,62,55,103,
+63,95,6,50,114,136,17,8,156,27,84,84,58,98,58,49,158,0,0,1,252,91,254,107,
+255,118,255,208,0,5,0,0,3,37,5,39,37,1,197,254,211,254,187,110,1,126,1,157,
+254,116,201,210,130,227,254,236,0,1,0,113,255,244,4,137,4,210,0,39,0,0,1,
+20,6,35,34,38,39,55,22,51,50,54,53,52,38,39,5,39,37,38,38,53,52,54,51,50,
+23,23,38,35,34,6,21,20,23,33,23,33,22,22,3,133,186,160,127,223,88,50,158,
+155,116,123,97,74,254,166,89,1,38,78,99,205,171,72,54,37,64,51,120,140,99,
+2,97,59,254,17,95,140,1,8,128,148,102,78,75,131,105,87,72,132,42,100,147,
+77,49,141,86,130,154,10,158,10,90,90,97,89,144,38,153,0,0,1,255,218,1,64,
+5,52,4,210,0,44,0,0,1,34,39,6,6,35,34,46,2,53,17,6,7,39,54,51,50,30,2,21,
+17,20,22,22,51,50,54,55,38,53,52,54,51,50,22,21,7,22,51,50,55,23,6,4,100,
+105,122,32,167,106,86,117,132,38,83,98,76,61,78,67,86,102,30,17,53,59,92,
+131,10,75,53,43,66,79,2,64,80,161,77,38,73,1,221,80,108,129,67,146,109,109,
+1,88,8,37,156,28,54,113,70,63,255,0,96,89,36,121,98,77,71,45,59,136,108,43,
+18,71,164,53,0,1,0,32,1,141,2,219,4,210,0,24,0,0,19,55,22,22,51,50,54,53,
+52,38,35,34,7,39,54,51,50,30,2,21,20,6,35,34,32,74,51,107,71,109,129,94,88,
+83,82,105,78,105,83,137,151,56,188,149,220,2,135,52,79,75,163,133,128,111,
+51,162,43,69,173,138,103,156,198,0,0,1,0,104,0,214,4,32,4,221,0,36,0,0,1,
+6,6,35,34,38,39,38,53,52,55,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,54,
+51,23,34,6,21,20,22,51,50,55,4,32,106,250,135,83,116,63,128,112,183,172,146,
+58,70,26,62,58,87,105,104,100,113,70,147,181,78,91,244,231,1,164,98,108,54,
+52,106,128,112,75,111,151,110,132,17,162,17,71,72,89,70,37,152,93,85,65,70,
+190,0,0,1,0,71,1,5,4,49,4,209,0,40,0,0,1,6,35,34,38,53,52,54,51,50,23,54,
+54,53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,7,22,51,50,54,55,23,6,6,35,34,
+38,1,30,27,27,71,90,64,56,64,61,91,121,82,83,74,101,91,97,103,69,135,120,
+53,166,125,90,140,129,196,66,69,78,177,133,142,194,1,241,6,78,60,45,64,70,
+34,156,80,61,76,43,164,37,80,134,105,61,108,191,40,123,116,80,164,76,86,137,
+0,3,0,45,255,246,5,252,4,207,0,35,0,48,0,59,0,0,1,34,7,22,21,20,6,35,34,38,
+38,53,52,54,55,38,38,39,22,21,20,6,35,34,38,53,52,54,51,50,4,23,54,51,51,
+23,1,34,6,21,20,22,51,50,54,53,52,39,38,1,6,6,21,20,22,51,50,54,53,52,5,146,
+164,146,139,159,135,105,171,87,177,147,55,161,85,41,149,132,132,204,192,159,
+154,1,47,166,185,179,87,62,251,193,117,148,82,63,92,116,21,32,2,17,124,142,
+82,77,83,105,2,253,55,208,185,149,178,114,150,91,131,233,83,74,136,39,76,
+91,128,148,202,127,137,167,189,202,77,152,1,64,123,96,64,86,136,108,57,61,
+7,254,88,70,195,93,87,102,150,120,131,0,0,1,0,32,1,141,4,159,4,210,0,35,0,
+0,1,34,39,6,6,35,34,39,55,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,30,
+2,21,22,51,50,54,55,23,6,6,3,175,125,96,27,176,125,220,142,74,51,107,71,109,
+129,94,88,83,82,105,78,105,83,137,152,55,50,58,91,120,61,72,48,112,2,90,62,
+124,143,250,52,79,75,163,133,128,111,51,162,43,69,173,136,103,14,45,43,156,
+32,37,0,0,2,0,175,254,108,4,150,4,230,0,24,0,49,0,0,1,54,53,52,38,39,39,46,
+2,53,17,23,17,20,22,22,23,4,30,2,21,20,7,1,55,22,22,51,50,54,53,52,38,35,
+34,7,39,54,51,50,30,2,21,20,6,35,34,3,162,70,128,172,116,175,155,79,165,62,
+120,135,1,22,123,83,33,106,253,208,74,36,75,51,100,119,98,84,59,69,95,55,
+81,86,141,149,51,178,140,179,254,214,41,67,61,99,71,48,71,82,120,102,3,22,
+69,252,245,59,76,60,54,112,63,80,82,47,112,65,3,226,52,42,39,154,126,105,
+120,37,164,22,76,172,123,93,149,189,0,1,0,114,255,249,3,127,3,121,0,14,0,
+0,19,52,54,51,33,21,33,34,6,21,20,23,7,38,2,114,213,178,1,134,254,192,136,
+146,244,72,159,192,2,45,151,181,169,120,115,203,222,67,132,1,21,0,0,2,0,69,
+1,13,4,33,4,205,0,30,0,40,0,0,1,6,6,35,34,36,39,54,55,38,38,53,52,54,51,50,
+22,22,21,20,6,7,6,6,21,20,22,51,50,54,55,37,54,53,52,38,35,34,6,21,20,4,33,
+86,224,128,190,254,245,93,142,88,84,106,122,98,74,134,97,102,98,87,47,118,
+82,135,240,77,253,182,127,55,44,50,65,1,186,78,95,189,157,55,56,52,144,84,
+106,117,96,143,87,82,158,63,55,34,16,34,58,84,87,199,102,114,43,65,72,59,
+112,0,0,1,0,117,0,227,4,27,5,82,0,31,0,0,1,6,6,35,34,46,2,53,52,55,38,53,
+52,54,55,23,6,6,21,20,23,54,55,23,4,21,20,22,51,50,55,4,27,104,252,134,73,
+112,129,70,115,175,116,109,109,88,86,89,83,105,60,254,209,95,81,249,226,1,
+177,97,109,46,106,117,75,138,82,113,148,97,149,64,141,55,107,70,92,65,36,
+13,154,46,181,58,76,190,0,1,0,55,1,173,3,68,3,50,0,17,0,0,19,52,51,50,4,23,
+21,33,34,6,6,21,21,20,35,34,38,38,55,193,161,1,70,101,254,196,63,58,18,82,
+50,115,79,2,186,120,47,25,86,12,25,24,71,99,80,125,0,1,255,218,1,112,3,140,
+4,210,0,27,0,0,19,17,6,7,39,54,51,50,30,2,21,21,20,22,22,51,50,54,55,23,6,
+6,35,34,46,2,219,83,98,76,61,78,67,86,102,30,16,53,59,87,166,60,81,65,175,
+89,81,113,129,37,3,30,1,41,8,37,156,28,54,113,70,63,209,95,88,36,73,63,129,
+64,81,69,146,110,0,1,0,133,254,204,4,131,4,210,0,52,0,0,5,50,55,7,34,38,39,
+38,38,53,52,54,51,50,22,23,54,54,53,52,38,39,5,39,37,38,38,53,52,54,51,50,
+23,23,38,35,34,6,21,20,23,33,23,33,22,22,21,20,6,35,35,22,22,3,81,46,38,64,
+151,247,63,105,138,62,42,74,97,28,113,122,97,73,254,201,89,1,1,79,99,205,
+171,72,54,37,64,51,120,140,101,2,78,88,254,2,96,142,186,160,21,58,158,131,
+5,182,166,143,22,102,69,47,54,116,69,1,107,86,72,131,42,82,147,59,48,142,
+87,130,154,10,158,10,90,90,100,87,142,39,151,113,128,148,67,52,0,1,0,87,1,
+65,4,218,4,224,0,38,0,0,1,34,39,6,6,35,34,38,38,53,52,18,55,23,6,6,21,20,
+22,51,50,54,55,38,53,52,54,51,50,22,21,7,22,51,50,54,55,23,6,4,15,121,121,
+30,159,102,113,194,112,188,159,128,148,162,96,80,87,124,10,76,53,43,66,79,
+2,72,80,79,119,31,49,73,1,226,75,107,129,141,195,106,156,1,5,68,133,60,229,
+149,100,121,122,97,77,72,45,59,136,108,43,18,43,30,143,71,0,1,0,90,0,108,
+5,37,4,202,0,34,0,0,1,21,33,21,20,6,35,34,38,53,52,54,55,17,34,6,21,16,5,
+7,38,2,53,52,0,51,50,30,3,21,21,22,4,5,37,254,46,35,42,78,160,66,85,206,245,
+1,26,57,167,204,1,2,196,49,73,71,88,26,111,1,3,2,143,82,102,53,46,172,82,
+52,61,7,1,86,239,203,255,0,215,67,110,1,85,174,213,1,24,16,41,86,71,115,156,
+11,46,0,0,1,0,36,1,34,3,176,4,210,0,26,0,0,1,21,33,21,20,6,35,34,38,53,52,
+54,55,17,6,7,39,54,51,50,30,2,21,17,22,4,3,176,254,46,35,42,78,160,66,85,
+91,111,76,71,89,67,90,97,28,111,1,3,2,61,82,102,53,46,172,82,52,61,7,1,175,
+9,46,156,38,57,111,69,63,254,237,11,46,0,0,1,0,69,1,71,3,216,4,207,0,31,0,
+0,19,36,53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,7,6,21,20,22,51,50,55,23,
+6,6,35,34,38,104,1,59,59,53,70,83,85,85,75,67,89,113,55,87,141,22,123,84,
+235,152,87,74,196,110,171,242,2,181,141,155,41,50,33,158,26,49,113,106,53,
+76,124,98,15,20,44,72,133,141,56,70,205,0,0,2,0,95,0,149,4,44,4,200,0,21,
+0,25,0,0,19,52,54,54,55,23,6,6,21,20,22,22,51,50,55,23,6,6,35,34,38,38,37,
+37,23,5,95,137,214,116,77,189,217,70,132,87,109,99,88,38,104,42,162,236,141,
+1,129,2,26,50,253,239,2,199,135,217,137,24,162,48,240,163,83,147,90,66,162,
+22,24,162,243,158,154,153,155,0,0,1,0,87,1,77,3,156,4,98,0,25,0,0,19,52,54,
+51,50,23,23,38,35,34,6,6,21,20,22,51,50,55,23,6,6,35,34,46,2,87,242,187,35,
+40,51,42,56,95,140,72,131,107,208,155,86,66,211,125,80,134,138,83,3,3,155,
+196,8,160,7,75,122,67,98,121,157,137,76,89,70,126,153,0,0,2,0,90,255,250,
+3,134,4,196,0,30,0,40,0,0,37,7,34,38,39,38,38,53,52,54,51,50,23,54,55,36,
+53,52,54,51,50,18,21,20,6,6,7,22,22,51,50,3,54,53,52,38,35,34,6,21,20,3,134,
+64,198,249,73,101,127,61,52,90,67,115,89,254,247,124,96,122,246,107,215,154,
+62,197,115,58,198,96,84,65,60,79,181,187,210,180,2,90,73,43,61,94,25,51,147,
+217,97,124,254,246,143,87,170,130,27,119,105,2,8,87,117,76,100,80,60,140,
+0,2,255,218,1,112,3,211,4,211,0,20,0,32,0,0,1,6,6,35,34,46,2,53,17,6,7,39,
+54,51,50,22,22,0,23,55,7,38,36,39,22,21,21,20,22,22,51,50,3,211,77,213,110,
+81,113,129,37,83,98,76,64,88,58,89,207,1,33,109,29,86,83,254,227,68,13,16,
+53,59,159,2,70,92,122,69,146,110,105,1,41,8,37,156,29,34,156,254,252,107,
+36,93,82,255,57,45,86,159,95,88,36,0,0,1,0,61,255,238,4,110,4,199,0,46,0,
+0,1,22,22,51,55,7,34,38,39,7,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,
+34,7,39,54,51,50,22,22,21,20,7,22,51,50,55,23,6,35,34,39,6,6,1,132,51,190,
+170,31,65,162,237,82,33,82,108,71,51,36,74,27,122,144,112,93,87,93,91,83,
+93,113,181,144,28,45,64,172,102,55,86,142,141,109,46,141,1,174,123,141,1,
+185,244,182,1,86,65,51,57,42,32,40,159,92,80,98,39,172,29,111,193,106,67,
+62,12,89,159,66,80,63,97,0,1,0,140,255,47,4,57,4,198,0,38,0,0,1,7,38,35,34,
+6,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,54,51,50,23,23,38,35,34,6,
+21,20,23,54,51,50,22,4,57,41,176,179,171,213,102,148,105,43,139,194,140,105,
+94,60,73,200,168,95,120,25,93,95,115,151,69,80,86,127,253,2,99,84,76,170,
+139,106,157,105,54,81,70,134,216,151,108,169,49,44,129,78,129,154,22,166,
+20,92,97,80,60,22,71,0,1,0,95,1,59,4,52,4,198,0,39,0,0,19,52,54,55,23,6,6,
+21,20,22,51,50,54,53,52,39,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,22,
+21,20,6,35,34,46,2,95,132,119,79,95,96,111,95,84,99,9,4,124,105,115,122,54,
+42,54,74,77,7,8,153,108,83,147,143,61,3,23,141,220,67,165,64,163,114,121,
+141,111,90,55,138,50,83,111,133,100,75,31,88,68,57,105,110,72,112,151,62,
+156,164,0,0,2,0,91,254,233,4,161,4,213,0,59,0,70,0,0,5,7,38,38,39,6,35,34,
+46,2,53,52,54,54,55,38,38,53,52,54,51,50,22,21,20,7,22,51,50,54,55,23,6,6,
+35,34,39,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,22,1,54,
+54,53,52,38,35,34,6,21,20,3,206,142,47,97,37,46,42,90,164,157,61,75,113,86,
+95,81,140,103,133,217,127,40,31,115,238,65,41,67,198,105,150,132,28,82,100,
+67,107,83,81,48,8,71,54,61,83,94,35,131,254,53,90,96,73,62,61,85,149,130,
+50,160,86,8,70,147,106,67,68,111,85,51,76,138,89,94,126,224,118,114,97,5,
+64,47,180,28,37,59,17,48,71,90,54,74,93,26,29,21,53,72,92,66,97,56,47,111,
+3,107,55,97,60,56,79,93,65,115,0,1,0,118,255,61,4,235,4,171,0,67,0,0,1,6,
+6,35,34,38,39,38,38,35,34,6,21,20,23,54,51,50,22,22,21,20,6,6,35,34,39,22,
+23,7,38,38,39,38,38,53,52,54,51,50,23,22,51,50,54,54,53,52,38,35,34,7,38,
+38,53,52,54,51,50,22,23,22,22,51,50,54,54,53,4,235,30,127,72,71,109,75,71,
+104,64,91,83,47,105,96,78,155,89,113,183,101,36,50,88,152,149,53,105,34,101,
+129,62,37,95,67,59,49,101,144,74,74,59,81,108,113,163,140,107,60,98,65,98,
+110,60,78,103,51,3,204,36,57,44,43,42,41,99,70,71,69,47,118,170,82,83,125,
+68,5,122,100,119,69,193,97,25,100,76,46,49,139,9,63,92,43,56,63,64,79,206,
+117,99,129,37,37,53,30,44,50,5,0,0,1,0,113,255,244,3,205,4,210,0,41,0,0,1,
+20,6,35,34,38,39,55,22,51,50,54,53,52,38,39,3,39,19,5,39,55,38,53,52,54,51,
+50,23,23,38,35,34,6,21,20,23,37,23,5,22,22,3,133,186,160,127,223,88,50,158,
+155,116,123,61,51,153,160,176,254,229,74,252,135,205,171,72,54,37,64,51,120,
+140,90,1,160,73,254,176,111,153,1,8,128,148,102,78,75,131,105,87,59,111,44,
+254,214,73,1,16,49,155,32,106,141,130,154,10,158,10,90,90,94,83,71,155,43,
+47,164,0,1,255,218,255,234,6,103,4,230,0,62,0,0,37,6,35,34,38,38,39,1,39,
+1,53,6,35,34,39,6,6,35,34,46,2,53,17,6,7,39,54,51,50,30,2,21,21,20,22,22,
+51,50,54,55,38,53,52,54,51,50,22,21,7,22,51,50,55,17,23,17,20,51,50,54,55,
+6,103,75,75,64,142,69,1,254,17,93,2,76,35,54,106,125,35,166,100,86,117,132,
+38,83,98,76,61,78,67,86,102,30,17,53,59,90,132,11,75,53,43,66,79,2,69,75,
+105,52,165,19,37,87,33,52,62,94,93,74,254,239,144,1,35,120,16,83,96,107,67,
+146,109,109,1,11,8,37,156,28,54,113,70,63,179,96,89,36,101,81,77,71,45,59,
+136,108,43,18,58,2,21,69,251,219,20,47,39,0,0,2,0,32,255,246,5,54,4,230,0,
+18,0,43,0,0,37,6,35,34,38,38,53,53,1,39,1,17,23,17,20,51,50,54,55,37,34,39,
+55,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,5,54,75,75,65,
+145,66,254,22,93,2,71,165,19,37,87,33,252,169,220,142,74,51,107,71,109,129,
+94,88,83,82,105,78,105,83,137,151,56,190,52,62,98,92,76,33,254,242,144,1,
+33,3,34,69,251,219,20,47,39,244,250,52,79,75,141,118,128,111,51,162,43,69,
+173,138,103,140,177,0,0,1,0,104,255,216,5,8,4,230,0,51,0,0,37,6,35,34,38,
+38,53,53,1,39,55,46,2,53,52,55,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,
+54,51,23,34,6,21,20,22,51,50,54,55,17,23,17,20,51,50,54,55,5,8,75,75,65,145,
+66,253,208,102,246,61,141,69,112,183,172,146,58,70,26,62,58,87,105,104,100,
+113,70,147,181,78,91,95,215,60,165,19,37,87,33,52,62,98,92,76,60,254,156,
+138,141,16,112,121,66,112,75,111,151,110,132,17,162,17,71,72,89,70,37,152,
+93,85,65,70,89,63,2,237,69,251,219,20,47,39,0,0,1,0,71,255,230,5,67,4,230,
+0,53,0,0,37,6,35,34,38,38,53,53,1,39,37,38,39,6,35,34,38,53,52,54,51,50,23,
+54,54,53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,7,22,51,50,55,17,23,17,20,
+51,50,54,55,5,67,75,75,65,145,66,253,217,102,1,34,166,106,27,27,71,90,64,
+56,64,61,91,121,82,83,74,101,91,97,103,69,135,120,53,166,125,90,140,172,136,
+165,19,37,87,33,52,62,98,92,76,69,254,161,138,166,49,170,6,78,60,45,64,70,
+34,156,80,61,76,43,164,37,80,134,105,61,108,191,40,123,140,2,211,69,251,219,
+20,47,39,0,3,0,45,255,246,6,57,4,224,0,38,0,49,0,61,0,0,1,22,22,21,20,6,35,
+34,38,38,53,52,54,54,55,55,38,39,1,39,1,38,39,22,21,20,6,35,34,38,53,52,54,
+51,50,4,23,1,23,5,52,39,6,6,21,20,22,51,50,54,1,52,39,14,2,21,20,22,51,50,
+54,4,184,96,91,161,132,104,164,97,58,95,91,47,27,45,254,119,119,1,152,161,
+158,40,139,102,117,170,192,159,181,1,103,168,1,115,118,251,131,12,111,141,
+55,41,74,94,3,18,103,98,99,51,91,74,84,102,2,233,120,212,106,145,172,106,
+154,83,75,128,112,91,48,29,40,254,91,111,1,136,111,28,79,97,110,153,171,118,
+137,167,191,175,1,127,115,146,50,48,3,121,95,50,60,127,253,250,143,156,100,
+115,107,60,77,91,138,0,0,1,0,64,255,241,5,81,4,230,0,48,0,0,1,20,6,7,39,54,
+54,53,52,38,39,3,39,19,6,7,6,6,35,34,3,55,22,22,51,50,54,53,52,38,35,34,7,
+39,54,51,50,22,22,23,54,51,50,23,17,23,17,22,22,5,81,201,161,91,143,164,45,
+41,170,159,165,112,102,11,182,131,216,147,74,53,106,71,107,125,109,94,83,
+82,105,78,105,91,145,161,24,90,89,37,26,165,89,134,1,129,142,205,53,152,52,
+172,115,56,92,29,254,148,79,1,65,10,66,137,176,1,10,52,85,85,173,147,116,
+133,51,162,43,87,195,81,41,5,1,154,69,254,100,65,199,0,0,1,0,32,255,246,5,
+199,4,230,0,52,0,0,37,6,35,34,38,38,39,5,39,1,53,6,35,34,39,6,6,35,34,39,
+55,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,30,2,21,22,51,50,54,55,17,
+23,17,20,51,50,54,55,5,199,75,75,65,143,67,1,254,52,93,2,41,50,77,113,91,
+26,178,124,220,142,74,51,107,71,109,129,94,88,83,82,105,78,105,83,137,152,
+55,46,48,77,121,30,165,19,37,87,33,52,62,96,90,77,254,144,1,18,208,23,62,
+123,144,250,52,79,75,163,133,128,111,51,162,43,69,174,136,103,13,44,34,1,
+181,69,251,219,20,47,39,0,0,3,0,175,254,191,6,198,4,230,0,22,0,40,0,65,0,
+0,5,20,7,39,54,53,52,38,39,46,2,53,17,23,17,20,22,23,23,30,2,37,6,35,34,38,
+38,53,5,39,37,17,23,17,20,51,50,54,55,1,52,38,35,34,7,39,54,51,50,30,2,21,
+20,6,35,34,39,55,22,22,51,50,54,3,215,106,138,70,98,185,155,131,65,165,62,
+89,190,100,121,81,2,239,75,75,65,145,66,254,201,103,1,158,165,19,37,87,33,
+253,82,98,84,59,69,95,55,81,86,141,149,51,178,140,179,116,74,36,75,51,100,
+119,144,112,65,106,41,67,50,81,85,70,77,111,97,3,22,69,252,245,59,74,44,84,
+42,67,105,121,62,98,91,74,171,130,205,3,69,69,251,219,20,47,39,2,139,105,
+120,37,164,22,76,172,123,93,149,189,177,52,42,39,154,0,0,1,0,20,255,246,4,
+227,4,230,0,31,0,0,37,6,35,34,38,38,53,17,1,39,1,38,38,35,34,7,39,54,54,51,
+50,22,23,55,17,23,17,20,51,50,54,55,4,227,75,75,65,145,66,253,204,100,2,50,
+90,150,85,140,173,65,73,176,85,125,208,116,22,165,19,37,87,33,52,62,98,92,
+76,1,62,254,189,152,1,35,123,96,79,169,37,40,144,201,11,1,252,69,251,219,
+20,47,39,0,0,2,0,69,255,230,4,243,4,230,0,44,0,54,0,0,37,6,35,34,38,38,53,
+53,1,39,37,38,3,54,55,38,38,53,52,54,51,50,22,22,21,20,6,7,6,6,21,20,22,51,
+50,54,55,17,23,17,20,51,50,54,55,1,54,53,52,38,35,34,6,21,20,4,243,75,75,
+65,145,66,253,195,102,1,57,251,159,142,88,84,106,122,98,74,134,97,102,98,
+87,47,118,82,96,178,67,165,19,37,87,33,252,208,127,55,44,50,65,52,62,98,92,
+76,83,254,147,138,179,47,1,21,55,56,52,144,84,106,117,96,143,87,82,158,63,
+55,34,16,34,58,65,67,2,207,69,251,219,20,47,39,2,71,102,114,43,65,72,59,112,
+0,0,1,0,96,255,52,3,255,4,223,0,47,0,0,5,38,38,39,1,39,37,38,38,53,52,54,
+54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,
+51,50,22,21,20,7,22,23,3,80,49,82,22,254,113,115,1,40,170,211,103,143,111,
+74,82,54,52,70,136,73,107,91,97,114,80,130,101,95,54,13,67,51,67,101,117,
+76,156,204,80,193,73,254,180,127,214,35,209,135,98,143,91,53,36,47,58,35,
+49,50,57,111,110,66,96,65,43,46,71,109,76,85,108,29,35,41,52,66,102,68,95,
+55,134,134,0,1,0,117,255,229,4,229,5,82,0,45,0,0,37,6,35,34,38,38,53,53,1,
+39,37,38,38,53,52,55,38,53,52,54,55,23,6,6,21,20,23,54,55,23,4,21,20,22,51,
+50,54,55,17,23,17,20,51,50,54,55,4,229,75,75,65,145,66,253,227,102,1,3,97,
+169,115,175,116,109,109,88,86,89,83,105,60,254,209,95,81,93,193,54,165,19,
+37,87,33,52,62,98,92,76,61,254,168,138,148,23,181,108,138,82,113,148,97,149,
+64,141,55,107,70,92,65,36,13,154,46,181,58,76,91,68,2,217,69,251,219,20,47,
+39,0,1,0,55,255,246,4,143,4,230,0,34,0,0,37,6,35,34,38,38,39,5,39,1,53,35,
+34,6,6,21,21,20,35,34,38,38,53,52,51,50,23,17,23,17,20,51,50,54,55,4,143,
+75,75,65,143,67,1,254,52,93,2,41,221,63,58,18,82,50,115,79,193,244,249,165,
+19,37,87,33,52,62,96,90,77,254,144,1,18,243,12,25,24,71,99,80,125,64,120,
+63,1,243,69,251,219,20,47,39,0,1,255,218,255,246,4,172,4,230,0,41,0,0,37,
+6,35,34,38,38,53,53,1,39,1,46,3,53,17,6,7,39,54,51,50,30,2,21,21,20,22,22,
+51,50,55,17,23,17,20,51,50,54,55,4,172,75,75,65,145,66,253,231,116,1,106,
+48,91,91,30,83,98,76,61,78,67,86,102,30,16,53,59,151,105,165,19,37,87,33,
+52,62,98,92,76,175,254,84,126,1,6,13,80,114,103,97,1,41,8,37,156,28,54,113,
+70,63,209,95,88,36,111,2,125,69,251,219,20,47,39,0,0,1,0,95,254,204,3,187,
+4,210,0,54,0,0,5,50,55,7,34,38,39,38,38,53,52,54,51,50,22,23,54,54,53,52,
+38,39,7,39,55,5,39,55,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,37,23,5,
+22,22,21,20,6,35,35,22,22,3,81,46,38,64,151,247,63,105,138,62,42,74,97,28,
+113,122,61,50,109,164,134,254,228,74,252,135,205,171,72,54,37,64,51,120,140,
+90,1,160,73,254,184,118,138,186,160,21,58,158,131,5,182,166,143,22,102,69,
+47,54,116,69,1,107,86,56,116,47,219,68,196,52,155,32,106,141,130,154,10,158,
+10,90,90,94,83,71,155,39,50,178,104,128,148,67,52,0,0,1,0,87,255,223,5,244,
+4,230,0,55,0,0,37,6,35,34,38,38,53,1,39,1,53,6,35,34,39,6,6,35,34,38,38,53,
+52,54,55,23,6,6,21,20,22,51,50,54,55,38,53,52,54,51,50,22,21,7,22,51,50,55,
+17,23,17,20,51,50,54,55,5,244,75,75,65,145,66,253,233,93,2,116,30,44,104,
+125,33,160,96,113,194,112,185,162,128,148,162,96,80,86,124,10,75,53,43,66,
+79,2,69,75,90,52,165,19,37,87,33,52,62,98,91,75,254,225,144,1,50,70,10,81,
+99,110,141,195,106,146,245,66,133,56,215,139,100,121,107,85,77,71,45,59,136,
+108,43,18,43,2,76,69,251,219,20,47,39,0,0,1,0,90,255,240,6,79,4,230,0,52,
+0,0,37,6,35,34,38,38,53,53,1,39,1,53,33,21,20,6,35,34,38,53,52,54,55,17,34,
+6,21,20,23,7,38,2,53,52,36,51,50,30,3,21,21,22,23,17,23,17,20,51,50,54,55,
+6,79,75,75,65,145,66,254,1,93,2,92,254,174,35,42,78,160,66,85,206,245,213,
+57,137,165,1,1,197,49,73,71,88,26,195,143,165,19,37,87,33,52,62,98,92,76,
+3,254,237,144,1,38,221,102,53,46,172,82,52,61,7,1,16,204,172,199,171,67,92,
+1,28,148,183,244,16,41,86,71,115,86,22,43,1,252,69,251,219,20,47,39,0,0,1,
+0,36,255,246,4,249,4,230,0,44,0,0,37,6,35,34,38,38,53,53,1,39,1,53,33,21,
+20,6,35,34,38,53,52,54,55,17,6,7,39,54,51,50,30,2,21,21,22,23,17,23,17,20,
+51,50,54,55,4,249,75,75,65,145,66,254,15,93,2,78,254,143,35,42,78,160,66,
+85,91,111,76,71,89,67,90,97,28,205,164,165,19,37,87,33,52,62,98,92,76,2,254,
+245,144,1,31,185,102,53,46,172,82,52,61,7,1,59,9,46,156,38,57,111,69,63,159,
+18,47,2,32,69,251,219,20,47,39,0,0,1,0,69,255,246,4,226,4,230,0,46,0,0,37,
+6,35,34,38,38,53,53,1,39,37,38,3,36,53,52,38,35,34,7,39,54,51,50,30,2,21,
+20,6,7,6,21,20,22,51,50,54,55,17,23,17,20,51,50,54,55,4,226,75,75,65,145,
+66,253,192,102,1,71,214,155,1,59,59,53,70,83,85,85,75,67,89,113,55,87,141,
+22,123,84,94,162,58,165,19,37,87,33,52,62,98,92,76,131,254,145,138,187,64,
+1,28,141,155,41,50,33,158,26,49,113,106,53,76,124,98,15,20,44,72,65,52,2,
+164,69,251,219,20,47,39,0,0,2,0,95,255,151,5,112,4,230,0,21,0,42,0,0,37,6,
+35,34,38,38,39,1,39,1,17,5,39,37,17,23,17,20,51,50,54,55,37,34,46,2,53,52,
+54,54,55,23,6,6,21,20,22,51,50,55,23,6,5,112,75,75,53,104,93,16,253,242,93,
+2,97,254,85,59,1,230,165,19,37,87,33,253,64,93,175,166,74,137,214,116,77,
+188,218,148,110,87,73,85,54,52,62,58,85,45,254,229,144,1,40,1,182,125,154,
+139,1,57,69,251,219,20,47,39,123,61,158,163,104,112,179,114,20,162,37,194,
+132,103,141,35,157,20,0,1,0,87,255,246,4,195,4,230,0,39,0,0,37,6,35,34,38,
+38,53,53,1,39,37,46,2,53,52,54,51,50,23,23,38,35,34,6,6,21,20,22,51,50,55,
+17,23,17,20,51,50,54,55,4,195,75,75,65,145,66,254,10,116,1,14,84,178,96,242,
+187,35,40,51,42,56,95,140,72,131,107,180,138,165,19,37,87,33,52,62,98,92,
+76,167,254,108,126,197,21,149,166,93,155,196,8,160,7,75,122,67,98,121,172,
+2,92,69,251,219,20,47,39,0,2,0,69,255,246,5,126,4,230,0,38,0,48,0,0,37,6,
+35,34,38,38,53,53,1,39,1,38,39,6,7,39,54,55,38,53,52,54,51,50,22,21,20,7,
+22,23,55,17,23,17,20,51,50,54,55,1,54,53,52,38,35,34,6,21,20,5,126,75,75,
+65,145,66,253,203,101,2,3,170,130,152,192,116,163,130,216,136,107,126,237,
+142,125,204,41,165,19,37,87,33,252,151,140,73,58,63,80,52,62,98,92,76,96,
+254,177,146,1,16,59,69,104,56,153,38,73,160,176,99,124,230,116,129,125,62,
+70,22,2,226,69,251,219,20,47,39,2,21,108,124,60,85,88,66,121,0,0,2,255,218,
+255,246,4,212,4,230,0,33,0,45,0,0,37,6,35,34,38,38,53,53,1,39,1,46,3,53,17,
+6,7,39,54,51,50,22,4,23,17,23,17,20,51,50,54,55,1,38,36,39,22,21,21,20,22,
+22,51,50,4,212,75,75,65,145,66,253,194,116,1,108,50,95,91,29,83,98,76,64,
+88,76,126,1,37,201,165,19,37,87,33,254,171,87,254,231,70,14,16,53,59,177,
+52,62,98,92,76,204,254,55,126,1,7,12,81,113,102,98,1,41,8,37,156,29,70,223,
+171,1,227,69,251,219,20,47,39,1,210,78,229,53,45,87,159,95,88,36,0,1,0,61,
+255,238,6,9,4,230,0,64,0,0,37,6,35,34,38,38,53,53,5,39,37,53,6,35,34,39,6,
+6,7,22,22,51,55,7,34,38,39,7,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,
+34,7,39,54,51,50,22,22,21,7,22,51,50,55,17,23,17,20,51,50,54,55,6,9,75,75,
+65,145,66,254,190,77,1,143,98,98,122,103,38,169,103,51,190,170,31,65,162,
+237,82,33,82,108,71,51,36,74,27,122,144,112,93,87,93,91,83,93,113,181,144,
+2,38,50,179,130,165,19,37,87,33,52,62,98,92,76,153,147,148,155,112,44,55,
+89,135,34,123,141,1,185,244,182,1,86,65,51,57,42,32,40,159,92,80,98,39,172,
+29,111,193,106,35,7,86,1,141,69,251,219,20,47,39,0,1,0,140,255,47,4,96,4,
+198,0,49,0,0,37,20,7,39,54,54,53,52,39,1,39,1,38,35,34,6,21,20,22,22,23,7,
+46,2,53,52,54,55,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,54,51,50,
+22,18,4,96,55,168,43,22,61,254,218,134,1,56,72,82,144,186,102,148,105,43,
+140,193,140,100,93,57,70,200,168,95,120,25,93,95,115,151,65,67,83,128,206,
+211,240,131,91,91,66,78,60,92,75,254,179,107,1,56,33,171,134,106,157,105,
+54,81,70,133,217,151,111,171,49,44,127,75,129,154,22,166,20,92,97,77,60,19,
+110,254,239,0,1,0,95,255,246,5,252,4,198,0,59,0,0,37,6,35,34,38,38,53,53,
+1,39,1,17,52,38,35,34,6,21,20,23,22,21,20,6,35,34,46,2,53,52,54,55,23,6,6,
+21,20,22,51,50,54,53,52,39,38,53,52,54,51,50,22,22,21,17,20,51,50,54,55,5,
+252,75,75,65,145,66,253,253,93,2,96,100,80,74,77,7,8,153,108,83,147,143,61,
+132,119,79,95,96,111,95,84,99,6,7,124,105,100,210,122,19,37,87,33,52,62,98,
+92,76,14,254,235,144,1,39,1,154,103,133,88,68,45,91,92,59,112,151,62,156,
+164,94,122,191,58,165,53,135,96,121,141,111,90,44,66,93,66,111,133,151,194,
+127,253,142,20,47,39,0,0,2,0,91,254,233,6,167,4,230,0,78,0,89,0,0,37,6,35,
+34,38,38,53,53,5,39,37,53,6,6,35,34,39,7,14,2,21,20,22,51,50,55,38,53,52,
+54,51,50,22,21,20,7,22,22,23,7,38,38,39,6,35,34,46,2,53,52,54,54,55,38,38,
+53,52,54,51,50,22,21,20,7,22,51,50,36,55,17,23,17,20,51,50,54,55,1,54,54,
+53,52,38,35,34,6,21,20,6,167,75,75,65,145,66,254,254,93,1,95,92,242,128,150,
+132,28,82,100,67,107,83,81,48,8,71,54,61,83,94,35,131,66,142,47,97,37,46,
+42,90,164,157,61,75,113,86,95,81,140,103,133,217,127,40,31,144,1,60,91,165,
+19,37,87,33,251,111,90,96,73,62,61,85,52,62,98,92,76,69,140,144,159,172,53,
+62,59,17,48,71,90,54,74,93,26,29,21,53,72,92,66,97,56,47,111,38,130,50,160,
+86,8,70,147,106,67,68,111,85,51,76,138,89,94,126,224,118,114,97,5,111,80,
+1,128,69,251,219,20,47,39,2,62,55,97,60,56,79,93,65,115,0,1,0,118,255,61,
+6,115,4,230,0,84,0,0,37,6,35,34,38,38,39,1,39,1,17,6,35,34,38,38,39,38,38,
+35,34,6,21,20,23,54,51,50,22,22,21,20,6,6,35,34,39,22,23,7,38,38,39,38,38,
+53,52,54,51,50,23,22,51,50,54,54,53,52,38,35,34,7,38,38,53,52,54,51,50,22,
+23,22,22,51,50,54,55,53,23,17,20,51,50,54,55,6,115,75,75,56,111,92,11,254,
+219,129,1,160,71,86,52,92,73,56,79,111,69,91,83,47,105,96,78,155,89,113,183,
+101,36,50,88,152,149,53,105,34,101,129,62,37,95,67,59,49,101,144,74,74,59,
+81,108,113,163,140,107,64,104,73,80,123,80,105,117,24,165,19,37,87,33,52,
+62,65,88,48,254,238,114,1,95,2,24,40,24,34,29,42,42,99,70,71,69,47,118,170,
+82,83,125,68,5,122,100,119,69,193,97,25,100,76,46,49,139,9,63,92,43,56,63,
+64,79,206,117,99,129,37,37,41,42,59,34,123,69,251,219,20,47,39,0,1,0,113,
+255,244,4,137,4,210,0,41,0,0,1,20,6,35,34,38,39,55,22,51,50,54,53,52,38,39,
+3,39,19,5,39,55,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,33,23,33,22,22,
+3,133,186,160,127,223,88,50,158,155,116,123,61,51,153,160,176,254,229,74,
+252,135,205,171,72,54,37,64,51,120,140,92,2,104,59,254,29,97,126,1,8,128,
+148,102,78,75,131,105,87,59,111,44,254,214,73,1,16,49,155,32,106,141,130,
+154,10,158,10,90,90,94,85,144,49,155,0,2,255,218,255,234,5,148,4,210,0,44,
+0,48,0,0,1,34,46,2,53,17,6,7,39,54,51,50,30,2,21,21,20,22,22,51,50,54,55,
+38,53,52,54,51,50,22,21,7,22,51,50,55,23,6,35,34,39,6,6,5,1,39,1,2,80,86,
+117,132,38,83,98,76,61,78,67,86,102,30,17,53,59,90,132,11,75,53,43,66,79,
+2,69,75,163,75,38,71,137,106,125,35,166,2,224,253,58,93,2,226,1,141,67,146,
+109,109,1,11,8,37,156,28,54,113,70,63,179,96,89,36,101,81,77,71,45,59,136,
+108,43,18,71,164,53,83,96,107,25,254,118,144,1,114,0,2,0,32,0,19,4,120,4,
+210,0,24,0,28,0,0,19,55,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,30,2,
+21,20,6,35,34,19,1,23,1,32,74,51,107,71,109,129,94,88,83,82,105,78,105,83,
+137,151,56,190,147,220,151,2,250,57,253,42,2,172,52,79,75,141,118,128,111,
+51,162,43,69,173,138,103,140,177,254,241,1,120,125,254,117,0,1,0,104,255,
+216,4,22,4,221,0,35,0,0,1,1,39,55,46,2,53,52,55,38,53,52,54,51,50,23,23,38,
+35,34,6,21,20,23,54,51,23,34,6,21,20,22,51,50,55,4,22,253,24,102,246,61,141,
+69,112,183,172,146,58,70,26,62,58,87,105,104,100,113,70,147,181,78,91,244,
+231,1,177,254,39,138,141,16,112,121,66,112,75,111,151,110,132,17,162,17,71,
+72,89,70,37,152,93,85,65,70,190,0,0,1,0,71,255,230,4,49,4,209,0,42,0,0,1,
+14,2,1,39,37,38,39,6,35,34,38,53,52,54,51,50,23,54,54,53,52,38,35,34,7,39,
+54,51,50,30,2,21,20,6,7,22,51,50,54,55,4,49,32,60,96,253,253,102,1,47,172,
+113,27,27,71,90,64,56,64,61,91,121,82,83,74,101,91,97,103,69,135,120,53,166,
+125,90,140,129,196,66,1,166,31,47,61,254,203,138,163,44,178,6,78,60,45,64,
+70,34,156,80,61,76,43,164,37,80,134,105,61,108,191,40,123,116,80,0,3,0,45,
+255,246,6,135,4,207,0,39,0,50,0,61,0,0,1,34,7,22,21,20,6,35,34,38,38,53,52,
+54,55,38,39,1,39,1,38,39,22,21,20,6,35,34,38,53,52,54,51,50,4,23,54,51,51,
+23,37,52,39,6,6,21,20,22,51,50,54,5,6,6,21,20,22,51,50,54,53,52,6,111,213,
+186,147,159,134,106,169,81,161,136,40,50,254,122,119,1,149,160,156,40,139,
+102,117,170,192,159,193,1,125,177,213,219,31,61,251,53,12,111,141,55,41,74,
+94,2,182,112,127,84,68,80,99,2,253,76,210,192,136,161,111,153,92,114,218,
+84,46,45,254,94,111,1,133,112,30,79,97,110,153,171,118,137,167,216,197,99,
+152,222,50,48,3,121,95,50,60,127,249,67,178,94,81,100,126,105,137,0,0,2,0,
+32,255,255,4,232,4,210,0,35,0,39,0,0,1,34,39,55,22,22,51,50,54,53,52,38,35,
+34,7,39,54,51,50,30,2,21,22,51,50,54,55,23,6,6,35,34,39,6,6,5,1,39,1,1,138,
+220,142,74,51,107,71,109,129,94,88,83,82,105,78,105,83,137,152,55,50,58,91,
+120,61,72,48,112,80,125,96,27,176,2,225,253,105,93,2,187,1,141,250,52,79,
+75,163,133,128,111,51,162,43,69,173,136,103,14,45,43,156,32,37,62,124,143,
+34,254,148,144,1,91,0,3,0,175,254,191,5,205,4,230,0,22,0,47,0,51,0,0,5,54,
+53,52,38,39,46,2,53,17,23,17,20,22,23,23,30,2,21,20,7,1,55,22,22,51,50,54,
+53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,35,34,5,1,23,1,2,227,70,98,185,
+155,131,65,165,62,89,190,100,121,81,106,254,143,74,36,75,51,100,119,98,84,
+59,69,95,55,81,86,141,149,51,178,140,179,1,14,2,23,56,254,24,215,41,67,50,
+81,85,70,77,111,97,3,22,69,252,245,59,74,44,84,42,67,105,75,112,65,3,143,
+52,42,39,154,126,105,120,37,164,22,76,172,123,93,149,189,201,1,9,125,254,
+242,0,0,1,0,20,0,251,3,103,4,56,0,14,0,0,1,1,39,1,38,38,35,34,7,39,54,54,
+51,50,18,3,103,253,158,100,2,50,74,149,102,140,173,65,73,176,85,177,249,2,
+89,254,162,152,1,35,103,116,79,169,37,40,254,245,0,2,0,69,255,230,4,31,4,
+205,0,30,0,40,0,0,1,1,39,37,38,38,39,54,55,38,38,53,52,54,51,50,22,22,21,
+20,6,7,6,6,21,20,22,51,50,54,55,37,54,53,52,38,35,34,6,21,20,4,31,252,237,
+102,1,92,151,216,78,142,88,84,106,122,98,74,134,97,102,98,87,47,118,82,129,
+242,81,253,182,127,55,44,50,65,1,188,254,42,138,174,18,176,135,55,56,52,144,
+84,106,117,96,143,87,82,158,63,55,34,16,34,58,90,81,199,102,114,43,65,72,
+59,112,0,0,1,0,117,255,229,4,24,5,82,0,29,0,0,1,1,39,37,38,38,53,52,55,38,
+53,52,54,55,23,6,6,21,20,23,54,55,23,4,21,20,22,51,50,55,4,24,253,6,102,1,
+25,106,182,115,175,116,109,109,88,86,89,83,105,60,254,209,95,81,248,227,1,
+176,254,53,138,144,17,187,112,138,82,113,148,97,149,64,141,55,107,70,92,65,
+36,13,154,46,181,58,76,190,0,2,0,55,255,255,3,175,3,50,0,17,0,21,0,0,19,52,
+51,50,4,23,21,33,34,6,6,21,21,20,35,34,38,38,19,1,23,1,55,193,161,1,70,101,
+254,196,63,58,18,82,50,115,79,133,2,172,71,253,106,2,186,120,47,25,86,12,
+25,24,71,99,80,125,254,21,1,82,116,254,146,0,0,1,255,218,0,3,3,143,4,210,
+0,27,0,0,1,1,39,37,46,3,53,17,6,7,39,54,51,50,30,2,21,21,20,22,22,51,50,54,
+55,3,143,253,90,116,1,140,58,92,111,33,83,98,76,61,78,67,86,102,30,16,53,
+59,90,161,61,1,254,254,5,126,255,8,67,131,106,102,1,41,8,37,156,28,54,113,
+70,63,209,95,88,36,72,63,0,1,0,95,254,204,4,129,4,210,0,55,0,0,5,50,55,7,
+34,38,39,38,38,53,52,54,51,50,22,23,54,54,53,52,38,39,7,39,55,5,39,55,38,
+38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,33,23,33,22,22,21,20,6,35,35,
+22,22,3,81,46,38,64,151,247,63,105,138,62,42,74,97,28,113,122,61,50,109,164,
+132,254,230,74,253,62,74,205,171,72,54,37,64,51,120,140,72,2,103,90,253,251,
+100,147,186,160,21,58,158,131,5,182,166,143,22,102,69,47,54,116,69,1,107,
+86,56,116,47,219,68,193,49,155,31,47,127,74,130,154,10,158,10,90,90,83,77,
+144,45,170,113,128,148,67,52,0,2,0,87,255,223,5,18,4,224,0,38,0,42,0,0,1,
+34,38,38,53,52,54,55,23,6,6,21,20,22,51,50,54,55,38,53,52,54,51,50,22,21,
+7,22,51,50,54,55,23,6,35,34,39,6,6,37,1,39,1,1,250,113,194,112,185,162,128,
+148,162,96,80,86,124,10,75,53,43,66,79,2,69,75,85,120,32,49,71,129,125,122,
+33,160,2,184,253,33,93,2,248,1,93,141,195,106,146,245,66,133,56,215,139,100,
+121,107,85,77,71,45,59,136,108,43,18,42,31,143,71,77,99,111,11,254,119,144,
+1,114,0,2,0,90,255,240,5,101,4,202,0,34,0,38,0,0,1,17,34,6,21,20,23,7,38,
+2,53,52,36,51,50,30,3,21,21,22,4,23,21,33,21,20,6,35,34,38,53,52,54,1,1,39,
+1,2,175,206,245,213,57,137,165,1,1,197,49,73,71,88,26,111,1,3,96,254,46,35,
+42,78,160,66,3,11,253,65,93,2,227,3,48,1,16,204,172,199,171,67,92,1,28,148,
+183,244,16,41,86,71,115,86,11,46,29,82,102,53,46,172,82,52,61,254,63,254,
+136,144,1,104,0,2,0,36,255,247,4,39,4,210,0,26,0,30,0,0,1,34,38,53,52,54,
+55,17,6,7,39,54,51,50,30,2,21,21,22,4,23,21,33,21,20,6,5,1,39,1,1,145,78,
+160,66,85,91,111,76,71,89,67,90,97,28,111,1,3,96,254,46,35,2,108,253,55,93,
+2,226,1,150,172,82,52,61,7,1,59,9,46,156,38,57,111,69,63,159,11,46,29,82,
+102,53,46,36,254,133,144,1,104,0,1,0,69,0,20,3,219,4,207,0,31,0,0,1,1,39,
+37,38,38,39,36,53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,7,6,21,20,22,51,
+50,55,3,219,253,29,102,1,112,136,199,75,1,59,59,53,70,83,85,85,75,67,89,113,
+55,87,141,22,123,84,240,147,1,192,254,84,138,178,26,193,138,141,155,41,50,
+33,158,26,49,113,106,53,76,124,98,15,20,44,72,133,0,0,3,0,95,255,151,4,146,
+4,200,0,20,0,24,0,28,0,0,19,52,54,54,55,23,6,6,21,20,22,51,50,55,23,6,35,
+34,46,2,37,37,23,5,3,1,23,1,95,137,214,116,77,188,218,148,110,87,73,85,54,
+79,93,175,166,74,1,129,2,29,50,253,236,182,2,238,63,253,48,3,31,112,179,114,
+20,162,37,194,132,103,141,35,157,20,61,158,163,107,154,153,155,253,159,1,
+108,130,254,134,0,1,0,87,0,19,3,149,4,98,0,23,0,0,1,1,39,37,38,2,53,52,54,
+51,50,23,23,38,35,34,6,6,21,20,22,51,50,55,3,149,253,142,116,1,32,123,253,
+242,187,35,40,51,42,56,95,140,72,131,107,208,155,1,254,254,21,126,204,11,
+1,6,149,155,196,8,160,7,75,122,67,98,121,157,0,2,0,69,0,17,4,122,4,202,0,
+23,0,33,0,0,1,1,39,1,38,39,6,7,39,54,55,38,53,52,54,51,50,22,21,20,7,22,23,
+55,37,54,53,52,38,35,34,6,21,20,4,122,253,37,101,2,2,162,137,152,192,116,
+163,130,216,136,107,126,237,142,123,205,141,253,137,140,73,58,63,80,1,192,
+254,81,146,1,17,55,72,104,56,153,38,73,160,176,99,124,230,116,129,125,62,
+70,75,154,108,124,60,85,88,66,121,0,0,2,255,218,0,3,3,215,4,211,0,20,0,32,
+0,0,1,1,39,37,46,3,53,17,6,7,39,54,51,50,22,22,0,23,55,5,50,55,38,36,39,22,
+21,21,20,22,22,3,215,253,21,116,1,119,52,99,95,30,83,98,76,64,88,58,89,207,
+1,33,109,29,254,131,159,136,83,254,227,68,13,16,53,2,62,253,197,126,250,15,
+85,117,105,97,1,41,8,37,156,29,34,156,254,252,107,36,208,115,82,255,57,45,
+86,159,95,88,36,0,0,2,0,61,255,238,4,169,4,199,0,45,0,49,0,0,37,55,7,34,38,
+39,7,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,7,39,54,51,50,22,22,
+21,7,22,51,50,55,23,6,35,34,39,6,6,7,22,22,55,37,23,5,3,31,31,65,162,237,
+82,33,82,108,71,51,36,74,27,122,144,112,93,87,93,91,83,93,113,181,144,2,38,
+50,143,108,55,96,97,122,103,38,169,103,51,190,91,1,166,51,254,116,166,1,185,
+244,182,1,86,65,51,57,42,32,40,159,92,80,98,39,172,29,111,193,106,35,7,54,
+150,42,55,89,135,34,123,141,244,163,136,175,0,2,0,95,255,249,4,247,4,198,
+0,39,0,43,0,0,19,52,54,55,23,6,6,21,20,22,51,50,54,53,52,39,38,53,52,54,51,
+50,23,7,38,35,34,6,21,20,23,22,21,20,6,35,34,46,2,1,1,23,1,95,132,119,79,
+95,96,111,95,84,99,6,7,124,105,115,122,54,40,56,74,77,7,8,153,108,83,147,
+143,61,1,147,2,200,61,253,88,3,80,122,191,58,165,53,135,96,121,141,111,90,
+44,66,93,66,111,133,100,75,31,88,68,45,91,92,59,112,151,62,156,164,253,151,
+1,90,131,254,153,0,0,3,0,91,254,233,5,58,4,213,0,59,0,70,0,74,0,0,5,7,38,
+38,39,6,35,34,46,2,53,52,54,54,55,38,38,53,52,54,51,50,22,21,20,7,22,51,50,
+36,55,23,6,4,35,34,39,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,
+7,22,22,1,54,54,53,52,38,35,34,6,21,20,1,37,21,5,3,206,142,47,97,37,46,42,
+90,164,157,61,75,113,86,95,81,140,103,133,217,127,40,31,152,1,75,86,43,93,
+254,234,152,150,132,28,82,100,67,107,83,81,48,8,71,54,61,83,94,35,131,254,
+53,90,96,73,62,61,85,2,60,1,107,254,242,149,130,50,160,86,8,70,147,106,67,
+68,111,85,51,76,138,89,94,126,224,118,114,97,5,122,86,188,69,85,59,17,48,
+71,90,54,74,93,26,29,21,53,72,92,66,97,56,47,111,3,107,55,97,60,56,79,93,
+65,115,254,3,164,161,147,0,0,2,0,118,255,61,4,254,4,171,0,68,0,72,0,0,5,7,
+38,38,39,38,38,53,52,54,51,50,23,22,51,50,54,54,53,52,38,35,34,7,38,38,53,
+52,54,51,50,22,23,22,22,51,50,54,54,53,23,6,6,35,34,38,38,39,38,38,35,34,
+6,21,20,23,54,51,50,22,22,21,20,6,6,35,34,39,22,37,1,39,1,2,177,149,53,105,
+34,101,129,62,37,95,67,59,49,101,144,74,74,59,81,108,113,163,140,107,64,104,
+73,80,123,80,92,112,50,40,24,112,69,52,92,73,56,79,111,69,91,83,47,105,96,
+78,155,89,113,183,101,36,50,88,2,229,254,172,129,1,169,76,119,69,193,97,25,
+100,76,46,49,139,9,63,92,43,56,63,64,79,206,117,99,129,37,37,41,42,47,53,
+6,186,31,49,24,34,29,42,42,99,70,71,69,47,118,170,82,83,125,68,5,122,211,
+254,194,114,1,103,0,2,0,117,255,244,6,224,4,210,0,61,0,72,0,0,1,20,6,35,34,
+39,6,6,35,34,38,39,55,22,51,50,54,53,52,38,39,5,39,37,38,38,53,52,54,51,50,
+23,23,38,35,34,6,21,20,23,37,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,
+23,37,23,5,22,22,7,52,38,39,5,22,23,22,51,50,54,6,149,186,160,237,219,33,
+170,125,127,223,88,50,158,155,116,123,62,51,254,80,54,1,64,91,119,205,171,
+72,54,37,64,51,120,140,164,2,75,57,74,205,171,72,54,37,64,51,120,140,81,1,
+200,45,254,166,108,163,182,121,95,253,225,151,6,184,179,116,123,1,8,128,148,
+174,82,92,102,78,75,131,105,87,57,107,42,51,169,22,49,155,96,130,154,10,158,
+10,90,90,125,110,54,39,122,74,130,154,10,158,10,90,90,90,79,54,166,24,40,
+164,83,81,154,41,54,97,156,161,105,0,0,1,0,113,255,244,8,87,4,230,0,84,0,
+0,37,6,35,34,38,38,53,53,6,35,34,39,33,22,22,21,20,6,35,34,38,39,55,22,51,
+50,54,53,52,38,39,5,39,37,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,
+33,36,53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,7,6,21,20,22,51,50,54,55,
+17,23,17,20,51,50,54,55,8,87,75,75,65,145,66,100,120,245,175,254,109,95,140,
+186,160,127,223,88,50,158,155,116,123,97,74,254,166,89,1,38,78,99,205,171,
+72,54,37,64,51,120,140,99,2,21,1,22,59,53,70,83,85,85,75,67,89,113,55,87,
+141,22,123,84,94,162,58,165,19,37,87,33,52,62,98,92,76,130,59,239,38,153,
+111,128,148,102,78,75,131,105,87,72,132,42,100,147,77,49,141,86,130,154,10,
+158,10,90,90,97,89,133,146,41,50,33,158,26,49,113,106,53,76,124,98,15,20,
+44,72,65,52,2,164,69,251,219,20,47,39,0,0,2,0,150,254,78,4,93,4,210,0,74,
+0,82,0,0,5,20,6,35,34,38,39,55,22,51,50,54,53,52,38,39,5,39,55,38,38,53,52,
+55,38,38,39,55,22,51,50,54,53,52,38,39,46,2,53,52,54,51,50,23,23,38,35,34,
+6,21,20,22,22,23,30,2,21,20,6,6,7,14,2,21,20,22,23,37,23,7,22,22,19,20,35,
+34,53,52,51,50,3,220,175,143,134,249,98,48,201,172,98,110,78,72,254,223,103,
+190,86,96,154,84,151,53,59,199,211,73,82,83,124,82,100,70,218,141,72,54,37,
+64,51,121,123,47,70,64,89,114,81,86,120,96,66,75,49,69,67,1,21,102,168,88,
+102,129,108,109,109,108,219,97,118,95,64,69,107,72,56,52,67,24,137,127,69,
+28,83,69,122,53,38,126,64,59,215,65,51,49,82,58,39,60,92,64,128,102,10,158,
+10,52,63,31,50,38,28,39,66,107,76,84,98,45,21,15,24,42,34,37,44,19,127,127,
+57,31,106,4,0,116,116,116,0,2,0,112,254,81,4,126,4,210,0,71,0,79,0,0,1,6,
+35,34,46,2,53,17,6,35,34,39,22,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,
+38,39,39,55,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,23,23,38,35,34,
+6,21,20,22,23,30,2,21,20,7,17,20,51,50,54,55,3,52,51,50,21,20,35,34,4,126,
+69,68,42,71,100,39,23,32,81,87,54,122,93,88,135,42,57,59,80,61,73,42,66,59,
+96,59,199,211,73,82,55,80,71,83,100,70,218,141,72,54,37,64,51,121,123,67,
+114,90,113,81,61,18,34,79,30,143,109,108,108,109,254,137,56,33,80,69,61,1,
+218,4,28,81,106,97,129,96,71,43,79,84,68,66,101,75,56,96,59,215,65,51,45,
+69,50,35,41,64,99,67,128,102,10,158,10,52,63,38,65,52,42,70,113,81,91,57,
+253,107,18,43,35,4,118,116,116,116,0,0,3,0,167,254,81,4,114,4,210,0,62,0,
+70,0,94,0,0,1,6,35,34,38,38,39,6,35,34,46,2,53,52,55,38,53,52,54,55,38,39,
+55,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,23,23,38,35,34,6,21,20,
+22,23,30,2,21,20,7,17,20,51,50,54,55,3,52,51,50,21,20,35,34,3,17,6,35,34,
+39,38,35,34,6,21,20,23,54,55,23,6,6,21,20,22,51,50,54,4,114,69,68,45,78,96,
+17,104,118,56,82,109,60,65,123,75,70,86,70,59,199,211,73,82,55,80,71,83,100,
+70,218,141,72,54,37,64,51,121,123,67,114,90,113,81,61,18,34,79,30,143,109,
+108,108,109,168,23,32,63,86,51,32,61,76,43,74,97,65,107,129,58,58,66,141,
+254,137,56,39,81,34,60,30,80,95,54,77,57,82,117,61,90,17,66,85,59,215,65,
+51,45,69,50,35,41,64,99,67,128,102,10,158,10,52,63,38,65,52,42,70,113,81,
+91,57,253,107,18,43,35,4,118,116,116,116,252,121,1,156,4,20,14,60,59,52,45,
+37,8,140,7,72,58,38,45,50,0,3,0,122,254,81,4,92,4,210,0,62,0,70,0,77,0,0,
+5,23,6,35,34,46,2,53,53,33,21,20,6,35,34,38,53,52,54,55,17,38,39,55,22,51,
+50,54,53,52,38,38,39,46,2,53,52,54,51,50,23,23,38,35,34,6,21,20,22,23,30,
+2,21,20,7,17,20,51,50,54,3,52,51,50,21,20,35,34,3,17,7,34,39,17,22,3,255,
+78,69,68,42,71,100,39,254,214,32,39,73,148,63,81,65,52,59,199,211,73,82,55,
+80,71,83,100,70,218,141,72,54,37,64,51,121,123,67,114,90,113,81,80,18,34,
+79,94,109,108,108,109,187,36,132,130,161,249,126,56,33,80,69,61,93,78,49,
+43,146,73,49,56,6,1,134,57,62,59,215,65,51,45,69,50,35,41,64,99,67,128,102,
+10,158,10,52,63,38,65,52,42,70,113,81,105,59,253,123,18,43,4,153,116,116,
+116,252,254,1,20,1,70,254,220,17,0,0,3,0,73,255,245,8,137,4,230,0,46,0,83,
+0,91,0,0,37,6,35,34,38,38,53,53,6,35,34,38,39,36,53,52,38,35,34,7,39,54,51,
+50,30,2,7,20,6,7,6,21,20,22,51,50,54,55,17,23,17,20,51,50,54,55,37,20,6,35,
+34,36,39,55,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,55,23,14,2,21,20,
+22,22,23,30,2,19,20,35,34,53,52,51,50,8,137,75,75,65,145,66,100,120,171,242,
+87,1,59,56,49,102,206,85,160,152,67,89,113,53,2,87,141,22,123,84,94,162,58,
+165,19,37,87,33,251,94,175,144,152,254,244,102,69,95,216,95,88,109,58,85,
+74,78,95,65,229,175,75,81,131,105,51,77,67,85,107,75,35,108,109,109,108,52,
+62,98,92,76,130,59,205,161,141,155,39,48,18,158,11,49,112,106,50,76,124,98,
+15,20,44,72,65,52,2,164,69,251,219,20,47,39,84,129,156,193,134,56,116,115,
+91,78,61,99,74,54,56,84,115,74,115,143,51,166,22,50,88,60,43,75,61,45,57,
+89,126,1,205,116,116,116,0,0,2,0,110,255,246,10,23,4,230,0,93,0,104,0,0,37,
+6,35,34,38,38,53,53,6,35,34,38,39,36,53,52,38,35,34,7,22,21,20,2,4,35,34,
+38,38,53,52,55,38,53,52,54,51,50,23,23,38,35,34,6,21,20,22,23,54,55,23,6,
+6,21,20,22,51,50,36,55,38,2,53,52,54,51,50,23,36,51,50,30,2,21,20,6,7,6,21,
+20,22,51,50,54,55,17,23,17,20,51,50,54,55,1,52,38,35,34,6,21,20,22,23,54,
+10,23,75,75,65,145,66,100,120,170,243,87,1,52,56,49,159,202,31,160,254,241,
+159,153,218,158,128,209,161,128,60,47,23,37,37,79,104,64,62,84,99,74,163,
+146,135,110,177,1,17,63,182,237,123,94,161,146,1,0,101,70,95,102,53,101,107,
+22,112,75,97,161,56,165,19,37,87,33,250,190,94,77,57,79,146,140,21,52,62,
+98,92,76,10,59,190,148,112,127,39,48,13,103,113,176,254,213,176,113,198,100,
+149,87,144,197,118,148,11,159,8,77,83,69,116,57,35,11,154,30,120,90,91,113,
+186,161,88,1,8,184,98,130,229,11,57,105,100,55,73,112,59,12,23,33,52,73,57,
+3,15,69,251,219,20,47,39,2,41,157,189,77,78,105,192,76,86,0,0,3,0,110,254,
+83,5,86,4,220,0,66,0,76,0,88,0,0,1,6,35,34,38,38,39,6,6,35,34,38,53,52,55,
+46,2,53,52,55,38,53,52,54,51,50,23,23,38,35,34,6,21,20,22,23,54,55,23,6,6,
+21,20,22,51,50,36,55,36,17,52,54,51,50,22,22,21,20,6,7,17,22,51,50,54,55,
+3,54,53,52,38,35,34,6,21,20,19,53,6,7,6,6,21,20,22,51,50,54,5,86,75,75,56,
+112,91,11,51,139,75,123,254,133,64,124,53,88,174,163,130,74,33,23,34,40,81,
+106,43,44,104,123,74,115,190,126,88,149,1,5,76,254,168,114,88,85,158,129,
+93,88,1,19,37,87,33,186,43,87,66,52,69,76,86,95,143,162,88,71,96,170,254,
+145,62,65,89,49,44,51,214,124,120,68,24,118,104,70,105,73,123,165,114,143,
+11,159,8,78,77,52,81,47,51,4,154,13,100,96,73,70,132,117,191,1,27,96,125,
+127,233,148,113,202,79,253,135,20,47,39,3,80,97,117,114,150,77,71,188,252,
+245,246,41,23,35,95,84,56,70,88,0,1,0,48,255,246,6,248,4,230,0,66,0,0,37,
+6,35,34,38,39,6,35,34,38,39,5,39,1,23,6,21,20,22,51,50,54,55,17,6,35,34,39,
+23,20,6,35,34,38,39,55,22,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,22,
+23,22,51,50,54,55,53,23,17,20,51,50,54,55,6,248,75,75,55,109,54,82,84,125,
+196,20,254,195,143,2,75,120,116,71,54,53,105,35,125,203,159,141,1,175,136,
+114,188,70,74,50,104,70,103,124,94,88,83,82,105,78,105,88,143,160,21,98,125,
+151,212,56,165,19,37,87,33,52,62,62,52,61,156,104,246,110,1,156,99,77,107,
+58,64,60,57,2,7,94,77,42,127,164,120,107,52,67,64,128,105,128,111,51,162,
+43,77,192,79,34,98,78,226,69,251,219,20,47,39,0,1,0,48,255,246,6,248,4,230,
+0,73,0,0,37,6,35,34,38,38,53,53,35,34,39,22,21,20,6,35,34,38,39,55,22,22,
+51,50,54,53,52,39,55,33,17,6,35,34,39,23,20,6,35,34,38,39,55,22,22,51,50,
+54,53,52,38,35,34,7,39,54,51,50,22,22,23,22,51,50,54,55,53,23,17,20,51,50,
+54,55,6,248,75,75,65,145,66,204,74,35,42,133,105,131,176,47,88,36,118,61,
+58,78,86,29,1,225,125,203,159,141,1,175,136,114,188,70,74,50,104,70,103,124,
+94,88,83,82,105,78,105,88,143,160,21,98,125,151,212,56,165,19,37,87,33,52,
+62,98,92,76,127,7,71,96,100,129,161,116,38,81,84,74,63,113,96,52,1,12,94,
+77,42,127,164,120,107,52,67,64,128,105,128,111,51,162,43,77,192,79,34,98,
+78,226,69,251,219,20,47,39,0,1,0,142,254,77,3,214,4,200,0,75,0,0,5,23,6,33,
+34,46,2,53,52,54,54,55,62,2,53,52,39,6,35,34,46,2,53,52,54,54,55,62,2,53,
+52,38,35,34,7,39,54,54,51,50,22,21,20,6,6,7,14,2,21,20,51,50,36,55,23,6,7,
+22,21,20,6,6,7,14,2,21,20,51,50,36,3,116,98,209,254,249,69,126,95,78,104,
+144,117,81,95,62,56,88,91,69,126,95,78,109,153,122,91,105,69,64,60,161,207,
+73,68,182,89,151,214,104,148,118,95,108,73,111,119,1,6,108,98,85,91,79,94,
+132,111,89,105,70,115,119,1,2,126,146,163,37,70,105,62,70,100,60,38,26,36,
+48,30,47,11,21,37,70,105,62,71,104,69,42,31,43,56,34,41,33,94,154,33,49,184,
+95,69,100,64,40,32,45,61,38,85,93,89,146,65,39,59,83,66,92,57,36,28,43,61,
+41,85,93,0,2,0,152,254,70,3,238,4,200,0,69,0,81,0,0,5,20,6,6,35,34,38,38,
+53,52,54,51,23,38,38,53,52,55,46,2,53,52,54,54,55,62,2,53,52,38,35,34,7,39,
+54,54,51,50,22,21,20,6,6,7,14,2,21,20,51,50,36,55,23,6,6,7,6,6,21,20,22,22,
+23,22,23,22,22,7,52,38,35,34,6,21,20,22,51,50,54,3,238,104,161,83,154,215,
+137,159,119,31,61,71,22,61,92,41,109,153,122,91,105,69,64,60,161,207,73,68,
+182,89,151,214,104,148,118,95,108,73,111,120,1,5,108,98,89,170,106,93,48,
+40,61,57,80,43,120,114,175,135,109,113,151,135,109,113,151,197,80,111,54,
+94,152,90,94,120,1,30,79,42,34,25,27,90,75,49,71,104,69,42,31,43,56,34,41,
+33,94,154,33,49,184,95,69,100,64,40,32,45,61,38,85,83,81,146,62,60,23,19,
+32,25,22,32,23,18,25,17,49,143,28,77,93,104,82,77,93,104,0,1,0,128,255,246,
+8,106,4,230,0,87,0,0,37,6,35,34,38,38,53,53,6,35,34,38,39,36,53,52,38,35,
+34,7,14,2,7,14,2,21,20,22,51,50,54,55,23,6,35,34,38,38,53,52,54,54,55,62,
+2,53,52,38,35,34,6,7,39,54,54,51,50,22,23,54,51,50,30,2,21,20,6,7,6,21,20,
+22,51,50,54,55,17,23,17,20,51,50,54,55,8,106,75,75,65,145,66,100,120,170,
+243,87,1,52,56,49,150,151,5,95,130,107,98,117,78,101,79,100,215,96,98,190,
+206,118,174,153,103,145,118,93,109,72,91,66,65,187,85,73,67,179,85,89,167,
+80,156,113,70,95,102,53,101,107,22,112,75,97,161,56,165,19,37,87,33,52,62,
+98,92,76,10,59,190,148,112,127,39,48,9,82,114,71,44,40,62,95,66,70,87,79,
+75,146,143,86,181,100,91,129,82,51,40,57,79,51,67,68,51,39,154,32,50,94,115,
+7,57,105,100,55,73,112,59,12,23,33,52,73,57,3,15,69,251,219,20,47,39,0,0,
+2,0,175,254,83,4,144,4,200,0,60,0,70,0,0,1,6,35,34,38,38,39,6,35,34,38,38,
+53,52,55,46,2,53,52,54,54,55,62,2,53,52,38,35,34,7,39,54,54,51,50,22,21,20,
+6,6,7,14,2,21,20,51,50,36,55,23,6,7,17,22,51,50,54,55,37,17,7,6,6,21,20,22,
+51,50,4,144,75,75,62,133,78,3,85,105,84,157,133,169,49,88,35,109,153,122,
+91,105,69,64,60,161,207,73,68,182,89,151,214,104,148,118,95,108,73,111,119,
+1,6,108,98,52,57,1,19,37,87,33,254,171,31,177,209,88,71,140,254,145,62,86,
+93,69,59,85,172,85,143,83,25,89,71,45,71,104,69,42,31,43,56,34,41,33,94,154,
+33,49,184,95,69,100,64,40,32,45,61,38,85,93,89,146,40,31,253,97,20,47,39,
+239,1,44,8,41,123,107,56,70,0,3,0,152,254,74,3,244,4,210,0,60,0,72,0,84,0,
+0,5,20,6,6,35,34,39,38,38,53,52,54,51,23,38,53,52,55,38,38,53,52,54,51,23,
+38,53,52,54,51,50,23,23,38,35,34,21,20,22,22,23,23,22,22,21,20,6,6,35,34,
+39,6,6,21,20,22,22,23,23,22,22,1,50,54,53,52,38,35,34,6,21,20,22,1,52,38,
+35,34,6,21,20,22,51,50,54,3,244,107,163,82,173,114,96,125,157,120,51,149,
+35,93,121,157,120,55,150,185,154,72,54,37,64,51,228,44,68,64,104,121,118,
+107,163,82,48,37,40,42,44,68,64,104,121,118,254,69,112,156,137,109,112,156,
+137,1,121,137,109,112,156,137,109,112,156,204,76,106,52,62,51,129,92,90,115,
+3,75,102,50,36,50,128,90,90,115,3,78,124,92,109,10,158,10,107,33,46,30,23,
+40,52,142,74,76,106,52,4,4,35,24,33,46,30,23,40,52,142,2,20,98,77,77,93,98,
+77,77,93,253,210,77,93,98,77,77,93,98,0,0,3,0,36,255,246,8,112,4,230,0,45,
+0,79,0,91,0,0,37,6,35,34,38,38,53,53,6,35,34,38,39,36,53,52,38,35,34,7,39,
+54,51,50,22,22,21,20,6,7,6,21,20,22,51,50,54,55,17,23,17,20,51,50,54,55,37,
+20,6,6,35,34,38,38,53,52,54,51,23,38,38,53,52,54,51,50,23,23,38,35,34,6,21,
+20,22,22,23,23,22,22,7,52,38,35,34,6,21,20,22,51,50,54,8,112,75,75,65,145,
+66,100,120,171,242,87,1,59,56,49,117,182,40,112,101,110,137,118,87,141,22,
+123,84,94,162,58,165,19,37,87,33,251,103,83,164,116,138,220,141,191,141,43,
+100,118,203,174,72,54,37,64,51,122,139,52,84,79,91,114,121,170,140,104,118,
+157,141,106,120,152,52,62,98,92,76,130,59,205,161,141,155,39,48,18,158,12,
+84,155,79,76,124,98,15,20,44,72,65,52,2,164,69,251,219,20,47,39,122,86,146,
+87,121,185,102,126,170,2,49,139,86,124,141,10,158,10,76,76,46,70,54,42,50,
+66,186,35,102,137,151,116,99,141,149,0,0,1,0,105,254,74,3,160,4,210,0,72,
+0,0,5,20,6,35,34,36,39,55,22,22,51,50,54,53,52,38,39,46,2,53,52,55,38,39,
+55,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,23,23,38,35,34,6,21,
+20,22,22,23,30,2,21,20,6,35,34,39,6,21,20,22,22,23,30,2,3,160,154,122,140,
+254,213,108,59,95,226,109,74,91,86,127,85,103,72,48,138,91,59,95,226,109,
+74,91,58,87,75,88,106,75,218,141,82,54,37,64,61,121,123,50,75,68,96,120,86,
+154,122,63,59,81,48,73,66,93,115,84,220,97,121,162,130,59,102,113,66,50,49,
+83,57,39,61,93,64,73,46,84,111,59,102,113,66,50,45,69,50,35,41,64,99,67,128,
+102,10,158,10,52,63,33,53,39,30,42,70,113,81,97,121,15,11,69,31,50,38,28,
+40,66,107,0,2,0,110,254,44,3,241,4,210,0,69,0,79,0,0,5,20,6,6,35,34,46,2,
+53,52,54,54,55,38,38,39,55,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,
+50,23,23,38,35,34,6,21,20,22,22,23,30,2,21,20,6,6,7,14,2,21,20,22,23,38,53,
+52,54,51,50,22,22,7,52,38,35,34,6,21,23,54,54,3,241,112,173,89,107,158,167,
+74,110,163,115,121,216,70,59,95,226,109,74,91,58,87,75,88,106,75,218,141,
+82,54,37,64,61,121,123,50,75,68,96,120,86,84,122,105,113,135,94,128,105,49,
+142,110,80,135,78,132,51,42,80,99,1,112,159,206,84,119,59,61,137,133,81,96,
+138,90,44,25,153,84,59,102,113,66,50,45,69,50,35,41,64,99,67,128,102,10,158,
+10,52,63,33,53,39,30,42,70,113,81,68,101,70,47,51,78,119,82,96,117,9,75,89,
+109,144,91,121,4,37,50,143,114,30,13,119,0,2,0,71,255,245,8,97,4,230,0,46,
+0,87,0,0,37,6,35,34,38,38,53,53,6,35,34,38,39,36,53,52,38,35,34,7,39,54,51,
+50,30,2,7,20,6,7,6,21,20,22,51,50,54,55,17,23,17,20,51,50,54,55,37,20,6,6,
+35,34,36,39,55,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,23,23,38,
+35,34,6,21,20,22,22,23,30,2,8,97,75,75,65,145,66,100,120,171,242,87,1,59,
+56,49,119,166,36,139,101,67,89,113,53,2,87,141,22,123,84,94,162,58,165,19,
+37,87,33,251,174,95,155,88,159,254,233,107,69,102,215,99,103,127,66,97,82,
+90,109,75,205,171,72,54,37,64,51,120,140,59,89,77,96,119,83,52,62,98,92,76,
+130,59,205,161,141,155,39,48,14,156,9,49,112,106,50,76,124,98,15,20,44,72,
+65,52,2,164,69,251,219,20,47,39,95,95,134,67,193,134,56,117,114,101,88,67,
+100,69,47,52,80,121,84,130,154,10,158,10,90,90,55,84,60,42,52,85,136,0,3,
+0,162,254,67,4,48,4,209,0,68,0,78,0,88,0,0,5,20,6,6,35,34,46,2,53,52,54,55,
+46,2,53,52,54,54,55,54,54,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,23,38,
+53,52,54,51,50,22,22,21,20,6,7,6,7,14,2,21,20,22,23,38,53,52,54,51,50,22,
+22,1,23,54,54,53,52,38,35,34,6,1,52,38,35,34,6,21,23,54,54,4,48,112,173,89,
+107,160,166,73,158,120,76,159,73,110,150,114,121,70,31,70,115,70,102,89,101,
+121,85,128,105,49,142,110,80,135,78,82,70,53,118,123,148,105,128,105,49,142,
+110,80,135,78,254,77,2,112,159,51,42,79,101,1,47,51,42,79,101,2,112,159,183,
+84,119,59,61,137,132,82,114,137,45,26,130,131,83,99,137,79,44,46,54,29,28,
+27,57,86,91,50,74,52,36,41,63,98,69,96,117,9,75,89,109,144,91,121,73,71,108,
+34,25,43,45,69,107,74,96,117,9,75,89,109,144,91,121,2,3,53,13,119,68,37,50,
+131,253,146,37,50,131,103,53,13,119,0,0,2,0,128,255,246,8,182,4,230,0,83,
+0,95,0,0,37,6,35,34,38,38,53,53,6,35,34,38,39,36,53,52,38,35,34,5,6,6,7,14,
+2,21,20,22,23,38,38,53,52,54,51,50,22,21,20,6,35,34,36,38,53,52,54,54,55,
+54,54,53,52,39,55,22,23,54,51,50,30,2,21,20,6,7,6,21,20,22,51,50,54,55,17,
+23,17,20,51,50,54,55,37,20,23,62,2,53,52,38,35,34,6,8,182,75,75,65,145,66,
+100,120,170,243,87,1,52,56,49,220,254,220,33,86,74,100,118,83,136,113,31,
+30,140,109,124,199,199,155,148,254,250,149,106,146,113,126,75,59,70,139,4,
+252,113,70,95,102,53,101,107,22,112,75,97,161,56,165,19,37,87,33,250,6,4,
+84,125,65,54,45,81,98,52,62,98,92,76,10,59,190,148,112,127,39,48,21,29,47,
+35,47,72,117,83,109,157,22,44,91,62,109,139,209,105,118,153,160,216,119,111,
+155,92,54,59,71,38,53,52,57,110,109,12,57,105,100,55,73,112,59,12,23,33,52,
+73,57,3,15,69,251,219,20,47,39,5,36,32,4,70,101,51,40,52,136,0,1,0,7,255,
+246,5,68,4,230,0,33,0,0,37,6,35,34,38,38,53,17,35,34,6,21,20,23,7,38,2,53,
+52,55,6,7,39,54,33,33,17,23,17,20,51,50,54,55,5,68,75,75,65,145,66,197,136,
+146,244,72,159,183,59,141,130,54,255,1,62,1,86,165,19,37,87,33,52,62,98,92,
+76,1,208,120,115,203,222,67,132,1,7,154,104,76,14,27,168,40,1,109,69,251,
+219,20,47,39,0,1,0,7,255,249,4,17,3,121,0,18,0,0,1,21,33,34,6,21,20,23,7,
+38,2,53,52,55,6,7,39,54,33,4,17,254,196,136,146,244,72,159,183,59,141,130,
+54,255,1,62,3,121,169,120,115,203,222,67,132,1,7,154,104,76,14,27,168,40,
+0,1,0,42,254,154,4,96,4,223,0,68,0,0,1,38,39,6,35,34,39,22,21,20,6,35,34,
+38,39,55,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,54,55,62,2,53,52,39,
+55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,
+22,23,3,174,168,80,36,55,84,89,98,120,95,89,140,42,57,28,79,38,63,71,38,54,
+47,48,56,39,103,143,111,74,82,54,52,70,136,73,107,91,97,114,80,130,101,95,
+54,13,67,51,67,101,116,60,179,89,254,154,251,251,6,25,109,125,90,115,97,70,
+43,38,41,72,59,61,93,67,46,47,69,97,64,98,143,91,53,36,47,58,35,49,50,57,
+111,110,66,96,65,43,46,71,109,76,85,108,29,35,41,52,66,102,68,95,55,111,224,
+85,0,3,0,95,254,154,5,204,4,223,0,56,0,67,0,80,0,0,1,38,39,6,6,35,34,38,38,
+39,38,38,53,52,54,51,50,23,62,2,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,
+20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,22,23,1,38,39,35,34,6,21,20,
+22,23,54,5,7,34,39,6,6,21,20,22,51,50,54,54,5,26,106,71,33,165,113,93,140,
+104,12,156,218,158,117,43,48,7,105,137,107,74,82,54,52,70,136,73,107,91,97,
+114,80,130,101,95,54,13,67,51,67,101,116,60,179,89,252,142,105,27,17,76,107,
+101,96,19,2,35,66,102,96,74,73,68,55,61,126,90,254,154,158,160,99,123,74,
+111,66,33,164,142,104,135,10,89,132,85,52,36,47,58,35,49,50,57,111,110,66,
+96,65,43,46,71,109,76,85,108,29,35,41,52,66,102,68,95,55,111,224,85,2,2,82,
+112,94,73,69,105,31,111,50,3,33,34,102,56,51,65,69,126,0,1,0,117,254,241,
+4,21,4,201,0,50,0,0,1,38,39,6,35,34,38,38,53,52,55,38,38,53,52,54,51,50,23,
+23,38,35,34,6,21,20,22,23,54,55,23,6,4,21,20,22,51,50,55,38,53,52,54,51,50,
+22,21,20,7,22,23,3,102,70,50,56,70,125,187,165,147,77,100,200,171,96,90,37,
+97,82,117,143,50,58,128,170,76,180,254,225,125,112,86,75,17,74,53,66,97,113,
+83,117,254,241,123,155,14,95,207,109,147,87,51,157,90,133,156,17,166,18,100,
+84,61,92,46,47,7,157,10,111,125,83,97,21,40,34,52,69,102,68,98,56,119,92,
+0,2,0,120,254,154,5,238,4,223,0,65,0,78,0,0,1,38,39,6,6,35,34,38,38,39,7,
+34,38,53,52,54,55,23,6,21,20,22,23,54,55,38,53,52,54,54,55,62,2,53,52,39,
+55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,
+22,23,1,7,34,39,6,6,21,20,22,51,50,54,54,5,60,106,71,33,165,113,91,137,109,
+13,28,158,196,19,13,178,26,102,97,24,109,142,103,143,111,74,82,54,52,70,136,
+73,107,91,97,114,80,130,101,95,54,13,67,51,67,101,116,60,179,89,254,61,66,
+102,96,74,73,68,55,61,126,90,254,154,158,160,99,123,70,115,69,1,181,146,39,
+79,25,30,64,62,83,112,19,104,63,112,160,98,143,91,53,36,47,58,35,49,50,57,
+111,110,66,96,65,43,46,71,109,76,85,108,29,35,41,52,66,102,68,95,55,111,224,
+85,1,141,3,33,34,102,56,51,65,69,126,0,0,1,0,96,254,154,4,96,4,223,0,62,0,
+0,5,20,22,23,22,23,6,6,35,34,38,53,52,54,55,38,38,53,52,54,54,55,62,2,53,
+52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,
+7,22,22,23,7,38,39,14,2,1,134,17,18,42,2,1,97,55,91,120,223,155,174,213,103,
+143,111,74,82,54,52,70,136,73,107,91,97,114,80,130,101,95,54,13,67,51,67,
+101,116,60,179,89,178,169,78,68,195,42,78,13,25,21,49,29,46,43,79,62,75,172,
+66,35,209,136,98,143,91,53,36,47,58,35,49,50,57,111,110,66,96,65,43,46,71,
+109,76,85,108,29,35,41,52,66,102,68,95,55,111,224,85,102,251,249,37,121,41,
+0,3,0,157,254,154,4,172,4,223,0,52,0,60,0,68,0,0,1,38,39,6,6,35,34,38,38,
+53,52,55,38,53,52,54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,
+51,50,55,38,53,52,54,51,50,22,21,20,7,22,22,23,1,7,34,39,6,7,5,54,7,39,6,
+21,20,22,51,50,3,250,105,71,35,179,117,105,161,88,148,133,103,143,111,74,
+82,54,52,70,136,73,107,91,97,114,80,130,101,95,54,13,67,51,67,101,116,60,
+179,89,254,67,72,111,105,35,24,1,1,76,137,250,39,74,58,78,254,154,157,157,
+119,140,99,125,77,170,97,110,155,98,143,91,53,36,47,58,35,49,50,57,111,110,
+66,96,65,43,46,71,109,76,85,108,29,35,41,52,66,102,68,95,55,111,224,85,1,
+141,3,39,20,22,205,89,146,199,63,66,58,68,0,0,1,0,127,254,20,5,196,4,223,
+0,77,0,0,5,23,22,21,20,6,35,34,38,53,52,55,39,6,21,20,22,23,7,34,38,38,53,
+52,54,51,50,22,23,54,55,38,38,53,52,54,54,55,62,2,53,52,39,55,22,21,20,6,
+6,7,14,2,21,20,22,51,50,55,38,53,52,54,51,50,22,21,20,7,22,22,23,7,38,39,
+7,6,2,234,21,39,91,60,72,104,47,122,98,196,166,28,138,236,139,158,119,76,
+106,55,86,105,171,209,103,143,111,74,82,54,52,70,136,73,107,91,97,114,80,
+130,101,95,54,13,67,51,67,101,116,60,179,89,178,168,80,3,191,70,27,48,31,
+41,35,59,50,38,53,115,80,119,118,154,12,72,99,175,110,111,144,49,53,60,46,
+37,207,135,98,143,91,53,36,47,58,35,49,50,57,111,110,66,96,65,43,46,71,109,
+76,85,108,29,35,41,52,66,102,68,95,55,111,224,85,102,251,251,1,129,0,1,0,
+65,255,246,5,130,5,51,0,71,0,0,37,6,35,34,38,38,39,35,21,20,6,35,34,38,53,
+52,54,55,53,34,7,6,35,34,46,2,53,52,54,54,55,62,2,53,52,39,55,22,21,20,6,
+6,7,14,2,21,20,22,51,50,55,54,51,50,30,2,21,21,22,23,17,23,17,20,51,50,54,
+55,5,130,75,75,61,131,75,7,222,31,36,71,136,48,62,37,58,52,35,64,133,112,
+44,87,121,95,69,75,51,31,70,122,76,109,91,79,95,63,54,42,31,52,54,34,66,91,
+96,33,108,112,165,19,37,87,33,52,62,83,87,60,57,46,40,128,71,41,45,7,174,
+13,12,62,109,80,51,75,98,54,29,22,30,45,31,32,38,57,93,101,58,79,48,30,25,
+40,61,43,42,47,14,14,58,106,71,72,20,14,30,3,165,69,251,219,20,47,39,0,0,
+1,0,117,255,246,4,229,5,173,0,58,0,0,37,6,35,34,38,38,53,53,6,35,34,46,2,
+53,52,55,38,38,53,52,54,55,54,54,55,52,39,55,22,22,21,20,6,7,6,6,21,20,23,
+54,55,23,4,21,20,22,51,50,54,55,17,23,17,20,51,50,54,55,4,229,75,75,65,145,
+66,119,147,73,112,129,70,90,71,79,47,71,42,39,1,55,49,72,87,52,51,49,49,71,
+92,122,60,254,209,95,81,93,193,54,165,19,37,87,33,52,62,98,92,76,30,92,46,
+106,117,75,120,79,51,116,75,49,90,67,41,52,30,39,36,70,27,102,67,47,75,50,
+47,69,43,77,62,47,14,154,46,181,58,76,91,68,2,250,69,251,219,20,47,39,0,2,
+0,157,254,154,4,157,4,223,0,52,0,65,0,0,1,38,39,6,6,35,34,38,38,53,52,55,
+38,53,52,54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,
+38,53,52,54,51,50,22,21,20,7,22,22,23,1,7,34,39,6,6,21,20,22,51,50,54,54,
+3,235,106,71,33,165,113,105,161,88,129,133,103,143,111,74,82,54,52,70,136,
+73,107,91,97,114,80,130,101,95,54,13,67,51,67,101,116,60,179,89,254,61,66,
+110,103,67,65,68,55,61,126,90,254,154,158,160,99,123,99,125,77,143,84,109,
+155,98,143,91,53,36,47,58,35,49,50,57,111,110,66,96,65,43,46,71,109,76,85,
+108,29,35,41,52,66,102,68,95,55,111,224,85,1,141,3,38,36,104,57,51,65,69,
+126,0,0,1,0,133,254,204,8,69,4,230,0,97,0,0,37,6,35,34,38,38,53,53,6,35,34,
+39,33,22,22,21,20,6,35,35,22,22,51,50,55,7,34,38,39,38,38,53,52,54,51,50,
+22,23,54,54,53,52,38,39,5,39,37,38,38,53,52,54,51,50,23,23,38,35,34,6,21,
+20,23,33,36,53,52,38,35,34,7,39,54,51,50,30,2,21,20,6,7,6,21,20,22,51,50,
+54,55,17,23,17,20,51,50,54,55,8,69,75,75,65,145,66,100,120,245,176,254,107,
+96,142,186,160,21,58,158,117,46,38,64,151,247,63,105,138,62,42,74,97,28,113,
+122,97,73,254,201,89,1,1,79,99,205,171,72,54,37,64,51,120,140,101,2,17,1,
+24,59,53,70,83,85,85,75,67,89,113,55,87,141,22,123,84,94,162,58,165,19,37,
+87,33,52,62,98,92,76,130,59,240,39,151,113,128,148,67,52,5,182,166,143,22,
+102,69,47,54,116,69,1,107,86,72,131,42,82,147,59,48,142,87,130,154,10,158,
+10,90,90,100,87,134,146,41,50,33,158,26,49,113,106,53,76,124,98,15,20,44,
+72,65,52,2,164,69,251,219,20,47,39,0,0,2,0,69,255,246,6,224,4,230,0,51,0,
+61,0,0,37,6,35,34,38,38,39,6,35,34,38,39,5,39,37,38,39,6,7,39,54,55,38,53,
+52,54,51,50,22,21,20,7,22,23,55,23,6,21,20,22,51,50,54,55,17,23,17,20,51,
+50,54,55,1,54,53,52,38,35,34,6,21,20,6,224,75,75,53,103,95,15,57,51,125,196,
+20,254,195,143,1,27,92,97,152,192,116,163,130,216,136,107,126,237,142,76,
+124,212,120,116,71,54,49,99,35,165,19,37,87,33,251,53,140,73,58,63,80,52,
+62,57,86,46,26,156,104,246,110,199,36,51,104,56,153,38,73,160,176,99,124,
+230,116,129,125,38,48,149,99,77,107,58,64,53,49,3,100,69,251,219,20,47,39,
+2,21,108,124,60,85,88,66,119,0,2,255,218,255,252,4,37,4,211,0,46,0,58,0,0,
+37,6,35,34,46,2,53,52,54,55,46,2,53,53,6,7,39,54,51,50,22,4,23,54,53,52,39,
+55,22,22,21,20,6,6,7,14,2,21,20,22,51,50,54,55,3,38,38,39,22,21,21,20,22,
+51,50,54,4,37,190,206,73,150,144,78,85,78,40,93,31,83,98,76,64,88,66,110,
+1,53,197,65,111,55,90,108,110,153,121,86,97,64,107,73,100,215,96,236,83,218,
+54,14,42,75,40,137,139,143,42,122,119,74,73,101,39,34,113,102,103,177,8,37,
+156,29,52,234,169,68,105,123,91,66,61,177,114,111,150,88,51,36,50,70,47,76,
+71,79,75,1,184,73,178,40,45,87,59,127,65,60,0,3,255,218,255,253,4,97,4,211,
+0,38,0,50,0,66,0,0,1,20,6,6,35,34,39,38,38,53,52,54,55,46,2,53,53,6,7,39,
+54,51,50,22,4,23,54,53,52,39,55,22,22,21,20,7,22,22,1,21,20,22,51,50,54,55,
+38,38,39,22,1,52,39,6,6,7,14,2,21,20,22,51,50,54,54,4,97,105,199,134,201,
+133,68,61,85,78,40,93,31,83,98,76,64,88,66,110,1,53,197,65,111,55,90,108,
+77,97,98,253,33,59,40,50,144,48,83,218,54,14,2,61,99,47,112,83,85,98,64,121,
+80,110,177,100,1,76,90,154,91,121,63,104,68,73,101,39,34,113,102,103,177,
+8,37,156,29,52,234,169,68,105,123,91,66,61,177,114,125,90,75,174,1,211,126,
+80,50,64,33,73,178,40,45,253,203,114,85,36,54,35,35,51,71,46,78,68,75,127,
+0,2,0,61,255,238,8,33,4,230,0,31,0,78,0,0,37,6,35,34,38,38,53,17,1,39,1,38,
+38,35,34,7,39,54,54,51,50,22,23,55,17,23,17,20,51,50,54,55,37,22,22,51,55,
+7,34,38,39,7,34,38,53,52,54,51,50,22,23,54,54,53,52,38,35,34,7,39,54,51,50,
+22,22,21,20,7,22,51,50,55,23,6,6,35,34,39,6,8,33,75,75,65,145,66,253,204,
+100,2,50,90,150,85,140,173,65,73,176,85,125,208,116,22,165,19,37,87,33,249,
+184,51,190,170,31,65,162,237,82,33,82,108,71,51,36,74,27,122,144,112,93,87,
+93,91,83,93,113,181,144,36,24,35,208,112,70,35,143,89,121,103,93,52,62,98,
+92,76,1,62,254,189,152,1,35,123,96,79,169,37,40,144,201,11,1,252,69,251,219,
+20,47,39,240,123,141,1,185,244,182,1,86,65,51,57,42,32,40,159,92,80,98,39,
+172,29,111,193,106,77,69,5,119,153,33,58,66,117,0,2,0,140,255,72,5,214,4,
+198,0,61,0,72,0,0,37,6,35,34,38,38,53,17,38,39,17,20,6,35,34,38,38,53,52,
+55,6,6,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,54,51,50,23,23,38,35,
+34,6,21,20,23,54,51,50,4,23,17,20,51,50,54,55,1,39,34,7,17,20,22,51,50,54,
+53,5,214,71,73,65,137,64,80,66,88,76,60,138,102,33,96,112,89,128,92,43,125,
+174,126,106,96,61,75,200,168,116,141,25,117,113,115,151,73,89,102,161,1,63,
+139,18,36,83,33,253,140,74,47,33,43,32,34,45,50,60,93,89,74,1,43,24,13,254,
+186,93,76,92,133,83,96,81,35,139,104,99,148,99,51,81,66,128,208,144,109,166,
+49,44,131,78,129,154,29,166,27,92,97,80,63,25,87,77,254,48,19,45,38,1,163,
+3,5,254,227,45,47,46,44,0,1,0,140,255,72,5,122,4,198,0,68,0,0,37,6,35,34,
+38,38,53,53,35,34,6,6,21,21,20,35,34,38,53,52,54,51,50,23,53,38,35,34,6,21,
+20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,
+23,54,51,50,4,23,17,20,51,50,54,55,5,122,71,73,65,137,64,101,43,37,9,79,70,
+125,70,82,130,182,146,135,190,222,89,128,92,43,125,174,126,106,96,61,75,200,
+168,116,141,25,117,113,115,151,73,89,102,137,1,15,119,18,36,83,33,50,60,93,
+89,74,27,15,26,27,19,89,146,73,53,55,45,189,37,168,143,99,148,99,51,81,66,
+128,208,144,109,166,49,44,131,78,129,154,29,166,27,92,97,80,63,25,72,64,254,
+20,19,45,38,0,0,1,0,140,255,72,6,66,4,230,0,68,0,0,37,6,35,34,38,38,53,53,
+33,21,20,35,34,38,53,52,55,53,52,38,38,35,34,6,21,20,22,22,23,7,46,2,53,52,
+54,55,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,54,51,50,22,22,23,22,
+23,17,23,17,20,51,50,54,55,6,66,71,73,65,137,64,254,242,79,69,126,118,12,
+49,74,144,188,89,128,92,43,125,175,125,100,93,57,70,200,168,116,141,25,117,
+113,115,151,65,67,83,71,140,127,9,159,111,159,18,36,83,33,50,60,93,89,74,
+27,58,89,125,65,96,11,99,43,29,7,172,135,99,149,98,51,81,66,128,207,145,111,
+171,49,44,127,75,129,154,29,166,27,92,97,77,60,19,70,162,99,15,27,3,112,67,
+251,212,19,45,38,0,1,0,140,255,72,6,66,4,230,0,70,0,0,37,6,35,34,38,39,6,
+35,34,38,39,36,53,52,35,34,6,6,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,
+52,54,51,50,23,23,38,35,34,6,21,20,23,54,51,50,22,21,20,6,7,6,21,20,22,51,
+50,54,55,17,23,17,20,51,50,54,55,6,66,71,73,68,146,25,104,131,140,197,72,
+1,36,180,93,179,116,89,128,92,43,125,175,125,101,89,56,68,200,168,116,141,
+25,117,113,115,151,57,94,107,176,205,74,129,23,75,42,92,155,55,159,18,36,
+83,33,50,60,104,42,87,165,130,93,100,91,74,151,109,99,149,98,51,81,66,128,
+207,145,106,172,55,44,126,74,129,154,29,166,27,92,97,73,55,34,207,108,47,
+78,68,13,17,29,21,68,54,3,181,67,251,212,19,45,38,0,0,2,0,140,254,248,5,214,
+4,198,0,53,0,72,0,0,37,6,35,34,38,38,53,53,5,39,37,53,38,35,34,6,6,21,20,
+22,23,7,46,2,53,52,55,38,38,53,52,54,51,50,23,23,38,35,34,6,21,20,23,54,51,
+32,5,17,20,51,50,54,55,5,23,6,6,35,34,38,53,52,54,55,23,6,21,20,22,51,50,
+54,5,214,71,73,65,137,64,254,222,57,1,91,182,163,114,201,126,185,136,53,109,
+180,137,185,54,65,200,168,116,141,25,117,113,115,151,50,115,135,1,25,1,46,
+18,36,83,33,254,54,75,30,99,50,156,202,158,134,66,238,94,72,45,96,10,60,93,
+89,74,33,104,130,123,211,52,82,170,125,165,220,82,71,63,147,238,157,235,123,
+44,123,73,129,154,29,166,27,92,97,68,53,47,152,253,208,19,45,38,44,125,21,
+28,209,127,110,154,24,134,64,159,62,82,27,0,1,0,140,254,248,5,142,4,198,0,
+71,0,0,37,6,35,34,38,39,6,6,35,34,38,38,53,52,54,51,23,23,39,34,6,21,20,22,
+51,50,54,55,17,38,35,34,6,6,21,20,22,23,7,46,2,53,52,54,55,38,53,52,54,51,
+50,23,23,38,35,34,6,21,20,23,54,51,50,4,23,17,20,51,50,54,55,5,142,71,73,
+62,126,38,40,118,68,77,152,87,146,113,45,47,34,81,102,69,55,59,133,52,153,
+149,107,188,117,185,136,53,109,180,137,96,85,115,200,168,116,141,25,117,113,
+115,151,46,102,123,140,1,1,143,18,36,83,33,11,60,82,45,48,58,103,146,65,91,
+116,2,153,1,77,57,48,50,77,70,1,92,49,82,170,125,165,220,82,71,63,147,238,
+157,122,182,57,100,137,129,154,29,166,27,92,97,66,51,43,74,77,253,208,19,
+45,38,0,1,0,95,255,246,8,67,4,230,0,76,0,0,37,6,35,34,38,38,53,53,6,35,34,
+38,39,36,53,52,38,35,34,6,21,20,23,22,21,20,6,35,34,46,2,53,52,54,55,23,6,
+6,21,20,22,51,50,54,53,52,39,38,53,52,54,54,51,50,22,21,20,6,6,7,6,21,20,
+22,51,50,54,55,17,23,17,20,51,50,54,55,8,67,75,75,65,145,66,100,120,171,242,
+87,1,59,102,112,135,158,6,7,152,109,83,147,143,61,132,119,79,95,96,111,95,
+84,99,5,6,108,172,99,201,226,49,94,85,22,123,84,94,162,58,165,19,37,87,33,
+52,62,98,92,76,130,59,205,161,131,145,61,47,115,122,49,84,80,69,103,140,62,
+156,164,94,141,220,67,165,64,163,114,121,141,100,81,54,55,78,77,113,145,65,
+224,105,56,88,78,56,15,20,44,72,65,52,2,164,69,251,219,20,47,39,0,255,255,
+0,113,254,129,3,205,4,210,2,38,0,35,0,0,0,7,0,75,4,27,0,0,255,255,255,218,
+255,213,6,103,4,230,2,38,0,36,0,0,0,7,0,75,4,56,1,84,255,255,0,32,255,246,
+5,54,4,230,2,38,0,37,0,0,0,7,0,75,3,155,1,141,255,255,0,104,255,87,5,8,4,
+230,2,38,0,38,0,0,0,7,0,75,4,19,0,214,255,255,0,71,254,129,4,25,4,210,0,38,
+0,47,254,0,0,39,0,75,5,183,4,38,0,7,0,75,4,47,0,0,255,255,0,71,255,149,5,
+67,4,230,2,38,0,40,0,0,0,7,0,75,4,27,1,20,255,255,0,110,254,129,5,30,4,221,
+2,38,0,41,0,0,0,7,0,75,4,177,0,0,255,255,0,45,254,129,5,173,4,227,2,38,0,
+42,0,0,0,7,0,75,5,134,0,0,255,255,0,65,255,73,5,82,4,230,2,38,0,43,0,0,0,
+7,0,75,3,192,0,200,255,255,0,32,255,246,5,199,4,230,2,38,0,44,0,0,0,7,0,75,
+3,154,1,127,255,255,0,128,254,129,3,201,4,200,2,38,0,45,0,0,0,7,0,75,4,28,
+0,0,255,255,0,108,254,129,3,202,4,210,2,38,0,46,0,0,0,7,0,75,4,84,0,0,255,
+255,0,73,254,129,3,188,4,210,2,38,0,47,0,0,0,7,0,75,4,29,0,0,255,255,0,110,
+254,129,3,255,4,205,2,38,0,48,0,0,0,7,0,75,4,41,0,0,255,255,0,175,254,108,
+6,198,4,230,2,38,0,49,0,0,0,7,0,75,4,129,0,0,255,255,0,114,254,130,4,174,
+4,230,2,38,0,50,0,0,0,7,0,75,3,221,0,1,255,255,0,69,255,123,4,243,4,230,2,
+38,0,51,0,0,0,7,0,75,4,9,0,250,255,255,0,117,254,129,3,173,4,201,2,38,0,52,
+0,0,0,7,0,75,4,12,0,0,255,255,0,117,255,73,4,229,5,82,2,38,0,53,0,0,0,7,0,
+75,4,19,0,200,255,255,0,55,255,246,4,143,4,230,2,38,0,54,0,0,0,7,0,75,3,31,
+1,157,255,255,255,218,255,246,4,172,4,230,2,38,0,55,0,0,0,7,0,75,3,61,1,127,
+255,255,0,133,254,3,3,187,4,210,2,38,0,56,0,0,0,7,0,75,3,57,255,130,255,255,
+0,87,255,173,5,244,4,230,2,38,0,57,0,0,0,7,0,75,4,179,1,44,255,255,0,90,255,
+203,6,79,4,230,2,38,0,58,0,0,0,7,0,75,4,244,1,74,255,255,0,36,255,155,4,249,
+4,230,2,38,0,59,0,0,0,7,0,75,3,130,1,26,255,255,0,69,255,187,4,226,4,230,
+2,38,0,60,0,0,0,7,0,75,3,199,1,58,255,255,0,78,255,17,3,123,4,199,2,38,0,
+61,0,0,0,7,0,75,3,140,0,144,255,255,0,95,255,11,5,112,4,230,2,38,0,62,0,0,
+0,7,0,75,4,49,0,138,255,255,0,87,255,189,4,195,4,230,2,38,0,63,0,0,0,7,0,
+75,3,215,1,60,255,255,0,90,255,17,6,3,4,230,2,38,0,64,0,0,0,7,0,75,3,140,
+0,144,255,255,255,218,255,246,4,212,4,230,2,38,0,65,0,0,0,7,0,75,3,61,1,127,
+255,255,0,61,255,17,5,165,4,230,2,38,0,66,0,0,0,7,0,75,3,120,0,144,255,255,
+0,110,254,127,4,135,4,208,2,38,0,67,0,0,0,7,0,75,4,131,255,254,255,255,0,
+95,255,179,5,252,4,198,2,38,0,68,0,0,0,7,0,75,4,173,1,50,255,255,0,113,254,
+129,4,137,4,210,2,38,0,109,0,0,0,7,0,75,4,27,0,0,255,255,255,218,255,213,
+5,52,4,210,2,38,0,110,0,0,0,7,0,75,4,56,1,84,255,255,0,32,0,14,2,219,4,210,
+2,38,0,111,0,0,0,7,0,75,3,155,1,141,255,255,0,104,255,87,4,32,4,221,2,38,
+0,112,0,0,0,7,0,75,4,19,0,214,255,255,0,71,255,149,4,49,4,209,2,38,0,113,
+0,0,0,7,0,75,4,27,1,20,255,255,0,45,254,129,5,252,4,207,2,38,0,114,0,0,0,
+7,0,75,5,134,0,0,255,255,0,32,0,0,4,159,4,210,2,38,0,115,0,0,0,7,0,75,3,154,
+1,127,255,255,0,175,254,108,4,150,4,230,2,38,0,116,0,0,0,7,0,75,4,129,0,0,
+255,255,0,114,254,130,3,127,3,121,2,38,0,117,0,0,0,7,0,75,3,221,0,1,255,255,
+0,69,255,123,4,33,4,205,2,38,0,118,0,0,0,7,0,75,4,9,0,250,255,255,0,117,255,
+73,4,27,5,82,2,38,0,119,0,0,0,7,0,75,4,19,0,200,255,255,0,55,0,30,3,68,3,
+50,2,38,0,120,0,0,0,7,0,75,3,31,1,157,255,255,255,218,0,0,3,140,4,210,2,38,
+0,121,0,0,0,7,0,75,3,61,1,127,255,255,0,133,254,3,4,131,4,210,2,38,0,122,
+0,0,0,7,0,75,3,75,255,130,255,255,0,87,255,173,4,218,4,224,2,38,0,123,0,0,
+0,7,0,75,4,179,1,44,255,255,0,90,255,203,5,37,4,202,2,38,0,124,0,0,0,7,0,
+75,4,244,1,74,255,255,0,36,255,155,3,176,4,210,2,38,0,125,0,0,0,7,0,75,3,
+130,1,26,255,255,0,69,255,187,3,216,4,207,2,38,0,126,0,0,0,7,0,75,3,199,1,
+58,255,255,0,95,255,11,4,44,4,200,2,38,0,127,0,0,0,7,0,75,4,49,0,138,255,
+255,0,87,255,189,3,156,4,98,2,38,0,128,0,0,0,7,0,75,3,215,1,60,255,255,0,
+90,255,17,3,134,4,196,2,38,0,129,0,0,0,7,0,75,3,140,0,144,255,255,255,218,
+0,0,3,211,4,211,2,38,0,130,0,0,0,7,0,75,3,61,1,127,255,255,0,61,255,17,4,
+110,4,199,2,38,0,131,0,0,0,7,0,75,3,120,0,144,255,255,0,140,254,3,4,57,4,
+198,2,38,0,132,0,0,0,7,0,75,3,180,255,130,255,255,0,95,255,179,4,52,4,198,
+2,38,0,133,0,0,0,7,0,75,4,173,1,50,255,255,0,113,254,129,3,205,4,210,2,38,
+0,136,0,0,0,7,0,75,4,27,0,0,255,255,255,218,254,126,6,103,4,230,2,38,0,137,
+0,0,0,7,0,75,4,56,255,253,255,255,0,32,254,144,5,54,4,230,2,38,0,138,0,0,
+0,7,0,75,3,155,0,15,255,255,0,104,254,178,5,8,4,230,2,38,0,139,0,0,0,7,0,
+75,4,19,0,49,255,255,0,71,254,145,5,67,4,230,2,38,0,140,0,0,0,7,0,75,4,27,
+0,16,255,255,0,45,254,129,6,57,4,224,2,38,0,141,0,0,0,7,0,75,6,18,0,0,255,
+255,0,64,255,153,5,81,4,230,2,38,0,142,0,0,0,7,0,75,3,192,1,24,255,255,0,
+32,254,143,5,199,4,230,2,38,0,143,0,0,0,7,0,75,3,154,0,14,255,255,0,175,254,
+115,6,198,4,230,2,38,0,144,0,0,0,7,0,75,3,241,255,242,255,255,0,20,255,148,
+4,227,4,230,2,38,0,145,0,0,0,7,0,75,3,221,1,19,255,255,0,69,254,203,4,243,
+4,230,2,38,0,146,0,0,0,7,0,75,4,9,0,74,255,255,0,96,254,90,3,255,4,223,2,
+38,0,147,0,0,0,7,0,75,4,94,255,217,255,255,0,117,254,176,4,229,5,82,2,38,
+0,148,0,0,0,7,0,75,4,19,0,47,255,255,0,55,254,124,4,143,4,230,2,38,0,149,
+0,0,0,7,0,75,3,31,255,251,255,255,255,218,254,144,4,172,4,230,2,38,0,150,
+0,0,0,7,0,75,3,121,0,15,255,255,0,95,254,54,3,187,4,210,2,38,0,151,0,0,0,
+7,0,75,3,75,255,181,255,255,0,87,254,139,5,244,4,230,2,38,0,152,0,0,0,7,0,
+75,3,198,0,10,255,255,0,90,254,124,6,79,4,230,2,38,0,153,0,0,0,7,0,75,4,36,
+255,251,255,255,0,36,254,114,4,249,4,230,2,38,0,154,0,0,0,7,0,75,3,130,255,
+241,255,255,0,69,254,210,4,226,4,230,2,38,0,155,0,0,0,7,0,75,3,199,0,81,255,
+255,0,95,254,60,5,112,4,230,2,38,0,156,0,0,0,7,0,75,3,209,255,187,255,255,
+0,87,254,178,4,195,4,230,2,38,0,157,0,0,0,7,0,75,3,206,0,49,255,255,0,69,
+254,134,5,126,4,230,2,38,0,158,0,0,0,7,0,75,3,173,0,5,255,255,255,218,254,
+127,4,212,4,230,2,38,0,159,0,0,0,7,0,75,3,61,255,254,255,255,0,61,255,17,
+6,9,4,230,2,38,0,160,0,0,0,7,0,75,3,120,0,144,255,255,0,140,254,3,4,96,4,
+198,2,38,0,161,0,0,0,7,0,75,3,180,255,130,255,255,0,95,254,135,5,252,4,198,
+2,38,0,162,0,0,0,7,0,75,4,173,0,6,255,255,0,113,254,129,4,137,4,210,2,38,
+0,165,0,0,0,7,0,75,4,27,0,0,255,255,255,218,254,126,5,148,4,210,2,38,0,166,
+0,0,0,7,0,75,4,56,255,253,255,255,0,32,254,144,4,120,4,210,2,38,0,167,0,0,
+0,7,0,75,3,155,0,15,255,255,0,104,254,178,4,22,4,221,2,38,0,168,0,0,0,7,0,
+75,4,19,0,49,255,255,0,71,254,145,4,49,4,209,2,38,0,169,0,0,0,7,0,75,4,27,
+0,16,255,255,0,45,254,129,6,135,4,207,0,38,0,170,0,0,0,7,0,75,6,19,0,0,255,
+255,0,32,254,143,4,232,4,210,2,38,0,171,0,0,0,7,0,75,3,154,0,14,255,255,0,
+175,254,115,5,205,4,230,2,38,0,172,0,0,0,7,0,75,3,241,255,242,255,255,0,20,
+255,148,3,103,4,56,2,38,0,173,0,0,0,7,0,75,3,221,1,19,255,255,0,69,254,203,
+4,31,4,205,2,38,0,174,0,0,0,7,0,75,4,9,0,74,255,255,0,117,254,176,4,24,5,
+82,2,38,0,175,0,0,0,7,0,75,4,19,0,47,255,255,0,55,254,124,3,175,3,50,2,38,
+0,176,0,0,0,7,0,75,3,31,255,251,255,255,255,218,254,144,3,143,4,210,2,38,
+0,177,0,0,0,7,0,75,3,121,0,15,255,255,0,95,254,54,4,129,4,210,2,38,0,178,
+0,0,0,7,0,75,3,75,255,181,255,255,0,87,254,139,5,18,4,224,2,38,0,179,0,0,
+0,7,0,75,3,198,0,10,255,255,0,90,254,124,5,101,4,202,2,38,0,180,0,0,0,7,0,
+75,4,36,255,251,255,255,0,36,254,114,4,39,4,210,2,38,0,181,0,0,0,7,0,75,3,
+130,255,241,255,255,0,69,254,210,3,219,4,207,2,38,0,182,0,0,0,7,0,75,3,199,
+0,81,255,255,0,95,254,60,4,146,4,200,2,38,0,183,0,0,0,7,0,75,3,209,255,187,
+255,255,0,87,254,178,3,149,4,98,2,38,0,184,0,0,0,7,0,75,3,206,0,49,255,255,
+0,69,254,134,4,122,4,202,2,38,0,185,0,0,0,7,0,75,3,173,0,5,255,255,255,218,
+254,127,3,215,4,211,2,38,0,186,0,0,0,7,0,75,3,61,255,254,255,255,0,61,255,
+17,4,169,4,199,2,38,0,187,0,0,0,7,0,75,3,120,0,144,255,255,0,95,254,135,4,
+247,4,198,2,38,0,188,0,0,0,7,0,75,4,173,0,6,255,255,254,76,5,20,0,59,7,44,
+2,34,1,217,0,0,0,2,0,107,0,0,255,255,254,114,255,246,2,90,7,40,2,38,0,22,
+0,0,0,7,0,71,2,174,0,81,0,1,254,114,255,246,2,133,7,44,0,47,0,0,37,23,6,35,
+34,38,38,53,17,52,38,35,34,6,21,20,22,23,7,38,38,53,52,54,51,50,23,54,54,
+51,50,22,23,23,38,35,34,6,21,20,23,22,21,17,20,51,50,54,2,5,85,75,75,65,145,
+66,135,114,75,91,30,25,58,64,92,134,112,169,165,16,144,108,44,85,20,46,70,
+83,90,108,18,29,19,37,87,190,138,62,98,92,76,3,243,188,225,101,81,48,94,32,
+19,44,149,90,110,134,191,93,102,17,8,156,27,89,89,35,59,87,92,251,173,20,
+47,0,255,255,254,114,255,246,2,133,7,44,2,34,1,218,0,0,0,2,1,93,0,0,255,255,
+252,222,5,33,0,5,7,44,2,38,0,29,0,0,0,7,0,71,0,153,0,51,0,1,252,222,5,33,
+0,89,7,44,0,27,0,0,1,20,23,23,35,39,38,38,35,34,7,39,54,51,50,22,23,54,54,
+51,50,22,23,23,38,35,34,6,254,250,25,43,87,135,36,80,58,67,72,73,82,81,92,
+135,56,22,136,92,44,85,20,46,70,83,90,108,5,234,63,51,87,241,64,53,23,160,
+28,93,103,85,111,17,8,156,27,84,255,255,252,222,5,33,0,89,7,44,2,34,1,96,
+0,0,0,3,1,218,253,212,0,0,255,255,252,42,5,4,0,38,7,40,2,38,0,30,0,0,0,7,
+0,71,0,186,0,51,0,2,252,42,5,4,0,100,7,44,0,27,0,42,0,0,3,20,22,23,23,35,
+46,2,35,34,7,39,54,51,50,22,23,54,54,51,50,23,23,38,35,34,6,37,50,22,22,23,
+23,7,39,38,38,35,34,7,39,54,251,20,21,21,78,62,73,90,68,44,61,48,59,62,87,
+128,48,19,138,87,78,61,46,70,83,90,108,253,226,61,110,97,84,80,42,49,110,
+114,49,81,67,109,103,5,234,31,65,50,55,150,139,71,16,158,17,78,90,83,89,25,
+156,27,84,4,48,76,74,71,49,36,80,51,42,133,60,0,255,255,252,42,5,4,0,100,
+7,44,2,34,1,99,0,0,0,3,1,218,253,229,0,0,255,255,253,24,5,77,0,31,7,44,2,
+38,0,33,0,0,0,7,0,71,255,255,0,131,0,1,251,240,5,20,0,59,7,44,0,29,0,0,1,
+20,22,23,35,38,39,6,35,34,37,55,22,22,51,50,55,38,53,52,54,51,50,22,23,23,
+38,35,34,6,254,220,62,55,103,47,38,86,98,230,254,249,47,112,176,80,115,80,
+6,163,137,44,85,20,46,70,83,90,108,5,234,58,98,58,37,53,33,248,53,93,74,39,
+29,27,114,136,17,8,156,27,84,0,255,255,251,240,5,20,0,59,7,44,2,34,1,102,
+0,0,0,3,1,218,253,202,0,0,0,3,0,45,255,246,7,99,4,230,0,47,0,60,0,72,0,0,
+37,6,35,34,38,38,53,17,6,7,22,21,20,6,35,34,38,38,53,52,54,55,38,39,22,21,
+20,6,35,34,38,53,52,54,51,50,4,23,54,36,55,23,17,20,51,50,54,55,1,34,6,21,
+20,22,51,50,54,53,52,39,38,1,7,6,6,21,20,22,51,50,54,53,52,7,99,75,75,65,
+145,66,176,218,184,167,137,94,175,91,138,162,123,146,40,149,132,132,204,192,
+159,141,1,23,152,130,1,14,97,165,19,37,87,33,250,175,117,148,82,63,92,116,
+21,32,1,252,5,136,111,89,72,89,104,52,62,98,92,76,3,47,107,191,245,212,149,
+177,118,147,88,119,221,147,141,69,77,89,128,148,202,127,137,167,160,171,113,
+191,50,69,251,219,20,47,39,3,127,123,96,64,86,136,108,57,61,7,254,126,5,125,
+187,87,87,94,148,121,150,0,0,3,0,45,255,246,7,239,4,230,0,53,0,64,0,75,0,
+0,37,6,35,34,38,38,53,17,6,7,22,22,21,20,6,35,34,38,38,53,52,54,54,55,38,
+39,1,39,1,38,39,22,21,20,6,35,34,38,53,52,54,51,50,4,23,54,37,23,17,20,51,
+50,54,55,1,52,39,6,6,21,20,22,51,50,54,1,52,39,6,6,21,20,22,51,50,54,7,239,
+75,75,65,145,66,188,207,94,91,161,132,104,164,97,38,81,172,34,38,254,119,
+119,1,152,161,158,40,139,102,117,170,192,159,182,1,106,166,218,1,25,165,19,
+37,87,33,250,34,12,111,141,55,41,74,94,3,18,104,149,98,91,74,84,102,52,62,
+98,92,76,3,38,128,191,119,211,106,145,172,106,154,83,61,107,114,172,36,33,
+254,91,111,1,136,111,28,79,97,110,153,171,118,137,167,191,176,207,183,69,
+251,219,20,47,39,3,29,50,48,3,121,95,50,60,127,253,250,145,154,142,157,83,
+77,91,138,0,255,255,0,45,254,129,7,99,4,230,2,38,1,104,0,0,0,7,0,75,5,134,
+0,0,255,255,0,45,254,129,7,239,4,230,2,38,1,105,0,0,0,7,0,75,6,49,0,0,0,3,
+0,45,254,212,6,199,4,207,0,51,0,64,0,74,0,0,1,20,2,4,35,34,0,39,55,22,4,51,
+50,36,18,53,52,2,39,6,7,22,21,20,6,35,34,38,53,52,55,38,39,22,21,20,6,35,
+34,38,53,52,54,51,50,4,23,54,54,55,22,18,1,34,6,21,20,22,51,50,54,53,52,39,
+38,1,52,39,6,21,20,22,51,50,54,6,199,199,254,199,169,236,254,90,129,82,109,
+1,64,217,147,1,5,166,82,78,168,173,164,140,120,122,209,244,119,144,40,149,
+132,135,201,192,159,139,1,17,150,116,250,58,153,200,250,246,117,148,82,63,
+92,116,21,40,2,83,78,199,71,57,66,83,1,100,216,254,216,144,1,11,230,57,180,
+233,123,1,17,211,151,1,59,127,107,155,215,184,118,140,194,117,170,239,131,
+67,77,89,128,148,197,132,137,167,155,166,102,174,31,155,254,30,1,249,123,
+96,64,86,136,108,57,61,7,253,130,123,133,199,122,61,74,106,0,3,0,45,254,212,
+7,106,4,207,0,55,0,66,0,76,0,0,1,20,2,4,35,34,0,39,55,22,4,51,50,36,18,53,
+52,2,39,6,7,22,21,20,6,35,34,38,53,52,55,39,1,39,1,38,39,22,21,20,6,35,34,
+38,53,52,54,51,50,4,23,54,54,55,22,18,1,52,39,6,6,21,20,22,51,50,54,1,52,
+39,6,21,20,22,51,50,54,7,106,199,254,199,169,236,254,90,129,82,109,1,64,217,
+147,1,5,166,82,78,172,167,162,140,120,122,209,236,58,254,93,119,1,173,170,
+171,41,139,102,117,170,192,159,183,1,115,168,116,251,60,153,200,250,82,12,
+111,141,55,41,74,94,3,18,80,197,71,57,66,83,1,100,216,254,216,144,1,11,230,
+57,180,233,123,1,17,211,151,1,59,127,110,151,205,195,118,140,194,117,167,
+234,50,254,63,111,1,156,99,22,82,96,110,153,171,118,137,167,160,164,103,175,
+32,155,254,30,1,151,50,48,3,121,95,50,60,127,254,76,130,125,201,119,61,74,
+106,255,255,0,45,254,84,6,199,4,207,2,38,1,108,0,0,0,7,0,75,3,136,255,211,
+255,255,0,45,254,84,7,106,4,207,2,38,1,109,0,0,0,7,0,75,4,43,255,211,0,1,
+0,78,255,238,4,253,4,199,0,57,0,0,1,20,6,7,39,54,54,53,52,38,35,34,6,6,7,
+6,6,7,22,22,51,55,7,34,38,38,39,7,34,38,53,52,54,51,50,22,23,54,54,53,52,
+38,35,34,7,39,54,51,50,22,22,21,7,54,51,50,22,22,4,253,115,102,87,79,98,88,
+64,65,107,85,63,78,114,75,55,211,185,29,65,129,200,132,59,38,82,108,71,51,
+36,74,27,141,168,112,93,106,110,91,103,109,111,177,141,2,81,93,79,142,109,
+1,246,88,147,30,145,26,102,63,59,62,35,52,46,56,68,24,114,133,2,186,124,175,
+110,2,84,65,51,57,42,32,43,170,98,80,98,43,172,33,106,185,100,36,45,83,178,
+0,0,1,0,130,254,201,3,150,4,198,0,55,0,0,1,6,6,35,34,38,39,38,38,53,52,54,
+51,50,23,22,51,50,54,53,52,39,6,7,39,54,54,53,52,38,35,34,6,7,39,54,51,50,
+22,22,21,20,7,22,22,21,20,6,6,35,39,22,22,51,50,55,3,150,28,92,52,126,194,
+54,114,128,61,44,117,62,16,22,118,147,99,73,126,80,188,180,86,68,66,127,77,
+77,122,142,84,161,119,137,79,96,72,161,127,44,41,112,85,68,56,254,251,21,
+29,177,164,20,106,76,45,60,165,4,118,97,123,89,28,28,164,39,117,71,63,73,
+37,35,164,64,91,193,92,134,79,61,162,93,72,136,91,1,78,78,29,0,0,1,0,120,
+253,237,4,223,4,223,0,61,0,0,1,6,35,34,38,53,52,54,55,39,6,35,34,38,38,53,
+52,54,54,55,62,2,53,52,39,55,22,21,20,6,6,7,14,2,21,20,22,51,50,55,38,53,
+52,54,51,50,22,21,20,7,23,14,2,21,20,22,51,50,55,4,223,135,150,147,241,93,
+86,35,36,55,122,235,150,103,143,111,74,82,54,52,70,136,73,107,91,97,114,80,
+130,101,95,54,13,67,51,67,101,116,157,52,123,89,88,81,133,125,254,80,99,231,
+118,75,122,29,100,6,96,179,117,98,143,91,53,36,47,58,35,49,50,57,111,110,
+66,96,65,43,46,71,109,76,85,108,29,35,41,52,66,102,68,95,55,240,1,35,79,61,
+62,77,89,0,0,1,0,140,255,12,4,106,4,198,0,63,0,0,37,6,35,34,38,53,52,54,55,
+54,54,53,52,35,34,6,6,21,20,22,22,23,7,46,2,53,52,54,55,38,38,53,52,54,51,
+50,23,23,38,35,34,6,21,20,23,54,51,50,22,22,21,20,6,7,6,6,21,20,22,51,50,
+54,55,4,106,98,144,116,230,56,50,33,30,81,82,152,95,111,159,105,43,139,205,
+149,101,88,56,67,200,168,95,120,25,93,95,115,151,59,58,68,78,140,91,43,41,
+42,41,49,45,60,117,46,136,121,180,105,54,83,49,32,39,19,39,77,146,98,114,
+174,115,54,81,70,143,233,160,106,176,51,45,125,74,129,154,22,166,20,92,97,
+74,57,18,69,127,66,37,61,40,42,58,35,36,42,56,57,0,1,0,175,255,246,4,82,7,
+40,0,26,0,0,19,17,16,18,51,50,0,23,7,38,38,35,34,6,21,17,20,51,50,54,55,23,
+6,35,34,38,38,175,193,199,178,1,15,90,87,89,212,117,138,123,19,37,87,33,85,
+75,75,65,145,66,1,0,3,236,1,35,1,25,254,229,196,47,182,197,216,252,251,187,
+20,47,39,138,62,98,92,0,0,1,0,175,255,246,5,10,7,40,0,26,0,0,19,17,16,18,
+51,50,0,23,7,38,36,35,34,6,21,17,20,51,50,54,55,23,6,35,34,38,38,175,233,
+232,214,1,70,110,87,112,254,243,148,179,155,19,37,87,33,85,75,75,65,145,66,
+1,0,3,236,1,22,1,38,254,230,197,47,182,197,238,230,251,187,20,47,39,138,62,
+98,92,0,1,0,175,255,246,5,193,7,40,0,27,0,0,19,17,16,0,51,50,4,22,23,7,38,
+36,35,34,6,21,17,20,51,50,54,55,23,6,35,34,38,38,175,1,37,248,182,1,62,188,
+69,74,139,254,212,174,207,239,19,37,87,33,85,75,75,65,145,66,1,0,3,236,1,
+5,1,55,184,194,89,59,172,203,246,218,251,187,20,47,39,138,62,98,92,0,0,1,
+0,175,255,246,6,112,7,40,0,28,0,0,19,17,52,18,36,51,50,4,22,23,7,38,36,35,
+34,6,21,17,20,51,50,54,55,23,6,35,34,38,38,175,134,1,1,177,215,1,123,232,
+79,71,174,254,138,216,220,253,19,37,87,33,85,75,75,65,145,66,1,0,3,236,167,
+1,3,146,181,197,86,62,172,203,247,217,251,187,20,47,39,138,62,98,92,0,0,1,
+0,175,255,246,7,53,7,40,0,27,0,0,19,17,52,18,36,51,32,0,23,7,38,36,33,34,
+4,21,17,20,51,50,54,55,23,6,35,34,38,38,175,140,1,12,185,1,101,2,35,173,64,
+213,254,50,254,244,231,254,245,19,37,87,33,85,75,75,65,145,66,1,0,3,236,167,
+1,3,146,254,210,156,68,172,203,246,218,251,187,20,47,39,138,62,98,92,0,1,
+0,175,255,246,7,237,7,40,0,28,0,0,19,17,52,18,36,51,32,4,4,23,7,38,36,33,
+34,4,21,17,20,51,50,54,55,23,6,35,34,38,38,175,151,1,34,200,1,11,1,238,1,
+84,112,55,240,253,213,254,219,254,254,220,19,37,87,33,85,75,75,65,145,66,
+1,0,3,236,167,1,3,146,166,199,86,75,168,207,247,217,251,187,20,47,39,138,
+62,98,92,0,0,1,0,175,255,246,8,171,7,40,0,28,0,0,19,17,52,18,36,51,32,4,4,
+23,7,36,36,33,34,4,21,17,20,51,50,54,55,23,6,35,34,38,38,175,145,1,22,191,
+1,50,2,93,1,162,101,46,254,216,253,83,254,179,241,254,234,19,37,87,33,85,
+75,75,65,145,66,1,0,3,236,166,1,4,146,181,205,66,75,159,217,247,217,251,187,
+20,47,39,138,62,98,92,255,255,0,175,255,246,5,36,7,40,2,38,1,116,0,0,0,7,
+0,71,5,184,0,51,255,255,0,175,255,246,5,199,7,40,2,38,1,117,0,0,0,7,0,71,
+6,91,0,51,255,255,0,175,255,246,6,103,7,40,2,38,1,118,0,0,0,7,0,71,6,251,
+0,51,255,255,0,175,255,246,7,9,7,40,2,38,1,119,0,0,0,7,0,71,7,157,0,51,255,
+255,0,175,255,246,7,192,7,40,2,38,1,120,0,0,0,7,0,71,8,84,0,51,255,255,0,
+175,255,246,8,111,7,40,2,38,1,121,0,0,0,7,0,71,9,3,0,51,255,255,0,175,255,
+246,9,23,7,40,2,38,1,122,0,0,0,7,0,71,9,171,0,51,0,1,0,175,255,246,5,129,
+7,44,0,39,0,0,1,20,23,7,38,38,35,34,6,21,17,20,51,50,54,55,23,6,35,34,38,
+38,53,17,16,18,51,50,23,54,54,51,50,22,23,23,38,35,34,6,4,33,49,87,89,212,
+117,138,123,19,37,87,33,85,75,75,65,145,66,193,199,211,177,7,140,112,44,85,
+20,46,70,83,98,101,5,230,72,85,47,182,197,216,252,251,187,20,47,39,138,62,
+98,92,76,3,236,1,35,1,25,225,105,124,17,8,156,27,97,0,0,1,0,175,255,246,6,
+53,7,44,0,41,0,0,1,20,22,23,7,38,36,35,34,6,21,17,20,51,50,54,55,23,6,35,
+34,38,38,53,17,16,18,51,32,23,53,52,54,51,50,22,23,23,38,35,34,6,4,213,23,
+30,87,112,254,243,148,179,155,19,37,87,33,85,75,75,65,145,66,233,232,1,13,
+222,143,120,44,85,20,46,70,83,90,109,5,228,41,60,54,47,182,197,238,230,251,
+187,20,47,39,138,62,98,92,76,3,236,1,22,1,38,251,3,115,137,17,8,156,27,95,
+0,0,1,0,175,255,246,6,243,7,44,0,42,0,0,1,20,23,7,38,36,35,34,6,21,17,20,
+51,50,54,55,23,6,35,34,38,38,53,17,16,0,51,50,4,23,38,53,52,54,51,50,22,23,
+23,38,35,34,6,5,148,45,74,139,254,212,174,207,239,19,37,87,33,85,75,75,65,
+145,66,1,37,248,172,1,49,126,6,147,124,44,85,20,46,70,83,90,108,5,234,77,
+72,59,172,203,246,218,251,187,20,47,39,138,62,98,92,76,3,236,1,5,1,55,167,
+124,26,21,113,135,17,8,156,27,84,0,0,1,0,175,255,246,7,164,7,44,0,43,0,0,
+1,20,23,7,38,36,35,34,6,21,17,20,51,50,54,55,23,6,35,34,38,38,53,17,52,18,
+36,51,50,4,23,38,53,52,54,51,50,22,23,23,38,35,34,6,6,69,43,71,174,254,138,
+216,220,253,19,37,87,33,85,75,75,65,145,66,134,1,1,177,216,1,124,153,9,150,
+128,44,85,20,46,70,83,90,108,5,234,76,70,62,172,203,247,217,251,187,20,47,
+39,138,62,98,92,76,3,236,167,1,3,146,182,131,33,34,121,129,17,8,156,27,84,
+0,0,1,0,175,255,246,8,108,7,44,0,43,0,0,1,38,35,34,6,21,20,23,7,38,36,33,
+34,4,21,17,20,51,50,54,55,23,6,35,34,38,38,53,17,52,18,36,51,32,4,23,38,53,
+52,54,51,50,22,23,8,108,70,83,90,108,40,64,213,254,50,254,244,231,254,245,
+19,37,87,33,85,75,75,65,145,66,140,1,12,185,1,15,1,213,184,15,156,128,44,
+85,20,6,119,27,84,84,77,63,68,172,203,246,218,251,187,20,47,39,138,62,98,
+92,76,3,236,167,1,3,146,196,137,44,47,118,128,17,8,0,0,1,0,175,255,246,9,
+41,7,44,0,43,0,0,1,38,35,34,6,21,20,23,7,38,36,33,34,4,21,17,20,51,50,54,
+55,23,6,35,34,38,38,53,17,52,18,36,51,32,4,23,38,53,52,54,51,50,22,23,9,41,
+70,83,90,108,35,55,240,253,213,254,219,254,254,220,19,37,87,33,85,75,75,65,
+145,66,151,1,34,200,1,51,2,40,217,22,151,129,44,85,20,6,119,27,84,84,68,65,
+75,168,207,247,217,251,187,20,47,39,138,62,98,92,76,3,236,167,1,3,146,211,
+142,53,55,113,136,17,8,0,0,1,0,175,255,246,9,218,7,44,0,43,0,0,1,20,23,7,
+36,36,33,34,4,21,17,20,51,50,54,55,23,6,35,34,38,38,53,17,52,18,36,51,32,
+4,5,38,53,52,54,51,50,22,23,23,38,35,34,6,8,123,48,46,254,216,253,83,254,
+179,241,254,234,19,37,87,33,85,75,75,65,145,66,145,1,22,191,1,94,2,164,1,
+6,28,153,125,44,85,20,46,70,83,90,108,5,234,65,69,75,159,217,247,217,251,
+187,20,47,39,138,62,98,92,76,3,236,166,1,4,146,227,142,61,62,112,138,17,8,
+156,27,84,255,255,0,175,255,246,5,129,7,44,2,34,1,130,0,0,0,3,1,218,2,252,
+0,0,255,255,0,175,255,246,6,53,7,44,2,34,1,131,0,0,0,3,1,218,3,176,0,0,255,
+255,0,175,255,246,6,243,7,44,2,34,1,132,0,0,0,3,1,218,4,110,0,0,255,255,0,
+175,255,246,7,164,7,44,2,34,1,133,0,0,0,3,1,218,5,31,0,0,255,255,0,175,255,
+246,8,108,7,44,2,34,1,134,0,0,0,3,1,218,5,231,0,0,255,255,0,175,255,246,9,
+41,7,44,2,34,1,135,0,0,0,3,1,218,6,164,0,0,255,255,0,175,255,246,9,218,7,
+44,2,34,1,136,0,0,0,3,1,218,7,97,0,0,0,3,0,175,254,216,6,198,4,230,0,22,0,
+37,0,62,0,0,5,54,53,52,38,39,46,2,53,17,23,17,20,22,23,30,2,21,20,6,7,1,17,
+23,17,20,51,50,54,55,23,6,35,34,38,38,1,55,22,22,51,50,54,53,52,38,35,34,
+7,39,54,51,50,30,2,21,20,6,35,34,2,175,70,113,166,121,123,59,165,93,175,107,
+127,89,59,47,1,227,165,19,37,87,33,85,75,75,65,145,66,252,224,74,36,75,51,
+100,119,98,84,59,69,95,55,81,86,141,149,51,178,140,179,190,40,68,55,88,72,
+52,78,110,91,3,22,69,252,245,71,86,70,43,68,109,78,58,90,29,2,40,3,230,69,
+251,219,20,47,39,138,62,98,92,1,154,52,42,39,154,126,105,120,37,164,22,76,
+172,123,93,149,189,0,3,0,175,254,216,6,198,4,230,0,22,0,40,0,65,0,0,5,20,
+6,7,39,54,53,52,38,39,46,2,53,17,23,17,20,22,23,30,2,37,6,35,34,38,38,53,
+5,39,37,17,23,17,20,51,50,54,55,1,52,38,35,34,7,39,54,51,50,30,2,21,20,6,
+35,34,39,55,22,22,51,50,54,3,163,59,47,138,70,113,166,121,123,59,165,93,175,
+107,127,89,3,35,75,75,65,145,66,254,201,103,1,158,165,19,37,87,33,253,82,
+98,84,59,69,95,55,81,86,141,149,51,178,140,179,116,74,36,75,51,100,119,119,
+58,90,29,106,40,68,55,88,72,52,78,110,91,3,22,69,252,245,71,86,70,43,68,109,
+93,62,98,91,74,171,130,205,3,69,69,251,219,20,47,39,2,139,105,120,37,164,
+22,76,172,123,93,149,189,177,52,42,39,154,0,255,255,0,175,254,212,6,198,4,
+230,2,38,1,144,0,0,0,7,0,75,3,135,0,83,255,255,0,175,254,212,6,198,4,230,
+2,38,1,145,0,0,0,7,0,75,3,135,0,83,0,1,253,47,253,164,0,73,255,205,0,24,0,
+0,1,55,22,51,50,54,53,52,38,35,34,6,7,39,54,51,50,22,22,21,20,6,35,34,36,
+253,47,89,155,190,99,137,78,53,40,82,28,103,101,97,80,128,102,153,118,131,
+254,237,254,166,73,196,93,65,56,56,35,25,147,61,80,167,65,104,137,144,0,2,
+252,25,252,188,255,118,255,208,0,5,0,30,0,0,3,7,37,5,39,37,1,20,6,35,34,38,
+39,55,22,22,51,50,54,53,52,35,34,6,7,39,54,51,50,22,22,138,59,254,211,254,
+187,110,1,126,1,78,148,125,150,251,108,95,84,174,106,86,126,75,46,87,59,95,
+113,97,65,121,77,254,188,72,201,210,130,227,253,177,89,108,156,124,81,117,
+138,95,65,81,32,42,124,79,77,132,0,2,252,91,252,170,0,37,255,208,0,5,0,35,
+0,0,5,5,39,37,1,7,19,7,46,2,35,34,6,21,20,51,50,54,55,23,6,6,35,34,38,38,
+53,52,54,51,50,22,22,23,22,254,14,254,187,110,1,126,1,157,59,234,89,106,121,
+106,56,84,96,87,46,81,55,44,46,65,41,57,123,114,141,112,74,118,105,95,69,
+195,210,130,227,254,236,72,254,115,61,144,145,73,83,63,78,20,33,136,20,17,
+70,125,67,91,123,58,104,108,81,0,0,2,252,91,252,217,255,130,255,208,0,5,0,
+23,0,0,5,5,39,37,1,7,19,6,35,34,38,53,52,54,55,23,6,6,21,20,22,51,50,55,254,
+14,254,187,110,1,126,1,157,59,71,113,123,120,198,138,113,80,90,125,71,64,
+108,102,195,210,130,227,254,236,72,254,183,82,185,94,82,107,4,117,2,73,57,
+47,58,72,0,2,252,91,251,146,255,240,255,207,0,5,0,39,0,0,5,5,39,37,1,7,19,
+6,35,34,38,53,52,55,38,38,53,52,54,55,23,6,6,21,20,22,51,50,55,23,6,35,35,
+6,21,20,22,51,50,55,254,14,254,187,110,1,126,1,157,59,181,113,123,120,198,
+35,66,79,138,113,80,90,125,71,64,108,102,93,113,123,11,81,71,64,108,102,196,
+210,130,227,254,236,72,253,113,82,185,94,56,46,46,118,60,82,107,4,117,2,73,
+57,47,58,72,108,82,35,68,47,58,72,0,2,252,91,251,131,0,236,255,207,0,5,0,
+66,0,0,1,39,37,1,7,37,1,6,6,35,34,38,38,53,52,54,55,54,54,55,52,38,35,34,
+6,21,23,39,38,53,52,55,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,
+54,51,50,22,22,21,20,6,7,6,6,21,20,51,50,54,55,252,201,110,1,126,1,157,59,
+254,211,2,222,40,107,51,73,105,92,29,29,26,28,3,61,47,72,91,2,136,3,16,61,
+65,63,83,169,46,114,145,126,97,56,110,44,31,100,61,86,139,84,37,35,25,22,
+66,43,104,29,254,106,130,227,254,236,72,201,252,153,42,40,66,107,63,39,59,
+40,35,53,33,43,58,106,87,62,39,17,35,60,53,35,80,67,129,145,61,74,221,106,
+97,121,60,54,52,55,92,119,77,44,70,45,33,37,19,54,44,30,0,0,2,252,91,251,
+11,1,74,255,207,0,5,0,82,0,0,1,39,37,1,7,37,1,6,6,35,34,38,38,53,52,55,38,
+38,53,52,54,55,54,54,53,52,38,35,34,6,21,23,39,38,53,52,55,38,35,34,6,21,
+20,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,22,21,20,6,7,6,6,21,20,
+51,50,54,55,23,6,7,23,6,21,20,51,50,54,55,252,201,110,1,126,1,157,59,254,
+211,3,60,40,107,51,70,98,87,19,42,77,25,25,24,24,56,44,72,91,2,136,3,16,61,
+65,63,83,169,46,114,145,126,97,56,110,44,31,100,61,81,131,89,32,30,21,19,
+57,43,104,29,90,68,107,1,49,57,43,104,29,254,106,130,227,254,236,72,201,252,
+24,37,36,59,95,50,29,33,27,89,48,29,47,30,32,42,25,34,47,106,87,62,39,17,
+35,60,53,35,80,67,129,145,61,74,221,106,97,121,60,54,52,55,80,113,75,33,53,
+34,24,28,13,37,44,30,106,72,9,1,41,34,37,39,26,0,2,252,91,253,61,255,253,
+255,208,0,5,0,17,0,0,5,5,39,37,1,7,19,7,38,38,35,34,7,39,54,51,50,22,254,
+14,254,187,110,1,126,1,157,59,194,54,169,146,74,81,94,86,109,101,78,175,195,
+210,130,227,254,236,72,254,250,49,108,65,55,129,65,87,255,255,252,117,253,
+164,0,73,255,205,2,34,1,148,0,0,0,3,0,71,253,226,249,31,255,255,252,203,253,
+145,1,164,255,205,2,34,0,24,0,0,0,3,0,71,254,56,249,34,255,255,253,57,253,
+119,1,18,255,203,2,34,0,25,0,0,0,3,0,71,254,166,249,27,0,2,253,57,252,215,
+1,126,255,203,0,33,0,41,0,0,1,6,35,34,38,38,53,52,55,38,38,53,52,54,55,23,
+6,6,21,20,51,50,54,55,23,6,7,6,21,20,51,50,54,55,1,20,35,34,53,52,51,50,1,
+126,158,203,74,130,108,26,61,73,165,137,95,104,156,109,81,173,67,106,149,
+189,90,109,81,173,67,252,254,108,109,109,108,253,59,100,68,130,69,43,40,44,
+109,56,84,108,5,139,2,69,52,60,43,40,125,93,7,33,57,60,43,40,1,153,116,116,
+116,0,255,255,251,85,253,0,0,236,255,206,2,34,0,27,0,0,0,3,0,71,252,194,249,
+37,0,2,251,85,252,136,1,74,255,206,0,7,0,83,0,0,5,20,35,34,53,52,51,50,1,
+6,6,35,34,38,38,53,52,55,38,53,52,54,55,54,54,53,52,38,35,34,6,21,23,39,38,
+53,52,55,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,54,54,51,50,22,
+22,21,20,6,7,6,6,21,20,51,50,54,55,23,6,7,23,6,21,20,51,50,54,55,252,46,108,
+109,109,108,5,28,40,107,51,70,98,87,19,119,25,25,24,24,56,44,72,91,2,136,
+3,16,61,65,63,83,169,46,114,145,126,97,56,110,44,31,100,61,81,131,89,32,30,
+21,19,57,43,104,29,90,68,107,1,49,57,43,104,29,166,116,116,116,253,3,37,36,
+59,95,50,29,33,81,83,29,47,30,32,42,25,34,47,106,87,62,39,17,35,60,53,35,
+80,67,129,145,61,74,221,106,97,121,60,54,52,55,80,113,75,33,53,34,24,28,13,
+37,44,30,106,72,9,1,41,34,37,39,26,0,255,255,253,123,253,246,0,243,255,166,
+2,38,0,74,0,0,0,6,0,75,242,20,255,255,251,217,254,107,255,118,255,226,2,34,
+1,219,0,0,0,2,0,108,0,0,255,255,251,217,252,188,255,118,255,226,2,34,1,219,
+0,0,0,2,1,149,0,0,255,255,251,217,252,170,0,37,255,226,2,34,1,219,0,0,0,2,
+1,150,0,0,255,255,251,217,252,217,255,130,255,226,2,34,1,219,0,0,0,2,1,151,
+0,0,255,255,251,217,253,61,255,253,255,226,2,34,1,219,0,0,0,2,1,155,0,0,0,
+2,0,211,255,242,1,213,5,182,0,3,0,11,0,0,19,51,3,35,3,52,51,50,21,20,35,34,
+221,238,72,94,82,129,129,129,129,5,182,251,230,254,225,139,139,139,0,2,0,
+117,3,213,2,207,5,182,0,3,0,7,0,0,19,51,3,35,1,51,3,35,117,217,62,94,1,68,
+217,62,94,5,182,254,31,1,225,254,31,0,0,2,0,51,0,0,4,70,5,182,0,27,0,31,0,
+0,19,35,53,51,19,35,53,51,19,51,3,33,19,51,3,51,21,35,3,51,21,33,3,35,19,
+33,3,35,1,19,33,3,240,189,211,78,223,245,74,125,76,1,29,76,123,76,201,224,
+75,233,254,254,78,123,78,254,227,77,123,1,254,76,254,227,76,1,160,121,1,145,
+121,1,147,254,109,1,147,254,109,121,254,111,121,254,96,1,160,254,96,2,25,
+1,145,254,111,0,0,5,0,92,255,236,6,207,5,203,0,11,0,15,0,27,0,39,0,51,0,0,
+19,52,54,51,50,22,21,20,6,35,34,38,1,51,1,35,19,52,38,35,34,6,21,20,22,51,
+50,54,1,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,
+92,166,172,164,170,171,165,170,166,4,96,134,253,38,135,97,68,80,82,72,72,
+80,81,69,1,237,165,173,164,170,171,165,171,165,1,229,67,80,82,72,72,80,81,
+68,4,6,214,239,242,211,212,245,243,2,134,250,74,4,6,183,184,186,181,184,189,
+188,254,103,215,238,242,211,211,245,242,214,183,184,186,181,184,189,187,0,
+0,1,0,117,3,213,1,78,5,182,0,3,0,0,19,51,3,35,117,217,62,94,5,182,254,31,
+0,1,0,117,254,250,2,131,6,20,0,15,0,0,19,16,18,37,21,6,6,2,21,20,18,22,23,
+21,36,2,117,245,1,25,132,138,43,43,138,132,254,233,247,2,137,1,118,1,165,
+112,92,80,250,254,220,193,192,254,218,251,80,94,111,1,169,0,0,1,0,66,254,
+250,2,80,6,20,0,15,0,0,23,54,54,18,53,52,2,38,39,53,4,18,17,16,2,5,66,132,
+137,44,44,137,132,1,23,247,247,254,233,168,80,252,1,37,192,192,1,37,250,80,
+92,111,254,90,254,138,254,139,254,85,111,0,0,1,0,84,3,6,3,160,6,20,0,17,0,
+0,1,5,39,37,37,55,5,3,51,3,37,23,5,5,7,37,19,35,1,213,254,199,72,1,88,254,
+168,72,1,59,53,178,57,1,61,72,254,166,1,90,72,254,195,57,178,4,74,195,160,
+102,103,162,199,1,69,254,189,192,159,101,100,158,191,254,188,0,0,1,0,133,
+1,37,3,244,4,147,0,11,0,0,1,33,53,33,17,51,17,33,21,33,17,35,1,254,254,135,
+1,121,123,1,123,254,133,123,2,160,121,1,122,254,134,121,254,133,0,1,0,61,
+254,197,1,141,1,8,0,17,0,0,23,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,
+6,7,61,195,31,32,54,33,75,59,69,88,162,174,229,63,121,25,28,18,31,51,35,57,
+64,98,80,140,210,51,0,1,0,51,1,225,2,72,2,123,0,3,0,0,19,33,21,33,51,2,21,
+253,235,2,123,154,0,1,0,127,255,242,1,129,1,8,0,7,0,0,55,52,51,50,21,20,35,
+34,127,129,129,129,129,125,139,139,139,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,
+1,51,1,35,1,215,119,254,43,121,6,20,248,244,0,2,0,92,255,236,4,29,5,203,0,
+11,0,23,0,0,19,16,18,51,50,18,17,16,2,35,34,2,1,16,2,35,34,2,17,16,18,51,
+50,18,92,237,246,229,249,252,228,244,237,2,236,122,143,145,125,125,143,144,
+123,2,223,1,98,1,138,254,121,254,153,254,152,254,119,1,144,1,97,1,62,1,65,
+254,191,254,194,254,194,254,187,1,68,0,0,1,0,135,0,0,3,209,5,190,0,23,0,0,
+55,51,50,54,53,17,6,6,35,34,38,53,54,54,55,55,51,17,20,22,51,51,21,33,197,
+137,96,72,92,116,56,45,58,66,137,96,144,131,73,95,100,252,244,86,71,76,4,
+52,111,102,61,49,17,70,71,106,251,43,76,71,86,0,0,1,0,104,0,0,3,227,5,203,
+0,31,0,0,55,1,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,
+1,33,50,54,54,55,51,3,33,104,1,86,169,122,104,105,128,97,82,94,214,187,192,
+224,139,203,254,166,1,217,59,70,35,16,86,10,252,143,150,1,139,197,243,135,
+121,139,164,141,60,73,127,148,186,156,117,254,223,254,129,42,71,77,254,158,
+0,0,1,0,119,255,236,4,2,5,203,0,44,0,0,55,52,54,51,20,22,51,50,54,53,52,38,
+35,35,53,51,50,54,53,52,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,22,22,
+21,20,6,6,35,34,38,119,70,59,142,118,135,170,200,171,65,65,142,180,219,129,
+97,82,94,216,186,199,231,183,145,184,195,154,237,129,180,207,207,61,70,113,
+135,158,172,131,154,104,178,139,254,164,141,60,73,127,148,175,151,135,208,
+34,20,190,152,155,196,87,122,0,0,2,0,35,0,0,4,92,5,182,0,20,0,28,0,0,37,51,
+50,54,53,53,33,53,1,51,17,51,21,35,21,20,22,51,51,21,33,19,17,52,55,6,6,7,
+1,1,184,58,96,72,253,137,2,121,194,254,254,73,95,27,253,151,226,14,20,127,
+37,254,198,86,71,76,168,84,3,209,252,78,115,168,76,71,86,2,4,1,123,248,176,
+40,218,57,254,24,0,1,0,113,255,236,3,227,5,180,0,34,0,0,55,52,51,20,22,51,
+32,17,52,38,35,34,6,7,39,19,33,19,35,39,38,38,35,33,3,54,51,50,22,21,20,4,
+35,34,38,113,129,133,114,1,37,166,145,94,108,50,49,66,2,172,10,86,8,7,46,
+58,254,115,39,97,142,216,251,254,246,229,181,206,186,121,95,112,1,90,158,
+162,23,22,14,2,213,254,203,61,51,33,254,62,33,233,200,214,252,109,0,2,0,125,
+255,236,4,16,5,203,0,25,0,34,0,0,19,52,18,54,51,50,22,21,20,6,35,52,38,35,
+32,3,54,51,50,22,21,20,2,35,34,2,37,16,35,34,6,7,18,33,50,125,119,241,174,
+152,186,81,76,87,94,254,210,21,128,165,189,222,238,202,231,244,2,194,243,
+74,132,48,6,1,10,225,2,225,201,1,84,205,120,95,59,64,108,131,253,166,107,
+226,194,225,254,248,1,138,75,1,79,69,49,253,194,0,0,1,0,121,0,0,4,23,5,180,
+0,10,0,0,1,33,34,7,7,35,19,33,21,1,35,3,104,253,230,110,9,8,86,10,3,148,254,
+8,154,5,16,104,102,1,114,59,250,135,0,3,0,94,255,236,4,27,5,203,0,25,0,37,
+0,48,0,0,19,52,54,54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,
+4,35,34,38,1,52,38,35,34,6,21,20,22,23,54,54,19,52,38,39,6,21,20,22,51,50,
+54,94,78,132,102,126,139,93,199,151,184,219,115,161,164,176,254,249,229,213,
+252,2,199,124,110,109,128,117,159,107,88,59,164,196,211,142,134,131,164,1,
+111,93,136,96,49,71,182,122,100,166,101,193,160,109,156,81,78,189,126,191,
+220,210,3,177,118,133,133,112,97,139,74,53,133,253,97,105,156,85,114,220,
+131,153,150,0,0,2,0,104,255,233,3,252,5,203,0,26,0,38,0,0,55,52,54,55,22,
+51,50,18,19,6,6,35,34,38,53,52,18,51,50,18,17,20,2,6,35,34,38,1,2,2,35,34,
+6,21,20,22,51,54,54,168,37,24,70,168,168,163,11,50,152,99,191,213,240,199,
+230,247,116,249,190,160,137,2,131,4,142,122,109,119,117,121,94,134,154,36,
+54,8,162,1,44,1,56,61,78,221,195,228,1,20,254,151,254,185,226,254,142,222,
+102,3,3,1,8,1,0,192,179,166,149,1,94,0,0,2,0,166,255,242,1,168,4,84,0,7,0,
+15,0,0,19,52,51,50,21,20,35,34,17,52,51,50,21,20,35,34,166,129,129,129,129,
+129,129,129,129,3,201,139,139,140,253,64,139,139,139,0,0,2,0,98,254,197,1,
+178,4,84,0,7,0,25,0,0,19,52,51,50,21,20,35,34,3,54,53,52,38,39,38,38,53,52,
+54,51,50,22,21,20,6,7,166,129,129,129,129,68,195,31,32,54,33,75,58,70,88,
+162,174,3,201,139,139,140,251,222,63,121,25,28,18,31,51,35,57,64,99,79,140,
+210,51,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,53,1,21,1,1,21,133,3,111,
+253,80,2,176,2,184,72,1,217,137,254,139,254,143,137,0,0,2,0,133,1,213,3,244,
+3,225,0,3,0,7,0,0,19,33,21,33,17,33,21,33,133,3,111,252,145,3,111,252,145,
+3,225,121,254,230,121,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,1,1,53,1,21,
+1,133,2,176,253,80,3,111,252,145,1,106,1,113,1,117,137,254,39,72,254,41,0,
+2,0,88,255,242,3,152,5,203,0,23,0,32,0,0,1,54,54,53,52,38,35,34,6,21,34,38,
+53,52,54,51,50,22,21,20,6,7,21,35,3,52,51,50,21,20,6,35,34,1,141,167,147,
+110,114,120,109,76,94,200,183,203,246,200,198,125,69,129,129,72,57,129,2,
+211,67,222,135,111,124,145,117,69,64,109,121,204,167,163,224,82,231,254,225,
+139,139,74,65,0,0,1,0,205,254,250,2,150,6,20,0,13,0,0,19,33,21,35,34,6,21,
+17,20,22,51,51,21,33,205,1,201,89,95,72,72,95,89,254,55,6,20,86,71,76,250,
+184,75,72,86,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,17,51,1,35,119,1,215,121,6,
+20,248,244,0,1,0,76,254,250,2,20,6,20,0,13,0,0,23,51,50,54,53,17,52,38,35,
+35,53,33,17,33,76,88,96,72,73,95,88,1,200,254,56,176,71,76,5,72,76,71,86,
+248,230,0,0,1,0,104,2,33,4,14,5,182,0,6,0,0,1,51,1,35,1,1,35,2,23,71,1,176,
+137,254,180,254,185,138,5,182,252,107,2,217,253,39,0,1,255,246,254,221,3,
+182,255,86,0,3,0,0,7,33,21,33,10,3,192,252,64,170,121,0,0,1,0,102,254,250,
+3,6,6,20,0,35,0,0,37,17,52,38,39,53,54,54,53,17,52,54,51,51,21,35,34,6,21,
+17,20,6,7,21,22,22,21,17,20,22,51,51,21,35,34,38,1,88,127,115,114,128,151,
+144,135,61,89,79,116,112,115,113,80,88,61,135,142,153,33,1,100,117,95,5,86,
+3,96,116,1,101,140,152,88,106,109,254,162,102,132,18,2,19,131,104,254,158,
+107,108,88,158,0,1,1,254,254,20,2,121,6,20,0,3,0,0,1,51,17,35,1,254,123,123,
+6,20,248,0,0,1,0,102,254,250,3,6,6,20,0,35,0,0,23,51,50,54,53,17,52,54,55,
+53,38,38,53,17,52,38,35,35,53,51,50,22,21,17,20,22,23,21,6,6,21,17,20,6,35,
+35,102,62,88,80,113,114,111,116,79,89,62,136,143,151,129,113,114,128,152,
+142,136,174,108,107,1,98,104,131,19,2,18,132,102,1,94,109,106,88,152,140,
+254,155,116,96,3,86,5,95,117,254,156,137,158,0,0,1,0,111,2,39,4,8,3,141,0,
+25,0,0,1,50,22,23,22,22,51,50,54,55,51,6,6,35,34,38,39,38,38,35,34,6,7,35,
+54,54,1,104,67,110,79,57,73,38,54,57,14,123,17,105,128,67,114,64,61,73,43,
+58,59,12,120,14,105,3,141,62,73,52,50,117,120,150,208,66,63,58,50,114,123,
+155,203,0,255,255,0,51,1,225,2,72,2,123,2,6,1,178,0,0,0,1,255,246,1,233,4,
+10,2,98,0,3,0,0,3,33,21,33,10,4,20,251,236,2,98,121,0,1,255,246,1,233,8,10,
+2,98,0,3,0,0,3,33,21,33,10,8,20,247,236,2,98,121,0,1,0,115,3,117,1,195,5,
+184,0,17,0,0,19,52,54,55,21,6,21,20,22,23,22,22,21,20,6,35,34,38,115,162,
+174,195,30,33,42,45,75,59,69,88,4,39,140,210,51,86,63,121,25,28,19,22,49,
+45,57,64,98,0,0,1,0,61,3,115,1,141,5,182,0,17,0,0,19,54,53,52,38,39,38,38,
+53,52,54,51,50,22,21,20,6,7,61,195,30,33,42,45,75,59,69,88,162,174,3,201,
+63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,0,0,2,0,115,3,117,3,92,5,
+184,0,17,0,35,0,0,19,52,54,55,21,6,21,20,22,23,22,22,21,20,6,35,34,38,37,
+52,54,55,21,6,21,20,22,23,22,22,21,20,6,35,34,38,115,162,174,195,30,33,42,
+45,75,59,69,88,1,153,162,174,194,30,33,41,45,74,59,70,88,4,39,140,210,51,
+86,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,86,63,121,25,28,19,22,
+49,45,57,64,99,0,2,0,61,3,115,3,39,5,182,0,17,0,35,0,0,19,54,53,52,38,39,
+38,38,53,52,54,51,50,22,21,20,6,7,37,54,53,52,38,39,38,38,53,52,54,51,50,
+22,21,20,6,7,61,195,30,33,42,45,75,59,69,88,162,174,1,154,195,30,33,42,45,
+74,59,70,88,162,174,3,201,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,
+86,63,121,25,28,19,22,49,45,57,64,99,79,140,210,51,0,3,0,164,255,242,6,57,
+1,8,0,8,0,17,0,25,0,0,55,52,51,50,21,20,6,35,34,37,52,51,50,21,20,6,35,34,
+37,52,51,50,21,20,35,34,164,129,129,72,57,129,2,74,129,129,72,57,129,2,73,
+129,129,129,129,125,139,139,74,65,139,139,139,74,65,139,139,139,139,0,0,1,
+0,145,1,51,3,229,4,137,0,11,0,0,19,1,1,55,1,1,23,1,1,7,1,1,145,1,84,254,172,
+86,1,84,1,84,86,254,172,1,84,86,254,172,254,172,1,139,1,84,1,82,86,254,172,
+1,86,88,254,172,254,172,86,1,84,254,172,0,0,3,0,133,0,231,3,244,4,209,0,7,
+0,11,0,20,0,0,1,52,51,50,21,20,35,34,5,33,21,33,1,52,51,50,21,20,6,35,34,
+1,213,104,105,105,104,254,176,3,111,252,145,1,80,104,105,58,47,104,4,96,113,
+113,112,215,121,254,184,113,113,59,54,0,0,1,0,133,2,160,3,244,3,25,0,3,0,
+0,19,33,21,33,133,3,111,252,145,3,25,121,0,1,255,117,5,87,0,47,6,29,0,7,0,
+0,3,52,51,50,21,20,35,34,139,94,92,92,94,5,186,99,99,99,0,1,1,171,5,86,2,
+101,6,28,0,7,0,0,1,20,35,34,53,52,51,50,2,101,92,94,94,92,5,185,99,99,99,
+0,0,1,251,217,255,41,252,134,255,226,0,7,0,0,5,34,53,52,51,50,21,20,252,48,
+87,87,86,215,92,93,93,92,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,
+0,1,4,9,0,1,0,38,0,94,0,3,0,1,4,9,0,2,0,14,0,132,0,3,0,1,4,9,0,3,0,76,0,146,
+0,3,0,1,4,9,0,4,0,38,0,94,0,3,0,1,4,9,0,5,0,30,0,222,0,3,0,1,4,9,0,6,0,34,
+0,252,0,3,0,1,4,9,0,7,0,68,1,30,0,3,0,1,4,9,0,8,0,42,1,98,0,3,0,1,4,9,0,9,
+0,38,1,140,0,3,0,1,4,9,0,10,0,96,1,178,0,3,0,1,4,9,0,11,0,62,2,18,0,3,0,1,
+4,9,0,12,0,60,2,80,0,3,0,1,4,9,0,13,2,150,2,140,0,3,0,1,4,9,0,14,0,52,5,34,
+0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,
+0,54,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,
+0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,
+0,101,0,114,0,105,0,102,0,32,0,71,0,117,0,106,0,97,0,114,0,97,0,116,0,105,
+0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,
+78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,71,0,117,0,
+106,0,97,0,114,0,97,0,116,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,
+0,32,0,49,0,46,0,48,0,50,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,101,
+0,114,0,105,0,102,0,71,0,117,0,106,0,97,0,114,0,97,0,116,0,105,0,78,0,111,
+0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,
+0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,
+0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,
+0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,
+46,0,73,0,110,0,100,0,105,0,97,0,110,0,32,0,84,0,121,0,112,0,101,0,32,0,70,
+0,111,0,117,0,110,0,100,0,114,0,121,0,68,0,97,0,116,0,97,0,32,0,117,0,110,
+0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,
+0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,
+0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,
+0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,
+0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,
+0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,
+0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,
+0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,
+32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,
+101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,
+0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,
+32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,
+0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,
+0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,
+0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,
+105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,
+0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,
+0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,
+0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,
+0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,
+0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,
+0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,
+0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,
+0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,
+105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,181,
+0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,220,0,0,1,2,0,2,0,3,1,3,1,
+4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,
+20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,
+1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,
+1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,
+1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,
+1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,
+1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,
+120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,
+1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,
+145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,
+1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,
+170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,
+1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,
+195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,
+1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,
+220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,
+1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,
+245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,
+2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,
+2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,
+2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,
+2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,
+2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,
+2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,
+2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,
+107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,
+2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,
+132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,
+2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,
+157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,0,4,0,5,0,6,0,8,
+0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,
+0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,62,0,63,0,64,0,65,0,66,
+0,94,0,95,0,96,0,97,2,167,0,178,0,179,0,182,0,183,0,180,0,181,0,171,0,240,
+0,184,0,239,2,168,2,169,2,170,4,78,85,76,76,3,103,106,65,4,103,106,65,65,
+3,103,106,73,4,103,106,73,73,3,103,106,85,4,103,106,85,85,4,103,106,118,82,
+5,103,106,118,82,82,4,103,106,118,76,5,103,106,118,76,76,3,103,106,69,4,103,
+106,65,73,3,103,106,79,4,103,106,65,85,9,103,106,69,99,97,110,100,114,97,
+9,103,106,79,99,97,110,100,114,97,5,103,106,109,65,65,4,103,106,109,73,5,
+103,106,109,73,73,4,103,106,109,85,5,103,106,109,85,85,5,103,106,109,118,
+82,6,103,106,109,118,82,82,5,103,106,109,118,76,6,103,106,109,118,76,76,4,
+103,106,109,69,5,103,106,109,65,73,4,103,106,109,79,5,103,106,109,65,85,10,
+103,106,109,69,99,97,110,100,114,97,10,103,106,109,79,99,97,110,100,114,97,
+4,103,106,75,65,5,103,106,75,72,65,4,103,106,71,65,5,103,106,71,72,65,5,103,
+106,78,71,65,4,103,106,67,65,5,103,106,67,72,65,4,103,106,74,65,5,103,106,
+74,72,65,5,103,106,78,89,65,5,103,106,84,84,65,6,103,106,84,84,72,65,5,103,
+106,68,68,65,6,103,106,68,68,72,65,5,103,106,78,78,65,4,103,106,84,65,5,103,
+106,84,72,65,4,103,106,68,65,5,103,106,68,72,65,4,103,106,78,65,4,103,106,
+80,65,5,103,106,80,72,65,4,103,106,66,65,5,103,106,66,72,65,4,103,106,77,
+65,4,103,106,89,65,4,103,106,82,65,4,103,106,76,65,4,103,106,86,65,5,103,
+106,83,72,65,5,103,106,83,83,65,4,103,106,83,65,4,103,106,72,65,5,103,106,
+76,76,65,7,103,106,75,95,83,83,65,7,103,106,74,95,78,89,65,10,103,106,65,
+110,117,115,118,97,114,97,13,103,106,67,97,110,100,114,97,98,105,110,100,
+117,9,103,106,86,105,115,97,114,103,97,8,103,106,86,105,114,97,109,97,7,103,
+106,78,117,107,116,97,10,103,106,65,118,97,103,114,97,104,97,6,103,106,90,
+101,114,111,5,103,106,79,110,101,5,103,106,84,119,111,7,103,106,84,104,114,
+101,101,6,103,106,70,111,117,114,6,103,106,70,105,118,101,5,103,106,83,105,
+120,7,103,106,83,101,118,101,110,7,103,106,69,105,103,104,116,6,103,106,78,
+105,110,101,4,103,106,79,109,18,103,106,65,98,98,114,101,118,105,97,116,105,
+111,110,115,105,103,110,11,103,106,82,117,112,101,101,115,105,103,110,5,100,
+97,110,100,97,11,100,111,117,98,108,101,100,97,110,100,97,7,117,110,105,65,
+56,51,48,7,117,110,105,65,56,51,49,7,117,110,105,65,56,51,50,7,117,110,105,
+65,56,51,51,7,117,110,105,65,56,51,52,7,117,110,105,65,56,51,53,7,117,110,
+105,65,56,51,54,7,117,110,105,65,56,51,55,7,117,110,105,65,56,51,56,7,117,
+110,105,65,56,51,57,7,117,110,105,50,48,66,57,7,117,110,105,50,48,48,66,7,
+117,110,105,50,48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,50,53,67,
+67,6,103,106,82,101,112,104,6,103,106,82,65,99,50,3,103,106,75,4,103,106,
+75,72,3,103,106,71,4,103,106,71,72,3,103,106,67,3,103,106,74,4,103,106,78,
+89,4,103,106,78,78,3,103,106,84,4,103,106,84,72,4,103,106,68,72,3,103,106,
+78,3,103,106,80,4,103,106,80,72,3,103,106,66,4,103,106,66,72,3,103,106,77,
+3,103,106,89,3,103,106,76,3,103,106,86,4,103,106,83,72,4,103,106,83,83,3,
+103,106,83,3,103,106,72,4,103,106,76,76,6,103,106,75,95,83,83,6,103,106,74,
+95,78,89,6,103,106,75,95,82,65,7,103,106,75,72,95,82,65,6,103,106,71,95,82,
+65,7,103,106,71,72,95,82,65,6,103,106,67,95,82,65,6,103,106,74,95,82,65,7,
+103,106,74,72,95,82,65,7,103,106,78,89,95,82,65,7,103,106,78,78,95,82,65,
+6,103,106,84,95,82,65,7,103,106,84,72,95,82,65,6,103,106,68,95,82,65,7,103,
+106,68,72,95,82,65,6,103,106,78,95,82,65,6,103,106,80,95,82,65,7,103,106,
+80,72,95,82,65,6,103,106,66,95,82,65,7,103,106,66,72,95,82,65,6,103,106,77,
+95,82,65,6,103,106,89,95,82,65,6,103,106,76,95,82,65,6,103,106,86,95,82,65,
+7,103,106,83,72,95,82,65,7,103,106,83,83,95,82,65,6,103,106,83,95,82,65,6,
+103,106,72,95,82,65,7,103,106,76,76,95,82,65,9,103,106,75,95,83,83,95,82,
+65,9,103,106,74,95,78,89,95,82,65,5,103,106,75,95,82,6,103,106,75,72,95,82,
+5,103,106,71,95,82,6,103,106,71,72,95,82,5,103,106,67,95,82,5,103,106,74,
+95,82,6,103,106,78,89,95,82,6,103,106,78,78,95,82,5,103,106,84,95,82,6,103,
+106,84,72,95,82,6,103,106,68,72,95,82,5,103,106,78,95,82,5,103,106,80,95,
+82,6,103,106,80,72,95,82,5,103,106,66,95,82,6,103,106,66,72,95,82,5,103,106,
+77,95,82,5,103,106,89,95,82,5,103,106,76,95,82,5,103,106,86,95,82,6,103,106,
+83,72,95,82,6,103,106,83,83,95,82,5,103,106,83,95,82,6,103,106,76,76,95,82,
+8,103,106,75,95,83,83,95,82,8,103,106,74,95,78,89,95,82,6,103,106,75,95,75,
+65,6,103,106,75,95,89,65,7,103,106,78,71,95,75,65,7,103,106,78,71,95,71,65,
+8,103,106,78,71,95,71,72,65,7,103,106,78,71,95,77,65,7,103,106,78,71,95,89,
+65,7,103,106,67,72,95,89,65,7,103,106,67,72,95,86,65,7,103,106,78,89,95,67,
+65,7,103,106,78,89,95,74,65,8,103,106,84,84,95,84,84,65,9,103,106,84,84,95,
+84,84,72,65,7,103,106,84,84,95,89,65,7,103,106,84,84,95,86,65,10,103,106,
+84,84,72,95,84,84,72,65,8,103,106,84,84,72,95,89,65,8,103,106,68,68,95,68,
+68,65,9,103,106,68,68,95,68,68,72,65,7,103,106,68,68,95,89,65,10,103,106,
+68,68,72,95,68,68,72,65,8,103,106,68,68,72,95,89,65,6,103,106,84,95,84,65,
+5,103,106,84,95,84,6,103,106,68,95,71,65,7,103,106,68,95,71,72,65,6,103,106,
+68,95,68,65,7,103,106,68,95,68,72,65,6,103,106,68,95,78,65,6,103,106,68,95,
+66,65,7,103,106,68,95,66,72,65,6,103,106,68,95,77,65,6,103,106,68,95,89,65,
+6,103,106,68,95,86,65,7,103,106,80,72,95,89,65,7,103,106,83,72,95,67,65,8,
+103,106,83,83,95,84,84,65,9,103,106,83,83,95,84,84,72,65,8,103,106,83,95,
+84,95,82,65,7,103,106,72,95,78,78,65,6,103,106,72,95,78,65,6,103,106,72,95,
+77,65,6,103,106,72,95,89,65,6,103,106,72,95,76,65,6,103,106,72,95,86,65,7,
+103,106,76,76,95,89,65,5,103,106,75,120,65,6,103,106,75,72,120,65,5,103,106,
+71,120,65,6,103,106,71,72,120,65,6,103,106,78,71,120,65,5,103,106,67,120,
+65,6,103,106,67,72,120,65,5,103,106,74,120,65,6,103,106,74,72,120,65,6,103,
+106,78,89,120,65,6,103,106,84,84,120,65,7,103,106,84,84,72,120,65,6,103,106,
+68,68,120,65,7,103,106,68,68,72,120,65,6,103,106,78,78,120,65,5,103,106,84,
+120,65,6,103,106,84,72,120,65,5,103,106,68,120,65,6,103,106,68,72,120,65,
+5,103,106,78,120,65,5,103,106,80,120,65,6,103,106,80,72,120,65,5,103,106,
+66,120,65,6,103,106,66,72,120,65,5,103,106,77,120,65,5,103,106,89,120,65,
+5,103,106,82,120,65,5,103,106,76,120,65,5,103,106,86,120,65,6,103,106,83,
+72,120,65,6,103,106,83,83,120,65,5,103,106,83,120,65,5,103,106,72,120,65,
+6,103,106,76,76,120,65,4,103,106,75,120,5,103,106,75,72,120,4,103,106,71,
+120,5,103,106,71,72,120,4,103,106,67,120,4,103,106,74,120,5,103,106,78,89,
+120,5,103,106,78,78,120,4,103,106,84,120,5,103,106,84,72,120,5,103,106,68,
+72,120,4,103,106,78,120,4,103,106,80,120,5,103,106,80,72,120,4,103,106,66,
+120,5,103,106,66,72,120,4,103,106,77,120,4,103,106,89,120,4,103,106,76,120,
+4,103,106,86,120,5,103,106,83,72,120,5,103,106,83,83,120,4,103,106,83,120,
+4,103,106,72,120,5,103,106,76,76,120,7,103,106,75,120,95,82,65,8,103,106,
+75,72,120,95,82,65,7,103,106,71,120,95,82,65,8,103,106,71,72,120,95,82,65,
+7,103,106,67,120,95,82,65,7,103,106,74,120,95,82,65,8,103,106,74,72,120,95,
+82,65,8,103,106,78,89,120,95,82,65,8,103,106,78,78,120,95,82,65,7,103,106,
+84,120,95,82,65,8,103,106,84,72,120,95,82,65,7,103,106,68,120,95,82,65,8,
+103,106,68,72,120,95,82,65,7,103,106,78,120,95,82,65,7,103,106,80,120,95,
+82,65,8,103,106,80,72,120,95,82,65,7,103,106,66,120,95,82,65,8,103,106,66,
+72,120,95,82,65,7,103,106,77,120,95,82,65,7,103,106,89,120,95,82,65,7,103,
+106,76,120,95,82,65,7,103,106,86,120,95,82,65,8,103,106,83,72,120,95,82,65,
+8,103,106,83,83,120,95,82,65,7,103,106,83,120,95,82,65,7,103,106,72,120,95,
+82,65,8,103,106,76,76,120,95,82,65,6,103,106,75,120,95,82,7,103,106,75,72,
+120,95,82,6,103,106,71,120,95,82,7,103,106,71,72,120,95,82,6,103,106,67,120,
+95,82,6,103,106,74,120,95,82,7,103,106,78,89,120,95,82,7,103,106,78,78,120,
+95,82,6,103,106,84,120,95,82,7,103,106,84,72,120,95,82,7,103,106,68,72,120,
+95,82,6,103,106,78,120,95,82,6,103,106,80,120,95,82,7,103,106,80,72,120,95,
+82,6,103,106,66,120,95,82,7,103,106,66,72,120,95,82,6,103,106,77,120,95,82,
+6,103,106,89,120,95,82,6,103,106,76,120,95,82,6,103,106,86,120,95,82,7,103,
+106,83,72,120,95,82,7,103,106,83,83,120,95,82,6,103,106,83,120,95,82,7,103,
+106,76,76,120,95,82,15,103,106,82,101,112,104,95,65,110,117,115,118,97,114,
+97,14,103,106,109,73,73,95,65,110,117,115,118,97,114,97,10,103,106,109,73,
+73,95,82,101,112,104,19,103,106,109,73,73,95,82,101,112,104,95,65,110,117,
+115,118,97,114,97,13,103,106,109,69,95,65,110,117,115,118,97,114,97,9,103,
+106,109,69,95,82,101,112,104,18,103,106,109,69,95,82,101,112,104,95,65,110,
+117,115,118,97,114,97,14,103,106,109,65,73,95,65,110,117,115,118,97,114,97,
+10,103,106,109,65,73,95,82,101,112,104,19,103,106,109,65,73,95,82,101,112,
+104,95,65,110,117,115,118,97,114,97,19,103,106,109,69,99,97,110,100,114,97,
+95,65,110,117,115,118,97,114,97,15,103,106,109,69,99,97,110,100,114,97,95,
+82,101,112,104,24,103,106,109,69,99,97,110,100,114,97,95,82,101,112,104,95,
+65,110,117,115,118,97,114,97,8,103,106,74,65,95,109,65,65,10,103,106,74,95,
+82,65,95,109,65,65,9,103,106,74,120,65,95,109,65,65,11,103,106,74,120,95,
+82,65,95,109,65,65,8,103,106,74,65,95,109,73,73,10,103,106,74,95,82,65,95,
+109,73,73,9,103,106,74,120,65,95,109,73,73,11,103,106,74,120,95,82,65,95,
+109,73,73,7,103,106,82,65,95,109,85,8,103,106,82,65,95,109,85,85,8,103,106,
+68,65,95,109,118,82,8,103,106,72,65,95,109,118,82,7,103,106,109,73,46,48,
+49,7,103,106,109,73,46,48,50,7,103,106,109,73,46,48,51,7,103,106,109,73,46,
+48,52,7,103,106,109,73,46,48,53,7,103,106,109,73,46,48,54,7,103,106,109,73,
+46,48,55,16,103,106,109,73,95,65,110,117,115,118,97,114,97,46,48,49,16,103,
+106,109,73,95,65,110,117,115,118,97,114,97,46,48,50,16,103,106,109,73,95,
+65,110,117,115,118,97,114,97,46,48,51,16,103,106,109,73,95,65,110,117,115,
+118,97,114,97,46,48,52,16,103,106,109,73,95,65,110,117,115,118,97,114,97,
+46,48,53,16,103,106,109,73,95,65,110,117,115,118,97,114,97,46,48,54,16,103,
+106,109,73,95,65,110,117,115,118,97,114,97,46,48,55,12,103,106,109,73,95,
+82,101,112,104,46,48,49,12,103,106,109,73,95,82,101,112,104,46,48,50,12,103,
+106,109,73,95,82,101,112,104,46,48,51,12,103,106,109,73,95,82,101,112,104,
+46,48,52,12,103,106,109,73,95,82,101,112,104,46,48,53,12,103,106,109,73,95,
+82,101,112,104,46,48,54,12,103,106,109,73,95,82,101,112,104,46,48,55,21,103,
+106,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,49,21,
+103,106,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,50,
+21,103,106,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,48,
+51,21,103,106,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,46,
+48,52,21,103,106,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,97,
+46,48,53,21,103,106,109,73,95,82,101,112,104,95,65,110,117,115,118,97,114,
+97,46,48,54,21,103,106,109,73,95,82,101,112,104,95,65,110,117,115,118,97,
+114,97,46,48,55,12,103,106,78,78,65,46,109,97,116,114,97,117,14,103,106,78,
+78,95,82,65,46,109,97,116,114,97,117,13,103,106,78,78,120,65,46,109,97,116,
+114,97,117,15,103,106,78,78,120,95,82,65,46,109,97,116,114,97,117,10,103,
+106,109,85,46,115,109,97,108,108,9,103,106,82,65,99,50,95,109,85,10,103,106,
+82,65,99,50,95,109,85,85,10,103,106,82,65,99,50,95,109,118,82,11,103,106,
+82,65,99,50,95,109,118,82,82,10,103,106,82,65,99,50,95,109,118,76,11,103,
+106,82,65,99,50,95,109,118,76,76,13,103,106,82,65,99,50,95,86,105,114,97,
+109,97,10,103,106,78,117,107,116,97,95,109,85,11,103,106,78,117,107,116,97,
+95,109,85,85,11,103,106,78,117,107,116,97,95,109,118,82,12,103,106,78,117,
+107,116,97,95,109,118,82,82,11,103,106,78,117,107,116,97,95,109,118,76,12,
+103,106,78,117,107,116,97,95,109,118,76,76,14,103,106,78,117,107,116,97,95,
+86,105,114,97,109,97,12,103,106,78,117,107,116,97,95,82,65,99,50,15,103,106,
+78,117,107,116,97,95,82,65,99,50,95,109,85,16,103,106,78,117,107,116,97,95,
+82,65,99,50,95,109,85,85,16,103,106,78,117,107,116,97,95,82,65,99,50,95,109,
+118,82,19,103,106,78,117,107,116,97,95,82,65,99,50,95,86,105,114,97,109,97,
+7,117,110,105,48,48,65,68,8,103,108,121,112,104,52,55,51,8,103,108,121,112,
+104,52,55,52,8,103,108,121,112,104,52,55,53,0,0,0,1,0,2,0,8,0,10,255,255,
+0,15,0,1,0,0,0,12,0,0,0,0,0,64,0,2,0,8,0,23,0,30,0,3,0,33,0,33,0,3,0,71,0,
+72,0,3,0,74,0,74,0,3,0,107,0,108,0,3,1,91,1,91,0,3,1,95,1,103,0,3,1,148,1,
+167,0,3,0,2,0,4,0,71,0,71,0,1,0,107,0,107,0,1,1,91,1,91,0,1,1,123,1,143,0,
+1,0,1,0,0,0,10,0,72,0,170,0,3,68,70,76,84,0,20,103,106,114,50,0,34,103,117,
+106,114,0,48,0,4,0,0,0,0,255,255,0,2,0,0,0,3,0,4,0,0,0,0,255,255,0,2,0,1,
+0,4,0,4,0,0,0,0,255,255,0,2,0,2,0,5,0,6,97,98,118,109,0,38,97,98,118,109,
+0,48,97,98,118,109,0,58,98,108,119,109,0,68,98,108,119,109,0,78,98,108,119,
+109,0,88,0,0,0,3,0,0,0,1,0,2,0,0,0,3,0,0,0,1,0,2,0,0,0,3,0,0,0,1,0,2,0,0,
+0,3,0,3,0,4,0,5,0,0,0,3,0,3,0,4,0,5,0,0,0,3,0,3,0,4,0,5,0,6,0,14,0,22,0,30,
+0,38,0,46,0,54,0,4,0,0,0,1,0,48,0,4,0,0,0,1,0,172,0,4,0,0,0,1,2,72,0,4,0,
+0,0,1,3,186,0,4,0,0,0,1,5,122,0,4,0,0,0,1,6,10,0,1,7,156,7,192,0,1,0,12,0,
+78,0,16,0,0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,
+0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,0,0,84,0,0,
+0,84,0,8,0,24,0,24,0,30,0,36,0,42,0,42,0,48,0,48,0,1,255,81,4,161,0,1,2,102,
+4,132,0,1,3,132,5,80,0,1,5,220,4,57,0,1,3,222,4,161,0,1,4,61,4,161,0,1,7,
+70,7,90,0,1,0,12,0,46,0,8,0,0,0,180,0,0,0,180,0,0,0,180,0,0,0,180,0,0,0,180,
+0,0,0,180,0,0,0,180,0,0,0,180,0,72,0,152,0,158,0,164,0,170,0,176,0,182,0,
+188,0,194,0,200,0,206,0,212,0,218,0,224,0,152,0,230,0,176,0,236,0,212,0,242,
+0,248,0,254,1,4,1,10,1,16,0,164,0,182,1,22,1,28,0,242,0,194,1,34,1,40,0,236,
+1,46,0,206,1,52,0,236,1,58,1,64,1,70,1,76,1,76,1,82,1,82,1,82,1,82,0,152,
+0,158,0,164,0,170,0,176,0,182,0,188,0,194,0,200,0,206,0,212,0,218,0,224,0,
+152,0,176,0,236,0,212,0,242,1,88,1,94,1,88,1,94,1,100,1,106,1,112,0,242,0,
+1,255,81,4,161,0,1,2,107,4,161,0,1,2,146,4,161,0,1,2,239,4,172,0,1,3,242,
+4,161,0,1,4,115,4,161,0,1,2,142,4,161,0,1,2,143,4,161,0,1,2,145,4,161,0,1,
+3,2,4,161,0,1,2,25,4,161,0,1,2,89,4,161,0,1,2,62,4,161,0,1,3,76,4,161,0,1,
+4,127,4,161,0,1,2,212,4,161,0,1,2,165,4,161,0,1,5,123,4,161,0,1,2,177,4,161,
+0,1,2,206,4,161,0,1,2,194,4,161,0,1,2,176,4,161,0,1,2,157,4,161,0,1,2,175,
+4,161,0,1,2,150,4,161,0,1,3,67,4,161,0,1,4,64,4,161,0,1,4,98,4,161,0,1,3,
+32,4,161,0,1,4,55,4,161,0,1,3,17,4,161,0,1,3,105,4,161,0,1,2,211,4,161,0,
+1,4,27,4,161,0,1,4,190,4,161,0,1,3,102,4,161,0,1,2,144,4,161,0,1,2,236,4,
+161,0,1,6,74,6,90,0,1,0,12,0,46,0,8,0,0,0,168,0,0,0,168,0,0,0,168,0,0,0,168,
+0,0,0,168,0,0,0,168,0,0,0,168,0,0,0,168,0,66,0,140,0,146,0,152,0,158,0,164,
+0,170,0,176,0,182,0,188,0,194,0,200,0,206,0,212,0,140,0,218,0,164,0,224,0,
+200,0,170,0,230,0,236,0,242,0,248,0,254,0,152,0,170,1,4,1,10,1,16,0,182,1,
+22,1,28,0,224,1,34,0,194,1,40,0,224,1,46,0,164,1,52,1,58,1,58,1,64,1,64,1,
+64,1,64,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,188,0,194,0,200,
+0,206,0,212,0,140,0,164,0,224,0,200,0,170,1,70,0,170,0,1,255,81,4,161,0,1,
+2,219,4,161,0,1,3,2,4,161,0,1,3,246,4,172,0,1,5,27,4,161,0,1,4,115,4,161,
+0,1,3,21,4,161,0,1,2,255,4,161,0,1,3,1,4,161,0,1,3,42,4,161,0,1,2,144,4,161,
+0,1,2,201,4,161,0,1,2,178,4,161,0,1,3,101,4,161,0,1,5,168,4,161,0,1,3,16,
+4,161,0,1,5,235,4,161,0,1,3,33,4,161,0,1,3,62,4,161,0,1,3,50,4,161,0,1,3,
+32,4,161,0,1,3,36,4,161,0,1,3,54,4,161,0,1,3,31,4,161,0,1,3,6,4,161,0,1,3,
+81,4,161,0,1,4,124,4,161,0,1,4,158,4,161,0,1,3,92,4,161,0,1,3,77,4,161,0,
+1,3,122,4,161,0,1,3,61,4,161,0,1,3,40,4,161,0,1,5,104,5,126,0,1,0,12,0,66,
+0,13,0,0,0,180,0,0,0,180,0,0,0,180,0,0,0,180,0,0,0,198,0,0,0,198,0,0,0,180,
+0,0,0,192,0,0,0,192,0,0,0,186,0,0,0,186,0,0,0,198,0,0,0,198,0,62,0,150,0,
+156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,204,0,210,0,216,0,150,0,222,
+0,174,0,228,0,210,0,234,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,26,1,32,1,26,
+1,38,1,44,1,50,1,56,1,62,1,68,1,74,1,56,1,80,1,86,1,92,1,98,1,104,1,110,1,
+116,1,122,1,128,0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,204,
+0,210,0,216,0,150,0,174,0,228,0,210,0,234,0,1,255,81,0,0,0,1,255,28,0,0,0,
+1,254,139,0,0,0,1,254,117,0,0,0,1,2,100,255,223,0,1,2,138,255,223,0,1,3,13,
+255,226,0,1,3,195,255,223,0,1,4,110,255,223,0,1,2,81,255,223,0,1,2,95,255,
+223,0,1,2,106,255,223,0,1,2,151,255,223,0,1,2,82,255,223,0,1,2,191,255,139,
+0,1,2,227,255,223,0,1,4,79,255,223,0,1,3,180,255,238,0,1,2,203,0,0,0,1,5,
+116,255,223,0,1,2,158,254,59,0,1,3,143,254,81,0,1,3,131,254,81,0,1,3,94,254,
+81,0,1,4,80,254,83,0,1,2,94,254,56,0,1,2,109,254,49,0,1,3,138,254,83,0,1,
+2,106,254,52,0,1,2,111,254,23,0,1,2,186,254,46,0,1,4,31,255,106,0,1,5,139,
+255,106,0,1,3,181,255,177,0,1,5,173,255,106,0,1,4,107,255,106,0,1,5,130,255,
+106,0,1,4,92,255,106,0,1,2,153,255,223,0,1,2,197,255,223,0,1,4,219,0,0,0,
+1,4,127,0,0,0,1,4,219,255,206,0,1,4,147,255,207,0,1,4,54,4,76,0,1,0,12,0,
+66,0,13,0,0,0,80,0,0,0,80,0,0,0,80,0,0,0,80,0,0,0,74,0,0,0,74,0,0,0,74,0,
+0,0,80,0,0,0,80,0,0,0,80,0,0,0,80,0,0,0,80,0,0,0,80,0,9,0,32,0,38,0,44,0,
+50,0,56,0,62,0,68,0,74,0,80,0,1,255,83,0,0,0,1,255,81,0,0,0,1,3,175,0,0,0,
+1,4,63,0,0,0,1,3,161,0,0,0,1,3,142,0,0,0,1,3,196,0,0,0,1,3,170,0,0,0,1,3,
+97,0,54,0,1,3,253,0,0,0,1,4,21,0,0,0,1,3,202,3,210,0,1,0,12,0,22,0,2,0,0,
+0,140,0,0,0,140,0,64,0,136,0,142,0,148,0,154,0,160,0,166,0,172,0,178,0,184,
+0,190,0,196,0,136,0,202,0,136,0,208,0,160,0,214,0,196,0,220,0,226,0,232,0,
+238,0,244,0,250,1,0,1,6,1,12,1,18,1,12,1,24,1,30,1,36,1,42,1,48,1,54,1,60,
+1,42,1,66,1,72,1,78,1,84,1,90,1,96,1,102,1,108,1,114,0,136,0,142,0,148,0,
+154,0,160,0,166,0,172,0,178,0,184,0,190,0,196,0,136,0,202,0,136,0,160,1,120,
+0,196,1,126,0,1,255,81,0,0,0,1,2,100,255,223,0,1,2,138,255,223,0,1,3,13,255,
+226,0,1,3,195,255,223,0,1,4,110,255,223,0,1,2,81,255,223,0,1,2,95,255,223,
+0,1,2,106,255,223,0,1,2,151,255,223,0,1,2,64,255,223,0,1,2,118,254,218,0,
+1,2,227,255,223,0,1,4,79,255,223,0,1,2,249,255,93,0,1,2,144,255,74,0,1,5,
+116,255,223,0,1,2,158,254,59,0,1,3,143,254,81,0,1,3,131,254,81,0,1,3,94,254,
+81,0,1,4,80,254,83,0,1,2,94,254,56,0,1,2,109,254,49,0,1,3,138,254,83,0,1,
+2,106,254,53,0,1,2,111,254,23,0,1,2,186,254,46,0,1,3,20,254,193,0,1,4,128,
+254,193,0,1,2,203,255,32,0,1,4,162,254,193,0,1,3,96,254,193,0,1,4,119,254,
+193,0,1,3,81,254,193,0,1,2,153,255,223,0,1,2,197,255,223,0,1,4,219,0,0,0,
+1,4,127,0,0,0,1,4,219,255,206,0,1,4,147,255,207,0,1,3,193,255,93,0,1,3,88,
+255,74,0,1,0,16,0,29,0,30,0,33,0,71,0,72,0,107,1,91,1,95,1,96,1,97,1,98,1,
+99,1,100,1,101,1,102,1,103,0,2,0,1,0,6,0,13,0,0,0,1,0,8,0,33,0,71,0,72,0,
+107,1,91,1,101,1,102,1,103,0,1,0,72,0,35,0,39,0,41,0,42,0,43,0,45,0,46,0,
+47,0,48,0,52,0,56,0,61,0,67,0,136,0,141,0,142,0,147,0,151,0,161,0,191,0,193,
+0,194,0,195,0,196,0,199,0,202,0,203,0,205,0,206,0,208,0,209,0,211,0,215,0,
+216,0,217,0,218,0,219,0,220,0,221,0,224,0,227,0,228,0,230,0,231,0,234,0,235,
+0,237,0,241,0,243,0,244,0,245,0,247,0,248,0,249,0,250,0,254,1,2,1,7,1,13,
+1,40,1,46,1,51,1,55,1,65,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,
+0,2,0,2,0,29,0,30,0,0,1,95,1,100,0,2,0,1,0,66,0,35,0,39,0,41,0,42,0,43,0,
+45,0,46,0,47,0,48,0,52,0,56,0,61,0,67,0,136,0,141,0,142,0,147,0,151,0,161,
+0,191,0,193,0,194,0,195,0,196,0,199,0,202,0,203,0,205,0,206,0,208,0,209,0,
+211,0,215,0,216,0,217,0,218,0,219,0,220,0,221,0,224,0,227,0,228,0,230,0,231,
+0,234,0,235,0,237,0,241,0,243,0,244,0,245,0,247,0,248,0,249,0,250,0,254,1,
+2,1,7,1,13,1,40,1,46,1,51,1,55,1,65,1,114,1,115,0,2,0,3,0,23,0,28,0,0,1,148,
+1,148,0,6,1,156,1,161,0,7,0,1,0,62,0,35,0,39,0,41,0,42,0,43,0,45,0,46,0,47,
+0,48,0,52,0,56,0,67,0,136,0,141,0,142,0,147,0,151,0,161,0,191,0,193,0,194,
+0,195,0,196,0,199,0,202,0,203,0,205,0,206,0,208,0,209,0,211,0,215,0,216,0,
+217,0,218,0,219,0,220,0,221,0,224,0,227,0,228,0,230,0,231,0,234,0,235,0,237,
+0,241,0,243,0,244,0,245,0,247,0,248,0,249,0,250,0,254,1,2,1,13,1,40,1,46,
+1,51,1,55,1,65,0,2,0,3,0,108,0,108,0,0,1,149,1,155,0,1,1,163,1,167,0,8,0,
+1,0,9,0,39,0,41,0,45,0,46,0,47,0,48,0,61,0,227,0,228,0,1,0,2,0,74,1,162,0,
+1,0,64,0,35,0,39,0,41,0,42,0,43,0,45,0,46,0,47,0,48,0,52,0,56,0,61,0,67,0,
+136,0,141,0,142,0,147,0,151,0,161,0,191,0,193,0,194,0,195,0,196,0,199,0,202,
+0,203,0,205,0,206,0,208,0,209,0,211,0,215,0,216,0,217,0,218,0,219,0,220,0,
+221,0,224,0,227,0,228,0,230,0,231,0,234,0,235,0,237,0,241,0,243,0,244,0,245,
+0,247,0,248,0,249,0,250,0,254,1,2,1,7,1,13,1,40,1,46,1,51,1,55,1,65,0,1,0,
+0,0,10,0,118,2,10,0,3,68,70,76,84,0,20,103,106,114,50,0,50,103,117,106,114,
+0,80,0,4,0,0,0,0,255,255,0,10,0,0,0,3,0,6,0,9,0,12,0,14,0,17,0,20,0,23,0,
+25,0,4,0,0,0,0,255,255,0,10,0,1,0,4,0,7,0,10,0,13,0,15,0,18,0,21,0,24,0,26,
+0,4,0,0,0,0,255,255,0,9,0,2,0,5,0,8,0,11,0,16,0,19,0,22,0,27,0,28,0,29,97,
+98,118,115,0,176,97,98,118,115,0,190,97,98,118,115,0,204,97,107,104,110,0,
+218,97,107,104,110,0,224,97,107,104,110,0,230,98,108,119,102,0,236,98,108,
+119,102,0,242,98,108,119,102,0,248,98,108,119,115,0,254,98,108,119,115,1,
+6,98,108,119,115,1,14,99,106,99,116,1,28,99,106,99,116,1,34,104,97,108,102,
+1,40,104,97,108,102,1,48,104,97,108,102,1,56,110,117,107,116,1,62,110,117,
+107,116,1,68,110,117,107,116,1,74,112,114,101,115,1,80,112,114,101,115,1,
+90,112,114,101,115,1,100,114,107,114,102,1,112,114,107,114,102,1,118,114,
+112,104,102,1,124,114,112,104,102,1,130,114,112,104,102,1,136,118,97,116,
+117,1,142,0,0,0,5,0,15,0,16,0,17,0,18,0,19,0,0,0,5,0,15,0,16,0,17,0,18,0,
+19,0,0,0,5,0,15,0,16,0,17,0,18,0,19,0,0,0,1,0,1,0,0,0,1,0,1,0,0,0,1,0,1,0,
+0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,5,0,0,0,2,0,26,0,27,0,0,0,2,0,26,0,27,0,0,
+0,5,0,22,0,23,0,24,0,26,0,27,0,0,0,1,0,9,0,0,0,1,0,9,0,0,0,2,0,6,0,7,0,0,
+0,2,0,6,0,7,0,0,0,1,0,6,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,3,0,10,
+0,11,0,12,0,0,0,3,0,10,0,11,0,12,0,0,0,4,0,9,0,10,0,11,0,12,0,0,0,1,0,3,0,
+0,0,1,0,3,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,1,0,2,0,0,0,1,0,8,0,40,0,82,0,90,
+0,98,0,106,0,114,0,122,0,130,0,138,0,146,0,154,0,162,0,170,0,178,1,30,1,44,
+1,52,1,60,1,68,1,76,1,94,1,104,1,112,1,120,1,128,1,136,1,144,1,152,1,164,
+1,172,1,180,1,188,1,196,1,204,1,212,1,220,1,228,1,236,1,244,1,252,2,4,0,4,
+0,0,0,1,1,186,0,4,0,0,0,1,3,80,0,4,0,0,0,1,3,106,0,4,0,0,0,1,3,116,0,4,0,
+0,0,1,6,130,0,4,0,0,0,1,6,140,0,4,0,0,0,1,6,150,0,4,0,0,0,1,9,4,0,4,0,0,0,
+1,11,90,0,4,0,0,0,1,16,80,0,2,0,0,0,1,17,130,0,4,0,0,0,1,17,214,0,6,0,0,0,
+51,18,136,18,154,18,172,18,190,18,208,18,226,18,246,19,10,19,30,19,50,19,
+70,19,88,19,108,19,128,19,148,19,168,19,188,19,208,19,228,19,248,20,12,20,
+32,20,52,20,72,20,92,20,112,20,130,20,150,20,170,20,190,20,210,20,230,20,
+250,21,14,21,34,21,54,21,74,21,94,21,114,21,134,21,154,21,174,21,194,21,214,
+21,234,21,254,22,18,22,38,22,58,22,78,22,98,0,6,0,0,0,4,22,10,22,28,22,46,
+22,64,0,1,0,0,0,1,22,68,0,6,0,0,0,1,22,74,0,4,0,0,0,1,22,88,0,4,0,0,0,1,22,
+166,0,6,1,0,0,6,23,40,23,60,23,82,23,102,23,124,23,144,0,6,1,0,0,2,23,148,
+23,168,0,2,0,0,0,1,23,180,0,1,0,0,0,1,23,194,0,6,0,0,0,1,23,196,0,6,0,0,0,
+1,23,206,0,4,0,0,0,1,23,220,0,2,0,0,0,1,24,34,0,6,0,0,0,3,24,168,24,186,24,
+204,0,4,0,0,0,1,24,210,0,1,0,0,0,1,25,164,0,1,0,0,0,1,25,162,0,1,0,0,0,1,
+25,160,0,1,0,0,0,1,25,158,0,1,0,0,0,1,25,156,0,1,0,0,0,1,25,154,0,1,0,0,0,
+1,25,152,0,1,0,0,0,1,25,154,0,1,0,0,0,1,25,152,0,1,0,0,0,1,25,150,0,1,1,0,
+0,1,25,164,0,1,1,0,0,1,25,162,0,1,25,190,0,34,0,74,0,84,0,94,0,104,0,114,
+0,124,0,134,0,144,0,154,0,164,0,174,0,184,0,194,0,204,0,214,0,224,0,234,0,
+244,0,254,1,8,1,18,1,28,1,38,1,48,1,58,1,68,1,78,1,88,1,98,1,108,1,118,1,
+128,1,138,1,148,0,1,0,4,0,237,0,2,0,75,0,1,0,4,0,238,0,2,0,75,0,1,0,4,0,239,
+0,2,0,75,0,1,0,4,0,240,0,2,0,75,0,1,0,4,0,241,0,2,0,75,0,1,0,4,0,242,0,2,
+0,75,0,1,0,4,0,243,0,2,0,75,0,1,0,4,0,244,0,2,0,75,0,1,0,4,0,245,0,2,0,75,
+0,1,0,4,0,246,0,2,0,75,0,1,0,4,0,247,0,2,0,75,0,1,0,4,0,248,0,2,0,75,0,1,
+0,4,0,249,0,2,0,75,0,1,0,4,0,250,0,2,0,75,0,1,0,4,0,251,0,2,0,75,0,1,0,4,
+0,252,0,2,0,75,0,1,0,4,0,253,0,2,0,75,0,1,0,4,0,254,0,2,0,75,0,1,0,4,0,255,
+0,2,0,75,0,1,0,4,1,0,0,2,0,75,0,1,0,4,1,1,0,2,0,75,0,1,0,4,1,2,0,2,0,75,0,
+1,0,4,1,3,0,2,0,75,0,1,0,4,1,4,0,2,0,75,0,1,0,4,1,5,0,2,0,75,0,1,0,4,1,6,
+0,2,0,75,0,1,0,4,1,7,0,2,0,75,0,1,0,4,1,8,0,2,0,75,0,1,0,4,1,9,0,2,0,75,0,
+1,0,4,1,10,0,2,0,75,0,1,0,4,1,11,0,2,0,75,0,1,0,4,1,12,0,2,0,75,0,1,0,4,1,
+13,0,2,0,75,0,1,0,4,1,14,0,2,0,75,0,1,24,42,0,2,0,10,0,22,0,1,0,4,0,69,0,
+3,0,74,0,65,0,1,0,4,0,70,0,3,0,74,0,44,0,1,24,16,0,1,0,8,0,1,0,4,0,107,0,
+2,0,74,0,1,24,4,0,56,0,118,0,130,0,142,0,154,0,166,0,178,0,190,0,202,0,214,
+0,226,0,238,0,250,1,6,1,18,1,30,1,42,1,54,1,66,1,78,1,90,1,102,1,114,1,126,
+1,138,1,150,1,162,1,174,1,186,1,198,1,210,1,222,1,234,1,246,2,2,2,14,2,26,
+2,38,2,50,2,62,2,74,2,86,2,98,2,110,2,122,2,134,2,146,2,158,2,170,2,182,2,
+194,2,206,2,218,2,230,2,242,2,254,3,10,0,1,0,4,0,136,0,3,0,74,0,61,0,1,0,
+4,0,137,0,3,0,74,0,61,0,1,0,4,0,138,0,3,0,74,0,61,0,1,0,4,0,139,0,3,0,74,
+0,61,0,1,0,4,0,140,0,3,0,74,0,61,0,1,0,4,0,141,0,3,0,74,0,61,0,1,0,4,0,142,
+0,3,0,74,0,61,0,1,0,4,0,143,0,3,0,74,0,61,0,1,0,4,0,144,0,3,0,74,0,61,0,1,
+0,4,0,145,0,3,0,74,0,61,0,1,0,4,0,146,0,3,0,74,0,61,0,1,0,4,0,147,0,3,0,74,
+0,61,0,1,0,4,0,148,0,3,0,74,0,61,0,1,0,4,0,149,0,3,0,74,0,61,0,1,0,4,0,150,
+0,3,0,74,0,61,0,1,0,4,0,151,0,3,0,74,0,61,0,1,0,4,0,152,0,3,0,74,0,61,0,1,
+0,4,0,153,0,3,0,74,0,61,0,1,0,4,0,154,0,3,0,74,0,61,0,1,0,4,0,155,0,3,0,74,
+0,61,0,1,0,4,0,156,0,3,0,74,0,61,0,1,0,4,0,157,0,3,0,74,0,61,0,1,0,4,0,158,
+0,3,0,74,0,61,0,1,0,4,0,159,0,3,0,74,0,61,0,1,0,4,0,160,0,3,0,74,0,61,0,1,
+0,4,0,161,0,3,0,74,0,61,0,1,0,4,0,162,0,3,0,74,0,61,0,1,0,4,0,163,0,3,0,74,
+0,61,0,1,0,4,0,164,0,3,0,74,0,61,0,1,0,4,1,40,0,3,0,74,0,61,0,1,0,4,1,41,
+0,3,0,74,0,61,0,1,0,4,1,42,0,3,0,74,0,61,0,1,0,4,1,43,0,3,0,74,0,61,0,1,0,
+4,1,44,0,3,0,74,0,61,0,1,0,4,1,45,0,3,0,74,0,61,0,1,0,4,1,46,0,3,0,74,0,61,
+0,1,0,4,1,47,0,3,0,74,0,61,0,1,0,4,1,48,0,3,0,74,0,61,0,1,0,4,1,49,0,3,0,
+74,0,61,0,1,0,4,1,50,0,3,0,74,0,61,0,1,0,4,1,51,0,3,0,74,0,61,0,1,0,4,1,52,
+0,3,0,74,0,61,0,1,0,4,1,53,0,3,0,74,0,61,0,1,0,4,1,54,0,3,0,74,0,61,0,1,0,
+4,1,55,0,3,0,74,0,61,0,1,0,4,1,56,0,3,0,74,0,61,0,1,0,4,1,57,0,3,0,74,0,61,
+0,1,0,4,1,58,0,3,0,74,0,61,0,1,0,4,1,59,0,3,0,74,0,61,0,1,0,4,1,60,0,3,0,
+74,0,61,0,1,0,4,1,61,0,3,0,74,0,61,0,1,0,4,1,62,0,3,0,74,0,61,0,1,0,4,1,63,
+0,3,0,74,0,61,0,1,0,4,1,64,0,3,0,74,0,61,0,1,0,4,1,65,0,3,0,74,0,61,0,1,0,
+4,1,66,0,3,0,74,0,61,0,1,21,46,0,1,0,8,0,1,0,4,0,108,0,2,0,61,0,1,20,214,
+0,1,0,8,0,1,0,4,0,108,0,2,0,74,0,1,21,16,0,52,0,110,0,120,0,130,0,140,0,150,
+0,160,0,170,0,180,0,190,0,200,0,210,0,220,0,230,0,240,0,250,1,4,1,14,1,24,
+1,34,1,44,1,54,1,64,1,74,1,84,1,94,1,104,1,114,1,124,1,134,1,144,1,154,1,
+164,1,174,1,184,1,194,1,204,1,214,1,224,1,234,1,244,1,254,2,8,2,18,2,28,2,
+38,2,48,2,58,2,68,2,78,2,88,2,98,2,108,0,1,0,4,0,109,0,2,0,74,0,1,0,4,0,110,
+0,2,0,74,0,1,0,4,0,111,0,2,0,74,0,1,0,4,0,112,0,2,0,74,0,1,0,4,0,113,0,2,
+0,74,0,1,0,4,0,114,0,2,0,74,0,1,0,4,0,115,0,2,0,74,0,1,0,4,0,116,0,2,0,74,
+0,1,0,4,0,117,0,2,0,74,0,1,0,4,0,118,0,2,0,74,0,1,0,4,0,119,0,2,0,74,0,1,
+0,4,0,120,0,2,0,74,0,1,0,4,0,121,0,2,0,74,0,1,0,4,0,122,0,2,0,74,0,1,0,4,
+0,123,0,2,0,74,0,1,0,4,0,124,0,2,0,74,0,1,0,4,0,125,0,2,0,74,0,1,0,4,0,126,
+0,2,0,74,0,1,0,4,0,127,0,2,0,74,0,1,0,4,0,128,0,2,0,74,0,1,0,4,0,129,0,2,
+0,74,0,1,0,4,0,130,0,2,0,74,0,1,0,4,0,131,0,2,0,74,0,1,0,4,0,132,0,2,0,74,
+0,1,0,4,0,133,0,2,0,74,0,1,0,4,0,134,0,2,0,74,0,1,0,4,0,135,0,2,0,74,0,1,
+0,4,1,15,0,2,0,74,0,1,0,4,1,16,0,2,0,74,0,1,0,4,1,17,0,2,0,74,0,1,0,4,1,18,
+0,2,0,74,0,1,0,4,1,19,0,2,0,74,0,1,0,4,1,20,0,2,0,74,0,1,0,4,1,21,0,2,0,74,
+0,1,0,4,1,22,0,2,0,74,0,1,0,4,1,23,0,2,0,74,0,1,0,4,1,24,0,2,0,74,0,1,0,4,
+1,25,0,2,0,74,0,1,0,4,1,26,0,2,0,74,0,1,0,4,1,27,0,2,0,74,0,1,0,4,1,28,0,
+2,0,74,0,1,0,4,1,29,0,2,0,74,0,1,0,4,1,30,0,2,0,74,0,1,0,4,1,31,0,2,0,74,
+0,1,0,4,1,32,0,2,0,74,0,1,0,4,1,33,0,2,0,74,0,1,0,4,1,34,0,2,0,74,0,1,0,4,
+1,35,0,2,0,74,0,1,0,4,1,36,0,2,0,74,0,1,0,4,1,37,0,2,0,74,0,1,0,4,1,38,0,
+2,0,74,0,1,0,4,1,39,0,2,0,74,0,1,18,242,0,50,0,106,0,116,0,126,0,136,0,146,
+0,156,0,166,0,176,0,186,0,196,0,206,0,216,0,226,0,236,0,246,1,0,1,10,1,20,
+1,30,1,40,1,50,1,60,1,70,1,80,1,90,1,100,1,110,1,120,1,130,1,140,1,150,1,
+160,1,170,1,180,1,190,1,200,1,210,1,220,1,230,1,240,1,250,2,4,2,14,2,24,2,
+34,2,44,2,54,2,64,2,74,2,84,0,1,0,4,0,165,0,2,0,74,0,1,0,4,0,166,0,2,0,74,
+0,1,0,4,0,167,0,2,0,74,0,1,0,4,0,168,0,2,0,74,0,1,0,4,0,169,0,2,0,74,0,1,
+0,4,0,170,0,2,0,74,0,1,0,4,0,171,0,2,0,74,0,1,0,4,0,172,0,2,0,74,0,1,0,4,
+0,173,0,2,0,74,0,1,0,4,0,174,0,2,0,74,0,1,0,4,0,175,0,2,0,74,0,1,0,4,0,176,
+0,2,0,74,0,1,0,4,0,177,0,2,0,74,0,1,0,4,0,178,0,2,0,74,0,1,0,4,0,179,0,2,
+0,74,0,1,0,4,0,180,0,2,0,74,0,1,0,4,0,181,0,2,0,74,0,1,0,4,0,182,0,2,0,74,
+0,1,0,4,0,183,0,2,0,74,0,1,0,4,0,184,0,2,0,74,0,1,0,4,0,185,0,2,0,74,0,1,
+0,4,0,186,0,2,0,74,0,1,0,4,0,187,0,2,0,74,0,1,0,4,0,188,0,2,0,74,0,1,0,4,
+0,189,0,2,0,74,0,1,0,4,0,190,0,2,0,74,0,1,0,4,1,67,0,2,0,74,0,1,0,4,1,68,
+0,2,0,74,0,1,0,4,1,69,0,2,0,74,0,1,0,4,1,70,0,2,0,74,0,1,0,4,1,71,0,2,0,74,
+0,1,0,4,1,72,0,2,0,74,0,1,0,4,1,73,0,2,0,74,0,1,0,4,1,74,0,2,0,74,0,1,0,4,
+1,75,0,2,0,74,0,1,0,4,1,76,0,2,0,74,0,1,0,4,1,77,0,2,0,74,0,1,0,4,1,78,0,
+2,0,74,0,1,0,4,1,79,0,2,0,74,0,1,0,4,1,80,0,2,0,74,0,1,0,4,1,81,0,2,0,74,
+0,1,0,4,1,82,0,2,0,74,0,1,0,4,1,83,0,2,0,74,0,1,0,4,1,84,0,2,0,74,0,1,0,4,
+1,85,0,2,0,74,0,1,0,4,1,86,0,2,0,74,0,1,0,4,1,87,0,2,0,74,0,1,0,4,1,88,0,
+2,0,74,0,1,0,4,1,89,0,2,0,74,0,1,0,4,1,90,0,2,0,74,0,1,16,200,0,106,0,218,
+0,228,0,238,0,248,1,2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,1,92,1,102,
+1,112,1,122,1,132,1,142,1,152,1,162,1,172,1,182,1,192,1,202,1,212,1,222,1,
+232,1,242,1,252,2,6,2,16,2,26,2,36,2,46,2,56,2,66,2,76,2,86,2,96,2,106,2,
+116,2,126,2,136,2,146,2,156,2,166,2,176,2,186,2,196,2,206,2,216,2,226,2,236,
+2,246,3,0,3,10,3,20,3,30,3,40,3,50,3,60,3,70,3,80,3,90,3,100,3,110,3,120,
+3,130,3,140,3,150,3,160,3,170,3,180,3,190,3,200,3,210,3,220,3,230,3,240,3,
+250,4,4,4,14,4,24,4,34,4,44,4,54,4,64,4,74,4,84,4,94,4,104,4,114,4,124,4,
+134,4,144,4,154,4,164,4,174,4,184,4,194,4,204,4,214,4,224,4,234,4,244,0,1,
+0,4,0,136,0,2,0,108,0,1,0,4,0,137,0,2,0,108,0,1,0,4,0,138,0,2,0,108,0,1,0,
+4,0,139,0,2,0,108,0,1,0,4,0,140,0,2,0,108,0,1,0,4,0,141,0,2,0,108,0,1,0,4,
+0,142,0,2,0,108,0,1,0,4,0,143,0,2,0,108,0,1,0,4,0,144,0,2,0,108,0,1,0,4,0,
+145,0,2,0,108,0,1,0,4,0,146,0,2,0,108,0,1,0,4,0,147,0,2,0,108,0,1,0,4,0,148,
+0,2,0,108,0,1,0,4,0,149,0,2,0,108,0,1,0,4,0,150,0,2,0,108,0,1,0,4,0,151,0,
+2,0,108,0,1,0,4,0,152,0,2,0,108,0,1,0,4,0,153,0,2,0,108,0,1,0,4,0,154,0,2,
+0,108,0,1,0,4,0,155,0,2,0,108,0,1,0,4,0,156,0,2,0,108,0,1,0,4,0,157,0,2,0,
+108,0,1,0,4,0,158,0,2,0,108,0,1,0,4,0,159,0,2,0,108,0,1,0,4,0,160,0,2,0,108,
+0,1,0,4,0,161,0,2,0,108,0,1,0,4,0,162,0,2,0,108,0,1,0,4,0,163,0,2,0,108,0,
+1,0,4,0,164,0,2,0,108,0,1,0,4,0,165,0,2,0,108,0,1,0,4,0,166,0,2,0,108,0,1,
+0,4,0,167,0,2,0,108,0,1,0,4,0,168,0,2,0,108,0,1,0,4,0,169,0,2,0,108,0,1,0,
+4,0,170,0,2,0,108,0,1,0,4,0,171,0,2,0,108,0,1,0,4,0,172,0,2,0,108,0,1,0,4,
+0,173,0,2,0,108,0,1,0,4,0,174,0,2,0,108,0,1,0,4,0,175,0,2,0,108,0,1,0,4,0,
+176,0,2,0,108,0,1,0,4,0,177,0,2,0,108,0,1,0,4,0,178,0,2,0,108,0,1,0,4,0,179,
+0,2,0,108,0,1,0,4,0,180,0,2,0,108,0,1,0,4,0,181,0,2,0,108,0,1,0,4,0,182,0,
+2,0,108,0,1,0,4,0,183,0,2,0,108,0,1,0,4,0,184,0,2,0,108,0,1,0,4,0,185,0,2,
+0,108,0,1,0,4,0,186,0,2,0,108,0,1,0,4,0,187,0,2,0,108,0,1,0,4,0,188,0,2,0,
+108,0,1,0,4,0,189,0,2,0,108,0,1,0,4,0,190,0,2,0,108,0,1,0,4,1,40,0,2,0,108,
+0,1,0,4,1,41,0,2,0,108,0,1,0,4,1,42,0,2,0,108,0,1,0,4,1,43,0,2,0,108,0,1,
+0,4,1,44,0,2,0,108,0,1,0,4,1,45,0,2,0,108,0,1,0,4,1,46,0,2,0,108,0,1,0,4,
+1,47,0,2,0,108,0,1,0,4,1,48,0,2,0,108,0,1,0,4,1,49,0,2,0,108,0,1,0,4,1,50,
+0,2,0,108,0,1,0,4,1,51,0,2,0,108,0,1,0,4,1,52,0,2,0,108,0,1,0,4,1,53,0,2,
+0,108,0,1,0,4,1,54,0,2,0,108,0,1,0,4,1,55,0,2,0,108,0,1,0,4,1,56,0,2,0,108,
+0,1,0,4,1,57,0,2,0,108,0,1,0,4,1,58,0,2,0,108,0,1,0,4,1,59,0,2,0,108,0,1,
+0,4,1,60,0,2,0,108,0,1,0,4,1,61,0,2,0,108,0,1,0,4,1,62,0,2,0,108,0,1,0,4,
+1,63,0,2,0,108,0,1,0,4,1,64,0,2,0,108,0,1,0,4,1,65,0,2,0,108,0,1,0,4,1,66,
+0,2,0,108,0,1,0,4,1,67,0,2,0,108,0,1,0,4,1,68,0,2,0,108,0,1,0,4,1,69,0,2,
+0,108,0,1,0,4,1,70,0,2,0,108,0,1,0,4,1,71,0,2,0,108,0,1,0,4,1,72,0,2,0,108,
+0,1,0,4,1,73,0,2,0,108,0,1,0,4,1,74,0,2,0,108,0,1,0,4,1,75,0,2,0,108,0,1,
+0,4,1,76,0,2,0,108,0,1,0,4,1,77,0,2,0,108,0,1,0,4,1,78,0,2,0,108,0,1,0,4,
+1,79,0,2,0,108,0,1,0,4,1,80,0,2,0,108,0,1,0,4,1,81,0,2,0,108,0,1,0,4,1,82,
+0,2,0,108,0,1,0,4,1,83,0,2,0,108,0,1,0,4,1,84,0,2,0,108,0,1,0,4,1,85,0,2,
+0,108,0,1,0,4,1,86,0,2,0,108,0,1,0,4,1,87,0,2,0,108,0,1,0,4,1,88,0,2,0,108,
+0,1,0,4,1,89,0,2,0,108,0,1,0,4,1,90,0,2,0,108,0,1,12,28,0,7,0,20,0,72,0,94,
+0,136,0,158,0,190,0,212,0,5,0,12,0,20,0,28,0,36,0,44,0,193,0,3,0,74,0,35,
+0,194,0,3,0,74,0,37,0,195,0,3,0,74,0,38,0,196,0,3,0,74,0,59,0,197,0,3,0,74,
+0,60,0,2,0,6,0,14,0,198,0,3,0,74,0,60,0,199,0,3,0,74,0,63,0,4,0,10,0,18,0,
+26,0,34,0,202,0,3,0,74,0,45,0,203,0,3,0,74,0,46,0,204,0,3,0,74,0,60,0,205,
+0,3,0,74,0,63,0,2,0,6,0,14,0,206,0,3,0,74,0,46,0,207,0,3,0,74,0,60,0,3,0,
+8,0,16,0,24,0,208,0,3,0,74,0,47,0,209,0,3,0,74,0,48,0,210,0,3,0,74,0,60,0,
+2,0,6,0,14,0,211,0,3,0,74,0,48,0,212,0,3,0,74,0,60,0,10,0,22,0,30,0,38,0,
+46,0,54,0,62,0,70,0,78,0,86,0,94,0,215,0,3,0,74,0,37,0,216,0,3,0,74,0,38,
+0,217,0,3,0,74,0,52,0,218,0,3,0,74,0,53,0,219,0,3,0,74,0,54,0,220,0,3,0,74,
+0,57,0,221,0,3,0,74,0,58,0,222,0,3,0,74,0,59,0,223,0,3,0,74,0,60,0,224,0,
+3,0,74,0,63,0,1,10,244,0,10,0,26,0,32,0,38,0,44,0,52,0,60,0,66,0,74,0,80,
+0,86,0,2,0,4,0,20,0,2,0,4,0,29,0,2,0,4,0,30,0,3,0,4,0,20,0,29,0,3,0,4,0,20,
+0,30,0,2,0,4,0,33,0,3,0,4,0,20,0,33,0,2,0,20,0,29,0,2,0,20,0,30,0,2,0,20,
+0,33,0,1,10,176,0,9,0,24,0,42,0,60,0,78,0,88,0,98,0,116,0,126,0,176,0,2,0,
+6,0,12,0,191,0,2,0,35,0,192,0,2,0,60,0,2,0,6,0,12,0,200,0,2,0,40,0,201,0,
+2,0,42,0,2,0,6,0,12,0,213,0,2,0,50,0,214,0,2,0,117,0,1,0,4,0,225,0,2,0,60,
+0,1,0,4,0,226,0,2,0,40,0,2,0,6,0,12,0,227,0,2,0,45,0,228,0,2,0,46,0,1,0,4,
+0,229,0,2,0,145,0,6,0,14,0,20,0,26,0,32,0,38,0,44,0,230,0,2,0,49,0,231,0,
+2,0,54,0,232,0,2,0,59,0,233,0,2,0,60,0,234,0,2,0,62,0,235,0,2,0,63,0,1,0,
+4,0,236,0,2,0,60,0,3,0,0,0,1,10,12,0,1,10,18,0,1,0,0,0,28,0,3,0,0,0,1,9,250,
+0,1,10,38,0,1,0,0,0,29,0,3,0,0,0,1,9,232,0,1,10,62,0,1,0,0,0,30,0,3,0,0,0,
+1,9,214,0,1,10,96,0,1,0,0,0,31,0,3,0,0,0,1,9,196,0,1,10,118,0,1,0,0,0,32,
+0,3,0,0,0,1,9,178,0,2,10,136,10,148,0,1,0,0,0,32,0,3,0,0,0,1,9,158,0,2,10,
+136,10,148,0,1,0,0,0,32,0,3,0,0,0,1,9,138,0,2,10,138,10,146,0,1,0,0,0,32,
+0,3,0,0,0,1,9,118,0,2,10,142,10,150,0,1,0,0,0,32,0,3,0,0,0,1,9,98,0,2,10,
+156,10,168,0,1,0,0,0,32,0,3,0,0,0,1,9,78,0,1,10,154,0,1,0,0,0,33,0,3,0,0,
+0,1,9,60,0,2,10,152,10,50,0,1,0,0,0,33,0,3,0,0,0,1,9,40,0,2,10,98,10,140,
+0,1,0,0,0,33,0,3,0,0,0,1,9,20,0,2,10,164,10,172,0,1,0,0,0,33,0,3,0,0,0,1,
+9,0,0,2,10,208,10,216,0,1,0,0,0,33,0,3,0,0,0,1,8,236,0,2,10,250,11,2,0,1,
+0,0,0,33,0,3,0,0,0,1,8,216,0,2,11,34,11,46,0,1,0,0,0,33,0,3,0,0,0,1,8,196,
+0,2,11,66,9,166,0,1,0,0,0,33,0,3,0,0,0,1,8,176,0,2,9,200,11,56,0,1,0,0,0,
+33,0,3,0,0,0,1,8,156,0,2,11,116,9,164,0,1,0,0,0,33,0,3,0,0,0,1,8,136,0,2,
+11,104,11,110,0,1,0,0,0,33,0,3,0,0,0,1,8,116,0,2,11,164,11,174,0,1,0,0,0,
+33,0,3,0,0,0,1,8,96,0,2,11,174,11,180,0,1,0,0,0,33,0,3,0,0,0,1,8,76,0,2,11,
+218,11,226,0,1,0,0,0,33,0,3,0,0,0,1,8,56,0,2,11,234,11,242,0,1,0,0,0,33,0,
+3,0,0,0,1,8,36,0,1,12,10,0,1,0,0,0,34,0,3,0,0,0,1,8,18,0,2,9,226,12,14,0,
+1,0,0,0,34,0,3,0,0,0,1,7,254,0,2,12,112,12,118,0,1,0,0,0,34,0,3,0,0,0,1,7,
+234,0,2,11,156,12,234,0,1,0,0,0,34,0,3,0,0,0,1,7,214,0,2,13,82,13,94,0,1,
+0,0,0,34,0,3,0,0,0,1,7,194,0,2,9,30,13,194,0,1,0,0,0,34,0,3,0,0,0,1,7,174,
+0,2,10,252,14,60,0,1,0,0,0,34,0,3,0,0,0,1,7,154,0,2,14,164,14,170,0,1,0,0,
+0,34,0,3,0,0,0,1,7,134,0,2,9,22,14,188,0,1,0,0,0,34,0,3,0,0,0,1,7,114,0,2,
+11,0,15,36,0,1,0,0,0,34,0,3,0,0,0,1,7,94,0,2,8,152,15,170,0,1,0,0,0,34,0,
+3,0,0,0,1,7,74,0,2,10,34,16,18,0,1,0,0,0,34,0,3,0,0,0,1,7,54,0,2,16,152,8,
+24,0,1,0,0,0,34,0,3,0,0,0,1,7,34,0,2,9,160,16,138,0,1,0,0,0,34,0,3,0,0,0,
+1,7,14,0,2,16,254,17,6,0,1,0,0,0,34,0,3,0,0,0,1,6,250,0,2,17,128,17,134,0,
+1,0,0,0,34,0,3,0,0,0,1,6,230,0,2,7,254,17,250,0,1,0,0,0,34,0,3,0,0,0,1,6,
+210,0,2,18,78,18,84,0,1,0,0,0,34,0,3,0,0,0,1,6,190,0,2,8,204,18,166,0,1,0,
+0,0,34,0,3,0,0,0,1,6,170,0,2,19,20,19,36,0,1,0,0,0,34,0,3,0,0,0,1,6,150,0,
+2,19,158,19,168,0,1,0,0,0,34,0,3,0,0,0,1,6,130,0,2,20,28,20,36,0,1,0,0,0,
+34,0,3,0,0,0,1,6,110,0,2,20,152,20,160,0,1,0,0,0,34,0,3,0,0,0,1,6,90,0,2,
+9,58,20,238,0,1,0,0,0,34,0,3,0,0,0,1,6,70,0,2,21,82,21,88,0,1,0,0,0,34,0,
+3,0,0,0,1,6,50,0,2,8,124,21,182,0,1,0,0,0,34,0,3,0,0,0,1,4,180,0,1,22,36,
+0,1,0,0,0,34,0,3,0,0,0,1,4,162,0,1,22,24,0,1,0,0,0,35,0,3,0,0,0,1,4,144,0,
+1,22,12,0,1,0,0,0,36,0,3,0,0,0,1,4,126,0,1,22,0,0,1,0,0,0,37,0,2,21,244,0,
+4,0,107,0,107,0,107,0,107,0,3,0,0,0,2,4,94,21,230,0,0,0,2,0,0,0,13,0,1,0,
+14,0,1,21,218,0,4,0,14,0,32,0,50,0,68,0,2,0,6,0,12,1,104,0,2,0,20,1,108,0,
+2,0,22,0,2,0,6,0,12,1,105,0,2,0,20,1,109,0,2,0,22,0,2,0,6,0,12,1,106,0,2,
+0,20,1,110,0,2,0,22,0,2,0,6,0,12,1,107,0,2,0,20,1,111,0,2,0,22,0,1,21,144,
+0,5,0,16,0,44,0,72,0,100,0,128,0,3,0,8,0,16,0,22,1,94,0,3,0,107,0,71,1,92,
+0,2,0,71,1,93,0,2,0,107,0,3,0,8,0,16,0,22,1,97,0,3,0,107,0,71,1,95,0,2,0,
+71,1,96,0,2,0,107,0,3,0,8,0,16,0,22,1,100,0,3,0,107,0,71,1,98,0,2,0,71,1,
+99,0,2,0,107,0,3,0,8,0,16,0,22,1,103,0,3,0,107,0,71,1,101,0,2,0,71,1,102,
+0,2,0,107,0,1,0,4,1,91,0,2,0,71,0,3,0,0,0,1,21,20,0,2,21,30,21,58,0,1,0,0,
+0,37,0,3,0,0,0,1,21,0,0,3,21,44,21,10,21,38,0,1,0,0,0,37,0,3,0,0,0,1,20,234,
+0,2,20,244,21,44,0,1,0,0,0,38,0,3,0,0,0,1,20,214,0,3,21,2,20,224,21,24,0,
+1,0,0,0,38,0,3,0,0,0,1,20,192,0,2,20,202,21,8,0,1,0,0,0,39,0,3,0,0,0,1,20,
+172,0,3,20,216,20,182,20,244,0,1,0,0,0,39,0,3,0,2,20,160,20,228,0,1,20,238,
+0,0,0,1,0,0,0,39,0,3,0,3,20,140,20,174,20,208,0,1,20,218,0,0,0,1,0,0,0,39,
+0,1,20,206,0,2,0,10,0,16,0,2,0,67,0,74,0,2,1,13,0,74,0,2,20,192,0,2,0,108,
+0,74,0,3,0,0,0,1,20,174,0,1,20,190,0,1,0,0,0,20,0,3,0,0,0,2,2,212,20,172,
+0,0,0,2,0,0,0,21,0,1,0,21,0,1,20,156,0,6,0,18,0,28,0,38,0,48,0,58,0,68,0,
+1,0,4,0,142,0,2,0,108,0,1,0,4,0,147,0,2,0,108,0,1,0,4,0,161,0,2,0,108,0,1,
+0,4,1,46,0,2,0,108,0,1,0,4,1,51,0,2,0,108,0,1,0,4,1,65,0,2,0,108,0,1,20,94,
+0,17,0,40,0,46,0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,0,106,0,112,
+0,118,0,124,0,130,0,136,0,2,0,35,0,75,0,2,0,39,0,75,0,2,0,41,0,75,0,2,0,42,
+0,75,0,2,0,45,0,75,0,2,0,46,0,75,0,2,0,47,0,75,0,2,0,48,0,75,0,2,0,52,0,75,
+0,2,0,56,0,75,0,2,0,61,0,75,0,2,0,67,0,75,0,2,0,136,0,75,0,2,0,141,0,75,0,
+2,0,147,0,75,0,2,0,151,0,75,0,2,0,161,0,75,0,3,0,0,0,1,19,246,0,1,20,2,0,
+1,0,0,0,39,0,3,0,1,20,0,0,1,20,16,0,0,0,1,0,0,0,39,0,3,0,0,0,1,19,172,0,1,
+20,4,0,1,0,0,0,25,0,1,20,6,0,5,0,16,0,26,0,44,0,54,0,160,0,1,0,4,1,114,0,
+2,0,25,0,2,0,6,0,12,1,112,0,2,0,23,1,113,0,2,0,24,0,1,0,4,1,115,0,2,0,25,
+0,12,0,26,0,34,0,42,0,50,0,58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,1,164,0,
+3,0,108,0,23,1,165,0,3,0,108,0,24,1,166,0,3,0,108,0,25,1,167,0,3,0,108,0,
+74,1,156,0,2,0,23,1,157,0,2,0,24,1,158,0,2,0,25,1,159,0,2,0,26,1,160,0,2,
+0,27,1,161,0,2,0,28,1,162,0,2,0,74,1,163,0,2,0,108,0,7,0,16,0,22,0,28,0,34,
+0,40,0,46,0,52,1,149,0,2,0,23,1,150,0,2,0,24,1,151,0,2,0,25,1,152,0,2,0,26,
+1,153,0,2,0,27,1,154,0,2,0,28,1,155,0,2,0,74,0,1,1,246,1,95,0,1,1,240,1,96,
+0,1,1,234,1,97,0,1,1,228,1,98,0,1,1,222,1,99,0,1,1,216,1,100,0,2,19,22,0,
+2,1,122,0,10,0,1,0,94,255,206,0,1,0,88,255,207,0,2,19,8,0,8,0,13,1,123,1,
+124,1,125,1,126,1,127,1,128,1,129,0,1,17,232,0,14,0,2,18,252,0,15,1,148,1,
+144,0,1,0,1,1,145,1,146,1,147,0,1,1,137,1,138,1,139,1,140,1,141,1,142,1,143,
+0,2,0,1,0,35,0,68,0,0,0,1,0,2,0,35,0,42,0,1,0,1,0,61,0,2,0,10,0,35,0,38,0,
+0,0,40,0,40,0,4,0,42,0,44,0,5,0,49,0,60,0,8,0,62,0,70,0,20,0,237,0,240,0,
+29,0,242,0,242,0,33,0,244,0,246,0,34,0,251,1,6,0,37,1,8,1,14,0,49,0,1,0,1,
+0,74,0,2,0,14,0,35,0,38,0,0,0,40,0,40,0,4,0,42,0,42,0,5,0,44,0,44,0,6,0,49,
+0,51,0,7,0,53,0,60,0,10,0,62,0,70,0,18,0,237,0,240,0,27,0,242,0,242,0,31,
+0,244,0,244,0,32,0,246,0,246,0,33,0,251,0,253,0,34,0,255,1,6,0,37,1,8,1,14,
+0,45,0,2,0,8,0,136,0,141,0,0,0,143,0,146,0,6,0,148,0,160,0,10,0,162,0,164,
+0,23,1,40,1,45,0,26,1,47,1,50,0,32,1,52,1,64,0,36,1,66,1,66,0,49,0,2,0,13,
+0,35,0,38,0,0,0,40,0,40,0,4,0,42,0,44,0,5,0,49,0,60,0,8,0,62,0,70,0,20,0,
+109,0,131,0,29,0,133,0,135,0,52,0,237,0,240,0,55,0,242,0,242,0,59,0,244,0,
+246,0,60,0,251,1,6,0,63,1,8,1,37,0,75,1,39,1,39,0,105,0,1,0,7,0,39,0,41,0,
+45,0,46,0,47,0,48,0,52,0,1,0,10,0,5,0,14,0,15,0,16,0,17,0,18,0,19,0,31,0,
+32,0,34,0,1,0,9,0,109,0,115,0,117,0,122,0,129,0,130,0,131,0,132,0,133,0,1,
+0,1,0,21,0,1,0,17,0,35,0,39,0,45,0,46,0,47,0,52,0,56,0,61,0,136,0,151,0,161,
+0,202,0,203,0,206,0,208,0,209,0,217,0,1,0,19,0,41,0,48,0,67,0,147,0,193,0,
+194,0,195,0,196,0,199,0,205,0,211,0,215,0,219,0,220,0,224,0,230,0,231,0,234,
+0,235,0,1,0,24,0,38,0,42,0,50,0,51,0,53,0,54,0,55,0,59,0,60,0,63,0,65,0,139,
+0,145,0,146,0,148,0,149,0,150,0,154,0,155,0,157,0,159,0,223,0,227,0,228,0,
+1,0,18,0,37,0,40,0,43,0,44,0,62,0,66,0,138,0,140,0,141,0,142,0,143,0,156,
+0,158,0,213,0,216,0,218,0,221,0,222,0,1,0,16,0,36,0,57,0,58,0,64,0,68,0,69,
+0,70,0,137,0,152,0,153,0,160,0,162,0,164,0,191,0,232,0,233,0,1,0,4,0,125,
+0,126,0,181,0,182,0,1,0,2,0,52,0,61,0,1,0,4,0,121,0,128,0,177,0,184,0,1,0,
+3,0,52,0,61,0,217,0,1,0,2,0,117,0,173,0,1,0,6,0,52,0,61,0,147,0,215,0,217,
+0,219,0,1,0,2,0,120,0,176,0,1,0,11,0,45,0,47,0,52,0,56,0,61,0,147,0,151,0,
+215,0,217,0,219,0,224,0,1,0,4,0,119,0,130,0,175,0,186,0,1,0,1,0,52,0,1,0,
+6,0,49,0,144,0,163,0,200,0,201,0,226,0,1,0,2,0,134,0,185,0,1,0,20,0,35,0,
+39,0,45,0,46,0,47,0,48,0,56,0,61,0,136,0,147,0,151,0,202,0,203,0,208,0,209,
+0,215,0,217,0,219,0,220,0,224,0,1,0,2,0,121,0,177,0,1,0,26,0,35,0,39,0,45,
+0,46,0,47,0,48,0,50,0,54,0,55,0,56,0,136,0,147,0,149,0,150,0,151,0,202,0,
+203,0,205,0,206,0,208,0,209,0,215,0,219,0,220,0,224,0,227,0,1,0,2,0,128,0,
+184,0,1,0,25,0,35,0,39,0,45,0,46,0,47,0,48,0,54,0,55,0,56,0,136,0,147,0,149,
+0,150,0,151,0,202,0,203,0,205,0,206,0,208,0,209,0,215,0,219,0,220,0,224,0,
+227,0,1,0,2,0,126,0,182,0,1,0,24,0,35,0,39,0,45,0,46,0,47,0,48,0,54,0,56,
+0,136,0,147,0,149,0,151,0,202,0,203,0,205,0,206,0,208,0,209,0,215,0,217,0,
+219,0,220,0,224,0,227,0,1,0,4,0,112,0,118,0,168,0,174,0,1,0,18,0,35,0,45,
+0,46,0,47,0,48,0,52,0,56,0,61,0,136,0,147,0,151,0,208,0,209,0,215,0,217,0,
+219,0,220,0,224,0,1,0,3,0,131,0,132,0,187,0,1,0,38,0,35,0,39,0,46,0,48,0,
+50,0,51,0,53,0,54,0,55,0,60,0,63,0,65,0,67,0,136,0,145,0,146,0,148,0,149,
+0,150,0,155,0,157,0,159,0,161,0,193,0,194,0,195,0,196,0,202,0,203,0,205,0,
+206,0,208,0,209,0,211,0,220,0,223,0,227,0,228,0,1,0,2,0,127,0,183,0,1,0,1,
+0,173,0,1,0,35,0,35,0,39,0,45,0,46,0,47,0,48,0,50,0,54,0,55,0,56,0,63,0,65,
+0,67,0,136,0,149,0,150,0,151,0,157,0,159,0,161,0,193,0,194,0,195,0,196,0,
+202,0,203,0,205,0,206,0,208,0,209,0,211,0,220,0,224,0,227,0,228,0,1,0,3,0,
+113,0,169,0,214,0,1,0,8,0,45,0,47,0,52,0,61,0,147,0,215,0,217,0,219,0,1,0,
+1,0,117,0,1,0,27,0,35,0,39,0,45,0,46,0,47,0,48,0,50,0,54,0,55,0,56,0,136,
+0,149,0,150,0,151,0,161,0,193,0,196,0,202,0,203,0,205,0,206,0,208,0,209,0,
+211,0,220,0,224,0,227,0,1,0,2,0,111,0,167,0,1,0,12,0,45,0,47,0,52,0,56,0,
+61,0,147,0,151,0,208,0,215,0,217,0,219,0,224,0,1,0,2,0,125,0,181,0,1,0,20,
+0,35,0,39,0,45,0,46,0,47,0,48,0,56,0,136,0,147,0,151,0,202,0,203,0,206,0,
+208,0,209,0,215,0,217,0,219,0,220,0,224,0,1,0,9,0,192,0,197,0,204,0,207,0,
+210,0,212,0,225,0,229,0,236,0,2,0,19,0,36,0,38,0,0,0,40,0,44,0,3,0,49,0,51,
+0,8,0,53,0,53,0,11,0,57,0,60,0,12,0,62,0,70,0,16,0,137,0,146,0,25,0,148,0,
+148,0,35,0,152,0,164,0,36,0,193,0,196,0,49,0,199,0,199,0,53,0,211,0,211,0,
+54,0,213,0,213,0,55,0,216,0,216,0,56,0,218,0,218,0,57,0,221,0,223,0,58,0,
+226,0,226,0,61,0,228,0,228,0,62,0,230,0,235,0,63,0,1,0,1,0,214,0,2,0,22,0,
+35,0,44,0,0,0,46,0,46,0,10,0,48,0,48,0,11,0,50,0,51,0,12,0,53,0,60,0,14,0,
+62,0,70,0,22,0,136,0,140,0,31,0,142,0,143,0,36,0,145,0,146,0,38,0,148,0,162,
+0,40,0,193,0,196,0,55,0,199,0,199,0,59,0,202,0,203,0,60,0,205,0,206,0,62,
+0,208,0,209,0,64,0,211,0,211,0,66,0,213,0,213,0,67,0,216,0,216,0,68,0,218,
+0,218,0,69,0,220,0,224,0,70,0,227,0,228,0,75,0,230,0,235,0,77,0,2,0,20,0,
+36,0,38,0,0,0,40,0,44,0,3,0,50,0,51,0,8,0,53,0,55,0,10,0,57,0,60,0,13,0,62,
+0,70,0,17,0,137,0,143,0,26,0,145,0,146,0,33,0,148,0,150,0,35,0,152,0,164,
+0,38,0,193,0,196,0,51,0,199,0,199,0,55,0,205,0,205,0,56,0,211,0,211,0,57,
+0,213,0,213,0,58,0,216,0,216,0,59,0,218,0,218,0,60,0,221,0,223,0,61,0,227,
+0,228,0,64,0,230,0,235,0,66,0,1,0,4,0,110,0,124,0,166,0,180,0,1,0,58,0,35,
+0,37,0,38,0,39,0,40,0,45,0,46,0,47,0,48,0,50,0,51,0,52,0,53,0,54,0,55,0,56,
+0,59,0,60,0,61,0,63,0,65,0,67,0,136,0,138,0,139,0,140,0,145,0,146,0,147,0,
+148,0,149,0,150,0,151,0,154,0,155,0,157,0,159,0,161,0,193,0,194,0,195,0,196,
+0,202,0,203,0,205,0,206,0,208,0,209,0,211,0,213,0,215,0,217,0,219,0,220,0,
+223,0,224,0,227,0,228,0,2,0,23,0,35,0,35,0,0,0,37,0,48,0,1,0,50,0,51,0,13,
+0,53,0,57,0,15,0,59,0,60,0,20,0,62,0,69,0,22,0,136,0,136,0,30,0,138,0,140,
+0,31,0,142,0,143,0,34,0,145,0,152,0,36,0,154,0,162,0,44,0,193,0,196,0,53,
+0,199,0,199,0,57,0,202,0,203,0,58,0,205,0,206,0,60,0,208,0,209,0,62,0,211,
+0,211,0,64,0,213,0,213,0,65,0,215,0,216,0,66,0,218,0,224,0,68,0,227,0,228,
+0,75,0,230,0,231,0,77,0,234,0,235,0,79,0,2,0,20,0,36,0,38,0,0,0,40,0,44,0,
+3,0,49,0,49,0,8,0,51,0,51,0,9,0,53,0,53,0,10,0,57,0,60,0,11,0,62,0,70,0,15,
+0,137,0,146,0,24,0,148,0,148,0,34,0,152,0,160,0,35,0,162,0,164,0,44,0,194,
+0,195,0,47,0,199,0,201,0,49,0,213,0,213,0,52,0,216,0,216,0,53,0,218,0,218,
+0,54,0,221,0,223,0,55,0,226,0,226,0,58,0,228,0,228,0,59,0,230,0,235,0,60,
+0,1,0,1,0,114,0,1,0,17,0,35,0,45,0,46,0,47,0,52,0,56,0,61,0,136,0,147,0,151,
+0,208,0,209,0,215,0,217,0,219,0,220,0,224,0,2,0,20,0,36,0,38,0,0,0,40,0,44,
+0,3,0,49,0,49,0,8,0,51,0,51,0,9,0,53,0,53,0,10,0,57,0,60,0,11,0,62,0,70,0,
+15,0,137,0,146,0,24,0,148,0,148,0,34,0,152,0,164,0,35,0,193,0,196,0,48,0,
+199,0,199,0,52,0,211,0,211,0,53,0,213,0,213,0,54,0,216,0,216,0,55,0,218,0,
+218,0,56,0,221,0,223,0,57,0,226,0,226,0,60,0,228,0,228,0,61,0,230,0,235,0,
+62,0,2,0,25,0,35,0,44,0,0,0,46,0,46,0,10,0,48,0,48,0,11,0,50,0,51,0,12,0,
+53,0,55,0,14,0,57,0,60,0,17,0,62,0,70,0,21,0,136,0,140,0,30,0,142,0,143,0,
+35,0,145,0,146,0,37,0,148,0,150,0,39,0,152,0,162,0,42,0,164,0,164,0,53,0,
+193,0,196,0,54,0,199,0,199,0,58,0,202,0,203,0,59,0,205,0,206,0,61,0,209,0,
+209,0,63,0,211,0,211,0,64,0,213,0,213,0,65,0,216,0,216,0,66,0,218,0,218,0,
+67,0,220,0,223,0,68,0,227,0,228,0,72,0,230,0,235,0,74,0,2,0,20,0,36,0,38,
+0,0,0,40,0,44,0,3,0,50,0,51,0,8,0,53,0,55,0,10,0,57,0,60,0,13,0,62,0,70,0,
+17,0,137,0,143,0,26,0,145,0,146,0,33,0,148,0,150,0,35,0,152,0,164,0,38,0,
+193,0,196,0,51,0,199,0,199,0,55,0,205,0,206,0,56,0,211,0,211,0,58,0,213,0,
+213,0,59,0,216,0,216,0,60,0,218,0,218,0,61,0,221,0,223,0,62,0,227,0,228,0,
+65,0,230,0,235,0,67,0,2,0,25,0,35,0,35,0,0,0,37,0,48,0,1,0,50,0,51,0,13,0,
+53,0,57,0,15,0,59,0,60,0,20,0,62,0,70,0,22,0,136,0,136,0,31,0,138,0,140,0,
+32,0,142,0,143,0,35,0,145,0,146,0,37,0,148,0,152,0,39,0,154,0,162,0,44,0,
+193,0,196,0,53,0,199,0,199,0,57,0,202,0,203,0,58,0,205,0,206,0,60,0,208,0,
+209,0,62,0,211,0,211,0,64,0,213,0,213,0,65,0,216,0,216,0,66,0,218,0,218,0,
+67,0,220,0,224,0,68,0,227,0,228,0,73,0,230,0,231,0,75,0,234,0,235,0,77,0,
+1,0,1,0,170,0,2,0,22,0,35,0,35,0,0,0,37,0,48,0,1,0,50,0,51,0,13,0,53,0,57,
+0,15,0,59,0,60,0,20,0,62,0,69,0,22,0,136,0,136,0,30,0,138,0,140,0,31,0,142,
+0,143,0,34,0,145,0,152,0,36,0,154,0,162,0,44,0,193,0,196,0,53,0,199,0,199,
+0,57,0,202,0,203,0,58,0,205,0,206,0,60,0,208,0,209,0,62,0,211,0,211,0,64,
+0,213,0,213,0,65,0,215,0,224,0,66,0,227,0,228,0,76,0,230,0,231,0,78,0,234,
+0,235,0,80,0,1,0,2,0,113,0,169,0,2,0,23,0,35,0,44,0,0,0,46,0,46,0,10,0,48,
+0,48,0,11,0,50,0,51,0,12,0,53,0,60,0,14,0,62,0,70,0,22,0,136,0,140,0,31,0,
+142,0,143,0,36,0,145,0,146,0,38,0,148,0,162,0,40,0,164,0,164,0,55,0,193,0,
+196,0,56,0,199,0,199,0,60,0,202,0,203,0,61,0,205,0,206,0,63,0,208,0,209,0,
+65,0,211,0,211,0,67,0,213,0,213,0,68,0,216,0,216,0,69,0,218,0,218,0,70,0,
+220,0,224,0,71,0,227,0,228,0,76,0,230,0,235,0,78,0,1,0,1,0,129,0,2,0,22,0,
+35,0,35,0,0,0,37,0,48,0,1,0,50,0,56,0,13,0,59,0,63,0,20,0,65,0,67,0,25,0,
+136,0,136,0,28,0,138,0,140,0,29,0,142,0,143,0,32,0,145,0,151,0,34,0,154,0,
+159,0,41,0,161,0,161,0,47,0,193,0,196,0,48,0,199,0,199,0,52,0,202,0,203,0,
+53,0,205,0,206,0,55,0,208,0,209,0,57,0,211,0,211,0,59,0,213,0,213,0,60,0,
+215,0,224,0,61,0,227,0,228,0,71,0,230,0,231,0,73,0,234,0,235,0,75,0,1,0,50,
+0,36,0,37,0,38,0,40,0,41,0,42,0,43,0,44,0,49,0,57,0,58,0,59,0,62,0,64,0,66,
+0,68,0,69,0,70,0,137,0,138,0,139,0,140,0,141,0,142,0,143,0,144,0,152,0,153,
+0,154,0,156,0,158,0,160,0,162,0,163,0,164,0,199,0,200,0,201,0,213,0,216,0,
+218,0,221,0,222,0,226,0,230,0,231,0,232,0,233,0,234,0,235,0,1,0,1,0,189,0,
+1,0,49,0,35,0,39,0,45,0,46,0,47,0,48,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,
+60,0,61,0,63,0,65,0,67,0,136,0,145,0,146,0,147,0,148,0,149,0,150,0,151,0,
+155,0,157,0,159,0,161,0,193,0,194,0,195,0,196,0,202,0,203,0,205,0,206,0,208,
+0,209,0,211,0,215,0,217,0,219,0,220,0,223,0,224,0,227,0,228,0,2,0,21,0,36,
+0,38,0,0,0,40,0,44,0,3,0,49,0,51,0,8,0,53,0,53,0,11,0,55,0,55,0,12,0,57,0,
+60,0,13,0,62,0,70,0,17,0,137,0,146,0,26,0,148,0,148,0,36,0,150,0,150,0,37,
+0,152,0,164,0,38,0,193,0,196,0,51,0,199,0,199,0,55,0,211,0,211,0,56,0,213,
+0,213,0,57,0,216,0,216,0,58,0,218,0,218,0,59,0,221,0,223,0,60,0,226,0,226,
+0,63,0,228,0,228,0,64,0,230,0,235,0,65,0,1,0,6,0,109,0,115,0,122,0,165,0,
+171,0,178,0,2,0,23,0,35,0,35,0,0,0,37,0,41,0,1,0,43,0,48,0,6,0,50,0,56,0,
+12,0,59,0,63,0,19,0,65,0,67,0,24,0,136,0,136,0,27,0,138,0,140,0,28,0,142,
+0,143,0,31,0,145,0,151,0,33,0,154,0,159,0,40,0,161,0,161,0,46,0,193,0,196,
+0,47,0,199,0,199,0,51,0,202,0,203,0,52,0,205,0,206,0,54,0,208,0,209,0,56,
+0,211,0,211,0,58,0,213,0,213,0,59,0,215,0,224,0,60,0,227,0,228,0,70,0,230,
+0,231,0,72,0,234,0,235,0,74,0,1,0,3,0,123,0,135,0,179,0,2,0,22,0,35,0,35,
+0,0,0,37,0,40,0,1,0,45,0,48,0,5,0,50,0,56,0,9,0,59,0,63,0,16,0,65,0,67,0,
+21,0,136,0,136,0,24,0,138,0,140,0,25,0,145,0,151,0,28,0,154,0,159,0,35,0,
+161,0,161,0,41,0,193,0,196,0,42,0,199,0,199,0,46,0,202,0,203,0,47,0,205,0,
+206,0,49,0,208,0,209,0,51,0,211,0,211,0,53,0,213,0,213,0,54,0,215,0,224,0,
+55,0,227,0,228,0,65,0,231,0,231,0,67,0,235,0,235,0,68,0,1,0,2,0,133,0,188,
+0,2,0,22,0,35,0,35,0,0,0,37,0,41,0,1,0,45,0,48,0,6,0,50,0,56,0,10,0,59,0,
+63,0,17,0,65,0,67,0,22,0,136,0,136,0,25,0,138,0,140,0,26,0,145,0,151,0,29,
+0,154,0,159,0,36,0,161,0,161,0,42,0,193,0,196,0,43,0,199,0,199,0,47,0,202,
+0,203,0,48,0,205,0,206,0,50,0,208,0,209,0,52,0,211,0,211,0,54,0,213,0,213,
+0,55,0,215,0,224,0,56,0,227,0,228,0,66,0,231,0,231,0,68,0,235,0,235,0,69,
+0,1,0,2,0,116,0,172,0,1,0,47,0,35,0,39,0,45,0,46,0,47,0,48,0,50,0,52,0,53,
+0,54,0,55,0,56,0,60,0,61,0,63,0,65,0,67,0,136,0,145,0,147,0,148,0,149,0,150,
+0,151,0,155,0,157,0,159,0,161,0,193,0,194,0,195,0,196,0,202,0,203,0,205,0,
+206,0,208,0,209,0,211,0,215,0,217,0,219,0,220,0,223,0,224,0,227,0,228,0,1,
+0,58,0,36,0,37,0,38,0,40,0,41,0,42,0,43,0,44,0,49,0,51,0,53,0,57,0,58,0,59,
+0,60,0,62,0,64,0,66,0,68,0,69,0,70,0,137,0,138,0,139,0,140,0,141,0,142,0,
+143,0,144,0,145,0,146,0,148,0,152,0,153,0,154,0,155,0,156,0,158,0,160,0,162,
+0,163,0,164,0,199,0,200,0,201,0,213,0,216,0,218,0,221,0,222,0,223,0,226,0,
+230,0,231,0,232,0,233,0,234,0,235,0,1,0,1,0,190,0,1,0,55,0,35,0,37,0,38,0,
+39,0,45,0,46,0,47,0,48,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,59,0,60,0,61,
+0,63,0,65,0,67,0,136,0,138,0,139,0,145,0,146,0,147,0,148,0,149,0,150,0,151,
+0,154,0,155,0,157,0,159,0,161,0,193,0,194,0,195,0,196,0,202,0,203,0,205,0,
+206,0,208,0,209,0,211,0,215,0,217,0,219,0,220,0,223,0,224,0,227,0,228,0,2,
+0,21,0,36,0,44,0,0,0,50,0,51,0,9,0,53,0,55,0,11,0,57,0,60,0,14,0,62,0,70,
+0,18,0,137,0,143,0,27,0,145,0,146,0,34,0,148,0,150,0,36,0,152,0,162,0,39,
+0,164,0,164,0,50,0,193,0,196,0,51,0,199,0,199,0,55,0,202,0,203,0,56,0,205,
+0,206,0,58,0,211,0,211,0,60,0,213,0,213,0,61,0,216,0,216,0,62,0,218,0,218,
+0,63,0,221,0,223,0,64,0,227,0,228,0,67,0,230,0,235,0,69,0,1,0,1,0,25,0,1,
+0,1,0,26,0,1,0,1,0,27,0,1,0,1,0,28,0,2,0,1,0,25,0,28,0,0,0,1,0,4,0,42,0,141,
+0,244,1,45,0,1,0,5,0,22,0,29,0,30,0,33,0,107,0,2,0,1,1,116,1,122,0,0,0,2,
+0,4,0,35,0,70,0,0,0,136,0,164,0,36,0,191,0,213,0,65,0,215,0,236,0,88,0,1,
+0,1,0,71,0,2,0,3,0,109,0,135,0,0,0,165,0,190,0,27,0,214,0,214,0,53,0,1,0,
+1,0,107,0,1,0,1,1,91,0,2,0,1,1,123,1,143,0,0,0,1,0,3,0,71,0,107,1,91,0,1,
+0,2,0,132,1,38,0,1,0,2,0,74,0,108,0,1,0,1,0,108,0,1,0,6,0,43,0,52,0,67,0,
+245,0,254,1,13,0,1,0,17,0,237,0,241,0,243,0,244,0,247,0,248,0,249,0,250,0,
+254,1,2,1,7,1,13,1,40,1,45,1,51,1,55,1,65,0,1,0,4,0,49,0,144,0,251,1,48,0,
+2,0,2,0,23,0,28,0,0,0,74,0,74,0,6,0,1,0,6,0,69,0,163,1,144,1,145,1,146,1,
+147,0,1,0,1,0,23,0,1,0,8,0,23,0,24,0,25,0,26,0,27,0,28,0,74,0,108,0,1,0,5,
+0,52,0,61,0,67,0,75,0,108,0,1,0,2,0,21,0,61,0,2,0,2,0,61,0,61,0,0,1,116,1,
+122,0,1,0,1,0,15,0,23,0,49,0,71,0,107,0,144,0,251,1,48,1,91,1,116,1,117,1,
+118,1,119,1,120,1,121,1,122,0,0,};
+#endif
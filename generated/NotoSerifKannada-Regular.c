@@ -0,0 +1,4080 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifKannada_Regular_ttf_size = 96936;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifKannada_Regular_ttf");
+asm(".type fz_font_NotoSerifKannada_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifKannada_Regular_ttf, 96936");
+asm(".balign 64");
+asm("fz_font_NotoSerifKannada_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifKannada-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifKannada_Regular_ttf_size = 96936;
+const char fz_font_NotoSerifKannada_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,5,147,5,137,0,1,104,8,0,0,0,52,71,
+80,79,83,182,184,185,225,0,1,104,60,0,0,1,244,71,83,85,66,95,16,159,132,0,
+1,106,48,0,0,16,120,79,83,47,50,124,146,103,122,0,0,1,104,0,0,0,96,99,109,
+97,112,47,190,32,252,0,0,8,164,0,0,1,128,103,97,115,112,0,7,0,7,0,1,103,252,
+0,0,0,12,103,108,121,102,196,142,27,83,0,0,13,148,0,1,67,212,104,101,97,100,
+12,176,153,234,0,0,0,236,0,0,0,54,104,104,101,97,14,103,7,8,0,0,1,36,0,0,
+0,36,104,109,116,120,182,123,182,25,0,0,1,200,0,0,6,220,108,111,99,97,124,
+27,204,98,0,0,10,36,0,0,3,112,109,97,120,112,1,208,1,186,0,0,1,72,0,0,0,32,
+110,97,109,101,141,42,185,229,0,1,81,104,0,0,6,10,112,111,115,116,38,43,46,
+214,0,1,87,116,0,0,16,136,0,1,0,0,0,1,2,143,74,19,66,120,95,15,60,245,0,11,
+8,0,0,0,0,0,211,96,15,128,0,0,0,0,211,110,65,34,250,92,250,81,12,103,7,106,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,161,250,68,0,0,12,210,250,92,254,58,12,
+103,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,183,0,1,0,0,1,183,0,225,0,16,0,215,
+0,5,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,5,183,1,144,0,5,0,0,5,154,5,51,
+0,0,1,124,5,154,5,51,0,0,2,138,0,102,2,58,0,0,2,2,5,2,4,5,4,2,2,4,0,64,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,161,250,68,0,0,7,
+161,5,188,0,0,0,1,0,0,0,0,4,106,5,134,0,0,0,32,0,3,4,205,0,193,0,0,0,0,1,
+219,0,0,1,219,0,0,6,168,0,107,6,71,0,107,5,58,0,90,7,118,0,60,8,47,0,107,
+11,42,0,107,9,49,0,80,11,238,0,80,6,98,0,80,9,180,0,80,6,28,0,95,6,35,0,95,
+5,255,0,107,5,231,0,100,5,231,0,100,6,79,0,100,3,80,254,95,0,0,253,39,3,77,
+253,39,2,179,255,41,5,110,255,43,1,234,255,18,4,203,255,18,0,0,253,118,0,
+0,253,118,0,0,253,121,3,77,253,121,1,126,253,121,5,110,253,121,8,187,253,
+121,3,5,253,189,3,77,0,107,1,126,254,62,4,162,0,116,6,159,0,80,4,252,0,120,
+7,48,0,110,5,244,0,100,6,48,0,100,6,117,0,107,5,236,0,100,10,24,0,111,6,168,
+0,90,6,85,0,112,5,10,0,111,6,29,0,111,6,29,0,111,6,86,0,110,4,245,0,110,5,
+251,0,111,5,251,0,111,5,251,0,111,5,118,0,111,5,234,0,110,5,234,0,110,6,6,
+0,100,6,14,0,100,8,158,0,110,10,4,0,107,5,10,0,111,5,220,0,107,6,6,0,110,
+5,59,0,105,6,12,0,110,4,251,0,100,6,101,0,111,6,160,0,107,5,81,0,82,6,160,
+0,107,4,181,0,100,0,0,253,229,2,171,0,100,2,1,254,62,0,0,254,158,3,166,255,
+246,4,56,0,90,5,93,0,40,5,10,0,118,5,42,0,108,5,64,0,57,5,30,0,64,5,148,0,
+107,6,72,0,80,4,228,0,111,5,3,0,88,6,87,0,118,4,233,0,123,2,31,0,200,3,224,
+0,200,4,121,0,121,0,0,0,0,0,0,255,213,0,0,255,33,4,193,0,98,4,56,0,100,0,
+78,254,115,0,240,253,184,0,0,254,26,1,153,253,153,0,0,253,102,0,0,252,250,
+0,0,252,169,0,0,253,102,0,0,250,92,0,0,252,191,0,141,252,241,0,0,253,164,
+0,21,253,101,0,0,253,80,0,0,253,24,0,0,252,136,0,33,253,102,0,0,253,69,0,
+33,253,102,0,158,253,153,0,88,253,30,0,88,253,30,0,240,254,14,0,240,254,14,
+1,24,254,140,0,164,254,34,0,170,252,121,0,0,252,242,0,57,253,55,0,214,254,
+173,0,155,253,151,0,96,254,23,0,0,253,2,0,0,252,248,0,132,253,250,0,0,252,
+237,0,0,252,252,1,10,253,180,1,24,252,136,1,244,252,136,0,234,252,136,1,112,
+253,195,0,0,252,83,1,22,252,241,1,22,253,101,0,228,252,136,0,0,252,63,1,112,
+253,30,1,252,254,14,4,162,0,116,6,159,0,80,4,252,0,120,7,48,0,110,6,119,0,
+100,6,48,0,100,6,117,0,107,5,236,0,100,10,24,0,111,7,52,0,90,6,85,0,112,5,
+10,0,111,6,29,0,111,6,29,0,111,6,27,0,110,4,245,0,110,5,251,0,111,5,251,0,
+111,5,251,0,111,5,118,0,111,5,234,0,110,5,234,0,110,6,62,0,100,6,14,0,100,
+8,148,0,100,10,4,0,107,5,10,0,111,5,220,0,107,6,6,0,110,5,57,0,105,6,2,0,
+100,4,251,0,100,6,101,0,111,6,229,0,107,5,73,0,82,6,229,0,107,6,163,0,116,
+8,160,0,80,6,233,0,120,9,92,0,110,9,232,0,100,8,78,0,100,8,118,0,107,7,237,
+0,100,12,25,0,111,10,193,0,90,8,44,0,112,7,11,0,111,8,30,0,111,8,30,0,111,
+8,18,0,110,6,246,0,110,7,252,0,111,7,252,0,111,7,252,0,111,7,119,0,111,7,
+235,0,110,7,235,0,110,8,63,0,100,8,63,0,100,10,149,0,100,12,5,0,107,7,11,
+0,111,8,25,0,107,8,7,0,110,7,58,0,105,7,234,0,100,6,250,0,100,8,51,0,111,
+10,126,0,107,7,144,0,82,10,120,0,107,9,92,0,100,9,189,0,112,9,123,0,110,4,
+162,0,119,6,215,0,80,4,247,0,115,7,43,0,105,5,244,0,100,6,33,0,100,6,110,
+0,107,5,236,0,100,10,23,0,110,6,168,0,90,6,85,0,112,5,9,0,111,6,29,0,111,
+6,29,0,111,6,86,0,110,4,231,0,102,5,236,0,102,5,236,0,102,5,236,0,102,5,109,
+0,101,5,225,0,105,5,225,0,105,6,43,0,100,6,43,0,100,8,138,0,90,10,4,0,107,
+5,9,0,111,6,14,0,107,5,253,0,105,5,54,0,96,5,248,0,90,4,251,0,100,6,85,0,
+107,6,160,0,107,5,161,0,82,6,163,0,107,9,101,0,110,9,1,0,90,7,241,0,110,7,
+241,0,110,7,236,0,110,7,150,0,82,12,56,0,110,11,207,0,90,11,67,0,110,11,67,
+0,110,11,62,0,110,10,68,0,82,4,162,0,115,6,197,0,80,4,252,0,120,7,48,0,110,
+8,99,0,100,6,43,0,100,6,118,0,107,6,16,0,100,10,24,0,111,8,250,0,90,6,93,
+0,112,5,24,0,111,6,53,0,111,6,53,0,111,6,27,0,110,4,247,0,110,6,19,0,111,
+5,255,0,111,5,255,0,111,5,142,0,111,5,234,0,110,5,234,0,110,6,70,0,100,6,
+48,0,100,8,148,0,100,10,4,0,107,5,24,0,111,5,224,0,107,6,14,0,110,5,62,0,
+105,6,2,0,100,4,253,0,100,6,101,0,111,8,160,0,107,5,94,0,82,8,160,0,107,12,
+56,0,110,11,217,0,100,12,210,0,111,12,188,0,90,11,67,0,110,11,67,0,110,11,
+89,0,100,12,183,0,107,11,62,0,110,12,39,0,107,10,68,0,82,12,39,0,107,9,62,
+0,100,9,71,0,112,9,71,0,110,3,175,255,209,4,43,254,243,0,0,254,58,0,0,254,
+58,4,162,0,116,4,162,0,116,6,163,0,116,4,162,0,119,4,162,0,115,5,236,0,100,
+5,236,0,100,7,237,0,100,5,236,0,100,6,16,0,100,3,199,0,240,6,169,0,240,4,
+48,0,240,2,203,0,240,4,40,0,240,0,0,254,26,4,240,0,240,0,0,253,102,0,0,252,
+250,0,0,252,169,0,0,253,102,0,0,250,92,0,0,252,191,4,140,0,240,0,0,253,164,
+3,160,0,240,0,0,253,80,0,0,253,24,4,104,0,240,3,171,0,240,0,0,253,69,3,171,
+0,240,3,245,0,240,4,42,0,240,4,42,0,240,3,210,0,240,3,210,0,240,3,124,0,240,
+3,114,0,240,2,88,254,79,0,0,252,242,3,242,0,240,3,25,0,240,3,244,0,240,3,
+57,0,240,0,0,253,2,0,0,252,248,3,122,0,240,0,0,252,237,0,0,252,252,4,70,0,
+240,5,128,0,240,6,92,0,240,5,82,0,240,4,157,0,240,0,0,252,83,5,21,0,240,4,
+161,0,240,5,76,0,240,0,0,252,63,5,66,0,240,4,222,0,240,2,170,0,211,3,68,0,
+117,4,121,0,51,7,43,0,92,1,195,0,117,2,197,0,117,2,197,0,66,4,0,0,84,4,121,
+0,133,2,0,0,61,2,123,0,51,2,0,0,127,2,78,0,0,4,121,0,92,4,121,0,135,4,121,
+0,104,4,121,0,119,4,121,0,35,4,121,0,113,4,121,0,125,4,121,0,121,4,121,0,
+94,4,121,0,104,2,74,0,166,2,74,0,98,4,121,0,133,4,121,0,133,4,121,0,133,4,
+0,0,88,2,225,0,205,2,78,0,0,2,225,0,76,4,121,0,104,3,172,255,246,3,109,0,
+102,4,121,1,254,3,109,0,102,4,121,0,111,2,123,0,51,4,0,255,246,8,0,255,246,
+2,0,0,115,2,0,0,61,3,154,0,115,3,154,0,61,6,221,0,164,4,121,0,145,4,121,0,
+133,4,121,0,133,6,29,2,147,5,251,2,120,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,116,
+0,0,0,80,0,64,0,5,0,16,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,160,0,173,0,215,
+0,247,9,101,12,131,12,139,12,140,12,144,12,148,12,168,12,176,12,179,12,185,
+12,189,12,196,12,200,12,205,12,214,12,222,12,227,12,239,12,242,32,13,32,20,
+32,25,32,29,32,38,32,185,34,18,37,204,254,255,255,255,0,0,0,0,0,13,0,32,0,
+37,0,39,0,91,0,123,0,160,0,173,0,215,0,247,9,100,12,129,12,133,12,140,12,
+142,12,146,12,149,12,170,12,177,12,181,12,188,12,190,12,198,12,202,12,213,
+12,222,12,224,12,230,12,241,32,11,32,19,32,24,32,28,32,38,32,185,34,18,37,
+204,254,255,255,255,0,1,255,245,0,0,1,98,1,97,1,70,1,43,255,99,0,253,0,219,
+0,188,246,247,0,0,243,127,243,128,243,128,243,127,243,144,243,143,0,0,243,
+140,243,145,243,86,243,87,0,0,243,78,243,106,0,0,243,107,243,94,224,83,225,
+152,225,149,225,147,225,139,223,164,223,162,218,149,1,95,0,1,0,0,0,0,0,76,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,
+0,0,0,0,0,0,0,52,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,3,1,132,1,133,1,134,0,74,0,73,0,75,0,70,0,64,0,71,0,32,0,33,0,34,0,
+76,0,11,0,13,0,27,0,28,0,0,0,21,0,21,0,21,0,21,0,114,0,223,1,63,1,188,2,57,
+2,231,3,125,4,59,4,145,5,26,5,101,5,187,6,25,6,111,6,215,7,103,7,160,7,218,
+7,229,8,14,8,92,8,166,9,22,9,93,9,180,9,233,9,244,9,255,10,10,10,25,10,100,
+10,160,10,248,11,74,11,182,11,237,12,126,12,252,13,111,13,234,14,95,14,241,
+15,105,15,230,16,54,16,167,16,178,17,29,17,122,17,136,17,218,17,229,18,58,
+18,166,18,177,19,15,19,137,19,254,20,121,20,184,21,10,21,96,21,195,22,60,
+22,155,22,252,23,117,23,232,24,94,24,140,24,183,24,254,25,52,25,90,25,148,
+25,204,26,18,26,67,26,128,26,185,27,18,27,126,28,0,28,73,28,135,28,232,29,
+53,29,66,29,78,29,132,29,132,29,145,29,175,30,181,30,228,31,31,31,134,31,
+163,32,23,32,142,32,240,33,85,33,191,34,49,34,167,35,2,35,58,35,144,35,242,
+36,88,36,132,36,214,37,12,37,78,37,152,37,225,38,54,38,142,38,243,39,64,39,
+158,39,194,40,1,40,91,40,183,41,9,41,67,41,134,41,243,42,81,42,189,43,65,
+44,15,44,88,44,175,45,18,45,108,45,166,46,32,46,150,46,223,47,50,47,152,48,
+14,48,82,48,188,48,230,49,98,49,247,50,94,50,203,51,62,51,207,52,92,52,213,
+53,21,53,120,53,131,53,244,54,66,54,80,54,150,54,161,54,231,55,67,55,176,
+56,9,56,117,56,231,57,94,57,142,57,219,58,37,58,120,58,226,59,49,59,132,60,
+18,60,119,61,2,61,112,62,4,62,87,62,253,63,191,64,80,64,230,65,131,66,62,
+66,247,67,156,68,7,68,147,68,158,69,56,69,175,69,189,70,45,70,56,70,167,71,
+45,71,56,71,186,72,79,72,234,73,140,73,231,74,94,74,209,75,77,75,224,76,88,
+76,212,77,142,78,29,78,212,79,99,80,9,80,163,80,255,81,129,81,195,82,98,83,
+10,83,138,84,16,84,161,85,60,85,223,86,117,86,206,87,71,87,82,87,232,88,94,
+88,108,88,201,88,212,89,49,89,170,89,181,90,40,90,51,90,177,91,52,91,126,
+91,230,92,72,92,192,93,70,93,178,94,33,94,196,95,66,95,225,96,145,97,43,97,
+186,97,197,98,60,98,204,99,162,100,101,101,24,101,35,101,191,102,117,102,
+243,103,145,103,226,104,161,105,112,106,16,106,180,107,95,108,10,108,217,
+109,123,109,228,110,110,110,121,111,36,111,162,111,176,112,29,112,40,112,
+149,113,26,113,37,113,165,114,56,114,201,115,92,115,181,116,43,116,157,117,
+24,117,170,118,33,118,156,119,87,119,229,120,157,121,180,122,213,123,164,
+124,202,125,150,125,161,126,87,127,14,127,197,128,199,129,152,130,151,131,
+62,131,249,132,170,132,226,133,45,133,83,133,121,134,20,134,160,135,86,135,
+249,136,198,136,210,136,222,136,234,136,246,137,2,137,76,137,188,138,20,138,
+79,138,182,138,211,139,70,139,189,140,31,140,132,140,238,141,96,141,214,142,
+50,142,106,142,193,143,35,143,137,143,180,144,5,144,59,144,124,144,198,145,
+14,145,99,145,187,146,32,146,109,146,203,146,239,147,46,147,137,147,229,148,
+55,148,113,148,180,149,33,149,128,149,236,150,112,151,62,151,135,151,222,
+152,65,152,155,152,213,153,79,153,196,154,13,154,96,154,198,155,60,155,83,
+155,104,155,160,155,239,155,252,156,29,156,62,156,102,156,126,156,156,156,
+169,156,185,156,199,156,245,157,27,157,78,157,139,157,186,157,240,158,40,
+158,64,158,139,158,202,158,228,159,13,159,33,159,53,159,74,159,121,159,146,
+159,159,159,184,159,204,159,217,160,13,160,26,160,78,160,121,160,129,160,
+142,160,155,160,186,160,217,161,16,161,71,161,107,161,141,161,175,161,188,
+161,211,161,234,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,37,17,33,
+17,193,3,73,252,183,2,225,253,135,5,182,250,74,104,4,230,251,26,0,2,0,107,
+255,231,6,61,4,130,0,51,0,63,0,0,1,16,0,33,32,0,17,52,54,54,51,50,22,21,20,
+6,35,34,38,53,52,55,6,6,21,20,4,33,32,17,52,38,35,34,6,21,20,22,51,21,33,
+55,51,50,23,38,53,52,54,51,50,18,5,20,22,51,50,54,53,52,38,35,34,6,6,61,254,
+146,254,129,254,139,254,144,107,190,119,113,131,119,114,113,122,8,52,49,1,
+44,1,87,2,137,115,98,59,67,133,103,253,178,10,192,90,62,148,137,103,155,191,
+251,69,75,68,73,70,71,69,70,76,2,130,254,168,254,189,1,71,1,72,153,239,132,
+154,137,133,155,145,127,44,34,60,143,97,201,233,1,196,160,191,63,57,79,95,
+162,172,5,82,145,97,125,254,229,8,57,66,68,56,51,72,69,0,3,0,107,255,231,
+5,227,4,130,0,51,0,63,0,75,0,0,1,20,6,4,35,32,0,17,52,54,54,51,50,22,21,20,
+6,35,34,38,53,52,55,6,6,21,20,4,33,32,54,53,52,39,33,55,51,50,23,38,53,52,
+54,51,50,22,21,20,6,7,22,22,1,20,22,51,50,54,53,52,38,35,34,6,5,20,23,51,
+50,54,53,52,38,35,34,6,5,168,107,254,244,225,254,139,254,144,107,190,119,
+113,131,119,114,113,122,8,52,49,1,44,1,87,1,15,209,70,254,58,10,122,81,64,
+87,144,112,119,137,78,73,48,44,251,218,75,68,73,70,71,69,70,76,2,216,82,55,
+68,69,70,68,58,78,1,109,93,176,121,1,71,1,72,153,239,132,154,137,133,155,
+145,127,44,34,60,143,97,201,233,124,88,80,55,172,4,73,114,113,148,165,144,
+105,150,32,45,90,1,184,57,66,68,56,51,72,69,72,86,55,80,60,60,81,79,0,2,0,
+90,254,211,4,194,4,130,0,59,0,69,0,0,5,20,6,35,34,38,53,54,54,53,52,39,6,
+6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,34,6,21,35,52,38,35,34,6,21,
+20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,7,22,22,1,38,38,35,34,
+6,21,20,51,50,4,194,79,63,67,73,72,56,39,76,189,92,151,181,166,140,103,189,
+78,84,112,91,80,90,109,110,101,101,102,33,64,79,175,125,105,141,32,23,120,
+74,145,168,109,61,68,254,244,61,160,87,76,101,203,168,124,82,95,87,69,4,66,
+64,90,89,92,101,160,132,126,151,98,85,121,169,136,168,108,98,96,110,83,67,
+53,53,40,87,115,120,173,99,86,88,97,247,214,243,189,92,205,1,70,73,86,75,
+57,131,0,4,0,60,255,231,7,18,6,52,0,61,0,68,0,79,0,86,0,0,1,23,22,22,21,20,
+6,35,34,38,53,54,54,53,52,38,39,35,21,20,6,6,35,34,38,38,53,53,35,55,51,54,
+55,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,7,22,23,51,38,53,52,54,51,50,
+22,21,20,6,37,33,38,38,35,34,6,37,20,23,54,54,53,52,38,35,34,6,1,33,22,22,
+51,50,54,6,31,56,83,53,80,68,76,87,69,59,47,52,225,122,241,170,161,243,131,
+124,8,123,37,218,255,0,15,2,148,125,101,47,113,77,150,53,115,101,224,38,187,
+68,122,98,116,110,128,250,179,3,18,7,219,165,168,219,4,119,45,87,107,66,46,
+57,70,254,144,252,244,19,208,163,163,208,2,2,80,114,124,55,75,91,92,72,4,
+60,56,48,104,90,9,145,235,137,137,236,144,9,84,236,118,191,34,73,55,112,125,
+59,158,192,87,115,79,12,116,244,136,107,122,150,165,123,107,163,43,158,200,
+199,20,82,90,18,116,86,61,68,97,254,169,154,175,175,0,2,0,107,255,230,7,196,
+4,130,0,80,0,92,0,0,1,16,33,34,38,53,52,55,54,53,52,38,35,34,6,21,20,23,22,
+21,20,6,35,34,38,2,53,52,18,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,
+20,22,51,50,54,53,52,39,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,
+54,53,52,38,39,52,51,50,22,22,37,20,22,51,50,54,53,52,38,35,34,6,7,196,254,
+166,154,163,33,32,91,75,75,91,21,21,252,209,150,241,141,90,188,139,113,131,
+119,114,113,122,8,54,49,218,193,177,201,19,24,150,123,128,151,17,18,17,17,
+110,91,113,143,137,137,84,76,132,79,249,191,75,68,73,70,71,69,70,76,2,98,
+253,132,181,169,78,142,146,72,89,104,105,88,63,105,115,61,230,214,133,1,16,
+200,138,1,9,172,154,137,133,155,145,127,43,35,65,168,115,185,207,163,141,
+60,95,108,94,138,170,183,153,53,83,65,59,84,51,116,123,196,224,160,248,52,
+90,142,249,100,57,66,68,56,51,72,69,0,0,2,0,107,255,230,10,191,4,131,0,120,
+0,132,0,0,1,16,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,
+22,51,50,54,53,52,38,35,34,6,6,21,20,23,22,21,20,6,35,34,38,53,52,55,54,53,
+52,38,35,34,6,21,20,23,22,21,20,6,35,34,38,2,53,52,18,54,51,50,22,21,20,6,
+35,34,38,53,52,55,6,6,21,20,22,51,50,54,53,52,39,38,53,52,54,51,50,22,21,
+20,6,7,6,21,20,22,51,50,54,53,52,39,38,53,52,0,51,50,22,18,37,20,22,51,50,
+54,53,52,38,35,34,6,10,191,194,184,144,178,132,98,74,80,62,59,50,63,55,111,
+103,131,160,210,189,136,178,83,11,10,153,125,123,150,33,32,91,75,75,91,21,
+21,252,209,150,241,141,90,188,139,113,131,119,114,113,122,8,54,49,218,193,
+177,201,19,24,150,123,128,151,18,18,35,91,75,75,91,12,11,1,14,221,158,235,
+126,246,196,75,68,73,70,71,69,70,76,2,15,254,248,254,224,187,149,118,151,
+78,64,52,68,60,52,9,44,70,72,84,197,159,202,221,116,181,99,56,94,78,38,141,
+171,169,139,86,155,160,79,89,104,105,88,63,105,115,61,230,214,133,1,16,200,
+138,1,9,172,154,137,133,155,145,127,43,35,65,168,115,185,207,163,141,60,95,
+108,94,138,170,183,153,57,103,72,140,80,89,104,105,88,57,102,110,40,215,1,
+9,162,254,226,156,57,66,68,56,51,72,69,0,0,2,0,80,255,231,8,198,6,52,0,99,
+0,110,0,0,1,20,6,35,34,38,39,6,33,34,38,39,6,35,34,38,53,52,54,51,50,22,23,
+54,53,52,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,35,34,38,38,53,52,54,
+51,50,18,21,20,7,22,22,51,50,54,53,52,38,39,35,55,51,50,54,54,53,52,39,55,
+22,21,20,6,6,7,22,17,20,7,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,
+18,1,50,55,38,38,35,34,6,21,20,22,8,198,192,167,108,161,75,93,254,252,115,
+192,129,137,228,143,166,151,126,95,164,107,59,143,123,80,96,43,56,43,52,57,
+140,43,96,68,157,129,165,189,63,99,156,96,146,169,142,150,102,15,72,125,101,
+47,113,77,150,41,102,80,244,10,60,143,100,123,142,166,204,12,37,37,69,196,
+143,248,195,157,100,90,137,67,70,69,88,1,196,222,255,115,111,226,91,108,199,
+146,131,111,137,69,72,112,150,176,174,70,66,64,32,7,47,48,62,48,121,49,113,
+90,130,162,254,227,248,176,149,60,47,155,164,144,208,79,191,34,73,55,112,
+125,59,158,192,75,110,85,16,165,254,187,72,59,68,77,144,130,150,198,71,36,
+47,48,64,173,254,226,254,64,95,75,68,65,50,58,65,0,2,0,80,255,231,11,131,
+6,52,0,131,0,142,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,
+53,6,21,20,22,51,50,54,53,52,38,35,34,7,6,6,21,23,16,35,34,38,39,6,6,35,34,
+38,39,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,34,6,21,20,23,53,52,
+54,51,50,22,21,20,35,34,38,38,53,52,54,51,50,18,21,20,7,22,22,51,50,54,53,
+52,2,39,35,55,51,50,54,54,53,52,39,55,22,21,20,6,6,7,22,18,21,20,7,22,51,
+50,54,54,53,39,52,18,51,50,0,1,50,55,38,38,35,34,6,21,20,22,11,131,208,183,
+140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,211,180,215,88,30,27,
+4,235,88,154,76,44,178,135,115,192,129,137,228,143,166,151,126,95,164,107,
+59,143,123,80,96,43,56,43,52,57,140,43,96,68,157,129,165,189,63,99,156,96,
+129,149,237,189,82,15,244,125,101,47,113,77,150,64,127,121,138,174,11,128,
+145,63,63,18,5,250,212,232,1,8,246,6,157,100,90,137,67,70,69,88,2,1,254,254,
+228,184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,207,237,153,
+52,140,120,224,254,221,113,124,110,127,91,108,199,146,131,111,137,69,72,112,
+150,176,174,70,66,64,32,7,47,48,62,48,121,49,113,90,130,162,254,227,248,176,
+149,60,47,146,127,195,1,9,17,191,34,73,55,112,125,59,158,192,96,119,74,8,
+65,254,231,154,61,63,131,68,104,77,238,222,1,3,254,170,253,123,95,75,68,65,
+50,58,65,0,1,0,80,255,231,6,8,4,130,0,61,0,0,1,20,2,4,35,34,38,53,52,54,55,
+54,54,53,52,35,34,21,35,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,
+54,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,54,53,52,39,52,54,51,50,18,
+6,8,149,254,244,175,178,218,127,178,153,112,203,210,109,107,101,89,117,33,
+64,79,175,125,105,141,33,26,150,109,133,161,114,150,154,104,98,109,157,243,
+133,199,45,39,86,117,2,198,235,254,181,169,140,109,86,137,109,94,108,65,132,
+206,97,109,85,65,53,53,40,87,115,120,173,100,87,91,96,151,126,108,158,91,
+92,95,45,43,59,143,254,160,246,75,40,50,254,249,0,1,0,80,255,231,9,73,4,130,
+0,103,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,
+22,51,50,54,53,52,38,38,35,34,6,21,20,23,22,21,20,6,6,35,34,38,38,53,52,54,
+55,54,54,53,52,35,34,21,35,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,
+23,54,54,51,50,22,21,20,6,7,6,6,21,20,22,22,51,50,54,53,52,39,38,53,52,54,
+51,50,4,18,9,73,208,183,140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,
+136,218,122,149,183,25,22,86,192,151,145,204,103,102,124,154,111,203,210,
+109,109,99,103,103,33,64,79,175,125,105,141,33,26,150,109,133,161,117,147,
+123,88,67,146,111,170,157,19,20,228,186,163,1,13,156,2,1,254,254,228,184,
+152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,143,201,100,126,126,
+67,142,134,51,90,151,93,86,134,69,90,126,76,96,107,64,132,206,97,109,82,68,
+53,53,40,87,115,120,173,100,87,91,96,151,126,110,163,84,71,80,45,32,63,43,
+110,93,43,135,126,60,181,220,162,254,220,0,0,1,0,95,255,231,5,179,4,133,0,
+52,0,0,19,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,
+22,22,51,50,54,53,52,0,33,34,7,38,53,52,51,32,4,18,21,20,6,35,34,38,39,6,
+6,35,34,38,95,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,25,148,108,
+105,120,254,173,254,208,128,137,24,213,1,1,1,144,218,193,156,127,187,37,46,
+160,134,146,178,1,90,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,111,
+113,134,117,240,1,18,25,44,42,145,241,254,143,181,174,217,146,130,134,142,
+206,0,1,0,95,255,231,5,186,4,126,0,59,0,0,1,20,2,35,34,38,39,6,6,35,34,38,
+53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,
+51,50,54,53,52,2,39,6,6,35,34,38,39,55,22,22,51,50,54,55,22,4,18,5,186,187,
+159,129,195,37,46,160,134,146,178,146,119,96,107,188,15,68,48,46,65,77,251,
+215,68,71,25,157,109,104,121,215,229,28,137,95,120,157,23,90,23,94,88,91,
+100,19,221,1,36,139,1,197,222,255,0,148,128,134,142,206,165,137,172,103,83,
+152,29,79,14,65,35,44,81,67,191,224,110,114,145,131,193,1,40,68,119,140,177,
+176,36,99,90,89,101,46,207,254,230,0,1,0,107,255,231,5,148,4,130,0,67,0,0,
+1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,
+35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,35,34,6,7,35,38,38,35,34,
+6,7,39,54,54,51,50,22,23,54,54,51,50,22,18,5,148,78,156,112,123,152,39,46,
+158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,40,111,
+90,128,150,157,131,97,114,27,57,29,136,90,93,137,22,77,23,174,122,99,147,
+41,31,131,97,129,182,91,1,227,137,232,139,141,135,135,141,206,165,137,172,
+103,83,152,29,79,14,65,35,44,81,67,191,224,127,97,173,175,193,228,105,101,
+96,110,93,87,28,156,195,119,101,101,119,187,254,206,0,1,0,100,255,231,5,126,
+4,130,0,61,0,0,19,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,
+54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,39,54,54,
+51,50,22,21,20,6,6,35,34,3,6,6,35,34,38,38,138,93,134,83,70,74,75,72,81,34,
+63,87,59,124,94,129,147,97,122,83,65,168,216,75,71,41,123,98,117,111,112,
+12,45,29,61,65,51,132,114,246,88,50,170,134,100,127,56,1,13,92,146,104,64,
+100,66,56,75,69,62,60,62,40,101,128,60,112,74,146,125,98,157,96,65,94,50,
+137,224,127,97,113,85,119,88,35,42,179,125,92,175,122,1,20,144,132,87,134,
+0,1,0,100,255,231,5,126,5,162,0,75,0,0,1,20,6,6,35,34,3,6,6,35,34,38,38,53,
+52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,55,38,53,52,54,51,
+50,22,21,38,35,34,6,21,20,23,22,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,
+51,50,54,53,52,39,54,54,51,50,22,5,126,51,132,114,246,88,50,170,134,100,127,
+56,93,134,83,70,74,75,72,81,34,63,87,127,106,77,93,72,91,83,37,56,44,50,38,
+110,97,97,122,83,65,168,216,75,71,41,123,98,117,111,112,12,45,29,61,65,1,
+108,92,175,122,1,20,144,132,87,134,73,92,146,104,64,100,66,56,75,69,62,60,
+62,40,101,128,96,135,13,58,85,63,84,84,61,22,52,39,44,36,20,152,93,98,157,
+96,65,94,50,137,224,127,97,113,85,119,88,35,42,179,0,1,0,100,255,231,6,49,
+6,89,0,108,0,0,1,53,6,21,20,51,50,54,53,52,38,35,33,22,21,20,6,7,22,21,20,
+6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,39,54,54,51,50,22,21,20,6,
+6,35,34,3,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,
+53,52,54,54,51,51,50,54,54,53,52,39,33,55,33,50,22,21,20,6,35,34,38,53,52,
+54,54,51,50,21,20,6,35,34,38,4,62,43,210,103,129,163,187,254,192,42,114,105,
+15,97,122,83,65,168,216,75,71,41,123,98,117,111,112,12,45,29,61,65,51,132,
+114,246,88,50,170,134,100,127,56,93,134,83,70,74,75,72,81,34,63,87,59,124,
+94,125,109,89,43,30,254,66,15,3,46,251,238,192,160,129,157,68,96,43,140,57,
+52,43,56,4,149,7,32,64,136,135,108,119,124,92,91,117,134,18,45,54,98,157,
+96,65,94,50,137,224,127,97,113,85,119,88,35,42,179,125,92,175,122,1,20,144,
+132,87,134,73,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,
+31,67,56,63,63,191,235,199,192,234,162,130,90,113,49,121,48,62,48,0,0,1,254,
+95,255,231,2,231,4,106,0,39,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,
+35,34,38,53,53,6,21,20,22,51,50,54,53,52,46,2,35,33,55,33,50,30,2,2,231,208,
+183,140,169,133,97,74,80,62,59,52,61,55,108,106,136,155,73,141,180,155,254,
+1,15,2,3,176,212,164,78,1,249,248,254,230,184,152,117,152,78,64,52,68,55,
+57,11,43,65,78,86,176,157,111,172,115,39,191,66,173,231,0,2,253,39,4,109,
+255,149,7,70,0,28,0,39,0,0,3,20,6,35,34,39,55,22,51,50,54,53,52,38,39,22,
+21,20,6,35,34,38,53,52,54,51,50,22,22,37,52,38,35,34,6,21,20,51,50,54,107,
+176,152,138,101,42,80,80,135,132,48,51,14,106,106,102,125,154,121,110,157,
+80,254,239,67,62,65,60,126,61,67,5,186,165,168,77,75,30,119,109,56,108,38,
+39,51,108,119,133,107,111,143,110,181,44,43,56,56,39,100,52,255,255,253,39,
+255,231,3,9,7,70,0,38,0,21,0,0,0,6,0,35,0,0,0,1,255,41,255,231,2,72,4,50,
+0,25,0,0,3,55,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,21,20,6,
+35,34,38,38,215,41,92,185,116,123,142,166,204,12,37,37,69,196,143,192,167,
+99,151,121,1,137,28,130,105,144,130,150,198,71,36,47,48,64,173,254,226,163,
+222,255,96,177,0,1,255,43,255,231,5,3,4,130,0,54,0,0,1,20,2,35,34,38,53,52,
+54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,38,35,34,7,6,
+6,21,23,16,35,34,38,39,55,22,51,50,54,54,53,39,52,18,51,50,0,5,3,208,183,
+140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,211,180,215,88,30,27,
+4,235,115,193,106,41,164,194,63,63,18,5,250,212,232,1,8,2,1,254,254,228,184,
+152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,207,237,153,52,140,120,
+224,254,221,194,224,28,235,68,104,77,238,222,1,3,254,170,0,0,2,255,18,252,
+208,2,50,1,142,0,39,0,51,0,0,1,20,2,35,34,38,53,52,54,54,51,50,22,21,20,6,
+35,34,38,53,52,55,6,21,20,22,51,50,54,53,52,38,39,39,52,54,51,50,22,18,5,
+20,22,51,50,54,53,52,38,35,34,6,2,50,247,203,159,191,89,142,77,103,129,99,
+95,95,101,7,75,132,116,180,191,181,192,3,58,46,95,172,104,253,190,63,57,61,
+58,59,58,58,64,254,253,250,254,205,209,177,111,172,94,137,106,111,129,117,
+110,32,32,69,104,102,116,222,202,179,245,49,26,45,66,181,254,209,210,47,55,
+56,47,42,60,58,0,2,255,18,252,210,4,213,1,158,0,70,0,82,0,0,5,20,6,35,34,
+38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,33,
+33,22,17,20,2,35,34,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,
+20,22,51,50,54,53,52,2,39,54,54,51,33,50,22,1,20,22,51,50,54,53,52,38,35,
+34,6,4,213,172,135,118,154,120,89,67,73,56,54,47,55,50,100,85,96,120,254,
+193,254,126,121,247,203,159,191,89,142,77,103,129,99,95,95,101,7,75,132,116,
+180,191,196,177,4,49,58,2,89,204,231,251,27,63,57,61,58,59,58,58,64,13,173,
+219,164,128,105,139,70,59,48,61,50,52,10,38,60,62,74,120,96,253,200,254,215,
+250,254,205,209,177,111,172,94,137,106,111,129,117,110,32,32,69,104,102,116,
+222,202,187,1,3,47,68,63,226,254,30,47,55,56,47,42,60,58,0,0,1,253,118,253,
+8,0,155,255,117,0,50,0,0,19,6,35,34,38,53,52,54,55,54,54,53,52,35,34,21,35,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,7,
+6,6,21,20,22,51,50,55,155,86,124,106,131,82,90,49,49,124,126,63,66,61,53,
+70,21,38,48,106,74,62,85,19,15,90,65,84,93,44,94,70,32,61,63,100,73,253,94,
+86,84,65,62,84,45,26,38,25,72,96,45,51,51,39,29,33,25,50,71,73,103,59,53,
+55,57,95,72,42,56,60,44,37,28,25,37,55,0,0,1,253,118,252,80,0,160,255,117,
+0,63,0,0,19,6,35,34,38,53,52,55,38,53,52,54,55,54,54,53,52,38,35,34,21,35,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,6,
+7,6,6,21,20,22,51,23,35,34,6,21,20,51,50,55,160,87,143,95,121,89,90,70,67,
+57,52,47,60,125,63,66,61,52,70,21,39,47,105,74,62,86,19,15,89,65,76,91,43,
+58,45,40,37,69,85,17,22,72,77,124,99,74,252,165,85,87,68,87,44,27,69,38,60,
+40,34,43,25,30,33,96,45,51,51,38,30,33,24,49,72,72,103,60,53,55,58,82,69,
+43,66,43,27,23,30,17,24,13,101,44,34,64,54,0,0,1,253,121,3,171,255,166,6,
+111,0,36,0,0,3,20,6,35,35,55,51,50,54,54,53,52,38,35,34,6,21,20,23,54,54,
+51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,90,206,233,71,15,64,146,128,
+57,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,5,16,194,
+163,191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,
+160,0,255,255,253,121,255,231,3,9,6,111,2,38,0,35,0,0,0,6,0,29,0,0,255,255,
+253,121,252,208,1,86,6,111,2,38,0,36,0,0,0,6,0,29,0,0,255,255,253,121,255,
+231,5,3,6,111,2,38,0,24,0,0,0,6,0,29,0,0,255,255,253,121,255,231,8,119,6,
+111,0,39,0,35,5,110,0,0,0,38,0,24,0,0,0,6,0,29,0,0,0,1,253,189,1,214,2,215,
+6,89,0,53,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,
+21,20,22,51,50,54,53,52,46,2,35,35,22,21,16,33,35,55,51,50,54,54,53,52,39,
+33,55,33,50,30,2,2,215,208,183,140,169,132,98,74,80,62,59,52,61,55,108,106,
+136,155,73,141,180,155,121,54,254,159,82,5,75,109,89,43,43,254,79,15,2,149,
+176,212,164,78,3,232,248,254,230,184,152,118,151,78,64,52,68,55,57,11,43,
+65,78,86,176,157,111,172,115,39,102,105,254,224,191,31,67,56,76,74,191,66,
+173,231,0,0,2,0,107,255,231,3,9,4,130,0,27,0,39,0,0,1,52,55,6,6,21,20,18,
+23,6,6,35,34,38,2,53,52,54,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,
+53,52,38,35,34,6,1,53,12,60,55,198,175,4,41,50,86,176,115,109,192,119,127,
+123,118,115,113,122,87,75,68,73,70,71,69,70,76,3,79,53,41,68,147,112,192,
+254,242,46,68,63,158,1,33,187,163,248,134,157,120,146,156,145,143,57,66,68,
+56,51,72,69,0,2,254,62,252,208,1,86,1,117,0,50,0,62,0,0,1,20,2,35,34,38,53,
+52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,54,53,52,38,
+39,54,54,53,52,38,39,39,52,54,51,50,22,21,20,6,7,22,5,20,22,51,50,54,53,52,
+38,35,34,6,1,84,218,179,173,220,89,142,77,103,129,100,94,95,101,7,35,40,133,
+144,150,170,68,60,52,61,65,49,1,59,42,63,79,68,74,140,253,200,63,57,61,58,
+59,58,58,64,254,192,220,254,236,227,180,105,162,89,137,106,111,129,117,110,
+34,33,28,81,46,103,136,178,157,82,153,51,34,91,44,50,78,4,9,30,48,97,75,54,
+105,42,133,163,47,55,56,47,42,60,58,0,2,0,116,255,231,4,46,6,52,0,45,0,57,
+0,0,1,33,21,35,34,39,22,22,21,20,6,35,34,38,53,52,55,6,35,35,55,33,54,54,
+53,52,39,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,35,22,21,20,7,34,6,21,
+20,22,51,50,54,53,52,38,2,162,1,130,42,143,48,80,92,220,195,183,218,172,53,
+127,56,10,1,129,23,35,28,254,84,15,2,40,125,101,47,113,77,150,99,158,137,
+18,104,125,144,137,131,139,133,147,2,237,148,4,37,150,95,163,185,190,158,
+186,96,4,148,9,52,35,57,37,191,34,73,55,112,125,59,158,192,117,133,49,46,
+50,54,186,121,103,95,110,116,89,102,122,0,2,0,80,255,231,6,52,5,7,0,65,0,
+76,0,0,1,20,2,35,34,38,39,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,
+34,6,21,20,23,53,52,54,51,50,22,21,20,35,34,38,38,53,52,54,51,50,18,21,20,
+7,22,22,51,50,54,53,52,0,37,38,53,52,54,51,50,4,18,1,50,55,38,38,35,34,6,
+21,20,22,6,52,198,200,115,192,129,137,228,143,166,151,126,95,164,107,59,143,
+123,80,96,43,56,43,52,57,140,43,96,68,157,129,165,189,63,99,156,96,146,169,
+254,222,254,255,12,40,34,95,1,25,210,251,85,157,100,90,137,67,70,69,88,1,
+245,252,254,238,91,108,199,146,131,111,137,69,72,112,150,176,174,70,66,64,
+32,7,47,48,62,48,121,49,113,90,130,162,254,227,248,176,149,60,47,155,164,
+229,1,75,62,33,28,44,52,189,254,155,253,194,95,75,68,65,50,58,65,0,1,0,120,
+0,0,4,132,6,52,0,34,0,0,55,52,18,55,33,55,33,50,54,54,53,52,39,55,22,21,20,
+6,7,22,18,21,21,35,53,16,2,38,35,34,6,2,17,21,35,120,161,165,254,186,15,2,
+122,125,102,46,113,77,150,159,166,170,155,209,61,146,99,104,140,67,210,236,
+232,1,112,103,191,35,72,55,114,123,59,158,192,143,149,6,101,254,141,227,241,
+214,1,19,1,22,172,162,254,240,254,236,229,0,0,4,0,110,254,103,6,214,6,52,
+0,15,0,80,0,92,0,104,0,0,19,33,50,54,54,53,52,39,55,22,21,20,6,6,35,33,3,
+52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,
+50,54,53,52,38,39,55,22,22,51,50,54,53,52,38,39,54,54,51,50,22,21,20,6,35,
+34,39,23,20,6,6,35,34,3,6,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,19,
+52,54,55,51,22,22,21,20,6,35,34,135,3,111,125,101,47,113,77,150,99,158,138,
+252,138,10,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,
+115,124,58,89,86,96,118,66,63,71,90,86,7,43,31,71,118,121,104,64,61,3,53,
+137,118,236,88,46,158,133,146,178,2,38,68,54,54,69,68,55,55,67,4,46,31,60,
+31,45,53,52,108,4,106,34,73,55,112,125,59,158,192,117,133,49,253,175,137,
+172,103,83,151,30,79,14,65,35,44,81,67,191,224,112,112,132,113,82,128,98,
+75,113,72,70,59,73,89,9,44,55,182,116,118,140,24,67,111,203,140,1,20,135,
+141,206,2,44,52,69,69,52,52,68,68,252,16,43,174,87,83,171,50,46,40,0,0,2,
+0,100,255,231,5,129,4,130,0,78,0,90,0,0,55,52,54,55,55,62,2,53,52,38,35,34,
+6,21,20,23,7,38,53,52,54,54,51,50,22,23,55,54,54,51,50,22,21,20,6,7,38,38,
+35,34,6,7,1,6,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,54,54,51,
+50,22,21,20,6,35,34,38,39,6,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,
+138,75,82,137,35,33,18,74,75,72,81,34,63,87,59,124,94,124,151,11,64,82,165,
+102,100,129,61,54,14,98,75,63,132,51,254,126,48,37,90,78,216,75,71,41,128,
+113,95,113,60,56,12,45,29,59,74,151,156,124,167,36,50,166,124,130,167,2,155,
+68,54,54,69,68,55,55,67,247,83,134,83,138,35,39,48,34,56,75,69,62,60,62,40,
+101,128,60,112,74,125,112,65,83,89,107,81,55,79,13,62,85,58,52,254,123,49,
+70,38,57,67,224,126,98,118,100,76,130,31,35,42,180,138,194,231,148,128,143,
+133,153,2,10,52,69,69,52,52,68,68,0,0,1,0,100,255,231,5,188,6,52,0,85,0,0,
+1,51,21,35,22,22,21,20,6,35,34,3,6,6,35,34,38,38,53,52,54,55,54,54,53,52,
+38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,
+51,22,22,51,50,53,52,38,35,35,55,51,54,53,52,39,35,55,51,50,54,53,52,39,55,
+22,21,20,6,7,22,21,20,4,185,249,202,74,76,164,133,246,88,50,170,134,100,127,
+56,93,134,83,70,74,75,72,81,34,63,87,59,124,94,129,147,97,122,83,65,168,216,
+75,71,35,113,98,196,142,120,126,10,175,58,29,217,15,199,158,115,113,77,150,
+117,138,22,2,252,148,56,163,95,143,184,1,20,144,132,87,134,73,92,146,104,
+64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,146,125,98,157,96,65,94,
+50,137,224,110,114,181,113,136,148,30,61,46,38,191,70,92,112,125,59,158,192,
+127,141,22,44,49,56,0,0,3,0,107,254,103,6,6,6,52,0,62,0,74,0,86,0,0,1,20,
+6,35,34,3,6,6,35,34,2,53,52,18,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,
+20,22,51,50,54,55,51,22,22,51,50,54,53,52,2,39,35,55,51,50,54,54,53,52,39,
+55,22,21,20,6,6,7,22,18,1,20,22,51,50,54,53,52,38,35,34,6,1,22,22,21,20,6,
+35,34,53,52,54,55,6,6,200,180,236,88,53,161,123,181,213,108,191,119,113,131,
+119,114,113,122,8,101,159,143,121,142,35,71,35,120,105,122,143,237,189,82,
+15,244,125,101,47,113,77,150,64,127,121,138,174,251,126,75,68,73,70,71,69,
+70,76,1,226,31,45,53,52,108,46,31,1,185,224,242,1,20,151,125,1,25,237,192,
+1,45,168,154,137,133,155,145,127,42,34,131,251,176,179,106,118,110,114,142,
+134,195,1,9,17,191,34,73,55,112,125,59,158,192,96,119,74,8,65,254,231,1,12,
+57,66,68,56,51,72,69,252,87,83,171,50,46,40,86,43,174,87,0,1,0,100,255,231,
+5,126,4,130,0,85,0,0,19,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,
+52,54,54,51,50,22,22,23,30,2,51,50,54,53,52,38,39,54,51,50,22,21,20,6,35,
+34,38,39,21,20,6,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,39,54,54,
+51,50,22,21,20,6,6,35,34,3,6,6,35,34,38,38,138,93,134,83,70,74,75,72,81,34,
+63,87,59,124,94,75,111,74,48,45,64,92,61,64,80,71,75,17,64,66,96,126,92,98,
+163,82,42,77,74,83,65,168,216,75,71,40,125,97,117,111,112,12,45,29,61,65,
+51,132,114,246,88,50,170,134,100,127,56,1,13,92,146,104,64,100,66,56,75,69,
+62,60,62,40,101,128,60,112,74,55,79,66,61,70,48,71,58,61,94,20,75,165,113,
+119,159,137,151,8,87,117,83,59,66,93,50,137,224,127,97,113,85,119,88,35,42,
+179,125,92,175,122,1,20,144,132,87,134,0,0,3,0,111,254,103,9,173,6,52,0,79,
+0,91,0,103,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,0,53,52,54,55,
+33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,7,22,22,21,20,7,22,22,51,50,54,
+53,52,38,39,38,53,52,54,51,50,22,18,21,20,7,22,22,51,50,54,53,52,38,39,38,
+53,52,54,51,50,22,18,5,52,38,35,34,6,21,20,22,51,50,54,1,22,22,21,20,6,35,
+34,53,52,54,55,9,173,192,167,110,162,76,41,161,117,109,162,76,65,232,161,
+243,254,220,140,122,255,0,15,2,148,125,101,47,113,77,150,53,115,101,128,141,
+25,58,138,95,123,142,166,204,12,37,37,69,196,143,8,61,145,104,123,142,166,
+204,12,37,37,69,196,143,250,87,214,167,171,214,204,178,179,205,3,16,31,45,
+53,52,108,46,31,1,196,222,255,118,114,109,123,117,113,108,122,1,27,234,155,
+225,67,191,34,71,57,112,125,59,158,192,87,115,79,12,67,230,156,94,81,62,69,
+144,130,150,198,71,36,47,48,64,173,254,226,163,65,48,72,81,144,130,150,198,
+71,36,47,48,64,173,254,226,52,169,209,209,169,175,202,202,254,105,83,171,
+50,46,40,86,43,174,87,0,2,0,90,254,211,6,88,4,130,0,77,0,87,0,0,1,20,7,39,
+54,53,52,38,35,34,7,22,21,20,7,22,22,21,20,6,35,34,38,53,54,54,53,52,39,6,
+6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,34,6,21,35,52,38,35,34,6,21,
+20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,23,54,54,51,50,22,1,38,38,
+35,34,6,21,20,51,50,6,88,65,76,27,85,74,154,6,7,109,61,68,79,63,67,73,72,
+56,39,76,189,92,151,181,166,140,103,189,78,84,112,91,80,90,109,110,101,101,
+102,33,64,79,175,125,105,141,32,23,120,74,87,135,40,28,116,85,106,142,253,
+94,61,160,87,76,101,203,168,3,113,115,87,40,54,52,65,82,165,49,65,243,189,
+92,205,88,82,95,87,69,4,66,64,90,89,92,101,160,132,126,151,98,85,121,169,
+136,168,108,98,96,110,83,67,53,53,40,87,115,120,173,99,86,88,97,92,90,85,
+97,155,253,59,73,86,75,57,131,0,0,2,0,112,255,231,5,229,6,42,0,75,0,87,0,
+0,1,20,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,38,38,53,52,54,51,23,6,6,
+21,20,22,23,22,22,21,20,6,35,34,38,53,55,6,6,21,20,22,51,50,54,55,51,22,22,
+51,50,54,53,52,2,39,55,54,54,53,52,38,39,55,50,22,22,21,20,6,7,22,18,1,34,
+6,21,20,22,51,50,54,53,52,38,5,229,168,141,129,174,41,53,161,123,110,187,
+110,159,128,68,85,188,157,18,84,96,49,44,106,134,113,108,108,116,3,43,53,
+161,143,121,142,35,71,33,126,93,90,112,128,138,16,73,82,102,88,18,120,160,
+75,135,101,142,164,252,54,63,70,68,62,66,63,64,1,100,173,208,146,130,151,
+125,135,232,140,195,1,52,56,45,137,79,125,151,85,18,126,87,57,105,35,4,155,
+118,127,148,138,121,45,52,161,79,160,179,106,118,103,122,133,110,139,1,4,
+75,91,31,132,75,98,144,20,85,94,146,80,98,178,39,95,254,196,1,118,66,52,54,
+63,65,53,48,69,0,0,3,0,111,255,231,4,155,6,52,0,29,0,41,0,53,0,0,1,20,6,6,
+35,34,38,38,53,52,54,55,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,7,22,22,
+7,52,38,35,34,6,21,20,22,51,50,54,37,20,6,35,34,38,53,52,54,51,50,22,4,155,
+122,241,170,163,242,130,140,122,255,0,15,2,148,125,101,47,113,77,150,53,115,
+102,128,142,151,214,167,171,214,204,178,179,205,254,252,68,55,55,67,68,54,
+54,69,1,236,142,235,140,133,235,149,155,225,67,191,34,73,55,112,125,59,158,
+192,87,115,80,11,66,230,86,169,209,209,169,175,202,202,185,52,68,68,52,52,
+69,69,0,0,3,0,111,255,231,5,174,6,52,0,36,0,69,0,78,0,0,1,20,6,35,34,38,39,
+6,6,35,34,38,38,53,52,18,55,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,7,
+22,23,22,22,7,52,39,6,6,35,34,38,53,52,54,51,50,23,38,38,35,35,34,6,6,21,
+20,22,51,50,54,55,51,22,22,51,50,1,34,21,20,22,51,50,55,38,5,174,190,169,
+121,156,52,30,162,117,117,156,73,177,154,254,190,14,3,165,125,101,47,113,
+77,150,56,118,110,149,9,60,66,130,30,31,123,93,98,121,121,103,92,68,21,172,
+140,116,152,227,120,114,104,93,114,41,71,36,121,114,252,255,0,127,57,54,141,
+22,61,1,129,192,218,123,151,127,147,118,190,109,180,1,36,75,191,34,73,55,
+112,125,59,158,192,90,116,77,11,73,169,58,171,48,77,66,70,88,108,87,87,105,
+31,87,88,136,225,131,128,135,94,130,113,111,2,11,83,34,41,115,43,255,255,
+0,111,254,103,5,174,6,52,2,38,0,49,0,0,0,6,1,181,0,0,0,1,0,110,255,230,5,
+235,4,130,0,78,0,0,1,16,2,35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,54,53,
+52,38,35,34,6,21,20,22,51,50,54,53,52,38,35,34,7,35,38,35,34,6,21,20,22,51,
+51,23,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,53,52,54,51,50,
+22,23,54,54,51,50,22,18,5,235,210,174,155,186,146,119,96,107,105,83,15,30,
+38,48,46,65,77,111,102,138,162,167,139,183,48,71,64,172,90,107,78,62,67,20,
+142,176,120,94,85,87,45,103,110,171,205,137,114,204,196,146,113,175,44,30,
+150,110,109,181,104,2,82,254,230,254,175,204,167,137,172,103,83,76,100,5,
+79,5,38,31,36,48,81,67,92,101,193,167,188,223,161,161,91,75,61,79,107,107,
+88,88,74,25,200,36,169,143,116,162,39,75,178,127,171,117,97,97,117,145,255,
+0,0,0,2,0,110,255,231,4,134,6,52,0,53,0,63,0,0,1,20,6,6,35,34,38,38,53,52,
+55,51,22,22,51,32,17,52,39,6,6,35,34,38,53,52,54,51,50,23,38,38,39,33,55,
+33,50,54,54,53,52,39,55,22,21,20,6,6,7,22,22,23,22,22,37,38,35,34,6,21,20,
+51,50,54,4,134,117,232,165,182,240,112,6,85,4,210,207,1,141,60,20,159,125,
+123,138,152,132,94,68,21,86,55,253,203,15,2,131,125,101,47,113,77,150,68,
+131,130,53,69,10,104,93,254,211,68,97,87,79,128,84,116,1,168,127,203,119,
+137,216,120,50,47,191,169,1,21,104,67,112,131,118,98,97,114,21,51,74,18,191,
+34,73,55,112,125,59,158,192,98,122,71,7,29,102,59,55,177,181,28,55,43,93,
+86,255,255,0,111,254,103,5,140,6,52,2,38,0,54,0,0,0,38,1,181,3,0,0,6,1,182,
+0,0,0,2,0,111,255,231,5,140,6,52,0,33,0,54,0,0,1,20,6,6,35,34,38,39,6,6,35,
+34,38,38,53,52,18,55,33,55,33,50,54,53,52,39,55,22,21,20,6,7,22,18,7,52,38,
+38,35,34,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,5,140,67,155,124,122,
+146,40,30,162,117,117,156,73,177,154,254,183,15,3,137,158,115,113,77,150,
+163,179,159,183,153,121,229,154,152,227,120,114,104,93,114,41,71,40,112,91,
+115,108,1,136,99,190,128,140,134,127,147,118,190,109,180,1,36,75,191,70,92,
+112,125,59,158,192,152,138,8,71,254,216,128,133,227,136,136,225,131,128,135,
+94,130,126,98,137,0,255,255,0,111,254,103,5,140,6,52,2,38,0,54,0,0,0,6,1,
+181,255,0,0,1,0,111,255,150,5,7,6,52,0,57,0,0,1,20,6,6,35,34,38,38,39,38,
+38,35,34,6,21,20,22,23,20,35,34,38,38,53,52,54,51,50,22,22,23,22,22,51,50,
+54,53,52,2,39,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,7,22,18,5,7,53,140,
+120,83,120,85,66,66,115,72,73,84,98,100,89,46,98,64,133,109,61,92,89,85,76,
+103,69,106,100,252,208,253,209,15,3,2,125,101,47,113,77,150,71,135,136,158,
+184,1,123,95,182,127,68,102,99,98,96,82,77,84,139,26,136,102,189,122,150,
+184,55,106,118,107,69,131,110,215,1,25,16,191,34,73,55,112,125,59,160,190,
+101,122,70,5,72,254,208,0,0,3,0,110,255,231,5,123,6,52,0,15,0,27,0,76,0,0,
+19,33,50,54,54,53,52,39,55,22,21,20,6,6,35,33,5,52,54,51,50,22,21,20,6,35,
+34,38,1,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,
+22,51,50,54,53,52,38,39,54,54,51,50,22,21,20,6,6,35,34,3,6,6,35,34,38,135,
+3,111,125,101,47,113,77,150,99,158,138,252,138,2,28,68,54,54,69,68,55,55,
+67,253,218,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,
+115,124,93,79,12,45,29,76,110,53,137,118,236,88,46,158,133,146,178,4,106,
+34,73,55,112,125,59,158,192,117,133,49,202,52,69,69,52,52,68,68,254,173,137,
+172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,106,163,73,
+35,42,249,172,111,203,140,1,20,135,141,206,0,255,255,0,110,254,103,5,123,
+6,52,2,38,0,57,0,0,0,6,1,181,6,0,0,1,0,100,255,231,5,155,5,7,0,65,0,0,19,
+52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,20,
+6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,0,37,38,53,52,54,51,50,4,18,
+21,16,6,35,34,38,39,6,6,35,34,38,38,138,93,134,83,70,74,75,72,81,34,63,87,
+59,124,94,129,147,97,122,83,65,168,216,75,71,34,119,101,122,142,254,222,254,
+255,12,40,34,95,1,25,210,188,153,109,174,36,50,170,134,100,127,56,1,13,92,
+146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,146,125,98,157,96,
+65,94,50,137,224,107,118,172,151,229,1,75,62,33,28,44,52,189,254,155,240,
+254,231,244,149,126,144,132,87,134,0,0,2,0,100,254,103,5,159,6,52,0,74,0,
+86,0,0,1,20,6,35,34,3,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,
+21,20,23,7,38,53,52,54,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,
+51,50,54,53,52,2,39,35,55,51,50,54,54,53,52,39,55,22,21,20,6,6,7,22,18,1,
+22,22,21,20,6,35,34,53,52,54,55,5,159,179,151,246,88,50,170,134,100,127,56,
+93,134,83,70,74,75,72,81,34,63,87,59,124,94,129,147,97,122,83,65,168,216,
+75,71,41,123,98,107,116,245,198,42,15,221,125,101,47,113,77,150,64,127,121,
+144,168,253,132,31,45,53,52,108,46,31,1,142,192,231,1,20,144,132,87,134,73,
+92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,146,125,98,157,
+96,65,94,50,137,224,127,97,141,135,194,1,8,19,191,34,73,55,112,125,59,158,
+192,96,119,74,8,69,254,218,253,171,83,171,50,46,40,86,43,174,87,0,0,1,0,110,
+255,231,8,51,6,52,0,84,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,
+53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,
+51,50,54,53,52,2,39,33,55,33,50,54,53,52,39,55,22,21,20,6,7,22,18,21,7,22,
+22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,8,51,192,167,108,160,74,37,
+154,122,123,152,39,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,
+251,215,68,71,40,111,90,116,109,253,205,253,68,15,3,141,158,115,113,77,150,
+163,179,159,183,3,60,144,102,123,142,166,204,12,37,37,69,196,143,1,196,222,
+255,114,109,100,123,141,135,135,141,206,165,137,172,103,83,152,29,79,14,65,
+35,44,81,67,191,224,127,97,137,122,205,1,17,16,191,70,92,112,125,59,158,192,
+152,138,8,71,254,216,181,58,70,78,144,130,150,198,71,36,47,48,64,173,254,
+226,0,2,0,107,255,231,9,153,6,52,0,73,0,85,0,0,1,20,6,35,34,38,39,6,35,34,
+38,39,6,6,35,34,38,2,53,16,0,51,50,18,17,20,7,22,22,51,50,54,53,52,2,39,35,
+55,51,50,54,54,53,52,39,55,22,21,20,6,6,7,22,18,21,20,7,22,22,51,50,54,53,
+52,38,39,38,53,52,54,51,50,22,18,5,52,38,35,34,6,21,20,22,51,50,54,9,153,
+192,167,110,161,76,88,254,130,190,86,61,225,132,162,215,101,1,1,219,222,255,
+17,75,155,113,122,143,237,189,82,15,244,125,101,47,113,77,150,64,127,121,
+138,174,6,60,146,103,123,142,166,204,12,37,37,69,196,143,250,39,199,176,175,
+203,209,171,170,203,1,196,222,255,117,114,231,140,132,140,132,164,1,11,158,
+1,15,1,63,254,196,254,238,100,83,97,98,142,134,195,1,9,17,191,34,71,57,112,
+125,59,158,192,96,119,74,8,65,254,231,154,52,51,71,81,144,130,150,198,71,
+36,47,48,64,173,254,226,55,180,203,199,173,174,211,203,0,0,2,0,111,255,231,
+4,155,6,52,0,28,0,40,0,0,1,20,6,6,35,34,0,53,52,54,55,33,55,33,50,54,54,53,
+52,39,55,22,21,20,6,6,7,22,22,7,52,38,35,34,6,21,20,22,51,50,54,4,155,121,
+241,171,243,254,220,140,122,255,0,15,2,148,125,101,47,113,77,150,53,115,101,
+128,141,151,214,167,171,214,204,178,179,205,1,236,144,235,138,1,27,234,155,
+225,67,191,34,73,55,112,125,59,158,192,87,115,79,12,67,230,85,169,209,209,
+169,175,202,202,0,2,0,107,255,231,5,113,4,130,0,41,0,53,0,0,1,16,0,33,32,
+0,17,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,
+52,38,39,38,53,52,54,51,50,22,18,37,20,22,51,50,54,53,52,38,35,34,6,5,113,
+254,190,254,194,254,200,254,178,109,192,119,117,133,119,114,113,122,13,60,
+56,1,26,1,0,1,5,1,32,137,174,12,40,34,67,166,116,252,27,75,68,73,70,71,69,
+70,76,2,89,254,211,254,187,1,71,1,50,164,247,135,155,136,133,155,145,127,
+57,37,64,149,103,209,225,206,187,126,191,70,38,33,52,60,158,255,0,123,57,
+66,68,56,51,72,69,0,1,0,110,255,231,5,151,6,52,0,60,0,0,1,20,6,6,35,34,38,
+39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,
+50,55,51,22,22,51,50,54,53,52,2,39,33,55,33,50,54,53,52,39,55,22,21,20,6,
+7,22,18,5,151,67,155,124,123,152,39,46,158,133,146,178,146,119,96,107,188,
+15,68,48,46,65,77,251,215,68,71,40,111,90,116,109,253,205,253,68,15,3,141,
+158,115,113,77,150,163,179,159,183,1,136,99,190,128,141,135,135,141,206,165,
+137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,127,97,137,122,205,1,17,
+16,191,70,92,112,125,59,158,192,152,138,8,71,254,216,0,2,0,105,255,231,4,
+204,6,52,0,53,0,69,0,0,1,20,0,33,34,38,53,16,33,51,50,54,53,52,38,35,34,6,
+21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,55,35,55,33,50,54,54,53,
+52,39,55,22,21,20,6,6,7,22,22,7,16,37,22,21,20,6,35,35,34,6,21,20,33,50,36,
+4,202,254,182,254,205,230,254,1,128,34,126,113,105,94,80,93,23,57,45,50,56,
+74,69,79,104,48,228,15,2,199,125,101,47,113,77,150,55,119,102,129,145,144,
+254,222,91,168,169,48,124,126,1,73,248,1,1,1,233,250,254,248,176,159,1,22,
+93,91,86,89,74,63,37,23,5,47,48,62,48,56,61,105,81,80,50,191,34,73,55,112,
+125,59,158,192,88,116,79,11,62,232,93,1,34,90,62,117,121,144,64,79,164,194,
+0,0,3,0,110,255,114,5,208,6,52,0,15,0,27,0,84,0,0,1,33,55,33,50,54,54,53,
+52,39,55,22,21,20,6,6,5,50,22,21,20,6,35,34,38,53,52,54,1,39,6,35,34,3,6,
+6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,
+51,22,22,51,50,55,3,55,19,54,53,52,38,39,54,54,51,50,22,21,20,6,7,23,3,238,
+252,138,15,3,111,125,101,47,113,77,150,99,158,254,150,54,69,68,55,55,67,68,
+2,115,104,66,90,236,88,46,158,133,146,178,146,119,96,107,188,15,68,48,46,
+65,77,251,215,68,71,36,111,105,48,39,201,70,231,52,93,79,12,45,29,76,110,
+32,32,149,3,171,191,34,73,55,112,125,59,158,192,117,133,49,81,69,52,52,68,
+68,52,52,69,252,24,172,55,1,20,135,141,206,165,137,172,103,83,152,29,79,14,
+65,35,44,81,67,191,224,112,112,12,1,77,45,254,200,62,105,106,163,73,35,42,
+249,172,67,152,65,200,0,3,0,100,255,231,4,140,6,52,0,15,0,27,0,64,0,0,19,
+33,50,54,54,53,52,39,55,22,21,20,6,6,35,33,5,52,54,51,50,22,21,20,6,35,34,
+38,1,52,54,51,50,22,22,23,22,22,51,50,54,53,52,38,39,55,22,21,20,6,35,34,
+38,38,39,38,38,35,34,6,21,20,23,7,38,125,2,138,125,101,47,113,77,150,99,158,
+138,253,111,1,48,70,53,52,68,68,52,53,70,254,198,195,166,91,121,86,62,21,
+39,32,66,61,50,48,87,135,120,99,41,60,46,32,67,131,105,127,134,10,86,26,4,
+106,34,73,55,112,125,59,158,192,117,133,49,202,52,71,71,52,50,70,70,253,225,
+176,208,66,115,110,36,29,133,88,114,178,93,38,214,245,172,210,36,60,55,114,
+84,128,105,58,48,10,80,0,0,3,0,111,255,231,5,247,6,52,0,43,0,55,0,67,0,0,
+1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,23,38,33,35,55,33,50,54,54,
+53,52,39,55,22,21,20,6,35,33,22,22,23,54,54,51,50,22,5,52,38,35,34,6,21,20,
+22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,5,247,200,174,120,169,41,40,
+170,120,173,200,212,162,135,96,97,254,148,153,15,3,216,85,112,76,113,77,150,
+189,206,254,33,88,111,18,46,163,105,161,212,252,251,141,109,109,142,142,109,
+108,142,2,128,141,109,109,142,142,109,108,142,1,132,192,221,120,103,103,120,
+221,192,163,220,80,248,191,18,71,73,112,125,59,158,192,161,138,45,178,126,
+84,97,219,136,103,132,131,104,105,135,134,106,103,132,131,104,105,135,134,
+0,4,0,107,255,231,6,53,4,130,0,30,0,42,0,54,0,84,0,0,1,20,2,35,34,38,39,6,
+6,35,34,2,53,52,18,54,51,50,22,21,20,7,51,38,53,52,54,51,50,22,18,37,20,22,
+51,50,54,53,52,38,35,34,6,5,20,22,51,50,54,53,52,38,35,34,6,1,52,38,39,22,
+21,20,6,35,33,34,38,53,52,55,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,6,
+53,220,171,131,191,28,27,191,132,171,220,112,195,120,116,145,40,186,40,145,
+116,120,195,112,251,90,75,68,73,70,71,69,70,76,2,100,70,73,68,75,76,70,69,
+71,1,207,50,44,11,133,122,253,192,122,133,11,44,50,169,139,115,130,33,80,
+33,130,115,139,169,2,4,237,254,208,158,133,132,159,1,49,236,181,1,35,166,
+154,121,84,59,59,84,121,154,166,254,221,166,57,66,68,56,51,72,69,54,56,68,
+66,57,55,69,72,254,182,90,166,63,41,38,118,120,120,118,38,41,63,166,90,182,
+217,117,107,107,117,217,0,0,3,0,82,255,231,4,247,6,52,0,59,0,69,0,81,0,0,
+1,20,6,7,22,21,20,33,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,34,
+38,53,52,55,6,21,20,22,22,23,22,22,23,36,53,52,39,35,55,51,50,54,54,53,52,
+39,55,22,21,20,6,7,22,22,37,20,51,50,54,53,52,38,35,34,1,52,38,35,34,6,21,
+20,22,51,50,54,4,239,189,172,51,254,242,126,139,68,189,215,203,164,118,120,
+110,104,103,109,15,97,51,142,134,111,136,49,1,64,216,109,15,72,125,101,47,
+113,77,150,114,95,98,103,252,107,124,61,62,63,58,126,1,242,81,72,77,77,78,
+74,75,80,2,184,145,148,27,65,95,241,123,107,94,53,6,208,179,181,228,139,113,
+118,137,125,112,58,32,80,118,73,94,59,11,10,28,28,29,204,166,67,191,34,73,
+55,112,125,59,158,192,124,137,22,40,137,119,101,55,48,43,58,253,18,55,57,
+61,53,51,60,58,0,0,3,0,107,255,231,6,53,4,130,0,60,0,72,0,84,0,0,1,20,2,35,
+34,38,39,6,6,35,34,2,53,52,18,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,
+20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,
+54,51,50,22,18,37,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,
+51,50,54,6,53,220,171,131,191,28,27,191,132,171,220,112,195,120,116,145,140,
+103,115,132,11,44,50,169,139,115,130,33,80,33,130,115,139,169,50,44,11,131,
+116,103,140,145,116,120,195,112,251,90,75,68,73,70,71,69,70,76,3,130,76,70,
+69,71,70,73,68,75,2,4,237,254,208,158,133,132,159,1,49,236,181,1,35,166,154,
+121,123,169,128,110,38,41,63,166,90,182,217,117,107,107,117,217,182,90,166,
+63,41,38,109,129,169,123,121,154,166,254,221,166,57,66,68,56,51,72,69,55,
+55,69,72,51,56,68,66,0,0,2,0,100,255,246,4,81,4,106,0,15,0,27,0,0,19,52,18,
+54,51,50,22,18,21,20,2,6,35,34,38,2,37,52,38,35,34,6,21,20,22,51,50,54,100,
+139,231,134,134,229,138,138,229,134,134,231,139,3,126,212,178,179,215,215,
+179,176,214,2,49,174,1,2,137,137,254,254,174,175,254,253,137,137,1,3,175,
+167,202,200,169,170,201,202,0,2,253,229,5,133,0,232,7,106,0,11,0,25,0,0,3,
+52,54,51,50,22,21,20,6,35,34,38,37,55,22,22,51,50,54,55,23,6,6,35,34,38,255,
+58,43,41,56,57,40,43,58,254,228,75,68,144,98,97,146,67,76,50,181,155,155,
+180,7,8,45,53,54,44,45,52,53,13,34,128,99,99,128,34,171,185,185,0,0,4,0,100,
+255,246,2,71,4,116,0,11,0,23,0,35,0,47,0,0,19,52,54,51,50,22,21,20,6,35,34,
+38,37,52,38,35,34,6,21,20,22,51,50,54,1,52,54,51,50,22,21,20,6,35,34,38,37,
+52,38,35,34,6,21,20,22,51,50,54,100,136,105,106,136,136,106,106,135,1,148,
+89,74,74,89,89,74,74,89,254,108,136,105,106,136,136,106,106,135,1,148,89,
+74,74,89,89,74,74,89,3,96,123,153,154,122,122,154,153,123,59,78,78,59,59,
+78,78,253,229,123,153,154,122,122,154,153,123,59,78,78,59,59,78,78,0,0,2,
+254,62,2,75,1,217,5,168,0,24,0,34,0,0,19,51,50,22,21,20,6,35,34,38,39,33,
+55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,11,12,181,
+171,119,96,123,125,4,254,154,15,1,89,11,152,126,114,140,20,86,47,142,72,100,
+21,1,65,89,55,65,87,84,4,106,138,146,117,142,172,180,191,150,168,139,129,
+12,130,88,254,241,94,109,54,48,59,42,0,2,254,158,254,167,1,98,255,106,0,11,
+0,23,0,0,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,
+38,254,158,58,43,41,56,57,40,43,58,1,254,58,43,41,56,57,40,43,58,248,45,53,
+54,44,45,52,53,44,45,53,54,44,45,52,53,0,1,255,246,255,244,3,136,4,106,0,
+38,0,0,3,55,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,33,7,33,34,6,21,
+20,22,22,23,30,2,21,20,6,35,34,38,38,10,70,110,217,121,81,105,59,88,74,83,
+100,69,120,101,1,206,15,254,126,48,50,50,75,67,91,114,82,186,146,130,207,
+151,1,125,44,146,151,97,77,53,98,83,60,68,96,121,68,83,98,191,40,35,34,70,
+65,53,71,105,135,75,119,149,111,168,0,3,0,90,0,0,3,222,4,106,0,9,0,18,0,28,
+0,0,55,1,1,53,33,21,1,1,21,33,1,6,35,35,34,39,23,19,54,3,51,50,23,38,39,3,
+2,7,54,90,1,105,254,158,3,81,254,177,1,123,252,124,2,214,57,109,231,79,63,
+24,247,66,205,231,125,27,12,32,230,240,53,24,60,1,245,1,253,60,60,254,40,
+253,230,60,4,25,5,5,31,254,172,88,253,99,5,12,51,1,82,254,166,55,5,0,0,4,
+0,40,0,214,5,53,3,106,0,11,0,23,0,35,0,47,0,0,19,52,54,51,50,22,21,20,6,35,
+34,38,37,52,54,51,50,22,21,20,6,35,34,38,39,52,38,35,34,6,21,20,22,51,50,
+54,37,52,38,35,34,6,21,20,22,51,50,54,40,162,126,126,163,163,126,126,162,
+2,204,163,125,124,165,164,125,124,164,234,107,87,87,108,108,87,86,108,2,205,
+108,87,87,108,108,87,87,108,2,32,146,184,183,147,147,183,183,147,146,184,
+183,147,147,183,183,147,72,92,91,73,73,91,91,73,73,91,91,73,73,91,91,0,0,
+2,0,118,255,246,4,148,5,154,0,13,0,27,0,0,19,16,0,51,50,0,17,20,2,6,35,34,
+38,2,37,52,38,38,35,34,6,6,21,20,18,51,50,18,118,1,26,245,244,1,27,132,239,
+156,156,239,132,3,180,97,190,135,134,190,96,226,194,195,227,2,187,1,86,1,
+137,254,120,254,169,220,254,192,169,169,1,64,220,141,234,140,140,234,141,
+225,254,245,1,10,0,1,0,108,255,241,4,190,5,155,0,40,0,0,19,52,18,54,51,50,
+22,18,21,20,2,6,35,34,38,53,52,55,50,18,53,52,38,38,35,34,6,6,21,20,22,22,
+51,22,21,20,6,35,34,38,2,108,123,249,181,181,249,123,107,157,77,55,72,6,148,
+209,108,203,137,137,203,108,94,164,99,6,72,55,77,157,107,2,193,203,1,75,196,
+196,254,181,203,249,254,188,147,71,58,21,24,1,61,225,140,236,139,139,236,
+140,144,249,149,24,21,58,71,147,1,68,0,1,0,57,0,0,4,202,5,153,0,36,0,0,55,
+33,32,0,53,52,2,35,34,6,21,20,22,51,50,54,55,22,22,21,20,6,35,34,38,53,52,
+54,51,50,18,17,20,2,4,35,33,57,1,224,1,19,1,55,197,162,112,149,83,56,68,87,
+16,53,57,107,89,143,194,204,159,219,254,178,254,177,228,254,84,211,1,33,254,
+223,1,15,146,111,75,75,82,68,11,82,47,74,96,212,157,171,212,254,164,254,213,
+236,254,157,195,0,0,2,0,64,255,255,4,248,5,154,0,51,0,62,0,0,37,6,35,34,38,
+39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,34,6,21,20,22,51,50,54,
+55,22,21,20,6,35,34,38,38,53,52,54,51,50,22,18,21,20,7,22,22,37,50,55,38,
+38,35,34,6,21,20,22,4,248,3,168,93,151,84,81,208,113,133,174,160,128,82,167,
+139,131,166,150,88,127,85,63,50,107,39,50,92,76,92,151,86,168,130,135,200,
+104,106,94,194,252,241,154,128,70,135,80,75,91,80,196,197,95,88,88,95,162,
+124,118,143,62,92,169,239,212,236,100,74,66,74,47,43,50,64,62,77,102,166,
+91,135,169,188,254,199,183,249,189,55,61,5,105,69,75,69,56,54,70,0,0,2,0,
+107,255,231,5,16,5,156,0,66,0,78,0,0,1,30,2,21,20,6,35,34,38,38,53,52,55,
+38,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,22,51,50,54,53,52,38,
+35,34,6,21,20,22,23,22,23,62,2,53,52,38,35,7,38,53,52,54,51,50,22,22,21,20,
+6,5,6,6,21,20,51,50,54,53,52,38,39,3,175,89,89,25,187,160,89,162,101,137,
+244,233,102,159,85,133,155,118,96,69,90,17,53,70,53,84,110,76,115,138,175,
+178,138,112,106,133,88,108,81,30,13,79,70,60,111,72,162,254,117,78,81,231,
+114,99,122,108,2,79,45,108,101,59,141,162,66,129,90,149,107,58,237,200,144,
+192,89,184,157,118,146,79,58,47,34,32,51,51,65,64,127,107,132,150,29,22,36,
+54,91,135,93,98,127,3,29,30,60,76,70,150,112,160,247,210,43,80,51,126,76,
+58,60,84,14,0,0,3,0,80,255,224,5,219,5,155,0,73,0,83,0,93,0,0,1,23,30,2,21,
+20,6,35,34,38,53,50,54,53,52,38,38,39,6,7,2,2,35,34,38,53,52,54,54,63,2,52,
+38,38,35,34,6,21,20,22,51,50,55,22,21,20,6,35,34,38,53,52,54,51,50,22,18,
+21,21,54,55,38,38,53,52,54,51,50,22,21,20,6,39,54,53,52,38,35,34,6,21,20,
+1,14,2,21,20,22,51,50,54,4,186,57,60,71,48,86,68,64,86,71,59,25,50,82,109,
+154,22,238,196,139,177,169,247,210,43,2,59,139,112,80,94,82,55,70,53,17,82,
+68,101,123,161,137,139,174,75,127,78,54,60,148,136,119,149,153,189,205,69,
+66,68,79,254,169,173,184,124,87,77,128,161,2,169,91,95,126,145,73,83,100,
+101,72,76,55,41,89,104,138,38,29,254,226,254,206,166,126,134,152,68,33,7,
+83,118,225,151,63,59,55,54,32,34,47,60,77,162,124,146,171,211,254,178,196,
+4,23,26,98,181,94,149,175,186,147,155,202,30,98,210,71,94,109,87,127,254,
+143,31,46,85,70,58,71,184,0,0,2,0,111,0,0,4,171,5,156,0,36,0,48,0,0,37,21,
+33,34,36,2,53,52,54,55,38,38,39,54,54,51,50,22,22,23,54,51,50,22,21,20,6,
+35,34,38,38,39,6,21,20,22,51,3,30,2,51,50,54,53,52,38,35,34,4,171,254,4,181,
+255,0,128,110,94,37,96,82,18,68,49,81,91,40,13,76,80,180,214,162,127,122,
+145,73,38,114,242,238,239,12,39,89,79,70,81,126,106,73,209,209,162,1,1,142,
+138,220,71,128,184,61,28,45,98,155,117,26,182,150,130,162,111,168,141,102,
+183,189,205,2,238,117,154,98,93,87,96,113,0,0,1,0,88,0,0,4,201,5,154,0,42,
+0,0,19,52,54,55,62,2,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,
+21,20,6,6,7,14,3,21,20,22,51,33,21,33,34,38,88,144,175,134,123,71,88,79,81,
+91,41,64,41,58,167,135,151,185,73,112,100,192,90,54,23,112,116,2,217,252,
+245,179,179,1,39,98,189,127,98,100,102,58,70,93,93,69,73,51,31,46,129,65,
+126,155,164,133,74,125,102,77,151,78,68,57,31,84,79,211,154,0,0,2,0,118,255,
+231,5,254,5,154,0,55,0,67,0,0,1,20,22,23,30,2,21,20,6,4,35,34,36,2,53,52,
+18,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,18,4,51,50,54,53,52,38,
+38,39,38,38,53,52,54,51,51,21,35,34,6,5,20,22,51,50,54,53,52,38,35,34,6,4,
+183,54,57,52,64,46,153,254,242,171,236,254,165,185,111,193,116,117,133,130,
+103,103,132,8,52,59,159,1,42,202,217,241,38,54,47,85,55,140,115,224,206,60,
+61,252,224,75,68,73,70,71,69,70,76,4,84,48,106,83,79,110,136,71,153,227,120,
+198,1,103,236,167,1,52,191,155,136,127,161,151,121,41,34,69,228,120,170,254,
+242,154,177,165,57,108,90,69,122,139,64,112,119,211,44,15,57,66,68,56,51,
+72,69,0,0,2,0,123,255,237,4,176,5,134,0,41,0,52,0,0,1,20,22,23,54,54,51,50,
+22,21,20,6,35,34,39,22,22,51,50,55,22,21,20,6,35,34,38,38,53,52,55,38,38,
+53,52,36,33,33,21,33,34,6,19,22,51,50,54,53,52,38,35,34,6,1,1,44,44,52,204,
+117,128,146,181,139,128,100,14,173,136,99,73,12,119,102,126,195,107,9,93,
+95,1,52,1,3,1,254,253,243,206,212,191,88,123,114,103,88,70,98,152,3,137,58,
+115,46,117,140,129,111,104,139,37,133,150,26,41,34,96,88,129,220,132,56,49,
+69,203,109,214,252,210,155,254,75,44,83,60,56,71,128,0,1,0,200,0,0,1,87,4,
+106,0,3,0,0,19,51,17,35,200,143,143,4,106,251,150,0,255,255,0,200,0,0,3,24,
+4,106,0,38,0,91,0,0,0,7,0,91,1,193,0,0,0,1,0,121,0,0,4,61,5,182,0,34,0,0,
+19,53,51,50,54,55,33,53,33,38,38,35,35,53,33,21,33,22,23,51,21,35,2,5,19,
+22,22,51,51,21,35,34,38,38,39,121,170,182,153,11,253,252,2,4,9,146,160,201,
+3,196,254,160,113,12,227,229,32,254,65,235,51,101,63,27,49,133,137,85,47,
+2,178,58,124,146,96,135,117,96,96,88,164,96,254,162,17,254,111,85,79,86,27,
+75,82,0,0,1,255,213,254,240,0,43,5,6,0,3,0,0,3,51,17,35,43,86,86,5,6,249,
+234,0,0,1,255,33,254,240,0,223,5,133,0,14,0,0,3,7,39,55,39,55,23,55,23,7,
+23,7,39,17,35,43,127,53,168,168,53,170,170,53,168,168,53,127,86,4,72,127,
+55,168,166,55,170,170,55,166,168,55,127,250,168,0,0,16,0,98,0,86,4,94,4,82,
+0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,95,0,107,0,119,0,131,0,143,0,155,0,167,
+0,179,0,191,0,0,1,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,
+6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,
+34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,
+37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,
+54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,
+50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,
+21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,
+6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,2,43,32,21,22,32,32,22,21,32,
+172,32,21,22,31,31,22,21,32,1,88,32,21,22,32,32,22,21,32,254,16,32,22,21,
+32,32,21,22,32,2,136,31,22,22,31,31,22,22,31,253,24,32,21,22,32,32,22,21,
+32,3,72,31,22,22,31,31,22,22,31,252,147,32,22,21,32,32,21,22,32,3,146,31,
+22,22,31,31,22,22,31,252,147,32,21,22,32,32,22,21,32,3,72,31,22,22,31,31,
+22,22,31,253,24,32,22,21,32,32,21,22,32,2,136,31,22,22,31,31,22,22,31,254,
+16,32,21,22,31,31,22,21,32,1,88,32,21,22,32,32,22,21,32,172,32,21,22,32,32,
+22,21,32,4,29,21,32,32,21,22,32,32,15,21,32,32,21,22,31,31,22,21,32,32,21,
+22,31,31,74,21,32,32,21,22,32,32,22,21,32,32,21,22,32,32,130,22,31,31,22,
+22,31,31,22,22,31,31,22,22,31,31,150,22,31,31,22,22,31,31,22,22,31,31,22,
+22,31,31,150,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,130,22,32,32,22,
+21,32,32,21,22,32,32,22,21,32,32,75,22,31,31,22,22,31,31,22,22,31,31,22,22,
+31,31,15,22,32,32,22,21,32,32,0,0,1,0,100,0,0,4,6,4,106,0,31,0,0,19,20,22,
+51,33,21,35,34,21,20,22,51,51,21,35,34,38,38,53,52,54,55,38,38,53,52,54,51,
+33,7,33,34,220,104,83,1,27,254,226,88,81,61,49,72,133,86,93,87,86,94,206,
+195,2,17,15,253,195,222,3,22,71,78,181,135,62,72,191,56,122,93,94,143,30,
+32,156,106,147,151,191,0,0,2,254,115,252,254,0,228,0,131,0,28,0,40,0,0,23,
+21,35,39,22,22,21,20,6,35,34,38,53,52,55,7,35,53,33,54,53,52,39,51,22,21,
+20,6,7,23,52,38,35,34,6,21,20,22,51,50,54,228,28,83,37,44,155,134,125,154,
+84,79,32,1,3,102,33,122,27,70,61,146,101,82,78,101,100,79,85,98,251,120,1,
+28,90,49,107,126,129,104,102,65,1,120,86,135,83,78,58,72,69,133,50,233,59,
+76,76,59,60,64,66,0,0,2,253,184,252,213,1,134,0,131,0,63,0,74,0,0,1,52,54,
+51,50,22,23,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,35,34,38,53,
+52,54,51,50,22,21,20,6,7,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,
+18,21,16,33,34,38,39,6,35,34,38,37,38,38,35,34,6,21,20,22,51,50,253,184,98,
+86,60,101,68,40,96,74,46,58,15,2,39,29,34,39,93,60,79,102,85,115,134,31,25,
+60,101,58,105,90,135,115,8,30,24,54,133,92,254,253,73,124,80,88,146,94,110,
+1,107,56,85,39,42,42,54,54,91,253,138,71,91,42,44,73,88,107,108,44,40,30,
+17,26,28,40,31,81,89,73,85,105,184,154,48,115,46,36,30,131,125,168,239,29,
+19,23,30,35,156,254,250,150,254,138,57,65,122,95,92,45,44,41,30,35,41,0,1,
+254,26,253,41,0,120,255,120,0,17,0,0,1,52,54,51,50,22,21,21,35,53,52,38,35,
+34,6,21,21,35,254,26,167,138,139,162,127,77,97,103,75,127,253,180,204,248,
+245,207,139,127,162,211,204,161,135,0,0,2,253,153,251,210,2,47,0,131,0,75,
+0,84,0,0,1,20,6,35,34,39,23,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,51,50,54,55,51,22,22,51,50,54,53,
+52,38,39,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,38,39,54,54,51,50,
+22,1,22,21,20,35,34,53,52,55,2,47,85,66,71,48,1,44,104,84,65,106,30,34,113,
+94,104,127,104,85,70,86,77,68,11,49,35,32,36,46,159,77,99,25,54,26,78,74,
+68,81,131,119,8,30,24,58,130,54,10,21,56,57,38,47,63,52,4,31,23,57,77,253,
+89,54,75,77,55,254,234,81,100,54,32,81,175,124,106,91,96,101,148,117,98,123,
+75,58,56,69,5,57,12,45,25,32,56,50,126,75,84,80,79,116,127,161,246,29,19,
+23,30,35,163,148,42,68,60,51,42,51,65,5,32,39,124,253,165,142,74,62,62,54,
+162,0,2,253,102,252,211,0,150,255,180,0,73,0,85,0,0,1,52,54,55,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,55,54,54,51,50,22,21,20,
+6,7,38,38,35,34,6,7,7,6,21,20,22,51,50,54,55,51,22,51,50,54,53,52,39,54,54,
+51,50,22,21,20,6,35,34,39,6,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,
+253,126,47,51,86,28,25,46,47,41,45,22,50,54,96,77,89,84,6,40,59,97,58,61,
+71,37,34,5,62,46,37,67,40,223,46,49,46,56,89,22,44,42,122,64,69,60,4,29,20,
+38,41,101,85,153,55,31,104,78,82,103,1,144,46,37,37,47,44,40,38,45,253,128,
+51,81,52,87,28,39,30,35,47,40,37,40,36,30,63,80,67,87,89,59,40,59,49,69,49,
+34,49,9,41,55,33,40,223,46,45,35,39,66,64,130,59,55,85,34,21,27,120,80,111,
+132,172,89,83,95,1,73,32,41,41,32,32,40,40,0,0,1,252,250,252,211,0,70,0,131,
+0,72,0,0,19,35,22,21,20,6,35,34,39,6,6,35,34,38,53,52,54,55,54,53,52,38,35,
+34,6,21,20,22,23,7,38,53,52,54,51,50,22,21,20,6,7,6,21,20,22,51,50,54,55,
+51,22,51,50,54,53,52,38,39,35,55,51,54,53,52,38,39,51,22,21,20,6,7,51,70,
+129,97,96,88,153,56,31,105,83,91,96,67,85,94,44,48,45,50,11,13,40,56,86,86,
+84,93,65,76,83,49,45,66,94,22,45,37,116,58,62,87,80,73,7,75,120,18,18,122,
+30,80,68,195,254,109,60,133,94,123,172,90,82,99,74,63,96,63,69,74,36,47,44,
+39,22,30,22,24,63,78,67,96,94,75,63,105,61,69,51,30,34,64,61,125,51,41,59,
+90,7,102,118,142,38,97,37,66,81,73,147,65,0,3,252,169,251,209,0,150,0,131,
+0,51,0,63,0,72,0,0,19,20,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,
+6,35,34,38,53,52,55,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,
+38,53,52,54,51,50,22,18,37,20,22,51,50,54,53,52,38,35,34,6,1,22,21,20,35,
+34,53,52,55,150,112,139,168,64,33,109,99,129,152,166,133,87,88,87,81,81,86,
+5,62,117,89,86,102,25,50,26,85,76,86,106,135,115,8,30,24,54,133,92,252,219,
+54,48,53,50,51,49,50,55,1,90,53,74,78,56,254,75,163,217,197,96,101,171,172,
+195,238,118,90,95,111,103,91,29,27,71,164,106,109,76,84,79,81,126,117,168,
+239,29,19,23,30,35,156,254,250,38,41,47,49,40,36,51,50,253,187,147,70,62,
+62,64,153,0,0,1,253,102,252,203,0,150,255,171,0,76,0,0,1,52,54,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,55,23,20,
+6,35,34,38,39,22,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,
+53,52,38,39,54,51,50,22,21,20,6,35,34,39,6,6,35,34,38,253,125,66,75,51,43,
+45,46,45,51,21,38,54,88,74,40,79,59,70,110,62,69,99,40,26,111,93,78,165,58,
+17,8,66,64,38,34,48,46,61,89,21,44,16,90,64,59,74,32,37,15,38,37,41,82,102,
+153,54,27,106,75,86,100,253,121,61,100,58,39,62,41,35,47,43,39,35,40,25,63,
+79,73,86,32,33,39,43,57,58,11,91,105,74,54,21,38,26,57,87,52,31,47,28,34,
+42,63,62,62,63,61,50,38,55,25,47,119,78,93,148,171,83,88,98,0,3,250,92,251,
+206,0,150,255,159,0,61,0,73,0,82,0,0,19,20,6,35,34,38,39,6,35,34,38,39,6,
+6,35,34,38,53,52,54,51,50,22,21,20,7,22,51,50,54,53,52,38,39,38,53,52,54,
+51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,22,5,
+52,38,35,34,6,21,20,22,51,50,54,1,22,21,20,35,34,53,52,55,150,131,110,73,
+110,50,57,156,74,109,50,44,155,107,167,201,208,160,152,204,16,83,121,76,81,
+121,115,8,24,25,46,131,96,5,39,108,60,92,76,123,115,8,24,25,46,132,96,252,
+34,131,105,109,138,129,117,105,132,2,32,50,69,73,52,254,10,152,178,79,76,
+155,79,77,72,84,183,153,146,190,186,140,60,52,72,98,74,103,120,38,27,39,32,
+42,115,191,109,34,40,40,44,91,81,101,123,37,18,48,32,42,110,186,68,94,116,
+121,95,94,109,117,254,252,133,70,58,58,62,141,0,0,2,252,191,251,246,0,150,
+255,176,0,75,0,86,0,0,23,20,6,7,39,54,53,52,38,35,34,7,22,21,20,7,22,22,21,
+20,6,35,34,38,53,54,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,
+35,34,6,21,35,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,23,54,54,51,50,23,
+54,54,51,50,22,1,50,55,38,38,35,34,6,21,20,22,150,25,22,48,22,54,47,91,10,
+4,67,46,52,52,43,44,48,48,37,37,48,121,61,95,116,105,92,124,105,47,63,62,
+48,53,69,69,64,57,74,21,51,47,111,87,132,45,14,77,47,113,53,18,74,54,72,86,
+253,159,103,69,38,99,52,51,55,65,253,39,76,24,25,31,37,40,43,89,28,40,152,
+119,64,146,63,55,62,58,45,3,44,43,72,65,60,66,102,84,77,94,105,73,105,83,
+75,54,48,48,54,54,41,36,31,26,68,79,89,114,118,56,62,114,53,61,95,254,1,59,
+39,45,38,32,36,37,0,0,2,252,241,252,211,0,211,0,131,0,54,0,66,0,0,19,20,6,
+35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,55,6,21,20,22,
+51,50,54,55,51,22,51,50,54,53,52,38,35,55,50,54,53,52,39,51,22,21,20,6,7,
+22,37,20,22,51,50,54,53,52,38,35,34,6,211,122,96,187,66,36,114,105,120,148,
+168,112,86,106,86,81,81,89,4,43,100,79,77,123,26,53,55,143,62,60,118,90,15,
+70,75,92,141,57,66,60,188,252,233,52,47,50,47,48,47,48,53,253,191,101,135,
+209,103,106,184,149,151,225,117,94,96,111,105,91,46,52,115,81,105,84,85,169,
+66,55,69,93,81,98,73,109,120,91,107,79,127,30,81,69,41,47,49,40,36,54,51,
+0,3,253,164,252,242,0,120,255,146,0,12,0,24,0,36,0,0,1,52,54,51,50,22,21,
+20,6,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,37,52,54,51,50,22,21,20,
+6,35,34,38,253,164,208,160,152,204,81,161,114,167,201,2,92,131,105,109,138,
+129,117,105,132,254,182,47,42,42,47,47,42,43,46,254,66,146,190,186,140,93,
+158,95,183,188,94,116,121,95,94,109,117,102,35,45,45,35,36,45,45,0,3,253,
+101,252,254,0,171,255,152,0,20,0,51,0,60,0,0,19,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,54,51,50,22,23,22,7,52,39,6,6,35,34,38,53,52,54,51,50,23,38,38,
+35,34,6,21,20,22,51,50,54,55,51,22,51,50,54,39,34,21,20,22,51,50,55,38,171,
+116,101,89,93,26,18,103,71,99,122,113,196,118,142,177,5,87,89,9,14,80,55,
+61,80,72,61,50,44,21,134,95,131,176,64,57,64,65,20,43,43,135,68,70,156,78,
+35,33,86,14,39,253,235,114,123,87,80,76,91,142,113,118,188,105,121,101,78,
+71,26,26,37,47,75,52,52,65,21,47,56,159,121,67,80,70,65,135,74,211,50,21,
+25,70,26,0,4,253,80,251,233,0,150,255,152,0,20,0,51,0,60,0,69,0,0,19,20,6,
+35,34,38,39,6,6,35,34,38,53,52,54,54,51,50,22,23,22,7,52,39,6,6,35,34,38,
+53,52,54,51,50,23,38,38,35,34,6,21,20,22,51,50,54,55,51,22,51,50,54,39,34,
+21,20,22,51,50,55,38,3,22,21,20,35,34,53,52,55,150,116,101,89,93,26,18,103,
+71,99,122,113,196,118,142,177,5,87,89,9,14,80,55,61,80,72,61,50,44,21,134,
+95,131,176,64,57,64,65,20,43,43,135,68,70,156,78,35,33,86,14,39,207,53,74,
+78,56,253,235,114,123,87,80,76,91,142,113,118,188,105,121,101,78,71,26,26,
+37,47,75,52,52,65,21,47,56,159,121,67,80,70,65,135,74,211,50,21,25,70,26,
+254,67,147,70,62,62,64,153,0,1,253,24,252,176,0,150,255,175,0,76,0,0,1,52,
+54,55,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,21,20,6,35,39,54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,38,35,34,
+6,7,35,38,35,34,6,21,20,22,51,51,23,34,6,21,20,51,50,55,23,6,35,34,38,253,
+24,84,73,134,126,96,74,103,28,19,98,72,109,146,135,120,100,121,101,79,69,
+73,73,66,10,45,33,27,36,42,77,69,77,93,105,88,57,81,15,42,50,108,53,64,59,
+47,30,13,90,91,121,61,52,29,82,67,102,131,253,120,77,105,25,50,116,83,111,
+78,67,65,80,208,159,186,211,133,108,90,121,76,53,57,61,49,10,43,23,30,54,
+44,50,66,119,100,114,137,57,49,106,53,46,36,48,68,71,58,82,15,148,24,111,
+0,0,2,252,136,253,115,0,13,255,143,0,14,0,26,0,0,1,33,38,53,52,54,51,50,22,
+21,20,6,6,35,33,1,52,38,35,34,6,21,20,22,51,50,54,252,148,1,226,32,116,102,
+100,121,70,129,144,253,210,3,40,68,62,54,69,60,64,65,64,254,20,70,77,106,
+126,142,117,83,138,60,1,21,55,59,59,54,50,65,63,0,0,4,253,102,251,233,0,183,
+255,143,0,19,0,35,0,47,0,56,0,0,1,52,54,54,51,50,22,22,21,20,6,35,34,38,39,
+6,6,35,34,38,37,51,22,51,50,53,52,38,35,34,6,21,20,22,51,50,3,52,54,51,50,
+22,21,20,6,35,34,38,19,52,55,51,22,21,20,35,34,253,102,116,193,112,116,196,
+116,115,97,81,102,30,24,106,77,104,113,1,134,69,34,106,128,166,140,132,168,
+65,54,119,23,45,39,41,45,45,41,39,45,8,56,43,53,74,78,254,28,112,169,90,92,
+170,112,121,146,79,93,83,89,146,146,128,128,118,140,139,114,68,65,1,1,31,
+41,41,31,31,41,41,253,147,64,153,147,70,62,0,0,2,253,69,253,14,0,150,255,
+143,0,19,0,35,0,0,1,52,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,
+37,51,22,51,50,53,52,38,35,34,6,21,20,22,51,50,253,69,116,193,112,116,196,
+116,115,97,81,102,30,24,106,77,104,113,1,134,69,34,106,128,166,140,132,168,
+65,54,119,254,28,112,169,90,92,170,112,121,146,79,93,83,89,146,146,128,128,
+118,140,139,114,68,65,0,0,3,253,102,251,233,0,183,255,143,0,19,0,35,0,44,
+0,0,1,52,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,37,51,22,51,50,
+53,52,38,35,34,6,21,20,22,51,50,3,52,55,51,22,21,20,35,34,253,102,116,193,
+112,116,196,116,115,97,81,102,30,24,106,77,104,113,1,134,69,34,106,128,166,
+140,132,168,65,54,119,15,56,43,53,74,78,254,28,112,169,90,92,170,112,121,
+146,79,93,83,89,146,146,128,128,118,140,139,114,68,65,254,117,64,153,147,
+70,62,0,0,2,253,153,253,14,1,52,0,211,0,40,0,50,0,0,1,20,6,35,34,38,39,6,
+35,34,38,53,52,54,51,50,22,22,23,54,53,52,38,39,38,53,52,54,51,50,22,21,20,
+6,7,22,22,51,50,55,22,37,38,38,35,34,6,21,20,51,50,1,52,61,54,67,101,61,114,
+155,145,165,142,111,76,108,85,64,135,80,71,8,30,24,65,112,69,67,35,71,51,
+46,33,30,254,93,83,99,67,64,70,184,109,253,111,47,50,89,94,68,137,119,103,
+125,56,101,97,93,172,98,132,18,19,23,30,35,228,131,109,187,67,45,39,25,36,
+155,130,75,63,51,125,0,0,1,253,30,252,204,0,238,0,131,0,51,0,0,1,52,54,51,
+50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,50,55,51,22,51,50,54,53,
+52,38,39,38,53,52,54,51,50,22,18,21,20,6,35,34,38,39,6,6,35,34,38,253,30,
+116,90,73,84,145,12,53,37,36,48,48,90,77,181,51,55,50,146,86,75,135,115,8,
+30,24,54,133,92,125,108,80,119,31,34,124,104,113,138,253,235,109,142,83,61,
+117,24,62,12,49,27,34,63,54,65,72,175,175,114,111,165,245,26,19,23,30,35,
+156,254,250,150,174,209,115,100,105,110,160,0,0,2,253,30,251,223,0,238,0,
+131,0,51,0,60,0,0,1,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,
+51,50,55,51,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,21,20,6,35,34,
+38,39,6,6,35,34,38,1,52,55,51,22,21,20,35,34,253,30,115,91,73,84,145,12,53,
+37,36,48,48,90,77,183,49,55,50,146,86,75,135,115,8,30,24,54,133,92,125,108,
+80,119,31,34,124,104,113,138,1,178,56,43,53,74,78,253,235,109,142,83,61,117,
+24,62,12,49,27,34,63,54,65,72,175,175,114,111,168,239,29,19,23,30,35,156,
+254,250,150,174,209,115,100,105,110,160,254,177,64,153,147,70,62,0,1,254,
+14,252,214,1,134,0,132,0,62,0,0,1,52,54,55,54,54,53,52,38,35,34,6,21,20,23,
+7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,
+52,38,39,38,53,52,54,51,50,22,18,21,16,33,34,38,39,6,6,35,34,38,254,38,69,
+69,63,51,55,50,43,49,22,45,56,97,79,90,106,54,89,44,37,86,129,49,45,21,82,
+58,101,94,135,115,8,30,24,54,133,92,254,253,68,105,26,31,109,85,83,98,253,
+145,67,89,40,37,48,34,38,41,41,36,35,36,24,63,83,68,88,94,79,59,79,55,28,
+47,34,74,143,67,76,117,120,168,239,29,19,23,30,35,156,254,250,150,254,138,
+95,81,92,84,102,0,2,254,14,251,203,1,134,0,132,0,62,0,71,0,0,1,52,54,55,54,
+54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,51,
+50,55,51,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,21,16,33,34,38,
+39,6,6,35,34,38,1,52,55,51,22,21,20,35,34,254,38,69,69,63,51,55,50,43,49,
+22,45,56,97,79,90,106,54,89,44,37,86,129,49,45,21,82,58,101,94,135,115,8,
+30,24,54,133,92,254,253,68,105,26,31,109,85,83,98,1,72,56,43,53,74,78,253,
+145,67,89,40,37,48,34,38,41,41,36,35,36,24,63,83,68,88,94,79,59,79,55,28,
+47,34,74,143,67,76,117,120,168,239,29,19,23,30,35,156,254,250,150,254,138,
+95,81,92,84,102,254,205,64,153,147,70,62,0,0,2,254,140,252,163,1,244,0,126,
+0,41,0,52,0,0,1,6,6,35,34,38,53,52,54,55,54,54,53,52,38,39,55,22,21,20,6,
+7,22,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,54,55,37,20,51,50,54,
+53,52,38,35,7,6,1,244,48,239,152,197,236,188,148,37,38,46,50,23,167,41,39,
+132,121,131,102,115,106,32,66,79,171,146,126,189,96,253,243,133,54,72,99,
+94,23,43,253,219,142,170,196,164,138,190,11,42,63,33,32,59,17,42,31,111,36,
+67,44,10,115,81,88,111,109,86,52,54,30,113,75,103,122,84,98,173,79,52,40,
+46,55,1,58,0,1,254,34,252,96,0,234,0,134,0,68,0,0,1,52,54,55,62,2,53,52,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,51,50,54,53,52,38,
+39,38,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,23,22,
+22,21,20,6,35,34,38,254,78,46,74,40,39,23,95,43,49,22,45,56,97,79,96,90,57,
+62,40,36,160,120,120,44,46,46,45,90,70,74,92,36,58,17,38,41,35,34,36,38,48,
+50,186,160,124,145,253,37,47,81,67,37,39,46,28,79,41,36,35,36,24,63,83,68,
+88,100,73,56,87,62,40,53,31,87,101,94,56,118,95,95,120,58,73,90,98,79,68,
+75,21,34,40,37,51,47,33,36,98,82,106,142,64,147,170,104,0,0,1,252,121,253,
+117,0,188,1,37,0,19,0,0,1,55,22,51,50,36,18,53,52,38,39,54,51,50,22,21,16,
+0,33,34,252,121,22,109,140,195,1,77,196,48,49,4,71,59,59,254,139,254,192,
+236,253,200,85,37,149,1,6,163,56,69,20,94,156,104,254,197,254,143,0,1,252,
+242,253,37,0,150,255,125,0,43,0,0,1,52,54,51,50,23,54,54,51,50,22,21,20,6,
+6,35,34,38,53,54,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,23,20,6,
+35,34,38,38,252,242,134,110,157,65,27,120,83,105,131,59,81,30,30,39,66,79,
+80,70,80,94,11,74,12,92,80,72,79,80,65,39,30,30,81,59,254,79,137,165,206,
+96,110,164,132,93,138,73,57,46,17,95,76,68,77,104,91,87,108,81,63,76,96,17,
+47,56,72,136,0,1,253,55,252,211,0,127,0,131,0,65,0,0,19,20,6,35,34,39,6,6,
+35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,51,50,
+55,51,22,22,51,50,54,53,52,38,38,39,35,55,33,50,54,53,52,38,39,54,54,51,50,
+21,20,6,7,51,22,22,127,112,93,152,53,30,103,86,93,118,98,81,61,75,75,58,10,
+45,29,23,35,37,73,61,143,41,46,22,73,62,58,62,65,128,91,184,11,1,26,110,96,
+35,34,3,30,23,88,103,123,16,93,117,253,203,113,135,180,88,92,129,103,93,113,
+56,53,48,62,5,51,9,40,21,29,50,38,54,60,132,70,62,73,59,56,108,74,6,139,53,
+64,38,55,10,22,25,166,103,122,12,29,165,0,2,254,173,252,197,1,108,0,161,0,
+49,0,64,0,0,1,20,6,6,35,34,38,53,52,54,54,55,62,2,55,38,35,34,6,21,23,54,
+54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,23,38,39,52,54,51,50,22,21,7,
+22,22,7,52,39,14,2,7,14,2,21,20,51,50,54,1,108,91,180,127,139,166,58,86,73,
+76,92,72,9,64,82,64,77,2,5,38,28,35,38,54,44,60,65,123,95,81,67,7,95,32,27,
+54,63,1,78,84,103,72,19,79,89,67,49,52,34,165,134,162,254,51,97,167,102,111,
+90,59,80,49,31,33,53,88,64,35,51,43,20,26,29,41,31,36,47,66,47,66,83,25,124,
+57,42,49,155,118,36,52,168,27,104,74,63,90,55,33,24,30,41,26,89,150,0,0,1,
+253,151,252,229,1,49,0,132,0,58,0,0,19,39,6,6,35,34,39,6,6,35,34,38,53,52,
+54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,51,50,55,51,22,51,50,
+54,53,52,38,38,39,38,53,52,54,51,50,22,18,21,20,7,35,54,202,1,24,78,48,162,
+57,31,108,90,98,122,109,82,64,73,80,58,9,46,32,26,41,38,75,64,159,40,49,39,
+131,78,104,47,110,87,8,30,24,73,135,83,17,97,11,253,119,30,35,40,187,92,95,
+138,113,89,120,71,55,52,66,5,54,10,44,22,30,56,43,50,60,132,132,77,114,56,
+155,134,21,19,23,30,35,201,254,203,149,132,136,66,0,0,1,254,23,253,45,0,246,
+0,131,0,38,0,0,1,52,54,51,50,22,23,22,22,51,50,53,52,38,39,38,53,52,54,51,
+50,22,18,21,16,35,34,38,39,38,38,35,34,6,21,20,23,7,38,254,23,126,98,54,95,
+69,57,46,27,88,135,115,8,30,24,54,133,92,148,33,63,57,65,88,49,82,81,8,59,
+18,253,163,118,149,52,79,63,29,149,168,239,29,19,23,30,35,156,254,250,150,
+254,226,38,65,72,48,82,71,24,37,9,54,0,3,253,2,253,96,0,150,255,102,0,22,
+0,33,0,44,0,0,19,20,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,23,54,54,51,
+50,22,5,38,38,35,34,6,21,20,22,51,50,37,52,38,35,34,6,7,22,51,50,54,150,130,
+119,134,73,33,106,67,116,138,132,104,84,120,18,18,119,84,106,131,254,0,1,
+77,81,64,78,82,71,128,1,173,79,66,79,76,1,25,131,69,76,254,115,124,151,110,
+53,57,150,125,107,136,89,81,81,89,133,100,61,91,79,69,64,78,145,69,76,93,
+61,137,77,0,4,252,248,252,210,0,150,255,179,0,28,0,39,0,51,0,78,0,0,19,20,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,51,38,53,52,54,51,50,
+22,37,20,22,51,50,53,52,38,35,34,6,5,20,22,51,50,54,53,52,38,35,34,6,5,52,
+39,22,21,20,6,35,33,34,38,53,52,55,6,21,20,22,51,50,54,55,51,22,51,50,54,
+150,137,107,82,120,17,17,114,81,111,140,153,114,73,90,24,114,24,91,72,114,
+153,253,25,46,43,89,44,43,44,47,1,126,44,45,43,47,48,44,43,44,1,23,49,7,84,
+75,254,152,75,85,7,48,102,80,72,82,20,49,44,143,77,93,254,36,148,190,100,
+82,81,101,190,148,171,228,96,76,52,37,37,52,76,96,228,46,36,41,78,31,45,43,
+33,35,43,41,36,34,43,45,202,122,73,22,26,75,84,84,75,25,22,74,124,103,106,
+73,67,140,116,0,0,3,253,250,252,162,1,26,0,131,0,47,0,56,0,67,0,0,19,22,21,
+20,6,35,34,38,53,52,55,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,
+55,6,21,20,22,23,22,23,54,54,53,52,39,52,54,51,50,18,21,16,1,20,51,50,53,
+52,38,35,34,1,52,38,35,34,6,21,20,51,50,54,42,41,94,96,84,102,40,2,119,144,
+151,112,79,80,74,69,67,73,8,62,101,107,133,57,135,106,168,32,27,69,116,253,
+164,81,82,42,38,83,1,66,55,47,49,53,101,47,56,253,170,47,57,72,88,83,70,60,
+34,146,119,114,157,93,75,78,91,83,74,31,26,48,80,72,67,8,10,31,12,115,128,
+236,67,42,49,255,0,149,254,220,1,60,66,67,29,38,254,15,32,32,34,31,64,33,
+0,3,252,237,252,210,0,150,255,171,0,55,0,67,0,79,0,0,19,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,
+54,55,51,22,51,50,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,22,37,20,
+22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,150,140,112,
+81,118,18,17,117,82,108,144,157,117,72,90,86,69,66,83,7,57,108,82,65,87,20,
+49,43,138,83,98,58,7,83,62,72,86,90,71,118,157,253,22,46,42,45,44,44,43,43,
+47,2,44,48,43,43,44,43,46,42,47,254,43,153,192,98,82,81,99,191,144,169,225,
+95,76,77,102,76,71,25,22,82,114,111,106,75,64,139,114,103,113,84,22,26,71,
+76,98,81,76,95,219,39,35,41,42,34,32,45,43,34,34,43,45,32,34,42,41,0,0,3,
+252,252,250,211,0,150,0,70,0,28,0,40,0,96,0,0,1,35,53,33,54,54,53,52,39,51,
+22,21,20,7,33,21,35,39,22,22,21,20,6,35,34,38,53,52,55,23,20,22,51,50,54,
+53,52,38,35,34,6,1,20,7,35,54,53,52,39,6,6,35,34,39,6,6,35,34,38,53,52,54,
+51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,22,51,50,55,51,22,51,50,
+54,53,52,39,54,54,51,50,18,253,148,32,1,3,45,59,20,122,13,132,1,23,28,80,
+36,42,153,136,128,151,81,22,98,81,87,96,100,83,80,99,2,160,9,97,6,4,24,78,
+48,162,57,31,108,90,96,124,109,82,63,68,75,57,9,19,21,27,25,35,44,71,68,159,
+40,49,39,131,64,85,114,7,44,24,88,77,254,141,120,39,117,56,42,67,52,43,119,
+107,120,1,26,78,43,105,118,121,102,89,58,94,59,55,57,57,51,64,65,253,8,90,
+61,45,44,50,37,35,40,187,92,95,131,100,89,120,67,49,52,66,5,54,4,32,18,18,
+24,51,36,45,57,132,132,75,71,123,81,22,28,254,206,0,0,3,253,180,250,81,1,
+160,255,201,0,73,0,144,0,154,0,0,5,52,35,34,6,21,20,23,7,38,38,53,52,54,51,
+50,22,23,22,22,51,50,54,55,23,20,6,35,34,39,23,20,6,7,6,6,21,20,51,50,54,
+55,51,22,22,51,50,54,53,52,39,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,55,54,54,1,20,6,7,39,54,53,52,38,35,34,7,23,20,7,22,21,20,6,35,
+34,39,54,54,53,39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,21,35,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,23,54,51,50,
+22,1,38,35,34,6,21,20,22,51,50,254,172,81,42,50,21,32,29,35,92,70,40,63,49,
+48,72,48,69,99,40,26,111,93,107,101,3,47,47,44,45,94,52,75,14,44,17,76,67,
+55,58,64,7,32,19,32,36,82,102,65,100,12,24,104,71,72,93,59,85,48,43,2,244,
+25,22,48,22,54,47,98,4,1,48,39,54,40,37,26,38,37,2,47,123,65,91,120,126,101,
+123,86,28,62,54,109,69,70,55,52,69,21,51,47,108,80,62,86,21,15,79,52,117,
+45,40,104,72,86,254,100,62,116,59,77,62,61,123,216,47,42,31,25,25,25,17,62,
+36,63,84,26,45,46,30,57,58,11,91,105,97,20,37,52,34,31,49,33,66,71,64,67,
+68,52,39,62,16,21,26,69,58,93,148,98,73,76,93,89,63,50,87,60,35,44,253,106,
+39,76,24,25,31,37,40,43,103,34,93,93,61,77,54,74,34,20,77,43,22,60,71,94,
+72,75,96,73,57,66,55,66,92,46,46,46,39,36,31,26,69,68,81,112,63,55,57,61,
+108,108,95,254,160,54,39,31,35,28,0,2,252,136,252,148,1,176,1,82,0,35,0,48,
+0,0,1,20,2,35,34,39,33,55,33,38,53,52,54,51,50,22,21,20,6,7,22,51,50,54,54,
+53,52,38,39,39,52,54,51,50,22,18,5,20,23,22,51,50,54,53,52,38,35,34,6,1,176,
+231,189,219,125,253,212,12,1,217,24,122,97,100,121,103,102,79,115,81,152,
+98,181,192,3,58,46,95,172,104,253,3,31,37,35,78,72,68,62,57,66,254,193,250,
+254,205,223,161,69,59,110,141,142,117,105,149,18,52,91,191,142,179,245,49,
+26,45,66,181,254,209,233,54,57,6,68,52,55,59,67,0,0,2,252,136,252,148,1,162,
+1,140,0,46,0,59,0,0,1,20,2,35,34,39,33,55,33,38,53,52,54,51,50,22,21,20,6,
+7,22,51,50,54,54,53,52,38,39,54,54,53,52,38,39,39,52,54,51,50,22,21,20,6,
+7,22,22,5,20,23,22,51,50,54,53,52,38,35,34,6,1,162,232,174,219,125,253,212,
+12,1,217,24,122,97,100,121,103,102,79,115,75,145,95,94,78,52,61,65,49,1,59,
+42,63,79,68,74,84,90,253,17,31,37,35,78,72,68,62,57,66,254,117,206,254,237,
+223,161,69,59,110,141,142,117,105,149,18,52,80,155,107,109,187,66,34,91,44,
+50,78,4,9,30,48,97,75,54,105,42,87,214,101,54,57,6,68,52,55,59,67,0,0,2,252,
+136,252,46,1,128,0,15,0,59,0,71,0,0,1,54,53,52,38,35,34,6,21,20,22,23,22,
+22,21,20,6,35,34,38,53,52,55,7,33,55,33,38,53,52,54,51,50,22,21,20,6,7,6,
+6,21,20,51,50,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,7,5,50,54,53,52,
+38,35,34,6,21,20,22,1,34,17,38,41,35,34,33,37,49,53,186,160,125,144,36,82,
+253,210,12,1,226,32,116,102,100,121,45,46,44,39,160,111,129,45,45,46,45,90,
+70,74,92,36,253,211,65,64,68,62,54,69,60,254,228,34,40,37,51,47,33,35,75,
+64,84,129,72,147,170,107,100,68,53,3,161,70,77,106,126,142,117,66,118,39,
+34,57,33,97,85,70,57,111,86,88,113,58,73,90,98,79,68,75,185,63,51,55,59,59,
+54,50,65,0,3,253,195,251,219,2,6,0,131,0,28,0,48,0,60,0,0,1,35,53,33,54,53,
+52,39,51,22,21,20,6,7,33,21,35,39,22,22,21,20,6,35,34,38,53,52,55,5,16,0,
+33,34,39,55,22,51,50,36,18,53,52,38,39,54,51,50,22,5,20,22,51,50,54,53,52,
+38,35,34,6,254,157,32,1,3,102,33,122,27,70,61,1,23,28,83,37,44,155,134,125,
+154,84,3,26,254,139,254,192,236,162,22,109,140,195,1,77,196,48,49,4,71,59,
+59,252,249,100,79,85,98,101,82,78,101,254,141,120,86,135,83,78,58,72,69,133,
+50,120,1,28,90,49,107,126,129,104,102,65,7,254,197,254,143,83,85,37,149,1,
+6,163,56,69,20,94,156,211,60,64,66,58,59,76,76,0,2,252,83,251,109,0,150,255,
+40,0,17,0,37,0,0,1,52,54,51,50,22,21,21,35,53,52,38,35,34,6,21,21,35,3,55,
+22,51,50,36,18,53,52,38,39,54,51,50,22,21,16,0,33,34,252,200,167,138,139,
+162,127,77,97,103,75,127,117,22,109,140,195,1,77,196,48,49,4,71,59,59,254,
+139,254,192,236,253,100,204,248,245,207,139,127,162,211,204,161,135,254,231,
+85,37,149,1,6,163,56,69,20,94,156,104,254,197,254,143,0,3,252,241,251,109,
+1,172,0,131,0,54,0,66,0,86,0,0,1,34,38,53,52,54,51,50,22,21,20,6,35,34,38,
+53,55,6,21,20,22,51,50,54,55,51,22,51,50,54,53,52,38,35,55,50,54,53,52,39,
+51,22,21,20,6,7,22,21,20,6,35,34,39,6,6,3,20,22,51,50,54,53,52,38,35,34,6,
+5,16,0,33,34,39,55,22,51,50,36,18,53,52,38,39,54,51,50,22,253,253,120,148,
+168,112,86,106,86,81,81,89,4,43,100,79,77,123,26,53,55,143,62,60,118,90,15,
+70,75,92,141,57,66,60,188,122,96,187,66,36,114,170,52,47,50,47,48,47,48,53,
+3,240,254,139,254,192,236,162,22,109,140,195,1,77,196,48,49,4,71,59,59,252,
+211,184,149,151,225,117,94,96,111,105,91,46,52,115,81,105,84,85,169,66,55,
+69,93,81,98,73,109,120,91,107,79,127,30,81,193,101,135,209,103,106,1,242,
+41,47,49,40,36,54,51,212,254,197,254,143,83,85,37,149,1,6,163,56,69,20,94,
+156,0,0,4,253,101,251,189,1,172,255,152,0,20,0,40,0,71,0,80,0,0,1,52,54,54,
+51,50,22,23,22,21,20,6,35,34,38,39,6,6,35,34,38,37,16,0,33,34,39,55,22,51,
+50,36,18,53,52,38,39,54,51,50,22,5,20,22,51,50,54,55,51,22,51,50,54,53,52,
+39,6,6,35,34,38,53,52,54,51,50,23,38,38,35,34,6,37,34,21,20,22,51,50,55,38,
+253,101,113,196,118,142,177,5,87,116,101,89,93,26,18,103,71,99,122,4,71,254,
+139,254,192,236,162,22,109,140,195,1,77,196,48,49,4,71,59,59,252,49,64,57,
+64,65,20,43,43,135,68,70,9,14,80,55,61,80,72,61,50,44,21,134,95,131,176,1,
+217,78,35,33,86,14,39,253,253,118,188,105,121,101,78,129,114,123,87,80,76,
+91,142,221,254,197,254,143,83,85,37,149,1,6,163,56,69,20,94,156,158,67,80,
+70,65,135,74,59,26,26,37,47,75,52,52,65,21,47,56,159,17,50,21,25,70,26,0,
+0,3,252,136,252,42,1,122,255,176,0,19,0,34,0,46,0,0,1,55,22,51,50,36,54,53,
+52,39,54,54,51,50,22,21,16,0,33,34,1,33,38,53,52,54,51,50,22,21,20,6,6,35,
+33,1,52,38,35,34,6,21,20,22,51,50,54,253,120,22,137,134,180,1,35,166,127,
+2,40,35,66,80,254,189,254,211,230,254,112,2,70,32,116,102,100,121,70,129,
+144,253,110,3,140,68,62,54,69,60,64,65,64,252,134,85,47,116,214,140,167,48,
+41,46,172,138,254,226,254,206,1,234,70,77,106,126,142,117,83,138,60,1,21,
+55,59,59,54,50,65,63,0,3,252,63,251,205,0,150,255,143,0,19,0,39,0,55,0,0,
+1,52,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,19,55,22,51,50,36,
+54,53,52,39,54,54,51,50,22,21,16,0,33,34,19,51,22,51,50,53,52,38,35,34,6,
+21,20,22,51,50,252,63,117,194,113,115,194,116,115,97,81,102,30,24,106,77,
+104,113,85,22,137,134,180,1,35,166,127,2,40,35,66,80,254,189,254,211,230,
+133,69,34,106,128,166,140,132,168,65,54,119,254,28,112,169,90,92,170,112,
+121,146,79,93,83,89,146,254,137,85,47,116,214,140,167,48,41,46,172,138,254,
+226,254,206,2,101,128,128,118,140,139,114,68,65,0,0,2,253,30,251,139,2,6,
+0,131,0,51,0,71,0,0,1,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,
+22,51,50,55,51,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,21,20,6,35,
+34,38,39,6,6,35,34,38,19,55,22,51,50,36,18,53,52,38,39,54,51,50,22,21,16,
+0,33,34,253,30,115,91,73,84,145,12,53,37,36,48,48,90,77,183,49,55,50,146,
+86,75,135,115,8,30,24,54,133,92,125,108,80,119,31,34,124,104,113,138,165,
+22,109,140,195,1,77,196,48,49,4,71,59,59,254,139,254,192,236,253,235,109,
+142,83,61,117,24,62,12,49,27,34,63,54,65,72,175,175,114,111,168,239,29,19,
+23,30,35,156,254,250,150,174,209,115,100,105,110,160,254,114,85,37,149,1,
+6,163,56,69,20,94,156,104,254,197,254,143,0,2,254,14,251,159,2,146,0,132,
+0,62,0,82,0,0,1,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,39,38,53,52,
+54,51,50,22,18,21,16,33,34,38,39,6,6,35,34,38,19,55,22,51,50,36,18,53,52,
+38,39,54,51,50,22,21,16,0,33,34,254,38,67,83,58,44,55,50,43,49,22,45,56,97,
+79,90,106,64,79,44,37,86,129,49,45,21,82,58,101,94,135,115,8,30,24,54,133,
+92,254,253,68,105,26,31,109,85,83,98,41,22,109,140,195,1,77,196,48,49,4,71,
+59,59,254,139,254,192,236,253,145,62,90,63,44,55,41,38,41,41,36,35,36,24,
+63,83,68,88,94,79,66,95,65,36,48,32,74,143,67,76,117,120,168,239,29,19,23,
+30,35,156,254,250,150,254,138,95,81,92,84,102,254,182,85,37,149,1,6,163,56,
+69,20,94,156,104,254,197,254,143,0,0,2,0,116,255,231,4,36,4,106,0,34,0,46,
+0,0,1,21,35,34,39,22,22,21,20,6,35,34,38,53,52,55,6,35,35,55,33,54,54,53,
+52,39,33,55,33,21,35,22,21,20,7,19,52,38,35,34,6,21,20,22,51,50,54,4,36,42,
+143,48,80,92,220,195,183,218,172,53,127,56,10,1,129,23,35,28,254,84,15,2,
+155,122,18,20,187,147,124,125,144,137,131,139,133,2,237,148,4,37,150,95,163,
+185,190,158,186,96,4,148,9,52,35,57,37,191,191,46,50,54,40,254,142,102,122,
+121,103,95,110,116,0,2,0,80,255,231,6,52,4,130,0,65,0,76,0,0,1,20,2,35,34,
+38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,34,6,21,20,23,53,52,
+54,51,50,22,21,20,35,34,38,38,53,52,54,51,50,18,21,20,7,22,22,51,50,54,53,
+52,38,38,35,35,55,33,21,22,22,1,50,55,38,38,35,34,6,21,20,22,6,52,198,200,
+115,193,128,68,188,109,143,166,151,126,95,164,107,59,143,123,80,96,43,56,
+43,52,57,140,43,96,68,157,129,165,189,62,99,156,95,146,169,65,134,96,129,
+15,1,100,78,76,251,85,157,100,90,137,67,70,69,88,1,245,252,254,238,91,107,
+94,104,146,131,111,137,69,72,112,150,176,174,70,66,64,32,7,47,48,62,48,121,
+49,113,90,130,162,254,227,248,179,147,60,46,155,164,106,198,127,191,184,91,
+215,254,39,95,75,68,65,50,58,65,0,1,0,120,0,0,4,132,4,106,0,24,0,0,37,21,
+35,53,16,2,38,35,34,6,2,17,21,35,53,52,18,55,33,55,33,21,35,22,18,4,132,209,
+61,146,99,104,140,67,210,161,165,254,186,15,2,255,68,169,153,241,241,214,
+1,19,1,22,172,162,254,240,254,236,229,236,232,1,113,102,191,191,102,254,142,
+0,0,4,0,110,254,103,6,214,4,106,0,3,0,15,0,76,0,88,0,0,19,33,21,33,5,52,54,
+51,50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,
+21,20,51,50,55,51,22,22,51,50,54,53,52,38,39,55,22,22,51,50,54,53,52,39,51,
+22,21,20,6,35,34,39,23,20,6,6,35,34,3,6,6,35,34,38,1,52,54,55,51,22,22,21,
+20,6,35,34,135,5,73,250,168,2,28,68,54,54,69,68,55,55,67,253,218,146,119,
+96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,58,89,86,96,
+118,66,63,71,9,95,8,121,104,64,61,3,53,137,118,236,88,46,158,133,146,178,
+2,42,46,31,60,31,45,53,52,108,4,106,191,202,52,69,69,52,52,68,68,254,173,
+137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,82,128,
+98,75,113,72,70,59,25,27,37,43,118,140,24,67,111,203,140,1,20,135,141,206,
+254,8,43,174,87,83,171,50,46,40,0,2,0,100,255,231,7,64,4,130,0,96,0,108,0,
+0,55,52,54,55,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,
+23,55,54,54,51,50,22,22,23,30,2,51,50,54,53,52,39,55,22,21,20,6,35,34,38,
+38,39,46,2,35,34,6,7,1,6,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,
+54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,1,52,54,51,50,22,21,20,6,
+35,34,38,138,75,82,137,35,33,18,74,75,72,81,34,63,87,59,124,94,124,151,11,
+64,82,165,102,77,107,68,43,40,59,90,62,60,60,38,76,76,115,94,64,87,55,37,
+46,83,153,119,63,132,51,254,126,48,37,90,78,216,75,71,41,128,113,95,113,60,
+56,12,45,29,59,74,151,156,124,167,36,50,166,124,130,167,2,155,68,54,54,69,
+68,55,55,67,247,83,134,83,138,35,39,48,34,56,75,69,62,60,62,40,101,128,60,
+112,74,125,112,65,83,89,61,88,73,67,79,54,63,54,62,74,40,103,124,109,139,
+46,69,61,77,95,68,58,52,254,123,49,70,38,57,67,224,126,98,118,100,76,130,
+31,35,42,180,138,194,231,148,128,143,133,153,2,10,52,69,69,52,52,68,68,0,
+0,1,0,100,255,231,5,178,4,130,0,75,0,0,1,35,22,22,21,20,6,35,34,3,6,6,35,
+34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,
+50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,53,52,38,35,35,55,51,54,
+53,52,39,35,55,33,21,22,21,20,7,51,5,178,202,74,76,164,133,246,88,50,170,
+134,100,127,56,93,134,83,70,74,75,72,81,34,63,87,59,124,94,129,147,97,122,
+83,65,168,216,75,71,35,113,98,196,142,120,126,10,175,58,28,218,15,1,79,18,
+26,249,2,104,56,163,95,143,184,1,20,144,132,87,134,73,92,146,104,64,100,66,
+56,75,69,62,60,62,40,101,128,60,112,74,146,125,98,157,96,65,94,50,137,224,
+110,114,181,113,136,148,30,61,46,38,191,191,39,45,56,35,0,0,3,0,107,254,103,
+6,6,4,130,0,51,0,63,0,75,0,0,1,20,6,35,34,3,6,6,35,34,2,53,52,18,54,51,50,
+22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,
+52,2,39,35,55,33,21,35,22,18,1,20,22,51,50,54,53,52,38,35,34,6,1,22,22,21,
+20,6,35,34,53,52,54,55,6,6,200,180,236,88,53,161,123,181,213,108,191,119,
+113,131,119,114,113,122,8,101,159,143,121,142,35,71,35,120,105,122,143,237,
+189,82,15,1,108,40,137,170,251,126,75,68,73,70,71,69,70,76,1,226,31,45,53,
+52,108,46,31,1,185,224,242,1,20,151,125,1,25,237,192,1,45,168,154,137,133,
+155,145,127,42,34,131,251,176,179,106,118,110,114,142,134,195,1,9,17,191,
+191,68,254,233,1,15,57,66,68,56,51,72,69,252,87,83,171,50,46,40,86,43,174,
+87,0,0,1,0,100,255,231,5,126,4,130,0,83,0,0,1,20,6,6,35,34,3,6,6,35,34,38,
+38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,
+22,23,30,2,51,50,54,53,39,35,55,51,21,22,21,20,6,35,34,38,39,20,6,6,7,6,6,
+21,20,51,50,55,51,22,22,51,50,54,53,52,39,54,54,51,50,22,5,126,51,132,114,
+246,88,50,170,134,100,127,56,93,134,83,70,74,75,72,81,34,63,87,59,124,94,
+75,111,74,48,45,64,92,61,64,80,3,157,15,236,6,126,92,98,163,82,43,77,73,83,
+65,168,216,75,71,41,123,98,117,111,112,12,45,29,61,65,1,108,92,175,122,1,
+20,144,132,87,134,73,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,
+112,74,55,79,66,61,70,48,71,58,35,191,179,36,39,119,159,137,151,93,120,83,
+58,66,93,50,137,224,127,97,113,85,119,88,35,42,179,0,0,3,0,111,254,103,9,
+173,6,52,0,77,0,89,0,101,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,
+0,53,52,54,55,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,7,22,22,21,20,7,
+22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,21,20,7,22,22,51,50,54,
+53,52,38,39,55,55,33,21,22,18,5,52,38,35,34,6,21,20,22,51,50,54,1,22,22,21,
+20,6,35,34,53,52,54,55,9,173,192,167,110,162,76,41,161,117,109,162,76,65,
+232,161,243,254,220,140,122,255,0,15,2,148,125,101,47,113,77,150,53,115,101,
+128,141,25,58,138,95,123,142,166,204,12,37,37,69,196,143,8,61,145,104,123,
+142,205,178,1,15,1,4,93,114,250,87,214,167,171,214,204,178,179,205,3,16,31,
+45,53,52,108,46,31,1,196,222,255,118,114,109,123,117,113,108,122,1,27,234,
+155,225,67,191,34,73,55,112,125,59,158,192,87,115,79,12,67,230,156,94,81,
+62,69,144,130,150,198,71,36,47,48,64,173,254,226,163,65,48,72,81,144,130,
+170,246,63,4,187,175,98,254,254,36,169,209,209,169,175,202,202,254,105,83,
+171,50,46,40,86,43,174,87,0,0,2,0,90,254,211,7,252,4,130,0,93,0,103,0,0,1,
+20,6,35,34,38,38,39,46,2,35,34,7,22,21,20,7,22,22,21,20,6,35,34,38,53,54,
+54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,34,6,21,35,52,
+38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,23,54,54,51,
+50,22,22,23,30,2,51,50,54,53,52,39,55,22,1,38,38,35,34,6,21,20,51,50,7,252,
+142,106,82,95,45,24,20,39,76,64,154,6,7,109,61,68,79,63,67,73,72,56,39,76,
+189,92,151,181,166,140,103,189,78,84,112,91,80,90,109,110,101,101,102,33,
+64,79,175,125,105,141,32,23,120,74,87,135,40,28,116,85,69,84,42,23,21,35,
+66,55,74,85,27,76,65,251,186,61,160,87,76,101,203,168,3,49,117,156,63,89,
+75,67,80,54,165,49,65,243,189,92,205,88,82,95,87,69,4,66,64,90,89,92,101,
+160,132,126,151,98,85,121,169,136,168,108,98,96,110,83,67,53,53,40,87,115,
+120,173,99,86,88,97,92,90,85,97,63,89,75,68,79,54,82,65,52,54,40,87,253,126,
+73,86,75,57,131,0,0,2,0,112,255,231,5,230,6,42,0,74,0,86,0,0,1,20,6,35,34,
+38,39,6,6,35,34,38,38,53,52,18,55,38,38,53,52,54,51,23,6,6,21,20,22,23,22,
+22,21,20,6,35,34,38,53,55,6,6,21,20,22,51,50,54,55,51,22,51,50,54,53,52,38,
+38,35,55,50,54,53,52,38,35,55,50,22,21,20,6,7,22,22,1,34,6,21,20,22,51,50,
+54,53,52,38,5,230,170,140,129,174,41,53,161,123,110,187,110,159,128,68,85,
+188,157,18,84,96,49,44,106,134,113,108,108,116,3,43,53,161,143,121,142,35,
+71,72,200,84,98,72,153,115,16,97,116,99,78,66,118,155,114,94,135,181,252,
+53,63,70,68,62,66,63,64,1,75,161,195,146,130,151,125,135,232,140,195,1,52,
+56,45,137,79,125,151,85,18,126,87,57,105,35,4,155,118,127,148,138,121,45,
+52,161,79,160,179,106,118,225,106,87,68,119,74,130,98,88,77,98,50,132,98,
+83,121,28,25,220,1,177,66,52,54,63,65,53,48,69,0,0,3,0,111,255,231,4,155,
+4,106,0,17,0,29,0,41,0,0,1,20,6,6,35,34,38,38,53,52,54,55,33,55,33,21,22,
+22,7,52,38,35,34,6,21,20,22,51,50,54,37,20,6,35,34,38,53,52,54,51,50,22,4,
+155,122,241,170,163,242,130,140,122,255,0,15,3,19,124,136,151,214,167,171,
+214,204,178,179,205,254,252,68,55,55,67,68,54,54,69,1,236,142,235,140,133,
+235,149,155,225,67,191,190,67,227,83,169,209,209,169,175,202,202,185,52,68,
+68,52,52,69,69,0,0,3,0,111,255,231,5,174,4,106,0,25,0,58,0,67,0,0,1,20,6,
+35,34,38,39,6,6,35,34,38,38,53,52,18,55,33,55,33,21,22,22,23,22,22,7,52,39,
+6,6,35,34,38,53,52,54,51,50,23,38,38,35,35,34,6,6,21,20,22,51,50,54,55,51,
+22,22,51,50,1,34,21,20,22,51,50,55,38,5,174,190,169,121,156,52,30,162,117,
+117,156,73,177,154,254,190,14,4,19,76,71,4,60,66,130,30,31,123,93,98,121,
+121,103,92,68,21,172,140,116,152,227,120,114,104,93,114,41,71,36,121,114,
+252,255,0,127,57,54,141,22,61,1,129,192,218,123,151,127,147,118,190,109,180,
+1,36,75,191,190,39,127,72,58,171,48,77,66,70,88,108,87,87,105,31,87,88,136,
+225,131,128,135,94,130,113,111,2,11,83,34,41,115,43,0,255,255,0,111,254,103,
+5,174,4,106,2,38,0,160,0,0,0,6,1,181,0,0,0,2,0,110,255,231,5,176,4,169,0,
+3,0,82,0,0,1,33,55,33,1,20,6,35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,54,
+53,52,35,34,6,21,20,51,50,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,
+51,51,23,39,34,6,21,20,51,50,55,23,6,35,34,38,53,52,55,38,38,53,52,54,51,
+50,22,23,54,54,51,50,22,22,4,38,252,149,15,3,92,1,138,183,194,168,173,148,
+117,95,108,100,88,15,28,40,94,66,76,244,122,140,158,131,95,135,21,71,32,108,
+93,67,93,80,76,51,15,45,127,119,212,92,82,45,109,122,161,197,186,72,89,174,
+145,119,160,37,32,167,110,124,170,83,3,244,181,253,33,230,253,178,153,111,
+148,88,68,72,75,4,69,2,28,22,56,71,55,133,125,133,137,164,89,72,80,81,64,
+62,51,59,87,1,60,73,104,24,190,35,126,135,166,57,25,100,72,113,135,100,84,
+88,96,125,204,0,2,0,110,255,231,4,134,4,106,0,42,0,52,0,0,1,20,6,6,35,34,
+38,38,53,52,55,51,22,22,51,32,17,52,39,6,6,35,34,38,53,52,54,51,50,23,38,
+38,39,33,55,33,21,35,22,22,23,22,22,37,38,35,34,6,21,20,51,50,54,4,134,117,
+232,165,182,240,112,6,85,4,210,207,1,141,60,20,159,125,123,138,152,132,94,
+68,21,86,55,253,203,15,2,243,51,52,67,10,104,93,254,211,68,97,87,79,128,84,
+116,1,168,127,203,119,137,216,120,50,47,191,169,1,21,104,67,112,131,118,98,
+97,114,21,51,74,18,191,191,30,101,58,55,177,181,28,55,43,93,86,255,255,0,
+111,254,103,5,140,4,106,2,38,0,165,0,0,0,38,1,181,3,0,0,6,1,182,21,0,0,2,
+0,111,255,231,5,140,4,106,0,24,0,45,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,
+38,53,52,18,55,33,55,33,21,35,22,18,7,52,38,38,35,34,6,6,21,20,22,51,50,54,
+55,51,22,22,51,50,54,5,140,67,155,124,122,146,40,30,162,117,117,156,73,177,
+154,254,183,15,3,241,57,159,181,153,121,229,154,152,227,120,114,104,93,114,
+41,71,40,112,91,115,108,1,136,99,190,128,140,134,127,147,118,190,109,180,
+1,36,75,191,191,74,254,221,129,133,227,136,136,225,131,128,135,94,130,126,
+98,137,0,255,255,0,111,254,103,5,140,4,106,2,38,0,165,0,0,0,6,1,181,255,0,
+0,1,0,111,255,150,5,7,4,106,0,46,0,0,1,20,6,6,35,34,38,38,39,38,38,35,34,
+6,21,20,22,23,20,35,34,38,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,
+2,39,33,55,33,21,35,22,18,5,7,53,140,120,83,120,85,66,66,115,72,73,84,98,
+100,89,46,98,64,133,109,61,92,89,85,76,103,69,106,100,252,208,253,209,15,
+3,105,56,157,183,1,123,95,182,127,68,102,99,98,96,82,77,84,139,26,136,102,
+189,122,150,184,55,106,118,107,69,131,110,215,1,25,16,191,191,72,254,210,
+0,0,3,0,110,255,231,5,123,4,106,0,3,0,15,0,64,0,0,19,33,21,33,5,52,54,51,
+50,22,21,20,6,35,34,38,1,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,
+20,51,50,55,51,22,22,51,50,54,53,52,38,39,54,54,51,50,22,21,20,6,6,35,34,
+3,6,6,35,34,38,135,3,219,252,22,2,28,68,54,54,69,68,55,55,67,253,218,146,
+119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,93,79,12,
+45,29,76,110,53,137,118,236,88,46,158,133,146,178,4,106,191,202,52,69,69,
+52,52,68,68,254,173,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,
+112,132,113,106,163,73,35,42,249,172,111,203,140,1,20,135,141,206,0,4,0,110,
+254,103,5,123,4,106,0,3,0,15,0,64,0,76,0,0,19,33,21,33,5,52,54,51,50,22,21,
+20,6,35,34,38,1,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,
+55,51,22,22,51,50,54,53,52,38,39,54,54,51,50,22,21,20,6,6,35,34,3,6,6,35,
+34,38,1,52,54,55,51,22,22,21,20,6,35,34,135,3,229,252,12,2,28,68,54,54,69,
+68,55,55,67,253,218,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,
+111,105,115,124,93,79,12,45,29,76,110,53,137,118,236,88,46,158,133,146,178,
+2,43,46,31,60,31,45,53,52,108,4,106,191,202,52,69,69,52,52,68,68,254,173,
+137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,106,163,
+73,35,42,249,172,111,203,140,1,20,135,141,206,254,8,43,174,87,83,171,50,46,
+40,0,1,0,100,255,231,5,211,4,130,0,63,0,0,1,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,
+20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,38,39,35,55,33,21,35,
+22,5,211,198,180,117,184,37,49,164,125,135,164,93,134,83,70,74,75,72,81,34,
+63,87,59,124,94,129,147,97,122,83,65,168,216,75,71,37,126,118,132,156,93,
+174,116,186,15,1,245,68,227,1,197,225,252,150,125,141,135,163,131,92,146,
+104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,146,125,98,157,96,65,
+94,50,137,224,116,110,169,161,101,189,125,10,191,191,166,0,0,2,0,100,254,
+103,5,159,4,130,0,64,0,76,0,0,1,20,6,35,34,3,6,6,35,34,38,38,53,52,54,55,
+54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,20,6,7,6,6,21,
+20,51,50,55,51,22,22,51,50,54,53,52,38,38,35,35,55,33,21,35,22,18,1,22,22,
+21,20,6,35,34,53,52,54,55,5,159,179,151,246,88,50,170,134,100,127,56,93,134,
+83,70,74,75,72,81,34,63,87,59,124,94,129,147,97,122,83,65,168,216,75,71,41,
+123,98,107,116,130,221,131,3,15,1,190,145,142,165,253,132,31,45,53,52,108,
+46,31,1,142,192,231,1,20,144,132,87,134,73,92,146,104,64,100,66,56,75,69,
+62,60,62,40,101,128,60,112,74,146,125,98,157,96,65,94,50,137,224,127,97,141,
+135,141,217,119,191,191,70,254,220,253,172,83,171,50,46,40,86,43,174,87,0,
+0,1,0,100,255,231,8,41,6,52,0,81,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,
+6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,
+51,22,22,51,50,54,53,52,2,39,33,55,33,50,54,53,52,39,55,22,21,20,6,7,22,18,
+21,7,22,22,51,50,54,53,52,38,39,55,51,21,22,18,8,41,192,167,108,160,74,37,
+154,122,123,152,39,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,
+251,215,68,71,40,111,90,116,109,253,205,253,68,15,3,141,158,115,113,77,150,
+163,179,159,183,3,60,144,102,123,142,196,174,15,247,93,115,1,196,222,255,
+114,109,100,123,141,135,135,141,206,165,137,172,103,83,152,29,79,14,65,35,
+44,81,67,191,224,127,97,137,122,205,1,17,16,191,70,92,112,125,59,158,192,
+152,138,8,71,254,216,181,58,70,78,144,130,162,255,62,191,166,105,254,245,
+0,0,2,0,107,255,231,9,153,6,52,0,70,0,82,0,0,1,20,6,35,34,38,39,6,35,34,38,
+39,6,6,35,34,38,2,53,16,0,51,50,18,17,20,7,22,22,51,50,54,53,52,2,39,35,55,
+51,50,54,54,53,52,39,55,22,21,20,6,6,7,22,18,21,20,7,22,22,51,50,54,53,52,
+38,39,55,33,21,22,22,5,52,38,35,34,6,21,20,22,51,50,54,9,153,192,167,110,
+161,76,88,254,130,190,86,61,225,132,162,215,101,1,1,219,222,255,17,75,155,
+113,122,143,237,189,82,15,244,125,101,47,113,77,150,64,127,121,138,174,6,
+60,146,103,123,142,196,174,15,1,12,84,103,250,39,199,176,175,203,209,171,
+170,203,1,196,222,255,117,114,231,140,132,140,132,164,1,11,158,1,15,1,63,
+254,196,254,238,100,83,97,98,142,134,195,1,9,17,191,34,73,55,112,125,59,158,
+192,96,119,74,8,65,254,231,154,52,51,71,81,144,130,162,255,62,191,191,103,
+252,24,180,203,199,173,174,211,203,0,2,0,111,255,231,4,155,4,106,0,17,0,29,
+0,0,1,20,6,6,35,34,38,38,53,52,54,55,33,55,33,21,22,22,7,52,38,35,34,6,21,
+20,22,51,50,54,4,155,122,241,170,163,242,130,140,122,255,0,15,3,20,123,136,
+151,214,167,171,214,204,178,179,205,1,236,142,235,140,133,235,149,155,225,
+67,191,190,68,227,82,169,209,209,169,175,202,202,0,0,2,0,107,255,231,5,113,
+4,130,0,36,0,48,0,0,1,16,0,33,32,0,17,52,54,54,51,50,22,21,20,6,35,34,38,
+53,52,55,6,6,21,20,4,33,32,36,53,16,37,55,33,21,22,37,20,22,51,50,54,53,52,
+38,35,34,6,5,113,254,190,254,194,254,200,254,178,109,192,119,117,133,119,
+114,113,122,13,60,56,1,26,1,0,1,5,1,32,254,243,15,1,2,96,252,27,75,68,73,
+70,71,69,70,76,2,89,254,211,254,187,1,71,1,50,164,247,135,155,136,133,155,
+145,127,57,37,64,149,103,209,225,206,187,1,36,63,191,180,141,54,57,66,68,
+56,51,72,69,0,0,1,0,110,255,231,5,151,4,106,0,51,0,0,1,20,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,
+55,51,22,22,51,50,54,53,52,2,39,33,55,33,21,35,22,18,5,151,67,155,124,123,
+152,39,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,
+71,40,111,90,116,109,253,205,253,68,15,3,250,61,158,181,1,136,99,190,128,
+141,135,135,141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,
+127,97,137,122,203,1,19,16,191,191,72,254,218,0,2,0,105,255,231,4,202,4,106,
+0,41,0,57,0,0,1,20,0,33,34,38,53,16,33,51,50,54,53,52,38,35,34,6,21,20,23,
+53,52,54,51,50,22,21,20,6,35,34,38,53,52,55,35,55,33,21,22,22,7,16,37,22,
+21,20,6,35,35,34,6,21,20,33,50,36,4,202,254,182,254,205,230,254,1,128,34,
+126,113,105,94,80,93,23,57,45,50,56,74,69,79,104,48,228,15,3,50,131,147,144,
+254,222,91,168,169,48,124,126,1,73,248,1,1,1,233,250,254,248,176,159,1,22,
+93,91,86,89,74,63,37,23,5,47,48,62,48,56,61,105,81,80,50,191,184,62,233,94,
+1,34,90,62,117,121,144,64,79,164,194,0,0,3,0,100,255,114,5,198,4,106,0,3,
+0,15,0,72,0,0,1,33,55,33,1,50,22,21,20,6,35,34,38,53,52,54,1,39,6,35,34,3,
+6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,
+55,51,22,22,51,50,55,3,55,19,54,53,52,38,39,54,54,51,50,22,21,20,6,7,23,4,
+124,251,242,15,3,255,254,136,54,69,68,55,55,67,68,2,115,104,66,90,236,88,
+46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,
+111,105,48,39,201,70,231,52,93,79,12,45,29,76,110,32,32,149,3,171,191,254,
+240,69,52,52,68,68,52,52,69,252,24,172,55,1,20,135,141,206,165,137,172,103,
+83,152,29,79,14,65,35,44,81,67,191,224,112,112,12,1,77,45,254,200,62,105,
+106,163,73,35,42,249,172,67,152,65,200,0,3,0,100,255,231,4,140,4,106,0,3,
+0,15,0,52,0,0,19,33,21,33,5,52,54,51,50,22,21,20,6,35,34,38,1,52,54,51,50,
+22,22,23,22,22,51,50,54,53,52,38,39,55,22,21,20,6,35,34,38,38,39,38,38,35,
+34,6,21,20,23,7,38,125,3,15,252,226,1,48,70,53,52,68,68,52,53,70,254,198,
+195,166,91,121,86,62,20,39,33,66,61,50,48,87,135,120,99,41,60,46,32,67,131,
+105,127,134,10,86,26,4,106,191,202,52,71,71,52,50,70,70,253,225,176,208,66,
+115,110,35,30,133,88,114,178,93,38,214,245,172,210,36,60,55,114,84,128,105,
+58,48,10,80,0,3,0,111,255,231,5,247,4,106,0,32,0,44,0,56,0,0,1,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,51,50,23,38,33,35,55,33,21,33,22,22,23,54,54,
+51,50,22,5,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,
+54,5,247,200,174,120,169,41,40,170,120,173,200,212,162,135,96,97,254,148,
+153,15,4,100,253,141,88,111,18,46,163,105,161,212,252,251,141,109,109,142,
+142,109,108,142,2,128,141,109,109,142,142,109,108,142,1,132,192,221,120,103,
+103,120,221,192,163,220,80,248,191,191,45,178,126,84,97,219,136,103,132,131,
+104,105,135,134,106,103,132,131,104,105,135,134,0,4,0,107,255,231,7,173,4,
+130,0,47,0,59,0,71,0,101,0,0,1,20,6,35,34,39,22,21,20,2,35,34,38,39,6,6,35,
+34,2,53,52,18,54,51,50,22,21,20,7,51,38,53,52,54,51,50,22,23,22,22,51,50,
+54,53,52,39,55,22,5,20,22,51,50,54,53,52,38,35,34,6,5,20,22,51,50,54,53,52,
+38,35,34,6,1,52,38,39,22,21,20,6,35,33,34,38,53,52,55,6,6,21,20,22,51,50,
+54,55,51,22,22,51,50,54,7,173,142,106,72,63,7,220,171,131,191,28,27,191,132,
+171,220,112,195,120,116,145,40,186,40,145,116,107,181,58,41,80,63,74,85,27,
+76,65,249,226,75,68,73,70,71,69,70,76,2,100,70,73,68,75,76,70,69,71,1,207,
+50,44,11,133,122,253,192,122,133,11,44,50,169,139,115,130,33,80,33,130,115,
+139,169,3,95,117,156,44,53,65,237,254,208,158,133,132,159,1,49,236,181,1,
+35,166,154,121,84,59,59,84,121,154,134,119,71,58,82,65,52,54,40,87,115,57,
+66,68,56,51,72,69,54,56,68,66,57,55,69,72,254,182,90,166,63,41,38,118,120,
+120,118,38,41,63,166,90,182,217,117,107,107,117,217,0,0,3,0,82,255,231,4,
+239,4,130,0,48,0,58,0,70,0,0,1,22,21,20,33,34,38,53,52,55,38,38,53,52,54,
+51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,22,23,22,22,23,36,53,52,39,
+35,55,33,21,22,22,21,20,6,1,20,51,50,54,53,52,38,35,34,1,52,38,35,34,6,21,
+20,22,51,50,54,3,134,51,254,242,126,139,68,189,215,203,164,118,120,110,104,
+103,109,15,97,51,142,134,111,136,49,1,64,215,110,15,1,26,82,87,189,253,40,
+124,61,62,63,58,126,1,242,81,72,77,77,78,74,75,80,1,120,65,95,241,123,107,
+94,53,6,208,179,181,228,139,113,118,137,125,112,58,32,80,118,73,94,59,11,
+10,28,28,29,204,165,68,191,189,41,129,75,145,148,1,238,101,55,48,43,58,253,
+18,55,57,61,53,51,60,58,0,0,3,0,107,255,231,7,173,4,130,0,77,0,89,0,101,0,
+0,1,20,6,35,34,39,22,21,20,2,35,34,38,39,6,6,35,34,2,53,52,18,54,51,50,22,
+21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,
+38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,55,
+22,5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,7,
+173,142,106,72,63,7,220,171,131,191,28,27,191,132,171,220,112,195,120,116,
+145,140,103,115,132,11,44,50,169,139,115,130,33,80,33,130,115,139,169,50,
+44,11,131,116,103,140,145,116,107,181,58,41,80,63,74,85,27,76,65,249,226,
+75,68,73,70,71,69,70,76,3,130,76,70,69,71,70,73,68,75,3,95,117,156,44,53,
+65,237,254,208,158,133,132,159,1,49,236,181,1,35,166,154,121,123,169,128,
+110,38,41,63,166,90,182,217,117,107,107,117,217,182,90,166,63,41,38,109,129,
+169,123,121,154,134,119,71,58,82,65,52,54,40,87,115,57,66,68,56,51,72,69,
+55,55,69,72,51,56,68,66,0,0,3,0,116,255,231,6,123,5,168,0,55,0,65,0,77,0,
+0,1,51,50,22,21,20,6,35,34,38,39,33,22,21,20,7,33,21,35,34,39,22,22,21,20,
+6,35,34,38,53,52,55,6,35,35,55,33,54,54,53,52,39,33,55,33,54,54,51,50,22,
+23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,1,34,6,21,20,22,51,50,54,53,
+52,38,4,173,12,181,171,119,96,123,125,4,254,94,18,20,1,130,42,143,48,80,92,
+220,195,183,218,172,53,127,56,10,1,129,23,35,28,254,84,15,3,197,11,152,126,
+114,140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,253,63,125,144,137,131,
+139,133,147,4,106,138,146,117,142,172,180,46,50,54,40,148,4,37,150,95,163,
+185,190,158,186,96,4,148,9,52,35,57,37,191,150,168,139,129,12,130,88,254,
+241,94,109,54,48,59,42,254,176,121,103,95,110,116,89,102,122,0,3,0,80,255,
+231,8,120,5,168,0,87,0,97,0,108,0,0,1,51,50,22,21,20,6,35,34,38,39,35,22,
+22,21,20,2,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,38,35,34,
+6,21,20,23,53,52,54,51,50,22,21,20,35,34,38,38,53,52,54,51,50,18,21,20,7,
+22,22,51,50,54,53,52,38,38,35,35,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,
+22,51,50,54,53,52,38,35,1,50,55,38,38,35,34,6,21,20,22,6,170,12,181,171,119,
+96,123,125,4,163,75,73,198,200,115,193,128,68,188,109,143,166,151,126,95,
+164,107,59,143,123,80,96,43,56,43,52,57,140,43,96,68,157,129,165,189,62,99,
+156,95,146,169,65,134,96,129,15,2,15,11,152,126,114,140,20,86,47,142,72,100,
+21,1,65,89,55,65,87,84,250,125,157,100,90,137,67,70,69,88,4,106,138,146,117,
+142,172,180,89,212,137,252,254,238,91,107,94,104,146,131,111,137,69,72,112,
+150,176,174,70,66,64,32,7,47,48,62,48,121,49,113,90,130,162,254,227,248,179,
+147,60,46,155,164,106,198,127,191,150,168,139,129,12,130,88,254,241,94,109,
+54,48,59,42,252,252,95,75,68,65,50,58,65,0,0,2,0,120,0,0,6,193,5,168,0,45,
+0,55,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,18,21,21,35,53,16,2,38,35,34,
+6,2,17,21,35,53,52,18,55,33,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,
+51,50,54,53,52,38,35,4,243,12,181,171,119,96,123,125,4,254,182,169,153,209,
+61,146,99,104,140,67,210,161,165,254,186,15,4,7,11,152,126,114,140,20,86,
+47,142,72,100,21,1,65,89,55,65,87,84,4,106,138,146,117,142,172,180,102,254,
+142,226,241,214,1,19,1,22,172,162,254,240,254,236,229,236,232,1,113,102,191,
+150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,0,5,0,110,254,103,9,
+52,5,168,0,24,0,34,0,46,0,107,0,119,0,0,1,51,50,22,21,20,6,35,34,38,39,33,
+55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,1,34,38,
+53,52,54,51,50,22,21,20,6,37,22,21,20,6,35,34,39,23,20,6,6,35,34,3,6,6,35,
+34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,
+22,22,51,50,54,53,52,38,39,55,22,22,51,50,54,53,52,39,1,22,22,21,20,6,35,
+34,53,52,54,55,7,102,12,181,171,119,96,123,125,4,249,121,15,6,122,11,152,
+126,114,140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,251,70,55,67,68,54,
+54,69,68,3,137,8,121,104,64,61,3,53,137,118,236,88,46,158,133,146,178,146,
+119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,58,89,86,
+96,118,66,63,71,9,252,178,31,45,53,52,108,46,31,4,106,138,146,117,142,172,
+180,191,150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,254,190,68,52,
+52,69,69,52,52,68,193,37,43,118,140,24,67,111,203,140,1,20,135,141,206,165,
+137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,82,128,
+98,75,113,72,70,59,25,27,252,195,83,171,50,46,40,86,43,174,87,0,0,3,0,100,
+255,231,9,192,5,168,0,121,0,131,0,143,0,0,1,51,50,22,21,20,6,35,34,38,39,
+35,22,21,20,6,35,34,38,38,39,46,2,35,34,6,7,1,6,6,21,20,22,51,50,55,51,22,
+22,51,50,54,53,52,38,39,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,55,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,23,55,
+54,54,51,50,22,22,23,30,2,51,50,54,53,52,39,35,53,33,54,54,51,50,22,23,7,
+38,35,34,6,3,22,22,51,50,54,53,52,38,35,5,50,22,21,20,6,35,34,38,53,52,54,
+7,242,12,181,171,119,96,123,125,4,112,36,107,101,64,87,55,37,46,83,153,119,
+63,132,51,254,126,48,37,90,78,216,75,71,41,128,113,95,113,60,56,12,45,29,
+59,74,151,156,124,167,36,50,166,124,130,167,75,82,137,35,33,18,74,75,72,81,
+34,63,87,59,124,94,124,151,11,64,82,165,102,77,107,68,43,39,60,90,62,70,49,
+24,69,1,29,11,152,126,114,140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,
+251,75,54,69,68,55,55,67,68,4,106,138,146,117,142,172,180,69,87,125,148,50,
+75,67,85,105,74,58,52,254,123,49,70,38,57,67,224,126,98,118,100,76,130,31,
+35,42,180,138,194,231,148,128,143,133,153,119,83,134,83,138,35,39,48,34,56,
+75,69,62,60,62,40,101,128,60,112,74,125,112,65,83,89,67,96,80,74,86,59,75,
+72,49,51,191,150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,168,69,
+52,52,68,68,52,52,69,0,0,2,0,100,255,231,8,38,5,168,0,97,0,107,0,0,1,51,50,
+22,21,20,6,35,34,38,39,33,22,21,20,7,51,21,35,22,22,21,20,6,35,34,3,6,6,35,
+34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,
+50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,53,52,38,35,35,55,51,54,
+53,52,39,35,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,
+35,6,88,12,181,171,119,96,123,125,4,254,208,18,26,249,202,74,76,164,133,246,
+88,50,170,134,100,127,56,93,134,83,70,74,75,72,81,34,63,87,59,124,94,129,
+147,97,122,83,65,168,216,75,71,35,113,98,196,142,120,126,10,175,58,28,218,
+15,2,129,11,152,126,114,140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,4,
+106,138,146,117,142,172,180,40,44,56,35,148,56,163,95,143,184,1,20,144,132,
+87,134,73,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,146,
+125,98,157,96,65,94,50,137,224,110,114,181,113,136,148,30,61,46,38,191,150,
+168,139,129,12,130,88,254,241,94,109,54,48,59,42,0,0,4,0,107,254,103,8,78,
+5,168,0,72,0,84,0,94,0,106,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,18,21,
+20,6,35,34,3,6,6,35,34,2,53,52,18,54,51,50,22,21,20,6,35,34,38,53,52,55,6,
+21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,2,39,35,55,33,54,54,51,50,22,
+23,7,38,35,34,6,1,20,22,51,50,54,53,52,38,35,34,6,37,22,22,51,50,54,53,52,
+38,35,1,22,22,21,20,6,35,34,53,52,54,55,6,128,12,181,171,119,96,123,125,4,
+254,186,137,170,200,180,236,88,53,161,123,181,213,108,191,119,113,131,119,
+114,113,122,8,101,159,143,121,142,35,71,35,120,105,122,143,237,189,82,15,
+2,140,11,152,126,114,140,20,86,47,142,72,100,250,245,75,68,73,70,71,69,70,
+76,4,246,1,65,89,55,65,87,84,252,132,31,45,53,52,108,46,31,4,106,138,146,
+117,142,172,180,68,254,233,151,224,242,1,20,151,125,1,25,237,192,1,45,168,
+154,137,133,155,145,127,42,34,131,251,176,179,106,118,110,114,142,134,195,
+1,9,17,191,150,168,139,129,12,130,88,254,165,57,66,68,56,51,72,69,21,94,109,
+54,48,59,42,252,66,83,171,50,46,40,86,43,174,87,0,0,2,0,100,255,231,7,197,
+5,168,0,105,0,115,0,0,1,51,50,22,21,20,6,35,34,38,39,35,22,21,20,6,35,34,
+38,39,20,6,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,39,54,54,51,50,
+22,21,20,6,6,35,34,3,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,
+20,23,7,38,53,52,54,54,51,50,22,22,23,30,2,51,50,54,53,39,35,55,33,54,54,
+51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,5,247,12,181,171,119,
+96,123,125,4,240,4,126,92,98,163,82,43,77,73,83,65,168,216,75,71,41,123,98,
+117,111,112,12,45,29,61,65,51,132,114,246,88,50,170,134,100,127,56,93,134,
+83,70,74,75,72,81,34,63,87,59,124,94,75,111,74,48,45,64,92,61,64,80,3,157,
+15,1,224,11,152,126,114,140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,4,
+106,138,146,117,142,172,180,27,36,119,159,137,151,93,120,83,58,66,93,50,137,
+224,127,97,113,85,119,88,35,42,179,125,92,175,122,1,20,144,132,87,134,73,
+92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,55,79,66,61,70,
+48,71,58,35,191,150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,0,0,
+4,0,111,254,103,11,241,6,52,0,99,0,111,0,121,0,133,0,0,1,51,50,22,21,20,6,
+35,34,38,39,35,22,22,21,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,0,53,52,
+54,55,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,7,22,22,21,20,7,22,22,51,
+50,54,53,52,38,39,38,53,52,54,51,50,22,18,21,20,7,22,22,51,50,54,53,52,38,
+39,55,55,33,54,54,51,50,22,23,7,38,35,34,6,1,52,38,35,34,6,21,20,22,51,50,
+54,1,22,22,51,50,54,53,52,38,35,1,22,22,21,20,6,35,34,53,52,54,55,10,35,12,
+181,171,119,96,123,125,4,208,87,106,192,167,110,162,76,41,161,117,109,162,
+76,65,232,161,243,254,220,140,122,255,0,15,2,148,125,101,47,113,77,150,53,
+115,101,128,141,25,58,138,95,123,142,166,204,12,37,37,69,196,143,8,61,145,
+104,123,142,205,178,1,15,1,228,11,152,126,114,140,20,86,47,142,72,100,249,
+210,214,167,171,214,204,178,179,205,6,25,1,65,89,55,65,87,84,252,143,31,45,
+53,52,108,46,31,4,106,138,146,117,142,172,180,97,249,141,222,255,118,114,
+109,123,117,113,108,122,1,27,234,155,225,67,191,34,73,55,112,125,59,158,192,
+87,115,79,12,67,230,156,94,81,62,69,144,130,150,198,71,36,47,48,64,173,254,
+226,163,65,48,72,81,144,130,170,246,63,4,187,150,168,139,129,12,130,88,253,
+121,169,209,209,169,175,202,202,2,39,94,109,54,48,59,42,252,66,83,171,50,
+46,40,86,43,174,87,0,0,3,0,90,254,211,10,153,5,168,0,118,0,128,0,138,0,0,
+1,51,50,22,21,20,6,35,34,38,39,35,22,21,20,6,35,34,38,38,39,46,2,35,34,7,
+22,21,20,7,22,22,21,20,6,35,34,38,53,54,54,53,52,39,6,6,35,34,38,53,52,54,
+51,50,22,23,54,53,52,38,35,34,6,21,35,52,38,35,34,6,21,20,23,7,38,53,52,54,
+51,50,22,23,54,54,51,50,22,23,54,54,51,50,22,22,23,30,2,51,50,54,53,52,39,
+35,53,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,1,38,
+38,35,34,6,21,20,51,50,8,203,12,181,171,119,96,123,125,4,143,39,142,106,94,
+106,48,22,18,33,67,57,154,6,7,109,61,68,79,63,67,73,72,56,39,76,189,92,151,
+181,166,140,103,189,78,84,112,91,80,90,109,110,101,101,102,33,64,79,175,125,
+105,141,32,23,120,74,87,135,40,28,116,85,78,90,41,20,17,31,64,54,74,85,27,
+65,1,56,11,152,126,114,140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,250,
+137,61,160,87,76,101,203,168,4,106,138,146,117,142,172,180,70,92,117,156,
+73,105,85,69,82,54,165,49,65,243,189,92,205,88,82,95,87,69,4,66,64,90,89,
+92,101,160,132,126,151,98,85,121,169,136,168,108,98,96,110,83,67,53,53,40,
+87,115,120,173,99,86,88,97,92,90,85,97,71,101,84,72,84,56,82,65,52,54,191,
+150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,253,119,73,86,75,57,
+131,0,3,0,112,255,231,8,4,6,93,0,99,0,109,0,121,0,0,1,51,50,22,21,20,6,35,
+34,38,39,35,22,22,21,20,6,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,38,53,
+52,18,55,38,38,53,52,54,51,23,6,6,21,20,22,23,22,22,21,20,6,35,34,38,53,55,
+6,6,21,20,22,51,50,54,55,51,22,51,50,54,53,52,38,38,35,55,50,54,53,52,38,
+35,35,55,33,54,54,51,50,22,23,7,38,35,34,6,3,21,20,22,51,50,54,53,52,35,5,
+34,6,21,20,22,51,50,54,53,52,38,6,54,12,181,171,119,96,124,125,3,183,46,52,
+114,94,135,181,170,140,129,174,41,53,161,123,110,187,110,159,128,68,85,188,
+157,18,84,96,49,44,106,134,113,108,108,116,3,43,53,161,143,121,142,35,71,
+72,200,84,98,72,153,115,16,97,116,99,78,5,23,1,152,11,152,126,114,140,20,
+86,47,142,72,100,21,63,92,55,65,171,251,131,63,70,68,62,66,63,64,5,31,138,
+146,117,142,177,185,32,94,54,83,121,28,25,220,142,161,195,146,130,151,125,
+135,232,140,195,1,52,56,45,137,79,125,151,85,18,126,87,57,105,35,4,155,118,
+127,148,138,121,45,52,161,79,160,179,106,118,225,106,87,68,119,74,130,98,
+88,77,98,181,150,168,139,129,12,130,88,254,251,1,99,113,54,48,111,224,66,
+52,54,63,65,53,48,69,0,0,4,0,111,255,231,6,227,5,168,0,39,0,51,0,61,0,73,
+0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,22,21,20,6,6,35,34,38,38,53,52,54,
+55,33,55,33,54,54,51,50,22,23,7,38,35,34,6,1,34,6,21,20,22,51,50,54,53,52,
+38,5,22,22,51,50,54,53,52,38,35,5,50,22,21,20,6,35,34,38,53,52,54,5,21,12,
+181,171,119,96,123,125,4,254,235,123,135,122,241,170,163,242,130,140,122,
+255,0,15,4,44,11,152,126,114,140,20,86,47,142,72,100,253,99,171,214,204,178,
+179,205,214,1,225,1,65,89,55,65,87,84,253,14,54,69,68,55,55,67,68,4,106,138,
+146,117,142,172,180,68,226,153,142,235,140,133,235,149,155,225,67,191,150,
+168,139,129,12,130,88,254,243,209,169,175,202,202,175,169,209,2,94,109,54,
+48,59,42,245,69,52,52,68,68,52,52,69,0,0,4,0,111,255,231,7,246,5,168,0,46,
+0,79,0,89,0,98,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,23,22,22,21,20,6,
+35,34,38,39,6,6,35,34,38,38,53,52,18,55,33,55,33,54,54,51,50,22,23,7,38,35,
+34,6,1,52,39,6,6,35,34,38,53,52,54,51,50,23,38,38,35,35,34,6,6,21,20,22,51,
+50,54,55,51,22,22,51,50,19,22,22,51,50,54,53,52,38,35,5,34,21,20,22,51,50,
+55,38,6,40,12,181,171,119,96,123,125,4,254,218,140,9,60,66,190,169,121,156,
+52,30,162,117,117,156,73,177,154,254,190,14,5,61,11,152,126,114,140,20,86,
+47,142,72,100,254,245,30,31,123,93,98,121,121,103,92,68,21,172,140,116,152,
+227,120,114,104,93,114,41,71,36,121,114,252,246,1,65,89,55,65,87,84,253,162,
+127,57,54,141,22,61,4,106,138,146,117,142,172,180,73,164,58,171,88,192,218,
+123,151,127,147,118,190,109,180,1,36,75,191,150,168,139,129,12,130,88,252,
+239,77,66,70,88,108,87,87,105,31,87,88,136,225,131,128,135,94,130,113,111,
+2,241,94,109,54,48,59,42,230,83,34,41,115,43,0,255,255,0,111,254,103,7,246,
+5,168,2,38,0,196,0,0,0,6,1,181,0,0,0,3,0,110,255,231,7,234,5,229,0,24,0,35,
+0,114,0,0,1,51,50,22,21,20,6,35,34,38,39,33,55,33,54,54,51,50,22,23,7,38,
+35,34,6,3,21,20,22,51,50,54,53,52,38,35,3,20,6,35,34,38,53,52,54,51,50,22,
+21,20,6,7,39,54,54,53,52,35,34,6,21,20,51,50,54,53,52,38,35,34,6,7,35,38,
+38,35,34,6,21,20,22,51,51,23,39,34,6,21,20,51,50,55,23,6,35,34,38,53,52,55,
+38,38,53,52,54,51,50,22,23,54,54,51,50,22,22,6,28,12,181,171,119,96,125,125,
+2,251,6,15,4,237,10,154,125,114,140,20,86,47,142,72,99,22,63,92,55,65,84,
+87,206,183,194,168,173,148,117,95,108,100,88,15,28,40,94,66,76,244,122,140,
+158,131,95,135,21,71,32,108,93,67,93,80,76,51,15,45,127,119,212,92,82,45,
+109,122,161,197,186,72,89,174,145,119,160,37,32,167,110,124,170,83,4,169,
+139,147,117,142,178,186,181,149,167,139,129,12,130,87,254,252,3,99,113,54,
+48,61,52,253,214,230,253,178,153,111,148,88,68,72,75,4,69,2,28,22,56,71,55,
+133,125,133,137,164,89,72,80,81,64,62,51,59,87,1,60,73,104,24,190,35,126,
+135,166,57,25,100,72,113,135,100,84,88,96,125,204,0,0,3,0,110,255,231,6,206,
+5,168,0,63,0,73,0,83,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,22,23,22,22,
+21,20,6,6,35,34,38,38,53,52,55,51,22,22,51,32,17,52,39,6,6,35,34,38,53,52,
+54,51,50,23,38,38,39,33,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,
+54,53,52,38,35,5,38,35,34,6,21,20,51,50,54,5,0,12,181,171,119,96,123,125,
+4,254,167,52,67,10,104,93,117,232,165,182,240,112,6,85,4,210,207,1,141,60,
+20,159,125,123,138,152,132,94,68,21,86,55,253,203,15,4,27,11,152,126,114,
+140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,253,247,68,97,87,79,128,84,
+116,4,106,138,146,117,142,172,180,30,101,58,55,177,94,127,203,119,137,216,
+120,50,47,191,169,1,21,104,67,112,131,118,98,97,114,21,51,74,18,191,150,168,
+139,129,12,130,88,254,241,94,109,54,48,59,42,240,28,55,43,93,86,255,255,0,
+111,254,103,7,212,5,168,2,38,0,201,0,0,0,38,1,181,3,0,0,6,1,182,21,0,0,3,
+0,111,255,231,7,212,5,168,0,45,0,66,0,76,0,0,1,51,50,22,21,20,6,35,34,38,
+39,33,22,18,21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,33,55,33,54,
+54,51,50,22,23,7,38,35,34,6,1,34,6,6,21,20,22,51,50,54,55,51,22,22,51,50,
+54,53,52,38,38,5,22,22,51,50,54,53,52,38,35,6,6,12,181,171,119,96,123,125,
+4,254,153,159,181,67,155,124,122,146,40,30,162,117,117,156,73,177,154,254,
+183,15,5,33,11,152,126,114,140,20,86,47,142,72,100,252,230,152,227,120,114,
+104,93,114,41,71,40,112,91,115,108,121,229,2,107,1,65,89,55,65,87,84,4,106,
+138,146,117,142,172,180,74,254,221,182,99,190,128,140,134,127,147,118,190,
+109,180,1,36,75,191,150,168,139,129,12,130,88,254,243,136,225,131,128,135,
+94,130,126,98,137,122,133,227,136,2,94,109,54,48,59,42,0,255,255,0,111,254,
+103,7,212,5,168,2,38,0,201,0,0,0,6,1,181,255,0,0,2,0,111,255,150,7,79,5,168,
+0,67,0,77,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,18,21,20,6,6,35,34,38,
+38,39,38,38,35,34,6,21,20,22,23,20,35,34,38,38,53,52,54,51,50,22,22,23,22,
+22,51,50,54,53,52,2,39,33,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,
+50,54,53,52,38,35,5,129,12,181,171,119,96,123,125,4,254,153,157,183,53,140,
+120,83,120,85,66,66,115,72,73,84,98,100,89,46,98,64,133,109,61,92,89,85,76,
+103,69,106,100,252,208,253,209,15,4,154,11,152,126,114,140,20,86,47,142,72,
+100,21,1,65,89,55,65,87,84,4,106,138,146,117,142,172,180,72,254,210,186,95,
+182,127,68,102,99,98,96,82,77,84,139,26,136,102,189,122,150,184,55,106,118,
+107,69,131,110,215,1,25,16,191,150,168,139,129,12,130,88,254,241,94,109,54,
+48,59,42,0,0,4,0,110,255,231,7,195,5,168,0,24,0,34,0,46,0,95,0,0,1,51,50,
+22,21,20,6,35,34,38,39,33,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,
+50,54,53,52,38,35,1,34,38,53,52,54,51,50,22,21,20,6,5,20,6,6,35,34,3,6,6,
+35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,
+51,22,22,51,50,54,53,52,38,39,54,54,51,50,22,5,245,12,181,171,119,96,123,
+125,4,250,234,15,5,9,11,152,126,114,140,20,86,47,142,72,100,21,1,65,89,55,
+65,87,84,252,183,55,67,68,54,54,69,68,2,54,53,137,118,236,88,46,158,133,146,
+178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,
+93,79,12,45,29,76,110,4,106,138,146,117,142,172,180,191,150,168,139,129,12,
+130,88,254,241,94,109,54,48,59,42,254,190,68,52,52,69,69,52,52,68,188,111,
+203,140,1,20,135,141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,
+224,112,112,132,113,106,163,73,35,42,249,0,255,255,0,110,254,103,7,195,5,
+168,2,38,0,204,0,0,0,6,1,181,6,0,0,2,0,100,255,231,8,23,5,168,0,84,0,94,0,
+0,1,51,50,22,21,20,6,35,34,38,39,35,22,17,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,20,
+6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,38,39,35,55,33,54,54,51,
+50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,6,73,12,181,171,119,96,
+123,125,4,242,227,198,180,117,184,37,49,164,125,135,164,93,134,83,70,74,75,
+72,81,34,63,87,59,124,94,129,147,97,122,83,65,168,216,75,71,37,126,118,132,
+156,93,174,116,186,15,2,165,11,152,126,114,140,20,86,47,142,72,100,21,1,65,
+89,55,65,87,84,4,106,138,146,117,142,172,180,166,254,192,225,252,150,125,
+141,135,163,131,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,
+74,146,125,98,157,96,65,94,50,137,224,116,110,169,161,101,189,125,10,191,
+150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,0,0,3,0,100,254,103,
+8,23,5,168,0,85,0,95,0,107,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,18,21,
+20,6,35,34,3,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,
+7,38,53,52,54,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,
+53,52,38,38,35,35,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,
+52,38,35,1,22,22,21,20,6,35,34,53,52,54,55,6,73,12,181,171,119,96,123,125,
+4,254,138,142,165,179,151,246,88,50,170,134,100,127,56,93,134,83,70,74,75,
+72,81,34,63,87,59,124,94,129,147,97,122,83,65,168,216,75,71,41,123,98,107,
+116,130,221,131,3,15,2,165,11,152,126,114,140,20,86,47,142,72,100,21,1,65,
+89,55,65,87,84,252,120,31,45,53,52,108,46,31,4,106,138,146,117,142,172,180,
+70,254,220,179,192,231,1,20,144,132,87,134,73,92,146,104,64,100,66,56,75,
+69,62,60,62,40,101,128,60,112,74,146,125,98,157,96,65,94,50,137,224,127,97,
+141,135,141,217,119,191,150,168,139,129,12,130,88,254,241,94,109,54,48,59,
+42,252,66,83,171,50,46,40,86,43,174,87,0,0,2,0,100,255,231,10,109,6,52,0,
+103,0,113,0,0,1,51,50,22,21,20,6,35,34,38,39,35,22,22,21,20,6,35,34,38,39,
+6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,
+34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,2,39,33,55,33,50,54,53,52,39,
+55,22,21,20,6,7,22,18,21,7,22,22,51,50,54,53,52,38,39,55,33,54,54,51,50,22,
+23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,8,159,12,181,171,119,96,123,
+125,4,202,84,103,192,167,108,160,74,37,154,122,123,152,39,46,158,133,146,
+178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,40,111,90,116,109,
+253,205,253,68,15,3,141,158,115,113,77,150,163,179,159,183,3,60,144,102,123,
+142,196,174,15,1,216,11,152,126,114,140,20,86,47,142,72,100,21,1,65,89,55,
+65,87,84,4,106,138,146,117,142,172,180,103,252,132,222,255,114,109,100,123,
+141,135,135,141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,
+127,97,137,122,205,1,17,16,191,70,92,112,125,59,158,192,152,138,8,71,254,
+216,181,58,70,78,144,130,162,255,62,191,150,168,139,129,12,130,88,254,241,
+94,109,54,48,59,42,0,3,0,107,255,231,11,221,6,52,0,92,0,104,0,114,0,0,1,51,
+50,22,21,20,6,35,34,38,39,35,22,22,21,20,6,35,34,38,39,6,35,34,38,39,6,6,
+35,34,38,2,53,16,0,51,50,18,17,20,7,22,22,51,50,54,53,52,2,39,35,55,51,50,
+54,54,53,52,39,55,22,21,20,6,6,7,22,18,21,20,7,22,22,51,50,54,53,52,38,39,
+55,33,54,54,51,50,22,23,7,38,35,34,6,1,52,38,35,34,6,21,20,22,51,50,54,1,
+22,22,51,50,54,53,52,38,35,10,15,12,181,171,119,96,123,125,4,202,84,103,192,
+167,110,161,76,88,254,130,190,86,61,225,132,162,215,101,1,1,219,222,255,17,
+75,155,113,122,143,237,189,82,15,244,125,101,47,113,77,150,64,127,121,138,
+174,6,60,146,103,123,142,196,174,15,1,216,11,152,126,114,140,20,86,47,142,
+72,100,249,162,199,176,175,203,209,171,170,203,6,73,1,65,89,55,65,87,84,4,
+106,138,146,117,142,172,180,103,252,132,222,255,117,114,231,140,132,140,132,
+164,1,11,158,1,15,1,63,254,196,254,238,100,83,97,98,142,134,195,1,9,17,191,
+34,73,55,112,125,59,158,192,96,119,74,8,65,254,231,154,52,51,71,81,144,130,
+162,255,62,191,150,168,139,129,12,130,88,253,118,180,203,199,173,174,211,
+203,2,38,94,109,54,48,59,42,0,0,3,0,111,255,231,6,227,5,168,0,39,0,51,0,61,
+0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,22,21,20,6,6,35,34,38,38,53,52,54,
+55,33,55,33,54,54,51,50,22,23,7,38,35,34,6,1,34,6,21,20,22,51,50,54,53,52,
+38,5,22,22,51,50,54,53,52,38,35,5,21,12,181,171,119,96,123,125,4,254,235,
+123,135,122,241,170,163,242,130,140,122,255,0,15,4,44,11,152,126,114,140,
+20,86,47,142,72,100,253,99,171,214,204,178,179,205,214,1,225,1,65,89,55,65,
+87,84,4,106,138,146,117,142,172,180,68,226,153,142,235,140,133,235,149,155,
+225,67,191,150,168,139,129,12,130,88,254,243,209,169,175,202,202,175,169,
+209,2,94,109,54,48,59,42,0,0,3,0,107,255,231,7,241,5,168,0,58,0,70,0,80,0,
+0,1,51,50,22,21,20,6,35,34,38,39,35,22,21,16,0,33,32,0,17,52,54,54,51,50,
+22,21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,16,37,55,33,54,54,51,
+50,22,23,7,38,35,34,6,1,20,22,51,50,54,53,52,38,35,34,6,37,22,22,51,50,54,
+53,52,38,35,6,35,12,181,171,119,96,123,125,4,164,89,254,190,254,194,254,200,
+254,178,109,192,119,117,133,119,114,113,122,13,60,56,1,26,1,0,1,5,1,32,254,
+243,15,1,175,11,152,126,114,140,20,86,47,142,72,100,251,90,75,68,73,70,71,
+69,70,76,4,145,1,65,89,55,65,87,84,4,106,138,146,117,142,172,180,138,200,
+254,211,254,187,1,71,1,50,164,247,135,155,136,133,155,145,127,57,37,64,149,
+103,209,225,206,187,1,36,63,191,150,168,139,129,12,130,88,254,165,57,66,68,
+56,51,72,69,21,94,109,54,48,59,42,0,0,2,0,110,255,231,7,223,5,168,0,72,0,
+82,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,18,21,20,6,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,
+51,22,22,51,50,54,53,52,2,39,33,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,
+22,51,50,54,53,52,38,35,6,17,12,181,171,119,96,123,125,4,254,154,158,181,
+67,155,124,123,152,39,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,
+77,251,215,68,71,40,111,90,116,109,253,205,253,68,15,5,37,11,152,126,114,
+140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,4,106,138,146,117,142,172,
+180,72,254,218,181,99,190,128,141,135,135,141,206,165,137,172,103,83,152,
+29,79,14,65,35,44,81,67,191,224,127,97,137,122,205,1,17,16,191,150,168,139,
+129,12,130,88,254,241,94,109,54,48,59,42,0,3,0,105,255,231,7,18,5,168,0,63,
+0,73,0,89,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,22,21,20,0,33,34,38,53,
+16,33,51,50,54,53,52,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,
+38,53,52,55,35,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,
+38,35,5,22,21,20,6,35,35,34,6,21,20,33,50,36,53,16,5,68,12,181,171,119,96,
+123,125,4,254,230,124,139,254,182,254,205,230,254,1,128,34,126,113,105,94,
+80,93,23,57,45,50,56,74,69,79,104,48,228,15,4,93,11,152,126,114,140,20,86,
+47,142,72,100,21,1,65,89,55,65,87,84,253,114,91,168,169,48,124,126,1,73,248,
+1,1,4,106,138,146,117,142,172,180,63,230,157,250,254,248,176,159,1,22,93,
+91,86,89,74,63,37,23,5,47,48,62,48,56,61,105,81,80,50,191,150,168,139,129,
+12,130,88,254,241,94,109,54,48,59,42,2,62,117,121,144,64,79,164,194,177,1,
+34,0,4,0,100,255,114,7,194,5,168,0,24,0,34,0,46,0,103,0,0,1,51,50,22,21,20,
+6,35,34,38,39,33,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,
+52,38,35,1,34,38,53,52,54,51,50,22,21,20,6,1,23,7,39,6,35,34,3,6,6,35,34,
+38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,
+22,51,50,55,3,55,19,54,53,52,38,39,54,54,51,50,22,21,20,6,5,244,12,181,171,
+119,96,123,125,4,250,225,15,5,18,11,152,126,114,140,20,86,47,142,72,100,21,
+1,65,89,55,65,87,84,252,174,55,67,68,54,54,69,68,1,246,149,133,104,66,90,
+236,88,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,
+71,36,111,105,48,39,201,70,231,52,93,79,12,45,29,76,110,32,4,106,138,146,
+117,142,172,180,191,150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,
+254,190,68,52,52,69,69,52,52,68,254,40,200,87,172,55,1,20,135,141,206,165,
+137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,12,1,77,45,254,
+200,62,105,106,163,73,35,42,249,172,67,152,0,0,4,0,100,255,231,6,210,5,168,
+0,24,0,34,0,46,0,83,0,0,1,51,50,22,21,20,6,35,34,38,39,33,55,33,54,54,51,
+50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,1,34,38,53,52,54,51,50,
+22,21,20,6,37,22,21,20,6,35,34,38,38,39,38,38,35,34,6,21,20,23,7,38,53,52,
+54,51,50,22,22,23,22,22,51,50,54,53,52,38,39,5,4,12,181,171,119,96,123,125,
+4,251,209,15,4,34,11,152,126,114,140,20,86,47,142,72,100,21,1,65,89,55,65,
+87,84,252,179,53,70,70,53,52,68,68,1,184,135,120,99,41,60,46,32,67,131,105,
+127,134,10,86,26,195,166,91,121,86,62,20,39,33,66,61,50,48,4,106,138,146,
+117,142,172,180,191,150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,
+254,190,70,50,52,71,71,52,50,70,199,214,245,172,210,36,60,55,114,84,128,105,
+58,48,10,80,89,176,208,66,115,110,35,30,133,88,114,178,93,0,4,0,111,255,231,
+8,11,5,168,0,53,0,63,0,75,0,87,0,0,1,51,50,22,21,20,6,35,34,38,39,33,22,22,
+23,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,23,38,33,
+35,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,22,51,50,54,53,52,38,35,1,52,
+38,35,34,6,21,20,22,51,50,54,55,20,22,51,50,54,53,52,38,35,34,6,6,61,12,181,
+171,119,96,123,125,4,252,153,88,111,18,46,163,105,161,212,200,174,120,169,
+41,40,170,120,173,200,212,162,135,96,97,254,148,153,15,5,90,11,152,126,114,
+140,20,86,47,142,72,100,21,1,65,89,55,65,87,84,252,83,141,109,109,142,142,
+109,108,142,139,142,109,108,142,141,109,109,142,4,106,138,146,117,142,172,
+180,45,178,126,84,97,219,164,192,221,120,103,103,120,221,192,163,220,80,248,
+191,150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,253,245,103,132,
+131,104,105,135,134,106,105,135,134,106,103,132,131,0,0,5,0,107,255,231,10,
+86,5,168,0,71,0,83,0,95,0,105,0,135,0,0,1,51,50,22,21,20,6,35,34,38,39,35,
+22,21,20,6,35,34,39,22,21,20,2,35,34,38,39,6,6,35,34,2,53,52,18,54,51,50,
+22,21,20,7,51,38,53,52,54,51,50,22,23,22,22,51,50,54,53,39,35,39,33,54,54,
+51,50,22,23,7,38,35,34,6,1,20,22,51,50,54,53,52,38,35,34,6,5,20,22,51,50,
+54,53,52,38,35,34,6,37,22,22,51,50,54,53,52,38,35,1,52,38,39,22,21,20,6,35,
+33,34,38,53,52,55,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,8,136,12,181,
+171,119,96,123,125,4,123,7,142,106,72,63,7,220,171,131,191,28,27,191,132,
+171,220,112,195,120,116,145,40,186,40,145,116,107,181,58,41,80,63,74,85,1,
+147,25,1,149,11,152,126,114,140,20,86,47,142,72,100,248,248,75,68,73,70,71,
+69,70,76,2,100,70,73,68,75,76,70,69,71,4,143,1,65,89,55,65,87,84,252,216,
+50,44,11,133,122,253,192,122,133,11,44,50,169,139,115,130,33,80,33,130,115,
+139,169,4,106,138,146,117,142,172,180,40,36,117,156,44,53,65,237,254,208,
+158,133,132,159,1,49,236,181,1,35,166,154,121,84,59,59,84,121,154,134,119,
+71,58,82,65,20,191,150,168,139,129,12,130,88,254,165,57,66,68,56,51,72,69,
+54,56,68,66,57,55,69,72,24,94,109,54,48,59,42,254,158,90,166,63,41,38,118,
+120,120,118,38,41,63,166,90,182,217,117,107,107,117,217,0,4,0,82,255,231,
+7,104,5,168,0,70,0,80,0,90,0,102,0,0,1,51,50,22,21,20,6,35,34,38,39,35,22,
+22,21,20,6,7,22,21,20,33,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,
+34,38,53,52,55,6,21,20,22,22,23,22,22,23,36,53,52,39,35,55,33,54,54,51,50,
+22,23,7,38,35,34,6,1,20,51,50,54,53,52,38,35,34,5,22,22,51,50,54,53,52,38,
+35,1,52,38,35,34,6,21,20,22,51,50,54,5,154,12,181,171,119,96,123,125,4,233,
+81,84,189,172,51,254,242,126,139,68,189,215,203,164,118,120,110,104,103,109,
+15,97,51,142,134,111,136,49,1,64,215,110,15,2,9,11,152,126,114,140,20,86,
+47,142,72,100,251,177,124,61,62,63,58,126,4,58,1,65,89,55,65,87,84,253,80,
+81,72,77,77,78,74,75,80,4,106,138,146,117,142,172,180,41,128,74,145,148,27,
+65,95,241,123,107,94,53,6,208,179,181,228,139,113,118,137,125,112,58,32,80,
+118,73,94,59,11,10,28,28,29,204,165,68,191,150,168,139,129,12,130,88,254,
+199,101,55,48,43,58,61,94,109,54,48,59,42,253,79,55,57,61,53,51,60,58,0,0,
+4,0,107,255,231,10,80,5,168,0,101,0,113,0,125,0,135,0,0,1,51,50,22,21,20,
+6,35,34,38,39,35,22,21,20,6,35,34,39,22,21,20,2,35,34,38,39,6,6,35,34,2,53,
+52,18,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,54,55,51,22,
+22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,22,22,51,
+50,54,53,39,35,39,33,54,54,51,50,22,23,7,38,35,34,6,1,20,22,51,50,54,53,52,
+38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,37,22,22,51,50,54,53,52,38,35,
+8,130,12,181,171,119,96,123,125,4,117,7,142,106,72,63,7,220,171,131,191,28,
+27,191,132,171,220,112,195,120,116,145,140,103,115,132,11,44,50,169,139,115,
+130,33,80,33,130,115,139,169,50,44,11,131,116,103,140,145,116,107,181,58,
+41,80,63,74,85,1,133,20,1,124,11,152,126,114,140,20,86,47,142,72,100,248,
+254,75,68,73,70,71,69,70,76,3,130,76,70,69,71,70,73,68,75,3,107,1,65,89,55,
+65,87,84,4,106,138,146,117,142,172,180,40,36,117,156,44,53,65,237,254,208,
+158,133,132,159,1,49,236,181,1,35,166,154,121,123,169,128,110,38,41,63,166,
+90,182,217,117,107,107,117,217,182,90,166,63,41,38,109,129,169,123,121,154,
+134,119,71,58,82,65,20,191,150,168,139,129,12,130,88,254,165,57,66,68,56,
+51,72,69,55,55,69,72,51,56,68,66,133,94,109,54,48,59,42,0,1,0,100,255,231,
+8,241,4,130,0,107,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,
+53,53,6,21,20,22,51,50,54,53,16,33,33,22,21,20,7,51,21,35,22,22,21,20,6,35,
+34,3,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,
+52,54,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,53,52,38,35,
+35,55,51,54,53,52,39,35,55,33,32,0,8,241,208,183,140,169,132,98,74,80,62,
+59,52,61,55,108,106,135,156,254,14,254,38,18,26,249,202,74,76,164,133,246,
+88,50,170,134,100,127,56,93,134,83,70,74,75,72,81,34,63,87,59,124,94,129,
+147,97,122,83,65,168,216,75,71,35,113,98,196,142,120,126,10,175,58,28,218,
+15,3,52,1,27,1,48,1,249,248,254,230,184,152,118,151,78,64,52,68,55,57,11,
+43,65,78,86,174,149,1,191,40,44,56,35,148,56,163,95,143,184,1,20,144,132,
+87,134,73,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,146,
+125,98,157,96,65,94,50,137,224,110,114,181,113,136,148,30,61,46,38,191,254,
+194,0,2,0,112,255,231,8,231,6,42,0,110,0,122,0,0,1,20,2,6,35,34,38,53,52,
+54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,16,0,33,35,22,22,
+21,20,6,7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,38,38,53,
+52,54,51,23,6,6,21,20,22,23,22,22,21,20,6,35,34,38,53,55,6,6,21,20,22,51,
+50,54,55,51,22,51,50,54,53,52,38,38,35,55,50,54,53,52,38,35,35,55,33,32,1,
+34,6,21,20,22,51,50,54,53,52,38,8,231,85,165,114,140,169,132,98,74,80,62,
+59,52,61,55,108,106,116,148,254,218,254,184,253,46,52,114,94,135,181,170,
+140,129,174,41,53,161,123,110,187,110,159,128,68,85,188,157,18,84,96,49,44,
+106,134,113,108,108,116,3,43,53,161,143,121,142,35,71,72,200,84,98,72,153,
+115,16,97,116,99,78,20,24,1,253,2,191,249,52,63,70,68,62,66,63,64,2,47,158,
+254,250,155,184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,225,170,1,31,
+1,14,32,94,54,83,121,28,25,220,142,161,195,146,130,151,125,135,232,140,195,
+1,52,56,45,137,79,125,151,85,18,126,87,57,105,35,4,155,118,127,148,138,121,
+45,52,161,79,160,179,106,118,225,106,87,68,119,74,130,98,88,77,98,181,254,
+107,66,52,54,63,65,53,48,69,0,2,0,110,255,231,9,16,4,169,0,35,0,114,0,0,1,
+20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,
+53,16,36,33,33,55,33,32,0,1,20,6,35,34,38,53,52,54,51,50,22,21,20,6,7,39,
+54,54,53,52,35,34,6,21,20,51,50,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,
+20,22,51,51,23,39,34,6,21,20,51,50,55,23,6,35,34,38,53,52,55,38,38,53,52,
+54,51,50,22,23,54,54,51,50,22,22,9,16,208,183,140,169,132,98,74,80,62,59,
+52,61,55,108,106,136,155,254,180,254,205,250,142,15,5,118,1,102,1,106,252,
+160,183,194,168,173,148,117,95,108,100,88,15,28,40,94,66,76,244,122,140,158,
+131,95,135,21,71,32,108,93,67,93,80,76,51,15,45,127,119,212,92,82,45,109,
+122,161,197,186,72,89,174,145,119,160,37,32,167,110,124,170,83,1,249,248,
+254,230,184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,176,157,1,16,238,
+181,254,157,254,132,230,253,178,153,111,148,88,68,72,75,4,69,2,28,22,56,71,
+55,133,125,133,137,164,89,72,80,81,64,62,51,59,87,1,60,73,104,24,190,35,126,
+135,166,57,25,100,72,113,135,100,84,88,96,125,204,0,3,0,119,255,231,4,36,
+5,143,0,42,0,53,0,65,0,0,1,21,35,34,39,22,22,21,20,6,35,34,38,53,52,55,6,
+35,35,55,33,54,54,53,52,39,22,21,20,35,34,38,53,52,54,51,50,22,22,21,20,7,
+55,1,52,38,35,34,6,21,20,51,50,54,19,52,38,35,34,6,21,20,22,51,50,54,4,36,
+42,143,48,80,92,220,195,183,218,172,53,127,56,10,1,197,100,124,103,15,214,
+102,125,151,124,111,160,83,101,114,254,219,67,62,65,60,126,61,67,235,147,
+124,125,144,137,131,139,133,2,237,148,4,37,150,95,163,185,190,158,186,96,
+4,148,34,149,93,144,75,42,46,227,133,107,112,142,110,182,104,172,109,3,1,
+171,43,56,56,39,100,52,253,15,102,122,121,103,95,110,116,0,3,0,80,255,231,
+6,103,5,154,0,71,0,82,0,93,0,0,1,16,2,35,34,38,39,6,35,34,38,53,52,54,51,
+50,22,23,54,53,52,38,35,34,6,21,20,23,53,52,54,51,50,22,21,20,35,34,38,38,
+53,52,54,51,50,18,21,20,7,22,22,51,50,18,53,52,2,39,22,21,20,6,35,34,38,53,
+52,54,51,50,22,18,1,52,38,35,34,6,21,20,51,50,54,1,50,55,38,38,35,34,6,21,
+20,22,6,103,204,245,115,192,129,137,228,143,166,151,126,95,164,107,59,143,
+123,80,96,43,56,43,52,57,140,43,96,68,157,129,165,189,63,99,156,96,188,177,
+146,126,16,106,106,102,125,154,121,172,236,114,254,64,67,62,65,60,126,61,
+67,252,226,157,100,90,137,67,70,69,88,2,149,254,215,254,123,91,108,199,146,
+131,111,137,69,72,112,150,176,174,70,66,64,32,7,47,48,62,48,121,49,113,90,
+130,162,254,227,248,176,149,60,47,1,2,221,202,1,64,72,40,55,108,119,133,107,
+111,143,245,254,153,1,101,43,56,56,39,100,52,252,48,95,75,68,65,50,58,65,
+0,0,2,0,115,0,0,4,127,5,155,0,25,0,40,0,0,33,35,53,16,2,38,35,34,6,2,17,21,
+35,53,52,18,55,38,38,53,52,54,51,32,0,19,3,2,0,35,34,6,21,20,22,51,55,54,
+51,50,22,4,127,209,61,146,99,104,140,67,210,141,138,106,136,184,151,1,58,
+1,92,2,121,54,254,237,191,87,112,111,83,29,50,52,137,191,214,1,19,1,22,172,
+162,254,240,254,236,229,236,231,1,109,112,2,112,110,122,145,253,175,253,146,
+1,227,1,14,1,50,66,65,77,55,1,14,173,0,0,4,0,105,254,103,6,209,5,154,0,28,
+0,39,0,104,0,116,0,0,1,52,54,51,50,22,22,21,20,6,35,34,39,55,22,51,50,54,
+53,52,38,39,22,21,20,6,35,34,38,55,20,51,50,54,53,52,38,35,34,6,1,20,6,35,
+34,39,23,20,6,6,35,34,3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,
+38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,39,55,22,22,51,50,54,
+53,52,38,39,54,54,51,50,22,1,22,22,21,20,6,35,34,53,52,54,55,1,214,154,121,
+110,157,80,176,152,138,101,42,80,80,135,132,48,51,14,106,106,102,125,95,126,
+61,67,67,62,65,60,4,156,121,104,64,61,3,53,137,118,236,88,46,158,133,146,
+178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,
+58,89,86,96,118,66,63,71,90,86,7,43,31,72,117,252,75,31,45,53,52,108,46,31,
+4,156,111,143,110,181,105,165,168,77,75,30,119,109,56,108,38,39,51,108,119,
+133,118,100,52,44,43,56,56,254,12,118,140,24,67,111,203,140,1,20,135,141,
+206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,
+82,128,98,75,113,72,70,59,73,89,9,44,55,182,252,159,83,171,50,46,40,86,43,
+174,87,0,0,3,0,100,255,231,5,129,6,210,0,99,0,110,0,122,0,0,1,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,55,55,62,2,53,52,38,35,34,6,21,20,23,7,38,53,
+52,54,54,51,50,22,23,55,54,54,55,54,53,52,38,39,22,21,20,6,35,34,38,53,52,
+54,51,50,22,22,21,20,7,22,21,20,6,7,38,38,35,34,6,7,1,6,6,21,20,22,51,50,
+55,51,22,22,51,50,54,53,52,38,39,54,54,51,50,22,1,52,38,35,34,6,21,20,51,
+50,54,3,50,22,21,20,6,35,34,38,53,52,54,5,129,151,156,124,167,36,50,166,124,
+130,167,75,82,137,35,33,18,74,75,72,81,34,63,87,59,124,94,124,151,11,64,80,
+160,99,150,48,51,14,106,106,102,125,154,121,110,157,80,82,73,61,54,14,98,
+75,63,132,51,254,126,48,37,90,78,216,75,71,41,128,113,95,113,60,56,12,45,
+29,59,74,254,144,67,62,65,60,126,61,67,114,54,69,68,55,55,67,68,1,144,194,
+231,148,128,143,133,153,119,83,134,83,138,35,39,48,34,56,75,69,62,60,62,40,
+101,128,60,112,74,125,112,65,81,89,2,45,168,56,108,38,39,51,108,119,133,107,
+111,143,110,181,105,156,87,56,85,55,79,13,62,85,58,52,254,123,49,70,38,57,
+67,224,126,98,118,100,76,130,31,35,42,180,3,193,43,56,56,39,100,52,253,84,
+69,52,52,68,68,52,52,69,0,0,2,0,100,255,231,5,178,5,154,0,84,0,95,0,0,1,35,
+22,21,20,6,35,34,3,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,
+20,23,7,38,53,52,54,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,
+50,53,52,38,35,35,55,51,50,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,
+22,22,21,20,7,51,1,52,38,35,34,6,21,20,51,50,54,5,178,199,147,164,133,246,
+88,50,170,134,100,127,56,93,134,83,70,74,75,72,81,34,63,87,59,124,94,129,
+147,97,122,83,65,168,216,75,71,35,113,98,196,139,123,126,10,100,143,195,99,
+14,106,106,102,125,154,121,112,157,78,122,164,254,197,67,62,65,60,126,61,
+67,2,89,109,190,143,184,1,20,144,132,87,134,73,92,146,104,64,100,66,56,75,
+69,62,60,62,40,101,128,60,112,74,146,125,98,157,96,65,94,50,137,224,110,114,
+181,110,124,148,173,124,138,73,39,51,108,119,133,107,111,143,110,181,105,
+173,116,1,182,43,56,56,39,100,52,0,0,4,0,107,254,103,5,251,5,155,0,59,0,70,
+0,82,0,94,0,0,1,20,2,6,35,34,3,6,6,35,34,2,53,52,18,54,51,50,22,21,20,6,35,
+34,38,53,52,55,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,2,39,22,21,
+20,6,35,34,38,53,52,54,51,50,22,18,1,52,38,35,34,6,21,20,51,50,54,1,20,22,
+51,50,54,53,52,38,35,34,6,1,22,22,21,20,6,35,34,53,52,54,55,5,251,76,166,
+127,236,88,53,161,123,181,213,108,191,119,113,131,119,114,113,122,8,101,159,
+143,121,142,35,71,35,120,105,159,131,119,90,10,106,106,102,125,154,121,141,
+211,113,254,121,67,62,65,60,126,61,67,253,16,75,68,73,70,71,69,70,76,1,226,
+31,45,53,52,108,46,31,2,108,173,254,220,180,1,20,151,125,1,25,237,192,1,45,
+168,154,137,133,155,145,127,42,34,131,251,176,179,106,118,110,114,249,222,
+171,1,75,84,36,39,108,119,133,107,111,143,225,254,139,1,95,43,56,56,39,100,
+52,254,231,57,66,68,56,51,72,69,252,87,83,171,50,46,40,86,43,174,87,0,0,2,
+0,100,255,231,5,126,5,153,0,95,0,106,0,0,1,20,6,6,35,34,3,6,6,35,34,38,38,
+53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,22,
+23,30,2,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,
+20,6,6,35,34,38,39,20,6,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,39,
+54,54,51,50,22,1,52,38,35,34,6,21,20,51,50,54,5,126,51,132,114,246,88,50,
+170,134,100,127,56,93,134,83,70,74,75,72,81,34,63,87,59,124,94,75,111,74,
+48,45,64,92,61,145,127,48,51,14,106,106,102,125,154,121,110,157,80,85,158,
+104,98,163,82,43,77,73,83,65,168,216,75,71,41,123,98,117,111,112,12,45,29,
+61,65,254,150,67,62,65,60,126,61,67,1,108,92,175,122,1,20,144,132,87,134,
+73,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,55,79,66,61,
+70,48,159,120,56,109,37,39,51,108,119,133,107,111,143,110,181,105,104,204,
+131,137,151,93,120,83,58,66,93,50,137,224,127,97,113,85,119,88,35,42,179,
+2,185,43,56,56,39,100,52,0,0,4,0,110,254,103,9,172,5,155,0,69,0,82,0,95,0,
+107,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,0,53,52,54,55,38,38,
+53,52,54,51,50,0,18,21,20,7,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,
+18,21,20,7,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,1,55,50,22,
+23,38,36,35,34,6,21,20,22,1,52,38,35,34,6,6,21,20,22,51,50,54,1,22,22,21,
+20,6,35,34,53,52,54,55,9,172,192,167,110,162,76,41,161,117,108,160,74,64,
+234,165,247,254,224,131,113,89,104,189,146,204,1,55,167,21,119,168,123,142,
+166,204,12,37,37,69,196,143,8,61,145,104,123,142,166,204,12,37,37,69,196,
+143,248,117,101,108,195,73,83,254,252,160,89,110,121,2,74,205,176,100,175,
+110,204,178,179,205,3,16,31,45,53,52,108,46,31,1,196,222,255,118,114,109,
+123,114,109,105,118,1,9,232,137,214,62,20,140,93,130,167,254,220,254,65,224,
+84,75,127,144,130,150,198,71,36,47,48,64,173,254,226,163,65,48,72,81,144,
+130,150,198,71,36,47,48,64,173,254,226,1,82,4,65,62,219,230,90,71,86,79,254,
+78,161,185,72,156,118,155,178,178,254,129,83,171,50,46,40,86,43,174,87,0,
+0,3,0,90,254,211,6,88,6,197,0,100,0,111,0,121,0,0,1,20,7,39,54,53,52,38,35,
+34,7,22,21,20,7,22,22,21,20,6,35,34,38,53,54,54,53,52,39,6,6,35,34,38,53,
+52,54,51,50,22,23,54,53,52,38,35,34,6,21,35,52,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,23,54,54,51,50,22,23,54,54,51,51,54,53,52,38,39,22,21,20,6,
+35,34,38,53,52,54,51,50,22,22,21,20,7,22,22,1,52,38,35,34,6,21,20,51,50,54,
+1,38,38,35,34,6,21,20,51,50,6,88,65,76,27,85,74,154,6,7,109,61,68,79,63,67,
+73,72,56,39,76,189,92,151,181,166,140,103,189,78,84,112,91,80,90,109,110,
+101,101,102,33,64,79,175,125,105,141,32,23,120,74,87,135,40,28,116,85,14,
+116,48,51,14,106,106,102,125,154,121,110,157,80,76,45,51,254,219,67,62,65,
+60,126,61,67,254,131,61,160,87,76,101,203,168,3,113,115,87,40,54,52,65,82,
+165,49,65,243,189,92,205,88,82,95,87,69,4,66,64,90,89,92,101,160,132,126,
+151,98,85,121,169,136,168,108,98,96,110,83,67,53,53,40,87,115,120,173,99,
+86,88,97,92,90,85,97,52,148,56,108,38,39,51,108,119,133,107,111,143,110,181,
+105,150,87,37,113,2,24,43,56,56,39,100,52,251,128,73,86,75,57,131,0,3,0,112,
+255,231,5,229,6,42,0,85,0,96,0,108,0,0,1,20,6,35,34,38,39,6,6,35,34,38,38,
+53,52,18,55,38,38,53,52,54,51,23,6,6,21,20,22,23,22,22,21,20,6,35,34,38,53,
+55,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,55,54,54,53,52,
+38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,22,1,52,38,35,
+34,6,21,20,51,50,54,1,34,6,21,20,22,51,50,54,53,52,38,5,229,169,140,129,174,
+41,53,161,123,110,187,110,159,128,68,85,188,157,18,84,96,49,44,106,134,113,
+108,108,116,3,43,53,161,143,121,142,35,71,33,126,93,90,112,127,139,16,115,
+132,48,46,12,106,106,104,123,154,121,104,159,85,114,102,121,154,254,179,67,
+62,65,60,126,61,67,253,131,63,70,68,62,66,63,64,1,99,172,208,146,130,151,
+125,135,232,140,195,1,52,56,45,137,79,125,151,85,18,126,87,57,105,35,4,155,
+118,127,148,138,121,45,52,161,79,160,179,106,118,103,122,133,109,110,207,
+60,91,19,155,112,61,114,39,40,44,108,119,131,109,111,143,107,174,96,130,190,
+50,77,249,3,58,44,55,57,38,100,52,254,131,66,52,54,63,65,53,48,69,0,4,0,111,
+255,231,4,155,5,155,0,18,0,31,0,44,0,56,0,0,19,52,54,55,38,38,53,52,54,51,
+50,0,18,21,20,0,35,34,0,1,34,6,21,20,22,51,55,50,22,23,38,36,1,52,38,35,34,
+6,6,21,20,22,51,50,54,37,52,54,51,50,22,21,20,6,35,34,38,111,131,113,89,104,
+189,146,204,1,55,167,254,225,246,247,254,224,1,153,89,110,121,104,101,108,
+195,73,83,254,252,1,92,205,176,100,175,110,204,178,179,205,254,6,68,54,54,
+69,68,55,55,67,1,216,137,214,62,20,140,93,130,167,254,220,254,65,224,230,
+254,245,1,9,4,15,90,71,86,79,4,65,62,219,230,253,8,161,185,72,156,118,155,
+178,178,167,52,69,69,52,52,68,68,0,0,4,0,111,255,231,5,174,5,155,0,28,0,42,
+0,73,0,82,0,0,1,20,6,35,34,38,39,6,6,35,34,38,38,53,52,54,55,38,38,53,52,
+54,51,50,4,18,23,22,22,1,34,6,21,20,22,51,54,51,32,23,46,2,1,52,39,6,6,35,
+34,38,53,52,54,51,50,23,38,38,35,34,4,21,20,22,51,50,54,55,51,22,22,51,50,
+1,34,21,20,22,51,50,55,38,5,174,190,169,121,156,52,30,162,117,117,156,73,
+175,153,76,86,203,152,200,1,51,174,11,62,68,252,225,103,116,122,103,53,59,
+1,29,149,35,168,228,2,36,20,30,135,92,98,121,121,103,60,56,56,208,131,238,
+254,241,114,104,93,114,41,71,36,121,114,252,255,0,127,57,54,143,27,63,1,129,
+192,218,123,151,127,147,118,190,109,179,253,65,27,131,84,131,173,226,254,
+169,171,59,163,3,38,97,79,73,82,3,100,115,197,116,252,170,62,54,67,74,108,
+87,87,105,15,43,44,219,191,128,135,94,130,113,111,2,1,83,34,41,113,45,255,
+255,0,111,254,103,5,174,5,155,2,38,0,235,0,0,0,6,1,181,0,0,0,2,0,110,255,
+230,5,235,6,226,0,100,0,111,0,0,1,16,2,35,34,38,53,52,54,51,50,22,21,20,6,
+7,39,54,54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,38,35,34,7,35,38,35,34,
+6,21,20,22,51,51,23,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,53,
+52,54,51,50,22,23,54,54,55,54,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,
+51,50,22,22,21,20,7,22,18,1,52,38,35,34,6,21,20,51,50,54,5,235,210,174,155,
+186,146,119,96,107,105,83,15,30,38,48,46,65,77,111,102,138,162,167,139,183,
+48,71,64,172,90,107,78,62,67,20,142,176,120,94,85,87,45,103,110,171,205,137,
+114,204,196,146,113,175,44,29,148,109,101,91,48,51,14,106,106,102,125,154,
+121,110,157,80,123,106,125,254,131,67,62,65,60,126,61,67,2,82,254,230,254,
+175,204,167,137,172,103,83,76,100,5,79,5,38,31,36,48,81,67,92,101,193,167,
+188,223,161,161,91,75,61,79,107,107,88,88,74,25,200,36,169,143,116,162,39,
+75,178,127,171,117,97,96,117,1,22,126,81,56,108,38,39,51,108,119,133,107,
+111,143,110,181,105,166,93,65,254,237,2,236,43,56,56,39,100,52,0,0,3,0,102,
+255,231,4,126,5,154,0,59,0,71,0,83,0,0,1,20,6,6,35,34,38,38,53,52,55,51,30,
+2,51,32,17,52,39,6,6,35,34,38,53,52,54,54,51,50,22,23,54,53,52,38,39,22,22,
+21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,7,22,22,1,52,38,35,34,6,
+21,20,22,51,50,54,19,39,38,35,34,6,21,20,22,51,50,54,4,126,117,232,165,182,
+240,112,6,85,2,71,184,164,1,141,41,45,160,118,123,138,68,128,88,64,113,68,
+25,70,67,8,8,106,106,68,103,56,65,125,85,125,169,83,26,76,68,254,91,67,62,
+65,60,60,66,61,67,154,5,74,120,87,79,71,73,76,110,1,168,127,203,119,137,216,
+120,50,47,107,157,96,1,21,85,61,102,116,118,98,64,95,52,23,28,88,96,94,170,
+47,20,53,21,108,119,61,109,70,68,116,70,129,220,135,128,107,56,155,2,171,
+43,56,56,39,46,54,52,254,52,3,41,55,43,49,44,79,0,255,255,0,102,254,103,5,
+131,5,155,2,38,0,240,0,0,0,38,1,181,250,0,0,6,1,182,4,246,0,3,0,102,255,231,
+5,131,5,155,0,27,0,41,0,60,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,
+18,55,38,38,53,52,54,51,50,0,18,21,1,54,51,4,23,46,2,35,34,6,21,20,22,1,52,
+36,35,34,4,21,20,22,51,50,54,55,51,22,22,51,50,54,5,131,67,155,124,122,146,
+40,30,162,117,117,156,73,154,167,73,82,192,153,204,1,114,224,253,7,57,49,
+1,71,172,65,205,237,112,94,115,121,2,198,254,240,232,230,254,243,114,104,
+93,114,41,71,40,112,91,115,108,1,136,99,190,128,140,134,127,147,118,190,109,
+163,1,27,73,29,131,81,125,158,254,216,254,36,252,2,44,5,2,172,152,217,112,
+79,68,85,80,253,246,202,233,233,198,128,135,94,130,126,98,137,255,255,0,102,
+254,103,5,131,5,155,2,38,0,240,0,0,0,6,1,181,246,0,0,2,0,101,255,150,5,2,
+5,154,0,53,0,64,0,0,1,20,6,35,34,38,38,39,38,38,35,34,6,21,20,22,23,20,35,
+34,38,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,2,38,39,22,21,20,6,
+35,34,38,53,52,54,51,50,0,18,1,52,38,35,34,6,21,20,51,50,54,5,2,170,148,83,
+120,85,66,66,115,72,73,84,98,100,89,46,98,64,133,109,61,92,89,85,76,103,69,
+114,103,126,235,159,25,106,106,102,125,154,121,227,1,108,215,253,36,67,62,
+65,60,126,61,67,1,155,202,234,68,102,99,98,96,82,77,84,139,26,136,102,189,
+122,150,184,55,106,118,107,69,189,153,181,1,59,217,42,59,57,108,119,133,107,
+111,143,254,231,254,28,2,6,43,56,56,39,100,52,0,3,0,105,255,231,5,118,5,163,
+0,28,0,39,0,88,0,0,1,52,54,51,50,22,22,21,20,6,35,34,39,55,22,51,50,54,53,
+52,38,39,22,21,20,6,35,34,38,55,20,51,50,54,53,52,38,35,34,6,1,20,6,6,35,
+34,3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,
+51,50,55,51,22,22,51,50,54,53,52,38,39,54,54,51,50,22,1,124,154,121,110,157,
+80,176,152,138,101,42,80,80,135,132,48,51,14,106,106,102,125,95,126,61,67,
+67,62,65,60,3,155,53,137,118,236,88,46,158,133,146,178,146,119,96,107,188,
+15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,93,79,12,45,29,76,110,
+4,165,111,143,110,181,105,165,168,77,75,30,119,109,56,108,38,39,51,108,119,
+133,118,100,52,44,43,56,56,252,214,111,203,140,1,20,135,141,206,165,137,172,
+103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,106,163,73,35,
+42,249,255,255,0,105,254,103,5,118,5,163,2,38,0,243,0,0,0,6,1,181,1,0,0,2,
+0,100,255,231,5,192,5,154,0,71,0,82,0,0,1,20,2,6,35,34,3,6,6,35,34,38,38,
+53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,50,22,21,
+20,6,7,6,6,21,20,51,50,55,51,30,2,51,50,54,53,52,2,39,22,21,20,35,34,38,53,
+52,54,51,50,22,18,1,52,38,35,34,6,21,20,51,50,54,5,192,78,163,122,246,88,
+50,170,134,100,127,56,93,134,83,70,74,75,72,81,34,63,87,59,124,94,129,147,
+97,122,83,65,168,216,75,71,28,61,100,82,137,136,125,107,10,212,102,125,154,
+121,152,226,120,254,88,67,62,65,60,126,61,67,2,59,160,254,241,165,1,20,144,
+132,87,134,73,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,112,74,
+146,125,98,157,96,65,94,50,137,224,82,94,48,244,199,192,1,80,87,37,40,227,
+133,107,111,143,255,254,113,1,151,43,56,56,39,100,52,0,255,255,0,100,254,
+103,5,192,5,154,2,38,0,245,0,0,0,6,1,181,7,0,0,2,0,90,255,231,8,31,5,154,
+0,81,0,92,0,0,1,20,6,35,34,38,39,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,
+2,39,22,21,20,35,34,38,53,52,54,51,50,22,18,21,20,7,22,22,51,50,54,53,52,
+38,39,38,53,52,54,51,50,22,18,1,52,38,35,34,6,21,20,51,50,54,8,31,192,167,
+107,160,74,91,223,123,152,39,46,158,133,146,178,146,119,96,107,188,15,68,
+48,46,65,77,251,215,68,71,40,111,90,135,158,125,107,10,212,102,125,154,121,
+152,226,120,21,58,141,98,123,142,166,204,12,37,37,69,196,143,251,215,67,62,
+65,60,126,61,67,1,196,222,255,113,108,221,141,135,135,141,206,165,137,172,
+103,83,152,29,79,14,65,35,44,81,67,191,224,127,97,200,243,192,1,80,87,37,
+40,227,133,107,111,143,255,254,113,209,136,110,65,74,144,130,150,198,71,36,
+47,48,64,173,254,226,2,60,43,56,56,39,100,52,0,0,3,0,107,255,231,9,153,5,
+154,0,68,0,79,0,91,0,0,1,20,6,35,34,38,39,6,35,34,38,39,6,6,35,34,38,2,53,
+16,0,51,50,18,17,20,7,22,22,51,50,54,53,52,2,39,22,21,20,35,34,38,53,52,54,
+51,50,18,18,21,20,7,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,1,
+52,38,35,34,6,21,20,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,9,153,192,
+167,110,161,76,88,254,130,190,86,61,225,132,162,215,101,1,1,219,222,255,17,
+75,155,113,143,133,129,102,9,212,102,125,154,121,170,232,111,6,60,146,103,
+123,142,166,204,12,37,37,69,196,143,251,173,67,62,65,60,126,61,67,254,122,
+199,176,175,203,209,171,170,203,1,196,222,255,117,114,231,140,132,140,132,
+164,1,11,158,1,15,1,63,254,196,254,238,100,83,97,98,198,245,172,1,94,89,37,
+36,227,133,107,111,143,254,211,254,55,235,52,51,71,81,144,130,150,198,71,
+36,47,48,64,173,254,226,2,60,43,56,56,39,100,52,253,185,180,203,199,173,174,
+211,203,0,0,3,0,111,255,231,4,155,5,155,0,18,0,32,0,45,0,0,19,52,54,55,38,
+38,53,52,54,51,50,0,18,21,20,0,35,34,0,1,34,6,21,20,22,51,54,51,50,22,23,
+38,36,1,52,38,35,34,6,6,21,20,22,51,50,54,111,131,113,89,104,189,146,204,
+1,55,167,254,225,246,247,254,224,1,153,89,110,121,104,55,46,108,195,73,83,
+254,252,1,92,205,176,100,175,110,204,178,179,205,1,216,137,214,62,20,140,
+93,130,167,254,220,254,65,224,230,254,245,1,9,4,15,90,71,86,79,4,65,62,219,
+230,253,8,161,185,72,156,118,155,178,178,0,0,3,0,107,255,231,5,163,6,13,0,
+46,0,57,0,69,0,0,1,16,33,32,0,17,52,54,54,51,50,22,21,20,6,35,34,38,53,52,
+55,6,6,21,20,4,33,32,0,17,52,2,39,22,21,20,6,35,34,38,53,52,54,51,50,22,18,
+1,52,38,35,34,6,21,20,51,50,54,1,20,22,51,50,54,53,52,38,35,34,6,5,163,253,
+81,254,198,254,177,109,192,119,117,133,119,114,113,122,13,60,56,1,30,1,9,
+1,22,1,50,113,97,7,109,109,106,129,148,125,132,222,131,254,117,71,65,69,63,
+133,65,70,253,116,75,68,73,70,71,69,70,76,3,6,252,225,1,72,1,49,164,247,135,
+155,136,133,155,145,127,57,37,64,149,103,210,224,1,52,1,19,176,1,43,92,29,
+34,112,127,137,112,118,143,188,254,160,1,29,44,58,58,40,103,53,254,127,57,
+66,68,56,51,72,69,0,0,2,0,105,255,231,5,146,5,155,0,58,0,69,0,0,1,20,6,6,
+35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,
+21,20,51,50,55,51,22,22,51,50,54,53,52,2,38,39,22,21,20,35,34,38,53,52,54,
+51,50,0,18,1,52,38,35,34,6,21,20,51,50,54,5,146,67,155,124,123,152,39,46,
+158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,40,111,
+90,126,100,117,253,195,24,212,102,125,154,121,255,1,135,211,252,241,67,62,
+65,60,126,61,67,1,136,99,190,128,141,135,135,141,206,165,137,172,103,83,152,
+29,79,14,65,35,44,81,67,191,224,127,97,156,145,186,1,72,239,45,57,60,227,
+133,107,111,143,254,205,254,29,2,31,43,56,56,39,100,52,0,0,3,0,96,255,231,
+4,203,6,45,0,60,0,71,0,85,0,0,1,20,4,33,34,38,38,53,52,54,51,50,54,55,38,
+35,34,6,21,20,23,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,23,55,
+52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,18,21,7,22,22,1,52,38,35,34,
+6,21,20,51,50,54,1,52,39,6,6,35,34,6,21,20,22,51,50,36,4,203,254,192,254,
+220,115,234,170,212,173,177,171,20,85,112,126,144,23,57,45,50,56,74,69,82,
+101,198,170,112,89,1,70,50,7,114,98,102,125,138,112,131,184,91,2,130,138,
+253,195,67,62,65,60,126,61,67,1,205,166,25,207,227,133,118,173,172,251,1,
+24,1,200,231,250,50,137,121,142,113,146,177,25,54,65,30,19,7,47,48,62,48,
+56,61,96,77,106,106,22,72,107,195,51,32,33,109,118,133,107,109,143,165,255,
+0,135,104,59,235,2,197,43,56,56,39,100,52,253,6,199,92,178,200,54,63,64,76,
+180,0,0,3,0,90,255,114,5,188,5,154,0,28,0,39,0,96,0,0,1,52,54,51,50,22,22,
+21,20,6,35,34,39,55,22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,55,20,51,
+50,54,53,52,38,35,34,6,1,39,6,35,34,3,6,6,35,34,38,53,52,54,51,50,22,21,20,
+7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,50,55,3,55,19,54,53,52,
+38,39,54,54,51,50,22,21,20,6,7,23,1,157,154,121,110,157,80,176,152,138,101,
+42,80,80,135,132,48,51,14,106,106,102,125,95,126,61,67,67,62,65,60,3,59,104,
+66,90,236,88,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,
+215,68,71,36,111,105,48,39,201,70,231,52,93,79,12,45,29,76,110,32,32,149,
+4,156,111,143,110,181,105,165,168,77,75,30,119,109,56,108,38,39,51,108,119,
+133,118,100,52,44,43,56,56,250,164,172,55,1,20,135,141,206,165,137,172,103,
+83,152,29,79,14,65,35,44,81,67,191,224,112,112,12,1,77,45,254,200,62,105,
+106,163,73,35,42,249,172,67,152,65,200,0,0,3,0,100,255,231,4,140,5,154,0,
+28,0,39,0,76,0,0,19,52,54,51,50,22,22,21,20,6,35,34,39,55,22,51,50,54,53,
+52,38,39,22,21,20,6,35,34,38,55,20,51,50,54,53,52,38,35,34,6,1,20,6,35,34,
+38,38,39,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,22,23,22,22,51,50,
+54,53,52,38,39,55,22,249,154,121,110,157,80,176,152,138,101,42,80,80,135,
+132,48,51,14,106,106,102,125,95,126,61,67,67,62,65,60,3,52,120,99,41,60,46,
+32,67,131,105,127,134,10,86,26,195,166,91,121,86,62,21,39,32,66,61,50,48,
+87,135,4,156,111,143,110,181,105,165,168,77,75,30,119,109,56,108,38,39,51,
+108,119,133,118,100,52,44,43,56,56,252,151,172,210,36,60,55,114,84,128,105,
+58,48,10,80,89,176,208,66,115,110,36,29,133,88,114,178,93,38,214,0,0,4,0,
+107,255,231,5,234,5,155,0,43,0,54,0,66,0,78,0,0,1,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,55,36,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,
+20,7,22,23,54,54,51,50,22,1,52,38,35,34,6,21,20,51,50,54,19,52,38,35,34,6,
+21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,5,234,200,174,120,169,
+41,40,170,120,173,200,179,144,1,24,99,14,106,106,102,125,154,121,112,157,
+78,143,97,49,42,172,116,161,212,252,45,67,62,65,60,126,61,67,206,141,109,
+109,142,142,109,108,142,2,128,141,109,109,142,142,109,108,142,1,132,192,221,
+120,103,103,120,221,192,149,213,18,36,221,157,75,39,50,108,119,133,107,111,
+143,117,188,106,211,89,56,111,98,116,219,2,124,43,56,56,39,100,52,253,40,
+103,132,131,104,105,135,134,106,103,132,131,104,105,135,134,0,5,0,107,255,
+231,6,53,6,226,0,52,0,63,0,75,0,87,0,117,0,0,1,20,2,35,34,38,39,6,6,35,34,
+2,53,52,18,54,51,50,22,21,20,7,51,38,53,52,54,51,50,54,53,52,38,39,22,21,
+20,6,35,34,38,53,52,54,51,50,22,22,21,20,7,22,18,1,52,38,35,34,6,21,20,51,
+50,54,1,20,22,51,50,54,53,52,38,35,34,6,5,20,22,51,50,54,53,52,38,35,34,6,
+1,52,38,39,22,21,20,6,35,33,34,38,53,52,55,6,6,21,20,22,51,50,54,55,51,22,
+22,51,50,54,6,53,220,171,131,191,28,27,191,132,171,220,112,195,120,116,145,
+40,186,40,145,116,155,146,48,51,14,106,106,102,125,154,121,110,157,80,171,
+92,107,254,211,67,62,65,60,126,61,67,252,135,75,68,73,70,71,69,70,76,2,100,
+70,73,68,75,76,70,69,71,1,207,50,44,11,133,122,253,192,122,133,11,44,50,169,
+139,115,130,33,80,33,130,115,139,169,2,4,237,254,208,158,133,132,159,1,49,
+236,181,1,35,166,154,121,84,59,59,84,121,154,112,117,56,108,38,39,51,108,
+119,133,107,111,143,110,181,105,229,75,83,254,225,3,55,43,56,56,39,100,52,
+253,160,57,66,68,56,51,72,69,54,56,68,66,57,55,69,72,254,182,90,166,63,41,
+38,118,120,120,118,38,41,63,166,90,182,217,117,107,107,117,217,0,4,0,82,255,
+231,5,71,5,155,0,57,0,68,0,78,0,90,0,0,1,22,21,20,33,34,38,53,52,55,38,38,
+53,52,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,22,23,22,22,23,54,
+18,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,16,1,52,38,35,
+34,6,21,20,51,50,54,5,20,51,50,54,53,52,38,35,34,1,52,38,35,34,6,21,20,22,
+51,50,54,3,134,51,254,242,126,139,68,189,215,203,164,118,120,110,104,103,
+109,15,97,51,142,134,108,136,48,233,228,57,58,14,106,106,104,123,154,121,
+108,162,87,254,229,67,62,65,60,126,61,67,253,46,124,61,62,63,58,126,1,242,
+81,72,77,77,78,74,75,80,1,119,65,94,241,123,107,94,53,6,208,179,181,228,139,
+113,118,137,125,112,58,32,80,118,73,94,59,11,9,28,27,44,1,17,197,83,141,43,
+38,50,108,119,131,109,111,143,124,205,117,254,30,2,169,43,56,56,39,100,52,
+247,101,55,48,43,58,253,18,55,57,61,53,51,60,58,0,4,0,107,255,231,6,53,6,
+226,0,81,0,92,0,104,0,116,0,0,1,20,2,35,34,38,39,6,6,35,34,2,53,52,18,54,
+51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,54,55,51,22,22,51,50,
+54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,32,53,52,38,39,22,21,20,6,
+35,34,38,53,52,54,51,50,22,22,21,20,7,22,18,1,52,38,35,34,6,21,20,51,50,54,
+1,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,6,53,
+220,171,131,191,28,27,191,132,171,220,112,195,120,116,145,140,103,115,132,
+11,44,50,169,139,115,130,33,80,33,130,115,139,169,50,44,11,131,116,103,140,
+145,116,1,26,48,51,14,106,106,102,125,154,121,110,157,80,158,95,110,254,192,
+67,62,65,60,126,61,67,252,154,75,68,73,70,71,69,70,76,3,130,76,70,69,71,70,
+73,68,75,2,4,237,254,208,158,133,132,159,1,49,236,181,1,35,166,154,121,123,
+169,128,110,38,41,63,166,90,182,217,117,107,107,117,217,182,90,166,63,41,
+38,109,129,169,123,121,154,229,56,108,38,39,51,108,119,133,107,111,143,110,
+181,105,220,79,82,254,223,3,51,43,56,56,39,100,52,253,160,57,66,68,56,51,
+72,69,55,55,69,72,51,56,68,66,0,4,0,110,254,103,8,250,6,52,0,15,0,103,0,115,
+0,127,0,0,1,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,1,20,6,35,34,38,3,
+23,20,6,6,35,34,3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,
+34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,39,55,22,22,51,50,54,53,52,
+38,39,54,54,51,50,22,21,20,6,35,39,22,22,51,50,54,53,52,38,39,38,53,52,54,
+51,50,22,18,37,50,22,21,20,6,35,34,38,53,52,54,19,22,22,21,20,6,35,34,53,
+52,54,55,3,238,252,138,15,3,111,125,101,47,113,77,150,99,158,4,130,192,167,
+158,246,133,1,53,137,118,236,88,46,158,133,146,178,146,119,96,107,188,15,
+68,48,46,65,77,251,215,68,71,36,111,105,115,124,58,89,86,96,118,66,63,71,
+90,86,7,43,31,72,117,121,104,44,94,216,142,123,142,166,204,12,37,37,69,196,
+143,250,20,54,69,68,55,55,67,68,73,31,45,53,52,108,46,31,3,171,191,34,73,
+55,112,125,59,158,192,117,133,49,254,25,222,255,219,1,25,46,111,203,140,1,
+20,135,141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,
+112,132,113,82,128,98,75,113,72,70,59,73,89,9,44,55,182,116,118,140,3,134,
+155,144,130,150,198,71,36,47,48,64,173,254,226,243,69,52,52,68,68,52,52,69,
+252,147,83,171,50,46,40,86,43,174,87,0,0,2,0,90,254,211,8,197,4,130,0,104,
+0,114,0,0,1,20,2,35,34,38,53,52,55,54,53,52,38,35,34,7,22,21,20,7,22,22,21,
+20,6,35,34,38,53,54,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,
+38,35,34,6,21,35,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,
+50,22,23,54,54,51,50,22,21,20,7,6,6,21,20,22,51,50,54,53,16,37,38,53,52,54,
+51,50,22,18,1,38,38,35,34,6,21,20,51,50,8,197,248,201,157,186,27,31,81,79,
+154,6,7,109,61,68,79,63,67,73,72,56,39,76,189,92,151,181,166,140,103,189,
+78,84,112,91,80,90,109,110,101,101,102,33,64,79,175,125,105,141,32,23,120,
+74,87,135,40,28,116,85,106,142,29,18,18,136,116,151,183,254,142,12,37,37,
+69,197,142,250,241,61,160,87,76,101,203,168,1,226,227,254,232,198,165,70,
+127,149,88,92,108,165,49,65,243,189,92,205,88,82,95,87,69,4,66,64,90,89,92,
+101,160,132,126,151,98,85,121,169,136,168,108,98,96,110,83,67,53,53,40,87,
+115,120,173,99,86,88,97,92,90,85,97,155,118,64,137,87,115,61,106,129,168,
+140,1,22,111,36,47,48,64,169,254,238,254,171,73,86,75,57,131,0,3,0,110,254,
+204,7,134,6,52,0,15,0,88,0,100,0,0,1,33,55,33,50,54,54,53,52,39,55,22,21,
+20,6,6,1,16,0,35,34,0,3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,
+38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,39,54,54,51,50,22,21,
+20,6,6,35,34,39,22,22,51,50,54,54,53,16,37,38,53,52,54,51,50,22,18,1,50,22,
+21,20,6,35,34,38,53,52,54,3,238,252,138,15,3,111,125,101,47,113,77,150,99,
+158,3,14,254,234,254,203,254,199,104,46,161,133,146,178,146,119,96,107,188,
+15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,93,79,12,45,29,76,110,
+53,137,118,69,60,75,171,105,138,230,141,254,222,12,37,37,66,155,107,251,136,
+54,69,68,55,55,67,68,3,171,191,34,73,55,112,125,59,158,192,117,133,49,253,
+242,254,168,254,135,1,38,1,14,135,146,206,165,137,172,103,83,152,29,79,14,
+65,35,44,81,67,191,224,112,112,132,113,106,163,73,35,42,249,172,110,199,135,
+39,75,68,116,243,181,1,121,82,36,47,48,64,189,254,205,1,23,69,52,52,68,68,
+52,52,69,255,255,0,110,254,103,7,134,6,52,2,38,1,5,0,0,0,6,1,181,6,0,0,1,
+0,110,254,204,7,129,6,52,0,83,0,0,1,16,0,35,34,0,3,6,6,35,34,38,53,52,54,
+51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,
+53,52,2,39,33,55,33,50,54,53,52,39,55,22,21,20,6,7,22,18,21,20,6,6,35,34,
+39,22,22,51,50,54,54,53,16,37,38,53,52,54,51,50,22,18,7,129,254,234,254,203,
+254,200,103,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,
+68,71,40,111,90,116,109,253,205,253,68,15,3,141,158,115,113,77,150,163,179,
+159,183,66,153,122,69,60,75,171,105,138,230,141,254,222,12,37,37,66,155,107,
+1,157,254,168,254,135,1,33,1,14,135,141,206,165,137,172,103,83,152,29,79,
+14,65,35,44,81,67,191,224,127,97,137,122,205,1,17,16,191,70,92,112,125,59,
+158,192,152,138,8,71,254,216,181,98,185,124,39,75,68,116,243,181,1,121,82,
+36,47,48,64,189,254,205,0,3,0,82,255,231,7,43,6,52,0,82,0,92,0,104,0,0,1,
+20,6,35,34,38,39,21,20,33,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,
+35,34,38,53,52,55,6,21,20,22,22,23,22,22,23,36,53,52,39,35,55,51,50,54,54,
+53,52,39,55,22,21,20,6,7,22,22,21,20,6,7,22,22,51,50,54,53,52,38,39,38,53,
+52,54,51,50,22,18,1,20,51,50,54,53,52,38,35,34,1,52,38,35,34,6,21,20,22,51,
+50,54,7,43,200,181,139,226,136,254,242,126,139,68,189,215,203,164,118,120,
+110,104,103,109,15,97,51,142,134,111,136,49,1,64,216,109,15,72,125,101,47,
+113,77,150,114,95,98,103,185,170,132,238,145,164,148,166,204,12,37,37,69,
+196,143,250,47,124,61,62,63,58,126,1,242,81,72,77,77,78,74,75,80,1,196,227,
+250,106,141,6,241,123,107,94,53,6,208,179,181,228,139,113,118,137,125,112,
+58,32,80,118,73,94,59,11,10,28,28,29,204,166,67,191,34,73,55,112,125,59,158,
+192,124,137,22,40,137,82,144,147,28,103,89,147,128,150,198,71,36,47,48,64,
+173,254,226,1,26,101,55,48,43,58,253,18,55,57,61,53,51,60,58,0,4,0,110,254,
+103,11,205,6,52,0,15,0,134,0,146,0,158,0,0,1,33,55,33,50,54,54,53,52,39,55,
+22,21,20,6,6,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,
+20,22,51,50,54,53,52,38,35,34,7,6,6,21,23,16,35,34,38,3,23,20,6,6,35,34,3,
+6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,
+55,51,22,22,51,50,54,53,52,38,39,55,22,22,51,50,54,53,52,38,39,54,54,51,50,
+22,21,20,6,35,39,22,22,51,50,54,54,53,39,52,18,51,50,0,37,50,22,21,20,6,35,
+34,38,53,52,54,19,22,22,21,20,6,35,34,53,52,54,55,3,238,252,138,15,3,111,
+125,101,47,113,77,150,99,158,7,85,208,183,140,169,132,98,74,80,62,59,52,61,
+55,108,106,136,155,211,180,215,88,30,27,4,235,158,246,133,1,53,137,118,236,
+88,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,
+36,111,105,115,124,58,89,86,96,118,66,63,71,90,86,7,43,31,72,117,121,104,
+45,91,218,118,74,70,17,5,250,212,232,1,8,247,65,54,69,68,55,55,67,68,73,31,
+45,53,52,108,46,31,3,171,191,34,73,55,112,125,59,158,192,117,133,49,254,86,
+254,254,228,184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,207,
+237,153,52,140,120,224,254,221,219,1,25,46,111,203,140,1,20,135,141,206,165,
+137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,82,128,
+98,75,113,72,70,59,73,89,9,44,55,182,116,118,140,3,131,160,68,100,83,238,
+222,1,3,254,170,46,69,52,52,68,68,52,52,69,252,147,83,171,50,46,40,86,43,
+174,87,0,2,0,90,254,211,11,107,4,130,0,138,0,148,0,0,1,20,2,35,34,38,53,52,
+54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,38,35,34,7,6,
+6,21,23,20,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,7,22,21,20,7,22,
+22,21,20,6,35,34,38,53,54,54,53,52,39,6,6,35,34,38,53,52,54,51,50,22,23,54,
+53,52,38,35,34,6,21,35,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,
+54,51,50,22,23,54,51,50,22,21,20,6,7,6,21,20,22,51,50,54,53,39,52,18,51,50,
+0,1,38,38,35,34,6,21,20,51,50,11,107,208,183,140,169,132,98,74,80,62,59,52,
+61,55,108,106,136,155,211,180,215,88,30,27,4,170,145,140,162,23,25,22,21,
+76,93,79,107,4,7,109,61,68,79,63,67,73,72,56,39,76,189,92,151,181,166,140,
+103,189,78,84,112,91,80,90,109,110,101,101,102,33,64,79,175,125,105,141,32,
+23,120,74,87,135,40,61,198,132,132,19,20,37,84,102,102,88,5,250,212,232,1,
+8,248,75,61,160,87,76,101,203,168,2,1,254,254,228,184,152,118,151,78,64,52,
+68,55,57,11,43,65,78,86,179,163,207,237,153,52,140,120,224,133,158,166,143,
+57,116,98,83,104,45,89,96,82,84,49,64,243,189,92,205,88,82,95,87,69,4,66,
+64,90,89,92,101,160,132,126,151,98,85,121,169,136,168,108,98,96,110,83,67,
+53,53,40,87,115,120,173,99,86,88,97,92,90,182,171,137,50,102,84,148,65,100,
+111,140,109,238,222,1,3,254,170,253,246,73,86,75,57,131,0,3,0,110,254,205,
+10,216,6,52,0,15,0,118,0,130,0,0,1,33,55,33,50,54,54,53,52,39,55,22,21,20,
+6,6,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,
+50,54,53,52,38,35,34,2,17,23,16,2,35,34,0,3,6,6,35,34,38,53,52,54,51,50,22,
+21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,
+39,54,54,51,50,22,21,20,6,6,35,34,39,22,22,51,50,54,53,39,16,0,51,50,22,18,
+37,50,22,21,20,6,35,34,38,53,52,54,3,238,252,138,15,3,111,125,101,47,113,
+77,150,99,158,6,96,208,183,140,169,132,98,74,80,62,59,52,61,55,108,106,136,
+155,211,180,201,226,1,234,232,203,254,200,104,46,161,133,146,178,146,119,
+96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,93,79,12,45,
+29,76,110,53,137,118,69,60,75,170,105,213,235,4,1,15,245,169,225,106,248,
+54,54,69,68,55,55,67,68,3,171,191,34,73,55,112,125,59,158,192,117,133,49,
+254,86,254,254,228,184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,
+207,237,254,254,254,228,69,254,177,254,196,1,37,1,14,135,146,206,165,137,
+172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,106,163,73,
+35,42,249,172,110,199,135,39,74,68,248,231,199,1,26,1,56,185,254,220,181,
+69,52,52,68,68,52,52,69,255,255,0,110,254,103,10,216,6,52,2,38,1,11,0,0,0,
+6,1,181,6,0,0,1,0,110,254,204,10,211,6,52,0,113,0,0,1,20,2,35,34,38,53,52,
+54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,38,35,34,2,17,
+23,16,2,35,34,0,3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,
+34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,2,39,33,55,33,50,54,53,52,39,
+55,22,21,20,6,7,22,18,21,20,6,6,35,34,39,22,22,51,50,54,53,39,16,0,51,50,
+22,18,10,211,208,183,140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,
+211,180,201,226,1,234,232,203,254,202,104,46,158,133,146,178,146,119,96,107,
+188,15,68,48,46,65,77,251,215,68,71,40,111,90,116,109,253,205,253,68,15,3,
+141,158,115,113,77,150,163,179,159,183,66,153,122,70,59,75,170,105,213,235,
+4,1,15,245,169,225,106,2,0,254,254,228,184,152,118,151,78,64,52,68,55,57,
+11,43,65,78,86,179,163,207,237,254,254,254,228,69,254,177,254,196,1,33,1,
+14,135,141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,127,
+97,137,122,205,1,17,16,191,70,92,112,125,59,158,192,152,138,8,71,254,216,
+181,98,185,124,39,75,68,248,231,199,1,26,1,56,185,254,220,0,0,3,0,82,255,
+231,9,217,6,52,0,112,0,122,0,134,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,
+20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,38,35,34,7,6,6,21,23,16,33,
+34,38,39,21,20,33,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,34,38,
+53,52,55,6,21,20,22,22,23,22,22,23,36,53,52,39,35,55,51,50,54,54,53,52,39,
+55,22,21,20,6,7,22,22,21,20,6,7,22,51,50,54,54,53,3,52,18,51,50,0,37,20,51,
+50,54,53,52,38,35,34,1,52,38,35,34,6,21,20,22,51,50,54,9,217,208,183,140,
+169,132,98,74,80,62,59,52,61,55,108,106,136,155,211,180,215,88,30,27,4,254,
+245,115,221,118,254,242,126,139,68,189,215,203,164,118,120,110,104,103,109,
+15,97,51,142,134,111,136,49,1,64,216,109,15,72,125,101,47,113,77,150,114,
+95,98,103,185,170,245,238,78,77,22,5,250,212,232,1,8,247,129,124,61,62,63,
+58,126,1,242,81,72,77,77,78,74,75,80,2,1,254,254,228,184,152,118,151,78,64,
+52,68,55,57,11,43,65,78,86,179,163,207,237,153,52,140,120,224,254,223,126,
+119,6,241,123,107,94,53,6,208,179,181,228,139,113,118,137,125,112,58,32,80,
+118,73,94,59,11,10,28,28,29,204,166,67,191,34,73,55,112,125,59,158,192,124,
+137,22,40,137,82,144,147,28,192,53,94,83,1,2,222,1,3,254,170,85,101,55,48,
+43,58,253,18,55,57,61,53,51,60,58,0,0,2,0,115,255,231,4,137,6,111,0,76,0,
+90,0,0,1,35,22,21,20,7,33,21,35,34,38,39,22,22,21,20,6,6,35,34,38,38,53,52,
+55,6,35,35,55,33,54,54,53,52,38,39,33,55,33,50,54,55,54,53,52,38,38,35,34,
+6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,21,
+20,6,6,1,34,6,6,21,20,22,51,50,54,53,52,38,38,2,210,46,18,20,1,130,42,61,
+94,36,80,92,87,186,142,127,181,93,172,53,127,56,10,1,129,23,35,15,13,254,
+83,16,2,87,125,122,35,49,46,95,71,74,76,19,1,45,39,46,44,58,56,48,80,47,53,
+113,84,101,139,67,83,192,254,216,85,121,63,137,131,139,133,68,122,3,171,46,
+50,54,40,148,1,3,37,150,95,97,157,94,91,158,99,186,96,4,148,9,52,35,27,50,
+17,191,27,32,46,92,51,92,58,66,55,35,30,36,43,52,40,46,51,44,84,59,56,104,
+68,102,160,89,124,156,77,254,176,56,101,67,95,110,116,89,69,101,54,0,0,2,
+0,80,255,231,6,86,6,111,0,106,0,117,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,
+53,52,54,54,51,50,22,23,54,53,52,38,35,34,6,21,20,23,53,52,54,51,50,22,21,
+20,35,34,38,38,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,38,
+39,35,55,51,50,54,55,54,53,52,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,
+6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,18,1,50,55,38,38,35,34,
+6,21,20,22,6,52,89,179,130,115,193,128,68,188,109,143,166,65,125,87,95,164,
+107,59,143,123,80,96,43,56,43,52,57,140,43,96,68,68,129,89,120,159,75,62,
+99,156,95,146,169,98,182,119,25,15,113,125,122,35,49,46,95,71,74,76,19,1,
+45,39,46,44,58,56,48,80,47,53,113,84,101,139,67,134,149,120,129,251,85,157,
+100,90,137,67,70,69,88,1,222,150,226,127,91,107,94,104,146,131,70,113,65,
+69,72,112,150,176,174,70,66,64,32,7,47,48,62,48,121,49,113,90,82,133,77,144,
+241,148,179,147,60,46,155,164,93,185,134,19,191,27,32,46,92,51,92,58,66,55,
+35,30,36,43,52,40,46,51,44,84,59,56,104,68,102,160,89,146,171,27,73,255,0,
+254,56,95,75,68,65,50,58,65,0,1,0,120,0,0,4,132,6,111,0,56,0,0,37,21,35,53,
+16,2,38,35,34,6,2,17,21,35,53,52,18,55,33,55,33,50,54,54,53,52,38,35,34,6,
+21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,
+18,4,132,209,61,146,99,104,140,67,210,161,165,254,186,15,2,78,146,128,57,
+117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,159,171,175,
+155,241,241,214,1,19,1,22,172,162,254,240,254,236,229,236,232,1,112,103,191,
+40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,171,
+164,17,107,254,142,0,4,0,110,254,103,6,214,6,111,0,40,0,115,0,127,0,140,0,
+0,1,33,55,33,50,54,55,54,53,52,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,
+6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,5,20,6,35,34,39,22,21,20,6,
+6,35,34,38,39,6,6,35,34,38,38,53,52,54,54,51,50,22,21,20,6,7,39,54,54,53,
+52,38,35,34,6,21,20,51,50,54,55,51,22,22,51,50,54,53,52,38,38,39,55,30,2,
+51,50,54,53,52,38,39,54,54,51,50,22,22,37,50,22,21,20,6,35,34,38,53,52,54,
+19,22,22,21,20,6,35,34,38,53,52,54,55,3,199,252,177,15,3,72,125,122,35,49,
+46,95,71,74,76,19,1,45,39,46,44,58,56,48,80,47,53,113,84,101,139,67,206,2,
+38,121,104,64,61,3,53,137,118,122,160,42,46,158,133,103,146,75,64,120,81,
+96,107,98,90,15,33,35,48,46,65,77,251,107,141,35,71,36,111,105,115,124,30,
+62,55,86,54,82,91,53,63,71,90,86,7,43,31,46,88,55,252,56,54,69,68,55,55,67,
+68,73,31,45,53,52,53,55,46,31,3,171,191,27,32,46,92,51,92,58,66,55,35,30,
+36,43,52,40,46,51,44,84,59,56,104,68,102,160,89,179,178,209,118,140,24,36,
+31,111,203,140,145,131,135,141,101,169,101,87,141,81,103,83,77,90,14,79,7,
+37,35,35,44,81,67,191,108,116,112,112,132,113,61,96,90,61,75,64,78,43,70,
+59,73,89,9,44,55,84,138,52,69,52,52,68,68,52,52,69,252,147,83,171,50,46,40,
+40,46,43,174,87,0,0,2,0,100,255,231,8,59,6,141,0,143,0,155,0,0,1,22,21,20,
+6,35,34,38,38,39,46,2,35,34,6,7,1,6,6,21,20,22,51,50,55,51,30,2,51,50,54,
+54,53,52,38,39,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,38,53,52,
+54,55,55,62,2,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,54,51,50,22,22,23,
+55,54,54,51,50,22,22,23,30,2,51,50,54,53,52,39,6,35,35,53,51,50,54,54,53,
+52,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,54,
+51,50,22,22,21,20,6,5,50,22,21,20,6,35,34,38,53,52,54,7,22,41,107,101,68,
+95,60,39,43,71,119,89,104,148,54,254,126,48,37,90,78,216,75,71,26,68,107,
+81,68,94,46,60,56,12,45,29,43,60,30,151,156,124,167,36,50,166,124,89,135,
+73,75,82,137,35,33,18,74,75,72,81,17,17,63,87,59,124,94,98,124,58,6,64,82,
+165,102,77,107,68,43,40,59,90,62,70,49,24,16,33,98,125,93,132,87,46,95,71,
+74,76,19,1,45,39,46,44,58,56,48,80,47,53,113,84,101,139,67,138,251,238,54,
+69,68,55,55,67,68,3,230,73,92,125,148,51,75,64,71,85,60,56,54,254,123,49,
+70,38,57,67,224,80,96,48,59,99,60,76,130,31,35,42,91,146,81,194,231,148,128,
+143,133,73,124,75,83,134,83,138,35,39,48,34,56,75,69,62,36,55,31,40,101,128,
+60,112,74,71,107,59,65,83,89,59,86,72,66,77,52,75,72,50,51,1,165,26,90,87,
+51,92,58,66,55,35,30,36,43,52,40,46,51,44,84,59,56,104,68,102,160,89,147,
+159,249,69,52,52,68,68,52,52,69,0,1,0,100,255,231,5,234,6,111,0,120,0,0,1,
+51,21,35,22,22,21,20,6,6,35,34,3,6,6,35,34,38,38,53,52,54,54,55,54,54,53,
+52,38,35,34,6,21,20,22,23,7,38,53,52,54,54,51,50,22,22,21,20,6,6,7,6,6,21,
+20,51,50,55,51,22,22,51,50,54,53,52,38,38,35,35,55,51,54,54,53,52,39,35,35,
+55,51,50,54,54,53,52,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,
+38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,21,20,4,185,249,202,74,76,67,134,
+96,246,88,50,170,134,100,127,56,46,97,84,83,70,74,75,72,81,17,17,63,87,59,
+124,94,101,123,52,45,94,80,83,65,168,216,75,71,35,113,98,100,96,58,118,86,
+126,10,175,27,31,29,9,208,15,201,105,135,91,46,95,71,74,76,19,1,45,39,46,
+44,58,56,48,80,47,53,113,84,101,139,67,143,158,22,2,252,148,56,163,95,85,
+149,93,1,20,144,132,87,134,73,67,108,102,65,64,100,66,56,75,69,62,36,55,31,
+40,101,128,60,112,74,81,123,67,69,112,107,63,65,94,50,137,224,110,114,95,
+86,68,113,68,148,14,46,31,46,38,191,22,86,89,51,92,58,66,55,35,30,36,43,52,
+40,46,51,44,84,59,56,104,68,102,160,89,150,173,25,44,49,56,0,0,3,0,107,254,
+103,6,7,6,111,0,95,0,107,0,120,0,0,1,20,6,6,35,34,38,39,14,2,35,34,38,38,
+53,52,18,54,51,50,22,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,54,55,
+51,22,22,51,50,54,53,52,38,38,39,35,55,51,50,54,55,54,53,52,38,38,35,34,6,
+21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,
+6,7,30,2,1,20,22,51,50,54,53,52,38,35,34,6,1,22,22,21,20,6,35,34,38,53,52,
+54,55,6,6,75,170,135,122,160,42,31,82,129,95,115,178,101,108,191,119,82,110,
+52,119,114,113,122,8,50,51,159,143,121,142,35,71,35,120,105,122,143,112,194,
+120,82,15,201,125,122,35,49,46,95,71,74,76,19,1,45,39,46,44,58,56,48,80,47,
+53,113,84,101,139,67,152,170,102,145,74,251,126,75,68,73,70,71,69,70,76,1,
+226,31,45,53,52,53,55,46,31,1,185,129,209,128,145,131,89,119,68,121,234,163,
+192,1,45,168,78,132,81,133,155,145,127,42,34,65,195,122,176,179,106,118,110,
+114,142,134,133,209,124,11,191,27,32,46,92,51,92,58,66,55,35,30,36,43,52,
+40,46,51,44,84,59,56,104,68,102,160,89,155,175,20,46,167,198,1,72,57,66,68,
+56,51,72,69,252,87,83,171,50,46,40,40,46,43,174,87,0,1,0,100,255,231,5,242,
+6,111,0,127,0,0,1,22,21,20,6,6,35,34,38,39,22,6,6,7,6,6,21,20,51,50,55,51,
+30,2,51,50,54,53,52,38,39,54,54,51,50,22,21,20,6,6,35,34,3,6,6,35,34,38,38,
+53,52,54,54,55,54,54,53,52,38,35,34,6,21,20,22,23,7,38,53,52,54,54,51,50,
+22,22,23,30,2,51,50,54,53,52,38,39,35,55,51,50,54,55,54,53,52,38,38,35,34,
+6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,21,
+20,6,4,148,16,51,99,68,98,163,82,4,44,82,71,83,65,168,216,75,71,24,61,101,
+76,117,111,55,57,12,45,29,61,65,51,132,114,246,88,50,170,134,100,127,56,46,
+97,84,83,70,74,75,72,81,17,17,63,87,59,124,94,75,111,74,48,45,64,92,61,63,
+81,9,6,201,15,201,125,122,35,49,46,95,71,74,76,19,1,45,39,46,44,58,56,48,
+80,47,53,113,84,101,139,67,165,3,175,48,68,58,105,66,137,151,86,122,90,56,
+66,93,50,137,224,74,96,54,113,85,60,102,45,35,42,179,125,92,175,122,1,20,
+144,132,87,134,73,67,108,102,65,64,100,66,56,75,69,62,36,55,31,40,101,128,
+60,112,74,55,79,66,61,70,48,63,47,14,32,8,191,27,32,46,92,51,92,58,66,55,
+36,30,37,43,52,40,46,51,44,84,59,56,104,68,102,160,89,161,176,0,0,3,0,111,
+254,103,9,173,6,111,0,100,0,112,0,124,0,0,1,20,6,35,34,38,39,6,6,35,34,38,
+39,6,6,35,34,0,53,52,54,55,33,55,33,50,54,54,53,52,38,35,34,6,21,20,23,54,
+54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,22,21,20,7,
+22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,21,20,7,22,22,51,50,54,
+53,52,38,39,38,53,52,54,51,50,22,18,5,52,38,35,34,6,21,20,22,51,50,54,1,22,
+22,21,20,6,35,34,53,52,54,55,9,173,192,167,110,162,76,41,161,117,109,162,
+76,65,232,161,243,254,220,140,122,255,0,15,2,118,146,128,57,117,95,74,76,
+19,2,43,40,46,44,58,56,77,98,138,112,101,139,67,131,155,129,143,25,58,138,
+95,123,142,166,204,12,37,37,69,196,143,8,61,145,104,123,142,166,204,12,37,
+37,69,196,143,250,87,214,167,171,214,204,178,179,205,3,16,31,45,53,52,108,
+46,31,1,196,222,255,118,114,109,123,117,113,108,122,1,27,234,155,225,67,191,
+40,87,70,89,112,66,55,33,30,35,42,52,40,46,51,103,84,100,128,102,160,89,145,
+180,24,67,231,157,94,81,62,69,144,130,150,198,71,36,47,48,64,173,254,226,
+163,65,48,72,81,144,130,150,198,71,36,47,48,64,173,254,226,52,169,209,209,
+169,175,202,202,254,105,83,171,50,46,40,86,43,174,87,0,0,2,0,90,254,211,8,
+210,6,135,0,142,0,155,0,0,1,22,21,20,6,6,35,34,38,38,39,46,2,35,34,7,22,21,
+20,6,7,22,22,21,20,6,35,34,38,53,54,54,53,52,39,6,6,35,34,38,38,53,52,54,
+54,51,50,22,23,54,54,53,52,38,38,35,34,6,21,35,52,38,35,34,6,21,20,23,7,38,
+38,53,52,54,54,51,50,22,23,54,54,51,50,22,23,54,54,51,50,22,22,23,30,2,51,
+50,54,53,52,39,6,35,35,53,51,50,54,54,53,52,38,38,35,34,6,21,20,23,54,54,
+51,50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,1,38,38,35,34,
+6,6,21,20,22,51,50,54,7,206,46,66,113,69,82,95,45,24,20,39,76,64,154,6,7,
+57,52,61,68,79,63,67,73,72,56,39,76,189,92,104,150,78,72,138,96,103,189,78,
+41,43,49,92,62,80,90,109,110,101,101,102,33,64,39,40,81,137,82,105,141,32,
+23,120,74,87,135,40,28,116,85,69,84,42,23,21,35,66,55,74,85,25,33,36,17,28,
+102,129,80,46,95,71,74,76,19,1,45,39,46,44,58,56,48,80,47,53,113,84,101,139,
+67,134,251,106,61,160,87,52,81,44,96,107,84,143,3,222,76,97,79,124,70,63,
+89,75,67,80,54,165,49,65,124,218,90,92,205,88,82,95,87,69,4,66,64,90,89,92,
+101,76,133,83,80,126,71,98,85,59,148,83,87,138,79,108,98,96,110,83,67,53,
+53,40,43,97,62,79,135,79,99,86,88,97,92,90,85,97,63,89,75,68,79,54,82,65,
+51,52,3,181,25,86,86,51,92,58,66,55,35,30,36,43,52,40,46,51,44,84,59,56,104,
+68,102,160,89,135,164,253,37,73,86,36,60,36,61,70,54,0,0,2,0,112,255,231,
+5,232,7,23,0,108,0,120,0,0,1,20,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,
+38,38,53,52,54,51,23,6,6,21,20,22,23,22,22,21,20,6,35,34,38,53,55,6,6,21,
+20,22,51,50,54,55,51,22,51,50,54,53,52,38,38,35,55,50,54,53,52,38,35,35,55,
+50,54,54,53,52,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,54,
+51,50,22,22,21,20,6,7,22,22,21,20,6,7,22,22,1,34,6,21,20,22,51,50,54,53,52,
+38,5,230,170,140,129,174,41,53,161,123,110,187,110,159,128,68,85,188,157,
+18,84,96,49,44,106,134,113,108,108,116,3,43,53,161,143,121,142,35,71,72,200,
+84,98,72,153,115,16,97,116,99,78,7,25,132,133,66,117,95,74,76,18,6,80,46,
+44,58,56,77,98,138,112,101,139,67,115,119,58,66,114,94,135,181,252,53,63,
+70,68,62,66,63,64,1,75,161,195,146,130,151,125,135,232,140,195,1,52,56,45,
+137,79,125,151,85,18,126,87,57,105,35,4,155,118,127,148,138,121,45,52,161,
+79,160,179,106,118,225,106,87,68,119,74,130,98,88,77,98,168,41,88,68,89,112,
+66,55,33,31,78,52,40,46,51,103,84,100,128,102,160,89,115,172,31,31,103,62,
+83,121,28,25,220,1,177,66,52,54,63,65,53,48,69,0,3,0,111,255,231,4,169,6,
+111,0,50,0,62,0,74,0,0,1,20,6,6,35,34,38,38,53,52,54,55,33,55,33,50,54,54,
+53,52,38,35,34,6,21,22,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,22,21,20,6,7,22,22,7,52,38,35,34,6,21,20,22,51,50,54,37,20,6,35,34,38,
+53,52,54,51,50,22,4,155,122,241,170,163,242,130,140,122,255,0,15,2,118,146,
+128,57,117,95,74,76,1,18,1,45,39,46,44,58,56,77,98,138,112,101,139,67,128,
+157,129,142,151,214,167,171,214,204,178,179,205,254,252,68,55,55,67,68,54,
+54,69,1,236,142,235,140,133,235,149,155,225,67,191,40,87,70,89,112,66,55,
+36,28,36,42,52,40,46,51,103,84,100,128,102,160,89,153,175,22,66,231,86,169,
+209,209,169,175,202,202,185,52,68,68,52,52,69,69,0,0,3,0,111,255,231,5,198,
+6,111,0,57,0,90,0,99,0,0,1,20,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,33,
+55,33,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,
+53,52,54,51,50,22,22,21,20,6,7,22,23,22,22,7,52,39,6,6,35,34,38,53,52,54,
+51,50,23,38,38,35,35,34,6,6,21,20,22,51,50,54,55,51,22,22,51,50,1,34,21,20,
+22,51,50,55,38,5,174,190,169,121,156,52,30,162,117,117,156,73,177,154,254,
+190,14,3,145,146,128,57,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,
+101,139,67,150,163,154,9,60,66,130,30,31,123,93,98,121,121,103,92,68,21,172,
+140,116,152,227,120,114,104,93,114,41,71,36,121,114,252,255,0,127,57,54,141,
+22,61,1,129,192,218,123,151,127,147,118,190,109,180,1,36,75,191,40,87,70,
+89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,166,164,20,
+72,172,58,171,48,77,66,70,88,108,87,87,105,31,87,88,136,225,131,128,135,94,
+130,113,111,2,11,83,34,41,115,43,0,255,255,0,111,254,103,5,198,6,111,2,38,
+1,27,0,0,0,6,1,181,0,0,0,2,0,110,255,231,5,176,6,174,0,41,0,127,0,0,1,33,
+55,33,50,54,55,54,53,52,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,
+34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,1,20,6,35,34,38,53,52,54,54,51,
+50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,38,38,35,
+34,6,7,35,38,38,35,34,6,21,20,22,51,51,23,39,34,6,21,20,22,51,50,55,23,6,
+6,35,34,38,53,52,55,38,38,53,52,54,54,51,50,22,23,54,54,51,50,22,22,3,207,
+252,236,15,3,13,125,122,35,49,46,95,71,74,76,19,1,45,39,46,44,58,56,48,80,
+47,53,113,84,101,139,67,88,193,1,67,183,194,168,173,66,120,79,95,108,100,
+88,15,28,40,45,49,66,76,127,117,122,140,76,132,81,95,135,21,71,32,108,93,
+67,93,80,76,51,15,45,127,119,102,110,92,82,45,50,124,57,161,197,186,72,89,
+81,144,94,119,160,37,32,167,110,124,170,83,3,244,181,27,32,46,92,51,92,58,
+66,55,35,30,36,43,52,40,46,51,44,84,59,56,104,68,102,160,89,119,152,76,253,
+214,230,253,178,153,71,119,69,88,68,72,75,4,69,2,28,22,28,28,71,55,67,66,
+125,133,95,136,70,89,72,80,81,64,62,51,59,87,1,60,73,52,52,24,190,16,19,126,
+135,166,57,25,100,72,77,112,59,100,84,88,96,125,204,0,2,0,110,255,231,4,136,
+6,111,0,80,0,90,0,0,1,20,6,6,35,34,38,38,53,52,55,51,30,2,51,32,17,52,39,
+6,6,35,34,38,53,52,54,54,51,50,23,38,38,39,33,55,33,50,54,55,54,53,52,38,
+38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,
+22,22,21,20,6,7,22,22,23,22,22,37,38,35,34,6,21,20,51,50,54,4,134,117,232,
+165,182,240,112,6,85,2,71,184,164,1,141,60,20,159,125,123,138,68,128,88,94,
+68,21,86,55,253,203,15,2,89,125,122,35,49,46,95,71,74,76,19,1,45,39,46,44,
+58,56,48,80,47,53,113,84,101,139,67,159,178,55,72,11,104,93,254,211,68,97,
+87,79,128,84,116,1,168,127,203,119,137,216,120,50,47,107,157,96,1,21,104,
+67,112,131,118,98,64,95,52,21,51,74,18,191,27,32,46,92,51,92,58,66,55,35,
+30,36,43,52,40,46,51,44,84,59,56,104,68,102,160,89,159,175,18,29,104,61,55,
+177,181,28,55,43,93,86,255,255,0,111,254,103,5,164,6,111,0,38,1,32,0,0,0,
+38,1,181,3,0,0,6,1,182,21,0,0,2,0,111,255,231,5,164,6,111,0,56,0,77,0,0,1,
+20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,33,55,33,50,54,54,53,52,38,
+35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,
+20,6,7,22,18,7,52,38,38,35,34,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,
+5,140,67,155,124,122,146,40,30,162,117,117,156,73,177,154,254,183,15,3,117,
+146,128,57,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,176,
+192,159,185,153,121,229,154,152,227,120,114,104,93,114,41,71,40,112,91,115,
+108,1,136,99,190,128,140,134,127,147,118,190,109,180,1,36,75,191,40,87,70,
+89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,180,164,11,
+71,254,217,130,133,227,136,136,225,131,128,135,94,130,126,98,137,255,255,
+0,111,254,103,5,164,6,111,2,38,1,32,0,0,0,6,1,181,255,0,0,1,0,111,255,150,
+5,31,6,111,0,78,0,0,1,20,6,6,35,34,38,38,39,38,38,35,34,6,21,20,22,23,20,
+35,34,38,38,53,52,54,51,50,22,22,23,22,22,51,50,54,53,52,2,39,33,55,33,50,
+54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,
+51,50,22,22,21,20,6,7,22,18,5,7,53,140,120,83,120,85,66,66,115,72,73,84,98,
+100,89,46,98,64,133,109,61,92,89,85,76,103,69,106,100,252,208,253,209,15,
+2,238,146,128,57,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,
+67,176,192,157,187,1,123,95,182,127,68,102,99,98,96,82,77,84,139,26,136,102,
+189,122,150,184,55,106,118,107,69,131,110,215,1,25,16,191,40,87,70,89,112,
+66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,180,164,11,70,254,
+208,0,3,0,110,255,231,5,123,6,111,0,36,0,48,0,97,0,0,1,33,55,33,50,54,54,
+53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,22,21,20,6,5,50,22,21,20,6,35,34,38,53,52,54,1,20,6,6,35,34,3,6,6,35,34,
+38,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,
+22,51,50,54,53,52,38,39,54,54,51,50,22,3,194,252,182,15,3,67,146,128,57,117,
+95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,206,254,99,54,69,
+68,55,55,67,68,2,163,53,137,118,236,88,46,158,133,146,178,146,119,96,107,
+188,15,68,48,46,65,77,251,215,68,71,36,111,105,115,124,93,79,12,45,29,76,
+110,3,171,191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,
+102,160,89,194,163,81,69,52,52,68,68,52,52,69,254,83,111,203,140,1,20,135,
+141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,
+113,106,163,73,35,42,249,255,255,0,110,254,103,5,123,6,111,2,38,1,35,0,0,
+0,6,1,181,6,0,0,1,0,100,255,231,5,229,6,111,0,95,0,0,1,20,6,35,34,38,39,6,
+6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,54,51,
+50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,38,39,35,55,
+51,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,
+52,54,51,50,22,22,21,20,6,7,22,5,211,198,180,117,184,37,49,164,125,135,164,
+93,134,83,70,74,75,72,81,34,63,87,59,124,94,129,147,97,122,83,65,168,216,
+75,71,37,126,118,132,156,93,174,116,186,15,247,146,128,57,117,95,74,76,19,
+2,44,39,46,44,58,56,77,98,138,112,101,139,67,130,141,253,1,197,225,252,150,
+125,141,135,163,131,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,60,
+112,74,146,125,98,157,96,65,94,50,137,224,116,110,169,161,101,189,125,10,
+191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,
+89,142,167,30,165,0,0,2,0,100,254,103,5,207,6,111,0,96,0,108,0,0,1,20,6,35,
+34,3,6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,
+52,54,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,
+38,35,35,55,51,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,
+35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,18,1,22,22,21,20,6,35,34,53,52,
+54,55,5,159,179,151,246,88,50,170,134,100,127,56,93,134,83,70,74,75,72,81,
+34,63,87,59,124,94,129,147,97,122,83,65,168,216,75,71,41,123,98,107,116,130,
+221,131,3,15,225,146,128,57,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,
+112,101,139,67,171,189,144,168,253,132,31,45,53,52,108,46,31,1,142,192,231,
+1,20,144,132,87,134,73,92,146,104,64,100,66,56,75,69,62,60,62,40,101,128,
+60,112,74,146,125,98,157,96,65,94,50,137,224,127,97,141,135,141,217,119,191,
+40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,177,
+165,13,69,254,220,253,169,83,171,50,46,40,86,43,174,87,0,0,1,0,100,255,231,
+8,41,6,111,0,107,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,
+54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,50,
+54,53,52,2,39,33,55,33,50,54,54,53,52,38,35,34,6,21,22,23,54,54,51,50,22,
+21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,18,21,7,22,22,51,50,54,
+53,52,38,39,38,53,52,54,51,50,22,18,8,41,192,167,108,160,74,37,154,122,123,
+152,39,46,158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,
+71,40,111,90,116,109,253,205,253,68,15,3,111,146,128,57,117,95,74,76,1,18,
+1,45,39,46,44,58,56,77,98,138,112,101,139,67,170,189,159,186,3,60,144,102,
+123,142,166,204,12,37,37,69,196,143,1,196,222,255,114,109,100,123,141,135,
+135,141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,127,97,
+137,122,205,1,17,16,191,40,87,70,89,112,66,55,36,28,36,42,52,40,46,51,103,
+84,100,128,102,160,89,176,165,13,70,254,215,183,58,70,78,144,130,150,198,
+71,36,47,48,64,173,254,226,0,2,0,107,255,231,9,153,6,111,0,94,0,106,0,0,1,
+20,6,35,34,38,39,6,35,34,38,39,6,6,35,34,38,2,53,16,0,51,50,18,17,20,7,22,
+22,51,50,54,53,52,2,39,35,55,51,50,54,54,53,52,38,35,34,6,21,20,23,54,54,
+51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,18,21,20,7,22,
+22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,18,5,52,38,35,34,6,21,20,22,
+51,50,54,9,153,192,167,110,161,76,88,254,130,190,86,61,225,132,162,215,101,
+1,1,219,222,255,17,75,155,113,122,143,237,189,82,15,196,146,128,57,117,95,
+74,76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,150,167,143,178,6,60,
+146,103,123,142,166,204,12,37,37,69,196,143,250,39,199,176,175,203,209,171,
+170,203,1,196,222,255,117,114,231,140,132,140,132,164,1,11,158,1,15,1,63,
+254,196,254,238,100,83,97,98,142,134,195,1,9,17,191,40,87,70,89,112,66,55,
+34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,168,163,20,64,254,228,156,
+52,51,71,81,144,130,150,198,71,36,47,48,64,173,254,226,55,180,203,199,173,
+174,211,203,0,2,0,111,255,231,4,169,6,111,0,50,0,62,0,0,1,20,6,6,35,34,38,
+38,53,52,54,55,33,55,33,50,54,54,53,52,38,35,34,6,21,22,23,54,54,51,50,22,
+21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,22,7,52,38,35,34,6,21,
+20,22,51,50,54,4,155,122,241,170,163,242,130,140,122,255,0,15,2,118,146,128,
+57,117,95,74,76,1,18,1,45,39,46,44,58,56,77,98,138,112,101,139,67,128,157,
+129,142,151,214,167,171,214,204,178,179,205,1,236,142,235,140,133,235,149,
+155,225,67,191,40,87,70,89,112,66,55,36,28,36,42,52,40,46,51,103,84,100,128,
+102,160,89,153,175,22,66,231,86,169,209,209,169,175,202,202,0,0,2,0,107,255,
+231,5,244,6,111,0,71,0,83,0,0,1,22,22,21,16,0,33,32,0,17,52,54,54,51,50,22,
+21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,38,39,35,55,51,50,54,
+54,53,52,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,22,21,20,6,5,20,22,51,50,54,53,52,38,35,34,6,4,237,64,68,254,190,254,194,
+254,200,254,178,109,192,119,117,133,119,114,113,122,13,60,56,1,26,1,0,1,5,
+1,32,137,101,145,30,153,146,128,57,117,95,74,76,18,10,76,46,44,58,56,77,98,
+138,112,101,139,67,121,252,17,75,68,73,70,71,69,70,76,3,186,66,187,100,254,
+211,254,187,1,71,1,50,164,247,135,155,136,133,155,145,127,57,37,64,149,103,
+209,225,206,187,112,207,36,191,40,87,70,89,112,66,55,33,29,76,52,40,46,51,
+103,84,100,128,102,160,89,148,166,119,57,66,68,56,51,72,69,0,0,1,0,110,255,
+231,5,165,6,111,0,83,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,
+2,39,33,55,33,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,
+34,38,53,52,54,51,50,22,22,21,20,6,7,22,18,5,151,67,155,124,123,152,39,46,
+158,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,40,111,
+90,116,109,253,205,253,68,15,3,111,146,128,57,117,95,74,76,19,2,44,39,46,
+44,58,56,77,98,138,112,101,139,67,170,189,159,186,1,136,99,190,128,141,135,
+135,141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,127,97,
+137,122,205,1,17,16,191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,
+84,100,128,102,160,89,176,165,13,70,254,215,0,0,2,0,105,255,231,4,228,6,111,
+0,74,0,90,0,0,1,20,0,33,34,38,53,16,33,51,50,54,53,52,38,35,34,6,21,20,23,
+53,52,54,51,50,22,21,20,6,35,34,38,53,52,55,35,55,33,50,54,54,53,52,38,35,
+34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,
+6,7,22,22,7,16,37,22,21,20,6,35,35,34,6,21,20,33,50,36,4,202,254,182,254,
+205,230,254,1,128,34,126,113,105,94,80,93,23,57,45,50,56,74,69,79,104,48,
+228,15,2,179,146,128,57,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,
+101,139,67,147,158,132,147,144,254,222,91,168,169,48,124,126,1,73,248,1,1,
+1,233,250,254,248,176,159,1,22,93,91,86,89,74,63,37,23,5,47,48,62,48,56,61,
+105,81,80,50,191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,
+128,102,160,89,165,163,21,62,234,94,1,34,90,62,117,121,144,64,79,164,194,
+0,3,0,100,255,114,5,198,6,111,0,36,0,48,0,105,0,0,1,33,55,33,50,54,54,53,
+52,38,35,34,6,21,22,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,
+22,21,20,6,5,50,22,21,20,6,35,34,38,53,52,54,1,39,6,35,34,3,6,6,35,34,38,
+53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,
+51,50,55,3,55,19,54,53,52,38,39,54,54,51,50,22,21,20,6,7,23,3,188,252,178,
+15,3,71,146,128,57,117,95,74,76,1,18,1,45,39,46,44,58,56,77,98,138,112,101,
+139,67,206,254,95,54,69,68,55,55,67,68,2,115,104,66,90,236,88,46,158,133,
+146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,105,48,
+39,201,70,231,52,93,79,12,45,29,76,110,32,32,149,3,171,191,40,87,70,89,112,
+66,55,36,28,36,42,52,40,46,51,103,84,100,128,102,160,89,194,163,81,69,52,
+52,68,68,52,52,69,252,24,172,55,1,20,135,141,206,165,137,172,103,83,152,29,
+79,14,65,35,44,81,67,191,224,112,112,12,1,77,45,254,200,62,105,106,163,73,
+35,42,249,172,67,152,65,200,0,3,0,100,255,231,4,142,6,111,0,36,0,48,0,85,
+0,0,1,33,55,33,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,
+35,34,38,53,52,54,51,50,22,22,21,20,6,5,50,22,21,20,6,35,34,38,53,52,54,5,
+22,21,20,6,35,34,38,38,39,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,22,
+23,22,22,51,50,54,53,52,38,39,2,215,253,151,15,2,98,146,128,57,117,95,74,
+76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,206,254,89,52,68,68,52,
+53,70,70,2,33,135,120,99,41,60,46,32,67,131,105,127,134,10,86,26,195,166,
+91,121,86,62,21,39,32,66,61,50,48,3,171,191,40,87,70,89,112,66,55,34,30,36,
+42,52,40,46,51,103,84,100,128,102,160,89,194,163,79,71,52,50,70,70,50,52,
+71,44,214,245,172,210,36,60,55,114,84,128,105,58,48,10,80,89,176,208,66,115,
+110,36,29,133,88,114,178,93,0,3,0,111,255,231,5,247,6,111,0,65,0,77,0,89,
+0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,23,38,33,35,55,33,50,54,
+54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,22,22,21,20,6,35,33,22,22,23,54,54,51,50,22,5,52,38,35,34,6,21,20,22,51,
+50,54,37,52,38,35,34,6,21,20,22,51,50,54,5,247,200,174,120,169,41,40,170,
+120,173,200,212,162,135,96,97,254,148,153,15,3,175,146,128,57,117,95,74,76,
+19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,206,233,254,74,88,111,18,
+46,163,105,161,212,252,251,141,109,109,142,142,109,108,142,2,128,141,109,
+109,142,142,109,108,142,1,132,192,221,120,103,103,120,221,192,163,220,80,
+248,191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,
+160,89,194,163,45,178,126,84,97,219,136,103,132,131,104,105,135,134,106,103,
+132,131,104,105,135,134,0,4,0,107,255,231,8,120,6,135,0,85,0,97,0,109,0,139,
+0,0,1,22,21,20,6,35,34,39,22,21,20,2,35,34,38,39,6,6,35,34,2,53,52,18,54,
+51,50,22,21,20,7,51,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,6,35,
+35,53,51,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,
+38,53,52,54,51,50,22,22,21,20,6,5,20,22,51,50,54,53,52,38,35,34,6,5,20,22,
+51,50,54,53,52,38,35,34,6,1,52,38,39,22,21,20,6,35,33,34,38,53,52,55,6,6,
+21,20,22,51,50,54,55,51,22,22,51,50,54,7,141,32,142,106,72,63,7,220,171,131,
+191,28,27,191,132,171,220,112,195,120,116,145,40,186,40,145,116,107,181,58,
+41,80,63,74,85,15,40,57,60,77,101,130,81,117,95,74,76,19,2,44,39,46,44,58,
+56,77,98,138,112,101,139,67,109,249,132,75,68,73,70,71,69,70,76,2,100,70,
+73,68,75,76,70,69,71,1,207,50,44,11,133,122,253,192,122,133,11,44,50,169,
+139,115,130,33,80,33,130,115,139,169,3,243,64,84,117,156,44,53,65,237,254,
+208,158,133,132,159,1,49,236,181,1,35,166,154,121,84,59,59,84,121,154,134,
+119,71,58,82,65,41,37,4,161,25,86,86,89,112,66,55,34,30,36,42,52,40,46,51,
+103,84,100,128,102,160,89,130,150,177,57,66,68,56,51,72,69,54,56,68,66,57,
+55,69,72,254,182,90,166,63,41,38,118,120,120,118,38,41,63,166,90,182,217,
+117,107,107,117,217,0,0,3,0,82,255,231,5,4,6,111,0,82,0,92,0,104,0,0,1,20,
+6,7,22,21,20,33,34,38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,34,38,53,
+52,55,6,21,20,22,22,23,22,22,23,36,53,52,39,7,35,55,51,50,54,54,53,52,38,
+35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,
+20,6,7,22,22,37,20,51,50,54,53,52,38,35,34,1,52,38,35,34,6,21,20,22,51,50,
+54,4,239,189,172,51,254,242,126,139,68,189,215,203,164,118,120,110,104,103,
+109,15,97,51,142,134,111,136,49,1,64,220,57,48,15,41,146,128,57,117,95,74,
+76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,108,126,104,109,252,107,
+124,61,62,63,58,126,1,242,81,72,77,77,78,74,75,80,2,184,145,148,27,65,95,
+241,123,107,94,53,6,208,179,181,228,139,113,118,137,125,112,58,32,80,118,
+73,94,59,11,10,28,28,29,204,167,67,1,191,40,87,70,89,112,66,55,34,30,36,42,
+52,40,46,51,103,84,100,128,102,160,89,140,164,32,39,140,116,101,55,48,43,
+58,253,18,55,57,61,53,51,60,58,0,3,0,107,255,231,8,120,6,135,0,115,0,127,
+0,139,0,0,1,22,21,20,6,35,34,39,22,21,20,2,35,34,38,39,6,6,35,34,2,53,52,
+18,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,54,55,51,22,22,
+51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,
+54,53,52,39,6,35,35,53,51,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,
+22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,5,20,22,51,50,54,53,52,38,
+35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,7,141,32,142,106,72,63,7,220,171,
+131,191,28,27,191,132,171,220,112,195,120,116,145,140,103,115,132,11,44,50,
+169,139,115,130,33,80,33,130,115,139,169,50,44,11,131,116,103,140,145,116,
+107,181,58,41,80,63,74,85,15,40,57,60,77,101,130,81,117,95,74,76,19,2,44,
+39,46,44,58,56,77,98,138,112,101,139,67,109,249,132,75,68,73,70,71,69,70,
+76,3,130,76,70,69,71,70,73,68,75,3,243,64,84,117,156,44,53,65,237,254,208,
+158,133,132,159,1,49,236,181,1,35,166,154,121,123,169,128,110,38,41,63,166,
+90,182,217,117,107,107,117,217,182,90,166,63,41,38,109,129,169,123,121,154,
+134,119,71,58,82,65,41,37,4,161,25,86,86,89,112,66,55,34,30,36,42,52,40,46,
+51,103,84,100,128,102,160,89,130,150,177,57,66,68,56,51,72,69,55,55,69,72,
+51,56,68,66,0,0,4,0,110,254,103,11,205,6,111,0,40,0,185,0,197,0,210,0,0,1,
+33,55,33,50,54,55,54,53,52,38,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,
+35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,1,20,6,6,35,34,38,38,53,52,54,
+54,51,50,22,21,20,6,35,34,38,53,53,6,6,21,20,22,51,50,54,53,52,38,38,35,34,
+7,6,6,21,20,23,22,21,20,6,35,34,38,38,39,22,21,20,6,6,35,34,38,39,6,6,35,
+34,38,38,53,52,54,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,51,
+50,54,55,51,22,22,51,50,54,53,52,38,38,39,55,30,2,51,50,54,53,52,38,39,54,
+54,51,50,22,22,21,20,6,35,34,39,22,22,51,50,54,54,53,52,39,38,53,52,54,54,
+51,50,22,18,37,50,22,21,20,6,35,34,38,53,52,54,19,22,22,21,20,6,35,34,38,
+53,52,54,55,3,199,252,177,15,3,72,125,122,35,49,46,95,71,74,76,19,1,45,39,
+46,44,58,56,48,80,47,53,113,84,101,139,67,206,7,29,87,176,128,94,140,75,63,
+106,61,74,80,62,59,52,61,28,27,108,106,136,155,102,177,112,215,88,30,27,2,
+2,114,121,119,186,152,80,1,53,137,118,122,160,42,46,158,133,103,146,75,64,
+120,81,96,107,98,90,15,33,35,48,46,65,77,251,107,141,35,71,36,111,105,115,
+124,30,62,55,86,54,82,91,53,63,71,90,86,7,43,31,46,88,55,121,104,21,24,91,
+218,118,74,70,17,2,3,111,208,143,152,224,120,247,65,54,69,68,55,55,67,68,
+73,31,45,53,52,53,55,46,31,3,171,191,27,32,46,92,51,92,58,66,55,35,30,36,
+43,52,40,46,51,44,84,59,56,104,68,102,160,89,179,178,254,86,159,242,137,85,
+153,98,81,122,66,78,64,52,68,55,57,11,22,52,34,78,86,179,163,146,199,99,153,
+52,140,120,27,68,80,49,144,147,115,216,169,15,31,111,203,140,145,131,135,
+141,101,169,101,87,141,81,103,83,77,90,14,79,7,37,35,35,44,81,67,191,108,
+116,112,112,132,113,61,96,90,61,75,64,78,43,70,59,73,89,9,44,55,84,138,76,
+118,140,3,131,160,68,100,83,16,56,126,40,145,217,119,153,254,223,146,69,52,
+52,68,68,52,52,69,252,147,83,171,50,46,40,40,46,43,174,87,0,0,2,0,100,255,
+231,11,157,6,141,0,208,0,220,0,0,1,20,6,6,35,34,38,38,53,52,54,54,51,50,22,
+21,20,6,35,34,38,53,53,6,6,21,20,22,51,50,54,53,52,38,38,35,34,7,6,6,21,20,
+6,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,55,55,62,2,53,52,
+38,35,34,6,21,20,22,23,7,38,53,52,54,54,51,50,22,22,23,55,54,54,51,50,22,
+22,23,30,2,51,50,54,53,52,39,6,35,35,53,51,50,54,54,53,52,38,38,35,34,6,21,
+20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,
+7,22,21,20,6,35,34,38,38,39,46,2,35,34,6,7,1,6,6,21,20,22,51,50,55,51,30,
+2,51,50,54,54,53,52,38,39,54,54,51,50,22,22,21,20,7,22,22,51,50,54,54,53,
+53,52,54,54,51,50,22,18,37,50,22,21,20,6,35,34,38,53,52,54,11,157,87,176,
+128,94,140,75,63,106,61,74,80,62,59,52,61,28,27,108,106,136,155,102,177,112,
+215,88,30,27,45,141,135,112,214,79,24,147,123,124,167,36,50,166,124,89,135,
+73,75,82,137,35,33,18,74,75,72,81,17,17,63,87,59,124,94,98,124,58,6,64,82,
+165,102,77,107,68,43,40,59,90,62,70,49,24,16,33,98,125,93,132,87,46,95,71,
+74,76,19,1,45,39,46,44,58,56,48,80,47,53,113,84,101,139,67,138,155,41,107,
+101,68,95,60,39,43,71,119,89,104,148,54,254,126,48,37,90,78,216,75,71,26,
+68,107,81,68,94,46,60,56,12,45,29,43,60,30,1,80,193,93,102,105,34,111,208,
+143,152,224,120,248,2,54,69,68,55,55,67,68,2,1,159,242,137,85,153,98,81,122,
+66,78,64,52,68,55,57,11,22,52,34,78,86,179,163,146,199,99,153,52,140,120,
+146,221,148,153,125,130,148,148,128,143,133,73,124,75,83,134,83,138,35,39,
+48,34,56,75,69,62,36,55,31,40,101,128,60,112,74,71,107,59,65,83,89,59,86,
+72,66,77,52,75,72,50,51,1,165,26,90,87,51,92,58,66,55,35,30,36,43,52,40,46,
+51,44,84,59,56,104,68,102,160,89,147,159,22,73,92,125,148,51,75,64,71,85,
+60,56,54,254,123,49,70,38,57,67,224,80,96,48,59,99,60,76,130,31,35,42,91,
+146,81,22,10,81,103,95,166,131,97,145,217,119,153,254,223,59,69,52,52,68,
+68,52,52,69,0,3,0,111,254,103,12,103,6,111,0,129,0,141,0,153,0,0,1,20,2,35,
+34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,
+38,35,34,7,6,6,21,23,16,35,34,39,6,6,35,34,38,39,6,6,35,34,0,53,52,54,55,
+33,55,33,50,54,54,53,52,38,35,34,6,21,22,23,54,54,51,50,22,21,20,6,35,34,
+38,53,52,54,51,50,22,22,21,20,6,7,22,22,21,20,7,22,22,51,50,54,53,52,38,39,
+38,53,52,54,51,50,22,18,21,20,7,22,51,50,54,54,53,39,52,18,51,50,0,5,52,38,
+35,34,6,21,20,22,51,50,54,1,22,22,21,20,6,35,34,53,52,54,55,12,103,208,183,
+140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,211,180,215,88,30,27,
+4,235,174,149,42,160,117,109,162,76,65,232,161,243,254,220,140,122,255,0,
+15,2,118,146,128,57,117,95,74,76,1,18,1,45,39,46,44,58,56,77,98,138,112,101,
+139,67,131,155,129,143,25,58,138,95,123,142,166,204,12,37,37,69,196,143,8,
+130,146,63,63,18,5,250,212,232,1,8,247,157,214,167,171,214,204,178,179,205,
+3,16,31,45,53,52,108,46,31,2,1,254,254,228,184,152,118,151,78,64,52,68,55,
+57,11,43,65,78,86,179,163,207,237,153,52,140,120,224,254,221,231,108,123,
+117,113,108,122,1,27,234,155,225,67,191,40,87,70,89,112,66,55,36,28,36,42,
+52,40,46,51,103,84,100,128,102,160,89,145,180,24,67,231,157,94,81,62,69,144,
+130,150,198,71,36,47,48,64,173,254,226,163,65,48,153,68,104,77,238,222,1,
+3,254,170,249,169,209,209,169,175,202,202,254,105,83,171,50,46,40,86,43,174,
+87,0,0,2,0,90,254,211,12,81,6,135,0,211,0,224,0,0,1,20,6,6,35,34,38,38,53,
+52,54,54,51,50,22,21,20,6,35,34,38,53,53,6,6,21,20,22,51,50,54,53,52,38,38,
+35,34,7,6,6,21,20,23,22,21,20,6,35,34,38,2,3,39,46,2,35,34,7,22,21,20,6,7,
+22,22,21,20,6,35,34,38,53,54,54,53,52,39,6,6,35,34,38,38,53,52,54,54,51,50,
+22,23,54,54,53,52,38,38,35,34,6,21,35,52,38,35,34,6,21,20,23,7,38,38,53,52,
+54,54,51,50,22,23,54,54,51,50,22,23,54,54,51,50,22,22,23,30,2,51,50,54,53,
+52,39,6,35,35,53,51,50,54,54,53,52,38,38,35,34,6,21,20,23,54,54,51,50,22,
+21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,21,20,6,6,35,34,
+39,22,22,51,50,54,54,53,52,39,38,53,52,54,54,51,50,22,18,1,38,38,35,34,6,
+6,21,20,22,51,50,54,12,81,87,176,128,94,140,75,63,106,61,74,80,62,59,52,61,
+28,27,108,106,136,155,102,177,112,215,88,30,27,2,2,114,121,105,175,156,70,
+15,21,38,76,64,154,6,7,57,52,61,68,79,63,67,73,72,56,39,76,189,92,104,150,
+78,72,138,96,103,189,78,41,43,49,92,62,80,90,109,110,101,101,102,33,64,39,
+40,81,137,82,105,141,32,23,120,74,87,135,40,28,116,85,69,84,42,23,21,35,66,
+55,74,85,25,33,36,17,28,102,129,80,46,95,71,74,76,19,1,45,39,46,44,58,56,
+48,80,47,53,113,84,101,139,67,134,126,46,66,113,69,54,40,70,184,100,63,63,
+18,2,3,111,208,143,152,224,120,247,101,61,160,87,52,81,44,96,107,84,143,2,
+1,159,242,137,85,153,98,81,122,66,78,64,52,68,55,57,11,22,52,34,78,86,179,
+163,146,199,99,153,52,140,120,27,68,80,49,144,147,142,1,74,1,22,47,68,78,
+54,165,49,65,124,218,90,92,205,88,82,95,87,69,4,66,64,90,89,92,101,76,133,
+83,80,126,71,98,85,59,148,83,87,138,79,108,98,96,110,83,67,53,53,40,43,97,
+62,79,135,79,99,86,88,97,92,90,85,97,63,89,75,68,79,54,82,65,51,52,3,181,
+25,86,86,51,92,58,66,55,35,30,36,43,52,40,46,51,44,84,59,56,104,68,102,160,
+89,135,164,31,76,97,79,124,70,14,170,202,68,104,77,16,56,126,40,145,217,119,
+153,254,223,254,90,73,86,36,60,36,61,70,54,0,3,0,110,254,205,10,216,6,111,
+0,36,0,139,0,151,0,0,1,33,55,33,50,54,54,53,52,38,35,34,6,21,20,23,54,54,
+51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,1,20,2,35,34,38,53,
+52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,38,35,34,
+2,17,23,16,2,35,34,0,3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,39,54,53,52,
+38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,39,54,54,51,50,22,21,
+20,6,6,35,34,39,22,22,51,50,54,53,39,16,0,51,50,22,18,37,50,22,21,20,6,35,
+34,38,53,52,54,3,194,252,182,15,3,67,146,128,57,117,95,74,76,19,2,44,39,46,
+44,58,56,77,98,138,112,101,139,67,206,6,45,208,183,140,169,132,98,74,80,62,
+59,52,61,55,108,106,136,155,211,180,201,226,1,234,232,203,254,200,104,46,
+161,133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,36,111,
+105,115,124,93,79,12,45,29,76,110,53,137,118,69,60,75,170,105,213,235,4,1,
+15,245,169,225,106,248,54,54,69,68,55,55,67,68,3,171,191,40,87,70,89,112,
+66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,194,163,254,86,254,
+254,228,184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,207,237,
+254,254,254,228,69,254,177,254,196,1,37,1,14,135,146,206,165,137,172,103,
+83,152,29,79,14,65,35,44,81,67,191,224,112,112,132,113,106,163,73,35,42,249,
+172,110,199,135,39,74,68,248,231,199,1,26,1,56,185,254,220,181,69,52,52,68,
+68,52,52,69,0,255,255,0,110,254,103,10,216,6,111,2,38,1,55,0,0,0,6,1,181,
+6,0,0,1,0,100,255,231,10,238,6,111,0,137,0,0,1,20,2,35,34,38,53,52,54,51,
+50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,38,35,34,7,6,6,21,
+23,16,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,
+39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,52,2,39,33,55,
+33,50,54,54,53,52,38,35,34,6,21,22,23,54,54,51,50,22,21,20,6,35,34,38,53,
+52,54,51,50,22,22,21,20,6,7,22,18,21,7,22,51,50,54,54,53,39,52,18,51,50,0,
+10,238,208,183,140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,211,180,
+215,88,30,27,4,235,90,161,77,37,154,122,123,152,39,46,158,133,146,178,146,
+119,96,107,188,15,68,48,46,65,77,251,215,68,71,40,111,90,116,109,253,205,
+253,68,15,3,111,146,128,57,117,95,74,76,1,18,1,45,39,46,44,58,56,77,98,138,
+112,101,139,67,170,189,159,186,3,134,149,63,63,18,5,250,212,232,1,8,2,1,254,
+254,228,184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,207,237,
+153,52,140,120,224,254,221,107,118,100,125,141,135,135,141,206,165,137,172,
+103,83,152,29,79,14,65,35,44,81,67,191,224,127,97,137,122,205,1,17,16,191,
+40,87,70,89,112,66,55,36,28,36,42,52,40,46,51,103,84,100,128,102,160,89,176,
+165,13,70,254,215,183,64,142,68,104,77,238,222,1,3,254,170,0,2,0,107,255,
+231,12,76,6,111,0,123,0,135,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,
+35,34,38,53,53,6,21,20,22,51,50,54,53,52,38,35,34,7,6,6,21,23,16,35,34,39,
+6,35,34,38,39,6,6,35,34,38,2,53,16,0,51,50,18,17,20,7,22,22,51,50,54,53,52,
+2,39,35,55,51,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,6,35,
+34,38,53,52,54,51,50,22,22,21,20,6,7,22,18,21,20,7,22,51,50,54,54,53,39,52,
+18,51,50,0,5,52,38,35,34,6,21,20,22,51,50,54,12,76,208,183,140,169,132,98,
+74,80,62,59,52,61,55,108,106,136,155,211,180,215,88,30,27,4,235,181,143,90,
+243,130,190,86,61,225,132,162,215,101,1,1,219,222,255,17,75,155,113,122,143,
+237,189,82,15,196,146,128,57,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,
+112,101,139,67,150,167,143,178,10,129,143,63,63,18,5,250,212,232,1,8,247,
+116,199,176,175,203,209,171,170,203,2,1,254,254,228,184,152,118,151,78,64,
+52,68,55,57,11,43,65,78,86,179,163,207,237,153,52,140,120,224,254,221,210,
+210,140,132,140,132,164,1,11,158,1,15,1,63,254,196,254,238,100,83,97,98,142,
+134,195,1,9,17,191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,
+128,102,160,89,168,163,20,64,254,228,156,68,57,130,68,104,77,238,222,1,3,
+254,170,252,180,203,199,173,174,211,203,0,0,1,0,110,254,204,10,211,6,111,
+0,136,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,
+22,51,50,54,53,52,38,35,34,2,17,23,16,2,35,34,0,3,6,6,35,34,38,53,52,54,51,
+50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,51,50,55,51,22,22,51,50,54,53,
+52,2,39,33,55,33,50,54,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,
+6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,18,21,20,6,6,35,34,39,22,22,
+51,50,54,53,39,16,0,51,50,22,18,10,211,208,183,140,169,132,98,74,80,62,59,
+52,61,55,108,106,136,155,211,180,201,226,1,234,232,203,254,202,104,46,158,
+133,146,178,146,119,96,107,188,15,68,48,46,65,77,251,215,68,71,40,111,90,
+116,109,253,205,253,68,15,3,111,146,128,57,117,95,74,76,19,2,44,39,46,44,
+58,56,77,98,138,112,101,139,67,170,189,159,186,66,153,122,70,59,75,170,105,
+213,235,4,1,15,245,169,225,106,2,0,254,254,228,184,152,118,151,78,64,52,68,
+55,57,11,43,65,78,86,179,163,207,237,254,254,254,228,69,254,177,254,196,1,
+33,1,14,135,141,206,165,137,172,103,83,152,29,79,14,65,35,44,81,67,191,224,
+127,97,137,122,205,1,17,16,191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,
+51,103,84,100,128,102,160,89,176,165,13,70,254,215,183,98,185,124,39,75,68,
+248,231,199,1,26,1,56,185,254,220,0,4,0,107,255,231,11,235,6,135,0,142,0,
+154,0,166,0,196,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,
+53,6,21,20,22,51,50,54,53,52,38,35,34,7,6,6,21,23,20,6,35,34,38,39,6,6,35,
+34,38,39,6,6,35,34,2,53,52,18,54,51,50,22,21,20,7,51,38,53,52,54,51,50,22,
+23,22,22,51,50,54,53,52,39,6,35,35,53,51,50,54,54,53,52,38,35,34,6,21,20,
+23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,21,20,
+6,35,34,39,22,21,20,7,22,22,51,50,54,53,39,52,18,51,50,0,37,20,22,51,50,54,
+53,52,38,35,34,6,5,20,22,51,50,54,53,52,38,35,34,6,1,52,38,39,22,21,20,6,
+35,33,34,38,53,52,55,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,11,235,208,
+183,140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,211,180,215,88,30,
+27,4,154,131,111,198,69,48,181,114,131,191,28,27,191,132,171,220,112,195,
+120,116,145,40,186,40,145,116,107,181,58,41,80,63,74,85,15,40,57,60,77,101,
+130,81,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,109,126,
+32,142,106,72,63,7,14,79,159,91,88,106,5,250,212,232,1,8,245,164,75,68,73,
+70,71,69,70,76,2,100,70,73,68,75,76,70,69,71,1,207,50,44,11,133,122,253,192,
+122,133,11,44,50,169,139,115,130,33,80,33,130,115,139,169,2,1,254,254,228,
+184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,207,237,153,52,140,
+120,224,134,157,139,128,125,142,158,133,132,159,1,49,236,181,1,35,166,154,
+121,84,59,59,84,121,154,134,119,71,58,82,65,41,37,4,161,25,86,86,89,112,66,
+55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,130,150,29,64,84,117,
+156,44,53,65,79,75,88,88,137,112,238,222,1,3,254,170,51,57,66,68,56,51,72,
+69,54,56,68,66,57,55,69,72,254,182,90,166,63,41,38,118,120,120,118,38,41,
+63,166,90,182,217,117,107,107,117,217,0,3,0,82,255,231,9,217,6,111,0,135,
+0,145,0,157,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,
+6,21,20,22,51,50,54,53,52,38,35,34,7,6,6,21,23,16,33,34,38,39,21,20,33,34,
+38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,
+22,23,22,22,23,36,53,52,39,7,35,55,51,50,54,54,53,52,38,35,34,6,21,20,23,
+54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,22,22,21,20,
+6,7,22,51,50,54,54,53,3,52,18,51,50,0,37,20,51,50,54,53,52,38,35,34,1,52,
+38,35,34,6,21,20,22,51,50,54,9,217,208,183,140,169,132,98,74,80,62,59,52,
+61,55,108,106,136,155,211,180,215,88,30,27,4,254,245,115,221,118,254,242,
+126,139,68,189,215,203,164,118,120,110,104,103,109,15,97,51,142,134,111,136,
+49,1,64,220,57,48,15,41,146,128,57,117,95,74,76,19,2,44,39,46,44,58,56,77,
+98,138,112,101,139,67,108,126,104,109,185,170,245,238,78,77,22,5,250,212,
+232,1,8,247,129,124,61,62,63,58,126,1,242,81,72,77,77,78,74,75,80,2,1,254,
+254,228,184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,207,237,
+153,52,140,120,224,254,223,126,119,6,241,123,107,94,53,6,208,179,181,228,
+139,113,118,137,125,112,58,32,80,118,73,94,59,11,10,28,28,29,204,167,67,1,
+191,40,87,70,89,112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,
+89,140,164,32,39,140,85,144,147,28,192,53,94,83,1,2,222,1,3,254,170,85,101,
+55,48,43,58,253,18,55,57,61,53,51,60,58,0,3,0,107,255,231,11,235,6,135,0,
+172,0,184,0,196,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,
+53,6,21,20,22,51,50,54,53,52,38,35,34,7,6,6,21,23,20,6,35,34,38,39,6,6,35,
+34,38,39,6,6,35,34,2,53,52,18,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,
+20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,22,21,20,6,35,34,38,53,52,
+54,51,50,22,23,22,22,51,50,54,53,52,39,6,35,35,53,51,50,54,54,53,52,38,35,
+34,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,22,21,20,
+6,7,22,21,20,6,35,34,39,22,21,20,7,22,22,51,50,54,53,39,52,18,51,50,0,37,
+20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,11,235,
+208,183,140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,211,180,215,88,
+30,27,4,154,131,111,198,69,48,181,114,131,191,28,27,191,132,171,220,112,195,
+120,116,145,140,103,115,132,11,44,50,169,139,115,130,33,80,33,130,115,139,
+169,50,44,11,131,116,103,140,145,116,107,181,58,41,80,63,74,85,15,40,57,60,
+77,101,130,81,117,95,74,76,19,2,44,39,46,44,58,56,77,98,138,112,101,139,67,
+109,126,32,142,106,72,63,7,14,79,159,91,88,106,5,250,212,232,1,8,245,164,
+75,68,73,70,71,69,70,76,3,130,76,70,69,71,70,73,68,75,2,1,254,254,228,184,
+152,118,151,78,64,52,68,55,57,11,43,65,78,86,179,163,207,237,153,52,140,120,
+224,134,157,139,128,125,142,158,133,132,159,1,49,236,181,1,35,166,154,121,
+123,169,128,110,38,41,63,166,90,182,217,117,107,107,117,217,182,90,166,63,
+41,38,109,129,169,123,121,154,134,119,71,58,82,65,41,37,4,161,25,86,86,89,
+112,66,55,34,30,36,42,52,40,46,51,103,84,100,128,102,160,89,130,150,29,64,
+84,117,156,44,53,65,79,75,88,88,137,112,238,222,1,3,254,170,51,57,66,68,56,
+51,72,69,55,55,69,72,51,56,68,66,0,1,0,100,255,231,8,228,6,89,0,127,0,0,1,
+20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,
+53,52,46,2,35,35,22,21,20,6,6,7,22,21,20,7,51,21,35,22,22,21,20,6,35,34,3,
+6,6,35,34,38,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,
+54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,53,52,38,35,35,55,
+51,54,53,52,39,35,55,33,50,54,54,53,52,39,33,55,33,50,30,2,8,228,208,183,
+140,169,132,98,74,80,62,59,52,61,55,108,106,136,155,73,141,180,155,121,54,
+74,146,123,18,26,249,202,74,76,164,133,246,88,50,170,134,100,127,56,93,134,
+83,70,74,75,72,81,34,63,87,59,124,94,129,147,97,122,83,65,168,216,75,71,35,
+113,98,196,142,120,126,10,175,58,28,218,15,1,67,111,89,41,43,254,79,15,2,
+149,176,212,164,78,3,232,248,254,230,184,152,118,151,78,64,52,68,55,57,11,
+43,65,78,86,176,157,111,172,115,39,102,105,97,120,69,2,40,44,56,35,148,56,
+163,95,143,184,1,20,144,132,87,134,73,92,146,104,64,100,66,56,75,69,62,60,
+62,40,101,128,60,112,74,146,125,98,157,96,65,94,50,137,224,110,114,181,113,
+136,148,30,61,46,38,191,33,67,54,76,74,191,66,173,231,0,0,2,0,112,255,231,
+8,237,7,12,0,128,0,140,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,20,6,35,34,
+38,53,53,6,21,20,22,51,50,54,53,52,46,2,35,35,22,21,20,6,7,22,22,21,20,6,
+7,22,22,21,20,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,38,38,53,52,54,51,
+23,6,6,21,20,22,23,22,22,21,20,6,35,34,38,53,55,6,6,21,20,22,51,50,54,55,
+51,22,51,50,54,53,52,38,38,35,55,50,54,53,52,38,35,35,55,51,50,54,54,53,52,
+39,33,55,33,50,30,2,1,34,6,21,20,22,51,50,54,53,52,38,8,237,208,183,140,169,
+132,98,74,80,62,59,52,61,55,108,106,136,155,73,141,180,155,121,54,149,124,
+50,56,114,94,135,181,170,140,129,174,41,53,161,123,110,187,110,159,128,68,
+85,188,157,18,84,96,49,44,106,134,113,108,108,116,3,43,53,161,143,121,142,
+35,71,72,200,84,98,72,153,115,16,97,116,99,78,1,18,134,109,89,43,43,254,245,
+15,1,239,176,212,164,78,249,46,63,70,68,62,66,63,64,4,155,248,254,230,184,
+152,118,151,78,64,52,68,55,57,11,43,65,78,86,176,157,111,172,115,39,102,105,
+111,143,17,31,97,57,83,121,28,25,220,142,161,195,146,130,151,125,135,232,
+140,195,1,52,56,45,137,79,125,151,85,18,126,87,57,105,35,4,155,118,127,148,
+138,121,45,52,161,79,160,179,106,118,225,106,87,68,119,74,130,98,88,77,98,
+179,31,67,56,76,74,191,66,173,231,254,84,66,52,54,63,65,53,48,69,0,0,2,0,
+110,255,231,8,237,6,153,0,55,0,134,0,0,1,20,2,35,34,38,53,52,54,51,50,22,
+21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,46,2,35,35,22,21,20,6,6,
+35,33,55,33,50,54,54,53,52,39,33,55,33,50,30,2,1,20,6,35,34,38,53,52,54,51,
+50,22,21,20,6,7,39,54,54,53,52,35,34,6,21,20,51,50,54,53,52,38,35,34,6,7,
+35,38,38,35,34,6,21,20,22,51,51,23,39,34,6,21,20,51,50,55,23,6,35,34,38,53,
+52,55,38,38,53,52,54,51,50,22,23,54,54,51,50,22,22,8,237,208,183,140,169,
+132,98,74,80,62,59,52,61,55,108,106,136,155,73,141,180,155,121,54,83,148,
+122,251,251,15,3,244,107,88,46,43,254,79,15,2,149,176,212,164,78,252,195,
+183,194,168,173,148,117,95,108,100,88,15,28,40,94,66,76,244,122,140,158,131,
+95,135,21,71,32,108,93,67,93,80,76,51,15,45,127,119,212,92,82,45,109,122,
+161,197,186,72,89,174,145,119,160,37,32,167,110,124,170,83,4,40,248,254,230,
+184,152,118,151,78,64,52,68,55,57,11,43,65,78,86,176,157,111,172,115,39,102,
+105,96,119,64,181,30,67,58,76,74,191,66,173,231,253,7,230,253,178,153,111,
+148,88,68,72,75,4,69,2,28,22,56,71,55,133,125,133,137,164,89,72,80,81,64,
+62,51,59,87,1,60,73,104,24,190,35,126,135,166,57,25,100,72,113,135,100,84,
+88,96,125,204,0,0,1,255,209,255,231,3,75,4,106,0,39,0,0,1,20,2,35,34,38,53,
+52,54,51,50,22,21,20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,46,2,35,35,
+55,51,50,30,2,3,75,208,183,140,169,132,98,74,80,62,59,52,61,55,108,106,136,
+155,73,141,180,155,241,15,245,176,212,164,78,1,249,248,254,230,184,152,118,
+151,78,64,52,68,55,57,11,43,65,78,86,176,157,111,172,115,39,191,66,173,231,
+0,1,254,243,1,214,4,13,6,89,0,53,0,0,1,20,2,35,34,38,53,52,54,51,50,22,21,
+20,6,35,34,38,53,53,6,21,20,22,51,50,54,53,52,46,2,35,35,22,21,16,33,35,55,
+51,50,54,54,53,52,39,33,55,33,50,30,2,4,13,208,183,140,169,132,98,74,80,62,
+59,52,61,55,108,106,136,155,73,141,180,155,121,54,254,159,82,5,75,109,89,
+43,43,254,79,15,2,149,176,212,164,78,3,232,248,254,230,184,152,118,151,78,
+64,52,68,55,57,11,43,65,78,86,176,157,111,172,115,39,102,105,254,224,191,
+31,67,56,76,74,191,66,173,231,0,0,2,254,58,254,167,1,198,255,106,0,11,0,23,
+0,0,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,
+254,58,58,43,41,56,57,40,43,58,2,198,58,43,41,56,57,40,43,58,248,45,53,54,
+44,45,52,53,44,45,53,54,44,45,52,53,0,2,254,58,254,47,1,138,255,106,0,11,
+0,23,0,0,5,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,
+38,254,58,58,43,41,56,57,40,43,58,2,138,58,43,41,56,57,40,43,58,248,45,53,
+54,44,45,52,53,76,45,53,54,44,45,52,53,0,3,0,116,253,63,4,46,6,52,0,45,0,
+57,0,113,0,0,1,52,39,33,55,33,50,54,54,53,52,39,55,22,21,20,6,6,35,22,21,
+20,7,33,21,35,34,39,22,22,21,20,6,35,34,38,53,52,55,6,35,35,55,33,54,54,23,
+34,6,21,20,22,51,50,54,53,52,38,1,20,7,35,54,53,52,39,6,6,35,34,39,6,6,35,
+34,38,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,51,50,55,
+51,22,51,50,54,53,52,38,39,54,54,51,50,18,2,60,28,254,84,15,2,40,125,101,
+47,113,77,150,99,158,137,18,20,1,130,42,143,48,80,92,220,195,183,218,172,
+53,127,56,10,1,129,23,35,18,125,144,137,131,139,133,147,1,97,9,97,6,4,24,
+78,48,162,57,31,108,90,98,122,109,82,64,73,80,58,9,46,32,26,41,38,75,64,159,
+40,49,39,131,64,85,64,50,7,44,24,88,77,3,77,57,37,191,34,73,55,112,125,59,
+158,192,117,133,49,46,50,54,40,148,4,37,150,95,163,185,190,158,186,96,4,148,
+9,52,207,121,103,95,110,116,89,102,122,251,123,90,61,45,44,50,37,35,40,187,
+92,95,138,113,89,120,71,55,52,66,5,54,10,44,22,30,56,43,50,60,132,132,75,
+71,67,111,36,22,28,254,198,0,0,3,0,116,253,63,4,43,4,106,0,34,0,46,0,102,
+0,0,1,52,39,33,55,33,21,35,22,21,20,7,33,21,35,34,39,22,22,21,20,6,35,34,
+38,53,52,55,6,35,35,55,33,54,54,23,34,6,21,20,22,51,50,54,53,52,38,1,20,7,
+35,54,53,52,39,6,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,
+53,52,38,35,34,6,21,20,22,51,50,55,51,22,51,50,54,53,52,38,39,54,54,51,50,
+18,2,60,28,254,84,15,2,155,122,18,20,1,130,42,143,48,80,92,220,195,183,218,
+172,53,127,56,10,1,129,23,35,18,125,144,137,131,139,133,147,1,97,9,97,6,4,
+24,78,48,162,57,31,108,90,98,122,109,82,64,73,80,58,9,46,32,26,41,38,75,64,
+159,40,49,39,131,64,85,64,50,7,44,24,88,77,3,77,57,37,191,191,46,50,54,40,
+148,4,37,150,95,163,185,190,158,186,96,4,148,9,52,207,121,103,95,110,116,
+89,102,122,251,123,90,61,45,44,50,37,35,40,187,92,95,138,113,89,120,71,55,
+52,66,5,54,10,44,22,30,56,43,50,60,132,132,75,71,67,111,36,22,28,254,198,
+0,4,0,116,253,63,6,123,5,168,0,55,0,65,0,77,0,133,0,0,1,51,50,22,21,20,6,
+35,34,38,39,33,22,21,20,7,33,21,35,34,39,22,22,21,20,6,35,34,38,53,52,55,
+6,35,35,55,33,54,54,53,52,39,33,55,33,54,54,51,50,22,23,7,38,35,34,6,3,22,
+22,51,50,54,53,52,38,35,1,34,6,21,20,22,51,50,54,53,52,38,1,20,7,35,54,53,
+52,39,6,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,
+35,34,6,21,20,22,51,50,55,51,22,51,50,54,53,52,38,39,54,54,51,50,18,4,173,
+12,181,171,119,96,123,125,4,254,94,18,20,1,130,42,143,48,80,92,220,195,183,
+218,172,53,127,56,10,1,129,23,35,28,254,84,15,3,197,11,152,126,114,140,20,
+86,47,142,72,100,21,1,65,89,55,65,87,84,253,63,125,144,137,131,139,133,147,
+1,97,9,97,6,4,24,78,48,162,57,31,108,90,98,122,109,82,64,73,80,58,9,46,32,
+26,41,38,75,64,159,40,49,39,131,64,85,64,50,7,44,24,88,77,4,106,138,146,117,
+142,172,180,46,50,54,40,148,4,37,150,95,163,185,190,158,186,96,4,148,9,52,
+35,57,37,191,150,168,139,129,12,130,88,254,241,94,109,54,48,59,42,254,176,
+121,103,95,110,116,89,102,122,251,123,90,61,45,44,50,37,35,40,187,92,95,138,
+113,89,120,71,55,52,66,5,54,10,44,22,30,56,43,50,60,132,132,75,71,67,111,
+36,22,28,254,198,0,4,0,119,253,63,4,43,5,143,0,42,0,53,0,65,0,121,0,0,19,
+35,55,33,54,54,53,52,39,22,21,20,35,34,38,53,52,54,51,50,22,22,21,20,7,55,
+51,21,35,34,39,22,22,21,20,6,35,34,38,53,52,55,6,1,52,38,35,34,6,21,20,51,
+50,54,19,52,38,35,34,6,21,20,22,51,50,54,19,20,7,35,54,53,52,39,6,6,35,34,
+39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,
+22,51,50,55,51,22,51,50,54,53,52,38,39,54,54,51,50,18,175,56,10,1,197,100,
+124,103,15,214,102,125,151,124,111,160,83,101,114,141,42,143,48,80,92,220,
+195,183,218,172,53,1,68,67,62,65,60,126,61,67,235,147,124,125,144,137,131,
+139,133,206,9,97,6,4,24,78,48,162,57,31,108,90,98,122,109,82,64,73,80,58,
+9,46,32,26,41,38,75,64,159,40,49,39,131,64,85,64,50,7,44,24,88,77,2,89,148,
+34,149,93,144,75,42,46,227,133,107,112,142,110,182,104,172,109,3,148,4,37,
+150,95,163,185,190,158,186,96,4,2,63,43,56,56,39,100,52,253,15,102,122,121,
+103,95,110,116,252,180,90,61,45,44,50,37,35,40,187,92,95,138,113,89,120,71,
+55,52,66,5,54,10,44,22,30,56,43,50,60,132,132,75,71,67,111,36,22,28,254,198,
+0,3,0,115,253,63,4,137,6,111,0,76,0,90,0,151,0,0,1,20,6,6,35,35,22,21,20,
+7,33,21,35,34,38,39,22,22,21,20,6,6,35,34,38,38,53,52,55,6,35,35,55,33,54,
+54,53,52,38,39,33,55,33,50,54,55,54,53,52,38,38,35,34,6,21,20,23,54,54,51,
+50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,22,22,1,34,6,6,21,20,22,51,50,
+54,53,52,38,38,1,20,7,35,54,53,52,39,6,6,35,34,38,39,6,6,35,34,38,38,53,52,
+54,54,51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,22,51,50,54,55,51,22,
+22,51,50,54,53,52,38,39,54,54,51,50,18,4,137,83,192,164,46,18,20,1,130,42,
+61,94,36,80,92,87,186,142,127,181,93,172,53,127,56,10,1,129,23,35,15,13,254,
+83,16,2,87,125,122,35,49,46,95,71,74,76,19,1,45,39,46,44,58,56,48,80,47,53,
+113,84,101,139,67,253,197,85,121,63,137,131,139,133,68,122,1,140,9,97,6,4,
+24,78,48,83,109,27,31,108,90,69,100,51,49,87,55,64,73,80,58,9,46,32,26,41,
+38,75,64,69,108,22,49,20,88,62,64,85,64,50,7,44,24,88,77,5,16,124,156,77,
+46,50,54,40,148,1,3,37,150,95,97,157,94,91,158,99,186,96,4,148,9,52,35,27,
+50,17,191,27,32,46,92,51,92,58,66,55,35,30,36,43,52,40,46,51,44,84,59,56,
+104,68,102,160,252,242,56,101,67,95,110,116,89,69,101,54,251,123,90,61,45,
+44,50,37,35,40,98,89,92,95,68,114,69,58,95,56,71,55,52,66,5,54,10,44,22,30,
+56,43,50,60,59,73,67,65,75,71,67,111,36,22,28,254,198,255,255,0,100,251,246,
+5,126,4,130,2,38,0,44,0,0,0,7,0,108,4,158,0,0,255,255,0,100,251,246,5,126,
+4,130,2,38,0,155,0,0,0,7,0,108,4,158,0,0,255,255,0,100,251,246,7,197,5,168,
+2,38,0,191,0,0,0,7,0,108,4,158,0,0,255,255,0,100,251,246,5,126,5,153,2,38,
+0,230,0,0,0,7,0,108,4,158,0,0,255,255,0,100,251,246,5,242,6,111,2,38,1,22,
+0,0,0,7,0,108,4,158,0,0,0,2,0,240,252,208,4,16,1,142,0,39,0,51,0,0,1,20,2,
+35,34,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,
+54,53,52,38,39,39,52,54,51,50,22,18,5,20,22,51,50,54,53,52,38,35,34,6,4,16,
+247,203,159,191,89,142,77,103,129,99,95,95,101,7,75,132,116,180,191,181,192,
+3,58,46,95,172,104,253,190,63,57,61,58,59,58,58,64,254,253,250,254,205,209,
+177,111,172,94,137,106,111,129,117,110,32,32,69,104,102,116,222,202,179,245,
+49,26,45,66,181,254,209,210,47,55,56,47,42,60,58,0,2,0,240,252,210,6,179,
+1,158,0,70,0,82,0,0,5,20,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,
+53,6,21,20,22,51,50,54,53,52,33,33,22,17,20,2,35,34,38,53,52,54,54,51,50,
+22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,54,53,52,2,39,54,54,51,33,50,
+22,1,20,22,51,50,54,53,52,38,35,34,6,6,179,172,135,118,154,120,89,67,73,56,
+54,47,55,50,100,85,96,120,254,193,254,126,121,247,203,159,191,89,142,77,103,
+129,99,95,95,101,7,75,132,116,180,191,196,177,4,49,58,2,89,204,231,251,27,
+63,57,61,58,59,58,58,64,13,173,219,164,128,105,139,70,59,48,61,50,52,10,38,
+60,62,74,120,96,253,200,254,215,250,254,205,209,177,111,172,94,137,106,111,
+129,117,110,32,32,69,104,102,116,222,202,187,1,3,47,68,63,226,254,30,47,55,
+56,47,42,60,58,0,0,2,0,240,252,208,4,8,1,117,0,50,0,62,0,0,1,20,2,35,34,38,
+53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,54,53,52,
+38,39,54,54,53,52,38,39,39,52,54,51,50,22,21,20,6,7,22,5,20,22,51,50,54,53,
+52,38,35,34,6,4,6,218,179,173,220,89,142,77,103,129,99,95,95,101,7,35,40,
+133,144,150,170,68,60,52,61,65,49,1,59,42,63,79,68,74,140,253,200,63,57,61,
+58,59,58,58,64,254,192,220,254,236,227,180,105,162,89,137,106,111,129,117,
+110,34,33,28,81,46,103,136,178,157,82,153,51,34,91,44,50,78,4,9,30,48,97,
+75,54,105,42,133,163,47,55,56,47,42,60,58,0,2,0,240,252,254,3,97,0,131,0,
+28,0,40,0,0,5,21,35,39,22,22,21,20,6,35,34,38,53,52,55,7,35,53,33,54,53,52,
+39,51,22,21,20,6,7,23,52,38,35,34,6,21,20,22,51,50,54,3,97,28,83,37,44,155,
+134,125,154,84,79,32,1,3,102,33,122,27,70,61,146,101,82,78,101,100,79,85,
+98,251,120,1,28,90,49,107,126,129,104,102,65,1,120,86,135,83,78,58,72,69,
+133,50,233,59,76,76,59,60,64,66,0,2,0,240,252,213,4,190,0,131,0,63,0,74,0,
+0,19,52,54,51,50,22,23,54,53,52,38,35,34,6,21,20,23,54,54,51,50,22,21,20,
+35,34,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,54,53,52,38,39,38,53,52,
+54,51,50,22,18,21,16,33,34,38,39,6,35,34,38,37,38,38,35,34,6,21,20,22,51,
+50,240,98,86,60,101,68,40,96,74,46,58,15,2,39,29,34,39,93,60,79,102,85,115,
+134,31,25,60,101,58,105,90,135,115,8,30,24,54,133,92,254,253,73,124,80,88,
+146,94,110,1,107,56,85,39,42,42,54,54,91,253,138,71,91,42,44,73,88,107,108,
+44,40,30,17,26,28,40,31,81,89,73,85,105,184,154,48,115,46,36,30,131,125,168,
+239,29,19,23,30,35,156,254,250,150,254,138,57,65,122,95,92,45,44,41,30,35,
+41,0,0,1,254,26,253,41,0,120,255,120,0,17,0,0,1,52,54,51,50,22,21,21,35,53,
+52,38,35,34,6,21,21,35,254,26,167,138,139,162,127,77,97,103,75,127,253,180,
+204,248,245,207,139,127,162,211,204,161,135,0,0,2,0,240,251,210,5,134,0,131,
+0,74,0,83,0,0,1,20,6,35,34,39,23,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,21,20,6,7,39,54,53,52,38,35,34,6,21,20,51,50,54,55,51,22,22,51,50,
+54,53,52,38,39,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,54,54,51,
+50,22,1,22,21,20,35,34,53,52,55,5,134,85,66,71,48,1,44,104,84,65,106,30,34,
+113,94,104,127,104,85,70,86,77,68,11,49,35,32,36,46,159,77,99,25,54,26,78,
+74,68,81,134,116,8,30,24,58,148,46,21,56,57,38,47,63,52,4,31,23,57,77,253,
+89,54,75,77,55,254,234,81,100,54,32,81,175,124,106,91,96,101,148,117,98,123,
+75,58,56,69,5,57,12,45,25,32,56,50,126,75,84,80,79,116,127,163,245,28,19,
+23,30,35,183,170,68,60,51,42,51,65,5,32,39,124,253,165,142,74,62,62,54,162,
+0,0,2,253,102,252,211,0,150,255,180,0,73,0,85,0,0,1,52,54,55,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,55,54,54,51,50,22,21,20,
+6,7,38,38,35,34,6,7,7,6,21,20,22,51,50,54,55,51,22,51,50,54,53,52,39,54,54,
+51,50,22,21,20,6,35,34,39,6,6,35,34,38,1,52,54,51,50,22,21,20,6,35,34,38,
+253,126,47,51,86,28,25,46,47,41,45,22,50,54,96,77,89,84,6,40,59,97,58,61,
+71,37,34,5,62,46,37,67,40,223,46,49,46,56,89,22,44,42,122,64,69,60,4,29,20,
+38,41,101,85,153,55,31,104,78,82,103,1,144,46,37,37,47,44,40,38,45,253,128,
+51,81,52,87,28,39,30,35,47,40,37,40,36,30,63,80,67,87,89,59,40,59,49,69,49,
+34,49,9,41,55,33,40,223,46,45,35,39,66,64,130,59,55,85,34,21,27,120,80,111,
+132,172,89,83,95,1,73,32,41,41,32,32,40,40,0,0,1,252,250,252,211,0,70,0,131,
+0,72,0,0,19,35,22,21,20,6,35,34,39,6,6,35,34,38,53,52,54,55,54,53,52,38,35,
+34,6,21,20,22,23,7,38,53,52,54,51,50,22,21,20,6,7,6,21,20,22,51,50,54,55,
+51,22,51,50,54,53,52,38,39,35,55,51,54,53,52,38,39,51,22,21,20,6,7,51,70,
+129,97,96,88,153,56,31,105,83,91,96,67,85,94,44,48,45,50,11,13,40,56,86,86,
+84,93,65,76,83,49,45,66,94,22,45,37,116,58,62,87,80,73,7,75,120,18,18,122,
+30,80,68,195,254,109,60,133,94,123,172,90,82,99,74,63,96,63,69,74,36,47,44,
+39,22,30,22,24,63,78,67,96,94,75,63,105,61,69,51,30,34,64,61,125,51,41,59,
+90,7,102,118,142,38,97,37,66,81,73,147,65,0,3,252,169,251,209,0,150,0,131,
+0,51,0,63,0,72,0,0,19,20,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,
+6,35,34,38,53,52,55,6,21,20,22,51,50,54,55,51,22,22,51,50,54,53,52,38,39,
+38,53,52,54,51,50,22,18,37,20,22,51,50,54,53,52,38,35,34,6,1,22,21,20,35,
+34,53,52,55,150,112,139,168,64,33,109,99,129,152,166,133,87,88,87,81,81,86,
+5,62,117,89,86,102,25,50,26,85,76,86,106,135,115,8,30,24,54,133,92,252,219,
+54,48,53,50,51,49,50,55,1,90,53,74,78,56,254,75,163,217,197,96,101,171,172,
+195,238,118,90,95,111,103,91,29,27,77,158,106,109,76,84,79,81,126,117,168,
+239,29,19,23,30,35,156,254,250,38,41,47,49,40,36,51,50,253,187,147,70,62,
+62,64,153,0,0,1,253,102,252,203,0,150,255,171,0,76,0,0,1,52,54,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,22,22,51,50,54,55,23,20,
+6,35,34,38,39,22,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,54,
+53,52,38,39,54,51,50,22,21,20,6,35,34,39,6,6,35,34,38,253,125,66,75,51,43,
+45,46,45,51,21,38,54,88,74,40,79,59,70,110,62,69,99,40,26,111,93,78,165,58,
+17,8,66,64,38,34,48,46,61,89,21,44,16,90,64,59,74,32,37,15,38,37,41,82,102,
+153,54,27,106,75,86,100,253,121,61,100,58,39,62,41,35,47,43,39,35,40,25,63,
+79,73,86,32,33,39,43,57,58,11,91,105,74,54,21,38,26,57,87,52,31,47,28,34,
+42,63,62,62,63,61,50,38,55,25,47,119,78,93,148,171,83,88,98,0,3,250,92,251,
+206,0,150,255,159,0,61,0,73,0,82,0,0,19,20,6,35,34,38,39,6,35,34,38,39,6,
+6,35,34,38,53,52,54,51,50,22,21,20,7,22,51,50,54,53,52,38,39,38,53,52,54,
+51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,38,53,52,54,51,50,22,22,5,
+52,38,35,34,6,21,20,22,51,50,54,1,22,21,20,35,34,53,52,55,150,131,110,73,
+110,50,57,156,74,109,50,44,155,107,167,201,208,160,152,204,16,83,121,76,81,
+121,115,8,24,25,46,131,96,5,39,108,60,92,76,123,115,8,24,25,46,132,96,252,
+34,131,105,109,138,129,117,105,132,2,32,50,69,73,52,254,10,152,178,79,76,
+155,79,77,72,84,183,153,146,190,186,140,60,52,72,98,74,103,120,38,27,39,32,
+42,115,191,109,34,40,40,44,91,81,101,123,37,18,48,32,42,110,186,68,94,116,
+121,95,94,109,117,254,252,133,70,58,58,62,141,0,0,2,252,191,251,246,0,150,
+255,176,0,75,0,86,0,0,23,20,6,7,39,54,53,52,38,35,34,7,22,21,20,7,22,22,21,
+20,6,35,34,38,53,54,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,
+35,34,6,21,35,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,23,54,54,51,50,23,
+54,54,51,50,22,1,50,55,38,38,35,34,6,21,20,22,150,25,22,48,22,54,47,91,10,
+4,67,46,52,52,43,44,48,48,37,37,48,121,61,95,116,105,92,124,105,47,63,62,
+48,53,69,69,64,57,74,21,51,47,111,87,132,45,14,77,47,113,53,18,74,54,72,86,
+253,159,103,69,38,99,52,51,55,65,253,39,76,24,25,31,37,40,43,89,28,40,152,
+119,64,146,63,55,62,58,45,3,44,43,72,65,60,66,102,84,77,94,105,73,105,83,
+75,54,48,48,54,54,41,36,31,26,68,79,89,114,118,56,62,114,53,61,95,254,1,59,
+39,45,38,32,36,37,0,0,2,0,240,252,211,4,210,0,131,0,54,0,66,0,0,1,20,6,35,
+34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,55,6,21,20,22,51,
+50,54,55,51,22,51,50,54,53,52,38,35,55,50,54,53,52,39,51,22,21,20,6,7,22,
+37,20,22,51,50,54,53,52,38,35,34,6,4,210,122,96,187,66,36,114,105,120,148,
+168,112,86,106,86,81,81,89,4,43,100,79,77,123,26,53,55,143,62,60,118,90,15,
+70,75,92,141,57,66,60,188,252,233,52,47,50,47,48,47,48,53,253,191,101,135,
+209,103,106,184,149,151,225,117,94,96,111,105,91,46,52,115,81,105,84,85,169,
+66,55,69,93,81,98,73,109,120,91,107,79,127,30,81,69,41,47,49,40,36,54,51,
+0,0,3,253,164,252,242,0,120,255,146,0,12,0,24,0,36,0,0,1,52,54,51,50,22,21,
+20,6,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,37,52,54,51,50,22,21,20,
+6,35,34,38,253,164,208,160,152,204,81,161,114,167,201,2,92,131,105,109,138,
+129,117,105,132,254,182,47,42,42,47,47,42,43,46,254,66,146,190,186,140,93,
+158,95,183,188,94,116,121,95,94,109,117,102,35,45,45,35,36,45,45,0,3,0,240,
+252,254,4,54,255,152,0,20,0,51,0,60,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,54,51,50,22,23,22,7,52,39,6,6,35,34,38,53,52,54,51,50,23,38,38,35,34,
+6,21,20,22,51,50,54,55,51,22,51,50,54,39,34,21,20,22,51,50,55,38,4,54,116,
+101,89,93,26,18,103,71,99,122,113,196,118,142,177,5,87,89,9,14,80,55,61,80,
+72,61,50,44,21,134,95,131,176,64,57,64,65,20,43,43,135,68,70,156,78,35,33,
+86,14,39,253,235,114,123,87,80,76,91,142,113,118,188,105,121,101,78,71,26,
+26,37,47,75,52,52,65,21,47,56,159,121,67,80,70,65,135,74,211,50,21,25,70,
+26,0,0,4,253,80,251,233,0,150,255,152,0,20,0,51,0,60,0,69,0,0,19,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,54,51,50,22,23,22,7,52,39,6,6,35,34,38,53,
+52,54,51,50,23,38,38,35,34,6,21,20,22,51,50,54,55,51,22,51,50,54,39,34,21,
+20,22,51,50,55,38,3,22,21,20,35,34,53,52,55,150,116,101,89,93,26,18,103,71,
+99,122,113,196,118,142,177,5,87,89,9,14,80,55,61,80,72,61,50,44,21,134,95,
+131,176,64,57,64,65,20,43,43,135,68,70,156,78,35,33,86,14,39,207,53,74,78,
+56,253,235,114,123,87,80,76,91,142,113,118,188,105,121,101,78,71,26,26,37,
+47,75,52,52,65,21,47,56,159,121,67,80,70,65,135,74,211,50,21,25,70,26,254,
+67,147,70,62,62,64,153,0,1,253,24,252,176,0,150,255,175,0,76,0,0,1,52,54,
+55,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,21,20,6,35,39,54,53,52,38,35,34,6,21,20,22,51,50,54,53,52,38,35,34,6,7,
+35,38,35,34,6,21,20,22,51,51,23,34,6,21,20,51,50,55,23,6,35,34,38,253,24,
+84,73,134,126,96,74,103,28,19,98,72,107,148,135,120,100,121,101,79,69,73,
+73,66,10,45,33,27,36,42,77,69,77,93,105,88,57,81,15,42,50,108,53,64,59,47,
+30,13,90,91,121,61,52,29,82,67,102,131,253,120,77,105,25,50,116,83,111,78,
+67,65,80,207,160,186,211,133,108,90,121,76,53,57,61,49,10,43,23,30,54,44,
+50,66,119,100,114,137,57,49,106,53,46,36,48,68,71,58,82,15,148,24,111,0,0,
+2,0,240,253,115,4,117,255,143,0,14,0,26,0,0,19,33,38,53,52,54,51,50,22,21,
+20,6,6,35,33,1,52,38,35,34,6,21,20,22,51,50,54,252,1,226,32,116,102,100,121,
+70,129,144,253,210,3,40,68,62,54,69,60,64,65,64,254,20,70,77,106,126,145,
+114,83,138,60,1,21,55,59,59,54,50,65,63,0,4,0,240,251,233,4,65,255,143,0,
+19,0,35,0,47,0,56,0,0,19,52,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,
+34,38,37,51,22,51,50,53,52,38,35,34,6,21,20,22,51,50,3,52,54,51,50,22,21,
+20,6,35,34,38,19,52,55,51,22,21,20,35,34,240,116,193,112,116,196,116,115,
+97,81,102,30,24,106,77,104,113,1,134,69,34,106,128,166,140,132,168,65,54,
+119,23,45,39,41,45,45,41,39,45,8,56,43,53,74,78,254,28,112,169,90,92,170,
+112,121,146,79,93,83,89,146,146,128,128,118,140,139,114,68,65,1,1,31,41,41,
+31,31,41,41,253,147,64,153,147,70,62,0,2,253,69,253,14,0,150,255,143,0,19,
+0,35,0,0,1,52,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,37,51,22,
+51,50,53,52,38,35,34,6,21,20,22,51,50,253,69,116,193,112,116,196,116,115,
+97,81,102,30,24,106,77,104,113,1,134,69,34,106,128,166,140,132,168,65,54,
+119,254,28,112,169,90,92,170,112,121,146,79,93,83,89,146,146,128,128,118,
+140,139,114,68,65,0,0,3,0,240,251,233,4,65,255,143,0,19,0,35,0,44,0,0,19,
+52,54,54,51,50,22,22,21,20,6,35,34,38,39,6,6,35,34,38,37,51,22,51,50,53,52,
+38,35,34,6,21,20,22,51,50,3,52,55,51,22,21,20,35,34,240,116,193,112,116,196,
+116,115,97,81,102,30,24,106,77,104,113,1,134,69,34,106,128,166,140,132,168,
+65,54,119,15,56,43,53,74,78,254,28,112,169,90,92,170,112,121,146,79,93,83,
+89,146,146,128,128,118,140,139,114,68,65,254,117,64,153,147,70,62,0,2,0,240,
+253,14,4,139,0,211,0,40,0,50,0,0,1,20,6,35,34,38,39,6,35,34,38,53,52,54,51,
+50,22,22,23,54,53,52,38,39,38,53,52,54,51,50,22,21,20,6,7,22,22,51,50,55,
+22,37,38,38,35,34,6,21,20,51,50,4,139,61,54,67,101,61,114,155,145,165,142,
+111,76,108,85,64,135,80,71,8,30,24,66,111,69,67,35,71,51,46,33,30,254,93,
+83,99,67,64,70,184,109,253,111,47,50,89,94,68,137,119,103,125,56,101,97,93,
+172,98,132,18,19,23,30,35,228,131,109,187,67,45,39,25,36,155,130,75,63,51,
+125,0,0,1,0,240,252,204,4,192,0,131,0,51,0,0,19,52,54,51,50,22,21,20,7,39,
+54,53,52,38,35,34,6,21,20,22,51,50,55,51,22,51,50,54,53,52,38,39,38,53,52,
+54,51,50,22,18,21,20,6,35,34,38,39,6,6,35,34,38,240,115,91,73,84,145,12,53,
+37,36,48,48,90,77,183,49,55,50,146,86,75,135,115,8,30,24,54,133,92,125,108,
+80,119,31,34,124,104,113,138,253,235,109,142,83,61,117,24,62,12,49,27,34,
+63,54,65,72,175,175,114,111,168,239,29,19,23,30,35,156,254,250,150,174,209,
+115,100,105,110,160,0,2,0,240,251,223,4,192,0,131,0,51,0,60,0,0,19,52,54,
+51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,50,55,51,22,51,50,54,
+53,52,38,39,38,53,52,54,51,50,22,18,21,20,6,35,34,38,39,6,6,35,34,38,1,52,
+55,51,22,21,20,35,34,240,115,91,73,84,145,12,53,37,36,48,48,90,77,183,49,
+55,50,146,86,75,135,115,8,30,24,54,133,92,125,108,80,119,31,34,124,104,113,
+138,1,178,56,43,53,74,78,253,235,109,142,83,61,117,24,62,12,49,27,34,63,54,
+65,72,175,175,114,111,168,239,29,19,23,30,35,156,254,250,150,174,209,115,
+100,105,110,160,254,177,64,153,147,70,62,0,0,1,0,240,252,214,4,104,0,132,
+0,62,0,0,1,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,
+21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,53,52,38,39,38,53,52,54,51,
+50,22,18,21,16,33,34,38,39,6,6,35,34,38,1,8,69,69,63,51,55,50,43,49,22,45,
+56,97,79,90,106,54,89,44,37,86,129,49,45,21,82,58,101,94,135,115,8,30,24,
+54,133,92,254,253,68,105,26,31,109,85,83,98,253,145,67,89,40,37,48,34,38,
+41,41,36,35,36,24,63,83,68,88,94,79,59,79,55,28,47,34,74,143,67,76,117,120,
+168,239,29,19,23,30,35,156,254,250,150,254,138,95,81,92,84,102,0,2,0,240,
+251,203,4,104,0,132,0,62,0,71,0,0,1,52,54,55,54,54,53,52,38,35,34,6,21,20,
+23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,54,
+53,52,38,39,38,53,52,54,51,50,22,18,21,16,33,34,38,39,6,6,35,34,38,1,52,55,
+51,22,21,20,35,34,1,8,69,69,63,51,55,50,43,49,22,45,56,97,79,90,106,54,89,
+44,37,86,129,49,45,21,82,58,101,94,135,115,8,30,24,54,133,92,254,253,68,105,
+26,31,109,85,83,98,1,72,56,43,53,74,78,253,145,67,89,40,37,48,34,38,41,41,
+36,35,36,24,63,83,68,88,94,79,59,79,55,28,47,34,74,143,67,76,117,120,168,
+239,29,19,23,30,35,156,254,250,150,254,138,95,81,92,84,102,254,205,64,153,
+147,70,62,0,0,2,0,240,252,163,4,88,0,126,0,41,0,52,0,0,1,6,6,35,34,38,53,
+52,54,55,54,54,53,52,38,39,55,22,21,20,6,7,22,22,21,20,6,35,34,38,53,52,55,
+6,6,21,20,22,51,50,54,55,37,20,51,50,54,53,52,38,35,7,6,4,88,48,239,152,197,
+236,188,148,37,38,46,50,23,167,41,39,132,121,131,102,115,106,32,66,79,171,
+146,126,189,96,253,243,133,54,72,99,94,23,43,253,219,142,170,196,164,138,
+190,11,42,63,33,32,59,17,42,31,111,36,67,44,10,115,81,88,111,109,86,52,54,
+30,113,75,103,122,84,98,173,79,52,40,46,55,1,58,0,1,0,240,252,96,3,184,0,
+134,0,68,0,0,1,52,54,55,62,2,53,52,35,34,6,21,20,23,7,38,53,52,54,51,50,22,
+21,20,6,7,6,6,21,20,51,50,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,7,
+39,54,53,52,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,38,1,28,46,74,40,39,
+23,95,43,49,22,45,56,97,79,96,90,57,62,40,36,160,120,120,44,46,46,45,90,70,
+74,92,36,58,17,38,41,35,34,36,38,48,50,186,160,124,145,253,37,47,81,67,37,
+39,46,28,79,41,36,35,36,24,63,83,68,88,100,73,56,87,62,40,53,31,87,101,94,
+56,118,95,95,120,58,73,90,98,79,68,75,21,34,40,37,51,47,33,36,98,82,106,142,
+64,147,170,104,0,0,1,254,79,251,129,2,146,255,49,0,19,0,0,1,55,22,51,50,36,
+18,53,52,38,39,54,51,50,22,21,16,0,33,34,254,79,22,109,140,195,1,77,196,48,
+49,4,71,59,59,254,139,254,192,236,251,212,85,37,149,1,6,163,56,69,20,94,156,
+104,254,197,254,143,0,1,252,242,253,37,0,150,255,125,0,43,0,0,1,52,54,51,
+50,23,54,54,51,50,22,21,20,6,6,35,34,38,53,54,54,53,52,38,35,34,6,7,35,38,
+38,35,34,6,21,20,22,23,20,6,35,34,38,38,252,242,134,110,157,65,27,120,83,
+105,131,59,81,30,30,39,66,79,80,70,80,94,11,74,12,92,80,72,79,80,65,39,30,
+30,81,59,254,79,137,165,206,96,110,164,132,93,138,73,57,46,17,95,76,68,77,
+104,91,87,108,81,63,76,96,17,47,56,72,136,0,1,0,240,252,211,4,56,0,131,0,
+65,0,0,1,20,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,53,
+52,38,35,34,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,38,39,35,55,33,
+50,54,53,52,38,39,54,54,51,50,21,20,6,7,51,22,22,4,56,112,93,152,53,30,103,
+86,93,118,98,81,61,75,75,58,10,45,29,23,34,38,73,61,143,41,46,22,73,62,58,
+62,65,128,91,184,11,1,26,110,96,35,34,3,30,23,88,103,123,16,93,117,253,203,
+113,135,180,88,92,129,103,93,113,56,53,48,62,5,51,9,40,21,29,50,38,54,60,
+132,70,62,73,59,56,108,74,6,139,53,64,38,55,10,22,25,166,103,122,12,29,165,
+0,0,2,0,240,252,197,3,175,0,161,0,49,0,64,0,0,1,20,6,6,35,34,38,53,52,54,
+54,55,62,2,55,38,35,34,6,21,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,
+50,23,38,39,52,54,51,50,22,21,7,22,22,7,52,39,14,2,7,14,2,21,20,51,50,54,
+3,175,91,180,127,139,166,58,86,73,76,92,72,9,64,82,64,77,2,5,38,28,35,38,
+54,44,60,65,123,95,81,67,7,95,32,27,54,63,1,78,84,103,72,19,79,89,67,49,52,
+34,165,134,162,254,51,97,167,102,111,90,59,80,49,31,33,53,88,64,35,51,43,
+20,26,29,41,31,36,47,66,47,66,83,25,124,57,42,49,155,118,36,52,168,27,104,
+74,63,90,55,33,24,30,41,26,89,150,0,0,1,0,240,252,229,4,138,0,132,0,58,0,
+0,1,39,6,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,53,52,
+38,35,34,6,21,20,22,51,50,55,51,22,51,50,54,53,52,38,38,39,38,53,52,54,51,
+50,22,18,21,20,7,35,54,4,35,1,24,78,48,162,57,31,108,90,98,122,109,82,64,
+73,80,58,9,46,32,26,41,38,75,64,159,40,49,39,131,78,104,47,110,87,8,30,24,
+73,135,83,17,97,11,253,119,30,35,40,187,92,95,138,113,89,120,71,55,52,66,
+5,54,10,44,22,30,56,43,50,60,132,132,77,114,56,155,134,21,19,23,30,35,201,
+254,203,149,132,136,66,0,1,0,240,253,45,3,207,0,131,0,38,0,0,19,52,54,51,
+50,22,23,22,22,51,50,53,52,38,39,38,53,52,54,51,50,22,18,21,16,35,34,38,39,
+38,38,35,34,6,21,20,23,7,38,240,126,98,54,95,69,57,46,27,88,135,115,8,30,
+24,54,133,92,148,33,63,57,65,88,49,82,81,8,59,18,253,163,118,149,52,79,63,
+29,149,168,239,29,19,23,30,35,156,254,250,150,254,226,38,65,72,48,82,71,24,
+37,9,54,0,0,3,253,2,253,96,0,150,255,102,0,22,0,33,0,44,0,0,19,20,6,35,34,
+39,6,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,5,38,38,35,34,6,21,20,
+22,51,50,37,52,38,35,34,6,7,22,51,50,54,150,130,119,134,73,33,106,67,116,
+138,132,104,84,120,18,18,119,84,106,131,254,0,1,77,81,64,78,82,71,128,1,173,
+79,66,79,76,1,25,131,69,76,254,115,124,151,110,53,57,150,125,107,136,89,81,
+81,89,133,100,61,91,79,69,64,78,145,69,76,93,61,137,77,0,4,252,248,252,210,
+0,150,255,179,0,28,0,39,0,51,0,78,0,0,19,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,21,20,7,51,38,53,52,54,51,50,22,37,20,22,51,50,53,52,38,35,
+34,6,5,20,22,51,50,54,53,52,38,35,34,6,5,52,39,22,21,20,6,35,33,34,38,53,
+52,55,6,21,20,22,51,50,54,55,51,22,51,50,54,150,137,107,82,120,17,17,114,
+81,111,140,153,114,73,90,24,114,24,91,72,114,153,253,25,46,43,89,44,43,44,
+47,1,126,44,45,43,47,48,44,43,44,1,23,49,7,84,75,254,152,75,85,7,48,102,80,
+72,82,20,49,44,143,77,93,254,36,148,190,100,82,81,101,190,148,171,228,96,
+76,52,37,37,52,76,96,228,46,36,41,78,31,45,43,33,35,43,41,36,34,43,45,202,
+122,73,22,26,75,84,84,75,25,22,74,124,103,106,73,67,140,116,0,0,3,0,240,252,
+162,4,16,0,131,0,47,0,56,0,67,0,0,1,22,21,20,6,35,34,38,53,52,55,35,34,38,
+53,52,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,23,22,23,54,54,53,
+52,39,52,54,51,50,18,21,16,1,20,51,50,53,52,38,35,34,1,52,38,35,34,6,21,20,
+51,50,54,3,32,41,94,96,84,102,40,2,119,144,151,112,79,80,74,69,67,73,8,62,
+101,107,133,57,135,106,168,32,27,69,116,253,164,81,82,42,38,83,1,66,55,47,
+49,53,101,47,56,253,170,47,57,72,88,83,70,60,34,146,119,114,157,93,75,78,
+91,83,74,31,26,48,80,72,67,8,10,31,12,115,128,238,65,42,49,255,0,149,254,
+218,1,62,66,67,29,38,254,15,32,32,34,31,64,33,0,0,3,252,237,252,210,0,150,
+255,171,0,55,0,67,0,79,0,0,19,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,54,55,51,22,51,50,54,53,52,
+39,22,21,20,6,35,34,38,53,52,54,51,50,22,37,20,22,51,50,54,53,52,38,35,34,
+6,5,52,38,35,34,6,21,20,22,51,50,54,150,140,112,81,118,18,17,117,82,108,144,
+157,117,72,90,86,69,66,83,7,57,108,82,65,87,20,49,43,138,83,98,58,7,83,62,
+72,86,90,71,118,157,253,22,46,42,45,44,44,43,43,47,2,44,48,43,43,44,43,46,
+42,47,254,43,153,192,98,82,81,99,191,144,169,225,95,76,77,102,76,71,25,22,
+82,114,111,106,75,64,139,114,103,113,84,22,26,71,76,98,81,76,95,219,39,35,
+41,42,34,32,45,43,34,34,43,45,32,34,42,41,0,0,3,252,252,250,211,0,150,0,70,
+0,28,0,40,0,96,0,0,1,35,53,33,54,54,53,52,39,51,22,21,20,7,33,21,35,39,22,
+22,21,20,6,35,34,38,53,52,55,23,20,22,51,50,54,53,52,38,35,34,6,1,20,7,35,
+54,53,52,39,6,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,39,54,54,
+53,52,38,35,34,6,21,20,22,51,50,55,51,22,51,50,54,53,52,39,54,54,51,50,18,
+253,148,32,1,3,45,59,20,122,13,132,1,23,28,80,36,42,153,136,128,151,81,22,
+98,81,87,96,100,83,80,99,2,160,9,97,6,4,24,78,48,162,57,31,108,90,96,124,
+109,82,63,68,75,57,9,19,21,27,25,35,44,71,68,159,40,49,39,131,64,85,114,7,
+44,24,88,77,254,141,120,39,117,56,42,67,52,43,119,107,120,1,26,78,43,105,
+118,121,102,89,58,94,59,55,57,57,51,64,65,253,8,90,61,45,44,50,37,35,40,187,
+92,95,131,100,89,120,67,49,52,66,5,54,4,32,18,18,24,51,36,45,57,132,132,75,
+71,123,81,22,28,254,206,0,0,3,0,240,250,81,4,220,255,201,0,73,0,144,0,154,
+0,0,5,52,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,23,22,22,51,50,54,55,
+23,20,6,35,34,39,23,20,6,7,6,6,21,20,51,50,54,55,51,22,22,51,50,54,53,52,
+39,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,1,20,
+6,7,39,54,53,52,38,35,34,7,23,20,7,22,21,20,6,35,34,39,54,54,53,39,6,6,35,
+34,38,53,52,54,51,50,23,54,53,52,38,35,34,21,35,52,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,23,54,54,51,50,23,54,51,50,22,1,38,35,34,6,21,20,22,
+51,50,1,232,81,42,50,21,32,29,35,92,70,40,63,49,48,72,48,69,99,40,26,111,
+93,107,101,3,47,47,44,45,94,52,75,14,44,17,76,67,55,58,64,7,32,19,32,36,82,
+102,65,100,12,24,104,71,72,93,59,85,48,43,2,244,25,22,48,22,54,47,98,4,1,
+48,39,54,40,38,25,38,37,2,47,123,65,91,120,126,101,123,86,28,62,54,109,69,
+70,55,52,69,21,51,47,108,80,62,86,21,15,79,52,117,45,40,104,72,86,254,100,
+62,116,59,77,62,61,123,216,47,42,31,25,25,25,17,62,36,63,84,26,45,46,30,57,
+58,11,91,105,97,20,37,52,34,31,49,33,66,71,64,67,68,52,39,62,16,21,26,69,
+58,93,148,98,73,76,93,89,63,50,87,60,35,44,253,106,39,76,24,25,31,37,40,43,
+103,34,93,93,61,77,54,74,34,20,77,43,22,60,71,94,72,75,96,73,57,66,55,66,
+92,46,46,46,39,36,31,26,69,68,81,112,63,55,57,61,108,108,95,254,160,54,39,
+31,35,28,0,2,0,240,252,148,6,24,1,82,0,35,0,48,0,0,1,20,2,35,34,39,33,55,
+33,38,53,52,54,51,50,22,21,20,6,7,22,51,50,54,54,53,52,38,39,39,52,54,51,
+50,22,18,5,20,23,22,51,50,54,53,52,38,35,34,6,6,24,231,189,219,125,253,212,
+12,1,217,24,122,97,100,121,103,102,79,115,81,152,98,181,192,3,58,46,95,172,
+104,253,3,31,37,35,78,72,68,62,57,66,254,193,250,254,205,223,161,69,59,110,
+141,142,117,105,149,18,52,91,191,142,179,245,49,26,45,66,181,254,209,233,
+54,57,6,68,52,55,59,67,0,0,2,0,240,252,148,6,10,1,140,0,46,0,59,0,0,1,20,
+2,35,34,39,33,55,33,38,53,52,54,51,50,22,21,20,6,7,22,51,50,54,54,53,52,38,
+39,54,54,53,52,38,39,39,52,54,51,50,22,21,20,6,7,22,22,5,20,23,22,51,50,54,
+53,52,38,35,34,6,6,10,232,174,219,125,253,212,12,1,217,24,122,97,100,121,
+103,102,79,115,75,145,95,94,78,52,61,65,49,1,59,42,63,79,68,74,84,90,253,
+17,31,37,35,78,72,68,62,57,66,254,117,206,254,237,223,161,69,59,110,141,142,
+117,105,149,18,52,80,155,107,109,187,66,34,91,44,50,78,4,9,30,48,97,75,54,
+105,42,87,214,101,54,57,6,68,52,55,59,67,0,0,2,0,240,252,46,5,232,0,15,0,
+59,0,71,0,0,1,54,53,52,38,35,34,6,21,20,22,23,22,22,21,20,6,35,34,38,53,52,
+55,7,33,55,33,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,51,50,54,53,52,38,
+39,38,38,53,52,54,51,50,22,21,20,7,5,50,54,53,52,38,35,34,6,21,20,22,5,138,
+17,38,41,35,34,33,37,49,53,186,160,125,144,36,82,253,210,12,1,226,32,116,
+102,100,121,45,46,44,39,160,111,129,45,45,46,45,90,70,74,92,36,253,211,65,
+64,68,62,54,69,60,254,228,34,40,37,51,47,33,35,75,64,84,129,72,147,170,107,
+100,68,53,3,161,70,77,106,126,142,117,66,118,39,34,57,33,97,85,70,57,111,
+86,88,113,58,73,90,98,79,68,75,185,63,51,55,59,59,54,50,65,0,3,0,240,251,
+219,5,51,0,131,0,28,0,48,0,60,0,0,1,35,53,33,54,53,52,39,51,22,21,20,6,7,
+33,21,35,39,22,22,21,20,6,35,34,38,53,52,55,5,16,0,33,34,39,55,22,51,50,36,
+18,53,52,38,39,54,51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,1,202,32,1,3,
+102,33,122,27,70,61,1,23,28,83,37,44,155,134,125,154,84,3,26,254,139,254,
+192,236,162,22,109,140,195,1,77,196,48,49,4,71,59,59,252,249,100,79,85,98,
+101,82,78,101,254,141,120,86,135,83,78,58,72,69,133,50,120,1,28,90,49,107,
+126,129,104,102,65,7,254,197,254,143,83,85,37,149,1,6,163,56,69,20,94,156,
+211,60,64,66,58,59,76,76,0,2,252,83,251,109,0,150,255,40,0,17,0,37,0,0,1,
+52,54,51,50,22,21,21,35,53,52,38,35,34,6,21,21,35,3,55,22,51,50,36,18,53,
+52,38,39,54,51,50,22,21,16,0,33,34,252,200,167,138,139,162,127,77,97,103,
+75,127,117,22,109,140,195,1,77,196,48,49,4,71,59,59,254,139,254,192,236,253,
+100,204,248,245,207,139,127,162,211,204,161,135,254,231,85,37,149,1,6,163,
+56,69,20,94,156,104,254,197,254,143,0,3,0,240,251,109,5,171,0,131,0,54,0,
+66,0,86,0,0,1,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,55,6,21,20,22,51,
+50,54,55,51,22,51,50,54,53,52,38,35,55,50,54,53,52,39,51,22,21,20,6,7,22,
+21,20,6,35,34,39,6,6,3,20,22,51,50,54,53,52,38,35,34,6,5,16,0,33,34,39,55,
+22,51,50,36,18,53,52,38,39,54,51,50,22,1,252,120,148,168,112,86,106,86,81,
+81,89,4,43,100,79,77,123,26,53,55,143,62,60,118,90,15,70,75,92,141,57,66,
+60,188,122,96,187,66,36,114,170,52,47,50,47,48,47,48,53,3,240,254,139,254,
+192,236,162,22,109,140,195,1,77,196,48,49,4,71,59,59,252,211,184,149,151,
+225,117,94,96,111,105,91,46,52,115,81,105,84,85,169,66,55,69,93,81,98,73,
+109,120,91,107,79,127,30,81,193,101,135,209,103,106,1,242,41,47,49,40,36,
+54,51,212,254,197,254,143,83,85,37,149,1,6,163,56,69,20,94,156,0,0,4,0,240,
+251,189,5,55,255,152,0,20,0,40,0,71,0,80,0,0,19,52,54,54,51,50,22,23,22,21,
+20,6,35,34,38,39,6,6,35,34,38,37,16,0,33,34,39,55,22,51,50,36,18,53,52,38,
+39,54,51,50,22,5,20,22,51,50,54,55,51,22,51,50,54,53,52,39,6,6,35,34,38,53,
+52,54,51,50,23,38,38,35,34,6,37,34,21,20,22,51,50,55,38,240,113,196,118,142,
+177,5,87,116,101,89,93,26,18,103,71,99,122,4,71,254,139,254,192,236,162,22,
+109,140,195,1,77,196,48,49,4,71,59,59,252,49,64,57,64,65,20,43,43,135,68,
+70,9,14,80,55,61,80,72,61,50,44,21,134,95,131,176,1,217,78,35,33,86,14,39,
+253,253,118,188,105,121,101,78,129,114,123,87,80,76,91,142,221,254,197,254,
+143,83,85,37,149,1,6,163,56,69,20,94,156,158,67,80,70,65,135,74,59,26,26,
+37,47,75,52,52,65,21,47,56,159,17,50,21,25,70,26,0,3,0,240,252,42,5,226,255,
+176,0,19,0,34,0,46,0,0,1,55,22,51,50,36,54,53,52,39,54,54,51,50,22,21,16,
+0,33,34,1,33,38,53,52,54,51,50,22,21,20,6,6,35,33,1,52,38,35,34,6,21,20,22,
+51,50,54,1,224,22,137,134,180,1,35,166,127,2,40,35,66,80,254,189,254,211,
+230,254,112,2,70,32,116,102,100,121,70,129,144,253,110,3,140,68,62,54,69,
+60,64,65,64,252,134,85,47,116,214,140,167,48,41,46,172,138,254,226,254,206,
+1,234,70,77,106,126,142,117,83,138,60,1,21,55,59,59,54,50,65,63,0,3,252,63,
+251,205,0,150,255,143,0,19,0,39,0,55,0,0,1,52,54,54,51,50,22,22,21,20,6,35,
+34,38,39,6,6,35,34,38,19,55,22,51,50,36,54,53,52,39,54,54,51,50,22,21,16,
+0,33,34,19,51,22,51,50,53,52,38,35,34,6,21,20,22,51,50,252,63,117,194,113,
+115,194,116,115,97,81,102,30,24,106,77,104,113,85,22,137,134,180,1,35,166,
+127,2,40,35,66,80,254,189,254,211,230,133,69,34,106,128,166,140,132,168,65,
+54,119,254,28,112,169,90,92,170,112,121,146,79,93,83,89,146,254,137,85,47,
+116,214,140,167,48,41,46,172,138,254,226,254,206,2,101,128,128,118,140,139,
+114,68,65,0,0,2,0,240,251,139,5,216,0,131,0,51,0,71,0,0,19,52,54,51,50,22,
+21,20,7,39,54,53,52,38,35,34,6,21,20,22,51,50,55,51,22,51,50,54,53,52,38,
+39,38,53,52,54,51,50,22,18,21,20,6,35,34,38,39,6,6,35,34,38,19,55,22,51,50,
+36,18,53,52,38,39,54,51,50,22,21,16,0,33,34,240,115,91,73,84,145,12,53,37,
+36,48,48,90,77,183,49,55,50,146,86,75,135,115,8,30,24,54,133,92,125,108,80,
+119,31,34,124,104,113,138,165,22,109,140,195,1,77,196,48,49,4,71,59,59,254,
+139,254,192,236,253,235,109,142,83,61,117,24,62,12,49,27,34,63,54,65,72,175,
+175,114,111,168,239,29,19,23,30,35,156,254,250,150,174,209,115,100,105,110,
+160,254,114,85,37,149,1,6,163,56,69,20,94,156,104,254,197,254,143,0,0,2,0,
+240,251,159,5,116,0,132,0,62,0,82,0,0,1,52,54,55,54,54,53,52,38,35,34,6,21,
+20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,51,50,55,51,22,22,51,50,
+54,53,52,38,39,38,53,52,54,51,50,22,18,21,16,33,34,38,39,6,6,35,34,38,19,
+55,22,51,50,36,18,53,52,38,39,54,51,50,22,21,16,0,33,34,1,8,67,83,58,44,55,
+50,43,49,22,45,56,97,79,90,106,64,79,44,37,86,129,49,45,21,82,58,101,94,135,
+115,8,30,24,54,133,92,254,253,68,105,26,31,109,85,83,98,41,22,109,140,195,
+1,77,196,48,49,4,71,59,59,254,139,254,192,236,253,145,62,90,63,44,55,41,38,
+41,41,36,35,36,24,63,83,68,88,94,79,66,95,65,36,48,32,74,143,67,76,117,120,
+168,239,29,19,23,30,35,156,254,250,150,254,138,95,81,92,84,102,254,182,85,
+37,149,1,6,163,56,69,20,94,156,104,254,197,254,143,0,0,2,0,211,255,242,1,
+213,5,182,0,3,0,11,0,0,19,51,3,35,3,52,51,50,21,20,35,34,221,238,72,94,82,
+129,129,129,129,5,182,251,230,254,225,139,139,139,0,2,0,117,3,213,2,207,5,
+182,0,3,0,7,0,0,19,51,3,35,1,51,3,35,117,217,62,94,1,68,217,62,94,5,182,254,
+31,1,225,254,31,0,0,2,0,51,0,0,4,70,5,182,0,27,0,31,0,0,19,35,53,51,19,35,
+53,51,19,51,3,33,19,51,3,51,21,35,3,51,21,33,3,35,19,33,3,35,1,19,33,3,240,
+189,211,78,223,245,74,125,76,1,29,76,123,76,201,224,75,233,254,254,78,123,
+78,254,227,77,123,1,254,76,254,227,76,1,160,121,1,145,121,1,147,254,109,1,
+147,254,109,121,254,111,121,254,96,1,160,254,96,2,25,1,145,254,111,0,0,5,
+0,92,255,236,6,207,5,203,0,11,0,15,0,27,0,39,0,51,0,0,19,52,54,51,50,22,21,
+20,6,35,34,38,1,51,1,35,19,52,38,35,34,6,21,20,22,51,50,54,1,52,54,51,50,
+22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,92,166,172,164,170,
+171,165,170,166,4,96,134,253,38,135,97,68,80,82,72,72,80,81,69,1,237,165,
+173,164,170,171,165,171,165,1,229,67,80,82,72,72,80,81,68,4,6,214,239,242,
+211,212,245,243,2,134,250,74,4,6,183,184,186,181,184,189,188,254,103,215,
+238,242,211,211,245,242,214,183,184,186,181,184,189,187,0,0,1,0,117,3,213,
+1,78,5,182,0,3,0,0,19,51,3,35,117,217,62,94,5,182,254,31,0,1,0,117,254,250,
+2,131,6,20,0,15,0,0,19,16,18,37,21,6,6,2,21,20,18,22,23,21,36,2,117,245,1,
+25,132,138,43,43,138,132,254,233,247,2,137,1,118,1,165,112,92,80,250,254,
+220,193,192,254,218,251,80,94,111,1,169,0,0,1,0,66,254,250,2,80,6,20,0,15,
+0,0,23,54,54,18,53,52,2,38,39,53,4,18,17,16,2,5,66,132,137,44,44,137,132,
+1,23,247,247,254,233,168,80,252,1,37,192,192,1,37,250,80,92,111,254,90,254,
+138,254,139,254,85,111,0,0,1,0,84,3,6,3,160,6,20,0,17,0,0,1,5,39,37,37,55,
+5,3,51,3,37,23,5,5,7,37,19,35,1,213,254,199,72,1,88,254,168,72,1,59,53,178,
+57,1,61,72,254,166,1,90,72,254,195,57,178,4,74,195,160,102,103,162,199,1,
+69,254,189,192,159,101,100,158,191,254,188,0,0,1,0,133,1,37,3,244,4,147,0,
+11,0,0,1,33,53,33,17,51,17,33,21,33,17,35,1,254,254,135,1,121,123,1,123,254,
+133,123,2,160,121,1,122,254,134,121,254,133,0,1,0,61,254,197,1,141,1,8,0,
+17,0,0,23,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,31,32,54,
+33,75,59,68,89,162,174,229,63,121,25,28,18,29,53,35,57,64,98,80,140,210,51,
+0,1,0,51,1,225,2,72,2,123,0,3,0,0,19,33,21,33,51,2,21,253,235,2,123,154,0,
+1,0,127,255,242,1,129,1,8,0,7,0,0,55,52,51,50,21,20,35,34,127,129,129,129,
+129,125,139,139,139,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,1,51,1,35,1,215,119,
+254,43,121,6,20,248,244,0,2,0,92,255,236,4,29,5,203,0,11,0,23,0,0,19,16,18,
+51,50,18,17,16,2,35,34,2,1,16,2,35,34,2,17,16,18,51,50,18,92,237,246,229,
+249,252,228,244,237,2,236,122,143,145,125,125,143,144,123,2,223,1,98,1,138,
+254,121,254,153,254,152,254,119,1,144,1,97,1,62,1,65,254,191,254,194,254,
+194,254,187,1,68,0,0,1,0,135,0,0,3,209,5,190,0,23,0,0,55,51,50,54,53,17,6,
+6,35,34,38,53,54,54,55,55,51,17,20,22,51,51,21,33,197,137,96,72,92,116,56,
+45,58,66,137,96,144,131,73,95,100,252,244,86,71,76,4,52,111,102,61,49,17,
+70,71,106,251,43,76,71,86,0,0,1,0,104,0,0,3,227,5,203,0,31,0,0,55,1,54,54,
+53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,1,33,50,54,54,55,51,
+3,33,104,1,86,169,122,104,105,128,97,82,94,214,187,192,224,139,203,254,166,
+1,217,59,70,35,16,86,10,252,143,150,1,139,197,243,135,121,139,164,141,60,
+73,127,148,186,156,117,254,223,254,129,42,71,77,254,158,0,0,1,0,119,255,236,
+4,2,5,203,0,44,0,0,55,52,54,51,20,22,51,50,54,53,52,38,35,35,53,51,50,54,
+53,52,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,6,35,34,
+38,119,70,59,142,118,135,170,200,171,65,65,142,180,219,129,97,82,94,216,186,
+199,231,183,145,184,195,154,237,129,180,207,207,61,70,113,135,158,172,131,
+154,104,178,139,254,164,141,60,73,127,148,175,151,135,208,34,20,190,152,155,
+196,87,122,0,0,2,0,35,0,0,4,92,5,182,0,20,0,28,0,0,37,51,50,54,53,53,33,53,
+1,51,17,51,21,35,21,20,22,51,51,21,33,19,17,52,55,6,6,7,1,1,184,58,96,72,
+253,137,2,121,194,254,254,73,95,27,253,151,226,14,20,127,37,254,198,86,71,
+76,168,84,3,209,252,78,115,168,76,71,86,2,4,1,123,248,176,40,218,57,254,24,
+0,1,0,113,255,236,3,227,5,180,0,34,0,0,55,52,51,20,22,51,32,17,52,38,35,34,
+6,7,39,19,33,19,35,39,38,38,35,33,3,54,51,50,22,21,20,4,35,34,38,113,129,
+133,114,1,37,166,145,94,108,50,49,66,2,172,10,86,8,7,46,58,254,115,39,97,
+142,216,251,254,246,229,181,206,186,121,95,112,1,90,158,162,23,22,14,2,213,
+254,203,61,51,33,254,62,33,233,200,214,252,109,0,2,0,125,255,236,4,16,5,203,
+0,25,0,34,0,0,19,52,18,54,51,50,22,21,20,6,35,52,38,35,32,3,54,51,50,22,21,
+20,2,35,34,2,37,16,35,34,6,7,18,33,50,125,119,241,174,152,186,81,76,87,94,
+254,210,21,128,165,189,222,238,202,231,244,2,194,243,74,132,48,6,1,10,225,
+2,225,201,1,84,205,120,95,59,64,108,131,253,166,107,226,194,225,254,248,1,
+138,75,1,79,69,49,253,194,0,0,1,0,121,0,0,4,23,5,180,0,10,0,0,1,33,34,7,7,
+35,19,33,21,1,35,3,104,253,230,110,9,8,86,10,3,148,254,8,154,5,16,104,102,
+1,114,59,250,135,0,3,0,94,255,236,4,27,5,203,0,25,0,37,0,48,0,0,19,52,54,
+54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,4,35,34,38,1,52,38,
+35,34,6,21,20,22,23,54,54,19,52,38,39,6,21,20,22,51,50,54,94,78,132,102,126,
+139,93,199,151,184,219,115,161,164,176,254,249,229,213,252,2,199,124,110,
+109,128,117,159,107,88,59,164,196,211,142,134,131,164,1,111,93,136,96,49,
+71,182,122,100,166,101,193,160,109,156,81,78,189,126,191,220,210,3,177,118,
+133,133,112,97,139,74,53,133,253,97,105,156,85,114,220,131,153,150,0,0,2,
+0,104,255,233,3,252,5,203,0,26,0,38,0,0,55,52,54,55,22,51,50,18,19,6,6,35,
+34,38,53,52,18,51,50,18,17,20,2,6,35,34,38,1,2,2,35,34,6,21,20,22,51,54,54,
+168,37,24,70,168,168,163,11,50,152,99,191,213,240,199,230,247,116,249,190,
+160,137,2,131,4,142,122,109,119,117,121,94,134,154,36,54,8,162,1,44,1,56,
+61,78,221,195,228,1,20,254,151,254,185,226,254,142,222,102,3,3,1,8,1,0,192,
+179,166,149,1,94,0,0,2,0,166,255,242,1,168,4,84,0,7,0,15,0,0,19,52,51,50,
+21,20,35,34,17,52,51,50,21,20,35,34,166,129,129,129,129,129,129,129,129,3,
+201,139,139,140,253,64,139,139,139,0,0,2,0,98,254,197,1,178,4,84,0,7,0,25,
+0,0,19,52,51,50,21,20,35,34,3,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,
+6,7,166,129,129,129,129,68,195,31,32,54,33,75,58,70,88,162,174,3,201,139,
+139,140,251,222,63,121,25,28,18,31,51,35,57,64,99,79,140,210,51,0,0,1,0,133,
+0,225,3,244,4,217,0,6,0,0,19,53,1,21,1,1,21,133,3,111,253,80,2,176,2,184,
+72,1,217,137,254,139,254,143,137,0,0,2,0,133,1,213,3,244,3,225,0,3,0,7,0,
+0,19,33,21,33,17,33,21,33,133,3,111,252,145,3,111,252,145,3,225,121,254,230,
+121,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,1,1,53,1,21,1,133,2,176,253,
+80,3,111,252,145,1,106,1,113,1,117,137,254,39,72,254,41,0,2,0,88,255,242,
+3,152,5,203,0,23,0,31,0,0,1,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,
+22,21,20,6,7,21,35,3,52,51,50,21,20,35,34,1,141,167,147,110,114,120,109,76,
+94,200,183,203,246,200,198,125,69,129,129,129,129,2,211,67,222,135,111,124,
+145,117,69,64,109,121,204,167,163,224,82,231,254,225,139,139,139,0,1,0,205,
+254,250,2,150,6,20,0,13,0,0,19,33,21,35,34,6,21,17,20,22,51,51,21,33,205,
+1,201,89,95,72,72,95,89,254,55,6,20,86,71,76,250,184,75,72,86,0,0,1,0,0,255,
+8,2,78,6,20,0,3,0,0,17,51,1,35,119,1,215,121,6,20,248,244,0,1,0,76,254,250,
+2,20,6,20,0,13,0,0,23,51,50,54,53,17,52,38,35,35,53,33,17,33,76,88,96,72,
+73,95,88,1,200,254,56,176,71,76,5,72,76,71,86,248,230,0,0,1,0,104,2,33,4,
+14,5,182,0,6,0,0,1,51,1,35,1,1,35,2,23,71,1,176,137,254,180,254,185,138,5,
+182,252,107,2,217,253,39,0,1,255,246,254,221,3,182,255,86,0,3,0,0,7,33,21,
+33,10,3,192,252,64,170,121,0,0,1,0,102,254,250,3,6,6,20,0,35,0,0,37,17,52,
+38,39,53,54,54,53,17,52,54,51,51,21,35,34,6,21,17,20,6,7,21,22,22,21,17,20,
+22,51,51,21,35,34,38,1,88,127,115,114,128,151,144,135,61,89,79,116,112,115,
+113,80,88,61,135,142,153,33,1,100,117,95,5,86,3,96,116,1,101,140,152,88,106,
+109,254,162,102,132,18,2,19,131,104,254,158,107,108,88,158,0,1,1,254,254,
+20,2,121,6,20,0,3,0,0,1,51,17,35,1,254,123,123,6,20,248,0,0,1,0,102,254,250,
+3,6,6,20,0,35,0,0,23,51,50,54,53,17,52,54,55,53,38,38,53,17,52,38,35,35,53,
+51,50,22,21,17,20,22,23,21,6,6,21,17,20,6,35,35,102,62,88,80,113,114,111,
+116,79,89,62,136,143,151,129,113,114,128,152,142,136,174,108,107,1,98,104,
+131,19,2,18,132,102,1,94,109,106,88,152,140,254,155,116,96,3,86,5,95,117,
+254,156,137,158,0,0,1,0,111,2,39,4,8,3,141,0,25,0,0,1,50,22,23,22,22,51,50,
+54,55,51,6,6,35,34,38,39,38,38,35,34,6,7,35,54,54,1,104,67,110,79,57,73,38,
+54,57,14,123,17,105,128,67,114,64,61,73,43,58,59,12,120,14,105,3,141,62,73,
+52,50,117,120,150,208,66,63,58,50,114,123,155,203,0,255,255,0,51,1,225,2,
+72,2,123,2,6,1,142,0,0,0,1,255,246,1,233,4,10,2,98,0,3,0,0,3,33,21,33,10,
+4,20,251,236,2,98,121,0,1,255,246,1,233,8,10,2,98,0,3,0,0,3,33,21,33,10,8,
+20,247,236,2,98,121,0,1,0,115,3,117,1,195,5,184,0,17,0,0,19,52,54,55,21,6,
+21,20,22,23,22,22,21,20,6,35,34,38,115,162,174,195,30,33,42,45,75,59,69,88,
+4,39,140,210,51,86,63,121,25,28,19,22,49,45,57,64,98,0,0,1,0,61,3,115,1,141,
+5,182,0,17,0,0,19,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,
+30,33,42,45,75,59,69,88,162,174,3,201,63,121,25,28,19,22,49,45,57,64,98,80,
+140,210,51,0,0,2,0,115,3,117,3,92,5,184,0,17,0,35,0,0,19,52,54,55,21,6,21,
+20,22,23,22,22,21,20,6,35,34,38,37,52,54,55,21,6,21,20,22,23,22,22,21,20,
+6,35,34,38,115,162,174,195,30,33,42,45,75,59,69,88,1,153,162,174,194,30,33,
+41,45,74,59,70,88,4,39,140,210,51,86,63,121,25,28,19,22,49,45,57,64,98,80,
+140,210,51,86,63,121,25,28,19,22,49,45,57,64,99,0,2,0,61,3,115,3,39,5,182,
+0,17,0,35,0,0,19,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,37,54,53,
+52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,30,33,42,45,75,59,69,88,
+162,174,1,154,195,30,33,42,45,74,59,70,88,162,174,3,201,63,121,25,28,19,22,
+49,45,57,64,98,80,140,210,51,86,63,121,25,28,19,22,49,45,57,64,99,79,140,
+210,51,0,3,0,164,255,242,6,57,1,8,0,7,0,15,0,23,0,0,55,52,51,50,21,20,35,
+34,37,52,51,50,21,20,35,34,37,52,51,50,21,20,35,34,164,129,129,129,129,2,
+74,129,129,129,129,2,73,129,129,129,129,125,139,139,139,139,139,139,139,139,
+139,139,139,0,0,1,0,145,1,51,3,229,4,137,0,11,0,0,19,1,1,55,1,1,23,1,1,7,
+1,1,145,1,84,254,172,86,1,84,1,84,86,254,172,1,84,86,254,172,254,172,1,139,
+1,84,1,82,86,254,172,1,86,88,254,172,254,172,86,1,84,254,172,0,0,3,0,133,
+0,231,3,244,4,209,0,7,0,11,0,19,0,0,1,52,51,50,21,20,35,34,5,33,21,33,1,52,
+51,50,21,20,35,34,1,213,104,105,105,104,254,176,3,111,252,145,1,80,104,105,
+105,104,4,96,113,113,112,215,121,254,184,113,113,113,0,1,0,133,2,160,3,244,
+3,25,0,3,0,0,19,33,21,33,133,3,111,252,145,3,25,121,0,1,2,147,254,103,3,104,
+255,237,0,11,0,0,5,22,22,21,20,6,35,34,53,52,54,55,3,28,31,45,53,52,108,46,
+31,19,83,171,50,46,40,86,43,174,87,0,0,1,2,120,2,35,3,109,3,20,0,11,0,0,1,
+20,6,35,34,38,53,52,54,51,50,22,3,109,68,55,55,67,68,54,54,69,2,155,52,68,
+68,52,52,69,69,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,
+0,36,0,94,0,3,0,1,4,9,0,2,0,14,0,130,0,3,0,1,4,9,0,3,0,74,0,144,0,3,0,1,4,
+9,0,4,0,36,0,94,0,3,0,1,4,9,0,5,0,30,0,218,0,3,0,1,4,9,0,6,0,32,0,248,0,3,
+0,1,4,9,0,7,0,68,1,24,0,3,0,1,4,9,0,8,0,42,1,92,0,3,0,1,4,9,0,9,0,38,1,134,
+0,3,0,1,4,9,0,10,0,96,1,172,0,3,0,1,4,9,0,11,0,62,2,12,0,3,0,1,4,9,0,12,0,
+60,2,74,0,3,0,1,4,9,0,13,2,150,2,134,0,3,0,1,4,9,0,14,0,52,5,28,0,67,0,111,
+0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,54,0,32,0,
+71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,
+0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,
+0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,
+0,105,0,102,0,32,0,75,0,97,0,110,0,110,0,97,0,100,0,97,0,82,0,101,0,103,0,
+117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,
+0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,
+111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,75,0,97,0,110,0,110,0,97,0,100,
+0,97,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,49,0,
+32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,101,0,114,0,105,0,102,0,75,0,
+97,0,110,0,110,0,97,0,100,0,97,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,
+32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,
+0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,
+105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,73,0,110,0,100,0,105,0,97,0,110,
+0,32,0,84,0,121,0,112,0,101,0,32,0,70,0,111,0,117,0,110,0,100,0,114,0,121,
+0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,
+0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,
+0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,
+0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,
+0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,
+0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,
+0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,
+0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,
+0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,
+101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,
+115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,
+46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,
+0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,
+0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,
+83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,
+0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,
+0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,
+0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,
+101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,
+0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,
+0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,
+0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,
+0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,
+0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,
+0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,
+117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,183,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,
+11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,
+1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,
+1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,
+1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,
+1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,
+1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,
+1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,
+113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,
+1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,
+138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,
+1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,
+163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,
+1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,
+188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,
+1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,
+213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,
+1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,
+238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,
+1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,
+2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,
+2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,
+2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,
+2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,
+2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,
+2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,
+2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,
+113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,
+2,126,2,127,2,128,2,129,2,130,0,4,0,5,0,6,0,8,0,10,0,11,0,12,0,13,0,14,0,
+15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,
+0,30,0,31,0,32,0,33,0,34,0,62,0,63,0,64,0,65,0,66,0,94,0,95,0,96,0,97,2,131,
+0,178,0,179,0,182,0,183,0,180,0,181,0,171,0,240,0,184,0,239,2,132,2,133,4,
+78,85,76,76,3,107,110,65,4,107,110,65,65,3,107,110,73,4,107,110,73,73,3,107,
+110,85,4,107,110,85,85,4,107,110,118,82,5,107,110,118,82,82,4,107,110,118,
+76,5,107,110,118,76,76,3,107,110,69,4,107,110,69,69,4,107,110,65,73,3,107,
+110,79,4,107,110,79,79,4,107,110,65,85,5,107,110,109,65,65,4,107,110,109,
+73,5,107,110,109,73,73,4,107,110,109,85,5,107,110,109,85,85,5,107,110,109,
+118,82,6,107,110,109,118,82,82,5,107,110,109,118,76,6,107,110,109,118,76,
+76,4,107,110,109,69,5,107,110,109,69,69,5,107,110,109,65,73,4,107,110,109,
+79,5,107,110,109,79,79,5,107,110,109,65,85,12,107,110,76,101,110,103,116,
+104,109,97,114,107,14,107,110,65,73,108,101,110,103,116,104,109,97,114,107,
+4,107,110,75,65,5,107,110,75,72,65,4,107,110,71,65,5,107,110,71,72,65,5,107,
+110,78,71,65,4,107,110,67,65,5,107,110,67,72,65,4,107,110,74,65,5,107,110,
+74,72,65,5,107,110,78,89,65,5,107,110,84,84,65,6,107,110,84,84,72,65,5,107,
+110,68,68,65,6,107,110,68,68,72,65,5,107,110,78,78,65,4,107,110,84,65,5,107,
+110,84,72,65,4,107,110,68,65,5,107,110,68,72,65,4,107,110,78,65,4,107,110,
+80,65,5,107,110,80,72,65,4,107,110,66,65,5,107,110,66,72,65,4,107,110,77,
+65,4,107,110,89,65,4,107,110,82,65,4,107,110,76,65,4,107,110,86,65,5,107,
+110,83,72,65,5,107,110,83,83,65,4,107,110,83,65,4,107,110,72,65,5,107,110,
+82,82,65,5,107,110,76,76,65,6,107,110,76,76,76,65,10,107,110,65,110,117,115,
+118,97,114,97,13,107,110,67,97,110,100,114,97,98,105,110,100,117,9,107,110,
+86,105,115,97,114,103,97,8,107,110,86,105,114,97,109,97,7,107,110,78,117,
+107,116,97,10,107,110,65,118,97,103,114,97,104,97,13,107,110,74,105,104,118,
+97,109,117,108,105,121,97,13,107,110,85,112,97,100,104,109,97,110,105,121,
+97,6,107,110,90,101,114,111,5,107,110,79,110,101,5,107,110,84,119,111,7,107,
+110,84,104,114,101,101,6,107,110,70,111,117,114,6,107,110,70,105,118,101,
+5,107,110,83,105,120,7,107,110,83,101,118,101,110,7,107,110,69,105,103,104,
+116,6,107,110,78,105,110,101,7,117,110,105,48,57,54,52,7,117,110,105,48,57,
+54,53,7,117,110,105,50,48,66,57,7,117,110,105,50,48,48,66,7,117,110,105,50,
+48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,50,53,67,67,6,107,110,82,
+101,112,104,6,107,110,75,65,99,50,7,107,110,75,72,65,99,50,6,107,110,71,65,
+99,50,7,107,110,71,72,65,99,50,7,107,110,78,71,65,99,50,6,107,110,67,65,99,
+50,7,107,110,67,72,65,99,50,6,107,110,74,65,99,50,7,107,110,74,72,65,99,50,
+7,107,110,78,89,65,99,50,7,107,110,84,84,65,99,50,8,107,110,84,84,72,65,99,
+50,7,107,110,68,68,65,99,50,8,107,110,68,68,72,65,99,50,7,107,110,78,78,65,
+99,50,6,107,110,84,65,99,50,7,107,110,84,72,65,99,50,6,107,110,68,65,99,50,
+7,107,110,68,72,65,99,50,6,107,110,78,65,99,50,6,107,110,80,65,99,50,7,107,
+110,80,72,65,99,50,6,107,110,66,65,99,50,7,107,110,66,72,65,99,50,6,107,110,
+77,65,99,50,6,107,110,89,65,99,50,6,107,110,82,65,99,50,6,107,110,76,65,99,
+50,6,107,110,86,65,99,50,7,107,110,83,72,65,99,50,7,107,110,83,83,65,99,50,
+6,107,110,83,65,99,50,6,107,110,72,65,99,50,7,107,110,82,82,65,99,50,7,107,
+110,76,76,65,99,50,8,107,110,76,76,76,65,99,50,8,107,110,75,83,83,65,99,50,
+8,107,110,74,78,89,65,99,50,10,107,110,84,65,99,50,95,109,118,82,19,107,110,
+84,65,99,50,95,65,73,108,101,110,103,116,104,109,97,114,107,11,107,110,84,
+65,99,50,95,89,65,99,50,11,107,110,75,65,99,50,95,82,65,99,50,11,107,110,
+71,65,99,50,95,82,65,99,50,12,107,110,84,84,65,99,50,95,82,65,99,50,12,107,
+110,68,68,65,99,50,95,82,65,99,50,11,107,110,84,65,99,50,95,82,65,99,50,11,
+107,110,68,65,99,50,95,82,65,99,50,11,107,110,80,65,99,50,95,82,65,99,50,
+11,107,110,66,65,99,50,95,82,65,99,50,9,107,110,75,65,46,98,97,115,101,10,
+107,110,75,72,65,46,98,97,115,101,9,107,110,71,65,46,98,97,115,101,10,107,
+110,71,72,65,46,98,97,115,101,10,107,110,78,71,65,46,98,97,115,101,9,107,
+110,67,65,46,98,97,115,101,10,107,110,67,72,65,46,98,97,115,101,9,107,110,
+74,65,46,98,97,115,101,10,107,110,74,72,65,46,98,97,115,101,10,107,110,78,
+89,65,46,98,97,115,101,10,107,110,84,84,65,46,98,97,115,101,11,107,110,84,
+84,72,65,46,98,97,115,101,10,107,110,68,68,65,46,98,97,115,101,11,107,110,
+68,68,72,65,46,98,97,115,101,10,107,110,78,78,65,46,98,97,115,101,9,107,110,
+84,65,46,98,97,115,101,10,107,110,84,72,65,46,98,97,115,101,9,107,110,68,
+65,46,98,97,115,101,10,107,110,68,72,65,46,98,97,115,101,9,107,110,78,65,
+46,98,97,115,101,9,107,110,80,65,46,98,97,115,101,10,107,110,80,72,65,46,
+98,97,115,101,9,107,110,66,65,46,98,97,115,101,10,107,110,66,72,65,46,98,
+97,115,101,9,107,110,77,65,46,98,97,115,101,9,107,110,89,65,46,98,97,115,
+101,9,107,110,82,65,46,98,97,115,101,9,107,110,76,65,46,98,97,115,101,9,107,
+110,86,65,46,98,97,115,101,10,107,110,83,72,65,46,98,97,115,101,10,107,110,
+83,83,65,46,98,97,115,101,9,107,110,83,65,46,98,97,115,101,9,107,110,72,65,
+46,98,97,115,101,10,107,110,82,82,65,46,98,97,115,101,10,107,110,76,76,65,
+46,98,97,115,101,11,107,110,76,76,76,65,46,98,97,115,101,3,107,110,75,4,107,
+110,75,72,3,107,110,71,4,107,110,71,72,4,107,110,78,71,3,107,110,67,4,107,
+110,67,72,3,107,110,74,4,107,110,74,72,4,107,110,78,89,4,107,110,84,84,5,
+107,110,84,84,72,4,107,110,68,68,5,107,110,68,68,72,4,107,110,78,78,3,107,
+110,84,4,107,110,84,72,3,107,110,68,4,107,110,68,72,3,107,110,78,3,107,110,
+80,4,107,110,80,72,3,107,110,66,4,107,110,66,72,3,107,110,77,3,107,110,89,
+3,107,110,82,3,107,110,76,3,107,110,86,4,107,110,83,72,4,107,110,83,83,3,
+107,110,83,3,107,110,72,4,107,110,82,82,4,107,110,76,76,5,107,110,76,76,76,
+5,107,110,67,65,65,6,107,110,84,84,65,65,6,107,110,78,78,65,65,4,107,110,
+75,73,5,107,110,75,72,73,4,107,110,71,73,5,107,110,71,72,73,5,107,110,78,
+71,73,4,107,110,67,73,5,107,110,67,72,73,4,107,110,74,73,5,107,110,74,72,
+73,5,107,110,78,89,73,5,107,110,84,84,73,6,107,110,84,84,72,73,5,107,110,
+68,68,73,6,107,110,68,68,72,73,5,107,110,78,78,73,4,107,110,84,73,5,107,110,
+84,72,73,4,107,110,68,73,5,107,110,68,72,73,4,107,110,78,73,4,107,110,80,
+73,5,107,110,80,72,73,4,107,110,66,73,5,107,110,66,72,73,4,107,110,77,73,
+4,107,110,89,73,4,107,110,82,73,4,107,110,76,73,4,107,110,86,73,5,107,110,
+83,72,73,5,107,110,83,83,73,4,107,110,83,73,4,107,110,72,73,5,107,110,82,
+82,73,5,107,110,76,76,73,6,107,110,76,76,76,73,5,107,110,71,72,85,5,107,110,
+78,89,85,4,107,110,80,85,5,107,110,80,72,85,4,107,110,86,85,5,107,110,76,
+76,85,6,107,110,71,72,85,85,6,107,110,78,89,85,85,5,107,110,80,85,85,6,107,
+110,80,72,85,85,5,107,110,86,85,85,6,107,110,76,76,85,85,4,107,110,75,69,
+5,107,110,75,72,69,4,107,110,71,69,5,107,110,71,72,69,5,107,110,78,71,69,
+4,107,110,67,69,5,107,110,67,72,69,4,107,110,74,69,5,107,110,74,72,69,5,107,
+110,78,89,69,5,107,110,84,84,69,6,107,110,84,84,72,69,5,107,110,68,68,69,
+6,107,110,68,68,72,69,5,107,110,78,78,69,4,107,110,84,69,5,107,110,84,72,
+69,4,107,110,68,69,5,107,110,68,72,69,4,107,110,78,69,4,107,110,80,69,5,107,
+110,80,72,69,4,107,110,66,69,5,107,110,66,72,69,4,107,110,77,69,4,107,110,
+89,69,4,107,110,82,69,4,107,110,76,69,4,107,110,86,69,5,107,110,83,72,69,
+5,107,110,83,83,69,4,107,110,83,69,4,107,110,72,69,5,107,110,82,82,69,5,107,
+110,76,76,69,6,107,110,76,76,76,69,5,107,110,71,72,79,5,107,110,78,71,79,
+5,107,110,74,72,79,5,107,110,78,89,79,4,107,110,80,79,5,107,110,80,72,79,
+4,107,110,77,79,4,107,110,89,79,4,107,110,86,79,5,107,110,82,82,79,5,107,
+110,76,76,79,6,107,110,76,76,76,79,5,107,110,67,65,85,6,107,110,84,84,65,
+85,6,107,110,78,78,65,85,9,107,110,109,65,65,46,78,71,65,9,107,110,109,65,
+85,46,78,71,65,11,107,110,78,117,107,116,97,46,80,72,65,11,107,110,78,117,
+107,116,97,46,80,72,85,6,107,110,75,83,83,65,11,107,110,75,83,83,65,46,98,
+97,115,101,5,107,110,75,83,83,6,107,110,75,83,83,73,6,107,110,75,83,83,69,
+6,107,110,74,78,89,65,11,107,110,74,78,89,65,46,98,97,115,101,5,107,110,74,
+78,89,6,107,110,74,78,89,73,6,107,110,74,78,89,69,15,107,110,109,118,82,46,
+102,111,108,108,111,119,105,110,103,16,107,110,109,118,82,82,46,102,111,108,
+108,111,119,105,110,103,24,107,110,65,73,108,101,110,103,116,104,109,97,114,
+107,46,102,111,108,108,111,119,105,110,103,16,107,110,75,65,99,50,46,102,
+111,108,108,111,119,105,110,103,17,107,110,75,72,65,99,50,46,102,111,108,
+108,111,119,105,110,103,16,107,110,71,65,99,50,46,102,111,108,108,111,119,
+105,110,103,17,107,110,71,72,65,99,50,46,102,111,108,108,111,119,105,110,
+103,17,107,110,78,71,65,99,50,46,102,111,108,108,111,119,105,110,103,16,107,
+110,67,65,99,50,46,102,111,108,108,111,119,105,110,103,17,107,110,67,72,65,
+99,50,46,102,111,108,108,111,119,105,110,103,16,107,110,74,65,99,50,46,102,
+111,108,108,111,119,105,110,103,17,107,110,74,72,65,99,50,46,102,111,108,
+108,111,119,105,110,103,17,107,110,78,89,65,99,50,46,102,111,108,108,111,
+119,105,110,103,17,107,110,84,84,65,99,50,46,102,111,108,108,111,119,105,
+110,103,18,107,110,84,84,72,65,99,50,46,102,111,108,108,111,119,105,110,103,
+17,107,110,68,68,65,99,50,46,102,111,108,108,111,119,105,110,103,18,107,110,
+68,68,72,65,99,50,46,102,111,108,108,111,119,105,110,103,17,107,110,78,78,
+65,99,50,46,102,111,108,108,111,119,105,110,103,16,107,110,84,65,99,50,46,
+102,111,108,108,111,119,105,110,103,17,107,110,84,72,65,99,50,46,102,111,
+108,108,111,119,105,110,103,16,107,110,68,65,99,50,46,102,111,108,108,111,
+119,105,110,103,17,107,110,68,72,65,99,50,46,102,111,108,108,111,119,105,
+110,103,16,107,110,78,65,99,50,46,102,111,108,108,111,119,105,110,103,16,
+107,110,80,65,99,50,46,102,111,108,108,111,119,105,110,103,17,107,110,80,
+72,65,99,50,46,102,111,108,108,111,119,105,110,103,16,107,110,66,65,99,50,
+46,102,111,108,108,111,119,105,110,103,17,107,110,66,72,65,99,50,46,102,111,
+108,108,111,119,105,110,103,16,107,110,77,65,99,50,46,102,111,108,108,111,
+119,105,110,103,16,107,110,89,65,99,50,46,102,111,108,108,111,119,105,110,
+103,16,107,110,82,65,99,50,46,102,111,108,108,111,119,105,110,103,16,107,
+110,76,65,99,50,46,102,111,108,108,111,119,105,110,103,16,107,110,86,65,99,
+50,46,102,111,108,108,111,119,105,110,103,17,107,110,83,72,65,99,50,46,102,
+111,108,108,111,119,105,110,103,17,107,110,83,83,65,99,50,46,102,111,108,
+108,111,119,105,110,103,16,107,110,83,65,99,50,46,102,111,108,108,111,119,
+105,110,103,16,107,110,72,65,99,50,46,102,111,108,108,111,119,105,110,103,
+17,107,110,82,82,65,99,50,46,102,111,108,108,111,119,105,110,103,17,107,110,
+76,76,65,99,50,46,102,111,108,108,111,119,105,110,103,18,107,110,76,76,76,
+65,99,50,46,102,111,108,108,111,119,105,110,103,18,107,110,75,83,83,65,99,
+50,46,102,111,108,108,111,119,105,110,103,18,107,110,74,78,89,65,99,50,46,
+102,111,108,108,111,119,105,110,103,20,107,110,84,65,99,50,95,109,118,82,
+46,102,111,108,108,111,119,105,110,103,29,107,110,84,65,99,50,95,65,73,108,
+101,110,103,116,104,109,97,114,107,46,102,111,108,108,111,119,105,110,103,
+21,107,110,84,65,99,50,95,89,65,99,50,46,102,111,108,108,111,119,105,110,
+103,21,107,110,75,65,99,50,95,82,65,99,50,46,102,111,108,108,111,119,105,
+110,103,21,107,110,71,65,99,50,95,82,65,99,50,46,102,111,108,108,111,119,
+105,110,103,22,107,110,84,84,65,99,50,95,82,65,99,50,46,102,111,108,108,111,
+119,105,110,103,22,107,110,68,68,65,99,50,95,82,65,99,50,46,102,111,108,108,
+111,119,105,110,103,21,107,110,84,65,99,50,95,82,65,99,50,46,102,111,108,
+108,111,119,105,110,103,21,107,110,68,65,99,50,95,82,65,99,50,46,102,111,
+108,108,111,119,105,110,103,21,107,110,80,65,99,50,95,82,65,99,50,46,102,
+111,108,108,111,119,105,110,103,21,107,110,66,65,99,50,95,82,65,99,50,46,
+102,111,108,108,111,119,105,110,103,7,117,110,105,48,48,65,68,4,95,52,51,
+55,4,95,52,51,57,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,0,0,2,
+0,6,0,77,0,77,0,3,0,99,0,136,0,3,0,139,0,147,0,3,1,68,1,69,0,3,1,83,1,120,
+0,3,1,123,1,131,0,3,0,1,0,0,0,10,0,72,0,164,0,3,68,70,76,84,0,20,107,110,
+100,50,0,34,107,110,100,97,0,48,0,4,0,0,0,0,255,255,0,2,0,0,0,3,0,4,0,0,0,
+0,255,255,0,2,0,1,0,4,0,4,0,0,0,0,255,255,0,2,0,2,0,5,0,6,98,108,119,109,
+0,38,98,108,119,109,0,44,98,108,119,109,0,50,100,105,115,116,0,56,100,105,
+115,116,0,68,100,105,115,116,0,80,0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,4,0,0,
+0,4,0,0,0,1,0,2,0,3,0,0,0,4,0,0,0,1,0,2,0,3,0,0,0,4,0,0,0,1,0,2,0,3,0,7,0,
+16,0,24,0,32,0,40,0,48,0,56,0,64,0,8,0,0,0,1,0,56,0,2,0,0,0,1,0,66,0,8,0,
+0,0,1,0,78,0,2,0,0,0,1,0,88,0,4,0,0,0,1,0,100,0,1,0,0,0,1,0,164,0,1,0,0,0,
+1,0,166,0,3,0,1,0,168,0,1,0,178,0,0,0,1,0,0,0,5,0,2,0,170,0,4,0,0,0,232,0,
+236,0,1,0,2,0,0,255,221,0,3,0,1,0,162,0,1,0,140,0,0,0,1,0,0,0,6,0,2,0,144,
+0,4,0,0,0,194,0,198,0,1,0,2,0,0,255,221,0,1,0,134,0,144,0,1,0,12,0,26,0,3,
+0,0,0,42,0,0,0,42,0,0,0,42,0,13,0,34,0,40,0,34,0,40,0,34,0,40,0,34,0,40,0,
+40,0,40,0,34,0,40,0,40,0,1,0,0,0,0,0,1,3,7,0,0,0,1,3,3,0,0,0,1,0,30,0,5,254,
+152,254,152,0,1,0,20,0,5,254,252,254,252,0,2,0,1,1,75,1,79,0,0,0,2,0,1,1,
+80,1,131,0,0,0,1,0,4,0,37,0,42,1,15,1,20,0,2,0,1,1,70,1,74,0,0,0,1,0,3,0,
+77,1,68,1,69,0,1,0,13,0,44,0,58,0,155,0,169,0,191,0,205,0,230,0,244,1,6,1,
+12,1,22,1,36,1,56,0,2,0,0,0,2,0,1,0,23,0,24,0,1,0,1,0,0,0,10,0,88,1,42,0,
+3,68,70,76,84,0,20,107,110,100,50,0,40,107,110,100,97,0,60,0,4,0,0,0,0,255,
+255,0,5,0,0,0,2,0,5,0,8,0,11,0,4,0,0,0,0,255,255,0,5,0,1,0,3,0,6,0,9,0,12,
+0,4,0,0,0,0,255,255,0,4,0,4,0,7,0,10,0,13,0,14,97,107,104,110,0,86,97,107,
+104,110,0,92,98,108,119,102,0,98,98,108,119,102,0,104,98,108,119,102,0,110,
+104,97,108,110,0,116,104,97,108,110,0,122,104,97,108,110,0,128,112,114,101,
+115,0,134,112,114,101,115,0,154,112,114,101,115,0,174,114,112,104,102,0,192,
+114,112,104,102,0,198,114,112,104,102,0,204,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,
+1,0,2,0,0,0,1,0,2,0,0,0,1,0,3,0,0,0,1,0,17,0,0,0,1,0,17,0,0,0,1,0,17,0,0,
+0,8,0,4,0,5,0,6,0,12,0,13,0,14,0,15,0,16,0,0,0,8,0,4,0,5,0,6,0,12,0,13,0,
+14,0,15,0,16,0,0,0,7,0,4,0,5,0,12,0,13,0,14,0,15,0,16,0,0,0,1,0,1,0,0,0,1,
+0,1,0,0,0,1,0,1,0,25,0,52,0,60,0,68,0,76,0,84,0,92,0,102,0,110,0,120,0,130,
+0,140,0,150,0,160,0,182,0,190,0,200,0,208,0,218,0,226,0,234,0,242,0,250,1,
+2,1,10,1,18,0,4,0,0,0,1,0,230,0,4,0,0,0,1,1,0,0,4,0,0,0,1,1,10,0,4,0,0,0,
+1,2,60,0,4,0,8,0,1,3,234,0,6,0,0,0,2,7,192,7,210,0,4,0,0,0,1,7,218,0,6,0,
+0,0,2,8,0,8,18,0,6,0,0,0,2,8,26,8,42,0,6,0,0,0,2,8,48,8,64,0,6,0,0,0,2,8,
+70,8,86,0,6,0,0,0,2,8,92,8,108,0,6,0,0,0,8,8,114,8,138,8,162,8,186,8,210,
+8,234,9,2,9,26,0,4,0,0,0,1,9,28,0,6,0,8,0,2,9,122,9,140,0,4,0,0,0,1,9,148,
+0,6,0,0,0,2,10,10,10,26,0,4,0,8,0,1,10,34,0,1,0,0,0,1,11,232,0,1,0,0,0,1,
+11,230,0,1,0,0,0,1,11,238,0,1,0,0,0,1,11,248,0,1,0,0,0,1,11,250,0,1,0,0,0,
+1,11,252,0,1,0,0,0,1,12,78,0,1,12,180,0,2,0,10,0,22,0,1,0,4,1,70,0,3,0,76,
+0,67,0,1,0,4,1,75,0,3,0,76,0,46,0,1,12,154,0,1,0,8,0,1,0,4,0,98,0,2,0,76,
+0,1,12,142,0,1,0,8,0,38,0,78,0,84,0,90,0,96,0,102,0,108,0,114,0,120,0,126,
+0,132,0,138,0,144,0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,
+204,0,210,0,216,0,222,0,228,0,234,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,26,
+1,32,1,38,1,44,0,99,0,2,0,37,0,100,0,2,0,38,0,101,0,2,0,39,0,102,0,2,0,40,
+0,103,0,2,0,41,0,104,0,2,0,42,0,105,0,2,0,43,0,106,0,2,0,44,0,107,0,2,0,45,
+0,108,0,2,0,46,0,109,0,2,0,47,0,110,0,2,0,48,0,111,0,2,0,49,0,112,0,2,0,50,
+0,113,0,2,0,51,0,114,0,2,0,52,0,115,0,2,0,53,0,116,0,2,0,54,0,117,0,2,0,55,
+0,118,0,2,0,56,0,119,0,2,0,57,0,120,0,2,0,58,0,121,0,2,0,59,0,122,0,2,0,60,
+0,123,0,2,0,61,0,124,0,2,0,62,0,125,0,2,0,63,0,126,0,2,0,64,0,127,0,2,0,65,
+0,128,0,2,0,66,0,129,0,2,0,67,0,130,0,2,0,68,0,131,0,2,0,69,0,132,0,2,0,70,
+0,133,0,2,0,71,0,134,0,2,0,72,0,135,0,2,1,70,0,136,0,2,1,75,0,1,11,90,0,36,
+0,78,0,88,0,98,0,108,0,118,0,128,0,138,0,148,0,158,0,168,0,178,0,188,0,198,
+0,208,0,218,0,228,0,238,0,248,1,2,1,12,1,22,1,32,1,42,1,52,1,62,1,72,1,82,
+1,92,1,102,1,112,1,122,1,132,1,142,1,152,1,162,1,172,0,1,0,4,0,99,0,2,0,76,
+0,1,0,4,0,100,0,2,0,76,0,1,0,4,0,101,0,2,0,76,0,1,0,4,0,102,0,2,0,76,0,1,
+0,4,0,103,0,2,0,76,0,1,0,4,0,104,0,2,0,76,0,1,0,4,0,105,0,2,0,76,0,1,0,4,
+0,106,0,2,0,76,0,1,0,4,0,107,0,2,0,76,0,1,0,4,0,108,0,2,0,76,0,1,0,4,0,109,
+0,2,0,76,0,1,0,4,0,110,0,2,0,76,0,1,0,4,0,111,0,2,0,76,0,1,0,4,0,112,0,2,
+0,76,0,1,0,4,0,113,0,2,0,76,0,1,0,4,0,114,0,2,0,76,0,1,0,4,0,115,0,2,0,76,
+0,1,0,4,0,116,0,2,0,76,0,1,0,4,0,117,0,2,0,76,0,1,0,4,0,118,0,2,0,76,0,1,
+0,4,0,119,0,2,0,76,0,1,0,4,0,120,0,2,0,76,0,1,0,4,0,121,0,2,0,76,0,1,0,4,
+0,122,0,2,0,76,0,1,0,4,0,123,0,2,0,76,0,1,0,4,0,124,0,2,0,76,0,1,0,4,0,125,
+0,2,0,76,0,1,0,4,0,126,0,2,0,76,0,1,0,4,0,127,0,2,0,76,0,1,0,4,0,128,0,2,
+0,76,0,1,0,4,0,129,0,2,0,76,0,1,0,4,0,130,0,2,0,76,0,1,0,4,0,131,0,2,0,76,
+0,1,0,4,0,132,0,2,0,76,0,1,0,4,0,133,0,2,0,76,0,1,0,4,0,134,0,2,0,76,0,1,
+9,164,0,36,0,78,0,96,0,114,0,132,0,176,0,204,0,238,1,0,1,18,1,46,1,90,1,124,
+1,142,1,160,1,178,1,212,1,230,1,248,2,10,2,28,2,46,2,90,2,134,2,152,2,170,
+2,198,2,226,2,244,3,6,3,50,3,68,3,86,3,104,3,122,3,150,3,194,0,2,0,6,0,12,
+0,223,0,2,0,21,1,15,0,2,0,29,0,2,0,6,0,12,0,224,0,2,0,21,1,16,0,2,0,29,0,
+2,0,6,0,12,0,225,0,2,0,21,1,17,0,2,0,29,0,5,0,12,0,20,0,26,0,32,0,38,1,51,
+0,3,0,29,0,24,0,226,0,2,0,21,1,3,0,2,0,23,1,9,0,2,0,24,1,18,0,2,0,29,0,3,
+0,8,0,16,0,22,1,52,0,3,0,29,0,24,0,227,0,2,0,21,1,19,0,2,0,29,0,4,0,10,0,
+16,0,22,0,28,0,220,0,2,0,20,0,228,0,2,0,21,1,20,0,2,0,29,1,63,0,2,0,34,0,
+2,0,6,0,12,0,229,0,2,0,21,1,21,0,2,0,29,0,2,0,6,0,12,0,230,0,2,0,21,1,22,
+0,2,0,29,0,3,0,8,0,16,0,22,1,53,0,3,0,29,0,24,0,231,0,2,0,21,1,23,0,2,0,29,
+0,5,0,12,0,20,0,26,0,32,0,38,1,54,0,3,0,29,0,24,0,232,0,2,0,21,1,4,0,2,0,
+23,1,10,0,2,0,24,1,24,0,2,0,29,0,4,0,10,0,16,0,22,0,28,0,221,0,2,0,20,0,233,
+0,2,0,21,1,25,0,2,0,29,1,64,0,2,0,34,0,2,0,6,0,12,0,234,0,2,0,21,1,26,0,2,
+0,29,0,2,0,6,0,12,0,235,0,2,0,21,1,27,0,2,0,29,0,2,0,6,0,12,0,236,0,2,0,21,
+1,28,0,2,0,29,0,4,0,10,0,16,0,22,0,28,0,222,0,2,0,20,0,237,0,2,0,21,1,29,
+0,2,0,29,1,65,0,2,0,34,0,2,0,6,0,12,0,238,0,2,0,21,1,30,0,2,0,29,0,2,0,6,
+0,12,0,239,0,2,0,21,1,31,0,2,0,29,0,2,0,6,0,12,0,240,0,2,0,21,1,32,0,2,0,
+29,0,2,0,6,0,12,0,241,0,2,0,21,1,33,0,2,0,29,0,2,0,6,0,12,0,242,0,2,0,21,
+1,34,0,2,0,29,0,5,0,12,0,20,0,26,0,32,0,38,1,55,0,3,0,29,0,24,0,243,0,2,0,
+21,1,5,0,2,0,23,1,11,0,2,0,24,1,35,0,2,0,29,0,5,0,12,0,20,0,26,0,32,0,38,
+1,56,0,3,0,29,0,24,0,244,0,2,0,21,1,6,0,2,0,23,1,12,0,2,0,24,1,36,0,2,0,29,
+0,2,0,6,0,12,0,245,0,2,0,21,1,37,0,2,0,29,0,2,0,6,0,12,0,246,0,2,0,21,1,38,
+0,2,0,29,0,3,0,8,0,16,0,22,1,57,0,3,0,29,0,24,0,247,0,2,0,21,1,39,0,2,0,29,
+0,3,0,8,0,16,0,22,1,58,0,3,0,29,0,24,0,248,0,2,0,21,1,40,0,2,0,29,0,2,0,6,
+0,12,0,249,0,2,0,21,1,41,0,2,0,29,0,2,0,6,0,12,0,250,0,2,0,21,1,42,0,2,0,
+29,0,5,0,12,0,20,0,26,0,32,0,38,1,59,0,3,0,29,0,24,0,251,0,2,0,21,1,7,0,2,
+0,23,1,13,0,2,0,24,1,43,0,2,0,29,0,2,0,6,0,12,0,252,0,2,0,21,1,44,0,2,0,29,
+0,2,0,6,0,12,0,253,0,2,0,21,1,45,0,2,0,29,0,2,0,6,0,12,0,254,0,2,0,21,1,46,
+0,2,0,29,0,2,0,6,0,12,0,255,0,2,0,21,1,47,0,2,0,29,0,3,0,8,0,16,0,22,1,60,
+0,3,0,29,0,24,1,0,0,2,0,21,1,48,0,2,0,29,0,5,0,12,0,20,0,26,0,32,0,38,1,61,
+0,3,0,29,0,24,1,1,0,2,0,21,1,8,0,2,0,23,1,14,0,2,0,24,1,49,0,2,0,29,0,3,0,
+8,0,16,0,22,1,62,0,3,0,29,0,24,1,2,0,2,0,21,1,50,0,2,0,29,0,3,0,1,5,208,0,
+1,5,218,0,0,0,1,0,0,0,18,0,3,0,1,5,206,0,1,5,200,0,0,0,1,0,0,0,19,0,1,5,198,
+0,2,0,10,0,28,0,2,0,6,0,12,1,73,0,2,0,21,1,74,0,2,0,29,0,2,0,6,0,12,1,78,
+0,2,0,21,1,79,0,2,0,29,0,3,0,0,0,1,5,160,0,1,5,172,0,1,0,0,0,19,0,3,0,0,0,
+1,5,142,0,1,5,160,0,1,0,0,0,20,0,3,0,0,0,1,5,136,0,0,0,1,0,0,0,20,0,3,0,0,
+0,1,5,126,0,0,0,1,0,0,0,20,0,3,0,0,0,1,5,104,0,0,0,1,0,0,0,21,0,3,0,0,0,1,
+5,94,0,0,0,1,0,0,0,21,0,3,0,0,0,1,5,72,0,0,0,1,0,0,0,22,0,3,0,0,0,1,5,62,
+0,0,0,1,0,0,0,22,0,3,0,0,0,1,5,40,0,0,0,1,0,0,0,23,0,3,0,0,0,1,5,30,0,0,0,
+1,0,0,0,23,0,3,0,1,5,20,0,2,5,28,5,8,0,0,0,2,0,0,0,7,0,1,0,8,0,3,0,1,4,252,
+0,2,5,10,4,240,0,0,0,2,0,0,0,7,0,1,0,9,0,3,0,1,4,228,0,2,4,248,4,216,0,0,
+0,2,0,0,0,7,0,1,0,10,0,3,0,1,4,204,0,2,4,230,4,192,0,0,0,2,0,0,0,7,0,1,0,
+11,0,3,0,1,4,212,0,2,4,188,4,174,0,0,0,2,0,0,0,7,0,1,0,8,0,3,0,1,4,188,0,
+2,4,170,4,150,0,0,0,2,0,0,0,7,0,1,0,9,0,3,0,1,4,164,0,2,4,152,4,126,0,0,0,
+2,0,0,0,7,0,1,0,10,0,3,0,1,4,140,0,2,4,134,4,102,0,0,0,2,0,0,0,7,0,1,0,11,
+0,1,4,124,0,8,0,22,0,32,0,42,0,52,0,62,0,72,0,82,0,92,0,1,0,4,1,70,0,2,0,
+129,0,1,0,4,1,75,0,2,0,108,0,1,0,4,0,135,0,2,0,129,0,1,0,4,0,136,0,2,0,108,
+0,1,0,4,1,73,0,2,0,129,0,1,0,4,1,78,0,2,0,108,0,1,0,4,1,74,0,2,0,129,0,1,
+0,4,1,79,0,2,0,108,0,3,0,0,0,1,4,42,0,1,4,64,0,1,0,0,0,23,0,3,0,1,4,54,0,
+1,4,46,0,0,0,1,0,0,0,23,0,1,4,48,0,8,0,22,0,32,0,42,0,52,0,62,0,96,0,106,
+0,116,0,1,0,4,0,140,0,2,0,125,0,1,0,4,0,141,0,2,0,125,0,1,0,4,0,142,0,2,0,
+125,0,1,0,4,0,143,0,2,0,125,0,4,0,10,0,16,0,22,0,28,0,137,0,2,0,25,0,138,
+0,2,0,36,0,139,0,2,0,124,0,144,0,2,0,125,0,1,0,4,0,145,0,2,0,125,0,1,0,4,
+0,146,0,2,0,125,0,1,0,4,0,147,0,2,0,125,0,3,0,1,3,44,0,1,3,198,0,1,3,2,0,
+0,0,3,0,1,3,198,0,1,3,250,0,0,0,1,0,0,0,24,0,1,3,102,0,38,0,82,0,92,0,102,
+0,112,0,122,0,132,0,142,0,152,0,162,0,172,0,182,0,192,0,202,0,212,0,222,0,
+232,0,242,0,252,1,6,1,16,1,26,1,36,1,46,1,56,1,66,1,76,1,86,1,96,1,106,1,
+116,1,126,1,136,1,146,1,156,1,166,1,176,1,186,1,196,0,1,0,4,0,184,0,2,0,76,
+0,1,0,4,0,185,0,2,0,76,0,1,0,4,0,186,0,2,0,76,0,1,0,4,0,187,0,2,0,76,0,1,
+0,4,0,188,0,2,0,76,0,1,0,4,0,189,0,2,0,76,0,1,0,4,0,190,0,2,0,76,0,1,0,4,
+0,191,0,2,0,76,0,1,0,4,0,192,0,2,0,76,0,1,0,4,0,193,0,2,0,76,0,1,0,4,0,194,
+0,2,0,76,0,1,0,4,0,195,0,2,0,76,0,1,0,4,0,196,0,2,0,76,0,1,0,4,0,197,0,2,
+0,76,0,1,0,4,0,198,0,2,0,76,0,1,0,4,0,199,0,2,0,76,0,1,0,4,0,200,0,2,0,76,
+0,1,0,4,0,201,0,2,0,76,0,1,0,4,0,202,0,2,0,76,0,1,0,4,0,203,0,2,0,76,0,1,
+0,4,0,204,0,2,0,76,0,1,0,4,0,205,0,2,0,76,0,1,0,4,0,206,0,2,0,76,0,1,0,4,
+0,207,0,2,0,76,0,1,0,4,0,208,0,2,0,76,0,1,0,4,0,209,0,2,0,76,0,1,0,4,0,210,
+0,2,0,76,0,1,0,4,0,211,0,2,0,76,0,1,0,4,0,212,0,2,0,76,0,1,0,4,0,213,0,2,
+0,76,0,1,0,4,0,214,0,2,0,76,0,1,0,4,0,215,0,2,0,76,0,1,0,4,0,216,0,2,0,76,
+0,1,0,4,0,217,0,2,0,76,0,1,0,4,0,218,0,2,0,76,0,1,0,4,0,219,0,2,0,76,0,1,
+0,4,1,72,0,2,0,76,0,1,0,4,1,77,0,2,0,76,0,1,1,44,0,247,0,2,2,42,0,5,0,129,
+0,129,0,129,0,129,1,69,0,2,2,40,0,6,0,108,0,108,0,108,0,108,0,20,0,20,0,2,
+2,38,0,2,0,23,0,23,0,2,2,28,0,2,0,24,0,24,0,2,2,26,0,42,1,66,1,67,0,148,0,
+149,0,150,0,151,0,152,0,153,0,154,0,155,0,156,0,157,0,158,0,159,0,160,0,161,
+0,162,0,163,0,164,0,165,0,166,0,167,0,168,0,169,0,170,0,171,0,172,0,173,0,
+174,0,175,0,176,0,177,0,178,0,179,0,180,0,181,0,182,0,183,0,34,0,34,1,71,
+1,76,0,2,1,132,0,52,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,
+1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,
+1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,
+117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,
+1,130,1,131,0,1,0,2,0,37,0,44,0,1,0,1,0,63,0,1,0,1,0,76,0,2,0,1,0,37,0,72,
+0,0,0,1,0,3,0,58,0,244,1,36,0,1,0,1,0,77,0,1,0,3,1,6,1,12,1,56,0,1,0,2,1,
+70,1,75,0,1,0,4,0,20,0,23,0,24,0,34,0,1,0,1,0,129,0,1,0,1,0,108,0,1,0,2,0,
+37,1,15,0,1,0,1,0,20,0,1,0,1,0,23,0,1,0,1,0,24,0,1,0,1,0,34,0,1,0,2,0,44,
+1,22,0,1,0,8,0,37,0,44,0,99,0,106,0,223,0,230,1,15,1,22,0,2,0,3,0,37,0,72,
+0,0,1,70,1,70,0,36,1,75,1,75,0,37,0,1,0,2,0,20,0,34,0,1,0,4,0,152,0,157,0,
+181,0,183,0,1,0,8,0,99,0,101,0,109,0,111,0,114,0,116,0,119,0,121,0,2,0,2,
+0,99,0,136,0,0,0,139,0,147,0,38,0,2,0,8,0,27,0,28,0,0,0,99,0,136,0,2,0,139,
+0,147,0,40,1,70,1,70,0,49,1,73,1,75,0,50,1,78,1,79,0,53,1,83,1,120,0,55,1,
+123,1,131,0,93,0,2,0,3,0,25,0,26,0,0,0,36,0,36,0,2,0,99,0,147,0,3,0,1,0,5,
+0,20,0,23,0,24,0,34,0,77,0,1,0,6,0,20,0,23,0,24,0,34,0,108,0,129,0,1,0,2,
+0,108,0,129,0,2,0,7,0,20,0,20,0,0,0,34,0,34,0,1,0,37,0,72,0,2,0,108,0,108,
+0,38,0,129,0,129,0,39,1,70,1,70,0,40,1,75,1,75,0,41,};
+#endif
@@ -0,0 +1,3483 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifKhmer_Regular_ttf_size = 86916;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifKhmer_Regular_ttf");
+asm(".type fz_font_NotoSerifKhmer_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifKhmer_Regular_ttf, 86916");
+asm(".balign 64");
+asm("fz_font_NotoSerifKhmer_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifKhmer-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifKhmer_Regular_ttf_size = 86916;
+const char fz_font_NotoSerifKhmer_Regular_ttf[] = {
+0,1,0,0,0,16,1,0,0,4,0,0,71,68,69,70,0,16,1,46,0,1,30,172,0,0,0,22,71,80,
+79,83,0,21,0,10,0,1,30,196,0,0,0,12,71,83,85,66,132,169,96,227,0,1,30,208,
+0,0,11,236,79,83,47,50,162,6,17,223,0,0,1,136,0,0,0,96,99,109,97,112,205,
+12,80,134,0,0,7,100,0,0,0,170,99,118,116,32,57,126,62,76,0,0,8,16,0,0,1,252,
+103,97,115,112,0,4,0,7,0,1,30,160,0,0,0,12,103,108,121,102,158,175,226,168,
+0,0,12,204,0,0,252,236,104,101,97,100,3,177,82,142,0,0,1,12,0,0,0,54,104,
+104,101,97,19,165,15,38,0,0,1,68,0,0,0,36,104,109,116,120,30,188,235,177,
+0,0,1,232,0,0,5,124,108,111,99,97,205,154,12,16,0,0,10,12,0,0,2,192,109,97,
+120,112,3,249,8,83,0,0,1,104,0,0,0,32,109,111,114,120,49,209,159,42,0,1,42,
+188,0,0,40,200,110,97,109,101,220,63,35,241,0,1,9,184,0,0,5,96,112,111,115,
+116,199,31,67,42,0,1,15,24,0,0,15,133,0,1,0,0,0,2,7,174,69,134,143,137,95,
+15,60,245,0,31,8,0,0,0,0,0,200,23,79,246,0,0,0,0,210,135,176,217,246,98,251,
+80,19,124,9,196,0,0,0,8,0,2,0,0,0,0,0,0,0,1,0,0,9,196,251,80,0,0,20,118,246,
+98,254,0,19,124,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,95,0,1,0,0,1,95,1,29,0,
+16,0,0,0,0,0,2,0,16,0,47,0,90,0,0,2,31,7,5,0,0,0,0,0,2,4,124,1,144,0,5,0,
+0,5,154,5,51,0,0,1,30,5,154,5,51,0,0,3,208,0,102,1,242,0,0,2,11,6,6,3,8,4,
+2,2,4,224,0,2,239,64,0,32,91,0,1,0,40,0,0,0,0,71,79,79,71,0,64,0,0,37,204,
+9,196,251,80,0,0,9,196,4,176,32,0,1,17,65,0,0,0,4,74,5,182,0,0,0,32,0,2,8,
+0,0,0,0,0,0,0,8,0,0,0,2,20,0,0,2,170,0,211,3,68,0,117,4,121,0,82,4,121,0,
+135,7,43,0,92,5,240,0,74,1,195,0,117,2,197,0,117,2,197,0,66,4,0,0,84,4,121,
+0,133,2,0,0,61,2,123,0,51,2,74,0,164,2,78,0,0,4,121,0,92,4,121,0,135,4,121,
+0,104,4,121,0,119,4,121,0,35,4,121,0,113,4,121,0,125,4,121,0,121,4,121,0,
+94,4,121,0,104,2,76,0,166,2,0,0,61,4,121,0,133,4,121,0,133,4,121,0,133,4,
+0,0,88,7,94,0,133,3,109,0,102,4,121,1,254,3,109,0,102,4,125,0,113,0,0,0,0,
+4,29,0,133,2,123,0,51,4,29,0,133,5,170,0,180,5,170,0,250,5,170,0,180,8,89,
+0,100,5,170,0,100,5,170,0,150,5,170,0,100,5,170,0,150,11,58,0,140,8,114,0,
+150,5,170,0,250,5,170,0,100,5,170,0,250,8,114,0,150,11,8,0,140,5,170,0,180,
+5,170,0,150,5,170,0,250,5,170,0,150,5,170,0,250,5,195,0,100,5,170,0,150,5,
+170,0,150,5,195,0,100,5,195,0,100,8,114,0,250,2,201,0,100,8,114,0,140,2,201,
+0,100,5,170,0,180,5,195,0,100,8,114,0,250,8,89,0,100,8,114,0,250,5,195,0,
+100,5,195,0,100,8,139,0,100,5,170,0,180,8,89,0,250,5,170,0,250,5,170,0,180,
+5,220,0,250,5,170,0,180,5,195,0,100,5,195,0,100,5,170,0,150,5,170,0,150,5,
+170,0,100,5,170,0,150,5,170,0,180,5,170,0,250,5,170,0,180,2,176,255,6,0,0,
+251,136,0,0,251,136,0,0,251,86,0,0,251,136,0,0,254,32,0,0,253,84,0,0,252,
+245,0,0,251,136,2,176,253,200,2,176,253,194,2,201,0,100,2,201,0,63,2,201,
+0,63,2,176,255,6,2,176,255,6,0,0,252,74,3,182,0,250,3,82,0,250,0,0,252,54,
+0,0,250,236,0,0,252,224,0,0,251,211,0,0,252,39,0,0,252,89,0,0,251,205,0,0,
+252,74,0,0,251,80,0,0,252,99,0,0,252,49,6,2,0,250,7,58,0,250,4,126,0,250,
+5,208,0,250,20,118,0,250,6,14,1,44,15,80,0,250,2,201,0,100,6,14,0,250,6,14,
+0,250,6,114,0,100,7,20,0,250,6,14,0,250,6,14,0,250,6,14,0,100,6,252,0,250,
+6,14,0,250,6,14,0,250,0,0,251,155,0,0,251,155,0,0,251,155,2,201,252,224,0,
+0,251,155,0,0,251,105,0,0,251,105,0,0,251,57,2,201,251,253,0,0,250,236,0,
+0,248,242,0,0,251,155,0,0,251,156,0,0,251,155,2,201,251,125,0,0,246,98,0,
+0,251,155,0,0,251,55,0,0,251,155,0,0,251,140,0,0,251,80,2,201,254,74,0,0,
+251,155,0,0,251,155,0,0,251,5,0,0,251,55,2,201,254,74,2,201,0,100,0,0,251,
+14,0,0,251,155,2,201,253,218,0,0,251,130,0,0,251,115,0,0,254,62,0,0,253,84,
+0,0,252,245,0,0,251,130,0,0,251,130,0,0,251,130,0,0,251,130,0,0,252,99,0,
+0,252,114,0,0,252,124,8,114,0,150,2,176,0,0,2,201,0,100,0,0,251,136,2,176,
+253,200,2,176,253,194,0,0,252,124,0,0,252,124,0,0,252,124,0,0,252,124,0,0,
+253,118,0,0,253,98,0,0,253,58,0,0,252,130,0,0,248,248,0,0,248,249,0,0,248,
+248,0,0,248,223,0,0,252,224,0,0,252,74,0,0,252,114,0,0,251,130,0,0,250,35,
+0,0,249,196,0,0,251,130,0,0,250,152,0,0,250,57,0,0,251,80,0,0,251,155,5,170,
+0,180,5,170,0,250,5,170,0,180,8,89,0,100,5,170,0,100,5,170,0,150,5,170,0,
+100,5,170,0,150,11,58,0,140,8,114,0,150,5,170,0,250,5,170,0,100,5,170,0,250,
+8,114,0,150,11,8,0,140,5,170,0,180,5,170,0,150,5,170,0,250,5,170,0,150,5,
+170,0,250,5,170,0,150,5,170,0,150,5,170,0,150,5,195,0,100,5,195,0,100,8,114,
+0,250,2,201,0,100,8,114,0,140,2,176,0,100,8,114,0,250,8,89,0,100,8,114,0,
+250,5,195,0,100,5,145,252,224,5,145,251,253,5,145,251,125,5,145,254,74,5,
+145,254,74,5,145,253,218,8,114,0,150,5,170,0,180,5,170,0,250,5,170,0,180,
+8,89,0,100,5,170,0,100,5,170,0,150,5,170,0,100,5,170,0,150,11,58,0,140,8,
+114,0,150,5,170,0,250,5,170,0,100,5,170,0,250,8,114,0,150,11,8,0,140,5,170,
+0,180,5,170,0,150,5,170,0,250,5,170,0,150,5,170,0,250,5,170,0,150,5,170,0,
+150,5,170,0,150,5,195,0,100,5,195,0,100,8,114,0,250,2,201,0,100,8,114,0,140,
+2,176,0,100,8,114,0,250,8,89,0,100,8,114,0,250,5,170,0,100,5,145,252,224,
+5,145,251,253,5,145,251,125,5,145,254,74,5,145,254,74,5,145,253,218,8,114,
+0,150,11,58,0,150,11,58,0,250,5,120,0,100,2,176,253,200,2,176,253,194,2,176,
+0,226,2,176,255,6,2,176,255,6,6,14,1,44,0,0,249,143,3,32,0,150,3,32,0,101,
+1,44,0,100,5,16,0,100,3,32,0,100,3,32,0,100,2,38,0,100,4,26,0,100,1,246,0,
+100,3,132,0,100,6,14,0,250,6,14,0,250,6,114,0,100,7,20,0,250,6,14,0,250,6,
+14,0,250,6,14,0,100,6,252,0,250,6,14,0,250,6,14,0,250,11,195,0,250,12,28,
+0,250,12,128,0,250,13,34,0,250,12,28,0,250,12,28,0,250,6,14,0,250,6,14,0,
+250,6,114,0,100,7,20,0,250,6,14,0,250,6,14,0,250,6,14,0,100,6,252,0,250,6,
+14,0,250,6,14,0,250,11,195,0,250,12,28,0,250,12,128,0,250,13,34,0,250,12,
+28,0,250,12,28,0,250,0,0,255,213,0,0,255,33,4,193,0,98,0,0,0,1,0,3,0,1,0,
+0,0,12,0,4,0,158,0,0,0,34,0,32,0,4,0,2,0,0,0,13,0,64,0,126,0,171,0,173,0,
+187,23,179,23,181,23,219,23,221,23,233,23,249,25,255,32,13,37,204,255,255,
+0,0,0,0,0,13,0,32,0,123,0,171,0,173,0,187,23,128,23,180,23,182,23,220,23,
+224,23,240,25,224,32,11,37,204,255,255,0,1,255,245,255,227,255,169,255,126,
+255,125,255,112,232,172,233,122,232,170,233,84,232,166,233,66,231,92,0,0,
+219,146,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,
+0,0,0,0,40,1,92,1,93,0,0,6,20,0,11,0,78,5,182,0,23,0,117,5,182,5,205,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,4,74,0,20,0,143,0,0,255,236,0,0,0,0,255,236,0,0,0,
+0,255,236,0,0,254,20,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,172,0,182,0,188,0,0,0,213,0,
+0,0,0,0,0,0,85,0,131,0,151,0,159,0,125,0,229,0,174,0,174,0,113,0,113,0,0,
+0,0,0,186,0,197,0,186,0,0,0,0,0,164,0,159,0,140,0,0,0,0,0,199,0,199,0,125,
+0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,176,0,185,0,138,0,0,0,0,0,155,0,166,0,143,
+0,119,0,0,0,0,0,0,0,0,0,0,0,150,0,0,0,0,0,0,0,0,0,0,0,105,0,110,0,144,0,180,
+0,193,0,213,0,0,0,0,0,0,0,0,0,102,0,111,0,120,0,150,0,192,0,213,1,71,0,0,
+0,0,0,0,0,254,1,58,0,197,0,120,0,254,1,22,1,246,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,238,0,0,0,150,0,136,0,174,0,150,0,137,1,12,0,150,1,24,
+0,0,3,29,0,148,2,90,0,130,3,150,0,0,0,168,0,140,0,0,0,0,2,121,0,217,0,180,
+1,10,0,0,1,131,0,109,0,127,0,160,0,0,0,0,0,109,0,136,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,147,0,160,0,0,0,130,0,137,0,0,0,0,0,0,0,0,0,0,5,182,252,148,
+0,17,255,239,0,131,0,143,0,0,0,0,0,109,0,123,0,0,0,0,0,0,0,0,0,0,0,188,1,
+170,3,84,0,0,0,0,0,188,0,182,1,215,1,149,0,0,0,150,1,0,0,174,5,182,254,188,
+254,111,254,131,0,111,2,173,0,0,0,0,0,0,0,0,0,0,0,39,0,60,0,117,0,219,1,82,
+1,216,1,229,2,11,2,49,2,88,2,112,2,149,2,162,2,194,2,207,3,14,3,60,3,131,
+3,228,4,33,4,110,4,194,4,219,5,72,5,159,5,216,6,24,6,44,6,64,6,83,6,164,7,
+59,7,119,7,132,7,191,7,247,7,247,8,25,8,38,8,73,8,174,9,9,9,129,10,18,10,
+121,10,245,11,123,11,207,12,128,13,48,13,135,13,235,14,90,14,249,15,118,15,
+242,16,103,16,205,17,60,17,164,18,6,18,111,18,204,19,71,19,176,20,67,20,132,
+20,254,21,71,21,199,22,50,22,197,23,37,23,196,24,68,24,196,25,68,25,177,26,
+72,26,176,27,87,27,198,28,95,28,228,29,121,29,250,30,139,30,223,31,122,32,
+7,32,127,33,29,33,63,33,95,33,128,33,188,33,228,33,246,34,32,34,86,34,119,
+34,177,34,236,35,42,35,150,35,253,36,31,36,77,36,122,36,205,37,9,37,37,37,
+106,37,124,37,183,37,251,38,16,38,74,38,119,38,132,38,153,38,204,38,250,39,
+56,39,158,39,234,40,181,41,23,42,166,42,240,43,41,43,109,43,204,44,5,44,81,
+44,182,45,3,45,89,45,183,46,43,46,73,46,142,46,184,47,19,47,84,47,182,47,
+241,48,91,48,202,49,13,49,106,49,152,49,218,50,53,50,171,50,245,51,35,51,
+93,51,164,52,27,52,95,52,158,52,201,53,5,53,51,53,114,53,177,53,231,54,47,
+54,98,54,170,54,228,55,16,55,34,55,75,55,129,55,162,55,196,56,4,56,44,56,
+89,56,110,56,155,57,14,57,14,57,68,57,156,57,214,58,16,58,49,58,83,58,147,
+58,187,58,232,59,4,59,72,59,160,59,208,60,18,60,109,60,167,60,215,61,7,61,
+70,61,89,61,131,61,185,61,204,61,245,62,43,62,106,62,164,63,10,63,126,63,
+247,64,136,65,2,65,126,66,4,66,111,67,32,67,237,68,93,68,215,69,93,69,252,
+70,146,71,14,71,153,72,21,72,133,73,5,73,108,73,235,74,99,74,222,75,70,75,
+217,76,44,76,166,77,5,77,151,78,13,78,172,79,43,79,133,79,243,80,103,80,164,
+80,225,81,38,81,182,82,42,82,169,83,48,83,204,84,82,84,220,85,113,85,231,
+86,164,87,124,87,248,88,126,89,16,89,187,90,93,90,231,91,125,92,5,92,131,
+93,14,93,131,94,13,94,145,95,27,95,143,96,45,96,139,97,17,97,124,98,26,98,
+155,99,69,99,208,100,53,100,174,101,46,101,118,101,190,102,15,102,170,103,
+170,104,112,104,245,105,47,105,106,105,129,105,163,105,197,106,51,106,84,
+106,112,106,132,106,145,106,175,106,194,106,231,106,245,107,14,107,29,107,
+62,107,207,108,58,108,192,109,33,109,148,110,32,110,148,111,18,111,152,112,
+51,112,214,113,128,114,69,114,228,115,149,116,95,117,21,117,128,118,6,118,
+103,118,218,119,102,119,218,120,88,120,222,121,121,122,28,122,198,123,138,
+124,41,124,218,125,164,125,177,125,207,126,118,0,2,0,211,255,242,1,213,5,
+182,0,3,0,23,0,0,19,51,3,35,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,221,
+238,72,94,82,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,5,182,251,230,
+254,225,40,53,32,14,14,32,53,40,39,54,32,14,14,32,54,0,2,0,117,3,213,2,207,
+5,182,0,3,0,7,0,0,1,51,3,35,1,51,3,35,1,246,217,62,94,254,66,217,62,94,5,
+182,254,31,1,225,254,31,0,2,0,82,0,0,4,39,5,182,0,3,0,31,0,0,1,33,19,33,1,
+21,33,3,35,19,33,3,35,19,35,53,51,19,35,53,33,19,51,3,33,19,51,3,51,21,35,
+3,1,141,1,29,76,254,227,2,53,254,254,78,122,77,254,228,78,123,78,168,190,
+78,244,1,11,73,125,75,1,28,76,123,76,160,182,76,2,25,1,145,254,111,121,254,
+96,1,160,254,96,1,160,121,1,145,121,1,147,254,109,1,147,254,109,121,254,111,
+0,3,0,135,255,94,3,233,6,20,0,50,0,59,0,70,0,0,1,30,3,21,20,6,35,52,46,2,
+39,17,30,3,21,20,6,7,21,35,53,34,46,2,39,17,51,20,30,2,23,17,46,3,53,52,62,
+2,55,53,51,19,52,46,2,39,17,54,54,1,20,30,2,23,17,14,3,2,109,92,129,82,37,
+88,74,15,39,70,54,92,142,96,50,198,182,103,51,104,99,91,38,86,43,79,109,66,
+96,133,82,37,49,90,129,80,103,192,20,46,73,53,92,100,254,53,21,42,61,40,40,
+62,41,21,5,121,2,37,61,82,48,66,67,45,91,75,52,6,254,34,40,80,93,113,73,154,
+171,19,248,244,9,21,32,22,1,59,57,107,85,55,5,1,250,43,84,93,108,67,69,112,
+83,51,9,159,251,123,41,65,56,48,24,254,57,16,117,3,11,43,65,50,40,18,1,173,
+9,39,55,70,0,5,0,92,255,236,6,207,5,203,0,19,0,39,0,59,0,79,0,83,0,0,1,20,
+14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,20,30,2,51,50,62,2,53,52,46,2,35,
+34,14,2,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,20,30,2,51,50,62,2,53,
+52,46,2,35,34,14,2,1,35,1,51,2,252,42,84,126,84,88,127,82,39,39,82,128,89,
+84,125,83,42,254,24,16,36,58,42,42,58,35,15,15,35,56,42,42,59,37,16,5,187,
+42,84,126,84,88,128,81,39,39,82,128,89,84,125,83,42,254,24,16,36,58,42,42,
+58,34,15,15,34,56,42,42,59,37,16,253,129,135,2,219,134,4,6,103,168,120,66,
+66,120,168,103,103,167,119,64,64,119,167,103,88,139,96,50,50,96,139,88,87,
+136,95,49,49,95,136,253,87,103,168,120,65,65,120,168,103,103,167,119,64,64,
+119,167,103,88,139,96,50,50,96,139,88,87,136,95,49,49,95,136,253,245,5,182,
+0,3,0,74,255,236,5,221,5,203,0,62,0,78,0,96,0,0,33,39,14,3,35,34,46,2,53,
+52,62,2,55,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,1,62,3,53,53,33,21,35,
+34,14,2,7,6,6,7,23,30,3,51,51,21,37,50,62,2,55,1,14,3,21,20,30,2,1,52,46,
+2,35,34,6,21,20,30,2,23,62,3,4,150,170,37,89,108,131,78,123,183,121,60,47,
+85,121,74,39,59,39,20,44,94,147,102,98,138,87,39,38,83,131,94,1,117,14,18,
+11,4,1,113,19,34,66,57,45,13,18,47,35,190,15,32,43,59,42,18,252,103,60,103,
+86,72,29,254,59,47,75,53,28,44,81,112,1,46,20,45,73,52,91,98,16,35,54,39,
+60,89,58,28,180,42,73,54,31,62,113,158,97,87,129,98,74,31,46,85,84,88,50,
+68,110,80,43,46,80,106,59,66,102,86,77,40,254,117,46,95,91,87,37,80,86,8,
+29,55,47,66,154,77,203,15,20,12,4,86,94,25,44,61,36,1,229,26,63,83,104,66,
+75,115,79,40,4,72,41,70,51,30,106,88,39,68,67,72,43,26,58,69,84,0,1,0,117,
+3,213,1,78,5,182,0,3,0,0,19,51,3,35,117,217,62,94,5,182,254,31,0,1,0,117,
+254,250,2,131,6,20,0,21,0,0,1,20,30,2,23,21,46,2,2,53,52,18,54,54,55,21,14,
+3,1,74,19,64,125,105,141,200,127,58,58,127,200,141,105,125,64,19,2,137,122,
+238,213,180,64,94,56,160,221,1,33,185,185,1,31,220,159,56,92,64,179,212,238,
+0,0,1,0,66,254,250,2,80,6,20,0,21,0,0,1,52,46,2,39,53,30,2,18,21,20,2,6,6,
+7,53,62,3,1,123,19,65,124,105,141,200,126,59,59,126,200,141,105,124,65,19,
+2,137,122,238,212,179,64,92,56,159,220,254,225,185,185,254,223,221,160,56,
+94,64,180,213,238,0,0,1,0,84,3,6,3,160,6,20,0,17,0,0,19,55,5,3,51,3,37,23,
+5,5,7,37,19,35,19,5,39,37,84,72,1,59,53,178,57,1,61,72,254,166,1,90,72,254,
+195,57,178,51,254,199,72,1,88,4,244,162,199,1,69,254,189,192,159,101,100,
+158,191,254,188,1,68,195,160,102,0,1,0,133,1,37,3,244,4,147,0,11,0,0,1,17,
+35,17,33,53,33,17,51,17,33,21,2,121,123,254,135,1,121,123,1,123,2,160,254,
+133,1,123,121,1,122,254,134,121,0,1,0,61,254,197,1,141,1,8,0,23,0,0,37,20,
+14,2,7,53,54,54,53,52,46,4,53,52,54,51,50,30,2,1,141,36,81,127,92,101,94,
+22,34,38,34,22,77,57,32,56,44,25,86,65,122,104,83,27,86,32,92,60,20,27,21,
+20,28,41,31,59,62,23,45,67,0,1,0,51,1,225,2,72,2,123,0,3,0,0,19,53,33,21,
+51,2,21,1,225,154,154,0,0,1,0,164,255,242,1,166,1,8,0,19,0,0,55,52,62,2,51,
+50,30,2,21,20,14,2,35,34,46,2,164,20,35,47,27,26,47,35,21,21,35,47,26,27,
+47,35,20,125,40,53,32,14,14,32,53,40,39,54,32,14,14,32,54,0,0,1,0,0,255,8,
+2,78,6,20,0,3,0,0,23,35,1,51,121,121,1,215,119,248,7,12,0,2,0,92,255,236,
+4,29,5,203,0,19,0,39,0,0,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,
+22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,4,29,59,120,180,121,126,
+182,117,56,56,117,183,127,120,179,120,59,253,20,28,63,103,74,75,102,63,27,
+27,63,101,74,75,103,64,28,2,221,169,254,234,198,108,108,198,1,23,170,170,
+1,20,196,106,106,196,254,235,171,152,239,165,87,87,165,239,152,152,238,164,
+85,85,164,238,0,0,1,0,135,0,0,3,209,5,190,0,31,0,0,51,53,51,50,62,2,53,17,
+14,3,35,34,38,53,62,3,55,55,51,17,20,30,2,51,51,21,197,137,35,61,45,27,39,
+70,64,61,30,45,58,31,63,71,83,51,144,131,26,46,61,35,100,86,10,31,58,48,4,
+52,48,78,56,31,61,49,8,23,37,53,37,106,251,43,48,58,31,10,86,0,0,1,0,104,
+0,0,3,227,5,203,0,47,0,0,1,20,14,2,7,1,33,50,62,2,55,55,51,3,33,53,1,62,3,
+53,52,46,2,35,34,14,2,21,34,46,2,53,52,62,2,51,50,30,2,3,176,46,88,127,81,
+254,166,1,217,46,60,38,21,7,8,86,10,252,143,1,86,82,111,68,30,25,51,79,54,
+70,87,50,18,37,64,48,27,51,101,150,99,97,154,108,57,4,117,72,136,143,154,
+89,254,129,26,42,55,30,37,254,158,150,1,139,95,150,133,127,70,59,95,69,37,
+50,84,110,61,12,31,51,39,59,101,74,41,49,89,126,0,1,0,119,255,236,4,2,5,203,
+0,74,0,0,37,50,62,2,53,52,46,2,35,35,53,51,50,62,2,53,52,46,2,35,34,14,2,
+21,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,7,30,5,21,20,14,4,35,34,46,2,
+53,52,54,51,20,30,2,1,252,61,110,84,50,51,96,138,86,65,65,68,117,87,50,24,
+53,83,59,70,88,50,18,37,64,48,27,51,102,150,99,97,158,113,62,49,88,120,71,
+38,86,84,77,59,35,44,77,102,116,122,59,101,146,95,45,70,59,35,66,97,90,34,
+78,126,92,65,105,74,41,104,45,82,117,73,60,94,66,34,50,84,110,61,12,31,51,
+39,59,101,74,41,44,83,121,78,69,122,99,70,17,4,19,36,54,78,103,68,82,130,
+97,68,42,19,37,62,83,45,62,69,54,91,66,37,0,2,0,35,0,0,4,92,5,182,0,24,0,
+39,0,0,1,21,20,30,2,51,51,21,33,53,51,50,62,2,53,53,33,53,1,51,17,51,21,1,
+52,62,2,55,14,5,7,1,33,3,94,27,45,62,34,27,253,151,58,35,61,45,27,253,137,
+2,121,194,254,254,62,2,3,5,4,7,26,33,37,37,32,12,254,198,1,228,1,145,168,
+48,58,31,10,86,86,10,31,58,48,168,84,3,209,252,78,115,1,238,45,108,112,111,
+48,14,47,58,64,61,53,18,254,24,0,1,0,113,255,236,3,227,5,180,0,53,0,0,37,
+50,62,2,53,52,46,2,35,34,14,2,7,39,19,33,19,35,39,46,3,35,33,3,54,54,51,50,
+30,2,21,20,14,2,35,34,46,2,53,52,54,51,20,30,2,1,233,63,107,79,44,44,82,114,
+71,53,77,59,44,19,49,66,2,172,10,86,8,3,11,24,41,32,254,115,39,31,117,91,
+99,171,126,71,67,127,184,117,114,149,88,36,63,66,31,61,93,100,35,81,133,97,
+81,120,80,39,8,13,16,8,14,2,213,254,203,61,22,31,21,10,254,62,11,22,54,108,
+163,108,104,172,123,67,39,60,73,34,57,64,44,76,55,32,0,2,0,125,255,236,4,
+16,5,203,0,42,0,58,0,0,1,34,2,3,62,3,51,50,30,2,21,20,14,2,35,34,38,38,2,
+53,52,62,4,51,50,30,2,21,20,6,35,52,46,2,3,34,14,2,7,30,3,51,50,54,53,52,
+38,2,147,154,158,11,25,61,72,85,50,94,152,107,58,59,113,163,105,102,174,127,
+72,29,58,88,119,150,90,86,127,84,41,80,77,19,44,68,121,40,74,65,54,21,2,39,
+70,100,61,110,115,125,5,104,254,209,254,213,21,39,29,18,58,108,156,98,108,
+180,129,72,85,183,1,31,202,97,186,166,140,101,56,36,60,78,41,59,64,50,87,
+65,37,253,168,21,33,43,21,154,218,138,64,171,186,175,160,0,0,1,0,121,0,0,
+4,23,5,180,0,10,0,0,33,1,33,34,7,7,35,19,33,21,1,1,133,1,227,253,230,110,
+9,8,86,10,3,148,254,8,5,16,104,102,1,114,59,250,135,0,0,3,0,94,255,236,4,
+27,5,203,0,39,0,57,0,77,0,0,19,52,62,2,55,46,3,53,52,62,2,51,50,30,2,21,20,
+14,2,7,30,3,21,20,14,2,35,34,46,2,5,50,62,2,53,52,46,2,39,6,6,21,20,30,2,
+1,52,46,2,35,34,14,2,21,20,30,2,23,62,3,94,47,84,114,67,58,98,70,39,50,106,
+169,118,96,150,103,54,40,72,102,62,76,125,90,49,70,128,182,112,115,174,117,
+59,1,219,67,109,77,42,38,86,137,99,97,114,35,69,104,1,48,25,55,89,65,57,89,
+60,31,35,69,104,68,58,75,44,18,1,111,74,111,87,70,32,33,77,92,109,64,71,132,
+102,62,53,94,129,77,67,102,81,65,31,36,82,96,112,67,97,153,106,55,60,105,
+141,212,41,72,100,59,52,89,83,79,43,52,166,116,64,104,75,41,4,37,47,90,71,
+43,37,65,90,53,55,88,72,63,32,29,61,73,87,0,0,2,0,104,255,233,3,252,5,203,
+0,42,0,61,0,0,37,50,18,19,14,3,35,34,46,2,53,52,62,2,51,50,22,22,18,21,20,
+14,4,35,34,46,2,53,52,54,55,30,3,19,62,3,55,53,46,3,35,34,6,21,20,30,2,1,
+211,170,162,10,22,59,75,91,54,89,149,107,59,60,113,163,103,104,174,128,71,
+27,57,89,123,160,99,87,115,67,28,38,23,14,41,59,76,134,50,83,64,47,14,2,40,
+70,97,59,109,119,30,60,89,90,1,48,1,52,27,50,39,23,52,104,156,104,111,185,
+133,75,80,168,254,252,180,107,205,182,152,111,61,31,50,64,32,38,52,8,32,59,
+45,26,2,82,1,27,45,60,33,4,135,195,126,60,190,181,84,120,76,35,0,2,0,166,
+255,242,1,168,4,84,0,19,0,39,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,
+2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,166,20,35,47,27,26,47,35,21,
+21,35,47,26,27,47,35,20,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,125,
+40,53,32,14,14,32,53,40,39,54,32,14,14,32,54,3,115,40,53,32,14,14,32,53,40,
+39,54,33,14,14,33,54,0,2,0,61,254,197,1,141,4,84,0,23,0,43,0,0,37,20,14,2,
+7,53,54,54,53,52,46,4,53,52,54,51,50,30,2,1,52,62,2,51,50,30,2,21,20,14,2,
+35,34,46,2,1,141,36,81,127,92,101,94,22,34,38,34,22,77,57,32,56,44,25,254,
+244,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,86,65,122,104,83,27,86,
+32,92,60,20,27,21,20,28,41,31,59,62,23,45,67,3,72,40,53,32,14,14,32,53,40,
+39,54,33,14,14,33,54,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,53,1,21,1,1,
+21,133,3,111,253,80,2,176,2,184,72,1,217,137,254,139,254,143,137,0,0,2,0,
+133,1,213,3,244,3,225,0,3,0,7,0,0,1,21,33,53,1,21,33,53,3,244,252,145,3,111,
+252,145,2,78,121,121,1,147,121,121,0,1,0,133,0,225,3,244,4,217,0,6,0,0,55,
+53,1,1,53,1,21,133,2,176,253,80,3,111,225,137,1,113,1,117,137,254,39,72,0,
+2,0,88,255,242,3,152,5,203,0,37,0,57,0,0,1,35,17,62,3,53,52,46,2,35,34,14,
+2,21,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,7,3,52,62,2,51,50,30,2,21,20,
+14,2,35,34,46,2,2,10,125,89,121,73,31,26,54,85,59,64,87,54,24,37,62,45,26,
+45,95,144,99,97,164,120,68,53,102,148,95,194,20,35,47,27,26,47,35,21,21,35,
+47,26,27,47,35,20,1,156,1,55,36,95,111,121,61,53,87,61,34,42,72,95,53,17,
+33,50,33,49,84,62,35,50,95,138,88,84,138,114,94,39,253,250,40,53,32,14,14,
+32,53,40,39,54,32,14,14,32,54,0,0,2,0,133,254,221,6,242,5,182,0,91,0,110,
+0,0,1,20,14,2,35,34,38,39,35,14,3,35,34,46,2,53,52,62,4,51,50,22,23,55,51,
+3,6,7,6,6,21,20,30,2,51,50,62,2,53,52,46,2,35,34,14,4,21,20,30,2,51,50,62,
+2,55,23,14,3,35,34,36,38,2,53,52,18,62,3,51,50,4,22,22,1,20,22,51,50,62,2,
+55,19,38,38,35,34,14,4,6,242,72,116,143,71,91,121,29,11,21,53,67,83,52,62,
+113,85,51,25,53,83,116,151,94,66,95,31,82,49,104,3,4,3,4,21,34,45,25,45,94,
+76,49,86,153,213,128,100,193,172,147,106,60,98,167,221,124,84,150,131,111,
+44,48,51,126,147,169,95,165,254,236,199,112,63,119,169,212,249,140,172,1,
+4,174,87,251,229,87,69,52,76,52,32,9,78,13,65,37,61,99,75,54,35,16,3,35,148,
+239,168,90,98,88,40,68,50,28,42,86,132,90,55,128,127,119,91,55,36,25,43,253,
+246,24,24,20,48,21,36,53,35,16,72,139,202,130,134,205,139,71,56,109,157,201,
+244,140,171,241,153,70,29,48,61,32,74,38,73,57,35,91,184,1,20,186,145,1,7,
+226,183,129,70,102,177,241,254,49,108,105,45,72,92,47,1,160,29,32,53,86,111,
+116,110,0,1,0,102,254,250,3,6,6,20,0,41,0,0,1,34,46,2,53,17,52,46,2,39,53,
+62,3,53,17,52,54,51,51,21,35,34,6,21,17,20,6,7,21,22,22,21,17,20,22,51,51,
+21,2,127,72,111,74,38,37,66,88,51,51,88,66,37,149,146,135,61,91,77,113,115,
+118,110,77,91,61,254,250,42,76,109,68,1,100,63,82,49,21,2,86,2,20,49,82,62,
+1,101,140,152,88,108,107,254,162,100,133,19,2,20,132,102,254,158,105,110,
+88,0,0,1,1,254,254,20,2,121,6,20,0,3,0,0,1,35,17,51,2,121,123,123,254,20,
+8,0,0,1,0,102,254,250,3,6,6,20,0,41,0,0,23,51,50,54,53,17,52,54,55,53,38,
+38,53,17,52,38,35,35,53,51,50,22,21,17,20,30,2,23,21,14,3,21,17,20,14,2,35,
+35,102,62,91,77,109,118,114,113,77,91,62,136,145,149,38,65,88,51,51,88,65,
+38,38,74,110,72,136,174,110,105,1,98,102,132,20,2,19,133,100,1,94,107,108,
+88,152,140,254,155,62,82,49,20,2,86,2,21,49,82,63,254,156,68,109,76,42,0,
+0,1,0,113,2,39,4,10,3,141,0,37,0,0,1,34,46,2,39,46,3,35,34,6,7,35,62,3,51,
+50,30,2,23,30,3,51,50,54,55,51,14,3,3,8,30,64,63,57,23,23,44,43,44,23,60,
+58,11,120,6,25,56,95,76,34,68,64,57,24,22,42,41,42,21,57,54,14,123,7,28,57,
+93,2,39,25,38,45,21,21,39,30,18,116,121,64,128,102,64,26,40,48,21,20,37,28,
+17,123,114,64,128,102,64,0,0,2,0,133,0,164,3,152,3,174,0,6,0,13,0,0,19,1,
+51,3,19,35,1,37,1,51,3,19,35,1,133,1,57,103,207,207,103,254,199,1,115,1,57,
+103,207,207,103,254,199,2,74,1,100,254,123,254,123,1,100,66,1,100,254,123,
+254,123,1,100,0,1,0,51,1,225,2,72,2,123,0,3,0,0,19,53,33,21,51,2,21,1,225,
+154,154,0,0,2,0,133,0,164,3,152,3,174,0,6,0,13,0,0,1,1,35,19,3,51,1,5,1,35,
+19,3,51,1,3,152,254,198,102,207,207,102,1,58,254,141,254,199,103,207,207,
+103,1,57,2,8,254,156,1,133,1,133,254,156,66,254,156,1,133,1,133,254,156,0,
+0,2,0,180,0,0,5,20,5,220,0,23,0,71,0,0,33,35,17,52,39,38,35,35,34,7,6,21,
+17,35,17,52,55,54,51,51,50,23,22,21,0,53,53,52,55,55,54,51,50,23,23,22,51,
+50,55,55,54,51,50,23,23,22,51,50,55,6,35,34,39,39,38,35,34,7,6,35,34,39,39,
+38,35,34,7,6,21,20,23,7,4,176,188,78,78,106,50,106,78,78,188,125,125,200,
+50,200,125,125,252,4,65,66,131,32,37,108,54,27,30,25,26,50,101,36,35,57,118,
+35,36,26,25,70,65,68,36,78,40,33,43,58,59,50,72,86,44,43,38,43,22,22,137,
+129,2,238,58,49,49,49,49,58,253,18,2,238,100,100,100,100,100,100,1,22,99,
+75,52,61,61,124,112,56,29,29,56,112,62,125,37,18,167,39,81,41,80,81,81,40,
+40,37,37,36,50,70,91,0,0,2,0,250,0,0,4,176,5,220,0,6,0,65,0,0,1,21,50,53,
+52,39,38,4,53,53,52,39,38,35,35,34,7,6,21,21,50,23,22,21,20,35,34,53,53,52,
+55,54,51,51,50,23,22,21,21,20,5,5,21,20,23,22,51,51,50,55,54,53,17,55,17,
+20,7,6,35,35,34,39,38,53,53,37,1,182,48,13,12,2,39,78,78,106,50,106,78,78,
+74,37,37,148,188,125,125,200,50,200,125,125,254,131,254,131,78,78,106,50,
+106,78,78,188,125,125,200,50,200,125,125,1,220,4,1,75,50,12,7,6,82,107,150,
+58,49,49,49,49,58,75,31,32,62,150,100,250,100,100,100,100,100,100,150,172,
+197,196,185,58,49,49,49,49,58,1,44,100,254,112,100,100,100,100,100,100,250,
+245,0,2,0,180,0,0,5,20,5,220,0,47,0,87,0,0,18,53,53,52,55,55,54,51,50,23,
+23,22,51,50,55,55,54,51,50,23,23,22,51,50,55,6,35,34,39,39,38,35,34,7,6,35,
+34,39,39,38,35,34,7,6,21,20,23,7,19,7,35,17,52,55,54,51,51,50,23,22,21,17,
+35,17,52,39,38,35,35,34,7,6,21,17,55,54,51,50,21,20,35,34,53,52,35,34,7,7,
+180,65,66,131,32,37,108,54,27,30,25,26,50,101,36,35,57,118,35,36,26,25,70,
+65,68,36,78,40,33,43,58,59,50,72,86,44,43,38,43,22,22,137,129,100,20,168,
+125,125,200,50,200,125,125,188,78,78,106,50,106,78,78,45,79,100,138,77,57,
+24,24,50,49,4,4,99,75,52,61,61,124,112,56,29,29,56,112,62,125,37,18,167,39,
+81,41,80,81,81,40,40,37,37,36,50,70,91,252,124,67,2,238,100,100,100,100,100,
+100,253,18,2,238,58,49,49,49,49,58,254,62,72,128,120,80,33,33,83,82,0,0,2,
+0,100,0,0,7,245,5,220,0,6,0,102,0,0,1,6,21,20,23,22,51,21,34,39,38,53,52,
+55,54,55,54,51,50,21,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,23,23,
+22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,23,22,51,50,55,54,53,17,39,
+38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,7,6,35,
+34,39,38,39,6,7,6,35,34,39,38,53,1,19,50,15,15,20,100,37,38,22,22,66,65,64,
+124,78,78,106,106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,
+68,43,192,78,78,106,106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,
+38,57,68,43,192,125,125,200,200,125,17,14,14,17,125,200,200,125,125,4,242,
+50,31,25,11,10,139,50,50,55,57,49,50,95,94,100,251,180,58,49,49,49,49,58,
+2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,58,
+49,49,49,49,58,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,
+113,252,224,100,100,100,100,13,14,14,13,100,100,100,100,0,0,3,0,100,0,0,4,
+176,6,164,0,6,0,14,0,72,0,0,19,53,6,21,20,23,22,1,52,35,34,21,20,23,54,1,
+37,5,17,52,39,38,39,6,35,34,39,38,53,52,54,53,52,35,52,51,50,21,20,6,21,20,
+22,51,50,55,38,53,52,51,50,21,20,7,22,23,22,21,17,35,37,5,35,17,34,38,53,
+52,54,54,51,50,21,250,40,10,10,2,188,50,50,58,42,254,20,1,31,1,31,44,44,36,
+142,166,158,83,89,50,100,100,188,50,82,60,114,73,77,190,190,78,21,22,165,
+188,254,225,254,225,188,80,70,39,111,94,94,2,127,97,20,31,25,10,11,2,169,
+46,46,34,38,25,251,193,237,237,2,201,108,34,24,24,89,69,75,116,65,135,70,
+70,100,170,85,115,70,69,47,29,71,76,180,180,77,71,11,11,88,163,252,125,236,
+236,1,244,100,55,57,89,99,100,0,2,0,150,0,0,5,20,5,220,0,6,0,88,0,0,1,53,
+6,21,20,23,22,1,20,23,22,51,51,50,55,54,53,17,34,38,53,52,54,54,51,50,21,
+17,20,7,6,35,35,34,39,38,53,17,38,38,53,52,54,55,55,54,51,50,23,23,22,51,
+50,55,55,54,51,50,23,23,22,51,50,55,6,35,34,39,39,38,35,34,7,6,35,34,39,39,
+38,35,34,7,7,6,21,20,31,2,3,244,40,10,10,253,214,78,78,106,50,106,78,78,80,
+70,39,111,94,94,125,125,200,50,200,125,125,70,30,30,66,65,131,32,37,108,54,
+27,30,25,26,50,101,36,35,57,118,35,36,26,25,70,65,68,36,78,40,33,43,58,59,
+50,72,86,44,43,38,23,19,39,8,19,30,61,2,227,97,20,31,25,10,11,254,73,58,49,
+49,49,49,58,1,44,100,55,57,89,99,100,253,168,100,100,100,100,100,100,2,198,
+66,51,38,37,52,62,61,123,112,56,29,29,56,112,62,125,37,18,167,39,81,41,80,
+81,81,40,40,22,44,9,10,16,20,33,66,0,0,3,0,100,0,0,5,20,5,220,0,6,0,12,0,
+96,0,0,1,53,6,21,20,23,22,1,34,6,21,20,23,19,32,21,20,51,50,53,17,34,38,53,
+52,54,54,51,50,21,17,20,33,32,53,52,35,17,35,39,38,53,52,54,51,17,38,38,53,
+52,54,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,51,50,55,6,35,
+34,39,39,38,35,34,7,6,35,34,39,39,38,35,34,7,7,6,21,20,31,2,3,244,40,10,10,
+253,26,20,20,40,188,1,50,156,112,80,70,39,111,94,94,254,212,254,212,162,188,
+75,75,80,70,70,30,30,66,65,131,32,37,108,54,27,30,25,26,50,101,36,35,57,118,
+35,36,26,25,70,65,68,36,78,40,33,43,58,59,50,72,86,44,43,38,23,19,39,8,19,
+30,61,2,227,97,20,31,25,10,11,254,139,21,30,31,50,1,10,250,106,106,1,94,100,
+55,57,89,99,100,253,118,250,250,116,254,146,124,124,97,65,90,1,254,66,51,
+38,37,52,62,61,123,112,56,29,29,56,112,62,125,37,18,167,39,81,41,80,81,81,
+40,40,22,44,9,10,16,20,33,66,0,1,0,150,0,0,4,176,6,164,0,57,0,0,37,37,5,17,
+51,17,35,37,5,35,17,38,38,53,52,54,55,55,54,51,50,23,22,51,50,55,54,53,52,
+35,34,53,52,51,50,23,22,21,20,7,6,35,34,39,39,38,35,34,7,6,7,7,6,21,20,31,
+2,1,182,1,31,1,31,188,188,254,225,254,225,188,70,30,30,65,66,131,29,29,152,
+156,82,92,42,42,146,100,100,130,75,75,85,86,139,191,137,64,35,27,6,5,31,32,
+23,10,18,30,61,186,237,237,3,46,252,24,236,236,3,242,66,51,38,37,52,61,61,
+124,112,108,35,35,70,102,89,89,81,81,118,142,76,76,98,45,27,1,7,37,25,11,
+12,17,19,33,66,0,0,2,0,140,0,0,10,214,5,220,0,6,0,126,0,0,37,54,53,52,39,
+38,35,53,50,23,22,21,20,7,6,7,7,35,17,39,38,53,52,55,55,54,51,50,23,23,22,
+21,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,
+6,7,6,35,34,39,39,7,23,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,23,
+23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,7,6,35,34,39,38,39,6,7,
+6,35,34,39,38,53,17,52,39,39,38,35,34,7,7,23,22,21,1,182,98,27,27,44,145,
+44,43,40,40,76,76,188,62,48,100,137,161,102,158,80,214,108,78,78,106,106,
+78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,78,106,
+106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,125,
+125,200,200,125,17,14,14,17,125,200,200,125,125,39,207,37,89,104,68,129,38,
+61,222,90,77,40,19,18,134,59,60,66,78,87,88,81,81,3,240,38,29,65,65,74,102,
+119,53,150,72,175,253,18,58,49,49,49,49,58,2,181,53,53,32,31,85,253,62,32,
+27,1,5,35,128,6,1,34,39,75,113,252,224,58,49,49,49,49,58,2,181,53,53,32,31,
+85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,100,100,100,100,13,14,
+14,13,100,100,100,100,2,238,76,28,142,26,51,98,25,38,60,0,0,3,0,150,253,168,
+7,120,5,220,0,6,0,80,0,125,0,0,37,54,53,52,39,38,35,1,35,17,52,39,39,38,35,
+34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,35,
+17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,54,55,54,
+51,50,22,21,17,35,17,52,38,35,34,6,21,1,52,55,54,51,50,23,22,21,20,6,35,34,
+39,38,39,38,39,38,35,34,7,6,7,52,55,54,54,51,50,4,23,22,22,51,50,54,53,52,
+39,6,35,34,38,38,1,182,98,27,27,44,2,250,188,34,68,11,11,24,24,55,56,58,79,
+55,73,25,20,13,11,44,6,93,145,44,43,40,40,76,76,188,100,133,132,46,48,95,
+74,6,8,20,30,41,83,52,37,61,62,39,27,11,12,125,170,200,250,188,156,106,96,
+166,1,159,30,31,63,86,43,44,214,173,135,113,111,120,119,124,123,87,91,89,
+89,74,36,38,168,141,159,1,0,133,132,150,82,70,109,2,15,16,19,37,20,222,90,
+77,40,19,18,254,46,4,145,76,21,41,6,28,60,60,1,49,68,24,9,38,6,9,34,77,253,
+234,59,60,66,78,87,88,81,81,4,38,107,43,43,123,122,88,72,5,32,45,88,38,39,
+25,35,11,11,115,230,120,251,130,4,126,78,128,128,78,250,186,50,25,25,50,50,
+100,150,150,38,37,88,87,50,50,22,23,45,60,43,42,95,94,97,97,78,66,100,15,
+12,8,22,38,0,3,0,250,0,0,4,176,6,164,0,11,0,24,0,58,0,0,1,17,37,5,17,51,17,
+35,37,5,35,17,19,20,23,51,50,53,52,39,38,35,34,7,6,23,22,23,22,51,50,54,53,
+52,35,34,53,52,51,32,17,20,6,35,34,39,39,38,38,53,52,55,54,51,50,23,22,21,
+20,1,182,1,31,1,31,188,188,254,225,254,225,188,158,29,24,53,12,14,27,26,14,
+13,177,29,32,42,47,143,134,112,100,100,1,44,233,232,54,47,96,96,192,52,53,
+90,91,51,52,3,182,253,4,237,237,3,46,252,24,236,236,3,252,1,38,29,21,50,24,
+12,14,13,12,118,3,2,2,86,76,146,98,80,254,188,108,198,2,5,5,119,109,83,54,
+53,43,43,75,75,0,2,0,100,0,0,5,70,6,164,0,6,0,70,0,0,1,6,21,20,23,22,51,37,
+7,23,17,20,7,6,35,35,34,39,38,53,17,34,39,38,53,52,55,54,55,54,51,50,21,17,
+20,23,22,51,51,50,55,54,53,17,39,38,53,52,19,22,51,51,54,53,52,39,38,53,52,
+55,54,51,50,23,22,21,20,7,6,35,34,1,19,50,15,15,20,3,3,24,203,125,125,200,
+50,200,125,125,100,37,38,22,22,66,65,64,124,78,78,106,50,106,78,78,87,88,
+154,135,31,3,27,96,83,2,15,68,67,83,82,50,51,44,45,4,242,50,31,25,11,10,136,
+60,115,252,224,100,100,100,100,100,100,2,188,50,50,55,57,49,50,95,94,100,
+251,180,58,49,49,49,49,58,2,181,53,53,32,31,1,82,132,8,64,62,40,35,48,8,8,
+59,60,60,140,132,51,51,0,2,0,250,255,156,4,176,5,220,0,6,0,80,0,0,0,35,21,
+50,53,52,39,39,50,23,22,21,20,35,34,53,53,52,55,54,51,50,23,54,51,50,23,22,
+21,21,20,5,5,21,20,23,22,51,50,55,54,55,54,51,53,55,17,20,35,34,53,54,53,
+53,34,7,6,7,6,35,34,39,38,53,17,37,36,53,53,52,39,38,35,34,7,38,35,34,7,6,
+21,1,205,23,48,13,35,74,37,37,148,188,116,116,63,52,129,128,53,62,115,116,
+254,131,254,131,24,24,41,59,51,151,73,74,77,188,154,104,70,48,47,47,127,127,
+89,129,74,74,1,220,1,30,75,18,21,68,104,105,69,21,18,75,4,1,75,50,12,7,106,
+31,32,62,150,100,250,122,89,89,134,134,89,89,122,150,172,197,196,235,53,26,
+27,42,126,44,44,183,90,253,145,150,72,32,56,206,31,32,101,102,58,59,133,1,
+44,245,148,107,150,64,52,13,130,130,13,52,64,0,0,3,0,150,0,0,8,14,5,220,0,
+6,0,12,0,114,0,0,37,54,53,52,39,38,35,5,34,6,21,20,23,17,52,39,39,38,35,34,
+7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,35,17,
+38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,21,17,32,21,20,
+51,50,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,
+23,17,20,33,32,53,52,35,17,35,39,38,53,52,54,51,1,182,98,27,27,44,2,62,20,
+20,40,34,68,11,11,24,24,55,56,58,79,55,73,25,20,13,11,44,6,93,145,44,43,40,
+40,76,76,188,100,133,132,46,48,95,74,6,8,20,30,41,83,52,37,61,62,122,1,40,
+116,112,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,254,212,
+254,252,152,188,75,75,80,70,222,90,77,40,19,18,100,21,30,31,50,3,167,76,21,
+41,6,28,60,60,1,49,68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,88,81,81,4,
+38,107,43,43,123,122,88,72,5,32,45,88,38,39,77,177,253,99,250,106,106,2,231,
+53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,174,250,250,116,
+254,146,124,124,97,65,90,0,2,0,140,0,0,10,14,5,220,0,6,0,85,0,0,37,54,53,
+52,39,38,35,1,47,3,38,35,34,7,6,7,23,22,21,17,50,23,22,21,20,7,6,7,7,35,17,
+39,38,53,52,55,55,54,51,50,31,2,22,21,17,37,5,17,39,38,53,52,55,55,54,51,
+50,31,2,22,21,17,35,17,47,3,38,35,34,7,6,7,23,22,21,17,35,37,5,35,1,182,98,
+27,27,44,2,12,149,29,21,121,57,31,56,74,74,24,51,61,145,44,43,40,40,76,76,
+188,62,48,83,125,124,93,83,72,121,201,108,1,6,1,6,62,48,83,125,124,93,83,
+72,121,201,108,188,149,29,21,121,57,31,56,74,74,24,51,61,188,254,250,254,
+250,188,222,90,77,40,19,18,2,171,68,13,10,56,26,56,56,28,34,38,60,254,62,
+59,60,66,78,87,88,81,81,3,240,38,29,65,65,74,110,111,33,55,92,50,121,252,
+61,216,216,3,54,38,29,65,65,74,110,111,33,55,92,50,121,251,131,4,125,68,13,
+10,56,26,56,56,28,34,38,60,251,230,215,215,0,0,3,0,180,0,0,5,20,5,220,0,47,
+0,54,0,87,0,0,19,53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,
+22,51,50,55,6,35,34,39,39,38,35,34,7,6,35,34,39,39,38,35,34,7,6,21,20,23,
+7,38,1,54,53,52,39,38,35,3,52,55,54,51,51,50,23,22,21,17,35,17,52,39,38,35,
+35,34,7,6,21,21,50,23,22,21,20,7,6,7,7,35,180,65,66,131,32,37,108,54,27,30,
+25,26,50,101,36,35,57,118,35,36,26,25,70,65,68,36,78,40,33,43,58,59,50,72,
+86,44,43,38,43,22,22,137,129,158,1,2,50,15,15,20,188,125,125,200,50,200,125,
+125,188,78,78,106,50,106,78,78,100,37,38,22,22,65,66,188,4,103,75,52,61,61,
+124,112,56,29,29,56,112,62,125,37,18,167,39,81,41,80,81,81,40,40,37,37,36,
+50,70,91,61,252,230,50,31,25,11,10,1,133,100,100,100,100,100,100,253,18,2,
+238,58,49,49,49,49,58,250,50,50,55,57,49,50,94,95,0,0,2,0,150,0,0,4,176,6,
+164,0,6,0,84,0,0,1,53,6,21,20,23,22,1,20,23,22,51,51,50,55,54,53,17,34,38,
+53,52,54,54,51,50,21,17,20,7,6,35,35,34,39,38,53,17,38,38,53,52,54,55,55,
+54,51,50,23,22,51,50,55,54,53,52,35,34,53,52,51,50,23,22,21,20,7,6,35,34,
+39,39,38,35,34,7,6,7,7,6,21,20,31,2,3,244,40,10,10,253,214,78,78,106,50,106,
+78,78,80,70,39,111,94,94,125,125,200,50,200,125,125,70,30,30,65,66,131,29,
+29,152,156,82,92,42,42,146,100,100,130,75,75,85,86,139,191,137,64,35,27,6,
+5,31,32,23,10,18,30,61,2,227,97,20,31,25,10,11,254,73,58,49,49,49,49,58,1,
+44,100,55,57,89,99,100,253,168,100,100,100,100,100,100,2,198,66,51,38,37,
+52,61,61,124,112,108,35,35,70,102,89,89,81,81,118,142,76,76,98,45,27,1,7,
+37,25,11,12,17,19,33,66,0,0,3,0,250,0,0,4,176,5,220,0,5,0,12,0,77,0,0,1,34,
+21,50,53,52,3,6,21,20,51,53,34,37,52,55,54,51,51,50,23,22,21,21,20,35,34,
+53,52,54,51,52,39,38,35,35,34,7,6,21,21,20,23,22,51,51,52,54,51,50,22,21,
+20,7,6,35,21,20,6,35,34,38,53,53,51,21,20,22,51,50,54,53,53,35,34,39,38,53,
+4,18,34,62,83,13,38,13,253,19,125,125,200,50,200,125,125,188,138,74,64,78,
+78,106,50,106,78,78,79,79,130,94,105,117,69,89,45,44,103,157,151,137,171,
+178,70,60,44,76,94,218,129,129,2,198,39,20,19,1,128,7,12,30,55,100,100,100,
+100,100,100,100,155,100,130,62,63,58,49,49,49,49,58,255,127,73,74,50,110,
+65,74,86,32,33,239,151,151,127,123,200,200,42,64,77,80,240,114,113,177,0,
+0,2,0,150,0,0,5,20,5,220,0,6,0,76,0,0,1,53,6,21,20,23,22,23,34,38,53,52,54,
+54,51,50,21,17,35,37,5,35,17,38,38,53,52,54,55,55,54,51,50,23,23,22,51,50,
+55,55,54,51,50,23,23,22,51,50,55,6,35,34,39,39,38,35,34,7,6,35,34,39,39,38,
+35,34,7,7,6,21,20,31,2,17,37,5,3,244,40,10,10,20,80,70,39,111,94,94,188,254,
+225,254,225,188,70,30,30,66,65,131,32,37,108,54,27,30,25,26,50,101,36,35,
+57,118,35,36,26,25,70,65,68,36,78,40,33,43,58,59,50,72,86,44,43,38,23,19,
+39,8,19,30,61,1,31,1,31,2,227,97,20,31,25,10,11,139,100,55,57,89,99,100,252,
+124,236,236,3,242,66,51,38,37,52,62,61,123,112,56,29,29,56,112,62,125,37,
+18,167,39,81,41,80,81,81,40,40,22,44,9,10,16,20,33,66,252,142,237,237,0,0,
+2,0,250,0,0,4,176,5,220,0,6,0,73,0,0,1,6,21,20,51,53,34,19,20,7,6,35,34,39,
+38,39,38,39,38,35,17,35,17,23,21,50,23,22,23,22,23,22,51,50,55,54,53,17,37,
+36,53,53,52,55,54,51,51,50,23,22,21,21,20,35,34,53,52,55,54,51,53,52,39,38,
+35,35,34,7,6,21,21,20,5,5,3,209,13,48,23,211,74,74,149,89,72,73,55,34,47,
+47,48,188,188,77,74,73,54,54,37,37,59,61,24,24,254,145,254,117,125,125,200,
+50,200,125,125,188,148,37,37,74,78,78,106,50,106,78,78,1,27,1,223,4,35,7,
+12,50,75,252,209,133,59,58,39,39,78,47,32,31,254,246,2,161,90,183,44,44,74,
+75,9,10,27,26,53,1,55,128,138,223,150,100,100,100,100,100,100,210,100,150,
+62,32,31,35,58,49,49,49,49,58,150,136,99,167,0,1,0,100,0,0,5,95,5,220,0,67,
+0,0,1,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,
+20,7,6,35,35,34,39,38,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,
+6,35,34,39,39,7,23,17,20,23,22,51,51,50,55,54,53,4,13,87,88,56,168,108,54,
+47,33,6,5,36,82,41,6,7,38,57,68,43,192,125,125,200,50,200,125,125,87,88,56,
+168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,78,106,50,106,78,78,
+3,225,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,100,
+100,100,100,100,100,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,
+75,113,252,224,58,49,49,49,49,58,0,2,0,150,0,0,4,176,6,164,0,6,0,72,0,0,1,
+53,6,21,20,23,22,1,37,5,17,34,38,53,52,54,54,51,50,21,17,35,37,5,35,17,38,
+38,53,52,54,55,55,54,51,50,23,22,51,50,55,54,53,52,35,34,53,52,51,50,23,22,
+21,20,7,6,35,34,39,39,38,35,34,7,6,7,7,6,21,20,31,2,3,244,40,10,10,253,214,
+1,31,1,31,80,70,39,111,94,94,188,254,225,254,225,188,70,30,30,65,66,131,29,
+29,152,156,82,92,42,42,146,100,100,130,75,75,85,86,139,191,137,64,35,27,6,
+5,31,32,23,10,18,30,61,2,227,97,20,31,25,10,11,253,215,237,237,1,158,100,
+55,57,89,99,100,252,124,236,236,3,242,66,51,38,37,52,61,61,124,112,108,35,
+35,70,102,89,89,81,81,118,142,76,76,98,45,27,1,7,37,25,11,12,17,19,33,66,
+0,0,2,0,150,0,0,4,176,5,220,0,6,0,64,0,0,37,54,53,52,39,38,35,53,50,23,22,
+21,20,7,6,7,7,35,17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,
+23,22,21,17,35,17,52,39,39,38,35,34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,
+23,1,182,98,27,27,44,145,44,43,40,40,76,76,188,100,133,132,46,48,95,74,6,
+8,20,30,41,83,52,37,61,62,122,188,34,68,11,11,24,24,55,56,58,79,55,73,25,
+20,13,11,44,6,93,222,90,77,40,19,18,134,59,60,66,78,87,88,81,81,4,38,107,
+43,43,123,122,88,72,5,32,45,88,38,39,77,177,251,111,4,145,76,21,41,6,28,60,
+60,1,49,68,24,9,38,6,9,34,77,0,3,0,100,0,0,5,45,5,220,0,47,0,54,0,87,0,0,
+19,53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,51,50,55,6,
+35,34,39,39,38,35,34,7,6,35,34,39,39,38,35,34,7,6,21,20,23,7,38,19,34,7,6,
+21,20,23,23,35,39,38,39,38,53,52,55,54,51,53,52,55,54,51,51,50,23,22,21,17,
+35,17,52,39,38,35,35,34,7,6,21,205,65,66,131,32,37,108,54,27,30,25,26,50,
+101,36,35,57,118,35,36,26,25,70,65,68,36,78,40,33,43,58,59,50,72,86,44,43,
+38,43,22,22,137,129,158,70,20,15,15,50,188,188,66,65,22,22,38,37,100,125,
+125,200,50,200,125,125,188,78,78,106,50,106,78,78,4,103,75,52,61,61,124,112,
+56,29,29,56,112,62,125,37,18,167,39,81,41,80,81,81,40,40,37,37,36,50,70,91,
+61,253,101,10,11,25,31,50,234,95,94,50,49,57,55,50,50,250,100,100,100,100,
+100,100,253,18,2,238,58,49,49,49,49,58,0,0,2,0,100,0,0,5,95,5,220,0,11,0,
+71,0,0,1,17,20,23,22,51,51,50,55,54,53,17,37,33,53,39,38,53,52,55,55,23,23,
+22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,7,6,35,35,34,39,38,53,17,39,
+38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,1,207,78,78,
+106,50,106,78,78,253,194,2,62,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,
+38,57,68,43,192,125,125,200,50,200,125,125,87,88,56,168,108,54,47,33,6,5,
+36,82,41,6,7,38,57,68,43,192,2,116,254,184,58,49,49,49,49,58,1,72,144,221,
+53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,100,100,100,
+100,100,100,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,
+0,2,0,250,0,0,8,14,5,220,0,6,0,104,0,0,1,50,55,54,53,52,39,17,20,23,22,51,
+51,50,55,54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,
+39,7,23,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,
+55,20,6,7,6,35,34,39,39,7,23,17,20,7,6,35,34,39,38,39,6,7,6,35,35,34,39,38,
+53,17,52,51,50,23,22,23,22,21,20,7,6,35,1,182,20,15,15,50,78,78,106,50,106,
+78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,78,106,
+106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,125,
+125,200,200,125,17,14,14,17,125,200,50,200,125,125,124,64,66,65,22,22,38,
+37,100,4,115,10,11,25,31,50,252,58,58,49,49,49,49,58,2,181,53,53,32,31,85,
+253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,58,49,49,49,49,58,2,181,
+53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,100,100,100,
+100,13,14,14,13,100,100,100,100,4,76,100,94,95,50,49,57,55,50,50,0,2,0,100,
+0,0,2,101,5,220,0,6,0,41,0,0,1,34,7,6,21,20,23,23,35,39,38,39,38,53,52,55,
+54,51,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,
+1,19,20,15,15,50,188,188,65,66,22,22,38,37,100,87,88,56,168,108,54,47,33,
+6,5,36,82,41,6,7,38,57,68,43,192,1,105,10,11,25,31,50,234,95,94,50,49,57,
+55,50,50,1,237,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,0,
+2,0,140,0,0,8,14,5,220,0,6,0,85,0,0,37,54,53,52,39,38,35,53,50,23,22,21,20,
+7,6,7,7,35,17,39,38,53,52,55,55,54,51,50,23,23,22,21,17,20,23,22,51,50,55,
+54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,
+17,20,7,6,35,34,39,38,53,17,52,39,39,38,35,34,7,7,23,22,21,1,182,98,27,27,
+44,145,44,43,40,40,76,76,188,62,48,100,137,161,102,158,80,214,108,78,78,106,
+106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,125,
+125,200,200,125,125,39,207,37,89,104,68,129,38,61,222,90,77,40,19,18,134,
+59,60,66,78,87,88,81,81,3,240,38,29,65,65,74,102,119,53,150,72,175,253,18,
+58,49,49,49,49,58,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,
+75,113,252,224,100,100,100,100,100,100,2,238,76,28,142,26,51,98,25,38,60,
+0,0,2,0,100,0,0,2,76,6,164,0,6,0,48,0,0,1,34,7,6,21,20,23,23,35,39,38,39,
+38,53,52,55,54,51,17,39,38,53,52,19,22,51,51,54,53,52,39,38,53,52,55,54,51,
+50,23,22,21,20,7,6,35,34,39,7,23,1,19,20,15,15,50,188,188,65,66,22,22,38,
+37,100,87,88,154,135,31,3,27,96,83,2,15,68,67,83,82,50,51,44,45,114,24,203,
+1,105,10,11,25,31,50,234,95,94,50,49,57,55,50,50,1,237,53,53,32,31,1,82,132,
+8,64,62,40,35,48,8,8,59,60,60,140,132,51,51,69,60,115,0,0,2,0,180,0,0,5,70,
+5,220,0,47,0,95,0,0,18,53,53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,
+50,23,23,22,51,50,55,6,35,34,39,39,38,35,34,7,6,35,34,39,39,38,35,34,7,6,
+21,20,23,7,1,53,52,39,38,35,35,34,7,6,21,17,55,54,51,50,21,20,35,34,53,52,
+35,34,15,3,35,17,52,55,54,51,51,50,23,22,21,21,51,21,35,17,35,17,35,53,180,
+65,66,131,32,37,108,54,27,30,25,26,50,101,36,35,57,118,35,36,26,25,70,65,
+68,36,78,40,33,43,58,59,50,72,86,44,43,38,43,22,22,137,129,2,162,78,78,106,
+50,106,78,78,45,79,100,138,77,57,24,24,50,49,81,20,168,125,125,200,50,200,
+125,125,150,150,188,162,4,4,99,75,52,61,61,124,112,56,29,29,56,112,62,125,
+37,18,167,39,81,41,80,81,81,40,40,37,37,36,50,70,91,254,89,206,58,49,49,49,
+49,58,254,62,72,128,120,80,33,33,83,82,134,67,2,238,100,100,100,100,100,100,
+206,144,254,112,1,144,144,0,0,1,0,100,0,0,5,95,5,220,0,75,0,0,1,53,39,38,
+53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,51,21,35,17,
+20,7,6,35,35,34,39,38,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,
+6,35,34,39,39,7,23,17,20,23,22,51,51,50,55,54,53,17,35,53,4,13,87,88,56,168,
+108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,125,125,125,125,200,50,200,
+125,125,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,78,
+106,50,106,78,78,187,2,232,249,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,
+34,39,75,113,254,156,144,254,212,100,100,100,100,100,100,2,181,53,53,32,31,
+85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,58,49,49,49,49,58,1,44,
+144,0,2,0,250,0,0,8,14,5,220,0,6,0,103,0,0,37,54,53,52,39,38,35,19,39,38,
+53,52,55,55,23,22,51,50,55,55,20,7,6,7,6,35,34,39,39,7,23,22,23,22,23,22,
+21,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,
+6,7,6,35,34,39,39,7,23,17,20,7,6,35,34,39,38,53,17,52,39,38,35,35,34,7,6,
+21,21,50,23,22,21,20,7,6,7,7,35,17,52,55,54,1,182,50,15,15,20,54,72,120,76,
+229,221,58,43,12,11,50,33,34,55,19,21,41,50,155,69,204,54,11,171,112,125,
+78,78,106,106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,
+192,125,125,200,200,125,125,78,78,106,50,106,78,78,100,37,38,22,22,65,66,
+188,125,52,234,50,31,25,11,10,2,143,33,55,27,31,85,253,100,27,2,10,35,61,
+61,17,6,23,71,89,95,25,41,10,89,100,100,254,62,58,49,49,49,49,58,2,181,53,
+53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,100,100,100,
+100,100,100,1,194,58,49,49,49,49,58,250,50,50,55,57,49,50,94,95,2,238,100,
+100,42,0,0,1,0,100,0,0,7,95,5,220,0,64,0,0,1,17,35,17,37,38,35,34,7,23,17,
+20,7,6,35,34,39,38,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,
+35,34,39,39,7,23,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,54,51,50,
+23,5,22,7,95,188,254,117,57,31,71,117,147,125,125,200,200,125,125,87,88,56,
+168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,78,106,106,78,78,87,
+88,81,120,121,93,83,72,1,141,108,4,90,251,166,4,90,182,26,136,86,252,224,
+100,100,100,100,100,100,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,
+34,39,75,113,252,224,58,49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,182,
+50,0,0,4,0,250,253,118,8,14,5,220,0,5,0,12,0,77,0,118,0,0,1,34,21,50,53,52,
+3,6,21,20,51,53,34,37,52,55,54,51,51,50,23,22,21,21,20,35,34,53,52,54,51,
+52,39,38,35,35,34,7,6,21,21,20,23,22,51,51,52,54,51,50,22,21,20,7,6,35,21,
+20,6,35,34,38,53,53,51,21,20,22,51,50,54,53,53,35,34,39,38,53,37,39,38,53,
+52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,35,37,5,35,17,
+34,53,52,55,54,51,50,21,17,37,5,4,18,34,62,83,13,38,13,253,19,125,125,200,
+50,200,125,125,188,138,74,64,78,78,106,50,106,78,78,79,79,130,94,105,117,
+69,89,45,44,103,157,151,137,171,178,70,60,44,76,94,218,129,129,5,194,87,88,
+56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,188,254,250,254,250,
+188,112,56,56,64,124,1,6,1,6,2,198,39,20,19,1,128,7,12,30,55,100,100,100,
+100,100,100,100,155,100,130,62,63,58,49,49,49,49,58,255,127,73,74,50,110,
+65,74,86,32,33,239,151,151,127,123,200,200,42,64,77,80,240,114,113,177,48,
+53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,249,42,215,215,1,
+94,90,50,55,55,100,254,198,216,216,0,3,0,100,0,0,5,95,5,220,0,6,0,13,0,87,
+0,0,1,34,7,6,21,20,23,37,34,7,6,21,20,23,5,35,39,38,39,38,53,52,55,54,51,
+53,33,17,35,39,38,39,38,53,52,55,54,51,17,39,38,53,52,55,55,23,23,22,51,50,
+55,55,20,6,7,6,35,34,39,39,7,23,17,33,53,39,38,53,52,55,55,23,23,22,51,50,
+55,55,20,6,7,6,35,34,39,39,7,23,4,13,20,15,15,50,253,6,20,15,15,50,3,182,
+188,65,66,22,22,38,37,100,253,194,188,65,66,22,22,38,37,100,87,88,56,168,
+108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,2,62,87,88,56,168,108,54,47,
+33,6,5,36,82,41,6,7,38,57,68,43,192,1,105,10,11,25,31,50,127,10,11,25,31,
+50,234,95,94,50,49,57,55,50,50,158,253,110,95,94,50,49,57,55,50,50,1,237,
+53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,254,214,191,53,53,
+32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,0,3,0,100,0,0,5,95,5,220,
+0,6,0,13,0,87,0,0,1,34,7,6,21,20,23,37,34,7,6,21,20,23,5,35,39,38,39,38,53,
+52,55,54,51,53,33,17,35,39,38,39,38,53,52,55,54,51,17,39,38,53,52,55,55,23,
+23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,33,53,39,38,53,52,55,55,23,
+23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,4,13,20,15,15,50,253,6,20,15,
+15,50,3,182,188,65,66,22,22,38,37,100,253,194,188,65,66,22,22,38,37,100,87,
+88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,2,62,87,88,56,168,
+108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,1,105,10,11,25,31,50,127,10,
+11,25,31,50,234,95,94,50,49,57,55,50,50,158,253,110,95,94,50,49,57,55,50,
+50,1,237,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,254,214,
+191,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,0,3,0,100,0,0,
+7,145,5,220,0,6,0,13,0,86,0,0,1,34,7,6,21,20,23,37,34,7,6,21,20,23,1,39,38,
+53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,17,35,39,38,39,
+38,53,52,55,54,51,53,33,17,35,39,38,39,38,53,52,55,54,51,17,39,38,53,52,55,
+55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,33,4,13,20,15,15,50,
+253,6,20,15,15,50,2,250,87,88,81,120,121,93,83,72,1,141,108,188,254,117,57,
+31,71,117,147,188,65,66,22,22,38,37,100,253,194,188,65,66,22,22,38,37,100,
+87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,2,62,1,105,10,
+11,25,31,50,127,10,11,25,31,50,2,247,53,53,32,31,85,126,127,33,182,50,121,
+251,166,4,90,182,26,136,86,251,180,95,94,50,49,57,55,50,50,158,253,110,95,
+94,50,49,57,55,50,50,1,237,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,
+39,75,113,254,214,0,3,0,180,0,0,4,176,6,164,0,6,0,39,0,78,0,0,37,54,53,52,
+39,38,35,3,52,55,54,51,51,50,23,22,21,17,35,17,52,39,38,35,35,34,7,6,21,21,
+50,23,22,21,20,7,6,7,7,35,3,53,52,55,54,51,50,23,22,51,50,54,53,52,35,34,
+53,52,51,50,23,22,21,20,7,6,35,34,39,39,38,35,34,6,21,20,23,7,38,1,182,50,
+15,15,20,188,125,125,200,50,200,125,125,188,78,78,106,50,106,78,78,100,37,
+38,22,22,65,66,188,70,131,131,32,37,108,111,130,102,104,146,100,100,130,75,
+75,85,86,169,232,86,44,43,28,43,54,137,129,158,234,50,31,25,11,10,1,133,100,
+100,100,100,100,100,253,18,2,238,58,49,49,49,49,58,250,50,50,55,57,49,50,
+94,95,4,103,75,52,122,124,112,108,70,70,102,93,85,81,81,118,142,76,76,82,
+40,40,64,46,50,70,91,61,0,0,3,0,250,253,118,7,245,6,164,0,6,0,39,0,111,0,
+0,37,54,53,52,39,38,35,1,35,17,52,39,38,35,35,34,7,6,21,17,50,23,22,21,20,
+7,6,7,7,35,17,52,55,54,51,51,50,23,22,21,5,39,38,53,52,19,22,51,51,54,53,
+52,39,38,53,52,55,54,51,50,23,22,21,20,7,6,35,34,39,7,23,17,20,35,33,34,53,
+53,52,39,38,35,34,7,6,21,21,50,23,22,21,20,7,6,35,34,53,53,52,55,54,51,50,
+23,22,21,21,20,51,33,50,53,1,182,50,15,15,20,2,250,188,78,78,106,50,106,78,
+78,100,37,38,22,22,65,66,188,125,125,200,50,200,125,125,2,12,87,88,154,135,
+31,3,27,96,83,2,15,68,67,83,82,50,51,44,45,114,24,203,237,254,37,238,78,78,
+81,81,78,78,90,28,27,72,73,64,124,125,125,175,175,125,125,144,1,31,143,234,
+50,31,25,11,10,254,151,4,176,58,49,49,49,49,58,253,68,50,50,55,57,49,50,94,
+95,4,176,100,100,100,100,100,100,207,53,53,32,31,1,82,132,8,64,62,40,35,48,
+8,8,59,60,60,140,132,51,51,69,60,115,249,242,200,200,100,58,49,49,49,49,58,
+50,25,25,36,76,44,44,100,200,100,100,100,100,100,100,100,66,66,0,0,2,0,250,
+255,156,4,176,5,220,0,6,0,74,0,0,1,21,50,53,52,39,38,37,52,39,38,35,35,34,
+7,6,21,21,50,23,22,21,20,35,34,53,53,52,55,54,51,51,50,23,22,21,21,20,5,5,
+21,20,23,22,51,50,55,54,55,54,51,53,55,17,20,35,34,53,54,53,53,34,7,6,7,6,
+35,34,39,38,53,17,37,36,53,1,182,48,13,12,2,39,78,78,106,50,106,78,78,74,
+37,37,148,188,125,125,200,50,200,125,125,254,131,254,131,24,24,41,59,51,151,
+73,74,77,188,154,104,70,48,47,47,127,127,89,129,74,74,1,220,1,30,4,1,75,50,
+12,7,6,175,58,49,49,49,49,58,75,31,32,62,150,100,250,100,100,100,100,100,
+100,150,172,197,196,235,53,26,27,42,126,44,44,183,90,253,145,150,72,32,56,
+206,31,32,101,102,58,59,133,1,44,245,148,107,0,0,3,0,180,255,156,5,20,7,158,
+0,6,0,74,0,122,0,0,1,21,50,53,52,39,38,37,52,39,38,35,35,34,7,6,21,21,50,
+23,22,21,20,35,34,53,53,52,55,54,51,51,50,23,22,21,21,20,5,5,21,20,23,22,
+51,50,55,54,55,54,51,53,55,17,20,35,34,53,54,53,53,34,7,6,7,6,35,34,39,38,
+53,17,37,36,53,0,53,53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,
+23,22,51,50,55,6,35,34,39,39,38,35,34,7,6,35,34,39,39,38,35,34,7,6,21,20,
+23,7,1,182,48,13,12,2,39,78,78,106,50,106,78,78,74,37,37,148,188,125,125,
+200,50,200,125,125,254,131,254,131,24,24,41,59,51,151,73,74,77,188,154,104,
+70,48,47,47,127,127,89,129,74,74,1,220,1,30,252,192,65,66,131,32,37,108,54,
+27,30,25,26,50,101,36,35,57,118,35,36,26,25,70,65,68,36,78,40,33,43,58,59,
+50,72,86,44,43,38,43,22,22,137,129,4,1,75,50,12,7,6,175,58,49,49,49,49,58,
+75,31,32,62,150,100,250,100,100,100,100,100,100,150,172,197,196,235,53,26,
+27,42,126,44,44,183,90,253,145,150,72,32,56,206,31,32,101,102,58,59,133,1,
+44,245,148,107,1,172,99,75,52,61,61,124,112,56,29,29,56,112,62,125,37,18,
+167,39,81,41,80,81,81,40,40,37,37,36,50,70,91,0,3,0,250,255,156,5,220,5,220,
+0,6,0,74,0,78,0,0,1,21,50,53,52,39,38,37,52,39,38,35,35,34,7,6,21,21,50,23,
+22,21,20,35,34,53,53,52,55,54,51,51,50,23,22,21,21,20,5,5,21,20,23,22,51,
+50,55,54,55,54,51,53,55,17,20,35,34,53,54,53,53,34,7,6,7,6,35,34,39,38,53,
+17,37,36,53,1,55,17,35,1,182,48,13,12,2,39,78,78,106,50,106,78,78,74,37,37,
+148,188,125,125,200,50,200,125,125,254,131,254,131,24,24,41,59,51,151,73,
+74,77,188,154,104,70,48,47,47,127,127,89,129,74,74,1,220,1,30,1,44,188,188,
+4,1,75,50,12,7,6,175,58,49,49,49,49,58,75,31,32,62,150,100,250,100,100,100,
+100,100,100,150,172,197,196,235,53,26,27,42,126,44,44,183,90,253,145,150,
+72,32,56,206,31,32,101,102,58,59,133,1,44,245,148,107,254,45,90,252,251,0,
+3,0,180,255,156,4,176,8,102,0,6,0,74,0,113,0,0,1,21,50,53,52,39,38,37,52,
+39,38,35,35,34,7,6,21,21,50,23,22,21,20,35,34,53,53,52,55,54,51,51,50,23,
+22,21,21,20,5,5,21,20,23,22,51,50,55,54,55,54,51,53,55,17,20,35,34,53,54,
+53,53,34,7,6,7,6,35,34,39,38,53,17,37,36,53,1,53,52,55,54,51,50,23,22,51,
+50,54,53,52,35,34,53,52,51,50,23,22,21,20,7,6,35,34,39,39,38,35,34,6,21,20,
+23,7,38,1,182,48,13,12,2,39,78,78,106,50,106,78,78,74,37,37,148,188,125,125,
+200,50,200,125,125,254,131,254,131,24,24,41,59,51,151,73,74,77,188,154,104,
+70,48,47,47,127,127,89,129,74,74,1,220,1,30,252,192,131,131,32,37,108,111,
+130,102,104,146,100,100,130,75,75,85,86,169,232,86,44,43,28,43,54,137,129,
+158,4,1,75,50,12,7,6,175,58,49,49,49,49,58,75,31,32,62,150,100,250,100,100,
+100,100,100,100,150,172,197,196,235,53,26,27,42,126,44,44,183,90,253,145,
+150,72,32,56,206,31,32,101,102,58,59,133,1,44,245,148,107,2,15,75,52,122,
+124,112,108,70,70,102,93,85,81,81,118,142,76,76,82,40,40,64,46,50,70,91,61,
+0,2,0,100,253,218,5,95,5,220,0,25,0,93,0,0,5,20,7,6,33,34,39,38,39,22,51,
+50,55,54,53,52,39,38,35,52,55,54,51,50,23,22,3,39,38,53,52,55,55,23,23,22,
+51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,7,6,35,35,34,39,38,53,17,39,38,
+53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,23,22,51,
+51,50,55,54,53,4,201,155,154,254,203,155,108,108,61,186,247,221,111,110,18,
+19,37,31,31,62,63,31,31,188,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,
+57,68,43,192,125,125,200,50,200,125,125,87,88,56,168,108,54,47,33,6,5,36,
+82,41,6,7,38,57,68,43,192,78,78,106,50,106,78,78,250,150,75,75,32,33,65,30,
+50,50,100,25,13,12,50,25,25,38,37,4,144,53,53,32,31,85,253,62,32,27,1,5,35,
+128,6,1,34,39,75,113,252,224,100,100,100,100,100,100,2,181,53,53,32,31,85,
+253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,58,49,49,49,49,58,0,2,0,
+100,253,218,5,95,5,220,0,37,0,105,0,0,5,20,7,22,23,22,51,20,7,6,35,34,39,
+38,39,6,7,6,35,34,39,38,39,22,51,50,55,54,53,52,35,52,55,54,51,50,23,22,3,
+39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,7,
+6,35,35,34,39,38,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,
+34,39,39,7,23,17,20,23,22,51,51,50,55,54,53,4,201,35,10,46,46,82,40,41,81,
+58,43,42,26,77,109,109,142,154,108,108,61,185,248,220,111,110,75,32,32,63,
+62,31,31,188,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,125,
+125,200,50,200,125,125,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,
+43,192,78,78,106,50,106,78,78,250,70,54,38,20,19,49,25,25,16,16,31,31,16,
+16,32,33,65,30,50,50,100,50,50,25,25,38,37,4,144,53,53,32,31,85,253,62,32,
+27,1,5,35,128,6,1,34,39,75,113,252,224,100,100,100,100,100,100,2,181,53,53,
+32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,58,49,49,49,49,
+58,0,0,3,0,150,253,218,4,176,5,220,0,6,0,64,0,90,0,0,37,54,53,52,39,38,35,
+53,50,23,22,21,20,7,6,7,7,35,17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,
+54,51,50,23,23,22,21,17,35,17,52,39,39,38,35,34,7,7,6,35,38,39,39,38,35,34,
+7,7,6,21,20,23,1,20,7,6,33,34,39,38,39,22,51,50,55,54,53,52,39,38,35,52,55,
+54,51,50,23,22,1,182,98,27,27,44,145,44,43,40,40,76,76,188,100,133,132,46,
+48,95,74,6,8,20,30,41,83,52,37,61,62,122,188,34,68,11,11,24,24,55,56,58,79,
+55,73,25,20,13,11,44,6,93,2,250,155,154,254,203,155,108,108,61,186,247,221,
+111,110,18,19,37,31,31,62,63,31,31,222,90,77,40,19,18,134,59,60,66,78,87,
+88,81,81,4,38,107,43,43,123,122,88,72,5,32,45,88,38,39,77,177,251,111,4,145,
+76,21,41,6,28,60,60,1,49,68,24,9,38,6,9,34,77,250,152,150,75,75,32,33,65,
+30,50,50,100,25,13,12,50,25,25,38,37,0,3,0,150,253,218,5,69,5,220,0,6,0,64,
+0,102,0,0,37,54,53,52,39,38,35,53,50,23,22,21,20,7,6,7,7,35,17,38,53,52,55,
+54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,21,17,35,17,52,39,39,38,35,
+34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,1,20,7,22,23,22,51,20,7,6,35,
+34,39,38,39,6,7,6,35,34,39,38,39,22,51,50,55,54,53,52,35,52,55,54,51,50,23,
+22,1,182,98,27,27,44,145,44,43,40,40,76,76,188,100,133,132,46,48,95,74,6,
+8,20,30,41,83,52,37,61,62,122,188,34,68,11,11,24,24,55,56,58,79,55,73,25,
+20,13,11,44,6,93,2,250,35,10,46,46,82,40,41,81,58,43,42,26,77,109,109,142,
+154,108,108,61,185,248,220,111,110,75,32,32,63,62,31,31,222,90,77,40,19,18,
+134,59,60,66,78,87,88,81,81,4,38,107,43,43,123,122,88,72,5,32,45,88,38,39,
+77,177,251,111,4,145,76,21,41,6,28,60,60,1,49,68,24,9,38,6,9,34,77,250,152,
+70,54,38,20,19,49,25,25,16,16,31,31,16,16,32,33,65,30,50,50,100,50,50,25,
+25,38,37,0,0,2,0,100,0,0,4,176,7,8,0,6,0,58,0,0,19,53,6,21,20,23,22,23,34,
+38,53,52,54,54,51,50,21,17,37,5,17,39,38,35,34,7,6,7,35,34,39,38,53,52,54,
+53,52,35,52,51,50,21,20,6,21,21,55,54,51,50,23,23,22,21,17,35,37,5,35,250,
+40,10,10,20,80,70,39,111,94,94,1,31,1,31,230,54,34,71,117,38,42,9,37,41,89,
+50,100,100,188,50,53,121,93,95,60,246,94,188,254,225,254,225,188,2,227,97,
+20,31,25,10,11,139,100,55,57,89,99,100,253,54,237,237,3,170,161,37,136,43,
+4,30,75,116,65,135,70,70,100,170,85,115,70,43,56,127,41,172,63,110,251,166,
+236,236,0,4,0,150,253,118,4,176,5,220,0,9,0,21,0,28,0,107,0,0,5,6,7,23,22,
+51,50,55,54,53,0,55,54,53,53,6,7,21,20,23,22,51,3,54,53,52,39,38,35,18,55,
+54,55,55,17,52,39,39,38,35,34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,
+50,23,22,21,20,7,6,7,7,35,17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,
+51,50,23,23,22,21,17,20,7,6,35,34,39,39,20,7,6,35,34,39,38,53,52,55,3,244,
+113,132,99,28,22,43,21,32,254,92,27,27,115,86,34,33,37,111,98,27,27,44,58,
+158,157,129,72,34,68,11,11,24,24,55,56,58,79,55,73,25,20,13,11,44,6,93,145,
+44,43,40,40,76,76,188,100,133,132,46,48,95,74,6,8,20,30,41,83,52,37,61,62,
+122,84,56,94,46,55,81,56,56,113,155,77,77,59,129,118,68,24,6,22,33,104,254,
+178,26,26,52,49,54,19,30,25,13,12,2,230,90,77,40,19,18,253,21,63,62,123,82,
+4,96,76,21,41,6,28,60,60,1,49,68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,
+88,81,81,4,38,107,43,43,123,122,88,72,5,32,45,88,38,39,77,177,250,181,174,
+71,47,11,18,101,50,50,38,37,75,144,23,0,0,3,0,180,255,156,4,226,7,158,0,6,
+0,74,0,101,0,0,1,21,50,53,52,39,38,37,52,39,38,35,35,34,7,6,21,21,50,23,22,
+21,20,35,34,53,53,52,55,54,51,51,50,23,22,21,21,20,5,5,21,20,23,22,51,50,
+55,54,55,54,51,53,55,17,20,35,34,53,54,53,53,34,7,6,7,6,35,34,39,38,53,17,
+37,36,53,0,53,53,52,55,55,54,51,32,23,22,21,20,7,54,53,52,39,38,35,32,7,6,
+21,20,23,7,1,182,48,13,12,2,39,78,78,106,50,106,78,78,74,37,37,148,188,125,
+125,200,50,200,125,125,254,131,254,131,24,24,41,59,51,151,73,74,77,188,154,
+104,70,48,47,47,127,127,89,129,74,74,1,220,1,30,252,192,65,66,141,248,1,42,
+180,72,126,3,85,132,210,254,206,42,22,137,129,4,1,75,50,12,7,6,175,58,49,
+49,49,49,58,75,31,32,62,150,100,250,100,100,100,100,100,100,150,172,197,196,
+235,53,26,27,42,126,44,44,183,90,253,145,150,72,32,56,206,31,32,101,102,58,
+59,133,1,44,245,148,107,1,172,99,75,52,61,61,124,187,62,97,97,72,12,14,73,
+102,136,71,37,36,50,70,91,0,0,1,0,250,0,0,4,176,5,220,0,87,0,0,1,34,7,6,21,
+20,51,6,35,34,39,38,53,52,54,51,50,22,21,20,7,6,7,22,23,22,21,21,20,7,6,35,
+35,34,39,38,53,17,52,55,54,51,51,50,23,23,7,39,38,35,35,34,7,6,21,17,20,23,
+22,51,51,50,55,54,53,53,52,38,39,6,7,7,6,35,34,39,38,53,52,55,55,54,55,54,
+53,52,39,38,3,126,66,35,37,122,67,70,65,44,43,155,150,149,157,33,40,90,71,
+40,52,125,125,200,50,200,125,125,125,125,200,50,200,125,125,188,78,78,106,
+50,106,78,78,78,78,106,50,106,78,78,35,41,10,12,214,35,31,32,27,25,36,192,
+156,62,37,39,35,3,232,23,25,52,60,90,38,37,75,102,142,141,103,55,61,76,85,
+21,46,61,105,90,100,100,100,100,100,100,3,132,100,100,100,100,100,42,49,49,
+49,49,58,252,124,58,49,49,49,49,58,90,74,65,8,9,8,165,27,29,26,24,29,27,148,
+121,81,52,35,53,25,22,0,3,0,180,255,156,4,226,8,142,0,6,0,74,0,115,0,0,1,
+21,50,53,52,39,38,37,52,39,38,35,35,34,7,6,21,21,50,23,22,21,20,35,34,53,
+53,52,55,54,51,51,50,23,22,21,21,20,5,5,21,20,23,22,51,50,55,54,55,54,51,
+53,55,17,20,35,34,53,54,53,53,34,7,6,7,6,35,34,39,38,53,17,37,36,53,19,20,
+7,54,53,52,39,38,35,32,7,6,21,20,23,7,38,53,53,52,55,55,54,51,50,23,53,52,
+39,39,38,53,52,55,54,51,50,23,23,22,21,1,182,48,13,12,2,39,78,78,106,50,106,
+78,78,74,37,37,148,188,125,125,200,50,200,125,125,254,131,254,131,24,24,41,
+59,51,151,73,74,77,188,154,104,70,48,47,47,127,127,89,129,74,74,1,220,1,30,
+238,126,3,85,132,210,254,206,42,22,137,129,158,65,66,141,248,244,165,88,47,
+28,15,19,26,24,30,63,127,4,1,75,50,12,7,6,175,58,49,49,49,49,58,75,31,32,
+62,150,100,250,100,100,100,100,100,100,150,172,197,196,235,53,26,27,42,126,
+44,44,183,90,253,145,150,72,32,56,206,31,32,101,102,58,59,133,1,44,245,148,
+107,2,132,187,72,12,14,73,102,136,71,37,36,50,70,91,61,99,75,52,61,61,124,
+125,21,138,61,33,19,26,18,22,27,21,45,90,230,0,0,1,255,6,0,0,1,182,5,220,
+0,19,0,0,2,53,52,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,7,250,38,
+114,91,89,86,192,78,188,237,36,28,17,14,119,5,20,59,37,26,78,67,151,59,95,
+251,152,4,104,191,27,10,83,0,0,2,251,136,6,214,255,6,8,102,0,10,0,16,0,0,
+1,16,33,32,23,22,21,20,35,33,34,55,33,38,38,35,34,251,136,1,38,1,4,255,85,
+100,253,118,144,144,1,244,97,162,91,150,7,102,1,0,225,75,50,50,144,77,45,
+0,0,2,251,136,6,214,255,6,8,202,0,5,0,17,0,0,1,33,38,38,35,34,5,17,51,17,
+20,35,33,34,53,16,33,50,252,24,1,244,97,162,91,150,2,104,134,100,253,118,
+144,1,38,236,7,102,77,45,50,1,28,254,62,50,144,1,0,0,0,3,251,86,6,214,255,
+6,8,202,0,5,0,15,0,38,0,0,1,33,38,38,35,34,37,22,23,54,53,52,35,34,21,20,
+23,22,21,20,35,33,34,53,16,33,50,23,53,54,55,54,51,50,23,22,21,20,7,251,230,
+1,244,97,162,91,150,2,9,45,45,69,80,80,196,34,100,253,118,144,1,38,128,126,
+11,49,50,86,100,50,50,66,7,102,77,45,18,28,36,6,74,80,80,8,168,42,32,50,144,
+1,0,54,3,75,38,38,50,50,100,115,49,0,0,2,251,136,6,214,255,6,8,252,0,5,0,
+23,0,0,1,33,38,38,35,34,37,22,23,17,51,17,20,35,33,34,53,16,33,50,23,53,51,
+21,252,24,1,244,97,162,91,150,1,245,58,57,134,100,253,118,144,1,38,109,107,
+134,7,102,77,45,31,35,46,1,28,254,62,50,144,1,0,39,189,100,0,1,254,32,253,
+118,255,6,255,156,0,8,0,0,6,21,17,35,17,34,53,52,51,250,150,80,120,100,91,
+254,53,1,111,92,91,0,0,1,253,84,253,118,255,123,255,156,0,27,0,0,1,34,53,
+52,55,55,34,53,52,51,50,21,20,7,7,6,21,20,51,50,55,54,51,50,21,20,7,2,254,
+68,229,19,50,80,120,123,21,41,11,70,97,63,72,54,25,38,58,253,118,156,44,57,
+126,84,83,105,43,61,108,29,20,53,189,230,56,74,163,254,255,0,0,1,252,245,
+253,118,255,123,255,156,0,37,0,0,1,6,35,34,53,52,55,55,34,53,52,51,50,23,
+22,21,20,7,7,6,21,20,51,50,55,22,51,50,55,18,51,50,21,20,7,6,35,34,254,56,
+92,85,146,58,62,84,120,100,30,10,36,60,38,24,52,141,21,36,33,24,75,39,39,
+17,37,116,113,253,227,109,112,65,102,104,84,83,56,20,25,46,66,102,68,30,24,
+163,163,104,1,77,81,83,170,216,0,2,251,136,6,214,255,6,8,202,0,5,0,17,0,0,
+1,33,38,38,35,34,5,17,51,17,20,35,33,34,53,16,33,50,252,24,1,244,97,162,91,
+150,2,104,134,100,253,118,144,1,38,236,7,102,77,45,50,1,28,254,62,50,144,
+1,0,0,0,2,253,200,253,118,1,182,9,96,0,5,0,37,0,0,1,33,38,38,35,34,5,22,21,
+17,20,33,32,53,17,51,17,20,33,32,53,17,52,35,33,34,53,16,33,50,23,53,51,21,
+22,23,17,51,254,88,1,244,97,162,91,150,2,238,112,254,62,254,62,188,1,6,1,
+6,124,253,218,144,1,38,109,107,134,59,57,134,7,202,77,45,169,71,176,247,204,
+250,250,1,44,254,212,106,106,8,52,150,144,1,0,39,189,253,35,46,1,28,0,1,253,
+194,253,118,1,182,9,157,0,40,0,0,0,7,35,34,39,38,53,52,54,53,52,35,52,51,
+50,21,20,6,21,21,54,51,32,17,17,20,33,32,53,17,51,17,20,33,32,53,17,16,33,
+34,7,254,206,42,9,37,41,89,50,100,100,188,50,132,180,1,206,254,62,254,62,
+188,1,6,1,6,254,238,160,61,7,12,4,30,75,116,65,135,70,70,100,170,85,115,70,
+43,66,254,108,248,8,250,250,1,44,254,212,106,106,7,248,1,4,48,0,2,0,100,0,
+0,2,101,5,220,0,6,0,39,0,0,37,54,53,52,39,38,35,3,39,38,53,52,55,55,23,23,
+22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,50,23,22,21,20,6,7,35,1,207,50,
+15,15,20,188,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,75,
+37,38,34,116,188,234,50,31,25,11,10,2,120,53,53,32,31,85,253,62,32,27,1,5,
+35,128,6,1,34,39,75,113,253,168,50,50,55,57,109,179,0,3,0,63,0,0,2,101,8,
+152,0,35,0,42,0,75,0,0,1,34,21,20,51,50,55,54,53,52,39,38,35,34,53,52,51,
+50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,19,54,53,52,39,38,
+35,3,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,
+50,23,22,21,20,6,7,35,1,27,55,85,67,42,41,30,30,50,90,90,112,74,74,72,73,
+155,112,69,69,28,27,55,55,27,28,180,50,15,15,20,188,87,88,56,168,108,54,47,
+33,6,5,36,82,41,6,7,38,57,68,43,192,75,37,38,34,116,188,7,8,25,25,48,47,75,
+55,38,37,75,75,72,73,135,105,82,83,31,31,63,63,31,31,25,25,249,176,50,31,
+25,11,10,2,120,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,253,
+168,50,50,55,57,109,179,0,0,3,0,63,0,0,2,101,8,202,0,33,0,40,0,73,0,0,19,
+50,21,20,51,50,54,53,52,38,35,35,34,53,52,35,52,51,50,23,22,21,51,50,23,22,
+21,20,7,6,35,34,53,52,1,54,53,52,39,38,35,3,39,38,53,52,55,55,23,23,22,51,
+50,55,55,20,6,7,6,35,34,39,39,7,23,17,50,23,22,21,20,6,7,35,238,75,50,50,
+50,50,50,50,150,100,100,78,36,36,50,138,56,56,56,56,138,200,1,44,50,15,15,
+20,188,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,75,37,38,
+34,116,188,7,78,70,50,50,50,70,50,100,80,100,45,45,90,50,50,120,100,50,50,
+140,80,249,156,50,31,25,11,10,2,120,53,53,32,31,85,253,62,32,27,1,5,35,128,
+6,1,34,39,75,113,253,168,50,50,55,57,109,179,0,0,1,255,6,0,0,1,182,5,220,
+0,19,0,0,2,53,52,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,7,250,38,
+114,91,89,86,192,78,188,237,36,28,17,14,119,5,20,59,37,26,78,67,151,59,95,
+251,152,4,104,191,27,10,83,0,0,1,255,6,0,0,2,2,7,108,0,29,0,0,1,22,21,17,
+35,17,39,38,35,34,7,7,38,53,52,55,54,51,50,23,23,17,52,35,52,51,50,21,17,
+20,1,169,13,188,237,36,28,17,14,119,49,38,114,91,89,86,158,100,125,163,4,
+176,33,39,251,152,4,104,191,27,10,83,47,59,37,26,78,67,124,1,135,100,100,
+200,254,212,74,0,0,2,252,74,6,114,254,12,8,52,0,11,0,27,0,0,1,20,22,51,50,
+54,53,52,38,35,34,6,5,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,252,219,
+40,40,40,40,40,40,40,40,1,49,56,56,113,113,56,56,56,56,113,113,56,56,7,83,
+50,50,50,50,50,50,50,50,113,56,56,56,56,113,113,56,56,56,56,0,0,4,0,250,0,
+50,2,188,5,170,0,11,0,27,0,39,0,55,0,0,1,20,22,51,50,54,53,52,38,35,34,6,
+5,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,1,20,22,51,50,54,53,52,38,35,
+34,6,5,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,1,139,40,40,40,40,40,40,
+40,40,1,49,56,56,113,113,56,56,56,56,113,113,56,56,254,207,40,40,40,40,40,
+40,40,40,1,49,56,56,113,113,56,56,56,56,113,113,56,56,4,201,50,50,50,50,50,
+50,50,50,113,56,56,56,56,113,113,56,56,56,56,251,217,50,50,50,50,50,50,50,
+50,113,56,56,56,56,113,113,56,56,56,56,0,2,0,250,0,150,2,88,5,68,0,19,0,39,
+0,0,37,34,39,38,53,52,55,54,51,50,23,22,21,20,51,50,55,6,7,6,3,34,39,38,53,
+52,55,54,51,50,23,22,21,20,51,50,55,6,7,6,1,119,63,31,31,31,31,63,63,31,31,
+25,25,50,25,56,57,87,63,31,31,31,31,63,63,31,31,25,25,50,25,56,57,150,31,
+31,63,63,31,31,32,31,63,30,30,62,31,31,3,180,31,31,63,63,31,31,32,31,63,30,
+30,62,31,31,0,2,252,54,6,114,254,32,8,52,0,6,0,13,0,0,1,17,20,7,38,53,17,
+33,17,20,7,38,53,17,252,219,82,83,1,234,82,83,8,52,254,172,80,30,30,80,1,
+84,254,172,80,30,30,80,1,84,0,1,250,236,6,74,255,106,7,124,0,46,0,0,1,38,
+53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,51,50,55,6,35,
+34,39,39,38,35,34,7,6,35,34,39,39,38,35,34,7,6,21,20,23,251,99,119,65,66,
+131,32,34,111,56,27,28,25,26,50,101,36,35,57,114,33,49,33,41,100,65,66,36,
+73,37,43,43,68,69,40,67,41,81,41,43,33,27,27,74,6,74,40,55,37,43,43,88,79,
+40,20,20,40,79,44,88,26,12,118,28,57,29,57,57,28,57,29,21,21,26,24,30,0,0,
+1,252,224,6,114,253,138,8,102,0,6,0,0,1,17,20,7,38,53,17,253,138,85,85,8,
+102,254,132,90,30,30,90,1,124,0,0,1,251,211,6,114,254,131,8,227,0,38,0,0,
+1,6,7,6,35,34,39,38,53,52,55,55,54,54,53,52,51,50,21,6,6,7,54,51,50,23,22,
+23,22,21,20,7,6,35,34,39,38,39,34,252,223,43,61,61,38,32,20,13,64,94,142,
+63,85,84,1,64,138,69,62,31,29,87,61,20,38,21,20,38,30,44,68,118,6,230,19,
+48,49,27,19,19,61,45,64,97,150,43,100,100,73,116,110,25,6,19,92,35,27,38,
+21,13,50,75,10,0,0,1,252,39,6,114,254,237,8,99,0,46,0,0,1,20,23,22,51,50,
+53,52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,54,55,54,55,55,50,
+23,22,21,20,7,6,7,6,7,6,35,38,35,34,7,6,252,189,12,13,35,50,70,70,44,44,97,
+127,44,44,45,45,130,127,48,76,65,64,42,11,19,23,15,12,45,60,61,75,36,34,74,
+63,45,27,28,7,34,38,18,19,18,31,31,59,30,30,44,44,87,77,59,59,59,25,44,43,
+72,2,29,20,14,14,10,63,50,49,37,11,70,28,29,0,1,252,89,6,114,253,253,8,21,
+0,11,0,0,1,35,53,51,53,51,21,51,21,35,21,35,252,239,150,150,120,150,150,120,
+7,7,121,149,149,121,149,0,0,1,251,205,6,114,254,137,8,206,0,40,0,0,1,34,39,
+6,35,38,53,54,51,54,54,51,50,21,20,35,34,7,6,7,6,35,34,7,22,23,54,55,22,51,
+50,53,52,35,34,53,52,51,50,21,20,253,193,114,60,79,72,175,131,219,50,150,
+89,61,60,43,55,55,23,24,93,100,98,9,30,62,91,80,79,27,48,29,47,152,6,114,
+88,88,31,196,254,59,64,52,62,15,16,49,49,146,73,22,1,132,133,40,40,50,50,
+140,160,0,0,1,252,74,6,114,255,6,8,135,0,31,0,0,1,50,21,20,35,34,39,20,51,
+50,55,54,53,52,35,34,53,52,51,50,23,22,21,20,7,6,35,34,39,38,53,52,252,244,
+130,75,65,10,100,175,63,62,50,50,50,75,63,62,112,113,225,125,63,62,7,208,
+105,95,50,99,53,53,106,120,50,50,55,55,110,157,78,78,50,50,100,150,0,1,251,
+80,6,114,255,6,7,8,0,3,0,0,3,21,33,53,250,252,74,7,8,150,150,0,0,1,252,99,
+253,168,253,243,255,56,0,11,0,0,1,35,21,35,53,35,53,51,53,51,21,51,253,243,
+150,100,150,150,100,150,254,62,150,150,100,150,150,0,0,2,252,49,6,114,254,
+37,8,2,0,15,0,31,0,0,1,20,23,22,51,50,55,54,53,52,39,38,35,34,7,6,5,20,7,
+6,35,34,39,38,53,52,55,54,51,50,23,22,252,149,37,38,75,75,38,37,37,38,75,
+75,38,37,1,144,63,62,125,125,62,63,63,62,125,125,62,63,7,58,50,25,25,25,25,
+50,50,25,25,25,25,50,100,50,50,50,50,100,100,50,50,50,50,0,0,1,0,250,0,0,
+5,8,5,220,0,31,0,0,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,
+52,51,50,21,20,35,34,21,20,51,50,55,4,76,188,133,95,55,27,28,63,87,134,254,
+238,192,250,250,100,100,62,62,148,248,5,112,108,250,241,117,88,25,25,51,37,
+67,3,248,70,151,250,250,75,75,100,100,133,0,0,2,0,250,0,0,6,64,5,220,0,10,
+0,42,0,0,1,51,17,20,7,6,35,54,55,54,53,1,53,51,17,20,6,35,34,39,38,53,50,
+54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,5,170,150,62,63,
+125,50,25,25,254,162,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,
+100,62,62,148,248,5,220,250,186,75,37,38,25,37,38,50,4,218,108,250,241,117,
+88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,5,0,250,0,50,3,
+132,5,170,0,15,0,31,0,47,0,63,0,67,0,0,1,20,23,22,51,50,55,54,53,52,39,38,
+35,34,7,6,5,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,1,20,23,22,51,50,55,
+54,53,52,39,38,35,34,7,6,5,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,19,
+21,33,53,1,219,25,25,50,50,25,25,25,25,50,50,25,25,1,69,56,56,113,113,56,
+56,56,56,113,113,56,56,254,187,25,25,50,50,25,25,25,25,50,50,25,25,1,69,56,
+56,113,113,56,56,56,56,113,113,56,56,100,253,118,4,201,50,25,25,25,25,50,
+50,25,25,25,25,50,113,56,56,56,56,113,113,56,56,56,56,251,217,50,25,25,25,
+25,50,50,25,25,25,25,50,113,56,56,56,56,113,113,56,56,56,56,1,181,151,151,
+0,0,1,0,250,0,0,4,214,5,220,0,50,0,0,1,34,39,38,53,54,55,54,55,5,37,51,17,
+20,7,6,35,34,39,38,53,52,54,51,20,23,22,51,50,55,54,53,17,5,39,7,20,23,22,
+51,50,55,54,53,50,23,22,21,20,7,6,2,16,170,54,54,31,68,68,105,1,6,1,33,165,
+123,123,208,207,104,104,59,60,74,74,148,121,73,72,254,248,224,97,16,15,32,
+29,15,15,30,14,15,29,30,4,2,48,48,87,72,73,73,73,210,209,251,131,175,87,88,
+44,43,88,58,58,45,48,47,62,62,75,3,171,174,174,80,30,14,15,13,12,25,21,22,
+44,44,22,21,0,4,0,250,0,0,19,124,5,220,0,31,0,38,0,119,0,151,0,0,1,53,51,
+17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,
+51,50,55,1,54,53,52,39,38,35,53,50,23,22,21,20,7,6,7,6,35,34,53,17,39,38,
+53,52,55,55,54,51,50,23,23,22,21,17,20,23,22,51,50,55,54,53,17,39,38,53,52,
+55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,7,6,35,34,39,38,
+53,17,52,39,39,38,35,34,7,7,23,22,21,1,53,51,17,20,6,35,34,39,38,53,50,54,
+53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,4,76,188,133,95,55,
+27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,4,56,98,27,27,44,
+145,44,43,40,40,76,76,64,124,62,48,100,137,161,102,158,80,214,108,78,78,106,
+106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,125,
+125,200,200,125,125,39,207,37,89,104,68,129,38,61,11,8,188,133,95,55,27,28,
+63,87,134,254,238,192,250,250,100,100,62,62,148,248,5,112,108,250,241,117,
+88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,251,219,90,77,40,
+19,18,134,59,60,66,78,87,88,81,81,100,3,140,38,29,65,65,74,102,119,53,150,
+72,175,253,18,58,49,49,49,49,58,2,181,53,53,32,31,85,253,62,32,27,1,5,35,
+128,6,1,34,39,75,113,252,224,100,100,100,100,100,100,2,238,76,28,142,26,51,
+98,25,38,60,1,86,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,
+75,100,100,133,0,4,1,44,0,0,4,226,5,120,0,15,0,31,0,47,0,63,0,0,33,34,39,
+38,17,16,55,54,51,50,23,22,17,16,7,6,3,34,7,6,17,16,23,22,51,50,55,54,17,
+16,39,38,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,3,34,7,6,21,20,23,22,
+51,50,55,54,53,52,39,38,3,7,237,119,119,119,119,237,237,119,119,119,119,237,
+178,89,89,89,89,178,178,89,89,89,89,178,119,59,59,59,59,119,119,59,59,59,
+59,119,59,30,30,30,30,59,59,30,30,30,30,175,175,1,94,1,94,175,175,175,175,
+254,162,254,162,175,175,5,3,145,146,254,220,254,220,146,145,145,146,1,36,
+1,36,146,145,251,230,117,117,233,233,117,117,117,117,233,233,117,117,3,49,
+87,88,175,175,87,88,88,87,175,175,88,87,0,0,7,0,250,0,0,14,86,5,220,0,11,
+0,25,0,37,0,49,0,61,0,73,1,28,0,0,1,6,21,20,23,22,51,50,55,54,53,52,1,54,
+53,52,39,38,35,34,7,6,21,20,23,22,1,6,21,20,23,22,51,50,55,54,53,52,1,54,
+53,52,39,38,35,34,7,6,21,20,1,6,21,20,23,22,51,50,55,54,53,52,1,54,53,52,
+35,38,35,34,7,6,21,20,23,22,23,54,55,54,51,33,50,21,20,35,33,34,7,22,23,22,
+21,20,7,6,35,34,39,38,39,38,53,52,55,54,55,38,39,38,39,6,7,6,7,22,23,22,21,
+20,7,6,35,34,39,38,39,38,53,52,55,54,55,38,39,39,6,7,6,7,22,23,22,21,20,7,
+6,35,34,39,38,39,38,53,52,55,54,55,38,39,38,39,6,7,2,7,6,35,34,39,38,17,16,
+55,54,51,50,23,22,21,20,7,6,7,6,35,34,39,38,53,52,55,54,55,54,53,52,39,38,
+35,34,7,6,17,21,16,23,22,51,50,55,54,55,54,55,38,39,38,53,52,55,54,55,51,
+50,23,22,21,20,7,6,7,22,23,22,23,54,55,54,55,38,39,38,53,52,55,54,51,50,23,
+22,23,22,21,20,7,6,7,22,23,22,23,54,55,54,55,38,39,38,53,52,55,54,51,50,23,
+22,23,22,21,20,7,6,7,22,11,105,16,1,5,7,6,7,1,250,197,61,7,24,23,28,26,7,
+42,5,1,29,44,4,19,22,18,19,6,1,40,40,2,15,18,14,16,5,1,1,21,1,7,9,8,8,2,1,
+74,25,1,5,6,9,10,2,140,23,19,41,46,115,153,1,8,95,99,254,252,216,66,20,9,
+7,47,57,51,8,8,59,51,39,3,15,74,15,17,18,15,46,56,78,55,20,12,16,42,58,52,
+9,9,61,52,23,35,17,24,36,50,69,49,63,75,54,44,23,23,46,72,65,7,6,71,63,31,
+32,22,36,43,56,39,34,67,93,223,195,196,167,207,104,104,119,119,237,238,119,
+118,86,87,173,21,17,51,15,4,69,117,59,59,81,82,162,162,81,81,66,66,133,132,
+162,162,193,120,77,54,26,25,42,74,74,2,72,73,37,38,23,36,42,53,47,39,49,62,
+81,57,32,22,16,49,68,59,8,8,67,57,26,37,22,34,35,46,44,35,46,59,74,51,23,
+11,9,46,56,52,9,9,60,54,24,35,19,29,21,2,26,17,9,3,2,8,6,1,3,7,1,207,94,38,
+13,7,24,35,9,14,35,65,9,253,219,56,25,7,4,22,15,4,9,26,2,127,50,19,4,3,20,
+12,4,9,21,253,168,22,7,1,1,8,5,1,3,8,2,21,25,6,1,5,9,2,3,8,200,29,27,18,12,
+32,75,75,33,41,35,29,24,62,36,43,1,7,64,49,50,14,15,60,60,22,24,22,21,42,
+45,64,46,38,33,46,36,57,32,43,1,9,67,30,39,47,61,28,31,49,64,86,56,63,72,
+56,65,54,55,42,60,35,55,1,6,74,37,50,51,66,45,51,48,60,41,39,96,112,254,245,
+133,134,187,188,1,119,1,119,187,188,99,99,198,203,123,124,44,6,54,14,12,51,
+19,30,86,86,141,126,63,64,150,148,254,217,7,254,212,150,150,116,116,232,144,
+105,77,65,62,52,66,48,85,1,83,42,64,65,88,53,61,49,56,50,46,55,61,76,59,59,
+66,48,38,67,37,51,1,8,73,33,46,54,72,42,49,46,57,55,50,45,49,60,44,45,38,
+32,27,59,35,42,1,8,67,30,39,46,58,31,35,27,0,2,0,100,0,0,2,101,5,220,0,6,
+0,49,0,0,1,34,7,6,21,20,23,19,17,35,39,38,39,38,53,52,55,54,51,53,35,53,51,
+53,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,51,
+21,1,19,20,15,15,50,188,188,65,66,22,22,38,37,100,143,143,87,88,56,168,108,
+54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,119,1,105,10,11,25,31,50,1,160,
+253,118,95,94,50,49,57,55,50,50,150,150,193,53,53,32,31,85,253,62,32,27,1,
+5,35,128,6,1,34,39,75,113,254,212,150,0,2,0,250,0,0,5,20,5,220,0,17,0,35,
+0,0,18,53,17,52,55,54,33,32,23,22,21,17,20,7,6,33,32,39,18,21,17,20,23,22,
+51,50,55,54,53,17,52,39,38,35,34,7,250,119,119,1,32,1,31,118,119,119,118,
+254,225,254,224,119,69,72,72,194,193,71,72,72,71,193,194,72,1,119,225,1,44,
+225,188,187,187,188,225,254,212,225,187,188,188,3,97,153,254,212,153,151,
+152,152,151,153,1,44,153,152,151,151,0,1,0,250,0,0,5,20,5,220,0,46,0,0,0,
+7,6,33,35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,
+52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,17,5,20,178,179,254,
+169,100,100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,28,81,125,125,
+69,70,129,181,100,101,129,129,248,247,149,148,1,209,232,233,144,192,191,1,
+117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,130,137,78,79,109,108,167,
+195,138,137,142,143,254,197,0,2,0,100,0,0,5,120,6,164,0,6,0,68,0,0,1,21,50,
+53,52,39,38,3,32,39,38,53,17,52,35,52,51,50,21,17,20,23,22,51,51,50,55,54,
+53,17,52,39,38,35,34,7,38,35,34,7,6,21,21,50,23,22,21,20,35,34,53,17,52,55,
+54,51,50,23,54,51,50,23,22,21,17,20,7,6,33,3,20,48,13,12,11,254,242,140,140,
+150,130,208,93,93,176,50,176,93,93,60,2,2,26,121,119,29,3,2,60,74,37,37,148,
+188,109,109,30,30,123,123,29,30,108,109,140,140,254,242,3,107,75,50,12,7,
+6,252,149,115,115,170,4,26,116,134,250,251,230,128,64,64,64,64,128,3,32,64,
+52,1,167,167,1,52,64,225,31,32,62,150,100,1,144,122,89,89,134,134,89,89,122,
+252,224,170,115,115,0,2,0,250,0,0,6,26,5,220,0,6,0,38,0,0,37,21,50,53,52,
+39,38,1,52,35,34,21,17,50,23,22,21,20,35,34,53,17,16,33,50,23,54,51,32,17,
+17,35,17,52,35,34,21,17,35,1,182,48,13,12,1,95,187,187,74,37,37,148,188,1,
+119,187,94,94,187,1,119,188,187,187,188,175,75,50,12,7,6,3,207,216,216,252,
+149,31,32,62,150,100,4,26,1,94,87,87,254,162,251,130,4,126,216,216,251,130,
+0,2,0,250,0,0,5,20,6,164,0,6,0,51,0,0,1,54,53,52,39,21,50,37,16,37,37,54,
+53,52,35,52,51,50,21,20,5,5,6,21,17,20,23,22,51,33,38,53,53,52,51,50,22,22,
+21,20,6,35,21,20,23,23,21,33,34,39,38,53,4,156,10,40,20,252,104,1,109,1,27,
+214,100,100,188,254,170,254,208,216,78,78,106,1,156,150,134,74,91,39,70,80,
+75,75,253,168,200,125,125,2,188,10,25,31,20,97,111,1,88,110,91,68,117,70,
+100,170,210,108,95,70,247,254,12,58,49,49,227,79,250,200,49,89,57,55,100,
+100,101,112,112,125,100,100,100,0,0,3,0,250,0,0,5,120,6,164,0,7,0,14,0,72,
+0,0,1,54,53,52,35,34,21,20,1,54,53,52,39,21,50,1,23,22,51,50,53,53,52,51,
+50,21,34,21,21,16,35,37,6,7,6,21,17,20,23,22,51,33,38,53,53,52,51,50,22,22,
+21,20,6,35,21,20,23,21,33,34,39,38,53,17,16,37,38,53,52,51,50,21,20,2,160,
+34,78,78,2,118,10,40,20,254,157,201,9,9,78,188,100,100,225,254,126,31,38,
+182,78,78,106,1,156,150,134,74,91,39,70,80,150,253,168,200,125,125,1,10,100,
+212,212,4,188,34,32,88,88,44,253,134,10,25,31,20,97,2,86,26,2,141,230,170,
+100,70,230,254,212,65,20,20,69,246,254,102,58,49,49,177,79,200,200,49,89,
+57,55,100,50,101,174,125,100,100,100,1,154,1,24,127,55,106,222,222,47,0,0,
+1,0,100,0,0,5,20,6,214,0,54,0,0,1,54,51,50,0,17,21,16,0,33,32,39,38,53,52,
+55,54,51,50,22,21,20,35,34,53,52,55,38,35,34,21,20,23,22,51,50,54,53,53,16,
+38,35,34,3,20,35,34,53,17,52,35,52,51,50,21,1,182,130,213,252,1,11,254,245,
+254,255,254,224,119,119,91,90,161,129,129,100,100,31,28,61,154,72,72,194,
+163,173,173,158,229,114,94,94,150,130,208,5,85,135,254,197,254,127,200,254,
+227,254,197,142,143,185,153,88,89,117,137,100,100,56,24,40,196,143,92,91,
+213,243,200,1,87,213,255,0,100,100,1,144,116,134,250,0,0,2,0,250,0,0,6,2,
+6,164,0,6,0,60,0,0,37,54,53,52,39,38,35,0,51,50,53,17,52,35,52,51,50,21,17,
+20,33,32,53,17,52,39,38,35,34,7,38,35,34,7,6,21,17,50,23,22,21,20,7,6,7,7,
+35,17,52,55,54,51,50,23,54,51,50,23,22,21,17,1,182,98,27,27,44,2,250,75,75,
+150,130,208,254,249,254,249,75,18,21,68,104,105,69,21,18,75,145,44,43,40,
+40,76,76,188,116,116,63,52,129,128,53,62,115,116,222,90,77,40,19,18,254,190,
+56,4,226,116,134,250,251,30,200,200,3,232,64,52,13,130,130,13,52,64,253,168,
+59,60,66,78,87,88,81,81,4,176,122,89,89,134,134,89,89,122,252,24,0,2,0,250,
+0,0,5,170,6,214,0,6,0,67,0,0,1,53,6,21,20,23,22,1,52,55,54,33,50,23,53,52,
+51,50,21,34,21,17,20,35,34,39,2,35,34,7,6,21,17,20,23,22,51,50,55,22,51,50,
+55,54,53,53,34,38,53,52,54,54,51,50,21,17,20,7,6,35,34,39,6,35,34,39,38,53,
+4,88,40,10,10,252,182,118,119,1,16,223,130,208,130,150,94,72,22,114,239,178,
+72,71,93,20,23,83,119,119,82,23,20,92,80,70,39,91,74,134,128,127,69,58,142,
+142,58,70,128,128,2,77,97,20,31,25,10,11,1,155,215,142,143,135,135,250,134,
+116,254,162,100,50,1,0,92,91,173,253,68,64,52,12,149,149,12,52,64,150,100,
+55,57,89,49,200,254,212,122,89,89,144,144,89,89,122,0,2,0,250,0,0,5,20,6,
+214,0,10,0,85,0,0,1,55,52,35,34,7,6,7,6,21,20,7,38,53,52,55,54,55,54,51,51,
+22,23,22,21,20,7,6,35,34,39,38,53,52,55,54,55,38,53,52,55,54,51,50,23,53,
+52,35,52,51,50,21,17,20,35,34,39,38,35,34,7,6,21,20,23,22,51,50,23,22,21,
+20,35,34,39,38,35,34,7,6,21,20,23,22,51,50,4,30,57,16,5,8,23,6,3,106,16,11,
+24,51,48,45,9,48,43,43,146,147,207,248,118,134,74,75,149,98,103,89,187,153,
+130,150,130,208,94,72,22,144,139,97,42,52,61,60,121,194,170,56,23,29,63,115,
+190,221,110,111,86,71,155,86,1,1,33,24,3,9,13,6,8,8,70,46,36,30,23,51,20,
+19,2,33,34,104,105,72,72,104,117,229,170,111,112,53,87,167,187,87,76,135,
+135,116,134,250,254,212,100,50,216,43,52,116,105,53,53,137,49,90,41,62,111,
+87,88,175,157,82,67,0,0,1,251,155,253,118,254,187,255,156,0,17,0,0,5,34,6,
+21,17,35,17,52,54,51,50,22,21,17,35,17,52,38,253,43,105,145,150,220,180,180,
+220,150,145,200,70,80,254,212,1,44,130,120,120,130,254,212,1,44,80,70,0,1,
+251,155,253,118,254,187,255,206,0,46,0,0,1,34,39,38,53,52,55,37,54,55,54,
+53,52,39,38,35,34,7,6,21,34,53,52,55,54,51,50,23,22,21,20,7,6,7,5,20,23,22,
+51,50,55,54,53,51,20,7,6,253,43,200,100,100,67,1,59,136,64,65,62,61,124,166,
+40,44,150,100,100,200,200,100,100,87,87,174,254,209,63,62,126,125,63,62,150,
+100,100,253,118,47,46,92,78,9,45,18,32,30,37,38,18,19,29,32,78,92,69,35,34,
+42,43,86,76,50,51,23,42,47,23,24,28,27,52,79,60,61,0,1,251,155,253,118,254,
+187,255,156,0,27,0,0,1,55,54,51,50,21,20,35,34,7,7,35,17,52,54,51,50,22,21,
+17,35,17,52,38,35,34,6,21,252,49,101,100,49,100,100,50,100,100,150,220,180,
+180,220,150,145,105,105,145,254,12,100,100,75,75,100,100,1,44,130,120,120,
+130,254,212,1,44,80,70,70,80,0,1,252,224,253,118,2,101,5,220,0,63,0,0,1,39,
+38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,6,35,
+34,39,38,39,6,7,6,35,34,39,38,53,53,34,38,53,52,55,51,17,20,22,51,50,54,53,
+17,51,17,20,23,22,51,50,54,53,1,19,87,88,56,168,108,54,47,33,6,5,36,82,41,
+6,7,38,57,68,43,192,176,162,120,70,69,18,17,54,54,98,150,75,75,78,47,125,
+188,67,45,65,66,188,31,50,100,75,75,3,225,53,53,32,31,85,253,62,32,27,1,5,
+35,128,6,1,34,39,75,113,250,26,140,100,14,14,27,27,14,14,50,50,100,100,50,
+55,45,100,254,201,49,50,50,50,1,54,254,202,50,25,25,50,50,0,0,1,251,155,253,
+118,254,187,255,206,0,42,0,0,1,34,39,38,53,52,55,54,51,50,23,22,21,20,35,
+34,7,6,21,20,23,22,51,50,55,54,55,54,55,54,55,54,54,51,50,21,6,7,6,7,6,7,
+6,252,199,150,75,75,37,38,75,50,25,25,25,25,25,25,37,38,75,77,69,69,45,45,
+32,32,8,8,44,31,40,13,37,37,63,63,87,87,253,118,62,63,125,100,50,50,25,25,
+25,25,25,25,50,55,37,38,31,31,53,53,94,93,50,50,25,60,90,112,113,75,75,37,
+38,0,0,2,251,105,253,118,254,237,255,205,0,58,0,68,0,0,5,52,51,50,21,20,7,
+6,7,6,7,20,23,22,51,50,55,54,55,55,38,53,52,55,54,51,50,23,22,21,20,7,51,
+50,55,20,7,35,34,38,39,6,6,7,6,7,6,35,34,39,38,53,52,55,54,55,54,55,54,5,
+54,53,52,35,34,21,20,23,54,252,169,75,75,45,45,67,68,95,37,38,75,60,59,60,
+59,50,88,37,38,75,65,32,33,16,36,27,73,102,48,13,25,11,13,31,17,70,85,85,
+100,150,75,75,50,105,54,54,29,28,1,104,6,36,50,55,18,130,79,79,69,68,69,48,
+48,33,43,21,21,29,29,57,49,34,82,70,34,35,35,34,70,18,28,37,93,37,1,1,17,
+38,21,83,42,42,46,46,93,95,6,14,36,36,62,61,115,12,9,22,43,28,10,22,0,1,251,
+105,253,118,254,237,255,156,0,42,0,0,5,21,51,50,23,23,22,51,50,55,54,53,53,
+35,34,38,53,52,54,51,50,21,21,20,7,6,35,34,39,39,38,35,35,21,35,39,38,53,
+52,55,54,51,53,252,99,50,100,75,75,50,50,50,25,25,37,32,31,100,75,75,63,62,
+125,100,75,75,50,50,50,150,50,50,25,25,50,100,210,102,73,65,38,37,76,100,
+40,34,27,98,104,195,126,62,63,102,73,65,240,100,80,60,50,25,25,210,0,2,251,
+57,253,118,255,30,255,156,0,64,0,75,0,0,1,34,39,38,39,39,7,6,7,6,35,34,39,
+38,53,52,55,54,51,50,21,20,35,34,7,6,21,20,22,51,50,55,22,51,50,54,55,6,6,
+35,34,39,38,53,52,55,54,51,50,23,22,23,54,51,50,21,20,7,6,6,7,21,20,7,6,3,
+34,7,6,21,20,51,51,50,55,38,253,233,41,53,53,54,37,39,60,50,50,41,110,50,
+50,50,50,100,50,50,25,12,13,25,55,35,185,178,52,44,25,1,12,25,13,75,38,37,
+37,38,75,80,48,48,16,59,13,33,50,11,23,13,51,50,99,25,12,13,48,37,11,1,11,
+253,118,26,27,53,35,35,54,26,26,93,93,105,119,70,70,50,50,45,45,69,55,106,
+148,148,96,26,1,1,38,37,75,75,37,38,45,45,89,21,43,35,20,4,8,4,8,85,93,92,
+1,194,12,13,25,50,1,99,0,1,251,253,253,118,2,101,5,220,0,80,0,0,1,53,52,38,
+35,34,6,21,21,51,50,21,20,7,7,35,17,52,55,54,51,50,23,22,21,21,20,22,51,50,
+54,53,17,51,17,20,23,22,51,50,54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,
+55,20,6,7,6,35,34,39,39,7,23,17,20,6,35,34,39,38,39,6,7,6,35,34,39,38,253,
+153,37,75,75,37,25,75,50,50,188,75,75,150,150,75,75,67,45,65,66,188,31,50,
+60,55,75,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,176,142,
+80,70,69,18,17,54,54,98,150,75,75,254,112,80,50,30,30,50,80,50,48,77,75,1,
+75,119,50,50,50,50,120,91,49,50,50,50,1,54,254,202,50,25,25,50,50,5,123,53,
+53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,250,26,140,100,14,14,
+27,27,14,14,50,50,0,1,250,236,253,168,254,212,255,156,0,44,0,0,1,20,7,6,35,
+34,39,38,39,38,39,38,35,34,7,6,7,53,52,55,54,51,50,23,22,23,22,23,22,51,50,
+55,54,53,52,39,38,35,52,55,54,51,50,23,22,254,212,67,68,135,113,84,84,55,
+79,60,62,43,53,37,37,23,38,37,75,99,92,92,85,49,54,52,57,60,30,30,25,25,50,
+25,25,50,75,38,37,254,212,150,75,75,36,36,73,103,51,51,22,23,45,50,50,45,
+45,55,55,111,65,32,32,50,50,100,50,25,25,50,25,25,50,50,0,2,248,242,253,18,
+254,156,255,206,0,41,0,69,0,0,1,35,53,38,35,34,7,21,35,53,38,35,34,7,38,35,
+34,7,21,50,21,20,6,35,34,53,52,54,51,50,23,54,51,50,23,36,51,50,23,23,22,
+21,17,20,7,6,35,34,39,38,35,34,7,53,52,54,51,50,23,22,51,50,53,52,35,52,51,
+50,23,22,254,156,150,228,44,45,183,150,68,33,33,106,136,25,32,67,100,70,75,
+105,200,46,39,125,105,38,37,152,1,22,50,50,165,83,82,87,88,175,250,195,195,
+160,175,125,125,175,200,200,200,200,200,100,100,75,38,37,254,82,120,127,73,
+174,198,64,102,102,62,22,50,48,80,141,80,159,100,100,122,122,80,40,40,110,
+254,232,75,37,38,75,75,90,50,50,90,75,75,50,50,100,38,37,0,2,251,155,253,
+118,254,187,255,156,0,4,0,29,0,0,1,21,54,53,52,39,52,54,51,50,22,21,17,35,
+17,52,38,35,34,6,21,21,50,23,22,21,20,7,7,35,252,49,50,200,220,180,180,220,
+150,145,105,105,145,75,38,37,75,75,150,254,42,67,19,27,21,120,130,120,120,
+130,254,212,1,44,80,70,70,80,20,30,30,60,70,45,45,0,0,2,251,156,253,118,254,
+187,255,206,0,32,0,41,0,0,5,52,55,54,51,50,23,22,21,17,20,7,6,35,37,7,6,35,
+34,39,39,38,53,52,55,54,55,54,51,33,38,39,38,23,33,34,7,6,7,23,55,23,253,
+243,25,25,50,50,25,25,27,26,54,254,236,113,38,21,21,28,170,25,88,91,73,74,
+63,1,5,26,12,13,50,254,239,60,56,55,55,110,140,249,119,34,18,17,35,34,69,
+254,136,43,21,22,146,110,36,40,236,34,59,57,12,12,6,5,1,18,17,148,5,5,11,
+158,116,106,0,1,251,155,253,93,254,187,255,206,0,64,0,0,5,50,21,20,6,35,34,
+53,53,52,55,54,51,50,23,54,51,50,23,22,21,20,7,6,7,5,22,51,50,55,54,55,55,
+21,20,7,6,35,54,53,53,6,6,35,34,38,53,52,55,37,54,55,54,53,52,39,38,35,34,
+7,38,35,34,7,6,252,49,70,70,75,75,85,85,50,50,130,130,50,50,85,85,65,64,132,
+254,123,50,75,74,112,112,77,150,25,25,150,50,89,226,135,100,100,67,1,193,
+67,34,33,27,28,23,24,148,156,23,23,24,24,221,31,35,62,65,53,53,64,64,96,96,
+64,64,61,56,40,39,35,103,21,19,19,79,24,197,43,21,22,43,43,42,50,53,70,69,
+75,16,113,20,22,21,25,31,14,13,114,114,14,14,0,0,2,251,125,253,118,2,101,
+5,220,0,6,0,86,0,0,1,21,50,53,52,39,38,37,35,52,39,38,35,34,7,38,35,34,7,
+6,21,21,50,23,22,21,20,35,34,53,53,52,54,51,50,23,54,51,50,22,21,51,50,23,
+22,51,50,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,
+7,23,17,20,33,34,39,38,35,35,21,35,38,53,52,55,54,252,67,41,11,10,1,190,1,
+53,12,15,54,98,99,54,15,12,53,63,31,31,125,198,215,53,44,119,119,44,52,214,
+50,100,85,85,130,120,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,
+43,192,254,204,200,75,75,50,50,190,100,25,24,254,37,75,50,12,7,6,145,64,43,
+9,117,117,9,43,64,45,31,32,62,150,100,220,122,158,114,114,158,122,100,100,
+131,5,112,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,250,37,
+251,100,100,200,170,50,50,25,24,0,0,2,246,98,253,118,254,150,255,176,0,4,
+0,51,0,0,1,21,54,53,52,5,17,52,38,35,34,6,21,21,50,23,22,21,20,7,7,35,17,
+52,54,51,50,22,21,21,55,23,53,52,54,51,50,22,21,17,35,17,52,38,35,34,6,21,
+17,35,39,7,246,248,50,1,194,145,105,105,145,75,38,37,75,75,150,220,180,180,
+220,250,250,220,180,180,220,150,145,105,105,145,150,250,250,254,62,77,29,
+27,21,200,1,64,80,50,50,80,20,30,30,60,70,55,55,1,64,130,120,120,130,144,
+206,206,144,130,120,120,130,254,192,1,64,80,50,50,80,254,192,215,215,0,0,
+2,251,155,253,118,254,187,255,156,0,4,0,29,0,0,1,21,54,53,52,39,52,54,51,
+50,22,21,17,35,17,52,38,35,34,6,21,21,50,23,22,21,20,7,7,35,252,49,50,200,
+220,180,180,220,150,145,105,105,145,75,38,37,75,75,150,254,42,67,19,27,21,
+120,130,120,120,130,254,212,1,44,80,70,70,80,20,30,30,60,70,45,45,0,0,1,251,
+55,253,118,255,31,255,156,0,37,0,0,1,52,55,54,51,50,23,22,23,22,23,22,51,
+20,35,34,39,38,39,38,39,38,35,34,7,6,21,20,23,22,51,20,7,6,35,34,39,38,251,
+55,88,87,175,164,118,116,53,52,45,46,56,50,100,66,66,43,43,84,84,114,100,
+50,50,38,37,75,25,25,50,100,50,50,254,112,125,87,88,84,83,100,100,41,42,100,
+46,46,100,100,79,79,62,63,75,75,37,38,50,25,25,62,63,0,0,1,251,155,253,118,
+254,187,255,206,0,48,0,0,5,52,35,52,55,54,51,50,23,22,21,20,7,6,7,6,7,22,
+51,50,55,54,55,54,55,54,51,50,21,17,20,7,6,35,54,53,53,6,7,6,35,34,39,38,
+53,52,55,54,54,253,93,50,25,25,50,50,25,25,54,54,121,121,80,49,80,102,117,
+117,14,10,22,22,32,65,49,48,98,45,101,80,81,89,124,88,87,50,200,200,164,22,
+46,23,23,23,23,46,45,68,68,62,63,19,59,97,96,63,40,19,19,46,254,194,46,23,
+25,48,46,80,101,36,37,46,43,88,103,15,60,109,0,3,251,140,253,120,254,203,
+255,206,0,16,0,33,0,78,0,0,5,6,7,6,7,23,23,22,23,51,50,55,54,55,54,53,52,
+1,6,21,20,23,22,23,22,51,50,55,54,55,55,6,7,6,1,54,51,51,22,23,22,21,20,7,
+6,7,6,35,34,39,38,38,39,39,6,7,6,35,34,39,38,39,38,53,52,55,54,55,54,55,54,
+55,54,53,52,39,54,51,50,254,15,17,57,64,72,50,69,12,11,7,36,25,26,10,1,253,
+238,1,18,21,48,13,13,30,23,32,6,7,47,52,52,1,183,24,38,8,43,38,32,3,16,55,
+48,77,12,13,19,45,25,66,11,52,43,71,16,18,129,60,52,1,8,52,170,119,118,38,
+16,28,5,69,75,142,64,50,56,40,24,26,4,1,38,41,87,11,10,55,254,188,5,5,25,
+8,11,6,2,11,15,52,72,23,21,22,1,111,37,5,49,39,65,16,19,141,64,56,1,2,13,
+8,20,97,43,35,1,14,47,41,66,10,10,71,20,33,57,55,65,28,16,22,3,39,0,2,251,
+80,253,118,255,6,255,206,0,32,0,45,0,0,1,34,39,38,53,52,55,54,51,33,53,51,
+21,51,21,35,21,50,23,22,21,20,7,6,35,34,39,38,53,5,35,6,6,39,20,23,22,51,
+50,55,37,53,33,34,7,6,252,120,148,74,74,75,75,150,1,94,150,150,150,50,25,
+25,31,32,62,62,32,31,254,212,27,8,13,152,33,32,85,23,27,1,44,254,162,85,32,
+33,253,228,48,48,95,84,52,51,112,112,112,124,29,28,78,59,29,29,36,34,70,28,
+1,1,191,30,25,25,3,28,124,23,24,0,0,1,254,74,253,118,2,101,5,220,0,39,0,0,
+1,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,35,
+37,5,35,17,52,51,50,22,21,20,7,21,37,5,1,19,87,88,56,168,108,54,47,33,6,5,
+36,82,41,6,7,38,57,68,43,192,188,254,249,254,250,188,174,54,72,112,1,6,1,
+7,3,225,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,249,42,215,
+215,1,144,150,40,50,100,60,114,216,216,0,0,2,251,155,253,120,254,187,255,
+156,0,4,0,25,0,0,5,53,6,21,20,1,17,51,17,55,23,53,34,39,38,53,52,55,54,51,
+50,21,17,35,39,7,254,37,40,253,158,150,250,250,65,38,37,70,70,75,75,150,250,
+250,254,58,22,20,16,254,118,2,36,254,125,189,189,156,23,22,47,53,43,43,58,
+254,22,197,197,0,0,2,251,155,253,118,254,187,255,156,0,6,0,41,0,0,0,35,21,
+50,53,52,39,39,50,23,22,21,20,35,34,53,53,52,54,51,50,23,54,51,50,22,21,17,
+35,17,52,39,38,35,34,7,38,35,34,7,6,21,252,77,20,41,11,30,63,31,31,125,158,
+185,53,44,119,119,44,52,184,157,58,14,17,57,96,97,57,17,14,58,254,23,69,46,
+11,6,98,29,29,57,138,92,202,112,144,104,104,144,112,254,218,1,38,58,49,11,
+119,119,11,49,58,0,0,2,251,5,253,118,254,187,255,156,0,4,0,29,0,0,1,20,23,
+53,34,55,17,35,39,38,53,52,55,54,51,53,52,54,51,50,22,21,17,35,17,52,38,35,
+34,6,251,105,50,50,200,150,75,75,37,38,75,220,180,180,220,150,145,105,105,
+145,254,21,27,19,67,120,254,212,45,45,70,60,30,30,20,130,120,120,130,254,
+212,1,44,80,70,70,0,2,251,55,253,118,255,31,255,156,0,35,0,42,0,0,1,34,39,
+38,53,52,55,54,51,21,20,23,22,51,51,50,55,37,53,51,21,50,22,21,20,7,6,35,
+34,39,38,53,5,35,6,6,5,52,35,20,51,51,50,252,0,100,51,50,37,38,95,23,22,45,
+10,9,1,1,114,150,100,100,44,43,88,88,43,44,254,122,3,15,28,2,154,80,39,1,
+40,254,18,48,49,97,50,25,25,80,36,22,23,1,40,220,220,105,75,75,37,38,50,50,
+100,40,1,3,6,50,80,0,0,1,254,74,253,118,2,101,5,220,0,42,0,0,5,52,51,50,23,
+22,21,20,35,21,20,33,32,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,
+7,6,35,34,39,39,7,23,17,20,33,32,53,254,74,124,64,56,56,112,1,7,1,6,87,88,
+56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,254,62,254,61,199,99,
+54,55,50,90,51,116,116,5,113,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,
+39,75,113,250,36,250,250,0,1,0,100,253,168,4,124,5,220,0,35,0,0,1,39,38,53,
+52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,51,50,53,53,
+51,21,20,33,32,53,1,19,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,
+43,192,249,248,188,254,76,254,75,3,225,53,53,32,31,85,253,62,32,27,1,5,35,
+128,6,1,34,39,75,113,250,86,116,116,250,250,250,250,0,1,251,14,253,118,255,
+72,255,156,0,49,0,0,1,52,55,54,51,50,23,22,23,22,22,51,50,54,55,54,51,50,
+21,20,7,6,7,6,35,34,39,38,39,38,38,35,34,6,21,20,51,50,53,50,23,22,21,20,
+7,6,35,34,39,38,251,14,75,75,150,120,82,82,44,42,81,39,39,81,22,21,76,53,
+11,35,76,77,85,110,73,73,36,38,103,65,75,75,50,50,50,25,25,38,37,75,100,50,
+50,254,76,153,92,91,64,65,130,99,59,189,114,114,65,29,43,137,137,138,54,54,
+108,121,101,117,108,92,61,22,23,46,46,23,23,46,46,0,0,2,251,155,253,118,254,
+187,255,206,0,14,0,30,0,0,0,35,34,39,38,53,52,55,50,36,55,50,21,20,7,3,6,
+7,6,7,20,23,22,51,50,55,54,55,7,6,6,253,164,221,150,75,75,90,90,1,29,185,
+150,139,71,105,110,110,105,38,37,65,140,98,98,12,5,13,26,253,118,51,50,98,
+124,1,118,158,150,207,121,1,18,77,49,49,22,35,23,23,94,94,133,3,10,20,0,1,
+253,218,253,118,2,101,5,220,0,50,0,0,3,20,33,32,53,17,35,53,51,17,39,38,53,
+52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,51,21,35,17,20,
+33,32,53,53,34,53,52,55,54,51,50,21,250,1,7,1,6,162,162,87,88,56,168,108,
+54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,150,150,254,62,254,61,112,56,56,
+64,124,254,112,116,116,1,144,144,3,81,53,53,32,31,85,253,62,32,27,1,5,35,
+128,6,1,34,39,75,113,252,68,144,254,112,250,250,50,90,50,55,55,100,0,1,251,
+130,253,118,254,212,255,156,0,39,0,0,1,20,23,22,51,50,55,54,53,53,52,55,54,
+51,50,23,22,21,17,35,17,52,39,38,35,34,7,6,21,21,20,7,6,35,34,39,38,53,17,
+51,252,24,25,25,50,50,25,25,62,63,125,125,63,62,150,25,25,50,50,25,25,62,
+63,125,125,63,62,150,254,62,50,25,25,25,25,50,150,100,50,50,50,50,100,254,
+162,1,94,50,25,25,25,25,50,150,100,50,50,50,50,100,1,94,0,1,251,115,253,118,
+254,227,255,156,0,31,0,0,1,52,51,53,52,35,35,53,51,50,21,21,33,53,52,35,35,
+53,51,50,21,17,35,38,53,52,51,53,33,17,35,38,251,115,80,30,50,55,175,1,244,
+30,50,55,175,150,80,80,254,12,150,80,253,243,75,220,30,100,130,60,60,30,100,
+130,254,92,79,46,75,60,254,252,79,0,0,1,254,62,251,80,255,6,253,68,0,8,0,
+0,3,35,17,38,53,52,51,50,21,250,150,50,100,100,251,80,1,93,16,56,79,79,0,
+1,253,84,251,80,255,123,253,68,0,27,0,0,1,34,53,52,55,55,34,53,52,51,50,21,
+20,7,7,6,21,20,51,50,55,54,51,50,21,20,7,6,254,68,229,19,50,80,120,123,21,
+41,11,70,97,63,72,54,25,38,58,251,80,142,40,51,115,77,75,95,39,56,99,26,18,
+48,172,209,51,67,149,233,0,1,252,245,251,80,255,123,253,68,0,37,0,0,1,6,35,
+34,53,52,55,55,34,53,52,51,50,23,22,21,20,7,7,6,21,20,51,50,55,22,51,50,55,
+18,51,50,21,20,7,6,35,34,254,56,92,85,146,58,62,84,120,100,30,10,36,60,38,
+24,52,141,21,36,33,24,75,39,39,17,37,116,113,251,180,100,102,59,92,95,77,
+75,51,18,22,43,59,94,61,27,22,148,148,95,1,46,74,75,155,196,0,2,251,130,7,
+208,255,6,9,96,0,10,0,18,0,0,1,52,33,32,23,22,21,20,35,33,34,55,20,51,33,
+38,38,35,34,251,130,1,44,1,4,255,85,100,253,168,200,150,50,2,8,130,179,111,
+150,8,102,250,225,75,50,50,150,50,97,53,0,2,251,130,7,208,255,6,9,196,0,7,
+0,19,0,0,1,20,51,33,38,38,35,34,5,17,51,17,20,35,33,34,53,52,33,50,252,24,
+50,2,8,130,179,111,150,2,104,134,100,253,168,200,1,44,236,8,102,50,97,53,
+34,1,28,254,62,50,150,250,0,3,251,130,7,208,255,6,9,196,0,7,0,30,0,42,0,0,
+1,20,51,33,38,38,35,34,37,53,54,55,54,51,50,23,22,21,20,7,7,22,21,20,35,33,
+34,53,52,33,50,23,22,23,22,23,54,53,52,35,34,21,20,252,24,50,2,8,144,195,
+101,130,1,98,11,49,50,86,100,50,50,66,2,68,100,253,168,200,1,24,108,233,24,
+25,24,21,65,80,80,8,102,50,85,65,95,4,75,38,38,50,50,100,115,49,2,57,27,50,
+150,250,119,15,16,15,15,8,72,80,80,6,0,2,251,130,7,208,255,6,9,196,0,7,0,
+24,0,0,1,20,51,33,38,38,35,34,37,53,51,21,22,23,17,51,17,20,35,33,34,53,52,
+33,50,252,24,50,2,8,130,179,111,150,1,110,134,59,57,134,100,253,168,200,1,
+44,109,8,102,50,97,53,111,139,203,35,46,1,28,254,62,50,150,250,0,2,252,99,
+7,208,254,37,9,146,0,11,0,27,0,0,1,20,22,51,50,54,53,52,38,35,34,6,5,20,7,
+6,35,34,39,38,53,52,55,54,51,50,23,22,252,244,40,40,40,40,40,40,40,40,1,49,
+56,56,113,113,56,56,56,56,113,113,56,56,8,177,50,50,50,50,50,50,50,50,113,
+56,56,56,56,113,113,56,56,56,56,0,0,1,252,114,7,208,254,22,9,115,0,11,0,0,
+1,35,53,51,53,51,21,51,21,35,21,35,253,8,150,150,120,150,150,120,8,101,121,
+149,149,121,149,0,0,1,252,124,7,208,255,56,9,196,0,31,0,0,1,50,21,20,35,34,
+39,20,51,50,55,54,53,52,35,34,53,52,51,50,23,22,21,20,7,6,35,34,39,38,53,
+52,253,38,130,75,65,10,100,175,63,62,50,50,50,75,63,62,112,113,225,125,63,
+62,9,24,98,89,47,93,49,50,100,112,47,47,52,51,103,148,73,73,47,47,94,140,
+0,2,0,150,0,0,7,120,5,220,0,6,0,80,0,0,37,54,53,52,39,38,35,1,35,17,52,39,
+39,38,35,34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,
+6,7,7,35,17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,
+54,55,54,51,50,22,21,17,35,17,52,38,35,34,6,21,1,182,98,27,27,44,2,250,188,
+34,68,11,11,24,24,55,56,58,79,55,73,25,20,13,11,44,6,93,145,44,43,40,40,76,
+76,188,100,133,132,46,48,95,74,6,8,20,30,41,83,52,37,61,62,39,27,11,12,125,
+170,200,250,188,156,106,96,166,222,90,77,40,19,18,254,46,4,145,76,21,41,6,
+28,60,60,1,49,68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,88,81,81,4,38,107,
+43,43,123,122,88,72,5,32,45,88,38,39,25,35,11,11,115,230,120,251,130,4,126,
+78,128,128,78,0,1,0,100,251,80,4,124,5,220,0,35,0,0,1,39,38,53,52,55,55,23,
+23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,51,50,53,53,51,21,20,33,
+32,53,1,19,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,249,
+248,188,254,76,254,75,3,225,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,
+39,75,113,247,254,116,116,250,250,250,250,0,2,251,136,7,8,0,105,9,133,0,5,
+0,59,0,0,1,33,38,38,35,34,5,22,21,20,35,33,34,53,16,33,50,23,54,55,54,51,
+50,23,54,55,54,55,55,50,23,22,21,20,7,6,7,6,7,6,35,38,35,34,7,6,21,20,23,
+22,23,54,53,52,51,50,21,20,7,6,252,24,1,244,97,162,91,150,2,182,56,100,253,
+118,144,1,38,125,123,8,34,45,130,127,48,76,65,64,42,11,19,23,15,12,45,60,
+61,75,36,34,74,63,45,27,28,11,14,14,71,70,70,44,20,7,152,77,45,118,57,41,
+50,144,1,0,51,56,46,59,59,25,44,43,72,2,29,20,14,14,10,63,50,49,37,11,70,
+28,29,37,28,27,10,10,2,16,31,31,59,30,14,0,0,2,253,200,251,80,1,182,9,96,
+0,5,0,37,0,0,1,33,38,38,35,34,1,20,33,32,53,53,51,21,20,33,32,53,17,52,35,
+33,34,53,16,33,50,23,53,51,21,22,23,17,51,17,22,21,254,88,1,244,97,162,91,
+150,3,94,254,62,254,62,188,1,6,1,6,124,253,218,144,1,38,109,107,134,59,57,
+134,112,7,202,77,45,244,6,250,250,250,250,106,106,10,90,150,144,1,0,39,189,
+253,35,46,1,28,254,109,71,176,0,0,1,253,194,251,80,1,182,9,157,0,40,0,0,1,
+20,33,32,53,53,51,21,20,33,32,53,17,16,33,34,7,6,7,35,34,39,38,53,52,54,53,
+52,35,52,51,50,21,20,6,21,21,54,51,32,17,1,182,254,62,254,62,188,1,6,1,6,
+254,238,160,61,61,42,9,37,41,89,50,100,100,188,50,132,180,1,206,252,74,250,
+250,250,250,106,106,10,30,1,4,48,48,4,30,75,116,65,135,70,70,100,170,85,115,
+70,43,66,254,108,0,2,252,124,7,8,0,0,8,152,0,10,0,18,0,0,1,52,33,32,23,22,
+21,20,35,33,34,55,20,51,33,38,38,35,34,252,124,1,44,1,4,255,85,100,253,168,
+200,150,50,2,8,130,179,111,150,7,158,250,225,75,50,50,150,50,97,53,0,2,252,
+124,7,8,0,0,8,252,0,7,0,19,0,0,1,20,51,33,38,38,35,34,5,17,51,17,20,35,33,
+34,53,52,33,50,253,18,50,2,8,130,179,111,150,2,104,134,100,253,168,200,1,
+44,236,7,158,50,97,53,34,1,28,254,62,50,150,250,0,3,252,124,7,8,0,0,8,252,
+0,7,0,30,0,42,0,0,1,20,51,33,38,38,35,34,37,53,54,55,54,51,50,23,22,21,20,
+7,7,22,21,20,35,33,34,53,52,33,50,23,22,23,22,23,54,53,52,35,34,21,20,253,
+18,50,2,8,144,195,101,130,1,98,11,49,50,86,100,50,50,66,2,68,100,253,168,
+200,1,24,108,233,24,25,24,21,65,80,80,7,158,50,85,65,95,4,75,38,38,50,50,
+100,115,49,2,57,27,50,150,250,119,15,16,15,15,8,72,80,80,6,0,2,252,124,7,
+8,0,0,8,252,0,7,0,24,0,0,1,20,51,33,38,38,35,34,37,53,51,21,22,23,17,51,17,
+20,35,33,34,53,52,33,50,253,18,50,2,8,130,179,111,150,1,110,134,59,57,134,
+100,253,168,200,1,44,109,7,158,50,97,53,111,139,203,35,46,1,28,254,62,50,
+150,250,0,2,253,118,7,8,255,56,8,202,0,11,0,27,0,0,1,20,22,51,50,54,53,52,
+38,35,34,6,5,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,254,7,40,40,40,40,
+40,40,40,40,1,49,56,56,113,113,56,56,56,56,113,113,56,56,7,233,50,50,50,50,
+50,50,50,50,113,56,56,56,56,113,113,56,56,56,56,0,0,2,253,98,7,8,255,76,8,
+202,0,6,0,13,0,0,1,17,20,7,38,53,17,33,17,20,7,38,53,17,254,7,82,83,1,234,
+82,83,8,202,254,172,80,30,30,80,1,84,254,172,80,30,30,80,1,84,0,1,253,58,
+7,8,0,0,8,249,0,46,0,0,1,20,23,22,51,50,53,52,51,50,21,20,7,6,35,34,39,38,
+53,52,55,54,51,50,23,54,55,54,55,55,50,23,22,21,20,7,6,7,6,7,6,35,38,35,34,
+7,6,253,208,12,13,35,50,70,70,44,44,97,127,44,44,45,45,130,127,48,76,65,64,
+42,11,19,23,15,12,45,60,61,75,36,34,74,63,45,27,28,7,184,38,18,19,18,31,31,
+59,30,30,44,44,87,77,59,59,59,25,44,43,72,2,29,20,14,14,10,63,50,49,37,11,
+70,28,29,0,2,252,130,7,8,1,99,9,133,0,5,0,59,0,0,1,33,38,38,35,34,5,22,21,
+20,35,33,34,53,16,33,50,23,54,55,54,51,50,23,54,55,54,55,55,50,23,22,21,20,
+7,6,7,6,7,6,35,38,35,34,7,6,21,20,23,22,23,54,53,52,51,50,21,20,7,6,253,18,
+1,244,97,162,91,150,2,182,56,100,253,118,144,1,38,125,123,8,34,45,130,127,
+48,76,65,64,42,11,19,23,15,12,45,60,61,75,36,34,74,63,45,27,28,11,14,14,71,
+70,70,44,20,7,152,77,45,118,57,41,50,144,1,0,51,56,46,59,59,25,44,43,72,2,
+29,20,14,14,10,63,50,49,37,11,70,28,29,37,28,27,10,10,2,16,31,31,59,30,14,
+0,0,2,248,248,253,118,252,24,255,156,0,4,0,31,0,0,1,21,54,53,52,39,52,54,
+51,50,22,21,17,35,17,52,38,35,34,6,21,21,50,23,22,21,20,7,6,35,34,53,249,
+142,50,200,220,180,180,220,150,145,105,105,145,75,38,37,75,75,75,75,254,42,
+67,19,27,21,120,130,120,120,130,254,212,1,44,80,70,70,80,20,30,30,60,70,45,
+45,75,0,0,2,248,249,253,118,252,24,255,206,0,32,0,41,0,0,5,52,55,54,51,50,
+23,22,21,17,20,7,6,35,37,7,6,35,34,39,39,38,53,52,55,54,55,54,51,33,38,39,
+38,23,33,34,7,6,7,23,55,23,251,80,25,25,50,50,25,25,27,26,54,254,236,113,
+38,21,21,28,170,25,88,91,73,74,63,1,5,26,12,13,50,254,239,60,56,55,55,110,
+140,249,119,34,18,17,35,34,69,254,136,43,21,22,146,110,36,40,236,34,59,57,
+12,12,6,5,1,18,17,148,5,5,11,158,116,106,0,1,248,248,253,93,252,24,255,206,
+0,64,0,0,5,50,21,20,6,35,34,53,53,52,55,54,51,50,23,54,51,50,23,22,21,20,
+7,6,7,5,22,51,50,55,54,55,55,21,20,7,6,35,54,53,53,6,6,35,34,38,53,52,55,
+37,54,55,54,53,52,39,38,35,34,7,38,35,34,7,6,249,142,70,70,75,75,85,85,50,
+50,130,130,50,50,85,85,65,64,132,254,123,50,75,74,112,112,77,150,25,25,150,
+50,89,226,135,100,100,67,1,193,67,34,33,27,28,23,24,148,156,23,23,24,24,221,
+31,35,62,65,53,53,64,64,96,96,64,64,61,56,40,39,35,103,21,19,19,79,24,197,
+43,21,22,43,43,42,50,53,70,69,75,16,113,20,22,21,25,31,14,13,114,114,14,14,
+0,0,1,248,223,253,118,252,49,255,156,0,39,0,0,1,20,23,22,51,50,55,54,53,53,
+52,55,54,51,50,23,22,21,17,35,17,52,39,38,35,34,7,6,21,21,20,7,6,35,34,39,
+38,53,17,51,249,117,25,25,50,50,25,25,62,63,125,125,63,62,150,25,25,50,50,
+25,25,62,63,125,125,63,62,150,254,62,50,25,25,25,25,50,150,100,50,50,50,50,
+100,254,162,1,94,50,25,25,25,25,50,150,100,50,50,50,50,100,1,94,0,2,252,224,
+253,118,0,0,255,156,0,4,0,31,0,0,1,21,54,53,52,39,52,54,51,50,22,21,17,35,
+17,52,38,35,34,6,21,21,50,23,22,21,20,7,6,35,34,53,253,118,50,200,220,180,
+180,220,150,145,105,105,145,75,38,37,75,75,75,75,254,42,67,19,27,21,120,130,
+120,120,130,254,212,1,44,80,70,70,80,20,30,30,60,70,45,45,75,0,0,2,252,74,
+253,118,0,0,255,156,0,4,0,31,0,0,1,20,23,53,34,55,21,20,35,34,39,38,53,52,
+55,54,51,53,52,54,51,50,22,21,17,35,17,52,38,35,34,6,252,174,50,50,200,75,
+75,75,75,37,38,75,220,180,180,220,150,145,105,105,145,254,21,27,19,67,120,
+225,75,45,45,70,60,30,30,20,130,120,120,130,254,212,1,44,80,70,70,0,0,2,252,
+114,253,118,0,90,255,156,0,35,0,42,0,0,1,34,39,38,53,52,55,54,51,21,20,23,
+22,51,51,50,55,37,53,51,21,50,22,21,20,7,6,35,34,39,38,53,5,35,6,6,5,52,35,
+20,51,51,50,253,59,100,51,50,37,38,95,23,22,45,10,9,1,1,114,150,100,100,44,
+43,88,88,43,44,254,122,3,15,28,2,154,80,39,1,40,254,18,48,49,97,50,25,25,
+80,36,22,23,1,40,220,220,105,75,75,37,38,50,50,100,40,1,3,6,50,80,0,0,1,251,
+130,253,118,252,74,255,156,0,8,0,0,1,35,17,38,53,52,51,50,21,252,74,150,50,
+100,100,253,118,1,127,18,62,87,87,0,0,1,250,35,253,118,252,74,255,201,0,27,
+0,0,1,34,53,52,55,55,34,53,52,51,50,21,20,7,7,6,21,20,51,50,55,54,51,50,21,
+20,7,2,251,19,229,19,50,80,120,123,21,41,11,70,97,63,72,54,25,38,58,253,118,
+168,48,61,137,91,90,114,47,66,117,31,22,57,205,249,61,80,177,254,235,0,0,
+1,249,196,253,118,252,74,255,207,0,37,0,0,1,6,35,34,53,52,55,55,34,53,52,
+51,50,23,22,21,20,7,7,6,21,20,51,50,55,22,51,50,55,18,51,50,21,20,7,6,35,
+34,251,7,92,85,146,58,62,84,120,100,30,10,36,60,38,24,52,141,21,36,33,24,
+75,39,39,17,37,116,113,253,237,119,122,71,111,114,92,91,61,22,27,51,72,112,
+74,33,26,178,178,114,1,108,89,91,186,235,0,1,251,130,251,80,252,74,253,68,
+0,8,0,0,1,35,17,38,53,52,51,50,21,252,74,150,50,100,100,251,80,1,93,16,56,
+79,79,0,0,1,250,152,251,80,252,191,253,68,0,27,0,0,1,34,53,52,55,55,34,53,
+52,51,50,21,20,7,7,6,21,20,51,50,55,54,51,50,21,20,7,6,251,136,229,19,50,
+80,120,123,21,41,11,70,97,63,72,54,25,38,58,251,80,142,40,51,115,77,75,95,
+39,56,99,26,18,48,172,209,51,67,149,233,0,1,250,57,251,80,252,191,253,68,
+0,37,0,0,1,6,35,34,53,52,55,55,34,53,52,51,50,23,22,21,20,7,7,6,21,20,51,
+50,55,22,51,50,55,18,51,50,21,20,7,6,35,34,251,124,92,85,146,58,62,84,120,
+100,30,10,36,60,38,24,52,141,21,36,33,24,75,39,39,17,37,116,113,251,180,100,
+102,59,92,95,77,75,51,18,22,43,59,94,61,27,22,148,148,95,1,46,74,75,155,196,
+0,2,251,80,251,80,255,56,253,68,0,35,0,42,0,0,1,34,39,38,53,52,55,54,51,21,
+20,23,22,51,51,50,55,37,53,51,21,50,22,21,20,7,6,35,34,39,38,53,5,35,6,6,
+5,52,35,20,51,51,50,252,25,100,51,50,37,38,95,23,22,45,10,9,1,1,114,150,100,
+100,44,43,88,88,43,44,254,122,3,15,28,2,154,80,39,1,40,251,222,44,44,89,45,
+23,23,73,33,20,21,1,36,200,200,95,68,68,34,35,46,45,91,36,1,3,5,45,72,0,0,
+1,251,155,251,80,254,237,253,68,0,39,0,0,1,20,23,22,51,50,55,54,53,53,52,
+55,54,51,50,23,22,21,17,35,17,52,39,38,35,34,7,6,21,21,20,7,6,35,34,39,38,
+53,17,51,252,49,25,25,50,50,25,25,62,63,125,125,63,62,150,25,25,50,50,25,
+25,62,63,125,125,63,62,150,252,6,45,23,23,23,23,45,137,91,45,45,45,45,91,
+254,193,1,63,45,23,23,23,23,45,137,91,45,46,46,45,91,1,62,0,2,0,180,0,0,7,
+120,5,220,0,23,0,71,0,0,33,17,52,39,38,35,35,34,7,6,21,17,35,17,52,55,54,
+51,51,50,23,22,21,17,1,53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,
+23,23,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,7,6,21,20,
+23,7,38,3,244,78,78,106,50,106,78,78,188,125,125,200,50,200,125,125,252,4,
+100,102,203,49,53,163,83,43,46,47,40,77,156,54,53,116,202,145,188,63,64,145,
+57,57,66,120,91,77,85,125,73,68,62,63,70,70,167,175,180,2,238,58,49,49,49,
+49,58,253,18,2,238,100,100,100,100,100,100,253,18,4,103,75,52,61,61,124,112,
+56,29,29,56,112,80,140,100,180,252,24,3,232,81,41,45,100,41,100,81,85,50,
+46,47,47,36,50,63,76,39,0,0,2,0,250,0,0,7,120,5,220,0,6,0,83,0,0,1,21,50,
+53,52,39,38,37,21,20,5,5,21,20,23,22,51,51,50,55,54,53,17,55,17,20,7,6,35,
+35,34,39,38,53,53,37,36,53,53,52,39,38,35,35,34,7,6,21,21,50,23,22,21,20,
+35,34,53,53,52,55,54,51,51,50,23,22,23,55,54,51,50,23,23,22,21,17,35,17,39,
+38,35,34,7,7,1,182,48,13,12,2,227,254,131,254,131,78,78,106,50,106,78,78,
+188,125,125,200,50,200,125,125,1,220,1,30,78,78,106,50,106,78,78,74,37,37,
+148,188,125,125,200,50,200,125,38,27,108,128,91,89,86,192,78,188,237,22,28,
+47,63,65,4,1,75,50,12,7,6,178,153,172,197,196,185,58,49,49,49,49,58,1,44,
+100,254,112,100,100,100,100,100,100,250,245,148,107,150,58,49,49,49,49,58,
+75,31,32,62,150,100,250,100,100,100,100,31,30,74,87,67,151,59,95,251,152,
+4,104,191,17,45,45,0,2,0,180,0,0,7,120,5,220,0,47,0,87,0,0,19,53,52,55,55,
+54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,21,17,35,17,52,47,2,38,35,
+34,7,6,35,34,39,39,38,35,34,7,6,21,20,23,7,38,1,7,35,17,52,55,54,51,51,50,
+23,22,21,17,35,17,52,39,38,35,35,34,7,6,21,17,55,54,51,50,21,20,35,34,53,
+52,35,34,7,7,180,100,102,203,49,53,163,83,43,46,47,40,77,156,54,53,116,202,
+145,188,63,64,145,57,57,66,120,91,77,85,125,73,68,62,63,70,70,167,175,180,
+1,2,20,168,125,125,200,50,200,125,125,188,78,78,106,50,106,78,78,45,79,100,
+138,77,57,24,24,50,49,4,103,75,52,61,61,124,112,56,29,29,56,112,80,140,100,
+180,252,24,3,232,81,41,45,100,41,100,81,85,50,46,47,47,36,50,63,76,39,252,
+63,67,2,238,100,100,100,100,100,100,253,18,2,238,58,49,49,49,49,58,254,62,
+72,128,120,80,33,33,83,82,0,0,2,0,100,0,0,10,39,5,220,0,6,0,101,0,0,1,6,21,
+20,23,22,51,1,20,7,6,35,34,39,38,39,6,7,6,35,34,39,38,53,17,34,39,38,53,52,
+55,54,55,54,51,50,21,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,23,23,
+22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,23,22,51,50,55,54,53,17,39,
+38,53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,1,19,50,15,15,
+20,6,76,125,125,200,200,125,17,14,14,17,125,200,200,125,125,100,37,38,22,
+22,66,65,64,124,78,78,106,106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,
+6,7,38,57,68,43,192,78,78,106,106,78,78,87,88,81,120,121,93,83,72,1,141,108,
+188,254,117,57,31,71,117,147,4,242,50,31,25,11,10,252,185,100,100,100,100,
+13,14,14,13,100,100,100,100,2,188,50,50,55,57,49,50,95,94,100,251,180,58,
+49,49,49,49,58,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,
+113,252,224,58,49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,182,50,121,
+251,166,4,90,182,26,136,86,0,3,0,100,0,0,7,120,6,164,0,6,0,14,0,87,0,0,19,
+53,6,21,20,23,22,1,52,35,34,21,20,23,54,23,22,21,17,35,37,5,35,17,34,38,53,
+52,54,54,51,50,21,17,37,5,17,52,39,38,39,6,35,34,39,38,53,52,54,53,52,35,
+52,51,50,21,20,6,21,20,22,51,50,55,38,53,52,51,50,21,20,7,55,54,51,50,23,
+23,22,21,17,35,17,39,38,35,34,7,250,40,10,10,2,188,50,50,58,42,151,119,188,
+254,225,254,225,188,80,70,39,111,94,94,1,31,1,31,44,44,36,142,166,158,83,
+89,50,100,100,188,50,82,60,114,73,77,190,190,3,181,128,91,89,86,192,78,188,
+237,22,28,47,63,2,127,97,20,31,25,10,11,2,169,46,46,34,38,25,151,84,139,252,
+125,236,236,1,244,100,55,57,89,99,100,253,154,237,237,2,201,108,34,24,24,
+89,69,75,116,65,135,70,70,100,170,85,115,70,69,47,29,71,76,180,180,16,15,
+124,87,67,151,59,95,251,152,4,104,191,17,45,0,0,2,0,150,0,0,7,120,5,220,0,
+6,0,88,0,0,1,53,6,21,20,23,22,1,20,23,22,51,51,50,55,54,53,17,34,38,53,52,
+54,54,51,50,21,17,20,7,6,35,35,34,39,38,53,17,38,38,53,52,54,55,55,54,51,
+50,23,23,22,51,50,55,55,54,51,50,23,23,22,21,17,35,17,52,47,2,38,35,34,7,
+6,35,34,39,39,38,35,34,7,7,6,21,20,31,2,3,244,40,10,10,253,214,78,78,106,
+50,106,78,78,80,70,39,111,94,94,125,125,200,50,200,125,125,70,30,30,101,102,
+202,49,53,163,83,43,46,47,40,77,156,54,53,116,202,145,188,63,64,145,57,57,
+66,120,91,77,85,125,73,68,62,63,96,48,29,12,30,61,2,227,97,20,31,25,10,11,
+254,73,58,49,49,49,49,58,1,44,100,55,57,89,99,100,253,168,100,100,100,100,
+100,100,2,198,66,51,38,37,52,62,61,123,112,56,29,29,56,112,80,140,100,180,
+252,24,3,232,81,41,45,100,41,100,81,85,50,46,54,27,16,19,12,13,33,66,0,0,
+3,0,100,0,0,7,120,5,220,0,6,0,12,0,96,0,0,1,53,6,21,20,23,22,1,34,6,21,20,
+23,19,32,21,20,51,50,53,17,34,38,53,52,54,54,51,50,21,17,20,33,32,53,52,35,
+17,35,39,38,53,52,54,51,17,38,38,53,52,54,55,55,54,51,50,23,23,22,51,50,55,
+55,54,51,50,23,23,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,
+7,7,6,21,20,31,2,3,244,40,10,10,253,26,20,20,40,188,1,50,156,112,80,70,39,
+111,94,94,254,212,254,212,162,188,75,75,80,70,70,30,30,101,102,202,49,53,
+163,83,43,46,47,40,77,156,54,53,116,202,145,188,63,64,145,57,57,66,120,91,
+77,85,125,73,68,62,63,96,48,29,12,30,61,2,227,97,20,31,25,10,11,254,139,21,
+30,31,50,1,10,250,106,106,1,94,100,55,57,89,99,100,253,118,250,250,116,254,
+146,124,124,97,65,90,1,254,66,51,38,37,52,62,61,123,112,56,29,29,56,112,80,
+140,100,180,252,24,3,232,81,41,45,100,41,100,81,85,50,46,54,27,16,19,12,13,
+33,66,0,1,0,150,0,0,7,120,6,164,0,74,0,0,1,6,35,34,39,39,38,35,34,7,6,7,7,
+6,21,20,31,2,17,37,5,17,51,17,35,37,5,35,17,38,38,53,52,54,55,55,54,51,50,
+23,22,51,50,55,54,53,52,35,34,53,52,51,50,23,22,21,21,55,55,54,51,50,23,23,
+22,21,17,35,17,39,38,35,34,7,4,93,88,139,191,137,64,35,27,6,5,31,32,23,10,
+18,30,61,1,31,1,31,188,188,254,225,254,225,188,70,30,30,65,66,131,29,29,152,
+156,82,92,42,42,146,100,100,130,75,75,14,41,121,91,89,86,192,78,188,237,20,
+33,62,107,4,180,78,98,45,27,1,7,37,25,11,12,17,19,33,66,252,142,237,237,3,
+46,252,24,236,236,3,242,66,51,38,37,52,61,61,124,112,108,35,35,70,102,89,
+89,81,81,118,7,7,20,60,67,151,59,95,251,152,4,104,191,15,54,0,0,2,0,140,0,
+0,13,8,5,220,0,6,0,125,0,0,37,54,53,52,39,38,35,5,20,7,6,35,34,39,38,39,6,
+7,6,35,34,39,38,53,17,52,39,39,38,35,34,7,7,23,22,21,17,50,23,22,21,20,7,
+6,7,7,35,17,39,38,53,52,55,55,54,51,50,23,23,22,21,17,20,23,22,51,50,55,54,
+53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,
+20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,54,51,50,23,5,22,21,17,35,17,
+37,38,35,34,7,23,1,182,98,27,27,44,8,138,125,125,200,200,125,17,14,14,17,
+125,200,200,125,125,39,207,37,89,104,68,129,38,61,145,44,43,40,40,76,76,188,
+62,48,100,137,161,102,158,80,214,108,78,78,106,106,78,78,87,88,56,168,108,
+54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,78,106,106,78,78,87,88,81,120,
+121,93,83,72,1,141,108,188,254,117,57,31,71,117,147,222,90,77,40,19,18,166,
+100,100,100,100,13,14,14,13,100,100,100,100,2,238,76,28,142,26,51,98,25,38,
+60,254,62,59,60,66,78,87,88,81,81,3,240,38,29,65,65,74,102,119,53,150,72,
+175,253,18,58,49,49,49,49,58,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,
+6,1,34,39,75,113,252,224,58,49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,
+182,50,121,251,166,4,90,182,26,136,86,0,0,3,0,150,253,168,10,64,5,220,0,44,
+0,51,0,146,0,0,5,52,55,54,51,50,23,22,21,20,6,35,34,39,38,39,38,39,38,35,
+34,7,6,7,52,55,54,54,51,50,4,23,22,22,51,50,54,53,52,39,6,35,34,38,38,1,54,
+53,52,39,38,35,1,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,39,39,38,35,
+34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,35,
+17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,54,55,54,
+51,50,23,22,23,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,7,6,79,30,31,
+63,86,43,44,214,173,135,113,111,120,119,124,123,87,91,89,89,74,36,38,168,
+141,159,1,0,133,132,150,82,70,109,2,15,16,19,37,20,251,103,98,27,27,44,5,
+189,5,188,156,106,96,166,188,34,68,11,11,24,24,55,56,58,79,55,73,25,20,13,
+11,44,6,93,145,44,43,40,40,76,76,188,100,133,132,46,48,95,74,6,8,20,30,41,
+83,52,37,61,62,39,27,11,12,125,170,200,125,30,22,121,128,91,89,86,192,78,
+188,237,22,28,47,63,65,200,50,25,25,50,50,100,150,150,38,37,88,87,50,50,22,
+23,45,60,43,42,95,94,97,97,78,66,100,15,12,8,22,38,1,187,90,77,40,19,18,2,
+222,25,25,251,130,4,126,78,128,128,78,251,130,4,145,76,21,41,6,28,60,60,1,
+49,68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,88,81,81,4,38,107,43,43,123,
+122,88,72,5,32,45,88,38,39,25,35,11,11,115,115,27,28,83,87,67,151,59,95,251,
+152,4,104,191,17,45,45,0,0,3,0,250,0,0,7,120,6,164,0,12,0,24,0,76,0,0,1,51,
+50,53,52,39,38,35,34,7,6,21,20,19,17,37,5,17,51,17,35,37,5,35,17,37,6,7,6,
+35,34,39,39,38,38,53,52,55,54,51,50,23,22,21,20,7,22,23,22,51,50,54,53,52,
+35,34,53,52,51,32,19,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,1,181,
+24,53,12,14,27,26,14,13,30,1,31,1,31,188,188,254,225,254,225,188,3,106,18,
+22,117,232,54,47,96,96,192,52,53,90,91,51,52,54,29,32,42,47,143,134,112,100,
+100,1,26,17,56,121,91,89,86,192,78,188,237,20,33,62,107,4,240,50,24,12,14,
+13,12,25,29,254,177,253,4,237,237,3,46,252,24,236,236,3,252,188,20,19,99,
+2,5,5,119,109,83,54,53,43,43,75,75,43,3,2,2,86,76,146,98,80,254,225,27,60,
+67,151,59,95,251,152,4,104,191,15,54,0,2,0,100,0,0,7,120,6,164,0,6,0,86,0,
+0,1,6,21,20,23,22,51,37,6,7,6,35,34,39,7,23,17,20,7,6,35,35,34,39,38,53,17,
+34,39,38,53,52,55,54,55,54,51,50,21,17,20,23,22,51,51,50,55,54,53,17,39,38,
+53,52,19,22,51,51,54,53,52,39,38,53,52,55,54,51,50,23,22,23,54,51,50,23,23,
+22,21,17,35,17,39,38,35,34,7,1,19,50,15,15,20,4,23,10,12,51,44,45,114,24,
+203,125,125,200,50,200,125,125,100,37,38,22,22,66,65,64,124,78,78,106,50,
+106,78,78,87,88,154,135,31,3,27,96,83,2,15,68,67,83,73,8,65,53,89,86,192,
+78,188,237,22,28,47,63,4,242,50,31,25,11,10,148,17,13,51,69,60,115,252,224,
+100,100,100,100,100,100,2,188,50,50,55,57,49,50,95,94,100,251,180,58,49,49,
+49,49,58,2,181,53,53,32,31,1,82,132,8,64,62,40,35,48,8,8,59,60,53,116,29,
+67,151,59,95,251,152,4,104,191,17,45,0,2,0,250,255,156,7,120,5,220,0,6,0,
+97,0,0,1,21,50,53,52,39,38,37,21,20,5,5,21,20,23,22,51,50,55,54,55,54,51,
+53,55,17,20,35,34,53,54,53,53,34,7,6,7,6,35,34,39,38,53,17,37,36,53,53,52,
+39,38,35,34,7,38,35,34,7,6,21,21,50,23,22,21,20,35,34,53,53,52,55,54,51,50,
+23,54,51,50,23,22,23,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,1,182,
+48,13,12,2,227,254,131,254,131,24,24,41,59,51,151,73,74,77,188,154,104,70,
+48,47,47,127,127,89,129,74,74,1,220,1,30,75,18,21,68,104,105,69,21,18,75,
+74,37,37,148,188,116,116,63,52,129,128,53,62,115,40,26,98,128,91,89,86,192,
+78,188,237,22,28,47,63,4,1,75,50,12,7,6,178,153,172,197,196,235,53,26,27,
+42,126,44,44,183,90,253,145,150,72,32,56,206,31,32,101,102,58,59,133,1,44,
+245,148,107,150,64,52,13,130,130,13,52,64,75,31,32,62,150,100,250,122,89,
+89,134,134,89,31,34,67,87,67,151,59,95,251,152,4,104,191,17,45,0,3,0,150,
+0,0,10,64,5,220,0,6,0,12,0,113,0,0,37,54,53,52,39,38,35,5,34,6,21,20,23,37,
+20,33,32,53,52,35,17,35,39,38,53,52,54,51,17,52,39,39,38,35,34,7,7,6,35,38,
+39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,35,17,38,53,52,55,
+54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,21,17,32,21,20,51,50,53,17,
+39,38,53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,1,182,98,
+27,27,44,2,62,20,20,40,3,132,254,212,254,252,152,188,75,75,80,70,34,68,11,
+11,24,24,55,56,58,79,55,73,25,20,13,11,44,6,93,145,44,43,40,40,76,76,188,
+100,133,132,46,48,95,74,6,8,20,30,41,83,52,37,61,62,122,1,40,116,112,87,88,
+81,120,121,93,83,72,1,141,108,188,254,117,57,31,71,117,147,222,90,77,40,19,
+18,100,21,30,31,50,16,250,250,116,254,146,124,124,97,65,90,2,157,76,21,41,
+6,28,60,60,1,49,68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,88,81,81,4,38,
+107,43,43,123,122,88,72,5,32,45,88,38,39,77,177,253,99,250,106,106,2,231,
+53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,26,136,86,0,0,2,0,140,
+0,0,12,214,5,220,0,6,0,104,0,0,37,54,53,52,39,38,35,1,22,21,17,35,17,47,3,
+38,35,34,7,6,7,23,22,21,17,35,37,5,35,17,47,3,38,35,34,7,6,7,23,22,21,17,
+50,23,22,21,20,7,6,7,7,35,17,39,38,53,52,55,55,54,51,50,31,2,22,21,17,37,
+5,17,39,38,53,52,55,55,54,51,50,31,2,22,23,55,54,51,50,23,23,22,21,17,35,
+17,39,38,35,34,7,1,182,98,27,27,44,8,83,5,188,149,29,21,121,57,31,56,74,74,
+24,51,61,188,254,250,254,250,188,149,29,21,121,57,31,56,74,74,24,51,61,145,
+44,43,40,40,76,76,188,62,48,83,125,124,93,83,72,121,201,108,1,6,1,6,62,48,
+83,125,124,93,83,72,121,201,6,6,144,128,91,89,86,192,78,188,237,22,28,47,
+63,222,90,77,40,19,18,2,222,24,27,251,131,4,125,68,13,10,56,26,56,56,28,34,
+38,60,251,230,215,215,4,125,68,13,10,56,26,56,56,28,34,38,60,254,62,59,60,
+66,78,87,88,81,81,3,240,38,29,65,65,74,110,111,33,55,92,50,121,252,61,216,
+216,3,54,38,29,65,65,74,110,111,33,55,92,3,3,99,87,67,151,59,95,251,152,4,
+104,191,17,45,0,3,0,180,0,0,7,120,5,220,0,47,0,54,0,87,0,0,19,53,52,55,55,
+54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,21,17,35,17,52,47,2,38,35,
+34,7,6,35,34,39,39,38,35,34,7,6,21,20,23,7,38,1,54,53,52,39,38,35,3,52,55,
+54,51,51,50,23,22,21,17,35,17,52,39,38,35,35,34,7,6,21,21,50,23,22,21,20,
+7,6,7,7,35,180,100,102,203,49,53,163,83,43,46,47,40,77,156,54,53,116,202,
+145,188,63,64,145,57,57,66,120,91,77,85,125,73,68,62,63,70,70,167,175,180,
+1,2,50,15,15,20,188,125,125,200,50,200,125,125,188,78,78,106,50,106,78,78,
+100,37,38,22,22,65,66,188,4,103,75,52,61,61,124,112,56,29,29,56,112,80,140,
+100,180,252,24,3,232,81,41,45,100,41,100,81,85,50,46,47,47,36,50,63,76,39,
+252,230,50,31,25,11,10,1,133,100,100,100,100,100,100,253,18,2,238,58,49,49,
+49,49,58,250,50,50,55,57,49,50,94,95,0,0,2,0,150,0,0,7,120,6,164,0,6,0,101,
+0,0,1,53,6,21,20,23,22,19,7,6,35,34,39,39,38,35,34,7,6,7,7,6,21,20,31,2,17,
+20,23,22,51,51,50,55,54,53,17,34,38,53,52,54,54,51,50,21,17,20,7,6,35,35,
+34,39,38,53,17,38,38,53,52,54,55,55,54,51,50,23,22,51,50,55,54,53,52,35,34,
+53,52,51,50,23,22,21,21,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,3,
+244,40,10,10,124,1,86,139,191,137,64,35,27,6,5,31,32,23,10,18,30,61,78,78,
+106,50,106,78,78,80,70,39,111,94,94,125,125,200,50,200,125,125,70,30,30,65,
+66,131,29,29,152,156,82,92,42,42,146,100,100,130,75,75,55,121,91,89,86,192,
+78,188,237,20,33,62,107,2,227,97,20,31,25,10,11,1,208,1,76,98,45,27,1,7,37,
+25,11,12,17,19,33,66,253,0,58,49,49,49,49,58,1,44,100,55,57,89,99,100,253,
+168,100,100,100,100,100,100,2,198,66,51,38,37,52,61,61,124,112,108,35,35,
+70,102,89,89,81,81,118,7,27,60,67,151,59,95,251,152,4,104,191,15,54,0,0,3,
+0,250,0,0,7,120,5,220,0,5,0,12,0,94,0,0,1,34,21,50,53,52,3,6,21,20,51,53,
+34,55,21,20,35,34,53,52,54,51,52,39,38,35,35,34,7,6,21,21,20,23,22,51,51,
+52,54,51,50,22,21,20,7,6,35,21,20,6,35,34,38,53,53,51,21,20,22,51,50,54,53,
+53,35,34,39,38,53,53,52,55,54,51,51,50,23,22,23,55,54,51,50,23,23,22,21,17,
+35,17,39,38,35,34,7,4,18,34,62,83,13,38,13,201,188,138,74,64,78,78,106,50,
+106,78,78,79,79,130,94,105,117,69,89,45,44,103,157,151,137,171,178,70,60,
+44,76,94,218,129,129,125,125,200,50,200,125,38,27,108,128,91,89,86,192,78,
+188,237,22,28,47,63,2,198,39,20,19,1,128,7,12,30,55,103,158,100,130,62,63,
+58,49,49,49,49,58,255,127,73,74,50,110,65,74,86,32,33,239,151,151,127,123,
+200,200,42,64,77,80,240,114,113,177,255,100,100,100,100,31,30,74,87,67,151,
+59,95,251,152,4,104,191,17,45,0,0,2,0,150,0,0,7,120,5,220,0,6,0,76,0,0,1,
+53,6,21,20,23,22,1,38,38,53,52,54,55,55,54,51,50,23,23,22,51,50,55,55,54,
+51,50,23,23,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,7,7,
+6,21,20,31,2,17,37,5,17,34,38,53,52,54,54,51,50,21,17,35,37,5,35,3,244,40,
+10,10,253,26,70,30,30,101,102,202,49,53,163,83,43,46,47,40,77,156,54,53,116,
+202,145,188,63,64,145,57,57,66,120,91,77,85,125,73,68,62,63,96,48,29,12,30,
+61,1,31,1,31,80,70,39,111,94,94,188,254,225,254,225,188,2,227,97,20,31,25,
+10,11,1,15,66,51,38,37,52,62,61,123,112,56,29,29,56,112,80,140,100,180,252,
+24,3,232,81,41,45,100,41,100,81,85,50,46,54,27,16,19,12,13,33,66,252,142,
+237,237,1,158,100,55,57,89,99,100,252,124,236,236,0,0,2,0,250,0,0,7,120,5,
+220,0,6,0,91,0,0,1,6,21,20,51,53,34,19,53,55,54,51,50,23,23,22,21,17,35,17,
+39,38,35,34,7,7,21,20,35,34,53,52,55,54,51,53,52,39,38,35,35,34,7,6,21,21,
+20,5,5,17,20,7,6,35,34,39,38,39,38,39,38,35,17,35,17,23,21,50,23,22,23,22,
+23,22,51,50,55,54,53,17,37,36,53,53,52,55,54,51,51,50,23,22,3,209,13,48,23,
+151,108,128,91,89,86,192,78,188,237,22,28,47,63,127,188,148,37,37,74,78,78,
+106,50,106,78,78,1,27,1,223,74,74,149,89,72,73,55,34,47,47,48,188,188,77,
+74,73,54,54,37,37,59,61,24,24,254,145,254,117,125,125,200,50,200,125,39,4,
+35,7,12,50,75,1,17,1,74,87,67,151,59,95,251,152,4,104,191,17,45,88,213,100,
+150,62,32,31,35,58,49,49,49,49,58,150,136,99,167,254,114,133,59,58,39,39,
+78,47,32,31,254,246,2,161,90,183,44,44,74,75,9,10,27,26,53,1,55,128,138,223,
+150,100,100,100,100,31,0,1,0,150,255,106,7,120,5,220,0,73,0,0,37,6,35,35,
+34,39,38,53,17,38,38,53,52,54,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,
+23,23,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,7,7,6,21,20,
+31,2,17,20,23,22,51,51,50,55,54,53,17,51,17,35,3,244,109,153,50,200,125,125,
+70,30,30,101,102,202,49,53,163,83,43,46,47,40,77,156,54,53,116,202,145,188,
+63,64,145,57,57,66,120,91,77,85,125,73,68,62,63,96,48,29,12,30,61,78,78,106,
+50,106,78,78,188,188,58,58,100,100,100,2,198,66,51,38,37,52,62,61,123,112,
+56,29,29,56,112,80,140,100,180,252,24,3,232,81,41,45,100,41,100,81,85,50,
+46,54,27,16,19,12,13,33,66,253,0,58,49,49,49,49,58,2,188,251,130,0,0,2,0,
+150,0,0,7,120,6,164,0,6,0,89,0,0,1,53,6,21,20,23,22,19,7,6,35,34,39,39,38,
+35,34,7,6,7,7,6,21,20,31,2,17,37,5,17,34,38,53,52,54,54,51,50,21,17,35,37,
+5,35,17,38,38,53,52,54,55,55,54,51,50,23,22,51,50,55,54,53,52,35,34,53,52,
+51,50,23,22,21,21,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,3,244,40,
+10,10,124,1,86,139,191,137,64,35,27,6,5,31,32,23,10,18,30,61,1,31,1,31,80,
+70,39,111,94,94,188,254,225,254,225,188,70,30,30,65,66,131,29,29,152,156,
+82,92,42,42,146,100,100,130,75,75,55,121,91,89,86,192,78,188,237,20,33,62,
+107,2,227,97,20,31,25,10,11,1,208,1,76,98,45,27,1,7,37,25,11,12,17,19,33,
+66,252,142,237,237,1,158,100,55,57,89,99,100,252,124,236,236,3,242,66,51,
+38,37,52,61,61,124,112,108,35,35,70,102,89,89,81,81,118,7,27,60,67,151,59,
+95,251,152,4,104,191,15,54,0,0,2,0,150,0,0,7,120,5,220,0,6,0,83,0,0,37,54,
+53,52,39,38,35,1,22,21,17,35,17,52,39,39,38,35,34,7,7,6,35,38,39,39,38,35,
+34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,35,17,38,53,52,55,54,51,50,23,
+23,22,51,50,55,55,54,51,50,23,23,22,23,55,54,51,50,23,23,22,21,17,35,17,39,
+38,35,34,7,1,182,98,27,27,44,2,249,1,188,34,68,11,11,24,24,55,56,58,79,55,
+73,25,20,13,11,44,6,93,145,44,43,40,40,76,76,188,100,133,132,46,48,95,74,
+6,8,20,30,41,83,52,37,61,62,47,29,94,128,91,89,86,192,78,188,237,22,28,47,
+63,222,90,77,40,19,18,2,225,17,17,251,111,4,145,76,21,41,6,28,60,60,1,49,
+68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,88,81,81,4,38,107,43,43,123,122,
+88,72,5,32,45,88,38,39,30,44,64,87,67,151,59,95,251,152,4,104,191,17,45,0,
+3,0,100,0,0,7,145,5,220,0,47,0,54,0,87,0,0,19,53,52,55,55,54,51,50,23,23,
+22,51,50,55,55,54,51,50,23,23,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,
+39,38,35,34,7,6,21,20,23,7,38,19,34,7,6,21,20,23,23,35,39,38,39,38,53,52,
+55,54,51,53,52,55,54,51,51,50,23,22,21,17,35,17,52,39,38,35,35,34,7,6,21,
+205,100,102,203,49,53,163,83,43,46,47,40,77,156,54,53,116,202,145,188,63,
+64,145,57,57,66,120,91,77,85,125,73,68,62,63,70,70,167,175,180,70,20,15,15,
+50,188,188,66,65,22,22,38,37,100,125,125,200,50,200,125,125,188,78,78,106,
+50,106,78,78,4,103,75,52,61,61,124,112,56,29,29,56,112,80,140,100,180,252,
+24,3,232,81,41,45,100,41,100,81,85,50,46,47,47,36,50,63,76,39,253,101,10,
+11,25,31,50,234,95,94,50,49,57,55,50,50,250,100,100,100,100,100,100,253,18,
+2,238,58,49,49,49,49,58,0,0,2,0,100,0,0,7,145,5,220,0,11,0,70,0,0,1,17,20,
+23,22,51,51,50,55,54,53,17,19,20,7,6,35,35,34,39,38,53,17,39,38,53,52,55,
+55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,33,53,39,38,53,52,55,
+55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,1,207,78,78,106,50,106,78,
+78,188,125,125,200,50,200,125,125,87,88,56,168,108,54,47,33,6,5,36,82,41,
+6,7,38,57,68,43,192,2,62,87,88,81,120,121,93,83,72,1,141,108,188,254,117,
+57,31,71,117,147,2,116,254,184,58,49,49,49,49,58,1,72,254,184,100,100,100,
+100,100,100,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,
+254,184,221,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,26,136,
+86,0,2,0,250,0,0,10,64,5,220,0,6,0,103,0,0,1,50,55,54,53,52,39,1,20,7,6,35,
+34,39,38,39,6,7,6,35,35,34,39,38,53,17,52,51,50,23,22,23,22,21,20,7,6,35,
+17,20,23,22,51,51,50,55,54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,
+6,7,6,35,34,39,39,7,23,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,54,
+51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,1,182,20,15,15,50,5,194,125,125,
+200,200,125,17,14,14,17,125,200,50,200,125,125,124,64,66,65,22,22,38,37,100,
+78,78,106,50,106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,
+43,192,78,78,106,106,78,78,87,88,81,120,121,93,83,72,1,141,108,188,254,117,
+57,31,71,117,147,4,115,10,11,25,31,50,252,58,100,100,100,100,13,14,14,13,
+100,100,100,100,4,76,100,94,95,50,49,57,55,50,50,253,68,58,49,49,49,49,58,
+2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,58,
+49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,
+26,136,86,0,2,0,100,0,0,4,151,5,220,0,6,0,54,0,0,1,34,7,6,21,20,23,0,35,20,
+35,34,39,39,7,23,17,35,39,38,39,38,53,52,55,54,51,17,39,38,53,52,55,55,23,
+23,22,51,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,7,1,19,20,15,15,50,
+1,29,40,1,40,97,68,43,192,188,65,66,22,22,38,37,100,87,88,56,168,108,54,47,
+34,42,109,78,76,73,164,66,188,196,12,18,32,52,84,1,105,10,11,25,31,50,3,198,
+1,50,39,75,113,251,180,95,94,50,49,57,55,50,50,1,237,53,53,32,31,85,253,62,
+32,27,34,87,67,151,59,95,251,152,4,116,179,11,39,67,0,0,2,0,140,0,0,10,64,
+5,220,0,6,0,84,0,0,37,54,53,52,39,38,35,5,20,7,6,35,34,39,38,53,17,52,39,
+39,38,35,34,7,7,23,22,21,17,50,23,22,21,20,7,6,7,7,35,17,39,38,53,52,55,55,
+54,51,50,23,23,22,21,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,54,51,
+50,23,5,22,21,17,35,17,37,38,35,34,7,23,1,182,98,27,27,44,5,194,125,125,200,
+200,125,125,39,207,37,89,104,68,129,38,61,145,44,43,40,40,76,76,188,62,48,
+100,137,161,102,158,80,214,108,78,78,106,106,78,78,87,88,81,120,121,93,83,
+72,1,141,108,188,254,117,57,31,71,117,147,222,90,77,40,19,18,166,100,100,
+100,100,100,100,2,238,76,28,142,26,51,98,25,38,60,254,62,59,60,66,78,87,88,
+81,81,3,240,38,29,65,65,74,102,119,53,150,72,175,253,18,58,49,49,49,49,58,
+2,181,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,26,136,86,0,0,
+2,0,100,0,0,4,126,6,164,0,6,0,64,0,0,1,34,7,6,21,20,23,23,35,39,38,39,38,
+53,52,55,54,51,17,39,38,53,52,19,22,51,51,54,53,52,39,38,53,52,55,54,51,50,
+23,22,23,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,7,6,7,6,35,34,39,7,23,
+1,19,20,15,15,50,188,188,65,66,22,22,38,37,100,87,88,154,135,31,3,27,96,83,
+2,15,68,67,83,73,8,65,53,89,86,192,78,188,237,22,28,47,63,5,10,12,51,44,45,
+114,24,203,1,105,10,11,25,31,50,234,95,94,50,49,57,55,50,50,1,237,53,53,32,
+31,1,82,132,8,64,62,40,35,48,8,8,59,60,53,116,29,67,151,59,95,251,152,4,104,
+191,17,45,4,17,13,51,69,60,115,0,0,2,0,250,0,0,10,64,5,220,0,6,0,102,0,0,
+37,54,53,52,39,38,35,5,20,7,6,35,34,39,38,53,17,52,39,38,35,35,34,7,6,21,
+21,50,23,22,21,20,7,6,7,7,35,17,52,55,54,55,39,38,53,52,55,55,23,22,51,50,
+55,55,20,7,6,7,6,35,34,39,39,7,23,22,23,22,23,22,21,17,20,23,22,51,50,55,
+54,53,17,39,38,53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,
+1,182,50,15,15,20,5,194,125,125,200,200,125,125,78,78,106,50,106,78,78,100,
+37,38,22,22,65,66,188,125,52,65,72,120,76,229,221,58,43,12,11,50,33,34,55,
+19,21,41,50,155,69,204,54,11,171,112,125,78,78,106,106,78,78,87,88,81,120,
+121,93,83,72,1,141,108,188,254,117,57,31,71,117,147,234,50,31,25,11,10,61,
+100,100,100,100,100,100,1,194,58,49,49,49,49,58,250,50,50,55,57,49,50,94,
+95,2,238,100,100,42,24,33,55,27,31,85,253,100,27,2,10,35,61,61,17,6,23,71,
+89,95,25,41,10,89,100,100,254,62,58,49,49,49,49,58,2,181,53,53,32,31,85,126,
+127,33,182,50,121,251,166,4,90,182,26,136,86,0,0,1,0,100,0,0,10,39,5,220,
+0,81,0,0,1,22,21,17,35,17,37,38,35,34,7,23,17,20,7,6,35,34,39,38,53,17,39,
+38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,23,22,
+51,50,55,54,53,17,39,38,53,52,55,55,54,51,50,23,5,55,54,51,50,23,23,22,21,
+17,35,17,39,38,35,34,7,7,80,15,188,254,117,57,31,71,117,147,125,125,200,200,
+125,125,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,78,
+106,106,78,78,87,88,81,120,121,93,83,72,1,123,174,128,91,89,86,192,78,188,
+237,22,28,47,63,4,169,34,45,251,166,4,90,182,26,136,86,252,224,100,100,100,
+100,100,100,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,
+252,224,58,49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,174,120,87,67,151,
+59,95,251,152,4,104,191,17,45,0,0,4,0,250,253,118,10,64,5,220,0,5,0,12,0,
+77,0,117,0,0,1,34,21,50,53,52,3,6,21,20,51,53,34,37,52,55,54,51,51,50,23,
+22,21,21,20,35,34,53,52,54,51,52,39,38,35,35,34,7,6,21,21,20,23,22,51,51,
+52,54,51,50,22,21,20,7,6,35,21,20,6,35,34,38,53,53,51,21,20,22,51,50,54,53,
+53,35,34,39,38,53,1,35,37,5,35,17,34,53,52,55,54,51,50,21,17,37,5,17,39,38,
+53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,4,18,34,62,83,13,
+38,13,253,19,125,125,200,50,200,125,125,188,138,74,64,78,78,106,50,106,78,
+78,79,79,130,94,105,117,69,89,45,44,103,157,151,137,171,178,70,60,44,76,94,
+218,129,129,6,126,188,254,250,254,250,188,112,56,56,64,124,1,6,1,6,87,88,
+81,120,121,93,83,72,1,141,108,188,254,117,57,31,71,117,147,2,198,39,20,19,
+1,128,7,12,30,55,100,100,100,100,100,100,100,155,100,130,62,63,58,49,49,49,
+49,58,255,127,73,74,50,110,65,74,86,32,33,239,151,151,127,123,200,200,42,
+64,77,80,240,114,113,177,249,197,215,215,1,94,90,50,55,55,100,254,198,216,
+216,5,177,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,26,136,86,
+0,0,3,0,100,0,0,7,145,5,220,0,6,0,13,0,86,0,0,1,34,7,6,21,20,23,37,34,7,6,
+21,20,23,5,35,39,38,39,38,53,52,55,54,51,53,33,17,35,39,38,39,38,53,52,55,
+54,51,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,
+17,33,53,39,38,53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,
+4,13,20,15,15,50,253,6,20,15,15,50,3,182,188,65,66,22,22,38,37,100,253,194,
+188,65,66,22,22,38,37,100,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,
+68,43,192,2,62,87,88,81,120,121,93,83,72,1,141,108,188,254,117,57,31,71,117,
+147,1,105,10,11,25,31,50,127,10,11,25,31,50,234,95,94,50,49,57,55,50,50,158,
+253,110,95,94,50,49,57,55,50,50,1,237,53,53,32,31,85,253,62,32,27,1,5,35,
+128,6,1,34,39,75,113,254,214,191,53,53,32,31,85,126,127,33,182,50,121,251,
+166,4,90,182,26,136,86,0,1,252,224,253,118,4,151,5,220,0,62,0,0,1,20,6,35,
+34,39,38,39,6,7,6,35,34,39,38,53,53,34,38,53,52,55,51,17,20,22,51,50,54,53,
+17,51,17,20,23,22,51,50,54,53,17,39,38,53,52,55,55,54,51,50,23,5,22,21,17,
+35,17,37,38,35,34,7,23,1,207,176,162,120,70,69,18,17,54,54,98,150,75,75,78,
+47,125,188,67,45,65,66,188,31,50,100,75,75,87,88,81,120,121,93,83,72,1,141,
+108,188,254,117,57,31,71,117,147,254,102,140,100,14,14,27,27,14,14,50,50,
+100,100,50,55,45,100,254,201,49,50,50,50,1,54,254,202,50,25,25,50,50,5,123,
+53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,26,136,86,0,0,1,251,
+253,253,118,4,151,5,220,0,79,0,0,1,20,6,35,34,39,38,39,6,7,6,35,34,39,38,
+53,53,52,38,35,34,6,21,21,51,50,21,20,7,7,35,17,52,55,54,51,50,23,22,21,21,
+20,22,51,50,54,53,17,51,17,20,23,22,51,50,54,53,17,39,38,53,52,55,55,54,51,
+50,23,5,22,21,17,35,17,37,38,35,34,7,23,1,207,176,142,80,70,69,18,17,54,54,
+98,150,75,75,37,75,75,37,25,75,50,50,188,75,75,150,150,75,75,67,45,65,66,
+188,31,50,60,55,75,87,88,81,120,121,93,83,72,1,141,108,188,254,117,57,31,
+71,117,147,254,102,140,100,14,14,27,27,14,14,50,50,150,80,50,30,30,50,80,
+50,48,77,75,1,75,119,50,50,50,50,120,91,49,50,50,50,1,54,254,202,50,25,25,
+50,50,5,123,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,26,136,
+86,0,0,2,251,125,253,118,4,151,5,220,0,6,0,84,0,0,1,21,50,53,52,39,38,37,
+20,33,34,39,38,35,35,21,35,38,53,52,55,54,55,35,52,39,38,35,34,7,38,35,34,
+7,6,21,21,50,23,22,21,20,35,35,17,52,54,51,50,23,54,51,50,22,21,51,50,23,
+22,51,50,53,17,39,38,53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,
+7,23,252,67,41,11,10,5,120,254,204,200,75,75,50,50,190,100,25,24,45,1,53,
+12,15,54,98,99,54,15,12,53,63,31,31,125,198,215,53,44,119,119,44,52,214,50,
+100,85,85,130,120,87,88,81,120,121,93,83,72,1,141,108,188,254,117,57,31,71,
+117,147,254,37,75,50,12,7,6,76,251,100,100,200,170,50,50,25,24,1,64,43,9,
+117,117,9,43,64,45,31,32,62,150,1,64,122,158,114,114,158,122,100,100,131,
+5,112,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,26,136,86,0,1,
+254,74,253,118,4,151,5,220,0,37,0,0,1,35,37,5,35,17,51,50,22,21,20,7,21,37,
+5,17,39,38,53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,1,207,
+188,254,249,254,250,188,174,54,72,112,1,6,1,7,87,88,81,120,121,93,83,72,1,
+141,108,188,254,117,57,31,71,117,147,253,118,215,215,2,38,40,50,100,60,114,
+216,216,5,177,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,26,136,
+86,0,0,1,254,74,253,118,4,151,5,220,0,39,0,0,1,20,33,32,53,17,51,23,22,21,
+20,35,21,20,33,32,53,17,39,38,53,52,55,55,54,51,50,23,5,22,21,17,35,17,37,
+38,35,34,7,23,1,207,254,62,254,61,188,56,56,112,1,7,1,6,87,88,81,120,121,
+93,83,72,1,141,108,188,254,117,57,31,71,117,147,254,112,250,250,1,44,54,55,
+50,90,51,116,116,5,113,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,
+182,26,136,86,0,0,1,253,218,253,118,4,151,5,220,0,47,0,0,37,51,21,35,17,20,
+33,32,53,53,34,53,52,55,55,51,17,20,33,32,53,17,35,53,51,17,39,38,53,52,55,
+55,54,51,50,23,5,22,21,17,35,17,37,38,35,34,7,23,1,207,150,150,254,62,254,
+61,112,56,56,188,1,7,1,6,162,162,87,88,81,120,121,93,83,72,1,141,108,188,
+254,117,57,31,71,117,147,144,144,254,112,250,250,50,90,50,55,55,254,212,116,
+116,1,144,144,3,81,53,53,32,31,85,126,127,33,182,50,121,251,166,4,90,182,
+26,136,86,0,2,0,150,0,0,10,64,5,220,0,6,0,101,0,0,37,54,53,52,39,38,35,1,
+22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,39,39,38,35,34,7,7,6,35,38,39,
+39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,35,17,38,53,52,55,54,
+51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,54,55,54,51,50,23,22,23,55,
+54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,7,1,182,98,27,27,44,5,189,5,188,
+156,106,96,166,188,34,68,11,11,24,24,55,56,58,79,55,73,25,20,13,11,44,6,93,
+145,44,43,40,40,76,76,188,100,133,132,46,48,95,74,6,8,20,30,41,83,52,37,61,
+62,39,27,11,12,125,170,200,125,30,22,121,128,91,89,86,192,78,188,237,22,28,
+47,63,65,222,90,77,40,19,18,2,222,25,25,251,130,4,126,78,128,128,78,251,130,
+4,145,76,21,41,6,28,60,60,1,49,68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,
+88,81,81,4,38,107,43,43,123,122,88,72,5,32,45,88,38,39,25,35,11,11,115,115,
+27,28,83,87,67,151,59,95,251,152,4,104,191,17,45,45,0,0,2,0,180,0,0,7,170,
+7,108,0,23,0,83,0,0,33,17,52,39,38,35,35,34,7,6,21,17,35,17,52,55,54,51,51,
+50,23,22,21,17,1,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,
+7,6,21,20,23,7,38,53,53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,
+23,22,23,17,52,35,52,51,50,21,17,20,3,244,78,78,106,50,106,78,78,188,125,
+125,200,50,200,125,125,2,179,21,188,63,64,145,57,57,66,120,91,77,85,125,73,
+68,62,63,70,70,167,175,180,100,102,203,49,53,163,83,43,46,47,40,77,156,54,
+53,116,202,4,3,100,125,163,2,238,58,49,49,49,49,58,253,18,2,238,100,100,100,
+100,100,100,253,18,4,102,57,69,252,24,3,232,81,41,45,100,41,100,81,85,50,
+46,47,47,36,50,63,76,39,99,75,52,61,61,124,112,56,29,29,56,112,80,140,2,3,
+1,169,100,100,200,254,112,66,0,0,2,0,250,0,0,7,170,7,108,0,6,0,93,0,0,1,21,
+50,53,52,39,38,37,22,21,17,35,17,39,38,35,34,15,2,21,20,5,5,21,20,23,22,51,
+51,50,55,54,53,17,55,17,20,7,6,35,35,34,39,38,53,53,37,36,53,53,52,39,38,
+35,35,34,7,6,21,21,50,23,22,21,20,35,34,53,53,52,55,54,51,51,50,23,22,23,
+55,54,51,50,23,23,17,52,35,52,51,50,21,17,20,1,182,48,13,12,5,169,2,188,237,
+22,28,47,63,65,62,254,131,254,131,78,78,106,50,106,78,78,188,125,125,200,
+50,200,125,125,1,220,1,30,78,78,106,50,106,78,78,74,37,37,148,188,125,125,
+200,50,200,125,38,27,108,128,91,89,86,132,100,125,163,4,1,75,50,12,7,6,132,
+14,15,251,152,4,104,191,17,45,45,43,153,172,197,196,185,58,49,49,49,49,58,
+1,44,100,254,112,100,100,100,100,100,100,250,245,148,107,150,58,49,49,49,
+49,58,75,31,32,62,150,100,250,100,100,100,100,31,30,74,87,67,104,1,115,100,
+100,200,254,112,56,0,2,0,180,0,0,7,170,7,108,0,39,0,99,0,0,37,7,35,17,52,
+55,54,51,51,50,23,22,21,17,35,17,52,39,38,35,35,34,7,6,21,17,55,54,51,50,
+21,20,35,34,53,52,35,34,7,7,1,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,
+39,38,35,34,7,6,21,20,23,7,38,53,53,52,55,55,54,51,50,23,23,22,51,50,55,55,
+54,51,50,23,23,22,23,17,52,35,52,51,50,21,17,20,1,182,20,168,125,125,200,
+50,200,125,125,188,78,78,106,50,106,78,78,45,79,100,138,77,57,24,24,50,49,
+5,92,21,188,63,64,145,57,57,66,120,91,77,85,125,73,68,62,63,70,70,167,175,
+180,100,102,203,49,53,163,83,43,46,47,40,77,156,54,53,116,202,4,3,100,125,
+163,67,67,2,238,100,100,100,100,100,100,253,18,2,238,58,49,49,49,49,58,254,
+62,72,128,120,80,33,33,83,82,3,157,57,69,252,24,3,232,81,41,45,100,41,100,
+81,85,50,46,47,47,36,50,63,76,39,99,75,52,61,61,124,112,56,29,29,56,112,80,
+140,2,3,1,169,100,100,200,254,112,66,0,0,2,0,100,0,0,10,89,7,108,0,6,0,111,
+0,0,1,6,21,20,23,22,51,37,22,21,17,35,17,37,38,35,34,7,23,17,20,7,6,35,34,
+39,38,39,6,7,6,35,34,39,38,53,17,34,39,38,53,52,55,54,55,54,51,50,21,17,20,
+23,22,51,50,55,54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,
+34,39,39,7,23,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,54,51,50,23,
+5,17,52,35,52,51,50,21,17,20,1,19,50,15,15,20,9,17,3,188,254,117,57,31,71,
+117,147,125,125,200,200,125,17,14,14,17,125,200,200,125,125,100,37,38,22,
+22,66,65,64,124,78,78,106,106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,
+6,7,38,57,68,43,192,78,78,106,106,78,78,87,88,81,120,121,93,83,72,1,111,100,
+125,163,4,242,50,31,25,11,10,16,20,21,251,166,4,90,182,26,136,86,252,224,
+100,100,100,100,13,14,14,13,100,100,100,100,2,188,50,50,55,57,49,50,95,94,
+100,251,180,58,49,49,49,49,58,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,
+6,1,34,39,75,113,252,224,58,49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,
+168,1,145,100,100,200,254,112,57,0,3,0,100,0,0,7,170,7,108,0,6,0,14,0,97,
+0,0,19,53,6,21,20,23,22,1,52,35,34,21,20,23,54,5,22,21,17,35,17,39,38,35,
+34,7,7,22,21,17,35,37,5,35,17,34,38,53,52,54,54,51,50,21,17,37,5,17,52,39,
+38,39,6,35,34,39,38,53,52,54,53,52,35,52,51,50,21,20,6,21,20,22,51,50,55,
+38,53,52,51,50,21,20,7,55,54,51,50,23,23,17,52,35,52,51,50,21,17,20,250,40,
+10,10,2,188,50,50,58,42,3,212,2,188,237,22,28,47,63,246,119,188,254,225,254,
+225,188,80,70,39,111,94,94,1,31,1,31,44,44,36,142,166,158,83,89,50,100,100,
+188,50,82,60,114,73,77,190,190,3,181,128,91,89,86,132,100,125,163,2,127,97,
+20,31,25,10,11,2,169,46,46,34,38,25,116,14,15,251,152,4,104,191,17,45,169,
+84,139,252,125,236,236,1,244,100,55,57,89,99,100,253,154,237,237,2,201,108,
+34,24,24,89,69,75,116,65,135,70,70,100,170,85,115,70,69,47,29,71,76,180,180,
+16,15,124,87,67,104,1,115,100,100,200,254,112,56,0,0,2,0,150,0,0,7,170,7,
+108,0,6,0,100,0,0,1,53,6,21,20,23,22,1,22,21,17,35,17,52,47,2,38,35,34,7,
+6,35,34,39,39,38,35,34,7,7,6,21,20,31,2,17,20,23,22,51,51,50,55,54,53,17,
+34,38,53,52,54,54,51,50,21,17,20,7,6,35,35,34,39,38,53,17,38,38,53,52,54,
+55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,17,52,35,52,51,50,
+21,17,20,3,244,40,10,10,3,131,21,188,63,64,145,57,57,66,120,91,77,85,125,
+73,68,62,63,96,48,29,12,30,61,78,78,106,50,106,78,78,80,70,39,111,94,94,125,
+125,200,50,200,125,125,70,30,30,101,102,202,49,53,163,83,43,46,47,40,77,156,
+54,53,116,202,4,3,100,125,163,2,227,97,20,31,25,10,11,1,131,57,69,252,24,
+3,232,81,41,45,100,41,100,81,85,50,46,54,27,16,19,12,13,33,66,253,0,58,49,
+49,49,49,58,1,44,100,55,57,89,99,100,253,168,100,100,100,100,100,100,2,198,
+66,51,38,37,52,62,61,123,112,56,29,29,56,112,80,140,2,3,1,169,100,100,200,
+254,112,66,0,3,0,100,0,0,7,170,7,108,0,6,0,12,0,108,0,0,1,53,6,21,20,23,22,
+1,34,6,21,20,23,1,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,
+7,7,6,21,20,31,2,17,32,21,20,51,50,53,17,34,38,53,52,54,54,51,50,21,17,20,
+33,32,53,52,35,17,35,39,38,53,52,54,51,17,38,38,53,52,54,55,55,54,51,50,23,
+23,22,51,50,55,55,54,51,50,23,23,22,23,17,52,35,52,51,50,21,17,20,3,244,40,
+10,10,253,26,20,20,40,6,105,21,188,63,64,145,57,57,66,120,91,77,85,125,73,
+68,62,63,96,48,29,12,30,61,1,50,156,112,80,70,39,111,94,94,254,212,254,212,
+162,188,75,75,80,70,70,30,30,101,102,202,49,53,163,83,43,46,47,40,77,156,
+54,53,116,202,4,3,100,125,163,2,227,97,20,31,25,10,11,254,139,21,30,31,50,
+3,124,57,69,252,24,3,232,81,41,45,100,41,100,81,85,50,46,54,27,16,19,12,13,
+33,66,253,200,250,106,106,1,94,100,55,57,89,99,100,253,118,250,250,116,254,
+146,124,124,97,65,90,1,254,66,51,38,37,52,62,61,123,112,56,29,29,56,112,80,
+140,2,3,1,169,100,100,200,254,112,66,0,1,0,150,0,0,7,170,7,108,0,84,0,0,1,
+22,21,17,35,17,39,38,35,34,7,7,6,35,34,39,39,38,35,34,7,6,7,7,6,21,20,31,
+2,17,37,5,17,51,17,35,37,5,35,17,38,38,53,52,54,55,55,54,51,50,23,22,51,50,
+55,54,53,52,35,34,53,52,51,50,23,22,21,21,55,55,54,51,50,23,23,17,52,35,52,
+51,50,21,17,20,7,118,2,188,237,20,33,62,107,148,88,139,191,137,64,35,27,6,
+5,31,32,23,10,18,30,61,1,31,1,31,188,188,254,225,254,225,188,70,30,30,65,
+66,131,29,29,152,156,82,92,42,42,146,100,100,130,75,75,14,41,121,91,89,86,
+132,100,125,163,4,133,14,15,251,152,4,104,191,15,54,76,78,98,45,27,1,7,37,
+25,11,12,17,19,33,66,252,142,237,237,3,46,252,24,236,236,3,242,66,51,38,37,
+52,61,61,124,112,108,35,35,70,102,89,89,81,81,118,7,7,20,60,67,104,1,115,
+100,100,200,254,112,56,0,2,0,140,0,0,13,58,7,108,0,6,0,135,0,0,37,54,53,52,
+39,38,35,1,22,21,17,35,17,37,38,35,34,7,23,17,20,7,6,35,34,39,38,39,6,7,6,
+35,34,39,38,53,17,52,39,39,38,35,34,7,7,23,22,21,17,50,23,22,21,20,7,6,7,
+7,35,17,39,38,53,52,55,55,54,51,50,23,23,22,21,17,20,23,22,51,50,55,54,53,
+17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,
+23,22,51,50,55,54,53,17,39,38,53,52,55,55,54,51,50,23,5,17,52,35,52,51,50,
+21,17,20,1,182,98,27,27,44,11,79,3,188,254,117,57,31,71,117,147,125,125,200,
+200,125,17,14,14,17,125,200,200,125,125,39,207,37,89,104,68,129,38,61,145,
+44,43,40,40,76,76,188,62,48,100,137,161,102,158,80,214,108,78,78,106,106,
+78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,78,106,
+106,78,78,87,88,81,120,121,93,83,72,1,111,100,125,163,222,90,77,40,19,18,
+2,177,20,21,251,166,4,90,182,26,136,86,252,224,100,100,100,100,13,14,14,13,
+100,100,100,100,2,238,76,28,142,26,51,98,25,38,60,254,62,59,60,66,78,87,88,
+81,81,3,240,38,29,65,65,74,102,119,53,150,72,175,253,18,58,49,49,49,49,58,
+2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,252,224,58,
+49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,168,1,145,100,100,200,254,
+112,57,0,0,3,0,150,253,168,10,114,7,108,0,44,0,51,0,156,0,0,5,52,55,54,51,
+50,23,22,21,20,6,35,34,39,38,39,38,39,38,35,34,7,6,7,52,55,54,54,51,50,4,
+23,22,22,51,50,54,53,52,39,6,35,34,38,38,1,54,53,52,39,38,35,1,22,21,17,35,
+17,39,38,35,34,15,2,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,39,39,38,
+35,34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,
+35,17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,54,55,
+54,51,50,23,22,23,55,54,51,50,23,23,17,52,35,52,51,50,21,17,20,6,79,30,31,
+63,86,43,44,214,173,135,113,111,120,119,124,123,87,91,89,89,74,36,38,168,
+141,159,1,0,133,132,150,82,70,109,2,15,16,19,37,20,251,103,98,27,27,44,8,
+136,2,188,237,22,28,47,63,65,67,5,188,156,106,96,166,188,34,68,11,11,24,24,
+55,56,58,79,55,73,25,20,13,11,44,6,93,145,44,43,40,40,76,76,188,100,133,132,
+46,48,95,74,6,8,20,30,41,83,52,37,61,62,39,27,11,12,125,170,200,125,30,22,
+121,128,91,89,86,132,100,125,163,200,50,25,25,50,50,100,150,150,38,37,88,
+87,50,50,22,23,45,60,43,42,95,94,97,97,78,66,100,15,12,8,22,38,1,187,90,77,
+40,19,18,2,179,14,15,251,152,4,104,191,17,45,45,46,25,25,251,130,4,126,78,
+128,128,78,251,130,4,145,76,21,41,6,28,60,60,1,49,68,24,9,38,6,9,34,77,253,
+234,59,60,66,78,87,88,81,81,4,38,107,43,43,123,122,88,72,5,32,45,88,38,39,
+25,35,11,11,115,115,27,28,83,87,67,104,1,115,100,100,200,254,112,56,0,0,3,
+0,250,0,0,7,170,7,108,0,12,0,24,0,86,0,0,1,51,50,53,52,39,38,35,34,7,6,21,
+20,19,17,37,5,17,51,17,35,37,5,35,17,37,22,21,17,35,17,39,38,35,34,7,7,6,
+7,6,35,34,39,39,38,38,53,52,55,54,51,50,23,22,21,20,7,22,23,22,51,50,54,53,
+52,35,34,53,52,51,32,19,55,54,51,50,23,23,17,52,35,52,51,50,21,17,20,1,181,
+24,53,12,14,27,26,14,13,30,1,31,1,31,188,188,254,225,254,225,188,6,124,2,
+188,237,20,33,62,107,141,18,22,117,232,54,47,96,96,192,52,53,90,91,51,52,
+54,29,32,42,47,143,134,112,100,100,1,26,17,56,121,91,89,86,132,100,125,163,
+4,240,50,24,12,14,13,12,25,29,254,177,253,4,237,237,3,46,252,24,236,236,3,
+252,137,14,15,251,152,4,104,191,15,54,72,20,19,99,2,5,5,119,109,83,54,53,
+43,43,75,75,43,3,2,2,86,76,146,98,80,254,225,27,60,67,104,1,115,100,100,200,
+254,112,56,0,0,2,0,100,0,0,7,170,7,108,0,6,0,96,0,0,1,6,21,20,23,22,51,37,
+22,21,17,35,17,39,38,35,34,7,7,6,7,6,35,34,39,7,23,17,20,7,6,35,35,34,39,
+38,53,17,34,39,38,53,52,55,54,55,54,51,50,21,17,20,23,22,51,51,50,55,54,53,
+17,39,38,53,52,19,22,51,51,54,53,52,39,38,53,52,55,54,51,50,23,22,23,54,51,
+50,23,23,17,52,35,52,51,50,21,17,20,1,19,50,15,15,20,6,99,2,188,237,22,28,
+47,63,5,10,12,51,44,45,114,24,203,125,125,200,50,200,125,125,100,37,38,22,
+22,66,65,64,124,78,78,106,50,106,78,78,87,88,154,135,31,3,27,96,83,2,15,68,
+67,83,73,8,65,53,89,86,132,100,125,163,4,242,50,31,25,11,10,18,14,15,251,
+152,4,104,191,17,45,4,17,13,51,69,60,115,252,224,100,100,100,100,100,100,
+2,188,50,50,55,57,49,50,95,94,100,251,180,58,49,49,49,49,58,2,181,53,53,32,
+31,1,82,132,8,64,62,40,35,48,8,8,59,60,53,116,29,67,104,1,115,100,100,200,
+254,112,56,0,0,2,0,250,255,156,7,170,7,108,0,6,0,107,0,0,1,21,50,53,52,39,
+38,37,22,21,17,35,17,39,38,35,34,7,7,21,20,5,5,21,20,23,22,51,50,55,54,55,
+54,51,53,55,17,20,35,34,53,54,53,53,34,7,6,7,6,35,34,39,38,53,17,37,36,53,
+53,52,39,38,35,34,7,38,35,34,7,6,21,21,50,23,22,21,20,35,34,53,53,52,55,54,
+51,50,23,54,51,50,23,22,23,55,54,51,50,23,23,17,52,35,52,51,50,21,17,20,1,
+182,48,13,12,5,169,2,188,237,22,28,47,63,127,254,131,254,131,24,24,41,59,
+51,151,73,74,77,188,154,104,70,48,47,47,127,127,89,129,74,74,1,220,1,30,75,
+18,21,68,104,105,69,21,18,75,74,37,37,148,188,116,116,63,52,129,128,53,62,
+115,40,26,98,128,91,89,86,132,100,125,163,4,1,75,50,12,7,6,132,14,15,251,
+152,4,104,191,17,45,88,153,172,197,196,235,53,26,27,42,126,44,44,183,90,253,
+145,150,72,32,56,206,31,32,101,102,58,59,133,1,44,245,148,107,150,64,52,13,
+130,130,13,52,64,75,31,32,62,150,100,250,122,89,89,134,134,89,31,34,67,87,
+67,104,1,115,100,100,200,254,112,56,0,0,3,0,150,0,0,10,114,7,108,0,6,0,12,
+0,123,0,0,37,54,53,52,39,38,35,5,34,6,21,20,23,1,22,21,17,35,17,37,38,35,
+34,7,23,17,20,33,32,53,52,35,17,35,39,38,53,52,54,51,17,52,39,39,38,35,34,
+7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,35,17,
+38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,21,17,32,21,20,
+51,50,53,17,39,38,53,52,55,55,54,51,50,23,5,17,52,35,52,51,50,21,17,20,1,
+182,98,27,27,44,2,62,20,20,40,6,73,3,188,254,117,57,31,71,117,147,254,212,
+254,252,152,188,75,75,80,70,34,68,11,11,24,24,55,56,58,79,55,73,25,20,13,
+11,44,6,93,145,44,43,40,40,76,76,188,100,133,132,46,48,95,74,6,8,20,30,41,
+83,52,37,61,62,122,1,40,116,112,87,88,81,120,121,93,83,72,1,111,100,125,163,
+222,90,77,40,19,18,100,21,30,31,50,3,153,20,21,251,166,4,90,182,26,136,86,
+252,174,250,250,116,254,146,124,124,97,65,90,2,157,76,21,41,6,28,60,60,1,
+49,68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,88,81,81,4,38,107,43,43,123,
+122,88,72,5,32,45,88,38,39,77,177,253,99,250,106,106,2,231,53,53,32,31,85,
+126,127,33,168,1,145,100,100,200,254,112,57,0,0,2,0,140,0,0,13,8,7,108,0,
+6,0,114,0,0,37,54,53,52,39,38,35,1,22,21,17,35,17,39,38,35,34,7,7,22,21,17,
+35,17,47,3,38,35,34,7,6,7,23,22,21,17,35,37,5,35,17,47,3,38,35,34,7,6,7,23,
+22,21,17,50,23,22,21,20,7,6,7,7,35,17,39,38,53,52,55,55,54,51,50,31,2,22,
+21,17,37,5,17,39,38,53,52,55,55,54,51,50,31,2,22,23,55,54,51,50,23,23,17,
+52,35,52,51,50,21,17,20,1,182,98,27,27,44,11,30,2,188,237,22,28,47,63,132,
+5,188,149,29,21,121,57,31,56,74,74,24,51,61,188,254,250,254,250,188,149,29,
+21,121,57,31,56,74,74,24,51,61,145,44,43,40,40,76,76,188,62,48,83,125,124,
+93,83,72,121,201,108,1,6,1,6,62,48,83,125,124,93,83,72,121,201,6,6,144,128,
+91,89,86,132,100,125,163,222,90,77,40,19,18,2,179,14,15,251,152,4,104,191,
+17,45,91,24,27,251,131,4,125,68,13,10,56,26,56,56,28,34,38,60,251,230,215,
+215,4,125,68,13,10,56,26,56,56,28,34,38,60,254,62,59,60,66,78,87,88,81,81,
+3,240,38,29,65,65,74,110,111,33,55,92,50,121,252,61,216,216,3,54,38,29,65,
+65,74,110,111,33,55,92,3,3,99,87,67,104,1,115,100,100,200,254,112,56,0,0,
+3,0,180,0,0,7,170,7,108,0,6,0,39,0,99,0,0,37,54,53,52,39,38,35,3,52,55,54,
+51,51,50,23,22,21,17,35,17,52,39,38,35,35,34,7,6,21,21,50,23,22,21,20,7,6,
+7,7,35,1,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,7,6,21,
+20,23,7,38,53,53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,
+23,17,52,35,52,51,50,21,17,20,1,182,50,15,15,20,188,125,125,200,50,200,125,
+125,188,78,78,106,50,106,78,78,100,37,38,22,22,65,66,188,6,105,21,188,63,
+64,145,57,57,66,120,91,77,85,125,73,68,62,63,70,70,167,175,180,100,102,203,
+49,53,163,83,43,46,47,40,77,156,54,53,116,202,4,3,100,125,163,234,50,31,25,
+11,10,1,133,100,100,100,100,100,100,253,18,2,238,58,49,49,49,49,58,250,50,
+50,55,57,49,50,94,95,4,102,57,69,252,24,3,232,81,41,45,100,41,100,81,85,50,
+46,47,47,36,50,63,76,39,99,75,52,61,61,124,112,56,29,29,56,112,80,140,2,3,
+1,169,100,100,200,254,112,66,0,0,2,0,150,0,0,7,170,7,108,0,6,0,111,0,0,1,
+53,6,21,20,23,22,1,22,21,17,35,17,39,38,35,34,15,2,6,35,34,39,39,38,35,34,
+7,6,7,7,6,21,20,31,2,17,20,23,22,51,51,50,55,54,53,17,34,38,53,52,54,54,51,
+50,21,17,20,7,6,35,35,34,39,38,53,17,38,38,53,52,54,55,55,54,51,50,23,22,
+51,50,55,54,53,52,35,34,53,52,51,50,23,22,21,21,55,54,51,50,23,23,17,52,35,
+52,51,50,21,17,20,3,244,40,10,10,3,150,2,188,237,20,33,62,107,149,1,86,139,
+191,137,64,35,27,6,5,31,32,23,10,18,30,61,78,78,106,50,106,78,78,80,70,39,
+111,94,94,125,125,200,50,200,125,125,70,30,30,65,66,131,29,29,152,156,82,
+92,42,42,146,100,100,130,75,75,55,121,91,89,86,132,100,125,163,2,227,97,20,
+31,25,10,11,1,162,14,15,251,152,4,104,191,15,54,77,1,76,98,45,27,1,7,37,25,
+11,12,17,19,33,66,253,0,58,49,49,49,49,58,1,44,100,55,57,89,99,100,253,168,
+100,100,100,100,100,100,2,198,66,51,38,37,52,61,61,124,112,108,35,35,70,102,
+89,89,81,81,118,7,27,60,67,104,1,115,100,100,200,254,112,56,0,3,0,250,0,0,
+7,170,7,108,0,5,0,12,0,104,0,0,1,34,21,50,53,52,3,6,21,20,51,53,34,37,22,
+21,17,35,17,39,38,35,34,7,7,21,20,35,34,53,52,54,51,52,39,38,35,35,34,7,6,
+21,21,20,23,22,51,51,52,54,51,50,22,21,20,7,6,35,21,20,6,35,34,38,53,53,51,
+21,20,22,51,50,54,53,53,35,34,39,38,53,53,52,55,54,51,51,50,23,22,23,55,54,
+51,50,23,23,17,52,35,52,51,50,21,17,20,4,18,34,62,83,13,38,13,3,143,2,188,
+237,22,28,47,63,127,188,138,74,64,78,78,106,50,106,78,78,79,79,130,94,105,
+117,69,89,45,44,103,157,151,137,171,178,70,60,44,76,94,218,129,129,125,125,
+200,50,200,125,38,27,108,128,91,89,86,132,100,125,163,2,198,39,20,19,1,128,
+7,12,30,55,57,14,15,251,152,4,104,191,17,45,88,158,100,130,62,63,58,49,49,
+49,49,58,255,127,73,74,50,110,65,74,86,32,33,239,151,151,127,123,200,200,
+42,64,77,80,240,114,113,177,255,100,100,100,100,31,30,74,87,67,104,1,115,
+100,100,200,254,112,56,0,0,2,0,150,0,0,7,170,7,108,0,6,0,88,0,0,1,53,6,21,
+20,23,22,1,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,7,7,6,
+21,20,31,2,17,37,5,17,34,38,53,52,54,54,51,50,21,17,35,37,5,35,17,38,38,53,
+52,54,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,17,52,35,52,
+51,50,21,17,20,3,244,40,10,10,3,131,21,188,63,64,145,57,57,66,120,91,77,85,
+125,73,68,62,63,96,48,29,12,30,61,1,31,1,31,80,70,39,111,94,94,188,254,225,
+254,225,188,70,30,30,101,102,202,49,53,163,83,43,46,47,40,77,156,54,53,116,
+202,4,3,100,125,163,2,227,97,20,31,25,10,11,1,131,57,69,252,24,3,232,81,41,
+45,100,41,100,81,85,50,46,54,27,16,19,12,13,33,66,252,142,237,237,1,158,100,
+55,57,89,99,100,252,124,236,236,3,242,66,51,38,37,52,62,61,123,112,56,29,
+29,56,112,80,140,2,3,1,169,100,100,200,254,112,66,0,2,0,250,0,0,7,170,7,108,
+0,6,0,100,0,0,1,6,21,20,51,53,34,19,55,54,51,50,23,23,17,52,35,52,51,50,21,
+17,20,7,22,21,17,35,17,39,38,35,34,7,7,21,20,35,34,53,52,55,54,51,53,52,39,
+38,35,35,34,7,6,21,21,20,5,5,17,20,7,6,35,34,39,38,39,38,39,38,35,17,35,17,
+23,21,50,23,22,23,22,23,22,51,50,55,54,53,17,37,36,53,53,52,55,54,51,51,50,
+23,22,3,209,13,48,23,151,108,128,91,89,86,132,100,125,163,52,2,188,237,22,
+28,47,63,127,188,148,37,37,74,78,78,106,50,106,78,78,1,27,1,223,74,74,149,
+89,72,73,55,34,47,47,48,188,188,77,74,73,54,54,37,37,59,61,24,24,254,145,
+254,117,125,125,200,50,200,125,39,4,35,7,12,50,75,1,17,75,87,67,104,1,115,
+100,100,200,254,112,56,87,14,15,251,152,4,104,191,17,45,88,213,100,150,62,
+32,31,35,58,49,49,49,49,58,150,136,99,167,254,114,133,59,58,39,39,78,47,32,
+31,254,246,2,161,90,183,44,44,74,75,9,10,27,26,53,1,55,128,138,223,150,100,
+100,100,100,31,0,0,1,0,150,255,106,7,170,7,108,0,85,0,0,1,22,21,17,35,17,
+52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,7,7,6,21,20,31,2,17,20,23,22,51,
+51,50,55,54,53,17,51,17,35,53,6,35,35,34,39,38,53,17,38,38,53,52,54,55,55,
+54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,17,52,35,52,51,50,21,17,
+20,7,99,21,188,63,64,145,57,57,66,120,91,77,85,125,73,68,62,63,96,48,29,12,
+30,61,78,78,106,50,106,78,78,188,188,109,153,50,200,125,125,70,30,30,101,
+102,202,49,53,163,83,43,46,47,40,77,156,54,53,116,202,4,3,100,125,163,4,102,
+57,69,252,24,3,232,81,41,45,100,41,100,81,85,50,46,54,27,16,19,12,13,33,66,
+253,0,58,49,49,49,49,58,2,188,251,130,208,58,100,100,100,2,198,66,51,38,37,
+52,62,61,123,112,56,29,29,56,112,80,140,2,3,1,169,100,100,200,254,112,66,
+0,2,0,150,0,0,7,170,7,108,0,6,0,99,0,0,1,53,6,21,20,23,22,1,22,21,17,35,17,
+39,38,35,34,15,2,6,35,34,39,39,38,35,34,7,6,7,7,6,21,20,31,2,17,37,5,17,34,
+38,53,52,54,54,51,50,21,17,35,37,5,35,17,38,38,53,52,54,55,55,54,51,50,23,
+22,51,50,55,54,53,52,35,34,53,52,51,50,23,22,21,21,55,54,51,50,23,23,17,52,
+35,52,51,50,21,17,20,3,244,40,10,10,3,150,2,188,237,20,33,62,107,149,1,86,
+139,191,137,64,35,27,6,5,31,32,23,10,18,30,61,1,31,1,31,80,70,39,111,94,94,
+188,254,225,254,225,188,70,30,30,65,66,131,29,29,152,156,82,92,42,42,146,
+100,100,130,75,75,55,121,91,89,86,132,100,125,163,2,227,97,20,31,25,10,11,
+1,162,14,15,251,152,4,104,191,15,54,77,1,76,98,45,27,1,7,37,25,11,12,17,19,
+33,66,252,142,237,237,1,158,100,55,57,89,99,100,252,124,236,236,3,242,66,
+51,38,37,52,61,61,124,112,108,35,35,70,102,89,89,81,81,118,7,27,60,67,104,
+1,115,100,100,200,254,112,56,0,2,0,150,0,0,7,170,7,108,0,6,0,93,0,0,37,54,
+53,52,39,38,35,1,22,21,17,35,17,39,38,35,34,7,7,22,21,17,35,17,52,39,39,38,
+35,34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,20,7,6,7,7,
+35,17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,22,23,55,54,
+51,50,23,23,17,52,35,52,51,50,21,17,20,1,182,98,27,27,44,5,192,2,188,237,
+22,28,47,63,128,1,188,34,68,11,11,24,24,55,56,58,79,55,73,25,20,13,11,44,
+6,93,145,44,43,40,40,76,76,188,100,133,132,46,48,95,74,6,8,20,30,41,83,52,
+37,61,62,47,29,94,128,91,89,86,132,100,125,163,222,90,77,40,19,18,2,179,14,
+15,251,152,4,104,191,17,45,88,17,17,251,111,4,145,76,21,41,6,28,60,60,1,49,
+68,24,9,38,6,9,34,77,253,234,59,60,66,78,87,88,81,81,4,38,107,43,43,123,122,
+88,72,5,32,45,88,38,39,30,44,64,87,67,104,1,115,100,100,200,254,112,56,0,
+0,3,0,100,0,0,7,195,7,108,0,6,0,39,0,99,0,0,1,34,7,6,21,20,23,23,35,39,38,
+39,38,53,52,55,54,51,53,52,55,54,51,51,50,23,22,21,17,35,17,52,39,38,35,35,
+34,7,6,21,1,22,21,17,35,17,52,47,2,38,35,34,7,6,35,34,39,39,38,35,34,7,6,
+21,20,23,7,38,53,53,52,55,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,
+22,23,17,52,35,52,51,50,21,17,20,1,19,20,15,15,50,188,188,66,65,22,22,38,
+37,100,125,125,200,50,200,125,125,188,78,78,106,50,106,78,78,5,173,21,188,
+63,64,145,57,57,66,120,91,77,85,125,73,68,62,63,70,70,167,175,180,100,102,
+203,49,53,163,83,43,46,47,40,77,156,54,53,116,202,4,3,100,125,163,1,105,10,
+11,25,31,50,234,95,94,50,49,57,55,50,50,250,100,100,100,100,100,100,253,18,
+2,238,58,49,49,49,49,58,1,120,57,69,252,24,3,232,81,41,45,100,41,100,81,85,
+50,46,47,47,36,50,63,76,39,99,75,52,61,61,124,112,56,29,29,56,112,80,140,
+2,3,1,169,100,100,200,254,112,66,0,0,2,0,100,0,0,7,195,7,108,0,11,0,80,0,
+0,1,17,20,23,22,51,51,50,55,54,53,17,1,22,21,17,35,17,37,38,35,34,7,23,17,
+20,7,6,35,35,34,39,38,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,
+6,35,34,39,39,7,23,17,33,53,39,38,53,52,55,55,54,51,50,23,5,17,52,35,52,51,
+50,21,17,20,1,207,78,78,106,50,106,78,78,3,129,3,188,254,117,57,31,71,117,
+147,125,125,200,50,200,125,125,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,
+38,57,68,43,192,2,62,87,88,81,120,121,93,83,72,1,111,100,125,163,2,116,254,
+184,58,49,49,49,49,58,1,72,2,15,20,21,251,166,4,90,182,26,136,86,252,224,
+100,100,100,100,100,100,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,
+34,39,75,113,254,184,221,53,53,32,31,85,126,127,33,168,1,145,100,100,200,
+254,112,57,0,2,0,250,0,0,10,114,7,108,0,6,0,113,0,0,1,50,55,54,53,52,39,5,
+22,21,17,35,17,37,38,35,34,7,23,17,20,7,6,35,34,39,38,39,6,7,6,35,35,34,39,
+38,53,17,52,51,50,23,22,23,22,21,20,7,6,35,17,20,23,22,51,51,50,55,54,53,
+17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,
+23,22,51,50,55,54,53,17,39,38,53,52,55,55,54,51,50,23,5,17,52,35,52,51,50,
+21,17,20,1,182,20,15,15,50,8,135,3,188,254,117,57,31,71,117,147,125,125,200,
+200,125,17,14,14,17,125,200,50,200,125,125,124,64,66,65,22,22,38,37,100,78,
+78,106,50,106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,
+192,78,78,106,106,78,78,87,88,81,120,121,93,83,72,1,111,100,125,163,4,115,
+10,11,25,31,50,111,20,21,251,166,4,90,182,26,136,86,252,224,100,100,100,100,
+13,14,14,13,100,100,100,100,4,76,100,94,95,50,49,57,55,50,50,253,68,58,49,
+49,49,49,58,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,
+252,224,58,49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,168,1,145,100,100,
+200,254,112,57,0,2,0,100,0,0,4,201,7,108,0,6,0,64,0,0,1,34,7,6,21,20,23,1,
+22,21,17,35,17,39,38,35,34,7,7,6,35,20,35,34,39,39,7,23,17,35,39,38,39,38,
+53,52,55,54,51,17,39,38,53,52,55,55,23,23,22,51,55,54,51,50,23,23,17,52,35,
+52,51,50,21,17,20,1,19,20,15,15,50,3,130,2,188,196,12,18,32,52,84,33,40,1,
+40,97,68,43,192,188,65,66,22,22,38,37,100,87,88,56,168,108,54,47,34,42,109,
+78,76,73,92,100,125,163,1,105,10,11,25,31,50,3,156,15,15,251,152,4,116,179,
+11,39,67,24,1,50,39,75,113,251,180,95,94,50,49,57,55,50,50,1,237,53,53,32,
+31,85,253,62,32,27,34,87,67,85,1,96,100,100,200,254,112,56,0,2,0,140,0,0,
+10,114,7,108,0,6,0,94,0,0,37,54,53,52,39,38,35,1,22,21,17,35,17,37,38,35,
+34,7,23,17,20,7,6,35,34,39,38,53,17,52,39,39,38,35,34,7,7,23,22,21,17,50,
+23,22,21,20,7,6,7,7,35,17,39,38,53,52,55,55,54,51,50,23,23,22,21,17,20,23,
+22,51,50,55,54,53,17,39,38,53,52,55,55,54,51,50,23,5,17,52,35,52,51,50,21,
+17,20,1,182,98,27,27,44,8,135,3,188,254,117,57,31,71,117,147,125,125,200,
+200,125,125,39,207,37,89,104,68,129,38,61,145,44,43,40,40,76,76,188,62,48,
+100,137,161,102,158,80,214,108,78,78,106,106,78,78,87,88,81,120,121,93,83,
+72,1,111,100,125,163,222,90,77,40,19,18,2,177,20,21,251,166,4,90,182,26,136,
+86,252,224,100,100,100,100,100,100,2,238,76,28,142,26,51,98,25,38,60,254,
+62,59,60,66,78,87,88,81,81,3,240,38,29,65,65,74,102,119,53,150,72,175,253,
+18,58,49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,168,1,145,100,100,200,
+254,112,57,0,0,2,0,100,0,0,4,176,7,108,0,6,0,74,0,0,1,34,7,6,21,20,23,1,22,
+21,17,35,17,39,38,35,34,7,7,6,7,6,35,34,39,7,23,17,35,39,38,39,38,53,52,55,
+54,51,17,39,38,53,52,19,22,51,51,54,53,52,39,38,53,52,55,54,51,50,23,22,23,
+54,51,50,23,23,17,52,35,52,51,50,21,17,20,1,19,20,15,15,50,3,105,2,188,237,
+22,28,47,63,5,10,12,51,44,45,114,24,203,188,65,66,22,22,38,37,100,87,88,154,
+135,31,3,27,96,83,2,15,68,67,83,73,8,65,53,89,86,132,100,125,163,1,105,10,
+11,25,31,50,3,155,14,15,251,152,4,104,191,17,45,4,17,13,51,69,60,115,251,
+180,95,94,50,49,57,55,50,50,1,237,53,53,32,31,1,82,132,8,64,62,40,35,48,8,
+8,59,60,53,116,29,67,104,1,115,100,100,200,254,112,56,0,2,0,250,0,0,10,114,
+7,108,0,6,0,112,0,0,37,54,53,52,39,38,35,1,22,21,17,35,17,37,38,35,34,7,23,
+17,20,7,6,35,34,39,38,53,17,52,39,38,35,35,34,7,6,21,21,50,23,22,21,20,7,
+6,7,7,35,17,52,55,54,55,39,38,53,52,55,55,23,22,51,50,55,55,20,7,6,7,6,35,
+34,39,39,7,23,22,23,22,23,22,21,17,20,23,22,51,50,55,54,53,17,39,38,53,52,
+55,55,54,51,50,23,5,17,52,35,52,51,50,21,17,20,1,182,50,15,15,20,8,135,3,
+188,254,117,57,31,71,117,147,125,125,200,200,125,125,78,78,106,50,106,78,
+78,100,37,38,22,22,65,66,188,125,52,65,72,120,76,229,221,58,43,12,11,50,33,
+34,55,19,21,41,50,155,69,204,54,11,171,112,125,78,78,106,106,78,78,87,88,
+81,120,121,93,83,72,1,111,100,125,163,234,50,31,25,11,10,3,26,20,21,251,166,
+4,90,182,26,136,86,252,224,100,100,100,100,100,100,1,194,58,49,49,49,49,58,
+250,50,50,55,57,49,50,94,95,2,238,100,100,42,24,33,55,27,31,85,253,100,27,
+2,10,35,61,61,17,6,23,71,89,95,25,41,10,89,100,100,254,62,58,49,49,49,49,
+58,2,181,53,53,32,31,85,126,127,33,168,1,145,100,100,200,254,112,57,0,0,1,
+0,100,0,0,10,89,7,108,0,91,0,0,1,22,21,17,35,17,39,38,35,34,7,7,22,21,17,
+35,17,37,38,35,34,7,23,17,20,7,6,35,34,39,38,53,17,39,38,53,52,55,55,23,23,
+22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,20,23,22,51,50,55,54,53,17,39,
+38,53,52,55,55,54,51,50,23,5,55,54,51,50,23,23,17,52,35,52,51,50,21,17,20,
+10,37,2,188,237,22,28,47,63,142,15,188,254,117,57,31,71,117,147,125,125,200,
+200,125,125,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,38,57,68,43,192,78,
+78,106,106,78,78,87,88,81,120,121,93,83,72,1,123,174,128,91,89,86,132,100,
+125,163,4,133,14,15,251,152,4,104,191,17,45,98,34,45,251,166,4,90,182,26,
+136,86,252,224,100,100,100,100,100,100,2,181,53,53,32,31,85,253,62,32,27,
+1,5,35,128,6,1,34,39,75,113,252,224,58,49,49,49,49,58,2,181,53,53,32,31,85,
+126,127,33,174,120,87,67,104,1,115,100,100,200,254,112,56,0,4,0,250,253,118,
+10,114,7,108,0,5,0,12,0,77,0,127,0,0,1,34,21,50,53,52,3,6,21,20,51,53,34,
+37,52,55,54,51,51,50,23,22,21,21,20,35,34,53,52,54,51,52,39,38,35,35,34,7,
+6,21,21,20,23,22,51,51,52,54,51,50,22,21,20,7,6,35,21,20,6,35,34,38,53,53,
+51,21,20,22,51,50,54,53,53,35,34,39,38,53,37,22,21,17,35,17,37,38,35,34,7,
+23,17,35,39,39,7,7,35,17,34,53,52,55,55,51,17,37,5,17,39,38,53,52,55,55,54,
+51,50,23,5,17,52,35,52,51,50,21,17,20,4,18,34,62,83,13,38,13,253,19,125,125,
+200,50,200,125,125,188,138,74,64,78,78,106,50,106,78,78,79,79,130,94,105,
+117,69,89,45,44,103,157,151,137,171,178,70,60,44,76,94,218,129,129,9,67,3,
+188,254,117,57,31,71,117,147,188,72,190,190,72,188,112,56,56,188,1,6,1,6,
+87,88,81,120,121,93,83,72,1,111,100,125,163,2,198,39,20,19,1,128,7,12,30,
+55,100,100,100,100,100,100,100,155,100,130,62,63,58,49,49,49,49,58,255,127,
+73,74,50,110,65,74,86,32,33,239,151,151,127,123,200,200,42,64,77,80,240,114,
+113,177,210,20,21,251,166,4,90,182,26,136,86,249,42,59,156,156,59,1,94,90,
+50,55,55,254,98,216,216,5,177,53,53,32,31,85,126,127,33,168,1,145,100,100,
+200,254,112,57,0,0,3,0,100,0,0,7,170,7,108,0,6,0,13,0,96,0,0,1,34,7,6,21,
+20,23,37,34,7,6,21,20,23,1,22,21,17,35,17,37,38,35,34,7,23,17,35,39,38,39,
+38,53,52,55,54,51,53,33,17,35,39,38,39,38,53,52,55,54,51,17,39,38,53,52,55,
+55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,7,23,17,33,53,39,38,53,52,55,
+55,54,51,50,23,5,17,52,35,52,51,50,21,17,20,4,13,20,15,15,50,253,6,20,15,
+15,50,6,115,11,188,254,117,57,31,71,117,147,188,65,66,22,22,38,37,100,253,
+194,188,65,66,22,22,38,37,100,87,88,56,168,108,54,47,33,6,5,36,82,41,6,7,
+38,57,68,43,192,2,62,87,88,81,120,121,93,83,72,1,86,100,125,163,1,105,10,
+11,25,31,50,127,10,11,25,31,50,3,183,32,39,251,166,4,90,182,26,136,86,251,
+180,95,94,50,49,57,55,50,50,158,253,110,95,94,50,49,57,55,50,50,1,237,53,
+53,32,31,85,253,62,32,27,1,5,35,128,6,1,34,39,75,113,254,214,191,53,53,32,
+31,85,126,127,33,157,1,134,100,100,200,254,112,47,0,1,252,224,253,118,4,201,
+7,108,0,72,0,0,1,22,21,17,35,17,37,38,35,34,7,23,17,20,6,35,34,39,38,39,6,
+7,6,35,34,39,38,53,53,34,38,53,52,55,51,17,20,22,51,50,54,53,17,51,17,20,
+23,22,51,50,54,53,17,39,38,53,52,55,55,54,51,50,23,5,17,52,35,52,51,50,21,
+17,20,4,148,3,188,254,117,57,31,71,117,147,176,162,120,70,69,18,17,54,54,
+98,150,75,75,78,47,125,188,67,45,65,66,188,31,50,100,75,75,87,88,81,120,121,
+93,83,72,1,111,100,125,163,4,131,20,21,251,166,4,90,182,26,136,86,250,26,
+140,100,14,14,27,27,14,14,50,50,100,100,50,55,45,100,254,201,49,50,50,50,
+1,54,254,202,50,25,25,50,50,5,123,53,53,32,31,85,126,127,33,168,1,145,100,
+100,200,254,112,57,0,1,251,253,253,118,4,201,7,108,0,89,0,0,1,22,21,17,35,
+17,37,38,35,34,7,23,17,20,6,35,34,39,38,39,6,7,6,35,34,39,38,53,53,52,38,
+35,34,6,21,21,51,50,21,20,7,7,35,17,52,55,54,51,50,23,22,21,21,20,22,51,50,
+54,53,17,51,17,20,23,22,51,50,54,53,17,39,38,53,52,55,55,54,51,50,23,5,17,
+52,35,52,51,50,21,17,20,4,148,3,188,254,117,57,31,71,117,147,176,142,80,70,
+69,18,17,54,54,98,150,75,75,37,75,75,37,25,75,50,50,188,75,75,150,150,75,
+75,67,45,65,66,188,31,50,60,55,75,87,88,81,120,121,93,83,72,1,111,100,125,
+163,4,131,20,21,251,166,4,90,182,26,136,86,250,26,140,100,14,14,27,27,14,
+14,50,50,150,80,50,30,30,50,80,50,48,77,75,1,75,119,50,50,50,50,120,91,49,
+50,50,50,1,54,254,202,50,25,25,50,50,5,123,53,53,32,31,85,126,127,33,168,
+1,145,100,100,200,254,112,57,0,2,251,125,253,118,4,201,7,108,0,6,0,94,0,0,
+1,21,50,53,52,39,38,1,22,21,17,35,17,37,38,35,34,7,23,17,20,33,34,39,38,35,
+35,21,35,38,53,52,55,54,55,35,52,39,38,35,34,7,38,35,34,7,6,21,21,50,23,22,
+21,20,35,35,17,52,54,51,50,23,54,51,50,22,21,51,50,23,22,51,50,53,17,39,38,
+53,52,55,55,54,51,50,23,5,17,52,35,52,51,50,21,17,20,252,67,41,11,10,8,61,
+3,188,254,117,57,31,71,117,147,254,204,200,75,75,50,50,190,100,25,24,45,1,
+53,12,15,54,98,99,54,15,12,53,63,31,31,125,198,215,53,44,119,119,44,52,214,
+50,100,85,85,130,120,87,88,81,120,121,93,83,72,1,111,100,125,163,254,37,75,
+50,12,7,6,6,94,20,21,251,166,4,90,182,26,136,86,250,37,251,100,100,200,170,
+50,50,25,24,1,64,43,9,117,117,9,43,64,45,31,32,62,150,1,64,122,158,114,114,
+158,122,100,100,131,5,112,53,53,32,31,85,126,127,33,168,1,145,100,100,200,
+254,112,57,0,1,254,74,253,118,4,201,7,108,0,47,0,0,1,22,21,17,35,17,37,38,
+35,34,7,23,17,35,37,5,35,17,51,50,22,21,20,7,21,37,5,17,39,38,53,52,55,55,
+54,51,50,23,5,17,52,35,52,51,50,21,17,20,4,148,3,188,254,117,57,31,71,117,
+147,188,254,249,254,250,188,174,54,72,112,1,6,1,7,87,88,81,120,121,93,83,
+72,1,111,100,125,163,4,131,20,21,251,166,4,90,182,26,136,86,249,42,215,215,
+2,38,40,50,100,60,114,216,216,5,177,53,53,32,31,85,126,127,33,168,1,145,100,
+100,200,254,112,57,0,1,254,74,253,118,4,201,7,108,0,49,0,0,1,22,21,17,35,
+17,37,38,35,34,7,23,17,20,33,32,53,17,51,23,22,21,20,35,21,20,33,32,53,17,
+39,38,53,52,55,55,54,51,50,23,5,17,52,35,52,51,50,21,17,20,4,148,3,188,254,
+117,57,31,71,117,147,254,62,254,61,188,56,56,112,1,7,1,6,87,88,81,120,121,
+93,83,72,1,111,100,125,163,4,131,20,21,251,166,4,90,182,26,136,86,250,36,
+250,250,1,44,54,55,50,90,51,116,116,5,113,53,53,32,31,85,126,127,33,168,1,
+145,100,100,200,254,112,57,0,1,253,218,253,118,4,201,7,108,0,57,0,0,1,22,
+21,17,35,17,37,38,35,34,7,23,17,51,21,35,17,20,33,32,53,53,34,53,52,55,55,
+51,17,20,33,32,53,17,35,53,51,17,39,38,53,52,55,55,54,51,50,23,5,17,52,35,
+52,51,50,21,17,20,4,148,3,188,254,117,57,31,71,117,147,150,150,254,62,254,
+61,112,56,56,188,1,7,1,6,162,162,87,88,81,120,121,93,83,72,1,111,100,125,
+163,4,131,20,21,251,166,4,90,182,26,136,86,252,68,144,254,112,250,250,50,
+90,50,55,55,254,212,116,116,1,144,144,3,81,53,53,32,31,85,126,127,33,168,
+1,145,100,100,200,254,112,57,0,2,0,150,0,0,10,114,7,108,0,6,0,111,0,0,37,
+54,53,52,39,38,35,1,22,21,17,35,17,39,38,35,34,15,2,22,21,17,35,17,52,38,
+35,34,6,21,17,35,17,52,39,39,38,35,34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,
+20,23,17,50,23,22,21,20,7,6,7,7,35,17,38,53,52,55,54,51,50,23,23,22,51,50,
+55,55,54,51,50,23,23,22,23,54,55,54,51,50,23,22,23,55,54,51,50,23,23,17,52,
+35,52,51,50,21,17,20,1,182,98,27,27,44,8,136,2,188,237,22,28,47,63,65,67,
+5,188,156,106,96,166,188,34,68,11,11,24,24,55,56,58,79,55,73,25,20,13,11,
+44,6,93,145,44,43,40,40,76,76,188,100,133,132,46,48,95,74,6,8,20,30,41,83,
+52,37,61,62,39,27,11,12,125,170,200,125,30,22,121,128,91,89,86,132,100,125,
+163,222,90,77,40,19,18,2,179,14,15,251,152,4,104,191,17,45,45,46,25,25,251,
+130,4,126,78,128,128,78,251,130,4,145,76,21,41,6,28,60,60,1,49,68,24,9,38,
+6,9,34,77,253,234,59,60,66,78,87,88,81,81,4,38,107,43,43,123,122,88,72,5,
+32,45,88,38,39,25,35,11,11,115,115,27,28,83,87,67,104,1,115,100,100,200,254,
+112,56,0,0,6,0,150,251,124,10,64,8,202,0,11,0,27,0,36,0,81,0,88,0,183,0,0,
+1,20,22,51,50,54,53,52,38,35,34,6,5,20,7,6,35,34,39,38,53,52,55,54,51,50,
+23,22,1,35,17,38,53,52,51,50,21,3,52,55,54,51,50,23,22,21,20,6,35,34,39,38,
+39,38,39,38,35,34,7,6,7,52,55,54,54,51,50,4,23,22,22,51,50,54,53,52,39,6,
+35,34,38,38,1,54,53,52,39,38,35,1,22,21,17,35,17,52,38,35,34,6,21,17,35,17,
+52,39,39,38,35,34,7,7,6,35,38,39,39,38,35,34,7,7,6,21,20,23,17,50,23,22,21,
+20,7,6,7,7,35,17,38,53,52,55,54,51,50,23,23,22,51,50,55,55,54,51,50,23,23,
+22,23,54,55,54,51,50,23,22,23,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,
+7,7,7,208,40,40,40,40,40,40,40,40,1,49,56,56,113,113,56,56,56,56,113,113,
+56,56,253,170,150,50,100,100,92,30,31,63,86,43,44,214,173,135,113,111,120,
+119,124,123,87,91,89,89,74,36,38,168,141,159,1,0,133,132,150,82,70,109,2,
+15,16,19,37,20,251,103,98,27,27,44,5,189,5,188,156,106,96,166,188,34,68,11,
+11,24,24,55,56,58,79,55,73,25,20,13,11,44,6,93,145,44,43,40,40,76,76,188,
+100,133,132,46,48,95,74,6,8,20,30,41,83,52,37,61,62,39,27,11,12,125,170,200,
+125,30,22,121,128,91,89,86,192,78,188,237,22,28,47,63,65,7,233,50,50,50,50,
+50,50,50,50,113,56,56,56,56,113,113,56,56,56,56,243,34,1,127,18,62,87,87,
+1,237,50,25,25,50,50,100,150,150,38,37,88,87,50,50,22,23,45,60,43,42,95,94,
+97,97,78,66,100,15,12,8,22,38,1,187,90,77,40,19,18,2,222,25,25,251,130,4,
+126,78,128,128,78,251,130,4,145,76,21,41,6,28,60,60,1,49,68,24,9,38,6,9,34,
+77,253,234,59,60,66,78,87,88,81,81,4,38,107,43,43,123,122,88,72,5,32,45,88,
+38,39,25,35,11,11,115,115,27,28,83,87,67,151,59,95,251,152,4,104,191,17,45,
+45,0,0,5,0,250,253,118,10,64,8,202,0,11,0,27,0,36,0,43,0,140,0,0,1,20,22,
+51,50,54,53,52,38,35,34,6,5,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,1,
+35,17,38,53,52,51,50,21,1,50,55,54,53,52,39,1,20,7,6,35,34,39,38,39,6,7,6,
+35,35,34,39,38,53,17,52,51,50,23,22,23,22,21,20,7,6,35,17,20,23,22,51,51,
+50,55,54,53,17,39,38,53,52,55,55,23,23,22,51,50,55,55,20,6,7,6,35,34,39,39,
+7,23,17,20,23,22,51,50,55,54,53,17,39,38,53,52,55,55,54,51,50,23,5,22,21,
+17,35,17,37,38,35,34,7,23,7,198,40,40,40,40,40,40,40,40,1,49,56,56,113,113,
+56,56,56,56,113,113,56,56,254,67,150,50,100,100,250,124,20,15,15,50,5,194,
+125,125,200,200,125,17,14,14,17,125,200,50,200,125,125,124,64,66,65,22,22,
+38,37,100,78,78,106,50,106,78,78,87,88,56,168,108,54,47,33,6,5,36,82,41,6,
+7,38,57,68,43,192,78,78,106,106,78,78,87,88,81,120,121,93,83,72,1,141,108,
+188,254,117,57,31,71,117,147,7,233,50,50,50,50,50,50,50,50,113,56,56,56,56,
+113,113,56,56,56,56,245,28,1,127,18,62,87,87,5,46,10,11,25,31,50,252,58,100,
+100,100,100,13,14,14,13,100,100,100,100,4,76,100,94,95,50,49,57,55,50,50,
+253,68,58,49,49,49,49,58,2,181,53,53,32,31,85,253,62,32,27,1,5,35,128,6,1,
+34,39,75,113,252,224,58,49,49,49,49,58,2,181,53,53,32,31,85,126,127,33,182,
+50,121,251,166,4,90,182,26,136,86,0,5,0,100,253,118,4,151,8,202,0,11,0,27,
+0,34,0,82,0,91,0,0,1,20,22,51,50,54,53,52,38,35,34,6,5,20,7,6,35,34,39,38,
+53,52,55,54,51,50,23,22,1,34,7,6,21,20,23,0,35,20,35,34,39,39,7,23,17,35,
+39,38,39,38,53,52,55,54,51,17,39,38,53,52,55,55,23,23,22,51,55,54,51,50,23,
+23,22,21,17,35,17,39,38,35,34,7,7,2,21,17,35,17,34,53,52,51,2,178,40,40,40,
+40,40,40,40,40,1,49,56,56,113,113,56,56,56,56,113,113,56,56,253,48,20,15,
+15,50,1,29,40,1,40,97,68,43,192,188,65,66,22,22,38,37,100,87,88,56,168,108,
+54,47,34,42,109,78,76,73,164,66,188,196,12,18,32,52,84,133,150,80,120,7,233,
+50,50,50,50,50,50,50,50,113,56,56,56,56,113,113,56,56,56,56,249,15,10,11,
+25,31,50,3,198,1,50,39,75,113,251,180,95,94,50,49,57,55,50,50,1,237,53,53,
+32,31,85,253,62,32,27,34,87,67,151,59,95,251,152,4,116,179,11,39,67,250,212,
+91,254,53,1,111,92,91,0,2,253,200,253,118,1,182,9,96,0,5,0,37,0,0,1,33,38,
+38,35,34,5,22,21,17,20,33,32,53,17,51,17,20,33,32,53,17,52,35,33,34,53,16,
+33,50,23,53,51,21,22,23,17,51,254,88,1,244,97,162,91,150,2,238,112,254,62,
+254,62,188,1,6,1,6,124,253,218,144,1,38,109,107,134,59,57,134,7,202,77,45,
+169,71,176,247,204,250,250,1,44,254,212,106,106,8,52,150,144,1,0,39,189,253,
+35,46,1,28,0,1,253,194,253,118,1,182,9,157,0,40,0,0,0,7,35,34,39,38,53,52,
+54,53,52,35,52,51,50,21,20,6,21,21,54,51,32,17,17,20,33,32,53,17,51,17,20,
+33,32,53,17,16,33,34,7,254,206,42,9,37,41,89,50,100,100,188,50,132,180,1,
+206,254,62,254,62,188,1,6,1,6,254,238,160,61,7,12,4,30,75,116,65,135,70,70,
+100,170,85,115,70,43,66,254,108,248,8,250,250,1,44,254,212,106,106,7,248,
+1,4,48,0,1,0,226,4,104,2,2,7,108,0,11,0,0,1,7,55,17,52,35,52,51,50,21,17,
+20,1,169,175,76,100,125,163,4,176,72,181,1,135,100,100,200,254,212,74,0,0,
+1,255,6,0,0,1,182,5,220,0,19,0,0,2,53,52,55,54,51,50,23,23,22,21,17,35,17,
+39,38,35,34,7,7,250,38,114,91,89,86,192,78,188,237,36,28,17,14,119,5,20,59,
+37,26,78,67,151,59,95,251,152,4,104,191,27,10,83,0,0,1,255,6,0,0,1,182,5,
+220,0,19,0,0,2,53,52,55,54,51,50,23,23,22,21,17,35,17,39,38,35,34,7,7,250,
+38,114,91,89,86,192,78,188,237,36,28,17,14,119,5,20,59,37,26,78,67,151,59,
+95,251,152,4,104,191,27,10,83,0,0,1,1,44,0,0,4,226,5,120,0,79,0,0,1,20,23,
+22,51,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,55,50,23,22,21,20,7,6,35,
+34,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,34,39,38,39,52,55,54,51,50,
+23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,50,55,54,53,52,39,38,35,34,7,6,
+1,164,89,88,178,237,119,119,119,119,237,237,119,119,45,45,89,30,15,15,15,
+15,30,29,15,15,89,88,178,178,89,89,89,89,178,237,119,118,1,119,119,237,237,
+119,119,45,44,89,30,15,15,15,15,30,30,14,15,89,89,178,178,88,89,3,254,132,
+66,66,94,95,190,189,95,95,73,73,147,87,44,43,1,15,15,30,29,14,15,15,14,29,
+87,44,43,65,66,131,132,65,66,95,94,190,189,95,94,73,72,145,88,44,44,15,15,
+29,29,15,14,15,14,30,87,44,43,65,66,0,0,1,249,143,6,114,255,103,7,209,0,19,
+0,0,3,35,35,52,39,38,35,34,7,6,21,35,35,52,55,54,33,32,23,22,153,139,137,
+118,118,236,238,118,120,135,137,187,188,1,117,1,117,188,187,6,114,105,52,
+54,54,52,105,176,88,87,87,88,0,2,0,150,0,0,2,138,2,188,0,7,0,15,0,0,1,52,
+35,34,21,20,51,50,37,16,51,50,17,16,35,34,2,38,150,150,150,150,254,112,250,
+250,250,250,1,94,250,250,250,250,1,94,254,162,254,162,0,1,0,101,0,0,2,189,
+2,188,0,6,0,0,1,19,35,3,3,35,19,1,203,242,105,196,195,104,239,2,188,253,68,
+2,53,253,203,2,188,0,0,1,0,100,0,0,0,200,2,188,0,3,0,0,19,17,35,17,200,100,
+2,188,253,68,2,188,0,1,0,100,0,0,4,172,2,188,0,12,0,0,1,19,19,51,19,35,3,
+3,35,3,3,35,19,1,202,189,188,119,242,105,196,195,105,196,195,104,239,2,188,
+253,219,2,37,253,68,2,53,253,203,2,53,253,203,2,188,0,0,1,0,100,0,0,2,188,
+2,188,0,6,0,0,33,3,51,19,19,51,3,1,86,242,105,196,195,104,239,2,188,253,203,
+2,53,253,68,0,0,2,0,100,0,1,2,189,2,189,0,13,0,21,0,0,55,52,55,39,51,23,55,
+51,7,22,21,20,35,34,37,54,39,6,21,20,55,50,201,125,226,151,149,150,151,227,
+127,200,200,1,43,1,101,99,100,100,201,127,146,226,149,150,227,146,127,200,
+199,82,115,115,81,101,1,0,0,1,0,100,0,0,1,194,2,188,0,3,0,0,19,19,35,3,209,
+241,106,244,2,188,253,68,2,188,0,1,0,100,0,0,3,182,2,188,0,9,0,0,1,19,19,
+51,3,35,3,3,35,19,1,202,189,188,115,250,105,196,195,104,239,2,188,253,219,
+2,37,253,68,2,53,253,203,2,188,0,0,1,0,100,0,0,1,193,2,188,0,3,0,0,1,3,35,
+19,1,193,245,104,239,2,188,253,68,2,188,0,0,1,0,100,254,161,3,83,2,56,0,16,
+0,0,55,1,23,1,37,32,21,6,5,39,53,23,50,53,52,35,33,100,2,72,34,254,41,1,47,
+1,45,1,254,212,50,51,200,200,254,100,112,1,200,99,254,143,1,225,226,1,1,100,
+1,126,125,0,0,4,0,250,252,24,5,170,8,152,0,6,0,67,0,85,0,103,0,0,1,53,6,21,
+20,23,22,1,52,55,54,33,50,23,53,52,51,50,21,34,21,17,20,35,34,39,2,35,34,
+7,6,21,17,20,23,22,51,50,55,22,51,50,55,54,53,53,34,38,53,52,54,54,51,50,
+21,17,20,7,6,35,34,39,6,35,34,39,38,53,16,53,17,52,55,54,33,32,23,22,21,17,
+20,7,6,33,32,39,18,21,17,20,23,22,51,50,55,54,53,17,52,39,38,35,34,7,4,88,
+40,10,10,252,182,118,119,1,16,223,130,208,130,150,94,72,22,114,239,178,72,
+71,93,20,23,83,119,119,82,23,20,92,80,70,39,91,74,134,128,127,69,58,142,142,
+58,70,128,128,119,119,1,32,1,31,118,119,119,118,254,225,254,224,119,69,72,
+72,194,193,71,72,72,71,193,194,72,254,101,97,20,31,25,10,11,1,155,215,142,
+143,135,135,250,134,116,254,162,100,50,1,0,92,91,173,253,68,64,52,12,149,
+149,12,52,64,150,100,55,57,89,49,200,254,212,122,89,89,144,144,89,89,122,
+6,239,225,1,44,225,188,187,187,188,225,254,212,225,187,188,188,3,97,153,254,
+212,153,151,152,152,151,153,1,44,153,152,151,151,0,0,2,0,250,252,24,5,20,
+8,152,0,46,0,78,0,0,0,7,6,33,35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,
+23,22,51,50,55,38,53,52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,
+22,17,3,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,
+20,35,34,21,20,51,50,55,5,20,178,179,254,169,100,100,1,33,112,111,101,102,
+153,154,82,82,49,48,97,71,28,81,125,125,69,70,129,181,100,101,129,129,248,
+247,149,148,200,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,100,
+62,62,148,248,4,141,232,233,144,192,191,1,117,1,17,92,91,86,87,153,125,62,
+63,70,14,76,130,130,137,78,79,109,108,167,195,138,137,142,143,254,197,251,
+72,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,
+0,3,0,100,252,24,5,120,9,96,0,6,0,68,0,100,0,0,1,21,50,53,52,39,38,3,32,39,
+38,53,17,52,35,52,51,50,21,17,20,23,22,51,51,50,55,54,53,17,52,39,38,35,34,
+7,38,35,34,7,6,21,21,50,23,22,21,20,35,34,53,17,52,55,54,51,50,23,54,51,50,
+23,22,21,17,20,7,6,33,19,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,
+34,53,52,51,50,21,20,35,34,21,20,51,50,55,3,20,48,13,12,11,254,242,140,140,
+150,130,208,93,93,176,50,176,93,93,60,2,2,26,121,119,29,3,2,60,74,37,37,148,
+188,109,109,30,30,123,123,29,30,108,109,140,140,254,242,250,188,133,95,55,
+27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,6,39,75,50,12,7,
+6,252,149,115,115,170,4,26,116,134,250,251,230,128,64,64,64,64,128,3,32,64,
+52,1,167,167,1,52,64,225,31,32,62,150,100,1,144,122,89,89,134,134,89,89,122,
+252,224,170,115,115,254,204,108,250,241,117,88,25,25,51,37,67,3,248,70,151,
+250,250,75,75,100,100,133,0,3,0,250,252,24,6,26,8,152,0,6,0,38,0,70,0,0,1,
+21,50,53,52,39,38,1,52,35,34,21,17,50,23,22,21,20,35,34,53,17,16,33,50,23,
+54,51,32,17,17,35,17,52,35,34,21,17,35,1,53,51,17,20,6,35,34,39,38,53,50,
+54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,1,182,48,13,12,
+1,95,187,187,74,37,37,148,188,1,119,187,94,94,187,1,119,188,187,187,188,1,
+32,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,
+3,107,75,50,12,7,6,3,207,216,216,252,149,31,32,62,150,100,4,26,1,94,87,87,
+254,162,251,130,4,126,216,216,251,130,254,204,108,250,241,117,88,25,25,51,
+37,67,3,248,70,151,250,250,75,75,100,100,133,0,3,0,250,252,24,5,20,9,96,0,
+6,0,51,0,83,0,0,1,54,53,52,39,21,50,37,16,37,37,54,53,52,35,52,51,50,21,20,
+5,5,6,21,17,20,23,22,51,33,38,53,53,52,51,50,22,22,21,20,6,35,21,20,23,23,
+21,33,34,39,38,53,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,
+52,51,50,21,20,35,34,21,20,51,50,55,4,156,10,40,20,252,104,1,109,1,27,214,
+100,100,188,254,170,254,208,216,78,78,106,1,156,150,134,74,91,39,70,80,75,
+75,253,168,200,125,125,3,82,188,133,95,55,27,28,63,87,134,254,238,192,250,
+250,100,100,62,62,148,248,5,120,10,25,31,20,97,111,1,88,110,91,68,117,70,
+100,170,210,108,95,70,247,254,12,58,49,49,227,79,250,200,49,89,57,55,100,
+100,101,112,112,125,100,100,100,253,160,108,250,241,117,88,25,25,51,37,67,
+3,248,70,151,250,250,75,75,100,100,133,0,4,0,250,252,24,5,120,9,96,0,7,0,
+14,0,72,0,104,0,0,1,54,53,52,35,34,21,20,1,54,53,52,39,21,50,1,23,22,51,50,
+53,53,52,51,50,21,34,21,21,16,35,37,6,7,6,21,17,20,23,22,51,33,38,53,53,52,
+51,50,22,22,21,20,6,35,21,20,23,21,33,34,39,38,53,17,16,37,38,53,52,51,50,
+21,20,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,
+20,35,34,21,20,51,50,55,2,160,34,78,78,2,118,10,40,20,254,157,201,9,9,78,
+188,100,100,225,254,126,31,38,182,78,78,106,1,156,150,134,74,91,39,70,80,
+150,253,168,200,125,125,1,10,100,212,212,1,4,188,133,95,55,27,28,63,87,134,
+254,238,192,250,250,100,100,62,62,148,248,7,120,34,32,88,88,44,253,134,10,
+25,31,20,97,2,86,26,2,141,230,170,100,70,230,254,212,65,20,20,69,246,254,
+102,58,49,49,177,79,200,200,49,89,57,55,100,50,101,174,125,100,100,100,1,
+154,1,24,127,55,106,222,222,47,249,253,108,250,241,117,88,25,25,51,37,67,
+3,248,70,151,250,250,75,75,100,100,133,0,2,0,100,252,24,5,20,9,146,0,54,0,
+86,0,0,1,54,51,50,0,17,21,16,0,33,32,39,38,53,52,55,54,51,50,22,21,20,35,
+34,53,52,55,38,35,34,21,20,23,22,51,50,54,53,53,16,38,35,34,3,20,35,34,53,
+17,52,35,52,51,50,21,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,
+53,52,51,50,21,20,35,34,21,20,51,50,55,1,182,130,213,252,1,11,254,245,254,
+255,254,224,119,119,91,90,161,129,129,100,100,31,28,61,154,72,72,194,163,
+173,173,158,229,114,94,94,150,130,208,2,150,188,133,95,55,27,28,63,87,134,
+254,238,192,250,250,100,100,62,62,148,248,8,17,135,254,197,254,127,200,254,
+227,254,197,142,143,185,153,88,89,117,137,100,100,56,24,40,196,143,92,91,
+213,243,200,1,87,213,255,0,100,100,1,144,116,134,250,248,240,108,250,241,
+117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,3,0,250,252,
+24,6,2,9,96,0,6,0,60,0,92,0,0,1,54,53,52,39,38,35,0,51,50,53,17,52,35,52,
+51,50,21,17,20,33,32,53,17,52,39,38,35,34,7,38,35,34,7,6,21,17,50,23,22,21,
+20,7,6,7,7,35,17,52,55,54,51,50,23,54,51,50,23,22,21,17,3,53,51,17,20,6,35,
+34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,
+1,182,98,27,27,44,2,250,75,75,150,130,208,254,249,254,249,75,18,21,68,104,
+105,69,21,18,75,145,44,43,40,40,76,76,188,116,116,63,52,129,128,53,62,115,
+116,100,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,
+248,3,154,90,77,40,19,18,254,190,56,4,226,116,134,250,251,30,200,200,3,232,
+64,52,13,130,130,13,52,64,253,168,59,60,66,78,87,88,81,81,4,176,122,89,89,
+134,134,89,89,122,252,24,254,4,108,250,241,117,88,25,25,51,37,67,3,248,70,
+151,250,250,75,75,100,100,133,0,0,3,0,250,252,24,5,170,9,146,0,6,0,67,0,99,
+0,0,1,53,6,21,20,23,22,1,52,55,54,33,50,23,53,52,51,50,21,34,21,17,20,35,
+34,39,2,35,34,7,6,21,17,20,23,22,51,50,55,22,51,50,55,54,53,53,34,38,53,52,
+54,54,51,50,21,17,20,7,6,35,34,39,6,35,34,39,38,53,1,53,51,17,20,6,35,34,
+39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,4,88,
+40,10,10,252,182,118,119,1,16,223,130,208,130,150,94,72,22,114,239,178,72,
+71,93,20,23,83,119,119,82,23,20,92,80,70,39,91,74,134,128,127,69,58,142,142,
+58,70,128,128,3,82,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,
+100,62,62,148,248,5,9,97,20,31,25,10,11,1,155,215,142,143,135,135,250,134,
+116,254,162,100,50,1,0,92,91,173,253,68,64,52,12,149,149,12,52,64,150,100,
+55,57,89,49,200,254,212,122,89,89,144,144,89,89,122,253,160,108,250,241,117,
+88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,0,3,0,250,252,
+24,5,20,9,146,0,10,0,85,0,117,0,0,1,55,52,35,34,7,6,7,6,21,20,7,38,53,52,
+55,54,55,54,51,51,22,23,22,21,20,7,6,35,34,39,38,53,52,55,54,55,38,53,52,
+55,54,51,50,23,53,52,35,52,51,50,21,17,20,35,34,39,38,35,34,7,6,21,20,23,
+22,51,50,23,22,21,20,35,34,39,38,35,34,7,6,21,20,23,22,51,50,1,53,51,17,20,
+6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,
+55,4,30,57,16,5,8,23,6,3,106,16,11,24,51,48,45,9,48,43,43,146,147,207,248,
+118,134,74,75,149,98,103,89,187,153,130,150,130,208,94,72,22,144,139,97,42,
+52,61,60,121,194,170,56,23,29,63,115,190,221,110,111,86,71,155,86,1,8,188,
+133,95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,3,189,
+33,24,3,9,13,6,8,8,70,46,36,30,23,51,20,19,2,33,34,104,105,72,72,104,117,
+229,170,111,112,53,87,167,187,87,76,135,135,116,134,250,254,212,100,50,216,
+43,52,116,105,53,53,137,49,90,41,62,111,87,88,175,157,82,67,254,60,108,250,
+241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,4,0,250,
+252,24,10,201,8,155,0,31,0,78,0,98,0,118,0,0,1,53,51,17,20,6,35,34,39,38,
+53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,2,7,6,33,
+35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,51,
+50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,17,5,20,2,6,6,35,34,38,38,
+2,53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,
+2,6,74,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,
+248,106,178,179,254,169,100,100,1,33,112,111,101,102,153,154,82,82,49,48,
+97,71,28,81,125,125,69,70,129,181,100,101,129,129,248,247,149,148,5,181,59,
+120,180,121,126,182,117,56,56,117,183,127,120,179,120,59,253,20,28,63,103,
+74,75,102,63,27,27,63,101,74,75,103,64,28,1,136,108,250,241,117,88,25,25,
+51,37,67,3,248,70,151,250,250,75,75,100,100,133,3,114,232,233,144,192,191,
+1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,130,137,78,79,109,108,167,
+195,138,137,142,143,254,197,147,169,254,234,198,108,108,198,1,23,170,170,
+1,20,196,106,106,196,254,235,171,152,239,165,87,87,165,239,152,152,238,164,
+85,85,164,238,0,3,0,250,252,24,11,34,8,152,0,46,0,93,0,125,0,0,0,7,6,33,35,
+53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,51,50,
+21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,17,0,7,6,33,35,53,51,32,55,
+54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,51,50,21,20,7,6,35,
+34,39,38,53,52,55,54,51,50,23,22,17,1,53,51,17,20,6,35,34,39,38,53,50,54,
+53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,11,34,178,179,254,
+169,100,100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,28,81,125,125,
+69,70,129,181,100,101,129,129,248,247,149,148,249,242,178,179,254,169,100,
+100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,28,81,125,125,69,70,129,
+181,100,101,129,129,248,247,149,148,1,54,188,133,95,55,27,28,63,87,134,254,
+238,192,250,250,100,100,62,62,148,248,4,141,232,233,144,192,191,1,117,1,17,
+92,91,86,87,153,125,62,63,70,14,76,130,130,137,78,79,109,108,167,195,138,
+137,142,143,254,197,254,77,232,233,144,192,191,1,117,1,17,92,91,86,87,153,
+125,62,63,70,14,76,130,130,137,78,79,109,108,167,195,138,137,142,143,254,
+197,251,72,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,
+100,133,0,0,4,0,250,252,24,11,134,9,96,0,6,0,68,0,115,0,147,0,0,1,21,50,53,
+52,39,38,3,32,39,38,53,17,52,35,52,51,50,21,17,20,23,22,51,51,50,55,54,53,
+17,52,39,38,35,34,7,38,35,34,7,6,21,21,50,23,22,21,20,35,34,53,17,52,55,54,
+51,50,23,54,51,50,23,22,21,17,20,7,6,33,0,7,6,33,35,53,51,32,55,54,17,16,
+39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,51,50,21,20,7,6,35,34,39,38,
+53,52,55,54,51,50,23,22,17,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,
+35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,9,34,48,13,12,11,254,242,140,
+140,150,130,208,93,93,176,50,176,93,93,60,2,2,26,121,119,29,3,2,60,74,37,
+37,148,188,109,109,30,30,123,123,29,30,108,109,140,140,254,242,251,180,178,
+179,254,169,100,100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,28,81,
+125,125,69,70,129,181,100,101,129,129,248,247,149,148,1,54,188,133,95,55,
+27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,6,39,75,50,12,7,
+6,252,149,115,115,170,4,26,116,134,250,251,230,128,64,64,64,64,128,3,32,64,
+52,1,167,167,1,52,64,225,31,32,62,150,100,1,144,122,89,89,134,134,89,89,122,
+252,224,170,115,115,1,209,232,233,144,192,191,1,117,1,17,92,91,86,87,153,
+125,62,63,70,14,76,130,130,137,78,79,109,108,167,195,138,137,142,143,254,
+197,251,72,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,
+100,133,0,0,4,0,250,252,24,12,40,8,152,0,6,0,38,0,85,0,117,0,0,1,21,50,53,
+52,39,38,1,52,35,34,21,17,50,23,22,21,20,35,34,53,17,16,33,50,23,54,51,32,
+17,17,35,17,52,35,34,21,17,35,0,7,6,33,35,53,51,32,55,54,17,16,39,38,35,34,
+7,6,21,20,23,22,51,50,55,38,53,52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,
+51,50,23,22,17,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,
+51,50,21,20,35,34,21,20,51,50,55,7,196,48,13,12,1,95,187,187,74,37,37,148,
+188,1,119,187,94,94,187,1,119,188,187,187,188,251,218,178,179,254,169,100,
+100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,28,81,125,125,69,70,129,
+181,100,101,129,129,248,247,149,148,1,54,188,133,95,55,27,28,63,87,134,254,
+238,192,250,250,100,100,62,62,148,248,3,107,75,50,12,7,6,3,207,216,216,252,
+149,31,32,62,150,100,4,26,1,94,87,87,254,162,251,130,4,126,216,216,251,130,
+1,209,232,233,144,192,191,1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,
+130,137,78,79,109,108,167,195,138,137,142,143,254,197,251,72,108,250,241,
+117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,4,0,250,252,
+24,11,34,9,96,0,6,0,51,0,98,0,130,0,0,1,54,53,52,39,21,50,37,16,37,37,54,
+53,52,35,52,51,50,21,20,5,5,6,21,17,20,23,22,51,33,38,53,53,52,51,50,22,22,
+21,20,6,35,21,20,23,23,21,33,34,39,38,53,36,7,6,33,35,53,51,32,55,54,17,16,
+39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,51,50,21,20,7,6,35,34,39,38,
+53,52,55,54,51,50,23,22,17,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,
+35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,10,170,10,40,20,252,104,1,109,
+1,27,214,100,100,188,254,170,254,208,216,78,78,106,1,156,150,134,74,91,39,
+70,80,75,75,253,168,200,125,125,254,12,178,179,254,169,100,100,1,33,112,111,
+101,102,153,154,82,82,49,48,97,71,28,81,125,125,69,70,129,181,100,101,129,
+129,248,247,149,148,1,54,188,133,95,55,27,28,63,87,134,254,238,192,250,250,
+100,100,62,62,148,248,5,120,10,25,31,20,97,111,1,88,110,91,68,117,70,100,
+170,210,108,95,70,247,254,12,58,49,49,227,79,250,200,49,89,57,55,100,100,
+101,112,112,125,100,100,100,165,232,233,144,192,191,1,117,1,17,92,91,86,87,
+153,125,62,63,70,14,76,130,130,137,78,79,109,108,167,195,138,137,142,143,
+254,197,251,72,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,
+75,100,100,133,0,0,5,0,250,252,24,11,134,9,96,0,7,0,14,0,72,0,119,0,151,0,
+0,1,54,53,52,35,34,21,20,1,54,53,52,39,21,50,1,23,22,51,50,53,53,52,51,50,
+21,34,21,21,16,35,37,6,7,6,21,17,20,23,22,51,33,38,53,53,52,51,50,22,22,21,
+20,6,35,21,20,23,21,33,34,39,38,53,17,16,37,38,53,52,51,50,21,20,0,7,6,33,
+35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,51,
+50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,17,1,53,51,17,20,6,35,34,
+39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,8,174,
+34,78,78,2,118,10,40,20,254,157,201,9,9,78,188,100,100,225,254,126,31,38,
+182,78,78,106,1,156,150,134,74,91,39,70,80,150,253,168,200,125,125,1,10,100,
+212,212,251,190,178,179,254,169,100,100,1,33,112,111,101,102,153,154,82,82,
+49,48,97,71,28,81,125,125,69,70,129,181,100,101,129,129,248,247,149,148,1,
+54,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,
+7,120,34,32,88,88,44,253,134,10,25,31,20,97,2,86,26,2,141,230,170,100,70,
+230,254,212,65,20,20,69,246,254,102,58,49,49,177,79,200,200,49,89,57,55,100,
+50,101,174,125,100,100,100,1,154,1,24,127,55,106,222,222,47,253,2,232,233,
+144,192,191,1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,130,137,78,
+79,109,108,167,195,138,137,142,143,254,197,251,72,108,250,241,117,88,25,25,
+51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,4,0,250,252,24,5,170,9,
+146,0,6,0,67,0,74,0,135,0,0,1,53,6,21,20,23,22,1,52,55,54,33,50,23,53,52,
+51,50,21,34,21,17,20,35,34,39,2,35,34,7,6,21,17,20,23,22,51,50,55,22,51,50,
+55,54,53,53,34,38,53,52,54,54,51,50,21,17,20,7,6,35,34,39,6,35,34,39,38,53,
+1,53,6,21,20,23,22,1,52,55,54,33,50,23,53,52,51,50,21,34,21,17,20,35,34,39,
+2,35,34,7,6,21,17,20,23,22,51,50,55,22,51,50,55,54,53,53,34,38,53,52,54,54,
+51,50,21,17,20,7,6,35,34,39,6,35,34,39,38,53,4,88,40,10,10,252,182,118,119,
+1,16,223,130,208,130,150,94,72,22,114,239,178,72,71,93,20,23,83,119,119,82,
+23,20,92,80,70,39,91,74,134,128,127,69,58,142,142,58,70,128,128,3,94,40,10,
+10,252,182,118,119,1,16,223,130,208,130,150,94,72,22,114,239,178,72,71,93,
+20,23,83,119,119,82,23,20,92,80,70,39,91,74,134,128,127,69,58,142,142,58,
+70,128,128,254,101,97,20,31,25,10,11,1,155,215,142,143,135,135,250,134,116,
+254,162,100,50,1,0,92,91,173,253,68,64,52,12,149,149,12,52,64,150,100,55,
+57,89,49,200,254,212,122,89,89,144,144,89,89,122,7,197,97,20,31,25,10,11,
+1,155,215,142,143,135,135,250,134,116,254,162,100,50,1,0,92,91,173,253,68,
+64,52,12,149,149,12,52,64,150,100,55,57,89,49,200,254,212,122,89,89,144,144,
+89,89,122,0,2,0,250,252,24,5,20,8,152,0,46,0,78,0,0,0,7,6,33,35,53,51,32,
+55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,51,50,21,20,7,6,
+35,34,39,38,53,52,55,54,51,50,23,22,17,3,53,51,17,20,6,35,34,39,38,53,50,
+54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,5,20,178,179,254,
+169,100,100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,28,81,125,125,
+69,70,129,181,100,101,129,129,248,247,149,148,200,188,133,95,55,27,28,63,
+87,134,254,238,192,250,250,100,100,62,62,148,248,253,233,232,233,144,192,
+191,1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,130,137,78,79,109,108,
+167,195,138,137,142,143,254,197,8,144,108,250,241,117,88,25,25,51,37,67,3,
+248,70,151,250,250,75,75,100,100,133,0,3,0,100,252,24,5,120,8,152,0,6,0,68,
+0,100,0,0,5,21,50,53,52,39,38,3,32,39,38,53,17,52,35,52,51,50,21,17,20,23,
+22,51,51,50,55,54,53,17,52,39,38,35,34,7,38,35,34,7,6,21,21,50,23,22,21,20,
+35,34,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,33,19,53,51,17,
+20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,
+50,55,3,20,48,13,12,11,254,242,140,140,150,130,208,93,93,176,50,176,93,93,
+60,2,2,26,121,119,29,3,2,60,74,37,37,148,188,109,109,30,30,123,123,29,30,
+108,109,140,140,254,242,250,188,133,95,55,27,28,63,87,134,254,238,192,250,
+250,100,100,62,62,148,248,125,75,50,12,7,6,252,149,115,115,170,4,26,116,134,
+250,251,230,128,64,64,64,64,128,3,32,64,52,1,167,167,1,52,64,225,31,32,62,
+150,100,1,144,122,89,89,134,134,89,89,122,252,224,170,115,115,12,20,108,250,
+241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,0,3,0,
+250,252,24,6,26,8,152,0,6,0,38,0,70,0,0,1,21,50,53,52,39,38,1,52,35,34,21,
+17,50,23,22,21,20,35,34,53,17,16,33,50,23,54,51,32,17,17,35,17,52,35,34,21,
+17,35,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,
+20,35,34,21,20,51,50,55,1,182,48,13,12,1,95,187,187,74,37,37,148,188,1,119,
+187,94,94,187,1,119,188,187,187,188,1,32,188,133,95,55,27,28,63,87,134,254,
+238,192,250,250,100,100,62,62,148,248,252,199,75,50,12,7,6,3,207,216,216,
+252,149,31,32,62,150,100,4,26,1,94,87,87,254,162,251,130,4,126,216,216,251,
+130,12,20,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,
+100,133,0,3,0,250,252,24,5,20,8,152,0,6,0,51,0,83,0,0,1,54,53,52,39,21,50,
+37,16,37,37,54,53,52,35,52,51,50,21,20,5,5,6,21,17,20,23,22,51,33,38,53,53,
+52,51,50,22,22,21,20,6,35,21,20,23,23,21,33,34,39,38,53,1,53,51,17,20,6,35,
+34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,
+4,156,10,40,20,252,104,1,109,1,27,214,100,100,188,254,170,254,208,216,78,
+78,106,1,156,150,134,74,91,39,70,80,75,75,253,168,200,125,125,3,82,188,133,
+95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,254,212,10,
+25,31,20,97,111,1,88,110,91,68,117,70,100,170,210,108,95,70,247,254,12,58,
+49,49,227,79,250,200,49,89,57,55,100,100,101,112,112,125,100,100,100,10,232,
+108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,
+0,4,0,250,252,24,5,120,8,152,0,7,0,14,0,72,0,104,0,0,37,54,53,52,35,34,21,
+20,1,54,53,52,39,21,50,1,23,22,51,50,53,53,52,51,50,21,34,21,21,16,35,37,
+6,7,6,21,17,20,23,22,51,33,38,53,53,52,51,50,22,22,21,20,6,35,21,20,23,21,
+33,34,39,38,53,17,16,37,38,53,52,51,50,21,20,1,53,51,17,20,6,35,34,39,38,
+53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,2,160,34,
+78,78,2,118,10,40,20,254,157,201,9,9,78,188,100,100,225,254,126,31,38,182,
+78,78,106,1,156,150,134,74,91,39,70,80,150,253,168,200,125,125,1,10,100,212,
+212,1,4,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,
+248,212,34,32,88,88,44,253,134,10,25,31,20,97,2,86,26,2,141,230,170,100,70,
+230,254,212,65,20,20,69,246,254,102,58,49,49,177,79,200,200,49,89,57,55,100,
+50,101,174,125,100,100,100,1,154,1,24,127,55,106,222,222,47,7,69,108,250,
+241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,0,2,0,
+100,252,24,5,20,8,152,0,54,0,86,0,0,1,54,51,50,0,17,21,16,0,33,32,39,38,53,
+52,55,54,51,50,22,21,20,35,34,53,52,55,38,35,34,21,20,23,22,51,50,54,53,53,
+16,38,35,34,3,20,35,34,53,17,52,35,52,51,50,21,1,53,51,17,20,6,35,34,39,38,
+53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,1,182,130,
+213,252,1,11,254,245,254,255,254,224,119,119,91,90,161,129,129,100,100,31,
+28,61,154,72,72,194,163,173,173,158,229,114,94,94,150,130,208,2,150,188,133,
+95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,1,109,135,
+254,197,254,127,200,254,227,254,197,142,143,185,153,88,89,117,137,100,100,
+56,24,40,196,143,92,91,213,243,200,1,87,213,255,0,100,100,1,144,116,134,250,
+6,56,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,
+133,0,3,0,250,252,24,6,2,8,152,0,6,0,60,0,92,0,0,1,54,53,52,39,38,35,0,51,
+50,53,17,52,35,52,51,50,21,17,20,33,32,53,17,52,39,38,35,34,7,38,35,34,7,
+6,21,17,50,23,22,21,20,7,6,7,7,35,17,52,55,54,51,50,23,54,51,50,23,22,21,
+17,3,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,
+35,34,21,20,51,50,55,1,182,98,27,27,44,2,250,75,75,150,130,208,254,249,254,
+249,75,18,21,68,104,105,69,21,18,75,145,44,43,40,40,76,76,188,116,116,63,
+52,129,128,53,62,115,116,100,188,133,95,55,27,28,63,87,134,254,238,192,250,
+250,100,100,62,62,148,248,252,246,90,77,40,19,18,254,190,56,4,226,116,134,
+250,251,30,200,200,3,232,64,52,13,130,130,13,52,64,253,168,59,60,66,78,87,
+88,81,81,4,176,122,89,89,134,134,89,89,122,252,24,11,76,108,250,241,117,88,
+25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,0,3,0,250,252,24,
+5,170,8,152,0,6,0,67,0,99,0,0,1,53,6,21,20,23,22,1,52,55,54,33,50,23,53,52,
+51,50,21,34,21,17,20,35,34,39,2,35,34,7,6,21,17,20,23,22,51,50,55,22,51,50,
+55,54,53,53,34,38,53,52,54,54,51,50,21,17,20,7,6,35,34,39,6,35,34,39,38,53,
+1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,
+34,21,20,51,50,55,4,88,40,10,10,252,182,118,119,1,16,223,130,208,130,150,
+94,72,22,114,239,178,72,71,93,20,23,83,119,119,82,23,20,92,80,70,39,91,74,
+134,128,127,69,58,142,142,58,70,128,128,3,82,188,133,95,55,27,28,63,87,134,
+254,238,192,250,250,100,100,62,62,148,248,254,101,97,20,31,25,10,11,1,155,
+215,142,143,135,135,250,134,116,254,162,100,50,1,0,92,91,173,253,68,64,52,
+12,149,149,12,52,64,150,100,55,57,89,49,200,254,212,122,89,89,144,144,89,
+89,122,10,232,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,
+100,100,133,0,0,3,0,250,252,24,5,20,8,152,0,10,0,85,0,117,0,0,1,55,52,35,
+34,7,6,7,6,21,20,7,38,53,52,55,54,55,54,51,51,22,23,22,21,20,7,6,35,34,39,
+38,53,52,55,54,55,38,53,52,55,54,51,50,23,53,52,35,52,51,50,21,17,20,35,34,
+39,38,35,34,7,6,21,20,23,22,51,50,23,22,21,20,35,34,39,38,35,34,7,6,21,20,
+23,22,51,50,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,
+50,21,20,35,34,21,20,51,50,55,4,30,57,16,5,8,23,6,3,106,16,11,24,51,48,45,
+9,48,43,43,146,147,207,248,118,134,74,75,149,98,103,89,187,153,130,150,130,
+208,94,72,22,144,139,97,42,52,61,60,121,194,170,56,23,29,63,115,190,221,110,
+111,86,71,155,86,1,8,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,
+100,62,62,148,248,253,25,33,24,3,9,13,6,8,8,70,46,36,30,23,51,20,19,2,33,
+34,104,105,72,72,104,117,229,170,111,112,53,87,167,187,87,76,135,135,116,
+134,250,254,212,100,50,216,43,52,116,105,53,53,137,49,90,41,62,111,87,88,
+175,157,82,67,11,132,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,
+75,75,100,100,133,0,4,0,250,252,24,10,201,8,152,0,31,0,78,0,98,0,118,0,0,
+1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,
+34,21,20,51,50,55,2,7,6,33,35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,
+23,22,51,50,55,38,53,52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,
+22,17,5,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,
+50,62,2,53,52,46,2,35,34,14,2,6,74,188,133,95,55,27,28,63,87,134,254,238,
+192,250,250,100,100,62,62,148,248,106,178,179,254,169,100,100,1,33,112,111,
+101,102,153,154,82,82,49,48,97,71,28,81,125,125,69,70,129,181,100,101,129,
+129,248,247,149,148,5,181,59,120,180,121,126,182,117,56,56,117,183,127,120,
+179,120,59,253,20,28,63,103,74,75,102,63,27,27,63,101,74,75,103,64,28,8,44,
+108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,133,
+246,42,232,233,144,192,191,1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,
+130,130,137,78,79,109,108,167,195,138,137,142,143,254,197,147,169,254,234,
+198,108,108,198,1,23,170,170,1,20,196,106,106,196,254,235,171,152,239,165,
+87,87,165,239,152,152,238,164,85,85,164,238,0,3,0,250,252,24,11,34,8,152,
+0,46,0,93,0,125,0,0,0,7,6,33,35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,
+23,22,51,50,55,38,53,52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,
+22,17,0,7,6,33,35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,
+55,38,53,52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,17,1,53,51,
+17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,
+51,50,55,11,34,178,179,254,169,100,100,1,33,112,111,101,102,153,154,82,82,
+49,48,97,71,28,81,125,125,69,70,129,181,100,101,129,129,248,247,149,148,249,
+242,178,179,254,169,100,100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,
+28,81,125,125,69,70,129,181,100,101,129,129,248,247,149,148,1,54,188,133,
+95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,253,233,232,
+233,144,192,191,1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,130,137,
+78,79,109,108,167,195,138,137,142,143,254,197,254,77,232,233,144,192,191,
+1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,130,137,78,79,109,108,167,
+195,138,137,142,143,254,197,8,144,108,250,241,117,88,25,25,51,37,67,3,248,
+70,151,250,250,75,75,100,100,133,0,0,4,0,250,252,24,11,134,8,152,0,6,0,68,
+0,115,0,147,0,0,5,21,50,53,52,39,38,3,32,39,38,53,17,52,35,52,51,50,21,17,
+20,23,22,51,51,50,55,54,53,17,52,39,38,35,34,7,38,35,34,7,6,21,21,50,23,22,
+21,20,35,34,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,33,0,7,6,
+33,35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,
+51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,17,1,53,51,17,20,6,35,
+34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,
+9,34,48,13,12,11,254,242,140,140,150,130,208,93,93,176,50,176,93,93,60,2,
+2,26,121,119,29,3,2,60,74,37,37,148,188,109,109,30,30,123,123,29,30,108,109,
+140,140,254,242,251,180,178,179,254,169,100,100,1,33,112,111,101,102,153,
+154,82,82,49,48,97,71,28,81,125,125,69,70,129,181,100,101,129,129,248,247,
+149,148,1,54,188,133,95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,
+62,148,248,125,75,50,12,7,6,252,149,115,115,170,4,26,116,134,250,251,230,
+128,64,64,64,64,128,3,32,64,52,1,167,167,1,52,64,225,31,32,62,150,100,1,144,
+122,89,89,134,134,89,89,122,252,224,170,115,115,1,209,232,233,144,192,191,
+1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,130,137,78,79,109,108,167,
+195,138,137,142,143,254,197,8,144,108,250,241,117,88,25,25,51,37,67,3,248,
+70,151,250,250,75,75,100,100,133,0,4,0,250,252,24,12,40,8,152,0,6,0,38,0,
+85,0,117,0,0,1,21,50,53,52,39,38,1,52,35,34,21,17,50,23,22,21,20,35,34,53,
+17,16,33,50,23,54,51,32,17,17,35,17,52,35,34,21,17,35,0,7,6,33,35,53,51,32,
+55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,53,52,51,50,21,20,7,6,
+35,34,39,38,53,52,55,54,51,50,23,22,17,1,53,51,17,20,6,35,34,39,38,53,50,
+54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,55,7,196,48,13,12,
+1,95,187,187,74,37,37,148,188,1,119,187,94,94,187,1,119,188,187,187,188,251,
+218,178,179,254,169,100,100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,
+28,81,125,125,69,70,129,181,100,101,129,129,248,247,149,148,1,54,188,133,
+95,55,27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,252,199,75,
+50,12,7,6,3,207,216,216,252,149,31,32,62,150,100,4,26,1,94,87,87,254,162,
+251,130,4,126,216,216,251,130,1,209,232,233,144,192,191,1,117,1,17,92,91,
+86,87,153,125,62,63,70,14,76,130,130,137,78,79,109,108,167,195,138,137,142,
+143,254,197,8,144,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,
+75,75,100,100,133,0,4,0,250,252,24,11,34,8,152,0,6,0,51,0,98,0,130,0,0,1,
+54,53,52,39,21,50,37,16,37,37,54,53,52,35,52,51,50,21,20,5,5,6,21,17,20,23,
+22,51,33,38,53,53,52,51,50,22,22,21,20,6,35,21,20,23,23,21,33,34,39,38,53,
+36,7,6,33,35,53,51,32,55,54,17,16,39,38,35,34,7,6,21,20,23,22,51,50,55,38,
+53,52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,17,1,53,51,17,20,
+6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,50,21,20,35,34,21,20,51,50,
+55,10,170,10,40,20,252,104,1,109,1,27,214,100,100,188,254,170,254,208,216,
+78,78,106,1,156,150,134,74,91,39,70,80,75,75,253,168,200,125,125,254,12,178,
+179,254,169,100,100,1,33,112,111,101,102,153,154,82,82,49,48,97,71,28,81,
+125,125,69,70,129,181,100,101,129,129,248,247,149,148,1,54,188,133,95,55,
+27,28,63,87,134,254,238,192,250,250,100,100,62,62,148,248,254,212,10,25,31,
+20,97,111,1,88,110,91,68,117,70,100,170,210,108,95,70,247,254,12,58,49,49,
+227,79,250,200,49,89,57,55,100,100,101,112,112,125,100,100,100,165,232,233,
+144,192,191,1,117,1,17,92,91,86,87,153,125,62,63,70,14,76,130,130,137,78,
+79,109,108,167,195,138,137,142,143,254,197,8,144,108,250,241,117,88,25,25,
+51,37,67,3,248,70,151,250,250,75,75,100,100,133,0,0,5,0,250,252,24,11,134,
+8,152,0,7,0,14,0,72,0,119,0,151,0,0,37,54,53,52,35,34,21,20,1,54,53,52,39,
+21,50,1,23,22,51,50,53,53,52,51,50,21,34,21,21,16,35,37,6,7,6,21,17,20,23,
+22,51,33,38,53,53,52,51,50,22,22,21,20,6,35,21,20,23,21,33,34,39,38,53,17,
+16,37,38,53,52,51,50,21,20,0,7,6,33,35,53,51,32,55,54,17,16,39,38,35,34,7,
+6,21,20,23,22,51,50,55,38,53,52,51,50,21,20,7,6,35,34,39,38,53,52,55,54,51,
+50,23,22,17,1,53,51,17,20,6,35,34,39,38,53,50,54,53,17,7,4,35,34,53,52,51,
+50,21,20,35,34,21,20,51,50,55,8,174,34,78,78,2,118,10,40,20,254,157,201,9,
+9,78,188,100,100,225,254,126,31,38,182,78,78,106,1,156,150,134,74,91,39,70,
+80,150,253,168,200,125,125,1,10,100,212,212,251,190,178,179,254,169,100,100,
+1,33,112,111,101,102,153,154,82,82,49,48,97,71,28,81,125,125,69,70,129,181,
+100,101,129,129,248,247,149,148,1,54,188,133,95,55,27,28,63,87,134,254,238,
+192,250,250,100,100,62,62,148,248,212,34,32,88,88,44,253,134,10,25,31,20,
+97,2,86,26,2,141,230,170,100,70,230,254,212,65,20,20,69,246,254,102,58,49,
+49,177,79,200,200,49,89,57,55,100,50,101,174,125,100,100,100,1,154,1,24,127,
+55,106,222,222,47,253,2,232,233,144,192,191,1,117,1,17,92,91,86,87,153,125,
+62,63,70,14,76,130,130,137,78,79,109,108,167,195,138,137,142,143,254,197,
+8,144,108,250,241,117,88,25,25,51,37,67,3,248,70,151,250,250,75,75,100,100,
+133,0,0,1,255,213,254,240,0,43,5,6,0,3,0,0,19,17,35,17,43,86,5,6,249,234,
+6,22,0,1,255,33,254,240,0,223,5,133,0,14,0,0,19,35,17,7,39,55,39,55,23,55,
+23,7,23,7,39,43,86,127,53,168,168,53,170,170,53,168,168,53,127,254,240,5,
+88,127,55,168,166,55,170,170,55,166,168,55,127,0,0,16,0,98,0,86,4,94,4,82,
+0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,
+119,0,127,0,0,1,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,
+53,52,51,50,23,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,
+52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,
+50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,
+20,35,34,53,52,51,50,37,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,39,20,
+35,34,53,52,51,50,3,215,51,55,55,51,147,52,57,57,52,247,55,53,55,53,35,51,
+55,55,51,254,56,54,53,53,54,173,55,53,53,55,2,82,55,53,53,55,253,27,55,54,
+54,55,2,129,51,55,55,51,147,52,57,57,52,253,174,52,57,55,54,35,53,56,56,53,
+1,199,54,53,53,54,254,92,54,55,55,54,247,55,53,53,55,147,55,54,54,55,3,150,
+54,54,55,43,53,53,55,254,211,55,55,53,227,53,53,53,1,148,56,56,53,90,53,53,
+55,253,119,53,53,55,1,185,54,51,58,253,67,53,53,56,154,51,51,55,2,29,55,55,
+53,227,53,53,53,254,4,55,55,54,227,53,53,55,254,213,55,51,55,43,53,53,56,
+0,0,0,0,17,0,210,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,0,94,0,3,0,
+1,4,9,0,2,0,14,0,126,0,3,0,1,4,9,0,3,0,32,0,94,0,3,0,1,4,9,0,4,0,32,0,94,
+0,3,0,1,4,9,0,5,0,30,0,140,0,3,0,1,4,9,0,6,0,28,0,170,0,3,0,1,4,9,0,7,0,68,
+0,198,0,3,0,1,4,9,0,8,0,18,1,10,0,3,0,1,4,9,0,9,0,18,1,10,0,3,0,1,4,9,0,10,
+0,28,1,28,0,3,0,1,4,9,0,11,0,62,1,56,0,3,0,1,4,9,0,12,0,40,1,118,0,3,0,1,
+4,9,0,13,2,150,1,158,0,3,0,1,4,9,0,14,0,52,4,52,0,3,0,1,4,9,0,18,0,20,4,104,
+0,3,0,1,4,9,0,19,0,18,4,124,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,
+0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,
+32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,
+0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,
+0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,75,0,104,0,109,
+0,101,0,114,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,50,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,
+116,0,111,0,83,0,101,0,114,0,105,0,102,0,75,0,104,0,109,0,101,0,114,0,78,
+0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,
+0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,
+0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,68,0,97,0,110,0,104,0,32,0,72,0,111,
+0,110,0,103,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,
+0,101,0,100,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,
+0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,
+0,47,0,47,0,107,0,104,0,109,0,101,0,114,0,116,0,121,0,112,0,101,0,46,0,111,
+0,114,0,103,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,
+0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,
+0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,
+0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,
+70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,
+0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,
+0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,
+0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,
+0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,
+0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,
+0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,
+0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,
+0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,
+76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,
+0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,
+0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,
+0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,
+0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,
+0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,
+0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,
+0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,
+0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,
+0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,66,0,97,0,
+116,0,116,0,97,0,109,0,98,0,97,0,110,0,103,23,151,23,182,23,159,23,182,23,
+129,23,210,23,152,23,194,23,154,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,95,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,
+0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,
+0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,94,0,95,0,96,0,97,
+1,2,0,169,1,3,0,170,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,
+1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,
+1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,
+1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,
+1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,
+1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,
+1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,
+1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,
+117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,
+1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,
+142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,
+1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,
+167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,
+1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,
+192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,
+1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,
+217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,
+1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,
+242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,
+1,215,1,255,2,0,2,1,2,2,2,3,2,4,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,
+17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,
+2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,
+2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,6,2,7,2,8,4,122,119,115,112,7,117,
+110,105,48,48,65,68,7,117,110,105,49,55,56,48,7,117,110,105,49,55,56,49,7,
+117,110,105,49,55,56,50,7,117,110,105,49,55,56,51,7,117,110,105,49,55,56,
+52,7,117,110,105,49,55,56,53,7,117,110,105,49,55,56,54,7,117,110,105,49,55,
+56,55,7,117,110,105,49,55,56,56,7,117,110,105,49,55,56,57,7,117,110,105,49,
+55,56,65,7,117,110,105,49,55,56,66,7,117,110,105,49,55,56,67,7,117,110,105,
+49,55,56,68,7,117,110,105,49,55,56,69,7,117,110,105,49,55,56,70,7,117,110,
+105,49,55,57,48,7,117,110,105,49,55,57,49,7,117,110,105,49,55,57,50,7,117,
+110,105,49,55,57,51,7,117,110,105,49,55,57,52,7,117,110,105,49,55,57,53,7,
+117,110,105,49,55,57,54,7,117,110,105,49,55,57,55,7,117,110,105,49,55,57,
+56,7,117,110,105,49,55,57,57,7,117,110,105,49,55,57,65,7,117,110,105,49,55,
+57,66,7,117,110,105,49,55,57,67,7,117,110,105,49,55,57,68,7,117,110,105,49,
+55,57,69,7,117,110,105,49,55,57,70,7,117,110,105,49,55,65,48,7,117,110,105,
+49,55,65,49,7,117,110,105,49,55,65,50,7,117,110,105,49,55,65,51,7,117,110,
+105,49,55,65,52,7,117,110,105,49,55,65,53,7,117,110,105,49,55,65,54,7,117,
+110,105,49,55,65,55,7,117,110,105,49,55,65,56,7,117,110,105,49,55,65,57,7,
+117,110,105,49,55,65,65,7,117,110,105,49,55,65,66,7,117,110,105,49,55,65,
+67,7,117,110,105,49,55,65,68,7,117,110,105,49,55,65,69,7,117,110,105,49,55,
+65,70,7,117,110,105,49,55,66,48,7,117,110,105,49,55,66,49,7,117,110,105,49,
+55,66,50,7,117,110,105,49,55,66,51,7,117,110,105,49,55,66,54,7,117,110,105,
+49,55,66,55,7,117,110,105,49,55,66,56,7,117,110,105,49,55,66,57,7,117,110,
+105,49,55,66,65,7,117,110,105,49,55,66,66,7,117,110,105,49,55,66,67,7,117,
+110,105,49,55,66,68,7,117,110,105,49,55,66,69,7,117,110,105,49,55,66,70,7,
+117,110,105,49,55,67,48,7,117,110,105,49,55,67,49,7,117,110,105,49,55,67,
+50,7,117,110,105,49,55,67,51,7,117,110,105,49,55,67,52,7,117,110,105,49,55,
+67,53,7,117,110,105,49,55,67,54,7,117,110,105,49,55,67,55,7,117,110,105,49,
+55,67,56,7,117,110,105,49,55,67,57,7,117,110,105,49,55,67,65,7,117,110,105,
+49,55,67,66,7,117,110,105,49,55,67,67,7,117,110,105,49,55,67,68,7,117,110,
+105,49,55,67,69,7,117,110,105,49,55,67,70,7,117,110,105,49,55,68,48,7,117,
+110,105,49,55,68,49,7,117,110,105,49,55,68,50,7,117,110,105,49,55,68,51,7,
+117,110,105,49,55,68,52,7,117,110,105,49,55,68,53,7,117,110,105,49,55,68,
+54,7,117,110,105,49,55,68,55,7,117,110,105,49,55,68,56,7,117,110,105,49,55,
+68,57,7,117,110,105,49,55,68,65,7,117,110,105,49,55,68,66,7,117,110,105,49,
+55,69,48,7,117,110,105,49,55,69,49,7,117,110,105,49,55,69,50,7,117,110,105,
+49,55,69,51,7,117,110,105,49,55,69,52,7,117,110,105,49,55,69,53,7,117,110,
+105,49,55,69,54,7,117,110,105,49,55,69,55,7,117,110,105,49,55,69,56,7,117,
+110,105,49,55,69,57,11,117,110,105,49,55,68,50,49,55,56,48,11,117,110,105,
+49,55,68,50,49,55,56,49,11,117,110,105,49,55,68,50,49,55,56,50,11,117,110,
+105,49,55,68,50,49,55,56,51,11,117,110,105,49,55,68,50,49,55,56,52,11,117,
+110,105,49,55,68,50,49,55,56,53,11,117,110,105,49,55,68,50,49,55,56,54,11,
+117,110,105,49,55,68,50,49,55,56,55,11,117,110,105,49,55,68,50,49,55,56,56,
+11,117,110,105,49,55,68,50,49,55,56,57,13,117,110,105,49,55,68,50,49,55,56,
+57,46,97,11,117,110,105,49,55,68,50,49,55,56,65,11,117,110,105,49,55,68,50,
+49,55,56,66,11,117,110,105,49,55,68,50,49,55,56,67,11,117,110,105,49,55,68,
+50,49,55,56,68,11,117,110,105,49,55,68,50,49,55,56,69,11,117,110,105,49,55,
+68,50,49,55,56,70,11,117,110,105,49,55,68,50,49,55,57,48,11,117,110,105,49,
+55,68,50,49,55,57,49,11,117,110,105,49,55,68,50,49,55,57,50,11,117,110,105,
+49,55,68,50,49,55,57,51,11,117,110,105,49,55,68,50,49,55,57,52,11,117,110,
+105,49,55,68,50,49,55,57,53,11,117,110,105,49,55,68,50,49,55,57,54,11,117,
+110,105,49,55,68,50,49,55,57,55,11,117,110,105,49,55,68,50,49,55,57,56,11,
+117,110,105,49,55,68,50,49,55,57,57,11,117,110,105,49,55,68,50,49,55,57,65,
+11,117,110,105,49,55,68,50,49,55,57,66,11,117,110,105,49,55,68,50,49,55,57,
+67,11,117,110,105,49,55,68,50,49,55,57,70,11,117,110,105,49,55,68,50,49,55,
+65,48,11,117,110,105,49,55,68,50,49,55,65,50,9,117,110,105,49,55,66,66,46,
+98,9,117,110,105,49,55,66,67,46,98,9,117,110,105,49,55,66,68,46,98,9,117,
+110,105,49,55,66,55,46,97,9,117,110,105,49,55,66,56,46,97,9,117,110,105,49,
+55,66,57,46,97,9,117,110,105,49,55,66,65,46,97,9,117,110,105,49,55,67,54,
+46,97,9,117,110,105,49,55,67,69,46,97,9,117,110,105,49,55,68,48,46,97,9,117,
+110,105,49,55,56,57,46,97,10,117,110,105,49,55,57,52,46,97,50,13,117,110,
+105,49,55,68,50,49,55,57,65,46,98,11,117,110,105,49,55,66,55,49,55,67,68,
+9,117,110,105,49,55,66,70,46,98,9,117,110,105,49,55,67,48,46,98,9,117,110,
+105,49,55,66,55,46,114,9,117,110,105,49,55,66,56,46,114,9,117,110,105,49,
+55,66,57,46,114,9,117,110,105,49,55,66,65,46,114,9,117,110,105,49,55,67,54,
+46,114,9,117,110,105,49,55,67,57,46,114,9,117,110,105,49,55,67,68,46,114,
+13,117,110,105,49,55,66,55,49,55,67,68,46,114,13,117,110,105,49,55,68,50,
+49,55,56,65,46,110,13,117,110,105,49,55,68,50,49,55,56,66,46,110,13,117,110,
+105,49,55,68,50,49,55,56,67,46,110,13,117,110,105,49,55,68,50,49,55,65,48,
+46,110,13,117,110,105,49,55,68,50,49,55,56,65,46,114,13,117,110,105,49,55,
+68,50,49,55,57,55,46,114,13,117,110,105,49,55,68,50,49,55,57,56,46,114,9,
+117,110,105,49,55,66,66,46,110,9,117,110,105,49,55,66,67,46,110,9,117,110,
+105,49,55,66,68,46,110,10,117,110,105,49,55,66,66,46,110,50,10,117,110,105,
+49,55,66,67,46,110,50,10,117,110,105,49,55,66,68,46,110,50,13,117,110,105,
+49,55,68,50,49,55,57,56,46,98,13,117,110,105,49,55,68,50,49,55,65,48,46,98,
+12,117,110,105,49,55,56,48,95,49,55,66,54,12,117,110,105,49,55,56,49,95,49,
+55,66,54,12,117,110,105,49,55,56,50,95,49,55,66,54,12,117,110,105,49,55,56,
+51,95,49,55,66,54,12,117,110,105,49,55,56,52,95,49,55,66,54,12,117,110,105,
+49,55,56,53,95,49,55,66,54,12,117,110,105,49,55,56,54,95,49,55,66,54,12,117,
+110,105,49,55,56,55,95,49,55,66,54,12,117,110,105,49,55,56,56,95,49,55,66,
+54,12,117,110,105,49,55,56,57,95,49,55,66,54,12,117,110,105,49,55,56,65,95,
+49,55,66,54,12,117,110,105,49,55,56,66,95,49,55,66,54,12,117,110,105,49,55,
+56,67,95,49,55,66,54,12,117,110,105,49,55,56,68,95,49,55,66,54,12,117,110,
+105,49,55,56,69,95,49,55,66,54,12,117,110,105,49,55,56,70,95,49,55,66,54,
+12,117,110,105,49,55,57,48,95,49,55,66,54,12,117,110,105,49,55,57,49,95,49,
+55,66,54,12,117,110,105,49,55,57,50,95,49,55,66,54,12,117,110,105,49,55,57,
+51,95,49,55,66,54,12,117,110,105,49,55,57,52,95,49,55,66,54,12,117,110,105,
+49,55,57,53,95,49,55,66,54,12,117,110,105,49,55,57,54,95,49,55,66,54,12,117,
+110,105,49,55,57,55,95,49,55,66,54,12,117,110,105,49,55,57,56,95,49,55,66,
+54,12,117,110,105,49,55,57,57,95,49,55,66,54,12,117,110,105,49,55,57,65,95,
+49,55,66,54,12,117,110,105,49,55,57,66,95,49,55,66,54,12,117,110,105,49,55,
+57,67,95,49,55,66,54,12,117,110,105,49,55,57,70,95,49,55,66,54,12,117,110,
+105,49,55,65,48,95,49,55,66,54,12,117,110,105,49,55,65,49,95,49,55,66,54,
+12,117,110,105,49,55,65,50,95,49,55,66,54,17,117,110,105,49,55,68,50,95,49,
+55,56,51,95,49,55,66,54,17,117,110,105,49,55,68,50,95,49,55,56,56,95,49,55,
+66,54,17,117,110,105,49,55,68,50,95,49,55,56,68,95,49,55,66,54,17,117,110,
+105,49,55,68,50,95,49,55,57,52,95,49,55,66,54,17,117,110,105,49,55,68,50,
+95,49,55,57,57,95,49,55,66,54,17,117,110,105,49,55,68,50,95,49,55,57,70,95,
+49,55,66,54,16,117,110,105,49,55,56,57,95,49,55,66,54,46,97,108,116,12,117,
+110,105,49,55,56,48,95,49,55,67,53,12,117,110,105,49,55,56,49,95,49,55,67,
+53,12,117,110,105,49,55,56,50,95,49,55,67,53,12,117,110,105,49,55,56,51,95,
+49,55,67,53,12,117,110,105,49,55,56,52,95,49,55,67,53,12,117,110,105,49,55,
+56,53,95,49,55,67,53,12,117,110,105,49,55,56,54,95,49,55,67,53,12,117,110,
+105,49,55,56,55,95,49,55,67,53,12,117,110,105,49,55,56,56,95,49,55,67,53,
+12,117,110,105,49,55,56,57,95,49,55,67,53,12,117,110,105,49,55,56,65,95,49,
+55,67,53,12,117,110,105,49,55,56,66,95,49,55,67,53,12,117,110,105,49,55,56,
+67,95,49,55,67,53,12,117,110,105,49,55,56,68,95,49,55,67,53,12,117,110,105,
+49,55,56,69,95,49,55,67,53,12,117,110,105,49,55,56,70,95,49,55,67,53,12,117,
+110,105,49,55,57,48,95,49,55,67,53,12,117,110,105,49,55,57,49,95,49,55,67,
+53,12,117,110,105,49,55,57,50,95,49,55,67,53,12,117,110,105,49,55,57,51,95,
+49,55,67,53,12,117,110,105,49,55,57,52,95,49,55,67,53,12,117,110,105,49,55,
+57,53,95,49,55,67,53,12,117,110,105,49,55,57,54,95,49,55,67,53,12,117,110,
+105,49,55,57,55,95,49,55,67,53,12,117,110,105,49,55,57,56,95,49,55,67,53,
+12,117,110,105,49,55,57,57,95,49,55,67,53,12,117,110,105,49,55,57,65,95,49,
+55,67,53,12,117,110,105,49,55,57,66,95,49,55,67,53,12,117,110,105,49,55,57,
+67,95,49,55,67,53,12,117,110,105,49,55,57,70,95,49,55,67,53,12,117,110,105,
+49,55,65,48,95,49,55,67,53,12,117,110,105,49,55,65,49,95,49,55,67,53,12,117,
+110,105,49,55,65,50,95,49,55,67,53,17,117,110,105,49,55,68,50,95,49,55,56,
+51,95,49,55,67,53,17,117,110,105,49,55,68,50,95,49,55,56,56,95,49,55,67,53,
+17,117,110,105,49,55,68,50,95,49,55,56,68,95,49,55,67,53,17,117,110,105,49,
+55,68,50,95,49,55,57,52,95,49,55,67,53,17,117,110,105,49,55,68,50,95,49,55,
+57,57,95,49,55,67,53,17,117,110,105,49,55,68,50,95,49,55,57,70,95,49,55,67,
+53,19,117,110,105,49,55,56,57,49,55,67,57,49,55,66,54,49,55,67,54,19,117,
+110,105,49,55,57,57,49,55,67,57,49,55,66,54,49,55,67,54,19,117,110,105,49,
+55,57,65,49,55,67,57,49,55,66,54,49,55,67,54,13,117,110,105,49,55,66,70,46,
+114,105,103,104,116,13,117,110,105,49,55,67,48,46,114,105,103,104,116,13,
+117,110,105,49,55,67,53,46,114,105,103,104,116,0,7,117,110,105,50,48,48,67,
+7,117,110,105,50,48,48,68,7,117,110,105,50,53,67,67,7,117,110,105,49,55,66,
+52,7,117,110,105,49,55,66,53,7,117,110,105,49,55,68,67,7,117,110,105,49,55,
+68,68,7,117,110,105,49,55,70,48,7,117,110,105,49,55,70,49,7,117,110,105,49,
+55,70,50,7,117,110,105,49,55,70,51,7,117,110,105,49,55,70,52,7,117,110,105,
+49,55,70,53,7,117,110,105,49,55,70,54,7,117,110,105,49,55,70,55,7,117,110,
+105,49,55,70,56,7,117,110,105,49,55,70,57,7,117,110,105,49,57,69,48,7,117,
+110,105,49,57,69,49,7,117,110,105,49,57,69,50,7,117,110,105,49,57,69,51,7,
+117,110,105,49,57,69,52,7,117,110,105,49,57,69,53,7,117,110,105,49,57,69,
+54,7,117,110,105,49,57,69,55,7,117,110,105,49,57,69,56,7,117,110,105,49,57,
+69,57,7,117,110,105,49,57,69,65,7,117,110,105,49,57,69,66,7,117,110,105,49,
+57,69,67,7,117,110,105,49,57,69,68,7,117,110,105,49,57,69,69,7,117,110,105,
+49,57,69,70,7,117,110,105,49,57,70,48,7,117,110,105,49,57,70,49,7,117,110,
+105,49,57,70,50,7,117,110,105,49,57,70,51,7,117,110,105,49,57,70,52,7,117,
+110,105,49,57,70,53,7,117,110,105,49,57,70,54,7,117,110,105,49,57,70,55,7,
+117,110,105,49,57,70,56,7,117,110,105,49,57,70,57,7,117,110,105,49,57,70,
+65,7,117,110,105,49,57,70,66,7,117,110,105,49,57,70,67,7,117,110,105,49,57,
+70,68,7,117,110,105,49,57,70,69,7,117,110,105,49,57,70,70,0,0,0,0,0,0,2,0,
+5,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,0,0,2,0,1,0,0,1,45,0,1,0,0,0,1,0,
+0,0,10,0,10,0,10,0,0,0,1,0,0,0,10,0,38,0,154,0,1,107,104,109,114,0,8,0,4,
+0,0,0,0,255,255,0,5,0,0,0,1,0,2,0,4,0,3,0,5,97,98,118,115,0,32,98,108,119,
+102,0,40,99,108,105,103,0,70,112,114,101,102,0,98,112,115,116,102,0,106,0,
+0,0,2,0,9,0,16,0,0,0,13,0,0,0,4,0,6,0,11,0,13,0,14,0,15,0,17,0,18,0,19,0,
+20,0,21,0,22,0,0,0,12,0,3,0,4,0,5,0,6,0,7,0,8,0,12,0,13,0,14,0,15,0,21,0,
+22,0,0,0,2,0,2,0,8,0,0,0,3,0,1,0,7,0,10,0,41,0,84,1,46,1,112,1,144,1,190,
+2,18,2,202,3,56,3,190,3,252,4,28,4,94,4,200,4,226,4,254,5,170,6,38,7,54,7,
+80,7,112,7,138,7,196,7,254,8,224,8,244,9,8,9,90,9,194,9,214,9,236,10,0,10,
+46,10,72,10,98,10,112,10,162,10,200,10,224,10,248,11,26,11,52,0,4,0,0,0,1,
+0,8,0,1,1,46,0,1,0,8,0,25,0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,94,0,100,0,
+106,0,112,0,118,0,124,0,130,0,136,0,142,0,148,0,154,0,160,0,166,0,172,0,178,
+0,184,0,190,0,196,0,144,0,2,0,44,0,145,0,2,0,45,0,146,0,2,0,46,0,148,0,2,
+0,48,0,149,0,2,0,49,0,150,0,2,0,50,0,151,0,2,0,51,0,153,0,2,0,53,0,155,0,
+2,0,54,0,156,0,2,0,55,0,157,0,2,0,56,0,159,0,2,0,58,0,160,0,2,0,59,0,161,
+0,2,0,60,0,162,0,2,0,61,0,163,0,2,0,62,0,164,0,2,0,63,0,166,0,2,0,65,0,167,
+0,2,0,66,0,168,0,2,0,67,0,169,0,2,0,68,0,172,0,2,0,71,0,173,0,2,0,72,0,175,
+0,2,0,76,0,176,0,2,0,78,0,4,0,0,0,1,0,8,0,1,0,84,0,1,0,8,0,6,0,14,0,20,0,
+26,0,32,0,38,0,44,0,147,0,2,0,47,0,152,0,2,0,52,0,158,0,2,0,57,0,165,0,2,
+0,64,0,170,0,2,0,69,0,174,0,2,0,75,0,4,0,0,0,1,0,8,0,1,0,18,0,1,0,8,0,1,0,
+4,0,171,0,2,0,70,0,1,0,1,0,124,0,6,0,0,0,2,0,10,0,28,0,3,0,0,0,1,7,84,0,1,
+6,156,0,1,0,0,0,23,0,3,0,0,0,1,7,66,0,1,4,50,0,1,0,0,0,23,0,6,0,0,0,3,0,12,
+0,36,0,60,0,3,0,1,0,18,0,1,7,56,0,0,0,1,0,0,0,24,0,1,0,1,0,187,0,3,0,1,0,
+18,0,1,7,32,0,0,0,1,0,0,0,24,0,1,0,1,0,255,0,3,0,1,0,18,0,1,7,8,0,0,0,1,0,
+0,0,24,0,1,0,1,1,39,0,6,0,0,0,8,0,22,0,40,0,58,0,78,0,98,0,118,0,138,0,158,
+0,3,0,0,0,1,7,132,0,1,3,118,0,1,0,0,0,25,0,3,0,0,0,1,7,114,0,1,0,138,0,1,
+0,0,0,25,0,3,0,0,0,1,7,96,0,2,0,178,3,82,0,1,0,0,0,25,0,3,0,0,0,1,7,76,0,
+2,0,158,0,100,0,1,0,0,0,25,0,3,0,0,0,1,7,56,0,2,5,194,3,42,0,1,0,0,0,25,0,
+3,0,0,0,1,7,36,0,2,5,174,0,60,0,1,0,0,0,25,0,3,0,0,0,1,7,16,0,2,6,40,3,2,
+0,1,0,0,0,25,0,3,0,0,0,1,6,252,0,2,6,20,0,20,0,1,0,0,0,25,0,1,0,1,0,110,0,
+6,0,0,0,4,0,14,0,32,0,64,0,84,0,3,0,0,0,1,6,212,0,1,0,90,0,1,0,0,0,26,0,3,
+0,0,0,1,6,194,0,2,0,20,0,72,0,1,0,0,0,26,0,1,0,4,0,115,0,116,0,118,0,198,
+0,3,0,0,0,1,6,162,0,2,5,44,0,40,0,1,0,0,0,26,0,3,0,0,0,1,6,142,0,2,5,166,
+0,20,0,1,0,0,0,26,0,1,0,1,0,111,0,4,0,0,0,1,0,8,0,1,2,158,0,6,0,18,0,36,0,
+54,0,72,0,90,0,108,0,2,0,6,0,12,0,249,0,2,0,96,1,33,0,2,0,111,0,2,0,6,0,12,
+0,250,0,2,0,96,1,34,0,2,0,111,0,2,0,6,0,12,0,251,0,2,0,96,1,35,0,2,0,111,
+0,2,0,6,0,12,0,252,0,2,0,96,1,36,0,2,0,111,0,2,0,6,0,12,0,253,0,2,0,96,1,
+37,0,2,0,111,0,2,0,6,0,12,0,254,0,2,0,96,1,38,0,2,0,111,0,6,0,0,0,1,0,8,0,
+3,0,0,0,1,6,10,0,2,0,20,4,112,0,1,0,0,0,27,0,2,0,5,0,44,0,46,0,0,0,48,0,51,
+0,3,0,54,0,56,0,7,0,59,0,68,0,10,0,78,0,78,0,20,0,4,0,0,0,1,0,8,0,1,0,18,
+0,1,0,8,0,1,0,4,0,190,0,2,0,119,0,1,0,1,0,97,0,6,0,0,0,3,0,12,0,30,0,48,0,
+3,0,1,4,14,0,1,5,188,0,0,0,1,0,0,0,28,0,3,0,1,4,180,0,1,5,170,0,0,0,1,0,0,
+0,28,0,3,0,1,1,146,0,1,5,152,0,0,0,1,0,0,0,28,0,6,0,0,0,4,0,14,0,34,0,60,
+0,80,0,3,0,1,0,86,0,1,5,142,0,1,0,182,0,1,0,0,0,29,0,3,0,1,0,20,0,1,5,122,
+0,1,0,162,0,1,0,0,0,29,0,1,0,1,0,76,0,3,0,0,0,1,5,96,0,2,1,4,1,10,0,1,0,0,
+0,29,0,3,0,1,0,20,0,1,5,76,0,1,0,172,0,1,0,0,0,29,0,1,0,1,0,75,0,6,0,0,0,
+1,0,8,0,3,0,1,5,42,0,1,5,76,0,0,0,1,0,0,0,30,0,6,0,0,0,1,0,8,0,3,0,1,0,244,
+0,1,5,86,0,1,0,56,0,1,0,0,0,31,0,6,0,0,0,6,0,18,0,46,0,74,0,98,0,116,0,140,
+0,3,0,0,0,1,5,74,0,1,0,18,0,1,0,0,0,32,0,2,0,1,0,97,0,100,0,0,0,3,0,0,0,1,
+5,46,0,1,0,18,0,1,0,0,0,32,0,2,0,1,0,180,0,183,0,0,0,3,0,0,0,1,5,18,0,1,0,
+18,0,1,0,0,0,32,0,1,0,1,0,104,0,3,0,0,0,1,4,250,0,1,0,68,0,1,0,0,0,32,0,3,
+0,0,0,1,4,232,0,1,0,18,0,1,0,0,0,32,0,1,0,1,0,122,0,3,0,0,0,1,4,208,0,2,0,
+20,0,26,0,1,0,0,0,32,0,1,0,1,0,96,0,1,0,1,0,112,0,6,0,0,0,5,0,16,0,34,0,68,
+0,86,0,106,0,3,0,1,2,124,0,1,5,28,0,0,0,1,0,0,0,33,0,3,0,1,0,18,0,1,5,10,
+0,0,0,1,0,0,0,33,0,1,0,6,0,147,0,152,0,158,0,165,0,170,0,174,0,3,0,1,3,0,
+0,1,4,232,0,0,0,1,0,0,0,33,0,3,0,2,2,150,2,238,0,1,4,214,0,0,0,1,0,0,0,33,
+0,3,0,1,1,228,0,1,4,194,0,0,0,1,0,0,0,33,0,6,0,0,0,11,0,28,0,46,0,70,0,94,
+0,114,0,132,0,156,0,180,0,200,0,224,0,248,0,3,0,1,1,100,0,1,4,76,0,0,0,1,
+0,0,0,34,0,3,0,1,0,18,0,1,4,58,0,0,0,1,0,0,0,34,0,1,0,1,0,242,0,3,0,1,0,18,
+0,1,4,34,0,0,0,1,0,0,0,34,0,1,0,1,1,26,0,3,0,2,2,64,1,34,0,1,4,10,0,0,0,1,
+0,0,0,34,0,3,0,1,1,38,0,1,3,246,0,0,0,1,0,0,0,34,0,3,0,1,0,18,0,1,3,228,0,
+0,0,1,0,0,0,34,0,1,0,1,0,244,0,3,0,1,0,18,0,1,3,204,0,0,0,1,0,0,0,34,0,1,
+0,1,1,28,0,3,0,2,1,234,0,228,0,1,3,180,0,0,0,1,0,0,0,34,0,3,0,1,0,18,0,1,
+3,160,0,0,0,1,0,0,0,34,0,1,0,1,0,205,0,3,0,1,0,18,0,1,3,136,0,0,0,1,0,0,0,
+34,0,1,0,1,0,206,0,3,0,1,0,18,0,1,3,112,0,0,0,1,0,0,0,34,0,1,0,1,0,207,0,
+6,0,0,0,1,0,8,0,3,0,1,0,44,0,1,3,124,0,0,0,1,0,0,0,35,0,6,0,0,0,1,0,8,0,3,
+0,1,0,18,0,1,3,126,0,0,0,1,0,0,0,36,0,1,0,1,0,58,0,6,0,0,0,1,0,8,0,3,0,1,
+1,0,0,1,3,118,0,0,0,1,0,0,0,37,0,6,0,0,0,2,0,10,0,34,0,3,0,1,0,18,0,1,3,122,
+0,0,0,1,0,0,0,38,0,1,0,1,0,70,0,3,0,1,0,18,0,1,3,98,0,0,0,1,0,0,0,38,0,1,
+0,1,0,72,0,6,0,0,0,2,0,10,0,34,0,3,0,1,0,18,0,1,3,94,0,0,0,1,0,0,0,39,0,1,
+0,1,0,174,0,3,0,1,0,18,0,1,3,70,0,0,0,1,0,0,0,39,0,1,0,1,0,77,0,6,0,0,0,6,
+0,18,0,36,0,102,0,132,0,158,0,178,0,3,0,1,0,186,0,1,3,56,0,0,0,1,0,0,0,40,
+0,3,0,2,0,20,0,168,0,1,3,38,0,0,0,1,0,0,0,40,0,2,0,7,0,144,0,146,0,0,0,148,
+0,151,0,3,0,153,0,157,0,7,0,159,0,164,0,12,0,166,0,169,0,18,0,172,0,173,0,
+22,0,175,0,176,0,24,0,3,0,2,0,20,0,102,0,1,2,228,0,0,0,1,0,0,0,40,0,2,0,1,
+0,201,0,204,0,0,0,3,0,2,0,20,0,72,0,1,2,198,0,0,0,1,0,0,0,40,0,1,0,1,0,115,
+0,3,0,2,1,94,0,46,0,1,2,172,0,0,0,1,0,0,0,40,0,3,0,2,0,20,0,26,0,1,2,152,
+0,0,0,1,0,0,0,40,0,1,0,1,0,101,0,2,0,3,0,216,0,248,0,0,0,255,1,32,0,33,1,
+39,1,39,0,67,0,1,0,0,0,1,0,8,0,1,0,6,0,134,0,1,0,1,0,53,0,1,0,0,0,1,0,8,0,
+1,0,6,0,1,0,1,0,1,0,153,0,1,0,0,0,1,0,8,0,2,0,156,0,34,0,216,0,217,0,218,
+0,219,0,220,0,221,0,222,0,223,0,224,0,225,0,226,0,227,0,228,0,229,0,230,0,
+231,0,232,0,233,0,234,0,235,0,236,0,237,0,238,0,239,0,240,0,241,0,242,0,243,
+0,244,0,245,0,246,0,247,0,248,0,255,0,1,0,0,0,1,0,8,0,2,0,74,0,34,1,0,1,1,
+1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,
+18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,
+1,39,0,2,0,3,0,44,0,72,0,0,0,75,0,78,0,29,0,187,0,187,0,33,0,1,0,0,0,1,0,
+8,0,1,0,6,0,18,0,1,0,1,0,171,0,1,0,0,0,1,0,8,0,1,0,6,0,86,0,1,0,2,0,105,0,
+106,0,1,0,0,0,1,0,8,0,1,0,6,255,241,0,1,0,1,0,116,0,1,0,0,0,1,0,8,0,2,0,20,
+0,7,0,180,0,181,0,182,0,183,0,181,0,184,0,186,0,1,0,7,0,97,0,98,0,99,0,100,
+0,104,0,112,0,122,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,177,0,177,0,1,0,2,0,115,
+0,116,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,101,0,101,0,1,0,2,0,115,0,198,0,1,0,
+0,0,1,0,8,0,1,0,108,0,76,0,1,0,0,0,1,0,8,0,2,0,22,0,8,0,193,0,194,0,195,0,
+196,0,197,0,198,0,199,0,200,0,1,0,8,0,97,0,98,0,99,0,100,0,112,0,115,0,119,
+0,190,0,1,0,0,0,1,0,8,0,2,0,16,0,5,0,201,0,202,0,203,0,201,0,204,0,1,0,5,
+0,155,0,156,0,157,0,160,0,175,0,1,0,0,0,1,0,8,0,1,0,6,0,107,0,1,0,3,0,101,
+0,102,0,103,0,1,0,0,0,1,0,8,0,1,0,6,0,34,0,1,0,3,0,177,0,178,0,179,0,1,0,
+0,0,1,0,8,0,2,0,14,0,4,0,205,0,205,0,206,0,207,0,1,0,4,0,155,0,160,0,168,
+0,169,0,1,0,0,0,1,0,8,0,2,0,10,0,2,0,214,0,215,0,1,0,2,0,169,0,175,0,1,0,
+0,0,1,0,8,0,2,0,12,0,3,0,188,0,188,0,188,0,1,0,3,0,96,0,110,0,111,0,2,0,0,
+0,0,0,1,0,31,255,255,0,0,40,192,0,0,0,43,0,0,0,24,0,1,0,0,0,0,0,1,255,255,
+255,255,0,1,0,1,0,0,0,0,255,255,255,254,0,2,0,4,0,0,0,2,255,255,255,255,0,
+2,0,5,0,0,0,0,255,255,255,253,0,3,0,4,0,0,0,128,255,255,255,255,0,3,0,5,0,
+0,0,0,255,255,255,127,0,8,0,1,0,0,0,16,255,255,255,255,0,8,0,2,0,0,0,0,255,
+255,255,239,0,8,0,4,0,0,0,32,255,255,255,255,0,8,0,5,0,0,0,0,255,255,255,
+223,0,9,0,4,0,0,0,64,255,255,255,255,0,9,0,5,0,0,0,0,255,255,255,191,0,10,
+0,4,0,0,1,0,255,255,255,255,0,10,0,5,0,0,0,0,255,255,254,255,0,11,0,0,0,2,
+0,0,255,255,255,255,0,11,0,1,0,0,0,0,255,253,255,255,0,11,0,4,0,0,4,0,255,
+255,255,255,0,11,0,5,0,0,0,0,255,255,251,255,0,12,0,4,0,0,8,0,255,255,255,
+255,0,12,0,5,0,0,0,0,255,255,247,255,0,13,0,4,0,0,32,0,255,255,255,255,0,
+13,0,5,0,0,0,0,255,255,223,255,0,14,0,4,0,16,0,0,255,255,255,255,0,14,0,5,
+0,0,0,0,255,239,255,255,0,15,0,4,0,0,16,0,255,255,255,255,0,15,0,5,0,0,0,
+0,255,255,239,255,0,16,0,4,0,0,64,0,255,255,255,255,0,16,0,5,0,0,0,0,255,
+255,191,255,0,17,0,4,0,0,128,0,255,255,255,255,0,17,0,5,0,0,0,0,255,255,127,
+255,0,18,0,1,0,0,2,0,255,255,255,255,0,18,0,2,0,0,0,0,255,255,253,255,0,18,
+0,4,0,1,0,0,255,255,255,255,0,18,0,5,0,0,0,0,255,254,255,255,0,28,0,1,0,8,
+0,0,255,255,255,255,0,28,0,2,0,0,0,0,255,247,255,255,0,64,0,1,0,0,0,8,255,
+255,255,255,0,64,0,2,0,0,0,0,255,255,255,247,0,65,0,1,0,4,0,0,255,255,255,
+255,0,65,0,2,0,0,0,0,255,251,255,255,62,128,0,0,0,0,0,4,255,255,255,255,62,
+128,0,1,0,0,0,0,255,255,255,251,0,0,0,1,0,0,0,0,0,0,0,0,0,0,3,100,32,0,0,
+2,0,0,0,1,0,0,0,39,0,0,0,28,0,0,0,152,0,0,1,208,0,0,2,186,0,0,2,202,0,0,3,
+22,0,4,0,6,0,7,0,24,0,2,0,18,0,72,0,44,0,54,0,76,0,75,0,112,0,78,0,78,0,116,
+0,97,0,97,0,118,0,119,0,119,0,120,0,124,0,124,0,122,255,255,255,255,0,124,
+0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,
+22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,
+0,37,0,38,0,4,0,5,0,6,0,0,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,4,0,1,0,1,0,5,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,6,0,1,0,1,0,1,0,1,
+0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,
+22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,
+0,37,0,38,0,0,0,0,0,0,0,0,64,0,0,0,0,2,128,0,0,0,0,3,128,0,0,0,0,2,0,0,0,
+0,0,0,160,0,0,0,0,3,0,0,0,0,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,
+160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,
+0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,
+2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,
+0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,
+0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,2,0,0,160,0,0,
+2,0,0,160,0,0,2,0,0,160,0,0,2,63,255,255,137,191,255,255,160,63,255,255,214,
+191,255,255,169,0,0,0,0,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,
+0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,
+0,27,0,28,0,0,0,0,0,29,0,30,0,0,0,31,0,1,0,190,0,144,0,145,0,146,0,147,0,
+148,0,149,0,150,0,151,0,152,0,153,0,155,0,156,0,157,0,158,0,159,0,160,0,161,
+0,162,0,163,0,164,0,165,0,166,0,167,0,168,0,169,0,170,0,171,0,172,0,173,0,
+174,0,175,0,176,0,0,0,148,32,0,0,1,0,0,0,2,0,0,0,6,0,0,0,20,0,0,0,62,0,0,
+0,98,0,0,0,122,0,2,0,6,0,5,0,24,0,2,0,6,0,152,0,144,0,4,0,170,0,155,0,4,0,
+171,0,171,0,5,0,176,0,172,0,4,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,255,255,255,0,
+2,0,0,255,255,255,255,0,0,0,0,255,255,0,0,0,0,0,4,0,8,0,171,0,1,0,189,0,0,
+0,0,0,216,32,0,0,5,0,0,0,4,0,0,0,12,0,0,0,20,0,0,0,68,0,0,0,116,0,0,0,188,
+0,6,0,4,0,8,0,32,0,3,0,0,0,104,0,4,0,105,0,5,0,106,0,6,0,110,0,7,0,111,0,
+8,0,181,0,9,0,191,0,10,0,192,0,11,255,255,255,255,0,0,0,0,0,0,0,0,0,1,0,2,
+0,3,0,4,0,5,0,6,0,7,0,8,0,0,0,0,0,0,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,
+0,0,0,255,255,255,255,0,0,32,32,0,0,255,255,0,0,32,32,0,1,255,255,0,0,32,
+32,0,2,255,255,0,0,32,32,0,3,255,255,0,0,32,32,0,4,255,255,0,0,32,32,0,5,
+255,255,0,0,32,32,0,6,255,255,0,0,32,32,0,7,255,255,0,98,1,43,1,44,0,96,1,
+45,0,181,0,191,0,192,0,0,2,106,32,0,0,4,0,0,0,8,0,0,0,0,0,1,0,2,0,3,0,4,0,
+5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,
+0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,
+0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,
+0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,
+0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,
+0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,
+0,96,0,97,0,98,0,99,0,100,0,101,0,102,0,103,0,107,0,107,0,107,0,107,0,108,
+0,109,0,107,0,107,0,112,0,113,0,114,0,115,0,116,0,117,0,118,0,119,0,120,0,
+121,0,122,0,123,0,124,0,125,0,126,0,127,0,128,0,129,0,130,0,131,0,132,0,133,
+0,134,0,135,0,136,0,137,0,138,0,139,0,140,0,141,0,142,0,143,0,144,0,145,0,
+146,0,147,0,148,0,149,0,150,0,151,0,152,0,153,0,154,0,155,0,156,0,157,0,158,
+0,159,0,160,0,161,0,162,0,163,0,164,0,165,0,166,0,167,0,168,0,169,0,170,0,
+171,0,172,0,173,0,174,0,175,0,176,0,177,0,178,0,179,0,180,0,181,0,182,0,183,
+0,184,0,185,0,186,0,187,0,188,0,189,0,190,0,191,0,192,0,193,0,194,0,195,0,
+196,0,197,0,198,0,199,0,200,0,201,0,202,0,203,0,204,0,205,0,206,0,207,0,208,
+0,209,0,210,0,211,0,212,0,213,0,214,0,215,0,216,0,217,0,218,0,219,0,220,0,
+221,0,222,0,223,0,224,0,225,0,226,0,227,0,228,0,229,0,230,0,231,0,232,0,233,
+0,234,0,235,0,236,0,237,0,238,0,239,0,240,0,241,0,242,0,243,0,244,0,245,0,
+246,0,247,0,248,0,249,0,250,0,251,0,252,0,253,0,254,0,255,1,0,1,1,1,2,1,3,
+1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,
+1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,
+1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,0,0,0,136,32,0,0,0,
+0,0,0,16,0,0,0,7,0,0,0,16,0,0,0,64,0,0,0,106,0,2,0,6,0,6,0,24,0,2,0,12,0,
+78,0,44,0,4,0,109,0,107,0,6,0,116,0,115,0,5,0,176,0,144,0,5,0,189,0,189,0,
+5,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+0,0,0,0,0,0,0,2,0,0,0,1,0,2,0,3,0,0,0,0,0,2,128,0,0,2,0,0,0,0,32,2,0,0,0,
+0,0,140,32,0,0,0,0,0,0,16,0,0,0,7,0,0,0,16,0,0,0,70,0,0,0,112,0,2,0,6,0,7,
+0,24,0,2,0,18,0,78,0,44,0,4,0,116,0,115,0,5,0,170,0,144,0,5,0,171,0,171,0,
+6,0,176,0,172,0,5,0,189,0,189,0,6,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,2,0,3,0,0,0,0,0,
+2,128,0,0,2,0,0,0,0,32,2,0,0,1,220,32,0,0,1,0,0,0,32,0,0,0,13,0,0,0,20,0,
+0,0,122,0,0,1,48,0,0,1,144,0,2,0,6,0,15,0,48,0,3,0,42,0,48,0,48,0,4,0,76,
+0,75,0,4,0,96,0,96,0,12,0,100,0,97,0,7,0,103,0,101,0,8,0,111,0,104,0,12,0,
+112,0,112,0,10,0,114,0,113,0,12,0,116,0,116,0,5,0,117,0,117,0,10,0,118,0,
+118,0,11,0,122,0,119,0,10,0,125,0,125,0,9,0,176,0,144,0,6,255,255,255,255,
+0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,7,0,6,0,9,0,0,
+0,10,0,10,0,9,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,3,0,9,0,4,0,3,0,0,0,9,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,0,5,0,0,0,0,0,5,0,0,0,9,0,0,0,0,0,7,0,0,0,1,0,2,0,11,
+0,10,0,8,0,0,0,10,0,0,0,9,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,10,0,10,0,0,0,10,
+0,0,0,10,0,0,0,0,255,255,255,255,0,2,0,0,255,255,255,255,0,3,128,0,255,255,
+0,0,0,4,0,0,0,1,0,0,0,4,0,0,255,255,0,2,0,0,0,0,255,255,0,3,0,4,0,0,255,255,
+0,0,0,5,0,0,255,255,255,255,0,6,0,0,255,255,0,4,0,6,0,0,255,255,0,0,0,0,0,
+0,255,255,0,0,0,5,0,0,255,255,0,4,0,0,0,20,0,0,0,28,0,0,0,36,0,0,0,44,0,0,
+0,54,0,8,0,97,0,1,0,97,0,8,0,116,0,1,0,101,0,8,0,125,0,1,0,125,0,8,0,105,
+0,2,0,105,0,106,0,8,0,101,0,1,0,101,0,0,0,0,1,220,32,0,0,1,0,0,0,64,0,0,0,
+13,0,0,0,20,0,0,0,122,0,0,1,48,0,0,1,144,0,2,0,6,0,15,0,48,0,3,0,42,0,64,
+0,64,0,4,0,68,0,68,0,4,0,96,0,96,0,12,0,100,0,97,0,7,0,103,0,101,0,8,0,111,
+0,104,0,12,0,112,0,112,0,10,0,114,0,113,0,12,0,115,0,115,0,5,0,117,0,117,
+0,10,0,118,0,118,0,11,0,122,0,119,0,10,0,125,0,125,0,9,0,176,0,144,0,6,255,
+255,255,255,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,7,
+0,6,0,9,0,0,0,10,0,10,0,9,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,3,0,9,0,4,0,3,0,0,
+0,9,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,5,0,0,0,0,0,5,0,0,0,9,0,0,0,0,0,7,0,0,0,
+1,0,2,0,11,0,10,0,8,0,0,0,10,0,0,0,9,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,10,0,10,
+0,0,0,10,0,0,0,10,0,0,0,0,255,255,255,255,0,2,0,0,255,255,255,255,0,3,128,
+0,255,255,0,0,0,4,0,0,0,1,0,0,0,4,0,0,255,255,0,2,0,0,0,0,255,255,0,3,0,4,
+0,0,255,255,0,0,0,5,0,0,255,255,255,255,0,6,0,0,255,255,0,4,0,6,0,0,255,255,
+0,0,0,0,0,0,255,255,0,0,0,5,0,0,255,255,0,4,0,0,0,20,0,0,0,28,0,0,0,36,0,
+0,0,44,0,0,0,54,0,8,0,97,0,1,0,97,0,8,0,115,0,1,0,101,0,8,0,125,0,1,0,125,
+0,8,0,105,0,2,0,105,0,106,0,8,0,101,0,1,0,101,0,0,0,0,0,192,32,0,0,1,0,0,
+0,128,0,0,0,6,0,0,0,20,0,0,0,80,0,0,0,116,0,0,0,140,0,2,0,6,0,8,0,48,0,3,
+0,0,0,53,0,53,0,4,0,77,0,77,0,4,0,103,0,101,0,5,0,153,0,144,0,4,0,170,0,155,
+0,4,0,176,0,172,0,4,1,44,1,43,0,5,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,255,255,255,
+0,2,0,0,255,255,255,255,0,0,0,0,255,255,0,0,0,0,0,4,0,6,0,4,0,5,0,16,0,2,
+0,4,0,101,0,177,0,102,0,178,0,103,0,179,1,43,0,191,1,44,0,192,255,255,255,
+255,0,0,1,16,32,0,0,1,0,0,1,0,0,0,0,9,0,0,0,20,0,0,0,68,0,0,0,158,0,0,0,222,
+0,2,0,6,0,6,0,24,0,2,0,12,0,53,0,53,0,8,0,101,0,101,0,7,0,116,0,115,0,5,0,
+176,0,144,0,6,0,236,0,236,0,4,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+0,3,0,0,0,5,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,5,0,0,0,0,0,1,0,0,0,1,0,2,0,
+0,0,2,0,5,0,0,0,0,0,3,0,0,0,1,0,0,0,3,0,4,0,5,0,0,0,0,0,6,0,0,0,7,0,0,0,7,
+0,7,0,5,0,0,0,0,255,255,255,255,0,2,0,0,255,255,255,255,0,0,0,0,255,255,0,
+0,0,3,0,0,255,255,255,255,0,0,0,0,255,255,0,1,0,4,128,0,255,255,255,255,0,
+4,0,0,255,255,255,255,0,0,0,0,0,2,255,255,0,0,0,12,0,0,0,22,0,0,0,30,0,8,
+0,115,0,2,0,115,0,116,0,8,0,101,0,1,0,177,0,8,0,53,0,1,0,187,0,0,0,188,32,
+0,0,0,0,0,2,0,0,0,0,7,0,0,0,16,0,0,0,118,0,0,0,160,0,2,0,6,0,15,0,48,0,3,
+0,42,0,96,0,96,0,6,0,116,0,115,0,4,0,118,0,118,0,4,0,120,0,120,0,4,0,125,
+0,125,0,5,0,146,0,144,0,4,0,151,0,148,0,4,0,157,0,153,0,4,0,164,0,159,0,4,
+0,169,0,166,0,4,0,173,0,172,0,4,0,176,0,175,0,4,0,189,0,189,0,4,1,45,1,45,
+0,6,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,2,0,0,0,1,0,2,0,3,0,0,0,0,0,2,128,0,0,2,0,0,0,0,32,2,0,0,
+1,120,32,0,0,1,0,0,4,0,0,0,0,9,0,0,0,20,0,0,0,74,0,0,0,164,0,0,0,228,0,2,
+0,6,0,7,0,24,0,2,0,18,0,78,0,44,0,8,0,96,0,96,0,6,0,116,0,115,0,5,0,125,0,
+125,0,4,0,187,0,187,0,8,1,45,1,45,0,7,255,255,255,255,0,0,0,0,0,0,0,0,0,0,
+0,1,0,0,0,3,0,0,0,5,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,5,0,0,0,0,0,1,0,0,0,
+1,0,2,0,0,0,2,0,5,0,0,0,0,0,3,0,0,0,1,0,0,0,3,0,4,0,5,0,0,0,0,0,6,0,0,0,7,
+0,0,0,7,0,7,0,5,0,0,0,0,255,255,255,255,0,2,0,0,255,255,255,255,0,0,0,0,255,
+255,0,0,0,3,0,0,255,255,255,255,0,0,0,0,255,255,0,1,0,4,128,0,255,255,255,
+255,0,4,0,0,255,255,255,255,0,0,0,0,0,2,255,255,0,0,0,12,0,0,0,22,0,0,0,30,
+0,8,0,115,0,2,0,115,0,116,0,8,0,101,0,1,0,177,0,4,0,6,0,4,0,24,0,2,0,0,0,
+72,0,44,0,36,0,78,0,75,0,94,0,187,0,187,0,102,255,255,255,255,0,104,0,216,
+0,217,0,218,0,219,0,220,0,221,0,222,0,223,0,224,0,225,0,226,0,227,0,228,0,
+229,0,230,0,231,0,232,0,233,0,234,0,235,0,236,0,237,0,238,0,239,0,240,0,241,
+0,242,0,243,0,244,0,245,0,246,0,247,0,248,0,255,0,0,0,0,1,24,32,0,0,1,0,0,
+4,0,0,0,0,9,0,0,0,20,0,0,0,76,0,0,0,166,0,0,0,230,0,6,0,4,0,10,0,32,0,3,0,
+8,0,75,0,6,0,76,0,6,0,115,0,5,0,116,0,5,0,125,0,4,0,187,0,6,0,189,0,8,0,245,
+0,6,0,246,0,6,1,45,0,7,255,255,255,255,0,0,0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,
+5,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,5,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,2,0,5,
+0,0,0,0,0,3,0,0,0,1,0,0,0,3,0,4,0,5,0,0,0,0,0,6,0,0,0,7,0,0,0,7,0,7,0,5,0,
+0,0,0,255,255,255,255,0,2,0,0,255,255,255,255,0,0,0,0,255,255,0,0,0,3,0,0,
+255,255,255,255,0,0,0,0,255,255,0,1,0,4,128,0,255,255,255,255,0,4,0,0,255,
+255,255,255,0,0,0,0,0,2,255,255,0,0,0,12,0,0,0,22,0,0,0,30,0,8,0,115,0,2,
+0,115,0,116,0,8,0,101,0,1,0,177,0,8,0,189,0,1,0,171,0,0,0,196,32,0,0,1,0,
+0,8,0,0,0,0,6,0,0,0,20,0,0,0,72,0,0,0,108,0,0,0,132,0,6,0,4,0,9,0,32,0,3,
+0,4,0,97,0,5,0,98,0,5,0,99,0,5,0,100,0,5,0,104,0,5,0,112,0,5,0,116,0,4,0,
+120,0,5,0,122,0,5,255,255,255,255,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,255,255,255,0,2,0,0,255,255,255,
+255,0,0,0,0,255,255,0,0,0,0,0,4,0,6,0,4,0,8,0,32,0,3,0,0,0,97,0,180,0,98,
+0,181,0,99,0,182,0,100,0,183,0,104,0,181,0,112,0,184,0,120,0,185,0,122,0,
+186,255,255,255,255,0,0,0,168,32,0,0,1,0,0,16,0,0,0,0,6,0,0,0,20,0,0,0,60,
+0,0,0,96,0,0,0,120,0,6,0,4,0,6,0,16,0,2,0,8,0,70,0,4,0,72,0,4,0,155,0,5,0,
+160,0,5,0,168,0,5,0,169,0,5,255,255,255,255,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,255,255,255,0,2,0,0,
+255,255,255,255,0,0,0,0,255,255,0,0,0,0,0,4,0,6,0,4,0,4,0,16,0,2,0,0,0,155,
+0,205,0,160,0,205,0,168,0,206,0,169,0,207,255,255,255,255,0,0,0,220,32,0,
+0,1,0,0,32,0,0,0,0,6,0,0,0,20,0,0,0,92,0,0,0,128,0,0,0,152,0,2,0,6,0,10,0,
+48,0,3,0,12,0,70,0,70,0,4,0,72,0,72,0,4,0,100,0,97,0,5,0,104,0,104,0,5,0,
+112,0,112,0,5,0,115,0,115,0,5,0,119,0,119,0,5,0,190,0,190,0,5,0,207,0,205,
+0,4,255,255,255,255,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,255,255,255,0,2,0,0,255,255,255,255,0,0,
+0,0,255,255,0,0,0,0,0,4,0,6,0,4,0,9,0,32,0,3,0,4,0,97,0,193,0,98,0,194,0,
+99,0,195,0,100,0,196,0,104,0,194,0,112,0,197,0,115,0,198,0,119,0,199,0,190,
+0,200,255,255,255,255,0,0,0,192,32,0,0,1,0,0,64,0,0,0,0,6,0,0,0,20,0,0,0,
+68,0,0,0,104,0,0,0,128,0,2,0,6,0,6,0,24,0,2,0,12,0,58,0,58,0,4,0,103,0,101,
+0,5,0,157,0,155,0,5,0,160,0,160,0,5,0,175,0,175,0,5,255,255,255,255,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,
+0,0,255,255,255,255,0,2,0,0,255,255,255,255,0,0,0,0,255,255,0,0,0,0,0,4,0,
+6,0,4,0,8,0,32,0,3,0,0,0,101,0,208,0,102,0,209,0,103,0,210,0,155,0,201,0,
+156,0,202,0,157,0,203,0,160,0,201,0,175,0,204,255,255,255,255,0,0,0,140,32,
+0,0,1,0,0,128,0,0,0,0,6,0,0,0,20,0,0,0,50,0,0,0,86,0,0,0,110,0,2,0,6,0,3,
+0,12,0,1,0,6,0,179,0,177,0,5,0,204,0,201,0,4,255,255,255,255,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,
+255,255,255,0,2,0,0,255,255,255,255,0,0,0,0,255,255,0,0,0,0,0,4,0,8,0,177,
+0,3,0,211,0,212,0,213,0,0,0,0,0,152,32,0,0,1,0,1,0,0,0,0,0,6,0,0,0,20,0,0,
+0,52,0,0,0,88,0,0,0,112,0,6,0,4,0,4,0,16,0,2,0,0,0,77,0,4,0,169,0,5,0,174,
+0,4,0,175,0,5,255,255,255,255,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,255,255,255,0,2,0,0,255,255,255,255,
+0,0,0,0,255,255,0,0,0,0,0,4,0,6,0,4,0,2,0,8,0,1,0,0,0,169,0,214,0,175,0,215,
+255,255,255,255,0,0,11,176,32,0,0,2,0,2,0,0,0,0,0,12,0,0,0,28,0,0,0,76,0,
+0,1,12,0,0,1,168,0,0,1,216,0,0,11,140,0,6,0,4,0,8,0,32,0,3,0,0,0,96,0,5,0,
+147,0,4,0,152,0,7,0,158,0,8,0,165,0,9,0,170,0,10,0,174,0,11,1,45,0,6,255,
+255,255,255,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,3,0,4,0,5,0,6,0,7,0,0,0,0,0,0,0,
+0,0,2,0,0,0,0,0,3,0,4,0,5,0,6,0,7,0,1,0,1,0,8,0,1,0,1,0,9,0,10,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,11,0,1,0,1,0,12,0,13,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,14,
+0,1,0,1,0,15,0,16,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,17,0,1,0,1,0,18,0,19,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,20,0,1,0,1,0,21,0,22,0,1,0,1,0,1,0,1,0,1,0,1,0,
+1,0,23,0,1,0,1,0,24,0,25,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,64,0,0,0,0,2,
+128,0,0,0,0,3,128,0,0,0,0,4,128,0,0,0,0,5,128,0,0,0,0,6,128,0,0,0,0,7,128,
+0,0,0,0,2,0,0,0,0,0,0,160,0,0,0,0,0,160,0,0,0,0,3,0,0,0,0,0,0,160,0,0,2,0,
+0,160,0,0,2,0,4,0,0,0,0,0,0,160,0,0,4,0,0,160,0,0,4,0,5,0,0,0,0,0,0,160,0,
+0,6,0,0,160,0,0,6,0,6,0,0,0,0,0,0,160,0,0,8,0,0,160,0,0,8,0,7,0,0,0,0,0,0,
+160,0,0,10,0,0,160,0,0,10,63,255,255,160,128,0,0,59,0,0,0,111,128,0,1,5,0,
+0,1,62,128,0,1,206,0,0,2,13,128,0,2,150,0,0,2,220,128,0,3,96,0,0,3,171,128,
+0,4,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,4,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,6,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,0,10,0,249,1,33,0,250,1,34,0,251,1,35,0,252,1,36,0,253,1,37,
+0,254,1,38,0,0,2,106,32,0,0,4,0,4,0,0,0,0,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,
+0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,
+0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,
+0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,
+0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,
+0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,
+0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,188,0,
+97,0,98,0,99,0,100,0,101,0,102,0,103,0,104,0,105,0,106,0,107,0,108,0,109,
+0,110,0,111,0,112,0,113,0,114,0,115,0,116,0,117,0,118,0,119,0,120,0,121,0,
+122,0,123,0,124,0,125,0,126,0,127,0,128,0,129,0,130,0,131,0,132,0,133,0,134,
+0,135,0,136,0,137,0,138,0,139,0,140,0,141,0,142,0,143,0,144,0,145,0,146,0,
+147,0,148,0,149,0,150,0,151,0,152,0,153,0,154,0,155,0,156,0,157,0,158,0,159,
+0,160,0,161,0,162,0,163,0,164,0,165,0,166,0,167,0,168,0,169,0,170,0,171,0,
+172,0,173,0,174,0,175,0,176,0,177,0,178,0,179,0,180,0,181,0,182,0,183,0,184,
+0,185,0,186,0,187,0,188,0,189,0,190,0,191,0,192,0,193,0,194,0,195,0,196,0,
+197,0,198,0,199,0,200,0,201,0,202,0,203,0,204,0,205,0,206,0,207,0,208,0,209,
+0,210,0,211,0,212,0,213,0,214,0,215,0,216,0,217,0,218,0,219,0,220,0,221,0,
+222,0,223,0,224,0,225,0,226,0,227,0,228,0,229,0,230,0,231,0,232,0,233,0,234,
+0,235,0,236,0,237,0,238,0,239,0,240,0,241,0,242,0,243,0,244,0,245,0,246,0,
+247,0,248,0,249,0,250,0,251,0,252,0,253,0,254,0,255,1,0,1,1,1,2,1,3,1,4,1,
+5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,
+1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,
+1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,0,0,0,188,32,0,0,0,0,8,
+0,0,0,0,0,7,0,0,0,16,0,0,0,118,0,0,0,160,0,2,0,6,0,15,0,48,0,3,0,42,0,116,
+0,115,0,6,0,118,0,118,0,6,0,120,0,120,0,6,0,125,0,125,0,5,0,146,0,144,0,6,
+0,151,0,148,0,6,0,157,0,153,0,6,0,164,0,159,0,6,0,169,0,166,0,6,0,173,0,172,
+0,6,0,176,0,175,0,6,0,188,0,188,0,4,0,189,0,189,0,6,1,45,1,45,0,4,255,255,
+255,255,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+0,0,2,0,0,0,1,0,2,0,3,0,0,0,0,0,2,128,0,0,2,0,0,0,0,32,2,0,0,2,4,32,0,0,2,
+0,0,0,1,0,0,0,10,0,0,0,28,0,0,0,68,0,0,1,32,0,0,1,170,0,0,1,218,0,0,1,242,
+0,6,0,4,0,6,0,16,0,2,0,8,0,112,0,7,0,115,0,5,0,188,0,6,0,225,0,4,0,241,0,
+8,0,242,0,9,255,255,255,255,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,4,0,0,0,
+0,0,0,0,0,0,2,0,0,0,0,0,0,0,3,0,4,0,1,0,1,0,5,0,1,0,1,0,1,0,1,0,6,0,1,0,1,
+0,1,0,1,0,7,0,1,0,1,0,1,0,8,0,1,0,1,0,1,0,1,0,1,0,9,0,1,0,1,0,10,0,1,0,1,
+0,1,0,1,0,1,0,1,0,11,0,1,0,1,0,1,0,1,0,12,0,1,0,1,0,1,0,1,0,13,0,1,0,1,0,
+1,0,14,0,1,0,1,0,1,0,1,0,1,0,15,0,1,0,1,0,16,0,1,0,1,0,1,0,1,0,1,0,1,0,17,
+0,1,0,1,0,1,0,1,0,18,0,1,0,1,0,1,0,1,0,19,0,1,0,1,0,1,0,20,0,1,0,1,0,1,0,
+1,0,1,0,21,0,1,0,1,0,22,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,64,0,0,0,0,4,128,
+0,0,0,0,7,128,0,0,0,0,10,128,0,0,0,0,2,0,0,0,0,0,0,160,0,0,0,0,3,0,0,0,0,
+0,2,128,0,0,0,0,4,0,0,0,0,0,3,128,0,0,0,0,5,0,0,0,0,0,0,160,0,0,4,0,6,0,0,
+0,0,0,5,128,0,0,0,0,7,0,0,0,0,0,6,128,0,0,0,0,8,0,0,0,0,0,0,160,0,0,8,0,9,
+0,0,0,0,0,8,128,0,0,0,0,10,0,0,0,0,0,9,128,0,0,0,63,255,255,144,63,255,255,
+69,63,255,255,143,191,255,255,34,63,255,255,148,63,255,255,73,63,255,255,
+147,191,255,255,22,63,255,255,152,63,255,255,77,63,255,255,151,191,255,255,
+25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,1,40,1,41,1,42,0,0,0,132,
+32,0,0,1,0,16,0,0,0,0,0,6,0,0,0,20,0,0,0,48,0,0,0,84,0,0,0,108,0,6,0,4,0,
+3,0,8,0,1,0,4,0,153,0,5,0,187,0,4,0,255,0,4,255,255,255,255,0,0,0,0,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,255,
+255,255,0,2,0,0,255,255,255,255,0,0,0,0,255,255,0,0,0,0,0,4,0,8,0,153,0,1,
+0,154,};
+#endif
@@ -0,0 +1,1397 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifLao_Regular_ttf_size = 34560;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifLao_Regular_ttf");
+asm(".type fz_font_NotoSerifLao_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifLao_Regular_ttf, 34560");
+asm(".balign 64");
+asm("fz_font_NotoSerifLao_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifLao-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifLao_Regular_ttf_size = 34560;
+const char fz_font_NotoSerifLao_Regular_ttf[] = {
+0,1,0,0,0,15,0,128,0,3,0,112,71,68,69,70,0,16,0,162,0,0,127,104,0,0,0,22,
+71,80,79,83,0,21,0,10,0,0,127,128,0,0,0,12,71,83,85,66,153,44,147,116,0,0,
+127,140,0,0,4,138,79,83,47,50,111,26,234,145,0,0,1,120,0,0,0,86,99,109,97,
+112,183,233,179,33,0,0,4,104,0,0,1,18,103,97,115,112,255,255,0,3,0,0,127,
+96,0,0,0,8,103,108,121,102,103,70,6,165,0,0,6,204,0,0,110,68,104,101,97,100,
+1,16,150,9,0,0,0,252,0,0,0,54,104,104,101,97,12,69,5,3,0,0,1,52,0,0,0,36,
+104,109,116,120,73,83,188,21,0,0,1,208,0,0,2,152,108,111,99,97,16,239,245,
+116,0,0,5,124,0,0,1,78,109,97,120,112,0,183,0,143,0,0,1,88,0,0,0,32,109,111,
+114,120,96,113,237,247,0,0,132,24,0,0,2,232,110,97,109,101,113,162,163,232,
+0,0,117,16,0,0,5,34,112,111,115,116,118,41,13,142,0,0,122,52,0,0,5,42,0,1,
+0,0,0,1,7,174,74,132,132,94,95,15,60,245,0,11,8,0,0,0,0,0,203,21,99,117,0,
+0,0,0,210,255,223,209,251,180,253,153,8,40,8,127,0,0,0,8,0,2,0,0,0,0,0,0,
+0,1,0,0,8,102,253,168,0,0,8,208,251,180,253,228,8,40,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,166,0,1,0,0,0,166,0,141,0,16,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,3,137,1,144,0,5,0,0,5,154,5,51,0,0,1,27,5,154,5,51,0,0,
+3,209,0,102,2,18,0,0,2,0,5,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+71,79,79,71,0,64,0,1,37,204,7,115,253,168,0,0,8,102,2,88,32,0,1,17,65,0,0,
+0,0,0,0,0,0,0,2,128,0,0,2,128,0,0,2,170,0,211,3,68,0,117,4,121,0,82,4,121,
+0,135,7,43,0,92,5,240,0,74,1,195,0,117,2,197,0,117,2,197,0,66,4,0,0,84,4,
+121,0,133,2,0,0,61,2,123,0,51,2,74,0,164,2,78,0,0,4,121,0,92,4,121,0,135,
+4,121,0,104,4,121,0,119,4,121,0,35,4,121,0,113,4,121,0,125,4,121,0,121,4,
+121,0,94,4,121,0,104,2,76,0,166,2,0,0,61,4,121,0,133,4,121,0,133,4,121,0,
+133,4,0,0,88,7,94,0,133,5,166,0,82,5,74,0,147,5,85,0,147,3,142,0,32,4,226,
+0,82,5,74,0,147,5,85,0,147,5,106,0,168,5,106,0,168,5,166,0,82,6,97,0,147,
+5,166,0,82,5,85,0,147,5,85,0,147,5,96,0,168,5,96,0,168,6,53,0,147,6,53,0,
+147,6,35,0,82,5,85,0,147,5,64,0,147,5,35,0,147,5,35,0,147,5,35,0,147,6,180,
+0,147,5,35,0,147,5,14,0,147,5,54,0,147,4,158,0,147,0,0,252,84,3,192,0,82,
+3,192,253,69,0,0,251,180,0,0,251,180,0,0,251,180,0,0,251,180,0,0,253,196,
+0,0,253,44,0,0,252,88,0,0,252,96,4,26,0,82,2,238,0,168,5,103,0,168,3,88,0,
+0,3,179,0,0,3,88,255,216,5,35,0,147,0,0,253,49,0,0,252,114,0,0,252,81,0,0,
+253,61,0,0,253,48,0,0,253,51,4,170,0,147,5,14,0,147,4,215,0,147,5,213,0,82,
+5,24,0,147,5,30,0,147,5,103,0,168,5,166,0,82,5,114,0,168,5,216,0,168,8,207,
+0,147,8,208,0,147,0,0,253,49,0,0,252,127,0,0,252,71,0,0,253,71,0,0,253,48,
+0,0,253,41,0,0,252,224,0,0,253,41,5,166,0,82,5,74,0,147,5,85,0,147,3,142,
+0,32,4,226,0,82,5,74,0,147,5,85,0,147,5,106,0,168,5,106,0,168,5,166,0,82,
+6,97,0,147,5,166,0,82,5,85,0,147,5,85,0,147,5,96,0,168,5,96,0,168,6,53,0,
+147,6,53,0,147,6,35,0,82,5,85,0,147,5,64,0,147,5,35,0,147,5,35,0,147,5,35,
+0,147,6,180,0,147,5,35,0,147,5,14,0,147,8,207,0,147,8,208,0,147,3,192,0,82,
+0,0,253,19,0,0,252,211,0,0,255,69,0,0,254,177,0,0,254,61,0,0,254,62,0,0,254,
+61,0,0,254,72,0,0,254,93,0,0,254,93,3,142,0,32,3,142,0,32,0,5,252,96,0,5,
+252,96,0,0,255,210,0,0,254,182,0,0,254,238,0,0,255,82,0,0,253,224,0,0,252,
+238,0,0,252,219,0,0,253,97,0,5,254,4,0,5,254,4,5,166,0,82,5,85,0,147,0,0,
+0,0,4,193,0,98,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,6,0,0,0,52,0,32,0,4,0,20,0,
+15,0,64,0,160,0,173,3,126,14,130,14,132,14,136,14,138,14,141,14,151,14,159,
+14,163,14,165,14,167,14,171,14,185,14,189,14,196,14,198,14,205,14,217,14,
+223,32,11,37,204,255,255,0,0,0,1,0,32,0,160,0,173,3,126,14,129,14,132,14,
+135,14,138,14,141,14,148,14,153,14,161,14,165,14,167,14,170,14,173,14,187,
+14,192,14,198,14,200,14,208,14,220,32,11,37,204,255,255,0,0,255,226,255,98,
+255,98,252,159,241,162,241,161,241,159,241,158,241,156,241,150,241,149,241,
+148,241,147,241,146,241,144,241,143,241,142,241,140,241,139,241,138,241,136,
+0,0,224,153,218,217,0,1,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,98,0,99,0,162,0,163,0,0,0,0,
+0,0,0,0,0,0,0,39,0,60,0,117,0,219,1,82,1,216,1,229,2,11,2,49,2,88,2,112,2,
+149,2,162,2,194,2,207,3,14,3,60,3,131,3,228,4,33,4,110,4,194,4,219,5,72,5,
+159,5,216,6,24,6,44,6,64,6,83,6,164,7,59,7,144,7,246,8,75,8,123,8,214,9,64,
+9,150,9,221,10,47,10,133,10,219,11,38,11,109,11,181,12,34,12,110,12,193,13,
+26,13,90,13,177,14,5,14,90,14,170,15,25,15,130,15,232,16,70,16,122,16,242,
+17,43,17,85,17,171,17,226,18,31,18,107,18,189,18,242,19,54,19,141,19,207,
+20,92,20,162,21,40,21,155,22,10,22,113,22,199,22,212,23,27,23,122,23,143,
+23,223,24,17,24,63,24,151,24,235,25,66,25,167,26,44,26,198,27,26,27,182,28,
+6,28,141,29,31,29,44,29,115,29,210,29,231,30,58,30,108,30,222,31,22,31,150,
+32,38,32,167,33,3,33,137,34,30,34,160,35,19,35,145,36,19,36,148,37,10,37,
+125,37,240,38,136,39,0,39,126,40,3,40,110,40,240,41,111,41,239,42,106,43,
+5,43,153,44,42,44,179,45,102,46,35,46,77,46,140,47,21,47,73,47,140,47,194,
+47,254,48,74,48,155,48,212,49,13,49,108,49,218,50,91,50,218,50,231,51,43,
+51,138,51,158,51,171,51,242,52,81,52,102,52,230,53,102,53,241,54,123,54,123,
+55,34,0,0,0,2,0,211,255,242,1,213,5,182,0,3,0,23,0,0,19,51,3,35,3,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,221,238,72,94,82,20,35,47,27,26,47,35,21,
+21,35,47,26,27,47,35,20,5,182,251,230,254,225,40,53,32,14,14,32,53,40,39,
+54,32,14,14,32,54,0,2,0,117,3,213,2,207,5,182,0,3,0,7,0,0,1,51,3,35,1,51,
+3,35,1,246,217,62,94,254,66,217,62,94,5,182,254,31,1,225,254,31,0,2,0,82,
+0,0,4,39,5,182,0,3,0,31,0,0,1,33,19,33,1,21,33,3,35,19,33,3,35,19,35,53,51,
+19,35,53,33,19,51,3,33,19,51,3,51,21,35,3,1,141,1,29,76,254,227,2,53,254,
+254,78,122,77,254,228,78,123,78,168,190,78,244,1,11,73,125,75,1,28,76,123,
+76,160,182,76,2,25,1,145,254,111,121,254,96,1,160,254,96,1,160,121,1,145,
+121,1,147,254,109,1,147,254,109,121,254,111,0,3,0,135,255,94,3,233,6,20,0,
+50,0,59,0,70,0,0,1,30,3,21,20,6,35,52,46,2,39,17,30,3,21,20,6,7,21,35,53,
+34,46,2,39,17,51,20,30,2,23,17,46,3,53,52,62,2,55,53,51,19,52,46,2,39,17,
+54,54,1,20,30,2,23,17,14,3,2,109,92,129,82,37,88,74,15,39,70,54,92,142,96,
+50,198,182,103,51,104,99,91,38,86,43,79,109,66,96,133,82,37,49,90,129,80,
+103,192,20,46,73,53,92,100,254,53,21,42,61,40,40,62,41,21,5,121,2,37,61,82,
+48,66,67,45,91,75,52,6,254,34,40,80,93,113,73,154,171,19,248,244,9,21,32,
+22,1,59,57,107,85,55,5,1,250,43,84,93,108,67,69,112,83,51,9,159,251,123,41,
+65,56,48,24,254,57,16,117,3,11,43,65,50,40,18,1,173,9,39,55,70,0,5,0,92,255,
+236,6,207,5,203,0,19,0,39,0,59,0,79,0,83,0,0,1,20,14,2,35,34,46,2,53,52,62,
+2,51,50,30,2,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,20,14,2,35,34,46,
+2,53,52,62,2,51,50,30,2,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,35,1,
+51,2,252,42,84,126,84,88,127,82,39,39,82,128,89,84,125,83,42,254,24,16,36,
+58,42,42,58,35,15,15,35,56,42,42,59,37,16,5,187,42,84,126,84,88,128,81,39,
+39,82,128,89,84,125,83,42,254,24,16,36,58,42,42,58,34,15,15,34,56,42,42,59,
+37,16,253,129,135,2,219,134,4,6,103,168,120,66,66,120,168,103,103,167,119,
+64,64,119,167,103,88,139,96,50,50,96,139,88,87,136,95,49,49,95,136,253,87,
+103,168,120,65,65,120,168,103,103,167,119,64,64,119,167,103,88,139,96,50,
+50,96,139,88,87,136,95,49,49,95,136,253,245,5,182,0,3,0,74,255,236,5,221,
+5,203,0,62,0,78,0,96,0,0,33,39,14,3,35,34,46,2,53,52,62,2,55,46,3,53,52,62,
+2,51,50,30,2,21,20,14,2,7,1,62,3,53,53,33,21,35,34,14,2,7,6,6,7,23,30,3,51,
+51,21,37,50,62,2,55,1,14,3,21,20,30,2,1,52,46,2,35,34,6,21,20,30,2,23,62,
+3,4,150,170,37,89,108,131,78,123,183,121,60,47,85,121,74,39,59,39,20,44,94,
+147,102,98,138,87,39,38,83,131,94,1,117,14,18,11,4,1,113,19,34,66,57,45,13,
+18,47,35,190,15,32,43,59,42,18,252,103,60,103,86,72,29,254,59,47,75,53,28,
+44,81,112,1,46,20,45,73,52,91,98,16,35,54,39,60,89,58,28,180,42,73,54,31,
+62,113,158,97,87,129,98,74,31,46,85,84,88,50,68,110,80,43,46,80,106,59,66,
+102,86,77,40,254,117,46,95,91,87,37,80,86,8,29,55,47,66,154,77,203,15,20,
+12,4,86,94,25,44,61,36,1,229,26,63,83,104,66,75,115,79,40,4,72,41,70,51,30,
+106,88,39,68,67,72,43,26,58,69,84,0,1,0,117,3,213,1,78,5,182,0,3,0,0,19,51,
+3,35,117,217,62,94,5,182,254,31,0,1,0,117,254,250,2,131,6,20,0,21,0,0,1,20,
+30,2,23,21,46,2,2,53,52,18,54,54,55,21,14,3,1,74,19,64,125,105,141,200,127,
+58,58,127,200,141,105,125,64,19,2,137,122,238,213,180,64,94,56,160,221,1,
+33,185,185,1,31,220,159,56,92,64,179,212,238,0,0,1,0,66,254,250,2,80,6,20,
+0,21,0,0,1,52,46,2,39,53,30,2,18,21,20,2,6,6,7,53,62,3,1,123,19,65,124,105,
+141,200,126,59,59,126,200,141,105,124,65,19,2,137,122,238,212,179,64,92,56,
+159,220,254,225,185,185,254,223,221,160,56,94,64,180,213,238,0,0,1,0,84,3,
+6,3,160,6,20,0,17,0,0,19,55,5,3,51,3,37,23,5,5,7,37,19,35,19,5,39,37,84,72,
+1,59,53,178,57,1,61,72,254,166,1,90,72,254,195,57,178,51,254,199,72,1,88,
+4,244,162,199,1,69,254,189,192,159,101,100,158,191,254,188,1,68,195,160,102,
+0,1,0,133,1,37,3,244,4,147,0,11,0,0,1,17,35,17,33,53,33,17,51,17,33,21,2,
+121,123,254,135,1,121,123,1,123,2,160,254,133,1,123,121,1,122,254,134,121,
+0,1,0,61,254,197,1,141,1,8,0,23,0,0,37,20,14,2,7,53,54,54,53,52,46,4,53,52,
+54,51,50,30,2,1,141,36,81,127,92,101,94,22,34,38,34,22,77,57,32,56,44,25,
+86,65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,62,23,45,67,0,1,0,
+51,1,225,2,72,2,123,0,3,0,0,19,53,33,21,51,2,21,1,225,154,154,0,0,1,0,164,
+255,242,1,166,1,8,0,19,0,0,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,164,
+20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,125,40,53,32,14,14,32,53,
+40,39,54,32,14,14,32,54,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,23,35,1,51,121,
+121,1,215,119,248,7,12,0,2,0,92,255,236,4,29,5,203,0,19,0,39,0,0,1,20,2,6,
+6,35,34,38,38,2,53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,
+46,2,35,34,14,2,4,29,59,120,180,121,126,182,117,56,56,117,183,127,120,179,
+120,59,253,20,28,63,103,74,75,102,63,27,27,63,101,74,75,103,64,28,2,221,169,
+254,234,198,108,108,198,1,23,170,170,1,20,196,106,106,196,254,235,171,152,
+239,165,87,87,165,239,152,152,238,164,85,85,164,238,0,0,1,0,135,0,0,3,209,
+5,190,0,31,0,0,51,53,51,50,62,2,53,17,14,3,35,34,38,53,62,3,55,55,51,17,20,
+30,2,51,51,21,197,137,35,61,45,27,39,70,64,61,30,45,58,31,63,71,83,51,144,
+131,26,46,61,35,100,86,10,31,58,48,4,52,48,78,56,31,61,49,8,23,37,53,37,106,
+251,43,48,58,31,10,86,0,0,1,0,104,0,0,3,227,5,203,0,47,0,0,1,20,14,2,7,1,
+33,50,62,2,55,55,51,3,33,53,1,62,3,53,52,46,2,35,34,14,2,21,34,46,2,53,52,
+62,2,51,50,30,2,3,176,46,88,127,81,254,166,1,217,46,60,38,21,7,8,86,10,252,
+143,1,86,82,111,68,30,25,51,79,54,70,87,50,18,37,64,48,27,51,101,150,99,97,
+154,108,57,4,117,72,136,143,154,89,254,129,26,42,55,30,37,254,158,150,1,139,
+95,150,133,127,70,59,95,69,37,50,84,110,61,12,31,51,39,59,101,74,41,49,89,
+126,0,1,0,119,255,236,4,2,5,203,0,74,0,0,37,50,62,2,53,52,46,2,35,35,53,51,
+50,62,2,53,52,46,2,35,34,14,2,21,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,
+7,30,5,21,20,14,4,35,34,46,2,53,52,54,51,20,30,2,1,252,61,110,84,50,51,96,
+138,86,65,65,68,117,87,50,24,53,83,59,70,88,50,18,37,64,48,27,51,102,150,
+99,97,158,113,62,49,88,120,71,38,86,84,77,59,35,44,77,102,116,122,59,101,
+146,95,45,70,59,35,66,97,90,34,78,126,92,65,105,74,41,104,45,82,117,73,60,
+94,66,34,50,84,110,61,12,31,51,39,59,101,74,41,44,83,121,78,69,122,99,70,
+17,4,19,36,54,78,103,68,82,130,97,68,42,19,37,62,83,45,62,69,54,91,66,37,
+0,2,0,35,0,0,4,92,5,182,0,24,0,39,0,0,1,21,20,30,2,51,51,21,33,53,51,50,62,
+2,53,53,33,53,1,51,17,51,21,1,52,62,2,55,14,5,7,1,33,3,94,27,45,62,34,27,
+253,151,58,35,61,45,27,253,137,2,121,194,254,254,62,2,3,5,4,7,26,33,37,37,
+32,12,254,198,1,228,1,145,168,48,58,31,10,86,86,10,31,58,48,168,84,3,209,
+252,78,115,1,238,45,108,112,111,48,14,47,58,64,61,53,18,254,24,0,1,0,113,
+255,236,3,227,5,180,0,53,0,0,37,50,62,2,53,52,46,2,35,34,14,2,7,39,19,33,
+19,35,39,46,3,35,33,3,54,54,51,50,30,2,21,20,14,2,35,34,46,2,53,52,54,51,
+20,30,2,1,233,63,107,79,44,44,82,114,71,53,77,59,44,19,49,66,2,172,10,86,
+8,3,11,24,41,32,254,115,39,31,117,91,99,171,126,71,67,127,184,117,114,149,
+88,36,63,66,31,61,93,100,35,81,133,97,81,120,80,39,8,13,16,8,14,2,213,254,
+203,61,22,31,21,10,254,62,11,22,54,108,163,108,104,172,123,67,39,60,73,34,
+57,64,44,76,55,32,0,2,0,125,255,236,4,16,5,203,0,42,0,58,0,0,1,34,2,3,62,
+3,51,50,30,2,21,20,14,2,35,34,38,38,2,53,52,62,4,51,50,30,2,21,20,6,35,52,
+46,2,3,34,14,2,7,30,3,51,50,54,53,52,38,2,147,154,158,11,25,61,72,85,50,94,
+152,107,58,59,113,163,105,102,174,127,72,29,58,88,119,150,90,86,127,84,41,
+80,77,19,44,68,121,40,74,65,54,21,2,39,70,100,61,110,115,125,5,104,254,209,
+254,213,21,39,29,18,58,108,156,98,108,180,129,72,85,183,1,31,202,97,186,166,
+140,101,56,36,60,78,41,59,64,50,87,65,37,253,168,21,33,43,21,154,218,138,
+64,171,186,175,160,0,0,1,0,121,0,0,4,23,5,180,0,10,0,0,33,1,33,34,7,7,35,
+19,33,21,1,1,133,1,227,253,230,110,9,8,86,10,3,148,254,8,5,16,104,102,1,114,
+59,250,135,0,0,3,0,94,255,236,4,27,5,203,0,39,0,57,0,77,0,0,19,52,62,2,55,
+46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,30,3,21,20,14,2,35,34,46,2,5,50,62,
+2,53,52,46,2,39,6,6,21,20,30,2,1,52,46,2,35,34,14,2,21,20,30,2,23,62,3,94,
+47,84,114,67,58,98,70,39,50,106,169,118,96,150,103,54,40,72,102,62,76,125,
+90,49,70,128,182,112,115,174,117,59,1,219,67,109,77,42,38,86,137,99,97,114,
+35,69,104,1,48,25,55,89,65,57,89,60,31,35,69,104,68,58,75,44,18,1,111,74,
+111,87,70,32,33,77,92,109,64,71,132,102,62,53,94,129,77,67,102,81,65,31,36,
+82,96,112,67,97,153,106,55,60,105,141,212,41,72,100,59,52,89,83,79,43,52,
+166,116,64,104,75,41,4,37,47,90,71,43,37,65,90,53,55,88,72,63,32,29,61,73,
+87,0,0,2,0,104,255,233,3,252,5,203,0,42,0,61,0,0,37,50,18,19,14,3,35,34,46,
+2,53,52,62,2,51,50,22,22,18,21,20,14,4,35,34,46,2,53,52,54,55,30,3,19,62,
+3,55,53,46,3,35,34,6,21,20,30,2,1,211,170,162,10,22,59,75,91,54,89,149,107,
+59,60,113,163,103,104,174,128,71,27,57,89,123,160,99,87,115,67,28,38,23,14,
+41,59,76,134,50,83,64,47,14,2,40,70,97,59,109,119,30,60,89,90,1,48,1,52,27,
+50,39,23,52,104,156,104,111,185,133,75,80,168,254,252,180,107,205,182,152,
+111,61,31,50,64,32,38,52,8,32,59,45,26,2,82,1,27,45,60,33,4,135,195,126,60,
+190,181,84,120,76,35,0,2,0,166,255,242,1,168,4,84,0,19,0,39,0,0,55,52,62,
+2,51,50,30,2,21,20,14,2,35,34,46,2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,
+46,2,166,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,20,35,47,27,26,47,
+35,21,21,35,47,26,27,47,35,20,125,40,53,32,14,14,32,53,40,39,54,32,14,14,
+32,54,3,115,40,53,32,14,14,32,53,40,39,54,33,14,14,33,54,0,2,0,61,254,197,
+1,141,4,84,0,23,0,43,0,0,37,20,14,2,7,53,54,54,53,52,46,4,53,52,54,51,50,
+30,2,1,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,141,36,81,127,92,101,94,
+22,34,38,34,22,77,57,32,56,44,25,254,244,20,35,47,27,26,47,35,21,21,35,47,
+26,27,47,35,20,86,65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,62,
+23,45,67,3,72,40,53,32,14,14,32,53,40,39,54,33,14,14,33,54,0,0,1,0,133,0,
+225,3,244,4,217,0,6,0,0,19,53,1,21,1,1,21,133,3,111,253,80,2,176,2,184,72,
+1,217,137,254,139,254,143,137,0,0,2,0,133,1,213,3,244,3,225,0,3,0,7,0,0,1,
+21,33,53,1,21,33,53,3,244,252,145,3,111,252,145,2,78,121,121,1,147,121,121,
+0,1,0,133,0,225,3,244,4,217,0,6,0,0,55,53,1,1,53,1,21,133,2,176,253,80,3,
+111,225,137,1,113,1,117,137,254,39,72,0,2,0,88,255,242,3,152,5,203,0,37,0,
+57,0,0,1,35,17,62,3,53,52,46,2,35,34,14,2,21,34,46,2,53,52,62,2,51,50,30,
+2,21,20,14,2,7,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,2,10,125,89,121,
+73,31,26,54,85,59,64,87,54,24,37,62,45,26,45,95,144,99,97,164,120,68,53,102,
+148,95,194,20,35,47,27,26,47,35,21,21,35,47,26,27,47,35,20,1,156,1,55,36,
+95,111,121,61,53,87,61,34,42,72,95,53,17,33,50,33,49,84,62,35,50,95,138,88,
+84,138,114,94,39,253,250,40,53,32,14,14,32,53,40,39,54,32,14,14,32,54,0,0,
+2,0,133,254,221,6,242,5,182,0,91,0,110,0,0,1,20,14,2,35,34,38,39,35,14,3,
+35,34,46,2,53,52,62,4,51,50,22,23,55,51,3,6,7,6,6,21,20,30,2,51,50,62,2,53,
+52,46,2,35,34,14,4,21,20,30,2,51,50,62,2,55,23,14,3,35,34,36,38,2,53,52,18,
+62,3,51,50,4,22,22,1,20,22,51,50,62,2,55,19,38,38,35,34,14,4,6,242,72,116,
+143,71,91,121,29,11,21,53,67,83,52,62,113,85,51,25,53,83,116,151,94,66,95,
+31,82,49,104,3,4,3,4,21,34,45,25,45,94,76,49,86,153,213,128,100,193,172,147,
+106,60,98,167,221,124,84,150,131,111,44,48,51,126,147,169,95,165,254,236,
+199,112,63,119,169,212,249,140,172,1,4,174,87,251,229,87,69,52,76,52,32,9,
+78,13,65,37,61,99,75,54,35,16,3,35,148,239,168,90,98,88,40,68,50,28,42,86,
+132,90,55,128,127,119,91,55,36,25,43,253,246,24,24,20,48,21,36,53,35,16,72,
+139,202,130,134,205,139,71,56,109,157,201,244,140,171,241,153,70,29,48,61,
+32,74,38,73,57,35,91,184,1,20,186,145,1,7,226,183,129,70,102,177,241,254,
+49,108,105,45,72,92,47,1,160,29,32,53,86,111,116,110,0,3,0,82,0,0,4,254,5,
+20,0,7,0,16,0,61,0,0,55,20,51,50,53,52,35,34,19,53,52,35,34,21,20,51,50,18,
+35,34,39,38,53,52,55,54,51,50,23,17,35,34,39,38,53,52,55,54,51,50,23,54,51,
+50,22,21,17,20,7,35,54,53,17,52,38,35,34,7,7,17,20,7,198,75,76,76,75,142,
+72,70,113,15,68,121,102,47,42,42,48,101,37,30,27,124,57,50,49,48,94,202,42,
+111,218,217,215,50,188,50,122,122,188,97,33,71,191,75,75,76,3,10,23,118,71,
+71,251,236,54,48,89,90,47,54,7,2,43,53,46,86,94,46,45,141,141,176,174,253,
+18,95,105,75,125,2,238,89,151,157,48,253,43,137,65,0,0,2,0,147,255,236,5,
+17,5,20,0,53,0,69,0,0,1,32,17,16,33,32,22,21,20,4,7,7,6,21,20,51,50,36,51,
+50,19,7,38,38,35,34,4,35,34,38,53,16,55,55,54,54,53,52,38,35,32,21,21,54,
+55,54,51,50,22,22,21,20,6,6,38,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,
+1,161,254,242,2,18,1,24,250,254,217,235,171,171,104,104,1,51,152,231,64,60,
+41,106,88,109,254,212,154,146,146,249,248,158,217,156,186,254,126,19,28,38,
+41,40,77,43,42,76,59,32,18,17,32,18,18,32,18,19,32,17,2,188,1,5,1,83,164,
+215,171,178,58,44,45,195,120,254,254,235,107,116,104,200,115,115,1,9,63,64,
+40,140,119,143,126,229,1,24,16,20,41,77,42,42,76,42,228,18,32,18,18,32,17,
+17,32,18,18,32,18,0,0,2,0,147,0,0,4,173,5,20,0,13,0,61,0,0,37,54,53,52,39,
+38,35,34,21,20,23,22,51,50,1,52,38,35,34,6,21,20,51,51,21,35,34,21,21,54,
+51,50,23,22,21,20,7,6,35,34,39,38,53,53,52,55,38,53,52,55,54,33,32,23,22,
+21,17,20,7,35,54,53,1,254,22,17,19,39,76,27,18,31,34,2,6,161,180,180,153,
+212,80,80,212,46,76,95,48,47,48,47,95,130,75,105,163,163,120,125,1,20,1,19,
+124,130,50,188,50,131,19,41,36,19,21,76,45,18,12,3,36,127,143,119,121,170,
+134,216,78,30,48,48,96,95,48,47,52,71,172,135,207,73,66,174,187,80,83,92,
+95,193,253,48,95,105,75,125,0,2,0,32,254,112,2,230,5,20,0,7,0,31,0,0,19,20,
+51,50,53,52,35,34,0,35,34,39,22,51,50,54,53,17,52,39,22,21,20,35,34,53,16,
+33,32,17,17,20,198,75,76,76,75,1,95,129,229,159,159,139,123,101,141,51,192,
+190,1,49,1,99,4,16,74,75,76,250,19,204,100,184,112,3,152,217,26,46,77,190,
+190,1,4,254,132,252,104,190,0,2,0,82,0,0,4,58,5,20,0,9,0,63,0,0,1,54,53,52,
+35,34,7,21,20,51,0,35,34,39,38,53,52,55,54,53,6,35,35,38,39,38,39,53,52,55,
+54,55,51,50,23,22,23,22,21,20,7,6,21,20,51,50,53,17,52,38,35,34,6,7,16,55,
+54,51,32,22,21,17,20,7,2,72,75,72,74,3,72,1,127,166,176,42,20,27,51,21,64,
+6,81,42,43,3,43,46,93,5,98,56,51,13,10,27,44,76,95,153,194,119,228,118,124,
+125,211,1,35,249,54,2,79,1,69,67,68,5,64,253,177,105,46,77,95,55,103,5,19,
+12,47,47,84,10,76,47,48,16,39,36,69,51,47,76,63,103,129,131,95,2,185,107,
+167,76,237,1,7,87,87,225,173,253,67,93,50,0,0,2,0,147,254,122,5,20,5,20,0,
+15,0,73,0,0,0,21,20,22,22,51,50,54,54,53,52,38,38,35,34,6,37,52,38,35,32,
+21,21,54,55,54,51,50,22,22,21,20,6,6,35,32,17,16,33,32,22,21,20,4,7,7,6,21,
+20,51,50,36,51,50,23,22,21,20,23,36,53,52,35,34,4,35,34,38,53,16,55,55,54,
+54,1,94,17,32,18,18,32,18,19,32,17,17,32,2,139,156,186,254,126,19,28,38,41,
+40,77,43,42,76,42,254,242,2,18,1,24,250,254,217,235,171,171,74,74,1,99,107,
+125,63,64,103,254,221,64,104,254,204,124,116,146,249,248,158,217,3,110,18,
+18,32,17,17,32,18,18,32,18,18,11,143,126,229,1,24,16,20,41,77,42,42,76,42,
+1,5,1,83,164,215,171,178,58,44,45,195,120,195,62,64,239,210,120,90,240,221,
+161,115,115,1,9,63,64,40,140,0,0,2,0,147,0,0,4,223,5,20,0,13,0,61,0,0,1,34,
+7,6,21,20,51,50,55,54,53,52,39,38,1,20,7,6,33,32,39,38,53,52,55,38,53,53,
+52,55,54,51,50,23,22,21,20,7,6,35,34,39,21,20,51,51,21,35,34,21,20,22,51,
+50,54,53,17,52,55,51,6,21,1,201,31,18,27,76,39,19,17,22,19,2,194,130,124,
+254,237,254,236,125,120,163,163,105,75,130,95,47,48,47,48,95,76,46,212,80,
+80,212,153,180,180,161,50,188,50,4,160,12,18,45,76,21,19,36,41,19,15,252,
+220,193,95,92,83,80,187,224,66,73,157,135,172,71,52,47,48,95,96,48,48,30,
+78,166,134,220,121,119,143,127,2,208,95,105,75,125,0,2,0,168,0,0,4,194,5,
+20,0,13,0,48,0,0,37,54,53,52,39,38,35,34,21,20,23,22,51,50,1,52,38,35,34,
+6,21,17,54,51,50,23,22,21,20,7,6,35,34,39,38,53,17,52,54,33,32,22,21,17,20,
+7,35,54,53,2,19,22,17,19,39,76,27,18,31,34,2,6,161,180,180,153,46,76,95,48,
+47,48,47,95,130,75,105,245,1,20,1,19,254,50,188,50,131,19,41,36,19,21,76,
+45,18,12,3,36,127,143,143,127,253,200,30,48,48,96,95,48,47,52,71,172,2,113,
+193,187,187,193,253,48,95,105,75,125,0,2,0,168,0,0,4,194,5,20,0,13,0,58,0,
+0,37,54,53,52,39,38,35,34,21,20,23,22,51,50,39,54,51,50,23,22,21,20,7,6,35,
+34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,35,54,53,17,52,
+38,35,34,7,38,35,34,6,21,2,19,22,17,19,39,76,27,18,31,34,156,46,76,95,48,
+47,48,47,95,130,75,105,95,72,129,133,96,96,133,130,74,92,50,188,50,70,38,
+70,159,159,70,38,70,131,19,41,36,19,21,76,45,18,12,236,30,48,48,96,95,48,
+47,52,71,172,2,113,215,93,72,173,173,74,94,212,253,48,95,105,75,125,2,208,
+146,120,213,213,120,146,0,3,0,82,254,112,5,88,5,20,0,7,0,16,0,61,0,0,1,34,
+21,20,51,50,53,52,1,53,52,35,34,21,20,51,50,19,54,51,50,23,22,21,20,7,6,35,
+34,39,38,53,17,35,34,39,38,53,52,55,54,51,50,23,54,51,50,22,21,17,20,23,34,
+38,53,17,52,38,35,34,7,7,2,83,76,76,75,254,182,72,70,113,15,202,30,37,101,
+48,42,42,47,102,121,63,71,27,124,57,50,49,48,94,202,42,111,218,217,215,90,
+118,160,122,122,188,97,33,1,11,76,75,75,76,3,10,23,118,71,71,253,99,7,54,
+47,90,89,48,54,58,65,137,2,158,53,46,86,94,46,45,141,141,176,174,251,230,
+205,95,175,125,4,26,89,151,157,48,0,2,0,147,0,0,5,185,5,20,0,7,0,60,0,0,1,
+50,53,52,35,34,21,20,5,52,38,35,34,6,21,17,20,7,6,35,34,39,38,53,16,55,54,
+55,38,38,53,52,54,51,50,22,21,20,2,17,20,22,51,50,54,53,17,52,55,54,51,50,
+23,22,21,17,20,7,35,54,53,1,61,64,64,64,4,0,94,87,87,94,99,91,194,193,91,
+100,116,40,27,91,92,93,92,104,103,204,95,101,103,93,105,86,178,178,87,104,
+50,188,50,4,31,63,64,64,63,150,194,91,90,195,253,237,210,85,79,78,86,210,
+1,62,155,52,47,1,86,85,91,91,91,91,126,254,168,254,238,168,96,98,166,2,19,
+230,90,75,75,91,229,253,63,95,105,75,125,0,0,2,0,82,0,0,4,254,5,20,0,7,0,
+52,0,0,1,50,53,52,35,34,21,20,23,6,35,34,39,38,53,52,55,54,51,50,23,22,21,
+17,20,7,22,23,22,51,50,54,53,17,52,39,51,22,21,17,20,6,35,34,39,38,39,6,35,
+53,50,54,53,1,17,76,76,75,142,30,37,101,48,42,42,47,102,121,63,71,9,58,57,
+57,158,119,122,50,188,50,207,202,221,98,33,38,88,244,97,96,4,9,76,75,75,76,
+108,7,54,47,90,89,48,54,58,65,137,253,118,83,55,5,57,80,146,104,2,228,125,
+75,105,95,253,28,177,183,106,35,3,144,144,103,143,0,0,2,0,147,0,0,4,173,5,
+20,0,7,0,47,0,0,1,50,53,52,35,34,21,20,1,20,7,6,33,32,39,38,53,16,55,54,55,
+38,39,38,53,52,55,54,51,50,23,22,21,20,2,21,20,22,51,50,54,53,17,52,39,51,
+22,21,1,54,61,61,61,3,180,125,125,254,236,254,236,125,123,112,38,25,92,44,
+39,42,44,92,101,50,47,188,156,181,180,157,50,188,50,4,29,64,63,63,64,253,
+145,240,95,95,92,91,230,1,22,155,52,47,1,48,43,80,89,45,49,48,46,89,147,254,
+189,234,190,113,122,198,2,158,125,75,105,95,0,2,0,147,0,0,5,0,6,99,0,7,0,
+47,0,0,1,50,53,52,35,34,21,20,1,20,7,6,33,32,39,38,53,16,55,54,55,38,39,38,
+53,52,55,54,51,50,23,22,21,20,2,21,20,22,51,50,54,53,17,52,54,55,6,21,1,54,
+61,61,61,3,180,125,125,254,236,254,236,125,123,112,38,25,92,44,39,42,44,92,
+101,50,47,188,156,181,180,157,107,164,83,4,29,64,63,63,64,253,145,240,95,
+95,92,91,230,1,22,155,52,47,1,48,43,80,89,45,49,48,46,89,147,254,189,234,
+190,113,122,198,3,72,85,220,60,150,215,0,0,3,0,168,0,0,4,254,5,120,0,7,0,
+15,0,78,0,0,1,52,35,34,21,20,51,50,33,50,55,38,35,34,21,20,3,18,51,50,54,
+53,17,6,35,34,39,38,53,52,54,51,50,23,22,23,54,53,52,39,50,21,20,7,22,21,
+17,20,7,6,35,34,39,6,35,34,39,38,53,17,52,55,54,51,50,22,21,20,7,6,35,34,
+39,17,20,22,51,50,19,1,238,64,65,65,64,1,196,33,41,9,65,64,182,57,155,56,
+52,31,43,80,40,40,90,80,100,63,15,12,23,29,138,78,8,92,70,134,153,71,71,153,
+133,70,93,89,63,100,80,90,40,40,80,43,31,54,54,155,57,4,106,64,64,63,40,87,
+64,63,253,101,254,222,122,148,2,79,11,42,43,86,74,95,46,11,13,36,39,68,27,
+100,97,84,37,45,253,111,215,94,71,117,117,70,93,217,2,145,153,64,46,95,74,
+86,43,42,11,253,177,153,117,1,34,0,0,2,0,168,0,0,5,11,6,99,0,7,0,52,0,0,1,
+52,35,34,21,20,51,50,1,20,7,6,35,34,39,6,35,34,39,38,53,17,52,55,54,51,50,
+22,21,20,7,6,35,34,39,17,20,22,51,50,19,51,18,51,50,54,53,17,52,54,55,6,21,
+1,238,64,65,65,64,2,202,92,70,134,153,71,71,153,133,70,93,89,63,100,80,90,
+40,40,80,43,31,54,54,155,57,24,57,155,56,52,107,164,83,4,106,64,64,63,253,
+81,215,94,71,117,117,70,93,217,2,145,153,64,46,95,74,86,43,42,11,253,177,
+153,117,1,34,254,222,122,148,3,122,85,220,60,150,215,0,2,0,147,0,0,5,191,
+5,20,0,7,0,58,0,0,1,50,53,52,35,34,21,20,37,51,17,20,51,50,54,53,17,52,55,
+51,6,21,17,20,7,6,35,34,39,6,35,34,39,38,53,16,55,54,55,38,39,38,53,52,55,
+54,51,50,23,22,21,20,2,17,20,22,51,50,53,1,54,61,61,61,1,225,188,158,70,87,
+50,188,50,99,86,161,165,86,86,205,200,86,100,112,38,25,96,43,36,52,44,82,
+97,49,52,188,89,109,197,4,29,64,63,63,64,247,252,84,250,112,151,2,215,95,
+105,75,125,253,41,204,90,79,110,110,78,90,205,1,62,155,52,47,1,52,42,77,99,
+45,39,44,45,94,147,254,189,254,238,153,110,250,0,2,0,147,0,0,5,224,6,99,0,
+7,0,62,0,0,1,50,53,52,35,34,21,20,1,20,7,6,35,34,39,6,35,34,39,38,53,16,55,
+54,55,38,39,38,53,52,55,54,51,50,23,22,21,20,2,17,20,22,51,50,53,17,52,55,
+51,6,21,17,20,51,50,54,53,17,52,54,55,6,21,1,54,61,61,61,4,148,99,86,181,
+185,86,86,185,180,86,100,112,38,25,96,43,36,52,44,82,97,49,52,188,89,89,177,
+50,188,50,178,90,87,107,164,83,4,29,64,63,63,64,253,88,204,90,79,110,110,
+78,90,205,1,62,155,52,47,1,52,42,77,99,45,39,44,45,94,147,254,189,254,238,
+153,110,250,2,228,95,105,75,125,253,28,250,112,151,3,129,85,220,60,150,215,
+0,2,0,82,0,0,5,123,5,20,0,7,0,45,0,0,55,50,53,52,35,34,21,20,37,20,22,51,
+50,54,53,17,52,39,51,22,21,17,20,6,35,34,39,39,6,35,32,53,52,51,50,21,20,
+7,54,53,17,52,39,51,22,21,243,62,62,61,1,215,146,140,140,136,50,188,50,230,
+229,229,125,1,78,171,254,254,161,162,43,103,50,188,50,158,62,61,61,62,222,
+173,97,147,123,2,208,125,75,105,95,253,48,190,190,95,1,96,220,162,162,65,
+39,22,184,3,10,125,75,105,95,0,0,2,0,147,0,0,5,0,6,99,0,13,0,61,0,0,1,34,
+7,6,21,20,51,50,55,54,53,52,39,38,1,20,7,6,33,32,39,38,53,52,55,38,53,53,
+52,55,54,51,50,23,22,21,20,7,6,35,34,39,21,20,51,51,21,35,34,21,20,22,51,
+50,54,53,17,52,54,55,6,21,1,201,31,18,27,76,39,19,17,22,19,2,194,130,124,
+254,237,254,236,125,120,163,163,105,75,130,95,47,48,47,48,95,76,46,212,80,
+80,212,153,180,180,161,107,164,83,4,160,12,18,45,76,21,19,36,41,19,15,252,
+220,193,95,92,83,80,187,224,66,73,157,135,172,71,52,47,48,95,96,48,48,30,
+78,166,134,220,121,119,143,127,3,122,85,220,60,150,215,0,0,2,0,147,0,0,4,
+173,5,20,0,11,0,55,0,0,0,6,21,20,22,51,50,54,53,52,38,35,2,38,53,52,54,51,
+50,22,21,20,6,35,34,39,38,39,22,33,50,54,53,52,38,39,39,38,53,16,33,32,19,
+36,33,32,21,20,23,23,22,4,21,20,6,33,1,177,39,39,27,25,39,39,25,76,237,156,
+157,71,90,81,80,81,41,6,5,21,1,43,156,206,203,161,252,246,1,217,1,97,224,
+254,242,254,211,254,221,158,174,239,1,35,250,254,212,1,156,34,24,26,36,36,
+26,24,34,254,100,145,128,114,116,83,66,75,76,38,6,7,144,116,143,105,157,27,
+46,40,236,1,64,254,210,158,176,151,31,30,39,188,172,215,154,0,0,2,0,147,0,
+0,4,123,5,20,0,7,0,59,0,0,37,50,53,52,35,34,21,20,37,20,7,6,35,34,46,2,35,
+34,7,54,51,50,23,22,21,22,21,20,7,6,7,38,39,38,53,52,55,54,51,50,22,18,51,
+50,53,17,52,38,35,34,6,7,16,55,54,51,32,22,21,1,159,70,70,70,3,34,66,61,117,
+59,123,30,114,122,119,28,43,56,95,46,43,2,40,49,107,124,62,64,78,79,151,154,
+190,48,56,56,153,194,119,228,118,124,125,211,1,35,249,84,70,70,70,70,136,
+114,55,51,79,194,217,209,42,38,35,68,17,15,67,37,45,1,3,64,65,129,190,71,
+72,187,254,249,76,2,170,107,167,76,237,1,7,87,87,225,173,0,0,2,0,147,0,0,
+4,123,5,20,0,15,0,54,0,0,0,21,20,22,22,51,50,54,54,53,52,38,38,35,34,6,5,
+20,6,35,34,38,53,52,54,54,51,50,22,22,21,20,6,7,6,7,22,51,50,54,53,17,52,
+38,35,34,6,7,16,55,54,51,32,22,21,1,7,19,36,20,20,36,20,21,36,19,19,36,3,
+96,250,250,250,250,51,92,48,48,91,52,50,45,26,28,102,165,156,156,153,194,
+119,228,118,124,125,211,1,35,249,1,144,20,20,36,19,19,36,20,20,36,20,20,56,
+190,190,190,190,50,92,49,49,92,50,50,91,25,14,6,84,147,123,2,10,107,167,76,
+237,1,7,87,87,225,173,0,0,3,0,147,0,0,4,123,5,70,0,13,0,21,0,77,0,0,1,38,
+39,38,35,34,6,21,20,22,51,50,55,54,1,50,53,52,35,34,21,20,1,6,35,34,38,53,
+52,54,51,32,23,54,55,23,6,7,22,21,17,20,7,6,35,34,46,2,35,34,7,54,51,50,23,
+22,21,22,21,20,7,6,7,38,39,38,53,52,55,54,51,50,22,18,51,50,53,3,134,23,31,
+132,146,107,128,128,107,146,152,18,254,41,70,70,70,2,102,146,243,204,219,
+219,204,1,3,152,15,4,147,14,33,47,66,61,117,59,123,30,114,122,119,28,43,56,
+95,46,43,2,40,49,107,124,62,64,78,79,151,154,190,48,56,56,4,34,21,19,98,77,
+83,83,47,124,12,252,66,70,70,70,70,3,53,103,104,130,130,134,90,61,79,30,125,
+92,67,84,253,36,114,55,51,79,194,217,209,42,38,35,68,17,15,67,37,45,1,3,64,
+65,129,190,71,72,187,254,249,76,0,3,0,147,0,0,6,12,5,20,0,7,0,16,0,76,0,0,
+1,50,53,52,35,34,21,20,5,53,52,35,34,21,20,51,50,5,52,38,35,34,7,17,20,7,
+6,35,34,39,38,53,16,55,54,55,38,38,53,52,54,51,50,22,21,20,2,17,20,22,51,
+50,54,53,17,35,34,39,38,53,52,55,54,51,50,23,54,51,50,22,21,17,20,7,35,54,
+53,1,61,64,64,64,2,55,32,40,43,15,2,42,62,72,118,100,99,91,250,230,91,100,
+116,40,27,91,92,93,92,84,103,184,95,139,158,93,27,54,57,50,49,48,64,162,42,
+81,148,167,155,50,188,50,4,31,63,64,64,63,10,23,118,71,71,34,89,91,205,253,
+157,210,85,79,78,86,210,1,62,155,52,47,1,86,85,91,91,91,91,126,254,168,254,
+238,168,96,98,166,2,44,53,46,86,94,46,45,141,141,166,124,252,214,95,105,75,
+125,0,3,0,147,0,0,4,123,5,20,0,11,0,31,0,67,0,0,1,38,38,35,34,6,21,20,22,
+51,50,54,1,20,23,22,23,22,22,51,50,54,54,53,52,38,38,35,34,6,7,6,23,22,51,
+32,17,17,6,35,34,38,53,52,54,33,22,4,21,17,16,33,32,17,51,54,55,54,54,51,
+50,22,22,21,20,6,7,6,3,183,17,141,146,186,126,156,156,156,131,253,89,2,2,
+4,8,30,17,17,31,17,18,31,16,16,30,8,8,133,95,163,1,56,119,193,250,250,230,
+1,14,230,1,14,254,12,254,12,1,3,20,22,81,43,43,82,48,46,40,8,3,171,161,96,
+103,153,153,103,95,254,59,11,11,7,7,15,16,16,30,17,17,31,17,17,15,14,165,
+66,1,14,1,1,57,190,170,190,170,10,180,240,254,22,254,132,1,76,37,33,38,43,
+43,76,43,42,76,20,4,0,0,2,0,147,0,0,4,173,5,33,0,11,0,64,0,0,0,6,21,20,22,
+51,50,54,53,52,38,35,0,54,51,50,23,22,51,50,55,2,35,34,39,38,35,34,21,20,
+23,23,22,4,21,20,6,33,32,38,53,52,54,51,50,22,21,20,6,35,34,39,38,39,22,33,
+50,54,53,52,38,39,39,38,17,1,177,39,39,27,25,39,39,25,254,199,146,146,154,
+138,82,109,158,117,124,151,152,113,114,104,104,158,174,239,1,35,250,254,212,
+254,249,237,156,157,71,90,81,80,81,41,6,5,21,1,43,156,206,203,161,252,246,
+1,156,34,24,26,36,36,26,24,34,3,5,115,75,45,133,254,235,60,60,131,196,31,
+30,39,188,172,215,154,145,128,114,116,83,66,75,76,38,6,7,144,116,143,105,
+157,27,46,40,1,25,0,0,2,0,147,254,255,4,163,5,20,0,7,0,30,0,0,0,35,34,21,
+20,51,50,53,19,50,0,55,23,1,39,1,6,35,32,17,52,55,22,21,20,7,20,35,34,39,
+22,1,249,70,70,70,70,35,111,1,29,87,164,253,92,162,1,249,153,161,254,119,
+250,201,1,192,46,36,12,4,184,69,69,69,254,243,1,8,166,82,250,61,68,4,46,164,
+1,66,255,6,2,154,12,14,141,42,149,0,0,4,0,147,0,44,4,11,4,176,0,15,0,41,0,
+57,0,83,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,23,22,51,50,54,55,
+51,6,7,6,35,34,39,38,53,52,54,54,51,50,22,22,21,20,7,6,2,6,6,21,20,22,22,
+51,50,54,54,53,52,38,38,35,23,22,51,50,54,55,51,6,7,6,35,34,39,38,53,52,54,
+54,51,50,22,22,21,20,7,6,1,35,31,17,16,31,17,17,31,18,19,31,16,95,61,84,126,
+158,16,188,27,136,120,205,170,115,115,43,76,41,40,77,43,21,17,138,31,17,16,
+31,17,17,31,18,19,31,16,95,61,84,126,158,16,188,27,136,120,205,170,115,115,
+43,76,41,40,77,43,21,17,1,128,18,31,17,17,31,16,16,31,17,17,31,18,196,50,
+171,149,221,103,90,69,68,137,42,77,41,41,77,42,42,38,30,3,130,18,31,17,17,
+31,16,16,31,17,17,31,18,196,50,171,149,221,103,90,69,68,137,42,77,41,41,77,
+42,42,38,30,0,0,2,252,84,5,170,255,155,6,227,0,20,0,36,0,0,1,52,54,54,51,
+50,22,22,21,20,7,6,21,22,51,50,55,51,2,33,32,54,6,6,21,20,22,22,51,50,54,
+54,53,52,38,38,35,252,84,43,75,40,40,85,42,20,1,34,56,247,21,177,83,254,150,
+254,118,142,31,18,18,31,16,18,31,17,17,31,18,6,93,35,64,35,35,64,35,35,22,
+2,1,43,228,254,208,235,15,27,14,14,27,15,15,27,14,14,27,15,0,2,0,82,0,0,3,
+24,5,20,0,7,0,26,0,0,19,20,51,50,53,52,35,34,5,16,39,22,21,20,35,34,53,16,
+33,32,17,17,20,7,35,54,53,198,75,76,76,75,1,150,231,91,192,190,1,99,1,99,
+50,188,50,4,16,74,75,76,197,1,1,26,46,117,190,190,1,4,254,132,253,48,95,105,
+75,125,0,4,253,69,0,0,3,24,7,58,0,15,0,31,0,39,0,58,0,0,0,6,6,21,20,22,22,
+51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,
+1,20,51,50,53,52,35,34,5,16,39,22,21,20,35,34,53,16,33,32,17,17,20,7,35,54,
+53,253,249,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,
+96,2,235,75,76,76,75,1,150,231,91,192,190,1,99,1,99,50,188,50,6,194,21,38,
+21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,252,
+214,74,75,76,197,1,1,26,46,117,190,190,1,4,254,132,253,48,95,105,75,125,0,
+1,251,180,5,170,255,58,7,5,0,35,0,0,1,50,22,22,21,14,3,7,34,7,39,54,53,52,
+39,38,35,34,7,6,21,20,23,7,38,35,46,3,39,52,54,54,253,119,160,184,107,6,24,
+73,74,54,8,6,60,133,66,60,153,153,60,66,133,60,6,8,54,74,73,24,6,107,184,
+7,5,37,93,39,34,36,51,35,21,1,80,44,50,49,17,15,15,17,49,50,44,80,1,21,35,
+51,36,34,39,93,37,0,0,1,251,180,5,170,255,136,7,3,0,39,0,0,1,54,55,54,53,
+52,39,38,35,34,7,6,21,20,23,7,38,35,46,3,39,52,54,55,54,51,50,23,22,22,21,
+6,7,6,7,51,21,33,253,236,3,14,116,66,57,141,142,57,66,133,60,6,8,54,74,73,
+24,6,107,92,83,155,154,83,92,107,6,12,8,21,154,254,100,5,252,2,2,41,47,49,
+17,14,14,17,49,50,44,80,1,21,35,51,36,34,39,93,19,16,16,19,93,39,34,18,13,
+16,97,0,0,2,251,180,5,170,255,58,7,5,0,15,0,51,0,0,1,50,22,22,21,20,6,6,35,
+34,38,38,53,52,54,54,55,50,22,22,21,14,3,7,34,7,39,54,53,52,39,38,35,34,7,
+6,21,20,23,7,38,35,46,3,39,52,54,54,253,118,25,44,25,24,44,26,24,44,25,25,
+45,24,160,184,107,6,24,73,74,54,8,6,60,133,66,60,153,153,60,66,133,60,6,8,
+54,74,73,24,6,107,184,6,122,14,27,14,14,27,14,14,27,14,14,27,14,139,37,93,
+39,34,36,51,35,21,1,80,44,50,49,17,15,15,17,49,50,44,80,1,21,35,51,36,34,
+39,93,37,0,2,251,180,5,170,255,136,7,3,0,15,0,55,0,0,1,50,22,22,21,20,6,6,
+35,34,38,38,53,52,54,54,23,54,55,54,53,52,39,38,35,34,7,6,21,20,23,7,38,35,
+46,3,39,52,54,55,54,51,50,23,22,22,21,6,7,6,7,51,21,33,253,108,21,39,23,22,
+39,22,22,39,22,22,40,149,3,14,116,66,57,141,142,57,66,133,60,6,8,54,74,73,
+24,6,107,92,83,155,154,83,92,107,6,12,8,21,154,254,100,6,122,14,26,13,13,
+27,14,14,27,13,13,26,14,126,2,2,41,47,49,17,14,14,17,49,50,44,80,1,21,35,
+51,36,34,39,93,19,16,16,19,93,39,34,18,13,16,97,0,2,253,196,254,1,254,255,
+255,195,0,15,0,33,0,0,4,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,7,38,39,
+38,38,53,52,54,54,51,50,22,22,21,20,7,39,54,254,87,24,13,13,23,12,14,22,11,
+11,23,13,21,30,27,39,41,44,74,40,40,75,42,230,69,84,161,12,20,12,11,20,13,
+13,20,11,12,20,12,186,4,14,19,67,38,39,69,36,36,69,39,243,63,88,12,0,2,253,
+44,254,1,255,17,255,195,0,13,0,47,0,0,4,6,21,20,22,22,23,54,53,52,38,38,35,
+34,23,6,21,20,23,22,51,50,53,53,51,21,20,35,34,39,38,53,52,55,34,39,38,38,
+53,52,54,54,51,50,22,22,21,20,253,150,12,12,20,36,18,12,20,11,9,126,13,2,
+8,45,56,133,189,127,31,19,11,33,31,34,32,32,67,34,36,66,37,163,21,12,13,20,
+13,2,26,22,12,21,13,128,37,36,15,15,25,144,201,207,243,65,38,34,26,24,17,
+18,63,33,35,64,33,33,64,35,31,0,0,2,252,88,5,170,255,169,6,220,0,31,0,56,
+0,0,1,38,53,52,37,51,32,19,35,38,39,38,35,34,7,20,23,22,23,22,21,20,7,6,6,
+7,6,35,34,39,38,38,23,54,54,55,54,53,53,38,38,39,38,35,34,7,6,6,7,6,21,21,
+22,22,23,22,51,252,89,1,1,101,27,1,97,112,176,46,150,63,42,58,17,1,22,4,1,
+14,18,80,40,11,10,30,28,39,50,159,18,29,7,6,2,20,16,12,13,4,5,16,29,7,6,1,
+21,16,14,13,6,30,9,8,162,11,254,206,190,33,14,27,1,2,20,34,7,6,28,28,34,45,
+4,1,10,13,59,4,2,19,14,12,13,3,14,25,6,5,1,2,18,14,12,11,6,14,25,5,5,0,0,
+2,252,96,254,145,255,50,255,195,0,15,0,43,0,0,5,21,20,23,22,23,50,55,54,53,
+52,39,38,39,6,6,55,22,21,20,7,6,6,35,34,39,38,53,52,54,51,50,22,22,23,51,
+50,55,51,2,35,35,38,38,252,197,9,11,19,18,12,10,1,2,26,25,22,149,16,3,11,
+62,50,60,43,40,106,82,82,119,65,47,2,63,17,139,38,175,8,90,107,221,6,17,8,
+11,1,11,8,15,4,4,21,25,4,20,19,36,31,14,13,42,50,41,40,75,75,75,70,83,2,145,
+254,244,3,147,0,2,0,82,254,92,3,114,5,49,0,13,0,98,0,0,5,34,7,6,21,20,23,
+22,23,54,53,53,52,38,1,52,39,37,38,53,52,55,54,55,54,51,50,23,22,23,22,51,
+50,55,21,20,7,6,7,6,35,34,39,38,39,38,39,38,39,35,34,7,21,20,23,22,23,22,
+23,22,23,22,23,22,21,17,20,7,6,35,34,46,2,53,53,52,55,54,55,54,51,50,23,22,
+22,23,22,21,20,7,6,7,22,51,54,55,54,53,1,27,38,22,20,1,5,116,49,51,1,115,
+212,254,213,101,28,27,34,34,55,55,90,89,100,25,19,176,68,29,29,45,23,28,25,
+29,61,67,68,76,77,48,8,41,5,42,47,71,70,83,83,72,72,60,59,103,86,158,127,
+144,125,57,54,55,61,17,15,39,27,38,59,20,15,2,8,26,46,49,67,37,49,123,21,
+19,29,5,6,55,15,25,43,2,37,43,3,129,87,85,101,31,83,56,30,30,12,11,17,17,
+33,9,105,84,57,40,40,12,6,5,11,21,20,24,23,2,19,4,19,10,11,18,19,25,26,35,
+35,43,43,53,252,188,228,104,88,22,55,77,65,7,73,53,54,6,1,9,13,48,42,31,39,
+14,16,57,20,3,2,56,73,162,0,2,0,168,0,0,2,186,5,20,0,15,0,47,0,0,36,6,21,
+20,22,22,51,50,54,54,53,52,38,38,35,34,39,20,23,54,55,54,54,51,50,22,22,21,
+20,7,6,35,34,39,38,53,17,52,55,54,51,50,23,38,35,34,6,21,1,225,13,13,24,13,
+13,24,13,14,23,13,13,149,15,4,13,20,72,38,38,71,41,43,45,92,154,80,86,86,
+79,129,198,38,98,98,98,48,207,24,13,13,24,13,13,24,13,13,24,13,80,60,42,24,
+23,36,39,39,72,39,83,42,45,70,74,156,2,188,157,75,68,174,60,101,85,0,0,4,
+0,168,0,0,5,50,5,20,0,15,0,47,0,63,0,95,0,0,36,6,21,20,22,22,51,50,54,54,
+53,52,38,38,35,34,39,20,23,54,55,54,54,51,50,22,22,21,20,7,6,35,34,39,38,
+53,17,52,55,54,51,50,23,38,35,34,6,21,0,6,21,20,22,22,51,50,54,54,53,52,38,
+38,35,34,39,20,23,54,55,54,54,51,50,22,22,21,20,7,6,35,34,39,38,53,17,52,
+55,54,51,50,23,38,35,34,6,21,1,225,13,13,24,13,13,24,13,14,23,13,13,149,15,
+4,13,20,72,38,38,71,41,43,45,92,154,80,86,86,79,129,198,38,98,98,98,48,2,
+245,13,13,24,13,13,24,13,14,23,13,13,149,15,4,13,20,72,38,38,71,41,43,45,
+92,154,80,86,86,79,129,198,38,98,98,98,48,207,24,13,13,24,13,13,24,13,13,
+24,13,80,60,42,24,23,36,39,39,72,39,83,42,45,70,74,156,2,188,157,75,68,174,
+60,101,85,252,231,24,13,13,24,13,13,24,13,13,24,13,80,60,42,24,23,36,39,39,
+72,39,83,42,45,70,74,156,2,188,157,75,68,174,60,101,85,0,0,2,0,0,0,0,3,11,
+7,142,0,15,0,78,0,0,37,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,19,6,7,
+6,21,17,20,23,54,55,54,54,51,50,22,22,21,20,7,6,35,34,39,38,53,17,52,55,1,
+38,39,53,52,55,54,55,54,51,50,23,23,22,51,50,55,6,35,34,39,39,38,35,34,7,
+6,21,20,23,1,23,6,35,23,1,253,13,24,13,13,24,13,14,23,13,13,24,13,95,127,
+39,41,15,4,13,20,72,38,38,71,41,43,45,92,175,79,66,164,254,213,67,7,41,61,
+72,11,11,89,58,107,160,80,10,79,79,92,93,159,117,32,29,28,25,9,39,1,192,5,
+1,1,2,170,13,24,13,13,24,13,13,24,13,13,24,4,100,84,64,66,83,253,58,60,42,
+24,23,36,39,39,72,39,83,42,45,90,74,136,2,198,180,125,1,8,59,97,7,72,52,62,
+5,1,51,92,144,2,109,143,104,30,31,12,12,27,33,254,122,2,1,2,0,0,2,0,0,0,0,
+3,32,7,152,0,15,0,79,0,0,37,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,1,
+6,21,20,23,22,51,50,55,22,21,20,7,6,35,34,39,46,3,53,52,55,54,51,50,23,22,
+21,20,7,6,21,17,20,23,54,55,54,54,51,50,22,22,21,20,7,6,35,34,39,38,53,17,
+52,55,54,53,52,39,38,35,34,2,88,13,24,13,13,24,13,14,23,13,13,24,13,254,118,
+62,88,8,7,107,42,9,33,51,65,14,15,57,86,61,23,96,100,205,204,99,96,186,126,
+15,4,13,20,72,38,38,71,41,43,45,92,175,79,66,209,157,64,67,134,130,170,13,
+24,13,13,24,13,13,24,13,13,24,6,50,46,92,122,15,1,107,39,32,63,40,60,3,4,
+56,73,80,49,153,78,82,87,83,164,152,172,114,91,252,243,60,42,24,23,36,39,
+39,72,39,83,42,45,90,74,136,3,13,138,159,116,116,102,52,53,0,2,255,216,0,
+0,2,197,7,120,0,15,0,73,0,0,37,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,
+39,20,23,54,55,54,54,51,50,22,22,21,20,7,6,35,34,39,38,53,17,52,55,54,54,
+53,52,38,35,34,6,35,34,38,39,38,38,39,30,3,23,30,3,51,50,54,51,50,22,21,20,
+7,6,21,1,253,13,24,13,13,24,13,14,23,13,13,24,13,112,15,4,13,20,72,38,38,
+71,41,43,45,92,175,79,66,160,160,29,22,12,23,120,31,59,70,24,41,64,132,195,
+87,35,10,11,11,15,12,18,17,22,98,51,51,116,160,152,170,13,24,13,13,24,13,
+13,24,13,13,24,117,60,42,24,23,36,39,39,72,39,83,42,45,90,74,136,2,198,105,
+97,97,27,16,16,11,54,82,98,161,178,68,5,112,98,27,42,36,69,37,28,54,72,68,
+97,91,91,83,0,2,0,147,254,92,4,123,5,20,0,7,0,59,0,0,1,34,21,20,51,50,53,
+52,1,16,33,34,38,38,39,22,22,33,32,53,17,38,35,34,7,6,35,34,39,38,38,35,34,
+7,6,21,21,54,51,50,21,6,7,38,53,52,54,51,50,22,23,22,51,51,62,2,51,50,17,
+1,129,69,69,69,2,181,254,57,112,203,137,41,46,176,1,15,1,21,6,72,60,66,62,
+57,4,4,61,140,61,43,22,20,41,53,173,10,173,228,144,101,45,80,46,43,35,3,35,
+94,63,57,254,3,178,69,69,69,69,252,28,254,142,27,117,157,78,96,243,3,232,
+206,49,46,1,3,91,42,38,62,17,42,141,180,2,6,255,168,155,43,29,28,1,57,42,
+254,162,0,0,1,253,49,7,58,253,193,8,107,0,3,0,0,1,51,17,35,253,49,144,144,
+8,107,254,207,0,2,252,114,7,68,255,65,8,102,0,16,0,46,0,0,1,54,53,52,39,38,
+35,35,6,7,6,21,20,23,22,51,50,6,39,38,53,53,54,55,54,51,50,23,22,23,22,21,
+21,6,7,54,54,55,23,14,2,35,35,53,54,55,253,101,7,3,12,22,9,29,1,1,26,14,15,
+7,97,30,32,4,44,36,47,10,11,71,22,20,2,77,128,158,41,130,61,122,182,140,214,
+136,54,7,248,13,9,6,5,18,5,21,1,1,19,3,2,45,18,20,33,7,38,23,17,1,5,29,27,
+39,7,44,61,8,98,82,43,88,81,53,65,20,44,0,0,1,252,81,7,58,0,10,8,102,0,63,
+0,0,0,7,38,38,53,52,62,2,51,50,22,22,23,54,54,55,50,22,22,23,22,21,21,54,
+54,55,22,22,23,22,21,20,7,14,2,7,38,39,39,54,55,54,55,38,39,38,35,35,6,6,
+35,34,38,39,34,6,21,20,23,22,23,7,253,13,8,96,84,49,53,72,52,27,58,74,15,
+38,78,59,47,83,47,13,11,35,20,17,41,46,17,1,28,31,89,115,65,6,5,58,35,40,
+45,1,10,28,27,42,3,31,113,26,24,113,37,42,57,56,34,28,46,7,60,2,28,75,47,
+35,54,39,22,16,48,11,21,47,7,26,38,19,17,24,6,34,43,43,1,20,20,4,4,43,35,
+40,54,53,10,1,1,55,15,23,24,22,24,23,22,2,105,103,1,49,27,21,25,16,11,60,
+0,1,253,61,7,48,254,205,8,97,0,11,0,0,1,53,35,53,51,53,51,21,51,21,35,21,
+253,195,134,134,133,133,133,7,48,104,97,104,104,97,104,0,0,2,253,48,7,8,255,
+76,8,127,0,31,0,53,0,0,1,38,53,52,55,54,55,54,51,50,23,22,51,50,55,54,55,
+23,6,7,6,35,35,22,21,20,7,6,6,35,34,38,54,23,22,51,51,54,55,54,53,52,39,38,
+39,38,35,35,6,7,6,21,20,23,253,50,2,23,28,42,27,46,26,31,17,17,68,58,72,30,
+55,33,55,50,68,15,2,5,10,74,67,67,88,98,19,14,18,11,25,13,10,1,5,19,14,17,
+13,23,13,10,1,7,121,13,10,41,29,37,13,8,2,2,23,30,62,97,58,29,27,10,13,20,
+27,44,50,58,40,11,9,5,16,12,14,5,4,19,12,8,4,16,13,15,4,5,0,2,253,51,7,8,
+254,195,8,115,0,15,0,31,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,
+53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,253,231,38,22,22,38,20,21,38,
+21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,8,6,19,34,19,20,34,19,19,34,
+20,19,34,19,109,47,87,47,48,86,48,48,86,48,47,87,47,0,0,2,0,147,0,0,4,23,
+5,20,0,11,0,23,0,0,1,34,2,17,16,22,51,50,54,17,16,2,3,34,2,17,16,18,51,50,
+18,17,16,2,2,85,131,131,131,131,131,131,131,131,225,225,225,225,225,225,225,
+4,176,254,253,254,222,254,221,250,250,1,35,1,34,1,3,251,80,1,32,1,107,1,106,
+1,31,254,225,254,150,254,149,254,224,0,0,2,0,147,0,0,4,123,5,20,0,11,0,58,
+0,0,1,52,38,35,34,6,21,20,22,51,50,54,18,5,39,36,18,53,52,2,35,34,6,21,20,
+22,23,38,38,53,62,3,51,50,22,22,21,20,14,2,7,6,35,34,39,46,2,53,52,18,51,
+50,0,17,16,2,190,47,32,34,46,46,34,32,47,121,254,185,162,1,132,247,185,170,
+137,142,89,56,51,21,8,57,73,64,24,44,90,64,69,81,67,60,9,10,55,76,90,117,
+51,246,221,254,1,23,2,189,31,45,45,31,33,42,42,253,125,25,60,81,1,73,240,
+202,1,32,212,173,132,87,8,33,80,17,63,73,37,10,47,97,62,74,95,55,20,5,1,23,
+27,103,136,73,229,1,8,254,199,254,235,254,188,0,0,2,0,147,0,0,4,173,6,103,
+0,43,0,55,0,0,0,5,4,21,20,30,2,51,50,55,46,2,53,52,54,54,55,54,51,51,30,3,
+21,20,6,6,7,6,6,35,34,0,17,52,54,54,55,36,54,55,2,38,35,34,6,21,20,22,51,
+50,54,53,4,33,254,152,254,150,30,59,181,86,70,53,46,29,19,46,70,40,30,27,
+16,46,72,50,29,6,37,87,93,107,125,254,254,222,51,179,245,1,4,156,159,181,
+46,31,32,44,44,32,31,46,5,27,205,207,204,236,136,140,69,48,45,41,43,18,60,
+73,41,7,4,2,35,54,67,33,39,49,77,68,43,23,1,19,1,160,98,143,155,141,146,124,
+141,250,223,43,43,31,29,43,43,29,0,2,0,82,0,0,5,45,7,7,0,7,0,60,0,0,55,50,
+53,52,35,34,21,20,1,52,38,36,38,53,52,54,51,50,23,5,7,37,38,35,34,6,21,20,
+22,23,5,22,23,17,20,6,35,34,39,39,6,35,32,53,52,51,50,21,20,7,54,53,17,51,
+17,20,22,51,50,54,53,243,62,62,61,3,187,204,254,210,82,89,66,123,112,1,130,
+73,254,150,130,37,17,19,30,22,1,164,131,35,230,195,185,125,1,78,171,254,254,
+161,162,43,103,188,146,101,101,136,158,62,61,61,62,3,252,43,123,130,114,58,
+77,76,56,171,108,164,54,32,11,18,38,15,195,63,136,252,230,190,190,95,1,96,
+220,162,162,65,39,22,184,3,210,252,104,167,113,113,167,0,0,3,0,147,0,0,4,
+133,6,69,0,7,0,17,0,71,0,0,1,34,21,20,51,50,53,52,3,50,53,52,35,35,34,7,21,
+20,19,22,21,20,7,6,7,5,6,6,21,16,23,22,51,50,54,55,17,52,51,50,21,20,35,34,
+39,21,54,51,50,21,20,35,34,39,6,6,35,34,2,17,52,55,54,54,55,37,62,3,55,54,
+3,220,53,53,62,69,56,64,3,23,12,76,27,19,41,38,254,81,141,33,15,15,102,66,
+151,63,222,188,188,22,12,13,22,163,152,141,93,65,149,69,186,131,19,20,98,
+100,1,214,26,42,33,23,6,13,2,111,55,65,65,55,253,242,45,45,2,4,84,5,228,84,
+58,48,29,64,17,190,93,190,182,254,247,120,155,121,58,1,23,175,175,175,3,105,
+2,147,146,125,58,67,1,23,1,115,182,79,83,168,49,215,13,38,43,39,11,22,0,4,
+0,147,0,0,4,139,6,167,0,9,0,17,0,27,0,95,0,0,1,52,38,35,34,6,21,22,23,54,
+19,34,21,20,51,50,53,52,3,50,53,52,35,35,34,7,21,20,19,20,6,6,35,6,7,4,6,
+21,16,23,22,51,50,54,55,17,52,51,50,21,20,35,34,39,21,54,51,50,21,20,35,34,
+39,6,6,35,34,2,17,52,55,54,54,37,46,2,39,38,53,52,55,62,3,51,50,22,22,23,
+21,20,7,54,54,3,11,44,34,31,46,12,94,49,209,53,53,62,69,56,64,3,23,12,228,
+84,146,154,13,80,254,239,78,15,15,102,66,151,63,222,188,188,22,12,13,22,163,
+152,141,93,65,149,69,186,131,19,20,157,1,6,42,48,27,2,2,2,7,44,59,70,33,75,
+86,39,5,21,53,164,5,144,31,41,41,31,67,1,27,253,8,55,65,65,55,253,242,45,
+45,2,4,84,6,70,179,175,105,41,33,103,235,182,254,247,120,121,87,58,1,23,175,
+175,175,3,105,2,147,146,125,58,67,1,23,1,115,182,79,83,200,83,12,51,55,27,
+12,10,11,8,43,59,35,17,56,71,31,10,30,51,16,161,0,3,0,168,0,0,4,188,6,95,
+0,9,0,93,0,107,0,0,0,23,54,53,52,38,35,34,6,21,3,6,35,34,39,17,20,51,50,54,
+55,38,38,39,53,52,55,54,51,50,23,22,21,21,6,6,7,22,22,51,50,53,17,52,36,38,
+38,53,52,54,51,50,22,22,23,37,38,35,34,6,21,20,22,23,23,22,23,17,16,5,34,
+38,39,38,39,39,7,6,7,6,6,35,36,17,17,52,55,54,55,22,23,22,21,20,39,6,21,20,
+51,50,55,54,53,52,39,38,35,34,2,149,29,29,11,18,18,11,124,38,73,53,17,79,
+41,120,37,29,33,6,35,34,56,56,34,35,6,33,29,37,120,41,79,254,240,53,12,75,
+62,67,109,152,48,254,233,46,23,16,18,28,21,253,62,30,254,236,53,123,27,19,
+14,10,10,14,19,27,123,53,254,236,86,57,95,86,43,44,219,21,67,32,17,19,18,
+17,33,29,1,213,52,52,41,47,58,58,47,1,248,37,16,253,138,253,142,72,46,85,
+75,19,76,44,43,43,44,76,19,75,85,46,72,142,253,2,206,60,221,69,43,24,52,81,
+69,103,159,176,26,20,10,17,35,14,183,39,107,253,54,254,165,16,90,36,25,26,
+17,17,26,25,36,90,16,1,91,2,124,177,73,49,2,1,40,40,80,85,140,17,38,67,15,
+16,36,35,17,16,0,3,0,82,254,112,5,88,5,20,0,7,0,16,0,61,0,0,55,20,51,50,53,
+52,35,34,19,53,52,35,34,21,20,51,50,23,35,34,39,38,53,52,55,54,51,50,23,54,
+51,50,22,21,17,20,23,34,38,53,17,52,38,35,34,7,7,17,20,7,6,35,34,39,38,53,
+52,55,54,51,50,23,198,75,76,76,75,142,72,70,113,15,14,27,124,57,50,49,48,
+94,202,42,111,218,217,215,90,118,160,122,122,188,97,33,71,63,121,102,47,42,
+42,48,101,37,30,191,75,75,76,3,10,23,118,71,71,114,53,46,86,94,46,45,141,
+141,176,174,251,230,205,95,175,125,4,26,89,151,157,48,253,43,137,65,58,54,
+48,89,90,47,54,7,0,4,0,168,254,92,4,202,5,20,0,15,0,29,0,43,0,110,0,0,1,20,
+22,22,51,50,54,54,53,52,38,38,35,34,6,6,55,53,5,7,4,21,20,22,51,50,55,54,
+55,54,37,54,53,52,39,38,35,34,21,20,23,22,51,50,39,54,51,50,23,22,21,20,7,
+6,35,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,6,7,7,22,23,22,
+22,21,20,6,6,35,34,38,38,53,53,6,7,6,35,34,38,53,52,37,37,17,52,38,35,34,
+7,38,35,34,6,21,3,154,25,45,24,23,44,25,25,44,23,24,45,25,108,254,213,132,
+254,245,53,60,84,110,122,103,166,254,13,22,17,19,39,76,27,18,31,34,156,46,
+76,95,48,47,48,47,95,130,75,105,95,72,129,133,96,96,133,130,74,92,34,65,32,
+13,14,52,60,58,105,58,57,104,59,31,30,144,133,140,127,1,126,1,212,70,38,70,
+159,159,70,38,70,254,251,16,30,16,16,30,16,15,31,15,15,31,246,35,74,35,63,
+63,36,32,63,66,20,97,243,19,41,36,19,21,76,45,18,12,236,30,48,48,96,95,48,
+47,52,71,172,2,23,215,93,72,173,173,74,94,212,252,104,64,43,20,5,4,19,73,
+40,39,72,41,41,72,39,9,13,19,88,105,74,140,94,115,3,3,146,120,213,213,120,
+146,0,0,2,0,168,0,0,5,48,5,20,0,7,0,52,0,0,37,38,39,6,7,22,23,54,37,16,33,
+32,17,17,16,35,34,17,17,54,51,50,22,22,23,22,21,20,7,14,3,35,38,38,53,17,
+16,33,32,17,17,20,51,50,53,17,52,39,51,22,21,1,216,2,52,66,6,6,66,50,3,92,
+254,192,254,192,166,166,31,31,31,70,49,9,6,1,6,41,57,52,37,117,104,1,98,1,
+98,132,132,50,188,50,193,50,4,4,54,66,6,6,220,254,169,1,87,2,79,1,0,255,0,
+253,179,19,29,62,35,27,34,13,13,51,58,30,10,6,221,97,2,96,1,110,254,146,253,
+177,233,233,2,245,125,75,105,95,0,3,0,147,0,0,8,39,5,20,0,7,0,16,0,98,0,0,
+1,50,53,52,35,34,21,20,5,53,52,35,34,21,20,51,50,1,20,6,35,34,39,38,39,6,
+33,54,54,53,17,52,38,35,34,7,17,20,7,6,35,34,39,38,53,16,55,54,55,38,38,53,
+52,54,51,50,22,21,20,2,17,20,22,51,50,54,53,17,35,34,39,38,53,52,55,54,51,
+50,23,54,51,50,22,21,17,6,7,22,22,51,50,54,53,17,52,39,51,22,21,1,61,64,64,
+64,2,55,32,40,43,15,5,1,157,142,121,98,33,38,88,254,208,157,97,62,72,118,
+100,99,91,250,230,91,100,116,40,27,91,92,93,92,84,103,184,95,139,158,93,27,
+54,57,50,49,48,64,162,42,81,148,167,155,1,9,58,114,58,59,72,50,188,50,4,31,
+63,64,64,63,10,23,118,71,71,253,44,177,143,106,35,3,144,74,173,103,2,148,
+89,91,205,253,157,210,85,79,78,86,210,1,62,155,52,47,1,86,85,91,91,91,91,
+126,254,168,254,238,168,96,98,166,2,44,53,46,86,94,46,45,141,141,166,124,
+253,108,53,45,5,137,62,148,3,12,125,75,105,95,0,4,0,147,0,0,8,40,5,20,0,7,
+0,16,0,25,0,108,0,0,1,50,53,52,35,34,21,20,5,53,52,35,34,21,20,51,50,1,34,
+21,20,51,50,53,53,38,37,20,7,6,35,34,39,38,53,16,55,54,55,38,38,53,52,54,
+51,50,22,21,20,2,17,20,22,51,50,54,53,17,35,34,39,38,53,52,55,54,51,50,23,
+54,51,50,22,21,17,22,51,50,54,53,17,52,39,51,22,21,17,20,6,35,34,39,6,35,
+34,39,38,53,52,55,54,51,51,17,52,38,35,34,7,1,61,64,64,64,2,55,32,40,43,15,
+2,13,43,40,32,14,254,174,99,91,250,230,91,100,116,40,27,91,92,93,92,84,103,
+184,95,139,158,93,27,54,57,50,49,48,64,162,42,81,148,167,155,100,118,72,62,
+50,188,50,155,167,148,81,42,162,64,48,49,50,57,54,27,62,72,118,100,4,31,63,
+64,64,63,10,23,118,71,71,252,236,71,71,118,23,1,118,210,85,79,78,86,210,1,
+62,155,52,47,1,86,85,91,91,91,91,126,254,168,254,238,168,96,98,166,2,44,53,
+46,86,94,46,45,141,141,166,124,253,73,205,91,89,3,42,125,75,105,95,252,214,
+124,166,141,141,45,46,94,86,46,53,2,128,89,91,205,0,0,1,253,49,5,170,253,
+193,6,214,0,3,0,0,1,51,17,35,253,49,144,144,6,214,254,212,0,2,252,127,5,170,
+255,78,6,214,0,16,0,46,0,0,1,54,53,52,39,38,35,35,6,7,6,21,20,23,22,51,50,
+6,39,38,53,53,54,55,54,51,50,23,22,23,22,21,21,6,7,54,54,55,23,14,2,35,35,
+53,54,55,253,114,7,3,12,22,9,29,1,1,26,14,15,7,97,30,32,4,44,36,47,10,11,
+71,22,20,2,77,128,158,41,130,61,122,182,140,214,136,54,6,100,14,9,6,5,19,
+5,21,2,1,20,3,2,46,19,20,34,8,39,23,18,1,5,30,28,41,7,46,62,7,102,85,44,91,
+84,55,67,21,46,0,0,1,252,71,5,170,0,0,6,214,0,63,0,0,0,7,38,38,53,52,62,2,
+51,50,22,22,23,54,54,55,50,22,22,23,22,21,21,54,54,55,22,22,23,22,21,20,7,
+14,2,7,38,39,39,54,55,54,55,38,39,38,35,35,6,6,35,34,38,39,34,6,21,20,23,
+22,23,7,253,3,8,96,84,49,53,72,52,27,58,74,15,38,78,59,47,83,47,13,11,35,
+20,17,41,46,17,1,28,31,89,115,65,6,5,58,35,40,45,1,10,28,27,42,3,31,113,26,
+24,113,37,42,57,56,34,28,46,5,172,2,28,75,47,35,54,39,22,16,48,11,21,47,7,
+26,38,19,17,24,6,34,43,43,1,20,20,4,4,43,35,40,54,53,10,1,1,55,15,23,24,22,
+24,23,22,2,105,103,1,49,27,21,25,16,11,60,0,1,253,71,5,170,254,215,6,214,
+0,11,0,0,1,53,35,53,51,53,51,21,51,21,35,21,253,205,134,134,133,133,133,5,
+170,102,95,103,103,95,102,0,0,2,253,48,5,170,255,76,7,58,0,31,0,55,0,0,1,
+38,53,52,55,54,55,54,51,50,23,22,51,50,55,54,55,23,6,7,6,35,35,22,21,20,7,
+6,6,35,34,38,54,23,22,51,50,55,54,55,54,53,52,39,38,39,38,35,34,7,6,7,6,21,
+20,23,253,50,2,23,28,42,27,46,26,31,17,17,68,58,72,30,55,33,55,50,68,15,2,
+5,10,74,67,67,88,98,19,14,18,5,6,25,13,10,1,5,19,14,17,6,7,23,13,10,1,6,35,
+13,11,43,32,39,14,9,3,2,25,31,67,103,62,31,29,11,14,21,29,47,53,61,43,12,
+9,1,4,18,12,15,6,4,21,12,9,1,4,17,14,16,4,5,0,2,253,41,5,170,254,185,7,58,
+0,15,0,31,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,253,221,38,22,22,38,20,21,38,21,21,38,21,51,
+95,54,52,96,52,51,96,53,54,96,6,194,21,38,21,21,38,21,21,38,21,21,38,21,120,
+52,96,52,52,95,53,53,95,52,52,96,52,0,0,4,252,224,5,170,255,175,8,79,0,16,
+0,46,0,62,0,78,0,0,1,54,53,52,39,38,35,34,7,6,7,6,21,20,23,22,51,6,39,38,
+53,53,54,55,54,51,50,23,22,23,22,21,21,6,7,54,54,55,23,14,2,35,35,53,54,55,
+18,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,
+38,38,53,52,54,54,253,211,7,3,12,22,4,5,29,1,1,26,14,15,90,30,32,4,44,36,
+47,10,11,71,22,20,2,77,128,158,41,130,61,122,182,140,214,136,54,62,38,22,
+22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,7,208,16,10,7,
+6,21,1,5,24,2,1,22,3,2,52,21,23,37,9,43,26,20,1,5,34,31,45,8,51,69,8,113,
+94,49,101,93,60,74,23,51,254,243,16,31,17,17,30,17,17,30,17,17,31,16,96,41,
+77,42,41,77,42,42,77,41,42,77,41,0,3,253,41,5,170,254,185,8,69,0,15,0,31,
+0,35,0,0,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,
+6,35,34,38,38,53,52,54,54,3,51,17,35,253,221,38,22,22,38,20,21,38,21,21,38,
+21,51,95,54,52,96,52,51,96,53,54,96,22,144,144,6,157,19,33,18,18,33,18,18,
+33,18,18,33,19,103,45,83,45,45,82,46,46,82,45,45,83,45,1,65,254,209,0,5,0,
+82,0,0,4,254,7,58,0,7,0,16,0,61,0,77,0,93,0,0,55,20,51,50,53,52,35,34,19,
+53,52,35,34,21,20,51,50,18,35,34,39,38,53,52,55,54,51,50,23,17,35,34,39,38,
+53,52,55,54,51,50,23,54,51,50,22,21,17,20,7,35,54,53,17,52,38,35,34,7,7,17,
+20,7,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,
+34,38,38,53,52,54,54,198,75,76,76,75,142,72,70,113,15,68,121,102,47,42,42,
+48,101,37,30,27,124,57,50,49,48,94,202,42,111,218,217,215,50,188,50,122,122,
+188,97,33,71,1,134,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,
+96,53,54,96,191,75,75,76,3,10,23,118,71,71,251,236,54,48,89,90,47,54,7,2,
+43,53,46,86,94,46,45,141,141,176,174,253,18,95,105,75,125,2,238,89,151,157,
+48,253,43,137,65,6,136,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,
+95,53,53,95,52,52,96,52,0,4,0,147,255,156,5,17,7,58,0,53,0,69,0,85,0,101,
+0,0,1,32,17,16,33,32,22,21,20,4,7,7,6,21,20,51,50,54,51,50,19,7,38,38,35,
+34,6,35,34,38,53,16,55,55,54,54,53,52,38,35,32,21,21,54,55,54,51,50,22,22,
+21,20,6,6,38,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,18,6,6,21,20,22,22,
+51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,
+1,161,254,242,2,18,1,24,250,254,217,235,171,171,104,104,227,162,241,124,60,
+91,136,78,119,220,154,146,146,249,248,158,217,156,186,254,126,19,28,38,41,
+40,77,43,42,76,59,32,18,17,32,18,18,32,18,19,32,17,250,38,22,22,38,20,21,
+38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,2,188,1,5,1,83,164,215,171,
+178,58,44,45,195,120,154,254,255,107,146,74,120,115,115,1,9,63,64,40,140,
+119,143,126,229,1,24,16,20,41,77,42,42,76,42,228,18,32,18,18,32,17,17,32,
+18,18,32,18,3,34,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,
+53,95,52,52,96,52,0,0,4,0,147,0,0,4,173,7,58,0,13,0,61,0,77,0,93,0,0,37,54,
+53,52,39,38,35,34,21,20,23,22,51,50,1,52,38,35,34,6,21,20,51,51,21,35,34,
+21,21,54,51,50,23,22,21,20,7,6,35,34,39,38,53,53,52,55,38,53,52,55,54,33,
+32,23,22,21,17,20,7,35,54,53,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,
+53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,254,22,17,19,39,76,27,18,
+31,34,2,6,161,180,180,153,212,80,80,212,46,76,95,48,47,48,47,95,130,75,105,
+163,163,120,125,1,20,1,19,124,130,50,188,50,254,180,38,22,22,38,20,21,38,
+21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,131,19,41,36,19,21,76,45,18,
+12,3,36,127,143,119,121,170,134,216,78,30,48,48,96,95,48,47,52,71,172,135,
+207,73,66,174,187,80,83,92,95,193,253,48,95,105,75,125,5,250,21,38,21,21,
+38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,0,4,0,32,
+254,112,2,230,7,58,0,7,0,31,0,47,0,63,0,0,19,20,51,50,53,52,35,34,0,35,34,
+39,22,51,50,54,53,17,52,39,22,21,20,35,34,53,16,33,32,17,17,20,0,6,6,21,20,
+22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,
+54,54,198,75,76,76,75,1,95,129,229,159,159,139,123,101,141,51,192,190,1,49,
+1,99,254,187,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,
+54,96,4,16,74,75,76,250,19,204,100,184,112,3,152,217,26,46,77,190,190,1,4,
+254,132,252,104,190,7,128,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,
+52,95,53,53,95,52,52,96,52,0,0,4,0,82,0,0,4,58,7,58,0,9,0,63,0,79,0,95,0,
+0,1,54,53,52,35,34,7,21,20,51,0,35,34,39,38,53,52,55,54,53,6,35,35,38,39,
+38,39,53,52,55,54,55,51,50,23,22,23,22,21,20,7,6,21,20,51,50,53,17,52,38,
+35,34,6,7,16,55,54,51,32,22,21,17,20,7,0,6,6,21,20,22,22,51,50,54,54,53,52,
+38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,2,72,75,72,74,3,72,
+1,127,166,176,42,20,27,51,21,64,6,81,42,43,3,43,46,93,5,98,56,51,13,10,27,
+44,76,95,153,194,119,228,118,124,125,211,1,35,249,54,254,161,38,22,22,38,
+20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,2,79,1,69,67,68,5,64,
+253,177,105,46,77,95,55,103,5,19,12,47,47,84,10,76,47,48,16,39,36,69,51,47,
+76,63,103,129,131,95,2,185,107,167,76,237,1,7,87,87,225,173,253,67,93,50,
+6,136,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,
+52,96,52,0,4,0,147,254,122,5,20,7,58,0,15,0,73,0,89,0,105,0,0,0,21,20,22,
+22,51,50,54,54,53,52,38,38,35,34,6,37,52,38,35,32,21,21,54,55,54,51,50,22,
+22,21,20,6,6,35,32,17,16,33,32,22,21,20,4,7,7,6,21,20,51,50,36,51,50,23,22,
+21,20,23,36,53,52,35,34,4,35,34,38,53,16,55,55,54,54,0,6,6,21,20,22,22,51,
+50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,94,
+17,32,18,18,32,18,19,32,17,17,32,2,139,156,186,254,126,19,28,38,41,40,77,
+43,42,76,42,254,242,2,18,1,24,250,254,217,235,171,171,74,74,1,99,107,125,
+63,64,103,254,221,64,104,254,204,124,116,146,249,248,158,217,254,170,38,22,
+22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,3,110,18,18,32,
+17,17,32,18,18,32,18,18,11,143,126,229,1,24,16,20,41,77,42,42,76,42,1,5,1,
+83,164,215,171,178,58,44,45,195,120,195,62,64,239,210,120,90,240,221,161,
+115,115,1,9,63,64,40,140,3,160,21,38,21,21,38,21,21,38,21,21,38,21,120,52,
+96,52,52,95,53,53,95,52,52,96,52,0,4,0,147,0,0,4,223,7,58,0,13,0,61,0,77,
+0,93,0,0,1,34,7,6,21,20,51,50,55,54,53,52,39,38,1,20,7,6,33,32,39,38,53,52,
+55,38,53,53,52,55,54,51,50,23,22,21,20,7,6,35,34,39,21,20,51,51,21,35,34,
+21,20,22,51,50,54,53,17,52,55,51,6,21,0,6,6,21,20,22,22,51,50,54,54,53,52,
+38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,201,31,18,27,76,
+39,19,17,22,19,2,194,130,124,254,237,254,236,125,120,163,163,105,75,130,95,
+47,48,47,48,95,76,46,212,80,80,212,153,180,180,161,50,188,50,254,62,38,22,
+22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,4,160,12,18,45,
+76,21,19,36,41,19,15,252,220,193,95,92,83,80,187,224,66,73,157,135,172,71,
+52,47,48,95,96,48,48,30,78,166,134,220,121,119,143,127,2,208,95,105,75,125,
+2,118,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,
+52,96,52,0,0,4,0,168,0,0,4,194,7,58,0,13,0,48,0,64,0,80,0,0,37,54,53,52,39,
+38,35,34,21,20,23,22,51,50,1,52,38,35,34,6,21,17,54,51,50,23,22,21,20,7,6,
+35,34,39,38,53,17,52,54,33,32,22,21,17,20,7,35,54,53,0,6,6,21,20,22,22,51,
+50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,2,19,
+22,17,19,39,76,27,18,31,34,2,6,161,180,180,153,46,76,95,48,47,48,47,95,130,
+75,105,245,1,20,1,19,254,50,188,50,254,159,38,22,22,38,20,21,38,21,21,38,
+21,51,95,54,52,96,52,51,96,53,54,96,131,19,41,36,19,21,76,45,18,12,3,36,127,
+143,143,127,253,200,30,48,48,96,95,48,47,52,71,172,2,113,193,187,187,193,
+253,48,95,105,75,125,5,250,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,
+52,52,95,53,53,95,52,52,96,52,0,0,4,0,168,0,0,4,194,7,58,0,13,0,58,0,74,0,
+90,0,0,37,54,53,52,39,38,35,34,21,20,23,22,51,50,39,54,51,50,23,22,21,20,
+7,6,35,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,35,54,53,
+17,52,38,35,34,7,38,35,34,6,21,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,
+35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,2,19,22,17,19,39,76,27,18,
+31,34,156,46,76,95,48,47,48,47,95,130,75,105,95,72,129,133,96,96,133,130,
+74,92,50,188,50,70,38,70,159,159,70,38,70,1,65,38,22,22,38,20,21,38,21,21,
+38,21,51,95,54,52,96,52,51,96,53,54,96,131,19,41,36,19,21,76,45,18,12,236,
+30,48,48,96,95,48,47,52,71,172,2,113,215,93,72,173,173,74,94,212,253,48,95,
+105,75,125,2,208,146,120,213,213,120,146,3,42,21,38,21,21,38,21,21,38,21,
+21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,0,5,0,82,254,112,5,88,
+7,58,0,7,0,16,0,61,0,77,0,93,0,0,1,34,21,20,51,50,53,52,1,53,52,35,34,21,
+20,51,50,19,54,51,50,23,22,21,20,7,6,35,34,39,38,53,17,35,34,39,38,53,52,
+55,54,51,50,23,54,51,50,22,21,17,20,23,34,38,53,17,52,38,35,34,7,7,0,6,6,
+21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,
+53,52,54,54,2,83,76,76,75,254,182,72,70,113,15,202,30,37,101,48,42,42,47,
+102,121,63,71,27,124,57,50,49,48,94,202,42,111,218,217,215,90,118,160,122,
+122,188,97,33,1,63,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,
+96,53,54,96,1,11,76,75,75,76,3,10,23,118,71,71,253,99,7,54,47,90,89,48,54,
+58,65,137,2,158,53,46,86,94,46,45,141,141,176,174,251,230,205,95,175,125,
+4,26,89,151,157,48,2,233,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,
+52,95,53,53,95,52,52,96,52,0,0,4,0,147,0,0,5,185,7,58,0,7,0,60,0,76,0,92,
+0,0,1,50,53,52,35,34,21,20,5,52,38,35,34,6,21,17,20,7,6,35,34,39,38,53,16,
+55,54,55,38,38,53,52,54,51,50,22,21,20,2,17,20,22,51,50,54,53,17,52,55,54,
+51,50,23,22,21,17,20,7,35,54,53,2,6,6,21,20,22,22,51,50,54,54,53,52,38,38,
+35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,61,64,64,64,4,0,94,87,
+87,94,99,91,194,193,91,100,116,40,27,91,92,93,92,104,103,204,95,101,103,93,
+105,86,178,178,87,104,50,188,50,190,38,22,22,38,20,21,38,21,21,38,21,51,95,
+54,52,96,52,51,96,53,54,96,4,31,63,64,64,63,150,194,91,90,195,253,237,210,
+85,79,78,86,210,1,62,155,52,47,1,86,85,91,91,91,91,126,254,168,254,238,168,
+96,98,166,2,19,230,90,75,75,91,229,253,63,95,105,75,125,5,250,21,38,21,21,
+38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,0,4,0,82,
+0,0,4,254,7,58,0,7,0,52,0,68,0,84,0,0,1,50,53,52,35,34,21,20,23,6,35,34,39,
+38,53,52,55,54,51,50,23,22,21,17,20,7,22,23,22,51,50,54,53,17,52,39,51,22,
+21,17,20,6,35,34,39,38,39,6,35,53,50,54,53,0,6,6,21,20,22,22,51,50,54,54,
+53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,17,76,76,75,
+142,30,37,101,48,42,42,47,102,121,63,71,9,58,57,57,158,119,122,50,188,50,
+207,202,221,98,33,38,88,244,97,96,1,81,38,22,22,38,20,21,38,21,21,38,21,51,
+95,54,52,96,52,51,96,53,54,96,4,9,76,75,75,76,108,7,54,47,90,89,48,54,58,
+65,137,253,118,83,55,5,57,80,146,104,2,228,125,75,105,95,253,28,177,183,106,
+35,3,144,144,103,143,5,60,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,
+52,95,53,53,95,52,52,96,52,0,4,0,147,0,0,4,173,7,58,0,7,0,47,0,63,0,79,0,
+0,1,50,53,52,35,34,21,20,1,20,7,6,33,32,39,38,53,16,55,54,55,38,39,38,53,
+52,55,54,51,50,23,22,21,20,2,21,20,22,51,50,54,53,17,52,39,51,22,21,0,6,6,
+21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,
+53,52,54,54,1,54,61,61,61,3,180,125,125,254,236,254,236,125,123,112,38,25,
+92,44,39,42,44,92,101,50,47,188,156,181,180,157,50,188,50,253,248,38,22,22,
+38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,4,29,64,63,63,64,
+253,145,240,95,95,92,91,230,1,22,155,52,47,1,48,43,80,89,45,49,48,46,89,147,
+254,189,234,190,113,122,198,2,158,125,75,105,95,2,118,21,38,21,21,38,21,21,
+38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,0,4,0,147,0,0,5,
+0,7,58,0,7,0,47,0,63,0,79,0,0,1,50,53,52,35,34,21,20,1,20,7,6,33,32,39,38,
+53,16,55,54,55,38,39,38,53,52,55,54,51,50,23,22,21,20,2,21,20,22,51,50,54,
+53,17,52,54,55,6,21,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,
+22,21,20,6,6,35,34,38,38,53,52,54,54,1,54,61,61,61,3,180,125,125,254,236,
+254,236,125,123,112,38,25,92,44,39,42,44,92,101,50,47,188,156,181,180,157,
+107,164,83,253,248,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,
+96,53,54,96,4,29,64,63,63,64,253,145,240,95,95,92,91,230,1,22,155,52,47,1,
+48,43,80,89,45,49,48,46,89,147,254,189,234,190,113,122,198,3,72,85,220,60,
+150,215,1,204,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,
+95,52,52,96,52,0,5,0,168,0,0,4,254,7,58,0,7,0,15,0,78,0,94,0,110,0,0,1,52,
+35,34,21,20,51,50,33,50,55,38,35,34,21,20,3,18,51,50,54,53,17,6,35,34,39,
+38,53,52,54,51,50,23,22,23,54,53,52,39,50,21,20,7,22,21,17,20,7,6,35,34,39,
+6,35,34,39,38,53,17,52,55,54,51,50,22,21,20,7,6,35,34,39,17,20,22,51,50,19,
+18,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,
+38,38,53,52,54,54,1,238,64,65,65,64,1,196,33,41,9,65,64,182,57,155,56,52,
+31,43,80,40,40,90,80,100,63,15,12,23,29,138,78,8,92,70,134,153,71,71,153,
+133,70,93,89,63,100,80,90,40,40,80,43,31,54,54,155,57,1,38,22,22,38,20,21,
+38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,4,106,64,64,63,40,87,64,63,
+253,101,254,222,122,148,2,79,11,42,43,86,74,95,46,11,13,36,39,68,27,100,97,
+84,37,45,253,111,215,94,71,117,117,70,93,217,2,145,153,64,46,95,74,86,43,
+42,11,253,177,153,117,1,34,5,50,21,38,21,21,38,21,21,38,21,21,38,21,120,52,
+96,52,52,95,53,53,95,52,52,96,52,0,0,4,0,168,0,0,5,11,7,58,0,7,0,52,0,68,
+0,84,0,0,1,52,35,34,21,20,51,50,1,20,7,6,35,34,39,6,35,34,39,38,53,17,52,
+55,54,51,50,22,21,20,7,6,35,34,39,17,20,22,51,50,19,51,18,51,50,54,53,17,
+52,54,55,6,21,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,1,238,64,65,65,64,2,202,92,70,134,153,71,71,
+153,133,70,93,89,63,100,80,90,40,40,80,43,31,54,54,155,57,24,57,155,56,52,
+107,164,83,253,237,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,
+96,53,54,96,4,106,64,64,63,253,81,215,94,71,117,117,70,93,217,2,145,153,64,
+46,95,74,86,43,42,11,253,177,153,117,1,34,254,222,122,148,3,122,85,220,60,
+150,215,1,204,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,
+95,52,52,96,52,0,0,4,0,147,0,0,5,191,7,58,0,7,0,58,0,74,0,90,0,0,1,50,53,
+52,35,34,21,20,37,51,17,20,51,50,54,53,17,52,55,51,6,21,17,20,7,6,35,34,39,
+6,35,34,39,38,53,16,55,54,55,38,39,38,53,52,55,54,51,50,23,22,21,20,2,17,
+20,22,51,50,53,18,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,
+21,20,6,6,35,34,38,38,53,52,54,54,1,54,61,61,61,1,225,188,158,70,87,50,188,
+50,99,86,161,165,86,86,205,200,86,100,112,38,25,96,43,36,52,44,82,97,49,52,
+188,89,109,197,97,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,
+53,54,96,4,29,64,63,63,64,247,252,84,250,112,151,2,215,95,105,75,125,253,
+41,204,90,79,110,110,78,90,205,1,62,155,52,47,1,52,42,77,99,45,39,44,45,94,
+147,254,189,254,238,153,110,250,5,90,21,38,21,21,38,21,21,38,21,21,38,21,
+120,52,96,52,52,95,53,53,95,52,52,96,52,0,4,0,147,0,0,5,224,7,58,0,7,0,62,
+0,78,0,94,0,0,1,50,53,52,35,34,21,20,1,20,7,6,35,34,39,6,35,34,39,38,53,16,
+55,54,55,38,39,38,53,52,55,54,51,50,23,22,21,20,2,17,20,22,51,50,53,17,52,
+55,51,6,21,17,20,51,50,54,53,17,52,54,55,6,21,0,6,6,21,20,22,22,51,50,54,
+54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,54,61,61,
+61,4,148,99,86,181,185,86,86,185,180,86,100,112,38,25,96,43,36,52,44,82,97,
+49,52,188,89,89,177,50,188,50,178,90,87,107,164,83,253,154,38,22,22,38,20,
+21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,4,29,64,63,63,64,253,88,
+204,90,79,110,110,78,90,205,1,62,155,52,47,1,52,42,77,99,45,39,44,45,94,147,
+254,189,254,238,153,110,250,2,228,95,105,75,125,253,28,250,112,151,3,129,
+85,220,60,150,215,1,204,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,
+52,95,53,53,95,52,52,96,52,0,0,4,0,82,0,0,5,123,7,58,0,7,0,45,0,61,0,77,0,
+0,55,50,53,52,35,34,21,20,37,20,22,51,50,54,53,17,52,39,51,22,21,17,20,6,
+35,34,39,39,6,35,32,53,52,51,50,21,20,7,54,53,17,52,39,51,22,21,18,6,6,21,
+20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,
+52,54,54,243,62,62,61,1,215,146,140,140,136,50,188,50,230,229,229,125,1,78,
+171,254,254,161,162,43,103,50,188,50,254,38,22,22,38,20,21,38,21,21,38,21,
+51,95,54,52,96,52,51,96,53,54,96,158,62,61,61,62,222,173,97,147,123,2,208,
+125,75,105,95,253,48,190,190,95,1,96,220,162,162,65,39,22,184,3,10,125,75,
+105,95,2,118,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,
+95,52,52,96,52,0,0,4,0,147,0,0,5,0,7,58,0,13,0,61,0,77,0,93,0,0,1,34,7,6,
+21,20,51,50,55,54,53,52,39,38,1,20,7,6,33,32,39,38,53,52,55,38,53,53,52,55,
+54,51,50,23,22,21,20,7,6,35,34,39,21,20,51,51,21,35,34,21,20,22,51,50,54,
+53,17,52,54,55,6,21,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,
+22,21,20,6,6,35,34,38,38,53,52,54,54,1,201,31,18,27,76,39,19,17,22,19,2,194,
+130,124,254,237,254,236,125,120,163,163,105,75,130,95,47,48,47,48,95,76,46,
+212,80,80,212,153,180,180,161,107,164,83,253,248,38,22,22,38,20,21,38,21,
+21,38,21,51,95,54,52,96,52,51,96,53,54,96,4,160,12,18,45,76,21,19,36,41,19,
+15,252,220,193,95,92,83,80,187,224,66,73,157,135,172,71,52,47,48,95,96,48,
+48,30,78,166,134,220,121,119,143,127,3,122,85,220,60,150,215,1,204,21,38,
+21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,4,
+0,147,0,0,4,173,7,58,0,11,0,55,0,71,0,87,0,0,0,6,21,20,22,51,50,54,53,52,
+38,35,2,38,53,52,54,51,50,22,21,20,6,35,34,39,38,39,22,33,50,54,53,52,38,
+39,39,38,53,16,33,32,19,36,33,32,21,20,23,23,22,4,21,20,6,33,18,6,6,21,20,
+22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,
+54,54,1,177,39,39,27,25,39,39,25,76,237,156,157,71,90,81,80,81,41,6,5,21,
+1,43,156,206,203,161,252,246,1,217,1,97,224,254,242,254,211,254,221,158,174,
+239,1,35,250,254,212,30,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,
+51,96,53,54,96,1,156,34,24,26,36,36,26,24,34,254,100,145,128,114,116,83,66,
+75,76,38,6,7,144,116,143,105,157,27,46,40,236,1,64,254,210,158,176,151,31,
+30,39,188,172,215,154,6,194,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,
+52,52,95,53,53,95,52,52,96,52,0,0,4,0,147,0,0,4,123,7,58,0,7,0,59,0,75,0,
+91,0,0,37,50,53,52,35,34,21,20,37,20,7,6,35,34,46,2,35,34,7,54,51,50,23,22,
+21,22,21,20,7,6,7,38,39,38,53,52,55,54,51,50,22,18,51,50,53,17,52,38,35,34,
+6,7,16,55,54,51,32,22,21,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,
+50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,159,70,70,70,3,34,66,61,117,
+59,123,30,114,122,119,28,43,56,95,46,43,2,40,49,107,124,62,64,78,79,151,154,
+190,48,56,56,153,194,119,228,118,124,125,211,1,35,249,254,42,38,22,22,38,
+20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,84,70,70,70,70,136,
+114,55,51,79,194,217,209,42,38,35,68,17,15,67,37,45,1,3,64,65,129,190,71,
+72,187,254,249,76,2,170,107,167,76,237,1,7,87,87,225,173,3,60,21,38,21,21,
+38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,4,0,147,
+0,0,4,123,7,58,0,15,0,54,0,70,0,86,0,0,0,21,20,22,22,51,50,54,54,53,52,38,
+38,35,34,6,5,20,6,35,34,38,53,52,54,54,51,50,22,22,21,20,6,7,6,7,22,51,50,
+54,53,17,52,38,35,34,6,7,16,55,54,51,32,22,21,0,6,6,21,20,22,22,51,50,54,
+54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,7,19,36,
+20,20,36,20,21,36,19,19,36,3,96,250,250,250,250,51,92,48,48,91,52,50,45,26,
+28,102,165,156,156,153,194,119,228,118,124,125,211,1,35,249,254,42,38,22,
+22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,1,144,20,20,36,
+19,19,36,20,20,36,20,20,56,190,190,190,190,50,92,49,49,92,50,50,91,25,14,
+6,84,147,123,2,10,107,167,76,237,1,7,87,87,225,173,3,60,21,38,21,21,38,21,
+21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,5,0,147,0,0,4,
+123,7,58,0,13,0,21,0,77,0,93,0,109,0,0,1,38,39,38,35,34,6,21,20,22,51,50,
+55,54,1,50,53,52,35,34,21,20,1,6,35,34,38,53,52,54,51,32,23,54,55,23,6,7,
+22,21,17,20,7,6,35,34,46,2,35,34,7,54,51,50,23,22,21,22,21,20,7,6,7,38,39,
+38,53,52,55,54,51,50,22,18,51,50,53,0,6,6,21,20,22,22,51,50,54,54,53,52,38,
+38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,3,134,23,31,132,146,107,
+128,128,107,146,152,18,254,41,70,70,70,2,102,146,243,204,219,219,204,1,3,
+152,15,4,147,14,33,47,66,61,117,59,123,30,114,122,119,28,43,56,95,46,43,2,
+40,49,107,124,62,64,78,79,151,154,190,48,56,56,254,230,38,22,22,38,20,21,
+38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,4,34,21,19,98,77,83,83,47,
+124,12,252,66,70,70,70,70,3,53,103,104,130,130,134,90,61,79,30,125,92,67,
+84,253,36,114,55,51,79,194,217,209,42,38,35,68,17,15,67,37,45,1,3,64,65,129,
+190,71,72,187,254,249,76,5,230,21,38,21,21,38,21,21,38,21,21,38,21,120,52,
+96,52,52,95,53,53,95,52,52,96,52,0,0,5,0,147,0,0,6,12,7,58,0,7,0,16,0,76,
+0,92,0,108,0,0,1,50,53,52,35,34,21,20,5,53,52,35,34,21,20,51,50,5,52,38,35,
+34,7,17,20,7,6,35,34,39,38,53,16,55,54,55,38,38,53,52,54,51,50,22,21,20,2,
+17,20,22,51,50,54,53,17,35,34,39,38,53,52,55,54,51,50,23,54,51,50,22,21,17,
+20,7,35,54,53,2,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,1,61,64,64,64,2,55,32,40,43,15,2,42,62,72,
+118,100,99,91,250,230,91,100,116,40,27,91,92,93,92,84,103,184,95,139,158,
+93,27,54,57,50,49,48,64,162,42,81,148,167,155,50,188,50,183,38,22,22,38,20,
+21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,4,31,63,64,64,63,10,23,
+118,71,71,34,89,91,205,253,157,210,85,79,78,86,210,1,62,155,52,47,1,86,85,
+91,91,91,91,126,254,168,254,238,168,96,98,166,2,44,53,46,86,94,46,45,141,
+141,166,124,252,214,95,105,75,125,5,250,21,38,21,21,38,21,21,38,21,21,38,
+21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,5,0,147,0,0,4,123,7,58,0,11,
+0,31,0,67,0,83,0,99,0,0,1,38,38,35,34,6,21,20,22,51,50,54,1,20,23,22,23,22,
+22,51,50,54,54,53,52,38,38,35,34,6,7,6,23,22,51,32,17,17,6,35,34,38,53,52,
+54,33,22,4,21,17,16,33,32,17,51,54,55,54,54,51,50,22,22,21,20,6,7,6,0,6,6,
+21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,
+53,52,54,54,3,183,17,141,146,186,126,156,156,156,131,253,89,2,2,4,8,30,17,
+17,31,17,18,31,16,16,30,8,8,133,95,163,1,56,119,193,250,250,230,1,14,230,
+1,14,254,12,254,12,1,3,20,22,81,43,43,82,48,46,40,8,1,25,38,22,22,38,20,21,
+38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,3,171,161,96,103,153,153,
+103,95,254,59,11,11,7,7,15,16,16,30,17,17,31,17,17,15,14,165,66,1,14,1,1,
+57,190,170,190,170,10,180,240,254,22,254,132,1,76,37,33,38,43,43,76,43,42,
+76,20,4,6,15,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,
+95,52,52,96,52,0,4,0,147,0,0,4,173,7,58,0,11,0,64,0,80,0,96,0,0,0,6,21,20,
+22,51,50,54,53,52,38,35,0,54,51,50,23,22,51,50,55,2,35,34,39,38,35,34,21,
+20,23,23,22,4,21,20,6,33,32,38,53,52,54,51,50,22,21,20,6,35,34,39,38,39,22,
+33,50,54,53,52,38,39,39,38,17,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,
+53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,177,39,39,27,25,39,39,25,
+254,199,146,146,154,138,82,109,158,117,124,151,152,113,114,104,104,158,174,
+239,1,35,250,254,212,254,249,237,156,157,71,90,81,80,81,41,6,5,21,1,43,156,
+206,203,161,252,246,2,18,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,
+52,51,96,53,54,96,1,156,34,24,26,36,36,26,24,34,3,5,115,75,45,133,254,235,
+60,60,131,196,31,30,39,188,172,215,154,145,128,114,116,83,66,75,76,38,6,7,
+144,116,143,105,157,27,46,40,1,25,2,193,21,38,21,21,38,21,21,38,21,21,38,
+21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,5,0,147,0,0,8,39,7,58,0,7,0,
+16,0,98,0,114,0,130,0,0,1,50,53,52,35,34,21,20,5,53,52,35,34,21,20,51,50,
+1,20,6,35,34,39,38,39,6,33,54,54,53,17,52,38,35,34,7,17,20,7,6,35,34,39,38,
+53,16,55,54,55,38,38,53,52,54,51,50,22,21,20,2,17,20,22,51,50,54,53,17,35,
+34,39,38,53,52,55,54,51,50,23,54,51,50,22,21,17,6,7,22,22,51,50,54,53,17,
+52,39,51,22,21,0,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,
+20,6,6,35,34,38,38,53,52,54,54,1,61,64,64,64,2,55,32,40,43,15,5,1,157,142,
+121,98,33,38,88,254,208,157,97,62,72,118,100,99,91,250,230,91,100,116,40,
+27,91,92,93,92,84,103,184,95,139,158,93,27,54,57,50,49,48,64,162,42,81,148,
+167,155,1,9,58,114,58,59,72,50,188,50,252,174,38,22,22,38,20,21,38,21,21,
+38,21,51,95,54,52,96,52,51,96,53,54,96,4,31,63,64,64,63,10,23,118,71,71,253,
+44,177,143,106,35,3,144,74,173,103,2,148,89,91,205,253,157,210,85,79,78,86,
+210,1,62,155,52,47,1,86,85,91,91,91,91,126,254,168,254,238,168,96,98,166,
+2,44,53,46,86,94,46,45,141,141,166,124,253,108,53,45,5,137,62,148,3,12,125,
+75,105,95,2,118,21,38,21,21,38,21,21,38,21,21,38,21,120,52,96,52,52,95,53,
+53,95,52,52,96,52,0,0,6,0,147,0,0,8,40,7,58,0,7,0,16,0,25,0,108,0,124,0,140,
+0,0,1,50,53,52,35,34,21,20,5,53,52,35,34,21,20,51,50,1,34,21,20,51,50,53,
+53,38,37,20,7,6,35,34,39,38,53,16,55,54,55,38,38,53,52,54,51,50,22,21,20,
+2,17,20,22,51,50,54,53,17,35,34,39,38,53,52,55,54,51,50,23,54,51,50,22,21,
+17,22,51,50,54,53,17,52,39,51,22,21,17,20,6,35,34,39,6,35,34,39,38,53,52,
+55,54,51,51,17,52,38,35,34,7,18,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,
+53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,1,61,64,64,64,2,55,32,40,43,
+15,2,13,43,40,32,14,254,174,99,91,250,230,91,100,116,40,27,91,92,93,92,84,
+103,184,95,139,158,93,27,54,57,50,49,48,64,162,42,81,148,167,155,100,118,
+72,62,50,188,50,155,167,148,81,42,162,64,48,49,50,57,54,27,62,72,118,100,
+229,38,22,22,38,20,21,38,21,21,38,21,51,95,54,52,96,52,51,96,53,54,96,4,31,
+63,64,64,63,10,23,118,71,71,252,236,71,71,118,23,1,118,210,85,79,78,86,210,
+1,62,155,52,47,1,86,85,91,91,91,91,126,254,168,254,238,168,96,98,166,2,44,
+53,46,86,94,46,45,141,141,166,124,253,73,205,91,89,3,42,125,75,105,95,252,
+214,124,166,141,141,45,46,94,86,46,53,2,128,89,91,205,2,233,21,38,21,21,38,
+21,21,38,21,21,38,21,120,52,96,52,52,95,53,53,95,52,52,96,52,0,0,2,0,82,0,
+0,3,24,5,20,0,7,0,26,0,0,19,20,51,50,53,52,35,34,5,16,39,22,21,20,35,34,53,
+16,33,32,17,17,20,7,35,54,53,198,75,76,76,75,1,150,231,91,192,190,1,99,1,
+99,50,188,50,4,16,74,75,76,197,1,1,26,46,117,190,190,1,4,254,132,253,48,95,
+105,75,125,0,3,253,19,5,170,254,165,8,59,0,15,0,31,0,43,0,0,0,6,6,21,20,22,
+22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,53,52,54,
+54,39,53,35,53,51,53,51,21,51,21,35,21,253,199,38,22,22,38,20,21,38,21,21,
+38,21,51,95,54,52,96,52,51,96,53,54,96,14,134,134,133,133,133,6,130,16,29,
+16,17,29,16,16,29,17,16,29,16,93,40,74,40,41,73,41,41,73,41,40,74,40,39,105,
+98,106,106,98,105,0,3,252,211,5,170,255,86,8,55,0,15,0,31,0,95,0,0,0,6,6,
+21,20,22,22,51,50,54,54,53,52,38,38,35,53,50,22,22,21,20,6,6,35,34,38,38,
+53,52,54,54,38,7,38,38,53,52,62,2,51,50,22,22,23,54,54,55,50,22,22,23,22,
+21,21,54,54,55,22,22,23,22,21,20,7,14,2,7,38,35,39,54,55,54,55,38,39,38,35,
+35,6,6,35,34,38,39,34,6,21,20,23,22,23,7,253,219,38,22,22,38,20,21,38,21,
+21,38,21,51,95,54,52,96,52,51,96,53,54,96,107,6,64,57,33,36,48,35,19,39,50,
+10,26,52,40,32,56,31,9,8,23,14,11,28,31,11,1,19,21,60,77,44,4,4,39,24,27,
+30,1,7,19,18,28,2,21,77,17,16,77,25,28,38,37,23,19,31,6,159,18,33,19,18,33,
+19,19,33,18,19,33,18,106,46,84,46,45,84,46,46,84,45,46,84,46,44,1,24,65,41,
+30,46,35,18,14,41,10,19,40,6,23,32,17,15,20,5,30,36,37,1,17,17,3,4,37,30,
+35,46,46,8,1,48,13,19,21,20,20,20,18,2,90,89,1,42,24,18,22,13,9,52,0,2,255,
+69,254,1,0,121,255,195,0,15,0,33,0,0,14,2,21,20,22,22,51,50,54,54,53,52,38,
+38,35,7,38,39,38,38,53,52,54,54,51,50,22,22,21,20,7,39,54,43,23,14,14,21,
+13,13,22,11,11,23,12,21,29,27,38,40,43,73,39,39,73,41,225,67,81,161,12,20,
+12,11,20,13,13,20,11,12,20,12,186,4,14,19,67,38,39,69,36,36,69,39,243,63,
+88,12,0,2,254,177,254,1,0,153,255,195,0,13,0,47,0,0,6,6,21,20,22,22,23,54,
+53,52,38,38,35,34,23,6,21,20,23,22,51,50,53,53,51,21,20,35,34,39,38,53,52,
+55,34,39,38,38,53,52,54,54,51,50,22,22,21,20,228,12,12,20,36,18,12,20,11,
+10,127,13,3,8,44,57,134,191,127,31,19,11,34,31,34,32,32,68,34,36,66,37,163,
+21,12,13,20,13,2,26,22,12,21,13,128,37,36,15,15,25,144,201,207,243,65,38,
+34,26,24,17,18,63,33,35,64,33,33,64,35,31,0,1,254,61,5,170,1,195,7,5,0,35,
+0,0,17,50,22,22,21,14,3,7,34,7,39,54,53,52,39,38,35,34,7,6,21,20,23,7,38,
+35,46,3,39,52,54,54,160,184,107,6,24,73,74,54,8,6,60,133,66,60,153,153,60,
+66,133,60,6,8,54,74,73,24,6,107,184,7,5,37,93,39,34,36,51,35,21,1,80,44,50,
+49,17,15,15,17,49,50,44,80,1,21,35,51,36,34,39,93,37,0,0,1,254,62,5,170,2,
+18,7,3,0,39,0,0,19,54,55,54,53,52,39,38,35,34,7,6,21,20,23,7,38,35,46,3,39,
+52,54,55,54,51,50,23,22,22,21,6,7,6,7,51,21,33,118,3,14,116,66,57,141,142,
+57,66,133,60,6,8,54,74,73,24,6,107,92,83,155,154,83,92,107,6,12,8,21,154,
+254,100,5,252,2,2,41,47,49,17,14,14,17,49,50,44,80,1,21,35,51,36,34,39,93,
+19,16,16,19,93,39,34,18,13,16,97,0,2,254,61,5,170,1,195,7,5,0,15,0,51,0,0,
+3,50,22,22,21,20,6,6,35,34,38,38,53,52,54,54,55,50,22,22,21,14,3,7,34,7,39,
+54,53,52,39,38,35,34,7,6,21,20,23,7,38,35,46,3,39,52,54,54,1,25,44,25,24,
+44,26,24,44,25,25,45,24,160,184,107,6,24,73,74,54,8,6,60,133,66,60,153,153,
+60,66,133,60,6,8,54,74,73,24,6,107,184,6,122,14,27,14,14,27,14,14,27,14,14,
+27,14,139,37,93,39,34,36,51,35,21,1,80,44,50,49,17,15,15,17,49,50,44,80,1,
+21,35,51,36,34,39,93,37,0,0,2,254,72,5,170,2,28,7,3,0,15,0,55,0,0,17,50,22,
+22,21,20,6,6,35,34,38,38,53,52,54,54,23,54,55,54,53,52,39,38,35,34,7,6,21,
+20,23,7,38,35,46,3,39,52,54,55,54,51,50,23,22,22,21,6,7,6,7,51,21,33,21,39,
+23,22,39,22,22,39,22,22,40,149,3,14,116,66,57,141,142,57,66,133,60,6,8,54,
+74,73,24,6,107,92,83,155,154,83,92,107,6,12,8,21,154,254,100,6,122,14,26,
+13,13,27,14,14,27,13,13,26,14,126,2,2,41,47,49,17,14,14,17,49,50,44,80,1,
+21,35,51,36,34,39,93,19,16,16,19,93,39,34,18,13,16,97,0,2,254,93,5,170,1,
+164,6,227,0,20,0,36,0,0,1,52,54,54,51,50,22,22,21,20,7,6,21,22,51,50,55,51,
+2,33,32,54,6,6,21,20,22,22,51,50,54,54,53,52,38,38,35,254,93,43,75,40,40,
+85,42,20,1,34,56,247,21,177,83,254,150,254,118,142,31,18,18,31,16,18,31,17,
+17,31,18,6,93,35,64,35,35,64,35,35,22,2,1,43,228,254,208,235,15,27,14,14,
+27,15,15,27,14,14,27,15,0,2,254,93,5,170,1,164,6,227,0,20,0,36,0,0,0,33,32,
+19,35,38,35,34,7,20,23,22,21,20,6,6,35,34,38,38,53,23,50,54,54,53,52,38,38,
+35,34,6,6,21,20,22,22,254,93,1,138,1,106,83,177,21,247,56,34,1,20,42,85,40,
+40,75,43,158,18,31,17,17,31,18,16,31,18,18,31,6,227,254,208,228,43,1,2,22,
+35,35,64,35,35,64,35,56,15,27,14,14,27,15,15,27,14,14,27,15,0,4,0,32,253,
+168,2,230,5,20,0,15,0,33,0,41,0,65,0,0,0,21,20,22,22,51,50,54,54,53,52,38,
+38,35,34,6,23,38,39,38,38,53,52,54,54,51,50,22,22,21,20,7,39,54,3,20,51,50,
+53,52,35,34,5,52,39,22,21,20,35,34,53,16,33,32,17,17,20,6,35,34,39,22,51,
+50,54,53,1,118,11,18,10,11,18,9,9,19,10,9,19,11,24,22,31,33,35,60,32,32,60,
+34,185,55,67,168,75,76,76,75,1,100,141,51,192,190,1,49,1,99,193,129,229,159,
+159,139,123,101,254,153,10,8,16,9,9,16,8,10,15,8,8,132,3,10,15,51,28,29,53,
+27,27,53,29,184,47,66,10,6,28,74,75,76,197,217,26,46,77,190,190,1,4,254,132,
+253,28,190,210,204,100,184,112,0,0,4,0,32,253,168,2,230,5,20,0,13,0,47,0,
+55,0,79,0,0,0,6,21,20,22,22,23,54,53,52,38,38,35,34,23,6,21,20,23,22,51,50,
+53,53,51,21,20,35,34,39,38,53,52,55,34,39,38,38,53,52,54,54,51,50,22,22,21,
+20,3,20,51,50,53,52,35,34,5,52,39,22,21,20,35,34,53,16,33,32,17,17,20,6,35,
+34,39,22,51,50,54,53,1,42,10,10,17,30,15,10,17,9,8,106,11,2,7,37,47,112,159,
+106,26,16,9,28,26,28,27,27,56,29,30,55,31,239,75,76,76,75,1,100,141,51,192,
+190,1,49,1,99,193,129,229,159,159,139,123,101,254,175,16,9,10,15,9,2,20,16,
+9,16,10,97,28,27,11,12,18,108,152,156,184,49,29,25,20,18,13,14,47,26,26,48,
+25,25,48,26,24,5,143,74,75,76,197,217,26,46,77,190,190,1,4,254,132,253,28,
+190,210,204,100,184,112,0,0,4,252,96,253,157,255,50,255,215,0,13,0,46,0,62,
+0,90,0,0,1,52,38,35,34,7,6,21,21,20,22,51,50,54,23,35,14,3,7,39,54,54,55,
+6,35,6,35,34,39,38,38,53,62,3,51,51,50,22,22,23,22,21,20,1,21,20,23,22,23,
+50,55,54,53,52,39,38,39,6,6,55,22,21,20,7,6,6,35,34,39,38,53,52,54,51,50,
+22,22,23,51,50,55,51,6,35,35,38,38,253,196,28,16,19,15,14,29,19,16,28,129,
+1,13,17,29,37,59,116,47,63,10,35,19,1,1,20,30,48,22,12,28,44,38,50,5,13,64,
+53,16,10,254,123,9,11,19,18,12,10,1,2,26,25,22,149,16,3,11,62,50,60,43,40,
+106,82,82,119,65,47,2,63,17,139,38,175,8,90,107,254,108,13,20,10,9,13,2,11,
+23,23,58,28,22,27,29,31,46,16,47,20,8,1,10,18,41,31,37,24,21,8,18,33,33,19,
+28,19,1,22,5,14,6,9,1,9,6,13,3,3,18,20,3,16,15,29,26,12,10,35,41,34,33,61,
+62,62,58,68,2,120,221,3,121,0,0,4,252,96,253,157,255,50,255,215,0,13,0,47,
+0,63,0,91,0,0,0,6,21,20,22,22,23,54,53,52,38,38,35,34,23,6,21,20,23,22,51,
+50,53,53,51,21,20,35,34,39,38,53,52,55,34,39,38,38,53,52,54,54,51,50,22,22,
+21,20,39,21,20,23,22,23,50,55,54,53,52,39,38,39,6,6,55,22,21,20,7,6,6,35,
+34,39,38,53,52,54,51,50,22,22,23,51,50,55,51,6,35,35,38,38,253,56,11,11,18,
+33,17,11,18,10,10,104,10,2,7,36,35,110,145,103,29,12,9,27,25,27,31,31,54,
+28,29,53,30,253,9,11,19,18,12,10,1,2,26,25,22,149,16,3,11,62,50,60,43,40,
+106,82,82,119,65,47,2,63,17,139,38,175,8,90,107,254,124,14,8,8,14,8,2,18,
+14,8,14,9,81,22,21,10,9,15,88,122,126,158,49,21,20,17,16,11,11,38,21,21,39,
+20,20,39,21,20,254,5,14,6,9,1,9,6,13,3,3,18,20,3,16,15,29,26,12,10,35,41,
+34,33,61,62,62,58,68,2,120,221,3,121,0,1,255,210,6,64,0,76,7,126,0,3,0,0,
+3,51,17,35,46,122,122,7,126,254,194,0,0,2,254,182,6,64,1,123,7,104,0,14,0,
+44,0,0,2,53,52,39,38,35,35,6,7,6,21,20,23,22,51,6,39,38,53,53,54,55,54,51,
+50,23,22,23,22,21,21,6,7,54,54,55,23,14,2,35,35,53,54,55,90,3,12,22,9,29,
+1,1,26,21,23,95,30,32,4,44,36,47,10,11,61,22,20,2,87,148,158,41,120,61,112,
+182,140,214,136,54,6,255,11,7,5,19,5,23,1,1,21,3,2,48,19,22,35,8,40,24,19,
+1,5,32,29,42,7,47,65,8,105,88,45,95,79,50,54,22,48,0,0,1,254,238,6,58,1,145,
+7,104,0,64,0,0,19,38,38,39,62,3,55,38,39,38,35,35,6,6,35,34,38,39,34,6,21,
+20,30,2,23,6,7,38,38,53,52,62,2,51,50,22,22,23,54,54,55,50,22,22,23,22,21,
+21,54,54,55,22,22,23,22,21,20,7,14,2,168,22,29,4,10,27,14,19,1,7,13,12,27,
+5,34,68,18,17,65,27,30,26,21,24,30,11,29,39,68,59,34,38,51,37,19,41,52,11,
+27,55,42,33,59,33,10,7,25,14,12,29,33,12,1,20,22,63,92,6,64,5,29,20,10,17,
+20,19,22,24,12,11,26,60,68,15,26,29,21,22,15,19,10,41,9,28,76,47,36,53,40,
+20,14,48,11,21,47,7,26,38,20,17,22,9,35,44,43,2,20,19,4,5,43,35,40,54,48,
+0,0,1,255,82,6,52,0,186,7,116,0,11,0,0,19,35,53,35,53,51,53,51,21,51,21,35,
+65,119,120,120,119,121,121,6,52,109,102,109,109,102,0,1,253,224,5,173,254,
+90,6,235,0,3,0,0,1,51,17,35,253,224,122,122,6,235,254,194,0,2,252,238,5,174,
+255,179,6,235,0,16,0,46,0,0,0,53,52,39,38,35,34,7,6,7,6,21,20,23,22,51,51,
+6,39,38,53,53,54,55,54,51,50,23,22,23,22,21,21,6,7,54,54,55,23,14,2,35,35,
+53,54,55,253,222,3,12,22,4,5,29,1,1,26,16,17,11,95,30,32,4,44,36,47,10,11,
+61,22,20,2,87,148,158,41,120,61,112,182,140,214,136,54,6,123,11,7,6,21,1,
+5,24,2,1,22,3,2,52,21,23,37,9,43,26,20,1,5,34,32,45,8,50,70,9,113,94,49,101,
+85,53,59,23,50,0,0,1,252,219,5,167,255,126,6,223,0,64,0,0,1,38,38,39,62,3,
+55,38,39,38,35,35,6,6,35,34,38,39,34,6,21,20,30,2,23,6,7,38,38,53,52,62,2,
+51,50,22,22,23,54,54,55,50,22,22,23,22,21,21,54,54,55,22,22,23,22,21,20,7,
+14,2,254,149,22,29,4,10,27,14,19,1,7,13,12,27,5,34,68,18,17,65,27,30,26,21,
+24,30,11,29,39,68,59,34,38,51,37,19,41,52,11,27,55,42,33,59,33,10,7,25,14,
+12,29,33,12,1,20,22,63,92,5,173,5,30,21,10,18,21,19,23,25,12,11,26,62,70,
+15,27,29,22,23,15,20,10,43,9,29,78,49,37,55,41,21,15,49,12,22,49,7,27,39,
+21,17,22,10,36,45,45,2,21,20,4,5,44,37,41,56,49,0,1,253,97,5,165,254,201,
+6,233,0,11,0,0,1,35,53,35,53,51,53,51,21,51,21,35,254,80,119,120,120,119,
+121,121,5,165,110,103,111,111,103,0,0,4,254,4,253,153,0,214,255,215,0,13,
+0,45,0,61,0,89,0,0,3,52,38,35,34,7,6,21,21,20,22,51,50,54,23,35,14,3,7,39,
+54,54,55,6,7,35,34,39,38,38,53,62,3,55,51,50,22,22,23,22,21,20,1,21,20,23,
+22,23,50,55,54,53,52,39,38,39,6,6,55,22,21,20,7,6,6,35,34,39,38,53,52,54,
+51,50,22,22,23,51,50,55,51,6,35,35,38,38,142,28,16,19,15,14,29,19,16,28,129,
+1,13,17,29,37,59,116,47,63,10,35,19,4,19,29,48,22,12,28,44,38,50,5,13,64,
+53,16,10,254,113,9,11,19,18,12,10,1,2,26,25,22,149,16,3,11,62,50,60,43,40,
+106,82,82,119,65,47,2,63,17,139,38,175,8,90,107,254,113,14,20,10,10,13,2,
+12,23,24,61,29,23,29,30,32,48,17,49,20,7,1,10,18,43,33,38,26,21,8,1,19,35,
+34,20,30,19,1,19,5,14,6,9,1,9,6,13,3,3,18,20,3,16,15,29,26,12,10,35,41,34,
+33,61,62,62,58,68,2,120,221,3,121,0,0,4,254,4,253,153,0,214,255,215,0,13,
+0,47,0,63,0,91,0,0,0,6,21,20,22,22,23,54,53,52,38,38,35,34,23,6,21,20,23,
+22,51,50,53,53,51,21,20,35,34,39,38,53,52,55,34,39,38,38,53,52,54,54,51,50,
+22,22,21,20,1,21,20,23,22,23,50,55,54,53,52,39,38,39,6,6,55,22,21,20,7,6,
+6,35,34,39,38,53,52,54,51,50,22,22,23,51,50,55,51,6,35,35,38,38,254,240,11,
+11,18,33,17,11,18,10,10,104,10,2,7,36,35,110,145,103,29,12,9,27,25,27,31,
+31,54,28,29,53,30,254,239,9,11,19,18,12,10,1,2,26,25,22,149,16,3,11,62,50,
+60,43,40,106,82,82,119,65,47,2,63,17,139,38,175,8,90,107,254,114,14,7,9,13,
+8,2,18,14,7,14,9,79,22,20,9,9,15,85,119,123,153,48,21,19,17,15,11,10,37,20,
+21,37,20,20,37,21,19,1,7,5,14,6,9,1,9,6,13,3,3,18,20,3,16,15,29,26,12,10,
+35,41,34,33,61,62,62,58,68,2,120,221,3,121,0,4,0,82,0,0,6,15,5,20,0,7,0,23,
+0,32,0,100,0,0,55,20,51,50,53,52,35,34,0,6,21,20,22,22,51,50,54,54,53,52,
+38,38,35,34,1,53,52,35,34,21,20,51,50,1,17,52,38,35,34,7,7,17,20,7,6,35,34,
+39,38,53,52,55,54,51,50,23,17,35,34,39,38,53,52,55,54,51,50,23,54,51,50,22,
+21,17,54,55,51,6,7,17,20,7,35,54,53,17,36,53,52,54,54,51,50,22,22,21,20,7,
+6,21,22,198,75,76,76,75,2,113,18,18,31,16,18,31,17,17,31,18,16,253,254,72,
+70,113,15,2,252,122,122,188,97,33,71,63,121,102,47,42,42,48,101,37,30,27,
+124,57,50,49,48,94,202,42,111,218,217,215,84,12,177,61,212,50,188,50,254,
+134,43,75,40,40,85,42,20,1,29,191,75,75,76,1,153,27,14,14,27,15,15,27,14,
+14,27,15,1,98,23,118,71,71,254,1,1,161,89,151,157,48,253,43,137,65,58,54,
+48,89,90,47,54,7,2,43,53,46,86,94,46,45,141,141,176,174,254,137,56,129,224,
+59,254,235,95,105,75,125,1,0,4,175,35,64,35,35,64,35,35,22,2,1,37,0,0,3,0,
+147,0,0,5,216,5,20,0,13,0,29,0,100,0,0,1,34,7,6,21,20,51,50,55,54,53,52,39,
+38,0,6,21,20,22,22,51,50,54,54,53,52,38,38,35,34,5,21,20,7,6,33,32,39,38,
+53,52,55,38,53,53,52,55,54,51,50,23,22,21,20,7,6,35,34,39,21,20,51,51,21,
+35,34,21,20,22,51,50,54,53,53,36,53,52,54,54,51,50,22,22,21,20,7,6,21,22,
+23,17,52,55,51,6,21,17,54,55,51,6,1,201,31,18,27,76,39,19,17,22,19,1,21,18,
+18,31,16,18,31,17,17,31,18,16,1,142,130,124,254,237,254,236,125,120,163,163,
+105,75,130,95,47,48,47,48,95,76,46,212,80,80,212,153,180,180,161,254,160,
+43,75,40,40,85,42,20,1,20,28,50,188,50,108,14,177,65,4,160,12,18,45,76,21,
+19,36,41,19,15,254,79,27,14,14,27,15,15,27,14,14,27,15,220,166,193,95,92,
+83,80,187,224,66,73,157,135,172,71,52,47,48,95,96,48,48,30,78,166,134,220,
+121,119,143,127,152,9,169,35,64,35,35,64,35,35,22,2,1,25,11,1,230,95,105,
+75,125,254,47,52,148,237,0,0,16,0,98,0,86,4,94,4,82,0,7,0,15,0,23,0,31,0,
+39,0,47,0,55,0,63,0,71,0,79,0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,20,35,
+34,53,52,51,50,39,20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,23,20,35,34,
+53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,
+51,50,1,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,
+1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,37,20,
+35,34,53,52,51,50,19,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,3,215,51,
+55,55,51,147,52,57,57,52,247,55,53,55,53,35,51,55,55,51,254,56,54,53,53,54,
+173,55,53,53,55,2,82,55,53,53,55,253,27,55,54,54,55,2,129,51,55,55,51,147,
+52,57,57,52,253,174,52,57,55,54,35,53,56,56,53,1,199,54,53,53,54,254,92,54,
+55,55,54,247,55,53,53,55,147,55,54,54,55,3,150,54,54,55,43,53,53,55,254,211,
+55,55,53,227,53,53,53,1,148,56,56,53,90,53,53,55,253,119,53,53,55,1,185,54,
+51,58,253,67,53,53,56,154,51,51,55,2,29,55,55,53,227,53,53,53,254,4,55,55,
+54,227,53,53,55,254,213,55,51,55,43,53,53,56,0,0,0,0,15,0,186,0,3,0,1,4,9,
+0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,28,0,94,0,3,0,1,4,9,0,2,0,14,0,122,0,3,0,1,
+4,9,0,3,0,28,0,94,0,3,0,1,4,9,0,4,0,28,0,94,0,3,0,1,4,9,0,5,0,30,0,136,0,
+3,0,1,4,9,0,6,0,24,0,166,0,3,0,1,4,9,0,7,0,68,0,190,0,3,0,1,4,9,0,8,0,18,
+1,2,0,3,0,1,4,9,0,9,0,18,1,2,0,3,0,1,4,9,0,10,0,28,1,20,0,3,0,1,4,9,0,11,
+0,62,1,48,0,3,0,1,4,9,0,12,0,48,1,110,0,3,0,1,4,9,0,13,2,150,1,158,0,3,0,
+1,4,9,0,14,0,52,4,52,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,76,0,97,0,111,0,82,0,101,
+0,103,0,117,0,108,0,97,0,114,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,48,0,51,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,101,0,
+114,0,105,0,102,0,76,0,97,0,111,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,
+32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,
+0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+68,0,97,0,110,0,104,0,32,0,72,0,111,0,110,0,103,0,68,0,97,0,116,0,97,0,32,
+0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,104,0,116,0,116,0,
+112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,
+101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,
+111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,
+107,0,104,0,109,0,101,0,114,0,116,0,121,0,112,0,101,0,46,0,111,0,114,0,103,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,
+0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,
+0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,
+83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,
+0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,
+0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,
+0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,
+0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,
+115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,
+0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,
+0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,
+0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,
+0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,
+0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,
+0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,
+0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,
+39,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,0,0,0,1,0,3,0,4,0,
+5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,
+0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,
+1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,
+18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,
+1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,
+1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,
+1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,107,1,75,1,76,1,
+77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,
+1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,107,
+1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,
+107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,1,107,
+1,105,1,106,7,117,110,105,48,69,56,49,7,117,110,105,48,69,56,50,7,117,110,
+105,48,69,56,52,7,117,110,105,48,69,56,55,7,117,110,105,48,69,56,56,7,117,
+110,105,48,69,56,65,7,117,110,105,48,69,56,68,7,117,110,105,48,69,57,52,7,
+117,110,105,48,69,57,53,7,117,110,105,48,69,57,54,7,117,110,105,48,69,57,
+55,7,117,110,105,48,69,57,57,7,117,110,105,48,69,57,65,7,117,110,105,48,69,
+57,66,7,117,110,105,48,69,57,67,7,117,110,105,48,69,57,68,7,117,110,105,48,
+69,57,69,7,117,110,105,48,69,57,70,7,117,110,105,48,69,65,49,7,117,110,105,
+48,69,65,50,7,117,110,105,48,69,65,51,7,117,110,105,48,69,65,53,7,117,110,
+105,48,69,65,55,7,117,110,105,48,69,65,65,7,117,110,105,48,69,65,66,7,117,
+110,105,48,69,65,68,7,117,110,105,48,69,65,69,7,117,110,105,48,69,65,70,7,
+117,110,105,48,69,66,48,7,117,110,105,48,69,66,49,7,117,110,105,48,69,66,
+50,7,117,110,105,48,69,66,51,7,117,110,105,48,69,66,52,7,117,110,105,48,69,
+66,53,7,117,110,105,48,69,66,54,7,117,110,105,48,69,66,55,7,117,110,105,48,
+69,66,56,7,117,110,105,48,69,66,57,7,117,110,105,48,69,66,66,7,117,110,105,
+48,69,66,67,7,117,110,105,48,69,66,68,7,117,110,105,48,69,67,48,7,117,110,
+105,48,69,67,49,7,117,110,105,48,69,67,50,7,117,110,105,48,69,67,51,7,117,
+110,105,48,69,67,52,7,117,110,105,48,69,67,54,7,117,110,105,48,69,67,56,7,
+117,110,105,48,69,67,57,7,117,110,105,48,69,67,65,7,117,110,105,48,69,67,
+66,7,117,110,105,48,69,67,67,7,117,110,105,48,69,67,68,7,117,110,105,48,69,
+68,48,7,117,110,105,48,69,68,49,7,117,110,105,48,69,68,50,7,117,110,105,48,
+69,68,51,7,117,110,105,48,69,68,52,7,117,110,105,48,69,68,53,7,117,110,105,
+48,69,68,54,7,117,110,105,48,69,68,55,7,117,110,105,48,69,68,56,7,117,110,
+105,48,69,68,57,7,117,110,105,48,69,68,67,7,117,110,105,48,69,68,68,11,117,
+110,105,48,69,67,56,46,98,108,119,11,117,110,105,48,69,67,57,46,98,108,119,
+11,117,110,105,48,69,67,65,46,98,108,119,11,117,110,105,48,69,67,66,46,98,
+108,119,11,117,110,105,48,69,67,67,46,98,108,119,11,117,110,105,48,69,67,
+68,46,98,108,119,12,117,110,105,48,69,67,68,95,48,69,67,57,0,10,117,110,105,
+48,69,56,49,46,97,109,10,117,110,105,48,69,56,50,46,97,109,10,117,110,105,
+48,69,56,52,46,97,109,10,117,110,105,48,69,56,55,46,97,109,10,117,110,105,
+48,69,56,56,46,97,109,10,117,110,105,48,69,56,65,46,97,109,10,117,110,105,
+48,69,56,68,46,97,109,10,117,110,105,48,69,57,52,46,97,109,10,117,110,105,
+48,69,57,53,46,97,109,10,117,110,105,48,69,57,54,46,97,109,10,117,110,105,
+48,69,57,55,46,97,109,10,117,110,105,48,69,57,57,46,97,109,10,117,110,105,
+48,69,57,65,46,97,109,10,117,110,105,48,69,57,66,46,97,109,10,117,110,105,
+48,69,57,67,46,97,109,10,117,110,105,48,69,57,68,46,97,109,10,117,110,105,
+48,69,57,69,46,97,109,10,117,110,105,48,69,57,70,46,97,109,10,117,110,105,
+48,69,65,49,46,97,109,10,117,110,105,48,69,65,50,46,97,109,10,117,110,105,
+48,69,65,51,46,97,109,10,117,110,105,48,69,65,53,46,97,109,10,117,110,105,
+48,69,65,55,46,97,109,10,117,110,105,48,69,65,65,46,97,109,10,117,110,105,
+48,69,65,66,46,97,109,10,117,110,105,48,69,65,68,46,97,109,10,117,110,105,
+48,69,65,69,46,97,109,10,117,110,105,48,69,68,67,46,97,109,10,117,110,105,
+48,69,68,68,46,97,109,13,117,110,105,48,69,66,51,46,114,105,103,104,116,7,
+117,110,105,50,48,48,66,7,117,110,105,50,53,67,67,0,0,0,0,0,0,1,255,255,0,
+2,0,1,0,0,0,12,0,0,0,0,0,0,0,2,0,1,0,0,0,161,0,1,0,0,0,1,0,0,0,10,0,10,0,
+10,0,0,0,1,0,0,0,10,0,32,0,72,0,1,108,97,111,32,0,8,0,4,0,0,0,0,255,255,0,
+2,0,1,0,0,0,2,108,105,103,97,0,14,114,108,105,103,0,14,0,0,0,11,0,0,0,1,0,
+2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,18,0,38,0,58,0,84,0,162,0,194,1,72,1,
+122,1,178,2,30,2,62,2,176,3,52,3,140,3,164,3,186,3,210,3,236,4,30,0,1,0,0,
+0,1,0,8,0,1,0,6,0,71,0,1,0,1,0,66,0,6,0,0,0,1,0,8,0,3,0,0,0,1,3,58,0,1,0,
+122,0,1,0,0,0,11,0,6,0,0,0,3,0,12,0,30,0,54,0,3,0,1,3,28,0,1,3,58,0,0,0,1,
+0,0,0,12,0,3,0,1,0,18,0,1,3,40,0,0,0,1,0,0,0,12,0,1,0,1,0,71,0,3,0,1,0,18,
+0,1,3,16,0,0,0,1,0,0,0,12,0,1,0,1,0,72,0,6,0,0,0,1,0,8,0,3,0,0,0,1,3,30,0,
+1,0,18,0,1,0,0,0,13,0,1,0,1,0,137,0,4,0,0,0,1,0,8,0,1,0,110,0,8,0,22,0,34,
+0,46,0,58,0,70,0,80,0,90,0,100,0,2,0,52,0,6,0,107,0,2,0,105,0,2,0,50,0,6,
+0,106,0,2,0,105,0,2,0,48,0,6,0,139,0,2,0,105,0,2,0,46,0,6,0,138,0,2,0,105,
+0,1,0,4,0,107,0,2,0,87,0,1,0,4,0,106,0,2,0,87,0,1,0,4,0,139,0,2,0,87,0,1,
+0,4,0,138,0,2,0,87,0,2,0,2,0,82,0,85,0,0,0,100,0,103,0,4,0,4,0,0,0,1,0,8,
+0,1,0,232,0,1,0,8,0,4,0,10,0,16,0,22,0,28,0,148,0,2,0,71,0,148,0,2,0,140,
+0,149,0,2,0,72,0,149,0,2,0,141,0,4,0,0,0,1,0,8,0,1,0,42,0,1,0,8,0,4,0,10,
+0,16,0,22,0,28,0,150,0,2,0,71,0,150,0,2,0,140,0,151,0,2,0,72,0,151,0,2,0,
+141,0,1,0,1,0,74,0,6,0,0,0,4,0,14,0,32,0,58,0,78,0,3,0,1,0,36,0,1,2,8,0,0,
+0,1,0,0,0,14,0,3,0,0,0,1,1,246,0,1,0,18,0,1,0,0,0,14,0,1,0,2,0,71,0,72,0,
+3,0,2,1,144,0,186,0,1,1,220,0,0,0,1,0,0,0,14,0,3,0,1,0,18,0,1,1,200,0,0,0,
+1,0,0,0,14,0,1,0,4,0,48,0,50,0,52,0,54,0,6,0,0,0,1,0,8,0,3,0,1,0,18,0,1,1,
+190,0,0,0,1,0,0,0,15,0,1,0,1,0,38,0,6,0,0,0,4,0,14,0,34,0,54,0,82,0,3,0,0,
+0,1,1,194,0,2,1,48,0,156,0,1,0,0,0,16,0,3,0,1,1,28,0,1,1,174,0,1,1,58,0,1,
+0,0,0,16,0,3,0,0,0,1,1,154,0,2,1,8,0,20,0,1,0,0,0,16,0,1,0,2,0,140,0,141,
+0,3,0,2,0,236,0,22,0,1,1,126,0,1,0,236,0,1,0,0,0,16,0,2,0,1,0,76,0,80,0,0,
+0,6,0,0,0,3,0,12,0,34,0,90,0,3,0,0,0,1,1,124,0,3,0,222,0,192,1,124,0,1,0,
+0,0,17,0,3,0,0,0,1,1,102,0,3,0,200,0,170,0,22,0,1,0,0,0,17,0,2,0,5,0,63,0,
+65,0,0,0,67,0,74,0,3,0,87,0,87,0,11,0,105,0,105,0,12,0,142,0,147,0,13,0,3,
+0,0,0,1,1,46,0,3,0,114,0,114,0,22,0,1,0,0,0,17,0,1,0,8,0,35,0,38,0,41,0,42,
+0,46,0,47,0,53,0,57,0,1,0,0,0,1,0,8,0,2,0,64,0,29,0,108,0,109,0,110,0,111,
+0,112,0,113,0,114,0,115,0,116,0,117,0,118,0,119,0,120,0,121,0,122,0,123,0,
+124,0,125,0,126,0,127,0,128,0,129,0,130,0,131,0,132,0,133,0,134,0,135,0,136,
+0,2,0,2,0,35,0,61,0,0,0,98,0,99,0,27,0,1,0,0,0,1,0,8,0,1,0,6,0,18,0,2,0,1,
+0,82,0,87,0,0,0,1,0,0,0,1,0,8,0,2,0,28,0,4,0,107,0,106,0,139,0,138,0,1,0,
+0,0,1,0,8,0,1,0,6,0,56,0,2,0,1,0,100,0,103,0,0,0,1,0,0,0,1,0,8,0,2,0,10,0,
+2,0,146,0,147,0,1,0,2,0,64,0,73,0,1,0,0,0,1,0,8,0,2,0,26,0,10,0,67,0,68,0,
+69,0,70,0,64,0,73,0,82,0,83,0,84,0,85,0,2,0,2,0,142,0,147,0,0,0,152,0,155,
+0,6,0,1,0,0,0,1,0,8,0,2,0,18,0,6,0,67,0,68,0,69,0,70,0,64,0,73,0,2,0,1,0,
+142,0,147,0,0,0,0,0,2,0,0,0,0,0,1,0,0,0,31,0,0,2,224,0,0,0,11,0,0,0,5,62,
+128,0,0,0,0,0,1,255,255,255,255,62,128,0,1,0,0,0,0,255,255,255,254,0,64,0,
+1,0,0,0,2,255,255,255,255,0,64,0,2,0,0,0,0,255,255,255,253,0,3,0,4,0,0,0,
+4,255,255,255,255,0,3,0,5,0,0,0,0,255,255,255,251,0,8,0,1,0,0,0,8,255,255,
+255,255,0,8,0,2,0,0,0,0,255,255,255,247,0,1,0,0,0,0,0,16,255,255,255,255,
+0,1,0,1,0,0,0,0,255,255,255,239,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,80,32,0,0,5,
+0,0,0,1,0,0,0,5,0,0,0,20,0,0,0,28,0,0,0,48,0,0,0,64,0,8,0,66,0,1,0,4,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,255,255,255,255,0,0,32,32,0,0,
+255,255,0,65,0,0,0,0,0,20,32,0,0,4,0,0,0,2,0,8,0,66,0,1,0,87,0,0,0,228,32,
+0,0,1,0,0,0,4,0,0,0,6,0,0,0,20,0,0,0,132,0,0,0,168,0,0,0,192,0,8,0,35,0,53,
+0,4,0,4,0,1,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,
+4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,4,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,
+0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,5,0,5,0,5,0,5,0,5,0,5,0,0,0,0,0,
+0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,1,0,2,0,0,0,0,255,
+255,255,255,0,2,0,0,255,255,255,255,0,0,0,0,255,255,0,0,0,0,0,4,0,8,0,82,
+0,6,0,100,0,101,0,102,0,103,0,104,0,105,0,0,0,0,0,120,32,0,0,0,0,0,0,8,0,
+0,0,6,0,0,0,16,0,0,0,60,0,0,0,96,0,8,0,65,0,19,0,4,0,1,0,1,0,1,0,1,0,1,0,
+1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,5,0,0,0,0,0,0,0,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,2,0,0,0,1,0,2,0,0,0,0,0,2,128,0,0,0,32,
+2,0,0,0,140,32,0,0,2,0,0,0,16,0,0,0,6,0,0,0,28,0,0,0,44,0,0,0,80,0,0,0,112,
+0,0,0,120,0,0,0,124,0,8,0,83,0,5,0,5,0,1,0,1,0,1,0,4,0,0,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,1,0,3,0,1,0,1,0,4,0,0,0,0,0,0,0,0,64,0,
+0,0,0,2,128,0,0,0,0,2,0,0,0,0,0,0,160,0,0,0,0,0,63,255,255,173,191,255,255,
+170,0,0,0,0,0,106,0,0,};
+#endif
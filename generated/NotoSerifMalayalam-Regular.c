@@ -0,0 +1,2239 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifMalayalam_Regular_ttf_size = 52644;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifMalayalam_Regular_ttf");
+asm(".type fz_font_NotoSerifMalayalam_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifMalayalam_Regular_ttf, 52644");
+asm(".balign 64");
+asm("fz_font_NotoSerifMalayalam_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifMalayalam-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifMalayalam_Regular_ttf_size = 52644;
+const char fz_font_NotoSerifMalayalam_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,1,197,1,186,0,0,189,64,0,0,0,40,71,
+80,79,83,210,54,140,121,0,0,189,104,0,0,11,18,71,83,85,66,135,28,169,73,0,
+0,200,124,0,0,5,38,79,83,47,50,121,196,106,186,0,0,1,104,0,0,0,96,99,109,
+97,112,50,70,18,72,0,0,5,136,0,0,1,168,103,97,115,112,0,7,0,7,0,0,189,52,
+0,0,0,12,103,108,121,102,54,2,170,50,0,0,9,20,0,0,166,68,104,101,97,100,18,
+107,188,189,0,0,0,236,0,0,0,54,104,104,101,97,19,139,14,47,0,0,1,36,0,0,0,
+36,104,109,116,120,200,60,45,211,0,0,1,200,0,0,3,190,108,111,99,97,124,153,
+83,209,0,0,7,48,0,0,1,226,109,97,120,112,1,7,1,69,0,0,1,72,0,0,0,32,110,97,
+109,101,142,212,187,102,0,0,175,88,0,0,6,22,112,111,115,116,116,177,104,93,
+0,0,181,112,0,0,7,195,0,1,0,0,0,1,2,143,15,58,96,227,95,15,60,245,0,11,8,
+0,0,0,0,0,211,73,87,234,0,0,0,0,211,101,26,80,249,248,252,55,18,166,6,191,
+0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,6,234,252,15,0,0,18,251,249,248,254,53,18,
+166,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,239,0,1,0,0,0,240,0,192,0,16,0,131,
+0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,1,0,4,7,157,1,144,0,5,0,0,5,154,5,51,
+0,0,0,230,5,154,5,51,0,0,2,92,0,102,2,129,0,0,2,2,5,2,4,5,4,2,2,4,0,128,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,6,234,252,15,0,0,6,
+234,3,241,0,0,0,1,0,0,0,0,4,110,5,183,0,0,0,32,0,5,4,205,0,193,0,0,0,0,2,
+120,0,0,2,120,0,0,11,101,0,85,12,245,0,85,8,23,0,100,14,54,0,100,5,112,0,
+100,11,143,0,100,6,50,0,66,6,41,0,66,9,124,0,85,11,4,0,85,10,122,0,70,10,
+100,0,70,16,42,0,85,5,212,0,85,10,13,0,85,12,24,0,85,4,34,0,80,1,239,254,
+150,1,239,254,40,2,126,255,236,2,126,255,236,2,92,255,186,2,93,254,180,0,
+0,249,248,0,0,249,248,5,176,0,85,4,113,0,85,11,96,0,85,11,119,0,85,10,50,
+0,85,13,132,0,85,6,31,0,90,7,227,0,80,8,7,0,85,7,57,0,85,10,80,0,70,8,192,
+0,85,7,113,0,40,10,150,0,40,7,17,0,95,13,41,0,85,11,207,0,85,4,159,0,85,5,
+58,0,85,9,209,0,85,10,245,0,85,11,59,0,85,7,171,0,85,7,33,0,140,5,0,0,100,
+7,129,0,85,7,128,0,84,7,101,0,70,8,233,0,70,10,252,0,85,5,19,0,100,5,112,
+0,125,7,254,0,85,5,121,0,85,6,139,0,125,7,78,0,85,8,68,0,85,8,243,0,70,9,
+209,0,85,9,40,0,70,8,163,0,85,6,86,0,113,5,57,0,85,5,123,0,100,4,253,0,70,
+9,53,0,80,12,1,0,85,8,70,0,84,5,121,0,85,8,194,0,85,8,70,0,85,3,207,0,85,
+0,0,254,127,2,126,0,100,0,0,253,203,1,228,255,86,0,0,255,144,4,142,0,85,6,
+179,255,176,6,91,0,85,8,229,0,85,5,121,0,85,7,174,0,96,10,27,0,85,6,7,0,85,
+7,142,0,85,8,167,0,84,7,166,254,62,7,145,0,85,11,45,0,85,5,194,0,85,7,63,
+0,85,9,191,0,85,9,9,0,85,10,6,0,100,3,126,1,94,5,69,1,94,4,182,0,121,0,0,
+0,0,0,0,255,213,0,0,255,33,4,193,0,98,2,93,255,107,1,165,0,100,0,0,250,190,
+1,223,254,231,11,190,0,80,14,55,0,80,13,25,0,80,8,34,0,85,10,25,0,85,11,18,
+0,85,7,237,0,90,12,73,0,98,14,136,0,95,18,251,0,95,13,236,0,85,17,129,0,85,
+13,70,0,85,17,226,0,85,4,159,0,85,11,247,0,85,16,35,0,85,17,68,0,85,12,51,
+0,85,13,179,0,85,13,31,0,85,10,145,0,85,11,142,0,85,11,140,0,85,12,226,0,
+85,5,0,0,100,9,216,0,100,10,162,0,85,12,244,0,84,7,172,0,84,12,105,0,85,10,
+116,0,84,8,121,0,85,9,186,0,85,9,110,0,125,12,200,0,85,16,92,0,85,14,170,
+0,85,11,173,0,70,9,117,0,70,10,226,0,100,7,113,0,40,10,252,0,85,7,254,0,85,
+7,158,0,85,7,227,0,80,7,57,0,85,7,113,0,40,9,209,0,85,9,209,0,85,11,59,0,
+85,8,70,0,84,7,101,0,70,10,252,0,85,10,252,0,85,6,139,0,125,8,68,0,85,8,243,
+0,70,9,209,0,85,9,209,0,85,5,57,0,85,7,227,0,80,7,57,0,85,7,171,0,85,7,101,
+0,70,8,233,0,70,10,252,0,85,5,112,0,69,9,186,0,85,6,139,0,125,7,78,0,85,8,
+68,0,85,9,209,0,85,9,40,0,70,2,170,0,211,3,68,0,117,4,121,0,51,7,43,0,92,
+1,195,0,117,2,197,0,117,2,197,0,66,4,0,0,84,4,121,0,133,2,0,0,61,2,123,0,
+51,2,0,0,127,2,78,0,0,4,121,0,92,4,121,0,135,4,121,0,104,4,121,0,119,4,121,
+0,35,4,121,0,113,4,121,0,125,4,121,0,121,4,121,0,94,4,121,0,104,2,74,0,166,
+2,74,0,98,4,121,0,133,4,121,0,133,4,121,0,133,4,0,0,88,2,225,0,205,2,78,0,
+0,2,225,0,76,4,121,0,104,3,172,255,246,3,109,0,102,4,121,1,254,3,109,0,102,
+4,121,0,111,2,123,0,51,4,0,255,246,8,0,255,246,2,0,0,115,2,0,0,61,3,154,0,
+115,3,154,0,61,6,221,0,164,4,121,0,145,4,121,0,133,4,121,0,133,0,0,255,144,
+255,144,0,0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,156,0,0,0,78,0,64,0,5,0,14,0,0,
+0,13,0,35,0,37,0,63,0,95,0,126,0,160,0,173,0,215,0,247,3,7,3,35,9,101,13,
+3,13,11,13,12,13,16,13,20,13,40,13,58,13,61,13,68,13,72,13,78,13,87,13,99,
+13,117,13,127,32,13,32,20,32,25,32,29,32,38,32,185,34,18,37,204,254,255,255,
+255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,173,0,215,0,247,3,7,3,
+35,9,100,13,1,13,5,13,12,13,14,13,18,13,21,13,41,13,61,13,62,13,70,13,74,
+13,87,13,95,13,102,13,121,32,11,32,19,32,24,32,28,32,38,32,185,34,18,37,204,
+254,255,255,255,0,1,255,245,0,0,0,155,0,154,0,127,0,100,255,99,0,54,0,20,
+255,245,253,231,253,204,247,4,0,0,242,255,243,0,243,0,242,255,243,15,0,0,
+243,23,242,214,242,215,0,0,242,204,0,0,242,240,0,0,224,96,224,209,224,206,
+224,204,224,196,223,177,222,219,218,162,1,108,0,1,0,0,0,0,0,74,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,52,0,0,0,0,0,
+0,0,80,0,0,0,86,0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,189,
+0,190,0,191,0,81,0,80,0,82,0,69,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,71,0,
+63,0,72,0,73,0,64,0,65,0,66,0,67,0,68,0,70,0,32,0,33,0,34,0,83,0,85,0,103,
+0,11,0,13,0,27,0,28,0,102,0,75,0,76,0,77,0,78,0,79,0,74,0,0,0,21,0,21,0,21,
+0,21,0,170,1,96,1,204,1,216,2,49,2,61,2,185,3,103,3,222,4,113,4,232,5,111,
+5,123,5,217,5,229,5,241,6,36,6,65,6,121,6,187,7,20,7,94,7,186,8,40,8,170,
+8,246,9,87,9,99,9,237,10,140,11,48,11,126,11,221,12,46,12,116,12,199,13,60,
+13,111,13,217,14,97,14,235,15,121,15,183,15,237,16,71,16,185,17,45,17,144,
+17,184,18,2,18,75,18,148,18,203,19,23,19,124,19,211,20,12,20,120,20,191,20,
+233,21,36,21,127,21,226,22,60,22,155,22,249,23,18,23,71,23,175,24,5,24,141,
+25,34,25,141,25,231,26,108,26,216,27,1,27,58,27,129,27,170,27,212,27,234,
+28,27,28,82,28,137,28,209,29,40,29,153,29,254,30,84,30,164,31,14,31,93,31,
+173,32,38,32,95,32,187,33,63,33,157,34,36,34,49,34,69,34,129,34,129,34,142,
+34,172,35,178,35,235,36,15,36,96,36,113,36,255,37,166,38,54,38,147,38,239,
+39,88,39,210,40,135,41,121,42,108,42,254,43,199,44,146,45,97,45,178,46,71,
+46,226,47,147,48,21,48,189,49,59,49,179,50,79,50,214,51,96,51,191,52,56,52,
+176,53,19,53,127,53,240,54,76,54,163,54,240,55,86,55,207,56,127,56,246,57,
+102,57,200,58,139,58,207,59,70,59,196,60,16,60,163,61,30,61,160,62,66,62,
+255,63,213,64,102,64,195,65,98,65,252,66,76,66,237,67,130,68,40,68,204,69,
+41,69,204,70,81,70,250,71,113,72,3,72,173,73,43,73,189,74,42,74,170,75,77,
+75,236,76,144,76,167,76,188,76,244,77,67,77,80,77,113,77,146,77,186,77,210,
+77,240,77,253,78,13,78,27,78,73,78,111,78,162,78,223,79,14,79,68,79,124,79,
+148,79,223,80,30,80,56,80,97,80,117,80,137,80,158,80,206,80,231,80,244,81,
+13,81,33,81,46,81,98,81,111,81,163,81,206,81,214,81,227,81,240,82,15,82,46,
+82,101,82,156,82,192,82,226,83,4,83,17,83,25,83,34,0,0,0,2,0,193,0,0,4,10,
+5,182,0,3,0,7,0,0,19,33,17,33,37,17,33,17,193,3,73,252,183,2,225,253,135,
+5,182,250,74,104,4,230,251,26,0,3,0,85,255,244,11,16,4,123,0,72,0,91,0,104,
+0,0,1,20,6,6,35,34,38,53,52,18,55,38,35,34,6,21,17,35,17,52,38,38,39,22,22,
+21,20,7,21,22,22,21,20,6,35,34,38,38,53,52,18,55,39,34,6,6,21,20,22,23,6,
+35,34,38,38,53,52,18,36,51,50,23,54,51,50,4,23,54,36,51,50,4,18,5,53,50,54,
+53,52,38,39,6,6,21,20,22,51,50,54,53,52,38,37,52,39,14,2,21,20,22,51,50,54,
+54,11,16,116,192,111,166,191,219,187,115,155,164,222,196,107,207,142,72,79,
+180,96,115,189,158,154,201,93,126,113,59,141,235,140,150,127,29,46,67,151,
+104,171,1,36,176,126,110,101,107,184,1,56,79,67,1,8,155,172,1,19,156,248,
+125,97,110,78,84,139,155,163,138,86,96,130,6,93,98,92,167,105,106,110,65,
+112,69,1,250,163,235,120,213,188,194,1,34,55,96,241,176,253,161,2,89,110,
+193,119,1,52,134,75,183,48,9,14,132,97,131,160,146,234,137,168,1,8,84,2,123,
+233,157,162,247,79,35,140,243,144,186,1,31,158,31,31,160,133,135,159,169,
+254,218,207,97,92,92,71,121,35,59,255,165,181,215,91,79,99,98,31,186,144,
+20,119,187,118,130,154,86,179,0,0,3,0,85,254,163,12,185,4,123,0,96,0,115,
+0,128,0,0,1,20,2,4,35,34,38,38,53,52,55,22,51,50,36,54,53,52,2,39,22,21,20,
+6,6,35,34,38,53,52,18,55,38,35,34,6,21,17,35,17,52,38,38,39,22,22,21,20,7,
+21,22,22,21,20,6,35,34,38,38,53,52,18,55,39,34,6,6,21,20,22,23,6,35,34,38,
+38,53,52,18,36,51,50,23,54,51,50,4,23,54,36,51,50,22,23,22,4,18,5,53,50,54,
+53,52,38,39,6,6,21,20,22,51,50,54,53,52,38,37,52,39,14,2,21,20,22,51,50,54,
+54,12,185,182,254,195,197,80,187,132,6,144,144,171,1,20,160,158,148,75,116,
+192,111,166,191,219,187,115,155,164,222,196,107,207,142,72,79,180,96,115,
+189,158,154,201,93,126,113,59,141,235,140,150,127,29,46,67,151,104,171,1,
+36,176,126,110,101,107,184,1,56,79,67,1,8,155,133,228,82,152,1,11,166,246,
+212,97,110,78,84,139,155,163,138,86,96,130,6,93,98,92,167,105,106,110,65,
+112,69,1,20,186,254,228,155,31,66,49,13,14,44,128,247,172,195,1,4,44,145,
+175,163,235,120,213,188,194,1,34,55,96,241,176,253,161,2,89,110,193,119,1,
+52,134,75,183,48,9,14,132,97,131,160,146,234,137,168,1,8,84,2,123,233,157,
+162,247,79,35,140,243,144,186,1,31,158,31,31,160,133,135,159,104,93,9,158,
+254,214,8,97,92,92,71,121,35,59,255,165,181,215,91,79,99,98,31,186,144,20,
+119,187,118,130,154,86,179,0,0,2,0,100,254,100,7,179,4,122,0,65,0,76,0,0,
+23,52,54,51,33,32,0,53,52,38,35,34,6,21,17,35,17,52,38,35,34,6,7,54,54,51,
+50,22,21,20,6,35,34,38,38,53,52,54,54,51,50,22,23,54,54,51,50,22,22,21,20,
+2,4,35,33,34,6,21,20,22,51,33,21,33,34,38,1,52,38,35,34,7,22,22,51,50,54,
+107,166,133,3,38,1,7,1,45,174,142,123,138,194,193,166,173,235,33,40,132,82,
+134,170,176,140,90,159,98,141,253,162,164,232,70,56,187,111,147,225,123,183,
+254,173,225,252,210,86,89,94,92,5,246,250,63,181,186,1,224,91,73,144,78,21,
+120,76,80,89,143,114,139,1,28,248,172,210,143,124,254,23,1,155,158,187,163,
+143,63,79,166,131,133,168,89,179,130,137,222,127,120,91,107,104,145,239,138,
+179,254,228,161,68,56,52,68,168,145,3,63,81,103,172,92,104,104,255,255,0,
+100,254,100,13,225,4,122,0,38,0,6,0,0,0,7,0,35,8,23,0,0,0,2,0,100,254,100,
+5,22,4,122,0,50,0,61,0,0,23,52,54,51,51,50,54,53,52,38,35,34,6,7,54,54,51,
+50,22,21,20,6,35,34,38,38,53,52,54,36,51,50,4,18,21,20,2,4,35,33,34,6,21,
+20,22,51,33,21,33,34,38,1,52,38,35,34,7,22,22,51,50,54,110,169,141,224,214,
+248,235,206,184,245,28,40,131,82,134,170,176,140,108,158,83,141,1,7,174,187,
+1,27,154,161,254,231,174,254,236,80,92,93,79,3,102,252,202,159,189,1,221,
+91,73,144,78,21,120,76,80,89,146,122,134,252,216,208,238,164,141,63,78,166,
+131,133,168,106,174,102,142,229,131,146,254,254,163,174,254,249,142,61,59,
+57,66,169,144,3,64,81,103,172,92,104,104,0,255,255,0,100,254,100,11,58,4,
+122,0,38,0,8,0,0,0,7,0,35,5,112,0,0,0,4,0,66,254,205,5,231,4,122,0,51,0,62,
+0,73,0,85,0,0,37,20,4,33,32,36,53,52,54,55,38,38,53,52,54,54,51,50,22,21,
+20,6,35,34,38,39,22,22,4,51,50,36,54,55,6,6,35,34,38,53,52,54,51,50,22,22,
+21,20,6,7,22,22,1,22,51,50,54,53,52,38,35,34,6,5,38,38,35,34,6,21,20,22,51,
+50,3,52,38,35,34,6,21,20,22,51,50,54,5,163,254,167,254,207,254,210,254,165,
+161,153,180,212,107,167,94,138,176,168,134,88,143,43,26,151,1,4,179,179,1,
+4,152,26,43,143,88,133,169,176,138,94,167,107,209,177,155,163,251,5,78,144,
+73,91,89,80,76,120,4,196,21,120,76,80,89,91,73,144,83,248,207,207,247,248,
+206,207,248,12,148,171,170,149,98,148,38,62,249,174,124,164,77,168,133,130,
+167,79,63,91,155,95,95,155,91,63,79,167,130,133,168,77,164,124,173,249,62,
+38,148,2,209,172,104,80,80,104,104,92,92,104,104,80,80,104,253,120,97,115,
+115,97,97,115,115,0,0,5,0,66,254,205,5,231,4,122,0,51,0,62,0,73,0,85,0,126,
+0,0,37,20,4,33,32,36,53,52,54,55,38,38,53,52,54,54,51,50,22,21,20,6,35,34,
+38,39,22,22,4,51,50,36,54,55,6,6,35,34,38,53,52,54,51,50,22,22,21,20,6,7,
+22,22,1,22,51,50,54,53,52,38,35,34,6,5,38,38,35,34,6,21,20,22,51,50,3,52,
+38,35,34,6,21,20,22,51,50,54,39,20,6,35,34,39,54,53,52,38,35,34,6,21,21,35,
+53,52,38,35,34,6,21,20,23,6,35,34,38,53,52,54,51,50,22,23,54,54,51,50,22,
+5,163,254,167,254,207,254,210,254,165,161,153,180,212,107,167,94,138,176,
+168,134,88,143,43,26,151,1,4,179,179,1,4,152,26,43,143,88,133,169,176,138,
+94,167,107,209,177,155,163,251,5,78,144,73,91,89,80,76,120,4,196,21,120,76,
+80,89,91,73,144,73,218,247,247,217,217,247,247,218,140,70,53,31,14,48,41,
+35,42,43,88,43,42,35,41,48,14,31,53,70,100,73,52,85,15,15,85,52,74,99,12,
+148,171,170,149,98,148,38,62,249,174,124,164,77,168,133,130,167,79,63,91,
+155,95,95,155,91,63,79,167,130,133,168,77,164,124,173,249,62,38,148,2,209,
+172,104,80,80,104,104,92,92,104,104,80,80,104,253,120,103,128,128,103,99,
+123,123,92,57,73,16,43,57,40,49,59,41,89,89,41,59,49,40,57,43,16,73,57,69,
+93,50,42,42,50,93,0,3,0,85,255,244,9,39,4,122,0,57,0,69,0,81,0,0,1,20,6,6,
+35,34,38,53,52,54,51,50,22,23,55,52,2,35,34,6,7,17,35,17,52,2,35,34,6,6,21,
+23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,36,51,50,
+4,18,1,22,22,51,50,54,53,52,38,35,34,6,5,38,38,35,34,6,21,20,22,51,50,54,
+9,39,102,208,149,146,198,181,139,87,155,46,3,236,194,186,222,10,195,237,190,
+149,218,115,3,54,167,107,147,192,195,158,138,195,98,154,1,28,187,177,1,27,
+72,64,1,12,187,174,1,8,144,247,183,38,134,85,95,103,109,86,81,137,7,72,42,
+137,81,97,118,114,104,87,141,2,3,135,241,151,195,142,140,184,95,72,50,222,
+1,14,243,215,253,202,2,19,220,1,17,133,233,146,50,88,109,189,145,151,186,
+151,242,134,183,1,31,161,170,150,150,170,164,254,225,254,157,109,124,119,
+95,95,115,111,80,80,111,115,95,95,119,124,0,3,0,85,254,163,10,181,4,122,0,
+76,0,89,0,101,0,0,1,20,2,4,35,34,38,38,53,52,55,22,51,50,36,54,53,52,38,39,
+22,21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,7,17,35,17,52,2,35,34,6,6,21,
+23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,36,51,50,
+22,23,22,4,18,37,52,39,14,2,21,20,22,51,50,54,54,5,22,22,51,50,54,53,52,38,
+35,34,6,10,181,182,254,195,197,80,187,132,6,144,144,171,1,20,160,167,136,
+72,116,192,111,166,191,224,190,107,146,174,214,10,195,237,190,149,218,115,
+3,54,167,107,147,192,195,158,138,195,98,154,1,28,187,177,1,26,72,64,1,1,174,
+128,219,79,151,1,9,163,253,153,93,93,169,107,106,110,65,112,69,248,144,38,
+134,85,95,103,109,86,81,137,1,20,186,254,228,155,31,66,49,13,14,44,128,247,
+172,208,250,40,146,173,163,235,120,213,188,195,1,38,52,94,244,215,253,203,
+2,19,220,1,17,133,233,146,50,88,109,189,145,151,186,151,242,134,183,1,31,
+161,170,149,150,169,104,93,10,159,254,215,25,188,143,19,118,189,119,130,154,
+86,179,35,109,124,119,95,95,115,111,0,0,2,0,70,254,40,10,32,4,122,0,71,0,
+79,0,0,1,20,2,6,35,34,39,54,18,53,52,2,36,35,34,4,2,21,20,23,33,17,51,17,
+20,6,35,34,36,39,33,39,62,2,53,52,38,35,34,6,21,20,22,23,6,6,35,34,38,38,
+53,52,54,51,50,22,22,21,20,6,7,33,38,53,16,18,36,51,32,4,18,1,22,22,51,50,
+54,53,53,10,32,107,195,125,43,33,142,165,131,254,248,190,149,254,248,163,
+9,1,210,194,150,127,179,254,248,54,253,181,21,40,65,56,136,105,110,141,101,
+76,12,28,25,53,109,71,222,175,109,184,109,59,58,1,101,9,209,1,83,191,1,0,
+1,83,158,250,210,39,159,110,69,67,1,14,174,254,167,223,11,113,1,142,231,192,
+1,78,204,176,254,165,244,69,65,2,234,251,244,132,155,246,221,35,38,77,130,
+82,110,141,152,119,107,157,50,21,19,92,163,100,175,219,89,166,109,72,140,
+51,69,71,1,28,1,150,206,251,254,113,254,16,144,175,74,65,180,0,0,2,0,70,254,
+46,10,40,4,122,0,88,0,96,0,0,5,20,6,6,35,34,38,53,55,22,51,50,54,53,52,38,
+35,53,50,54,53,52,38,35,34,4,2,21,20,23,33,17,51,17,20,6,35,34,36,39,33,39,
+62,2,53,52,38,35,34,6,21,20,22,23,6,6,35,34,38,38,53,52,54,51,50,22,22,21,
+20,6,7,33,38,53,16,18,36,51,50,4,22,21,20,6,7,21,22,22,5,22,22,51,50,54,53,
+53,10,40,106,162,84,96,113,1,35,36,129,163,172,142,105,145,246,200,164,254,
+211,193,12,1,207,194,152,125,173,254,250,57,253,176,21,40,65,56,136,105,110,
+141,101,76,12,28,25,53,109,71,222,175,109,184,109,59,58,1,104,12,236,1,116,
+205,169,1,27,170,129,101,135,160,250,207,41,158,104,69,67,91,126,169,80,60,
+53,13,6,169,134,136,173,97,167,116,164,201,160,254,177,249,80,77,2,234,251,
+235,127,150,248,218,35,38,77,130,82,110,141,152,119,107,157,50,21,19,92,163,
+100,175,219,89,166,109,72,140,51,80,83,1,28,1,139,194,109,213,151,123,197,
+32,9,32,219,61,144,174,71,58,189,0,255,255,0,85,254,40,15,208,4,122,0,38,
+0,29,0,0,0,7,0,14,5,176,0,0,0,2,0,85,255,244,5,142,4,122,0,54,0,66,0,0,37,
+20,6,35,34,38,53,52,55,22,51,50,54,53,52,38,35,53,50,54,53,52,38,35,34,4,
+6,21,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,22,21,20,6,7,
+21,22,22,5,22,22,51,50,54,53,52,38,35,34,6,5,142,150,120,88,107,6,45,44,78,
+99,127,97,96,111,238,188,146,254,242,175,55,170,106,147,192,195,158,127,194,
+106,208,1,75,188,154,1,15,164,104,76,86,115,251,75,38,134,85,95,103,109,86,
+81,137,245,112,145,59,45,14,15,18,97,76,96,97,97,100,92,117,149,118,251,188,
+86,106,189,145,151,186,137,223,125,227,1,47,143,94,175,114,96,123,20,9,15,
+152,18,105,118,119,95,95,115,117,0,255,255,0,85,255,244,9,229,4,122,0,38,
+0,17,0,0,0,7,0,20,6,24,0,0,255,255,0,85,255,244,11,180,4,122,0,38,0,17,0,
+0,0,7,0,35,5,234,0,0,0,1,0,80,255,244,3,205,4,122,0,33,0,0,19,52,54,51,22,
+22,51,50,54,53,52,38,35,34,6,7,34,38,53,52,54,54,51,50,22,18,21,20,2,6,35,
+34,38,38,80,35,32,27,165,132,143,165,165,143,132,165,27,32,35,93,189,136,
+162,213,100,100,213,162,136,189,93,1,63,41,50,129,171,243,214,213,244,171,
+129,50,41,69,155,107,165,254,248,150,150,254,248,165,107,155,0,1,254,150,
+0,0,1,99,6,191,0,17,0,0,19,52,38,35,34,6,21,21,7,53,52,54,51,50,22,21,17,
+35,160,113,116,85,107,101,188,153,192,184,195,5,41,137,155,109,85,134,3,141,
+135,169,228,194,250,231,0,2,254,40,255,255,1,99,6,191,0,23,0,35,0,0,1,17,
+35,17,52,38,38,35,7,22,22,21,20,6,35,34,38,53,52,54,54,55,50,22,5,52,38,39,
+6,6,21,20,22,51,50,54,1,99,195,82,129,73,22,73,88,133,106,109,139,83,168,
+122,225,229,254,51,60,60,63,62,67,54,56,68,5,0,250,255,5,22,111,145,68,1,
+33,118,71,95,121,133,103,75,137,89,4,230,72,48,92,30,26,92,51,52,75,73,0,
+2,255,236,254,46,2,111,4,123,0,30,0,43,0,0,5,20,6,6,35,34,38,38,53,52,54,
+55,54,53,52,38,35,34,7,39,52,54,51,50,22,21,20,2,7,22,22,7,52,38,38,39,6,
+6,21,20,22,51,50,54,2,111,76,147,100,102,145,73,136,135,69,72,73,29,28,2,
+77,61,106,125,83,65,141,145,147,51,83,68,96,100,112,88,87,111,164,78,138,
+86,93,142,73,123,186,82,255,224,170,156,14,21,42,60,174,142,122,254,188,155,
+83,188,94,66,99,74,45,63,130,89,87,114,114,0,0,3,255,236,254,46,2,111,4,123,
+0,30,0,41,0,61,0,0,5,20,6,6,35,34,38,38,53,52,54,55,54,53,52,38,35,34,7,39,
+52,54,51,50,22,21,20,2,7,22,22,37,6,21,20,22,51,50,54,53,52,38,19,52,39,22,
+21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,54,2,111,76,147,100,102,145,73,
+136,135,69,72,73,29,28,2,77,61,106,125,83,65,141,145,254,163,92,51,42,43,
+50,47,157,73,26,85,68,67,91,15,57,112,88,88,112,164,78,138,86,93,142,73,123,
+186,82,255,224,170,156,14,21,42,60,174,142,122,254,188,155,83,188,200,72,
+88,42,53,52,43,40,84,254,254,109,79,53,55,69,87,87,77,43,41,76,94,87,114,
+114,0,0,2,255,186,253,200,2,62,4,114,0,38,0,50,0,0,5,20,6,35,34,38,38,53,
+52,54,51,50,22,21,20,7,54,54,53,52,38,38,39,46,2,53,52,54,51,50,23,6,21,20,
+22,23,22,22,5,52,38,35,34,6,21,20,22,23,54,54,2,62,195,154,89,135,71,137,
+112,104,132,96,74,87,47,69,60,65,76,53,123,112,29,21,80,52,85,78,44,254,251,
+69,65,65,69,72,64,62,70,201,162,205,78,122,63,105,128,123,92,114,58,29,137,
+91,76,160,147,114,123,164,186,92,131,147,4,129,204,99,225,218,202,182,174,
+54,76,76,54,54,98,25,25,99,0,1,254,180,253,160,2,52,4,114,0,67,0,0,5,20,4,
+35,34,38,38,53,52,54,51,50,22,23,54,54,51,50,22,21,20,6,35,34,39,54,53,52,
+38,35,34,6,21,21,35,53,52,38,35,34,6,21,20,22,51,50,54,53,52,38,39,46,2,53,
+52,54,51,50,23,6,21,20,22,22,23,22,22,2,52,254,244,202,110,195,121,110,80,
+49,80,16,18,88,53,78,105,70,53,31,14,48,47,39,47,48,88,46,43,39,54,175,145,
+161,213,68,107,64,76,53,123,112,29,21,80,38,54,45,77,45,208,171,229,75,148,
+105,88,113,44,43,40,47,92,70,61,79,16,41,69,40,49,59,41,99,104,38,58,68,53,
+105,126,180,135,86,208,203,123,164,187,91,131,147,4,129,204,90,181,158,117,
+200,184,0,0,3,249,248,253,7,255,123,255,180,0,54,0,66,0,78,0,0,3,20,6,6,35,
+34,38,53,52,54,51,50,22,23,55,52,38,35,34,6,7,17,35,17,52,38,35,34,6,21,23,
+54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,54,54,51,50,22,1,
+22,22,51,50,54,53,52,38,35,34,6,5,38,38,35,34,6,21,20,22,51,50,54,133,65,
+131,94,89,124,112,87,52,93,27,2,139,119,114,130,4,146,134,117,134,156,2,33,
+100,64,89,115,117,95,89,126,64,215,180,113,177,46,41,162,113,164,200,250,
+227,23,80,51,57,62,67,50,49,82,4,116,25,82,49,53,70,65,60,53,83,254,71,82,
+147,91,116,86,84,111,57,44,30,123,144,144,123,254,193,1,63,123,144,152,127,
+30,53,66,113,88,90,112,90,145,81,167,202,92,82,83,91,202,254,240,61,69,66,
+53,59,67,67,48,44,60,61,54,52,66,68,0,3,249,248,252,55,0,100,255,180,0,70,
+0,81,0,93,0,0,19,20,6,6,35,34,38,53,55,22,51,50,54,53,52,38,39,22,21,20,6,
+6,35,34,38,53,52,54,55,38,35,34,6,7,17,35,17,52,38,35,34,6,21,23,54,54,51,
+50,22,21,20,6,35,34,38,38,53,52,54,51,50,22,23,54,54,51,50,22,23,22,22,37,
+52,39,6,6,21,20,22,51,50,54,5,22,22,51,50,54,53,52,38,35,34,6,100,121,184,
+91,91,132,2,78,74,152,187,67,56,16,65,131,94,93,118,156,121,67,97,114,130,
+4,146,134,117,134,156,2,33,100,64,89,115,117,95,89,126,64,215,180,113,177,
+46,41,162,113,94,156,48,138,161,254,149,35,112,131,68,54,80,76,251,101,23,
+80,51,57,62,67,50,49,82,253,163,112,166,86,40,44,17,22,168,138,93,129,35,
+56,58,82,147,91,136,103,104,171,28,51,144,123,254,193,1,63,123,144,152,127,
+30,53,66,113,88,90,112,90,145,81,167,202,92,82,83,91,78,70,26,204,19,85,62,
+23,131,89,69,79,133,4,61,69,66,53,59,67,67,0,0,2,0,85,255,240,5,91,4,122,
+0,38,0,50,0,0,33,54,18,53,52,38,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,
+35,34,38,38,53,52,18,36,51,50,4,18,21,20,6,6,35,34,1,52,38,35,34,6,7,22,22,
+51,50,54,3,162,108,131,133,216,123,129,228,141,3,54,167,107,147,192,195,158,
+138,195,98,184,1,42,169,170,1,33,176,112,167,81,49,254,227,109,86,81,137,
+42,38,134,85,95,103,78,1,27,159,163,228,113,117,232,163,50,88,109,189,145,
+151,186,149,241,137,201,1,30,144,143,254,230,199,164,245,129,1,81,95,115,
+111,80,109,124,119,0,3,0,85,255,244,4,43,4,122,0,42,0,54,0,66,0,0,19,52,18,
+36,51,50,22,22,21,20,6,35,34,38,53,52,54,55,35,34,6,6,21,20,22,22,51,38,38,
+53,52,54,51,50,22,21,20,6,6,35,34,36,2,1,52,38,39,6,6,21,20,22,51,50,54,17,
+52,38,35,34,6,21,20,22,23,54,54,85,135,1,10,188,128,178,87,138,110,106,133,
+71,65,11,134,191,97,98,194,137,63,69,133,106,109,139,87,178,128,188,254,246,
+135,3,92,62,63,60,60,68,56,54,67,67,54,56,68,60,60,63,62,2,54,150,1,10,164,
+88,140,77,102,134,121,95,58,116,34,131,212,120,120,211,130,34,115,57,95,121,
+133,102,76,140,88,163,1,9,1,170,51,92,26,30,92,48,53,73,75,254,12,52,75,73,
+53,48,92,30,26,92,255,255,0,85,255,240,11,11,4,122,0,38,0,29,0,0,0,7,0,29,
+5,176,0,0,0,4,0,85,255,240,11,79,4,122,0,38,0,72,0,84,0,96,0,0,33,54,18,53,
+52,38,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,
+50,4,18,21,20,6,6,35,34,1,52,54,51,22,22,51,50,54,53,52,38,35,34,6,7,34,38,
+53,52,54,54,51,50,22,18,21,20,2,6,35,34,38,38,1,52,54,51,50,22,21,20,6,35,
+34,38,5,52,38,35,34,6,7,22,22,51,50,54,3,162,108,131,133,216,123,129,228,
+141,3,54,167,107,147,192,195,158,138,195,98,184,1,42,169,170,1,33,176,112,
+167,81,49,4,16,35,32,27,165,132,143,165,165,143,132,165,27,32,35,93,189,136,
+162,213,100,100,213,162,136,189,93,254,67,69,58,58,71,72,57,57,70,252,144,
+109,86,81,137,42,38,134,85,95,103,78,1,27,159,163,228,113,117,232,163,50,
+88,109,189,145,151,186,149,241,137,201,1,30,144,143,254,230,199,164,245,129,
+1,79,41,50,129,171,243,214,213,244,171,129,50,41,69,155,107,165,254,248,150,
+150,254,248,165,107,155,1,105,52,55,54,53,51,57,55,237,95,115,111,80,109,
+124,119,0,0,5,0,85,255,244,9,174,4,122,0,42,0,76,0,88,0,100,0,112,0,0,19,
+52,18,36,51,50,22,22,21,20,6,35,34,38,53,52,54,55,35,34,6,6,21,20,22,22,51,
+38,38,53,52,54,51,50,22,21,20,6,6,35,34,36,2,5,52,54,51,22,22,51,50,54,53,
+52,38,35,34,6,7,34,38,53,52,54,54,51,50,22,18,21,20,2,6,35,34,38,38,1,52,
+38,39,6,6,21,20,22,51,50,54,5,52,54,51,50,22,21,20,6,35,34,38,1,52,38,35,
+34,6,21,20,22,23,54,54,85,135,1,10,188,128,178,87,138,110,106,133,71,65,11,
+134,191,97,98,194,137,63,69,133,106,109,139,87,178,128,188,254,246,135,5,
+220,35,32,27,165,132,143,165,165,143,132,165,27,32,35,93,189,136,162,213,
+100,100,213,162,136,189,93,253,128,62,63,60,60,68,56,54,67,1,19,69,58,58,
+71,72,57,57,70,254,237,67,54,56,68,60,60,63,62,2,54,150,1,10,164,88,140,77,
+102,134,121,95,58,116,34,131,212,120,120,211,130,34,115,57,95,121,133,102,
+76,140,88,163,1,9,97,41,50,129,171,243,214,213,244,171,129,50,41,69,155,107,
+165,254,248,150,150,254,248,165,107,155,2,80,51,92,26,30,92,48,53,73,75,179,
+52,55,54,53,51,57,55,254,244,52,75,73,53,48,92,30,26,92,0,4,0,85,255,240,
+13,30,4,122,0,38,0,92,0,104,0,116,0,0,1,20,6,6,35,34,39,54,18,53,52,38,38,
+35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,18,
+5,20,2,4,35,34,38,38,53,52,55,22,22,51,50,54,18,53,52,38,35,34,6,21,17,35,
+17,52,38,35,34,6,21,20,22,23,6,35,34,38,38,53,52,54,51,50,22,23,54,54,51,
+50,22,22,5,20,6,35,34,38,53,52,54,51,50,22,1,22,22,51,50,54,53,52,38,35,34,
+6,5,91,112,167,81,49,32,108,131,133,216,123,129,228,141,3,54,167,107,147,
+192,195,158,138,195,98,184,1,42,169,170,1,33,176,7,195,167,254,205,202,128,
+157,66,13,80,130,87,159,239,128,138,106,100,128,194,113,95,89,116,60,66,26,
+32,46,88,56,193,159,102,169,44,45,164,103,130,187,96,249,247,72,57,57,70,
+69,58,58,71,249,201,38,134,85,95,103,109,86,81,137,2,10,164,245,129,16,78,
+1,27,159,163,228,113,117,232,163,50,88,109,189,145,151,186,149,241,137,201,
+1,30,144,143,254,230,61,196,254,207,171,46,68,35,22,18,36,33,154,1,0,149,
+153,203,148,118,254,233,1,25,120,145,135,100,93,139,71,20,81,150,97,157,195,
+100,85,92,93,135,222,178,51,57,55,53,52,55,54,254,188,109,124,119,95,95,115,
+111,0,1,0,90,255,244,5,202,4,122,0,53,0,0,1,20,2,4,35,34,38,38,53,52,55,22,
+22,51,50,54,18,53,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,20,22,23,6,35,
+34,38,38,53,52,54,51,50,22,23,54,54,51,50,22,22,5,202,167,254,205,202,128,
+157,66,13,80,130,87,159,239,128,138,106,100,128,194,113,95,89,116,60,66,26,
+32,46,88,56,193,159,102,169,44,45,164,103,130,187,96,2,148,196,254,207,171,
+46,68,35,22,18,36,33,154,1,0,149,153,203,148,118,254,233,1,25,120,145,135,
+100,93,139,71,20,81,150,97,157,195,100,85,92,93,135,222,0,0,4,0,80,255,244,
+7,147,4,122,0,36,0,43,0,55,0,62,0,0,1,20,6,35,34,38,53,23,50,54,53,52,38,
+39,2,2,35,34,39,6,35,34,38,53,52,54,51,51,54,18,51,50,18,23,51,50,22,37,33,
+38,38,35,34,6,3,38,39,35,34,6,21,20,22,51,50,54,1,33,22,22,51,50,54,7,147,
+162,126,66,84,43,92,109,139,128,7,237,209,212,118,97,189,148,181,231,199,
+77,17,231,190,201,235,15,15,207,241,251,47,2,63,7,118,146,128,162,87,43,5,
+52,120,142,90,65,60,110,2,174,253,189,7,165,135,154,115,1,39,137,169,63,55,
+3,107,96,116,115,2,254,246,254,226,168,166,165,139,158,182,241,1,15,254,248,
+248,182,182,180,210,208,253,227,114,151,116,122,105,98,83,1,102,202,228,233,
+0,2,0,85,255,244,7,123,4,122,0,40,0,52,0,0,19,52,18,36,51,50,4,18,21,20,6,
+7,33,17,51,17,33,39,54,54,53,52,0,35,34,6,6,21,23,54,54,51,50,22,21,20,6,
+35,34,38,38,5,52,38,35,34,6,7,22,22,51,50,54,85,166,1,39,186,178,1,35,168,
+118,77,2,34,195,252,86,20,74,137,254,255,208,148,229,127,3,54,167,107,147,
+192,195,158,138,195,98,2,80,109,86,81,137,42,38,134,85,95,103,2,3,184,1,31,
+160,151,254,238,176,146,217,72,3,255,251,147,34,66,242,189,220,1,17,132,233,
+147,50,88,109,189,145,151,186,149,241,57,95,115,111,80,109,124,119,0,0,1,
+0,85,255,232,6,228,4,127,0,47,0,0,37,54,18,53,52,38,38,35,34,6,21,21,20,2,
+35,34,38,38,53,52,18,54,51,50,23,6,2,21,20,22,22,51,50,54,53,53,52,18,51,
+50,22,22,21,20,2,6,35,34,5,35,176,151,95,151,84,130,160,247,207,124,221,138,
+129,184,73,43,20,176,151,95,151,84,130,160,247,207,124,221,138,129,184,73,
+43,10,135,1,36,173,130,188,96,199,159,203,219,254,249,123,244,173,161,1,35,
+178,34,135,254,220,173,130,188,96,199,159,203,219,1,7,123,244,173,161,254,
+221,178,0,0,2,0,70,0,0,9,196,4,122,0,47,0,55,0,0,1,17,33,17,33,39,54,54,53,
+52,38,35,34,6,21,20,22,23,6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,7,33,
+53,52,54,54,51,50,22,21,17,33,17,33,17,1,21,33,53,16,33,34,6,9,196,250,126,
+253,207,21,73,75,128,104,103,129,88,68,17,48,47,100,66,89,177,123,113,177,
+97,106,1,94,116,197,121,213,227,253,89,3,253,252,3,2,47,254,239,133,153,4,
+110,251,146,1,166,35,58,156,80,102,128,138,110,92,146,40,40,82,146,91,97,
+170,104,91,152,87,133,110,163,147,203,101,232,235,254,255,254,200,4,0,254,
+75,165,160,1,76,157,0,2,0,85,255,244,8,102,4,122,0,72,0,84,0,0,1,20,6,35,
+34,38,53,52,55,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,6,
+21,17,35,17,52,38,35,34,0,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,50,4,23,54,54,51,50,22,22,21,20,6,7,21,22,22,5,22,22,51,50,54,53,
+52,38,35,34,6,8,102,184,142,110,130,6,78,75,96,118,135,103,73,73,103,118,
+152,120,90,170,109,196,228,195,211,254,243,2,54,167,107,147,192,195,158,138,
+195,98,160,1,28,179,166,1,34,78,59,231,160,141,198,98,112,82,97,118,248,120,
+38,134,85,95,103,109,86,81,137,1,10,120,158,64,53,14,15,27,99,81,101,101,
+97,110,102,96,130,92,188,137,253,161,2,95,193,224,254,224,224,50,88,109,189,
+145,151,186,149,241,137,182,1,31,162,130,146,119,157,101,157,85,103,133,23,
+9,19,146,30,109,124,119,95,95,115,111,0,1,0,40,0,0,6,229,4,110,0,33,0,0,1,
+17,33,53,33,50,54,54,53,52,38,35,34,6,21,20,23,6,35,34,38,53,52,54,54,51,
+50,22,21,20,6,7,33,17,6,229,249,67,2,111,60,115,74,126,100,97,120,21,11,22,
+53,53,87,162,108,182,220,67,49,2,65,4,110,251,146,110,67,122,77,103,133,120,
+98,55,63,5,84,70,81,144,88,202,167,80,136,43,4,0,0,2,0,40,255,246,10,65,4,
+122,0,59,0,71,0,0,1,20,6,6,35,34,38,53,52,18,55,38,39,34,0,21,16,23,7,33,
+53,33,50,54,54,53,52,38,35,34,6,21,20,23,6,35,34,38,53,52,54,54,51,50,22,
+21,20,6,7,33,38,38,53,52,18,36,51,50,4,18,1,6,2,21,20,22,51,50,54,53,52,2,
+10,65,95,185,127,171,199,143,115,48,51,220,254,239,205,49,249,162,2,111,60,
+115,74,126,100,97,120,21,11,22,53,53,87,162,108,182,220,67,49,2,24,61,75,
+171,1,31,169,179,1,19,150,254,100,116,126,123,104,107,131,115,1,235,139,228,
+134,237,202,157,1,55,112,16,1,254,231,225,254,243,173,78,110,67,122,77,103,
+133,120,98,55,63,5,84,70,81,144,88,202,167,80,136,43,77,215,123,190,1,25,
+150,168,254,214,1,20,108,254,225,154,136,166,186,178,146,1,9,0,4,0,95,255,
+243,6,178,4,122,0,66,0,77,0,88,0,98,0,0,55,52,54,51,33,50,54,53,52,38,35,
+34,6,21,21,35,53,52,38,35,34,6,7,54,54,51,50,22,21,20,6,35,34,38,53,52,54,
+54,51,50,22,23,54,51,50,22,22,21,20,6,7,22,22,21,20,6,35,34,38,39,7,14,2,
+35,34,38,1,52,38,35,34,7,22,22,51,50,54,1,33,34,6,21,20,22,51,50,54,55,5,
+52,38,35,34,7,22,51,50,54,95,183,142,2,251,150,186,138,106,116,139,194,181,
+141,127,160,29,32,96,56,96,124,135,105,113,143,99,203,147,131,231,50,113,
+250,114,180,100,95,81,78,92,155,122,122,187,50,84,123,174,192,88,146,170,
+1,93,61,51,99,53,14,82,53,54,61,2,126,253,133,68,87,87,74,69,185,204,2,90,
+65,63,80,146,75,137,62,80,236,108,136,166,134,106,138,172,145,109,109,143,
+177,93,72,42,45,121,94,94,123,163,122,88,157,99,123,95,218,99,167,97,97,164,
+58,24,124,87,103,138,137,127,47,70,87,61,135,2,100,55,73,118,63,72,71,254,
+202,74,57,55,75,65,108,46,55,78,71,188,72,0,2,0,85,255,244,12,212,4,122,0,
+85,0,97,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,53,52,38,38,35,34,7,22,18,
+21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,20,22,23,6,35,34,38,38,53,
+52,18,36,51,50,23,54,51,50,4,18,21,21,20,22,51,50,54,53,17,51,17,20,22,51,
+50,54,54,53,52,2,39,54,51,50,22,18,37,6,2,21,20,22,51,50,54,53,52,2,12,212,
+138,221,124,121,205,60,48,183,109,171,221,133,215,124,67,61,111,124,95,185,
+127,171,199,143,124,64,74,130,212,123,153,129,25,50,68,154,105,164,1,20,163,
+148,123,138,151,167,1,31,176,121,122,98,129,194,143,126,90,162,101,165,142,
+29,46,72,166,114,246,196,117,139,123,104,107,131,107,2,12,172,242,122,103,
+92,95,100,197,155,180,162,228,114,16,92,254,239,152,139,228,134,242,207,185,
+1,29,92,24,131,231,143,165,251,81,35,143,247,147,186,1,26,153,59,57,140,254,
+231,201,150,119,142,145,114,2,252,253,42,139,159,92,187,135,198,1,35,98,35,
+171,254,225,250,75,254,252,176,145,177,186,178,133,1,0,0,0,3,0,85,255,240,
+11,122,4,122,0,74,0,86,0,98,0,0,1,20,6,6,35,34,39,54,18,53,52,38,38,35,34,
+7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,39,34,6,21,3,35,17,52,38,35,34,
+6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,54,
+51,50,23,54,51,50,4,18,37,6,2,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,
+53,52,38,35,34,6,11,122,112,167,81,49,32,108,131,129,213,123,66,68,114,127,
+95,185,127,171,199,139,121,69,82,177,220,1,196,225,194,129,228,141,3,54,167,
+107,147,192,195,158,138,195,98,180,1,35,165,165,1,33,78,66,253,152,157,132,
+140,155,166,1,32,176,252,59,114,135,123,104,107,131,110,248,191,38,134,85,
+95,103,109,86,81,137,2,10,164,245,129,16,78,1,27,159,162,228,114,17,92,254,
+241,153,139,228,134,242,207,182,1,27,92,27,3,231,185,253,158,2,85,199,228,
+117,232,163,50,88,109,189,145,151,186,149,241,137,201,1,30,144,128,144,129,
+143,62,60,141,254,231,212,76,254,254,173,145,177,186,178,134,251,253,254,
+109,124,119,95,95,115,111,0,1,0,85,255,244,4,74,4,122,0,42,0,0,55,52,55,30,
+2,51,50,54,53,52,38,39,38,38,53,52,54,54,51,50,4,21,20,7,38,35,34,6,21,20,
+22,23,22,22,21,20,6,6,35,34,38,38,85,15,77,123,212,123,125,166,159,187,225,
+255,136,210,115,196,1,35,15,236,221,164,153,170,182,234,253,134,215,124,134,
+251,155,224,24,16,43,60,57,94,97,93,99,12,15,149,152,114,149,68,109,73,19,
+23,109,104,82,86,85,12,15,164,163,115,149,68,72,111,0,2,0,85,255,244,4,229,
+4,122,0,15,0,31,0,0,19,52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,37,52,38,
+38,35,34,6,6,21,20,22,22,51,50,54,54,85,156,1,8,159,155,1,14,164,164,254,
+242,155,159,254,248,156,3,198,114,189,113,114,197,119,119,196,115,113,189,
+114,2,55,177,1,6,140,140,254,248,175,175,254,248,140,140,1,6,177,148,206,
+103,106,207,144,145,206,106,102,206,0,1,0,85,255,244,9,124,4,122,0,62,0,0,
+1,20,6,6,35,34,38,39,6,6,35,34,38,53,17,52,38,35,34,6,6,21,20,18,23,6,35,
+34,38,2,53,52,54,54,51,50,18,21,17,20,22,51,50,54,53,17,51,17,20,22,51,50,
+54,54,53,52,2,39,54,51,50,22,18,9,124,138,221,124,121,205,60,48,183,109,171,
+221,160,130,84,153,95,165,142,29,46,72,166,114,138,221,124,207,247,121,122,
+98,129,194,143,126,90,162,101,165,142,29,46,72,166,114,2,12,172,242,122,103,
+92,95,100,197,155,1,70,159,199,96,188,130,198,254,221,98,35,171,1,31,164,
+172,242,122,254,250,220,254,218,118,141,145,114,2,252,253,42,139,159,92,187,
+135,198,1,35,98,35,171,254,225,0,2,0,85,255,244,10,160,4,122,0,68,0,80,0,
+0,1,20,2,4,35,34,36,39,6,6,35,34,38,53,17,52,38,35,34,6,6,21,20,18,23,6,35,
+34,38,2,53,52,54,54,51,50,18,21,17,20,22,51,50,54,53,53,19,51,17,20,22,51,
+50,54,54,53,39,6,6,35,34,38,53,52,54,51,50,22,22,39,38,38,35,34,6,21,20,22,
+51,50,54,10,160,180,254,221,165,146,254,235,82,37,194,129,171,221,160,130,
+84,153,95,165,142,29,46,72,166,114,138,221,124,207,247,121,122,98,129,1,193,
+226,196,129,228,141,3,54,167,107,147,192,195,158,138,195,98,137,38,134,85,
+95,103,109,86,81,137,2,107,201,254,226,144,118,126,113,131,197,155,1,70,159,
+199,96,188,130,198,254,221,98,35,171,1,31,164,172,242,122,254,250,220,254,
+218,118,141,145,114,189,2,63,253,168,195,229,117,232,163,50,88,109,189,145,
+151,186,149,241,38,109,124,119,95,95,115,111,0,2,0,85,255,240,10,230,4,122,
+0,69,0,81,0,0,1,20,6,6,35,34,39,54,18,53,52,38,38,35,34,6,21,17,35,17,52,
+38,35,34,6,21,21,17,35,17,52,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,
+34,38,38,53,52,18,36,51,50,4,23,54,54,51,50,22,23,54,54,51,50,22,18,1,22,
+22,51,50,54,53,52,38,35,34,6,10,230,112,167,81,49,32,110,129,88,149,91,124,
+160,194,117,120,112,121,196,225,194,129,228,141,3,54,167,107,147,192,195,
+158,138,195,98,180,1,35,165,146,1,10,84,39,189,125,122,181,51,55,188,117,
+141,230,135,245,248,38,134,85,95,103,109,86,81,137,2,30,171,253,134,16,80,
+1,37,166,159,219,107,166,130,253,40,2,252,118,141,136,115,8,253,4,2,85,199,
+228,117,232,163,50,88,109,189,145,151,186,149,241,137,201,1,30,144,102,114,
+102,114,103,86,93,96,137,254,239,254,116,109,124,119,95,95,115,111,0,2,0,
+85,255,240,7,86,4,122,0,54,0,66,0,0,1,20,6,6,35,34,39,54,18,53,52,38,38,35,
+34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,20,22,23,6,35,34,
+38,38,53,52,18,36,51,50,23,54,51,50,4,18,37,6,2,21,20,22,51,50,54,53,52,2,
+7,86,112,167,81,49,32,108,131,129,213,123,67,61,111,124,95,185,127,171,199,
+143,124,64,74,130,212,123,153,129,25,50,68,154,105,164,1,20,163,148,123,138,
+151,166,1,32,176,252,66,117,139,123,104,107,131,107,2,10,164,245,129,16,78,
+1,27,159,162,228,114,16,92,254,239,152,139,228,134,242,207,185,1,29,92,24,
+131,231,143,165,251,81,35,143,247,147,186,1,26,153,59,57,141,254,231,216,
+75,254,252,176,145,177,186,178,133,1,0,0,2,0,140,0,0,6,159,4,122,0,13,0,22,
+0,0,19,51,17,33,17,52,0,51,50,22,22,21,17,33,37,17,52,38,35,34,6,21,17,140,
+194,1,133,1,0,223,162,222,109,249,237,5,155,180,156,157,164,4,110,252,0,2,
+42,223,1,3,137,235,147,253,141,110,2,18,182,202,191,167,253,212,0,1,0,100,
+255,237,4,166,4,122,0,52,0,0,19,52,18,36,51,50,22,21,20,6,7,21,22,22,21,20,
+6,35,34,38,53,52,55,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,
+34,6,6,21,20,22,23,6,35,34,38,38,100,134,1,23,206,203,246,130,113,120,145,
+210,184,121,153,9,60,104,69,110,125,138,120,128,127,106,141,159,127,166,216,
+99,51,71,17,26,43,93,63,1,221,172,1,50,191,178,144,90,137,24,8,20,160,110,
+136,151,78,61,19,18,26,28,105,94,97,110,109,107,82,94,116,160,250,137,135,
+213,135,13,107,224,0,0,1,0,85,255,244,7,44,4,126,0,48,0,0,1,20,2,6,35,34,
+38,39,6,6,35,34,38,2,53,52,54,54,51,50,23,6,2,21,20,22,22,51,50,54,53,17,
+51,17,20,22,51,50,54,54,53,52,2,39,54,51,50,22,18,7,44,119,223,151,133,193,
+53,52,196,125,141,230,135,112,167,81,49,32,110,129,88,149,91,124,160,194,
+147,122,112,160,82,130,153,25,50,65,155,108,2,51,157,254,249,155,115,101,
+107,109,137,1,17,194,171,253,134,16,80,254,219,166,159,219,107,166,130,2,
+216,253,42,136,162,124,203,117,176,1,10,115,35,150,254,245,0,1,0,84,255,240,
+7,43,4,122,0,48,0,0,1,20,6,6,35,34,39,54,18,53,52,38,38,35,34,6,21,17,35,
+17,52,38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,52,18,54,51,50,22,23,54,54,
+51,50,22,18,7,43,112,167,81,49,32,110,129,88,149,91,124,160,194,147,122,112,
+160,82,130,153,25,50,65,155,108,119,223,151,133,193,53,52,196,125,141,230,
+135,2,30,171,253,134,16,80,1,37,166,159,219,107,166,130,253,40,2,214,136,
+162,124,203,117,176,254,246,115,35,150,1,11,166,157,1,7,155,115,101,107,109,
+137,254,239,0,1,0,70,255,244,6,217,4,110,0,35,0,0,1,17,33,39,62,2,53,52,38,
+35,34,6,21,20,22,23,6,6,35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,17,
+6,217,251,70,21,40,65,56,136,105,110,141,101,76,12,28,25,53,109,71,222,175,
+109,184,109,59,58,3,39,4,110,251,146,35,38,77,130,82,110,141,152,119,107,
+157,50,21,19,92,163,100,175,219,89,166,109,72,140,51,4,0,0,0,2,0,70,255,244,
+8,103,4,122,0,41,0,50,0,0,1,17,33,39,62,2,53,52,38,35,34,6,21,20,22,23,6,
+6,35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,17,52,0,51,50,22,22,7,52,
+38,35,34,6,21,17,33,8,103,249,184,21,40,65,56,136,105,110,141,101,76,12,28,
+25,53,109,71,222,175,109,184,109,59,58,1,171,1,0,223,162,222,109,120,180,
+156,157,164,2,145,2,115,253,141,35,38,77,130,82,110,141,152,119,107,157,50,
+21,19,92,163,100,175,219,89,166,109,72,140,51,2,42,223,1,3,137,235,134,182,
+202,191,167,253,212,0,0,2,0,85,255,244,10,112,4,122,0,56,0,68,0,0,1,17,33,
+39,54,18,53,52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,23,54,54,51,50,
+22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,54,51,50,22,18,21,20,6,7,
+33,17,1,22,22,51,50,54,53,52,38,35,34,6,10,112,252,101,21,94,102,88,149,91,
+124,160,196,223,196,129,228,141,3,54,167,107,147,192,195,158,138,195,98,180,
+1,35,165,151,1,20,87,51,204,130,139,230,137,94,79,2,12,247,49,38,134,85,95,
+103,109,86,81,137,4,110,251,146,35,88,1,16,144,159,219,107,166,130,253,40,
+2,95,194,223,117,232,163,50,88,109,189,145,151,186,149,241,137,201,1,30,144,
+115,128,119,124,133,254,249,186,137,237,80,4,0,252,230,109,124,119,95,95,
+115,111,0,1,0,100,255,237,4,205,4,122,0,63,0,0,19,52,18,36,51,50,22,21,20,
+6,35,35,34,6,21,20,22,51,51,50,22,21,20,6,35,34,38,53,52,55,22,22,51,50,54,
+53,52,38,35,35,34,38,53,52,54,51,51,50,54,53,52,38,35,32,0,17,20,22,23,6,
+35,34,38,38,100,144,1,49,230,188,236,152,130,75,67,82,90,71,95,122,154,211,
+166,121,153,9,66,113,78,79,97,78,67,85,129,156,149,124,65,73,96,132,109,254,
+248,254,225,51,71,17,26,42,93,64,1,221,186,1,47,180,144,115,105,101,51,52,
+54,53,121,98,117,147,78,61,19,18,28,30,77,61,57,57,121,100,98,117,57,51,58,
+64,254,232,254,245,135,213,135,13,113,225,0,3,0,125,0,0,4,243,4,122,0,10,
+0,23,0,34,0,0,1,17,33,17,52,54,36,51,50,4,22,7,52,38,35,34,7,22,22,21,20,
+2,7,33,33,62,2,53,52,38,35,34,6,21,4,243,251,138,155,1,5,157,155,1,4,154,
+195,224,181,67,57,132,165,243,216,2,179,252,197,95,187,120,98,78,100,126,
+2,130,253,126,2,123,164,231,116,121,229,150,170,208,12,7,169,130,146,254,
+197,135,72,223,244,101,98,109,174,138,0,3,0,85,255,244,7,169,4,122,0,41,0,
+58,0,71,0,0,1,20,2,4,35,34,39,6,35,34,36,2,53,52,18,51,50,22,23,54,51,50,
+22,22,21,20,2,7,22,51,50,54,54,53,52,2,39,54,51,50,22,22,1,38,2,53,52,55,
+38,38,35,34,6,21,20,22,22,51,50,3,20,22,23,54,18,53,52,38,35,34,6,6,7,169,
+181,254,211,175,146,140,137,148,193,254,217,160,240,197,70,132,43,111,145,
+111,191,119,158,136,56,62,129,224,138,129,109,32,42,88,170,108,251,193,122,
+142,81,33,96,45,145,169,126,228,148,91,66,144,121,127,132,147,114,68,120,
+75,2,118,199,254,221,152,60,60,178,1,45,177,222,1,17,44,40,91,102,215,159,
+156,254,221,98,13,120,238,168,152,1,4,79,17,133,236,253,124,93,1,22,175,171,
+120,29,26,205,174,144,246,146,2,60,175,254,69,75,1,15,151,152,191,79,155,
+0,2,0,85,255,244,5,36,4,122,0,31,0,43,0,0,1,20,6,6,35,34,38,53,52,18,55,38,
+39,34,0,21,20,22,23,6,35,34,38,38,53,52,18,36,51,50,4,18,1,6,2,21,20,22,51,
+50,54,53,52,2,5,36,95,185,127,171,199,143,115,48,51,220,254,239,153,129,25,
+50,68,154,105,171,1,31,169,179,1,19,150,254,100,116,126,123,104,107,131,115,
+1,235,139,228,134,237,202,157,1,55,112,16,1,254,231,225,165,251,81,35,143,
+247,147,190,1,25,150,168,254,214,1,20,108,254,225,154,136,166,186,178,146,
+1,9,0,0,2,0,125,0,0,5,255,4,122,0,15,0,23,0,0,1,17,33,17,52,54,54,51,50,22,
+21,21,33,17,33,17,1,21,33,53,16,33,34,6,5,255,250,126,116,197,121,213,227,
+253,89,3,253,252,3,2,47,254,239,133,153,4,110,251,146,2,183,147,203,101,232,
+235,227,254,170,4,0,254,75,135,130,1,76,157,0,1,0,85,255,244,6,194,4,122,
+0,36,0,0,1,17,33,39,54,18,53,52,38,38,35,34,6,6,21,20,18,23,6,35,34,38,38,
+53,52,18,54,51,50,22,18,21,20,6,7,33,17,6,194,252,28,21,137,143,92,175,120,
+105,183,113,150,127,17,58,67,151,104,154,252,143,169,249,132,120,118,2,77,
+4,110,251,146,35,85,1,27,154,125,213,129,110,223,160,169,254,255,82,35,146,
+251,150,195,1,20,140,157,254,255,146,137,251,88,4,0,0,0,2,0,85,255,244,7,
+239,4,122,0,48,0,60,0,0,1,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,21,
+20,2,35,34,38,38,53,52,18,54,51,50,23,6,2,21,20,22,22,51,50,54,53,53,52,54,
+36,51,50,4,18,1,6,2,21,20,22,51,50,54,53,52,2,7,239,95,185,127,171,199,144,
+115,50,50,103,179,109,247,207,124,221,138,114,166,72,46,29,142,165,95,153,
+84,130,160,167,1,19,158,179,1,19,150,254,102,117,127,123,104,107,131,119,
+1,235,139,228,134,237,202,157,1,56,112,14,88,170,118,178,219,254,249,122,
+242,172,164,1,31,171,35,98,254,221,198,130,188,96,199,159,171,160,229,118,
+168,254,214,1,22,109,254,224,154,136,166,186,176,157,1,6,0,0,3,0,70,255,244,
+8,103,4,122,0,50,0,60,0,66,0,0,1,17,33,39,62,2,53,52,38,35,34,6,21,20,22,
+23,6,6,35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,17,38,38,53,52,54,51,
+50,22,22,21,21,62,2,55,1,17,52,38,35,34,6,21,20,22,37,6,6,7,17,33,8,103,249,
+184,21,40,65,56,136,105,110,141,101,76,12,28,25,53,109,71,222,175,109,184,
+109,59,58,2,75,185,212,163,131,77,136,85,122,232,176,35,253,8,68,68,72,84,
+160,2,237,85,218,119,1,166,4,99,251,157,35,38,77,130,82,110,141,152,119,107,
+157,50,21,19,92,163,100,175,219,89,166,109,72,140,51,1,104,24,205,153,132,
+162,73,144,102,247,22,141,235,156,253,212,1,11,81,98,93,75,114,144,82,84,
+108,17,254,151,0,0,1,0,85,255,244,9,124,4,122,0,62,0,0,1,20,6,6,35,34,2,53,
+17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,
+52,54,54,51,50,22,23,54,54,51,50,22,21,17,20,22,51,50,54,54,53,52,2,39,54,
+51,50,22,18,9,124,138,221,124,207,247,121,122,98,129,194,143,126,90,162,101,
+165,142,29,46,72,166,114,138,221,124,121,205,60,48,183,109,171,221,160,130,
+84,153,95,165,142,29,46,72,166,114,2,12,172,242,122,1,6,220,1,38,118,141,
+145,114,253,4,2,214,139,159,92,187,135,198,254,221,98,35,171,1,31,164,172,
+242,122,103,92,95,100,197,155,254,186,159,199,96,188,130,198,1,35,98,35,171,
+254,225,0,1,0,70,255,244,8,211,4,126,0,64,0,0,1,20,2,6,35,34,39,54,18,53,
+52,38,38,35,34,6,6,21,20,18,23,7,33,39,62,2,53,52,38,35,34,6,21,20,22,23,
+6,6,35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,38,38,53,52,18,54,51,50,
+4,18,8,211,106,184,111,46,25,124,145,108,176,100,108,182,108,121,120,19,252,
+71,21,40,65,56,136,105,110,141,101,76,12,28,25,53,109,71,222,175,109,184,
+109,59,58,2,42,76,76,146,248,149,156,1,1,149,2,40,154,254,253,151,16,89,1,
+29,178,150,214,109,111,216,150,143,254,241,102,36,35,38,77,130,82,110,141,
+152,119,107,157,50,21,19,92,163,100,175,219,89,166,109,72,140,51,98,228,117,
+181,1,15,145,154,254,239,0,0,2,0,85,255,244,8,78,4,122,0,51,0,63,0,0,1,20,
+2,6,35,34,39,54,18,53,52,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,23,54,
+54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,54,51,50,0,1,22,
+22,51,50,54,53,52,38,35,34,6,8,78,111,171,83,38,24,124,100,172,155,124,160,
+196,225,194,129,228,141,3,54,167,107,147,192,195,158,138,195,98,180,1,35,
+165,153,1,17,83,56,205,129,235,1,15,248,144,38,134,85,95,103,109,86,81,137,
+2,57,164,254,246,151,12,119,1,23,169,217,240,166,130,253,40,2,85,199,228,
+117,232,163,50,88,109,189,145,151,186,149,241,137,201,1,30,144,111,123,116,
+118,254,203,254,15,109,124,119,95,95,115,111,0,1,0,113,254,165,6,16,4,110,
+0,10,0,0,33,33,17,35,17,33,39,1,51,1,33,6,16,253,205,194,253,153,67,1,131,
+212,254,128,4,200,254,165,1,91,95,4,15,252,0,0,0,1,0,85,255,240,4,228,4,122,
+0,33,0,0,33,54,18,53,52,38,38,35,34,6,6,21,20,18,23,6,35,34,38,38,53,52,18,
+36,51,50,4,18,21,20,6,6,35,34,3,33,113,136,112,190,114,111,197,121,150,127,
+25,50,67,151,104,158,1,6,153,173,1,15,150,115,172,83,49,79,1,35,160,146,225,
+124,111,221,155,171,254,252,84,35,147,253,151,188,1,19,144,160,254,227,179,
+164,245,129,0,2,0,100,254,100,5,33,4,122,0,63,0,74,0,0,23,52,54,51,33,50,
+54,53,52,38,35,53,50,54,53,52,38,35,34,4,7,54,54,51,50,22,21,20,6,35,34,38,
+38,53,52,54,36,51,50,4,22,21,20,7,21,22,22,21,20,6,6,35,33,34,6,21,20,22,
+51,33,21,33,34,38,1,52,38,35,34,7,22,22,51,50,54,100,166,133,2,27,81,103,
+132,104,97,110,227,171,196,254,250,29,40,131,82,134,170,176,140,108,158,83,
+148,1,20,184,159,1,6,153,180,96,115,79,158,112,253,207,86,89,94,92,3,131,
+252,178,181,186,1,231,91,73,144,78,21,120,76,80,89,143,114,139,99,76,88,114,
+97,92,92,113,143,165,140,63,78,166,131,133,168,106,174,102,142,229,131,87,
+169,117,183,48,9,16,133,94,74,133,83,68,56,52,68,168,145,3,63,81,103,172,
+92,104,104,0,0,2,0,70,255,245,4,188,4,122,0,46,0,59,0,0,1,22,21,20,6,35,34,
+38,53,52,55,22,51,50,54,53,52,39,7,34,36,38,53,52,54,54,51,50,23,6,6,21,20,
+22,23,46,2,53,52,54,51,50,22,21,20,6,19,52,38,35,34,6,21,20,22,23,23,54,54,
+3,131,36,164,149,112,171,14,92,113,84,102,26,64,182,254,248,138,77,124,68,
+27,23,57,64,199,176,44,53,37,190,165,149,199,173,52,110,84,88,106,56,56,28,
+111,137,1,169,77,74,136,149,91,59,23,20,72,92,72,54,57,3,115,198,123,95,148,
+80,7,51,156,74,155,185,11,60,87,114,67,145,171,184,141,139,205,1,92,88,111,
+106,86,65,116,84,43,34,154,0,0,5,0,80,255,244,8,229,6,113,0,55,0,62,0,74,
+0,81,0,93,0,0,1,20,6,35,34,38,53,52,55,35,2,2,35,34,39,6,35,34,38,53,52,54,
+51,51,54,18,51,50,18,23,51,54,55,62,2,53,52,38,35,34,7,54,54,51,50,22,21,
+20,6,6,7,6,7,22,22,37,33,38,38,35,34,6,3,38,39,35,34,6,21,20,22,51,50,54,
+1,33,22,22,51,50,54,5,52,38,35,35,6,21,20,22,51,50,54,8,229,183,141,152,181,
+50,192,7,237,209,212,118,97,189,148,181,231,199,77,17,231,190,201,235,15,
+246,44,111,79,91,63,109,109,54,57,12,124,83,119,139,80,115,94,63,40,193,218,
+249,221,2,63,7,118,146,128,162,87,43,5,52,120,142,90,65,60,110,2,174,253,
+189,7,165,135,154,115,3,34,144,134,1,64,99,81,71,92,1,39,137,170,179,152,
+113,108,254,246,254,226,168,166,165,139,158,182,241,1,15,254,248,248,68,131,
+94,124,150,81,102,117,22,70,100,158,134,125,209,159,108,72,51,9,180,190,180,
+210,208,253,227,114,151,116,122,105,98,83,1,102,202,228,233,36,118,115,110,
+109,96,115,110,0,3,0,85,255,244,11,172,6,113,0,83,0,94,0,106,0,0,1,20,6,6,
+35,34,38,53,16,1,38,35,34,6,21,17,35,17,52,38,35,34,6,21,21,17,35,17,52,38,
+35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,
+54,54,51,50,22,23,54,54,51,50,23,54,53,52,38,35,34,7,54,54,51,50,22,21,20,
+7,22,18,7,52,38,39,6,17,20,22,51,50,54,37,22,22,51,50,54,53,52,38,35,34,6,
+11,172,95,185,127,171,199,1,5,82,86,145,183,194,117,120,112,121,196,225,194,
+129,228,141,3,54,167,107,147,192,195,158,138,195,98,180,1,35,165,146,1,10,
+84,39,189,125,131,188,47,63,228,143,103,102,68,111,107,54,57,12,124,83,119,
+139,107,137,167,189,123,101,241,123,104,112,126,245,239,38,134,85,95,103,
+109,86,81,137,1,205,131,214,126,237,202,1,25,1,24,36,178,146,253,66,2,252,
+118,141,136,115,8,253,4,2,85,199,228,117,232,163,50,88,109,189,145,151,186,
+149,241,137,201,1,30,144,102,114,102,114,117,95,103,109,40,90,94,98,113,22,
+70,100,158,134,160,149,91,254,204,204,160,248,77,247,254,236,136,166,182,
+53,109,124,119,95,95,115,111,0,2,0,84,255,244,7,241,6,113,0,62,0,73,0,0,1,
+20,6,6,35,34,38,53,16,1,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,20,18,23,
+6,35,34,38,2,53,52,18,54,51,50,22,23,54,54,51,50,23,54,53,52,38,35,34,7,54,
+54,51,50,22,21,20,7,22,18,7,52,38,39,6,17,20,22,51,50,54,7,241,95,185,127,
+171,199,1,6,84,95,131,187,194,147,122,112,160,82,130,153,25,50,65,155,108,
+119,224,151,134,193,53,62,232,146,116,107,70,111,107,54,57,12,124,83,119,
+139,109,140,163,189,118,104,243,123,104,112,126,1,205,131,214,126,237,202,
+1,27,1,23,35,176,122,253,40,2,214,136,162,124,203,117,176,254,246,115,35,
+150,1,11,166,157,1,7,155,117,102,106,113,42,92,94,98,113,22,70,100,158,134,
+161,149,92,254,201,199,152,255,79,245,254,233,136,166,182,0,0,2,0,85,255,
+244,5,38,6,113,0,48,0,60,0,0,1,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,
+20,22,23,6,35,34,38,38,53,52,18,36,51,50,23,54,53,52,38,35,34,7,54,54,51,
+50,22,21,20,7,22,18,1,6,2,21,20,22,51,50,54,53,52,38,5,38,95,185,127,171,
+199,152,121,73,81,127,208,120,153,129,25,50,68,154,105,161,1,15,161,126,115,
+71,111,107,54,57,12,124,83,119,139,110,136,154,254,114,111,145,123,104,107,
+131,107,1,235,139,228,134,242,207,165,1,28,108,29,131,231,143,165,251,81,
+35,143,247,147,186,1,26,153,44,92,96,98,113,22,70,100,158,134,163,149,89,
+254,216,1,19,94,254,252,154,145,177,186,178,133,253,0,0,3,0,85,255,244,8,
+104,6,113,0,68,0,80,0,91,0,0,1,20,6,6,35,34,38,53,16,19,38,35,34,7,22,18,
+21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,20,22,23,6,35,34,38,38,53,
+52,18,36,51,50,23,54,51,50,23,54,53,52,38,35,34,7,54,54,51,50,22,21,20,7,
+22,18,1,6,2,21,20,22,51,50,54,53,52,38,1,52,38,39,6,17,20,22,51,50,54,8,104,
+94,180,124,176,203,247,137,149,139,112,111,122,95,185,127,171,199,154,125,
+76,84,127,208,120,153,129,25,50,68,154,105,161,1,15,161,160,134,168,231,184,
+166,91,111,107,54,57,12,124,83,119,139,128,147,173,251,53,115,146,123,104,
+107,131,104,3,170,126,109,230,123,104,112,126,1,195,127,210,124,237,202,1,
+17,1,17,61,32,93,254,242,150,139,228,134,242,207,168,1,33,98,31,131,231,143,
+165,251,81,35,143,247,147,186,1,26,153,68,68,69,105,108,98,113,22,70,100,
+158,134,172,164,90,254,223,1,33,84,254,248,156,145,177,186,178,130,251,254,
+107,158,236,77,240,254,243,136,166,182,0,0,2,0,85,255,237,7,241,6,113,0,63,
+0,75,0,0,1,20,6,6,35,34,38,53,52,18,55,38,39,34,6,21,21,20,2,35,34,38,38,
+53,52,18,54,51,50,23,6,2,21,20,22,22,51,50,54,53,53,52,54,54,51,50,23,54,
+53,52,38,35,34,7,54,54,51,50,22,21,20,7,22,18,1,6,2,21,20,22,51,50,54,53,
+52,38,7,241,95,185,127,171,199,139,112,66,66,159,194,247,207,124,221,138,
+129,184,73,43,20,176,151,95,151,84,130,160,134,254,174,107,100,64,111,107,
+54,57,12,124,83,119,139,99,148,176,254,92,113,121,123,104,112,126,123,1,235,
+139,228,134,237,202,155,1,50,112,23,1,235,185,143,219,254,249,123,244,173,
+161,1,35,178,34,135,254,220,173,130,188,96,199,159,143,158,246,138,34,87,
+91,98,113,22,70,100,158,134,156,140,85,254,212,1,16,107,254,229,151,136,166,
+195,171,148,255,0,2,0,85,0,19,3,122,3,44,0,13,0,25,0,0,19,52,54,54,51,50,
+22,21,20,6,35,34,38,38,37,52,38,35,34,6,21,20,22,51,50,54,85,92,183,130,177,
+223,227,173,130,183,92,2,115,135,120,119,150,150,119,115,140,1,159,106,181,
+110,220,177,173,223,109,181,102,142,161,170,130,129,168,148,0,2,254,127,4,
+214,1,61,6,131,0,11,0,38,0,0,3,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,
+50,23,6,21,20,22,51,50,54,53,52,39,54,51,50,22,21,20,6,35,34,38,38,86,49,
+35,35,48,48,35,35,49,254,213,81,59,22,27,14,111,96,91,113,18,18,18,47,51,
+198,156,107,158,83,6,47,35,49,49,35,35,48,49,60,68,81,8,36,38,80,99,96,79,
+45,34,6,80,56,115,148,74,116,0,0,4,0,100,0,13,2,26,4,52,0,11,0,23,0,35,0,
+47,0,0,19,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,
+54,1,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,100,
+129,97,90,122,122,90,99,127,1,36,59,42,44,61,61,44,42,59,254,220,127,100,
+91,120,122,89,99,128,1,35,59,41,44,61,61,44,42,58,3,91,96,121,123,94,95,123,
+123,95,58,62,65,55,57,64,62,253,199,95,121,123,93,95,123,122,96,57,63,65,
+55,57,64,62,0,0,1,253,203,4,214,0,87,6,102,0,26,0,0,1,52,54,51,50,23,6,21,
+20,22,51,50,54,53,52,39,54,51,50,22,21,20,6,35,34,38,38,253,203,72,56,25,
+20,14,103,88,83,103,21,20,19,47,51,175,139,108,153,77,5,208,66,84,8,41,43,
+77,92,90,71,51,41,7,80,56,115,148,73,115,0,1,255,86,254,62,2,142,6,19,0,27,
+0,0,3,52,55,22,51,50,54,53,17,52,54,51,50,22,21,20,7,38,35,34,6,21,17,20,
+6,35,34,38,170,20,81,62,75,77,165,131,88,125,20,81,62,75,77,165,131,88,125,
+254,177,23,25,32,92,80,5,149,123,150,68,47,23,25,32,92,80,250,107,123,150,
+68,0,1,255,144,4,234,0,110,6,65,0,11,0,0,3,50,22,21,20,6,35,34,38,53,52,54,
+1,47,64,76,35,36,75,64,6,65,67,53,86,137,135,88,53,67,0,2,0,85,0,89,4,77,
+4,44,0,15,0,30,0,0,19,52,54,54,51,50,22,22,21,20,6,6,35,34,38,38,37,52,38,
+35,34,6,6,21,20,22,22,51,50,54,54,85,134,228,137,136,237,144,144,237,136,
+137,228,134,3,46,187,153,96,166,100,100,165,97,93,155,92,2,66,149,223,118,
+119,223,148,148,222,119,118,222,149,171,207,88,171,119,119,171,87,84,170,
+0,0,2,255,176,254,101,6,54,4,122,0,25,0,34,0,0,7,52,54,51,33,17,52,0,51,50,
+22,22,21,17,33,34,6,21,20,22,51,33,21,5,34,38,1,17,52,38,35,34,6,21,17,80,
+170,147,1,125,1,0,223,162,222,109,250,244,77,101,104,74,1,141,254,53,141,
+175,6,14,180,156,157,164,156,124,142,2,42,223,1,3,137,235,147,253,141,85,
+67,64,84,110,1,141,1,124,2,18,182,202,191,167,253,212,0,1,0,85,255,244,6,
+51,4,122,0,34,0,0,37,21,33,39,54,18,53,52,38,38,35,34,6,6,21,20,18,23,6,35,
+34,38,38,53,52,18,54,51,50,22,18,21,20,6,7,6,51,252,171,21,137,143,92,175,
+120,105,183,113,150,127,17,58,67,151,104,154,252,143,169,249,132,120,118,
+110,110,35,85,1,27,154,125,213,129,110,223,160,169,254,255,82,35,146,251,
+150,195,1,20,140,157,254,255,146,137,251,88,0,0,1,0,85,255,244,8,189,4,122,
+0,48,0,0,37,21,33,39,54,18,53,52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,
+6,21,20,18,23,6,35,34,38,2,53,52,54,54,51,32,23,54,54,51,50,22,22,21,20,6,
+7,8,189,252,171,21,137,143,91,153,94,124,160,194,143,126,90,162,101,165,142,
+29,46,66,168,118,138,221,124,1,24,110,53,195,123,141,230,135,121,118,110,
+110,35,85,1,27,154,153,211,103,166,130,253,40,2,214,139,159,92,187,135,198,
+254,221,98,35,172,1,31,163,172,242,122,212,105,107,126,249,178,139,255,89,
+0,2,0,85,255,244,5,146,5,243,0,46,0,57,0,0,1,22,22,21,20,6,6,35,34,38,53,
+52,18,55,38,39,34,0,21,20,22,23,6,35,34,38,38,53,52,18,36,51,50,23,54,54,
+53,52,38,39,54,51,50,22,21,20,6,3,52,38,39,4,17,20,22,51,50,54,4,138,84,90,
+100,193,134,168,202,209,168,105,133,211,254,250,153,129,25,50,68,154,105,
+166,1,21,164,214,159,90,91,64,48,18,29,110,135,146,133,76,70,254,173,123,
+104,121,137,3,185,91,247,144,134,219,128,211,176,180,1,41,94,74,4,254,230,
+224,165,251,81,35,143,247,147,189,1,26,150,109,54,117,85,61,118,46,5,135,
+109,114,162,253,210,123,222,80,194,254,213,122,150,183,0,1,0,96,254,132,7,
+78,5,200,0,76,0,0,19,16,18,36,33,32,0,18,21,20,2,35,34,39,54,54,53,52,2,36,
+35,34,4,2,21,16,18,4,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,
+6,21,20,22,23,6,35,34,38,38,53,52,18,54,51,50,22,21,20,6,7,21,22,22,21,20,
+4,33,34,36,2,96,221,1,148,1,11,1,47,1,141,182,113,81,16,17,52,48,186,254,
+170,224,230,254,159,196,182,1,19,150,211,236,138,120,128,127,107,140,146,
+119,136,176,80,51,71,17,26,43,93,63,113,236,175,197,237,134,109,120,145,254,
+192,254,226,247,254,172,168,2,26,1,27,1,171,232,254,230,254,81,227,203,254,
+212,6,125,244,141,220,1,119,223,206,254,133,253,254,229,254,158,152,204,181,
+130,147,109,140,109,118,142,138,225,134,135,213,135,13,107,224,165,168,1,
+25,170,203,169,117,172,22,8,26,199,135,224,251,246,1,160,0,1,0,85,254,153,
+9,198,4,122,0,69,0,0,1,20,2,4,35,34,38,53,52,55,22,51,32,0,17,52,38,38,35,
+34,6,21,17,35,17,52,38,35,34,6,21,21,17,35,17,52,38,35,34,6,6,21,20,18,23,
+6,35,34,38,2,53,52,18,54,51,50,22,23,54,54,51,50,22,23,54,54,51,50,22,18,
+9,198,158,254,196,228,128,161,6,104,104,1,14,1,48,91,149,89,124,160,194,117,
+120,112,121,194,147,122,112,160,82,130,153,25,50,65,155,108,119,224,151,123,
+183,55,45,180,115,123,182,50,54,188,117,136,231,141,1,234,248,254,129,218,
+69,57,13,14,44,1,117,1,81,192,253,119,166,130,253,40,2,252,118,141,136,115,
+8,253,4,2,214,136,162,124,203,117,176,254,246,115,35,150,1,11,166,157,1,7,
+155,98,88,88,98,104,87,94,97,144,254,217,0,2,0,85,254,153,5,173,4,122,0,44,
+0,56,0,0,5,52,55,22,51,50,36,18,53,52,2,38,35,34,6,6,21,23,54,54,51,50,22,
+21,20,6,35,34,38,38,53,52,18,36,51,50,4,18,21,20,2,4,35,34,38,1,52,38,35,
+34,6,7,22,22,51,50,54,1,156,6,104,104,192,1,27,149,145,236,132,140,246,152,
+3,54,167,107,147,192,195,158,138,195,98,196,1,60,179,178,1,55,188,180,254,
+172,232,128,161,1,9,109,86,81,137,42,38,134,85,95,103,233,13,14,44,171,1,
+48,195,186,1,19,143,117,232,163,50,88,109,189,145,151,186,149,241,137,201,
+1,30,144,178,254,180,222,231,254,162,192,69,2,99,95,115,111,80,109,124,119,
+0,1,0,85,254,103,7,2,4,122,0,52,0,0,1,17,20,6,4,35,34,38,53,52,55,22,22,51,
+50,54,54,55,33,39,54,18,53,52,38,38,35,34,6,6,21,20,18,23,6,35,34,38,38,53,
+52,18,54,51,50,22,18,21,20,6,7,33,17,7,2,147,254,220,204,189,240,6,68,191,
+89,145,216,127,19,252,175,21,137,143,92,175,120,105,183,113,150,127,17,58,
+67,151,104,154,252,143,169,249,132,120,118,2,133,4,116,251,230,123,230,146,
+69,57,13,14,21,23,86,137,77,35,85,1,27,154,125,213,129,110,223,160,169,254,
+255,82,35,146,251,150,195,1,20,140,157,254,255,146,137,251,88,4,6,0,0,2,0,
+84,255,244,8,138,5,243,0,61,0,72,0,0,1,22,22,21,20,6,6,35,34,38,53,52,18,
+55,38,39,34,6,21,17,35,17,52,38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,52,
+18,54,51,50,22,23,54,33,50,23,54,54,53,52,38,39,54,51,50,22,21,20,6,3,52,
+38,39,4,17,20,22,51,50,54,7,130,84,90,100,193,134,168,202,209,168,105,133,
+186,231,194,147,122,112,160,82,130,153,25,50,65,155,108,119,224,151,140,199,
+51,144,1,84,214,159,90,91,64,48,18,29,110,135,146,133,76,70,254,173,123,104,
+121,137,3,185,91,247,144,134,219,128,211,176,180,1,41,94,74,4,199,159,253,
+100,2,214,136,162,124,203,117,176,254,246,115,35,150,1,11,166,157,1,7,155,
+129,111,240,109,54,117,85,61,118,46,5,135,109,114,162,253,210,123,222,80,
+194,254,213,122,150,183,0,1,254,62,254,103,7,81,4,122,0,53,0,0,1,20,6,6,35,
+32,39,6,6,35,34,38,39,6,2,6,35,34,38,53,52,55,22,51,50,54,53,17,51,17,22,
+22,51,50,54,53,17,51,17,20,22,51,50,54,54,53,52,2,39,54,51,50,22,18,7,81,
+138,221,124,254,234,112,49,184,117,99,158,49,1,116,228,160,110,179,6,122,
+116,185,190,203,8,152,121,124,160,194,143,126,90,162,101,165,142,29,46,66,
+168,118,2,12,172,242,122,211,104,107,98,101,148,254,238,174,89,57,13,14,64,
+237,206,3,229,253,124,206,180,166,130,2,216,253,42,139,159,92,187,135,198,
+1,35,98,35,172,254,225,0,1,0,85,254,153,7,45,4,122,0,52,0,0,1,20,2,4,35,34,
+38,53,52,55,22,51,32,0,17,52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,
+20,18,23,6,35,34,38,2,53,52,54,54,51,32,23,54,54,51,50,22,18,7,45,158,254,
+196,228,128,161,6,104,104,1,14,1,48,91,149,89,124,160,194,143,126,90,162,
+101,165,142,29,46,66,168,118,138,221,124,1,24,110,53,195,123,136,231,141,
+1,234,248,254,129,218,69,57,13,14,44,1,117,1,81,192,253,119,166,130,253,40,
+2,214,139,159,92,187,135,198,254,221,98,35,172,1,31,163,172,242,122,212,105,
+107,144,254,217,0,0,3,0,85,255,244,11,0,4,123,0,63,0,74,0,84,0,0,1,20,6,35,
+33,22,21,20,6,6,35,34,38,53,52,54,54,55,38,38,35,34,6,21,17,35,17,52,38,35,
+34,6,6,21,20,18,23,6,35,34,38,2,53,52,54,54,51,50,22,23,54,54,51,50,0,23,
+51,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,23,54,54,1,39,6,6,21,20,22,
+51,50,54,11,0,224,226,254,170,4,112,192,118,127,161,111,225,162,38,222,161,
+164,210,194,143,126,90,162,101,165,142,29,46,66,168,118,138,221,124,144,198,
+52,65,240,152,230,1,60,46,246,59,175,138,138,167,196,86,67,81,78,68,113,131,
+252,240,4,189,217,89,69,117,135,3,99,140,157,37,49,159,224,113,161,126,102,
+173,109,5,169,191,179,137,253,60,2,214,139,159,92,187,135,198,254,221,98,
+35,172,1,31,163,172,242,122,114,106,109,111,254,254,224,93,100,127,163,155,
+135,74,93,103,73,96,87,7,105,254,213,92,3,158,135,74,90,195,0,2,0,85,255,
+244,5,224,4,14,0,24,0,36,0,0,19,54,54,51,50,22,21,20,6,35,34,38,38,53,52,
+54,36,51,33,21,33,34,6,6,21,5,52,38,35,34,6,7,22,22,51,50,54,202,54,167,107,
+147,192,195,158,138,195,98,181,1,34,160,3,20,252,197,119,220,139,1,222,109,
+86,81,137,42,38,134,85,95,103,1,206,88,109,189,145,151,186,143,233,131,172,
+246,125,122,93,183,128,191,95,115,111,80,109,124,119,0,0,3,0,85,255,244,6,
+234,6,79,0,38,0,48,0,60,0,0,1,20,6,35,34,38,53,17,38,39,34,4,6,21,23,54,54,
+51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,23,17,51,17,4,0,7,52,2,39,
+17,20,22,51,50,54,37,22,22,51,50,54,53,52,38,35,34,6,6,234,216,171,143,177,
+100,104,194,254,212,166,3,54,167,107,147,192,195,158,138,195,98,200,1,100,
+227,101,94,123,1,18,1,54,188,211,185,93,89,97,117,250,176,38,134,85,95,103,
+109,86,81,137,1,137,175,228,182,145,2,170,24,1,132,233,147,50,88,109,189,
+145,151,186,143,233,131,195,1,39,161,15,1,228,254,2,76,254,134,253,188,1,
+42,76,253,125,96,116,161,74,109,124,119,95,95,115,111,0,3,0,85,255,244,9,
+162,5,243,0,68,0,79,0,91,0,0,1,22,22,21,20,6,6,35,34,38,53,52,18,55,38,39,
+34,6,21,17,35,17,52,38,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,
+38,53,52,18,36,51,50,4,23,54,36,51,50,23,54,54,53,52,38,39,54,51,50,22,21,
+20,6,3,52,38,39,4,17,20,22,51,50,54,37,22,22,51,50,54,53,52,38,35,34,6,8,
+154,84,90,100,193,134,168,202,209,168,105,133,186,231,202,125,202,115,119,
+209,130,3,54,167,107,147,192,195,158,138,195,98,173,1,24,158,165,1,25,79,
+69,1,4,182,214,159,90,91,64,48,18,29,110,135,146,133,76,70,254,173,123,104,
+121,137,248,83,38,134,85,95,103,109,86,81,137,3,185,91,247,144,134,219,128,
+211,176,180,1,41,94,74,4,199,159,253,100,2,8,163,228,113,117,232,163,50,88,
+109,189,145,151,186,149,241,137,201,1,30,144,150,141,145,146,109,54,117,85,
+61,118,46,5,135,109,114,162,253,210,123,222,80,194,254,213,122,150,183,52,
+109,124,119,95,95,115,111,0,0,2,0,85,255,244,8,225,4,122,0,52,0,63,0,0,1,
+33,21,20,6,6,35,34,38,53,52,54,54,55,38,38,35,34,6,21,17,35,17,52,38,35,34,
+6,6,21,20,18,23,6,35,34,38,2,53,52,54,54,51,50,22,23,54,54,51,50,0,23,33,
+5,39,6,6,21,20,22,51,50,54,54,8,225,254,207,111,174,97,119,159,104,205,146,
+31,206,151,155,199,194,143,126,90,162,101,165,142,29,46,66,168,118,138,221,
+124,143,199,52,62,230,145,226,1,48,31,1,57,254,15,2,162,186,78,60,54,96,62,
+2,48,26,182,246,118,163,124,93,162,108,13,175,198,179,137,253,60,2,214,139,
+159,92,187,135,198,254,221,98,35,172,1,31,163,172,242,122,114,105,108,111,
+254,247,227,156,59,13,152,118,74,90,82,175,0,6,0,100,255,244,9,162,4,122,
+0,31,0,43,0,55,0,67,0,79,0,91,0,0,1,20,6,6,35,34,38,53,52,18,55,38,39,34,
+0,21,20,22,23,6,35,34,38,38,53,52,18,36,51,50,4,18,1,6,2,21,20,22,51,50,54,
+53,52,2,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,
+22,5,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,7,
+107,95,185,127,171,199,143,115,48,51,220,254,239,153,129,25,50,68,154,105,
+171,1,31,169,179,1,19,150,254,100,116,126,123,104,107,131,115,251,223,122,
+89,99,128,127,100,91,120,7,136,122,89,99,128,127,100,91,120,247,229,59,41,
+44,61,61,44,42,58,7,136,59,41,44,61,61,44,42,58,1,235,139,228,134,237,202,
+157,1,55,112,16,1,254,231,225,165,251,81,35,143,247,147,190,1,25,150,168,
+254,214,1,20,108,254,225,154,136,166,186,178,146,1,9,254,158,95,123,122,96,
+95,121,123,93,95,123,122,96,95,121,123,93,57,63,65,55,57,64,62,59,57,63,65,
+55,57,64,62,0,1,1,94,0,0,2,32,4,110,0,3,0,0,1,51,17,35,1,94,194,194,4,110,
+251,146,0,2,1,94,0,0,3,231,4,110,0,3,0,7,0,0,1,51,17,35,1,51,17,35,1,94,194,
+194,1,199,194,194,4,110,251,146,4,110,251,146,0,1,0,121,255,244,4,61,5,182,
+0,37,0,0,1,35,2,5,19,22,51,50,55,20,6,6,35,34,38,39,1,53,51,50,54,54,55,33,
+53,33,46,2,35,35,53,33,21,33,22,23,51,4,61,229,31,254,64,231,73,111,26,24,
+43,75,45,74,148,58,254,234,170,122,147,71,6,253,252,2,4,7,68,132,108,201,
+3,196,254,160,113,12,227,3,250,254,163,18,254,117,130,6,40,66,38,98,104,1,
+244,58,54,117,99,96,93,109,50,96,96,89,163,0,0,1,255,213,254,240,0,43,5,6,
+0,3,0,0,3,51,17,35,43,86,86,5,6,249,234,0,0,1,255,33,254,240,0,223,5,133,
+0,14,0,0,3,7,39,55,39,55,23,55,23,7,23,7,39,17,35,43,127,53,168,168,53,170,
+170,53,168,168,53,127,86,4,72,127,55,168,166,55,170,170,55,166,168,55,127,
+250,168,0,0,16,0,98,0,86,4,94,4,82,0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,95,
+0,107,0,119,0,131,0,143,0,155,0,167,0,179,0,191,0,0,1,52,54,51,50,22,21,20,
+6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,
+34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,
+5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,
+54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,
+50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,
+21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,
+6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,
+34,38,2,43,32,21,22,32,32,22,21,32,172,32,21,22,31,31,22,21,32,1,88,32,21,
+22,32,32,22,21,32,254,16,32,22,21,32,32,21,22,32,2,136,31,22,22,31,31,22,
+22,31,253,24,32,21,22,32,32,22,21,32,3,72,31,22,22,31,31,22,22,31,252,147,
+32,22,21,32,32,21,22,32,3,146,31,22,22,31,31,22,22,31,252,147,32,21,22,32,
+32,22,21,32,3,72,31,22,22,31,31,22,22,31,253,24,32,22,21,32,32,21,22,32,2,
+136,31,22,22,31,31,22,22,31,254,16,32,21,22,31,31,22,21,32,1,88,32,21,22,
+32,32,22,21,32,172,32,21,22,32,32,22,21,32,4,29,21,32,32,21,22,32,32,15,21,
+32,32,21,22,31,31,22,21,32,32,21,22,31,31,74,21,32,32,21,22,32,32,22,21,32,
+32,21,22,32,32,130,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,150,22,31,
+31,22,22,31,31,22,22,31,31,22,22,31,31,150,22,31,31,22,22,31,31,22,22,31,
+31,22,22,31,31,130,22,32,32,22,21,32,32,21,22,32,32,22,21,32,32,75,22,31,
+31,22,22,31,31,22,22,31,31,22,22,31,31,15,22,32,32,22,21,32,32,0,0,1,255,
+107,253,200,2,52,4,114,0,38,0,0,19,52,54,51,50,23,6,21,20,22,23,22,22,21,
+20,6,35,34,38,38,53,52,54,51,6,21,20,22,51,50,54,53,52,38,38,39,46,2,100,
+123,112,29,21,80,52,85,78,44,212,167,107,151,76,88,70,16,125,103,112,137,
+47,69,60,65,76,53,3,92,131,147,4,129,204,99,225,218,202,182,76,163,204,69,
+108,59,69,86,39,51,93,104,142,120,76,160,147,114,123,164,186,0,0,1,0,100,
+254,150,3,112,4,131,0,19,0,0,19,52,18,18,51,50,23,6,2,21,20,18,51,50,55,6,
+6,35,34,0,100,126,184,80,35,16,134,157,222,197,115,96,12,160,117,227,254,
+248,1,4,196,1,165,1,22,26,135,254,68,238,253,254,229,37,78,97,1,77,0,2,250,
+190,253,132,255,166,0,116,0,45,0,56,0,0,37,54,51,50,22,22,23,20,6,35,34,38,
+39,38,38,35,34,6,21,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,30,
+2,51,50,54,53,52,38,38,1,22,22,51,50,54,53,52,38,35,34,254,134,28,38,50,100,
+68,4,134,145,105,159,44,39,151,115,113,151,77,136,112,132,152,115,127,163,
+239,176,171,213,50,25,55,54,33,63,70,50,83,252,123,16,88,56,67,73,72,63,102,
+82,34,112,187,107,154,186,138,166,145,169,147,107,115,136,115,101,133,202,
+154,166,219,217,182,94,96,29,105,97,90,145,121,254,83,69,83,83,60,59,83,0,
+0,1,254,231,254,166,1,83,4,110,0,5,0,0,1,17,33,53,33,17,1,83,253,148,1,170,
+4,110,250,56,110,5,90,0,0,5,0,80,255,240,11,105,4,122,0,58,0,65,0,77,0,84,
+0,96,0,0,1,20,6,6,35,34,39,54,18,53,52,38,38,35,34,4,7,51,50,22,21,20,6,6,
+35,34,38,38,53,53,35,2,2,35,34,39,6,35,34,38,53,52,54,51,51,54,18,51,50,18,
+23,51,54,54,36,51,50,4,18,5,33,38,38,35,34,6,3,38,39,35,34,6,21,20,22,51,
+50,54,1,33,22,22,51,50,54,37,7,20,22,22,51,50,54,53,52,38,35,11,105,112,167,
+81,49,32,108,131,133,216,123,183,254,244,35,237,200,221,86,161,106,138,195,
+98,157,7,237,209,212,118,97,189,148,181,231,199,77,17,231,190,201,235,15,
+168,27,191,1,17,151,170,1,33,176,247,89,2,63,7,118,146,128,162,87,43,5,52,
+120,142,90,65,60,110,2,174,253,189,7,165,135,154,115,1,215,1,68,127,85,95,
+103,145,120,2,10,164,245,129,16,78,1,27,159,163,228,113,214,176,174,158,84,
+144,86,149,241,137,25,254,246,254,226,168,166,165,139,158,182,241,1,15,254,
+248,248,164,232,116,143,254,230,87,180,210,208,253,227,114,151,116,122,105,
+98,83,1,102,202,228,233,197,28,104,187,114,119,95,104,115,0,5,0,80,255,241,
+13,226,4,123,0,76,0,83,0,95,0,107,0,114,0,0,1,20,6,6,35,34,39,54,18,53,52,
+38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,17,35,
+17,52,38,35,35,2,2,35,34,39,6,35,34,38,53,52,54,51,51,54,18,51,50,18,23,51,
+50,23,53,52,18,54,51,50,23,54,51,50,4,18,5,33,38,38,35,34,6,37,6,2,21,20,
+22,51,50,54,53,52,2,1,38,39,35,34,6,21,20,22,51,50,54,1,33,22,22,51,50,54,
+13,226,112,167,81,49,32,108,131,129,213,123,67,61,111,124,95,185,127,171,
+199,143,124,64,74,113,187,107,192,145,120,4,7,237,209,212,118,97,189,148,
+181,231,199,77,17,231,190,201,235,15,62,192,93,146,248,147,148,123,138,151,
+166,1,32,176,244,224,2,63,7,118,146,128,162,7,84,117,139,123,104,107,131,
+107,247,239,43,5,52,120,142,90,65,60,110,2,174,253,189,7,165,135,154,115,
+2,11,164,245,129,16,78,1,27,159,162,228,114,16,92,254,239,152,139,228,134,
+242,207,185,1,29,92,24,131,231,143,253,247,1,45,114,125,254,246,254,226,168,
+166,165,139,158,182,241,1,15,254,248,248,111,3,186,1,26,153,59,57,141,254,
+231,89,180,210,208,123,75,254,252,176,145,177,186,178,133,1,0,253,184,114,
+151,116,122,105,98,83,1,102,202,228,233,0,0,6,0,80,255,244,12,141,4,122,0,
+53,0,60,0,70,0,76,0,88,0,95,0,0,1,17,33,39,62,2,53,52,37,2,2,35,34,39,6,35,
+34,38,53,52,54,51,51,54,18,51,50,18,23,51,50,22,21,20,6,7,33,17,38,38,53,
+52,54,51,50,22,22,21,21,62,2,55,1,33,38,38,35,34,6,5,17,52,38,35,34,6,21,
+20,22,37,6,6,7,17,33,37,38,39,35,34,6,21,20,22,51,50,54,1,33,22,22,51,50,
+54,12,141,249,184,21,40,65,56,254,245,7,237,209,212,118,97,189,148,181,231,
+199,77,17,231,190,201,235,15,15,207,241,64,61,2,75,185,212,163,131,77,136,
+85,122,232,176,35,246,105,2,63,7,118,146,128,162,6,145,68,68,72,84,160,2,
+237,85,218,119,1,166,246,175,43,5,52,120,142,90,65,60,110,2,174,253,189,7,
+165,135,154,115,4,99,251,157,35,33,69,116,73,210,4,254,246,254,226,168,166,
+165,139,158,182,241,1,15,254,248,248,162,140,61,118,43,1,104,24,205,153,132,
+162,73,144,102,247,22,141,235,156,254,12,180,210,208,238,1,11,81,98,93,75,
+114,144,82,84,108,17,254,151,165,114,151,116,122,105,98,83,1,102,202,228,
+233,0,0,1,0,85,255,237,7,200,4,127,0,66,0,0,19,52,18,54,51,50,23,6,2,21,20,
+22,22,51,50,54,53,53,16,0,33,50,4,21,20,6,7,21,22,22,21,20,6,35,34,38,53,
+52,55,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,21,21,20,
+2,35,34,38,38,85,129,184,73,43,20,176,151,95,151,84,130,160,1,74,1,44,241,
+1,16,130,113,120,145,210,184,121,153,9,60,104,69,110,125,138,120,128,127,
+106,141,192,147,201,227,247,207,124,221,138,2,9,161,1,35,178,34,135,254,220,
+173,130,188,96,199,159,144,1,3,1,26,171,151,90,137,24,8,20,160,110,136,151,
+78,61,19,18,26,28,105,94,97,110,109,107,82,104,106,221,196,144,219,254,249,
+123,244,0,0,1,0,85,255,237,9,196,4,127,0,63,0,0,1,20,6,6,35,34,39,54,18,53,
+52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,20,2,35,34,38,38,53,52,18,
+54,51,50,23,6,2,21,20,22,22,51,50,54,53,17,52,54,54,51,50,22,23,54,54,51,
+50,22,18,9,196,112,167,81,49,32,110,129,88,149,91,124,160,194,124,106,110,
+130,247,207,124,221,138,129,184,73,43,20,176,151,95,151,84,130,160,122,197,
+115,127,190,56,54,189,117,141,230,135,2,30,171,253,134,16,80,1,37,166,159,
+219,107,166,130,253,40,2,244,130,149,151,128,254,219,219,254,249,123,244,
+173,161,1,35,178,34,135,254,220,173,130,188,96,199,159,1,27,136,180,86,102,
+91,95,98,137,254,239,0,0,3,0,85,255,237,10,149,4,127,0,47,0,60,0,71,0,0,1,
+17,33,17,52,38,35,34,6,21,17,20,2,35,34,38,38,53,52,18,54,51,50,23,6,2,21,
+20,22,22,51,50,54,53,17,52,54,54,51,50,22,23,54,36,51,50,4,22,7,52,38,35,
+34,7,22,22,21,20,2,7,33,33,62,2,53,52,38,35,34,6,21,10,149,251,63,124,106,
+110,130,247,207,124,221,138,129,184,73,43,20,176,151,95,151,84,130,160,122,
+197,115,140,211,44,70,1,1,157,155,1,4,154,195,224,181,67,57,132,165,243,216,
+2,179,252,197,95,187,120,98,78,100,126,2,130,253,126,2,244,130,149,151,128,
+254,219,219,254,249,123,244,173,161,1,35,178,34,135,254,220,173,130,188,96,
+199,159,1,27,136,180,86,129,114,118,125,121,229,150,170,208,12,7,169,130,
+146,254,197,135,72,223,244,101,98,109,174,138,0,5,0,90,255,244,7,157,4,122,
+0,43,0,55,0,62,0,74,0,81,0,0,1,20,6,35,34,38,53,23,50,54,53,52,38,39,2,2,
+35,34,39,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,23,54,51,50,18,23,
+51,50,22,1,20,22,51,51,54,55,38,38,35,34,6,1,33,38,38,35,34,6,3,38,39,35,
+34,6,21,20,22,51,50,54,1,33,22,22,51,50,54,7,157,162,126,66,84,43,92,109,
+139,128,7,237,209,212,118,97,189,148,181,127,112,112,127,169,135,98,161,51,
+118,213,201,235,15,15,207,241,249,124,146,122,48,9,37,37,110,60,65,90,1,179,
+2,63,7,118,146,128,162,87,43,5,52,120,142,90,65,60,110,2,174,253,189,7,165,
+135,154,115,1,39,137,169,63,55,3,107,96,116,115,2,254,246,254,226,168,166,
+165,139,106,144,35,33,148,111,122,153,87,82,169,254,248,248,182,1,155,116,
+113,126,100,93,83,84,254,194,180,210,208,253,227,114,151,116,122,105,98,83,
+1,102,202,228,233,0,3,0,98,255,243,11,239,4,122,0,103,0,121,0,133,0,0,1,20,
+6,35,34,38,53,52,55,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,
+6,6,21,17,35,17,52,38,38,35,34,7,22,22,21,20,6,7,21,22,22,21,20,6,35,34,38,
+38,53,52,18,55,38,35,34,4,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,50,22,23,54,51,50,4,23,54,54,51,50,22,22,21,20,6,7,21,22,22,1,6,
+6,21,20,22,51,50,54,53,52,38,35,53,50,54,53,52,1,22,22,51,50,54,53,52,38,
+35,34,6,11,239,184,142,110,130,6,78,75,96,118,135,103,73,73,103,118,152,120,
+90,170,109,196,105,195,130,35,43,111,122,120,90,96,115,193,161,150,198,93,
+126,113,120,151,204,254,196,175,3,54,167,107,147,192,195,158,138,195,98,211,
+1,120,239,133,180,89,127,143,174,1,39,75,62,244,151,141,198,98,112,82,97,
+118,249,73,127,151,161,135,88,99,130,104,114,124,250,226,38,134,85,95,103,
+109,86,81,137,1,9,120,158,64,53,14,15,27,99,81,101,101,97,110,102,96,130,
+92,188,137,253,161,2,96,107,191,118,5,44,145,89,88,101,20,9,14,132,97,132,
+159,146,235,136,161,1,1,84,20,132,235,148,50,88,109,189,145,151,186,143,233,
+131,196,1,39,160,25,28,52,158,132,135,155,101,157,85,103,133,23,9,19,146,
+2,87,62,242,159,181,215,91,79,99,98,97,92,74,155,253,214,109,124,119,95,95,
+115,111,0,5,0,95,255,243,14,41,4,122,0,136,0,147,0,158,0,169,0,179,0,0,37,
+20,6,35,34,38,39,7,14,2,35,34,38,53,52,54,51,33,50,54,53,52,38,35,34,6,21,
+21,35,53,52,38,35,34,6,7,54,54,51,50,22,21,20,6,35,34,39,2,0,33,33,34,38,
+53,52,54,51,33,50,54,53,52,38,35,34,6,21,21,35,53,52,38,35,34,6,7,54,54,51,
+50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,51,50,22,22,21,20,6,6,35,
+33,34,6,21,20,22,51,33,32,0,19,38,53,52,54,54,51,50,22,23,54,51,50,22,22,
+21,20,6,7,22,22,1,22,22,51,50,54,53,52,38,35,34,5,22,22,51,50,54,53,52,38,
+35,34,1,33,34,6,21,20,22,51,50,54,55,5,52,38,35,34,7,22,51,50,54,14,35,155,
+122,122,187,50,84,123,174,192,88,146,170,183,142,2,251,150,186,138,106,116,
+139,194,181,141,127,160,29,32,96,56,96,124,135,105,136,72,245,253,216,254,
+194,253,239,145,171,183,142,2,251,150,186,138,106,116,139,194,181,141,127,
+160,29,32,96,56,96,124,135,105,113,143,99,203,147,131,231,50,113,250,114,
+180,100,161,250,131,253,43,68,87,87,74,1,247,1,49,2,19,221,6,99,203,147,131,
+231,50,113,250,114,180,100,95,81,78,92,242,145,14,82,53,54,61,61,51,99,7,
+66,14,82,53,54,61,61,51,99,3,81,253,133,68,87,87,74,69,185,204,2,90,65,63,
+80,146,75,137,62,80,229,103,138,137,127,47,70,87,61,135,114,108,136,166,134,
+106,138,172,145,109,109,143,177,93,72,42,45,121,94,94,123,113,254,199,254,
+195,128,108,108,136,166,134,106,138,172,145,109,109,143,177,93,72,42,45,121,
+94,94,123,163,122,88,157,99,123,95,218,99,167,97,128,188,97,74,57,55,75,1,
+68,1,48,32,33,88,157,99,123,95,218,99,167,97,97,164,58,24,124,1,172,63,72,
+71,54,55,73,118,63,72,71,54,55,73,254,20,74,57,55,75,65,108,46,55,78,71,188,
+72,0,0,4,0,95,255,240,18,166,4,122,0,143,0,155,0,166,0,178,0,0,1,20,6,6,35,
+34,39,54,18,53,52,38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,39,
+34,6,21,3,35,17,52,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,39,
+6,4,35,33,34,38,53,52,54,51,33,50,54,53,52,38,35,34,6,21,21,35,53,52,38,35,
+34,6,7,54,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,51,50,22,
+22,21,20,6,6,35,33,34,6,21,20,22,51,33,32,55,38,53,52,18,36,51,50,4,23,54,
+54,51,50,23,54,51,50,4,18,37,6,2,21,20,22,51,50,54,53,52,38,5,22,22,51,50,
+54,53,52,38,35,34,1,22,22,51,50,54,53,52,38,35,34,6,18,166,112,167,81,49,
+32,108,131,129,213,123,66,68,114,127,95,185,127,171,199,139,121,69,82,177,
+220,1,196,225,194,129,228,141,3,54,167,107,147,192,195,158,133,191,52,110,
+254,149,243,252,175,145,171,183,142,2,251,150,186,138,106,116,139,194,181,
+141,127,160,29,32,96,56,96,124,135,105,113,143,99,203,147,131,231,50,113,
+250,114,180,100,161,250,131,253,43,68,87,87,74,3,55,1,214,194,19,180,1,35,
+165,165,1,33,78,66,253,152,157,132,140,155,166,1,32,176,252,59,114,135,123,
+104,107,131,110,241,105,14,82,53,54,61,61,51,99,7,33,38,134,85,95,103,109,
+86,81,137,2,10,164,245,129,16,78,1,27,159,162,228,114,17,92,254,241,153,139,
+228,134,242,207,182,1,27,92,27,3,231,185,253,158,2,85,199,228,117,232,163,
+50,88,109,189,145,151,186,138,117,115,128,128,108,108,136,166,134,106,138,
+172,145,109,109,143,177,93,72,42,45,121,94,94,123,163,122,88,157,99,123,95,
+218,99,167,97,128,188,97,74,57,55,75,243,77,86,201,1,30,144,128,144,129,143,
+62,60,141,254,231,212,76,254,254,173,145,177,186,178,134,251,110,63,72,71,
+54,55,73,253,246,109,124,119,95,95,115,111,0,3,0,85,255,244,13,96,4,122,0,
+78,0,90,0,102,0,0,1,17,33,53,33,50,54,54,53,52,38,38,35,34,7,22,22,21,20,
+6,35,34,38,53,52,54,55,38,35,34,6,21,3,35,17,52,38,35,34,6,6,21,23,54,54,
+51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,36,51,50,23,54,51,
+50,4,22,21,20,6,7,33,17,1,52,38,39,6,6,21,20,22,51,50,54,5,22,22,51,50,54,
+53,52,38,35,34,6,13,96,249,54,2,82,93,185,119,120,195,111,63,69,96,107,191,
+155,151,180,115,95,63,82,180,217,1,196,225,194,129,228,141,3,54,167,107,147,
+192,195,158,138,195,98,180,1,35,165,162,1,13,101,65,1,13,151,140,116,129,
+149,159,1,21,171,126,108,2,73,251,192,104,81,84,114,102,86,87,108,248,128,
+38,134,85,95,103,109,86,81,137,4,110,251,146,110,129,216,125,143,201,100,
+16,73,214,118,152,190,187,160,118,209,70,21,229,187,253,158,2,85,199,228,
+117,232,163,50,88,109,189,145,151,186,149,241,137,201,1,30,144,122,150,123,
+149,58,57,126,254,183,146,253,73,4,0,253,244,98,187,55,51,179,109,105,126,
+113,153,109,124,119,95,95,115,111,0,0,4,0,85,255,244,17,44,4,122,0,104,0,
+116,0,128,0,140,0,0,1,20,6,6,35,34,38,53,52,18,55,38,39,34,0,21,16,23,7,33,
+53,33,50,54,54,53,52,38,38,35,34,7,22,22,21,20,6,35,34,38,53,52,54,55,38,
+35,34,6,21,3,35,17,52,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,
+38,53,52,18,36,51,50,4,23,54,36,51,50,23,54,51,50,4,22,21,20,6,7,33,38,38,
+53,52,18,36,51,50,4,18,1,6,2,21,20,22,51,50,54,53,52,2,1,52,38,39,6,6,21,
+20,22,51,50,54,5,22,22,51,50,54,53,52,38,35,34,6,17,44,95,185,127,171,199,
+143,115,48,51,220,254,239,205,49,249,37,2,82,93,185,119,120,195,111,63,69,
+96,107,191,155,151,180,115,95,63,82,180,217,1,196,225,194,129,228,141,3,54,
+167,107,147,192,195,158,138,195,98,180,1,35,165,165,1,13,98,65,1,13,151,140,
+116,129,149,159,1,21,171,126,108,2,144,61,75,171,1,31,169,179,1,19,150,254,
+100,116,126,123,104,107,131,115,248,98,104,81,84,114,102,86,87,108,248,128,
+38,134,85,95,103,109,86,81,137,1,235,139,228,134,237,202,157,1,55,112,16,
+1,254,231,225,254,243,173,78,110,129,216,125,143,201,100,16,73,214,118,152,
+190,187,160,118,209,70,21,229,187,253,158,2,85,199,228,117,232,163,50,88,
+109,189,145,151,186,149,241,137,201,1,30,144,125,147,123,149,58,57,126,254,
+183,146,253,73,77,215,123,190,1,25,150,168,254,214,1,20,108,254,225,154,136,
+166,186,178,146,1,9,254,242,98,187,55,51,179,109,105,126,113,153,109,124,
+119,95,95,115,111,0,0,5,0,85,255,243,12,231,4,122,0,103,0,115,0,127,0,138,
+0,148,0,0,37,20,6,35,34,38,39,7,14,2,35,34,38,53,52,54,51,33,50,54,53,52,
+38,35,34,6,21,21,35,53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,55,38,35,
+34,6,21,3,35,17,52,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,
+53,52,18,36,51,50,4,23,54,54,51,50,23,54,51,50,22,23,54,51,50,22,22,21,20,
+6,7,22,22,1,52,38,39,6,6,21,20,22,51,50,54,1,22,22,51,50,54,53,52,38,35,34,
+6,5,33,34,6,21,20,22,51,50,54,55,5,52,38,35,34,7,22,51,50,54,12,225,155,122,
+122,187,50,84,123,174,192,88,146,170,183,142,2,251,150,186,138,106,116,139,
+194,174,122,37,36,68,74,150,120,107,130,113,62,62,168,189,1,196,225,194,129,
+228,141,3,54,167,107,147,192,195,158,138,195,98,180,1,35,165,165,1,33,78,
+57,241,133,125,110,108,120,125,220,54,113,250,114,180,100,95,81,78,92,250,
+242,55,44,48,66,57,47,48,61,249,11,38,134,85,95,103,109,86,81,137,9,103,253,
+133,68,87,87,74,69,185,204,2,90,65,63,80,146,75,137,62,80,229,103,138,137,
+127,47,70,87,61,135,114,108,136,166,134,106,138,172,145,109,129,122,175,9,
+44,128,73,112,139,137,113,132,105,20,221,195,253,158,2,85,199,228,117,232,
+163,50,88,109,189,145,151,186,149,241,137,201,1,30,144,128,144,118,144,47,
+51,111,101,218,99,167,97,97,164,58,24,124,1,212,51,97,30,31,105,59,51,61,
+64,254,133,109,124,119,95,95,115,111,50,74,57,55,75,65,108,46,55,78,71,188,
+72,0,4,0,85,255,240,17,141,4,122,0,110,0,122,0,134,0,146,0,0,1,20,6,6,35,
+34,39,54,18,53,52,38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,39,
+34,6,21,3,35,17,52,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,39,
+34,6,21,3,35,17,52,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,
+53,52,18,36,51,50,4,23,54,54,51,50,23,54,51,50,4,23,54,54,51,50,23,54,51,
+50,4,18,37,6,2,21,20,22,51,50,54,53,52,38,37,6,2,21,20,22,51,50,54,53,52,
+38,1,22,22,51,50,54,53,52,38,35,34,6,17,141,112,167,81,49,32,108,131,129,
+213,123,66,68,114,127,95,185,127,171,199,139,121,69,82,177,220,1,196,225,
+194,58,62,117,129,95,185,127,171,199,132,115,68,70,177,220,1,196,225,194,
+129,228,141,3,54,167,107,147,192,195,158,138,195,98,180,1,35,165,165,1,33,
+78,66,253,152,148,126,132,146,165,1,33,78,66,253,152,157,132,140,155,166,
+1,32,176,246,34,111,132,123,104,107,131,113,5,172,114,135,123,104,107,131,
+110,242,172,38,134,85,95,103,109,86,81,137,2,10,164,245,129,16,78,1,27,159,
+162,228,114,17,92,254,241,153,139,228,134,242,207,182,1,27,92,27,3,231,185,
+253,158,2,85,199,228,14,91,254,239,155,139,228,134,242,207,185,1,28,93,24,
+1,231,185,253,158,2,85,199,228,117,232,163,50,88,109,189,145,151,186,149,
+241,137,201,1,30,144,128,144,129,143,56,56,128,144,129,143,62,60,141,254,
+231,216,74,254,251,176,145,177,186,177,137,254,75,76,254,254,173,145,177,
+186,178,134,251,253,254,109,124,119,95,95,115,111,0,1,0,85,253,98,4,74,4,
+122,0,56,0,0,1,20,6,6,35,34,38,38,53,52,55,30,2,51,50,54,53,52,38,35,33,53,
+33,50,54,53,52,38,39,38,38,53,52,54,54,51,50,4,21,20,7,38,35,34,6,21,20,22,
+23,22,22,21,20,6,7,22,4,74,132,217,124,129,252,159,15,73,112,196,114,149,
+182,184,207,254,107,1,249,125,166,159,187,225,255,136,210,115,196,1,35,15,
+236,221,164,153,170,182,234,253,126,106,232,254,208,115,166,85,73,110,53,
+24,16,44,59,57,131,125,124,162,116,94,97,93,99,12,15,149,152,114,149,68,109,
+73,19,23,109,104,82,86,85,12,15,164,163,111,147,37,94,0,0,2,0,85,255,244,
+11,177,4,123,0,99,0,111,0,0,37,20,6,35,34,38,53,52,55,22,22,51,50,54,53,52,
+38,35,35,34,38,53,52,54,51,51,50,54,53,52,33,34,4,21,17,35,17,52,38,35,34,
+6,21,21,17,35,17,52,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,
+53,52,18,36,51,50,4,23,54,54,51,50,22,23,54,36,51,50,4,21,20,6,35,35,34,6,
+21,20,22,51,51,50,22,5,22,22,51,50,54,53,52,38,35,34,6,11,177,211,166,121,
+153,9,66,113,78,79,97,78,67,85,129,156,149,124,65,73,96,254,202,230,254,252,
+194,117,120,112,121,196,225,194,129,228,141,3,54,167,107,147,192,195,158,
+138,195,98,180,1,35,165,146,1,10,84,39,189,125,137,193,44,68,1,28,172,231,
+1,12,152,130,75,67,82,90,71,95,122,154,245,45,38,134,85,95,103,109,86,81,
+137,252,117,147,78,61,19,18,28,30,77,61,57,57,121,100,98,117,57,51,123,213,
+205,253,161,2,252,118,141,136,115,8,253,4,2,85,199,228,117,232,163,50,88,
+109,189,145,151,186,149,241,137,201,1,30,144,102,114,102,114,127,103,106,
+125,140,120,105,101,51,52,54,53,121,10,109,124,119,95,95,115,111,0,2,0,85,
+255,244,15,206,4,122,0,100,0,112,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,
+17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,21,17,35,17,52,38,35,34,6,6,
+21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,54,51,
+50,22,23,54,54,51,50,22,22,21,17,20,22,51,50,54,53,53,17,51,17,20,22,51,50,
+54,54,53,52,2,39,54,51,50,22,18,1,22,22,51,50,54,53,52,38,35,34,6,15,206,
+138,221,124,125,208,54,43,173,108,190,216,117,120,110,123,194,117,120,112,
+121,196,225,194,129,228,141,3,54,167,107,147,192,195,158,138,195,98,180,1,
+35,165,146,1,10,84,39,189,125,112,172,53,49,171,107,126,184,96,117,120,111,
+122,194,143,126,90,162,101,165,142,29,46,72,166,114,241,16,38,134,85,95,103,
+109,86,81,137,2,12,172,242,122,109,93,92,110,202,180,1,138,118,141,135,119,
+252,255,2,252,118,141,136,115,8,253,4,2,85,199,228,117,232,163,50,88,109,
+189,145,151,186,149,241,137,201,1,30,144,102,114,102,114,88,75,78,85,109,
+175,98,254,118,118,141,144,117,8,2,242,253,42,139,159,92,187,135,198,1,35,
+98,35,171,254,225,254,164,109,124,119,95,95,115,111,0,0,3,0,85,255,244,16,
+239,4,122,0,105,0,117,0,129,0,0,1,20,2,4,35,34,36,39,6,6,35,34,38,53,17,52,
+38,35,34,6,21,17,35,17,52,38,35,34,6,21,21,17,35,17,52,38,35,34,6,6,21,23,
+54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,54,51,50,22,
+23,54,54,51,50,22,22,21,17,20,22,51,50,54,53,53,17,51,17,20,22,51,50,54,54,
+53,39,6,6,35,34,38,53,52,54,51,50,22,22,39,38,38,35,34,6,21,20,22,51,50,54,
+1,22,22,51,50,54,53,52,38,35,34,6,16,239,180,254,221,165,153,254,239,83,39,
+183,116,190,216,117,120,110,123,194,117,120,112,121,196,225,194,129,228,141,
+3,54,167,107,147,192,195,158,138,195,98,180,1,35,165,146,1,10,84,39,189,125,
+112,172,53,49,171,107,126,184,96,117,120,112,121,194,224,195,129,228,141,
+3,54,167,107,147,192,195,158,138,195,98,137,38,134,85,95,103,109,86,81,137,
+240,162,38,134,85,95,103,109,86,81,137,2,107,201,254,226,144,111,124,110,
+125,202,180,1,138,118,141,135,119,252,255,2,252,118,141,136,115,8,253,4,2,
+85,199,228,117,232,163,50,88,109,189,145,151,186,149,241,137,201,1,30,144,
+102,114,102,114,88,75,78,85,109,175,98,254,118,118,141,143,121,8,2,239,253,
+168,197,227,117,232,163,50,88,109,189,145,151,186,149,241,38,109,124,119,
+95,95,115,111,254,138,109,124,119,95,95,115,111,0,4,0,85,255,244,11,182,4,
+122,0,53,0,66,0,77,0,89,0,0,1,17,33,17,52,38,35,34,6,21,21,17,35,17,52,38,
+35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,
+54,54,51,50,22,23,54,36,51,50,4,22,7,52,38,35,34,7,22,22,21,20,2,7,33,33,
+62,2,53,52,38,35,34,6,21,1,22,22,51,50,54,53,52,38,35,34,6,11,182,251,64,
+117,120,112,121,196,225,194,129,228,141,3,54,167,107,147,192,195,158,138,
+195,98,180,1,35,165,146,1,10,84,39,189,125,134,191,46,75,1,2,155,155,1,4,
+154,195,224,181,67,57,132,165,243,216,2,179,252,197,95,187,120,98,78,100,
+126,249,38,38,134,85,95,103,109,86,81,137,2,130,253,126,2,252,118,141,136,
+115,8,253,4,2,85,199,228,117,232,163,50,88,109,189,145,151,186,149,241,137,
+201,1,30,144,102,114,102,114,122,99,108,113,121,229,150,170,208,12,7,169,
+130,146,254,197,135,72,223,244,101,98,109,174,138,254,207,109,124,119,95,
+95,115,111,0,0,3,0,85,255,241,13,94,4,123,0,93,0,105,0,117,0,0,1,20,6,6,35,
+34,39,54,18,53,52,38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,35,
+34,6,6,21,35,17,35,17,52,38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,
+55,38,35,34,6,6,21,20,22,23,6,35,34,38,38,53,52,18,36,51,50,23,54,51,50,4,
+23,54,36,51,50,23,54,51,50,4,18,37,6,2,21,20,22,51,50,54,53,52,2,37,6,2,21,
+20,22,51,50,54,53,52,2,13,94,112,167,81,49,32,108,131,129,213,123,67,61,111,
+124,95,185,127,171,199,143,124,64,74,113,187,107,1,202,120,198,115,51,44,
+114,128,95,185,127,171,199,138,119,60,68,130,212,123,153,129,25,50,68,154,
+105,164,1,20,163,141,119,123,137,181,1,33,69,66,1,4,159,148,123,138,151,166,
+1,32,176,246,49,112,135,123,104,107,131,112,5,167,117,139,123,104,107,131,
+107,2,11,164,245,129,16,78,1,27,159,162,228,114,16,92,254,239,152,139,228,
+134,242,207,185,1,29,92,24,131,231,143,253,247,2,8,162,228,114,10,92,254,
+235,154,139,228,134,242,207,187,1,31,92,20,131,231,143,165,251,81,35,143,
+247,147,186,1,26,153,54,52,176,152,154,177,59,57,141,254,231,222,74,254,248,
+180,145,177,186,178,137,1,4,73,75,254,252,176,145,177,186,178,133,1,0,0,3,
+0,85,255,244,12,162,4,122,0,63,0,72,0,84,0,0,1,17,33,39,54,18,53,52,38,38,
+35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,20,22,23,6,35,
+34,38,38,53,52,18,36,51,50,23,54,51,50,4,18,21,20,6,7,33,17,52,0,51,50,22,
+22,7,52,38,35,34,6,21,17,33,1,6,2,21,20,22,51,50,54,53,52,2,12,162,249,45,
+21,99,111,129,213,123,67,61,111,124,95,185,127,171,199,143,124,64,74,130,
+212,123,153,129,25,50,68,154,105,164,1,20,163,148,123,138,151,165,1,32,177,
+107,87,2,66,1,0,223,162,222,109,120,180,156,157,164,2,145,247,110,117,139,
+123,104,107,131,107,2,115,253,141,34,84,1,4,142,162,228,114,16,92,254,239,
+152,139,228,134,242,207,185,1,29,92,24,131,231,143,165,251,81,35,143,247,
+147,186,1,26,153,59,57,138,254,237,195,136,220,70,2,42,223,1,3,137,235,134,
+182,202,191,167,253,212,3,60,75,254,252,176,145,177,186,178,133,1,0,0,0,2,
+0,85,255,244,10,60,4,126,0,70,0,82,0,0,1,20,6,6,35,34,39,54,18,53,52,38,38,
+35,34,6,21,17,35,17,52,38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,
+38,35,34,6,6,21,20,22,23,6,35,34,38,38,53,52,18,36,51,50,23,54,51,50,4,23,
+54,54,51,50,22,18,37,6,2,21,20,22,51,50,54,53,52,2,10,60,112,167,81,49,32,
+110,129,88,149,91,124,160,202,120,198,115,51,44,114,128,95,185,127,171,199,
+138,119,60,68,130,212,123,153,129,25,50,68,154,105,164,1,20,163,141,119,123,
+137,158,1,18,80,36,224,134,141,230,135,249,83,112,135,123,104,107,131,112,
+2,34,171,253,134,16,80,1,37,166,159,219,107,166,130,253,36,2,8,162,228,114,
+10,92,254,235,154,139,228,134,242,207,187,1,31,92,20,131,231,143,165,251,
+81,35,143,247,147,186,1,26,153,54,52,141,135,123,159,137,254,239,205,74,254,
+248,180,145,177,186,178,137,1,4,0,0,2,0,85,255,244,10,244,4,122,0,101,0,113,
+0,0,37,20,6,35,34,38,53,52,55,22,22,51,50,54,53,52,38,35,35,34,38,53,52,54,
+51,51,50,54,53,52,38,35,32,0,17,17,35,17,52,38,38,35,34,7,22,18,21,20,6,6,
+35,34,38,53,52,18,55,38,35,34,6,6,21,20,22,23,6,35,34,38,38,53,52,18,36,51,
+50,23,54,51,50,4,23,54,36,51,50,22,21,20,6,35,35,34,6,21,20,22,51,51,50,22,
+1,6,2,21,20,22,51,50,54,53,52,2,10,244,211,166,121,153,9,66,113,78,79,97,
+78,67,85,129,156,149,124,65,73,96,132,109,254,254,254,230,202,120,198,115,
+51,44,114,128,95,185,127,171,199,138,119,60,68,130,212,123,153,129,25,50,
+68,154,105,164,1,20,163,141,119,123,137,185,1,34,69,73,1,44,229,188,236,152,
+130,75,67,82,90,71,95,122,154,248,155,112,135,123,104,107,131,112,252,117,
+147,78,61,19,18,28,30,77,61,57,57,121,100,98,117,57,51,58,64,254,234,254,
+243,254,35,2,8,162,228,114,10,92,254,235,154,139,228,134,242,207,187,1,31,
+92,20,131,231,143,165,251,81,35,143,247,147,186,1,26,153,54,52,181,159,159,
+183,144,115,105,101,51,52,54,53,121,2,83,74,254,248,180,145,177,186,178,137,
+1,4,0,0,4,0,85,255,244,11,15,4,122,0,54,0,67,0,78,0,90,0,0,1,17,33,17,52,
+38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,20,22,
+23,6,35,34,38,38,53,52,18,36,51,50,23,54,51,50,4,23,54,36,51,50,4,22,7,52,
+38,35,34,7,22,22,21,20,2,7,33,1,52,38,35,34,6,21,17,62,2,1,6,2,21,20,22,51,
+50,54,53,52,2,11,15,251,63,123,202,118,51,44,114,128,95,185,127,171,199,136,
+116,60,63,130,212,123,153,129,25,50,68,154,105,164,1,20,163,140,119,110,115,
+180,1,41,80,61,1,25,191,155,1,4,154,195,224,181,67,57,132,165,243,216,2,179,
+254,87,98,78,100,126,95,187,120,250,236,112,135,123,104,107,131,112,2,130,
+253,126,2,8,162,228,114,10,92,254,235,154,139,228,134,242,207,190,1,31,90,
+19,131,231,143,165,251,81,35,143,247,147,186,1,26,153,54,42,154,136,142,160,
+121,229,150,170,208,12,7,169,130,146,254,197,135,2,128,98,109,174,138,253,
+233,72,223,244,1,40,74,254,248,180,145,177,186,178,137,1,4,0,2,0,85,255,244,
+12,141,4,122,0,84,0,96,0,0,1,20,6,6,35,34,2,53,17,52,38,35,34,6,21,17,35,
+17,52,38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,
+20,22,23,6,35,34,38,38,53,52,18,36,51,50,23,54,51,50,4,23,54,54,51,50,22,
+21,17,20,22,51,50,54,54,53,52,2,39,54,51,50,22,18,1,6,2,21,20,22,51,50,54,
+53,52,2,12,141,138,221,124,207,247,121,122,98,129,202,120,198,115,51,44,114,
+128,95,185,127,171,199,138,119,60,68,130,212,123,153,129,25,50,68,154,105,
+164,1,20,163,141,119,123,137,155,1,13,80,33,199,135,171,221,160,130,84,153,
+95,165,142,29,46,72,166,114,247,2,112,135,123,104,107,131,112,2,12,172,242,
+122,1,6,220,1,38,118,141,145,114,253,4,2,8,162,228,114,10,92,254,235,154,
+139,228,134,242,207,187,1,31,92,20,131,231,143,165,251,81,35,143,247,147,
+186,1,26,153,54,52,135,129,123,143,197,155,254,186,159,199,96,188,130,198,
+1,35,98,35,171,254,225,1,1,74,254,248,180,145,177,186,178,137,1,4,0,0,1,0,
+100,253,98,4,169,4,122,0,69,0,0,1,20,6,6,35,34,38,38,53,52,55,30,2,51,50,
+54,53,52,38,35,35,53,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,
+6,21,20,22,23,6,35,34,38,38,53,52,18,36,51,50,22,21,20,6,7,21,22,22,21,20,
+6,7,4,4,169,132,217,124,129,252,159,15,73,112,196,114,149,182,184,207,17,
+151,110,125,138,120,128,127,106,141,159,127,166,216,99,51,71,17,26,43,93,
+63,134,1,23,206,203,246,130,113,128,137,144,117,1,8,254,208,115,166,85,73,
+110,53,24,16,44,59,57,131,125,124,162,122,105,94,97,110,109,107,82,94,116,
+160,250,137,135,213,135,13,107,224,165,172,1,50,191,178,144,90,137,24,8,19,
+142,109,97,144,22,71,0,1,0,100,255,234,9,131,4,123,0,87,0,0,1,20,6,6,35,34,
+38,39,6,4,35,32,38,53,52,33,23,50,54,53,52,38,35,35,53,51,50,53,52,33,34,
+0,21,20,22,23,6,35,34,38,38,53,52,18,36,51,50,22,21,20,6,7,21,22,22,21,20,
+6,35,39,34,6,21,20,22,51,50,54,54,53,17,51,17,20,22,51,50,54,54,53,52,2,39,
+54,51,50,22,18,9,131,125,210,128,133,202,36,70,254,210,217,254,230,223,1,
+7,57,81,91,107,121,158,157,217,254,253,234,254,238,51,71,17,26,43,93,63,159,
+1,39,198,214,202,114,129,121,144,145,126,73,65,72,164,139,135,223,129,194,
+152,134,86,155,95,165,142,29,46,66,168,118,2,12,170,237,119,129,111,125,135,
+131,112,180,1,53,53,59,61,109,137,152,254,216,251,135,213,135,13,107,224,
+165,197,1,48,169,138,115,74,112,25,8,10,105,79,90,103,2,37,46,67,47,108,185,
+111,2,125,253,42,136,152,93,183,128,198,1,35,98,35,172,254,225,0,2,0,85,255,
+241,10,77,4,123,0,70,0,82,0,0,1,20,6,6,35,34,39,54,18,53,52,38,38,35,34,7,
+22,18,21,20,6,6,35,34,38,53,52,18,55,38,35,34,6,6,21,17,35,17,52,38,35,34,
+6,6,21,20,18,23,6,35,34,38,2,53,52,18,54,51,50,22,23,54,54,51,50,23,54,51,
+50,4,18,37,6,2,21,20,22,51,50,54,53,52,2,10,77,112,167,81,49,32,108,131,129,
+213,123,67,61,111,124,95,185,127,171,199,143,124,64,74,113,187,107,194,147,
+122,112,160,82,130,153,25,50,65,155,108,117,220,149,143,223,50,72,244,144,
+148,123,138,151,166,1,32,176,252,66,117,139,123,104,107,131,107,2,11,164,
+245,129,16,78,1,27,159,162,228,114,16,92,254,239,152,139,228,134,242,207,
+185,1,29,92,24,131,231,143,253,247,2,214,136,162,124,203,117,176,254,246,
+115,35,150,1,11,166,160,1,6,153,144,133,132,146,59,57,141,254,231,216,75,
+254,252,176,145,177,186,178,133,1,0,0,2,0,84,255,244,12,119,4,122,0,57,0,
+66,0,0,1,17,33,39,54,18,53,52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,
+20,18,23,6,35,34,38,2,53,52,18,54,51,50,22,23,54,54,51,50,22,18,21,20,6,7,
+33,17,52,0,51,50,22,22,7,52,38,35,34,6,21,17,33,12,119,249,31,21,107,117,
+88,149,91,124,160,194,147,122,112,160,82,130,153,25,50,65,155,108,119,223,
+151,133,193,53,52,196,125,137,231,138,109,86,2,67,1,0,223,162,222,109,120,
+180,156,157,164,2,145,2,115,253,141,34,82,1,18,149,159,219,107,166,130,253,
+40,2,214,136,162,124,203,117,176,254,246,115,35,150,1,11,166,157,1,7,155,
+115,101,107,109,130,255,0,182,156,234,78,2,42,223,1,3,137,235,134,182,202,
+191,167,253,212,0,1,0,84,255,244,7,82,4,122,0,78,0,0,33,35,17,52,38,38,35,
+34,6,6,21,20,22,22,23,6,6,35,34,38,2,53,52,18,54,51,50,22,23,54,54,51,50,
+22,22,21,20,6,6,7,21,30,2,21,20,6,6,35,34,38,38,53,52,55,22,22,51,50,54,53,
+52,38,35,35,53,51,50,54,54,53,52,38,38,35,34,6,6,21,3,253,194,67,122,80,112,
+160,82,71,123,89,12,40,23,65,155,108,119,223,151,135,194,53,59,222,138,142,
+215,117,54,109,80,83,120,62,97,178,119,89,124,61,9,60,104,69,110,125,138,
+120,128,127,66,113,68,77,135,85,105,160,88,2,214,90,135,73,124,203,117,136,
+204,150,67,17,18,150,1,11,166,157,1,7,155,118,103,107,114,81,147,94,55,102,
+77,17,8,14,85,123,68,92,129,66,40,63,36,19,18,26,28,105,94,97,110,109,46,
+86,57,66,95,49,79,135,82,0,0,1,0,85,255,244,12,20,4,122,0,80,0,0,1,20,6,6,
+35,32,39,6,6,35,34,38,38,53,17,52,38,35,34,6,21,21,17,35,17,52,38,35,34,6,
+6,21,20,18,23,6,35,34,38,2,53,52,18,54,51,50,22,23,54,54,51,50,22,22,21,17,
+20,22,51,50,54,53,53,17,51,17,20,22,51,50,54,54,53,52,2,39,54,51,50,22,18,
+12,20,138,221,124,254,253,114,46,178,114,126,184,96,117,120,112,121,194,147,
+122,112,160,82,130,153,25,50,65,155,108,119,224,151,123,183,55,45,180,115,
+126,184,96,117,120,112,121,194,143,126,90,162,101,165,142,29,46,72,166,114,
+2,12,172,242,122,182,87,95,109,175,98,1,138,118,141,136,115,8,253,4,2,214,
+136,162,124,203,117,176,254,246,115,35,150,1,11,166,157,1,7,155,98,88,88,
+98,109,175,98,254,118,118,141,136,115,8,2,252,253,42,139,159,92,187,135,198,
+1,35,98,35,171,254,225,0,1,0,84,255,240,9,195,4,122,0,63,0,0,1,20,6,6,35,
+34,39,54,18,53,52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,52,
+38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,52,18,54,51,50,22,23,54,54,51,50,
+22,23,54,54,51,50,22,18,9,195,112,167,81,49,32,110,129,88,149,91,124,160,
+194,117,120,112,121,194,147,122,112,160,82,130,153,25,50,65,155,108,119,224,
+151,123,183,55,45,180,115,123,182,50,54,188,117,141,230,135,2,30,171,253,
+134,16,80,1,37,166,159,219,107,166,130,253,40,2,252,118,141,136,115,252,252,
+2,214,136,162,124,203,117,176,254,246,115,35,150,1,11,166,157,1,7,155,98,
+88,88,98,104,87,94,97,137,254,239,0,3,0,85,255,244,7,252,4,122,0,32,0,45,
+0,56,0,0,1,17,33,17,52,38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,52,18,54,
+51,50,22,23,54,36,51,50,4,22,7,52,38,35,34,7,22,22,21,20,2,7,33,33,62,2,53,
+52,38,35,34,6,21,7,252,251,64,147,122,112,160,82,130,153,25,50,65,155,108,
+119,224,152,142,200,49,72,1,13,163,155,1,4,154,195,224,181,67,57,132,165,
+243,216,2,179,252,197,95,187,120,98,78,100,126,2,130,253,126,2,214,136,162,
+124,203,117,176,254,246,115,35,150,1,11,166,157,1,7,155,132,113,119,126,121,
+229,150,170,208,12,7,169,130,146,254,197,135,72,223,244,101,98,109,174,138,
+0,0,1,0,85,255,244,9,46,4,122,0,50,0,0,1,17,33,39,54,18,53,52,38,38,35,34,
+6,21,17,35,17,52,38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,52,54,54,51,32,
+23,54,54,51,50,22,18,21,20,6,7,33,17,9,46,252,132,21,94,102,88,149,91,124,
+160,194,143,126,90,162,101,165,142,29,46,66,168,118,138,221,124,1,24,110,
+53,195,123,139,230,137,94,79,1,237,4,110,251,146,35,88,1,16,144,159,219,107,
+166,130,253,40,2,214,139,159,92,187,135,198,254,221,98,35,172,1,31,163,172,
+242,122,212,105,107,133,254,249,186,137,237,80,4,0,0,0,5,0,125,0,0,8,241,
+4,122,0,16,0,29,0,42,0,53,0,64,0,0,1,17,33,17,52,54,36,51,50,4,23,54,36,51,
+50,4,22,5,52,38,35,34,7,22,22,21,20,2,7,33,1,52,38,35,34,7,22,22,21,20,2,
+7,33,33,62,2,53,52,38,35,34,6,21,37,52,38,35,34,6,21,17,62,2,8,241,247,140,
+155,1,5,157,165,1,17,70,70,1,18,170,155,1,4,154,251,63,224,181,67,57,132,
+165,243,216,2,179,3,254,224,181,67,57,132,165,243,216,2,179,248,199,95,187,
+120,98,78,100,126,5,144,98,78,100,126,95,187,120,2,130,253,126,2,123,164,
+231,116,138,124,128,134,121,229,150,170,208,12,7,169,130,146,254,197,135,
+2,24,170,208,12,7,169,130,146,254,197,135,72,223,244,101,98,109,174,138,105,
+98,109,174,138,253,233,72,223,244,0,0,2,0,85,255,244,12,60,4,122,0,73,0,85,
+0,0,1,17,33,53,33,50,54,54,53,52,38,38,35,34,7,22,22,21,20,6,35,34,38,53,
+52,54,55,38,35,34,6,21,21,20,2,35,34,38,38,53,52,18,54,51,50,23,6,2,21,20,
+22,22,51,50,54,53,53,52,54,36,51,50,23,54,51,50,4,22,21,20,6,7,33,17,1,52,
+38,39,6,6,21,20,22,51,50,54,12,60,249,54,2,82,93,185,119,120,195,111,63,69,
+96,107,191,155,151,180,115,95,63,82,179,217,247,207,124,221,138,114,166,72,
+46,29,142,165,95,153,84,130,160,162,1,17,164,157,119,129,149,159,1,21,171,
+126,108,2,73,251,192,104,81,84,114,102,86,87,108,4,110,251,146,110,129,216,
+125,143,201,100,16,73,214,118,152,190,187,160,118,209,70,21,228,188,140,219,
+254,249,122,242,172,164,1,31,171,35,98,254,221,198,130,188,96,199,159,151,
+164,239,124,58,57,126,254,183,146,253,73,4,0,253,244,98,187,55,51,179,109,
+105,126,113,0,3,0,85,255,244,16,7,4,122,0,99,0,111,0,123,0,0,1,20,6,6,35,
+34,38,53,52,18,55,38,39,34,0,21,16,23,7,33,53,33,50,54,54,53,52,38,38,35,
+34,7,22,22,21,20,6,35,34,38,53,52,54,55,38,35,34,6,21,21,20,2,35,34,38,38,
+53,52,18,54,51,50,23,6,2,21,20,22,22,51,50,54,53,53,52,54,36,51,50,23,54,
+51,50,4,22,21,20,6,7,33,38,38,53,52,18,36,51,50,4,18,1,6,2,21,20,22,51,50,
+54,53,52,2,1,52,38,39,6,6,21,20,22,51,50,54,16,7,95,185,127,171,199,143,115,
+48,51,220,254,239,205,49,249,38,2,82,93,185,119,120,195,111,63,69,96,107,
+191,155,151,180,115,95,63,82,179,217,247,207,124,221,138,114,166,72,46,29,
+142,165,95,153,84,130,160,162,1,17,164,152,123,131,148,159,1,21,171,126,108,
+2,143,61,75,171,1,31,169,179,1,19,150,254,100,116,126,123,104,107,131,115,
+248,99,104,81,84,114,102,86,87,108,1,235,139,228,134,237,202,157,1,55,112,
+16,1,254,231,225,254,243,173,78,110,129,216,125,143,201,100,16,73,214,118,
+152,190,187,160,118,209,70,21,228,188,140,219,254,249,122,242,172,164,1,31,
+171,35,98,254,221,198,130,188,96,199,159,151,164,239,124,58,57,126,254,183,
+146,253,73,77,215,123,190,1,25,150,168,254,214,1,20,108,254,225,154,136,166,
+186,178,146,1,9,254,242,98,187,55,51,179,109,105,126,113,0,2,0,85,255,244,
+14,45,4,123,0,73,0,82,0,0,1,17,33,34,38,53,17,52,38,35,34,6,21,17,35,17,52,
+38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,52,0,51,50,22,23,54,54,51,50,22,
+21,17,20,22,51,50,54,53,52,2,39,54,51,50,22,18,21,20,6,7,54,54,51,33,17,52,
+0,51,50,22,22,7,52,38,35,34,6,21,17,33,14,45,249,8,186,215,116,117,103,135,
+194,128,107,85,156,98,176,148,29,46,71,175,123,1,11,210,114,182,57,47,178,
+103,174,222,127,110,130,143,177,150,29,46,71,177,124,90,81,45,170,49,1,39,
+1,0,223,162,222,109,120,180,156,157,164,2,145,2,115,253,141,214,186,1,88,
+128,151,144,115,253,4,2,244,124,144,93,187,134,194,254,213,94,35,174,1,31,
+161,236,1,45,93,80,82,90,217,175,254,156,127,149,212,190,194,1,43,94,35,174,
+254,225,161,154,216,57,5,8,2,42,223,1,3,137,235,134,182,202,191,167,253,212,
+0,0,1,0,70,255,240,11,88,4,122,0,78,0,0,1,20,6,6,35,34,39,54,18,53,52,38,
+38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,20,18,23,7,33,39,62,2,53,52,38,
+35,34,6,21,20,22,23,6,6,35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,38,
+38,53,52,18,54,51,32,23,54,54,51,50,22,18,11,88,112,167,81,49,32,110,129,
+88,149,91,124,160,194,143,126,90,162,101,123,118,19,252,71,21,40,65,56,136,
+105,110,141,101,76,12,28,25,53,109,71,222,175,109,184,109,59,58,2,43,75,78,
+138,221,124,1,24,110,53,195,123,141,230,135,2,30,171,253,134,16,80,1,37,166,
+159,219,107,166,130,253,40,2,214,139,159,99,201,145,146,254,216,101,36,35,
+38,77,130,82,110,141,152,119,107,157,50,21,19,92,163,100,175,219,89,166,109,
+72,140,51,99,251,120,181,1,0,129,212,105,107,137,254,239,0,0,3,0,70,255,244,
+8,248,4,122,0,42,0,55,0,66,0,0,1,17,33,39,62,2,53,52,38,35,34,6,21,20,22,
+23,6,6,35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,17,52,54,36,51,50,4,
+22,7,52,38,35,34,7,22,22,21,20,2,7,33,33,62,2,53,52,38,35,34,6,21,8,248,249,
+39,21,40,65,56,136,105,110,141,101,76,12,28,25,53,109,71,222,175,109,184,
+109,59,58,1,146,155,1,5,157,155,1,4,154,195,224,181,67,57,132,165,243,216,
+2,179,252,197,95,187,120,98,78,100,126,2,130,253,126,35,38,77,130,82,110,
+141,152,119,107,157,50,21,19,92,163,100,175,219,89,166,109,72,140,51,2,13,
+164,231,116,121,229,150,170,208,12,7,169,130,146,254,197,135,72,223,244,101,
+98,109,174,138,0,0,3,0,100,254,100,10,136,4,122,0,124,0,135,0,146,0,0,5,21,
+33,34,38,53,52,54,51,33,50,54,53,52,38,35,53,50,54,53,52,38,35,34,4,7,54,
+54,51,50,22,21,20,6,35,34,38,38,53,52,54,36,51,50,4,22,21,20,7,21,22,22,21,
+20,6,6,35,33,34,6,21,20,22,51,33,38,53,52,54,51,33,50,54,53,52,38,35,53,50,
+54,53,52,38,35,34,4,7,54,54,51,50,22,21,20,6,35,34,38,38,53,52,54,36,51,50,
+4,22,21,20,7,21,22,22,21,20,6,6,35,33,34,6,21,20,22,51,1,22,22,51,50,54,53,
+52,38,35,34,5,22,22,51,50,54,53,52,38,35,34,10,136,247,75,181,186,166,133,
+2,27,81,103,132,104,97,110,227,171,196,254,250,29,40,131,82,134,170,176,140,
+108,158,83,148,1,20,184,159,1,6,153,180,96,115,79,158,112,253,207,86,89,94,
+92,4,89,42,166,131,2,27,81,103,132,104,97,110,227,171,196,254,250,29,40,131,
+82,134,170,176,140,108,158,83,148,1,20,184,159,1,6,153,180,96,115,79,158,
+112,253,207,86,89,94,92,249,196,21,120,76,80,89,91,73,144,5,25,21,120,76,
+80,89,91,73,144,244,168,145,124,114,139,99,76,88,114,97,92,92,113,143,165,
+140,63,78,166,131,133,168,106,174,102,142,229,131,87,169,117,183,48,9,16,
+133,94,74,133,83,68,56,52,68,51,72,101,130,99,76,88,114,97,92,92,113,143,
+165,140,63,78,166,131,133,168,106,174,102,142,229,131,87,169,117,183,48,9,
+16,133,94,74,133,83,68,56,52,68,3,52,92,104,104,80,81,103,172,92,104,104,
+80,81,103,0,0,2,0,40,253,186,6,229,4,110,0,37,0,42,0,0,1,17,33,39,36,1,33,
+53,33,50,54,54,53,52,38,35,34,6,21,20,23,6,35,34,38,53,52,54,54,51,50,22,
+21,20,6,7,33,17,17,35,0,5,33,6,229,251,208,50,1,154,1,32,250,235,2,111,60,
+115,74,126,100,97,120,21,11,22,53,53,87,162,108,182,220,67,49,2,65,72,254,
+220,254,171,2,193,4,110,249,76,110,203,1,13,110,67,122,77,103,133,120,98,
+55,63,5,84,70,81,144,88,202,167,80,136,43,4,0,251,146,254,226,186,0,3,0,85,
+253,186,10,112,4,122,0,60,0,72,0,77,0,0,1,17,33,39,36,1,33,39,54,18,53,52,
+38,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,35,
+34,38,38,53,52,18,36,51,50,4,23,54,54,51,50,22,18,21,20,6,7,33,17,1,22,22,
+51,50,54,53,52,38,35,34,6,1,17,35,0,5,10,112,251,208,50,1,154,1,32,254,13,
+21,94,102,88,149,91,124,160,196,223,196,129,228,141,3,54,167,107,147,192,
+195,158,138,195,98,180,1,35,165,151,1,20,87,51,204,130,139,230,137,94,79,
+2,12,247,49,38,134,85,95,103,109,86,81,137,8,166,72,254,220,254,171,4,110,
+249,76,110,203,1,13,35,88,1,16,144,159,219,107,166,130,253,40,2,95,194,223,
+117,232,163,50,88,109,189,145,151,186,149,241,137,201,1,30,144,115,128,119,
+124,133,254,249,186,137,237,80,4,0,252,230,109,124,119,95,95,115,111,252,
+132,1,216,254,226,186,0,4,0,85,253,186,7,169,4,122,0,45,0,62,0,75,0,81,0,
+0,37,17,33,39,36,1,35,34,39,6,35,34,36,2,53,52,18,51,50,22,23,54,51,50,22,
+22,21,20,2,7,22,51,50,54,54,53,52,2,39,54,51,50,22,22,21,16,5,38,2,53,52,
+55,38,38,35,34,6,21,20,22,22,51,50,3,20,22,23,54,18,53,52,38,35,34,6,6,1,
+17,6,7,0,5,6,253,251,178,50,1,137,1,36,18,146,140,137,148,193,254,217,160,
+240,197,70,132,43,111,145,111,191,119,158,136,56,62,129,224,138,129,109,32,
+42,88,170,108,251,193,122,142,81,33,96,45,145,169,126,228,148,91,66,144,121,
+127,132,147,114,68,120,75,3,97,39,46,254,215,254,159,180,253,6,110,193,1,
+11,60,60,178,1,45,177,222,1,17,44,40,91,102,215,159,156,254,221,98,13,120,
+238,168,152,1,4,79,17,133,236,147,254,238,223,93,1,22,175,171,120,29,26,205,
+174,144,246,146,2,60,175,254,69,75,1,15,151,152,191,79,155,251,18,2,7,17,
+13,254,215,192,0,2,0,85,253,186,6,194,4,122,0,40,0,45,0,0,1,17,33,39,36,1,
+33,39,54,18,53,52,38,38,35,34,6,6,21,20,18,23,6,35,34,38,38,53,52,18,54,51,
+50,22,18,21,20,6,7,33,17,19,35,0,5,33,6,194,251,208,50,1,154,1,32,253,196,
+21,137,143,92,175,120,105,183,113,150,127,17,58,67,151,104,154,252,143,169,
+249,132,120,118,2,77,1,72,254,220,254,171,2,193,4,110,249,76,110,203,1,13,
+35,85,1,27,154,125,213,129,110,223,160,169,254,255,82,35,146,251,150,195,
+1,20,140,157,254,255,146,137,251,88,4,0,251,146,254,226,186,0,5,0,80,253,
+61,7,147,4,122,0,64,0,71,0,83,0,90,0,101,0,0,1,20,6,35,34,38,38,53,52,55,
+30,2,51,50,54,53,52,38,39,38,38,53,52,55,6,35,34,39,6,35,34,38,53,52,54,51,
+51,54,18,51,50,18,23,51,50,22,21,20,6,7,22,21,20,7,38,38,35,34,6,21,20,22,
+23,4,1,33,38,38,35,34,6,3,38,39,35,34,6,21,20,22,51,50,54,1,33,22,22,51,50,
+54,19,54,51,51,50,54,53,52,38,39,2,7,77,198,170,81,209,148,13,63,95,169,98,
+101,136,109,144,202,207,55,55,51,212,118,97,189,148,181,231,199,77,17,231,
+190,201,235,15,15,207,241,109,90,101,14,60,208,127,130,104,147,160,1,108,
+251,117,2,63,7,118,146,128,162,87,43,5,52,120,142,90,65,60,110,2,174,253,
+189,7,165,135,154,115,13,63,78,4,142,166,139,128,8,254,40,110,125,44,74,44,
+21,14,29,37,37,57,58,52,62,8,10,109,115,87,53,10,168,166,165,139,158,182,
+241,1,15,254,248,248,182,157,99,132,25,35,49,20,16,26,44,59,44,58,51,8,18,
+3,115,180,210,208,253,227,114,151,116,122,105,98,83,1,102,202,228,233,254,
+240,12,111,113,116,115,2,254,182,0,0,2,0,85,253,41,6,228,4,127,0,60,0,88,
+0,0,1,20,6,6,35,34,39,54,54,53,52,38,35,34,6,21,21,20,6,35,34,38,38,53,52,
+54,55,35,34,38,38,53,52,18,54,51,50,23,6,2,21,20,22,22,51,50,54,53,53,52,
+18,51,50,22,22,21,20,2,7,22,22,1,50,23,54,54,53,52,38,38,35,34,6,21,21,20,
+6,7,6,21,20,22,51,50,54,53,53,52,54,6,164,82,121,51,50,19,92,114,114,90,87,
+109,191,162,91,161,101,52,42,3,124,221,138,129,184,73,43,20,176,151,95,151,
+84,130,160,247,207,124,221,138,125,105,76,90,254,169,29,33,101,122,95,151,
+84,130,160,159,144,125,123,91,92,104,191,254,233,115,208,125,29,73,200,149,
+117,147,125,100,148,156,186,87,173,123,90,169,66,123,244,173,161,1,35,178,
+34,135,254,220,173,130,188,96,199,159,203,219,1,7,123,244,173,153,254,214,
+99,46,170,1,8,5,97,248,166,130,188,96,199,159,203,172,245,44,146,203,115,
+149,123,102,148,156,186,0,0,2,0,40,253,112,6,229,4,110,0,86,0,97,0,0,33,35,
+22,22,21,20,6,35,34,38,53,52,55,38,35,34,6,21,20,23,7,33,53,33,50,54,53,52,
+38,35,34,6,21,20,23,6,35,34,38,53,52,54,51,50,22,21,20,7,33,38,53,52,54,55,
+33,53,33,50,54,54,53,52,38,35,34,6,21,20,23,6,35,34,38,53,52,54,54,51,50,
+22,21,20,6,7,33,17,51,1,6,21,20,22,51,50,54,53,52,38,6,229,146,69,76,158,
+124,126,138,146,30,33,112,139,133,32,252,32,1,70,62,85,67,47,51,67,15,14,
+17,31,41,144,108,115,138,76,1,29,75,73,64,251,232,2,111,60,115,74,126,100,
+97,120,21,11,22,53,53,87,162,108,182,220,67,49,2,65,194,254,202,127,67,51,
+58,67,60,56,169,102,145,184,161,135,195,144,9,167,133,178,109,50,90,94,66,
+54,68,65,51,41,35,7,55,48,86,118,127,103,93,67,108,143,98,157,53,110,67,122,
+77,103,133,120,98,55,63,5,84,70,81,144,88,202,167,80,136,43,4,0,251,76,122,
+173,82,104,105,96,81,150,0,3,0,85,253,95,9,124,4,122,0,90,0,105,0,117,0,0,
+37,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,53,53,52,38,35,34,6,21,20,23,
+6,35,34,38,38,53,52,54,54,51,23,38,53,17,52,38,35,34,6,6,21,20,18,23,6,35,
+34,38,2,53,52,54,54,51,50,18,21,17,20,22,51,50,54,53,17,51,17,20,22,51,50,
+54,54,53,52,2,39,54,51,50,22,18,21,20,2,1,17,6,6,35,34,39,22,21,21,20,22,
+51,50,54,1,35,34,39,17,20,22,51,50,54,53,52,8,15,44,55,93,150,84,99,137,34,
+31,138,87,127,163,90,74,84,109,200,21,42,49,112,77,93,150,84,36,97,160,130,
+84,153,95,165,142,29,46,72,166,114,138,221,124,207,247,121,122,98,129,194,
+143,126,90,162,101,165,142,29,46,72,166,114,195,253,34,53,146,81,44,46,71,
+77,72,67,83,1,198,8,146,119,101,85,87,108,2,61,168,93,113,160,80,81,75,75,
+81,157,123,182,89,110,140,110,242,139,30,113,190,108,116,165,82,2,97,144,
+1,70,159,199,96,188,130,198,254,221,98,35,171,1,31,164,172,242,122,254,250,
+220,254,218,118,141,145,114,2,252,253,42,139,159,92,187,135,198,1,35,98,35,
+171,254,225,164,198,254,232,254,58,1,251,54,57,8,87,134,185,72,88,86,1,216,
+75,254,90,99,112,137,113,182,0,4,0,85,253,95,9,124,4,122,0,90,0,105,0,124,
+0,136,0,0,5,20,6,6,35,34,38,39,6,6,35,34,38,53,53,52,38,35,34,6,21,20,23,
+6,35,34,38,38,53,52,54,54,51,23,38,53,17,52,38,35,34,6,6,21,20,18,23,6,35,
+34,38,2,53,52,54,54,51,50,18,21,17,20,22,51,50,54,53,17,51,17,20,22,51,50,
+54,54,53,52,2,39,54,51,50,22,18,21,20,6,7,22,22,1,17,6,6,35,34,39,22,21,21,
+20,22,51,50,54,1,6,6,35,34,38,53,52,55,38,39,17,20,22,51,50,54,54,53,3,34,
+6,21,20,22,51,50,54,55,38,38,9,80,121,195,108,117,204,60,21,149,99,127,163,
+90,74,84,109,200,21,42,49,112,77,93,150,84,35,97,160,130,84,153,95,165,142,
+29,46,72,166,114,138,221,124,207,247,121,122,98,129,194,143,126,90,162,101,
+165,142,29,46,72,166,114,117,99,83,89,252,140,53,147,81,43,46,71,77,72,67,
+83,3,18,36,111,71,100,127,30,103,87,159,136,75,144,93,181,57,62,67,51,49,
+82,26,24,81,252,127,191,102,93,103,94,103,157,123,182,89,110,140,110,242,
+139,30,113,190,108,116,165,82,1,95,145,1,70,159,199,96,188,130,198,254,221,
+98,35,171,1,31,164,172,242,122,254,250,220,254,218,118,141,145,114,2,252,
+253,42,139,159,92,187,135,198,1,35,98,35,171,254,225,164,157,230,68,42,175,
+254,252,1,252,55,57,8,87,134,185,72,88,86,1,12,59,72,126,96,67,51,15,54,254,
+180,138,162,74,145,102,1,2,72,57,59,68,67,49,66,74,0,5,0,85,253,65,10,230,
+4,122,0,97,0,115,0,130,0,142,0,154,0,0,5,22,21,20,6,6,35,34,39,54,53,52,38,
+35,34,6,21,17,35,17,52,38,35,34,6,21,21,17,35,17,52,38,35,34,6,21,23,54,54,
+51,50,22,21,20,6,35,34,38,38,53,52,54,55,17,52,38,35,34,6,6,21,23,54,54,51,
+50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,54,51,50,22,23,54,54,
+51,50,22,18,21,20,6,6,19,52,38,38,35,34,6,21,17,22,23,54,54,51,50,23,54,18,
+1,51,17,52,38,35,34,6,21,21,17,22,23,54,54,37,22,22,51,50,54,53,52,38,35,
+34,6,1,22,22,51,50,54,53,52,38,35,34,6,9,198,112,77,115,55,47,30,163,111,
+91,76,98,162,77,78,68,76,164,145,124,145,183,1,31,106,67,102,130,128,105,
+99,137,67,198,162,225,194,129,228,141,3,54,167,107,147,192,195,158,138,195,
+98,180,1,35,165,146,1,10,84,39,189,125,122,181,51,55,188,117,141,230,135,
+83,132,13,88,149,91,124,160,36,19,36,124,76,79,69,83,90,252,217,1,117,120,
+112,121,148,79,29,130,250,60,38,134,85,95,103,109,86,81,137,2,91,23,83,52,
+57,64,68,51,50,84,3,112,206,117,174,91,17,129,234,140,171,114,88,254,34,1,
+246,81,96,88,66,3,253,246,1,139,131,154,186,144,24,55,70,128,101,104,126,
+102,164,94,165,233,26,2,1,199,228,117,232,163,50,88,109,189,145,151,186,149,
+241,137,201,1,30,144,102,114,102,114,103,86,93,96,137,254,239,194,146,229,
+144,2,4,159,219,107,166,130,253,68,32,37,65,67,32,89,1,0,254,199,2,161,118,
+141,136,115,8,253,84,30,104,67,78,249,109,124,119,95,95,115,111,252,142,67,
+76,73,58,60,69,68,0,0,2,0,84,253,67,8,30,6,113,0,91,0,102,0,0,1,20,6,6,35,
+34,39,54,54,53,52,38,35,34,6,21,20,22,23,6,35,34,38,38,53,52,54,55,38,38,
+53,16,1,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,
+52,18,54,51,50,22,23,54,54,51,50,23,54,53,52,38,35,34,7,54,54,51,50,22,21,
+20,7,22,18,21,20,6,7,22,22,1,20,22,51,50,54,53,52,38,39,6,8,30,81,130,68,
+47,27,81,93,164,123,125,161,106,90,18,49,48,109,75,108,92,81,86,1,6,84,95,
+131,187,194,147,122,112,160,82,130,153,25,50,65,155,108,119,224,151,134,193,
+53,62,232,146,116,107,70,111,107,54,57,12,124,83,119,139,109,140,163,95,89,
+107,122,253,69,123,104,112,126,118,104,243,254,183,106,170,96,19,55,197,107,
+136,175,169,137,116,176,57,30,101,175,104,126,186,52,54,199,129,1,27,1,23,
+35,176,122,253,40,2,214,136,162,124,203,117,176,254,246,115,35,150,1,11,166,
+157,1,7,155,117,102,106,113,42,92,94,98,113,22,70,100,158,134,161,149,92,
+254,201,183,130,214,61,53,202,2,94,136,166,182,158,152,255,79,245,0,0,1,0,
+70,253,39,6,217,4,110,0,65,0,0,1,17,33,39,54,54,53,52,38,35,34,6,21,20,23,
+6,6,35,34,38,38,53,52,54,51,50,22,21,20,7,33,17,33,39,62,2,53,52,38,35,34,
+6,21,20,22,23,6,6,35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,17,6,217,
+252,17,16,60,50,95,75,77,100,122,9,21,19,41,86,56,169,137,137,173,61,2,109,
+252,8,21,40,65,56,136,105,110,141,101,76,12,28,25,53,109,71,222,175,109,184,
+109,59,58,3,39,4,110,248,194,26,60,110,64,77,100,102,80,147,87,16,14,69,121,
+75,131,163,152,123,98,68,2,99,35,38,77,130,82,110,141,152,119,107,157,50,
+21,19,92,163,100,175,219,89,166,109,72,140,51,4,0,0,0,2,0,85,253,69,10,112,
+4,122,0,105,0,117,0,0,33,22,21,20,6,7,21,22,22,21,20,6,35,34,38,53,52,55,
+22,22,51,50,54,53,52,35,35,53,51,50,53,52,38,35,34,6,6,21,20,22,23,6,35,34,
+38,53,52,54,55,35,39,54,18,53,52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,
+6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,54,51,
+50,22,18,21,20,6,7,33,17,51,17,1,22,22,51,50,54,53,52,38,35,34,6,9,201,55,
+93,121,106,123,160,137,87,119,7,42,69,47,71,78,165,87,96,147,90,83,116,151,
+69,40,43,20,21,64,85,84,82,178,21,94,102,88,149,91,124,160,196,223,196,129,
+228,141,3,54,167,107,147,192,195,158,138,195,98,180,1,35,165,151,1,20,87,
+51,204,130,139,230,137,94,79,2,12,195,246,110,38,134,85,95,103,109,86,81,
+137,55,66,62,99,15,6,7,100,79,99,105,54,49,18,18,18,19,62,57,122,102,110,
+57,69,102,160,88,103,142,82,10,193,144,106,192,64,35,88,1,16,144,159,219,
+107,166,130,253,40,2,95,194,223,117,232,163,50,88,109,189,145,151,186,149,
+241,137,201,1,30,144,115,128,119,124,133,254,249,186,137,237,80,4,0,251,146,
+1,84,109,124,119,95,95,115,111,0,0,4,0,85,253,65,10,183,4,122,0,74,0,86,0,
+97,0,107,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,54,55,54,55,54,53,
+52,38,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,23,54,54,51,50,22,21,20,6,
+35,34,38,38,53,52,18,36,51,50,4,23,54,54,51,50,22,18,21,20,6,7,33,17,51,17,
+22,1,22,22,51,50,54,53,52,38,35,34,6,1,17,35,6,6,21,20,22,51,50,54,37,52,
+39,35,17,20,22,51,50,54,10,183,84,138,81,94,139,37,34,134,84,162,192,47,68,
+58,82,26,79,88,149,91,124,160,196,223,196,129,228,141,3,54,167,107,147,192,
+195,158,138,195,98,180,1,35,165,151,1,20,87,51,204,130,139,230,137,94,79,
+2,12,195,71,246,39,38,134,85,95,103,109,86,81,137,7,41,250,53,59,109,90,70,
+93,2,24,116,233,93,70,85,101,254,161,113,159,80,74,67,67,74,192,161,74,132,
+106,77,109,51,150,190,159,219,107,166,130,253,40,2,95,194,223,117,232,163,
+50,88,109,189,145,151,186,149,241,137,201,1,30,144,115,128,119,124,133,254,
+249,186,137,237,80,4,0,251,91,129,2,12,109,124,119,95,95,115,111,252,176,
+1,172,64,175,85,132,136,95,146,227,124,254,85,77,88,132,0,0,2,0,125,253,39,
+5,255,4,122,0,45,0,53,0,0,1,17,33,39,54,54,53,52,38,35,34,6,21,20,23,6,6,
+35,34,38,38,53,52,54,51,50,22,21,20,7,33,17,33,17,52,54,54,51,50,22,21,21,
+33,17,33,17,1,21,33,53,16,33,34,6,5,255,252,107,16,60,50,95,75,77,100,122,
+9,21,19,41,86,56,169,137,137,173,61,2,19,251,64,116,197,121,213,227,253,89,
+3,253,252,3,2,47,254,239,133,153,4,110,248,194,26,60,110,64,77,100,102,80,
+147,87,16,14,69,121,75,131,163,152,123,98,68,2,99,2,183,147,203,101,232,235,
+227,254,170,4,0,254,75,135,130,1,76,157,0,4,0,85,253,41,7,239,4,124,0,59,
+0,88,0,100,0,112,0,0,1,20,6,35,34,38,53,52,54,55,38,35,34,6,21,21,20,6,35,
+34,38,38,53,52,54,55,6,35,34,38,38,53,52,18,54,51,50,23,6,2,21,20,22,22,51,
+50,54,53,53,52,0,51,32,0,17,20,2,7,22,22,1,38,38,53,52,18,55,38,35,34,6,21,
+21,20,7,7,14,2,21,20,22,51,50,54,53,53,52,54,1,6,2,21,20,22,51,50,54,53,52,
+2,19,52,38,39,6,6,21,20,22,51,50,54,7,172,171,141,131,140,89,74,33,36,123,
+141,192,157,84,151,96,67,52,39,43,124,221,138,114,166,72,46,29,142,165,95,
+153,84,130,160,1,44,248,1,40,1,104,146,126,98,107,253,184,61,65,140,113,69,
+73,159,184,132,43,65,83,60,121,93,93,88,187,1,136,114,122,123,104,107,131,
+117,60,78,69,72,77,81,66,66,83,254,139,157,193,167,140,107,211,77,9,145,126,
+104,154,186,84,171,125,98,177,66,6,122,242,172,164,1,31,171,35,98,254,221,
+198,130,188,96,199,159,171,231,1,22,254,151,254,216,176,254,255,45,60,199,
+1,70,58,180,111,155,1,52,112,22,203,175,178,228,132,43,63,102,152,99,114,
+148,120,102,100,146,199,3,127,108,254,228,152,136,166,186,178,145,1,5,251,
+16,97,174,51,75,189,100,87,105,116,0,0,3,0,70,253,61,8,103,4,122,0,90,0,100,
+0,106,0,0,33,35,22,21,20,7,38,38,35,34,6,21,20,22,23,4,21,20,6,35,34,38,38,
+53,52,55,30,2,51,50,54,53,52,38,39,38,38,53,52,55,33,39,62,2,53,52,38,35,
+34,6,21,20,22,23,6,6,35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,17,38,
+38,53,52,54,51,50,22,22,21,21,62,2,55,23,1,17,52,38,35,34,6,21,20,22,1,33,
+17,6,6,7,8,103,128,68,14,83,187,125,130,104,147,160,1,108,198,170,89,207,
+142,13,7,119,196,103,101,136,109,144,202,207,74,252,167,21,40,65,56,136,105,
+110,141,101,76,12,28,25,53,109,71,222,175,109,184,109,59,58,2,75,185,212,
+163,131,77,136,85,122,232,176,35,52,252,212,68,68,72,84,160,1,71,1,166,85,
+218,119,38,42,20,16,49,67,66,48,58,51,8,18,223,110,125,48,80,44,21,14,3,63,
+47,57,58,52,62,8,10,109,115,87,55,35,38,77,130,82,110,141,152,119,107,157,
+50,21,19,92,163,100,175,219,89,166,109,72,140,51,1,104,24,205,153,132,162,
+73,144,102,247,22,141,235,156,11,253,223,1,11,81,98,93,75,114,144,254,24,
+2,58,84,108,17,0,0,3,0,85,253,78,9,124,4,122,0,86,0,105,0,119,0,0,1,20,6,
+6,35,34,38,53,53,52,38,35,34,6,21,17,35,17,52,38,35,34,6,21,20,23,6,35,34,
+38,38,53,52,55,35,17,52,38,35,34,6,6,21,20,18,23,6,35,34,38,2,53,52,54,54,
+51,50,22,23,54,54,51,50,22,21,17,20,22,51,50,54,54,53,52,2,39,54,51,50,22,
+18,21,20,6,7,22,22,1,38,38,53,17,52,38,35,34,6,21,17,54,51,50,22,23,54,54,
+1,52,39,6,35,39,22,21,21,20,22,51,50,54,9,111,93,150,84,143,169,77,72,67,
+83,181,101,85,87,108,202,25,40,49,112,77,107,94,143,126,90,162,101,165,142,
+29,46,72,166,114,138,221,124,121,205,60,48,183,109,171,221,160,130,84,153,
+95,165,142,29,46,72,166,114,109,93,84,105,253,5,78,83,121,122,98,129,56,64,
+99,137,34,29,129,2,233,169,95,105,55,67,90,74,84,109,254,185,116,165,82,177,
+149,185,72,88,86,76,254,13,1,194,99,112,137,113,252,140,29,116,194,111,171,
+98,2,214,139,159,92,187,135,198,254,221,98,35,171,1,31,164,172,242,122,103,
+92,95,100,197,155,254,186,159,199,96,188,130,198,1,35,98,35,171,254,225,164,
+152,225,68,62,225,1,36,64,199,123,1,38,118,141,145,114,253,66,22,81,75,72,
+80,254,105,222,136,43,3,78,109,182,89,110,140,0,0,1,0,85,253,67,9,124,4,122,
+0,120,0,0,1,20,6,6,35,34,39,54,54,53,52,38,35,34,6,21,20,22,23,6,35,34,38,
+38,53,52,54,55,38,38,53,17,52,38,35,34,6,21,17,22,22,21,20,6,6,35,34,39,54,
+54,53,52,38,35,34,6,21,20,22,23,6,35,34,38,38,53,52,54,55,17,52,38,35,34,
+6,6,21,20,18,23,6,35,34,38,2,53,52,54,54,51,50,22,23,54,54,51,50,22,21,17,
+20,22,51,50,54,54,53,52,2,39,54,51,50,22,18,21,20,6,7,22,22,9,76,81,130,68,
+47,27,81,93,164,123,125,161,106,90,18,49,48,109,75,102,88,107,117,121,122,
+98,129,156,186,81,130,68,47,27,81,93,164,123,125,161,106,90,18,49,48,109,
+75,173,146,143,126,90,162,101,165,142,29,46,72,166,114,138,221,124,121,205,
+60,48,183,109,171,221,160,130,84,153,95,165,142,29,46,72,166,114,140,116,
+98,110,254,183,106,170,96,19,55,197,107,136,175,169,137,116,176,57,30,101,
+175,104,122,184,53,57,225,146,1,38,118,141,145,114,253,97,30,231,161,106,
+170,96,19,55,197,107,136,175,169,137,116,176,57,30,101,175,104,157,221,31,
+2,122,139,159,92,187,135,198,254,221,98,35,171,1,31,164,172,242,122,103,92,
+95,100,197,155,254,186,159,199,96,188,130,198,1,35,98,35,171,254,225,164,
+173,244,62,55,196,0,2,0,85,253,67,4,228,4,122,0,43,0,61,0,0,1,20,6,6,35,34,
+39,54,54,53,52,38,35,34,6,21,20,22,23,6,35,34,38,38,53,52,55,38,2,53,52,18,
+36,51,50,4,18,21,20,6,6,7,22,22,1,50,23,54,54,53,52,38,38,35,34,6,6,21,20,
+22,23,54,4,93,81,130,68,47,27,81,93,164,123,125,161,106,90,18,49,48,109,75,
+106,131,152,158,1,6,153,173,1,15,150,80,128,73,70,76,254,72,106,90,84,93,
+112,190,114,111,197,121,133,116,100,254,183,106,170,96,19,55,197,107,136,
+175,169,137,116,176,57,30,101,175,104,176,114,91,1,35,184,188,1,19,144,160,
+254,227,179,136,216,139,29,58,171,1,73,39,88,249,130,146,225,124,111,221,
+155,162,249,84,59,0,0,6,0,80,253,132,7,147,4,122,0,50,0,57,0,69,0,76,0,102,
+0,113,0,0,37,22,22,21,20,6,35,34,38,39,2,35,34,6,21,54,51,50,22,21,20,6,35,
+34,38,53,52,54,55,38,39,6,35,34,38,53,52,54,51,51,54,18,51,50,18,23,51,50,
+22,21,20,1,33,38,38,35,34,6,3,38,39,35,34,6,21,20,22,51,50,54,5,50,54,55,
+33,22,22,5,6,35,34,38,53,23,50,54,53,52,38,39,6,2,7,22,23,22,22,51,50,54,
+53,52,38,1,22,22,51,50,54,53,52,38,35,34,7,32,50,64,164,145,119,185,47,88,
+234,122,162,77,136,112,132,152,115,127,163,118,101,55,41,97,189,148,181,231,
+199,77,17,231,190,201,235,15,15,207,241,251,47,2,63,7,118,146,128,162,87,
+43,5,52,120,142,90,65,60,110,1,158,154,115,3,253,189,7,165,3,85,37,40,66,
+84,43,92,109,139,128,5,116,115,149,67,33,94,79,77,90,56,251,192,16,88,56,
+67,73,72,63,102,43,58,176,92,163,184,139,165,1,58,147,107,115,136,115,101,
+133,202,154,111,178,49,39,59,166,165,139,158,182,241,1,15,254,248,248,182,
+157,167,1,250,180,210,208,253,227,114,151,116,122,105,98,83,72,233,197,202,
+228,112,9,63,55,3,107,96,116,115,2,176,254,250,63,98,235,111,108,124,109,
+73,145,254,190,69,83,83,60,59,83,0,3,0,85,253,132,6,228,4,127,0,56,0,82,0,
+93,0,0,1,20,6,35,32,3,38,38,35,34,6,21,54,51,50,22,21,20,6,35,34,38,53,52,
+55,38,2,53,52,18,54,51,50,23,6,2,21,20,22,22,51,50,54,53,53,52,18,51,50,22,
+22,21,20,2,7,22,22,7,52,38,39,54,54,53,52,38,38,35,34,6,21,21,20,6,7,22,22,
+23,22,22,51,50,54,37,22,22,51,50,54,53,52,38,35,34,6,202,174,149,254,254,
+113,55,152,125,118,156,77,136,112,132,152,115,127,163,114,172,195,129,184,
+73,43,20,176,151,95,151,84,130,160,247,207,124,221,138,106,82,71,91,106,120,
+93,101,122,95,151,84,130,160,74,70,126,163,55,51,115,62,83,99,251,101,16,
+88,56,67,73,72,63,102,254,239,165,192,1,48,151,163,146,108,115,136,115,101,
+133,202,154,169,106,44,1,26,200,161,1,35,178,34,135,254,220,173,130,188,96,
+199,159,203,219,1,7,123,244,173,145,254,248,94,58,209,108,108,207,55,98,248,
+166,130,188,96,199,159,203,116,190,65,32,199,155,127,92,121,8,69,83,83,60,
+59,83,0,0,4,0,85,253,132,7,90,4,122,0,64,0,94,0,106,0,117,0,0,1,20,6,35,34,
+38,39,38,38,35,34,6,21,54,51,50,22,21,20,6,35,34,38,53,52,54,55,38,38,53,
+52,18,55,38,35,34,6,6,21,20,22,23,6,35,34,38,38,53,52,18,36,51,50,23,54,51,
+50,4,18,21,20,6,7,22,22,7,52,38,39,6,35,34,39,54,18,53,52,38,38,35,34,7,22,
+18,21,20,6,7,22,19,22,22,51,50,54,1,20,22,51,50,54,53,52,2,39,6,2,19,22,22,
+51,50,54,53,52,38,35,34,7,90,154,145,113,181,47,43,150,119,118,156,77,136,
+112,132,152,115,127,163,94,82,92,99,143,124,64,74,130,212,123,153,129,25,
+50,68,154,105,164,1,20,163,148,123,138,151,166,1,32,176,85,69,68,90,107,69,
+57,67,64,49,32,108,131,129,213,123,67,61,111,124,86,81,187,84,32,92,72,70,
+87,251,169,123,104,107,131,107,102,117,139,7,16,88,56,67,73,72,63,102,254,
+229,163,184,139,165,149,165,148,106,115,136,115,101,133,202,154,98,163,53,
+51,212,142,185,1,29,92,24,131,231,143,165,251,81,35,143,247,147,186,1,26,
+153,59,57,141,254,231,200,141,222,73,53,207,106,82,161,62,41,16,78,1,27,159,
+162,228,114,16,92,254,239,152,132,220,67,83,254,229,109,110,115,3,57,145,
+177,186,178,133,1,0,80,75,254,252,252,37,69,83,83,60,59,83,0,0,3,0,70,253,
+132,6,220,4,110,0,61,0,73,0,84,0,0,1,20,6,35,34,38,39,2,35,34,6,21,54,51,
+50,22,21,20,6,35,34,38,53,52,55,55,54,54,53,52,38,35,34,6,21,20,22,23,6,6,
+35,34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,17,51,17,35,22,22,7,52,38,39,
+33,22,23,22,22,51,50,54,37,22,22,51,50,54,53,52,38,35,34,6,220,164,145,119,
+185,47,88,234,122,162,77,136,112,132,148,112,129,168,65,57,107,64,136,105,
+110,141,101,76,12,28,25,53,109,71,222,175,109,184,109,59,58,3,39,194,79,37,
+45,107,57,48,254,78,110,56,33,94,79,77,90,251,136,16,88,56,67,73,72,63,102,
+254,229,163,184,139,165,1,58,147,107,115,136,115,101,133,201,155,115,94,74,
+128,148,83,110,141,152,119,107,157,50,21,19,92,163,100,175,219,89,166,109,
+72,140,51,4,0,251,146,59,148,73,74,146,60,100,194,111,108,124,5,69,83,83,
+60,59,83,0,4,0,70,253,132,8,110,4,122,0,70,0,79,0,91,0,102,0,0,1,20,6,35,
+34,38,39,38,38,35,34,6,21,54,51,50,22,21,20,6,35,34,38,53,52,55,33,39,62,
+2,53,52,38,35,34,6,21,20,22,23,6,6,35,34,38,38,53,52,54,51,50,22,22,21,20,
+6,7,33,17,52,0,51,50,22,22,21,17,35,22,22,1,33,17,52,38,35,34,6,21,1,52,38,
+39,33,22,23,22,22,51,50,54,5,22,22,51,50,54,53,52,38,35,34,8,110,186,157,
+126,193,62,56,164,132,126,168,77,136,112,132,145,112,132,168,133,254,234,
+21,40,65,56,136,105,110,141,101,76,12,28,25,53,109,71,222,175,109,184,109,
+59,58,1,171,1,0,223,162,222,109,74,37,44,252,240,2,145,180,156,157,164,2,
+166,55,47,253,248,107,75,47,121,70,92,110,251,31,16,88,56,67,73,72,63,102,
+254,232,161,189,138,166,150,164,146,108,115,136,115,102,132,200,156,168,112,
+35,38,77,130,82,110,141,152,119,107,157,50,21,19,92,163,100,175,219,89,166,
+109,72,140,51,2,42,223,1,3,137,235,147,253,141,58,147,1,59,2,18,182,202,191,
+167,252,86,72,143,57,96,198,127,92,131,2,69,83,83,60,59,83,0,0,5,0,85,253,
+132,10,112,4,122,0,70,0,85,0,97,0,109,0,120,0,0,33,35,22,21,20,6,35,32,3,
+38,38,35,34,6,21,54,51,50,22,21,20,6,35,34,38,53,52,55,35,17,52,38,35,34,
+6,6,21,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,54,54,
+51,50,22,18,21,20,6,7,33,17,51,1,50,23,54,54,53,52,38,38,35,34,6,21,17,54,
+37,22,22,51,50,54,53,52,38,35,34,6,1,52,38,39,33,22,23,22,51,50,54,54,5,22,
+22,51,50,54,53,52,38,35,34,10,112,105,78,201,162,254,237,136,79,180,129,129,
+171,77,136,112,132,152,115,127,163,135,102,223,196,129,228,141,3,54,167,107,
+147,192,195,158,138,195,98,180,1,35,165,151,1,20,87,51,204,130,139,230,137,
+94,79,2,12,195,251,142,126,94,82,88,88,149,91,124,160,102,251,88,38,134,85,
+95,103,109,86,81,137,8,227,55,48,253,184,105,92,93,174,55,103,65,250,195,
+16,88,56,67,73,72,63,102,128,145,160,197,1,48,177,137,146,108,115,136,115,
+101,133,202,154,168,112,2,95,194,223,117,232,163,50,88,109,189,145,151,186,
+149,241,137,201,1,30,144,115,128,119,124,133,254,249,186,137,237,80,4,0,251,
+251,43,89,254,134,159,219,107,166,130,253,98,47,235,109,124,119,95,95,115,
+111,253,76,71,143,58,88,206,219,53,109,33,69,83,83,60,59,83,0,5,0,69,253,
+132,5,35,4,122,0,37,0,50,0,61,0,73,0,84,0,0,1,20,6,35,34,38,39,2,35,34,6,
+21,54,51,50,22,21,20,6,35,34,38,53,52,55,35,17,52,54,36,51,50,4,22,21,17,
+35,22,1,34,7,22,22,21,20,2,7,33,17,52,38,1,62,2,53,52,38,35,34,6,21,1,52,
+38,39,33,22,23,22,22,51,50,54,37,22,22,51,50,54,53,52,38,35,34,5,35,129,140,
+103,157,48,91,214,113,151,77,136,112,132,152,115,127,163,124,68,155,1,5,157,
+155,1,4,154,36,76,253,128,67,57,132,165,243,216,2,179,224,253,165,95,187,
+120,98,78,100,126,3,195,56,47,254,168,97,60,35,75,57,59,64,252,0,16,88,56,
+67,73,72,63,102,254,222,154,186,138,166,1,58,147,107,115,136,115,101,133,
+202,154,169,111,2,123,164,231,116,121,229,154,253,126,118,4,118,12,7,169,
+130,146,254,197,135,2,24,170,208,252,110,72,223,244,101,98,109,174,138,252,
+66,98,154,61,95,199,114,105,104,25,69,83,83,60,59,83,0,0,4,0,85,253,132,9,
+46,4,122,0,64,0,79,0,91,0,102,0,0,33,35,22,21,20,6,35,32,3,38,38,35,34,6,
+21,54,51,50,22,21,20,6,35,34,38,53,52,55,35,17,52,38,35,34,6,6,21,20,18,23,
+6,35,34,38,2,53,52,54,54,51,32,23,54,54,51,50,22,18,21,20,6,7,33,17,51,1,
+54,18,53,52,38,38,35,34,6,21,17,54,51,50,1,52,38,39,33,22,23,22,51,50,54,
+54,5,22,22,51,50,54,53,52,38,35,34,9,46,103,78,201,162,254,237,136,72,167,
+119,126,168,77,136,112,132,152,115,127,163,133,105,143,126,90,162,101,165,
+142,29,46,66,168,118,138,221,124,1,24,110,53,195,123,139,230,137,94,79,1,
+237,195,252,134,83,90,88,149,91,124,160,101,122,122,3,85,55,48,253,195,102,
+84,93,174,55,103,65,250,231,16,88,56,67,73,72,63,102,128,145,160,197,1,48,
+177,137,146,108,115,136,115,101,133,202,154,168,112,2,214,139,159,92,187,
+135,198,254,221,98,35,172,1,31,163,172,242,122,212,105,107,133,254,249,186,
+137,237,80,4,0,251,204,89,1,1,135,159,219,107,166,130,253,97,48,254,135,71,
+143,58,91,203,219,53,109,33,69,83,83,60,59,83,0,4,0,125,253,132,5,255,4,122,
+0,44,0,52,0,64,0,75,0,0,33,35,22,22,21,20,6,35,34,38,39,38,38,35,34,6,21,
+54,51,50,22,21,20,6,35,34,38,53,52,55,35,17,52,54,54,51,50,22,21,21,33,17,
+33,17,51,1,21,33,53,16,33,34,6,1,33,22,23,22,22,51,50,54,53,52,38,1,22,22,
+51,50,54,53,52,38,35,34,5,255,89,38,45,172,147,123,191,47,42,167,123,122,
+162,77,136,112,132,152,115,127,163,130,138,116,197,121,213,227,253,89,3,253,
+194,251,65,2,47,254,239,133,153,3,229,254,52,117,55,34,100,82,80,97,57,251,
+163,16,88,56,67,73,72,63,102,59,148,76,160,187,139,165,144,170,147,107,115,
+136,115,101,133,202,154,169,111,2,183,147,203,101,232,235,227,254,170,4,0,
+254,75,135,130,1,76,157,252,157,103,191,110,109,128,105,73,148,254,187,69,
+83,83,60,59,83,0,3,0,85,253,132,6,254,4,122,0,65,0,78,0,89,0,0,1,20,6,35,
+34,38,39,2,35,34,6,21,54,51,50,22,21,20,6,35,34,38,53,52,54,55,54,54,55,54,
+53,52,38,38,35,34,6,6,21,20,18,23,6,35,34,38,38,53,52,18,54,51,50,22,18,21,
+20,6,7,33,17,51,17,35,22,22,7,52,38,39,33,22,23,30,2,51,50,54,37,22,22,51,
+50,54,53,52,38,35,34,6,254,125,135,105,159,44,84,208,113,151,77,136,112,132,
+152,115,127,163,82,117,62,78,35,53,92,175,120,105,183,113,150,127,17,58,67,
+151,104,154,252,143,169,249,132,120,118,2,77,195,28,39,49,107,58,47,254,180,
+104,52,25,55,54,33,51,63,252,22,16,88,56,67,73,72,63,102,254,193,141,170,
+138,166,1,58,147,107,115,136,115,101,133,202,154,93,158,107,59,93,72,109,
+146,125,213,129,110,223,160,169,254,255,82,35,146,251,150,195,1,20,140,157,
+254,255,146,137,251,88,4,0,251,146,66,172,85,84,170,69,101,193,94,96,29,94,
+35,69,83,83,60,59,83,0,0,4,0,85,253,132,7,239,4,122,0,59,0,91,0,103,0,114,
+0,0,1,20,6,35,32,3,38,38,35,34,6,21,54,51,50,22,21,20,6,35,34,38,53,52,55,
+7,34,38,38,53,52,18,54,51,50,23,6,2,21,20,22,22,51,50,54,53,53,52,54,36,51,
+50,4,18,21,20,6,7,22,22,7,52,38,39,6,35,34,38,53,52,18,55,38,35,34,6,6,21,
+21,20,6,7,55,50,22,23,22,22,51,50,54,54,1,6,2,21,20,22,51,50,54,53,52,2,1,
+22,22,51,50,54,53,52,38,35,34,7,238,201,162,254,227,136,74,170,118,122,162,
+77,136,112,132,152,115,127,163,119,51,124,221,138,114,166,72,46,29,142,165,
+95,153,84,130,160,167,1,19,158,179,1,19,150,79,75,65,88,106,70,58,78,94,171,
+199,144,115,50,50,103,179,109,72,68,53,163,233,93,50,145,82,55,103,65,254,
+209,117,127,123,104,107,131,119,251,172,16,88,56,67,73,72,63,102,254,239,
+160,197,1,48,174,140,147,107,115,136,115,101,133,202,154,161,109,2,122,242,
+172,164,1,31,171,35,98,254,221,198,130,188,96,199,159,171,160,229,118,168,
+254,214,189,127,213,67,52,202,102,82,160,59,39,237,202,157,1,56,112,14,88,
+170,118,178,114,189,65,3,181,218,118,101,53,109,5,29,109,254,224,154,136,
+166,186,176,157,1,6,251,10,69,83,83,60,59,83,0,3,0,85,253,132,9,124,4,122,
+0,77,0,104,0,115,0,0,37,22,22,21,20,6,35,32,3,38,38,35,34,6,21,54,51,50,22,
+21,20,6,35,34,38,53,52,55,35,17,52,38,35,34,6,6,21,20,18,23,6,35,34,38,2,
+53,52,54,54,51,50,22,23,54,54,51,50,22,21,17,20,22,51,50,54,54,53,52,2,39,
+54,51,50,22,18,21,20,6,7,6,35,34,2,53,17,52,38,35,34,6,21,17,54,51,50,22,
+23,22,51,50,54,54,53,52,38,1,22,22,51,50,54,53,52,38,35,34,8,147,53,67,201,
+162,254,237,136,72,167,119,126,168,77,136,112,132,152,115,127,163,133,95,
+143,126,90,162,101,165,142,29,46,72,166,114,138,221,124,121,205,60,48,183,
+109,171,221,160,130,84,153,95,165,142,29,46,72,166,114,127,205,74,77,207,
+247,121,122,98,129,99,114,165,228,92,93,174,55,103,65,61,251,36,16,88,56,
+67,73,72,63,102,58,64,173,94,160,197,1,48,177,137,146,108,115,136,115,101,
+133,202,154,168,112,2,214,139,159,92,187,135,198,254,221,98,35,171,1,31,164,
+172,242,122,103,92,95,100,197,155,254,186,159,199,96,188,130,198,1,35,98,
+35,171,254,225,164,164,237,111,24,1,6,220,1,38,118,141,145,114,253,65,44,
+177,222,219,53,109,79,75,150,254,175,69,83,83,60,59,83,0,3,0,70,253,132,8,
+211,4,126,0,75,0,106,0,117,0,0,1,20,6,35,32,3,38,38,35,34,6,21,54,51,50,22,
+21,20,6,35,34,38,53,52,55,33,39,62,2,53,52,38,35,34,6,21,20,22,23,6,6,35,
+34,38,38,53,52,54,51,50,22,22,21,20,6,7,33,50,23,38,38,53,52,18,54,51,50,
+4,18,21,20,6,7,22,22,7,52,38,39,6,35,34,39,54,18,53,52,38,38,35,34,6,6,21,
+20,23,22,23,22,22,23,22,51,50,54,54,5,22,22,51,50,54,53,52,38,35,34,8,207,
+201,162,254,237,136,72,167,119,126,168,77,136,112,132,152,115,127,163,133,
+254,193,21,40,65,56,136,105,110,141,101,76,12,28,25,53,109,71,222,175,109,
+184,109,59,58,1,165,82,71,86,86,146,248,149,156,1,1,149,86,75,68,89,106,72,
+60,76,83,46,25,124,145,108,176,100,108,182,108,61,36,105,68,83,32,93,174,
+55,103,65,250,231,16,88,56,67,73,72,63,102,254,239,160,197,1,48,177,137,146,
+108,115,136,115,101,133,202,154,168,112,35,38,77,130,82,110,141,152,119,107,
+157,50,21,19,92,163,100,175,219,89,166,109,72,140,51,26,103,241,125,181,1,
+15,145,154,254,239,171,138,238,78,63,198,109,82,163,60,45,16,89,1,29,178,
+150,214,109,111,216,150,148,131,80,158,103,144,82,219,53,109,33,69,83,83,
+60,59,83,0,2,0,211,255,242,1,213,5,182,0,3,0,11,0,0,19,51,3,35,3,52,51,50,
+21,20,35,34,221,238,72,94,82,129,129,129,129,5,182,251,230,254,225,139,139,
+139,0,2,0,117,3,213,2,207,5,182,0,3,0,7,0,0,19,51,3,35,1,51,3,35,117,217,
+62,94,1,68,217,62,94,5,182,254,31,1,225,254,31,0,0,2,0,51,0,0,4,70,5,182,
+0,27,0,31,0,0,19,35,53,51,19,35,53,51,19,51,3,33,19,51,3,51,21,35,3,51,21,
+33,3,35,19,33,3,35,1,19,33,3,240,189,211,78,223,245,74,125,76,1,29,76,123,
+76,201,224,75,233,254,254,78,123,78,254,227,77,123,1,254,76,254,227,76,1,
+160,121,1,145,121,1,147,254,109,1,147,254,109,121,254,111,121,254,96,1,160,
+254,96,2,25,1,145,254,111,0,0,5,0,92,255,236,6,207,5,203,0,11,0,15,0,27,0,
+39,0,51,0,0,19,52,54,51,50,22,21,20,6,35,34,38,1,51,1,35,19,52,38,35,34,6,
+21,20,22,51,50,54,1,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,
+22,51,50,54,92,166,172,164,170,171,165,170,166,4,96,134,253,38,135,97,68,
+80,82,72,72,80,81,69,1,237,165,173,164,170,171,165,171,165,1,229,67,80,82,
+72,72,80,81,68,4,6,214,239,242,211,212,245,243,2,134,250,74,4,6,183,184,186,
+181,184,189,188,254,103,215,238,242,211,211,245,242,214,183,184,186,181,184,
+189,187,0,0,1,0,117,3,213,1,78,5,182,0,3,0,0,19,51,3,35,117,217,62,94,5,182,
+254,31,0,1,0,117,254,250,2,131,6,20,0,15,0,0,19,16,18,37,21,6,6,2,21,20,18,
+22,23,21,36,2,117,245,1,25,132,138,43,43,138,132,254,233,247,2,137,1,118,
+1,165,112,92,80,250,254,220,193,192,254,218,251,80,94,111,1,169,0,0,1,0,66,
+254,250,2,80,6,20,0,15,0,0,23,54,54,18,53,52,2,38,39,53,4,18,17,16,2,5,66,
+132,137,44,44,137,132,1,23,247,247,254,233,168,80,252,1,37,192,192,1,37,250,
+80,92,111,254,90,254,138,254,139,254,85,111,0,0,1,0,84,3,6,3,160,6,20,0,17,
+0,0,1,5,39,37,37,55,5,3,51,3,37,23,5,5,7,37,19,35,1,213,254,199,72,1,88,254,
+168,72,1,59,53,178,57,1,61,72,254,166,1,90,72,254,195,57,178,4,74,195,160,
+102,103,162,199,1,69,254,189,192,159,101,100,158,191,254,188,0,0,1,0,133,
+1,37,3,244,4,147,0,11,0,0,1,33,53,33,17,51,17,33,21,33,17,35,1,254,254,135,
+1,121,123,1,123,254,133,123,2,160,121,1,122,254,134,121,254,133,0,1,0,61,
+254,197,1,141,1,8,0,17,0,0,23,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,
+6,7,61,195,31,32,54,33,75,59,69,88,162,174,229,63,121,25,28,18,29,53,35,57,
+64,98,80,140,210,51,0,1,0,51,1,225,2,72,2,123,0,3,0,0,19,33,21,33,51,2,21,
+253,235,2,123,154,0,1,0,127,255,242,1,129,1,8,0,7,0,0,55,52,51,50,21,20,35,
+34,127,129,129,129,129,125,139,139,139,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,
+1,51,1,35,1,215,119,254,43,121,6,20,248,244,0,2,0,92,255,236,4,29,5,203,0,
+11,0,23,0,0,19,16,18,51,50,18,17,16,2,35,34,2,1,16,2,35,34,2,17,16,18,51,
+50,18,92,237,246,229,249,252,228,244,237,2,236,122,143,145,125,125,143,144,
+123,2,223,1,98,1,138,254,121,254,153,254,152,254,119,1,144,1,97,1,62,1,65,
+254,191,254,194,254,194,254,187,1,68,0,0,1,0,135,0,0,3,209,5,190,0,23,0,0,
+55,51,50,54,53,17,6,6,35,34,38,53,54,54,55,55,51,17,20,22,51,51,21,33,197,
+137,96,72,92,116,56,45,58,66,137,96,144,131,73,95,100,252,244,86,71,76,4,
+52,111,102,61,49,17,70,71,106,251,43,76,71,86,0,0,1,0,104,0,0,3,227,5,203,
+0,31,0,0,55,1,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,
+1,33,50,54,54,55,51,3,33,104,1,86,169,122,104,105,128,97,82,94,214,187,192,
+224,139,203,254,166,1,217,59,70,35,16,86,10,252,143,150,1,139,197,243,135,
+121,139,164,141,60,73,127,148,186,156,117,254,223,254,129,42,71,77,254,158,
+0,0,1,0,119,255,236,4,2,5,203,0,44,0,0,55,52,54,51,20,22,51,50,54,53,52,38,
+35,35,53,51,50,54,53,52,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,22,22,
+21,20,6,6,35,34,38,119,70,59,142,118,135,170,200,171,65,65,142,180,219,129,
+97,82,94,216,186,199,231,183,145,184,195,154,237,129,180,207,207,61,70,113,
+135,158,172,131,154,104,178,139,254,164,141,60,73,127,148,175,151,135,208,
+34,20,190,152,155,196,87,122,0,0,2,0,35,0,0,4,92,5,182,0,20,0,28,0,0,37,51,
+50,54,53,53,33,53,1,51,17,51,21,35,21,20,22,51,51,21,33,19,17,52,55,6,6,7,
+1,1,184,58,96,72,253,137,2,121,194,254,254,73,95,27,253,151,226,14,20,127,
+37,254,198,86,71,76,168,84,3,209,252,78,115,168,76,71,86,2,4,1,123,248,176,
+40,218,57,254,24,0,1,0,113,255,236,3,227,5,180,0,34,0,0,55,52,51,20,22,51,
+32,17,52,38,35,34,6,7,39,19,33,19,35,39,38,38,35,33,3,54,51,50,22,21,20,4,
+35,34,38,113,129,133,114,1,37,166,145,94,108,50,49,66,2,172,10,86,8,7,46,
+58,254,115,39,97,142,216,251,254,246,229,181,206,186,121,95,112,1,90,158,
+162,23,22,14,2,213,254,203,61,51,33,254,62,33,233,200,214,252,109,0,2,0,125,
+255,236,4,16,5,203,0,25,0,34,0,0,19,52,18,54,51,50,22,21,20,6,35,52,38,35,
+32,3,54,51,50,22,21,20,2,35,34,2,37,16,35,34,6,7,18,33,50,125,119,241,174,
+152,186,81,76,87,94,254,210,21,128,165,189,222,238,202,231,244,2,194,243,
+74,132,48,6,1,10,225,2,225,201,1,84,205,120,95,59,64,108,131,253,166,107,
+226,194,225,254,248,1,138,75,1,79,69,49,253,194,0,0,1,0,121,0,0,4,23,5,180,
+0,10,0,0,1,33,34,7,7,35,19,33,21,1,35,3,104,253,230,110,9,8,86,10,3,148,254,
+8,154,5,16,104,102,1,114,59,250,135,0,3,0,94,255,236,4,27,5,203,0,25,0,37,
+0,48,0,0,19,52,54,54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,
+4,35,34,38,1,52,38,35,34,6,21,20,22,23,54,54,19,52,38,39,6,21,20,22,51,50,
+54,94,78,132,102,126,139,93,199,151,184,219,115,161,164,176,254,249,229,213,
+252,2,199,124,110,109,128,117,159,107,88,59,164,196,211,142,134,131,164,1,
+111,93,136,96,49,71,182,122,100,166,101,193,160,109,156,81,78,189,126,191,
+220,210,3,177,118,133,133,112,97,139,74,53,133,253,97,105,156,85,114,220,
+131,153,150,0,0,2,0,104,255,233,3,252,5,203,0,26,0,38,0,0,55,52,54,55,22,
+51,50,18,19,6,6,35,34,38,53,52,18,51,50,18,17,20,2,6,35,34,38,1,2,2,35,34,
+6,21,20,22,51,54,54,168,37,24,70,168,168,163,11,50,152,99,191,213,240,199,
+230,247,116,249,190,160,137,2,131,4,142,122,109,119,117,121,94,134,154,36,
+54,8,162,1,44,1,56,61,78,221,195,228,1,20,254,151,254,185,226,254,142,222,
+102,3,3,1,8,1,0,192,179,166,149,1,94,0,0,2,0,166,255,242,1,168,4,84,0,7,0,
+15,0,0,19,52,51,50,21,20,35,34,17,52,51,50,21,20,35,34,166,129,129,129,129,
+129,129,129,129,3,201,139,139,140,253,64,139,139,139,0,0,2,0,98,254,197,1,
+178,4,84,0,7,0,25,0,0,19,52,51,50,21,20,35,34,3,54,53,52,38,39,38,38,53,52,
+54,51,50,22,21,20,6,7,166,129,129,129,129,68,195,31,32,54,33,75,58,70,88,
+162,174,3,201,139,139,140,251,222,63,121,25,28,18,31,51,35,57,64,99,79,140,
+210,51,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,53,1,21,1,1,21,133,3,111,
+253,80,2,176,2,184,72,1,217,137,254,139,254,143,137,0,0,2,0,133,1,213,3,244,
+3,225,0,3,0,7,0,0,19,33,21,33,17,33,21,33,133,3,111,252,145,3,111,252,145,
+3,225,121,254,230,121,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,1,1,53,1,21,
+1,133,2,176,253,80,3,111,252,145,1,106,1,113,1,117,137,254,39,72,254,41,0,
+2,0,88,255,242,3,152,5,203,0,23,0,31,0,0,1,54,54,53,52,38,35,34,6,21,34,38,
+53,52,54,51,50,22,21,20,6,7,21,35,3,52,51,50,21,6,35,34,1,141,167,147,110,
+114,120,109,76,94,200,183,203,246,200,198,125,69,129,129,1,128,129,2,211,
+67,222,135,111,124,145,117,69,64,109,121,204,167,163,224,82,231,254,225,139,
+139,139,0,0,1,0,205,254,250,2,150,6,20,0,13,0,0,19,33,21,35,34,6,21,17,20,
+22,51,51,21,33,205,1,201,89,95,72,72,95,89,254,55,6,20,86,71,76,250,184,75,
+72,86,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,17,51,1,35,119,1,215,121,6,20,248,
+244,0,1,0,76,254,250,2,20,6,20,0,13,0,0,23,51,50,54,53,17,52,38,35,35,53,
+33,17,33,76,88,96,72,73,95,88,1,200,254,56,176,71,76,5,72,76,71,86,248,230,
+0,0,1,0,104,2,33,4,14,5,182,0,6,0,0,1,51,1,35,1,1,35,2,23,71,1,176,137,254,
+180,254,185,138,5,182,252,107,2,217,253,39,0,1,255,246,254,221,3,182,255,
+86,0,3,0,0,7,33,21,33,10,3,192,252,64,170,121,0,0,1,0,102,254,250,3,6,6,20,
+0,35,0,0,37,17,52,38,39,53,54,54,53,17,52,54,51,51,21,35,34,6,21,17,20,6,
+7,21,22,22,21,17,20,22,51,51,21,35,34,38,1,88,127,115,114,128,151,144,135,
+61,89,79,116,112,115,113,80,88,61,135,142,153,33,1,100,117,95,5,86,3,96,116,
+1,101,140,152,88,106,109,254,162,102,132,18,2,19,131,104,254,158,107,108,
+88,158,0,1,1,254,254,20,2,121,6,20,0,3,0,0,1,51,17,35,1,254,123,123,6,20,
+248,0,0,1,0,102,254,250,3,6,6,20,0,35,0,0,23,51,50,54,53,17,52,54,55,53,38,
+38,53,17,52,38,35,35,53,51,50,22,21,17,20,22,23,21,6,6,21,17,20,6,35,35,102,
+62,88,80,113,114,111,116,79,89,62,136,143,151,129,113,114,128,152,142,136,
+174,108,107,1,98,104,131,19,2,18,132,102,1,94,109,106,88,152,140,254,155,
+116,96,3,86,5,95,117,254,156,137,158,0,0,1,0,111,2,39,4,8,3,141,0,25,0,0,
+1,50,22,23,22,22,51,50,54,55,51,6,6,35,34,38,39,38,38,35,34,6,7,35,54,54,
+1,104,67,110,79,57,73,38,54,57,14,123,17,105,128,67,114,64,61,73,43,58,59,
+12,120,14,105,3,141,62,73,52,50,117,120,150,208,66,63,58,50,114,123,155,203,
+0,255,255,0,51,1,225,2,72,2,123,2,6,0,199,0,0,0,1,255,246,1,233,4,10,2,98,
+0,3,0,0,3,33,21,33,10,4,20,251,236,2,98,121,0,1,255,246,1,233,8,10,2,98,0,
+3,0,0,3,33,21,33,10,8,20,247,236,2,98,121,0,1,0,115,3,117,1,195,5,184,0,17,
+0,0,19,52,54,55,21,6,21,20,22,23,22,22,21,20,6,35,34,38,115,162,174,195,30,
+33,42,45,75,59,69,88,4,39,140,210,51,86,63,121,25,28,19,22,49,45,57,64,98,
+0,0,1,0,61,3,115,1,141,5,182,0,17,0,0,19,54,53,52,38,39,38,38,53,52,54,51,
+50,22,21,20,6,7,61,195,30,33,42,45,75,59,69,88,162,174,3,201,63,121,25,28,
+19,22,49,45,57,64,98,80,140,210,51,0,0,2,0,115,3,117,3,92,5,184,0,17,0,35,
+0,0,19,52,54,55,21,6,21,20,22,23,22,22,21,20,6,35,34,38,37,52,54,55,21,6,
+21,20,22,23,22,22,21,20,6,35,34,38,115,162,174,195,30,33,42,45,75,59,69,88,
+1,153,162,174,194,30,33,41,45,74,59,70,88,4,39,140,210,51,86,63,121,25,28,
+19,22,49,45,57,64,98,80,140,210,51,86,63,121,25,28,19,22,49,45,57,64,99,0,
+2,0,61,3,115,3,39,5,182,0,17,0,35,0,0,19,54,53,52,38,39,38,38,53,52,54,51,
+50,22,21,20,6,7,37,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,
+30,33,42,45,75,59,69,88,162,174,1,154,195,30,33,42,45,74,59,70,88,162,174,
+3,201,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,86,63,121,25,28,19,
+22,49,45,57,64,99,79,140,210,51,0,3,0,164,255,242,6,57,1,8,0,7,0,15,0,23,
+0,0,55,52,51,50,21,20,35,34,37,52,51,50,21,20,35,34,37,52,51,50,21,20,35,
+34,164,129,129,129,129,2,74,129,129,129,129,2,73,129,129,129,129,125,139,
+139,139,139,139,139,139,139,139,139,139,0,0,1,0,145,1,51,3,229,4,137,0,11,
+0,0,19,1,1,55,1,1,23,1,1,7,1,1,145,1,84,254,172,86,1,84,1,84,86,254,172,1,
+84,86,254,172,254,172,1,139,1,84,1,82,86,254,172,1,86,88,254,172,254,172,
+86,1,84,254,172,0,0,3,0,133,0,231,3,244,4,209,0,7,0,11,0,19,0,0,1,52,51,50,
+21,20,35,34,5,33,21,33,1,52,51,50,21,20,35,34,1,213,104,105,105,104,254,176,
+3,111,252,145,1,80,104,105,105,104,4,96,113,113,112,215,121,254,184,113,113,
+113,0,1,0,133,2,160,3,244,3,25,0,3,0,0,19,33,21,33,133,3,111,252,145,3,25,
+121,255,255,255,144,4,234,0,110,6,65,2,6,0,85,0,0,255,255,255,144,254,30,
+0,110,255,117,2,7,0,85,0,0,249,52,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,
+0,3,0,1,4,9,0,1,0,40,0,94,0,3,0,1,4,9,0,2,0,14,0,134,0,3,0,1,4,9,0,3,0,78,
+0,148,0,3,0,1,4,9,0,4,0,40,0,94,0,3,0,1,4,9,0,5,0,30,0,226,0,3,0,1,4,9,0,
+6,0,36,1,0,0,3,0,1,4,9,0,7,0,68,1,36,0,3,0,1,4,9,0,8,0,42,1,104,0,3,0,1,4,
+9,0,9,0,38,1,146,0,3,0,1,4,9,0,10,0,96,1,184,0,3,0,1,4,9,0,11,0,62,2,24,0,
+3,0,1,4,9,0,12,0,60,2,86,0,3,0,1,4,9,0,13,2,150,2,146,0,3,0,1,4,9,0,14,0,
+52,5,40,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,
+48,0,49,0,54,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,
+0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,
+82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,
+0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,77,0,97,0,108,0,97,0,121,0,97,0,
+108,0,97,0,109,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,
+111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,
+32,0,77,0,97,0,108,0,97,0,121,0,97,0,108,0,97,0,109,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,49,0,32,0,117,0,104,0,78,0,111,0,
+116,0,111,0,83,0,101,0,114,0,105,0,102,0,77,0,97,0,108,0,97,0,121,0,97,0,
+108,0,97,0,109,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,
+0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,
+0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,
+0,32,0,73,0,110,0,99,0,46,0,73,0,110,0,100,0,105,0,97,0,110,0,32,0,84,0,121,
+0,112,0,101,0,32,0,70,0,111,0,117,0,110,0,100,0,114,0,121,0,68,0,97,0,116,
+0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,
+0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,
+0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,
+110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,
+47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,
+111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,
+0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,
+0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,
+0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,
+102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,
+0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,
+0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,
+83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,
+0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,
+0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,
+0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,
+0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,
+0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,
+0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,
+32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,
+116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,
+108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,
+109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,
+0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,
+0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,
+114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,
+0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,
+0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,240,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,
+1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,
+1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,
+1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,
+1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,
+1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,
+1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,
+102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,
+1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,
+127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,
+1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,
+152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,
+1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,
+177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,0,4,0,5,0,
+6,0,8,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,
+23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,62,0,63,0,64,
+0,65,0,66,0,94,0,95,0,96,0,97,1,188,0,178,0,179,0,182,0,183,0,180,0,181,0,
+171,0,240,0,184,0,239,1,189,1,190,4,78,85,76,76,3,109,108,65,4,109,108,65,
+65,3,109,108,73,4,109,108,73,73,3,109,108,85,4,109,108,85,85,4,109,108,118,
+82,5,109,108,118,82,82,4,109,108,118,76,5,109,108,118,76,76,3,109,108,69,
+4,109,108,69,69,4,109,108,65,73,3,109,108,79,4,109,108,79,79,4,109,108,65,
+85,5,109,108,109,65,65,4,109,108,109,73,5,109,108,109,73,73,4,109,108,109,
+85,5,109,108,109,85,85,5,109,108,109,118,82,6,109,108,109,118,82,82,5,109,
+108,109,118,76,6,109,108,109,118,76,76,4,109,108,109,69,5,109,108,109,69,
+69,5,109,108,109,65,73,4,109,108,109,79,5,109,108,109,79,79,5,109,108,109,
+65,85,14,109,108,65,85,108,101,110,103,116,104,109,97,114,107,4,109,108,75,
+65,5,109,108,75,72,65,4,109,108,71,65,5,109,108,71,72,65,5,109,108,78,71,
+65,4,109,108,67,65,5,109,108,67,72,65,4,109,108,74,65,5,109,108,74,72,65,
+5,109,108,78,89,65,5,109,108,84,84,65,6,109,108,84,84,72,65,5,109,108,68,
+68,65,6,109,108,68,68,72,65,5,109,108,78,78,65,4,109,108,84,65,5,109,108,
+84,72,65,4,109,108,68,65,5,109,108,68,72,65,4,109,108,78,65,4,109,108,80,
+65,5,109,108,80,72,65,4,109,108,66,65,5,109,108,66,72,65,4,109,108,77,65,
+4,109,108,89,65,4,109,108,82,65,4,109,108,76,65,4,109,108,86,65,5,109,108,
+83,72,65,5,109,108,83,83,65,4,109,108,83,65,4,109,108,72,65,6,109,108,78,
+78,78,65,6,109,108,84,84,84,65,5,109,108,82,82,65,5,109,108,76,76,65,6,109,
+108,76,76,76,65,9,109,108,75,99,104,105,108,108,117,10,109,108,78,78,99,104,
+105,108,108,117,9,109,108,78,99,104,105,108,108,117,10,109,108,82,82,99,104,
+105,108,108,117,9,109,108,76,99,104,105,108,108,117,10,109,108,76,76,99,104,
+105,108,108,117,10,109,108,65,110,117,115,118,97,114,97,13,109,108,67,97,
+110,100,114,97,98,105,110,100,117,9,109,108,86,105,115,97,114,103,97,8,109,
+108,86,105,114,97,109,97,10,109,108,65,118,97,103,114,97,104,97,9,109,108,
+68,111,116,114,101,112,104,6,109,108,90,101,114,111,5,109,108,79,110,101,
+5,109,108,84,119,111,7,109,108,84,104,114,101,101,6,109,108,70,111,117,114,
+6,109,108,70,105,118,101,5,109,108,83,105,120,7,109,108,83,101,118,101,110,
+7,109,108,69,105,103,104,116,6,109,108,78,105,110,101,5,109,108,84,101,110,
+12,109,108,79,110,101,104,117,110,100,114,101,100,13,109,108,79,110,101,116,
+104,111,117,115,97,110,100,12,109,108,79,110,101,113,117,97,114,116,101,114,
+9,109,108,79,110,101,104,97,108,102,15,109,108,84,104,114,101,101,113,117,
+97,114,116,101,114,115,10,109,108,68,97,116,101,109,97,114,107,11,109,108,
+73,73,97,114,99,104,97,105,99,7,117,110,105,48,57,54,52,7,117,110,105,48,
+57,54,53,7,117,110,105,50,48,66,57,7,117,110,105,50,48,48,66,7,117,110,105,
+50,48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,50,53,67,67,6,109,108,
+89,65,99,50,6,109,108,82,65,99,50,6,109,108,76,65,99,50,6,109,108,86,65,99,
+50,6,109,108,75,95,75,65,6,109,108,75,95,84,65,7,109,108,75,95,83,83,65,6,
+109,108,71,95,68,65,6,109,108,71,95,78,65,6,109,108,71,95,77,65,7,109,108,
+78,71,95,75,65,8,109,108,78,71,95,78,71,65,6,109,108,74,95,74,65,7,109,108,
+74,95,78,89,65,7,109,108,78,89,95,67,65,8,109,108,78,89,95,67,72,65,7,109,
+108,78,89,95,74,65,8,109,108,78,89,95,78,89,65,8,109,108,84,84,95,84,84,65,
+8,109,108,78,78,95,84,84,65,8,109,108,78,78,95,68,68,65,9,109,108,78,78,95,
+68,68,72,65,7,109,108,78,78,95,77,65,6,109,108,84,95,84,65,7,109,108,84,95,
+84,72,65,6,109,108,84,95,78,65,7,109,108,84,95,66,72,65,6,109,108,84,95,77,
+65,6,109,108,84,95,83,65,6,109,108,68,95,68,65,7,109,108,68,95,68,72,65,6,
+109,108,78,95,84,65,7,109,108,78,95,84,72,65,6,109,108,78,95,68,65,7,109,
+108,78,95,68,72,65,6,109,108,78,95,78,65,6,109,108,78,95,77,65,6,109,108,
+77,95,80,65,6,109,108,77,95,77,65,7,109,108,83,72,95,67,65,8,109,108,83,72,
+95,67,72,65,7,109,108,83,95,84,72,65,6,109,108,72,95,78,65,6,109,108,72,95,
+77,65,8,109,108,76,76,95,76,76,65,6,109,108,67,95,67,65,6,109,108,66,95,66,
+65,6,109,108,89,95,89,65,6,109,108,86,95,86,65,10,109,108,75,65,95,84,84,
+65,99,50,9,109,108,71,65,95,71,65,99,50,10,109,108,67,65,95,67,72,65,99,50,
+11,109,108,68,68,65,95,68,68,65,99,50,12,109,108,68,68,65,95,68,68,72,65,
+99,50,11,109,108,78,78,65,95,78,78,65,99,50,15,109,108,78,99,104,105,108,
+108,117,95,82,82,65,99,50,9,109,108,80,65,95,80,65,99,50,9,109,108,66,65,
+95,68,65,99,50,10,109,108,66,65,95,68,72,65,99,50,9,109,108,76,65,95,80,65,
+99,50,11,109,108,83,72,65,95,83,72,65,99,50,11,109,108,83,83,65,95,84,84,
+65,99,50,9,109,108,83,65,95,83,65,99,50,16,109,108,83,65,95,82,82,65,99,50,
+95,82,82,65,99,50,11,109,108,82,82,65,95,82,82,65,99,50,9,109,108,75,65,95,
+76,65,99,50,9,109,108,71,65,95,76,65,99,50,9,109,108,84,65,95,76,65,99,50,
+9,109,108,80,65,95,76,65,99,50,10,109,108,80,72,65,95,76,65,99,50,9,109,108,
+66,65,95,76,65,99,50,9,109,108,77,65,95,76,65,99,50,11,109,108,77,95,80,65,
+95,76,65,99,50,9,109,108,76,65,95,76,65,99,50,9,109,108,86,65,95,76,65,99,
+50,10,109,108,83,72,65,95,76,65,99,50,9,109,108,83,65,95,76,65,99,50,9,109,
+108,72,65,95,76,65,99,50,7,117,110,105,48,48,65,68,7,117,110,105,48,51,48,
+55,7,117,110,105,48,51,50,51,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,
+0,0,0,0,0,0,2,0,4,0,27,0,28,0,3,0,81,0,81,0,3,0,85,0,85,0,3,0,238,0,239,0,
+3,0,1,0,0,0,10,0,60,0,162,0,2,68,70,76,84,0,14,109,108,109,50,0,32,0,4,0,
+0,0,0,255,255,0,4,0,0,0,2,0,4,0,6,0,4,0,0,0,0,255,255,0,4,0,1,0,3,0,5,0,7,
+0,8,97,98,118,109,0,50,97,98,118,109,0,56,98,108,119,109,0,62,98,108,119,
+109,0,68,100,105,115,116,0,74,100,105,115,116,0,80,109,97,114,107,0,86,109,
+97,114,107,0,94,0,0,0,1,0,3,0,0,0,1,0,3,0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,
+0,0,0,0,1,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,5,0,12,0,20,0,28,0,36,0,44,
+0,2,0,0,0,1,0,40,0,4,0,0,0,1,0,90,0,4,0,0,0,1,3,92,0,4,0,0,0,1,6,100,0,4,
+0,0,0,1,9,112,0,1,9,208,0,4,0,0,0,6,0,22,0,28,0,34,0,40,0,46,0,52,0,1,0,21,
+1,44,0,1,0,22,1,144,0,1,0,23,0,100,0,1,0,24,0,100,0,1,0,25,0,100,0,1,0,26,
+1,94,0,1,9,160,9,166,0,1,0,12,0,18,0,1,0,0,1,6,0,127,1,6,1,6,1,12,1,12,1,
+18,1,18,1,24,1,24,1,30,1,30,1,36,1,42,1,48,1,54,1,54,1,54,1,60,1,66,1,72,
+1,78,1,84,1,90,1,96,1,102,1,108,1,114,1,120,1,126,1,132,1,138,1,144,1,150,
+1,156,1,162,1,168,1,174,1,180,1,186,1,192,1,198,1,204,1,18,1,210,1,216,1,
+222,1,228,1,132,1,234,1,240,1,246,1,126,1,252,2,2,2,8,2,14,2,20,2,26,2,32,
+2,38,2,44,2,50,2,56,2,62,2,68,2,74,2,80,2,86,2,92,1,120,2,98,2,104,2,110,
+2,116,2,122,2,128,2,134,2,140,2,146,1,156,2,152,2,158,2,164,1,144,1,108,2,
+170,2,176,2,182,2,188,2,194,2,200,2,206,2,212,2,218,2,224,1,90,1,186,1,204,
+2,230,1,60,1,72,1,90,1,132,1,132,2,236,2,242,1,174,1,186,1,186,1,210,1,222,
+1,228,1,132,1,132,1,126,1,60,1,72,1,144,1,174,1,180,1,186,1,198,2,182,1,210,
+2,230,1,222,1,132,1,234,0,1,0,0,0,0,0,1,5,179,0,0,0,1,4,12,0,0,0,1,2,189,
+0,0,0,1,3,21,0,0,0,1,4,190,0,0,0,1,5,61,0,0,0,1,5,50,0,0,0,1,10,237,0,0,0,
+1,2,234,0,0,0,1,3,242,0,0,0,1,4,44,0,0,0,1,3,157,0,0,0,1,5,40,0,0,0,1,4,96,
+0,0,0,1,3,185,0,0,0,1,5,75,0,0,0,1,3,137,0,0,0,1,6,149,0,0,0,1,5,232,0,0,
+0,1,2,80,0,0,0,1,2,157,0,0,0,1,4,233,0,0,0,1,5,123,0,0,0,1,3,214,0,0,0,1,
+3,145,0,0,0,1,2,128,0,0,0,1,3,192,4,110,0,1,3,192,0,0,0,1,3,179,0,0,0,1,4,
+117,0,0,0,1,5,99,0,0,0,1,2,138,0,0,0,1,2,184,0,0,0,1,3,251,0,0,0,1,3,70,0,
+0,0,1,3,180,0,0,0,1,4,34,0,0,0,1,4,122,0,0,0,1,4,148,0,0,0,1,4,79,0,0,0,1,
+3,43,0,0,0,1,2,190,0,0,0,1,2,127,0,0,0,1,5,3,0,0,0,1,5,223,0,0,0,1,7,25,0,
+0,0,1,6,141,0,0,0,1,4,17,0,0,0,1,5,13,4,110,0,1,5,117,0,0,0,1,3,247,0,0,0,
+1,5,213,0,0,0,1,7,68,0,0,0,1,9,126,0,0,0,1,6,219,0,0,0,1,8,145,0,0,0,1,6,
+163,0,0,0,1,8,241,0,0,0,1,6,52,0,0,0,1,8,162,0,0,0,1,5,248,0,0,0,1,7,12,0,
+0,0,1,6,144,0,0,0,1,5,73,0,0,0,1,5,152,0,0,0,1,5,178,0,0,0,1,6,113,0,0,0,
+1,4,236,0,0,0,1,5,81,0,0,0,1,6,122,0,0,0,1,5,58,0,0,0,1,4,41,0,0,0,1,4,194,
+0,0,0,1,4,183,0,0,0,1,6,73,0,0,0,1,8,79,0,0,0,1,7,85,0,0,0,1,5,215,0,0,0,
+1,4,187,0,0,0,1,5,113,0,0,0,1,3,140,0,0,0,1,5,158,0,0,0,1,4,81,0,0,0,1,6,
+196,6,156,0,1,0,12,0,18,0,1,0,0,1,6,0,127,1,6,1,6,1,12,1,12,1,18,1,18,1,24,
+1,24,1,30,1,30,1,36,1,42,1,48,1,54,1,54,1,54,1,60,1,66,1,72,1,78,1,84,1,90,
+1,96,1,102,1,108,1,114,1,120,1,126,1,132,1,138,1,144,1,150,1,156,1,162,1,
+168,1,174,1,180,1,186,1,192,1,198,1,204,1,18,1,210,1,216,1,222,1,228,1,234,
+1,240,1,246,1,252,1,126,2,2,2,8,2,14,2,20,2,26,2,32,2,38,2,44,2,50,2,56,2,
+62,2,68,2,74,2,80,2,86,2,92,2,98,1,120,2,104,2,110,2,116,2,122,2,128,2,134,
+2,140,2,146,2,152,1,156,2,158,2,164,2,170,1,144,1,108,2,176,2,182,2,188,2,
+194,2,200,2,206,2,212,2,218,2,224,2,230,1,90,1,186,1,204,2,236,1,60,1,72,
+1,90,1,132,1,132,2,242,2,248,1,174,1,186,1,186,1,210,1,222,1,228,1,234,1,
+234,1,126,1,60,1,72,1,144,1,174,1,180,1,186,1,198,2,188,1,210,2,236,1,222,
+1,234,1,240,0,1,0,0,4,110,0,1,5,179,4,110,0,1,4,12,4,110,0,1,2,189,4,110,
+0,1,3,21,4,110,0,1,4,190,4,110,0,1,5,61,4,110,0,1,5,50,4,110,0,1,10,237,4,
+110,0,1,2,234,4,110,0,1,3,242,4,110,0,1,4,44,4,110,0,1,3,157,4,110,0,1,5,
+40,4,110,0,1,4,96,4,110,0,1,3,185,4,110,0,1,5,75,4,110,0,1,3,137,4,110,0,
+1,6,149,4,110,0,1,5,232,4,110,0,1,2,80,4,110,0,1,2,157,4,110,0,1,4,233,4,
+110,0,1,5,123,4,131,0,1,3,214,4,110,0,1,3,145,4,110,0,1,2,128,4,110,0,1,3,
+192,0,0,0,1,3,192,4,110,0,1,3,179,4,110,0,1,4,117,4,110,0,1,5,99,4,110,0,
+1,2,138,4,110,0,1,2,184,4,110,0,1,3,251,4,110,0,1,3,70,4,110,0,1,3,180,4,
+110,0,1,4,34,4,110,0,1,4,122,4,110,0,1,4,233,4,131,0,1,4,148,4,110,0,1,4,
+79,4,110,0,1,3,43,4,110,0,1,2,190,4,110,0,1,2,127,4,110,0,1,5,3,4,110,0,1,
+5,223,4,110,0,1,7,25,4,110,0,1,6,141,4,110,0,1,4,17,4,110,0,1,5,13,0,0,0,
+1,5,117,4,110,0,1,3,247,4,110,0,1,5,213,4,110,0,1,7,68,4,110,0,1,9,126,4,
+110,0,1,6,219,4,110,0,1,8,145,4,110,0,1,6,163,4,110,0,1,8,241,4,110,0,1,6,
+51,4,122,0,1,8,162,4,110,0,1,5,248,4,110,0,1,7,12,4,110,0,1,6,144,4,110,0,
+1,5,73,4,110,0,1,5,152,4,110,0,1,5,178,4,110,0,1,6,113,4,110,0,1,4,236,4,
+110,0,1,5,81,4,110,0,1,6,122,4,110,0,1,5,58,4,110,0,1,4,41,4,110,0,1,4,194,
+4,110,0,1,4,183,4,110,0,1,6,73,4,110,0,1,8,79,4,110,0,1,7,85,4,110,0,1,5,
+215,4,110,0,1,4,187,4,110,0,1,5,113,4,110,0,1,3,140,4,110,0,1,5,158,4,110,
+0,1,4,81,4,110,0,1,3,186,3,140,0,1,0,12,0,22,0,2,0,0,1,10,0,0,1,10,0,127,
+1,6,1,6,1,12,1,12,1,18,1,18,1,24,1,24,1,30,1,30,1,36,1,42,1,48,1,54,1,54,
+1,54,1,60,1,66,1,72,1,78,1,84,1,90,1,96,1,102,1,108,1,114,1,120,1,126,1,132,
+1,138,1,144,1,150,1,156,1,162,1,168,1,174,1,180,1,186,1,192,1,198,1,204,1,
+18,1,210,1,216,1,222,1,228,1,234,1,240,1,246,1,252,1,126,2,2,2,8,2,14,2,20,
+2,26,2,32,2,38,2,44,2,50,2,56,2,62,2,68,2,74,2,80,2,86,2,92,2,98,1,120,2,
+104,2,110,2,116,2,122,2,128,2,134,2,140,2,146,2,152,1,156,2,158,2,164,2,170,
+1,144,1,108,2,176,2,182,2,188,2,194,2,200,2,206,2,212,2,218,2,224,2,230,1,
+90,1,186,1,204,2,236,1,60,1,72,1,90,1,132,1,132,2,242,2,248,1,174,1,186,1,
+186,1,210,1,222,1,228,1,234,1,234,1,126,1,60,1,72,1,144,1,174,1,180,1,186,
+1,198,2,188,1,210,2,236,1,222,1,234,1,240,0,1,0,0,4,110,0,1,5,179,4,110,0,
+1,4,12,4,110,0,1,2,189,4,110,0,1,3,21,4,110,0,1,4,190,4,110,0,1,5,61,4,110,
+0,1,5,50,4,110,0,1,10,237,4,110,0,1,2,234,4,110,0,1,3,242,4,110,0,1,4,44,
+4,110,0,1,3,157,4,110,0,1,5,40,4,110,0,1,4,96,4,110,0,1,3,185,4,110,0,1,5,
+75,4,110,0,1,3,137,4,110,0,1,6,149,4,110,0,1,5,232,4,110,0,1,2,80,4,110,0,
+1,2,157,4,110,0,1,4,233,4,110,0,1,5,123,4,131,0,1,3,214,4,110,0,1,3,145,4,
+110,0,1,2,128,4,110,0,1,3,192,0,0,0,1,3,192,4,110,0,1,3,179,4,110,0,1,4,117,
+4,110,0,1,5,99,4,110,0,1,2,138,4,110,0,1,2,184,4,110,0,1,3,251,4,110,0,1,
+3,70,4,110,0,1,3,180,4,110,0,1,4,34,4,110,0,1,4,122,4,110,0,1,4,233,4,131,
+0,1,4,148,4,110,0,1,4,79,4,110,0,1,3,43,4,110,0,1,2,190,4,110,0,1,2,127,4,
+110,0,1,5,3,4,110,0,1,5,223,4,110,0,1,7,25,4,110,0,1,6,141,4,110,0,1,4,17,
+4,110,0,1,5,13,0,0,0,1,5,117,4,110,0,1,3,247,4,110,0,1,5,213,4,110,0,1,7,
+68,4,110,0,1,9,126,4,110,0,1,6,219,4,110,0,1,8,145,4,110,0,1,6,163,4,110,
+0,1,8,241,4,110,0,1,6,51,4,122,0,1,8,162,4,110,0,1,5,248,4,110,0,1,7,12,4,
+110,0,1,6,144,4,110,0,1,5,73,4,110,0,1,5,152,4,110,0,1,5,178,4,110,0,1,6,
+113,4,110,0,1,4,236,4,110,0,1,5,81,4,110,0,1,6,122,4,110,0,1,5,58,4,110,0,
+1,4,41,4,110,0,1,4,194,4,110,0,1,4,183,4,110,0,1,6,73,4,110,0,1,8,79,4,110,
+0,1,7,85,4,110,0,1,5,215,4,110,0,1,4,187,4,110,0,1,5,113,4,110,0,1,3,140,
+4,110,0,1,5,158,4,110,0,1,4,81,4,110,0,1,0,174,0,182,0,1,0,12,0,22,0,2,0,
+0,0,38,0,0,0,38,0,13,0,34,0,40,0,46,0,52,0,58,0,64,0,40,0,70,0,34,0,76,0,
+46,0,40,0,58,0,1,252,182,0,0,0,1,2,80,0,0,0,1,2,157,0,0,0,1,2,128,0,0,0,1,
+2,138,0,0,0,1,2,184,0,0,0,1,2,189,0,0,0,1,2,127,0,0,0,1,8,177,0,0,0,2,0,1,
+0,21,0,26,0,0,0,1,0,1,0,239,0,2,0,6,0,4,0,19,0,0,0,36,0,49,0,16,0,51,0,73,
+0,30,0,103,0,103,0,53,0,115,0,130,0,54,0,132,0,188,0,70,0,1,0,1,0,238,0,1,
+0,2,0,81,0,85,0,1,0,2,0,27,0,28,0,1,0,13,0,46,0,47,0,53,0,59,0,60,0,62,0,
+71,0,73,0,129,0,137,0,140,0,175,0,182,0,0,0,1,0,0,0,10,0,56,0,142,0,2,68,
+70,76,84,0,14,109,108,109,50,0,30,0,4,0,0,0,0,255,255,0,3,0,0,0,2,0,4,0,4,
+0,0,0,0,255,255,0,3,0,1,0,3,0,5,0,6,97,107,104,110,0,38,97,107,104,110,0,
+50,112,114,101,102,0,62,112,114,101,102,0,68,112,115,116,102,0,74,112,115,
+116,102,0,80,0,0,0,4,0,0,0,1,0,2,0,3,0,0,0,4,0,0,0,1,0,2,0,3,0,0,0,1,0,4,
+0,0,0,1,0,4,0,0,0,1,0,5,0,0,0,1,0,5,0,6,0,14,0,22,0,30,0,38,0,46,0,54,0,4,
+0,0,0,1,0,48,0,4,0,0,0,1,0,74,0,4,0,0,0,1,0,156,0,4,0,0,0,1,0,168,0,4,0,0,
+0,1,3,226,0,4,0,0,0,1,3,236,0,1,3,254,0,2,0,10,0,22,0,1,0,4,0,166,0,3,0,83,
+0,71,0,1,0,4,0,166,0,3,0,83,0,71,0,1,3,228,0,6,0,18,0,30,0,42,0,54,0,66,0,
+78,0,1,0,4,0,74,0,3,0,83,0,109,0,1,0,4,0,75,0,3,0,83,0,109,0,1,0,4,0,76,0,
+3,0,83,0,109,0,1,0,4,0,77,0,3,0,83,0,109,0,1,0,4,0,78,0,3,0,83,0,109,0,1,
+0,4,0,79,0,3,0,83,0,109,0,1,3,154,0,1,0,8,0,1,0,4,0,117,0,3,0,83,0,66,0,1,
+3,140,0,26,0,58,0,100,0,152,0,174,0,196,0,218,1,4,1,16,1,38,1,90,1,162,1,
+184,1,246,2,12,2,24,2,66,2,98,2,110,2,132,2,154,2,196,2,208,2,254,3,30,3,
+42,3,54,0,4,0,10,0,18,0,26,0,34,0,115,0,3,0,83,0,36,0,160,0,3,0,83,0,46,0,
+116,0,3,0,83,0,51,0,176,0,3,0,83,0,63,0,5,0,12,0,20,0,28,0,36,0,44,0,161,
+0,3,0,83,0,38,0,118,0,3,0,83,0,53,0,119,0,3,0,83,0,55,0,120,0,3,0,83,0,60,
+0,177,0,3,0,83,0,63,0,2,0,6,0,14,0,121,0,3,0,83,0,36,0,122,0,3,0,83,0,40,
+0,2,0,6,0,14,0,156,0,3,0,83,0,41,0,162,0,3,0,83,0,42,0,2,0,6,0,14,0,123,0,
+3,0,83,0,43,0,124,0,3,0,83,0,45,0,4,0,10,0,18,0,26,0,34,0,125,0,3,0,83,0,
+41,0,126,0,3,0,83,0,42,0,127,0,3,0,83,0,43,0,128,0,3,0,83,0,45,0,1,0,4,0,
+129,0,3,0,83,0,46,0,2,0,6,0,14,0,163,0,3,0,83,0,48,0,164,0,3,0,83,0,49,0,
+5,0,12,0,20,0,28,0,36,0,44,0,130,0,3,0,83,0,46,0,131,0,3,0,83,0,48,0,132,
+0,3,0,83,0,49,0,165,0,3,0,83,0,50,0,133,0,3,0,83,0,60,0,7,0,16,0,24,0,32,
+0,40,0,48,0,56,0,64,0,134,0,3,0,83,0,51,0,135,0,3,0,83,0,52,0,136,0,3,0,83,
+0,55,0,137,0,3,0,83,0,59,0,138,0,3,0,83,0,60,0,178,0,3,0,83,0,63,0,139,0,
+3,0,83,0,67,0,2,0,6,0,14,0,140,0,3,0,83,0,53,0,141,0,3,0,83,0,54,0,6,0,14,
+0,22,0,30,0,38,0,46,0,54,0,142,0,3,0,83,0,51,0,143,0,3,0,83,0,52,0,144,0,
+3,0,83,0,53,0,145,0,3,0,83,0,54,0,146,0,3,0,83,0,55,0,147,0,3,0,83,0,60,0,
+2,0,6,0,14,0,167,0,3,0,83,0,56,0,179,0,3,0,83,0,63,0,1,0,4,0,180,0,3,0,83,
+0,63,0,4,0,10,0,18,0,26,0,34,0,168,0,3,0,83,0,53,0,169,0,3,0,83,0,54,0,157,
+0,3,0,83,0,58,0,181,0,3,0,83,0,63,0,3,0,8,0,16,0,24,0,148,0,3,0,83,0,56,0,
+149,0,3,0,83,0,60,0,182,0,3,0,83,0,63,0,1,0,4,0,158,0,3,0,83,0,61,0,2,0,6,
+0,14,0,170,0,3,0,83,0,56,0,184,0,3,0,83,0,63,0,2,0,6,0,14,0,185,0,3,0,83,
+0,63,0,159,0,3,0,83,0,64,0,4,0,10,0,18,0,26,0,34,0,150,0,3,0,83,0,41,0,151,
+0,3,0,83,0,42,0,186,0,3,0,83,0,63,0,171,0,3,0,83,0,65,0,1,0,4,0,172,0,3,0,
+83,0,46,0,4,0,10,0,22,0,30,0,38,0,174,0,5,0,83,0,71,0,83,0,71,0,152,0,3,0,
+83,0,52,0,187,0,3,0,83,0,63,0,173,0,3,0,83,0,67,0,3,0,8,0,16,0,24,0,153,0,
+3,0,83,0,55,0,154,0,3,0,83,0,60,0,188,0,3,0,83,0,63,0,1,0,4,0,175,0,3,0,83,
+0,71,0,1,0,4,0,155,0,3,0,83,0,72,0,1,0,4,0,183,0,3,0,83,0,63,0,1,0,130,0,
+1,0,8,0,1,0,4,0,112,0,2,0,62,0,1,0,112,0,1,0,8,0,2,0,6,0,12,0,111,0,2,0,61,
+0,114,0,2,0,64,0,1,0,2,0,55,0,76,0,1,0,6,0,36,0,50,0,55,0,62,0,63,0,72,0,
+1,0,1,0,36,0,1,0,26,0,36,0,38,0,40,0,41,0,43,0,45,0,46,0,48,0,50,0,51,0,53,
+0,55,0,56,0,57,0,58,0,60,0,61,0,63,0,64,0,65,0,66,0,67,0,68,0,71,0,72,0,148,
+0,1,0,1,0,83,0,0,};
+#endif
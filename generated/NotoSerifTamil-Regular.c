@@ -0,0 +1,1488 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifTamil_Regular_ttf_size = 34904;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifTamil_Regular_ttf");
+asm(".type fz_font_NotoSerifTamil_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifTamil_Regular_ttf, 34904");
+asm(".balign 64");
+asm("fz_font_NotoSerifTamil_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifTamil-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifTamil_Regular_ttf_size = 34904;
+const char fz_font_NotoSerifTamil_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,0,15,0,57,0,0,129,152,0,0,0,20,71,
+80,79,83,46,105,56,141,0,0,129,172,0,0,2,194,71,83,85,66,97,189,132,163,0,
+0,132,112,0,0,3,232,79,83,47,50,121,17,107,77,0,0,1,104,0,0,0,96,99,109,97,
+112,20,243,66,145,0,0,4,200,0,0,1,154,103,97,115,112,0,7,0,7,0,0,129,140,
+0,0,0,12,103,108,121,102,242,76,119,9,0,0,7,236,0,0,110,70,104,101,97,100,
+23,24,208,172,0,0,0,236,0,0,0,54,104,104,101,97,25,17,18,5,0,0,1,36,0,0,0,
+36,104,109,116,120,96,40,51,113,0,0,1,200,0,0,2,254,108,111,99,97,190,169,
+161,43,0,0,6,100,0,0,1,134,109,97,120,112,0,234,1,224,0,0,1,72,0,0,0,32,110,
+97,109,101,139,146,184,208,0,0,118,52,0,0,5,254,112,111,115,116,24,32,1,170,
+0,0,124,52,0,0,5,86,0,1,0,0,0,1,2,143,95,251,7,0,95,15,60,245,0,11,8,0,0,
+0,0,0,211,73,103,208,0,0,0,0,211,101,29,59,251,102,252,117,21,229,7,159,0,
+0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,195,252,82,0,0,22,13,251,102,254,232,21,229,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,189,0,1,0,0,0,194,0,192,0,16,1,30,0,20,
+0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,1,0,4,7,133,1,144,0,5,0,0,5,154,5,51,0,
+0,0,230,5,154,5,51,0,0,2,92,0,102,2,129,0,0,2,2,5,2,4,5,4,2,2,4,0,16,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,195,252,82,0,0,7,195,
+3,174,0,0,0,1,0,0,0,0,4,110,4,110,0,0,0,32,0,4,4,205,0,193,0,0,0,0,2,188,
+0,0,2,188,0,0,10,145,0,80,11,231,0,80,8,47,0,100,5,239,0,200,8,57,0,100,13,
+237,0,100,7,130,0,120,7,130,0,120,7,234,0,120,8,25,0,120,8,25,0,120,17,220,
+0,110,5,105,0,200,1,219,253,101,0,0,252,225,4,111,253,228,7,80,253,225,7,
+6,0,130,5,40,0,130,10,113,0,120,17,33,0,130,15,52,0,130,22,13,0,130,10,24,
+0,120,6,212,0,130,8,50,0,200,5,192,0,130,10,111,0,130,7,60,0,200,14,17,0,
+120,6,212,0,130,6,156,0,200,7,48,0,200,7,100,0,200,7,175,0,190,5,69,0,200,
+8,111,0,120,9,60,0,120,7,100,0,200,10,24,0,120,7,17,0,190,10,179,0,120,7,
+227,0,120,9,26,0,190,11,127,0,120,11,84,0,120,13,78,0,120,14,240,0,130,0,
+0,255,8,7,56,0,120,0,0,255,131,8,25,0,120,4,246,0,120,6,222,0,130,7,137,0,
+100,7,58,0,200,7,45,0,130,8,250,0,120,8,214,0,130,7,130,0,120,10,142,0,80,
+10,30,0,130,6,208,0,195,7,29,0,148,9,62,0,90,7,173,0,120,9,56,0,200,17,175,
+0,130,9,105,0,80,12,107,0,130,15,158,0,130,8,115,0,130,7,161,0,200,2,112,
+0,215,4,94,0,215,4,121,0,121,0,0,0,0,0,0,255,213,0,0,255,33,4,193,0,98,7,
+138,0,200,10,101,0,120,13,52,0,120,8,50,0,200,7,238,0,200,7,48,0,200,7,208,
+0,190,8,107,0,120,9,60,0,120,11,72,0,120,8,98,0,130,8,50,0,200,7,10,0,130,
+11,43,0,120,8,102,0,130,15,162,0,120,9,126,0,130,9,6,0,185,7,67,0,200,10,
+20,0,130,7,208,0,190,9,43,0,130,10,143,0,120,9,60,0,120,10,60,0,130,13,6,
+0,130,9,78,0,190,12,66,0,120,10,209,0,130,9,57,0,195,9,130,0,130,14,66,0,
+120,7,73,0,130,18,186,0,120,12,149,0,130,12,15,0,182,8,40,0,200,10,200,0,
+130,8,205,0,195,10,89,0,130,13,166,0,120,10,52,0,120,10,253,0,130,14,163,
+0,130,12,100,0,190,15,89,0,120,11,239,0,200,1,219,253,101,1,219,252,57,0,
+0,252,225,0,0,251,102,4,111,254,135,4,111,252,167,7,80,254,135,7,80,252,172,
+2,170,0,211,3,68,0,117,4,121,0,51,7,43,0,92,1,195,0,117,2,197,0,117,2,197,
+0,66,4,0,0,84,4,121,0,133,2,0,0,61,2,123,0,51,2,0,0,127,2,78,0,0,4,121,0,
+92,4,121,0,135,4,121,0,104,4,121,0,119,4,121,0,35,4,121,0,113,4,121,0,125,
+4,121,0,121,4,121,0,94,4,121,0,104,2,74,0,166,2,74,0,98,4,121,0,133,4,121,
+0,133,4,121,0,133,4,0,0,88,2,225,0,205,2,78,0,0,2,225,0,76,4,121,0,104,3,
+172,255,246,3,109,0,102,4,121,1,254,3,109,0,102,4,121,0,111,2,123,0,51,4,
+0,255,246,8,0,255,246,2,0,0,115,2,0,0,61,3,154,0,115,3,154,0,61,6,221,0,164,
+4,121,0,145,4,121,0,133,4,121,0,133,3,51,0,86,0,82,0,33,0,86,0,82,0,33,0,
+0,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,142,0,0,0,82,0,64,0,5,0,18,0,0,0,13,0,35,
+0,37,0,63,0,95,0,126,0,160,0,173,0,179,0,215,0,247,9,101,11,131,11,138,11,
+144,11,149,11,154,11,156,11,159,11,164,11,170,11,185,11,194,11,200,11,205,
+11,208,11,215,11,250,32,13,32,20,32,25,32,29,32,38,32,116,32,132,32,185,34,
+18,37,204,254,255,255,255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,123,0,160,0,
+173,0,178,0,215,0,247,9,100,11,130,11,133,11,142,11,146,11,153,11,156,11,
+158,11,163,11,168,11,174,11,190,11,198,11,202,11,208,11,215,11,230,32,11,
+32,19,32,24,32,28,32,38,32,116,32,130,32,185,34,18,37,204,254,255,255,255,
+0,1,255,245,0,0,0,105,0,104,0,77,0,50,255,99,0,4,0,10,255,226,255,195,246,
+233,244,178,244,127,244,124,0,0,244,132,244,146,244,129,244,126,0,0,0,0,244,
+82,244,79,0,0,244,103,244,68,244,82,224,69,224,159,224,156,224,154,224,146,
+224,74,224,61,223,150,222,169,218,135,1,81,0,1,0,0,0,0,0,78,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,56,0,60,0,0,
+0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+0,139,0,140,0,141,0,13,0,14,0,15,0,28,0,35,0,45,0,36,0,37,0,38,0,39,0,44,
+0,40,0,43,0,42,0,41,0,47,0,48,0,49,0,50,0,24,0,25,0,26,0,54,0,0,0,0,0,21,
+0,21,0,21,0,21,0,122,1,10,1,171,1,225,2,46,2,188,2,253,3,67,3,205,4,98,5,
+0,5,221,5,242,6,23,6,81,6,116,6,198,7,12,7,99,7,217,7,233,7,249,8,9,8,17,
+8,86,8,141,8,194,9,59,9,75,9,226,10,50,10,111,10,130,10,177,10,217,10,244,
+11,80,11,162,12,8,12,86,12,158,13,10,13,160,13,225,14,95,14,208,15,92,15,
+250,16,32,16,135,16,157,17,88,17,135,17,211,18,18,18,70,18,127,18,221,19,
+42,19,50,19,134,19,242,20,48,20,88,20,201,21,22,21,149,22,76,22,139,23,16,
+23,176,24,53,24,187,24,200,24,212,25,10,25,10,25,23,25,53,26,59,26,110,26,
+233,27,119,27,221,28,31,28,96,28,182,29,71,29,200,30,107,30,202,31,4,31,62,
+31,185,32,16,32,213,33,61,33,138,33,162,33,246,34,33,34,107,34,244,35,72,
+35,177,36,50,36,143,37,39,37,147,38,6,38,115,38,247,39,94,40,44,40,157,40,
+243,41,65,41,174,42,17,42,112,43,2,43,144,44,18,44,168,45,13,45,174,46,74,
+46,109,46,150,46,205,47,5,47,40,47,74,47,156,47,237,48,4,48,25,48,81,48,160,
+48,173,48,206,48,239,49,23,49,47,49,77,49,90,49,106,49,120,49,166,49,204,
+49,255,50,60,50,107,50,161,50,217,50,241,51,60,51,123,51,149,51,190,51,210,
+51,230,51,251,52,44,52,69,52,82,52,107,52,127,52,140,52,192,52,205,53,1,53,
+44,53,52,53,65,53,78,53,109,53,140,53,195,53,250,54,33,54,67,54,101,54,114,
+54,161,54,220,55,8,55,17,55,26,55,35,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,
+0,0,19,33,17,33,37,17,33,17,193,3,73,252,183,2,225,253,135,5,182,250,74,104,
+4,230,251,26,0,3,0,80,254,105,9,201,4,120,0,41,0,53,0,64,0,0,1,17,35,17,33,
+6,0,33,34,36,38,53,52,54,51,33,54,53,52,38,38,39,22,22,21,20,6,35,34,38,53,
+52,36,51,50,4,18,21,20,7,33,17,1,52,38,39,6,6,21,20,22,51,50,54,1,33,34,6,
+21,20,22,4,51,32,36,9,201,194,254,127,98,253,248,254,135,247,254,123,215,
+93,89,5,221,19,125,213,127,73,99,170,134,141,187,1,1,207,183,1,43,175,18,
+1,95,252,16,61,55,95,115,92,74,78,82,1,165,250,83,40,31,195,1,79,201,1,45,
+1,150,4,110,249,251,2,135,233,254,255,140,212,100,69,79,75,88,152,233,130,
+6,38,141,82,118,149,161,122,159,196,153,254,225,191,86,77,3,16,254,169,65,
+126,39,23,123,92,81,86,96,254,40,27,27,66,154,106,199,0,0,3,0,80,252,117,
+11,166,4,120,0,75,0,87,0,98,0,0,5,20,2,4,35,34,38,38,53,52,54,55,23,6,6,21,
+20,22,51,50,36,54,53,52,38,35,34,6,7,21,35,17,33,6,0,33,34,36,38,53,52,54,
+51,33,54,53,52,38,38,39,22,22,21,20,6,35,34,38,53,52,36,51,50,4,18,21,20,
+7,33,17,51,17,54,51,50,22,1,52,38,39,6,6,21,20,22,51,50,54,1,33,34,6,21,20,
+22,4,51,32,36,11,166,232,254,132,213,145,246,150,154,153,26,106,112,213,178,
+163,1,54,197,73,70,45,78,21,194,254,127,98,253,248,254,135,247,254,123,215,
+93,89,5,221,19,125,213,127,73,99,170,134,141,187,1,1,207,183,1,43,175,18,
+1,95,194,81,137,127,132,249,113,61,55,95,115,92,74,78,82,1,165,250,83,40,
+31,195,1,79,201,1,45,1,150,241,199,254,209,164,72,152,113,112,149,23,110,
+11,98,74,100,118,136,249,160,84,95,46,42,246,2,135,233,254,255,140,212,100,
+69,79,75,88,152,233,130,6,38,141,82,118,149,161,122,159,196,153,254,225,191,
+86,77,3,16,251,139,100,180,3,110,65,126,39,23,123,92,81,86,96,254,40,27,27,
+66,154,106,199,0,5,0,100,253,160,7,173,6,162,0,65,0,77,0,85,0,95,0,105,0,
+0,37,17,16,0,33,34,4,2,21,16,19,54,33,50,23,54,53,52,2,35,35,22,22,21,20,
+6,35,34,38,53,52,54,54,51,32,0,17,20,7,22,22,21,20,6,35,34,39,6,33,34,38,
+53,52,54,55,38,2,53,52,18,36,51,32,0,17,17,1,6,6,21,20,22,51,50,54,53,52,
+38,1,22,23,54,19,38,35,34,5,2,7,22,51,50,54,53,52,38,1,38,39,6,6,21,20,22,
+51,50,7,53,254,89,254,120,202,254,174,205,192,223,1,15,190,181,45,211,192,
+18,96,98,167,131,125,179,126,210,125,1,6,1,46,66,170,201,224,191,243,242,
+235,254,242,177,206,144,127,109,121,236,1,150,247,1,208,1,215,251,163,77,
+93,79,66,75,76,68,254,151,182,249,228,106,164,175,223,2,216,134,254,165,155,
+152,185,145,253,45,249,185,95,109,152,127,199,176,1,194,1,172,1,204,158,254,
+179,251,254,198,254,191,89,46,170,186,239,1,3,39,145,84,115,144,160,115,115,
+164,83,254,160,254,210,188,180,70,221,145,136,158,123,123,164,140,125,198,
+69,175,1,129,193,244,1,135,222,253,229,253,235,254,62,3,65,29,119,83,71,88,
+90,77,64,121,252,86,254,146,152,1,37,38,91,254,231,169,73,103,110,103,156,
+254,116,155,250,55,145,86,95,100,0,3,0,200,0,0,5,174,4,110,0,9,0,21,0,33,
+0,0,19,33,21,33,17,35,17,33,17,35,1,52,54,51,50,22,21,20,6,35,34,38,37,52,
+54,51,50,22,21,20,6,35,34,38,200,4,230,254,127,194,253,218,125,1,34,64,46,
+46,64,64,46,46,64,2,232,64,46,46,64,64,46,46,64,4,110,110,252,0,4,0,252,0,
+2,28,44,64,64,44,44,64,64,44,44,64,64,44,44,64,64,0,0,2,0,100,0,0,8,17,4,
+120,0,40,0,52,0,0,37,21,33,34,38,53,52,54,51,33,50,54,53,52,38,39,22,22,21,
+20,6,35,34,38,53,52,36,51,32,4,21,20,4,35,33,34,6,21,20,22,51,1,52,38,39,
+6,6,21,20,22,51,50,54,8,17,249,42,99,116,116,99,1,211,175,191,222,182,73,
+99,170,134,141,187,1,9,217,1,9,1,57,254,225,245,254,0,35,45,45,35,1,174,61,
+55,95,115,92,74,78,82,110,110,102,91,91,102,169,159,137,176,7,38,142,81,118,
+149,161,122,161,194,247,208,190,223,45,38,38,45,2,169,65,126,39,23,123,92,
+81,86,96,0,4,0,100,0,0,13,187,4,120,0,40,0,77,0,89,0,101,0,0,37,33,21,33,
+34,38,53,52,54,51,33,50,54,53,52,38,39,22,22,21,20,6,35,34,38,53,52,36,51,
+32,4,21,20,4,35,33,34,6,21,20,22,1,21,35,17,35,17,33,17,35,17,52,38,35,34,
+6,21,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,53,1,52,38,
+39,6,6,21,20,22,51,50,54,5,22,22,51,50,54,53,52,38,35,34,6,1,44,12,143,243,
+128,99,116,116,99,1,211,175,191,222,182,73,99,170,134,141,187,1,9,217,1,9,
+1,57,254,225,245,254,0,35,45,45,12,178,230,194,254,114,194,241,193,168,233,
+2,42,169,93,135,170,184,145,181,221,134,236,146,153,230,66,249,13,61,55,95,
+115,92,74,78,82,3,189,28,116,78,78,98,89,73,74,129,110,110,102,91,91,102,
+169,159,137,176,7,38,142,81,118,149,161,122,161,194,247,208,190,223,45,38,
+38,45,4,0,105,252,215,3,41,252,215,1,140,187,231,219,161,57,91,110,169,134,
+124,161,241,198,140,226,129,119,109,218,254,169,65,126,39,23,123,92,81,86,
+96,226,84,82,101,80,78,91,104,0,2,0,120,255,246,7,90,4,110,0,29,0,41,0,0,
+1,21,33,17,35,17,33,34,4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,
+52,18,36,51,1,22,22,51,50,54,53,52,38,35,34,6,7,90,254,152,194,254,40,175,
+254,233,162,21,36,202,129,143,169,207,163,122,205,123,196,1,75,203,253,229,
+41,117,66,97,118,107,91,94,131,4,110,110,252,0,4,0,119,232,164,90,79,125,
+156,171,143,141,176,121,236,165,200,1,25,141,252,118,63,65,111,88,82,102,
+136,0,0,2,0,120,254,21,7,90,4,110,0,31,0,43,0,0,1,21,33,17,1,39,1,17,33,34,
+4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,1,22,22,51,
+50,54,53,52,38,35,34,6,7,90,254,152,254,27,86,1,121,254,40,175,254,233,162,
+21,36,202,129,143,169,207,163,122,205,123,191,1,71,202,253,239,41,117,66,
+97,118,107,91,94,131,4,110,110,252,28,253,249,84,1,147,4,4,118,232,164,90,
+79,125,156,171,143,141,176,121,236,165,201,1,23,141,252,119,63,65,111,88,
+82,102,136,0,2,0,120,253,161,7,114,4,120,0,87,0,98,0,0,5,20,6,35,34,38,39,
+6,6,35,34,36,53,52,54,36,37,36,36,54,53,52,38,35,34,6,21,17,35,53,52,38,35,
+34,6,21,23,54,54,51,50,22,21,20,6,35,34,38,53,52,54,54,51,50,22,23,54,54,
+51,50,22,21,20,6,4,7,4,4,6,21,20,22,51,50,54,53,53,51,21,20,22,51,32,17,52,
+39,55,22,1,22,51,50,54,53,52,38,35,34,6,7,114,240,220,132,219,45,44,227,165,
+228,254,246,203,1,108,1,20,1,15,1,63,149,132,137,125,154,194,189,168,153,
+200,1,41,147,77,122,148,172,137,152,195,134,234,145,139,230,52,47,214,135,
+208,228,217,254,161,235,254,249,254,181,184,160,149,167,169,194,159,133,1,
+84,125,81,164,249,168,54,124,63,73,74,63,58,97,205,189,213,128,104,111,121,
+210,181,165,193,86,14,13,96,197,169,151,167,170,136,254,223,236,168,190,184,
+146,26,86,79,152,126,109,136,221,174,127,195,107,127,118,117,128,238,209,
+197,231,101,12,14,71,164,146,124,131,159,154,98,69,151,179,1,35,154,129,68,
+177,2,45,110,76,65,70,80,86,0,0,2,0,120,253,75,7,161,4,120,0,94,0,106,0,0,
+1,52,55,39,6,21,20,22,22,51,51,21,35,34,6,6,7,14,2,35,34,38,53,52,54,55,23,
+6,6,21,20,22,51,50,54,54,55,62,2,55,53,38,38,53,52,54,55,23,6,6,21,20,22,
+51,50,54,53,52,2,36,35,34,4,2,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,
+53,52,18,36,51,32,4,18,21,20,6,35,34,38,37,22,22,51,50,54,53,52,38,35,34,
+6,4,229,31,10,95,112,186,105,66,67,80,125,91,65,71,107,155,102,154,202,74,
+82,80,61,55,103,79,67,104,76,54,52,75,103,65,112,135,126,129,115,45,47,87,
+82,104,128,192,254,175,214,209,254,157,212,18,33,205,132,143,169,205,165,
+119,206,125,241,1,151,243,1,2,1,176,252,228,171,134,167,252,81,41,119,65,
+96,119,107,91,97,131,1,24,75,63,8,118,127,100,170,101,110,49,72,63,69,82,
+58,175,133,81,129,65,85,45,89,59,78,92,41,60,52,50,60,45,5,10,51,220,135,
+124,236,91,90,58,129,59,82,104,186,146,183,1,17,146,138,254,252,176,72,60,
+131,163,171,143,140,178,113,216,146,210,1,52,161,186,254,178,212,183,239,
+162,68,58,62,112,88,82,102,141,0,2,0,120,253,55,7,161,4,120,0,102,0,114,0,
+0,1,52,55,39,6,21,20,22,51,51,21,35,34,6,6,7,14,2,35,34,38,53,52,54,54,51,
+50,22,21,20,6,7,38,38,35,34,6,21,20,22,51,50,54,54,55,62,2,55,53,38,38,53,
+52,54,55,23,6,6,21,20,22,51,50,54,53,52,2,36,35,34,4,2,21,20,23,54,54,51,
+50,22,21,20,6,35,34,38,38,53,52,18,36,51,32,4,18,21,20,6,35,34,38,37,22,22,
+51,50,54,53,52,38,35,34,6,4,229,31,10,99,229,158,50,71,71,110,81,57,71,111,
+172,119,164,197,107,162,82,82,108,56,41,19,93,59,64,89,92,93,83,121,82,55,
+47,69,95,62,109,127,131,133,115,45,47,87,82,104,128,192,254,175,214,209,254,
+157,212,18,33,205,132,143,169,205,165,119,206,125,241,1,151,243,1,2,1,176,
+252,228,171,134,167,252,81,41,119,65,96,119,107,91,97,131,1,24,75,63,8,123,
+132,147,214,110,48,71,61,75,93,65,165,137,96,133,66,73,68,37,76,19,51,53,
+75,59,73,86,47,67,57,49,61,45,7,10,50,212,129,128,245,93,90,58,129,59,82,
+104,186,146,183,1,17,146,138,254,252,176,72,60,131,163,171,143,140,178,113,
+216,146,210,1,52,161,186,254,178,212,183,239,162,68,58,62,112,88,82,102,141,
+0,4,0,110,253,75,17,180,4,120,0,94,0,134,0,146,0,158,0,0,1,20,6,35,34,38,
+53,52,55,39,6,21,20,22,22,51,51,21,35,34,6,6,7,14,2,35,34,38,53,52,54,55,
+23,6,6,21,20,22,51,50,54,54,55,62,2,55,53,38,38,53,52,54,55,23,6,6,21,20,
+22,51,50,54,53,52,2,36,35,34,4,2,21,20,23,54,54,51,50,22,21,20,6,35,34,38,
+38,53,52,18,36,51,32,4,18,1,21,33,17,35,17,33,17,35,17,52,36,33,34,6,6,21,
+20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,53,1,22,22,
+51,50,54,53,52,38,35,34,6,5,22,22,51,50,54,53,52,38,35,34,6,7,151,228,171,
+134,167,31,10,95,112,186,105,66,67,80,125,91,65,71,107,155,102,154,202,74,
+82,80,61,55,103,79,67,104,76,54,52,75,103,65,112,135,126,129,115,45,47,87,
+82,104,128,192,254,175,214,209,254,157,212,18,33,205,132,143,169,205,165,
+119,206,125,241,1,151,243,1,2,1,176,252,10,29,254,152,194,254,45,194,254,
+226,254,255,153,249,144,21,36,202,129,143,169,207,163,122,205,123,177,1,46,
+186,188,1,27,83,244,45,41,119,65,96,119,107,91,97,131,7,193,41,117,66,97,
+118,107,91,94,131,1,156,183,239,162,128,75,63,8,118,127,100,170,101,110,49,
+72,63,69,82,58,175,133,81,129,65,85,45,89,59,78,92,41,60,52,50,60,45,5,10,
+51,220,135,124,236,91,90,58,129,59,82,104,186,146,183,1,17,146,138,254,252,
+176,72,60,131,163,171,143,140,178,113,216,146,210,1,52,161,186,254,178,1,
+254,110,252,0,4,0,252,0,2,38,231,253,123,237,164,90,79,125,156,171,143,141,
+176,121,236,165,201,1,29,145,124,117,231,252,110,58,62,112,88,82,102,141,
+114,63,65,111,88,82,102,136,0,1,0,200,0,0,5,65,4,110,0,9,0,0,19,33,21,33,
+17,35,17,33,17,35,200,4,121,254,153,194,254,45,125,4,110,110,252,0,4,0,252,
+0,0,1,253,101,0,0,1,19,6,172,0,24,0,0,19,52,38,35,34,6,21,20,22,51,51,21,
+35,34,38,53,52,54,51,50,22,22,21,17,35,150,216,154,140,175,97,77,10,10,128,
+178,251,190,125,228,148,125,4,81,238,185,120,98,80,96,110,172,129,168,215,
+104,242,194,251,112,0,2,252,225,4,10,0,88,7,14,0,26,0,39,0,0,19,20,6,35,34,
+38,53,52,55,6,6,21,20,22,51,51,21,35,34,38,38,53,52,36,51,50,22,7,52,38,35,
+34,7,6,21,20,22,51,50,54,88,171,130,146,174,29,86,89,155,118,50,50,106,180,
+107,1,4,207,189,231,170,141,117,30,29,32,98,92,69,90,5,204,108,143,160,129,
+69,78,33,139,96,116,151,100,92,168,109,178,225,176,134,93,107,3,79,70,89,
+112,86,0,0,2,253,228,1,182,4,71,4,110,0,10,0,19,0,0,1,17,20,6,35,34,38,53,
+53,33,39,5,33,21,20,22,51,50,54,53,4,71,216,175,168,191,252,239,100,5,161,
+254,81,111,108,93,119,4,110,254,162,156,190,190,167,229,110,110,239,115,121,
+122,94,0,0,2,253,225,0,0,6,236,6,62,0,40,0,49,0,0,1,20,2,4,33,34,36,39,55,
+22,4,51,32,0,17,52,2,36,35,34,4,7,33,17,20,6,35,34,38,53,53,33,39,33,54,54,
+36,51,50,4,18,5,33,21,20,22,51,50,54,53,6,236,223,254,90,254,223,229,254,
+131,134,81,117,1,96,198,1,98,1,124,118,254,249,207,195,254,248,24,2,108,204,
+163,180,203,252,186,80,3,154,16,152,1,24,196,223,1,86,184,252,183,254,81,
+110,109,93,119,3,73,247,254,131,213,196,185,63,171,163,1,132,1,117,160,1,
+24,177,194,160,254,162,154,191,206,180,199,110,124,211,129,219,254,162,5,
+209,125,141,122,94,0,0,2,0,130,255,247,6,62,6,162,0,30,0,41,0,0,1,17,35,17,
+16,0,33,32,0,17,20,18,23,54,54,51,50,22,21,20,6,35,34,0,2,53,52,18,36,51,
+32,1,22,51,50,54,53,52,38,35,34,6,6,62,125,254,249,254,221,254,197,254,158,
+57,72,18,217,154,150,172,207,163,223,254,249,104,195,1,106,241,2,158,251,
+121,101,145,97,118,103,105,108,135,3,146,252,111,3,145,1,60,1,28,254,120,
+254,160,140,254,234,99,169,210,173,151,141,176,1,2,1,109,181,255,1,155,237,
+250,25,86,111,88,83,111,162,0,0,3,0,130,255,246,4,186,6,162,0,33,0,44,0,55,
+0,0,1,20,6,35,34,36,2,17,16,18,36,51,50,22,21,20,6,35,34,38,38,39,6,2,21,
+20,18,23,62,2,51,50,22,1,34,7,22,22,51,50,54,53,52,38,19,52,38,35,34,6,7,
+22,51,50,54,4,186,207,163,180,254,185,203,203,1,71,180,164,206,170,151,98,
+173,114,9,112,133,133,112,9,114,173,98,151,170,254,107,130,115,13,141,108,
+99,99,118,118,99,99,108,141,13,115,130,97,118,1,51,141,176,207,1,132,1,3,
+1,3,1,132,207,177,140,157,172,95,186,129,97,254,194,203,203,254,194,97,129,
+186,95,172,4,100,77,168,153,113,86,88,111,250,247,86,113,153,168,77,111,0,
+0,3,0,120,255,246,9,249,4,120,0,56,0,67,0,79,0,0,1,20,2,7,39,54,54,53,52,
+0,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,4,6,21,20,23,54,54,
+51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,32,23,54,51,50,4,18,37,6,6,21,
+20,22,51,50,54,53,16,1,22,22,51,50,54,53,52,38,35,34,6,9,249,203,174,44,110,
+115,254,222,245,166,127,144,162,207,171,165,197,115,107,165,235,186,254,203,
+182,19,33,206,131,143,169,207,163,118,207,126,227,1,122,222,1,8,214,182,244,
+204,1,63,179,251,140,99,104,105,104,107,109,250,212,42,119,64,97,118,107,
+91,97,131,2,21,187,254,221,65,80,67,233,133,245,1,30,62,102,254,217,177,182,
+226,236,197,160,1,17,98,80,132,254,174,77,67,130,162,171,143,141,176,113,
+221,154,208,1,45,156,110,110,147,254,236,175,84,249,148,138,177,166,133,1,
+75,254,3,58,62,111,88,82,102,142,255,255,0,130,255,247,16,249,6,162,0,38,
+0,21,0,0,0,39,0,16,11,184,0,0,0,7,0,83,7,6,0,0,255,255,0,130,255,246,15,12,
+6,162,0,38,0,22,0,0,0,39,0,16,9,203,0,0,0,7,0,83,5,40,0,0,255,255,0,130,255,
+247,21,229,6,162,0,39,0,43,11,245,0,0,0,38,0,21,0,0,0,7,0,83,7,6,0,0,255,
+255,0,120,255,247,9,240,4,120,2,6,0,43,0,0,0,3,0,130,255,247,6,92,4,110,0,
+31,0,35,0,46,0,0,1,20,6,35,35,53,51,50,54,53,52,38,35,35,21,20,4,35,34,38,
+53,52,54,55,17,33,21,33,17,51,50,22,1,33,17,33,21,33,34,6,21,20,22,51,50,
+54,53,6,92,207,170,115,83,96,118,153,133,95,254,250,221,194,245,143,126,3,
+245,254,152,92,231,253,252,254,254,178,1,78,254,184,125,143,160,131,142,163,
+1,53,142,172,110,118,92,112,112,130,191,227,190,151,119,161,26,1,240,110,
+254,137,179,2,42,254,137,110,114,98,102,124,152,134,0,1,0,200,255,255,7,106,
+4,110,0,36,0,0,19,33,21,33,17,54,54,51,50,22,21,20,6,7,33,17,51,17,33,53,
+51,50,54,54,53,52,38,35,34,6,21,21,35,17,33,17,35,200,4,18,254,152,23,133,
+84,137,181,168,126,2,46,194,251,70,213,74,160,115,109,85,77,97,194,254,149,
+125,4,110,110,254,125,59,80,180,134,126,199,27,4,0,251,146,110,60,144,117,
+97,120,106,85,56,2,111,251,255,0,0,3,0,130,255,247,5,132,4,110,0,17,0,21,
+0,32,0,0,1,17,33,21,33,21,20,4,35,34,38,53,52,54,55,17,33,21,33,33,17,33,
+21,33,34,6,21,20,22,51,50,54,53,4,28,1,104,254,152,254,250,221,194,245,143,
+126,3,245,253,214,254,178,1,78,254,184,130,145,167,131,145,160,4,0,254,137,
+110,130,191,227,190,151,119,161,26,1,240,110,254,137,110,114,98,111,115,152,
+134,0,0,2,0,130,253,55,9,247,5,95,0,64,0,76,0,0,37,16,0,4,33,32,0,0,17,16,
+18,55,23,6,2,17,16,0,0,33,32,36,18,53,52,38,35,34,6,7,17,35,17,33,34,4,6,
+21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,33,21,33,17,54,
+51,50,18,5,22,22,51,50,54,53,52,38,35,34,6,9,247,254,211,253,246,254,191,
+254,108,253,190,254,217,254,230,67,218,218,1,57,2,15,1,56,1,20,1,180,248,
+127,111,59,85,21,194,254,40,175,254,233,162,21,36,202,129,143,169,207,163,
+122,205,123,196,1,75,203,4,8,254,152,81,138,170,208,248,240,41,117,66,97,
+118,107,91,94,131,242,254,231,254,77,239,1,77,2,29,1,53,1,60,1,199,134,94,
+126,254,112,254,227,254,187,254,25,254,251,200,1,120,255,165,192,59,50,254,
+36,4,0,119,232,164,90,79,125,156,171,143,141,176,121,236,165,200,1,25,141,
+110,254,97,98,255,0,223,63,65,111,88,82,102,136,0,1,0,200,0,0,7,30,4,110,
+0,5,0,0,19,51,17,33,21,33,200,194,5,148,249,170,4,110,252,0,110,0,0,4,0,120,
+255,246,13,233,4,120,0,69,0,80,0,92,0,104,0,0,1,33,17,35,17,35,34,7,22,18,
+21,20,6,35,34,38,53,52,18,55,38,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,
+38,35,34,4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,32,
+23,54,33,32,23,54,33,33,5,6,6,21,20,22,51,50,54,53,16,37,6,6,21,20,22,51,
+50,54,53,52,38,1,22,22,51,50,54,53,52,38,35,34,6,13,233,254,152,194,149,205,
+163,127,143,208,168,166,197,133,120,164,221,191,152,136,153,207,171,168,194,
+125,115,170,248,186,254,203,182,19,33,206,131,143,169,207,163,118,207,126,
+227,1,122,222,1,19,223,205,1,11,1,2,216,205,1,6,2,191,247,172,105,114,104,
+105,107,109,2,219,111,119,109,105,100,111,101,247,155,42,119,64,97,118,107,
+91,97,131,4,0,252,0,4,0,84,107,254,217,165,171,212,224,188,150,1,19,103,104,
+75,102,254,225,172,182,226,220,193,165,1,21,100,89,132,254,174,77,67,130,
+162,171,143,141,176,113,221,154,208,1,45,156,120,120,132,122,250,86,252,151,
+136,159,166,133,1,62,142,92,246,120,132,169,145,131,145,248,253,220,58,62,
+111,88,82,102,142,0,0,3,0,130,254,3,6,92,4,110,0,38,0,42,0,53,0,0,37,20,4,
+33,33,34,6,21,34,53,52,54,51,33,32,36,53,52,38,35,35,21,20,4,35,34,38,53,
+52,54,55,17,33,21,33,17,51,50,4,1,33,17,33,21,33,34,6,21,20,22,51,50,54,53,
+6,92,254,150,254,156,254,161,123,110,182,188,156,1,110,1,53,1,19,183,148,
+55,254,250,221,194,245,143,126,3,245,254,152,55,230,1,35,252,254,254,178,
+1,78,254,184,130,145,167,131,145,160,201,243,245,96,126,143,100,79,211,183,
+147,185,130,191,227,190,151,119,161,26,1,240,110,254,137,249,2,112,254,137,
+110,114,98,111,115,152,134,0,1,0,200,254,3,6,36,4,110,0,39,0,0,19,52,54,51,
+51,36,36,53,52,38,35,34,6,21,17,35,17,33,17,35,17,33,21,33,17,54,54,51,50,
+22,21,16,0,33,35,34,6,21,34,38,200,188,156,221,1,71,1,28,120,104,84,107,194,
+254,122,125,4,55,254,142,18,138,89,167,199,254,124,254,149,206,123,110,88,
+94,254,146,100,79,2,215,240,158,157,120,91,254,138,4,0,252,0,4,110,110,254,
+46,63,86,225,190,254,236,254,209,96,126,72,0,0,1,0,200,0,0,6,104,4,110,0,
+7,0,0,19,51,17,33,17,51,17,33,200,194,4,28,194,250,96,4,110,252,0,4,0,251,
+146,0,0,2,0,200,0,0,6,226,4,120,0,15,0,28,0,0,19,51,17,33,17,52,54,51,50,
+22,18,21,16,6,35,33,37,50,54,54,53,52,38,38,35,34,6,21,17,200,194,2,16,200,
+170,132,214,124,168,180,251,66,4,171,106,105,31,94,144,75,95,113,4,110,252,
+0,2,158,166,198,152,254,221,201,254,243,231,110,95,160,131,172,239,117,118,
+123,253,95,0,1,0,190,255,246,7,8,4,110,0,24,0,0,19,17,51,17,20,22,51,50,54,
+53,17,51,17,33,17,51,17,33,53,14,2,35,34,38,190,190,96,77,89,102,190,2,160,
+194,251,236,11,64,106,69,150,166,1,88,3,22,252,199,91,103,118,95,3,38,252,
+0,4,0,251,146,145,29,72,54,179,0,0,1,0,200,254,21,5,29,4,110,0,11,0,0,1,1,
+17,33,17,35,17,33,21,33,17,1,1,122,1,121,254,82,125,4,85,254,152,254,27,254,
+105,1,147,4,4,252,0,4,110,110,252,28,253,249,0,2,0,120,255,247,7,237,4,120,
+0,49,0,61,0,0,1,20,2,6,35,34,38,53,17,52,38,35,34,0,17,20,23,54,54,51,50,
+22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,22,21,17,20,22,51,50,54,54,53,
+16,39,55,22,1,22,22,51,50,54,53,52,38,35,34,6,7,237,117,216,142,169,201,229,
+190,241,254,228,19,33,206,131,143,169,207,163,118,207,126,171,1,45,192,169,
+1,14,155,95,103,100,157,86,197,77,230,249,74,42,119,64,97,118,107,91,97,131,
+2,59,153,254,250,156,194,161,1,44,171,208,254,209,254,255,77,67,130,162,171,
+143,141,176,113,221,154,207,1,44,158,123,224,145,254,212,119,112,126,216,
+129,1,42,180,74,220,253,65,58,62,111,88,82,102,142,0,0,2,0,120,255,247,8,
+116,4,120,0,40,0,52,0,0,1,17,33,39,54,54,53,52,38,38,35,32,0,17,20,23,54,
+54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,18,21,20,7,33,17,1,22,
+22,51,50,54,53,52,38,35,34,6,8,116,252,99,37,73,94,143,247,152,254,241,254,
+196,19,33,206,131,143,169,207,163,118,207,126,189,1,77,212,197,1,69,189,180,
+2,73,249,133,42,119,64,97,118,107,91,97,131,4,110,251,146,88,69,218,151,146,
+232,130,254,209,254,255,77,67,130,162,171,143,141,176,113,221,154,207,1,44,
+158,152,254,235,180,241,184,4,0,252,111,58,62,111,88,82,102,142,0,0,2,0,200,
+253,24,6,226,4,120,0,58,0,71,0,0,33,33,22,33,51,21,35,34,6,6,7,14,2,35,34,
+38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,51,50,54,54,55,62,2,55,53,38,38,
+39,33,17,51,17,33,17,52,54,51,50,22,18,21,16,6,39,50,54,54,53,52,38,38,35,
+34,6,21,17,5,134,254,215,16,1,32,177,147,72,114,86,61,74,112,167,112,164,
+207,169,127,154,103,70,73,104,83,103,123,99,65,102,74,51,52,75,106,68,115,
+169,10,253,45,194,2,16,200,170,132,214,124,168,199,106,105,31,94,144,75,95,
+113,240,110,46,69,60,72,86,61,176,140,122,164,113,77,80,100,82,85,107,43,
+62,53,54,65,49,5,10,6,163,116,4,110,252,0,2,158,166,198,152,254,221,201,254,
+243,231,110,95,160,131,172,239,117,118,123,253,95,0,0,2,0,120,255,247,9,240,
+4,120,0,39,0,51,0,0,1,21,33,17,35,17,33,17,35,17,52,36,33,34,6,6,21,20,23,
+54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,53,1,22,22,51,50,
+54,53,52,38,35,34,6,9,240,254,152,194,254,45,194,254,226,254,255,153,249,
+144,21,36,202,129,143,169,207,163,122,205,123,177,1,46,186,188,1,27,83,251,
+252,41,117,66,97,118,107,91,94,131,4,110,110,252,0,4,0,252,0,2,38,231,253,
+123,237,164,90,79,125,156,171,143,141,176,121,236,165,201,1,29,145,124,117,
+231,252,119,63,65,111,88,82,102,136,0,1,0,190,254,3,6,143,4,120,0,47,0,0,
+19,52,33,33,32,0,17,16,38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,52,
+54,51,50,22,23,54,54,51,50,22,18,21,16,2,4,35,33,34,6,21,34,38,190,1,88,1,
+65,1,35,1,77,165,143,107,137,194,95,91,82,98,125,168,140,120,139,29,42,181,
+113,193,225,87,208,254,149,237,254,246,123,110,83,99,254,146,185,1,75,1,94,
+1,38,240,133,104,252,227,3,31,108,126,112,96,252,199,3,58,144,173,113,65,
+80,99,192,254,220,171,254,248,254,163,167,94,124,71,0,3,0,120,255,246,10,
+139,4,120,0,49,0,60,0,72,0,0,1,33,17,35,17,35,34,7,22,18,21,20,6,35,34,38,
+53,52,18,55,38,33,34,4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,32,23,54,33,33,1,6,6,21,20,22,51,50,54,53,16,1,22,22,51,50,54,53,
+52,38,35,34,6,10,139,254,152,194,206,210,162,131,147,207,171,168,194,130,
+119,177,254,252,186,254,203,182,19,33,206,131,143,169,207,163,118,207,126,
+227,1,122,222,1,35,229,213,1,31,2,220,251,28,109,118,104,105,107,109,250,
+202,42,119,64,97,118,107,91,97,131,4,0,252,0,4,0,77,102,254,231,166,182,226,
+220,193,164,1,16,98,97,132,254,174,77,67,130,162,171,143,141,176,113,221,
+154,208,1,45,156,131,121,254,251,84,245,149,136,159,166,133,1,53,254,25,58,
+62,111,88,82,102,142,0,2,0,120,253,161,7,107,4,120,0,96,0,107,0,0,1,20,6,
+35,34,39,55,22,51,50,54,53,52,38,35,34,6,6,7,14,2,35,34,38,53,52,54,36,37,
+36,36,54,53,52,38,35,34,6,21,17,35,53,52,38,35,34,6,6,21,23,54,54,51,50,22,
+21,20,6,35,34,38,53,52,36,51,50,22,23,54,54,51,50,22,22,21,20,6,4,7,4,4,6,
+21,20,22,51,50,54,54,55,62,2,51,50,22,1,22,22,51,50,54,53,52,38,35,34,7,107,
+223,167,148,134,38,111,89,106,133,120,115,81,128,96,69,82,126,188,125,204,
+250,228,1,78,1,26,1,19,1,56,152,132,137,125,154,194,189,168,94,162,98,1,41,
+147,78,121,149,174,135,154,194,1,34,224,139,230,52,47,214,135,117,198,123,
+216,254,173,250,254,239,254,199,195,140,128,92,143,105,75,81,122,174,115,
+191,220,249,175,28,95,56,66,70,73,59,140,254,229,141,183,78,80,57,129,104,
+109,129,67,100,87,103,126,89,219,180,181,188,67,25,24,90,185,165,151,167,
+170,136,254,223,236,168,190,77,149,104,28,87,80,154,124,109,136,221,174,189,
+240,127,118,117,128,87,200,160,198,222,93,23,23,57,151,143,133,152,73,105,
+92,100,120,83,192,2,145,57,53,80,61,67,83,0,2,0,190,255,245,8,152,4,110,0,
+29,0,42,0,0,19,17,51,17,20,22,51,50,54,53,17,33,50,22,21,20,2,6,35,34,38,
+53,17,33,17,20,6,35,34,38,1,52,38,38,35,33,17,20,22,51,50,54,54,190,194,142,
+116,146,122,3,164,185,173,144,234,132,165,195,254,212,221,189,204,226,7,93,
+36,109,107,254,213,103,85,83,168,112,1,144,2,222,253,35,155,136,158,162,2,
+192,218,252,199,254,204,168,187,158,2,178,253,174,235,206,216,1,207,121,150,
+85,253,75,115,106,129,253,0,4,0,120,253,161,10,253,4,120,0,57,0,66,0,71,0,
+83,0,0,1,17,33,17,35,17,33,39,54,54,53,52,38,38,35,32,0,17,20,23,54,54,51,
+50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,18,21,20,7,33,17,38,38,53,52,
+54,51,50,22,21,17,54,54,55,5,17,52,38,35,34,6,21,16,1,17,6,7,17,37,22,22,
+51,50,54,53,52,38,35,34,6,10,253,254,19,195,252,138,37,73,94,143,247,152,
+254,241,254,196,19,33,206,131,143,169,207,163,118,207,126,189,1,77,212,197,
+1,69,189,180,2,228,182,207,159,148,122,155,119,194,97,253,163,65,58,73,79,
+3,0,133,165,248,39,42,119,64,97,118,107,91,97,131,2,207,253,49,253,161,2,
+95,88,69,218,151,146,232,130,254,209,254,255,77,67,130,162,171,143,141,176,
+113,221,154,207,1,44,158,152,254,235,180,241,184,1,84,21,214,164,138,157,
+147,113,254,191,14,100,97,214,1,96,59,64,103,84,254,253,254,33,1,174,78,12,
+254,172,111,58,62,111,88,82,102,142,0,2,0,120,255,247,10,210,4,120,0,66,0,
+78,0,0,1,20,2,6,35,34,38,53,17,52,38,35,34,6,21,17,35,17,52,38,38,35,32,0,
+21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,53,52,
+54,51,50,22,21,17,20,22,51,50,54,54,53,16,39,55,22,18,1,22,22,51,50,54,53,
+52,38,35,34,6,10,210,119,226,152,165,205,96,87,96,101,194,145,237,137,254,
+253,254,201,21,36,202,129,143,169,207,163,122,205,123,174,1,56,203,220,1,
+72,62,180,151,154,193,109,89,100,157,86,201,86,129,118,246,101,41,117,66,
+97,118,107,91,94,131,2,59,154,254,251,156,201,164,1,234,83,94,111,94,252,
+197,2,78,144,201,99,254,227,239,90,79,125,156,171,143,141,176,121,236,165,
+196,1,29,150,194,168,58,137,167,179,143,254,52,109,132,126,216,129,1,31,183,
+82,118,254,217,254,10,63,65,111,88,82,102,136,0,2,0,120,253,239,12,204,4,
+120,0,83,0,95,0,0,1,16,0,33,33,34,6,21,34,53,52,33,33,32,36,18,17,16,38,35,
+34,6,21,17,35,17,52,38,35,34,6,21,17,33,39,54,54,53,52,38,38,35,32,0,17,20,
+23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,18,21,20,7,33,17,
+52,54,51,50,22,23,54,54,51,50,22,18,1,22,22,51,50,54,53,52,38,35,34,6,12,
+204,253,237,254,7,249,237,123,110,182,1,88,6,58,1,51,1,123,187,173,135,107,
+137,194,101,92,85,102,253,52,37,73,94,143,247,152,254,241,254,196,19,33,206,
+131,143,169,207,163,118,207,126,189,1,77,212,197,1,69,189,180,1,189,175,140,
+112,135,26,38,204,116,182,224,94,244,107,42,119,64,97,118,107,91,97,131,1,
+218,254,96,254,143,94,124,143,185,127,1,48,1,10,1,35,247,133,104,252,227,
+3,31,107,127,109,99,252,199,88,69,218,151,146,232,130,254,209,254,255,77,
+67,130,162,171,143,141,176,113,221,154,207,1,44,158,152,254,235,180,241,184,
+2,204,142,175,110,68,73,106,191,254,210,254,82,58,62,111,88,82,102,142,0,
+0,6,0,130,253,161,14,110,4,120,0,66,0,75,0,79,0,84,0,95,0,107,0,0,1,17,33,
+17,35,17,33,39,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,55,35,21,
+20,4,35,34,38,53,52,54,55,17,33,21,33,17,33,54,36,51,50,4,22,21,20,7,33,17,
+38,38,53,52,54,51,50,22,21,17,54,54,55,5,17,52,38,35,34,6,21,16,1,33,17,33,
+1,17,6,7,17,1,33,34,6,21,20,22,51,50,54,53,37,35,6,21,20,22,51,50,54,53,52,
+38,14,110,254,19,195,252,228,37,122,243,203,203,122,215,255,194,151,173,203,
+32,253,254,250,221,194,245,143,126,3,245,254,152,1,61,81,1,14,159,159,1,25,
+170,120,2,125,182,207,159,148,122,155,119,194,97,253,163,65,58,73,79,248,
+175,254,178,1,78,10,81,133,165,246,217,254,184,130,145,167,131,145,160,2,
+132,63,41,117,96,89,104,165,2,207,253,49,253,161,2,95,88,118,173,173,205,
+108,5,177,172,131,174,204,172,94,79,130,191,227,190,151,119,161,26,1,240,
+110,254,137,104,114,122,218,136,164,117,1,84,21,214,164,138,157,147,113,254,
+191,14,100,97,214,1,96,59,64,103,84,254,253,1,179,254,137,253,229,1,174,78,
+12,254,172,1,173,114,98,111,115,152,134,152,85,101,113,140,97,83,124,135,
+0,2,255,8,5,17,0,248,6,245,0,11,0,23,0,0,3,52,54,51,50,22,21,20,6,35,34,38,
+37,52,38,35,34,6,21,20,22,51,50,54,248,140,108,109,139,140,108,109,139,1,
+120,72,56,56,72,72,56,56,72,6,3,107,135,136,106,107,135,136,106,58,74,74,
+58,58,74,74,0,6,0,120,0,0,6,192,6,62,0,11,0,23,0,35,0,47,0,59,0,71,0,0,1,
+52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,1,52,54,
+51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,
+34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,2,62,195,155,149,
+200,200,149,154,196,2,31,117,108,100,118,119,99,108,117,252,27,195,155,149,
+200,200,149,154,196,3,141,195,155,149,200,200,149,154,196,254,146,117,108,
+100,118,119,99,108,117,3,141,117,108,100,118,119,99,108,117,4,197,166,211,
+216,161,164,214,211,167,136,141,152,125,127,151,141,253,62,166,211,216,161,
+164,214,211,167,166,211,216,161,164,214,211,167,136,141,152,125,127,151,141,
+137,136,141,152,125,127,151,141,0,1,255,131,5,24,0,125,6,14,0,11,0,0,3,52,
+54,51,50,22,21,20,6,35,34,38,125,73,52,51,74,73,52,51,74,5,147,51,72,71,52,
+51,72,71,0,5,0,120,252,229,7,161,4,120,0,92,0,104,0,116,0,128,0,135,0,0,1,
+52,55,39,6,21,20,22,22,51,51,21,35,34,6,6,7,14,2,35,34,38,38,53,52,55,23,
+6,21,20,22,51,50,54,54,55,62,2,55,53,38,38,53,52,54,55,23,6,21,20,22,51,50,
+54,53,52,2,36,35,34,4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,32,4,0,21,20,6,35,34,38,37,22,22,51,50,54,53,52,38,35,34,6,1,34,
+38,53,52,54,51,50,22,21,20,6,7,21,51,53,52,51,50,22,21,21,33,17,5,51,53,52,
+35,34,21,4,229,31,10,93,115,190,105,130,130,51,85,70,52,81,135,215,148,123,
+229,148,9,115,8,177,146,125,175,106,63,39,52,65,39,126,149,126,127,115,92,
+87,82,103,129,203,254,162,217,201,254,168,204,18,33,205,132,143,169,207,163,
+119,206,125,233,1,139,236,1,2,1,188,1,11,228,171,134,167,252,81,42,118,65,
+97,118,107,91,97,131,1,143,28,41,41,28,28,41,41,168,105,140,62,83,254,32,
+1,24,110,55,55,1,24,75,63,8,116,125,100,173,102,110,47,72,63,98,124,91,81,
+172,129,42,48,26,42,32,119,120,75,103,82,50,59,42,6,10,55,226,138,120,229,
+89,90,119,128,82,104,185,148,190,1,16,140,138,253,163,72,60,131,163,171,143,
+141,176,113,215,146,198,1,43,162,179,254,178,219,183,239,162,89,58,62,111,
+88,82,102,142,253,241,40,26,26,40,40,26,26,40,38,230,85,150,67,83,167,1,56,
+230,100,55,55,0,0,2,0,120,255,246,4,126,4,120,0,13,0,26,0,0,19,52,18,54,51,
+50,22,18,21,16,0,35,34,0,1,52,38,35,34,6,6,21,20,22,51,50,54,120,126,238,
+164,144,229,129,254,232,222,240,254,224,3,66,178,167,116,165,83,197,167,169,
+176,2,55,167,1,6,148,147,254,249,167,255,0,254,191,1,60,1,5,213,239,123,206,
+123,207,245,233,0,0,4,0,130,255,246,6,92,4,110,0,22,0,26,0,37,0,49,0,0,1,
+20,6,35,34,38,39,6,35,34,38,53,52,54,55,17,33,21,33,17,51,50,22,1,33,17,33,
+21,33,34,6,21,20,22,51,50,54,53,5,52,38,35,35,21,20,7,22,51,50,54,6,92,211,
+169,96,156,72,133,222,191,248,143,126,3,245,254,152,92,231,253,252,254,254,
+178,1,78,254,163,117,137,161,137,142,163,2,63,153,133,95,61,102,124,95,121,
+1,53,142,177,58,58,116,191,148,127,160,24,1,238,110,254,137,179,2,42,254,
+137,110,113,99,104,123,153,134,72,112,112,130,128,96,80,116,0,0,2,0,100,0,
+0,7,102,4,120,0,29,0,42,0,0,37,21,33,34,38,53,52,54,51,51,38,53,52,36,51,
+50,4,22,21,20,6,6,35,33,34,6,21,20,22,51,1,51,50,54,53,52,38,35,34,6,21,20,
+22,7,102,249,213,99,116,116,99,111,188,1,27,245,152,1,8,162,143,243,146,254,
+0,35,45,45,35,1,224,2,166,200,218,177,184,211,222,110,110,102,91,91,102,106,
+213,203,236,105,206,144,123,188,102,45,38,38,45,1,20,176,148,147,177,174,
+150,153,171,0,0,1,0,200,255,255,7,18,4,110,0,34,0,0,19,33,21,33,17,54,54,
+51,50,22,21,20,6,7,33,21,33,53,51,50,54,54,53,52,38,35,34,6,21,21,35,17,33,
+17,35,200,4,18,254,152,23,133,84,137,181,168,126,2,152,251,158,213,74,160,
+115,109,85,77,97,194,254,149,125,4,110,110,254,125,59,80,180,134,126,199,
+27,110,110,60,144,117,97,120,106,85,56,2,111,251,255,0,0,3,0,130,255,247,
+6,201,4,110,0,19,0,23,0,34,0,0,1,17,33,21,20,4,35,34,38,53,52,54,55,17,33,
+21,33,17,33,17,5,33,17,33,21,33,34,6,21,20,22,51,50,54,53,6,201,253,83,254,
+250,221,194,245,143,126,3,245,254,152,2,48,253,14,254,178,1,78,254,184,130,
+145,167,131,145,160,4,110,253,173,130,191,227,190,151,119,161,26,1,240,110,
+254,137,1,229,110,254,137,110,114,98,111,115,152,134,0,0,1,0,120,253,161,
+8,102,6,162,0,53,0,0,19,16,18,0,33,32,0,17,52,38,35,34,6,21,17,35,17,33,17,
+35,17,33,21,33,17,54,54,51,50,18,21,20,2,4,33,32,0,2,17,16,18,0,33,32,4,0,
+19,35,2,0,33,32,4,2,245,208,1,141,1,17,1,77,1,105,113,125,83,102,194,254,
+122,125,4,45,254,152,39,124,76,175,205,201,254,111,254,223,254,205,254,57,
+240,239,1,218,1,83,1,17,1,176,1,0,17,125,25,254,77,254,119,254,212,254,96,
+211,2,28,254,226,254,39,254,234,1,106,1,87,169,208,119,92,254,138,4,0,252,
+0,4,110,110,254,70,60,65,254,253,219,233,254,133,224,1,54,2,12,1,57,1,78,
+2,12,1,44,225,254,109,254,254,1,89,1,101,241,254,74,0,3,0,130,255,247,8,114,
+4,110,0,36,0,40,0,51,0,0,1,35,17,35,17,35,34,21,17,35,17,52,35,35,21,20,4,
+35,34,38,53,52,54,55,17,33,21,33,17,51,50,22,23,54,54,51,33,1,33,17,33,21,
+33,34,6,21,20,22,51,50,54,53,8,114,190,190,170,100,190,100,170,254,250,221,
+194,245,143,126,3,245,254,152,190,72,92,11,11,92,72,2,58,250,232,254,178,
+1,78,254,184,130,145,167,131,145,160,2,27,253,229,2,27,100,254,73,1,183,100,
+130,191,227,190,151,119,161,26,1,240,110,254,137,65,60,60,65,1,119,254,137,
+110,114,98,111,115,152,134,0,255,255,0,120,255,246,7,90,4,110,2,6,0,10,0,
+0,0,3,0,80,254,97,9,198,4,120,0,28,0,40,0,51,0,0,1,17,35,17,33,6,0,33,34,
+36,38,53,52,54,51,33,38,53,52,54,54,51,32,0,17,20,7,33,17,1,33,54,53,52,2,
+35,34,6,6,21,20,5,33,34,6,21,20,22,4,51,32,36,9,198,194,254,125,98,253,248,
+254,140,247,254,123,215,93,89,2,130,107,148,254,155,1,24,1,88,21,1,95,251,
+14,2,206,22,239,204,104,190,120,3,27,250,87,40,31,195,1,79,201,1,43,1,147,
+4,110,249,243,2,143,234,255,0,140,212,100,69,79,146,167,142,219,120,254,175,
+254,238,97,86,3,16,252,240,84,99,231,1,14,91,180,119,156,248,27,27,66,154,
+106,198,0,4,0,130,255,216,9,186,4,110,0,46,0,50,0,61,0,73,0,0,1,20,6,7,39,
+54,54,53,52,38,35,34,7,22,4,21,20,6,35,34,38,53,52,55,35,21,20,4,35,34,38,
+53,52,54,55,17,33,21,33,17,33,54,36,51,50,4,22,1,33,17,33,21,33,34,6,21,20,
+22,51,50,54,53,37,35,6,21,20,22,51,50,54,53,52,38,9,186,183,152,45,92,94,
+242,204,203,122,215,1,1,197,151,173,203,32,253,254,250,221,194,245,143,126,
+3,245,254,152,1,61,81,1,14,159,160,1,25,170,249,160,254,178,1,78,254,184,
+130,145,167,131,145,160,2,132,63,41,117,96,89,104,165,1,125,155,202,64,72,
+49,188,100,179,209,108,5,177,172,132,173,204,172,94,79,130,191,227,190,151,
+119,161,26,1,240,110,254,137,104,114,123,222,1,246,254,137,110,114,98,111,
+115,152,134,152,85,101,113,140,97,83,124,135,0,1,0,195,255,246,6,53,6,94,
+0,38,0,0,1,20,2,6,35,34,38,39,6,35,34,38,53,17,51,17,20,22,51,50,54,53,17,
+51,17,20,22,51,50,54,18,53,52,2,36,37,55,4,0,6,53,116,232,165,109,159,43,
+64,203,142,161,194,75,81,79,96,122,124,98,111,183,106,193,254,136,254,244,
+10,1,202,1,238,2,155,175,254,202,192,84,79,163,155,149,3,72,252,160,90,80,
+121,98,3,47,252,192,101,101,145,1,12,176,224,1,102,224,24,111,50,254,11,0,
+1,0,148,0,0,6,245,4,120,0,24,0,0,1,21,33,17,35,17,33,17,35,17,52,38,35,34,
+6,21,17,35,17,52,54,51,50,23,53,6,245,254,153,194,254,45,122,102,82,89,93,
+125,153,133,127,78,4,110,110,252,0,4,0,252,0,3,57,95,114,104,95,252,189,3,
+68,142,166,105,95,0,0,4,0,90,253,184,8,228,4,110,0,54,0,58,0,69,0,80,0,0,
+37,20,4,33,33,34,6,21,34,53,52,33,33,50,54,53,52,38,35,35,21,20,6,35,34,38,
+53,52,54,51,51,53,33,21,20,4,35,34,38,53,52,54,55,17,33,21,33,17,33,21,33,
+21,51,50,22,1,17,33,17,17,33,34,6,21,20,22,51,50,54,53,5,35,34,6,21,20,22,
+51,50,54,53,8,228,254,208,254,227,254,81,123,110,182,1,88,1,190,233,232,134,
+128,5,199,164,137,182,161,141,196,253,135,254,250,221,194,245,143,126,3,245,
+254,152,4,63,254,242,5,207,235,249,0,1,78,254,184,130,145,167,131,145,160,
+3,59,180,95,98,101,77,90,105,36,219,183,94,124,143,185,134,158,112,126,50,
+151,187,146,110,118,124,155,130,191,227,190,151,119,161,26,1,240,110,254,
+137,110,155,183,3,55,254,137,1,119,254,27,114,98,111,115,152,134,113,65,72,
+68,73,103,103,0,0,2,0,120,255,247,7,133,4,120,0,38,0,50,0,0,37,21,33,39,54,
+54,53,52,38,38,35,32,0,17,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,50,4,18,21,20,7,37,22,22,51,50,54,53,52,38,35,34,6,7,133,253,82,
+37,73,94,143,247,152,254,241,254,196,19,33,206,131,143,169,207,163,118,207,
+126,189,1,77,212,197,1,69,189,180,251,206,42,119,64,97,118,107,91,97,131,
+110,110,88,69,218,151,146,232,130,254,209,254,255,77,67,130,162,171,143,141,
+176,113,221,154,207,1,44,158,152,254,235,180,241,184,111,58,62,111,88,82,
+102,142,0,3,0,200,0,0,10,80,7,126,0,62,0,75,0,88,0,0,1,23,7,39,34,6,21,17,
+35,17,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,23,22,18,
+21,16,6,35,33,17,51,17,33,17,52,54,51,50,23,38,53,52,54,55,54,54,51,50,22,
+23,51,54,54,1,20,22,51,50,54,53,52,38,35,34,7,6,3,52,38,38,35,34,6,21,17,
+33,50,54,54,10,57,23,9,28,78,70,180,155,127,155,86,178,205,150,115,127,163,
+6,69,81,68,90,75,93,168,180,251,66,194,2,16,200,170,52,48,56,163,128,50,194,
+128,127,197,37,10,17,126,252,191,82,74,59,70,119,95,32,24,15,43,94,144,75,
+95,113,1,23,106,105,31,7,126,1,91,2,115,94,254,63,1,143,112,135,102,5,163,
+149,105,132,185,144,43,40,35,127,85,94,131,87,75,254,246,172,254,243,231,
+4,110,252,0,2,158,166,198,12,95,122,123,197,32,101,114,111,94,102,105,254,
+89,99,126,72,63,91,113,4,49,251,220,172,239,117,118,123,253,95,95,160,0,2,
+0,130,253,161,17,45,6,162,0,104,0,116,0,0,1,20,2,6,35,34,38,53,53,16,0,0,
+33,32,0,0,17,16,0,4,33,32,0,17,52,38,35,34,6,7,17,35,17,33,17,35,17,52,36,
+33,34,6,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,
+23,53,33,21,33,17,54,51,50,22,21,16,0,4,33,32,0,0,17,16,0,0,33,32,0,0,17,
+21,20,22,51,50,54,54,53,16,39,55,22,18,1,22,22,51,50,54,53,52,38,35,34,6,
+17,45,119,226,152,167,203,254,121,253,4,253,229,253,245,253,58,254,164,1,
+123,2,159,1,176,2,138,2,173,113,117,59,85,21,194,254,45,194,254,226,254,255,
+153,249,144,21,36,202,129,143,169,207,163,122,205,123,177,1,46,186,188,1,
+27,83,4,181,254,152,81,138,172,199,254,114,253,76,254,72,254,46,253,39,254,
+100,1,109,2,253,2,64,2,71,3,85,1,196,111,87,100,157,86,201,86,129,118,241,
+247,41,117,66,97,118,107,91,94,131,2,59,154,254,251,156,193,162,240,1,31,
+1,194,1,0,254,246,254,44,254,208,254,183,254,39,245,1,146,1,117,142,165,59,
+50,254,37,4,0,252,0,2,38,231,253,123,237,164,90,79,125,156,171,143,141,176,
+121,236,165,201,1,29,145,124,117,231,110,254,96,98,225,191,254,220,254,108,
+202,1,21,2,12,1,100,1,74,2,5,1,45,254,232,254,11,254,187,240,114,117,126,
+216,129,1,39,175,82,118,254,217,254,11,63,65,111,88,82,102,136,0,0,2,0,80,
+253,55,8,161,4,110,0,27,0,38,0,0,5,33,6,4,33,34,36,38,53,52,54,51,33,54,53,
+33,17,51,17,33,17,51,17,20,7,33,17,51,1,33,34,6,21,20,22,4,51,50,36,8,161,
+253,155,79,254,92,254,209,194,254,184,192,93,89,4,145,15,251,34,194,4,28,
+194,15,1,134,194,252,215,251,151,40,31,163,1,16,157,235,1,52,243,224,246,
+116,198,118,69,79,76,87,4,80,252,30,3,226,251,175,86,76,4,243,250,159,27,
+27,82,141,83,188,0,3,0,130,255,246,12,67,4,110,0,68,0,81,0,93,0,0,37,21,33,
+39,54,54,53,52,38,35,34,7,54,51,50,22,21,20,6,35,34,38,53,52,55,6,7,17,35,
+17,33,34,4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,33,
+21,33,17,54,55,54,36,51,50,4,22,21,20,7,1,34,7,6,21,20,22,51,50,54,53,52,
+38,1,22,22,51,50,54,53,52,38,35,34,6,12,67,253,249,37,58,64,243,203,203,123,
+26,22,193,229,194,151,172,199,12,90,77,194,254,40,175,254,233,162,21,36,202,
+129,143,169,207,163,122,205,123,196,1,75,203,4,8,254,152,103,119,75,1,29,
+174,160,1,25,170,128,252,206,56,54,36,117,96,89,104,144,249,44,41,117,66,
+97,118,107,91,94,131,110,110,88,55,159,77,173,205,109,2,192,163,131,174,201,
+175,57,51,48,77,254,163,4,0,119,232,164,90,79,125,156,171,143,141,176,121,
+236,165,200,1,25,141,110,253,218,91,44,122,136,122,218,136,160,121,1,174,
+12,80,95,113,140,97,83,116,144,254,200,63,65,111,88,82,102,136,0,4,0,130,
+253,161,15,118,5,67,0,77,0,87,0,98,0,110,0,0,33,33,17,35,17,33,39,54,54,53,
+52,38,38,35,34,7,22,18,21,20,6,6,35,34,38,53,52,18,55,38,33,34,4,2,21,20,
+23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,33,50,4,23,54,51,50,4,18,
+21,20,6,7,33,38,38,53,52,18,51,50,22,21,17,33,33,17,52,35,34,6,21,20,22,23,
+1,6,2,21,20,22,51,50,54,53,16,1,22,22,51,50,54,53,52,38,35,34,6,15,118,254,
+192,196,251,63,44,112,113,126,246,172,56,45,94,102,112,192,114,186,231,223,
+195,183,254,188,229,254,157,199,21,36,202,129,140,162,197,163,122,205,123,
+231,1,150,1,0,189,1,74,126,98,109,219,1,75,177,102,104,2,145,103,108,235,
+190,174,197,1,64,253,252,188,129,163,157,132,249,162,175,204,136,116,124,
+143,250,96,41,117,66,97,118,107,91,94,131,253,161,2,95,105,94,231,119,136,
+220,129,7,110,254,237,153,143,229,129,246,198,217,1,90,84,158,180,254,183,
+218,90,79,125,156,168,146,143,174,121,236,165,246,1,123,209,118,108,23,165,
+254,237,161,113,212,88,80,254,146,235,1,33,164,167,253,95,2,182,189,231,184,
+170,254,44,3,94,66,254,203,196,140,162,199,176,1,57,253,190,63,65,111,88,
+82,102,136,0,2,0,130,253,161,7,251,7,59,0,76,0,87,0,0,37,20,2,4,33,32,0,2,
+17,16,18,0,55,54,54,51,50,22,21,20,7,33,21,33,39,54,53,52,38,35,34,7,22,22,
+21,20,6,35,34,38,53,52,55,6,2,2,17,16,18,0,33,50,36,18,53,52,38,35,34,6,21,
+17,35,17,33,17,35,17,33,21,33,17,54,54,51,50,18,1,6,21,20,22,51,50,54,53,
+52,38,7,251,211,254,96,254,218,254,200,254,63,231,192,1,75,204,63,172,99,
+170,224,81,1,24,254,69,31,105,155,129,62,49,101,119,138,115,115,132,25,134,
+233,143,199,1,135,1,22,246,1,68,154,113,125,83,102,194,254,122,125,4,45,254,
+152,39,124,76,175,205,251,133,36,54,52,47,57,95,229,232,254,132,224,1,65,
+2,39,1,83,1,73,2,2,1,34,7,51,56,185,140,93,74,110,85,77,108,98,124,16,29,
+136,98,100,123,141,121,64,59,34,254,242,254,71,254,237,254,199,254,13,254,
+223,182,1,61,206,169,208,119,92,254,138,4,0,252,0,4,110,110,254,70,60,65,
+254,253,4,159,58,82,59,83,57,56,63,95,0,2,0,200,254,3,7,201,7,159,0,83,0,
+95,0,0,1,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,51,21,
+33,17,54,54,51,50,22,21,16,0,33,35,34,6,21,34,38,53,52,54,51,51,36,36,53,
+52,38,35,34,6,21,17,35,17,33,17,35,17,33,38,38,53,52,54,55,54,54,51,50,22,
+22,21,20,7,33,21,33,39,54,54,1,7,6,21,20,22,51,50,54,53,52,38,6,237,174,145,
+131,75,160,191,148,104,141,166,5,119,143,109,153,254,142,18,138,89,167,199,
+254,124,254,149,206,123,110,88,94,188,156,221,1,71,1,28,120,104,84,107,194,
+254,122,125,2,160,56,62,155,133,54,197,123,125,213,127,198,1,2,254,54,31,
+149,120,253,220,52,18,78,75,60,71,120,5,234,147,180,64,5,168,134,97,140,177,
+149,29,33,71,152,115,149,110,254,46,63,86,225,190,254,236,254,209,96,126,
+72,71,100,79,2,215,240,158,157,120,91,254,138,4,0,252,0,4,110,50,142,81,123,
+191,38,89,103,110,196,123,219,169,110,85,97,177,1,28,3,55,66,86,114,69,64,
+85,106,0,0,1,0,215,0,0,1,153,4,110,0,3,0,0,19,51,17,35,215,194,194,4,110,
+251,146,0,255,255,0,215,0,0,3,135,4,110,0,34,0,77,0,0,0,3,0,77,1,238,0,0,
+0,1,0,121,0,0,4,61,5,182,0,34,0,0,19,53,51,50,54,55,33,53,33,38,38,35,35,
+53,33,21,33,22,23,51,21,35,2,5,19,22,22,51,51,21,35,34,38,38,39,121,170,182,
+153,11,253,252,2,4,9,146,160,201,3,196,254,160,113,12,227,229,32,254,65,235,
+51,101,63,27,49,133,137,85,47,2,178,58,124,146,96,135,117,96,96,88,164,96,
+254,162,17,254,111,85,79,86,27,75,82,0,0,1,255,213,254,240,0,43,5,6,0,3,0,
+0,3,51,17,35,43,86,86,5,6,249,234,0,0,1,255,33,254,240,0,223,5,133,0,14,0,
+0,3,7,39,55,39,55,23,55,23,7,23,7,39,17,35,43,127,53,168,168,53,170,170,53,
+168,168,53,127,86,4,72,127,55,168,166,55,170,170,55,166,168,55,127,250,168,
+0,0,16,0,98,0,86,4,94,4,82,0,11,0,23,0,35,0,47,0,59,0,71,0,83,0,95,0,107,
+0,119,0,131,0,143,0,155,0,167,0,179,0,191,0,0,1,52,54,51,50,22,21,20,6,35,
+34,38,7,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,
+5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,
+54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,
+50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,
+21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,
+6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,
+34,38,37,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,
+2,43,32,21,22,32,32,22,21,32,172,32,21,22,31,31,22,21,32,1,88,32,21,22,32,
+32,22,21,32,254,16,32,22,21,32,32,21,22,32,2,136,31,22,22,31,31,22,22,31,
+253,24,32,21,22,32,32,22,21,32,3,72,31,22,22,31,31,22,22,31,252,147,32,22,
+21,32,32,21,22,32,3,146,31,22,22,31,31,22,22,31,252,147,32,21,22,32,32,22,
+21,32,3,72,31,22,22,31,31,22,22,31,253,24,32,22,21,32,32,21,22,32,2,136,31,
+22,22,31,31,22,22,31,254,16,32,21,22,31,31,22,21,32,1,88,32,21,22,32,32,22,
+21,32,172,32,21,22,32,32,22,21,32,4,29,21,32,32,21,22,32,32,15,21,32,32,21,
+22,31,31,22,21,32,32,21,22,31,31,74,21,32,32,21,22,32,32,22,21,32,32,21,22,
+32,32,130,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,150,22,31,31,22,22,
+31,31,22,22,31,31,22,22,31,31,150,22,31,31,22,22,31,31,22,22,31,31,22,22,
+31,31,130,22,32,32,22,21,32,32,21,22,32,32,22,21,32,32,75,22,31,31,22,22,
+31,31,22,22,31,31,22,22,31,31,15,22,32,32,22,21,32,32,0,0,2,0,200,253,161,
+7,98,4,110,0,20,0,31,0,0,33,33,17,35,17,33,17,51,17,33,38,2,53,52,18,51,50,
+22,21,17,33,33,17,52,35,34,6,21,20,22,22,51,7,98,254,142,196,251,156,194,
+2,59,117,124,235,190,174,197,1,114,253,202,188,129,163,102,191,127,253,161,
+2,95,4,110,252,0,77,1,11,156,235,1,33,164,167,253,75,2,202,189,231,184,131,
+224,133,0,0,2,0,120,255,247,9,157,6,171,0,74,0,86,0,0,1,17,35,17,52,38,35,
+34,6,21,20,22,22,23,30,2,21,20,0,35,34,38,53,17,52,38,35,34,0,17,20,23,54,
+54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,22,21,17,20,22,51,50,
+54,53,52,38,38,39,46,2,53,52,54,51,50,22,22,1,22,22,51,50,54,53,52,38,35,
+34,6,9,157,125,190,133,125,146,38,57,48,53,64,45,254,247,218,171,209,229,
+190,241,254,228,19,33,206,131,143,169,207,163,118,207,126,171,1,45,192,169,
+1,14,155,112,96,150,187,40,59,50,52,62,43,226,184,111,195,128,247,154,42,
+119,64,97,118,107,91,97,131,4,144,251,112,4,81,250,172,130,112,65,124,105,
+79,87,122,151,84,212,255,0,199,166,1,34,171,208,254,209,254,255,77,67,130,
+162,171,143,141,176,113,221,154,207,1,44,158,123,224,145,254,222,111,130,
+203,162,79,136,108,78,81,114,147,87,173,218,100,241,251,135,58,62,111,88,
+82,102,142,0,0,2,0,120,255,247,12,108,6,171,0,90,0,102,0,0,1,17,35,17,52,
+38,35,34,6,21,20,22,22,23,30,2,21,20,0,35,34,38,53,17,52,38,35,34,6,21,17,
+35,17,52,38,38,35,32,0,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,50,4,23,53,52,54,51,50,22,21,17,20,22,51,50,54,53,52,38,38,39,46,
+2,53,52,54,51,50,22,22,1,22,22,51,50,54,53,52,38,35,34,6,12,108,125,190,133,
+125,146,38,57,48,53,64,45,254,247,218,171,209,96,87,96,101,194,145,237,137,
+254,253,254,201,21,36,202,129,143,169,207,163,122,205,123,174,1,56,203,220,
+1,72,62,180,151,154,193,112,96,150,187,40,59,50,52,62,43,226,184,111,195,
+128,244,203,41,117,66,97,118,107,91,94,131,4,144,251,112,4,81,250,172,130,
+112,65,124,105,79,87,122,151,84,212,255,0,199,166,1,234,83,94,111,94,252,
+197,2,78,144,201,99,254,227,239,90,79,125,156,171,143,141,176,121,236,165,
+196,1,29,150,194,168,58,137,167,179,143,254,52,111,130,203,162,79,136,108,
+78,81,114,147,87,173,218,100,241,251,143,63,65,111,88,82,102,136,0,2,0,200,
+255,255,8,168,7,14,0,59,0,72,0,0,1,20,6,35,34,38,53,52,55,6,6,21,20,22,51,
+51,17,33,53,51,50,54,54,53,52,38,35,34,6,21,21,35,17,33,17,35,17,33,21,33,
+17,54,54,51,50,22,21,20,6,7,33,17,38,38,53,52,36,51,50,22,7,52,38,35,6,7,
+6,21,20,22,51,50,54,8,168,171,130,145,175,30,93,101,159,124,184,251,70,213,
+74,160,115,109,85,77,97,194,254,149,125,4,18,254,152,23,133,84,137,181,168,
+126,2,46,170,223,1,19,210,189,231,170,141,117,28,31,32,98,92,69,90,5,204,
+108,143,157,131,72,77,33,140,96,117,150,251,146,110,60,144,117,97,120,106,
+85,56,2,111,251,255,4,111,110,254,125,59,80,180,134,126,199,27,3,156,3,207,
+159,176,227,176,134,93,107,2,1,79,70,89,112,86,0,0,2,0,200,0,0,7,198,4,120,
+0,30,0,43,0,0,33,33,17,51,17,33,38,2,53,52,0,51,50,22,21,20,6,35,34,38,53,
+52,55,6,6,21,20,22,22,51,33,1,34,7,6,21,20,22,51,50,54,53,52,38,7,198,249,
+2,194,2,153,130,155,1,48,252,185,235,189,144,144,170,36,113,127,126,211,120,
+2,122,253,100,36,40,45,97,97,72,93,132,4,110,252,0,75,1,5,158,245,1,39,191,
+151,123,158,163,139,87,90,46,207,146,127,227,137,3,156,5,101,88,90,109,97,
+76,97,123,0,2,0,200,0,0,7,166,7,14,0,30,0,43,0,0,1,20,6,35,34,38,53,52,55,
+6,6,21,20,22,51,51,17,33,17,51,17,33,17,38,38,53,52,36,51,50,22,7,52,38,35,
+34,7,6,21,20,22,51,50,54,7,166,171,130,145,175,30,93,101,159,124,184,250,
+96,194,4,28,170,223,1,19,210,189,231,170,141,117,27,32,32,98,92,69,90,5,204,
+108,143,157,131,73,76,33,140,96,117,150,251,146,4,110,252,0,3,156,3,207,159,
+176,227,176,134,93,107,3,79,70,89,112,86,0,2,0,190,255,246,8,74,7,14,0,47,
+0,60,0,0,1,20,6,35,34,38,53,52,55,6,6,21,20,22,51,51,17,33,53,14,2,35,34,
+38,53,17,51,17,20,22,51,50,54,53,17,51,17,33,17,38,38,53,52,36,51,50,22,7,
+52,38,35,34,7,6,21,20,22,51,50,54,8,74,171,130,145,175,30,93,101,159,124,
+180,251,236,11,64,106,69,150,166,190,96,77,89,102,190,2,160,169,220,1,19,
+210,189,231,170,141,117,30,29,32,98,92,69,90,5,204,108,143,157,131,73,76,
+33,140,96,117,150,251,146,145,29,72,54,179,175,3,22,252,199,91,103,118,95,
+3,38,252,0,3,156,5,208,156,176,227,176,134,93,107,3,79,70,89,112,86,0,0,3,
+0,120,255,247,8,177,7,14,0,79,0,91,0,103,0,0,1,52,55,6,6,21,20,22,22,23,30,
+2,21,20,6,6,35,34,38,53,17,52,38,35,34,0,17,20,23,54,54,51,50,22,21,20,6,
+35,34,38,38,53,52,18,36,51,50,4,22,21,17,20,22,51,50,54,54,53,52,38,38,39,
+46,2,53,52,54,54,51,50,22,22,21,20,6,35,34,38,19,7,6,21,20,22,51,50,54,53,
+52,38,1,22,22,51,50,54,53,52,38,35,34,6,6,123,29,87,105,64,94,82,97,119,83,
+123,219,139,169,201,229,190,241,254,228,19,33,206,131,143,169,207,163,118,
+207,126,171,1,45,192,169,1,14,155,95,103,85,154,95,70,103,88,93,109,76,110,
+200,130,106,189,119,153,113,134,166,150,28,30,99,79,66,80,145,249,173,42,
+119,64,97,118,107,91,97,131,5,238,80,75,35,156,93,81,130,98,71,85,129,189,
+125,131,220,130,194,161,1,44,171,208,254,209,254,255,77,67,130,162,171,143,
+141,176,113,221,154,207,1,44,158,123,224,145,254,212,119,112,101,173,104,
+98,150,109,75,80,117,168,111,107,183,109,75,154,111,113,150,178,1,59,1,74,
+80,105,133,86,68,109,130,250,61,58,62,111,88,82,102,142,0,3,0,120,255,247,
+9,28,7,14,0,64,0,77,0,89,0,0,1,52,55,6,6,21,20,22,51,33,17,33,39,54,54,53,
+52,38,38,35,32,0,17,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,
+51,50,4,18,21,20,7,33,17,35,34,38,53,52,36,51,50,22,21,20,6,35,34,38,19,6,
+7,6,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,53,52,38,35,34,6,6,175,30,
+93,101,172,141,1,48,252,99,37,73,94,143,247,152,254,241,254,196,19,33,206,
+131,143,169,207,163,118,207,126,189,1,77,212,197,1,69,189,180,2,73,110,194,
+239,1,19,210,189,231,171,130,145,175,193,27,32,32,98,92,69,90,141,249,82,
+42,119,64,97,118,107,91,97,131,5,241,73,76,33,140,96,121,146,251,146,88,69,
+218,151,146,232,130,254,209,254,255,77,67,130,162,171,143,141,176,113,221,
+154,207,1,44,158,152,254,235,180,241,184,3,156,205,164,176,227,176,146,108,
+143,157,1,50,1,2,79,70,89,112,86,67,93,107,250,61,58,62,111,88,82,102,142,
+0,3,0,120,255,247,11,162,7,14,0,93,0,106,0,118,0,0,1,52,55,6,6,21,20,22,22,
+23,30,2,21,20,6,6,35,34,38,53,17,52,38,35,34,6,21,17,35,17,52,38,38,35,32,
+0,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,23,53,52,
+54,51,50,22,21,17,20,22,51,50,54,54,53,52,38,38,39,46,2,53,52,36,51,50,22,
+21,20,6,35,34,38,19,34,7,6,21,20,22,51,50,54,53,52,38,1,22,22,51,50,54,53,
+52,38,35,34,6,9,108,26,85,104,61,92,78,94,114,80,122,219,137,176,211,96,87,
+96,101,194,145,237,137,254,253,254,201,21,36,202,129,143,169,207,163,122,
+205,123,174,1,56,203,220,1,72,62,180,151,154,193,113,99,85,154,95,68,98,85,
+89,106,73,1,10,204,175,209,153,113,135,165,180,26,33,29,99,79,66,80,127,246,
+170,41,117,66,97,118,107,91,94,131,5,237,72,75,37,145,93,81,130,99,70,85,
+129,189,125,131,220,130,200,165,1,234,83,94,111,94,252,197,2,78,144,201,99,
+254,227,239,90,79,125,156,171,143,141,176,121,236,165,196,1,29,150,194,168,
+58,137,167,179,143,254,52,112,129,101,173,104,98,150,109,75,79,118,168,111,
+173,226,185,155,113,150,176,1,61,4,74,78,105,132,86,68,118,121,250,69,63,
+65,111,88,82,102,136,0,3,0,130,253,160,7,234,4,110,0,43,0,47,0,58,0,0,37,
+20,2,4,35,32,36,2,17,52,18,55,23,6,2,21,20,18,4,33,50,36,18,53,52,38,39,21,
+20,4,35,34,38,53,52,54,55,17,33,21,33,17,32,0,1,17,33,17,17,53,33,34,6,21,
+20,22,51,50,54,7,234,229,254,108,252,254,216,254,52,255,143,161,84,132,131,
+224,1,146,1,6,211,1,54,166,190,180,254,250,221,194,245,143,126,3,231,254,
+166,1,9,1,45,251,186,1,78,254,184,125,143,160,131,142,163,110,203,254,184,
+187,238,1,164,1,9,200,1,94,157,82,131,254,203,167,255,254,136,200,155,1,25,
+183,195,207,14,128,191,227,190,151,119,161,26,1,240,110,254,137,254,226,2,
+149,254,137,1,119,253,131,152,114,98,102,124,152,0,1,0,200,253,161,7,106,
+4,110,0,38,0,0,1,17,35,17,33,53,51,50,54,54,53,52,38,35,34,6,21,21,35,17,
+33,17,35,17,33,21,33,17,54,54,51,50,22,21,20,6,7,33,17,7,106,194,252,8,213,
+74,160,115,109,85,77,97,194,254,149,125,4,18,254,152,23,133,84,137,181,168,
+126,2,46,4,110,249,51,2,95,110,60,144,117,97,120,106,85,56,2,111,251,255,
+4,111,110,254,125,59,80,180,134,126,199,27,4,0,0,3,0,130,255,247,6,226,4,
+110,0,21,0,25,0,36,0,0,1,21,35,17,35,17,33,21,20,4,35,34,38,53,52,54,55,17,
+33,21,33,17,3,33,17,33,21,33,34,6,21,20,22,51,50,54,53,6,226,250,190,254,
+242,254,250,221,194,245,143,126,3,245,254,152,194,254,178,1,78,254,184,130,
+145,167,131,145,160,2,137,110,253,229,2,27,130,191,227,190,151,119,161,26,
+1,240,110,254,137,1,119,254,137,110,114,98,111,115,152,134,0,3,0,120,253,
+54,10,99,4,110,0,62,0,74,0,83,0,0,1,33,6,4,33,32,36,38,53,52,54,51,33,54,
+53,52,38,35,34,6,7,17,35,17,33,34,4,6,21,20,23,54,54,51,50,22,21,20,6,35,
+34,38,38,53,52,18,36,51,33,21,33,17,54,51,50,22,22,21,20,7,33,17,51,1,22,
+22,51,50,54,53,52,38,35,34,6,1,33,34,21,20,22,4,51,32,10,99,253,105,131,254,
+28,254,207,254,206,254,79,217,93,89,6,25,62,112,116,59,85,21,194,254,40,175,
+254,233,162,21,36,202,129,143,169,207,163,122,205,123,196,1,75,203,4,8,254,
+152,81,138,117,169,88,73,1,157,194,246,222,41,117,66,97,118,107,91,94,131,
+5,189,250,46,71,202,1,83,194,2,95,254,247,214,235,126,190,95,69,79,151,204,
+167,218,59,50,254,36,4,0,119,232,164,90,79,125,156,171,143,141,176,121,236,
+165,200,1,25,141,110,254,97,98,130,221,134,203,174,5,9,252,118,63,65,111,
+88,82,102,136,253,156,47,65,137,90,0,1,0,130,253,200,7,168,6,162,0,50,0,0,
+1,17,35,17,52,2,36,33,32,0,2,17,16,18,4,51,32,18,17,52,38,35,34,6,21,17,35,
+17,51,17,54,54,51,50,18,17,20,2,4,35,34,0,2,17,16,18,0,33,32,4,18,7,168,125,
+168,254,168,255,0,254,244,254,148,180,167,1,46,198,1,12,239,112,126,81,104,
+194,194,40,125,74,180,200,165,254,196,219,234,254,152,201,213,1,160,1,38,
+1,43,1,152,200,3,22,252,234,3,22,235,1,102,203,254,253,254,48,254,203,254,
+192,254,56,236,1,71,1,43,213,234,115,86,254,98,4,110,253,248,59,64,254,224,
+254,252,224,254,169,190,1,11,1,250,1,93,1,84,2,4,1,32,235,254,102,0,5,0,120,
+253,54,14,218,4,120,0,89,0,101,0,112,0,124,0,134,0,0,1,33,6,4,33,32,36,36,
+53,52,54,51,33,54,17,16,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,
+34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,4,6,21,20,23,54,54,51,50,
+22,21,20,6,35,34,38,38,53,52,18,36,51,32,23,54,33,50,23,54,51,50,4,18,21,
+16,7,33,17,51,5,6,6,21,20,22,51,50,54,53,52,2,37,6,6,21,20,22,51,50,54,53,
+16,1,22,22,51,50,54,53,52,38,35,34,6,1,33,34,21,20,4,4,51,32,36,14,218,252,
+249,235,252,233,254,27,254,148,253,125,254,123,93,89,10,24,223,218,194,128,
+107,142,156,213,168,165,193,117,105,140,192,203,159,135,151,207,171,168,194,
+127,116,171,250,186,254,203,182,19,33,206,131,143,169,207,163,118,207,126,
+227,1,122,222,1,22,223,209,1,25,229,187,155,188,193,1,20,142,183,1,227,194,
+250,74,97,107,104,105,107,109,112,252,6,106,115,104,105,107,109,250,212,42,
+119,64,97,118,107,91,97,131,9,136,246,111,71,1,153,2,49,200,1,170,2,186,254,
+247,225,224,106,188,117,69,79,240,1,99,1,24,1,58,51,105,254,201,180,175,222,
+232,198,158,1,28,101,71,78,101,254,226,171,182,226,220,193,167,1,19,99,90,
+132,254,174,77,67,130,162,171,143,141,176,113,221,154,208,1,45,156,122,122,
+95,95,189,254,178,213,254,188,239,5,9,232,85,254,146,141,176,162,131,160,
+1,7,66,85,249,153,136,159,166,133,1,62,254,16,58,62,111,88,82,102,142,253,
+161,47,81,133,78,166,0,4,0,130,253,54,8,182,4,110,0,43,0,47,0,58,0,68,0,0,
+1,33,6,4,33,34,36,38,53,52,54,51,33,54,53,52,2,35,35,21,20,4,35,34,38,53,
+52,54,55,17,33,21,33,17,51,50,4,18,21,20,7,33,17,51,5,17,33,17,17,33,34,6,
+21,20,22,51,50,54,53,1,33,34,21,20,22,22,51,50,36,8,182,253,166,97,254,77,
+254,236,201,254,196,173,93,89,4,134,26,239,190,5,254,250,221,194,245,143,
+126,3,245,254,152,2,181,1,32,163,27,1,111,194,249,96,1,78,254,184,125,143,
+160,131,142,163,2,48,251,178,71,155,245,126,226,1,82,254,247,207,242,129,
+192,90,69,79,93,106,220,1,19,130,191,227,190,151,119,161,26,1,240,110,254,
+137,147,254,239,184,106,94,5,9,110,254,137,1,119,254,27,114,98,102,124,152,
+134,253,116,47,78,135,80,177,0,2,0,185,253,161,8,62,4,110,0,41,0,49,0,0,1,
+33,6,4,33,34,36,53,52,54,51,33,54,53,16,35,34,6,21,17,35,17,33,17,35,17,33,
+21,33,17,54,54,51,50,22,22,21,20,7,33,17,51,1,33,34,21,20,4,51,32,8,62,253,
+136,96,254,152,254,250,241,254,178,88,81,3,208,59,234,78,103,194,254,122,
+125,4,45,254,152,18,138,89,114,166,86,56,1,130,195,252,184,252,120,62,1,19,
+178,1,95,254,250,168,177,183,132,65,75,145,187,1,149,122,89,254,138,4,0,252,
+0,4,110,110,254,46,63,86,136,231,138,198,156,5,6,250,140,45,73,117,0,0,1,
+0,200,253,161,6,123,4,110,0,9,0,0,1,3,33,17,51,17,33,3,51,19,5,185,7,251,
+22,194,4,39,11,194,19,253,161,2,95,4,110,252,0,4,0,249,51,0,0,2,0,130,253,
+161,9,146,4,121,0,37,0,50,0,0,1,16,6,35,33,16,0,33,32,0,2,17,52,18,55,23,
+6,2,21,20,18,4,51,32,0,53,33,17,51,17,33,17,52,54,51,50,22,18,7,52,38,38,
+35,34,6,21,17,33,50,54,54,9,146,168,180,254,214,254,132,254,177,254,229,254,
+75,239,133,143,93,125,119,204,1,117,242,1,0,1,24,253,46,194,2,16,200,170,
+132,214,124,125,94,144,75,95,113,1,23,106,105,31,1,244,254,243,231,254,227,
+254,190,1,10,1,203,1,22,226,1,91,165,77,146,254,196,206,247,254,107,234,1,
+2,239,4,110,252,0,2,158,166,199,152,254,220,205,172,239,117,118,123,253,95,
+95,160,0,1,0,190,253,161,7,8,4,110,0,26,0,0,1,17,35,17,33,53,14,2,35,34,38,
+53,17,51,17,20,22,51,50,54,53,17,51,17,33,17,7,8,194,252,174,11,64,106,69,
+150,166,190,96,77,89,102,190,2,160,4,110,249,51,2,95,145,29,72,54,179,175,
+3,22,252,199,91,103,118,95,3,38,252,0,4,0,0,0,1,0,130,253,160,8,179,4,114,
+0,43,0,0,37,16,0,4,33,32,0,0,17,52,18,55,23,2,17,20,18,4,33,50,36,18,53,16,
+35,34,6,21,17,35,17,33,17,35,17,33,21,33,17,54,54,51,50,22,8,179,254,250,
+254,52,254,220,254,181,254,20,254,252,115,118,106,214,227,1,180,1,44,226,
+1,113,214,226,83,102,194,254,45,194,4,191,254,152,39,124,76,184,188,247,254,
+244,254,126,201,1,27,1,220,1,27,178,1,103,167,75,254,215,254,174,253,254,
+90,251,177,1,77,222,1,95,119,92,254,138,4,0,252,0,4,110,110,254,70,60,65,
+247,0,3,0,120,253,55,9,199,4,120,0,70,0,82,0,93,0,0,1,33,6,4,33,34,36,38,
+53,52,54,51,33,54,53,53,38,38,53,17,52,38,35,34,0,17,20,23,54,54,51,50,22,
+21,20,6,35,34,38,38,53,52,18,36,51,50,4,22,21,17,20,22,51,50,54,54,53,16,
+39,55,22,17,20,2,7,21,20,7,33,17,51,1,22,22,51,50,54,53,52,38,35,34,6,1,33,
+34,6,21,20,22,22,51,50,36,9,199,252,133,78,254,113,254,236,188,254,203,177,
+93,89,4,60,10,125,152,229,190,241,254,228,19,33,206,131,143,169,207,163,118,
+207,126,171,1,45,192,169,1,14,155,95,103,100,157,86,197,77,230,208,166,12,
+2,154,194,247,112,42,119,64,97,118,107,91,97,131,4,73,251,234,40,31,143,253,
+156,223,1,28,254,229,202,228,118,183,91,69,79,57,71,54,25,178,143,1,44,171,
+208,254,209,254,255,77,67,130,162,171,143,141,176,113,221,154,207,1,44,158,
+123,224,145,254,212,119,112,126,216,129,1,42,180,74,220,254,159,210,254,200,
+38,57,66,61,5,27,252,111,58,62,111,88,82,102,142,253,143,27,27,60,124,82,
+166,0,2,0,120,253,161,8,116,4,120,0,42,0,54,0,0,1,17,35,17,33,39,54,54,53,
+52,38,38,35,32,0,17,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,
+51,50,4,18,21,20,7,33,17,1,22,22,51,50,54,53,52,38,35,34,6,8,116,194,253,
+37,37,73,94,143,247,152,254,241,254,196,19,33,206,131,143,169,207,163,118,
+207,126,189,1,77,212,197,1,69,189,180,2,73,249,133,42,119,64,97,118,107,91,
+97,131,4,110,249,51,2,95,88,69,218,151,146,232,130,254,209,254,255,77,67,
+130,162,171,143,141,176,113,221,154,207,1,44,158,152,254,235,180,241,184,
+4,0,252,111,58,62,111,88,82,102,142,0,2,0,130,253,86,9,186,4,150,0,55,0,68,
+0,0,33,33,20,22,51,51,21,35,34,6,7,6,6,4,35,32,0,0,17,16,1,23,6,2,21,20,18,
+4,51,50,54,54,55,54,54,51,51,53,38,38,39,33,17,51,17,33,17,52,54,51,50,22,
+18,21,16,6,39,50,54,54,53,52,38,38,35,34,6,21,17,8,94,254,214,135,109,132,
+132,55,109,99,96,162,254,255,174,254,222,254,53,254,255,1,45,93,130,140,212,
+1,124,240,114,179,124,80,105,108,55,7,101,105,2,253,46,194,2,16,200,170,132,
+214,124,168,199,106,105,31,94,144,75,95,113,107,133,110,43,70,67,88,64,1,
+21,1,225,1,40,1,200,1,90,77,151,254,136,214,253,254,89,248,49,69,54,71,40,
+10,36,133,106,4,110,252,0,2,158,166,199,152,254,220,201,254,243,231,110,95,
+160,131,172,239,117,118,123,253,95,0,0,2,0,130,253,160,12,142,4,120,0,71,
+0,83,0,0,1,16,0,4,33,32,0,0,17,52,18,55,23,6,17,16,0,4,33,32,0,17,52,38,35,
+34,7,17,35,17,33,17,35,17,52,36,33,34,6,6,21,20,23,54,54,51,50,22,21,20,6,
+35,34,38,38,53,52,18,36,51,50,4,23,53,33,21,33,17,54,51,50,22,5,22,22,51,
+50,54,53,52,38,35,34,6,12,142,254,125,253,87,254,67,254,72,253,54,254,95,
+103,101,98,182,1,134,2,149,1,149,2,127,2,157,112,113,105,50,194,254,45,194,
+254,226,254,255,153,249,144,21,36,202,129,143,169,207,163,122,205,123,177,
+1,46,186,188,1,27,83,4,181,254,152,83,126,172,199,246,107,41,117,66,97,118,
+107,91,94,131,1,35,254,211,254,109,195,1,8,2,7,1,109,167,1,50,125,75,215,
+254,204,254,177,254,44,235,1,146,1,118,142,165,89,254,16,4,0,252,0,2,38,231,
+253,123,237,164,90,79,125,156,171,143,141,176,121,236,165,201,1,29,145,124,
+117,231,110,254,108,87,225,253,63,65,111,88,82,102,136,0,2,0,190,253,115,
+8,134,4,120,0,51,0,61,0,0,1,33,6,4,35,34,36,38,53,52,54,51,33,54,17,52,2,
+38,35,34,6,21,17,35,17,52,38,35,34,6,21,17,35,17,52,54,51,50,22,23,54,54,
+51,50,22,18,21,16,3,33,17,51,1,33,34,21,20,22,22,51,50,36,8,134,253,43,113,
+254,163,221,191,254,248,129,93,89,3,177,120,84,139,85,107,137,194,95,91,82,
+98,125,168,140,120,139,29,42,181,113,188,225,92,120,1,214,195,252,94,252,
+158,71,104,184,114,173,1,13,254,247,182,206,108,162,80,69,79,248,1,71,215,
+1,19,124,133,104,252,227,3,31,108,126,112,96,252,199,3,58,144,173,113,65,
+80,99,217,254,185,181,254,194,255,0,5,9,250,137,47,60,107,65,146,0,0,4,0,
+120,253,54,11,122,4,121,0,68,0,79,0,91,0,101,0,0,1,33,6,4,33,32,36,38,53,
+52,54,51,33,54,17,16,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,
+4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,23,54,51,
+32,0,17,16,7,33,17,51,5,6,2,21,20,22,51,50,54,53,16,1,22,22,51,50,54,53,52,
+38,35,34,6,1,33,34,21,20,22,4,51,32,36,11,122,253,58,168,253,221,254,173,
+254,197,254,72,219,93,89,6,161,165,235,246,138,113,150,173,207,171,168,194,
+113,102,166,227,186,254,203,182,19,33,206,131,143,169,207,163,118,207,126,
+227,1,122,222,249,212,163,199,1,55,1,107,142,1,186,194,250,3,94,101,104,105,
+107,109,250,212,42,119,64,97,118,107,91,97,131,6,130,249,197,71,209,1,96,
+202,1,28,1,208,254,247,215,234,126,190,95,69,79,240,1,76,1,35,1,71,58,102,
+254,214,179,182,226,220,193,167,1,30,102,76,132,254,174,77,67,130,162,171,
+143,141,176,113,221,154,208,1,45,156,106,107,254,109,254,167,254,203,243,
+5,9,232,87,254,249,157,136,159,166,133,1,81,253,253,58,62,111,88,82,102,142,
+253,161,47,66,137,89,175,0,4,0,130,255,246,10,169,4,110,0,47,0,51,0,62,0,
+74,0,0,37,21,33,39,54,53,52,38,35,34,7,22,22,21,20,6,35,34,38,53,52,55,35,
+21,20,4,35,34,38,53,52,54,55,17,33,21,33,17,33,54,36,51,50,4,22,21,20,7,1,
+33,17,33,21,33,34,6,21,20,22,51,50,54,53,37,35,6,21,20,22,51,50,54,53,52,
+38,10,169,253,249,37,122,243,203,203,122,215,255,194,151,173,203,32,253,254,
+250,221,194,245,143,126,3,245,254,152,1,61,81,1,14,159,159,1,25,170,128,250,
+33,254,178,1,78,254,184,130,145,167,131,145,160,2,132,63,41,117,96,89,104,
+165,110,110,88,118,173,173,205,108,5,177,172,131,174,204,172,94,79,130,191,
+227,190,151,119,161,26,1,240,110,254,137,104,114,122,218,136,160,121,3,146,
+254,137,110,114,98,111,115,152,134,152,85,101,113,140,97,83,124,135,0,0,1,
+0,195,252,232,9,82,4,110,0,79,0,0,5,20,0,4,33,34,36,36,53,52,54,51,50,4,23,
+7,38,36,35,34,6,21,20,22,4,51,32,36,0,53,52,38,35,34,6,21,21,35,17,33,53,
+51,50,54,54,53,52,38,35,34,6,21,21,35,17,33,17,35,17,33,21,33,17,54,54,51,
+50,22,21,20,6,7,33,17,51,17,54,51,50,22,9,82,254,171,253,210,254,180,231,
+254,77,254,218,255,205,150,1,66,135,40,129,254,208,133,151,185,249,1,103,
+168,1,30,1,244,1,58,72,67,68,91,194,252,8,213,74,160,115,109,85,77,97,194,
+254,149,125,4,18,254,152,23,133,84,137,181,168,126,2,46,194,79,149,119,141,
+75,246,254,190,149,74,177,146,138,133,66,58,103,58,66,90,90,95,124,56,125,
+1,10,202,73,88,100,76,223,1,71,110,60,144,117,97,120,106,85,56,2,111,251,
+255,4,111,110,254,125,59,80,180,134,126,199,27,4,0,252,5,123,170,0,0,3,0,
+130,253,161,9,10,4,110,0,55,0,59,0,70,0,0,37,20,0,4,33,32,36,0,17,52,18,55,
+23,6,2,21,20,18,4,33,32,0,17,52,38,35,34,6,21,21,35,17,33,21,20,4,35,34,38,
+53,52,54,55,17,33,21,33,17,33,21,35,21,54,51,50,22,1,33,17,33,21,33,34,6,
+21,20,22,51,50,54,53,9,10,255,0,254,46,254,205,254,166,253,245,254,226,153,
+153,81,128,134,245,1,200,1,53,1,158,1,189,65,60,56,66,190,254,242,254,250,
+221,194,245,143,126,3,245,254,152,2,198,250,61,116,116,144,251,189,254,178,
+1,78,254,184,130,145,167,131,145,160,64,204,254,208,163,237,1,175,1,28,177,
+1,80,139,84,115,254,218,155,255,254,137,201,1,20,1,15,98,84,69,52,126,2,27,
+130,191,227,190,151,119,161,26,1,240,110,254,137,110,237,69,171,3,56,254,
+137,110,114,98,111,115,152,134,0,3,0,120,253,54,14,26,4,110,0,68,0,80,0,89,
+0,0,1,21,33,17,35,17,33,17,33,6,4,33,32,36,38,53,52,54,51,33,54,53,52,38,
+35,34,6,7,17,35,17,33,34,4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,
+53,52,18,36,51,33,21,33,17,54,51,50,22,22,21,20,7,33,17,1,22,22,51,50,54,
+53,52,38,35,34,6,1,33,34,21,20,22,4,51,32,14,26,254,153,194,254,45,253,174,
+131,254,28,254,207,254,206,254,79,217,93,89,6,25,62,112,116,59,85,21,194,
+254,40,175,254,233,162,21,36,202,129,143,169,207,163,122,205,123,196,1,75,
+203,4,8,254,152,81,138,117,169,88,73,1,157,247,160,41,117,66,97,118,107,91,
+94,131,5,189,250,46,71,202,1,83,194,2,95,4,110,110,252,0,4,0,250,247,214,
+235,126,190,95,69,79,151,204,167,218,59,50,254,36,4,0,119,232,164,90,79,125,
+156,171,143,141,176,121,236,165,200,1,25,141,110,254,97,98,130,221,134,203,
+174,5,9,252,118,63,65,111,88,82,102,136,253,156,47,65,137,90,0,0,2,0,130,
+253,200,6,209,6,162,0,53,0,64,0,0,1,38,35,32,0,2,17,16,18,4,51,32,18,17,16,
+35,34,6,21,17,35,17,51,17,54,54,51,50,18,17,20,2,4,35,34,0,2,17,16,18,0,33,
+50,4,22,21,20,6,35,34,38,53,52,54,7,20,22,51,50,54,53,52,39,6,6,5,126,147,
+222,254,254,254,161,173,167,1,46,198,1,12,239,233,85,105,194,194,40,126,78,
+191,184,165,254,196,219,234,254,152,201,201,1,144,1,33,193,1,77,199,157,142,
+125,164,131,10,77,66,68,70,83,92,106,5,196,110,254,253,254,48,254,203,254,
+192,254,56,236,1,71,1,43,1,191,120,91,254,108,4,110,253,243,61,67,254,224,
+254,252,224,254,169,190,1,11,1,250,1,93,1,86,2,3,1,31,133,236,146,144,162,
+163,125,100,162,249,73,88,91,77,127,99,37,118,0,0,5,0,120,253,54,18,146,4,
+120,0,95,0,107,0,118,0,130,0,140,0,0,1,21,33,17,35,17,33,17,33,6,4,33,32,
+36,36,53,52,54,51,33,54,17,16,2,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,
+38,35,34,7,22,18,21,20,6,35,34,38,53,52,18,55,38,35,34,4,6,21,20,23,54,54,
+51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,32,23,54,33,50,23,54,51,50,4,
+18,21,16,7,33,17,5,6,6,21,20,22,51,50,54,53,52,2,37,6,6,21,20,22,51,50,54,
+53,16,1,22,22,51,50,54,53,52,38,35,34,6,1,33,34,21,20,4,4,51,32,36,18,146,
+254,153,194,254,45,253,58,236,252,233,254,31,254,148,253,125,254,123,93,89,
+10,25,223,218,195,128,107,142,156,213,168,165,193,117,105,140,192,203,159,
+135,151,207,171,168,194,127,116,171,250,186,254,203,182,19,33,206,131,143,
+169,207,163,118,207,126,227,1,122,222,1,22,223,209,1,25,229,187,155,188,195,
+1,20,141,186,1,230,251,11,97,107,104,105,107,109,112,252,6,106,115,104,105,
+107,109,250,212,42,119,64,97,118,107,91,97,131,9,136,246,111,71,1,153,2,49,
+200,1,167,2,188,4,110,110,252,0,4,0,250,247,225,224,106,188,117,69,79,239,
+1,90,1,31,1,61,51,105,254,201,180,175,222,232,198,158,1,28,101,71,78,101,
+254,226,171,182,226,220,193,167,1,19,99,90,132,254,174,77,67,130,162,171,
+143,141,176,113,221,154,208,1,45,156,122,122,95,95,187,254,180,215,254,186,
+239,5,9,232,85,254,146,141,176,162,131,160,1,7,66,85,249,153,136,159,166,
+133,1,62,254,16,58,62,111,88,82,102,142,253,161,47,81,133,78,167,0,0,4,0,
+130,253,54,12,109,4,110,0,49,0,53,0,64,0,74,0,0,1,21,33,17,35,17,33,17,33,
+6,4,33,34,36,38,53,52,54,51,33,54,53,52,2,35,35,21,20,4,35,34,38,53,52,54,
+55,17,33,21,33,17,51,50,4,18,21,20,7,33,17,5,17,33,17,17,33,34,6,21,20,22,
+51,50,54,53,1,33,34,21,20,22,22,51,50,36,12,109,254,153,194,254,45,253,235,
+97,254,77,254,236,201,254,196,173,93,89,4,134,26,239,190,5,254,250,221,194,
+245,143,126,3,245,254,152,2,181,1,32,163,27,1,111,250,34,1,78,254,184,125,
+143,160,131,142,163,2,48,251,178,71,155,245,126,226,1,82,4,110,110,252,0,
+4,0,250,247,207,242,129,192,90,69,79,93,106,220,1,19,130,191,227,190,151,
+119,161,26,1,240,110,254,137,147,254,239,184,106,94,5,9,110,254,137,1,119,
+254,27,114,98,102,124,152,134,253,116,47,78,135,80,177,0,0,2,0,182,253,161,
+11,231,4,110,0,47,0,56,0,0,1,21,33,17,35,17,33,17,33,6,4,35,34,36,53,52,54,
+51,33,54,53,16,35,34,6,21,17,35,17,33,17,35,17,33,21,33,17,54,54,51,50,22,
+22,21,20,7,33,17,1,33,34,21,20,4,51,50,54,11,231,254,153,194,254,45,253,202,
+97,254,153,253,237,254,179,88,81,3,195,62,234,78,103,194,254,122,125,4,45,
+254,152,18,138,89,114,166,86,59,1,133,253,119,252,134,62,1,21,171,172,254,
+4,110,110,252,0,4,0,250,250,167,178,183,132,65,75,145,187,1,149,122,89,254,
+138,4,0,252,0,4,110,110,254,46,63,86,136,231,138,198,156,5,6,250,140,45,73,
+117,123,0,0,1,0,200,252,232,8,80,4,110,0,50,0,0,5,20,0,4,33,34,36,36,53,52,
+54,51,50,4,23,7,38,36,35,34,6,21,20,22,4,51,50,36,0,53,52,38,35,34,6,21,21,
+35,17,33,17,51,17,33,17,51,17,54,51,50,22,8,80,254,220,254,20,254,215,196,
+254,131,254,252,244,193,130,1,23,118,40,111,254,254,115,142,173,211,1,44,
+142,252,1,179,1,7,72,67,71,88,194,251,34,194,4,28,194,76,152,117,143,75,225,
+254,187,167,70,169,139,141,137,60,52,100,49,56,90,91,92,116,50,143,1,13,181,
+73,88,113,93,193,1,71,4,110,252,0,4,0,251,254,130,171,0,3,0,130,253,158,10,
+70,4,121,0,44,0,57,0,68,0,0,1,16,6,35,33,2,0,33,32,36,0,17,16,0,51,50,22,
+21,20,6,6,35,34,39,6,21,16,18,4,51,32,0,55,33,17,51,17,33,17,52,54,51,50,
+22,18,7,52,38,38,35,34,6,21,17,33,50,54,54,1,22,51,50,54,53,52,38,35,34,6,
+10,70,168,180,254,214,7,254,81,254,142,254,234,254,33,254,223,1,7,210,138,
+167,128,212,123,93,92,5,248,1,161,246,1,31,1,74,7,253,46,194,2,16,200,170,
+132,214,124,125,94,144,75,95,113,1,23,106,105,31,247,72,59,59,161,186,82,
+73,111,166,1,244,254,243,231,254,228,254,186,255,1,217,1,56,1,61,1,141,153,
+129,105,151,77,23,55,44,254,219,254,79,227,1,9,235,4,110,252,0,2,158,166,
+199,152,254,220,205,172,239,117,118,123,253,95,95,160,1,19,9,128,110,65,85,
+204,0,1,0,195,252,231,8,245,4,110,0,67,0,0,5,20,0,4,33,34,36,38,53,52,54,
+51,50,4,23,7,38,36,35,34,6,21,20,22,4,51,32,36,0,53,52,38,35,34,6,21,21,35,
+17,33,53,14,2,35,34,38,53,17,51,17,20,22,51,50,54,53,17,51,17,33,17,51,17,
+54,51,50,22,8,245,254,171,253,214,254,195,218,254,118,254,245,196,132,1,31,
+124,40,118,254,245,116,144,174,204,1,57,166,1,13,1,241,1,58,72,67,71,88,194,
+252,174,11,64,106,69,150,166,190,96,77,89,102,190,2,160,194,76,152,127,133,
+75,232,254,188,162,76,170,133,141,137,60,52,100,49,56,89,92,88,117,54,138,
+1,13,187,73,88,113,93,193,1,71,145,29,72,54,179,175,3,22,252,199,91,103,118,
+95,3,38,252,0,4,0,251,254,130,170,0,0,2,0,130,253,160,9,225,4,120,0,48,0,
+59,0,0,1,16,0,33,32,0,0,17,52,54,54,51,50,22,21,20,6,35,34,39,18,0,0,33,32,
+0,17,52,38,35,34,6,21,17,35,17,33,17,35,17,33,21,33,17,54,54,51,50,22,37,
+22,51,50,54,53,52,38,35,34,6,9,225,253,181,253,229,254,133,253,190,254,196,
+119,185,107,127,156,211,157,102,99,2,1,22,2,3,1,88,1,191,1,232,122,103,83,
+102,194,254,45,194,4,191,254,152,38,123,78,167,204,247,34,75,73,107,139,81,
+69,100,128,1,15,254,91,254,54,1,54,2,33,1,86,200,248,107,154,124,129,172,
+42,254,192,254,10,254,229,1,137,1,107,149,178,119,92,254,138,4,0,252,0,4,
+110,110,254,75,57,63,240,232,28,110,85,67,83,176,0,3,0,120,253,55,13,126,
+4,120,0,76,0,88,0,99,0,0,1,21,33,17,35,17,33,17,33,6,4,33,34,36,38,53,52,
+54,51,33,54,53,53,38,38,53,17,52,38,35,34,0,17,20,23,54,54,51,50,22,21,20,
+6,35,34,38,38,53,52,18,36,51,50,4,22,21,17,20,22,51,50,54,54,53,16,39,55,
+22,17,20,2,7,21,20,7,33,17,1,22,22,51,50,54,53,52,38,35,34,6,1,33,34,6,21,
+20,22,22,51,50,36,13,126,254,153,194,254,45,252,202,78,254,113,254,236,188,
+254,203,177,93,89,4,60,10,125,152,229,190,241,254,228,19,33,206,131,143,169,
+207,163,118,207,126,171,1,45,192,169,1,14,155,95,103,100,157,86,197,77,230,
+208,166,12,2,154,248,50,42,119,64,97,118,107,91,97,131,4,73,251,234,40,31,
+143,253,156,223,1,28,4,110,110,252,0,4,0,250,229,202,228,118,183,91,69,79,
+57,71,54,25,178,143,1,44,171,208,254,209,254,255,77,67,130,162,171,143,141,
+176,113,221,154,207,1,44,158,123,224,145,254,212,119,112,126,216,129,1,42,
+180,74,220,254,159,210,254,200,38,57,66,61,5,27,252,111,58,62,111,88,82,102,
+142,253,143,27,27,60,124,82,166,0,0,2,0,120,252,231,10,92,4,120,0,83,0,95,
+0,0,5,20,0,4,33,32,36,36,53,52,36,51,50,4,23,7,38,36,35,34,6,21,20,4,4,51,
+32,36,0,53,52,38,35,34,6,21,21,35,17,33,39,54,54,53,52,38,38,35,32,0,17,20,
+23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,18,36,51,50,4,18,21,20,7,33,17,
+51,17,54,51,50,22,37,22,22,51,50,54,53,52,38,35,34,6,10,92,254,142,253,139,
+254,118,254,244,254,31,254,202,1,24,221,153,1,70,138,40,132,254,201,139,167,
+204,1,11,1,148,207,1,87,2,60,1,88,72,67,67,92,194,253,37,37,73,94,143,247,
+152,254,241,254,196,19,33,206,131,143,169,207,163,118,207,126,189,1,77,212,
+197,1,69,189,180,2,73,194,80,148,127,133,246,219,42,119,64,97,118,107,91,
+97,131,75,242,254,190,154,78,174,137,136,134,61,53,103,52,59,87,87,89,122,
+58,131,1,12,195,73,88,113,83,203,1,71,88,69,218,151,146,232,130,254,209,254,
+255,77,67,130,162,171,143,141,176,113,221,154,207,1,44,158,152,254,235,180,
+241,184,4,0,251,252,132,170,153,58,62,111,88,82,102,142,0,0,3,0,130,253,85,
+10,123,4,121,0,63,0,76,0,87,0,0,33,33,20,22,51,51,21,35,34,6,6,7,6,6,4,35,
+32,0,0,17,52,18,54,51,50,22,21,20,6,35,34,39,6,21,16,18,0,51,50,54,54,55,
+54,54,55,53,38,38,39,33,17,51,17,33,17,52,54,51,50,22,18,21,16,6,39,50,54,
+54,53,52,38,38,35,34,6,21,17,1,22,51,50,54,53,52,38,35,34,6,9,31,254,214,
+135,109,132,132,55,95,80,63,100,172,254,241,187,254,182,254,0,254,226,118,
+220,146,133,162,230,180,118,116,10,255,1,166,240,143,216,144,88,113,113,62,
+102,104,2,253,46,194,2,16,200,170,132,214,124,168,199,106,105,31,94,144,75,
+95,113,249,37,78,75,126,150,75,64,109,146,107,133,110,30,45,41,67,87,63,1,
+26,2,2,1,82,196,1,59,182,150,124,148,187,44,70,73,254,224,254,51,254,253,
+51,72,56,71,39,3,10,36,128,106,4,110,252,0,2,158,166,199,152,254,220,201,
+254,243,231,110,95,160,131,172,239,117,118,123,253,95,2,44,24,124,105,57,
+70,187,0,0,3,0,130,253,160,14,43,4,120,0,77,0,88,0,100,0,0,1,16,0,33,32,0,
+0,17,52,54,54,51,50,22,21,20,6,35,34,39,18,0,4,33,32,0,17,52,38,35,34,6,7,
+17,35,17,33,17,35,17,52,36,33,34,6,6,21,20,23,54,54,51,50,22,21,20,6,35,34,
+38,38,53,52,18,36,51,50,4,23,53,33,21,33,17,54,51,50,22,37,22,51,50,54,53,
+52,38,35,34,6,1,22,22,51,50,54,53,52,38,35,34,6,14,43,252,154,252,221,254,
+2,252,197,254,25,114,181,106,127,156,211,157,102,99,3,1,198,3,3,1,226,2,192,
+3,0,113,112,59,85,21,194,254,45,194,254,226,254,255,153,249,144,21,36,202,
+129,143,169,207,163,122,205,123,177,1,46,186,188,1,27,83,4,181,254,152,80,
+139,170,201,242,206,75,73,107,139,81,69,100,128,3,131,41,117,66,97,118,107,
+91,94,131,1,55,254,72,254,33,1,11,2,27,1,135,200,248,107,154,124,129,172,
+42,254,146,254,16,243,1,160,1,124,128,159,59,50,254,36,4,0,252,0,2,38,231,
+253,123,237,164,90,79,125,156,171,143,141,176,121,236,165,201,1,29,145,124,
+117,231,110,254,101,94,216,208,28,110,85,67,83,176,253,157,63,65,111,88,82,
+102,136,0,2,0,190,253,115,12,60,4,120,0,57,0,67,0,0,1,21,33,17,35,17,33,17,
+33,6,4,35,34,36,38,53,52,54,51,33,54,17,52,2,38,35,34,6,21,17,35,17,52,38,
+35,34,6,21,17,35,17,52,54,51,50,22,23,54,54,51,50,22,18,21,16,3,33,17,1,33,
+34,21,20,22,22,51,50,36,12,60,254,153,194,254,45,253,113,113,254,163,221,
+191,254,248,129,93,89,3,177,120,84,139,85,107,137,194,95,91,82,98,125,168,
+140,120,139,29,42,181,113,188,225,92,120,1,214,253,33,252,158,71,104,184,
+114,173,1,13,4,110,110,252,0,4,0,250,247,182,206,108,162,80,69,79,248,1,71,
+215,1,19,124,133,104,252,227,3,31,108,126,112,96,252,199,3,58,144,173,113,
+65,80,99,217,254,185,181,254,194,255,0,5,9,250,137,47,60,107,65,146,0,4,0,
+120,253,54,15,49,4,121,0,74,0,85,0,97,0,107,0,0,1,21,33,17,35,17,33,17,33,
+6,4,33,32,36,38,53,52,54,51,33,54,17,16,2,35,34,7,22,18,21,20,6,35,34,38,
+53,52,18,55,38,35,34,4,6,21,20,23,54,54,51,50,22,21,20,6,35,34,38,38,53,52,
+18,36,51,50,23,54,51,32,0,17,16,7,33,17,5,6,2,21,20,22,51,50,54,53,16,1,22,
+22,51,50,54,53,52,38,35,34,6,1,33,34,21,20,22,4,51,32,36,15,49,254,153,194,
+254,45,253,127,168,253,221,254,173,254,197,254,72,219,93,89,6,161,165,235,
+246,138,113,150,173,207,171,168,194,113,102,166,227,186,254,203,182,19,33,
+206,131,143,169,207,163,118,207,126,227,1,122,222,249,212,163,199,1,55,1,
+107,142,1,186,250,197,94,101,104,105,107,109,250,212,42,119,64,97,118,107,
+91,97,131,6,130,249,197,71,209,1,96,202,1,28,1,208,4,110,110,252,0,4,0,250,
+247,215,234,126,190,95,69,79,240,1,76,1,35,1,71,58,102,254,214,179,182,226,
+220,193,167,1,30,102,76,132,254,174,77,67,130,162,171,143,141,176,113,221,
+154,208,1,45,156,106,107,254,109,254,167,254,203,243,5,9,232,87,254,249,157,
+136,159,166,133,1,81,253,253,58,62,111,88,82,102,142,253,161,47,66,137,89,
+175,0,0,2,0,200,252,224,11,119,7,14,0,94,0,106,0,0,1,16,0,4,33,32,36,36,53,
+52,36,33,50,4,23,7,38,36,35,34,4,21,20,4,4,51,32,36,0,17,52,38,35,34,6,21,
+17,35,17,33,17,35,17,52,38,35,34,6,21,17,33,17,51,17,33,17,52,54,51,50,23,
+53,33,38,38,53,52,36,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,33,
+21,33,17,54,54,51,50,22,1,7,6,21,20,22,51,50,54,53,52,38,11,119,254,75,253,
+23,254,47,254,233,254,19,254,196,1,54,1,25,173,1,98,134,40,129,254,177,163,
+202,254,254,1,18,1,158,216,1,155,2,178,1,159,121,103,84,107,194,254,122,125,
+118,99,84,84,251,254,194,2,126,159,156,170,94,1,252,56,62,1,4,207,189,231,
+171,130,146,174,29,86,89,155,118,1,30,254,152,18,138,89,164,196,254,47,59,
+32,98,92,69,90,141,1,16,254,160,254,29,237,80,180,142,132,149,59,52,103,51,
+58,93,94,97,126,58,214,1,171,1,47,166,165,120,91,254,138,4,0,252,0,2,218,
+136,158,110,101,252,211,4,110,252,0,2,188,159,175,131,121,49,138,82,178,225,
+176,146,108,143,160,129,69,78,33,139,96,116,151,110,254,46,63,86,237,4,202,
+3,79,70,89,112,86,67,93,107,0,0,1,253,101,0,0,1,19,6,172,0,21,0,0,19,52,38,
+35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,22,21,17,35,150,224,156,140,166,
+128,51,102,106,246,185,126,232,153,125,4,81,237,186,129,109,130,63,64,56,
+139,97,167,216,105,242,193,251,112,0,1,252,57,0,0,1,19,6,172,0,22,0,0,19,
+52,0,33,34,6,21,20,22,23,7,38,38,53,52,54,36,51,32,0,17,17,35,150,254,237,
+254,244,197,245,43,77,50,98,104,144,1,5,169,1,54,1,102,125,3,237,251,1,16,
+140,115,55,78,57,80,58,143,99,117,185,103,254,169,254,215,251,212,0,0,2,252,
+225,4,4,0,88,7,14,0,23,0,36,0,0,19,20,6,35,34,38,53,52,55,6,6,21,20,22,23,
+21,38,38,53,52,36,51,50,22,7,52,38,35,34,7,6,21,20,22,51,50,54,88,171,130,
+146,174,29,86,89,111,114,154,191,1,4,207,189,231,170,141,117,25,34,32,98,
+92,69,90,5,204,108,143,160,129,69,78,33,139,96,112,133,38,90,39,191,145,178,
+225,176,134,93,107,3,79,70,89,112,86,0,2,251,102,4,21,254,221,7,14,0,23,0,
+36,0,0,1,20,6,35,34,38,53,52,55,6,6,21,20,22,23,7,38,38,53,52,36,51,50,22,
+7,52,38,35,34,7,6,21,20,22,51,50,54,254,221,171,130,146,174,29,86,89,124,
+98,17,153,172,1,4,207,189,231,170,141,117,25,34,32,98,92,69,90,5,204,108,
+143,160,129,69,78,33,139,96,103,136,24,93,37,181,140,178,225,176,134,93,107,
+3,79,70,89,112,86,0,2,254,135,1,182,4,71,4,122,0,10,0,19,0,0,1,17,20,6,35,
+34,38,53,53,5,53,5,5,21,20,22,51,50,54,53,4,71,216,175,168,191,253,46,4,254,
+254,81,111,108,93,119,4,122,254,150,156,190,190,167,240,1,110,108,1,250,115,
+121,122,94,0,2,252,167,1,182,4,71,4,110,0,10,0,19,0,0,1,17,20,6,35,34,38,
+53,53,33,53,5,33,21,20,22,51,50,54,53,4,71,216,175,168,191,251,78,6,222,254,
+81,111,108,93,119,4,110,254,162,156,190,190,167,229,110,110,239,115,121,122,
+94,0,2,254,135,0,0,6,236,6,62,0,41,0,50,0,0,1,20,2,4,33,34,36,39,55,22,4,
+51,32,0,17,52,2,36,35,34,6,6,7,33,17,20,6,35,34,38,53,53,33,53,33,54,54,36,
+51,50,4,18,37,33,21,20,22,51,50,54,53,6,236,223,254,90,254,223,229,254,131,
+134,81,117,1,96,198,1,98,1,124,118,254,249,207,138,208,122,15,2,108,204,163,
+180,203,253,16,2,244,15,152,1,24,197,223,1,86,184,252,183,254,81,110,109,
+93,119,3,73,247,254,131,213,196,185,63,171,163,1,132,1,117,160,1,24,177,92,
+157,95,254,152,154,191,206,180,209,110,121,206,127,219,254,162,5,219,125,
+141,122,94,0,2,252,172,0,0,6,236,6,62,0,40,0,49,0,0,1,20,2,4,33,34,36,39,
+55,22,4,51,32,0,17,52,2,36,35,34,4,7,33,17,20,6,35,34,38,53,53,33,53,33,54,
+54,36,51,50,4,18,5,33,21,20,22,51,50,54,53,6,236,223,254,90,254,223,229,254,
+131,134,81,117,1,96,198,1,98,1,124,118,254,249,207,195,254,248,24,2,108,204,
+163,180,203,251,53,4,207,16,152,1,24,196,223,1,86,184,252,183,254,81,110,
+109,93,119,3,73,247,254,131,213,196,185,63,171,163,1,132,1,117,160,1,24,177,
+194,160,254,162,154,191,206,180,199,110,124,211,129,219,254,162,5,209,125,
+141,122,94,0,2,0,211,255,242,1,213,5,182,0,3,0,11,0,0,19,51,3,35,3,52,51,
+50,21,20,35,34,221,238,72,94,82,129,129,129,129,5,182,251,230,254,225,139,
+139,139,0,2,0,117,3,213,2,207,5,182,0,3,0,7,0,0,19,51,3,35,1,51,3,35,117,
+217,62,94,1,68,217,62,94,5,182,254,31,1,225,254,31,0,0,2,0,51,0,0,4,70,5,
+182,0,27,0,31,0,0,19,35,53,51,19,35,53,51,19,51,3,33,19,51,3,51,21,35,3,51,
+21,33,3,35,19,33,3,35,1,19,33,3,240,189,211,78,223,245,74,125,76,1,29,76,
+123,76,201,224,75,233,254,254,78,123,78,254,227,77,123,1,254,76,254,227,76,
+1,160,121,1,145,121,1,147,254,109,1,147,254,109,121,254,111,121,254,96,1,
+160,254,96,2,25,1,145,254,111,0,0,5,0,92,255,236,6,207,5,203,0,11,0,15,0,
+27,0,39,0,51,0,0,19,52,54,51,50,22,21,20,6,35,34,38,1,51,1,35,19,52,38,35,
+34,6,21,20,22,51,50,54,1,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,
+21,20,22,51,50,54,92,166,172,164,170,171,165,170,166,4,96,134,253,38,135,
+97,68,80,82,72,72,80,81,69,1,237,165,173,164,170,171,165,171,165,1,229,67,
+80,82,72,72,80,81,68,4,6,214,239,242,211,212,245,243,2,134,250,74,4,6,183,
+184,186,181,184,189,188,254,103,215,238,242,211,211,245,242,214,183,184,186,
+181,184,189,187,0,0,1,0,117,3,213,1,78,5,182,0,3,0,0,19,51,3,35,117,217,62,
+94,5,182,254,31,0,1,0,117,254,250,2,131,6,20,0,15,0,0,19,16,18,37,21,6,6,
+2,21,20,18,22,23,21,36,2,117,245,1,25,132,138,43,43,138,132,254,233,247,2,
+137,1,118,1,165,112,92,80,250,254,220,193,192,254,218,251,80,94,111,1,169,
+0,0,1,0,66,254,250,2,80,6,20,0,15,0,0,23,54,54,18,53,52,2,38,39,53,4,18,17,
+16,2,5,66,132,137,44,44,137,132,1,23,247,247,254,233,168,80,252,1,37,192,
+192,1,37,250,80,92,111,254,90,254,138,254,139,254,85,111,0,0,1,0,84,3,6,3,
+160,6,20,0,17,0,0,1,5,39,37,37,55,5,3,51,3,37,23,5,5,7,37,19,35,1,213,254,
+199,72,1,88,254,168,72,1,59,53,178,57,1,61,72,254,166,1,90,72,254,195,57,
+178,4,74,195,160,102,103,162,199,1,69,254,189,192,159,101,100,158,191,254,
+188,0,0,1,0,133,1,37,3,244,4,147,0,11,0,0,1,33,53,33,17,51,17,33,21,33,17,
+35,1,254,254,135,1,121,123,1,123,254,133,123,2,160,121,1,122,254,134,121,
+254,133,0,1,0,61,254,197,1,141,1,8,0,17,0,0,23,54,53,52,38,39,38,38,53,52,
+54,51,50,22,21,20,6,7,61,195,31,32,54,33,75,59,69,88,162,174,229,63,121,25,
+28,18,29,53,35,57,64,98,80,140,210,51,0,1,0,51,1,225,2,72,2,123,0,3,0,0,19,
+33,21,33,51,2,21,253,235,2,123,154,0,1,0,127,255,242,1,129,1,8,0,7,0,0,55,
+52,51,50,21,20,35,34,127,129,129,129,129,125,139,139,139,0,0,1,0,0,255,8,
+2,78,6,20,0,3,0,0,1,51,1,35,1,215,119,254,43,121,6,20,248,244,0,2,0,92,255,
+236,4,29,5,203,0,11,0,23,0,0,19,16,18,51,50,18,17,16,2,35,34,2,1,16,2,35,
+34,2,17,16,18,51,50,18,92,237,246,229,249,252,228,244,237,2,236,122,143,145,
+125,125,143,144,123,2,223,1,98,1,138,254,121,254,153,254,152,254,119,1,144,
+1,97,1,62,1,65,254,191,254,194,254,194,254,187,1,68,0,0,1,0,135,0,0,3,209,
+5,190,0,23,0,0,55,51,50,54,53,17,6,6,35,34,38,53,54,54,55,55,51,17,20,22,
+51,51,21,33,197,137,96,72,92,116,56,45,58,66,137,96,144,131,73,95,100,252,
+244,86,71,76,4,52,111,102,61,49,17,70,71,106,251,43,76,71,86,0,0,1,0,104,
+0,0,3,227,5,203,0,31,0,0,55,1,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,
+50,22,21,20,6,7,1,33,50,54,54,55,51,3,33,104,1,86,169,122,104,105,128,97,
+82,94,214,187,192,224,139,203,254,166,1,217,59,70,35,16,86,10,252,143,150,
+1,139,197,243,135,121,139,164,141,60,73,127,148,186,156,117,254,223,254,129,
+42,71,77,254,158,0,0,1,0,119,255,236,4,2,5,203,0,44,0,0,55,52,54,51,20,22,
+51,50,54,53,52,38,35,35,53,51,50,54,53,52,35,34,6,21,34,38,53,52,54,51,50,
+22,21,20,6,7,22,22,21,20,6,6,35,34,38,119,70,59,142,118,135,170,200,171,65,
+65,142,180,219,129,97,82,94,216,186,199,231,183,145,184,195,154,237,129,180,
+207,207,61,70,113,135,158,172,131,154,104,178,139,254,164,141,60,73,127,148,
+175,151,135,208,34,20,190,152,155,196,87,122,0,0,2,0,35,0,0,4,92,5,182,0,
+20,0,28,0,0,37,51,50,54,53,53,33,53,1,51,17,51,21,35,21,20,22,51,51,21,33,
+19,17,52,55,6,6,7,1,1,184,58,96,72,253,137,2,121,194,254,254,73,95,27,253,
+151,226,14,20,127,37,254,198,86,71,76,168,84,3,209,252,78,115,168,76,71,86,
+2,4,1,123,248,176,40,218,57,254,24,0,1,0,113,255,236,3,227,5,180,0,34,0,0,
+55,52,51,20,22,51,32,17,52,38,35,34,6,7,39,19,33,19,35,39,38,38,35,33,3,54,
+51,50,22,21,20,4,35,34,38,113,129,133,114,1,37,166,145,94,108,50,49,66,2,
+172,10,86,8,7,46,58,254,115,39,97,142,216,251,254,246,229,181,206,186,121,
+95,112,1,90,158,162,23,22,14,2,213,254,203,61,51,33,254,62,33,233,200,214,
+252,109,0,2,0,125,255,236,4,16,5,203,0,25,0,34,0,0,19,52,18,54,51,50,22,21,
+20,6,35,52,38,35,32,3,54,51,50,22,21,20,2,35,34,2,37,16,35,34,6,7,18,33,50,
+125,119,241,174,152,186,81,76,87,94,254,210,21,128,165,189,222,238,202,231,
+244,2,194,243,74,132,48,6,1,10,225,2,225,201,1,84,205,120,95,59,64,108,131,
+253,166,107,226,194,225,254,248,1,138,75,1,79,69,49,253,194,0,0,1,0,121,0,
+0,4,23,5,180,0,10,0,0,1,33,34,7,7,35,19,33,21,1,35,3,104,253,230,110,9,8,
+86,10,3,148,254,8,154,5,16,104,102,1,114,59,250,135,0,3,0,94,255,236,4,27,
+5,203,0,25,0,37,0,48,0,0,19,52,54,54,55,38,38,53,52,54,54,51,50,22,21,20,
+6,7,22,22,21,20,4,35,34,38,1,52,38,35,34,6,21,20,22,23,54,54,19,52,38,39,
+6,21,20,22,51,50,54,94,78,132,102,126,139,93,199,151,184,219,115,161,164,
+176,254,249,229,213,252,2,199,124,110,109,128,117,159,107,88,59,164,196,211,
+142,134,131,164,1,111,93,136,96,49,71,182,122,100,166,101,193,160,109,156,
+81,78,189,126,191,220,210,3,177,118,133,133,112,97,139,74,53,133,253,97,105,
+156,85,114,220,131,153,150,0,0,2,0,104,255,233,3,252,5,203,0,26,0,38,0,0,
+55,52,54,55,22,51,50,18,19,6,6,35,34,38,53,52,18,51,50,18,17,20,2,6,35,34,
+38,1,2,2,35,34,6,21,20,22,51,54,54,168,37,24,70,168,168,163,11,50,152,99,
+191,213,240,199,230,247,116,249,190,160,137,2,131,4,142,122,109,119,117,121,
+94,134,154,36,54,8,162,1,44,1,56,61,78,221,195,228,1,20,254,151,254,185,226,
+254,142,222,102,3,3,1,8,1,0,192,179,166,149,1,94,0,0,2,0,166,255,242,1,168,
+4,84,0,7,0,15,0,0,19,52,51,50,21,20,35,34,17,52,51,50,21,20,35,34,166,129,
+129,129,129,129,129,129,129,3,201,139,139,140,253,64,139,139,139,0,0,2,0,
+98,254,197,1,178,4,84,0,7,0,25,0,0,19,52,51,50,21,20,35,34,3,54,53,52,38,
+39,38,38,53,52,54,51,50,22,21,20,6,7,166,129,129,129,129,68,195,31,32,54,
+33,75,58,70,88,162,174,3,201,139,139,140,251,222,63,121,25,28,18,29,53,35,
+57,64,99,79,140,210,51,0,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,53,1,21,1,
+1,21,133,3,111,253,80,2,176,2,184,72,1,217,137,254,139,254,143,137,0,0,2,
+0,133,1,213,3,244,3,225,0,3,0,7,0,0,19,33,21,33,17,33,21,33,133,3,111,252,
+145,3,111,252,145,3,225,121,254,230,121,0,0,1,0,133,0,225,3,244,4,217,0,6,
+0,0,19,1,1,53,1,21,1,133,2,176,253,80,3,111,252,145,1,106,1,113,1,117,137,
+254,39,72,254,41,0,2,0,88,255,242,3,152,5,203,0,23,0,32,0,0,1,54,54,53,52,
+38,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,21,35,3,52,51,50,21,20,6,
+35,34,1,141,167,147,110,114,120,109,76,94,200,183,203,246,200,198,125,69,
+129,129,72,57,129,2,211,67,222,135,111,124,145,117,69,64,109,121,204,167,
+163,224,82,231,254,225,139,139,74,65,0,0,1,0,205,254,250,2,150,6,20,0,13,
+0,0,19,33,21,35,34,6,21,17,20,22,51,51,21,33,205,1,201,89,95,72,72,95,89,
+254,55,6,20,86,71,76,250,184,75,72,86,0,0,1,0,0,255,8,2,78,6,20,0,3,0,0,17,
+51,1,35,119,1,215,121,6,20,248,244,0,1,0,76,254,250,2,20,6,20,0,13,0,0,23,
+51,50,54,53,17,52,38,35,35,53,33,17,33,76,88,96,72,73,95,88,1,200,254,56,
+176,71,76,5,72,76,71,86,248,230,0,0,1,0,104,2,33,4,14,5,182,0,6,0,0,1,51,
+1,35,1,1,35,2,23,71,1,176,137,254,180,254,185,138,5,182,252,107,2,217,253,
+39,0,1,255,246,254,221,3,182,255,86,0,3,0,0,7,33,21,33,10,3,192,252,64,170,
+121,0,0,1,0,102,254,250,3,6,6,20,0,35,0,0,37,17,52,38,39,53,54,54,53,17,52,
+54,51,51,21,35,34,6,21,17,20,6,7,21,22,22,21,17,20,22,51,51,21,35,34,38,1,
+88,127,115,114,128,151,144,135,61,89,79,116,112,115,113,80,88,61,135,142,
+153,33,1,100,117,95,5,86,3,96,116,1,101,140,152,88,106,109,254,162,102,132,
+18,2,19,131,104,254,158,107,108,88,158,0,1,1,254,254,20,2,121,6,20,0,3,0,
+0,1,51,17,35,1,254,123,123,6,20,248,0,0,1,0,102,254,250,3,6,6,20,0,35,0,0,
+23,51,50,54,53,17,52,54,55,53,38,38,53,17,52,38,35,35,53,51,50,22,21,17,20,
+22,23,21,6,6,21,17,20,6,35,35,102,62,88,80,113,114,111,116,79,89,62,136,143,
+151,129,113,114,128,152,142,136,174,108,107,1,98,104,131,19,2,18,132,102,
+1,94,109,106,88,152,140,254,155,116,96,3,86,5,95,117,254,156,137,158,0,0,
+1,0,111,2,39,4,8,3,141,0,25,0,0,1,50,22,23,22,22,51,50,54,55,51,6,6,35,34,
+38,39,38,38,35,34,6,7,35,54,54,1,104,67,110,79,57,73,38,54,57,14,123,17,105,
+128,67,114,64,61,73,43,58,59,12,120,14,105,3,141,62,73,52,50,117,120,150,
+208,66,63,58,50,114,123,155,203,0,255,255,0,51,1,225,2,72,2,123,2,6,0,149,
+0,0,0,1,255,246,1,233,4,10,2,98,0,3,0,0,3,33,21,33,10,4,20,251,236,2,98,121,
+0,1,255,246,1,233,8,10,2,98,0,3,0,0,3,33,21,33,10,8,20,247,236,2,98,121,0,
+1,0,115,3,117,1,195,5,184,0,17,0,0,19,52,54,55,21,6,21,20,22,23,22,22,21,
+20,6,35,34,38,115,162,174,195,30,33,42,45,75,59,69,88,4,39,140,210,51,86,
+63,121,25,28,19,22,49,45,57,64,98,0,0,1,0,61,3,115,1,141,5,182,0,17,0,0,19,
+54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,30,33,42,45,75,59,
+69,88,162,174,3,201,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,0,0,2,
+0,115,3,117,3,92,5,184,0,17,0,35,0,0,19,52,54,55,21,6,21,20,22,23,22,22,21,
+20,6,35,34,38,37,52,54,55,21,6,21,20,22,23,22,22,21,20,6,35,34,38,115,162,
+174,195,30,33,42,45,75,59,69,88,1,153,162,174,194,30,33,41,45,74,59,70,88,
+4,39,140,210,51,86,63,121,25,28,19,22,49,45,57,64,98,80,140,210,51,86,63,
+121,25,28,19,22,49,45,57,64,99,0,2,0,61,3,115,3,39,5,182,0,17,0,35,0,0,19,
+54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,37,54,53,52,38,39,38,38,
+53,52,54,51,50,22,21,20,6,7,61,195,30,33,42,45,75,59,69,88,162,174,1,154,
+195,30,33,42,45,74,59,70,88,162,174,3,201,63,121,25,28,19,22,49,45,57,64,
+98,80,140,210,51,86,63,121,25,28,19,22,49,45,57,64,99,79,140,210,51,0,3,0,
+164,255,242,6,57,1,8,0,8,0,17,0,25,0,0,55,52,51,50,21,20,6,35,34,37,52,51,
+50,21,20,6,35,34,37,52,51,50,21,20,35,34,164,129,129,72,57,129,2,74,129,129,
+72,57,129,2,73,129,129,129,129,125,139,139,74,65,139,139,139,74,65,139,139,
+139,139,0,0,1,0,145,1,51,3,229,4,137,0,11,0,0,19,1,1,55,1,1,23,1,1,7,1,1,
+145,1,84,254,172,86,1,84,1,84,86,254,172,1,84,86,254,172,254,172,1,139,1,
+84,1,82,86,254,172,1,86,88,254,172,254,172,86,1,84,254,172,0,0,3,0,133,0,
+231,3,244,4,209,0,7,0,11,0,19,0,0,1,52,51,50,21,20,35,34,5,33,21,33,1,52,
+51,50,21,20,35,34,1,213,104,105,105,104,254,176,3,111,252,145,1,80,104,105,
+105,104,4,96,113,113,112,215,121,254,184,113,113,113,0,1,0,133,2,160,3,244,
+3,25,0,3,0,0,19,33,21,33,133,3,111,252,145,3,25,121,0,1,0,86,2,74,2,203,5,
+203,0,29,0,0,19,37,54,53,52,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,7,
+7,33,50,54,55,55,51,3,33,86,1,4,160,121,70,65,75,73,151,132,144,161,99,124,
+217,1,41,43,40,7,8,70,6,253,145,2,166,233,144,190,156,100,78,37,51,79,93,
+115,106,98,158,105,186,45,39,43,255,0,0,0,1,0,82,2,61,2,207,5,203,0,43,0,
+0,19,52,54,51,20,22,51,50,53,52,38,35,35,53,51,50,54,53,52,35,34,21,34,38,
+53,52,54,51,50,22,21,20,6,7,21,22,22,21,20,6,6,35,34,38,82,51,43,96,78,182,
+108,109,67,67,81,102,117,135,77,75,154,133,138,165,116,93,107,137,108,165,
+90,131,143,2,229,45,56,77,99,178,74,83,84,98,79,139,178,37,51,79,93,109,94,
+84,110,27,10,19,88,100,94,121,54,91,0,2,0,33,2,76,3,8,5,193,0,20,0,26,0,0,
+1,51,50,54,53,53,33,53,1,51,17,51,21,35,21,20,22,51,51,21,33,19,53,52,55,
+7,3,1,0,57,40,44,254,148,1,127,164,196,196,45,41,41,254,61,141,11,31,223,
+2,145,31,47,113,61,2,52,253,231,88,113,47,31,69,1,92,231,72,80,59,254,188,
+0,255,255,0,86,0,0,2,203,3,129,2,7,0,188,0,0,253,182,255,255,0,82,255,235,
+2,207,3,121,2,7,0,189,0,0,253,174,255,255,0,33,0,0,3,8,3,117,2,7,0,190,0,
+0,253,180,0,0,0,0,0,15,0,186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,32,
+0,94,0,3,0,1,4,9,0,2,0,14,0,126,0,3,0,1,4,9,0,3,0,70,0,140,0,3,0,1,4,9,0,
+4,0,32,0,94,0,3,0,1,4,9,0,5,0,30,0,210,0,3,0,1,4,9,0,6,0,28,0,240,0,3,0,1,
+4,9,0,7,0,68,1,12,0,3,0,1,4,9,0,8,0,42,1,80,0,3,0,1,4,9,0,9,0,38,1,122,0,
+3,0,1,4,9,0,10,0,96,1,160,0,3,0,1,4,9,0,11,0,62,2,0,0,3,0,1,4,9,0,12,0,60,
+2,62,0,3,0,1,4,9,0,13,2,150,2,122,0,3,0,1,4,9,0,14,0,52,5,16,0,67,0,111,0,
+112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,54,0,32,0,71,
+0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,
+108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,
+114,0,118,0,101,0,100,0,46,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,
+105,0,102,0,32,0,84,0,97,0,109,0,105,0,108,0,82,0,101,0,103,0,117,0,108,0,
+97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,
+97,0,103,0,105,0,110,0,103,0,32,0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,
+0,101,0,114,0,105,0,102,0,32,0,84,0,97,0,109,0,105,0,108,0,86,0,101,0,114,
+0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,49,0,32,0,117,0,104,0,78,0,
+111,0,116,0,111,0,83,0,101,0,114,0,105,0,102,0,84,0,97,0,109,0,105,0,108,
+0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,
+100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,
+103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,
+110,0,99,0,46,0,73,0,110,0,100,0,105,0,97,0,110,0,32,0,84,0,121,0,112,0,101,
+0,32,0,70,0,111,0,117,0,110,0,100,0,114,0,121,0,68,0,97,0,116,0,97,0,32,0,
+117,0,110,0,104,0,105,0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,
+0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,
+0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,
+0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,
+0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,
+0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,
+0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,
+0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,
+0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,
+114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,32,0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,
+0,117,0,116,0,101,0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,
+83,0,32,0,73,0,83,0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,
+0,84,0,72,0,79,0,85,0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,
+0,83,0,32,0,79,0,82,0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,
+0,32,0,79,0,70,0,32,0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,
+0,105,0,116,0,104,0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,
+115,0,32,0,111,0,114,0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,
+0,32,0,83,0,101,0,101,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,
+0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,
+0,112,0,101,0,99,0,105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,
+0,97,0,103,0,101,0,44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,
+0,111,0,110,0,115,0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,
+0,97,0,116,0,105,0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,
+0,105,0,110,0,103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,
+0,111,0,102,0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,
+0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,
+0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,194,0,0,1,2,0,2,0,3,1,
+3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,
+19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,
+1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,
+1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,
+1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,
+1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,
+1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,
+107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,
+1,120,1,121,1,122,1,123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,
+132,1,133,1,134,1,135,1,136,1,137,0,4,0,5,0,6,0,8,0,10,0,11,0,12,0,13,0,14,
+0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,
+0,30,0,31,0,32,0,33,0,34,0,62,0,63,0,64,0,65,0,66,0,94,0,95,0,96,0,97,1,138,
+0,178,0,179,0,182,0,183,0,180,0,181,0,171,0,240,0,184,0,239,0,242,0,243,1,
+139,1,140,1,141,1,142,4,78,85,76,76,3,116,109,65,4,116,109,65,65,3,116,109,
+73,4,116,109,73,73,3,116,109,85,4,116,109,85,85,3,116,109,69,4,116,109,69,
+69,4,116,109,65,73,3,116,109,79,4,116,109,79,79,4,116,109,65,85,5,116,109,
+109,65,65,4,116,109,109,73,5,116,109,109,73,73,4,116,109,109,85,5,116,109,
+109,85,85,4,116,109,109,69,5,116,109,109,69,69,5,116,109,109,65,73,4,116,
+109,109,79,5,116,109,109,79,79,5,116,109,109,65,85,14,116,109,65,85,108,101,
+110,103,116,104,109,97,114,107,4,116,109,75,65,5,116,109,78,71,65,4,116,109,
+67,65,5,116,109,78,89,65,5,116,109,84,84,65,5,116,109,78,78,65,4,116,109,
+84,65,4,116,109,78,65,4,116,109,80,65,4,116,109,77,65,4,116,109,89,65,4,116,
+109,82,65,4,116,109,76,65,4,116,109,86,65,6,116,109,76,76,76,65,5,116,109,
+76,76,65,5,116,109,82,82,65,6,116,109,78,78,78,65,4,116,109,74,65,5,116,109,
+83,72,65,5,116,109,83,83,65,4,116,109,83,65,4,116,109,72,65,6,116,109,75,
+83,83,65,10,116,109,65,110,117,115,118,97,114,97,9,116,109,86,105,115,97,
+114,103,97,8,116,109,86,105,114,97,109,97,4,116,109,79,109,6,116,109,90,101,
+114,111,5,116,109,79,110,101,5,116,109,84,119,111,7,116,109,84,104,114,101,
+101,6,116,109,70,111,117,114,6,116,109,70,105,118,101,5,116,109,83,105,120,
+7,116,109,83,101,118,101,110,7,116,109,69,105,103,104,116,6,116,109,78,105,
+110,101,5,116,109,84,101,110,12,116,109,79,110,101,104,117,110,100,114,101,
+100,13,116,109,79,110,101,116,104,111,117,115,97,110,100,5,116,109,68,97,
+121,7,116,109,77,111,110,116,104,6,116,109,89,101,97,114,7,116,109,68,101,
+98,105,116,8,116,109,67,114,101,100,105,116,9,116,109,65,115,97,98,111,118,
+101,7,116,109,82,117,112,101,101,8,116,109,78,117,109,98,101,114,7,117,110,
+105,48,57,54,52,7,117,110,105,48,57,54,53,7,117,110,105,50,48,66,57,7,117,
+110,105,50,48,48,66,7,117,110,105,50,48,48,67,7,117,110,105,50,48,48,68,7,
+117,110,105,50,53,67,67,5,116,109,84,84,73,4,116,109,76,73,4,116,109,83,73,
+6,116,109,78,71,73,73,6,116,109,84,84,73,73,5,116,109,80,73,73,5,116,109,
+89,73,73,5,116,109,76,73,73,5,116,109,86,73,73,5,116,109,83,73,73,4,116,109,
+75,85,5,116,109,78,71,85,4,116,109,67,85,5,116,109,78,89,85,5,116,109,84,
+84,85,5,116,109,78,78,85,4,116,109,84,85,4,116,109,78,85,4,116,109,80,85,
+4,116,109,77,85,4,116,109,89,85,4,116,109,82,85,4,116,109,76,85,4,116,109,
+86,85,6,116,109,76,76,76,85,5,116,109,76,76,85,5,116,109,82,82,85,6,116,109,
+78,78,78,85,5,116,109,75,85,85,6,116,109,78,71,85,85,5,116,109,67,85,85,6,
+116,109,78,89,85,85,6,116,109,84,84,85,85,6,116,109,78,78,85,85,5,116,109,
+84,85,85,5,116,109,78,85,85,5,116,109,80,85,85,5,116,109,77,85,85,5,116,109,
+89,85,85,5,116,109,82,85,85,5,116,109,76,85,85,5,116,109,86,85,85,7,116,109,
+76,76,76,85,85,6,116,109,76,76,85,85,6,116,109,82,82,85,85,7,116,109,78,78,
+78,85,85,7,116,109,83,72,82,73,73,7,116,109,109,73,46,48,49,7,116,109,109,
+73,46,48,50,8,116,109,109,73,73,46,48,49,8,116,109,109,73,73,46,48,50,7,116,
+109,109,85,46,48,49,7,116,109,109,85,46,48,50,8,116,109,109,85,85,46,48,49,
+8,116,109,109,85,85,46,48,50,7,117,110,105,48,48,65,68,12,102,111,117,114,
+115,117,112,101,114,105,111,114,11,116,119,111,105,110,102,101,114,105,111,
+114,13,116,104,114,101,101,105,110,102,101,114,105,111,114,12,102,111,117,
+114,105,110,102,101,114,105,111,114,0,0,0,0,0,2,0,8,0,2,255,255,0,3,0,1,0,
+0,0,12,0,0,0,0,0,0,0,1,0,54,0,1,0,3,0,1,0,0,0,10,0,72,0,146,0,3,68,70,76,
+84,0,20,116,97,109,108,0,34,116,109,108,50,0,48,0,4,0,0,0,0,255,255,0,2,0,
+0,0,3,0,4,0,0,0,0,255,255,0,2,0,1,0,4,0,4,0,0,0,0,255,255,0,2,0,2,0,5,0,6,
+97,98,118,109,0,38,97,98,118,109,0,44,97,98,118,109,0,50,100,105,115,116,
+0,56,100,105,115,116,0,62,100,105,115,116,0,68,0,0,0,1,0,1,0,0,0,1,0,1,0,
+0,0,1,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,2,0,6,0,14,0,2,0,0,0,1,0,
+16,0,4,0,0,0,1,0,104,0,2,1,46,0,4,0,0,1,100,1,182,0,5,0,8,0,0,254,212,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,0,100,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,56,0,0,0,0,0,0,0,0,1,44,0,0,
+0,0,0,200,0,200,0,1,0,244,0,250,0,1,0,12,0,18,0,1,0,0,0,56,0,24,0,56,0,62,
+0,68,0,74,0,80,0,86,0,56,0,92,0,98,0,104,0,110,0,116,0,122,0,128,0,104,0,
+134,0,140,0,146,0,152,0,158,0,164,0,170,0,176,0,182,0,1,0,0,4,110,0,1,3,147,
+4,110,0,1,4,25,4,110,0,1,3,137,4,110,0,1,5,109,4,110,0,1,4,71,4,110,0,1,7,
+51,4,110,0,1,3,96,4,110,0,1,3,152,4,110,0,1,3,251,4,110,0,1,4,41,4,110,0,
+1,2,228,4,110,0,1,4,103,4,110,0,1,4,141,4,110,0,1,4,233,4,110,0,1,3,92,4,
+110,0,1,5,139,4,110,0,1,4,14,4,110,0,1,4,161,4,110,0,1,6,3,4,110,0,1,5,131,
+4,110,0,1,6,50,4,110,0,1,7,179,4,110,0,1,0,17,0,5,0,7,0,8,0,18,0,30,0,87,
+0,89,0,90,0,91,0,93,0,113,0,120,0,122,0,125,0,133,0,180,0,182,0,1,0,1,0,54,
+0,2,0,1,0,28,0,51,0,0,0,2,0,13,0,5,0,5,0,1,0,7,0,7,0,2,0,8,0,8,0,3,0,18,0,
+18,0,4,0,30,0,30,0,2,0,87,0,87,0,4,0,89,0,91,0,4,0,93,0,93,0,4,0,113,0,113,
+0,1,0,120,0,120,0,1,0,122,0,122,0,1,0,125,0,125,0,1,0,133,0,133,0,4,0,2,0,
+16,0,4,0,5,0,1,0,64,0,64,0,1,0,139,0,139,0,7,0,145,0,145,0,3,0,146,0,146,
+0,6,0,148,0,148,0,4,0,149,0,149,0,5,0,150,0,150,0,4,0,162,0,163,0,2,0,167,
+0,167,0,7,0,170,0,170,0,3,0,175,0,175,0,3,0,178,0,179,0,5,0,181,0,181,0,6,
+0,183,0,183,0,6,0,184,0,184,0,4,0,0,0,1,0,0,0,10,0,84,0,236,0,3,68,70,76,
+84,0,20,116,97,109,108,0,38,116,109,108,50,0,56,0,4,0,0,0,0,255,255,0,4,0,
+0,0,3,0,6,0,9,0,4,0,0,0,0,255,255,0,4,0,1,0,4,0,7,0,10,0,4,0,0,0,0,255,255,
+0,4,0,2,0,5,0,8,0,11,0,12,97,107,104,110,0,74,97,107,104,110,0,80,97,107,
+104,110,0,86,112,115,116,115,0,92,112,115,116,115,0,100,112,115,116,115,0,
+108,115,117,98,115,0,116,115,117,98,115,0,122,115,117,98,115,0,128,115,117,
+112,115,0,134,115,117,112,115,0,140,115,117,112,115,0,146,0,0,0,1,0,0,0,0,
+0,1,0,0,0,0,0,1,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,
+1,0,4,0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,3,0,0,0,1,0,3,0,0,0,1,0,3,0,7,0,16,
+0,24,0,32,0,44,0,52,0,60,0,68,0,4,0,0,0,1,0,60,0,4,0,0,0,1,0,104,0,6,0,0,
+0,3,2,34,2,52,2,70,0,1,0,0,0,1,2,76,0,1,0,0,0,1,2,74,0,1,0,0,0,1,2,72,0,1,
+0,0,0,1,2,78,0,1,2,84,0,3,0,12,0,24,0,38,0,1,0,4,0,51,0,3,0,54,0,48,0,1,0,
+4,0,130,0,4,0,54,0,39,0,18,0,1,0,4,0,130,0,4,0,54,0,39,0,18,0,1,2,42,0,19,
+0,44,0,62,0,88,0,106,0,124,0,158,0,176,0,194,0,212,0,238,1,0,1,26,1,44,1,
+78,1,104,1,122,1,140,1,158,1,176,0,2,0,6,0,12,0,94,0,2,0,19,0,112,0,2,0,20,
+0,3,0,8,0,14,0,20,0,87,0,2,0,18,0,95,0,2,0,19,0,113,0,2,0,20,0,2,0,6,0,12,
+0,96,0,2,0,19,0,114,0,2,0,20,0,2,0,6,0,12,0,97,0,2,0,19,0,115,0,2,0,20,0,
+4,0,10,0,16,0,22,0,28,0,84,0,2,0,17,0,88,0,2,0,18,0,98,0,2,0,19,0,116,0,2,
+0,20,0,2,0,6,0,12,0,99,0,2,0,19,0,117,0,2,0,20,0,2,0,6,0,12,0,100,0,2,0,19,
+0,118,0,2,0,20,0,2,0,6,0,12,0,101,0,2,0,19,0,119,0,2,0,20,0,3,0,8,0,14,0,
+20,0,89,0,2,0,18,0,102,0,2,0,19,0,120,0,2,0,20,0,2,0,6,0,12,0,103,0,2,0,19,
+0,121,0,2,0,20,0,3,0,8,0,14,0,20,0,90,0,2,0,18,0,104,0,2,0,19,0,122,0,2,0,
+20,0,2,0,6,0,12,0,105,0,2,0,19,0,123,0,2,0,20,0,4,0,10,0,16,0,22,0,28,0,85,
+0,2,0,17,0,91,0,2,0,18,0,106,0,2,0,19,0,124,0,2,0,20,0,3,0,8,0,14,0,20,0,
+92,0,2,0,18,0,107,0,2,0,19,0,125,0,2,0,20,0,2,0,6,0,12,0,108,0,2,0,19,0,126,
+0,2,0,20,0,2,0,6,0,12,0,109,0,2,0,19,0,127,0,2,0,20,0,2,0,6,0,12,0,110,0,
+2,0,19,0,128,0,2,0,20,0,2,0,6,0,12,0,111,0,2,0,19,0,129,0,2,0,20,0,2,0,6,
+0,12,0,86,0,2,0,17,0,93,0,2,0,18,0,3,0,1,0,120,0,1,0,136,0,0,0,1,0,0,0,5,
+0,3,0,1,0,126,0,1,0,132,0,0,0,1,0,0,0,5,0,3,0,1,0,122,0,1,0,130,0,0,0,1,0,
+0,0,6,0,1,0,122,0,34,0,1,0,116,0,37,0,2,0,100,0,4,0,131,0,133,0,135,0,137,
+0,2,0,86,0,4,0,132,0,134,0,136,0,138,0,1,0,3,0,28,0,47,0,49,0,2,0,2,0,28,
+0,45,0,0,0,49,0,49,0,18,0,1,0,6,0,37,0,42,0,44,0,46,0,47,0,50,0,1,0,2,0,17,
+0,18,0,1,0,1,0,49,0,1,0,2,0,19,0,20,0,1,0,2,0,48,0,51,0,2,0,1,0,17,0,20,0,
+0,0,2,0,1,0,154,0,156,0,0,};
+#endif
@@ -0,0 +1,6585 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifTelugu_Regular_ttf_size = 157544;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifTelugu_Regular_ttf");
+asm(".type fz_font_NotoSerifTelugu_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifTelugu_Regular_ttf, 157544");
+asm(".balign 64");
+asm("fz_font_NotoSerifTelugu_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifTelugu-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifTelugu_Regular_ttf_size = 157544;
+const char fz_font_NotoSerifTelugu_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,3,42,3,21,0,2,57,24,0,0,0,40,71,80,
+79,83,240,57,95,211,0,2,57,64,0,0,9,224,71,83,85,66,73,204,241,58,0,2,67,
+32,0,0,36,70,79,83,47,50,121,95,103,189,0,0,1,104,0,0,0,96,99,109,97,112,
+49,173,34,3,0,0,12,72,0,0,1,128,103,97,115,112,0,7,0,7,0,2,57,12,0,0,0,12,
+103,108,121,102,73,129,188,135,0,0,24,76,0,2,4,26,104,101,97,100,14,145,238,
+195,0,0,0,236,0,0,0,54,104,104,101,97,16,53,6,232,0,0,1,36,0,0,0,36,104,109,
+116,120,79,16,13,196,0,0,1,200,0,0,10,128,108,111,99,97,2,180,108,228,0,0,
+13,200,0,0,10,132,109,97,120,112,2,183,1,76,0,0,1,72,0,0,0,32,110,97,109,
+101,140,192,185,99,0,2,28,104,0,0,6,4,112,111,115,116,96,14,91,2,0,2,34,108,
+0,0,22,157,0,1,0,0,0,1,2,143,68,141,66,9,95,15,60,245,0,11,8,0,0,0,0,0,211,
+97,97,0,0,0,0,0,211,110,67,4,250,39,251,211,14,124,7,94,0,0,0,9,0,2,0,1,0,
+0,0,0,0,1,0,0,7,143,251,144,0,0,14,144,250,39,250,39,14,124,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,160,0,1,0,0,2,160,0,192,0,16,0,138,0,4,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,1,0,4,6,76,1,144,0,5,0,0,5,51,4,204,0,0,0,153,5,51,4,
+204,0,0,2,204,0,50,2,101,0,0,2,2,5,2,4,5,4,2,2,4,0,32,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,71,79,79,71,0,64,0,0,254,255,7,143,251,144,0,0,7,143,4,112,0,0,0,
+1,0,0,0,0,3,255,4,245,0,0,0,32,0,4,4,205,0,193,0,0,0,0,2,68,0,0,2,68,0,0,
+6,40,0,80,5,211,0,80,5,38,0,60,7,22,0,45,5,204,0,80,7,243,0,80,10,93,0,65,
+12,191,0,65,6,18,0,50,8,94,0,60,5,106,0,70,5,106,0,70,5,121,0,80,5,101,0,
+75,5,101,0,75,5,101,0,75,1,232,252,24,0,0,252,124,0,0,252,124,2,149,255,112,
+4,217,255,107,2,239,255,11,4,179,255,11,0,0,252,15,0,0,251,212,0,0,252,44,
+0,0,252,44,0,0,251,167,0,0,250,113,0,0,250,113,0,0,250,227,0,0,255,7,0,0,
+251,101,3,239,0,35,5,236,0,40,4,165,0,100,8,6,0,70,5,23,0,65,5,115,0,65,5,
+115,0,65,5,38,0,75,9,190,0,80,6,180,0,60,5,153,0,80,4,147,0,80,5,182,0,80,
+5,182,0,80,6,144,0,75,6,74,0,80,5,81,0,80,5,81,0,80,5,81,0,80,5,131,0,70,
+5,127,0,75,5,127,0,75,5,113,0,75,5,93,0,75,8,27,0,75,9,132,0,80,4,147,0,80,
+5,99,0,80,5,144,0,75,4,132,0,40,6,96,0,75,5,118,0,90,7,140,0,75,5,224,0,80,
+4,197,0,70,3,239,0,35,5,81,0,20,5,20,0,52,3,231,0,65,2,74,0,70,2,88,0,55,
+0,0,252,181,5,102,0,52,5,141,0,120,5,49,0,125,6,16,0,15,4,56,0,75,5,184,0,
+60,6,79,0,84,4,162,0,100,4,142,0,80,5,199,0,120,4,202,0,100,4,160,0,70,1,
+208,0,150,2,238,0,50,5,21,0,75,5,20,0,100,4,121,0,75,4,229,0,92,5,12,0,68,
+1,208,0,150,3,160,0,150,4,121,0,121,0,0,0,0,0,0,255,213,0,0,255,33,4,193,
+0,98,2,242,0,0,0,0,254,31,0,0,254,145,0,0,253,182,0,0,254,151,2,254,254,112,
+2,254,254,112,0,0,254,150,0,0,253,46,0,0,253,237,0,0,254,115,0,0,254,199,
+0,0,254,106,0,0,254,106,0,0,254,39,0,0,253,220,0,0,254,90,0,0,254,90,0,0,
+254,90,3,3,255,56,3,27,254,192,3,27,254,192,3,35,255,136,3,35,255,136,1,240,
+255,156,2,197,0,0,0,0,253,10,0,0,254,53,3,19,255,6,2,154,255,156,0,0,254,
+9,3,71,255,6,0,0,253,197,0,0,254,50,3,4,255,106,0,0,254,217,3,246,0,35,5,
+236,0,40,4,135,0,85,8,6,0,70,5,23,0,65,5,115,0,65,5,115,0,65,5,38,0,75,9,
+190,0,80,6,180,0,60,5,153,0,80,4,135,0,80,5,182,0,80,5,182,0,80,6,144,0,75,
+6,74,0,80,5,81,0,80,5,82,0,80,5,81,0,80,5,131,0,70,5,117,0,75,5,127,0,75,
+5,113,0,75,5,113,0,75,8,27,0,75,9,132,0,80,4,147,0,80,5,99,0,80,5,144,0,75,
+4,132,0,40,6,96,0,75,5,118,0,90,7,140,0,75,5,224,0,80,4,197,0,70,3,239,0,
+35,6,37,0,35,8,14,0,40,6,172,0,85,10,15,0,70,6,201,0,65,7,110,0,65,7,110,
+0,65,7,55,0,75,11,191,0,80,8,234,0,60,7,145,0,80,6,155,0,80,7,108,0,80,7,
+108,0,80,8,175,0,75,8,93,0,80,7,58,0,80,7,58,0,80,7,58,0,80,7,146,0,70,7,
+230,0,75,7,230,0,75,7,88,0,75,7,88,0,75,10,46,0,75,11,140,0,80,6,155,0,80,
+7,89,0,80,7,140,0,75,7,13,0,40,7,230,0,75,7,236,0,90,7,140,0,75,8,0,0,80,
+6,170,0,70,6,37,0,35,3,246,0,35,6,43,0,40,4,135,0,85,8,6,0,70,5,23,0,65,5,
+135,0,65,5,140,0,65,5,38,0,75,9,190,0,80,6,180,0,60,5,153,0,80,4,147,0,80,
+5,182,0,80,5,182,0,80,6,144,0,75,6,74,0,80,5,81,0,80,5,82,0,80,5,81,0,80,
+5,98,0,70,5,127,0,75,5,127,0,75,5,216,0,75,5,216,0,75,8,87,0,75,9,132,0,80,
+4,147,0,80,5,184,0,80,5,200,0,75,4,192,0,40,6,96,0,75,5,118,0,90,7,140,0,
+75,5,224,0,80,4,199,0,70,3,239,0,35,3,208,0,17,6,43,0,40,4,135,0,85,8,6,0,
+70,5,23,0,65,5,135,0,65,5,140,0,65,5,38,0,75,9,190,0,80,6,180,0,60,5,153,
+0,80,4,147,0,80,5,182,0,80,5,182,0,80,6,144,0,75,6,74,0,80,5,81,0,80,5,82,
+0,80,5,81,0,80,5,98,0,70,5,117,0,75,5,127,0,75,5,216,0,75,5,216,0,75,8,87,
+0,75,11,188,0,80,4,147,0,80,5,184,0,80,5,200,0,75,4,192,0,40,6,96,0,75,5,
+118,0,90,7,140,0,75,5,224,0,80,4,199,0,70,3,239,0,35,6,122,0,35,8,113,0,40,
+7,19,0,100,10,141,0,70,7,159,0,65,7,252,0,65,7,252,0,65,6,92,0,52,12,70,0,
+80,9,253,0,60,8,32,0,80,7,21,0,80,8,60,0,80,8,60,0,80,9,11,0,75,8,190,0,80,
+7,214,0,80,7,214,0,80,7,214,0,80,8,10,0,70,7,54,0,59,7,54,0,59,7,246,0,75,
+7,224,0,75,10,159,0,75,12,9,0,80,7,15,0,80,7,217,0,80,7,83,0,75,7,55,0,40,
+8,15,0,75,7,246,0,90,10,253,0,75,8,97,0,80,7,90,0,70,6,122,0,35,8,195,0,35,
+10,186,0,40,9,92,0,100,12,214,0,70,9,232,0,65,10,69,0,65,10,69,0,65,8,223,
+0,52,14,144,0,80,12,74,0,60,10,104,0,80,9,95,0,80,10,133,0,80,10,133,0,80,
+11,84,0,75,10,255,0,80,10,31,0,80,10,31,0,80,10,31,0,80,10,83,0,70,9,163,
+0,59,9,163,0,59,10,63,0,75,10,41,0,75,12,232,0,75,14,82,0,80,9,88,0,80,10,
+34,0,80,9,137,0,75,9,134,0,40,10,75,0,75,10,63,0,90,13,77,0,75,10,170,0,80,
+9,169,0,70,8,195,0,35,3,246,0,35,5,199,0,40,4,135,0,85,8,227,0,100,5,23,0,
+65,5,115,0,65,5,115,0,65,5,38,0,75,9,190,0,80,6,180,0,60,5,153,0,80,4,147,
+0,80,5,182,0,80,5,182,0,80,6,144,0,75,6,74,0,80,5,81,0,80,5,82,0,80,5,81,
+0,80,5,131,0,70,6,72,0,100,6,72,0,100,5,113,0,75,5,113,0,75,8,27,0,75,9,132,
+0,80,4,147,0,80,5,59,0,80,5,144,0,75,4,151,0,40,7,51,0,100,6,63,0,100,8,95,
+0,100,5,224,0,80,4,137,0,70,3,239,0,35,3,246,0,35,5,199,0,40,4,135,0,85,8,
+227,0,100,5,23,0,65,5,115,0,65,5,115,0,65,5,38,0,75,9,190,0,80,6,180,0,60,
+5,153,0,80,4,147,0,80,5,182,0,80,5,182,0,80,6,114,0,75,6,74,0,80,5,81,0,80,
+5,82,0,80,5,82,0,80,5,131,0,70,6,72,0,100,6,72,0,100,5,113,0,75,5,113,0,75,
+7,255,0,59,9,132,0,80,4,147,0,80,5,59,0,80,5,144,0,75,4,151,0,40,7,51,0,100,
+6,63,0,100,8,172,0,100,5,224,0,80,4,137,0,70,3,239,0,35,3,246,0,35,5,219,
+0,40,4,179,0,85,8,237,0,100,5,23,0,52,5,115,0,65,5,115,0,31,5,38,0,52,9,190,
+0,52,6,180,0,30,5,153,0,50,4,147,0,68,5,182,0,68,5,182,0,4,6,144,0,75,6,74,
+0,80,5,81,255,246,5,82,0,71,5,81,255,252,5,131,0,70,6,72,0,100,6,72,0,100,
+5,113,0,75,5,113,0,6,8,27,0,75,9,132,0,80,4,147,0,50,5,99,0,80,5,144,0,75,
+4,151,0,40,7,52,0,100,6,63,0,100,8,95,0,100,5,224,0,80,4,137,0,22,3,239,0,
+2,5,247,0,35,8,89,0,40,6,74,0,85,11,85,0,100,7,58,0,65,6,121,0,65,6,121,0,
+65,7,126,0,75,12,82,0,80,9,109,0,60,7,230,0,80,6,61,0,80,6,233,0,80,6,233,
+0,80,8,46,0,75,8,85,0,80,6,179,0,80,6,179,0,80,6,179,0,80,7,31,0,70,7,230,
+0,75,7,230,0,75,7,44,0,75,7,44,0,75,10,165,0,75,12,4,0,80,6,93,0,80,8,8,0,
+80,6,200,0,75,7,90,0,40,7,230,0,75,7,237,0,90,10,52,0,75,7,223,0,80,7,70,
+0,70,5,247,0,35,5,247,0,35,8,89,0,40,6,74,0,85,10,224,0,100,7,59,0,65,6,121,
+0,65,6,121,0,65,7,126,0,75,11,191,0,80,9,109,0,60,7,230,0,80,6,101,0,80,6,
+233,0,80,6,233,0,80,8,45,0,75,8,85,0,80,6,179,0,80,6,179,0,80,6,179,0,80,
+7,31,0,70,7,230,0,75,8,12,0,75,7,44,0,75,7,44,0,75,10,46,0,75,11,149,0,80,
+6,92,0,80,8,8,0,80,6,200,0,75,7,91,0,40,8,13,0,76,7,237,0,90,10,52,0,75,7,
+223,0,80,7,70,0,70,5,246,0,33,5,162,0,17,7,142,0,40,6,53,0,85,9,96,0,60,6,
+196,0,65,6,167,0,65,6,167,0,65,7,29,0,75,11,80,0,80,8,201,0,60,7,187,0,80,
+6,55,0,80,7,168,0,80,7,168,0,80,8,155,0,75,8,52,0,80,7,88,0,80,7,88,0,80,
+7,88,0,80,7,69,0,70,7,231,0,75,7,231,0,75,7,129,0,75,7,129,0,75,9,129,0,75,
+11,54,0,80,6,35,0,80,7,168,0,80,7,112,0,75,7,116,0,40,7,233,0,75,7,240,0,
+90,10,4,0,75,7,242,0,80,7,18,0,70,5,180,0,35,3,248,0,20,5,188,0,20,3,26,0,
+20,3,233,0,20,3,5,0,20,4,188,0,20,2,250,0,20,4,167,0,20,4,167,0,20,2,251,
+0,20,5,204,0,20,4,77,0,20,3,65,0,20,2,153,0,20,3,84,0,20,3,84,0,20,3,217,
+0,20,2,48,253,125,3,116,0,20,3,116,0,20,3,116,0,20,4,153,0,20,4,116,0,20,
+4,116,0,20,3,180,0,20,3,180,0,20,2,184,0,20,3,1,0,20,2,250,0,36,3,190,0,20,
+4,53,0,20,2,244,0,20,3,234,0,20,4,35,0,20,4,157,0,20,3,195,0,20,3,114,0,20,
+2,143,0,20,0,0,253,81,0,0,253,220,0,0,253,115,0,0,253,10,0,0,252,160,0,0,
+252,55,0,0,251,205,0,0,251,100,0,0,250,250,0,0,250,145,0,0,250,39,2,170,0,
+211,3,68,0,117,4,121,0,51,7,43,0,92,1,195,0,117,2,197,0,117,2,197,0,66,4,
+0,0,84,4,121,0,133,2,0,0,61,2,123,0,51,2,0,0,127,2,78,0,0,4,121,0,92,4,121,
+0,135,4,121,0,104,4,121,0,119,4,121,0,35,4,121,0,113,4,121,0,125,4,121,0,
+121,4,121,0,94,4,121,0,104,2,74,0,166,2,74,0,98,4,121,0,133,4,121,0,133,4,
+121,0,133,4,0,0,88,2,225,0,205,2,78,0,0,2,225,0,76,4,121,0,104,3,172,255,
+246,3,109,0,102,4,121,1,254,3,109,0,102,4,121,0,111,2,123,0,51,4,0,255,246,
+8,0,255,246,2,0,0,115,2,0,0,61,3,154,0,115,3,154,0,61,6,221,0,164,4,121,0,
+145,4,121,0,133,4,121,0,133,5,115,2,85,0,0,0,1,0,3,0,1,0,0,0,12,0,4,1,116,
+0,0,0,80,0,64,0,5,0,16,0,0,0,13,0,35,0,37,0,63,0,95,0,126,0,160,0,173,0,215,
+0,247,9,101,12,3,12,11,12,12,12,16,12,20,12,40,12,48,12,51,12,57,12,61,12,
+68,12,72,12,77,12,86,12,89,12,99,12,111,12,127,32,13,32,20,32,25,32,29,32,
+38,32,185,34,18,37,204,254,255,255,255,0,0,0,0,0,13,0,32,0,37,0,39,0,91,0,
+123,0,160,0,173,0,215,0,247,9,100,12,1,12,5,12,12,12,14,12,18,12,21,12,42,
+12,49,12,53,12,61,12,62,12,70,12,74,12,85,12,88,12,96,12,102,12,120,32,11,
+32,19,32,24,32,28,32,38,32,185,34,18,37,204,254,255,255,255,0,1,255,245,0,
+0,2,76,2,75,2,48,2,21,255,99,1,231,1,197,1,166,246,254,0,0,243,255,244,0,
+244,0,243,255,244,16,244,15,0,0,244,12,244,18,243,214,243,215,0,0,243,206,
+243,241,0,0,243,234,243,226,224,90,226,130,226,127,226,125,226,117,223,171,
+224,140,218,156,1,102,0,1,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,52,0,0,0,0,0,54,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,110,2,111,2,112,0,76,0,
+75,0,77,0,70,0,64,0,71,0,32,0,33,0,34,0,78,0,11,0,13,0,27,0,28,0,0,0,0,0,
+0,0,42,0,0,0,42,0,0,0,42,0,0,0,42,0,0,0,228,0,0,1,173,0,0,2,97,0,0,3,109,
+0,0,4,33,0,0,5,71,0,0,6,95,0,0,7,188,0,0,8,104,0,0,9,79,0,0,9,213,0,0,10,
+141,0,0,11,66,0,0,11,238,0,0,12,194,0,0,13,207,0,0,14,39,0,0,14,146,0,0,15,
+38,0,0,15,112,0,0,15,248,0,0,16,143,0,0,17,105,0,0,18,7,0,0,18,221,0,0,19,
+37,0,0,19,145,0,0,19,167,0,0,20,65,0,0,21,0,0,0,21,117,0,0,21,179,0,0,22,
+9,0,0,22,163,0,0,23,134,0,0,24,0,0,0,24,250,0,0,25,180,0,0,26,81,0,0,26,103,
+0,0,27,65,0,0,28,62,0,0,29,6,0,0,29,189,0,0,30,88,0,0,31,26,0,0,31,48,0,0,
+32,9,0,0,32,252,0,0,33,197,0,0,34,93,0,0,34,115,0,0,35,13,0,0,35,193,0,0,
+35,215,0,0,36,136,0,0,37,109,0,0,38,76,0,0,39,47,0,0,39,171,0,0,40,63,0,0,
+40,236,0,0,41,178,0,0,42,139,0,0,43,46,0,0,44,39,0,0,44,254,0,0,45,241,0,
+0,46,224,0,0,47,201,0,0,48,239,0,0,49,66,0,0,49,120,0,0,50,5,0,0,50,90,0,
+0,50,203,0,0,51,54,0,0,51,150,0,0,52,16,0,0,52,131,0,0,53,26,0,0,53,241,0,
+0,54,82,0,0,54,202,0,0,55,50,0,0,55,149,0,0,56,18,0,0,56,43,0,0,56,103,0,
+0,56,192,0,0,56,218,0,0,57,60,0,0,57,237,0,0,58,108,0,0,58,133,0,0,58,157,
+0,0,59,8,0,0,59,8,0,0,59,33,0,0,59,92,0,0,61,103,0,0,61,234,0,0,62,187,0,
+0,63,8,0,0,63,196,0,0,64,122,0,0,64,255,0,0,65,145,0,0,66,99,0,0,67,31,0,
+0,67,226,0,0,68,126,0,0,68,235,0,0,69,132,0,0,70,43,0,0,70,255,0,0,71,87,
+0,0,71,241,0,0,72,95,0,0,72,217,0,0,73,105,0,0,73,242,0,0,74,136,0,0,75,58,
+0,0,75,249,0,0,76,145,0,0,77,89,0,0,77,156,0,0,78,11,0,0,78,200,0,0,79,103,
+0,0,80,4,0,0,80,123,0,0,81,56,0,0,81,251,0,0,82,192,0,0,83,128,0,0,84,54,
+0,0,85,77,0,0,85,221,0,0,86,239,0,0,87,237,0,0,88,168,0,0,88,190,0,0,89,203,
+0,0,90,224,0,0,91,236,0,0,92,225,0,0,93,147,0,0,94,105,0,0,94,127,0,0,95,
+147,0,0,96,161,0,0,97,130,0,0,98,49,0,0,98,243,0,0,99,168,0,0,100,115,0,0,
+101,79,0,0,102,64,0,0,102,86,0,0,103,78,0,0,104,75,0,0,104,222,0,0,105,177,
+0,0,106,117,0,0,107,85,0,0,108,71,0,0,109,3,0,0,110,21,0,0,111,44,0,0,112,
+56,0,0,113,66,0,0,113,238,0,0,115,19,0,0,115,174,0,0,116,237,0,0,117,238,
+0,0,118,171,0,0,118,193,0,0,119,210,0,0,121,22,0,0,122,38,0,0,123,30,0,0,
+123,221,0,0,124,181,0,0,124,203,0,0,125,218,0,0,126,238,0,0,127,208,0,0,128,
+132,0,0,128,154,0,0,129,86,0,0,130,47,0,0,130,69,0,0,131,56,0,0,131,78,0,
+0,132,116,0,0,133,158,0,0,134,61,0,0,135,16,0,0,135,219,0,0,136,192,0,0,137,
+190,0,0,138,134,0,0,139,167,0,0,140,192,0,0,141,200,0,0,142,203,0,0,143,153,
+0,0,144,183,0,0,145,71,0,0,146,114,0,0,147,132,0,0,148,52,0,0,148,74,0,0,
+149,75,0,0,150,96,0,0,151,128,0,0,152,132,0,0,153,56,0,0,154,38,0,0,154,60,
+0,0,155,109,0,0,156,140,0,0,157,111,0,0,158,34,0,0,158,229,0,0,159,147,0,
+0,160,120,0,0,160,142,0,0,161,125,0,0,161,147,0,0,162,137,0,0,163,73,0,0,
+163,222,0,0,164,173,0,0,165,112,0,0,166,69,0,0,167,80,0,0,168,34,0,0,169,
+76,0,0,170,123,0,0,171,126,0,0,172,160,0,0,173,147,0,0,174,217,0,0,175,149,
+0,0,176,232,0,0,178,34,0,0,178,250,0,0,179,16,0,0,180,57,0,0,181,124,0,0,
+182,196,0,0,183,240,0,0,184,208,0,0,185,230,0,0,185,252,0,0,187,85,0,0,188,
+156,0,0,189,173,0,0,190,142,0,0,191,127,0,0,192,85,0,0,193,96,0,0,194,124,
+0,0,195,147,0,0,195,169,0,0,196,199,0,0,197,204,0,0,198,141,0,0,199,132,0,
+0,200,111,0,0,201,108,0,0,202,158,0,0,203,154,0,0,204,236,0,0,206,67,0,0,
+207,110,0,0,208,184,0,0,209,139,0,0,210,167,0,0,211,93,0,0,212,147,0,0,213,
+135,0,0,214,97,0,0,214,119,0,0,215,146,0,0,216,203,0,0,217,224,0,0,218,210,
+0,0,219,170,0,0,220,167,0,0,220,189,0,0,221,208,0,0,222,254,0,0,224,3,0,0,
+224,215,0,0,224,237,0,0,225,194,0,0,226,182,0,0,227,186,0,0,228,166,0,0,229,
+199,0,0,230,226,0,0,232,2,0,0,232,187,0,0,233,136,0,0,234,115,0,0,235,113,
+0,0,236,117,0,0,237,85,0,0,238,145,0,0,239,163,0,0,240,215,0,0,241,255,0,
+0,243,13,0,0,244,102,0,0,245,87,0,0,246,201,0,0,247,248,0,0,249,13,0,0,249,
+35,0,0,250,113,0,0,251,231,0,0,253,61,0,0,254,108,0,0,255,131,0,1,0,188,0,
+1,0,210,0,1,2,34,0,1,3,141,0,1,4,208,0,1,5,226,0,1,5,248,0,1,7,8,0,1,8,60,
+0,1,9,128,0,1,10,167,0,1,12,3,0,1,13,90,0,1,14,183,0,1,15,174,0,1,16,184,
+0,1,17,228,0,1,19,35,0,1,20,102,0,1,21,129,0,1,22,255,0,1,24,78,0,1,25,196,
+0,1,27,39,0,1,27,206,0,1,28,230,0,1,29,105,0,1,30,112,0,1,31,96,0,1,32,11,
+0,1,32,33,0,1,33,30,0,1,34,36,0,1,35,31,0,1,36,6,0,1,36,170,0,1,37,117,0,
+1,37,139,0,1,38,149,0,1,39,147,0,1,40,104,0,1,41,11,0,1,41,192,0,1,42,100,
+0,1,43,35,0,1,43,59,0,1,44,30,0,1,44,52,0,1,45,30,0,1,46,15,0,1,46,148,0,
+1,47,79,0,1,48,5,0,1,48,213,0,1,49,188,0,1,50,108,0,1,51,114,0,1,52,119,0,
+1,53,115,0,1,54,110,0,1,55,57,0,1,56,118,0,1,57,30,0,1,58,74,0,1,59,95,0,
+1,60,47,0,1,60,69,0,1,61,103,0,1,62,146,0,1,63,178,0,1,64,190,0,1,65,135,
+0,1,66,119,0,1,66,141,0,1,67,189,0,1,68,225,0,1,69,219,0,1,70,163,0,1,70,
+185,0,1,71,130,0,1,72,102,0,1,72,126,0,1,73,134,0,1,73,156,0,1,74,170,0,1,
+75,192,0,1,76,106,0,1,77,76,0,1,78,39,0,1,79,29,0,1,80,40,0,1,80,253,0,1,
+82,40,0,1,83,82,0,1,84,115,0,1,85,147,0,1,86,135,0,1,87,232,0,1,88,181,0,
+1,90,6,0,1,91,64,0,1,92,53,0,1,93,59,0,1,94,130,0,1,95,211,0,1,97,25,0,1,
+98,74,0,1,99,58,0,1,100,80,0,1,101,118,0,1,102,203,0,1,104,20,0,1,105,51,
+0,1,106,32,0,1,107,31,0,1,108,11,0,1,109,20,0,1,110,44,0,1,111,89,0,1,112,
+151,0,1,113,203,0,1,115,6,0,1,115,214,0,1,116,219,0,1,117,217,0,1,118,243,
+0,1,120,36,0,1,121,31,0,1,122,111,0,1,123,191,0,1,125,4,0,1,126,65,0,1,127,
+62,0,1,128,161,0,1,129,123,0,1,130,185,0,1,131,251,0,1,132,254,0,1,133,20,
+0,1,134,111,0,1,135,169,0,1,136,252,0,1,138,53,0,1,139,48,0,1,140,80,0,1,
+140,102,0,1,141,198,0,1,143,27,0,1,144,69,0,1,145,63,0,1,146,74,0,1,147,66,
+0,1,148,90,0,1,148,112,0,1,149,168,0,1,149,190,0,1,150,221,0,1,152,3,0,1,
+152,223,0,1,153,244,0,1,155,2,0,1,156,42,0,1,157,103,0,1,158,110,0,1,159,
+233,0,1,161,72,0,1,162,156,0,1,163,238,0,1,165,16,0,1,166,155,0,1,167,154,
+0,1,168,230,0,1,170,79,0,1,171,119,0,1,171,141,0,1,173,13,0,1,174,90,0,1,
+175,210,0,1,177,47,0,1,178,79,0,1,179,147,0,1,179,169,0,1,181,46,0,1,182,
+168,0,1,183,247,0,1,185,22,0,1,185,44,0,1,186,71,0,1,187,132,0,1,187,154,
+0,1,188,247,0,1,189,13,0,1,190,102,0,1,191,191,0,1,192,192,0,1,193,250,0,
+1,195,44,0,1,196,121,0,1,197,219,0,1,199,7,0,1,200,169,0,1,202,45,0,1,203,
+166,0,1,205,29,0,1,205,241,0,1,207,55,0,1,207,235,0,1,209,71,0,1,210,101,
+0,1,211,67,0,1,211,89,0,1,212,138,0,1,213,230,0,1,215,19,0,1,216,44,0,1,216,
+254,0,1,217,249,0,1,218,15,0,1,219,73,0,1,220,119,0,1,221,125,0,1,222,82,
+0,1,223,57,0,1,224,17,0,1,225,9,0,1,225,31,0,1,226,51,0,1,226,73,0,1,227,
+139,0,1,228,215,0,1,229,138,0,1,230,122,0,1,231,101,0,1,232,102,0,1,233,131,
+0,1,234,106,0,1,235,190,0,1,236,243,0,1,238,28,0,1,239,69,0,1,239,220,0,1,
+240,182,0,1,240,198,0,1,240,216,0,1,240,234,0,1,240,252,0,1,241,14,0,1,241,
+32,0,1,241,50,0,1,241,68,0,1,241,86,0,1,241,104,0,1,241,122,0,1,241,140,0,
+1,241,158,0,1,241,176,0,1,241,194,0,1,242,26,0,1,242,44,0,1,242,62,0,1,242,
+80,0,1,242,98,0,1,242,116,0,1,242,134,0,1,242,152,0,1,242,170,0,1,242,186,
+0,1,242,202,0,1,243,55,0,1,243,73,0,1,243,91,0,1,243,107,0,1,243,125,0,1,
+243,143,0,1,243,161,0,1,243,179,0,1,243,197,0,1,243,215,0,1,244,96,0,1,244,
+154,0,1,244,217,0,1,245,28,0,1,245,101,0,1,245,172,0,1,245,243,0,1,246,58,
+0,1,246,129,0,1,246,204,0,1,247,25,0,1,247,71,0,1,247,112,0,1,247,223,0,1,
+248,124,0,1,248,150,0,1,248,215,0,1,249,24,0,1,249,103,0,1,249,151,0,1,249,
+211,0,1,249,237,0,1,250,12,0,1,250,40,0,1,250,131,0,1,250,206,0,1,251,51,
+0,1,251,172,0,1,252,10,0,1,252,118,0,1,252,229,0,1,253,21,0,1,253,170,0,1,
+254,39,0,1,254,90,0,1,254,171,0,1,254,210,0,1,254,249,0,1,255,35,0,1,255,
+129,0,1,255,178,0,1,255,204,0,1,255,253,0,2,0,37,0,2,0,62,0,2,0,166,0,2,0,
+192,0,2,1,39,0,2,1,124,0,2,1,140,0,2,1,166,0,2,1,192,0,2,1,253,0,2,2,58,0,
+2,2,168,0,2,3,22,0,2,3,93,0,2,3,160,0,2,3,228,0,2,3,254,0,2,4,26,0,2,0,193,
+0,0,4,10,5,182,0,3,0,7,0,0,19,33,17,33,37,17,33,17,193,3,73,252,183,2,225,
+253,135,5,182,250,74,104,4,230,251,26,0,2,0,80,255,230,5,216,3,255,0,50,0,
+62,0,0,1,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,
+4,33,32,36,53,52,38,35,34,6,21,20,22,23,7,33,53,33,38,38,53,52,54,51,50,22,
+22,37,20,22,51,50,54,53,52,38,35,34,6,5,216,254,156,254,146,254,173,254,157,
+226,182,122,144,136,115,113,133,6,90,1,42,1,46,1,77,1,41,130,104,60,70,88,
+92,30,253,220,1,163,73,91,135,116,114,157,78,251,148,78,59,57,73,76,62,55,
+74,2,39,254,209,254,238,1,31,1,30,212,1,8,135,115,117,138,133,115,25,22,95,
+150,176,185,168,198,136,161,68,59,68,102,51,92,104,41,137,75,108,128,135,
+216,74,67,73,76,64,64,74,73,0,3,0,80,255,230,5,146,3,255,0,46,0,58,0,70,0,
+0,1,22,21,20,6,4,35,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,
+20,4,33,50,54,53,52,39,33,53,51,38,53,52,54,51,50,22,21,20,6,37,20,22,51,
+50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,4,246,79,129,254,
+253,187,254,173,254,157,226,182,122,144,136,115,113,133,6,90,1,42,1,46,212,
+211,39,254,96,226,71,140,111,124,155,81,252,43,78,59,57,73,76,62,55,74,3,
+171,76,62,55,74,78,59,57,73,2,5,77,109,99,162,96,1,31,1,30,212,1,8,135,115,
+117,138,133,115,25,22,95,150,176,185,92,104,60,39,104,77,96,109,135,148,117,
+82,133,203,67,73,76,64,64,74,73,65,64,74,73,65,67,73,76,0,2,0,60,255,231,
+4,224,3,255,0,53,0,64,0,0,37,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,
+50,23,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,
+22,23,54,54,51,50,22,21,20,7,22,39,38,35,34,6,21,20,22,51,50,54,4,224,23,
+91,21,54,77,240,126,145,201,219,186,210,137,32,117,95,79,105,24,75,24,114,
+92,90,91,58,77,111,162,125,100,166,33,27,136,98,127,155,48,107,227,116,188,
+129,133,121,102,104,181,128,81,71,19,72,67,99,74,152,180,170,124,127,149,
+85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,123,164,133,104,105,132,
+201,164,130,129,107,90,75,70,58,57,71,98,0,4,0,45,255,230,6,198,5,226,0,64,
+0,71,0,80,0,90,0,0,1,20,6,35,34,38,53,52,55,39,35,22,21,20,0,35,34,0,53,52,
+55,35,53,51,54,54,55,38,39,55,22,23,55,54,0,55,23,0,7,22,22,23,33,50,23,54,
+53,52,38,35,34,6,7,39,53,52,54,51,50,22,21,20,7,22,22,37,33,38,38,35,34,6,
+5,33,21,20,22,51,50,54,53,5,52,39,6,21,20,22,51,50,54,6,198,141,109,100,123,
+148,37,226,5,254,236,230,231,254,238,5,100,120,35,162,118,129,65,216,46,61,
+12,95,1,57,109,99,254,238,199,137,187,38,1,0,70,62,67,35,31,35,51,12,58,106,
+89,78,102,146,72,74,250,89,2,205,31,186,142,141,187,2,189,253,23,198,174,
+176,197,2,68,101,111,52,46,48,66,1,125,118,151,124,106,148,92,1,47,38,238,
+254,226,1,31,237,38,47,92,119,170,36,126,149,12,151,114,1,71,1,38,118,99,
+255,0,140,28,178,130,16,44,64,37,39,45,40,18,12,112,133,105,80,126,93,39,
+130,215,119,137,136,212,22,165,189,187,167,138,103,38,70,94,48,50,68,0,2,
+0,80,255,230,5,184,4,191,0,49,0,61,0,0,1,6,21,20,22,51,50,55,51,22,22,23,
+38,53,52,54,51,50,22,21,20,6,35,32,39,6,6,35,34,38,38,53,52,18,54,55,39,51,
+7,22,23,7,38,38,35,34,6,7,33,21,1,20,22,51,50,54,53,52,38,35,34,6,1,20,65,
+114,89,175,60,64,32,132,113,96,130,105,118,145,204,143,254,254,106,57,148,
+92,81,140,83,150,253,152,16,235,15,153,146,44,87,155,91,117,215,78,4,89,254,
+40,73,67,65,73,74,64,64,76,2,169,105,122,110,143,216,109,101,5,53,125,96,
+119,149,123,143,206,230,130,100,108,192,122,162,1,6,166,26,203,195,11,80,
+76,43,35,83,75,92,254,199,59,78,74,55,62,76,73,0,3,0,80,255,230,7,163,4,191,
+0,84,0,94,0,106,0,0,1,20,6,35,34,38,53,52,55,39,33,6,21,20,22,51,50,55,51,
+22,22,23,38,53,52,54,51,50,22,21,20,6,35,32,39,6,6,35,34,38,53,52,18,55,39,
+51,7,54,51,23,39,51,7,22,23,7,38,38,35,34,6,7,33,50,23,54,53,52,38,35,34,
+6,7,39,53,52,54,51,50,22,21,20,7,22,22,7,52,39,6,21,20,22,51,50,54,5,20,22,
+51,50,54,53,52,38,35,34,6,7,163,141,109,100,123,148,37,250,221,67,108,95,
+175,60,64,32,132,113,96,130,105,118,145,204,143,254,254,106,57,148,92,137,
+167,206,182,29,235,9,53,43,36,8,235,26,67,73,44,87,155,91,123,213,76,4,230,
+70,62,67,35,31,35,51,12,58,106,89,78,102,146,72,74,136,101,111,52,46,48,66,
+252,197,73,67,65,73,74,64,64,76,1,220,118,151,124,106,148,92,1,114,140,109,
+114,216,109,101,5,53,125,96,119,149,123,143,206,230,130,100,212,177,206,1,
+65,76,249,197,5,1,193,223,20,40,79,43,35,84,77,16,44,64,37,39,45,40,18,12,
+112,133,105,80,126,93,39,130,37,103,38,70,94,48,50,68,97,59,78,74,55,62,76,
+73,0,1,0,65,255,230,10,13,4,8,0,102,0,0,1,20,6,6,35,34,3,6,6,35,34,39,6,6,
+35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,
+38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,
+52,38,35,55,50,22,18,21,7,22,51,50,54,53,52,38,35,55,50,22,18,21,7,22,22,
+51,50,54,53,52,38,35,55,50,22,18,10,13,85,145,87,211,148,36,157,99,196,142,
+40,150,91,99,149,56,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,
+156,125,122,165,79,124,75,62,28,82,68,175,60,64,34,114,89,111,126,173,203,
+5,143,221,122,3,129,141,109,128,173,203,5,143,221,122,1,72,146,82,109,128,
+173,203,5,143,221,122,1,170,137,205,110,1,7,124,139,228,108,120,101,129,130,
+100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,134,
+97,72,108,91,54,52,50,36,60,68,216,115,101,168,145,160,191,167,157,254,236,
+173,70,155,169,144,160,191,167,157,254,236,173,33,96,96,169,144,160,191,167,
+157,254,236,0,2,0,65,255,230,12,141,4,9,0,117,0,129,0,0,1,20,6,35,34,38,53,
+52,55,33,22,21,20,6,35,34,39,6,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,
+52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,
+6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,35,55,50,22,18,21,20,
+7,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,35,
+55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,12,141,137,115,113,135,32,
+254,215,127,165,164,203,146,36,158,117,189,138,41,145,87,99,149,56,57,148,
+92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,79,124,75,
+62,28,82,68,175,60,64,34,114,89,111,126,173,203,5,143,221,122,5,61,135,84,
+105,127,222,235,6,168,1,2,140,1,70,148,96,118,126,229,240,14,15,3,8,126,132,
+108,57,123,72,63,61,71,76,57,66,68,2,209,116,137,126,106,65,51,139,237,214,
+252,246,115,131,210,100,110,101,129,130,100,147,111,88,134,99,61,88,47,50,
+70,71,57,48,36,36,33,92,46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,
+115,101,168,145,160,191,167,157,254,236,173,42,48,68,67,154,127,172,202,9,
+168,8,169,254,237,161,43,89,87,130,117,185,173,10,165,21,67,108,89,64,74,
+72,66,67,73,73,0,1,0,50,255,231,5,174,4,4,0,60,0,0,1,16,2,35,34,38,53,52,
+54,54,55,62,2,53,52,38,35,34,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,22,23,54,54,51,50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,53,52,39,55,22,
+5,174,242,193,130,180,56,80,64,52,61,40,85,86,170,55,75,24,114,92,90,91,58,
+77,111,162,125,100,168,31,28,148,113,122,145,53,76,60,67,64,78,69,151,182,
+87,90,99,2,77,254,241,254,169,151,106,64,104,75,49,40,54,66,37,54,61,156,
+71,85,89,66,74,68,37,99,135,123,164,134,103,105,132,147,125,61,99,71,46,51,
+71,42,50,59,237,200,183,190,17,208,0,2,0,60,255,231,8,44,3,255,0,72,0,84,
+0,0,1,20,6,35,34,38,53,52,55,35,22,21,16,2,35,34,38,53,52,54,54,55,62,2,53,
+52,38,35,34,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,
+50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,53,52,39,33,50,22,7,52,38,35,34,6,
+21,20,22,51,50,54,8,44,137,115,113,135,32,190,30,242,193,130,180,56,80,64,
+52,61,40,85,86,170,55,75,24,114,92,90,91,58,77,111,162,125,100,168,31,28,
+148,113,122,145,56,78,61,78,47,78,69,151,182,82,1,214,169,173,123,72,63,61,
+71,76,57,66,68,2,229,116,137,126,106,65,51,121,126,254,241,254,169,151,106,
+64,104,75,49,40,54,66,37,54,61,156,71,85,89,66,74,68,37,99,135,123,164,134,
+103,105,132,147,125,69,105,72,43,57,62,33,50,59,237,200,175,194,144,147,64,
+74,72,66,67,73,73,0,2,0,70,255,230,5,21,4,184,0,30,0,42,0,0,1,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,2,37,55,4,0,
+1,52,38,35,34,6,21,20,22,51,50,54,5,21,171,147,108,167,54,26,155,104,136,
+163,165,132,98,141,33,75,161,100,103,102,235,254,246,79,1,3,1,28,253,18,97,
+83,81,97,92,84,86,96,1,150,199,233,126,88,104,110,169,141,136,175,97,80,116,
+101,131,120,196,1,99,125,80,124,254,92,254,177,81,97,96,83,77,93,88,0,3,0,
+70,255,230,5,21,5,165,0,17,0,48,0,60,0,0,1,38,38,53,52,54,51,50,23,7,38,35,
+34,6,21,20,22,23,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,2,37,55,4,0,1,52,38,35,34,6,21,20,22,51,50,54,2,41,56,57,
+119,92,49,43,21,27,26,58,70,45,54,2,149,171,147,108,167,54,26,155,104,136,
+163,165,132,98,141,33,75,161,100,103,102,235,254,246,79,1,3,1,28,253,18,97,
+83,81,97,92,84,86,96,3,195,68,123,70,98,123,12,104,7,67,61,56,89,66,253,177,
+199,233,126,88,104,110,169,141,136,175,97,80,116,101,131,120,196,1,99,125,
+80,124,254,92,254,177,81,97,96,83,77,93,88,0,2,0,80,255,230,5,41,3,255,0,
+50,0,62,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,38,35,34,7,35,38,38,35,34,6,7,39,54,54,51,50,22,23,54,54,51,
+50,22,18,1,52,38,35,34,6,21,20,22,51,50,54,5,41,89,154,93,108,160,54,25,155,
+104,136,163,165,132,98,141,33,75,161,100,100,136,138,117,175,76,75,33,122,
+75,80,123,48,64,28,171,112,93,147,31,30,158,98,93,163,102,253,8,97,83,81,
+97,92,84,86,96,1,195,141,217,119,124,90,104,110,169,141,136,175,97,80,116,
+101,181,136,144,174,156,68,88,82,91,33,147,180,128,108,103,133,130,254,254,
+254,206,81,97,96,83,77,93,88,0,1,0,75,255,230,5,31,3,255,0,62,0,0,55,52,54,
+55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,
+2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,35,53,22,22,21,20,6,6,35,34,
+38,39,6,6,35,34,38,87,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,
+79,124,75,62,28,82,68,175,60,64,34,119,101,92,110,107,97,156,179,83,137,79,
+110,154,56,57,148,92,134,174,232,88,134,99,61,88,47,50,70,71,57,48,36,36,
+33,92,46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,117,99,107,86,89,
+108,139,44,219,148,99,158,88,100,130,130,100,147,0,1,0,75,255,230,5,31,5,
+55,0,77,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,
+35,34,6,21,20,23,7,38,38,53,52,54,51,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,22,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,35,
+53,22,22,5,31,83,137,79,110,154,56,57,148,92,134,174,98,138,87,67,68,59,59,
+75,22,74,41,48,158,121,44,131,99,152,145,136,83,68,49,60,8,87,107,79,124,
+75,62,28,82,68,175,60,64,34,119,101,92,110,107,97,156,179,1,63,99,158,88,
+100,130,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,
+103,128,54,65,81,112,119,126,58,55,44,19,18,23,121,76,72,108,91,54,52,50,
+36,60,68,216,117,99,107,86,89,108,139,44,219,0,2,0,75,255,230,5,31,5,45,0,
+87,0,99,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,
+35,34,6,21,20,23,7,38,38,53,52,55,53,33,50,53,52,39,33,55,33,50,30,2,21,20,
+6,35,34,38,53,52,55,35,22,21,20,7,22,21,20,6,7,14,2,21,20,22,51,50,55,51,
+22,22,51,50,54,53,52,38,35,53,22,22,1,20,22,51,50,54,53,52,38,35,34,6,5,31,
+83,137,79,110,154,56,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,
+48,100,1,33,90,28,254,79,15,2,249,126,132,108,57,137,115,113,135,31,177,33,
+76,40,80,123,75,62,28,82,68,175,60,64,34,119,101,92,110,107,97,156,179,254,
+103,76,57,66,68,72,63,61,71,1,63,99,158,88,100,130,130,100,147,111,88,134,
+99,61,88,47,50,70,71,57,48,36,36,33,92,46,118,65,48,73,40,24,165,21,67,108,
+64,116,137,126,106,64,52,43,65,92,48,54,68,71,109,89,54,52,50,36,60,68,216,
+117,99,107,86,89,108,139,44,219,2,61,67,73,73,67,64,74,72,0,2,252,24,2,71,
+1,222,4,72,0,15,0,27,0,0,1,20,6,35,34,38,53,52,55,33,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,1,222,137,115,113,135,31,252,15,15,4,16,126,132,
+108,57,123,72,63,61,71,76,57,66,68,3,68,116,137,126,106,64,52,165,21,67,108,
+89,64,74,72,66,67,73,73,0,1,252,124,3,163,254,227,6,39,0,36,0,0,1,55,22,51,
+50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,51,50,
+22,21,20,6,35,34,38,252,124,55,104,132,107,115,116,94,60,68,57,52,42,61,40,
+34,50,71,57,105,129,142,112,143,169,173,155,66,156,3,245,92,82,117,95,96,
+104,53,50,42,50,20,27,86,26,18,112,91,94,121,175,148,153,168,37,0,1,252,124,
+3,163,254,227,6,244,0,52,0,0,1,20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,
+34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,
+38,35,34,6,21,20,23,54,51,50,22,254,227,172,156,66,156,65,55,104,132,107,
+115,116,94,60,68,59,50,42,59,37,35,43,74,57,106,128,62,56,116,109,205,110,
+87,83,110,72,76,18,51,66,145,168,4,200,140,153,37,45,92,82,104,85,85,92,48,
+45,36,46,18,22,85,21,17,103,86,81,53,54,83,84,105,181,38,93,56,43,36,23,18,
+156,0,1,255,112,255,230,2,82,4,9,0,21,0,0,3,55,22,22,51,50,54,53,52,38,38,
+35,55,22,4,18,21,20,6,35,34,38,144,61,75,156,103,102,127,100,207,151,6,168,
+1,2,140,178,157,136,188,1,68,79,103,99,153,118,98,180,115,168,8,169,254,237,
+161,207,239,178,0,2,255,107,255,230,4,197,3,213,0,34,0,46,0,0,1,20,6,35,34,
+38,53,52,55,33,22,21,20,6,35,34,3,55,22,22,51,50,54,53,52,38,38,35,35,55,
+33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,4,197,137,115,113,135,32,254,
+193,149,176,153,243,160,61,75,156,103,107,125,95,205,157,14,15,3,8,126,132,
+108,57,123,72,63,61,71,76,57,66,68,2,209,116,137,126,106,65,51,145,252,207,
+238,1,94,79,103,99,127,106,105,173,104,165,21,67,108,89,64,74,72,66,67,73,
+73,0,2,255,11,253,12,2,219,3,212,0,36,0,48,0,0,5,20,2,6,35,34,36,53,52,18,
+51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,18,53,16,0,37,55,4,
+0,1,20,22,51,50,54,53,52,38,35,34,6,2,219,131,232,146,204,254,249,222,166,
+122,144,136,115,113,133,6,34,25,188,161,184,201,254,241,254,240,65,1,76,1,
+28,253,56,78,59,57,73,76,62,55,74,129,181,254,226,160,228,175,193,1,7,135,
+115,117,138,133,115,23,23,37,88,62,123,141,1,8,239,1,12,1,224,199,89,250,
+253,214,254,162,67,73,76,64,64,74,73,0,3,255,11,253,12,4,169,3,212,0,51,0,
+63,0,75,0,0,1,20,6,35,34,38,53,52,55,33,22,18,21,20,2,6,35,34,36,53,52,18,
+51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,18,17,16,2,37,55,33,
+50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,20,22,51,50,54,53,52,38,35,34,
+6,4,169,137,115,113,135,31,254,74,206,239,131,231,147,204,254,249,222,166,
+122,144,136,115,113,133,6,34,25,188,161,187,198,251,254,220,65,2,143,126,
+132,108,57,123,72,63,61,71,76,57,66,68,251,229,78,59,57,73,76,62,55,74,2,
+208,116,137,126,106,64,52,168,254,21,255,196,254,214,163,228,175,193,1,7,
+135,115,117,138,133,115,23,23,37,88,62,123,141,1,21,1,0,1,3,1,174,228,89,
+21,67,108,89,64,74,72,66,67,73,73,252,222,67,73,76,64,64,74,73,0,1,252,15,
+252,216,255,116,255,136,0,56,0,0,3,20,6,35,34,38,53,52,54,55,54,54,53,52,
+35,34,7,35,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,21,
+20,6,6,7,6,6,21,20,22,51,50,54,53,52,39,55,22,140,150,119,80,112,49,76,49,
+45,107,105,33,47,35,107,56,56,35,48,68,100,78,64,102,19,17,91,70,80,86,33,
+46,38,42,39,48,43,93,113,54,56,61,254,105,176,225,97,71,47,84,60,40,53,35,
+76,102,102,59,43,49,43,25,66,87,81,107,90,63,68,85,100,78,40,64,46,31,34,
+46,27,33,38,154,131,121,123,11,134,0,2,251,212,252,216,0,207,255,142,0,68,
+0,79,0,0,19,20,6,35,34,38,53,52,55,35,22,21,20,6,35,34,38,53,52,54,55,54,
+54,53,52,35,34,7,35,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,
+50,22,21,20,6,6,7,6,6,21,20,22,51,50,54,53,52,39,33,50,22,7,52,38,35,34,6,
+21,20,22,51,50,207,85,72,74,82,19,118,18,152,121,80,114,48,78,49,47,108,107,
+34,47,33,111,56,58,36,48,70,102,79,66,102,19,18,92,71,80,88,35,48,39,41,38,
+49,43,96,114,52,1,39,106,108,77,45,40,38,44,47,36,84,254,212,76,92,86,68,
+40,36,81,82,179,228,99,71,48,81,65,39,56,35,76,103,103,59,43,48,46,25,67,
+88,82,108,92,64,69,87,101,79,45,70,46,30,31,43,27,33,39,157,132,113,132,95,
+98,42,49,47,44,45,48,0,1,252,44,3,163,255,107,5,118,0,21,0,0,1,51,50,54,54,
+53,52,38,38,35,33,55,33,50,22,22,21,20,6,6,35,35,253,117,159,100,77,37,40,
+84,104,254,38,15,1,152,178,155,75,76,131,147,148,3,255,19,45,37,39,48,22,
+165,57,109,76,68,109,48,0,1,252,44,3,163,255,145,6,162,0,36,0,0,3,20,6,6,
+35,35,53,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,
+34,6,21,20,23,30,2,149,76,131,147,148,159,100,77,37,40,84,104,254,38,15,1,
+124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,4,132,68,109,48,92,19,
+45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,25,4,63,104,255,255,251,
+167,253,179,0,75,5,118,2,38,0,29,0,0,0,6,0,36,66,0,0,2,250,113,3,154,255,
+246,5,155,0,44,0,56,0,0,3,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,
+34,6,21,20,22,51,51,21,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,
+2,7,52,38,35,34,6,21,20,22,51,50,54,10,137,115,113,135,31,143,95,102,21,62,
+22,105,100,9,74,88,84,110,40,35,152,170,147,122,18,109,121,32,38,128,120,
+161,125,131,106,55,123,72,63,61,71,76,57,66,68,4,151,116,137,126,106,64,52,
+82,106,90,98,62,63,61,61,92,130,117,115,142,96,79,87,88,22,68,105,90,64,74,
+72,66,67,73,73,0,2,250,113,3,154,0,28,6,199,0,59,0,71,0,0,3,20,6,35,34,38,
+53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,21,35,34,38,53,52,54,
+51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,
+3,7,52,38,35,34,6,21,20,22,51,50,54,10,137,115,113,135,31,143,95,102,21,62,
+22,105,100,9,74,88,84,110,40,35,152,170,147,122,18,109,119,34,38,128,120,
+142,29,112,109,181,101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,
+57,66,68,4,151,116,137,126,106,64,52,82,106,90,98,62,63,61,61,92,130,117,
+115,142,95,80,87,88,47,60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,
+72,66,67,73,73,0,2,250,227,3,44,255,246,5,45,0,28,0,40,0,0,3,20,6,35,34,38,
+53,52,55,35,22,21,20,6,35,7,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,
+34,6,21,20,22,51,50,54,10,137,115,113,135,31,218,25,112,91,172,161,99,28,
+254,18,15,3,93,126,132,108,57,123,72,63,61,71,76,57,66,68,4,41,116,137,126,
+106,64,52,35,43,65,84,1,91,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,
+0,1,255,7,3,198,1,13,5,98,0,17,0,0,3,52,54,51,50,22,23,7,38,35,34,6,21,20,
+23,7,38,38,249,120,100,105,140,53,87,77,105,66,71,82,57,61,76,4,149,93,112,
+101,90,38,93,62,47,85,23,59,22,111,0,2,251,101,253,179,0,9,255,180,0,15,0,
+27,0,0,19,7,33,34,46,2,53,52,54,51,50,22,21,20,7,39,52,38,35,34,6,21,20,22,
+51,50,54,9,15,253,18,126,132,108,57,137,115,113,135,31,79,76,57,66,68,72,
+63,61,71,254,88,165,21,67,108,64,116,137,126,106,64,52,120,67,73,73,67,64,
+74,72,0,1,0,35,255,230,4,80,5,226,0,48,0,0,19,20,22,23,23,22,22,21,20,6,35,
+32,3,55,22,51,50,54,53,52,38,39,39,38,38,53,52,54,55,38,39,55,22,23,51,54,
+0,55,23,0,7,22,23,7,38,38,35,34,6,223,117,139,123,186,148,227,183,254,191,
+170,100,156,233,127,142,92,109,129,192,178,132,113,119,66,216,47,59,13,94,
+1,55,112,99,254,237,201,160,155,96,94,175,113,126,116,2,254,78,70,11,10,16,
+157,120,147,183,1,19,82,133,74,73,65,73,9,11,16,122,127,85,131,25,119,147,
+12,151,113,70,1,37,120,99,254,255,141,33,117,111,92,91,94,0,4,0,40,254,203,
+5,156,4,8,0,52,0,64,0,74,0,78,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,
+54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,7,
+22,22,51,50,54,53,52,38,35,55,22,22,18,37,52,38,35,34,6,21,20,22,51,50,54,
+3,50,55,38,38,35,34,6,21,20,5,19,35,19,5,156,96,160,94,94,161,129,64,184,
+108,142,164,140,136,84,155,102,73,90,6,133,113,115,136,145,121,181,227,57,
+72,121,85,130,147,173,203,5,156,219,111,252,127,74,55,62,76,73,57,59,78,190,
+137,96,72,124,81,64,74,2,87,70,246,68,1,180,147,208,106,70,107,86,91,127,
+109,111,124,61,60,101,143,150,95,22,25,115,133,138,117,115,135,254,249,213,
+153,132,37,25,154,159,160,191,167,15,164,254,252,154,65,73,74,64,64,76,73,
+254,13,69,55,48,43,40,89,170,254,192,1,64,0,1,0,100,255,245,4,172,5,226,0,
+35,0,0,1,20,7,39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,52,18,55,38,39,
+55,22,23,55,54,0,55,23,0,7,22,18,4,65,87,215,70,75,177,160,159,178,74,70,
+217,85,181,159,130,65,216,46,61,12,94,1,55,112,99,254,237,201,174,195,1,190,
+206,250,10,146,251,148,184,202,199,182,147,254,254,145,11,235,226,208,1,34,
+51,127,149,12,151,114,1,70,1,37,120,99,254,255,141,43,254,213,0,4,0,70,254,
+203,7,182,5,226,0,13,0,65,0,77,0,81,0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,
+38,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,
+5,52,38,35,34,6,21,20,22,51,50,54,23,19,35,19,70,216,47,63,92,1,65,113,99,
+205,254,206,90,70,71,162,7,65,181,158,201,143,36,157,115,108,167,54,26,155,
+104,136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,140,2,
+68,146,93,105,127,222,235,6,168,1,2,140,250,113,97,83,81,97,92,84,86,96,174,
+70,246,68,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,253,19,206,240,
+237,111,126,126,88,104,110,169,141,136,175,97,80,116,101,154,127,172,202,
+9,168,8,169,254,237,161,53,84,82,154,127,172,202,9,168,8,169,254,237,252,
+81,97,96,83,77,93,88,235,254,192,1,64,0,1,0,65,255,230,4,209,3,255,0,67,0,
+0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,
+23,7,38,38,53,52,54,51,50,22,21,20,7,51,39,51,7,51,21,33,6,7,14,2,21,20,22,
+51,50,55,51,22,22,51,50,54,53,52,39,51,22,4,209,148,120,101,139,43,57,148,
+92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,4,179,19,
+141,19,219,253,226,42,116,75,62,28,82,68,175,60,64,40,104,90,80,82,33,120,
+36,1,56,151,187,102,128,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,
+36,36,33,92,46,103,128,132,96,29,20,235,235,88,54,83,54,52,50,36,60,68,216,
+118,98,97,76,80,80,106,0,1,0,65,255,230,5,58,5,226,0,50,0,0,55,52,55,35,53,
+33,23,6,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,36,37,38,38,39,55,22,
+23,54,0,55,23,0,7,22,0,21,20,6,35,34,38,39,6,6,35,34,38,130,164,229,1,102,
+30,92,88,91,83,175,60,64,34,119,90,88,107,254,254,254,253,71,162,47,216,47,
+63,92,1,65,113,99,254,205,197,225,1,0,165,132,115,134,55,57,148,92,124,163,
+252,191,104,104,92,51,102,68,61,76,216,115,101,122,123,220,240,25,43,195,
+106,12,152,119,67,1,45,122,99,254,226,130,43,254,199,230,192,239,109,121,
+130,100,156,255,255,0,65,254,203,5,58,5,226,2,38,0,42,0,0,0,6,2,159,0,0,0,
+1,0,75,255,230,4,219,4,0,0,80,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,
+55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,7,22,51,50,
+54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,39,6,7,14,2,21,20,22,51,
+50,55,51,22,22,51,50,54,53,52,39,51,22,4,219,162,116,99,131,43,57,148,92,
+134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,3,108,136,82,
+75,57,50,39,41,46,70,77,109,135,154,132,168,143,42,120,75,62,28,82,68,175,
+60,64,40,102,88,80,78,34,129,36,1,10,121,171,101,129,130,100,147,111,88,134,
+99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,132,96,43,81,62,44,40,53,
+11,141,24,127,103,112,130,111,57,85,54,52,50,36,60,68,216,118,98,73,62,70,
+62,87,0,3,0,80,254,203,9,110,5,226,0,64,0,76,0,80,0,0,1,20,6,35,34,39,6,6,
+35,34,3,6,6,35,34,0,53,52,18,55,38,39,55,22,23,55,54,0,55,23,0,7,22,18,21,
+20,7,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,
+55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,1,19,35,19,9,110,181,158,205,
+145,36,158,117,219,150,57,238,165,231,254,238,184,156,129,65,216,46,61,12,
+95,1,57,109,99,254,238,199,178,209,8,72,151,100,105,127,222,235,6,168,1,2,
+140,1,70,148,97,105,127,222,235,6,168,1,2,140,250,80,201,172,171,201,198,
+174,176,197,3,57,70,246,68,1,164,206,240,247,116,131,1,26,133,149,1,31,237,
+185,1,14,47,126,149,12,151,114,1,71,1,38,118,99,255,0,140,37,254,235,199,
+53,56,95,93,154,127,172,202,9,168,8,169,254,237,161,42,90,87,154,127,172,
+202,9,168,8,169,254,237,20,171,199,200,170,165,189,187,254,129,254,192,1,
+64,0,2,0,60,255,231,6,150,3,255,0,60,0,71,0,0,1,20,7,22,21,20,7,39,54,53,
+52,39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,7,35,38,38,35,34,
+6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,23,51,39,51,7,51,21,1,
+38,35,34,6,21,20,22,51,50,54,4,165,48,107,23,91,21,54,77,240,126,145,201,
+219,186,210,137,32,117,95,79,105,24,75,24,114,92,90,91,58,77,111,162,125,
+100,166,33,27,136,98,109,146,20,188,19,141,19,213,253,103,116,188,129,133,
+121,102,104,181,2,146,130,129,107,164,81,71,19,72,67,99,74,152,180,170,124,
+127,149,85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,123,164,133,104,
+105,132,151,126,235,235,88,254,236,75,70,58,57,71,98,0,2,0,80,255,230,5,73,
+4,191,0,51,0,63,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,39,51,
+7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,51,50,54,53,
+52,38,39,55,22,18,37,20,22,51,50,54,53,52,38,35,34,6,5,73,96,163,96,88,163,
+48,52,133,84,97,160,93,172,142,17,235,16,85,91,136,115,111,135,10,112,133,
+116,184,61,64,33,141,93,122,138,167,158,5,196,219,252,53,75,57,62,73,73,60,
+60,74,1,203,137,222,126,113,117,122,108,120,226,153,192,1,36,48,210,203,23,
+128,88,117,138,128,106,38,33,126,197,141,158,216,112,104,158,141,179,170,
+16,168,20,254,210,35,67,73,75,65,64,74,72,0,3,0,80,255,230,4,153,5,226,0,
+23,0,35,0,47,0,0,1,20,0,35,34,0,53,52,18,55,38,39,55,22,23,55,54,0,55,23,
+0,7,22,18,7,52,38,35,34,6,21,20,22,51,50,54,39,20,6,35,34,38,53,52,54,51,
+50,22,4,67,254,236,230,231,254,238,184,156,129,65,216,46,61,12,95,1,57,109,
+99,254,238,199,178,209,133,201,172,171,201,198,174,176,197,249,68,55,55,67,
+68,54,54,69,1,242,238,254,226,1,31,237,185,1,14,47,126,149,12,151,114,1,71,
+1,38,118,99,255,0,140,37,254,235,136,171,199,200,170,165,189,187,175,52,68,
+68,52,52,69,69,0,2,0,80,255,230,5,112,5,227,0,52,0,64,0,0,1,20,6,35,32,39,
+6,6,35,34,38,53,52,18,54,55,38,39,55,22,23,55,54,0,55,23,0,7,22,23,7,38,35,
+34,6,6,21,20,22,51,50,55,51,22,22,23,38,53,52,54,51,50,22,7,52,38,35,34,6,
+21,20,22,51,50,54,5,112,204,143,254,254,106,57,148,92,138,166,139,237,145,
+121,69,216,46,61,11,94,1,59,109,99,254,235,193,140,124,62,161,172,145,253,
+152,107,96,175,60,64,32,132,113,96,130,105,118,145,122,74,64,64,76,73,67,
+65,73,1,67,143,206,230,130,100,203,169,172,1,20,178,33,119,152,12,149,117,
+1,71,1,39,118,99,254,253,135,21,82,82,102,132,240,155,101,102,216,109,101,
+5,53,125,96,119,149,86,62,76,73,57,59,78,74,255,255,0,80,254,203,5,112,5,
+227,2,38,0,49,0,0,0,6,2,159,224,0,0,2,0,75,255,230,6,64,3,255,0,67,0,79,0,
+0,1,20,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,
+38,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,
+54,55,38,38,53,52,54,51,50,22,23,54,54,51,50,18,1,52,38,35,34,6,21,20,22,
+51,50,54,6,64,117,182,94,141,186,147,119,104,133,34,141,180,147,107,164,22,
+78,25,149,125,114,120,134,123,62,80,122,145,131,123,124,132,44,139,132,196,
+243,111,93,84,94,204,156,130,194,53,45,182,118,181,236,254,192,74,64,64,76,
+73,67,65,73,1,250,168,241,123,174,134,125,158,128,101,69,58,99,223,150,189,
+127,98,104,121,75,68,68,76,98,77,65,63,79,33,216,44,178,143,87,122,30,35,
+117,72,116,149,128,114,113,129,254,219,254,112,62,76,73,57,59,78,74,0,3,0,
+80,255,230,6,133,5,226,0,56,0,68,0,80,0,0,1,16,0,33,32,0,17,52,18,51,50,22,
+21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,39,22,21,20,6,35,34,
+38,53,52,54,55,38,38,39,55,22,23,54,0,55,23,0,7,22,22,37,20,22,51,50,54,53,
+52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,5,250,254,128,254,171,254,
+171,254,128,234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,41,
+103,14,127,102,113,146,52,48,64,125,38,216,47,63,92,1,65,113,99,254,227,202,
+159,189,251,114,75,57,62,73,73,60,60,74,3,104,74,60,60,73,73,62,57,75,2,45,
+254,236,254,205,1,51,1,20,199,1,11,135,115,117,138,119,98,40,41,41,123,73,
+173,199,199,173,151,95,40,39,102,126,146,112,63,102,29,54,165,86,12,152,119,
+67,1,45,122,99,254,246,140,31,240,16,67,73,75,65,64,74,72,66,66,72,74,64,
+65,75,73,0,4,0,80,254,203,5,1,5,226,0,29,0,46,0,58,0,62,0,0,1,20,6,35,34,
+38,39,6,6,35,34,38,53,52,18,55,38,39,55,22,23,55,54,0,55,23,4,7,22,0,7,52,
+0,35,34,0,21,20,22,51,50,55,51,22,51,50,54,1,20,6,35,34,38,53,52,54,51,50,
+22,3,19,35,19,5,1,172,142,91,152,43,44,153,90,143,171,241,199,125,67,216,
+46,61,12,94,1,55,112,99,254,243,205,213,1,7,131,254,249,207,207,254,250,113,
+94,171,60,63,60,171,94,113,254,171,68,55,55,67,68,54,54,69,74,70,246,68,1,
+135,190,227,119,111,111,119,227,190,224,1,78,53,123,150,12,151,114,1,70,1,
+37,120,99,252,145,44,254,171,161,205,1,6,254,250,205,127,136,216,216,136,
+1,80,52,68,68,52,52,69,69,253,54,254,192,1,64,0,2,0,80,255,230,5,1,5,226,
+0,29,0,46,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,39,55,22,23,
+55,54,0,55,23,4,7,22,0,7,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,54,5,
+1,172,142,91,152,43,44,153,90,143,171,241,199,125,67,216,46,61,12,94,1,55,
+112,99,254,243,205,213,1,7,131,254,249,207,207,254,250,113,94,171,60,63,60,
+171,94,113,1,135,190,227,119,111,111,119,227,190,224,1,78,53,123,150,12,151,
+114,1,70,1,37,120,99,252,145,44,254,171,161,205,1,6,254,250,205,127,136,216,
+216,136,255,255,0,80,254,203,5,1,5,226,2,38,0,54,0,0,0,6,2,159,218,0,0,1,
+0,70,255,230,5,51,5,226,0,49,0,0,1,20,6,35,34,38,39,38,38,35,34,21,20,22,
+23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,53,52,38,38,35,35,38,38,39,55,
+22,23,54,0,55,23,0,7,22,0,5,51,174,179,134,186,84,70,97,57,126,48,37,195,
+21,23,159,129,93,137,87,57,80,101,68,219,131,230,145,54,71,162,47,216,47,
+63,92,1,65,113,99,254,215,203,241,1,23,1,149,197,234,152,160,132,100,185,
+83,179,72,10,65,158,58,150,186,82,116,75,83,49,245,150,219,116,43,195,106,
+12,152,119,67,1,45,122,99,254,234,136,30,254,197,0,3,0,75,255,230,5,47,5,
+226,0,13,0,45,0,57,0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,1,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,
+4,18,5,52,38,35,34,6,21,20,22,51,50,54,75,216,47,63,92,1,65,113,99,205,254,
+206,90,70,71,162,4,181,181,158,108,167,54,26,155,104,136,163,165,132,98,141,
+33,75,161,100,105,127,222,235,6,168,1,2,140,252,253,97,83,81,97,92,84,86,
+96,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,253,19,206,240,126,88,
+104,110,169,141,136,175,97,80,116,101,154,127,172,202,9,168,8,169,254,237,
+252,81,97,96,83,77,93,88,255,255,0,75,254,203,5,47,5,226,2,38,0,57,0,0,0,
+6,2,159,213,0,0,1,0,75,255,230,5,33,4,8,0,63,0,0,55,52,54,55,54,54,53,52,
+38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,
+50,55,51,22,22,51,50,54,53,52,38,35,55,22,22,18,21,20,6,6,35,34,38,39,6,6,
+35,34,38,87,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,79,124,75,
+62,28,82,68,175,60,64,34,114,89,111,126,173,203,5,156,219,111,85,145,87,99,
+149,56,57,148,92,134,174,232,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,
+46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,115,101,168,145,160,191,
+167,15,164,254,252,157,142,209,111,101,129,130,100,147,0,2,0,75,254,203,5,
+208,5,226,0,72,0,76,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,
+53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,
+22,51,50,55,51,22,22,51,50,54,53,52,2,39,38,38,39,55,22,23,54,0,55,23,0,7,
+22,18,1,19,35,19,5,13,166,131,115,134,55,57,148,92,134,174,98,138,87,67,68,
+59,59,75,22,74,41,48,156,125,122,165,79,124,75,62,28,82,68,175,60,64,34,119,
+90,88,107,179,166,71,162,47,216,47,63,92,1,65,113,99,254,184,213,169,177,
+253,220,70,246,68,1,150,190,242,109,121,130,100,147,111,88,134,99,61,88,47,
+50,70,71,57,48,36,36,33,92,46,103,128,134,97,72,108,91,54,52,50,36,60,68,
+216,115,101,138,113,174,1,0,49,43,195,106,12,152,119,67,1,45,122,99,254,204,
+136,73,254,224,253,177,254,192,1,64,0,2,0,75,255,230,7,203,5,226,0,62,0,74,
+0,0,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,38,38,35,35,38,38,39,55,22,23,54,0,55,23,0,7,22,0,21,21,
+22,22,51,50,54,53,52,38,39,55,22,0,1,52,38,35,34,6,21,20,22,51,50,54,7,203,
+165,164,203,144,34,164,130,114,164,55,25,155,104,136,163,165,132,98,141,33,
+75,161,100,114,119,131,230,145,54,71,162,47,216,47,63,92,1,65,113,99,254,
+215,203,241,1,23,69,149,96,118,126,236,233,6,255,1,45,250,97,97,83,81,97,
+92,84,86,96,1,184,214,252,242,114,128,124,90,104,110,169,141,136,175,97,80,
+116,101,127,118,150,219,116,43,195,106,12,152,119,67,1,45,122,99,254,234,
+136,30,254,197,243,28,89,87,130,117,191,216,10,168,7,254,193,254,134,81,97,
+96,83,77,93,88,0,2,0,80,255,230,9,52,5,226,0,63,0,75,0,0,1,20,6,35,34,39,
+6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,
+52,38,39,38,38,39,55,22,23,54,0,55,23,0,7,22,18,21,7,22,22,51,50,54,53,52,
+38,39,55,22,0,5,52,38,35,34,6,21,20,22,51,50,54,9,52,165,164,200,142,35,151,
+113,208,146,61,230,156,231,254,238,120,229,156,155,229,122,14,66,143,92,118,
+126,203,174,71,162,47,216,47,63,92,1,65,113,99,254,190,214,161,174,2,67,146,
+93,118,126,236,233,6,255,1,45,250,138,201,172,171,201,198,174,176,197,1,184,
+214,252,234,112,122,254,120,134,1,31,237,147,239,139,138,239,148,71,67,80,
+79,140,125,180,241,44,43,195,106,12,152,119,67,1,45,122,99,254,209,138,71,
+254,233,186,63,84,82,130,117,191,216,10,168,7,254,193,146,171,199,200,170,
+165,189,187,0,2,0,80,255,230,4,153,5,226,0,23,0,35,0,0,1,20,0,35,34,0,53,
+52,18,55,38,39,55,22,23,55,54,0,55,23,0,7,22,18,7,52,38,35,34,6,21,20,22,
+51,50,54,4,67,254,236,230,231,254,238,184,156,129,65,216,46,61,12,95,1,57,
+109,99,254,238,199,178,209,133,201,172,171,201,198,174,176,197,1,242,238,
+254,226,1,31,237,185,1,14,47,126,149,12,151,114,1,71,1,38,118,99,255,0,140,
+37,254,235,136,171,199,200,170,165,189,187,0,2,0,80,255,230,5,19,4,9,0,35,
+0,47,0,0,1,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,
+20,4,51,32,36,53,52,38,39,55,30,2,37,20,22,51,50,54,53,52,38,35,34,6,5,19,
+254,217,254,189,254,221,254,202,226,182,122,144,136,115,113,133,6,90,1,10,
+241,1,10,1,4,172,153,5,131,187,95,252,89,75,57,62,73,73,60,60,74,2,37,254,
+226,254,223,1,42,1,19,212,1,8,135,115,117,138,133,115,25,22,95,150,173,188,
+174,176,142,151,15,168,13,140,211,77,67,73,75,65,64,74,72,0,2,0,75,255,230,
+5,64,5,226,0,43,0,55,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,
+23,22,22,51,50,54,53,52,36,33,35,38,38,39,55,22,23,54,0,55,23,4,7,22,4,18,
+1,52,38,35,34,6,21,20,22,51,50,54,5,64,172,173,114,172,54,26,155,104,136,
+163,165,132,98,141,33,75,161,100,119,119,254,177,254,199,100,71,162,47,216,
+47,63,92,1,65,113,99,254,253,199,208,1,42,155,252,236,97,83,81,97,92,84,86,
+96,1,171,206,247,126,88,104,110,169,141,136,175,97,80,116,101,128,119,235,
+248,43,195,106,12,152,119,67,1,45,122,99,243,142,9,155,254,249,254,246,81,
+97,96,83,77,93,88,0,2,0,40,255,230,5,156,5,226,0,53,0,65,0,0,1,20,6,7,7,22,
+21,20,6,35,34,38,53,52,55,55,38,38,35,34,21,20,23,7,38,38,53,52,54,51,50,
+4,23,55,54,54,53,52,35,35,38,38,39,55,22,23,54,0,55,23,0,7,22,22,1,7,6,6,
+21,20,22,51,50,54,53,52,4,92,65,70,140,98,173,149,142,190,212,211,63,192,
+110,157,22,74,45,49,134,107,137,1,18,101,140,45,39,108,144,71,162,47,216,
+47,63,92,1,65,113,99,254,232,200,81,79,254,149,142,78,68,84,68,80,98,3,83,
+61,82,35,70,177,154,136,162,167,122,162,107,106,90,108,124,35,49,36,47,101,
+65,97,121,192,150,71,23,42,33,81,43,195,106,12,152,119,67,1,45,122,99,254,
+249,138,7,82,254,154,72,39,76,43,56,72,85,88,93,0,3,0,75,255,230,6,91,5,226,
+0,13,0,60,0,72,0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,1,6,6,35,34,38,39,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,
+35,55,22,4,18,21,20,6,21,20,22,51,50,55,37,52,38,35,34,6,21,20,22,51,50,54,
+75,216,47,63,92,1,65,113,99,205,254,206,90,70,71,162,5,225,33,92,46,71,112,
+24,91,166,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,103,102,
+127,100,207,151,6,168,1,2,140,10,65,52,60,51,252,35,97,83,81,97,92,84,86,
+96,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,251,139,26,28,76,62,
+138,111,106,105,112,169,141,136,175,106,86,103,99,153,118,98,180,115,168,
+8,169,254,237,161,38,77,34,54,56,37,131,81,97,96,83,77,93,88,0,2,0,90,255,
+230,5,38,5,226,0,13,0,51,0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,19,34,
+21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,53,52,38,39,55,22,
+0,17,20,6,35,34,38,39,38,38,98,216,47,63,92,1,65,113,99,205,254,206,90,70,
+71,162,225,126,48,37,195,21,23,159,129,93,137,87,57,80,101,68,113,111,236,
+233,6,255,1,45,165,164,126,185,84,70,97,4,251,12,152,119,67,1,45,122,99,192,
+237,47,43,195,253,117,185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,
+128,119,191,216,10,168,7,254,193,254,245,214,252,153,159,132,100,0,4,0,75,
+255,230,7,130,5,226,0,13,0,61,0,73,0,85,0,0,19,55,22,23,54,0,55,23,6,4,7,
+35,38,38,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,52,
+38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,75,216,47,
+63,92,1,65,113,99,205,254,206,90,70,71,162,7,8,137,115,113,135,31,254,183,
+108,111,83,159,109,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,
+103,108,132,124,121,237,15,2,230,126,132,108,57,123,72,63,61,71,76,57,66,
+68,251,37,97,83,81,97,92,84,86,96,4,251,12,152,119,67,1,45,122,99,192,237,
+47,43,195,254,106,116,137,126,106,64,52,90,247,129,113,191,114,111,106,105,
+112,169,141,136,175,106,86,103,99,145,117,115,210,70,165,21,67,108,89,64,
+74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,0,2,0,80,255,230,5,144,3,255,
+0,65,0,77,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,22,21,20,
+6,35,34,38,53,52,55,6,6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,52,38,35,
+34,6,21,20,22,23,7,33,53,33,38,38,53,52,54,51,50,18,5,20,22,51,50,54,53,52,
+38,35,34,6,5,144,99,167,100,103,161,42,42,161,103,100,167,99,232,176,122,
+144,136,115,113,133,5,41,48,78,125,70,214,60,64,60,214,70,125,78,108,93,39,
+52,58,64,30,254,120,1,17,61,55,120,90,148,170,251,220,78,59,57,73,76,62,55,
+74,2,2,166,245,129,125,105,105,125,129,245,166,219,1,34,135,115,117,138,133,
+115,20,25,48,147,81,107,151,76,216,216,76,151,107,154,181,51,45,51,73,28,
+92,104,47,89,58,83,112,254,238,3,67,73,76,64,64,74,73,0,3,0,70,255,231,5,
+188,5,226,0,59,0,71,0,83,0,0,1,20,6,7,22,21,20,6,35,34,38,53,52,55,38,38,
+53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,23,22,23,54,54,
+53,52,38,39,38,38,39,55,22,23,54,0,55,23,6,4,7,22,22,37,20,22,51,50,54,53,
+52,38,35,34,6,1,52,38,35,34,6,21,20,22,51,50,54,4,129,189,161,39,130,107,
+112,126,41,153,185,93,166,104,108,128,121,102,101,118,6,80,126,166,176,93,
+129,168,97,108,75,169,45,216,47,63,92,1,65,113,99,185,254,253,114,111,132,
+252,198,64,49,53,62,62,51,51,64,1,162,71,65,68,69,70,66,67,70,2,156,123,180,
+32,58,86,96,118,109,95,65,47,13,191,143,100,178,107,120,102,104,123,119,102,
+21,21,80,86,73,109,13,14,51,22,148,118,89,103,34,42,205,103,12,152,119,67,
+1,45,122,99,174,209,69,35,157,14,58,62,64,56,54,63,60,253,153,49,51,54,47,
+46,53,52,0,2,0,35,254,79,4,80,5,226,0,48,0,80,0,0,1,52,38,39,39,38,38,53,
+52,54,55,38,39,55,22,23,51,54,0,55,23,0,7,22,23,7,38,38,35,34,6,21,20,22,
+23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,19,21,34,38,39,6,6,35,34,39,6,
+35,34,38,53,52,55,51,22,22,51,50,55,51,22,51,50,54,55,51,22,22,3,25,92,109,
+129,192,178,132,113,119,66,216,47,59,13,94,1,55,112,99,254,237,201,160,155,
+96,94,175,113,126,116,117,139,123,186,148,227,183,254,191,170,100,156,233,
+127,142,192,53,91,29,13,101,70,129,65,65,129,82,106,6,54,12,73,64,110,33,
+60,33,110,64,73,12,54,23,75,1,89,65,73,9,11,16,122,127,85,131,25,119,147,
+12,151,113,70,1,37,120,99,254,255,141,33,117,111,92,91,94,71,78,70,11,10,
+16,157,120,147,183,1,19,82,133,74,254,33,166,63,60,93,90,150,150,121,125,
+39,47,85,73,116,116,73,85,61,45,0,3,0,20,255,230,5,23,7,94,0,15,0,27,0,77,
+0,0,19,33,38,53,52,54,51,50,22,21,20,14,2,35,33,1,20,22,51,50,54,53,52,38,
+35,34,6,1,20,6,35,34,38,39,6,6,35,34,38,53,52,55,35,53,33,23,6,6,21,20,22,
+51,50,55,51,22,22,51,50,54,53,52,36,37,38,38,39,37,22,23,36,37,23,4,5,22,
+0,169,1,237,31,134,114,115,137,57,108,131,127,253,244,2,45,71,61,63,72,68,
+66,57,76,2,17,165,132,115,134,55,57,148,92,124,163,164,229,1,102,30,92,88,
+91,83,175,60,64,34,119,90,88,107,254,254,254,253,89,170,61,1,0,36,71,1,15,
+1,2,109,254,245,254,250,234,1,6,6,2,52,64,105,127,137,116,64,108,66,22,1,
+29,66,72,74,64,67,73,73,250,216,192,239,109,121,130,100,156,122,191,104,104,
+92,51,102,68,61,76,216,115,101,122,123,220,240,25,38,133,83,12,98,73,159,
+231,109,206,111,43,254,203,0,3,0,52,255,230,4,196,6,120,0,15,0,27,0,108,0,
+0,19,33,38,53,52,54,51,50,22,21,20,14,2,35,33,1,20,22,51,50,54,53,52,38,35,
+34,6,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,
+20,23,7,38,38,53,52,54,51,50,22,21,7,22,51,50,54,53,52,38,35,34,7,39,54,51,
+50,22,21,20,6,35,34,39,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,
+39,51,22,213,1,237,31,134,114,115,137,57,108,131,127,253,244,2,45,71,61,63,
+72,68,66,57,76,1,179,162,116,99,131,43,57,148,92,134,174,98,138,87,67,68,
+59,59,75,22,74,41,48,156,125,122,165,3,108,136,82,75,57,50,39,41,46,70,77,
+109,135,154,132,168,143,42,120,75,62,28,82,68,175,60,64,40,102,88,80,78,34,
+129,36,5,28,52,64,105,127,137,116,64,108,66,22,1,29,66,72,74,64,67,73,73,
+251,51,121,171,101,129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,
+36,36,33,92,46,103,128,132,96,43,81,62,44,40,53,11,141,24,127,103,112,130,
+111,57,85,54,52,50,36,60,68,216,118,98,73,62,70,62,87,0,2,0,65,255,230,3,
+166,3,108,0,13,0,25,0,0,19,52,54,54,51,50,22,22,21,20,6,35,34,38,1,52,38,
+35,34,6,21,20,22,51,50,54,65,103,197,134,133,197,105,237,198,198,236,2,227,
+166,139,140,164,163,141,148,157,1,168,126,206,120,119,206,127,204,246,247,
+1,0,143,164,166,141,136,152,155,0,1,0,70,255,231,2,44,3,101,0,15,0,0,19,52,
+54,54,51,21,34,6,21,20,22,51,21,34,38,38,70,132,221,133,137,154,154,137,135,
+220,131,1,167,143,202,101,88,191,168,174,185,88,94,201,0,4,0,55,255,230,1,
+238,3,255,0,11,0,23,0,35,0,47,0,0,19,52,54,51,50,22,21,20,6,35,34,38,37,52,
+38,35,34,6,21,20,22,51,50,54,1,52,54,51,50,22,21,20,6,35,34,38,37,52,38,35,
+34,6,21,20,22,51,50,54,55,121,98,99,121,121,99,100,119,1,86,65,58,57,65,63,
+59,60,63,254,170,121,98,99,121,121,99,100,119,1,86,65,58,57,65,63,59,60,63,
+3,26,102,127,127,102,105,123,124,132,56,67,67,56,53,63,63,253,201,102,127,
+127,102,105,123,124,132,56,67,67,56,53,63,63,0,1,252,181,3,163,255,236,6,
+139,0,27,0,0,1,20,51,33,7,33,34,21,20,51,51,7,35,34,38,53,52,55,38,38,53,
+52,54,51,33,7,33,34,253,54,114,1,44,12,254,224,114,114,145,6,139,111,132,
+111,51,60,131,112,2,68,12,253,200,114,5,149,80,165,81,80,92,107,86,124,53,
+22,81,55,99,117,165,0,1,0,52,0,0,4,241,3,255,0,38,0,0,55,52,54,55,55,54,54,
+53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,7,6,6,21,20,51,
+33,21,33,34,38,64,102,113,176,69,57,105,89,89,105,19,73,87,188,147,152,201,
+86,101,184,64,53,127,3,118,252,138,143,172,243,86,122,54,84,32,63,48,61,77,
+77,61,38,43,36,57,98,110,143,149,112,77,102,48,88,31,58,38,93,227,133,0,2,
+0,120,255,230,5,21,4,176,0,14,0,30,0,0,19,52,18,36,51,50,4,18,21,16,0,33,
+34,36,2,37,52,38,38,35,34,6,6,21,20,22,22,51,50,54,54,120,141,1,11,182,180,
+1,12,143,254,190,254,243,181,254,245,142,4,15,119,204,125,125,205,119,119,
+205,125,125,204,119,2,73,172,1,24,163,162,254,232,173,254,233,254,180,154,
+1,21,246,135,204,110,110,204,135,135,205,110,110,205,0,1,0,125,255,245,4,
+180,4,176,0,27,0,0,19,52,18,54,51,50,22,18,21,20,2,7,39,54,18,53,52,2,35,
+34,2,21,20,18,23,7,38,2,125,145,246,150,151,244,143,51,36,218,63,81,199,179,
+180,197,79,63,220,37,48,1,254,227,1,54,153,153,254,200,229,115,254,214,103,
+10,133,1,63,153,234,1,5,254,254,232,153,254,189,134,11,101,1,42,0,2,0,15,
+0,0,5,152,4,176,0,28,0,40,0,0,55,33,50,54,53,52,38,39,22,21,20,6,6,35,34,
+38,53,52,54,51,50,22,18,21,20,6,4,35,33,1,52,38,35,34,6,21,20,22,51,50,54,
+40,2,251,239,245,67,59,14,70,135,93,132,172,191,141,129,244,154,144,254,228,
+201,252,236,4,22,102,80,82,103,99,84,84,100,201,228,204,93,181,55,56,64,75,
+134,84,185,139,139,188,174,254,216,173,163,252,142,3,143,86,101,103,84,85,
+99,99,0,1,0,75,255,230,3,182,4,176,0,38,0,0,1,20,6,6,35,32,3,55,22,51,50,
+54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,51,50,22,22,21,20,
+7,22,22,3,182,97,185,127,254,214,168,76,153,201,137,126,122,130,94,94,110,
+109,121,107,68,116,73,54,155,175,105,181,108,153,91,92,1,84,97,168,101,1,
+16,85,130,112,87,86,107,109,107,91,91,105,33,36,119,54,76,145,98,174,82,39,
+150,0,2,0,60,255,230,5,124,4,180,0,37,0,49,0,0,1,52,55,39,38,38,53,52,54,
+55,7,6,21,20,22,23,5,37,54,54,53,52,39,39,22,22,21,20,6,7,7,22,21,20,6,35,
+34,38,37,52,38,35,34,6,21,20,22,51,50,54,1,112,168,178,149,149,201,176,8,
+217,90,101,1,73,1,73,101,90,217,8,176,201,149,149,178,168,209,155,156,208,
+2,66,111,103,103,111,111,103,103,111,1,49,187,112,45,37,136,108,121,146,7,
+183,11,114,54,65,26,83,83,26,65,54,114,11,183,7,146,121,108,136,37,45,112,
+187,142,189,189,236,77,89,89,77,77,90,90,0,2,0,84,255,230,5,233,4,176,0,63,
+0,74,0,0,1,22,22,21,20,6,35,34,38,39,55,22,22,51,50,54,53,52,39,7,6,6,7,6,
+6,35,32,3,55,22,51,50,54,53,52,38,38,35,34,7,39,18,33,50,22,18,21,20,7,54,
+54,55,46,2,53,52,54,51,50,22,21,20,6,7,54,54,53,52,38,35,34,6,21,20,5,45,
+101,75,112,92,93,125,4,58,19,62,33,43,58,88,45,107,138,55,60,196,130,254,
+235,168,76,145,193,215,171,89,174,123,193,145,76,168,1,21,149,212,108,15,
+27,57,131,60,70,46,133,103,111,144,97,156,56,58,64,45,45,65,2,80,110,171,
+95,110,132,141,112,18,45,49,81,77,126,105,35,80,124,78,115,134,1,16,85,130,
+216,170,100,177,109,130,85,1,16,174,254,231,159,82,80,28,52,102,71,96,111,
+61,115,140,156,125,98,152,11,52,109,70,58,64,66,59,112,0,1,0,100,0,0,4,152,
+4,176,0,32,0,0,37,7,33,34,38,53,52,54,55,38,38,53,52,54,51,51,7,35,34,6,21,
+20,22,51,51,7,33,34,6,21,20,22,51,4,152,21,253,114,185,216,96,84,64,75,191,
+147,93,10,73,92,106,106,92,243,16,254,255,102,107,113,138,201,201,173,167,
+98,150,42,40,133,88,135,174,100,96,88,88,96,156,102,86,90,97,0,1,0,80,255,
+230,4,87,4,176,0,37,0,0,19,52,54,55,37,54,54,53,52,38,35,34,6,7,39,54,33,
+50,22,21,20,6,7,5,6,6,21,20,22,51,32,55,23,2,33,34,38,38,80,157,168,1,23,
+123,103,155,124,107,185,90,96,202,1,5,195,242,152,169,254,233,122,108,166,
+169,1,22,175,100,182,254,141,158,216,104,1,99,135,172,21,35,16,79,87,88,114,
+65,72,111,124,166,134,116,143,22,36,16,92,85,87,102,150,82,254,217,108,174,
+0,1,0,120,255,230,5,179,4,178,0,29,0,0,1,33,22,22,21,16,0,33,34,36,2,53,16,
+37,23,6,6,21,20,22,22,51,50,54,54,53,16,37,55,33,5,163,254,166,100,103,254,
+191,254,243,181,254,245,142,1,124,71,163,146,118,204,125,125,205,119,254,
+254,13,2,34,4,20,83,243,133,254,234,254,179,154,1,21,180,1,170,191,85,81,
+226,159,136,204,110,110,205,135,1,41,138,114,0,1,0,100,0,0,4,152,4,176,0,
+32,0,0,1,20,22,51,51,23,35,34,38,53,52,54,55,38,38,53,52,54,51,33,23,33,34,
+6,21,20,22,51,33,23,35,34,6,1,35,106,92,73,10,93,154,184,76,66,85,98,216,
+185,2,142,21,253,93,138,113,107,102,1,1,16,243,92,106,1,28,88,96,100,168,
+141,88,131,40,42,151,99,167,173,201,97,90,86,102,156,96,0,2,0,70,255,230,
+4,80,4,176,0,29,0,41,0,0,37,20,6,7,39,54,53,52,38,35,34,6,7,6,35,34,36,53,
+52,54,54,51,50,22,22,21,20,7,22,22,37,50,54,53,52,38,35,34,6,21,20,22,4,80,
+89,79,131,102,41,36,18,21,18,84,102,235,254,230,123,235,159,158,234,125,141,
+63,78,253,251,173,220,221,172,172,221,220,219,76,127,42,118,70,74,32,42,6,
+6,24,251,211,129,212,123,122,211,131,211,125,17,98,216,172,137,134,172,172,
+134,136,173,0,1,0,150,0,0,1,58,4,176,0,3,0,0,19,51,17,35,150,164,164,4,176,
+251,80,0,1,0,50,0,0,2,158,4,176,0,17,0,0,1,6,6,35,34,38,53,17,51,17,20,51,
+50,53,17,51,17,35,1,250,38,76,52,135,155,164,146,146,164,164,1,225,30,32,
+154,150,1,221,254,35,157,157,1,221,251,80,0,1,0,75,0,0,4,127,4,176,0,29,0,
+0,1,6,6,35,34,39,6,35,34,38,53,17,51,17,20,51,50,54,53,17,51,17,20,51,50,
+53,17,51,17,35,3,219,38,76,52,153,77,85,141,135,155,164,146,72,74,164,146,
+146,164,164,1,225,30,32,97,97,154,150,1,221,254,35,157,83,98,1,197,254,35,
+157,157,1,221,251,80,0,1,0,100,2,87,4,176,2,232,0,3,0,0,19,33,21,33,100,4,
+76,251,180,2,232,145,0,1,0,75,0,0,4,46,3,255,0,30,0,0,55,52,54,55,37,54,54,
+53,52,38,35,33,53,37,50,22,21,20,6,7,5,6,21,20,22,51,33,21,5,34,38,75,135,
+126,1,156,74,59,69,65,253,126,2,147,143,163,119,137,254,112,150,69,65,2,130,
+253,76,125,148,247,99,148,34,113,20,64,51,49,52,145,1,131,116,103,140,37,
+109,43,97,49,52,145,1,135,0,1,0,92,0,0,4,137,4,177,0,59,0,0,55,52,54,55,37,
+54,54,53,52,38,35,37,34,38,53,52,54,55,37,54,54,53,52,38,35,33,53,37,50,22,
+21,20,6,7,5,6,6,21,20,22,51,5,50,22,21,20,6,7,5,6,6,21,20,22,51,33,21,5,34,
+38,92,104,114,2,56,37,32,31,35,253,242,128,135,104,114,2,56,38,31,31,35,252,
+251,3,22,128,135,104,114,253,200,37,32,31,35,2,14,128,135,104,114,253,200,
+38,31,31,35,3,5,252,234,128,135,174,71,87,21,102,6,18,17,18,13,1,93,81,71,
+87,21,103,7,17,16,19,13,144,1,92,82,71,87,21,102,6,18,17,18,13,1,93,81,71,
+87,21,103,7,17,16,19,13,144,1,92,0,2,0,68,255,230,4,208,3,255,0,28,0,40,0,
+0,1,6,4,35,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,51,
+50,54,55,1,20,22,51,50,54,53,52,38,35,34,6,4,208,89,254,232,206,254,232,254,
+203,226,182,122,144,136,115,113,133,6,90,1,9,234,171,241,98,252,206,75,57,
+62,73,73,60,60,74,1,152,235,199,1,46,1,15,212,1,8,135,115,117,138,133,115,
+25,22,95,150,169,192,112,133,1,38,67,73,75,65,64,74,72,0,1,0,150,0,0,1,58,
+4,245,0,3,0,0,19,51,17,35,150,164,164,4,245,251,11,255,255,0,150,0,0,3,10,
+4,245,0,38,0,98,0,0,0,7,0,98,1,208,0,0,0,1,0,121,0,0,4,61,5,182,0,34,0,0,
+19,53,51,50,54,55,33,53,33,38,38,35,35,53,33,21,33,22,23,51,21,35,2,5,19,
+22,22,51,51,21,35,34,38,38,39,121,170,182,153,11,253,252,2,4,9,146,160,201,
+3,196,254,160,113,12,227,229,32,254,65,235,51,101,63,27,49,133,137,85,47,
+2,178,58,124,146,96,135,117,96,96,88,164,96,254,162,17,254,111,85,79,86,27,
+75,82,0,1,255,213,254,240,0,43,5,6,0,3,0,0,3,51,17,35,43,86,86,5,6,249,234,
+0,1,255,33,254,240,0,223,5,133,0,14,0,0,3,7,39,55,39,55,23,55,23,7,23,7,39,
+17,35,43,127,53,168,168,53,170,170,53,168,168,53,127,86,4,72,127,55,168,166,
+55,170,170,55,166,168,55,127,250,168,0,16,0,98,0,86,4,94,4,82,0,11,0,23,0,
+35,0,47,0,59,0,71,0,83,0,95,0,107,0,119,0,131,0,143,0,155,0,167,0,179,0,191,
+0,0,1,52,54,51,50,22,21,20,6,35,34,38,7,52,54,51,50,22,21,20,6,35,34,38,37,
+52,54,51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,
+51,50,22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,
+22,21,20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,
+20,6,35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,
+35,34,38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,
+38,5,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,7,
+52,54,51,50,22,21,20,6,35,34,38,2,43,32,21,22,32,32,22,21,32,172,32,21,22,
+31,31,22,21,32,1,88,32,21,22,32,32,22,21,32,254,16,32,22,21,32,32,21,22,32,
+2,136,31,22,22,31,31,22,22,31,253,24,32,21,22,32,32,22,21,32,3,72,31,22,22,
+31,31,22,22,31,252,147,32,22,21,32,32,21,22,32,3,146,31,22,22,31,31,22,22,
+31,252,147,32,21,22,32,32,22,21,32,3,72,31,22,22,31,31,22,22,31,253,24,32,
+22,21,32,32,21,22,32,2,136,31,22,22,31,31,22,22,31,254,16,32,21,22,31,31,
+22,21,32,1,88,32,21,22,32,32,22,21,32,172,32,21,22,32,32,22,21,32,4,29,21,
+32,32,21,22,32,32,15,21,32,32,21,22,31,31,22,21,32,32,21,22,31,31,74,21,32,
+32,21,22,32,32,22,21,32,32,21,22,32,32,130,22,31,31,22,22,31,31,22,22,31,
+31,22,22,31,31,150,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,150,22,31,
+31,22,22,31,31,22,22,31,31,22,22,31,31,130,22,32,32,22,21,32,32,21,22,32,
+32,22,21,32,32,75,22,31,31,22,22,31,31,22,22,31,31,22,22,31,31,15,22,32,32,
+22,21,32,32,0,1,0,0,253,91,2,242,3,255,0,44,0,0,17,52,54,54,55,54,54,53,52,
+38,39,55,22,22,21,20,6,6,7,14,2,21,20,22,51,50,54,53,52,38,39,55,33,21,35,
+22,22,21,20,6,6,35,34,38,55,78,62,69,65,84,98,115,99,75,47,68,57,52,58,40,
+122,110,94,114,89,83,28,1,88,240,83,95,80,157,108,157,190,254,232,97,191,
+161,113,125,152,67,83,112,60,142,63,160,101,88,168,140,102,94,118,135,68,
+137,158,128,109,86,147,51,88,100,47,167,102,89,167,105,217,0,4,254,31,252,
+65,1,224,255,140,0,48,0,60,0,69,0,73,0,0,1,20,6,35,34,38,38,39,6,35,34,38,
+53,52,54,51,50,22,23,54,53,52,39,23,20,6,35,34,38,53,52,54,51,50,22,21,20,
+7,22,22,51,50,53,52,38,35,55,22,22,37,52,38,35,34,6,21,20,22,51,50,54,3,50,
+55,38,38,35,34,21,20,5,23,35,55,1,224,135,106,49,75,69,70,91,156,99,111,97,
+93,57,105,69,45,52,3,94,75,79,94,96,87,125,156,39,49,83,59,182,111,139,3,
+154,181,253,150,51,38,43,51,50,39,41,53,130,94,63,52,82,54,94,1,168,48,185,
+49,254,8,136,166,24,44,50,118,85,70,73,84,41,40,64,93,101,56,27,77,86,92,
+75,72,91,172,138,100,87,24,16,204,106,123,109,13,210,37,43,47,48,42,41,50,
+47,254,187,44,34,30,50,58,86,202,202,0,1,254,145,252,118,1,110,255,138,0,
+23,0,0,1,52,54,51,50,22,21,20,7,39,54,54,53,52,38,35,34,6,21,20,22,23,7,38,
+254,145,203,164,166,200,65,159,52,55,133,116,115,135,55,52,161,63,253,214,
+197,239,240,199,157,191,8,112,190,113,129,153,152,126,112,195,112,9,180,0,
+3,253,182,252,65,2,74,255,135,0,48,0,60,0,64,0,0,1,20,6,35,34,39,6,6,35,34,
+39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,22,
+21,7,22,22,51,50,54,53,52,38,39,55,22,22,5,52,38,35,34,6,21,20,22,51,50,54,
+23,23,35,55,2,74,108,101,124,88,23,95,71,121,82,16,95,64,84,100,102,81,61,
+87,20,45,100,61,64,79,138,144,4,152,196,1,42,89,58,65,78,137,145,5,152,196,
+252,143,57,48,48,57,54,49,50,57,120,45,173,46,253,249,128,161,154,72,82,138,
+67,71,109,92,88,114,64,53,74,65,100,83,111,131,6,109,7,226,165,33,55,54,99,
+84,111,131,6,109,7,226,229,51,60,60,52,48,57,54,126,198,198,0,1,254,151,252,
+216,1,105,255,132,0,65,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,
+54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,7,51,39,51,7,51,
+21,33,6,7,6,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,1,105,91,
+75,62,86,27,35,92,56,84,107,65,81,54,41,41,37,36,47,14,46,25,30,97,77,75,
+102,2,110,11,87,12,135,254,178,26,72,77,25,51,42,108,37,39,26,65,53,50,50,
+20,75,22,253,180,99,121,67,83,85,65,95,73,60,90,59,40,58,30,33,45,46,37,27,
+28,24,22,60,30,67,84,87,62,32,153,153,58,34,55,59,38,28,38,45,141,79,62,63,
+50,54,50,75,0,1,254,112,253,91,2,239,4,5,0,41,0,0,1,52,55,35,53,33,23,6,6,
+21,20,22,51,50,55,51,22,22,51,50,54,54,53,16,0,37,55,4,0,17,20,2,6,35,34,
+38,39,6,6,35,34,38,254,156,127,171,1,36,24,62,66,68,65,138,43,53,27,96,84,
+71,131,84,254,241,254,215,107,1,14,1,38,102,167,95,95,126,37,46,127,76,103,
+133,254,71,142,89,84,75,21,79,50,52,66,153,79,74,105,210,150,1,45,1,154,173,
+149,183,253,203,254,169,189,254,233,147,83,104,105,82,132,0,2,254,112,252,
+156,2,239,4,5,0,41,0,45,0,0,1,52,55,35,53,33,23,6,6,21,20,22,51,50,55,51,
+22,22,51,50,54,54,53,16,0,37,55,4,0,17,20,2,6,35,34,38,39,6,6,35,34,38,5,
+51,23,35,254,156,127,171,1,36,24,62,66,68,65,138,43,53,27,96,84,71,131,84,
+254,241,254,215,107,1,14,1,38,102,167,95,95,126,37,46,127,76,103,133,1,177,
+98,50,198,254,71,142,89,84,75,21,79,50,52,66,153,79,74,105,210,150,1,45,1,
+154,173,149,183,253,203,254,169,189,254,233,147,83,104,105,82,132,88,235,
+0,1,254,150,252,216,1,105,255,134,0,77,0,0,1,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,21,7,22,
+51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,6,35,34,39,6,7,6,6,21,20,22,
+51,50,55,51,22,22,51,50,53,52,39,51,22,1,105,99,73,61,82,26,35,92,57,84,108,
+64,83,53,42,42,36,37,46,13,46,54,96,78,75,102,2,67,85,51,46,35,31,24,26,29,
+42,49,71,81,102,76,104,88,25,75,74,29,51,42,109,37,39,26,64,53,98,22,81,22,
+253,151,79,112,66,84,85,65,96,72,58,90,62,40,58,30,33,46,47,37,29,26,24,50,
+63,67,83,85,64,28,53,41,29,25,36,8,92,16,86,65,77,81,72,35,57,55,41,29,39,
+45,141,80,61,89,45,41,58,0,3,253,46,252,15,2,210,255,139,0,48,0,60,0,64,0,
+0,1,20,6,35,34,39,6,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,22,
+22,51,50,54,53,52,37,55,22,22,21,21,22,22,51,50,54,53,52,37,55,22,22,5,52,
+38,35,34,6,21,20,22,51,50,54,5,23,35,55,2,210,108,102,127,89,23,97,72,136,
+93,36,147,101,143,170,173,140,140,172,4,46,90,63,65,75,254,235,2,152,198,
+43,89,61,65,76,254,235,2,152,198,252,115,118,104,104,119,115,108,107,115,
+2,28,50,198,50,253,251,130,161,161,75,86,184,87,97,186,156,152,190,190,152,
+37,28,65,59,97,83,233,11,114,7,227,166,20,61,57,96,84,233,11,114,7,227,74,
+105,128,127,106,101,122,121,247,235,235,0,2,253,237,252,216,2,18,255,132,
+0,59,0,70,0,0,19,20,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,
+50,23,54,53,52,38,35,34,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,
+23,54,54,51,50,22,23,51,39,51,7,51,21,5,38,35,34,6,21,20,22,51,50,54,206,
+31,69,15,59,14,35,50,155,85,95,131,143,122,138,88,21,77,61,101,35,49,15,75,
+60,59,59,38,51,72,107,80,69,107,20,17,88,65,72,95,13,122,12,92,12,138,254,
+78,76,122,84,87,78,67,68,118,254,150,85,84,72,105,58,41,12,48,43,64,49,96,
+121,111,81,82,98,55,46,55,69,75,102,46,56,58,43,49,44,24,65,88,81,106,91,
+63,68,86,99,82,154,154,57,180,49,46,38,37,46,64,0,2,254,115,252,216,1,140,
+255,138,0,43,0,55,0,0,1,20,6,35,34,38,39,6,35,34,38,53,52,54,51,50,22,21,
+20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,51,50,54,53,52,39,55,22,
+22,37,20,22,51,50,54,53,52,38,35,34,6,1,140,127,93,54,101,29,62,115,99,113,
+158,112,78,86,84,71,68,85,4,60,79,68,115,37,39,41,124,71,83,194,4,125,131,
+253,168,47,35,38,45,45,37,37,46,254,20,134,182,73,77,150,172,153,151,208,
+92,71,75,91,81,71,19,16,78,121,96,99,141,141,97,98,216,22,109,13,202,28,44,
+47,49,42,42,48,47,0,3,254,199,252,216,1,56,255,133,0,11,0,23,0,35,0,0,1,52,
+54,51,50,22,21,20,6,35,34,38,37,52,38,35,34,6,21,20,22,51,50,54,37,52,54,
+51,50,22,21,20,6,35,34,38,254,199,173,139,141,172,169,144,143,169,2,21,117,
+104,103,117,114,106,108,113,254,216,43,33,33,43,42,34,34,42,254,46,153,190,
+191,152,156,186,186,197,105,127,126,106,100,121,120,106,34,45,45,34,34,44,
+44,0,2,254,106,252,216,1,150,255,132,0,41,0,53,0,0,1,20,6,35,34,39,6,6,35,
+34,38,53,52,54,54,51,50,22,23,7,38,35,34,6,21,20,22,51,50,54,55,51,22,22,
+23,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,1,150,126,89,159,
+65,35,92,57,86,103,115,193,114,75,115,54,56,94,98,145,175,58,60,54,64,19,
+36,19,69,66,39,80,65,70,93,85,41,34,36,41,39,38,35,40,253,187,94,133,149,
+85,64,132,110,133,201,108,35,38,64,62,175,147,66,58,59,73,70,57,4,35,66,61,
+79,92,61,36,44,42,34,34,45,43,0,3,254,106,252,65,1,150,255,132,0,41,0,53,
+0,57,0,0,1,20,6,35,34,39,6,6,35,34,38,53,52,54,54,51,50,22,23,7,38,35,34,
+6,21,20,22,51,50,54,55,51,22,22,23,38,53,52,54,51,50,22,7,52,38,35,34,6,21,
+20,22,51,50,54,5,23,35,55,1,150,126,89,159,65,35,92,57,86,103,115,193,114,
+75,115,54,56,94,98,145,175,58,60,54,64,19,36,19,69,66,39,80,65,70,93,85,41,
+34,36,41,39,38,35,40,254,204,48,185,49,253,187,94,133,149,85,64,132,110,133,
+201,108,35,38,64,62,175,147,66,58,59,73,70,57,4,35,66,61,79,92,61,36,44,42,
+34,34,45,43,169,202,202,0,2,254,39,252,216,1,216,255,133,0,66,0,78,0,0,1,
+20,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,35,
+34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,
+38,38,53,52,54,51,50,22,23,54,54,51,50,22,3,52,38,35,34,6,21,20,22,51,50,
+54,1,216,73,113,58,87,115,91,74,67,80,22,88,112,91,68,99,14,49,35,150,70,
+75,83,76,38,49,79,86,80,77,80,79,27,89,79,121,151,69,58,52,59,125,99,80,120,
+32,29,112,73,113,146,199,45,40,39,48,45,42,40,45,254,51,110,157,80,113,88,
+82,103,87,65,40,40,63,147,98,123,82,65,147,49,44,45,50,63,52,41,42,51,22,
+142,28,116,93,58,79,20,23,76,47,76,97,84,74,74,84,192,254,252,41,49,48,37,
+39,51,49,0,2,253,220,253,130,2,35,255,131,0,15,0,27,0,0,1,20,14,2,35,33,55,
+33,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,2,35,57,108,131,
+127,253,96,15,2,99,31,134,114,115,137,123,68,66,57,76,71,61,63,72,254,134,
+64,108,66,22,165,52,64,105,127,137,91,67,73,73,67,66,72,74,0,4,254,90,252,
+65,1,166,255,131,0,17,0,36,0,48,0,52,0,0,1,52,54,51,50,22,21,20,6,35,34,38,
+39,6,6,35,34,38,37,51,22,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,39,
+52,54,51,50,22,21,20,6,35,34,38,19,51,23,35,254,90,233,188,190,233,110,94,
+70,103,45,44,105,64,100,109,1,135,62,24,83,55,58,68,173,147,147,171,72,54,
+57,83,35,50,38,39,49,49,39,38,50,44,88,48,185,253,241,178,224,225,182,133,
+145,76,89,89,76,144,143,53,61,70,74,130,152,154,129,76,67,62,187,38,51,51,
+38,37,51,51,254,190,212,0,2,254,90,252,214,1,166,255,131,0,17,0,36,0,0,1,
+52,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,37,51,22,22,51,50,54,53,52,
+38,35,34,6,21,20,22,51,50,54,254,90,233,188,190,233,110,94,70,103,45,44,105,
+64,100,109,1,135,62,24,83,55,58,68,173,147,147,171,72,54,57,83,253,241,178,
+224,225,182,133,145,76,89,89,76,144,143,53,61,70,74,130,152,154,129,76,67,
+62,0,3,254,90,252,65,1,166,255,131,0,17,0,36,0,40,0,0,1,52,54,51,50,22,21,
+20,6,35,34,38,39,6,6,35,34,38,37,51,22,22,51,50,54,53,52,38,35,34,6,21,20,
+22,51,50,54,23,51,23,35,254,90,233,188,190,233,110,94,70,103,45,44,105,64,
+100,109,1,135,62,24,83,55,58,68,173,147,147,171,72,54,57,83,9,88,48,185,253,
+241,178,224,225,182,133,145,76,89,89,76,144,143,53,61,70,74,130,152,154,129,
+76,67,62,172,212,0,2,255,56,253,83,3,169,4,5,0,33,0,44,0,0,1,6,35,34,38,39,
+6,35,34,38,53,52,54,51,50,22,23,54,17,16,0,37,55,22,0,17,16,7,22,22,51,50,
+54,55,5,50,55,38,38,35,34,6,21,20,22,3,169,68,125,50,107,71,147,234,154,181,
+158,130,101,173,137,119,254,243,254,254,107,248,1,11,127,50,70,39,43,59,36,
+253,32,170,111,129,133,74,77,82,112,253,207,116,58,79,145,159,140,118,143,
+100,144,146,1,4,1,31,1,153,147,149,156,253,254,254,187,254,207,186,46,30,
+20,28,32,81,139,83,74,71,72,86,0,2,254,192,253,91,3,12,4,5,0,30,0,42,0,0,
+5,16,2,35,34,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,54,53,16,
+0,37,55,4,0,1,52,38,35,34,6,21,20,22,51,50,54,3,12,190,147,183,75,31,127,
+81,122,144,146,118,92,130,27,51,104,87,62,114,74,254,198,254,239,107,1,15,
+1,48,253,91,84,71,70,84,79,73,73,84,79,254,253,254,173,148,72,76,150,125,
+121,156,97,78,116,93,95,205,156,1,71,1,194,156,149,171,253,182,253,134,69,
+85,83,72,66,80,76,0,3,254,192,252,156,3,12,4,5,0,30,0,42,0,46,0,0,5,16,2,
+35,34,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,54,53,16,0,37,55,
+4,0,1,52,38,35,34,6,21,20,22,51,50,54,23,23,35,55,3,12,190,147,183,75,31,
+127,81,122,144,146,118,92,130,27,51,104,87,62,114,74,254,198,254,239,107,
+1,15,1,48,253,91,84,71,70,84,79,73,73,84,135,50,198,50,79,254,253,254,173,
+148,72,76,150,125,121,156,97,78,116,93,95,205,156,1,71,1,194,156,149,171,
+253,182,253,134,69,85,83,72,66,80,76,200,235,235,0,1,255,136,252,216,3,20,
+4,5,0,59,0,0,3,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,53,52,54,51,
+50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,22,51,50,18,53,16,0,37,55,
+4,0,17,16,2,35,34,39,6,6,35,34,38,112,62,84,53,42,42,37,36,46,13,46,55,97,
+77,75,102,56,69,46,36,36,37,52,63,20,59,22,72,63,112,133,254,235,254,202,
+107,1,20,1,43,181,137,146,62,35,92,56,84,107,253,129,58,87,63,40,58,30,32,
+46,46,37,30,24,25,51,61,67,84,89,63,53,91,53,35,48,25,23,31,61,65,67,59,1,
+20,235,1,80,1,235,177,149,174,253,166,254,135,254,218,254,122,150,85,65,95,
+0,2,255,136,252,15,3,20,4,5,0,59,0,63,0,0,3,52,54,55,54,54,53,52,38,35,34,
+6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,55,51,22,
+22,51,50,18,53,16,0,37,55,4,0,17,16,2,35,34,39,6,6,35,34,38,5,51,23,35,112,
+62,84,53,42,42,37,36,46,13,46,55,97,77,75,102,56,69,46,36,36,37,52,63,20,
+59,22,72,63,112,133,254,235,254,202,107,1,20,1,43,181,137,146,62,35,92,56,
+84,107,1,70,98,50,198,253,129,58,87,63,40,58,30,32,46,46,37,30,24,25,51,61,
+67,84,89,63,53,91,53,35,48,25,23,31,61,65,67,59,1,20,235,1,80,1,235,177,149,
+174,253,166,254,135,254,218,254,122,150,85,65,95,61,235,0,2,255,156,253,91,
+2,44,3,255,0,39,0,51,0,0,1,6,35,34,38,53,52,54,54,55,54,54,53,52,38,39,55,
+22,22,21,20,6,6,7,54,51,50,22,21,20,6,35,34,39,7,20,22,51,50,55,1,20,22,51,
+50,54,53,52,38,35,34,6,2,44,142,187,139,188,63,87,73,84,78,84,98,115,98,76,
+40,114,116,33,36,117,124,127,106,138,53,1,114,101,112,111,254,134,67,64,60,
+68,68,64,62,65,253,223,132,179,137,82,194,179,136,157,176,63,83,112,60,142,
+62,155,87,73,148,244,211,11,117,95,93,112,82,31,95,102,87,1,34,44,54,54,44,
+45,56,57,0,1,0,0,253,91,2,217,3,254,0,73,0,0,19,52,54,55,54,54,53,52,38,35,
+34,6,21,20,23,7,38,53,52,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,53,52,
+38,38,39,46,2,53,52,54,51,50,22,21,20,7,39,54,53,52,38,35,34,6,21,20,22,22,
+23,30,2,21,20,6,35,34,38,9,58,69,65,49,42,37,36,41,17,70,41,107,82,84,113,
+71,83,52,35,102,96,136,141,64,94,78,78,93,64,143,117,109,136,31,154,15,58,
+54,52,69,58,86,73,85,104,72,208,178,157,177,254,45,50,86,52,48,65,37,33,42,
+39,34,29,28,24,50,56,75,97,99,75,55,84,61,38,50,30,42,45,137,123,89,169,144,
+105,104,143,167,87,120,143,126,100,68,66,37,37,38,54,65,85,70,68,142,133,
+101,118,163,192,98,187,213,112,0,1,253,10,253,63,2,248,255,168,0,15,0,0,5,
+55,22,4,33,32,36,55,23,6,2,4,35,34,36,2,253,10,94,33,1,56,1,63,1,26,1,91,
+37,94,17,165,254,182,248,248,254,183,165,105,17,187,248,222,212,16,166,254,
+243,165,166,1,14,0,1,254,53,252,227,1,203,255,110,0,36,0,0,1,52,54,51,50,
+22,23,54,51,50,22,21,20,6,7,39,54,54,53,52,38,35,34,6,7,35,38,38,35,34,6,
+21,20,23,7,38,38,254,53,126,108,83,112,30,67,165,101,126,131,111,39,100,92,
+79,76,60,103,17,70,18,101,63,75,78,192,39,106,136,254,68,136,162,104,88,192,
+164,132,129,178,48,111,30,99,82,69,87,87,89,89,87,88,70,155,54,111,40,183,
+0,2,255,6,253,91,3,19,3,254,0,55,0,67,0,0,1,20,6,35,34,39,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,22,21,
+20,7,39,54,53,52,38,35,34,6,21,20,22,22,23,30,2,5,52,38,35,34,6,21,20,22,
+51,50,54,3,19,155,128,177,72,31,127,81,122,144,146,118,92,129,27,53,119,70,
+76,98,78,113,96,92,110,75,143,117,109,136,31,154,15,58,54,52,64,63,95,82,
+105,129,92,253,154,84,71,70,84,79,73,73,84,254,188,159,194,147,72,75,150,
+125,121,156,96,77,116,95,126,100,100,180,147,106,103,142,171,93,120,143,126,
+100,68,66,37,37,38,54,65,84,71,69,135,123,93,119,174,223,164,69,85,83,72,
+66,80,76,0,2,255,156,253,91,2,104,4,5,0,41,0,53,0,0,1,20,6,35,34,38,53,52,
+54,55,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,23,54,54,53,52,38,39,55,
+22,18,21,20,6,6,7,22,22,7,52,38,39,6,6,21,20,22,51,50,54,2,76,127,94,94,133,
+69,68,43,50,74,78,15,49,43,55,111,100,114,104,91,101,193,244,107,222,203,
+64,87,71,89,105,95,78,65,45,47,68,51,51,65,254,82,105,142,139,99,62,132,95,
+10,55,44,38,28,22,21,76,48,69,86,52,127,217,123,176,222,94,149,113,254,196,
+189,109,186,138,94,61,168,35,70,105,30,62,102,52,52,61,65,0,2,254,9,252,216,
+1,203,255,135,0,42,0,54,0,0,1,6,35,34,38,39,6,35,34,39,6,6,35,34,38,53,52,
+54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,22,21,20,6,21,20,22,51,50,
+55,37,52,38,35,34,6,21,20,22,51,50,54,1,203,53,68,44,67,14,56,98,121,82,16,
+95,64,84,100,102,81,61,87,20,45,100,61,64,79,138,144,4,152,196,7,41,34,37,
+40,253,144,57,48,48,57,54,49,50,57,252,254,38,44,36,80,138,67,71,109,92,88,
+114,64,53,74,65,100,83,111,131,6,109,7,226,165,24,57,14,31,37,25,74,51,60,
+60,52,48,57,54,0,1,255,6,253,79,3,1,4,5,0,36,0,0,7,34,21,20,22,23,7,38,38,
+53,52,54,51,50,22,23,22,22,51,50,54,53,16,0,37,55,4,0,17,20,2,35,34,38,39,
+38,38,14,106,41,31,165,18,19,133,110,78,114,76,67,104,66,80,90,254,243,254,
+211,107,1,27,1,25,150,130,90,141,82,62,80,210,159,73,160,64,9,57,140,53,135,
+165,70,107,94,85,163,164,1,95,1,228,199,149,216,253,134,254,126,221,254,251,
+127,152,117,83,0,3,253,197,252,216,2,58,255,132,0,44,0,55,0,67,0,0,1,20,6,
+35,34,38,53,52,55,35,22,22,21,20,6,35,34,39,6,6,35,34,38,53,52,54,51,50,22,
+23,22,22,51,50,54,53,52,38,39,35,55,33,50,22,22,7,52,38,35,34,6,21,20,22,
+51,50,5,52,38,35,34,6,21,20,22,51,50,54,2,58,84,72,72,81,19,203,67,68,120,
+97,123,82,16,96,65,84,100,102,81,64,90,19,46,96,63,69,72,77,74,139,9,1,203,
+114,98,49,81,42,36,36,41,44,34,77,253,0,58,48,48,57,53,50,51,57,254,219,75,
+90,84,66,43,33,58,161,84,121,152,141,68,73,110,93,88,114,70,57,66,64,97,74,
+75,136,46,108,41,79,66,40,45,44,41,42,44,180,50,61,60,52,48,58,55,0,2,254,
+50,252,217,1,205,255,132,0,59,0,71,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,21,20,6,35,34,38,53,55,6,21,20,22,51,50,55,51,22,51,50,54,
+53,52,38,35,34,6,21,20,22,23,7,33,53,51,38,38,53,52,54,51,50,22,5,20,22,51,
+50,54,53,52,38,35,34,6,1,205,141,110,70,112,28,28,112,70,108,144,156,125,
+87,96,93,79,76,95,1,47,98,79,145,43,43,43,146,79,98,68,59,27,36,40,44,21,
+254,244,186,41,38,84,61,101,116,253,41,53,40,40,51,54,42,38,50,254,57,155,
+197,81,68,67,82,184,138,161,200,92,71,75,91,84,77,12,68,95,97,119,140,140,
+117,99,107,112,33,30,33,46,19,60,68,30,58,38,54,73,177,3,44,48,50,42,41,49,
+47,0,3,255,106,252,216,2,180,3,253,0,45,0,57,0,66,0,0,1,22,21,20,6,35,34,
+38,53,52,55,38,38,53,52,54,51,50,22,21,20,6,35,34,38,53,55,6,21,20,22,23,
+22,23,54,18,53,16,2,37,55,22,18,17,20,2,1,20,22,51,50,54,53,52,38,35,34,6,
+1,52,35,34,21,20,22,51,50,1,178,23,100,86,88,100,33,121,145,166,120,88,97,
+95,80,77,95,4,56,94,129,118,70,128,139,237,254,243,111,250,237,140,254,20,
+47,34,38,44,44,36,37,46,1,55,97,99,51,47,98,253,214,40,54,70,90,82,71,50,
+34,9,142,107,119,168,93,73,76,93,86,79,31,54,70,55,81,9,9,29,63,1,21,173,
+1,16,1,131,168,153,188,254,45,254,220,205,254,172,1,6,40,43,44,39,36,43,41,
+254,57,69,70,31,36,0,2,254,217,251,211,1,64,255,130,0,36,0,67,0,0,19,52,38,
+39,39,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,23,22,21,20,
+6,35,34,39,55,22,51,50,54,19,21,34,39,6,6,35,34,39,6,35,34,38,53,52,55,51,
+22,22,51,50,55,51,22,51,50,54,55,51,22,22,196,59,71,84,134,107,140,110,95,
+142,65,62,61,114,73,81,76,77,90,79,217,148,119,207,110,65,98,153,82,93,124,
+73,39,9,65,45,84,42,44,82,53,69,4,35,9,46,41,73,20,39,22,71,41,47,9,35,14,
+48,253,203,43,46,7,6,12,83,77,72,93,57,50,70,59,59,61,46,51,45,7,7,18,172,
+95,118,177,54,86,48,254,201,108,80,60,58,96,96,78,81,29,27,55,47,75,75,47,
+55,38,31,0,1,0,35,255,230,3,208,6,139,0,62,0,0,1,20,51,33,7,33,34,21,20,22,
+23,22,22,23,7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,
+50,54,53,52,38,39,39,38,38,53,52,54,55,38,53,52,55,38,38,53,52,54,51,33,7,
+33,34,1,116,114,1,44,12,254,224,114,54,55,145,216,101,96,94,175,113,126,116,
+117,139,123,186,148,227,183,254,191,170,100,156,233,127,142,92,109,129,192,
+178,102,99,51,111,51,60,131,112,1,234,12,254,34,114,5,149,80,165,81,40,37,
+3,1,87,76,111,92,91,94,71,78,70,11,10,16,157,120,147,183,1,19,82,133,74,73,
+65,73,9,11,16,122,127,70,127,32,51,76,124,53,22,81,55,99,117,165,0,4,0,40,
+254,203,6,78,6,139,0,74,0,86,0,96,0,100,0,0,55,52,54,51,50,22,23,54,53,52,
+39,22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,7,22,22,51,50,54,53,16,37,
+38,38,53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,51,33,7,33,34,21,20,23,
+22,18,21,20,6,6,35,34,38,39,6,6,35,34,38,1,52,38,35,34,6,21,20,22,51,50,54,
+19,38,38,35,34,6,21,20,51,50,23,51,19,35,40,140,136,84,155,102,73,90,6,133,
+113,115,136,145,121,181,227,57,72,121,85,130,147,254,216,107,127,111,51,60,
+131,112,2,68,12,253,200,114,114,1,44,12,254,224,114,124,189,203,96,160,94,
+94,161,129,64,184,108,142,164,1,243,74,55,62,76,73,57,59,78,43,72,124,81,
+64,74,182,137,172,108,70,246,211,111,124,61,60,101,143,150,95,22,25,115,133,
+138,117,115,135,254,249,213,153,132,37,25,154,159,1,38,144,8,88,76,124,53,
+22,81,55,99,117,165,81,80,165,75,82,8,76,254,234,229,147,208,106,70,107,86,
+91,127,2,133,65,73,74,64,64,76,73,254,82,55,48,43,40,89,170,254,192,0,1,0,
+85,255,245,4,86,6,139,0,48,0,0,1,20,51,33,7,33,34,21,20,51,51,50,0,17,20,
+7,39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,52,18,55,38,53,52,55,38,38,
+53,52,54,51,33,7,33,34,1,160,114,1,44,12,254,224,114,114,51,223,1,14,87,215,
+70,75,177,160,159,178,74,70,217,85,149,130,77,111,51,60,131,112,2,68,12,253,
+200,114,5,149,80,165,81,80,254,196,254,251,206,250,10,146,251,148,184,202,
+199,182,147,254,254,145,11,235,226,188,1,18,63,55,94,124,53,22,81,55,99,117,
+165,0,4,0,70,254,203,7,182,6,139,0,27,0,79,0,91,0,95,0,0,19,38,38,53,52,54,
+51,33,7,33,34,21,20,51,33,7,33,34,21,20,51,51,7,35,34,38,53,52,1,20,6,35,
+34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,
+52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,5,52,38,35,
+34,6,21,20,22,51,50,54,23,19,35,19,248,51,60,131,112,2,68,12,253,200,114,
+114,1,44,12,254,224,114,114,145,6,139,111,132,7,45,181,158,201,143,36,157,
+115,108,167,54,26,155,104,136,163,165,132,98,141,33,75,161,100,105,127,222,
+235,6,168,1,2,140,2,68,146,93,105,127,222,235,6,168,1,2,140,250,113,97,83,
+81,97,92,84,86,96,174,70,246,68,5,21,22,81,55,99,117,165,81,80,165,81,80,
+92,107,86,124,252,196,206,240,237,111,126,126,88,104,110,169,141,136,175,
+97,80,116,101,154,127,172,202,9,168,8,169,254,237,161,53,84,82,154,127,172,
+202,9,168,8,169,254,237,252,81,97,96,83,77,93,88,235,254,192,1,64,0,1,0,65,
+255,230,5,87,6,139,0,95,0,0,1,20,51,33,7,33,34,21,20,51,51,7,51,7,51,21,33,
+6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,21,20,6,35,34,
+38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,
+52,54,51,50,22,21,20,7,51,39,35,34,38,53,52,55,38,38,53,52,54,51,33,7,33,
+34,2,161,114,1,44,12,254,224,114,114,145,3,1,19,219,253,226,42,116,75,62,
+28,82,68,175,60,64,40,104,90,80,82,33,120,36,148,120,101,139,43,57,148,92,
+134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,4,179,15,6,111,
+132,111,51,60,131,112,2,68,12,253,200,114,5,149,80,165,81,80,42,235,88,54,
+83,54,52,50,36,60,68,216,118,98,97,76,80,80,106,116,151,187,102,128,130,100,
+147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,132,96,29,
+20,185,107,86,124,53,22,81,55,99,117,165,0,1,0,65,255,230,5,35,6,139,0,66,
+0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,55,35,53,33,23,6,6,21,20,22,51,
+50,55,51,22,22,51,50,54,53,52,38,39,7,34,38,53,52,55,38,38,53,52,54,51,33,
+7,33,34,21,20,51,33,7,33,34,6,21,20,51,55,22,0,5,35,165,132,115,134,55,57,
+148,92,124,163,164,229,1,102,30,92,88,91,83,175,60,64,34,119,90,88,107,204,
+169,65,157,148,111,51,60,131,112,2,68,12,253,200,114,114,1,44,12,254,218,
+55,54,202,48,239,1,1,1,149,192,239,109,121,130,100,156,122,191,104,104,92,
+51,102,68,61,76,216,115,101,122,123,193,236,49,3,114,89,124,53,22,81,55,99,
+117,165,81,80,165,50,42,100,1,47,254,205,255,255,0,65,254,203,5,35,6,139,
+2,38,0,146,0,0,0,6,2,159,0,0,0,1,0,75,255,230,5,155,6,139,0,101,0,0,55,52,
+54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,7,22,51,
+50,53,52,38,39,7,34,38,53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,51,33,
+7,33,34,21,20,51,55,22,22,21,20,6,35,34,39,6,7,14,2,21,20,22,51,50,55,51,
+22,22,51,50,54,53,52,39,51,22,21,20,6,35,34,38,39,6,6,35,34,38,87,98,138,
+87,67,68,59,59,75,22,74,41,48,156,125,122,165,3,108,136,157,69,70,48,112,
+130,111,51,60,131,112,2,68,12,253,200,114,114,1,44,12,254,224,114,133,43,
+128,154,154,132,168,143,42,120,75,62,28,82,68,175,60,64,40,102,88,80,78,34,
+129,36,162,116,99,131,43,57,148,92,134,174,232,88,134,99,61,88,47,50,70,71,
+57,48,36,36,33,92,46,103,128,132,96,43,81,126,59,65,13,2,104,88,124,53,22,
+81,55,99,117,165,81,80,165,81,82,2,5,111,113,112,130,111,57,85,54,52,50,36,
+60,68,216,118,98,73,62,70,62,87,115,121,171,101,129,130,100,147,0,3,0,80,
+254,203,9,110,6,139,0,79,0,91,0,95,0,0,1,20,6,35,34,39,6,6,35,34,3,6,6,35,
+34,0,53,52,54,55,38,38,53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,51,33,
+7,33,34,21,20,51,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,4,18,
+21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,
+54,1,19,35,19,9,110,181,158,205,145,36,158,117,219,150,57,238,165,231,254,
+238,140,128,41,42,111,51,60,131,112,2,68,12,253,200,114,114,1,44,12,254,224,
+114,114,77,155,229,122,8,72,151,100,105,127,222,235,6,168,1,2,140,1,70,148,
+97,105,127,222,235,6,168,1,2,140,250,80,201,172,171,201,198,174,176,197,3,
+57,70,246,68,1,164,206,240,247,116,131,1,26,133,149,1,31,237,159,252,63,26,
+81,45,124,53,22,81,55,99,117,165,81,80,165,81,80,138,239,148,53,56,95,93,
+154,127,172,202,9,168,8,169,254,237,161,42,90,87,154,127,172,202,9,168,8,
+169,254,237,20,171,199,200,170,165,189,187,254,129,254,192,1,64,0,2,0,60,
+255,231,7,137,6,139,0,88,0,99,0,0,1,20,51,33,7,33,34,21,20,51,51,7,51,7,51,
+21,33,20,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,54,53,
+52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,
+51,50,22,23,51,39,35,34,38,53,52,55,38,38,53,52,54,51,33,7,33,34,3,38,35,
+34,6,21,20,22,51,50,54,4,211,114,1,44,12,254,224,114,114,145,3,1,19,213,254,
+15,48,107,23,91,21,54,77,240,126,145,201,219,186,210,137,32,117,95,79,105,
+24,75,24,114,92,90,91,58,77,111,162,125,100,166,33,27,136,98,109,146,20,188,
+15,6,111,132,111,51,60,131,112,2,68,12,253,200,114,214,116,188,129,133,121,
+102,104,181,5,149,80,165,81,80,42,235,88,130,129,107,164,81,71,19,72,67,99,
+74,152,180,170,124,127,149,85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,
+135,123,164,133,104,105,132,151,126,185,107,86,124,53,22,81,55,99,117,165,
+251,152,75,70,58,57,71,98,0,2,0,80,255,230,5,255,6,139,0,76,0,88,0,0,19,52,
+18,55,39,51,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,
+51,50,54,53,52,38,39,46,2,53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,51,
+33,7,33,34,21,20,23,22,18,21,20,6,6,35,34,38,39,6,6,35,34,38,38,1,52,38,35,
+34,6,21,20,22,51,50,54,80,172,142,17,235,16,85,91,136,115,111,135,10,112,
+133,116,184,61,64,33,141,93,127,133,104,132,86,130,94,111,51,60,131,112,2,
+68,12,253,200,114,114,1,44,12,254,224,114,187,177,148,96,163,96,88,163,48,
+52,133,84,97,160,93,2,57,73,60,60,74,75,57,62,73,1,217,192,1,36,48,210,203,
+23,128,88,117,138,128,106,38,33,126,197,141,158,216,112,104,163,149,145,196,
+81,7,32,85,76,114,52,22,81,55,99,117,165,81,80,165,75,81,11,82,254,241,205,
+137,222,126,113,117,122,108,120,226,1,170,64,74,72,66,67,73,75,0,3,0,80,255,
+230,4,86,6,139,0,37,0,49,0,61,0,0,1,20,51,33,7,33,34,21,20,51,51,50,22,22,
+21,20,0,35,34,0,53,52,18,55,38,53,52,55,38,38,53,52,54,51,33,7,33,34,19,34,
+6,21,20,22,51,50,54,53,52,38,7,50,22,21,20,6,35,34,38,53,52,54,1,160,114,
+1,44,12,254,224,114,114,55,155,229,122,254,236,230,231,254,238,147,134,74,
+111,51,60,131,112,2,68,12,253,200,114,169,171,201,198,174,176,197,201,171,
+54,69,68,55,55,67,68,5,149,80,165,81,80,138,239,148,238,254,226,1,31,237,
+163,1,0,61,54,92,124,53,22,81,55,99,117,165,253,189,200,170,165,189,187,167,
+171,199,241,69,52,52,68,68,52,52,69,0,2,0,80,255,230,5,112,6,139,0,65,0,77,
+0,0,1,20,6,35,32,39,6,6,35,34,38,53,52,18,55,38,53,52,55,38,38,53,52,54,51,
+33,7,33,34,21,20,51,33,7,33,34,21,20,51,51,50,22,23,7,38,35,34,6,6,21,20,
+22,51,50,55,51,22,22,23,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,
+50,54,5,112,204,143,254,254,106,57,148,92,138,166,224,197,79,111,51,60,131,
+112,2,68,12,253,200,114,114,1,44,12,254,224,114,114,96,121,187,87,62,161,
+172,145,253,152,107,96,175,60,64,32,132,113,96,130,105,118,145,122,74,64,
+64,76,73,67,65,73,1,67,143,206,230,130,100,203,169,216,1,78,78,55,95,124,
+53,22,81,55,99,117,165,81,80,165,81,80,54,58,82,102,132,240,155,101,102,216,
+109,101,5,53,125,96,119,149,86,62,76,73,57,59,78,74,255,255,0,80,254,203,
+5,112,6,139,2,38,0,153,0,0,0,6,2,159,224,0,0,2,0,75,255,230,6,196,6,139,0,
+91,0,103,0,0,1,20,51,33,7,33,34,21,20,51,51,22,18,21,20,6,6,35,34,38,53,52,
+54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,51,51,
+21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,53,52,54,51,
+50,22,23,54,55,38,53,52,55,38,38,53,52,54,51,33,7,33,34,19,52,38,35,34,6,
+21,20,22,51,50,54,4,14,114,1,44,12,254,224,114,114,34,179,235,117,182,94,
+141,186,147,119,104,133,34,141,180,147,107,164,22,78,25,149,125,114,120,134,
+123,62,80,122,145,131,123,124,132,44,139,132,196,243,111,93,84,94,204,156,
+130,194,53,50,105,84,111,51,60,131,112,2,68,12,253,200,114,242,74,64,64,76,
+73,67,65,73,5,149,80,165,81,80,2,254,219,222,168,241,123,174,134,125,158,
+128,101,69,58,99,223,150,189,127,98,104,121,75,68,68,76,98,77,65,63,79,33,
+216,44,178,143,87,122,30,35,117,72,116,149,128,114,126,64,54,99,124,53,22,
+81,55,99,117,165,251,100,62,76,73,57,59,78,74,0,3,0,80,255,230,6,119,6,139,
+0,71,0,83,0,95,0,0,1,20,51,33,7,33,34,21,20,51,51,50,22,22,21,16,0,33,32,
+0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,
+38,39,22,21,20,6,35,34,38,53,52,55,38,38,53,52,55,38,38,53,52,54,51,33,7,
+33,34,1,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,
+3,193,114,1,44,12,254,224,114,114,49,111,186,109,254,128,254,171,254,171,
+254,128,234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,41,50,42,
+13,131,105,115,136,78,50,52,111,51,60,131,112,2,68,12,253,200,114,253,171,
+75,57,62,73,73,60,60,74,3,114,74,60,60,73,73,62,57,75,5,149,80,165,81,80,
+119,213,134,254,236,254,205,1,51,1,20,199,1,11,135,115,117,138,119,98,40,
+41,41,123,73,173,199,199,173,73,123,41,41,40,98,119,138,117,120,68,25,88,
+50,124,53,22,81,55,99,117,165,253,4,67,73,75,65,64,74,72,66,66,72,74,64,65,
+75,73,0,4,0,80,254,203,5,1,6,139,0,43,0,60,0,72,0,76,0,0,1,20,6,35,34,38,
+39,6,6,35,34,38,53,52,18,55,38,53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,
+51,33,7,33,34,21,20,51,51,50,4,18,7,52,0,35,34,0,21,20,22,51,50,55,51,22,
+51,50,54,1,20,6,35,34,38,53,52,54,51,50,22,3,19,35,19,5,1,172,142,91,152,
+43,44,153,90,143,171,208,179,65,111,51,60,131,112,2,68,12,253,200,114,114,
+1,44,12,254,224,114,114,35,165,1,19,161,131,254,249,207,207,254,250,113,94,
+171,60,63,60,171,94,113,254,171,68,55,55,67,68,54,54,69,74,70,246,68,1,135,
+190,227,119,111,111,119,227,190,207,1,64,67,53,86,124,53,22,81,55,99,117,
+165,81,80,165,81,80,160,254,223,110,205,1,6,254,250,205,127,136,216,216,136,
+1,80,52,68,68,52,52,69,69,253,54,254,192,1,64,0,2,0,80,255,230,5,2,6,139,
+0,42,0,60,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,53,52,55,38,
+38,53,52,54,51,33,7,33,34,21,20,51,33,7,33,34,21,20,51,51,4,0,7,52,2,35,34,
+6,21,20,22,51,50,55,51,22,22,51,50,54,5,2,159,138,115,134,55,57,148,92,144,
+160,203,180,61,111,51,60,131,112,2,68,12,253,200,114,114,1,44,12,254,224,
+114,114,40,1,16,1,69,131,247,223,223,247,110,93,175,60,64,34,119,90,90,105,
+1,149,201,230,109,121,130,100,228,203,213,1,54,61,51,84,124,53,22,81,55,99,
+117,165,81,80,165,81,80,2,254,176,239,229,1,0,253,234,129,114,216,115,101,
+117,0,3,0,80,254,203,5,1,6,139,0,43,0,60,0,64,0,0,1,20,6,35,34,38,39,6,6,
+35,34,38,53,52,18,55,38,53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,51,33,
+7,33,34,21,20,51,51,22,4,18,7,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,
+54,1,19,35,19,5,1,172,142,91,152,43,44,153,90,143,171,210,178,65,111,51,60,
+131,112,2,68,12,253,200,114,114,1,44,12,254,224,114,114,39,164,1,16,160,131,
+254,249,207,207,254,250,113,94,171,60,63,60,171,94,113,254,97,70,246,68,1,
+135,190,227,119,111,111,119,227,190,207,1,65,66,53,86,124,53,22,81,55,99,
+117,165,81,80,165,81,80,1,161,254,225,110,205,1,6,254,250,205,127,136,216,
+216,136,254,186,254,192,1,64,0,1,0,70,255,230,5,51,6,139,0,63,0,0,1,34,21,
+20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,53,52,36,37,35,34,38,
+53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,51,33,7,33,34,21,20,51,51,4,0,
+21,20,6,35,34,38,39,38,38,1,94,126,48,37,195,21,23,159,129,93,137,87,57,80,
+101,68,113,111,254,225,254,248,84,110,133,111,51,60,131,112,2,68,12,253,200,
+114,114,1,44,12,254,224,114,114,108,1,73,1,68,173,180,134,186,84,70,97,2,
+6,185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,128,119,219,243,21,105,
+88,124,53,22,81,55,99,117,165,81,80,165,81,80,38,254,203,249,211,242,152,
+160,132,100,0,3,0,75,255,230,5,37,6,139,0,27,0,58,0,70,0,0,1,38,38,53,52,
+54,51,33,7,33,34,21,20,51,33,7,33,34,21,20,51,51,7,35,34,38,53,52,1,20,6,
+35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,
+55,22,0,1,52,38,35,34,6,21,20,22,51,50,54,1,63,51,60,131,112,2,68,12,253,
+200,114,114,1,44,12,254,224,114,114,145,6,139,111,132,4,85,165,164,108,167,
+54,26,155,104,136,163,165,132,98,141,33,75,161,100,118,126,236,233,6,255,
+1,45,253,7,97,83,81,97,92,84,86,96,5,21,22,81,55,99,117,165,81,80,165,81,
+80,92,107,86,124,252,216,214,252,126,88,104,110,169,141,136,175,97,80,116,
+101,130,117,191,216,10,168,7,254,193,254,134,81,97,96,83,77,93,88,0,4,0,75,
+254,203,5,47,6,139,0,27,0,59,0,71,0,75,0,0,1,38,38,53,52,54,51,33,7,33,34,
+21,20,51,33,7,33,34,21,20,51,51,7,35,34,38,53,52,1,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,5,52,38,
+35,34,6,21,20,22,51,50,54,23,19,35,19,1,63,51,60,131,112,2,68,12,253,200,
+114,114,1,44,12,254,224,114,114,145,6,139,111,132,4,95,181,158,108,167,54,
+26,155,104,136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,
+140,252,253,97,83,81,97,92,84,86,96,174,70,246,68,5,21,22,81,55,99,117,165,
+81,80,165,81,80,92,107,86,124,252,196,206,240,126,88,104,110,169,141,136,
+175,97,80,116,101,154,127,172,202,9,168,8,169,254,237,252,81,97,96,83,77,
+93,88,235,254,192,1,64,0,1,0,75,255,230,5,126,6,139,0,89,0,0,1,20,51,33,7,
+33,34,21,20,51,51,30,2,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,
+54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,2,21,
+20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,7,34,38,53,52,55,38,38,53,52,
+54,51,33,7,33,34,2,200,114,1,44,12,254,224,114,115,62,120,193,111,85,145,
+87,99,149,56,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,
+122,165,79,124,75,62,28,82,68,175,60,64,34,114,89,111,126,184,154,42,108,
+127,111,51,60,131,112,2,68,12,253,200,114,5,149,80,165,81,80,20,154,253,160,
+142,209,111,101,129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,
+36,33,92,46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,115,101,168,145,
+169,207,48,2,101,87,124,53,22,81,55,99,117,165,255,255,0,75,254,203,5,126,
+6,139,2,38,0,163,0,0,0,6,2,159,228,0,0,2,0,75,255,230,7,203,6,139,0,75,0,
+87,0,0,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,
+22,22,51,50,54,53,52,38,39,35,38,38,53,52,55,38,38,53,52,54,51,33,7,33,34,
+21,20,51,33,7,33,34,21,20,51,23,4,0,21,7,22,22,51,50,54,53,52,38,39,55,22,
+0,1,52,38,35,34,6,21,20,22,51,50,54,7,203,165,164,205,144,35,159,124,114,
+172,54,26,155,104,136,163,165,132,98,141,33,75,161,100,122,137,245,227,158,
+104,125,111,51,60,131,112,2,68,12,253,200,114,114,1,44,12,254,224,114,114,
+141,1,19,1,49,1,70,148,97,118,126,236,233,6,255,1,45,250,97,97,83,81,97,92,
+84,86,96,1,184,214,252,246,116,130,126,88,104,110,169,141,136,175,97,80,116,
+101,137,129,181,238,45,3,105,85,124,53,22,81,55,99,117,165,81,80,165,81,80,
+1,39,254,199,243,49,90,87,130,117,191,216,10,168,7,254,193,254,134,81,97,
+96,83,77,93,88,0,2,0,80,255,230,9,52,6,139,0,78,0,90,0,0,1,20,6,35,34,39,
+6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,
+52,38,39,35,38,38,53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,51,33,7,33,
+34,21,20,51,51,22,18,21,7,22,22,51,50,54,53,52,38,39,55,22,0,5,52,38,35,34,
+6,21,20,22,51,50,54,9,52,165,164,200,142,35,151,113,208,146,61,230,156,231,
+254,238,120,229,156,155,229,122,14,66,143,92,118,126,213,182,47,106,125,111,
+51,60,131,112,2,68,12,253,200,114,114,1,44,12,254,224,114,114,46,225,252,
+2,67,146,93,118,126,236,233,6,255,1,45,250,138,201,172,171,201,198,174,176,
+197,1,184,214,252,234,112,122,254,120,134,1,31,237,147,239,139,138,239,148,
+71,67,80,79,140,125,181,252,32,3,106,84,124,53,22,81,55,99,117,165,81,80,
+165,81,80,44,254,198,235,63,84,82,130,117,191,216,10,168,7,254,193,146,171,
+199,200,170,165,189,187,0,2,0,80,255,230,4,97,6,139,0,37,0,49,0,0,1,20,51,
+33,7,33,34,21,20,51,51,30,2,21,20,0,35,34,0,53,52,18,55,38,53,52,55,38,38,
+53,52,54,51,33,7,33,34,19,34,6,21,20,22,51,50,54,53,52,38,1,171,114,1,44,
+12,254,224,114,114,53,152,226,119,254,236,230,231,254,238,151,137,70,111,
+51,60,131,112,2,68,12,253,200,114,158,171,201,198,174,176,197,201,5,149,80,
+165,81,80,2,139,237,147,238,254,226,1,31,237,165,1,3,59,54,89,124,53,22,81,
+55,99,117,165,253,189,200,170,165,189,187,167,171,199,0,2,0,80,255,230,5,
+224,6,139,0,60,0,72,0,0,1,20,51,33,7,33,34,21,20,51,51,22,18,21,16,0,33,32,
+0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,51,32,36,53,52,38,
+39,7,34,38,53,52,55,38,38,53,52,54,51,33,7,33,34,1,20,22,51,50,54,53,52,38,
+35,34,6,3,42,114,1,44,12,254,224,114,115,62,140,172,254,217,254,189,254,221,
+254,202,226,182,122,144,136,115,113,133,6,90,1,10,241,1,10,1,4,128,120,42,
+108,127,111,51,60,131,112,2,68,12,253,200,114,254,66,75,57,62,73,73,60,60,
+74,5,149,80,165,81,80,44,254,248,166,254,226,254,223,1,42,1,19,212,1,8,135,
+115,117,138,133,115,25,22,95,150,173,188,174,176,133,197,51,2,101,87,124,
+53,22,81,55,99,117,165,253,4,67,73,75,65,64,74,72,0,2,0,75,255,230,5,64,6,
+139,0,57,0,69,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,38,39,35,34,38,53,52,55,38,38,53,52,54,51,33,7,33,34,21,
+20,51,33,7,33,34,21,20,51,51,22,4,18,1,52,38,35,34,6,21,20,22,51,50,54,5,
+64,172,173,114,172,54,26,155,104,136,163,165,132,98,141,33,75,161,100,119,
+119,249,226,139,111,132,111,51,60,131,112,2,68,12,253,200,114,114,1,44,12,
+254,224,114,114,145,169,1,15,155,252,236,97,83,81,97,92,84,86,96,1,171,206,
+247,126,88,104,110,169,141,136,175,97,80,116,101,128,119,202,242,39,107,86,
+124,53,22,81,55,99,117,165,81,80,165,81,80,10,155,254,248,254,247,81,97,96,
+83,77,93,88,0,2,0,40,255,230,5,144,6,139,0,68,0,80,0,0,1,20,51,33,7,33,34,
+21,20,51,51,22,22,21,20,6,7,7,22,21,20,6,35,34,38,53,52,55,55,38,38,35,34,
+21,20,23,7,38,38,53,52,54,51,50,4,23,55,54,54,53,52,38,39,35,34,38,53,52,
+55,38,38,53,52,54,51,33,7,33,34,19,7,6,6,21,20,22,51,50,54,53,52,2,218,114,
+1,44,12,254,224,114,114,74,89,109,65,70,140,98,173,149,142,190,212,211,63,
+192,110,157,22,74,45,49,134,107,137,1,18,101,140,45,39,55,53,65,111,132,111,
+51,60,131,112,2,68,12,253,200,114,23,142,78,68,84,68,80,98,5,149,80,165,81,
+80,7,88,77,61,82,35,70,177,154,136,162,167,122,162,107,106,90,108,124,35,
+49,36,47,101,65,97,121,192,150,71,23,42,33,38,37,6,107,86,124,53,22,81,55,
+99,117,165,252,73,72,39,76,43,56,72,85,88,93,0,3,0,75,255,230,6,91,6,139,
+0,27,0,74,0,86,0,0,1,38,38,53,52,54,51,33,7,33,34,21,20,51,33,7,33,34,21,
+20,51,51,7,35,34,38,53,52,1,6,6,35,34,38,39,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,21,20,6,21,20,
+22,51,50,55,37,52,38,35,34,6,21,20,22,51,50,54,1,73,51,60,131,112,2,68,12,
+253,200,114,114,1,44,12,254,224,114,114,145,6,139,111,132,5,129,33,92,46,
+71,112,24,91,166,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,
+103,102,127,100,207,151,6,168,1,2,140,10,65,52,60,51,252,35,97,83,81,97,92,
+84,86,96,5,21,22,81,55,99,117,165,81,80,165,81,80,92,107,86,124,251,60,26,
+28,76,62,138,111,106,105,112,169,141,136,175,106,86,103,99,153,118,98,180,
+115,168,8,169,254,237,161,27,108,14,54,56,37,131,81,97,96,83,77,93,88,0,2,
+0,90,255,230,5,38,6,139,0,27,0,65,0,0,1,38,38,53,52,54,51,33,7,33,34,21,20,
+51,33,7,33,34,21,20,51,51,7,35,34,38,53,52,1,20,6,35,34,38,39,38,38,35,34,
+21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,53,52,38,39,55,22,
+0,1,72,51,60,131,112,2,68,12,253,200,114,114,1,44,12,254,224,114,114,145,
+6,139,111,132,4,77,165,164,126,185,84,70,97,57,126,48,37,195,21,23,159,129,
+93,137,87,57,80,101,68,113,111,236,233,6,255,1,45,5,21,22,81,55,99,117,165,
+81,80,165,81,80,92,107,86,124,252,216,214,252,153,159,132,100,185,83,179,
+72,10,65,158,58,150,186,82,116,75,83,49,128,119,191,216,10,168,7,254,193,
+0,4,0,75,255,230,7,130,6,139,0,27,0,75,0,87,0,99,0,0,1,38,38,53,52,54,51,
+33,7,33,34,21,20,51,33,7,33,34,21,20,51,51,7,35,34,38,53,52,1,20,6,35,34,
+38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,
+23,22,22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,
+50,54,1,52,38,35,34,6,21,20,22,51,50,54,1,74,51,60,131,112,2,68,12,253,200,
+114,114,1,44,12,254,224,114,114,145,6,139,111,132,6,167,137,115,113,135,31,
+254,183,108,111,83,159,109,107,161,65,25,155,105,136,163,165,132,103,144,
+31,75,156,103,108,132,124,121,237,15,2,230,126,132,108,57,123,72,63,61,71,
+76,57,66,68,251,37,97,83,81,97,92,84,86,96,5,21,22,81,55,99,117,165,81,80,
+165,81,80,92,107,86,124,254,27,116,137,126,106,64,52,90,247,129,113,191,114,
+111,106,105,112,169,141,136,175,106,86,103,99,145,117,115,210,70,165,21,67,
+108,89,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,0,2,0,80,255,230,
+6,154,6,139,0,90,0,102,0,0,1,20,51,33,7,33,34,21,20,51,51,22,18,21,20,6,6,
+35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,
+6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,52,38,35,34,6,21,20,22,23,7,33,
+53,33,38,38,53,52,55,38,38,53,52,55,38,38,53,52,54,51,33,7,33,34,1,20,22,
+51,50,54,53,52,38,35,34,6,3,228,114,1,44,12,254,224,114,114,1,145,168,99,
+167,100,103,161,42,42,161,103,100,167,99,232,176,122,144,136,115,113,133,
+5,41,48,78,125,70,214,60,64,60,214,70,125,78,108,93,39,52,58,64,30,254,120,
+1,17,61,55,61,45,45,111,51,60,131,112,2,68,12,253,200,114,253,136,78,59,57,
+73,76,62,55,74,5,149,80,165,81,80,3,254,241,235,166,245,129,125,105,105,125,
+129,245,166,219,1,34,135,115,117,138,133,115,20,25,48,147,81,107,151,76,216,
+216,76,151,107,154,181,51,45,51,73,28,92,104,47,89,58,83,57,26,83,47,124,
+53,22,81,55,99,117,165,253,4,67,73,76,64,64,74,73,0,3,0,70,255,231,5,121,
+6,139,0,74,0,86,0,98,0,0,37,52,55,38,38,53,52,54,54,51,50,22,21,20,6,35,34,
+38,53,52,55,6,21,20,22,23,22,23,54,54,53,52,38,39,35,34,38,53,52,55,38,38,
+53,52,54,51,33,7,33,34,21,20,51,33,7,33,34,21,20,22,23,51,22,22,21,20,6,7,
+22,21,20,6,35,34,38,19,52,38,35,34,6,21,20,22,51,50,54,19,52,38,35,34,6,21,
+20,22,51,50,54,1,111,41,153,185,93,166,104,108,128,121,102,101,118,6,80,126,
+166,175,91,138,162,104,94,22,96,117,111,51,60,131,112,2,68,12,253,200,114,
+114,1,44,12,254,224,114,52,50,66,131,147,193,158,40,130,107,112,126,188,62,
+51,51,64,64,49,53,62,190,71,65,68,69,70,66,67,70,179,65,47,13,191,143,100,
+178,107,120,102,104,123,119,102,21,21,80,86,73,109,13,14,50,25,147,115,88,
+124,26,106,81,124,53,22,81,55,99,117,165,81,80,165,81,35,44,1,35,173,130,
+141,178,33,58,86,96,118,109,2,181,54,63,60,57,58,62,64,254,10,49,51,54,47,
+46,53,52,0,2,0,35,254,79,3,217,6,139,0,62,0,94,0,0,1,52,38,39,39,38,38,53,
+52,54,55,38,53,52,55,38,38,53,52,54,51,33,7,33,34,21,20,51,33,7,33,34,21,
+20,22,23,22,22,23,7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,
+22,51,50,54,19,21,34,38,39,6,6,35,34,39,6,35,34,38,53,52,55,51,22,22,51,50,
+55,51,22,51,50,54,55,51,22,22,3,25,92,109,129,192,178,102,99,51,111,51,60,
+131,112,1,234,12,254,34,114,114,1,44,12,254,224,114,54,55,145,216,101,96,
+94,175,113,126,116,117,139,123,186,148,227,183,254,191,170,100,156,233,127,
+142,192,53,91,29,13,101,70,129,65,65,129,82,106,6,54,12,73,64,110,33,60,33,
+110,64,73,12,54,23,75,1,89,65,73,9,11,16,122,127,70,127,32,51,76,124,53,22,
+81,55,99,117,165,81,80,165,81,40,37,3,1,87,76,111,92,91,94,71,78,70,11,10,
+16,157,120,147,183,1,19,82,133,74,254,33,166,63,60,93,90,150,150,121,125,
+39,47,85,73,116,116,73,85,61,45,0,2,0,35,255,230,6,27,3,255,0,48,0,60,0,0,
+55,55,22,51,50,54,53,52,39,39,38,38,53,52,55,55,33,50,30,2,21,20,6,35,34,
+38,53,52,55,35,7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,1,52,38,
+35,34,6,21,20,22,51,50,54,35,100,156,233,123,139,194,129,193,161,66,15,3,
+182,126,132,108,57,137,115,113,135,31,202,96,77,127,118,123,112,114,126,123,
+184,143,218,185,254,191,4,211,72,63,61,71,76,57,66,68,249,82,133,69,65,113,
+17,11,17,119,104,86,60,164,21,67,108,64,116,137,126,106,64,52,112,63,49,80,
+61,68,63,9,10,16,139,112,152,174,2,252,64,74,72,66,67,73,73,0,5,0,40,254,
+203,8,4,4,0,0,66,0,78,0,90,0,100,0,104,0,0,1,20,6,35,34,38,53,52,55,33,22,
+22,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,39,22,
+21,20,6,35,34,38,53,52,54,51,50,18,21,20,7,22,22,51,50,54,53,52,39,35,55,
+33,50,30,2,5,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,
+50,54,1,50,55,38,38,35,34,6,21,20,5,19,35,19,8,4,137,115,113,135,31,254,204,
+62,62,100,165,97,70,138,127,64,184,108,142,164,140,136,84,155,102,73,90,6,
+133,113,115,136,145,121,181,227,57,72,117,67,130,141,129,230,15,2,168,126,
+132,108,57,250,23,74,55,62,76,73,57,59,78,5,110,72,63,61,71,76,57,66,68,249,
+212,137,96,72,124,81,64,74,2,87,70,246,68,2,251,116,137,126,106,64,52,80,
+206,112,150,220,115,73,104,86,91,127,109,111,124,61,60,101,143,150,95,22,
+25,115,133,138,117,115,135,254,249,213,153,131,37,26,170,143,219,126,164,
+21,67,108,80,65,73,74,64,64,76,73,58,64,74,72,66,67,73,73,254,22,69,55,48,
+43,40,89,170,254,192,1,64,0,2,0,85,255,245,6,162,3,255,0,41,0,53,0,0,1,20,
+6,35,34,38,53,52,55,33,22,22,21,20,6,7,39,54,54,53,52,38,35,34,6,21,20,22,
+23,7,38,53,52,54,55,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,6,
+162,137,115,113,135,31,254,140,105,117,45,42,215,73,72,182,155,156,181,73,
+71,217,85,117,106,228,15,4,151,126,132,108,57,123,72,63,61,71,76,57,66,68,
+2,251,116,137,126,106,64,52,67,243,163,88,187,120,10,140,217,117,177,207,
+204,175,118,227,134,11,232,168,162,240,67,165,21,67,108,89,64,74,72,66,67,
+73,73,0,5,0,70,254,203,10,5,5,226,0,13,0,81,0,93,0,105,0,109,0,0,19,55,22,
+23,54,0,55,23,6,4,7,35,38,38,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,
+35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,
+53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,
+52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,23,19,35,
+19,70,216,47,63,92,1,65,113,99,205,254,206,90,70,71,162,9,144,137,115,113,
+135,31,254,183,108,111,83,159,109,201,143,36,157,115,108,167,54,26,155,104,
+136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,140,2,68,146,
+93,108,132,125,120,237,15,2,230,126,132,108,57,123,72,63,61,71,76,57,66,68,
+248,157,97,83,81,97,92,84,86,96,174,70,246,68,4,251,12,152,119,67,1,45,122,
+99,192,237,47,43,195,254,106,116,137,126,106,64,52,90,247,129,113,191,114,
+237,111,126,126,88,104,110,169,141,136,175,97,80,116,101,154,127,172,202,
+9,168,8,169,254,237,161,53,84,82,145,117,109,216,70,165,21,67,108,89,64,74,
+72,66,67,73,73,254,170,81,97,96,83,77,93,88,235,254,192,1,64,0,2,0,65,255,
+230,6,191,4,102,0,83,0,95,0,0,1,20,6,35,34,38,53,52,55,33,7,51,21,33,6,7,
+14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,
+54,51,50,22,21,20,7,51,39,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,
+54,6,191,137,115,113,135,31,254,182,17,219,253,226,42,116,75,62,28,82,68,
+175,60,64,40,104,90,80,82,33,120,36,148,120,101,139,43,57,148,92,134,174,
+98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,4,179,17,105,15,2,91,
+126,132,108,57,123,72,63,61,71,76,57,66,68,3,98,116,137,126,106,64,52,215,
+88,54,83,54,52,50,36,60,68,216,118,98,97,76,80,80,106,116,151,187,102,128,
+130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,
+132,96,29,20,215,165,21,67,108,89,64,74,72,66,67,73,73,0,2,0,65,255,230,7,
+100,3,255,0,55,0,67,0,0,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,55,35,53,33,23,6,6,21,20,22,51,50,55,51,22,22,51,50,
+54,53,52,38,39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,7,100,137,
+115,113,135,31,254,187,109,108,165,132,115,134,55,57,148,92,124,163,164,229,
+1,102,30,92,88,91,83,175,60,64,34,119,90,107,100,119,126,254,19,15,3,228,
+126,132,108,57,123,72,63,61,71,76,57,66,68,2,251,116,137,126,106,64,52,87,
+240,137,185,235,109,121,130,100,156,122,191,104,104,92,51,102,68,61,76,216,
+115,101,133,108,119,222,75,165,21,67,108,89,64,74,72,66,67,73,73,255,255,
+0,65,254,203,7,100,3,255,2,38,0,182,0,0,0,6,2,159,0,0,0,2,0,75,255,230,7,
+45,3,255,0,90,0,102,0,0,55,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,
+38,53,52,54,51,50,22,21,7,22,51,50,54,53,52,39,35,55,33,50,30,2,21,20,6,35,
+34,38,53,52,55,35,22,21,20,6,35,34,39,6,7,14,2,21,20,22,51,50,55,51,22,22,
+51,50,54,53,52,39,51,22,21,20,6,35,34,38,39,6,6,35,34,38,1,52,38,35,34,6,
+21,20,22,51,50,54,87,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,
+3,108,136,82,75,50,231,15,2,127,126,132,108,57,137,115,113,135,31,177,8,154,
+132,168,143,42,120,75,62,28,82,68,175,60,64,40,102,88,80,78,34,129,36,162,
+116,99,131,43,57,148,92,134,174,6,91,72,63,61,71,76,57,66,68,232,88,134,99,
+61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,132,96,43,81,62,44,56,25,165,
+21,67,108,64,116,137,126,106,64,52,32,32,112,130,111,57,85,54,52,50,36,60,
+68,216,118,98,73,62,70,62,87,115,121,171,101,129,130,100,147,2,105,64,74,
+72,66,67,73,73,0,4,0,80,254,203,11,181,5,226,0,80,0,92,0,104,0,108,0,0,1,
+20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,39,6,6,35,34,3,6,6,35,34,
+0,53,52,18,55,38,39,55,22,23,55,54,0,55,23,0,7,22,18,21,20,7,22,22,51,50,
+54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,35,55,33,50,30,
+2,1,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,1,19,
+35,19,11,181,137,115,113,135,31,254,183,108,111,83,159,109,202,142,37,157,
+115,219,150,57,238,165,231,254,238,184,156,129,65,216,46,61,12,95,1,57,109,
+99,254,238,199,178,209,8,72,151,100,105,127,222,235,6,168,1,2,140,2,68,146,
+94,108,132,125,120,237,15,2,230,126,132,108,57,248,9,201,172,171,201,198,
+174,176,197,7,124,72,63,61,71,76,57,66,68,251,189,70,246,68,2,251,116,137,
+126,106,64,52,90,247,129,113,191,114,238,111,127,1,26,133,149,1,31,237,185,
+1,14,47,126,149,12,151,114,1,71,1,38,118,99,255,0,140,37,254,235,199,53,56,
+95,93,154,127,172,202,9,168,8,169,254,237,161,52,84,83,145,117,109,216,70,
+165,21,67,108,254,246,171,199,200,170,165,189,187,1,88,64,74,72,66,67,73,
+73,253,108,254,192,1,64,0,3,0,60,255,231,8,224,4,102,0,76,0,88,0,99,0,0,1,
+20,6,35,34,38,53,52,55,33,7,51,21,33,20,7,22,21,20,7,39,54,53,52,39,6,6,35,
+34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,23,54,54,51,50,22,23,51,39,35,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,1,38,35,34,6,21,20,22,51,50,54,8,224,137,115,113,
+135,31,254,199,17,213,254,15,48,107,23,91,21,54,77,240,126,145,201,219,186,
+210,137,32,117,95,79,105,24,75,24,114,92,90,91,58,77,111,162,125,100,166,
+33,27,136,98,109,146,20,188,17,122,15,2,91,126,132,108,57,123,72,63,61,71,
+76,57,66,68,251,152,116,188,129,133,121,102,104,181,3,98,116,137,126,106,
+64,52,215,88,130,129,107,164,81,71,19,72,67,99,74,152,180,170,124,127,149,
+85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,123,164,133,104,105,132,
+151,126,215,165,21,67,108,89,64,74,72,66,67,73,73,254,120,75,70,58,57,71,
+98,0,3,0,80,255,230,7,135,4,191,0,65,0,77,0,89,0,0,1,20,6,35,34,38,53,52,
+55,33,22,17,20,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,39,51,7,22,22,21,
+20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,
+35,55,33,50,30,2,5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,
+22,51,50,54,7,135,137,115,113,135,31,254,183,221,185,161,97,163,45,52,133,
+84,97,160,93,172,142,17,235,16,85,91,136,115,111,135,10,112,133,116,184,61,
+64,36,138,104,114,108,122,126,110,15,2,104,126,132,108,57,249,247,75,57,62,
+73,73,60,60,74,5,142,72,63,61,71,76,57,66,68,2,251,116,137,126,106,64,52,
+175,254,223,194,226,116,114,122,108,120,226,153,192,1,36,48,210,203,23,128,
+88,117,138,128,106,38,33,126,197,141,158,216,114,102,135,114,112,216,80,165,
+21,67,108,81,67,73,75,65,64,74,72,74,64,74,72,66,67,73,73,0,4,0,80,255,230,
+6,145,3,255,0,28,0,40,0,52,0,64,0,0,1,20,6,35,34,38,53,52,55,33,22,22,21,
+20,0,35,34,0,53,52,54,55,35,55,33,50,30,2,1,52,38,35,34,6,21,20,22,51,50,
+54,1,52,38,35,34,6,21,20,22,51,50,54,5,20,6,35,34,38,53,52,54,51,50,22,6,
+145,137,115,113,135,31,254,244,71,76,254,236,230,231,254,238,74,72,123,15,
+4,116,126,132,108,57,253,45,202,171,171,201,200,172,180,193,2,88,72,63,61,
+71,76,57,66,68,252,175,68,55,55,67,68,54,54,69,2,251,116,137,126,106,64,52,
+65,185,110,238,254,226,1,31,237,106,185,69,165,21,67,108,254,219,158,184,
+185,157,153,174,174,1,101,64,74,72,66,67,73,73,102,52,68,68,52,52,69,69,0,
+3,0,80,255,230,7,98,3,255,0,52,0,64,0,76,0,0,19,52,18,55,35,55,33,50,30,2,
+21,20,6,35,34,38,53,52,55,33,7,38,35,34,4,21,20,51,50,55,51,22,22,23,38,53,
+52,54,51,50,22,21,20,6,35,32,39,6,6,35,34,38,1,52,38,35,34,6,21,20,22,51,
+50,54,1,52,38,35,34,6,21,20,22,51,50,54,80,146,135,239,15,5,50,126,132,108,
+57,137,115,113,135,31,254,221,62,146,191,239,254,231,203,175,60,64,32,132,
+113,96,130,105,118,145,204,143,254,254,106,57,148,92,138,166,6,151,72,63,
+61,71,76,57,66,68,254,15,74,64,64,76,73,67,65,73,1,90,174,1,5,77,165,21,67,
+108,64,116,137,126,106,64,52,82,82,236,203,218,216,109,101,5,53,125,96,119,
+149,123,143,206,230,130,100,203,2,49,64,74,72,66,67,73,73,254,201,62,76,73,
+57,59,78,74,255,255,0,80,254,203,7,98,3,255,2,38,0,189,0,0,0,6,2,159,224,
+0,0,3,0,75,255,230,8,165,3,255,0,76,0,88,0,100,0,0,19,52,54,55,38,38,53,52,
+55,55,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,53,
+52,54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,51,
+51,21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,1,52,38,35,34,6,21,20,22,51,
+50,54,1,52,38,35,34,6,21,20,22,51,50,54,75,111,93,84,94,32,15,6,106,126,132,
+108,57,137,115,113,135,31,254,225,78,65,117,181,95,141,186,147,119,104,133,
+36,143,185,152,122,138,21,78,25,128,138,121,123,135,122,62,80,122,145,128,
+126,124,132,44,139,132,199,240,7,223,72,63,61,71,76,57,66,68,252,214,74,64,
+64,76,73,67,65,73,1,28,86,122,30,35,115,69,65,54,163,21,67,108,64,116,137,
+126,106,64,52,73,179,112,168,235,117,174,134,125,158,128,101,71,59,93,220,
+152,187,80,95,98,77,76,72,65,74,98,77,64,62,69,33,216,44,168,2,84,64,74,72,
+66,67,73,73,254,171,62,76,73,57,59,78,74,0,4,0,80,255,230,8,83,4,72,0,61,
+0,73,0,85,0,97,0,0,19,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,
+4,33,32,36,53,52,38,39,22,21,20,6,35,34,38,53,52,55,35,55,33,50,30,2,21,20,
+6,35,34,38,53,52,55,33,22,22,21,16,0,33,32,0,1,52,38,35,34,6,21,20,22,51,
+50,54,37,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,
+54,80,234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,41,50,42,
+13,131,105,115,136,50,109,15,3,128,126,132,108,57,137,115,113,135,31,254,
+221,75,84,254,128,254,171,254,171,254,128,7,136,72,63,61,71,76,57,66,68,250,
+159,73,60,60,74,75,57,62,73,2,103,74,60,60,73,73,62,57,75,2,45,199,1,11,135,
+115,117,138,119,98,40,41,41,123,73,173,199,199,173,73,123,41,41,40,98,119,
+138,117,93,65,165,21,67,108,64,116,137,126,106,64,52,63,193,118,254,236,254,
+205,1,51,2,18,64,74,72,66,67,73,73,2,64,74,72,66,67,73,75,65,66,72,74,64,
+65,75,73,0,5,0,80,254,203,7,48,3,255,0,34,0,46,0,63,0,75,0,79,0,0,19,52,54,
+55,35,55,33,50,30,2,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,
+6,6,35,34,38,1,52,38,35,34,6,21,20,22,51,50,54,5,51,22,51,50,54,53,52,38,
+35,34,6,21,20,22,51,50,3,52,54,51,50,22,21,20,6,35,34,38,19,51,19,35,80,140,
+129,241,15,5,14,126,132,108,57,137,115,113,135,31,254,161,125,136,177,137,
+91,152,43,44,153,90,137,177,6,101,72,63,61,71,76,57,66,68,251,212,63,60,171,
+95,112,248,222,215,254,112,95,171,25,68,54,54,69,68,55,55,67,63,108,70,246,
+1,121,157,250,74,165,21,67,108,64,116,137,126,106,64,52,74,251,156,177,226,
+119,111,111,119,227,2,25,64,74,72,66,67,73,73,254,216,113,112,203,229,235,
+197,112,113,1,176,52,69,69,52,52,68,68,253,198,254,192,0,3,0,80,255,230,7,
+48,3,255,0,34,0,46,0,63,0,0,19,52,54,55,35,55,33,50,30,2,21,20,6,35,34,38,
+53,52,55,33,22,22,21,20,6,35,34,38,39,6,6,35,34,38,1,52,38,35,34,6,21,20,
+22,51,50,54,5,51,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,80,140,129,241,
+15,5,14,126,132,108,57,137,115,113,135,31,254,161,125,136,177,137,91,152,
+43,44,153,90,137,177,6,101,72,63,61,71,76,57,66,68,251,212,63,60,171,95,112,
+248,222,215,254,112,95,171,1,121,157,250,74,165,21,67,108,64,116,137,126,
+106,64,52,74,251,156,177,226,119,111,111,119,227,2,25,64,74,72,66,67,73,73,
+254,216,113,112,203,229,235,197,112,113,255,255,0,80,254,203,7,48,3,255,2,
+38,0,194,0,0,0,6,2,159,218,0,0,2,0,70,255,230,7,136,3,255,0,54,0,66,0,0,1,
+20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,38,38,35,34,21,20,22,
+23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,53,52,38,39,33,55,33,50,30,
+2,7,52,38,35,34,6,21,20,22,51,50,54,7,136,137,115,113,135,31,254,163,108,
+111,83,159,109,134,186,84,70,97,57,126,48,37,195,21,23,159,129,93,137,87,
+57,80,99,66,104,129,124,121,253,108,15,4,161,126,132,108,57,123,72,63,61,
+71,76,57,66,68,2,251,116,137,126,106,64,52,90,247,129,113,191,114,152,160,
+132,100,185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,147,115,115,210,
+70,165,21,67,108,89,64,74,72,66,67,73,73,0,3,0,75,255,230,7,220,6,38,0,50,
+0,62,0,74,0,0,1,20,6,35,34,38,53,52,55,35,22,21,16,2,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,55,33,2,37,55,4,19,33,
+50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,
+54,7,220,137,115,113,135,31,192,27,195,190,111,169,54,26,155,104,136,163,
+165,132,98,141,33,75,161,100,132,153,25,252,48,15,3,136,139,254,153,6,1,198,
+158,1,30,126,132,108,57,123,72,63,61,71,76,57,66,68,250,203,97,83,81,97,92,
+84,86,96,2,251,116,137,126,106,64,52,126,141,254,217,254,190,126,88,104,110,
+169,141,136,175,97,80,116,101,228,196,121,112,165,1,32,95,168,144,254,105,
+21,67,108,89,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,255,255,0,
+75,254,203,7,220,6,38,2,38,0,197,0,0,0,6,2,159,213,0,0,2,0,75,255,230,7,78,
+3,255,0,77,0,89,0,0,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,
+51,50,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,35,
+55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,7,78,137,115,113,135,31,254,
+187,109,108,165,132,99,149,56,57,148,92,134,174,98,138,87,67,68,59,59,75,
+22,74,41,48,156,125,122,165,79,124,75,62,28,82,68,175,60,64,34,115,91,109,
+101,119,126,183,15,2,174,126,132,108,57,123,72,63,61,71,76,57,66,68,2,251,
+116,137,126,106,64,52,87,240,137,185,235,101,129,130,100,147,111,88,134,99,
+61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,134,97,72,108,91,54,52,50,
+36,60,68,216,116,100,133,108,119,222,75,165,21,67,108,89,64,74,72,66,67,73,
+73,255,255,0,75,254,203,7,78,3,255,2,38,0,199,0,0,0,6,2,159,228,0,0,3,0,75,
+255,230,10,36,5,226,0,79,0,91,0,103,0,0,1,20,6,35,34,38,53,52,55,33,22,22,
+21,20,6,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,38,38,35,35,38,38,39,55,22,23,54,0,55,23,0,7,22,0,21,21,22,
+22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,
+1,52,38,35,34,6,21,20,22,51,50,54,10,36,137,115,113,135,31,254,183,108,111,
+83,159,109,203,144,34,164,130,114,164,55,25,155,104,136,163,165,132,98,141,
+33,75,161,100,114,119,131,230,145,55,71,162,47,216,47,63,92,1,65,113,99,254,
+217,204,238,1,26,69,149,96,108,132,125,120,237,15,2,230,126,132,108,57,123,
+72,63,61,71,76,57,66,68,248,131,97,83,81,97,92,84,86,96,2,251,116,137,126,
+106,64,52,90,247,129,113,191,114,242,114,128,124,90,104,110,169,141,136,175,
+97,80,116,101,127,118,150,219,116,43,195,106,12,152,119,67,1,45,122,99,254,
+236,138,28,254,194,242,28,89,87,145,117,109,216,70,165,21,67,108,89,64,74,
+72,66,67,73,73,254,170,81,97,96,83,77,93,88,0,3,0,80,255,230,11,130,5,226,
+0,79,0,91,0,103,0,0,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,39,
+6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,
+52,38,39,38,38,39,55,22,23,54,0,55,23,0,7,22,18,21,7,22,22,51,50,54,53,52,
+38,39,35,55,33,50,30,2,1,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,
+21,20,22,51,50,54,11,130,137,115,113,135,31,254,183,108,111,83,159,109,195,
+140,77,218,208,146,61,230,156,231,254,238,120,229,156,155,229,122,14,66,143,
+92,118,126,203,174,71,162,47,216,47,63,92,1,65,113,99,254,190,214,161,174,
+3,65,141,90,108,132,125,120,237,15,2,230,126,132,108,57,248,60,201,172,171,
+201,198,174,176,197,7,73,72,63,61,71,76,57,66,68,2,251,116,137,126,106,64,
+52,90,247,129,113,191,114,223,223,254,120,134,1,31,237,147,239,139,138,239,
+148,71,67,80,79,140,125,180,241,44,43,195,106,12,152,119,67,1,45,122,99,254,
+209,138,71,254,233,186,76,77,76,145,117,109,216,70,165,21,67,108,254,246,
+171,199,200,170,165,189,187,1,88,64,74,72,66,67,73,73,0,3,0,80,255,230,6,
+145,3,255,0,28,0,40,0,52,0,0,1,20,6,35,34,38,53,52,55,33,22,22,21,20,0,35,
+34,0,53,52,54,55,35,55,33,50,30,2,1,52,38,35,34,6,21,20,22,51,50,54,1,52,
+38,35,34,6,21,20,22,51,50,54,6,145,137,115,113,135,31,254,244,71,76,254,236,
+230,231,254,238,74,72,123,15,4,116,126,132,108,57,253,45,202,171,171,201,
+200,172,180,193,2,88,72,63,61,71,76,57,66,68,2,251,116,137,126,106,64,52,
+65,185,110,238,254,226,1,31,237,106,185,69,165,21,67,108,254,219,158,184,
+185,157,153,174,174,1,101,64,74,72,66,67,73,73,0,3,0,80,255,230,7,79,3,255,
+0,49,0,61,0,73,0,0,1,20,6,35,34,38,53,52,55,35,22,21,16,0,33,32,0,17,52,18,
+51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,51,50,54,54,53,52,39,35,55,33,
+50,30,2,5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,
+54,7,79,137,115,113,135,31,242,99,254,213,254,251,254,223,254,182,226,182,
+122,144,136,115,113,133,6,90,1,22,251,157,207,97,115,185,15,2,58,126,132,
+108,57,250,29,75,57,62,73,73,60,60,74,5,104,72,63,61,71,76,57,66,68,2,251,
+116,137,126,106,64,52,127,197,254,250,254,214,1,26,1,35,212,1,8,135,115,117,
+138,133,115,25,22,95,150,178,183,102,169,102,177,101,165,21,67,108,81,67,
+73,75,65,64,74,72,74,64,74,72,66,67,73,73,0,3,0,75,255,230,7,130,3,255,0,
+47,0,59,0,71,0,0,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,33,55,33,50,
+30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,
+7,130,137,115,113,135,31,254,183,108,111,83,159,109,107,161,65,25,155,105,
+136,163,165,132,103,144,31,75,156,103,108,132,124,121,253,109,15,4,140,126,
+132,108,57,123,72,63,61,71,76,57,66,68,251,37,97,83,81,97,92,84,86,96,2,251,
+116,137,126,106,64,52,90,247,129,113,191,114,111,106,105,112,169,141,136,
+175,106,86,103,99,145,117,115,210,70,165,21,67,108,89,64,74,72,66,67,73,73,
+254,170,81,97,96,83,77,93,88,0,3,0,40,255,230,7,3,4,72,0,56,0,68,0,80,0,0,
+1,52,55,55,38,38,35,34,21,20,23,7,38,38,53,52,54,51,50,4,23,55,54,54,53,52,
+39,35,55,33,50,30,2,21,20,6,35,34,38,53,52,55,35,22,21,20,6,7,7,22,21,20,
+6,35,34,38,1,52,38,35,34,6,21,20,22,51,50,54,1,52,39,7,6,6,21,20,22,51,50,
+54,1,29,212,211,63,192,110,157,22,74,45,49,134,107,137,1,18,101,140,45,39,
+78,222,15,2,128,126,132,108,57,137,115,113,135,31,229,19,65,70,140,98,173,
+149,142,190,5,107,72,63,61,71,76,57,66,68,252,147,42,142,78,68,84,68,80,98,
+1,7,162,107,106,90,108,124,35,49,36,47,101,65,97,121,192,150,71,23,42,33,
+65,16,165,21,67,108,64,116,137,126,106,64,52,34,46,61,82,35,70,177,154,136,
+162,167,2,158,64,74,72,66,67,73,73,254,142,93,92,72,39,76,43,56,72,85,0,3,
+0,75,255,230,7,220,6,38,0,65,0,77,0,89,0,0,1,20,6,35,34,38,53,52,55,35,22,
+21,20,7,6,21,20,22,51,50,55,23,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,
+53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,55,33,2,37,55,4,19,33,50,
+30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,
+7,220,137,115,113,135,31,192,27,23,11,51,41,56,53,82,74,93,66,104,24,45,141,
+88,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,103,132,149,25,
+252,48,15,3,136,139,254,153,6,1,198,158,1,30,126,132,108,57,123,72,63,61,
+71,76,57,66,68,250,203,97,83,81,97,92,84,86,96,2,251,116,137,126,106,64,52,
+126,141,122,128,62,24,43,51,37,170,54,77,62,66,73,111,106,105,112,169,141,
+136,175,106,86,103,99,224,200,121,112,165,1,32,95,168,144,254,105,21,67,108,
+89,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,0,2,0,90,255,230,7,226,
+6,38,0,56,0,68,0,0,1,20,6,35,34,38,53,52,55,35,22,21,16,2,35,34,38,39,38,
+38,35,34,21,20,22,23,7,38,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,
+33,55,33,2,37,55,4,19,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,7,226,
+137,115,113,135,31,191,27,197,195,131,182,86,70,97,57,126,48,37,195,21,23,
+159,129,93,137,87,94,127,76,129,151,25,252,47,15,3,137,139,254,153,6,1,198,
+158,1,29,126,132,108,57,123,72,63,61,71,76,57,66,68,2,251,116,137,126,106,
+64,52,126,141,254,217,254,190,149,163,132,100,185,83,179,72,10,65,158,58,
+150,186,82,116,125,82,229,195,121,112,165,1,32,95,168,144,254,105,21,67,108,
+89,64,74,72,66,67,73,73,0,4,0,75,255,230,7,172,5,226,0,13,0,77,0,89,0,101,
+0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,1,20,6,35,34,38,53,52,55,33,22,
+22,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,
+53,52,38,39,35,55,33,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,30,3,7,
+52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,75,216,
+47,63,92,1,65,113,99,205,254,206,90,70,71,162,7,8,137,115,113,135,31,254,
+183,108,111,83,159,109,107,161,65,25,155,105,136,163,165,132,103,144,31,75,
+156,103,108,132,124,121,237,15,2,230,53,120,100,105,140,53,87,77,105,66,71,
+56,95,106,68,39,123,72,63,61,71,76,57,66,68,251,37,97,83,81,97,92,84,86,96,
+4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,254,106,116,137,126,106,
+64,52,90,247,129,113,191,114,111,106,105,112,169,141,136,175,106,86,103,99,
+145,117,115,210,70,165,61,87,93,112,101,90,38,93,62,47,67,44,6,43,64,90,79,
+64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,0,3,0,80,255,230,7,246,
+3,255,0,79,0,91,0,103,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,6,35,34,
+38,39,6,6,35,34,38,38,53,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,
+20,22,22,51,50,55,51,22,51,50,54,54,53,52,38,35,34,6,21,20,22,23,7,33,53,
+33,38,38,53,55,35,55,33,50,30,2,5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,
+35,34,6,21,20,22,51,50,54,7,246,137,115,113,135,31,214,69,99,167,100,103,
+161,42,42,161,103,100,167,99,232,176,122,144,136,115,113,133,5,41,48,78,125,
+70,214,60,64,60,214,70,125,78,108,93,39,52,58,64,30,254,120,1,17,61,55,2,
+78,15,3,12,126,132,108,57,249,118,78,59,57,73,76,62,55,74,6,15,72,63,61,71,
+76,57,66,68,2,251,116,137,126,106,64,52,133,211,166,245,129,125,105,105,125,
+129,245,166,219,1,34,135,115,117,138,133,115,20,25,48,147,81,107,151,76,216,
+216,76,151,107,154,181,51,45,51,73,28,92,104,47,89,58,30,165,21,67,108,81,
+67,73,76,64,64,74,73,73,64,74,72,66,67,73,73,0,4,0,70,255,231,6,160,3,255,
+0,59,0,71,0,83,0,95,0,0,1,20,6,35,34,38,53,52,55,33,22,21,20,5,22,21,20,6,
+35,34,38,53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,
+21,20,22,23,22,23,54,53,52,39,35,55,33,50,30,2,5,20,22,51,50,54,53,52,38,
+35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,
+54,6,160,137,115,113,135,31,254,249,129,254,222,39,130,107,112,126,41,153,
+185,93,166,104,108,128,121,102,101,118,6,80,126,166,175,93,238,112,111,15,
+2,18,126,132,108,57,250,167,64,49,53,62,62,51,51,64,4,222,72,63,61,71,76,
+57,66,68,252,196,71,65,68,69,70,66,67,70,2,251,116,137,126,106,64,52,97,148,
+231,50,58,85,96,118,109,95,65,47,13,191,143,100,178,107,120,102,104,123,119,
+102,21,21,80,86,73,109,13,14,51,33,197,142,75,165,21,67,108,50,58,62,64,56,
+54,63,60,96,64,74,72,66,67,73,73,254,60,49,51,54,47,46,53,52,0,3,0,35,254,
+79,6,27,3,255,0,48,0,60,0,92,0,0,1,20,6,35,34,38,53,52,55,35,7,38,38,35,34,
+6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,53,52,39,39,38,38,53,
+52,55,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,21,34,38,39,6,6,35,
+34,39,6,35,34,38,53,52,55,51,22,22,51,50,55,51,22,51,50,54,55,51,22,22,6,
+27,137,115,113,135,31,202,96,77,127,118,123,112,114,126,123,184,143,218,185,
+254,191,170,100,156,233,123,139,194,129,193,161,66,15,3,182,126,132,108,57,
+123,72,63,61,71,76,57,66,68,254,57,53,91,29,13,101,70,129,65,65,129,82,106,
+6,54,12,73,64,110,33,60,33,110,64,73,12,54,23,75,2,251,116,137,126,106,64,
+52,112,63,49,80,61,68,63,9,10,16,139,112,152,174,1,19,82,133,69,65,113,17,
+11,17,119,104,86,60,164,21,67,108,89,64,74,72,66,67,73,73,252,146,166,63,
+60,93,90,150,150,121,125,39,47,85,73,116,116,73,85,61,45,0,1,0,35,255,230,
+3,175,6,39,0,72,0,0,1,20,6,35,32,3,55,22,51,50,54,53,52,38,39,39,38,38,53,
+52,54,55,38,39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,
+6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,23,7,38,38,35,34,6,21,20,22,23,
+23,22,22,3,168,227,183,254,191,170,100,156,233,127,142,92,109,129,192,178,
+78,76,28,32,55,104,132,107,115,116,94,60,68,57,52,42,61,40,34,50,71,57,105,
+129,142,112,143,169,51,60,123,129,96,94,175,113,126,116,117,139,123,186,148,
+1,48,147,183,1,19,82,133,74,73,65,73,9,11,16,122,127,61,114,36,12,22,92,82,
+117,95,96,104,53,50,42,50,20,27,86,26,18,112,91,94,121,175,148,75,139,45,
+37,97,111,92,91,94,71,78,70,11,10,16,157,0,5,0,40,254,203,5,209,6,38,0,61,
+0,73,0,85,0,95,0,99,0,0,1,20,2,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,7,22,22,51,
+50,54,53,52,2,39,23,20,6,35,34,38,53,52,54,51,50,0,18,1,52,38,35,34,6,21,
+20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,3,50,55,38,38,35,34,6,21,
+20,5,19,35,19,5,209,119,184,100,94,161,129,64,184,108,142,164,140,136,84,
+155,102,73,90,6,133,113,115,136,145,121,181,227,57,72,121,85,156,177,160,
+137,1,133,110,115,139,145,116,164,1,42,182,253,253,74,60,60,73,72,59,64,72,
+254,77,74,55,62,76,73,57,59,78,190,137,96,72,124,81,64,74,2,87,70,246,68,
+2,86,215,254,232,128,70,107,86,91,127,109,111,124,61,60,101,143,150,95,22,
+25,115,133,138,117,115,135,254,249,213,153,132,37,25,241,211,220,1,95,117,
+24,117,135,137,113,114,145,254,238,254,60,1,189,66,72,74,64,65,75,73,254,
+33,65,73,74,64,64,76,73,254,13,69,55,48,43,40,89,170,254,192,1,64,0,2,0,85,
+255,245,4,50,5,118,0,33,0,48,0,0,1,20,7,39,54,54,53,52,38,35,34,6,21,20,18,
+23,7,38,53,52,18,55,38,38,53,52,54,51,50,22,21,20,7,22,39,54,53,52,38,35,
+34,6,21,20,22,23,54,51,50,4,50,87,215,70,75,177,160,159,178,74,70,217,85,
+130,116,59,64,185,156,194,228,34,137,211,9,180,149,100,106,62,63,60,59,163,
+1,190,206,250,10,146,251,148,184,202,199,182,147,254,254,145,11,235,226,176,
+1,6,69,26,97,64,116,138,202,172,90,66,158,226,38,25,109,130,63,59,43,56,7,
+13,0,4,0,70,254,203,7,182,6,39,0,36,0,88,0,100,0,104,0,0,1,20,22,51,50,54,
+55,23,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,55,22,51,50,54,53,
+52,38,35,34,6,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,
+39,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,23,19,35,19,1,70,57,52,42,
+61,40,34,50,71,57,105,129,142,112,143,169,173,155,66,156,65,55,104,132,107,
+115,116,94,60,68,6,112,181,158,201,143,36,157,115,108,167,54,26,155,104,136,
+163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,140,2,68,146,93,
+105,127,222,235,6,168,1,2,140,250,113,97,83,81,97,92,84,86,96,174,70,246,
+68,5,52,42,50,20,27,86,26,18,112,91,94,121,175,148,153,168,37,45,92,82,117,
+95,96,104,53,252,62,206,240,237,111,126,126,88,104,110,169,141,136,175,97,
+80,116,101,154,127,172,202,9,168,8,169,254,237,161,53,84,82,154,127,172,202,
+9,168,8,169,254,237,252,81,97,96,83,77,93,88,235,254,192,1,64,0,1,0,65,255,
+230,4,209,6,39,0,102,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,
+53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,7,51,39,38,39,55,
+22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,
+51,50,22,21,20,6,7,7,51,21,33,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,
+53,52,39,51,22,4,209,148,120,101,139,43,57,148,92,134,174,98,138,87,67,68,
+59,59,75,22,74,41,48,156,125,122,165,4,179,16,116,83,55,104,132,107,115,116,
+94,60,68,57,52,42,61,40,34,50,71,57,105,129,142,112,143,169,126,156,15,219,
+253,226,42,116,75,62,28,82,68,175,60,64,40,104,90,80,82,33,120,36,1,56,151,
+187,102,128,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,
+46,103,128,132,96,29,20,192,17,58,92,82,117,95,96,104,53,50,42,50,20,27,86,
+26,18,112,91,94,121,175,148,119,187,13,187,88,54,83,54,52,50,36,60,68,216,
+118,98,97,76,80,80,106,0,2,0,65,255,230,5,50,6,38,0,47,0,59,0,0,1,16,2,35,
+34,38,39,6,6,35,34,38,53,52,55,35,53,33,23,6,6,21,20,22,51,50,55,51,22,22,
+51,50,17,16,1,21,20,6,35,34,38,53,52,54,51,50,0,18,1,52,38,35,34,6,21,20,
+22,51,50,54,5,50,166,146,115,134,55,57,148,92,124,163,164,229,1,102,30,92,
+88,91,83,175,60,64,34,119,90,236,254,207,131,111,115,139,145,116,163,1,42,
+184,253,252,74,60,60,73,72,59,64,72,2,25,254,248,254,213,109,121,130,100,
+156,122,191,104,104,92,51,102,68,61,76,216,115,101,1,100,2,0,1,15,20,120,
+135,137,113,114,145,254,250,254,39,1,198,66,72,74,64,65,75,73,255,255,0,65,
+254,203,5,50,6,38,0,38,0,218,0,0,0,6,2,159,0,0,0,1,0,75,255,230,4,219,4,171,
+0,96,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,
+6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,7,22,51,50,54,53,52,38,35,34,6,
+21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,
+6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,4,219,162,116,
+99,131,43,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,
+122,165,5,113,156,107,115,116,94,60,68,57,52,42,61,40,34,50,71,57,105,129,
+142,112,143,169,173,155,80,167,63,42,111,75,62,28,82,68,175,60,64,40,102,
+88,80,78,34,129,36,1,10,121,171,101,129,130,100,147,111,88,134,99,61,88,47,
+50,70,71,57,48,36,36,33,92,46,103,128,132,96,35,21,96,117,95,96,104,53,50,
+42,50,20,27,86,26,18,112,91,94,121,175,148,153,168,54,46,50,80,54,52,50,36,
+60,68,216,118,98,73,62,70,62,87,0,4,0,80,254,203,9,110,5,118,0,63,0,77,0,
+89,0,93,0,0,1,20,6,35,34,39,6,6,35,34,3,6,6,35,34,0,53,52,54,55,38,38,53,
+52,54,51,50,22,21,20,7,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,4,18,
+21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,1,54,51,50,23,54,53,52,38,35,34,
+6,21,20,1,52,38,35,34,6,21,20,22,51,50,54,1,19,35,19,9,110,181,158,205,145,
+36,158,117,219,150,57,238,165,231,254,238,130,119,54,59,185,156,194,228,29,
+69,72,8,72,151,100,105,127,222,235,6,168,1,2,140,1,70,148,97,105,127,222,
+235,6,168,1,2,140,248,96,58,65,166,121,8,180,149,100,106,2,101,201,172,171,
+201,198,174,176,197,3,57,70,246,68,1,164,206,240,247,116,131,1,26,133,149,
+1,31,237,153,246,65,26,94,62,116,138,202,172,82,64,71,195,114,53,56,95,93,
+154,127,172,202,9,168,8,169,254,237,161,42,90,87,154,127,172,202,9,168,8,
+169,254,237,1,174,12,80,29,27,109,130,63,59,89,254,46,171,199,200,170,165,
+189,187,254,129,254,192,1,64,0,2,0,60,255,231,6,219,6,39,0,95,0,106,0,0,1,
+51,21,33,20,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,54,
+53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,
+54,51,50,22,23,51,39,38,39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,
+54,55,23,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,1,38,35,34,6,21,20,22,51,
+50,54,5,193,213,254,15,48,107,23,91,21,54,77,240,126,145,201,219,186,210,
+137,32,117,95,79,105,24,75,24,114,92,90,91,58,77,111,162,125,100,166,33,27,
+136,98,109,146,20,188,15,128,87,55,104,132,107,115,116,94,60,68,57,52,42,
+61,40,34,50,71,57,105,129,142,112,143,169,119,148,254,45,116,188,129,133,
+121,102,104,181,2,234,88,130,129,107,164,81,71,19,72,67,99,74,152,180,170,
+124,127,149,85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,123,164,133,
+104,105,132,151,126,190,16,61,92,82,117,95,96,104,53,50,42,50,20,27,86,26,
+18,112,91,94,121,175,148,115,184,18,253,215,75,70,58,57,71,98,0,2,0,80,255,
+230,5,95,6,39,0,83,0,95,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,
+55,39,51,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,51,
+50,54,53,52,38,39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,
+6,6,35,34,38,53,52,54,51,50,22,21,20,7,22,22,37,20,22,51,50,54,53,52,38,35,
+34,6,5,73,96,163,96,88,163,48,52,133,84,97,160,93,172,142,17,235,16,85,91,
+136,115,111,135,10,112,133,116,184,61,64,33,141,93,122,138,167,158,5,52,40,
+118,125,116,94,60,68,57,52,42,61,40,34,50,71,57,105,129,142,112,143,169,183,
+80,81,252,53,75,57,62,73,73,60,60,74,1,203,137,222,126,113,117,122,108,120,
+226,153,192,1,36,48,210,203,23,128,88,117,138,128,106,38,33,126,197,141,158,
+216,112,104,158,141,179,170,16,168,9,113,98,96,104,53,50,42,50,20,27,86,26,
+18,112,91,94,121,175,148,219,112,75,238,138,67,73,75,65,64,74,72,0,4,0,80,
+255,230,4,67,5,118,0,22,0,36,0,48,0,60,0,0,1,20,0,35,34,0,53,52,54,55,38,
+38,53,52,54,51,50,22,21,20,7,22,22,1,54,51,50,23,54,53,52,38,35,34,6,21,20,
+1,52,38,35,34,6,21,20,22,51,50,54,39,20,6,35,34,38,53,52,54,51,50,22,4,67,
+254,236,230,231,254,238,126,116,59,63,185,156,194,228,24,73,79,253,133,62,
+67,155,118,6,180,149,100,106,2,117,201,172,171,201,198,174,176,197,249,68,
+55,55,67,68,54,54,69,1,242,238,254,226,1,31,237,150,243,67,26,96,64,116,138,
+202,172,75,60,71,202,1,137,14,71,23,24,109,130,63,59,93,254,50,171,199,200,
+170,165,189,187,175,52,68,68,52,52,69,69,0,2,0,80,255,230,5,112,6,39,0,74,
+0,86,0,0,1,20,6,35,32,39,6,6,35,34,38,53,52,18,55,38,39,55,22,51,50,54,53,
+52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,51,50,22,21,20,
+7,22,23,7,38,35,34,6,6,21,20,22,51,50,55,51,22,22,23,38,53,52,54,51,50,22,
+7,52,38,35,34,6,21,20,22,51,50,54,5,112,204,143,254,254,106,57,148,92,138,
+166,223,193,43,31,55,104,132,107,115,116,94,60,68,57,52,42,61,40,34,50,71,
+57,105,129,142,112,143,169,96,114,101,62,161,172,145,253,152,107,96,175,60,
+64,32,132,113,96,130,105,118,145,122,74,64,64,76,73,67,65,73,1,67,143,206,
+230,130,100,203,169,215,1,78,77,19,22,92,82,117,95,96,104,53,50,42,50,20,
+27,86,26,18,112,91,94,121,175,148,162,85,26,68,82,102,132,240,155,101,102,
+216,109,101,5,53,125,96,119,149,86,62,76,73,57,59,78,74,255,255,0,80,254,
+203,5,112,6,39,2,38,0,225,0,0,0,6,2,159,220,0,0,2,0,75,255,230,6,64,6,39,
+0,102,0,114,0,0,1,20,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,53,52,38,35,
+34,6,7,35,38,38,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,50,55,23,6,
+35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,23,54,55,38,39,55,22,51,50,54,
+53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,51,50,22,21,
+20,6,7,22,22,1,52,38,35,34,6,21,20,22,51,50,54,6,64,117,182,94,141,186,147,
+119,104,133,34,141,180,147,107,164,22,78,25,149,125,114,120,134,123,62,80,
+122,145,131,123,124,132,44,139,132,196,243,111,93,84,94,204,156,130,194,53,
+47,98,55,38,55,104,132,107,115,116,94,60,68,57,52,42,61,40,34,50,71,57,105,
+129,142,112,143,169,63,75,108,125,254,192,74,64,64,76,73,67,65,73,1,250,168,
+241,123,174,134,125,158,128,101,69,58,99,223,150,189,127,98,104,121,75,68,
+68,76,98,77,65,63,79,33,216,44,178,143,87,122,30,35,117,72,116,149,128,114,
+120,64,21,27,92,82,117,95,96,104,53,50,42,50,20,27,86,26,18,112,91,94,121,
+175,148,83,150,44,61,250,254,178,62,76,73,57,59,78,74,0,4,0,80,255,230,5,
+250,6,64,0,62,0,74,0,86,0,98,0,0,1,16,0,33,32,0,17,52,18,51,50,22,21,20,6,
+35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,39,6,6,35,34,38,53,52,54,51,
+50,23,38,36,39,22,21,20,6,35,34,38,53,52,54,51,50,4,18,23,22,22,1,52,38,35,
+34,6,21,20,22,51,50,54,1,39,38,35,34,6,21,20,22,51,50,54,37,20,22,51,50,54,
+53,52,38,35,34,6,5,250,254,128,254,171,254,171,254,128,234,174,122,144,136,
+115,106,130,13,42,50,1,41,1,64,1,64,1,41,69,9,126,111,115,136,145,121,60,
+59,52,254,222,178,35,135,111,115,139,188,158,196,1,64,203,26,85,98,252,140,
+74,60,60,73,72,59,64,72,2,108,1,59,65,69,93,73,62,73,79,252,122,75,57,62,
+73,73,60,60,74,2,45,254,236,254,205,1,51,1,20,199,1,11,135,115,117,138,119,
+98,40,41,41,123,73,173,199,199,173,125,82,121,147,138,117,115,135,19,189,
+249,7,56,74,105,125,135,111,121,144,169,254,216,184,62,205,2,121,66,72,74,
+64,65,75,73,254,86,34,31,75,68,65,75,121,19,67,73,75,65,64,74,72,0,5,0,80,
+254,203,5,1,5,118,0,28,0,42,0,59,0,71,0,75,0,0,1,20,6,35,34,38,39,6,6,35,
+34,38,53,52,18,55,38,38,53,52,54,51,50,22,21,20,7,22,22,1,54,51,50,23,54,
+53,52,38,35,34,6,21,20,1,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,54,1,
+20,6,35,34,38,53,52,54,51,50,22,3,19,35,19,5,1,172,142,91,152,43,44,153,90,
+143,171,173,155,57,61,190,161,208,244,26,100,114,253,36,65,66,167,139,8,193,
+166,107,109,2,219,254,249,207,207,254,250,113,94,171,60,63,60,171,94,113,
+254,171,68,55,55,67,68,54,54,69,74,70,246,68,1,135,190,227,119,111,111,119,
+227,190,189,1,44,79,26,96,63,117,137,203,171,76,65,86,253,1,209,14,82,30,
+28,111,128,63,59,93,253,209,205,1,6,254,250,205,127,136,216,216,136,1,80,
+52,68,68,52,52,69,69,253,54,254,192,1,64,0,3,0,80,255,230,5,2,5,118,0,27,
+0,42,0,60,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,53,52,54,51,
+50,22,21,20,7,22,22,1,54,51,50,23,54,53,52,38,35,34,6,21,20,22,1,52,2,35,
+34,2,21,20,22,51,50,55,51,22,22,51,50,54,5,2,159,138,115,134,55,57,148,92,
+144,160,169,151,110,190,161,208,244,21,101,109,253,28,64,75,174,133,6,193,
+166,107,109,61,2,159,247,223,223,247,110,93,175,60,64,34,119,90,90,105,1,
+149,201,230,109,121,130,100,228,203,196,1,35,71,56,125,117,137,203,171,66,
+62,81,251,1,190,13,72,24,24,111,128,63,59,43,56,253,197,229,1,0,255,0,231,
+129,114,216,115,101,117,0,4,0,80,254,203,5,1,5,118,0,28,0,42,0,59,0,63,0,
+0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,38,53,52,54,51,50,22,21,
+20,7,22,22,1,54,51,50,23,54,53,52,38,35,34,6,21,20,1,52,0,35,34,0,21,20,22,
+51,50,55,51,22,51,50,54,1,19,35,19,5,1,172,142,91,152,43,44,153,90,143,171,
+173,155,57,61,190,161,208,244,26,100,114,253,36,65,66,167,139,8,193,166,107,
+109,2,219,254,249,207,207,254,250,113,94,171,60,63,60,171,94,113,254,97,70,
+246,68,1,135,190,227,119,111,111,119,227,190,189,1,44,79,26,96,63,117,137,
+203,171,76,65,86,253,1,209,14,82,30,28,111,128,63,59,93,253,209,205,1,6,254,
+250,205,127,136,216,216,136,254,186,254,192,1,64,0,2,0,70,255,230,5,18,6,
+38,0,46,0,58,0,0,1,16,2,35,34,38,39,38,38,35,34,21,20,22,23,7,38,38,53,52,
+54,51,50,22,23,30,2,51,50,54,53,16,1,21,20,6,35,34,38,53,52,54,51,50,0,18,
+1,52,38,35,34,6,21,20,22,51,50,54,5,18,166,146,139,188,85,70,97,57,126,48,
+37,195,21,23,159,129,93,137,87,56,82,101,67,106,106,254,207,131,111,115,139,
+145,116,163,1,42,184,253,252,74,60,60,73,72,59,64,72,2,25,254,248,254,213,
+151,161,132,100,185,83,179,72,10,65,158,58,150,186,82,116,74,84,49,199,157,
+2,0,1,15,20,120,135,137,113,114,145,254,250,254,39,1,198,66,72,74,64,65,75,
+73,0,3,0,75,255,230,5,47,6,39,0,36,0,68,0,80,0,0,1,20,22,51,50,54,55,23,6,
+6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,
+35,34,6,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,
+54,53,52,38,39,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,1,49,57,52,42,
+61,40,34,50,71,57,105,129,142,112,143,169,173,155,66,156,65,55,104,132,107,
+115,116,94,60,68,3,254,181,158,108,167,54,26,155,104,136,163,165,132,98,141,
+33,75,161,100,105,127,222,235,6,168,1,2,140,252,253,97,83,81,97,92,84,86,
+96,5,52,42,50,20,27,86,26,18,112,91,94,121,175,148,153,168,37,45,92,82,117,
+95,96,104,53,252,62,206,240,126,88,104,110,169,141,136,175,97,80,116,101,
+154,127,172,202,9,168,8,169,254,237,252,81,97,96,83,77,93,88,255,255,0,75,
+254,203,5,47,6,39,2,38,0,233,0,0,0,6,2,159,212,0,0,2,0,75,255,230,5,126,6,
+38,0,73,0,85,0,0,1,20,2,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,
+38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,
+50,55,51,22,22,51,50,54,54,53,52,2,39,21,20,6,35,34,38,53,52,54,51,50,0,18,
+1,52,38,35,34,6,21,20,22,51,50,54,5,126,108,178,104,108,165,51,57,148,92,
+134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,79,124,75,62,
+28,82,68,175,60,64,34,128,101,85,140,81,165,140,131,111,115,139,145,116,158,
+1,47,192,253,244,74,60,60,73,72,59,64,72,2,62,192,254,241,137,103,127,130,
+100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,134,
+97,72,108,91,54,52,50,36,60,68,216,115,101,112,211,143,199,1,90,116,10,118,
+135,137,113,114,145,254,250,254,53,1,184,66,72,74,64,65,75,73,255,255,0,75,
+254,203,5,126,6,38,2,38,0,235,0,0,0,6,2,159,219,0,0,3,0,75,255,230,8,7,6,
+38,0,61,0,73,0,85,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,54,53,52,2,39,21,20,6,35,34,38,53,52,54,
+51,50,0,18,17,20,7,22,51,50,54,53,52,38,39,55,22,0,1,52,38,35,34,6,21,20,
+22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,8,7,165,164,115,195,73,50,185,
+109,114,172,54,26,155,104,136,163,165,132,98,141,33,75,154,98,85,140,81,165,
+140,131,111,115,139,145,116,157,1,48,192,12,140,200,118,126,236,233,6,255,
+1,45,251,91,74,60,60,73,72,59,64,72,254,202,97,83,81,97,92,84,86,96,1,184,
+214,252,153,140,142,151,126,88,104,110,169,141,136,175,97,80,117,100,112,
+211,143,199,1,90,116,10,118,135,137,113,114,145,254,246,254,52,254,238,89,
+75,209,130,117,191,216,10,168,7,254,193,2,74,66,72,74,64,65,75,73,252,127,
+81,97,96,83,77,93,88,0,2,0,80,255,230,9,52,4,9,0,52,0,64,0,0,1,20,6,35,34,
+39,6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,
+53,52,38,39,55,22,0,17,7,22,22,51,50,54,53,52,38,39,55,22,0,5,52,38,35,34,
+6,21,20,22,51,50,54,9,52,165,164,199,144,36,149,113,208,146,61,230,156,231,
+254,238,120,229,156,155,229,122,14,66,143,92,118,126,236,233,6,255,1,45,3,
+68,146,93,118,126,236,233,6,255,1,45,250,138,201,172,171,201,198,174,176,
+197,1,184,214,252,236,112,124,254,120,134,1,31,237,147,239,139,138,239,148,
+71,67,80,79,130,117,191,216,10,168,7,254,193,254,245,73,84,82,130,117,191,
+216,10,168,7,254,193,146,171,199,200,170,165,189,187,0,3,0,80,255,230,4,67,
+5,118,0,22,0,36,0,48,0,0,1,20,0,35,34,0,53,52,54,55,38,38,53,52,54,51,50,
+22,21,20,6,7,22,1,54,51,50,23,54,53,52,38,35,34,6,21,20,1,52,38,35,34,6,21,
+20,22,51,50,54,4,67,254,236,230,231,254,238,126,116,59,63,190,161,208,244,
+20,17,125,253,133,62,67,180,127,12,193,166,107,109,2,117,201,172,171,201,
+198,174,176,197,1,242,238,254,226,1,31,237,150,243,67,26,96,64,117,137,203,
+171,40,92,31,145,1,37,14,94,38,32,111,128,63,59,93,254,50,171,199,200,170,
+165,189,187,0,3,0,80,255,230,5,94,6,38,0,44,0,56,0,68,0,0,1,20,2,4,35,32,
+0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,33,32,0,17,52,2,39,
+6,6,35,34,38,53,52,54,51,50,22,18,1,52,38,35,34,6,21,20,22,51,50,54,1,20,
+22,51,50,54,53,52,38,35,34,6,5,94,164,254,212,199,254,211,254,182,226,182,
+122,144,136,115,113,133,6,90,1,16,1,10,1,3,1,35,109,94,1,131,110,115,139,
+145,116,154,252,145,254,90,74,60,60,73,72,59,64,72,253,180,75,57,62,73,73,
+60,60,74,2,218,232,254,170,182,1,45,1,16,212,1,8,135,115,117,138,133,115,
+25,22,95,150,177,184,1,59,1,25,158,1,2,93,114,133,137,113,114,145,221,254,
+126,1,70,66,72,74,64,65,75,73,254,32,67,73,75,65,64,74,72,0,3,0,75,255,230,
+5,110,6,38,0,42,0,54,0,66,0,0,1,20,2,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,23,22,22,51,50,54,54,53,52,2,39,21,20,6,35,34,38,53,52,54,51,50,
+0,18,1,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,
+5,110,108,179,104,114,172,54,26,155,104,136,163,165,132,98,141,33,75,154,
+98,85,140,81,165,140,131,111,115,139,145,116,157,1,48,192,253,244,74,60,60,
+73,72,59,64,72,254,202,97,83,81,97,92,84,86,96,2,62,192,254,241,137,126,88,
+104,110,169,141,136,175,97,80,117,100,112,211,143,199,1,90,116,10,118,135,
+137,113,114,145,254,246,254,52,1,189,66,72,74,64,65,75,73,252,127,81,97,96,
+83,77,93,88,0,3,0,40,255,230,4,222,6,38,0,50,0,62,0,74,0,0,1,16,5,7,22,21,
+20,6,35,34,38,53,52,55,55,38,38,35,34,21,20,23,7,38,38,53,52,54,51,50,4,23,
+55,54,54,53,52,38,39,21,20,6,35,34,38,53,52,54,51,50,18,5,52,38,35,34,6,21,
+20,22,51,50,54,3,7,6,6,21,20,22,51,50,54,53,52,4,222,254,243,136,98,173,149,
+142,190,212,211,63,191,111,157,22,74,45,49,134,107,137,1,18,101,110,131,113,
+47,43,131,111,115,139,145,116,183,241,254,217,74,60,60,73,72,59,64,72,197,
+143,78,68,84,68,80,98,4,62,254,231,135,68,177,153,136,162,167,122,162,107,
+106,90,108,124,35,49,36,47,101,65,97,121,192,150,55,66,172,122,71,124,44,
+15,120,135,137,113,114,145,254,234,3,66,72,74,64,65,75,73,253,100,71,39,76,
+43,56,72,85,88,93,0,3,0,75,255,230,6,91,6,39,0,36,0,83,0,95,0,0,1,20,22,51,
+50,54,55,23,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,39,55,22,51,50,
+54,53,52,38,35,34,6,1,6,6,35,34,38,39,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,21,7,6,21,20,22,51,50,
+55,37,52,38,35,34,6,21,20,22,51,50,54,1,50,57,52,42,61,40,34,50,71,57,105,
+129,142,112,143,169,173,155,66,156,65,55,104,132,107,115,116,94,60,68,5,41,
+33,92,46,71,112,24,91,166,107,161,65,25,155,105,136,163,165,132,103,144,31,
+75,156,103,102,127,100,207,151,6,168,1,2,140,5,5,65,52,60,51,252,35,97,83,
+81,97,92,84,86,96,5,52,42,50,20,27,86,26,18,112,91,94,121,175,148,153,168,
+37,45,92,82,117,95,96,104,53,250,182,26,28,76,62,138,111,106,105,112,169,
+141,136,175,106,86,103,99,153,118,98,180,115,168,8,169,254,237,161,81,40,
+28,54,56,37,131,81,97,96,83,77,93,88,0,2,0,90,255,230,5,38,6,39,0,36,0,74,
+0,0,19,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,
+38,53,52,54,51,50,22,21,20,6,35,34,38,19,34,21,20,22,23,7,38,38,53,52,54,
+51,50,22,23,30,2,51,50,54,53,52,38,39,55,22,0,17,20,6,35,34,38,39,38,38,138,
+55,104,132,107,115,116,94,60,68,57,52,42,61,40,34,50,71,57,105,129,142,112,
+143,169,173,155,66,156,167,126,48,37,195,21,23,159,129,93,137,87,57,80,101,
+68,113,111,236,233,6,255,1,45,165,164,126,185,84,70,97,3,245,92,82,117,95,
+96,104,53,50,42,50,20,27,86,26,18,112,91,94,121,175,148,153,168,37,254,62,
+185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,128,119,191,216,10,168,
+7,254,193,254,245,214,252,153,159,132,100,0,4,0,75,255,230,7,130,6,39,0,36,
+0,84,0,96,0,108,0,0,1,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,51,50,22,
+21,20,6,35,34,38,39,55,22,51,50,54,53,52,38,35,34,6,1,20,6,35,34,38,53,52,
+55,33,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,38,39,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,
+52,38,35,34,6,21,20,22,51,50,54,1,65,57,52,42,61,40,34,50,71,57,105,129,142,
+112,143,169,173,155,66,156,65,55,104,132,107,115,116,94,60,68,6,65,137,115,
+113,135,31,254,183,108,111,83,159,109,107,161,65,25,155,105,136,163,165,132,
+103,144,31,75,156,103,108,132,124,121,237,15,2,230,126,132,108,57,123,72,
+63,61,71,76,57,66,68,251,37,97,83,81,97,92,84,86,96,5,52,42,50,20,27,86,26,
+18,112,91,94,121,175,148,153,168,37,45,92,82,117,95,96,104,53,253,149,116,
+137,126,106,64,52,90,247,129,113,191,114,111,106,105,112,169,141,136,175,
+106,86,103,99,145,117,115,210,70,165,21,67,108,89,64,74,72,66,67,73,73,254,
+170,81,97,96,83,77,93,88,0,2,0,80,255,230,5,144,6,39,0,100,0,112,0,0,1,20,
+6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,22,21,20,6,35,34,38,53,52,
+55,6,6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,52,38,35,34,6,21,20,22,23,
+7,33,53,33,38,38,53,52,55,38,39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,
+51,50,54,55,23,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,22,37,20,22,51,
+50,54,53,52,38,35,34,6,5,144,99,167,100,103,161,42,42,161,103,100,167,99,
+232,176,122,144,136,115,113,133,5,41,48,78,125,70,214,60,64,60,214,70,125,
+78,108,93,39,52,58,64,30,254,120,1,17,61,55,45,78,56,55,104,132,107,115,116,
+94,60,68,57,52,42,61,40,34,50,71,57,105,129,142,112,143,169,70,84,73,83,251,
+220,78,59,57,73,76,62,55,74,2,2,166,245,129,125,105,105,125,129,245,166,219,
+1,34,135,115,117,138,133,115,20,25,48,147,81,107,151,76,216,216,76,151,107,
+154,181,51,45,51,73,28,92,104,47,89,58,69,55,21,40,92,82,117,95,96,104,53,
+50,42,50,20,27,86,26,18,112,91,94,121,175,148,87,156,42,58,229,66,67,73,76,
+64,64,74,73,0,4,0,70,255,231,4,169,6,38,0,56,0,68,0,80,0,92,0,0,1,22,21,20,
+6,35,34,38,53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,
+6,21,20,22,23,22,23,54,18,53,52,38,39,21,20,6,35,34,38,53,52,54,51,50,22,
+18,21,16,1,52,38,35,34,6,21,20,22,51,50,54,1,20,22,51,50,54,53,52,38,35,34,
+6,1,52,38,35,34,6,21,20,22,51,50,54,3,38,36,130,107,112,126,41,153,185,93,
+166,104,108,128,121,102,101,118,6,80,126,166,141,88,217,200,75,68,130,112,
+115,139,145,116,138,219,123,254,161,74,60,60,73,72,59,64,72,253,253,64,49,
+53,62,62,51,51,64,1,162,71,65,68,69,70,66,67,70,1,72,57,82,96,118,109,95,
+65,47,13,191,143,100,178,107,120,102,104,123,119,102,21,21,80,86,73,109,13,
+11,36,48,1,42,224,107,177,55,20,116,137,137,113,114,145,170,254,226,166,254,
+56,3,29,66,72,74,64,65,75,73,254,63,58,62,64,56,54,63,60,253,153,49,51,54,
+47,46,53,52,0,2,0,35,254,79,3,217,6,39,0,72,0,104,0,0,1,52,38,39,39,38,38,
+53,52,54,55,38,39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,
+6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,22,23,7,38,38,35,34,6,21,20,22,23,
+23,22,22,21,20,6,35,32,3,55,22,51,50,54,19,21,34,38,39,6,6,35,34,39,6,35,
+34,38,53,52,55,51,22,22,51,50,55,51,22,51,50,54,55,51,22,22,3,25,92,109,129,
+192,178,78,76,28,32,55,104,132,107,115,116,94,60,68,57,52,42,61,40,34,50,
+71,57,105,129,142,112,143,169,51,60,123,129,96,94,175,113,126,116,117,139,
+123,186,148,227,183,254,191,170,100,156,233,127,142,192,53,91,29,13,101,70,
+129,65,65,129,82,106,6,54,12,73,64,110,33,60,33,110,64,73,12,54,23,75,1,89,
+65,73,9,11,16,122,127,61,114,36,12,22,92,82,117,95,96,104,53,50,42,50,20,
+27,86,26,18,112,91,94,121,175,148,75,139,45,37,97,111,92,91,94,71,78,70,11,
+10,16,157,120,147,183,1,19,82,133,74,254,33,166,63,60,93,90,150,150,121,125,
+39,47,85,73,116,116,73,85,61,45,0,1,0,17,255,230,3,157,6,244,0,87,0,0,1,20,
+6,35,32,3,55,22,51,50,54,53,52,38,39,39,38,38,53,52,54,55,38,39,55,22,51,
+50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,
+52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,7,22,23,7,38,38,35,
+34,6,21,20,22,23,23,22,22,3,150,227,183,254,191,170,100,156,233,127,142,92,
+109,129,192,178,78,76,28,32,55,104,132,107,115,116,94,60,68,59,50,42,59,37,
+35,43,74,57,106,128,62,56,116,109,205,110,87,83,110,72,76,18,51,66,145,168,
+106,124,123,96,94,175,113,126,116,117,139,123,186,148,1,48,147,183,1,19,82,
+133,74,73,65,73,9,11,16,122,127,61,114,36,12,22,92,82,104,85,85,92,48,45,
+36,46,18,22,85,21,17,103,86,81,53,54,83,84,105,181,38,93,56,43,36,23,18,156,
+134,154,79,38,94,111,92,91,94,71,78,70,11,10,16,157,0,5,0,40,254,203,5,209,
+7,47,0,77,0,89,0,101,0,111,0,115,0,0,1,20,2,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,
+7,22,22,51,50,54,53,52,2,39,23,20,6,35,34,38,53,52,55,38,53,52,54,51,50,23,
+7,38,35,34,6,21,20,23,54,51,50,0,18,1,52,38,35,34,6,21,20,22,51,50,54,1,52,
+38,35,34,6,21,20,22,51,50,54,3,50,55,38,38,35,34,6,21,20,5,19,35,19,5,209,
+119,184,100,94,161,129,64,184,108,142,164,140,136,84,155,102,73,90,6,133,
+113,115,136,145,121,181,227,57,72,121,85,156,177,160,137,1,133,110,115,139,
+82,58,116,109,205,110,87,83,110,72,76,18,51,56,164,1,42,182,253,253,74,60,
+60,73,72,59,64,72,254,77,74,55,62,76,73,57,59,78,190,137,96,72,124,81,64,
+74,2,87,70,246,68,2,86,215,254,232,128,70,107,86,91,127,109,111,124,61,60,
+101,143,150,95,22,25,115,133,138,117,115,135,254,249,213,153,132,37,25,241,
+211,220,1,95,117,24,117,135,137,113,121,74,55,85,84,105,181,38,93,56,43,36,
+23,19,254,238,254,60,1,189,66,72,74,64,65,75,73,254,33,65,73,74,64,64,76,
+73,254,13,69,55,48,43,40,89,170,254,192,1,64,0,2,0,85,255,245,4,50,6,200,
+0,50,0,65,0,0,1,20,7,39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,52,18,
+55,38,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,55,50,
+22,21,20,7,22,39,54,53,52,38,35,34,6,21,20,22,23,54,51,50,4,50,87,215,70,
+75,177,160,159,178,74,70,217,85,130,116,59,64,95,86,61,120,100,105,140,53,
+87,77,105,66,71,51,58,194,228,34,137,211,9,180,149,100,106,62,63,60,59,163,
+1,190,206,250,10,146,251,148,184,202,199,182,147,254,254,145,11,235,226,176,
+1,6,69,26,97,64,81,120,29,61,96,93,112,101,90,38,93,62,47,67,29,3,202,172,
+90,66,158,226,38,25,109,130,63,59,43,56,7,13,0,4,0,70,254,203,7,182,6,244,
+0,52,0,104,0,116,0,120,0,0,1,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,
+34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,
+20,6,35,34,38,39,55,22,51,50,54,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,
+51,50,54,53,52,38,39,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,23,19,35,
+19,2,151,116,94,60,68,59,50,42,59,37,35,43,74,57,106,128,62,56,116,109,205,
+110,87,83,110,72,76,18,51,66,145,168,172,156,66,156,65,55,104,132,107,115,
+5,31,181,158,201,143,36,157,115,108,167,54,26,155,104,136,163,165,132,98,
+141,33,75,161,100,105,127,222,235,6,168,1,2,140,2,68,146,93,105,127,222,235,
+6,168,1,2,140,250,113,97,83,81,97,92,84,86,96,174,70,246,68,4,188,85,92,48,
+45,36,46,18,22,85,21,17,103,86,81,53,54,83,84,105,181,38,93,56,43,36,23,18,
+156,134,140,153,37,45,92,82,104,253,61,206,240,237,111,126,126,88,104,110,
+169,141,136,175,97,80,116,101,154,127,172,202,9,168,8,169,254,237,161,53,
+84,82,154,127,172,202,9,168,8,169,254,237,252,81,97,96,83,77,93,88,235,254,
+192,1,64,0,1,0,65,255,230,4,209,6,244,0,118,0,0,1,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,
+22,21,20,7,51,39,38,39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,
+55,23,6,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,
+51,50,22,21,20,6,7,7,51,21,33,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,
+53,52,39,51,22,4,209,148,120,101,139,43,57,148,92,134,174,98,138,87,67,68,
+59,59,75,22,74,41,48,156,125,122,165,4,179,16,117,83,55,104,132,107,115,116,
+94,60,68,59,50,42,59,37,35,43,74,57,106,128,62,56,116,109,205,110,87,83,110,
+72,76,18,51,66,145,168,126,155,15,219,253,226,42,116,75,62,28,82,68,175,60,
+64,40,104,90,80,82,33,120,36,1,56,151,187,102,128,130,100,147,111,88,134,
+99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,132,96,29,20,192,17,58,
+92,82,104,85,85,92,48,45,36,46,18,22,85,21,17,103,86,81,53,54,83,84,105,181,
+38,93,56,43,36,23,18,156,134,108,170,13,187,88,54,83,54,52,50,36,60,68,216,
+118,98,97,76,80,80,106,0,2,0,65,255,230,5,50,7,44,0,63,0,75,0,0,1,16,2,35,
+34,38,39,6,6,35,34,38,53,52,55,35,53,33,23,6,6,21,20,22,51,50,55,51,22,22,
+51,50,17,16,1,21,20,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,
+21,20,23,54,51,50,0,18,1,52,38,35,34,6,21,20,22,51,50,54,5,50,166,146,115,
+134,55,57,148,92,124,163,164,229,1,102,30,92,88,91,83,175,60,64,34,119,90,
+236,254,207,131,111,115,139,81,56,116,109,205,110,87,83,110,72,76,16,49,59,
+163,1,42,184,253,252,74,60,60,73,72,59,64,72,2,25,254,248,254,213,109,121,
+130,100,156,122,191,104,104,92,51,102,68,61,76,216,115,101,1,100,2,0,1,15,
+20,120,135,137,113,121,73,54,84,84,105,181,38,93,56,43,33,24,20,254,250,254,
+39,1,198,66,72,74,64,65,75,73,255,255,0,65,254,203,5,50,7,44,0,38,0,254,0,
+0,0,6,2,159,0,0,0,1,0,75,255,230,4,219,5,180,0,112,0,0,1,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,
+51,50,22,21,20,7,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,
+35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,
+21,20,6,35,34,38,39,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,
+51,22,4,219,162,116,99,131,43,57,148,92,134,174,98,138,87,67,68,59,59,75,
+22,74,41,48,156,125,122,165,5,113,156,107,115,116,94,60,68,57,52,42,61,40,
+34,50,71,57,105,129,70,56,116,109,205,110,87,83,110,72,76,17,52,59,143,169,
+173,155,80,167,63,42,111,75,62,28,82,68,175,60,64,40,102,88,80,78,34,129,
+36,1,10,121,171,101,129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,
+36,36,33,92,46,103,128,132,96,35,21,96,117,95,96,104,53,50,42,50,20,27,86,
+26,18,112,91,94,60,53,84,84,105,181,38,93,56,43,34,25,19,175,148,153,168,
+54,46,50,80,54,52,50,36,60,68,216,118,98,73,62,70,62,87,0,4,0,80,254,203,
+9,110,6,200,0,81,0,95,0,107,0,111,0,0,1,20,6,35,34,39,6,6,35,34,3,6,6,35,
+34,0,53,52,54,55,38,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,
+20,23,54,51,50,22,21,20,7,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,
+4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,1,54,51,50,23,54,53,52,38,
+35,34,6,21,20,1,52,38,35,34,6,21,20,22,51,50,54,1,19,35,19,9,110,181,158,
+205,145,36,158,117,219,150,57,238,165,231,254,238,130,119,54,59,91,82,63,
+120,100,105,140,53,87,77,105,66,71,53,28,38,194,228,29,69,72,8,72,151,100,
+105,127,222,235,6,168,1,2,140,1,70,148,97,105,127,222,235,6,168,1,2,140,248,
+96,58,65,166,121,8,180,149,100,106,2,101,201,172,171,201,198,174,176,197,
+3,57,70,246,68,1,164,206,240,247,116,131,1,26,133,149,1,31,237,153,246,65,
+26,94,62,79,118,30,63,97,93,112,101,90,38,93,62,47,68,29,4,202,172,82,64,
+71,195,114,53,56,95,93,154,127,172,202,9,168,8,169,254,237,161,42,90,87,154,
+127,172,202,9,168,8,169,254,237,1,174,12,80,29,27,109,130,63,59,89,254,46,
+171,199,200,170,165,189,187,254,129,254,192,1,64,0,2,0,60,255,231,6,219,7,
+48,0,111,0,122,0,0,1,51,21,33,20,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,
+53,52,54,51,50,23,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,38,53,
+52,54,51,50,22,23,54,54,51,50,22,23,51,39,38,39,55,22,51,50,54,53,52,38,35,
+34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,
+38,35,34,6,21,20,23,54,51,50,22,21,20,6,7,1,38,35,34,6,21,20,22,51,50,54,
+5,193,213,254,15,48,107,23,91,21,54,77,240,126,145,201,219,186,210,137,32,
+117,95,79,105,24,75,24,114,92,90,91,58,77,111,162,125,100,166,33,27,136,98,
+109,146,20,188,15,128,87,55,104,132,107,115,116,94,60,68,57,52,42,61,40,34,
+50,71,57,105,129,65,60,116,109,205,110,87,83,110,72,76,20,51,66,143,169,119,
+148,254,45,116,188,129,133,121,102,104,181,2,234,88,130,129,107,164,81,71,
+19,72,67,99,74,152,180,170,124,127,149,85,73,82,106,115,86,70,71,85,89,66,
+74,68,37,99,135,123,164,133,104,105,132,151,126,190,16,61,92,82,117,95,96,
+104,53,50,42,50,20,27,86,26,18,112,91,90,60,55,86,84,105,181,38,93,56,43,
+38,23,21,175,148,115,184,18,253,215,75,70,58,57,71,98,0,2,0,80,255,230,5,
+95,7,48,0,99,0,111,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,39,
+51,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,51,50,54,
+53,52,38,39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,
+34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,
+20,7,22,22,37,20,22,51,50,54,53,52,38,35,34,6,5,73,96,163,96,88,163,48,52,
+133,84,97,160,93,172,142,17,235,16,85,91,136,115,111,135,10,112,133,116,184,
+61,64,33,141,93,122,138,167,158,5,52,40,118,125,116,94,60,68,57,52,42,61,
+40,34,50,71,57,105,129,66,60,116,109,205,110,87,83,110,72,76,19,53,64,143,
+169,183,80,81,252,53,75,57,62,73,73,60,60,74,1,203,137,222,126,113,117,122,
+108,120,226,153,192,1,36,48,210,203,23,128,88,117,138,128,106,38,33,126,197,
+141,158,216,112,104,158,141,179,170,16,168,9,113,98,96,104,53,50,42,50,20,
+27,86,26,18,112,91,92,58,54,87,84,105,181,38,93,56,43,36,25,21,175,148,219,
+112,75,238,138,67,73,75,65,64,74,72,0,4,0,80,255,230,4,67,6,200,0,39,0,53,
+0,65,0,77,0,0,1,20,0,35,34,0,53,52,54,55,38,38,53,52,54,55,38,53,52,54,51,
+50,22,23,7,38,35,34,6,21,20,23,55,50,22,21,20,7,22,22,1,54,51,50,23,54,53,
+52,38,35,34,6,21,20,1,52,38,35,34,6,21,20,22,51,50,54,39,20,6,35,34,38,53,
+52,54,51,50,22,4,67,254,236,230,231,254,238,126,116,59,63,95,86,61,120,100,
+105,140,53,87,78,104,66,71,51,58,194,228,24,73,79,253,133,62,67,155,118,6,
+180,149,100,106,2,117,201,172,171,201,198,174,176,197,249,68,55,55,67,68,
+54,54,69,1,242,238,254,226,1,31,237,150,243,67,26,96,64,81,120,29,61,96,93,
+112,101,90,38,93,62,47,67,29,3,202,172,75,60,71,202,1,137,14,71,23,24,109,
+130,63,59,93,254,50,171,199,200,170,165,189,187,175,52,68,68,52,52,69,69,
+0,2,0,80,255,230,5,112,7,48,0,90,0,102,0,0,1,20,6,35,32,39,6,6,35,34,38,53,
+52,18,55,38,39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,
+6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,
+21,20,7,22,23,7,38,35,34,6,6,21,20,22,51,50,55,51,22,22,23,38,53,52,54,51,
+50,22,7,52,38,35,34,6,21,20,22,51,50,54,5,112,204,143,254,254,106,57,148,
+92,138,166,223,193,43,31,55,104,132,107,115,116,94,60,68,57,52,42,61,40,34,
+50,71,57,105,129,67,59,116,109,205,110,87,83,110,72,76,19,52,63,143,169,96,
+114,101,62,161,172,145,253,152,107,96,175,60,64,32,132,113,96,130,105,118,
+145,122,74,64,64,76,73,67,65,73,1,67,143,206,230,130,100,203,169,215,1,78,
+77,19,22,92,82,117,95,96,104,53,50,42,50,20,27,86,26,18,112,91,92,59,54,86,
+84,105,181,38,93,56,43,36,24,20,175,148,162,85,26,68,82,102,132,240,155,101,
+102,216,109,101,5,53,125,96,119,149,86,62,76,73,57,59,78,74,255,255,0,80,
+254,203,5,112,7,48,2,38,1,5,0,0,0,6,2,159,220,0,0,2,0,75,255,230,6,64,7,48,
+0,118,0,130,0,0,1,20,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,53,52,38,35,
+34,6,7,35,38,38,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,50,55,23,6,
+35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,23,54,55,38,39,55,22,51,50,54,
+53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,52,54,
+51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,7,22,22,1,52,38,35,34,
+6,21,20,22,51,50,54,6,64,117,182,94,141,186,147,119,104,133,34,141,180,147,
+107,164,22,78,25,149,125,114,120,134,123,62,80,122,145,131,123,124,132,44,
+139,132,196,243,111,93,84,94,204,156,130,194,53,47,98,55,38,55,104,132,107,
+115,116,94,60,68,57,52,42,61,40,34,50,71,57,105,129,66,59,116,109,205,110,
+87,83,110,72,76,19,51,65,143,169,63,75,108,125,254,192,74,64,64,76,73,67,
+65,73,1,250,168,241,123,174,134,125,158,128,101,69,58,99,223,150,189,127,
+98,104,121,75,68,68,76,98,77,65,63,79,33,216,44,178,143,87,122,30,35,117,
+72,116,149,128,114,120,64,21,27,92,82,117,95,96,104,53,50,42,50,20,27,86,
+26,18,112,91,90,61,54,86,84,105,181,38,93,56,43,36,25,21,175,148,83,150,44,
+61,250,254,178,62,76,73,57,59,78,74,0,4,0,80,255,230,5,250,7,85,0,78,0,90,
+0,102,0,114,0,0,1,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,
+6,6,21,20,4,33,32,36,53,52,39,6,6,35,34,38,53,52,54,51,50,23,38,36,39,22,
+21,20,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,
+50,4,18,23,22,22,1,52,38,35,34,6,21,20,22,51,50,54,1,39,38,35,34,6,21,20,
+22,51,50,54,37,20,22,51,50,54,53,52,38,35,34,6,5,250,254,128,254,171,254,
+171,254,128,234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,41,
+69,9,126,111,115,136,145,121,60,59,52,254,222,178,35,135,111,115,139,78,79,
+115,110,205,110,87,83,110,75,73,39,83,113,196,1,64,203,26,85,98,252,140,74,
+60,60,73,72,59,64,72,2,108,1,59,65,69,93,73,62,73,79,252,122,75,57,62,73,
+73,60,60,74,2,45,254,236,254,205,1,51,1,20,199,1,11,135,115,117,138,119,98,
+40,41,41,123,73,173,199,199,173,125,82,121,147,138,117,115,135,19,189,249,
+7,56,74,105,125,135,111,111,68,63,103,88,109,181,38,93,61,47,49,33,39,169,
+254,216,184,62,205,2,121,66,72,74,64,65,75,73,254,86,34,31,75,68,65,75,121,
+19,67,73,75,65,64,74,72,0,5,0,80,254,203,5,1,6,162,0,46,0,60,0,77,0,89,0,
+93,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,38,53,52,54,55,38,53,
+52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,7,22,22,1,54,51,
+50,23,54,53,52,38,35,34,6,21,20,1,52,0,35,34,0,21,20,22,51,50,55,51,22,51,
+50,54,1,20,6,35,34,38,53,52,54,51,50,22,3,19,35,19,5,1,172,142,91,152,43,
+44,153,90,143,171,173,155,57,61,89,82,34,120,100,105,140,53,87,77,105,66,
+71,15,41,46,208,244,26,100,114,253,36,65,66,167,139,8,193,166,107,109,2,219,
+254,249,207,207,254,250,113,94,171,60,63,60,171,94,113,254,171,68,55,55,67,
+68,54,54,69,74,70,246,68,1,135,190,227,119,111,111,119,227,190,189,1,44,79,
+26,96,63,78,117,30,57,67,93,112,101,90,38,93,62,47,37,24,6,203,171,76,65,
+86,253,1,209,14,82,30,28,111,128,63,59,93,253,209,205,1,6,254,250,205,127,
+136,216,216,136,1,80,52,68,68,52,52,69,69,253,54,254,192,1,64,0,3,0,80,255,
+230,5,2,6,162,0,45,0,60,0,78,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,
+55,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,51,50,
+22,21,20,7,22,22,1,54,51,50,23,54,53,52,38,35,34,6,21,20,22,1,52,2,35,34,
+2,21,20,22,51,50,55,51,22,22,51,50,54,5,2,159,138,115,134,55,57,148,92,144,
+160,169,151,110,89,82,34,120,100,105,140,53,87,77,105,66,71,15,41,46,208,
+244,21,101,109,253,28,64,75,174,133,6,193,166,107,109,61,2,159,247,223,223,
+247,110,93,175,60,64,34,119,90,90,105,1,149,201,230,109,121,130,100,228,203,
+196,1,35,71,56,125,78,117,30,57,67,93,112,101,90,38,93,62,47,37,24,6,203,
+171,66,62,81,251,1,190,13,72,24,24,111,128,63,59,43,56,253,197,229,1,0,255,
+0,231,129,114,216,115,101,117,0,4,0,80,254,203,5,1,6,162,0,46,0,60,0,77,0,
+81,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,38,53,52,54,55,38,53,
+52,54,51,50,22,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,7,22,22,1,54,51,
+50,23,54,53,52,38,35,34,6,21,20,1,52,0,35,34,0,21,20,22,51,50,55,51,22,51,
+50,54,1,19,35,19,5,1,172,142,91,152,43,44,153,90,143,171,173,155,57,61,89,
+82,34,120,100,105,140,53,87,77,105,66,71,15,41,46,208,244,26,100,114,253,
+36,65,66,167,139,8,193,166,107,109,2,219,254,249,207,207,254,250,113,94,171,
+60,63,60,171,94,113,254,97,70,246,68,1,135,190,227,119,111,111,119,227,190,
+189,1,44,79,26,96,63,78,117,30,57,67,93,112,101,90,38,93,62,47,37,24,6,203,
+171,76,65,86,253,1,209,14,82,30,28,111,128,63,59,93,253,209,205,1,6,254,250,
+205,127,136,216,216,136,254,186,254,192,1,64,0,2,0,70,255,230,5,18,7,44,0,
+62,0,74,0,0,1,16,2,35,34,38,39,38,38,35,34,21,20,22,23,7,38,38,53,52,54,51,
+50,22,23,30,2,51,50,54,53,16,1,21,20,6,35,34,38,53,52,55,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,23,54,51,50,0,18,1,52,38,35,34,6,21,20,22,51,50,54,
+5,18,166,146,139,188,85,70,97,57,126,48,37,195,21,23,159,129,93,137,87,56,
+82,101,67,106,106,254,207,131,111,115,139,81,56,116,109,205,110,87,83,110,
+72,76,16,49,59,163,1,42,184,253,252,74,60,60,73,72,59,64,72,2,25,254,248,
+254,213,151,161,132,100,185,83,179,72,10,65,158,58,150,186,82,116,74,84,49,
+199,157,2,0,1,15,20,120,135,137,113,121,73,54,84,84,105,181,38,93,56,43,33,
+24,20,254,250,254,39,1,198,66,72,74,64,65,75,73,0,3,0,75,255,230,5,37,6,244,
+0,52,0,83,0,95,0,0,1,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,
+52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,
+38,39,55,22,51,50,54,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,
+22,22,51,50,54,53,52,38,39,55,22,0,1,52,38,35,34,6,21,20,22,51,50,54,2,131,
+116,94,60,68,59,50,42,59,37,35,43,74,57,106,128,62,56,116,109,205,110,87,
+83,110,72,76,18,51,66,145,168,172,156,66,156,65,55,104,132,107,115,2,162,
+165,164,108,167,54,26,155,104,136,163,165,132,98,141,33,75,161,100,118,126,
+236,233,6,255,1,45,253,7,97,83,81,97,92,84,86,96,4,188,85,92,48,45,36,46,
+18,22,85,21,17,103,86,81,53,54,83,84,105,181,38,93,56,43,36,23,18,156,134,
+140,153,37,45,92,82,104,253,81,214,252,126,88,104,110,169,141,136,175,97,
+80,116,101,130,117,191,216,10,168,7,254,193,254,134,81,97,96,83,77,93,88,
+0,4,0,75,254,203,5,47,6,244,0,52,0,84,0,96,0,100,0,0,1,52,38,35,34,6,21,20,
+22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,
+21,20,23,54,51,50,22,21,20,6,35,34,38,39,55,22,51,50,54,1,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,5,
+52,38,35,34,6,21,20,22,51,50,54,23,19,35,19,2,131,116,94,60,68,59,50,42,59,
+37,35,43,74,57,106,128,62,56,116,109,205,110,87,83,110,72,76,18,51,66,145,
+168,172,156,66,156,65,55,104,132,107,115,2,172,181,158,108,167,54,26,155,
+104,136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,140,252,
+253,97,83,81,97,92,84,86,96,174,70,246,68,4,188,85,92,48,45,36,46,18,22,85,
+21,17,103,86,81,53,54,83,84,105,181,38,93,56,43,36,23,18,156,134,140,153,
+37,45,92,82,104,253,61,206,240,126,88,104,110,169,141,136,175,97,80,116,101,
+154,127,172,202,9,168,8,169,254,237,252,81,97,96,83,77,93,88,235,254,192,
+1,64,0,2,0,75,255,230,5,126,7,44,0,89,0,101,0,0,1,20,2,6,35,34,38,39,6,6,
+35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,
+50,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,54,53,52,2,39,21,
+20,6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,
+0,18,1,52,38,35,34,6,21,20,22,51,50,54,5,126,108,178,104,108,165,51,57,148,
+92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,79,124,75,
+62,28,82,68,175,60,64,34,128,101,85,140,81,165,140,131,111,115,139,81,56,
+116,109,205,110,87,83,110,72,76,16,49,59,158,1,47,192,253,244,74,60,60,73,
+72,59,64,72,2,62,192,254,241,137,103,127,130,100,147,111,88,134,99,61,88,
+47,50,70,71,57,48,36,36,33,92,46,103,128,134,97,72,108,91,54,52,50,36,60,
+68,216,115,101,112,211,143,199,1,90,116,10,118,135,137,113,121,73,54,84,84,
+105,181,38,93,56,43,33,24,20,254,250,254,53,1,184,66,72,74,64,65,75,73,255,
+255,0,75,254,203,5,126,7,44,2,38,1,15,0,0,0,6,2,159,219,0,0,3,0,75,255,230,
+8,7,7,44,0,77,0,89,0,101,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,22,22,51,50,54,54,53,52,2,39,21,20,6,35,34,38,53,
+52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,0,18,17,20,7,22,
+51,50,54,53,52,38,39,55,22,0,1,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,
+34,6,21,20,22,51,50,54,8,7,165,164,115,195,73,50,185,109,114,172,54,26,155,
+104,136,163,165,132,98,141,33,75,154,98,85,140,81,165,140,131,111,115,139,
+80,57,116,109,205,110,87,83,110,72,76,17,49,60,157,1,48,192,12,140,200,118,
+126,236,233,6,255,1,45,251,91,74,60,60,73,72,59,64,72,254,202,97,83,81,97,
+92,84,86,96,1,184,214,252,153,140,142,151,126,88,104,110,169,141,136,175,
+97,80,117,100,112,211,143,199,1,90,116,10,118,135,137,113,120,74,52,86,84,
+105,181,38,93,56,43,34,23,20,254,246,254,52,254,238,89,75,209,130,117,191,
+216,10,168,7,254,193,2,74,66,72,74,64,65,75,73,252,127,81,97,96,83,77,93,
+88,0,3,0,80,255,230,11,178,4,9,0,68,0,80,0,92,0,0,1,20,6,35,34,38,53,52,55,
+33,22,21,20,6,35,34,39,6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,
+20,7,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,
+35,55,33,50,30,2,5,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,
+22,51,50,54,11,178,137,115,113,135,32,254,215,127,165,164,195,142,38,154,
+112,208,146,61,230,156,231,254,238,120,229,156,155,229,122,14,66,143,92,105,
+127,222,235,6,168,1,2,140,3,65,142,90,118,126,229,240,14,15,3,8,126,132,108,
+57,248,12,201,172,171,201,198,174,176,197,7,121,72,63,61,71,76,57,66,68,2,
+209,116,137,126,106,65,51,139,237,214,252,226,106,120,254,120,134,1,31,237,
+147,239,139,138,239,148,71,67,80,79,154,127,172,202,9,168,8,169,254,237,161,
+65,78,76,130,117,185,173,10,165,21,67,108,224,171,199,200,170,165,189,187,
+1,46,64,74,72,66,67,73,73,0,3,0,80,255,230,4,67,6,200,0,39,0,53,0,65,0,0,
+1,20,0,35,34,0,53,52,54,55,38,38,53,52,54,55,38,53,52,54,51,50,22,23,7,38,
+35,34,6,21,20,23,55,50,22,21,20,6,7,22,1,54,51,50,23,54,53,52,38,35,34,6,
+21,20,1,52,38,35,34,6,21,20,22,51,50,54,4,67,254,236,230,231,254,238,126,
+116,59,63,107,98,55,120,100,105,140,53,87,78,104,66,71,49,40,208,244,20,17,
+125,253,133,62,67,180,127,12,193,166,107,109,2,117,201,172,171,201,198,174,
+176,197,1,242,238,254,226,1,31,237,150,243,67,26,96,64,85,124,27,61,90,93,
+112,101,90,38,93,62,47,66,28,1,203,171,40,92,31,145,1,37,14,94,38,32,111,
+128,63,59,93,254,50,171,199,200,170,165,189,187,0,3,0,80,255,230,5,94,7,44,
+0,60,0,72,0,84,0,0,1,20,2,4,35,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,
+52,55,6,21,20,4,33,32,0,17,52,2,39,6,6,35,34,38,53,52,55,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,23,54,51,50,22,18,1,52,38,35,34,6,21,20,22,51,50,54,
+1,20,22,51,50,54,53,52,38,35,34,6,5,94,164,254,212,199,254,211,254,182,226,
+182,122,144,136,115,113,133,6,90,1,16,1,10,1,3,1,35,109,94,1,131,110,115,
+139,81,57,116,109,205,110,87,83,110,72,76,16,51,58,154,252,145,254,90,74,
+60,60,73,72,59,64,72,253,180,75,57,62,73,73,60,60,74,2,218,232,254,170,182,
+1,45,1,16,212,1,8,135,115,117,138,133,115,25,22,95,150,177,184,1,59,1,25,
+158,1,2,93,114,133,137,113,121,73,54,84,84,105,181,38,93,56,43,33,24,20,221,
+254,126,1,70,66,72,74,64,65,75,73,254,32,67,73,75,65,64,74,72,0,3,0,75,255,
+230,5,110,7,44,0,58,0,70,0,82,0,0,1,20,2,6,35,34,38,39,6,6,35,34,38,53,52,
+54,51,50,22,23,22,22,51,50,54,54,53,52,2,39,21,20,6,35,34,38,53,52,55,38,
+53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,0,18,1,52,38,35,34,6,21,
+20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,5,110,108,179,104,114,172,
+54,26,155,104,136,163,165,132,98,141,33,75,154,98,85,140,81,165,140,131,111,
+115,139,76,62,116,109,205,110,87,83,110,72,76,19,52,64,157,1,48,192,253,244,
+74,60,60,73,72,59,64,72,254,202,97,83,81,97,92,84,86,96,2,62,192,254,241,
+137,126,88,104,110,169,141,136,175,97,80,117,100,112,211,143,199,1,90,116,
+10,118,135,137,113,115,74,56,87,84,105,181,38,93,56,43,36,24,23,254,246,254,
+52,1,189,66,72,74,64,65,75,73,252,127,81,97,96,83,77,93,88,0,3,0,40,255,230,
+4,222,7,44,0,66,0,78,0,90,0,0,1,16,5,7,22,21,20,6,35,34,38,53,52,55,55,38,
+38,35,34,21,20,23,7,38,38,53,52,54,51,50,4,23,55,54,54,53,52,38,39,21,20,
+6,35,34,38,53,52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,18,
+5,52,38,35,34,6,21,20,22,51,50,54,3,7,6,6,21,20,22,51,50,54,53,52,4,222,254,
+243,136,98,173,149,142,190,212,211,63,191,111,157,22,74,45,49,134,107,137,
+1,18,101,110,131,113,47,43,131,111,115,139,85,52,116,109,205,110,87,83,110,
+72,76,15,46,55,183,241,254,217,74,60,60,73,72,59,64,72,197,143,78,68,84,68,
+80,98,4,62,254,231,135,68,177,153,136,162,167,122,162,107,106,90,108,124,
+35,49,36,47,101,65,97,121,192,150,55,66,172,122,71,124,44,15,120,135,137,
+113,125,73,54,80,84,105,181,38,93,56,43,33,21,17,254,234,3,66,72,74,64,65,
+75,73,253,100,71,39,76,43,56,72,85,88,93,0,3,0,75,255,230,6,91,6,244,0,52,
+0,99,0,111,0,0,1,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,
+55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,
+39,55,22,51,50,54,1,6,6,35,34,38,39,6,35,34,38,39,6,6,35,34,38,53,52,54,51,
+50,22,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,21,20,6,21,20,22,51,50,
+55,37,52,38,35,34,6,21,20,22,51,50,54,2,132,116,94,60,68,59,50,42,59,37,35,
+43,74,57,106,128,62,56,116,109,205,110,87,83,110,72,76,18,51,66,145,168,172,
+156,66,156,65,55,104,132,107,115,3,215,33,92,46,71,112,24,91,166,107,161,
+65,25,155,105,136,163,165,132,103,144,31,75,156,103,102,127,100,207,151,6,
+168,1,2,140,10,65,52,60,51,252,35,97,83,81,97,92,84,86,96,4,188,85,92,48,
+45,36,46,18,22,85,21,17,103,86,81,53,54,83,84,105,181,38,93,56,43,36,23,18,
+156,134,140,153,37,45,92,82,104,251,181,26,28,76,62,138,111,106,105,112,169,
+141,136,175,106,86,103,99,153,118,98,180,115,168,8,169,254,237,161,38,84,
+27,54,56,37,131,81,97,96,83,77,93,88,0,2,0,90,255,230,5,38,6,244,0,52,0,90,
+0,0,1,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,52,
+54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,39,55,22,51,
+50,54,1,20,6,35,34,38,39,38,38,35,34,21,20,22,23,7,38,38,53,52,54,51,50,22,
+23,30,2,51,50,54,53,52,38,39,55,22,0,2,139,116,94,60,68,59,50,42,59,37,35,
+43,74,57,106,128,62,56,116,109,205,110,87,83,110,72,76,18,51,66,145,168,172,
+156,66,156,65,55,104,132,107,115,2,155,165,164,126,185,84,70,97,57,126,48,
+37,195,21,23,159,129,93,137,87,57,80,101,68,113,111,236,233,6,255,1,45,4,
+188,85,92,48,45,36,46,18,22,85,21,17,103,86,81,53,54,83,84,105,181,38,93,
+56,43,36,23,18,156,134,140,153,37,45,92,82,104,253,81,214,252,153,159,132,
+100,185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,128,119,191,216,10,
+168,7,254,193,0,4,0,75,255,230,7,130,6,244,0,52,0,100,0,112,0,124,0,0,1,52,
+38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,35,34,38,39,55,22,51,50,54,1,
+20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,
+54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,52,38,35,34,
+6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,2,147,116,94,60,68,
+59,50,42,59,37,35,43,74,57,106,128,62,56,116,109,205,110,87,83,110,72,76,
+18,51,66,145,168,172,156,66,156,65,55,104,132,107,115,4,239,137,115,113,135,
+31,254,183,108,111,83,159,109,107,161,65,25,155,105,136,163,165,132,103,144,
+31,75,156,103,108,132,124,121,237,15,2,230,126,132,108,57,123,72,63,61,71,
+76,57,66,68,251,37,97,83,81,97,92,84,86,96,4,188,85,92,48,45,36,46,18,22,
+85,21,17,103,86,81,53,54,83,84,105,181,38,93,56,43,36,23,18,156,134,140,153,
+37,45,92,82,104,254,148,116,137,126,106,64,52,90,247,129,113,191,114,111,
+106,105,112,169,141,136,175,106,86,103,99,145,117,115,210,70,165,21,67,108,
+89,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,0,2,0,80,255,230,5,144,
+7,49,0,116,0,128,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,
+22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,
+52,38,35,34,6,21,20,22,23,7,33,53,33,38,38,53,52,55,38,39,55,22,51,50,54,
+53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,55,38,53,52,54,
+51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,7,22,22,37,20,22,51,50,
+54,53,52,38,35,34,6,5,144,99,167,100,103,161,42,42,161,103,100,167,99,232,
+176,122,144,136,115,113,133,5,41,48,78,125,70,214,60,64,60,214,70,125,78,
+108,93,39,52,58,64,30,254,120,1,17,61,55,45,78,56,55,104,132,107,115,116,
+94,60,68,57,52,42,61,40,34,50,71,57,105,129,67,59,116,109,205,110,87,83,110,
+72,76,19,52,63,143,169,70,84,73,83,251,220,78,59,57,73,76,62,55,74,2,2,166,
+245,129,125,105,105,125,129,245,166,219,1,34,135,115,117,138,133,115,20,25,
+48,147,81,107,151,76,216,216,76,151,107,154,181,51,45,51,73,28,92,104,47,
+89,58,69,55,21,40,92,82,117,95,96,104,53,50,42,50,20,27,86,26,18,112,91,91,
+61,54,86,84,105,181,38,93,56,43,37,24,20,175,148,87,156,42,58,229,66,67,73,
+76,64,64,74,73,0,4,0,70,255,231,4,169,7,44,0,72,0,84,0,96,0,108,0,0,1,22,
+21,20,6,35,34,38,53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,
+52,55,6,21,20,22,23,22,23,54,18,53,52,38,39,21,20,6,35,34,38,53,52,55,38,
+53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,18,21,16,1,52,38,35,34,
+6,21,20,22,51,50,54,1,20,22,51,50,54,53,52,38,35,34,6,1,52,38,35,34,6,21,
+20,22,51,50,54,3,38,36,130,107,112,126,41,153,185,93,166,104,108,128,121,
+102,101,118,6,80,126,166,141,88,217,200,75,68,130,112,115,139,76,62,116,109,
+205,110,87,83,110,72,76,19,52,64,138,219,123,254,161,74,60,60,73,72,59,64,
+72,253,253,64,49,53,62,62,51,51,64,1,162,71,65,68,69,70,66,67,70,1,72,57,
+82,96,118,109,95,65,47,13,191,143,100,178,107,120,102,104,123,119,102,21,
+21,80,86,73,109,13,11,36,48,1,42,224,107,177,55,20,116,137,137,113,115,74,
+56,87,84,105,181,38,93,56,43,36,24,23,170,254,226,166,254,56,3,29,66,72,74,
+64,65,75,73,254,63,58,62,64,56,54,63,60,253,153,49,51,54,47,46,53,52,0,2,
+0,35,254,79,3,217,7,48,0,88,0,120,0,0,1,52,38,39,39,38,38,53,52,54,55,38,
+39,55,22,51,50,54,53,52,38,35,34,6,21,20,22,51,50,54,55,23,6,6,35,34,38,53,
+52,55,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,54,51,50,22,21,20,6,7,22,
+23,7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,19,
+21,34,38,39,6,6,35,34,39,6,35,34,38,53,52,55,51,22,22,51,50,55,51,22,51,50,
+54,55,51,22,22,3,25,92,109,129,192,178,78,76,28,32,55,104,132,107,115,116,
+94,60,68,57,52,42,61,40,34,50,71,57,105,129,65,61,116,109,205,110,87,83,110,
+72,76,20,55,63,143,169,51,60,123,129,96,94,175,113,126,116,117,139,123,186,
+148,227,183,254,191,170,100,156,233,127,142,192,53,91,29,13,101,70,129,65,
+65,129,82,106,6,54,12,73,64,110,33,60,33,110,64,73,12,54,23,75,1,89,65,73,
+9,11,16,122,127,61,114,36,12,22,92,82,117,95,96,104,53,50,42,50,20,27,86,
+26,18,112,91,90,59,56,86,84,105,181,38,93,56,43,37,25,22,175,148,75,139,45,
+37,97,111,92,91,94,71,78,70,11,10,16,157,120,147,183,1,19,82,133,74,254,33,
+166,63,60,93,90,150,150,121,125,39,47,85,73,116,116,73,85,61,45,0,1,0,35,
+255,230,6,55,5,226,0,68,0,0,1,20,6,35,34,38,39,6,6,35,32,3,55,22,51,50,54,
+53,52,38,39,39,38,38,53,52,54,55,38,39,55,22,23,51,54,0,55,23,0,7,22,23,7,
+38,38,35,34,6,21,20,22,23,23,4,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,
+6,55,178,157,109,163,66,36,204,152,254,191,170,100,156,233,127,142,92,109,
+129,192,178,132,113,119,66,216,47,59,13,94,1,55,112,99,254,237,201,160,155,
+96,94,175,113,126,116,117,139,123,1,25,44,72,151,98,102,127,100,207,151,6,
+168,1,2,140,1,164,207,239,115,110,102,123,1,19,82,133,74,73,65,73,9,11,16,
+122,127,85,131,25,119,147,12,151,113,70,1,37,120,99,254,255,141,33,117,111,
+92,91,94,71,78,70,11,10,23,189,93,91,153,118,98,180,115,168,8,169,254,237,
+0,4,0,40,254,203,8,46,4,9,0,73,0,85,0,95,0,99,0,0,1,20,6,35,34,38,39,6,6,
+35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,
+38,53,52,54,51,50,18,21,20,7,22,22,51,50,54,53,52,38,35,55,22,22,18,21,7,
+22,22,51,50,54,53,52,38,38,35,55,22,4,18,37,52,38,35,34,6,21,20,22,51,50,
+54,3,50,55,38,38,35,34,6,21,20,5,19,35,19,8,46,178,157,115,170,70,41,172,
+105,94,161,129,64,184,108,142,164,140,136,84,155,102,73,90,6,133,113,115,
+136,145,121,181,227,57,72,121,85,130,147,173,203,5,156,219,111,2,71,149,97,
+102,127,100,207,151,6,168,1,2,140,249,237,74,55,62,76,73,57,59,78,190,137,
+96,72,124,81,64,74,2,87,70,246,68,1,164,207,239,129,125,122,131,70,107,86,
+91,127,109,111,124,61,60,101,143,150,95,22,25,115,133,138,117,115,135,254,
+249,213,153,132,37,25,154,159,160,191,167,15,164,254,252,157,56,90,89,153,
+118,98,180,115,168,8,169,254,237,166,65,73,74,64,64,76,73,254,13,69,55,48,
+43,40,89,170,254,192,1,64,0,1,0,100,255,230,6,208,5,226,0,57,0,0,1,20,6,35,
+34,38,39,6,7,39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,52,18,55,38,39,
+55,22,23,55,54,0,55,23,0,7,22,18,21,7,22,22,51,50,54,53,52,38,38,35,55,22,
+4,18,6,208,178,157,112,166,68,21,40,215,70,75,177,160,159,178,74,70,217,85,
+181,159,130,65,216,46,61,12,94,1,55,112,99,254,237,201,174,195,2,69,149,96,
+102,127,100,207,151,6,168,1,2,140,1,164,207,239,121,117,108,114,10,146,251,
+148,184,202,199,182,147,254,254,145,11,235,226,208,1,34,51,127,149,12,151,
+114,1,70,1,37,120,99,254,255,141,43,254,213,221,69,89,87,153,118,98,180,115,
+168,8,169,254,237,0,4,0,70,254,203,10,74,5,226,0,13,0,87,0,99,0,103,0,0,19,
+55,22,23,54,0,55,23,6,4,7,35,38,38,1,20,6,35,34,38,39,6,6,35,34,39,6,6,35,
+34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,
+22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,
+52,38,38,35,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,23,19,35,19,70,216,
+47,63,92,1,65,113,99,205,254,206,90,70,71,162,9,213,178,157,115,168,69,36,
+158,118,201,143,36,157,115,108,167,54,26,155,104,136,163,165,132,98,141,33,
+75,161,100,105,127,222,235,6,168,1,2,140,2,68,146,93,105,127,222,235,6,168,
+1,2,140,1,71,149,98,102,127,100,207,151,6,168,1,2,140,247,221,97,83,81,97,
+92,84,86,96,174,70,246,68,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,
+253,19,207,239,127,122,117,132,237,111,126,126,88,104,110,169,141,136,175,
+97,80,116,101,154,127,172,202,9,168,8,169,254,237,161,53,84,82,154,127,172,
+202,9,168,8,169,254,237,161,38,92,89,153,118,98,180,115,168,8,169,254,237,
+252,81,97,96,83,77,93,88,235,254,192,1,64,0,1,0,65,255,230,7,92,4,9,0,88,
+0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,
+52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,7,51,39,51,7,51,21,
+33,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,23,22,22,51,
+50,54,53,52,38,38,35,55,22,4,18,7,92,178,157,106,161,65,26,132,94,101,139,
+43,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,
+4,179,19,141,19,219,253,226,42,116,75,62,28,82,68,175,60,64,40,104,90,80,
+82,33,120,26,7,69,147,95,102,127,100,207,151,6,168,1,2,140,1,164,207,239,
+110,105,98,117,102,128,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,
+36,36,33,92,46,103,128,132,96,29,20,235,235,88,54,83,54,52,50,36,60,68,216,
+118,98,97,76,80,80,76,86,86,85,153,118,98,180,115,168,8,169,254,237,0,1,0,
+65,255,230,7,185,5,226,0,72,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,
+34,38,53,52,55,35,53,33,23,6,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,
+36,37,38,38,39,55,22,23,54,0,55,23,0,7,22,0,21,21,22,22,51,50,54,53,52,38,
+38,35,55,22,4,18,7,185,178,157,114,168,69,33,144,96,115,134,55,57,148,92,
+124,163,164,229,1,102,30,92,88,91,83,175,60,64,34,119,90,88,107,254,254,254,
+253,71,162,47,216,47,63,92,1,65,113,99,254,205,197,225,1,0,71,150,98,102,
+127,100,207,151,6,168,1,2,140,1,164,207,239,126,121,116,131,109,121,130,100,
+156,122,191,104,104,92,51,102,68,61,76,216,115,101,122,123,220,240,25,43,
+195,106,12,152,119,67,1,45,122,99,254,226,130,43,254,199,230,22,92,90,153,
+118,98,180,115,168,8,169,254,237,255,255,0,65,254,203,7,185,5,226,2,38,1,
+34,0,0,0,6,2,159,0,0,0,1,0,52,255,230,6,62,4,0,0,106,0,0,1,20,6,35,34,38,
+39,6,6,35,34,38,39,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,
+51,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,
+21,20,23,7,38,38,53,52,54,51,50,22,21,20,7,22,51,50,54,53,52,38,35,34,7,39,
+54,51,50,22,21,20,7,22,51,50,54,53,52,38,35,34,7,39,54,51,50,22,6,62,148,
+118,84,129,65,36,113,65,84,129,63,42,105,75,62,28,82,68,175,60,64,40,102,
+88,80,78,34,129,36,162,116,99,131,43,57,148,92,134,174,98,138,87,67,68,59,
+59,75,22,74,41,48,156,125,122,165,8,97,102,70,67,54,40,39,45,45,72,78,106,
+125,8,99,106,70,67,54,40,39,45,45,72,78,106,125,3,29,108,137,44,49,45,48,
+44,48,47,76,54,52,50,36,60,68,216,118,98,73,62,70,62,87,115,121,171,101,129,
+130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,
+132,96,40,27,68,63,49,44,54,15,137,32,123,104,33,32,72,63,49,44,54,15,137,
+32,123,0,3,0,80,254,203,12,3,5,226,0,86,0,98,0,102,0,0,1,20,6,35,34,38,39,
+6,6,35,34,39,6,6,35,34,3,6,6,35,34,0,53,52,18,55,38,39,55,22,23,55,54,0,55,
+23,0,7,22,18,21,20,7,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,
+50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,38,35,55,22,4,18,
+5,52,38,35,34,6,21,20,22,51,50,54,1,19,35,19,12,3,178,157,115,169,69,35,158,
+119,205,145,36,158,117,219,150,57,238,165,231,254,238,184,156,129,65,216,
+46,61,12,95,1,57,109,99,254,238,199,178,209,8,72,151,100,105,127,222,235,
+6,168,1,2,140,1,70,148,97,105,127,222,235,6,168,1,2,140,1,71,150,98,102,127,
+100,207,151,6,168,1,2,140,247,187,201,172,171,201,198,174,176,197,3,57,70,
+246,68,1,164,207,239,127,123,117,133,247,116,131,1,26,133,149,1,31,237,185,
+1,14,47,126,149,12,151,114,1,71,1,38,118,99,255,0,140,37,254,235,199,53,56,
+95,93,154,127,172,202,9,168,8,169,254,237,161,42,90,87,154,127,172,202,9,
+168,8,169,254,237,161,37,92,90,153,118,98,180,115,168,8,169,254,237,20,171,
+199,200,170,165,189,187,254,129,254,192,1,64,0,2,0,60,255,230,9,186,4,9,0,
+89,0,100,0,0,1,20,6,35,34,38,38,39,46,2,35,35,20,7,22,21,20,7,39,54,53,52,
+39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,7,35,38,38,35,34,6,
+21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,23,51,39,51,7,30,2,23,30,
+2,51,50,54,53,52,38,38,35,55,22,4,18,5,38,35,34,6,21,20,22,51,50,54,9,186,
+178,157,103,152,101,64,53,76,103,66,248,48,107,23,91,21,54,77,240,126,145,
+201,219,186,210,137,32,117,95,79,105,24,75,24,114,92,90,91,58,77,111,162,
+125,100,166,33,27,136,98,109,146,20,188,19,141,19,74,113,82,55,59,86,123,
+82,102,127,100,207,151,6,168,1,2,140,250,67,116,188,129,133,121,102,104,181,
+1,164,207,239,106,151,124,103,120,80,130,129,107,164,81,71,19,72,67,99,74,
+152,180,170,124,127,149,85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,
+123,164,133,104,105,132,151,126,235,236,6,76,103,86,91,108,74,153,118,98,
+180,115,168,8,169,254,237,199,75,70,58,57,71,98,0,2,0,80,255,230,7,221,4,
+191,0,73,0,85,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,38,53,52,
+18,55,39,51,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,
+51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,38,35,55,22,
+4,18,37,20,22,51,50,54,53,52,38,35,34,6,7,221,178,157,118,173,71,44,171,103,
+88,163,48,52,133,84,97,160,93,172,142,17,235,16,85,91,136,115,111,135,10,
+112,133,116,184,61,64,33,141,93,122,138,167,158,5,196,219,4,71,152,98,102,
+127,100,207,151,6,168,1,2,140,249,161,75,57,62,73,73,60,60,74,1,164,207,239,
+135,131,122,144,113,117,122,108,120,226,153,192,1,36,48,210,203,23,128,88,
+117,138,128,106,38,33,126,197,141,158,216,112,104,158,141,179,170,16,168,
+20,254,210,252,42,32,93,91,153,118,98,180,115,168,8,169,254,237,165,67,73,
+75,65,64,74,72,0,3,0,80,255,230,6,210,5,226,0,46,0,58,0,70,0,0,1,20,6,35,
+34,38,39,6,6,35,34,0,53,52,18,55,38,39,55,22,23,55,54,0,55,23,0,7,22,18,21,
+20,7,22,22,51,50,54,53,52,38,38,35,55,22,4,18,5,52,38,35,34,6,21,20,22,51,
+50,54,39,20,6,35,34,38,53,52,54,51,50,22,6,210,178,157,121,175,72,57,238,
+163,231,254,238,184,156,129,65,216,46,61,12,95,1,57,109,99,254,238,199,178,
+209,9,72,151,98,102,127,100,207,151,6,168,1,2,140,252,236,201,172,171,201,
+198,174,176,197,249,68,55,55,67,68,54,54,69,1,164,207,239,141,137,131,147,
+1,31,237,185,1,14,47,126,149,12,151,114,1,71,1,38,118,99,255,0,140,37,254,
+235,199,59,53,94,91,153,118,98,180,115,168,8,169,254,237,20,171,199,200,170,
+165,189,187,175,52,68,68,52,52,69,69,0,2,0,80,255,230,7,249,5,227,0,73,0,
+85,0,0,1,20,6,35,34,38,39,6,6,35,32,39,6,6,35,34,38,53,52,18,54,55,38,39,
+55,22,23,55,54,0,55,23,0,7,22,23,7,38,35,34,6,6,21,20,22,51,50,55,51,22,22,
+23,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,5,52,
+38,35,34,6,21,20,22,51,50,54,7,249,178,157,109,162,66,41,178,105,254,254,
+106,57,148,92,138,166,139,237,145,121,69,216,46,61,11,94,1,59,109,99,254,
+235,193,140,124,62,161,172,145,253,152,107,96,175,60,64,32,132,113,96,130,
+105,106,141,13,68,147,94,102,127,100,207,151,6,168,1,2,140,252,253,74,64,
+64,76,73,67,65,73,1,164,207,239,114,110,102,122,230,130,100,203,169,172,1,
+20,178,33,119,152,12,149,117,1,71,1,39,118,99,254,253,135,21,82,82,102,132,
+240,155,101,102,216,109,101,5,53,125,96,119,122,103,85,84,153,118,98,180,
+115,168,8,169,254,237,221,62,76,73,57,59,78,74,255,255,0,80,254,203,7,249,
+5,227,2,38,1,41,0,0,0,6,2,159,224,0,0,2,0,75,255,230,8,200,4,9,0,89,0,101,
+0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,53,52,38,
+35,34,6,7,35,38,38,35,34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,50,55,23,
+6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,22,23,54,54,51,50,18,21,20,7,
+22,22,51,50,54,53,52,38,38,35,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,
+8,200,178,157,118,173,71,50,188,106,141,186,147,119,104,133,34,141,180,147,
+107,164,22,78,25,149,125,114,120,134,123,62,80,122,145,131,123,124,132,44,
+139,132,196,243,111,93,84,94,204,156,130,194,53,45,182,118,181,236,10,70,
+148,97,102,127,100,207,151,6,168,1,2,140,252,56,74,64,64,76,73,67,65,73,1,
+164,207,239,135,131,121,145,174,134,125,158,128,101,69,58,99,223,150,189,
+127,98,104,121,75,68,68,76,98,77,65,63,79,33,216,44,178,143,87,122,30,35,
+117,72,116,149,128,114,113,129,254,219,224,61,67,90,87,153,118,98,180,115,
+168,8,169,254,237,251,62,76,73,57,59,78,74,0,3,0,80,255,230,8,123,5,226,0,
+79,0,91,0,103,0,0,1,20,6,35,34,38,39,6,4,35,32,0,17,52,18,51,50,22,21,20,
+6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,39,22,21,20,6,35,34,38,53,
+52,54,55,38,38,39,55,22,23,54,0,55,23,0,7,22,22,21,20,7,22,22,51,50,54,53,
+52,38,38,35,55,22,4,18,37,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,
+21,20,22,51,50,54,8,123,178,157,125,178,74,80,254,181,243,254,171,254,128,
+234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,41,103,14,127,102,
+113,146,52,48,64,125,38,216,47,63,92,1,65,113,99,254,227,202,159,189,23,71,
+152,98,102,127,100,207,151,6,168,1,2,140,248,241,75,57,62,73,73,60,60,74,
+3,104,74,60,60,73,73,62,57,75,1,164,207,239,150,145,141,154,1,51,1,20,199,
+1,11,135,115,117,138,119,98,40,41,41,123,73,173,199,199,173,151,95,40,39,
+102,126,146,112,63,102,29,54,165,86,12,152,119,67,1,45,122,99,254,246,140,
+31,240,173,89,83,93,91,153,118,98,180,115,168,8,169,254,237,165,67,73,75,
+65,64,74,72,66,66,72,74,64,65,75,73,0,4,0,80,254,203,7,147,5,226,0,51,0,68,
+0,80,0,84,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,18,55,
+38,39,55,22,23,55,54,0,55,23,4,7,22,0,21,21,22,22,51,50,54,53,52,38,38,35,
+55,22,4,18,5,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,54,1,20,6,35,34,38,
+53,52,54,51,50,22,3,19,35,19,7,147,178,157,112,167,68,34,150,106,91,152,43,
+44,153,90,143,171,241,199,125,67,216,46,61,12,94,1,55,112,99,254,243,205,
+213,1,7,70,148,97,102,127,100,207,151,6,168,1,2,140,252,235,254,249,207,207,
+254,250,113,94,171,60,63,60,171,94,113,254,171,68,55,55,67,68,54,54,69,74,
+70,246,68,1,164,207,239,123,117,112,128,119,111,111,119,227,190,224,1,78,
+53,123,150,12,151,114,1,70,1,37,120,99,252,145,44,254,171,234,13,90,87,153,
+118,98,180,115,168,8,169,254,237,117,205,1,6,254,250,205,127,136,216,216,
+136,1,80,52,68,68,52,52,69,69,253,54,254,192,1,64,0,2,0,80,255,230,7,147,
+5,226,0,51,0,68,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,
+18,55,38,39,55,22,23,55,54,0,55,23,4,7,22,0,21,21,22,22,51,50,54,53,52,38,
+38,35,55,22,4,18,5,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,54,7,147,178,
+157,112,167,68,34,150,106,91,152,43,44,153,90,143,171,241,199,125,67,216,
+46,61,12,94,1,55,112,99,254,243,205,213,1,7,70,148,97,102,127,100,207,151,
+6,168,1,2,140,252,235,254,249,207,207,254,250,113,94,171,60,63,60,171,94,
+113,1,164,207,239,123,117,112,128,119,111,111,119,227,190,224,1,78,53,123,
+150,12,151,114,1,70,1,37,120,99,252,145,44,254,171,234,13,90,87,153,118,98,
+180,115,168,8,169,254,237,117,205,1,6,254,250,205,127,136,216,216,136,255,
+255,0,80,254,203,7,147,5,226,2,38,1,46,0,0,0,6,2,159,218,0,0,1,0,70,255,230,
+7,199,5,226,0,71,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,38,38,35,34,21,20,
+22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,53,52,38,38,35,35,38,38,39,
+55,22,23,54,0,55,23,0,7,22,0,21,21,22,22,51,50,54,53,52,38,38,35,55,22,4,
+18,7,199,178,157,113,168,68,34,164,131,134,186,84,70,97,57,126,48,37,195,
+21,23,159,129,93,137,87,57,80,101,68,219,131,230,145,54,71,162,47,216,47,
+63,92,1,65,113,99,254,215,203,241,1,23,70,149,98,102,127,100,207,151,6,168,
+1,2,140,1,164,207,239,124,120,116,128,152,160,132,100,185,83,179,72,10,65,
+158,58,150,186,82,116,75,83,49,245,150,219,116,43,195,106,12,152,119,67,1,
+45,122,99,254,234,136,30,254,197,243,24,91,89,153,118,98,180,115,168,8,169,
+254,237,0,3,0,59,254,63,6,243,5,226,0,13,0,66,0,78,0,0,19,55,22,23,54,0,55,
+23,6,4,7,35,38,38,1,20,2,6,35,34,0,3,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,38,39,55,22,4,18,21,20,6,35,34,39,22,22,51,50,18,53,52,
+2,38,39,55,22,0,18,5,52,38,35,34,6,21,20,22,51,50,54,59,216,47,63,92,1,65,
+113,99,205,254,206,90,70,71,162,6,137,103,216,163,206,254,209,146,27,154,
+103,136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,140,181,
+158,78,73,109,219,121,182,212,106,214,153,6,170,1,10,146,251,41,97,83,81,
+97,92,84,86,96,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,252,58,183,
+254,217,174,1,41,1,80,102,108,169,141,136,175,97,80,116,101,154,127,172,202,
+9,168,8,169,254,237,161,206,240,38,134,100,1,12,230,183,1,63,207,13,168,13,
+254,233,254,77,110,81,97,96,83,77,93,88,0,4,0,59,254,63,6,243,5,226,0,13,
+0,66,0,78,0,82,0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,1,20,2,6,35,34,0,
+3,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,
+21,20,6,35,34,39,22,22,51,50,18,53,52,2,38,39,55,22,0,18,5,52,38,35,34,6,
+21,20,22,51,50,54,19,19,35,19,59,216,47,63,92,1,65,113,99,205,254,206,90,
+70,71,162,6,137,103,216,163,206,254,209,146,27,154,103,136,163,165,132,98,
+141,33,75,161,100,105,127,222,235,6,168,1,2,140,181,158,78,73,109,219,121,
+182,212,106,214,153,6,170,1,10,146,251,41,97,83,81,97,92,84,86,96,124,70,
+226,68,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,252,58,183,254,217,
+174,1,41,1,80,102,108,169,141,136,175,97,80,116,101,154,127,172,202,9,168,
+8,169,254,237,161,206,240,38,134,100,1,12,230,183,1,63,207,13,168,13,254,
+233,254,77,110,81,97,96,83,77,93,88,254,227,254,202,1,54,0,1,0,75,255,230,
+7,179,4,9,0,84,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,
+54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,
+14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,35,55,22,22,18,21,7,22,
+22,51,50,54,53,52,38,38,35,55,22,4,18,7,179,178,157,115,169,69,38,153,96,
+99,149,56,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,
+122,165,79,124,75,62,28,82,68,175,60,64,34,114,89,111,126,173,203,5,156,219,
+111,2,71,149,97,102,127,100,207,151,6,168,1,2,140,1,164,207,239,128,123,119,
+132,101,129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,
+46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,115,101,168,145,160,191,
+167,15,164,254,252,157,56,90,89,153,118,98,180,115,168,8,169,254,237,0,2,
+0,75,254,203,7,157,5,226,0,94,0,98,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,
+51,50,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,2,39,38,
+38,39,55,22,23,54,0,55,23,0,7,22,18,21,7,22,22,51,50,54,53,52,38,38,35,55,
+22,4,18,1,19,35,19,7,157,178,157,113,167,68,33,141,96,115,134,55,57,148,92,
+134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,79,124,75,62,
+28,82,68,175,60,64,34,119,90,88,107,179,166,71,162,47,216,47,63,92,1,65,113,
+99,254,184,213,169,177,1,70,148,96,102,127,100,207,151,6,168,1,2,140,251,
+76,70,246,68,1,164,207,239,123,118,111,130,109,121,130,100,147,111,88,134,
+99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,134,97,72,108,91,54,52,
+50,36,60,68,216,115,101,138,113,174,1,0,49,43,195,106,12,152,119,67,1,45,
+122,99,254,204,136,73,254,224,196,30,89,86,153,118,98,180,115,168,8,169,254,
+237,253,198,254,192,1,64,0,2,0,75,255,230,10,92,5,226,0,84,0,96,0,0,1,20,
+6,35,34,38,39,6,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,
+23,22,22,51,50,54,53,52,38,38,35,35,38,38,39,55,22,23,54,0,55,23,0,7,22,0,
+21,21,22,22,51,50,54,53,52,38,39,55,22,0,17,7,22,22,51,50,54,53,52,38,38,
+35,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,10,92,178,157,113,169,68,
+35,151,115,203,144,34,164,130,114,164,55,25,155,104,136,163,165,132,98,141,
+33,75,161,100,114,119,131,230,145,54,71,162,47,216,47,63,92,1,65,113,99,254,
+215,203,241,1,23,69,149,96,118,126,236,233,6,255,1,45,2,70,149,97,102,127,
+100,207,151,6,168,1,2,140,247,208,97,83,81,97,92,84,86,96,1,164,207,239,126,
+120,117,129,242,114,128,124,90,104,110,169,141,136,175,97,80,116,101,127,
+118,150,219,116,43,195,106,12,152,119,67,1,45,122,99,254,234,136,30,254,197,
+243,28,89,87,130,117,191,216,10,168,7,254,193,254,245,61,90,88,153,118,98,
+180,115,168,8,169,254,237,252,81,97,96,83,77,93,88,0,2,0,80,255,230,11,198,
+5,226,0,85,0,97,0,0,1,20,6,35,34,38,39,6,6,35,34,39,6,6,35,34,39,6,6,35,34,
+0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,38,38,39,55,
+22,23,54,0,55,23,0,7,22,18,21,7,22,22,51,50,54,53,52,38,39,55,22,0,17,7,22,
+22,51,50,54,53,52,38,38,35,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,11,
+198,178,157,114,168,69,34,151,116,200,142,35,151,113,208,146,61,230,156,231,
+254,238,120,229,156,155,229,122,14,66,143,92,118,126,203,174,71,162,47,216,
+47,63,92,1,65,113,99,254,190,214,161,174,2,67,146,93,118,126,236,233,6,255,
+1,45,2,71,149,97,102,127,100,207,151,6,168,1,2,140,247,248,201,172,171,201,
+198,174,176,197,1,164,207,239,126,121,118,129,234,112,122,254,120,134,1,31,
+237,147,239,139,138,239,148,71,67,80,79,140,125,180,241,44,43,195,106,12,
+152,119,67,1,45,122,99,254,209,138,71,254,233,186,63,84,82,130,117,191,216,
+10,168,7,254,193,254,245,60,90,89,153,118,98,180,115,168,8,169,254,237,20,
+171,199,200,170,165,189,187,0,2,0,80,255,230,6,204,5,226,0,46,0,58,0,0,1,
+20,6,35,34,38,39,6,6,35,34,0,53,52,18,55,38,39,55,22,23,55,54,0,55,23,0,7,
+22,18,21,20,7,22,22,51,50,54,53,52,38,38,35,55,22,4,18,5,52,38,35,34,6,21,
+20,22,51,50,54,6,204,178,157,119,174,72,58,235,162,231,254,238,184,156,129,
+65,216,46,61,12,95,1,57,109,99,254,238,199,178,209,10,70,149,97,102,127,100,
+207,151,6,168,1,2,140,252,242,201,172,171,201,198,174,176,197,1,164,207,239,
+138,134,129,143,1,31,237,185,1,14,47,126,149,12,151,114,1,71,1,38,118,99,
+255,0,140,37,254,235,199,65,54,90,88,153,118,98,180,115,168,8,169,254,237,
+20,171,199,200,170,165,189,187,0,2,0,80,255,230,7,150,4,9,0,57,0,69,0,0,1,
+20,6,35,34,38,39,2,33,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,
+21,20,4,51,32,36,53,52,38,39,55,30,2,21,20,7,22,22,51,50,54,53,52,38,38,35,
+55,22,4,18,37,20,22,51,50,54,53,52,38,35,34,6,7,150,178,157,119,175,71,127,
+254,78,254,221,254,202,226,182,122,144,136,115,113,133,6,90,1,10,241,1,10,
+1,4,172,153,5,131,187,95,15,70,148,97,102,127,100,207,151,6,168,1,2,140,249,
+214,75,57,62,73,73,60,60,74,1,164,207,239,139,133,254,240,1,42,1,19,212,1,
+8,135,115,117,138,133,115,25,22,95,150,173,188,174,176,142,151,15,168,13,
+140,211,120,93,78,90,87,153,118,98,180,115,168,8,169,254,237,165,67,73,75,
+65,64,74,72,0,2,0,75,254,63,7,3,5,226,0,64,0,76,0,0,37,20,2,6,35,34,0,3,6,
+6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,36,33,35,38,38,39,55,
+22,23,54,0,55,23,4,7,22,4,18,21,20,6,35,34,39,22,22,51,50,18,53,52,2,38,39,
+55,22,0,18,5,52,38,35,34,6,21,20,22,51,50,54,7,3,103,216,163,206,254,209,
+146,27,154,103,136,163,165,132,98,141,33,75,161,100,119,119,254,177,254,199,
+100,71,162,47,216,47,63,92,1,65,113,99,254,253,199,208,1,42,155,172,173,89,
+76,109,221,122,182,212,106,214,153,6,170,1,10,146,251,41,97,83,81,97,92,84,
+86,96,203,183,254,217,174,1,41,1,80,102,108,169,141,136,175,97,80,116,101,
+128,119,235,248,43,195,106,12,152,119,67,1,45,122,99,243,142,9,155,254,249,
+168,206,247,42,136,102,1,12,230,183,1,63,207,13,168,13,254,233,254,77,110,
+81,97,96,83,77,93,88,0,2,0,40,255,230,6,244,5,226,0,74,0,86,0,0,1,20,6,35,
+34,38,39,23,20,6,35,34,38,53,52,55,55,38,38,35,34,21,20,23,7,38,38,53,52,
+54,51,50,4,23,55,54,54,53,52,35,35,38,38,39,55,22,23,54,0,55,23,0,7,22,22,
+21,20,6,7,7,30,2,51,50,54,53,52,38,38,35,55,22,4,18,5,52,39,7,6,6,21,20,22,
+51,50,54,6,244,196,173,146,221,107,2,173,149,142,190,212,211,63,192,110,157,
+22,74,45,49,134,107,137,1,18,101,140,45,39,108,144,71,162,47,216,47,63,92,
+1,65,113,99,254,232,200,81,79,65,70,140,40,191,202,118,131,143,100,207,151,
+6,168,1,2,140,252,39,42,142,78,68,84,68,80,98,1,164,205,241,151,186,39,136,
+162,167,122,162,107,106,90,108,124,35,49,36,47,101,65,97,121,192,150,71,23,
+42,33,81,43,195,106,12,152,119,67,1,45,122,99,254,249,138,7,82,66,61,82,35,
+70,73,222,108,145,127,98,180,115,168,8,169,254,237,207,93,92,72,39,76,43,
+56,72,85,0,3,0,75,255,11,7,191,5,226,0,13,0,75,0,87,0,0,19,55,22,23,54,0,
+55,23,6,4,7,35,38,38,1,20,6,35,34,39,7,20,23,7,34,38,53,55,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,
+21,7,22,22,51,50,54,53,52,38,38,35,55,22,4,18,5,52,38,35,34,6,21,20,22,51,
+50,54,75,216,47,63,92,1,65,113,99,205,254,206,90,70,71,162,7,69,178,157,208,
+132,1,188,45,109,129,2,36,115,71,107,161,65,25,155,105,136,163,165,132,103,
+144,31,75,156,103,102,127,100,207,151,6,168,1,2,140,1,70,148,96,102,127,100,
+207,151,6,168,1,2,140,250,109,97,83,81,97,92,84,86,96,4,251,12,152,119,67,
+1,45,122,99,192,237,47,43,195,253,19,207,239,241,21,209,61,169,151,126,48,
+50,56,111,106,105,112,169,141,136,175,106,86,103,99,153,118,98,180,115,168,
+8,169,254,237,161,43,89,87,153,118,98,180,115,168,8,169,254,237,252,81,97,
+96,83,77,93,88,0,2,0,90,255,230,7,179,5,226,0,13,0,73,0,0,19,55,22,23,54,
+0,55,23,6,4,7,35,38,38,1,20,6,35,34,38,39,6,6,35,34,38,39,38,38,35,34,21,
+20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,53,52,38,39,55,22,0,17,
+7,22,22,51,50,54,53,52,38,38,35,55,22,4,18,98,216,47,63,92,1,65,113,99,205,
+254,206,90,70,71,162,7,34,178,157,113,167,67,36,150,114,126,185,84,70,97,
+57,126,48,37,195,21,23,159,129,93,137,87,57,80,101,68,113,111,236,233,6,255,
+1,45,2,69,147,96,102,127,100,207,151,6,168,1,2,140,4,251,12,152,119,67,1,
+45,122,99,192,237,47,43,195,253,19,207,239,123,118,115,126,153,159,132,100,
+185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,128,119,191,216,10,168,
+7,254,193,254,245,66,88,85,153,118,98,180,115,168,8,169,254,237,0,4,0,75,
+255,230,10,186,5,226,0,13,0,84,0,96,0,108,0,0,19,55,22,23,54,0,55,23,6,4,
+7,35,38,38,1,20,6,35,34,2,3,6,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,
+38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,55,
+33,50,22,23,22,22,23,30,2,51,50,54,53,52,38,38,35,55,22,4,18,37,52,38,35,
+34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,75,216,47,63,92,
+1,65,113,99,205,254,206,90,70,71,162,10,64,178,157,170,251,98,20,117,85,113,
+135,31,254,183,108,111,83,159,109,107,161,65,25,155,105,136,163,165,132,103,
+144,31,75,156,103,108,132,124,121,237,15,2,230,131,135,57,41,71,56,52,86,
+148,109,112,135,100,207,151,6,168,1,2,140,252,77,72,63,61,71,76,57,66,68,
+251,37,97,83,81,97,92,84,86,96,4,251,12,152,119,67,1,45,122,99,192,237,47,
+43,195,253,19,207,239,1,67,1,115,74,84,126,106,64,52,90,247,129,113,191,114,
+111,106,105,112,169,141,136,175,106,86,103,99,145,117,115,210,70,165,24,38,
+26,121,162,145,179,127,149,122,98,180,115,168,8,169,254,237,157,64,74,72,
+66,67,73,73,254,170,81,97,96,83,77,93,88,0,2,0,80,255,230,8,30,4,9,0,87,0,
+99,0,0,1,20,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,
+22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,
+52,38,35,34,6,21,20,22,23,7,33,53,33,38,38,53,52,54,51,50,18,21,20,7,22,22,
+51,50,54,53,52,38,38,35,55,22,4,18,37,20,22,51,50,54,53,52,38,35,34,6,8,30,
+178,157,119,173,70,47,172,104,103,161,42,42,161,103,100,167,99,232,176,122,
+144,136,115,113,133,5,41,48,78,125,70,214,60,64,60,214,70,125,78,108,93,39,
+52,58,64,30,254,120,1,17,61,55,120,90,148,170,9,72,150,98,102,127,100,207,
+151,6,168,1,2,140,249,78,78,59,57,73,76,62,55,74,1,164,207,239,137,131,128,
+140,125,105,105,125,129,245,166,219,1,34,135,115,117,138,133,115,20,25,48,
+147,81,107,151,76,216,216,76,151,107,154,181,51,45,51,73,28,92,104,47,89,
+58,83,112,254,238,235,68,62,93,90,153,118,98,180,115,168,8,169,254,237,165,
+67,73,76,64,64,74,73,0,3,0,70,255,230,7,23,5,226,0,83,0,95,0,107,0,0,1,20,
+6,35,34,38,38,39,6,6,7,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,54,51,
+50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,23,22,23,54,54,53,52,38,39,38,
+38,39,55,22,23,54,0,55,23,6,4,7,30,2,23,30,2,51,50,54,53,52,38,38,35,55,22,
+4,18,37,20,22,51,50,54,53,52,38,35,34,6,1,52,38,35,34,6,21,20,22,51,50,54,
+7,23,178,157,96,171,114,8,41,152,96,40,130,107,112,126,41,153,185,93,166,
+104,108,128,121,102,101,118,6,80,126,166,176,93,129,168,97,108,75,169,45,
+216,47,63,92,1,65,113,99,185,254,253,114,93,108,50,25,25,48,107,95,108,132,
+100,207,151,6,168,1,2,140,250,48,64,49,53,62,62,51,51,64,1,162,71,65,68,69,
+70,66,67,70,1,164,207,239,111,244,189,70,95,20,58,86,96,118,109,95,65,47,
+13,191,143,100,178,107,120,102,104,123,119,102,21,21,80,86,73,109,13,14,51,
+22,148,118,89,103,34,42,205,103,12,152,119,67,1,45,122,99,174,209,69,35,131,
+147,114,115,130,87,151,125,98,180,115,168,8,169,254,237,196,58,62,64,56,54,
+63,60,253,153,49,51,54,47,46,53,52,0,2,0,35,254,79,6,55,5,226,0,68,0,100,
+0,0,1,20,6,35,34,38,39,6,6,35,32,3,55,22,51,50,54,53,52,38,39,39,38,38,53,
+52,54,55,38,39,55,22,23,51,54,0,55,23,0,7,22,23,7,38,38,35,34,6,21,20,22,
+23,23,4,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,1,21,34,38,39,6,6,35,
+34,39,6,35,34,38,53,52,55,51,22,22,51,50,55,51,22,51,50,54,55,51,22,22,6,
+55,178,157,109,163,66,36,204,152,254,191,170,100,156,233,127,142,92,109,129,
+192,178,132,113,119,66,216,47,59,13,94,1,55,112,99,254,237,201,160,155,96,
+94,175,113,126,116,117,139,123,1,25,44,72,151,98,102,127,100,207,151,6,168,
+1,2,140,253,162,53,91,29,13,101,70,129,65,65,129,82,106,6,54,12,73,64,110,
+33,60,33,110,64,73,12,54,23,75,1,164,207,239,115,110,102,123,1,19,82,133,
+74,73,65,73,9,11,16,122,127,85,131,25,119,147,12,151,113,70,1,37,120,99,254,
+255,141,33,117,111,92,91,94,71,78,70,11,10,23,189,93,91,153,118,98,180,115,
+168,8,169,254,237,252,236,166,63,60,93,90,150,150,121,125,39,47,85,73,116,
+116,73,85,61,45,0,2,0,35,255,230,8,175,5,226,0,81,0,93,0,0,1,20,6,35,34,38,
+53,52,55,33,22,21,20,6,35,34,39,6,6,35,32,3,55,22,51,50,54,53,52,38,39,39,
+38,38,53,52,54,55,38,39,55,22,23,51,54,0,55,23,0,7,22,23,7,38,38,35,34,6,
+21,20,22,23,23,4,23,22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,8,175,137,115,113,135,32,254,193,149,176,153,197,
+140,36,204,153,254,191,170,100,156,233,127,142,92,109,129,192,178,132,113,
+119,66,216,47,59,13,94,1,55,112,99,254,237,201,160,155,96,94,175,113,126,
+116,117,139,123,1,25,44,72,151,98,107,125,95,205,157,14,15,3,8,126,132,108,
+57,123,72,63,61,71,76,57,66,68,2,209,116,137,126,106,65,51,145,252,207,238,
+226,102,124,1,19,82,133,74,73,65,73,9,11,16,122,127,85,131,25,119,147,12,
+151,113,70,1,37,120,99,254,255,141,33,117,111,92,91,94,71,78,70,11,10,23,
+189,93,91,127,106,105,173,104,165,21,67,108,89,64,74,72,66,67,73,73,0,5,0,
+40,254,203,10,166,4,8,0,86,0,98,0,110,0,120,0,124,0,0,1,20,6,35,34,38,53,
+52,55,33,22,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,7,22,22,51,
+50,54,53,52,38,35,55,22,22,18,21,7,22,22,51,50,54,53,52,38,38,35,35,55,33,
+50,30,2,5,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,
+54,1,50,55,38,38,35,34,6,21,20,5,19,35,19,10,166,137,115,113,135,32,254,193,
+149,176,153,208,146,41,173,105,94,161,129,64,184,108,142,164,140,136,84,155,
+102,73,90,6,133,113,115,136,145,121,181,227,57,72,121,85,130,147,173,203,
+5,156,219,111,2,71,149,97,107,125,95,205,157,14,15,3,8,126,132,108,57,247,
+117,74,55,62,76,73,57,59,78,8,16,72,63,61,71,76,57,66,68,247,50,137,96,72,
+124,81,64,74,2,87,70,246,68,2,209,116,137,126,106,65,51,145,252,207,238,255,
+123,131,70,107,86,91,127,109,111,124,61,60,101,143,150,95,22,25,115,133,138,
+117,115,135,254,249,213,153,132,37,25,154,159,160,191,167,15,164,254,252,
+157,56,90,89,127,106,105,173,104,165,21,67,108,38,65,73,74,64,64,76,73,16,
+64,74,72,66,67,73,73,254,64,69,55,48,43,40,89,170,254,192,1,64,0,2,0,100,
+255,230,9,72,5,226,0,70,0,82,0,0,1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,
+34,39,6,7,39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,52,18,55,38,39,55,
+22,23,55,54,0,55,23,0,7,22,18,21,7,22,22,51,50,54,53,52,38,38,35,35,55,33,
+50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,9,72,137,115,113,135,32,254,193,
+149,176,153,201,144,23,39,215,70,75,177,160,159,178,74,70,217,85,181,159,
+130,65,216,46,61,12,94,1,55,112,99,254,237,201,174,195,2,69,149,96,107,125,
+95,205,157,14,15,3,8,126,132,108,57,123,72,63,61,71,76,57,66,68,2,209,116,
+137,126,106,65,51,145,252,207,238,239,113,110,10,146,251,148,184,202,199,
+182,147,254,254,145,11,235,226,208,1,34,51,127,149,12,151,114,1,70,1,37,120,
+99,254,255,141,43,254,213,221,69,89,87,127,106,105,173,104,165,21,67,108,
+89,64,74,72,66,67,73,73,0,5,0,70,254,203,12,194,5,226,0,13,0,100,0,112,0,
+124,0,128,0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,1,20,6,35,34,38,53,52,
+55,33,22,21,20,6,35,34,39,6,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,
+54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,
+53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,
+2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,23,
+19,35,19,70,216,47,63,92,1,65,113,99,205,254,206,90,70,71,162,12,77,137,115,
+113,135,32,254,193,149,176,153,206,146,35,158,119,201,143,36,157,115,108,
+167,54,26,155,104,136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,
+168,1,2,140,2,68,146,93,105,127,222,235,6,168,1,2,140,1,71,149,98,107,125,
+95,205,157,14,15,3,8,126,132,108,57,123,72,63,61,71,76,57,66,68,245,224,97,
+83,81,97,92,84,86,96,174,70,246,68,4,251,12,152,119,67,1,45,122,99,192,237,
+47,43,195,254,64,116,137,126,106,65,51,145,252,207,238,250,117,133,237,111,
+126,126,88,104,110,169,141,136,175,97,80,116,101,154,127,172,202,9,168,8,
+169,254,237,161,53,84,82,154,127,172,202,9,168,8,169,254,237,161,38,92,89,
+127,106,105,173,104,165,21,67,108,89,64,74,72,66,67,73,73,254,212,81,97,96,
+83,77,93,88,235,254,192,1,64,0,2,0,65,255,230,9,212,3,255,0,101,0,113,0,0,
+1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,
+38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,
+21,20,7,51,39,51,7,51,21,33,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,
+53,52,39,51,22,23,22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,9,212,137,115,113,135,32,254,193,149,176,153,191,
+140,26,132,95,101,139,43,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,
+41,48,156,125,122,165,4,179,19,141,19,219,253,226,42,116,75,62,28,82,68,175,
+60,64,40,104,90,80,82,33,120,26,7,69,147,95,107,125,95,205,157,14,15,3,8,
+126,132,108,57,123,72,63,61,71,76,57,66,68,2,209,116,137,126,106,65,51,145,
+252,207,238,217,99,118,102,128,130,100,147,111,88,134,99,61,88,47,50,70,71,
+57,48,36,36,33,92,46,103,128,132,96,29,20,235,235,88,54,83,54,52,50,36,60,
+68,216,118,98,97,76,80,80,76,86,86,85,127,106,105,173,104,165,21,67,108,89,
+64,74,72,66,67,73,73,0,2,0,65,255,230,10,49,5,226,0,85,0,97,0,0,1,20,6,35,
+34,38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,
+55,35,53,33,23,6,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,36,37,38,38,
+39,55,22,23,54,0,55,23,0,7,22,0,21,21,22,22,51,50,54,53,52,38,38,35,35,55,
+33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,10,49,137,115,113,135,32,254,
+193,149,176,153,205,146,32,145,96,115,134,55,57,148,92,124,163,164,229,1,
+102,30,92,88,91,83,175,60,64,34,119,90,88,107,254,254,254,253,71,162,47,216,
+47,63,92,1,65,113,99,254,205,197,225,1,0,71,150,98,107,125,95,205,157,14,
+15,3,8,126,132,108,57,123,72,63,61,71,76,57,66,68,2,209,116,137,126,106,65,
+51,145,252,207,238,248,116,132,109,121,130,100,156,122,191,104,104,92,51,
+102,68,61,76,216,115,101,122,123,220,240,25,43,195,106,12,152,119,67,1,45,
+122,99,254,226,130,43,254,199,230,22,92,90,127,106,105,173,104,165,21,67,
+108,89,64,74,72,66,67,73,73,255,255,0,65,254,203,10,49,5,226,2,38,1,70,0,
+0,0,6,2,159,0,0,0,2,0,52,255,230,8,203,4,0,0,115,0,127,0,0,1,20,6,35,34,38,
+53,52,55,35,22,22,21,20,6,35,34,39,6,6,35,34,38,39,6,7,14,2,21,20,22,51,50,
+55,51,22,22,51,50,54,53,52,39,51,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,7,22,
+51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,7,22,51,50,53,52,35,35,39,
+33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,8,203,137,115,113,135,32,206,
+9,11,150,115,163,116,37,112,64,84,129,63,42,105,75,62,28,82,68,175,60,64,
+40,102,88,80,78,34,129,36,162,116,99,131,43,57,148,92,134,174,98,138,87,67,
+68,59,59,75,22,74,41,48,156,125,122,165,8,97,102,70,67,54,40,39,45,45,72,
+78,106,125,8,99,106,137,137,41,45,2,99,126,132,108,57,123,72,63,61,71,76,
+57,66,68,2,251,116,137,126,106,65,51,12,49,20,114,111,91,44,47,44,48,47,76,
+54,52,50,36,60,68,216,118,98,73,62,70,62,87,115,121,171,101,129,130,100,147,
+111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,132,96,40,27,
+68,63,49,44,54,15,137,32,123,104,33,32,72,99,99,165,21,67,108,89,64,74,72,
+66,67,73,73,0,4,0,80,254,203,14,124,5,226,0,99,0,111,0,123,0,127,0,0,1,20,
+6,35,34,38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,39,6,6,35,34,3,6,6,35,
+34,0,53,52,18,55,38,39,55,22,23,55,54,0,55,23,0,7,22,18,21,20,7,22,22,51,
+50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,21,
+7,22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,5,52,38,35,34,6,21,20,22,
+51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,1,19,35,19,14,124,137,115,113,
+135,32,254,193,149,176,153,207,146,35,159,119,205,145,36,158,117,219,150,
+57,238,165,231,254,238,184,156,129,65,216,46,61,12,95,1,57,109,99,254,238,
+199,178,209,8,72,151,100,105,127,222,235,6,168,1,2,140,1,70,148,97,105,127,
+222,235,6,168,1,2,140,1,72,150,98,107,125,95,205,157,14,15,3,8,126,132,108,
+57,245,66,201,172,171,201,198,174,176,197,10,67,72,63,61,71,76,57,66,68,248,
+246,70,246,68,2,209,116,137,126,106,65,51,145,252,207,238,253,118,135,247,
+116,131,1,26,133,149,1,31,237,185,1,14,47,126,149,12,151,114,1,71,1,38,118,
+99,255,0,140,37,254,235,199,53,56,95,93,154,127,172,202,9,168,8,169,254,237,
+161,42,90,87,154,127,172,202,9,168,8,169,254,237,161,36,93,90,127,106,105,
+173,104,165,21,67,108,224,171,199,200,170,165,189,187,1,46,64,74,72,66,67,
+73,73,253,150,254,192,1,64,0,3,0,60,255,230,12,54,3,255,0,104,0,116,0,127,
+0,0,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,38,39,46,2,35,35,20,
+7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,
+34,6,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,
+23,51,39,51,7,30,2,23,30,2,51,50,54,53,52,38,38,35,35,55,33,50,30,2,7,52,
+38,35,34,6,21,20,22,51,50,54,5,38,35,34,6,21,20,22,51,50,54,12,54,137,115,
+113,135,32,254,153,91,98,176,157,103,152,101,64,53,76,103,66,248,48,107,23,
+91,21,54,77,240,126,145,201,219,186,210,137,32,117,95,79,105,24,75,24,114,
+92,90,91,58,77,111,162,125,100,166,33,27,136,98,109,146,20,188,19,141,19,
+74,113,82,55,59,86,123,82,109,127,102,209,154,6,15,3,8,126,132,108,57,123,
+72,63,61,71,76,57,66,68,248,66,116,188,129,133,121,102,104,181,2,209,116,
+137,126,106,65,51,74,205,117,208,238,106,151,124,103,120,80,130,129,107,164,
+81,71,19,72,67,99,74,152,180,170,124,127,149,85,73,82,106,115,86,70,71,85,
+89,66,74,68,37,99,135,123,164,133,104,105,132,151,126,235,236,6,76,103,86,
+91,108,74,131,110,103,169,102,165,21,67,108,89,64,74,72,66,67,73,73,247,75,
+70,58,57,71,98,0,3,0,80,255,230,10,84,4,191,0,86,0,98,0,110,0,0,1,20,6,35,
+34,38,53,52,55,33,22,21,20,6,35,34,3,6,6,35,34,38,39,6,6,35,34,38,38,53,52,
+18,55,39,51,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,
+51,50,54,53,52,38,39,55,22,18,21,20,7,22,22,51,50,54,53,52,38,38,35,35,55,
+33,50,30,2,5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,
+50,54,10,84,137,115,113,135,32,254,193,149,176,153,212,149,44,171,103,88,
+163,48,52,133,84,97,160,93,172,142,17,235,16,85,91,136,115,111,135,10,112,
+133,116,184,61,64,33,141,93,122,138,167,158,5,196,219,4,72,150,98,107,125,
+95,205,157,14,15,3,8,126,132,108,57,247,42,75,57,62,73,73,60,60,74,8,91,72,
+63,61,71,76,57,66,68,2,209,116,137,126,106,65,51,145,252,207,238,1,10,122,
+144,113,117,122,108,120,226,153,192,1,36,48,210,203,23,128,88,117,138,128,
+106,38,33,126,197,141,158,216,112,104,158,141,179,170,16,168,20,254,210,252,
+43,32,93,90,127,106,105,173,104,165,21,67,108,39,67,73,75,65,64,74,72,116,
+64,74,72,66,67,73,73,0,4,0,80,255,230,9,75,5,226,0,59,0,71,0,83,0,95,0,0,
+1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,3,6,6,35,34,0,53,52,18,55,38,
+39,55,22,23,55,54,0,55,23,0,7,22,18,21,20,7,22,22,51,50,54,53,52,38,38,35,
+35,55,33,50,30,2,5,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,
+22,51,50,54,5,20,6,35,34,38,53,52,54,51,50,22,9,75,137,115,113,135,32,254,
+193,149,176,153,218,150,57,238,164,231,254,238,184,156,129,65,216,46,61,12,
+95,1,57,109,99,254,238,199,178,209,9,71,152,99,107,125,95,205,157,14,15,3,
+8,126,132,108,57,250,115,201,172,171,201,198,174,176,197,5,18,72,63,61,71,
+76,57,66,68,249,245,68,55,55,67,68,54,54,69,2,209,116,137,126,106,65,51,145,
+252,207,238,1,24,132,148,1,31,237,185,1,14,47,126,149,12,151,114,1,71,1,38,
+118,99,255,0,140,37,254,235,199,58,53,94,92,127,106,105,173,104,165,21,67,
+108,224,171,199,200,170,165,189,187,1,46,64,74,72,66,67,73,73,60,52,68,68,
+52,52,69,69,0,3,0,80,255,230,10,113,5,227,0,86,0,98,0,110,0,0,1,20,6,35,34,
+38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,32,39,6,6,35,34,38,53,52,18,54,
+55,38,39,55,22,23,55,54,0,55,23,0,7,22,23,7,38,35,34,6,6,21,20,22,51,50,55,
+51,22,22,23,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,35,35,55,33,
+50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,
+54,10,113,137,115,113,135,32,254,193,149,176,153,195,142,39,177,108,254,254,
+106,57,148,92,138,166,139,237,145,121,69,216,46,61,11,94,1,59,109,99,254,
+235,193,140,124,62,161,172,145,253,152,107,96,175,60,64,32,132,113,96,130,
+105,106,141,13,68,147,94,107,125,95,205,157,14,15,3,8,126,132,108,57,123,
+72,63,61,71,76,57,66,68,251,0,74,64,64,76,73,67,65,73,2,209,116,137,126,106,
+65,51,145,252,207,238,226,102,124,230,130,100,203,169,172,1,20,178,33,119,
+152,12,149,117,1,71,1,39,118,99,254,253,135,21,82,82,102,132,240,155,101,
+102,216,109,101,5,53,125,96,119,122,103,85,84,127,106,105,173,104,165,21,
+67,108,89,64,74,72,66,67,73,73,254,243,62,76,73,57,59,78,74,255,255,0,80,
+254,203,10,113,5,227,2,38,1,77,0,0,0,6,2,159,224,0,0,3,0,75,255,230,11,64,
+3,255,0,102,0,114,0,126,0,0,1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,
+3,6,6,35,34,38,53,52,54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,
+34,6,21,20,22,51,51,21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,
+38,38,53,52,54,51,50,22,23,54,54,51,50,18,21,20,7,22,22,51,50,54,53,52,38,
+38,35,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,
+21,20,22,51,50,54,11,64,137,115,113,135,32,254,193,149,176,153,213,148,51,
+188,106,141,186,147,119,104,133,34,141,180,147,107,164,22,78,25,149,125,114,
+120,134,123,62,80,122,145,131,123,124,132,44,139,132,196,243,111,93,84,94,
+204,156,130,194,53,45,182,118,181,236,10,70,148,97,107,125,95,205,157,14,
+15,3,8,126,132,108,57,123,72,63,61,71,76,57,66,68,250,59,74,64,64,76,73,67,
+65,73,2,209,116,137,126,106,65,51,145,252,207,238,1,11,123,144,174,134,125,
+158,128,101,69,58,99,223,150,189,127,98,104,121,75,68,68,76,98,77,65,63,79,
+33,216,44,178,143,87,122,30,35,117,72,116,149,128,114,113,129,254,219,224,
+61,67,90,87,127,106,105,173,104,165,21,67,108,89,64,74,72,66,67,73,73,254,
+213,62,76,73,57,59,78,74,0,4,0,80,255,230,10,235,5,226,0,92,0,104,0,116,0,
+128,0,0,1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,3,6,4,35,32,0,17,52,
+18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,39,22,21,
+20,6,35,34,38,53,52,54,55,38,38,39,55,22,23,54,0,55,23,0,7,22,22,21,20,7,
+22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,5,20,22,51,50,54,53,52,38,
+35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,
+54,10,235,137,115,113,135,32,254,193,149,176,153,221,152,81,254,183,240,254,
+171,254,128,234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,41,
+103,14,127,102,113,146,52,48,64,125,38,216,47,63,92,1,65,113,99,254,227,202,
+159,189,25,70,149,96,107,125,95,205,157,14,15,3,8,126,132,108,57,246,129,
+75,57,62,73,73,60,60,74,3,104,74,60,60,73,73,62,57,75,5,156,72,63,61,71,76,
+57,66,68,2,209,116,137,126,106,65,51,145,252,207,238,1,32,138,150,1,51,1,
+20,199,1,11,135,115,117,138,119,98,40,41,41,123,73,173,199,199,173,151,95,
+40,39,102,126,146,112,63,102,29,54,165,86,12,152,119,67,1,45,122,99,254,246,
+140,31,240,173,98,81,89,88,127,106,105,173,104,165,21,67,108,39,67,73,75,
+65,64,74,72,66,66,72,74,64,65,75,73,17,64,74,72,66,67,73,73,0,5,0,80,254,
+203,10,11,5,226,0,11,0,76,0,93,0,105,0,109,0,0,1,20,6,35,34,38,53,52,54,51,
+50,22,5,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,38,39,6,6,
+35,34,38,53,52,18,55,38,39,55,22,23,55,54,0,55,23,4,7,22,0,21,21,22,22,51,
+50,54,53,52,38,38,35,35,55,33,50,30,2,1,52,0,35,34,0,21,20,22,51,50,55,51,
+22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,1,19,35,19,3,41,68,55,55,67,
+68,54,54,69,6,226,137,115,113,135,32,254,193,149,176,153,202,145,33,151,106,
+91,152,43,44,153,90,143,171,241,199,125,67,216,46,61,12,94,1,55,112,99,254,
+243,205,213,1,7,70,148,97,107,125,95,205,157,14,15,3,8,126,132,108,57,250,
+115,254,249,207,207,254,250,113,94,171,60,63,60,171,94,113,5,18,72,63,61,
+71,76,57,66,68,249,79,70,246,68,2,161,52,68,68,52,52,69,69,4,116,137,126,
+106,65,51,145,252,207,238,242,113,129,119,111,111,119,227,190,224,1,78,53,
+123,150,12,151,114,1,70,1,37,120,99,252,145,44,254,171,234,13,90,87,127,106,
+105,173,104,165,21,67,108,254,191,205,1,6,254,250,205,127,136,216,216,136,
+1,103,64,74,72,66,67,73,73,253,150,254,192,1,64,0,3,0,80,255,230,10,11,5,
+226,0,64,0,81,0,93,0,0,1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,39,6,
+6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,39,55,22,23,55,54,0,55,23,4,7,22,
+0,21,21,22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,1,52,0,35,34,0,21,
+20,22,51,50,55,51,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,10,11,137,
+115,113,135,32,254,193,149,176,153,202,145,33,151,106,91,152,43,44,153,90,
+143,171,241,199,125,67,216,46,61,12,94,1,55,112,99,254,243,205,213,1,7,70,
+148,97,107,125,95,205,157,14,15,3,8,126,132,108,57,250,115,254,249,207,207,
+254,250,113,94,171,60,63,60,171,94,113,5,18,72,63,61,71,76,57,66,68,2,209,
+116,137,126,106,65,51,145,252,207,238,242,113,129,119,111,111,119,227,190,
+224,1,78,53,123,150,12,151,114,1,70,1,37,120,99,252,145,44,254,171,234,13,
+90,87,127,106,105,173,104,165,21,67,108,254,191,205,1,6,254,250,205,127,136,
+216,216,136,1,103,64,74,72,66,67,73,73,255,255,0,80,254,203,10,11,5,226,2,
+38,1,82,0,0,0,6,2,159,218,0,0,2,0,70,255,230,10,63,5,226,0,84,0,96,0,0,1,
+20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,38,39,38,38,35,34,
+21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,53,52,38,38,35,35,38,
+38,39,55,22,23,54,0,55,23,0,7,22,0,21,21,22,22,51,50,54,53,52,38,38,35,35,
+55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,10,63,137,115,113,135,32,
+254,193,149,176,153,203,146,34,164,131,134,186,84,70,97,57,126,48,37,195,
+21,23,159,129,93,137,87,57,80,101,68,219,131,230,145,54,71,162,47,216,47,
+63,92,1,65,113,99,254,215,203,241,1,23,70,149,98,107,125,95,205,157,14,15,
+3,8,126,132,108,57,123,72,63,61,71,76,57,66,68,2,209,116,137,126,106,65,51,
+145,252,207,238,246,116,130,152,160,132,100,185,83,179,72,10,65,158,58,150,
+186,82,116,75,83,49,245,150,219,116,43,195,106,12,152,119,67,1,45,122,99,
+254,234,136,30,254,197,243,24,91,89,127,106,105,173,104,165,21,67,108,89,
+64,74,72,66,67,73,73,0,4,0,59,254,63,9,101,5,226,0,13,0,80,0,92,0,104,0,0,
+19,55,22,23,54,0,55,23,6,4,7,35,38,38,1,20,6,35,34,38,53,52,55,33,22,18,21,
+20,2,6,35,34,0,3,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,
+39,55,22,4,18,21,20,6,35,34,39,22,22,51,50,18,53,52,2,38,39,55,33,50,30,2,
+7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,59,216,
+47,63,92,1,65,113,99,205,254,206,90,70,71,162,8,251,137,115,113,135,32,254,
+86,125,143,103,216,163,206,254,209,146,27,154,103,136,163,165,132,98,141,
+33,75,161,100,105,127,222,235,6,168,1,2,140,181,158,78,73,109,219,121,182,
+212,106,214,153,6,3,17,126,132,108,57,123,72,63,61,71,76,57,66,68,249,50,
+97,83,81,97,92,84,86,96,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,
+254,249,116,137,126,106,65,51,135,254,82,233,183,254,217,174,1,41,1,80,102,
+108,169,141,136,175,97,80,116,101,154,127,172,202,9,168,8,169,254,237,161,
+206,240,38,134,100,1,12,230,183,1,63,207,13,168,21,67,108,89,64,74,72,66,
+67,73,73,254,27,81,97,96,83,77,93,88,0,5,0,59,254,63,9,101,5,226,0,13,0,80,
+0,92,0,104,0,108,0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,1,20,6,35,34,38,
+53,52,55,33,22,18,21,20,2,6,35,34,0,3,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,38,39,55,22,4,18,21,20,6,35,34,39,22,22,51,50,18,53,52,
+2,38,39,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,
+20,22,51,50,54,19,19,35,19,59,216,47,63,92,1,65,113,99,205,254,206,90,70,
+71,162,8,251,137,115,113,135,32,254,86,125,143,103,216,163,206,254,209,146,
+27,154,103,136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,
+140,181,158,78,73,109,219,121,182,212,106,214,153,6,3,17,126,132,108,57,123,
+72,63,61,71,76,57,66,68,249,50,97,83,81,97,92,84,86,96,124,70,226,68,4,251,
+12,152,119,67,1,45,122,99,192,237,47,43,195,254,249,116,137,126,106,65,51,
+135,254,82,233,183,254,217,174,1,41,1,80,102,108,169,141,136,175,97,80,116,
+101,154,127,172,202,9,168,8,169,254,237,161,206,240,38,134,100,1,12,230,183,
+1,63,207,13,168,21,67,108,89,64,74,72,66,67,73,73,254,27,81,97,96,83,77,93,
+88,254,227,254,202,1,54,0,2,0,75,255,230,10,43,4,8,0,97,0,109,0,0,1,20,6,
+35,34,38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,
+52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,
+6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,35,55,22,22,18,21,7,
+22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,
+50,54,10,43,137,115,113,135,32,254,193,149,176,153,206,147,37,154,96,99,149,
+56,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,
+79,124,75,62,28,82,68,175,60,64,34,114,89,111,126,173,203,5,156,219,111,2,
+71,149,97,107,125,95,205,157,14,15,3,8,126,132,108,57,123,72,63,61,71,76,
+57,66,68,2,209,116,137,126,106,65,51,145,252,207,238,252,120,132,101,129,
+130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,
+134,97,72,108,91,54,52,50,36,60,68,216,115,101,168,145,160,191,167,15,164,
+254,252,157,56,90,89,127,106,105,173,104,165,21,67,108,89,64,74,72,66,67,
+73,73,0,3,0,75,254,203,10,21,5,226,0,107,0,119,0,123,0,0,1,20,6,35,34,38,
+53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,
+54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,2,
+21,20,22,51,50,55,51,22,22,51,50,54,53,52,2,39,38,38,39,55,22,23,54,0,55,
+23,0,7,22,18,21,7,22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,1,19,35,19,10,21,137,115,113,135,32,254,193,149,
+176,153,203,144,34,141,96,115,134,55,57,148,92,134,174,98,138,87,67,68,59,
+59,75,22,74,41,48,156,125,122,165,79,124,75,62,28,82,68,175,60,64,34,119,
+90,88,107,179,166,71,162,47,216,47,63,92,1,65,113,99,254,184,213,169,177,
+1,70,148,96,107,125,95,205,157,14,15,3,8,126,132,108,57,123,72,63,61,71,76,
+57,66,68,249,79,70,246,68,2,209,116,137,126,106,65,51,145,252,207,238,243,
+112,131,109,121,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,
+92,46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,115,101,138,113,174,
+1,0,49,43,195,106,12,152,119,67,1,45,122,99,254,204,136,73,254,224,196,30,
+89,86,127,106,105,173,104,165,21,67,108,89,64,74,72,66,67,73,73,253,150,254,
+192,1,64,0,3,0,75,255,230,12,212,5,226,0,97,0,109,0,121,0,0,1,20,6,35,34,
+38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,39,6,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,35,35,38,38,39,55,22,23,
+54,0,55,23,0,7,22,0,21,21,22,22,51,50,54,53,52,38,39,55,22,0,17,7,22,22,51,
+50,54,53,52,38,38,35,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,
+52,38,35,34,6,21,20,22,51,50,54,12,212,137,115,113,135,32,254,193,149,176,
+153,205,145,34,151,116,203,144,34,164,130,114,164,55,25,155,104,136,163,165,
+132,98,141,33,75,161,100,114,119,131,230,145,54,71,162,47,216,47,63,92,1,
+65,113,99,254,215,203,241,1,23,69,149,96,118,126,236,233,6,255,1,45,2,70,
+149,97,107,125,95,205,157,14,15,3,8,126,132,108,57,123,72,63,61,71,76,57,
+66,68,245,211,97,83,81,97,92,84,86,96,2,209,116,137,126,106,65,51,145,252,
+207,238,247,118,129,242,114,128,124,90,104,110,169,141,136,175,97,80,116,
+101,127,118,150,219,116,43,195,106,12,152,119,67,1,45,122,99,254,234,136,
+30,254,197,243,28,89,87,130,117,191,216,10,168,7,254,193,254,245,61,90,88,
+127,106,105,173,104,165,21,67,108,89,64,74,72,66,67,73,73,254,212,81,97,96,
+83,77,93,88,0,3,0,80,255,230,14,62,5,226,0,98,0,110,0,122,0,0,1,20,6,35,34,
+38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,39,6,6,35,34,39,6,6,35,34,0,
+53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,38,38,39,55,22,
+23,54,0,55,23,0,7,22,18,21,7,22,22,51,50,54,53,52,38,39,55,22,0,17,7,22,22,
+51,50,54,53,52,38,38,35,35,55,33,50,30,2,5,52,38,35,34,6,21,20,22,51,50,54,
+1,52,38,35,34,6,21,20,22,51,50,54,14,62,137,115,113,135,32,254,193,149,176,
+153,206,144,34,152,116,200,142,35,151,113,208,146,61,230,156,231,254,238,
+120,229,156,155,229,122,14,66,143,92,118,126,203,174,71,162,47,216,47,63,
+92,1,65,113,99,254,190,214,161,174,2,67,146,93,118,126,236,233,6,255,1,45,
+2,71,149,97,107,125,95,205,157,14,15,3,8,126,132,108,57,245,128,201,172,171,
+201,198,174,176,197,10,5,72,63,61,71,76,57,66,68,2,209,116,137,126,106,65,
+51,145,252,207,238,248,118,130,234,112,122,254,120,134,1,31,237,147,239,139,
+138,239,148,71,67,80,79,140,125,180,241,44,43,195,106,12,152,119,67,1,45,
+122,99,254,209,138,71,254,233,186,63,84,82,130,117,191,216,10,168,7,254,193,
+254,245,60,90,89,127,106,105,173,104,165,21,67,108,224,171,199,200,170,165,
+189,187,1,46,64,74,72,66,67,73,73,0,3,0,80,255,230,9,68,5,226,0,59,0,71,0,
+83,0,0,1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,3,6,6,35,34,0,53,52,18,
+55,38,39,55,22,23,55,54,0,55,23,0,7,22,18,21,20,7,22,22,51,50,54,53,52,38,
+38,35,35,55,33,50,30,2,5,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,
+21,20,22,51,50,54,9,68,137,115,113,135,32,254,193,149,176,153,215,149,59,
+235,162,231,254,238,184,156,129,65,216,46,61,12,95,1,57,109,99,254,238,199,
+178,209,10,70,149,97,107,125,95,205,157,14,15,3,8,126,132,108,57,250,122,
+201,172,171,201,198,174,176,197,5,11,72,63,61,71,76,57,66,68,2,209,116,137,
+126,106,65,51,145,252,207,238,1,17,129,144,1,31,237,185,1,14,47,126,149,12,
+151,114,1,71,1,38,118,99,255,0,140,37,254,235,199,65,54,90,88,127,106,105,
+173,104,165,21,67,108,224,171,199,200,170,165,189,187,1,46,64,74,72,66,67,
+73,73,0,3,0,80,255,230,10,14,4,9,0,70,0,82,0,94,0,0,1,20,6,35,34,38,53,52,
+55,33,22,21,20,6,35,34,3,2,33,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,
+52,55,6,21,20,4,51,32,36,53,52,38,39,55,30,2,21,20,7,22,22,51,50,54,53,52,
+38,38,35,35,55,33,50,30,2,5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,
+6,21,20,22,51,50,54,10,14,137,115,113,135,32,254,193,149,176,153,214,150,
+127,254,77,254,221,254,202,226,182,122,144,136,115,113,133,6,90,1,10,241,
+1,10,1,4,172,153,5,131,187,95,15,70,148,97,107,125,95,205,157,14,15,3,8,126,
+132,108,57,247,94,75,57,62,73,73,60,60,74,8,39,72,63,61,71,76,57,66,68,2,
+209,116,137,126,106,65,51,145,252,207,238,1,17,254,239,1,42,1,19,212,1,8,
+135,115,117,138,133,115,25,22,95,150,173,188,174,176,142,151,15,168,13,140,
+211,120,93,78,90,87,127,106,105,173,104,165,21,67,108,39,67,73,75,65,64,74,
+72,116,64,74,72,66,67,73,73,0,3,0,75,254,63,9,117,5,226,0,78,0,90,0,102,0,
+0,1,20,6,35,34,38,53,52,55,33,22,18,21,20,2,6,35,34,0,3,6,6,35,34,38,53,52,
+54,51,50,22,23,22,22,51,50,54,53,52,36,33,35,38,38,39,55,22,23,54,0,55,23,
+4,7,22,4,18,21,20,6,35,34,39,22,22,51,50,18,53,52,2,38,39,55,33,50,30,2,7,
+52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,9,117,137,
+115,113,135,32,254,86,125,143,103,216,163,206,254,209,146,27,154,103,136,
+163,165,132,98,141,33,75,161,100,119,119,254,177,254,199,100,71,162,47,216,
+47,63,92,1,65,113,99,254,253,199,208,1,42,155,172,173,89,76,109,221,122,182,
+212,106,214,153,6,3,17,126,132,108,57,123,72,63,61,71,76,57,66,68,249,50,
+97,83,81,97,92,84,86,96,3,138,116,137,126,106,65,51,135,254,82,233,183,254,
+217,174,1,41,1,80,102,108,169,141,136,175,97,80,116,101,128,119,235,248,43,
+195,106,12,152,119,67,1,45,122,99,243,142,9,155,254,249,168,206,247,42,136,
+102,1,12,230,183,1,63,207,13,168,21,67,108,89,64,74,72,66,67,73,73,254,27,
+81,97,96,83,77,93,88,0,3,0,40,255,230,9,114,5,226,0,89,0,101,0,113,0,0,1,
+20,6,35,34,38,53,52,55,33,22,22,21,20,6,35,34,38,39,23,20,6,35,34,38,53,52,
+55,55,38,38,35,34,21,20,23,7,38,38,53,52,54,51,50,4,23,55,54,54,53,52,35,
+35,38,38,39,55,22,23,54,0,55,23,0,7,22,22,21,20,6,7,7,30,2,51,50,54,53,52,
+38,38,35,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,52,39,7,6,6,
+21,20,22,51,50,54,9,114,137,115,113,135,32,254,169,84,89,196,173,146,221,
+107,2,173,149,142,190,212,211,63,192,110,157,22,74,45,49,134,107,137,1,18,
+101,140,45,39,108,144,71,162,47,216,47,63,92,1,65,113,99,254,232,200,81,79,
+65,70,140,40,191,202,118,131,143,98,203,148,13,15,3,8,126,132,108,57,123,
+72,63,61,71,76,57,66,68,250,36,42,142,78,68,84,68,80,98,2,209,116,137,126,
+106,65,51,74,204,118,205,241,151,186,39,136,162,167,122,162,107,106,90,108,
+124,35,49,36,47,101,65,97,121,192,150,71,23,42,33,81,43,195,106,12,152,119,
+67,1,45,122,99,254,249,138,7,82,66,61,82,35,70,73,222,108,145,127,85,158,
+101,165,21,67,108,89,64,74,72,66,67,73,73,255,93,92,72,39,76,43,56,72,85,
+0,4,0,75,255,11,10,55,5,226,0,13,0,89,0,101,0,113,0,0,19,55,22,23,54,0,55,
+23,6,4,7,35,38,38,1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,39,7,20,23,
+7,34,38,53,55,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,
+50,54,53,52,38,38,35,55,22,4,18,21,7,22,22,51,50,54,53,52,38,38,35,35,55,
+33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,
+50,54,75,216,47,63,92,1,65,113,99,205,254,206,90,70,71,162,9,189,137,115,
+113,135,32,254,215,127,165,164,199,141,1,188,45,109,129,2,36,115,71,107,161,
+65,25,155,105,136,163,165,132,103,144,31,75,156,103,102,127,100,207,151,6,
+168,1,2,140,1,70,148,96,107,125,95,205,157,14,15,3,8,126,132,108,57,123,72,
+63,61,71,76,57,66,68,248,112,97,83,81,97,92,84,86,96,4,251,12,152,119,67,
+1,45,122,99,192,237,47,43,195,254,64,116,137,126,106,65,51,139,237,214,252,
+246,26,209,61,169,151,126,48,50,56,111,106,105,112,169,141,136,175,106,86,
+103,99,153,118,98,180,115,168,8,169,254,237,161,43,89,87,127,106,105,173,
+104,165,21,67,108,89,64,74,72,66,67,73,73,254,212,81,97,96,83,77,93,88,0,
+3,0,90,255,230,10,43,5,226,0,13,0,86,0,98,0,0,19,55,22,23,54,0,55,23,6,4,
+7,35,38,38,1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,39,6,6,35,34,38,39,
+38,38,35,34,21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,53,52,
+38,39,55,22,0,17,7,22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,98,216,47,63,92,1,65,113,99,205,254,206,90,70,71,
+162,9,154,137,115,113,135,32,254,193,149,176,153,203,144,35,151,114,126,185,
+84,70,97,57,126,48,37,195,21,23,159,129,93,137,87,57,80,101,68,113,111,236,
+233,6,255,1,45,2,69,147,96,107,125,95,205,157,14,15,3,8,126,132,108,57,123,
+72,63,61,71,76,57,66,68,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,
+254,64,116,137,126,106,65,51,145,252,207,238,243,115,128,153,159,132,100,
+185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,128,119,191,216,10,168,
+7,254,193,254,245,66,88,85,127,106,105,173,104,165,21,67,108,89,64,74,72,
+66,67,73,73,0,5,0,75,255,230,13,57,5,226,0,13,0,99,0,111,0,123,0,135,0,0,
+19,55,22,23,54,0,55,23,6,4,7,35,38,38,1,20,6,35,34,38,53,52,55,33,22,22,21,
+20,6,35,34,2,3,6,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,6,6,35,
+34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,55,33,50,22,23,22,
+22,23,30,2,51,50,54,53,52,38,38,35,35,55,33,50,30,2,5,52,38,35,34,6,21,20,
+22,51,50,54,37,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,
+50,54,75,216,47,63,92,1,65,113,99,205,254,206,90,70,71,162,12,191,137,115,
+113,135,32,254,161,86,94,178,157,170,251,98,20,117,85,113,135,31,254,183,
+108,111,83,159,109,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,
+103,108,132,124,121,237,15,2,230,131,135,57,41,71,56,52,86,148,109,112,135,
+96,199,146,20,15,3,8,126,132,108,57,249,206,72,63,61,71,76,57,66,68,5,183,
+72,63,61,71,76,57,66,68,245,110,97,83,81,97,92,84,86,96,4,251,12,152,119,
+67,1,45,122,99,192,237,47,43,195,254,64,116,137,126,106,65,51,74,206,116,
+207,239,1,67,1,115,74,84,126,106,64,52,90,247,129,113,191,114,111,106,105,
+112,169,141,136,175,106,86,103,99,145,117,115,210,70,165,24,38,26,121,162,
+145,179,127,149,122,86,157,101,165,21,67,108,47,64,74,72,66,67,73,73,25,64,
+74,72,66,67,73,73,254,212,81,97,96,83,77,93,88,0,3,0,80,255,230,10,150,3,
+255,0,100,0,112,0,124,0,0,1,20,6,35,34,38,53,52,55,33,22,21,20,6,35,34,3,
+6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,22,21,20,6,35,34,38,53,52,
+55,6,6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,52,38,35,34,6,21,20,22,23,
+7,33,53,33,38,38,53,52,54,51,50,18,21,20,7,22,22,51,50,54,53,52,38,38,35,
+35,55,33,50,30,2,5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,
+22,51,50,54,10,150,137,115,113,135,32,254,193,149,176,153,213,149,46,172,
+105,103,161,42,42,161,103,100,167,99,232,176,122,144,136,115,113,133,5,41,
+48,78,125,70,214,60,64,60,214,70,125,78,108,93,39,52,58,64,30,254,120,1,17,
+61,55,120,90,148,170,9,72,150,98,107,125,95,205,157,14,15,3,8,126,132,108,
+57,246,214,78,59,57,73,76,62,55,74,8,175,72,63,61,71,76,57,66,68,2,209,116,
+137,126,106,65,51,145,252,207,238,1,13,128,141,125,105,105,125,129,245,166,
+219,1,34,135,115,117,138,133,115,20,25,48,147,81,107,151,76,216,216,76,151,
+107,154,181,51,45,51,73,28,92,104,47,89,58,83,112,254,238,235,68,62,93,90,
+127,106,105,173,104,165,21,67,108,39,67,73,76,64,64,74,73,115,64,74,72,66,
+67,73,73,0,4,0,70,255,230,9,149,5,226,0,98,0,110,0,122,0,134,0,0,1,20,6,35,
+34,38,53,52,55,33,22,22,21,20,6,35,34,38,38,39,6,6,7,22,21,20,6,35,34,38,
+53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,
+23,22,23,54,54,53,52,38,39,38,38,39,55,22,23,54,0,55,23,6,4,7,30,2,23,30,
+2,51,50,54,53,52,38,38,35,35,55,33,50,30,2,5,20,22,51,50,54,53,52,38,35,34,
+6,5,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,9,149,
+137,115,113,135,32,254,167,84,91,178,157,96,171,114,8,41,152,96,40,130,107,
+112,126,41,153,185,93,166,104,108,128,121,102,101,118,6,80,126,166,176,93,
+129,168,97,108,75,169,45,216,47,63,92,1,65,113,99,185,254,253,114,93,108,
+50,25,25,48,107,95,108,132,99,206,150,7,15,3,8,126,132,108,57,247,178,64,
+49,53,62,62,51,51,64,7,211,72,63,61,71,76,57,66,68,249,207,71,65,68,69,70,
+66,67,70,2,209,116,137,126,106,65,51,75,206,115,207,239,111,244,189,70,95,
+20,58,86,96,118,109,95,65,47,13,191,143,100,178,107,120,102,104,123,119,102,
+21,21,80,86,73,109,13,14,51,22,148,118,89,103,34,42,205,103,12,152,119,67,
+1,45,122,99,174,209,69,35,131,147,114,115,130,87,151,125,86,157,101,165,21,
+67,108,8,58,62,64,56,54,63,60,138,64,74,72,66,67,73,73,254,102,49,51,54,47,
+46,53,52,0,3,0,35,254,79,8,175,5,226,0,81,0,93,0,125,0,0,1,20,6,35,34,38,
+53,52,55,33,22,21,20,6,35,34,39,6,6,35,32,3,55,22,51,50,54,53,52,38,39,39,
+38,38,53,52,54,55,38,39,55,22,23,51,54,0,55,23,0,7,22,23,7,38,38,35,34,6,
+21,20,22,23,23,4,23,22,22,51,50,54,53,52,38,38,35,35,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,1,21,34,38,39,6,6,35,34,39,6,35,34,38,53,52,55,
+51,22,22,51,50,55,51,22,51,50,54,55,51,22,22,8,175,137,115,113,135,32,254,
+193,149,176,153,197,140,36,204,153,254,191,170,100,156,233,127,142,92,109,
+129,192,178,132,113,119,66,216,47,59,13,94,1,55,112,99,254,237,201,160,155,
+96,94,175,113,126,116,117,139,123,1,25,44,72,151,98,107,125,95,205,157,14,
+15,3,8,126,132,108,57,123,72,63,61,71,76,57,66,68,251,165,53,91,29,13,101,
+70,129,65,65,129,82,106,6,54,12,73,64,110,33,60,33,110,64,73,12,54,23,75,
+2,209,116,137,126,106,65,51,145,252,207,238,226,102,124,1,19,82,133,74,73,
+65,73,9,11,16,122,127,85,131,25,119,147,12,151,113,70,1,37,120,99,254,255,
+141,33,117,111,92,91,94,71,78,70,11,10,23,189,93,91,127,106,105,173,104,165,
+21,67,108,89,64,74,72,66,67,73,73,252,188,166,63,60,93,90,150,150,121,125,
+39,47,85,73,116,116,73,85,61,45,0,1,0,35,255,230,3,175,5,118,0,56,0,0,1,20,
+6,35,32,3,55,22,51,50,54,53,52,38,39,39,38,38,53,52,54,54,51,51,50,54,54,
+53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,23,7,38,38,35,34,6,21,20,22,
+23,23,22,22,3,168,227,183,254,191,170,100,156,233,127,142,92,109,129,192,
+178,83,173,128,113,100,77,37,40,84,104,254,38,15,1,152,178,155,75,75,67,65,
+87,96,94,175,113,126,116,117,139,123,186,148,1,48,147,183,1,19,82,133,74,
+73,65,73,9,11,16,122,127,63,117,75,19,45,37,39,48,22,165,57,109,76,67,109,
+26,31,64,111,92,91,94,71,78,70,11,10,16,157,0,4,0,40,254,203,5,119,5,118,
+0,73,0,85,0,95,0,99,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,7,22,22,51,
+50,54,53,52,38,39,6,35,35,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,
+21,20,6,7,22,18,37,52,38,35,34,6,21,20,22,51,50,54,3,50,55,38,38,35,34,6,
+21,20,5,19,35,19,5,119,100,165,97,70,138,127,64,184,108,142,164,140,136,84,
+155,102,73,90,6,133,113,115,136,145,121,181,227,57,72,117,67,138,144,122,
+122,55,66,218,229,100,77,37,40,84,104,253,224,15,1,222,178,155,75,73,55,118,
+116,252,164,74,55,62,76,73,57,59,78,190,137,96,72,124,81,64,74,2,87,70,246,
+68,1,204,150,220,115,73,104,86,91,127,109,111,124,61,60,101,143,150,95,22,
+25,115,133,138,117,115,135,254,249,213,153,131,37,26,173,157,133,211,61,5,
+92,19,45,37,39,48,22,165,57,109,76,67,108,21,78,254,246,131,65,73,74,64,64,
+76,73,254,13,69,55,48,43,40,89,170,254,192,1,64,0,1,0,85,255,245,4,50,5,118,
+0,42,0,0,1,20,7,39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,16,0,51,51,
+50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,22,4,50,87,215,70,
+75,177,160,159,178,74,70,217,85,1,18,222,121,100,77,37,40,84,104,254,38,15,
+1,152,178,155,75,103,87,104,115,1,190,206,250,10,146,251,148,184,202,199,
+182,147,254,254,145,11,235,226,1,2,1,59,19,45,37,39,48,22,165,57,109,76,80,
+120,14,72,255,0,4,0,100,254,203,8,147,5,118,0,21,0,73,0,85,0,89,0,0,1,33,
+55,33,50,22,22,21,20,6,6,35,35,53,51,50,54,54,53,52,38,38,1,20,6,35,34,39,
+6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,
+39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,5,52,38,35,34,6,
+21,20,22,51,50,54,23,19,35,19,2,62,254,38,15,1,152,178,155,75,76,131,147,
+148,159,100,77,37,40,84,5,237,181,158,201,143,36,157,115,108,167,54,26,155,
+104,136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,140,2,
+68,146,93,105,127,222,235,6,168,1,2,140,250,113,97,83,81,97,92,84,86,96,174,
+70,246,68,4,209,165,57,109,76,68,109,48,92,19,45,37,39,48,22,252,211,206,
+240,237,111,126,126,88,104,110,169,141,136,175,97,80,116,101,154,127,172,
+202,9,168,8,169,254,237,161,53,84,82,154,127,172,202,9,168,8,169,254,237,
+252,81,97,96,83,77,93,88,235,254,192,1,64,0,1,0,65,255,230,4,209,5,118,0,
+88,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,
+21,20,23,7,38,38,53,52,54,51,50,22,21,20,7,51,39,35,53,51,50,54,54,53,52,
+38,38,35,33,55,33,50,22,22,21,20,6,6,7,7,51,21,33,6,7,14,2,21,20,22,51,50,
+55,51,22,22,51,50,54,53,52,39,51,22,4,209,148,120,101,139,43,57,148,92,134,
+174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,4,179,15,107,159,
+100,77,37,40,84,104,254,38,15,1,152,178,155,75,60,106,96,15,219,253,226,42,
+116,75,62,28,82,68,175,60,64,40,104,90,80,82,33,120,36,1,56,151,187,102,128,
+130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,
+132,96,29,20,185,92,19,45,37,39,48,22,165,57,109,76,60,100,58,5,187,88,54,
+83,54,52,50,36,60,68,216,118,98,97,76,80,80,106,0,1,0,65,255,230,5,35,5,118,
+0,60,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,55,35,53,33,23,6,6,21,20,22,
+51,50,55,51,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,38,35,
+33,55,33,50,22,22,21,20,6,7,22,18,5,35,165,132,115,134,55,57,148,92,124,163,
+164,229,1,102,30,92,88,91,83,175,60,64,34,119,90,88,107,131,230,145,30,159,
+100,77,37,40,84,104,254,38,15,1,152,178,155,75,94,79,157,181,1,149,192,239,
+109,121,130,100,156,122,191,104,104,92,51,102,68,61,76,216,115,101,122,123,
+150,219,116,92,19,45,37,39,48,22,165,57,109,76,77,116,18,66,254,234,255,255,
+0,65,254,203,5,35,5,118,2,38,1,106,0,0,0,6,2,159,0,0,0,1,0,75,255,230,4,219,
+5,118,0,94,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,
+35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,7,22,51,50,54,53,52,35,35,53,
+51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,7,22,22,21,20,6,35,34,
+39,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,4,219,162,
+116,99,131,43,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,
+125,122,165,3,108,136,75,82,159,185,159,100,77,37,40,84,104,254,38,15,1,152,
+178,155,75,103,51,52,154,132,168,143,42,120,75,62,28,82,68,175,60,64,40,102,
+88,80,78,34,129,36,1,10,121,171,101,129,130,100,147,111,88,134,99,61,88,47,
+50,70,71,57,48,36,36,33,92,46,103,128,132,96,43,81,66,60,134,92,19,45,37,
+39,48,22,165,57,109,76,114,69,26,94,59,112,130,111,57,85,54,52,50,36,60,68,
+216,118,98,73,62,70,62,87,0,3,0,80,254,203,9,110,5,118,0,72,0,84,0,88,0,0,
+1,20,6,35,34,39,6,6,35,34,3,6,6,35,34,0,53,52,54,54,51,51,50,54,54,53,52,
+38,38,35,33,55,33,50,22,22,21,20,6,7,22,22,21,20,7,22,22,51,50,54,53,52,38,
+39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,5,52,38,35,34,6,
+21,20,22,51,50,54,1,19,35,19,9,110,181,158,205,145,36,158,117,219,150,57,
+238,165,231,254,238,120,229,156,95,100,77,37,40,84,104,254,38,15,1,152,178,
+155,75,88,72,109,119,8,72,151,100,105,127,222,235,6,168,1,2,140,1,70,148,
+97,105,127,222,235,6,168,1,2,140,250,80,201,172,171,201,198,174,176,197,3,
+57,70,246,68,1,164,206,240,247,116,131,1,26,133,149,1,31,237,147,239,139,
+19,45,37,39,48,22,165,57,109,76,73,114,20,68,237,146,53,56,95,93,154,127,
+172,202,9,168,8,169,254,237,161,42,90,87,154,127,172,202,9,168,8,169,254,
+237,20,171,199,200,170,165,189,187,254,129,254,192,1,64,0,2,0,60,255,231,
+6,169,5,118,0,80,0,91,0,0,1,51,21,33,20,7,22,21,20,7,39,54,53,52,39,6,6,35,
+34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,23,54,54,51,50,22,23,51,39,35,53,51,50,54,54,53,52,38,
+38,35,33,55,33,50,22,22,21,20,6,7,1,38,35,34,6,21,20,22,51,50,54,5,193,213,
+254,15,48,107,23,91,21,54,77,240,126,145,201,219,186,210,137,32,117,95,79,
+105,24,75,24,114,92,90,91,58,77,111,162,125,100,166,33,27,136,98,109,146,
+20,188,15,152,159,100,77,37,40,84,104,254,38,15,1,152,178,155,75,110,106,
+254,44,116,188,129,133,121,102,104,181,2,234,88,130,129,107,164,81,71,19,
+72,67,99,74,152,180,170,124,127,149,85,73,82,106,115,86,70,71,85,89,66,74,
+68,37,99,135,123,164,133,104,105,132,151,126,185,92,19,45,37,39,48,22,165,
+57,109,76,83,121,14,253,212,75,70,58,57,71,98,0,2,0,80,255,230,5,73,5,118,
+0,71,0,83,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,39,51,7,22,
+22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,
+38,39,35,53,51,50,54,54,53,52,38,38,35,33,55,51,50,22,22,21,20,6,7,22,22,
+37,20,22,51,50,54,53,52,38,35,34,6,5,73,96,163,96,88,163,48,52,133,84,97,
+160,93,172,142,17,235,16,85,91,136,115,111,135,10,112,133,116,184,61,64,33,
+141,93,117,143,123,120,142,119,100,77,37,40,84,104,254,238,15,208,178,155,
+75,104,88,106,104,252,53,75,57,62,73,73,60,60,74,1,203,137,222,126,113,117,
+122,108,120,226,153,192,1,36,48,210,203,23,128,88,117,138,128,106,38,33,126,
+197,141,158,216,112,104,142,147,135,240,66,92,19,45,37,39,48,22,165,57,109,
+76,81,119,15,80,255,140,67,73,75,65,64,74,72,0,3,0,80,255,230,4,67,5,118,
+0,31,0,43,0,55,0,0,1,20,0,35,34,0,53,52,54,54,51,51,50,54,54,53,52,38,38,
+35,33,55,33,50,22,22,21,20,6,7,22,22,7,52,38,35,34,6,21,20,22,51,50,54,39,
+20,6,35,34,38,53,52,54,51,50,22,4,67,254,236,230,231,254,238,120,229,156,
+119,100,77,37,40,84,104,254,38,15,1,152,178,155,75,94,83,106,115,133,201,
+172,171,201,198,174,176,197,249,68,55,55,67,68,54,54,69,1,242,238,254,226,
+1,31,237,147,239,139,19,45,37,39,48,22,165,57,109,76,76,116,20,69,234,80,
+171,199,200,170,165,189,187,175,52,68,68,52,52,69,69,0,2,0,80,255,230,5,112,
+5,118,0,59,0,71,0,0,1,20,6,35,32,39,6,6,35,34,38,53,52,18,36,51,51,50,54,
+54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,23,7,38,35,34,6,6,21,20,
+22,51,50,55,51,22,22,23,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,
+50,54,5,112,204,143,254,254,106,57,148,92,138,166,191,1,56,178,123,100,77,
+37,40,84,104,254,38,15,1,152,178,155,75,83,61,39,34,62,161,172,145,253,152,
+107,96,175,60,64,32,132,113,96,130,105,118,145,122,74,64,64,76,73,67,65,73,
+1,67,143,206,230,130,100,203,169,203,1,52,166,19,45,37,39,48,22,165,57,109,
+76,71,112,19,20,23,82,102,132,240,155,101,102,216,109,101,5,53,125,96,119,
+149,86,62,76,73,57,59,78,74,255,255,0,80,254,203,5,112,5,118,2,38,1,113,0,
+0,0,6,2,159,224,0,0,2,0,75,255,230,6,64,5,118,0,86,0,98,0,0,1,20,6,6,35,34,
+38,53,52,54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,
+22,51,51,21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,53,
+52,54,51,50,22,23,54,54,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,
+20,6,7,22,22,1,52,38,35,34,6,21,20,22,51,50,54,6,64,117,182,94,141,186,147,
+119,104,133,34,141,180,147,107,164,22,78,25,149,125,114,120,134,123,62,80,
+122,145,131,123,124,132,44,139,132,196,243,111,93,84,94,204,156,130,194,53,
+45,182,118,54,100,77,37,40,84,104,254,38,15,1,152,178,155,75,92,77,89,100,
+254,192,74,64,64,76,73,67,65,73,1,250,168,241,123,174,134,125,158,128,101,
+69,58,99,223,150,189,127,98,104,121,75,68,68,76,98,77,65,63,79,33,216,44,
+178,143,87,122,30,35,117,72,116,149,128,114,113,129,19,45,37,39,48,22,165,
+57,109,76,75,116,19,68,231,254,195,62,76,73,57,59,78,74,0,3,0,80,255,230,
+5,250,5,118,0,64,0,76,0,88,0,0,1,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,
+34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,38,39,22,21,20,6,35,34,38,53,52,
+54,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,22,37,20,
+22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,5,250,254,
+128,254,171,254,171,254,128,234,174,122,144,136,115,106,130,13,42,50,1,41,
+1,64,1,64,1,41,50,42,13,131,105,115,136,143,120,5,100,77,37,40,84,104,254,
+38,15,1,152,178,155,75,73,59,90,105,251,114,75,57,62,73,73,60,60,74,3,114,
+74,60,60,73,73,62,57,75,2,45,254,236,254,205,1,51,1,20,199,1,11,135,115,117,
+138,119,98,40,41,41,123,73,173,199,199,173,73,123,41,41,40,98,119,138,117,
+114,136,19,45,37,39,48,22,165,57,109,76,66,108,24,60,209,57,67,73,75,65,64,
+74,72,66,66,72,74,64,65,75,73,0,4,0,80,254,203,5,1,5,118,0,37,0,54,0,66,0,
+70,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,36,51,51,50,54,54,53,52,38,
+38,35,33,55,33,50,22,22,21,20,6,7,22,18,7,52,0,35,34,0,21,20,22,51,50,55,
+51,22,51,50,54,1,20,6,35,34,38,53,52,54,51,50,22,3,19,35,19,5,1,172,142,91,
+152,43,44,153,90,143,171,161,1,18,165,133,100,77,37,40,84,104,254,38,15,1,
+152,178,155,75,93,83,138,163,131,254,249,207,207,254,250,113,94,171,60,63,
+60,171,94,113,254,171,68,55,55,67,68,54,54,69,74,70,246,68,1,135,190,227,
+119,111,111,119,227,190,184,1,32,160,19,45,37,39,48,22,165,57,109,76,76,116,
+20,79,254,222,111,205,1,6,254,250,205,127,136,216,216,136,1,80,52,68,68,52,
+52,69,69,253,54,254,192,1,64,0,2,0,80,255,230,5,2,5,118,0,36,0,54,0,0,1,20,
+6,35,34,38,39,6,6,35,34,38,53,16,0,33,51,50,54,54,53,52,38,38,35,33,55,33,
+50,22,22,21,20,6,7,22,18,7,52,2,35,34,6,21,20,22,51,50,55,51,22,22,51,50,
+54,5,2,159,138,115,134,55,57,148,92,144,160,1,75,1,14,129,100,77,37,40,84,
+104,254,38,15,1,152,178,155,75,87,72,137,151,131,247,223,223,247,110,93,175,
+60,64,34,119,90,90,105,1,149,201,230,109,121,130,100,228,203,1,23,1,83,19,
+45,37,39,48,22,165,57,109,76,73,114,20,75,254,231,147,229,1,0,253,234,129,
+114,216,115,101,117,0,3,0,80,254,203,5,1,5,118,0,37,0,54,0,58,0,0,1,20,6,
+35,34,38,39,6,6,35,34,38,53,52,18,36,51,51,50,54,54,53,52,38,38,35,33,55,
+33,50,22,22,21,20,6,7,22,18,7,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,
+54,1,19,35,19,5,1,172,142,91,152,43,44,153,90,143,171,161,1,18,165,133,100,
+77,37,40,84,104,254,38,15,1,152,178,155,75,93,83,138,163,131,254,249,207,
+207,254,250,113,94,171,60,63,60,171,94,113,254,97,70,246,68,1,135,190,227,
+119,111,111,119,227,190,184,1,32,160,19,45,37,39,48,22,165,57,109,76,76,116,
+20,79,254,222,111,205,1,6,254,250,205,127,136,216,216,136,254,186,254,192,
+1,64,0,1,0,70,255,230,5,51,5,118,0,57,0,0,1,20,6,35,34,38,39,38,38,35,34,
+21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,53,52,38,38,35,35,53,
+51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,5,51,174,179,
+134,186,84,70,97,57,126,48,37,195,21,23,159,129,93,137,87,57,80,101,68,219,
+131,230,145,30,159,100,77,37,40,84,104,254,38,15,1,152,178,155,75,94,79,157,
+181,1,149,197,234,152,160,132,100,185,83,179,72,10,65,158,58,150,186,82,116,
+75,83,49,245,150,219,116,92,19,45,37,39,48,22,165,57,109,76,77,116,18,66,
+254,234,0,3,0,100,255,230,5,248,5,118,0,21,0,52,0,64,0,0,1,33,55,33,50,22,
+22,21,20,6,6,35,35,53,51,50,54,54,53,52,38,38,1,20,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,0,1,52,38,35,34,
+6,21,20,22,51,50,54,2,62,254,38,15,1,152,178,155,75,76,131,147,148,159,100,
+77,37,40,84,3,82,165,164,108,167,54,26,155,104,136,163,165,132,98,141,33,
+75,161,100,118,126,236,233,6,255,1,45,253,7,97,83,81,97,92,84,86,96,4,209,
+165,57,109,76,68,109,48,92,19,45,37,39,48,22,252,231,214,252,126,88,104,110,
+169,141,136,175,97,80,116,101,130,117,191,216,10,168,7,254,193,254,134,81,
+97,96,83,77,93,88,255,255,0,100,254,203,5,248,5,118,2,38,1,121,0,0,0,7,2,
+159,0,168,0,0,0,1,0,75,255,230,5,33,5,118,0,82,0,0,1,20,6,6,35,34,38,39,6,
+6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,
+50,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,35,53,
+51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,5,33,85,144,
+88,99,149,56,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,
+122,165,79,124,75,62,28,82,68,175,60,64,34,114,89,115,141,120,120,185,159,
+100,77,37,40,84,104,254,38,15,1,152,178,155,75,101,91,106,105,1,193,148,215,
+112,101,129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,
+46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,115,101,171,137,133,226,
+63,92,19,45,37,39,48,22,165,57,109,76,80,118,17,81,254,250,255,255,0,75,254,
+203,5,33,5,118,2,38,1,123,0,0,0,6,2,159,228,0,0,2,0,75,255,230,7,203,5,118,
+0,69,0,81,0,0,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,23,22,22,51,50,54,53,52,0,35,35,53,33,50,54,54,53,52,38,38,35,33,55,33,
+50,22,22,21,20,6,7,22,18,21,7,22,22,51,50,54,53,52,38,39,55,22,0,1,52,38,
+35,34,6,21,20,22,51,50,54,7,203,165,164,203,144,34,160,126,114,172,54,26,
+155,104,136,163,165,132,98,141,33,75,161,100,114,120,254,231,225,178,1,23,
+93,77,44,42,84,102,253,174,15,2,16,177,155,76,91,76,170,189,1,70,149,96,118,
+126,236,233,6,255,1,45,250,97,97,83,81,97,92,84,86,96,1,184,214,252,242,115,
+127,126,88,104,110,169,141,136,175,97,80,116,101,134,128,209,1,3,92,13,50,
+40,38,48,21,165,57,107,76,77,115,19,63,254,225,190,30,89,87,130,117,191,216,
+10,168,7,254,193,254,134,81,97,96,83,77,93,88,0,2,0,80,255,230,9,52,5,118,
+0,72,0,84,0,0,1,20,6,35,34,39,6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,
+22,22,21,20,7,22,22,51,50,54,53,52,38,39,33,53,51,50,54,54,53,52,38,38,35,
+33,55,33,50,22,22,21,20,6,7,22,18,21,7,22,22,51,50,54,53,52,38,39,55,22,0,
+5,52,38,35,34,6,21,20,22,51,50,54,9,52,165,164,202,144,39,153,103,208,146,
+61,230,156,231,254,238,120,229,156,155,229,122,14,66,135,85,115,141,120,120,
+255,0,229,100,77,37,40,84,104,253,224,15,1,222,178,155,75,103,88,106,105,
+3,67,146,94,118,126,236,233,6,255,1,45,250,138,201,172,171,201,198,174,176,
+197,1,184,214,252,240,116,124,254,120,134,1,31,237,147,239,139,138,239,148,
+71,67,80,79,171,137,133,226,63,92,19,45,37,39,48,22,165,57,109,76,80,120,
+15,81,254,250,149,81,84,83,130,117,191,216,10,168,7,254,193,146,171,199,200,
+170,165,189,187,0,2,0,80,255,230,4,67,5,118,0,31,0,43,0,0,1,20,0,35,34,0,
+53,52,54,54,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,
+22,7,52,38,35,34,6,21,20,22,51,50,54,4,67,254,236,230,231,254,238,120,229,
+156,100,100,77,37,40,84,104,253,232,15,1,214,178,155,75,84,77,107,117,133,
+201,172,171,201,198,174,176,197,1,242,238,254,226,1,31,237,147,239,139,19,
+45,37,39,48,22,165,57,109,76,85,107,17,69,235,82,171,199,200,170,165,189,
+187,0,2,0,80,255,230,5,49,5,118,0,52,0,64,0,0,1,22,21,16,0,33,32,0,17,52,
+18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,51,50,54,53,52,39,35,53,51,
+50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,5,20,22,51,50,54,53,52,
+38,35,34,6,4,93,142,254,215,254,249,254,223,254,182,226,182,122,144,136,115,
+113,133,6,90,1,22,251,215,246,164,172,159,100,77,37,40,84,104,254,38,15,1,
+152,178,155,75,111,252,170,75,57,62,73,73,60,60,74,3,170,154,245,254,247,
+254,212,1,26,1,35,212,1,8,135,115,117,138,133,115,25,22,95,150,178,183,200,
+178,212,134,92,19,45,37,39,48,22,165,57,109,76,84,121,205,67,73,75,65,64,
+74,72,0,2,0,75,255,230,5,64,5,118,0,51,0,63,0,0,1,20,6,35,34,38,39,6,6,35,
+34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,
+53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,1,52,38,35,34,6,21,20,22,
+51,50,54,5,64,172,173,114,172,54,26,155,104,136,163,165,132,98,141,33,75,
+161,100,114,119,131,230,145,30,159,100,77,37,40,84,104,254,38,15,1,152,178,
+155,75,94,79,157,181,252,236,97,83,81,97,92,84,86,96,1,149,196,235,126,88,
+104,110,169,141,136,175,97,80,116,101,127,118,150,219,116,92,19,45,37,39,
+48,22,165,57,109,76,77,116,18,66,254,234,254,240,81,97,96,83,77,93,88,0,2,
+0,40,255,230,4,180,5,118,0,61,0,73,0,0,1,22,21,20,6,7,7,22,21,20,6,35,34,
+38,53,52,55,55,38,38,35,34,21,20,23,7,38,38,53,52,54,51,50,4,23,55,54,53,
+52,39,6,35,35,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,1,7,
+6,6,21,20,22,51,50,54,53,52,4,95,16,66,72,156,98,173,149,142,190,212,211,
+63,191,111,157,22,74,45,49,134,107,137,1,18,101,154,89,8,61,117,148,159,100,
+77,37,40,84,104,254,38,15,1,152,178,155,75,45,254,107,143,80,66,84,68,80,
+98,3,217,41,50,75,104,35,78,177,153,136,162,167,122,163,106,106,90,108,124,
+35,49,36,47,101,65,97,121,192,150,77,47,82,34,23,13,92,19,45,37,39,48,22,
+165,57,109,76,52,89,254,55,71,41,74,43,56,72,85,88,93,0,3,0,100,255,230,7,
+46,5,118,0,21,0,68,0,80,0,0,1,33,55,33,50,22,22,21,20,6,6,35,35,53,51,50,
+54,54,53,52,38,38,1,6,6,35,34,38,39,6,35,34,38,39,6,6,35,34,38,53,52,54,51,
+50,22,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,21,7,6,21,20,22,51,50,55,
+37,52,38,35,34,6,21,20,22,51,50,54,2,62,254,38,15,1,152,178,155,75,76,131,
+147,148,159,100,77,37,40,84,4,136,33,92,46,71,112,24,91,166,107,161,65,25,
+155,105,136,163,165,132,103,144,31,75,156,103,102,127,100,207,151,6,168,1,
+2,140,5,5,65,52,60,51,252,35,97,83,81,97,92,84,86,96,4,209,165,57,109,76,
+68,109,48,92,19,45,37,39,48,22,251,75,26,28,76,62,138,111,106,105,112,169,
+141,136,175,106,86,103,99,153,118,98,180,115,168,8,169,254,237,161,81,40,
+28,54,56,37,131,81,97,96,83,77,93,88,0,2,0,100,255,230,5,239,5,118,0,21,0,
+59,0,0,1,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,6,35,35,19,
+34,21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,53,52,38,39,55,
+22,0,17,20,6,35,34,38,39,38,38,1,173,159,100,77,37,40,84,104,254,38,15,1,
+152,178,155,75,76,131,147,148,142,126,48,37,195,21,23,159,129,93,137,87,57,
+80,101,68,113,111,236,233,6,255,1,45,165,164,126,185,84,70,97,3,255,19,45,
+37,39,48,22,165,57,109,76,68,109,48,254,99,185,83,179,72,10,65,158,58,150,
+186,82,116,75,83,49,128,119,191,216,10,168,7,254,193,254,245,214,252,153,
+159,132,100,0,4,0,100,255,230,8,85,5,118,0,21,0,69,0,81,0,93,0,0,1,33,55,
+33,50,22,22,21,20,6,6,35,35,53,51,50,54,54,53,52,38,38,1,20,6,35,34,38,53,
+52,55,33,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,
+1,52,38,35,34,6,21,20,22,51,50,54,2,62,254,38,15,1,152,178,155,75,76,131,
+147,148,159,100,77,37,40,84,5,175,137,115,113,135,31,254,183,108,111,83,159,
+109,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,103,108,132,124,
+121,237,15,2,230,126,132,108,57,123,72,63,61,71,76,57,66,68,251,37,97,83,
+81,97,92,84,86,96,4,209,165,57,109,76,68,109,48,92,19,45,37,39,48,22,254,
+42,116,137,126,106,64,52,90,247,129,113,191,114,111,106,105,112,169,141,136,
+175,106,86,103,99,145,117,115,210,70,165,21,67,108,89,64,74,72,66,67,73,73,
+254,170,81,97,96,83,77,93,88,0,2,0,80,255,230,5,176,5,118,0,83,0,95,0,0,1,
+20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,22,21,20,6,35,34,38,53,
+52,55,6,6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,52,38,35,34,6,21,20,22,
+23,7,33,53,33,38,38,53,52,54,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,
+22,21,20,7,22,22,37,20,22,51,50,54,53,52,38,35,34,6,5,144,99,167,100,103,
+161,42,42,161,103,100,167,99,232,176,122,144,136,115,113,133,5,41,48,78,125,
+70,214,60,64,60,214,70,125,78,108,93,39,52,58,64,30,254,120,1,17,61,55,120,
+90,7,100,77,37,40,84,104,253,232,15,1,214,178,155,75,164,62,70,251,220,78,
+59,57,73,76,62,55,74,2,2,166,245,129,125,105,105,125,129,245,166,219,1,34,
+135,115,117,138,133,115,20,25,48,147,81,107,151,76,216,216,76,151,107,154,
+181,51,45,51,73,28,92,104,47,89,58,83,112,19,45,37,39,48,22,165,57,109,76,
+172,38,62,219,81,67,73,76,64,64,74,73,0,3,0,70,255,231,4,179,5,118,0,66,0,
+78,0,90,0,0,1,20,6,6,7,22,21,20,6,7,22,21,20,6,35,34,38,53,52,55,38,38,53,
+52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,23,22,23,54,53,52,
+38,39,35,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,1,20,22,51,50,54,
+53,52,38,35,34,6,1,52,38,35,34,6,21,20,22,51,50,54,4,179,60,106,101,157,151,
+139,39,130,107,112,126,41,153,185,93,166,104,108,128,121,102,101,118,6,80,
+126,166,176,94,236,61,64,125,159,100,77,37,40,84,104,254,38,15,1,152,178,
+155,75,252,148,64,49,53,62,62,51,51,64,1,162,71,65,68,69,70,66,67,70,4,132,
+60,101,56,6,103,182,132,157,26,58,86,96,118,109,95,65,47,13,191,143,100,178,
+107,120,102,104,123,119,102,21,21,80,86,73,109,13,14,52,39,230,89,122,41,
+92,19,45,37,39,48,22,165,57,109,254,57,58,62,64,56,54,63,60,253,153,49,51,
+54,47,46,53,52,0,2,0,35,254,79,3,217,5,118,0,56,0,88,0,0,1,52,38,39,39,38,
+38,53,52,54,54,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,
+22,23,7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,
+19,21,34,38,39,6,6,35,34,39,6,35,34,38,53,52,55,51,22,22,51,50,55,51,22,51,
+50,54,55,51,22,22,3,25,92,109,129,192,178,83,173,128,113,100,77,37,40,84,
+104,254,38,15,1,152,178,155,75,75,67,65,87,96,94,175,113,126,116,117,139,
+123,186,148,227,183,254,191,170,100,156,233,127,142,192,53,91,29,13,101,70,
+129,65,65,129,82,106,6,54,12,73,64,110,33,60,33,110,64,73,12,54,23,75,1,89,
+65,73,9,11,16,122,127,63,117,75,19,45,37,39,48,22,165,57,109,76,67,109,26,
+31,64,111,92,91,94,71,78,70,11,10,16,157,120,147,183,1,19,82,133,74,254,33,
+166,63,60,93,90,150,150,121,125,39,47,85,73,116,116,73,85,61,45,0,1,0,35,
+255,230,3,202,6,162,0,71,0,0,19,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,
+50,54,53,52,38,39,39,38,38,53,52,54,54,51,51,50,54,54,53,52,38,38,35,33,55,
+33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,22,23,7,38,38,
+35,34,6,223,117,139,123,186,148,227,183,254,191,170,100,156,233,127,142,92,
+109,129,192,178,83,173,128,112,100,77,37,40,84,104,254,38,15,1,124,29,112,
+109,181,101,87,74,101,63,68,20,133,138,64,75,67,75,78,96,94,175,113,126,116,
+2,254,78,70,11,10,16,157,120,147,183,1,19,82,133,74,73,65,73,9,11,16,122,
+127,63,117,75,19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,25,4,
+63,104,70,67,109,26,35,60,111,92,91,94,0,4,0,40,254,203,5,119,6,162,0,88,
+0,100,0,110,0,114,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,
+23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,7,22,22,51,50,
+54,53,52,38,39,6,35,35,53,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,
+51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,22,18,37,52,38,35,34,6,21,20,
+22,51,50,54,3,50,55,38,38,35,34,6,21,20,5,19,35,19,5,119,100,165,97,70,138,
+127,64,184,108,142,164,140,136,84,155,102,73,90,6,133,113,115,136,145,121,
+181,227,57,72,117,67,138,144,122,122,55,66,218,229,100,77,37,40,84,104,253,
+224,15,1,194,29,112,109,181,101,87,74,101,63,68,20,133,138,64,73,55,118,116,
+252,164,74,55,62,76,73,57,59,78,190,137,96,72,124,81,64,74,2,87,70,246,68,
+1,204,150,220,115,73,104,86,91,127,109,111,124,61,60,101,143,150,95,22,25,
+115,133,138,117,115,135,254,249,213,153,131,37,26,173,157,133,211,61,5,92,
+19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,25,4,63,104,70,67,108,
+21,78,254,246,131,65,73,74,64,64,76,73,254,13,69,55,48,43,40,89,170,254,192,
+1,64,0,1,0,85,255,245,4,59,6,162,0,57,0,0,1,20,7,39,54,54,53,52,38,35,34,
+6,21,20,18,23,7,38,53,16,0,51,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,
+54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,22,22,4,50,87,215,70,75,
+177,160,159,178,74,70,217,85,1,18,222,121,100,77,37,40,84,104,254,38,15,1,
+124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,103,87,104,115,1,190,
+206,250,10,146,251,148,184,202,199,182,147,254,254,145,11,235,226,1,2,1,59,
+19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,25,4,63,104,70,80,120,
+14,72,255,0,4,0,100,254,203,8,147,6,162,0,36,0,88,0,100,0,104,0,0,1,33,55,
+33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,6,35,35,53,51,
+50,54,54,53,52,38,38,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,
+52,38,39,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,23,19,35,19,2,62,254,
+38,15,1,134,29,112,109,181,101,87,74,101,63,68,25,123,135,62,76,131,147,148,
+159,100,77,37,40,84,5,237,181,158,201,143,36,157,115,108,167,54,26,155,104,
+136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,1,2,140,2,68,146,
+93,105,127,222,235,6,168,1,2,140,250,113,97,83,81,97,92,84,86,96,174,70,246,
+68,4,209,165,47,60,84,109,191,38,93,57,44,37,28,6,62,104,68,68,109,48,92,
+19,45,37,39,48,22,252,211,206,240,237,111,126,126,88,104,110,169,141,136,
+175,97,80,116,101,154,127,172,202,9,168,8,169,254,237,161,53,84,82,154,127,
+172,202,9,168,8,169,254,237,252,81,97,96,83,77,93,88,235,254,192,1,64,0,1,
+0,65,255,230,4,209,6,162,0,103,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,
+54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,7,51,
+39,35,53,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,
+34,6,21,20,23,30,2,21,20,6,6,7,7,51,21,33,6,7,14,2,21,20,22,51,50,55,51,22,
+22,51,50,54,53,52,39,51,22,4,209,148,120,101,139,43,57,148,92,134,174,98,
+138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,4,179,15,107,159,100,77,
+37,40,84,104,254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,20,133,138,
+64,60,106,96,15,219,253,226,42,116,75,62,28,82,68,175,60,64,40,104,90,80,
+82,33,120,36,1,56,151,187,102,128,130,100,147,111,88,134,99,61,88,47,50,70,
+71,57,48,36,36,33,92,46,103,128,132,96,29,20,185,92,19,45,37,39,48,22,165,
+47,60,84,109,191,38,93,57,44,39,25,4,63,104,70,60,100,58,5,187,88,54,83,54,
+52,50,36,60,68,216,118,98,97,76,80,80,106,0,1,0,65,255,230,5,35,6,162,0,75,
+0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,55,35,53,33,23,6,6,21,20,22,51,
+50,55,51,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,38,35,33,
+55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,22,18,5,35,
+165,132,115,134,55,57,148,92,124,163,164,229,1,102,30,92,88,91,83,175,60,
+64,34,119,90,88,107,131,230,145,31,159,100,77,37,40,84,104,254,38,15,1,124,
+29,112,109,181,101,87,74,101,63,68,20,133,138,64,92,80,157,181,1,149,192,
+239,109,121,130,100,156,122,191,104,104,92,51,102,68,61,76,216,115,101,122,
+123,150,219,116,92,19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,
+25,4,63,104,70,75,116,20,66,254,234,255,255,0,65,254,203,5,35,6,162,2,38,
+1,142,0,0,0,6,2,159,0,0,0,1,0,75,255,230,4,219,6,162,0,109,0,0,1,20,6,35,
+34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,
+53,52,54,51,50,22,21,7,22,51,50,54,53,52,35,35,53,51,50,54,54,53,52,38,38,
+35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,7,22,22,
+21,20,6,35,34,39,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,
+22,4,219,162,116,99,131,43,57,148,92,134,174,98,138,87,67,68,59,59,75,22,
+74,41,48,156,125,122,165,3,108,136,75,82,159,185,159,100,77,37,40,84,104,
+254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,103,51,52,
+154,132,168,143,42,120,75,62,28,82,68,175,60,64,40,102,88,80,78,34,129,36,
+1,10,121,171,101,129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,
+36,33,92,46,103,128,132,96,43,81,66,60,134,92,19,45,37,39,48,22,165,47,60,
+84,109,191,38,93,57,44,39,25,4,63,104,70,114,69,26,94,59,112,130,111,57,85,
+54,52,50,36,60,68,216,118,98,73,62,70,62,87,0,3,0,80,254,203,9,110,6,162,
+0,87,0,99,0,103,0,0,1,20,6,35,34,39,6,6,35,34,3,6,6,35,34,0,53,52,54,54,51,
+51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,30,2,21,20,6,7,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,4,18,
+21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,
+54,1,19,35,19,9,110,181,158,205,145,36,158,117,219,150,57,238,165,231,254,
+238,120,229,156,95,100,77,37,40,84,104,254,38,15,1,124,29,112,109,181,101,
+87,74,101,63,68,20,133,138,64,88,72,109,119,8,72,151,100,105,127,222,235,
+6,168,1,2,140,1,70,148,97,105,127,222,235,6,168,1,2,140,250,80,201,172,171,
+201,198,174,176,197,3,57,70,246,68,1,164,206,240,247,116,131,1,26,133,149,
+1,31,237,147,239,139,19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,
+25,4,63,104,70,73,114,20,68,237,146,53,56,95,93,154,127,172,202,9,168,8,169,
+254,237,161,42,90,87,154,127,172,202,9,168,8,169,254,237,20,171,199,200,170,
+165,189,187,254,129,254,192,1,64,0,2,0,60,255,231,6,207,6,162,0,95,0,106,
+0,0,1,51,21,33,20,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,
+23,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,
+23,54,54,51,50,22,23,51,39,35,53,51,50,54,54,53,52,38,38,35,33,55,33,38,53,
+52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,1,38,35,34,6,21,20,22,
+51,50,54,5,193,213,254,15,48,107,23,91,21,54,77,240,126,145,201,219,186,210,
+137,32,117,95,79,105,24,75,24,114,92,90,91,58,77,111,162,125,100,166,33,27,
+136,98,109,146,20,188,15,152,159,100,77,37,40,84,104,254,38,15,1,124,29,112,
+109,181,101,87,74,101,63,68,20,133,138,64,110,106,254,44,116,188,129,133,
+121,102,104,181,2,234,88,130,129,107,164,81,71,19,72,67,99,74,152,180,170,
+124,127,149,85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,123,164,133,
+104,105,132,151,126,185,92,19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,
+44,39,25,4,63,104,70,83,121,14,253,212,75,70,58,57,71,98,0,2,0,80,255,230,
+5,94,6,162,0,86,0,98,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,
+39,51,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,51,50,
+54,53,52,38,39,35,53,51,50,54,54,53,52,38,38,35,33,55,51,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,22,22,37,20,22,51,50,54,53,52,38,
+35,34,6,5,73,96,163,96,88,163,48,52,133,84,97,160,93,172,142,17,235,16,85,
+91,136,115,111,135,10,112,133,116,184,61,64,33,141,93,117,143,123,120,141,
+119,100,77,37,40,84,104,254,238,15,180,29,112,109,181,101,87,74,101,63,68,
+24,132,135,64,106,87,106,104,252,53,75,57,62,73,73,60,60,74,1,203,137,222,
+126,113,117,122,108,120,226,153,192,1,36,48,210,203,23,128,88,117,138,128,
+106,38,33,126,197,141,158,216,112,104,142,147,135,240,66,92,19,45,37,39,48,
+22,165,47,60,84,109,191,38,93,57,44,37,27,6,61,105,69,81,120,14,80,255,140,
+67,73,75,65,64,74,72,0,3,0,80,255,230,4,67,6,162,0,46,0,58,0,70,0,0,1,20,
+0,35,34,0,53,52,54,54,51,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,
+51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,22,22,7,52,38,35,34,6,21,20,
+22,51,50,54,39,20,6,35,34,38,53,52,54,51,50,22,4,67,254,236,230,231,254,238,
+120,229,156,119,100,77,37,40,84,104,254,38,15,1,124,29,112,109,181,101,87,
+74,101,63,68,20,133,138,64,94,83,106,115,133,201,172,171,201,198,174,176,
+197,249,68,55,55,67,68,54,54,69,1,242,238,254,226,1,31,237,147,239,139,19,
+45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,25,4,63,104,70,76,116,
+20,69,234,80,171,199,200,170,165,189,187,175,52,68,68,52,52,69,69,0,2,0,80,
+255,230,5,112,6,162,0,74,0,86,0,0,1,20,6,35,32,39,6,6,35,34,38,53,52,18,36,
+51,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,
+21,20,23,30,2,21,20,6,7,22,23,7,38,35,34,6,6,21,20,22,51,50,55,51,22,22,23,
+38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,5,112,204,143,254,
+254,106,57,148,92,138,166,191,1,56,178,122,100,77,37,40,84,104,254,38,15,
+1,124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,82,61,39,34,62,161,
+172,145,253,152,107,96,175,60,64,32,132,113,96,130,105,118,145,122,74,64,
+64,76,73,67,65,73,1,67,143,206,230,130,100,203,169,203,1,52,166,19,45,37,
+39,48,22,165,47,60,84,109,191,38,93,57,44,39,25,4,63,104,70,71,111,20,20,
+23,82,102,132,240,155,101,102,216,109,101,5,53,125,96,119,149,86,62,76,73,
+57,59,78,74,255,255,0,80,254,203,5,112,6,162,2,34,1,149,0,0,0,2,2,159,224,
+0,0,2,0,75,255,230,6,82,6,162,0,101,0,113,0,0,1,20,6,6,35,34,38,53,52,54,
+51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,51,51,21,
+35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,
+22,23,54,54,55,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,
+38,35,34,6,21,20,23,30,2,21,20,6,7,22,22,1,52,38,35,34,6,21,20,22,51,50,54,
+6,64,117,182,94,141,186,147,119,104,133,34,141,180,147,107,164,22,78,25,149,
+125,114,120,134,123,62,80,122,145,131,123,124,132,44,139,132,196,243,111,
+93,84,94,204,156,130,194,53,45,179,116,59,100,77,37,40,84,104,254,38,15,1,
+124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,92,77,89,100,254,192,
+74,64,64,76,73,67,65,73,1,250,168,241,123,174,134,125,158,128,101,69,58,99,
+223,150,189,127,98,104,121,75,68,68,76,98,77,65,63,79,33,216,44,178,143,87,
+122,30,35,117,72,116,149,128,114,112,129,1,19,45,37,39,48,22,165,47,60,84,
+109,191,38,93,57,44,39,25,4,63,104,70,75,116,19,68,231,254,195,62,76,73,57,
+59,78,74,0,3,0,80,255,230,5,250,6,162,0,79,0,91,0,103,0,0,1,16,0,33,32,0,
+17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,38,
+39,22,21,20,6,35,34,38,53,52,54,55,51,50,54,54,53,52,38,38,35,33,55,33,38,
+53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,22,22,37,20,22,51,
+50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,5,250,254,128,254,
+171,254,171,254,128,234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,
+64,1,41,50,42,13,131,105,115,136,141,119,8,100,77,37,40,84,104,254,38,15,
+1,124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,73,59,90,105,251,114,
+75,57,62,73,73,60,60,74,3,114,74,60,60,73,73,62,57,75,2,45,254,236,254,205,
+1,51,1,20,199,1,11,135,115,117,138,119,98,40,41,41,123,73,173,199,199,173,
+73,123,41,41,40,98,119,138,117,113,136,1,19,45,37,39,48,22,165,47,60,84,109,
+191,38,93,57,44,39,25,4,63,104,70,66,108,24,60,209,57,67,73,75,65,64,74,72,
+66,66,72,74,64,65,75,73,0,4,0,80,254,203,5,1,6,162,0,52,0,69,0,81,0,85,0,
+0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,18,36,51,51,50,54,54,53,52,38,38,
+35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,22,
+18,7,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,54,1,20,6,35,34,38,53,52,
+54,51,50,22,3,19,35,19,5,1,172,142,91,152,43,44,153,90,143,171,161,1,18,165,
+133,100,77,37,40,84,104,254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,
+20,133,138,64,93,83,138,163,131,254,249,207,207,254,250,113,94,171,60,63,
+60,171,94,113,254,171,68,55,55,67,68,54,54,69,74,70,246,68,1,135,190,227,
+119,111,111,119,227,190,184,1,32,160,19,45,37,39,48,22,165,47,60,84,109,191,
+38,93,57,44,39,25,4,63,104,70,76,116,20,79,254,222,111,205,1,6,254,250,205,
+127,136,216,216,136,1,80,52,68,68,52,52,69,69,253,54,254,192,1,64,0,2,0,80,
+255,230,5,2,6,162,0,51,0,69,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,16,0,33,
+51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,30,2,21,20,6,7,22,18,7,52,2,35,34,6,21,20,22,51,50,55,51,22,22,51,50,
+54,5,2,159,138,115,134,55,57,148,92,144,160,1,75,1,14,132,100,77,37,40,84,
+104,254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,88,73,
+136,151,131,247,223,223,247,110,93,175,60,64,34,119,90,90,105,1,149,201,230,
+109,121,130,100,228,203,1,23,1,83,19,45,37,39,48,22,165,47,60,84,109,191,
+38,93,57,44,39,25,4,63,104,70,73,115,20,75,254,231,146,229,1,0,253,234,129,
+114,216,115,101,117,255,255,0,80,254,203,5,2,6,162,2,38,1,154,0,0,0,6,2,159,
+219,0,0,1,0,70,255,230,5,51,6,162,0,72,0,0,1,20,6,35,34,38,39,38,38,35,34,
+21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,53,52,38,38,35,35,53,
+51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,30,2,21,20,6,7,22,18,5,51,174,179,134,186,84,70,97,57,126,48,37,195,
+21,23,159,129,93,137,87,57,80,101,68,219,131,230,145,30,159,100,77,37,40,
+84,104,254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,94,
+79,157,181,1,149,197,234,152,160,132,100,185,83,179,72,10,65,158,58,150,186,
+82,116,75,83,49,245,150,219,116,92,19,45,37,39,48,22,165,47,60,84,109,191,
+38,93,57,44,39,25,4,63,104,70,77,116,18,66,254,234,0,3,0,100,255,230,5,248,
+6,162,0,36,0,67,0,79,0,0,1,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,30,2,21,20,6,6,35,35,53,51,50,54,54,53,52,38,38,1,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,0,1,52,
+38,35,34,6,21,20,22,51,50,54,2,62,254,38,15,1,123,29,112,109,181,101,87,74,
+101,63,68,24,132,136,64,76,131,147,148,159,100,77,37,40,84,3,82,165,164,108,
+167,54,26,155,104,136,163,165,132,98,141,33,75,161,100,118,126,236,233,6,
+255,1,45,253,7,97,83,81,97,92,84,86,96,4,209,165,47,60,84,109,191,38,93,57,
+44,37,27,6,61,105,69,68,109,48,92,19,45,37,39,48,22,252,231,214,252,126,88,
+104,110,169,141,136,175,97,80,116,101,130,117,191,216,10,168,7,254,193,254,
+134,81,97,96,83,77,93,88,255,255,0,100,254,203,5,248,6,162,2,38,1,157,0,0,
+0,7,2,159,0,168,0,0,0,1,0,75,255,230,5,52,6,162,0,97,0,0,1,20,6,6,35,34,38,
+39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,
+54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,
+35,53,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,
+6,21,20,23,30,2,21,20,6,7,22,18,5,33,85,144,88,99,149,56,57,148,92,134,174,
+98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,79,124,75,62,28,82,68,
+175,60,64,34,114,89,115,141,120,120,185,159,100,77,37,40,84,104,254,38,15,
+1,124,29,112,109,181,101,87,74,101,63,68,20,133,138,64,101,91,106,105,1,193,
+148,215,112,101,129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,
+36,33,92,46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,115,101,171,137,
+133,226,63,92,19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,25,4,
+63,104,70,80,118,17,81,254,250,255,255,0,75,254,203,5,52,6,162,2,38,1,159,
+0,0,0,6,2,159,229,0,0,2,0,59,255,230,7,187,6,162,0,84,0,96,0,0,1,20,6,35,
+34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,
+52,0,35,35,53,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,
+38,35,34,6,21,20,23,30,2,21,20,6,7,22,18,21,7,22,22,51,50,54,53,52,38,39,
+55,22,0,1,52,38,35,34,6,21,20,22,51,50,54,7,187,165,164,203,144,34,160,126,
+114,172,54,26,155,104,136,163,165,132,98,141,33,75,161,100,114,120,254,231,
+225,58,159,100,77,37,40,84,104,254,38,15,1,124,29,112,109,181,101,87,74,101,
+63,68,24,132,135,64,91,76,170,189,1,70,149,96,118,126,236,233,6,255,1,45,
+250,97,97,83,81,97,92,84,86,96,1,184,214,252,242,115,127,126,88,104,110,169,
+141,136,175,97,80,116,101,134,128,209,1,3,92,19,45,37,39,48,22,165,47,60,
+84,109,191,38,93,57,44,37,27,6,61,105,69,75,115,19,63,254,225,190,30,89,87,
+130,117,191,216,10,168,7,254,193,254,134,81,97,96,83,77,93,88,0,2,0,80,255,
+230,9,52,6,162,0,87,0,99,0,0,1,20,6,35,34,39,6,6,35,34,39,6,6,35,34,0,53,
+52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,33,53,51,50,54,54,
+53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,
+20,6,7,22,18,21,7,22,22,51,50,54,53,52,38,39,55,22,0,5,52,38,35,34,6,21,20,
+22,51,50,54,9,52,165,164,202,144,39,153,103,208,146,61,230,156,231,254,238,
+120,229,156,155,229,122,14,66,135,85,115,141,120,120,255,0,229,100,77,37,
+40,84,104,253,224,15,1,194,29,112,109,181,101,87,74,101,63,68,20,133,138,
+64,103,88,106,105,3,67,146,94,118,126,236,233,6,255,1,45,250,138,201,172,
+171,201,198,174,176,197,1,184,214,252,240,116,124,254,120,134,1,31,237,147,
+239,139,138,239,148,71,67,80,79,171,137,133,226,63,92,19,45,37,39,48,22,165,
+47,60,84,109,191,38,93,57,44,39,25,4,63,104,70,80,120,15,81,254,250,149,81,
+84,83,130,117,191,216,10,168,7,254,193,146,171,199,200,170,165,189,187,0,
+2,0,80,255,230,4,67,6,162,0,46,0,58,0,0,1,20,0,35,34,0,53,52,54,54,51,51,
+50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,
+23,30,2,21,20,6,7,22,22,7,52,38,35,34,6,21,20,22,51,50,54,4,67,254,236,230,
+231,254,238,120,229,156,99,100,77,37,40,84,104,253,234,15,1,184,29,112,109,
+181,101,87,74,101,63,68,20,133,138,64,89,73,108,118,133,201,172,171,201,198,
+174,176,197,1,242,238,254,226,1,31,237,147,239,139,19,45,37,39,48,22,165,
+47,60,84,109,191,38,93,57,44,39,25,4,63,104,70,74,115,19,68,236,83,171,199,
+200,170,165,189,187,0,2,0,80,255,230,5,87,6,162,0,67,0,79,0,0,1,20,6,7,22,
+21,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,51,
+50,54,53,52,39,35,53,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,23,30,2,1,20,22,51,50,54,53,52,38,35,34,6,5,49,111,
+101,142,254,215,254,249,254,223,254,182,226,182,122,144,136,115,113,133,6,
+90,1,22,251,215,246,164,172,159,100,77,37,40,84,104,254,38,15,1,124,29,112,
+109,181,101,87,74,101,63,68,20,133,138,64,252,59,75,57,62,73,73,60,60,74,
+4,132,84,121,13,154,245,254,247,254,212,1,26,1,35,212,1,8,135,115,117,138,
+133,115,25,22,95,150,178,183,200,178,212,134,92,19,45,37,39,48,22,165,47,
+60,84,109,191,38,93,57,44,39,25,4,63,104,254,32,67,73,75,65,64,74,72,0,2,
+0,75,255,230,5,64,6,162,0,66,0,78,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,
+38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,7,
+22,18,1,52,38,35,34,6,21,20,22,51,50,54,5,64,172,173,114,172,54,26,155,104,
+136,163,165,132,98,141,33,75,161,100,114,119,131,230,145,29,159,100,77,37,
+40,84,104,254,36,15,1,126,29,112,109,181,101,87,74,101,63,68,20,133,138,64,
+94,79,156,181,252,236,97,83,81,97,92,84,86,96,1,149,196,235,126,88,104,110,
+169,141,136,175,97,80,116,101,127,118,150,219,116,92,19,45,37,39,48,22,165,
+47,60,84,109,191,38,93,57,44,39,25,4,63,104,70,77,116,18,67,254,235,254,240,
+81,97,96,83,77,93,88,0,2,0,40,255,230,4,218,6,162,0,76,0,88,0,0,1,20,6,7,
+22,21,20,6,7,7,22,21,20,6,35,34,38,53,52,55,55,38,38,35,34,21,20,23,7,38,
+38,53,52,54,51,50,4,23,55,54,53,52,39,6,35,35,53,51,50,54,54,53,52,38,38,
+35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,1,7,6,6,21,20,
+22,51,50,54,53,52,4,180,45,40,16,66,72,156,98,173,149,142,190,212,211,63,
+191,111,157,22,74,45,49,134,107,137,1,18,101,154,89,8,61,117,148,159,100,
+77,37,40,84,104,254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,20,133,
+138,64,254,62,143,80,66,84,68,80,98,4,132,52,89,30,41,50,75,104,35,78,177,
+153,136,162,167,122,163,106,106,90,108,124,35,49,36,47,101,65,97,121,192,
+150,77,47,82,34,23,13,92,19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,
+44,39,25,4,63,104,253,100,71,41,74,43,56,72,85,88,93,0,3,0,100,255,230,7,
+46,6,162,0,36,0,83,0,95,0,0,1,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,
+21,20,23,30,2,21,20,6,6,35,35,53,51,50,54,54,53,52,38,38,1,6,6,35,34,38,39,
+6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,
+35,55,22,4,18,21,20,6,21,20,22,51,50,55,37,52,38,35,34,6,21,20,22,51,50,54,
+2,62,254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,24,132,135,64,76,
+131,147,148,159,100,77,37,40,84,4,136,33,92,46,71,112,24,91,166,107,161,65,
+25,155,105,136,163,165,132,103,144,31,75,156,103,102,127,100,207,151,6,168,
+1,2,140,10,65,52,60,51,252,35,97,83,81,97,92,84,86,96,4,209,165,47,60,84,
+109,191,38,93,57,44,37,27,6,61,105,69,68,109,48,92,19,45,37,39,48,22,251,
+75,26,28,76,62,138,111,106,105,112,169,141,136,175,106,86,103,99,153,118,
+98,180,115,168,8,169,254,237,161,48,73,28,54,56,37,131,81,97,96,83,77,93,
+88,0,2,0,100,255,230,5,239,6,162,0,36,0,74,0,0,1,33,55,33,38,53,52,54,51,
+50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,6,35,35,53,51,50,54,54,53,52,38,
+38,1,20,6,35,34,38,39,38,38,35,34,21,20,22,23,7,38,38,53,52,54,51,50,22,23,
+30,2,51,50,54,53,52,38,39,55,22,0,2,62,254,38,15,1,125,29,112,109,181,101,
+87,74,101,63,68,24,131,135,64,76,131,147,148,159,100,77,37,40,84,3,73,165,
+164,126,185,84,70,97,57,126,48,37,195,21,23,159,129,93,137,87,57,80,101,68,
+113,111,236,233,6,255,1,45,4,209,165,47,60,84,109,191,38,93,57,44,37,27,6,
+62,103,70,68,109,48,92,19,45,37,39,48,22,252,231,214,252,153,159,132,100,
+185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,128,119,191,216,10,168,
+7,254,193,0,4,0,100,255,230,8,78,6,162,0,36,0,84,0,96,0,108,0,0,1,33,55,33,
+38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,2,21,20,6,6,35,35,53,51,50,
+54,54,53,52,38,38,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,55,33,50,
+30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,
+2,62,254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,24,132,135,64,76,
+131,147,148,159,100,77,37,40,84,5,168,137,115,113,135,31,254,183,108,111,
+83,159,109,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,103,108,
+132,124,121,237,15,2,230,126,132,108,57,123,72,63,61,71,76,57,66,68,251,37,
+97,83,81,97,92,84,86,96,4,209,165,47,60,84,109,191,38,93,57,44,37,27,6,61,
+105,69,68,109,48,92,19,45,37,39,48,22,254,42,116,137,126,106,64,52,90,247,
+129,113,191,114,111,106,105,112,169,141,136,175,106,86,103,99,145,117,115,
+210,70,165,21,67,108,89,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,
+0,2,0,80,255,230,5,211,6,162,0,98,0,110,0,0,1,22,22,21,20,6,6,35,34,38,39,
+6,6,35,34,38,38,53,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,
+22,51,50,55,51,22,51,50,54,54,53,52,38,35,34,6,21,20,22,23,7,33,53,33,38,
+38,53,52,54,55,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,
+38,35,34,6,21,20,23,30,2,21,20,5,20,22,51,50,54,53,52,38,35,34,6,5,12,62,
+70,99,167,100,103,161,42,42,161,103,100,167,99,232,176,122,144,136,115,113,
+133,5,41,48,78,125,70,214,60,64,60,214,70,125,78,108,93,39,52,58,64,30,254,
+120,1,17,61,55,113,89,15,100,77,37,40,84,104,253,232,15,1,183,29,112,109,
+181,101,87,74,101,63,68,20,135,137,66,251,188,78,59,57,73,76,62,55,74,3,178,
+62,219,151,166,245,129,125,105,105,125,129,245,166,219,1,34,135,115,117,138,
+133,115,20,25,48,147,81,107,151,76,216,216,76,151,107,154,181,51,45,51,73,
+28,92,104,47,89,58,81,111,3,19,45,37,39,48,22,165,47,60,84,109,191,38,93,
+57,44,39,25,4,62,104,71,172,238,67,73,76,64,64,74,73,0,3,0,70,255,231,4,217,
+6,162,0,81,0,93,0,105,0,0,1,20,6,6,7,22,21,20,6,7,22,21,20,6,35,34,38,53,
+52,55,38,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,23,
+22,23,54,53,52,38,39,35,53,51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,
+51,50,23,7,38,35,34,6,21,20,23,30,2,1,20,22,51,50,54,53,52,38,35,34,6,1,52,
+38,35,34,6,21,20,22,51,50,54,4,179,60,106,101,157,151,139,39,130,107,112,
+126,41,153,185,93,166,104,108,128,121,102,101,118,6,80,126,166,176,94,236,
+61,64,125,159,100,77,37,40,84,104,254,38,15,1,124,29,112,109,181,101,87,74,
+101,63,68,20,133,138,64,252,148,64,49,53,62,62,51,51,64,1,162,71,65,68,69,
+70,66,67,70,4,132,60,101,56,6,103,182,132,157,26,58,86,96,118,109,95,65,47,
+13,191,143,100,178,107,120,102,104,123,119,102,21,21,80,86,73,109,13,14,52,
+39,230,89,122,41,92,19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,
+25,4,63,104,254,63,58,62,64,56,54,63,60,253,153,49,51,54,47,46,53,52,0,2,
+0,35,254,79,3,217,6,162,0,71,0,103,0,0,1,52,38,39,39,38,38,53,52,54,55,53,
+51,50,54,54,53,52,38,38,35,33,55,33,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,30,2,21,20,6,7,22,23,7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,
+32,3,55,22,51,50,54,19,21,34,38,39,6,6,35,34,39,6,35,34,38,53,52,55,51,22,
+22,51,50,55,51,22,51,50,54,55,51,22,22,3,25,92,109,129,192,178,175,145,159,
+100,77,37,40,84,104,254,38,15,1,124,29,112,109,181,101,87,74,101,63,68,20,
+133,138,64,70,62,74,86,96,94,175,113,126,116,117,139,123,186,148,227,183,
+254,191,170,100,156,233,127,142,192,53,91,29,13,101,70,129,65,65,129,82,106,
+6,54,12,73,64,110,33,60,33,110,64,73,12,54,23,75,1,89,65,73,9,11,16,122,127,
+100,139,13,3,19,45,37,39,48,22,165,47,60,84,109,191,38,93,57,44,39,25,4,63,
+104,70,65,107,26,35,64,111,92,91,94,71,78,70,11,10,16,157,120,147,183,1,19,
+82,133,74,254,33,166,63,60,93,90,150,150,121,125,39,47,85,73,116,116,73,85,
+61,45,0,3,0,35,253,179,4,12,5,118,0,57,0,73,0,85,0,0,1,52,38,39,39,38,38,
+53,52,54,54,55,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,
+22,23,7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,
+19,7,33,34,46,2,53,52,54,51,50,22,21,20,7,39,52,38,35,34,6,21,20,22,51,50,
+54,3,25,92,109,129,192,178,73,153,112,159,100,77,37,40,84,104,254,38,15,1,
+152,178,155,75,75,67,65,87,96,94,175,113,126,116,117,139,123,186,148,227,
+183,254,191,170,100,156,233,127,142,243,15,253,208,126,132,108,57,137,115,
+113,135,31,79,76,57,66,68,72,63,61,71,1,89,65,73,9,11,16,122,127,59,111,77,
+7,1,19,45,37,39,48,22,165,57,109,76,67,109,26,31,64,111,92,91,94,71,78,70,
+11,10,16,157,120,147,183,1,19,82,133,74,253,72,165,21,67,108,64,116,137,126,
+106,64,52,120,67,73,73,67,64,74,72,0,6,0,40,253,179,5,228,5,118,0,73,0,85,
+0,95,0,99,0,115,0,127,0,0,55,52,54,51,50,22,23,54,53,52,39,22,21,20,6,35,
+34,38,53,52,54,51,50,18,21,20,7,22,22,51,50,54,53,52,38,39,6,35,35,53,51,
+50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,21,20,6,6,35,34,
+38,39,6,6,35,34,38,1,52,38,35,34,6,21,20,22,51,50,54,1,20,51,50,55,38,38,
+35,34,6,1,51,19,35,5,7,33,34,46,2,53,52,54,51,50,22,21,20,7,39,52,38,35,34,
+6,21,20,22,51,50,54,60,140,136,84,155,102,73,90,6,133,113,115,136,145,121,
+181,227,57,72,117,67,138,144,122,122,55,66,218,229,100,77,37,40,84,104,253,
+224,15,1,222,178,155,75,73,55,118,116,100,165,97,70,138,127,64,184,108,142,
+164,1,243,74,55,62,76,73,57,59,78,254,140,182,137,96,72,124,81,64,74,1,235,
+108,70,246,3,130,15,251,250,126,132,108,57,137,115,113,135,31,79,76,57,66,
+68,72,63,61,71,211,111,124,61,60,101,143,150,95,22,25,115,133,138,117,115,
+135,254,249,213,153,131,37,26,173,157,133,211,61,5,92,19,45,37,39,48,22,165,
+57,109,76,67,108,21,78,254,246,156,150,220,115,73,104,86,91,127,2,133,65,
+73,74,64,64,76,73,254,102,89,69,55,48,43,254,213,254,192,115,165,21,67,108,
+64,116,137,126,106,64,52,120,67,73,73,67,64,74,72,0,3,0,85,253,179,4,94,5,
+118,0,42,0,58,0,70,0,0,1,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,22,21,
+20,7,39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,16,0,51,51,50,54,54,19,
+7,33,34,46,2,53,52,54,51,50,22,21,20,7,39,52,38,35,34,6,21,20,22,51,50,54,
+3,148,40,84,104,254,38,15,1,152,178,155,75,103,87,104,115,87,215,70,75,177,
+160,159,178,74,70,217,85,1,18,222,121,100,77,37,202,15,253,208,126,132,108,
+57,137,115,113,135,31,79,76,57,66,68,72,63,61,71,4,100,39,48,22,165,57,109,
+76,80,120,14,72,255,169,206,250,10,146,251,148,184,202,199,182,147,254,254,
+145,11,235,226,1,2,1,59,19,45,250,25,165,21,67,108,64,116,137,126,106,64,
+52,120,67,73,73,67,64,74,72,0,6,0,100,253,179,8,157,5,118,0,21,0,73,0,85,
+0,89,0,105,0,117,0,0,1,33,55,33,50,22,22,21,20,6,6,35,35,53,51,50,54,54,53,
+52,38,38,1,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,
+22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,
+22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,23,19,35,19,3,33,7,33,34,46,2,53,
+52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,2,62,254,38,15,1,
+152,178,155,75,76,131,147,148,159,100,77,37,40,84,5,247,181,158,201,143,36,
+157,115,108,167,54,26,155,104,136,163,165,132,98,141,33,75,161,100,105,127,
+222,235,6,168,1,2,140,2,68,146,93,105,127,222,235,6,168,1,2,140,250,113,97,
+83,81,97,92,84,86,96,174,70,246,68,169,3,231,15,251,250,126,132,108,57,137,
+115,113,135,110,76,57,66,68,72,63,61,71,4,209,165,57,109,76,68,109,48,92,
+19,45,37,39,48,22,252,211,206,240,237,111,126,126,88,104,110,169,141,136,
+175,97,80,116,101,154,127,172,202,9,168,8,169,254,237,161,53,84,82,154,127,
+172,202,9,168,8,169,254,237,252,81,97,96,83,77,93,88,235,254,192,1,64,254,
+77,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,3,0,52,253,
+179,4,209,5,118,0,88,0,104,0,116,0,0,19,52,54,51,50,22,21,20,7,51,39,35,53,
+51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,6,7,7,51,21,33,6,7,14,
+2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,21,20,6,35,34,38,39,
+6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,1,33,7,33,
+34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,65,156,
+125,122,165,4,179,15,107,159,100,77,37,40,84,104,254,38,15,1,152,178,155,
+75,60,106,96,15,219,253,226,42,116,75,62,28,82,68,175,60,64,40,104,90,80,
+82,33,120,36,148,120,101,139,43,57,148,92,134,174,98,138,87,67,68,59,59,75,
+22,74,41,48,1,200,2,167,15,253,58,126,132,108,57,137,115,113,135,110,76,57,
+66,68,72,63,61,71,3,24,103,128,132,96,29,20,185,92,19,45,37,39,48,22,165,
+57,109,76,60,100,58,5,187,88,54,83,54,52,50,36,60,68,216,118,98,97,76,80,
+80,106,116,151,187,102,128,130,100,147,111,88,134,99,61,88,47,50,70,71,57,
+48,36,36,33,92,251,110,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,
+64,74,72,0,3,0,65,253,179,5,35,5,118,0,60,0,76,0,88,0,0,1,35,53,33,23,6,6,
+21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,
+38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,
+38,53,52,1,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,
+22,51,50,54,1,38,229,1,102,30,92,88,91,83,175,60,64,34,119,90,88,107,131,
+230,145,30,159,100,77,37,40,84,104,254,38,15,1,152,178,155,75,94,79,157,181,
+165,132,115,134,55,57,148,92,124,163,1,148,2,167,15,253,58,126,132,108,57,
+137,115,113,135,110,76,57,66,68,72,63,61,71,2,35,104,92,51,102,68,61,76,216,
+115,101,122,123,150,219,116,92,19,45,37,39,48,22,165,57,109,76,77,116,18,
+66,254,234,196,192,239,109,121,130,100,156,122,191,252,157,165,21,67,108,
+64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,4,0,31,253,179,5,35,5,118,
+0,60,0,64,0,80,0,92,0,0,1,20,6,35,34,38,39,6,6,35,34,38,53,52,55,35,53,33,
+23,6,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,
+54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,1,19,35,19,3,33,7,33,
+34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,5,35,165,
+132,115,134,55,57,148,92,124,163,164,229,1,102,30,92,88,91,83,175,60,64,34,
+119,90,88,107,131,230,145,30,159,100,77,37,40,84,104,254,38,15,1,152,178,
+155,75,94,79,157,181,253,226,70,246,68,165,2,167,15,253,58,126,132,108,57,
+137,115,113,135,110,76,57,66,68,72,63,61,71,1,149,192,239,109,121,130,100,
+156,122,191,104,104,92,51,102,68,61,76,216,115,101,122,123,150,219,116,92,
+19,45,37,39,48,22,165,57,109,76,77,116,18,66,254,234,253,178,254,192,1,64,
+254,77,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,3,0,
+52,253,179,4,219,5,118,0,94,0,110,0,122,0,0,19,52,54,51,50,22,21,7,22,51,
+50,54,53,52,35,35,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,7,
+22,22,21,20,6,35,34,39,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,
+39,51,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,
+6,21,20,23,7,38,38,1,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,
+34,6,21,20,22,51,50,54,75,156,125,122,165,3,108,136,75,82,159,185,159,100,
+77,37,40,84,104,254,38,15,1,152,178,155,75,103,51,52,154,132,168,143,42,120,
+75,62,28,82,68,175,60,64,40,102,88,80,78,34,129,36,162,116,99,131,43,57,148,
+92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,1,190,2,167,15,253,58,126,
+132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,3,24,103,128,132,96,
+43,81,66,60,134,92,19,45,37,39,48,22,165,57,109,76,114,69,26,94,59,112,130,
+111,57,85,54,52,50,36,60,68,216,118,98,73,62,70,62,87,115,121,171,101,129,
+130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,251,110,165,
+21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,5,0,52,253,179,
+9,110,5,118,0,72,0,84,0,88,0,104,0,116,0,0,1,20,6,35,34,39,6,6,35,34,3,6,
+6,35,34,0,53,52,54,54,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,
+20,6,7,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,
+50,54,53,52,38,39,55,22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,1,19,35,19,
+1,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,
+54,9,110,181,158,205,145,36,158,117,219,150,57,238,165,231,254,238,120,229,
+156,95,100,77,37,40,84,104,254,38,15,1,152,178,155,75,88,72,109,119,8,72,
+151,100,105,127,222,235,6,168,1,2,140,1,70,148,97,105,127,222,235,6,168,1,
+2,140,250,80,201,172,171,201,198,174,176,197,3,57,70,246,68,251,126,3,231,
+15,251,250,126,132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,1,164,
+206,240,247,116,131,1,26,133,149,1,31,237,147,239,139,19,45,37,39,48,22,165,
+57,109,76,73,114,20,68,237,146,53,56,95,93,154,127,172,202,9,168,8,169,254,
+237,161,42,90,87,154,127,172,202,9,168,8,169,254,237,20,171,199,200,170,165,
+189,187,254,129,254,192,1,64,254,77,165,21,67,108,64,116,137,126,106,64,68,
+67,73,73,67,64,74,72,0,4,0,30,253,179,6,169,5,118,0,80,0,91,0,107,0,119,0,
+0,1,51,21,33,20,7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,
+54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,
+54,54,51,50,22,23,51,39,35,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,
+21,20,6,7,1,38,35,34,6,21,20,22,51,50,54,1,33,7,33,34,46,2,53,52,54,51,50,
+22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,5,193,213,254,15,48,107,23,91,
+21,54,77,240,126,145,201,219,186,210,137,32,117,95,79,105,24,75,24,114,92,
+90,91,58,77,111,162,125,100,166,33,27,136,98,109,146,20,188,15,152,159,100,
+77,37,40,84,104,254,38,15,1,152,178,155,75,110,106,254,44,116,188,129,133,
+121,102,104,181,254,48,3,231,15,251,250,126,132,108,57,137,115,113,135,110,
+76,57,66,68,72,63,61,71,2,234,88,130,129,107,164,81,71,19,72,67,99,74,152,
+180,170,124,127,149,85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,123,
+164,133,104,105,132,151,126,185,92,19,45,37,39,48,22,165,57,109,76,83,121,
+14,253,212,75,70,58,57,71,98,253,45,165,21,67,108,64,116,137,126,106,64,68,
+67,73,73,67,64,74,72,0,4,0,50,253,179,5,73,5,118,0,71,0,83,0,99,0,111,0,0,
+1,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,55,39,51,7,22,22,21,20,6,35,
+34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,35,53,51,
+50,54,54,53,52,38,38,35,33,55,51,50,22,22,21,20,6,7,22,22,37,20,22,51,50,
+54,53,52,38,35,34,6,19,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,
+34,6,21,20,22,51,50,54,5,73,96,163,96,88,163,48,52,133,84,97,160,93,172,142,
+17,235,16,85,91,136,115,111,135,10,112,133,116,184,61,64,33,141,93,117,143,
+123,120,142,119,100,77,37,40,84,104,254,238,15,208,178,155,75,104,88,106,
+104,252,53,75,57,62,73,73,60,60,74,137,2,167,15,253,58,126,132,108,57,137,
+115,113,135,110,76,57,66,68,72,63,61,71,1,203,137,222,126,113,117,122,108,
+120,226,153,192,1,36,48,210,203,23,128,88,117,138,128,106,38,33,126,197,141,
+158,216,112,104,142,147,135,240,66,92,19,45,37,39,48,22,165,57,109,76,81,
+119,15,80,255,140,67,73,75,65,64,74,72,251,44,165,21,67,108,64,116,137,126,
+106,64,68,67,73,73,67,64,74,72,0,5,0,68,253,179,4,67,5,118,0,31,0,43,0,55,
+0,71,0,83,0,0,1,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,22,21,20,0,35,
+34,0,53,52,54,54,51,51,50,54,54,5,34,6,21,20,22,51,50,54,53,52,38,3,20,6,
+35,34,38,53,52,54,51,50,22,3,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,
+38,35,34,6,21,20,22,51,50,54,3,150,40,84,104,254,38,15,1,152,178,155,75,94,
+83,106,115,254,236,230,231,254,238,120,229,156,119,100,77,37,254,179,171,
+201,198,174,176,197,201,48,68,55,55,67,68,54,54,69,172,2,17,15,253,208,126,
+132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,4,100,39,48,22,165,
+57,109,76,76,116,20,69,234,143,238,254,226,1,31,237,147,239,139,19,45,156,
+200,170,165,189,187,167,171,199,254,150,52,68,68,52,52,69,69,251,235,165,
+21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,4,0,68,253,179,
+5,112,5,118,0,59,0,71,0,87,0,99,0,0,1,20,6,35,32,39,6,6,35,34,38,53,52,18,
+36,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,23,7,38,35,
+34,6,6,21,20,22,51,50,55,51,22,22,23,38,53,52,54,51,50,22,7,52,38,35,34,6,
+21,20,22,51,50,54,1,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,
+6,21,20,22,51,50,54,5,112,204,143,254,254,106,57,148,92,138,166,191,1,56,
+178,123,100,77,37,40,84,104,254,38,15,1,152,178,155,75,83,61,39,34,62,161,
+172,145,253,152,107,96,175,60,64,32,132,113,96,130,105,118,145,122,74,64,
+64,76,73,67,65,73,253,35,2,167,15,253,58,126,132,108,57,137,115,113,135,110,
+76,57,66,68,72,63,61,71,1,67,143,206,230,130,100,203,169,203,1,52,166,19,
+45,37,39,48,22,165,57,109,76,71,112,19,20,23,82,102,132,240,155,101,102,216,
+109,101,5,53,125,96,119,149,86,62,76,73,57,59,78,74,253,39,165,21,67,108,
+64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,5,0,4,253,179,5,112,5,118,
+0,59,0,71,0,75,0,91,0,103,0,0,1,20,6,35,32,39,6,6,35,34,38,53,52,18,36,51,
+51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,23,7,38,35,34,6,
+6,21,20,22,51,50,55,51,22,22,23,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,
+22,51,50,54,1,19,35,19,3,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,
+35,34,6,21,20,22,51,50,54,5,112,204,143,254,254,106,57,148,92,138,166,191,
+1,56,178,123,100,77,37,40,84,104,254,38,15,1,152,178,155,75,83,61,39,34,62,
+161,172,145,253,152,107,96,175,60,64,32,132,113,96,130,105,118,145,122,74,
+64,64,76,73,67,65,73,253,240,70,246,68,161,2,167,15,253,58,126,132,108,57,
+137,115,113,135,110,76,57,66,68,72,63,61,71,1,67,143,206,230,130,100,203,
+169,203,1,52,166,19,45,37,39,48,22,165,57,109,76,71,112,19,20,23,82,102,132,
+240,155,101,102,216,109,101,5,53,125,96,119,149,86,62,76,73,57,59,78,74,254,
+218,254,192,1,64,254,77,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,
+64,74,72,0,4,0,75,253,179,6,64,5,118,0,86,0,98,0,114,0,126,0,0,1,20,6,6,35,
+34,38,53,52,54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,
+20,22,51,51,21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,
+53,52,54,51,50,22,23,54,54,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,
+21,20,6,7,22,22,1,52,38,35,34,6,21,20,22,51,50,54,1,33,7,33,34,46,2,53,52,
+54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,6,64,117,182,94,141,
+186,147,119,104,133,34,141,180,147,107,164,22,78,25,149,125,114,120,134,123,
+62,80,122,145,131,123,124,132,44,139,132,196,243,111,93,84,94,204,156,130,
+194,53,45,182,118,54,100,77,37,40,84,104,254,38,15,1,152,178,155,75,92,77,
+89,100,254,192,74,64,64,76,73,67,65,73,253,190,2,167,15,253,58,126,132,108,
+57,137,115,113,135,110,76,57,66,68,72,63,61,71,1,250,168,241,123,174,134,
+125,158,128,101,69,58,99,223,150,189,127,98,104,121,75,68,68,76,98,77,65,
+63,79,33,216,44,178,143,87,122,30,35,117,72,116,149,128,114,113,129,19,45,
+37,39,48,22,165,57,109,76,75,116,19,68,231,254,195,62,76,73,57,59,78,74,253,
+69,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,5,0,80,253,
+179,5,250,5,118,0,64,0,76,0,88,0,104,0,116,0,0,1,16,0,33,32,0,17,52,18,51,
+50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,38,39,22,21,20,
+6,35,34,38,53,52,54,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,
+6,7,22,22,37,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,
+50,54,1,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,
+51,50,54,5,250,254,128,254,171,254,171,254,128,234,174,122,144,136,115,106,
+130,13,42,50,1,41,1,64,1,64,1,41,50,42,13,131,105,115,136,143,120,5,100,77,
+37,40,84,104,254,38,15,1,152,178,155,75,73,59,90,105,251,114,75,57,62,73,
+73,60,60,74,3,114,74,60,60,73,73,62,57,75,253,193,2,167,15,253,58,126,132,
+108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,2,45,254,236,254,205,1,
+51,1,20,199,1,11,135,115,117,138,119,98,40,41,41,123,73,173,199,199,173,73,
+123,41,41,40,98,119,138,117,114,136,19,45,37,39,48,22,165,57,109,76,66,108,
+24,60,209,57,67,73,75,65,64,74,72,66,66,72,74,64,65,75,73,251,177,165,21,
+67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,6,255,246,253,179,
+5,1,5,118,0,37,0,54,0,66,0,70,0,86,0,98,0,0,1,20,6,35,34,38,39,6,6,35,34,
+38,53,52,18,36,51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,
+22,18,7,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,54,1,20,6,35,34,38,53,
+52,54,51,50,22,3,19,35,19,3,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,
+38,35,34,6,21,20,22,51,50,54,5,1,172,142,91,152,43,44,153,90,143,171,161,
+1,18,165,133,100,77,37,40,84,104,254,38,15,1,152,178,155,75,93,83,138,163,
+131,254,249,207,207,254,250,113,94,171,60,63,60,171,94,113,254,171,68,55,
+55,67,68,54,54,69,74,70,246,68,168,2,167,15,253,58,126,132,108,57,137,115,
+113,135,110,76,57,66,68,72,63,61,71,1,135,190,227,119,111,111,119,227,190,
+184,1,32,160,19,45,37,39,48,22,165,57,109,76,76,116,20,79,254,222,111,205,
+1,6,254,250,205,127,136,216,216,136,1,80,52,68,68,52,52,69,69,253,54,254,
+192,1,64,254,77,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,
+72,0,4,0,71,253,179,5,2,5,118,0,36,0,54,0,70,0,82,0,0,19,16,0,33,51,50,54,
+54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,21,20,6,35,34,38,39,6,
+6,35,34,38,55,20,22,51,50,55,51,22,22,51,50,54,53,52,2,35,34,6,1,33,7,33,
+34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,80,1,75,
+1,14,129,100,77,37,40,84,104,254,38,15,1,152,178,155,75,87,72,137,151,159,
+138,115,134,55,57,148,92,144,160,131,110,93,175,60,64,34,119,90,90,105,247,
+223,223,247,1,73,2,167,15,253,58,126,132,108,57,137,115,113,135,110,76,57,
+66,68,72,63,61,71,1,149,1,23,1,83,19,45,37,39,48,22,165,57,109,76,73,114,
+20,75,254,231,188,201,230,109,121,130,100,228,242,129,114,216,115,101,117,
+128,229,1,0,253,251,178,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,
+64,74,72,0,5,255,252,253,179,5,1,5,118,0,37,0,54,0,58,0,74,0,86,0,0,1,20,
+6,35,34,38,39,6,6,35,34,38,53,52,18,36,51,51,50,54,54,53,52,38,38,35,33,55,
+33,50,22,22,21,20,6,7,22,18,7,52,0,35,34,0,21,20,22,51,50,55,51,22,51,50,
+54,1,19,35,19,3,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,
+21,20,22,51,50,54,5,1,172,142,91,152,43,44,153,90,143,171,161,1,18,165,133,
+100,77,37,40,84,104,254,38,15,1,152,178,155,75,93,83,138,163,131,254,249,
+207,207,254,250,113,94,171,60,63,60,171,94,113,254,97,70,246,68,162,2,167,
+15,253,58,126,132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,1,135,
+190,227,119,111,111,119,227,190,184,1,32,160,19,45,37,39,48,22,165,57,109,
+76,76,116,20,79,254,222,111,205,1,6,254,250,205,127,136,216,216,136,254,186,
+254,192,1,64,254,77,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,
+74,72,0,3,0,70,253,179,5,51,5,118,0,57,0,73,0,85,0,0,23,38,38,53,52,54,51,
+50,22,23,30,2,51,50,53,52,38,38,35,35,53,51,50,54,54,53,52,38,38,35,33,55,
+33,50,22,22,21,20,6,7,22,18,21,20,6,35,34,38,39,38,38,35,34,21,20,22,23,1,
+33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,
+114,21,23,159,129,93,137,87,57,80,101,68,219,131,230,145,30,159,100,77,37,
+40,84,104,254,38,15,1,152,178,155,75,94,79,157,181,174,179,134,186,84,70,
+97,57,126,48,37,1,11,2,207,15,253,18,126,132,108,57,137,115,113,135,110,76,
+57,66,68,72,63,61,71,11,65,158,58,150,186,82,116,75,83,49,245,150,219,116,
+92,19,45,37,39,48,22,165,57,109,76,77,116,18,66,254,234,196,197,234,152,160,
+132,100,185,83,179,72,254,89,165,21,67,108,64,116,137,126,106,64,68,67,73,
+73,67,64,74,72,0,5,0,100,253,179,5,248,5,118,0,21,0,52,0,64,0,80,0,92,0,0,
+1,33,55,33,50,22,22,21,20,6,6,35,35,53,51,50,54,54,53,52,38,38,1,52,54,51,
+50,22,23,22,22,51,50,54,53,52,38,39,55,22,0,17,20,6,35,34,38,39,6,6,35,34,
+38,55,20,22,51,50,54,53,52,38,35,34,6,1,33,7,33,34,46,2,53,52,54,51,50,22,
+21,20,39,52,38,35,34,6,21,20,22,51,50,54,2,62,254,38,15,1,152,178,155,75,
+76,131,147,148,159,100,77,37,40,84,254,120,165,132,98,141,33,75,161,100,118,
+126,236,233,6,255,1,45,165,164,108,167,54,26,155,104,136,163,123,92,84,86,
+96,97,83,81,97,1,117,2,207,15,253,18,126,132,108,57,137,115,113,135,110,76,
+57,66,68,72,63,61,71,4,209,165,57,109,76,68,109,48,92,19,45,37,39,48,22,252,
+75,136,175,97,80,116,101,130,117,191,216,10,168,7,254,193,254,245,214,252,
+126,88,104,110,169,185,77,93,88,83,81,97,96,252,189,165,21,67,108,64,116,
+137,126,106,64,68,67,73,73,67,64,74,72,0,6,0,100,253,179,5,248,5,118,0,21,
+0,52,0,64,0,68,0,84,0,96,0,0,1,33,55,33,50,22,22,21,20,6,6,35,35,53,51,50,
+54,54,53,52,38,38,1,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,
+22,51,50,54,53,52,38,39,55,22,0,1,52,38,35,34,6,21,20,22,51,50,54,23,19,35,
+19,3,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,
+50,54,2,62,254,38,15,1,152,178,155,75,76,131,147,148,159,100,77,37,40,84,
+3,82,165,164,108,167,54,26,155,104,136,163,165,132,98,141,33,75,161,100,118,
+126,236,233,6,255,1,45,253,7,97,83,81,97,92,84,86,96,171,70,246,68,143,2,
+207,15,253,18,126,132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,
+4,209,165,57,109,76,68,109,48,92,19,45,37,39,48,22,252,231,214,252,126,88,
+104,110,169,141,136,175,97,80,116,101,130,117,191,216,10,168,7,254,193,254,
+134,81,97,96,83,77,93,88,235,254,192,1,64,254,77,165,21,67,108,64,116,137,
+126,106,64,68,67,73,73,67,64,74,72,0,3,0,75,253,179,5,33,5,118,0,82,0,98,
+0,110,0,0,1,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,
+2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,35,53,51,50,54,54,53,52,
+38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,21,20,6,6,35,34,38,39,6,6,35,34,
+38,53,52,54,55,54,54,19,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,
+35,34,6,21,20,22,51,50,54,1,221,68,59,59,75,22,74,41,48,156,125,122,165,79,
+124,75,62,28,82,68,175,60,64,34,114,89,115,141,120,120,185,159,100,77,37,
+40,84,104,254,38,15,1,152,178,155,75,101,91,106,105,85,144,88,99,149,56,57,
+148,92,134,174,98,138,87,67,112,2,167,15,253,58,126,132,108,57,137,115,113,
+135,110,76,57,66,68,72,63,61,71,2,237,50,70,71,57,48,36,36,33,92,46,103,128,
+134,97,72,108,91,54,52,50,36,60,68,216,115,101,171,137,133,226,63,92,19,45,
+37,39,48,22,165,57,109,76,80,118,17,81,254,250,149,148,215,112,101,129,130,
+100,147,111,88,134,99,61,88,251,154,165,21,67,108,64,116,137,126,106,64,68,
+67,73,73,67,64,74,72,0,4,0,6,253,179,5,33,5,118,0,82,0,86,0,102,0,114,0,0,
+1,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,
+23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,
+50,54,53,52,38,39,35,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,
+6,7,22,18,1,19,35,19,3,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,
+34,6,21,20,22,51,50,54,5,33,85,144,88,99,149,56,57,148,92,134,174,98,138,
+87,67,68,59,59,75,22,74,41,48,156,125,122,165,79,124,75,62,28,82,68,175,60,
+64,34,114,89,115,141,120,120,185,159,100,77,37,40,84,104,254,38,15,1,152,
+178,155,75,101,91,106,105,253,201,70,246,68,163,2,167,15,253,58,126,132,108,
+57,137,115,113,135,110,76,57,66,68,72,63,61,71,1,193,148,215,112,101,129,
+130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,
+134,97,72,108,91,54,52,50,36,60,68,216,115,101,171,137,133,226,63,92,19,45,
+37,39,48,22,165,57,109,76,80,118,17,81,254,250,253,181,254,192,1,64,254,77,
+165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,4,0,75,253,
+179,7,203,5,118,0,69,0,81,0,97,0,109,0,0,1,20,6,35,34,39,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,0,35,35,53,33,50,54,
+54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,21,7,22,22,51,50,54,53,
+52,38,39,55,22,0,1,52,38,35,34,6,21,20,22,51,50,54,19,33,7,33,34,46,2,53,
+52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,7,203,165,164,203,
+144,34,160,126,114,172,54,26,155,104,136,163,165,132,98,141,33,75,161,100,
+114,120,254,231,225,178,1,23,93,77,44,42,84,102,253,174,15,2,16,177,155,76,
+91,76,170,189,1,70,149,96,118,126,236,233,6,255,1,45,250,97,97,83,81,97,92,
+84,86,96,214,3,231,15,251,250,126,132,108,57,137,115,113,135,110,76,57,66,
+68,72,63,61,71,1,184,214,252,242,115,127,126,88,104,110,169,141,136,175,97,
+80,116,101,134,128,209,1,3,92,13,50,40,38,48,21,165,57,107,76,77,115,19,63,
+254,225,190,30,89,87,130,117,191,216,10,168,7,254,193,254,134,81,97,96,83,
+77,93,88,253,98,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,
+72,0,4,0,80,253,179,9,52,5,118,0,72,0,84,0,100,0,112,0,0,1,20,6,35,34,39,
+6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,22,22,51,50,54,53,
+52,38,39,33,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,
+18,21,7,22,22,51,50,54,53,52,38,39,55,22,0,5,52,38,35,34,6,21,20,22,51,50,
+54,3,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,
+50,54,9,52,165,164,202,144,39,153,103,208,146,61,230,156,231,254,238,120,
+229,156,155,229,122,14,66,135,85,115,141,120,120,255,0,229,100,77,37,40,84,
+104,253,224,15,1,222,178,155,75,103,88,106,105,3,67,146,94,118,126,236,233,
+6,255,1,45,250,138,201,172,171,201,198,174,176,197,157,3,231,15,251,250,126,
+132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,1,184,214,252,240,
+116,124,254,120,134,1,31,237,147,239,139,138,239,148,71,67,80,79,171,137,
+133,226,63,92,19,45,37,39,48,22,165,57,109,76,80,120,15,81,254,250,149,81,
+84,83,130,117,191,216,10,168,7,254,193,146,171,199,200,170,165,189,187,252,
+206,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,4,0,50,
+253,179,4,67,5,118,0,31,0,43,0,59,0,71,0,0,1,52,38,38,35,33,55,33,50,22,22,
+21,20,6,7,22,22,21,20,0,35,34,0,53,52,54,54,51,51,50,54,54,5,34,6,21,20,22,
+51,50,54,53,52,38,3,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,
+6,21,20,22,51,50,54,3,131,40,84,104,253,232,15,1,214,178,155,75,84,77,107,
+117,254,236,230,231,254,238,120,229,156,100,100,77,37,254,198,171,201,198,
+174,176,197,201,238,2,17,15,253,208,126,132,108,57,137,115,113,135,110,76,
+57,66,68,72,63,61,71,4,100,39,48,22,165,57,109,76,85,107,17,69,235,145,238,
+254,226,1,31,237,147,239,139,19,45,156,200,170,165,189,187,167,171,199,250,
+181,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,4,0,80,
+253,179,5,49,5,118,0,52,0,64,0,80,0,92,0,0,19,52,18,51,50,22,21,20,6,35,34,
+38,53,52,55,6,21,20,4,51,50,54,53,52,39,35,53,51,50,54,54,53,52,38,38,35,
+33,55,33,50,22,22,21,20,6,7,22,21,16,0,33,32,0,1,20,22,51,50,54,53,52,38,
+35,34,6,19,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,
+22,51,50,54,80,226,182,122,144,136,115,113,133,6,90,1,22,251,215,246,164,
+172,159,100,77,37,40,84,104,254,38,15,1,152,178,155,75,111,101,142,254,215,
+254,249,254,223,254,182,1,28,75,57,62,73,73,60,60,74,216,2,207,15,253,18,
+126,132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,2,35,212,1,8,135,
+115,117,138,133,115,25,22,95,150,178,183,200,178,212,134,92,19,45,37,39,48,
+22,165,57,109,76,84,121,13,154,245,254,247,254,212,1,26,1,234,67,73,75,65,
+64,74,72,251,44,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,
+72,0,4,0,75,253,179,5,64,5,118,0,51,0,63,0,79,0,91,0,0,19,52,54,51,50,22,
+23,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,38,35,33,55,33,
+50,22,22,21,20,6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,38,55,20,22,51,50,
+54,53,52,38,35,34,6,1,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,
+34,6,21,20,22,51,50,54,75,165,132,98,141,33,75,161,100,114,119,131,230,145,
+30,159,100,77,37,40,84,104,254,38,15,1,152,178,155,75,94,79,157,181,172,173,
+114,172,54,26,155,104,136,163,123,92,84,86,96,97,83,81,97,1,131,2,207,15,
+253,18,126,132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,1,28,136,
+175,97,80,116,101,127,118,150,219,116,92,19,45,37,39,48,22,165,57,109,76,
+77,116,18,66,254,234,196,196,235,126,88,104,110,169,185,77,93,88,83,81,97,
+96,252,189,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,
+4,0,40,253,179,4,180,5,118,0,61,0,73,0,89,0,101,0,0,1,22,21,20,6,7,7,22,21,
+20,6,35,34,38,53,52,55,55,38,38,35,34,21,20,23,7,38,38,53,52,54,51,50,4,23,
+55,54,53,52,39,6,35,35,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,
+20,6,1,7,6,6,21,20,22,51,50,54,53,52,3,33,7,33,34,46,2,53,52,54,51,50,22,
+21,20,39,52,38,35,34,6,21,20,22,51,50,54,4,95,16,66,72,156,98,173,149,142,
+190,212,211,63,191,111,157,22,74,45,49,134,107,137,1,18,101,154,89,8,61,117,
+148,159,100,77,37,40,84,104,254,38,15,1,152,178,155,75,45,254,107,143,80,
+66,84,68,80,98,203,2,17,15,253,208,126,132,108,57,137,115,113,135,110,76,
+57,66,68,72,63,61,71,3,217,41,50,75,104,35,78,177,153,136,162,167,122,163,
+106,106,90,108,124,35,49,36,47,101,65,97,121,192,150,77,47,82,34,23,13,92,
+19,45,37,39,48,22,165,57,109,76,52,89,254,55,71,41,74,43,56,72,85,88,93,252,
+133,165,21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,5,0,100,
+253,179,7,47,5,118,0,21,0,68,0,80,0,96,0,108,0,0,1,33,55,33,50,22,22,21,20,
+6,6,35,35,53,51,50,54,54,53,52,38,38,1,6,6,35,34,38,39,6,35,34,38,39,6,6,
+35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,38,35,55,22,4,18,21,
+7,6,21,20,22,51,50,55,37,52,38,35,34,6,21,20,22,51,50,54,3,33,7,33,34,46,
+2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,2,62,254,38,
+15,1,152,178,155,75,76,131,147,148,159,100,77,37,40,84,4,137,33,92,46,71,
+112,24,91,166,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,103,
+102,127,100,207,151,6,168,1,2,140,5,5,65,52,60,51,252,35,97,83,81,97,92,84,
+86,96,22,2,207,15,253,18,126,132,108,57,137,115,113,135,110,76,57,66,68,72,
+63,61,71,4,209,165,57,109,76,68,109,48,92,19,45,37,39,48,22,251,75,26,28,
+76,62,138,111,106,105,112,169,141,136,175,106,86,103,99,153,118,98,180,115,
+168,8,169,254,237,161,81,40,28,54,56,37,131,81,97,96,83,77,93,88,253,98,165,
+21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,4,0,100,253,179,
+5,239,5,118,0,21,0,59,0,75,0,87,0,0,1,33,55,33,50,22,22,21,20,6,6,35,35,53,
+51,50,54,54,53,52,38,38,1,55,22,0,17,20,6,35,34,38,39,38,38,35,34,21,20,22,
+23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,54,53,52,38,1,33,7,33,34,46,2,
+53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,2,62,254,38,15,
+1,152,178,155,75,76,131,147,148,159,100,77,37,40,84,1,23,6,255,1,45,165,164,
+126,185,84,70,97,57,126,48,37,195,21,23,159,129,93,137,87,57,80,101,68,113,
+111,236,254,76,2,207,15,253,18,126,132,108,57,137,115,113,135,110,76,57,66,
+68,72,63,61,71,4,209,165,57,109,76,68,109,48,92,19,45,37,39,48,22,254,144,
+168,7,254,193,254,245,214,252,153,159,132,100,185,83,179,72,10,65,158,58,
+150,186,82,116,75,83,49,128,119,191,216,251,1,165,21,67,108,64,116,137,126,
+106,64,68,67,73,73,67,64,74,72,0,6,0,100,253,179,8,85,5,118,0,21,0,69,0,81,
+0,93,0,109,0,121,0,0,1,33,55,33,50,22,22,21,20,6,6,35,35,53,51,50,54,54,53,
+52,38,38,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,6,6,35,34,
+38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,52,
+38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,19,33,7,33,
+34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,6,21,20,22,51,50,54,2,62,254,
+38,15,1,152,178,155,75,76,131,147,148,159,100,77,37,40,84,5,175,137,115,113,
+135,31,254,183,108,111,83,159,109,107,161,65,25,155,105,136,163,165,132,103,
+144,31,75,156,103,108,132,124,121,237,15,2,230,126,132,108,57,123,72,63,61,
+71,76,57,66,68,251,37,97,83,81,97,92,84,86,96,178,3,231,15,251,250,126,132,
+108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,4,209,165,57,109,76,68,
+109,48,92,19,45,37,39,48,22,254,42,116,137,126,106,64,52,90,247,129,113,191,
+114,111,106,105,112,169,141,136,175,106,86,103,99,145,117,115,210,70,165,
+21,67,108,89,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,253,98,165,
+21,67,108,64,116,137,126,106,64,68,67,73,73,67,64,74,72,0,4,0,80,253,179,
+5,176,5,118,0,83,0,95,0,111,0,123,0,0,1,20,6,6,35,34,38,39,6,6,35,34,38,38,
+53,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,22,51,50,55,51,22,
+51,50,54,54,53,52,38,35,34,6,21,20,22,23,7,33,53,33,38,38,53,52,54,51,51,
+50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,7,22,22,37,20,22,51,50,54,
+53,52,38,35,34,6,1,33,7,33,34,46,2,53,52,54,51,50,22,21,20,39,52,38,35,34,
+6,21,20,22,51,50,54,5,144,99,167,100,103,161,42,42,161,103,100,167,99,232,
+176,122,144,136,115,113,133,5,41,48,78,125,70,214,60,64,60,214,70,125,78,
+108,93,39,52,58,64,30,254,120,1,17,61,55,120,90,7,100,77,37,40,84,104,253,
+232,15,1,214,178,155,75,164,62,70,251,220,78,59,57,73,76,62,55,74,1,43,2,
+167,15,253,58,126,132,108,57,137,115,113,135,110,76,57,66,68,72,63,61,71,
+2,2,166,245,129,125,105,105,125,129,245,166,219,1,34,135,115,117,138,133,
+115,20,25,48,147,81,107,151,76,216,216,76,151,107,154,181,51,45,51,73,28,
+92,104,47,89,58,83,112,19,45,37,39,48,22,165,57,109,76,172,38,62,219,81,67,
+73,76,64,64,74,73,251,45,165,21,67,108,64,116,137,126,106,64,68,67,73,73,
+67,64,74,72,0,5,0,22,253,179,4,186,5,118,0,66,0,78,0,90,0,106,0,118,0,0,19,
+52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,23,22,23,54,53,52,
+38,39,35,53,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,6,7,22,21,
+20,6,7,22,21,20,6,35,34,38,53,52,55,38,38,1,20,22,51,50,54,53,52,38,35,34,
+6,19,20,22,51,50,54,53,52,38,35,34,6,1,7,33,34,46,2,53,52,54,51,50,22,21,
+20,7,39,52,38,35,34,6,21,20,22,51,50,54,70,93,166,104,108,128,121,102,101,
+118,6,80,126,166,176,94,236,61,64,125,159,100,77,37,40,84,104,254,38,15,1,
+152,178,155,75,60,106,101,157,151,139,39,130,107,112,126,41,153,185,1,1,64,
+49,53,62,62,51,51,64,145,70,66,67,70,71,65,68,69,2,226,15,253,18,126,132,
+108,57,137,115,113,135,31,79,76,57,66,68,72,63,61,71,2,126,100,178,107,120,
+102,104,123,119,102,21,21,80,86,73,109,13,14,52,39,230,89,122,41,92,19,45,
+37,39,48,22,165,57,109,76,60,101,56,6,103,182,132,157,26,58,86,96,118,109,
+95,65,47,13,191,1,26,58,62,64,56,54,63,60,253,152,46,53,52,48,49,51,54,253,
+79,165,21,67,108,64,116,137,126,106,64,52,120,67,73,73,67,64,74,72,0,3,0,
+2,252,168,3,232,5,118,0,56,0,102,0,113,0,0,1,52,38,39,39,38,38,53,52,54,54,
+51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,23,7,38,38,35,
+34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,19,7,33,34,46,2,
+53,52,55,38,53,52,55,51,22,22,51,50,55,51,22,51,50,54,55,51,22,22,51,21,34,
+38,39,6,6,35,34,39,6,7,22,22,21,20,7,39,52,38,35,34,7,20,22,51,50,54,3,25,
+92,109,129,192,178,83,173,128,95,100,77,37,40,84,104,254,38,15,1,152,178,
+155,75,70,62,74,86,96,94,175,113,126,116,117,139,123,186,148,227,183,254,
+191,170,100,156,233,127,142,207,15,253,208,126,132,108,57,109,59,6,54,12,
+73,64,110,33,60,33,110,64,73,12,54,23,75,77,53,91,29,13,101,70,129,65,22,
+32,59,63,31,79,73,59,133,2,72,63,61,71,1,89,65,73,9,11,16,122,127,63,117,
+75,19,45,37,39,48,22,165,57,109,76,65,107,26,35,64,111,92,91,94,71,78,70,
+11,10,16,157,120,147,183,1,19,82,133,74,252,61,165,21,67,108,64,148,69,64,
+128,39,47,85,73,116,116,73,85,61,45,166,63,60,93,90,150,50,36,28,109,69,64,
+52,120,65,75,140,64,74,72,0,2,0,35,255,230,5,237,5,155,0,80,0,92,0,0,1,20,
+6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,50,22,23,
+7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,53,52,
+38,39,39,38,38,53,52,54,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,
+2,7,52,38,35,34,6,21,20,22,51,50,54,5,237,137,115,113,135,31,143,95,102,21,
+62,22,105,100,9,74,88,84,110,56,146,218,102,96,94,175,113,126,116,117,139,
+123,186,148,227,183,254,191,170,100,156,233,127,142,92,109,129,192,178,69,
+68,64,62,147,122,18,109,119,34,38,128,120,161,125,131,106,55,123,72,63,61,
+71,76,57,66,68,4,151,116,137,126,106,64,52,82,106,90,98,62,63,61,61,87,77,
+111,92,91,94,71,78,70,11,10,16,157,120,147,183,1,19,82,133,74,73,65,73,9,
+11,16,122,127,58,108,36,33,109,66,115,142,95,80,87,88,22,68,105,90,64,74,
+72,66,67,73,73,0,5,0,40,254,203,8,79,5,155,0,93,0,105,0,117,0,127,0,131,0,
+0,55,52,54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,18,
+21,20,7,22,22,51,50,54,53,52,38,39,34,38,53,52,54,51,51,50,22,23,54,54,51,
+51,50,30,2,21,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,
+22,22,23,22,18,21,20,6,6,35,34,38,39,6,6,35,34,38,1,52,38,35,34,6,21,20,22,
+51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,19,38,38,35,34,6,21,20,51,50,23,
+51,19,35,40,140,136,84,155,102,73,90,6,133,113,115,136,145,121,181,227,57,
+72,121,85,130,147,148,162,137,160,147,122,18,109,119,34,38,128,120,161,125,
+131,106,55,137,115,113,135,31,143,95,102,21,62,22,105,100,9,74,88,39,79,89,
+186,206,96,160,94,94,161,129,64,184,108,142,164,7,172,72,63,61,71,76,57,66,
+68,250,71,74,55,62,76,73,57,59,78,43,72,124,81,64,74,182,137,172,108,70,246,
+211,111,124,61,60,101,143,150,95,22,25,115,133,138,117,115,135,254,249,213,
+153,132,37,25,154,159,149,199,73,132,111,115,142,95,80,87,88,22,68,105,65,
+116,137,126,106,64,52,82,106,90,98,62,63,41,56,29,4,53,254,210,224,147,208,
+106,70,107,86,91,127,4,24,64,74,72,66,67,73,73,254,176,65,73,74,64,64,76,
+73,254,82,55,48,43,40,89,170,254,192,0,2,0,85,255,245,6,64,5,155,0,66,0,78,
+0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,
+50,0,17,20,7,39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,52,18,55,38,38,
+53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,
+54,6,64,137,115,113,135,31,143,95,102,21,62,22,105,100,9,74,88,84,110,77,
+223,1,14,87,215,70,75,177,160,159,178,74,70,217,85,133,118,76,73,147,122,
+18,109,119,34,38,128,120,161,125,131,106,55,123,72,63,61,71,76,57,66,68,4,
+151,116,137,126,106,64,52,82,106,90,98,62,63,61,61,254,196,254,251,206,250,
+10,146,251,148,184,202,199,182,147,254,254,145,11,235,226,178,1,8,68,31,115,
+72,115,142,95,80,87,88,22,68,105,90,64,74,72,66,67,73,73,0,4,0,100,254,203,
+11,18,5,118,0,21,0,93,0,105,0,109,0,0,1,33,55,33,50,22,22,21,20,6,6,35,35,
+53,51,50,54,54,53,52,38,38,1,20,6,35,34,39,6,6,35,34,39,6,6,35,34,38,39,6,
+6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,21,
+7,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,
+22,4,18,5,52,38,35,34,6,21,20,22,51,50,54,23,19,35,19,2,62,254,38,15,1,152,
+178,155,75,76,131,147,148,159,100,77,37,40,84,8,108,181,158,200,143,36,157,
+114,201,143,36,157,115,108,167,54,26,155,104,136,163,165,132,98,141,33,75,
+161,100,105,127,222,235,6,168,1,2,140,2,68,146,93,105,127,222,235,6,168,1,
+2,140,2,67,145,93,105,127,222,235,6,168,1,2,140,247,231,97,83,81,97,92,84,
+86,96,174,70,246,68,4,209,165,57,109,76,68,109,48,92,19,45,37,39,48,22,252,
+211,206,240,235,110,125,237,111,126,126,88,104,110,169,141,136,175,97,80,
+116,101,154,127,172,202,9,168,8,169,254,237,161,53,84,82,154,127,172,202,
+9,168,8,169,254,237,161,55,83,81,154,127,172,202,9,168,8,169,254,237,252,
+81,97,96,83,77,93,88,235,254,192,1,64,0,2,0,65,255,230,7,48,5,155,0,110,0,
+122,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,46,2,35,35,34,6,21,20,22,51,
+51,3,51,21,33,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,
+21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,
+23,7,38,38,53,52,54,51,50,22,21,20,7,51,39,38,38,53,52,54,51,51,50,22,23,
+54,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,7,48,137,115,113,135,
+31,63,95,102,21,62,16,40,77,64,9,63,69,84,110,50,23,219,253,226,42,116,75,
+62,28,82,68,175,60,64,40,104,90,80,82,33,120,36,148,120,101,139,43,57,148,
+92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,4,179,16,
+116,109,132,107,18,92,115,25,38,128,120,81,125,131,106,55,123,72,63,61,71,
+76,57,66,68,4,151,116,137,126,106,64,52,82,106,63,79,46,68,57,61,61,254,235,
+88,54,83,54,52,50,36,60,68,216,118,98,97,76,80,80,106,116,151,187,102,128,
+130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,
+132,96,29,20,193,20,130,89,114,143,98,77,87,88,22,68,105,90,64,74,72,66,67,
+73,73,0,2,0,65,255,230,6,111,5,155,0,84,0,96,0,0,55,52,55,35,53,33,23,6,6,
+21,20,22,51,50,55,51,22,22,51,50,54,53,52,2,39,35,34,38,53,52,54,51,51,50,
+22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,55,35,34,6,7,35,46,2,35,
+35,34,6,21,20,22,51,55,22,22,18,21,20,6,35,34,38,39,6,6,35,34,38,1,52,38,
+35,34,6,21,20,22,51,50,54,130,164,229,1,102,30,92,88,91,83,175,60,64,34,119,
+90,88,107,229,200,28,162,191,132,107,18,92,115,25,38,128,120,81,125,131,106,
+55,137,115,113,135,31,63,95,102,21,62,16,40,77,64,9,63,69,110,106,56,152,
+247,147,165,132,115,134,55,57,148,92,124,163,5,114,72,63,61,71,76,57,66,68,
+252,191,104,104,92,51,102,68,61,76,216,115,101,122,123,198,1,2,25,124,127,
+114,143,98,77,87,88,22,68,105,65,116,137,126,106,64,52,82,106,63,79,46,68,
+57,69,59,2,26,152,254,253,177,192,239,109,121,130,100,156,3,252,64,74,72,
+66,67,73,73,255,255,0,65,254,203,6,111,5,155,2,38,1,214,0,0,0,6,2,159,0,0,
+0,2,0,75,255,230,7,116,5,155,0,120,0,132,0,0,55,52,54,55,54,54,53,52,38,35,
+34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,7,22,51,50,54,53,52,38,39,46,2,
+53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,55,35,
+34,6,7,35,46,2,35,35,34,6,21,20,22,23,30,2,21,20,6,35,34,39,6,7,14,2,21,20,
+22,51,50,55,51,22,22,51,50,54,53,52,39,51,22,21,20,6,35,34,38,39,6,6,35,34,
+38,1,52,38,35,34,6,21,20,22,51,50,54,87,98,138,87,67,68,59,59,75,22,74,41,
+48,156,125,122,165,3,108,136,77,80,61,94,83,96,72,132,107,18,92,115,25,38,
+128,120,81,125,131,106,55,137,115,113,135,31,63,95,102,21,62,16,40,77,64,
+9,63,69,73,102,92,99,75,158,128,168,143,42,120,75,62,28,82,68,175,60,64,40,
+102,88,80,78,34,129,36,162,116,99,131,43,57,148,92,134,174,6,162,72,63,61,
+71,76,57,66,68,232,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,
+132,96,43,81,58,48,44,61,32,28,49,102,85,114,143,98,77,87,88,22,68,105,65,
+116,137,126,106,64,52,82,106,63,79,46,68,57,52,62,22,20,34,88,81,106,128,
+111,57,85,54,52,50,36,60,68,216,118,98,73,62,70,62,87,115,121,171,101,129,
+130,100,147,4,5,64,74,72,66,67,73,73,0,3,0,80,254,203,12,2,5,118,0,91,0,103,
+0,107,0,0,1,20,6,35,34,39,6,6,35,34,39,6,6,35,34,3,6,6,35,34,0,53,52,54,54,
+51,51,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,7,22,22,21,20,7,22,
+22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,
+4,18,21,7,22,22,51,50,54,53,52,38,39,55,22,4,18,5,52,38,35,34,6,21,20,22,
+51,50,54,1,19,35,19,12,2,181,158,203,146,36,158,117,205,145,36,158,117,219,
+150,57,238,165,231,254,238,120,229,156,101,100,77,37,40,84,104,253,232,15,
+1,214,178,155,75,162,107,117,8,72,151,100,105,127,222,235,6,168,1,2,140,1,
+70,148,97,105,127,222,235,6,168,1,2,140,1,70,148,96,105,127,222,235,6,168,
+1,2,140,247,188,201,172,171,201,198,174,176,197,3,57,70,246,68,1,164,206,
+240,246,115,131,247,116,131,1,26,133,149,1,31,237,147,239,139,19,45,37,39,
+48,22,165,57,109,76,169,41,68,235,145,53,56,95,93,154,127,172,202,9,168,8,
+169,254,237,161,42,90,87,154,127,172,202,9,168,8,169,254,237,161,43,89,87,
+154,127,172,202,9,168,8,169,254,237,20,171,199,200,170,165,189,187,254,129,
+254,192,1,64,0,3,0,60,255,231,9,99,5,155,0,104,0,116,0,127,0,0,1,20,6,35,
+34,38,53,52,55,35,34,6,7,35,46,2,35,35,34,6,21,20,22,51,51,7,7,51,21,33,20,
+7,22,21,20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,
+34,6,7,35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,
+23,51,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,7,52,38,35,34,
+6,21,20,22,51,50,54,1,38,35,34,6,21,20,22,51,50,54,9,99,137,115,113,135,31,
+63,95,102,21,62,16,40,77,64,9,63,69,84,110,50,9,15,213,254,15,48,107,23,91,
+21,54,77,240,126,145,201,219,186,210,137,32,117,95,79,105,24,75,24,114,92,
+90,91,58,77,111,162,125,100,166,33,27,136,98,109,146,20,188,16,115,109,132,
+107,18,92,115,25,38,128,120,81,125,131,106,55,123,72,63,61,71,76,57,66,68,
+251,21,116,188,129,133,121,102,104,181,4,151,116,137,126,106,64,52,82,106,
+63,79,46,68,57,61,61,89,188,88,130,129,107,164,81,71,19,72,67,99,74,152,180,
+170,124,127,149,85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,123,164,
+133,104,105,132,151,126,193,20,131,88,114,143,98,77,87,88,22,68,105,90,64,
+74,72,66,67,73,73,253,67,75,70,58,57,71,98,0,3,0,80,255,230,7,220,5,155,0,
+92,0,104,0,116,0,0,19,52,18,55,39,51,7,22,22,21,20,6,35,34,38,53,52,55,6,
+21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,34,38,53,52,54,51,51,50,22,
+23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,55,35,34,6,7,35,46,2,35,35,
+34,6,21,20,51,22,18,21,20,6,6,35,34,38,39,6,6,35,34,38,38,1,52,38,35,34,6,
+21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,80,172,142,17,235,16,
+85,91,136,115,111,135,10,112,133,116,184,61,64,33,141,93,122,138,116,131,
+126,146,132,107,18,92,115,25,38,128,120,81,125,131,106,55,137,115,113,135,
+31,63,95,102,21,62,16,40,77,64,9,63,69,171,174,146,96,163,96,88,163,48,52,
+133,84,97,160,93,7,17,72,63,61,71,76,57,66,68,251,40,73,60,60,74,75,57,62,
+73,1,217,192,1,36,48,210,203,23,128,88,117,138,128,106,38,33,126,197,141,
+158,216,112,104,158,141,157,201,88,125,107,114,143,98,77,87,88,22,68,105,
+65,116,137,126,106,64,52,82,106,63,79,46,68,57,122,79,254,226,199,137,222,
+126,113,117,122,108,120,226,3,62,64,74,72,66,67,73,73,254,175,64,74,72,66,
+67,73,75,0,4,0,80,255,230,6,51,5,155,0,55,0,67,0,79,0,91,0,0,1,20,6,35,34,
+38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,50,22,22,21,20,0,
+35,34,0,53,52,54,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,7,52,
+38,35,34,6,21,20,22,51,50,54,5,34,6,21,20,22,51,50,54,53,52,38,7,50,22,21,
+20,6,35,34,38,53,52,54,6,51,137,115,113,135,31,143,95,102,21,62,22,105,100,
+9,74,88,84,110,94,155,229,122,254,236,230,231,254,238,128,117,78,73,147,122,
+18,109,119,34,38,128,120,161,125,131,106,55,123,72,63,61,71,76,57,66,68,252,
+145,171,201,198,174,176,197,201,171,54,69,68,55,55,67,68,4,151,116,137,126,
+106,64,52,82,106,90,98,62,63,61,61,138,239,148,238,254,226,1,31,237,152,243,
+66,31,116,72,115,142,95,80,87,88,22,68,105,90,64,74,72,66,67,73,73,152,200,
+170,165,189,187,167,171,199,241,69,52,52,68,68,52,52,69,0,3,0,80,255,230,
+6,223,5,155,0,82,0,94,0,106,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,
+38,35,35,34,6,21,20,22,51,51,22,22,23,7,38,35,34,6,6,21,20,22,51,50,55,51,
+22,22,23,38,53,52,54,51,50,22,21,20,6,35,32,39,6,6,35,34,38,53,52,18,55,38,
+53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,
+54,1,20,22,51,50,54,53,52,38,35,34,6,6,223,137,115,113,135,31,73,95,102,21,
+62,22,105,100,9,74,88,84,110,40,117,182,84,62,161,172,145,253,152,107,96,
+175,60,64,32,132,113,96,130,105,118,145,204,143,254,254,106,57,148,92,138,
+166,236,206,106,147,122,18,109,119,34,38,128,120,91,125,131,106,55,123,72,
+63,61,71,76,57,66,68,253,124,73,67,65,73,74,64,64,76,4,151,116,137,126,106,
+64,52,82,106,90,98,62,63,61,61,1,55,56,82,102,132,240,155,101,102,216,109,
+101,5,53,125,96,119,149,123,143,206,230,130,100,203,169,222,1,85,73,67,129,
+115,142,95,80,87,88,22,68,105,90,64,74,72,66,67,73,73,253,53,59,78,74,55,
+62,76,73,255,255,0,80,254,203,6,223,5,155,2,38,1,221,0,0,0,6,2,159,224,0,
+0,3,0,75,255,230,8,36,5,155,0,110,0,122,0,134,0,0,1,20,6,35,34,38,53,52,55,
+35,34,6,7,35,46,2,35,35,34,6,21,20,22,51,51,50,18,21,20,6,6,35,34,38,53,52,
+54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,51,51,
+21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,53,52,54,51,
+50,22,23,54,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,8,36,137,115,
+113,135,31,63,95,102,21,62,16,40,77,64,9,63,69,84,110,55,181,236,117,182,
+94,141,186,147,119,104,133,34,141,180,147,107,164,22,78,25,149,125,114,120,
+134,123,62,80,122,145,131,123,124,132,44,139,132,196,243,111,93,84,94,204,
+156,130,194,53,43,89,81,78,132,107,18,92,115,25,38,128,120,81,125,131,106,
+55,123,72,63,61,71,76,57,66,68,253,87,74,64,64,76,73,67,65,73,4,151,116,137,
+126,106,64,52,82,106,63,79,46,68,57,61,61,254,219,224,168,241,123,174,134,
+125,158,128,101,69,58,99,223,150,189,127,98,104,121,75,68,68,76,98,77,65,
+63,79,33,216,44,178,143,87,122,30,35,117,72,116,149,128,114,109,66,30,118,
+74,114,143,98,77,87,88,22,68,105,90,64,74,72,66,67,73,73,253,15,62,76,73,
+57,59,78,74,0,4,0,80,255,230,8,75,5,155,0,88,0,100,0,112,0,124,0,0,1,20,6,
+35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,30,2,21,16,
+0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,4,33,32,36,
+53,52,38,39,22,21,20,6,35,34,38,53,52,55,38,38,53,52,54,51,51,50,22,23,54,
+54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,20,22,51,50,54,53,52,
+38,35,34,6,37,34,6,21,20,22,51,50,54,53,52,38,8,75,137,115,113,135,31,83,
+95,102,21,62,22,105,100,9,74,88,84,110,40,111,184,108,254,128,254,171,254,
+171,254,128,234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,41,
+50,42,13,131,105,115,136,73,82,77,147,122,18,109,119,34,38,128,120,101,125,
+131,106,55,123,72,63,61,71,76,57,66,68,249,156,75,57,62,73,73,60,60,74,2,
+236,60,73,73,62,57,75,74,4,151,116,137,126,106,64,52,82,106,90,98,62,63,61,
+61,1,120,211,134,254,236,254,205,1,51,1,20,199,1,11,135,115,117,138,119,98,
+40,41,41,123,73,173,199,199,173,73,123,41,41,40,98,119,138,117,116,67,30,
+118,74,115,142,95,80,87,88,22,68,105,90,64,74,72,66,67,73,73,254,175,67,73,
+75,65,64,74,72,72,74,64,65,75,73,67,66,72,0,5,0,80,254,203,6,169,5,155,0,
+61,0,73,0,90,0,102,0,106,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,
+35,35,34,6,21,20,22,51,51,50,4,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+18,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,7,52,38,35,34,6,21,
+20,22,51,50,54,5,34,0,21,20,22,51,50,55,51,22,51,50,54,53,52,0,7,50,22,21,
+20,6,35,34,38,53,52,54,19,19,35,19,6,169,137,115,113,135,31,143,95,102,21,
+62,22,105,100,9,74,88,84,110,71,165,1,19,161,172,142,91,152,43,44,153,90,
+143,171,183,161,67,65,147,122,18,109,119,34,38,128,120,161,125,131,106,55,
+123,72,63,61,71,76,57,66,68,252,122,207,254,250,113,94,171,60,63,60,171,94,
+113,254,249,201,54,69,68,55,55,67,68,103,70,246,68,4,151,116,137,126,106,
+64,52,82,106,90,98,62,63,61,61,160,254,223,183,190,227,119,111,111,119,227,
+190,194,1,51,75,32,112,67,115,142,95,80,87,88,22,68,105,90,64,74,72,66,67,
+73,73,152,254,250,205,127,136,216,216,136,127,205,1,6,137,69,52,52,68,68,
+52,52,69,252,241,254,192,1,64,0,3,0,80,255,230,6,169,5,155,0,60,0,72,0,90,
+0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,
+32,0,17,20,6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,38,53,52,54,51,51,50,
+22,23,54,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,20,
+22,51,50,55,51,22,22,51,50,54,53,52,2,6,169,137,115,113,135,31,143,95,102,
+21,62,22,105,100,9,74,88,84,110,72,1,16,1,73,159,138,115,134,55,57,148,92,
+144,160,179,158,64,61,147,122,18,109,119,34,38,128,120,161,125,131,106,55,
+123,72,63,61,71,76,57,66,68,252,123,223,247,110,93,175,60,64,34,119,90,90,
+105,247,4,151,116,137,126,106,64,52,82,106,90,98,62,63,61,61,254,174,254,
+232,201,230,109,121,130,100,228,203,201,1,40,69,33,109,65,115,142,95,80,87,
+88,22,68,105,90,64,74,72,66,67,73,73,152,253,234,129,114,216,115,101,117,
+128,229,1,0,0,4,0,80,254,203,6,169,5,155,0,61,0,73,0,90,0,94,0,0,1,20,6,35,
+34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,50,4,18,21,20,
+6,35,34,38,39,6,6,35,34,38,53,52,18,55,38,38,53,52,54,51,51,50,22,23,54,54,
+51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,0,21,20,22,51,50,55,
+51,22,51,50,54,53,52,0,3,19,35,19,6,169,137,115,113,135,31,143,95,102,21,
+62,22,105,100,9,74,88,84,110,71,165,1,19,161,172,142,91,152,43,44,153,90,
+143,171,183,161,67,65,147,122,18,109,119,34,38,128,120,161,125,131,106,55,
+123,72,63,61,71,76,57,66,68,252,122,207,254,250,113,94,171,60,63,60,171,94,
+113,254,249,152,70,246,68,4,151,116,137,126,106,64,52,82,106,90,98,62,63,
+61,61,160,254,223,183,190,227,119,111,111,119,227,190,194,1,51,75,32,112,
+67,115,142,95,80,87,88,22,68,105,90,64,74,72,66,67,73,73,152,254,250,205,
+127,136,216,216,136,127,205,1,6,252,104,254,192,1,64,0,2,0,70,255,230,7,21,
+5,155,0,78,0,90,0,0,1,34,21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,
+50,53,52,38,39,7,34,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,
+6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,51,55,4,0,21,20,6,
+35,34,38,39,38,38,1,52,38,35,34,6,21,20,22,51,50,54,1,94,126,48,37,195,21,
+23,159,129,93,137,87,57,80,101,68,219,233,210,32,154,171,147,122,18,109,119,
+34,38,128,120,161,125,131,106,55,137,115,113,135,31,143,95,102,21,62,22,105,
+100,9,74,88,181,42,1,22,1,51,174,179,134,186,84,70,97,5,3,72,63,61,71,76,
+57,66,68,2,6,185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,245,201,255,
+29,1,133,115,115,142,95,80,87,88,22,68,105,65,116,137,126,106,64,52,82,106,
+90,98,62,63,123,1,40,254,187,253,197,234,152,160,132,100,2,120,64,74,72,66,
+67,73,73,0,3,0,75,255,230,7,220,6,38,0,76,0,88,0,100,0,0,1,20,6,35,34,38,
+53,52,55,35,22,21,16,2,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,39,33,34,6,7,35,38,38,35,35,34,6,21,20,23,7,38,38,53,52,54,
+51,51,50,22,23,54,54,51,51,38,37,55,4,19,33,50,30,2,7,52,38,35,34,6,21,20,
+22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,7,220,137,115,113,135,31,209,
+44,195,190,111,169,54,26,155,104,136,163,165,132,98,141,33,75,161,100,132,
+153,45,254,199,95,102,21,62,22,105,100,9,71,92,50,66,57,62,157,125,18,109,
+119,34,38,128,120,201,146,254,201,6,1,154,170,1,68,125,131,106,55,123,72,
+63,61,71,76,57,66,68,250,203,97,83,81,97,92,84,86,96,3,68,116,137,126,106,
+64,52,159,181,254,217,254,190,126,88,104,110,169,141,136,175,97,80,116,101,
+228,196,170,136,82,106,90,98,68,51,53,40,75,31,110,62,107,142,95,80,87,88,
+228,82,168,130,254,164,22,68,105,90,64,74,72,66,67,73,73,254,97,81,97,96,
+83,77,93,88,255,255,0,75,254,203,7,220,6,38,2,38,1,229,0,0,0,6,2,159,213,
+0,0,2,0,75,255,230,7,34,5,155,0,106,0,118,0,0,1,20,6,35,34,38,53,52,55,35,
+34,6,7,35,46,2,35,35,34,6,21,20,51,55,30,2,21,20,6,6,35,34,38,39,6,6,35,34,
+38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,
+21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,7,34,38,53,
+52,54,51,51,50,22,23,54,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,
+7,34,137,115,113,135,31,63,95,102,21,62,16,40,77,64,9,63,69,167,46,120,193,
+111,85,145,87,99,149,56,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,
+41,48,156,125,122,165,79,124,75,62,28,82,68,175,60,64,34,114,89,111,126,184,
+154,28,122,157,132,107,18,92,115,25,38,128,120,81,125,131,106,55,123,72,63,
+61,71,76,57,66,68,4,151,116,137,126,106,64,52,82,106,63,79,46,68,57,124,2,
+20,154,253,160,142,209,111,101,129,130,100,147,111,88,134,99,61,88,47,50,
+70,71,57,48,36,36,33,92,46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,
+115,101,168,145,169,207,48,1,129,112,114,143,98,77,87,88,22,68,105,90,64,
+74,72,66,67,73,73,255,255,0,75,254,203,7,34,5,155,2,38,1,231,0,0,0,6,2,159,
+228,0,0,2,0,75,255,230,10,85,5,118,0,88,0,100,0,0,1,20,6,35,34,39,6,6,35,
+34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,
+52,0,35,35,53,33,50,54,54,53,52,38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,
+21,7,22,22,51,50,54,53,52,38,39,55,22,0,17,7,22,22,51,50,54,53,52,38,39,55,
+22,0,1,52,38,35,34,6,21,20,22,51,50,54,10,85,165,164,203,146,34,151,116,203,
+144,34,160,126,114,172,54,26,155,104,136,163,165,132,98,141,33,75,161,100,
+114,120,254,231,225,178,1,23,93,77,44,42,84,102,253,174,15,2,16,177,155,76,
+91,76,170,189,1,70,149,96,118,126,236,233,6,255,1,45,2,70,149,96,118,126,
+236,233,6,255,1,45,247,215,97,83,81,97,92,84,86,96,1,184,214,252,246,117,
+129,242,115,127,126,88,104,110,169,141,136,175,97,80,116,101,134,128,209,
+1,3,92,13,50,40,38,48,21,165,57,107,76,77,115,19,63,254,225,190,30,89,87,
+130,117,191,216,10,168,7,254,193,254,245,62,89,88,130,117,191,216,10,168,
+7,254,193,254,134,81,97,96,83,77,93,88,0,2,0,80,255,230,11,180,5,118,0,91,
+0,103,0,0,1,20,6,35,34,39,6,6,35,34,39,6,6,35,34,39,6,6,35,34,0,53,52,54,
+54,51,50,22,22,21,20,7,22,22,51,50,54,53,52,38,39,33,53,51,50,54,54,53,52,
+38,38,35,33,55,33,50,22,22,21,20,6,7,22,18,21,7,22,22,51,50,54,53,52,38,39,
+55,22,0,17,7,22,22,51,50,54,53,52,38,39,55,22,0,5,52,38,35,34,6,21,20,22,
+51,50,54,11,180,165,164,200,142,36,149,113,202,144,39,153,103,208,146,61,
+230,156,231,254,238,120,229,156,155,229,122,14,66,135,85,115,141,120,120,
+255,0,229,100,77,37,40,84,104,253,224,15,1,222,178,155,75,103,88,106,105,
+3,67,146,94,118,126,236,233,6,255,1,45,3,67,145,94,118,126,236,233,6,255,
+1,45,248,10,201,172,171,201,198,174,176,197,1,184,214,252,235,112,123,240,
+116,124,254,120,134,1,31,237,147,239,139,138,239,148,71,67,80,79,171,137,
+133,226,63,92,19,45,37,39,48,22,165,57,109,76,80,120,15,81,254,250,149,81,
+84,83,130,117,191,216,10,168,7,254,193,254,245,74,83,82,130,117,191,216,10,
+168,7,254,193,146,171,199,200,170,165,189,187,0,3,0,80,255,230,6,83,5,155,
+0,55,0,67,0,79,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,
+21,20,22,51,51,50,22,22,21,20,0,35,34,0,53,52,54,55,38,38,53,52,54,51,51,
+50,22,23,54,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,
+20,22,51,50,54,53,52,38,6,83,137,115,113,135,31,143,95,102,21,62,22,105,100,
+9,74,88,84,110,62,155,229,122,254,236,230,231,254,238,135,124,68,65,147,122,
+18,109,119,34,38,128,120,161,125,131,106,55,123,72,63,61,71,76,57,66,68,252,
+113,171,201,198,174,176,197,201,4,151,116,137,126,106,64,52,82,106,90,98,
+62,63,61,61,138,239,148,238,254,226,1,31,237,156,249,64,32,111,68,115,142,
+95,80,87,88,22,68,105,90,64,74,72,66,67,73,73,152,200,170,165,189,187,167,
+171,199,0,3,0,80,255,230,7,254,5,155,0,75,0,87,0,99,0,0,1,20,6,35,34,38,53,
+52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,22,51,51,22,17,16,0,33,32,0,
+17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,51,32,36,53,52,38,39,
+38,38,53,52,54,51,51,50,22,23,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,
+50,54,1,20,22,51,50,54,53,52,38,35,34,6,7,254,137,115,113,135,31,89,89,96,
+20,62,22,105,100,9,74,88,36,73,85,46,246,254,208,254,188,254,221,254,202,
+226,182,122,144,136,115,113,133,6,90,1,10,241,1,8,1,6,102,87,149,168,147,
+122,18,109,119,34,64,222,94,125,131,106,55,123,72,63,61,71,76,57,66,68,249,
+233,75,57,62,73,73,60,60,74,4,151,116,137,126,106,64,52,83,105,90,98,62,63,
+39,54,29,174,254,214,254,225,254,222,1,42,1,19,212,1,8,135,115,117,138,133,
+115,25,22,95,150,173,188,183,190,117,180,54,1,131,115,115,142,95,80,175,22,
+68,105,90,64,74,72,66,67,73,73,254,175,67,73,75,65,64,74,72,0,3,0,75,255,
+230,6,190,5,155,0,74,0,86,0,98,0,0,19,52,54,51,50,22,23,22,22,51,50,54,53,
+52,38,39,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,
+34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,22,4,18,21,20,
+6,35,34,38,39,6,6,35,34,38,1,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,
+6,21,20,22,51,50,54,75,165,132,98,141,33,75,161,100,119,119,249,226,82,143,
+135,147,122,18,109,119,34,38,128,120,91,125,131,106,55,137,115,113,135,31,
+73,95,102,21,62,22,105,100,9,74,88,84,110,49,169,1,15,155,172,173,114,172,
+54,26,155,104,136,163,5,248,72,63,61,71,76,57,66,68,251,233,97,83,81,97,92,
+84,86,96,1,28,136,175,97,80,116,101,128,119,202,242,39,1,11,137,98,115,142,
+95,80,87,88,22,68,105,65,116,137,126,106,64,52,82,106,90,98,62,63,61,61,10,
+155,254,248,167,206,247,126,88,104,110,169,3,239,64,74,72,66,67,73,73,253,
+14,81,97,96,83,77,93,88,0,3,0,40,255,230,7,80,5,155,0,85,0,97,0,109,0,0,1,
+20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,22,22,
+21,20,6,7,7,22,21,20,6,35,34,38,53,52,55,55,38,38,35,34,21,20,23,7,38,38,
+53,52,54,51,50,4,23,55,54,54,53,52,38,39,35,34,38,53,52,54,51,51,50,22,23,
+54,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,7,6,6,21,20,22,51,
+50,54,53,52,7,80,137,115,113,135,31,73,95,102,21,62,22,105,100,9,74,88,84,
+110,72,89,109,65,70,140,98,173,149,142,190,212,211,63,192,110,157,22,74,45,
+49,134,107,137,1,18,101,140,45,39,55,53,58,152,170,147,122,18,109,119,34,
+38,128,120,91,125,131,106,55,123,72,63,61,71,76,57,66,68,252,28,142,78,68,
+84,68,80,98,4,151,116,137,126,106,64,52,82,106,90,98,62,63,61,61,7,88,77,
+61,82,35,70,177,154,136,162,167,122,162,107,106,90,108,124,35,49,36,47,101,
+65,97,121,192,150,71,23,42,33,38,37,6,130,117,115,142,95,80,87,88,22,68,105,
+90,64,74,72,66,67,73,73,253,244,72,39,76,43,56,72,85,88,93,0,3,0,75,255,230,
+7,220,6,38,0,91,0,103,0,115,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,7,6,
+21,20,22,51,50,55,23,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,
+51,50,22,23,22,22,51,50,54,53,52,39,33,34,6,7,35,38,38,35,35,34,6,21,20,23,
+7,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,37,55,4,19,33,50,30,2,7,52,
+38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,7,220,137,
+115,113,135,31,209,44,23,11,51,41,56,53,82,74,93,66,104,24,45,141,88,107,
+161,65,25,155,105,136,163,165,132,103,144,31,75,156,103,132,149,45,254,199,
+95,102,21,62,22,105,100,9,71,92,50,66,57,62,157,125,18,109,119,34,38,128,
+120,201,146,254,201,6,1,154,170,1,68,125,131,106,55,123,72,63,61,71,76,57,
+66,68,250,203,97,83,81,97,92,84,86,96,3,68,116,137,126,106,64,52,159,181,
+122,128,62,24,43,51,37,170,54,77,62,66,73,111,106,105,112,169,141,136,175,
+106,86,103,99,224,200,170,136,82,106,90,98,68,51,53,40,75,31,110,62,107,142,
+95,80,87,88,228,82,168,130,254,164,22,68,105,90,64,74,72,66,67,73,73,254,
+97,81,97,96,83,77,93,88,0,2,0,90,255,230,7,227,6,38,0,82,0,94,0,0,1,20,6,
+35,34,38,53,52,55,35,22,21,16,2,35,34,38,39,38,38,35,34,21,20,22,23,7,38,
+38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,34,6,7,35,38,38,35,35,
+34,6,21,20,23,7,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,37,55,4,19,33,
+50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,7,227,137,115,113,135,31,209,44,
+197,195,131,182,86,70,97,57,126,48,37,195,21,23,159,129,93,137,87,94,127,
+76,129,151,45,254,199,95,102,21,62,22,105,100,9,71,92,50,66,57,62,157,125,
+18,109,119,34,38,128,120,201,146,254,201,6,1,154,170,1,68,125,131,106,55,
+123,72,63,61,71,76,57,66,68,3,68,116,137,126,106,64,52,159,181,254,217,254,
+190,149,163,132,100,185,83,179,72,10,65,158,58,150,186,82,116,125,82,229,
+195,170,136,82,106,90,98,68,51,53,40,75,31,110,62,107,142,95,80,87,88,228,
+82,168,130,254,164,22,68,105,90,64,74,72,66,67,73,73,0,5,0,75,255,230,10,
+42,5,226,0,13,0,102,0,114,0,126,0,138,0,0,19,55,22,23,54,0,55,23,6,4,7,35,
+38,38,37,20,6,35,34,38,53,52,55,35,34,6,7,35,46,2,35,35,34,6,21,20,23,30,
+3,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,55,33,38,53,52,54,51,51,50,
+22,23,54,54,51,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,20,
+22,51,50,54,53,52,38,1,52,38,35,34,6,21,20,22,51,50,54,75,216,47,63,92,1,
+65,113,99,205,254,206,90,70,71,162,9,176,137,115,113,135,31,63,95,102,21,
+62,16,40,77,64,9,64,68,83,124,119,92,52,137,115,113,135,31,254,183,108,111,
+83,159,109,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,103,108,
+132,124,121,237,15,2,110,50,132,107,18,92,115,25,38,128,120,81,125,131,106,
+55,123,72,63,61,71,76,57,66,68,252,209,61,71,76,57,66,68,72,251,109,97,83,
+81,97,92,84,86,96,4,251,12,152,119,67,1,45,122,99,192,237,47,43,195,6,116,
+137,126,106,64,52,82,106,63,79,46,70,60,85,32,1,31,64,102,62,116,137,126,
+106,64,52,90,247,129,113,191,114,111,106,105,112,169,141,136,175,106,86,103,
+99,145,117,115,210,70,165,66,84,119,143,98,77,87,88,22,68,105,90,64,74,72,
+66,67,73,73,207,72,66,67,73,73,67,64,74,253,221,81,97,96,83,77,93,88,0,3,
+0,80,255,230,7,213,5,155,0,108,0,120,0,132,0,0,1,20,6,35,34,38,53,52,55,35,
+34,6,7,35,46,2,35,35,34,6,21,20,22,51,51,50,18,21,20,6,6,35,34,38,39,6,6,
+35,34,38,38,53,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,22,51,
+50,55,51,22,51,50,54,54,53,52,38,35,34,6,21,20,22,23,7,33,53,33,38,38,53,
+52,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,7,52,38,35,34,6,21,
+20,22,51,50,54,1,20,22,51,50,54,53,52,38,35,34,6,7,213,137,115,113,135,31,
+63,95,102,21,62,16,40,77,64,9,63,69,84,110,57,148,170,99,167,100,103,161,
+42,42,161,103,100,167,99,232,176,122,144,136,115,113,133,5,41,48,78,125,70,
+214,60,64,60,214,70,125,78,108,93,39,52,58,64,30,254,120,1,17,61,55,38,103,
+99,132,107,18,92,115,25,38,128,120,81,125,131,106,55,123,72,63,61,71,76,57,
+66,68,250,18,78,59,57,73,76,62,55,74,4,151,116,137,126,106,64,52,82,106,63,
+79,46,68,57,61,61,254,238,235,166,245,129,125,105,105,125,129,245,166,219,
+1,34,135,115,117,138,133,115,20,25,48,147,81,107,151,76,216,216,76,151,107,
+154,181,51,45,51,73,28,92,104,47,89,58,64,51,24,127,84,114,143,98,77,87,88,
+22,68,105,90,64,74,72,66,67,73,73,254,175,67,73,76,64,64,74,73,0,4,0,70,255,
+231,7,60,5,155,0,90,0,102,0,114,0,126,0,0,37,52,55,38,38,53,52,54,54,51,50,
+22,21,20,6,35,34,38,53,52,55,6,21,20,22,23,22,23,54,54,53,52,38,39,38,38,
+53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,21,20,6,35,34,38,53,52,55,35,
+34,6,7,35,46,2,35,35,34,6,21,20,22,51,55,22,22,21,20,6,7,22,21,20,6,35,34,
+38,1,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,19,
+52,38,35,34,6,21,20,22,51,50,54,1,111,41,153,185,93,166,104,108,128,121,102,
+101,118,6,80,126,166,175,91,138,162,99,95,122,116,132,107,18,92,115,25,38,
+128,120,81,125,131,106,55,137,115,113,135,31,63,95,102,21,62,16,40,77,64,
+9,63,69,88,79,27,118,139,193,158,40,130,107,112,126,5,82,72,63,61,71,76,57,
+66,68,251,106,62,51,51,64,64,49,53,62,190,71,65,68,69,70,66,67,70,179,65,
+47,13,191,143,100,178,107,120,102,104,123,119,102,21,21,80,86,73,109,13,14,
+50,25,147,115,89,113,35,18,133,91,114,143,98,77,87,88,22,68,105,65,116,137,
+126,106,64,52,82,106,63,79,46,68,57,61,62,1,33,183,122,141,178,33,58,86,96,
+118,109,4,42,64,74,72,66,67,73,73,254,206,54,63,60,57,58,62,64,254,10,49,
+51,54,47,46,53,52,0,3,0,35,254,79,5,237,5,155,0,80,0,92,0,124,0,0,1,20,6,
+35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,50,22,23,7,
+38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,53,52,38,
+39,39,38,38,53,52,54,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,50,30,2,
+7,52,38,35,34,6,21,20,22,51,50,54,1,21,34,38,39,6,6,35,34,39,6,35,34,38,53,
+52,55,51,22,22,51,50,55,51,22,51,50,54,55,51,22,22,5,237,137,115,113,135,
+31,143,95,102,21,62,22,105,100,9,74,88,84,110,56,146,218,102,96,94,175,113,
+126,116,117,139,123,186,148,227,183,254,191,170,100,156,233,127,142,92,109,
+129,192,178,69,68,64,62,147,122,18,109,119,34,38,128,120,161,125,131,106,
+55,123,72,63,61,71,76,57,66,68,254,121,53,91,29,13,101,70,129,65,65,129,82,
+106,6,54,12,73,64,110,33,60,33,110,64,73,12,54,23,75,4,151,116,137,126,106,
+64,52,82,106,90,98,62,63,61,61,87,77,111,92,91,94,71,78,70,11,10,16,157,120,
+147,183,1,19,82,133,74,73,65,73,9,11,16,122,127,58,108,36,33,109,66,115,142,
+95,80,87,88,22,68,105,90,64,74,72,66,67,73,73,250,246,166,63,60,93,90,150,
+150,121,125,39,47,85,73,116,116,73,85,61,45,0,2,0,35,255,230,6,19,6,199,0,
+95,0,107,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,
+22,51,51,50,22,23,7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,
+22,51,50,54,53,52,38,39,39,38,38,53,52,54,55,38,38,53,52,54,51,51,50,22,23,
+54,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,
+6,21,20,22,51,50,54,5,237,137,115,113,135,31,143,95,102,21,62,22,105,100,
+9,74,88,84,110,56,146,218,102,96,94,175,113,126,116,117,139,123,186,148,227,
+183,254,191,170,100,156,233,127,142,92,109,129,192,178,69,68,64,62,147,122,
+18,109,119,34,38,128,120,142,29,112,109,181,101,87,74,101,63,68,20,103,106,
+81,45,123,72,63,61,71,76,57,66,68,4,151,116,137,126,106,64,52,82,106,90,98,
+62,63,61,61,87,77,111,92,91,94,71,78,70,11,10,16,157,120,147,183,1,19,82,
+133,74,73,65,73,9,11,16,122,127,58,108,36,33,109,66,115,142,95,80,87,88,47,
+60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,0,5,0,
+40,254,203,8,117,6,199,0,108,0,120,0,132,0,142,0,146,0,0,1,20,6,35,34,38,
+53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,22,23,22,18,21,20,6,6,35,
+34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,54,53,52,39,22,21,20,6,35,34,38,
+53,52,54,51,50,18,21,20,7,22,22,51,50,54,53,52,38,39,34,38,53,52,54,51,51,
+50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,
+38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,19,38,38,35,
+34,6,21,20,51,50,5,19,35,19,8,79,137,115,113,135,31,143,95,102,21,62,22,105,
+100,9,74,88,39,79,89,186,206,96,160,94,94,161,129,64,184,108,142,164,140,
+136,84,155,102,73,90,6,133,113,115,136,145,121,181,227,57,72,121,85,130,147,
+148,162,137,160,147,122,18,109,119,34,38,128,120,142,29,112,109,181,101,87,
+74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,57,66,68,250,71,74,55,62,
+76,73,57,59,78,43,72,124,81,64,74,182,137,1,24,70,246,68,4,151,116,137,126,
+106,64,52,82,106,90,98,62,63,41,56,29,4,53,254,210,224,147,208,106,70,107,
+86,91,127,109,111,124,61,60,101,143,150,95,22,25,115,133,138,117,115,135,
+254,249,213,153,132,37,25,154,159,149,199,73,132,111,115,142,95,80,87,88,
+47,60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,254,
+176,65,73,74,64,64,76,73,254,82,55,48,43,40,89,170,254,192,1,64,0,2,0,85,
+255,245,6,102,6,199,0,81,0,93,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,
+38,35,35,34,6,21,20,22,51,51,50,0,17,20,7,39,54,54,53,52,38,35,34,6,21,20,
+18,23,7,38,53,52,18,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,
+54,51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,
+6,64,137,115,113,135,31,143,95,102,21,62,22,105,100,9,74,88,84,110,77,223,
+1,14,87,215,70,75,177,160,159,178,74,70,217,85,133,118,76,73,147,122,18,109,
+119,34,38,128,120,142,29,112,109,181,101,87,74,101,63,68,20,103,106,81,45,
+123,72,63,61,71,76,57,66,68,4,151,116,137,126,106,64,52,82,106,90,98,62,63,
+61,61,254,196,254,251,206,250,10,146,251,148,184,202,199,182,147,254,254,
+145,11,235,226,178,1,8,68,31,115,72,115,142,95,80,87,88,47,60,84,109,191,
+38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,0,5,0,100,254,203,10,
+214,5,118,0,21,0,89,0,101,0,113,0,117,0,0,1,33,55,33,50,22,22,21,20,6,6,35,
+35,53,51,50,54,54,53,52,38,38,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,
+35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,
+53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,
+52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,23,19,35,
+19,2,62,254,38,15,1,152,178,155,75,76,131,147,148,159,100,77,37,40,84,8,48,
+137,115,113,135,31,254,183,108,111,83,159,109,201,143,36,157,115,108,167,
+54,26,155,104,136,163,165,132,98,141,33,75,161,100,105,127,222,235,6,168,
+1,2,140,2,68,146,93,108,132,125,120,237,15,2,230,126,132,108,57,123,72,63,
+61,71,76,57,66,68,248,157,97,83,81,97,92,84,86,96,174,70,246,68,4,209,165,
+57,109,76,68,109,48,92,19,45,37,39,48,22,254,42,116,137,126,106,64,52,90,
+247,129,113,191,114,237,111,126,126,88,104,110,169,141,136,175,97,80,116,
+101,154,127,172,202,9,168,8,169,254,237,161,53,84,82,145,117,109,216,70,165,
+21,67,108,89,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,235,254,192,
+1,64,0,2,0,65,255,230,7,87,6,199,0,126,0,138,0,0,1,20,6,35,34,38,53,52,55,
+35,34,6,7,35,46,2,35,35,34,6,21,20,22,51,51,7,7,51,21,33,6,7,14,2,21,20,22,
+51,50,55,51,22,22,51,50,54,53,52,39,51,22,21,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,
+20,7,51,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,
+7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,7,49,137,115,
+113,135,31,63,95,102,21,62,16,40,77,64,9,63,69,84,110,50,9,15,219,253,226,
+42,116,75,62,28,82,68,175,60,64,40,104,90,80,82,33,120,36,148,120,101,139,
+43,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,
+4,179,16,115,109,132,107,18,92,115,25,38,128,120,62,29,112,109,181,101,87,
+74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,57,66,68,4,151,116,137,126,
+106,64,52,82,106,63,79,46,68,57,61,61,89,188,88,54,83,54,52,50,36,60,68,216,
+118,98,97,76,80,80,106,116,151,187,102,128,130,100,147,111,88,134,99,61,88,
+47,50,70,71,57,48,36,36,33,92,46,103,128,132,96,29,20,193,20,131,88,114,143,
+98,77,87,88,47,60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,
+67,73,73,0,2,0,65,255,230,6,149,6,199,0,99,0,111,0,0,1,20,6,35,34,38,53,52,
+55,35,34,6,7,35,46,2,35,35,34,6,21,20,22,51,55,22,22,18,21,20,6,35,34,38,
+39,6,6,35,34,38,53,52,55,35,53,33,23,6,6,21,20,22,51,50,55,51,22,22,51,50,
+54,53,52,2,39,35,34,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,
+50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,6,111,
+137,115,113,135,31,63,95,102,21,62,16,40,77,64,9,63,69,110,106,56,152,247,
+147,165,132,115,134,55,57,148,92,124,163,164,229,1,102,30,92,88,91,83,175,
+60,64,34,119,90,88,107,229,200,28,162,191,132,107,18,92,115,25,38,128,120,
+62,29,112,109,181,101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,
+57,66,68,4,151,116,137,126,106,64,52,82,106,63,79,46,68,57,69,59,2,26,152,
+254,253,177,192,239,109,121,130,100,156,122,191,104,104,92,51,102,68,61,76,
+216,115,101,122,123,198,1,2,25,124,127,114,143,98,77,87,88,47,60,84,109,191,
+38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,255,255,0,65,254,203,
+6,149,6,199,2,38,1,250,0,0,0,6,2,159,0,0,0,2,0,75,255,230,7,155,6,199,0,135,
+0,147,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,46,2,35,35,34,6,21,20,22,
+23,30,2,21,20,6,35,34,39,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,
+52,39,51,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,
+34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,7,22,51,50,54,53,52,38,39,46,2,
+53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,7,116,137,115,113,135,31,63,
+95,102,21,62,16,40,77,64,9,63,69,73,102,92,99,75,158,128,168,143,42,120,75,
+62,28,82,68,175,60,64,40,102,88,80,78,34,129,36,162,116,99,131,43,57,148,
+92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,165,3,108,136,
+77,80,61,94,83,96,72,132,107,18,92,115,25,38,128,120,63,29,112,109,181,101,
+87,74,101,63,68,20,102,105,81,46,123,72,63,61,71,76,57,66,68,4,151,116,137,
+126,106,64,52,82,106,63,79,46,68,57,52,62,22,20,34,88,81,106,128,111,57,85,
+54,52,50,36,60,68,216,118,98,73,62,70,62,87,115,121,171,101,129,130,100,147,
+111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,132,96,43,81,
+58,48,44,61,32,28,49,102,85,114,143,98,77,87,88,47,60,84,109,191,38,93,57,
+44,39,25,4,34,64,98,84,64,74,72,66,67,73,73,0,4,0,80,254,203,11,181,5,118,
+0,88,0,100,0,112,0,116,0,0,1,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,
+34,39,6,6,35,34,3,6,6,35,34,0,53,52,54,54,51,51,50,54,54,53,52,38,38,35,33,
+55,33,50,22,22,21,20,6,7,22,22,21,20,7,22,22,51,50,54,53,52,38,39,55,22,4,
+18,21,7,22,22,51,50,54,53,52,38,39,35,55,33,50,30,2,1,52,38,35,34,6,21,20,
+22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,1,19,35,19,11,181,137,115,113,
+135,31,254,183,108,111,83,159,109,202,142,37,157,115,219,150,57,238,165,231,
+254,238,120,229,156,102,100,77,37,40,84,104,254,38,15,1,152,178,155,75,90,
+74,107,118,8,72,151,100,105,127,222,235,6,168,1,2,140,2,68,146,94,108,132,
+125,120,237,15,2,230,126,132,108,57,248,9,201,172,171,201,198,174,176,197,
+7,124,72,63,61,71,76,57,66,68,251,189,70,246,68,2,251,116,137,126,106,64,
+52,90,247,129,113,191,114,238,111,127,1,26,133,149,1,31,237,147,239,139,19,
+45,37,39,48,22,165,57,109,76,75,115,19,68,236,145,53,56,95,93,154,127,172,
+202,9,168,8,169,254,237,161,52,84,83,145,117,109,216,70,165,21,67,108,254,
+246,171,199,200,170,165,189,187,1,88,64,74,72,66,67,73,73,253,108,254,192,
+1,64,0,3,0,60,255,231,9,137,6,199,0,119,0,131,0,142,0,0,1,20,6,35,34,38,53,
+52,55,35,34,6,7,35,46,2,35,35,34,6,21,20,22,51,51,7,7,51,21,33,20,7,22,21,
+20,7,39,54,53,52,39,6,6,35,34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,7,
+35,38,38,35,34,6,21,20,23,7,38,53,52,54,51,50,22,23,54,54,51,50,22,23,51,
+39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,35,
+34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,38,35,34,6,21,20,22,
+51,50,54,9,99,137,115,113,135,31,63,95,102,21,62,16,40,77,64,9,63,69,84,110,
+50,9,15,213,254,15,48,107,23,91,21,54,77,240,126,145,201,219,186,210,137,
+32,117,95,79,105,24,75,24,114,92,90,91,58,77,111,162,125,100,166,33,27,136,
+98,109,146,20,188,16,115,109,132,107,18,92,115,25,38,128,120,62,29,112,109,
+181,101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,57,66,68,251,
+21,116,188,129,133,121,102,104,181,4,151,116,137,126,106,64,52,82,106,63,
+79,46,68,57,61,61,89,188,88,130,129,107,164,81,71,19,72,67,99,74,152,180,
+170,124,127,149,85,73,82,106,115,86,70,71,85,89,66,74,68,37,99,135,123,164,
+133,104,105,132,151,126,193,20,131,88,114,143,98,77,87,88,47,60,84,109,191,
+38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,253,67,75,70,58,57,71,
+98,0,3,0,80,255,230,8,2,6,199,0,107,0,119,0,131,0,0,1,20,6,35,34,38,53,52,
+55,35,34,6,7,35,46,2,35,35,34,6,21,20,51,22,18,21,20,6,6,35,34,38,39,6,6,
+35,34,38,38,53,52,18,55,39,51,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,
+51,50,55,51,22,22,51,50,54,53,52,38,39,34,38,53,52,54,51,51,50,22,23,54,54,
+51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,
+20,22,51,50,54,1,20,22,51,50,54,53,52,38,35,34,6,7,220,137,115,113,135,31,
+63,95,102,21,62,16,40,77,64,9,63,69,171,174,146,96,163,96,88,163,48,52,133,
+84,97,160,93,172,142,17,235,16,85,91,136,115,111,135,10,112,133,116,184,61,
+64,33,141,93,122,138,116,131,126,146,132,107,18,92,115,25,38,128,120,62,29,
+112,109,181,101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,57,66,
+68,250,29,75,57,62,73,73,60,60,74,4,151,116,137,126,106,64,52,82,106,63,79,
+46,68,57,122,79,254,226,199,137,222,126,113,117,122,108,120,226,153,192,1,
+36,48,210,203,23,128,88,117,138,128,106,38,33,126,197,141,158,216,112,104,
+158,141,157,201,88,125,107,114,143,98,77,87,88,47,60,84,109,191,38,93,57,
+44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,254,175,67,73,75,65,64,74,72,
+0,4,0,80,255,230,6,129,6,199,0,70,0,82,0,94,0,106,0,0,1,20,6,35,34,38,53,
+52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,50,22,22,21,20,0,35,34,
+0,53,52,54,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,
+20,22,51,50,54,53,52,38,7,50,22,21,20,6,35,34,38,53,52,54,6,91,137,115,113,
+135,31,143,95,102,21,62,22,105,100,9,74,88,84,110,54,155,229,122,254,236,
+230,231,254,238,137,126,66,63,147,122,18,109,119,34,38,128,120,142,29,112,
+109,181,101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,57,66,68,
+252,105,171,201,198,174,176,197,201,171,54,69,68,55,55,67,68,4,151,116,137,
+126,106,64,52,82,106,90,98,62,63,61,61,138,239,148,238,254,226,1,31,237,157,
+250,64,32,111,66,115,142,95,80,87,88,47,60,84,109,191,38,93,57,44,39,25,4,
+35,64,98,83,64,74,72,66,67,73,73,152,200,170,165,189,187,167,171,199,241,
+69,52,52,68,68,52,52,69,0,3,0,80,255,230,7,5,6,199,0,97,0,109,0,121,0,0,1,
+20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,50,22,
+23,7,38,35,34,6,6,21,20,22,51,50,55,51,22,22,23,38,53,52,54,51,50,22,21,20,
+6,35,32,39,6,6,35,34,38,53,52,18,55,38,53,52,54,51,51,50,22,23,54,54,51,51,
+38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,
+51,50,54,1,20,22,51,50,54,53,52,38,35,34,6,6,223,137,115,113,135,31,73,95,
+102,21,62,22,105,100,9,74,88,84,110,28,121,187,87,62,161,172,145,253,152,
+107,96,175,60,64,32,132,113,96,130,105,118,145,204,143,254,254,106,57,148,
+92,138,166,236,206,106,147,122,18,109,119,34,38,128,120,72,29,112,109,181,
+101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,57,66,68,253,124,
+73,67,65,73,74,64,64,76,4,151,116,137,126,106,64,52,82,106,90,98,62,63,61,
+61,54,58,82,102,132,240,155,101,102,216,109,101,5,53,125,96,119,149,123,143,
+206,230,130,100,203,169,222,1,85,73,67,129,115,142,95,80,87,88,47,60,84,109,
+191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,253,53,59,78,74,
+55,62,76,73,255,255,0,80,254,203,7,5,6,199,2,38,2,1,0,0,0,6,2,159,224,0,0,
+3,0,75,255,230,8,73,6,199,0,125,0,137,0,149,0,0,1,20,6,35,34,38,53,52,55,
+35,34,6,7,35,46,2,35,35,34,6,21,20,22,51,51,50,18,21,20,6,6,35,34,38,53,52,
+54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,22,51,51,
+21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,53,52,54,51,
+50,22,23,54,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,
+23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,
+34,6,21,20,22,51,50,54,8,35,137,115,113,135,31,63,95,102,21,62,16,40,77,64,
+9,63,69,84,110,56,181,236,117,182,94,141,186,147,119,104,133,34,141,180,147,
+107,164,22,78,25,149,125,114,120,134,123,62,80,122,145,131,123,124,132,44,
+139,132,196,243,111,93,84,94,204,156,130,194,53,44,88,82,78,132,107,18,92,
+115,25,38,128,120,62,29,112,109,181,101,87,74,101,63,68,20,103,106,81,45,
+123,72,63,61,71,76,57,66,68,253,88,74,64,64,76,73,67,65,73,4,151,116,137,
+126,106,64,52,82,106,63,79,46,68,57,61,61,254,219,224,168,241,123,174,134,
+125,158,128,101,69,58,99,223,150,189,127,98,104,121,75,68,68,76,98,77,65,
+63,79,33,216,44,178,143,87,122,30,35,117,72,116,149,128,114,111,64,29,119,
+74,114,143,98,77,87,88,47,60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,
+74,72,66,67,73,73,253,15,62,76,73,57,59,78,74,0,4,0,80,255,230,8,113,6,199,
+0,103,0,115,0,127,0,139,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,
+35,34,6,21,20,22,51,51,50,22,22,21,16,0,33,32,0,17,52,18,51,50,22,21,20,6,
+35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,38,39,22,21,20,6,35,34,38,53,
+52,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,
+35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,20,22,51,50,54,
+53,52,38,35,34,6,37,34,6,21,20,22,51,50,54,53,52,38,8,75,137,115,113,135,
+31,83,95,102,21,62,22,105,100,9,74,88,84,110,35,112,186,110,254,128,254,171,
+254,171,254,128,234,174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,
+41,50,42,13,131,105,115,136,73,82,77,147,122,18,109,119,34,38,128,120,82,
+29,112,109,181,101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,57,
+66,68,249,156,75,57,62,73,73,60,60,74,2,236,60,73,73,62,57,75,74,4,151,116,
+137,126,106,64,52,82,106,90,98,62,63,61,61,119,212,135,254,236,254,205,1,
+51,1,20,199,1,11,135,115,117,138,119,98,40,41,41,123,73,173,199,199,173,73,
+123,41,41,40,98,119,138,117,116,67,30,118,74,115,142,95,80,87,88,47,60,84,
+109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,254,175,67,73,
+75,65,64,74,72,72,74,64,65,75,73,67,66,72,0,5,0,80,254,203,6,207,6,199,0,
+76,0,88,0,105,0,117,0,121,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,
+35,35,34,6,21,20,22,51,51,50,4,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,
+18,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,
+35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,5,34,0,21,20,22,51,
+50,55,51,22,51,50,54,53,52,0,7,50,22,21,20,6,35,34,38,53,52,54,19,19,35,19,
+6,169,137,115,113,135,31,143,95,102,21,62,22,105,100,9,74,88,84,110,71,165,
+1,19,161,172,142,91,152,43,44,153,90,143,171,183,161,67,65,147,122,18,109,
+119,34,38,128,120,142,29,112,109,181,101,87,74,101,63,68,20,103,106,81,45,
+123,72,63,61,71,76,57,66,68,252,122,207,254,250,113,94,171,60,63,60,171,94,
+113,254,249,201,54,69,68,55,55,67,68,103,70,246,68,4,151,116,137,126,106,
+64,52,82,106,90,98,62,63,61,61,160,254,223,183,190,227,119,111,111,119,227,
+190,194,1,51,75,32,112,67,115,142,95,80,87,88,47,60,84,109,191,38,93,57,44,
+39,25,4,35,64,98,83,64,74,72,66,67,73,73,152,254,250,205,127,136,216,216,
+136,127,205,1,6,137,69,52,52,68,68,52,52,69,252,241,254,192,1,64,0,3,0,80,
+255,230,6,207,6,199,0,75,0,87,0,105,0,0,1,20,6,35,34,38,53,52,55,35,34,6,
+7,35,38,38,35,35,34,6,21,20,22,51,51,32,0,17,20,6,35,34,38,39,6,6,35,34,38,
+53,52,18,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,
+7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,20,
+22,51,50,55,51,22,22,51,50,54,53,52,2,6,169,137,115,113,135,31,143,95,102,
+21,62,22,105,100,9,74,88,84,110,72,1,16,1,73,159,138,115,134,55,57,148,92,
+144,160,179,158,64,61,147,122,18,109,119,34,38,128,120,142,29,112,109,181,
+101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,76,57,66,68,252,123,
+223,247,110,93,175,60,64,34,119,90,90,105,247,4,151,116,137,126,106,64,52,
+82,106,90,98,62,63,61,61,254,174,254,232,201,230,109,121,130,100,228,203,
+201,1,40,69,33,109,65,115,142,95,80,87,88,47,60,84,109,191,38,93,57,44,39,
+25,4,35,64,98,83,64,74,72,66,67,73,73,152,253,234,129,114,216,115,101,117,
+128,229,1,0,255,255,0,80,254,203,6,207,6,199,2,38,2,6,0,0,0,6,2,159,218,0,
+0,2,0,70,255,230,7,59,6,199,0,93,0,105,0,0,1,20,6,35,34,38,53,52,55,35,34,
+6,7,35,38,38,35,35,34,6,21,20,51,55,4,0,21,20,6,35,34,38,39,38,38,35,34,21,
+20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,53,52,38,39,7,34,38,53,52,
+54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,
+30,3,7,52,38,35,34,6,21,20,22,51,50,54,7,21,137,115,113,135,31,143,95,102,
+21,62,22,105,100,9,74,88,181,42,1,22,1,51,174,179,134,186,84,70,97,57,126,
+48,37,195,21,23,159,129,93,137,87,57,80,101,68,219,233,210,32,154,171,147,
+122,18,109,119,34,38,128,120,142,29,112,109,181,101,87,74,101,63,68,20,103,
+106,81,45,123,72,63,61,71,76,57,66,68,4,151,116,137,126,106,64,52,82,106,
+90,98,62,63,123,1,40,254,187,253,197,234,152,160,132,100,185,83,179,72,10,
+65,158,58,150,186,82,116,75,83,49,245,201,255,29,1,133,115,115,142,95,80,
+87,88,47,60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,73,
+73,0,3,0,75,255,230,8,2,6,38,0,91,0,103,0,115,0,0,1,20,6,35,34,38,53,52,55,
+35,22,21,16,2,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,
+53,52,39,33,34,6,7,35,38,38,35,35,34,6,21,20,23,7,38,38,53,52,54,51,51,50,
+22,23,54,54,51,51,38,37,55,4,19,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,
+23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,
+54,7,220,137,115,113,135,31,209,44,195,190,111,169,54,26,155,104,136,163,
+165,132,98,141,33,75,161,100,132,153,45,254,199,95,102,21,62,22,105,100,9,
+71,92,50,66,57,62,157,125,18,109,119,34,38,128,120,201,146,254,201,6,1,154,
+170,1,49,29,112,109,181,101,87,74,101,63,68,19,102,106,82,46,123,72,63,61,
+71,76,57,66,68,250,203,97,83,81,97,92,84,86,96,3,68,116,137,126,106,64,52,
+159,181,254,217,254,190,126,88,104,110,169,141,136,175,97,80,116,101,228,
+196,170,136,82,106,90,98,68,51,53,40,75,31,110,62,107,142,95,80,87,88,228,
+82,168,130,254,164,47,59,84,109,191,38,93,57,44,38,25,4,34,64,98,84,64,74,
+72,66,67,73,73,254,97,81,97,96,83,77,93,88,255,255,0,75,254,203,8,2,6,38,
+0,38,2,9,0,0,0,6,2,159,213,0,0,2,0,75,255,230,7,72,6,199,0,121,0,133,0,0,
+1,20,6,35,34,38,53,52,55,35,34,6,7,35,46,2,35,35,34,6,21,20,51,55,30,2,21,
+20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,38,35,34,6,21,20,
+23,7,38,38,53,52,54,51,50,22,21,20,6,7,14,2,21,20,22,51,50,55,51,22,22,51,
+50,54,53,52,38,39,7,34,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,
+51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,7,34,
+137,115,113,135,31,63,95,102,21,62,16,40,77,64,9,63,69,167,46,120,193,111,
+85,145,87,99,149,56,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,
+156,125,122,165,79,124,75,62,28,82,68,175,60,64,34,114,89,111,126,184,154,
+28,122,157,132,107,18,92,115,25,38,128,120,62,29,112,109,181,101,87,74,101,
+63,68,20,103,106,81,45,123,72,63,61,71,76,57,66,68,4,151,116,137,126,106,
+64,52,82,106,63,79,46,68,57,124,2,20,154,253,160,142,209,111,101,129,130,
+100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,128,134,
+97,72,108,91,54,52,50,36,60,68,216,115,101,168,145,169,207,48,1,129,112,114,
+143,98,77,87,88,47,60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,
+66,67,73,73,255,255,0,75,254,203,7,72,6,199,2,38,2,11,0,0,0,6,2,159,229,0,
+0,3,0,75,255,230,10,36,6,162,0,103,0,115,0,127,0,0,1,20,6,35,34,38,53,52,
+55,33,22,22,21,20,6,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,
+22,23,22,22,51,50,54,53,52,38,38,35,35,53,33,50,54,54,53,52,38,38,35,33,55,
+33,50,23,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,22,22,21,20,6,7,22,18,
+21,21,22,22,51,50,54,53,52,38,39,35,55,33,50,30,2,7,52,38,35,34,6,21,20,22,
+51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,10,36,137,115,113,135,31,254,183,
+108,111,83,159,109,203,144,34,164,130,114,164,55,25,155,104,136,163,165,132,
+98,141,33,75,161,100,114,119,131,230,145,176,1,21,100,77,37,40,84,104,253,
+175,15,2,15,75,47,32,112,109,181,101,87,74,101,63,68,68,68,72,84,72,161,188,
+69,149,96,108,132,125,120,237,15,2,230,126,132,108,57,123,72,63,61,71,76,
+57,66,68,248,131,97,83,81,97,92,84,86,96,2,251,116,137,126,106,64,52,90,247,
+129,113,191,114,242,114,128,124,90,104,110,169,141,136,175,97,80,116,101,
+127,118,150,219,116,92,19,45,37,39,48,22,165,4,48,63,84,109,191,38,93,57,
+44,64,33,26,107,75,72,113,21,65,254,232,200,28,89,87,145,117,109,216,70,165,
+21,67,108,89,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,0,3,0,80,255,
+230,11,139,6,162,0,101,0,113,0,125,0,0,1,20,6,35,34,38,53,52,55,33,22,18,
+21,20,6,35,34,39,6,6,35,34,39,6,6,35,34,0,53,52,54,54,51,50,22,22,21,20,7,
+22,22,51,50,54,53,52,38,39,33,53,51,50,54,54,53,52,38,38,35,33,55,33,23,38,
+53,52,54,51,50,23,7,38,35,34,6,21,20,23,22,22,21,20,6,7,22,18,21,7,22,22,
+51,50,54,53,16,37,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,52,38,
+35,34,6,21,20,22,51,50,54,11,139,137,115,113,135,31,254,137,120,135,181,158,
+202,144,39,153,103,208,146,61,230,156,231,254,238,120,229,156,155,229,122,
+14,66,135,85,115,141,120,120,254,254,229,100,77,37,40,84,104,253,224,15,1,
+222,73,30,112,109,181,101,87,74,101,63,68,28,108,119,103,87,107,105,3,67,
+146,94,105,127,254,60,17,2,204,126,132,108,57,122,72,63,61,71,76,57,66,68,
+248,173,201,172,171,201,198,174,176,197,3,68,116,137,126,106,64,52,83,254,
+241,157,206,240,240,116,124,254,120,134,1,31,237,147,239,139,138,239,148,
+71,67,80,79,171,137,133,226,63,92,19,45,37,39,48,22,165,1,46,62,84,109,191,
+38,93,57,44,47,26,16,119,97,80,120,14,82,254,250,149,81,84,83,154,127,1,92,
+69,197,21,67,108,89,64,74,72,66,67,73,73,183,171,199,200,170,165,189,187,
+0,3,0,80,255,230,6,120,6,199,0,70,0,82,0,94,0,0,1,20,6,35,34,38,53,52,55,
+35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,51,50,22,22,21,20,0,35,34,0,53,
+52,54,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,
+38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,20,22,
+51,50,54,53,52,38,6,82,137,115,113,135,31,143,95,102,21,62,22,105,100,9,74,
+88,84,110,63,155,229,122,254,236,230,231,254,238,135,123,68,65,147,122,18,
+109,119,34,38,128,120,142,29,112,109,181,101,87,74,101,63,68,20,103,106,81,
+45,123,72,63,61,71,76,57,66,68,252,114,171,201,198,174,176,197,201,4,151,
+116,137,126,106,64,52,82,106,90,98,62,63,61,61,138,239,148,238,254,226,1,
+31,237,156,248,65,32,111,68,115,142,95,80,87,88,47,60,84,109,191,38,93,57,
+44,39,25,4,35,64,98,83,64,74,72,66,67,73,73,152,200,170,165,189,187,167,171,
+199,0,3,0,80,255,230,8,23,6,199,0,90,0,102,0,114,0,0,1,20,6,35,34,38,53,52,
+55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,22,51,51,22,17,16,0,33,32,0,17,
+52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,51,32,36,53,52,38,39,38,
+38,53,52,54,51,51,50,22,23,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,20,22,51,50,54,53,52,38,35,
+34,6,7,254,137,115,113,135,31,89,89,96,20,62,22,105,100,9,74,88,36,73,85,
+46,246,254,208,254,188,254,221,254,202,226,182,122,144,136,115,113,133,6,
+90,1,10,241,1,8,1,6,102,87,149,168,147,122,18,109,119,34,64,222,62,29,112,
+109,181,101,87,74,101,63,68,20,109,108,84,47,123,72,63,61,71,76,57,66,68,
+249,233,75,57,62,73,73,60,60,74,4,151,116,137,126,106,64,52,83,105,90,98,
+62,63,39,54,29,174,254,214,254,225,254,222,1,42,1,19,212,1,8,135,115,117,
+138,133,115,25,22,95,150,173,188,183,190,117,180,54,1,131,115,115,142,95,
+80,175,47,60,84,109,191,38,93,57,44,39,25,3,33,64,100,84,64,74,72,66,67,73,
+73,254,175,67,73,75,65,64,74,72,0,3,0,75,255,230,6,228,6,199,0,89,0,101,0,
+113,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,20,22,51,
+51,22,4,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,
+50,54,53,52,38,39,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,
+51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,52,
+38,35,34,6,21,20,22,51,50,54,6,190,137,115,113,135,31,73,95,102,21,62,22,
+105,100,9,74,88,84,110,49,169,1,15,155,172,173,114,172,54,26,155,104,136,
+163,165,132,98,141,33,75,161,100,119,119,249,226,82,143,135,147,122,18,109,
+119,34,38,128,120,72,29,112,109,181,101,87,74,101,63,68,20,103,106,81,45,
+123,72,63,61,71,76,57,66,68,251,233,97,83,81,97,92,84,86,96,4,151,116,137,
+126,106,64,52,82,106,90,98,62,63,61,61,10,155,254,248,167,206,247,126,88,
+104,110,169,141,136,175,97,80,116,101,128,119,202,242,39,1,11,137,98,115,
+142,95,80,87,88,47,60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,
+66,67,73,73,253,14,81,97,96,83,77,93,88,0,3,0,40,255,230,7,119,6,199,0,100,
+0,112,0,124,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,38,38,35,35,34,6,21,
+20,22,51,51,22,22,21,20,6,7,7,22,21,20,6,35,34,38,53,52,55,55,38,38,35,34,
+21,20,23,7,38,38,53,52,54,51,50,4,23,55,54,54,53,52,38,39,35,34,38,53,52,
+54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,
+30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,7,6,6,21,20,22,51,50,54,53,52,7,
+80,137,115,113,135,31,73,95,102,21,62,22,105,100,9,74,88,84,110,72,89,109,
+65,70,140,98,173,149,142,190,212,211,63,192,110,157,22,74,45,49,134,107,137,
+1,18,101,140,45,39,55,53,58,152,170,147,122,18,109,119,34,38,128,120,73,29,
+112,109,181,101,87,74,101,63,68,20,102,105,81,46,123,72,63,61,71,76,57,66,
+68,252,28,142,78,68,84,68,80,98,4,151,116,137,126,106,64,52,82,106,90,98,
+62,63,61,61,7,88,77,61,82,35,70,177,154,136,162,167,122,162,107,106,90,108,
+124,35,49,36,47,101,65,97,121,192,150,71,23,42,33,38,37,6,130,117,115,142,
+95,80,87,88,47,60,84,109,191,38,93,57,44,39,25,4,34,64,98,84,64,74,72,66,
+67,73,73,253,244,72,39,76,43,56,72,85,88,93,0,3,0,76,255,230,8,3,6,38,0,106,
+0,118,0,130,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,7,6,21,20,22,51,50,55,
+23,6,35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,39,33,34,6,7,35,38,38,35,35,34,6,21,20,23,7,38,38,53,52,54,
+51,51,50,22,23,54,54,51,51,38,37,55,4,19,33,38,53,52,54,51,50,23,7,38,35,
+34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,
+22,51,50,54,7,221,137,115,113,135,31,210,44,23,11,51,41,56,53,82,74,93,66,
+104,24,45,141,88,107,160,65,25,156,104,136,163,165,132,104,145,30,75,155,
+102,132,149,45,254,200,95,102,21,62,22,105,100,9,71,92,50,66,57,62,157,125,
+18,109,119,34,38,128,120,200,146,254,201,6,1,154,170,1,50,29,112,109,181,
+101,87,74,101,63,68,19,102,106,82,46,123,72,63,61,71,76,57,66,68,250,203,
+97,83,81,97,92,84,86,96,3,68,116,137,126,106,64,52,159,181,122,128,62,24,
+43,51,37,170,54,77,62,66,73,109,106,104,111,169,141,136,175,108,87,101,98,
+224,200,170,136,82,106,90,98,68,51,53,40,75,31,110,62,107,142,95,80,87,88,
+228,82,168,130,254,164,47,59,84,109,191,38,93,57,44,38,25,4,34,64,98,84,64,
+74,72,66,67,73,73,254,97,81,97,96,83,77,93,88,0,2,0,90,255,230,8,9,6,38,0,
+97,0,109,0,0,1,20,6,35,34,38,53,52,55,35,22,21,16,2,35,34,38,39,38,38,35,
+34,21,20,22,23,7,38,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,33,34,
+6,7,35,38,38,35,35,34,6,21,20,23,7,38,38,53,52,54,51,51,50,22,23,54,54,51,
+51,38,37,55,4,19,33,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,
+38,35,34,6,21,20,22,51,50,54,7,227,137,115,113,135,31,209,44,197,195,131,
+182,86,70,97,57,126,48,37,195,21,23,159,129,93,137,87,94,127,76,129,151,45,
+254,199,95,102,21,62,22,105,100,9,71,92,50,66,57,62,157,125,18,109,119,34,
+38,128,120,201,146,254,201,6,1,154,170,1,49,29,112,109,181,101,87,74,101,
+63,68,19,102,106,82,46,123,72,63,61,71,76,57,66,68,3,68,116,137,126,106,64,
+52,159,181,254,217,254,190,149,163,132,100,185,83,179,72,10,65,158,58,150,
+186,82,116,125,82,229,195,170,136,82,106,90,98,68,51,53,40,75,31,110,62,107,
+142,95,80,87,88,228,82,168,130,254,164,47,59,84,109,191,38,93,57,44,38,25,
+4,34,64,98,84,64,74,72,66,67,73,73,0,5,0,75,255,230,10,80,6,199,0,103,0,117,
+0,129,0,141,0,153,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,35,46,2,35,35,34,
+6,21,20,23,30,3,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,35,34,38,39,
+6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,35,55,33,38,
+53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,21,
+20,23,30,3,37,55,22,23,54,0,55,23,6,4,7,35,38,38,5,52,38,35,34,6,21,20,22,
+51,50,54,5,34,6,21,20,22,51,50,54,53,52,38,1,52,38,35,34,6,21,20,22,51,50,
+54,10,42,137,115,113,135,31,63,95,102,21,62,16,40,77,64,9,64,68,83,124,119,
+92,52,137,115,113,135,31,254,183,108,111,83,159,109,107,161,65,25,155,105,
+136,163,165,132,103,144,31,75,156,103,108,132,124,121,237,15,2,110,50,132,
+107,18,92,115,25,38,128,120,62,29,112,109,181,101,87,74,101,63,68,20,103,
+106,81,45,246,33,216,47,63,92,1,65,113,99,205,254,206,90,70,71,162,9,53,72,
+63,61,71,76,57,66,68,252,209,61,71,76,57,66,68,72,251,109,97,83,81,97,92,
+84,86,96,4,151,116,137,126,106,64,52,82,106,63,79,46,70,60,85,32,1,31,64,
+102,62,116,137,126,106,64,52,90,247,129,113,191,114,111,106,105,112,169,141,
+136,175,106,86,103,99,145,117,115,210,70,165,66,84,119,143,98,77,87,88,47,
+60,84,109,191,38,93,57,44,39,25,4,35,64,98,42,12,152,119,67,1,45,122,99,192,
+237,47,43,195,19,64,74,72,66,67,73,73,207,72,66,67,73,73,67,64,74,253,221,
+81,97,96,83,77,93,88,0,3,0,80,255,230,7,251,6,199,0,123,0,135,0,147,0,0,1,
+20,6,35,34,38,53,52,55,35,34,6,7,35,46,2,35,35,34,6,21,20,22,51,51,50,18,
+21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,22,21,20,6,35,34,38,
+53,52,55,6,6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,52,38,35,34,6,21,20,
+22,23,7,33,53,33,38,38,53,52,55,38,38,53,52,54,51,51,50,22,23,54,54,51,51,
+38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,
+51,50,54,1,20,22,51,50,54,53,52,38,35,34,6,7,213,137,115,113,135,31,63,95,
+102,21,62,16,40,77,64,9,63,69,84,110,57,148,170,99,167,100,103,161,42,42,
+161,103,100,167,99,232,176,122,144,136,115,113,133,5,41,48,78,125,70,214,
+60,64,60,214,70,125,78,108,93,39,52,58,64,30,254,120,1,17,61,55,38,103,99,
+132,107,18,92,115,25,38,128,120,62,29,112,109,181,101,87,74,101,63,68,20,
+103,106,81,45,123,72,63,61,71,76,57,66,68,250,18,78,59,57,73,76,62,55,74,
+4,151,116,137,126,106,64,52,82,106,63,79,46,68,57,61,61,254,238,235,166,245,
+129,125,105,105,125,129,245,166,219,1,34,135,115,117,138,133,115,20,25,48,
+147,81,107,151,76,216,216,76,151,107,154,181,51,45,51,73,28,92,104,47,89,
+58,64,51,24,127,84,114,143,98,77,87,88,47,60,84,109,191,38,93,57,44,39,25,
+4,35,64,98,83,64,74,72,66,67,73,73,254,175,67,73,76,64,64,74,73,0,4,0,70,
+255,231,7,98,6,199,0,105,0,117,0,129,0,141,0,0,1,20,6,35,34,38,53,52,55,35,
+34,6,7,35,46,2,35,35,34,6,21,20,22,51,55,22,22,21,20,6,7,22,21,20,6,35,34,
+38,53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,
+22,23,22,23,54,54,53,52,38,39,38,38,53,52,54,51,51,50,22,23,54,54,51,51,38,
+53,52,54,51,50,23,7,38,35,34,6,21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,
+50,54,1,20,22,51,50,54,53,52,38,35,34,6,1,52,38,35,34,6,21,20,22,51,50,54,
+7,60,137,115,113,135,31,63,95,102,21,62,16,40,77,64,9,63,69,88,79,27,118,
+139,193,158,40,130,107,112,126,41,153,185,93,166,104,108,128,121,102,101,
+118,6,80,126,166,175,91,138,162,99,95,122,116,132,107,18,92,115,25,38,128,
+120,62,29,112,109,181,101,87,74,101,63,68,20,103,106,81,45,123,72,63,61,71,
+76,57,66,68,250,134,64,49,53,62,62,51,51,64,1,162,71,65,68,69,70,66,67,70,
+4,151,116,137,126,106,64,52,82,106,63,79,46,68,57,61,62,1,33,183,122,141,
+178,33,58,86,96,118,109,95,65,47,13,191,143,100,178,107,120,102,104,123,119,
+102,21,21,80,86,73,109,13,14,50,25,147,115,89,113,35,18,133,91,114,143,98,
+77,87,88,47,60,84,109,191,38,93,57,44,39,25,4,35,64,98,83,64,74,72,66,67,
+73,73,254,206,58,62,64,56,54,63,60,253,153,49,51,54,47,46,53,52,0,3,0,33,
+254,79,6,18,6,199,0,95,0,107,0,139,0,0,1,20,6,35,34,38,53,52,55,35,34,6,7,
+35,38,38,35,35,34,6,21,20,22,51,51,50,22,23,7,38,38,35,34,6,21,20,22,23,23,
+22,22,21,20,6,35,32,3,55,22,51,50,54,53,52,38,39,39,38,38,53,52,54,55,38,
+38,53,52,54,51,51,50,22,23,54,54,51,51,38,53,52,54,51,50,23,7,38,35,34,6,
+21,20,23,30,3,7,52,38,35,34,6,21,20,22,51,50,54,1,21,34,38,39,6,6,35,34,39,
+6,35,34,38,53,52,55,51,22,22,51,50,55,51,22,51,50,54,55,51,22,22,5,235,137,
+115,113,135,31,143,95,102,21,62,22,105,100,9,74,88,84,110,56,146,218,102,
+96,94,175,113,126,116,117,139,123,186,148,227,183,254,191,170,100,156,233,
+127,142,92,109,129,192,178,69,68,64,62,147,122,18,109,119,34,38,128,120,143,
+29,112,109,181,101,87,74,101,63,68,20,102,105,81,46,123,72,63,61,71,76,57,
+66,68,254,121,53,91,29,13,101,70,129,65,65,129,82,106,6,54,12,73,64,110,33,
+60,33,110,64,73,12,54,23,75,4,151,116,137,126,106,64,52,82,106,90,98,62,63,
+61,61,87,77,111,92,91,94,71,78,70,11,10,16,157,120,147,183,1,19,82,133,74,
+73,65,73,9,11,16,122,127,58,108,36,33,109,66,115,142,95,80,87,88,47,60,84,
+109,191,38,93,57,44,39,25,4,34,64,98,84,64,74,72,66,67,73,73,250,246,166,
+63,60,93,90,150,150,121,125,39,47,85,73,116,116,73,85,61,45,0,2,0,17,255,
+230,5,152,5,45,0,63,0,75,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,7,22,23,
+7,38,38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,53,52,
+38,39,39,38,38,53,52,54,54,51,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,
+34,6,21,20,22,51,50,54,5,152,137,115,113,135,31,218,25,53,101,107,96,94,175,
+113,126,116,117,139,123,186,148,227,183,254,191,170,100,156,233,127,142,92,
+109,129,192,178,83,173,128,97,99,28,254,18,15,3,93,126,132,108,57,123,72,
+63,61,71,76,57,66,68,4,41,116,137,126,106,64,52,35,43,61,43,39,80,111,92,
+91,94,71,78,70,11,10,16,157,120,147,183,1,19,82,133,74,73,65,73,9,11,16,122,
+127,63,117,75,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,0,5,0,40,254,
+203,7,132,5,45,0,80,0,92,0,104,0,114,0,118,0,0,1,20,6,35,34,38,53,52,55,35,
+22,21,20,6,7,22,18,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,
+54,53,52,39,22,21,20,6,35,34,38,53,52,54,51,50,18,21,20,7,22,22,51,50,54,
+53,52,38,39,35,7,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,
+22,51,50,54,5,52,38,35,34,6,21,20,22,51,50,54,3,50,55,38,38,35,34,6,21,20,
+5,19,35,19,7,132,137,115,113,135,31,218,25,47,44,115,113,100,165,97,70,138,
+127,64,184,108,142,164,140,136,84,155,102,73,90,6,133,113,115,136,145,121,
+181,227,57,72,117,67,138,144,119,119,7,252,241,99,28,253,115,15,3,252,126,
+132,108,57,123,72,63,61,71,76,57,66,68,251,18,74,55,62,76,73,57,59,78,190,
+137,96,72,124,81,64,74,2,87,70,246,68,4,41,116,137,126,106,64,52,35,43,40,
+67,20,78,254,248,153,150,220,115,73,104,86,91,127,109,111,124,61,60,101,143,
+150,95,22,25,115,133,138,117,115,135,254,249,213,153,131,37,26,173,157,131,
+210,61,1,91,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,226,65,73,74,64,
+64,76,73,254,13,69,55,48,43,40,89,170,254,192,1,64,0,2,0,85,255,245,6,43,
+5,45,0,50,0,62,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,7,22,18,21,20,7,
+39,54,54,53,52,38,35,34,6,21,20,18,23,7,38,53,16,0,51,51,50,53,52,39,33,55,
+33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,6,43,137,115,113,135,31,218,
+25,44,42,115,128,87,215,70,75,177,160,159,178,74,70,217,85,1,18,222,122,99,
+28,254,18,15,3,93,126,132,108,57,123,72,63,61,71,76,57,66,68,4,41,116,137,
+126,106,64,52,35,43,38,67,20,68,254,247,178,206,250,10,146,251,148,184,202,
+199,182,147,254,254,145,11,235,226,1,2,1,59,73,40,24,165,21,67,108,89,64,
+74,72,66,67,73,73,0,5,0,60,254,203,9,86,5,226,0,13,0,93,0,105,0,117,0,121,
+0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,5,20,6,35,34,38,53,52,55,35,22,
+21,20,6,7,22,18,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,
+50,22,23,22,22,51,50,54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,
+38,39,7,7,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,
+50,54,1,52,38,35,34,6,21,20,22,51,50,54,23,19,35,19,62,216,47,63,92,1,65,
+113,99,205,254,206,90,70,71,162,8,233,137,115,113,135,31,218,25,39,37,144,
+158,175,154,201,143,36,157,115,108,167,54,26,155,104,136,163,165,132,98,141,
+33,75,161,100,105,127,222,235,6,168,1,2,140,2,68,137,87,117,139,166,142,25,
+172,161,99,28,254,18,15,3,93,126,132,108,57,123,72,63,61,71,76,57,66,68,249,
+66,97,83,81,97,92,84,86,96,174,70,246,68,4,251,12,152,119,67,1,45,122,99,
+192,237,47,43,195,104,116,137,126,106,64,52,35,43,36,64,20,84,254,225,162,
+212,243,237,111,126,126,88,104,110,169,141,136,175,97,80,116,101,154,127,
+172,202,9,168,8,169,254,237,161,53,84,82,156,132,140,235,70,1,1,91,73,40,
+24,165,21,67,108,89,64,74,72,66,67,73,73,253,124,81,97,96,83,77,93,88,235,
+254,192,1,64,0,2,0,65,255,230,6,186,5,45,0,95,0,107,0,0,1,20,6,35,34,38,53,
+52,55,35,22,21,20,6,7,7,51,21,33,6,7,14,2,21,20,22,51,50,55,51,22,22,51,50,
+54,53,52,39,51,22,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,55,54,54,53,52,
+38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,7,51,39,7,53,51,50,53,
+52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,6,186,137,115,113,
+135,31,218,25,69,64,16,219,253,226,42,116,75,62,28,82,68,175,60,64,40,104,
+90,80,82,33,120,36,148,120,101,139,43,57,148,92,134,174,98,138,87,67,68,59,
+59,75,22,74,41,48,156,125,122,165,4,179,15,108,161,99,28,254,18,15,3,93,126,
+132,108,57,123,72,63,61,71,76,57,66,68,4,41,116,137,126,106,64,52,35,43,48,
+78,15,195,88,54,83,54,52,50,36,60,68,216,118,98,97,76,80,80,106,116,151,187,
+102,128,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,
+103,128,132,96,29,20,187,1,91,73,40,24,165,21,67,108,89,64,74,72,66,67,73,
+73,0,2,0,65,255,230,6,157,5,45,0,68,0,80,0,0,1,20,6,35,34,38,53,52,55,35,
+22,21,20,6,7,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,55,35,53,33,23,
+6,6,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,38,39,7,53,33,50,53,52,39,
+33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,6,157,137,115,113,135,
+31,218,25,43,42,176,193,165,132,115,134,55,57,148,92,124,163,164,229,1,102,
+30,92,88,91,83,175,60,64,34,119,90,88,107,125,220,139,224,1,85,99,28,253,
+165,15,3,202,126,132,108,57,123,72,63,61,71,76,57,66,68,4,41,116,137,126,
+106,64,52,35,43,38,67,20,63,254,221,198,192,239,109,121,130,100,156,122,191,
+104,104,92,51,102,68,61,76,216,115,101,122,123,146,217,119,5,1,91,73,40,24,
+165,21,67,108,89,64,74,72,66,67,73,73,255,255,0,65,254,203,6,157,5,45,2,38,
+2,30,0,0,0,6,2,159,1,0,0,2,0,75,255,230,7,19,5,45,0,103,0,115,0,0,1,20,6,
+35,34,38,53,52,55,35,22,21,20,7,22,22,21,20,6,35,34,39,6,7,14,2,21,20,22,
+51,50,55,51,22,22,51,50,54,53,52,39,51,22,21,20,6,35,34,38,39,6,6,35,34,38,
+53,52,54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,
+7,22,51,50,54,53,52,35,55,7,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,
+34,6,21,20,22,51,50,54,7,19,137,115,113,135,31,218,25,57,53,54,154,132,168,
+143,42,120,75,62,28,82,68,175,60,64,40,102,88,80,78,34,129,36,162,116,99,
+131,43,57,148,92,134,174,98,138,87,67,68,59,59,75,22,74,41,48,156,125,122,
+165,3,108,136,75,82,159,7,195,241,99,28,253,115,15,3,252,126,132,108,57,123,
+72,63,61,71,76,57,66,68,4,41,116,137,126,106,64,52,35,43,64,43,26,95,60,112,
+130,111,57,85,54,52,50,36,60,68,216,118,98,73,62,70,62,87,115,121,171,101,
+129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,48,36,36,33,92,46,103,
+128,132,96,43,81,66,60,134,2,1,91,73,40,24,165,21,67,108,89,64,74,72,66,67,
+73,73,0,4,0,80,254,203,11,70,5,226,0,91,0,103,0,115,0,119,0,0,1,20,6,35,34,
+38,53,52,55,35,22,21,20,6,7,22,18,21,20,6,35,34,39,6,6,35,34,3,6,6,35,34,
+0,53,52,18,55,38,39,55,22,23,55,54,0,55,23,4,7,22,18,21,20,7,22,22,51,50,
+54,53,52,38,39,55,22,4,18,21,7,22,22,51,50,54,53,52,38,39,7,53,51,50,53,52,
+39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,
+20,22,51,50,54,1,19,35,19,11,70,137,115,113,135,31,218,25,53,50,135,147,175,
+154,203,146,36,158,117,219,150,57,238,165,231,254,238,182,158,129,66,216,
+46,61,12,95,1,57,109,99,254,240,200,178,209,8,72,151,100,105,127,222,235,
+6,168,1,2,140,1,69,140,90,117,139,165,141,232,241,99,28,253,115,15,3,252,
+126,132,108,57,123,72,63,61,71,76,57,66,68,248,243,201,172,171,201,198,174,
+176,197,3,57,70,246,68,4,41,116,137,126,106,64,52,35,43,42,71,19,87,254,234,
+156,212,243,246,115,131,1,26,133,149,1,31,237,184,1,13,49,124,151,12,151,
+114,1,71,1,38,118,99,254,142,37,254,235,199,53,56,95,93,154,127,172,202,9,
+168,8,169,254,237,161,43,89,87,156,132,139,234,71,1,91,73,40,24,165,21,67,
+108,89,64,74,72,66,67,73,73,254,100,171,199,200,170,165,189,187,254,129,254,
+192,1,64,0,3,0,60,255,231,8,191,5,45,0,88,0,100,0,111,0,0,1,20,6,35,34,38,
+53,52,55,35,22,21,20,6,7,7,51,21,33,20,7,22,21,20,7,39,54,53,52,39,6,6,35,
+34,38,53,52,54,51,50,23,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,23,7,
+38,53,52,54,51,50,22,23,54,54,51,50,22,23,51,39,7,53,51,50,53,52,39,33,55,
+33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,38,35,34,6,21,20,22,51,50,
+54,8,191,137,115,113,135,31,218,25,45,42,17,213,254,15,48,107,23,91,21,54,
+77,240,126,145,201,219,186,210,137,32,117,95,79,105,24,75,24,114,92,90,91,
+58,77,111,162,125,100,166,33,27,136,98,109,146,20,188,15,153,161,99,28,254,
+18,15,3,93,126,132,108,57,123,72,63,61,71,76,57,66,68,251,185,116,188,129,
+133,121,102,104,181,4,41,116,137,126,106,64,52,35,43,39,66,20,211,88,130,
+129,107,164,81,71,19,72,67,99,74,152,180,170,124,127,149,85,73,82,106,115,
+86,70,71,85,89,66,74,68,37,99,135,123,164,133,104,105,132,151,126,187,1,91,
+73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,253,177,75,70,58,57,71,98,
+0,3,0,80,255,230,7,177,5,45,0,80,0,92,0,104,0,0,1,20,6,35,34,38,53,52,55,
+35,22,21,20,6,35,35,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,
+55,39,51,7,22,22,21,20,6,35,34,38,53,52,55,6,21,20,22,51,50,55,51,22,22,51,
+50,54,53,52,38,39,35,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,
+20,22,51,50,54,5,20,22,51,50,54,53,52,38,35,34,6,7,177,137,115,113,135,31,
+139,25,112,91,29,100,99,96,163,96,88,163,48,52,133,84,97,160,93,172,142,17,
+235,16,85,91,136,115,111,135,10,112,133,116,184,61,64,33,141,93,117,143,124,
+120,83,241,99,28,253,235,15,3,53,126,132,108,57,123,72,63,61,71,76,57,66,
+68,250,72,75,57,62,73,73,60,60,74,4,41,116,137,126,106,64,52,35,43,65,84,
+81,250,143,137,222,126,113,117,122,108,120,226,153,192,1,36,48,210,203,23,
+128,88,117,138,128,106,38,33,126,197,141,158,216,112,104,142,147,136,240,
+66,91,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,227,67,73,75,65,64,74,
+72,0,4,0,80,255,230,6,45,5,45,0,38,0,50,0,62,0,74,0,0,1,20,6,35,34,38,53,
+52,55,35,22,21,20,7,22,22,21,20,0,35,34,0,53,52,54,54,51,51,50,53,52,39,33,
+55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,20,22,51,50,54,
+53,52,38,7,50,22,21,20,6,35,34,38,53,52,54,6,45,137,115,113,135,31,218,25,
+78,119,131,254,236,230,231,254,238,120,229,156,120,99,28,254,18,15,3,93,126,
+132,108,57,123,72,63,61,71,76,57,66,68,252,151,171,201,198,174,176,197,201,
+171,54,69,68,55,55,67,68,4,41,116,137,126,106,64,52,35,43,77,43,66,245,153,
+238,254,226,1,31,237,147,239,139,73,40,24,165,21,67,108,89,64,74,72,66,67,
+73,73,42,200,170,165,189,187,167,171,199,241,69,52,52,68,68,52,52,69,0,3,
+0,80,255,230,7,158,5,45,0,66,0,78,0,90,0,0,1,20,6,35,34,38,53,52,55,35,22,
+21,20,6,7,23,7,38,35,34,6,6,21,20,22,51,50,55,51,22,22,23,38,53,52,54,51,
+50,22,21,20,6,35,32,39,6,6,35,34,38,53,52,18,36,51,33,50,53,52,39,33,55,33,
+50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,20,22,51,50,54,53,52,38,35,34,
+6,7,158,137,115,113,135,31,218,25,89,81,38,62,161,172,145,253,152,107,96,
+175,60,64,32,132,113,96,130,105,118,145,204,143,254,254,106,57,148,92,138,
+166,191,1,56,178,1,57,99,28,253,165,15,3,202,126,132,108,57,123,72,63,61,
+71,76,57,66,68,252,189,73,67,65,73,74,64,64,76,4,41,116,137,126,106,64,52,
+35,43,55,84,8,24,82,102,132,240,155,101,102,216,109,101,5,53,125,96,119,149,
+123,143,206,230,130,100,203,169,203,1,52,166,73,40,24,165,21,67,108,89,64,
+74,72,66,67,73,73,253,163,59,78,74,55,62,76,73,255,255,0,80,254,203,7,158,
+5,45,2,38,2,37,0,0,0,6,2,159,227,0,0,3,0,75,255,230,8,145,5,45,0,94,0,106,
+0,118,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,7,22,22,21,20,6,6,35,34,
+38,53,52,54,51,50,22,21,20,7,54,53,52,38,35,34,6,7,35,38,38,35,34,6,21,20,
+22,51,51,21,35,34,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,38,38,53,
+52,54,51,50,22,23,54,54,51,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,
+6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,8,145,137,115,113,135,
+31,218,25,62,57,88,100,117,182,94,141,186,147,119,104,133,34,141,180,147,
+107,164,22,78,25,149,125,114,120,134,123,62,80,122,145,131,123,124,132,44,
+139,132,196,243,111,93,84,94,204,156,130,194,53,45,182,118,134,99,28,253,
+115,15,3,252,126,132,108,57,123,72,63,61,71,76,57,66,68,252,234,74,64,64,
+76,73,67,65,73,4,41,116,137,126,106,64,52,35,43,45,75,17,68,231,140,168,241,
+123,174,134,125,158,128,101,69,58,99,223,150,189,127,98,104,121,75,68,68,
+76,98,77,65,63,79,33,216,44,178,143,87,122,30,35,117,72,116,149,128,114,113,
+129,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,253,125,62,76,73,57,59,
+78,74,0,4,0,80,255,230,8,42,5,45,0,72,0,84,0,96,0,108,0,0,1,20,6,35,34,38,
+53,52,55,35,22,21,20,6,7,22,22,21,16,0,33,32,0,17,52,18,51,50,22,21,20,6,
+35,34,38,53,52,55,6,6,21,20,4,33,32,36,53,52,38,39,22,21,20,6,35,34,38,53,
+52,54,51,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,
+5,20,22,51,50,54,53,52,38,35,34,6,5,52,38,35,34,6,21,20,22,51,50,54,8,42,
+137,115,113,135,31,218,25,46,43,88,103,254,128,254,171,254,171,254,128,234,
+174,122,144,136,115,106,130,13,42,50,1,41,1,64,1,64,1,41,50,42,13,131,105,
+115,136,145,121,92,99,28,253,115,15,3,252,126,132,108,57,123,72,63,61,71,
+76,57,66,68,249,189,75,57,62,73,73,60,60,74,3,114,74,60,60,73,73,62,57,75,
+4,41,116,137,126,106,64,52,35,43,39,67,20,61,207,131,254,236,254,205,1,51,
+1,20,199,1,11,135,115,117,138,119,98,40,41,41,123,73,173,199,199,173,73,123,
+41,41,40,98,119,138,117,115,135,73,40,24,165,21,67,108,89,64,74,72,66,67,
+73,73,227,67,73,75,65,64,74,72,66,66,72,74,64,65,75,73,0,5,0,80,254,203,7,
+78,5,45,0,46,0,58,0,75,0,87,0,91,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,
+6,35,35,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,36,51,33,50,53,52,
+39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,0,21,20,22,51,
+50,55,51,22,51,50,54,53,52,0,7,50,22,21,20,6,35,34,38,53,52,54,19,19,35,19,
+7,78,137,115,113,135,31,218,25,113,90,6,130,152,172,142,91,152,43,44,153,
+90,143,171,161,1,18,165,1,58,99,28,253,165,15,3,202,126,132,108,57,123,72,
+63,61,71,76,57,66,68,251,213,207,254,250,113,94,171,60,63,60,171,94,113,254,
+249,201,54,69,68,55,55,67,68,103,70,246,68,4,41,116,137,126,106,64,52,35,
+43,65,84,82,254,230,178,190,227,119,111,111,119,227,190,184,1,32,160,73,40,
+24,165,21,67,108,89,64,74,72,66,67,73,73,42,254,250,205,127,136,216,216,136,
+127,205,1,6,137,69,52,52,68,68,52,52,69,252,241,254,192,1,64,0,3,0,80,255,
+230,7,78,5,45,0,44,0,56,0,74,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,7,
+22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,16,0,33,33,50,53,52,39,33,55,33,
+50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,20,22,51,50,55,51,22,
+22,51,50,54,53,52,2,7,78,137,115,113,135,31,218,25,105,83,125,137,159,138,
+115,134,55,57,148,92,144,160,1,75,1,14,1,57,99,28,253,165,15,3,202,126,132,
+108,57,123,72,63,61,71,76,57,66,68,251,214,223,247,110,93,175,60,64,34,119,
+90,90,105,247,4,41,116,137,126,106,64,52,35,43,63,83,3,78,254,240,178,201,
+230,109,121,130,100,228,203,1,23,1,83,73,40,24,165,21,67,108,89,64,74,72,
+66,67,73,73,42,253,234,129,114,216,115,101,117,128,229,1,0,0,4,0,80,254,203,
+7,78,5,45,0,46,0,58,0,75,0,79,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,
+35,35,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,18,36,51,33,50,53,52,39,
+33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,0,21,20,22,51,50,
+55,51,22,51,50,54,53,52,0,3,19,35,19,7,78,137,115,113,135,31,218,25,113,90,
+6,130,152,172,142,91,152,43,44,153,90,143,171,161,1,18,165,1,58,99,28,253,
+165,15,3,202,126,132,108,57,123,72,63,61,71,76,57,66,68,251,213,207,254,250,
+113,94,171,60,63,60,171,94,113,254,249,152,70,246,68,4,41,116,137,126,106,
+64,52,35,43,65,84,82,254,230,178,190,227,119,111,111,119,227,190,184,1,32,
+160,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,42,254,250,205,127,136,
+216,216,136,127,205,1,6,252,104,254,192,1,64,0,2,0,70,255,230,7,59,5,45,0,
+66,0,78,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,7,22,18,21,20,6,35,34,
+38,39,38,38,35,34,21,20,22,23,7,38,38,53,52,54,51,50,22,23,30,2,51,50,53,
+52,38,38,35,55,35,53,33,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,
+22,51,50,54,7,59,137,115,113,135,31,188,25,110,89,145,166,174,179,134,186,
+84,70,97,57,126,48,37,195,21,23,159,129,93,137,87,57,80,101,68,219,131,230,
+145,1,31,1,85,99,28,252,121,15,4,216,126,132,108,57,123,72,63,61,71,76,57,
+66,68,4,41,116,137,126,106,64,52,35,43,64,83,2,70,254,241,187,197,234,152,
+160,132,100,185,83,179,72,10,65,158,58,150,186,82,116,75,83,49,245,150,219,
+116,1,91,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,0,3,0,75,255,230,
+7,221,6,38,0,63,0,75,0,87,0,0,1,20,6,35,34,38,53,52,55,35,22,21,16,2,35,34,
+38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,35,22,21,
+20,6,35,33,53,33,50,53,52,39,33,55,33,2,37,55,4,19,33,50,30,2,7,52,38,35,
+34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,7,221,137,115,113,
+135,31,193,27,195,190,111,169,54,26,155,104,136,163,165,132,98,141,33,75,
+161,100,132,153,25,164,25,113,90,254,140,1,105,99,28,253,74,15,3,136,139,
+254,153,6,1,198,158,1,31,126,132,108,57,123,72,63,61,71,76,57,66,68,250,202,
+97,83,81,97,92,84,86,96,2,251,116,137,126,106,64,52,126,141,254,217,254,190,
+126,88,104,110,169,141,136,175,97,80,116,101,228,196,121,112,35,43,65,84,
+90,73,40,24,165,1,32,95,168,144,254,105,21,67,108,89,64,74,72,66,67,73,73,
+254,170,81,97,96,83,77,93,88,255,255,0,75,254,203,7,221,6,38,2,38,2,45,0,
+0,0,6,2,159,214,0,0,2,0,75,255,230,7,119,5,45,0,90,0,102,0,0,1,20,6,35,34,
+38,53,52,55,35,22,21,20,6,7,22,18,21,20,6,6,35,34,38,39,6,6,35,34,38,53,52,
+54,55,54,54,53,52,38,35,34,6,21,20,23,7,38,38,53,52,54,51,50,22,21,20,6,7,
+14,2,21,20,22,51,50,55,51,22,22,51,50,54,53,52,38,39,7,53,51,50,53,52,39,
+33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,7,119,137,115,113,135,
+31,218,25,75,69,105,103,85,144,88,99,149,56,57,148,92,134,174,98,138,87,67,
+68,59,59,75,22,74,41,48,156,125,122,165,79,124,75,62,28,82,68,175,60,64,34,
+114,89,115,141,122,120,181,241,99,28,253,115,15,3,252,126,132,108,57,123,
+72,63,61,71,76,57,66,68,4,41,116,137,126,106,64,52,35,43,50,80,13,82,254,
+251,147,148,215,112,101,129,130,100,147,111,88,134,99,61,88,47,50,70,71,57,
+48,36,36,33,92,46,103,128,134,97,72,108,91,54,52,50,36,60,68,216,115,101,
+171,137,134,226,64,1,91,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,255,
+255,0,75,254,203,7,119,5,45,2,38,2,47,0,0,0,6,2,159,229,0,0,3,0,75,255,230,
+9,119,5,226,0,90,0,102,0,114,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,7,
+22,18,21,20,6,35,34,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,
+22,22,51,50,54,53,52,0,35,35,38,38,39,55,22,23,54,0,55,23,0,7,22,0,21,21,
+22,22,51,50,54,53,52,38,39,35,7,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,9,119,137,115,
+113,135,31,188,25,45,42,139,153,175,154,202,146,34,160,126,114,172,54,26,
+155,104,136,163,165,132,98,141,33,75,161,100,114,120,254,231,225,55,71,162,
+47,216,47,63,92,1,65,113,99,254,209,207,242,1,32,69,141,90,117,139,165,141,
+6,212,201,99,28,254,139,15,2,198,126,132,108,57,123,72,63,61,71,76,57,66,
+68,249,48,97,83,81,97,92,84,86,96,4,41,116,137,126,106,64,52,35,43,39,66,
+20,86,254,229,159,212,243,243,115,128,126,88,104,110,169,141,136,175,97,80,
+116,101,134,128,209,1,3,43,195,106,12,152,119,67,1,45,122,99,254,228,137,
+26,254,199,240,29,90,87,156,132,140,234,70,1,91,73,40,24,165,21,67,108,89,
+64,74,72,66,67,73,73,253,124,81,97,96,83,77,93,88,0,3,0,80,255,230,11,44,
+5,226,0,93,0,105,0,117,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,7,22,18,
+21,20,6,35,34,39,6,35,34,38,39,53,6,6,35,34,0,53,52,54,54,51,50,22,22,21,
+20,7,22,22,51,50,54,53,52,0,35,35,38,38,39,55,22,23,54,0,55,23,0,7,22,0,21,
+7,22,22,51,50,54,53,52,38,39,7,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,11,44,137,115,
+113,135,31,188,25,74,68,128,138,175,154,186,136,80,226,128,185,50,61,230,
+156,231,254,238,120,229,156,155,229,122,13,66,145,87,114,120,254,231,225,
+1,71,162,47,216,47,63,92,1,65,113,99,254,199,206,224,1,5,3,59,126,78,117,
+139,165,141,137,201,99,28,254,139,15,2,198,126,132,108,57,123,72,63,61,71,
+76,57,66,68,249,13,201,172,171,201,198,174,176,197,4,41,116,137,126,106,64,
+52,35,43,50,79,14,88,254,241,151,212,243,202,202,156,98,1,121,134,1,31,237,
+147,239,139,138,239,148,73,61,86,77,134,128,209,1,3,43,195,106,12,152,119,
+67,1,45,122,99,254,219,134,37,254,204,228,74,66,66,156,132,139,234,71,1,91,
+73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,254,100,171,199,200,170,165,
+189,187,0,3,0,80,255,230,6,25,5,45,0,38,0,50,0,62,0,0,1,20,6,35,34,38,53,
+52,55,35,22,21,20,7,22,22,21,20,0,35,34,0,53,52,54,54,51,51,50,53,52,39,33,
+55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,34,6,21,20,22,51,50,54,
+53,52,38,6,25,137,115,113,135,31,218,25,68,124,136,254,236,230,231,254,238,
+120,229,156,100,99,28,254,18,15,3,93,126,132,108,57,123,72,63,61,71,76,57,
+66,68,252,171,171,201,198,174,176,197,201,4,41,116,137,126,106,64,52,35,43,
+72,43,64,248,157,238,254,226,1,31,237,147,239,139,73,40,24,165,21,67,108,
+89,64,74,72,66,67,73,73,42,200,170,165,189,187,167,171,199,0,3,0,80,255,230,
+7,158,5,45,0,61,0,73,0,85,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,7,22,
+21,16,0,33,32,0,17,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,4,51,
+50,54,53,52,38,39,7,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,
+20,22,51,50,54,5,20,22,51,50,54,53,52,38,35,34,6,7,158,137,115,113,135,31,
+218,25,88,80,139,254,215,254,249,254,223,254,182,226,182,122,144,136,115,
+113,133,6,90,1,22,251,215,246,83,83,164,241,99,28,253,115,15,3,252,126,132,
+108,57,123,72,63,61,71,76,57,66,68,250,73,75,57,62,73,73,60,60,74,4,41,116,
+137,126,106,64,52,35,43,55,83,9,154,242,254,247,254,212,1,26,1,35,212,1,8,
+135,115,117,138,133,115,25,22,95,150,178,183,200,178,113,169,66,1,91,73,40,
+24,165,21,67,108,89,64,74,72,66,67,73,73,227,67,73,75,65,64,74,72,0,3,0,75,
+255,230,7,102,5,45,0,61,0,73,0,85,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,
+6,35,35,22,18,21,20,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,
+51,50,54,53,52,38,38,35,55,35,53,33,50,53,52,39,33,55,33,50,30,2,7,52,38,
+35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,7,102,137,115,
+113,135,31,188,25,113,90,26,145,166,172,173,114,172,54,26,155,104,136,163,
+165,132,98,141,33,75,161,100,114,119,131,230,145,1,1,1,85,99,28,252,121,15,
+4,216,126,132,108,57,123,72,63,61,71,76,57,66,68,251,65,97,83,81,97,92,84,
+86,96,4,41,116,137,126,106,64,52,35,43,65,84,70,254,241,187,196,235,126,88,
+104,110,169,141,136,175,97,80,116,101,127,118,150,219,116,1,91,73,40,24,165,
+21,67,108,89,64,74,72,66,67,73,73,253,124,81,97,96,83,77,93,88,0,3,0,40,255,
+230,7,106,5,45,0,68,0,80,0,92,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,6,
+7,22,21,20,6,7,7,22,21,20,6,35,34,38,53,52,55,55,38,38,35,34,21,20,23,7,38,
+38,53,52,54,51,50,4,23,55,54,54,53,52,39,7,53,33,50,53,52,39,33,55,33,50,
+30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,7,6,6,21,20,22,51,50,54,53,52,7,
+106,137,115,113,135,31,218,25,75,68,23,65,70,140,98,173,149,142,190,212,211,
+63,192,110,157,22,74,45,49,134,107,137,1,18,101,140,45,39,95,241,1,85,99,
+28,253,165,15,3,202,126,132,108,57,123,72,63,61,71,76,57,66,68,252,2,142,
+78,68,84,68,80,98,4,41,116,137,126,106,64,52,35,43,51,81,13,34,52,61,82,35,
+70,177,154,136,162,167,122,162,107,106,90,108,124,35,49,36,47,101,65,97,121,
+192,150,71,23,42,33,75,6,1,93,73,40,24,165,21,67,108,89,64,74,72,66,67,73,
+73,254,98,72,39,76,43,56,72,85,88,93,0,3,0,75,255,230,7,223,6,38,0,78,0,90,
+0,102,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,7,6,21,20,22,51,50,55,23,6,
+35,34,38,39,6,6,35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,
+54,53,52,39,35,22,21,20,6,35,33,53,33,50,53,52,39,33,55,33,2,37,55,4,19,33,
+50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,
+54,7,223,137,115,113,135,31,195,27,23,11,51,41,56,53,82,74,93,66,104,24,45,
+141,88,107,161,65,25,155,105,136,163,165,132,103,144,31,75,156,103,132,149,
+25,162,25,113,90,254,140,1,105,99,28,253,74,15,3,134,139,254,153,6,1,198,
+158,1,33,126,132,108,57,123,72,63,61,71,76,57,66,68,250,200,97,83,81,97,92,
+84,86,96,2,251,116,137,126,106,64,52,126,141,122,128,62,24,43,51,37,170,54,
+77,62,66,73,111,106,105,112,169,141,136,175,106,86,103,99,224,200,121,112,
+35,43,65,84,90,73,40,24,165,1,32,95,168,144,254,105,21,67,108,89,64,74,72,
+66,67,73,73,254,170,81,97,96,83,77,93,88,0,2,0,90,255,230,7,230,6,38,0,69,
+0,81,0,0,1,20,6,35,34,38,53,52,55,35,22,21,16,2,35,34,38,39,38,38,35,34,21,
+20,22,23,7,38,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,39,35,22,21,20,
+6,35,33,53,33,50,53,52,39,33,55,33,2,37,55,4,19,33,50,30,2,7,52,38,35,34,
+6,21,20,22,51,50,54,7,230,137,115,113,135,31,195,27,197,195,131,182,86,70,
+97,57,126,48,37,195,21,23,159,129,93,137,87,94,127,76,129,151,25,162,25,113,
+90,254,140,1,105,99,28,253,74,15,3,134,139,254,153,6,1,198,158,1,33,126,132,
+108,57,123,72,63,61,71,76,57,66,68,2,251,116,137,126,106,64,52,126,141,254,
+217,254,190,149,163,132,100,185,83,179,72,10,65,158,58,150,186,82,116,125,
+82,229,195,121,112,35,43,65,84,90,73,40,24,165,1,32,95,168,144,254,105,21,
+67,108,89,64,74,72,66,67,73,73,0,5,0,75,255,230,9,250,5,226,0,13,0,85,0,97,
+0,109,0,121,0,0,19,55,22,23,54,0,55,23,6,4,7,35,38,38,5,20,6,35,34,38,53,
+52,55,35,22,21,20,7,23,22,22,21,20,6,35,34,38,53,52,55,33,22,22,21,20,6,6,
+35,34,38,39,6,6,35,34,38,53,52,54,51,50,22,23,22,22,51,50,54,53,52,38,39,
+35,55,33,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,
+52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,51,50,54,75,216,
+47,63,92,1,65,113,99,205,254,206,90,70,71,162,9,128,137,115,113,135,31,218,
+25,74,4,47,53,137,115,113,135,31,254,183,108,111,83,159,109,107,161,65,25,
+155,105,136,163,165,132,103,144,31,75,156,103,108,132,124,121,237,15,3,153,
+99,28,253,115,15,3,252,126,132,108,57,123,72,63,61,71,76,57,66,68,253,136,
+72,63,61,71,76,57,66,68,251,37,97,83,81,97,92,84,86,96,4,251,12,152,119,67,
+1,45,122,99,192,237,47,43,195,104,116,137,126,106,64,52,35,43,75,43,3,32,
+104,62,116,137,126,106,64,52,90,247,129,113,191,114,111,106,105,112,169,141,
+136,175,106,86,103,99,145,117,115,210,70,165,73,40,24,165,21,67,108,89,64,
+74,72,66,67,73,73,235,64,74,72,66,67,73,73,254,170,81,97,96,83,77,93,88,0,
+3,0,80,255,230,7,232,5,45,0,91,0,103,0,115,0,0,1,20,6,35,34,38,53,52,55,35,
+22,21,20,7,22,22,21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,18,51,50,22,
+21,20,6,35,34,38,53,52,55,6,6,21,20,22,22,51,50,55,51,22,51,50,54,54,53,52,
+38,35,34,6,21,20,22,23,7,33,53,33,38,38,53,52,54,51,51,50,53,52,39,33,55,
+33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,5,20,22,51,50,54,53,52,38,35,
+34,6,7,232,137,115,113,135,31,218,25,84,69,77,99,167,100,103,161,42,42,161,
+103,100,167,99,232,176,122,144,136,115,113,133,5,41,48,78,125,70,214,60,64,
+60,214,70,125,78,108,93,39,52,58,64,30,254,120,1,17,61,55,120,90,42,99,28,
+253,115,15,3,252,126,132,108,57,123,72,63,61,71,76,57,66,68,249,255,78,59,
+57,73,76,62,55,74,4,41,116,137,126,106,64,52,35,43,80,43,60,225,160,166,245,
+129,125,105,105,125,129,245,166,219,1,34,135,115,117,138,133,115,20,25,48,
+147,81,107,151,76,216,216,76,151,107,154,181,51,45,51,73,28,92,104,47,89,
+58,83,112,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,227,67,73,76,64,
+64,74,73,0,4,0,70,255,231,7,8,5,45,0,74,0,86,0,98,0,110,0,0,1,20,6,35,34,
+38,53,52,55,35,22,21,20,6,35,35,22,21,20,6,7,22,21,20,6,35,34,38,53,52,55,
+38,38,53,52,54,54,51,50,22,21,20,6,35,34,38,53,52,55,6,21,20,22,23,22,23,
+54,53,52,38,39,35,53,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,20,
+22,51,50,54,5,20,22,51,50,54,53,52,38,35,34,6,1,52,38,35,34,6,21,20,22,51,
+50,54,7,8,137,115,113,135,31,198,25,112,91,19,157,151,139,39,130,107,112,
+126,41,153,185,93,166,104,108,128,121,102,101,118,6,80,126,166,176,94,236,
+62,65,121,241,99,28,253,185,15,3,162,126,132,108,57,123,72,63,61,71,76,57,
+66,68,250,186,64,49,53,62,62,51,51,64,1,162,71,65,68,69,70,66,67,70,4,41,
+116,137,126,106,64,52,35,43,65,84,103,182,132,157,26,58,86,96,118,109,95,
+65,47,13,191,143,100,178,107,120,102,104,123,119,102,21,21,80,86,73,109,13,
+14,52,39,230,89,123,41,91,73,40,24,165,21,67,108,89,64,74,72,66,67,73,73,
+196,58,62,64,56,54,63,60,253,153,49,51,54,47,46,53,52,0,3,0,35,254,79,5,170,
+5,45,0,63,0,75,0,107,0,0,1,20,6,35,34,38,53,52,55,35,22,21,20,7,22,23,7,38,
+38,35,34,6,21,20,22,23,23,22,22,21,20,6,35,32,3,55,22,51,50,54,53,52,38,39,
+39,38,38,53,52,54,54,51,51,50,53,52,39,33,55,33,50,30,2,7,52,38,35,34,6,21,
+20,22,51,50,54,1,21,34,38,39,6,6,35,34,39,6,35,34,38,53,52,55,51,22,22,51,
+50,55,51,22,51,50,54,55,51,22,22,5,170,137,115,113,135,31,218,25,53,101,107,
+96,94,175,113,126,116,117,139,123,186,148,227,183,254,191,170,100,156,233,
+127,142,92,109,129,192,178,83,173,128,97,99,28,254,18,15,3,93,126,132,108,
+57,123,72,63,61,71,76,57,66,68,254,170,53,91,29,13,101,70,129,65,65,129,82,
+106,6,54,12,73,64,110,33,60,33,110,64,73,12,54,23,75,4,41,116,137,126,106,
+64,52,35,43,61,43,39,80,111,92,91,94,71,78,70,11,10,16,157,120,147,183,1,
+19,82,133,74,73,65,73,9,11,16,122,127,63,117,75,73,40,24,165,21,67,108,89,
+64,74,72,66,67,73,73,251,100,166,63,60,93,90,150,150,121,125,39,47,85,73,
+116,116,73,85,61,45,0,2,0,20,253,12,3,228,3,212,0,36,0,48,0,0,5,20,2,6,35,
+34,36,53,52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,18,53,
+16,0,37,55,4,0,1,20,22,51,50,54,53,52,38,35,34,6,3,228,131,232,146,204,254,
+249,222,166,122,144,136,115,113,133,6,34,25,188,161,184,201,254,241,254,240,
+65,1,76,1,28,253,56,78,59,57,73,76,62,55,74,129,181,254,226,160,228,175,193,
+1,7,135,115,117,138,133,115,23,23,37,88,62,123,141,1,8,239,1,12,1,224,199,
+89,250,253,214,254,162,67,73,76,64,64,74,73,0,3,0,20,253,12,5,178,3,212,0,
+51,0,63,0,75,0,0,1,20,6,35,34,38,53,52,55,33,22,18,21,20,2,6,35,34,36,53,
+52,18,51,50,22,21,20,6,35,34,38,53,52,55,6,6,21,20,22,51,50,18,17,16,2,37,
+55,33,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,1,20,22,51,50,54,53,52,38,
+35,34,6,5,178,137,115,113,135,31,254,74,206,239,131,231,147,204,254,249,222,
+166,122,144,136,115,113,133,6,34,25,188,161,187,198,251,254,220,65,2,143,
+126,132,108,57,123,72,63,61,71,76,57,66,68,251,229,78,59,57,73,76,62,55,74,
+2,208,116,137,126,106,64,52,168,254,21,255,196,254,214,163,228,175,193,1,
+7,135,115,117,138,133,115,23,23,37,88,62,123,141,1,21,1,0,1,3,1,174,228,89,
+21,67,108,89,64,74,72,66,67,73,73,252,222,67,73,76,64,64,74,73,255,255,0,
+20,253,91,3,6,3,255,0,6,0,105,20,0,255,255,0,20,252,65,3,213,255,140,0,7,
+0,106,1,245,0,0,255,255,0,20,252,118,2,241,255,138,0,7,0,107,1,131,0,0,255,
+255,0,20,252,65,4,168,255,135,0,7,0,108,2,94,0,0,255,255,0,20,252,216,2,230,
+255,132,0,7,0,109,1,125,0,0,255,255,0,20,253,91,4,147,4,5,0,7,0,110,1,164,
+0,0,255,255,0,20,252,156,4,147,4,5,0,7,0,111,1,164,0,0,255,255,0,20,252,216,
+2,231,255,134,0,7,0,112,1,126,0,0,255,255,0,20,252,15,5,184,255,139,0,7,0,
+113,2,230,0,0,255,255,0,20,252,216,4,57,255,132,0,7,0,114,2,39,0,0,255,255,
+0,20,252,216,3,45,255,138,0,7,0,115,1,161,0,0,255,255,0,20,252,216,2,133,
+255,133,0,7,0,116,1,77,0,0,255,255,0,20,252,216,3,64,255,132,0,7,0,117,1,
+170,0,0,255,255,0,20,252,65,3,64,255,132,0,7,0,118,1,170,0,0,255,255,0,20,
+252,216,3,197,255,133,0,7,0,119,1,237,0,0,0,2,253,125,252,15,2,18,254,16,
+0,15,0,27,0,0,1,20,14,2,35,33,55,33,38,53,52,54,51,50,22,7,52,38,35,34,6,
+21,20,22,51,50,54,2,18,57,108,131,127,253,18,15,2,177,31,134,114,115,137,
+123,68,66,57,76,71,61,63,72,253,19,64,108,66,22,165,52,64,105,127,137,91,
+67,73,73,67,66,72,74,255,255,0,20,252,65,3,96,255,131,0,7,0,121,1,186,0,0,
+255,255,0,20,252,214,3,96,255,131,0,7,0,122,1,186,0,0,255,255,0,20,252,65,
+3,96,255,131,0,7,0,123,1,186,0,0,255,255,0,20,253,83,4,133,4,5,0,7,0,124,
+0,220,0,0,255,255,0,20,253,91,4,96,4,5,0,7,0,125,1,84,0,0,255,255,0,20,252,
+156,4,96,4,5,0,7,0,126,1,84,0,0,255,255,0,20,252,216,3,160,4,5,0,7,0,127,
+0,140,0,0,255,255,0,20,252,15,3,160,4,5,0,7,0,128,0,140,0,0,255,255,0,20,
+253,91,2,164,3,255,0,6,0,129,120,0,255,255,0,20,253,91,2,237,3,254,0,6,0,
+130,20,0,0,2,0,36,253,86,2,170,3,255,0,21,0,33,0,0,19,36,18,17,52,39,6,6,
+35,34,38,53,52,54,51,50,22,18,21,16,2,7,19,52,38,35,34,6,21,20,22,51,50,54,
+81,1,22,228,50,27,122,86,122,144,146,118,139,171,72,221,253,251,84,71,70,
+84,79,73,73,84,253,225,204,1,147,1,13,175,121,77,81,150,125,121,156,197,254,
+202,181,254,186,254,34,213,5,188,69,85,83,72,66,80,76,255,255,0,20,252,227,
+3,170,255,110,0,7,0,132,1,223,0,0,255,255,0,20,253,91,4,33,3,254,0,7,0,133,
+1,14,0,0,255,255,0,20,253,91,2,224,4,5,0,6,0,134,120,0,255,255,0,20,252,216,
+3,214,255,135,0,7,0,135,2,11,0,0,255,255,0,20,253,79,4,15,4,5,0,7,0,136,1,
+14,0,0,255,255,0,20,252,216,4,137,255,132,0,7,0,137,2,79,0,0,255,255,0,20,
+252,217,3,175,255,132,0,7,0,138,1,226,0,0,255,255,0,20,252,216,3,94,3,253,
+0,7,0,139,0,170,0,0,255,255,0,20,251,211,2,123,255,130,0,7,0,140,1,59,0,0,
+0,3,253,81,252,14,2,177,255,143,0,15,0,27,0,41,0,0,19,33,55,33,38,53,52,54,
+51,50,22,21,20,14,2,3,20,22,51,50,54,53,52,38,35,34,6,5,6,4,33,32,36,39,55,
+22,4,33,32,36,55,129,253,180,15,2,8,24,134,114,115,137,53,109,153,75,71,61,
+63,72,68,66,57,76,2,15,33,254,153,254,215,254,214,254,156,33,89,37,1,21,1,
+28,1,30,1,24,34,253,172,165,45,53,100,120,128,110,58,99,68,20,1,14,59,64,
+66,57,60,65,65,255,237,252,250,240,20,152,178,180,149,0,1,253,220,253,136,
+2,36,255,168,0,14,0,0,5,55,22,22,51,50,54,55,23,6,0,35,34,38,38,253,220,94,
+29,239,185,186,242,27,94,26,254,219,230,163,238,133,105,17,171,191,197,164,
+16,244,254,229,141,239,0,1,253,115,253,100,2,142,255,168,0,15,0,0,5,55,22,
+4,51,50,36,55,23,6,6,4,35,34,36,38,253,115,94,33,1,36,234,237,1,35,32,94,
+16,150,254,229,205,206,254,229,150,105,17,193,205,210,187,16,158,254,151,
+153,254,0,1,253,10,253,63,2,248,255,168,0,15,0,0,5,55,22,4,33,32,36,55,23,
+6,2,4,35,34,36,2,253,10,94,33,1,56,1,63,1,26,1,91,37,94,17,165,254,182,248,
+248,254,183,165,105,17,187,248,222,212,16,166,254,243,165,166,1,14,0,1,252,
+160,253,27,3,97,255,168,0,16,0,0,5,55,22,0,33,32,36,54,55,23,6,2,4,33,32,
+36,2,252,160,94,36,1,98,1,124,1,6,1,74,157,22,94,18,181,254,137,254,221,254,
+222,254,136,182,105,17,201,254,242,137,210,123,16,173,254,226,177,179,1,30,
+0,1,252,55,252,247,3,203,255,168,0,15,0,0,5,55,22,0,33,32,0,55,23,6,2,4,33,
+32,36,2,252,55,94,40,1,139,1,184,1,186,1,141,38,94,19,198,254,91,254,179,
+254,179,254,91,197,105,17,214,254,219,1,39,211,16,180,254,211,191,191,1,46,
+0,1,251,205,252,211,4,52,255,168,0,15,0,0,5,55,22,0,33,32,0,55,23,6,2,4,33,
+32,36,2,251,205,94,43,1,181,1,245,1,245,1,183,42,94,20,214,254,45,254,137,
+254,137,254,44,213,105,17,227,254,196,1,61,225,16,188,254,195,203,204,1,61,
+0,1,251,100,252,175,4,157,255,168,0,15,0,0,5,55,22,0,33,32,0,55,23,6,2,4,
+33,32,36,2,251,100,94,46,1,223,2,49,2,50,1,224,45,94,20,230,253,255,254,94,
+254,95,253,254,229,105,17,240,254,173,1,84,238,16,195,254,179,216,217,1,77,
+0,1,250,250,252,139,5,6,255,168,0,15,0,0,5,55,22,0,33,32,0,55,23,6,2,4,33,
+32,36,2,250,250,94,48,2,10,2,110,2,110,2,9,49,94,21,246,253,208,254,53,254,
+52,253,208,245,105,17,253,254,150,1,106,252,16,202,254,163,229,230,1,92,0,
+1,250,145,252,103,5,112,255,168,0,15,0,0,5,55,18,0,33,32,0,19,23,6,0,4,33,
+32,36,0,250,145,94,52,2,51,2,170,2,171,2,52,51,94,23,254,251,253,162,254,
+10,254,10,253,162,254,251,105,17,254,245,254,128,1,129,1,10,17,210,254,148,
+242,243,1,108,0,1,250,39,252,67,5,217,255,168,0,15,0,0,5,55,18,0,33,32,0,
+19,23,6,0,0,33,32,0,0,250,39,94,55,2,94,2,230,2,230,2,94,55,94,23,254,234,
+253,116,253,224,253,224,253,116,254,234,105,17,254,233,254,104,1,152,1,23,
+17,217,254,133,255,0,1,0,1,123,0,2,0,211,255,242,1,213,5,182,0,3,0,11,0,0,
+19,51,3,35,3,52,51,50,21,20,35,34,221,238,72,94,82,129,129,129,129,5,182,
+251,230,254,229,135,139,139,0,2,0,117,3,213,2,207,5,182,0,3,0,7,0,0,19,51,
+3,35,1,51,3,35,117,217,62,94,1,68,217,62,94,5,182,254,31,1,225,254,31,0,2,
+0,51,0,0,4,70,5,182,0,27,0,31,0,0,19,35,53,51,19,35,53,51,19,51,3,33,19,51,
+3,51,21,35,3,51,21,33,3,35,19,33,3,35,1,19,33,3,240,189,211,78,223,245,74,
+125,76,1,29,76,123,76,201,224,75,233,254,254,78,123,78,254,227,77,123,1,254,
+76,254,227,76,1,160,121,1,145,121,1,147,254,109,1,147,254,109,121,254,111,
+121,254,96,1,160,254,96,2,25,1,145,254,111,0,5,0,92,255,236,6,207,5,203,0,
+11,0,15,0,27,0,39,0,51,0,0,19,52,54,51,50,22,21,20,6,35,34,38,1,51,1,35,19,
+52,38,35,34,6,21,20,22,51,50,54,1,52,54,51,50,22,21,20,6,35,34,38,37,52,38,
+35,34,6,21,20,22,51,50,54,92,166,172,164,170,171,165,170,166,4,96,134,253,
+38,135,97,68,80,82,72,72,80,81,69,1,237,165,173,164,170,171,165,171,165,1,
+229,67,80,82,72,72,80,81,68,4,6,214,239,242,211,212,245,243,2,134,250,74,
+4,6,183,184,186,181,184,189,188,254,103,215,238,242,211,211,245,242,214,183,
+184,186,181,184,189,187,0,1,0,117,3,213,1,78,5,182,0,3,0,0,19,51,3,35,117,
+217,62,94,5,182,254,31,0,1,0,117,254,250,2,131,6,20,0,15,0,0,19,16,18,37,
+21,6,6,2,21,20,18,22,23,21,36,2,117,245,1,25,132,138,43,43,138,132,254,233,
+247,2,137,1,118,1,165,112,92,80,250,254,220,193,192,254,218,251,80,94,111,
+1,169,0,1,0,66,254,250,2,80,6,20,0,15,0,0,23,54,54,18,53,52,2,38,39,53,4,
+18,17,16,2,5,66,132,137,44,44,137,132,1,23,247,247,254,233,168,80,252,1,37,
+192,192,1,37,250,80,92,111,254,90,254,138,254,139,254,85,111,0,1,0,84,3,6,
+3,160,6,20,0,17,0,0,1,5,39,37,37,55,5,3,51,3,37,23,5,5,7,37,19,35,1,213,254,
+199,72,1,88,254,168,72,1,59,53,178,57,1,61,72,254,166,1,90,72,254,195,57,
+178,4,74,195,160,102,103,162,199,1,69,254,189,192,159,101,100,158,191,254,
+188,0,1,0,133,1,37,3,244,4,147,0,11,0,0,1,33,53,33,17,51,17,33,21,33,17,35,
+1,254,254,135,1,121,123,1,123,254,133,123,2,160,121,1,122,254,134,121,254,
+133,0,1,0,61,254,197,1,141,1,8,0,17,0,0,23,54,53,52,38,39,38,38,53,52,54,
+51,50,22,21,20,6,7,61,195,31,32,54,33,75,59,69,88,162,174,229,63,121,25,28,
+18,29,53,35,57,64,98,80,140,210,51,0,1,0,51,1,225,2,72,2,123,0,3,0,0,19,33,
+21,33,51,2,21,253,235,2,123,154,0,1,0,127,255,242,1,129,1,8,0,7,0,0,55,52,
+51,50,21,20,35,34,127,129,129,129,129,125,139,139,139,0,1,0,0,255,8,2,78,
+6,20,0,3,0,0,1,51,1,35,1,215,119,254,43,121,6,20,248,244,0,2,0,92,255,236,
+4,29,5,203,0,11,0,23,0,0,19,16,18,51,50,18,17,16,2,35,34,2,1,16,2,35,34,2,
+17,16,18,51,50,18,92,237,246,229,249,252,228,244,237,2,236,122,143,145,125,
+125,143,144,123,2,223,1,98,1,138,254,121,254,153,254,152,254,119,1,144,1,
+97,1,62,1,65,254,191,254,194,254,194,254,187,1,68,0,1,0,135,0,0,3,209,5,190,
+0,23,0,0,55,51,50,54,53,17,6,6,35,34,38,53,54,54,55,55,51,17,20,22,51,51,
+21,33,197,137,96,72,92,116,56,45,58,66,137,96,144,131,73,95,100,252,244,86,
+71,76,4,52,111,102,61,49,17,70,71,106,251,43,76,71,86,0,1,0,104,0,0,3,227,
+5,203,0,31,0,0,55,1,54,54,53,52,38,35,34,6,21,34,38,53,52,54,51,50,22,21,
+20,6,7,1,33,50,54,54,55,51,3,33,104,1,86,169,122,104,105,128,97,82,94,214,
+187,192,224,139,203,254,166,1,217,59,70,35,16,86,10,252,143,150,1,139,197,
+243,135,121,139,164,141,60,73,127,148,186,156,117,254,223,254,129,42,71,77,
+254,158,0,1,0,119,255,236,4,2,5,203,0,44,0,0,55,52,54,51,20,22,51,50,54,53,
+52,38,35,35,53,51,50,54,53,52,35,34,6,21,34,38,53,52,54,51,50,22,21,20,6,
+7,22,22,21,20,6,6,35,34,38,119,70,59,142,118,135,170,200,171,65,65,142,180,
+219,129,97,82,94,216,186,199,231,183,145,184,195,154,237,129,180,207,207,
+61,70,113,135,158,172,131,154,104,178,139,254,164,141,60,73,127,148,175,151,
+135,208,34,20,190,152,155,196,87,122,0,2,0,35,0,0,4,92,5,182,0,20,0,28,0,
+0,37,51,50,54,53,53,33,53,1,51,17,51,21,35,21,20,22,51,51,21,33,19,17,52,
+55,6,6,7,1,1,184,58,96,72,253,137,2,121,194,254,254,73,95,27,253,151,226,
+14,20,127,37,254,198,86,71,76,168,84,3,209,252,78,115,168,76,71,86,2,4,1,
+123,248,176,40,218,57,254,24,0,1,0,113,255,236,3,227,5,180,0,34,0,0,55,52,
+51,20,22,51,32,17,52,38,35,34,6,7,39,19,33,19,35,39,38,38,35,33,3,54,51,50,
+22,21,20,4,35,34,38,113,129,133,114,1,37,166,145,94,108,50,49,66,2,172,10,
+86,8,7,46,58,254,115,39,97,142,216,251,254,246,229,181,206,186,121,95,112,
+1,90,158,162,23,22,14,2,213,254,203,61,51,33,254,62,33,233,200,214,252,109,
+0,2,0,125,255,236,4,16,5,203,0,25,0,34,0,0,19,52,18,54,51,50,22,21,20,6,35,
+52,38,35,32,3,54,51,50,22,21,20,2,35,34,2,37,16,35,34,6,7,18,33,50,125,119,
+241,174,152,186,81,76,87,94,254,210,21,128,165,189,222,238,202,231,244,2,
+194,243,74,132,48,6,1,10,225,2,225,201,1,84,205,120,95,59,64,108,131,253,
+166,107,226,194,225,254,248,1,138,75,1,79,69,49,253,194,0,1,0,121,0,0,4,23,
+5,180,0,10,0,0,1,33,34,7,7,35,19,33,21,1,35,3,104,253,230,110,9,8,86,10,3,
+148,254,8,154,5,16,104,102,1,114,59,250,135,0,3,0,94,255,236,4,27,5,203,0,
+25,0,37,0,48,0,0,19,52,54,54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,
+21,20,4,35,34,38,1,52,38,35,34,6,21,20,22,23,54,54,19,52,38,39,6,21,20,22,
+51,50,54,94,78,132,102,126,139,93,199,151,184,219,115,161,164,176,254,249,
+229,213,252,2,199,124,110,109,128,117,159,107,88,59,164,196,211,142,134,131,
+164,1,111,93,136,96,49,71,182,122,100,166,101,193,160,109,156,81,78,189,126,
+191,220,210,3,177,118,133,133,112,97,139,74,53,133,253,97,105,156,85,114,
+220,131,153,150,0,2,0,104,255,233,3,252,5,203,0,26,0,38,0,0,55,52,54,55,22,
+51,50,18,19,6,6,35,34,38,53,52,18,51,50,18,17,20,2,6,35,34,38,1,2,2,35,34,
+6,21,20,22,51,54,54,168,37,24,70,168,168,163,11,50,152,99,191,213,240,199,
+230,247,116,249,190,160,137,2,131,4,142,122,109,119,117,121,94,134,154,36,
+54,8,162,1,44,1,56,61,78,221,195,228,1,20,254,151,254,185,226,254,142,222,
+102,3,3,1,8,1,0,192,179,166,149,1,94,0,2,0,166,255,242,1,168,4,84,0,7,0,15,
+0,0,19,52,51,50,21,20,35,34,17,52,51,50,21,20,35,34,166,129,129,129,129,129,
+129,129,129,3,201,139,139,140,253,64,139,139,139,0,2,0,98,254,197,1,178,4,
+84,0,7,0,25,0,0,19,52,51,50,21,20,35,34,3,54,53,52,38,39,38,38,53,52,54,51,
+50,22,21,20,6,7,166,129,129,129,129,68,195,31,32,54,33,75,58,70,88,162,174,
+3,201,139,139,140,251,222,63,121,25,28,18,31,51,35,57,64,99,79,140,210,51,
+0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,53,1,21,1,1,21,133,3,111,253,80,2,
+176,2,184,72,1,217,137,254,139,254,143,137,0,2,0,133,1,213,3,244,3,225,0,
+3,0,7,0,0,19,33,21,33,17,33,21,33,133,3,111,252,145,3,111,252,145,3,225,121,
+254,230,121,0,1,0,133,0,225,3,244,4,217,0,6,0,0,19,1,1,53,1,21,1,133,2,176,
+253,80,3,111,252,145,1,106,1,113,1,117,137,254,39,72,254,41,0,2,0,88,255,
+242,3,152,5,203,0,23,0,31,0,0,1,54,54,53,52,38,35,34,6,21,34,38,53,52,54,
+51,50,22,21,20,6,7,21,35,3,52,51,50,21,20,35,34,1,141,167,147,110,114,120,
+109,76,94,200,183,203,246,200,198,125,68,129,129,129,129,2,211,67,222,135,
+111,124,145,117,69,64,109,121,204,167,163,224,82,231,254,229,135,139,139,
+0,1,0,205,254,250,2,150,6,20,0,13,0,0,19,33,21,35,34,6,21,17,20,22,51,51,
+21,33,205,1,201,89,95,72,72,95,89,254,55,6,20,86,71,76,250,184,75,72,86,0,
+1,0,0,255,8,2,78,6,20,0,3,0,0,17,51,1,35,119,1,215,121,6,20,248,244,0,1,0,
+76,254,250,2,20,6,20,0,13,0,0,23,51,50,54,53,17,52,38,35,35,53,33,17,33,76,
+88,96,72,73,95,88,1,200,254,56,176,71,76,5,72,76,71,86,248,230,0,1,0,104,
+2,33,4,14,5,182,0,6,0,0,1,51,1,35,1,1,35,2,23,71,1,176,137,254,180,254,185,
+138,5,182,252,107,2,217,253,39,0,1,255,246,254,221,3,182,255,86,0,3,0,0,7,
+33,21,33,10,3,192,252,64,170,121,0,1,0,102,254,250,3,6,6,20,0,35,0,0,37,17,
+52,38,39,53,54,54,53,17,52,54,51,51,21,35,34,6,21,17,20,6,7,21,22,22,21,17,
+20,22,51,51,21,35,34,38,1,88,127,115,114,128,151,144,135,61,89,79,116,112,
+115,113,80,88,61,135,142,153,33,1,100,117,95,5,86,3,96,116,1,101,140,152,
+88,106,109,254,162,102,132,18,2,19,131,104,254,158,107,108,88,158,0,1,1,254,
+254,20,2,121,6,20,0,3,0,0,1,51,17,35,1,254,123,123,6,20,248,0,0,1,0,102,254,
+250,3,6,6,20,0,35,0,0,23,51,50,54,53,17,52,54,55,53,38,38,53,17,52,38,35,
+35,53,51,50,22,21,17,20,22,23,21,6,6,21,17,20,6,35,35,102,62,88,80,113,114,
+111,116,79,89,62,136,143,151,129,113,114,128,152,142,136,174,108,107,1,98,
+104,131,19,2,18,132,102,1,94,109,106,88,152,140,254,155,116,96,3,86,5,95,
+117,254,156,137,158,0,1,0,111,2,39,4,8,3,141,0,25,0,0,1,50,22,23,22,22,51,
+50,54,55,51,6,6,35,34,38,39,38,38,35,34,6,7,35,54,54,1,104,67,110,79,57,73,
+38,54,57,14,123,17,105,128,67,114,64,61,73,43,58,59,12,120,14,105,3,141,62,
+73,52,50,117,120,150,208,66,63,58,50,114,123,155,203,255,255,0,51,1,225,2,
+72,2,123,2,6,2,120,0,0,0,1,255,246,1,233,4,10,2,98,0,3,0,0,3,33,21,33,10,
+4,20,251,236,2,98,121,0,1,255,246,1,233,8,10,2,98,0,3,0,0,3,33,21,33,10,8,
+20,247,236,2,98,121,0,1,0,115,3,117,1,195,5,184,0,17,0,0,19,52,54,55,21,6,
+21,20,22,23,22,22,21,20,6,35,34,38,115,162,174,195,30,33,42,45,75,59,69,88,
+4,39,140,210,51,86,63,121,25,28,19,22,49,45,57,64,98,0,1,0,61,3,115,1,141,
+5,182,0,17,0,0,19,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,
+30,33,42,45,75,59,69,88,162,174,3,201,63,121,25,28,19,22,49,45,57,64,98,80,
+140,210,51,0,2,0,115,3,117,3,92,5,184,0,17,0,35,0,0,19,52,54,55,21,6,21,20,
+22,23,22,22,21,20,6,35,34,38,37,52,54,55,21,6,21,20,22,23,22,22,21,20,6,35,
+34,38,115,162,174,195,30,33,42,45,75,59,69,88,1,153,162,174,194,30,33,41,
+45,74,59,70,88,4,39,140,210,51,86,63,121,25,28,19,22,49,45,57,64,98,80,140,
+210,51,86,63,121,25,28,19,22,49,45,57,64,99,0,2,0,61,3,115,3,39,5,182,0,17,
+0,35,0,0,19,54,53,52,38,39,38,38,53,52,54,51,50,22,21,20,6,7,37,54,53,52,
+38,39,38,38,53,52,54,51,50,22,21,20,6,7,61,195,30,33,42,45,75,59,69,88,162,
+174,1,154,195,30,33,42,45,74,59,70,88,162,174,3,201,63,121,25,28,19,22,49,
+45,57,64,98,80,140,210,51,86,63,121,25,28,19,22,49,45,57,64,99,79,140,210,
+51,0,3,0,164,255,242,6,57,1,8,0,7,0,15,0,23,0,0,55,52,51,50,21,20,35,34,37,
+52,51,50,21,20,35,34,37,52,51,50,21,20,35,34,164,129,129,129,129,2,74,129,
+129,129,129,2,73,129,129,129,129,129,135,139,139,143,135,139,139,143,135,
+139,139,0,1,0,145,1,51,3,229,4,137,0,11,0,0,19,1,1,55,1,1,23,1,1,7,1,1,145,
+1,84,254,172,86,1,84,1,84,86,254,172,1,84,86,254,172,254,172,1,139,1,84,1,
+82,86,254,172,1,86,88,254,172,254,172,86,1,84,254,172,0,3,0,133,0,231,3,244,
+4,209,0,7,0,11,0,19,0,0,1,52,51,50,21,20,35,34,5,33,21,33,1,52,51,50,21,20,
+35,34,1,213,104,105,105,104,254,176,3,111,252,145,1,80,104,105,105,104,4,
+96,113,113,112,215,121,254,184,113,113,113,0,1,0,133,2,160,3,244,3,25,0,3,
+0,0,19,33,21,33,133,3,111,252,145,3,25,121,0,1,2,85,254,203,3,75,0,11,0,3,
+0,0,37,19,35,19,3,5,70,246,68,11,254,192,1,64,0,0,0,0,0,15,0,186,0,3,0,1,
+4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,34,0,94,0,3,0,1,4,9,0,2,0,14,0,128,0,3,
+0,1,4,9,0,3,0,72,0,142,0,3,0,1,4,9,0,4,0,34,0,94,0,3,0,1,4,9,0,5,0,30,0,214,
+0,3,0,1,4,9,0,6,0,30,0,244,0,3,0,1,4,9,0,7,0,68,1,18,0,3,0,1,4,9,0,8,0,42,
+1,86,0,3,0,1,4,9,0,9,0,38,1,128,0,3,0,1,4,9,0,10,0,96,1,166,0,3,0,1,4,9,0,
+11,0,62,2,6,0,3,0,1,4,9,0,12,0,60,2,68,0,3,0,1,4,9,0,13,2,150,2,128,0,3,0,
+1,4,9,0,14,0,52,5,22,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,
+0,32,0,50,0,48,0,49,0,54,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,
+0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,
+115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,78,0,111,0,
+116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,84,0,101,0,108,0,117,0,
+103,0,117,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,
+84,0,101,0,108,0,117,0,103,0,117,0,86,0,101,0,114,0,115,0,105,0,111,0,110,
+0,32,0,49,0,46,0,48,0,49,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,101,
+0,114,0,105,0,102,0,84,0,101,0,108,0,117,0,103,0,117,0,78,0,111,0,116,0,111,
+0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,
+114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,
+73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,
+73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,73,0,110,
+0,100,0,105,0,97,0,110,0,32,0,84,0,121,0,112,0,101,0,32,0,70,0,111,0,117,
+0,110,0,100,0,114,0,121,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,
+0,110,0,116,0,101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,
+0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,
+0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,
+0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,
+0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,
+0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,
+0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,
+0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,
+0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,
+0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,
+0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,
+0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,
+105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,
+0,100,0,32,0,111,0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,
+0,34,0,32,0,66,0,65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,
+0,84,0,32,0,87,0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,
+0,32,0,67,0,79,0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,
+0,65,0,78,0,89,0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,
+0,101,0,114,0,32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,
+0,32,0,105,0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,
+0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,
+32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,
+32,0,102,0,111,0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,
+105,0,102,0,105,0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,
+44,0,32,0,112,0,101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,
+0,32,0,97,0,110,0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,
+0,111,0,110,0,115,0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,
+103,0,32,0,121,0,111,0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,
+0,32,0,116,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,
+0,102,0,116,0,119,0,97,0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,
+0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,
+0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,160,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,
+7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,
+1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,
+1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,
+1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,
+1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,
+1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,
+1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,
+1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,
+123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,
+1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,
+148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,
+1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,
+173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,
+1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,
+198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,
+1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,
+223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,
+1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,
+248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,
+2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,
+22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,
+2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,
+2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,
+2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,
+2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,
+2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,
+2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,
+122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,
+2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,
+147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,
+2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,
+172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,
+2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,
+197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,
+2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,
+222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,
+2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,
+247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,
+5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,
+3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,
+3,36,3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,
+3,51,3,52,3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,
+3,66,3,67,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,
+3,81,3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,
+3,96,3,97,3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,
+0,4,0,5,0,6,0,8,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,
+21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,62,
+0,63,0,64,0,65,0,66,0,94,0,95,0,96,0,97,3,109,0,178,0,179,0,182,0,183,0,180,
+0,181,0,171,0,240,0,184,0,239,3,110,4,78,85,76,76,3,116,108,65,4,116,108,
+65,65,3,116,108,73,4,116,108,73,73,3,116,108,85,4,116,108,85,85,4,116,108,
+118,82,5,116,108,118,82,82,4,116,108,118,76,5,116,108,118,76,76,3,116,108,
+69,4,116,108,69,69,4,116,108,65,73,3,116,108,79,4,116,108,79,79,4,116,108,
+65,85,5,116,108,109,65,65,4,116,108,109,73,5,116,108,109,73,73,4,116,108,
+109,85,5,116,108,109,85,85,5,116,108,109,118,82,6,116,108,109,118,82,82,5,
+116,108,109,118,76,6,116,108,109,118,76,76,4,116,108,109,69,5,116,108,109,
+69,69,5,116,108,109,65,73,4,116,108,109,79,5,116,108,109,79,79,5,116,108,
+109,65,85,12,116,108,76,101,110,103,116,104,109,97,114,107,14,116,108,65,
+73,108,101,110,103,116,104,109,97,114,107,4,116,108,75,65,5,116,108,75,72,
+65,4,116,108,71,65,5,116,108,71,72,65,5,116,108,78,71,65,4,116,108,67,65,
+5,116,108,67,72,65,4,116,108,74,65,5,116,108,74,72,65,5,116,108,78,89,65,
+5,116,108,84,84,65,6,116,108,84,84,72,65,5,116,108,68,68,65,6,116,108,68,
+68,72,65,5,116,108,78,78,65,4,116,108,84,65,5,116,108,84,72,65,4,116,108,
+68,65,5,116,108,68,72,65,4,116,108,78,65,4,116,108,80,65,5,116,108,80,72,
+65,4,116,108,66,65,5,116,108,66,72,65,4,116,108,77,65,4,116,108,89,65,4,116,
+108,82,65,4,116,108,76,65,4,116,108,86,65,5,116,108,83,72,65,5,116,108,83,
+83,65,4,116,108,83,65,4,116,108,72,65,5,116,108,82,82,65,5,116,108,76,76,
+65,6,116,108,75,83,83,65,5,116,108,84,83,65,5,116,108,68,90,65,10,116,108,
+65,110,117,115,118,97,114,97,10,116,108,65,114,97,115,117,110,110,97,9,116,
+108,86,105,115,97,114,103,97,8,116,108,86,105,114,97,109,97,10,116,108,65,
+118,97,103,114,97,104,97,6,116,108,90,101,114,111,5,116,108,79,110,101,5,
+116,108,84,119,111,7,116,108,84,104,114,101,101,6,116,108,70,111,117,114,
+6,116,108,70,105,118,101,5,116,108,83,105,120,7,116,108,83,101,118,101,110,
+7,116,108,69,105,103,104,116,6,116,108,78,105,110,101,12,116,108,90,101,114,
+111,102,111,114,111,100,100,11,116,108,79,110,101,102,111,114,111,100,100,
+11,116,108,84,119,111,102,111,114,111,100,100,13,116,108,84,104,114,101,101,
+102,111,114,111,100,100,12,116,108,79,110,101,102,111,114,101,118,101,110,
+12,116,108,84,119,111,102,111,114,101,118,101,110,14,116,108,84,104,114,101,
+101,102,111,114,101,118,101,110,7,116,108,84,117,117,109,117,7,117,110,105,
+48,57,54,52,7,117,110,105,48,57,54,53,7,117,110,105,50,48,66,57,7,117,110,
+105,50,48,48,66,7,117,110,105,50,48,48,67,7,117,110,105,50,48,48,68,7,117,
+110,105,50,53,67,67,6,116,108,75,65,99,50,7,116,108,75,72,65,99,50,6,116,
+108,71,65,99,50,7,116,108,71,72,65,99,50,7,116,108,78,71,65,99,50,6,116,108,
+67,65,99,50,7,116,108,67,72,65,99,50,6,116,108,74,65,99,50,7,116,108,74,72,
+65,99,50,7,116,108,78,89,65,99,50,7,116,108,84,84,65,99,50,8,116,108,84,84,
+72,65,99,50,7,116,108,68,68,65,99,50,8,116,108,68,68,72,65,99,50,7,116,108,
+78,78,65,99,50,6,116,108,84,65,99,50,7,116,108,84,72,65,99,50,6,116,108,68,
+65,99,50,7,116,108,68,72,65,99,50,6,116,108,78,65,99,50,6,116,108,80,65,99,
+50,7,116,108,80,72,65,99,50,6,116,108,66,65,99,50,7,116,108,66,72,65,99,50,
+6,116,108,77,65,99,50,6,116,108,89,65,99,50,6,116,108,82,65,99,50,6,116,108,
+76,65,99,50,6,116,108,86,65,99,50,7,116,108,83,72,65,99,50,7,116,108,83,83,
+65,99,50,6,116,108,83,65,99,50,6,116,108,72,65,99,50,7,116,108,82,82,65,99,
+50,7,116,108,76,76,65,99,50,8,116,108,75,83,83,65,99,50,3,116,108,75,4,116,
+108,75,72,3,116,108,71,4,116,108,71,72,4,116,108,78,71,3,116,108,67,4,116,
+108,67,72,3,116,108,74,4,116,108,74,72,4,116,108,78,89,4,116,108,84,84,5,
+116,108,84,84,72,4,116,108,68,68,5,116,108,68,68,72,4,116,108,78,78,3,116,
+108,84,4,116,108,84,72,3,116,108,68,4,116,108,68,72,3,116,108,78,3,116,108,
+80,4,116,108,80,72,3,116,108,66,4,116,108,66,72,3,116,108,77,3,116,108,89,
+3,116,108,82,3,116,108,76,3,116,108,86,4,116,108,83,72,4,116,108,83,83,3,
+116,108,83,3,116,108,72,4,116,108,82,82,4,116,108,76,76,5,116,108,75,83,83,
+5,116,108,75,65,65,6,116,108,75,72,65,65,5,116,108,71,65,65,6,116,108,71,
+72,65,65,6,116,108,78,71,65,65,5,116,108,67,65,65,6,116,108,67,72,65,65,5,
+116,108,74,65,65,6,116,108,74,72,65,65,6,116,108,78,89,65,65,6,116,108,84,
+84,65,65,7,116,108,84,84,72,65,65,6,116,108,68,68,65,65,7,116,108,68,68,72,
+65,65,6,116,108,78,78,65,65,5,116,108,84,65,65,6,116,108,84,72,65,65,5,116,
+108,68,65,65,6,116,108,68,72,65,65,5,116,108,78,65,65,5,116,108,80,65,65,
+6,116,108,80,72,65,65,5,116,108,66,65,65,6,116,108,66,72,65,65,5,116,108,
+77,65,65,5,116,108,89,65,65,5,116,108,82,65,65,5,116,108,76,65,65,5,116,108,
+86,65,65,6,116,108,83,72,65,65,6,116,108,83,83,65,65,5,116,108,83,65,65,5,
+116,108,72,65,65,6,116,108,82,82,65,65,6,116,108,76,76,65,65,7,116,108,75,
+83,83,65,65,4,116,108,75,73,5,116,108,75,72,73,4,116,108,71,73,5,116,108,
+71,72,73,5,116,108,78,71,73,4,116,108,67,73,5,116,108,67,72,73,4,116,108,
+74,73,5,116,108,74,72,73,5,116,108,78,89,73,5,116,108,84,84,73,6,116,108,
+84,84,72,73,5,116,108,68,68,73,6,116,108,68,68,72,73,5,116,108,78,78,73,4,
+116,108,84,73,5,116,108,84,72,73,4,116,108,68,73,5,116,108,68,72,73,4,116,
+108,78,73,4,116,108,80,73,5,116,108,80,72,73,4,116,108,66,73,5,116,108,66,
+72,73,4,116,108,77,73,4,116,108,89,73,4,116,108,82,73,4,116,108,76,73,4,116,
+108,86,73,5,116,108,83,72,73,5,116,108,83,83,73,4,116,108,83,73,4,116,108,
+72,73,5,116,108,82,82,73,5,116,108,76,76,73,6,116,108,75,83,83,73,5,116,108,
+75,73,73,6,116,108,75,72,73,73,5,116,108,71,73,73,6,116,108,71,72,73,73,6,
+116,108,78,71,73,73,5,116,108,67,73,73,6,116,108,67,72,73,73,5,116,108,74,
+73,73,6,116,108,74,72,73,73,6,116,108,78,89,73,73,6,116,108,84,84,73,73,7,
+116,108,84,84,72,73,73,6,116,108,68,68,73,73,7,116,108,68,68,72,73,73,6,116,
+108,78,78,73,73,5,116,108,84,73,73,6,116,108,84,72,73,73,5,116,108,68,73,
+73,6,116,108,68,72,73,73,5,116,108,78,73,73,5,116,108,80,73,73,6,116,108,
+80,72,73,73,5,116,108,66,73,73,6,116,108,66,72,73,73,5,116,108,77,73,73,5,
+116,108,89,73,73,5,116,108,82,73,73,5,116,108,76,73,73,5,116,108,86,73,73,
+6,116,108,83,72,73,73,6,116,108,83,83,73,73,5,116,108,83,73,73,5,116,108,
+72,73,73,6,116,108,82,82,73,73,6,116,108,76,76,73,73,7,116,108,75,83,83,73,
+73,4,116,108,75,85,5,116,108,75,72,85,4,116,108,71,85,5,116,108,71,72,85,
+5,116,108,78,71,85,4,116,108,67,85,5,116,108,67,72,85,4,116,108,74,85,5,116,
+108,74,72,85,5,116,108,78,89,85,5,116,108,84,84,85,6,116,108,84,84,72,85,
+5,116,108,68,68,85,6,116,108,68,68,72,85,5,116,108,78,78,85,4,116,108,84,
+85,5,116,108,84,72,85,4,116,108,68,85,5,116,108,68,72,85,4,116,108,78,85,
+4,116,108,80,85,5,116,108,80,72,85,4,116,108,66,85,5,116,108,66,72,85,4,116,
+108,77,85,4,116,108,89,85,4,116,108,82,85,4,116,108,76,85,4,116,108,86,85,
+5,116,108,83,72,85,5,116,108,83,83,85,4,116,108,83,85,4,116,108,72,85,5,116,
+108,82,82,85,5,116,108,76,76,85,6,116,108,75,83,83,85,5,116,108,75,85,85,
+6,116,108,75,72,85,85,5,116,108,71,85,85,6,116,108,71,72,85,85,6,116,108,
+78,71,85,85,5,116,108,67,85,85,6,116,108,67,72,85,85,5,116,108,74,85,85,6,
+116,108,74,72,85,85,6,116,108,78,89,85,85,6,116,108,84,84,85,85,7,116,108,
+84,84,72,85,85,6,116,108,68,68,85,85,7,116,108,68,68,72,85,85,6,116,108,78,
+78,85,85,5,116,108,84,85,85,6,116,108,84,72,85,85,5,116,108,68,85,85,6,116,
+108,68,72,85,85,5,116,108,78,85,85,5,116,108,80,85,85,6,116,108,80,72,85,
+85,5,116,108,66,85,85,6,116,108,66,72,85,85,5,116,108,77,85,85,5,116,108,
+89,85,85,5,116,108,82,85,85,5,116,108,76,85,85,5,116,108,86,85,85,6,116,108,
+83,72,85,85,6,116,108,83,83,85,85,5,116,108,83,85,85,5,116,108,72,85,85,6,
+116,108,82,82,85,85,6,116,108,76,76,85,85,7,116,108,75,83,83,85,85,4,116,
+108,75,69,5,116,108,75,72,69,4,116,108,71,69,5,116,108,71,72,69,5,116,108,
+78,71,69,4,116,108,67,69,5,116,108,67,72,69,4,116,108,74,69,5,116,108,74,
+72,69,5,116,108,78,89,69,5,116,108,84,84,69,6,116,108,84,84,72,69,5,116,108,
+68,68,69,6,116,108,68,68,72,69,5,116,108,78,78,69,4,116,108,84,69,5,116,108,
+84,72,69,4,116,108,68,69,5,116,108,68,72,69,4,116,108,78,69,4,116,108,80,
+69,5,116,108,80,72,69,4,116,108,66,69,5,116,108,66,72,69,4,116,108,77,69,
+4,116,108,89,69,4,116,108,82,69,4,116,108,76,69,4,116,108,86,69,5,116,108,
+83,72,69,5,116,108,83,83,69,4,116,108,83,69,4,116,108,72,69,5,116,108,82,
+82,69,5,116,108,76,76,69,6,116,108,75,83,83,69,5,116,108,75,69,69,6,116,108,
+75,72,69,69,5,116,108,71,69,69,6,116,108,71,72,69,69,6,116,108,78,71,69,69,
+5,116,108,67,69,69,6,116,108,67,72,69,69,5,116,108,74,69,69,6,116,108,74,
+72,69,69,6,116,108,78,89,69,69,6,116,108,84,84,69,69,7,116,108,84,84,72,69,
+69,6,116,108,68,68,69,69,7,116,108,68,68,72,69,69,6,116,108,78,78,69,69,5,
+116,108,84,69,69,6,116,108,84,72,69,69,5,116,108,68,69,69,6,116,108,68,72,
+69,69,5,116,108,78,69,69,5,116,108,80,69,69,6,116,108,80,72,69,69,5,116,108,
+66,69,69,6,116,108,66,72,69,69,5,116,108,77,69,69,5,116,108,89,69,69,5,116,
+108,82,69,69,5,116,108,76,69,69,5,116,108,86,69,69,6,116,108,83,72,69,69,
+6,116,108,83,83,69,69,5,116,108,83,69,69,5,116,108,72,69,69,6,116,108,82,
+82,69,69,6,116,108,76,76,69,69,7,116,108,75,83,83,69,69,5,116,108,75,65,73,
+6,116,108,75,72,65,73,5,116,108,71,65,73,6,116,108,71,72,65,73,6,116,108,
+78,71,65,73,5,116,108,67,65,73,6,116,108,67,72,65,73,5,116,108,74,65,73,6,
+116,108,74,72,65,73,6,116,108,78,89,65,73,6,116,108,84,84,65,73,7,116,108,
+84,84,72,65,73,6,116,108,68,68,65,73,7,116,108,68,68,72,65,73,6,116,108,78,
+78,65,73,5,116,108,84,65,73,6,116,108,84,72,65,73,5,116,108,68,65,73,6,116,
+108,68,72,65,73,5,116,108,78,65,73,5,116,108,80,65,73,6,116,108,80,72,65,
+73,5,116,108,66,65,73,6,116,108,66,72,65,73,5,116,108,77,65,73,5,116,108,
+89,65,73,5,116,108,82,65,73,5,116,108,76,65,73,5,116,108,86,65,73,6,116,108,
+83,72,65,73,6,116,108,83,83,65,73,5,116,108,83,65,73,5,116,108,72,65,73,6,
+116,108,82,82,65,73,6,116,108,76,76,65,73,7,116,108,75,83,83,65,73,4,116,
+108,75,79,5,116,108,75,72,79,4,116,108,71,79,5,116,108,71,72,79,5,116,108,
+78,71,79,4,116,108,67,79,5,116,108,67,72,79,4,116,108,74,79,5,116,108,74,
+72,79,5,116,108,78,89,79,5,116,108,84,84,79,6,116,108,84,84,72,79,5,116,108,
+68,68,79,6,116,108,68,68,72,79,5,116,108,78,78,79,4,116,108,84,79,5,116,108,
+84,72,79,4,116,108,68,79,5,116,108,68,72,79,4,116,108,78,79,4,116,108,80,
+79,5,116,108,80,72,79,4,116,108,66,79,5,116,108,66,72,79,4,116,108,77,79,
+4,116,108,89,79,4,116,108,82,79,4,116,108,76,79,4,116,108,86,79,5,116,108,
+83,72,79,5,116,108,83,83,79,4,116,108,83,79,4,116,108,72,79,5,116,108,82,
+82,79,5,116,108,76,76,79,6,116,108,75,83,83,79,5,116,108,75,79,79,6,116,108,
+75,72,79,79,5,116,108,71,79,79,6,116,108,71,72,79,79,6,116,108,78,71,79,79,
+5,116,108,67,79,79,6,116,108,67,72,79,79,5,116,108,74,79,79,6,116,108,74,
+72,79,79,6,116,108,78,89,79,79,6,116,108,84,84,79,79,7,116,108,84,84,72,79,
+79,6,116,108,68,68,79,79,7,116,108,68,68,72,79,79,6,116,108,78,78,79,79,5,
+116,108,84,79,79,6,116,108,84,72,79,79,5,116,108,68,79,79,6,116,108,68,72,
+79,79,5,116,108,78,79,79,5,116,108,80,79,79,6,116,108,80,72,79,79,5,116,108,
+66,79,79,6,116,108,66,72,79,79,5,116,108,77,79,79,5,116,108,89,79,79,5,116,
+108,82,79,79,5,116,108,76,79,79,5,116,108,86,79,79,6,116,108,83,72,79,79,
+6,116,108,83,83,79,79,5,116,108,83,79,79,5,116,108,72,79,79,6,116,108,82,
+82,79,79,6,116,108,76,76,79,79,7,116,108,75,83,83,79,79,5,116,108,75,65,85,
+6,116,108,75,72,65,85,5,116,108,71,65,85,6,116,108,71,72,65,85,6,116,108,
+78,71,65,85,5,116,108,67,65,85,6,116,108,67,72,65,85,5,116,108,74,65,85,6,
+116,108,74,72,65,85,6,116,108,78,89,65,85,6,116,108,84,84,65,85,7,116,108,
+84,84,72,65,85,6,116,108,68,68,65,85,7,116,108,68,68,72,65,85,6,116,108,78,
+78,65,85,5,116,108,84,65,85,6,116,108,84,72,65,85,5,116,108,68,65,85,6,116,
+108,68,72,65,85,5,116,108,78,65,85,5,116,108,80,65,85,6,116,108,80,72,65,
+85,5,116,108,66,65,85,6,116,108,66,72,65,85,5,116,108,77,65,85,5,116,108,
+89,65,85,5,116,108,82,65,85,5,116,108,76,65,85,5,116,108,86,65,85,6,116,108,
+83,72,65,85,6,116,108,83,83,65,85,5,116,108,83,65,85,5,116,108,72,65,85,6,
+116,108,82,82,65,85,6,116,108,76,76,65,85,7,116,108,75,83,83,65,85,15,116,
+108,109,118,82,46,102,111,108,108,111,119,105,110,103,16,116,108,109,118,
+82,82,46,102,111,108,108,111,119,105,110,103,16,116,108,75,65,99,50,46,102,
+111,108,108,111,119,105,110,103,17,116,108,75,72,65,99,50,46,102,111,108,
+108,111,119,105,110,103,16,116,108,71,65,99,50,46,102,111,108,108,111,119,
+105,110,103,17,116,108,71,72,65,99,50,46,102,111,108,108,111,119,105,110,
+103,17,116,108,78,71,65,99,50,46,102,111,108,108,111,119,105,110,103,16,116,
+108,67,65,99,50,46,102,111,108,108,111,119,105,110,103,17,116,108,67,72,65,
+99,50,46,102,111,108,108,111,119,105,110,103,16,116,108,74,65,99,50,46,102,
+111,108,108,111,119,105,110,103,17,116,108,74,72,65,99,50,46,102,111,108,
+108,111,119,105,110,103,17,116,108,78,89,65,99,50,46,102,111,108,108,111,
+119,105,110,103,17,116,108,84,84,65,99,50,46,102,111,108,108,111,119,105,
+110,103,18,116,108,84,84,72,65,99,50,46,102,111,108,108,111,119,105,110,103,
+17,116,108,68,68,65,99,50,46,102,111,108,108,111,119,105,110,103,18,116,108,
+68,68,72,65,99,50,46,102,111,108,108,111,119,105,110,103,17,116,108,78,78,
+65,99,50,46,102,111,108,108,111,119,105,110,103,16,116,108,84,65,99,50,46,
+102,111,108,108,111,119,105,110,103,17,116,108,84,72,65,99,50,46,102,111,
+108,108,111,119,105,110,103,16,116,108,68,65,99,50,46,102,111,108,108,111,
+119,105,110,103,17,116,108,68,72,65,99,50,46,102,111,108,108,111,119,105,
+110,103,16,116,108,78,65,99,50,46,102,111,108,108,111,119,105,110,103,16,
+116,108,80,65,99,50,46,102,111,108,108,111,119,105,110,103,17,116,108,80,
+72,65,99,50,46,102,111,108,108,111,119,105,110,103,16,116,108,66,65,99,50,
+46,102,111,108,108,111,119,105,110,103,17,116,108,66,72,65,99,50,46,102,111,
+108,108,111,119,105,110,103,16,116,108,77,65,99,50,46,102,111,108,108,111,
+119,105,110,103,16,116,108,89,65,99,50,46,102,111,108,108,111,119,105,110,
+103,16,116,108,82,65,99,50,46,102,111,108,108,111,119,105,110,103,16,116,
+108,76,65,99,50,46,102,111,108,108,111,119,105,110,103,16,116,108,86,65,99,
+50,46,102,111,108,108,111,119,105,110,103,17,116,108,83,72,65,99,50,46,102,
+111,108,108,111,119,105,110,103,17,116,108,83,83,65,99,50,46,102,111,108,
+108,111,119,105,110,103,16,116,108,83,65,99,50,46,102,111,108,108,111,119,
+105,110,103,16,116,108,72,65,99,50,46,102,111,108,108,111,119,105,110,103,
+17,116,108,82,82,65,99,50,46,102,111,108,108,111,119,105,110,103,17,116,108,
+76,76,65,99,50,46,102,111,108,108,111,119,105,110,103,18,116,108,75,83,83,
+65,99,50,46,102,111,108,108,111,119,105,110,103,11,116,108,84,65,99,50,95,
+82,65,99,50,9,116,108,82,65,99,50,46,48,49,9,116,108,82,65,99,50,46,48,50,
+9,116,108,82,65,99,50,46,48,51,9,116,108,82,65,99,50,46,48,52,9,116,108,82,
+65,99,50,46,48,53,9,116,108,82,65,99,50,46,48,54,9,116,108,82,65,99,50,46,
+48,55,9,116,108,82,65,99,50,46,48,56,9,116,108,82,65,99,50,46,48,57,9,116,
+108,82,65,99,50,46,49,48,7,117,110,105,48,48,65,68,4,95,54,55,50,0,0,0,0,
+0,0,2,0,8,0,2,255,255,0,3,0,1,0,0,0,12,0,0,0,0,0,0,0,2,0,4,0,27,0,28,0,3,
+0,36,0,36,0,3,0,105,0,140,0,3,2,63,2,109,0,3,0,1,0,0,0,10,0,66,0,110,0,3,
+68,70,76,84,0,20,116,101,108,50,0,32,116,101,108,117,0,44,0,4,0,0,0,0,255,
+255,0,1,0,0,0,4,0,0,0,0,255,255,0,1,0,1,0,4,0,0,0,0,255,255,0,1,0,2,0,3,98,
+108,119,109,0,20,98,108,119,109,0,28,98,108,119,109,0,36,0,0,0,2,0,0,0,1,
+0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,2,0,6,0,14,0,4,0,0,0,1,0,16,0,6,0,0,0,1,
+7,44,0,1,8,216,9,18,0,1,0,12,0,158,0,36,0,0,4,90,0,0,4,90,0,0,4,96,0,0,4,
+108,0,0,4,66,0,0,4,72,0,0,4,78,0,0,4,102,0,0,4,66,0,0,4,126,0,0,4,78,0,0,
+4,138,0,0,4,78,0,0,4,78,0,0,4,120,0,0,4,84,0,0,4,84,0,0,4,84,0,0,4,84,0,0,
+4,60,0,0,4,114,0,0,4,72,0,0,4,78,0,0,4,78,0,0,4,84,0,0,4,132,0,0,4,60,0,0,
+4,60,0,0,4,60,0,0,4,60,0,0,4,60,0,0,4,60,0,0,4,60,0,0,4,60,0,0,4,60,0,0,4,
+60,1,212,3,254,4,4,4,10,4,16,4,22,4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,
+4,76,4,82,4,88,4,94,4,100,4,94,4,106,4,106,4,112,4,118,4,124,4,130,4,136,
+4,64,4,142,4,148,4,154,4,106,4,160,4,166,4,172,4,178,4,184,4,190,4,196,3,
+254,4,4,4,10,4,16,4,22,4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,
+4,88,4,94,4,100,4,94,4,106,4,106,4,112,4,118,4,124,4,130,4,136,4,64,4,142,
+4,148,4,154,4,106,4,160,4,166,4,172,4,178,4,184,3,254,4,4,4,10,4,16,4,22,
+4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,4,88,4,94,4,100,4,94,4,
+106,4,106,4,112,4,118,4,124,4,202,4,208,4,64,4,142,4,148,4,154,4,106,4,160,
+4,166,4,172,4,178,4,184,3,254,4,4,4,10,4,16,4,22,4,28,4,34,4,40,4,46,4,52,
+4,58,4,64,4,70,4,76,4,82,4,88,4,94,4,100,4,94,4,106,4,112,4,118,4,124,4,214,
+4,136,4,64,4,142,4,148,4,154,4,106,4,160,4,166,4,172,4,178,4,184,3,254,4,
+4,4,10,4,16,4,22,4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,4,88,4,
+94,4,100,4,94,4,106,4,112,4,118,4,124,4,214,4,136,4,64,4,142,4,148,4,154,
+4,106,4,160,4,166,4,172,4,178,4,184,4,220,4,226,4,232,4,238,4,244,4,250,5,
+0,4,40,5,6,5,12,5,18,5,24,5,30,5,36,5,42,5,48,5,54,5,60,5,66,5,72,5,78,5,
+78,5,84,5,90,5,96,5,102,5,108,5,114,5,78,5,120,5,126,5,72,5,132,5,138,5,144,
+4,184,4,220,4,226,4,232,4,238,4,244,4,250,5,0,4,40,5,6,5,12,5,18,5,24,5,30,
+5,36,5,42,5,48,5,54,5,60,5,66,5,72,5,78,5,78,5,84,5,90,5,96,5,102,5,108,5,
+114,5,78,5,120,5,126,5,72,5,132,5,138,5,144,4,184,3,254,4,4,4,10,5,150,4,
+22,4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,4,88,4,94,4,100,4,94,
+4,106,5,24,5,156,4,118,4,124,4,130,4,136,4,64,4,142,4,148,4,154,5,24,5,162,
+5,168,4,172,4,178,4,184,3,254,4,4,4,10,5,150,4,22,4,28,4,34,4,40,4,46,4,52,
+4,58,4,64,4,70,4,76,4,82,4,88,4,94,4,100,4,94,4,106,5,24,5,156,4,118,4,124,
+4,130,4,136,4,64,4,142,4,148,4,154,5,24,5,162,5,168,4,172,4,178,4,184,5,174,
+5,180,5,186,5,192,5,198,5,204,5,204,5,210,5,216,5,222,5,228,5,234,5,240,5,
+240,5,246,5,252,6,2,6,2,6,2,6,8,6,14,6,14,6,20,6,26,6,32,6,38,5,234,6,26,
+6,44,6,50,6,56,6,62,6,68,6,74,6,80,6,86,3,254,4,4,4,10,6,92,4,22,4,28,4,34,
+4,40,6,98,4,52,4,58,4,64,4,70,4,76,4,82,4,88,4,94,4,100,4,94,4,106,4,106,
+4,112,4,118,4,124,6,104,6,110,4,64,4,142,4,148,4,154,4,106,4,160,4,166,4,
+172,4,178,4,184,3,254,4,4,4,10,6,116,4,22,4,28,4,34,4,40,4,46,4,52,4,58,4,
+64,4,70,4,76,4,82,4,88,4,94,4,100,4,94,4,106,4,106,4,112,4,118,4,124,4,130,
+6,122,4,64,4,142,4,148,4,154,4,106,4,160,4,166,4,172,4,178,4,184,3,254,4,
+4,4,10,4,16,4,22,4,28,4,34,4,40,4,46,4,52,4,58,4,64,4,70,4,76,4,82,4,88,4,
+94,4,100,4,94,4,106,4,106,4,112,4,118,4,124,4,130,6,128,4,64,4,142,4,148,
+4,154,4,106,4,160,4,166,4,172,4,178,4,184,0,1,0,0,255,205,0,1,0,0,255,176,
+0,1,0,0,255,173,0,1,0,0,255,170,0,1,0,0,255,169,0,1,253,183,255,171,0,1,253,
+183,255,180,0,1,0,0,255,172,0,1,255,255,255,178,0,1,0,0,255,148,0,1,0,0,255,
+171,0,1,255,255,255,170,0,1,0,1,255,181,0,1,255,255,255,171,0,1,1,230,255,
+206,0,1,2,226,255,156,0,1,2,83,255,206,0,1,3,254,255,156,0,1,2,143,255,206,
+0,1,2,211,255,206,0,1,2,211,255,156,0,1,2,153,255,206,0,1,4,223,255,156,0,
+1,2,144,255,206,0,1,2,205,255,206,0,1,2,74,255,206,0,1,2,224,255,206,0,1,
+2,224,255,156,0,1,3,70,255,206,0,1,3,37,255,206,0,1,2,169,255,156,0,1,2,169,
+255,206,0,1,2,189,255,206,0,1,2,189,255,156,0,1,2,188,255,206,0,1,2,178,255,
+156,0,1,4,11,255,206,0,1,4,194,255,206,0,1,2,178,255,206,0,1,2,198,255,206,
+0,1,2,100,255,206,0,1,2,192,255,206,0,1,3,231,255,206,0,1,2,240,255,206,0,
+1,2,93,255,206,0,1,1,230,254,32,0,1,2,166,255,206,0,1,2,130,255,206,0,1,4,
+22,255,206,0,1,4,200,255,206,0,1,4,41,255,206,0,1,3,47,255,206,0,1,4,43,255,
+156,0,1,3,153,255,206,0,1,5,74,255,156,0,1,3,207,255,206,0,1,3,255,255,206,
+0,1,3,253,255,156,0,1,6,44,255,156,0,1,4,253,255,206,0,1,4,24,255,206,0,1,
+3,144,255,206,0,1,4,36,255,206,0,1,4,38,255,156,0,1,4,142,255,206,0,1,4,104,
+255,206,0,1,3,243,255,156,0,1,3,243,255,206,0,1,3,241,255,156,0,1,4,5,255,
+206,0,1,3,113,254,162,0,1,4,0,255,206,0,1,3,247,255,156,0,1,5,83,255,206,
+0,1,6,14,255,206,0,1,3,147,255,206,0,1,3,246,255,206,0,1,3,143,255,206,0,
+1,4,7,255,206,0,1,5,131,255,206,0,1,4,57,255,206,0,1,3,176,255,206,0,1,4,
+219,255,156,0,1,3,144,255,156,0,1,3,137,255,206,0,1,4,186,255,206,0,1,1,230,
+253,168,0,1,2,226,253,168,0,1,2,83,253,168,0,1,4,229,253,168,0,1,2,143,253,
+168,0,1,2,211,253,168,0,1,2,153,253,168,0,1,4,223,253,168,0,1,2,144,253,168,
+0,1,2,205,253,168,0,1,2,74,253,168,0,1,2,224,253,168,0,1,3,70,253,168,0,1,
+3,37,253,168,0,1,2,169,253,168,0,1,2,189,253,168,0,1,3,144,253,168,0,1,2,
+188,253,168,0,1,2,178,253,168,0,1,4,11,253,168,0,1,4,194,253,168,0,1,2,198,
+253,168,0,1,2,100,253,168,0,1,4,77,253,168,0,1,3,137,253,168,0,1,4,186,253,
+168,0,1,2,240,253,168,0,1,2,93,253,168,0,1,1,230,252,164,0,1,6,21,255,156,
+0,1,6,41,255,156,0,1,5,80,255,206,0,1,6,2,255,206,0,1,4,208,255,156,0,1,4,
+199,255,206,0,1,4,192,255,206,0,1,1,180,2,10,0,1,0,12,0,158,0,36,0,0,0,244,
+0,0,0,244,0,0,0,250,0,0,1,6,0,0,0,220,0,0,0,226,0,0,0,232,0,0,1,0,0,0,0,220,
+0,0,1,24,0,0,0,232,0,0,1,36,0,0,0,232,0,0,0,232,0,0,1,18,0,0,0,238,0,0,0,
+238,0,0,0,238,0,0,0,238,0,0,0,214,0,0,1,12,0,0,0,226,0,0,0,232,0,0,0,232,
+0,0,0,238,0,0,1,30,0,0,0,214,0,0,0,214,0,0,0,214,0,0,0,214,0,0,0,214,0,0,
+0,214,0,0,0,214,0,0,0,214,0,0,0,214,0,0,0,214,0,33,0,152,0,158,0,164,0,170,
+0,170,0,170,0,176,0,170,0,176,0,170,0,164,0,170,0,182,0,164,0,188,0,164,0,
+194,0,200,0,170,0,170,0,206,0,212,0,218,0,224,0,230,0,194,0,236,0,242,0,248,
+0,254,1,4,1,10,1,16,0,1,0,0,255,205,0,1,0,0,255,176,0,1,0,0,255,173,0,1,0,
+0,255,170,0,1,0,0,255,169,0,1,253,183,255,171,0,1,253,183,255,180,0,1,0,0,
+255,172,0,1,255,255,255,178,0,1,0,0,255,148,0,1,0,0,255,171,0,1,255,255,255,
+170,0,1,0,1,255,181,0,1,255,255,255,171,0,1,255,255,252,27,0,1,0,0,252,89,
+0,1,0,0,252,27,0,1,0,0,252,178,0,1,255,255,252,178,0,1,0,0,253,92,0,1,0,0,
+252,176,0,1,0,0,253,25,0,1,0,0,252,189,0,1,0,0,252,179,0,1,0,0,251,173,0,
+1,0,1,251,232,0,1,0,0,253,98,0,1,0,0,253,62,0,1,0,0,252,245,0,1,0,0,252,209,
+0,1,0,0,252,173,0,1,0,0,252,137,0,1,0,0,252,101,0,1,0,0,252,65,0,1,0,0,252,
+29,0,2,0,9,0,27,0,28,0,0,0,36,0,36,0,2,0,106,0,109,0,3,0,112,0,123,0,7,0,
+131,0,132,0,19,0,135,0,135,0,21,0,137,0,138,0,22,0,140,0,140,0,24,2,99,2,
+109,0,25,0,2,0,4,0,37,0,74,0,0,0,141,0,231,0,38,0,233,1,11,0,129,1,13,2,60,
+0,164,0,2,0,7,0,106,0,109,0,0,0,112,0,123,0,4,0,131,0,132,0,16,0,135,0,135,
+0,18,0,137,0,138,0,19,0,140,0,140,0,21,2,99,2,109,0,22,0,1,0,0,0,10,0,78,
+0,236,0,3,68,70,76,84,0,20,116,101,108,50,0,36,116,101,108,117,0,52,0,4,0,
+0,0,0,255,255,0,3,0,0,0,3,0,6,0,4,0,0,0,0,255,255,0,3,0,1,0,4,0,7,0,4,0,0,
+0,0,255,255,0,3,0,2,0,5,0,8,0,9,98,108,119,102,0,56,98,108,119,102,0,62,98,
+108,119,102,0,68,104,97,108,110,0,74,104,97,108,110,0,80,104,97,108,110,0,
+86,112,114,101,115,0,92,112,114,101,115,0,114,112,114,101,115,0,136,0,0,0,
+1,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,1,0,15,0,0,0,1,0,15,0,0,0,1,0,15,0,0,
+0,9,0,2,0,3,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,0,0,9,0,2,0,3,0,8,0,9,0,10,
+0,11,0,12,0,13,0,14,0,0,0,9,0,2,0,3,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,50,
+0,102,0,118,0,134,0,150,0,166,1,136,1,152,1,168,1,184,1,220,1,236,1,252,2,
+12,2,98,2,114,2,190,2,206,2,222,2,238,2,254,3,14,3,30,3,46,3,62,3,78,3,94,
+3,110,3,126,3,142,3,158,3,174,3,190,3,206,3,222,3,238,3,254,4,14,4,30,4,46,
+4,62,4,78,4,94,4,110,4,126,4,142,4,158,4,174,4,190,4,206,4,222,0,7,0,0,0,
+1,0,8,0,1,0,4,0,0,4,128,0,7,0,0,0,1,0,8,0,1,0,4,0,0,5,152,0,7,0,0,0,1,0,8,
+0,1,0,4,0,0,7,60,0,7,0,0,0,1,0,8,0,1,0,6,0,0,7,68,0,7,0,0,0,22,0,50,0,58,
+0,66,0,74,0,82,0,90,0,98,0,106,0,114,0,122,0,130,0,138,0,146,0,154,0,162,
+0,170,0,178,0,186,0,194,0,202,0,210,0,218,0,1,0,6,0,0,7,52,0,1,0,6,0,0,7,
+78,0,1,0,6,0,0,7,104,0,1,0,6,0,0,7,130,0,1,0,6,0,0,7,156,0,1,0,6,0,0,7,182,
+0,1,0,6,0,0,7,208,0,1,0,6,0,0,7,234,0,1,0,6,0,0,8,4,0,1,0,6,0,0,8,30,0,1,
+0,6,0,0,8,56,0,1,0,6,0,0,8,82,0,1,0,6,0,0,8,108,0,1,0,6,0,0,8,134,0,1,0,6,
+0,0,8,160,0,1,0,6,0,0,8,186,0,1,0,6,0,0,8,212,0,1,0,6,0,0,8,238,0,1,0,6,0,
+0,9,8,0,1,0,6,0,0,9,34,0,1,0,6,0,0,9,60,0,1,0,6,0,0,9,86,0,7,0,0,0,1,0,8,
+0,1,0,1,0,0,9,104,0,7,0,0,0,1,0,8,0,1,0,1,0,0,9,184,0,7,0,0,0,1,0,8,0,1,0,
+1,0,0,10,8,0,7,0,0,0,3,0,12,0,20,0,28,0,1,0,6,0,0,10,84,0,1,0,6,0,0,10,150,
+0,1,0,6,0,0,10,216,0,7,0,0,0,1,0,8,0,1,0,6,0,0,11,18,0,7,0,0,0,1,0,8,0,1,
+0,4,0,0,11,64,0,7,0,0,0,1,0,8,0,1,0,4,0,0,11,72,0,7,0,0,0,8,0,22,0,30,0,38,
+0,46,0,54,0,62,0,70,0,78,0,1,0,6,0,0,11,66,0,1,0,6,0,0,11,98,0,1,0,6,0,0,
+11,154,0,1,0,6,0,0,11,178,0,1,0,6,0,0,11,226,0,1,0,6,0,0,11,252,0,1,0,6,0,
+0,12,46,0,1,0,6,0,0,12,70,0,7,0,0,0,1,0,8,0,1,0,4,0,0,12,110,0,7,0,0,0,7,
+0,20,0,28,0,36,0,44,0,52,0,60,0,68,0,1,0,6,0,0,25,172,0,1,0,6,0,0,25,226,
+0,1,0,6,0,0,26,4,0,1,0,6,0,0,26,38,0,1,0,6,0,0,26,140,0,1,0,6,0,0,26,182,
+0,1,0,6,0,0,26,228,0,7,0,8,0,1,0,8,0,1,0,4,0,0,27,6,0,7,0,0,0,1,0,8,0,1,0,
+4,0,0,28,182,0,7,0,0,0,1,0,8,0,1,0,1,0,0,28,190,0,7,0,0,0,1,0,8,0,1,0,1,0,
+0,28,196,0,7,0,0,0,1,0,8,0,1,0,1,0,0,28,202,0,7,0,0,0,1,0,8,0,1,0,1,0,0,28,
+208,0,7,0,0,0,1,0,8,0,1,0,1,0,0,28,214,0,7,0,0,0,1,0,8,0,1,0,1,0,0,28,220,
+0,7,0,0,0,1,0,8,0,1,0,1,0,0,28,226,0,7,0,0,0,1,0,8,0,1,0,1,0,0,28,232,0,7,
+0,0,0,1,0,8,0,1,0,1,0,0,28,238,0,7,0,0,0,1,0,8,0,1,0,1,0,0,28,244,0,7,0,0,
+0,1,0,8,0,1,0,1,0,0,28,250,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,0,0,7,0,0,0,1,0,
+8,0,1,0,1,0,0,29,6,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,12,0,7,0,0,0,1,0,8,0,1,
+0,1,0,0,29,18,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,24,0,7,0,0,0,1,0,8,0,1,0,1,0,
+0,29,30,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,36,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,
+42,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,48,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,54,0,
+7,0,0,0,1,0,8,0,1,0,1,0,0,29,60,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,154,0,7,0,
+0,0,1,0,8,0,1,0,1,0,0,29,150,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,146,0,7,0,0,0,
+1,0,8,0,1,0,1,0,0,29,142,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,138,0,7,0,0,0,1,0,
+8,0,1,0,1,0,0,29,170,0,7,0,0,0,1,0,8,0,1,0,1,0,0,29,202,0,7,0,0,0,1,0,8,0,
+1,0,1,0,0,29,234,0,7,0,0,0,1,0,8,0,1,0,1,0,0,30,10,0,7,0,0,0,1,0,8,0,1,0,
+1,0,0,30,42,0,7,0,0,0,1,0,8,0,1,0,1,0,0,30,74,0,1,0,8,0,1,0,14,0,1,0,1,0,
+78,0,35,0,72,0,78,0,84,0,90,0,96,0,102,0,108,0,114,0,120,0,126,0,132,0,138,
+0,144,0,150,0,156,0,162,0,168,0,174,0,180,0,186,0,192,0,198,0,204,0,210,0,
+216,0,222,0,228,0,234,0,240,0,246,0,252,1,2,1,8,1,14,1,20,0,105,0,2,0,37,
+0,106,0,2,0,38,0,107,0,2,0,39,0,108,0,2,0,40,0,109,0,2,0,41,0,110,0,2,0,42,
+0,111,0,2,0,43,0,112,0,2,0,44,0,113,0,2,0,45,0,114,0,2,0,46,0,115,0,2,0,47,
+0,116,0,2,0,48,0,117,0,2,0,49,0,118,0,2,0,50,0,119,0,2,0,51,0,120,0,2,0,52,
+0,121,0,2,0,53,0,122,0,2,0,54,0,123,0,2,0,55,0,124,0,2,0,56,0,125,0,2,0,57,
+0,126,0,2,0,58,0,127,0,2,0,59,0,128,0,2,0,60,0,129,0,2,0,61,0,130,0,2,0,62,
+0,131,0,2,0,63,0,132,0,2,0,64,0,133,0,2,0,65,0,134,0,2,0,66,0,135,0,2,0,67,
+0,136,0,2,0,68,0,137,0,2,0,69,0,138,0,2,0,70,0,139,0,2,0,71,0,1,0,76,0,35,
+0,86,0,90,0,94,0,98,0,102,0,106,0,110,0,114,0,118,0,122,0,126,0,130,0,134,
+0,138,0,142,0,146,0,150,0,154,0,158,0,162,0,166,0,170,0,174,0,178,0,182,0,
+186,0,190,0,194,0,198,0,202,0,206,0,210,0,214,0,218,0,222,0,2,0,1,0,37,0,
+71,0,0,0,1,0,140,0,1,0,142,0,1,0,144,0,1,0,146,0,1,0,148,0,1,0,150,0,1,0,
+152,0,1,0,154,0,1,0,156,0,1,0,158,0,1,0,160,0,1,0,162,0,1,0,164,0,1,0,166,
+0,1,0,168,0,1,0,170,0,1,0,172,0,1,0,174,0,1,0,176,0,1,0,178,0,1,0,180,0,1,
+0,182,0,1,0,184,0,1,0,186,0,1,0,188,0,1,0,190,0,1,0,192,0,1,0,194,0,1,0,196,
+0,1,0,198,0,1,0,200,0,1,0,202,0,1,0,204,0,1,0,206,0,1,0,208,0,105,0,2,0,78,
+0,106,0,2,0,78,0,107,0,2,0,78,0,108,0,2,0,78,0,109,0,2,0,78,0,110,0,2,0,78,
+0,111,0,2,0,78,0,112,0,2,0,78,0,113,0,2,0,78,0,114,0,2,0,78,0,115,0,2,0,78,
+0,116,0,2,0,78,0,117,0,2,0,78,0,118,0,2,0,78,0,119,0,2,0,78,0,120,0,2,0,78,
+0,121,0,2,0,78,0,122,0,2,0,78,0,123,0,2,0,78,0,124,0,2,0,78,0,125,0,2,0,78,
+0,126,0,2,0,78,0,127,0,2,0,78,0,128,0,2,0,78,0,129,0,2,0,78,0,130,0,2,0,78,
+0,131,0,2,0,78,0,132,0,2,0,78,0,133,0,2,0,78,0,134,0,2,0,78,0,135,0,2,0,78,
+0,136,0,2,0,78,0,137,0,2,0,78,0,138,0,2,0,78,0,139,0,2,0,78,0,1,0,8,0,1,0,
+14,0,1,0,1,0,105,0,1,0,4,0,140,0,2,0,135,0,3,0,1,0,20,0,2,0,30,0,36,0,0,0,
+1,0,0,0,16,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,120,0,1,0,1,0,131,0,3,0,0,0,1,
+0,18,0,1,0,28,0,1,0,0,0,17,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,106,0,3,0,0,0,
+1,0,18,0,1,0,28,0,1,0,0,0,18,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,107,0,3,0,0,
+0,1,0,18,0,1,0,28,0,1,0,0,0,19,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,108,0,3,0,
+0,0,1,0,18,0,1,0,28,0,1,0,0,0,20,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,109,0,3,
+0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,21,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,112,0,
+3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,22,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,113,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,23,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,114,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,24,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,115,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,25,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,116,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,26,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,117,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,27,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,118,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,28,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,119,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,29,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,120,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,30,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,121,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,31,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,122,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,32,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,123,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,33,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,132,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,34,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,135,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,35,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,137,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,36,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,138,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,37,0,1,0,3,0,27,0,28,0,36,0,1,0,1,0,140,
+0,3,0,0,0,1,0,18,0,1,0,28,0,1,0,0,0,38,0,1,0,3,0,27,0,28,0,36,0,1,0,1,2,99,
+0,2,0,50,0,22,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,
+0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,2,0,7,0,106,0,109,0,0,
+0,112,0,123,0,4,0,132,0,132,0,16,0,135,0,135,0,17,0,137,0,138,0,18,0,140,
+0,140,0,20,2,99,2,99,0,21,0,2,0,50,0,22,0,27,0,27,0,27,0,27,0,27,0,27,0,27,
+0,27,0,27,0,27,0,27,0,27,0,27,0,27,0,27,0,27,0,27,0,27,0,27,0,27,0,27,0,27,
+0,2,0,7,0,106,0,109,0,0,0,112,0,123,0,4,0,132,0,132,0,16,0,135,0,135,0,17,
+0,137,0,138,0,18,0,140,0,140,0,20,2,99,2,99,0,21,0,2,0,50,0,22,0,28,0,28,
+0,28,0,28,0,28,0,28,0,28,0,28,0,28,0,28,0,28,0,28,0,28,0,28,0,28,0,28,0,28,
+0,28,0,28,0,28,0,28,0,28,0,2,0,7,0,106,0,109,0,0,0,112,0,123,0,4,0,132,0,
+132,0,16,0,135,0,135,0,17,0,137,0,138,0,18,0,140,0,140,0,20,2,99,2,99,0,21,
+0,3,0,0,0,2,0,22,0,28,0,0,0,2,0,0,0,4,0,1,0,5,0,1,0,1,0,36,0,2,0,7,0,106,
+0,109,0,0,0,112,0,123,0,4,0,132,0,132,0,16,0,135,0,135,0,17,0,137,0,138,0,
+18,0,140,0,140,0,20,2,99,2,99,0,21,0,3,0,0,0,2,0,22,0,28,0,0,0,2,0,0,0,4,
+0,1,0,6,0,1,0,1,0,27,0,2,0,7,0,106,0,109,0,0,0,112,0,123,0,4,0,132,0,132,
+0,16,0,135,0,135,0,17,0,137,0,138,0,18,0,140,0,140,0,20,2,99,2,99,0,21,0,
+3,0,0,0,2,0,22,0,28,0,0,0,2,0,0,0,4,0,1,0,7,0,1,0,1,0,28,0,2,0,7,0,106,0,
+109,0,0,0,112,0,123,0,4,0,132,0,132,0,16,0,135,0,135,0,17,0,137,0,138,0,18,
+0,140,0,140,0,20,2,99,2,99,0,21,0,3,0,1,0,34,0,1,0,18,0,0,0,1,0,0,0,38,0,
+2,0,2,0,25,0,26,0,0,0,105,0,140,0,2,0,2,0,4,0,27,0,28,0,0,0,36,0,36,0,2,0,
+105,0,140,0,3,2,63,2,99,0,39,0,1,0,8,0,1,0,14,0,1,0,1,0,120,0,1,0,4,2,99,
+0,2,2,89,0,1,0,8,0,1,0,14,0,1,0,1,0,37,0,1,0,4,0,72,0,2,0,135,0,3,0,1,0,18,
+0,1,0,34,0,0,0,1,0,0,0,39,0,1,0,6,0,37,0,39,0,48,0,63,0,66,0,71,0,1,0,1,0,
+131,0,3,0,2,0,20,0,42,0,1,0,58,0,0,0,1,0,0,0,39,0,2,0,3,0,20,0,24,0,0,0,29,
+0,30,0,5,0,32,0,34,0,7,0,1,0,6,0,37,0,39,0,48,0,63,0,66,0,71,0,1,0,1,0,131,
+0,3,0,1,0,18,0,1,0,26,0,0,0,1,0,0,0,40,0,1,0,2,0,46,0,64,0,1,0,1,0,131,0,
+3,0,2,0,20,0,42,0,1,0,50,0,0,0,1,0,0,0,40,0,2,0,3,0,20,0,24,0,0,0,29,0,30,
+0,5,0,32,0,34,0,7,0,1,0,2,0,46,0,64,0,1,0,1,0,131,0,3,0,1,0,18,0,1,0,28,0,
+0,0,1,0,0,0,41,0,1,0,3,0,40,0,61,0,69,0,1,0,1,0,131,0,3,0,2,0,20,0,42,0,1,
+0,52,0,0,0,1,0,0,0,41,0,2,0,3,0,20,0,24,0,0,0,29,0,30,0,5,0,32,0,34,0,7,0,
+1,0,3,0,40,0,61,0,69,0,1,0,1,0,131,0,3,0,1,0,18,0,1,0,26,0,0,0,1,0,0,0,42,
+0,1,0,2,0,45,0,62,0,1,0,1,0,131,0,3,0,2,0,20,0,42,0,1,0,50,0,0,0,1,0,0,0,
+42,0,2,0,3,0,20,0,24,0,0,0,29,0,30,0,5,0,32,0,34,0,7,0,1,0,2,0,45,0,62,0,
+1,0,1,0,131,0,1,0,76,0,35,0,86,0,132,0,156,0,180,0,204,0,228,0,252,1,20,1,
+44,1,68,1,92,1,116,1,140,1,164,1,188,1,212,1,236,2,4,2,28,2,52,2,76,2,100,
+2,124,2,148,2,172,2,196,2,220,2,244,3,12,3,36,3,60,3,84,3,108,3,132,3,156,
+0,2,0,1,0,37,0,71,0,0,0,22,3,94,3,102,3,108,3,116,3,122,3,130,3,136,3,144,
+3,150,3,158,3,164,3,172,3,182,3,190,3,196,3,204,3,210,3,218,3,224,3,232,3,
+238,3,246,0,11,3,206,3,212,3,218,3,224,3,230,3,236,3,244,3,250,4,0,4,6,4,
+12,0,11,3,250,4,0,4,6,4,12,4,18,4,24,4,32,4,38,4,44,4,50,4,56,0,11,4,38,4,
+44,4,50,4,56,4,62,4,68,4,76,4,82,4,88,4,94,4,100,0,11,4,82,4,88,4,94,4,100,
+4,106,4,112,4,120,4,126,4,132,4,138,4,144,0,11,4,126,4,132,4,138,4,144,4,
+150,4,156,4,164,4,170,4,176,4,182,4,188,0,11,4,170,4,176,4,182,4,188,4,194,
+4,200,4,208,4,214,4,220,4,226,4,232,0,11,4,214,4,220,4,226,4,232,4,238,4,
+244,4,252,5,2,5,8,5,14,5,20,0,11,5,2,5,8,5,14,5,20,5,26,5,32,5,40,5,46,5,
+52,5,58,5,64,0,11,5,46,5,52,5,58,5,64,5,70,5,76,5,84,5,90,5,96,5,102,5,108,
+0,11,5,90,5,96,5,102,5,108,5,114,5,120,5,128,5,134,5,140,5,146,5,152,0,11,
+5,134,5,140,5,146,5,152,5,158,5,164,5,172,5,178,5,184,5,190,5,196,0,11,5,
+178,5,184,5,190,5,196,5,202,5,208,5,216,5,222,5,228,5,234,5,240,0,11,5,222,
+5,228,5,234,5,240,5,246,5,252,6,4,6,10,6,16,6,22,6,28,0,11,6,10,6,16,6,22,
+6,28,6,34,6,40,6,48,6,54,6,60,6,66,6,72,0,11,6,54,6,60,6,66,6,72,6,78,6,84,
+6,92,6,98,6,104,6,110,6,116,0,11,6,98,6,104,6,110,6,116,6,122,6,128,6,136,
+6,142,6,148,6,154,6,160,0,11,6,142,6,148,6,154,6,160,6,166,6,172,6,180,6,
+186,6,192,6,198,6,204,0,11,6,186,6,192,6,198,6,204,6,210,6,216,6,224,6,230,
+6,236,6,242,6,248,0,11,6,230,6,236,6,242,6,248,6,254,7,4,7,12,7,18,7,24,7,
+30,7,36,0,11,7,18,7,24,7,30,7,36,7,42,7,48,7,56,7,62,7,68,7,74,7,80,0,11,
+7,62,7,68,7,74,7,80,7,86,7,92,7,100,7,106,7,112,7,118,7,124,0,11,7,106,7,
+112,7,118,7,124,7,130,7,136,7,144,7,150,7,156,7,162,7,168,0,11,7,150,7,156,
+7,162,7,168,7,174,7,180,7,188,7,194,7,200,7,206,7,212,0,11,7,194,7,200,7,
+206,7,212,7,218,7,224,7,232,7,238,7,244,7,250,8,0,0,11,7,238,7,244,7,250,
+8,0,8,6,8,12,8,20,8,26,8,32,8,38,8,44,0,11,8,26,8,32,8,38,8,44,8,50,8,56,
+8,64,8,70,8,76,8,82,8,88,0,11,8,70,8,76,8,82,8,88,8,94,8,100,8,108,8,114,
+8,120,8,126,8,132,0,11,8,114,8,120,8,126,8,132,8,138,8,144,8,152,8,158,8,
+164,8,170,8,176,0,11,8,158,8,164,8,170,8,176,8,182,8,188,8,196,8,202,8,208,
+8,214,8,220,0,11,8,202,8,208,8,214,8,220,8,226,8,232,8,240,8,246,8,252,9,
+2,9,8,0,11,8,246,8,252,9,2,9,8,9,14,9,20,9,28,9,34,9,40,9,46,9,52,0,11,9,
+34,9,40,9,46,9,52,9,58,9,64,9,72,9,78,9,84,9,90,9,96,0,11,9,78,9,84,9,90,
+9,96,9,102,9,108,9,116,9,122,9,128,9,134,9,140,0,11,9,122,9,128,9,134,9,140,
+9,146,9,152,9,160,9,166,9,172,9,178,9,184,0,212,0,3,0,20,0,135,0,177,0,2,
+0,20,0,248,0,3,0,21,0,135,0,213,0,2,0,21,1,28,0,3,0,22,0,135,0,249,0,2,0,
+22,1,64,0,3,0,23,0,135,1,29,0,2,0,23,1,100,0,3,0,24,0,135,1,65,0,2,0,24,1,
+173,0,3,0,29,0,36,1,208,0,4,0,29,0,135,0,36,1,136,0,3,0,29,0,135,1,101,0,
+2,0,29,1,172,0,3,0,30,0,135,1,137,0,2,0,30,1,244,0,3,0,32,0,135,1,209,0,2,
+0,32,2,24,0,3,0,33,0,135,1,245,0,2,0,33,2,60,0,3,0,34,0,135,2,25,0,2,0,34,
+0,178,0,2,0,20,0,214,0,2,0,21,0,250,0,2,0,22,1,30,0,2,0,23,1,66,0,2,0,24,
+1,174,0,3,0,29,0,36,1,102,0,2,0,29,1,138,0,2,0,30,1,210,0,2,0,32,1,246,0,
+2,0,33,2,26,0,2,0,34,0,179,0,2,0,20,0,215,0,2,0,21,0,251,0,2,0,22,1,31,0,
+2,0,23,1,67,0,2,0,24,1,175,0,3,0,29,0,36,1,103,0,2,0,29,1,139,0,2,0,30,1,
+211,0,2,0,32,1,247,0,2,0,33,2,27,0,2,0,34,0,180,0,2,0,20,0,216,0,2,0,21,0,
+252,0,2,0,22,1,32,0,2,0,23,1,68,0,2,0,24,1,176,0,3,0,29,0,36,1,104,0,2,0,
+29,1,140,0,2,0,30,1,212,0,2,0,32,1,248,0,2,0,33,2,28,0,2,0,34,0,181,0,2,0,
+20,0,217,0,2,0,21,0,253,0,2,0,22,1,33,0,2,0,23,1,69,0,2,0,24,1,177,0,3,0,
+29,0,36,1,105,0,2,0,29,1,141,0,2,0,30,1,213,0,2,0,32,1,249,0,2,0,33,2,29,
+0,2,0,34,0,182,0,2,0,20,0,218,0,2,0,21,0,254,0,2,0,22,1,34,0,2,0,23,1,70,
+0,2,0,24,1,178,0,3,0,29,0,36,1,106,0,2,0,29,1,142,0,2,0,30,1,214,0,2,0,32,
+1,250,0,2,0,33,2,30,0,2,0,34,0,183,0,2,0,20,0,219,0,2,0,21,0,255,0,2,0,22,
+1,35,0,2,0,23,1,71,0,2,0,24,1,179,0,3,0,29,0,36,1,107,0,2,0,29,1,143,0,2,
+0,30,1,215,0,2,0,32,1,251,0,2,0,33,2,31,0,2,0,34,0,184,0,2,0,20,0,220,0,2,
+0,21,1,0,0,2,0,22,1,36,0,2,0,23,1,72,0,2,0,24,1,180,0,3,0,29,0,36,1,108,0,
+2,0,29,1,144,0,2,0,30,1,216,0,2,0,32,1,252,0,2,0,33,2,32,0,2,0,34,0,185,0,
+2,0,20,0,221,0,2,0,21,1,1,0,2,0,22,1,37,0,2,0,23,1,73,0,2,0,24,1,181,0,3,
+0,29,0,36,1,109,0,2,0,29,1,145,0,2,0,30,1,217,0,2,0,32,1,253,0,2,0,33,2,33,
+0,2,0,34,0,186,0,2,0,20,0,222,0,2,0,21,1,2,0,2,0,22,1,38,0,2,0,23,1,74,0,
+2,0,24,1,182,0,3,0,29,0,36,1,110,0,2,0,29,1,146,0,2,0,30,1,218,0,2,0,32,1,
+254,0,2,0,33,2,34,0,2,0,34,0,187,0,2,0,20,0,223,0,2,0,21,1,3,0,2,0,22,1,39,
+0,2,0,23,1,75,0,2,0,24,1,183,0,3,0,29,0,36,1,111,0,2,0,29,1,147,0,2,0,30,
+1,219,0,2,0,32,1,255,0,2,0,33,2,35,0,2,0,34,0,188,0,2,0,20,0,224,0,2,0,21,
+1,4,0,2,0,22,1,40,0,2,0,23,1,76,0,2,0,24,1,184,0,3,0,29,0,36,1,112,0,2,0,
+29,1,148,0,2,0,30,1,220,0,2,0,32,2,0,0,2,0,33,2,36,0,2,0,34,0,189,0,2,0,20,
+0,225,0,2,0,21,1,5,0,2,0,22,1,41,0,2,0,23,1,77,0,2,0,24,1,185,0,3,0,29,0,
+36,1,113,0,2,0,29,1,149,0,2,0,30,1,221,0,2,0,32,2,1,0,2,0,33,2,37,0,2,0,34,
+0,190,0,2,0,20,0,226,0,2,0,21,1,6,0,2,0,22,1,42,0,2,0,23,1,78,0,2,0,24,1,
+186,0,3,0,29,0,36,1,114,0,2,0,29,1,150,0,2,0,30,1,222,0,2,0,32,2,2,0,2,0,
+33,2,38,0,2,0,34,0,191,0,2,0,20,0,227,0,2,0,21,1,7,0,2,0,22,1,43,0,2,0,23,
+1,79,0,2,0,24,1,187,0,3,0,29,0,36,1,115,0,2,0,29,1,151,0,2,0,30,1,223,0,2,
+0,32,2,3,0,2,0,33,2,39,0,2,0,34,0,192,0,2,0,20,0,228,0,2,0,21,1,8,0,2,0,22,
+1,44,0,2,0,23,1,80,0,2,0,24,1,188,0,3,0,29,0,36,1,116,0,2,0,29,1,152,0,2,
+0,30,1,224,0,2,0,32,2,4,0,2,0,33,2,40,0,2,0,34,0,193,0,2,0,20,0,229,0,2,0,
+21,1,9,0,2,0,22,1,45,0,2,0,23,1,81,0,2,0,24,1,189,0,3,0,29,0,36,1,117,0,2,
+0,29,1,153,0,2,0,30,1,225,0,2,0,32,2,5,0,2,0,33,2,41,0,2,0,34,0,194,0,2,0,
+20,0,230,0,2,0,21,1,10,0,2,0,22,1,46,0,2,0,23,1,82,0,2,0,24,1,190,0,3,0,29,
+0,36,1,118,0,2,0,29,1,154,0,2,0,30,1,226,0,2,0,32,2,6,0,2,0,33,2,42,0,2,0,
+34,0,195,0,2,0,20,0,231,0,2,0,21,1,11,0,2,0,22,1,47,0,2,0,23,1,83,0,2,0,24,
+1,191,0,3,0,29,0,36,1,119,0,2,0,29,1,155,0,2,0,30,1,227,0,2,0,32,2,7,0,2,
+0,33,2,43,0,2,0,34,0,196,0,2,0,20,0,232,0,2,0,21,1,12,0,2,0,22,1,48,0,2,0,
+23,1,84,0,2,0,24,1,192,0,3,0,29,0,36,1,120,0,2,0,29,1,156,0,2,0,30,1,228,
+0,2,0,32,2,8,0,2,0,33,2,44,0,2,0,34,0,197,0,2,0,20,0,233,0,2,0,21,1,13,0,
+2,0,22,1,49,0,2,0,23,1,85,0,2,0,24,1,193,0,3,0,29,0,36,1,121,0,2,0,29,1,157,
+0,2,0,30,1,229,0,2,0,32,2,9,0,2,0,33,2,45,0,2,0,34,0,198,0,2,0,20,0,234,0,
+2,0,21,1,14,0,2,0,22,1,50,0,2,0,23,1,86,0,2,0,24,1,194,0,3,0,29,0,36,1,122,
+0,2,0,29,1,158,0,2,0,30,1,230,0,2,0,32,2,10,0,2,0,33,2,46,0,2,0,34,0,199,
+0,2,0,20,0,235,0,2,0,21,1,15,0,2,0,22,1,51,0,2,0,23,1,87,0,2,0,24,1,195,0,
+3,0,29,0,36,1,123,0,2,0,29,1,159,0,2,0,30,1,231,0,2,0,32,2,11,0,2,0,33,2,
+47,0,2,0,34,0,200,0,2,0,20,0,236,0,2,0,21,1,16,0,2,0,22,1,52,0,2,0,23,1,88,
+0,2,0,24,1,196,0,3,0,29,0,36,1,124,0,2,0,29,1,160,0,2,0,30,1,232,0,2,0,32,
+2,12,0,2,0,33,2,48,0,2,0,34,0,201,0,2,0,20,0,237,0,2,0,21,1,17,0,2,0,22,1,
+53,0,2,0,23,1,89,0,2,0,24,1,197,0,3,0,29,0,36,1,125,0,2,0,29,1,161,0,2,0,
+30,1,233,0,2,0,32,2,13,0,2,0,33,2,49,0,2,0,34,0,202,0,2,0,20,0,238,0,2,0,
+21,1,18,0,2,0,22,1,54,0,2,0,23,1,90,0,2,0,24,1,198,0,3,0,29,0,36,1,126,0,
+2,0,29,1,162,0,2,0,30,1,234,0,2,0,32,2,14,0,2,0,33,2,50,0,2,0,34,0,203,0,
+2,0,20,0,239,0,2,0,21,1,19,0,2,0,22,1,55,0,2,0,23,1,91,0,2,0,24,1,199,0,3,
+0,29,0,36,1,127,0,2,0,29,1,163,0,2,0,30,1,235,0,2,0,32,2,15,0,2,0,33,2,51,
+0,2,0,34,0,204,0,2,0,20,0,240,0,2,0,21,1,20,0,2,0,22,1,56,0,2,0,23,1,92,0,
+2,0,24,1,200,0,3,0,29,0,36,1,128,0,2,0,29,1,164,0,2,0,30,1,236,0,2,0,32,2,
+16,0,2,0,33,2,52,0,2,0,34,0,205,0,2,0,20,0,241,0,2,0,21,1,21,0,2,0,22,1,57,
+0,2,0,23,1,93,0,2,0,24,1,201,0,3,0,29,0,36,1,129,0,2,0,29,1,165,0,2,0,30,
+1,237,0,2,0,32,2,17,0,2,0,33,2,53,0,2,0,34,0,206,0,2,0,20,0,242,0,2,0,21,
+1,22,0,2,0,22,1,58,0,2,0,23,1,94,0,2,0,24,1,202,0,3,0,29,0,36,1,130,0,2,0,
+29,1,166,0,2,0,30,1,238,0,2,0,32,2,18,0,2,0,33,2,54,0,2,0,34,0,207,0,2,0,
+20,0,243,0,2,0,21,1,23,0,2,0,22,1,59,0,2,0,23,1,95,0,2,0,24,1,203,0,3,0,29,
+0,36,1,131,0,2,0,29,1,167,0,2,0,30,1,239,0,2,0,32,2,19,0,2,0,33,2,55,0,2,
+0,34,0,208,0,2,0,20,0,244,0,2,0,21,1,24,0,2,0,22,1,60,0,2,0,23,1,96,0,2,0,
+24,1,204,0,3,0,29,0,36,1,132,0,2,0,29,1,168,0,2,0,30,1,240,0,2,0,32,2,20,
+0,2,0,33,2,56,0,2,0,34,0,209,0,2,0,20,0,245,0,2,0,21,1,25,0,2,0,22,1,61,0,
+2,0,23,1,97,0,2,0,24,1,205,0,3,0,29,0,36,1,133,0,2,0,29,1,169,0,2,0,30,1,
+241,0,2,0,32,2,21,0,2,0,33,2,57,0,2,0,34,0,210,0,2,0,20,0,246,0,2,0,21,1,
+26,0,2,0,22,1,62,0,2,0,23,1,98,0,2,0,24,1,206,0,3,0,29,0,36,1,134,0,2,0,29,
+1,170,0,2,0,30,1,242,0,2,0,32,2,22,0,2,0,33,2,58,0,2,0,34,0,211,0,2,0,20,
+0,247,0,2,0,21,1,27,0,2,0,22,1,63,0,2,0,23,1,99,0,2,0,24,1,207,0,3,0,29,0,
+36,1,135,0,2,0,29,1,171,0,2,0,30,1,243,0,2,0,32,2,23,0,2,0,33,2,59,0,2,0,
+34,0,3,0,1,0,34,0,1,0,18,0,0,0,1,0,0,0,43,0,2,0,2,0,131,0,131,0,0,2,100,2,
+109,0,1,0,1,0,12,1,29,1,31,1,40,1,55,1,58,1,63,1,65,1,67,1,76,1,91,1,94,1,
+99,0,3,0,1,0,34,0,1,0,18,0,0,0,1,0,0,0,44,0,2,0,2,0,131,0,131,0,0,2,100,2,
+109,0,1,0,1,0,2,1,56,1,92,0,3,0,1,0,34,0,1,0,18,0,0,0,1,0,0,0,45,0,2,0,2,
+0,131,0,131,0,0,2,100,2,109,0,1,0,1,0,2,1,38,1,74,0,3,0,1,0,34,0,1,0,18,0,
+0,0,1,0,0,0,46,0,2,0,2,0,131,0,131,0,0,2,100,2,109,0,1,0,1,0,36,1,30,1,33,
+1,34,1,35,1,39,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,51,1,52,1,59,1,60,
+1,62,1,66,1,69,1,70,1,71,1,75,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,87,
+1,88,1,95,1,96,1,98,0,3,0,1,0,34,0,1,0,18,0,0,0,1,0,0,0,47,0,2,0,2,0,131,
+0,131,0,0,2,100,2,109,0,1,0,1,0,6,1,49,1,50,1,57,1,85,1,86,1,93,0,3,0,1,0,
+34,0,1,0,18,0,0,0,1,0,0,0,48,0,2,0,2,0,131,0,131,0,0,2,100,2,109,0,1,0,1,
+0,8,1,32,1,53,1,61,1,68,1,89,1,97,1,212,1,233,0,3,0,1,0,34,0,1,0,18,0,0,0,
+1,0,0,0,49,0,2,0,2,0,131,0,131,0,0,2,100,2,109,0,1,0,1,0,6,1,37,1,54,1,73,
+1,90,1,217,1,234,0,1,0,78,0,36,0,88,0,92,0,96,0,100,0,104,0,108,0,112,0,116,
+0,120,0,124,0,128,0,132,0,136,0,140,0,144,0,148,0,152,0,156,0,160,0,164,0,
+168,0,172,0,176,0,180,0,184,0,188,0,192,0,196,0,200,0,204,0,208,0,212,0,216,
+0,220,0,224,0,228,0,2,0,1,0,37,0,72,0,0,0,1,0,144,0,1,0,146,0,1,0,148,0,1,
+0,150,0,1,0,152,0,1,0,154,0,1,0,156,0,1,0,158,0,1,0,160,0,1,0,162,0,1,0,164,
+0,1,0,166,0,1,0,168,0,1,0,170,0,1,0,172,0,1,0,174,0,1,0,176,0,1,0,178,0,1,
+0,180,0,1,0,182,0,1,0,184,0,1,0,186,0,1,0,188,0,1,0,190,0,1,0,192,0,1,0,194,
+0,1,0,196,0,1,0,198,0,1,0,200,0,1,0,202,0,1,0,204,0,1,0,206,0,1,0,208,0,1,
+0,210,0,1,0,212,0,1,0,214,0,141,0,2,0,78,0,142,0,2,0,78,0,143,0,2,0,78,0,
+144,0,2,0,78,0,145,0,2,0,78,0,146,0,2,0,78,0,147,0,2,0,78,0,148,0,2,0,78,
+0,149,0,2,0,78,0,150,0,2,0,78,0,151,0,2,0,78,0,152,0,2,0,78,0,153,0,2,0,78,
+0,154,0,2,0,78,0,155,0,2,0,78,0,156,0,2,0,78,0,157,0,2,0,78,0,158,0,2,0,78,
+0,159,0,2,0,78,0,160,0,2,0,78,0,161,0,2,0,78,0,162,0,2,0,78,0,163,0,2,0,78,
+0,164,0,2,0,78,0,165,0,2,0,78,0,166,0,2,0,78,0,167,0,2,0,78,0,168,0,2,0,78,
+0,169,0,2,0,78,0,170,0,2,0,78,0,171,0,2,0,78,0,172,0,2,0,78,0,173,0,2,0,78,
+0,174,0,2,0,78,0,175,0,2,0,78,0,176,0,2,0,78,0,1,0,8,0,1,0,14,0,1,0,1,0,120,
+0,1,0,4,2,99,0,2,0,131,0,2,0,12,0,3,0,106,0,106,0,106,0,1,0,3,0,27,0,28,0,
+36,0,2,0,12,0,3,0,107,0,107,0,107,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,108,
+0,108,0,108,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,109,0,109,0,109,0,1,0,3,
+0,27,0,28,0,36,0,2,0,12,0,3,0,112,0,112,0,112,0,1,0,3,0,27,0,28,0,36,0,2,
+0,12,0,3,0,113,0,113,0,113,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,114,0,114,
+0,114,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,115,0,115,0,115,0,1,0,3,0,27,
+0,28,0,36,0,2,0,12,0,3,0,116,0,116,0,116,0,1,0,3,0,27,0,28,0,36,0,2,0,12,
+0,3,0,117,0,117,0,117,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,118,0,118,0,118,
+0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,119,0,119,0,119,0,1,0,3,0,27,0,28,0,
+36,0,2,0,12,0,3,0,120,0,120,0,120,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,121,
+0,121,0,121,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,122,0,122,0,122,0,1,0,3,
+0,27,0,28,0,36,0,2,0,12,0,3,0,123,0,123,0,123,0,1,0,3,0,27,0,28,0,36,0,2,
+0,12,0,3,0,132,0,132,0,132,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,135,0,135,
+0,135,0,1,0,3,0,27,0,28,0,36,0,2,0,12,0,3,0,137,0,137,0,137,0,1,0,3,0,27,
+0,28,0,36,0,2,0,12,0,3,0,138,0,138,0,138,0,1,0,3,0,27,0,28,0,36,0,2,0,12,
+0,3,0,140,0,140,0,140,0,1,0,3,0,27,0,28,0,36,0,2,0,88,0,41,2,61,2,62,2,99,
+2,99,2,99,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,
+2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,
+2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,0,2,0,3,0,25,0,28,0,0,0,36,0,36,0,
+4,0,105,0,140,0,5,0,1,0,6,1,225,0,1,0,1,0,131,0,1,0,6,1,226,0,1,0,1,0,131,
+0,1,0,6,1,229,0,1,0,1,0,131,0,1,0,6,1,231,0,1,0,1,0,131,0,2,0,26,0,10,2,103,
+2,103,2,103,2,103,2,103,2,103,2,103,2,103,2,103,2,103,0,2,0,3,0,131,0,131,
+0,0,2,100,2,102,0,1,2,104,2,109,0,4,0,2,0,26,0,10,2,104,2,104,2,104,2,104,
+2,104,2,104,2,104,2,104,2,104,2,104,0,2,0,3,0,131,0,131,0,0,2,100,2,103,0,
+1,2,105,2,109,0,5,0,2,0,26,0,10,2,106,2,106,2,106,2,106,2,106,2,106,2,106,
+2,106,2,106,2,106,0,2,0,3,0,131,0,131,0,0,2,100,2,105,0,1,2,107,2,109,0,7,
+0,2,0,26,0,10,2,105,2,105,2,105,2,105,2,105,2,105,2,105,2,105,2,105,2,105,
+0,2,0,3,0,131,0,131,0,0,2,100,2,104,0,1,2,106,2,109,0,6,0,2,0,26,0,10,2,103,
+2,103,2,103,2,103,2,103,2,103,2,103,2,103,2,103,2,103,0,2,0,3,0,131,0,131,
+0,0,2,100,2,102,0,1,2,104,2,109,0,4,0,2,0,26,0,10,2,107,2,107,2,107,2,107,
+2,107,2,107,2,107,2,107,2,107,2,107,0,2,0,3,0,131,0,131,0,0,2,100,2,106,0,
+1,2,108,2,109,0,8,0,2,0,26,0,10,2,109,2,109,2,109,2,109,2,109,2,109,2,109,
+2,109,2,109,2,109,0,2,0,2,0,131,0,131,0,0,2,100,2,108,0,1,0,0,};
+#endif
@@ -0,0 +1,848 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_NotoSerifThai_Regular_ttf_size = 20564;
+asm(".section .rodata");
+asm(".global fz_font_NotoSerifThai_Regular_ttf");
+asm(".type fz_font_NotoSerifThai_Regular_ttf STT_OBJECT");
+asm(".size fz_font_NotoSerifThai_Regular_ttf, 20564");
+asm(".balign 64");
+asm("fz_font_NotoSerifThai_Regular_ttf:");
+asm(".incbin \"resources/fonts/noto/NotoSerifThai-Regular.ttf\"");
+#else
+const int fz_font_NotoSerifThai_Regular_ttf_size = 20564;
+const char fz_font_NotoSerifThai_Regular_ttf[] = {
+0,1,0,0,0,14,0,128,0,3,0,96,71,68,69,70,4,235,5,46,0,0,73,68,0,0,0,124,71,
+80,79,83,149,233,113,133,0,0,73,192,0,0,4,148,71,83,85,66,239,27,216,121,
+0,0,78,84,0,0,2,0,79,83,47,50,129,48,108,41,0,0,1,104,0,0,0,96,99,109,97,
+112,121,241,82,153,0,0,3,116,0,0,0,178,103,97,115,112,0,25,0,35,0,0,73,52,
+0,0,0,16,103,108,121,102,45,82,197,201,0,0,5,4,0,0,57,198,104,101,97,100,
+251,250,89,195,0,0,0,236,0,0,0,54,104,104,101,97,10,171,4,167,0,0,1,36,0,
+0,0,36,104,109,116,120,122,138,211,97,0,0,1,200,0,0,1,172,108,111,99,97,93,
+150,79,12,0,0,4,40,0,0,0,218,109,97,120,112,0,125,0,132,0,0,1,72,0,0,0,32,
+110,97,109,101,139,38,184,16,0,0,62,204,0,0,5,250,112,111,115,116,232,233,
+140,41,0,0,68,200,0,0,4,107,0,1,0,0,0,1,10,61,92,166,12,31,95,15,60,245,0,
+11,8,0,0,0,0,0,200,248,55,150,0,0,0,0,210,40,204,16,250,131,253,244,7,55,
+8,238,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,8,238,253,244,0,0,7,115,250,131,254,
+213,7,55,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,1,0,0,0,108,0,131,0,16,0,
+0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,214,1,144,0,5,0,0,5,154,5,
+51,0,0,1,31,5,154,5,51,0,0,3,209,0,102,2,237,2,0,2,2,5,0,6,5,0,2,2,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,79,79,71,0,64,0,0,254,255,8,238,253,244,0,
+0,8,238,2,12,0,0,0,1,0,0,0,0,6,64,8,238,0,0,0,32,0,2,4,0,0,102,0,0,0,0,4,
+20,0,0,2,20,0,0,4,199,0,133,5,12,0,59,5,12,0,59,4,254,0,113,4,254,0,113,5,
+12,0,59,3,201,0,49,4,164,0,94,5,43,0,86,5,12,0,59,5,72,0,59,6,184,0,133,6,
+166,0,133,6,166,0,133,5,35,0,45,5,35,0,45,4,129,0,84,4,129,0,121,5,229,0,
+59,6,221,0,113,7,115,0,133,4,254,0,113,4,254,0,113,4,199,0,133,5,33,0,45,
+4,139,0,139,5,20,0,45,4,236,0,45,4,236,0,45,5,43,0,184,5,43,0,184,5,145,0,
+45,5,145,0,45,5,35,0,45,4,182,0,86,4,111,0,133,4,10,0,70,4,199,0,133,4,188,
+0,119,5,61,0,45,3,219,255,252,4,254,0,113,4,236,0,45,4,188,0,119,5,31,0,45,
+5,145,0,45,4,201,0,131,4,201,0,160,4,72,0,45,3,233,0,80,0,0,253,117,3,219,
+255,252,3,219,254,51,0,0,251,229,0,0,251,229,0,0,251,229,0,0,251,229,0,0,
+254,70,0,0,253,20,0,0,254,137,4,121,0,16,2,117,0,184,4,141,0,184,3,102,0,
+0,3,98,0,0,3,229,255,227,3,219,255,252,3,246,0,59,0,0,252,164,0,0,254,158,
+0,0,253,35,0,0,252,135,0,0,254,53,0,0,252,190,0,0,254,51,0,0,254,16,5,39,
+0,76,5,80,0,131,5,80,0,131,5,80,0,90,5,80,0,127,5,80,0,127,5,80,0,127,5,80,
+0,100,5,80,0,76,5,80,0,127,5,80,0,127,5,188,0,45,7,84,0,88,0,0,254,158,0,
+0,253,66,0,0,252,139,0,0,254,55,0,0,252,213,0,0,0,0,4,193,0,102,0,0,0,0,0,
+0,255,202,0,0,254,213,2,0,0,61,2,14,0,25,0,0,252,39,252,67,250,131,0,0,0,
+1,0,3,0,1,0,0,0,12,0,4,0,166,0,0,0,36,0,32,0,4,0,4,0,0,0,13,0,32,0,160,2,
+188,2,215,3,3,3,49,14,13,14,16,14,58,14,71,14,76,14,91,32,13,37,204,254,255,
+255,255,0,0,0,0,0,13,0,32,0,160,2,188,2,215,3,3,3,49,14,1,14,14,14,17,14,
+63,14,72,14,77,32,11,37,204,254,255,255,255,0,1,255,245,255,227,255,99,253,
+171,253,145,253,102,253,57,242,3,242,4,242,5,242,1,242,21,242,1,0,0,218,151,
+1,101,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,
+0,0,0,0,0,98,0,101,0,102,0,0,0,0,0,20,0,20,0,20,0,20,0,68,0,151,0,240,1,61,
+1,145,2,1,2,71,2,146,2,237,3,83,3,191,4,49,4,178,5,9,5,126,6,3,6,183,7,22,
+7,120,7,245,8,101,8,185,9,20,9,96,9,161,9,225,10,48,10,105,10,162,10,239,
+11,60,11,120,11,180,12,0,12,78,12,154,12,230,13,50,13,122,13,198,13,253,14,
+95,14,196,15,33,15,124,15,221,16,37,16,139,16,193,17,28,17,76,17,104,17,164,
+17,198,17,237,18,43,18,88,18,120,18,157,18,179,19,7,19,50,19,129,19,207,20,
+47,20,119,20,147,20,210,21,43,21,57,21,116,21,188,21,209,22,5,22,43,22,92,
+22,162,22,204,23,31,23,125,23,204,24,44,24,168,24,248,25,93,25,194,26,28,
+26,90,26,185,26,199,27,2,27,74,27,95,27,147,27,147,28,58,28,58,28,71,28,101,
+28,139,28,153,28,201,28,214,28,227,0,0,0,2,0,102,0,0,3,154,5,182,0,3,0,7,
+0,0,51,17,33,17,37,33,17,33,102,3,52,253,47,2,110,253,146,5,182,250,74,98,
+4,242,0,1,0,133,0,0,4,35,4,123,0,30,0,0,51,17,52,55,38,38,35,54,54,51,50,
+22,21,17,7,35,17,52,38,35,34,6,7,22,22,23,21,6,6,21,17,166,221,38,166,50,
+14,236,227,230,219,101,67,146,151,130,151,8,68,138,40,116,101,1,137,229,48,
+33,47,205,192,213,238,253,191,119,2,203,186,156,134,126,10,78,47,17,23,125,
+106,254,121,0,0,2,0,59,0,0,4,104,4,123,0,46,0,58,0,0,37,51,17,52,54,55,38,
+38,35,34,6,7,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,22,23,14,2,21,
+17,51,50,54,53,17,55,51,17,20,6,35,33,19,52,38,35,34,6,21,20,22,51,50,54,
+1,63,162,79,83,8,127,100,112,117,11,19,77,37,73,89,97,85,109,113,200,175,
+152,193,12,55,61,26,68,118,126,100,67,182,164,254,49,50,50,40,39,50,50,39,
+40,50,86,1,152,130,154,53,102,124,92,78,23,30,90,80,77,93,125,113,142,167,
+172,146,43,85,99,102,254,98,161,142,2,107,118,252,252,169,185,3,2,38,48,48,
+38,40,48,48,0,2,0,59,0,0,4,104,4,117,0,49,0,61,0,0,1,6,7,54,54,51,50,22,21,
+20,6,35,34,38,53,52,54,55,23,55,22,22,23,14,2,21,17,51,50,54,53,17,55,51,
+17,20,6,35,33,53,51,17,52,54,55,38,38,39,7,7,52,38,35,34,6,21,20,22,51,50,
+54,1,33,100,21,19,77,37,73,89,97,85,109,113,131,109,135,135,96,117,9,55,61,
+26,68,118,126,100,67,182,164,254,49,162,79,83,4,46,32,127,65,50,40,39,50,
+50,39,40,50,4,14,45,147,23,30,90,80,77,93,125,111,123,191,32,123,123,33,169,
+110,43,85,99,102,254,98,161,142,2,107,118,252,252,169,185,86,1,152,130,154,
+53,58,104,27,111,180,38,48,48,38,40,48,48,0,2,0,113,0,0,4,90,4,123,0,41,0,
+53,0,0,1,6,6,7,21,35,53,52,39,38,38,53,52,36,51,50,22,21,17,7,35,17,16,33,
+34,6,21,20,22,23,23,62,2,51,50,22,21,20,6,35,34,55,20,22,51,50,54,53,52,38,
+35,34,6,1,195,38,46,2,168,42,25,17,1,12,237,248,248,100,68,254,184,167,193,
+22,32,24,36,70,99,67,97,106,106,97,109,5,54,48,48,57,57,48,48,54,1,211,41,
+180,119,127,139,190,151,89,104,56,194,224,224,227,253,191,119,2,201,1,86,
+161,136,54,106,98,90,146,135,69,101,90,91,99,188,48,54,54,48,48,57,57,0,2,
+0,113,0,0,4,90,4,119,0,45,0,57,0,0,1,6,6,21,20,22,23,23,62,2,51,50,22,21,
+20,6,35,34,39,6,6,7,21,35,53,52,39,38,38,53,52,54,55,23,55,22,22,21,17,7,
+35,17,52,39,7,3,20,22,51,50,54,53,52,38,35,34,6,1,184,89,93,22,32,24,36,70,
+99,67,97,106,106,97,109,48,38,46,2,168,42,25,17,173,156,176,177,156,163,100,
+68,151,177,114,54,48,48,57,57,48,48,54,4,8,34,144,96,54,106,98,90,146,135,
+69,101,90,91,99,88,41,180,119,127,139,190,151,89,104,56,159,220,35,156,156,
+36,226,185,253,191,119,2,201,247,72,158,254,205,48,54,54,48,48,57,57,0,3,
+0,59,255,238,4,104,4,117,0,8,0,65,0,77,0,0,37,20,22,51,50,53,53,6,6,19,52,
+54,55,38,38,39,7,39,6,7,54,54,51,50,22,21,20,6,35,34,38,53,52,54,55,23,55,
+22,22,23,14,2,21,21,22,22,23,17,55,51,17,35,38,38,39,21,20,6,35,34,38,53,
+52,54,55,3,52,38,35,34,6,21,20,22,51,50,54,1,61,51,35,78,76,88,164,79,83,
+4,46,32,127,145,100,21,19,77,37,73,89,97,85,109,113,131,109,135,135,96,117,
+9,55,61,26,100,150,62,100,67,167,84,149,79,106,117,100,103,135,123,112,50,
+40,39,50,50,39,40,50,162,47,49,92,164,12,84,1,12,130,154,53,58,104,27,111,
+129,45,147,23,30,90,80,77,93,125,111,123,191,32,123,123,33,169,110,43,85,
+99,102,105,23,107,72,3,47,118,251,154,135,146,28,98,114,115,98,82,99,126,
+14,1,72,38,48,48,38,40,48,48,0,0,2,0,49,255,236,3,37,4,113,0,36,0,48,0,0,
+1,34,38,53,52,54,51,50,22,21,17,20,6,35,34,38,38,39,46,3,35,53,50,22,22,23,
+30,2,51,50,54,53,17,6,39,20,22,51,50,54,53,52,38,35,34,6,2,76,90,101,106,
+97,99,106,120,146,94,112,77,47,26,36,33,37,28,125,94,64,37,34,49,48,43,51,
+43,10,127,54,48,48,57,57,48,48,54,2,244,99,91,90,101,101,90,253,135,181,152,
+55,129,168,94,106,51,11,86,44,121,140,129,128,55,92,113,1,236,4,190,48,54,
+54,48,48,57,57,0,2,0,94,255,236,4,0,4,123,0,38,0,50,0,0,5,34,38,38,39,39,
+6,35,34,38,53,52,54,51,50,22,23,19,22,22,51,50,54,53,17,52,38,35,34,7,39,
+54,33,50,22,21,17,20,6,1,20,22,51,50,54,53,52,38,35,34,6,2,250,95,111,76,
+36,26,52,53,99,103,105,97,92,113,37,82,23,60,40,54,42,166,149,213,187,47,
+202,1,7,227,238,120,253,77,54,48,48,57,57,48,48,54,20,51,118,125,95,21,100,
+91,89,101,114,128,254,236,79,69,95,110,1,162,178,185,119,78,139,234,213,254,
+125,183,150,2,47,48,55,55,48,48,56,56,0,3,0,86,255,238,5,2,4,123,0,40,0,50,
+0,62,0,0,37,54,55,17,52,38,35,34,7,39,54,33,50,22,21,17,22,22,21,20,6,35,
+34,38,53,53,6,7,35,17,6,35,34,38,53,52,54,51,50,22,21,1,52,38,39,21,20,22,
+51,50,54,1,20,22,51,50,54,53,52,38,35,34,6,1,238,146,216,166,149,213,187,
+47,202,1,7,227,238,123,135,103,100,117,106,223,139,168,10,40,89,101,106,97,
+99,106,2,182,88,76,41,37,35,51,252,24,55,48,48,56,56,48,48,55,168,166,53,
+1,43,178,185,119,78,139,234,213,254,213,14,126,99,82,98,114,115,98,82,227,
+1,131,4,99,91,90,103,103,90,254,101,65,83,12,164,45,47,49,1,202,48,54,54,
+48,48,57,57,0,0,2,0,59,0,0,5,66,4,182,0,11,0,72,0,0,1,52,38,35,34,6,21,20,
+22,51,50,54,5,52,39,53,54,54,55,55,51,14,3,7,22,22,21,17,20,6,35,33,53,51,
+17,52,54,55,38,38,35,34,6,7,54,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,23,14,2,21,17,51,50,54,53,1,113,50,40,39,50,50,39,40,50,2,80,95,53,91,
+86,61,189,145,53,52,54,34,60,60,182,164,254,49,162,79,83,8,127,100,112,117,
+11,19,77,37,73,89,97,85,109,113,200,175,152,193,12,55,61,26,68,118,126,3,
+2,38,48,48,38,40,48,48,60,121,36,47,16,91,133,92,210,63,44,29,10,20,92,60,
+254,188,169,185,86,1,152,130,154,53,102,124,92,78,23,30,90,80,77,93,125,113,
+142,167,172,146,43,85,99,102,254,98,161,142,0,0,2,0,59,0,0,5,66,4,182,0,63,
+0,75,0,0,1,52,54,55,38,38,39,7,39,6,7,54,54,51,50,22,21,20,6,35,34,38,53,
+52,54,55,23,55,22,22,23,14,2,21,17,51,50,54,53,17,52,39,53,54,54,55,55,51,
+14,3,7,22,22,21,17,20,6,35,33,53,51,3,52,38,35,34,6,21,20,22,51,50,54,1,225,
+79,83,4,46,32,127,145,100,21,19,77,37,73,89,97,85,109,113,131,109,135,135,
+96,117,9,55,61,26,68,118,126,95,53,91,86,61,189,145,53,52,54,34,60,60,182,
+164,254,49,162,112,50,40,39,50,50,39,40,50,1,238,130,154,53,58,104,27,111,
+129,45,147,23,30,90,80,77,93,125,111,123,191,32,123,123,33,169,110,43,85,
+99,102,254,98,161,142,1,25,121,36,47,16,91,133,92,210,63,44,29,10,20,92,60,
+254,188,169,185,86,2,131,38,48,48,38,40,48,48,0,3,0,133,255,238,6,20,4,123,
+0,8,0,68,0,80,0,0,37,20,22,51,50,53,53,6,6,37,52,54,55,38,38,35,54,54,51,
+50,22,21,17,22,22,23,17,55,51,17,35,38,38,39,21,20,6,35,34,38,53,52,54,55,
+17,52,38,35,32,3,22,22,23,21,6,6,21,21,54,51,50,22,21,20,6,35,34,38,53,37,
+52,38,35,34,6,21,20,22,51,50,54,2,233,51,35,78,76,88,253,189,110,111,38,166,
+50,9,250,218,235,232,100,150,62,100,67,167,84,149,79,106,117,100,103,135,
+123,147,150,254,255,50,67,141,38,116,101,12,37,90,100,105,97,99,106,1,49,
+54,48,48,57,57,48,48,54,162,47,49,92,164,12,84,167,116,136,25,33,47,191,206,
+220,231,254,211,23,107,72,3,47,118,251,154,135,146,28,98,114,115,98,82,99,
+126,14,1,48,180,170,254,254,10,77,48,17,23,124,105,33,5,102,91,90,100,100,
+90,2,48,54,54,48,48,56,56,0,4,0,133,254,37,6,72,4,123,0,17,0,29,0,80,0,92,
+0,0,1,34,38,53,52,54,51,50,22,21,20,6,7,54,19,23,6,6,37,20,22,51,50,54,53,
+52,38,35,34,6,39,17,52,38,35,34,6,7,22,22,23,21,6,6,21,21,54,51,50,22,21,
+20,6,35,34,38,53,53,52,55,38,38,35,54,54,51,50,22,21,17,51,50,54,53,17,55,
+51,17,20,6,35,37,52,38,35,34,6,21,20,22,51,50,54,4,66,108,134,103,85,85,100,
+32,20,187,98,154,62,252,254,164,48,42,37,51,51,37,42,48,55,146,151,130,151,
+8,68,138,40,116,101,12,37,90,100,105,97,99,106,221,38,166,50,14,236,227,230,
+219,67,118,126,100,68,182,164,253,47,54,48,48,57,57,48,48,54,254,37,110,91,
+77,95,88,74,42,68,17,37,1,20,49,173,175,199,39,47,47,39,42,46,46,234,2,203,
+186,156,134,126,10,78,47,17,23,125,106,31,5,100,91,90,102,100,90,221,229,
+48,33,47,205,192,213,238,253,158,161,142,2,107,118,252,252,167,187,174,48,
+54,54,48,48,56,56,0,2,0,133,255,238,6,2,4,123,0,50,0,62,0,0,33,17,52,38,35,
+34,6,7,22,22,23,21,6,6,21,21,54,51,50,22,21,20,6,35,34,38,53,53,52,55,38,
+38,35,54,54,51,50,22,21,17,51,50,54,53,17,55,51,17,20,6,35,37,52,38,35,34,
+6,21,20,22,51,50,54,3,123,146,151,130,151,8,68,138,40,116,101,10,39,90,100,
+105,97,99,106,221,38,166,50,14,236,227,230,219,67,118,126,100,68,182,164,
+253,47,54,48,48,57,57,48,48,54,2,203,186,156,134,126,10,78,47,17,23,125,106,
+33,4,99,91,90,100,100,90,221,229,48,33,47,205,192,213,238,253,158,161,142,
+2,107,118,252,252,167,187,172,48,54,54,48,48,56,56,0,3,0,45,253,248,4,154,
+4,123,0,10,0,70,0,82,0,0,5,34,6,21,20,22,51,50,54,55,38,1,52,38,35,34,6,7,
+22,22,23,21,6,6,21,21,20,6,35,34,38,53,52,54,51,50,23,53,52,55,38,38,35,54,
+54,51,50,22,21,17,7,35,38,39,6,6,35,34,38,53,52,54,51,50,23,55,23,6,7,22,
+23,1,20,22,51,50,54,53,52,38,35,34,6,2,4,49,64,60,45,51,93,28,87,1,161,146,
+151,130,151,8,68,138,40,116,101,106,99,97,106,101,90,37,12,221,40,162,52,
+14,236,227,228,221,105,53,99,135,51,142,85,89,114,113,94,107,94,35,153,27,
+36,98,74,252,161,55,48,48,56,56,48,48,55,195,47,45,46,48,75,62,49,3,142,186,
+156,134,126,10,78,47,17,23,125,106,219,90,100,100,90,91,102,5,33,229,48,34,
+46,205,192,213,238,251,176,112,117,96,72,88,95,83,83,97,47,129,43,81,72,63,
+74,2,22,48,56,56,48,48,54,54,0,3,0,45,253,248,4,154,4,123,0,11,0,22,0,93,
+0,0,55,20,22,51,50,54,53,52,38,35,34,6,19,34,6,21,20,22,51,50,54,55,38,3,
+34,38,53,52,54,51,50,22,23,54,55,23,6,7,22,23,54,54,55,22,23,17,52,38,35,
+34,6,7,22,22,23,21,6,6,21,21,20,6,35,34,38,53,52,54,51,50,23,53,52,55,38,
+38,35,54,54,51,50,22,21,17,7,35,38,39,6,6,7,38,39,6,147,55,48,48,56,56,48,
+48,55,168,49,63,59,45,48,89,29,84,82,91,112,116,91,53,110,42,39,41,154,57,
+87,16,60,33,71,21,106,97,146,151,130,151,8,68,138,40,116,101,106,99,97,106,
+101,90,37,12,221,40,162,52,14,236,227,228,221,105,53,108,78,21,106,50,50,
+60,106,174,48,56,56,48,48,54,54,254,77,47,45,47,47,62,54,70,254,240,95,83,
+84,96,41,31,91,159,41,166,120,16,75,27,107,49,67,99,4,41,186,156,134,126,
+10,78,47,17,23,125,106,219,90,100,100,90,91,102,5,33,229,48,34,46,205,192,
+213,238,251,176,112,144,65,42,111,34,82,60,129,0,0,5,0,84,253,248,4,70,4,
+143,0,9,0,53,0,61,0,118,0,130,0,0,5,34,6,21,20,22,51,50,55,38,5,6,6,7,38,
+39,6,6,35,34,38,53,52,54,51,50,23,54,55,23,6,7,22,23,54,55,22,23,53,6,35,
+34,38,53,52,54,51,50,22,21,17,7,35,38,19,20,51,50,53,52,35,34,1,52,54,51,
+50,23,23,50,55,55,23,14,3,35,39,38,35,34,6,21,33,50,22,21,21,20,6,35,34,38,
+38,39,6,35,34,38,53,52,54,51,50,22,23,23,22,22,51,50,54,53,53,52,38,35,33,
+19,20,22,51,50,54,53,52,38,35,34,6,1,27,45,56,54,38,96,62,84,1,148,31,81,
+24,50,60,51,108,73,86,104,105,90,98,98,23,30,138,45,56,16,60,38,60,109,78,
+5,18,51,64,68,62,63,72,105,22,88,22,51,50,50,51,253,37,147,168,99,245,70,
+100,58,37,41,26,51,70,96,69,72,238,32,138,99,1,127,218,206,120,142,98,111,
+77,34,52,52,99,104,106,97,90,111,40,58,24,56,42,53,44,144,161,254,104,94,
+55,48,48,56,56,48,48,55,213,47,45,47,47,116,70,180,31,62,12,82,60,62,67,91,
+87,86,94,72,52,98,49,99,79,16,75,23,63,50,58,113,3,59,54,54,61,61,56,254,
+242,82,80,1,18,49,49,51,3,144,177,152,23,5,43,26,45,29,56,44,26,4,18,79,95,
+174,186,142,183,150,53,124,122,21,100,91,89,103,112,132,186,79,69,92,113,
+168,158,133,254,234,48,55,55,48,48,56,56,0,0,2,0,121,255,236,4,70,4,143,0,
+56,0,68,0,0,19,52,54,51,50,23,23,50,55,55,23,14,3,35,39,38,35,34,6,21,33,
+50,22,21,21,20,6,35,34,38,38,39,6,35,34,38,53,52,54,51,50,22,23,23,22,22,
+51,50,54,53,53,52,38,35,33,19,20,22,51,50,54,53,52,38,35,34,6,129,147,168,
+99,245,70,100,58,37,41,26,51,70,96,69,72,238,32,138,99,1,127,218,206,120,
+142,98,111,77,34,52,52,99,104,106,97,90,111,40,58,24,56,42,53,44,144,161,
+254,104,94,55,48,48,56,56,48,48,55,3,29,177,152,23,5,43,26,45,29,56,44,26,
+4,18,79,95,174,186,142,183,150,53,124,122,21,100,91,89,103,112,132,186,79,
+69,92,113,168,158,133,254,234,48,55,55,48,48,56,56,0,2,0,59,0,0,5,66,4,123,
+0,53,0,65,0,0,33,17,52,35,34,6,7,1,35,17,52,54,55,38,38,39,7,39,6,7,54,54,
+51,50,22,21,20,6,35,34,38,53,52,54,55,23,55,22,22,23,14,2,21,17,1,54,54,51,
+50,22,21,17,7,1,52,38,35,34,6,21,20,22,51,50,54,4,154,37,23,43,28,254,151,
+205,79,83,4,46,32,127,145,100,21,19,77,37,73,89,97,85,109,113,131,109,135,
+135,96,117,9,55,61,26,1,41,56,100,80,84,80,101,252,148,50,40,39,50,50,39,
+40,50,3,158,86,63,68,252,143,1,238,130,154,53,58,104,27,111,129,45,147,23,
+30,90,80,77,93,125,111,123,191,32,123,123,33,169,110,43,85,99,102,254,188,
+2,219,139,101,102,119,252,217,119,2,217,38,48,48,38,40,48,48,0,0,3,0,113,
+255,238,6,57,4,119,0,66,0,75,0,87,0,0,1,22,22,23,17,55,51,17,35,38,38,39,
+21,20,6,35,34,38,53,52,54,55,17,52,39,7,39,6,6,21,20,30,2,21,55,54,55,34,
+38,53,52,54,51,50,22,21,20,6,7,6,7,35,53,52,39,38,38,53,52,54,55,23,55,22,
+22,21,1,20,22,51,50,53,53,6,6,3,52,38,35,34,6,21,20,22,51,50,54,4,90,100,
+149,62,101,67,168,86,148,77,106,117,100,103,135,123,151,177,178,89,93,33,
+41,33,137,85,42,103,110,105,97,98,105,93,83,237,64,147,42,25,17,173,156,176,
+177,156,163,254,180,51,35,78,76,88,59,54,48,48,57,57,48,48,54,1,139,23,107,
+72,3,47,118,251,154,139,142,28,98,114,115,98,82,99,126,14,1,56,247,72,158,
+158,34,144,96,63,139,149,159,84,131,82,84,99,91,90,101,105,102,101,163,78,
+223,70,139,190,151,89,104,56,159,220,35,156,156,36,226,185,253,234,47,49,
+92,164,12,84,1,167,48,57,57,48,48,54,54,0,0,3,0,133,255,238,7,55,4,123,0,
+11,0,21,0,79,0,0,37,52,38,35,34,6,21,20,22,51,50,54,37,52,38,39,21,20,22,
+51,50,54,1,55,51,17,22,22,21,20,6,35,34,38,53,53,6,7,35,17,52,38,35,34,6,
+7,22,22,23,21,6,6,21,21,54,51,50,22,21,20,6,35,34,38,53,53,52,55,38,38,35,
+54,54,51,50,22,21,17,54,55,1,215,54,48,48,57,57,48,48,54,5,2,87,77,41,37,
+35,51,254,180,101,67,123,135,102,100,118,106,223,139,168,146,151,130,151,
+8,68,138,40,116,101,10,39,90,100,105,97,99,106,221,38,166,50,14,236,227,230,
+219,146,216,172,48,54,54,48,48,56,56,38,65,83,12,164,45,47,49,3,125,118,253,
+43,14,126,99,82,98,114,115,98,82,227,2,203,186,156,134,126,10,78,47,17,23,
+125,106,33,4,99,91,90,100,100,90,221,229,48,33,47,205,192,213,238,253,240,
+166,53,0,0,2,0,113,0,0,4,90,4,123,0,46,0,58,0,0,51,53,52,39,38,38,53,52,36,
+51,50,22,21,17,7,35,17,16,33,34,6,21,20,30,2,21,54,55,54,54,55,34,38,53,52,
+54,51,50,22,21,20,6,7,6,6,7,1,52,38,35,34,6,21,20,22,51,50,54,197,42,25,17,
+1,12,237,248,248,100,68,254,184,167,193,33,41,33,49,80,49,78,16,103,110,106,
+97,97,105,94,112,76,146,57,1,131,54,48,48,57,57,48,48,54,139,190,151,89,104,
+56,194,224,224,227,253,191,119,2,201,1,86,161,136,63,137,152,170,95,43,58,
+37,68,32,99,91,90,101,105,102,104,151,83,57,108,50,2,55,48,57,57,48,48,54,
+54,0,2,0,113,0,0,4,90,4,119,0,50,0,62,0,0,19,52,54,55,23,55,22,22,21,17,7,
+35,17,52,39,7,39,6,6,21,20,30,2,21,54,55,54,54,55,34,38,53,52,54,51,50,22,
+21,20,6,7,6,6,7,35,53,52,39,38,38,5,52,38,35,34,6,21,20,22,51,50,54,113,173,
+156,176,177,156,163,100,68,151,177,178,89,93,33,41,33,49,80,49,78,16,103,
+110,106,97,97,105,94,112,76,146,57,147,42,25,17,2,106,54,48,48,57,57,48,48,
+54,2,217,159,220,35,156,156,36,226,185,253,191,119,2,201,247,72,158,158,34,
+144,96,63,137,152,170,95,43,58,37,68,32,99,91,90,101,105,102,104,151,83,57,
+108,50,139,190,151,89,104,106,48,57,57,48,48,54,54,0,2,0,133,255,238,4,35,
+4,123,0,40,0,52,0,0,1,54,51,50,22,21,20,6,35,34,38,53,53,52,55,38,38,35,54,
+54,51,50,22,21,17,7,35,17,52,38,35,34,6,7,22,22,23,21,6,6,21,23,52,38,35,
+34,6,21,20,22,51,50,54,1,78,10,39,90,100,105,97,99,106,221,38,166,50,14,236,
+227,230,219,101,67,146,151,130,151,8,68,138,40,116,101,137,54,48,48,57,57,
+48,48,54,1,102,4,99,91,90,100,100,90,221,229,48,33,47,205,192,213,238,253,
+191,119,2,203,186,156,134,126,10,78,47,17,23,125,106,219,48,54,54,48,48,56,
+56,0,0,2,0,45,0,0,4,125,4,123,0,31,0,43,0,0,1,6,35,34,38,53,52,54,51,50,22,
+21,17,51,19,54,54,51,50,21,17,7,35,17,52,35,34,6,7,1,21,35,3,20,22,51,50,
+54,53,52,38,35,34,6,1,29,10,39,90,101,106,97,99,106,4,217,65,115,98,197,100,
+68,72,42,62,43,254,203,168,138,55,48,48,56,56,48,48,55,2,246,4,99,91,90,103,
+103,90,254,8,1,211,141,99,221,252,217,119,3,158,86,68,90,253,115,201,3,176,
+48,54,54,48,48,57,57,0,1,0,139,0,0,4,39,4,143,0,43,0,0,1,52,38,35,33,53,52,
+54,51,50,23,23,50,55,55,23,14,3,35,39,38,35,34,6,6,21,33,50,22,21,21,20,6,
+35,33,17,55,51,17,51,32,17,3,84,144,161,254,104,134,161,96,230,67,99,60,36,
+41,26,51,70,95,69,69,222,31,95,85,37,1,127,218,206,182,164,254,12,100,68,
+252,1,2,1,180,158,133,70,186,143,23,5,43,26,45,29,56,44,26,4,18,32,75,67,
+174,186,101,167,187,1,150,118,254,74,1,45,0,3,0,45,255,238,4,217,4,113,0,
+11,0,21,0,53,0,0,19,20,22,51,50,54,53,52,38,35,34,6,1,52,38,39,21,20,22,51,
+50,54,37,54,55,17,55,51,17,22,22,21,20,6,35,34,38,53,53,6,7,35,17,6,35,34,
+38,53,52,54,51,50,22,21,147,55,48,48,56,56,48,48,55,3,232,88,76,41,37,35,
+51,253,74,146,216,100,68,123,135,103,100,117,106,223,139,168,10,39,90,101,
+106,97,99,106,3,176,48,54,54,48,48,57,57,252,194,65,83,12,164,45,47,49,53,
+166,53,2,109,118,253,43,14,126,99,82,98,114,115,98,82,227,2,246,4,99,91,90,
+103,103,90,0,0,2,0,45,0,0,4,72,4,113,0,11,0,38,0,0,19,20,22,51,50,54,53,52,
+38,35,34,6,1,51,50,54,53,17,55,51,17,20,6,35,33,53,51,17,6,35,34,38,53,52,
+54,51,50,22,21,147,55,48,48,56,56,48,48,55,1,50,231,118,126,100,68,182,164,
+253,141,162,10,39,90,101,106,97,99,106,3,178,48,54,54,48,48,57,57,252,116,
+161,142,2,107,118,252,252,167,187,86,2,162,4,99,91,90,101,101,90,0,2,0,45,
+0,0,4,72,6,154,0,11,0,38,0,0,19,20,22,51,50,54,53,52,38,35,34,6,1,51,50,54,
+53,17,55,51,17,20,6,35,33,53,51,17,6,35,34,38,53,52,54,51,50,22,21,147,55,
+48,48,56,56,48,48,55,1,50,231,118,126,100,68,182,164,253,141,162,10,39,90,
+101,106,97,99,106,3,178,48,54,54,48,48,57,57,252,116,161,142,4,158,119,250,
+200,167,187,86,2,162,4,99,91,90,101,101,90,0,2,0,184,0,0,4,135,4,113,0,11,
+0,52,0,0,1,52,38,35,34,6,21,20,22,51,50,54,1,46,3,39,14,3,7,35,17,52,54,51,
+50,22,21,20,6,35,34,39,17,62,3,55,51,30,3,23,17,55,51,17,7,1,233,54,48,48,
+56,56,48,48,54,1,232,29,78,82,82,34,34,82,83,77,29,183,106,99,97,106,101,
+90,39,10,27,73,77,70,24,98,24,70,76,73,27,101,67,98,3,178,48,57,57,48,48,
+54,54,252,126,84,129,120,126,80,80,126,120,129,84,3,178,90,101,101,90,91,
+99,4,253,190,67,111,112,122,78,78,122,112,111,67,3,58,118,252,17,119,0,2,
+0,184,0,0,4,135,6,154,0,11,0,52,0,0,1,52,38,35,34,6,21,20,22,51,50,54,1,46,
+3,39,14,3,7,35,17,52,54,51,50,22,21,20,6,35,34,39,17,62,3,55,51,30,3,23,17,
+55,51,17,7,1,233,54,48,48,56,56,48,48,54,1,232,29,78,82,82,34,34,82,83,77,
+29,183,106,99,97,106,101,90,39,10,27,73,77,70,24,98,24,70,76,73,27,101,67,
+98,3,178,48,57,57,48,48,54,54,252,126,84,129,120,126,80,80,126,120,129,84,
+3,178,90,101,101,90,91,99,4,253,190,67,111,112,122,78,78,122,112,111,67,5,
+109,119,249,221,119,0,2,0,45,0,0,4,238,4,113,0,11,0,36,0,0,19,20,22,51,50,
+54,53,52,38,35,34,6,1,35,1,1,35,17,6,35,34,38,53,52,54,51,50,22,21,17,1,51,
+1,17,55,51,17,147,55,48,48,56,56,48,48,55,3,248,106,254,227,254,229,204,10,
+39,90,101,106,97,99,106,1,12,104,1,13,100,68,3,176,48,54,54,48,48,57,57,252,
+32,3,197,252,59,2,246,4,99,91,90,103,103,90,253,47,3,125,252,131,3,17,118,
+252,17,0,2,0,45,0,0,4,238,6,154,0,11,0,36,0,0,19,20,22,51,50,54,53,52,38,
+35,34,6,1,35,1,1,35,17,6,35,34,38,53,52,54,51,50,22,21,17,1,51,1,17,55,51,
+17,147,55,48,48,56,56,48,48,55,3,248,106,254,227,254,229,204,10,39,90,101,
+106,97,99,106,1,12,104,1,13,100,68,3,176,48,54,54,48,48,57,57,252,32,3,197,
+252,59,2,246,4,99,91,90,103,103,90,253,47,3,125,252,131,5,68,119,249,221,
+0,2,0,45,255,238,4,154,4,123,0,40,0,52,0,0,1,52,55,38,38,35,54,54,51,50,22,
+21,17,7,35,17,52,38,35,34,6,7,22,22,23,21,6,6,21,21,20,6,35,34,38,53,52,54,
+51,50,23,7,20,22,51,50,54,53,52,38,35,34,6,1,29,221,40,162,52,14,236,227,
+228,221,101,67,146,151,130,151,8,68,138,40,116,101,106,99,97,106,101,90,37,
+12,138,55,48,48,56,56,48,48,55,1,137,229,48,34,46,205,192,213,238,253,191,
+119,2,203,186,156,134,126,10,78,47,17,23,125,106,219,90,100,100,90,91,102,
+5,186,48,56,56,48,48,54,54,0,0,3,0,86,255,238,4,18,4,113,0,11,0,21,0,53,0,
+0,19,20,22,51,50,54,53,52,38,35,34,6,3,20,22,51,50,54,53,53,6,6,5,35,38,39,
+21,20,6,35,34,38,53,52,54,55,17,6,35,34,38,53,52,54,51,50,22,21,17,22,23,
+17,55,51,207,54,48,48,57,57,48,48,54,27,51,35,37,41,76,88,3,94,168,139,223,
+106,117,100,103,135,123,10,39,90,101,106,97,99,106,215,147,101,67,3,176,48,
+54,54,48,48,57,57,252,194,47,49,47,45,164,12,84,226,228,81,98,115,114,98,
+82,99,126,14,1,101,4,99,91,90,103,103,90,253,211,52,167,3,72,118,0,2,0,133,
+0,0,3,203,4,113,0,11,0,52,0,0,1,20,22,51,50,54,53,52,38,35,34,6,19,34,38,
+53,52,54,55,46,2,53,54,54,51,50,22,21,20,6,35,34,39,22,22,23,21,6,21,20,22,
+51,51,50,17,17,55,51,17,20,6,35,1,10,55,48,48,56,56,48,48,55,215,173,173,
+102,93,46,96,55,2,125,111,97,105,105,97,25,16,17,98,63,205,115,129,12,244,
+100,68,173,173,3,176,48,54,54,48,48,57,57,252,32,173,159,107,134,19,8,91,
+130,80,108,128,101,90,91,99,4,66,65,6,60,25,198,123,131,1,0,2,154,118,252,
+230,159,173,0,0,2,0,70,255,238,3,223,4,143,0,11,0,54,0,0,37,20,22,51,50,54,
+53,52,38,35,34,6,55,52,38,35,35,53,52,54,51,50,23,23,50,55,55,23,14,2,35,
+34,39,38,35,34,6,21,51,50,22,21,17,20,6,35,34,38,53,52,54,51,50,23,1,213,
+54,48,48,57,57,48,48,54,137,144,161,231,147,168,93,214,64,98,60,36,41,65,
+75,100,71,32,113,113,41,139,99,207,218,206,106,99,97,105,100,90,36,13,174,
+48,56,56,48,48,54,54,214,158,133,70,177,152,23,5,43,26,45,76,51,28,11,11,
+80,94,174,186,254,229,90,100,100,90,91,102,5,0,0,2,0,133,253,248,4,35,4,123,
+0,40,0,52,0,0,1,54,51,50,22,21,20,6,35,34,38,53,53,52,55,38,38,35,54,54,51,
+50,22,21,17,7,35,17,52,38,35,34,6,7,22,22,23,21,6,6,21,23,52,38,35,34,6,21,
+20,22,51,50,54,1,78,10,39,90,100,105,97,99,106,221,38,166,50,14,236,227,230,
+219,101,67,146,151,130,151,8,68,138,40,116,101,137,54,48,48,57,57,48,48,54,
+1,102,4,99,91,90,100,100,90,221,229,48,33,47,205,192,213,238,251,183,119,
+4,211,186,156,134,126,10,78,47,17,23,125,106,219,48,54,54,48,48,56,56,0,0,
+2,0,119,255,238,4,25,4,123,0,38,0,50,0,0,1,54,51,50,22,21,20,6,35,34,38,53,
+53,52,54,51,50,19,17,52,38,35,34,7,39,54,33,50,22,21,17,7,35,53,38,38,35,
+34,21,23,52,38,35,34,6,21,20,22,51,50,54,1,55,10,39,90,101,106,97,99,106,
+167,163,242,166,166,150,212,187,47,202,1,7,227,238,101,67,86,205,107,172,
+138,55,48,48,56,56,48,48,55,1,102,4,99,91,90,100,100,90,186,163,153,254,186,
+1,82,178,185,119,78,139,234,213,253,187,119,174,196,205,180,223,48,54,54,
+48,48,56,56,0,2,0,45,253,248,4,154,4,123,0,40,0,52,0,0,1,52,55,38,38,35,54,
+54,51,50,22,21,17,7,35,17,52,38,35,34,6,7,22,22,23,21,6,6,21,21,20,6,35,34,
+38,53,52,54,51,50,23,7,20,22,51,50,54,53,52,38,35,34,6,1,29,221,40,162,52,
+14,236,227,228,221,101,67,146,151,130,151,8,68,138,40,116,101,106,99,97,106,
+101,90,37,12,138,55,48,48,56,56,48,48,55,1,137,229,48,34,46,205,192,213,238,
+251,183,119,4,211,186,156,134,126,10,78,47,17,23,125,106,219,90,100,100,90,
+91,102,5,186,48,56,56,48,48,54,54,0,0,2,255,252,255,238,3,55,4,123,0,23,0,
+35,0,0,37,20,6,35,34,38,53,52,54,51,50,23,17,52,38,35,34,6,7,39,54,51,32,
+17,1,20,22,51,50,54,53,52,38,35,34,6,3,55,105,100,97,105,100,90,37,12,138,
+128,78,151,117,47,204,220,1,147,254,207,55,48,48,56,56,48,48,55,172,90,100,
+100,90,91,102,5,1,70,177,186,48,71,78,139,254,63,253,244,48,56,56,48,48,54,
+54,0,0,3,0,113,0,0,5,8,4,182,0,37,0,54,0,66,0,0,1,6,6,7,21,35,53,52,39,38,
+38,53,52,36,51,50,23,54,55,51,6,7,22,21,17,7,35,17,52,39,6,7,22,21,20,6,35,
+34,1,38,35,34,6,21,20,22,23,23,62,2,51,50,23,54,1,20,22,51,50,54,53,52,38,
+35,34,6,1,195,38,46,2,168,42,25,17,1,12,237,241,126,63,54,186,86,133,45,100,
+68,10,90,92,57,106,97,109,1,136,79,194,167,193,22,32,24,36,70,99,67,31,29,
+134,254,214,54,48,48,57,57,48,48,54,1,211,41,180,119,127,139,190,151,89,104,
+56,194,224,109,79,89,151,125,100,134,253,191,119,2,201,58,52,62,48,51,93,
+91,99,2,45,119,161,136,54,106,98,90,146,135,69,6,89,254,236,48,54,54,48,48,
+57,57,0,3,0,45,0,0,5,78,4,113,0,48,0,60,0,72,0,0,37,51,50,54,53,53,6,35,34,
+53,52,54,51,50,22,21,20,6,7,54,55,17,55,51,17,54,55,23,6,7,21,20,6,35,33,
+53,51,17,6,35,34,38,53,52,54,51,50,22,21,33,20,22,51,50,54,53,52,38,35,34,
+6,1,20,22,51,50,54,53,52,38,35,34,6,1,197,231,118,126,84,94,244,102,86,88,
+97,29,14,49,43,100,68,82,59,121,112,150,182,164,253,141,162,10,39,90,101,
+106,97,99,106,254,206,55,48,48,56,56,48,48,55,1,201,48,42,37,51,51,37,42,
+48,86,161,142,51,24,190,81,91,89,73,42,60,12,12,18,1,220,118,254,29,82,127,
+74,186,96,142,167,187,86,2,162,4,99,91,90,101,101,90,48,54,54,48,48,57,57,
+254,122,38,48,48,38,42,46,46,0,0,3,0,119,255,238,4,199,4,182,0,42,0,50,0,
+62,0,0,1,54,51,50,22,21,20,6,35,34,38,53,53,52,54,55,54,55,38,35,34,7,39,
+54,33,50,23,54,55,51,6,7,22,21,17,7,35,53,38,38,35,34,21,5,17,52,39,6,7,22,
+22,1,52,38,35,34,6,21,20,22,51,50,54,1,55,10,39,90,101,106,97,99,106,164,
+162,203,145,82,170,212,187,47,202,1,7,215,121,61,55,187,92,130,48,101,67,
+86,205,107,172,2,58,17,128,163,86,151,254,151,55,48,48,56,56,48,48,55,1,102,
+4,99,91,90,100,100,90,186,162,152,2,111,143,121,119,78,139,109,78,90,160,
+118,100,128,253,187,119,174,196,205,180,47,1,82,71,62,89,73,26,147,254,200,
+48,54,54,48,48,56,56,0,0,3,0,45,0,0,4,123,4,113,0,39,0,51,0,61,0,0,33,35,
+17,6,35,34,38,53,52,54,51,50,22,21,17,54,18,55,38,38,53,52,54,51,50,22,21,
+20,7,22,22,21,17,7,35,17,52,38,39,0,1,20,22,51,50,54,53,52,38,35,34,6,37,
+34,6,21,20,23,54,53,52,38,1,197,168,10,39,90,101,106,97,99,106,56,233,122,
+59,68,110,93,95,112,109,58,51,100,68,32,21,254,156,254,89,55,48,48,56,56,
+48,48,55,3,25,43,53,104,88,56,2,246,4,99,91,90,103,103,90,253,119,111,1,2,
+90,42,101,55,90,95,98,85,98,86,45,117,108,254,131,119,1,254,71,99,18,254,
+206,2,40,48,54,54,48,48,57,57,57,50,45,76,59,65,68,48,49,0,0,3,0,45,0,0,6,
+41,5,184,0,39,0,51,0,63,0,0,33,1,1,35,17,6,35,34,38,53,52,54,51,50,22,21,
+17,1,51,1,17,38,38,53,52,54,51,50,22,21,20,6,7,54,54,55,23,2,7,17,1,20,22,
+51,50,54,53,52,38,35,34,6,1,20,22,51,50,54,53,52,38,35,34,6,4,33,254,227,
+254,229,204,10,39,90,101,106,97,99,106,1,12,104,1,13,91,116,103,85,85,100,
+32,20,82,109,41,137,98,217,251,165,55,48,48,56,56,48,48,55,3,70,48,42,37,
+51,51,37,42,48,3,197,252,59,2,246,4,99,91,90,103,103,90,253,47,3,125,252,
+131,3,76,8,106,87,77,95,88,74,42,68,17,34,150,129,49,254,235,57,251,199,3,
+176,48,54,54,48,48,57,57,1,18,39,47,47,39,42,46,46,0,2,0,131,0,0,4,37,4,121,
+0,11,0,50,0,0,1,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,7,39,54,33,
+50,22,21,17,20,6,35,35,34,38,53,17,52,54,51,50,22,21,20,6,35,34,39,21,20,
+22,51,51,50,17,1,213,54,48,48,57,57,48,48,54,1,168,166,149,210,190,47,209,
+1,0,227,238,173,173,205,173,173,106,99,97,105,100,90,39,10,114,129,74,244,
+2,104,48,57,57,48,48,54,54,116,178,185,119,78,139,234,213,254,146,159,173,
+173,159,1,28,90,101,101,90,91,99,4,90,123,131,1,0,0,0,3,0,160,0,0,4,158,4,
+182,0,11,0,61,0,72,0,0,1,52,38,35,34,6,21,20,22,51,50,54,5,20,6,35,35,34,
+38,53,53,52,54,51,50,22,21,20,6,35,34,39,21,20,22,51,51,50,17,17,52,38,39,
+6,6,35,34,38,53,52,54,51,50,23,54,55,51,6,6,7,22,21,1,34,6,21,20,22,51,50,
+55,38,38,1,213,54,48,48,57,57,48,48,54,2,80,173,173,205,173,173,106,99,97,
+105,100,90,39,10,114,129,74,244,7,3,68,190,95,174,196,210,179,250,139,40,
+19,185,19,83,44,25,254,24,109,130,108,95,201,124,32,164,2,20,48,57,57,48,
+48,54,54,152,159,173,173,159,200,90,101,101,90,91,99,4,6,123,131,1,0,1,178,
+19,46,7,35,39,101,86,86,100,94,59,94,74,155,43,60,86,1,31,65,52,51,57,98,
+58,69,0,0,2,0,45,0,0,3,164,4,102,0,11,0,34,0,0,19,20,22,51,50,54,53,52,38,
+35,34,6,37,17,7,35,17,6,6,35,34,38,53,52,54,51,50,22,21,20,6,7,54,54,55,143,
+48,42,38,51,51,38,42,48,3,21,101,67,121,232,118,118,130,102,86,88,97,34,22,
+139,209,62,3,131,38,48,48,38,42,46,46,185,252,17,119,3,143,116,105,112,99,
+81,91,91,81,42,69,16,32,184,136,0,0,4,0,80,0,121,3,164,4,23,0,18,0,30,0,49,
+0,61,0,0,1,54,54,55,23,6,4,35,34,38,53,52,54,51,50,22,21,20,6,39,20,22,51,
+50,54,53,52,38,35,34,6,19,54,54,55,23,6,4,35,34,38,53,52,54,51,50,22,21,20,
+6,39,20,22,51,50,54,53,52,38,35,34,6,1,154,131,205,65,121,104,254,200,188,
+121,127,102,86,88,97,29,246,48,42,37,51,51,37,42,48,232,131,206,64,121,103,
+254,199,188,121,127,102,86,88,97,29,246,48,42,37,51,51,37,42,48,2,184,31,
+177,143,74,176,187,96,95,80,92,90,72,42,60,90,38,48,48,38,42,46,46,253,134,
+31,177,142,74,174,188,96,94,81,91,89,72,42,61,90,38,48,48,38,42,46,46,0,0,
+2,253,117,4,199,0,109,6,84,0,17,0,29,0,0,1,34,38,53,52,54,51,50,22,21,20,
+6,7,54,19,23,6,6,37,20,22,51,50,54,53,52,38,35,34,6,254,102,107,134,101,87,
+85,99,31,20,188,97,154,62,252,254,164,48,42,37,51,51,37,42,48,4,199,111,89,
+79,93,89,72,42,68,17,38,1,19,49,174,174,198,38,48,48,38,42,46,46,0,1,255,
+252,0,0,3,55,4,123,0,14,0,0,37,7,35,17,52,38,35,34,6,7,39,54,51,32,17,3,55,
+100,68,138,128,78,151,117,47,204,220,1,147,119,119,2,174,177,186,48,71,78,
+139,254,61,0,0,3,254,51,0,0,3,55,6,39,0,11,0,23,0,38,0,0,1,52,54,51,50,22,
+21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,1,7,35,17,52,38,35,34,
+6,7,39,54,51,32,17,254,51,94,88,90,97,97,90,88,94,90,53,42,40,54,54,40,42,
+53,4,170,100,68,138,128,78,151,117,47,204,220,1,147,5,123,80,92,92,80,82,
+90,90,82,42,50,50,42,42,50,50,250,210,119,2,174,177,186,48,71,78,139,254,
+61,0,2,251,229,4,182,255,72,6,86,0,8,0,16,0,0,3,36,36,35,54,54,51,50,22,37,
+34,7,50,4,23,38,38,184,255,0,254,118,217,34,211,147,184,248,254,98,188,56,
+161,1,29,128,42,167,4,182,53,44,151,168,213,92,127,45,29,91,110,0,0,2,251,
+229,4,182,255,72,6,156,0,12,0,20,0,0,3,36,36,35,54,54,51,50,23,53,51,17,22,
+37,34,7,50,4,23,38,38,184,255,0,254,118,217,34,211,147,202,127,111,22,254,
+68,188,56,161,1,29,128,42,167,4,182,53,44,151,168,127,197,254,143,55,233,
+127,45,29,91,110,0,0,3,251,229,4,182,255,170,6,141,0,18,0,26,0,38,0,0,3,36,
+36,35,54,54,51,50,23,54,54,51,50,22,21,20,6,7,22,37,34,7,50,4,23,38,38,55,
+20,22,51,50,54,53,52,38,35,34,6,184,255,0,254,118,217,34,211,147,139,106,
+17,87,56,72,96,76,65,25,254,73,188,56,161,1,29,128,42,167,186,48,34,34,48,
+49,33,34,48,4,182,53,44,151,168,61,51,65,96,72,61,94,11,53,211,127,45,29,
+91,110,8,34,48,50,32,32,52,50,0,2,251,229,4,182,255,72,6,156,0,17,0,25,0,
+0,3,36,36,35,54,54,51,50,23,53,51,21,22,23,53,51,17,22,37,34,7,50,4,23,38,
+38,184,255,0,254,118,217,34,211,147,71,51,111,64,36,111,14,254,72,188,56,
+161,1,29,128,42,167,4,182,53,44,151,168,14,84,125,37,39,201,254,133,39,227,
+127,45,29,91,110,0,0,2,254,70,253,248,255,76,255,154,0,11,0,19,0,0,1,53,6,
+35,34,53,52,51,50,22,21,17,3,20,51,50,53,52,35,34,254,205,6,17,112,127,63,
+72,193,51,50,50,51,253,248,194,4,113,115,61,56,254,211,1,47,49,49,51,0,2,
+253,20,253,244,255,76,255,154,0,15,0,23,0,0,1,53,6,35,34,53,52,51,50,22,21,
+21,51,17,51,17,1,20,51,50,53,52,35,34,253,158,6,17,115,130,63,72,176,127,
+254,16,51,50,50,51,253,244,198,4,113,115,61,56,215,1,61,254,105,1,51,49,49,
+51,0,1,254,137,254,184,255,90,255,139,0,11,0,0,5,52,54,51,50,22,21,20,6,35,
+34,38,254,137,61,44,43,61,64,40,41,64,221,43,61,61,43,48,59,60,0,5,0,16,255,
+94,4,51,6,20,0,32,0,38,0,42,0,49,0,53,0,0,1,20,6,7,21,22,22,21,20,6,7,21,
+35,53,33,53,51,50,54,53,17,52,38,38,35,35,53,33,53,51,21,22,22,3,16,39,17,
+54,54,5,51,17,35,1,52,38,39,17,54,54,5,51,17,35,3,246,122,132,151,164,237,
+224,102,254,16,11,86,61,29,56,62,11,1,240,102,191,209,158,242,126,116,254,
+37,131,131,1,158,96,85,96,85,254,98,131,131,4,72,117,161,44,8,26,194,151,
+181,196,16,164,162,86,67,80,3,236,51,61,27,86,94,98,17,188,252,172,1,11,39,
+253,167,20,144,168,2,101,1,125,103,130,21,253,252,23,127,167,2,31,0,2,0,184,
+255,238,2,80,4,102,0,11,0,26,0,0,37,52,38,35,34,6,21,20,22,51,50,54,1,55,
+51,17,54,51,50,22,21,20,6,35,34,38,53,1,233,54,48,48,56,56,48,48,54,254,207,
+101,67,10,39,88,103,108,97,99,104,172,48,54,54,48,48,56,56,3,116,118,253,
+0,4,97,93,90,100,100,90,0,0,4,0,184,255,238,4,106,4,102,0,11,0,26,0,38,0,
+53,0,0,37,52,38,35,34,6,21,20,22,51,50,54,1,55,51,17,54,51,50,22,21,20,6,
+35,34,38,53,33,52,38,35,34,6,21,20,22,51,50,54,1,55,51,17,54,51,50,22,21,
+20,6,35,34,38,53,1,233,54,48,48,56,56,48,48,54,254,207,101,67,10,39,88,103,
+108,97,99,104,3,76,54,48,48,57,57,48,48,54,254,207,100,68,10,39,88,102,107,
+97,99,104,172,48,54,54,48,48,56,56,3,116,118,253,0,4,97,93,90,100,100,90,
+48,54,54,48,48,56,56,3,116,118,253,0,4,97,93,90,100,100,90,0,0,2,0,0,255,
+238,3,133,7,252,0,43,0,55,0,0,1,54,51,50,22,21,20,6,35,34,38,53,17,52,38,
+35,35,53,52,54,51,50,23,23,50,54,54,55,23,14,2,35,34,39,38,35,34,6,21,51,
+50,22,21,19,52,38,35,34,6,21,20,22,51,50,54,2,47,10,39,90,101,106,97,99,106,
+109,124,158,146,169,86,205,60,42,58,46,48,41,65,75,99,72,38,97,97,47,135,
+102,145,180,160,139,54,48,48,56,56,48,48,54,1,102,4,97,93,90,100,100,90,4,
+117,157,134,69,178,152,24,5,12,22,36,45,76,51,29,12,11,79,95,180,181,251,
+121,48,54,54,48,48,56,56,0,3,0,0,255,238,3,61,8,16,0,43,0,55,0,67,0,0,1,54,
+51,50,22,21,20,6,35,34,38,53,17,52,54,55,38,38,35,34,6,7,54,54,51,50,22,21,
+20,6,35,34,38,53,52,54,51,50,22,23,14,2,21,19,52,38,35,34,6,21,20,22,51,50,
+54,1,52,38,35,34,6,21,20,22,51,50,54,2,78,10,39,88,102,105,97,99,106,77,85,
+8,128,100,111,117,11,16,77,40,73,88,99,83,109,112,200,175,151,193,12,55,60,
+26,137,54,48,48,57,57,48,48,54,254,94,50,40,38,50,50,38,40,50,1,102,4,97,
+93,90,100,100,90,4,215,130,152,56,104,121,91,79,21,33,92,78,80,90,126,111,
+142,167,170,147,43,87,99,101,251,35,48,54,54,48,48,56,56,6,28,38,48,48,38,
+41,48,48,0,0,2,255,227,255,238,3,193,8,16,0,11,0,48,0,0,37,52,38,35,34,6,
+21,20,22,51,50,54,1,53,50,22,22,23,55,54,54,51,50,22,21,17,54,51,50,22,21,
+20,6,35,34,38,53,17,52,35,34,6,7,3,35,39,46,2,3,90,54,48,48,57,57,48,48,54,
+252,137,112,102,69,45,31,72,105,71,69,74,10,39,90,101,106,97,99,106,37,22,
+49,29,156,49,59,31,49,53,172,48,54,54,48,48,56,56,7,62,86,42,121,168,67,158,
+106,101,120,250,51,4,97,93,90,100,100,90,6,135,86,70,63,254,195,219,114,116,
+50,0,0,1,255,252,253,248,3,55,4,123,0,14,0,0,1,7,35,17,52,38,35,34,6,7,39,
+54,51,32,17,3,55,100,68,138,128,78,151,117,47,204,220,1,147,254,111,119,4,
+182,177,186,48,71,78,139,254,61,0,2,0,59,253,248,3,82,4,117,0,28,0,40,0,0,
+1,39,6,7,54,54,51,50,22,21,20,6,35,34,38,53,52,54,55,23,55,4,17,17,7,35,17,
+52,39,3,52,38,35,34,6,21,20,22,51,50,54,1,178,145,100,21,19,77,37,73,89,97,
+85,109,113,131,109,135,135,1,25,100,68,100,213,50,40,39,50,50,39,40,50,3,
+141,129,45,147,23,30,90,80,77,93,125,111,123,191,32,123,123,36,254,206,251,
+80,119,5,47,188,41,254,205,38,48,48,38,40,48,48,0,2,252,164,4,197,255,162,
+6,213,0,51,0,62,0,0,3,38,38,53,52,54,51,50,21,20,6,35,34,38,39,39,6,7,38,
+38,53,52,54,51,50,23,23,50,54,54,55,23,6,6,35,34,39,38,35,34,21,20,22,22,
+23,54,55,22,23,22,51,50,39,20,51,50,54,53,52,38,35,34,6,238,43,45,47,48,108,
+87,73,44,97,62,67,32,60,92,123,147,123,56,166,57,32,45,39,58,43,50,101,62,
+51,106,107,41,152,30,48,20,51,29,27,130,103,37,34,9,39,15,22,22,15,19,20,
+5,61,4,53,38,35,53,123,78,102,43,47,47,65,64,19,138,93,101,122,21,4,10,19,
+43,43,66,77,15,15,114,32,54,38,3,51,80,13,88,71,123,37,20,17,17,22,22,0,1,
+254,158,4,197,255,96,6,47,0,3,0,0,1,51,3,35,254,158,194,41,112,6,47,254,150,
+0,0,2,253,35,4,197,255,193,6,125,0,25,0,37,0,0,1,20,6,7,50,54,54,55,23,2,
+33,35,39,54,54,55,6,35,34,38,53,52,54,51,50,22,7,20,22,51,50,54,53,52,38,
+35,34,6,254,72,73,54,102,132,83,35,152,78,254,110,119,28,63,88,9,32,54,57,
+60,74,57,77,85,217,32,25,23,30,30,23,25,32,5,223,56,114,33,66,140,155,51,
+254,123,71,34,87,39,39,67,56,62,63,85,38,25,30,30,25,25,30,30,0,0,2,252,135,
+4,197,255,211,6,125,0,35,0,47,0,0,1,20,7,54,54,55,23,6,6,35,54,54,53,52,38,
+39,7,39,6,21,54,51,50,22,21,20,6,35,34,38,53,52,55,23,55,22,5,52,38,35,34,
+6,21,20,22,51,50,54,254,170,27,63,82,27,152,47,214,188,24,28,25,41,104,109,
+78,31,55,48,69,74,57,76,86,176,101,98,172,254,182,29,26,25,30,30,25,26,29,
+5,166,71,58,27,167,150,51,202,187,44,111,47,45,71,26,92,94,46,91,38,59,63,
+60,65,109,91,176,64,90,90,65,250,24,29,29,24,26,30,30,0,0,1,254,53,4,197,
+255,201,6,104,0,11,0,0,1,53,51,53,51,21,51,21,35,21,35,53,254,53,144,116,
+144,144,116,5,92,117,151,151,117,151,151,0,0,2,252,190,4,199,255,238,6,209,
+0,20,0,32,0,0,1,20,6,35,34,38,53,52,54,55,62,2,55,51,14,2,7,7,22,5,20,22,
+51,50,54,53,52,38,35,34,6,254,51,96,88,87,102,136,166,129,143,65,9,168,20,
+108,236,107,23,51,254,234,51,43,38,54,54,38,43,51,5,104,72,89,91,81,90,90,
+14,11,35,56,54,122,98,23,2,1,48,54,44,48,48,44,40,50,50,0,0,2,254,51,4,207,
+255,164,6,39,0,11,0,23,0,0,1,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,
+50,54,53,52,38,35,34,6,254,51,94,88,90,97,97,90,88,94,90,53,42,40,54,54,40,
+42,53,5,123,80,92,92,80,82,90,90,82,42,50,50,42,42,50,50,0,1,254,16,4,199,
+255,170,6,162,0,33,0,0,3,34,6,21,20,22,51,50,55,21,6,35,34,38,53,52,54,51,
+38,38,53,52,54,51,50,23,7,38,35,34,6,21,20,23,195,81,86,45,45,77,58,60,90,
+99,110,93,90,48,61,100,83,99,54,35,42,64,31,39,102,5,152,40,38,25,31,21,74,
+22,71,62,52,60,14,55,40,58,63,31,63,24,32,27,67,9,0,3,0,76,255,236,4,219,
+4,125,0,15,0,31,0,43,0,0,19,52,18,36,51,50,4,18,21,20,2,4,35,34,36,2,55,20,
+22,22,51,50,54,54,53,52,38,38,35,34,6,6,5,52,54,51,50,22,21,20,6,35,34,38,
+76,157,1,14,156,157,1,15,156,156,254,240,156,155,254,241,157,98,130,223,132,
+130,224,130,128,226,130,131,226,128,1,27,117,85,83,120,122,81,85,117,2,51,
+156,1,17,157,158,254,239,155,155,254,242,158,156,1,15,156,129,223,129,129,
+223,129,129,224,131,131,224,129,83,122,121,84,83,118,121,0,0,2,0,131,255,
+236,4,205,3,162,0,12,0,24,0,0,37,50,54,53,52,38,35,34,6,21,20,22,22,23,34,
+0,53,52,36,51,50,4,21,20,0,2,166,173,212,210,175,173,208,93,175,113,254,254,
+219,1,37,254,254,1,41,254,216,72,205,180,177,206,207,176,116,174,95,92,1,
+1,218,222,253,253,222,219,255,0,0,2,0,131,255,238,4,205,3,162,0,11,0,58,0,
+0,1,20,22,51,50,54,53,52,38,35,34,6,5,20,6,7,39,54,54,53,52,38,38,35,34,6,
+6,21,20,22,51,50,54,55,6,6,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,
+52,54,54,51,50,22,22,2,49,48,38,37,49,49,37,38,48,2,156,113,131,53,74,63,
+99,179,111,111,177,99,138,110,89,114,10,19,73,37,73,89,99,83,111,131,187,
+159,188,222,137,252,160,155,254,140,1,164,37,47,47,37,38,50,50,30,111,212,
+117,53,93,184,112,123,187,102,100,186,122,164,198,125,106,23,28,88,80,77,
+95,151,124,149,186,243,203,145,230,127,131,230,0,2,0,90,0,0,4,188,5,18,0,
+11,0,65,0,0,1,20,22,51,50,54,53,52,38,35,34,6,1,52,38,38,39,55,22,22,21,17,
+20,22,51,33,50,54,53,53,52,38,39,7,39,6,21,54,54,51,50,22,21,20,6,35,34,38,
+53,52,54,55,23,55,30,2,21,17,20,6,35,33,34,38,53,2,82,48,38,37,49,49,37,38,
+48,254,78,12,22,36,53,101,84,97,105,1,56,104,98,35,28,143,146,108,18,63,37,
+73,89,97,85,106,125,135,116,136,135,86,104,49,151,154,254,70,154,151,2,4,
+37,47,47,37,38,50,50,1,243,42,58,46,48,51,62,156,103,253,180,164,135,132,
+167,232,78,114,12,127,129,26,166,23,30,90,78,77,95,139,123,126,173,23,123,
+123,12,73,118,111,254,248,181,173,172,182,0,2,0,127,255,236,4,209,3,162,0,
+11,0,53,0,0,37,52,38,35,34,6,21,20,22,51,50,54,1,16,7,39,54,17,52,38,35,34,
+3,7,35,39,2,35,34,6,21,20,23,52,54,51,50,22,21,20,35,34,38,38,53,52,54,51,
+50,19,18,51,50,22,2,129,50,38,35,49,49,35,38,50,2,80,234,53,125,82,69,133,
+37,5,127,4,37,137,69,82,88,102,76,82,102,207,122,184,99,156,151,198,48,48,
+198,148,159,150,37,44,44,37,39,48,48,1,131,254,210,208,53,158,1,12,183,190,
+254,176,37,37,1,80,190,183,234,83,75,90,86,79,170,114,217,150,232,237,254,
+229,1,27,221,0,0,2,0,127,255,233,4,254,5,31,0,53,0,65,0,0,1,20,6,35,34,38,
+39,22,5,22,23,7,38,38,35,34,7,6,35,34,38,53,52,54,37,62,2,55,51,22,22,21,
+20,6,6,7,4,6,21,20,22,51,50,55,55,38,38,53,52,54,51,50,22,7,52,38,35,34,6,
+21,20,22,51,50,54,4,35,88,76,35,64,20,42,1,1,142,61,47,50,133,69,38,138,139,
+109,203,225,239,1,35,164,191,95,13,62,29,18,89,189,206,255,0,190,155,128,
+80,131,49,87,102,123,101,84,98,98,50,39,35,49,49,35,39,50,1,215,78,92,30,
+23,128,76,42,61,70,26,32,22,23,209,184,163,233,102,56,116,143,115,59,61,26,
+67,107,100,72,90,191,159,131,164,44,13,44,147,86,101,122,92,76,37,47,47,37,
+38,46,46,0,0,3,0,127,255,233,4,254,5,31,0,63,0,75,0,87,0,0,1,20,6,35,34,38,
+39,22,5,22,23,7,38,38,35,34,7,6,35,34,38,53,52,54,55,38,38,53,52,54,51,50,
+22,21,21,7,54,54,55,51,22,22,21,20,6,6,7,6,6,21,20,22,51,50,55,55,38,38,53,
+52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,1,52,38,35,34,6,21,20,22,
+51,50,54,4,35,88,76,35,64,20,42,1,1,142,61,47,50,133,69,38,138,139,109,203,
+225,174,197,29,41,98,88,86,97,2,160,149,16,62,29,18,90,191,205,253,191,155,
+128,80,131,49,87,102,123,101,84,98,98,50,39,35,49,49,35,39,50,254,249,49,
+39,35,49,49,35,39,49,1,215,78,92,30,23,128,76,42,61,70,26,32,22,23,209,184,
+138,211,87,14,72,49,81,89,92,78,10,10,68,169,140,59,61,26,67,107,100,72,89,
+190,161,131,164,44,13,44,147,86,101,122,92,76,37,47,47,37,38,46,46,2,7,38,
+46,46,38,38,46,49,0,0,2,0,100,255,236,4,154,4,211,0,42,0,54,0,0,1,52,54,51,
+50,22,21,20,6,35,34,38,39,22,22,51,50,54,53,52,38,35,34,6,7,38,2,39,55,22,
+23,54,54,51,50,4,21,20,6,35,34,38,38,37,52,38,35,34,6,21,20,22,51,50,54,1,
+63,131,109,82,100,88,75,36,63,20,10,151,107,144,145,196,167,87,183,66,30,
+139,48,187,68,48,46,163,70,220,1,20,235,214,122,188,100,1,68,50,38,35,49,
+49,35,38,50,1,90,111,133,90,80,78,92,30,23,98,133,185,173,168,201,61,54,83,
+1,46,84,82,199,215,28,40,252,207,214,236,95,168,179,37,47,47,37,38,46,46,
+0,2,0,76,255,236,5,55,5,18,0,59,0,71,0,0,1,52,54,55,23,7,6,21,17,20,6,35,
+35,17,52,38,35,34,6,6,7,7,35,46,2,35,34,6,21,20,22,23,54,51,50,22,21,20,6,
+35,32,17,52,54,51,50,22,23,54,54,51,50,22,22,21,17,50,54,53,5,52,38,35,34,
+6,21,20,22,51,50,54,4,74,82,102,53,26,43,146,153,166,44,55,37,47,28,12,5,
+112,15,25,39,32,64,50,15,13,44,118,81,103,99,97,254,174,123,139,77,87,16,
+14,106,95,89,97,42,72,65,253,182,50,38,35,49,49,35,38,50,3,209,104,154,63,
+51,36,60,98,253,69,181,173,1,236,193,155,46,94,118,41,153,99,47,149,208,89,
+144,21,90,93,76,81,89,1,225,247,222,98,125,116,107,89,197,183,254,141,123,
+135,196,37,47,47,37,39,50,50,0,0,2,0,127,255,246,4,236,5,31,0,56,0,68,0,0,
+1,20,6,35,34,38,38,39,38,39,6,7,34,38,53,52,54,37,62,2,55,51,22,22,21,20,
+6,6,7,4,6,21,20,22,23,54,54,55,22,23,22,51,50,54,55,6,6,35,34,38,53,52,54,
+51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,4,236,138,106,40,78,77,78,73,27,
+35,67,199,215,239,1,35,164,191,95,13,62,29,18,89,192,200,255,0,193,111,90,
+36,55,5,98,128,117,71,48,67,10,20,62,35,76,88,97,85,110,114,254,204,50,38,
+35,49,49,35,38,50,1,49,135,180,27,43,59,53,8,108,82,204,189,163,233,102,56,
+116,143,115,59,61,26,67,108,101,70,89,193,158,110,153,22,51,152,53,22,101,
+94,78,72,23,31,93,77,77,93,139,29,38,46,46,38,38,46,46,0,0,2,0,127,255,236,
+5,8,4,182,0,11,0,60,0,0,37,52,38,35,34,6,21,20,22,51,50,54,3,34,6,21,20,23,
+52,54,51,50,22,21,20,35,34,38,38,53,52,54,51,50,22,23,54,55,22,22,23,54,54,
+53,23,20,2,7,38,38,39,6,7,22,23,1,35,3,46,2,2,129,50,38,35,49,49,35,38,50,
+201,70,81,88,102,76,82,102,207,117,185,103,149,158,76,125,43,89,28,56,125,
+42,47,51,172,147,152,29,122,33,25,41,43,43,1,25,188,193,90,80,70,150,37,44,
+44,37,39,48,48,2,217,190,167,249,84,75,90,86,79,170,122,228,153,224,223,54,
+45,67,69,24,108,57,49,228,151,39,172,254,236,94,48,135,21,38,37,69,91,253,
+174,1,178,205,141,60,0,3,0,45,0,0,5,4,4,102,0,4,0,16,0,39,0,0,33,17,51,17,
+7,1,20,22,51,50,54,53,52,38,35,34,6,37,17,7,35,17,6,6,35,34,38,53,52,54,51,
+50,22,21,20,6,7,54,54,55,4,92,168,100,251,239,48,42,38,51,51,38,42,48,3,21,
+101,67,121,232,118,118,130,102,86,88,97,34,22,139,209,62,4,102,252,17,119,
+3,131,38,48,48,38,42,46,46,185,252,17,119,3,143,116,105,112,99,81,91,91,81,
+42,69,16,32,184,136,0,2,0,88,255,242,7,18,3,131,0,53,0,65,0,0,1,21,7,7,35,
+3,3,35,3,14,3,35,34,38,53,52,54,51,50,22,21,20,6,35,34,38,53,52,54,51,50,
+22,23,52,38,38,35,34,6,21,20,22,51,50,18,19,51,19,19,51,19,55,5,20,22,51,
+50,54,53,52,38,35,34,6,7,18,237,113,16,123,150,16,149,50,98,118,144,88,194,
+226,205,170,136,165,117,106,81,102,88,76,35,64,20,44,79,53,113,125,159,140,
+162,217,86,23,160,143,20,129,103,251,166,48,42,37,51,51,37,42,48,2,2,55,47,
+222,1,13,254,164,1,112,152,173,110,58,247,207,210,249,173,146,133,150,91,
+79,78,92,30,23,58,105,60,193,176,168,190,1,36,1,89,254,108,1,70,254,233,199,
+94,38,48,48,38,42,46,46,0,1,254,158,6,240,255,96,8,90,0,3,0,0,1,51,3,35,254,
+158,194,41,112,8,90,254,150,0,0,2,253,66,6,240,255,223,8,168,0,25,0,37,0,
+0,1,20,6,7,50,54,54,55,23,2,33,35,39,54,54,55,6,35,34,38,53,52,54,51,50,22,
+7,20,22,51,50,54,53,52,38,35,34,6,254,102,70,57,101,131,82,39,151,78,254,
+111,119,28,62,86,11,32,54,55,61,74,57,77,84,217,33,25,23,30,30,23,25,33,8,
+10,54,114,35,65,131,165,51,254,123,71,34,84,42,39,66,57,62,63,86,37,25,30,
+30,25,25,30,30,0,0,2,252,139,6,240,255,215,8,168,0,35,0,47,0,0,1,20,7,54,
+54,55,23,6,6,35,54,54,53,52,38,39,7,39,6,21,54,51,50,22,21,20,6,35,34,38,
+53,52,55,23,55,22,5,52,38,35,34,6,21,20,22,51,50,54,254,174,27,63,82,27,152,
+47,214,187,22,29,25,41,104,109,78,31,55,48,69,74,57,76,86,176,101,98,172,
+254,182,29,26,25,30,30,25,26,29,7,209,71,58,27,167,150,51,202,187,40,115,
+47,45,71,26,92,94,46,91,38,59,63,60,65,109,91,176,64,90,90,65,250,24,29,29,
+24,26,30,30,0,0,1,254,55,6,240,255,162,8,88,0,11,0,0,1,53,51,53,51,21,51,
+21,35,21,35,53,254,55,131,101,131,131,101,7,115,98,131,131,98,131,131,0,0,
+2,252,213,6,227,0,4,8,238,0,20,0,32,0,0,1,20,6,35,34,38,53,52,54,55,62,2,
+55,51,14,2,7,7,22,5,20,22,51,50,54,53,52,38,35,34,6,254,74,97,88,86,102,137,
+164,133,140,65,8,168,20,108,236,106,23,51,254,233,51,43,39,54,54,39,43,51,
+7,133,72,90,92,80,90,91,14,12,34,55,55,122,98,23,2,1,48,55,43,49,49,43,41,
+50,50,0,0,16,0,102,0,90,4,91,4,78,0,7,0,15,0,23,0,31,0,39,0,47,0,55,0,63,
+0,71,0,79,0,87,0,95,0,103,0,111,0,119,0,127,0,0,1,20,35,34,53,52,51,50,39,
+20,35,34,53,52,51,50,19,20,35,34,53,52,51,50,23,20,35,34,53,52,51,50,1,20,
+35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,1,20,35,34,
+53,52,51,50,1,20,35,34,53,52,51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,
+51,50,7,20,35,34,53,52,51,50,1,20,35,34,53,52,51,50,37,20,35,34,53,52,51,
+50,19,20,35,34,53,52,51,50,39,20,35,34,53,52,51,50,3,212,48,52,52,48,148,
+48,52,52,48,247,51,49,51,49,36,48,52,52,48,254,55,50,50,50,50,173,51,49,49,
+51,2,82,51,49,49,51,253,26,50,50,50,50,2,131,48,52,52,48,148,48,52,52,48,
+253,174,48,52,50,50,36,48,52,52,48,1,200,50,50,50,50,254,92,50,50,50,50,247,
+51,49,49,51,148,50,50,50,50,3,150,50,50,50,48,49,49,51,254,215,51,51,49,223,
+50,50,50,1,151,51,51,49,86,49,49,51,253,123,49,49,51,1,189,50,47,53,253,72,
+49,49,51,149,48,48,52,2,32,51,51,49,223,50,50,50,254,7,51,51,49,232,49,49,
+51,254,217,52,48,52,46,49,49,51,0,0,1,255,202,254,173,0,54,6,77,0,3,0,0,3,
+17,51,17,54,108,254,173,7,160,248,96,0,1,254,213,254,174,1,43,6,77,0,14,0,
+0,19,23,7,39,17,35,17,7,39,55,39,55,23,55,23,74,225,75,170,108,170,75,225,
+225,75,224,224,75,5,43,220,73,169,249,255,6,1,169,73,220,217,73,220,220,74,
+0,0,1,0,61,3,115,1,141,5,182,0,23,0,0,1,20,14,2,7,53,54,54,53,52,46,4,53,
+52,54,51,50,30,2,1,141,36,81,127,92,101,94,22,34,38,34,22,77,57,32,56,44,
+25,5,4,65,122,104,83,27,86,32,92,60,20,27,21,20,28,41,31,59,62,23,45,67,0,
+0,1,0,25,2,7,1,245,2,116,0,3,0,0,1,33,53,33,1,245,254,36,1,220,2,7,109,0,
+0,1,252,39,4,217,255,0,5,211,0,31,0,0,1,50,62,2,55,51,14,3,35,34,46,2,35,
+34,14,2,7,35,62,3,51,50,30,2,254,64,30,37,21,9,3,92,3,24,55,78,55,55,89,77,
+67,33,31,36,21,10,3,92,4,26,53,79,55,55,89,77,67,5,82,18,31,39,21,47,76,67,
+40,40,49,40,18,30,39,21,47,74,68,40,40,49,40,0,0,1,252,67,254,239,255,9,255,
+94,0,3,0,0,3,33,53,33,247,253,58,2,198,254,239,111,0,1,250,131,254,239,255,
+9,255,94,0,3,0,0,3,33,53,33,247,251,122,4,134,254,239,111,0,0,0,0,0,15,0,
+186,0,3,0,1,4,9,0,0,0,94,0,0,0,3,0,1,4,9,0,1,0,30,0,94,0,3,0,1,4,9,0,2,0,
+14,0,124,0,3,0,1,4,9,0,3,0,68,0,138,0,3,0,1,4,9,0,4,0,30,0,94,0,3,0,1,4,9,
+0,5,0,30,0,206,0,3,0,1,4,9,0,6,0,26,0,236,0,3,0,1,4,9,0,7,0,68,1,6,0,3,0,
+1,4,9,0,8,0,42,1,74,0,3,0,1,4,9,0,9,0,40,1,116,0,3,0,1,4,9,0,10,0,96,1,156,
+0,3,0,1,4,9,0,11,0,62,1,252,0,3,0,1,4,9,0,12,0,60,2,58,0,3,0,1,4,9,0,13,2,
+150,2,118,0,3,0,1,4,9,0,14,0,52,5,12,0,67,0,111,0,112,0,121,0,114,0,105,0,
+103,0,104,0,116,0,32,0,50,0,48,0,49,0,50,0,32,0,71,0,111,0,111,0,103,0,108,
+0,101,0,32,0,73,0,110,0,99,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,
+0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,
+0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,84,0,104,
+0,97,0,105,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,
+0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,
+0,45,0,32,0,78,0,111,0,116,0,111,0,32,0,83,0,101,0,114,0,105,0,102,0,32,0,
+84,0,104,0,97,0,105,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,
+46,0,48,0,52,0,32,0,117,0,104,0,78,0,111,0,116,0,111,0,83,0,101,0,114,0,105,
+0,102,0,84,0,104,0,97,0,105,0,78,0,111,0,116,0,111,0,32,0,105,0,115,0,32,
+0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,
+0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,73,0,110,0,99,0,46,0,
+77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,
+105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,
+121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,
+97,0,109,0,68,0,97,0,116,0,97,0,32,0,117,0,110,0,104,0,105,0,110,0,116,0,
+101,0,100,0,46,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,
+98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,
+101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,
+0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,
+0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,
+0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,
+0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,
+0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,
+0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,
+0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,
+79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,
+0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,
+0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,
+0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,
+0,100,0,105,0,115,0,116,0,114,0,105,0,98,0,117,0,116,0,101,0,100,0,32,0,111,
+0,110,0,32,0,97,0,110,0,32,0,34,0,65,0,83,0,32,0,73,0,83,0,34,0,32,0,66,0,
+65,0,83,0,73,0,83,0,44,0,32,0,87,0,73,0,84,0,72,0,79,0,85,0,84,0,32,0,87,
+0,65,0,82,0,82,0,65,0,78,0,84,0,73,0,69,0,83,0,32,0,79,0,82,0,32,0,67,0,79,
+0,78,0,68,0,73,0,84,0,73,0,79,0,78,0,83,0,32,0,79,0,70,0,32,0,65,0,78,0,89,
+0,32,0,75,0,73,0,78,0,68,0,44,0,32,0,101,0,105,0,116,0,104,0,101,0,114,0,
+32,0,101,0,120,0,112,0,114,0,101,0,115,0,115,0,32,0,111,0,114,0,32,0,105,
+0,109,0,112,0,108,0,105,0,101,0,100,0,46,0,32,0,83,0,101,0,101,0,32,0,116,
+0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,
+0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,102,0,111,
+0,114,0,32,0,116,0,104,0,101,0,32,0,115,0,112,0,101,0,99,0,105,0,102,0,105,
+0,99,0,32,0,108,0,97,0,110,0,103,0,117,0,97,0,103,0,101,0,44,0,32,0,112,0,
+101,0,114,0,109,0,105,0,115,0,115,0,105,0,111,0,110,0,115,0,32,0,97,0,110,
+0,100,0,32,0,108,0,105,0,109,0,105,0,116,0,97,0,116,0,105,0,111,0,110,0,115,
+0,32,0,103,0,111,0,118,0,101,0,114,0,110,0,105,0,110,0,103,0,32,0,121,0,111,
+0,117,0,114,0,32,0,117,0,115,0,101,0,32,0,111,0,102,0,32,0,116,0,104,0,105,
+0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,
+0,114,0,101,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,
+0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,
+0,79,0,70,0,76,0,0,0,2,0,0,0,0,0,0,255,102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,108,0,0,1,2,0,2,0,3,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,
+11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,
+1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,
+1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,
+1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,
+1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,
+1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,
+1,101,1,102,1,103,1,104,1,105,1,106,4,110,117,108,108,7,117,110,105,48,69,
+48,49,7,117,110,105,48,69,48,50,7,117,110,105,48,69,48,51,7,117,110,105,48,
+69,48,52,7,117,110,105,48,69,48,53,7,117,110,105,48,69,48,54,7,117,110,105,
+48,69,48,55,7,117,110,105,48,69,48,56,7,117,110,105,48,69,48,57,7,117,110,
+105,48,69,48,65,7,117,110,105,48,69,48,66,7,117,110,105,48,69,48,67,7,117,
+110,105,48,69,48,68,12,117,110,105,48,69,48,68,46,97,108,116,49,7,117,110,
+105,48,69,48,69,7,117,110,105,48,69,48,70,7,117,110,105,48,69,49,48,12,117,
+110,105,48,69,49,48,46,97,108,116,49,7,117,110,105,48,69,49,49,7,117,110,
+105,48,69,49,50,7,117,110,105,48,69,49,51,7,117,110,105,48,69,49,52,7,117,
+110,105,48,69,49,53,7,117,110,105,48,69,49,54,7,117,110,105,48,69,49,55,7,
+117,110,105,48,69,49,56,7,117,110,105,48,69,49,57,7,117,110,105,48,69,49,
+65,7,117,110,105,48,69,49,66,7,117,110,105,48,69,49,67,7,117,110,105,48,69,
+49,68,7,117,110,105,48,69,49,69,7,117,110,105,48,69,49,70,7,117,110,105,48,
+69,50,48,7,117,110,105,48,69,50,49,7,117,110,105,48,69,50,50,7,117,110,105,
+48,69,50,51,7,117,110,105,48,69,50,52,7,117,110,105,48,69,50,53,7,117,110,
+105,48,69,50,54,7,117,110,105,48,69,50,55,7,117,110,105,48,69,50,56,7,117,
+110,105,48,69,50,57,7,117,110,105,48,69,50,65,7,117,110,105,48,69,50,66,7,
+117,110,105,48,69,50,67,7,117,110,105,48,69,50,68,7,117,110,105,48,69,50,
+69,7,117,110,105,48,69,50,70,7,117,110,105,48,69,51,48,7,117,110,105,48,69,
+51,49,7,117,110,105,48,69,51,50,7,117,110,105,48,69,51,51,7,117,110,105,48,
+69,51,52,7,117,110,105,48,69,51,53,7,117,110,105,48,69,51,54,7,117,110,105,
+48,69,51,55,7,117,110,105,48,69,51,56,7,117,110,105,48,69,51,57,7,117,110,
+105,48,69,51,65,7,117,110,105,48,69,51,70,7,117,110,105,48,69,52,48,7,117,
+110,105,48,69,52,49,7,117,110,105,48,69,52,50,7,117,110,105,48,69,52,51,7,
+117,110,105,48,69,52,52,7,117,110,105,48,69,52,53,7,117,110,105,48,69,52,
+54,7,117,110,105,48,69,52,55,7,117,110,105,48,69,52,56,7,117,110,105,48,69,
+52,57,7,117,110,105,48,69,52,65,7,117,110,105,48,69,52,66,7,117,110,105,48,
+69,52,67,7,117,110,105,48,69,52,68,7,117,110,105,48,69,52,69,7,117,110,105,
+48,69,52,70,7,117,110,105,48,69,53,48,7,117,110,105,48,69,53,49,7,117,110,
+105,48,69,53,50,7,117,110,105,48,69,53,51,7,117,110,105,48,69,53,52,7,117,
+110,105,48,69,53,53,7,117,110,105,48,69,53,54,7,117,110,105,48,69,53,55,7,
+117,110,105,48,69,53,56,7,117,110,105,48,69,53,57,7,117,110,105,48,69,53,
+65,7,117,110,105,48,69,53,66,13,117,110,105,48,69,52,56,46,115,109,97,108,
+108,13,117,110,105,48,69,52,57,46,115,109,97,108,108,13,117,110,105,48,69,
+52,65,46,115,109,97,108,108,13,117,110,105,48,69,52,66,46,115,109,97,108,
+108,13,117,110,105,48,69,52,67,46,115,109,97,108,108,7,117,110,105,50,48,
+48,66,7,117,110,105,50,53,67,67,7,117,110,105,70,69,70,70,7,117,110,105,50,
+48,48,67,7,117,110,105,50,48,48,68,7,117,110,105,48,50,66,67,7,117,110,105,
+48,50,68,55,7,117,110,105,48,51,48,51,7,117,110,105,48,51,51,49,11,117,110,
+105,48,51,51,49,46,97,108,116,0,0,1,0,3,0,8,0,10,0,17,0,7,255,255,0,15,0,
+1,0,0,0,12,0,0,0,76,0,84,0,2,0,10,0,0,0,53,0,1,0,54,0,54,0,3,0,55,0,56,0,
+1,0,57,0,63,0,3,0,64,0,71,0,1,0,72,0,79,0,3,0,80,0,92,0,1,0,93,0,97,0,3,0,
+98,0,104,0,1,0,105,0,107,0,3,0,4,0,0,0,1,0,0,0,2,0,6,0,54,0,54,0,2,0,57,0,
+60,0,2,0,61,0,63,0,1,0,72,0,79,0,2,0,93,0,97,0,2,0,106,0,107,0,1,0,1,0,0,
+0,10,0,32,0,60,0,1,116,104,97,105,0,8,0,4,0,0,0,0,255,255,0,2,0,0,0,1,0,2,
+109,97,114,107,0,14,109,107,109,107,0,20,0,0,0,1,0,0,0,0,0,2,0,1,0,2,0,3,
+0,8,0,16,0,24,0,4,0,0,0,1,0,24,0,6,2,6,0,1,1,138,0,6,1,0,0,1,2,72,0,1,1,60,
+1,88,0,2,0,12,0,90,0,19,0,0,3,162,0,0,2,202,0,0,2,202,0,0,2,202,0,0,2,202,
+0,1,3,186,0,1,3,186,0,1,3,186,0,0,2,208,0,0,2,202,0,0,3,168,0,0,3,168,0,0,
+3,174,0,0,3,180,0,0,3,174,0,0,2,214,0,0,4,38,0,1,2,202,0,1,2,202,0,56,2,142,
+2,142,2,148,2,148,2,148,2,148,2,154,2,154,2,154,2,154,2,160,2,160,2,166,2,
+166,2,172,2,172,2,178,2,178,2,184,2,148,2,184,2,148,2,190,2,190,2,196,3,114,
+2,196,2,196,2,202,3,120,2,202,3,120,2,208,3,126,2,208,2,208,2,214,2,214,2,
+220,2,220,2,220,2,220,2,154,2,154,2,154,2,154,2,226,2,226,2,232,2,232,2,178,
+2,178,2,238,2,238,2,244,2,244,3,12,2,244,2,250,2,250,3,42,2,232,3,0,3,0,3,
+6,3,0,2,202,2,202,2,226,2,226,3,6,3,6,3,12,3,12,2,142,3,132,2,226,2,226,2,
+202,3,138,3,18,3,18,3,24,2,154,2,244,2,244,3,30,2,226,2,232,2,232,3,36,3,
+0,2,226,2,226,3,30,2,226,3,48,3,48,3,18,3,18,3,54,3,144,3,60,3,150,3,66,3,
+156,3,72,3,162,3,78,3,168,2,244,2,244,0,2,0,4,0,54,0,54,0,0,0,57,0,63,0,1,
+0,72,0,79,0,8,0,105,0,107,0,16,0,2,0,5,0,4,0,51,0,0,0,53,0,53,0,48,0,55,0,
+55,0,49,0,65,0,69,0,50,0,99,0,99,0,55,0,1,0,130,0,164,0,1,0,12,0,90,0,19,
+0,0,2,142,0,0,1,8,0,0,1,8,0,0,1,8,0,0,1,8,0,0,1,14,0,0,2,154,0,0,2,160,0,
+0,2,166,0,0,2,154,0,0,2,166,0,0,2,148,0,0,1,14,0,0,1,26,0,0,1,92,0,0,2,130,
+0,0,1,20,0,0,2,136,0,0,1,20,0,19,0,210,0,198,0,198,0,198,0,198,0,198,0,204,
+0,198,0,198,0,198,0,216,0,222,0,204,0,228,0,234,0,234,0,240,0,246,0,198,0,
+2,0,5,0,54,0,54,0,0,0,57,0,60,0,1,0,72,0,79,0,5,0,93,0,97,0,13,0,105,0,105,
+0,18,0,2,0,5,0,54,0,54,0,0,0,57,0,60,0,1,0,72,0,79,0,5,0,93,0,97,0,13,0,105,
+0,105,0,18,0,1,0,46,0,62,0,1,0,12,0,34,0,5,0,0,0,78,0,0,0,78,0,0,0,78,0,0,
+0,78,0,0,0,78,0,5,0,44,0,44,0,110,0,56,0,56,0,2,0,2,0,61,0,63,0,0,0,106,0,
+107,0,3,0,2,0,2,0,61,0,63,0,0,0,106,0,107,0,3,0,1,0,0,253,248,0,1,0,100,253,
+248,0,1,0,0,0,0,0,1,0,20,0,0,0,1,0,30,0,0,0,1,0,0,0,50,0,1,0,0,255,176,0,
+1,0,20,1,194,0,1,0,0,2,8,0,1,0,0,1,194,0,1,0,0,2,58,0,1,0,0,254,192,0,1,255,
+86,0,0,0,1,255,96,0,0,0,1,255,136,0,0,0,1,4,36,0,0,0,1,4,106,0,0,0,1,4,96,
+0,0,0,1,4,116,0,0,0,1,3,37,0,0,0,1,4,0,0,0,0,1,4,6,0,0,0,1,4,106,0,60,0,1,
+6,34,0,0,0,1,6,4,0,0,0,1,4,156,0,0,0,1,3,242,0,0,0,1,5,60,0,0,0,1,6,64,0,
+0,0,1,4,26,0,0,0,1,4,136,0,0,0,1,3,222,0,0,0,1,4,76,0,0,0,1,4,146,0,0,0,1,
+4,246,0,0,0,1,3,192,0,0,0,1,3,12,0,0,0,1,3,62,0,0,0,1,4,96,0,60,0,1,4,26,
+0,60,0,1,4,246,1,44,0,1,3,72,0,0,0,1,3,152,0,0,0,1,1,104,0,0,0,1,3,122,0,
+0,0,1,3,12,3,132,0,1,3,32,3,132,0,1,2,238,3,132,0,1,255,36,0,0,0,1,254,192,
+0,0,0,1,255,76,0,0,0,1,253,218,0,0,0,1,255,71,0,0,0,1,6,4,254,112,0,1,4,156,
+253,248,0,1,3,242,254,12,0,1,4,36,254,12,0,1,4,156,254,12,0,1,1,244,0,0,0,
+1,4,16,0,0,0,1,2,208,0,0,0,1,2,238,0,0,0,1,3,92,0,0,0,1,255,156,0,0,0,1,255,
+6,0,0,0,1,0,30,253,248,0,1,0,0,254,2,0,1,0,20,253,218,0,1,255,136,253,218,
+0,1,0,0,253,218,0,1,255,41,0,0,0,1,0,0,0,10,0,30,0,56,0,1,116,104,97,105,
+0,8,0,4,0,0,0,0,255,255,0,1,0,0,0,1,99,99,109,112,0,8,0,0,0,7,0,0,0,1,0,2,
+0,3,0,4,0,5,0,6,0,12,0,26,0,34,0,42,0,50,0,58,0,66,0,74,0,82,0,90,0,98,0,
+106,0,114,0,6,1,0,0,1,0,96,0,2,0,0,0,1,0,128,0,1,0,0,0,1,0,140,0,6,0,0,0,
+1,0,158,0,6,0,0,0,1,0,206,0,6,0,0,0,1,0,238,0,6,0,0,0,1,1,4,0,1,1,0,0,1,1,
+36,0,1,0,0,0,1,1,42,0,1,0,0,0,1,1,60,0,1,0,0,0,1,1,66,0,1,0,0,0,1,1,72,0,
+3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,7,0,1,0,1,0,16,0,2,0,2,0,61,0,63,0,0,0,
+106,0,107,0,3,0,1,0,14,0,1,0,8,0,2,0,78,0,55,0,1,0,1,0,56,0,2,0,16,0,5,0,
+73,0,74,0,75,0,76,0,77,0,2,0,1,0,93,0,97,0,0,0,3,0,1,0,28,0,1,0,18,0,0,0,
+1,0,0,0,8,0,2,0,1,0,73,0,77,0,0,0,2,0,4,0,54,0,54,0,0,0,57,0,60,0,1,0,72,
+0,79,0,5,0,93,0,97,0,13,0,3,0,0,0,1,0,18,0,1,0,24,0,1,0,0,0,9,0,1,0,1,0,20,
+0,2,0,2,0,61,0,63,0,0,0,106,0,107,0,3,0,3,0,1,0,24,0,1,0,18,0,0,0,1,0,0,0,
+10,0,1,0,1,0,106,0,1,0,1,0,17,0,3,0,1,0,24,0,1,0,18,0,0,0,1,0,0,0,11,0,1,
+0,1,0,106,0,2,0,2,0,15,0,15,0,0,0,23,0,24,0,1,0,2,0,8,0,1,0,17,0,1,0,1,0,
+16,0,2,0,16,0,5,0,93,0,94,0,95,0,96,0,97,0,2,0,1,0,73,0,77,0,0,0,2,0,8,0,
+1,0,21,0,1,0,1,0,20,0,2,0,8,0,1,0,107,0,1,0,1,0,106,0,2,0,8,0,1,0,107,0,1,
+0,1,0,106,};
+#endif
@@ -0,0 +1,784 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#if !defined(__ICC)
+#define HAVE_INCBIN
+#endif
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+const int fz_font_StandardSymbolsPS_cff_size = 16009;
+asm(".section .rodata");
+asm(".global fz_font_StandardSymbolsPS_cff");
+asm(".type fz_font_StandardSymbolsPS_cff STT_OBJECT");
+asm(".size fz_font_StandardSymbolsPS_cff, 16009");
+asm(".balign 64");
+asm("fz_font_StandardSymbolsPS_cff:");
+asm(".incbin \"resources/fonts/urw/StandardSymbolsPS.cff\"");
+#else
+const int fz_font_StandardSymbolsPS_cff_size = 16009;
+const char fz_font_StandardSymbolsPS_cff[] = {
+1,0,4,2,0,1,1,1,18,83,116,97,110,100,97,114,100,83,121,109,98,111,108,115,
+80,83,0,1,1,1,59,248,173,0,248,174,1,248,175,12,0,248,176,2,248,176,3,248,
+24,4,251,121,12,3,185,12,4,251,72,251,185,250,214,250,134,5,29,0,76,158,155,
+13,28,6,134,15,28,6,249,16,28,7,3,17,187,28,57,239,18,0,150,2,0,1,0,10,0,
+21,0,29,0,41,0,50,0,55,0,59,0,62,0,67,0,74,0,77,0,82,0,85,0,89,0,95,0,100,
+0,106,0,108,0,110,0,117,0,119,0,124,0,127,0,132,0,135,0,142,0,148,0,153,0,
+155,0,158,0,162,0,171,0,184,0,193,0,198,0,202,0,205,0,210,0,217,0,220,0,225,
+0,228,0,232,0,236,0,241,0,247,0,249,1,0,1,2,1,7,1,10,1,15,1,18,1,25,1,31,
+1,36,1,38,1,41,1,45,1,52,1,57,1,61,1,69,1,75,1,84,1,92,1,96,1,103,1,108,1,
+113,1,122,1,131,1,138,1,148,1,157,1,163,1,175,1,187,1,198,1,206,1,217,1,228,
+1,239,1,251,2,9,2,14,2,22,2,30,2,41,2,55,2,65,2,73,2,85,2,90,2,104,2,118,
+2,127,2,139,2,151,2,158,2,168,2,173,2,181,2,194,2,208,2,222,2,229,2,236,2,
+243,2,253,3,6,3,18,3,30,3,40,3,53,3,65,3,72,3,81,3,93,3,106,3,119,3,128,3,
+139,3,150,3,161,3,174,3,187,3,200,3,211,3,223,3,234,3,241,3,251,4,3,4,13,
+4,23,4,33,4,45,4,57,4,69,4,83,4,97,4,111,4,123,4,136,4,148,4,152,4,187,4,
+232,4,251,117,110,105,118,101,114,115,97,108,101,120,105,115,116,101,110,
+116,105,97,108,115,117,99,104,116,104,97,116,97,115,116,101,114,105,115,107,
+109,97,116,104,99,111,110,103,114,117,101,110,116,65,108,112,104,97,66,101,
+116,97,67,104,105,68,101,108,116,97,69,112,115,105,108,111,110,80,104,105,
+71,97,109,109,97,69,116,97,73,111,116,97,116,104,101,116,97,49,75,97,112,
+112,97,76,97,109,98,100,97,77,117,78,117,79,109,105,99,114,111,110,80,105,
+84,104,101,116,97,82,104,111,83,105,103,109,97,84,97,117,85,112,115,105,108,
+111,110,115,105,103,109,97,49,79,109,101,103,97,88,105,80,115,105,90,101,
+116,97,116,104,101,114,101,102,111,114,101,112,101,114,112,101,110,100,105,
+99,117,108,97,114,114,97,100,105,99,97,108,101,120,97,108,112,104,97,98,101,
+116,97,99,104,105,100,101,108,116,97,101,112,115,105,108,111,110,112,104,
+105,103,97,109,109,97,101,116,97,105,111,116,97,112,104,105,49,107,97,112,
+112,97,108,97,109,98,100,97,110,117,111,109,105,99,114,111,110,112,105,116,
+104,101,116,97,114,104,111,115,105,103,109,97,116,97,117,117,112,115,105,
+108,111,110,111,109,101,103,97,49,111,109,101,103,97,120,105,112,115,105,
+122,101,116,97,115,105,109,105,108,97,114,97,112,112,108,101,69,117,114,111,
+85,112,115,105,108,111,110,49,109,105,110,117,116,101,108,101,115,115,101,
+113,117,97,108,105,110,102,105,110,105,116,121,99,108,117,98,100,105,97,109,
+111,110,100,104,101,97,114,116,115,112,97,100,101,97,114,114,111,119,98,111,
+116,104,97,114,114,111,119,108,101,102,116,97,114,114,111,119,117,112,97,
+114,114,111,119,114,105,103,104,116,97,114,114,111,119,100,111,119,110,115,
+101,99,111,110,100,103,114,101,97,116,101,114,101,113,117,97,108,112,114,
+111,112,111,114,116,105,111,110,97,108,112,97,114,116,105,97,108,100,105,
+102,102,110,111,116,101,113,117,97,108,101,113,117,105,118,97,108,101,110,
+99,101,97,112,112,114,111,120,101,113,117,97,108,97,114,114,111,119,118,101,
+114,116,101,120,97,114,114,111,119,104,111,114,105,122,101,120,99,97,114,
+114,105,97,103,101,114,101,116,117,114,110,97,108,101,112,104,73,102,114,
+97,107,116,117,114,82,102,114,97,107,116,117,114,119,101,105,101,114,115,
+116,114,97,115,115,99,105,114,99,108,101,109,117,108,116,105,112,108,121,
+99,105,114,99,108,101,112,108,117,115,101,109,112,116,121,115,101,116,105,
+110,116,101,114,115,101,99,116,105,111,110,117,110,105,111,110,112,114,111,
+112,101,114,115,117,112,101,114,115,101,116,114,101,102,108,101,120,115,117,
+112,101,114,115,101,116,110,111,116,115,117,98,115,101,116,112,114,111,112,
+101,114,115,117,98,115,101,116,114,101,102,108,101,120,115,117,98,115,101,
+116,101,108,101,109,101,110,116,110,111,116,101,108,101,109,101,110,116,97,
+110,103,108,101,103,114,97,100,105,101,110,116,114,101,103,105,115,116,101,
+114,115,101,114,105,102,99,111,112,121,114,105,103,104,116,115,101,114,105,
+102,116,114,97,100,101,109,97,114,107,115,101,114,105,102,112,114,111,100,
+117,99,116,114,97,100,105,99,97,108,100,111,116,109,97,116,104,108,111,103,
+105,99,97,108,97,110,100,108,111,103,105,99,97,108,111,114,97,114,114,111,
+119,100,98,108,98,111,116,104,97,114,114,111,119,100,98,108,108,101,102,116,
+97,114,114,111,119,100,98,108,117,112,97,114,114,111,119,100,98,108,114,105,
+103,104,116,97,114,114,111,119,100,98,108,100,111,119,110,108,111,122,101,
+110,103,101,97,110,103,108,101,108,101,102,116,114,101,103,105,115,116,101,
+114,115,97,110,115,99,111,112,121,114,105,103,104,116,115,97,110,115,116,
+114,97,100,101,109,97,114,107,115,97,110,115,115,117,109,109,97,116,105,111,
+110,112,97,114,101,110,108,101,102,116,116,112,112,97,114,101,110,108,101,
+102,116,101,120,112,97,114,101,110,108,101,102,116,98,116,98,114,97,99,107,
+101,116,108,101,102,116,116,112,98,114,97,99,107,101,116,108,101,102,116,
+101,120,98,114,97,99,107,101,116,108,101,102,116,98,116,98,114,97,99,101,
+108,101,102,116,116,112,98,114,97,99,101,108,101,102,116,109,105,100,98,114,
+97,99,101,108,101,102,116,98,116,98,114,97,99,101,101,120,97,110,103,108,
+101,114,105,103,104,116,105,110,116,101,103,114,97,108,105,110,116,101,103,
+114,97,108,116,112,105,110,116,101,103,114,97,108,101,120,105,110,116,101,
+103,114,97,108,98,116,112,97,114,101,110,114,105,103,104,116,116,112,112,
+97,114,101,110,114,105,103,104,116,101,120,112,97,114,101,110,114,105,103,
+104,116,98,116,98,114,97,99,107,101,116,114,105,103,104,116,116,112,98,114,
+97,99,107,101,116,114,105,103,104,116,101,120,98,114,97,99,107,101,116,114,
+105,103,104,116,98,116,98,114,97,99,101,114,105,103,104,116,116,112,98,114,
+97,99,101,114,105,103,104,116,109,105,100,98,114,97,99,101,114,105,103,104,
+116,98,116,50,46,48,48,85,82,87,32,83,111,102,116,119,97,114,101,44,32,67,
+111,112,121,114,105,103,104,116,32,50,48,49,53,32,98,121,32,85,82,87,67,111,
+112,121,114,105,103,104,116,32,85,82,87,32,83,111,102,116,119,97,114,101,
+44,32,67,111,112,121,114,105,103,104,116,32,50,48,49,53,32,98,121,32,85,82,
+87,83,116,97,110,100,97,114,100,32,83,121,109,98,111,108,115,32,80,83,0,0,
+1,0,1,1,1,135,0,0,4,0,1,136,0,0,6,1,1,137,0,0,9,1,1,138,0,0,12,1,0,166,0,
+0,15,17,1,139,26,0,60,0,1,166,0,0,62,0,1,167,0,0,64,0,1,168,12,0,152,0,1,
+181,12,0,92,2,1,194,5,0,99,0,1,200,0,0,101,0,1,201,8,0,161,0,0,156,0,1,210,
+1,0,168,0,1,212,1,0,116,0,0,159,0,1,214,2,0,121,0,1,217,26,0,151,0,1,244,
+36,1,4,32,94,128,0,160,79,241,13,0,191,2,0,1,0,4,0,7,0,47,0,88,0,184,0,209,
+1,134,2,59,2,143,2,213,3,26,4,8,4,14,4,21,4,31,4,40,4,56,4,122,4,182,5,13,
+5,114,5,147,5,233,6,74,6,111,6,215,7,57,7,78,7,101,7,108,7,121,7,126,7,222,
+8,12,8,71,8,174,9,47,9,73,9,137,10,23,10,50,10,77,10,92,11,5,11,100,11,145,
+11,198,12,11,12,18,12,56,12,69,12,159,12,220,13,22,13,99,13,219,14,94,14,
+169,15,60,15,117,15,149,15,170,15,202,15,220,15,232,15,245,16,114,16,240,
+17,103,17,222,18,104,18,224,19,73,19,162,19,232,20,76,20,190,21,46,21,155,
+21,240,22,49,22,166,23,33,23,135,23,210,24,39,24,157,25,10,25,99,26,56,26,
+175,27,58,27,150,27,162,27,253,28,37,28,201,29,71,29,174,29,180,29,187,29,
+202,30,39,30,175,31,49,31,68,31,141,31,229,32,61,32,113,32,166,32,218,33,
+16,33,61,33,75,33,86,33,94,33,137,33,233,34,91,34,116,34,139,34,193,34,210,
+34,235,34,254,35,10,35,23,35,49,35,221,36,148,37,150,38,85,38,200,39,39,39,
+143,39,204,40,11,40,16,40,31,40,105,40,112,40,126,40,180,41,32,41,52,41,81,
+41,187,42,16,42,163,42,225,42,252,43,21,43,36,43,60,43,83,43,161,43,220,44,
+49,44,112,44,192,44,234,45,5,45,115,45,202,46,3,46,64,46,110,46,121,46,165,
+46,179,46,186,46,202,46,234,47,33,47,64,47,78,47,102,47,209,48,16,48,27,48,
+91,48,139,48,152,48,199,48,216,48,225,48,242,49,16,49,73,49,106,252,69,14,
+252,69,14,251,242,247,65,247,78,21,162,6,175,247,248,5,146,203,139,139,153,
+26,180,118,164,104,103,120,114,93,123,139,139,145,83,30,190,252,79,21,36,
+10,14,169,249,61,77,10,86,6,57,251,86,5,252,14,6,54,247,86,5,87,6,247,195,
+253,53,5,196,6,251,92,248,66,21,247,226,6,251,54,252,1,5,14,251,75,248,94,
+247,149,21,45,6,158,247,22,5,237,191,49,6,167,247,84,5,84,6,111,251,84,5,
+251,18,6,167,247,84,5,86,6,110,251,84,5,251,3,85,240,6,122,251,20,5,251,1,
+87,240,6,108,251,97,5,195,6,168,247,97,5,247,18,6,109,251,97,5,194,6,169,
+247,97,5,241,6,251,22,247,74,21,120,251,22,5,251,17,6,157,247,22,5,14,248,
+114,77,10,252,89,88,248,34,251,137,251,245,90,247,245,251,171,252,34,90,248,
+89,6,14,247,42,247,123,22,248,55,249,53,5,86,6,96,114,85,112,77,27,109,118,
+146,163,105,31,167,97,123,146,108,27,251,1,251,2,251,13,251,13,62,188,88,
+214,247,1,235,247,9,247,25,153,138,147,135,155,31,132,159,164,135,165,27,
+174,167,147,158,178,31,252,19,252,239,5,247,74,248,231,21,143,130,140,132,
+117,26,75,121,87,102,94,30,101,107,99,116,104,27,101,115,161,176,234,226,
+247,38,196,144,142,139,138,144,31,157,120,146,134,176,124,8,247,191,251,127,
+21,251,7,251,3,251,13,251,17,68,191,89,212,191,182,160,183,177,31,189,196,
+170,214,203,26,202,94,182,71,30,151,103,21,179,168,107,96,82,111,71,97,93,
+31,109,112,97,120,103,27,105,118,162,177,243,228,247,22,211,31,14,234,248,
+132,248,62,21,119,7,185,136,157,126,108,26,97,99,60,88,80,30,106,173,78,235,
+104,212,175,156,161,151,158,153,8,189,175,166,185,187,26,208,83,190,63,54,
+66,68,56,95,152,88,163,84,30,71,102,125,131,121,127,8,71,90,107,85,74,26,
+43,210,76,246,220,209,169,200,199,30,79,192,198,108,200,27,198,182,172,219,
+184,31,123,152,5,100,110,114,123,107,27,86,91,168,202,85,31,164,169,161,170,
+161,176,146,150,156,169,167,187,149,155,147,150,147,148,156,157,162,149,173,
+144,8,159,7,252,26,126,21,116,185,123,195,176,26,194,168,174,184,186,172,
+103,89,78,103,94,60,102,30,72,65,21,188,41,185,66,191,75,8,97,99,93,117,91,
+27,66,80,203,218,203,182,196,215,174,31,14,251,136,187,145,21,125,173,164,
+134,176,27,210,200,163,187,191,31,193,190,171,207,206,26,247,28,251,17,247,
+14,251,32,117,122,136,131,108,30,102,7,140,157,147,140,150,27,199,197,118,
+104,174,31,175,103,156,102,147,80,8,251,110,91,247,110,6,131,83,124,106,107,
+103,8,101,104,80,115,79,27,115,119,141,146,110,31,14,251,242,247,192,251,
+47,21,105,162,123,154,119,165,8,85,211,108,247,16,247,41,26,247,28,165,247,
+10,185,211,30,161,174,158,158,181,168,126,156,24,93,115,119,125,113,115,8,
+49,56,87,251,26,251,39,26,251,29,184,251,18,219,55,30,170,106,163,122,193,
+110,8,14,251,242,182,251,64,21,185,164,159,152,165,163,8,229,222,191,247,
+27,247,38,26,247,29,94,247,18,59,224,30,107,171,116,157,85,167,126,122,24,
+174,115,154,125,159,113,8,193,67,170,251,16,251,41,26,251,28,113,251,10,93,
+67,30,116,104,119,119,99,111,8,14,251,75,247,51,248,49,21,134,145,135,144,
+135,143,8,165,116,127,147,125,27,122,124,119,118,115,152,129,182,130,31,206,
+124,165,128,124,26,125,112,126,92,128,30,103,131,136,139,131,136,8,120,131,
+130,128,122,26,118,154,119,156,155,146,144,183,178,30,144,145,5,168,165,160,
+154,153,27,146,143,131,125,122,135,122,130,109,31,124,91,139,139,126,26,118,
+154,124,162,162,154,153,161,152,138,142,124,184,30,129,170,136,155,157,26,
+153,143,146,146,153,160,123,111,165,30,144,133,153,124,5,113,162,151,131,
+153,27,156,154,159,161,154,131,150,122,146,31,131,143,136,140,100,147,8,92,
+150,113,152,153,26,154,164,150,206,154,30,181,148,153,150,161,26,161,124,
+159,122,125,126,130,114,117,30,132,131,134,134,137,137,134,134,24,111,114,
+117,123,126,27,131,135,146,153,157,143,156,148,169,31,154,184,140,142,151,
+26,160,124,154,116,116,124,125,117,127,139,139,154,91,30,149,109,142,122,
+121,26,126,135,131,132,125,117,155,167,114,30,14,247,194,248,169,58,10,252,
+69,195,251,12,39,10,150,247,186,21,84,248,160,194,7,14,252,69,247,18,239,
+21,36,10,14,252,41,247,146,77,10,83,6,251,90,253,53,5,195,6,14,251,75,247,
+144,249,66,21,52,76,94,47,99,31,112,78,127,72,54,26,251,104,227,251,29,247,
+28,247,28,227,247,29,247,104,247,102,51,247,32,251,23,30,137,103,21,225,178,
+42,251,106,251,109,100,45,51,49,100,233,247,110,247,110,178,231,231,31,14,
+251,75,248,26,165,21,55,145,126,154,141,234,8,248,167,121,7,104,117,94,115,
+59,100,8,110,7,152,170,158,145,151,27,151,150,132,129,143,31,144,125,139,
+139,141,76,8,251,234,7,140,45,126,123,55,133,8,113,247,165,7,14,251,75,164,
+22,248,32,6,193,247,26,5,114,6,86,108,120,131,53,27,251,84,6,247,97,247,91,
+211,247,5,247,10,26,245,65,216,37,87,97,119,98,105,30,111,106,127,108,129,
+78,8,156,6,150,172,147,154,153,156,8,168,163,175,156,175,27,209,200,70,60,
+44,67,251,18,251,18,251,19,31,64,62,136,137,131,130,126,126,25,14,251,75,
+247,80,247,253,21,114,148,7,192,173,125,105,170,31,167,106,154,99,92,26,59,
+90,84,68,99,116,147,169,98,30,160,109,125,146,123,27,120,123,122,119,100,
+208,103,217,247,29,247,4,243,247,21,214,105,190,62,179,31,208,192,166,184,
+199,26,220,73,200,53,53,87,96,41,105,30,154,130,5,200,176,173,162,192,27,
+202,184,92,73,103,125,104,112,112,31,111,112,95,119,107,27,14,251,75,247,
+180,22,221,247,75,238,203,40,248,69,88,6,251,195,252,69,5,75,247,164,7,248,
+9,4,251,201,251,110,7,14,251,75,248,34,248,232,21,184,234,124,147,123,119,
+128,132,116,140,25,251,78,6,251,7,251,154,199,138,177,129,184,115,25,216,
+98,184,71,65,26,57,80,72,67,109,107,149,159,110,30,164,102,135,141,123,27,
+120,124,123,119,97,200,103,211,247,25,247,5,247,6,247,24,213,106,208,79,188,
+31,100,171,101,156,58,160,183,240,24,14,251,75,248,69,249,65,21,49,95,129,
+103,79,31,251,15,67,59,251,41,251,45,26,251,51,231,251,11,247,15,247,11,236,
+242,247,18,247,11,57,223,251,7,95,96,126,110,95,30,178,247,58,247,7,247,6,
+247,32,149,8,251,195,251,224,21,167,189,164,147,175,27,190,172,118,91,162,
+31,159,100,150,89,92,26,52,95,83,71,52,83,230,247,35,170,141,160,143,165,
+30,14,251,75,248,84,77,10,251,254,6,77,251,56,5,169,6,180,216,155,148,233,
+136,8,247,47,6,251,102,252,219,165,133,143,138,166,130,25,14,251,75,247,88,
+247,226,21,37,73,99,86,68,26,48,220,73,247,5,247,3,220,210,236,210,102,192,
+251,3,227,30,231,190,181,192,199,26,226,59,207,38,34,61,71,47,74,170,94,242,
+57,30,167,119,21,183,100,145,134,160,119,8,191,91,160,101,97,26,83,92,98,
+73,61,93,188,222,197,167,187,204,190,30,181,213,21,44,207,102,185,190,26,
+192,189,183,199,205,187,88,70,82,115,102,71,91,30,14,251,75,185,127,21,138,
+154,151,139,146,27,227,229,178,205,208,31,221,220,190,247,14,247,7,26,203,
+122,204,108,190,30,200,102,77,174,66,27,251,12,50,42,251,24,251,13,218,56,
+247,6,181,167,147,169,197,31,90,251,61,251,13,251,4,251,28,137,8,247,208,
+247,215,21,114,86,111,131,106,27,63,93,217,247,20,228,183,197,205,220,194,
+50,251,24,105,136,114,132,99,31,14,252,41,247,30,239,21,36,10,247,255,4,81,
+10,165,170,169,114,165,109,31,14,252,41,247,48,248,99,21,90,10,171,163,163,
+172,170,115,164,108,31,66,252,219,39,10,248,159,248,158,21,53,10,248,173,
+248,27,21,71,10,251,31,4,71,10,14,165,248,158,56,10,251,131,247,135,247,68,
+21,140,201,155,184,177,186,200,206,139,139,155,163,8,164,176,151,177,179,
+26,227,68,201,37,45,64,77,61,96,162,107,171,163,158,157,162,150,135,150,130,
+151,30,121,163,138,142,153,26,176,176,168,187,199,175,94,63,94,132,118,95,
+50,30,102,64,133,113,137,39,8,158,62,21,107,114,114,108,108,164,114,170,170,
+164,164,170,170,114,164,109,31,14,248,173,247,137,21,71,10,251,27,4,71,10,
+91,248,111,65,10,160,70,31,162,67,114,144,111,27,82,92,112,82,100,31,182,
+105,5,192,184,155,149,177,72,10,204,187,85,10,178,247,245,77,10,127,6,251,
+115,252,167,97,41,132,132,74,128,25,113,247,86,84,10,144,157,157,180,30,169,
+211,5,247,135,6,170,67,5,158,92,143,127,123,63,10,8,251,157,247,251,21,247,
+1,251,138,5,251,107,6,14,123,168,22,247,218,6,197,183,147,157,174,31,203,
+171,175,197,207,26,196,113,184,87,169,30,113,155,115,147,89,149,8,227,154,
+194,194,213,26,204,105,194,79,171,30,158,102,93,147,61,27,251,165,57,10,247,
+85,247,236,21,247,143,7,152,139,139,201,193,162,136,130,161,30,182,122,167,
+93,86,26,55,78,87,39,30,68,101,21,209,6,247,8,200,88,44,43,79,89,251,7,77,
+129,141,153,31,14,178,248,21,22,247,211,165,6,60,144,108,161,86,227,251,34,
+247,121,24,247,12,247,54,204,227,176,162,222,143,25,165,251,143,113,153,7,
+174,154,129,117,125,128,120,100,89,31,45,251,15,61,247,14,5,108,190,131,154,
+153,26,162,158,152,172,30,160,165,251,217,113,6,221,134,171,118,193,50,247,
+28,251,103,24,251,32,251,72,74,52,106,118,60,132,25,113,247,140,165,125,7,
+106,123,149,161,153,139,139,190,208,31,240,247,30,230,251,29,5,164,100,153,
+111,124,26,117,119,127,102,30,123,6,14,68,145,22,248,238,6,251,173,249,68,
+5,251,142,253,17,21,247,105,248,94,247,81,252,94,5,14,67,171,22,248,168,6,
+192,247,65,5,112,6,38,101,95,108,251,3,27,251,22,6,104,138,132,148,182,26,
+247,129,247,34,7,224,140,160,120,142,60,8,164,247,130,114,6,138,60,115,117,
+55,140,8,251,34,247,154,247,57,70,10,252,150,55,10,219,247,130,22,247,184,
+165,6,66,140,113,167,141,213,8,197,163,142,147,177,31,247,8,166,212,214,233,
+26,238,64,216,251,12,165,30,104,146,107,142,92,140,138,209,166,166,210,140,
+8,165,251,184,113,7,210,138,166,112,138,69,92,138,107,136,104,132,8,251,12,
+113,64,62,40,26,45,212,64,247,8,112,30,131,177,163,136,197,27,141,65,113,
+111,66,138,8,236,247,33,21,251,27,147,73,196,247,3,26,199,161,181,188,170,
+30,174,161,172,148,201,144,8,237,22,247,27,131,205,82,251,3,26,79,117,97,
+90,108,30,104,118,106,130,77,133,8,14,59,247,109,249,12,21,247,118,70,10,
+252,211,38,10,247,193,165,129,6,58,144,119,162,142,227,8,14,178,247,124,248,
+0,21,247,59,7,37,10,247,72,247,196,251,72,43,10,251,176,46,10,251,59,7,14,
+251,242,247,208,165,21,49,10,248,25,7,42,10,6,14,87,249,3,247,222,21,120,
+144,129,142,136,140,118,146,125,145,131,141,126,247,39,124,190,92,201,8,186,
+103,97,164,96,27,77,95,90,71,45,219,53,247,36,79,31,140,92,5,251,50,81,38,
+47,103,107,157,167,124,30,129,159,131,175,167,26,158,142,173,144,184,30,150,
+234,139,142,159,26,193,99,179,84,101,113,123,100,113,30,126,120,135,130,120,
+89,8,166,6,192,168,150,151,160,27,165,158,121,114,130,138,126,137,125,31,
+125,32,137,118,102,26,40,205,74,240,246,213,192,243,178,30,159,191,147,186,
+140,195,169,126,164,128,159,131,8,251,45,247,7,21,251,5,182,62,219,215,26,
+180,164,167,176,178,171,108,81,162,30,154,102,146,101,151,35,8,14,178,247,
+120,248,167,21,37,10,247,35,7,179,172,190,88,153,123,228,34,25,188,81,153,
+118,123,26,122,125,131,108,30,106,113,247,207,165,6,79,144,106,161,75,217,
+251,114,247,148,24,182,182,162,164,163,164,163,165,25,247,22,247,29,145,142,
+224,140,8,165,251,163,113,7,183,138,145,139,149,135,8,151,135,147,130,130,
+26,115,251,29,251,42,251,14,251,2,30,14,142,247,205,248,137,21,247,45,251,
+251,5,159,92,142,128,122,63,10,251,127,248,182,24,251,121,252,182,98,44,132,
+131,79,126,25,113,247,80,84,10,145,157,156,180,30,14,247,98,248,60,140,21,
+247,162,248,176,5,252,35,48,10,45,10,248,25,7,136,223,160,166,209,144,8,142,
+165,251,66,6,251,145,252,139,251,137,248,139,5,251,79,38,10,247,118,45,10,
+248,35,7,14,178,247,150,165,21,134,87,10,248,26,7,248,55,252,168,5,184,248,
+167,6,136,223,159,166,208,144,8,144,165,251,116,46,10,252,7,7,252,34,248,
+149,5,251,51,113,143,6,209,135,160,112,136,55,8,252,26,7,143,55,117,110,69,
+136,8,134,113,247,121,6,14,178,248,18,249,66,34,10,224,164,22,247,176,45,
+10,248,14,7,205,141,151,156,154,30,156,156,156,141,247,34,27,247,26,144,135,
+251,0,31,252,14,43,10,253,100,55,10,197,248,141,248,93,40,10,251,15,248,95,
+34,10,251,19,247,229,165,21,124,6,55,144,119,162,142,227,8,247,65,7,131,174,
+180,135,172,27,247,40,224,207,247,12,212,101,198,71,168,31,157,100,108,142,
+251,5,27,251,138,38,10,247,201,6,251,8,248,248,21,158,146,141,214,172,161,
+135,131,158,30,184,119,165,92,79,26,89,121,95,108,114,30,120,116,109,130,
+95,27,114,121,142,148,101,31,14,48,247,59,249,12,21,247,61,6,247,10,138,169,
+117,155,40,8,165,6,129,247,55,5,252,130,6,247,110,251,245,251,127,251,212,
+5,248,166,6,193,247,72,5,113,6,109,60,105,120,251,6,140,8,251,159,6,247,103,
+247,178,5,14,67,248,115,165,21,119,86,10,248,122,213,7,233,140,174,110,147,
+54,8,164,6,128,247,50,5,252,188,6,128,251,50,5,165,6,146,225,173,165,243,
+140,8,204,252,122,6,142,54,118,112,69,135,8,119,113,247,210,6,14,146,248,
+32,247,183,21,247,38,247,132,189,225,166,160,214,148,25,165,251,121,113,150,
+7,179,154,129,114,123,126,108,118,105,31,251,9,251,76,251,6,247,76,5,111,
+184,129,161,155,26,160,158,151,174,30,158,165,251,201,113,6,218,130,165,119,
+190,52,247,38,251,132,24,251,41,48,10,45,10,14,251,136,247,192,248,60,21,
+131,181,139,139,157,27,174,160,153,164,174,94,162,71,251,34,251,13,251,32,
+251,56,251,15,213,46,236,156,201,141,141,164,31,140,149,148,139,144,27,174,
+157,121,105,96,111,105,103,130,139,139,148,114,31,132,141,5,145,120,131,140,
+125,27,104,118,122,110,105,176,110,183,229,214,224,239,184,122,180,110,165,
+31,159,117,117,146,101,27,122,130,139,137,109,31,137,100,123,138,137,27,76,
+90,202,220,241,212,229,222,151,150,138,133,166,31,14,224,247,218,22,121,247,
+47,5,61,183,89,228,233,26,191,154,198,165,186,30,204,175,199,176,207,27,207,
+199,102,74,175,31,165,92,154,80,87,26,45,89,50,61,95,30,121,251,47,5,247,
+184,247,45,115,6,94,131,119,121,98,27,251,38,6,142,177,174,152,161,149,162,
+154,25,216,188,184,220,225,26,206,110,212,91,195,30,209,78,55,177,44,27,44,
+55,101,69,78,31,91,83,110,66,72,26,53,184,58,216,90,30,162,124,161,129,174,
+126,142,101,24,251,38,6,98,119,157,184,131,31,115,251,45,6,14,101,248,196,
+77,10,252,118,6,129,251,60,5,165,6,151,211,152,149,227,141,8,247,117,6,225,
+137,153,129,151,67,8,165,6,140,251,217,21,114,56,117,127,251,18,138,8,251,
+64,6,251,5,117,153,221,114,31,113,6,177,251,72,5,248,118,6,178,247,72,5,251,
+45,247,169,40,10,14,247,4,248,82,247,163,21,219,138,194,148,181,160,8,207,
+171,177,201,218,26,138,223,5,213,151,163,179,147,30,162,7,251,8,130,98,90,
+132,251,30,134,251,0,132,118,96,110,116,124,105,132,81,140,8,247,112,7,140,
+230,157,162,213,141,8,165,251,175,113,7,213,137,157,116,140,48,8,251,112,
+7,90,138,105,144,118,149,87,168,130,162,134,247,5,132,247,30,99,188,251,9,
+148,8,116,7,179,130,151,115,66,26,138,55,5,69,169,82,194,104,30,184,111,199,
+126,232,140,8,251,6,7,39,123,116,66,133,30,120,111,247,205,167,120,6,66,145,
+123,162,239,26,14,67,248,254,77,10,252,138,6,122,251,68,5,165,6,151,247,1,
+167,164,247,10,138,8,247,74,6,252,57,253,10,5,248,191,6,176,247,63,5,113,
+6,130,99,122,109,110,113,107,112,122,135,58,136,8,251,122,6,14,251,242,247,
+191,251,57,21,173,36,7,123,132,145,156,31,249,98,7,163,138,145,144,161,27,
+238,173,251,105,253,218,6,14,247,72,247,118,247,4,44,10,247,96,247,213,44,
+10,247,102,251,213,44,10,14,251,242,172,251,57,21,247,105,249,218,251,105,
+105,238,6,161,144,134,115,31,253,94,7,118,132,132,117,140,30,42,6,14,114,
+247,253,77,10,84,252,253,251,183,83,249,17,195,251,183,6,14,251,75,137,251,
+98,21,93,248,140,185,7,14,251,75,248,116,250,37,21,83,248,246,195,7,14,87,
+248,132,248,136,21,78,251,64,5,247,13,113,78,203,48,27,93,90,120,107,102,
+31,82,91,112,68,40,26,251,52,218,42,247,22,227,204,184,228,180,30,144,120,
+146,121,150,114,8,83,165,156,123,171,27,172,162,160,181,152,31,146,162,142,
+161,140,195,8,113,6,88,137,120,102,114,27,106,106,192,208,127,31,247,5,247,
+207,5,251,71,251,151,21,116,74,5,37,104,99,90,89,27,68,98,221,247,34,213,
+153,199,165,183,31,168,157,162,153,170,27,210,185,82,251,6,159,31,14,218,
+77,21,136,53,134,101,129,103,8,221,6,150,157,144,178,210,26,247,28,7,99,192,
+183,124,197,27,247,12,220,227,247,21,246,86,214,251,2,186,31,215,180,175,
+185,196,26,228,50,213,32,251,0,58,68,44,30,219,149,21,209,180,188,199,202,
+184,81,59,85,112,83,112,135,135,140,142,125,30,142,123,134,140,129,27,115,
+120,124,119,120,156,127,165,146,145,140,140,147,31,142,150,151,140,147,27,
+152,146,137,133,145,31,184,98,166,63,56,26,40,95,80,65,88,90,162,178,105,
+30,14,248,27,248,136,21,251,21,251,129,103,247,41,5,202,124,101,177,90,27,
+79,97,72,251,3,129,31,166,6,199,146,168,178,177,27,164,164,123,115,155,31,
+147,126,148,116,145,112,169,251,15,24,251,110,252,35,5,245,6,247,34,247,157,
+155,51,154,64,142,125,146,120,25,82,160,173,108,180,27,175,175,164,179,161,
+31,156,170,148,176,142,191,8,115,6,129,105,135,129,132,128,8,116,125,115,
+126,113,27,92,114,181,247,15,109,31,120,217,247,95,248,9,5,14,251,81,247,
+148,248,80,21,87,123,108,126,110,119,8,73,94,101,69,64,26,251,11,234,40,247,
+7,200,192,163,189,187,30,186,188,161,194,206,26,204,117,200,98,188,30,105,
+180,116,157,55,189,8,49,193,100,176,172,26,171,170,165,179,171,166,127,113,
+164,30,84,194,148,133,166,27,166,159,157,163,194,52,183,34,45,82,102,77,102,
+155,111,183,98,31,247,18,251,9,21,207,76,170,69,53,26,40,92,73,69,69,91,217,
+247,7,247,0,184,202,230,159,30,14,251,136,248,39,247,17,21,76,118,102,114,
+68,27,90,99,151,163,112,31,119,157,131,158,172,26,198,173,177,192,149,147,
+138,137,149,30,135,154,149,138,149,27,169,161,153,158,154,127,147,116,128,
+139,139,136,110,31,133,6,136,112,136,139,131,27,88,106,174,193,199,181,186,
+191,175,162,123,107,150,31,141,132,5,103,151,156,123,165,27,166,160,161,167,
+192,72,178,45,75,94,125,108,100,31,102,111,123,109,101,26,106,154,108,164,
+121,30,153,130,148,134,170,124,8,65,114,105,98,79,26,53,227,77,247,16,247,
+3,201,180,227,159,30,14,251,54,247,171,132,21,247,16,156,226,247,4,247,33,
+26,247,30,55,236,251,19,149,30,219,7,187,140,147,141,162,30,92,158,5,141,
+116,140,125,87,26,50,7,251,13,125,49,251,6,251,30,26,251,31,225,37,247,17,
+129,30,38,7,80,138,124,137,112,30,186,128,137,172,139,142,138,183,25,166,
+7,98,247,40,21,111,150,119,155,124,162,8,107,188,120,215,218,26,247,5,182,
+209,210,142,30,180,132,21,210,112,182,46,251,20,26,251,11,98,72,66,135,30,
+14,251,164,248,13,248,136,21,251,3,251,236,109,247,47,5,247,44,109,107,189,
+72,27,109,112,126,115,123,31,117,108,134,114,137,55,8,126,161,7,141,166,141,
+155,143,152,8,172,150,162,158,169,27,166,158,122,99,158,31,163,86,165,48,
+149,65,151,56,24,138,134,137,134,137,134,130,111,129,112,130,113,8,119,85,
+133,110,104,26,91,160,109,171,180,166,190,219,171,134,184,127,217,30,247,
+95,248,69,5,14,59,247,11,22,227,248,0,6,194,175,174,163,183,27,196,174,100,
+75,31,252,75,7,140,102,145,98,152,94,8,232,6,124,185,132,168,164,26,248,127,
+7,223,79,199,56,80,98,112,64,84,30,134,169,134,153,130,152,8,162,122,110,
+153,109,27,99,100,114,99,121,31,128,115,135,118,102,26,163,6,201,145,153,
+168,163,27,169,161,101,84,31,14,251,246,247,67,248,149,21,98,120,62,116,82,
+128,8,114,7,141,157,151,140,148,27,179,148,123,74,31,251,133,7,86,144,117,
+154,119,30,117,155,165,127,168,27,177,175,159,170,161,31,151,157,145,157,
+147,172,111,140,24,89,129,125,120,114,27,106,122,170,200,140,31,14,59,247,
+141,248,144,21,93,136,108,129,102,114,8,74,94,105,71,52,26,251,39,244,251,
+7,247,33,132,30,251,115,206,247,115,7,247,22,142,247,0,247,12,247,36,26,247,
+22,51,247,7,38,63,90,76,43,136,139,135,140,109,30,147,251,165,5,52,151,90,
+226,247,32,26,247,1,173,205,208,166,30,227,251,72,21,223,135,158,186,177,
+27,193,194,38,39,251,1,79,62,49,132,31,14,247,89,247,182,21,247,115,7,108,
+121,88,122,57,121,8,114,7,141,156,150,140,148,27,179,148,124,73,31,251,249,
+217,247,142,7,247,37,251,68,5,162,111,139,138,132,26,127,132,135,107,137,
+30,134,119,247,129,163,130,6,92,142,132,144,75,218,251,47,247,87,24,183,180,
+5,204,208,157,152,158,27,147,147,135,130,150,31,121,161,145,137,156,27,172,
+166,163,168,172,108,162,95,114,118,133,123,116,31,104,117,60,72,87,86,120,
+121,24,14,214,248,206,21,196,146,168,172,184,27,172,165,114,94,154,31,146,
+118,148,106,148,101,251,123,252,134,24,233,6,247,62,247,250,171,251,85,155,
+66,157,100,25,96,161,170,116,177,27,204,175,199,247,1,141,31,118,6,87,131,
+116,110,103,27,109,113,158,174,123,31,126,165,132,164,125,214,112,247,21,
+24,141,138,141,138,147,30,133,171,138,144,134,161,115,247,3,123,194,117,189,
+8,181,120,102,166,99,27,78,107,88,251,11,128,31,14,32,248,78,248,136,21,50,
+6,140,252,5,5,88,103,105,117,97,27,81,105,180,209,31,247,223,51,252,116,7,
+118,135,114,132,109,30,122,77,138,134,115,26,96,160,110,168,168,159,169,183,
+160,136,153,123,196,30,128,175,138,148,168,26,151,7,103,181,161,129,174,27,
+189,190,170,201,192,31,147,107,144,127,149,124,8,118,154,166,126,169,27,200,
+182,183,216,153,31,112,140,5,101,135,118,109,116,27,109,119,175,193,31,14,
+251,54,130,248,95,21,196,138,141,137,163,79,247,53,252,45,24,169,6,154,177,
+148,162,146,153,166,194,24,148,158,198,247,2,5,199,247,4,163,198,175,26,172,
+113,166,107,110,115,114,108,132,139,139,145,108,30,141,130,5,146,106,141,
+126,125,26,112,131,115,115,95,30,70,251,26,251,47,248,28,94,124,99,131,90,
+137,25,14,247,168,248,149,21,251,29,35,251,10,251,46,251,38,236,251,0,247,
+22,247,26,244,247,13,247,47,247,36,44,245,251,22,31,117,102,21,227,200,33,
+251,45,251,15,96,69,63,101,100,161,173,117,31,107,188,120,217,217,26,247,
+13,183,209,215,30,14,169,247,240,21,169,189,157,151,189,140,8,185,6,113,251,
+114,135,111,126,118,105,107,25,108,111,130,124,116,26,108,163,115,170,170,
+163,162,182,152,30,148,165,153,241,148,240,151,247,21,24,247,1,6,127,58,130,
+35,80,26,251,4,176,71,201,178,174,166,186,163,30,153,167,143,158,142,189,
+8,115,6,91,134,120,114,106,27,119,118,153,160,128,31,130,157,136,155,172,
+26,217,144,229,146,195,30,247,18,228,251,242,6,58,144,87,91,109,251,1,8,14,
+251,54,247,156,249,66,21,100,99,123,108,102,31,71,84,102,32,251,33,26,251,
+23,172,35,198,83,30,101,179,184,119,183,27,178,178,155,170,177,31,207,194,
+176,245,247,28,26,247,29,107,241,79,197,30,176,100,93,160,95,27,247,10,252,
+10,21,137,251,6,127,74,110,86,8,108,121,107,116,114,27,113,107,162,170,122,
+31,110,192,127,204,137,247,6,8,195,4,141,247,1,152,205,167,191,8,170,156,
+171,162,165,27,164,171,116,108,157,31,167,87,152,73,141,251,1,8,14,247,42,
+185,21,101,165,180,118,189,27,247,11,243,247,22,247,42,247,34,48,243,251,
+17,106,117,134,125,115,31,101,118,105,110,113,107,8,111,104,130,105,68,26,
+252,28,7,97,137,116,131,104,30,233,6,144,173,139,141,140,218,8,133,248,63,
+21,138,169,143,172,146,153,8,174,156,164,158,167,27,233,219,251,0,251,20,
+251,0,83,66,57,98,97,168,179,120,31,133,151,138,146,138,170,8,14,59,248,224,
+248,49,21,226,251,119,7,60,85,130,119,93,31,42,95,84,61,46,26,73,164,74,185,
+87,30,79,191,196,113,218,27,208,196,160,180,185,31,184,180,166,196,193,26,
+215,81,214,33,200,30,92,22,225,50,158,102,56,26,35,89,69,65,47,63,240,247,
+15,235,201,202,233,30,14,251,136,175,247,201,21,167,213,164,164,179,136,8,
+212,6,124,251,4,133,67,75,26,33,176,75,201,179,179,168,180,155,30,151,168,
+143,167,141,186,8,114,6,82,131,125,119,108,27,95,105,181,193,155,141,171,
+142,173,31,140,152,141,167,141,170,142,179,139,147,142,162,8,247,56,234,251,
+119,6,50,144,75,71,111,251,20,8,14,32,146,248,0,21,169,6,183,152,161,163,
+167,27,168,147,118,68,140,31,142,251,54,140,70,163,81,179,107,25,117,166,
+173,129,183,27,205,197,163,182,176,31,178,186,163,213,213,26,210,117,203,
+100,185,30,107,176,107,159,72,165,131,114,24,179,117,157,125,155,116,8,167,
+101,155,80,74,26,79,126,78,115,89,30,95,118,108,116,100,27,82,98,199,225,
+138,31,136,247,68,5,247,8,138,112,185,75,27,106,113,126,112,120,31,122,116,
+133,126,121,81,8,14,169,249,51,248,129,21,229,252,136,7,75,145,72,78,111,
+52,8,156,6,185,178,176,151,211,140,8,42,112,77,36,251,25,26,251,30,64,10,
+247,30,247,26,76,243,41,164,31,44,22,176,128,161,127,161,118,8,182,99,165,
+59,48,75,10,112,27,107,108,161,172,124,31,130,158,136,154,133,172,8,62,10,
+133,106,136,124,130,120,8,106,124,108,117,107,27,112,76,10,222,162,217,176,
+180,30,162,165,164,154,181,151,8,14,142,248,64,248,123,21,176,129,161,127,
+161,119,8,182,99,165,61,50,75,10,113,27,88,107,180,220,125,31,62,10,58,125,
+107,98,88,27,113,76,10,220,162,215,176,180,30,162,164,164,153,181,151,8,165,
+7,85,138,104,133,108,126,8,56,103,86,37,251,16,26,251,31,64,10,247,31,247,
+10,90,238,63,179,31,106,156,101,146,79,140,8,14,251,82,247,65,249,144,21,
+140,130,131,140,134,27,93,100,104,97,102,160,117,188,125,31,114,115,127,110,
+105,26,100,154,109,177,101,30,106,114,122,124,122,119,8,103,97,117,77,81,
+26,60,179,66,200,110,30,123,171,178,133,200,27,156,143,139,140,162,31,150,
+6,171,141,5,179,141,169,110,100,26,101,112,111,102,132,128,140,144,112,30,
+142,116,131,140,129,27,114,122,123,113,105,173,115,188,187,175,158,183,171,
+31,168,177,155,185,185,26,184,123,173,106,163,30,157,116,117,144,93,27,53,
+6,95,106,143,147,121,31,96,158,110,186,192,26,209,182,201,222,186,30,129,
+168,158,136,171,27,218,187,160,174,162,113,152,95,99,105,129,106,67,31,97,
+170,125,160,171,26,171,158,168,176,167,30,189,141,173,145,166,153,8,174,156,
+160,164,162,26,158,123,150,111,102,97,116,82,75,30,108,140,117,157,166,26,
+161,156,154,175,149,30,14,142,248,25,248,136,21,74,252,96,6,73,154,112,179,
+132,232,121,247,61,24,134,189,134,158,123,165,8,176,116,98,163,99,27,121,
+124,136,129,108,31,120,7,204,128,149,128,148,68,153,251,55,24,149,251,10,
+226,46,247,9,122,8,251,111,204,247,111,7,247,9,156,226,232,149,247,10,153,
+247,55,24,141,152,143,192,156,156,200,149,25,158,7,149,108,124,142,121,27,
+103,100,119,107,116,31,120,112,131,116,134,85,121,251,61,24,132,46,112,99,
+73,124,8,14,251,81,247,107,249,136,21,71,134,94,101,86,26,100,162,120,206,
+123,30,44,251,18,102,39,251,22,26,41,161,84,197,94,30,113,173,172,127,181,
+27,148,140,139,141,172,31,150,6,141,168,146,139,149,27,186,168,115,100,100,
+108,105,104,131,132,140,145,118,31,148,106,130,141,128,27,107,115,119,112,
+107,175,116,190,236,208,212,244,232,78,189,251,6,131,115,139,138,128,31,120,
+6,67,91,201,232,247,12,199,247,30,223,214,31,237,150,221,190,190,26,158,123,
+152,117,103,85,104,58,48,30,103,150,122,158,168,26,166,157,160,174,153,30,
+14,251,95,247,159,248,192,21,136,202,171,162,239,146,8,163,7,251,51,143,84,
+110,136,48,8,251,70,7,142,86,107,115,47,126,8,115,7,184,133,154,135,165,127,
+167,125,145,128,140,96,8,251,105,7,141,37,189,110,247,58,143,8,163,7,110,
+140,107,144,117,148,100,155,132,151,138,189,8,247,105,7,137,208,107,167,46,
+154,230,154,174,169,140,201,8,14,252,119,204,77,10,253,230,209,249,230,7,
+14,251,95,247,101,91,21,138,90,132,127,104,124,118,129,104,133,108,138,8,
+115,7,247,58,135,189,168,141,241,8,247,105,7,140,182,145,150,167,153,164,
+151,155,143,184,145,8,163,7,47,152,107,163,142,192,8,247,70,7,135,230,85,
+168,251,51,135,8,115,7,239,132,171,116,136,76,8,251,64,7,77,175,109,229,124,
+30,47,124,107,111,137,70,8,14,248,125,247,217,65,10,161,88,10,82,92,111,82,
+100,31,182,106,5,192,184,155,149,177,27,161,139,139,112,229,31,114,219,142,
+138,170,27,204,187,85,10,246,249,113,247,105,21,92,161,121,154,119,170,8,
+121,168,128,176,172,26,168,147,173,152,163,30,153,165,156,156,180,171,8,197,
+86,96,159,66,27,110,124,136,127,110,31,126,111,123,135,121,27,123,125,143,
+150,113,31,153,106,126,142,105,27,251,17,48,40,251,29,251,6,185,251,14,217,
+47,31,100,172,174,118,172,27,157,149,141,152,169,31,153,173,160,144,158,27,
+154,152,135,123,176,31,129,160,154,136,159,27,176,160,149,171,171,31,185,
+185,141,142,200,247,17,8,251,59,248,231,21,81,123,112,124,116,112,8,109,106,
+116,87,107,26,138,139,139,140,123,30,196,147,166,149,166,166,8,169,169,159,
+184,180,26,142,139,144,138,147,30,14,206,186,247,253,21,232,6,138,126,139,
+133,131,26,132,139,132,140,125,30,70,6,116,82,5,241,6,251,43,181,247,23,37,
+247,46,27,217,208,164,192,207,31,219,7,74,83,63,103,55,27,251,14,251,4,221,
+247,6,106,31,248,9,6,162,196,5,252,44,6,138,152,139,146,147,26,148,139,144,
+140,152,30,248,67,6,163,196,5,64,6,252,4,6,247,8,175,247,1,219,247,14,27,
+224,212,104,73,197,31,163,196,5,207,69,60,172,49,27,251,46,251,24,37,251,
+43,98,31,60,6,14,76,149,249,23,21,142,161,149,140,154,27,217,196,94,57,162,
+31,156,81,149,62,64,26,251,60,7,142,55,118,111,69,135,8,134,113,247,179,165,
+134,86,10,247,64,7,247,70,184,247,16,204,153,144,135,118,156,30,111,162,153,
+131,163,27,176,162,162,176,183,105,167,84,65,76,96,64,105,31,116,88,133,108,
+125,251,8,137,218,133,196,128,180,8,223,116,55,193,32,27,112,121,137,130,
+108,31,14,252,72,166,51,10,14,79,10,249,19,4,53,10,252,152,251,72,22,188,
+6,248,107,249,53,5,89,6,14,169,247,249,247,119,21,68,197,209,98,202,27,222,
+196,200,229,227,80,199,53,72,75,101,66,84,31,211,82,73,178,76,27,54,79,76,
+51,52,197,78,222,196,196,166,189,185,31,203,211,21,200,182,198,176,192,27,
+193,177,98,82,80,104,101,85,85,105,160,215,69,31,72,141,21,76,90,80,103,86,
+27,87,104,179,198,196,176,178,193,190,179,114,68,205,31,14,251,75,247,8,248,
+58,21,129,107,5,247,0,6,127,51,130,53,129,35,126,251,40,130,90,118,105,8,
+121,127,122,128,121,27,128,132,143,146,142,140,143,141,141,31,149,156,141,
+144,151,26,159,123,154,117,110,118,119,110,101,173,111,187,202,188,186,229,
+169,30,172,235,155,226,165,247,118,141,157,24,247,11,6,149,171,5,251,17,6,
+157,247,32,143,163,151,167,8,170,152,158,155,162,27,152,146,134,131,135,139,
+139,132,127,31,136,132,137,133,132,26,117,156,124,163,167,160,160,167,175,
+102,166,88,42,83,58,251,76,105,30,14,209,248,75,113,21,108,185,132,161,191,
+26,167,143,155,147,146,144,135,112,166,30,103,175,167,125,179,27,203,179,
+185,212,219,94,194,75,114,111,130,121,111,31,120,109,136,138,128,27,129,134,
+144,149,150,143,143,168,159,31,181,169,162,178,181,26,206,79,191,63,63,79,
+87,72,97,162,100,181,109,30,168,119,143,135,128,26,129,134,134,129,128,136,
+140,158,109,30,157,111,111,148,114,27,75,94,84,59,66,180,93,203,178,168,153,
+175,175,31,166,165,144,143,147,27,147,143,123,111,87,132,117,107,93,31,14,
+209,248,10,103,21,247,118,247,185,251,118,247,185,251,124,251,185,5,14,209,
+248,10,106,21,193,215,153,159,150,154,174,184,25,201,219,139,139,149,152,
+8,192,211,157,183,200,26,219,93,194,71,79,102,108,67,112,30,119,132,136,135,
+130,27,130,136,143,159,132,31,211,112,102,170,79,27,71,93,84,59,72,160,93,
+209,50,31,213,43,144,133,172,93,8,14,209,248,72,103,21,109,182,132,162,196,
+26,161,143,151,147,141,143,136,135,142,30,158,109,139,138,148,130,8,120,156,
+164,129,167,27,202,187,191,206,187,118,189,88,210,31,251,78,247,150,251,78,
+251,150,5,88,68,118,89,91,26,72,187,87,203,177,167,156,173,160,30,162,153,
+140,141,145,27,146,140,143,126,117,26,82,132,117,108,95,30,14,247,251,250,
+29,247,168,21,253,142,6,147,148,197,201,209,221,173,184,25,101,177,37,251,
+12,75,72,54,62,25,223,63,204,70,241,251,11,177,177,24,104,184,70,221,81,201,
+131,148,24,249,142,6,131,130,81,77,70,58,104,93,25,177,101,241,247,11,204,
+208,223,215,25,54,216,75,206,37,247,12,101,101,24,173,94,209,57,197,77,8,
+14,247,196,247,44,247,112,21,249,170,195,253,170,6,147,148,194,198,212,224,
+172,183,25,101,177,40,251,8,52,47,74,84,25,203,84,227,47,238,251,8,177,177,
+24,108,180,69,221,87,196,131,147,24,14,59,222,249,1,21,179,169,223,211,195,
+190,147,147,24,148,147,5,253,170,195,249,170,7,148,131,147,131,195,88,223,
+67,179,109,25,177,177,251,5,235,42,232,86,201,25,86,77,42,46,251,5,43,8,14,
+247,196,249,219,247,112,21,131,130,131,131,87,82,69,57,108,98,25,177,101,
+238,247,8,227,231,203,194,25,75,194,51,231,40,247,8,101,101,24,172,95,213,
+53,193,81,147,130,24,253,170,83,6,14,59,248,169,247,159,21,99,109,55,67,83,
+88,131,131,24,130,131,5,249,170,83,253,170,7,130,147,131,147,83,190,55,211,
+99,169,25,101,101,247,5,43,236,46,192,77,25,192,201,236,232,247,5,235,8,14,
+251,175,247,95,249,66,21,53,72,72,54,53,205,71,223,223,205,206,225,225,75,
+206,56,31,138,82,21,189,180,96,86,85,98,97,87,87,97,182,191,194,181,181,193,
+31,14,150,194,21,84,248,160,194,7,251,125,248,243,58,10,251,164,159,51,10,
+229,251,102,54,10,14,79,10,252,133,249,19,56,10,247,128,247,159,21,251,111,
+251,112,178,101,247,111,247,111,247,111,251,111,178,177,251,111,247,112,247,
+111,247,111,100,178,251,111,251,112,251,111,247,112,100,100,5,14,169,249,
+19,248,49,21,251,16,142,95,119,53,44,129,152,133,147,124,154,8,192,83,91,
+162,79,27,45,70,76,52,53,208,76,233,199,187,161,193,195,31,154,154,145,147,
+149,153,8,55,211,195,110,231,27,173,6,130,191,61,136,70,171,74,208,25,204,
+207,209,171,216,136,8,251,171,42,21,70,80,91,110,83,27,75,92,180,195,196,
+186,180,203,195,189,110,71,196,31,14,251,81,246,249,54,21,162,184,171,148,
+174,27,241,197,44,251,56,110,137,115,134,91,31,189,75,103,155,88,27,90,98,
+121,100,103,31,95,93,114,76,77,26,251,0,222,53,243,208,198,171,201,181,30,
+185,207,172,247,26,247,9,26,247,8,105,231,71,209,30,188,91,86,162,75,27,99,
+106,132,118,83,31,247,192,252,49,21,123,251,3,129,96,113,88,8,86,113,96,106,
+95,27,84,106,191,225,247,6,206,233,220,177,164,126,97,181,31,14,251,115,247,
+125,248,154,21,37,58,59,39,37,219,58,239,240,218,219,241,239,60,220,41,31,
+14,247,165,247,18,21,66,10,248,35,4,66,10,251,155,251,123,21,84,248,162,194,
+7,14,247,79,247,34,21,67,251,35,185,115,224,247,59,5,247,186,194,251,159,
+6,210,247,31,5,247,88,194,251,61,6,207,247,26,92,163,59,251,50,5,251,189,
+84,247,162,6,69,251,31,5,251,92,84,6,14,248,174,247,186,21,82,10,42,4,82,
+10,247,251,4,82,10,14,248,125,247,143,60,10,111,83,52,10,167,196,170,31,101,
+247,83,60,10,112,82,52,10,85,10,247,209,247,60,239,21,36,10,247,225,22,36,
+10,247,225,22,36,10,14,59,247,228,250,134,21,83,254,254,195,6,14,247,209,
+79,247,112,21,250,234,195,254,234,6,14,114,248,238,207,21,248,197,84,252,
+141,251,254,223,7,251,62,251,4,247,62,251,4,5,223,7,14,247,32,248,108,247,
+211,21,251,172,247,247,5,127,116,134,117,115,26,118,146,123,163,110,30,215,
+44,77,251,7,5,118,100,129,111,118,26,117,149,114,162,102,30,167,93,139,138,
+126,26,120,125,128,114,30,120,72,229,6,184,169,143,146,153,31,159,150,150,
+164,173,26,183,129,159,80,220,30,101,189,126,169,171,26,160,143,151,160,178,
+30,247,218,252,46,5,151,162,144,159,160,26,163,130,157,111,175,30,97,192,
+5,100,189,127,164,173,26,158,146,168,148,162,30,187,247,8,5,163,6,163,150,
+129,111,144,31,148,172,143,168,170,26,196,121,161,91,30,65,6,96,125,151,175,
+31,155,7,107,106,124,103,95,26,109,148,113,153,125,30,128,151,154,135,173,
+27,183,6,14,142,149,201,21,157,120,166,151,5,144,152,152,142,148,27,151,147,
+136,127,162,31,247,54,50,5,131,156,152,134,149,27,158,172,156,179,196,31,
+187,174,5,196,179,168,187,195,26,163,135,158,128,158,30,53,247,53,5,119,175,
+129,169,160,26,155,147,156,156,158,30,231,246,5,203,251,15,71,160,59,27,251,
+29,40,52,251,11,78,168,82,187,108,31,169,119,171,131,198,136,141,165,24,95,
+142,116,145,116,152,8,96,164,113,185,190,26,213,203,191,229,197,181,127,89,
+247,7,30,74,63,5,118,114,130,116,110,26,114,146,115,154,112,30,222,251,44,
+5,154,111,147,114,115,26,112,129,117,120,123,30,122,118,104,127,111,27,123,
+128,142,152,116,31,251,39,217,5,148,123,128,142,127,27,126,127,135,129,124,
+31,14,247,4,212,172,21,158,123,5,153,162,150,143,152,27,154,154,131,119,164,
+31,146,133,148,132,152,129,192,169,196,190,186,197,8,182,196,152,185,236,
+26,140,210,5,183,132,212,127,220,30,204,181,5,148,153,149,142,149,27,155,
+151,133,121,159,31,223,63,251,84,251,25,152,117,5,148,6,156,152,131,123,148,
+31,151,117,153,82,147,75,158,251,68,151,109,205,107,247,2,227,24,122,162,
+5,131,119,130,136,130,27,120,130,153,170,135,31,111,247,83,119,201,86,208,
+247,73,247,21,24,251,47,247,26,5,149,126,132,143,131,27,129,132,136,125,120,
+31,251,19,47,5,216,101,91,170,57,27,251,14,49,55,251,7,105,148,107,156,114,
+31,153,116,154,128,176,121,187,115,24,167,125,150,129,127,26,130,134,132,
+125,128,30,164,120,175,193,5,146,150,143,149,150,26,161,124,158,110,153,30,
+85,167,94,161,122,150,129,149,25,123,156,130,161,163,26,201,196,190,210,194,
+183,111,91,161,30,154,105,152,51,64,26,140,81,135,251,37,125,83,91,67,25,
+66,190,5,145,131,133,141,135,27,134,134,136,132,130,31,14,247,196,248,107,
+248,210,21,44,75,103,110,102,94,8,85,74,112,75,77,26,100,146,114,165,81,30,
+102,92,125,119,127,117,8,118,100,127,96,101,26,108,150,109,158,115,30,111,
+161,166,127,177,27,212,185,204,242,197,126,186,90,247,8,31,247,89,247,45,
+245,224,231,27,196,171,102,73,76,111,56,92,67,31,61,88,83,100,78,27,106,112,
+166,174,147,141,152,142,153,31,154,138,5,167,162,160,165,162,123,155,117,
+102,110,95,84,67,185,93,210,217,228,193,222,197,31,202,229,167,209,210,26,
+227,79,193,40,58,69,104,53,47,30,102,105,110,106,58,37,8,131,169,135,164,
+167,26,239,189,218,247,13,228,30,251,103,252,97,21,186,48,157,86,92,26,114,
+131,115,127,124,30,128,130,128,135,119,27,93,113,175,204,196,156,183,189,
+207,31,14,224,247,97,248,126,21,247,36,251,33,251,36,251,36,178,101,247,36,
+247,36,247,33,251,36,177,177,251,33,247,36,247,33,247,33,101,178,251,33,251,
+33,251,36,247,33,5,247,39,247,54,21,251,84,251,48,251,47,251,83,251,81,247,
+48,251,48,247,80,247,81,247,49,247,48,247,80,247,80,251,48,247,51,251,78,
+31,81,4,247,49,247,22,251,22,251,49,93,10,251,21,251,52,93,10,247,20,247,
+50,247,54,247,21,247,19,247,55,31,14,224,247,252,248,222,21,251,106,251,100,
+84,247,100,251,106,195,247,106,247,100,194,251,100,247,106,7,115,242,21,251,
+88,251,45,251,44,251,86,251,82,247,46,251,45,247,84,247,83,247,45,247,45,
+247,84,247,81,251,46,247,47,251,79,31,140,86,21,247,47,247,21,251,25,251,
+52,93,10,251,23,251,51,93,10,247,23,247,53,247,55,247,22,247,20,247,56,31,
+14,247,32,178,152,21,176,102,239,239,5,82,206,224,107,227,27,247,94,247,55,
+247,55,247,94,228,109,219,80,210,31,228,228,102,176,49,49,5,198,70,58,169,
+51,27,251,94,251,55,251,55,251,94,51,171,54,196,74,31,178,178,21,91,198,114,
+206,212,26,247,63,247,31,247,30,247,63,212,210,113,93,194,30,176,102,21,186,
+85,166,67,65,26,251,63,251,31,251,30,251,63,66,67,165,186,84,30,14,224,249,
+112,22,247,68,7,138,228,121,199,95,194,8,221,74,39,184,251,10,27,251,93,251,
+37,251,23,251,74,31,251,86,196,7,140,247,95,5,247,32,247,17,246,247,55,229,
+223,105,81,192,30,185,90,155,93,60,26,251,76,7,14,224,179,248,125,21,251,
+68,7,140,50,157,79,183,84,8,57,204,239,94,247,10,27,247,93,247,36,247,23,
+247,74,140,31,247,86,82,251,95,7,251,32,138,251,17,32,251,55,27,49,55,173,
+197,86,31,93,188,123,186,217,26,247,76,7,14,169,159,22,33,10,169,159,70,21,
+83,249,28,195,7,253,28,208,21,33,10,169,248,174,248,106,21,171,209,5,89,6,
+107,69,5,35,6,70,107,89,10,109,91,10,64,174,69,198,94,30,176,111,178,127,
+207,135,106,68,24,189,6,171,209,5,248,3,195,251,233,6,247,56,247,250,5,247,
+69,195,6,252,27,252,49,21,82,140,96,148,111,156,50,10,220,6,14,169,249,70,
+248,106,32,10,169,176,70,21,83,249,28,195,7,144,248,175,32,10,169,240,247,
+155,21,145,178,156,174,166,165,185,183,179,147,247,45,138,8,247,7,195,251,
+5,6,71,106,41,10,247,5,195,251,7,6,251,45,138,99,147,93,183,112,165,122,174,
+133,178,8,248,40,195,6,14,169,248,19,248,50,21,247,14,195,45,6,170,200,92,
+163,96,54,32,138,125,138,95,123,25,57,109,79,47,44,26,64,172,72,199,92,30,
+99,59,185,115,178,217,5,121,194,160,137,247,25,27,247,5,195,251,7,6,251,8,
+120,140,153,93,31,208,247,28,5,247,119,195,251,91,6,157,247,43,21,63,251,
+43,5,251,39,6,159,243,207,187,247,18,138,8,251,43,251,210,21,105,166,117,
+177,132,185,8,247,11,6,14,224,165,22,249,55,138,141,197,5,252,170,6,248,205,
+248,211,94,179,5,14,169,249,61,249,67,21,253,25,6,247,195,253,67,5,247,163,
+249,16,21,251,126,252,94,251,103,248,95,5,14,246,248,139,247,50,21,238,157,
+6,113,141,128,146,114,168,33,247,19,24,204,149,177,175,192,26,180,118,170,
+101,156,30,150,114,113,143,84,27,251,50,121,6,185,136,146,132,102,26,251,
+147,7,101,132,132,93,136,30,121,247,67,157,7,93,142,132,146,177,26,247,1,
+166,7,112,247,51,21,160,141,140,173,202,168,116,87,83,107,117,59,135,134,
+139,140,132,30,197,247,220,35,10,247,23,247,29,247,54,31,14,246,248,194,248,
+39,21,134,247,28,5,119,6,120,130,137,137,128,27,134,133,140,143,130,31,150,
+108,115,144,109,27,251,13,54,55,251,12,251,10,221,60,247,14,204,188,162,191,
+187,31,124,156,5,95,91,104,124,86,27,53,86,203,243,244,190,203,223,204,182,
+103,70,156,31,251,33,247,179,35,10,247,24,247,29,247,53,31,14,247,99,249,
+235,77,10,251,26,6,251,10,251,183,251,11,247,183,5,251,12,117,6,179,140,139,
+122,31,251,195,7,104,138,133,134,97,27,117,247,27,161,7,104,126,149,168,140,
+31,247,161,7,247,24,251,222,5,161,6,247,31,247,238,5,251,182,7,112,137,129,
+132,99,27,117,247,62,161,7,98,141,132,144,138,166,8,247,201,7,138,152,148,
+144,164,138,8,155,6,252,148,161,21,251,217,251,2,159,6,144,200,153,149,221,
+142,8,145,251,206,6,111,138,132,135,84,27,117,247,85,161,7,83,133,142,166,
+140,31,247,208,141,7,226,138,155,128,140,77,8,162,6,14,247,32,164,251,16,
+21,247,182,45,10,248,212,7,201,143,160,153,152,30,156,157,151,140,247,33,
+27,247,35,151,138,122,157,31,153,126,143,118,77,26,252,212,68,10,113,247,
+182,45,10,248,227,78,10,253,158,46,10,252,227,68,10,6,14,247,255,104,21,247,
+44,250,67,104,144,251,19,253,170,251,89,248,33,251,38,68,155,104,234,186,
+5,14,252,69,247,12,247,203,21,111,116,116,111,111,161,116,167,167,161,162,
+167,167,117,162,112,31,14,169,154,248,3,21,79,248,242,251,159,198,247,219,
+7,14,59,247,196,248,112,21,251,173,252,83,185,109,247,126,248,7,247,126,252,
+6,185,171,5,14,59,247,195,138,21,247,167,248,83,93,169,251,120,252,6,251,
+120,248,5,93,107,5,14,247,251,247,133,248,11,21,69,10,68,48,39,34,61,73,219,
+71,236,36,74,10,248,204,6,67,10,231,236,242,219,207,61,205,39,244,68,230,
+80,10,252,252,84,21,249,44,6,180,97,163,116,153,128,123,125,121,122,94,93,
+8,253,44,6,94,184,120,158,124,152,154,151,146,146,157,157,171,170,24,14,247,
+196,250,63,247,212,21,194,253,75,7,69,10,80,61,251,7,251,13,64,76,218,72,
+237,35,74,10,249,75,194,253,122,6,136,141,137,142,137,141,128,150,128,150,
+128,149,122,156,131,147,124,152,156,154,149,148,192,192,8,14,59,248,16,249,
+122,21,253,122,194,249,75,7,159,122,154,126,154,127,174,112,24,152,129,173,
+182,62,197,251,16,247,10,76,213,25,72,60,34,40,47,67,173,96,24,185,175,171,
+165,159,156,8,253,75,194,249,122,7,141,142,141,141,142,141,152,152,24,145,
+146,146,145,146,146,156,156,146,147,152,154,156,120,139,138,193,85,8,14,247,
+196,184,247,59,21,84,249,75,7,67,10,232,232,236,223,212,56,210,44,238,68,
+231,80,10,253,75,84,6,249,122,140,146,132,172,106,156,122,147,131,154,127,
+25,123,125,130,130,124,124,128,127,128,129,129,128,137,138,137,136,135,136,
+8,14,59,247,123,247,59,21,249,122,84,253,75,7,119,156,124,152,124,151,104,
+166,24,134,143,136,142,134,142,105,96,24,218,80,247,14,251,8,202,64,205,217,
+247,1,242,228,208,105,182,24,93,103,107,113,119,122,8,249,75,84,253,122,7,
+132,132,106,106,122,122,132,131,126,124,25,122,158,139,140,85,193,8,14,251,
+81,247,101,22,199,138,247,89,248,11,251,81,248,2,5,76,6,251,88,251,255,5,
+247,114,251,211,21,251,51,247,210,247,56,247,199,247,49,251,202,5,14,251,
+246,247,146,249,137,21,251,121,252,90,247,121,252,91,191,164,251,107,248,
+66,247,107,248,66,5,14,246,247,141,248,163,21,252,26,190,247,60,226,7,223,
+138,157,124,143,62,141,88,141,125,145,129,8,189,6,133,151,137,151,137,178,
+137,223,127,162,89,157,8,184,158,162,171,183,26,177,122,170,107,158,30,153,
+118,113,144,97,27,251,1,98,21,237,6,206,171,116,92,90,105,116,67,31,48,6,
+239,247,227,21,251,88,251,46,73,10,247,83,247,46,47,10,251,59,251,28,247,
+30,247,61,247,64,247,27,247,28,247,64,31,14,246,248,163,247,188,21,62,129,
+92,95,66,27,55,83,202,236,235,195,204,224,204,186,104,80,151,31,188,6,218,
+132,67,197,47,27,251,7,60,56,251,13,251,13,216,57,247,6,240,210,204,238,147,
+31,251,70,248,19,21,251,87,251,47,73,10,247,82,247,47,47,10,251,58,251,29,
+247,30,247,61,247,64,247,28,247,28,247,63,31,14,242,248,173,247,169,21,247,
+25,247,238,5,251,238,194,248,32,50,7,251,8,251,183,251,2,247,183,5,49,252,
+32,194,247,238,6,247,21,251,238,5,251,216,247,238,21,247,2,189,251,177,89,
+247,4,251,238,202,6,14,169,247,68,249,91,21,247,160,6,247,8,138,169,117,155,
+38,8,165,6,129,247,57,5,252,235,6,247,125,252,103,251,134,252,44,5,249,7,
+6,193,247,102,5,113,6,109,59,105,120,251,6,140,8,251,220,6,247,93,247,244,
+5,14,251,191,179,251,185,21,191,248,67,6,247,98,205,247,146,224,247,11,30,
+200,229,209,211,201,175,125,150,24,50,90,84,98,89,79,8,251,10,251,32,69,251,
+120,251,132,26,14,251,191,179,60,21,191,250,128,87,6,14,251,191,179,250,50,
+21,252,97,7,251,115,198,251,101,244,251,38,30,194,64,194,94,247,0,79,153,
+150,24,251,113,247,36,251,8,247,155,132,248,6,8,248,67,7,14,251,191,59,4,
+194,250,75,247,178,194,251,233,6,14,251,191,250,49,4,92,10,251,191,250,50,
+4,254,130,247,232,194,251,177,250,75,7,14,251,81,247,147,64,21,249,74,7,137,
+247,66,185,210,247,32,179,8,161,7,251,68,113,77,63,251,79,26,253,92,7,14,
+251,81,247,147,250,59,21,85,251,132,6,142,251,38,84,70,251,27,120,8,78,7,
+247,27,120,194,70,136,251,38,8,251,143,193,247,164,7,141,247,29,85,213,251,
+21,172,247,20,170,195,214,136,247,29,8,14,251,81,247,147,250,50,21,85,253,
+87,6,251,79,201,63,247,68,113,30,161,7,251,32,179,93,210,141,247,66,8,14,
+251,81,247,93,250,49,21,254,128,193,250,128,7,14,251,246,212,249,137,21,87,
+115,247,107,252,66,251,107,252,66,191,114,247,121,248,91,5,14,252,45,247,
+72,248,212,21,216,138,177,136,194,30,137,167,138,165,154,26,179,150,162,157,
+145,144,137,135,141,30,112,156,146,133,156,27,159,154,153,157,166,115,157,
+103,94,105,110,90,125,31,124,85,129,37,34,26,251,237,7,67,140,103,142,78,
+30,141,110,140,109,123,26,104,127,116,120,131,132,144,152,133,30,156,130,
+131,144,125,27,119,124,125,120,113,163,121,175,184,173,168,188,153,31,154,
+193,149,240,245,26,14,142,247,224,56,21,222,248,104,6,247,66,171,247,51,190,
+217,30,185,169,174,166,170,27,144,142,138,137,146,31,124,126,133,128,122,
+26,109,166,115,173,178,166,169,180,185,103,173,91,80,72,91,55,82,30,61,251,
+6,101,251,41,251,86,26,14,142,247,224,51,21,222,250,187,56,6,14,142,248,51,
+250,45,21,56,252,101,6,251,66,107,251,51,88,61,30,93,109,104,112,108,27,134,
+136,140,141,132,31,154,152,145,150,156,26,169,112,163,105,105,114,110,97,
+93,172,105,184,197,205,187,223,197,30,217,247,6,177,247,41,247,86,26,14,251,
+191,248,86,251,185,21,248,97,7,247,115,79,247,104,35,247,35,30,83,214,79,
+189,37,194,125,128,24,195,106,198,82,196,63,244,251,23,205,251,128,140,251,
+136,8,252,67,7,14,251,191,248,86,250,59,21,87,254,129,191,6,14,251,191,248,
+86,250,50,21,87,252,67,6,251,112,79,251,124,49,251,20,30,78,50,70,68,75,102,
+153,128,24,225,185,196,183,190,199,8,247,10,247,32,209,247,120,247,132,26,
+14,251,191,247,252,59,21,250,130,251,230,84,247,175,254,75,7,14,251,191,247,
+197,250,49,21,92,10,251,191,247,252,250,50,21,84,254,75,251,177,84,247,232,
+6,14,251,81,247,93,64,21,193,249,92,6,247,79,77,215,251,68,165,30,117,7,247,
+32,99,185,68,137,251,66,8,14,251,81,247,96,250,59,21,251,153,7,136,251,28,
+195,64,247,21,107,251,21,106,83,65,142,251,29,8,251,164,193,247,143,7,134,
+247,37,195,209,247,28,158,8,200,7,251,28,158,83,209,144,247,37,8,247,132,
+7,14,251,81,247,93,250,50,21,253,69,7,141,251,66,93,68,251,32,99,8,117,7,
+247,68,165,201,215,247,79,26,249,87,7,14,251,142,139,28,5,70,139,6,195,10,
+227,11,170,142,143,144,142,142,143,142,142,156,146,145,12,12,182,145,143,
+142,149,142,148,144,144,149,144,144,12,13,248,185,20,249,63,21,187,19,0,62,
+2,0,1,0,33,0,123,0,202,1,9,1,19,1,24,1,28,1,68,1,109,1,135,1,142,1,151,1,
+170,1,174,1,185,1,218,1,224,1,228,1,255,2,4,2,19,2,43,2,68,2,71,2,93,2,97,
+2,118,2,125,2,133,2,140,2,161,2,180,2,199,2,210,2,228,2,245,2,255,3,15,3,
+30,3,37,3,51,3,64,3,77,3,89,3,101,3,105,3,109,3,120,3,131,3,136,3,143,3,153,
+3,163,3,168,3,177,3,186,3,195,3,204,3,213,3,222,3,229,3,234,21,251,198,6,
+70,107,41,10,247,198,195,251,200,6,80,108,139,140,124,31,92,143,103,148,116,
+153,50,10,247,200,6,14,247,198,6,208,171,139,141,156,31,191,142,178,150,168,
+157,8,206,183,181,215,220,26,188,124,187,111,179,30,103,190,93,169,79,149,
+8,145,105,120,140,251,1,27,251,198,83,247,200,6,198,170,139,138,154,31,186,
+135,175,130,162,125,8,189,107,169,82,77,26,99,127,101,116,109,30,113,102,
+106,120,90,130,8,134,106,121,138,42,27,251,200,6,14,21,251,92,251,33,251,
+37,251,97,251,94,247,34,251,39,247,87,247,87,247,34,247,38,247,95,247,93,
+251,34,247,41,251,83,31,129,100,21,184,185,122,109,174,31,203,86,174,42,251,
+14,26,251,5,108,46,84,89,30,110,108,91,122,90,27,251,27,50,247,17,247,81,
+247,85,218,247,6,247,26,31,14,21,251,81,251,47,251,50,251,86,251,86,247,47,
+251,49,247,82,247,80,247,49,247,49,247,82,247,91,251,44,247,49,251,86,31,
+94,4,247,57,247,22,251,29,251,65,251,58,251,25,251,29,251,53,251,54,251,24,
+247,29,247,61,247,62,11,81,10,164,171,169,114,165,109,31,11,42,10,45,10,11,
+61,10,113,11,21,176,143,157,146,166,159,8,178,168,156,171,182,26,188,106,
+177,95,109,116,114,107,107,162,113,168,148,146,140,143,153,30,141,97,96,94,
+90,130,8,14,21,115,6,134,79,121,123,75,140,8,105,6,78,119,156,197,136,31,
+115,251,122,163,6,144,201,154,152,206,140,8,172,6,205,154,125,77,143,31,163,
+6,11,89,10,110,91,10,90,154,91,167,99,30,175,88,185,109,199,129,8,133,173,
+158,138,247,1,27,11,59,10,252,25,48,10,11,48,10,45,10,248,25,78,10,11,21,
+104,111,111,105,104,167,111,173,173,167,167,174,172,111,168,106,31,11,165,
+49,10,11,113,142,6,209,135,160,112,136,54,8,11,247,47,247,82,247,81,251,46,
+247,49,251,78,31,138,101,21,247,55,247,28,251,32,251,60,251,61,251,28,251,
+30,251,59,11,68,10,113,247,176,11,136,87,10,11,8,89,171,109,196,201,26,179,
+151,177,162,169,30,165,176,172,158,188,148,8,144,172,157,140,236,27,11,248,
+122,54,10,11,99,31,182,105,5,192,185,156,149,178,72,10,203,186,11,252,133,
+251,126,5,84,7,248,133,251,125,5,201,7,252,54,247,91,248,54,247,91,5,14,21,
+154,129,247,58,247,65,5,154,156,144,148,153,26,163,112,161,110,121,128,129,
+110,125,30,11,57,10,14,21,77,7,248,54,251,91,252,54,251,91,5,77,7,248,133,
+247,125,5,194,7,14,61,10,6,11,21,84,251,131,251,129,84,247,129,251,131,194,
+247,131,247,129,194,251,129,6,14,83,10,251,176,46,10,11,65,10,160,88,10,80,
+92,11,46,10,252,25,68,10,11,163,207,145,169,189,26,208,119,181,105,105,119,
+97,70,89,145,109,163,71,30,11,26,114,126,127,105,135,30,113,247,130,165,7,
+84,152,137,141,94,240,11,217,34,241,200,185,172,207,173,30,71,173,185,106,
+200,27,241,217,244,11,21,87,94,118,127,100,27,120,128,142,11,105,111,112,
+104,105,166,111,174,172,167,167,173,173,111,167,106,31,11,121,119,127,124,
+127,124,120,114,127,123,134,133,182,105,24,211,11,7,142,54,118,112,69,135,
+8,136,11,157,159,152,155,150,153,158,164,151,154,144,146,96,173,24,11,6,230,
+137,174,109,153,50,8,165,6,129,247,54,5,11,252,162,84,248,162,6,11,27,160,
+139,139,112,230,31,115,218,143,138,170,27,11,251,45,251,85,251,82,247,47,
+251,47,247,82,11,211,47,182,173,24,104,184,113,171,122,159,8,11,26,74,127,
+77,120,103,30,116,127,114,124,11,114,154,162,127,31,120,175,127,201,204,26,
+11,249,53,21,11,7,83,10,11,248,162,194,21,252,133,84,248,133,6,11,96,105,
+24,174,95,165,106,156,119,8,11,90,10,170,164,11,252,160,84,248,160,6,11,136,
+224,160,166,209,143,8,142,165,11,165,7,100,141,123,152,165,26,155,11,168,
+196,170,31,14,6,69,143,118,167,142,223,8,11,6,69,143,118,166,142,224,8,11,
+70,31,162,66,115,144,111,27,11,139,137,122,31,87,136,100,128,11,107,114,114,
+108,107,164,114,170,11,121,8,72,95,97,63,58,26,11,254,134,194,250,134,7,14,
+251,51,251,22,11,};
+#endif
@@ -0,0 +1,156 @@
+/* This is an automatically generated file. Do not edit. */
+0x30, 0x82, 0x04, 0xd0, 0x06, 0x09, 0x2a, 0x86,
+0x48, 0x86, 0xf7, 0x0d, 0x01, 0x07, 0x02, 0xa0,
+0x82, 0x04, 0xc1, 0x30, 0x82, 0x04, 0xbd, 0x02,
+0x01, 0x01, 0x31, 0x00, 0x30, 0x0b, 0x06, 0x09,
+0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x07,
+0x01, 0xa0, 0x82, 0x04, 0xa5, 0x30, 0x82, 0x04,
+0xa1, 0x30, 0x82, 0x03, 0x89, 0xa0, 0x03, 0x02,
+0x01, 0x02, 0x02, 0x04, 0x3e, 0x1c, 0xbd, 0x28,
+0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+0xf7, 0x0d, 0x01, 0x01, 0x05, 0x05, 0x00, 0x30,
+0x69, 0x31, 0x0b, 0x30, 0x09, 0x06, 0x03, 0x55,
+0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x23,
+0x30, 0x21, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x13,
+0x1a, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x53,
+0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x49,
+0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61,
+0x74, 0x65, 0x64, 0x31, 0x1d, 0x30, 0x1b, 0x06,
+0x03, 0x55, 0x04, 0x0b, 0x13, 0x14, 0x41, 0x64,
+0x6f, 0x62, 0x65, 0x20, 0x54, 0x72, 0x75, 0x73,
+0x74, 0x20, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63,
+0x65, 0x73, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03,
+0x55, 0x04, 0x03, 0x13, 0x0d, 0x41, 0x64, 0x6f,
+0x62, 0x65, 0x20, 0x52, 0x6f, 0x6f, 0x74, 0x20,
+0x43, 0x41, 0x30, 0x1e, 0x17, 0x0d, 0x30, 0x33,
+0x30, 0x31, 0x30, 0x38, 0x32, 0x33, 0x33, 0x37,
+0x32, 0x33, 0x5a, 0x17, 0x0d, 0x32, 0x33, 0x30,
+0x31, 0x30, 0x39, 0x30, 0x30, 0x30, 0x37, 0x32,
+0x33, 0x5a, 0x30, 0x69, 0x31, 0x0b, 0x30, 0x09,
+0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55,
+0x53, 0x31, 0x23, 0x30, 0x21, 0x06, 0x03, 0x55,
+0x04, 0x0a, 0x13, 0x1a, 0x41, 0x64, 0x6f, 0x62,
+0x65, 0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d,
+0x73, 0x20, 0x49, 0x6e, 0x63, 0x6f, 0x72, 0x70,
+0x6f, 0x72, 0x61, 0x74, 0x65, 0x64, 0x31, 0x1d,
+0x30, 0x1b, 0x06, 0x03, 0x55, 0x04, 0x0b, 0x13,
+0x14, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x54,
+0x72, 0x75, 0x73, 0x74, 0x20, 0x53, 0x65, 0x72,
+0x76, 0x69, 0x63, 0x65, 0x73, 0x31, 0x16, 0x30,
+0x14, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x0d,
+0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x52, 0x6f,
+0x6f, 0x74, 0x20, 0x43, 0x41, 0x30, 0x82, 0x01,
+0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48,
+0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00,
+0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01,
+0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0xcc, 0x4f,
+0x54, 0x84, 0xf7, 0xa7, 0xa2, 0xe7, 0x33, 0x53,
+0x7f, 0x3f, 0x9c, 0x12, 0x88, 0x6b, 0x2c, 0x99,
+0x47, 0x67, 0x7e, 0x0f, 0x1e, 0xb9, 0xad, 0x14,
+0x88, 0xf9, 0xc3, 0x10, 0xd8, 0x1d, 0xf0, 0xf0,
+0xd5, 0x9f, 0x69, 0x0a, 0x2f, 0x59, 0x35, 0xb0,
+0xcc, 0x6c, 0xa9, 0x4c, 0x9c, 0x15, 0xa0, 0x9f,
+0xce, 0x20, 0xbf, 0xa0, 0xcf, 0x54, 0xe2, 0xe0,
+0x20, 0x66, 0x45, 0x3f, 0x39, 0x86, 0x38, 0x7e,
+0x9c, 0xc4, 0x8e, 0x07, 0x22, 0xc6, 0x24, 0xf6,
+0x01, 0x12, 0xb0, 0x35, 0xdf, 0x55, 0xea, 0x69,
+0x90, 0xb0, 0xdb, 0x85, 0x37, 0x1e, 0xe2, 0x4e,
+0x07, 0xb2, 0x42, 0xa1, 0x6a, 0x13, 0x69, 0xa0,
+0x66, 0xea, 0x80, 0x91, 0x11, 0x59, 0x2a, 0x9b,
+0x08, 0x79, 0x5a, 0x20, 0x44, 0x2d, 0xc9, 0xbd,
+0x73, 0x38, 0x8b, 0x3c, 0x2f, 0xe0, 0x43, 0x1b,
+0x5d, 0xb3, 0x0b, 0xf0, 0xaf, 0x35, 0x1a, 0x29,
+0xfe, 0xef, 0xa6, 0x92, 0xdd, 0x81, 0x4c, 0x9d,
+0x3d, 0x59, 0x8e, 0xad, 0x31, 0x3c, 0x40, 0x7e,
+0x9b, 0x91, 0x36, 0x06, 0xfc, 0xe2, 0x5c, 0x8d,
+0xd1, 0x8d, 0x26, 0xd5, 0x5c, 0x45, 0xcf, 0xaf,
+0x65, 0x3f, 0xb1, 0xaa, 0xd2, 0x62, 0x96, 0xf4,
+0xa8, 0x38, 0xea, 0xba, 0x60, 0x42, 0xf4, 0xf4,
+0x1c, 0x4a, 0x35, 0x15, 0xce, 0xf8, 0x4e, 0x22,
+0x56, 0x0f, 0x95, 0x18, 0xc5, 0xf8, 0x96, 0x9f,
+0x9f, 0xfb, 0xb0, 0xb7, 0x78, 0x25, 0xe9, 0x80,
+0x6b, 0xbd, 0xd6, 0x0a, 0xf0, 0xc6, 0x74, 0x94,
+0x9d, 0xf3, 0x0f, 0x50, 0xdb, 0x9a, 0x77, 0xce,
+0x4b, 0x70, 0x83, 0x23, 0x8d, 0xa0, 0xca, 0x78,
+0x20, 0x44, 0x5c, 0x3c, 0x54, 0x64, 0xf1, 0xea,
+0xa2, 0x30, 0x19, 0x9f, 0xea, 0x4c, 0x06, 0x4d,
+0x06, 0x78, 0x4b, 0x5e, 0x92, 0xdf, 0x22, 0xd2,
+0xc9, 0x67, 0xb3, 0x7a, 0xd2, 0x01, 0x02, 0x03,
+0x01, 0x00, 0x01, 0xa3, 0x82, 0x01, 0x4f, 0x30,
+0x82, 0x01, 0x4b, 0x30, 0x11, 0x06, 0x09, 0x60,
+0x86, 0x48, 0x01, 0x86, 0xf8, 0x42, 0x01, 0x01,
+0x04, 0x04, 0x03, 0x02, 0x00, 0x07, 0x30, 0x81,
+0x8e, 0x06, 0x03, 0x55, 0x1d, 0x1f, 0x04, 0x81,
+0x86, 0x30, 0x81, 0x83, 0x30, 0x81, 0x80, 0xa0,
+0x7e, 0xa0, 0x7c, 0xa4, 0x7a, 0x30, 0x78, 0x31,
+0x0b, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06,
+0x13, 0x02, 0x55, 0x53, 0x31, 0x23, 0x30, 0x21,
+0x06, 0x03, 0x55, 0x04, 0x0a, 0x13, 0x1a, 0x41,
+0x64, 0x6f, 0x62, 0x65, 0x20, 0x53, 0x79, 0x73,
+0x74, 0x65, 0x6d, 0x73, 0x20, 0x49, 0x6e, 0x63,
+0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61, 0x74, 0x65,
+0x64, 0x31, 0x1d, 0x30, 0x1b, 0x06, 0x03, 0x55,
+0x04, 0x0b, 0x13, 0x14, 0x41, 0x64, 0x6f, 0x62,
+0x65, 0x20, 0x54, 0x72, 0x75, 0x73, 0x74, 0x20,
+0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73,
+0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04,
+0x03, 0x13, 0x0d, 0x41, 0x64, 0x6f, 0x62, 0x65,
+0x20, 0x52, 0x6f, 0x6f, 0x74, 0x20, 0x43, 0x41,
+0x31, 0x0d, 0x30, 0x0b, 0x06, 0x03, 0x55, 0x04,
+0x03, 0x13, 0x04, 0x43, 0x52, 0x4c, 0x31, 0x30,
+0x2b, 0x06, 0x03, 0x55, 0x1d, 0x10, 0x04, 0x24,
+0x30, 0x22, 0x80, 0x0f, 0x32, 0x30, 0x30, 0x33,
+0x30, 0x31, 0x30, 0x38, 0x32, 0x33, 0x33, 0x37,
+0x32, 0x33, 0x5a, 0x81, 0x0f, 0x32, 0x30, 0x32,
+0x33, 0x30, 0x31, 0x30, 0x39, 0x30, 0x30, 0x30,
+0x37, 0x32, 0x33, 0x5a, 0x30, 0x0b, 0x06, 0x03,
+0x55, 0x1d, 0x0f, 0x04, 0x04, 0x03, 0x02, 0x01,
+0x06, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x1d, 0x23,
+0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x82, 0xb7,
+0x38, 0x4a, 0x93, 0xaa, 0x9b, 0x10, 0xef, 0x80,
+0xbb, 0xd9, 0x54, 0xe2, 0xf1, 0x0f, 0xfb, 0x80,
+0x9c, 0xde, 0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d,
+0x0e, 0x04, 0x16, 0x04, 0x14, 0x82, 0xb7, 0x38,
+0x4a, 0x93, 0xaa, 0x9b, 0x10, 0xef, 0x80, 0xbb,
+0xd9, 0x54, 0xe2, 0xf1, 0x0f, 0xfb, 0x80, 0x9c,
+0xde, 0x30, 0x0c, 0x06, 0x03, 0x55, 0x1d, 0x13,
+0x04, 0x05, 0x30, 0x03, 0x01, 0x01, 0xff, 0x30,
+0x1d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf6,
+0x7d, 0x07, 0x41, 0x00, 0x04, 0x10, 0x30, 0x0e,
+0x1b, 0x08, 0x56, 0x36, 0x2e, 0x30, 0x3a, 0x34,
+0x2e, 0x30, 0x03, 0x02, 0x04, 0x90, 0x30, 0x0d,
+0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d,
+0x01, 0x01, 0x05, 0x05, 0x00, 0x03, 0x82, 0x01,
+0x01, 0x00, 0x32, 0xda, 0x9f, 0x43, 0x75, 0xc1,
+0xfa, 0x6f, 0xc9, 0x6f, 0xdb, 0xab, 0x1d, 0x36,
+0x37, 0x3e, 0xbc, 0x61, 0x19, 0x36, 0xb7, 0x02,
+0x3c, 0x1d, 0x23, 0x59, 0x98, 0x6c, 0x9e, 0xee,
+0x4d, 0x85, 0xe7, 0x54, 0xc8, 0x20, 0x1f, 0xa7,
+0xd4, 0xbb, 0xe2, 0xbf, 0x00, 0x77, 0x7d, 0x24,
+0x6b, 0x70, 0x2f, 0x5c, 0xc1, 0x3a, 0x76, 0x49,
+0xb5, 0xd3, 0xe0, 0x23, 0x84, 0x2a, 0x71, 0x6a,
+0x22, 0xf3, 0xc1, 0x27, 0x29, 0x98, 0x15, 0xf6,
+0x35, 0x90, 0xe4, 0x04, 0x4c, 0xc3, 0x8d, 0xbc,
+0x9f, 0x61, 0x1c, 0xe7, 0xfd, 0x24, 0x8c, 0xd1,
+0x44, 0x43, 0x8c, 0x16, 0xba, 0x9b, 0x4d, 0xa5,
+0xd4, 0x35, 0x2f, 0xbc, 0x11, 0xce, 0xbd, 0xf7,
+0x51, 0x37, 0x8d, 0x9f, 0x90, 0xe4, 0x14, 0xf1,
+0x18, 0x3f, 0xbe, 0xe9, 0x59, 0x12, 0x35, 0xf9,
+0x33, 0x92, 0xf3, 0x9e, 0xe0, 0xd5, 0x6b, 0x9a,
+0x71, 0x9b, 0x99, 0x4b, 0xc8, 0x71, 0xc3, 0xe1,
+0xb1, 0x61, 0x09, 0xc4, 0xe5, 0xfa, 0x91, 0xf0,
+0x42, 0x3a, 0x37, 0x7d, 0x34, 0xf9, 0x72, 0xe8,
+0xcd, 0xaa, 0x62, 0x1c, 0x21, 0xe9, 0xd5, 0xf4,
+0x82, 0x10, 0xe3, 0x7b, 0x05, 0xb6, 0x2d, 0x68,
+0x56, 0x0b, 0x7e, 0x7e, 0x92, 0x2c, 0x6f, 0x4d,
+0x72, 0x82, 0x0c, 0xed, 0x56, 0x74, 0xb2, 0x9d,
+0xb9, 0xab, 0x2d, 0x2b, 0x1d, 0x10, 0x5f, 0xdb,
+0x27, 0x75, 0x70, 0x8f, 0xfd, 0x1d, 0xd7, 0xe2,
+0x02, 0xa0, 0x79, 0xe5, 0x1c, 0xe5, 0xff, 0xaf,
+0x64, 0x40, 0x51, 0x2d, 0x9e, 0x9b, 0x47, 0xdb,
+0x42, 0xa5, 0x7c, 0x1f, 0xc2, 0xa6, 0x48, 0xb0,
+0xd7, 0xbe, 0x92, 0x69, 0x4d, 0xa4, 0xf6, 0x29,
+0x57, 0xc5, 0x78, 0x11, 0x18, 0xdc, 0x87, 0x51,
+0xca, 0x13, 0xb2, 0x62, 0x9d, 0x4f, 0x2b, 0x32,
+0xbd, 0x31, 0xa5, 0xc1, 0xfa, 0x52, 0xab, 0x05,
+0x88, 0xc8, 0x31, 0x00
@@ -22,6 +22,7 @@ typedef struct fz_locks_context_s fz_locks_context;
 typedef struct fz_tuning_context_s fz_tuning_context;
 typedef struct fz_store_s fz_store;
 typedef struct fz_glyph_cache_s fz_glyph_cache;
+typedef struct fz_face_cache_s fz_face_cache;
 typedef struct fz_document_handler_context_s fz_document_handler_context;
 typedef struct fz_output_context_s fz_output_context;
 typedef struct fz_context_s fz_context;
@@ -122,6 +123,7 @@ struct fz_context_s
 	fz_style_context *style;
 	fz_store *store;
 	fz_glyph_cache *glyph_cache;
+	fz_face_cache *face_cache;
 	fz_tuning_context *tuning;
 	fz_document_handler_context *handler;
 	fz_output_context *output;
@@ -277,6 +279,42 @@ void fz_tune_image_decode(fz_context *ctx, fz_tune_image_decode_fn *image_decode
 */
 void fz_tune_image_scale(fz_context *ctx, fz_tune_image_scale_fn *image_scale, void *arg);
 
+/*
+	fz_image_decode_threads: Get the number of threads that a
+	decoder may use for a single image.
+*/
+int fz_image_decode_threads(fz_context *ctx);
+
+/*
+	fz_set_image_decode_threads: Set the number of threads that a
+	decoder may use for a single image. Only JPEG 2000 images are
+	split up in this way, by tiles and code blocks. The default is
+	1, which decodes them on the calling thread.
+
+	Threads are only used if ctx has locking functions. The setting
+	is shared with any contexts cloned from ctx.
+*/
+void fz_set_image_decode_threads(fz_context *ctx, int threads);
+
+/*
+	fz_map_files: Get whether fz_open_file maps files into memory.
+*/
+int fz_map_files(fz_context *ctx);
+
+/*
+	fz_set_map_files: Set whether fz_open_file maps regular files
+	into memory rather than reading them. The default is 0, which
+	reads them.
+
+	A mapped file must not be truncated or rewritten in place while
+	any stream or buffer from it is in use: the process would be
+	killed with SIGBUS on touching the missing pages. Only turn this
+	on for files that are known to stay put, such as the input of a
+	batch tool. The setting is shared with any contexts cloned from
+	ctx.
+*/
+void fz_set_map_files(fz_context *ctx, int map);
+
 /*
 	fz_aa_level: Get the number of bits of antialiasing we are
 	using (for graphics). Between 0 and 8.
@@ -338,6 +376,62 @@ float fz_graphics_min_line_width(fz_context *ctx);
 */
 void fz_set_graphics_min_line_width(fz_context *ctx, float min_line_width);
 
+/*
+	fz_graphics_cell_threshold: Get the largest number of edges a
+	path may have for it to be anti-aliased by the cell scan
+	converter rather than the active edge one.
+*/
+int fz_graphics_cell_threshold(fz_context *ctx);
+
+/*
+	fz_set_graphics_cell_threshold: Set the largest number of edges
+	a path may have for it to be anti-aliased by the cell scan
+	converter rather than the active edge one. Both give identical
+	results; this exists for tuning and benchmarking.
+
+	threshold: The maximum number of edges (0 to always use the
+	active edge scan converter).
+*/
+void fz_set_graphics_cell_threshold(fz_context *ctx, int threshold);
+
+/*
+	CPU features that the rendering kernels can make use of.
+*/
+enum
+{
+	FZ_CPU_SSE2 = 1,
+	FZ_CPU_SSSE3 = 2,
+	FZ_CPU_SSE4_1 = 4,
+	FZ_CPU_AVX2 = 8
+};
+
+/*
+	fz_cpu_features: Get the set of FZ_CPU_... flags that the
+	rendering kernels are currently allowed to use.
+
+	The processor is probed when the first context is created. The
+	result is shared by all the contexts in the process.
+*/
+int fz_cpu_features(fz_context *ctx);
+
+/*
+	fz_set_cpu_features: Limit the rendering kernels to the given
+	set of FZ_CPU_... flags. Flags that the processor does not
+	support are ignored.
+
+	Pass 0 to use only the portable C code (for instance, to check
+	the output of the SIMD kernels against it), or ~0 to use
+	everything that the processor supports. This setting is shared
+	by all the contexts in the process.
+*/
+void fz_set_cpu_features(fz_context *ctx, int features);
+
+/*
+	fz_cpu_features_no_ctx: As fz_cpu_features, for the kernel
+	selection functions that are called without a context.
+*/
+int fz_cpu_features_no_ctx(void);
+
 /*
 	fz_user_css: Get the user stylesheet source text.
 */
@@ -367,6 +461,12 @@ void fz_set_user_css(fz_context *ctx, const char *text);
 	when we already hold any lock i, where 0 <= i <= n. In order
 	to verify this, we have some debugging code, that can be
 	enabled by defining FITZ_DEBUG_LOCKING.
+
+	The resource store and the glyph cache are split into shards,
+	each guarded by a lock of its own, from FZ_LOCK_STORE to
+	FZ_LOCK_STORE_LAST and from FZ_LOCK_GLYPHCACHE to
+	FZ_LOCK_GLYPHCACHE_LAST. No more than one shard lock of each is
+	ever held at a time.
 */
 
 struct fz_locks_context_s
@@ -379,8 +479,11 @@ struct fz_locks_context_s
 enum {
 	FZ_LOCK_REAP = 0,
 	FZ_LOCK_ALLOC,
+	FZ_LOCK_STORE,
+	FZ_LOCK_STORE_LAST = FZ_LOCK_STORE + 7,
 	FZ_LOCK_FREETYPE,
 	FZ_LOCK_GLYPHCACHE,
+	FZ_LOCK_GLYPHCACHE_LAST = FZ_LOCK_GLYPHCACHE + 7,
 	FZ_LOCK_MAX
 };
 
@@ -44,6 +44,10 @@ fz_display_list *fz_new_display_list(fz_context *ctx, const fz_rect *mediabox);
 	for each rendering. Once the device is no longer needed, free
 	it with fz_drop_device.
 
+	Closing the device with fz_close_device also builds a spatial
+	index over the list, so that runs with a small scissor (such
+	as bands or tiles) only visit the commands that can touch it.
+
 	list: A display list that the list device takes ownership of.
 */
 fz_device *fz_new_list_device(fz_context *ctx, fz_display_list *list);
@@ -75,6 +79,97 @@ fz_device *fz_new_list_device(fz_context *ctx, fz_display_list *list);
 */
 void fz_run_display_list(fz_context *ctx, fz_display_list *list, fz_device *dev, const fz_matrix *ctm, const fz_rect *area, fz_cookie *cookie);
 
+/*
+	fz_render_display_list_parallel: Draw a display list into a
+	pixmap using several threads.
+
+	The pixmap is split into tiles, which are drawn by a pool of
+	workers each running the list through a draw device of its own.
+	Workers that run out of tiles take over half of the remaining
+	tiles of another, so the load stays balanced however the
+	contents are spread over the page.
+
+	The calling thread is one of the workers; the others use
+	contexts made by fz_clone_context. If ctx has no locking
+	functions, or threads are not available, the list is drawn by
+	the calling thread alone.
+
+	list: The display list to draw.
+
+	ctm: Transform to apply to display list contents.
+
+	pix: The pixmap to draw into. As with fz_new_draw_device it is
+	not cleared first.
+
+	nthreads: The number of threads to draw with, including the
+	calling one.
+
+	cookie: If not NULL, progress counts the tiles drawn out of
+	progress_max, and errors and incomplete are gathered from all
+	the workers. Setting abort stops the workers taking any more
+	tiles.
+
+	Throws if any tile could not be drawn.
+*/
+void fz_render_display_list_parallel(fz_context *ctx, fz_display_list *list, const fz_matrix *ctm, fz_pixmap *pix, int nthreads, fz_cookie *cookie);
+
+/*
+	fz_prefetch_display_list_images: Decode the images that drawing
+	a display list will need into the store, using several threads.
+
+	The list is run once to find the images drawn within the area,
+	and the parts of them that the draw device will ask for at the
+	given transform. These are then decoded by a pool of workers,
+	the calling thread being one of them, so that when the list is
+	drawn the images are found ready in the store, having been
+	decoded side by side rather than one at a time.
+
+	Images that would not fit in half of the store are left for the
+	draw device to decode, as they would push the others out before
+	they were drawn. If ctx has no locking functions, threads are
+	not available, or nthreads is less than 2, nothing is done.
+
+	list: The display list to be drawn.
+
+	ctm: The transform the list will be drawn with.
+
+	area: The area (in device space) that will be drawn, or NULL
+	for everything.
+
+	nthreads: The number of threads to decode with, including the
+	calling one.
+
+	cookie: If not NULL, setting abort stops the workers taking any
+	more images.
+
+	Failures to decode are left for the draw device to report.
+*/
+void fz_prefetch_display_list_images(fz_context *ctx, fz_display_list *list, const fz_matrix *ctm, const fz_rect *area, int nthreads, fz_cookie *cookie);
+
+/*
+	fz_optimize_display_list: Simplify a display list, so that it
+	is quicker to replay.
+
+	Marks that are entirely covered by a later opaque rectangle are
+	removed, as are clips, groups and tiles with nothing left in
+	them, and rectangular clips that contain everything drawn within
+	them (taking the mediabox of the list as a clip). Runs of fills
+	of the same colour whose bounds do not overlap are merged into
+	single paths.
+
+	The result is meant for drawing. Covered text is lost to text
+	extraction, and where merged fills meet, or a covering rectangle
+	only partly covers a pixel, the antialiasing may differ slightly.
+
+	The list is rewritten in place, so it must not be in use by any
+	other thread. Lists that are not properly nested are left as
+	they are.
+
+	Returns the number of commands removed. Throws if the list
+	cannot be rewritten, in which case it is left unchanged.
+*/
+int fz_optimize_display_list(fz_context *ctx, fz_display_list *list);
+
 /*
 	fz_keep_display_list: Keep a reference to a display list.
 
@@ -116,4 +211,37 @@ fz_image *fz_new_image_from_display_list(fz_context *ctx, float w, float h, fz_d
 */
 int fz_display_list_is_empty(fz_context *ctx, const fz_display_list *list);
 
+
+/*
+	fz_save_display_list: Save a display list to a file.
+
+	The file holds the list together with the paths, text, fonts,
+	images, shadings and colorspaces it uses, so that it can be
+	loaded by fz_load_display_list_mapped and replayed without the
+	document it came from. Colorspaces other than the device ones are
+	saved as tables of their conversion to RGB, and Type 3 glyphs as
+	the display lists they were drawn into.
+
+	The file can only be loaded on the kind of machine that wrote it.
+
+	Throws if the list cannot be saved.
+*/
+void fz_save_display_list(fz_context *ctx, fz_display_list *list, const char *filename);
+
+/*
+	fz_load_display_list_mapped: Load a display list saved by
+	fz_save_display_list.
+
+	Where the platform allows it the file is mapped into memory, and
+	the nodes of the list are used where they lie, so that processes
+	loading the same file share most of its pages. Fonts, images and
+	shadings are copied out of it. The file must not be changed
+	while the list is in use.
+
+	A loaded list cannot be appended to.
+
+	Throws if the file cannot be read, or is corrupt.
+*/
+fz_display_list *fz_load_display_list_mapped(fz_context *ctx, const char *filename);
+
 #endif
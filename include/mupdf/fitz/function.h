@@ -13,6 +13,20 @@
 typedef struct fz_function_s fz_function;
 
 void fz_eval_function(fz_context *ctx, fz_function *func, const float *in, int inlen, float *out, int outlen);
+
+/*
+	fz_eval_function_n: Evaluate a function for count sets of inputs
+	at once.
+
+	in: count sets of inlen input values, one after another.
+
+	out: count sets of outlen output values, one after another.
+
+	Functions that can evaluate several sets of inputs together (such
+	as compiled PostScript calculator functions) do so, which is
+	quicker than evaluating them one at a time.
+*/
+void fz_eval_function_n(fz_context *ctx, fz_function *func, const float *in, int inlen, float *out, int outlen, int count);
 fz_function *fz_keep_function(fz_context *ctx, fz_function *func);
 void fz_drop_function(fz_context *ctx, fz_function *func);
 size_t fz_function_size(fz_context *ctx, fz_function *func);
@@ -35,6 +49,7 @@ struct fz_function_s
 	int m;					/* number of input values */
 	int n;					/* number of output values */
 	void (*evaluate)(fz_context *ctx, fz_function *func, const float *in, float *out);
+	void (*evaluate_n)(fz_context *ctx, fz_function *func, int count, const float *in, float *out); /* optional */
 	void (*print)(fz_context *ctx, fz_output *out, fz_function *func);
 };
 
@@ -6,7 +6,33 @@
 #include "mupdf/fitz/font.h"
 #include "mupdf/fitz/pixmap.h"
 
+/*
+	fz_purge_glyph_cache: Empty the glyph cache, both the part shared
+	by all the clones of a context and the local caches in front of
+	it. The local caches of other contexts are emptied the next time
+	they are used.
+*/
 void fz_purge_glyph_cache(fz_context *ctx);
+
+/*
+	fz_set_glyph_cache_size: Set the number of bytes of rendered
+	glyphs kept in the glyph cache shared by ctx and its clones.
+	Glyphs are evicted if the cache is already larger. The default
+	is 1 MB.
+
+	fz_glyph_cache_size: Get the size set above.
+*/
+void fz_set_glyph_cache_size(fz_context *ctx, size_t size);
+size_t fz_glyph_cache_size(fz_context *ctx);
+
+/*
+	fz_set_glyph_cache_local_size: Set the number of glyphs kept in
+	the small cache that ctx looks in before taking any lock on the
+	shared glyph cache. Clones start with the size of the context
+	they are cloned from. The default is 256; 0 turns it off.
+*/
+void fz_set_glyph_cache_local_size(fz_context *ctx, int len);
+
 fz_pixmap *fz_render_glyph_pixmap(fz_context *ctx, fz_font*, int, fz_matrix *, const fz_irect *scissor);
 void fz_render_t3_glyph_direct(fz_context *ctx, fz_device *dev, fz_font *font, int gid, const fz_matrix *trm, void *gstate, int nestedDepth);
 void fz_prepare_t3_glyph(fz_context *ctx, fz_font *font, int gid, int nestedDepth);
@@ -27,7 +27,9 @@ typedef struct fz_pixmap_image_s fz_pixmap_image;
 	image: The image to retrieve a pixmap from.
 
 	subarea: The subarea of the image that we actually care about (or NULL
-	to indicate the whole image).
+	to indicate the whole image). The pixmap returned may cover more
+	than this, as subareas are widened to share decoded tiles with
+	their neighbours.
 
 	trans: Optional, unless subarea is given. If given, then on entry this is
 	the transform that will be applied to the complete image. It should be
@@ -135,6 +137,21 @@ void fz_load_pnm_info(fz_context *ctx, unsigned char *data, size_t size, int *w,
 int fz_load_tiff_subimage_count(fz_context *ctx, unsigned char *buf, size_t len);
 fz_pixmap *fz_load_tiff_subimage(fz_context *ctx, unsigned char *buf, size_t len, int subimage);
 
+/*
+	fz_load_jpx_subarea: Decode part of a JPEG 2000 image, at a
+	reduced size. Only the tiles of the image that overlap the
+	subarea, and the resolution levels needed, are decoded.
+
+	subarea: On entry, the part of the image wanted (or NULL for
+	all of it). On exit, the part that was decoded, which may be
+	larger.
+
+	l2factor: On entry, the reduction in size wanted, as a power of
+	2 (or NULL for none). On exit, the reduction that is left to be
+	done, as the codestream may have fewer resolution levels.
+*/
+fz_pixmap *fz_load_jpx_subarea(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace *cs, int indexed, fz_irect *subarea, int *l2factor);
+
 void fz_image_resolution(fz_image *image, int *xres, int *yres);
 
 fz_pixmap *fz_compressed_image_tile(fz_context *ctx, fz_compressed_image *cimg);
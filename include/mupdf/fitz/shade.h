@@ -10,7 +10,9 @@
 #include "mupdf/fitz/compressed-buffer.h"
 
 /*
- * The shading code uses gouraud shaded triangle meshes.
+ * The shading code uses gouraud shaded triangle meshes, except for
+ * axial and radial shadings with a function, which are drawn by
+ * working out the colour of each pixel directly.
  */
 
 enum
@@ -115,6 +117,11 @@ fz_rect *fz_bound_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm,
 /*
 	fz_paint_shade: Render a shade to a given pixmap.
 
+	Axial and radial shadings that use a function are evaluated
+	exactly at each pixel, with the vector units of the processor
+	where fz_cpu_features allows; everything else is drawn as a
+	mesh of triangles.
+
 	shade: The shade to paint.
 
 	ctm: The transform to apply.
@@ -171,6 +178,12 @@ typedef void (fz_shade_process_fn)(fz_context *ctx, void *arg, fz_vertex *av, fz
 
 	ctm: The transform to use
 
+	scissor: If not NULL, only the parts of the shading within this
+	rectangle (in device space) need be processed. Patches of type 6
+	and 7 meshes that lie wholly outside it are skipped. Patches are
+	split more finely the larger and more curved they are under ctm,
+	so the scissor and ctm should be those the mesh is drawn with.
+
 	prepare: Callback function to 'prepare' each vertex.
 	This function is passed an array of floats, and populates
 	an fz_vertex structure.
@@ -182,7 +195,7 @@ typedef void (fz_shade_process_fn)(fz_context *ctx, void *arg, fz_vertex *av, fz
 	process_arg: An opaque argument passed through from caller
 	to callback functions.
 */
-void fz_process_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm,
+void fz_process_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, const fz_rect *scissor,
 			fz_shade_prepare_fn *prepare, fz_shade_process_fn *process, void *process_arg);
 
 /*
@@ -127,21 +127,47 @@ typedef struct fz_store_hash_s
 			fz_irect r;
 		} pir;
 		struct
+		{
+			const void *ptr[2];
+		} pp;
+		struct
 		{
 			int id;
+			char has_shape;
+			char aa, text_aa;
 			float m[4];
+			float phase[2];
+			const void *ptr;
 		} im;
 	} u;
 } fz_store_hash;
 
+/*
+	Each type also has a name, used when printing statistics, and a
+	cost: how expensive a byte of its values is to rebuild compared to
+	those of other types (where 0 is taken as 1). The cost is only used
+	by the FZ_STORE_POLICY_COST eviction policy.
+
+	A type may also provide pack and unpack functions, so that its
+	values are kept in the packed tier of the store once they are
+	evicted (see fz_set_store_packed_size). pack makes a compact copy
+	of a value, setting *size to the number of bytes it takes up, or
+	returns NULL if the value is not worth packing. unpack rebuilds the
+	value from such a copy, setting *size as for fz_store_item. Both
+	are called with no locks held, and may throw.
+*/
 typedef struct fz_store_type_s
 {
+	const char *name;
 	int (*make_hash_key)(fz_context *ctx, fz_store_hash *, void *);
 	void *(*keep_key)(fz_context *,void *);
 	void (*drop_key)(fz_context *,void *);
 	int (*cmp_key)(fz_context *ctx, void *, void *);
 	void (*print)(fz_context *ctx, fz_output *out, void *);
 	int (*needs_reap)(fz_context *ctx, void *);
+	int cost;
+	fz_storable *(*pack)(fz_context *ctx, void *key, fz_storable *val, size_t *size);
+	fz_storable *(*unpack)(fz_context *ctx, void *key, fz_storable *packed, size_t *size);
 } fz_store_type;
 
 /*
@@ -222,6 +248,9 @@ void fz_empty_store(fz_context *ctx);
 	failure to the caller, we try to scavenge space within the store by
 	evicting at least 'size' bytes. The allocator then retries.
 
+	Called with FZ_LOCK_ALLOC held; this is dropped while items are
+	evicted, and retaken before returning.
+
 	size: The number of bytes we are trying to have free.
 
 	phase: What phase of the scavenge we are in. Updated on exit.
@@ -245,8 +274,123 @@ typedef int (fz_store_filter_fn)(fz_context *ctx, void *arg, void *key);
 
 void fz_filter_store(fz_context *ctx, fz_store_filter_fn *fn, void *arg, fz_store_type *type);
 
+/*
+	Eviction policies, used to choose which items to evict when the
+	store is full.
+
+	FZ_STORE_POLICY_LRU: Evict the least recently used items first.
+	This is the default.
+
+	FZ_STORE_POLICY_2Q: Items are put on probation when they are
+	stored, and protected once they are used again. Items on
+	probation are evicted (least recently used first) before any
+	protected ones, unless the protected items take up more than 3/4
+	of the store. A long run of resources that are used only once
+	cannot push out those that are used over and over again.
+
+	FZ_STORE_POLICY_COST: Evict the items whose time since last use,
+	divided by the cost of their type, is greatest. Resources that are
+	expensive to rebuild stay in the store for longer.
+*/
+enum
+{
+	FZ_STORE_POLICY_LRU,
+	FZ_STORE_POLICY_2Q,
+	FZ_STORE_POLICY_COST
+};
+
+/*
+	fz_set_store_policy: Set the eviction policy of the store.
+
+	Items already in the store are kept, and are evicted according to
+	the new policy from then on.
+*/
+void fz_set_store_policy(fz_context *ctx, int policy);
+
+/*
+	fz_store_policy: Return the eviction policy of the store.
+*/
+int fz_store_policy(fz_context *ctx);
+
+/*
+	fz_store_max: Return the size the store is limited to, or
+	FZ_STORE_UNLIMITED (0) if it is not.
+*/
+size_t fz_store_max(fz_context *ctx);
+
+/*
+	fz_set_store_packed_size: Set the size of the packed tier of the
+	store.
+
+	Values of types that can be packed are packed as they are evicted
+	to make space in the store, and kept in the packed tier, which has
+	a budget of its own. Finding an item whose value is packed there
+	unpacks it and puts it back into the store, which is usually much
+	quicker than rebuilding it. Once the tier is full, the least
+	recently packed values are discarded.
+
+	The tier is only used once the store itself is full. It is empty
+	and unused (size 0) by default; making it smaller discards values
+	to fit.
+*/
+void fz_set_store_packed_size(fz_context *ctx, size_t max);
+
+/*
+	fz_store_stats: Counters for the items of one type in the store,
+	from when the store was created.
+
+	hits, misses: The number of lookups that found an item, and that
+	did not.
+
+	stores: The number of items stored.
+
+	evictions, evicted: The number of items evicted to make space, and
+	their total size. Items removed in other ways (such as by
+	fz_empty_store) are not counted.
+
+	count, size: The number of items in the store now, and their total
+	size.
+
+	packs, restores, discards: The number of values packed as they were
+	evicted, the number of lookups that found a packed value and
+	unpacked it, and the number of packed values discarded to keep the
+	packed tier within its budget.
+
+	packed_count, packed_size: The number of values in the packed tier
+	now, and their total packed size.
+*/
+typedef struct fz_store_stats_s
+{
+	int hits;
+	int misses;
+	int stores;
+	int evictions;
+	size_t evicted;
+	int count;
+	size_t size;
+	int packs;
+	int restores;
+	int discards;
+	int packed_count;
+	size_t packed_size;
+} fz_store_stats;
+
+/*
+	fz_store_stats_for_type: Read the counters for a type of item.
+*/
+void fz_store_stats_for_type(fz_context *ctx, const fz_store_type *type, fz_store_stats *stats);
+
+/*
+	fz_print_store_stats: Print the counters for every type of item
+	that has been stored or looked for.
+*/
+void fz_print_store_stats(fz_context *ctx, fz_output *out);
+
 /*
 	fz_print_store: Dump the contents of the store for debugging.
+
+	fz_print_store_locked is the same, but is called with
+	FZ_LOCK_ALLOC held (which it drops while printing).
 */
 void fz_print_store(fz_context *ctx, fz_output *out);
 void fz_print_store_locked(fz_context *ctx, fz_output *out);
@@ -30,6 +30,12 @@ typedef struct fz_stream_s fz_stream;
 	represented. Other platforms do the encoding as standard anyway (and
 	in most cases, particularly for MacOS and Linux, the encoding they
 	use is UTF-8 anyway).
+
+	If fz_set_map_files has been turned on, and the platform allows
+	it, regular files are mapped into memory rather than read, so
+	that reading and seeking cost no system calls, and
+	fz_slice_stream can share parts of the file without copying
+	them. See fz_set_map_files for the restrictions this brings.
 */
 fz_stream *fz_open_file(fz_context *ctx, const char *filename);
 
@@ -81,6 +87,23 @@ fz_stream *fz_open_memory(fz_context *ctx, unsigned char *data, size_t len);
 */
 fz_stream *fz_open_buffer(fz_context *ctx, fz_buffer *buf);
 
+/*
+	fz_slice_stream: Get part of a stream as a buffer that shares the
+	storage of the stream, rather than a copy of it.
+
+	This can be done for files that fz_open_file has mapped into
+	memory (see fz_set_map_files). The buffer keeps the mapping alive for as long as it is
+	held, and gets a copy of its own if it is resized. The stream
+	is not read, and its position is left as it was.
+
+	offset, len: The part of the stream wanted. It is cut short at
+	the end of the stream.
+
+	Returns NULL if the stream cannot be sliced, in which case the
+	data must be read. May throw exceptions on failure to allocate.
+*/
+fz_buffer *fz_slice_stream(fz_context *ctx, fz_stream *stm, fz_off_t offset, size_t len);
+
 /*
 	fz_open_leecher: Attach a filter to a stream that will store any
 	characters read from the stream into the supplied buffer.
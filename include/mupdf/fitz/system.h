@@ -53,6 +53,29 @@
 #endif
 #endif
 
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#ifndef ARCH_X86
+#define ARCH_X86
+#endif
+#endif
+
+/*
+	On x86 we carry SSE2/SSSE3/SSE4.1/AVX2 versions of the hottest
+	kernels, and pick between them at runtime (see fz_cpu_features).
+	This needs a compiler that can target extensions per function, so
+	that the rest of the library can still be built for a baseline
+	processor. Define FZ_NO_SIMD to build the portable C code only.
+*/
+#if defined(ARCH_X86) && !defined(FZ_NO_SIMD)
+#if defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)
+#define ARCH_X86_SIMD
+#define FZ_TARGET_SSE2 __attribute__((target("sse2")))
+#define FZ_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define FZ_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+#define FZ_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
 /*
 	Some differences in libc can be smoothed over
 */
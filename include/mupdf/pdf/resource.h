@@ -50,6 +50,7 @@ typedef struct pdf_pattern_s pdf_pattern;
 struct pdf_pattern_s
 {
 	fz_storable storable;
+	int id;
 	int ismask;
 	float xstep;
 	float ystep;
@@ -272,9 +272,16 @@ void fz_drop_glyph_cache_context(fz_context *ctx)
 {
 }
 
-fz_glyph_cache *fz_keep_glyph_cache(fz_context *ctx)
+void fz_clone_glyph_cache_context(fz_context *dst, fz_context *src)
+{
+}
+
+void fz_new_face_cache_context(fz_context *ctx)
+{
+}
+
+void fz_drop_face_cache_context(fz_context *ctx)
 {
-	return NULL;
 }
 
 void fz_new_document_handler_context(fz_context *ctx)
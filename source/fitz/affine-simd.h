@@ -0,0 +1,502 @@
+/*
+	This file is #included by draw-affine.c twice, to produce the
+	SSE4.1 and the AVX2 versions of the affine image painters.
+
+	Each pass of the loop steps 4 destination pixels along the row.
+	The u/v sample points, the inside tests and the (clamped) source
+	offsets for all 4 are worked out together; the source pixels are
+	then fetched as 4 byte words, and the interpolation and blending
+	is done for every component of the 4 pixels at once, in 16 bit
+	lanes laid out 4 to a pixel.
+
+	The lerp, fz_mul255 and FZ_BLEND steps round exactly as the C
+	templates do, so the results are identical to theirs. Rows with a
+	shape plane, and the pixels left over at the end of a row, are
+	handed to those templates.
+*/
+
+#ifdef SIMD_AVX2
+#define SIMD_TARGET FZ_TARGET_AVX2
+#define SIMD_NAME(NAME) NAME##_avx2
+#define W16 __m256i
+#else
+#define SIMD_TARGET FZ_TARGET_SSE4_1
+#define SIMD_NAME(NAME) NAME##_sse4_1
+#define W16 affine_w16
+#endif
+
+#ifdef SIMD_AVX2
+#define W16_OP2(NAME, OP256, OP128) \
+static inline SIMD_TARGET W16 SIMD_NAME(NAME)(W16 a, W16 b) \
+{ \
+	return OP256(a, b); \
+}
+#define W16_OP3(NAME, OP256, OP128) \
+static inline SIMD_TARGET W16 SIMD_NAME(NAME)(W16 a, W16 b, W16 c) \
+{ \
+	return OP256(a, b, c); \
+}
+#else
+#define W16_OP2(NAME, OP256, OP128) \
+static inline SIMD_TARGET W16 SIMD_NAME(NAME)(W16 a, W16 b) \
+{ \
+	a.lo = OP128(a.lo, b.lo); \
+	a.hi = OP128(a.hi, b.hi); \
+	return a; \
+}
+#define W16_OP3(NAME, OP256, OP128) \
+static inline SIMD_TARGET W16 SIMD_NAME(NAME)(W16 a, W16 b, W16 c) \
+{ \
+	a.lo = OP128(a.lo, b.lo, c.lo); \
+	a.hi = OP128(a.hi, b.hi, c.hi); \
+	return a; \
+}
+#endif
+
+W16_OP2(add, _mm256_add_epi16, _mm_add_epi16)
+W16_OP2(sub, _mm256_sub_epi16, _mm_sub_epi16)
+W16_OP2(mul, _mm256_mullo_epi16, _mm_mullo_epi16)
+W16_OP2(mulhi, _mm256_mulhi_epi16, _mm_mulhi_epi16)
+W16_OP2(and, _mm256_and_si256, _mm_and_si128)
+W16_OP2(andnot, _mm256_andnot_si256, _mm_andnot_si128)
+W16_OP2(cmpeq, _mm256_cmpeq_epi16, _mm_cmpeq_epi16)
+W16_OP2(shuffle, _mm256_shuffle_epi8, _mm_shuffle_epi8)
+W16_OP3(select, _mm256_blendv_epi8, _mm_blendv_epi8)
+
+#undef W16_OP2
+#undef W16_OP3
+
+static inline SIMD_TARGET W16
+SIMD_NAME(widen)(__m128i v)
+{
+#ifdef SIMD_AVX2
+	return _mm256_cvtepu8_epi16(v);
+#else
+	W16 r;
+	r.lo = _mm_unpacklo_epi8(v, _mm_setzero_si128());
+	r.hi = _mm_unpackhi_epi8(v, _mm_setzero_si128());
+	return r;
+#endif
+}
+
+/* Back to bytes, keeping the low 8 bits of each lane just as a store
+ * of an int to a byte does. */
+static inline SIMD_TARGET __m128i
+SIMD_NAME(narrow)(W16 v)
+{
+#ifdef SIMD_AVX2
+	v = _mm256_and_si256(v, _mm256_set1_epi16(255));
+	return _mm_packus_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+#else
+	v.lo = _mm_and_si128(v.lo, _mm_set1_epi16(255));
+	v.hi = _mm_and_si128(v.hi, _mm_set1_epi16(255));
+	return _mm_packus_epi16(v.lo, v.hi);
+#endif
+}
+
+static inline SIMD_TARGET W16
+SIMD_NAME(splat)(int v)
+{
+#ifdef SIMD_AVX2
+	return _mm256_set1_epi16(v);
+#else
+	W16 r;
+	r.lo = r.hi = _mm_set1_epi16(v);
+	return r;
+#endif
+}
+
+/* The same 16 byte pattern in each 128 bit half. */
+static inline SIMD_TARGET W16
+SIMD_NAME(pattern)(__m128i p)
+{
+#ifdef SIMD_AVX2
+	return _mm256_broadcastsi128_si256(p);
+#else
+	W16 r;
+	r.lo = r.hi = p;
+	return r;
+#endif
+}
+
+/* Spread the low 16 bits of each of 4 ints over the 4 lanes of the
+ * matching pixel. */
+static inline SIMD_TARGET W16
+SIMD_NAME(per_pixel)(__m128i v)
+{
+	const __m128i p01 = _mm_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 4, 5, 4, 5, 4, 5, 4, 5);
+	const __m128i p23 = _mm_setr_epi8(8, 9, 8, 9, 8, 9, 8, 9, 12, 13, 12, 13, 12, 13, 12, 13);
+#ifdef SIMD_AVX2
+	return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(v), _mm256_inserti128_si256(_mm256_castsi128_si256(p01), p23, 1));
+#else
+	W16 r;
+	r.lo = _mm_shuffle_epi8(v, p01);
+	r.hi = _mm_shuffle_epi8(v, p23);
+	return r;
+#endif
+}
+
+/* lerp(a, b, t) for t in 0..65535. mulhi treats t as signed, which
+ * for t >= 32768 takes b-a away from the true result; put it back. */
+static inline SIMD_TARGET W16
+SIMD_NAME(lerp)(W16 a, W16 b, W16 t, W16 tneg)
+{
+	W16 d = SIMD_NAME(sub)(b, a);
+	return SIMD_NAME(add)(a, SIMD_NAME(add)(SIMD_NAME(mulhi)(d, t), SIMD_NAME(and)(d, tneg)));
+}
+
+/* fz_mul255 for a and b in 0..255. */
+static inline SIMD_TARGET W16
+SIMD_NAME(mul255)(W16 a, W16 b)
+{
+	W16 x = SIMD_NAME(add)(SIMD_NAME(mul)(a, b), SIMD_NAME(splat)(128));
+#ifdef SIMD_AVX2
+	x = _mm256_add_epi16(x, _mm256_srli_epi16(x, 8));
+	return _mm256_srli_epi16(x, 8);
+#else
+	x.lo = _mm_add_epi16(x.lo, _mm_srli_epi16(x.lo, 8));
+	x.hi = _mm_add_epi16(x.hi, _mm_srli_epi16(x.hi, 8));
+	x.lo = _mm_srli_epi16(x.lo, 8);
+	x.hi = _mm_srli_epi16(x.hi, 8);
+	return x;
+#endif
+}
+
+/* FZ_BLEND; the intermediate steps may wrap, the result does not. */
+static inline SIMD_TARGET W16
+SIMD_NAME(blend)(W16 s, W16 d, W16 a)
+{
+#ifdef SIMD_AVX2
+	return _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(s, d), a), _mm256_slli_epi16(d, 8)), 8);
+#else
+	W16 r;
+	r.lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(s.lo, d.lo), a.lo), _mm_slli_epi16(d.lo, 8)), 8);
+	r.hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(s.hi, d.hi), a.hi), _mm_slli_epi16(d.hi, 8)), 8);
+	return r;
+#endif
+}
+
+/* FZ_COMBINE(FZ_EXPAND(a), b) */
+static inline SIMD_TARGET W16
+SIMD_NAME(expand_combine)(W16 a, W16 b)
+{
+#ifdef SIMD_AVX2
+	a = _mm256_add_epi16(a, _mm256_srli_epi16(a, 7));
+	return _mm256_srli_epi16(_mm256_mullo_epi16(a, b), 8);
+#else
+	a.lo = _mm_add_epi16(a.lo, _mm_srli_epi16(a.lo, 7));
+	a.hi = _mm_add_epi16(a.hi, _mm_srli_epi16(a.hi, 7));
+	a.lo = _mm_srli_epi16(_mm_mullo_epi16(a.lo, b.lo), 8);
+	a.hi = _mm_srli_epi16(_mm_mullo_epi16(a.hi, b.hi), 8);
+	return a;
+#endif
+}
+
+/* Fetch the source pixels at 4 byte offsets as 4 byte words. The
+ * last few pixels of the image can't be read as a whole word; for
+ * those we read the last word of the image, and shift the pixel down
+ * to the bottom of it. The bytes above the pixel are never used. */
+static inline SIMD_TARGET __m128i
+SIMD_NAME(fetch)(const byte * restrict sp, __m128i off, __m128i safe)
+{
+	__m128i o = _mm_min_epi32(off, safe);
+	__m128i shift = _mm_slli_epi32(_mm_sub_epi32(off, o), 3);
+#ifdef SIMD_AVX2
+	return _mm_srlv_epi32(_mm_i32gather_epi32((const int *)sp, o, 1), shift);
+#else
+	int o0 = _mm_cvtsi128_si32(o);
+	int o1 = _mm_extract_epi32(o, 1);
+	int o2 = _mm_extract_epi32(o, 2);
+	int o3 = _mm_extract_epi32(o, 3);
+	unsigned int s0, s1, s2, s3;
+	memcpy(&s0, sp + o0, 4);
+	memcpy(&s1, sp + o1, 4);
+	memcpy(&s2, sp + o2, 4);
+	memcpy(&s3, sp + o3, 4);
+	s0 >>= _mm_cvtsi128_si32(shift);
+	s1 >>= _mm_extract_epi32(shift, 1);
+	s2 >>= _mm_extract_epi32(shift, 2);
+	s3 >>= _mm_extract_epi32(shift, 3);
+	return _mm_setr_epi32(s0, s1, s2, s3);
+#endif
+}
+
+/* Load and store 4 destination pixels of dn bytes each, spread out to
+ * 4 bytes each. */
+static inline SIMD_TARGET __m128i
+SIMD_NAME(load_dst)(const byte * restrict dp, int dn, __m128i expand)
+{
+	__m128i d;
+	int t;
+
+	switch (dn)
+	{
+	case 4:
+		return _mm_loadu_si128((const __m128i *)dp);
+	case 3:
+		memcpy(&t, dp + 8, 4);
+		d = _mm_insert_epi32(_mm_loadl_epi64((const __m128i *)dp), t, 2);
+		break;
+	case 2:
+		d = _mm_loadl_epi64((const __m128i *)dp);
+		break;
+	default:
+		memcpy(&t, dp, 4);
+		d = _mm_cvtsi32_si128(t);
+		break;
+	}
+	return _mm_shuffle_epi8(d, expand);
+}
+
+static inline SIMD_TARGET void
+SIMD_NAME(store_dst)(byte * restrict dp, int dn, __m128i d, __m128i compact)
+{
+	int t;
+
+	if (dn == 4)
+	{
+		_mm_storeu_si128((__m128i *)dp, d);
+		return;
+	}
+	d = _mm_shuffle_epi8(d, compact);
+	switch (dn)
+	{
+	case 3:
+		_mm_storel_epi64((__m128i *)dp, d);
+		t = _mm_extract_epi32(d, 2);
+		memcpy(dp + 8, &t, 4);
+		break;
+	case 2:
+		_mm_storel_epi64((__m128i *)dp, d);
+		break;
+	default:
+		t = _mm_cvtsi128_si32(d);
+		memcpy(dp, &t, 4);
+		break;
+	}
+}
+
+/* Paint w/4 blocks of 4 pixels, and return the number of pixels done.
+ * n1 is the number of destination colorants. For AFFINE_COLOR the
+ * source is a 1 byte mask painted in color; for AFFINE_G2RGB it is
+ * gray (plus alpha), painted to rgb. */
+static inline SIMD_TARGET int
+SIMD_NAME(affine_blocks)(byte * restrict dp, int da, const byte * restrict sp, int sw, int sh, int ss, int sa, int u, int v, int fa, int fb, int w, int n1, int alpha, const byte * restrict color, int lerp, int kind)
+{
+	int ps = kind == AFFINE_N ? n1 + sa : kind == AFFINE_G2RGB ? 1 + sa : 1;
+	int dn = n1 + da;
+	int iw = lerp ? sw >> 16 : sw;
+	int ih = lerp ? sh >> 16 : sh;
+	int safe = ss * (ih - 1) + iw * ps - 4;
+	int blocks = safe < 0 ? 0 : w >> 2;
+	int opaque = kind != AFFINE_COLOR && !sa && alpha == 255;
+	int k, p;
+	byte shuf[16];
+	__m128i src_shuffle, dst_expand, dst_compact;
+	__m128i vu, vv, vfa, vfb, vmaxu, vmaxv, vss, vps, vsafe;
+	W16 alpha_bcast, alpha_lane, vcolor, valpha, v255, zero;
+
+	/* Rearrange the source word of each pixel into destination order. */
+	for (p = 0; p < 4; p++)
+		for (k = 0; k < 4; k++)
+		{
+			if (kind == AFFINE_COLOR)
+				shuf[4*p+k] = 4*p;
+			else if (kind == AFFINE_G2RGB)
+				shuf[4*p+k] = 4*p + (k == 3);
+			else
+				shuf[4*p+k] = 4*p+k;
+		}
+	src_shuffle = _mm_loadu_si128((const __m128i *)shuf);
+	/* Between dn bytes and 4 bytes per destination pixel. */
+	for (p = 0; p < 4; p++)
+		for (k = 0; k < 4; k++)
+			shuf[4*p+k] = k < dn ? p*dn+k : 0x80;
+	dst_expand = _mm_loadu_si128((const __m128i *)shuf);
+	memset(shuf, 0x80, 16);
+	for (p = 0; p < 4; p++)
+		for (k = 0; k < dn; k++)
+			shuf[p*dn+k] = 4*p+k;
+	dst_compact = _mm_loadu_si128((const __m128i *)shuf);
+	/* Lane n1 (the alpha) of each pixel copied to all 4 of its lanes,
+	 * and a mask of just that lane. */
+	for (p = 0; p < 16; p += 8)
+		for (k = 0; k < 4; k++)
+		{
+			shuf[p+2*k] = p + 2*n1;
+			shuf[p+2*k+1] = p + 2*n1 + 1;
+		}
+	alpha_bcast = SIMD_NAME(pattern)(_mm_loadu_si128((const __m128i *)shuf));
+	alpha_lane = SIMD_NAME(pattern)(n1 == 0 ? _mm_setr_epi16(-1, 0, 0, 0, -1, 0, 0, 0) :
+		n1 == 1 ? _mm_setr_epi16(0, -1, 0, 0, 0, -1, 0, 0) :
+		n1 == 2 ? _mm_setr_epi16(0, 0, -1, 0, 0, 0, -1, 0) :
+		_mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1));
+	if (kind == AFFINE_COLOR)
+	{
+		for (p = 0; p < 4; p++)
+			for (k = 0; k < 4; k++)
+				shuf[4*p+k] = k < n1 ? color[k] : 255;
+		vcolor = SIMD_NAME(widen)(_mm_loadu_si128((const __m128i *)shuf));
+		valpha = SIMD_NAME(splat)(color[n1]);
+	}
+	else
+	{
+		vcolor = SIMD_NAME(splat)(0);
+		valpha = SIMD_NAME(splat)(alpha);
+	}
+	v255 = SIMD_NAME(splat)(255);
+	zero = SIMD_NAME(splat)(0);
+
+	vu = _mm_add_epi32(_mm_set1_epi32(u), _mm_mullo_epi32(_mm_set1_epi32(fa), _mm_setr_epi32(0, 1, 2, 3)));
+	vv = _mm_add_epi32(_mm_set1_epi32(v), _mm_mullo_epi32(_mm_set1_epi32(fb), _mm_setr_epi32(0, 1, 2, 3)));
+	vfa = _mm_set1_epi32(fa * 4);
+	vfb = _mm_set1_epi32(fb * 4);
+	vmaxu = _mm_set1_epi32(iw - 1);
+	vmaxv = _mm_set1_epi32(ih - 1);
+	vss = _mm_set1_epi32(ss);
+	vps = _mm_set1_epi32(ps);
+	vsafe = _mm_set1_epi32(safe);
+
+	for (p = blocks; p > 0; p--)
+	{
+		__m128i inside, ui, vi, d;
+		W16 x, y, dst, res, mask;
+
+		ui = _mm_srai_epi32(vu, 16);
+		vi = _mm_srai_epi32(vv, 16);
+		if (lerp)
+		{
+			const __m128i half = _mm_set1_epi32(32768);
+			const __m128i ffff = _mm_set1_epi32(0xffff);
+			__m128i u0, u1, v0, v1, r0, r1;
+			W16 uf, vf, ufneg, vfneg, a, b, c, dd;
+
+			inside = _mm_and_si128(
+				_mm_and_si128(_mm_cmpgt_epi32(_mm_add_epi32(vu, half), _mm_set1_epi32(-1)), _mm_cmpgt_epi32(_mm_set1_epi32(sw), vu)),
+				_mm_and_si128(_mm_cmpgt_epi32(_mm_add_epi32(vv, half), _mm_set1_epi32(-1)), _mm_cmpgt_epi32(_mm_set1_epi32(sh), vv)));
+			if (_mm_testz_si128(inside, inside))
+				goto next;
+			u0 = _mm_max_epi32(_mm_min_epi32(ui, vmaxu), _mm_setzero_si128());
+			u1 = _mm_max_epi32(_mm_min_epi32(_mm_add_epi32(ui, _mm_set1_epi32(1)), vmaxu), _mm_setzero_si128());
+			v0 = _mm_max_epi32(_mm_min_epi32(vi, vmaxv), _mm_setzero_si128());
+			v1 = _mm_max_epi32(_mm_min_epi32(_mm_add_epi32(vi, _mm_set1_epi32(1)), vmaxv), _mm_setzero_si128());
+			r0 = _mm_mullo_epi32(v0, vss);
+			r1 = _mm_mullo_epi32(v1, vss);
+			u0 = _mm_mullo_epi32(u0, vps);
+			u1 = _mm_mullo_epi32(u1, vps);
+			a = SIMD_NAME(widen)(_mm_shuffle_epi8(SIMD_NAME(fetch)(sp, _mm_add_epi32(r0, u0), vsafe), src_shuffle));
+			b = SIMD_NAME(widen)(_mm_shuffle_epi8(SIMD_NAME(fetch)(sp, _mm_add_epi32(r0, u1), vsafe), src_shuffle));
+			c = SIMD_NAME(widen)(_mm_shuffle_epi8(SIMD_NAME(fetch)(sp, _mm_add_epi32(r1, u0), vsafe), src_shuffle));
+			dd = SIMD_NAME(widen)(_mm_shuffle_epi8(SIMD_NAME(fetch)(sp, _mm_add_epi32(r1, u1), vsafe), src_shuffle));
+			uf = SIMD_NAME(per_pixel)(_mm_and_si128(vu, ffff));
+			vf = SIMD_NAME(per_pixel)(_mm_and_si128(vv, ffff));
+			ufneg = SIMD_NAME(per_pixel)(_mm_sub_epi32(_mm_setzero_si128(), _mm_srli_epi32(_mm_and_si128(vu, ffff), 15)));
+			vfneg = SIMD_NAME(per_pixel)(_mm_sub_epi32(_mm_setzero_si128(), _mm_srli_epi32(_mm_and_si128(vv, ffff), 15)));
+			x = SIMD_NAME(lerp)(SIMD_NAME(lerp)(a, b, uf, ufneg), SIMD_NAME(lerp)(c, dd, uf, ufneg), vf, vfneg);
+		}
+		else
+		{
+			__m128i u0, v0;
+
+			inside = _mm_and_si128(
+				_mm_andnot_si128(_mm_cmpgt_epi32(_mm_setzero_si128(), ui), _mm_cmpgt_epi32(_mm_set1_epi32(sw), ui)),
+				_mm_andnot_si128(_mm_cmpgt_epi32(_mm_setzero_si128(), vi), _mm_cmpgt_epi32(_mm_set1_epi32(sh), vi)));
+			if (_mm_testz_si128(inside, inside))
+				goto next;
+			u0 = _mm_max_epi32(_mm_min_epi32(ui, vmaxu), _mm_setzero_si128());
+			v0 = _mm_max_epi32(_mm_min_epi32(vi, vmaxv), _mm_setzero_si128());
+			d = _mm_add_epi32(_mm_mullo_epi32(v0, vss), _mm_mullo_epi32(u0, vps));
+			x = SIMD_NAME(widen)(_mm_shuffle_epi8(SIMD_NAME(fetch)(sp, d, vsafe), src_shuffle));
+		}
+
+		dst = SIMD_NAME(widen)(SIMD_NAME(load_dst)(dp, dn, dst_expand));
+		mask = SIMD_NAME(per_pixel)(inside);
+
+		if (kind == AFFINE_COLOR)
+		{
+			/* masa = FZ_COMBINE(FZ_EXPAND(ma), sa); blending with a
+			 * masa of 0 leaves the destination as it was. */
+			y = SIMD_NAME(expand_combine)(x, valpha);
+			res = SIMD_NAME(blend)(vcolor, dst, y);
+		}
+		else if (opaque)
+		{
+			/* An alpha of 255 replaces the destination outright. */
+			res = da ? SIMD_NAME(select)(x, v255, alpha_lane) : x;
+		}
+		else
+		{
+			y = sa ? SIMD_NAME(shuffle)(x, alpha_bcast) : v255;
+			if (alpha != 255)
+			{
+				y = sa ? SIMD_NAME(mul255)(y, valpha) : valpha;
+				x = SIMD_NAME(mul255)(x, valpha);
+			}
+			if (da && !sa)
+				x = SIMD_NAME(select)(x, y, alpha_lane);
+			res = SIMD_NAME(add)(x, SIMD_NAME(mul255)(dst, SIMD_NAME(sub)(v255, y)));
+			mask = SIMD_NAME(andnot)(SIMD_NAME(cmpeq)(y, zero), mask);
+		}
+
+		SIMD_NAME(store_dst)(dp, dn, SIMD_NAME(narrow)(SIMD_NAME(select)(dst, res, mask)), dst_compact);
+next:
+		dp += 4 * dn;
+		vu = _mm_add_epi32(vu, vfa);
+		vv = _mm_add_epi32(vv, vfb);
+	}
+
+	return blocks << 2;
+}
+
+#define AFFINE_PAINTER(NAME, KIND, N1, LERP, TAIL) \
+static SIMD_TARGET void \
+SIMD_NAME(NAME)(byte * restrict dp, int da, const byte * restrict sp, int sw, int sh, int ss, int sa, int u, int v, int fa, int fb, int w, int n, int alpha, const byte * restrict color, byte * restrict hp) \
+{ \
+	int done = 0; \
+	TRACK_FN(); \
+	if (!hp) \
+		done = SIMD_NAME(affine_blocks)(dp, da, sp, sw, sh, ss, sa, u, v, fa, fb, w, N1, alpha, color, LERP, KIND); \
+	if (done < w) \
+		TAIL; \
+}
+
+#define AFFINE_TAIL_N(LERPNEAR) \
+	(alpha == 255 ? \
+	template_affine_N_##LERPNEAR(dp + done * (n + da), da, sp, sw, sh, ss, sa, u + done * fa, v + done * fb, fa, fb, w - done, n, hp) : \
+	template_affine_alpha_N_##LERPNEAR(dp + done * (n + da), da, sp, sw, sh, ss, sa, u + done * fa, v + done * fb, fa, fb, w - done, n, alpha, hp))
+#define AFFINE_TAIL_G2RGB(LERPNEAR) \
+	(alpha == 255 ? \
+	template_affine_solid_g2rgb_##LERPNEAR(dp + done * (3 + da), da, sp, sw, sh, ss, sa, u + done * fa, v + done * fb, fa, fb, w - done, hp) : \
+	template_affine_alpha_g2rgb_##LERPNEAR(dp + done * (3 + da), da, sp, sw, sh, ss, sa, u + done * fa, v + done * fb, fa, fb, w - done, alpha, hp))
+#define AFFINE_TAIL_COLOR(LERPNEAR) \
+	template_affine_color_N_##LERPNEAR(dp + done * (n + da), da, sp, sw, sh, ss, u + done * fa, v + done * fb, fa, fb, w - done, n, color, hp)
+
+#if FZ_PLOTTERS_G
+AFFINE_PAINTER(paint_affine_lerp_1, AFFINE_N, 1, 1, AFFINE_TAIL_N(lerp))
+AFFINE_PAINTER(paint_affine_near_1, AFFINE_N, 1, 0, AFFINE_TAIL_N(near))
+AFFINE_PAINTER(paint_affine_color_lerp_1, AFFINE_COLOR, 1, 1, AFFINE_TAIL_COLOR(lerp))
+AFFINE_PAINTER(paint_affine_color_near_1, AFFINE_COLOR, 1, 0, AFFINE_TAIL_COLOR(near))
+#endif /* FZ_PLOTTERS_G */
+#if FZ_PLOTTERS_RGB
+AFFINE_PAINTER(paint_affine_lerp_3, AFFINE_N, 3, 1, AFFINE_TAIL_N(lerp))
+AFFINE_PAINTER(paint_affine_near_3, AFFINE_N, 3, 0, AFFINE_TAIL_N(near))
+AFFINE_PAINTER(paint_affine_lerp_g2rgb, AFFINE_G2RGB, 3, 1, AFFINE_TAIL_G2RGB(lerp))
+AFFINE_PAINTER(paint_affine_near_g2rgb, AFFINE_G2RGB, 3, 0, AFFINE_TAIL_G2RGB(near))
+AFFINE_PAINTER(paint_affine_color_lerp_3, AFFINE_COLOR, 3, 1, AFFINE_TAIL_COLOR(lerp))
+AFFINE_PAINTER(paint_affine_color_near_3, AFFINE_COLOR, 3, 0, AFFINE_TAIL_COLOR(near))
+#endif /* FZ_PLOTTERS_RGB */
+#if FZ_PLOTTERS_CMYK
+AFFINE_PAINTER(paint_affine_lerp_4, AFFINE_N, 4, 1, AFFINE_TAIL_N(lerp))
+AFFINE_PAINTER(paint_affine_near_4, AFFINE_N, 4, 0, AFFINE_TAIL_N(near))
+AFFINE_PAINTER(paint_affine_color_lerp_4, AFFINE_COLOR, 4, 1, AFFINE_TAIL_COLOR(lerp))
+AFFINE_PAINTER(paint_affine_color_near_4, AFFINE_COLOR, 4, 0, AFFINE_TAIL_COLOR(near))
+#endif /* FZ_PLOTTERS_CMYK */
+
+#undef AFFINE_PAINTER
+#undef AFFINE_TAIL_N
+#undef AFFINE_TAIL_G2RGB
+#undef AFFINE_TAIL_COLOR
+#undef W16
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef SIMD_AVX2
@@ -64,6 +64,21 @@ fz_new_buffer_from_shared_data(fz_context *ctx, const char *data, size_t size)
 	return b;
 }
 
+fz_buffer *
+fz_new_buffer_slice(fz_context *ctx, fz_buffer *buf, size_t offset, size_t len)
+{
+	fz_buffer *b;
+
+	assert(buf->shared && offset <= buf->len && len <= buf->len - offset);
+
+	b = fz_new_buffer_from_shared_data(ctx, (const char *)buf->data + offset, len);
+	/* Share the storage with whoever owns it, rather than chaining
+	 * slices of slices. */
+	b->parent = fz_keep_buffer(ctx, buf->parent ? buf->parent : buf);
+
+	return b;
+}
+
 fz_buffer *
 fz_new_buffer_from_base64(fz_context *ctx, const char *data, size_t size)
 {
@@ -106,7 +121,11 @@ fz_drop_buffer(fz_context *ctx, fz_buffer *buf)
 {
 	if (fz_drop_imp(ctx, buf, &buf->refs))
 	{
-		if (!buf->shared)
+		if (buf->parent)
+			fz_drop_buffer(ctx, buf->parent);
+		else if (buf->unmap)
+			buf->unmap(buf->data, buf->cap);
+		else if (!buf->shared)
 			fz_free(ctx, buf->data);
 		fz_free(ctx, buf);
 	}
@@ -115,6 +134,20 @@ fz_drop_buffer(fz_context *ctx, fz_buffer *buf)
 void
 fz_resize_buffer(fz_context *ctx, fz_buffer *buf, size_t size)
 {
+	if (buf->parent)
+	{
+		/* A slice takes a copy of the part it shares. */
+		unsigned char *data = fz_malloc(ctx, size);
+		memcpy(data, buf->data, fz_minz(buf->len, size));
+		fz_drop_buffer(ctx, buf->parent);
+		buf->parent = NULL;
+		buf->shared = 0;
+		buf->data = data;
+		buf->cap = size;
+		if (buf->len > buf->cap)
+			buf->len = buf->cap;
+		return;
+	}
 	if (buf->shared)
 		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot resize a buffer with shared storage");
 	buf->data = fz_resize_array(ctx, buf->data, size, 1);
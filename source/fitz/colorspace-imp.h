@@ -13,4 +13,15 @@ struct fz_colorspace_s
 	void *data;
 };
 
+/* Returns the highest index of an indexed colorspace, along with its
+ * base colorspace and lookup table (both still owned by cs). */
+int fz_indexed_colorspace_lookup(fz_context *ctx, fz_colorspace *cs, fz_colorspace **base, unsigned char **lookup);
+
+/* Converts a pixmap of 3 or 4 components (other than Lab) by
+ * interpolating in a table of samples of the conversion, kept in the
+ * store. Returns 0, having done nothing, if the colorspaces are not
+ * suited to it, or if the pixmap is too small to be worth making a
+ * table for. See colorspace-lut.c. */
+int fz_convert_pixmap_lut(fz_context *ctx, fz_pixmap *dst, fz_pixmap *src);
+
 #endif
@@ -0,0 +1,497 @@
+#include "mupdf/fitz.h"
+#include "colorspace-imp.h"
+
+#include <string.h>
+
+/*
+	Conversion of pixmaps through sampled tables.
+
+	Colorspaces without a fast path of their own (DeviceN with its tint
+	transform, and any other colorspace with conversion functions of
+	its own) would otherwise be converted with a call through to_rgb
+	and from_rgb for each new colour. For 3 and 4 component sources we
+	sample the conversion once, on a regular grid, and interpolate
+	between the grid points.
+
+	Lab is left to fz_std_conv_pixmap: it is quick to convert exactly,
+	and the square root in lab_to_rgb is too steep near black for a
+	table of this size.
+
+	With 3 components the interpolation is tetrahedral: the cube of
+	the grid that the colour falls in is split into 6 tetrahedra along
+	its diagonal, and the colour is a weighted sum of the 4 corners of
+	the one it lies in. With 4 components we do that in the first 3 at
+	the planes either side of the colour in the 4th (so K, for CMYK),
+	and interpolate linearly between the two.
+
+	Grid points hold 4 output values (padded with 0s) in 8.7 fixed
+	point, and the weights are out of 256, so that the SSE2 version can
+	do a corner pair with one multiply-add, and gives exactly the same
+	results as the C one.
+
+	Tables are kept in the store, keyed by the pair of colorspaces.
+*/
+
+/* Grid points along each axis, for 3 and 4 component sources. */
+#define LUT_GRID_3 33
+#define LUT_GRID_4 17
+
+/* Sampling the conversion costs about as much as converting this many
+ * distinct colours, so smaller pixmaps are converted directly. This
+ * depends on the size alone, and not on whether a table happens to be
+ * in the store, so that the result does not depend on what was drawn
+ * before. */
+#define LUT_MIN_PIXELS 65536
+
+typedef struct fz_color_lut_s fz_color_lut;
+typedef struct fz_color_lut_key_s fz_color_lut_key;
+
+struct fz_color_lut_s
+{
+	fz_storable storable;
+	int srcn, dstn, grid;
+	/* Offsets (in shorts) into the table of a step along each axis. */
+	int stride[4];
+	/* For each sample value, the offset of the grid point below it
+	 * along each axis, and how far (out of 256) it is from there
+	 * towards the next. */
+	int offset[4][256];
+	int frac[256];
+	short *table;
+};
+
+struct fz_color_lut_key_s
+{
+	int refs;
+	fz_colorspace *ss;
+	fz_colorspace *ds;
+};
+
+static void
+fz_drop_color_lut_imp(fz_context *ctx, fz_storable *lut_)
+{
+	fz_color_lut *lut = (fz_color_lut *)lut_;
+
+	fz_free(ctx, lut->table);
+	fz_free(ctx, lut);
+}
+
+static size_t
+fz_color_lut_size(fz_color_lut *lut)
+{
+	size_t count = 1;
+	int k;
+
+	for (k = 0; k < lut->srcn; k++)
+		count *= lut->grid;
+	return sizeof(*lut) + count * 4 * sizeof(short);
+}
+
+static int
+fz_make_hash_color_lut_key(fz_context *ctx, fz_store_hash *hash, void *key_)
+{
+	fz_color_lut_key *key = (fz_color_lut_key *)key_;
+	hash->u.pp.ptr[0] = key->ss;
+	hash->u.pp.ptr[1] = key->ds;
+	return 1;
+}
+
+static void *
+fz_keep_color_lut_key(fz_context *ctx, void *key_)
+{
+	fz_color_lut_key *key = (fz_color_lut_key *)key_;
+	return fz_keep_imp(ctx, key, &key->refs);
+}
+
+static void
+fz_drop_color_lut_key(fz_context *ctx, void *key_)
+{
+	fz_color_lut_key *key = (fz_color_lut_key *)key_;
+	if (key && fz_drop_imp(ctx, key, &key->refs))
+	{
+		fz_drop_colorspace(ctx, key->ss);
+		fz_drop_colorspace(ctx, key->ds);
+		fz_free(ctx, key);
+	}
+}
+
+static int
+fz_cmp_color_lut_key(fz_context *ctx, void *k0_, void *k1_)
+{
+	fz_color_lut_key *k0 = (fz_color_lut_key *)k0_;
+	fz_color_lut_key *k1 = (fz_color_lut_key *)k1_;
+	return k0->ss == k1->ss && k0->ds == k1->ds;
+}
+
+static void
+fz_print_color_lut_key(fz_context *ctx, fz_output *out, void *key_)
+{
+	fz_color_lut_key *key = (fz_color_lut_key *)key_;
+	fz_printf(ctx, out, "(color lut %s to %s) ", key->ss->name, key->ds->name);
+}
+
+static fz_store_type fz_color_lut_store_type =
+{
+	"fz_color_lut",
+	fz_make_hash_color_lut_key,
+	fz_keep_color_lut_key,
+	fz_drop_color_lut_key,
+	fz_cmp_color_lut_key,
+	fz_print_color_lut_key,
+	NULL,
+	4
+};
+
+static inline short
+lut_fixed(float v)
+{
+	if (v <= 0)
+		return 0;
+	if (v >= 1)
+		return 255 << 7;
+	return (short)(v * (255 << 7) + 0.5f);
+}
+
+static fz_color_lut *
+fz_new_color_lut(fz_context *ctx, fz_colorspace *ds, fz_colorspace *ss)
+{
+	fz_color_lut *lut;
+	fz_color_converter cc;
+	float srcv[4];
+	float dstv[FZ_MAX_COLORS];
+	int srcn = ss->n;
+	int dstn = ds->n;
+	int grid = (srcn == 3 ? LUT_GRID_3 : LUT_GRID_4);
+	int count, stride, i, j, k, v;
+	short *p;
+
+	lut = fz_malloc_struct(ctx, fz_color_lut);
+	FZ_INIT_STORABLE(lut, 1, fz_drop_color_lut_imp);
+	lut->srcn = srcn;
+	lut->dstn = dstn;
+	lut->grid = grid;
+
+	/* The last axis varies fastest. */
+	stride = 4;
+	for (k = srcn - 1; k >= 0; k--)
+	{
+		lut->stride[k] = stride;
+		stride *= grid;
+	}
+	count = stride / 4;
+
+	for (v = 0; v < 256; v++)
+	{
+		int pos = (v * (grid - 1) * 256 + 127) / 255;
+		int idx = pos >> 8;
+		int frac = pos & 255;
+		if (idx == grid - 1)
+		{
+			idx--;
+			frac = 256;
+		}
+		lut->frac[v] = frac;
+		for (k = 0; k < srcn; k++)
+			lut->offset[k][v] = idx * lut->stride[k];
+	}
+
+	fz_try(ctx)
+	{
+		lut->table = fz_malloc_array(ctx, count, 4 * sizeof(short));
+
+		fz_lookup_color_converter(ctx, &cc, ds, ss);
+		p = lut->table;
+		for (i = 0; i < count; i++)
+		{
+			j = i;
+			for (k = srcn - 1; k >= 0; k--)
+			{
+				srcv[k] = (float)(j % grid) / (grid - 1);
+				j /= grid;
+			}
+			cc.convert(ctx, &cc, dstv, srcv);
+			for (k = 0; k < 4; k++)
+				p[k] = (k < dstn ? lut_fixed(dstv[k]) : 0);
+			p += 4;
+		}
+	}
+	fz_catch(ctx)
+	{
+		fz_drop_color_lut_imp(ctx, &lut->storable);
+		fz_rethrow(ctx);
+	}
+
+	return lut;
+}
+
+/* Pick the tetrahedron of the cube at c[0] that the point (rx, ry, rz)
+ * lies in, filling in its other 3 corners, and the weights of all 4. */
+static inline void
+lut_tetrahedron(const short **c, int *w, int X, int Y, int Z, int rx, int ry, int rz)
+{
+	if (rx >= ry)
+	{
+		if (ry >= rz)
+		{
+			c[1] = c[0] + X; c[2] = c[1] + Y;
+			w[0] = 256 - rx; w[1] = rx - ry; w[2] = ry - rz; w[3] = rz;
+		}
+		else if (rx >= rz)
+		{
+			c[1] = c[0] + X; c[2] = c[1] + Z;
+			w[0] = 256 - rx; w[1] = rx - rz; w[2] = rz - ry; w[3] = ry;
+		}
+		else
+		{
+			c[1] = c[0] + Z; c[2] = c[1] + X;
+			w[0] = 256 - rz; w[1] = rz - rx; w[2] = rx - ry; w[3] = ry;
+		}
+	}
+	else
+	{
+		if (rx >= rz)
+		{
+			c[1] = c[0] + Y; c[2] = c[1] + X;
+			w[0] = 256 - ry; w[1] = ry - rx; w[2] = rx - rz; w[3] = rz;
+		}
+		else if (ry >= rz)
+		{
+			c[1] = c[0] + Y; c[2] = c[1] + Z;
+			w[0] = 256 - ry; w[1] = ry - rz; w[2] = rz - rx; w[3] = rx;
+		}
+		else
+		{
+			c[1] = c[0] + Z; c[2] = c[1] + Y;
+			w[0] = 256 - rz; w[1] = rz - ry; w[2] = ry - rx; w[3] = rx;
+		}
+	}
+	c[3] = c[0] + X + Y + Z;
+}
+
+static inline void
+lut_put(unsigned char *d, const int *v, int n)
+{
+	int k;
+	for (k = 0; k < n; k++)
+		d[k] = (v[k] + (1 << 14)) >> 15;
+}
+
+static inline void
+lut_interp(const short **c, const int *w, int *v)
+{
+	int k;
+	for (k = 0; k < 4; k++)
+		v[k] = c[0][k] * w[0] + c[1][k] * w[1] + c[2][k] * w[2] + c[3][k] * w[3];
+}
+
+static void
+lut_row_3(const fz_color_lut *lut, unsigned char *restrict d, const unsigned char *restrict s, int w, int sa, int da)
+{
+	const short *c[4];
+	int wt[4], v[4];
+	int dstn = lut->dstn;
+	int X = lut->stride[0], Y = lut->stride[1], Z = lut->stride[2];
+
+	while (w--)
+	{
+		c[0] = lut->table + lut->offset[0][s[0]] + lut->offset[1][s[1]] + lut->offset[2][s[2]];
+		lut_tetrahedron(c, wt, X, Y, Z, lut->frac[s[0]], lut->frac[s[1]], lut->frac[s[2]]);
+		lut_interp(c, wt, v);
+		lut_put(d, v, dstn);
+		s += 3;
+		d += dstn;
+		if (da)
+			*d++ = (sa ? *s : 255);
+		s += sa;
+	}
+}
+
+static void
+lut_row_4(const fz_color_lut *lut, unsigned char *restrict d, const unsigned char *restrict s, int w, int sa, int da)
+{
+	const short *c[4], *c1[4];
+	int wt[4], v0[4], v1[4], v[4];
+	int dstn = lut->dstn;
+	int X = lut->stride[0], Y = lut->stride[1], Z = lut->stride[2], K = lut->stride[3];
+	int rk, k;
+
+	while (w--)
+	{
+		c[0] = lut->table + lut->offset[0][s[0]] + lut->offset[1][s[1]] + lut->offset[2][s[2]] + lut->offset[3][s[3]];
+		lut_tetrahedron(c, wt, X, Y, Z, lut->frac[s[0]], lut->frac[s[1]], lut->frac[s[2]]);
+		for (k = 0; k < 4; k++)
+			c1[k] = c[k] + K;
+		lut_interp(c, wt, v0);
+		lut_interp(c1, wt, v1);
+		rk = lut->frac[s[3]];
+		for (k = 0; k < 4; k++)
+			v[k] = ((v0[k] + 128) >> 8) * (256 - rk) + ((v1[k] + 128) >> 8) * rk;
+		lut_put(d, v, dstn);
+		s += 4;
+		d += dstn;
+		if (da)
+			*d++ = (sa ? *s : 255);
+		s += sa;
+	}
+}
+
+#ifdef ARCH_X86_SIMD
+
+#include <immintrin.h>
+
+/* The corners are interleaved in pairs, so that one madd weights and
+ * sums a pair for all 4 outputs at once. */
+static inline FZ_TARGET_SSE2 __m128i
+lut_interp_sse2(const short **c, const int *w)
+{
+	__m128i c01 = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)c[0]), _mm_loadl_epi64((const __m128i *)c[1]));
+	__m128i c23 = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)c[2]), _mm_loadl_epi64((const __m128i *)c[3]));
+	__m128i w01 = _mm_set1_epi32(w[0] | (w[1] << 16));
+	__m128i w23 = _mm_set1_epi32(w[2] | (w[3] << 16));
+	return _mm_add_epi32(_mm_madd_epi16(c01, w01), _mm_madd_epi16(c23, w23));
+}
+
+static inline FZ_TARGET_SSE2 void
+lut_put_sse2(unsigned char *d, __m128i v, int n)
+{
+	unsigned int u;
+
+	v = _mm_srai_epi32(_mm_add_epi32(v, _mm_set1_epi32(1 << 14)), 15);
+	v = _mm_packs_epi32(v, v);
+	u = (unsigned int)_mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+	switch (n)
+	{
+	case 4: d[3] = u >> 24; /* fall through */
+	case 3: d[2] = u >> 16; /* fall through */
+	case 2: d[1] = u >> 8; /* fall through */
+	case 1: d[0] = u;
+	}
+}
+
+static FZ_TARGET_SSE2 void
+lut_row_3_sse2(const fz_color_lut *lut, unsigned char *restrict d, const unsigned char *restrict s, int w, int sa, int da)
+{
+	const short *c[4];
+	int wt[4];
+	int dstn = lut->dstn;
+	int X = lut->stride[0], Y = lut->stride[1], Z = lut->stride[2];
+
+	while (w--)
+	{
+		c[0] = lut->table + lut->offset[0][s[0]] + lut->offset[1][s[1]] + lut->offset[2][s[2]];
+		lut_tetrahedron(c, wt, X, Y, Z, lut->frac[s[0]], lut->frac[s[1]], lut->frac[s[2]]);
+		lut_put_sse2(d, lut_interp_sse2(c, wt), dstn);
+		s += 3;
+		d += dstn;
+		if (da)
+			*d++ = (sa ? *s : 255);
+		s += sa;
+	}
+}
+
+static FZ_TARGET_SSE2 void
+lut_row_4_sse2(const fz_color_lut *lut, unsigned char *restrict d, const unsigned char *restrict s, int w, int sa, int da)
+{
+	const short *c[4], *c1[4];
+	int wt[4];
+	int dstn = lut->dstn;
+	int X = lut->stride[0], Y = lut->stride[1], Z = lut->stride[2], K = lut->stride[3];
+	const __m128i round = _mm_set1_epi32(128);
+	__m128i v0, v1, v;
+	int rk, k;
+
+	while (w--)
+	{
+		c[0] = lut->table + lut->offset[0][s[0]] + lut->offset[1][s[1]] + lut->offset[2][s[2]] + lut->offset[3][s[3]];
+		lut_tetrahedron(c, wt, X, Y, Z, lut->frac[s[0]], lut->frac[s[1]], lut->frac[s[2]]);
+		for (k = 0; k < 4; k++)
+			c1[k] = c[k] + K;
+		v0 = _mm_srai_epi32(_mm_add_epi32(lut_interp_sse2(c, wt), round), 8);
+		v1 = _mm_srai_epi32(_mm_add_epi32(lut_interp_sse2(c1, wt), round), 8);
+		/* Interleave the two planes, and weight them as the corners. */
+		v = _mm_packs_epi32(v0, v1);
+		v = _mm_unpacklo_epi16(v, _mm_unpackhi_epi64(v, v));
+		rk = lut->frac[s[3]];
+		v = _mm_madd_epi16(v, _mm_set1_epi32((256 - rk) | (rk << 16)));
+		lut_put_sse2(d, v, dstn);
+		s += 4;
+		d += dstn;
+		if (da)
+			*d++ = (sa ? *s : 255);
+		s += sa;
+	}
+}
+
+#endif /* ARCH_X86_SIMD */
+
+typedef void (lut_row_fn)(const fz_color_lut *lut, unsigned char *restrict d, const unsigned char *restrict s, int w, int sa, int da);
+
+int
+fz_convert_pixmap_lut(fz_context *ctx, fz_pixmap *dst, fz_pixmap *src)
+{
+	fz_colorspace *ss = src->colorspace;
+	fz_colorspace *ds = dst->colorspace;
+	fz_color_lut_key key;
+	fz_color_lut_key *keyp = NULL;
+	fz_color_lut *lut, *existing;
+	lut_row_fn *row;
+	unsigned char *s = src->samples;
+	unsigned char *d = dst->samples;
+	int h = src->h;
+
+	if ((ss->n != 3 && ss->n != 4) || ds->n > 4 || src->w <= 0 || h <= 0)
+		return 0;
+	if (fz_colorspace_is_lab(ctx, ss))
+		return 0;
+	if ((int64_t)src->w * h < LUT_MIN_PIXELS)
+		return 0;
+
+	key.refs = 1;
+	key.ss = ss;
+	key.ds = ds;
+	lut = fz_find_item(ctx, fz_drop_color_lut_imp, &key, &fz_color_lut_store_type);
+	if (lut == NULL)
+	{
+		lut = fz_new_color_lut(ctx, ds, ss);
+
+		/* Failing to store the table just means sampling it again
+		 * next time. */
+		fz_var(keyp);
+		fz_try(ctx)
+		{
+			keyp = fz_malloc_struct(ctx, fz_color_lut_key);
+			keyp->refs = 1;
+			keyp->ss = fz_keep_colorspace(ctx, ss);
+			keyp->ds = fz_keep_colorspace(ctx, ds);
+			existing = fz_store_item(ctx, keyp, lut, fz_color_lut_size(lut), &fz_color_lut_store_type);
+			if (existing)
+			{
+				/* Another thread sampled it first. */
+				fz_drop_storable(ctx, &lut->storable);
+				lut = existing;
+			}
+		}
+		fz_always(ctx)
+			fz_drop_color_lut_key(ctx, keyp);
+		fz_catch(ctx)
+		{
+			/* Do nothing */
+		}
+	}
+
+	row = (ss->n == 3 ? lut_row_3 : lut_row_4);
+#ifdef ARCH_X86_SIMD
+	if (fz_cpu_features(ctx) & FZ_CPU_SSE2)
+		row = (ss->n == 3 ? lut_row_3_sse2 : lut_row_4_sse2);
+#endif /* ARCH_X86_SIMD */
+
+	while (h--)
+	{
+		row(lut, d, s, src->w, src->alpha, dst->alpha);
+		s += src->stride;
+		d += dst->stride;
+	}
+
+	fz_drop_storable(ctx, &lut->storable);
+	return 1;
+}
@@ -1530,6 +1530,10 @@ fz_std_conv_pixmap(fz_context *ctx, fz_pixmap *dst, fz_pixmap *src)
 	assert(src->n == srcn + sa);
 	assert(dst->n == dstn + da);
 
+	/* Sampled tables for 3 and 4 component colorspaces */
+	if (fz_convert_pixmap_lut(ctx, dst, src))
+		return;
+
 	if (d_line_inc == 0 && s_line_inc == 0)
 	{
 		w *= h;
@@ -2007,6 +2011,15 @@ fz_colorspace_is_indexed(fz_context *ctx, fz_colorspace *cs)
 	return (cs && cs->to_rgb == indexed_to_rgb);
 }
 
+int
+fz_indexed_colorspace_lookup(fz_context *ctx, fz_colorspace *cs, fz_colorspace **base, unsigned char **lookup)
+{
+	struct indexed *idx = cs->data;
+	*base = idx->base;
+	*lookup = idx->lookup;
+	return idx->high;
+}
+
 fz_colorspace *
 fz_new_indexed_colorspace(fz_context *ctx, fz_colorspace *base, int high, unsigned char *lookup)
 {
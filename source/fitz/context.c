@@ -84,6 +84,7 @@ static void fz_new_tuning_context(fz_context *ctx)
 		ctx->tuning->refs = 1;
 		ctx->tuning->image_decode = &fz_default_image_decode;
 		ctx->tuning->image_scale = &fz_default_image_scale;
+		ctx->tuning->image_threads = 1;
 	}
 }
 
@@ -116,6 +117,71 @@ void fz_tune_image_scale(fz_context *ctx, fz_tune_image_scale_fn *image_scale, v
 	ctx->tuning->image_scale_arg = arg;
 }
 
+int fz_image_decode_threads(fz_context *ctx)
+{
+	return ctx->tuning->image_threads;
+}
+
+void fz_set_image_decode_threads(fz_context *ctx, int threads)
+{
+	ctx->tuning->image_threads = fz_maxi(1, threads);
+}
+
+int fz_map_files(fz_context *ctx)
+{
+	return ctx->tuning->map_files;
+}
+
+void fz_set_map_files(fz_context *ctx, int map)
+{
+	ctx->tuning->map_files = !!map;
+}
+
+/* The processor features are a property of the process, not of any
+ * one context, so they are probed once and shared. */
+static int fz_cpu_detected = -1;
+static int fz_cpu_enabled = 0;
+
+static void
+fz_detect_cpu_features(void)
+{
+	int features = 0;
+
+	if (fz_cpu_detected >= 0)
+		return;
+
+#ifdef ARCH_X86_SIMD
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse2"))
+		features |= FZ_CPU_SSE2;
+	if (__builtin_cpu_supports("ssse3"))
+		features |= FZ_CPU_SSSE3;
+	if (__builtin_cpu_supports("sse4.1"))
+		features |= FZ_CPU_SSE4_1;
+	if (__builtin_cpu_supports("avx2"))
+		features |= FZ_CPU_AVX2;
+#endif
+
+	fz_cpu_enabled = features;
+	fz_cpu_detected = features;
+}
+
+int fz_cpu_features(fz_context *ctx)
+{
+	return fz_cpu_enabled;
+}
+
+void fz_set_cpu_features(fz_context *ctx, int features)
+{
+	fz_detect_cpu_features();
+	fz_cpu_enabled = features & fz_cpu_detected;
+}
+
+int fz_cpu_features_no_ctx(void)
+{
+	return fz_cpu_enabled;
+}
+
 void
 fz_drop_context(fz_context *ctx)
 {
@@ -124,6 +190,7 @@ fz_drop_context(fz_context *ctx)
 
 	/* Other finalisation calls go here (in reverse order) */
 	fz_drop_document_handler_context(ctx);
+	fz_drop_face_cache_context(ctx);
 	fz_drop_glyph_cache_context(ctx);
 	fz_drop_store_context(ctx);
 	fz_drop_aa_context(ctx);
@@ -216,6 +283,8 @@ fz_new_context_imp(const fz_alloc_context *alloc, const fz_locks_context *locks,
 	if (!locks)
 		locks = &fz_locks_default;
 
+	fz_detect_cpu_features();
+
 	ctx = new_context_phase1(alloc, locks);
 	if (!ctx)
 		return NULL;
@@ -273,8 +342,6 @@ fz_clone_context_internal(fz_context *ctx)
 	new_ctx->user = ctx->user;
 	new_ctx->store = ctx->store;
 	new_ctx->store = fz_keep_store_context(new_ctx);
-	new_ctx->glyph_cache = ctx->glyph_cache;
-	new_ctx->glyph_cache = fz_keep_glyph_cache(new_ctx);
 	new_ctx->colorspace = ctx->colorspace;
 	new_ctx->colorspace = fz_keep_colorspace_context(new_ctx);
 	new_ctx->font = ctx->font;
@@ -288,6 +355,19 @@ fz_clone_context_internal(fz_context *ctx)
 	new_ctx->handler = ctx->handler;
 	new_ctx->handler = fz_keep_document_handler_context(new_ctx);
 
+	/* The glyph cache is shared, but each context has its own front end,
+	 * and clones have FreeType faces of their own. */
+	fz_try(new_ctx)
+	{
+		fz_clone_glyph_cache_context(new_ctx, ctx);
+		fz_new_face_cache_context(new_ctx);
+	}
+	fz_catch(new_ctx)
+	{
+		fz_drop_context(new_ctx);
+		return NULL;
+	}
+
 	return new_ctx;
 }
 
@@ -5,6 +5,11 @@ typedef unsigned char byte;
 
 typedef void (paintfn_t)(byte * restrict dp, int da, const byte * restrict sp, int sw, int sh, int ss, int sa, int u, int v, int fa, int fb, int w, int n, int alpha, const byte * restrict color, byte * restrict hp);
 
+#ifdef ARCH_X86_SIMD
+enum { AFFINE_N, AFFINE_G2RGB, AFFINE_COLOR };
+static paintfn_t *fz_paint_affine_x86(int da, int sa, int n, int alpha, int lerp, int kind);
+#endif /* ARCH_X86_SIMD */
+
 static inline int lerp(int a, int b, int t)
 {
 	return a + (((b - a) * t) >> 16);
@@ -98,7 +103,7 @@ template_affine_alpha_g2rgb_lerp(byte * restrict dp, int da, const byte * restri
 					hp[0] = y + fz_mul255(hp[0], t);
 			}
 		}
-		dp += 4;
+		dp += 3 + da;
 		if (hp)
 			hp++;
 		u += fa;
@@ -1046,6 +1051,11 @@ paint_affine_lerp_alpha_N(byte * restrict dp, int da, const byte * restrict sp,
 static paintfn_t *
 fz_paint_affine_lerp(int da, int sa, int fa, int fb, int n, int alpha)
 {
+#ifdef ARCH_X86_SIMD
+	paintfn_t *simd = fz_paint_affine_x86(da, sa, n, alpha, 1, AFFINE_N);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	switch(n)
 	{
 	case 0:
@@ -1292,6 +1302,11 @@ paint_affine_lerp_g2rgb_alpha(byte * restrict dp, int da, const byte * restrict
 static paintfn_t *
 fz_paint_affine_g2rgb_lerp(int da, int sa, int fa, int fb, int n, int alpha)
 {
+#ifdef ARCH_X86_SIMD
+	paintfn_t *simd = fz_paint_affine_x86(da, sa, n, alpha, 1, AFFINE_G2RGB);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	if (da)
 	{
 		if (sa)
@@ -2097,6 +2112,11 @@ paint_affine_near_alpha_N(byte * restrict dp, int da, const byte * restrict sp,
 static paintfn_t *
 fz_paint_affine_near(int da, int sa, int fa, int fb, int n, int alpha)
 {
+#ifdef ARCH_X86_SIMD
+	paintfn_t *simd = fz_paint_affine_x86(da, sa, n, alpha, 0, AFFINE_N);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	switch(n)
 	{
 	case 0:
@@ -2707,6 +2727,11 @@ paint_affine_near_alpha_g2rgb(byte * restrict dp, int da, const byte * restrict
 static paintfn_t *
 fz_paint_affine_g2rgb_near(int da, int sa, int fa, int fb, int n, int alpha)
 {
+#ifdef ARCH_X86_SIMD
+	paintfn_t *simd = fz_paint_affine_x86(da, sa, n, alpha, 0, AFFINE_G2RGB);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	if (da)
 	{
 		if (sa)
@@ -2887,6 +2912,11 @@ paint_affine_color_lerp_N(byte * restrict dp, int da, const byte * restrict sp,
 static paintfn_t *
 fz_paint_affine_color_lerp(int da, int sa, int fa, int fb, int n, int alpha)
 {
+#ifdef ARCH_X86_SIMD
+	paintfn_t *simd = fz_paint_affine_x86(da, sa, n, alpha, 1, AFFINE_COLOR);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	switch (n)
 	{
 	case 0: return da ? paint_affine_color_lerp_da_0 : NULL;
@@ -2980,6 +3010,11 @@ paint_affine_color_near_N(byte * restrict dp, int da, const byte * restrict sp,
 static paintfn_t *
 fz_paint_affine_color_near(int da, int sa, int fa, int fb, int n, int alpha)
 {
+#ifdef ARCH_X86_SIMD
+	paintfn_t *simd = fz_paint_affine_x86(da, sa, n, alpha, 0, AFFINE_COLOR);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	switch (n)
 	{
 	case 0: return da ? paint_affine_color_near_da_0 : NULL;
@@ -3342,6 +3377,63 @@ fz_paint_image_imp(fz_pixmap * restrict dst, const fz_irect *scissor, const fz_p
 	}
 }
 
+#ifdef ARCH_X86_SIMD
+
+#include <immintrin.h>
+
+typedef struct { __m128i lo, hi; } affine_w16;
+
+#include "affine-simd.h"
+#define SIMD_AVX2
+#include "affine-simd.h"
+
+#define SIMD_PICK(NAME) (avx2 ? NAME##_avx2 : NAME##_sse4_1)
+
+static paintfn_t *
+fz_paint_affine_x86(int da, int sa, int n, int alpha, int lerp, int kind)
+{
+	int features = fz_cpu_features_no_ctx();
+	int avx2 = features & FZ_CPU_AVX2;
+
+	if (!(features & FZ_CPU_SSE4_1) || alpha <= 0)
+		return NULL;
+	/* Both source and destination pixels must fit in 4 bytes. */
+	if (n + da > 4 || (kind == AFFINE_N && n + sa > 4))
+		return NULL;
+	/* Unblended nearest neighbour copies are as quick in C. */
+	if (!lerp && kind != AFFINE_COLOR && !sa && alpha == 255)
+		return NULL;
+
+	switch (n)
+	{
+#if FZ_PLOTTERS_G
+	case 1:
+		if (kind == AFFINE_COLOR)
+			return lerp ? SIMD_PICK(paint_affine_color_lerp_1) : SIMD_PICK(paint_affine_color_near_1);
+		return lerp ? SIMD_PICK(paint_affine_lerp_1) : SIMD_PICK(paint_affine_near_1);
+#endif /* FZ_PLOTTERS_G */
+#if FZ_PLOTTERS_RGB
+	case 3:
+		if (kind == AFFINE_COLOR)
+			return lerp ? SIMD_PICK(paint_affine_color_lerp_3) : SIMD_PICK(paint_affine_color_near_3);
+		if (kind == AFFINE_G2RGB)
+			return lerp ? SIMD_PICK(paint_affine_lerp_g2rgb) : SIMD_PICK(paint_affine_near_g2rgb);
+		return lerp ? SIMD_PICK(paint_affine_lerp_3) : SIMD_PICK(paint_affine_near_3);
+#endif /* FZ_PLOTTERS_RGB */
+#if FZ_PLOTTERS_CMYK
+	case 4:
+		if (kind == AFFINE_COLOR)
+			return lerp ? SIMD_PICK(paint_affine_color_lerp_4) : SIMD_PICK(paint_affine_color_near_4);
+		return lerp ? SIMD_PICK(paint_affine_lerp_4) : SIMD_PICK(paint_affine_near_4);
+#endif /* FZ_PLOTTERS_CMYK */
+	}
+	return NULL;
+}
+
+#undef SIMD_PICK
+
+#endif /* ARCH_X86_SIMD */
+
 void
 fz_paint_image_with_color(fz_pixmap * restrict dst, const fz_irect * restrict scissor, fz_pixmap * restrict shape, const fz_pixmap * restrict img, const fz_matrix * restrict ctm, const byte * restrict color, int lerp_allowed, int as_tiled)
 {
@@ -33,6 +33,11 @@ struct fz_draw_state_s {
 	fz_matrix ctm;
 	float xstep, ystep;
 	fz_irect area;
+	fz_pixmap *lazy;
+	fz_pixmap *lazy_shape;
+	fz_irect lazy_area;
+	int lazy_copy;
+	int lazy_value;
 };
 
 struct fz_draw_device_s
@@ -131,6 +136,8 @@ push_stack(fz_context *ctx, fz_draw_device *dev)
 	state = &dev->stack[dev->top];
 	dev->top++;
 	memcpy(&state[1], state, sizeof(*state));
+	state[1].lazy = NULL;
+	state[1].lazy_shape = NULL;
 	return state;
 }
 
@@ -147,6 +154,217 @@ static void emergency_pop_stack(fz_context *ctx, fz_draw_device *dev, fz_draw_st
 	fz_rethrow(ctx);
 }
 
+/* The dest and shape pixmaps made for clips, groups and masks start out
+ * empty, and are only grown (by fz_draw_ensure) to cover what is drawn
+ * into them, up to lazy_area. A dest that grows takes the new part of
+ * its contents from the dest of the level below (if lazy_copy), or is
+ * cleared (to lazy_value, if it has no alpha); a shape that grows is
+ * cleared. Outside the area they cover, compositing them back would
+ * leave the level below unchanged, so the pop only has to work over
+ * that area too.
+ *
+ * The lazy and lazy_shape pointers say which pixmaps a level made this
+ * way, so that a level that swaps its dest for something else (as the
+ * text clips do, to draw outlines into the mask) leaves it alone. */
+static fz_pixmap *
+new_lazy_dest(fz_context *ctx, fz_draw_state *state, const fz_irect *area, fz_colorspace *model, int alpha, int copy, int value)
+{
+	state->dest = fz_new_pixmap_with_bbox(ctx, model, &fz_empty_irect, alpha);
+	state->lazy = state->dest;
+	state->lazy_area = *area;
+	state->lazy_copy = copy;
+	state->lazy_value = value;
+	return state->dest;
+}
+
+static fz_pixmap *
+new_lazy_shape(fz_context *ctx, fz_draw_state *state, const fz_irect *area)
+{
+	state->shape = fz_new_pixmap_with_bbox(ctx, NULL, &fz_empty_irect, 1);
+	state->lazy_shape = state->shape;
+	state->lazy_area = *area;
+	return state->shape;
+}
+
+static void
+grow_pixmap(fz_context *ctx, fz_pixmap *pix, const fz_irect *bbox, fz_pixmap *backdrop, int value)
+{
+	fz_pixmap *tmp;
+	fz_irect area, old;
+	unsigned char *samples;
+	ptrdiff_t stride;
+
+	fz_pixmap_bbox(ctx, pix, &old);
+	area = *bbox;
+	if (!fz_is_empty_irect(&old))
+	{
+		if (old.x0 < area.x0) area.x0 = old.x0;
+		if (old.y0 < area.y0) area.y0 = old.y0;
+		if (old.x1 > area.x1) area.x1 = old.x1;
+		if (old.y1 > area.y1) area.y1 = old.y1;
+	}
+
+	tmp = fz_new_pixmap_with_bbox(ctx, pix->colorspace, &area, pix->alpha);
+	if (backdrop)
+		fz_copy_pixmap_rect(ctx, tmp, backdrop, &area);
+	else if (pix->alpha)
+		fz_clear_pixmap(ctx, tmp);
+	else
+		fz_clear_pixmap_with_value(ctx, tmp, value);
+	fz_copy_pixmap_rect(ctx, tmp, pix, &old);
+
+	/* Swap the samples over, so that everything holding pix sees the
+	 * bigger one. */
+	samples = pix->samples;
+	stride = pix->stride;
+	pix->samples = tmp->samples;
+	pix->stride = tmp->stride;
+	pix->x = tmp->x;
+	pix->y = tmp->y;
+	pix->w = tmp->w;
+	pix->h = tmp->h;
+	tmp->samples = samples;
+	tmp->stride = stride;
+	fz_drop_pixmap(ctx, tmp);
+}
+
+static int
+covers(const fz_irect *a, const fz_irect *b)
+{
+	return a->x0 <= b->x0 && a->y0 <= b->y0 && a->x1 >= b->x1 && a->y1 >= b->y1;
+}
+
+static void fz_draw_ensure(fz_context *ctx, fz_draw_device *dev, int i, const fz_irect *bbox);
+
+static void
+grow_level(fz_context *ctx, fz_draw_device *dev, int i, const fz_irect *bbox)
+{
+	fz_draw_state *state = &dev->stack[i];
+	int lazy_dest = state->lazy && state->lazy == state->dest;
+	int lazy_shape = state->lazy_shape && state->lazy_shape == state->shape;
+	fz_irect need, have, area;
+	int w, h;
+
+	if (!lazy_dest && !lazy_shape)
+		return;
+
+	need = *bbox;
+	fz_intersect_irect(&need, &state->lazy_area);
+	if (fz_is_empty_irect(&need))
+		return;
+	fz_pixmap_bbox(ctx, lazy_dest ? state->dest : state->shape, &have);
+	if (covers(&have, &need))
+	{
+		if (!lazy_dest || !lazy_shape || covers(fz_pixmap_bbox(ctx, state->shape, &have), &need))
+			return;
+	}
+
+	/* Grow by half as much again in the directions that are short, so
+	 * that drawing spread out over the area takes few steps. */
+	if (fz_is_empty_irect(&have))
+		area = need;
+	else
+	{
+		w = (have.x1 - have.x0) / 2;
+		h = (have.y1 - have.y0) / 2;
+		area = have;
+		if (need.x0 < area.x0) area.x0 = need.x0 - w;
+		if (need.y0 < area.y0) area.y0 = need.y0 - h;
+		if (need.x1 > area.x1) area.x1 = need.x1 + w;
+		if (need.y1 > area.y1) area.y1 = need.y1 + h;
+		fz_intersect_irect(&area, &state->lazy_area);
+	}
+
+	if (lazy_dest)
+	{
+		if (state->lazy_copy)
+		{
+			fz_draw_ensure(ctx, dev, i-1, &area);
+			grow_pixmap(ctx, state->dest, &area, dev->stack[i-1].dest, 0);
+		}
+		else
+			grow_pixmap(ctx, state->dest, &area, NULL, state->lazy_value);
+	}
+	if (lazy_shape)
+		grow_pixmap(ctx, state->shape, &area, NULL, 0);
+}
+
+/* Make sure that the dest and shape drawn into at level i of the stack
+ * cover bbox (as far as they can). */
+static void
+fz_draw_ensure(fz_context *ctx, fz_draw_device *dev, int i, const fz_irect *bbox)
+{
+	int j;
+
+	if (fz_is_empty_irect(bbox))
+		return;
+	for (j = i; j > 0 && dev->stack[j-1].dest == dev->stack[i].dest; j--)
+		;
+	grow_level(ctx, dev, j, bbox);
+	if (dev->stack[i].shape)
+	{
+		for (j = i; j > 0 && dev->stack[j-1].shape == dev->stack[i].shape; j--)
+			;
+		grow_level(ctx, dev, j, bbox);
+	}
+}
+
+/* The bbox the dest of a level would have if it were all there. */
+static fz_irect *
+fz_draw_dest_bbox(fz_context *ctx, fz_draw_device *dev, fz_draw_state *state, fz_irect *bbox)
+{
+	int j = state - dev->stack;
+
+	while (j > 0 && dev->stack[j-1].dest == state->dest)
+		j--;
+	if (dev->stack[j].lazy && dev->stack[j].lazy == state->dest)
+		*bbox = dev->stack[j].lazy_area;
+	else
+		fz_pixmap_bbox(ctx, state->dest, bbox);
+	return bbox;
+}
+
+/* Make sure the top of the stack covers where an image is painted by
+ * fz_paint_image with ctm. */
+static void
+fz_draw_ensure_image(fz_context *ctx, fz_draw_device *dev, const fz_matrix *ctm, int as_tiled)
+{
+	fz_matrix m = *ctm;
+	fz_rect rect = fz_unit_rect;
+	fz_irect bbox;
+
+	fz_gridfit_matrix(as_tiled, &m);
+	fz_irect_from_rect(&bbox, fz_transform_rect(&rect, &m));
+	fz_intersect_irect(&bbox, &dev->stack[dev->top].scissor);
+	fz_draw_ensure(ctx, dev, dev->top, &bbox);
+}
+
+/* Make sure the top of the stack covers where a glyph is drawn. */
+static void
+fz_draw_ensure_glyph(fz_context *ctx, fz_draw_device *dev, fz_glyph *glyph, int x, int y)
+{
+	fz_irect bbox;
+
+	fz_glyph_bbox(ctx, glyph, &bbox);
+	fz_translate_irect(&bbox, x, y);
+	fz_intersect_irect(&bbox, &dev->stack[dev->top].scissor);
+	fz_draw_ensure(ctx, dev, dev->top, &bbox);
+}
+
+/* Before the top of the stack is composited back onto the level below,
+ * make sure that covers everything the top has drawn into. */
+static void
+fz_draw_ensure_pop(fz_context *ctx, fz_draw_device *dev)
+{
+	fz_draw_state *state = &dev->stack[dev->top];
+	fz_irect bbox;
+
+	if (state[0].dest != state[-1].dest)
+		fz_draw_ensure(ctx, dev, dev->top-1, fz_pixmap_bbox(ctx, state[0].dest, &bbox));
+	if (state[0].shape && state[-1].shape && state[0].shape != state[-1].shape)
+		fz_draw_ensure(ctx, dev, dev->top-1, fz_pixmap_bbox(ctx, state[0].shape, &bbox));
+}
+
 static fz_draw_state *
 fz_knockout_begin(fz_context *ctx, fz_draw_device *dev)
 {
@@ -181,7 +399,10 @@ fz_knockout_begin(fz_context *ctx, fz_draw_device *dev)
 				break;
 		}
 		if (prev)
+		{
+			fz_draw_ensure(ctx, dev, i, &bbox);
 			fz_copy_pixmap_rect(ctx, dest, prev, &bbox);
+		}
 		else
 			fz_clear_pixmap(ctx, dest);
 	}
@@ -304,6 +525,7 @@ fz_draw_fill_path(fz_context *ctx, fz_device *devp, const fz_path *path, int eve
 	if (fz_is_empty_irect(&bbox))
 		return;
 
+	fz_draw_ensure(ctx, dev, dev->top, &bbox);
 	if (state->blendmode & FZ_BLEND_KNOCKOUT)
 		state = fz_knockout_begin(ctx, dev);
 
@@ -375,6 +597,7 @@ fz_draw_stroke_path(fz_context *ctx, fz_device *devp, const fz_path *path, const
 	if (fz_is_empty_irect(&bbox))
 		return;
 
+	fz_draw_ensure(ctx, dev, dev->top, &bbox);
 	if (state->blendmode & FZ_BLEND_KNOCKOUT)
 		state = fz_knockout_begin(ctx, dev);
 
@@ -468,13 +691,9 @@ fz_draw_clip_path(fz_context *ctx, fz_device *devp, const fz_path *path, int eve
 	{
 		state[1].mask = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
 		fz_clear_pixmap(ctx, state[1].mask);
-		state[1].dest = fz_new_pixmap_with_bbox(ctx, model, &bbox, state[0].dest->alpha);
-		fz_copy_pixmap_rect(ctx, state[1].dest, state[0].dest, &bbox);
+		new_lazy_dest(ctx, &state[1], &bbox, model, state[0].dest->alpha, 1, 0);
 		if (state[1].shape)
-		{
-			state[1].shape = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
-			fz_clear_pixmap(ctx, state[1].shape);
-		}
+			new_lazy_shape(ctx, &state[1], &bbox);
 
 		fz_scan_convert(ctx, gel, even_odd, &bbox, state[1].mask, NULL);
 
@@ -541,16 +760,9 @@ fz_draw_clip_stroke_path(fz_context *ctx, fz_device *devp, const fz_path *path,
 		 * we have a choice. We can either create the new destination WITH alpha, or
 		 * we can copy the old pixmap contents in. We opt for the latter here, but
 		 * may want to revisit this decision in future. */
-		state[1].dest = fz_new_pixmap_with_bbox(ctx, model, &bbox, state[0].dest->alpha);
-		if (state[0].dest->alpha)
-			fz_clear_pixmap(ctx, state[1].dest);
-		else
-			fz_copy_pixmap_rect(ctx, state[1].dest, state[0].dest, &bbox);
+		new_lazy_dest(ctx, &state[1], &bbox, model, state[0].dest->alpha, !state[0].dest->alpha, 0);
 		if (state->shape)
-		{
-			state[1].shape = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
-			fz_clear_pixmap(ctx, state[1].shape);
-		}
+			new_lazy_shape(ctx, &state[1], &bbox);
 
 		if (!fz_is_empty_irect(&bbox))
 			fz_scan_convert(ctx, gel, 0, &bbox, state[1].mask, NULL);
@@ -654,7 +866,10 @@ fz_draw_fill_text(fz_context *ctx, fz_device *devp, const fz_text *text, const f
 		fz_throw(ctx, FZ_ERROR_GENERIC, "color destination requires source color");
 
 	if (state->blendmode & FZ_BLEND_KNOCKOUT)
+	{
+		fz_draw_ensure(ctx, dev, dev->top, &state->scissor);
 		state = fz_knockout_begin(ctx, dev);
+	}
 
 	n = fz_colorspace_n(ctx, model);
 	if (n > 0)
@@ -694,6 +909,7 @@ fz_draw_fill_text(fz_context *ctx, fz_device *devp, const fz_text *text, const f
 				int y = floorf(trm.f);
 				if (pixmap == NULL || pixmap->n == 1)
 				{
+					fz_draw_ensure_glyph(ctx, dev, glyph, x, y);
 					draw_glyph(colorbv, state->dest, glyph, x, y, &state->scissor);
 					if (state->shape)
 						draw_glyph(&shapebv, state->shape, glyph, x, y, &state->scissor);
@@ -703,6 +919,7 @@ fz_draw_fill_text(fz_context *ctx, fz_device *devp, const fz_text *text, const f
 					fz_matrix mat;
 					mat.a = pixmap->w; mat.b = mat.c = 0; mat.d = pixmap->h;
 					mat.e = x + pixmap->x; mat.f = y + pixmap->y;
+					fz_draw_ensure_image(ctx, dev, &mat, devp->flags & FZ_DEVFLAG_GRIDFIT_AS_TILED);
 					fz_paint_image(state->dest, &state->scissor, state->shape, pixmap, &mat, alpha * 255, !(devp->hints & FZ_DONT_INTERPOLATE_IMAGES), devp->flags & FZ_DEVFLAG_GRIDFIT_AS_TILED);
 				}
 				fz_drop_glyph(ctx, glyph);
@@ -745,7 +962,10 @@ fz_draw_stroke_text(fz_context *ctx, fz_device *devp, const fz_text *text, const
 		fz_throw(ctx, FZ_ERROR_GENERIC, "color destination requires source color");
 
 	if (state->blendmode & FZ_BLEND_KNOCKOUT)
+	{
+		fz_draw_ensure(ctx, dev, dev->top, &state->scissor);
 		state = fz_knockout_begin(ctx, dev);
+	}
 
 	n = fz_colorspace_n(ctx, model);
 	if (n > 0)
@@ -781,6 +1001,7 @@ fz_draw_stroke_text(fz_context *ctx, fz_device *devp, const fz_text *text, const
 			{
 				int x = (int)trm.e;
 				int y = (int)trm.f;
+				fz_draw_ensure_glyph(ctx, dev, glyph, x, y);
 				draw_glyph(colorbv, state->dest, glyph, x, y, &state->scissor);
 				if (state->shape)
 					draw_glyph(colorbv, state->shape, glyph, x, y, &state->scissor);
@@ -844,16 +1065,9 @@ fz_draw_clip_text(fz_context *ctx, fz_device *devp, const fz_text *text, const f
 		 * we have a choice. We can either create the new destination WITH alpha, or
 		 * we can copy the old pixmap contents in. We opt for the latter here, but
 		 * may want to revisit this decision in future. */
-		dest = fz_new_pixmap_with_bbox(ctx, model, &bbox, state[0].dest->alpha);
-		if (state[0].dest->alpha)
-			fz_clear_pixmap(ctx, dest);
-		else
-			fz_copy_pixmap_rect(ctx, dest, state[0].dest, &bbox);
+		dest = new_lazy_dest(ctx, &state[1], &bbox, model, state[0].dest->alpha, !state[0].dest->alpha, 0);
 		if (state->shape)
-		{
-			shape = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
-			fz_clear_pixmap(ctx, shape);
-		}
+			shape = new_lazy_shape(ctx, &state[1], &bbox);
 		else
 			shape = NULL;
 
@@ -889,7 +1103,10 @@ fz_draw_clip_text(fz_context *ctx, fz_device *devp, const fz_text *text, const f
 						int y = (int)trm.f;
 						draw_glyph(NULL, mask, glyph, x, y, &bbox);
 						if (state[1].shape)
+						{
+							fz_draw_ensure_glyph(ctx, dev, glyph, x, y);
 							draw_glyph(NULL, state[1].shape, glyph, x, y, &bbox);
+						}
 						fz_drop_glyph(ctx, glyph);
 					}
 					else
@@ -940,7 +1157,7 @@ fz_draw_clip_stroke_text(fz_context *ctx, fz_device *devp, const fz_text *text,
 	fz_draw_device *dev = (fz_draw_device*)devp;
 	fz_matrix ctm = concat(in_ctm, &dev->transform);
 	fz_irect bbox;
-	fz_pixmap *mask, *dest, *shape;
+	fz_pixmap *mask, *shape;
 	fz_matrix tm, trm;
 	fz_glyph *glyph;
 	int i, gid;
@@ -969,16 +1186,9 @@ fz_draw_clip_stroke_text(fz_context *ctx, fz_device *devp, const fz_text *text,
 		 * we have a choice. We can either create the new destination WITH alpha, or
 		 * we can copy the old pixmap contents in. We opt for the latter here, but
 		 * may want to revisit this decision in future. */
-		state[1].dest = dest = fz_new_pixmap_with_bbox(ctx, model, &bbox, state[0].dest->alpha);
-		if (state[0].dest->alpha)
-			fz_clear_pixmap(ctx, state[1].dest);
-		else
-			fz_copy_pixmap_rect(ctx, state[1].dest, state[0].dest, &bbox);
+		new_lazy_dest(ctx, &state[1], &bbox, model, state[0].dest->alpha, !state[0].dest->alpha, 0);
 		if (state->shape)
-		{
-			state[1].shape = shape = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
-			fz_clear_pixmap(ctx, shape);
-		}
+			shape = new_lazy_shape(ctx, &state[1], &bbox);
 		else
 			shape = state->shape;
 
@@ -1011,7 +1221,10 @@ fz_draw_clip_stroke_text(fz_context *ctx, fz_device *devp, const fz_text *text,
 						int y = (int)trm.f;
 						draw_glyph(NULL, mask, glyph, x, y, &bbox);
 						if (shape)
+						{
+							fz_draw_ensure_glyph(ctx, dev, glyph, x, y);
 							draw_glyph(NULL, shape, glyph, x, y, &bbox);
+						}
 						fz_drop_glyph(ctx, glyph);
 					}
 					else
@@ -1081,6 +1294,7 @@ fz_draw_fill_shade(fz_context *ctx, fz_device *devp, fz_shade *shade, const fz_m
 	if (fz_is_empty_irect(&bbox))
 		return;
 
+	fz_draw_ensure(ctx, dev, dev->top, shade->use_background ? &scissor : &bbox);
 	if (state->blendmode & FZ_BLEND_KNOCKOUT)
 		state = fz_knockout_begin(ctx, dev);
 
@@ -1247,7 +1461,7 @@ fz_draw_fill_image(fz_context *ctx, fz_device *devp, fz_image *image, const fz_m
 	fz_matrix inverse;
 	fz_irect src_area;
 
-	fz_intersect_irect(fz_pixmap_bbox(ctx, state->dest, &clip), &state->scissor);
+	fz_intersect_irect(fz_draw_dest_bbox(ctx, dev, state, &clip), &state->scissor);
 
 	fz_var(scaled);
 
@@ -1299,7 +1513,10 @@ fz_draw_fill_image(fz_context *ctx, fz_device *devp, fz_image *image, const fz_m
 	fz_try(ctx)
 	{
 		if (state->blendmode & FZ_BLEND_KNOCKOUT)
+		{
+			fz_draw_ensure(ctx, dev, dev->top, &state->scissor);
 			state = fz_knockout_begin(ctx, dev);
+		}
 
 		after = 0;
 		if (pixmap->colorspace == fz_device_gray(ctx))
@@ -1349,6 +1566,7 @@ fz_draw_fill_image(fz_context *ctx, fz_device *devp, fz_image *image, const fz_m
 			}
 		}
 
+		fz_draw_ensure_image(ctx, dev, &local_ctm, devp->flags & FZ_DEVFLAG_GRIDFIT_AS_TILED);
 		fz_paint_image(state->dest, &state->scissor, state->shape, pixmap, &local_ctm, alpha * 255, !(devp->hints & FZ_DONT_INTERPOLATE_IMAGES), devp->flags & FZ_DEVFLAG_GRIDFIT_AS_TILED);
 
 		if (state->blendmode & FZ_BLEND_KNOCKOUT)
@@ -1388,7 +1606,7 @@ fz_draw_fill_image_mask(fz_context *ctx, fz_device *devp, fz_image *image, const
 	if (colorspace == NULL && model != NULL)
 		fz_throw(ctx, FZ_ERROR_GENERIC, "color destination requires source color");
 
-	fz_pixmap_bbox(ctx, state->dest, &clip);
+	fz_draw_dest_bbox(ctx, dev, state, &clip);
 	fz_intersect_irect(&clip, &state->scissor);
 
 	if (image->w == 0 || image->h == 0)
@@ -1435,7 +1653,10 @@ fz_draw_fill_image_mask(fz_context *ctx, fz_device *devp, fz_image *image, const
 	fz_try(ctx)
 	{
 		if (state->blendmode & FZ_BLEND_KNOCKOUT)
+		{
+			fz_draw_ensure(ctx, dev, dev->top, &state->scissor);
 			state = fz_knockout_begin(ctx, dev);
+		}
 
 		if (ctx->tuning->image_scale(ctx->tuning->image_scale_arg, dx, dy, pixmap->w, pixmap->h))
 		{
@@ -1464,6 +1685,7 @@ fz_draw_fill_image_mask(fz_context *ctx, fz_device *devp, fz_image *image, const
 			i = 0;
 		colorbv[i] = alpha * 255;
 
+		fz_draw_ensure_image(ctx, dev, &local_ctm, devp->flags & FZ_DEVFLAG_GRIDFIT_AS_TILED);
 		fz_paint_image_with_color(state->dest, &state->scissor, state->shape, pixmap, &local_ctm, colorbv, !(devp->hints & FZ_DONT_INTERPOLATE_IMAGES), devp->flags & FZ_DEVFLAG_GRIDFIT_AS_TILED);
 
 
@@ -1500,7 +1722,7 @@ fz_draw_clip_image_mask(fz_context *ctx, fz_device *devp, fz_image *image, const
 	fz_rect urect;
 
 	STACK_PUSHED("clip image mask");
-	fz_pixmap_bbox(ctx, state->dest, &clip);
+	fz_draw_dest_bbox(ctx, dev, state, &clip);
 	fz_intersect_irect(&clip, &state->scissor);
 
 	fz_var(mask);
@@ -1546,15 +1768,11 @@ fz_draw_clip_image_mask(fz_context *ctx, fz_device *devp, fz_image *image, const
 		 * we have a choice. We can either create the new destination WITH alpha, or
 		 * we can copy the old pixmap contents in. We opt for the latter here, but
 		 * may want to revisit this decision in future. */
-		state[1].dest = dest = fz_new_pixmap_with_bbox(ctx, model, &bbox, state[0].dest->alpha);
-		if (state[0].dest->alpha)
-			fz_clear_pixmap(ctx, state[1].dest);
-		else
-			fz_copy_pixmap_rect(ctx, state[1].dest, state[0].dest, &bbox);
+		dest = new_lazy_dest(ctx, &state[1], &bbox, model, state[0].dest->alpha, !state[0].dest->alpha, 0);
 		if (state->shape)
 		{
-			state[1].shape = shape = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
-			fz_clear_pixmap(ctx, shape);
+			shape = new_lazy_shape(ctx, &state[1], &bbox);
+			fz_draw_ensure(ctx, dev, dev->top-1, &bbox);
 		}
 
 		state[1].blendmode |= FZ_BLEND_ISOLATED;
@@ -1613,6 +1831,7 @@ fz_draw_pop_clip(fz_context *ctx, fz_device *devp)
 		fz_warn(ctx, "Unexpected pop clip");
 		return;
 	}
+	fz_draw_ensure_pop(ctx, dev);
 	state = &dev->stack[--dev->top];
 	STACK_POPPED("clip");
 
@@ -1663,10 +1882,8 @@ static void
 fz_draw_begin_mask(fz_context *ctx, fz_device *devp, const fz_rect *rect, int luminosity, fz_colorspace *colorspace, const float *colorfv)
 {
 	fz_draw_device *dev = (fz_draw_device*)devp;
-	fz_pixmap *dest;
 	fz_irect bbox;
 	fz_draw_state *state = push_stack(ctx, dev);
-	fz_pixmap *shape = state->shape;
 	fz_rect trect = *rect;
 
 	STACK_PUSHED("mask");
@@ -1683,9 +1900,15 @@ fz_draw_begin_mask(fz_context *ctx, fz_device *devp, const fz_rect *rect, int lu
 		 * If !luminosity, then we generate a mask from the alpha value of the shapes.
 		 */
 		if (luminosity)
-			state[1].dest = dest = fz_new_pixmap_with_bbox(ctx, fz_device_gray(ctx), &bbox, 0);
+		{
+			float bc;
+			if (!colorspace)
+				colorspace = fz_device_gray(ctx);
+			fz_convert_color(ctx, fz_device_gray(ctx), &bc, colorspace, colorfv);
+			new_lazy_dest(ctx, &state[1], &bbox, fz_device_gray(ctx), 0, 0, bc * 255);
+		}
 		else
-			state[1].dest = dest = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
+			new_lazy_dest(ctx, &state[1], &bbox, NULL, 1, 0, 0);
 		if (state->shape)
 		{
 			/* FIXME: If we ever want to support AIS true, then
@@ -1694,24 +1917,7 @@ fz_draw_begin_mask(fz_context *ctx, fz_device *devp, const fz_rect *rect, int lu
 			 * then, in the end_mask code, we create the mask
 			 * from this rather than dest.
 			 */
-			state[1].shape = shape = NULL;
-		}
-
-		if (luminosity)
-		{
-			float bc;
-			if (!colorspace)
-				colorspace = fz_device_gray(ctx);
-			fz_convert_color(ctx, fz_device_gray(ctx), &bc, colorspace, colorfv);
-			fz_clear_pixmap_with_value(ctx, dest, bc * 255);
-			if (shape)
-				fz_clear_pixmap_with_value(ctx, shape, 255);
-		}
-		else
-		{
-			fz_clear_pixmap(ctx, dest);
-			if (shape)
-				fz_clear_pixmap(ctx, shape);
+			state[1].shape = NULL;
 		}
 
 #ifdef DUMP_GROUP_BLENDS
@@ -1729,7 +1935,7 @@ static void
 fz_draw_end_mask(fz_context *ctx, fz_device *devp)
 {
 	fz_draw_device *dev = (fz_draw_device*)devp;
-	fz_pixmap *temp, *dest;
+	fz_pixmap *temp;
 	fz_irect bbox;
 	fz_draw_state *state;
 
@@ -1749,6 +1955,11 @@ fz_draw_end_mask(fz_context *ctx, fz_device *devp)
 #endif
 	fz_try(ctx)
 	{
+		/* A mask with a backdrop that is not 0 has to be all there
+		 * before it is converted. */
+		if (state[1].lazy == state[1].dest && state[1].lazy_value)
+			fz_draw_ensure(ctx, dev, dev->top, &state[1].lazy_area);
+
 		/* convert to alpha mask */
 		temp = fz_alpha_from_gray(ctx, state[1].dest);
 		if (state[1].mask != state[0].mask)
@@ -1768,19 +1979,14 @@ fz_draw_end_mask(fz_context *ctx, fz_device *devp)
 
 		/* create new dest scratch buffer */
 		fz_pixmap_bbox(ctx, temp, &bbox);
-		dest = fz_new_pixmap_with_bbox(ctx, state->dest->colorspace, &bbox, state->dest->alpha);
-		fz_copy_pixmap_rect(ctx, dest, state->dest, &bbox);
+		new_lazy_dest(ctx, &state[1], &bbox, state->dest->colorspace, state->dest->alpha, 1, 0);
 
 		/* push soft mask as clip mask */
-		state[1].dest = dest;
 		state[1].blendmode |= FZ_BLEND_ISOLATED;
 		/* If we have a shape, then it'll need to be masked with the
 		 * clip mask when we pop. So create a new shape now. */
 		if (state[0].shape)
-		{
-			state[1].shape = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
-			fz_clear_pixmap(ctx, state[1].shape);
-		}
+			new_lazy_shape(ctx, &state[1], &bbox);
 		state[1].scissor = bbox;
 	}
 	fz_catch(ctx)
@@ -1794,17 +2000,20 @@ fz_draw_begin_group(fz_context *ctx, fz_device *devp, const fz_rect *rect, int i
 {
 	fz_draw_device *dev = (fz_draw_device*)devp;
 	fz_irect bbox;
-	fz_pixmap *dest;
 	fz_draw_state *state = &dev->stack[dev->top];
 	fz_colorspace *model = state->dest->colorspace;
 	fz_rect trect = *rect;
 
+	fz_transform_rect(&trect, &dev->transform);
 	if (state->blendmode & FZ_BLEND_KNOCKOUT)
+	{
+		fz_intersect_irect(fz_irect_from_rect(&bbox, &trect), &state->scissor);
+		fz_draw_ensure(ctx, dev, dev->top, &bbox);
 		fz_knockout_begin(ctx, dev);
+	}
 
 	state = push_stack(ctx, dev);
 	STACK_PUSHED("group");
-	fz_transform_rect(&trect, &dev->transform);
 	fz_intersect_irect(fz_irect_from_rect(&bbox, &trect), &state->scissor);
 
 	fz_try(ctx)
@@ -1814,16 +2023,9 @@ fz_draw_begin_group(fz_context *ctx, fz_device *devp, const fz_rect *rect, int i
 		isolated = 1;
 #endif
 
-		state[1].dest = dest = fz_new_pixmap_with_bbox(ctx, model, &bbox, state[0].dest->alpha || isolated);
-
-		if (isolated)
-		{
-			fz_clear_pixmap(ctx, dest);
-		}
-		else
-		{
-			fz_copy_pixmap_rect(ctx, dest, state[0].dest, &bbox);
-		}
+		/* An isolated group starts out clear, a non-isolated one from
+		 * what it is drawn over. */
+		new_lazy_dest(ctx, &state[1], &bbox, model, state[0].dest->alpha || isolated, !isolated, 0);
 
 		if (blendmode == 0 && alpha == 1.0 && isolated)
 		{
@@ -1833,8 +2035,7 @@ fz_draw_begin_group(fz_context *ctx, fz_device *devp, const fz_rect *rect, int i
 		}
 		else
 		{
-			state[1].shape = fz_new_pixmap_with_bbox(ctx, NULL, &bbox, 1);
-			fz_clear_pixmap(ctx, state[1].shape);
+			new_lazy_shape(ctx, &state[1], &bbox);
 		}
 
 		state[1].alpha = alpha;
@@ -1866,6 +2067,7 @@ fz_draw_end_group(fz_context *ctx, fz_device *devp)
 		return;
 	}
 
+	fz_draw_ensure_pop(ctx, dev);
 	state = &dev->stack[--dev->top];
 	STACK_POPPED("group");
 	alpha = state[1].alpha;
@@ -1915,18 +2117,28 @@ fz_draw_end_group(fz_context *ctx, fz_device *devp)
 		fz_knockout_end(ctx, dev);
 }
 
+/* A rendered tile can be reused wherever the same pattern is drawn with
+ * the same transform, up to a whole number of pixels, into the same kind
+ * of destination. */
 typedef struct
 {
 	int refs;
 	float ctm[4];
+	float phase[2];
+	fz_colorspace *model;
+	int has_shape;
+	int aa, text_aa;
 	int id;
 } tile_key;
 
+/* x and y give the origin of the tile relative to the whole pixel part of
+ * the translation it was drawn with. */
 typedef struct
 {
 	fz_storable storable;
 	fz_pixmap *dest;
 	fz_pixmap *shape;
+	int x, y;
 } tile_record;
 
 static int
@@ -1939,6 +2151,12 @@ fz_make_hash_tile_key(fz_context *ctx, fz_store_hash *hash, void *key_)
 	hash->u.im.m[1] = key->ctm[1];
 	hash->u.im.m[2] = key->ctm[2];
 	hash->u.im.m[3] = key->ctm[3];
+	hash->u.im.phase[0] = key->phase[0];
+	hash->u.im.phase[1] = key->phase[1];
+	hash->u.im.ptr = key->model;
+	hash->u.im.has_shape = key->has_shape;
+	hash->u.im.aa = key->aa;
+	hash->u.im.text_aa = key->text_aa;
 	return 1;
 }
 
@@ -1954,7 +2172,10 @@ fz_drop_tile_key(fz_context *ctx, void *key_)
 {
 	tile_key *key = (tile_key *)key_;
 	if (fz_drop_imp(ctx, key, &key->refs))
+	{
+		fz_drop_colorspace(ctx, key->model);
 		fz_free(ctx, key);
+	}
 }
 
 static int
@@ -1962,23 +2183,46 @@ fz_cmp_tile_key(fz_context *ctx, void *k0_, void *k1_)
 {
 	tile_key *k0 = (tile_key *)k0_;
 	tile_key *k1 = (tile_key *)k1_;
-	return k0->id == k1->id && k0->ctm[0] == k1->ctm[0] && k0->ctm[1] == k1->ctm[1] && k0->ctm[2] == k1->ctm[2] && k0->ctm[3] == k1->ctm[3];
+	return k0->id == k1->id && k0->ctm[0] == k1->ctm[0] && k0->ctm[1] == k1->ctm[1] && k0->ctm[2] == k1->ctm[2] && k0->ctm[3] == k1->ctm[3] &&
+		k0->phase[0] == k1->phase[0] && k0->phase[1] == k1->phase[1] && k0->model == k1->model &&
+		k0->has_shape == k1->has_shape && k0->aa == k1->aa && k0->text_aa == k1->text_aa;
+}
+
+static void
+fz_init_tile_key(fz_context *ctx, tile_key *key, const fz_matrix *ctm, fz_colorspace *model, int has_shape, int id)
+{
+	key->id = id;
+	key->ctm[0] = ctm->a;
+	key->ctm[1] = ctm->b;
+	key->ctm[2] = ctm->c;
+	key->ctm[3] = ctm->d;
+	/* Translations that differ by whole pixels give the same tile, but
+	 * are seldom exact in floats, so match them to 1/256 of a pixel. */
+	key->phase[0] = floorf((ctm->e - floorf(ctm->e)) * 256 + 0.5f) / 256;
+	key->phase[1] = floorf((ctm->f - floorf(ctm->f)) * 256 + 0.5f) / 256;
+	key->model = model;
+	key->has_shape = has_shape;
+	key->aa = fz_graphics_aa_level(ctx);
+	key->text_aa = fz_text_aa_level(ctx);
 }
 
 static void
 fz_print_tile(fz_context *ctx, fz_output *out, void *key_)
 {
 	tile_key *key = (tile_key *)key_;
-	fz_printf(ctx, out, "(tile id=%x, ctm=%g %g %g %g) ", key->id, key->ctm[0], key->ctm[1], key->ctm[2], key->ctm[3]);
+	fz_printf(ctx, out, "(tile id=%x, ctm=%g %g %g %g, phase=%g %g) ", key->id, key->ctm[0], key->ctm[1], key->ctm[2], key->ctm[3], key->phase[0], key->phase[1]);
 }
 
 static fz_store_type fz_tile_store_type =
 {
+	"struct tile_record",
 	fz_make_hash_tile_key,
 	fz_keep_tile_key,
 	fz_drop_tile_key,
 	fz_cmp_tile_key,
-	fz_print_tile
+	fz_print_tile,
+	NULL,
+	2
 };
 
 static void
@@ -1997,12 +2241,14 @@ fz_drop_tile_record(fz_context *ctx, tile_record *tile)
 }
 
 static tile_record *
-fz_new_tile_record(fz_context *ctx, fz_pixmap *dest, fz_pixmap *shape)
+fz_new_tile_record(fz_context *ctx, fz_pixmap *dest, fz_pixmap *shape, const fz_irect *bbox, const fz_matrix *ctm)
 {
 	tile_record *tile = fz_malloc_struct(ctx, tile_record);
 	FZ_INIT_STORABLE(tile, 1, fz_drop_tile_record_imp);
 	tile->dest = fz_keep_pixmap(ctx, dest);
 	tile->shape = fz_keep_pixmap(ctx, shape);
+	tile->x = bbox->x0 - (int)floorf(ctm->e);
+	tile->y = bbox->y0 - (int)floorf(ctm->f);
 	return tile;
 }
 
@@ -2030,7 +2276,10 @@ fz_draw_begin_tile(fz_context *ctx, fz_device *devp, const fz_rect *area, const
 	/* ctm maps from pattern space to device space */
 
 	if (state->blendmode & FZ_BLEND_KNOCKOUT)
+	{
+		fz_draw_ensure(ctx, dev, dev->top, &state->scissor);
 		fz_knockout_begin(ctx, dev);
+	}
 
 	state = push_stack(ctx, dev);
 	STACK_PUSHED("tile");
@@ -2048,12 +2297,8 @@ fz_draw_begin_tile(fz_context *ctx, fz_device *devp, const fz_rect *area, const
 	{
 		tile_key tk;
 		tile_record *tile;
-		tk.ctm[0] = ctm.a;
-		tk.ctm[1] = ctm.b;
-		tk.ctm[2] = ctm.c;
-		tk.ctm[3] = ctm.d;
-		tk.id = id;
 
+		fz_init_tile_key(ctx, &tk, &ctm, model, state[0].shape != NULL, id);
 		tile = fz_find_item(ctx, fz_drop_tile_record_imp, &tk, &fz_tile_store_type);
 		if (tile)
 		{
@@ -2062,14 +2307,20 @@ fz_draw_begin_tile(fz_context *ctx, fz_device *devp, const fz_rect *area, const
 			state[1].blendmode |= FZ_BLEND_ISOLATED;
 			state[1].xstep = xstep;
 			state[1].ystep = ystep;
-			state[1].id = id;
+			/* Already in the store; nothing to put back. */
+			state[1].id = 0;
 			fz_irect_from_rect(&state[1].area, area);
 			state[1].ctm = ctm;
 #ifdef DUMP_GROUP_BLENDS
 			dump_spaces(dev->top-1, "Tile begin (cached)\n");
 #endif
 
-			state[1].scissor = bbox;
+			/* The tile may have been drawn at a different whole
+			 * pixel offset; place it where it falls now. */
+			state[1].scissor.x0 = (int)floorf(ctm.e) + tile->x;
+			state[1].scissor.y0 = (int)floorf(ctm.f) + tile->y;
+			state[1].scissor.x1 = state[1].scissor.x0 + tile->dest->w;
+			state[1].scissor.y1 = state[1].scissor.y0 + tile->dest->h;
 			fz_drop_tile_record(ctx, tile);
 			return 1;
 		}
@@ -2106,16 +2357,35 @@ fz_draw_begin_tile(fz_context *ctx, fz_device *devp, const fz_rect *area, const
 	return 0;
 }
 
+/* Make a header through which a shared pixmap can be painted at another
+ * place. Only the fields that painting needs are read, so that the
+ * reference count, which other threads may be changing, is left alone. */
+static void
+make_paint_header(fz_pixmap *hdr, const fz_pixmap *pix)
+{
+	memset(hdr, 0, sizeof *hdr);
+	hdr->x = pix->x;
+	hdr->y = pix->y;
+	hdr->w = pix->w;
+	hdr->h = pix->h;
+	hdr->n = pix->n;
+	hdr->stride = pix->stride;
+	hdr->alpha = pix->alpha;
+	hdr->colorspace = pix->colorspace;
+	hdr->samples = pix->samples;
+}
+
 static void
 fz_draw_end_tile(fz_context *ctx, fz_device *devp)
 {
 	fz_draw_device *dev = (fz_draw_device*)devp;
 	float xstep, ystep;
-	fz_matrix ttm, ctm, shapectm;
+	fz_matrix ttm, ctm;
 	fz_irect area, scissor, tile_bbox;
 	fz_rect scissor_tmp, tile_tmp;
 	int x0, y0, x1, y1, x, y, extra_x, extra_y;
 	fz_draw_state *state;
+	fz_pixmap tile_dest, tile_shape;
 	tile_record *tile;
 	tile_key *key;
 
@@ -2125,6 +2395,7 @@ fz_draw_end_tile(fz_context *ctx, fz_device *devp)
 		return;
 	}
 
+	fz_draw_ensure(ctx, dev, dev->top-1, &dev->stack[dev->top-1].scissor);
 	state = &dev->stack[--dev->top];
 	STACK_PUSHED("tile");
 	xstep = state[1].xstep;
@@ -2138,10 +2409,7 @@ fz_draw_end_tile(fz_context *ctx, fz_device *devp)
 	fz_transform_rect(fz_expand_rect(&scissor_tmp, 1), fz_invert_matrix(&ttm, &ctm));
 	fz_intersect_irect(&area, fz_irect_from_rect(&scissor, &scissor_tmp));
 
-	tile_bbox.x0 = state[1].dest->x;
-	tile_bbox.y0 = state[1].dest->y;
-	tile_bbox.x1 = state[1].dest->w + tile_bbox.x0;
-	tile_bbox.y1 = state[1].dest->h + tile_bbox.y0;
+	tile_bbox = state[1].scissor;
 	fz_rect_from_irect(&tile_tmp, &tile_bbox);
 	fz_transform_rect(fz_expand_rect(&tile_tmp, 1), &ttm);
 
@@ -2162,14 +2430,14 @@ fz_draw_end_tile(fz_context *ctx, fz_device *devp)
 	x1 = ceilf((area.x1 - tile_tmp.x0 + extra_x) / xstep);
 	y1 = ceilf((area.y1 - tile_tmp.y0 + extra_y) / ystep);
 
-	ctm.e = state[1].dest->x;
-	ctm.f = state[1].dest->y;
+	/* The tile may be shared with other threads through the store, so
+	 * it is painted through copies of its headers rather than by moving
+	 * it about. */
+	ctm.e = tile_bbox.x0;
+	ctm.f = tile_bbox.y0;
+	make_paint_header(&tile_dest, state[1].dest);
 	if (state[1].shape)
-	{
-		shapectm = ctm;
-		shapectm.e = state[1].shape->x;
-		shapectm.f = state[1].shape->y;
-	}
+		make_paint_header(&tile_shape, state[1].shape);
 
 #ifdef DUMP_GROUP_BLENDS
 	dump_spaces(dev->top, "");
@@ -2187,70 +2455,59 @@ fz_draw_end_tile(fz_context *ctx, fz_device *devp)
 		{
 			ttm = ctm;
 			fz_pre_translate(&ttm, x * xstep, y * ystep);
-			state[1].dest->x = ttm.e;
-			state[1].dest->y = ttm.f;
+			tile_dest.x = ttm.e;
+			tile_dest.y = ttm.f;
 			/* Check for overflow due to float -> int conversions */
-			if (state[1].dest->x > 0 && state[1].dest->x + state[1].dest->w < 0)
+			if (tile_dest.x > 0 && tile_dest.x + tile_dest.w < 0)
 				continue;
-			if (state[1].dest->y > 0 && state[1].dest->y + state[1].dest->h < 0)
+			if (tile_dest.y > 0 && tile_dest.y + tile_dest.h < 0)
 				continue;
-			fz_paint_pixmap_with_bbox(state[0].dest, state[1].dest, 255, state[0].scissor);
+			fz_paint_pixmap_with_bbox(state[0].dest, &tile_dest, 255, state[0].scissor);
 			if (state[1].shape)
 			{
-				ttm = shapectm;
-				fz_pre_translate(&ttm, x * xstep, y * ystep);
-				state[1].shape->x = ttm.e;
-				state[1].shape->y = ttm.f;
-				fz_paint_pixmap_with_bbox(state[0].shape, state[1].shape, 255, state[0].scissor);
+				tile_shape.x = tile_dest.x;
+				tile_shape.y = tile_dest.y;
+				fz_paint_pixmap_with_bbox(state[0].shape, &tile_shape, 255, state[0].scissor);
 			}
 		}
 	}
 
-	state[1].dest->x = ctm.e;
-	state[1].dest->y = ctm.f;
-	if (state[1].shape)
+	/* Now we try to cache the tiles, if they have an id to be found by
+	 * again. Any failure here will just result in us not caching. */
+	if (state[1].id)
 	{
-		state[1].shape->x = shapectm.e;
-		state[1].shape->y = shapectm.f;
-	}
-
-	/* Now we try to cache the tiles. Any failure here will just result
-	 * in us not caching. */
-	tile = NULL;
-	key = NULL;
-	fz_var(tile);
-	fz_var(key);
-	fz_try(ctx)
-	{
-		tile_record *existing_tile;
+		tile = NULL;
+		key = NULL;
+		fz_var(tile);
+		fz_var(key);
+		fz_try(ctx)
+		{
+			tile_record *existing_tile;
 
-		tile = fz_new_tile_record(ctx, state[1].dest, state[1].shape);
+			tile = fz_new_tile_record(ctx, state[1].dest, state[1].shape, &tile_bbox, &state[1].ctm);
 
-		key = fz_malloc_struct(ctx, tile_key);
-		key->refs = 1;
-		key->id = state[1].id;
-		key->ctm[0] = ctm.a;
-		key->ctm[1] = ctm.b;
-		key->ctm[2] = ctm.c;
-		key->ctm[3] = ctm.d;
-		existing_tile = fz_store_item(ctx, key, tile, fz_tile_size(ctx, tile), &fz_tile_store_type);
-		if (existing_tile)
+			key = fz_malloc_struct(ctx, tile_key);
+			key->refs = 1;
+			fz_init_tile_key(ctx, key, &state[1].ctm, fz_keep_colorspace(ctx, state[1].dest->colorspace), state[1].shape != NULL, state[1].id);
+			existing_tile = fz_store_item(ctx, key, tile, fz_tile_size(ctx, tile), &fz_tile_store_type);
+			if (existing_tile)
+			{
+				/* We already have a tile. This will either have been
+				 * produced by a racing thread, or there is already
+				 * an entry for this one in the store. */
+				fz_drop_tile_record(ctx, tile);
+				tile = existing_tile;
+			}
+		}
+		fz_always(ctx)
 		{
-			/* We already have a tile. This will either have been
-			 * produced by a racing thread, or there is already
-			 * an entry for this one in the store. */
+			fz_drop_tile_key(ctx, key);
 			fz_drop_tile_record(ctx, tile);
-			tile = existing_tile;
 		}
-	}
-	fz_always(ctx)
-	{
-		fz_drop_tile_key(ctx, key);
-		fz_drop_tile_record(ctx, tile);
-	}
-	fz_catch(ctx)
-	{
-		/* Do nothing */
+		fz_catch(ctx)
+		{
+			/* Do nothing */
+		}
 	}
 
 	/* The following tests should not be required, but just occasionally
@@ -24,8 +24,12 @@ struct fz_aa_context_s
 	int bits;
 	int text_bits;
 	float min_line_width;
+	int cell_threshold;
 };
 
+/* Paths with up to this many edges go through the cell scan converter. */
+#define FZ_DEFAULT_CELL_THRESHOLD 4096
+
 void fz_new_aa_context(fz_context *ctx)
 {
 #ifndef AA_BITS
@@ -35,6 +39,7 @@ void fz_new_aa_context(fz_context *ctx)
 	ctx->aa->scale = 256;
 	ctx->aa->bits = 8;
 	ctx->aa->text_bits = 8;
+	ctx->aa->cell_threshold = FZ_DEFAULT_CELL_THRESHOLD;
 
 #define fz_aa_hscale (ctx->aa->hscale)
 #define fz_aa_vscale (ctx->aa->vscale)
@@ -224,6 +229,24 @@ fz_graphics_min_line_width(fz_context *ctx)
 	return ctx->aa->min_line_width;
 }
 
+void
+fz_set_graphics_cell_threshold(fz_context *ctx, int threshold)
+{
+	if (!ctx || !ctx->aa)
+		return;
+
+	ctx->aa->cell_threshold = threshold;
+}
+
+int
+fz_graphics_cell_threshold(fz_context *ctx)
+{
+	if (!ctx || !ctx->aa)
+		return FZ_DEFAULT_CELL_THRESHOLD;
+
+	return ctx->aa->cell_threshold;
+}
+
 /*
  * Global Edge List -- list of straight path segments for scan conversion
  *
@@ -233,6 +256,7 @@ fz_graphics_min_line_width(fz_context *ctx)
  */
 
 typedef struct fz_edge_s fz_edge;
+typedef struct fz_cell_s fz_cell;
 
 struct fz_edge_s
 {
@@ -242,6 +266,12 @@ struct fz_edge_s
 	int xdir, ydir; /* -1 or +1 */
 };
 
+/* Where an edge crosses a sub scanline, for the cell scan converter. */
+struct fz_cell_s
+{
+	int x, w;
+};
+
 struct fz_gel_s
 {
 	fz_rect clip;
@@ -250,6 +280,8 @@ struct fz_gel_s
 	fz_edge *edges;
 	int acap, alen;
 	fz_edge **active;
+	int ccap;
+	fz_cell *cells;
 };
 
 #ifdef DUMP_GELS
@@ -334,6 +366,7 @@ fz_drop_gel(fz_context *ctx, fz_gel *gel)
 {
 	if (gel == NULL)
 		return;
+	fz_free(ctx, gel->cells);
 	fz_free(ctx, gel->active);
 	fz_free(ctx, gel->edges);
 	fz_free(ctx, gel);
@@ -1043,6 +1076,358 @@ clip_ended:
 	fz_free(ctx, alphas);
 }
 
+/*
+ * Anti-aliased scan conversion by cells.
+ *
+ * Rather than keeping the active edge list sorted for every sub scanline,
+ * the edges are walked a pixel row at a time, and each adds the coverage
+ * it starts or stops straight into the cells (deltas) for that row. This
+ * is exact whenever the active edges span the whole row and keep the same
+ * order across it, as then every sub scanline steps in and out of the path
+ * at the same edges. Other rows fall back to dropping a cell (x position
+ * and winding direction) for each sub scanline crossed by each edge, and
+ * sweeping those in x order. Either way the deltas come out the same as
+ * those from add_span_aa, so the result matches fz_scan_convert_aa. Only
+ * the touched part of each row is resolved and blitted, which pays off
+ * for the thin diagonal paths with wide bounding boxes that make up line
+ * art and maps.
+ */
+
+static inline void
+step_edge(fz_edge *edge)
+{
+	edge->x += edge->xmove;
+	edge->e += edge->adj_up;
+	if (edge->e > 0) {
+		edge->x += edge->xdir;
+		edge->e -= edge->adj_down;
+	}
+}
+
+/* Equivalent to calling step_edge n times. */
+static void
+skip_edge(fz_edge *edge, int n)
+{
+	/* e starts in (-adj_down, 0], so k is the number of times the error
+	 * term would have overflowed. */
+	int64_t e = edge->e + (int64_t)n * edge->adj_up;
+	int k = (int)((e + edge->adj_down - 1) / edge->adj_down);
+	edge->x += n * edge->xmove + k * edge->xdir;
+	edge->e = (int)(e - (int64_t)k * edge->adj_down);
+}
+
+static inline void
+sort_cells(fz_cell *a, int n)
+{
+	int i, k;
+	fz_cell t;
+
+	/* insertion sort; the cells arrive nearly sorted */
+	for (i = 1; i < n; i++)
+	{
+		t = a[i];
+		k = i - 1;
+		while (k >= 0 && a[k].x > t.x)
+		{
+			a[k + 1] = a[k];
+			k--;
+		}
+		a[k + 1] = t;
+	}
+}
+
+static inline void
+add_cell_aa(fz_context *ctx, int *list, int x, int h, int *lo, int *hi)
+{
+	int xpix, xsub;
+	const int hscale = fz_aa_hscale;
+
+	xpix = ((unsigned int)x) / hscale;
+	xsub = ((unsigned int)x) % hscale;
+
+	list[xpix] += h * (hscale - xsub);
+	list[xpix+1] += h * xsub;
+
+	if (xpix < *lo)
+		*lo = xpix;
+	if (xpix + 1 > *hi)
+		*hi = xpix + 1;
+}
+
+/* Check that all the active edges span the row starting at y0, and that
+ * they are strictly in x order on both its first and last sub scanlines.
+ * Bresenham keeps each edge within one subpixel of the true line, so
+ * the edges cannot then swap over anywhere in between. */
+static int
+coherent_row(fz_context *ctx, fz_gel *gel, int y0, int *vertical)
+{
+	const int vscale = fz_aa_vscale;
+	int i, last = INT_MIN;
+	int prev = INT_MIN;
+
+	*vertical = 1;
+	for (i = 0; i < gel->alen; i++)
+	{
+		fz_edge *edge = gel->active[i];
+		int end = edge->x;
+
+		if (edge->y != y0 || edge->h < vscale || edge->x <= prev)
+			return 0;
+		if (edge->xmove != 0 || edge->adj_up != 0)
+		{
+			fz_edge tmp = *edge;
+			skip_edge(&tmp, vscale - 1);
+			end = tmp.x;
+			*vertical = 0;
+		}
+		if (end <= last)
+			return 0;
+		prev = edge->x;
+		last = end;
+	}
+	return 1;
+}
+
+static void
+fz_scan_convert_aa_cells(fz_context *ctx, fz_gel *gel, int eofill, const fz_irect *clip, fz_pixmap *dst, unsigned char *color, void *painter)
+{
+	unsigned char *alphas;
+	int *deltas;
+	int count[16];
+	int y0, y1, yd, e, i, s;
+	int stride, lo, hi, a, b;
+	int coherent, vertical, same, reuse;
+	const int hscale = fz_aa_hscale;
+	const int vscale = fz_aa_vscale;
+
+	int xmin = fz_idiv(gel->bbox.x0, hscale);
+	int xmax = fz_idiv(gel->bbox.x1, hscale) + 1;
+
+	int xofs = xmin * hscale;
+
+	int skipx = clip->x0 - xmin;
+	int clipn = clip->x1 - clip->x0;
+
+	if (gel->len == 0)
+		return;
+
+	assert(clip->x0 >= xmin);
+	assert(clip->x1 <= xmax);
+	assert(vscale <= nelem(count));
+
+	alphas = fz_malloc_no_throw(ctx, xmax - xmin + 1);
+	deltas = fz_malloc_no_throw(ctx, (xmax - xmin + 1) * sizeof(int));
+	if (alphas == NULL || deltas == NULL)
+	{
+		fz_free(ctx, alphas);
+		fz_free(ctx, deltas);
+		fz_throw(ctx, FZ_ERROR_GENERIC, "scan conversion failed (malloc failure)");
+	}
+	memset(deltas, 0, (xmax - xmin + 1) * sizeof(int));
+	gel->alen = 0;
+
+	fz_try(ctx)
+	{
+		e = 0;
+		yd = fz_maxi(fz_idiv(gel->edges[0].y, vscale), clip->y0);
+		a = b = 0;
+		same = 0;
+
+		while (yd < clip->y1 && (gel->alen > 0 || e < gel->len))
+		{
+			/* The sub scanlines of this pixel row are y0 to y1. */
+			y0 = yd * vscale;
+			y1 = y0 + vscale;
+
+			/* Skip empty rows up to the start of the next edge */
+			if (gel->alen == 0 && gel->edges[e].y >= y1)
+			{
+				yd = fz_idiv(gel->edges[e].y, vscale);
+				same = 0;
+				continue;
+			}
+
+			/* Activate the edges that start in this row. Edges that
+			 * start above the clip region are stepped down to it. */
+			while (e < gel->len && gel->edges[e].y < y1)
+			{
+				fz_edge *edge = &gel->edges[e++];
+				if (edge->y < y0)
+				{
+					int n = y0 - edge->y;
+					if (n >= edge->h)
+						continue;
+					skip_edge(edge, n);
+					edge->h -= n;
+					edge->y = y0;
+				}
+				if (gel->alen + 1 >= gel->acap) {
+					int newcap = gel->acap + 64;
+					gel->active = fz_resize_array(ctx, gel->active, newcap, sizeof(fz_edge*));
+					gel->acap = newcap;
+				}
+				gel->active[gel->alen++] = edge;
+				same = 0;
+			}
+
+			sort_active(gel->active, gel->alen);
+
+			lo = xmax - xmin;
+			hi = -1;
+
+			/* If nothing has changed since the row above, its
+			 * coverage can simply be plotted again. */
+			coherent = coherent_row(ctx, gel, y0, &vertical);
+			reuse = coherent && vertical && same;
+			if (reuse)
+				;
+			else if (coherent)
+			{
+				/* Every sub scanline enters and leaves the path
+				 * at the same edges, so add each edge's share
+				 * of coverage directly. */
+				int winding = 0;
+				for (i = 0; i < gel->alen; i++)
+				{
+					fz_edge *edge = gel->active[i];
+					int h = 0;
+
+					if (eofill)
+						h = (i & 1) ? -1 : 1;
+					else
+					{
+						int inside = winding != 0;
+						winding += edge->ydir;
+						if (inside != (winding != 0))
+							h = inside ? -1 : 1;
+					}
+
+					if (vertical)
+					{
+						if (h)
+							add_cell_aa(ctx, deltas, edge->x - xofs, h * vscale, &lo, &hi);
+					}
+					else if (h)
+					{
+						for (s = 0; s < vscale; s++)
+						{
+							add_cell_aa(ctx, deltas, edge->x - xofs, h, &lo, &hi);
+							step_edge(edge);
+						}
+					}
+					else
+						skip_edge(edge, vscale);
+				}
+			}
+			else
+			{
+				/* Drop a cell for every sub scanline crossed by
+				 * each active edge. */
+				stride = gel->alen;
+				if (stride * vscale > gel->ccap)
+				{
+					int newcap = stride * vscale + 64;
+					gel->cells = fz_resize_array(ctx, gel->cells, newcap, sizeof(fz_cell));
+					gel->ccap = newcap;
+				}
+				memset(count, 0, vscale * sizeof(int));
+
+				for (i = 0; i < gel->alen; i++)
+				{
+					fz_edge *edge = gel->active[i];
+					int end = fz_mini(edge->y + edge->h, y1) - y0;
+
+					for (s = edge->y - y0; s < end; s++)
+					{
+						fz_cell *cell = &gel->cells[s * stride + count[s]++];
+						cell->x = edge->x - xofs;
+						cell->w = edge->ydir;
+						step_edge(edge);
+					}
+				}
+
+				/* Sweep each sub scanline, adding deltas wherever
+				 * the fill rule steps in or out of the path. */
+				for (s = 0; s < vscale; s++)
+				{
+					fz_cell *cell = &gel->cells[s * stride];
+					int n = count[s];
+					int winding = 0;
+
+					sort_cells(cell, n);
+					if (eofill)
+					{
+						for (i = 0; i < n; i++)
+							add_cell_aa(ctx, deltas, cell[i].x, (i & 1) ? -1 : 1, &lo, &hi);
+					}
+					else
+					{
+						for (i = 0; i < n; i++)
+						{
+							int inside = winding != 0;
+							winding += cell[i].w;
+							if (inside != (winding != 0))
+								add_cell_aa(ctx, deltas, cell[i].x, inside ? -1 : 1, &lo, &hi);
+						}
+					}
+				}
+			}
+
+			/* Move the edges down to the next row, and retire
+			 * those that end here. */
+			same = coherent && vertical;
+			i = 0;
+			while (i < gel->alen)
+			{
+				fz_edge *edge = gel->active[i];
+				int end = fz_mini(edge->y + edge->h, y1);
+
+				edge->h -= end - edge->y;
+				edge->y = end;
+				if (edge->h == 0)
+				{
+					gel->active[i] = gel->active[--gel->alen];
+					same = 0;
+				}
+				else
+					i++;
+			}
+
+			/* Coverage is zero outside lo to hi, so only that part
+			 * of the row needs to be resolved and plotted. */
+			if (reuse)
+			{
+				if (a < b)
+					blit_aa(dst, xmin + a, yd, alphas + a, b - a, color, painter);
+			}
+			else if (hi >= 0)
+			{
+				a = fz_maxi(lo, skipx);
+				b = fz_mini(hi, skipx + clipn);
+				if (a < b)
+				{
+					undelta_aa(ctx, alphas + lo, deltas + lo, b - lo);
+					blit_aa(dst, xmin + a, yd, alphas + a, b - a, color, painter);
+				}
+				memset(deltas + lo, 0, (hi - lo + 1) * sizeof(int));
+			}
+			else
+				a = b = 0;
+
+			yd++;
+		}
+	}
+	fz_always(ctx)
+	{
+		fz_free(ctx, deltas);
+		fz_free(ctx, alphas);
+	}
+	fz_catch(ctx)
+	{
+		fz_rethrow(ctx);
+	}
+}
+
 /*
  * Sharp (not anti-aliased) scan conversion
  */
@@ -1170,7 +1555,10 @@ fz_scan_convert(fz_context *ctx, fz_gel *gel, int eofill, const fz_irect *clip,
 		assert(fn);
 		if (fn == NULL)
 			return;
-		fz_scan_convert_aa(ctx, gel, eofill, &local_clip, dst, color, fn);
+		if (gel->len <= fz_graphics_cell_threshold(ctx))
+			fz_scan_convert_aa_cells(ctx, gel, eofill, &local_clip, dst, color, fn);
+		else
+			fz_scan_convert_aa(ctx, gel, eofill, &local_clip, dst, color, fn);
 	}
 	else
 	{
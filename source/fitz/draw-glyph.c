@@ -4,10 +4,17 @@
 
 #define MAX_GLYPH_SIZE 256
 #define MAX_CACHE_SIZE (1024*1024)
+#define MAX_LOCAL_LEN 256
 
-#define GLYPH_HASH_LEN 509
+/* Average glyph size we allow for when sizing the hash tables. */
+#define GLYPH_BUCKET_SIZE 2048
+
+#define GLYPH_SHARDS (FZ_LOCK_GLYPHCACHE_LAST - FZ_LOCK_GLYPHCACHE + 1)
 
 typedef struct fz_glyph_cache_entry_s fz_glyph_cache_entry;
+typedef struct fz_glyph_cache_shard_s fz_glyph_cache_shard;
+typedef struct fz_glyph_cache_shared_s fz_glyph_cache_shared;
+typedef struct fz_glyph_cache_slot_s fz_glyph_cache_slot;
 typedef struct fz_glyph_key_s fz_glyph_key;
 
 struct fz_glyph_key_s
@@ -31,104 +38,327 @@ struct fz_glyph_cache_entry_s
 	fz_glyph *val;
 };
 
-struct fz_glyph_cache_s
+/*
+	The shared cache is split by hash into shards, each with its own
+	lock, table and LRU list, so that threads rendering different
+	glyphs rarely wait for one another.
+*/
+struct fz_glyph_cache_shard_s
 {
-	int refs;
 	size_t total;
+	size_t max;
 #ifndef NDEBUG
 	int num_evictions;
 	ptrdiff_t evicted;
 #endif
-	fz_glyph_cache_entry *entry[GLYPH_HASH_LEN];
+	int len;
+	fz_glyph_cache_entry **entry;
 	fz_glyph_cache_entry *lru_head;
 	fz_glyph_cache_entry *lru_tail;
 };
 
-void
-fz_new_glyph_cache_context(fz_context *ctx)
+struct fz_glyph_cache_shared_s
+{
+	int refs;
+	int generation;
+	size_t max;
+	fz_glyph_cache_shard shard[GLYPH_SHARDS];
+};
+
+/*
+	Each context has a small direct mapped cache of its own in front
+	of the shared one. Contexts are only ever used by one thread at a
+	time, so this needs no locking. Purging the shared cache bumps its
+	generation, which tells every local cache to empty itself the next
+	time it is used.
+*/
+struct fz_glyph_cache_slot_s
+{
+	fz_glyph_key key;
+	fz_glyph *val;
+};
+
+struct fz_glyph_cache_s
+{
+	fz_glyph_cache_shared *shared;
+	int generation;
+	int len;
+	fz_glyph_cache_slot *slot;
+	int hits;
+	int misses;
+};
+
+static int
+hash_len_for_size(size_t max)
+{
+	size_t len = max / GLYPH_SHARDS / GLYPH_BUCKET_SIZE;
+	if (len < 17)
+		return 17;
+	if (len > 65521)
+		return 65521;
+	return (int)len | 1;
+}
+
+static void
+new_local_glyph_cache(fz_context *ctx, fz_glyph_cache_shared *shared, int len)
 {
 	fz_glyph_cache *cache;
 
 	cache = fz_malloc_struct(ctx, fz_glyph_cache);
-	cache->total = 0;
-	cache->refs = 1;
+	fz_try(ctx)
+		cache->slot = fz_calloc(ctx, len, sizeof(fz_glyph_cache_slot));
+	fz_catch(ctx)
+	{
+		fz_free(ctx, cache);
+		fz_rethrow(ctx);
+	}
+	cache->len = len;
+	cache->shared = shared;
+	cache->generation = shared->generation;
 
 	ctx->glyph_cache = cache;
 }
 
-static void
-drop_glyph_cache_entry(fz_context *ctx, fz_glyph_cache_entry *entry)
+void
+fz_new_glyph_cache_context(fz_context *ctx)
 {
-	fz_glyph_cache *cache = ctx->glyph_cache;
+	fz_glyph_cache_shared *shared;
+	int i, len = hash_len_for_size(MAX_CACHE_SIZE);
+
+	shared = fz_malloc_struct(ctx, fz_glyph_cache_shared);
+	fz_try(ctx)
+	{
+		for (i = 0; i < GLYPH_SHARDS; i++)
+		{
+			shared->shard[i].entry = fz_calloc(ctx, len, sizeof(fz_glyph_cache_entry *));
+			shared->shard[i].len = len;
+			shared->shard[i].max = MAX_CACHE_SIZE / GLYPH_SHARDS;
+		}
+		shared->max = MAX_CACHE_SIZE;
+		shared->refs = 1;
+		new_local_glyph_cache(ctx, shared, MAX_LOCAL_LEN);
+	}
+	fz_catch(ctx)
+	{
+		for (i = 0; i < GLYPH_SHARDS; i++)
+			fz_free(ctx, shared->shard[i].entry);
+		fz_free(ctx, shared);
+		fz_rethrow(ctx);
+	}
+}
+
+void
+fz_clone_glyph_cache_context(fz_context *dst, fz_context *src)
+{
+	fz_glyph_cache_shared *shared = src->glyph_cache->shared;
+
+	fz_lock(dst, FZ_LOCK_GLYPHCACHE);
+	shared->refs++;
+	fz_unlock(dst, FZ_LOCK_GLYPHCACHE);
+	fz_try(dst)
+		new_local_glyph_cache(dst, shared, src->glyph_cache->len);
+	fz_catch(dst)
+	{
+		fz_lock(dst, FZ_LOCK_GLYPHCACHE);
+		shared->refs--;
+		fz_unlock(dst, FZ_LOCK_GLYPHCACHE);
+		fz_rethrow(dst);
+	}
+}
 
+static void
+drop_glyph_cache_entry(fz_context *ctx, fz_glyph_cache_shard *shard, fz_glyph_cache_entry *entry)
+{
 	if (entry->lru_next)
 		entry->lru_next->lru_prev = entry->lru_prev;
 	else
-		cache->lru_tail = entry->lru_prev;
+		shard->lru_tail = entry->lru_prev;
 	if (entry->lru_prev)
 		entry->lru_prev->lru_next = entry->lru_next;
 	else
-		cache->lru_head = entry->lru_next;
-	cache->total -= fz_glyph_size(ctx, entry->val);
+		shard->lru_head = entry->lru_next;
+	shard->total -= fz_glyph_size(ctx, entry->val);
 	if (entry->bucket_next)
 		entry->bucket_next->bucket_prev = entry->bucket_prev;
 	if (entry->bucket_prev)
 		entry->bucket_prev->bucket_next = entry->bucket_next;
 	else
-		cache->entry[entry->hash] = entry->bucket_next;
+		shard->entry[entry->hash / GLYPH_SHARDS % shard->len] = entry->bucket_next;
 	fz_drop_font(ctx, entry->key.font);
 	fz_drop_glyph(ctx, entry->val);
 	fz_free(ctx, entry);
 }
 
-/* The glyph cache lock is always held when this function is called. */
+/* The shard lock is always held when this function is called. */
 static void
-do_purge(fz_context *ctx)
+do_purge(fz_context *ctx, fz_glyph_cache_shard *shard)
 {
-	fz_glyph_cache *cache = ctx->glyph_cache;
 	int i;
 
-	for (i = 0; i < GLYPH_HASH_LEN; i++)
+	for (i = 0; i < shard->len; i++)
 	{
-		while (cache->entry[i])
-			drop_glyph_cache_entry(ctx, cache->entry[i]);
+		while (shard->entry[i])
+			drop_glyph_cache_entry(ctx, shard, shard->entry[i]);
 	}
 
-	cache->total = 0;
+	shard->total = 0;
+}
+
+/* The shard lock is always held when this function is called. */
+static void
+do_evict(fz_context *ctx, fz_glyph_cache_shard *shard)
+{
+	while (shard->total > shard->max)
+	{
+#ifndef NDEBUG
+		shard->num_evictions++;
+		shard->evicted += fz_glyph_size(ctx, shard->lru_tail->val);
+#endif
+		drop_glyph_cache_entry(ctx, shard, shard->lru_tail);
+	}
+}
+
+static void
+flush_local_glyph_cache(fz_context *ctx, fz_glyph_cache *cache)
+{
+	int i;
+
+	for (i = 0; i < cache->len; i++)
+	{
+		if (cache->slot[i].key.font)
+		{
+			fz_drop_glyph(ctx, cache->slot[i].val);
+			fz_drop_font(ctx, cache->slot[i].key.font);
+			cache->slot[i].key.font = NULL;
+			cache->slot[i].val = NULL;
+		}
+	}
 }
 
 void
 fz_purge_glyph_cache(fz_context *ctx)
 {
-	fz_lock(ctx, FZ_LOCK_GLYPHCACHE);
-	do_purge(ctx);
-	fz_unlock(ctx, FZ_LOCK_GLYPHCACHE);
+	fz_glyph_cache_shared *shared = ctx->glyph_cache->shared;
+	int i;
+
+	flush_local_glyph_cache(ctx, ctx->glyph_cache);
+	for (i = 0; i < GLYPH_SHARDS; i++)
+	{
+		fz_lock(ctx, FZ_LOCK_GLYPHCACHE + i);
+		if (i == 0)
+			shared->generation++;
+		do_purge(ctx, &shared->shard[i]);
+		fz_unlock(ctx, FZ_LOCK_GLYPHCACHE + i);
+	}
+	ctx->glyph_cache->generation = shared->generation;
 }
 
 void
 fz_drop_glyph_cache_context(fz_context *ctx)
 {
+	fz_glyph_cache *cache;
+	fz_glyph_cache_shared *shared;
+	int i, refs;
+
 	if (!ctx || !ctx->glyph_cache)
 		return;
 
+	cache = ctx->glyph_cache;
+	shared = cache->shared;
+	flush_local_glyph_cache(ctx, cache);
+	fz_free(ctx, cache->slot);
+	fz_free(ctx, cache);
+	ctx->glyph_cache = NULL;
+
 	fz_lock(ctx, FZ_LOCK_GLYPHCACHE);
-	ctx->glyph_cache->refs--;
-	if (ctx->glyph_cache->refs == 0)
+	refs = --shared->refs;
+	fz_unlock(ctx, FZ_LOCK_GLYPHCACHE);
+	if (refs == 0)
 	{
-		do_purge(ctx);
-		fz_free(ctx, ctx->glyph_cache);
-		ctx->glyph_cache = NULL;
+		for (i = 0; i < GLYPH_SHARDS; i++)
+		{
+			do_purge(ctx, &shared->shard[i]);
+			fz_free(ctx, shared->shard[i].entry);
+		}
+		fz_free(ctx, shared);
 	}
-	fz_unlock(ctx, FZ_LOCK_GLYPHCACHE);
 }
 
-fz_glyph_cache *
-fz_keep_glyph_cache(fz_context *ctx)
+void
+fz_set_glyph_cache_size(fz_context *ctx, size_t size)
 {
-	fz_lock(ctx, FZ_LOCK_GLYPHCACHE);
-	ctx->glyph_cache->refs++;
-	fz_unlock(ctx, FZ_LOCK_GLYPHCACHE);
-	return ctx->glyph_cache;
+	fz_glyph_cache_shared *shared = ctx->glyph_cache->shared;
+	fz_glyph_cache_entry **table[GLYPH_SHARDS];
+	fz_glyph_cache_entry **old, *entry, *next;
+	fz_glyph_cache_shard *shard;
+	int i, k, len = hash_len_for_size(size);
+
+	memset(table, 0, sizeof table);
+	fz_try(ctx)
+	{
+		for (i = 0; i < GLYPH_SHARDS; i++)
+			table[i] = fz_calloc(ctx, len, sizeof(fz_glyph_cache_entry *));
+	}
+	fz_catch(ctx)
+	{
+		for (i = 0; i < GLYPH_SHARDS; i++)
+			fz_free(ctx, table[i]);
+		fz_rethrow(ctx);
+	}
+
+	for (i = 0; i < GLYPH_SHARDS; i++)
+	{
+		shard = &shared->shard[i];
+		fz_lock(ctx, FZ_LOCK_GLYPHCACHE + i);
+		if (i == 0)
+			shared->max = size;
+		shard->max = size / GLYPH_SHARDS;
+		do_evict(ctx, shard);
+
+		/* Rehash what is left into the new table. */
+		for (k = 0; k < shard->len; k++)
+		{
+			for (entry = shard->entry[k]; entry; entry = next)
+			{
+				fz_glyph_cache_entry **head = &table[i][entry->hash / GLYPH_SHARDS % len];
+				next = entry->bucket_next;
+				entry->bucket_prev = NULL;
+				entry->bucket_next = *head;
+				if (*head)
+					(*head)->bucket_prev = entry;
+				*head = entry;
+			}
+		}
+		old = shard->entry;
+		shard->entry = table[i];
+		shard->len = len;
+		table[i] = old;
+		fz_unlock(ctx, FZ_LOCK_GLYPHCACHE + i);
+	}
+
+	for (i = 0; i < GLYPH_SHARDS; i++)
+		fz_free(ctx, table[i]);
+}
+
+size_t
+fz_glyph_cache_size(fz_context *ctx)
+{
+	return ctx->glyph_cache->shared->max;
+}
+
+void
+fz_set_glyph_cache_local_size(fz_context *ctx, int len)
+{
+	fz_glyph_cache *cache = ctx->glyph_cache;
+	fz_glyph_cache_slot *slot;
+
+	if (len < 0)
+		len = 0;
+	slot = fz_calloc(ctx, len, sizeof(fz_glyph_cache_slot));
+	flush_local_glyph_cache(ctx, cache);
+	fz_free(ctx, cache->slot);
+	cache->slot = slot;
+	cache->len = len;
 }
 
 float
@@ -222,7 +452,7 @@ static unsigned do_hash(unsigned char *s, int len)
 }
 
 static inline void
-move_to_front(fz_glyph_cache *cache, fz_glyph_cache_entry *entry)
+move_to_front(fz_glyph_cache_shard *shard, fz_glyph_cache_entry *entry)
 {
 	if (entry->lru_prev == NULL)
 		return; /* At front already */
@@ -232,31 +462,89 @@ move_to_front(fz_glyph_cache *cache, fz_glyph_cache_entry *entry)
 	if (entry->lru_next)
 		entry->lru_next->lru_prev = entry->lru_prev;
 	else
-		cache->lru_tail = entry->lru_prev;
+		shard->lru_tail = entry->lru_prev;
 	/* Relink */
-	entry->lru_next = cache->lru_head;
+	entry->lru_next = shard->lru_head;
 	if (entry->lru_next)
 		entry->lru_next->lru_prev = entry;
-	cache->lru_head = entry;
+	shard->lru_head = entry;
 	entry->lru_prev = NULL;
 }
 
+/* The shard lock is always held when this function is called. */
+static fz_glyph *
+find_glyph(fz_context *ctx, fz_glyph_cache_shard *shard, const fz_glyph_key *key, unsigned hash)
+{
+	fz_glyph_cache_entry *entry = shard->entry[hash / GLYPH_SHARDS % shard->len];
+	while (entry)
+	{
+		if (memcmp(&entry->key, key, sizeof(*key)) == 0)
+		{
+			move_to_front(shard, entry);
+			return fz_keep_glyph(ctx, entry->val);
+		}
+		entry = entry->bucket_next;
+	}
+	return NULL;
+}
+
+/* The shard lock is always held when this function is called. */
+static void
+insert_glyph(fz_context *ctx, fz_glyph_cache_shard *shard, const fz_glyph_key *key, unsigned hash, fz_glyph *val)
+{
+	fz_glyph_cache_entry *entry;
+	int i = hash / GLYPH_SHARDS % shard->len;
+
+	entry = fz_malloc_struct(ctx, fz_glyph_cache_entry);
+	entry->key = *key;
+	entry->hash = hash;
+	entry->bucket_next = shard->entry[i];
+	if (entry->bucket_next)
+		entry->bucket_next->bucket_prev = entry;
+	shard->entry[i] = entry;
+	entry->val = fz_keep_glyph(ctx, val);
+	fz_keep_font(ctx, key->font);
+
+	entry->lru_next = shard->lru_head;
+	if (entry->lru_next)
+		entry->lru_next->lru_prev = entry;
+	else
+		shard->lru_tail = entry;
+	shard->lru_head = entry;
+
+	shard->total += fz_glyph_size(ctx, val);
+	do_evict(ctx, shard);
+}
+
+static void
+store_local_glyph(fz_context *ctx, fz_glyph_cache_slot *slot, const fz_glyph_key *key, fz_glyph *val)
+{
+	if (slot->key.font)
+	{
+		fz_drop_glyph(ctx, slot->val);
+		fz_drop_font(ctx, slot->key.font);
+	}
+	slot->key = *key;
+	slot->val = fz_keep_glyph(ctx, val);
+	fz_keep_font(ctx, key->font);
+}
+
 fz_glyph *
 fz_render_glyph(fz_context *ctx, fz_font *font, int gid, fz_matrix *ctm, fz_colorspace *model, const fz_irect *scissor, int alpha)
 {
 	fz_glyph_cache *cache;
+	fz_glyph_cache_shard *shard;
+	fz_glyph_cache_slot *slot = NULL;
 	fz_glyph_key key;
 	fz_matrix subpix_ctm;
 	fz_irect subpix_scissor;
 	float size;
-	fz_glyph *val;
-	int do_cache, locked, caching;
-	fz_glyph_cache_entry *entry;
+	fz_glyph *val, *found;
+	int do_cache, locked;
 	unsigned hash;
 	int is_ft_font = !!fz_font_ft_face(ctx, font);
 
 	fz_var(locked);
-	fz_var(caching);
 	fz_var(val);
 
 	memset(&key, 0, sizeof key);
@@ -288,121 +576,79 @@ fz_render_glyph(fz_context *ctx, fz_font *font, int gid, fz_matrix *ctm, fz_colo
 	key.d = subpix_ctm.d * 65536;
 	key.aa = fz_text_aa_level(ctx);
 
-	hash = do_hash((unsigned char *)&key, sizeof(key)) % GLYPH_HASH_LEN;
-	fz_lock(ctx, FZ_LOCK_GLYPHCACHE);
-	entry = cache->entry[hash];
-	while (entry)
+	hash = do_hash((unsigned char *)&key, sizeof(key));
+
+	/* The generation is read without the lock; at worst we notice a
+	 * purge one glyph late. */
+	if (cache->generation != cache->shared->generation)
+	{
+		flush_local_glyph_cache(ctx, cache);
+		cache->generation = cache->shared->generation;
+	}
+	if (cache->len > 0)
 	{
-		if (memcmp(&entry->key, &key, sizeof(key)) == 0)
+		slot = &cache->slot[hash % cache->len];
+		if (slot->key.font && memcmp(&slot->key, &key, sizeof(key)) == 0)
 		{
-			move_to_front(cache, entry);
-			val = fz_keep_glyph(ctx, entry->val);
-			fz_unlock(ctx, FZ_LOCK_GLYPHCACHE);
-			return val;
+			cache->hits++;
+			return fz_keep_glyph(ctx, slot->val);
 		}
-		entry = entry->bucket_next;
+		cache->misses++;
+	}
+
+	shard = &cache->shared->shard[hash % GLYPH_SHARDS];
+	fz_lock(ctx, FZ_LOCK_GLYPHCACHE + hash % GLYPH_SHARDS);
+	val = find_glyph(ctx, shard, &key, hash);
+	fz_unlock(ctx, FZ_LOCK_GLYPHCACHE + hash % GLYPH_SHARDS);
+	if (val)
+	{
+		if (slot)
+			store_local_glyph(ctx, slot, &key, val);
+		return val;
 	}
 
-	locked = 1;
-	caching = 0;
-	val = NULL;
+	/* We render without holding the shard lock. The danger here is
+	 * that some other thread will come along, and want the same
+	 * glyph too. If it does, we may both end up rendering pixmaps.
+	 * We cope with this later on, by ensuring that only one gets
+	 * inserted into the cache. If we insert ours to find one already
+	 * there, we abandon ours, and use the one there already. */
+	if (is_ft_font)
+		val = fz_render_ft_glyph(ctx, font, gid, &subpix_ctm, key.aa);
+	else if (fz_font_t3_procs(ctx, font))
+		val = fz_render_t3_glyph(ctx, font, gid, &subpix_ctm, model, scissor);
+	else
+		fz_warn(ctx, "assert: uninitialized font structure");
 
-	fz_try(ctx)
+	if (val && do_cache && val->w < MAX_GLYPH_SIZE && val->h < MAX_GLYPH_SIZE)
 	{
-		if (is_ft_font)
+		/* If we throw an exception whilst caching,
+		 * just ignore the exception and carry on. */
+		locked = 0;
+		fz_try(ctx)
 		{
-			val = fz_render_ft_glyph(ctx, font, gid, &subpix_ctm, key.aa);
-		}
-		else if (fz_font_t3_procs(ctx, font))
-		{
-			/* We drop the glyphcache here, and execute the t3
-			 * glyph code. The danger here is that some other
-			 * thread will come along, and want the same glyph
-			 * too. If it does, we may both end up rendering
-			 * pixmaps. We cope with this later on, by ensuring
-			 * that only one gets inserted into the cache. If
-			 * we insert ours to find one already there, we
-			 * abandon ours, and use the one there already.
-			 */
-			fz_unlock(ctx, FZ_LOCK_GLYPHCACHE);
-			locked = 0;
-			val = fz_render_t3_glyph(ctx, font, gid, &subpix_ctm, model, scissor);
-			fz_lock(ctx, FZ_LOCK_GLYPHCACHE);
+			fz_lock(ctx, FZ_LOCK_GLYPHCACHE + hash % GLYPH_SHARDS);
 			locked = 1;
-		}
-		else
-		{
-			fz_warn(ctx, "assert: uninitialized font structure");
-		}
-		if (val && do_cache)
-		{
-			if (val->w < MAX_GLYPH_SIZE && val->h < MAX_GLYPH_SIZE)
+			found = find_glyph(ctx, shard, &key, hash);
+			if (found)
 			{
-				/* If we throw an exception whilst caching,
-				 * just ignore the exception and carry on. */
-				caching = 1;
-				if (!is_ft_font)
-				{
-					/* We had to unlock. Someone else might
-					 * have rendered in the meantime */
-					entry = cache->entry[hash];
-					while (entry)
-					{
-						if (memcmp(&entry->key, &key, sizeof(key)) == 0)
-						{
-							fz_drop_glyph(ctx, val);
-							move_to_front(cache, entry);
-							val = fz_keep_glyph(ctx, entry->val);
-							goto unlock_and_return_val;
-						}
-						entry = entry->bucket_next;
-					}
-				}
-
-				entry = fz_malloc_struct(ctx, fz_glyph_cache_entry);
-				entry->key = key;
-				entry->hash = hash;
-				entry->bucket_next = cache->entry[hash];
-				if (entry->bucket_next)
-					entry->bucket_next->bucket_prev = entry;
-				cache->entry[hash] = entry;
-				entry->val = fz_keep_glyph(ctx, val);
-				fz_keep_font(ctx, key.font);
-
-				entry->lru_next = cache->lru_head;
-				if (entry->lru_next)
-					entry->lru_next->lru_prev = entry;
-				else
-					cache->lru_tail = entry;
-				cache->lru_head = entry;
-
-				cache->total += fz_glyph_size(ctx, val);
-				while (cache->total > MAX_CACHE_SIZE)
-				{
-#ifndef NDEBUG
-					cache->num_evictions++;
-					cache->evicted += fz_glyph_size(ctx, cache->lru_tail->val);
-#endif
-					drop_glyph_cache_entry(ctx, cache->lru_tail);
-				}
-
+				fz_drop_glyph(ctx, val);
+				val = found;
 			}
+			else
+				insert_glyph(ctx, shard, &key, hash, val);
 		}
-unlock_and_return_val:
+		fz_always(ctx)
 		{
+			if (locked)
+				fz_unlock(ctx, FZ_LOCK_GLYPHCACHE + hash % GLYPH_SHARDS);
 		}
-	}
-	fz_always(ctx)
-	{
-		if (locked)
-			fz_unlock(ctx, FZ_LOCK_GLYPHCACHE);
-	}
-	fz_catch(ctx)
-	{
-		if (caching)
+		fz_catch(ctx)
+		{
 			fz_warn(ctx, "cannot encache glyph; continuing");
-		else
-			fz_rethrow(ctx);
+		}
+		if (slot)
+			store_local_glyph(ctx, slot, &key, val);
 	}
 
 	return val;
@@ -455,9 +701,29 @@ void
 fz_dump_glyph_cache_stats(fz_context *ctx)
 {
 	fz_glyph_cache *cache = ctx->glyph_cache;
+	fz_glyph_cache_shard *shard;
+	size_t total = 0;
+#ifndef NDEBUG
+	int num_evictions = 0;
+	ptrdiff_t evicted = 0;
+#endif
+	int i;
+
+	for (i = 0; i < GLYPH_SHARDS; i++)
+	{
+		shard = &cache->shared->shard[i];
+		fz_lock(ctx, FZ_LOCK_GLYPHCACHE + i);
+		total += shard->total;
+#ifndef NDEBUG
+		num_evictions += shard->num_evictions;
+		evicted += shard->evicted;
+#endif
+		fz_unlock(ctx, FZ_LOCK_GLYPHCACHE + i);
+	}
 
-	fprintf(stderr, "Glyph Cache Size: " FMT_zu "\n", cache->total);
+	fprintf(stderr, "Glyph Cache Size: " FMT_zu "\n", total);
 #ifndef NDEBUG
-	fprintf(stderr, "Glyph Cache Evictions: %d (" FMT_zu " bytes)\n", cache->num_evictions, cache->evicted);
+	fprintf(stderr, "Glyph Cache Evictions: %d (" FMT_zu " bytes)\n", num_evictions, evicted);
 #endif
+	fprintf(stderr, "Glyph Cache Local Hits: %d of %d\n", cache->hits, cache->hits + cache->misses);
 }
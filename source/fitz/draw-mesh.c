@@ -201,6 +201,258 @@ do_paint_tri(fz_context *ctx, void *arg, fz_vertex *av, fz_vertex *bv, fz_vertex
 	fz_paint_triangle(dest, vertices, 2 + fz_colorspace_n(ctx, dest->colorspace), ptd->bbox);
 }
 
+/*
+	Axial and radial shadings that go through a function are not
+	split into triangles; the position along the shading of each
+	pixel is worked out directly, and used to index the colour table.
+	As with the meshes, pixels are sampled at their top left corners.
+
+	For axial shadings the position is the projection of the point
+	onto the axis, which is linear in the device space. For radial
+	shadings it is the largest s for which the point lies on the
+	circle centred on p0 + s * (p1 - p0) with radius r0 + s * (r1 - r0),
+	where that radius is not negative and s is within [0,1] or the
+	shading is extended that way; this is a quadratic in s.
+*/
+typedef struct
+{
+	int extend[2];
+
+	/* Axial: t = tx * x + rt, with rt worked out for each row. */
+	float tx, ty, t0, rt;
+
+	/* Radial: the point relative to p0 is (ia * x + rx, ib * x + ry). */
+	float ia, ib, ic, id, ex, ey;
+	float rx, ry;
+	float cdx, cdy, r0, dr, r0dr, r0r0, a;
+} shade_eval;
+
+typedef void (shade_row_fn)(const shade_eval *ev, int *out, int x, int i, int w);
+
+/* Each of these sets out[i..w-1] to the colour table index of the
+ * pixels from x+i on, or to -1 where the shading does not cover. */
+
+static void
+eval_axial_row(const shade_eval *ev, int *out, int x, int i, int w)
+{
+	for (; i < w; i++)
+	{
+		float t = ev->tx * (float)(x + i) + ev->rt;
+		if ((t >= 0 || ev->extend[0]) && (t <= 1 || ev->extend[1]))
+		{
+			t = t > 0 ? t : 0;
+			t = t < 1 ? t : 1;
+			out[i] = (int)(t * 255);
+		}
+		else
+			out[i] = -1;
+	}
+}
+
+static inline int
+radial_root_ok(const shade_eval *ev, float s)
+{
+	return ev->r0 + s * ev->dr >= 0 && (s >= 0 || ev->extend[0]) && (s <= 1 || ev->extend[1]);
+}
+
+static void
+eval_radial_row(const shade_eval *ev, int *out, int x, int i, int w)
+{
+	for (; i < w; i++)
+	{
+		float fx = (float)(x + i);
+		float pdx = ev->ia * fx + ev->rx;
+		float pdy = ev->ib * fx + ev->ry;
+		float b = pdx * ev->cdx + pdy * ev->cdy + ev->r0dr;
+		float c = pdx * pdx + pdy * pdy - ev->r0r0;
+		float s1, s2, hi, lo, t;
+
+		if (ev->a != 0)
+		{
+			float d = b * b - ev->a * c;
+			if (!(d >= 0))
+			{
+				out[i] = -1;
+				continue;
+			}
+			d = sqrtf(d);
+			s1 = (b + d) / ev->a;
+			s2 = (b - d) / ev->a;
+		}
+		else
+		{
+			/* One circle touches the other from inside, and the
+			 * quadratic is a linear equation. */
+			if (b == 0)
+			{
+				out[i] = -1;
+				continue;
+			}
+			s1 = s2 = c / (2 * b);
+		}
+
+		hi = s1 > s2 ? s1 : s2;
+		lo = s1 < s2 ? s1 : s2;
+		if (radial_root_ok(ev, hi))
+			t = hi;
+		else if (radial_root_ok(ev, lo))
+			t = lo;
+		else
+		{
+			out[i] = -1;
+			continue;
+		}
+		t = t > 0 ? t : 0;
+		t = t < 1 ? t : 1;
+		out[i] = (int)(t * 255);
+	}
+}
+
+#ifdef ARCH_X86_SIMD
+
+#include <immintrin.h>
+
+#include "shade-simd.h"
+#define SIMD_AVX2
+#include "shade-simd.h"
+
+#endif /* ARCH_X86_SIMD */
+
+/* Returns 0 if the shading has to be drawn as a mesh. */
+static int
+init_shade_eval(fz_context *ctx, shade_eval *ev, fz_shade *shade, const fz_matrix *ctm)
+{
+	fz_matrix inv;
+	float x0, y0, r0, x1, y1, r1;
+
+	if (!shade->use_function || (shade->type != FZ_LINEAR && shade->type != FZ_RADIAL))
+		return 0;
+	if (fz_try_invert_matrix(&inv, ctm))
+		return 0;
+
+	x0 = shade->u.l_or_r.coords[0][0];
+	y0 = shade->u.l_or_r.coords[0][1];
+	r0 = shade->u.l_or_r.coords[0][2];
+	x1 = shade->u.l_or_r.coords[1][0];
+	y1 = shade->u.l_or_r.coords[1][1];
+	r1 = shade->u.l_or_r.coords[1][2];
+	ev->extend[0] = shade->u.l_or_r.extend[0];
+	ev->extend[1] = shade->u.l_or_r.extend[1];
+	ev->cdx = x1 - x0;
+	ev->cdy = y1 - y0;
+
+	if (shade->type == FZ_LINEAR)
+	{
+		float len2 = ev->cdx * ev->cdx + ev->cdy * ev->cdy;
+		if (len2 == 0)
+			return 0;
+		ev->tx = (inv.a * ev->cdx + inv.b * ev->cdy) / len2;
+		ev->ty = (inv.c * ev->cdx + inv.d * ev->cdy) / len2;
+		ev->t0 = ((inv.e - x0) * ev->cdx + (inv.f - y0) * ev->cdy) / len2;
+	}
+	else
+	{
+		if (r0 < 0 || r1 < 0)
+			return 0;
+		ev->r0 = r0;
+		ev->dr = r1 - r0;
+		ev->r0dr = r0 * ev->dr;
+		ev->r0r0 = r0 * r0;
+		ev->a = ev->cdx * ev->cdx + ev->cdy * ev->cdy - ev->dr * ev->dr;
+		if (ev->a == 0 && ev->cdx == 0 && ev->cdy == 0)
+			return 0;
+		ev->ia = inv.a;
+		ev->ib = inv.b;
+		ev->ic = inv.c;
+		ev->id = inv.d;
+		ev->ex = inv.e - x0;
+		ev->ey = inv.f - y0;
+	}
+
+	return 1;
+}
+
+static inline void
+put_shade_row(unsigned char *restrict d, const int *restrict idx, int w, int n, const unsigned char (*restrict lut)[FZ_MAX_COLORS])
+{
+	static const unsigned char none[FZ_MAX_COLORS] = { 0 };
+
+	while (w--)
+	{
+		int v = *idx++;
+		memcpy(d, v < 0 ? none : lut[v], n);
+		d += n;
+	}
+}
+
+/* Fill conv (the colorspace of the shading table, with alpha) with
+ * the shading, premultiplied as the mesh path would leave it. */
+static void
+paint_shade_eval(fz_context *ctx, shade_eval *ev, fz_shade *shade, fz_pixmap *conv, unsigned char clut[256][FZ_MAX_COLORS])
+{
+	unsigned char lut[256][FZ_MAX_COLORS];
+	shade_row_fn *row = shade->type == FZ_LINEAR ? eval_axial_row : eval_radial_row;
+	int n = conv->n;
+	int *idx;
+	int v, k, y;
+
+	for (v = 0; v < 256; v++)
+	{
+		int a = clut[v][n - 1];
+		for (k = 0; k < n - 1; k++)
+			lut[v][k] = fz_mul255(clut[v][k], a);
+		lut[v][k] = a;
+	}
+
+#ifdef ARCH_X86_SIMD
+	{
+		int features = fz_cpu_features(ctx);
+		if (shade->type == FZ_LINEAR)
+		{
+			if (features & FZ_CPU_AVX2)
+				row = eval_axial_row_avx2;
+			else if (features & FZ_CPU_SSE2)
+				row = eval_axial_row_sse2;
+		}
+		else if (ev->a != 0)
+		{
+			if (features & FZ_CPU_AVX2)
+				row = eval_radial_row_avx2;
+			else if (features & FZ_CPU_SSE2)
+				row = eval_radial_row_sse2;
+		}
+	}
+#endif /* ARCH_X86_SIMD */
+
+	idx = fz_malloc_array(ctx, conv->w, sizeof(int));
+
+	for (y = 0; y < conv->h; y++)
+	{
+		unsigned char *d = conv->samples + y * (size_t)conv->stride;
+		float fy = (float)(conv->y + y);
+
+		if (shade->type == FZ_LINEAR)
+			ev->rt = ev->ty * fy + ev->t0;
+		else
+		{
+			ev->rx = ev->ic * fy + ev->ex;
+			ev->ry = ev->id * fy + ev->ey;
+		}
+		row(ev, idx, conv->x, 0, conv->w);
+
+		/* Constant sizes let the copies be inlined. */
+		switch (n)
+		{
+		case 2: put_shade_row(d, idx, conv->w, 2, lut); break;
+		case 4: put_shade_row(d, idx, conv->w, 4, lut); break;
+		case 5: put_shade_row(d, idx, conv->w, 5, lut); break;
+		default: put_shade_row(d, idx, conv->w, n, lut); break;
+		}
+	}
+
+	fz_free(ctx, idx);
+}
+
 void
 fz_paint_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, fz_pixmap *dest, const fz_irect *bbox)
 {
@@ -209,7 +461,8 @@ fz_paint_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, fz_pixmap
 	fz_pixmap *conv = NULL;
 	float color[FZ_MAX_COLORS];
 	struct paint_tri_data ptd = { 0 };
-	int i, k, n;
+	shade_eval ev = { { 0 } };
+	int i, k, n, analytic;
 	fz_matrix local_ctm;
 
 	fz_var(temp);
@@ -218,6 +471,7 @@ fz_paint_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, fz_pixmap
 	fz_try(ctx)
 	{
 		fz_concat(&local_ctm, &shade->matrix, ctm);
+		analytic = init_shade_eval(ctx, &ev, shade, &local_ctm);
 
 		if (shade->use_function)
 		{
@@ -235,22 +489,35 @@ fz_paint_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, fz_pixmap
 			/* We need to use alpha = 1 here, because the shade might not fill
 			 * the bbox. */
 			conv = fz_new_pixmap_with_bbox(ctx, dest->colorspace, bbox, 1);
-			temp = fz_new_pixmap_with_bbox(ctx, fz_device_gray(ctx), bbox, 1);
-			fz_clear_pixmap(ctx, temp);
+			if (!analytic)
+			{
+				temp = fz_new_pixmap_with_bbox(ctx, fz_device_gray(ctx), bbox, 1);
+				fz_clear_pixmap(ctx, temp);
+			}
 		}
 		else
 		{
 			temp = dest;
 		}
 
-		ptd.dest = temp;
-		ptd.shade = shade;
-		ptd.bbox = bbox;
+		if (analytic)
+		{
+			paint_shade_eval(ctx, &ev, shade, conv, clut);
+		}
+		else
+		{
+			fz_rect scissor;
 
-		fz_init_cached_color_converter(ctx, &ptd.cc, temp->colorspace, shade->colorspace);
-		fz_process_shade(ctx, shade, &local_ctm, &prepare_mesh_vertex, &do_paint_tri, &ptd);
+			ptd.dest = temp;
+			ptd.shade = shade;
+			ptd.bbox = bbox;
+			fz_rect_from_irect(&scissor, bbox);
 
-		if (shade->use_function)
+			fz_init_cached_color_converter(ctx, &ptd.cc, temp->colorspace, shade->colorspace);
+			fz_process_shade(ctx, shade, &local_ctm, &scissor, &prepare_mesh_vertex, &do_paint_tri, &ptd);
+		}
+
+		if (shade->use_function && !analytic)
 		{
 			unsigned char *s = temp->samples;
 			unsigned char *d = conv->samples;
@@ -274,6 +541,10 @@ fz_paint_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, fz_pixmap
 				d += conv->stride - conv->w * conv->n;
 				s += temp->stride - temp->w * temp->n;
 			}
+		}
+
+		if (shade->use_function)
+		{
 			fz_paint_pixmap(dest, conv, 255);
 			fz_drop_pixmap(ctx, conv);
 			fz_drop_pixmap(ctx, temp);
@@ -73,6 +73,13 @@ and stick to using the premultiplied form.
 
 typedef unsigned char byte;
 
+#ifdef ARCH_X86_SIMD
+/* SSE2 and AVX2 versions of the most common painters are at the end
+ * of this file; these return them when the processor allows. */
+static fz_solid_color_painter_t *fz_get_solid_color_painter_x86(int n, const byte * restrict color, int da);
+static fz_span_color_painter_t *fz_get_span_color_painter_x86(int n, int da);
+#endif /* ARCH_X86_SIMD */
+
 /* These are used by the non-aa scan converter */
 
 static inline void
@@ -228,7 +235,7 @@ template_solid_color_4_da(byte * restrict dp, int n, int w, const byte * restric
 			dp[1] = FZ_BLEND(color[1], dp[1], sa);
 			dp[2] = FZ_BLEND(color[2], dp[2], sa);
 			dp[3] = FZ_BLEND(color[3], dp[3], sa);
-			dp[4] = FZ_BLEND(255, dp[5], sa);
+			dp[4] = FZ_BLEND(255, dp[4], sa);
 			dp += 5;
 		}
 		while (--w);
@@ -465,6 +472,11 @@ static void paint_solid_color_N_da(byte * restrict dp, int n, int w, const byte
 fz_solid_color_painter_t *
 fz_get_solid_color_painter(int n, const byte * restrict color, int da)
 {
+#ifdef ARCH_X86_SIMD
+	fz_solid_color_painter_t *simd = fz_get_solid_color_painter_x86(n, color, da);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	switch (n-da)
 	{
 		case 0:
@@ -818,6 +830,11 @@ paint_span_with_color_N_da(byte * restrict dp, const byte * restrict mp, int n,
 fz_span_color_painter_t *
 fz_get_span_color_painter(int n, int da, const byte * restrict color)
 {
+#ifdef ARCH_X86_SIMD
+	fz_span_color_painter_t *simd = fz_get_span_color_painter_x86(n, da);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	switch(n-da)
 	{
 	case 0: return da ? paint_span_with_color_0_da : NULL;
@@ -1099,9 +1116,19 @@ paint_span_with_mask_N(byte * restrict dp, const byte * restrict sp, const byte
 
 typedef void (fz_span_mask_painter_t)(byte * restrict dp, const byte * restrict sp, const byte * restrict mp, int w, int n, int a);
 
+#ifdef ARCH_X86_SIMD
+static fz_span_mask_painter_t *fz_get_span_mask_painter_x86(int a, int n);
+static fz_span_painter_t *fz_get_span_painter_x86(int da, int sa, int n, int alpha);
+#endif /* ARCH_X86_SIMD */
+
 static fz_span_mask_painter_t *
 fz_get_span_mask_painter(int a, int n)
 {
+#ifdef ARCH_X86_SIMD
+	fz_span_mask_painter_t *simd = fz_get_span_mask_painter_x86(a, n);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	switch(n)
 	{
 		case 0:
@@ -1688,6 +1715,11 @@ paint_span_N_alpha(byte * restrict dp, int da, const byte * restrict sp, int sa,
 fz_span_painter_t *
 fz_get_span_painter(int da, int sa, int n, int alpha)
 {
+#ifdef ARCH_X86_SIMD
+	fz_span_painter_t *simd = fz_get_span_painter_x86(da, sa, n, alpha);
+	if (simd)
+		return simd;
+#endif /* ARCH_X86_SIMD */
 	switch (n)
 	{
 	case 0:
@@ -2294,3 +2326,138 @@ fz_paint_glyph(const unsigned char * restrict colorbv, fz_pixmap * restrict dst,
 		fz_paint_glyph_mask(dst->stride, dp, dst->alpha, glyph, w, h, skip_x, skip_y);
 	}
 }
+
+#ifdef ARCH_X86_SIMD
+
+#include <immintrin.h>
+
+/* pshufb patterns to spread 16 values over 16 pixels of 1 to 5 bytes;
+ * the rows for pixels of p bytes start at p*(p-1)/2. */
+static const byte simd_spread[15][16] =
+{
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+	{ 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7 },
+	{ 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15 },
+	{ 0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5 },
+	{ 5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10 },
+	{ 10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15 },
+	{ 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3 },
+	{ 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7 },
+	{ 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11 },
+	{ 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15 },
+	{ 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3 },
+	{ 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6 },
+	{ 6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 9, 9, 9 },
+	{ 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12 },
+	{ 12, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15 },
+};
+
+#include "paint-simd.h"
+
+#define SIMD_AVX2
+#include "paint-simd.h"
+
+#define SIMD_PICK(NAME) \
+	(avx2 ? NAME##_avx2 : NAME##_sse2)
+
+static fz_solid_color_painter_t *
+fz_get_solid_color_painter_x86(int n, const byte * restrict color, int da)
+{
+	int features = fz_cpu_features_no_ctx();
+	int avx2 = features & FZ_CPU_AVX2;
+
+	if (!(features & FZ_CPU_SSE2))
+		return NULL;
+
+	switch (n-da)
+	{
+#if FZ_PLOTTERS_G
+	case 1: return da ? SIMD_PICK(paint_solid_color_1_da) : SIMD_PICK(paint_solid_color_1);
+#endif /* FZ_PLOTTERS_G */
+#if FZ_PLOTTERS_RGB
+	case 3: return da ? SIMD_PICK(paint_solid_color_3_da) : SIMD_PICK(paint_solid_color_3);
+#endif /* FZ_PLOTTERS_RGB */
+#if FZ_PLOTTERS_CMYK
+	case 4: return da ? SIMD_PICK(paint_solid_color_4_da) : SIMD_PICK(paint_solid_color_4);
+#endif /* FZ_PLOTTERS_CMYK */
+	}
+	return NULL;
+}
+
+static fz_span_color_painter_t *
+fz_get_span_color_painter_x86(int n, int da)
+{
+	int features = fz_cpu_features_no_ctx();
+	int avx2 = features & FZ_CPU_AVX2;
+
+	if (!(features & FZ_CPU_SSE2))
+		return NULL;
+
+	switch (n-da)
+	{
+	case 1: return da ? SIMD_PICK(paint_span_with_color_1_da) : SIMD_PICK(paint_span_with_color_1);
+#if FZ_PLOTTERS_RGB
+	case 3:
+		if (da)
+			return SIMD_PICK(paint_span_with_color_3_da);
+		return avx2 ? paint_span_with_color_3_avx2 : NULL;
+#endif /* FZ_PLOTTERS_RGB */
+#if FZ_PLOTTERS_CMYK
+	case 4:
+		if (!da)
+			return SIMD_PICK(paint_span_with_color_4);
+		return avx2 ? paint_span_with_color_4_da_avx2 : NULL;
+#endif /* FZ_PLOTTERS_CMYK */
+	}
+	return NULL;
+}
+
+static fz_span_mask_painter_t *
+fz_get_span_mask_painter_x86(int a, int n)
+{
+	int features = fz_cpu_features_no_ctx();
+	int avx2 = features & FZ_CPU_AVX2;
+
+	if (!(features & FZ_CPU_SSE2))
+		return NULL;
+
+	switch (n)
+	{
+	case 0: return a ? SIMD_PICK(paint_span_with_mask_0_a) : NULL;
+	case 1: return a ? SIMD_PICK(paint_span_with_mask_1_a) : SIMD_PICK(paint_span_with_mask_1);
+#if FZ_PLOTTERS_RGB
+	case 3:
+		if (a)
+			return SIMD_PICK(paint_span_with_mask_3_a);
+		return avx2 ? paint_span_with_mask_3_avx2 : NULL;
+#endif /* FZ_PLOTTERS_RGB */
+#if FZ_PLOTTERS_CMYK
+	case 4: return a ? NULL : SIMD_PICK(paint_span_with_mask_4);
+#endif /* FZ_PLOTTERS_CMYK */
+	}
+	return NULL;
+}
+
+static fz_span_painter_t *
+fz_get_span_painter_x86(int da, int sa, int n, int alpha)
+{
+	int features = fz_cpu_features_no_ctx();
+	int avx2 = features & FZ_CPU_AVX2;
+
+	if (!(features & FZ_CPU_SSE2) || !da || !sa || alpha == 0)
+		return NULL;
+
+	switch (n)
+	{
+	case 0: return alpha == 255 ? SIMD_PICK(paint_span_0_da_sa) : SIMD_PICK(paint_span_0_da_sa_alpha);
+	case 1: return alpha == 255 ? SIMD_PICK(paint_span_1_da_sa) : SIMD_PICK(paint_span_1_da_sa_alpha);
+#if FZ_PLOTTERS_RGB
+	case 3: return alpha == 255 ? SIMD_PICK(paint_span_3_da_sa) : SIMD_PICK(paint_span_3_da_sa_alpha);
+#endif /* FZ_PLOTTERS_RGB */
+	}
+	return NULL;
+}
+
+#undef SIMD_PICK
+
+#endif /* ARCH_X86_SIMD */
@@ -1254,6 +1254,32 @@ scale_row_from_temp_alpha(unsigned char * restrict dst, const unsigned char * re
 }
 #endif
 
+#ifdef ARCH_X86_SIMD
+
+#include <immintrin.h>
+
+typedef void (scale_row_in_fn)(unsigned char * restrict dst, const unsigned char * restrict src, const fz_weights * restrict weights);
+typedef void (scale_row_out_fn)(unsigned char * restrict dst, const unsigned char * restrict src, const fz_weights * restrict weights, int w, int n, int row);
+
+#include "scale-simd.h"
+#define SIMD_AVX2
+#include "scale-simd.h"
+
+/* Swap in the vector versions of the row scalers if the processor has
+ * them. Leaves the C ones in place for any cases they don't cover. */
+static void
+select_row_scalers_x86(fz_context *ctx, int n, int forcealpha, scale_row_in_fn **in, scale_row_out_fn **out)
+{
+	int features = fz_cpu_features(ctx);
+
+	if (features & FZ_CPU_AVX2)
+		select_row_scalers_avx2(n, forcealpha, in, out);
+	else if (features & FZ_CPU_SSE4_1)
+		select_row_scalers_sse4_1(n, forcealpha, in, out);
+}
+
+#endif /* ARCH_X86_SIMD */
+
 #ifdef SINGLE_PIXEL_SPECIALS
 static void
 duplicate_single_pixel(unsigned char * restrict dst, const unsigned char * restrict src, int n, int forcealpha, int w, int h, int stride)
@@ -1785,6 +1811,9 @@ fz_scale_pixmap_cached(fz_context *ctx, const fz_pixmap *src, float x, float y,
 			break;
 		}
 		row_scale_out = forcealpha ? scale_row_from_temp_alpha : scale_row_from_temp;
+#ifdef ARCH_X86_SIMD
+		select_row_scalers_x86(ctx, src->n, forcealpha, &row_scale_in, &row_scale_out);
+#endif /* ARCH_X86_SIMD */
 		max_row = contrib_rows->index[contrib_rows->index[0]];
 		for (row = 0; row < contrib_rows->count; row++)
 		{
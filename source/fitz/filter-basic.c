@@ -1,4 +1,4 @@
-#include "mupdf/fitz.h"
+#include "fitz-imp.h"
 
 /* Pretend we have a filter that just copies data forever */
 
@@ -30,10 +30,18 @@ next_null(fz_context *ctx, fz_stream *stm, size_t max)
 	n = fz_available(ctx, state->chain, max);
 	if (n > state->remain)
 		n = state->remain;
-	if (n > sizeof(state->buffer))
-		n = sizeof(state->buffer);
-	memcpy(state->buffer, state->chain->rp, n);
-	stm->rp = state->buffer;
+	if (fz_is_memory_stream(ctx, state->chain))
+	{
+		/* The data stays put, so hand it on where it lies. */
+		stm->rp = state->chain->rp;
+	}
+	else
+	{
+		if (n > sizeof(state->buffer))
+			n = sizeof(state->buffer);
+		memcpy(state->buffer, state->chain->rp, n);
+		stm->rp = state->buffer;
+	}
 	stm->wp = stm->rp + n;
 	if (n == 0)
 		return EOF;
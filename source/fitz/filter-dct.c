@@ -148,6 +148,90 @@ static void skip_input_data_dct(j_decompress_ptr cinfo, long num_bytes)
 	}
 }
 
+/* Called under the setjmp of the caller, as libjpeg may longjmp out. */
+static void
+start_dctd(fz_context *ctx, fz_dctd *state)
+{
+	j_decompress_ptr cinfo = &state->cinfo;
+	int c;
+
+	cinfo->client_data = state;
+	cinfo->err = &state->errmgr;
+	jpeg_std_error(cinfo->err);
+	cinfo->err->error_exit = error_exit_dct;
+
+	fz_dct_mem_init(state);
+
+	jpeg_create_decompress(cinfo);
+	state->init = 1;
+
+	/* Skip over any stray returns at the start of the stream */
+	while ((c = fz_peek_byte(ctx, state->chain)) == '\n' || c == '\r')
+		(void)fz_read_byte(ctx, state->chain);
+
+	cinfo->src = &state->srcmgr;
+	cinfo->src->init_source = init_source_dct;
+	cinfo->src->fill_input_buffer = fill_input_buffer_dct;
+	cinfo->src->skip_input_data = skip_input_data_dct;
+	cinfo->src->resync_to_restart = jpeg_resync_to_restart;
+	cinfo->src->term_source = term_source_dct;
+
+	/* optionally load additional JPEG tables first */
+	if (state->jpegtables)
+	{
+		state->curr_stm = state->jpegtables;
+		cinfo->src->next_input_byte = state->curr_stm->rp;
+		cinfo->src->bytes_in_buffer = state->curr_stm->wp - state->curr_stm->rp;
+		jpeg_read_header(cinfo, 0);
+		state->curr_stm->rp = state->curr_stm->wp - state->cinfo.src->bytes_in_buffer;
+		state->curr_stm = state->chain;
+	}
+
+	cinfo->src->next_input_byte = state->curr_stm->rp;
+	cinfo->src->bytes_in_buffer = state->curr_stm->wp - state->curr_stm->rp;
+
+	jpeg_read_header(cinfo, 1);
+
+	/* default value if ColorTransform is not set */
+	if (state->color_transform == -1)
+	{
+		if (state->cinfo.num_components == 3)
+			state->color_transform = 1;
+		else
+			state->color_transform = 0;
+	}
+
+	if (cinfo->saw_Adobe_marker)
+		state->color_transform = cinfo->Adobe_transform;
+
+	/* Guess the input colorspace, and set output colorspace accordingly */
+	switch (cinfo->num_components)
+	{
+	case 3:
+		if (state->color_transform)
+			cinfo->jpeg_color_space = JCS_YCbCr;
+		else
+			cinfo->jpeg_color_space = JCS_RGB;
+		break;
+	case 4:
+		if (state->color_transform)
+			cinfo->jpeg_color_space = JCS_YCCK;
+		else
+			cinfo->jpeg_color_space = JCS_CMYK;
+		break;
+	}
+
+	cinfo->scale_num = 8/(1<<state->l2factor);
+	cinfo->scale_denom = 8;
+
+	jpeg_start_decompress(cinfo);
+
+	state->stride = cinfo->output_width * cinfo->output_components;
+	state->scanline = fz_malloc(ctx, state->stride);
+	state->rp = state->scanline;
+	state->wp = state->scanline;
+}
+
 static int
 next_dctd(fz_context *ctx, fz_stream *stm, size_t max)
 {
@@ -168,84 +252,7 @@ next_dctd(fz_context *ctx, fz_stream *stm, size_t max)
 	}
 
 	if (!state->init)
-	{
-		int c;
-		cinfo->client_data = state;
-		cinfo->err = &state->errmgr;
-		jpeg_std_error(cinfo->err);
-		cinfo->err->error_exit = error_exit_dct;
-
-		fz_dct_mem_init(state);
-
-		jpeg_create_decompress(cinfo);
-		state->init = 1;
-
-		/* Skip over any stray returns at the start of the stream */
-		while ((c = fz_peek_byte(ctx, state->chain)) == '\n' || c == '\r')
-			(void)fz_read_byte(ctx, state->chain);
-
-		cinfo->src = &state->srcmgr;
-		cinfo->src->init_source = init_source_dct;
-		cinfo->src->fill_input_buffer = fill_input_buffer_dct;
-		cinfo->src->skip_input_data = skip_input_data_dct;
-		cinfo->src->resync_to_restart = jpeg_resync_to_restart;
-		cinfo->src->term_source = term_source_dct;
-
-		/* optionally load additional JPEG tables first */
-		if (state->jpegtables)
-		{
-			state->curr_stm = state->jpegtables;
-			cinfo->src->next_input_byte = state->curr_stm->rp;
-			cinfo->src->bytes_in_buffer = state->curr_stm->wp - state->curr_stm->rp;
-			jpeg_read_header(cinfo, 0);
-			state->curr_stm->rp = state->curr_stm->wp - state->cinfo.src->bytes_in_buffer;
-			state->curr_stm = state->chain;
-		}
-
-		cinfo->src->next_input_byte = state->curr_stm->rp;
-		cinfo->src->bytes_in_buffer = state->curr_stm->wp - state->curr_stm->rp;
-
-		jpeg_read_header(cinfo, 1);
-
-		/* default value if ColorTransform is not set */
-		if (state->color_transform == -1)
-		{
-			if (state->cinfo.num_components == 3)
-				state->color_transform = 1;
-			else
-				state->color_transform = 0;
-		}
-
-		if (cinfo->saw_Adobe_marker)
-			state->color_transform = cinfo->Adobe_transform;
-
-		/* Guess the input colorspace, and set output colorspace accordingly */
-		switch (cinfo->num_components)
-		{
-		case 3:
-			if (state->color_transform)
-				cinfo->jpeg_color_space = JCS_YCbCr;
-			else
-				cinfo->jpeg_color_space = JCS_RGB;
-			break;
-		case 4:
-			if (state->color_transform)
-				cinfo->jpeg_color_space = JCS_YCCK;
-			else
-				cinfo->jpeg_color_space = JCS_CMYK;
-			break;
-		}
-
-		cinfo->scale_num = 8/(1<<state->l2factor);
-		cinfo->scale_denom = 8;
-
-		jpeg_start_decompress(cinfo);
-
-		state->stride = cinfo->output_width * cinfo->output_components;
-		state->scanline = fz_malloc(ctx, state->stride);
-		state->rp = state->scanline;
-		state->wp = state->scanline;
-	}
+		start_dctd(ctx, state);
 
 	while (state->rp < state->wp && p < ep)
 		*p++ = *state->rp++;
@@ -279,6 +286,93 @@ next_dctd(fz_context *ctx, fz_stream *stm, size_t max)
 	return *stm->rp++;
 }
 
+#if defined(SHARE_JPEG) && defined(LIBJPEG_TURBO_VERSION_NUMBER) && LIBJPEG_TURBO_VERSION_NUMBER >= 2000000
+#define HAVE_JPEG_SKIP_SCANLINES
+#endif
+
+/* Skip whole scanlines without producing them, as far as the library
+ * allows. libjpeg-turbo can skip the work for the rows altogether.
+ * Otherwise they are decoded into the scanline buffer and dropped. */
+static void
+skip_scanlines_dctd(fz_dctd *state, JDIMENSION n)
+{
+	j_decompress_ptr cinfo = &state->cinfo;
+
+#ifdef HAVE_JPEG_SKIP_SCANLINES
+	jpeg_skip_scanlines(cinfo, n);
+#else
+	while (n-- > 0)
+		jpeg_read_scanlines(cinfo, &state->scanline, 1);
+#endif
+}
+
+/* Only seeking forwards is possible; rows that are seeked past are
+ * skipped rather than decoded out. */
+static void
+seek_dctd(fz_context *ctx, fz_stream *stm, fz_off_t offset, int whence)
+{
+	fz_dctd *state = stm->state;
+	j_decompress_ptr cinfo = &state->cinfo;
+	size_t skip, n;
+
+	if (whence != SEEK_SET)
+	{
+		fz_warn(ctx, "cannot seek from end of jpeg");
+		return;
+	}
+	if (offset < fz_tell(ctx, stm))
+	{
+		fz_warn(ctx, "cannot seek backwards in jpeg");
+		return;
+	}
+
+	/* Still within what we have already decoded? */
+	if (offset <= stm->pos)
+	{
+		stm->rp = stm->wp - (stm->pos - offset);
+		return;
+	}
+	skip = offset - stm->pos;
+	stm->rp = stm->wp;
+
+	if (setjmp(state->jb))
+	{
+		if (cinfo->src)
+			state->curr_stm->rp = state->curr_stm->wp - cinfo->src->bytes_in_buffer;
+		fz_throw(ctx, FZ_ERROR_GENERIC, "jpeg error: %s", state->msg);
+	}
+
+	if (!state->init)
+		start_dctd(ctx, state);
+
+	/* The rest of a part read scanline */
+	n = state->wp - state->rp;
+	if (n > skip)
+		n = skip;
+	state->rp += n;
+	skip -= n;
+
+	n = skip / state->stride;
+	if (n > cinfo->output_height - cinfo->output_scanline)
+		n = cinfo->output_height - cinfo->output_scanline;
+	if (n > 0)
+	{
+		skip_scanlines_dctd(state, (JDIMENSION)n);
+		skip -= n * state->stride;
+	}
+
+	/* The scanline we end up part way into */
+	if (skip > 0 && cinfo->output_scanline < cinfo->output_height)
+	{
+		jpeg_read_scanlines(cinfo, &state->scanline, 1);
+		state->rp = state->scanline + skip;
+		state->wp = state->scanline + state->stride;
+		skip = 0;
+	}
+
+	stm->pos = offset - skip;
+}
+
 static void
 close_dctd(fz_context *ctx, void *state_)
 {
@@ -316,6 +410,7 @@ fz_stream *
 fz_open_dctd(fz_context *ctx, fz_stream *chain, int color_transform, int l2factor, fz_stream *jpegtables)
 {
 	fz_dctd *state = NULL;
+	fz_stream *stm;
 
 	fz_var(state);
 
@@ -339,5 +434,7 @@ fz_open_dctd(fz_context *ctx, fz_stream *chain, int color_transform, int l2facto
 		fz_rethrow(ctx);
 	}
 
-	return fz_new_stream(ctx, state, next_dctd, close_dctd);
+	stm = fz_new_stream(ctx, state, next_dctd, close_dctd);
+	stm->seek = seek_dctd;
+	return stm;
 }
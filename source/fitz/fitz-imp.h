@@ -10,8 +10,29 @@ struct fz_buffer_s
 	size_t cap, len;
 	int unused_bits;
 	int shared;
+	fz_buffer *parent;
+	void (*unmap)(unsigned char *data, size_t len);
 };
 
+/*
+	fz_new_buffer_slice: Create a buffer that shares len bytes of the
+	storage of buf, starting at offset, and keeps buf alive for as
+	long as it is. The storage of buf must be shared, so that it
+	cannot move. Resizing the slice gives it a copy of its own.
+
+	For internal use only.
+*/
+fz_buffer *fz_new_buffer_slice(fz_context *ctx, fz_buffer *buf, size_t offset, size_t len);
+
+/*
+	fz_is_memory_stream: Whether the data of a stream is all held in
+	memory, from stm->rp up to stm->wp, where it stays put for as long
+	as the stream is open.
+
+	For internal use only.
+*/
+int fz_is_memory_stream(fz_context *ctx, fz_stream *stm);
+
 void fz_new_colorspace_context(fz_context *ctx);
 fz_colorspace_context *fz_keep_colorspace_context(fz_context *ctx);
 void fz_drop_colorspace_context(fz_context *ctx);
@@ -58,6 +79,22 @@ fz_font_context *fz_keep_font_context(fz_context *ctx);
 */
 void fz_drop_font_context(fz_context *ctx);
 
+/*
+	fz_new_face_cache_context: Give a cloned context FreeType faces
+	of its own, so that it can load glyphs without taking the
+	freetype lock.
+
+	For internal use only.
+*/
+void fz_new_face_cache_context(fz_context *ctx);
+
+/*
+	fz_drop_face_cache_context: Release the faces of a context.
+
+	For internal use only.
+*/
+void fz_drop_face_cache_context(fz_context *ctx);
+
 /* Tuning context implementation details */
 struct fz_tuning_context_s
 {
@@ -66,6 +103,8 @@ struct fz_tuning_context_s
 	void *image_decode_arg;
 	fz_tune_image_scale_fn *image_scale;
 	void *image_scale_arg;
+	int image_threads;
+	int map_files;
 };
 
 fz_tune_image_decode_fn fz_default_image_decode;
@@ -78,7 +117,7 @@ void fz_drop_aa_context(fz_context *ctx);
 void fz_copy_aa_context(fz_context *dst, fz_context *src);
 
 void fz_new_glyph_cache_context(fz_context *ctx);
-fz_glyph_cache *fz_keep_glyph_cache(fz_context *ctx);
+void fz_clone_glyph_cache_context(fz_context *dst, fz_context *src);
 void fz_drop_glyph_cache_context(fz_context *ctx);
 
 void fz_new_document_handler_context(fz_context *ctx);
@@ -89,5 +128,23 @@ void fz_new_output_context(fz_context *ctx);
 void fz_drop_output_context(fz_context *ctx);
 fz_output_context *fz_keep_output_context(fz_context *ctx);
 
+/*
+	fz_packed_path_data: Find the coordinates and commands of a
+	packed path that fits in size bytes. Returns 1 if they are held
+	outside the path (FZ_PATH_PACKED_OPEN), 0 if they follow it
+	(FZ_PATH_PACKED_FLAT), and -1 if the path is not packed or does
+	not fit.
+
+	fz_path_data_is_valid: Check that a run of path commands is
+	well formed, and needs no more than coord_len coordinates.
+
+	fz_set_packed_path_data: Make a packed path that lives in
+	memory we do not own (such as a display list file) safe to keep
+	and drop, and point an open one at the given data.
+*/
+int fz_packed_path_data(const fz_path *path, size_t size, const float **coords, int *coord_len, const unsigned char **cmds, int *cmd_len);
+int fz_path_data_is_valid(const unsigned char *cmds, int cmd_len, int coord_len);
+void fz_set_packed_path_data(fz_path *path, float *coords, unsigned char *cmds);
+
 
 #endif
@@ -14,6 +14,7 @@
 
 #define MAX_BBOX_TABLE_SIZE 4096
 #define MAX_ADVANCE_CACHE 4096
+#define MAX_FACE_CACHE 32
 
 #ifndef FT_SFNT_OS2
 #define FT_SFNT_OS2 ft_sfnt_os2
@@ -444,6 +445,132 @@ fz_drop_freetype(fz_context *ctx)
 	fz_unlock(ctx, FZ_LOCK_FREETYPE);
 }
 
+/*
+	FreeType faces may only be used by one thread at a time, so all
+	use of the face in a font is guarded by the freetype lock. To let
+	the threads drawing a page load glyphs in parallel, each cloned
+	context opens faces of its own from the font data the first time
+	it needs them. Faces from one library can be used in different
+	threads at once; only making and freeing them needs the lock.
+
+	The faces of a context are kept most recently used first, and keep
+	their fonts alive until they are pushed out or the context is
+	dropped.
+*/
+
+struct fz_face_cache_s
+{
+	int len;
+	struct {
+		fz_font *font;
+		FT_Face face;
+	} entry[MAX_FACE_CACHE];
+};
+
+void fz_new_face_cache_context(fz_context *ctx)
+{
+	ctx->face_cache = fz_malloc_struct(ctx, fz_face_cache);
+}
+
+static void
+drop_local_face(fz_context *ctx, fz_font *font, FT_Face face)
+{
+	int fterr;
+
+	fz_lock(ctx, FZ_LOCK_FREETYPE);
+	fterr = FT_Done_Face(face);
+	fz_unlock(ctx, FZ_LOCK_FREETYPE);
+	if (fterr)
+		fz_warn(ctx, "freetype finalizing face: %s", ft_error_string(fterr));
+	fz_drop_font(ctx, font);
+}
+
+void fz_drop_face_cache_context(fz_context *ctx)
+{
+	fz_face_cache *cache;
+	int i;
+
+	if (!ctx || !ctx->face_cache)
+		return;
+
+	cache = ctx->face_cache;
+	for (i = 0; i < cache->len; i++)
+		drop_local_face(ctx, cache->entry[i].font, cache->entry[i].face);
+	fz_free(ctx, cache);
+	ctx->face_cache = NULL;
+}
+
+static FT_Face
+new_local_face(fz_context *ctx, fz_font *font)
+{
+	fz_face_cache *cache = ctx->face_cache;
+	FT_Face face;
+	int fterr;
+
+	fz_lock(ctx, FZ_LOCK_FREETYPE);
+	fterr = FT_New_Memory_Face(ctx->font->ftlib, font->buffer->data, (FT_Long)font->buffer->len,
+		((FT_Face)font->ft_face)->face_index, &face);
+	fz_unlock(ctx, FZ_LOCK_FREETYPE);
+	if (fterr)
+		return NULL;
+
+	if (cache->len == MAX_FACE_CACHE)
+	{
+		cache->len--;
+		drop_local_face(ctx, cache->entry[cache->len].font, cache->entry[cache->len].face);
+	}
+	memmove(&cache->entry[1], &cache->entry[0], cache->len * sizeof cache->entry[0]);
+	cache->entry[0].font = fz_keep_font(ctx, font);
+	cache->entry[0].face = face;
+	cache->len++;
+
+	return face;
+}
+
+/*
+	Find the face for this context to load glyphs of font with. If it
+	is the face of the font itself, the freetype lock is taken, and is
+	held until fz_unlock_ft_face.
+*/
+static FT_Face
+fz_lock_ft_face(fz_context *ctx, fz_font *font)
+{
+	fz_face_cache *cache = ctx->face_cache;
+	FT_Face face;
+	int i;
+
+	if (cache && font->buffer)
+	{
+		for (i = 0; i < cache->len; i++)
+		{
+			if (cache->entry[i].font == font)
+			{
+				face = cache->entry[i].face;
+				if (i > 0)
+				{
+					memmove(&cache->entry[1], &cache->entry[0], i * sizeof cache->entry[0]);
+					cache->entry[0].font = font;
+					cache->entry[0].face = face;
+				}
+				return face;
+			}
+		}
+		face = new_local_face(ctx, font);
+		if (face)
+			return face;
+	}
+
+	fz_lock(ctx, FZ_LOCK_FREETYPE);
+	return font->ft_face;
+}
+
+static void
+fz_unlock_ft_face(fz_context *ctx, fz_font *font, FT_Face face)
+{
+	if (face == font->ft_face)
+		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+}
+
 fz_font *
 fz_new_font_from_buffer(fz_context *ctx, const char *name, fz_buffer *buffer, int index, int use_glyph_bbox)
 {
@@ -528,8 +655,9 @@ fz_new_font_from_file(fz_context *ctx, const char *name, const char *path, int i
 	return font;
 }
 
+/* The face is always locked (if it needs to be) when this is called. */
 static fz_matrix *
-fz_adjust_ft_glyph_width(fz_context *ctx, fz_font *font, int gid, fz_matrix *trm)
+fz_adjust_ft_glyph_width(fz_context *ctx, fz_font *font, FT_Face face, int gid, fz_matrix *trm)
 {
 	/* Fudge the font matrix to stretch the glyph if we've substituted the font. */
 	if (font->flags.ft_stretch && font->width_table /* && font->wmode == 0 */)
@@ -538,11 +666,9 @@ fz_adjust_ft_glyph_width(fz_context *ctx, fz_font *font, int gid, fz_matrix *trm
 		float subw;
 		float realw;
 
-		fz_lock(ctx, FZ_LOCK_FREETYPE);
-		FT_Get_Advance(font->ft_face, gid, FT_LOAD_NO_SCALE | FT_LOAD_NO_HINTING | FT_LOAD_IGNORE_TRANSFORM, &adv);
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		FT_Get_Advance(face, gid, FT_LOAD_NO_SCALE | FT_LOAD_NO_HINTING | FT_LOAD_IGNORE_TRANSFORM, &adv);
 
-		realw = (float)adv * 1000 / ((FT_Face)font->ft_face)->units_per_EM;
+		realw = (float)adv * 1000 / face->units_per_EM;
 		if (gid < font->width_count)
 			subw = font->width_table[gid];
 		else
@@ -574,11 +700,10 @@ pixmap_from_ft_bitmap(fz_context *ctx, int left, int top, FT_Bitmap *bitmap)
 		return fz_new_pixmap_from_8bpp_data(ctx, left, top - bitmap->rows, bitmap->width, bitmap->rows, bitmap->buffer + (bitmap->rows-1)*bitmap->pitch, -bitmap->pitch);
 }
 
-/* Takes the freetype lock, and returns with it held */
+/* The face is always locked (if it needs to be) when this is called. */
 static FT_GlyphSlot
-do_ft_render_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm, int aa)
+do_ft_render_glyph(fz_context *ctx, fz_font *font, FT_Face face, int gid, const fz_matrix *trm, int aa)
 {
-	FT_Face face = font->ft_face;
 	FT_Matrix m;
 	FT_Vector v;
 	FT_Error fterr;
@@ -586,7 +711,7 @@ do_ft_render_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm
 
 	float strength = fz_matrix_expansion(trm) * 0.02f;
 
-	fz_adjust_ft_glyph_width(ctx, font, gid, &local_trm);
+	fz_adjust_ft_glyph_width(ctx, font, face, gid, &local_trm);
 
 	if (font->flags.fake_italic)
 		fz_pre_shear(&local_trm, SHEAR, 0);
@@ -606,7 +731,6 @@ do_ft_render_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm
 	v.x = local_trm.e * 64;
 	v.y = local_trm.f * 64;
 
-	fz_lock(ctx, FZ_LOCK_FREETYPE);
 	fterr = FT_Set_Char_Size(face, 65536, 65536, 72, 72); /* should be 64, 64 */
 	if (fterr)
 		fz_warn(ctx, "freetype setting character size: %s", ft_error_string(fterr));
@@ -677,12 +801,13 @@ retry_unhinted:
 fz_pixmap *
 fz_render_ft_glyph_pixmap(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm, int aa)
 {
-	FT_GlyphSlot slot = do_ft_render_glyph(ctx, font, gid, trm, aa);
+	FT_Face face = fz_lock_ft_face(ctx, font);
+	FT_GlyphSlot slot = do_ft_render_glyph(ctx, font, face, gid, trm, aa);
 	fz_pixmap *pixmap;
 
 	if (slot == NULL)
 	{
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 		return NULL;
 	}
 
@@ -692,7 +817,7 @@ fz_render_ft_glyph_pixmap(fz_context *ctx, fz_font *font, int gid, const fz_matr
 	}
 	fz_always(ctx)
 	{
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 	}
 	fz_catch(ctx)
 	{
@@ -702,16 +827,16 @@ fz_render_ft_glyph_pixmap(fz_context *ctx, fz_font *font, int gid, const fz_matr
 	return pixmap;
 }
 
-/* The glyph cache lock is always taken when this is called. */
 fz_glyph *
 fz_render_ft_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm, int aa)
 {
-	FT_GlyphSlot slot = do_ft_render_glyph(ctx, font, gid, trm, aa);
+	FT_Face face = fz_lock_ft_face(ctx, font);
+	FT_GlyphSlot slot = do_ft_render_glyph(ctx, font, face, gid, trm, aa);
 	fz_glyph *glyph;
 
 	if (slot == NULL)
 	{
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 		return NULL;
 	}
 
@@ -721,7 +846,7 @@ fz_render_ft_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm
 	}
 	fz_always(ctx)
 	{
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 	}
 	fz_catch(ctx)
 	{
@@ -731,11 +856,10 @@ fz_render_ft_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm
 	return glyph;
 }
 
-/* Takes the freetype lock, and returns with it held */
+/* The face is always locked (if it needs to be) when this is called. */
 static FT_Glyph
-do_render_ft_stroked_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm, const fz_matrix *ctm, const fz_stroke_state *state)
+do_render_ft_stroked_glyph(fz_context *ctx, fz_font *font, FT_Face face, int gid, const fz_matrix *trm, const fz_matrix *ctm, const fz_stroke_state *state)
 {
-	FT_Face face = font->ft_face;
 	float expansion = fz_matrix_expansion(ctm);
 	int linewidth = state->linewidth * expansion * 64 / 2;
 	FT_Matrix m;
@@ -747,7 +871,7 @@ do_render_ft_stroked_glyph(fz_context *ctx, fz_font *font, int gid, const fz_mat
 	FT_Stroker_LineCap line_cap;
 	fz_matrix local_trm = *trm;
 
-	fz_adjust_ft_glyph_width(ctx, font, gid, &local_trm);
+	fz_adjust_ft_glyph_width(ctx, font, face, gid, &local_trm);
 
 	if (font->flags.fake_italic)
 		fz_pre_shear(&local_trm, SHEAR, 0);
@@ -759,7 +883,6 @@ do_render_ft_stroked_glyph(fz_context *ctx, fz_font *font, int gid, const fz_mat
 	v.x = local_trm.e * 64;
 	v.y = local_trm.f * 64;
 
-	fz_lock(ctx, FZ_LOCK_FREETYPE);
 	fterr = FT_Set_Char_Size(face, 65536, 65536, 72, 72); /* should be 64, 64 */
 	if (fterr)
 	{
@@ -829,13 +952,14 @@ do_render_ft_stroked_glyph(fz_context *ctx, fz_font *font, int gid, const fz_mat
 fz_pixmap *
 fz_render_ft_stroked_glyph_pixmap(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm, const fz_matrix *ctm, const fz_stroke_state *state)
 {
-	FT_Glyph glyph = do_render_ft_stroked_glyph(ctx, font, gid, trm, ctm, state);
+	FT_Face face = fz_lock_ft_face(ctx, font);
+	FT_Glyph glyph = do_render_ft_stroked_glyph(ctx, font, face, gid, trm, ctm, state);
 	FT_BitmapGlyph bitmap = (FT_BitmapGlyph)glyph;
 	fz_pixmap *pixmap;
 
 	if (bitmap == NULL)
 	{
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 		return NULL;
 	}
 
@@ -846,7 +970,7 @@ fz_render_ft_stroked_glyph_pixmap(fz_context *ctx, fz_font *font, int gid, const
 	fz_always(ctx)
 	{
 		FT_Done_Glyph(glyph);
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 	}
 	fz_catch(ctx)
 	{
@@ -859,13 +983,14 @@ fz_render_ft_stroked_glyph_pixmap(fz_context *ctx, fz_font *font, int gid, const
 fz_glyph *
 fz_render_ft_stroked_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm, const fz_matrix *ctm, const fz_stroke_state *state)
 {
-	FT_Glyph glyph = do_render_ft_stroked_glyph(ctx, font, gid, trm, ctm, state);
+	FT_Face face = fz_lock_ft_face(ctx, font);
+	FT_Glyph glyph = do_render_ft_stroked_glyph(ctx, font, face, gid, trm, ctm, state);
 	FT_BitmapGlyph bitmap = (FT_BitmapGlyph)glyph;
 	fz_glyph *result;
 
 	if (bitmap == NULL)
 	{
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 		return NULL;
 	}
 
@@ -876,7 +1001,7 @@ fz_render_ft_stroked_glyph(fz_context *ctx, fz_font *font, int gid, const fz_mat
 	fz_always(ctx)
 	{
 		FT_Done_Glyph(glyph);
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 	}
 	fz_catch(ctx)
 	{
@@ -889,7 +1014,7 @@ fz_render_ft_stroked_glyph(fz_context *ctx, fz_font *font, int gid, const fz_mat
 static fz_rect *
 fz_bound_ft_glyph(fz_context *ctx, fz_font *font, int gid)
 {
-	FT_Face face = font->ft_face;
+	FT_Face face = fz_lock_ft_face(ctx, font);
 	FT_Error fterr;
 	FT_BBox cbox;
 	FT_Matrix m;
@@ -905,7 +1030,7 @@ fz_bound_ft_glyph(fz_context *ctx, fz_font *font, int gid)
 	const float strength = 0.02f;
 	fz_matrix local_trm = fz_identity;
 
-	fz_adjust_ft_glyph_width(ctx, font, gid, &local_trm);
+	fz_adjust_ft_glyph_width(ctx, font, face, gid, &local_trm);
 
 	if (font->flags.fake_italic)
 		fz_pre_shear(&local_trm, SHEAR, 0);
@@ -926,7 +1051,6 @@ fz_bound_ft_glyph(fz_context *ctx, fz_font *font, int gid)
 		ft_flags = FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING;
 	}
 
-	fz_lock(ctx, FZ_LOCK_FREETYPE);
 	/* Set the char size to scale=face->units_per_EM to effectively give
 	 * us unscaled results. This avoids quantisation. We then apply the
 	 * scale ourselves below. */
@@ -939,7 +1063,7 @@ fz_bound_ft_glyph(fz_context *ctx, fz_font *font, int gid)
 	if (fterr)
 	{
 		fz_warn(ctx, "freetype load glyph (gid %d): %s", gid, ft_error_string(fterr));
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 		bounds->x0 = bounds->x1 = local_trm.e;
 		bounds->y0 = bounds->y1 = local_trm.f;
 		return bounds;
@@ -952,7 +1076,7 @@ fz_bound_ft_glyph(fz_context *ctx, fz_font *font, int gid)
 	}
 
 	FT_Outline_Get_CBox(&face->glyph->outline, &cbox);
-	fz_unlock(ctx, FZ_LOCK_FREETYPE);
+	fz_unlock_ft_face(ctx, font, face);
 	bounds->x0 = cbox.xMin * recip;
 	bounds->y0 = cbox.yMin * recip;
 	bounds->x1 = cbox.xMax * recip;
@@ -1036,7 +1160,7 @@ fz_path *
 fz_outline_ft_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *trm)
 {
 	struct closure cc;
-	FT_Face face = font->ft_face;
+	FT_Face face = fz_lock_ft_face(ctx, font);
 	int fterr;
 	fz_matrix local_trm = *trm;
 	int ft_flags;
@@ -1045,13 +1169,11 @@ fz_outline_ft_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *tr
 	const float recip = 1 / (float)scale;
 	const float strength = 0.02f;
 
-	fz_adjust_ft_glyph_width(ctx, font, gid, &local_trm);
+	fz_adjust_ft_glyph_width(ctx, font, face, gid, &local_trm);
 
 	if (font->flags.fake_italic)
 		fz_pre_shear(&local_trm, SHEAR, 0);
 
-	fz_lock(ctx, FZ_LOCK_FREETYPE);
-
 	if (font->flags.force_hinting)
 	{
 		ft_flags = FT_LOAD_NO_BITMAP | FT_LOAD_IGNORE_TRANSFORM;
@@ -1068,7 +1190,7 @@ fz_outline_ft_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *tr
 	if (fterr)
 	{
 		fz_warn(ctx, "freetype load glyph (gid %d): %s", gid, ft_error_string(fterr));
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 		return NULL;
 	}
 
@@ -1090,7 +1212,7 @@ fz_outline_ft_glyph(fz_context *ctx, fz_font *font, int gid, const fz_matrix *tr
 	}
 	fz_always(ctx)
 	{
-		fz_unlock(ctx, FZ_LOCK_FREETYPE);
+		fz_unlock_ft_face(ctx, font, face);
 	}
 	fz_catch(ctx)
 	{
@@ -1417,6 +1539,7 @@ static float
 fz_advance_ft_glyph(fz_context *ctx, fz_font *font, int gid, int wmode)
 {
 	FT_Fixed adv;
+	FT_Face face;
 	int mask;
 
 	/* Substitute font widths. */
@@ -1430,10 +1553,10 @@ fz_advance_ft_glyph(fz_context *ctx, fz_font *font, int gid, int wmode)
 	mask = FT_LOAD_NO_SCALE | FT_LOAD_NO_HINTING | FT_LOAD_IGNORE_TRANSFORM;
 	if (wmode)
 		mask |= FT_LOAD_VERTICAL_LAYOUT;
-	fz_lock(ctx, FZ_LOCK_FREETYPE);
-	FT_Get_Advance(font->ft_face, gid, mask, &adv);
-	fz_unlock(ctx, FZ_LOCK_FREETYPE);
-	return (float) adv / ((FT_Face)font->ft_face)->units_per_EM;
+	face = fz_lock_ft_face(ctx, font);
+	FT_Get_Advance(face, gid, mask, &adv);
+	fz_unlock_ft_face(ctx, font, face);
+	return (float) adv / face->units_per_EM;
 }
 
 static float
@@ -30,6 +30,21 @@ fz_eval_function(fz_context *ctx, fz_function *func, const float *in, int inlen,
 	}
 }
 
+void
+fz_eval_function_n(fz_context *ctx, fz_function *func, const float *in, int inlen, float *out, int outlen, int count)
+{
+	int i;
+
+	if (func->evaluate_n && inlen == func->m && outlen == func->n)
+	{
+		func->evaluate_n(ctx, func, count, in, out);
+		return;
+	}
+
+	for (i = 0; i < count; i++)
+		fz_eval_function(ctx, func, in + i * inlen, inlen, out + i * outlen, outlen);
+}
+
 fz_function *
 fz_keep_function(fz_context *ctx, fz_function *func)
 {
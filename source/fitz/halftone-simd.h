@@ -0,0 +1,112 @@
+/*
+	This file is #included by halftone.c twice, to produce the SSE2
+	and the AVX2 versions of the threshold routines.
+
+	Both do_threshold_1 and do_threshold_4 come down to comparing a
+	run of bytes with the halftone line, and packing the results 8 to
+	a byte, msb first; they only differ in the sense of the test. So
+	here one routine does both, 16 (or 32) bytes at a time. The bytes
+	are reversed within each group of 8 before the results are
+	gathered with movemask, so that the first byte lands in the top
+	bit. The halftone line must run on for a vector past ht_len, so
+	that a load never has to wrap.
+*/
+
+#ifdef SIMD_AVX2
+#define SIMD_TARGET FZ_TARGET_AVX2
+#define SIMD_NAME(NAME) NAME##_avx2
+#define SIMD_BYTES 32
+#define VI __m256i
+#define VI_LOAD(P) _mm256_loadu_si256((const __m256i *)(P))
+#define VI_XOR _mm256_xor_si256
+#define VI_SET1 _mm256_set1_epi8
+#define VI_GT _mm256_cmpgt_epi8
+#define VI_MOVEMASK _mm256_movemask_epi8
+#else
+#define SIMD_TARGET FZ_TARGET_SSE2
+#define SIMD_NAME(NAME) NAME##_sse2
+#define SIMD_BYTES 16
+#define VI __m128i
+#define VI_LOAD(P) _mm_loadu_si128((const __m128i *)(P))
+#define VI_XOR _mm_xor_si128
+#define VI_SET1 _mm_set1_epi8
+#define VI_GT _mm_cmpgt_epi8
+#define VI_MOVEMASK _mm_movemask_epi8
+#endif
+
+/* Reverse the order of the bytes within each group of 8. */
+static inline SIMD_TARGET VI
+SIMD_NAME(reverse_8)(VI v)
+{
+#ifdef SIMD_AVX2
+	const VI rev = _mm256_setr_epi8(
+		7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+		7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+	return _mm256_shuffle_epi8(v, rev);
+#else
+	v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+	v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+	return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+#endif
+}
+
+/* Set a bit for each of the len bytes that is below (or, if invert,
+ * not below) its halftone byte. ht_len is a multiple of 8. */
+static SIMD_TARGET void
+SIMD_NAME(threshold_bytes)(const unsigned char * restrict ht_line, const unsigned char * restrict pixmap, unsigned char * restrict out, int len, int ht_len, int invert)
+{
+	const VI bias = VI_SET1((char)0x80);
+	unsigned int flip = invert ? ~0U : 0;
+	int pos = 0;
+	int k;
+
+	for (; len >= SIMD_BYTES; len -= SIMD_BYTES)
+	{
+		VI p = VI_XOR(VI_LOAD(pixmap), bias);
+		VI t = VI_XOR(VI_LOAD(ht_line + pos), bias);
+		unsigned int m = (unsigned int)VI_MOVEMASK(SIMD_NAME(reverse_8)(VI_GT(t, p))) ^ flip;
+		for (k = 0; k < SIMD_BYTES / 8; k++)
+			*out++ = m >> (8 * k);
+		pixmap += SIMD_BYTES;
+		pos += SIMD_BYTES;
+		while (pos >= ht_len)
+			pos -= ht_len;
+	}
+
+	while (len > 0)
+	{
+		int h = 0;
+		for (k = 0; k < 8 && k < len; k++)
+			if ((pixmap[k] < ht_line[pos + k]) != invert)
+				h |= 0x80 >> k;
+		*out++ = h;
+		pixmap += 8;
+		len -= 8;
+		pos += 8;
+		if (pos >= ht_len)
+			pos -= ht_len;
+	}
+}
+
+static SIMD_TARGET void
+SIMD_NAME(do_threshold_1)(const unsigned char * restrict ht_line, const unsigned char * restrict pixmap, unsigned char * restrict out, int w, int ht_len)
+{
+	SIMD_NAME(threshold_bytes)(ht_line, pixmap, out, w, ht_len, 0);
+}
+
+static SIMD_TARGET void
+SIMD_NAME(do_threshold_4)(const unsigned char * restrict ht_line, const unsigned char * restrict pixmap, unsigned char * restrict out, int w, int ht_len)
+{
+	SIMD_NAME(threshold_bytes)(ht_line, pixmap, out, w * 4, ht_len * 4, 1);
+}
+
+#undef VI_MOVEMASK
+#undef VI_GT
+#undef VI_SET1
+#undef VI_XOR
+#undef VI_LOAD
+#undef VI
+#undef SIMD_BYTES
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef SIMD_AVX2
@@ -495,6 +495,20 @@ static void do_threshold_4(const unsigned char * restrict ht_line, const unsigne
 }
 #endif
 
+#ifdef ARCH_X86_SIMD
+
+#include <immintrin.h>
+
+#include "halftone-simd.h"
+#define SIMD_AVX2
+#include "halftone-simd.h"
+
+#endif /* ARCH_X86_SIMD */
+
+/* The vector threshold routines read up to this many pixels beyond
+ * the repeat of the halftone line. */
+#define HT_LINE_PAD 32
+
 fz_bitmap *fz_new_bitmap_from_pixmap(fz_context *ctx, fz_pixmap *pix, fz_halftone *ht)
 {
 	return fz_new_bitmap_from_pixmap_band(ctx, pix, ht, 0);
@@ -548,15 +562,25 @@ fz_bitmap *fz_new_bitmap_from_pixmap_band(fz_context *ctx, fz_pixmap *pix, fz_ha
 		return NULL;
 	}
 
+#ifdef ARCH_X86_SIMD
+	{
+		int features = fz_cpu_features(ctx);
+		if (features & FZ_CPU_AVX2)
+			thresh = (n == 1 ? &do_threshold_1_avx2 : &do_threshold_4_avx2);
+		else if (features & FZ_CPU_SSE2)
+			thresh = (n == 1 ? &do_threshold_1_sse2 : &do_threshold_4_sse2);
+	}
+#endif /* ARCH_X86_SIMD */
+
 	if (ht == NULL)
 		ht_ = ht = fz_default_halftone(ctx, n);
 
 	/* Find the minimum length for the halftone line. This
 	 * is the LCM of the halftone lengths and 8. (We need a
-	 * multiple of 8 for the unrolled threshold routines - if
-	 * we ever use SSE, we may need longer.) We use the fact
-	 * that LCM(a,b) = a * b / GCD(a,b) and use euclids
-	 * algorithm.
+	 * multiple of 8 for the unrolled threshold routines.) We
+	 * use the fact that LCM(a,b) = a * b / GCD(a,b) and use
+	 * euclids algorithm. The line is made HT_LINE_PAD longer
+	 * than that, for the sake of the vector routines.
 	 */
 	lcm = 8;
 	for (i = 0; i < ht->n; i++)
@@ -567,7 +591,7 @@ fz_bitmap *fz_new_bitmap_from_pixmap_band(fz_context *ctx, fz_pixmap *pix, fz_ha
 
 	fz_try(ctx)
 	{
-		ht_line = fz_malloc(ctx, lcm * n);
+		ht_line = fz_malloc(ctx, (lcm + HT_LINE_PAD) * n);
 		out = fz_new_bitmap(ctx, pix->w, pix->h, n, pix->xres, pix->yres);
 		o = out->samples;
 		p = pix->samples;
@@ -580,7 +604,7 @@ fz_bitmap *fz_new_bitmap_from_pixmap_band(fz_context *ctx, fz_pixmap *pix, fz_ha
 		pstride = pix->stride;
 		while (h--)
 		{
-			make_ht_line(ht_line, ht, x, y++, lcm);
+			make_ht_line(ht_line, ht, x, y++, lcm + HT_LINE_PAD);
 			thresh(ht_line, p, o, w, lcm);
 			o += ostride;
 			p += pstride;
@@ -1,5 +1,7 @@
 #include "fitz-imp.h"
 
+#include <zlib.h>
+
 #define SANE_DPI 72.0f
 #define INSANE_DPI 4800.0f
 
@@ -96,14 +98,203 @@ fz_needs_reap_image_key(fz_context *ctx, void *key_)
 	return (key->image->key_storable.needs_reaping);
 }
 
+/*
+	Decoded tiles are packed for the packed tier of the store by
+	deflating their samples at the fastest setting, after replacing
+	each sample with its difference from the one to its left (as the
+	PNG sub filter does).
+*/
+typedef struct
+{
+	fz_storable storable;
+	int x, y, w, h, alpha;
+	int interpolate;
+	int xres, yres;
+	fz_colorspace *colorspace;
+	size_t len;
+	unsigned char *data;
+} fz_packed_tile;
+
+static void
+fz_drop_packed_tile_imp(fz_context *ctx, fz_storable *packed_)
+{
+	fz_packed_tile *packed = (fz_packed_tile *)packed_;
+
+	fz_drop_colorspace(ctx, packed->colorspace);
+	fz_free(ctx, packed->data);
+	fz_free(ctx, packed);
+}
+
+static void *zalloc_tile(void *opaque, unsigned int items, unsigned int size)
+{
+	return fz_malloc_array_no_throw(opaque, items, size);
+}
+
+static void zfree_tile(void *opaque, void *ptr)
+{
+	fz_free(opaque, ptr);
+}
+
+static fz_storable *
+fz_pack_image_tile(fz_context *ctx, void *key, fz_storable *val, size_t *size)
+{
+	fz_pixmap *tile = (fz_pixmap *)val;
+	fz_packed_tile *packed = NULL;
+	unsigned char *row = NULL;
+	unsigned char *data = NULL;
+	const unsigned char *s;
+	size_t span, bound;
+	z_stream z;
+	int x, y, err = Z_OK;
+
+	/* The tile must be one that fz_unpack_image_tile can make again */
+	span = (size_t)tile->w * tile->n;
+	if (span == 0 || tile->h == 0 || span * tile->h > UINT_MAX)
+		return NULL;
+	if (tile->n != fz_colorspace_n(ctx, tile->colorspace) + tile->alpha)
+		return NULL;
+
+	memset(&z, 0, sizeof z);
+	z.zalloc = zalloc_tile;
+	z.zfree = zfree_tile;
+	z.opaque = ctx;
+	if (deflateInit(&z, Z_BEST_SPEED) != Z_OK)
+		return NULL;
+
+	fz_var(row);
+	fz_var(data);
+	fz_var(packed);
+
+	fz_try(ctx)
+	{
+		/* Anything that does not pack to less than half its size is
+		 * not worth the trouble of unpacking. */
+		bound = span * tile->h / 2;
+		row = fz_malloc(ctx, span);
+		data = fz_malloc(ctx, bound);
+		z.next_out = data;
+		z.avail_out = (uInt)bound;
+
+		s = tile->samples;
+		for (y = 0; y < tile->h; y++)
+		{
+			for (x = 0; x < tile->n; x++)
+				row[x] = s[x];
+			for (; x < (int)span; x++)
+				row[x] = s[x] - s[x - tile->n];
+			z.next_in = row;
+			z.avail_in = (uInt)span;
+			err = deflate(&z, y == tile->h - 1 ? Z_FINISH : Z_NO_FLUSH);
+			if (err == Z_STREAM_END)
+				break;
+			if (err != Z_OK || z.avail_in != 0)
+				break;
+			s += tile->stride;
+		}
+		if (err != Z_STREAM_END)
+		{
+			fz_free(ctx, data);
+			data = NULL;
+		}
+		else
+		{
+			data = fz_resize_array(ctx, data, z.total_out, 1);
+
+			packed = fz_malloc_struct(ctx, fz_packed_tile);
+			FZ_INIT_STORABLE(packed, 1, fz_drop_packed_tile_imp);
+			packed->x = tile->x;
+			packed->y = tile->y;
+			packed->w = tile->w;
+			packed->h = tile->h;
+			packed->alpha = tile->alpha;
+			packed->interpolate = tile->interpolate;
+			packed->xres = tile->xres;
+			packed->yres = tile->yres;
+			packed->colorspace = fz_keep_colorspace(ctx, tile->colorspace);
+			packed->len = z.total_out;
+			packed->data = data;
+			*size = sizeof(*packed) + packed->len;
+		}
+	}
+	fz_always(ctx)
+	{
+		deflateEnd(&z);
+		fz_free(ctx, row);
+	}
+	fz_catch(ctx)
+	{
+		fz_free(ctx, data);
+		fz_rethrow(ctx);
+	}
+
+	return packed ? &packed->storable : NULL;
+}
+
+static fz_storable *
+fz_unpack_image_tile(fz_context *ctx, void *key, fz_storable *packed_, size_t *size)
+{
+	fz_packed_tile *packed = (fz_packed_tile *)packed_;
+	fz_pixmap *tile;
+	unsigned char *s;
+	size_t span, len;
+	z_stream z;
+	int x, y, err;
+
+	tile = fz_new_pixmap(ctx, packed->colorspace, packed->w, packed->h, packed->alpha);
+	tile->x = packed->x;
+	tile->y = packed->y;
+	tile->interpolate = packed->interpolate;
+	tile->xres = packed->xres;
+	tile->yres = packed->yres;
+
+	span = (size_t)tile->w * tile->n;
+	len = span * tile->h;
+
+	memset(&z, 0, sizeof z);
+	z.zalloc = zalloc_tile;
+	z.zfree = zfree_tile;
+	z.opaque = ctx;
+	if (inflateInit(&z) != Z_OK)
+	{
+		fz_drop_pixmap(ctx, tile);
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot unpack tile");
+	}
+	z.next_in = packed->data;
+	z.avail_in = (uInt)packed->len;
+	z.next_out = tile->samples;
+	z.avail_out = (uInt)len;
+	err = inflate(&z, Z_FINISH);
+	inflateEnd(&z);
+	if (err != Z_STREAM_END || z.total_out != len)
+	{
+		fz_drop_pixmap(ctx, tile);
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot unpack tile");
+	}
+
+	s = tile->samples;
+	for (y = 0; y < tile->h; y++)
+	{
+		for (x = tile->n; x < (int)span; x++)
+			s[x] += s[x - tile->n];
+		s += span;
+	}
+
+	*size = fz_pixmap_size(ctx, tile);
+	return &tile->storable;
+}
+
 static fz_store_type fz_image_store_type =
 {
+	"fz_image",
 	fz_make_hash_image_key,
 	fz_keep_image_key,
 	fz_drop_image_key,
 	fz_cmp_image_key,
 	fz_print_image_key,
-	fz_needs_reap_image_key
+	fz_needs_reap_image_key,
+	4,
+	fz_pack_image_tile,
+	fz_unpack_image_tile
 };
 
 void
@@ -185,6 +376,20 @@ fz_unblend_masked_tile(fz_context *ctx, fz_pixmap *tile, fz_image *image)
 	fz_drop_pixmap(ctx, mask);
 }
 
+/* Skip over decoded image data. Streams that can seek (such as DCT)
+ * are left to skip it without producing it. */
+static size_t
+skip_decoded(fz_context *ctx, fz_stream *stm, size_t len)
+{
+	fz_off_t pos;
+
+	if (!stm->seek)
+		return fz_skip(ctx, stm, len);
+	pos = fz_tell(ctx, stm);
+	fz_seek(ctx, stm, len, SEEK_CUR);
+	return fz_tell(ctx, stm) - pos;
+}
+
 fz_pixmap *
 fz_decomp_image_from_stream(fz_context *ctx, fz_stream *stm, fz_compressed_image *cimg, fz_irect *subarea, int indexed, int l2factor)
 {
@@ -276,12 +481,10 @@ fz_decomp_image_from_stream(fz_context *ctx, fz_stream *stm, fz_compressed_image
 			int l_margin = subarea->x0 >> l2factor;
 			int t_margin = subarea->y0 >> l2factor;
 			int r_margin = (image->w + f - 1 - subarea->x1) >> l2factor;
-			int b_margin = (image->h + f - 1 - subarea->y1) >> l2factor;
 			int l_skip = (l_margin * image->n * image->bpc)/8;
 			int r_skip = (r_margin * image->n * image->bpc + 7)/8;
 			size_t t_skip = t_margin * stream_stride + l_skip;
-			size_t b_skip = b_margin * stream_stride + r_skip;
-			size_t l = fz_skip(ctx, stm, t_skip);
+			size_t l = skip_decoded(ctx, stm, t_skip);
 			len = 0;
 			if (l == t_skip)
 			{
@@ -295,12 +498,12 @@ fz_decomp_image_from_stream(fz_context *ctx, fz_stream *stm, fz_compressed_image
 						break;
 					if (--hh == 0)
 						break;
-					l = fz_skip(ctx, stm, r_skip + l_skip);
+					l = skip_decoded(ctx, stm, r_skip + l_skip);
 					if (l < (size_t)(r_skip + l_skip))
 						break;
 				}
 				while (1);
-				(void)fz_skip(ctx, stm, r_skip + b_skip);
+				/* There is no need to decode what lies below. */
 			}
 		}
 		else
@@ -436,7 +639,26 @@ compressed_image_get_pixmap(fz_context *ctx, fz_image *image_, fz_irect *subarea
 		tile = fz_load_jxr(ctx, image->buffer->buffer->data, image->buffer->buffer->len);
 		break;
 	case FZ_IMAGE_JPX:
-		tile = fz_load_jpx(ctx, image->buffer->buffer->data, image->buffer->buffer->len, NULL, 0);
+		/* The decoder reduces the image, and clips it to the
+		 * subarea, itself. */
+		indexed = fz_colorspace_is_indexed(ctx, image->super.colorspace);
+		tile = fz_load_jpx_subarea(ctx, image->buffer->buffer->data, image->buffer->buffer->len,
+			image->super.colorspace, indexed, subarea, l2factor);
+		can_sub = 1;
+
+		if (fz_colorspace_is_indexed(ctx, tile->colorspace))
+		{
+			fz_pixmap *conv;
+			fz_try(ctx)
+				conv = fz_expand_indexed_pixmap(ctx, tile, tile->alpha);
+			fz_always(ctx)
+				fz_drop_pixmap(ctx, tile);
+			fz_catch(ctx)
+				fz_rethrow(ctx);
+			tile = conv;
+		}
+		else if (image->super.use_decode)
+			fz_decode_tile(ctx, tile, image->super.decode);
 		break;
 	case FZ_IMAGE_JPEG:
 		/* Scan JPEG stream and patch missing height values in header */
@@ -547,6 +769,48 @@ void fz_default_image_decode(void *arg, int w, int h, int l2factor, fz_irect *su
 	}
 }
 
+/* Subareas are widened out to a grid of this many (decoded) pixels, so
+ * that requests for neighbouring areas (as when panning) can share the
+ * decoded tile rather than each decoding one of their own. */
+#define SUBAREA_GRID 256
+
+static void
+snap_subarea(fz_irect *r, int w, int h, int l2factor)
+{
+	int grid = SUBAREA_GRID << l2factor;
+
+	r->x0 &= ~(grid - 1);
+	r->y0 &= ~(grid - 1);
+	r->x1 = (r->x1 + grid - 1) & ~(grid - 1);
+	r->y1 = (r->y1 + grid - 1) & ~(grid - 1);
+	if (r->x1 > w)
+		r->x1 = w;
+	if (r->y1 > h)
+		r->y1 = h;
+}
+
+static void
+subarea_extent(fz_image *image, const fz_irect *r, const fz_matrix *ctm, int *w, int *h)
+{
+	if (ctm)
+	{
+		float frac_w = (r->x1 - r->x0) / (float)image->w;
+		float frac_h = (r->y1 - r->y0) / (float)image->h;
+		float a = ctm->a * frac_w;
+		float b = ctm->b * frac_h;
+		float c = ctm->c * frac_w;
+		float d = ctm->d * frac_h;
+
+		*w = sqrtf(a * a + b * b);
+		*h = sqrtf(c * c + d * d);
+	}
+	else
+	{
+		*w = image->w;
+		*h = image->h;
+	}
+}
+
 fz_pixmap *
 fz_get_pixmap_from_image(fz_context *ctx, fz_image *image, const fz_irect *subarea, fz_matrix *ctm, int *dw, int *dh)
 {
@@ -619,28 +883,15 @@ fz_get_pixmap_from_image(fz_context *ctx, fz_image *image, const fz_irect *subar
 	}
 	else
 	{
+		/* Snap to the grid first, so that the tuning function has
+		 * the last word on what is decoded. */
 		key.rect = *subarea;
+		snap_subarea(&key.rect, image->w, image->h, l2factor);
 		ctx->tuning->image_decode(ctx->tuning->image_decode_arg, image->w, image->h, l2factor, &key.rect);
 	}
 
 	/* Based on that subarea, recalculate the extents */
-	if (ctm)
-	{
-		float frac_w = (key.rect.x1 - key.rect.x0) / (float)image->w;
-		float frac_h = (key.rect.y1 - key.rect.y0) / (float)image->h;
-		float a = ctm->a * frac_w;
-		float b = ctm->b * frac_h;
-		float c = ctm->c * frac_w;
-		float d = ctm->d * frac_h;
-
-		w = sqrtf(a * a + b * b);
-		h = sqrtf(c * c + d * d);
-	}
-	else
-	{
-		w = image->w;
-		h = image->h;
-	}
+	subarea_extent(image, &key.rect, ctm, &w, &h);
 
 	/* Return the true sizes to the caller */
 	if (dw)
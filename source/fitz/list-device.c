@@ -1,123 +1,10 @@
 #include "mupdf/fitz.h"
+#include "list-imp.h"
 
-typedef struct fz_display_node_s fz_display_node;
 typedef struct fz_list_device_s fz_list_device;
 
 #define STACK_SIZE 96
 
-typedef enum fz_display_command_e
-{
-	FZ_CMD_FILL_PATH,
-	FZ_CMD_STROKE_PATH,
-	FZ_CMD_CLIP_PATH,
-	FZ_CMD_CLIP_STROKE_PATH,
-	FZ_CMD_FILL_TEXT,
-	FZ_CMD_STROKE_TEXT,
-	FZ_CMD_CLIP_TEXT,
-	FZ_CMD_CLIP_STROKE_TEXT,
-	FZ_CMD_IGNORE_TEXT,
-	FZ_CMD_FILL_SHADE,
-	FZ_CMD_FILL_IMAGE,
-	FZ_CMD_FILL_IMAGE_MASK,
-	FZ_CMD_CLIP_IMAGE_MASK,
-	FZ_CMD_POP_CLIP,
-	FZ_CMD_BEGIN_MASK,
-	FZ_CMD_END_MASK,
-	FZ_CMD_BEGIN_GROUP,
-	FZ_CMD_END_GROUP,
-	FZ_CMD_BEGIN_TILE,
-	FZ_CMD_END_TILE,
-	FZ_CMD_RENDER_FLAGS
-} fz_display_command;
-
-/* The display list is a list of nodes.
- * Each node is a structure consisting of a bitfield (that packs into a
- * 32 bit word).
- * The different fields in the bitfield identify what information is
- * present in the node.
- *
- *	cmd:	What type of node this is.
- *
- *	size:	The number of sizeof(fz_display_node) bytes that this nodes
- *		data occupies. (i.e. &node[node->size] = the next node in the
- *		chain; 0 for end of list).
- *
- *	rect:	0 for unchanged, 1 for present.
- *
- *	path:	0 for unchanged, 1 for present.
- *
- *	cs:	0 for unchanged
- *		1 for devicegray (color defaults to 0)
- *		2 for devicegray (color defaults to 1)
- *		3 for devicergb (color defaults to 0,0,0)
- *		4 for devicergb (color defaults to 1,1,1)
- *		5 for devicecmyk (color defaults to 0,0,0,0)
- *		6 for devicecmyk (color defaults to 0,0,0,1)
- *		7 for present (color defaults to 0)
- *
- *	color:	0 for unchanged color, 1 for present.
- *
- *	alpha:	0 for unchanged, 1 for solid, 2 for transparent, 3
- *		for alpha value present.
- *
- *	ctm:	0 for unchanged,
- *		1 for change ad
- *		2 for change bc
- *		4 for change ef.
- *
- *	stroke:	0 for unchanged, 1 for present.
- *
- *	flags:	Flags (node specific meanings)
- *
- * Nodes are packed in the order:
- * header, rect, colorspace, color, alpha, ctm, stroke_state, path, private data.
- */
-struct fz_display_node_s
-{
-	unsigned int cmd    : 5;
-	unsigned int size   : 9;
-	unsigned int rect   : 1;
-	unsigned int path   : 1;
-	unsigned int cs     : 3;
-	unsigned int color  : 1;
-	unsigned int alpha  : 2;
-	unsigned int ctm    : 3;
-	unsigned int stroke : 1;
-	unsigned int flags  : 6;
-};
-
-enum {
-	CS_UNCHANGED = 0,
-	CS_GRAY_0    = 1,
-	CS_GRAY_1    = 2,
-	CS_RGB_0     = 3,
-	CS_RGB_1     = 4,
-	CS_CMYK_0    = 5,
-	CS_CMYK_1    = 6,
-	CS_OTHER_0   = 7,
-
-	ALPHA_UNCHANGED = 0,
-	ALPHA_1         = 1,
-	ALPHA_0         = 2,
-	ALPHA_PRESENT   = 3,
-
-	CTM_UNCHANGED = 0,
-	CTM_CHANGE_AD = 1,
-	CTM_CHANGE_BC = 2,
-	CTM_CHANGE_EF = 4,
-
-	MAX_NODE_SIZE = (1<<9)-sizeof(fz_display_node)
-};
-
-struct fz_display_list_s
-{
-	fz_storable storable;
-	fz_display_node *list;
-	fz_rect mediabox;
-	int max;
-	int len;
-};
-
 struct fz_list_device_s
 {
 	fz_device super;
@@ -142,9 +29,6 @@ struct fz_list_device_s
 
 enum { ISOLATED = 1, KNOCKOUT = 2 };
 
-#define SIZE_IN_NODES(t) \
-	((t + sizeof(fz_display_node) - 1) / sizeof(fz_display_node))
-
 static void
 fz_append_display_node(
 	fz_context *ctx,
@@ -1109,15 +993,6 @@ fz_list_end_group(fz_context *ctx, fz_device *dev)
 		0); /* private_data_len */
 }
 
-typedef struct fz_list_tile_data_s fz_list_tile_data;
-
-struct fz_list_tile_data_s
-{
-	float xstep;
-	float ystep;
-	fz_rect view;
-};
-
 static int
 fz_list_begin_tile(fz_context *ctx, fz_device *dev, const fz_rect *area, const fz_rect *view, float xstep, float ystep, const fz_matrix *ctm, int id)
 {
@@ -1126,6 +1001,7 @@ fz_list_begin_tile(fz_context *ctx, fz_device *dev, const fz_rect *area, const f
 	tile.xstep = xstep;
 	tile.ystep = ystep;
 	tile.view = *view;
+	tile.id = id;
 	fz_append_display_node(
 		ctx,
 		dev,
@@ -1194,6 +1070,377 @@ fz_list_render_flags(fz_context *ctx, fz_device *dev, int set, int clear)
 		0); /* private_data_len */
 }
 
+static void
+fz_drop_display_index(fz_context *ctx, fz_display_index *index)
+{
+	if (!index)
+		return;
+	fz_free(ctx, index->spans);
+	fz_free(ctx, index->order);
+	fz_free(ctx, index->boxes);
+	fz_free(ctx, index);
+}
+
+/* Like fz_union_rect, but keeps degenerate rectangles; a zero width
+ * rectangle can still have area once it has been rotated. */
+static void
+union_box(fz_rect *a, const fz_rect *b)
+{
+	if (fz_is_infinite_rect(a))
+		return;
+	if (fz_is_infinite_rect(b))
+	{
+		*a = *b;
+		return;
+	}
+	if (a->x0 > b->x0)
+		a->x0 = b->x0;
+	if (a->y0 > b->y0)
+		a->y0 = b->y0;
+	if (a->x1 < b->x1)
+		a->x1 = b->x1;
+	if (a->y1 < b->y1)
+		a->y1 = b->y1;
+}
+
+static unsigned int
+hilbert_key(unsigned int x, unsigned int y)
+{
+	unsigned int rx, ry, s, t, d = 0;
+
+	for (s = 1<<13; s > 0; s >>= 1)
+	{
+		rx = (x & s) != 0;
+		ry = (y & s) != 0;
+		d += s * s * ((3 * rx) ^ ry);
+		if (ry == 0)
+		{
+			if (rx == 1)
+			{
+				x = 0x3fff - x;
+				y = 0x3fff - y;
+			}
+			t = x;
+			x = y;
+			y = t;
+		}
+	}
+	return d;
+}
+
+typedef struct
+{
+	unsigned int key;
+	int span;
+} fz_span_key;
+
+static int
+cmp_span_key(const void *a_, const void *b_)
+{
+	const fz_span_key *a = a_;
+	const fz_span_key *b = b_;
+	if (a->key != b->key)
+		return a->key < b->key ? -1 : 1;
+	return a->span - b->span;
+}
+
+static int
+cmp_int(const void *a_, const void *b_)
+{
+	return *(const int *)a_ - *(const int *)b_;
+}
+
+static void
+fz_build_display_tree(fz_context *ctx, fz_display_index *index)
+{
+	fz_span_key *keys;
+	fz_rect bounds = fz_empty_rect;
+	float sx, sy;
+	int i, j, k, n, total;
+	int first = 1;
+
+	/* Sort the spans by size, and then along a Hilbert curve through
+	 * the centres of their rectangles, so that neighbouring leaves are
+	 * close on the page and a few long lines do not swell the boxes
+	 * of many small shapes. Spans that are always drawn go last, to
+	 * keep them out of everyone else's boxes. */
+	for (i = 0; i < index->len; i++)
+	{
+		if (index->spans[i].always)
+			continue;
+		if (first)
+			bounds = index->spans[i].rect;
+		else
+			union_box(&bounds, &index->spans[i].rect);
+		first = 0;
+	}
+	sx = bounds.x1 > bounds.x0 ? 16383 / (bounds.x1 - bounds.x0) : 0;
+	sy = bounds.y1 > bounds.y0 ? 16383 / (bounds.y1 - bounds.y0) : 0;
+
+	keys = fz_malloc_array(ctx, index->len, sizeof(fz_span_key));
+	for (i = 0; i < index->len; i++)
+	{
+		fz_display_span *span = &index->spans[i];
+		keys[i].span = i;
+		if (span->always)
+			keys[i].key = 0xffffffff;
+		else
+		{
+			float x = ((span->rect.x0 + span->rect.x1) / 2 - bounds.x0) * sx;
+			float y = ((span->rect.y0 + span->rect.y1) / 2 - bounds.y0) * sy;
+			float size = fz_max((span->rect.x1 - span->rect.x0) * sx, (span->rect.y1 - span->rect.y0) * sy);
+			unsigned int scale = 0;
+			while (scale < 15 && size >= (1 << scale))
+				scale++;
+			keys[i].key = (scale << 28) | hilbert_key(fz_clamp(x, 0, 16383), fz_clamp(y, 0, 16383));
+		}
+	}
+	qsort(keys, index->len, sizeof(fz_span_key), cmp_span_key);
+
+	fz_try(ctx)
+	{
+		index->order = fz_malloc_array(ctx, index->len, sizeof(int));
+		for (i = 0; i < index->len; i++)
+			index->order[i] = keys[i].span;
+	}
+	fz_always(ctx)
+		fz_free(ctx, keys);
+	fz_catch(ctx)
+		fz_rethrow(ctx);
+
+	/* Level 0 holds the leaves; each level above holds the bounds of
+	 * groups of INDEX_FANOUT entries of the one below, up to a single
+	 * root. */
+	n = index->len;
+	total = 0;
+	for (k = 0; k < INDEX_MAX_LEVELS; k++)
+	{
+		index->level_start[k] = total;
+		index->level_len[k] = n;
+		total += n;
+		if (n == 1)
+			break;
+		n = (n + INDEX_FANOUT - 1) / INDEX_FANOUT;
+	}
+	if (k == INDEX_MAX_LEVELS)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "display list too large to index");
+	index->levels = k + 1;
+
+	index->boxes = fz_malloc_array(ctx, total, sizeof(fz_rect));
+	for (i = 0; i < index->len; i++)
+	{
+		fz_display_span *span = &index->spans[index->order[i]];
+		index->boxes[i] = span->always ? fz_infinite_rect : span->rect;
+	}
+	for (k = 1; k < index->levels; k++)
+	{
+		fz_rect *below = &index->boxes[index->level_start[k-1]];
+		fz_rect *box = &index->boxes[index->level_start[k]];
+		n = index->level_len[k-1];
+		for (i = 0; i < index->level_len[k]; i++)
+		{
+			box[i] = below[i * INDEX_FANOUT];
+			for (j = i * INDEX_FANOUT + 1; j < n && j < (i + 1) * INDEX_FANOUT; j++)
+				union_box(&box[i], &below[j]);
+		}
+	}
+}
+
+void
+fz_index_display_list(fz_context *ctx, fz_display_list *list)
+{
+	fz_display_index *index = NULL;
+	fz_display_node *node = list->list;
+	fz_display_node *node_end = list->list + list->len;
+	fz_display_span state = { { 0 } };
+	int depth = 0;
+	int cap = 0;
+	int cs_n = 1;
+
+	fz_drop_display_index(ctx, list->index);
+	list->index = NULL;
+
+	state.cs = CS_GRAY_0;
+	state.cs_off = -1;
+	state.color_off = -1;
+	state.stroke_off = -1;
+	state.path_off = -1;
+	state.alpha = 1.0f;
+	state.ctm = fz_identity;
+
+	fz_var(index);
+
+	fz_try(ctx)
+	{
+		index = fz_malloc_struct(ctx, fz_display_index);
+
+		while (node != node_end)
+		{
+			fz_display_node n = *node;
+			fz_display_node *next = node + n.size;
+			fz_display_span *span = NULL;
+
+			if (depth == 0)
+			{
+				if (index->len == cap)
+				{
+					cap = cap ? cap * 2 : 256;
+					index->spans = fz_resize_array(ctx, index->spans, cap, sizeof(fz_display_span));
+				}
+				span = &index->spans[index->len++];
+				*span = state;
+				span->start = node - list->list;
+			}
+
+			node++;
+			if (n.rect)
+			{
+				state.rect = *(fz_rect *)node;
+				node += SIZE_IN_NODES(sizeof(fz_rect));
+			}
+			if (n.cs)
+			{
+				state.cs = n.cs;
+				state.color_off = -1;
+				switch (n.cs)
+				{
+				default:
+				case CS_GRAY_0:
+				case CS_GRAY_1:
+					cs_n = 1;
+					break;
+				case CS_RGB_0:
+				case CS_RGB_1:
+					cs_n = 3;
+					break;
+				case CS_CMYK_0:
+				case CS_CMYK_1:
+					cs_n = 4;
+					break;
+				case CS_OTHER_0:
+					state.cs_off = node - list->list;
+					cs_n = fz_colorspace_n(ctx, *(fz_colorspace **)node);
+					node += SIZE_IN_NODES(sizeof(fz_colorspace *));
+					break;
+				}
+			}
+			if (n.color)
+			{
+				state.color_off = node - list->list;
+				node += SIZE_IN_NODES(cs_n * sizeof(float));
+			}
+			if (n.alpha)
+			{
+				switch (n.alpha)
+				{
+				default:
+				case ALPHA_0:
+					state.alpha = 0.0f;
+					break;
+				case ALPHA_1:
+					state.alpha = 1.0f;
+					break;
+				case ALPHA_PRESENT:
+					state.alpha = *(float *)node;
+					node += SIZE_IN_NODES(sizeof(float));
+					break;
+				}
+			}
+			if (n.ctm != 0)
+			{
+				float *packed_ctm = (float *)node;
+				if (n.ctm & CTM_CHANGE_AD)
+				{
+					state.ctm.a = *packed_ctm++;
+					state.ctm.d = *packed_ctm++;
+					node += SIZE_IN_NODES(2*sizeof(float));
+				}
+				if (n.ctm & CTM_CHANGE_BC)
+				{
+					state.ctm.b = *packed_ctm++;
+					state.ctm.c = *packed_ctm++;
+					node += SIZE_IN_NODES(2*sizeof(float));
+				}
+				if (n.ctm & CTM_CHANGE_EF)
+				{
+					state.ctm.e = *packed_ctm++;
+					state.ctm.f = *packed_ctm;
+					node += SIZE_IN_NODES(2*sizeof(float));
+				}
+			}
+			if (n.stroke)
+			{
+				state.stroke_off = node - list->list;
+				node += SIZE_IN_NODES(sizeof(fz_stroke_state *));
+			}
+			if (n.path)
+				state.path_off = node - list->list;
+
+			/* The rect after the first node is the one it is culled
+			 * on; it is also the rect in force before it unless the
+			 * node changes it, in which case replay reads it again. */
+			if (span)
+			{
+				fz_rect *r = &state.rect;
+				span->rect = *r;
+				span->always = (n.cmd == FZ_CMD_BEGIN_TILE || n.cmd == FZ_CMD_END_TILE ||
+					n.cmd == FZ_CMD_RENDER_FLAGS || n.cmd == FZ_CMD_POP_CLIP ||
+					n.cmd == FZ_CMD_END_MASK || n.cmd == FZ_CMD_END_GROUP ||
+					fz_is_infinite_rect(r) ||
+					r->x0 != r->x0 || r->y0 != r->y0 || r->x1 != r->x1 || r->y1 != r->y1);
+			}
+
+			switch (n.cmd)
+			{
+			case FZ_CMD_CLIP_PATH:
+			case FZ_CMD_CLIP_STROKE_PATH:
+			case FZ_CMD_CLIP_TEXT:
+			case FZ_CMD_CLIP_STROKE_TEXT:
+			case FZ_CMD_CLIP_IMAGE_MASK:
+			case FZ_CMD_BEGIN_MASK:
+			case FZ_CMD_BEGIN_GROUP:
+			case FZ_CMD_BEGIN_TILE:
+				depth++;
+				break;
+			case FZ_CMD_POP_CLIP:
+			case FZ_CMD_END_GROUP:
+			case FZ_CMD_END_TILE:
+				/* An unbalanced close at the top level is never
+				 * culled, so it can stand alone. */
+				if (depth > 0)
+					depth--;
+				break;
+			}
+
+			node = next;
+		}
+
+		if (index->len >= INDEX_MIN_SPANS)
+			fz_build_display_tree(ctx, index);
+		else
+		{
+			fz_drop_display_index(ctx, index);
+			index = NULL;
+		}
+	}
+	fz_catch(ctx)
+	{
+		/* The index is only an optimisation; replay can do without. */
+		fz_drop_display_index(ctx, index);
+		index = NULL;
+	}
+
+	list->index = index;
+}
+
+static void
+fz_list_close_device(fz_context *ctx, fz_device *dev)
+{
+	fz_list_device *writer = (fz_list_device *)dev;
+
+	fz_index_display_list(ctx, writer->list);
+}
+
 static void
 fz_list_drop_device(fz_context *ctx, fz_device *dev)
 {
@@ -1209,6 +1456,10 @@ fz_new_list_device(fz_context *ctx, fz_display_list *list)
 {
 	fz_list_device *dev;
 
+	/* The nodes of a loaded list live in its file. */
+	if (list->map)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot append to a loaded display list");
+
 	dev = fz_new_device(ctx, sizeof(fz_list_device));
 
 	dev->super.fill_path = fz_list_fill_path;
@@ -1239,6 +1490,7 @@ fz_new_list_device(fz_context *ctx, fz_display_list *list)
 
 	dev->super.render_flags = fz_list_render_flags;
 
+	dev->super.close_device = fz_list_close_device;
 	dev->super.drop_device = fz_list_drop_device;
 
 	dev->list = list;
@@ -1251,6 +1503,10 @@ fz_new_list_device(fz_context *ctx, fz_display_list *list)
 	dev->top = 0;
 	dev->tiled = 0;
 
+	/* Anything we add would not be covered by the old index. */
+	fz_drop_display_index(ctx, list->index);
+	list->index = NULL;
+
 	return &dev->super;
 }
 
@@ -1343,7 +1599,11 @@ fz_drop_display_list_imp(fz_context *ctx, fz_storable *list_)
 
 		node = next;
 	}
-	fz_free(ctx, list->list);
+	fz_drop_display_index(ctx, list->index);
+	if (list->map)
+		fz_drop_display_map(ctx, list->map);
+	else
+		fz_free(ctx, list->list);
 	fz_free(ctx, list);
 }
 
@@ -1356,6 +1616,8 @@ fz_new_display_list(fz_context *ctx, const fz_rect *mediabox)
 	list->mediabox = mediabox ? *mediabox : fz_empty_rect;
 	list->max = 0;
 	list->len = 0;
+	list->index = NULL;
+	list->map = NULL;
 	return list;
 }
 
@@ -1385,6 +1647,145 @@ int fz_display_list_is_empty(fz_context *ctx, const fz_display_list *list)
 	return !list || list->len == 0;
 }
 
+static fz_colorspace *
+fz_unpack_colorspace(fz_context *ctx, int cs, fz_colorspace **other, float *color)
+{
+	fz_colorspace *colorspace;
+	int i, en;
+
+	switch (cs)
+	{
+	default:
+	case CS_GRAY_0:
+		colorspace = fz_device_gray(ctx);
+		color[0] = 0.0f;
+		break;
+	case CS_GRAY_1:
+		colorspace = fz_device_gray(ctx);
+		color[0] = 1.0f;
+		break;
+	case CS_RGB_0:
+		colorspace = fz_device_rgb(ctx);
+		color[0] = 0.0f;
+		color[1] = 0.0f;
+		color[2] = 0.0f;
+		break;
+	case CS_RGB_1:
+		colorspace = fz_device_rgb(ctx);
+		color[0] = 1.0f;
+		color[1] = 1.0f;
+		color[2] = 1.0f;
+		break;
+	case CS_CMYK_0:
+		colorspace = fz_device_cmyk(ctx);
+		color[0] = 0.0f;
+		color[1] = 0.0f;
+		color[2] = 0.0f;
+		color[3] = 0.0f;
+		break;
+	case CS_CMYK_1:
+		colorspace = fz_device_cmyk(ctx);
+		color[0] = 0.0f;
+		color[1] = 0.0f;
+		color[2] = 0.0f;
+		color[3] = 1.0f;
+		break;
+	case CS_OTHER_0:
+		colorspace = fz_keep_colorspace(ctx, *other);
+		en = fz_colorspace_n(ctx, colorspace);
+		for (i = 0; i < en; i++)
+			color[i] = 0.0f;
+		break;
+	}
+	return colorspace;
+}
+
+/* Replace the unpacked graphics state with the one in force at the
+ * start of a span. */
+static void
+fz_restore_display_state(fz_context *ctx, fz_display_list *list, const fz_display_span *span,
+	fz_rect *rect, fz_colorspace **colorspace, float *color, float *alpha, fz_matrix *ctm,
+	fz_stroke_state **stroke, fz_path **path)
+{
+	fz_display_node *base = list->list;
+
+	*rect = span->rect;
+	fz_drop_colorspace(ctx, *colorspace);
+	*colorspace = fz_unpack_colorspace(ctx, span->cs, span->cs_off < 0 ? NULL : (fz_colorspace **)&base[span->cs_off], color);
+	if (span->color_off >= 0)
+		memcpy(color, &base[span->color_off], fz_colorspace_n(ctx, *colorspace) * sizeof(float));
+	*alpha = span->alpha;
+	*ctm = span->ctm;
+	fz_drop_stroke_state(ctx, *stroke);
+	*stroke = span->stroke_off < 0 ? NULL : fz_keep_stroke_state(ctx, *(fz_stroke_state **)&base[span->stroke_off]);
+	fz_drop_path(ctx, *path);
+	*path = span->path_off < 0 ? NULL : fz_keep_path(ctx, (fz_path *)&base[span->path_off]);
+}
+
+static int
+span_box_visible(const fz_rect *box, const fz_matrix *ctm, const fz_rect *area)
+{
+	fz_rect r;
+
+	if (fz_is_infinite_rect(box))
+		return 1;
+	r = *box;
+	fz_transform_rect(&r, ctm);
+	fz_intersect_rect(&r, area);
+	return !fz_is_empty_rect(&r);
+}
+
+static void
+fz_collect_spans(fz_display_index *index, int level, int i, const fz_matrix *ctm, const fz_rect *area, int *hits, int *len)
+{
+	int j, end;
+
+	if (!span_box_visible(&index->boxes[index->level_start[level] + i], ctm, area))
+		return;
+	if (level == 0)
+	{
+		hits[(*len)++] = index->order[i];
+		return;
+	}
+	end = fz_mini((i + 1) * INDEX_FANOUT, index->level_len[level - 1]);
+	for (j = i * INDEX_FANOUT; j < end; j++)
+		fz_collect_spans(index, level - 1, j, ctm, area, hits, len);
+}
+
+/* Find the spans that may be visible through the scissor, in list
+ * order. Returns NULL if every span has to be visited anyway. */
+static int *
+fz_find_display_spans(fz_context *ctx, fz_display_list *list, const fz_matrix *top_ctm, const fz_rect *scissor, int *len)
+{
+	fz_display_index *index = list->index;
+	fz_rect area = *scissor;
+	float m;
+	int *hits;
+
+	if (!index || fz_is_infinite_rect(scissor))
+		return NULL;
+
+	hits = fz_malloc_no_throw(ctx, index->len * sizeof(int));
+	if (!hits)
+		return NULL;
+
+	/* The boxes are tested the same way as the nodes themselves, but
+	 * with some slack for rounding; the nodes that start each span
+	 * are still culled exactly as before. */
+	m = fz_max(fz_max(fabsf(area.x0), fabsf(area.x1)), fz_max(fabsf(area.y0), fabsf(area.y1)));
+	fz_expand_rect(&area, 1 + m * 1e-4f);
+
+	*len = 0;
+	fz_collect_spans(index, index->levels - 1, 0, top_ctm, &area, hits, len);
+	if (*len == index->len)
+	{
+		fz_free(ctx, hits);
+		return NULL;
+	}
+	qsort(hits, *len, sizeof(int), cmp_int);
+	return hits;
+}
+
 void
 fz_run_display_list(fz_context *ctx, fz_display_list *list, fz_device *dev, const fz_matrix *top_ctm, const fz_rect *scissor, fz_cookie *cookie)
 {
@@ -1409,6 +1810,11 @@ fz_run_display_list(fz_context *ctx, fz_display_list *list, fz_device *dev, cons
 	fz_matrix trans_ctm;
 	int tile_skip_depth = 0;
 
+	/* Spans that may be visible, if we are using the index */
+	int *hits;
+	int nhits = 0;
+	int hit = 0;
+
 	fz_var(colorspace);
 
 	if (!scissor)
@@ -1420,13 +1826,34 @@ fz_run_display_list(fz_context *ctx, fz_display_list *list, fz_device *dev, cons
 		cookie->progress = 0;
 	}
 
+	hits = fz_find_display_spans(ctx, list, top_ctm, scissor, &nhits);
+
 	node = list->list;
-	node_end = &list->list[list->len];
-	for (; node != node_end ; node = next_node)
+	node_end = hits ? node : &list->list[list->len];
+	for (;; node = next_node)
 	{
 		int empty;
-		fz_display_node n = *node;
+		fz_display_node n;
+
+		if (node == node_end)
+		{
+			fz_display_span *span;
+
+			if (!hits || hit == nhits)
+				break;
+			span = &list->index->spans[hits[hit++]];
+			if (node != &list->list[span->start])
+			{
+				fz_restore_display_state(ctx, list, span, &rect, &colorspace, color, &alpha, &ctm, &stroke, &path);
+				node = &list->list[span->start];
+			}
+			if (span + 1 < list->index->spans + list->index->len)
+				node_end = &list->list[span[1].start];
+			else
+				node_end = &list->list[list->len];
+		}
 
+		n = *node;
 		next_node = node + n.size;
 
 		/* Check the cookie for aborting */
@@ -1445,54 +1872,10 @@ fz_run_display_list(fz_context *ctx, fz_display_list *list, fz_device *dev, cons
 		}
 		if (n.cs)
 		{
-			int i, en;
-
 			fz_drop_colorspace(ctx, colorspace);
-			switch (n.cs)
-			{
-			default:
-			case CS_GRAY_0:
-				colorspace = fz_device_gray(ctx);
-				color[0] = 0.0f;
-				break;
-			case CS_GRAY_1:
-				colorspace = fz_device_gray(ctx);
-				color[0] = 1.0f;
-				break;
-			case CS_RGB_0:
-				colorspace = fz_device_rgb(ctx);
-				color[0] = 0.0f;
-				color[1] = 0.0f;
-				color[2] = 0.0f;
-				break;
-			case CS_RGB_1:
-				colorspace = fz_device_rgb(ctx);
-				color[0] = 1.0f;
-				color[1] = 1.0f;
-				color[2] = 1.0f;
-				break;
-			case CS_CMYK_0:
-				colorspace = fz_device_cmyk(ctx);
-				color[0] = 0.0f;
-				color[1] = 0.0f;
-				color[2] = 0.0f;
-				color[3] = 0.0f;
-				break;
-			case CS_CMYK_1:
-				colorspace = fz_device_cmyk(ctx);
-				color[0] = 0.0f;
-				color[1] = 0.0f;
-				color[2] = 0.0f;
-				color[3] = 1.0f;
-				break;
-			case CS_OTHER_0:
-				colorspace = fz_keep_colorspace(ctx, *(fz_colorspace **)(node));
+			colorspace = fz_unpack_colorspace(ctx, n.cs, (fz_colorspace **)node, color);
+			if (n.cs == CS_OTHER_0)
 				node += SIZE_IN_NODES(sizeof(fz_colorspace *));
-				en = fz_colorspace_n(ctx, colorspace);
-				for (i = 0; i < en; i++)
-					color[i] = 0.0f;
-				break;
-			}
 		}
 		if (n.color)
 		{
@@ -1680,7 +2063,7 @@ visible:
 				fz_rect tile_rect;
 				tiled++;
 				tile_rect = data->view;
-				cached = fz_begin_tile_id(ctx, dev, &rect, &tile_rect, data->xstep, data->ystep, &trans_ctm, n.flags);
+				cached = fz_begin_tile_id(ctx, dev, &rect, &tile_rect, data->xstep, data->ystep, &trans_ctm, data->id);
 				if (cached)
 					tile_skip_depth = 1;
 				break;
@@ -1707,6 +2090,7 @@ visible:
 			fz_warn(ctx, "Ignoring error during interpretation");
 		}
 	}
+	fz_free(ctx, hits);
 	fz_drop_colorspace(ctx, colorspace);
 	fz_drop_stroke_state(ctx, stroke);
 	fz_drop_path(ctx, path);
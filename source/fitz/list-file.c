@@ -0,0 +1,1663 @@
+#include "fitz-imp.h"
+#include "list-imp.h"
+#include "colorspace-imp.h"
+#include "font-imp.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define HAVE_MMAP
+#endif
+
+/*
+	Display list files.
+
+	A display list file holds a display list together with everything
+	its nodes refer to: colorspaces, stroke states, text and the fonts
+	it uses, images and shadings. The nodes are stored just as they
+	are in memory, except that each pointer in them is replaced by the
+	number of the object it refers to, so loading a list is a matter of
+	mapping the file and patching those slots. Paths are packed into
+	the nodes already and are used where they lie.
+
+	Everything is stored in the byte order and pointer size of the
+	machine that wrote the file. A file written by a different kind of
+	machine is refused rather than converted.
+
+	header:	"MUDL" version byte-order-mark pointer-size
+	objects: each 8 byte aligned, and after the objects it uses
+	table:	the offset of each object (8 bytes each)
+	trailer: table-offset (8 bytes) object-count root-object
+*/
+
+#define LIST_FILE_VERSION 2
+#define LIST_FILE_BOM 0x01020304
+#define LIST_FILE_HEADER 16
+#define LIST_FILE_TRAILER 16
+
+/* Colorspaces other than the device ones are sampled on a grid with
+ * at most this many points. */
+#define MAX_SAMPLED_POINTS 8192
+
+enum
+{
+	OBJ_COLORSPACE = 1,
+	OBJ_STROKE,
+	OBJ_FONT,
+	OBJ_TEXT,
+	OBJ_IMAGE,
+	OBJ_SHADE,
+	OBJ_LIST
+};
+
+enum
+{
+	CS_KIND_GRAY,
+	CS_KIND_RGB,
+	CS_KIND_BGR,
+	CS_KIND_CMYK,
+	CS_KIND_LAB,
+	CS_KIND_INDEXED,
+	CS_KIND_SAMPLED
+};
+
+enum { FONT_KIND_FREETYPE, FONT_KIND_TYPE3 };
+enum { IMAGE_KIND_COMPRESSED, IMAGE_KIND_PIXMAP };
+
+struct fz_display_map_s
+{
+	int refs;
+	unsigned char *data;
+	size_t len;
+	fz_buffer *buffer; /* if not mapped */
+};
+
+fz_display_map *
+fz_keep_display_map(fz_context *ctx, fz_display_map *map)
+{
+	return fz_keep_imp(ctx, map, &map->refs);
+}
+
+void
+fz_drop_display_map(fz_context *ctx, fz_display_map *map)
+{
+	if (fz_drop_imp(ctx, map, &map->refs))
+	{
+		if (map->buffer)
+			fz_drop_buffer(ctx, map->buffer);
+#ifdef HAVE_MMAP
+		else
+			munmap(map->data, map->len);
+#endif
+		fz_free(ctx, map);
+	}
+}
+
+/* Where the parts of a node that point elsewhere are, counted in nodes
+ * from its header; 0 if the node has no such part. */
+typedef struct fz_node_slots_s fz_node_slots;
+
+struct fz_node_slots_s
+{
+	int cs;
+	int stroke;
+	int path;
+	int priv;
+};
+
+typedef struct fz_list_reader_s fz_list_reader;
+
+struct fz_list_reader_s
+{
+	fz_display_map *map;
+	size_t pos;
+	int count;
+	int *types;
+	void **objs;
+	size_t prev_end, obj_start;
+};
+
+static void *find_object(fz_context *ctx, fz_list_reader *r, intptr_t id, int type);
+
+/* In the file a slot holds an object number, and in memory a pointer.
+ * Both are read and written with memcpy, as the node is not really of
+ * either type. */
+static intptr_t
+get_slot(const fz_display_node *slot)
+{
+	intptr_t id;
+	memcpy(&id, slot, sizeof id);
+	return id;
+}
+
+static void
+put_slot(fz_display_node *slot, intptr_t id)
+{
+	memcpy(slot, &id, sizeof id);
+}
+
+static void
+put_slot_ptr(fz_display_node *slot, void *ptr)
+{
+	memcpy(slot, &ptr, sizeof ptr);
+}
+
+static void
+corrupt(fz_context *ctx)
+{
+	fz_throw(ctx, FZ_ERROR_GENERIC, "corrupt display list file");
+}
+
+static int
+priv_type(int cmd)
+{
+	switch (cmd)
+	{
+	case FZ_CMD_FILL_TEXT:
+	case FZ_CMD_STROKE_TEXT:
+	case FZ_CMD_CLIP_TEXT:
+	case FZ_CMD_CLIP_STROKE_TEXT:
+	case FZ_CMD_IGNORE_TEXT:
+		return OBJ_TEXT;
+	case FZ_CMD_FILL_SHADE:
+		return OBJ_SHADE;
+	case FZ_CMD_FILL_IMAGE:
+	case FZ_CMD_FILL_IMAGE_MASK:
+	case FZ_CMD_CLIP_IMAGE_MASK:
+		return OBJ_IMAGE;
+	default:
+		return 0;
+	}
+}
+
+/* Work out where the slots of a node are, and update cs_n, the number
+ * of colour components in force. Without a reader the node holds real
+ * pointers; with one it holds object numbers and is checked as we go. */
+static void
+find_node_slots(fz_context *ctx, fz_list_reader *r, fz_display_node *node, int *cs_n, fz_node_slots *s)
+{
+	fz_display_node n = *node;
+	int off = 1;
+
+#define NEED(bytes) do { if (r && off + (int)SIZE_IN_NODES(bytes) > (int)n.size) corrupt(ctx); } while (0)
+
+	memset(s, 0, sizeof *s);
+	if (n.rect)
+		off += SIZE_IN_NODES(sizeof(fz_rect));
+	switch (n.cs)
+	{
+	default:
+	case CS_UNCHANGED:
+		break;
+	case CS_GRAY_0:
+	case CS_GRAY_1:
+		*cs_n = 1;
+		break;
+	case CS_RGB_0:
+	case CS_RGB_1:
+		*cs_n = 3;
+		break;
+	case CS_CMYK_0:
+	case CS_CMYK_1:
+		*cs_n = 4;
+		break;
+	case CS_OTHER_0:
+		NEED(sizeof(fz_colorspace *));
+		s->cs = off;
+		if (r)
+			*cs_n = fz_colorspace_n(ctx, find_object(ctx, r, get_slot(&node[off]), OBJ_COLORSPACE));
+		else
+			*cs_n = fz_colorspace_n(ctx, *(fz_colorspace **)&node[off]);
+		off += SIZE_IN_NODES(sizeof(fz_colorspace *));
+		break;
+	}
+	if (n.color)
+		off += SIZE_IN_NODES(*cs_n * sizeof(float));
+	if (n.alpha == ALPHA_PRESENT)
+		off += SIZE_IN_NODES(sizeof(float));
+	if (n.ctm & CTM_CHANGE_AD)
+		off += SIZE_IN_NODES(2*sizeof(float));
+	if (n.ctm & CTM_CHANGE_BC)
+		off += SIZE_IN_NODES(2*sizeof(float));
+	if (n.ctm & CTM_CHANGE_EF)
+		off += SIZE_IN_NODES(2*sizeof(float));
+	if (n.stroke)
+	{
+		NEED(sizeof(fz_stroke_state *));
+		s->stroke = off;
+		off += SIZE_IN_NODES(sizeof(fz_stroke_state *));
+	}
+	if (n.path)
+	{
+		fz_path *path = (fz_path *)&node[off];
+		const float *coords;
+		const unsigned char *cmds;
+		int coord_len, cmd_len, open;
+
+		NEED(0);
+		s->path = off;
+		open = fz_packed_path_data(path, (n.size - off) * sizeof(fz_display_node), &coords, &coord_len, &cmds, &cmd_len);
+		if (open < 0)
+			corrupt(ctx);
+		if (r && !open && !fz_path_data_is_valid(cmds, cmd_len, coord_len))
+			corrupt(ctx);
+		off += SIZE_IN_NODES(fz_packed_path_size(path));
+	}
+	s->priv = off;
+	if (priv_type(n.cmd))
+		NEED(sizeof(void *));
+	else if (n.cmd == FZ_CMD_BEGIN_TILE)
+		NEED(sizeof(fz_list_tile_data));
+	else
+		NEED(0);
+
+#undef NEED
+}
+
+/* Saving */
+
+typedef struct fz_list_writer_s fz_list_writer;
+
+struct fz_list_writer_s
+{
+	fz_output *out;
+	fz_hash_table *ids;
+	int len, cap;
+	int64_t *offsets;
+};
+
+static int save_object(fz_context *ctx, fz_list_writer *w, int type, void *obj);
+
+static void
+put(fz_context *ctx, fz_list_writer *w, const void *data, size_t len)
+{
+	fz_write(ctx, w->out, data, len);
+}
+
+static void
+put_int(fz_context *ctx, fz_list_writer *w, int x)
+{
+	put(ctx, w, &x, sizeof x);
+}
+
+static void
+put_float(fz_context *ctx, fz_list_writer *w, float x)
+{
+	put(ctx, w, &x, sizeof x);
+}
+
+static void
+put_align(fz_context *ctx, fz_list_writer *w, int align)
+{
+	static const unsigned char zero[8] = { 0 };
+	int pad = (int)(-fz_tell_output(ctx, w->out) & (align - 1));
+	put(ctx, w, zero, pad);
+}
+
+/* Data of any length is followed by padding to keep what comes after
+ * it aligned. */
+static void
+put_data(fz_context *ctx, fz_list_writer *w, const void *data, size_t len)
+{
+	if (len > INT_MAX)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot save object of %zu bytes", len);
+	put_int(ctx, w, (int)len);
+	put(ctx, w, data, len);
+	put_align(ctx, w, 4);
+}
+
+static int
+begin_object(fz_context *ctx, fz_list_writer *w, int type)
+{
+	put_align(ctx, w, 8);
+	if (w->len == w->cap)
+	{
+		int cap = w->cap ? w->cap * 2 : 64;
+		w->offsets = fz_resize_array(ctx, w->offsets, cap, sizeof(int64_t));
+		w->cap = cap;
+	}
+	w->offsets[w->len] = fz_tell_output(ctx, w->out);
+	put_int(ctx, w, type);
+	return w->len++;
+}
+
+static int
+save_colorspace(fz_context *ctx, fz_list_writer *w, fz_colorspace *cs)
+{
+	fz_colorspace *base;
+	unsigned char *lookup;
+	float src[FZ_MAX_COLORS], rgb[3];
+	int id, base_id, high, n, g, i, k, t, count;
+
+	if (cs == fz_device_gray(ctx))
+	{
+		id = begin_object(ctx, w, OBJ_COLORSPACE);
+		put_int(ctx, w, CS_KIND_GRAY);
+	}
+	else if (cs == fz_device_rgb(ctx))
+	{
+		id = begin_object(ctx, w, OBJ_COLORSPACE);
+		put_int(ctx, w, CS_KIND_RGB);
+	}
+	else if (cs == fz_device_bgr(ctx))
+	{
+		id = begin_object(ctx, w, OBJ_COLORSPACE);
+		put_int(ctx, w, CS_KIND_BGR);
+	}
+	else if (cs == fz_device_cmyk(ctx))
+	{
+		id = begin_object(ctx, w, OBJ_COLORSPACE);
+		put_int(ctx, w, CS_KIND_CMYK);
+	}
+	else if (fz_colorspace_is_lab(ctx, cs))
+	{
+		id = begin_object(ctx, w, OBJ_COLORSPACE);
+		put_int(ctx, w, CS_KIND_LAB);
+	}
+	else if (fz_colorspace_is_indexed(ctx, cs))
+	{
+		high = fz_indexed_colorspace_lookup(ctx, cs, &base, &lookup);
+		base_id = save_object(ctx, w, OBJ_COLORSPACE, base);
+		id = begin_object(ctx, w, OBJ_COLORSPACE);
+		put_int(ctx, w, CS_KIND_INDEXED);
+		put_int(ctx, w, base_id);
+		put_int(ctx, w, high);
+		put_data(ctx, w, lookup, (size_t)base->n * (high + 1));
+	}
+	else
+	{
+		/* Anything else is kept as a table of its conversion to RGB,
+		 * as the means to convert it live in the document. */
+		n = cs->n;
+		if (n < 1 || n > FZ_MAX_COLORS || (1 << fz_mini(n, 30)) > MAX_SAMPLED_POINTS)
+			fz_throw(ctx, FZ_ERROR_GENERIC, "cannot save colorspace %s", cs->name);
+		g = (int)floorf(powf(MAX_SAMPLED_POINTS, 1.0f / n) + 0.001f);
+		g = fz_clampi(g, 2, 256);
+		for (count = 1, i = 0; i < n; i++)
+			count *= g;
+
+		id = begin_object(ctx, w, OBJ_COLORSPACE);
+		put_int(ctx, w, CS_KIND_SAMPLED);
+		put(ctx, w, cs->name, sizeof cs->name);
+		put_int(ctx, w, n);
+		put_int(ctx, w, g);
+		for (i = 0; i < count; i++)
+		{
+			for (t = i, k = 0; k < n; k++, t /= g)
+				src[k] = (float)(t % g) / (g - 1);
+			cs->to_rgb(ctx, cs, src, rgb);
+			put(ctx, w, rgb, sizeof rgb);
+		}
+	}
+
+	return id;
+}
+
+static int
+save_stroke(fz_context *ctx, fz_list_writer *w, fz_stroke_state *stroke)
+{
+	int id = begin_object(ctx, w, OBJ_STROKE);
+	put_int(ctx, w, stroke->start_cap);
+	put_int(ctx, w, stroke->dash_cap);
+	put_int(ctx, w, stroke->end_cap);
+	put_int(ctx, w, stroke->linejoin);
+	put_float(ctx, w, stroke->linewidth);
+	put_float(ctx, w, stroke->miterlimit);
+	put_float(ctx, w, stroke->dash_phase);
+	put_int(ctx, w, stroke->dash_len);
+	put(ctx, w, stroke->dash_list, stroke->dash_len * sizeof(float));
+	return id;
+}
+
+static int
+save_font(fz_context *ctx, fz_list_writer *w, fz_font *font)
+{
+	int lists[256];
+	int id, i;
+
+	if (font->t3lists)
+	{
+		/* Type 3 glyphs are kept as the display lists they were
+		 * drawn into, as there is no document to run them from. */
+		for (i = 0; i < 256; i++)
+		{
+			if (font->t3procs && font->t3procs[i] && !font->t3lists[i])
+				fz_prepare_t3_glyph(ctx, font, i, 0);
+			lists[i] = save_object(ctx, w, OBJ_LIST, font->t3lists[i]);
+		}
+
+		id = begin_object(ctx, w, OBJ_FONT);
+		put_int(ctx, w, FONT_KIND_TYPE3);
+		put(ctx, w, font->name, sizeof font->name);
+		put(ctx, w, &font->flags, sizeof font->flags);
+		put(ctx, w, &font->t3matrix, sizeof font->t3matrix);
+		put(ctx, w, &font->bbox, sizeof font->bbox);
+		put(ctx, w, font->t3widths, 256 * sizeof(float));
+		put(ctx, w, font->t3flags, 256 * sizeof(unsigned short));
+		put_align(ctx, w, 4);
+		put_int(ctx, w, font->bbox_table != NULL);
+		if (font->bbox_table)
+			put(ctx, w, font->bbox_table, 256 * sizeof(fz_rect));
+		put(ctx, w, lists, sizeof lists);
+	}
+	else if (font->ft_face && font->buffer)
+	{
+		id = begin_object(ctx, w, OBJ_FONT);
+		put_int(ctx, w, FONT_KIND_FREETYPE);
+		put(ctx, w, font->name, sizeof font->name);
+		put(ctx, w, &font->flags, sizeof font->flags);
+		put(ctx, w, &font->bbox, sizeof font->bbox);
+		put_int(ctx, w, (int)((FT_Face)font->ft_face)->face_index);
+		put_int(ctx, w, font->width_default);
+		put_int(ctx, w, font->width_count);
+		put(ctx, w, font->width_table, font->width_count * sizeof(short));
+		put_align(ctx, w, 4);
+		put_data(ctx, w, font->buffer->data, font->buffer->len);
+	}
+	else
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot save font %s", font->name);
+
+	return id;
+}
+
+static int
+save_text(fz_context *ctx, fz_list_writer *w, fz_text *text)
+{
+	fz_text_span *span;
+	int id, count = 0;
+
+	for (span = text->head; span; span = span->next)
+	{
+		save_object(ctx, w, OBJ_FONT, span->font);
+		count++;
+	}
+
+	id = begin_object(ctx, w, OBJ_TEXT);
+	put_int(ctx, w, count);
+	for (span = text->head; span; span = span->next)
+	{
+		put_int(ctx, w, save_object(ctx, w, OBJ_FONT, span->font));
+		put(ctx, w, &span->trm, 4 * sizeof(float));
+		put_int(ctx, w, span->wmode);
+		put_int(ctx, w, span->bidi_level);
+		put_int(ctx, w, span->markup_dir);
+		put_int(ctx, w, span->language);
+		put_int(ctx, w, span->len);
+		put(ctx, w, span->items, span->len * sizeof(fz_text_item));
+	}
+	return id;
+}
+
+static int
+save_image(fz_context *ctx, fz_list_writer *w, fz_image *image)
+{
+	fz_compressed_buffer *buf = fz_compressed_image_buffer(ctx, image);
+	fz_pixmap *pix = NULL;
+	int mask, cs, id, y;
+
+	mask = save_object(ctx, w, OBJ_IMAGE, image->mask);
+
+	if (buf && buf->buffer)
+	{
+		cs = save_object(ctx, w, OBJ_COLORSPACE, image->colorspace);
+		id = begin_object(ctx, w, OBJ_IMAGE);
+		put_int(ctx, w, IMAGE_KIND_COMPRESSED);
+		put_int(ctx, w, image->w);
+		put_int(ctx, w, image->h);
+		put_int(ctx, w, image->bpc);
+		put_int(ctx, w, cs);
+		put_int(ctx, w, image->xres);
+		put_int(ctx, w, image->yres);
+		put_int(ctx, w, image->interpolate);
+		put_int(ctx, w, image->imagemask);
+		put_int(ctx, w, image->invert_cmyk_jpeg);
+		put_int(ctx, w, image->use_colorkey);
+		put(ctx, w, image->colorkey, sizeof image->colorkey);
+		put(ctx, w, image->decode, sizeof image->decode);
+		put_int(ctx, w, mask);
+		put(ctx, w, &buf->params, sizeof buf->params);
+		put_data(ctx, w, buf->buffer->data, buf->buffer->len);
+		return id;
+	}
+
+	fz_var(pix);
+
+	fz_try(ctx)
+	{
+		pix = fz_get_pixmap_from_image(ctx, image, NULL, NULL, NULL, NULL);
+		cs = save_object(ctx, w, OBJ_COLORSPACE, pix->colorspace);
+		id = begin_object(ctx, w, OBJ_IMAGE);
+		put_int(ctx, w, IMAGE_KIND_PIXMAP);
+		put_int(ctx, w, pix->w);
+		put_int(ctx, w, pix->h);
+		put_int(ctx, w, pix->n);
+		put_int(ctx, w, pix->alpha);
+		put_int(ctx, w, cs);
+		put_int(ctx, w, pix->xres);
+		put_int(ctx, w, pix->yres);
+		put_int(ctx, w, image->interpolate);
+		put_int(ctx, w, image->imagemask);
+		put_int(ctx, w, mask);
+		for (y = 0; y < pix->h; y++)
+			put(ctx, w, pix->samples + y * pix->stride, (size_t)pix->w * pix->n);
+	}
+	fz_always(ctx)
+		fz_drop_pixmap(ctx, pix);
+	fz_catch(ctx)
+		fz_rethrow(ctx);
+
+	return id;
+}
+
+static int
+save_shade(fz_context *ctx, fz_list_writer *w, fz_shade *shade)
+{
+	int cs, id, i, n;
+
+	cs = save_object(ctx, w, OBJ_COLORSPACE, shade->colorspace);
+	n = fz_colorspace_n(ctx, shade->colorspace);
+
+	id = begin_object(ctx, w, OBJ_SHADE);
+	put_int(ctx, w, shade->type);
+	put(ctx, w, &shade->bbox, sizeof shade->bbox);
+	put_int(ctx, w, cs);
+	put(ctx, w, &shade->matrix, sizeof shade->matrix);
+	put_int(ctx, w, shade->use_background);
+	put(ctx, w, shade->background, sizeof shade->background);
+	put_int(ctx, w, shade->use_function);
+	if (shade->use_function)
+		for (i = 0; i < 256; i++)
+			put(ctx, w, shade->function[i], (n + 1) * sizeof(float));
+
+	switch (shade->type)
+	{
+	case FZ_FUNCTION_BASED:
+		put(ctx, w, &shade->u.f.matrix, sizeof shade->u.f.matrix);
+		put_int(ctx, w, shade->u.f.xdivs);
+		put_int(ctx, w, shade->u.f.ydivs);
+		put(ctx, w, shade->u.f.domain, sizeof shade->u.f.domain);
+		put(ctx, w, shade->u.f.fn_vals, (size_t)(shade->u.f.xdivs + 1) * (shade->u.f.ydivs + 1) * n * sizeof(float));
+		break;
+	case FZ_LINEAR:
+	case FZ_RADIAL:
+		put(ctx, w, &shade->u.l_or_r, sizeof shade->u.l_or_r);
+		break;
+	default:
+		put(ctx, w, &shade->u.m, sizeof shade->u.m);
+		break;
+	}
+
+	put_int(ctx, w, shade->buffer && shade->buffer->buffer);
+	if (shade->buffer && shade->buffer->buffer)
+	{
+		put(ctx, w, &shade->buffer->params, sizeof shade->buffer->params);
+		put_data(ctx, w, shade->buffer->buffer->data, shade->buffer->buffer->len);
+	}
+
+	return id;
+}
+
+/* The room a path found by find_node_slots has in its node. */
+#define PATH_SPACE ((n.size - s.path) * sizeof(fz_display_node))
+
+/* Write out the nodes of a list in three passes: first the objects
+ * they refer to, then the data of their open paths, and last the nodes
+ * themselves, with object numbers in place of pointers and file
+ * offsets in place of the open paths' data. */
+static void
+save_nodes(fz_context *ctx, fz_list_writer *w, fz_display_list *list, int pass, int64_t blobs)
+{
+	fz_display_node tmp[1 << 9];
+	fz_display_node *node = list->list;
+	fz_display_node *node_end = list->list + list->len;
+	fz_node_slots s;
+	int cs_n = 1;
+
+	for (; node != node_end; node += node->size)
+	{
+		fz_display_node n = *node;
+		int type = priv_type(n.cmd);
+
+		find_node_slots(ctx, NULL, node, &cs_n, &s);
+
+		if (pass == 0)
+		{
+			/* Write everything the node uses. */
+			if (s.cs)
+				save_object(ctx, w, OBJ_COLORSPACE, *(fz_colorspace **)&node[s.cs]);
+			if (s.stroke)
+				save_object(ctx, w, OBJ_STROKE, *(fz_stroke_state **)&node[s.stroke]);
+			if (type)
+				save_object(ctx, w, type, *(void **)&node[s.priv]);
+		}
+		else if (pass == 1)
+		{
+			/* Write the data of the open paths. */
+			const float *coords;
+			const unsigned char *cmds;
+			int coord_len, cmd_len;
+
+			if (s.path && fz_packed_path_data((fz_path *)&node[s.path], PATH_SPACE, &coords, &coord_len, &cmds, &cmd_len) > 0)
+			{
+				put(ctx, w, coords, coord_len * sizeof(float));
+				put(ctx, w, cmds, cmd_len);
+				put_align(ctx, w, 4);
+			}
+		}
+		else
+		{
+			/* Write the node itself. */
+			memcpy(tmp, node, n.size * sizeof(fz_display_node));
+			if (s.cs)
+				put_slot(&tmp[s.cs], save_object(ctx, w, OBJ_COLORSPACE, *(fz_colorspace **)&node[s.cs]));
+			if (s.stroke)
+				put_slot(&tmp[s.stroke], save_object(ctx, w, OBJ_STROKE, *(fz_stroke_state **)&node[s.stroke]));
+			if (type)
+				put_slot(&tmp[s.priv], save_object(ctx, w, type, *(void **)&node[s.priv]));
+			else if (n.cmd == FZ_CMD_BEGIN_TILE)
+			{
+				/* Tile ids only mean something to the process
+				 * that made them. */
+				fz_list_tile_data tile;
+				memcpy(&tile, &tmp[s.priv], sizeof tile);
+				tile.id = 0;
+				memcpy(&tmp[s.priv], &tile, sizeof tile);
+			}
+			if (s.path)
+			{
+				const float *coords;
+				const unsigned char *cmds;
+				int coord_len, cmd_len;
+				int64_t coord_off = blobs, cmd_off;
+
+				if (fz_packed_path_data((fz_path *)&node[s.path], PATH_SPACE, &coords, &coord_len, &cmds, &cmd_len) > 0)
+				{
+					cmd_off = coord_off + coord_len * sizeof(float);
+					blobs = (cmd_off + cmd_len + 3) & ~3;
+				}
+				else
+					coord_off = cmd_off = 0;
+				fz_set_packed_path_data((fz_path *)&tmp[s.path], (float *)(intptr_t)coord_off, (unsigned char *)(intptr_t)cmd_off);
+			}
+			put(ctx, w, tmp, n.size * sizeof(fz_display_node));
+		}
+	}
+}
+
+static int
+save_list(fz_context *ctx, fz_list_writer *w, fz_display_list *list)
+{
+	int64_t blobs;
+	int id;
+
+	save_nodes(ctx, w, list, 0, 0);
+
+	put_align(ctx, w, 8);
+	blobs = fz_tell_output(ctx, w->out);
+	save_nodes(ctx, w, list, 1, 0);
+
+	id = begin_object(ctx, w, OBJ_LIST);
+	put(ctx, w, &list->mediabox, sizeof list->mediabox);
+	put_int(ctx, w, list->len);
+	put_align(ctx, w, 8);
+	save_nodes(ctx, w, list, 2, blobs);
+
+	return id;
+}
+
+/* Write an object unless it has been already, and return its number. */
+static int
+save_object(fz_context *ctx, fz_list_writer *w, int type, void *obj)
+{
+	intptr_t id;
+
+	if (obj == NULL)
+		return -1;
+
+	id = (intptr_t)fz_hash_find(ctx, w->ids, &obj);
+	if (id == -1)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot save object that refers to itself");
+	if (id)
+		return (int)id - 1;
+
+	fz_hash_insert(ctx, w->ids, &obj, (void *)(intptr_t)-1);
+	switch (type)
+	{
+	default:
+	case OBJ_COLORSPACE: id = save_colorspace(ctx, w, obj); break;
+	case OBJ_STROKE: id = save_stroke(ctx, w, obj); break;
+	case OBJ_FONT: id = save_font(ctx, w, obj); break;
+	case OBJ_TEXT: id = save_text(ctx, w, obj); break;
+	case OBJ_IMAGE: id = save_image(ctx, w, obj); break;
+	case OBJ_SHADE: id = save_shade(ctx, w, obj); break;
+	case OBJ_LIST: id = save_list(ctx, w, obj); break;
+	}
+	fz_hash_remove(ctx, w->ids, &obj);
+	fz_hash_insert(ctx, w->ids, &obj, (void *)(id + 1));
+
+	return (int)id;
+}
+
+void
+fz_save_display_list(fz_context *ctx, fz_display_list *list, const char *filename)
+{
+	fz_list_writer w = { 0 };
+	int64_t table;
+	int root;
+
+	fz_var(w.out);
+	fz_var(w.ids);
+	fz_var(w.offsets);
+
+	fz_try(ctx)
+	{
+		w.out = fz_new_output_with_path(ctx, filename, 0);
+		w.ids = fz_new_hash_table(ctx, 256, sizeof(void *), -1);
+
+		put(ctx, &w, "MUDL", 4);
+		put_int(ctx, &w, LIST_FILE_VERSION);
+		put_int(ctx, &w, LIST_FILE_BOM);
+		put_int(ctx, &w, sizeof(void *));
+
+		root = save_object(ctx, &w, OBJ_LIST, list);
+
+		put_align(ctx, &w, 8);
+		table = fz_tell_output(ctx, w.out);
+		put(ctx, &w, w.offsets, w.len * sizeof(int64_t));
+		put(ctx, &w, &table, sizeof table);
+		put_int(ctx, &w, w.len);
+		put_int(ctx, &w, root);
+	}
+	fz_always(ctx)
+	{
+		fz_drop_output(ctx, w.out);
+		fz_drop_hash(ctx, w.ids);
+		fz_free(ctx, w.offsets);
+	}
+	fz_catch(ctx)
+	{
+		fz_rethrow(ctx);
+	}
+}
+
+/* Loading */
+
+static const void *
+get(fz_context *ctx, fz_list_reader *r, size_t len)
+{
+	const unsigned char *p;
+	if (len > r->map->len - r->pos)
+		corrupt(ctx);
+	p = r->map->data + r->pos;
+	r->pos += len;
+	return p;
+}
+
+static int
+get_int(fz_context *ctx, fz_list_reader *r)
+{
+	int x;
+	memcpy(&x, get(ctx, r, sizeof x), sizeof x);
+	return x;
+}
+
+static void
+get_copy(fz_context *ctx, fz_list_reader *r, void *dst, size_t len)
+{
+	memcpy(dst, get(ctx, r, len), len);
+}
+
+static void
+get_align(fz_context *ctx, fz_list_reader *r, int align)
+{
+	get(ctx, r, -r->pos & (align - 1));
+}
+
+static const void *
+get_data(fz_context *ctx, fz_list_reader *r, size_t *len)
+{
+	const void *data;
+	int n = get_int(ctx, r);
+	if (n < 0)
+		corrupt(ctx);
+	data = get(ctx, r, n);
+	get_align(ctx, r, 4);
+	*len = n;
+	return data;
+}
+
+static fz_buffer *
+get_buffer(fz_context *ctx, fz_list_reader *r)
+{
+	size_t len;
+	const void *data = get_data(ctx, r, &len);
+	fz_buffer *buf = fz_new_buffer(ctx, len);
+	memcpy(buf->data, data, len);
+	buf->len = len;
+	return buf;
+}
+
+static void *
+find_object(fz_context *ctx, fz_list_reader *r, intptr_t id, int type)
+{
+	if (id == -1)
+		return NULL;
+	if (id < 0 || id >= r->count || r->types[id] != type)
+		corrupt(ctx);
+	return r->objs[id];
+}
+
+static void
+drop_object(fz_context *ctx, int type, void *obj)
+{
+	switch (type)
+	{
+	case OBJ_COLORSPACE: fz_drop_colorspace(ctx, obj); break;
+	case OBJ_STROKE: fz_drop_stroke_state(ctx, obj); break;
+	case OBJ_FONT: fz_drop_font(ctx, obj); break;
+	case OBJ_TEXT: fz_drop_text(ctx, obj); break;
+	case OBJ_IMAGE: fz_drop_image(ctx, obj); break;
+	case OBJ_SHADE: fz_drop_shade(ctx, obj); break;
+	case OBJ_LIST: fz_drop_display_list(ctx, obj); break;
+	}
+}
+
+typedef struct fz_sampled_colorspace_s fz_sampled_colorspace;
+
+struct fz_sampled_colorspace_s
+{
+	int g;
+	float *table;
+};
+
+static void
+sampled_to_rgb(fz_context *ctx, fz_colorspace *cs, const float *src, float *rgb)
+{
+	fz_sampled_colorspace *sampled = cs->data;
+	int idx[FZ_MAX_COLORS];
+	float frac[FZ_MAX_COLORS];
+	int n = cs->n, g = sampled->g;
+	int i, k, c, off, stride;
+	float v, wt;
+
+	for (k = 0; k < n; k++)
+	{
+		v = fz_clamp(src[k], 0, 1) * (g - 1);
+		idx[k] = fz_mini((int)v, g - 2);
+		frac[k] = v - idx[k];
+	}
+
+	/* Interpolate between the corners of the cell we are in. */
+	rgb[0] = rgb[1] = rgb[2] = 0;
+	for (c = 0; c < 1 << n; c++)
+	{
+		wt = 1;
+		off = 0;
+		stride = 1;
+		for (k = 0; k < n; k++)
+		{
+			if (c & (1 << k))
+			{
+				wt *= frac[k];
+				off += (idx[k] + 1) * stride;
+			}
+			else
+			{
+				wt *= 1 - frac[k];
+				off += idx[k] * stride;
+			}
+			stride *= g;
+		}
+		if (wt == 0)
+			continue;
+		for (i = 0; i < 3; i++)
+			rgb[i] += wt * sampled->table[off * 3 + i];
+	}
+}
+
+static void
+free_sampled(fz_context *ctx, fz_colorspace *cs)
+{
+	fz_sampled_colorspace *sampled = cs->data;
+	fz_free(ctx, sampled->table);
+	fz_free(ctx, sampled);
+}
+
+static fz_colorspace *
+load_colorspace(fz_context *ctx, fz_list_reader *r)
+{
+	fz_sampled_colorspace *sampled;
+	fz_colorspace *base;
+	unsigned char *lookup;
+	char name[16];
+	size_t len;
+	const void *data;
+	int high, n, g, i, count;
+
+	switch (get_int(ctx, r))
+	{
+	case CS_KIND_GRAY: return fz_keep_colorspace(ctx, fz_device_gray(ctx));
+	case CS_KIND_RGB: return fz_keep_colorspace(ctx, fz_device_rgb(ctx));
+	case CS_KIND_BGR: return fz_keep_colorspace(ctx, fz_device_bgr(ctx));
+	case CS_KIND_CMYK: return fz_keep_colorspace(ctx, fz_device_cmyk(ctx));
+	case CS_KIND_LAB: return fz_keep_colorspace(ctx, fz_device_lab(ctx));
+
+	case CS_KIND_INDEXED:
+		base = find_object(ctx, r, get_int(ctx, r), OBJ_COLORSPACE);
+		high = get_int(ctx, r);
+		data = get_data(ctx, r, &len);
+		if (!base || high < 0 || high > 255 || len != (size_t)base->n * (high + 1))
+			corrupt(ctx);
+		lookup = fz_malloc(ctx, len);
+		memcpy(lookup, data, len);
+		fz_try(ctx)
+			base = fz_new_indexed_colorspace(ctx, fz_keep_colorspace(ctx, base), high, lookup);
+		fz_catch(ctx)
+		{
+			fz_drop_colorspace(ctx, base);
+			fz_free(ctx, lookup);
+			fz_rethrow(ctx);
+		}
+		return base;
+
+	case CS_KIND_SAMPLED:
+		get_copy(ctx, r, name, sizeof name);
+		name[sizeof name - 1] = 0;
+		n = get_int(ctx, r);
+		g = get_int(ctx, r);
+		if (n < 1 || n > FZ_MAX_COLORS || g < 2 || g > 256)
+			corrupt(ctx);
+		for (count = 1, i = 0; i < n; i++)
+		{
+			count *= g;
+			if (count > MAX_SAMPLED_POINTS)
+				corrupt(ctx);
+		}
+		data = get(ctx, r, count * 3 * sizeof(float));
+		sampled = fz_malloc_struct(ctx, fz_sampled_colorspace);
+		sampled->g = g;
+		fz_try(ctx)
+		{
+			sampled->table = fz_malloc_array(ctx, count * 3, sizeof(float));
+			memcpy(sampled->table, data, count * 3 * sizeof(float));
+			base = fz_new_colorspace(ctx, name, n, sampled_to_rgb, NULL, free_sampled, sampled, sizeof *sampled + count * 3 * sizeof(float));
+		}
+		fz_catch(ctx)
+		{
+			fz_free(ctx, sampled->table);
+			fz_free(ctx, sampled);
+			fz_rethrow(ctx);
+		}
+		return base;
+
+	default:
+		corrupt(ctx);
+		return NULL;
+	}
+}
+
+static fz_stroke_state *
+load_stroke(fz_context *ctx, fz_list_reader *r)
+{
+	fz_stroke_state *stroke;
+	int start_cap, dash_cap, end_cap, linejoin;
+	float linewidth, miterlimit, dash_phase;
+	int dash_len;
+
+	start_cap = get_int(ctx, r);
+	dash_cap = get_int(ctx, r);
+	end_cap = get_int(ctx, r);
+	linejoin = get_int(ctx, r);
+	get_copy(ctx, r, &linewidth, sizeof(float));
+	get_copy(ctx, r, &miterlimit, sizeof(float));
+	get_copy(ctx, r, &dash_phase, sizeof(float));
+	dash_len = get_int(ctx, r);
+	if (start_cap < FZ_LINECAP_BUTT || start_cap > FZ_LINECAP_TRIANGLE ||
+		dash_cap < FZ_LINECAP_BUTT || dash_cap > FZ_LINECAP_TRIANGLE ||
+		end_cap < FZ_LINECAP_BUTT || end_cap > FZ_LINECAP_TRIANGLE ||
+		linejoin < FZ_LINEJOIN_MITER || linejoin > FZ_LINEJOIN_MITER_XPS ||
+		dash_len < 0 || dash_len > (int)((r->map->len - r->pos) / sizeof(float)))
+		corrupt(ctx);
+
+	stroke = fz_new_stroke_state_with_dash_len(ctx, dash_len);
+	stroke->start_cap = start_cap;
+	stroke->dash_cap = dash_cap;
+	stroke->end_cap = end_cap;
+	stroke->linejoin = linejoin;
+	stroke->linewidth = linewidth;
+	stroke->miterlimit = miterlimit;
+	stroke->dash_phase = dash_phase;
+	stroke->dash_len = dash_len;
+	get_copy(ctx, r, stroke->dash_list, dash_len * sizeof(float));
+	return stroke;
+}
+
+static fz_font *
+load_font(fz_context *ctx, fz_list_reader *r)
+{
+	fz_font *font = NULL;
+	fz_buffer *buf = NULL;
+	fz_font_flags_t flags;
+	fz_matrix matrix;
+	fz_rect bbox;
+	char name[32];
+	int kind, index, width_default, width_count, has_table, i;
+
+	kind = get_int(ctx, r);
+	get_copy(ctx, r, name, sizeof name);
+	name[sizeof name - 1] = 0;
+	get_copy(ctx, r, &flags, sizeof flags);
+
+	if (kind == FONT_KIND_TYPE3)
+	{
+		get_copy(ctx, r, &matrix, sizeof matrix);
+		get_copy(ctx, r, &bbox, sizeof bbox);
+		font = fz_new_type3_font(ctx, name, &matrix);
+		fz_try(ctx)
+		{
+			font->flags = flags;
+			font->bbox = bbox;
+			get_copy(ctx, r, font->t3widths, 256 * sizeof(float));
+			get_copy(ctx, r, font->t3flags, 256 * sizeof(unsigned short));
+			get_align(ctx, r, 4);
+			has_table = get_int(ctx, r);
+			if (has_table && font->bbox_table)
+				get_copy(ctx, r, font->bbox_table, 256 * sizeof(fz_rect));
+			else if (has_table)
+				get(ctx, r, 256 * sizeof(fz_rect));
+			for (i = 0; i < 256; i++)
+			{
+				font->t3lists[i] = fz_keep_display_list(ctx, find_object(ctx, r, get_int(ctx, r), OBJ_LIST));
+				/* Without the document we can only draw glyphs
+				 * through the cache. */
+				font->t3flags[i] &= ~FZ_DEVFLAG_UNCACHEABLE;
+			}
+		}
+		fz_catch(ctx)
+		{
+			fz_drop_font(ctx, font);
+			fz_rethrow(ctx);
+		}
+		return font;
+	}
+
+	if (kind != FONT_KIND_FREETYPE)
+		corrupt(ctx);
+
+	get_copy(ctx, r, &bbox, sizeof bbox);
+	index = get_int(ctx, r);
+	width_default = get_int(ctx, r);
+	width_count = get_int(ctx, r);
+	if (width_count < 0 || width_count > 65536)
+		corrupt(ctx);
+
+	fz_var(font);
+	fz_var(buf);
+
+	fz_try(ctx)
+	{
+		const void *widths = get(ctx, r, width_count * sizeof(short));
+		get_align(ctx, r, 4);
+		buf = get_buffer(ctx, r);
+		font = fz_new_font_from_buffer(ctx, name, buf, index, flags.use_glyph_bbox);
+		font->flags = flags;
+		font->bbox = bbox;
+		if (width_count > 0)
+		{
+			font->width_table = fz_malloc_array(ctx, width_count, sizeof(short));
+			memcpy(font->width_table, widths, width_count * sizeof(short));
+			font->width_count = width_count;
+		}
+		font->width_default = width_default;
+	}
+	fz_always(ctx)
+		fz_drop_buffer(ctx, buf);
+	fz_catch(ctx)
+	{
+		fz_drop_font(ctx, font);
+		fz_rethrow(ctx);
+	}
+	return font;
+}
+
+static fz_text *
+load_text(fz_context *ctx, fz_list_reader *r)
+{
+	fz_text *text;
+	fz_text_item item;
+	fz_matrix trm;
+	fz_font *font;
+	int count, i, k, len, wmode, bidi_level, markup_dir, language;
+
+	count = get_int(ctx, r);
+	if (count < 0)
+		corrupt(ctx);
+
+	text = fz_new_text(ctx);
+	fz_try(ctx)
+	{
+		for (i = 0; i < count; i++)
+		{
+			font = find_object(ctx, r, get_int(ctx, r), OBJ_FONT);
+			get_copy(ctx, r, &trm, 4 * sizeof(float));
+			wmode = get_int(ctx, r);
+			bidi_level = get_int(ctx, r);
+			markup_dir = get_int(ctx, r);
+			language = get_int(ctx, r);
+			len = get_int(ctx, r);
+			if (!font || len < 0)
+				corrupt(ctx);
+			for (k = 0; k < len; k++)
+			{
+				get_copy(ctx, r, &item, sizeof item);
+				trm.e = item.x;
+				trm.f = item.y;
+				fz_show_glyph(ctx, text, font, &trm, item.gid, item.ucs, wmode, bidi_level, markup_dir, language);
+			}
+		}
+	}
+	fz_catch(ctx)
+	{
+		fz_drop_text(ctx, text);
+		fz_rethrow(ctx);
+	}
+	return text;
+}
+
+static fz_image *
+load_image(fz_context *ctx, fz_list_reader *r)
+{
+	fz_compressed_buffer *buf;
+	fz_pixmap *pix;
+	fz_image *image = NULL;
+	fz_image *mask;
+	fz_colorspace *cs;
+	int w, h, bpc, n, alpha, xres, yres, interpolate, imagemask, invert, use_colorkey, y;
+	int colorkey[FZ_MAX_COLORS * 2];
+	float decode[FZ_MAX_COLORS * 2];
+	fz_compression_params params;
+
+	if (get_int(ctx, r) == IMAGE_KIND_COMPRESSED)
+	{
+		w = get_int(ctx, r);
+		h = get_int(ctx, r);
+		bpc = get_int(ctx, r);
+		cs = find_object(ctx, r, get_int(ctx, r), OBJ_COLORSPACE);
+		xres = get_int(ctx, r);
+		yres = get_int(ctx, r);
+		interpolate = get_int(ctx, r);
+		imagemask = get_int(ctx, r);
+		invert = get_int(ctx, r);
+		use_colorkey = get_int(ctx, r);
+		get_copy(ctx, r, colorkey, sizeof colorkey);
+		get_copy(ctx, r, decode, sizeof decode);
+		mask = find_object(ctx, r, get_int(ctx, r), OBJ_IMAGE);
+		get_copy(ctx, r, &params, sizeof params);
+		if (w <= 0 || h <= 0 || bpc < 1 || bpc > 16 ||
+			params.type <= FZ_IMAGE_UNKNOWN || params.type > FZ_IMAGE_TIFF ||
+			(mask && mask->mask))
+			corrupt(ctx);
+
+		buf = fz_malloc_struct(ctx, fz_compressed_buffer);
+		buf->params = params;
+		fz_try(ctx)
+			buf->buffer = get_buffer(ctx, r);
+		fz_catch(ctx)
+		{
+			fz_free(ctx, buf);
+			fz_rethrow(ctx);
+		}
+
+		image = fz_new_image_from_compressed_buffer(ctx, w, h, bpc, cs, xres, yres,
+				interpolate, imagemask, decode, use_colorkey ? colorkey : NULL,
+				buf, fz_keep_image(ctx, mask));
+		image->invert_cmyk_jpeg = invert;
+		return image;
+	}
+
+	w = get_int(ctx, r);
+	h = get_int(ctx, r);
+	n = get_int(ctx, r);
+	alpha = get_int(ctx, r);
+	cs = find_object(ctx, r, get_int(ctx, r), OBJ_COLORSPACE);
+	xres = get_int(ctx, r);
+	yres = get_int(ctx, r);
+	interpolate = get_int(ctx, r);
+	imagemask = get_int(ctx, r);
+	mask = find_object(ctx, r, get_int(ctx, r), OBJ_IMAGE);
+	if (w <= 0 || h <= 0 || (alpha != 0 && alpha != 1) ||
+		n != fz_colorspace_n(ctx, cs) + alpha ||
+		(size_t)w * n > (r->map->len - r->pos) / h ||
+		(mask && mask->mask))
+		corrupt(ctx);
+
+	pix = fz_new_pixmap(ctx, cs, w, h, alpha);
+	fz_try(ctx)
+	{
+		pix->xres = xres;
+		pix->yres = yres;
+		for (y = 0; y < h; y++)
+			get_copy(ctx, r, pix->samples + y * pix->stride, (size_t)w * n);
+		image = fz_new_image_from_pixmap(ctx, pix, fz_keep_image(ctx, mask));
+		image->interpolate = interpolate;
+		image->imagemask = imagemask;
+	}
+	fz_always(ctx)
+		fz_drop_pixmap(ctx, pix);
+	fz_catch(ctx)
+		fz_rethrow(ctx);
+	return image;
+}
+
+static fz_shade *
+load_shade(fz_context *ctx, fz_list_reader *r)
+{
+	fz_shade *shade;
+	int type, n, i, count;
+
+	type = get_int(ctx, r);
+	if (type < FZ_FUNCTION_BASED || type > FZ_MESH_TYPE7)
+		corrupt(ctx);
+
+	shade = fz_malloc_struct(ctx, fz_shade);
+	FZ_INIT_STORABLE(shade, 1, fz_drop_shade_imp);
+	shade->type = type;
+	fz_try(ctx)
+	{
+		get_copy(ctx, r, &shade->bbox, sizeof shade->bbox);
+		shade->colorspace = fz_keep_colorspace(ctx, find_object(ctx, r, get_int(ctx, r), OBJ_COLORSPACE));
+		if (!shade->colorspace)
+			corrupt(ctx);
+		n = fz_colorspace_n(ctx, shade->colorspace);
+		get_copy(ctx, r, &shade->matrix, sizeof shade->matrix);
+		shade->use_background = get_int(ctx, r);
+		get_copy(ctx, r, shade->background, sizeof shade->background);
+		shade->use_function = get_int(ctx, r);
+		if (shade->use_function)
+			for (i = 0; i < 256; i++)
+				get_copy(ctx, r, shade->function[i], (n + 1) * sizeof(float));
+
+		switch (type)
+		{
+		case FZ_FUNCTION_BASED:
+			get_copy(ctx, r, &shade->u.f.matrix, sizeof shade->u.f.matrix);
+			shade->u.f.xdivs = get_int(ctx, r);
+			shade->u.f.ydivs = get_int(ctx, r);
+			get_copy(ctx, r, shade->u.f.domain, sizeof shade->u.f.domain);
+			if (shade->u.f.xdivs < 1 || shade->u.f.xdivs > 1024 || shade->u.f.ydivs < 1 || shade->u.f.ydivs > 1024)
+				corrupt(ctx);
+			count = (shade->u.f.xdivs + 1) * (shade->u.f.ydivs + 1) * n;
+			shade->u.f.fn_vals = fz_malloc_array(ctx, count, sizeof(float));
+			get_copy(ctx, r, shade->u.f.fn_vals, count * sizeof(float));
+			break;
+		case FZ_LINEAR:
+		case FZ_RADIAL:
+			get_copy(ctx, r, &shade->u.l_or_r, sizeof shade->u.l_or_r);
+			break;
+		default:
+			get_copy(ctx, r, &shade->u.m, sizeof shade->u.m);
+			if ((type == FZ_MESH_TYPE5 && shade->u.m.vprow < 2) ||
+				shade->u.m.bpflag < 0 || shade->u.m.bpflag > 32 ||
+				shade->u.m.bpcoord < 1 || shade->u.m.bpcoord > 32 ||
+				shade->u.m.bpcomp < 1 || shade->u.m.bpcomp > 32)
+				corrupt(ctx);
+			break;
+		}
+
+		if (get_int(ctx, r))
+		{
+			shade->buffer = fz_malloc_struct(ctx, fz_compressed_buffer);
+			get_copy(ctx, r, &shade->buffer->params, sizeof shade->buffer->params);
+			shade->buffer->buffer = get_buffer(ctx, r);
+		}
+	}
+	fz_catch(ctx)
+	{
+		fz_drop_shade(ctx, shade);
+		fz_rethrow(ctx);
+	}
+	return shade;
+}
+
+/* Check that the nodes of a list are sound: that they fit, refer to
+ * objects of the right kinds, have a path, stroke state and colorspace
+ * in force when they need one, and open and close clips, masks, groups
+ * and tiles in a sensible order, so that no device can be led astray
+ * by a corrupt file. */
+static void
+check_nodes(fz_context *ctx, fz_list_reader *r, fz_display_node *node, fz_display_node *node_end)
+{
+	unsigned char *data = r->map->data;
+	unsigned char *stack = NULL;
+	int depth = 0, max = 0;
+	int have_path = 0, have_stroke = 0;
+	fz_node_slots s;
+	int cs_n = 1;
+
+	fz_var(stack);
+
+	fz_try(ctx)
+	{
+		for (; node != node_end; node += node->size)
+		{
+			fz_display_node n = *node;
+			int type = priv_type(n.cmd);
+			int open = 0, close = 0;
+
+			if (n.size == 0 || n.size > node_end - node || n.cmd > FZ_CMD_RENDER_FLAGS)
+				corrupt(ctx);
+
+			find_node_slots(ctx, r, node, &cs_n, &s);
+
+			if (s.cs && !find_object(ctx, r, get_slot(&node[s.cs]), OBJ_COLORSPACE))
+				corrupt(ctx);
+			if (s.stroke)
+				have_stroke = !!find_object(ctx, r, get_slot(&node[s.stroke]), OBJ_STROKE);
+			if (type && !find_object(ctx, r, get_slot(&node[s.priv]), type))
+				corrupt(ctx);
+			if (s.path)
+			{
+				const float *coords;
+				const unsigned char *cmds;
+				int coord_len, cmd_len;
+				size_t coord_off, cmd_off;
+
+				if (fz_packed_path_data((fz_path *)&node[s.path], PATH_SPACE, &coords, &coord_len, &cmds, &cmd_len) > 0)
+				{
+					/* The data of an open path lies between the
+					 * end of the previous object and this one. */
+					coord_off = (size_t)(intptr_t)coords;
+					cmd_off = (size_t)(intptr_t)cmds;
+					if (coord_len < 0 || cmd_len < 0 || (coord_off & 3) ||
+						coord_off < r->prev_end || coord_off > r->obj_start ||
+						(size_t)coord_len > (r->obj_start - coord_off) / sizeof(float) ||
+						cmd_off < r->prev_end || cmd_off > r->obj_start ||
+						(size_t)cmd_len > r->obj_start - cmd_off ||
+						!fz_path_data_is_valid(data + cmd_off, cmd_len, coord_len))
+						corrupt(ctx);
+				}
+				have_path = 1;
+			}
+
+			switch (n.cmd)
+			{
+			case FZ_CMD_STROKE_PATH:
+			case FZ_CMD_CLIP_STROKE_PATH:
+				if (!have_stroke)
+					corrupt(ctx);
+				/* fallthrough */
+			case FZ_CMD_FILL_PATH:
+			case FZ_CMD_CLIP_PATH:
+				if (!have_path)
+					corrupt(ctx);
+				break;
+			case FZ_CMD_STROKE_TEXT:
+			case FZ_CMD_CLIP_STROKE_TEXT:
+				if (!have_stroke)
+					corrupt(ctx);
+				break;
+			}
+
+			switch (n.cmd)
+			{
+			case FZ_CMD_CLIP_PATH:
+			case FZ_CMD_CLIP_STROKE_PATH:
+			case FZ_CMD_CLIP_TEXT:
+			case FZ_CMD_CLIP_STROKE_TEXT:
+			case FZ_CMD_CLIP_IMAGE_MASK:
+				open = FZ_CMD_POP_CLIP;
+				break;
+			case FZ_CMD_BEGIN_MASK:
+				open = FZ_CMD_END_MASK;
+				break;
+			case FZ_CMD_BEGIN_GROUP:
+				open = FZ_CMD_END_GROUP;
+				break;
+			case FZ_CMD_BEGIN_TILE:
+				open = FZ_CMD_END_TILE;
+				break;
+			case FZ_CMD_POP_CLIP:
+			case FZ_CMD_END_MASK:
+			case FZ_CMD_END_GROUP:
+			case FZ_CMD_END_TILE:
+				close = n.cmd;
+				break;
+			}
+
+			/* Devices cope with closing more than was opened, but
+			 * not with closing something other than what was. */
+			if (close && depth > 0)
+			{
+				if (stack[depth - 1] != close)
+					corrupt(ctx);
+				if (close == FZ_CMD_END_MASK)
+					stack[depth - 1] = FZ_CMD_POP_CLIP;
+				else
+					depth--;
+			}
+			else if (close == FZ_CMD_END_MASK)
+				corrupt(ctx);
+			if (open)
+			{
+				if (depth == max)
+				{
+					max = max ? max * 2 : 32;
+					stack = fz_resize_array(ctx, stack, max, 1);
+				}
+				stack[depth++] = open;
+			}
+		}
+	}
+	fz_always(ctx)
+		fz_free(ctx, stack);
+	fz_catch(ctx)
+		fz_rethrow(ctx);
+}
+
+/* Replace the object numbers in the (checked) nodes of a list with the
+ * objects, and point the open paths at their data. */
+static void
+patch_nodes(fz_context *ctx, fz_list_reader *r, fz_display_node *node, fz_display_node *node_end)
+{
+	unsigned char *data = r->map->data;
+	fz_node_slots s;
+	int cs_n = 1;
+
+	for (; node != node_end; node += node->size)
+	{
+		fz_display_node n = *node;
+		int type = priv_type(n.cmd);
+
+		find_node_slots(ctx, r, node, &cs_n, &s);
+
+		if (s.cs)
+			put_slot_ptr(&node[s.cs], fz_keep_colorspace(ctx, find_object(ctx, r, get_slot(&node[s.cs]), OBJ_COLORSPACE)));
+		if (s.stroke)
+			put_slot_ptr(&node[s.stroke], fz_keep_stroke_state(ctx, find_object(ctx, r, get_slot(&node[s.stroke]), OBJ_STROKE)));
+		switch (type)
+		{
+		case OBJ_TEXT:
+			put_slot_ptr(&node[s.priv], fz_keep_text(ctx, find_object(ctx, r, get_slot(&node[s.priv]), type)));
+			break;
+		case OBJ_SHADE:
+			put_slot_ptr(&node[s.priv], fz_keep_shade(ctx, find_object(ctx, r, get_slot(&node[s.priv]), type)));
+			break;
+		case OBJ_IMAGE:
+			put_slot_ptr(&node[s.priv], fz_keep_image(ctx, find_object(ctx, r, get_slot(&node[s.priv]), type)));
+			break;
+		}
+		if (s.path)
+		{
+			const float *coords;
+			const unsigned char *cmds;
+			int coord_len, cmd_len;
+			fz_path *path = (fz_path *)&node[s.path];
+
+			if (fz_packed_path_data(path, PATH_SPACE, &coords, &coord_len, &cmds, &cmd_len) > 0)
+				fz_set_packed_path_data(path, (float *)(data + (intptr_t)coords), data + (intptr_t)cmds);
+			else
+				fz_set_packed_path_data(path, NULL, NULL);
+		}
+	}
+}
+
+static fz_display_list *
+load_list(fz_context *ctx, fz_list_reader *r)
+{
+	fz_display_list *list;
+	fz_display_node *nodes;
+	fz_rect mediabox;
+	int len;
+
+	get_copy(ctx, r, &mediabox, sizeof mediabox);
+	len = get_int(ctx, r);
+	get_align(ctx, r, 8);
+	if (len < 0 || (size_t)len > (r->map->len - r->pos) / sizeof(fz_display_node))
+		corrupt(ctx);
+	nodes = (fz_display_node *)(r->map->data + r->pos);
+	r->pos += len * sizeof(fz_display_node);
+
+	check_nodes(ctx, r, nodes, nodes + len);
+
+	list = fz_new_display_list(ctx, &mediabox);
+	list->map = fz_keep_display_map(ctx, r->map);
+	list->list = nodes;
+	list->len = len;
+	list->max = len;
+	patch_nodes(ctx, r, nodes, nodes + len);
+
+	fz_index_display_list(ctx, list);
+
+	return list;
+}
+
+static fz_display_map *
+map_display_list(fz_context *ctx, const char *filename)
+{
+	fz_display_map *map = fz_malloc_struct(ctx, fz_display_map);
+	map->refs = 1;
+
+#ifdef HAVE_MMAP
+	{
+		struct stat info;
+		void *data = MAP_FAILED;
+		int fd = open(filename, O_RDONLY);
+
+		if (fd >= 0 && fstat(fd, &info) == 0 && info.st_size > 0 && (uint64_t)info.st_size <= SIZE_MAX)
+			/* The pages we patch become our own; the rest stay
+			 * shared with everyone else who maps the file. */
+			data = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+		if (fd >= 0)
+			close(fd);
+		if (data != MAP_FAILED)
+		{
+			map->data = data;
+			map->len = (size_t)info.st_size;
+			return map;
+		}
+	}
+#endif
+
+	fz_try(ctx)
+		map->buffer = fz_read_file(ctx, filename);
+	fz_catch(ctx)
+	{
+		fz_free(ctx, map);
+		fz_rethrow(ctx);
+	}
+	map->data = map->buffer->data;
+	map->len = map->buffer->len;
+	return map;
+}
+
+fz_display_list *
+fz_load_display_list_mapped(fz_context *ctx, const char *filename)
+{
+	fz_display_list *list = NULL;
+	fz_list_reader r = { 0 };
+	int64_t table, offset;
+	int count, root, type, i;
+	void *obj;
+
+	r.map = map_display_list(ctx, filename);
+
+	fz_var(r.types);
+	fz_var(r.objs);
+	fz_var(r.count);
+
+	fz_try(ctx)
+	{
+		if (r.map->len < LIST_FILE_HEADER + LIST_FILE_TRAILER || memcmp(r.map->data, "MUDL", 4))
+			fz_throw(ctx, FZ_ERROR_GENERIC, "not a display list file");
+		r.pos = 4;
+		if (get_int(ctx, &r) != LIST_FILE_VERSION)
+			fz_throw(ctx, FZ_ERROR_GENERIC, "unsupported display list file version");
+		if (get_int(ctx, &r) != LIST_FILE_BOM || get_int(ctx, &r) != sizeof(void *))
+			fz_throw(ctx, FZ_ERROR_GENERIC, "display list file was written by a different kind of machine");
+
+		r.pos = r.map->len - LIST_FILE_TRAILER;
+		get_copy(ctx, &r, &table, sizeof table);
+		count = get_int(ctx, &r);
+		root = get_int(ctx, &r);
+		if (count < 1 || root < 0 || root >= count || table < LIST_FILE_HEADER ||
+			(uint64_t)table > r.map->len - LIST_FILE_TRAILER ||
+			(uint64_t)count > (r.map->len - LIST_FILE_TRAILER - table) / sizeof(int64_t))
+			corrupt(ctx);
+
+		r.types = fz_malloc_array(ctx, count, sizeof(int));
+		r.objs = fz_malloc_array(ctx, count, sizeof(void *));
+		r.prev_end = LIST_FILE_HEADER;
+
+		for (i = 0; i < count; i++)
+		{
+			memcpy(&offset, r.map->data + table + i * sizeof(int64_t), sizeof offset);
+			/* Objects must not overlap, as their nodes are patched
+			 * in place. */
+			if (offset < (int64_t)r.prev_end || offset > table || (offset & 7))
+				corrupt(ctx);
+			r.obj_start = r.pos = (size_t)offset;
+			type = get_int(ctx, &r);
+			switch (type)
+			{
+			case OBJ_COLORSPACE: obj = load_colorspace(ctx, &r); break;
+			case OBJ_STROKE: obj = load_stroke(ctx, &r); break;
+			case OBJ_FONT: obj = load_font(ctx, &r); break;
+			case OBJ_TEXT: obj = load_text(ctx, &r); break;
+			case OBJ_IMAGE: obj = load_image(ctx, &r); break;
+			case OBJ_SHADE: obj = load_shade(ctx, &r); break;
+			case OBJ_LIST: obj = load_list(ctx, &r); break;
+			default: corrupt(ctx); obj = NULL; break;
+			}
+			r.types[i] = type;
+			r.objs[i] = obj;
+			r.count = i + 1;
+			if (r.pos > (size_t)table)
+				corrupt(ctx);
+			r.prev_end = r.pos;
+		}
+
+		list = fz_keep_display_list(ctx, find_object(ctx, &r, root, OBJ_LIST));
+		if (!list)
+			corrupt(ctx);
+	}
+	fz_always(ctx)
+	{
+		for (i = 0; i < r.count; i++)
+			drop_object(ctx, r.types[i], r.objs[i]);
+		fz_free(ctx, r.types);
+		fz_free(ctx, r.objs);
+		fz_drop_display_map(ctx, r.map);
+	}
+	fz_catch(ctx)
+	{
+		fz_rethrow(ctx);
+	}
+
+	return list;
+}
@@ -0,0 +1,184 @@
+#ifndef MUPDF_FITZ_LIST_IMP_H
+#define MUPDF_FITZ_LIST_IMP_H
+
+typedef struct fz_display_node_s fz_display_node;
+
+typedef enum fz_display_command_e
+{
+	FZ_CMD_FILL_PATH,
+	FZ_CMD_STROKE_PATH,
+	FZ_CMD_CLIP_PATH,
+	FZ_CMD_CLIP_STROKE_PATH,
+	FZ_CMD_FILL_TEXT,
+	FZ_CMD_STROKE_TEXT,
+	FZ_CMD_CLIP_TEXT,
+	FZ_CMD_CLIP_STROKE_TEXT,
+	FZ_CMD_IGNORE_TEXT,
+	FZ_CMD_FILL_SHADE,
+	FZ_CMD_FILL_IMAGE,
+	FZ_CMD_FILL_IMAGE_MASK,
+	FZ_CMD_CLIP_IMAGE_MASK,
+	FZ_CMD_POP_CLIP,
+	FZ_CMD_BEGIN_MASK,
+	FZ_CMD_END_MASK,
+	FZ_CMD_BEGIN_GROUP,
+	FZ_CMD_END_GROUP,
+	FZ_CMD_BEGIN_TILE,
+	FZ_CMD_END_TILE,
+	FZ_CMD_RENDER_FLAGS
+} fz_display_command;
+
+/* The display list is a list of nodes.
+ * Each node is a structure consisting of a bitfield (that packs into a
+ * 32 bit word).
+ * The different fields in the bitfield identify what information is
+ * present in the node.
+ *
+ *	cmd:	What type of node this is.
+ *
+ *	size:	The number of sizeof(fz_display_node) bytes that this nodes
+ *		data occupies. (i.e. &node[node->size] = the next node in the
+ *		chain; 0 for end of list).
+ *
+ *	rect:	0 for unchanged, 1 for present.
+ *
+ *	path:	0 for unchanged, 1 for present.
+ *
+ *	cs:	0 for unchanged
+ *		1 for devicegray (color defaults to 0)
+ *		2 for devicegray (color defaults to 1)
+ *		3 for devicergb (color defaults to 0,0,0)
+ *		4 for devicergb (color defaults to 1,1,1)
+ *		5 for devicecmyk (color defaults to 0,0,0,0)
+ *		6 for devicecmyk (color defaults to 0,0,0,1)
+ *		7 for present (color defaults to 0)
+ *
+ *	color:	0 for unchanged color, 1 for present.
+ *
+ *	alpha:	0 for unchanged, 1 for solid, 2 for transparent, 3
+ *		for alpha value present.
+ *
+ *	ctm:	0 for unchanged,
+ *		1 for change ad
+ *		2 for change bc
+ *		4 for change ef.
+ *
+ *	stroke:	0 for unchanged, 1 for present.
+ *
+ *	flags:	Flags (node specific meanings)
+ *
+ * Nodes are packed in the order:
+ * header, rect, colorspace, color, alpha, ctm, stroke_state, path, private data.
+ */
+struct fz_display_node_s
+{
+	unsigned int cmd    : 5;
+	unsigned int size   : 9;
+	unsigned int rect   : 1;
+	unsigned int path   : 1;
+	unsigned int cs     : 3;
+	unsigned int color  : 1;
+	unsigned int alpha  : 2;
+	unsigned int ctm    : 3;
+	unsigned int stroke : 1;
+	unsigned int flags  : 6;
+};
+
+enum {
+	CS_UNCHANGED = 0,
+	CS_GRAY_0    = 1,
+	CS_GRAY_1    = 2,
+	CS_RGB_0     = 3,
+	CS_RGB_1     = 4,
+	CS_CMYK_0    = 5,
+	CS_CMYK_1    = 6,
+	CS_OTHER_0   = 7,
+
+	ALPHA_UNCHANGED = 0,
+	ALPHA_1         = 1,
+	ALPHA_0         = 2,
+	ALPHA_PRESENT   = 3,
+
+	CTM_UNCHANGED = 0,
+	CTM_CHANGE_AD = 1,
+	CTM_CHANGE_BC = 2,
+	CTM_CHANGE_EF = 4,
+
+	MAX_NODE_SIZE = (1<<9)-sizeof(fz_display_node)
+};
+
+/* When a list device is closed, the top level of the list is cut into
+ * spans, each of which is drawn or culled as a whole: either a single
+ * node, or a node that opens a clip, mask, group or tile together with
+ * everything up to the node that closes it. The replay loop culls such
+ * a span on its first node alone, so a span that misses the scissor can
+ * be skipped without looking at any of its nodes.
+ *
+ * As the graphics state is delta encoded, each span records the state
+ * in force at its start (as offsets of the nodes that set it), so that
+ * replay can begin there. The spans are then sorted along a Hilbert
+ * curve and packed into an R-tree, which fz_run_display_list queries
+ * to find the spans that may touch its scissor.
+ */
+typedef struct fz_display_span_s fz_display_span;
+typedef struct fz_display_index_s fz_display_index;
+typedef struct fz_display_map_s fz_display_map;
+
+struct fz_display_span_s
+{
+	fz_rect rect;
+	int start;
+	int always;
+	int cs, cs_off, color_off;
+	int stroke_off, path_off;
+	float alpha;
+	fz_matrix ctm;
+};
+
+#define INDEX_FANOUT 16
+#define INDEX_MIN_SPANS 32
+#define INDEX_MAX_LEVELS 16
+
+struct fz_display_index_s
+{
+	int len;
+	fz_display_span *spans;
+	int *order;
+	int levels;
+	int level_start[INDEX_MAX_LEVELS];
+	int level_len[INDEX_MAX_LEVELS];
+	fz_rect *boxes;
+};
+
+struct fz_display_list_s
+{
+	fz_storable storable;
+	fz_display_node *list;
+	fz_rect mediabox;
+	int max;
+	int len;
+	fz_display_index *index;
+	fz_display_map *map;
+};
+
+#define SIZE_IN_NODES(t) \
+	((t + sizeof(fz_display_node) - 1) / sizeof(fz_display_node))
+
+typedef struct fz_list_tile_data_s fz_list_tile_data;
+
+struct fz_list_tile_data_s
+{
+	float xstep;
+	float ystep;
+	fz_rect view;
+	int id;
+};
+
+void fz_index_display_list(fz_context *ctx, fz_display_list *list);
+
+/* A file that display lists have been loaded from, shared by every
+ * list whose nodes live in it. */
+fz_display_map *fz_keep_display_map(fz_context *ctx, fz_display_map *map);
+void fz_drop_display_map(fz_context *ctx, fz_display_map *map);
+
+#endif
@@ -0,0 +1,1071 @@
+#include "mupdf/fitz.h"
+#include "list-imp.h"
+
+/*
+	Display list optimisation.
+
+	The list is run through a device that records every command with
+	its graphics state unpacked. The commands are then examined as a
+	whole, and those that survive are run into a new list device,
+	whose nodes take the place of the old ones.
+
+	Marks covered by a later opaque rectangle are dropped first, then
+	clips, groups and tiles that are left with nothing in them, then
+	rectangular clips that contain everything drawn within them. Last
+	of all, runs of fills that only differ in their paths are merged.
+*/
+
+#define MAX_OCCLUDERS 32
+#define MAX_MERGE 64
+
+typedef struct fz_opt_cmd_s fz_opt_cmd;
+typedef struct fz_opt_device_s fz_opt_device;
+
+struct fz_opt_cmd_s
+{
+	fz_display_command cmd;
+	int flags; /* even_odd, luminosity or tile id */
+	int drop;
+	int open, close; /* the other ends of a scope */
+	fz_rect rect; /* bounds of a mark, scissor of a clip, area of a group, mask or tile */
+	fz_matrix ctm;
+	fz_path *path;
+	fz_stroke_state *stroke;
+	fz_text *text;
+	fz_shade *shade;
+	fz_image *image;
+	fz_colorspace *colorspace;
+	float color[FZ_MAX_COLORS];
+	float alpha;
+	int isolated, knockout, blendmode;
+	fz_rect view;
+	float xstep, ystep;
+	int set, clear;
+};
+
+struct fz_opt_device_s
+{
+	fz_device super;
+	int len, cap;
+	fz_opt_cmd *cmds;
+};
+
+static void
+copy_moveto(fz_context *ctx, void *arg, float x, float y)
+{
+	fz_moveto(ctx, arg, x, y);
+}
+
+static void
+copy_lineto(fz_context *ctx, void *arg, float x, float y)
+{
+	fz_lineto(ctx, arg, x, y);
+}
+
+static void
+copy_curveto(fz_context *ctx, void *arg, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+	fz_curveto(ctx, arg, x1, y1, x2, y2, x3, y3);
+}
+
+static void
+copy_closepath(fz_context *ctx, void *arg)
+{
+	fz_closepath(ctx, arg);
+}
+
+static void
+copy_quadto(fz_context *ctx, void *arg, float x1, float y1, float x2, float y2)
+{
+	fz_quadto(ctx, arg, x1, y1, x2, y2);
+}
+
+static void
+copy_curvetov(fz_context *ctx, void *arg, float x2, float y2, float x3, float y3)
+{
+	fz_curvetov(ctx, arg, x2, y2, x3, y3);
+}
+
+static void
+copy_curvetoy(fz_context *ctx, void *arg, float x1, float y1, float x3, float y3)
+{
+	fz_curvetoy(ctx, arg, x1, y1, x3, y3);
+}
+
+static void
+copy_rectto(fz_context *ctx, void *arg, float x1, float y1, float x2, float y2)
+{
+	fz_rectto(ctx, arg, x1, y1, x2, y2);
+}
+
+static const fz_path_walker copy_walker =
+{
+	copy_moveto,
+	copy_lineto,
+	copy_curveto,
+	copy_closepath,
+	copy_quadto,
+	copy_curvetov,
+	copy_curvetoy,
+	copy_rectto
+};
+
+/* The paths of a list are packed, and the list device can only pack
+ * a path that is not; so take a copy. */
+static fz_path *
+copy_path(fz_context *ctx, const fz_path *path)
+{
+	fz_path *copy = fz_new_path(ctx);
+	fz_try(ctx)
+		fz_walk_path(ctx, path, &copy_walker, copy);
+	fz_catch(ctx)
+	{
+		fz_drop_path(ctx, copy);
+		fz_rethrow(ctx);
+	}
+	return copy;
+}
+
+static fz_opt_cmd *
+fz_opt_new_cmd(fz_context *ctx, fz_device *dev_, fz_display_command cmd, const fz_matrix *ctm,
+	fz_colorspace *colorspace, const float *color, float alpha)
+{
+	fz_opt_device *dev = (fz_opt_device *)dev_;
+	fz_opt_cmd *c;
+
+	if (dev->len == dev->cap)
+	{
+		int cap = dev->cap ? dev->cap * 2 : 256;
+		dev->cmds = fz_resize_array(ctx, dev->cmds, cap, sizeof(fz_opt_cmd));
+		dev->cap = cap;
+	}
+	c = &dev->cmds[dev->len++];
+	memset(c, 0, sizeof(fz_opt_cmd));
+	c->cmd = cmd;
+	c->open = c->close = -1;
+	c->ctm = ctm ? *ctm : fz_identity;
+	c->alpha = alpha;
+	if (colorspace)
+	{
+		c->colorspace = fz_keep_colorspace(ctx, colorspace);
+		if (color)
+			memcpy(c->color, color, fz_colorspace_n(ctx, colorspace) * sizeof(float));
+	}
+	return c;
+}
+
+static void
+fz_opt_fill_path(fz_context *ctx, fz_device *dev, const fz_path *path, int even_odd, const fz_matrix *ctm,
+	fz_colorspace *colorspace, const float *color, float alpha)
+{
+	fz_rect rect;
+	fz_opt_cmd *c;
+
+	fz_bound_path(ctx, path, NULL, ctm, &rect);
+	c = fz_opt_new_cmd(ctx, dev, FZ_CMD_FILL_PATH, ctm, colorspace, color, alpha);
+	c->flags = even_odd;
+	c->rect = rect;
+	c->path = copy_path(ctx, path);
+}
+
+static void
+fz_opt_stroke_path(fz_context *ctx, fz_device *dev, const fz_path *path, const fz_stroke_state *stroke,
+	const fz_matrix *ctm, fz_colorspace *colorspace, const float *color, float alpha)
+{
+	fz_rect rect;
+	fz_opt_cmd *c;
+
+	fz_bound_path(ctx, path, stroke, ctm, &rect);
+	c = fz_opt_new_cmd(ctx, dev, FZ_CMD_STROKE_PATH, ctm, colorspace, color, alpha);
+	c->rect = rect;
+	c->path = copy_path(ctx, path);
+	c->stroke = fz_keep_stroke_state(ctx, stroke);
+}
+
+static void
+fz_opt_clip_path(fz_context *ctx, fz_device *dev, const fz_path *path, int even_odd, const fz_matrix *ctm, const fz_rect *scissor)
+{
+	fz_rect rect;
+	fz_opt_cmd *c;
+
+	fz_bound_path(ctx, path, NULL, ctm, &rect);
+	if (scissor)
+		fz_intersect_rect(&rect, scissor);
+	c = fz_opt_new_cmd(ctx, dev, FZ_CMD_CLIP_PATH, ctm, NULL, NULL, 1);
+	c->flags = even_odd;
+	c->rect = rect;
+	c->path = copy_path(ctx, path);
+}
+
+static void
+fz_opt_clip_stroke_path(fz_context *ctx, fz_device *dev, const fz_path *path, const fz_stroke_state *stroke, const fz_matrix *ctm, const fz_rect *scissor)
+{
+	fz_rect rect;
+	fz_opt_cmd *c;
+
+	fz_bound_path(ctx, path, stroke, ctm, &rect);
+	if (scissor)
+		fz_intersect_rect(&rect, scissor);
+	c = fz_opt_new_cmd(ctx, dev, FZ_CMD_CLIP_STROKE_PATH, ctm, NULL, NULL, 1);
+	c->rect = rect;
+	c->path = copy_path(ctx, path);
+	c->stroke = fz_keep_stroke_state(ctx, stroke);
+}
+
+static void
+fz_opt_text(fz_context *ctx, fz_device *dev, fz_display_command cmd, const fz_text *text, const fz_stroke_state *stroke,
+	const fz_matrix *ctm, fz_colorspace *colorspace, const float *color, float alpha, const fz_rect *scissor)
+{
+	fz_rect rect;
+	fz_opt_cmd *c;
+
+	fz_bound_text(ctx, text, stroke, ctm, &rect);
+	if (scissor)
+		fz_intersect_rect(&rect, scissor);
+	c = fz_opt_new_cmd(ctx, dev, cmd, ctm, colorspace, color, alpha);
+	c->rect = rect;
+	c->text = fz_keep_text(ctx, text);
+	c->stroke = fz_keep_stroke_state(ctx, stroke);
+}
+
+static void
+fz_opt_fill_text(fz_context *ctx, fz_device *dev, const fz_text *text, const fz_matrix *ctm,
+	fz_colorspace *colorspace, const float *color, float alpha)
+{
+	fz_opt_text(ctx, dev, FZ_CMD_FILL_TEXT, text, NULL, ctm, colorspace, color, alpha, NULL);
+}
+
+static void
+fz_opt_stroke_text(fz_context *ctx, fz_device *dev, const fz_text *text, const fz_stroke_state *stroke, const fz_matrix *ctm,
+	fz_colorspace *colorspace, const float *color, float alpha)
+{
+	fz_opt_text(ctx, dev, FZ_CMD_STROKE_TEXT, text, stroke, ctm, colorspace, color, alpha, NULL);
+}
+
+static void
+fz_opt_clip_text(fz_context *ctx, fz_device *dev, const fz_text *text, const fz_matrix *ctm, const fz_rect *scissor)
+{
+	fz_opt_text(ctx, dev, FZ_CMD_CLIP_TEXT, text, NULL, ctm, NULL, NULL, 1, scissor);
+}
+
+static void
+fz_opt_clip_stroke_text(fz_context *ctx, fz_device *dev, const fz_text *text, const fz_stroke_state *stroke, const fz_matrix *ctm, const fz_rect *scissor)
+{
+	fz_opt_text(ctx, dev, FZ_CMD_CLIP_STROKE_TEXT, text, stroke, ctm, NULL, NULL, 1, scissor);
+}
+
+static void
+fz_opt_ignore_text(fz_context *ctx, fz_device *dev, const fz_text *text, const fz_matrix *ctm)
+{
+	fz_opt_text(ctx, dev, FZ_CMD_IGNORE_TEXT, text, NULL, ctm, NULL, NULL, 1, NULL);
+}
+
+static void
+fz_opt_fill_shade(fz_context *ctx, fz_device *dev, fz_shade *shade, const fz_matrix *ctm, float alpha)
+{
+	fz_rect rect;
+	fz_opt_cmd *c;
+
+	fz_bound_shade(ctx, shade, ctm, &rect);
+	c = fz_opt_new_cmd(ctx, dev, FZ_CMD_FILL_SHADE, ctm, NULL, NULL, alpha);
+	c->rect = rect;
+	c->shade = fz_keep_shade(ctx, shade);
+}
+
+static void
+fz_opt_image(fz_context *ctx, fz_device *dev, fz_display_command cmd, fz_image *image, const fz_matrix *ctm,
+	fz_colorspace *colorspace, const float *color, float alpha, const fz_rect *scissor)
+{
+	fz_rect rect = fz_unit_rect;
+	fz_opt_cmd *c;
+
+	fz_transform_rect(&rect, ctm);
+	if (scissor)
+		fz_intersect_rect(&rect, scissor);
+	c = fz_opt_new_cmd(ctx, dev, cmd, ctm, colorspace, color, alpha);
+	c->rect = rect;
+	c->image = fz_keep_image(ctx, image);
+}
+
+static void
+fz_opt_fill_image(fz_context *ctx, fz_device *dev, fz_image *image, const fz_matrix *ctm, float alpha)
+{
+	fz_opt_image(ctx, dev, FZ_CMD_FILL_IMAGE, image, ctm, NULL, NULL, alpha, NULL);
+}
+
+static void
+fz_opt_fill_image_mask(fz_context *ctx, fz_device *dev, fz_image *image, const fz_matrix *ctm,
+	fz_colorspace *colorspace, const float *color, float alpha)
+{
+	fz_opt_image(ctx, dev, FZ_CMD_FILL_IMAGE_MASK, image, ctm, colorspace, color, alpha, NULL);
+}
+
+static void
+fz_opt_clip_image_mask(fz_context *ctx, fz_device *dev, fz_image *image, const fz_matrix *ctm, const fz_rect *scissor)
+{
+	fz_opt_image(ctx, dev, FZ_CMD_CLIP_IMAGE_MASK, image, ctm, NULL, NULL, 1, scissor);
+}
+
+static void
+fz_opt_pop_clip(fz_context *ctx, fz_device *dev)
+{
+	fz_opt_new_cmd(ctx, dev, FZ_CMD_POP_CLIP, NULL, NULL, NULL, 1);
+}
+
+static void
+fz_opt_begin_mask(fz_context *ctx, fz_device *dev, const fz_rect *rect, int luminosity, fz_colorspace *colorspace, const float *color)
+{
+	fz_opt_cmd *c = fz_opt_new_cmd(ctx, dev, FZ_CMD_BEGIN_MASK, NULL, colorspace, color, 1);
+	c->flags = luminosity;
+	c->rect = *rect;
+}
+
+static void
+fz_opt_end_mask(fz_context *ctx, fz_device *dev)
+{
+	fz_opt_new_cmd(ctx, dev, FZ_CMD_END_MASK, NULL, NULL, NULL, 1);
+}
+
+static void
+fz_opt_begin_group(fz_context *ctx, fz_device *dev, const fz_rect *rect, int isolated, int knockout, int blendmode, float alpha)
+{
+	fz_opt_cmd *c = fz_opt_new_cmd(ctx, dev, FZ_CMD_BEGIN_GROUP, NULL, NULL, NULL, alpha);
+	c->rect = *rect;
+	c->isolated = isolated;
+	c->knockout = knockout;
+	c->blendmode = blendmode;
+}
+
+static void
+fz_opt_end_group(fz_context *ctx, fz_device *dev)
+{
+	fz_opt_new_cmd(ctx, dev, FZ_CMD_END_GROUP, NULL, NULL, NULL, 1);
+}
+
+static int
+fz_opt_begin_tile(fz_context *ctx, fz_device *dev, const fz_rect *area, const fz_rect *view, float xstep, float ystep, const fz_matrix *ctm, int id)
+{
+	fz_opt_cmd *c = fz_opt_new_cmd(ctx, dev, FZ_CMD_BEGIN_TILE, ctm, NULL, NULL, 1);
+	c->flags = id;
+	c->rect = *area;
+	c->view = *view;
+	c->xstep = xstep;
+	c->ystep = ystep;
+	return 0;
+}
+
+static void
+fz_opt_end_tile(fz_context *ctx, fz_device *dev)
+{
+	fz_opt_new_cmd(ctx, dev, FZ_CMD_END_TILE, NULL, NULL, NULL, 1);
+}
+
+static void
+fz_opt_render_flags(fz_context *ctx, fz_device *dev, int set, int clear)
+{
+	fz_opt_cmd *c = fz_opt_new_cmd(ctx, dev, FZ_CMD_RENDER_FLAGS, NULL, NULL, NULL, 1);
+	c->set = set;
+	c->clear = clear;
+}
+
+static void
+fz_opt_drop_device(fz_context *ctx, fz_device *dev_)
+{
+	fz_opt_device *dev = (fz_opt_device *)dev_;
+	int i;
+
+	for (i = 0; i < dev->len; i++)
+	{
+		fz_opt_cmd *c = &dev->cmds[i];
+		fz_drop_path(ctx, c->path);
+		fz_drop_stroke_state(ctx, c->stroke);
+		fz_drop_text(ctx, c->text);
+		fz_drop_shade(ctx, c->shade);
+		fz_drop_image(ctx, c->image);
+		fz_drop_colorspace(ctx, c->colorspace);
+	}
+	fz_free(ctx, dev->cmds);
+}
+
+static fz_opt_device *
+fz_new_opt_device(fz_context *ctx)
+{
+	fz_opt_device *dev = fz_new_device(ctx, sizeof(fz_opt_device));
+
+	dev->super.fill_path = fz_opt_fill_path;
+	dev->super.stroke_path = fz_opt_stroke_path;
+	dev->super.clip_path = fz_opt_clip_path;
+	dev->super.clip_stroke_path = fz_opt_clip_stroke_path;
+
+	dev->super.fill_text = fz_opt_fill_text;
+	dev->super.stroke_text = fz_opt_stroke_text;
+	dev->super.clip_text = fz_opt_clip_text;
+	dev->super.clip_stroke_text = fz_opt_clip_stroke_text;
+	dev->super.ignore_text = fz_opt_ignore_text;
+
+	dev->super.fill_shade = fz_opt_fill_shade;
+	dev->super.fill_image = fz_opt_fill_image;
+	dev->super.fill_image_mask = fz_opt_fill_image_mask;
+	dev->super.clip_image_mask = fz_opt_clip_image_mask;
+
+	dev->super.pop_clip = fz_opt_pop_clip;
+
+	dev->super.begin_mask = fz_opt_begin_mask;
+	dev->super.end_mask = fz_opt_end_mask;
+	dev->super.begin_group = fz_opt_begin_group;
+	dev->super.end_group = fz_opt_end_group;
+
+	dev->super.begin_tile = fz_opt_begin_tile;
+	dev->super.end_tile = fz_opt_end_tile;
+
+	dev->super.render_flags = fz_opt_render_flags;
+
+	dev->super.drop_device = fz_opt_drop_device;
+
+	return dev;
+}
+
+static int
+is_mark(fz_display_command cmd)
+{
+	switch (cmd)
+	{
+	case FZ_CMD_FILL_PATH:
+	case FZ_CMD_STROKE_PATH:
+	case FZ_CMD_FILL_TEXT:
+	case FZ_CMD_STROKE_TEXT:
+	case FZ_CMD_FILL_SHADE:
+	case FZ_CMD_FILL_IMAGE:
+	case FZ_CMD_FILL_IMAGE_MASK:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static int
+is_clip(fz_display_command cmd)
+{
+	switch (cmd)
+	{
+	case FZ_CMD_CLIP_PATH:
+	case FZ_CMD_CLIP_STROKE_PATH:
+	case FZ_CMD_CLIP_TEXT:
+	case FZ_CMD_CLIP_STROKE_TEXT:
+	case FZ_CMD_CLIP_IMAGE_MASK:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+/* Pair up the commands that open and close each scope. An END_MASK
+ * closes the mask definition and opens the clip that the POP_CLIP
+ * closes. Returns 0 if the list is not properly nested. */
+static int
+match_scopes(fz_context *ctx, fz_opt_cmd *cmds, int len)
+{
+	int *stack = fz_malloc_array(ctx, len + 1, sizeof(int));
+	int i, top = 0, ok = 1;
+
+	for (i = 0; i < len && ok; i++)
+	{
+		fz_opt_cmd *c = &cmds[i];
+		fz_display_command want;
+
+		switch (c->cmd)
+		{
+		case FZ_CMD_CLIP_PATH:
+		case FZ_CMD_CLIP_STROKE_PATH:
+		case FZ_CMD_CLIP_TEXT:
+		case FZ_CMD_CLIP_STROKE_TEXT:
+		case FZ_CMD_CLIP_IMAGE_MASK:
+		case FZ_CMD_BEGIN_MASK:
+		case FZ_CMD_BEGIN_GROUP:
+		case FZ_CMD_BEGIN_TILE:
+			stack[top++] = i;
+			continue;
+		case FZ_CMD_END_MASK:
+			want = FZ_CMD_BEGIN_MASK;
+			break;
+		case FZ_CMD_END_GROUP:
+			want = FZ_CMD_BEGIN_GROUP;
+			break;
+		case FZ_CMD_END_TILE:
+			want = FZ_CMD_BEGIN_TILE;
+			break;
+		case FZ_CMD_POP_CLIP:
+			if (top > 0 && (is_clip(cmds[stack[top-1]].cmd) || cmds[stack[top-1]].cmd == FZ_CMD_END_MASK))
+				want = cmds[stack[top-1]].cmd;
+			else
+				want = FZ_CMD_CLIP_PATH;
+			break;
+		default:
+			continue;
+		}
+
+		if (top == 0 || cmds[stack[top-1]].cmd != want)
+			ok = 0;
+		else
+		{
+			c->open = stack[top-1];
+			cmds[c->open].close = i;
+			if (c->cmd == FZ_CMD_END_MASK)
+				stack[top-1] = i;
+			else
+				top--;
+		}
+	}
+
+	fz_free(ctx, stack);
+	return ok && top == 0;
+}
+
+typedef struct
+{
+	int n, bad;
+	fz_point p[5];
+} fz_rect_walker;
+
+static void
+rect_moveto(fz_context *ctx, void *arg, float x, float y)
+{
+	fz_rect_walker *w = arg;
+	if (w->n > 0)
+		w->bad = 1;
+	else
+	{
+		w->p[0].x = x;
+		w->p[0].y = y;
+		w->n = 1;
+	}
+}
+
+static void
+rect_lineto(fz_context *ctx, void *arg, float x, float y)
+{
+	fz_rect_walker *w = arg;
+	if (w->n == 0 || w->n == nelem(w->p))
+		w->bad = 1;
+	else
+	{
+		w->p[w->n].x = x;
+		w->p[w->n].y = y;
+		w->n++;
+	}
+}
+
+static void
+rect_curveto(fz_context *ctx, void *arg, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+	fz_rect_walker *w = arg;
+	w->bad = 1;
+}
+
+static void
+rect_closepath(fz_context *ctx, void *arg)
+{
+}
+
+static const fz_path_walker rect_walker =
+{
+	rect_moveto,
+	rect_lineto,
+	rect_curveto,
+	rect_closepath
+};
+
+/* Check whether a command's path, under its ctm, is a rectangle with
+ * its sides parallel to the axes, and if so find it. */
+static int
+path_is_rect(fz_context *ctx, fz_opt_cmd *c, fz_rect *rect)
+{
+	fz_rect_walker w = { 0 };
+	fz_point *p = w.p;
+	int i;
+
+	fz_walk_path(ctx, c->path, &rect_walker, &w);
+	if (w.bad)
+		return 0;
+	if (w.n == 5 && p[4].x == p[0].x && p[4].y == p[0].y)
+		w.n = 4;
+	if (w.n != 4)
+		return 0;
+
+	for (i = 0; i < 4; i++)
+		fz_transform_point(&p[i], &c->ctm);
+	if (!(p[0].x == p[1].x && p[1].y == p[2].y && p[2].x == p[3].x && p[3].y == p[0].y) &&
+		!(p[0].y == p[1].y && p[1].x == p[2].x && p[2].y == p[3].y && p[3].x == p[0].x))
+		return 0;
+
+	rect->x0 = fz_min(p[0].x, p[2].x);
+	rect->y0 = fz_min(p[0].y, p[2].y);
+	rect->x1 = fz_max(p[0].x, p[2].x);
+	rect->y1 = fz_max(p[0].y, p[2].y);
+	return 1;
+}
+
+/* Unlike fz_contains_rect, never takes an infinite or NaN rectangle
+ * to be inside another. */
+static int
+rect_inside(const fz_rect *a, const fz_rect *outer)
+{
+	if (fz_is_infinite_rect(a))
+		return 0;
+	return outer->x0 <= a->x0 && outer->y0 <= a->y0 && outer->x1 >= a->x1 && outer->y1 >= a->y1;
+}
+
+static void
+add_bounds(fz_rect *bounds, const fz_rect *r)
+{
+	if (r->x0 != r->x0 || r->y0 != r->y0 || r->x1 != r->x1 || r->y1 != r->y1)
+		*bounds = fz_infinite_rect;
+	else
+		fz_union_rect(bounds, r);
+}
+
+static void
+drop_range(fz_opt_cmd *cmds, int a, int b)
+{
+	for (; a <= b; a++)
+		cmds[a].drop = 1;
+}
+
+/* Walk the list backwards, collecting opaque rectangles, and drop the
+ * marks that lie entirely beneath one. A rectangle
+ * only covers what comes before it at the same level or deeper: those
+ * marks have been composited by the time it is drawn. Contents of a
+ * mask are drawn into a buffer of their own, so nothing from outside
+ * reaches into them. */
+static void
+cull_covered(fz_context *ctx, fz_opt_cmd *cmds, int len)
+{
+	fz_rect occ[MAX_OCCLUDERS];
+	int occ_level[MAX_OCCLUDERS];
+	int *visible;
+	int nocc = 0, level = 0;
+	int i, k;
+
+	visible = fz_malloc_array(ctx, len + 1, sizeof(int));
+	visible[0] = 0;
+
+	for (i = len - 1; i >= 0; i--)
+	{
+		fz_opt_cmd *c = &cmds[i];
+		fz_rect *r = &c->rect;
+		fz_rect rect;
+		int covered = 0;
+
+		if (is_mark(c->cmd))
+		{
+			for (k = nocc - 1; k >= 0 && occ_level[k] >= visible[level] && !covered; k--)
+				covered = rect_inside(r, &occ[k]);
+		}
+
+		switch (c->cmd)
+		{
+		case FZ_CMD_END_TILE:
+			/* Tile contents are in pattern space; leave them alone.
+			 * Whole cells are drawn, so the tile as a whole is not
+			 * bounded by its area either. */
+			i = c->open;
+			break;
+		case FZ_CMD_POP_CLIP:
+		case FZ_CMD_END_GROUP:
+			level++;
+			visible[level] = visible[level-1];
+			break;
+		case FZ_CMD_END_MASK:
+			level++;
+			visible[level] = level;
+			break;
+		case FZ_CMD_BEGIN_MASK:
+			level--;
+			/* fallthrough */
+		case FZ_CMD_CLIP_PATH:
+		case FZ_CMD_CLIP_STROKE_PATH:
+		case FZ_CMD_CLIP_TEXT:
+		case FZ_CMD_CLIP_STROKE_TEXT:
+		case FZ_CMD_CLIP_IMAGE_MASK:
+		case FZ_CMD_BEGIN_GROUP:
+			level--;
+			while (nocc > 0 && occ_level[nocc-1] > level)
+				nocc--;
+			break;
+		default:
+			if (!is_mark(c->cmd))
+				break;
+			if (covered)
+			{
+				c->drop = 1;
+				break;
+			}
+			if (c->cmd != FZ_CMD_FILL_PATH || c->alpha != 1 || !path_is_rect(ctx, c, &rect))
+				break;
+			if (nocc == MAX_OCCLUDERS)
+			{
+				/* Forget the oldest; it is the most likely to
+				 * have been passed already. */
+				memmove(occ, occ + 1, (nocc - 1) * sizeof(fz_rect));
+				memmove(occ_level, occ_level + 1, (nocc - 1) * sizeof(int));
+				nocc--;
+			}
+			occ[nocc] = rect;
+			occ_level[nocc] = level;
+			nocc++;
+			break;
+		}
+	}
+
+	fz_free(ctx, visible);
+}
+
+/* Drop clips, groups and tiles with no content. The definition of a
+ * mask is not content; a mask with nothing drawn through it goes,
+ * definition and all. */
+static void
+cull_empty(fz_context *ctx, fz_opt_cmd *cmds, int len)
+{
+	int *open = fz_malloc_array(ctx, len + 1, sizeof(int));
+	int *full = fz_malloc_array(ctx, len + 1, sizeof(int));
+	int i, top = 0;
+
+	for (i = 0; i < len; i++)
+	{
+		fz_opt_cmd *c = &cmds[i];
+
+		if (c->drop)
+			continue;
+		switch (c->cmd)
+		{
+		case FZ_CMD_CLIP_PATH:
+		case FZ_CMD_CLIP_STROKE_PATH:
+		case FZ_CMD_CLIP_TEXT:
+		case FZ_CMD_CLIP_STROKE_TEXT:
+		case FZ_CMD_CLIP_IMAGE_MASK:
+		case FZ_CMD_BEGIN_MASK:
+		case FZ_CMD_BEGIN_GROUP:
+		case FZ_CMD_BEGIN_TILE:
+			open[top] = i;
+			full[top] = 0;
+			top++;
+			break;
+		case FZ_CMD_END_MASK:
+			full[top-1] = 0;
+			break;
+		case FZ_CMD_POP_CLIP:
+		case FZ_CMD_END_GROUP:
+		case FZ_CMD_END_TILE:
+			top--;
+			if (!full[top])
+				drop_range(cmds, open[top], i);
+			else if (top > 0)
+				full[top-1] = 1;
+			break;
+		default:
+			if (top > 0)
+				full[top-1] = 1;
+			break;
+		}
+	}
+
+	fz_free(ctx, open);
+	fz_free(ctx, full);
+}
+
+/* Drop rectangular clips that contain everything drawn through them.
+ * Nothing outside the mediabox of the list is visible, so that is
+ * taken off first (except within tiles). */
+static void
+cull_clips(fz_context *ctx, fz_opt_cmd *cmds, int len, const fz_rect *mediabox)
+{
+	fz_rect *bounds = fz_malloc_array(ctx, len + 1, sizeof(fz_rect));
+	int i, top = 0, tiled = 0;
+
+	for (i = 0; i < len; i++)
+	{
+		fz_opt_cmd *c = &cmds[i];
+		fz_opt_cmd *o;
+		fz_rect b, rect;
+
+		if (c->drop)
+			continue;
+		switch (c->cmd)
+		{
+		case FZ_CMD_CLIP_PATH:
+		case FZ_CMD_CLIP_STROKE_PATH:
+		case FZ_CMD_CLIP_TEXT:
+		case FZ_CMD_CLIP_STROKE_TEXT:
+		case FZ_CMD_CLIP_IMAGE_MASK:
+		case FZ_CMD_BEGIN_MASK:
+		case FZ_CMD_BEGIN_GROUP:
+		case FZ_CMD_BEGIN_TILE:
+			tiled += (c->cmd == FZ_CMD_BEGIN_TILE);
+			bounds[top++] = fz_empty_rect;
+			break;
+		case FZ_CMD_POP_CLIP:
+		case FZ_CMD_END_GROUP:
+		case FZ_CMD_END_TILE:
+			b = bounds[--top];
+			o = &cmds[c->open];
+			tiled -= (c->cmd == FZ_CMD_END_TILE);
+			if (o->cmd == FZ_CMD_CLIP_PATH)
+			{
+				/* Tile contents are not in page space. */
+				if (!tiled && !fz_is_empty_rect(mediabox))
+					fz_intersect_rect(&b, mediabox);
+				if (path_is_rect(ctx, o, &rect) && rect_inside(&b, &rect))
+					o->drop = c->drop = 1;
+			}
+			if (o->cmd == FZ_CMD_BEGIN_TILE)
+				b = fz_infinite_rect;
+			else if (is_clip(o->cmd) && !o->drop)
+				fz_intersect_rect(&b, &o->rect);
+			if (top > 0)
+				add_bounds(&bounds[top-1], &b);
+			break;
+		default:
+			if (top > 0 && is_mark(c->cmd))
+				add_bounds(&bounds[top-1], &c->rect);
+			break;
+		}
+	}
+
+	fz_free(ctx, bounds);
+}
+
+static int
+can_merge(fz_context *ctx, fz_opt_cmd *cmds, const int *run, int n, fz_opt_cmd *c)
+{
+	fz_opt_cmd *h = &cmds[run[0]];
+	int i;
+
+	if (c->cmd != FZ_CMD_FILL_PATH || c->flags != h->flags || c->alpha != h->alpha ||
+		c->colorspace != h->colorspace || memcmp(&c->ctm, &h->ctm, sizeof(fz_matrix)))
+		return 0;
+	if (c->colorspace && memcmp(c->color, h->color, fz_colorspace_n(ctx, c->colorspace) * sizeof(float)))
+		return 0;
+	if (fz_is_infinite_rect(&c->rect))
+		return 0;
+
+	/* Where fills overlap, drawing them one after another is not the
+	 * same as drawing them as one. */
+	for (i = 0; i < n; i++)
+	{
+		fz_rect *r = &cmds[run[i]].rect;
+		if (!(fz_max(r->x0, c->rect.x0) >= fz_min(r->x1, c->rect.x1) ||
+			fz_max(r->y0, c->rect.y0) >= fz_min(r->y1, c->rect.y1)))
+			return 0;
+	}
+	return 1;
+}
+
+static void
+merge_run(fz_context *ctx, fz_opt_cmd *cmds, const int *run, int n)
+{
+	fz_opt_cmd *h = &cmds[run[0]];
+	fz_path *path;
+	int i;
+
+	if (n < 2)
+		return;
+
+	path = fz_new_path(ctx);
+	fz_try(ctx)
+	{
+		for (i = 0; i < n; i++)
+			fz_walk_path(ctx, cmds[run[i]].path, &copy_walker, path);
+	}
+	fz_catch(ctx)
+	{
+		fz_drop_path(ctx, path);
+		fz_rethrow(ctx);
+	}
+
+	fz_drop_path(ctx, h->path);
+	h->path = path;
+	for (i = 1; i < n; i++)
+	{
+		fz_union_rect(&h->rect, &cmds[run[i]].rect);
+		cmds[run[i]].drop = 1;
+	}
+}
+
+/* Merge runs of fills that share everything but their paths, as long
+ * as their bounds do not overlap. */
+static void
+merge_fills(fz_context *ctx, fz_opt_cmd *cmds, int len)
+{
+	int run[MAX_MERGE];
+	int i, n = 0;
+
+	for (i = 0; i < len; i++)
+	{
+		fz_opt_cmd *c = &cmds[i];
+
+		if (c->drop)
+			continue;
+		if (n > 0 && n < MAX_MERGE && can_merge(ctx, cmds, run, n, c))
+		{
+			run[n++] = i;
+			continue;
+		}
+		merge_run(ctx, cmds, run, n);
+		n = 0;
+		if (c->cmd == FZ_CMD_FILL_PATH && !fz_is_infinite_rect(&c->rect))
+			run[n++] = i;
+	}
+	merge_run(ctx, cmds, run, n);
+}
+
+static void
+emit_cmd(fz_context *ctx, fz_device *dev, fz_opt_cmd *c)
+{
+	switch (c->cmd)
+	{
+	case FZ_CMD_FILL_PATH:
+		fz_fill_path(ctx, dev, c->path, c->flags, &c->ctm, c->colorspace, c->color, c->alpha);
+		break;
+	case FZ_CMD_STROKE_PATH:
+		fz_stroke_path(ctx, dev, c->path, c->stroke, &c->ctm, c->colorspace, c->color, c->alpha);
+		break;
+	case FZ_CMD_CLIP_PATH:
+		fz_clip_path(ctx, dev, c->path, c->flags, &c->ctm, &c->rect);
+		break;
+	case FZ_CMD_CLIP_STROKE_PATH:
+		fz_clip_stroke_path(ctx, dev, c->path, c->stroke, &c->ctm, &c->rect);
+		break;
+	case FZ_CMD_FILL_TEXT:
+		fz_fill_text(ctx, dev, c->text, &c->ctm, c->colorspace, c->color, c->alpha);
+		break;
+	case FZ_CMD_STROKE_TEXT:
+		fz_stroke_text(ctx, dev, c->text, c->stroke, &c->ctm, c->colorspace, c->color, c->alpha);
+		break;
+	case FZ_CMD_CLIP_TEXT:
+		fz_clip_text(ctx, dev, c->text, &c->ctm, &c->rect);
+		break;
+	case FZ_CMD_CLIP_STROKE_TEXT:
+		fz_clip_stroke_text(ctx, dev, c->text, c->stroke, &c->ctm, &c->rect);
+		break;
+	case FZ_CMD_IGNORE_TEXT:
+		fz_ignore_text(ctx, dev, c->text, &c->ctm);
+		break;
+	case FZ_CMD_FILL_SHADE:
+		fz_fill_shade(ctx, dev, c->shade, &c->ctm, c->alpha);
+		break;
+	case FZ_CMD_FILL_IMAGE:
+		fz_fill_image(ctx, dev, c->image, &c->ctm, c->alpha);
+		break;
+	case FZ_CMD_FILL_IMAGE_MASK:
+		fz_fill_image_mask(ctx, dev, c->image, &c->ctm, c->colorspace, c->color, c->alpha);
+		break;
+	case FZ_CMD_CLIP_IMAGE_MASK:
+		fz_clip_image_mask(ctx, dev, c->image, &c->ctm, &c->rect);
+		break;
+	case FZ_CMD_POP_CLIP:
+		fz_pop_clip(ctx, dev);
+		break;
+	case FZ_CMD_BEGIN_MASK:
+		fz_begin_mask(ctx, dev, &c->rect, c->flags, c->colorspace, c->color);
+		break;
+	case FZ_CMD_END_MASK:
+		fz_end_mask(ctx, dev);
+		break;
+	case FZ_CMD_BEGIN_GROUP:
+		fz_begin_group(ctx, dev, &c->rect, c->isolated, c->knockout, c->blendmode, c->alpha);
+		break;
+	case FZ_CMD_END_GROUP:
+		fz_end_group(ctx, dev);
+		break;
+	case FZ_CMD_BEGIN_TILE:
+		(void)fz_begin_tile_id(ctx, dev, &c->rect, &c->view, c->xstep, c->ystep, &c->ctm, c->flags);
+		break;
+	case FZ_CMD_END_TILE:
+		fz_end_tile(ctx, dev);
+		break;
+	case FZ_CMD_RENDER_FLAGS:
+		fz_render_flags(ctx, dev, c->set, c->clear);
+		break;
+	}
+}
+
+int
+fz_optimize_display_list(fz_context *ctx, fz_display_list *list)
+{
+	fz_opt_device *rec = NULL;
+	fz_display_list *out = NULL;
+	fz_device *dev = NULL;
+	fz_cookie cookie = { 0 };
+	fz_display_node *node;
+	fz_display_list tmp;
+	int i, count = 0, kept = 0, removed = 0;
+
+	for (node = list->list; node != list->list + list->len; node += node->size)
+		count++;
+	if (count == 0)
+		return 0;
+
+	fz_var(rec);
+	fz_var(out);
+	fz_var(dev);
+
+	fz_try(ctx)
+	{
+		rec = fz_new_opt_device(ctx);
+		fz_run_display_list(ctx, list, &rec->super, &fz_identity, NULL, &cookie);
+		fz_close_device(ctx, &rec->super);
+		if (cookie.errors || rec->super.error_depth)
+			fz_throw(ctx, FZ_ERROR_GENERIC, "cannot read display list");
+
+		/* Leave badly nested lists as they are. */
+		if (!match_scopes(ctx, rec->cmds, rec->len))
+			break;
+
+		cull_covered(ctx, rec->cmds, rec->len);
+		cull_empty(ctx, rec->cmds, rec->len);
+		cull_clips(ctx, rec->cmds, rec->len, &list->mediabox);
+		merge_fills(ctx, rec->cmds, rec->len);
+
+		for (i = 0; i < rec->len; i++)
+			kept += !rec->cmds[i].drop;
+		/* Replay has already culled anything with empty bounds. */
+		if (kept == count)
+			break;
+
+		out = fz_new_display_list(ctx, &list->mediabox);
+		dev = fz_new_list_device(ctx, out);
+		for (i = 0; i < rec->len; i++)
+			if (!rec->cmds[i].drop)
+				emit_cmd(ctx, dev, &rec->cmds[i]);
+		fz_close_device(ctx, dev);
+		if (dev->error_depth)
+			fz_throw(ctx, FZ_ERROR_GENERIC, "%s", dev->errmess);
+
+		/* Swap the new nodes into place; the old ones go when the
+		 * new list is dropped. */
+		tmp = *list;
+		list->list = out->list;
+		list->len = out->len;
+		list->max = out->max;
+		list->index = out->index;
+		list->map = out->map;
+		out->list = tmp.list;
+		out->len = tmp.len;
+		out->max = tmp.max;
+		out->index = tmp.index;
+		out->map = tmp.map;
+
+		removed = count - kept;
+	}
+	fz_always(ctx)
+	{
+		fz_drop_device(ctx, dev);
+		fz_drop_display_list(ctx, out);
+		if (rec)
+			fz_drop_device(ctx, &rec->super);
+	}
+	fz_catch(ctx)
+		fz_rethrow(ctx);
+
+	return removed;
+}
@@ -0,0 +1,257 @@
+#include "mupdf/fitz.h"
+#include "thread-imp.h"
+
+/*
+	Parallel rendering of display lists.
+
+	The target pixmap is cut into tiles, and each worker starts out
+	owning an equal run of them. A worker takes tiles from the front
+	of its own run, and when that is empty steals the back half of
+	the run of another. Each worker draws into a pixmap that shares
+	its samples with the target, but only covers the tile, so the
+	workers never touch the same pixels.
+*/
+
+#define TILE_SIZE 256
+
+typedef struct fz_tile_job_s fz_tile_job;
+typedef struct fz_tile_worker_s fz_tile_worker;
+
+struct fz_tile_worker_s
+{
+	fz_tile_job *job;
+	fz_context *ctx;
+	MUTEX lock;
+	int head, tail;
+#ifdef FZ_THREADS
+	THREAD thread;
+	int started;
+#endif
+	int failed;
+};
+
+struct fz_tile_job_s
+{
+	fz_display_list *list;
+	fz_matrix ctm;
+	fz_pixmap *pix;
+	fz_irect bbox;
+	int across, tiles;
+	fz_cookie *cookie;
+	MUTEX lock;
+	int count;
+	fz_tile_worker *workers;
+};
+
+/* Take the next tile from our own run, or failing that steal half
+ * of what is left of someone else's. */
+static int
+next_tile(fz_tile_worker *me)
+{
+	fz_tile_job *job = me->job;
+	int i, head, tail;
+
+	MUTEX_LOCK(me->lock);
+	if (me->head < me->tail)
+	{
+		i = me->head++;
+		MUTEX_UNLOCK(me->lock);
+		return i;
+	}
+	MUTEX_UNLOCK(me->lock);
+
+	for (i = 1; i < job->count; i++)
+	{
+		fz_tile_worker *victim = &job->workers[((me - job->workers) + i) % job->count];
+
+		MUTEX_LOCK(victim->lock);
+		tail = victim->tail;
+		head = victim->tail - (victim->tail - victim->head) / 2;
+		if (head < tail)
+			victim->tail = head;
+		MUTEX_UNLOCK(victim->lock);
+
+		if (head < tail)
+		{
+			MUTEX_LOCK(me->lock);
+			me->head = head + 1;
+			me->tail = tail;
+			MUTEX_UNLOCK(me->lock);
+			return head;
+		}
+	}
+
+	return -1;
+}
+
+static void
+draw_tile(fz_context *ctx, fz_tile_job *job, int tile)
+{
+	fz_pixmap *pix = job->pix;
+	fz_pixmap *dest = NULL;
+	fz_device *dev = NULL;
+	fz_cookie cookie = { 0 };
+	fz_irect bbox;
+	fz_rect area;
+
+	bbox.x0 = job->bbox.x0 + (tile % job->across) * TILE_SIZE;
+	bbox.y0 = job->bbox.y0 + (tile / job->across) * TILE_SIZE;
+	bbox.x1 = fz_mini(bbox.x0 + TILE_SIZE, job->bbox.x1);
+	bbox.y1 = fz_mini(bbox.y0 + TILE_SIZE, job->bbox.y1);
+	fz_rect_from_irect(&area, &bbox);
+
+	if (job->cookie)
+		cookie.incomplete_ok = job->cookie->incomplete_ok;
+
+	fz_var(dest);
+	fz_var(dev);
+
+	fz_try(ctx)
+	{
+		dest = fz_new_pixmap_with_data(ctx, pix->colorspace,
+			bbox.x1 - bbox.x0, bbox.y1 - bbox.y0, pix->alpha, (int)pix->stride,
+			pix->samples + (bbox.y0 - pix->y) * pix->stride + (bbox.x0 - pix->x) * pix->n);
+		dest->x = bbox.x0;
+		dest->y = bbox.y0;
+		dest->xres = pix->xres;
+		dest->yres = pix->yres;
+
+		dev = fz_new_draw_device_with_bbox(ctx, NULL, dest, &bbox);
+		fz_run_display_list(ctx, job->list, dev, &job->ctm, &area, &cookie);
+		fz_close_device(ctx, dev);
+	}
+	fz_always(ctx)
+	{
+		fz_drop_device(ctx, dev);
+		fz_drop_pixmap(ctx, dest);
+	}
+	fz_catch(ctx)
+	{
+		fz_rethrow(ctx);
+	}
+
+	if (job->cookie)
+	{
+		MUTEX_LOCK(job->lock);
+		job->cookie->progress++;
+		job->cookie->errors += cookie.errors;
+		job->cookie->incomplete |= cookie.incomplete;
+		MUTEX_UNLOCK(job->lock);
+	}
+}
+
+static void
+run_worker(fz_tile_worker *me)
+{
+	fz_context *ctx = me->ctx;
+	fz_cookie *cookie = me->job->cookie;
+	int tile;
+
+	while ((tile = next_tile(me)) >= 0)
+	{
+		if (cookie && cookie->abort)
+			break;
+		fz_try(ctx)
+			draw_tile(ctx, me->job, tile);
+		fz_catch(ctx)
+		{
+			me->failed = 1;
+			fz_warn(ctx, "cannot draw tile: %s", fz_caught_message(ctx));
+		}
+	}
+}
+
+#ifdef FZ_THREADS
+static THREAD_RETURN_TYPE
+tile_worker_thread(void *arg)
+{
+	run_worker((fz_tile_worker *)arg);
+	THREAD_RETURN();
+}
+#endif
+
+void
+fz_render_display_list_parallel(fz_context *ctx, fz_display_list *list, const fz_matrix *ctm, fz_pixmap *pix, int nthreads, fz_cookie *cookie)
+{
+	fz_tile_job job = { 0 };
+	int i, failed = 0;
+
+	fz_pixmap_bbox(ctx, pix, &job.bbox);
+	if (fz_is_empty_irect(&job.bbox))
+		return;
+
+	job.list = list;
+	job.ctm = *ctm;
+	job.pix = pix;
+	job.cookie = cookie;
+	job.across = (job.bbox.x1 - job.bbox.x0 + TILE_SIZE - 1) / TILE_SIZE;
+	job.tiles = job.across * ((job.bbox.y1 - job.bbox.y0 + TILE_SIZE - 1) / TILE_SIZE);
+
+#ifndef FZ_THREADS
+	nthreads = 1;
+#endif
+	nthreads = fz_clampi(nthreads, 1, job.tiles);
+
+	if (cookie)
+	{
+		cookie->progress = 0;
+		cookie->progress_max = job.tiles;
+	}
+
+	job.workers = fz_calloc(ctx, nthreads, sizeof(fz_tile_worker));
+	MUTEX_INIT(job.lock);
+
+	/* The calling thread is the first worker. The others each need a
+	 * context of their own; if we cannot clone one (say because there
+	 * are no locking functions) then we make do with fewer. */
+	job.workers[0].ctx = ctx;
+	job.count = 1;
+	while (job.count < nthreads)
+	{
+		fz_context *clone = fz_clone_context(ctx);
+		if (clone == NULL)
+			break;
+		job.workers[job.count++].ctx = clone;
+	}
+
+	for (i = 0; i < job.count; i++)
+	{
+		fz_tile_worker *w = &job.workers[i];
+		w->job = &job;
+		w->head = job.tiles * i / job.count;
+		w->tail = job.tiles * (i + 1) / job.count;
+		MUTEX_INIT(w->lock);
+	}
+
+#ifdef FZ_THREADS
+	for (i = 1; i < job.count; i++)
+	{
+		fz_tile_worker *w = &job.workers[i];
+		/* Any tiles a thread fails to start for are stolen by the
+		 * others. */
+		w->started = !THREAD_INIT(w->thread, tile_worker_thread, w);
+	}
+#endif
+
+	run_worker(&job.workers[0]);
+
+#ifdef FZ_THREADS
+	for (i = 1; i < job.count; i++)
+		if (job.workers[i].started)
+			THREAD_FIN(job.workers[i].thread);
+#endif
+
+	for (i = 0; i < job.count; i++)
+	{
+		fz_tile_worker *w = &job.workers[i];
+		failed |= w->failed;
+		MUTEX_FIN(w->lock);
+		if (i > 0)
+			fz_drop_context(w->ctx);
+	}
+	MUTEX_FIN(job.lock);
+	fz_free(ctx, job.workers);
+
+	if (failed)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot render display list");
+}
@@ -0,0 +1,364 @@
+#include "mupdf/fitz.h"
+#include "thread-imp.h"
+
+/*
+	Prefetching of the images in a display list.
+
+	The list is run once through a device that notes each image drawn
+	within the area, along with the subarea of it that the draw device
+	will ask for. Those are then decoded into the store by a pool of
+	workers, largest first, so that the draw device finds them there
+	rather than decoding them one after another itself.
+
+	Asking for the same (or a larger) subarea at the same transform
+	as the draw device does is what lets it find the tiles: the image
+	code then picks the same subsampling factor, and takes any tile
+	that covers what it is asked for.
+*/
+
+typedef struct prefetch_item_s prefetch_item;
+typedef struct prefetch_worker_s prefetch_worker;
+typedef struct prefetch_job_s prefetch_job;
+
+struct prefetch_item_s
+{
+	fz_image *image;
+	fz_matrix ctm;
+	fz_irect subarea;
+	int whole;
+	size_t size;
+};
+
+struct prefetch_worker_s
+{
+	prefetch_job *job;
+	fz_context *ctx;
+#ifdef FZ_THREADS
+	THREAD thread;
+	int started;
+#endif
+};
+
+struct prefetch_job_s
+{
+	fz_irect area;
+	int len, cap;
+	prefetch_item *items;
+	fz_cookie *cookie;
+	MUTEX lock;
+	int next;
+};
+
+typedef struct fz_prefetch_device_s
+{
+	fz_device super;
+	prefetch_job *job;
+} fz_prefetch_device;
+
+/* Roughly the number of bytes fz_get_pixmap_from_image will decode
+ * the subarea to, going by the subsampling it will choose. */
+static size_t
+estimate_size(fz_image *image, const fz_matrix *ctm, const fz_irect *r)
+{
+	int w = sqrtf(ctm->a * ctm->a + ctm->b * ctm->b);
+	int h = sqrtf(ctm->c * ctm->c + ctm->d * ctm->d);
+	int l2factor = 0;
+
+	while (l2factor < 6 && image->w >> (l2factor + 1) >= w + 2 && image->h >> (l2factor + 1) >= h + 2)
+		l2factor++;
+	return (size_t)(((r->x1 - r->x0) >> l2factor) + 1) * (((r->y1 - r->y0) >> l2factor) + 1) * (image->n + 1);
+}
+
+static void
+prefetch_image(fz_context *ctx, fz_device *dev, fz_image *image, const fz_matrix *ctm, int whole)
+{
+	prefetch_job *job = ((fz_prefetch_device *)dev)->job;
+	prefetch_item *item;
+	fz_irect bbox, src_area;
+	fz_rect rect;
+	fz_matrix inverse;
+
+	/* Images that are already decoded, or that are never cached, have
+	 * nothing to fetch. */
+	if (image->w == 0 || image->h == 0 || image->decoded || image->scalable)
+		return;
+
+	rect = fz_unit_rect;
+	fz_irect_from_rect(&bbox, fz_transform_rect(&rect, ctm));
+	if (fz_is_empty_irect(fz_intersect_irect(&bbox, &job->area)))
+		return;
+
+	src_area.x0 = 0;
+	src_area.y0 = 0;
+	src_area.x1 = image->w;
+	src_area.y1 = image->h;
+
+	/* As fz_draw_fill_image works out the part of the image it needs,
+	 * but from the whole area rather than the clip at the time. */
+	if (!whole && !fz_try_invert_matrix(&inverse, ctm))
+	{
+		float exp;
+		fz_irect sane = src_area;
+
+		fz_post_scale(&inverse, image->w, image->h);
+		exp = fz_matrix_max_expansion(&inverse);
+		fz_rect_from_irect(&rect, &job->area);
+		fz_transform_rect(&rect, &inverse);
+		fz_expand_rect(&rect, fz_max(exp, 1) * 4);
+		fz_irect_from_rect(&src_area, &rect);
+		fz_intersect_irect(&src_area, &sane);
+		if (fz_is_empty_irect(&src_area))
+			return;
+	}
+
+	if (job->len == job->cap)
+	{
+		int cap = job->cap ? job->cap * 2 : 32;
+		job->items = fz_resize_array(ctx, job->items, cap, sizeof(*job->items));
+		job->cap = cap;
+	}
+	item = &job->items[job->len++];
+	item->image = fz_keep_image(ctx, image);
+	item->ctm = *ctm;
+	item->subarea = src_area;
+	item->whole = whole;
+	item->size = estimate_size(image, ctm, &src_area);
+}
+
+static void
+prefetch_fill_image(fz_context *ctx, fz_device *dev, fz_image *image, const fz_matrix *ctm, float alpha)
+{
+	prefetch_image(ctx, dev, image, ctm, 0);
+}
+
+static void
+prefetch_fill_image_mask(fz_context *ctx, fz_device *dev, fz_image *image, const fz_matrix *ctm,
+	fz_colorspace *colorspace, const float *color, float alpha)
+{
+	prefetch_image(ctx, dev, image, ctm, 0);
+}
+
+static void
+prefetch_clip_image_mask(fz_context *ctx, fz_device *dev, fz_image *image, const fz_matrix *ctm, const fz_rect *scissor)
+{
+	/* The draw device asks for the whole of clipping masks. */
+	prefetch_image(ctx, dev, image, ctm, 1);
+}
+
+static fz_device *
+new_prefetch_device(fz_context *ctx, prefetch_job *job)
+{
+	fz_prefetch_device *dev = fz_new_device(ctx, sizeof *dev);
+
+	dev->super.fill_image = prefetch_fill_image;
+	dev->super.fill_image_mask = prefetch_fill_image_mask;
+	dev->super.clip_image_mask = prefetch_clip_image_mask;
+
+	dev->job = job;
+
+	return (fz_device *)dev;
+}
+
+static int
+cmp_item(const void *a_, const void *b_)
+{
+	const prefetch_item *a = a_;
+	const prefetch_item *b = b_;
+
+	if (a->image != b->image)
+		return a->image < b->image ? -1 : 1;
+	if (a->whole != b->whole)
+		return a->whole - b->whole;
+	if (a->subarea.x0 != b->subarea.x0)
+		return a->subarea.x0 - b->subarea.x0;
+	if (a->subarea.y0 != b->subarea.y0)
+		return a->subarea.y0 - b->subarea.y0;
+	if (a->subarea.x1 != b->subarea.x1)
+		return a->subarea.x1 - b->subarea.x1;
+	if (a->subarea.y1 != b->subarea.y1)
+		return a->subarea.y1 - b->subarea.y1;
+	return memcmp(&a->ctm, &b->ctm, 4 * sizeof(float));
+}
+
+static int
+cmp_item_size(const void *a_, const void *b_)
+{
+	const prefetch_item *a = a_;
+	const prefetch_item *b = b_;
+
+	if (a->size != b->size)
+		return a->size > b->size ? -1 : 1;
+	return 0;
+}
+
+/* Drop repeated draws of the same part of an image. Then put the
+ * largest first, so that the workers all finish at about the same
+ * time, and drop whatever would not fit in (half) the store, as it
+ * would only push out the rest before it was drawn. */
+static void
+plan_items(fz_context *ctx, prefetch_job *job)
+{
+	size_t budget = fz_store_max(ctx) / 2;
+	size_t total = 0;
+	int i, n;
+
+	if (job->len == 0)
+		return;
+
+	qsort(job->items, job->len, sizeof(*job->items), cmp_item);
+	for (i = 1, n = 1; i < job->len; i++)
+	{
+		if (cmp_item(&job->items[n - 1], &job->items[i]) == 0)
+			fz_drop_image(ctx, job->items[i].image);
+		else
+			job->items[n++] = job->items[i];
+	}
+	job->len = n;
+
+	qsort(job->items, job->len, sizeof(*job->items), cmp_item_size);
+	if (budget == 0)
+		return;
+	for (i = 0, n = 0; i < job->len; i++)
+	{
+		if (total + job->items[i].size > budget)
+			fz_drop_image(ctx, job->items[i].image);
+		else
+		{
+			total += job->items[i].size;
+			job->items[n++] = job->items[i];
+		}
+	}
+	job->len = n;
+}
+
+static void
+run_worker(prefetch_worker *me)
+{
+	prefetch_job *job = me->job;
+	fz_context *ctx = me->ctx;
+	prefetch_item *item;
+	fz_pixmap *pix;
+	fz_matrix ctm;
+
+	while (1)
+	{
+		if (job->cookie && job->cookie->abort)
+			break;
+		MUTEX_LOCK(job->lock);
+		item = job->next < job->len ? &job->items[job->next++] : NULL;
+		MUTEX_UNLOCK(job->lock);
+		if (!item)
+			break;
+
+		ctm = item->ctm;
+		fz_try(ctx)
+		{
+			pix = fz_get_pixmap_from_image(ctx, item->image, item->whole ? NULL : &item->subarea, &ctm, NULL, NULL);
+			fz_drop_pixmap(ctx, pix);
+		}
+		fz_catch(ctx)
+		{
+			/* Leave it to the draw device to try again, and report. */
+		}
+	}
+}
+
+#ifdef FZ_THREADS
+static THREAD_RETURN_TYPE
+prefetch_worker_thread(void *arg)
+{
+	run_worker((prefetch_worker *)arg);
+	THREAD_RETURN();
+}
+#endif
+
+void
+fz_prefetch_display_list_images(fz_context *ctx, fz_display_list *list, const fz_matrix *ctm, const fz_rect *area, int nthreads, fz_cookie *cookie)
+{
+	prefetch_job job = { { 0 } };
+	prefetch_worker *workers = NULL;
+	fz_device *dev = NULL;
+	fz_rect rect;
+	int i, count;
+
+#ifndef FZ_THREADS
+	nthreads = 1;
+#endif
+	/* On its own, the calling thread would be no quicker at decoding
+	 * the images than the draw device is. */
+	if (nthreads < 2)
+		return;
+
+	rect = area ? *area : fz_infinite_rect;
+	fz_irect_from_rect(&job.area, &rect);
+	job.cookie = cookie;
+
+	fz_var(dev);
+	fz_var(workers);
+
+	fz_try(ctx)
+	{
+		dev = new_prefetch_device(ctx, &job);
+		fz_run_display_list(ctx, list, dev, ctm, area, NULL);
+		fz_close_device(ctx, dev);
+		fz_drop_device(ctx, dev);
+		dev = NULL;
+
+		plan_items(ctx, &job);
+
+		nthreads = fz_mini(nthreads, job.len);
+		if (nthreads > 0)
+			workers = fz_calloc(ctx, nthreads, sizeof(*workers));
+	}
+	fz_catch(ctx)
+	{
+		fz_drop_device(ctx, dev);
+		for (i = 0; i < job.len; i++)
+			fz_drop_image(ctx, job.items[i].image);
+		fz_free(ctx, job.items);
+		fz_rethrow(ctx);
+	}
+
+	MUTEX_INIT(job.lock);
+
+	/* As for fz_render_display_list_parallel, the calling thread is
+	 * the first worker, and we make do with fewer if contexts cannot
+	 * be cloned. */
+	count = 0;
+	if (nthreads > 0)
+	{
+		workers[0].ctx = ctx;
+		count = 1;
+	}
+	while (count < nthreads)
+	{
+		fz_context *clone = fz_clone_context(ctx);
+		if (clone == NULL)
+			break;
+		workers[count++].ctx = clone;
+	}
+	for (i = 0; i < count; i++)
+		workers[i].job = &job;
+
+#ifdef FZ_THREADS
+	for (i = 1; i < count; i++)
+		workers[i].started = !THREAD_INIT(workers[i].thread, prefetch_worker_thread, &workers[i]);
+#endif
+
+	if (count > 0)
+		run_worker(&workers[0]);
+
+#ifdef FZ_THREADS
+	for (i = 1; i < count; i++)
+		if (workers[i].started)
+			THREAD_FIN(workers[i].thread);
+#endif
+
+	for (i = 1; i < count; i++)
+		fz_drop_context(workers[i].ctx);
+	MUTEX_FIN(job.lock);
+	fz_free(ctx, workers);
+	for (i = 0; i < job.len; i++)
+		fz_drop_image(ctx, job.items[i].image);
+	fz_free(ctx, job.items);
+}
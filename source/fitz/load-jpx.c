@@ -465,6 +465,24 @@ fz_load_jpx(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace *de
 	return jpx_read_image(ctx, &state, data, size, defcs, indexed, 0);
 }
 
+fz_pixmap *
+fz_load_jpx_subarea(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace *defcs, int indexed, fz_irect *subarea, int *l2factor)
+{
+	fz_jpxd state = { 0 };
+	fz_pixmap *pix;
+
+	/* We always decode the whole image at full size. */
+	pix = jpx_read_image(ctx, &state, data, size, defcs, indexed, 0);
+	if (subarea)
+	{
+		subarea->x0 = 0;
+		subarea->y0 = 0;
+		subarea->x1 = pix->w;
+		subarea->y1 = pix->h;
+	}
+	return pix;
+}
+
 void
 fz_load_jpx_info(fz_context *ctx, unsigned char *data, size_t size, int *wp, int *hp, int *xresp, int *yresp, fz_colorspace **cspacep)
 {
@@ -505,6 +523,12 @@ fz_load_jpx_info(fz_context *ctx, unsigned char *data, size_t size, int *wp, int
  * It is therefore vital that any fz_lock/fz_unlock
  * handlers are shared between all the fz_contexts in
  * use at a time.
+ *
+ * When the codec decodes on threads of its own, those
+ * threads must not use the context (which is not safe
+ * to share, and whose scavenging may need the lock we
+ * hold), so for as long as the lock is held everything
+ * is allocated with the system allocator instead.
  */
 
 /* Potentially we can write different versions
@@ -513,6 +537,7 @@ fz_load_jpx_info(fz_context *ctx, unsigned char *data, size_t size, int *wp, int
  */
 
 static fz_context *opj_secret = NULL;
+static int opj_system_alloc = 0;
 
 static void set_opj_context(fz_context *ctx)
 {
@@ -524,15 +549,19 @@ static fz_context *get_opj_context()
 	return opj_secret;
 }
 
+static int jpx_threads(fz_context *ctx);
+
 void opj_lock(fz_context *ctx)
 {
 	fz_lock(ctx, FZ_LOCK_FREETYPE);
 
 	set_opj_context(ctx);
+	opj_system_alloc = (jpx_threads(ctx) > 1);
 }
 
 void opj_unlock(fz_context *ctx)
 {
+	opj_system_alloc = 0;
 	set_opj_context(NULL);
 
 	fz_unlock(ctx, FZ_LOCK_FREETYPE);
@@ -544,6 +573,8 @@ void *opj_malloc(size_t size)
 
 	assert(ctx != NULL);
 
+	if (opj_system_alloc)
+		return malloc(size);
 	return fz_malloc_no_throw(ctx, size);
 }
 
@@ -553,6 +584,8 @@ void *opj_calloc(size_t n, size_t size)
 
 	assert(ctx != NULL);
 
+	if (opj_system_alloc)
+		return calloc(n, size);
 	return fz_calloc_no_throw(ctx, n, size);
 }
 
@@ -562,6 +595,8 @@ void *opj_realloc(void *ptr, size_t size)
 
 	assert(ctx != NULL);
 
+	if (opj_system_alloc)
+		return realloc(ptr, size);
 	return fz_resize_array_no_throw(ctx, ptr, 1, size);
 }
 
@@ -571,7 +606,10 @@ void opj_free(void *ptr)
 
 	assert(ctx != NULL);
 
-	fz_free(ctx, ptr);
+	if (opj_system_alloc)
+		free(ptr);
+	else
+		fz_free(ctx, ptr);
 }
 
 void * opj_aligned_malloc(size_t size)
@@ -653,10 +691,14 @@ static OPJ_OFF_T fz_opj_stream_skip(OPJ_OFF_T skip, void * p_user_data)
 {
 	stream_block *sb = (stream_block *)p_user_data;
 
+	/* The codec wants the number of bytes skipped; this matters when
+	 * it skips over the tiles outside the decode area. */
+	if (sb->pos == sb->size)
+		return (OPJ_OFF_T)-1; /* End of file! */
 	if (skip > (OPJ_OFF_T)(sb->size - sb->pos))
 		skip = (OPJ_OFF_T)(sb->size - sb->pos);
 	sb->pos += skip;
-	return sb->pos;
+	return skip;
 }
 
 static OPJ_BOOL fz_opj_stream_seek(OPJ_OFF_T seek_pos, void * p_user_data)
@@ -669,14 +711,20 @@ static OPJ_BOOL fz_opj_stream_seek(OPJ_OFF_T seek_pos, void * p_user_data)
 	return OPJ_TRUE;
 }
 
+/* Components may be subsampled, in which case their sizes are those of
+ * the image divided by a power of 2, rounded either up or down. */
 static int
 l2subfactor(fz_context *ctx, unsigned int max_w, unsigned int w)
 {
+	unsigned int lo = max_w, hi = max_w;
 	int i;
 
-	for (i = 0; max_w != 0 && w != max_w; i++)
-		max_w >>= 1;
-	if (max_w == 0)
+	for (i = 0; lo != 0 && w != lo && w != hi; i++)
+	{
+		lo >>= 1;
+		hi = (hi + 1) >> 1;
+	}
+	if (lo == 0)
 		fz_throw(ctx, FZ_ERROR_GENERIC, "image components are of incompatible dimensions");
 	return i;
 }
@@ -704,24 +752,28 @@ jpx_ycc_to_rgb(fz_context *ctx, fz_pixmap *pix)
 
 }
 
-static fz_pixmap *
-jpx_read_image(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace *defcs, int indexed, int onlymeta)
+/* Decode part of the image, at 1/2^reduce of its size.
+ *
+ * On entry area is the part wanted, in pixels of the whole image, and
+ * reduce the reduction; on exit they are the part decoded (widened to
+ * whole tiles, and clipped to the image) and the reduction used, which
+ * is limited by the number of resolution levels in the codestream.
+ *
+ * Returns NULL if the codestream could not be decoded in that way, so
+ * that the caller can try again with the whole image at full size. */
+static opj_image_t *
+jpx_decode(fz_context *ctx, unsigned char *data, size_t size, int indexed, fz_irect *area, int *reduce, int threads)
 {
-	fz_pixmap *img;
 	opj_dparameters_t params;
 	opj_codec_t *codec;
 	opj_image_t *jpx;
 	opj_stream_t *stream;
-	fz_colorspace *colorspace;
-	unsigned char *p;
+	opj_codestream_info_v2_t *info;
 	OPJ_CODEC_FORMAT format;
-	int a, n, w, h, depth, sgnd;
-	int x, y, k, v, stride;
 	stream_block sb;
-	unsigned int max_w, max_h;
-	int sub_w[FZ_MAX_COLORS];
-	int sub_h[FZ_MAX_COLORS];
-	int upsample_required = 0;
+	fz_irect whole;
+	unsigned int k, w, h, dx, dy;
+	int ok;
 
 	if (size < 2)
 		fz_throw(ctx, FZ_ERROR_GENERIC, "not enough data to determine image format");
@@ -746,6 +798,10 @@ jpx_read_image(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace
 		fz_throw(ctx, FZ_ERROR_GENERIC, "j2k decode failed");
 	}
 
+	/* Always set the number of threads, as otherwise the codec takes
+	 * it from the environment. */
+	opj_codec_set_threads(codec, threads > 1 ? threads : 0);
+
 	stream = opj_stream_default_create(OPJ_TRUE);
 	sb.data = data;
 	sb.pos = 0;
@@ -765,24 +821,105 @@ jpx_read_image(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace
 		fz_throw(ctx, FZ_ERROR_GENERIC, "Failed to read JPX header");
 	}
 
-	if (!opj_decode(codec, stream, jpx))
+	w = h = 0;
+	dx = dy = UINT_MAX;
+	for (k = 0; k < jpx->numcomps; k++)
 	{
-		opj_stream_destroy(stream);
-		opj_destroy_codec(codec);
-		opj_image_destroy(jpx);
-		fz_throw(ctx, FZ_ERROR_GENERIC, "Failed to decode JPX image");
+		if (w < jpx->comps[k].w)
+			w = jpx->comps[k].w;
+		if (h < jpx->comps[k].h)
+			h = jpx->comps[k].h;
+		if (dx > jpx->comps[k].dx)
+			dx = jpx->comps[k].dx;
+		if (dy > jpx->comps[k].dy)
+			dy = jpx->comps[k].dy;
+	}
+	whole.x0 = 0;
+	whole.y0 = 0;
+	whole.x1 = w;
+	whole.y1 = h;
+
+	/* Areas are given on the reference grid, which only matches the
+	 * pixels of the image when no component is subsampled. */
+	if (dx != 1 || dy != 1 || fz_is_empty_irect(fz_intersect_irect(area, &whole)))
+		*area = whole;
+
+	info = opj_get_cstr_info(codec);
+	if (info && info->m_default_tile_info.tccp_info)
+	{
+		/* The lowest resolution level is as far as we can reduce. */
+		for (k = 0; k < info->nbcomps; k++)
+			*reduce = fz_mini(*reduce, (int)info->m_default_tile_info.tccp_info[k].numresolutions - 1);
+
+		/* Tiles are decoded whole, so we may as well return all of
+		 * those the area touches. Then an image that is a single tile
+		 * is decoded just once, however little of it is seen. */
+		if (info->tdx > 0 && info->tdy > 0)
+		{
+			int tx0 = (int)info->tx0 - (int)jpx->x0;
+			int ty0 = (int)info->ty0 - (int)jpx->y0;
+			int tdx = (int)info->tdx;
+			int tdy = (int)info->tdy;
+
+			area->x0 = tx0 + (area->x0 - tx0) / tdx * tdx;
+			area->y0 = ty0 + (area->y0 - ty0) / tdy * tdy;
+			area->x1 = tx0 + (area->x1 - tx0 + tdx - 1) / tdx * tdx;
+			area->y1 = ty0 + (area->y1 - ty0 + tdy - 1) / tdy * tdy;
+			fz_intersect_irect(area, &whole);
+		}
 	}
+	else
+		*reduce = 0;
+	if (info)
+		opj_destroy_cstr_info(&info);
+	if (*reduce < 0)
+		*reduce = 0;
+
+	/* Keep the area on the grid of the reduced image, so that it
+	 * covers whole pixels of it. */
+	if (*reduce > 0)
+	{
+		int f = 1 << *reduce;
+
+		area->x0 &= ~(f - 1);
+		area->y0 &= ~(f - 1);
+		area->x1 = fz_mini((area->x1 + f - 1) & ~(f - 1), w);
+		area->y1 = fz_mini((area->y1 + f - 1) & ~(f - 1), h);
+	}
+
+	ok = 1;
+	if (*reduce > 0)
+	{
+		ok = opj_set_decoded_resolution_factor(codec, *reduce);
+		/* The sizes of the components we get back are worked out
+		 * from these, when the area is set. */
+		for (k = 0; k < jpx->numcomps; k++)
+			jpx->comps[k].factor = *reduce;
+	}
+	if (ok && (*reduce > 0 || area->x0 > 0 || area->y0 > 0 || area->x1 < (int)w || area->y1 < (int)h))
+		ok = opj_set_decode_area(codec, jpx,
+			jpx->x0 + area->x0, jpx->y0 + area->y0,
+			jpx->x0 + area->x1, jpx->y0 + area->y1);
+	if (ok)
+		ok = opj_decode(codec, stream, jpx);
 
 	opj_stream_destroy(stream);
 	opj_destroy_codec(codec);
 
-	/* jpx should never be NULL here, but check anyway */
-	if (!jpx)
-		fz_throw(ctx, FZ_ERROR_GENERIC, "opj_decode failed");
+	if (!ok)
+	{
+		opj_image_destroy(jpx);
+		return NULL;
+	}
 
-	n = jpx->numcomps;
-	depth = jpx->comps[0].prec;
-	sgnd = jpx->comps[0].sgnd;
+	return jpx;
+}
+
+static fz_colorspace *
+jpx_colorspace(fz_context *ctx, opj_image_t *jpx, fz_colorspace *defcs, int *np, int *ap)
+{
+	int n = jpx->numcomps;
+	int a;
 
 	if (jpx->color_space == OPJ_CLRSPC_SRGB && n == 4) { n = 3; a = 1; }
 	else if (jpx->color_space == OPJ_CLRSPC_SYCC && n == 4) { n = 3; a = 1; }
@@ -790,73 +927,103 @@ jpx_read_image(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace
 	else if (n > 4) { n = 4; a = 1; }
 	else { a = 0; }
 
+	*np = n;
+	*ap = a;
+
 	if (defcs)
 	{
 		if (fz_colorspace_n(ctx, defcs) == n)
-		{
-			colorspace = defcs;
-		}
-		else
-		{
-			fz_warn(ctx, "jpx file and dict colorspace do not match");
-			defcs = NULL;
-		}
+			return defcs;
+		fz_warn(ctx, "jpx file and dict colorspace do not match");
 	}
 
-	if (!defcs)
+	switch (n)
 	{
-		switch (n)
-		{
-		case 1: colorspace = fz_device_gray(ctx); break;
-		case 3: colorspace = fz_device_rgb(ctx); break;
-		case 4: colorspace = fz_device_cmyk(ctx); break;
-		default: fz_throw(ctx, FZ_ERROR_GENERIC, "unsupported number of components: %d", n);
-		}
+	case 1: return fz_device_gray(ctx);
+	case 3: return fz_device_rgb(ctx);
+	case 4: return fz_device_cmyk(ctx);
 	}
+	fz_throw(ctx, FZ_ERROR_GENERIC, "unsupported number of components: %d", n);
+}
 
-	max_w = jpx->comps[0].w;
-	max_h = jpx->comps[0].h;
-	for (k = 1; k < (int)jpx->numcomps; k++)
-	{
-		if (max_w < jpx->comps[k].w)
-			max_w = jpx->comps[k].w;
-		if (max_h < jpx->comps[k].w)
-			max_h = jpx->comps[k].h;
-		if (!jpx->comps[k].data)
-		{
-			opj_image_destroy(jpx);
-			fz_throw(ctx, FZ_ERROR_GENERIC, "image components are missing data");
-		}
-		if (jpx->comps[k].prec != jpx->comps[0].prec)
-		{
-			opj_image_destroy(jpx);
-			fz_throw(ctx, FZ_ERROR_GENERIC, "image components have different precision");
-		}
-	}
+static int
+jpx_threads(fz_context *ctx)
+{
+	/* The codec's threads allocate with the system allocator while
+	 * they run (see opj_malloc), but ctx must still have locking
+	 * functions for the decode to be serialised with other threads. */
+	if (ctx->locks == &fz_locks_default)
+		return 1;
+	return fz_image_decode_threads(ctx);
+}
 
-	for (k = 0; k < (int)jpx->numcomps; k++)
+static fz_pixmap *
+jpx_read_image(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace *defcs, int indexed, fz_irect *subarea, int *l2factor)
+{
+	fz_pixmap *img = NULL;
+	opj_image_t *jpx;
+	fz_colorspace *colorspace;
+	fz_irect area;
+	unsigned char *p;
+	int a, n, w, h, depth, sgnd, reduce;
+	int x, y, k, v, stride;
+	unsigned int max_w, max_h;
+	int sub_w[FZ_MAX_COLORS];
+	int sub_h[FZ_MAX_COLORS];
+	int upsample_required = 0;
+	int threads = jpx_threads(ctx);
+
+	if (subarea)
+		area = *subarea;
+	else
+		area = fz_infinite_irect;
+	reduce = l2factor ? *l2factor : 0;
+
+	jpx = jpx_decode(ctx, data, size, indexed, &area, &reduce, threads);
+	if (!jpx && (reduce > 0 || subarea))
 	{
-		sub_w[k] = l2subfactor(ctx, max_w, jpx->comps[k].w);
-		sub_h[k] = l2subfactor(ctx, max_h, jpx->comps[k].h);
-		if (sub_w[k] != 0 || sub_h[k] != 0)
-			upsample_required = 1;
+		area = fz_infinite_irect;
+		reduce = 0;
+		jpx = jpx_decode(ctx, data, size, indexed, &area, &reduce, threads);
 	}
+	if (!jpx)
+		fz_throw(ctx, FZ_ERROR_GENERIC, "Failed to decode JPX image");
 
-	w = (int)max_w;
-	h = (int)max_h;
+	fz_var(img);
 
 	fz_try(ctx)
 	{
+		colorspace = jpx_colorspace(ctx, jpx, defcs, &n, &a);
+		depth = jpx->comps[0].prec;
+		sgnd = jpx->comps[0].sgnd;
+
+		max_w = jpx->comps[0].w;
+		max_h = jpx->comps[0].h;
+		for (k = 1; k < (int)jpx->numcomps; k++)
+		{
+			if (max_w < jpx->comps[k].w)
+				max_w = jpx->comps[k].w;
+			if (max_h < jpx->comps[k].h)
+				max_h = jpx->comps[k].h;
+			if (!jpx->comps[k].data)
+				fz_throw(ctx, FZ_ERROR_GENERIC, "image components are missing data");
+			if (jpx->comps[k].prec != jpx->comps[0].prec)
+				fz_throw(ctx, FZ_ERROR_GENERIC, "image components have different precision");
+		}
+
+		for (k = 0; k < (int)jpx->numcomps; k++)
+		{
+			sub_w[k] = l2subfactor(ctx, max_w, jpx->comps[k].w);
+			sub_h[k] = l2subfactor(ctx, max_h, jpx->comps[k].h);
+			if (sub_w[k] != 0 || sub_h[k] != 0)
+				upsample_required = 1;
+		}
+
+		w = (int)max_w;
+		h = (int)max_h;
+
 		img = fz_new_pixmap(ctx, colorspace, w, h, a);
-	}
-	fz_catch(ctx)
-	{
-		opj_image_destroy(jpx);
-		fz_rethrow(ctx);
-	}
 
-	if (!onlymeta)
-	{
 		p = img->samples;
 		if (upsample_required)
 		{
@@ -867,11 +1034,12 @@ jpx_read_image(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace
 				{
 					int sh = sub_h[k];
 					int sw = sub_w[k];
-					int yy = (y>>sh) * jpx->comps[k].w;
+					int cw = jpx->comps[k].w;
+					int yy = fz_mini(y>>sh, jpx->comps[k].h - 1) * cw;
 					OPJ_INT32 *data = &jpx->comps[k].data[yy];
 					for (x = 0; x < w; x ++)
 					{
-						v = data[x>>sw];
+						v = data[fz_mini(x>>sw, cw - 1)];
 						if (sgnd)
 							v = v + (1 << (depth - 1));
 						if (depth > 8)
@@ -921,24 +1089,40 @@ jpx_read_image(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace
 			}
 			fz_premultiply_pixmap(ctx, img);
 		}
-	}
 
-	if (jpx->color_space == OPJ_CLRSPC_SYCC && n == 3 && a == 0)
-		jpx_ycc_to_rgb(ctx, img);
+		if (jpx->color_space == OPJ_CLRSPC_SYCC && n == 3 && a == 0)
+			jpx_ycc_to_rgb(ctx, img);
+	}
+	fz_always(ctx)
+		opj_image_destroy(jpx);
+	fz_catch(ctx)
+	{
+		fz_drop_pixmap(ctx, img);
+		fz_rethrow(ctx);
+	}
 
-	opj_image_destroy(jpx);
+	if (subarea)
+		*subarea = area;
+	if (l2factor)
+		*l2factor -= reduce;
 
 	return img;
 }
 
 fz_pixmap *
 fz_load_jpx(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace *defcs, int indexed)
+{
+	return fz_load_jpx_subarea(ctx, data, size, defcs, indexed, NULL, NULL);
+}
+
+fz_pixmap *
+fz_load_jpx_subarea(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace *defcs, int indexed, fz_irect *subarea, int *l2factor)
 {
 	fz_pixmap *pix;
 	fz_try(ctx)
 	{
 		opj_lock(ctx);
-		pix = jpx_read_image(ctx, data, size, defcs, indexed, 0);
+		pix = jpx_read_image(ctx, data, size, defcs, indexed, subarea, l2factor);
 	}
 	fz_always(ctx)
 		opj_unlock(ctx);
@@ -951,24 +1135,42 @@ fz_load_jpx(fz_context *ctx, unsigned char *data, size_t size, fz_colorspace *de
 void
 fz_load_jpx_info(fz_context *ctx, unsigned char *data, size_t size, int *wp, int *hp, int *xresp, int *yresp, fz_colorspace **cspacep)
 {
-	fz_pixmap *img;
+	opj_image_t *jpx = NULL;
+	fz_colorspace *cs = NULL;
+	fz_irect area = fz_infinite_irect;
+	int reduce = INT_MAX;
+	int n, a;
+
+	fz_var(jpx);
 
+	/* Decoding at the lowest resolution is enough to learn what the
+	 * components are, once any palette has been applied. */
 	fz_try(ctx)
 	{
 		opj_lock(ctx);
-		img = jpx_read_image(ctx, data, size, NULL, 0, 1);
+		jpx = jpx_decode(ctx, data, size, 0, &area, &reduce, 1);
+		if (!jpx)
+		{
+			reduce = 0;
+			jpx = jpx_decode(ctx, data, size, 0, &area, &reduce, jpx_threads(ctx));
+		}
+		if (!jpx)
+			fz_throw(ctx, FZ_ERROR_GENERIC, "Failed to decode JPX image");
+		cs = jpx_colorspace(ctx, jpx, NULL, &n, &a);
 	}
 	fz_always(ctx)
+	{
+		opj_image_destroy(jpx);
 		opj_unlock(ctx);
+	}
 	fz_catch(ctx)
 		fz_rethrow(ctx);
 
-	*cspacep = fz_keep_colorspace(ctx, img->colorspace);
-	*wp = img->w;
-	*hp = img->h;
+	*cspacep = fz_keep_colorspace(ctx, cs);
+	*wp = area.x1 - area.x0;
+	*hp = area.y1 - area.y0;
 	*xresp = 72; /* openjpeg does not read the JPEG 2000 resc box */
 	*yresp = 72; /* openjpeg does not read the JPEG 2000 resc box */
-	fz_drop_pixmap(ctx, img);
 }
 
 #endif /* HAVE_LURATECH */
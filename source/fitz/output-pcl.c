@@ -1095,6 +1095,7 @@ typedef struct mono_pcl_band_writer_s
 	unsigned char *mode3buf;
 	int top_of_page;
 	int num_blank_lines;
+	int compression;
 } mono_pcl_band_writer;
 
 static void
@@ -1119,6 +1120,7 @@ mono_pcl_write_header(fz_context *ctx, fz_band_writer *writer_)
 	writer->mode3buf = fz_calloc(ctx, max_mode_3_size, sizeof(unsigned char));
 	writer->num_blank_lines = 0;
 	writer->top_of_page = 1;
+	writer->compression = -1;
 
 	guess_paper_size(&writer->options, w, h, xres, yres);
 
@@ -1142,14 +1144,18 @@ mono_pcl_write_band(fz_context *ctx, fz_band_writer *writer_, int ss, int band_s
 	const unsigned char *out_data;
 	int y, rmask, line_size;
 	int num_blank_lines;
-	int compression = -1;
+	int compression;
 	unsigned char *prev = NULL;
 	unsigned char *mode2buf = NULL;
 	unsigned char *mode3buf = NULL;
 	int out_count;
 	const fz_pcl_options *pcl;
 
+	if (band_start+band_height >= h)
+		band_height = h - band_start;
+
 	num_blank_lines = writer->num_blank_lines;
+	compression = writer->compression;
 	rmask = ~0 << (-w & 7);
 	line_size = (w + 7)/8;
 	prev = writer->prev;
@@ -1158,7 +1164,7 @@ mono_pcl_write_band(fz_context *ctx, fz_band_writer *writer_, int ss, int band_s
 	pcl = &writer->options;
 
 	/* Transfer raster graphics. */
-	for (y = 0; y < h; y++, data += ss)
+	for (y = 0; y < band_height; y++, data += ss)
 	{
 		const unsigned char *end_data = data + line_size;
 
@@ -1296,6 +1302,7 @@ mono_pcl_write_band(fz_context *ctx, fz_band_writer *writer_, int ss, int band_s
 	}
 
 	writer->num_blank_lines = num_blank_lines;
+	writer->compression = compression;
 }
 
 static void
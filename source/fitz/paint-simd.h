@@ -0,0 +1,481 @@
+/*
+	This file is #included by draw-paint.c twice, to produce the
+	SSE2 and the AVX2 versions of the span painters.
+
+	Every painter here works on blocks of 16 pixels. The per pixel
+	values (mask or source alpha) are spread out to cover the bytes
+	of each pixel, and the Porter-Duff arithmetic is then done on
+	all the bytes of a block at once, widened to 16 bits. The
+	results are bit for bit identical to the C versions; whatever
+	is left over at the end of a span is handed to those.
+
+	The SSE2 versions can only spread values over 1, 2 or 4 byte
+	pixels. The AVX2 versions use pshufb, and so manage any pixel
+	size from 1 to 5 bytes.
+*/
+
+#ifdef SIMD_AVX2
+#define SIMD_TARGET FZ_TARGET_AVX2
+#define SIMD_NAME(NAME) NAME##_avx2
+#define W16 __m256i
+#else
+#define SIMD_TARGET FZ_TARGET_SSE2
+#define SIMD_NAME(NAME) NAME##_sse2
+#define W16 simd_w16
+#endif
+
+#define BLOCK 16
+
+/* 16 bytes widened to 16 bit lanes. */
+
+#ifdef SIMD_AVX2
+
+static inline SIMD_TARGET W16
+SIMD_NAME(widen)(__m128i v)
+{
+	return _mm256_cvtepu8_epi16(v);
+}
+
+static inline SIMD_TARGET __m128i
+SIMD_NAME(narrow)(W16 v)
+{
+	return _mm_packus_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+}
+
+static inline SIMD_TARGET W16
+SIMD_NAME(splat)(int v)
+{
+	return _mm256_set1_epi16(v);
+}
+
+/* FZ_EXPAND */
+static inline SIMD_TARGET W16
+SIMD_NAME(expand)(W16 a)
+{
+	return _mm256_add_epi16(a, _mm256_srli_epi16(a, 7));
+}
+
+/* FZ_COMBINE; the product must fit in 16 bits. */
+static inline SIMD_TARGET W16
+SIMD_NAME(combine)(W16 a, W16 b)
+{
+	return _mm256_srli_epi16(_mm256_mullo_epi16(a, b), 8);
+}
+
+/* FZ_BLEND; (s-d)*a + (d<<8) always lies in 0..65280, so the modulo
+ * 2^16 arithmetic of the intermediate steps does not matter. */
+static inline SIMD_TARGET W16
+SIMD_NAME(blend)(W16 s, W16 d, W16 a)
+{
+	return _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(s, d), a), _mm256_slli_epi16(d, 8)), 8);
+}
+
+/* 256 - a */
+static inline SIMD_TARGET W16
+SIMD_NAME(invert)(W16 a)
+{
+	return _mm256_sub_epi16(_mm256_set1_epi16(256), a);
+}
+
+#else
+
+typedef struct { __m128i lo, hi; } simd_w16;
+
+static inline SIMD_TARGET W16
+SIMD_NAME(widen)(__m128i v)
+{
+	W16 r;
+	r.lo = _mm_unpacklo_epi8(v, _mm_setzero_si128());
+	r.hi = _mm_unpackhi_epi8(v, _mm_setzero_si128());
+	return r;
+}
+
+static inline SIMD_TARGET __m128i
+SIMD_NAME(narrow)(W16 v)
+{
+	return _mm_packus_epi16(v.lo, v.hi);
+}
+
+static inline SIMD_TARGET W16
+SIMD_NAME(splat)(int v)
+{
+	W16 r;
+	r.lo = r.hi = _mm_set1_epi16(v);
+	return r;
+}
+
+static inline SIMD_TARGET W16
+SIMD_NAME(expand)(W16 a)
+{
+	a.lo = _mm_add_epi16(a.lo, _mm_srli_epi16(a.lo, 7));
+	a.hi = _mm_add_epi16(a.hi, _mm_srli_epi16(a.hi, 7));
+	return a;
+}
+
+static inline SIMD_TARGET W16
+SIMD_NAME(combine)(W16 a, W16 b)
+{
+	a.lo = _mm_srli_epi16(_mm_mullo_epi16(a.lo, b.lo), 8);
+	a.hi = _mm_srli_epi16(_mm_mullo_epi16(a.hi, b.hi), 8);
+	return a;
+}
+
+static inline SIMD_TARGET W16
+SIMD_NAME(blend)(W16 s, W16 d, W16 a)
+{
+	W16 r;
+	r.lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(s.lo, d.lo), a.lo), _mm_slli_epi16(d.lo, 8)), 8);
+	r.hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(s.hi, d.hi), a.hi), _mm_slli_epi16(d.hi, 8)), 8);
+	return r;
+}
+
+static inline SIMD_TARGET W16
+SIMD_NAME(invert)(W16 a)
+{
+	a.lo = _mm_sub_epi16(_mm_set1_epi16(256), a.lo);
+	a.hi = _mm_sub_epi16(_mm_set1_epi16(256), a.hi);
+	return a;
+}
+
+#endif
+
+/* Spread 16 per pixel values in f over the j'th 16 bytes of a block
+ * of 16 pixels of p bytes each. */
+static inline SIMD_TARGET __m128i
+SIMD_NAME(spread)(__m128i f, int p, int j)
+{
+#ifdef SIMD_AVX2
+	return _mm_shuffle_epi8(f, _mm_loadu_si128((const __m128i *)simd_spread[p*(p-1)/2 + j]));
+#else
+	if (p == 2)
+		return j == 0 ? _mm_unpacklo_epi8(f, f) : _mm_unpackhi_epi8(f, f);
+	if (p == 4)
+	{
+		f = (j & 2) ? _mm_unpackhi_epi8(f, f) : _mm_unpacklo_epi8(f, f);
+		return (j & 1) ? _mm_unpackhi_epi16(f, f) : _mm_unpacklo_epi16(f, f);
+	}
+	return f;
+#endif
+}
+
+/* Spread the last byte of each pixel over the whole pixel, for pixels
+ * of 1, 2 or 4 bytes. */
+static inline SIMD_TARGET __m128i
+SIMD_NAME(spread_alpha)(__m128i s, int p)
+{
+	__m128i a;
+	if (p == 2)
+	{
+		a = _mm_srli_epi16(s, 8);
+		return _mm_or_si128(a, _mm_slli_epi16(a, 8));
+	}
+	if (p == 4)
+	{
+		a = _mm_srli_epi32(s, 24);
+		a = _mm_or_si128(a, _mm_slli_epi32(a, 8));
+		return _mm_or_si128(a, _mm_slli_epi32(a, 16));
+	}
+	return s;
+}
+
+static inline SIMD_TARGET int
+SIMD_NAME(all_equal)(__m128i f, int v)
+{
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(f, _mm_set1_epi8((char)v))) == 0xFFFF;
+}
+
+/* Build p vectors holding 16 copies of the p byte colour (the colour
+ * components, plus 255 for a destination alpha). */
+static inline SIMD_TARGET void
+SIMD_NAME(color_pattern)(__m128i *pv, W16 *pw, const byte * restrict color, int p, int da)
+{
+	byte pat[BLOCK * 5];
+	int i, j;
+	for (i = 0; i < p - da; i++)
+		pat[i] = color[i];
+	if (da)
+		pat[i] = 255;
+	for (i = p; i < BLOCK * p; i++)
+		pat[i] = pat[i - p];
+	for (j = 0; j < p; j++)
+	{
+		pv[j] = _mm_loadu_si128((const __m128i *)(pat + j * BLOCK));
+		pw[j] = SIMD_NAME(widen)(pv[j]);
+	}
+}
+
+/* Solid colour with constant alpha. */
+
+static inline SIMD_TARGET void
+SIMD_NAME(template_solid_color)(byte * restrict dp, int p, int w, const byte * restrict color, int da, fz_solid_color_painter_t *tail)
+{
+	int sa = FZ_EXPAND(color[p - da]);
+	__m128i pv[5];
+	W16 pw[5], a;
+	int j;
+
+	if (sa == 0)
+		return;
+	if (w >= BLOCK)
+	{
+		SIMD_NAME(color_pattern)(pv, pw, color, p, da);
+		a = SIMD_NAME(splat)(sa);
+		do
+		{
+			for (j = 0; j < p; j++)
+			{
+				__m128i *q = (__m128i *)(dp + j * BLOCK);
+				if (sa == 256)
+					_mm_storeu_si128(q, pv[j]);
+				else
+				{
+					W16 d = SIMD_NAME(widen)(_mm_loadu_si128(q));
+					_mm_storeu_si128(q, SIMD_NAME(narrow)(SIMD_NAME(blend)(pw[j], d, a)));
+				}
+			}
+			dp += BLOCK * p;
+			w -= BLOCK;
+		}
+		while (w >= BLOCK);
+	}
+	if (w)
+		tail(dp, p, w, color, da);
+}
+
+/* Solid colour through a mask. */
+
+static inline SIMD_TARGET void
+SIMD_NAME(template_span_with_color)(byte * restrict dp, const byte * restrict mp, int p, int w, const byte * restrict color, int da, fz_span_color_painter_t *tail)
+{
+	int sa = FZ_EXPAND(color[p - da]);
+	__m128i pv[5];
+	W16 pw[5], a;
+	int j;
+
+	if (sa == 0)
+		return;
+	if (w >= BLOCK)
+	{
+		SIMD_NAME(color_pattern)(pv, pw, color, p, da);
+		a = SIMD_NAME(splat)(sa);
+		do
+		{
+			__m128i f = _mm_loadu_si128((const __m128i *)mp);
+			if (SIMD_NAME(all_equal)(f, 0))
+			{
+			}
+			else if (sa == 256 && SIMD_NAME(all_equal)(f, 255))
+			{
+				for (j = 0; j < p; j++)
+					_mm_storeu_si128((__m128i *)(dp + j * BLOCK), pv[j]);
+			}
+			else
+			{
+				for (j = 0; j < p; j++)
+				{
+					__m128i *q = (__m128i *)(dp + j * BLOCK);
+					W16 ma = SIMD_NAME(expand)(SIMD_NAME(widen)(SIMD_NAME(spread)(f, p, j)));
+					W16 d = SIMD_NAME(widen)(_mm_loadu_si128(q));
+					if (sa != 256)
+						ma = SIMD_NAME(combine)(ma, a);
+					_mm_storeu_si128(q, SIMD_NAME(narrow)(SIMD_NAME(blend)(pw[j], d, ma)));
+				}
+			}
+			mp += BLOCK;
+			dp += BLOCK * p;
+			w -= BLOCK;
+		}
+		while (w >= BLOCK);
+	}
+	if (w)
+		tail(dp, mp, p, w, color, da);
+}
+
+/* Source through a mask. Pixels where the source alpha is zero are
+ * left untouched. */
+
+static inline SIMD_TARGET void
+SIMD_NAME(template_span_with_mask)(byte * restrict dp, const byte * restrict sp, const byte * restrict mp, int w, int n, int a, fz_span_mask_painter_t *tail)
+{
+	const int p = n + a;
+	int j;
+
+	while (w >= BLOCK)
+	{
+		__m128i f = _mm_loadu_si128((const __m128i *)mp);
+		if (!SIMD_NAME(all_equal)(f, 0))
+		{
+			for (j = 0; j < p; j++)
+			{
+				__m128i *q = (__m128i *)(dp + j * BLOCK);
+				__m128i s = _mm_loadu_si128((const __m128i *)(sp + j * BLOCK));
+				__m128i m = SIMD_NAME(spread)(f, p, j);
+				W16 ma;
+				if (a)
+				{
+					__m128i z = _mm_cmpeq_epi8(SIMD_NAME(spread_alpha)(s, p), _mm_setzero_si128());
+					m = _mm_andnot_si128(z, m);
+				}
+				ma = SIMD_NAME(expand)(SIMD_NAME(widen)(m));
+				_mm_storeu_si128(q, SIMD_NAME(narrow)(SIMD_NAME(blend)(SIMD_NAME(widen)(s), SIMD_NAME(widen)(_mm_loadu_si128(q)), ma)));
+			}
+		}
+		mp += BLOCK;
+		sp += BLOCK * p;
+		dp += BLOCK * p;
+		w -= BLOCK;
+	}
+	if (w)
+		tail(dp, sp, mp, w, n, a);
+}
+
+/* Source (with alpha) over destination (with alpha). */
+
+static inline SIMD_TARGET void
+SIMD_NAME(template_span_da_sa)(byte * restrict dp, const byte * restrict sp, int n, int w, fz_span_painter_t *tail)
+{
+	const int p = n + 1;
+	int j;
+
+	while (w >= BLOCK)
+	{
+		for (j = 0; j < p; j++)
+		{
+			__m128i *q = (__m128i *)(dp + j * BLOCK);
+			__m128i s = _mm_loadu_si128((const __m128i *)(sp + j * BLOCK));
+			__m128i sa = SIMD_NAME(spread_alpha)(s, p);
+			__m128i z = _mm_cmpeq_epi8(sa, _mm_setzero_si128());
+			__m128i d = _mm_loadu_si128(q);
+			W16 t = SIMD_NAME(invert)(SIMD_NAME(expand)(SIMD_NAME(widen)(sa)));
+			__m128i r = _mm_add_epi8(s, SIMD_NAME(narrow)(SIMD_NAME(combine)(SIMD_NAME(widen)(d), t)));
+			_mm_storeu_si128(q, _mm_or_si128(_mm_and_si128(z, d), _mm_andnot_si128(z, r)));
+		}
+		sp += BLOCK * p;
+		dp += BLOCK * p;
+		w -= BLOCK;
+	}
+	if (w)
+		tail(dp, 1, sp, 1, n, w, 255);
+}
+
+static inline SIMD_TARGET void
+SIMD_NAME(template_span_da_sa_alpha)(byte * restrict dp, const byte * restrict sp, int n, int w, int alpha, fz_span_painter_t *tail)
+{
+	const int p = n + 1;
+	W16 ea = SIMD_NAME(splat)(FZ_EXPAND(alpha));
+	int j;
+
+	while (w >= BLOCK)
+	{
+		for (j = 0; j < p; j++)
+		{
+			__m128i *q = (__m128i *)(dp + j * BLOCK);
+			__m128i s = _mm_loadu_si128((const __m128i *)(sp + j * BLOCK));
+			W16 masa = SIMD_NAME(combine)(SIMD_NAME(widen)(SIMD_NAME(spread_alpha)(s, p)), ea);
+			W16 d = SIMD_NAME(widen)(_mm_loadu_si128(q));
+			_mm_storeu_si128(q, SIMD_NAME(narrow)(SIMD_NAME(blend)(SIMD_NAME(widen)(s), d, masa)));
+		}
+		sp += BLOCK * p;
+		dp += BLOCK * p;
+		w -= BLOCK;
+	}
+	if (w)
+		tail(dp, 1, sp, 1, n, w, alpha);
+}
+
+/* The painters themselves. */
+
+#define SOLID(P, NAME, DA, TAIL) \
+static SIMD_TARGET void \
+SIMD_NAME(paint_solid_color_##NAME)(byte * restrict dp, int n, int w, const byte * restrict color, int da) \
+{ \
+	TRACK_FN(); \
+	SIMD_NAME(template_solid_color)(dp, P, w, color, DA, TAIL); \
+}
+
+#define SPAN_COLOR(P, NAME, DA, TAIL) \
+static SIMD_TARGET void \
+SIMD_NAME(paint_span_with_color_##NAME)(byte * restrict dp, const byte * restrict mp, int n, int w, const byte * restrict color, int da) \
+{ \
+	TRACK_FN(); \
+	SIMD_NAME(template_span_with_color)(dp, mp, P, w, color, DA, TAIL); \
+}
+
+#define SPAN_MASK(N, NAME, A, TAIL) \
+static SIMD_TARGET void \
+SIMD_NAME(paint_span_with_mask_##NAME)(byte * restrict dp, const byte * restrict sp, const byte * restrict mp, int w, int n, int a) \
+{ \
+	TRACK_FN(); \
+	SIMD_NAME(template_span_with_mask)(dp, sp, mp, w, N, A, TAIL); \
+}
+
+#define SPAN_DA_SA(N, TAIL, TAIL_ALPHA) \
+static SIMD_TARGET void \
+SIMD_NAME(paint_span_##N##_da_sa)(byte * restrict dp, int da, const byte * restrict sp, int sa, int n, int w, int alpha) \
+{ \
+	TRACK_FN(); \
+	SIMD_NAME(template_span_da_sa)(dp, sp, N, w, TAIL); \
+} \
+static SIMD_TARGET void \
+SIMD_NAME(paint_span_##N##_da_sa_alpha)(byte * restrict dp, int da, const byte * restrict sp, int sa, int n, int w, int alpha) \
+{ \
+	TRACK_FN(); \
+	SIMD_NAME(template_span_da_sa_alpha)(dp, sp, N, w, alpha, TAIL_ALPHA); \
+}
+
+#if FZ_PLOTTERS_G
+SOLID(1, 1, 0, paint_solid_color_1_alpha)
+SOLID(2, 1_da, 1, paint_solid_color_1_da)
+#endif /* FZ_PLOTTERS_G */
+#if FZ_PLOTTERS_RGB
+SOLID(3, 3, 0, paint_solid_color_3_alpha)
+SOLID(4, 3_da, 1, paint_solid_color_3_da)
+#endif /* FZ_PLOTTERS_RGB */
+#if FZ_PLOTTERS_CMYK
+SOLID(4, 4, 0, paint_solid_color_4_alpha)
+SOLID(5, 4_da, 1, paint_solid_color_4_da)
+#endif /* FZ_PLOTTERS_CMYK */
+
+SPAN_COLOR(1, 1, 0, paint_span_with_color_1)
+SPAN_COLOR(2, 1_da, 1, paint_span_with_color_1_da)
+#if FZ_PLOTTERS_RGB
+SPAN_COLOR(4, 3_da, 1, paint_span_with_color_3_da)
+#ifdef SIMD_AVX2
+SPAN_COLOR(3, 3, 0, paint_span_with_color_3)
+#endif /* SIMD_AVX2 */
+#endif /* FZ_PLOTTERS_RGB */
+#if FZ_PLOTTERS_CMYK
+SPAN_COLOR(4, 4, 0, paint_span_with_color_4)
+#ifdef SIMD_AVX2
+SPAN_COLOR(5, 4_da, 1, paint_span_with_color_4_da)
+#endif /* SIMD_AVX2 */
+#endif /* FZ_PLOTTERS_CMYK */
+
+SPAN_MASK(0, 0_a, 1, paint_span_with_mask_0_a)
+SPAN_MASK(1, 1, 0, paint_span_with_mask_1)
+SPAN_MASK(1, 1_a, 1, paint_span_with_mask_1_a)
+#if FZ_PLOTTERS_RGB
+SPAN_MASK(3, 3_a, 1, paint_span_with_mask_3_a)
+#ifdef SIMD_AVX2
+SPAN_MASK(3, 3, 0, paint_span_with_mask_3)
+#endif /* SIMD_AVX2 */
+#endif /* FZ_PLOTTERS_RGB */
+#if FZ_PLOTTERS_CMYK
+SPAN_MASK(4, 4, 0, paint_span_with_mask_4)
+#endif /* FZ_PLOTTERS_CMYK */
+
+SPAN_DA_SA(0, paint_span_0_da_sa, paint_span_0_da_sa_alpha)
+SPAN_DA_SA(1, paint_span_1_da_sa, paint_span_1_da_sa_alpha)
+#if FZ_PLOTTERS_RGB
+SPAN_DA_SA(3, paint_span_3_da_sa, paint_span_3_da_sa_alpha)
+#endif /* FZ_PLOTTERS_RGB */
+
+#undef SOLID
+#undef SPAN_COLOR
+#undef SPAN_MASK
+#undef SPAN_DA_SA
+#undef BLOCK
+#undef W16
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef SIMD_AVX2
@@ -196,6 +196,97 @@ fz_pack_path(fz_context *ctx, uint8_t *pack_, int max, const fz_path *path)
 	}
 }
 
+int
+fz_packed_path_data(const fz_path *path, size_t size, const float **coords, int *coord_len, const unsigned char **cmds, int *cmd_len)
+{
+	if (size < sizeof(fz_packed_path))
+		return -1;
+
+	switch (path->packed)
+	{
+	case FZ_PATH_PACKED_OPEN:
+		if (size < sizeof(fz_path))
+			return -1;
+		*coords = path->coords;
+		*coord_len = path->coord_len;
+		*cmds = path->cmds;
+		*cmd_len = path->cmd_len;
+		return 1;
+	case FZ_PATH_PACKED_FLAT:
+	{
+		fz_packed_path *pack = (fz_packed_path *)path;
+		if (size < sizeof(fz_packed_path) + sizeof(float) * pack->coord_len + pack->cmd_len)
+			return -1;
+		*coords = (const float *)&pack[1];
+		*coord_len = pack->coord_len;
+		*cmds = (const unsigned char *)&(*coords)[pack->coord_len];
+		*cmd_len = pack->cmd_len;
+		return 0;
+	}
+	default:
+		return -1;
+	}
+}
+
+int
+fz_path_data_is_valid(const unsigned char *cmds, int cmd_len, int coord_len)
+{
+	int i, k = 0;
+
+	for (i = 0; i < cmd_len; i++)
+	{
+		switch (cmds[i])
+		{
+		case FZ_CURVETO:
+		case FZ_CURVETOCLOSE:
+			k += 6;
+			break;
+		case FZ_CURVETOV:
+		case FZ_CURVETOVCLOSE:
+		case FZ_CURVETOY:
+		case FZ_CURVETOYCLOSE:
+		case FZ_QUADTO:
+		case FZ_QUADTOCLOSE:
+		case FZ_RECTTO:
+			k += 4;
+			break;
+		case FZ_MOVETO:
+		case FZ_MOVETOCLOSE:
+		case FZ_LINETO:
+		case FZ_LINETOCLOSE:
+			k += 2;
+			break;
+		case FZ_HORIZTO:
+		case FZ_HORIZTOCLOSE:
+		case FZ_VERTTO:
+		case FZ_VERTTOCLOSE:
+			k += 1;
+			break;
+		case FZ_DEGENLINETO:
+		case FZ_DEGENLINETOCLOSE:
+			break;
+		default:
+			return 0;
+		}
+	}
+
+	return k <= coord_len;
+}
+
+void
+fz_set_packed_path_data(fz_path *path, float *coords, unsigned char *cmds)
+{
+	/* A path with no references is never freed */
+	path->refs = -1;
+	if (path->packed == FZ_PATH_PACKED_OPEN)
+	{
+		path->coords = coords;
+		path->coord_cap = path->coord_len;
+		path->cmds = cmds;
+		path->cmd_cap = path->cmd_len;
+	}
+}
+
 static void
 push_cmd(fz_context *ctx, fz_path *path, int cmd)
 {
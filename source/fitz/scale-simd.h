@@ -0,0 +1,421 @@
+/*
+	This file is #included by draw-scale-simple.c twice, to produce
+	the SSE4.1 and the AVX2 versions of the row scalers.
+
+	The sums are formed in 32 bit lanes with exactly the same products
+	as the C versions, and the result byte is picked out of bits 8 to
+	15 of each sum just as the (unsigned char)(val>>8) casts do, so the
+	output is bit for bit identical to theirs.
+
+	The horizontal scalers vectorise across the components of a pixel
+	(and, for AVX2, across pairs of source pixels). The vertical ones
+	vectorise across the row, 16 bytes at a time. We never read a byte
+	of the source that the C versions would not have read.
+*/
+
+#ifdef SIMD_AVX2
+#define SIMD_TARGET FZ_TARGET_AVX2
+#define SIMD_NAME(NAME) NAME##_avx2
+#else
+#define SIMD_TARGET FZ_TARGET_SSE4_1
+#define SIMD_NAME(NAME) NAME##_sse4_1
+#endif
+
+static inline SIMD_TARGET __m128i
+SIMD_NAME(load_u32)(const unsigned char *p)
+{
+	int v;
+	memcpy(&v, p, 4);
+	return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(v));
+}
+
+static inline SIMD_TARGET __m128i
+SIMD_NAME(load_u24)(const unsigned char *p)
+{
+	return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(p[0] | (p[1]<<8) | (p[2]<<16)));
+}
+
+static inline SIMD_TARGET __m128i
+SIMD_NAME(load_u16)(const unsigned char *p)
+{
+	return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(p[0] | (p[1]<<8)));
+}
+
+/* Returns (unsigned char)(val>>8) of each lane, packed into an int. */
+static inline SIMD_TARGET int
+SIMD_NAME(pick)(__m128i v)
+{
+	const __m128i pick = _mm_setr_epi8(1, 5, 9, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+	return _mm_cvtsi128_si32(_mm_shuffle_epi8(v, pick));
+}
+
+static inline SIMD_TARGET __m128i
+SIMD_NAME(pack)(__m128i a, __m128i b, __m128i c, __m128i d)
+{
+	const __m128i lo = _mm_set1_epi32(255);
+	a = _mm_and_si128(_mm_srai_epi32(a, 8), lo);
+	b = _mm_and_si128(_mm_srai_epi32(b, 8), lo);
+	c = _mm_and_si128(_mm_srai_epi32(c, 8), lo);
+	d = _mm_and_si128(_mm_srai_epi32(d, 8), lo);
+	return _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d));
+}
+
+#ifdef SIMD_AVX2
+
+static inline SIMD_TARGET __m128i
+SIMD_NAME(fold)(__m256i v)
+{
+	return _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+}
+
+/* Two weights, each repeated over a 128 bit half. */
+static inline SIMD_TARGET __m256i
+SIMD_NAME(weight_pair)(const int *contrib)
+{
+	const __m256i spread = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+	return _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)contrib)), spread);
+}
+
+#endif /* SIMD_AVX2 */
+
+static SIMD_TARGET void
+SIMD_NAME(scale_row_to_temp1)(unsigned char * restrict dst, const unsigned char * restrict src, const fz_weights * restrict weights)
+{
+	const int *contrib = &weights->index[weights->index[0]];
+	int len, i, step;
+	const unsigned char *min;
+
+	assert(weights->n == 1);
+	step = 1;
+	if (weights->flip)
+	{
+		dst += weights->count-1;
+		step = -1;
+	}
+	for (i=weights->count; i > 0; i--)
+	{
+		__m128i acc;
+		int val;
+
+		min = &src[*contrib++];
+		len = *contrib++;
+#ifdef SIMD_AVX2
+		{
+			__m256i acc8 = _mm256_setzero_si256();
+			for (; len >= 8; len -= 8)
+			{
+				__m256i s = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)min));
+				__m256i w = _mm256_loadu_si256((const __m256i *)contrib);
+				acc8 = _mm256_add_epi32(acc8, _mm256_mullo_epi32(s, w));
+				min += 8;
+				contrib += 8;
+			}
+			acc = SIMD_NAME(fold)(acc8);
+		}
+#else
+		acc = _mm_setzero_si128();
+#endif
+		for (; len >= 4; len -= 4)
+		{
+			__m128i w = _mm_loadu_si128((const __m128i *)contrib);
+			acc = _mm_add_epi32(acc, _mm_mullo_epi32(SIMD_NAME(load_u32)(min), w));
+			min += 4;
+			contrib += 4;
+		}
+		acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4e));
+		acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xb1));
+		val = 128 + _mm_cvtsi128_si32(acc);
+		while (len-- > 0)
+		{
+			val += *min++ * *contrib++;
+		}
+		*dst = (unsigned char)(val>>8);
+		dst += step;
+	}
+}
+
+static SIMD_TARGET void
+SIMD_NAME(scale_row_to_temp2)(unsigned char * restrict dst, const unsigned char * restrict src, const fz_weights * restrict weights)
+{
+	const int *contrib = &weights->index[weights->index[0]];
+	int len, i, step, val;
+	const unsigned char *min;
+
+	assert(weights->n == 2);
+	step = 2;
+	if (weights->flip)
+	{
+		dst += 2*(weights->count-1);
+		step = -2;
+	}
+	for (i=weights->count; i > 0; i--)
+	{
+		__m128i acc;
+
+		min = &src[2 * *contrib++];
+		len = *contrib++;
+#ifdef SIMD_AVX2
+		{
+			const __m256i spread = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+			__m256i acc8 = _mm256_setzero_si256();
+			for (; len >= 4; len -= 4)
+			{
+				__m256i s = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)min));
+				__m256i w = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)contrib)), spread);
+				acc8 = _mm256_add_epi32(acc8, _mm256_mullo_epi32(s, w));
+				min += 8;
+				contrib += 4;
+			}
+			acc = SIMD_NAME(fold)(acc8);
+		}
+#else
+		acc = _mm_setzero_si128();
+#endif
+		for (; len >= 2; len -= 2)
+		{
+			__m128i w = _mm_loadl_epi64((const __m128i *)contrib);
+			w = _mm_unpacklo_epi32(w, w);
+			acc = _mm_add_epi32(acc, _mm_mullo_epi32(SIMD_NAME(load_u32)(min), w));
+			min += 4;
+			contrib += 2;
+		}
+		acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4e));
+		if (len > 0)
+		{
+			acc = _mm_add_epi32(acc, _mm_mullo_epi32(SIMD_NAME(load_u16)(min), _mm_set1_epi32(*contrib++)));
+		}
+		val = SIMD_NAME(pick)(_mm_add_epi32(acc, _mm_set1_epi32(128)));
+		dst[0] = (unsigned char)val;
+		dst[1] = (unsigned char)(val>>8);
+		dst += step;
+	}
+}
+
+static SIMD_TARGET void
+SIMD_NAME(scale_row_to_temp3)(unsigned char * restrict dst, const unsigned char * restrict src, const fz_weights * restrict weights)
+{
+	const int *contrib = &weights->index[weights->index[0]];
+	int len, i, step, val;
+	const unsigned char *min;
+
+	assert(weights->n == 3);
+	step = 3;
+	if (weights->flip)
+	{
+		dst += 3*(weights->count-1);
+		step = -3;
+	}
+	for (i=weights->count; i > 0; i--)
+	{
+		__m128i acc;
+
+		min = &src[3 * *contrib++];
+		len = *contrib++;
+#ifdef SIMD_AVX2
+		{
+			/* Reading 8 bytes for 2 pixels is safe as long as a
+			 * third one follows. */
+			const __m128i split = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+			__m256i acc8 = _mm256_setzero_si256();
+			for (; len >= 3; len -= 2)
+			{
+				__m128i s = _mm_shuffle_epi8(_mm_loadl_epi64((const __m128i *)min), split);
+				acc8 = _mm256_add_epi32(acc8, _mm256_mullo_epi32(_mm256_cvtepu8_epi32(s), SIMD_NAME(weight_pair)(contrib)));
+				min += 6;
+				contrib += 2;
+			}
+			acc = SIMD_NAME(fold)(acc8);
+		}
+#else
+		acc = _mm_setzero_si128();
+#endif
+		/* Likewise, reading 4 bytes for a pixel is safe if another follows. */
+		for (; len > 1; len--)
+		{
+			acc = _mm_add_epi32(acc, _mm_mullo_epi32(SIMD_NAME(load_u32)(min), _mm_set1_epi32(*contrib++)));
+			min += 3;
+		}
+		if (len > 0)
+		{
+			acc = _mm_add_epi32(acc, _mm_mullo_epi32(SIMD_NAME(load_u24)(min), _mm_set1_epi32(*contrib++)));
+		}
+		val = SIMD_NAME(pick)(_mm_add_epi32(acc, _mm_set1_epi32(128)));
+		dst[0] = (unsigned char)val;
+		dst[1] = (unsigned char)(val>>8);
+		dst[2] = (unsigned char)(val>>16);
+		dst += step;
+	}
+}
+
+static SIMD_TARGET void
+SIMD_NAME(scale_row_to_temp4)(unsigned char * restrict dst, const unsigned char * restrict src, const fz_weights * restrict weights)
+{
+	const int *contrib = &weights->index[weights->index[0]];
+	int len, i, step, val;
+	const unsigned char *min;
+
+	assert(weights->n == 4);
+	step = 4;
+	if (weights->flip)
+	{
+		dst += 4*(weights->count-1);
+		step = -4;
+	}
+	for (i=weights->count; i > 0; i--)
+	{
+		__m128i acc;
+
+		min = &src[4 * *contrib++];
+		len = *contrib++;
+#ifdef SIMD_AVX2
+		{
+			__m256i acc8 = _mm256_setzero_si256();
+			for (; len >= 2; len -= 2)
+			{
+				__m256i s = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)min));
+				acc8 = _mm256_add_epi32(acc8, _mm256_mullo_epi32(s, SIMD_NAME(weight_pair)(contrib)));
+				min += 8;
+				contrib += 2;
+			}
+			acc = SIMD_NAME(fold)(acc8);
+		}
+#else
+		acc = _mm_setzero_si128();
+#endif
+		for (; len > 0; len--)
+		{
+			acc = _mm_add_epi32(acc, _mm_mullo_epi32(SIMD_NAME(load_u32)(min), _mm_set1_epi32(*contrib++)));
+			min += 4;
+		}
+		val = SIMD_NAME(pick)(_mm_add_epi32(acc, _mm_set1_epi32(128)));
+		memcpy(dst, &val, 4);
+		dst += step;
+	}
+}
+
+/* Scale 16 bytes of a row from the temporary buffer. */
+static inline SIMD_TARGET void
+SIMD_NAME(scale_block_from_temp)(unsigned char * restrict dst, const unsigned char * restrict src, const int * restrict contrib, int len, int width)
+{
+#ifdef SIMD_AVX2
+	__m256i acc0 = _mm256_set1_epi32(128);
+	__m256i acc1 = acc0;
+
+	while (len-- > 0)
+	{
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m256i w = _mm256_set1_epi32(*contrib++);
+		acc0 = _mm256_add_epi32(acc0, _mm256_mullo_epi32(_mm256_cvtepu8_epi32(s), w));
+		acc1 = _mm256_add_epi32(acc1, _mm256_mullo_epi32(_mm256_cvtepu8_epi32(_mm_srli_si128(s, 8)), w));
+		src += width;
+	}
+	_mm_storeu_si128((__m128i *)dst, SIMD_NAME(pack)(
+		_mm256_castsi256_si128(acc0), _mm256_extracti128_si256(acc0, 1),
+		_mm256_castsi256_si128(acc1), _mm256_extracti128_si256(acc1, 1)));
+#else
+	__m128i acc0 = _mm_set1_epi32(128);
+	__m128i acc1 = acc0;
+	__m128i acc2 = acc0;
+	__m128i acc3 = acc0;
+
+	while (len-- > 0)
+	{
+		__m128i s = _mm_loadu_si128((const __m128i *)src);
+		__m128i w = _mm_set1_epi32(*contrib++);
+		acc0 = _mm_add_epi32(acc0, _mm_mullo_epi32(_mm_cvtepu8_epi32(s), w));
+		acc1 = _mm_add_epi32(acc1, _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(s, 4)), w));
+		acc2 = _mm_add_epi32(acc2, _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(s, 8)), w));
+		acc3 = _mm_add_epi32(acc3, _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_srli_si128(s, 12)), w));
+		src += width;
+	}
+	_mm_storeu_si128((__m128i *)dst, SIMD_NAME(pack)(acc0, acc1, acc2, acc3));
+#endif
+}
+
+static SIMD_TARGET void
+SIMD_NAME(scale_row_from_temp)(unsigned char * restrict dst, const unsigned char * restrict src, const fz_weights * restrict weights, int w, int n, int row)
+{
+	const int *contrib = &weights->index[weights->index[row]];
+	int len, x;
+	int width = w * n;
+
+	if (width < 16)
+	{
+		scale_row_from_temp(dst, src, weights, w, n, row);
+		return;
+	}
+
+	contrib++; /* Skip min */
+	len = *contrib++;
+	for (x = 0; x + 16 <= width; x += 16)
+		SIMD_NAME(scale_block_from_temp)(dst + x, src + x, contrib, len, width);
+	/* Redo the last 16 bytes to pick up any odd ones at the end. */
+	if (x < width)
+		SIMD_NAME(scale_block_from_temp)(dst + width - 16, src + width - 16, contrib, len, width);
+}
+
+static SIMD_TARGET void
+SIMD_NAME(scale_row_from_temp_alpha)(unsigned char * restrict dst, const unsigned char * restrict src, const fz_weights * restrict weights, int w, int n, int row)
+{
+	unsigned char *d, *s;
+	int x, k;
+
+	if (w * n < 16)
+	{
+		scale_row_from_temp_alpha(dst, src, weights, w, n, row);
+		return;
+	}
+
+	/* Scale the colorants into the start of the row, and then spread
+	 * them out from the end backwards to make room for the alpha. The
+	 * reads always stay at or behind the writes. */
+	SIMD_NAME(scale_row_from_temp)(dst, src, weights, w, n, row);
+
+	x = w;
+	if (n == 1)
+	{
+		const __m128i ff = _mm_set1_epi8(-1);
+		for (; x >= 8; x -= 8)
+		{
+			__m128i v = _mm_loadl_epi64((const __m128i *)(dst + x - 8));
+			_mm_storeu_si128((__m128i *)(dst + 2 * (x - 8)), _mm_unpacklo_epi8(v, ff));
+		}
+	}
+	else if (n == 3)
+	{
+		const __m128i spread = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+		const __m128i alpha = _mm_set1_epi32(0xff000000);
+		for (; x >= 4; x -= 4)
+		{
+			__m128i v = _mm_loadu_si128((const __m128i *)(dst + 3 * (x - 4)));
+			v = _mm_or_si128(_mm_shuffle_epi8(v, spread), alpha);
+			_mm_storeu_si128((__m128i *)(dst + 4 * (x - 4)), v);
+		}
+	}
+
+	d = dst + x * (n+1);
+	s = dst + x * n;
+	for (; x > 0; x--)
+	{
+		*--d = 255;
+		for (k = n; k > 0; k--)
+			*--d = *--s;
+	}
+}
+
+static void
+SIMD_NAME(select_row_scalers)(int n, int forcealpha, scale_row_in_fn **in, scale_row_out_fn **out)
+{
+	switch (n)
+	{
+	case 1: *in = SIMD_NAME(scale_row_to_temp1); break;
+	case 2: *in = SIMD_NAME(scale_row_to_temp2); break;
+	case 3: *in = SIMD_NAME(scale_row_to_temp3); break;
+	case 4: *in = SIMD_NAME(scale_row_to_temp4); break;
+	}
+	*out = forcealpha ? SIMD_NAME(scale_row_from_temp_alpha) : SIMD_NAME(scale_row_from_temp);
+}
+
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef SIMD_AVX2
@@ -0,0 +1,148 @@
+/*
+	This file is #included by draw-mesh.c twice, to produce the SSE2
+	and the AVX2 versions of the axial and radial row evaluators.
+
+	Each pass of the loop finds the colour table index of 4 (or 8)
+	pixels of the row at once, with the same operations in the same
+	order as eval_axial_row and eval_radial_row. The comparisons,
+	minimums and maximums are the ones that treat a NaN the way the
+	C does, so the indexes are the same as theirs. The pixels left
+	over at the end of a row are handed to the C versions.
+*/
+
+#ifdef SIMD_AVX2
+#define SIMD_TARGET FZ_TARGET_AVX2
+#define SIMD_NAME(NAME) NAME##_avx2
+#define SIMD_LANES 8
+#define VF __m256
+#define VF_SET1 _mm256_set1_ps
+#define VF_ADD _mm256_add_ps
+#define VF_SUB _mm256_sub_ps
+#define VF_MUL _mm256_mul_ps
+#define VF_DIV _mm256_div_ps
+#define VF_SQRT _mm256_sqrt_ps
+#define VF_MIN _mm256_min_ps
+#define VF_MAX _mm256_max_ps
+#define VF_AND _mm256_and_ps
+#define VF_OR _mm256_or_ps
+#define VF_ANDNOT _mm256_andnot_ps
+#define VF_GE(A, B) _mm256_cmp_ps(A, B, _CMP_GE_OQ)
+#define VF_LE(A, B) _mm256_cmp_ps(A, B, _CMP_LE_OQ)
+#define VF_XS(X) _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32(X), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)))
+#define VF_INDEX(T) _mm256_castsi256_ps(_mm256_cvttps_epi32(T))
+#define VF_STORE(P, V) _mm256_storeu_ps((float *)(P), V)
+#else
+#define SIMD_TARGET FZ_TARGET_SSE2
+#define SIMD_NAME(NAME) NAME##_sse2
+#define SIMD_LANES 4
+#define VF __m128
+#define VF_SET1 _mm_set1_ps
+#define VF_ADD _mm_add_ps
+#define VF_SUB _mm_sub_ps
+#define VF_MUL _mm_mul_ps
+#define VF_DIV _mm_div_ps
+#define VF_SQRT _mm_sqrt_ps
+#define VF_MIN _mm_min_ps
+#define VF_MAX _mm_max_ps
+#define VF_AND _mm_and_ps
+#define VF_OR _mm_or_ps
+#define VF_ANDNOT _mm_andnot_ps
+#define VF_GE(A, B) _mm_cmpge_ps(A, B)
+#define VF_LE(A, B) _mm_cmple_ps(A, B)
+#define VF_XS(X) _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(X), _mm_setr_epi32(0, 1, 2, 3)))
+#define VF_INDEX(T) _mm_castsi128_ps(_mm_cvttps_epi32(T))
+#define VF_STORE(P, V) _mm_storeu_ps((float *)(P), V)
+#endif
+
+/* (t < 0 ? 0 : t > 1 ? 1 : t) * 255 where in is set, and -1 elsewhere. */
+static inline SIMD_TARGET VF
+SIMD_NAME(shade_index)(VF t, VF in)
+{
+	const VF zero = VF_SET1(0);
+	const VF ones = VF_GE(zero, zero);
+	t = VF_MIN(VF_MAX(t, zero), VF_SET1(1));
+	return VF_OR(VF_AND(in, VF_INDEX(VF_MUL(t, VF_SET1(255)))), VF_ANDNOT(in, ones));
+}
+
+static SIMD_TARGET void
+SIMD_NAME(eval_axial_row)(const shade_eval *ev, int *out, int x, int i, int w)
+{
+	const VF zero = VF_SET1(0);
+	const VF one = VF_SET1(1);
+	const VF ext0 = ev->extend[0] ? VF_GE(zero, zero) : zero;
+	const VF ext1 = ev->extend[1] ? VF_GE(zero, zero) : zero;
+	const VF tx = VF_SET1(ev->tx);
+	const VF rt = VF_SET1(ev->rt);
+
+	for (; i + SIMD_LANES <= w; i += SIMD_LANES)
+	{
+		VF t = VF_ADD(VF_MUL(tx, VF_XS(x + i)), rt);
+		VF in = VF_AND(VF_OR(VF_GE(t, zero), ext0), VF_OR(VF_LE(t, one), ext1));
+		VF_STORE(out + i, SIMD_NAME(shade_index)(t, in));
+	}
+	eval_axial_row(ev, out, x, i, w);
+}
+
+/* Only for ev->a != 0; the C version deals with the other case. */
+static SIMD_TARGET void
+SIMD_NAME(eval_radial_row)(const shade_eval *ev, int *out, int x, int i, int w)
+{
+	const VF zero = VF_SET1(0);
+	const VF one = VF_SET1(1);
+	const VF ext0 = ev->extend[0] ? VF_GE(zero, zero) : zero;
+	const VF ext1 = ev->extend[1] ? VF_GE(zero, zero) : zero;
+	const VF ia = VF_SET1(ev->ia), ib = VF_SET1(ev->ib);
+	const VF rx = VF_SET1(ev->rx), ry = VF_SET1(ev->ry);
+	const VF cdx = VF_SET1(ev->cdx), cdy = VF_SET1(ev->cdy);
+	const VF r0 = VF_SET1(ev->r0), dr = VF_SET1(ev->dr);
+	const VF r0dr = VF_SET1(ev->r0dr), r0r0 = VF_SET1(ev->r0r0);
+	const VF a = VF_SET1(ev->a);
+
+	for (; i + SIMD_LANES <= w; i += SIMD_LANES)
+	{
+		VF fx = VF_XS(x + i);
+		VF pdx = VF_ADD(VF_MUL(ia, fx), rx);
+		VF pdy = VF_ADD(VF_MUL(ib, fx), ry);
+		VF b = VF_ADD(VF_ADD(VF_MUL(pdx, cdx), VF_MUL(pdy, cdy)), r0dr);
+		VF c = VF_SUB(VF_ADD(VF_MUL(pdx, pdx), VF_MUL(pdy, pdy)), r0r0);
+		VF d = VF_SUB(VF_MUL(b, b), VF_MUL(a, c));
+		VF in = VF_GE(d, zero);
+		VF s1, s2, hi, lo, hi_ok, lo_ok, t;
+
+		d = VF_SQRT(d);
+		s1 = VF_DIV(VF_ADD(b, d), a);
+		s2 = VF_DIV(VF_SUB(b, d), a);
+		hi = VF_MAX(s1, s2);
+		lo = VF_MIN(s1, s2);
+		hi_ok = VF_AND(VF_GE(VF_ADD(r0, VF_MUL(hi, dr)), zero),
+			VF_AND(VF_OR(VF_GE(hi, zero), ext0), VF_OR(VF_LE(hi, one), ext1)));
+		lo_ok = VF_AND(VF_GE(VF_ADD(r0, VF_MUL(lo, dr)), zero),
+			VF_AND(VF_OR(VF_GE(lo, zero), ext0), VF_OR(VF_LE(lo, one), ext1)));
+		t = VF_OR(VF_AND(hi_ok, hi), VF_ANDNOT(hi_ok, lo));
+		in = VF_AND(in, VF_OR(hi_ok, lo_ok));
+		VF_STORE(out + i, SIMD_NAME(shade_index)(t, in));
+	}
+	eval_radial_row(ev, out, x, i, w);
+}
+
+#undef VF_STORE
+#undef VF_INDEX
+#undef VF_XS
+#undef VF_LE
+#undef VF_GE
+#undef VF_ANDNOT
+#undef VF_OR
+#undef VF_AND
+#undef VF_MAX
+#undef VF_MIN
+#undef VF_SQRT
+#undef VF_DIV
+#undef VF_MUL
+#undef VF_SUB
+#undef VF_ADD
+#undef VF_SET1
+#undef VF
+#undef SIMD_LANES
+#undef SIMD_NAME
+#undef SIMD_TARGET
+#undef SIMD_AVX2
@@ -8,6 +8,10 @@ struct fz_mesh_processor_s {
 	fz_shade_process_fn *process;
 	void *process_arg;
 	int ncomp;
+	const fz_rect *scissor;
+	float color_tol[FZ_MAX_COLORS];
+	fz_vertex *grid;
+	float (*grid_color)[FZ_MAX_COLORS];
 };
 
 #define SWAP(a,b) {fz_vertex *t = (a); (a) = (b); (b) = t;}
@@ -450,24 +454,6 @@ struct tensor_patch_s
 	float color[4][FZ_MAX_COLORS];
 };
 
-static void
-triangulate_patch(fz_context *ctx, fz_mesh_processor *painter, tensor_patch p)
-{
-	fz_vertex v0, v1, v2, v3;
-
-	v0.p = p.pole[0][0];
-	v1.p = p.pole[0][3];
-	v2.p = p.pole[3][3];
-	v3.p = p.pole[3][0];
-
-	fz_prepare_color(ctx, painter, &v0, p.color[0]);
-	fz_prepare_color(ctx, painter, &v1, p.color[1]);
-	fz_prepare_color(ctx, painter, &v2, p.color[2]);
-	fz_prepare_color(ctx, painter, &v3, p.color[3]);
-
-	paint_quad(ctx, painter, &v0, &v1, &v2, &v3);
-}
-
 static inline void midcolor(float *c, float *c1, float *c2, int n)
 {
 	int i;
@@ -535,29 +521,6 @@ split_stripe(tensor_patch *p, tensor_patch *s0, tensor_patch *s1, int n)
 	memcpy(s1->color[3], p->color[3], n * sizeof(s1->color[3][0]));
 }
 
-static void
-draw_stripe(fz_context *ctx, fz_mesh_processor *painter, tensor_patch *p, int depth)
-{
-	tensor_patch s0, s1;
-
-	/* split patch into two half-height patches */
-	split_stripe(p, &s0, &s1, painter->ncomp);
-
-	depth--;
-	if (depth == 0)
-	{
-		/* if no more subdividing, draw two new patches... */
-		triangulate_patch(ctx, painter, s1);
-		triangulate_patch(ctx, painter, s0);
-	}
-	else
-	{
-		/* ...otherwise, continue subdividing. */
-		draw_stripe(ctx, painter, &s1, depth);
-		draw_stripe(ctx, painter, &s0, depth);
-	}
-}
-
 static void
 split_patch(tensor_patch *p, tensor_patch *s0, tensor_patch *s1, int n)
 {
@@ -582,27 +545,281 @@ split_patch(tensor_patch *p, tensor_patch *s0, tensor_patch *s1, int n)
 	memcpy(s1->color[3], s0->color[2], n * sizeof(s1->color[3][0]));
 }
 
+/*
+	Each patch is drawn as a grid of quads, 2^lj across in the j
+	direction and 2^li in the i direction. The levels are chosen
+	from the patch as it is in device space, so that the curves of
+	each cell are within PATCH_FLATNESS pixels of evenly spaced
+	straight lines, its colours change by no more than PATCH_COLOR_STEPS
+	steps (of 1/256 of their range), and its colours depart from a
+	plane by less than a step; but cells are not made much smaller
+	than a pixel. Patches outside the scissor are dropped.
+
+	Patches that share an edge may well be split differently. So that
+	no cracks open up between them, every edge also has a level of
+	its own, worked out from the edge alone (and so the same for
+	both patches), that the patch levels are raised to. Where a patch
+	splits an edge more finely than that, the extra points are moved
+	onto the straight lines that the coarser patch draws.
+*/
+#define PATCH_FLATNESS 0.25f
+#define PATCH_COLOR_STEPS 32
+#define PATCH_MAX_LEVEL 6
+#define PATCH_GRID ((1 << PATCH_MAX_LEVEL) + 1)
+
+/* How far the inner poles of a curve are from where they would be
+ * if it were a straight line. The same either way along the curve. */
+static inline float
+curve_flatness(const fz_point *q, int polestep)
+{
+	float x0 = q[0].x, y0 = q[0].y;
+	float x3 = q[3 * polestep].x, y3 = q[3 * polestep].y;
+	float d = fabsf(q[1 * polestep].x - (2 * x0 + x3) / 3);
+	d = fz_max(d, fabsf(q[1 * polestep].y - (2 * y0 + y3) / 3));
+	d = fz_max(d, fabsf(q[2 * polestep].x - (x0 + 2 * x3) / 3));
+	d = fz_max(d, fabsf(q[2 * polestep].y - (y0 + 2 * y3) / 3));
+	return d;
+}
+
+/* An upper bound on the length of a curve, in pixels. Taken as a
+ * maximum rather than a sum, so that it too is the same either way. */
+static inline float
+curve_length(const fz_point *q, int polestep)
+{
+	float d = 0;
+	int i;
+	for (i = 0; i < 3; i++)
+	{
+		d = fz_max(d, fabsf(q[(i + 1) * polestep].x - q[i * polestep].x));
+		d = fz_max(d, fabsf(q[(i + 1) * polestep].y - q[i * polestep].y));
+	}
+	return d * 3;
+}
+
+/* The level needed for flatness, colour change and twist (the
+ * colour change and twist measured in steps), limited by size. */
+static int
+patch_level(float flat, float color, float twist, float len)
+{
+	int level = 0;
+	while (level < PATCH_MAX_LEVEL && len > 1 &&
+		(flat > PATCH_FLATNESS || color > PATCH_COLOR_STEPS || twist > 1))
+	{
+		level++;
+		flat /= 4;
+		color /= 2;
+		twist /= 2;
+		len /= 2;
+	}
+	return level;
+}
+
+static int
+edge_level(fz_mesh_processor *painter, const fz_point *q, int polestep, const float *ca, const float *cb)
+{
+	float color = 0;
+	int k;
+	for (k = 0; k < painter->ncomp; k++)
+		if (painter->color_tol[k] > 0)
+			color = fz_max(color, fabsf(ca[k] - cb[k]) / painter->color_tol[k]);
+	return patch_level(curve_flatness(q, polestep), color, 0, curve_length(q, polestep));
+}
+
+/* Split p uniformly into the cells of the grid from (gi, gj), and
+ * record their corners. */
 static void
-draw_patch(fz_context *ctx, fz_mesh_processor *painter, tensor_patch *p, int depth, int origdepth)
+fill_patch_grid(fz_mesh_processor *painter, tensor_patch *p, int li, int lj, int gi, int gj)
 {
 	tensor_patch s0, s1;
+	int ncomp = painter->ncomp;
+
+	if (lj > 0)
+	{
+		split_patch(p, &s0, &s1, ncomp);
+		fill_patch_grid(painter, &s0, li, lj - 1, gi, gj);
+		fill_patch_grid(painter, &s1, li, lj - 1, gi, gj + (1 << (lj - 1)));
+	}
+	else if (li > 0)
+	{
+		split_stripe(p, &s0, &s1, ncomp);
+		fill_patch_grid(painter, &s0, li - 1, lj, gi, gj);
+		fill_patch_grid(painter, &s1, li - 1, lj, gi + (1 << (li - 1)), gj);
+	}
+	else
+	{
+		int g = gi * PATCH_GRID + gj;
+		painter->grid[g].p = p->pole[0][0];
+		painter->grid[g + 1].p = p->pole[0][3];
+		painter->grid[g + PATCH_GRID + 1].p = p->pole[3][3];
+		painter->grid[g + PATCH_GRID].p = p->pole[3][0];
+		memcpy(painter->grid_color[g], p->color[0], ncomp * sizeof(float));
+		memcpy(painter->grid_color[g + 1], p->color[1], ncomp * sizeof(float));
+		memcpy(painter->grid_color[g + PATCH_GRID + 1], p->color[2], ncomp * sizeof(float));
+		memcpy(painter->grid_color[g + PATCH_GRID], p->color[3], ncomp * sizeof(float));
+	}
+}
 
-	/* split patch into two half-width patches */
-	split_patch(p, &s0, &s1, painter->ncomp);
+/* Move the points of an edge that is split into 2^level parts, at
+ * every 'stride' grid points from g, onto the lines between the
+ * points of its own 2^edge parts. */
+static void
+snap_patch_edge(fz_mesh_processor *painter, int g, int stride, int level, int edge)
+{
+	int step = 1 << (level - edge);
+	int n = 1 << level;
+	int a, k, c;
 
-	depth--;
-	if (depth == 0)
+	for (a = 0; a < n; a += step)
 	{
-		/* if no more subdividing, draw two new patches... */
-		draw_stripe(ctx, painter, &s0, origdepth);
-		draw_stripe(ctx, painter, &s1, origdepth);
+		fz_vertex *va = &painter->grid[g + a * stride];
+		fz_vertex *vb = &painter->grid[g + (a + step) * stride];
+		float *ca = painter->grid_color[g + a * stride];
+		float *cb = painter->grid_color[g + (a + step) * stride];
+		for (k = 1; k < step; k++)
+		{
+			float f = (float)k / step;
+			fz_vertex *v = &painter->grid[g + (a + k) * stride];
+			float *cv = painter->grid_color[g + (a + k) * stride];
+			v->p.x = va->p.x + (vb->p.x - va->p.x) * f;
+			v->p.y = va->p.y + (vb->p.y - va->p.y) * f;
+			for (c = 0; c < painter->ncomp; c++)
+				cv[c] = ca[c] + (cb[c] - ca[c]) * f;
+		}
+	}
+}
+
+static void
+draw_patch(fz_context *ctx, fz_mesh_processor *painter, tensor_patch *p)
+{
+	float flat_j = 0, flat_i = 0, len_j = 0, len_i = 0;
+	float color_j = 0, color_i = 0, twist;
+	int li, lj, e, i, j, k;
+
+	/* The patch lies within the hull of its poles. */
+	if (painter->scissor)
+	{
+		const fz_rect *sc = painter->scissor;
+		fz_rect bbox;
+		bbox.x0 = bbox.x1 = p->pole[0][0].x;
+		bbox.y0 = bbox.y1 = p->pole[0][0].y;
+		for (i = 0; i < 4; i++)
+		{
+			for (j = 0; j < 4; j++)
+			{
+				bbox.x0 = fz_min(bbox.x0, p->pole[i][j].x);
+				bbox.y0 = fz_min(bbox.y0, p->pole[i][j].y);
+				bbox.x1 = fz_max(bbox.x1, p->pole[i][j].x);
+				bbox.y1 = fz_max(bbox.y1, p->pole[i][j].y);
+			}
+		}
+		if (bbox.x1 < sc->x0 || bbox.x0 > sc->x1 || bbox.y1 < sc->y0 || bbox.y0 > sc->y1)
+			return;
+	}
+
+	/* Corners 0 and 1 (and 3 and 2) are along j; 0 and 3 (and 1 and
+	 * 2) along i. */
+	for (i = 0; i < 4; i++)
+	{
+		flat_j = fz_max(flat_j, curve_flatness(p->pole[i], 1));
+		flat_i = fz_max(flat_i, curve_flatness(&p->pole[0][i], 4));
+		len_j = fz_max(len_j, curve_length(p->pole[i], 1));
+		len_i = fz_max(len_i, curve_length(&p->pole[0][i], 4));
+	}
+	twist = fz_max(fabsf(p->pole[0][0].x - p->pole[0][3].x + p->pole[3][3].x - p->pole[3][0].x),
+		fabsf(p->pole[0][0].y - p->pole[0][3].y + p->pole[3][3].y - p->pole[3][0].y)) / 4 / PATCH_FLATNESS;
+	for (k = 0; k < painter->ncomp; k++)
+	{
+		float tol = painter->color_tol[k];
+		float c0 = p->color[0][k], c1 = p->color[1][k];
+		float c2 = p->color[2][k], c3 = p->color[3][k];
+		if (tol <= 0)
+			continue;
+		color_j = fz_max(color_j, fz_max(fabsf(c0 - c1), fabsf(c3 - c2)) / tol);
+		color_i = fz_max(color_i, fz_max(fabsf(c0 - c3), fabsf(c1 - c2)) / tol);
+		twist = fz_max(twist, fabsf(c0 - c1 + c2 - c3) / 4 / tol);
+	}
+
+	/* Halving either way halves the twist, so leave that to the
+	 * longer way. */
+	if (len_j >= len_i)
+	{
+		li = patch_level(flat_i, color_i, 0, len_i);
+		lj = patch_level(flat_j, color_j, twist / (1 << li), len_j);
 	}
 	else
 	{
-		/* ...otherwise, continue subdividing. */
-		draw_patch(ctx, painter, &s0, depth, origdepth);
-		draw_patch(ctx, painter, &s1, depth, origdepth);
+		lj = patch_level(flat_j, color_j, 0, len_j);
+		li = patch_level(flat_i, color_i, twist / (1 << lj), len_i);
 	}
+
+	e = edge_level(painter, p->pole[0], 1, p->color[0], p->color[1]);
+	lj = fz_maxi(lj, e);
+	e = edge_level(painter, p->pole[3], 1, p->color[3], p->color[2]);
+	lj = fz_maxi(lj, e);
+	e = edge_level(painter, &p->pole[0][0], 4, p->color[0], p->color[3]);
+	li = fz_maxi(li, e);
+	e = edge_level(painter, &p->pole[0][3], 4, p->color[1], p->color[2]);
+	li = fz_maxi(li, e);
+
+	fill_patch_grid(painter, p, li, lj, 0, 0);
+
+	e = edge_level(painter, p->pole[0], 1, p->color[0], p->color[1]);
+	if (e < lj)
+		snap_patch_edge(painter, 0, 1, lj, e);
+	e = edge_level(painter, p->pole[3], 1, p->color[3], p->color[2]);
+	if (e < lj)
+		snap_patch_edge(painter, (1 << li) * PATCH_GRID, 1, lj, e);
+	e = edge_level(painter, &p->pole[0][0], 4, p->color[0], p->color[3]);
+	if (e < li)
+		snap_patch_edge(painter, 0, PATCH_GRID, li, e);
+	e = edge_level(painter, &p->pole[0][3], 4, p->color[1], p->color[2]);
+	if (e < li)
+		snap_patch_edge(painter, 1 << lj, PATCH_GRID, li, e);
+
+	for (i = 0; i <= (1 << li); i++)
+		for (j = 0; j <= (1 << lj); j++)
+			fz_prepare_color(ctx, painter, &painter->grid[i * PATCH_GRID + j], painter->grid_color[i * PATCH_GRID + j]);
+
+	/* In the order that the patch was drawn in when it was split to
+	 * a fixed depth. */
+	for (j = 0; j < (1 << lj); j++)
+	{
+		for (i = (1 << li) - 1; i >= 0; i--)
+		{
+			fz_vertex *v = &painter->grid[i * PATCH_GRID + j];
+			if (painter->scissor)
+			{
+				const fz_rect *sc = painter->scissor;
+				float x0 = fz_min(fz_min(v[0].p.x, v[1].p.x), fz_min(v[PATCH_GRID].p.x, v[PATCH_GRID + 1].p.x));
+				float y0 = fz_min(fz_min(v[0].p.y, v[1].p.y), fz_min(v[PATCH_GRID].p.y, v[PATCH_GRID + 1].p.y));
+				float x1 = fz_max(fz_max(v[0].p.x, v[1].p.x), fz_max(v[PATCH_GRID].p.x, v[PATCH_GRID + 1].p.x));
+				float y1 = fz_max(fz_max(v[0].p.y, v[1].p.y), fz_max(v[PATCH_GRID].p.y, v[PATCH_GRID + 1].p.y));
+				if (x1 < sc->x0 || x0 > sc->x1 || y1 < sc->y0 || y0 > sc->y1)
+					continue;
+			}
+			paint_quad(ctx, painter, &v[0], &v[1], &v[PATCH_GRID + 1], &v[PATCH_GRID]);
+		}
+	}
+}
+
+/* One step of each colour component, and the grid, for draw_patch. */
+static void
+init_patch_painter(fz_context *ctx, fz_mesh_processor *painter, const float *c0, const float *c1)
+{
+	int k;
+	for (k = 0; k < painter->ncomp; k++)
+		painter->color_tol[k] = fabsf(c1[k] - c0[k]) / 256;
+	painter->grid = fz_malloc_array(ctx, PATCH_GRID * PATCH_GRID, sizeof(fz_vertex));
+	painter->grid_color = fz_malloc_array(ctx, PATCH_GRID * PATCH_GRID, sizeof(*painter->grid_color));
+}
+
+static void
+fin_patch_painter(fz_context *ctx, fz_mesh_processor *painter)
+{
+	fz_free(ctx, painter->grid);
+	fz_free(ctx, painter->grid_color);
+	painter->grid = NULL;
+	painter->grid_color = NULL;
 }
 
 static fz_point
@@ -692,9 +909,6 @@ make_tensor_patch(tensor_patch *p, int type, fz_point *pt)
 	}
 }
 
-/* FIXME: Nasty */
-#define SUBDIV 3 /* how many levels to subdivide patches */
-
 static void
 fz_process_shade_type6(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, fz_mesh_processor *painter)
 {
@@ -718,6 +932,9 @@ fz_process_shade_type6(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, f
 	{
 		float (*prevc)[FZ_MAX_COLORS] = NULL;
 		fz_point *prevp = NULL;
+
+		init_patch_painter(ctx, painter, c0, c1);
+
 		while (!fz_is_eof_bits(ctx, stream))
 		{
 			float (*c)[FZ_MAX_COLORS] = color_storage[store];
@@ -791,7 +1008,7 @@ fz_process_shade_type6(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, f
 			for (i = 0; i < 4; i++)
 				memcpy(patch.color[i], c[i], ncomp * sizeof(float));
 
-			draw_patch(ctx, painter, &patch, SUBDIV, SUBDIV);
+			draw_patch(ctx, painter, &patch);
 
 			prevp = v;
 			prevc = c;
@@ -800,6 +1017,7 @@ fz_process_shade_type6(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, f
 	}
 	fz_always(ctx)
 	{
+		fin_patch_painter(ctx, painter);
 		fz_drop_stream(ctx, stream);
 	}
 	fz_catch(ctx)
@@ -831,6 +1049,8 @@ fz_process_shade_type7(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, f
 
 	fz_try(ctx)
 	{
+		init_patch_painter(ctx, painter, c0, c1);
+
 		while (!fz_is_eof_bits(ctx, stream))
 		{
 			float (*c)[FZ_MAX_COLORS] = color_storage[store];
@@ -904,7 +1124,7 @@ fz_process_shade_type7(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, f
 			for (i = 0; i < 4; i++)
 				memcpy(patch.color[i], c[i], ncomp * sizeof(float));
 
-			draw_patch(ctx, painter, &patch, SUBDIV, SUBDIV);
+			draw_patch(ctx, painter, &patch);
 
 			prevp = v;
 			prevc = c;
@@ -913,6 +1133,7 @@ fz_process_shade_type7(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, f
 	}
 	fz_always(ctx)
 	{
+		fin_patch_painter(ctx, painter);
 		fz_drop_stream(ctx, stream);
 	}
 	fz_catch(ctx)
@@ -922,7 +1143,7 @@ fz_process_shade_type7(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, f
 }
 
 void
-fz_process_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm,
+fz_process_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm, const fz_rect *scissor,
 		fz_shade_prepare_fn *prepare, fz_shade_process_fn *process, void *process_arg)
 {
 	fz_mesh_processor painter;
@@ -932,6 +1153,9 @@ fz_process_shade(fz_context *ctx, fz_shade *shade, const fz_matrix *ctm,
 	painter.process = process;
 	painter.process_arg = process_arg;
 	painter.ncomp = (shade->use_function > 0 ? 1 : fz_colorspace_n(ctx, shade->colorspace));
+	painter.scissor = (scissor && !fz_is_infinite_rect(scissor) ? scissor : NULL);
+	painter.grid = NULL;
+	painter.grid_color = NULL;
 
 	if (shade->type == FZ_FUNCTION_BASED)
 		fz_process_shade_type1(ctx, shade, ctm, &painter);
@@ -6,29 +6,93 @@ struct fz_item_s
 {
 	void *key;
 	fz_storable *val;
+	fz_store_drop_fn *drop;
 	size_t size;
 	fz_item *next;
 	fz_item *prev;
 	fz_store *store;
 	fz_store_type *type;
+	uint64_t stamp;
+	int list;
+	unsigned int hash;
 };
 
-struct fz_store_s
+/*
+	The store is split into shards, each with a lock of its own, so that
+	threads looking up different items do not have to wait for each
+	other. Items with a hashable key are placed into a shard chosen by
+	their hash, the others all go into shard 0.
+
+	References to the values are still counted under FZ_LOCK_ALLOC,
+	which is taken while holding a shard lock, as is the accounting of
+	the total size of the store.
+
+	Each shard keeps its items on two lists. Under the 2Q policy, items
+	start on the first (probation) list, and move to the second
+	(protected) one when they are used again. The other policies leave
+	items on the list they find them on. The shard also remembers the
+	hashes of the last few keys evicted from probation, so that an item
+	that comes back soon after being evicted is protected straight away.
+
+	A third list holds the packed tier: items whose values were packed
+	by their type as they were evicted. Their val is the packed copy,
+	which only the store ever holds a reference to, and drop is that of
+	the value they stand for, so that they are found by the same lookups.
+	The packed tier has a budget of its own, and is trimmed in the order
+	the items were packed.
+*/
+#define STORE_SHARDS (FZ_LOCK_STORE_LAST - FZ_LOCK_STORE + 1)
+#define STORE_LISTS 2
+#define PACKED_LIST STORE_LISTS
+#define MAX_STORE_TYPES 16
+#define STORE_GHOSTS 128
+
+/* The number of evictable items from the end of each list that the
+ * cost policy weighs up when looking for one to evict. */
+#define COST_SAMPLE 16
+
+typedef struct store_type_counters_s
 {
-	int refs;
+	const fz_store_type *type;
+	fz_store_stats stats;
+} store_type_counters;
 
-	/* Every item in the store is kept in a doubly linked list, ordered
-	 * by usage (so LRU entries are at the end). */
-	fz_item *head;
-	fz_item *tail;
+typedef struct fz_store_shard_s
+{
+	/* Every item in the shard is kept in one of the doubly linked
+	 * lists, ordered by usage (so LRU entries are at the end). */
+	fz_item *head[STORE_LISTS + 1];
+	fz_item *tail[STORE_LISTS + 1];
 
 	/* We have a hash table that allows to quickly find a subset of the
 	 * entries (those whose keys are indirect objects). */
 	fz_hash_table *hash;
 
-	/* We keep track of the size of the store, and keep it below max. */
+	/* Counters for the items of each type in this shard. */
+	store_type_counters types[MAX_STORE_TYPES];
+
+	/* Hashes of the keys last evicted from the probation list. */
+	unsigned int ghost[STORE_GHOSTS];
+	int ghost_pos;
+} fz_store_shard;
+
+struct fz_store_s
+{
+	int refs;
+
+	fz_store_shard shard[STORE_SHARDS];
+
+	/* Protected by the alloc lock. We keep track of the size of the
+	 * store, and keep it below max. Every use of an item stamps it with
+	 * the next value of stamp, so that eviction can follow the LRU order
+	 * across all the shards. */
 	size_t max;
 	size_t size;
+	uint64_t stamp;
+	int policy;
+	size_t protected_size;
+	size_t packed_max;
+	size_t packed_size;
 
 	/* Protected by the reap lock */
 	int defer_reap_count;
@@ -39,119 +103,200 @@ void
 fz_new_store_context(fz_context *ctx, size_t max)
 {
 	fz_store *store;
+	int i;
+
 	store = fz_malloc_struct(ctx, fz_store);
 	fz_try(ctx)
 	{
-		store->hash = fz_new_hash_table(ctx, 4096, sizeof(fz_store_hash), FZ_LOCK_ALLOC);
+		for (i = 0; i < STORE_SHARDS; i++)
+			store->shard[i].hash = fz_new_hash_table(ctx, 4096 / STORE_SHARDS, sizeof(fz_store_hash), FZ_LOCK_STORE + i);
 	}
 	fz_catch(ctx)
 	{
+		for (i = 0; i < STORE_SHARDS; i++)
+			fz_drop_hash(ctx, store->shard[i].hash);
 		fz_free(ctx, store);
 		fz_rethrow(ctx);
 	}
 	store->refs = 1;
-	store->head = NULL;
-	store->tail = NULL;
 	store->size = 0;
 	store->max = max;
+	store->stamp = 0;
+	store->policy = FZ_STORE_POLICY_LRU;
+	store->protected_size = 0;
+	store->packed_max = 0;
+	store->packed_size = 0;
 	store->defer_reap_count = 0;
 	store->needs_reaping = 0;
 	ctx->store = store;
 }
 
-void *
-fz_keep_storable(fz_context *ctx, const fz_storable *sc)
+/* Hash a key to pick its shard, or return 0 if it cannot be hashed. This
+ * must not follow the hash that the table within the shard uses to place
+ * the key, or each shard would only ever use a fraction of its table. */
+static unsigned int
+key_hash(const fz_store_hash *hash, int use_hash)
 {
-	/* Explicitly drop const to allow us to use const
-	 * sanely throughout the code. */
-	fz_storable *s = (fz_storable *)sc;
+	const unsigned char *s = (const unsigned char *)hash;
+	unsigned int h = 2166136261u;
+	size_t i;
 
-	return fz_keep_imp(ctx, s, &s->refs);
+	if (!use_hash)
+		return 0;
+	for (i = 0; i < sizeof(*hash); i++)
+		h = (h ^ s[i]) * 16777619u;
+	return h ? h : 1;
 }
 
-void
-fz_drop_storable(fz_context *ctx, const fz_storable *sc)
-{
-	/* Explicitly drop const to allow us to use const
-	 * sanely throughout the code. */
-	fz_storable *s = (fz_storable *)sc;
+#define STORE_SHARD(h) (((h) >> 16) % STORE_SHARDS)
 
-	/*
-		If we are dropping the last reference to an object, then
-		it cannot possibly be in the store (as the store always
-		keeps a ref to everything in it, and doesn't drop via
-		this method. So we can simply drop the storable object
-		itself without any operations on the fz_store.
-	 */
-	if (fz_drop_imp(ctx, s, &s->refs))
-		s->drop(ctx, s);
+static void
+remember_ghost(fz_store_shard *shard, unsigned int hash)
+{
+	shard->ghost[shard->ghost_pos] = hash;
+	shard->ghost_pos = (shard->ghost_pos + 1) % STORE_GHOSTS;
 }
 
-void *fz_keep_key_storable(fz_context *ctx, const fz_key_storable *sc)
+static int
+forget_ghost(fz_store_shard *shard, unsigned int hash)
 {
-	return fz_keep_storable(ctx, &sc->storable);
+	int i;
+
+	for (i = 0; i < STORE_GHOSTS; i++)
+	{
+		if (shard->ghost[i] == hash)
+		{
+			shard->ghost[i] = 0;
+			return 1;
+		}
+	}
+	return 0;
 }
 
 /*
-	Entered with FZ_LOCK_ALLOC and FZ_LOCK_REAP held.
-	Drops FZ_LOCK_ALLOC.
+	Find the counters for a type within a shard. Entered with the shard
+	lock held. Returns NULL if there are too many types to count.
 */
-static void
-do_reap(fz_context *ctx)
+static fz_store_stats *
+type_stats(fz_store_shard *shard, const fz_store_type *type)
 {
-	fz_store *store = ctx->store;
-	fz_item *item, *prev, *remove;
+	int i;
 
-	if (store == NULL)
+	for (i = 0; i < MAX_STORE_TYPES; i++)
 	{
-		fz_unlock(ctx, FZ_LOCK_ALLOC);
-		return;
+		if (shard->types[i].type == type)
+			return &shard->types[i].stats;
+		if (shard->types[i].type == NULL)
+		{
+			shard->types[i].type = type;
+			return &shard->types[i].stats;
+		}
 	}
+	return NULL;
+}
 
-	fz_assert_lock_held(ctx, FZ_LOCK_ALLOC);
-	fz_assert_lock_held(ctx, FZ_LOCK_REAP);
+static void
+unlink_item(fz_store_shard *shard, fz_item *item)
+{
+	/* Momentarily things can be in the hash table without being
+	 * in the list. Don't attempt to unlink these. We indicate
+	 * such items by setting item->next == item. */
+	if (item->next == item)
+		return;
+	if (item->next)
+		item->next->prev = item->prev;
+	else
+		shard->tail[item->list] = item->prev;
+	if (item->prev)
+		item->prev->next = item->next;
+	else
+		shard->head[item->list] = item->next;
+}
 
-	ctx->store->needs_reaping = 0;
+/*
+	Take an item out of its shard, and drop the store's reference to
+	its value. Entered with the shard lock held. Returns non zero if the
+	value should now be dropped.
+*/
+static int
+unstore_item(fz_context *ctx, fz_store_shard *shard, fz_item *item)
+{
+	fz_store *store = ctx->store;
+	fz_store_stats *stats;
+	int drop;
 
-	/* Reap the items */
-	remove = NULL;
-	for (item = store->tail; item; item = prev)
+	unlink_item(shard, item);
+
+	stats = type_stats(shard, item->type);
+	if (stats && item->list == PACKED_LIST)
 	{
-		prev = item->prev;
+		stats->packed_count--;
+		stats->packed_size -= item->size;
+	}
+	else if (stats)
+	{
+		stats->count--;
+		stats->size -= item->size;
+	}
 
-		if (item->type->needs_reap == NULL || item->type->needs_reap(ctx, item->key) == 0)
-			continue;
+	/* Remove from the hash table */
+	if (item->type->make_hash_key)
+	{
+		fz_store_hash hash = { NULL };
+		hash.drop = item->drop;
+		if (item->type->make_hash_key(ctx, &hash, item->key))
+			fz_hash_remove(ctx, shard->hash, &hash);
+	}
 
-		/* We have to drop it */
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	if (item->list == PACKED_LIST)
+		store->packed_size -= item->size;
+	else
 		store->size -= item->size;
+	if (item->list == 1)
+		store->protected_size -= item->size;
+	drop = (item->val->refs > 0 && --item->val->refs == 0);
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
 
-		/* Unlink from the linked list */
-		if (item->next)
-			item->next->prev = item->prev;
-		else
-			store->tail = item->prev;
-		if (item->prev)
-			item->prev->next = item->next;
-		else
-			store->head = item->next;
+	return drop;
+}
+
+/*
+	Remove every item for which match returns non zero from the store.
+	Entered with no store locks held.
+*/
+static void
+remove_matching(fz_context *ctx, int (*match)(fz_context *, fz_item *, void *), void *arg)
+{
+	fz_store *store = ctx->store;
+	fz_item *item, *prev, *remove;
+	int i, l;
+
+	remove = NULL;
+	for (i = 0; i < STORE_SHARDS; i++)
+	{
+		fz_store_shard *shard = &store->shard[i];
 
-		/* Remove from the hash table */
-		if (item->type->make_hash_key)
+		fz_lock(ctx, FZ_LOCK_STORE + i);
+		for (l = 0; l <= PACKED_LIST; l++)
 		{
-			fz_store_hash hash = { NULL };
-			hash.drop = item->val->drop;
-			if (item->type->make_hash_key(ctx, &hash, item->key))
-				fz_hash_remove(ctx, store->hash, &hash);
-		}
+			for (item = shard->tail[l]; item; item = prev)
+			{
+				prev = item->prev;
+
+				if (!match(ctx, item, arg))
+					continue;
 
-		/* Store whether to drop this value or not in 'prev' */
-		item->prev = (item->val->refs > 0 && --item->val->refs == 0) ? item : NULL;
+				/* Store whether to drop this value or not in 'prev' */
+				item->prev = unstore_item(ctx, shard, item) ? item : NULL;
 
-		/* Store it in our removal chain - just singly linked */
-		item->next = remove;
-		remove = item;
+				/* Store it in our removal chain - just singly linked */
+				item->next = remove;
+				remove = item;
+			}
+		}
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
 	}
-	fz_unlock(ctx, FZ_LOCK_ALLOC);
 
 	/* Now drop the remove chain */
 	for (item = remove; item != NULL; item = remove)
@@ -166,7 +311,58 @@ do_reap(fz_context *ctx)
 		item->type->drop_key(ctx, item->key);
 		fz_free(ctx, item);
 	}
+}
+
+void *
+fz_keep_storable(fz_context *ctx, const fz_storable *sc)
+{
+	/* Explicitly drop const to allow us to use const
+	 * sanely throughout the code. */
+	fz_storable *s = (fz_storable *)sc;
+
+	return fz_keep_imp(ctx, s, &s->refs);
+}
+
+void
+fz_drop_storable(fz_context *ctx, const fz_storable *sc)
+{
+	/* Explicitly drop const to allow us to use const
+	 * sanely throughout the code. */
+	fz_storable *s = (fz_storable *)sc;
+
+	/*
+		If we are dropping the last reference to an object, then
+		it cannot possibly be in the store (as the store always
+		keeps a ref to everything in it, and doesn't drop via
+		this method. So we can simply drop the storable object
+		itself without any operations on the fz_store.
+	 */
+	if (fz_drop_imp(ctx, s, &s->refs))
+		s->drop(ctx, s);
+}
+
+void *fz_keep_key_storable(fz_context *ctx, const fz_key_storable *sc)
+{
+	return fz_keep_storable(ctx, &sc->storable);
+}
 
+static int
+reap_match(fz_context *ctx, fz_item *item, void *arg)
+{
+	return item->type->needs_reap && item->type->needs_reap(ctx, item->key);
+}
+
+/*
+	Entered with no store locks held. The caller has already cleared
+	needs_reaping (under FZ_LOCK_REAP) if it was set.
+*/
+static void
+do_reap(fz_context *ctx)
+{
+	if (ctx->store == NULL)
+		return;
+
+	remove_matching(ctx, reap_match, NULL);
 }
 
 void fz_drop_key_storable(fz_context *ctx, const fz_key_storable *sc)
@@ -175,7 +371,7 @@ void fz_drop_key_storable(fz_context *ctx, const fz_key_storable *sc)
 	 * sanely throughout the code. */
 	fz_key_storable *s = (fz_key_storable *)sc;
 	int drop;
-	int unlock = 1;
+	int reap = 0;
 
 	if (s == NULL)
 		return;
@@ -186,23 +382,25 @@ void fz_drop_key_storable(fz_context *ctx, const fz_key_storable *sc)
 	if (s->storable.refs > 0)
 	{
 		drop = --s->storable.refs == 0;
-		if (!drop && s->storable.refs == s->store_key_refs)
-		{
-			fz_lock(ctx, FZ_LOCK_REAP);
-			if (ctx->store->defer_reap_count > 0)
-				ctx->store->needs_reaping = 1;
-			else
-			{
-				do_reap(ctx);
-				unlock = 0;
-			}
-			fz_unlock(ctx, FZ_LOCK_REAP);
-		}
+		reap = !drop && s->storable.refs == s->store_key_refs;
 	}
 	else
 		drop = 0;
-	if (unlock)
-		fz_unlock(ctx, FZ_LOCK_ALLOC);
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	if (reap && ctx->store)
+	{
+		fz_lock(ctx, FZ_LOCK_REAP);
+		if (ctx->store->defer_reap_count > 0)
+		{
+			ctx->store->needs_reaping = 1;
+			reap = 0;
+		}
+		else
+			ctx->store->needs_reaping = 0;
+		fz_unlock(ctx, FZ_LOCK_REAP);
+		if (reap)
+			do_reap(ctx);
+	}
 	/*
 		If we are dropping the last reference to an object, then
 		it cannot possibly be in the store (as the store always
@@ -264,145 +462,505 @@ void fz_drop_key_storable_key(fz_context *ctx, const fz_key_storable *sc)
 }
 
 static void
-evict(fz_context *ctx, fz_item *item)
+touch(fz_store_shard *shard, fz_item *item, int list)
 {
-	fz_store *store = ctx->store;
-	int drop;
-
-	store->size -= item->size;
-	/* Unlink from the linked list */
+	unlink_item(shard, item);
+	/* Now relink it at the start of the LRU chain */
+	item->list = list;
+	item->next = shard->head[list];
 	if (item->next)
-		item->next->prev = item->prev;
-	else
-		store->tail = item->prev;
-	if (item->prev)
-		item->prev->next = item->next;
+		item->next->prev = item;
 	else
-		store->head = item->next;
+		shard->tail[list] = item;
+	shard->head[list] = item;
+	item->prev = NULL;
+}
 
-	/* Drop a reference to the value (freeing if required) */
-	drop = (item->val->refs > 0 && --item->val->refs == 0);
+/*
+	Pack the value of an item that has just been taken out of the store,
+	if its type and the budget of the packed tier allow. Entered with no
+	store locks held, and a reference to the value that nobody else has.
+*/
+static fz_storable *
+pack_item(fz_context *ctx, fz_item *item, size_t *size)
+{
+	fz_storable *packed = NULL;
+	size_t max;
 
-	/* Remove from the hash table */
-	if (item->type->make_hash_key)
+	if (!item->type->pack || !item->type->unpack || !item->hash)
+		return NULL;
+
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	max = ctx->store->packed_max;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	if (max == 0)
+		return NULL;
+
+	fz_try(ctx)
+		packed = item->type->pack(ctx, item->key, item->val, size);
+	fz_catch(ctx)
+		packed = NULL;
+	if (packed && *size > max)
 	{
-		fz_store_hash hash = { NULL };
-		hash.drop = item->val->drop;
-		if (item->type->make_hash_key(ctx, &hash, item->key))
-			fz_hash_remove(ctx, store->hash, &hash);
+		packed->drop(ctx, packed);
+		packed = NULL;
 	}
+	return packed;
+}
+
+/*
+	Put an item back into its shard, with its value replaced by a packed
+	copy. Entered with the shard lock held. Returns zero if the item
+	could not be put back, because the hash table could not grow, or
+	because the value has been stored again in the meantime.
+*/
+static int
+store_packed(fz_context *ctx, fz_store_shard *shard, fz_item *item, fz_storable *packed, size_t size)
+{
+	fz_store *store = ctx->store;
+	fz_store_hash hash = { NULL };
+	fz_store_stats *stats;
+	fz_item *existing;
+	unsigned pos;
+
+	hash.drop = item->drop;
+	if (!item->type->make_hash_key(ctx, &hash, item->key))
+		return 0;
+
+	/* Set the item up before it goes into the hash table, as the
+	 * insertion may drop the lock, and let others find it. */
+	item->val = packed;
+	item->size = size;
+	item->next = item;
+	item->prev = item;
+	item->list = PACKED_LIST;
+
+	fz_try(ctx)
+		existing = fz_hash_insert_with_pos(ctx, shard->hash, &hash, item, &pos);
+	fz_catch(ctx)
+		return 0;
+	if (existing)
+		return 0;
+
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	item->stamp = ++store->stamp;
+	store->packed_size += size;
 	fz_unlock(ctx, FZ_LOCK_ALLOC);
+
+	stats = type_stats(shard, item->type);
+	if (stats)
+	{
+		stats->packs++;
+		stats->packed_count++;
+		stats->packed_size += size;
+	}
+
+	touch(shard, item, PACKED_LIST);
+	return 1;
+}
+
+/*
+	Entered with the lock for shard i held, which is dropped and
+	retaken. If pack is set, the value may be packed into the packed
+	tier rather than dropped.
+*/
+static void
+evict(fz_context *ctx, int i, fz_item *item, int pack)
+{
+	fz_store_shard *shard = &ctx->store->shard[i];
+	fz_storable *packed = NULL;
+	size_t size = 0;
+	int drop;
+
+	drop = unstore_item(ctx, shard, item);
+	fz_unlock(ctx, FZ_LOCK_STORE + i);
+	if (drop && pack && item->list != PACKED_LIST)
+		packed = pack_item(ctx, item, &size);
 	if (drop)
 		item->val->drop(ctx, item->val);
 
+	if (packed)
+	{
+		fz_lock(ctx, FZ_LOCK_STORE + i);
+		if (store_packed(ctx, shard, item, packed, size))
+			return;
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
+		packed->drop(ctx, packed);
+	}
+
 	/* Always drops the key and drop the item */
 	item->type->drop_key(ctx, item->key);
 	fz_free(ctx, item);
+	fz_lock(ctx, FZ_LOCK_STORE + i);
+}
+
+/*
+	Discard the least recently packed items from the packed tier until
+	it has shrunk by tofree bytes, or is empty. Entered with no store
+	locks held. Returns the number of bytes freed.
+*/
+static size_t
+discard_packed(fz_context *ctx, size_t tofree)
+{
+	fz_store *store = ctx->store;
+	fz_store_stats *stats;
+	fz_item *item;
+	size_t count = 0;
+	uint64_t oldest;
+	int i, shard;
+
+	while (count < tofree)
+	{
+		shard = -1;
+		oldest = 0;
+		for (i = 0; i < STORE_SHARDS; i++)
+		{
+			fz_lock(ctx, FZ_LOCK_STORE + i);
+			item = store->shard[i].tail[PACKED_LIST];
+			if (item && (shard < 0 || item->stamp < oldest))
+			{
+				shard = i;
+				oldest = item->stamp;
+			}
+			fz_unlock(ctx, FZ_LOCK_STORE + i);
+		}
+		if (shard < 0)
+			break;
+
+		fz_lock(ctx, FZ_LOCK_STORE + shard);
+		item = store->shard[shard].tail[PACKED_LIST];
+		if (item)
+		{
+			count += item->size;
+			stats = type_stats(&store->shard[shard], item->type);
+			if (stats)
+				stats->discards++;
+			evict(ctx, shard, item, 0); /* Drops then retakes lock */
+		}
+		fz_unlock(ctx, FZ_LOCK_STORE + shard);
+	}
+
+	return count;
+}
+
+/* Keep the packed tier within its budget. Entered with no store locks held. */
+static void
+trim_packed(fz_context *ctx)
+{
+	fz_store *store = ctx->store;
+	size_t size, max;
+
 	fz_lock(ctx, FZ_LOCK_ALLOC);
+	size = store->packed_size;
+	max = store->packed_max;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	if (size > max)
+		discard_packed(ctx, size - max);
+}
+
+/*
+	How keen we are to evict an item, according to the policy. Items of
+	a higher class always go before those of a lower one; within a
+	class, those with the higher score go first.
+*/
+typedef struct
+{
+	fz_item *item;
+	int cls;
+	double score;
+} candidate;
+
+static int
+better_candidate(const candidate *a, const candidate *b)
+{
+	if (b->item == NULL)
+		return a->item != NULL;
+	if (a->item == NULL)
+		return 0;
+	if (a->cls != b->cls)
+		return a->cls > b->cls;
+	return a->score > b->score;
+}
+
+/*
+	Find the item in a shard that the policy would evict first, among
+	those that only the store holds a reference to. Entered with the
+	shard lock and FZ_LOCK_ALLOC held.
+
+	LRU evicts the least recently used item. 2Q evicts the least
+	recently used item on probation, unless there are none, or the
+	protected items have grown past 3/4 of the store. The cost policy
+	divides the time since each item was last used by the cost of
+	rebuilding it, and evicts the one with the highest result; it only
+	looks at the least recently used few of each list to find it.
+*/
+static candidate
+best_evictable(fz_context *ctx, fz_store_shard *shard)
+{
+	fz_store *store = ctx->store;
+	candidate best = { NULL };
+	candidate c;
+	fz_item *item;
+	size_t cap;
+	int l, n;
+
+	fz_assert_lock_held(ctx, FZ_LOCK_ALLOC);
+
+	cap = store->max != FZ_STORE_UNLIMITED ? store->max : store->size;
+	cap = cap / 4 * 3;
+
+	for (l = 0; l < STORE_LISTS; l++)
+	{
+		n = 0;
+		for (item = shard->tail[l]; item; item = item->prev)
+		{
+			if (item->val->refs != 1)
+				continue;
+
+			c.item = item;
+			c.score = (double)(store->stamp - item->stamp);
+			if (store->policy == FZ_STORE_POLICY_2Q)
+				c.cls = (l == 0 || store->protected_size > cap);
+			else
+				c.cls = 0;
+			if (store->policy == FZ_STORE_POLICY_COST)
+				c.score /= item->type->cost > 0 ? item->type->cost : 1;
+			if (better_candidate(&c, &best))
+				best = c;
+
+			/* Within a list, nothing but the cost can make an item
+			 * a better choice than the ones after it. */
+			if (store->policy != FZ_STORE_POLICY_COST || ++n == COST_SAMPLE)
+				break;
+		}
+	}
+
+	return best;
 }
 
+/*
+	Count how much of tofree we could free by evicting the items that
+	only the store holds a reference to. Entered with no store locks
+	held.
+*/
 static size_t
-ensure_space(fz_context *ctx, size_t tofree)
+evictable_size(fz_context *ctx, size_t tofree)
+{
+	fz_store *store = ctx->store;
+	fz_item *item;
+	size_t count = 0;
+	int i, l;
+
+	for (i = 0; i < STORE_SHARDS && count < tofree; i++)
+	{
+		fz_lock(ctx, FZ_LOCK_STORE + i);
+		fz_lock(ctx, FZ_LOCK_ALLOC);
+		for (l = 0; l < STORE_LISTS; l++)
+			for (item = store->shard[i].tail[l]; item && count < tofree; item = item->prev)
+				if (item->val->refs == 1)
+					count += item->size;
+		fz_unlock(ctx, FZ_LOCK_ALLOC);
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
+	}
+
+	return count;
+}
+
+/*
+	Evict items that only the store holds a reference to, in the order
+	the policy prefers across all the shards, until we have freed tofree
+	bytes or run out of such items. Entered with no store locks held.
+	Returns the number of bytes freed.
+
+	Each shard is locked in turn to find the item it would evict first;
+	then the shard holding the best of these is locked again, and
+	evicted from until its next choice is no better than that of any
+	other shard. Other threads may use or store items while no lock is
+	held, so the order is only as exact as that allows.
+
+	If pack is set, the values of types that can be packed are moved to
+	the packed tier, rather than being dropped.
+*/
+static size_t
+evict_lru(fz_context *ctx, size_t tofree, int pack)
+{
+	fz_store *store = ctx->store;
+	fz_store_stats *stats;
+	size_t count = 0;
+
+	while (count < tofree)
+	{
+		candidate best = { NULL }, next = { NULL }, c;
+		int i, shard = -1;
+
+		for (i = 0; i < STORE_SHARDS; i++)
+		{
+			fz_lock(ctx, FZ_LOCK_STORE + i);
+			fz_lock(ctx, FZ_LOCK_ALLOC);
+			c = best_evictable(ctx, &store->shard[i]);
+			fz_unlock(ctx, FZ_LOCK_ALLOC);
+			fz_unlock(ctx, FZ_LOCK_STORE + i);
+			if (better_candidate(&c, &best))
+			{
+				next = best;
+				best = c;
+				shard = i;
+			}
+			else if (better_candidate(&c, &next))
+				next = c;
+		}
+		if (shard < 0)
+			break;
+
+		fz_lock(ctx, FZ_LOCK_STORE + shard);
+		while (count < tofree)
+		{
+			fz_lock(ctx, FZ_LOCK_ALLOC);
+			c = best_evictable(ctx, &store->shard[shard]);
+			fz_unlock(ctx, FZ_LOCK_ALLOC);
+			if (c.item == NULL || better_candidate(&next, &c))
+				break;
+			count += c.item->size;
+			if (c.item->list == 0 && c.item->hash)
+				remember_ghost(&store->shard[shard], c.item->hash);
+			stats = type_stats(&store->shard[shard], c.item->type);
+			if (stats)
+			{
+				stats->evictions++;
+				stats->evicted += c.item->size;
+			}
+			evict(ctx, shard, c.item, pack); /* Drops then retakes lock */
+		}
+		fz_unlock(ctx, FZ_LOCK_STORE + shard);
+	}
+
+	if (pack)
+		trim_packed(ctx);
+
+	return count;
+}
+
+/* Entered with no store locks held. */
+static void
+ensure_space(fz_context *ctx)
 {
-	fz_item *item, *prev;
-	size_t count;
 	fz_store *store = ctx->store;
+	size_t size, max, tofree;
+	int reap;
 
-	fz_assert_lock_held(ctx, FZ_LOCK_ALLOC);
-
-	/* First check that we *can* free tofree; if not, we'd rather not
-	 * cache this. */
-	count = 0;
-	for (item = store->tail; item; item = item->prev)
+	while (1)
 	{
-		if (item->val->refs == 1)
+		fz_lock(ctx, FZ_LOCK_ALLOC);
+		size = store->size;
+		max = store->max;
+		fz_unlock(ctx, FZ_LOCK_ALLOC);
+		if (size <= max)
+			break;
+
+		/* First, do any outstanding reaping, even if defer_reap_count > 0 */
+		fz_lock(ctx, FZ_LOCK_REAP);
+		reap = store->needs_reaping;
+		store->needs_reaping = 0;
+		fz_unlock(ctx, FZ_LOCK_REAP);
+		if (reap)
 		{
-			count += item->size;
-			if (count >= tofree)
-				break;
+			do_reap(ctx);
+			continue;
 		}
-	}
 
-	/* If we ran out of items to search, then we can never free enough */
-	if (item == NULL)
-	{
-		return 0;
+		/* Check that we *can* free enough; if not, we'd rather not
+		 * evict anything. We used to 'unstore' the new item here, but
+		 * that's wrong. If we've already spent the memory to malloc it
+		 * then not putting it in the store just means that a resource
+		 * used multiple times will just be malloced again. Better to
+		 * keep it in the store, have the store account for it, and for
+		 * it to potentially be reused. When the caller drops the
+		 * reference to it, it can then be dropped from the store on
+		 * the next attempt to store anything else. */
+		tofree = size - max;
+		if (evictable_size(ctx, tofree) < tofree)
+			break;
+
+		if (evict_lru(ctx, tofree, 1) == 0)
+			break;
 	}
+}
+
+/*
+	Take a reference to an item found in the store, and mark it as used.
+	Entered with the shard lock held.
+*/
+static void
+use_item(fz_context *ctx, fz_store_shard *shard, fz_item *item)
+{
+	fz_store *store = ctx->store;
+	int list = item->list;
+	fz_store_stats *stats;
 
-	/* Actually free the items */
-	count = 0;
-	for (item = store->tail; item; item = prev)
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	if (item->val->refs > 0)
+		item->val->refs++;
+	item->stamp = ++store->stamp;
+	/* Under 2Q, an item in the list on probation is promoted by being
+	 * used again. */
+	if (store->policy == FZ_STORE_POLICY_2Q && list == 0 && item->next != item)
 	{
-		prev = item->prev;
-		if (item->val->refs == 1)
-		{
-			/* Free this item. Evict has to drop the lock to
-			 * manage that, which could cause prev to be removed
-			 * in the meantime. To avoid that we bump its reference
-			 * count here. This may cause another simultaneous
-			 * evict process to fail to make enough space as prev is
-			 * pinned - but that will only happen if we're near to
-			 * the limit anyway, and it will only cause something to
-			 * not be cached. */
-			count += item->size;
-			if (prev)
-				prev->val->refs++;
-			evict(ctx, item); /* Drops then retakes lock */
-			/* So the store has 1 reference to prev, as do we, so
-			 * no other evict process can have thrown prev away in
-			 * the meantime. So we are safe to just decrement its
-			 * reference count here. */
-			if (prev)
-				--prev->val->refs;
-
-			if (count >= tofree)
-				return count;
-		}
+		store->protected_size += item->size;
+		list = 1;
 	}
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
 
-	return count;
+	stats = type_stats(shard, item->type);
+	if (stats)
+		stats->hits++;
+
+	/* LRU the block. This also serves to ensure that any item
+	 * picked up from the hash before it has made it into the
+	 * linked list does not get whipped out again due to the
+	 * store being full. */
+	touch(shard, item, list);
 }
 
+/*
+	Drop a chain (linked by next) of items taken out of the packed tier
+	by unstore_item, each of which has whether to drop its value in
+	prev. Entered with no store locks held.
+*/
 static void
-touch(fz_store *store, fz_item *item)
+drop_packed(fz_context *ctx, fz_item *item)
 {
-	if (item->next != item)
+	fz_item *next;
+
+	for (; item; item = next)
 	{
-		/* Already in the list - unlink it */
-		if (item->next)
-			item->next->prev = item->prev;
-		else
-			store->tail = item->prev;
+		next = item->next;
 		if (item->prev)
-			item->prev->next = item->next;
-		else
-			store->head = item->next;
+			item->val->drop(ctx, item->val);
+		item->type->drop_key(ctx, item->key);
+		fz_free(ctx, item);
 	}
-	/* Now relink it at the start of the LRU chain */
-	item->next = store->head;
-	if (item->next)
-		item->next->prev = item;
-	else
-		store->tail = item;
-	store->head = item;
-	item->prev = NULL;
 }
 
 void *
 fz_store_item(fz_context *ctx, void *key, void *val_, size_t itemsize, fz_store_type *type)
 {
 	fz_item *item = NULL;
-	size_t size;
+	fz_item *packed = NULL;
 	fz_storable *val = (fz_storable *)val_;
 	fz_store *store = ctx->store;
+	fz_store_shard *shard;
+	fz_store_stats *stats;
 	fz_store_hash hash = { NULL };
 	int use_hash = 0;
 	unsigned pos;
+	unsigned int h;
+	int i, list, ghost;
 
 	if (!store)
 		return NULL;
 
 	fz_var(item);
+	fz_var(packed);
 
 	/* If we fail for any reason, we swallow the exception and continue.
 	 * All that the above program will see is that we failed to store
@@ -421,9 +979,12 @@ fz_store_item(fz_context *ctx, void *key, void *val_, size_t itemsize, fz_store_
 		hash.drop = val->drop;
 		use_hash = type->make_hash_key(ctx, &hash, key);
 	}
+	h = key_hash(&hash, use_hash);
+	i = STORE_SHARD(h);
+	shard = &store->shard[i];
 
 	type->keep_key(ctx, key);
-	fz_lock(ctx, FZ_LOCK_ALLOC);
+	fz_lock(ctx, FZ_LOCK_STORE + i);
 
 	/* Fill out the item. To start with, we always set item->next == item
 	 * and item->prev == item. This is so that we can spot items that have
@@ -431,10 +992,13 @@ fz_store_item(fz_context *ctx, void *key, void *val_, size_t itemsize, fz_store_
 	 * list yet. */
 	item->key = key;
 	item->val = val;
+	item->drop = val->drop;
 	item->size = itemsize;
 	item->next = item;
 	item->prev = item;
 	item->type = type;
+	item->list = 0;
+	item->hash = h;
 
 	/* If we can index it fast, put it into the hash table. This serves
 	 * to check whether we have one there already. */
@@ -445,91 +1009,114 @@ fz_store_item(fz_context *ctx, void *key, void *val_, size_t itemsize, fz_store_
 		fz_try(ctx)
 		{
 			/* May drop and retake the lock */
-			existing = fz_hash_insert_with_pos(ctx, store->hash, &hash, item, &pos);
+			existing = fz_hash_insert_with_pos(ctx, shard->hash, &hash, item, &pos);
+			while (existing && existing->list == PACKED_LIST)
+			{
+				/* A packed copy of the value is of no more use. */
+				existing->prev = unstore_item(ctx, shard, existing) ? existing : NULL;
+				existing->next = packed;
+				packed = existing;
+				existing = fz_hash_insert_with_pos(ctx, shard->hash, &hash, item, &pos);
+			}
 		}
 		fz_catch(ctx)
 		{
 			/* Any error here means that item never made it into the
 			 * hash - so no one else can have a reference. */
-			fz_unlock(ctx, FZ_LOCK_ALLOC);
+			fz_unlock(ctx, FZ_LOCK_STORE + i);
 			fz_free(ctx, item);
 			type->drop_key(ctx, key);
+			drop_packed(ctx, packed);
 			return NULL;
 		}
 		if (existing)
 		{
 			/* There was one there already! Take a new reference
 			 * to the existing one, and drop our current one. */
-			touch(store, existing);
-			if (existing->val->refs > 0)
-				existing->val->refs++;
-			fz_unlock(ctx, FZ_LOCK_ALLOC);
+			use_item(ctx, shard, existing);
+			fz_unlock(ctx, FZ_LOCK_STORE + i);
 			fz_free(ctx, item);
 			type->drop_key(ctx, key);
+			drop_packed(ctx, packed);
 			return existing->val;
 		}
 	}
-	/* Now bump the ref */
+
+	/* Now bump the ref, and account for the item. Under 2Q, an item
+	 * that was evicted from probation not long ago is protected. */
+	ghost = h && forget_ghost(shard, h);
+	fz_lock(ctx, FZ_LOCK_ALLOC);
 	if (val->refs > 0)
 		val->refs++;
-	/* If we haven't got an infinite store, check for space within it */
-	if (store->max != FZ_STORE_UNLIMITED)
-	{
-		size = store->size + itemsize;
-		while (size > store->max)
-		{
-			size_t saved;
-			int relock = 0;
-
-			/* First, do any outstanding reaping, even if defer_reap_count > 0 */
-			fz_lock(ctx, FZ_LOCK_REAP);
-			if (store->needs_reaping)
-			{
-				do_reap(ctx); /* Drops alloc lock */
-				relock = 1;
-			}
-			fz_unlock(ctx, FZ_LOCK_REAP);
-			if (relock)
-				fz_lock(ctx, FZ_LOCK_ALLOC);
-			size = store->size + itemsize;
-			if (size <= store->max)
-				break;
+	item->stamp = ++store->stamp;
+	store->size += itemsize;
+	list = (ghost && store->policy == FZ_STORE_POLICY_2Q);
+	if (list)
+		store->protected_size += itemsize;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
 
-			/* ensure_space may drop, then retake the lock */
-			saved = ensure_space(ctx, size - store->max);
-			size -= saved;
-			if (saved == 0)
-			{
-				/* Failed to free any space. */
-				/* We used to 'unstore' it here, but that's wrong.
-				 * If we've already spent the memory to malloc it
-				 * then not putting it in the store just means that
-				 * a resource used multiple times will just be malloced
-				 * again. Better to put it in the store, have the
-				 * store account for it, and for it to potentially be reused.
-				 * When the caller drops the reference to it, it can then
-				 * be dropped from the store on the next attempt to store
-				 * anything else. */
-				break;
-			}
-		}
+	stats = type_stats(shard, type);
+	if (stats)
+	{
+		stats->stores++;
+		stats->count++;
+		stats->size += itemsize;
 	}
-	store->size += itemsize;
 
 	/* Regardless of whether it's indexed, it goes into the linked list */
-	touch(store, item);
-	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	touch(shard, item, list);
+	fz_unlock(ctx, FZ_LOCK_STORE + i);
+	drop_packed(ctx, packed);
+
+	/* If we haven't got an infinite store, make space within it. As we
+	 * still hold a reference to val, this will not evict our item. */
+	if (store->max != FZ_STORE_UNLIMITED)
+		ensure_space(ctx);
 
 	return NULL;
 }
 
+/*
+	Unpack the value of an item taken out of the packed tier, and store
+	it again. Entered with no store locks held. Returns the value, to
+	which a reference has been taken, or NULL if it could not be
+	unpacked.
+*/
+static void *
+restore_item(fz_context *ctx, fz_item *item)
+{
+	fz_storable *val;
+	fz_storable *existing;
+	size_t size = 0;
+
+	fz_try(ctx)
+		val = item->type->unpack(ctx, item->key, item->val, &size);
+	fz_catch(ctx)
+		val = NULL;
+	if (val)
+	{
+		existing = fz_store_item(ctx, item->key, val, size, item->type);
+		if (existing)
+		{
+			/* Another thread has stored the value in the meantime */
+			fz_drop_storable(ctx, val);
+			val = existing;
+		}
+	}
+	drop_packed(ctx, item);
+	return val;
+}
+
 void *
 fz_find_item(fz_context *ctx, fz_store_drop_fn *drop, void *key, fz_store_type *type)
 {
 	fz_item *item;
 	fz_store *store = ctx->store;
+	fz_store_shard *shard;
+	fz_store_stats *stats;
 	fz_store_hash hash = { NULL };
 	int use_hash = 0;
+	int i, l;
 
 	if (!store)
 		return NULL;
@@ -542,36 +1129,51 @@ fz_find_item(fz_context *ctx, fz_store_drop_fn *drop, void *key, fz_store_type *
 		hash.drop = drop;
 		use_hash = type->make_hash_key(ctx, &hash, key);
 	}
+	i = STORE_SHARD(key_hash(&hash, use_hash));
+	shard = &store->shard[i];
 
-	fz_lock(ctx, FZ_LOCK_ALLOC);
+	fz_lock(ctx, FZ_LOCK_STORE + i);
 	if (use_hash)
 	{
 		/* We can find objects keyed on indirected objects quickly */
-		item = fz_hash_find(ctx, store->hash, &hash);
+		item = fz_hash_find(ctx, shard->hash, &hash);
 	}
 	else
 	{
 		/* Others we have to hunt for slowly */
-		for (item = store->head; item; item = item->next)
+		item = NULL;
+		for (l = 0; l < STORE_LISTS && !item; l++)
 		{
-			if (item->val->drop == drop && !type->cmp_key(ctx, item->key, key))
-				break;
+			for (item = shard->head[l]; item; item = item->next)
+			{
+				if (item->val->drop == drop && !type->cmp_key(ctx, item->key, key))
+					break;
+			}
 		}
 	}
+	if (item && item->list == PACKED_LIST)
+	{
+		/* Take it out of the packed tier, to be unpacked and stored
+		 * again without holding the lock. */
+		item->prev = unstore_item(ctx, shard, item) ? item : NULL;
+		item->next = NULL;
+		stats = type_stats(shard, type);
+		if (stats)
+			stats->restores++;
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
+		return restore_item(ctx, item);
+	}
 	if (item)
 	{
-		/* LRU the block. This also serves to ensure that any item
-		 * picked up from the hash before it has made it into the
-		 * linked list does not get whipped out again due to the
-		 * store being full. */
-		touch(store, item);
-		/* And bump the refcount before returning */
-		if (item->val->refs > 0)
-			item->val->refs++;
-		fz_unlock(ctx, FZ_LOCK_ALLOC);
+		/* Bump the refcount before returning */
+		use_item(ctx, shard, item);
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
 		return (void *)item->val;
 	}
-	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	stats = type_stats(shard, type);
+	if (stats)
+		stats->misses++;
+	fz_unlock(ctx, FZ_LOCK_STORE + i);
 
 	return NULL;
 }
@@ -581,73 +1183,70 @@ fz_remove_item(fz_context *ctx, fz_store_drop_fn *drop, void *key, fz_store_type
 {
 	fz_item *item;
 	fz_store *store = ctx->store;
+	fz_store_shard *shard;
 	int dodrop;
 	fz_store_hash hash = { NULL };
 	int use_hash = 0;
+	int i, l;
 
 	if (type->make_hash_key)
 	{
 		hash.drop = drop;
 		use_hash = type->make_hash_key(ctx, &hash, key);
 	}
+	i = STORE_SHARD(key_hash(&hash, use_hash));
+	shard = &store->shard[i];
 
-	fz_lock(ctx, FZ_LOCK_ALLOC);
+	fz_lock(ctx, FZ_LOCK_STORE + i);
 	if (use_hash)
 	{
 		/* We can find objects keyed on indirect objects quickly */
-		item = fz_hash_find(ctx, store->hash, &hash);
-		if (item)
-			fz_hash_remove(ctx, store->hash, &hash);
+		item = fz_hash_find(ctx, shard->hash, &hash);
 	}
 	else
 	{
 		/* Others we have to hunt for slowly */
-		for (item = store->head; item; item = item->next)
-			if (item->val->drop == drop && !type->cmp_key(ctx, item->key, key))
-				break;
+		item = NULL;
+		for (l = 0; l < STORE_LISTS && !item; l++)
+			for (item = shard->head[l]; item; item = item->next)
+				if (item->val->drop == drop && !type->cmp_key(ctx, item->key, key))
+					break;
 	}
 	if (item)
 	{
-		/* Momentarily things can be in the hash table without being
-		 * in the list. Don't attempt to unlink these. We indicate
-		 * such items by setting item->next == item. */
-		if (item->next != item)
-		{
-			if (item->next)
-				item->next->prev = item->prev;
-			else
-				store->tail = item->prev;
-			if (item->prev)
-				item->prev->next = item->next;
-			else
-				store->head = item->next;
-		}
-		dodrop = (item->val->refs > 0 && --item->val->refs == 0);
-		fz_unlock(ctx, FZ_LOCK_ALLOC);
+		dodrop = unstore_item(ctx, shard, item);
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
 		if (dodrop)
 			item->val->drop(ctx, item->val);
 		type->drop_key(ctx, item->key);
 		fz_free(ctx, item);
 	}
 	else
-		fz_unlock(ctx, FZ_LOCK_ALLOC);
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
 }
 
 void
 fz_empty_store(fz_context *ctx)
 {
 	fz_store *store = ctx->store;
+	int i, l;
 
 	if (store == NULL)
 		return;
 
-	fz_lock(ctx, FZ_LOCK_ALLOC);
 	/* Run through all the items in the store */
-	while (store->head)
+	for (i = 0; i < STORE_SHARDS; i++)
 	{
-		evict(ctx, store->head); /* Drops then retakes lock */
+		fz_lock(ctx, FZ_LOCK_STORE + i);
+		for (l = 0; l <= PACKED_LIST; l++)
+		{
+			while (store->shard[i].head[l])
+			{
+				evict(ctx, i, store->shard[i].head[l], 0); /* Drops then retakes lock */
+			}
+		}
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
 	}
-	fz_unlock(ctx, FZ_LOCK_ALLOC);
 }
 
 fz_store *
@@ -661,12 +1260,15 @@ fz_keep_store_context(fz_context *ctx)
 void
 fz_drop_store_context(fz_context *ctx)
 {
+	int i;
+
 	if (!ctx)
 		return;
 	if (fz_drop_imp(ctx, ctx->store, &ctx->store->refs))
 	{
 		fz_empty_store(ctx);
-		fz_drop_hash(ctx, ctx->store->hash);
+		for (i = 0; i < STORE_SHARDS; i++)
+			fz_drop_hash(ctx, ctx->store->shard[i].hash);
 		fz_free(ctx, ctx->store);
 		ctx->store = NULL;
 	}
@@ -680,66 +1282,72 @@ print_item(fz_context *ctx, fz_output *out, void *item_)
 }
 
 void
-fz_print_store_locked(fz_context *ctx, fz_output *out)
+fz_print_store(fz_context *ctx, fz_output *out)
 {
-	fz_item *item, *next;
 	fz_store *store = ctx->store;
+	fz_item *item, *next;
+	int i, l, refs;
 
 	fz_printf(ctx, out, "-- resource store contents --\n");
 
-	for (item = store->head; item; item = next)
+	for (i = 0; i < STORE_SHARDS; i++)
 	{
-		next = item->next;
-		if (next)
-			next->val->refs++;
-		fz_printf(ctx, out, "store[*][refs=%d][size=%d] ", item->val->refs, item->size);
-		fz_unlock(ctx, FZ_LOCK_ALLOC);
-		item->type->print(ctx, out, item->key);
-		fz_printf(ctx, out, " = %p\n", item->val);
-		fz_lock(ctx, FZ_LOCK_ALLOC);
-		if (next)
-			next->val->refs--;
+		fz_lock(ctx, FZ_LOCK_STORE + i);
+		for (l = 0; l <= PACKED_LIST; l++)
+		{
+			for (item = store->shard[i].head[l]; item; item = next)
+			{
+				next = item->next;
+				fz_lock(ctx, FZ_LOCK_ALLOC);
+				refs = item->val->refs;
+				fz_unlock(ctx, FZ_LOCK_ALLOC);
+				fz_printf(ctx, out, "store[%d:%d][refs=%d][size=%d] ", i, l, refs, item->size);
+				item->type->print(ctx, out, item->key);
+				fz_printf(ctx, out, " = %p\n", item->val);
+			}
+		}
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
 	}
+
 	fz_printf(ctx, out, "-- resource store hash contents --\n");
-	fz_print_hash_details(ctx, out, store->hash, print_item, 1);
+	for (i = 0; i < STORE_SHARDS; i++)
+	{
+		fz_lock(ctx, FZ_LOCK_STORE + i);
+		fz_print_hash_details(ctx, out, store->shard[i].hash, print_item, 1);
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
+	}
 	fz_printf(ctx, out, "-- end --\n");
 }
 
+/*
+	As the store shards are locked above FZ_LOCK_ALLOC, we have to
+	drop it to look through them.
+*/
 void
-fz_print_store(fz_context *ctx, fz_output *out)
+fz_print_store_locked(fz_context *ctx, fz_output *out)
 {
-	fz_lock(ctx, FZ_LOCK_ALLOC);
-	fz_print_store_locked(ctx, out);
 	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	fz_print_store(ctx, out);
+	fz_lock(ctx, FZ_LOCK_ALLOC);
 }
 
-/* This is now an n^2 algorithm - not ideal, but it'll only be bad if we are
- * actually managing to scavenge lots of blocks back. */
+/*
+	Entered with FZ_LOCK_ALLOC held, which is dropped while the items
+	are evicted (as their shard locks come after it). Values are not
+	packed, as that would take more memory; if evicting them does not
+	free enough, packed values are discarded too.
+*/
 static int
 scavenge(fz_context *ctx, size_t tofree)
 {
-	fz_store *store = ctx->store;
-	size_t count = 0;
-	fz_item *item, *prev;
-
-	/* Free the items */
-	for (item = store->tail; item; item = prev)
-	{
-		prev = item->prev;
-		if (item->val->refs == 1)
-		{
-			/* Free this item */
-			count += item->size;
-			evict(ctx, item); /* Drops then retakes lock */
+	size_t count;
 
-			if (count >= tofree)
-				break;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	count = evict_lru(ctx, tofree, 0);
+	if (count < tofree)
+		count += discard_packed(ctx, tofree - count);
+	fz_lock(ctx, FZ_LOCK_ALLOC);
 
-			/* Have to restart search again, as prev may no longer
-			 * be valid due to release of lock in evict. */
-			prev = store->tail;
-		}
-	}
 	/* Success is managing to evict any blocks */
 	return count != 0;
 }
@@ -802,9 +1410,8 @@ int fz_store_scavenge(fz_context *ctx, size_t size, int *phase)
 int
 fz_shrink_store(fz_context *ctx, unsigned int percent)
 {
-	int success;
 	fz_store *store;
-	size_t new_size;
+	size_t size, new_size, packed_size;
 
 	if (percent >= 100)
 		return 1;
@@ -817,86 +1424,57 @@ fz_shrink_store(fz_context *ctx, unsigned int percent)
 	fprintf(stderr, "fz_shrink_store: " FMT_zu "\n", store->size/(1024*1024));
 #endif
 	fz_lock(ctx, FZ_LOCK_ALLOC);
+	size = store->size;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+
+	new_size = (size_t)(((uint64_t)size * percent) / 100);
+	if (size > new_size)
+		evict_lru(ctx, size - new_size, 0);
 
-	new_size = (size_t)(((uint64_t)store->size * percent) / 100);
-	if (store->size > new_size)
-		scavenge(ctx, store->size - new_size);
+	/* The packed tier is shrunk in proportion */
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	packed_size = store->packed_size;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	packed_size -= (size_t)(((uint64_t)packed_size * percent) / 100);
+	if (packed_size > 0)
+		discard_packed(ctx, packed_size);
 
-	success = (store->size <= new_size) ? 1 : 0;
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	size = store->size;
 	fz_unlock(ctx, FZ_LOCK_ALLOC);
 #ifdef DEBUG_SCAVENGING
 	fprintf(stderr, "fz_shrink_store after: " FMT_zu "\n", store->size/(1024*1024));
 #endif
 
-	return success;
+	return (size <= new_size) ? 1 : 0;
 }
 
-void fz_filter_store(fz_context *ctx, fz_store_filter_fn *fn, void *arg, fz_store_type *type)
+typedef struct
 {
-	fz_store *store;
-	fz_item *item, *prev, *remove;
-
-	store = ctx->store;
-	if (store == NULL)
-		return;
-
-	fz_lock(ctx, FZ_LOCK_ALLOC);
-
-	/* Filter the items */
-	remove = NULL;
-	for (item = store->tail; item; item = prev)
-	{
-		prev = item->prev;
-		if (item->type != type)
-			continue;
-
-		if (fn(ctx, arg, item->key) == 0)
-			continue;
-
-		/* We have to drop it */
-		store->size -= item->size;
-
-		/* Unlink from the linked list */
-		if (item->next)
-			item->next->prev = item->prev;
-		else
-			store->tail = item->prev;
-		if (item->prev)
-			item->prev->next = item->next;
-		else
-			store->head = item->next;
-
-		/* Remove from the hash table */
-		if (item->type->make_hash_key)
-		{
-			fz_store_hash hash = { NULL };
-			hash.drop = item->val->drop;
-			if (item->type->make_hash_key(ctx, &hash, item->key))
-				fz_hash_remove(ctx, store->hash, &hash);
-		}
+	fz_store_filter_fn *fn;
+	void *arg;
+	fz_store_type *type;
+} filter_data;
 
-		/* Store whether to drop this value or not in 'prev' */
-		item->prev = (item->val->refs > 0 && --item->val->refs == 0) ? item : NULL;
+static int
+filter_match(fz_context *ctx, fz_item *item, void *arg)
+{
+	filter_data *data = (filter_data *)arg;
 
-		/* Store it in our removal chain - just singly linked */
-		item->next = remove;
-		remove = item;
-	}
-	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	return item->type == data->type && data->fn(ctx, data->arg, item->key);
+}
 
-	/* Now drop the remove chain */
-	for (item = remove; item != NULL; item = remove)
-	{
-		remove = item->next;
+void fz_filter_store(fz_context *ctx, fz_store_filter_fn *fn, void *arg, fz_store_type *type)
+{
+	filter_data data;
 
-		/* Drop a reference to the value (freeing if required) */
-		if (item->prev)
-			item->val->drop(ctx, item->val);
+	if (ctx->store == NULL)
+		return;
 
-		/* Always drops the key and drop the item */
-		item->type->drop_key(ctx, item->key);
-		fz_free(ctx, item);
-	}
+	data.fn = fn;
+	data.arg = arg;
+	data.type = type;
+	remove_matching(ctx, filter_match, &data);
 }
 
 void fz_defer_reap_start(fz_context *ctx)
@@ -916,13 +1494,136 @@ void fz_defer_reap_end(fz_context *ctx)
 	if (ctx->store == NULL)
 		return;
 
-	fz_lock(ctx, FZ_LOCK_ALLOC);
 	fz_lock(ctx, FZ_LOCK_REAP);
 	--ctx->store->defer_reap_count;
 	reap = ctx->store->defer_reap_count == 0 && ctx->store->needs_reaping;
 	if (reap)
-		do_reap(ctx); /* Drops FZ_LOCK_ALLOC */
+		ctx->store->needs_reaping = 0;
 	fz_unlock(ctx, FZ_LOCK_REAP);
-	if (!reap)
-		fz_unlock(ctx, FZ_LOCK_ALLOC);
+	if (reap)
+		do_reap(ctx);
+}
+
+void fz_set_store_policy(fz_context *ctx, int policy)
+{
+	if (ctx->store == NULL)
+		return;
+
+	if (policy < FZ_STORE_POLICY_LRU || policy > FZ_STORE_POLICY_COST)
+		policy = FZ_STORE_POLICY_LRU;
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	ctx->store->policy = policy;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+}
+
+int fz_store_policy(fz_context *ctx)
+{
+	int policy;
+
+	if (ctx->store == NULL)
+		return FZ_STORE_POLICY_LRU;
+
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	policy = ctx->store->policy;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	return policy;
+}
+
+size_t fz_store_max(fz_context *ctx)
+{
+	size_t max;
+
+	if (ctx->store == NULL)
+		return 0;
+
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	max = ctx->store->max;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	return max;
+}
+
+void fz_store_stats_for_type(fz_context *ctx, const fz_store_type *type, fz_store_stats *stats)
+{
+	fz_store *store = ctx->store;
+	int i, j;
+
+	memset(stats, 0, sizeof(*stats));
+	if (store == NULL)
+		return;
+
+	for (i = 0; i < STORE_SHARDS; i++)
+	{
+		fz_lock(ctx, FZ_LOCK_STORE + i);
+		for (j = 0; j < MAX_STORE_TYPES && store->shard[i].types[j].type; j++)
+		{
+			const fz_store_stats *s = &store->shard[i].types[j].stats;
+
+			if (store->shard[i].types[j].type != type)
+				continue;
+			stats->hits += s->hits;
+			stats->misses += s->misses;
+			stats->stores += s->stores;
+			stats->evictions += s->evictions;
+			stats->evicted += s->evicted;
+			stats->count += s->count;
+			stats->size += s->size;
+			stats->packs += s->packs;
+			stats->restores += s->restores;
+			stats->discards += s->discards;
+			stats->packed_count += s->packed_count;
+			stats->packed_size += s->packed_size;
+		}
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
+	}
+}
+
+void fz_print_store_stats(fz_context *ctx, fz_output *out)
+{
+	static const char *policies[] = { "lru", "2q", "cost" };
+	const fz_store_type *types[MAX_STORE_TYPES];
+	fz_store *store = ctx->store;
+	fz_store_stats stats;
+	int i, j, k, n = 0;
+
+	if (store == NULL)
+		return;
+
+	/* Gather the types seen by any of the shards */
+	for (i = 0; i < STORE_SHARDS; i++)
+	{
+		fz_lock(ctx, FZ_LOCK_STORE + i);
+		for (j = 0; j < MAX_STORE_TYPES && store->shard[i].types[j].type; j++)
+		{
+			for (k = 0; k < n; k++)
+				if (types[k] == store->shard[i].types[j].type)
+					break;
+			if (k == n && n < MAX_STORE_TYPES)
+				types[n++] = store->shard[i].types[j].type;
+		}
+		fz_unlock(ctx, FZ_LOCK_STORE + i);
+	}
+
+	fz_printf(ctx, out, "-- resource store statistics (policy %s) --\n", policies[fz_store_policy(ctx)]);
+	for (k = 0; k < n; k++)
+	{
+		fz_store_stats_for_type(ctx, types[k], &stats);
+		fz_printf(ctx, out, "%s: hits=%d misses=%d stores=%d evictions=%d (" FMT_zu " bytes) items=%d (" FMT_zu " bytes)\n",
+			types[k]->name, stats.hits, stats.misses, stats.stores,
+			stats.evictions, stats.evicted, stats.count, stats.size);
+		if (stats.packs)
+			fz_printf(ctx, out, "%s: packs=%d restores=%d discards=%d packed=%d (" FMT_zu " bytes)\n",
+				types[k]->name, stats.packs, stats.restores, stats.discards,
+				stats.packed_count, stats.packed_size);
+	}
+}
+
+void fz_set_store_packed_size(fz_context *ctx, size_t max)
+{
+	if (ctx->store == NULL)
+		return;
+
+	fz_lock(ctx, FZ_LOCK_ALLOC);
+	ctx->store->packed_max = max;
+	fz_unlock(ctx, FZ_LOCK_ALLOC);
+	trim_packed(ctx);
 }
@@ -1,5 +1,12 @@
 #include "fitz-imp.h"
 
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#define HAVE_MMAP
+#endif
+
 int
 fz_file_exists(fz_context *ctx, const char *path)
 {
@@ -126,6 +133,73 @@ fz_open_file_ptr(fz_context *ctx, FILE *file)
 	return stm;
 }
 
+/* Mapped file */
+
+#ifdef HAVE_MMAP
+static void unmap_file(unsigned char *data, size_t len)
+{
+	munmap(data, len);
+}
+
+/* Map a regular file into memory, as a buffer that unmaps it when it
+ * is dropped. Returns NULL if the file cannot be mapped, leaving it
+ * to be read through the FILE instead. */
+static fz_buffer *
+map_file(fz_context *ctx, FILE *file)
+{
+	struct stat info;
+	fz_buffer *buf;
+	void *data;
+
+	if (fstat(fileno(file), &info) != 0 || !S_ISREG(info.st_mode))
+		return NULL;
+	if (info.st_size <= 0 || (uint64_t)info.st_size > SIZE_MAX)
+		return NULL;
+	data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+	if (data == MAP_FAILED)
+		return NULL;
+
+	fz_try(ctx)
+		buf = fz_new_buffer_from_shared_data(ctx, data, (size_t)info.st_size);
+	fz_catch(ctx)
+	{
+		munmap(data, (size_t)info.st_size);
+		fz_rethrow(ctx);
+	}
+	buf->unmap = unmap_file;
+
+	return buf;
+}
+
+static fz_stream *
+fz_open_mapped_file(fz_context *ctx, FILE *file)
+{
+	fz_stream *stm = NULL;
+	fz_buffer *buf;
+
+	fz_try(ctx)
+		buf = map_file(ctx, file);
+	fz_catch(ctx)
+	{
+		fclose(file);
+		fz_rethrow(ctx);
+	}
+	if (!buf)
+		return fz_open_file_ptr(ctx, file);
+
+	/* The mapping stays valid once the file is closed. */
+	fclose(file);
+	fz_try(ctx)
+		stm = fz_open_buffer(ctx, buf);
+	fz_always(ctx)
+		fz_drop_buffer(ctx, buf);
+	fz_catch(ctx)
+		fz_rethrow(ctx);
+
+	return stm;
+}
+#endif
+
 fz_stream *
 fz_open_file(fz_context *ctx, const char *name)
 {
@@ -147,6 +221,10 @@ fz_open_file(fz_context *ctx, const char *name)
 #endif
 	if (f == NULL)
 		fz_throw(ctx, FZ_ERROR_GENERIC, "cannot open %s: %s", name, strerror(errno));
+#ifdef HAVE_MMAP
+	if (fz_map_files(ctx))
+		return fz_open_mapped_file(ctx, f);
+#endif
 	return fz_open_file_ptr(ctx, f);
 }
 
@@ -226,3 +304,32 @@ fz_open_memory(fz_context *ctx, unsigned char *data, size_t len)
 
 	return stm;
 }
+
+int
+fz_is_memory_stream(fz_context *ctx, fz_stream *stm)
+{
+	return stm->next == next_buffer;
+}
+
+fz_buffer *
+fz_slice_stream(fz_context *ctx, fz_stream *stm, fz_off_t offset, size_t len)
+{
+	fz_buffer *buf;
+
+	/* Only buffers whose storage cannot move (such as mapped files)
+	 * can be sliced; fz_open_memory streams have no buffer at all. */
+	if (stm->close != close_buffer || stm->state == NULL)
+		return NULL;
+	buf = stm->state;
+	if (!buf->shared)
+		return NULL;
+
+	if (offset < 0)
+		offset = 0;
+	if ((uint64_t)offset > buf->len)
+		offset = (fz_off_t)buf->len;
+	if (len > buf->len - (size_t)offset)
+		len = buf->len - (size_t)offset;
+
+	return fz_new_buffer_slice(ctx, buf, (size_t)offset, len);
+}
@@ -0,0 +1,56 @@
+#ifndef MUPDF_FITZ_THREAD_IMP_H
+#define MUPDF_FITZ_THREAD_IMP_H
+
+/*
+	Threads and mutexes for the parts of the library that share work
+	out between threads of their own. FZ_THREADS is left undefined
+	when there are no threads, in which case the mutexes do nothing
+	and the work is all done by the calling thread.
+*/
+
+#ifdef _MSC_VER
+#include <windows.h>
+#define FZ_THREADS 1
+#elif defined(HAVE_PTHREADS)
+#include <pthread.h>
+#define FZ_THREADS 2
+#endif
+
+#if FZ_THREADS == 1
+
+#define THREAD HANDLE
+#define THREAD_INIT(A,B,C) ((A = CreateThread(NULL, 0, B, C, 0, NULL)) == NULL)
+#define THREAD_FIN(A) do { (void)WaitForSingleObject(A, INFINITE); CloseHandle(A); } while (0)
+#define THREAD_RETURN_TYPE DWORD WINAPI
+#define THREAD_RETURN() return 0
+#define MUTEX CRITICAL_SECTION
+#define MUTEX_INIT(A) do { InitializeCriticalSection(&A); } while (0)
+#define MUTEX_FIN(A) do { DeleteCriticalSection(&A); } while (0)
+#define MUTEX_LOCK(A) do { EnterCriticalSection(&A); } while (0)
+#define MUTEX_UNLOCK(A) do { LeaveCriticalSection(&A); } while (0)
+
+#elif FZ_THREADS == 2
+
+#define THREAD pthread_t
+#define THREAD_INIT(A,B,C) (pthread_create(&A, NULL, B, C) != 0)
+#define THREAD_FIN(A) do { void *res; (void)pthread_join(A, &res); } while (0)
+#define THREAD_RETURN_TYPE void *
+#define THREAD_RETURN() return NULL
+#define MUTEX pthread_mutex_t
+#define MUTEX_INIT(A) do { (void)pthread_mutex_init(&A, NULL); } while (0)
+#define MUTEX_FIN(A) do { (void)pthread_mutex_destroy(&A); } while (0)
+#define MUTEX_LOCK(A) do { (void)pthread_mutex_lock(&A); } while (0)
+#define MUTEX_UNLOCK(A) do { (void)pthread_mutex_unlock(&A); } while (0)
+
+#else
+
+/* No threads. */
+#define MUTEX int
+#define MUTEX_INIT(A) do { (void)A; } while (0)
+#define MUTEX_FIN(A) do { (void)A; } while (0)
+#define MUTEX_LOCK(A) do { (void)A; } while (0)
+#define MUTEX_UNLOCK(A) do { (void)A; } while (0)
+
+#endif
+
+#endif
@@ -49,18 +49,211 @@ load_icc_based(fz_context *ctx, pdf_document *doc, pdf_obj *dict)
 
 /* Separation and DeviceN */
 
+/*
+	Tint transforms that are PostScript calculator or stitching
+	functions are costly to evaluate for every colour of an image or
+	shading, so we sample them when the colorspace is loaded and
+	interpolate in the samples instead.
+
+	With 1 input the samples fall on the 8 bit values, so that image
+	samples land on them; if that is not close enough in between, we
+	try again with 16 times as many.
+	With more inputs we use a grid of about 4096 cells, interpolated
+	multilinearly, which is exact for the usual tint transforms that
+	mix the inputs as products and sums.
+
+	A table is only kept if it agrees with the function at the middle
+	of every cell to within TINT_TOLERANCE. Otherwise the function is
+	evaluated directly, as before.
+*/
+
+#define TINT_MAX_INPUTS 8
+#define TINT_TOLERANCE (0.5f / 255)
+#define TINT_CHUNK 32
+
+/* Intervals along each axis of the grid, by the number of inputs. */
+static const int tint_intervals[TINT_MAX_INPUTS + 1] = { 0, 255, 64, 16, 8, 5, 4, 3, 2 };
+
 struct separation
 {
 	fz_colorspace *base;
 	fz_function *tint;
+	int n;
+	int intervals;
+	int stride[TINT_MAX_INPUTS];
+	float *table;
 };
 
+static void
+eval_tint_table(struct separation *sep, const float *in, float *out)
+{
+	int axis[TINT_MAX_INPUTS];
+	float frac[TINT_MAX_INPUTS];
+	int m = sep->base->n;
+	int g = sep->intervals;
+	int i, j, k, na, off;
+
+	/* Find the cell, leaving out the axes the point lies on a grid
+	 * line of, as they contribute only one corner. */
+	off = 0;
+	na = 0;
+	for (k = 0; k < sep->n; k++)
+	{
+		float x = fz_clamp(in[k], 0, 1) * g;
+		int ix = (int)x;
+		float f;
+		if (ix >= g)
+			ix = g - 1;
+		f = x - ix;
+		if (f >= 1)
+			ix++;
+		off += ix * sep->stride[k];
+		if (f > 0 && f < 1)
+		{
+			axis[na] = k;
+			frac[na] = f;
+			na++;
+		}
+	}
+
+	for (j = 0; j < m; j++)
+		out[j] = 0;
+	for (i = 0; i < (1 << na); i++)
+	{
+		const float *p = sep->table + off;
+		float w = 1;
+		for (k = 0; k < na; k++)
+		{
+			if (i & (1 << k))
+			{
+				w *= frac[k];
+				p += sep->stride[axis[k]];
+			}
+			else
+				w *= 1 - frac[k];
+		}
+		for (j = 0; j < m; j++)
+			out[j] += w * p[j];
+	}
+}
+
+static void
+eval_tint(fz_context *ctx, struct separation *sep, const float *in, float *out)
+{
+	if (sep->table)
+		eval_tint_table(sep, in, out);
+	else
+		fz_eval_function(ctx, sep->tint, in, sep->n, out, sep->base->n);
+}
+
+/* Sample the tint transform on a grid with the given number of
+ * intervals along each axis, and check it against the function at the
+ * middle of each cell. Returns 0 if it is not close enough. */
+static int
+make_tint_table(fz_context *ctx, struct separation *sep, int intervals)
+{
+	float in[TINT_CHUNK * TINT_MAX_INPUTS];
+	float want[TINT_CHUNK * FZ_MAX_COLORS];
+	float got[FZ_MAX_COLORS];
+	int n = sep->n;
+	int m = sep->base->n;
+	int count, cells, i, j, k, l, x, len;
+	int ok = 1;
+
+	sep->intervals = intervals;
+	count = 1;
+	cells = 1;
+	for (k = n - 1; k >= 0; k--)
+	{
+		sep->stride[k] = count * m;
+		count *= intervals + 1;
+		cells *= intervals;
+	}
+
+	sep->table = fz_malloc_array(ctx, count, m * sizeof(float));
+
+	fz_var(ok);
+
+	/* The function is evaluated a chunk of points at a time, which is
+	 * quicker for those that can do several at once. */
+	fz_try(ctx)
+	{
+		for (i = 0; i < count; i += len)
+		{
+			len = fz_mini(count - i, TINT_CHUNK);
+			for (l = 0; l < len; l++)
+				for (x = i + l, k = n - 1; k >= 0; k--, x /= intervals + 1)
+					in[l * n + k] = (float)(x % (intervals + 1)) / intervals;
+			fz_eval_function_n(ctx, sep->tint, in, n, sep->table + i * m, m, len);
+		}
+
+		for (i = 0; i < cells && ok; i += len)
+		{
+			len = fz_mini(cells - i, TINT_CHUNK);
+			for (l = 0; l < len; l++)
+				for (x = i + l, k = n - 1; k >= 0; k--, x /= intervals)
+					in[l * n + k] = (x % intervals + 0.5f) / intervals;
+			fz_eval_function_n(ctx, sep->tint, in, n, want, m, len);
+			for (l = 0; l < len && ok; l++)
+			{
+				eval_tint_table(sep, in + l * n, got);
+				for (j = 0; j < m; j++)
+					if (fabsf(want[l * m + j] - got[j]) > TINT_TOLERANCE)
+						ok = 0;
+			}
+		}
+	}
+	fz_catch(ctx)
+	{
+		/* Leave it to be evaluated directly, and to fail then. */
+		ok = 0;
+	}
+
+	if (!ok)
+	{
+		fz_free(ctx, sep->table);
+		sep->table = NULL;
+	}
+	return ok;
+}
+
+static void
+load_tint_table(fz_context *ctx, struct separation *sep, pdf_obj *tintobj)
+{
+	int type = pdf_to_int(ctx, pdf_dict_get(ctx, tintobj, PDF_NAME_FunctionType));
+
+	/* Sampled functions are tables already, and exponential ones are
+	 * cheap enough to evaluate. */
+	if (type != 3 && type != 4)
+		return;
+	if (sep->n > TINT_MAX_INPUTS)
+		return;
+
+	if (make_tint_table(ctx, sep, tint_intervals[sep->n]))
+		return;
+	if (sep->n == 1)
+		make_tint_table(ctx, sep, tint_intervals[1] * 16);
+}
+
+static size_t
+tint_table_size(struct separation *sep)
+{
+	size_t count = 1;
+	int k;
+
+	if (!sep->table)
+		return 0;
+	for (k = 0; k < sep->n; k++)
+		count *= sep->intervals + 1;
+	return count * sep->base->n * sizeof(float);
+}
+
 static void
 separation_to_rgb(fz_context *ctx, fz_colorspace *cs, const float *color, float *rgb)
 {
 	struct separation *sep = cs->data;
 	float alt[FZ_MAX_COLORS];
-	fz_eval_function(ctx, sep->tint, color, cs->n, alt, sep->base->n);
+	eval_tint(ctx, sep, color, alt);
 	fz_convert_color(ctx, fz_device_rgb(ctx), rgb, sep->base, alt);
 }
 
@@ -70,6 +263,7 @@ free_separation(fz_context *ctx, fz_colorspace *cs)
 	struct separation *sep = cs->data;
 	fz_drop_colorspace(ctx, sep->base);
 	fz_drop_function(ctx, sep->tint);
+	fz_free(ctx, sep->table);
 	fz_free(ctx, sep);
 }
 
@@ -107,14 +301,18 @@ load_separation(fz_context *ctx, pdf_document *doc, pdf_obj *array)
 		sep = fz_malloc_struct(ctx, struct separation);
 		sep->base = base;
 		sep->tint = tint;
+		sep->n = n;
+		load_tint_table(ctx, sep, tintobj);
 
 		cs = fz_new_colorspace(ctx, n == 1 ? "Separation" : "DeviceN", n, separation_to_rgb, NULL, free_separation, sep,
-			sizeof(struct separation) + (base ? base->size : 0) + fz_function_size(ctx, tint));
+			sizeof(struct separation) + (base ? base->size : 0) + fz_function_size(ctx, tint) + tint_table_size(sep));
 	}
 	fz_catch(ctx)
 	{
 		fz_drop_colorspace(ctx, base);
 		fz_drop_function(ctx, tint);
+		if (sep)
+			fz_free(ctx, sep->table);
 		fz_free(ctx, sep);
 		fz_rethrow(ctx);
 	}
@@ -913,11 +913,14 @@ hail_mary_print_key(fz_context *ctx, fz_output *out, void *key_)
 
 static fz_store_type hail_mary_store_type =
 {
+	"hail_mary",
 	hail_mary_make_hash_key,
 	hail_mary_keep_key,
 	hail_mary_drop_key,
 	hail_mary_cmp_key,
-	hail_mary_print_key
+	hail_mary_print_key,
+	NULL,
+	8
 };
 
 pdf_font_desc *
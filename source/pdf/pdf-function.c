@@ -1,6 +1,7 @@
 #include "mupdf/pdf.h"
 
 typedef struct psobj_s psobj;
+typedef struct ps_prog_s ps_prog;
 
 enum
 {
@@ -46,6 +47,7 @@ struct pdf_function_s
 		struct {
 			psobj *code;
 			int cap;
+			ps_prog *prog;
 		} p;
 	} u;
 };
@@ -190,19 +192,25 @@ ps_push_int(ps_stack *st, int n)
 	}
 }
 
+static inline float
+ps_real(float n)
+{
+	if (isnan(n))
+	{
+		/* Use 1.0, as it's a small known value that won't
+		 * cause a divide by 0. Same reason as in fz_atof. */
+		return 1.0;
+	}
+	return fz_clamp(n, -FLT_MAX, FLT_MAX);
+}
+
 static void
 ps_push_real(ps_stack *st, float n)
 {
 	if (!ps_overflow(st, 1))
 	{
 		st->stack[st->sp].type = PS_REAL;
-		if (isnan(n))
-		{
-			/* Push 1.0, as it's a small known value that won't
-			 * cause a divide by 0. Same reason as in fz_atof. */
-			n = 1.0;
-		}
-		st->stack[st->sp].u.f = fz_clamp(n, -FLT_MAX, FLT_MAX);
+		st->stack[st->sp].u.f = ps_real(n);
 		st->sp++;
 	}
 }
@@ -285,7 +293,7 @@ ps_roll(ps_stack *st, int n, int j)
 static void
 ps_index(ps_stack *st, int n)
 {
-	if (!ps_overflow(st, 1) && !ps_underflow(st, n))
+	if (!ps_overflow(st, 1) && !ps_underflow(st, n + 1))
 	{
 		st->stack[st->sp] = st->stack[st->sp - n - 1];
 		st->sp++;
@@ -468,7 +476,11 @@ ps_run(fz_context *ctx, psobj *code, ps_stack *st, int pc)
 			case PS_OP_IDIV:
 				i2 = ps_pop_int(st);
 				i1 = ps_pop_int(st);
-				if (i2 != 0)
+				/* INT_MIN / -1 traps; constants are folded at load time,
+				 * even in branches that are never taken. */
+				if (i2 == -1)
+					ps_push_int(st, (int)(0u - (unsigned int)i1));
+				else if (i2 != 0)
 					ps_push_int(st, i1 / i2);
 				else
 					ps_push_int(st, DIV_BY_ZERO(i1, i2, INT_MIN, INT_MAX));
@@ -519,7 +531,9 @@ ps_run(fz_context *ctx, psobj *code, ps_stack *st, int pc)
 			case PS_OP_MOD:
 				i2 = ps_pop_int(st);
 				i1 = ps_pop_int(st);
-				if (i2 != 0)
+				if (i2 == -1)
+					ps_push_int(st, 0);
+				else if (i2 != 0)
 					ps_push_int(st, i1 % i2);
 				else
 					ps_push_int(st, DIV_BY_ZERO(i1, i2, INT_MIN, INT_MAX));
@@ -832,6 +846,812 @@ parse_code(fz_context *ctx, pdf_function *func, fz_stream *stream, int *codeptr,
 	}
 }
 
+/*
+ * Compiled PostScript calculator
+ *
+ * Most calculator functions do no more than shuffle their inputs about
+ * and combine them as reals, with the operands of copy, index and roll
+ * given as constants. These we run through once when they are loaded,
+ * on a stack of symbolic values, leaving a list of float operations on
+ * registers: the stack shuffling is done with, operations on constants
+ * are folded (by ps_run, so that they come out the same), an if or an
+ * ifelse on a value becomes a select between the results of both of
+ * its branches, and whatever does not reach the outputs is dropped.
+ *
+ * The list is run on a block of inputs at a time, each operation over
+ * the whole block, which shares the cost of dispatching it.
+ *
+ * Anything else (integers or booleans that are not constants, stack
+ * underflows and overflows, operands of the wrong type) is left to
+ * ps_run.
+ */
+
+enum { PS_OP_SELECT = PS_OP_XOR + 1 };
+
+#define PS_MAX_REGS 512
+#define PS_BLOCK_FLOATS 2048
+#define PS_MAX_BLOCK 32
+
+typedef struct ps_insn_s ps_insn;
+typedef struct ps_value_s ps_value;
+typedef struct ps_compiler_s ps_compiler;
+
+struct ps_insn_s
+{
+	int op;
+	int d, a, b, c;
+};
+
+struct ps_prog_s
+{
+	int nregs;
+	int block;
+	int ninsns;
+	ps_insn *insns;
+	int nconsts;
+	int *const_reg;
+	float *const_val;
+	int out[FZ_FN_MAXN];
+};
+
+/* A value on the stack while compiling: a constant if reg < 0, and
+ * otherwise a register holding a real, or a boolean as 0 or 1. */
+struct ps_value_s
+{
+	psobj v;
+	int reg;
+};
+
+struct ps_compiler_s
+{
+	ps_value stack[100];
+	int sp;
+	int nregs;
+	int ninsns, cap;
+	ps_insn *insns;
+	int nconsts, const_cap;
+	int *const_reg;
+	float *const_val;
+};
+
+static int
+ps_arity(int op)
+{
+	switch (op)
+	{
+	case PS_OP_FALSE: case PS_OP_TRUE:
+		return 0;
+	case PS_OP_ABS: case PS_OP_CEILING: case PS_OP_COS: case PS_OP_CVI:
+	case PS_OP_CVR: case PS_OP_FLOOR: case PS_OP_LN: case PS_OP_LOG:
+	case PS_OP_NEG: case PS_OP_NOT: case PS_OP_ROUND: case PS_OP_SIN:
+	case PS_OP_SQRT: case PS_OP_TRUNCATE:
+		return 1;
+	case PS_OP_ADD: case PS_OP_AND: case PS_OP_ATAN: case PS_OP_BITSHIFT:
+	case PS_OP_DIV: case PS_OP_EQ: case PS_OP_EXP: case PS_OP_GE:
+	case PS_OP_GT: case PS_OP_IDIV: case PS_OP_LE: case PS_OP_LT:
+	case PS_OP_MOD: case PS_OP_MUL: case PS_OP_NE: case PS_OP_OR:
+	case PS_OP_SUB: case PS_OP_XOR:
+		return 2;
+	}
+	return -1;
+}
+
+static inline int ps_is_bool(const ps_value *v)
+{
+	return v->v.type == PS_BOOL;
+}
+
+/* Reals, and integer constants, which the operators take as reals. */
+static inline int ps_is_num(const ps_value *v)
+{
+	return v->v.type == PS_REAL || (v->reg < 0 && v->v.type == PS_INT);
+}
+
+static inline int ps_same_value(const ps_value *a, const ps_value *b)
+{
+	if (a->reg >= 0 || b->reg >= 0)
+		return a->reg == b->reg;
+	if (a->v.type != b->v.type)
+		return 0;
+	switch (a->v.type)
+	{
+	case PS_BOOL: return a->v.u.b == b->v.u.b;
+	case PS_INT: return a->v.u.i == b->v.u.i;
+	default: return !memcmp(&a->v.u.f, &b->v.u.f, sizeof(float));
+	}
+}
+
+static int
+ps_new_reg(ps_compiler *c)
+{
+	if (c->nregs >= PS_MAX_REGS)
+		return -1;
+	return c->nregs++;
+}
+
+static int
+ps_emit(fz_context *ctx, ps_compiler *c, int op, int a, int b, int cc)
+{
+	int d = ps_new_reg(c);
+	if (d < 0)
+		return -1;
+	if (c->ninsns == c->cap)
+	{
+		int cap = c->cap ? c->cap * 2 : 64;
+		c->insns = fz_resize_array(ctx, c->insns, cap, sizeof(*c->insns));
+		c->cap = cap;
+	}
+	c->insns[c->ninsns].op = op;
+	c->insns[c->ninsns].d = d;
+	c->insns[c->ninsns].a = a;
+	c->insns[c->ninsns].b = b;
+	c->insns[c->ninsns].c = cc;
+	c->ninsns++;
+	return d;
+}
+
+/* The register holding a value, putting constants into one. */
+static int
+ps_value_reg(fz_context *ctx, ps_compiler *c, const ps_value *v)
+{
+	float f;
+	int i;
+
+	if (v->reg >= 0)
+		return v->reg;
+
+	switch (v->v.type)
+	{
+	case PS_BOOL: f = v->v.u.b ? 1 : 0; break;
+	case PS_INT: f = v->v.u.i; break;
+	default: f = v->v.u.f; break;
+	}
+
+	/* Compare the bits, so as to keep 0 and -0 apart. */
+	for (i = 0; i < c->nconsts; i++)
+		if (!memcmp(&c->const_val[i], &f, sizeof f))
+			return c->const_reg[i];
+
+	if (c->nconsts == c->const_cap)
+	{
+		int cap = c->const_cap ? c->const_cap * 2 : 16;
+		c->const_reg = fz_resize_array(ctx, c->const_reg, cap, sizeof(int));
+		c->const_val = fz_resize_array(ctx, c->const_val, cap, sizeof(float));
+		c->const_cap = cap;
+	}
+	i = ps_new_reg(c);
+	if (i < 0)
+		return -1;
+	c->const_reg[c->nconsts] = i;
+	c->const_val[c->nconsts] = f;
+	c->nconsts++;
+	return i;
+}
+
+static int
+ps_push_value(ps_compiler *c, const ps_value *v)
+{
+	if (c->sp + 1 >= nelem(c->stack))
+		return 0;
+	c->stack[c->sp++] = *v;
+	return 1;
+}
+
+static int
+ps_push_reg(ps_compiler *c, int type, int reg)
+{
+	ps_value v;
+	if (reg < 0)
+		return 0;
+	v.v.type = type;
+	v.v.u.i = 0;
+	v.reg = reg;
+	return ps_push_value(c, &v);
+}
+
+/* Pop the constant operand of copy, index or roll. */
+static int
+ps_pop_count(ps_compiler *c, int *n)
+{
+	ps_value *v;
+	if (c->sp < 1)
+		return 0;
+	v = &c->stack[c->sp - 1];
+	if (v->reg >= 0)
+		return 0;
+	if (v->v.type == PS_INT)
+		*n = v->v.u.i;
+	else if (v->v.type == PS_REAL)
+		*n = v->v.u.f;
+	else
+		return 0;
+	c->sp--;
+	return 1;
+}
+
+/* Run an operator on constants with ps_run, so that the result is
+ * just what it would have been when evaluating the function. */
+static int
+ps_fold(fz_context *ctx, ps_compiler *c, int op, int arity)
+{
+	ps_stack st;
+	psobj code[2];
+	ps_value v;
+	int i;
+
+	ps_init_stack(&st);
+	for (i = 0; i < arity; i++)
+		st.stack[i] = c->stack[c->sp - arity + i].v;
+	st.sp = arity;
+
+	code[0].type = PS_OPERATOR;
+	code[0].u.op = op;
+	code[1].type = PS_OPERATOR;
+	code[1].u.op = PS_OP_RETURN;
+	ps_run(ctx, code, &st, 0);
+	if (st.sp != 1)
+		return 0;
+
+	c->sp -= arity;
+	v.v = st.stack[0];
+	v.reg = -1;
+	return ps_push_value(c, &v);
+}
+
+static int
+ps_compile_op(fz_context *ctx, ps_compiler *c, int op)
+{
+	int arity = ps_arity(op);
+	ps_value *a, *b;
+	int ra, rb, type;
+
+	if (arity < 0 || c->sp < arity)
+		return 0;
+
+	a = &c->stack[c->sp - arity];
+	b = &c->stack[c->sp - 1];
+	if (arity == 0 || (a->reg < 0 && b->reg < 0))
+		return ps_fold(ctx, c, op, arity);
+
+	switch (op)
+	{
+	case PS_OP_CVR:
+		return ps_is_num(a);
+
+	case PS_OP_ABS: case PS_OP_CEILING: case PS_OP_COS: case PS_OP_FLOOR:
+	case PS_OP_LN: case PS_OP_LOG: case PS_OP_NEG: case PS_OP_ROUND:
+	case PS_OP_SIN: case PS_OP_SQRT: case PS_OP_TRUNCATE:
+		if (!ps_is_num(a))
+			return 0;
+		type = PS_REAL;
+		break;
+
+	case PS_OP_ADD: case PS_OP_ATAN: case PS_OP_DIV: case PS_OP_EXP:
+	case PS_OP_MUL: case PS_OP_SUB:
+		if (!ps_is_num(a) || !ps_is_num(b))
+			return 0;
+		type = PS_REAL;
+		break;
+
+	case PS_OP_GE: case PS_OP_GT: case PS_OP_LE: case PS_OP_LT:
+		if (!ps_is_num(a) || !ps_is_num(b))
+			return 0;
+		type = PS_BOOL;
+		break;
+
+	case PS_OP_EQ: case PS_OP_NE:
+		if (!(ps_is_num(a) && ps_is_num(b)) && !(ps_is_bool(a) && ps_is_bool(b)))
+			return 0;
+		type = PS_BOOL;
+		break;
+
+	case PS_OP_AND: case PS_OP_OR: case PS_OP_XOR: case PS_OP_NOT:
+		if (!ps_is_bool(a) || !ps_is_bool(b))
+			return 0;
+		type = PS_BOOL;
+		break;
+
+	default:
+		/* Integer operators on values that are not constants. */
+		return 0;
+	}
+
+	ra = ps_value_reg(ctx, c, a);
+	rb = arity == 2 ? ps_value_reg(ctx, c, b) : -1;
+	if (ra < 0 || (arity == 2 && rb < 0))
+		return 0;
+	c->sp -= arity;
+	return ps_push_reg(c, type, ps_emit(ctx, c, op, ra, rb, -1));
+}
+
+static int ps_compile_block(fz_context *ctx, ps_compiler *c, psobj *code, int pc);
+
+/* Compile both branches of an if or ifelse on a value, and select
+ * between what they leave on the stack. */
+static int
+ps_compile_branches(fz_context *ctx, ps_compiler *c, int cond, psobj *code, int ifpc, int elsepc)
+{
+	ps_value saved[nelem(c->stack)];
+	ps_value taken[nelem(c->stack)];
+	int saved_sp, taken_sp, i, ra, rb;
+
+	saved_sp = c->sp;
+	memcpy(saved, c->stack, saved_sp * sizeof(ps_value));
+
+	if (!ps_compile_block(ctx, c, code, ifpc))
+		return 0;
+	taken_sp = c->sp;
+	memcpy(taken, c->stack, taken_sp * sizeof(ps_value));
+
+	c->sp = saved_sp;
+	memcpy(c->stack, saved, saved_sp * sizeof(ps_value));
+	if (elsepc >= 0 && !ps_compile_block(ctx, c, code, elsepc))
+		return 0;
+
+	if (c->sp != taken_sp)
+		return 0;
+
+	for (i = 0; i < c->sp; i++)
+	{
+		ps_value *a = &taken[i];
+		ps_value *b = &c->stack[i];
+		int type;
+
+		if (ps_same_value(a, b))
+			continue;
+		/* An integer kept from one branch and a real from the other
+		 * would differ in later integer arithmetic, and there are no
+		 * integer registers, so leave those to the interpreter. */
+		type = a->v.type;
+		if (b->v.type != type || (type != PS_BOOL && type != PS_REAL))
+			return 0;
+
+		ra = ps_value_reg(ctx, c, a);
+		rb = ps_value_reg(ctx, c, b);
+		if (ra < 0 || rb < 0)
+			return 0;
+		b->reg = ps_emit(ctx, c, PS_OP_SELECT, cond, ra, rb);
+		b->v.type = type;
+		if (b->reg < 0)
+			return 0;
+	}
+
+	return 1;
+}
+
+static int
+ps_compile_block(fz_context *ctx, ps_compiler *c, psobj *code, int pc)
+{
+	ps_value v, cond;
+	int n, j, i;
+
+	while (1)
+	{
+		switch (code[pc].type)
+		{
+		case PS_INT:
+			v.v = code[pc++];
+			v.reg = -1;
+			if (!ps_push_value(c, &v))
+				return 0;
+			break;
+
+		case PS_REAL:
+			v.v = code[pc++];
+			v.v.u.f = ps_real(v.v.u.f);
+			v.reg = -1;
+			if (!ps_push_value(c, &v))
+				return 0;
+			break;
+
+		case PS_OPERATOR:
+			switch (code[pc++].u.op)
+			{
+			case PS_OP_RETURN:
+				return 1;
+
+			case PS_OP_POP:
+				if (c->sp < 1)
+					return 0;
+				c->sp--;
+				break;
+
+			case PS_OP_DUP:
+				if (c->sp < 1 || !ps_push_value(c, &c->stack[c->sp - 1]))
+					return 0;
+				break;
+
+			case PS_OP_COPY:
+				if (!ps_pop_count(c, &n) || n < 0 || n > c->sp || c->sp + n >= nelem(c->stack))
+					return 0;
+				memcpy(c->stack + c->sp, c->stack + c->sp - n, n * sizeof(ps_value));
+				c->sp += n;
+				break;
+
+			case PS_OP_INDEX:
+				if (!ps_pop_count(c, &n) || n < 0 || n >= c->sp)
+					return 0;
+				if (!ps_push_value(c, &c->stack[c->sp - n - 1]))
+					return 0;
+				break;
+
+			case PS_OP_EXCH:
+				n = 2;
+				j = 1;
+				goto roll;
+
+			case PS_OP_ROLL:
+				if (!ps_pop_count(c, &j) || !ps_pop_count(c, &n))
+					return 0;
+			roll:
+				if (n < 0 || n > c->sp)
+					return 0;
+				if (n == 0 || j == 0)
+					break;
+				j %= n;
+				if (j < 0)
+					j += n;
+				for (i = 0; i < j; i++)
+				{
+					v = c->stack[c->sp - 1];
+					memmove(c->stack + c->sp - n + 1, c->stack + c->sp - n, (n - 1) * sizeof(ps_value));
+					c->stack[c->sp - n] = v;
+				}
+				break;
+
+			case PS_OP_IF:
+			case PS_OP_IFELSE:
+				if (c->sp < 1 || !ps_is_bool(&c->stack[c->sp - 1]))
+					return 0;
+				cond = c->stack[--c->sp];
+				if (code[pc - 1].u.op == PS_OP_IF)
+				{
+					if (cond.reg < 0)
+					{
+						if (cond.v.u.b && !ps_compile_block(ctx, c, code, code[pc + 1].u.block))
+							return 0;
+					}
+					else if (!ps_compile_branches(ctx, c, cond.reg, code, code[pc + 1].u.block, -1))
+						return 0;
+				}
+				else
+				{
+					if (cond.reg < 0)
+					{
+						if (!ps_compile_block(ctx, c, code, code[pc + (cond.v.u.b ? 1 : 0)].u.block))
+							return 0;
+					}
+					else if (!ps_compile_branches(ctx, c, cond.reg, code, code[pc + 1].u.block, code[pc].u.block))
+						return 0;
+				}
+				pc = code[pc + 2].u.block;
+				break;
+
+			default:
+				if (!ps_compile_op(ctx, c, code[pc - 1].u.op))
+					return 0;
+				break;
+			}
+			break;
+
+		default:
+			return 0;
+		}
+	}
+}
+
+static void
+ps_drop_prog(fz_context *ctx, ps_prog *prog)
+{
+	if (prog)
+	{
+		fz_free(ctx, prog->insns);
+		fz_free(ctx, prog->const_reg);
+		fz_free(ctx, prog->const_val);
+		fz_free(ctx, prog);
+	}
+}
+
+/* Keep only the instructions that lead to the outputs, and number the
+ * registers they use from 0, the inputs first. */
+static ps_prog *
+ps_make_prog(fz_context *ctx, ps_compiler *c, int m, int n, const int *out)
+{
+	ps_prog *prog = NULL;
+	int *map;
+	int i, k, nregs;
+
+	map = fz_malloc_array(ctx, c->nregs, sizeof(int));
+
+	fz_var(prog);
+
+	fz_try(ctx)
+	{
+		/* Mark what is live, working back from the outputs. */
+		for (i = 0; i < c->nregs; i++)
+			map[i] = -1;
+		for (k = 0; k < n; k++)
+			map[out[k]] = 0;
+		for (i = c->ninsns - 1; i >= 0; i--)
+		{
+			ps_insn *insn = &c->insns[i];
+			if (map[insn->d] < 0)
+			{
+				insn->op = -1;
+				continue;
+			}
+			map[insn->a] = 0;
+			if (insn->b >= 0)
+				map[insn->b] = 0;
+			if (insn->c >= 0)
+				map[insn->c] = 0;
+		}
+		for (i = 0; i < m; i++)
+			map[i] = i;
+		nregs = m;
+		for (i = m; i < c->nregs; i++)
+			if (map[i] >= 0)
+				map[i] = nregs++;
+
+		prog = fz_malloc_struct(ctx, ps_prog);
+		prog->nregs = nregs;
+		prog->block = fz_clampi(PS_BLOCK_FLOATS / nregs, 1, PS_MAX_BLOCK);
+		prog->insns = fz_malloc_array(ctx, c->ninsns ? c->ninsns : 1, sizeof(ps_insn));
+		for (i = 0; i < c->ninsns; i++)
+		{
+			ps_insn *insn = &c->insns[i];
+			if (insn->op < 0)
+				continue;
+			prog->insns[prog->ninsns].op = insn->op;
+			prog->insns[prog->ninsns].d = map[insn->d];
+			prog->insns[prog->ninsns].a = map[insn->a];
+			prog->insns[prog->ninsns].b = insn->b >= 0 ? map[insn->b] : 0;
+			prog->insns[prog->ninsns].c = insn->c >= 0 ? map[insn->c] : 0;
+			prog->ninsns++;
+		}
+		prog->const_reg = fz_malloc_array(ctx, c->nconsts ? c->nconsts : 1, sizeof(int));
+		prog->const_val = fz_malloc_array(ctx, c->nconsts ? c->nconsts : 1, sizeof(float));
+		for (i = 0; i < c->nconsts; i++)
+		{
+			if (map[c->const_reg[i]] < 0)
+				continue;
+			prog->const_reg[prog->nconsts] = map[c->const_reg[i]];
+			prog->const_val[prog->nconsts] = c->const_val[i];
+			prog->nconsts++;
+		}
+		for (k = 0; k < n; k++)
+			prog->out[k] = map[out[k]];
+	}
+	fz_always(ctx)
+		fz_free(ctx, map);
+	fz_catch(ctx)
+	{
+		ps_drop_prog(ctx, prog);
+		fz_rethrow(ctx);
+	}
+
+	return prog;
+}
+
+static ps_prog *
+ps_compile(fz_context *ctx, pdf_function *func)
+{
+	ps_compiler c = { { { { 0 } } } };
+	ps_prog *prog = NULL;
+	int out[FZ_FN_MAXN];
+	int m = func->base.m;
+	int n = func->base.n;
+	int i, ok;
+
+	fz_var(prog);
+
+	fz_try(ctx)
+	{
+		ok = 1;
+		for (i = 0; i < m && ok; i++)
+			ok = ps_push_reg(&c, PS_REAL, ps_new_reg(&c));
+		if (ok)
+			ok = ps_compile_block(ctx, &c, func->u.p.code, 0);
+		if (ok && c.sp < n)
+			ok = 0;
+		for (i = 0; i < n && ok; i++)
+		{
+			ps_value *v = &c.stack[c.sp - n + i];
+			out[i] = ps_is_num(v) ? ps_value_reg(ctx, &c, v) : -1;
+			ok = out[i] >= 0;
+		}
+		if (ok)
+			prog = ps_make_prog(ctx, &c, m, n, out);
+	}
+	fz_always(ctx)
+	{
+		fz_free(ctx, c.insns);
+		fz_free(ctx, c.const_reg);
+		fz_free(ctx, c.const_val);
+	}
+	fz_catch(ctx)
+	{
+		/* Leave it to ps_run. */
+		prog = NULL;
+	}
+
+	return prog;
+}
+
+static void
+ps_run_prog(pdf_function *func, int count, const float *in, float *out)
+{
+	ps_prog *prog = func->u.p.prog;
+	float regs[PS_BLOCK_FLOATS];
+	int m = func->base.m;
+	int n = func->base.n;
+	int block = prog->block;
+	int i, k, len;
+
+	for (; count > 0; count -= len, in += len * m, out += len * n)
+	{
+		len = fz_mini(count, block);
+
+		for (k = 0; k < m; k++)
+		{
+			float *d = regs + k * block;
+			for (i = 0; i < len; i++)
+				d[i] = ps_real(fz_clamp(in[i * m + k], func->domain[k][0], func->domain[k][1]));
+		}
+
+		for (k = 0; k < prog->nconsts; k++)
+		{
+			float *d = regs + prog->const_reg[k] * block;
+			float f = prog->const_val[k];
+			for (i = 0; i < len; i++)
+				d[i] = f;
+		}
+
+		for (k = 0; k < prog->ninsns; k++)
+		{
+			ps_insn *insn = &prog->insns[k];
+			float *d = regs + insn->d * block;
+			float *a = regs + insn->a * block;
+			float *b = regs + insn->b * block;
+			float *c = regs + insn->c * block;
+			float r;
+
+			switch (insn->op)
+			{
+			case PS_OP_ABS:
+				for (i = 0; i < len; i++)
+					d[i] = fabsf(a[i]);
+				break;
+			case PS_OP_ADD:
+				for (i = 0; i < len; i++)
+					d[i] = ps_real(a[i] + b[i]);
+				break;
+			case PS_OP_AND:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] != 0 && b[i] != 0;
+				break;
+			case PS_OP_ATAN:
+				for (i = 0; i < len; i++)
+				{
+					r = atan2f(a[i], b[i]) * RADIAN;
+					if (r < 0)
+						r += 360;
+					d[i] = r;
+				}
+				break;
+			case PS_OP_CEILING:
+				for (i = 0; i < len; i++)
+					d[i] = ceilf(a[i]);
+				break;
+			case PS_OP_COS:
+				for (i = 0; i < len; i++)
+					d[i] = cosf(a[i]/RADIAN);
+				break;
+			case PS_OP_DIV:
+				for (i = 0; i < len; i++)
+				{
+					if (fabsf(b[i]) >= FLT_EPSILON)
+						d[i] = ps_real(a[i] / b[i]);
+					else
+						d[i] = DIV_BY_ZERO(a[i], b[i], -FLT_MAX, FLT_MAX);
+				}
+				break;
+			case PS_OP_EQ:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] == b[i];
+				break;
+			case PS_OP_EXP:
+				for (i = 0; i < len; i++)
+					d[i] = ps_real(powf(a[i], b[i]));
+				break;
+			case PS_OP_FLOOR:
+				for (i = 0; i < len; i++)
+					d[i] = floorf(a[i]);
+				break;
+			case PS_OP_GE:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] >= b[i];
+				break;
+			case PS_OP_GT:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] > b[i];
+				break;
+			case PS_OP_LE:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] <= b[i];
+				break;
+			case PS_OP_LN:
+				for (i = 0; i < len; i++)
+					d[i] = ps_real(logf(a[i]));
+				break;
+			case PS_OP_LOG:
+				for (i = 0; i < len; i++)
+					d[i] = ps_real(log10f(a[i]));
+				break;
+			case PS_OP_LT:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] < b[i];
+				break;
+			case PS_OP_MUL:
+				for (i = 0; i < len; i++)
+					d[i] = ps_real(a[i] * b[i]);
+				break;
+			case PS_OP_NE:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] != b[i];
+				break;
+			case PS_OP_NEG:
+				for (i = 0; i < len; i++)
+					d[i] = -a[i];
+				break;
+			case PS_OP_NOT:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] == 0;
+				break;
+			case PS_OP_OR:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] != 0 || b[i] != 0;
+				break;
+			case PS_OP_ROUND:
+				for (i = 0; i < len; i++)
+					d[i] = (a[i] >= 0) ? floorf(a[i] + 0.5f) : ceilf(a[i] - 0.5f);
+				break;
+			case PS_OP_SIN:
+				for (i = 0; i < len; i++)
+					d[i] = sinf(a[i]/RADIAN);
+				break;
+			case PS_OP_SQRT:
+				for (i = 0; i < len; i++)
+					d[i] = ps_real(sqrtf(a[i]));
+				break;
+			case PS_OP_SUB:
+				for (i = 0; i < len; i++)
+					d[i] = ps_real(a[i] - b[i]);
+				break;
+			case PS_OP_TRUNCATE:
+				for (i = 0; i < len; i++)
+					d[i] = (a[i] >= 0) ? floorf(a[i]) : ceilf(a[i]);
+				break;
+			case PS_OP_XOR:
+				for (i = 0; i < len; i++)
+					d[i] = (a[i] != 0) ^ (b[i] != 0);
+				break;
+			case PS_OP_SELECT:
+				for (i = 0; i < len; i++)
+					d[i] = a[i] != 0 ? b[i] : c[i];
+				break;
+			}
+		}
+
+		for (k = 0; k < n; k++)
+		{
+			float *s = regs + prog->out[k] * block;
+			for (i = 0; i < len; i++)
+				out[i * n + k] = fz_clamp(s[i], func->range[k][0], func->range[k][1]);
+		}
+	}
+}
+
 static void
 load_postscript_func(fz_context *ctx, pdf_document *doc, pdf_function *func, pdf_obj *dict)
 {
@@ -861,6 +1681,8 @@ load_postscript_func(fz_context *ctx, pdf_document *doc, pdf_function *func, pdf
 
 		codeptr = 0;
 		parse_code(ctx, func, stream, &codeptr, &buf);
+
+		func->u.p.prog = ps_compile(ctx, func);
 	}
 	fz_always(ctx)
 	{
@@ -873,6 +1695,17 @@ load_postscript_func(fz_context *ctx, pdf_document *doc, pdf_function *func, pdf
 	}
 
 	func->base.size += func->u.p.cap * sizeof(psobj);
+	if (func->u.p.prog)
+	{
+		ps_prog *prog = func->u.p.prog;
+		func->base.size += sizeof(*prog) + prog->ninsns * sizeof(ps_insn) + prog->nconsts * (sizeof(int) + sizeof(float));
+	}
+}
+
+static void
+eval_postscript_func_n(fz_context *ctx, fz_function *func, int count, const float *in, float *out)
+{
+	ps_run_prog((pdf_function *)func, count, in, out);
 }
 
 static void
@@ -882,6 +1715,12 @@ eval_postscript_func(fz_context *ctx, pdf_function *func, const float *in, float
 	float x;
 	int i;
 
+	if (func->u.p.prog)
+	{
+		ps_run_prog(func, 1, in, out);
+		return;
+	}
+
 	ps_init_stack(&st);
 
 	for (i = 0; i < func->base.m; i++)
@@ -1362,6 +2201,7 @@ pdf_drop_function_imp(fz_context *ctx, fz_storable *func_)
 		break;
 	case POSTSCRIPT:
 		fz_free(ctx, func->u.p.code);
+		ps_drop_prog(ctx, func->u.p.prog);
 		break;
 	}
 	fz_free(ctx, func);
@@ -1674,6 +2514,8 @@ pdf_load_function(fz_context *ctx, pdf_document *doc, pdf_obj *dict, int in, int
 
 		case POSTSCRIPT:
 			load_postscript_func(ctx, doc, func, dict);
+			if (func->u.p.prog)
+				func->base.evaluate_n = eval_postscript_func_n;
 			break;
 
 		default:
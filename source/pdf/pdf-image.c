@@ -213,6 +213,7 @@ pdf_load_jpx(fz_context *ctx, pdf_document *doc, pdf_obj *dict, int forcemask)
 	fz_pixmap *pix = NULL;
 	pdf_obj *obj;
 	int indexed = 0;
+	int smask_in_data;
 	fz_image *mask = NULL;
 	fz_image *img = NULL;
 
@@ -236,9 +237,6 @@ pdf_load_jpx(fz_context *ctx, pdf_document *doc, pdf_obj *dict, int forcemask)
 			indexed = fz_colorspace_is_indexed(ctx, colorspace);
 		}
 
-		len = fz_buffer_storage(ctx, buf, &data);
-		pix = fz_load_jpx(ctx, data, len, colorspace, indexed);
-
 		obj = pdf_dict_geta(ctx, dict, PDF_NAME_SMask, PDF_NAME_Mask);
 		if (pdf_is_dict(ctx, obj))
 		{
@@ -248,19 +246,74 @@ pdf_load_jpx(fz_context *ctx, pdf_document *doc, pdf_obj *dict, int forcemask)
 				mask = pdf_load_image_imp(ctx, doc, NULL, obj, NULL, 1);
 		}
 
-		obj = pdf_dict_geta(ctx, dict, PDF_NAME_Decode, PDF_NAME_D);
-		if (obj && !indexed)
+		len = fz_buffer_storage(ctx, buf, &data);
+
+		smask_in_data = pdf_to_int(ctx, pdf_dict_get(ctx, dict, PDF_NAME_SMaskInData));
+
+		/* Soft masks are made from the decoded image (see
+		 * pdf_load_image_imp), so are decoded now, as are images with
+		 * the alpha channel in the data, which the image's colorspace
+		 * does not account for. Anything else is decoded when it is
+		 * drawn, at the size it is drawn at, and only as much of it as
+		 * is seen. */
+		if (forcemask || smask_in_data)
 		{
-			float decode[FZ_MAX_COLORS * 2];
-			int i;
+			pix = fz_load_jpx(ctx, data, len, colorspace, indexed);
 
-			for (i = 0; i < pix->n * 2; i++)
-				decode[i] = pdf_to_real(ctx, pdf_array_get(ctx, obj, i));
+			obj = pdf_dict_geta(ctx, dict, PDF_NAME_Decode, PDF_NAME_D);
+			if (obj && !indexed)
+			{
+				float decode[FZ_MAX_COLORS * 2];
+				int i;
+
+				for (i = 0; i < pix->n * 2; i++)
+					decode[i] = pdf_to_real(ctx, pdf_array_get(ctx, obj, i));
+
+				fz_decode_tile(ctx, pix, decode);
+			}
 
-			fz_decode_tile(ctx, pix, decode);
+			img = fz_new_image_from_pixmap(ctx, pix, mask);
 		}
+		else
+		{
+			fz_compressed_buffer *cbuf;
+			fz_colorspace *jpxcs;
+			float decode[FZ_MAX_COLORS * 2];
+			int w, h, xres, yres, n, i;
+			int use_decode = 0;
+			int interpolate;
+
+			fz_load_jpx_info(ctx, data, len, &w, &h, &xres, &yres, &jpxcs);
+			if (colorspace && !indexed && fz_colorspace_n(ctx, colorspace) != fz_colorspace_n(ctx, jpxcs))
+			{
+				fz_warn(ctx, "jpx file and dict colorspace do not match");
+				fz_drop_colorspace(ctx, colorspace);
+				colorspace = NULL;
+			}
+			if (colorspace)
+				fz_drop_colorspace(ctx, jpxcs);
+			else
+				colorspace = jpxcs;
+
+			obj = pdf_dict_geta(ctx, dict, PDF_NAME_Decode, PDF_NAME_D);
+			if (obj && !indexed)
+			{
+				n = fz_colorspace_n(ctx, colorspace);
+				for (i = 0; i < n * 2; i++)
+					decode[i] = pdf_to_real(ctx, pdf_array_get(ctx, obj, i));
+				use_decode = 1;
+			}
+
+			cbuf = fz_malloc_struct(ctx, fz_compressed_buffer);
+			cbuf->buffer = fz_keep_buffer(ctx, buf);
+			cbuf->params.type = FZ_IMAGE_JPX;
+			interpolate = pdf_to_bool(ctx, pdf_dict_geta(ctx, dict, PDF_NAME_Interpolate, PDF_NAME_I));
 
-		img = fz_new_image_from_pixmap(ctx, pix, mask);
+			/* BitsPerComponent is ignored for JPX; the decoder
+			 * always gives 8 bits per component. */
+			img = fz_new_image_from_compressed_buffer(ctx, w, h, 8, colorspace, xres, yres, interpolate, 0,
+				use_decode ? decode : NULL, NULL, cbuf, mask);
+		}
 	}
 	fz_always(ctx)
 	{
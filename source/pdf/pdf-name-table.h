@@ -0,0 +1,383 @@
+char *PDF_NAMES[] =
+{
+	"",
+	"3D",
+	"A",
+	"A85",
+	"AA",
+	"AESV2",
+	"AESV3",
+	"AHx",
+	"AP",
+	"AS",
+	"ASCII85Decode",
+	"ASCIIHexDecode",
+	"AcroForm",
+	"Adobe.PPKLite",
+	"All",
+	"AllOff",
+	"AllOn",
+	"Alpha",
+	"Alternate",
+	"Annot",
+	"Annots",
+	"AnyOff",
+	"ArtBox",
+	"Ascent",
+	"B",
+	"BBox",
+	"BC",
+	"BE",
+	"BG",
+	"BM",
+	"BPC",
+	"BS",
+	"Background",
+	"BaseEncoding",
+	"BaseFont",
+	"BaseState",
+	"BitsPerComponent",
+	"BitsPerCoordinate",
+	"BitsPerFlag",
+	"BitsPerSample",
+	"BlackIs1",
+	"BleedBox",
+	"Blinds",
+	"Border",
+	"Bounds",
+	"Box",
+	"Bt",
+	"Btn",
+	"ByteRange",
+	"C",
+	"C0",
+	"C1",
+	"CA",
+	"CCF",
+	"CCITTFaxDecode",
+	"CF",
+	"CFM",
+	"CIDFontType0",
+	"CIDFontType0C",
+	"CIDFontType2",
+	"CIDSystemInfo",
+	"CIDToGIDMap",
+	"CMYK",
+	"CS",
+	"CalCMYK",
+	"CalGray",
+	"CalRGB",
+	"CapHeight",
+	"Caret",
+	"Catalog",
+	"Ch",
+	"CharProcs",
+	"Circle",
+	"ColorSpace",
+	"ColorTransform",
+	"Colors",
+	"Columns",
+	"Configs",
+	"Contents",
+	"Coords",
+	"Count",
+	"Cover",
+	"CreationDate",
+	"Creator",
+	"CropBox",
+	"Crypt",
+	"D",
+	"DA",
+	"DC",
+	"DCT",
+	"DCTDecode",
+	"DOS",
+	"DP",
+	"DR",
+	"DV",
+	"DW",
+	"DW2",
+	"DamagedRowsBeforeError",
+	"Decode",
+	"DecodeParms",
+	"Default",
+	"DescendantFonts",
+	"Descent",
+	"Design",
+	"Dest",
+	"Dests",
+	"DeviceCMYK",
+	"DeviceGray",
+	"DeviceN",
+	"DeviceRGB",
+	"Di",
+	"Differences",
+	"Dissolve",
+	"Dm",
+	"Domain",
+	"Dur",
+	"E",
+	"EarlyChange",
+	"Encode",
+	"EncodedByteAlign",
+	"Encoding",
+	"Encrypt",
+	"EncryptMetadata",
+	"EndOfBlock",
+	"EndOfLine",
+	"Exclude",
+	"ExtGState",
+	"Extend",
+	"F",
+	"FL",
+	"FRM",
+	"FS",
+	"FT",
+	"Fade",
+	"Ff",
+	"Fields",
+	"FileAttachment",
+	"Filter",
+	"First",
+	"FirstChar",
+	"Fit",
+	"FitB",
+	"FitBH",
+	"FitBV",
+	"FitH",
+	"FitR",
+	"FitV",
+	"Fl",
+	"Flags",
+	"FlateDecode",
+	"Fly",
+	"Font",
+	"FontBBox",
+	"FontDescriptor",
+	"FontFile",
+	"FontFile2",
+	"FontFile3",
+	"FontMatrix",
+	"FontName",
+	"Form",
+	"FormType",
+	"FreeText",
+	"Function",
+	"FunctionType",
+	"Functions",
+	"G",
+	"Glitter",
+	"GoTo",
+	"GoToR",
+	"Group",
+	"H",
+	"Height",
+	"Highlight",
+	"I",
+	"IC",
+	"ICCBased",
+	"ID",
+	"IM",
+	"IRT",
+	"Identity",
+	"Identity-H",
+	"Identity-V",
+	"Image",
+	"ImageMask",
+	"Index",
+	"Indexed",
+	"Info",
+	"Ink",
+	"InkList",
+	"Intent",
+	"Interpolate",
+	"IsMap",
+	"ItalicAngle",
+	"JBIG2Decode",
+	"JBIG2Globals",
+	"JPXDecode",
+	"JS",
+	"JavaScript",
+	"K",
+	"Kids",
+	"L",
+	"LC",
+	"LJ",
+	"LW",
+	"LZ",
+	"LZW",
+	"LZWDecode",
+	"Lab",
+	"Last",
+	"LastChar",
+	"Launch",
+	"Length",
+	"Length1",
+	"Length2",
+	"Length3",
+	"Limits",
+	"Line",
+	"Linearized",
+	"Link",
+	"Locked",
+	"Luminosity",
+	"M",
+	"MK",
+	"ML",
+	"MMType1",
+	"Mac",
+	"Mask",
+	"Matrix",
+	"Matte",
+	"MaxLen",
+	"MediaBox",
+	"MissingWidth",
+	"Movie",
+	"N",
+	"Name",
+	"Named",
+	"Names",
+	"NewWindow",
+	"Next",
+	"None",
+	"Normal",
+	"O",
+	"OC",
+	"OCG",
+	"OCGs",
+	"OCMD",
+	"OCProperties",
+	"OE",
+	"OFF",
+	"ON",
+	"ObjStm",
+	"Of",
+	"Off",
+	"OpenType",
+	"Opt",
+	"Order",
+	"Ordering",
+	"Outlines",
+	"P",
+	"PDF",
+	"PS",
+	"Page",
+	"PageMode",
+	"Pages",
+	"PaintType",
+	"Parent",
+	"Pattern",
+	"PatternType",
+	"PolyLine",
+	"Polygon",
+	"Popup",
+	"Predictor",
+	"Prev",
+	"Print",
+	"PrinterMark",
+	"ProcSet",
+	"Producer",
+	"Properties",
+	"Push",
+	"Q",
+	"QuadPoints",
+	"R",
+	"RBGroups",
+	"RGB",
+	"RI",
+	"RL",
+	"Range",
+	"Rect",
+	"Ref",
+	"Registry",
+	"ResetForm",
+	"Resources",
+	"Root",
+	"Rotate",
+	"Rows",
+	"RunLengthDecode",
+	"S",
+	"SMask",
+	"SMaskInData",
+	"Screen",
+	"Separation",
+	"Shading",
+	"ShadingType",
+	"Si",
+	"Sig",
+	"SigFlags",
+	"Size",
+	"Sound",
+	"Split",
+	"Square",
+	"Squiggly",
+	"Stamp",
+	"Standard",
+	"StdCF",
+	"StemV",
+	"StmF",
+	"StrF",
+	"StrikeOut",
+	"SubFilter",
+	"Subtype",
+	"Subtype2",
+	"Supplement",
+	"T",
+	"TR",
+	"TR2",
+	"Text",
+	"TilingType",
+	"Title",
+	"ToUnicode",
+	"Trans",
+	"Transparency",
+	"TrapNet",
+	"TrimBox",
+	"TrueType",
+	"Tx",
+	"Type",
+	"Type0",
+	"Type1",
+	"Type1C",
+	"Type3",
+	"U",
+	"UE",
+	"UF",
+	"URI",
+	"URL",
+	"Unchanged",
+	"Uncover",
+	"Underline",
+	"Unix",
+	"Usage",
+	"UseCMap",
+	"UseOutlines",
+	"UserUnit",
+	"V",
+	"V2",
+	"VE",
+	"Version",
+	"VerticesPerRow",
+	"View",
+	"W",
+	"W2",
+	"WMode",
+	"Watermark",
+	"Widget",
+	"Width",
+	"Widths",
+	"WinAnsiEncoding",
+	"Wipe",
+	"XHeight",
+	"XObject",
+	"XRef",
+	"XRefStm",
+	"XStep",
+	"XYZ",
+	"YStep",
+	"adbe.pkcs7.detached",
+	"ca",
+	"n0",
+	"n1",
+	"n2",
+};
@@ -346,6 +346,27 @@ pdf_grestore(fz_context *ctx, pdf_run_processor *pr)
 	}
 }
 
+/* A rendered cell of a coloured pattern can be reused wherever the
+ * pattern is drawn, as long as nothing it inherits from the page could
+ * change how it looks. */
+static int
+pdf_pattern_tile_id(fz_context *ctx, pdf_gstate *gstate, pdf_pattern *pat)
+{
+	const fz_stroke_state *stroke = gstate->stroke_state;
+
+	if (pat->ismask)
+		return 0;
+	if (gstate->fill.alpha != 1 || gstate->stroke.alpha != 1 || gstate->blendmode)
+		return 0;
+	if (gstate->font || gstate->char_space != 0 || gstate->word_space != 0 || gstate->scale != 1 ||
+		gstate->leading != 0 || gstate->render != 0 || gstate->rise != 0)
+		return 0;
+	if (stroke->linewidth != 1 || stroke->start_cap != 0 || stroke->dash_cap != 0 || stroke->end_cap != 0 ||
+		stroke->linejoin != 0 || stroke->miterlimit != 10 || stroke->dash_len != 0)
+		return 0;
+	return pat->id;
+}
+
 static void
 pdf_show_pattern(fz_context *ctx, pdf_run_processor *pr, pdf_pattern *pat, pdf_gstate *pat_gstate, const fz_rect *area, int what)
 {
@@ -432,21 +453,27 @@ pdf_show_pattern(fz_context *ctx, pdf_run_processor *pr, pdf_pattern *pat, pdf_g
 		if (0)
 #endif
 		{
-			fz_begin_tile(ctx, pr->dev, &local_area, &pat->bbox, pat->xstep, pat->ystep, &ptm);
-			gstate->ctm = ptm;
-			pdf_gsave(ctx, pr);
-			fz_try(ctx)
-			{
-				pdf_process_contents(ctx, (pdf_processor*)pr, pat->document, pat->resources, pat->contents, NULL);
-			}
-			fz_always(ctx)
-			{
-				pdf_grestore(ctx, pr);
+			int id = pdf_pattern_tile_id(ctx, gstate, pat);
+
+			if (fz_begin_tile_id(ctx, pr->dev, &local_area, &pat->bbox, pat->xstep, pat->ystep, &ptm, id))
 				fz_end_tile(ctx, pr->dev);
-			}
-			fz_catch(ctx)
+			else
 			{
-				fz_rethrow(ctx);
+				gstate->ctm = ptm;
+				pdf_gsave(ctx, pr);
+				fz_try(ctx)
+				{
+					pdf_process_contents(ctx, (pdf_processor*)pr, pat->document, pat->resources, pat->contents, NULL);
+				}
+				fz_always(ctx)
+				{
+					pdf_grestore(ctx, pr);
+					fz_end_tile(ctx, pr->dev);
+				}
+				fz_catch(ctx)
+				{
+					fz_rethrow(ctx);
+				}
 			}
 		}
 		else
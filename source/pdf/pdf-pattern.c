@@ -42,6 +42,7 @@ pdf_load_pattern(fz_context *ctx, pdf_document *doc, pdf_obj *dict)
 
 	pat = fz_malloc_struct(ctx, pdf_pattern);
 	FZ_INIT_STORABLE(pat, 1, pdf_drop_pattern_imp);
+	pat->id = fz_gen_id(ctx);
 	pat->document = doc;
 	pat->resources = NULL;
 	pat->contents = NULL;
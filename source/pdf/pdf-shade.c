@@ -9,30 +9,41 @@ static void
 pdf_sample_composite_shade_function(fz_context *ctx, fz_shade *shade, fz_function *func, float t0, float t1)
 {
 	int i, n;
-	float t;
+	float t[256];
+	float *out;
 
 	n = fz_colorspace_n(ctx, shade->colorspace);
+	for (i = 0; i < 256; i++)
+		t[i] = t0 + (i / 255.0f) * (t1 - t0);
+
+	out = fz_malloc_array(ctx, 256, n * sizeof(float));
+	fz_eval_function_n(ctx, func, t, 1, out, n, 256);
 	for (i = 0; i < 256; i++)
 	{
-		t = t0 + (i / 255.0f) * (t1 - t0);
-		fz_eval_function(ctx, func, &t, 1, shade->function[i], n);
+		memcpy(shade->function[i], out + i * n, n * sizeof(float));
 		shade->function[i][n] = 1;
 	}
+	fz_free(ctx, out);
 }
 
 static void
 pdf_sample_component_shade_function(fz_context *ctx, fz_shade *shade, int funcs, fz_function **func, float t0, float t1)
 {
 	int i, k;
-	float t;
+	float t[256];
+	float out[256];
 
 	for (i = 0; i < 256; i++)
+		t[i] = t0 + (i / 255.0f) * (t1 - t0);
+
+	for (k = 0; k < funcs; k++)
 	{
-		t = t0 + (i / 255.0f) * (t1 - t0);
-		for (k = 0; k < funcs; k++)
-			fz_eval_function(ctx, func[k], &t, 1, &shade->function[i][k], 1);
-		shade->function[i][k] = 1;
+		fz_eval_function_n(ctx, func[k], t, 1, out, 1, 256);
+		for (i = 0; i < 256; i++)
+			shade->function[i][k] = out[i];
 	}
+	for (i = 0; i < 256; i++)
+		shade->function[i][funcs] = 1;
 }
 
 static void
@@ -52,7 +63,7 @@ pdf_load_function_based_shading(fz_context *ctx, pdf_document *doc, fz_shade *sh
 {
 	pdf_obj *obj;
 	float x0, y0, x1, y1;
-	float fv[2];
+	float fv[(FUNSEGS+1) * 2];
 	fz_matrix matrix;
 	int xx, yy;
 	float *p;
@@ -86,15 +97,14 @@ pdf_load_function_based_shading(fz_context *ctx, pdf_document *doc, fz_shade *sh
 	p = shade->u.f.fn_vals;
 	for (yy = 0; yy <= FUNSEGS; yy++)
 	{
-		fv[1] = y0 + (y1 - y0) * yy / FUNSEGS;
-
 		for (xx = 0; xx <= FUNSEGS; xx++)
 		{
-			fv[0] = x0 + (x1 - x0) * xx / FUNSEGS;
-
-			fz_eval_function(ctx, func, fv, 2, p, n);
-			p += n;
+			fv[xx * 2 + 0] = x0 + (x1 - x0) * xx / FUNSEGS;
+			fv[xx * 2 + 1] = y0 + (y1 - y0) * yy / FUNSEGS;
 		}
+
+		fz_eval_function_n(ctx, func, fv, 2, p, n, FUNSEGS+1);
+		p += (FUNSEGS+1) * n;
 	}
 }
 
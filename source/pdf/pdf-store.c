@@ -43,12 +43,14 @@ pdf_print_key(fz_context *ctx, fz_output *out, void *key_)
 
 static fz_store_type pdf_obj_store_type =
 {
+	"pdf_obj",
 	pdf_make_hash_key,
 	pdf_keep_key,
 	pdf_drop_key,
 	pdf_cmp_key,
 	pdf_print_key,
-	NULL
+	NULL,
+	8
 };
 
 void
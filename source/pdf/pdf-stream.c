@@ -431,6 +431,61 @@ pdf_open_stream_with_offset(fz_context *ctx, pdf_document *doc, int num, pdf_obj
 	return pdf_open_filter(ctx, doc, doc->file, dict, num, stm_ofs, NULL);
 }
 
+/*
+ * Share the contents of a stream as they lie in the file, where the file
+ * is held in memory and they need no decryption, nor (unless raw) any
+ * decoding other than what params can describe. Sets params as
+ * pdf_open_filter would. Returns NULL if the stream must be read instead.
+ */
+static fz_buffer *
+pdf_slice_stream(fz_context *ctx, pdf_document *doc, int num, fz_compression_params *params, int raw)
+{
+	pdf_xref_entry *x;
+	pdf_obj *f, *p;
+	int len;
+
+	if (doc->crypt || num <= 0 || num >= pdf_xref_len(ctx, doc))
+		return NULL;
+
+	x = pdf_cache_object(ctx, doc, num);
+	if (x->stm_ofs == 0 || x->stm_buf)
+		return NULL;
+
+	if (!raw)
+	{
+		f = pdf_dict_geta(ctx, x->obj, PDF_NAME_Filter, PDF_NAME_F);
+		p = pdf_dict_geta(ctx, x->obj, PDF_NAME_DecodeParms, PDF_NAME_DP);
+		if (pdf_array_len(ctx, f) > 1)
+			return NULL;
+		if (pdf_array_len(ctx, f) == 1)
+		{
+			f = pdf_array_get(ctx, f, 0);
+			p = pdf_array_get(ctx, p, 0);
+			if (!pdf_is_name(ctx, f))
+				return NULL;
+		}
+		if (pdf_is_name(ctx, f))
+		{
+			if (pdf_name_eq(ctx, f, PDF_NAME_JPXDecode))
+			{
+				if (params)
+					params->type = FZ_IMAGE_RAW;
+			}
+			else if (!params)
+				return NULL;
+			else
+			{
+				build_compression_params(ctx, f, p, params);
+				if (params->type == FZ_IMAGE_RAW)
+					return NULL;
+			}
+		}
+	}
+
+	len = pdf_to_int(ctx, pdf_dict_get(ctx, x->obj, PDF_NAME_Length));
+	return fz_slice_stream(ctx, doc->file, x->stm_ofs, len > 0 ? len : 0);
+}
+
 /*
  * Load raw (compressed but decrypted) contents of a stream into buf.
  */
@@ -450,6 +505,10 @@ pdf_load_raw_stream_number(fz_context *ctx, pdf_document *doc, int num)
 			return fz_keep_buffer(ctx, x->stm_buf);
 	}
 
+	buf = pdf_slice_stream(ctx, doc, num, NULL, 1);
+	if (buf)
+		return buf;
+
 	dict = pdf_load_object(ctx, doc, num);
 
 	len = pdf_to_int(ctx, pdf_dict_get(ctx, dict, PDF_NAME_Length));
@@ -555,6 +614,14 @@ pdf_load_image_stream(fz_context *ctx, pdf_document *doc, int num, fz_compressio
 			return fz_keep_buffer(ctx, entry->stm_buf);
 	}
 
+	buf = pdf_slice_stream(ctx, doc, num, params, 0);
+	if (buf)
+	{
+		if (truncated)
+			*truncated = 0;
+		return buf;
+	}
+
 	dict = pdf_load_object(ctx, doc, num);
 
 	len = pdf_to_int(ctx, pdf_dict_get(ctx, dict, PDF_NAME_Length));
@@ -346,6 +346,7 @@ static float layout_h = 600;
 static float layout_em = 12;
 static char *layout_css = NULL;
 static float min_line_width = 0.0f;
+static int cell_threshold = -1;
 
 static int showfeatures = 0;
 static int showtime = 0;
@@ -369,6 +370,7 @@ static float gamma_value = 1;
 static int invert = 0;
 static int band_height = 0;
 static int lowmemory = 0;
+static int nosimd = 0;
 
 static int errored = 0;
 static fz_stext_sheet *sheet = NULL;
@@ -430,7 +432,7 @@ static void usage(void)
 		"\t-f -\tfit width and/or height exactly; ignore original aspect ratio\n"
 		"\t-B -\tmaximum band_height (pgm, ppm, pam, png output only)\n"
 #ifdef MUDRAW_THREADS
-		"\t-T -\tnumber of threads to use for rendering (banded mode only)\n"
+		"\t-T -\tnumber of threads to use for rendering\n"
 #endif
 		"\n"
 		"\t-W -\tpage width for EPUB layout\n"
@@ -445,10 +447,12 @@ static void usage(void)
 		"\t-A -\tnumber of bits of antialiasing (0 to 8)\n"
 		"\t-A -/-\tnumber of bits of antialiasing (0 to 8) (graphics, text)\n"
 		"\t-l -\tminimum stroked line width (in pixels)\n"
+		"\t-E -\tmaximum number of edges for the cell scan converter (0 to disable)\n"
 		"\t-D\tdisable use of display list\n"
 		"\t-i\tignore errors\n"
 		"\t-L\tlow memory mode (avoid caching, clear objects after each page)\n"
 		"\t-P\tparallel interpretation/rendering\n"
+		"\t-X\tdisable SIMD code (for checking against the C versions)\n"
 		"\n"
 		"\t-y l\tList the layer configs to stderr\n"
 		"\t-y -\tSelect layer config (by number)\n"
@@ -553,18 +557,25 @@ static void drawband(fz_context *ctx, fz_page *page, fz_display_list *list, cons
 		else
 			fz_clear_pixmap_with_value(ctx, pix, 255);
 
-		dev = fz_new_draw_device(ctx, NULL, pix);
-		if (lowmemory)
-			fz_enable_device_hints(ctx, dev, FZ_NO_CACHE);
-		if (alphabits_graphics == 0)
-			fz_enable_device_hints(ctx, dev, FZ_DONT_INTERPOLATE_IMAGES);
-		if (list)
-			fz_run_display_list(ctx, list, dev, ctm, tbounds, cookie);
+		/* Without bands there is nothing for the worker threads
+		 * to share out, so split the page into tiles instead. */
+		if (list && num_workers > 1 && band_height == 0 && !lowmemory && alphabits_graphics != 0)
+			fz_render_display_list_parallel(ctx, list, ctm, pix, num_workers, cookie);
 		else
-			fz_run_page(ctx, page, dev, ctm, cookie);
-		fz_close_device(ctx, dev);
-		fz_drop_device(ctx, dev);
-		dev = NULL;
+		{
+			dev = fz_new_draw_device(ctx, NULL, pix);
+			if (lowmemory)
+				fz_enable_device_hints(ctx, dev, FZ_NO_CACHE);
+			if (alphabits_graphics == 0)
+				fz_enable_device_hints(ctx, dev, FZ_DONT_INTERPOLATE_IMAGES);
+			if (list)
+				fz_run_display_list(ctx, list, dev, ctm, tbounds, cookie);
+			else
+				fz_run_page(ctx, page, dev, ctm, cookie);
+			fz_close_device(ctx, dev);
+			fz_drop_device(ctx, dev);
+			dev = NULL;
+		}
 
 		if (invert)
 			fz_invert_pixmap(ctx, pix);
@@ -841,6 +852,12 @@ static void dodrawpage(fz_context *ctx, fz_page *page, fz_display_list *list, in
 			int totalheight = ibounds.y1 - ibounds.y0;
 			int drawheight = totalheight;
 
+			/* Decode the images for the whole page side by side
+			 * before the bands (or tiles) are drawn, so that the
+			 * workers do not each wait on the same one. */
+			if (list && num_workers > 1 && !lowmemory)
+				fz_prefetch_display_list_images(ctx, list, &ctm, &tbounds, num_workers, cookie);
+
 			if (band_height != 0)
 			{
 				/* Banded rendering; we'll only render to a
@@ -1046,6 +1063,7 @@ static void dodrawpage(fz_context *ctx, fz_page *page, fz_display_list *list, in
 	if (showmemory)
 	{
 		fz_dump_glyph_cache_stats(ctx);
+		fz_print_store_stats(ctx, fz_stderr(ctx));
 	}
 
 	fz_flush_warnings(ctx);
@@ -1429,7 +1447,7 @@ int mudraw_main(int argc, char **argv)
 
 	fz_var(doc);
 
-	while ((c = fz_getopt(argc, argv, "p:o:F:R:r:w:h:fB:c:G:Is:A:DiW:H:S:T:U:LvPl:y:")) != -1)
+	while ((c = fz_getopt(argc, argv, "p:o:F:R:r:w:h:fB:c:G:Is:A:DiW:H:S:T:U:LvPXl:E:y:")) != -1)
 	{
 		switch (c)
 		{
@@ -1476,6 +1494,7 @@ int mudraw_main(int argc, char **argv)
 		}
 		case 'D': uselist = 0; break;
 		case 'l': min_line_width = fz_atof(fz_optarg); break;
+		case 'E': cell_threshold = atoi(fz_optarg); break;
 		case 'i': ignore_errors = 1; break;
 
 		case 'T':
@@ -1487,6 +1506,7 @@ int mudraw_main(int argc, char **argv)
 #endif
 		case 'L': lowmemory = 1; break;
 		case 'P': bgprint.active = 1; break;
+		case 'X': nosimd = 1; break;
 
 		case 'y': layer_config = fz_optarg; break;
 
@@ -1504,11 +1524,6 @@ int mudraw_main(int argc, char **argv)
 			fprintf(stderr, "cannot use multiple threads without using display list\n");
 			exit(1);
 		}
-
-		if (band_height == 0)
-		{
-			fprintf(stderr, "Using multiple threads without banding is pointless\n");
-		}
 	}
 
 	if (bgprint.active)
@@ -1530,6 +1545,14 @@ int mudraw_main(int argc, char **argv)
 	fz_set_text_aa_level(ctx, alphabits_text);
 	fz_set_graphics_aa_level(ctx, alphabits_graphics);
 	fz_set_graphics_min_line_width(ctx, min_line_width);
+	if (cell_threshold >= 0)
+		fz_set_graphics_cell_threshold(ctx, cell_threshold);
+	if (nosimd)
+		fz_set_cpu_features(ctx, 0);
+	if (num_workers > 1)
+		fz_set_image_decode_threads(ctx, num_workers);
+	/* The input files are not expected to change under us. */
+	fz_set_map_files(ctx, 1);
 
 	if (bgprint.active)
 	{